@@ -70,6 +70,27 @@ bc_pgfault(struct UTrapframe *utf)
 		panic("reading free block %08x\n", blockno);
 }
 
+// Give the block cache its own copy of the block containing addr if
+// other environments map the same page (see serve_fault), so that they
+// don't see the block change.  Call before writing to the block.
+// Returns 0 on success, < 0 on error.
+int
+bc_unshare(void *addr)
+{
+	int r;
+
+	addr = ROUNDDOWN(addr, PGSIZE);
+	if (!va_is_mapped(addr) || pageref(addr) <= 1)
+		return 0;
+
+	if ((r = sys_page_alloc(0, UTEMP, PTE_SYSCALL)) < 0)
+		return r;
+	memmove(UTEMP, addr, PGSIZE);
+	if ((r = sys_page_map(0, UTEMP, 0, addr, PTE_SYSCALL)) < 0)
+		return r;
+	return sys_page_unmap(0, UTEMP);
+}
+
 // Flush the contents of the block containing VA out to disk if
 // necessary, then clear the PTE_D bit using sys_page_map.
 // If the block is not in the block cache or is not dirty, does
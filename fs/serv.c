@@ -48,6 +48,60 @@ struct OpenFile opentab[MAXOPEN] = {
 // Virtual address at which to receive page mappings containing client requests.
 union Fsipc *fsreq = (union Fsipc *)0x0ffff000;
 
+// Request rings shared with clients (see lib/ipcring.c).  Ring i's
+// Ipcring page is at RINGVA(i), followed by one Fsipc buffer page per
+// slot.  A ring is in use while its client still maps the ring page.
+// rings[i] is what we know about ring i without asking its client.
+#define MAXRINGS	16
+#define RINGVA(i)	(FILEVA + MAXOPEN*PGSIZE + (i)*(1 + IPCRING_NSLOT)*PGSIZE)
+#define RINGBUF(i, s)	((union Fsipc *) (RINGVA(i) + (1 + (s))*PGSIZE))
+struct Ipcring_server rings[MAXRINGS];
+
+// Programs registered for demand paging by FSREQ_IMAGE.  An env running
+// image i passes IMAGE_COOKIE(i) as its pager cookie, so images[0] is
+// never used.  Slots are reused round-robin once all are taken.  The
+// version changes whenever the image does.  The old cookie is retired
+// first, so the kernel forgets the text we provided under it and the
+// envs still running it stop asking us, and the version can safely wrap.
+#define MAXIMAGES	63
+#define IMAGE_BITS	6
+#define IMAGE_COOKIE(i)	((i) | images[i].im_version << IMAGE_BITS)
+struct Image {
+	struct File *im_file;
+	uint32_t im_version;	// Kept below PGSIZE >> IMAGE_BITS
+	bool im_used;		// The cookie was handed out
+	int im_nseg;
+	struct Fsimage_seg im_segs[FSIMAGE_NSEG];
+} images[MAXIMAGES + 1];
+int image_next = 1;
+
+// Give image i a new cookie, retiring the old one if anyone got it.
+static void
+image_new_version(int i)
+{
+	if (!images[i].im_used)
+		return;
+	sys_pager_retire(IMAGE_COOKIE(i));
+	images[i].im_version = (images[i].im_version + 1) %
+			       (PGSIZE >> IMAGE_BITS);
+	images[i].im_used = 0;
+}
+
+// File f is about to change; retire the cookie of any image of it.
+// Writing a file a block at a time retires each cookie only once.
+static void
+image_changed(struct File *f)
+{
+	int i;
+
+	for (i = 1; i <= MAXIMAGES; i++)
+		if (images[i].im_file == f)
+			image_new_version(i);
+}
+
+// Where private copies of demand-paged pages are built.
+#define PAGEVA		((char *) fsreq - PGSIZE)
+
 void
 serve_init(void)
 {
@@ -190,6 +244,7 @@ serve_set_size(envid_t envid, struct Fsreq_set_size *req)
 
 	// Second, call the relevant file system function (from fs/fs.c).
 	// On failure, return the error code to the client.
+	image_changed(o->o_file);
 	return file_set_size(o->o_file, req->req_size);
 }
 
@@ -254,6 +309,7 @@ serve_write(envid_t envid, struct Fsreq_write *req)
 	}
 
 	nbytes = MIN(req->req_n, PGSIZE - (sizeof(int) + sizeof(size_t)));
+	image_changed(o->o_file);
 
 	if ((nbytes = file_write(o->o_file, (void *) req->req_buf, req->req_n, o->o_fd->fd_offset)) >= 0) {
 		o->o_fd->fd_offset += nbytes;
@@ -262,6 +318,54 @@ serve_write(envid_t envid, struct Fsreq_write *req)
 	return nbytes;
 }
 
+// Like serve_read, but read at ipc->pread.req_offset and leave the
+// seek position alone.  The FS ring pipelines these, so each request
+// must know its own offset.
+int
+serve_pread(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_pread *req = &ipc->pread;
+	struct OpenFile *o;
+	off_t offset = req->req_offset;
+	size_t n = MIN(req->req_n, PGSIZE);
+	int r;
+
+	if (debug)
+		cprintf("serve_pread %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_n, offset);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (offset < 0)
+		return -E_INVAL;
+
+	return file_read(o->o_file, ipc->readRet.ret_buf, n, offset);
+}
+
+// Like serve_write, but write at req->req_offset and leave the seek
+// position alone.  A write that fails in the middle of a pipeline then
+// can't shift the data of the requests behind it.
+int
+serve_pwrite(envid_t envid, struct Fsreq_pwrite *req)
+{
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_pwrite %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_n, req->req_offset);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (req->req_offset < 0)
+		return -E_INVAL;
+
+	image_changed(o->o_file);
+	return file_write(o->o_file, req->req_buf,
+			  MIN(req->req_n, sizeof(req->req_buf)),
+			  req->req_offset);
+}
+
 // Stat ipc->stat.req_fileid.  Return the file's struct Stat to the
 // caller in ipc->statRet.
 int
@@ -329,6 +433,111 @@ serve_sync(envid_t envid, union Fsipc *req)
 	return 0;
 }
 
+// Register the open program req->req_fileid, whose loadable segments
+// are req->req_segs, so that spawn can have us page it in (see
+// serve_fault).  A program registered again keeps its slot.
+// Returns the cookie for sys_env_set_pager, < 0 on error.
+int
+serve_image(envid_t envid, struct Fsreq_image *req)
+{
+	struct OpenFile *o;
+	struct Fsimage_seg *seg;
+	int i, r;
+
+	if (debug)
+		cprintf("serve_image %08x %08x\n", envid, req->req_fileid);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (req->req_nseg < 0 || req->req_nseg > FSIMAGE_NSEG)
+		return -E_INVAL;
+	for (i = 0; i < req->req_nseg; i++) {
+		seg = &req->req_segs[i];
+		if (seg->seg_va < UTEXT || seg->seg_memsz > UTOP - seg->seg_va ||
+		    seg->seg_filesz > seg->seg_memsz ||
+		    PGOFF(seg->seg_va) != PGOFF(seg->seg_offset))
+			return -E_INVAL;
+	}
+
+	for (i = 1; i <= MAXIMAGES; i++)
+		if (images[i].im_file == o->o_file)
+			break;
+	if (i > MAXIMAGES) {
+		i = image_next;
+		image_next = image_next % MAXIMAGES + 1;
+		image_new_version(i);
+	}
+
+	images[i].im_file = o->o_file;
+	images[i].im_used = 1;
+	images[i].im_nseg = req->req_nseg;
+	memmove(images[i].im_segs, req->req_segs,
+		req->req_nseg * sizeof(req->req_segs[0]));
+	return IMAGE_COOKIE(i);
+}
+
+// Find the page that a demand-paged env faulted on.  'value' is the
+// page's address ORed with the env's cookie (see ipc_page_fault in the
+// kernel).  Faults carrying a retired cookie, sent before the kernel
+// learnt of it, are refused.  Read-only pages that hold nothing but
+// file data are the block cache's own pages, shared by every env
+// running the program; other pages are private copies, zero-filled
+// past the file data.
+// Stores the page and its permissions in *pg_store and *perm_store.
+// Returns 0 on success, < 0 on error.
+static int
+serve_fault(envid_t envid, uint32_t value, void **pg_store, int *perm_store)
+{
+	struct Image *im;
+	struct Fsimage_seg *seg;
+	uintptr_t va = ROUNDDOWN(value, PGSIZE);
+	uint32_t slot = PGOFF(value) % (1 << IMAGE_BITS);
+	uint32_t version = PGOFF(value) >> IMAGE_BITS, off, filesz, fileoff;
+	char *blk;
+	int r;
+
+	if (debug)
+		cprintf("serve_fault %08x %08x\n", envid, value);
+
+	if (slot < 1 || slot > MAXIMAGES || !images[slot].im_file ||
+	    images[slot].im_version != version)
+		return -E_INVAL;
+	im = &images[slot];
+
+	for (seg = im->im_segs; seg < im->im_segs + im->im_nseg; seg++)
+		if (va >= ROUNDDOWN(seg->seg_va, PGSIZE) &&
+		    va < seg->seg_va + seg->seg_memsz)
+			break;
+	if (seg == im->im_segs + im->im_nseg)
+		return -E_INVAL;
+
+	// Offsets from the start of the segment's first page
+	off = va - ROUNDDOWN(seg->seg_va, PGSIZE);
+	filesz = PGOFF(seg->seg_va) + seg->seg_filesz;
+	fileoff = ROUNDDOWN(seg->seg_offset, PGSIZE) + off;
+
+	if (!(seg->seg_perm & PTE_W) && off + PGSIZE <= filesz &&
+	    fileoff < im->im_file->f_size) {
+		if ((r = file_get_block(im->im_file, fileoff / BLKSIZE, &blk)) < 0)
+			return r;
+		// Fault the block in, since the kernel will look for it
+		(void) *(volatile char *) blk;
+		*pg_store = blk;
+		*perm_store = PTE_P | PTE_U;
+		return 0;
+	}
+
+	if ((r = sys_page_alloc(0, PAGEVA, PTE_P | PTE_U | PTE_W)) < 0)
+		return r;
+	if (off < filesz &&
+	    (r = file_read(im->im_file, PAGEVA, MIN(PGSIZE, filesz - off),
+			   fileoff)) < 0)
+		return r;
+	*pg_store = PAGEVA;
+	*perm_store = PTE_P | PTE_U | (seg->seg_perm & PTE_W);
+	return 0;
+}
+
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
@@ -337,13 +546,106 @@ fshandler handlers[] = {
 	[FSREQ_SET_SIZE] =	(fshandler)serve_set_size,
 	[FSREQ_READ] =		serve_read,
 	[FSREQ_WRITE] =		(fshandler)serve_write,
+	[FSREQ_PREAD] =		serve_pread,
+	[FSREQ_PWRITE] =	(fshandler)serve_pwrite,
 	[FSREQ_STAT] =		serve_stat,
 	[FSREQ_FLUSH] =		(fshandler)serve_flush,
 	[FSREQ_REMOVE] =	(fshandler)serve_remove,
-	[FSREQ_SYNC] =		serve_sync
+	[FSREQ_SYNC] =		serve_sync,
+	[FSREQ_IMAGE] =		(fshandler)serve_image
 };
 #define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
 
+// Set up a request ring whose Ipcring page the client sent as 'req'.
+// Returns the ring id, or < 0 on error.
+static int
+serve_ring_open(envid_t envid, union Fsipc *req, int perm)
+{
+	int i, s, r;
+
+	for (i = 0; i < MAXRINGS; i++)
+		if (pageref((void *) RINGVA(i)) < 2)
+			break;
+	if (i == MAXRINGS)
+		return -E_MAX_OPEN;
+
+	// Drop whatever is left of the ring's previous client
+	for (s = 0; s <= IPCRING_NSLOT; s++)
+		sys_page_unmap(0, (void *) (RINGVA(i) + s*PGSIZE));
+
+	if ((r = sys_page_map(0, req, 0, (void *) RINGVA(i), perm)) < 0)
+		return r;
+	ipcring_server_init(&rings[i], (struct Ipcring *) RINGVA(i), envid);
+	return i;
+}
+
+// Install the buffer page 'req' for one slot of a ring opened by envid.
+static int
+serve_ring_buf(envid_t envid, union Fsipc *req, int perm)
+{
+	struct Fsreq_ring_buf *rb = &req->ring_buf;
+
+	if (rb->req_ringid < 0 || rb->req_ringid >= MAXRINGS ||
+	    rb->req_slot < 0 || rb->req_slot >= IPCRING_NSLOT)
+		return -E_INVAL;
+
+	if (pageref((void *) RINGVA(rb->req_ringid)) < 2 ||
+	    rings[rb->req_ringid].sv_client != envid)
+		return -E_INVAL;
+
+	return sys_page_map(0, req, 0, RINGBUF(rb->req_ringid, rb->req_slot),
+			    perm);
+}
+
+// Serve the requests queued on every ring, then mark the rings as
+// sleeping.  Each ring gets one pass, so a client can't keep us here.
+// One that queued more meanwhile is served when it notifies or waits.
+static void
+serve_rings(void)
+{
+	struct Ipcring_server *sv;
+	struct Ipcring_slot *slot;
+	union Fsipc *buf;
+	int i, n;
+
+	for (i = 0; i < MAXRINGS; i++) {
+		sv = &rings[i];
+		if (pageref((void *) RINGVA(i)) < 2)
+			continue;
+
+		for (n = ipcring_req_avail(sv); n > 0; n--) {
+			slot = ipcring_req_peek(sv);
+			buf = RINGBUF(i, sv->sv_req_cons % IPCRING_NSLOT);
+			if (slot->is_type < NHANDLERS &&
+			    handlers[slot->is_type] && pageref(buf) >= 2)
+				slot->is_result =
+				    handlers[slot->is_type](sv->sv_client, buf);
+			else
+				slot->is_result = -E_INVAL;
+			ipcring_rsp_push(sv);
+		}
+
+		ipcring_server_sleep(sv);
+	}
+}
+
+// envid is waiting for a response on its ring.  One that has no ring
+// is answered with an error at once.  As in ipcring_client_wait, the
+// answer must not block us.
+static void
+serve_ring_wait(envid_t envid)
+{
+	int i;
+
+	for (i = 0; i < MAXRINGS; i++)
+		if (pageref((void *) RINGVA(i)) >= 2 &&
+		    rings[i].sv_client == envid) {
+			ipcring_client_wait(&rings[i]);
+			return;
+		}
+	sys_ipc_try_send(envid, -E_INVAL, (void *) UTOP, 0);
+}
+
 void
 serve(void)
 {
@@ -351,31 +653,63 @@ serve(void)
 	int perm, r;
 	void *pg;
 
+	perm = 0;
+	req = ipc_recv((int32_t *) &whom, fsreq, &perm);
 	while (1) {
-		perm = 0;
-		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
 		if (debug)
 			cprintf("fs req %d from %08x [page %08x: %s]\n",
 				req, whom, vpt[PGNUM(fsreq)], fsreq);
 
-		// All requests must contain an argument page
+		// Ring wakeups carry no page and get no reply; waits are
+		// answered once the ring has a response
+		if (req == FSREQ_RING_NOTIFY || req == FSREQ_RING_WAIT) {
+			if (req == FSREQ_RING_WAIT)
+				serve_ring_wait(whom);
+			serve_rings();
+			perm = 0;
+			req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+			continue;
+		}
+
+		// Page faults of demand-paged envs carry no page
+		pg = NULL;
+		if (req >= UTEXT) {
+			r = serve_fault(whom, req, &pg, &perm);
+			goto reply;
+		}
+
+		// All other requests must contain an argument page
 		if (!(perm & PTE_P)) {
 			cprintf("Invalid request from %08x: no argument page\n",
 				whom);
-			continue; // just leave it hanging...
+			// just leave it hanging...
+			perm = 0;
+			req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+			continue;
 		}
 
-		pg = NULL;
 		if (req == FSREQ_OPEN) {
 			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req == FSREQ_RING_OPEN) {
+			r = serve_ring_open(whom, fsreq, perm);
+		} else if (req == FSREQ_RING_BUF) {
+			r = serve_ring_buf(whom, fsreq, perm);
 		} else if (req < NHANDLERS && handlers[req]) {
 			r = handlers[req](whom, fsreq);
 		} else {
 			cprintf("Invalid request code %d from %08x\n", whom, req);
 			r = -E_INVAL;
 		}
-		ipc_send(whom, r, pg, perm);
 		sys_page_unmap(0, fsreq);
+
+	reply:
+		// Don't sleep on requests queued on the rings meanwhile
+		serve_rings();
+
+		// Reply, switching straight back to the client, and wait
+		// for the next request in the same system call.
+		req = ipc_reply_recv(whom, r, pg, perm,
+				     (int32_t *) &whom, fsreq, &perm);
 	}
 }
 
@@ -0,0 +1,21 @@
+// The kernel clock page, mapped read-only at UCLOCK in every
+// environment so that user code can read the time without a system
+// call.  See kern/time.c.  It also tells the user library whether it
+// may make system calls with sysenter (see kern/trap.c).
+
+#ifndef JOS_INC_CLOCK_H
+#define JOS_INC_CLOCK_H
+
+#include <inc/types.h>
+
+// Milliseconds since boot are (rdtsc - cp_tsc_boot) / cp_tsc_per_msec
+// if the TSC was calibrated, else cp_msec, which the boot CPU's timer
+// interrupt advances.
+struct Clock_page {
+	uint64_t cp_tsc_boot;		// TSC at time 0
+	uint32_t cp_tsc_per_msec;	// 0 if the TSC is not calibrated
+	volatile uint32_t cp_msec;	// Time as of the last timer tick
+	uint32_t cp_sysenter;		// Nonzero if every CPU has sysenter
+};
+
+#endif /* !JOS_INC_CLOCK_H */
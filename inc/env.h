@@ -6,6 +6,7 @@
 #include <inc/types.h>
 #include <inc/trap.h>
 #include <inc/memlayout.h>
+#include <inc/syscall.h>
 
 typedef int32_t envid_t;
 
@@ -48,6 +49,39 @@ enum EnvType {
 	ENV_TYPE_NS,		// Network server
 	ENV_TYPE_JDOSC,         // JDOS client
 	ENV_TYPE_JDOSS,         // JDOS sevrer
+	NENVTYPE
+};
+
+// Scheduling classes (env_sched_class).  Runnable RT envs always run
+// before FAIR envs; among FAIR envs the one with the smallest virtual
+// runtime runs next.
+enum {
+	SCHED_CLASS_FAIR = 0,	// Weighted fair-share (virtual runtime)
+	SCHED_CLASS_RT,		// Fixed priority, for system servers
+};
+
+#define SCHED_PRIO_MAX		31	// Highest RT priority
+#define SCHED_PRIO_SERVER	16	// RT priority of fs, ns and DJOS
+
+#define SCHED_WEIGHT_MIN	16	// FAIR weights are in
+#define SCHED_WEIGHT_MAX	16384	// [SCHED_WEIGHT_MIN, SCHED_WEIGHT_MAX]
+#define SCHED_WEIGHT_DEFAULT	1024
+
+// Resource usage of an environment, kept up to date by the kernel and
+// copied out by sys_env_stats.
+struct Env_stats {
+	uint64_t es_cpu_tsc;		// TSC cycles spent running
+	uint32_t es_cpu_msec;		// The same in msec (*)
+	uint32_t es_ticks;		// Timer ticks that interrupted it
+	uint32_t es_syscalls[NSYSCALLS];	// System calls made, by number
+	uint32_t es_pgfaults;		// User-mode page faults ...
+	uint32_t es_cow_faults;		// ... of which the kernel copied
+	uint32_t es_ipc_sends;		// IPCs delivered by this env
+	uint32_t es_ipc_recvs;		// IPCs delivered to this env
+	uint32_t es_npages;		// Pages mapped below UTOP (*)
+	uint64_t es_migrated;		// Bytes moved in or out by DJOS
+
+	// (*) Only filled in by sys_env_stats
 };
 
 struct Env {
@@ -59,25 +93,51 @@ struct Env {
 	unsigned env_status;		// Status of the environment
 	uint32_t env_runs;		// Number of times environment has run
 	int env_cpunum;			// The CPU that the env is running on
+	bool env_net_waiting;		// Blocked in sys_net_wait
+
+	// Scheduling
+	int env_sched_class;		// SCHED_CLASS_FAIR or SCHED_CLASS_RT
+	int env_priority;		// RT priority, higher runs first
+	uint32_t env_weight;		// FAIR share weight
+	uint64_t env_vruntime;		// FAIR virtual runtime
 
 	// Address space
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	bool env_cow_kernel;		// Kernel resolves PTE_COW faults
+	envid_t env_pager;		// Provides not-present pages, if set
+	uint32_t env_pager_cookie;	// Passed to env_pager with each fault
+	bool env_pager_waiting;		// Blocked on env_pager for a page
+	uintptr_t env_pager_va;		// Page last asked of env_pager
 
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
+	envid_t env_ipc_waitfor;	// If nonzero, only receive from this env
 	void *env_ipc_dstva;		// VA at which to map received page
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
 
+	// Blocking send (see sys_ipc_send)
+	bool env_ipc_sending;		// Env is queued sending
+	envid_t env_ipc_send_to;	// Env whose send queue we're on
+	uint32_t env_ipc_send_value;	// Value, page and perm to deliver
+	void *env_ipc_send_srcva;
+	unsigned env_ipc_send_perm;
+	struct Env *env_ipc_send_next;	// Next env in the same send queue
+	struct Env *env_ipc_sendq;	// Envs blocked sending to us, FIFO
+	struct Env *env_ipc_sendq_tail;
+
 	// Distributed JOS
 	uint32_t env_hostip;            // Host IPv4 address
 	uint16_t env_hostport;          // Host port
 	bool env_alien;                 // Alien? From another planet
 	envid_t env_hosteid;            // Host env id
+
+	// Accounting
+	struct Env_stats env_stats;
 };
 
 #endif // !JOS_INC_ENV_H
@@ -66,11 +66,40 @@ enum {
 	// Read returns a Fsret_read on the request page
 	FSREQ_READ,
 	FSREQ_WRITE,
+	// PREAD and PWRITE are READ and WRITE at an explicit offset; they
+	// leave the seek position alone
+	FSREQ_PREAD,
+	FSREQ_PWRITE,
 	// Stat returns a Fsret_stat on the request page
 	FSREQ_STAT,
 	FSREQ_FLUSH,
 	FSREQ_REMOVE,
-	FSREQ_SYNC
+	FSREQ_SYNC,
+	// Ring requests: the argument page is the shared Ipcring page
+	// for RING_OPEN, which returns a ring id, and the buffer page for
+	// one slot for RING_BUF.  RING_NOTIFY carries no page and no
+	// reply; it only wakes the server to look at its rings.
+	// RING_WAIT carries no page and is answered once the caller's
+	// ring has a response.
+	FSREQ_RING_OPEN,
+	FSREQ_RING_BUF,
+	FSREQ_RING_NOTIFY,
+	FSREQ_RING_WAIT,
+	// Image registers an open program for demand paging and returns
+	// the cookie its envs' faults will carry (see serve_image)
+	FSREQ_IMAGE
+};
+
+// Most loadable segments an FSREQ_IMAGE program may have
+#define FSIMAGE_NSEG	4
+
+// One loadable segment of a demand-paged program, as in its Proghdr
+struct Fsimage_seg {
+	uintptr_t seg_va;
+	size_t seg_memsz;
+	size_t seg_filesz;
+	off_t seg_offset;
+	int seg_perm;		// PTE_W for a writable segment
 };
 
 union Fsipc {
@@ -94,6 +123,17 @@ union Fsipc {
 		size_t req_n;
 		char req_buf[PGSIZE - (sizeof(int) + sizeof(size_t))];
 	} write;
+	struct Fsreq_pread {
+		int req_fileid;
+		size_t req_n;
+		off_t req_offset;
+	} pread;
+	struct Fsreq_pwrite {
+		int req_fileid;
+		size_t req_n;
+		off_t req_offset;
+		char req_buf[PGSIZE - (sizeof(int) + sizeof(size_t) + sizeof(off_t))];
+	} pwrite;
 	struct Fsreq_stat {
 		int req_fileid;
 	} stat;
@@ -108,6 +148,15 @@ union Fsipc {
 	struct Fsreq_remove {
 		char req_path[MAXPATHLEN];
 	} remove;
+	struct Fsreq_ring_buf {
+		int req_ringid;
+		int req_slot;
+	} ring_buf;
+	struct Fsreq_image {
+		int req_fileid;
+		int req_nseg;
+		struct Fsimage_seg req_segs[FSIMAGE_NSEG];
+	} image;
 
 	// Ensure Fsipc is one page
 	char _pad[PGSIZE];
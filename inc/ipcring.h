@@ -0,0 +1,52 @@
+// Shared-memory request/response rings between a client and a server.
+// See lib/ipcring.c.
+
+#ifndef JOS_INC_IPCRING_H
+#define JOS_INC_IPCRING_H
+
+#include <inc/types.h>
+#include <inc/mmu.h>
+
+// Number of slots in a ring; must be a power of two
+#define IPCRING_NSLOT	8
+
+// One request, overwritten in place by its response.
+struct Ipcring_slot {
+	uint32_t is_type;		// Request code, set by the client
+	int32_t is_result;		// Result, set by the server
+};
+
+// A ring lives on its own page, mapped by both ends.
+// The client produces requests at ir_req_prod; the server consumes
+// them and publishes responses at ir_rsp_prod in the same order; the
+// client consumes responses at ir_rsp_cons.  Indexes count up forever
+// and are taken modulo IPCRING_NSLOT.  The server keeps its own
+// consumer index in a struct Ipcring_server, since anything on this
+// page can be changed by the client at any time.
+struct Ipcring {
+	envid_t ir_client;
+	envid_t ir_server;
+	uint32_t ir_notify;		// IPC value that wakes the server
+	uint32_t ir_wait;		// IPC value that waits for a response
+
+	volatile uint32_t ir_req_prod;
+	volatile uint32_t ir_rsp_prod;
+	volatile uint32_t ir_rsp_cons;
+
+	// Set by the server when it is about to sleep in ipc_recv.  The
+	// client clears it with xchg and, if it was set, sends one
+	// wakeup IPC.
+	volatile uint32_t ir_server_sleeping;
+
+	struct Ipcring_slot ir_slot[IPCRING_NSLOT];
+};
+
+// The server's private state for one ring.
+struct Ipcring_server {
+	struct Ipcring *sv_ring;
+	envid_t sv_client;		// Who opened the ring
+	uint32_t sv_req_cons;		// Next request to serve
+	bool sv_client_waiting;		// Client is blocked in ir_wait
+};
+
+#endif /* !JOS_INC_IPCRING_H */
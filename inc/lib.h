@@ -22,6 +22,10 @@
 #include <inc/args.h>
 #include <inc/malloc.h>
 #include <inc/ns.h>
+#include <inc/ipcring.h>
+#include <inc/prof.h>
+#include <inc/trace.h>
+#include <inc/clock.h>
 
 #define USED(x)		(void)(x)
 
@@ -50,19 +54,29 @@ envid_t	sys_getenvid(void);
 int	sys_env_destroy(envid_t);
 void	sys_yield(void);
 static envid_t sys_exofork(void);
+envid_t	sys_fork(void);
 int	sys_env_set_status(envid_t env, int status);
 int	sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
+int	sys_env_set_cow(envid_t env, bool in_kernel);
+envid_t	sys_env_service(enum EnvType type);
 int	sys_page_alloc(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
+int	sys_ipc_call(envid_t to_env, uint32_t value, void *pg, int perm,
+		     void *rcv_pg);
+int	sys_ipc_reply_recv(envid_t to_env, uint32_t value, void *pg, int perm,
+			   void *rcv_pg);
 unsigned int sys_time_msec(void);
 int 	sys_env_swap(envid_t envid);
 int     sys_net_try_send(char *data, int len);
 int     sys_net_try_receive(char *data, int *len);
+int     sys_net_recv_page(void *va);
+int     sys_net_wait(void);
 int     sys_get_mac(uint32_t *low, uint32_t *high);
 int     sys_env_lease(struct Env* src, envid_t *dst_id);
 int     sys_copy_mem(envid_t env_id, void *addr, void* buf, int perm, 
@@ -72,6 +86,13 @@ int     sys_env_unsuspend(envid_t envid, uint32_t status, uint32_t value);
 int     sys_migrate(void *thisenv);
 int     sys_lease_complete();
 int     sys_env_set_thisenv(envid_t envid, void *thisenv);
+int     sys_env_set_sched(envid_t envid, int sched_class, int param);
+int     sys_batch(struct Syscall_desc *descs, int n);
+int     sys_prof(int cmd, int arg, struct Prof_entry *buf);
+int     sys_env_stats(envid_t envid, struct Env_stats *buf);
+int     sys_trace(uint32_t mask);
+int     sys_env_set_pager(envid_t envid, envid_t pager, uint32_t cookie);
+int     sys_pager_retire(uint32_t cookie);
 
 // This must be inlined.  Exercise for reader: why?
 static __inline envid_t __attribute__((always_inline))
@@ -89,12 +110,33 @@ sys_exofork(void)
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+int32_t ipc_call(envid_t to_env, uint32_t value, void *pg, int perm,
+		 void *rcv_pg, int *perm_store);
+int32_t ipc_reply_recv(envid_t to_env, uint32_t value, void *pg, int perm,
+		       envid_t *from_env_store, void *rcv_pg, int *perm_store);
 envid_t	ipc_find_env(enum EnvType type);
 
+// ipcring.c
+void	ipcring_init(struct Ipcring *r, envid_t server, uint32_t notify,
+		     uint32_t wait);
+struct Ipcring_slot *ipcring_req_slot(struct Ipcring *r);
+void	ipcring_req_push(struct Ipcring *r);
+struct Ipcring_slot *ipcring_rsp_wait(struct Ipcring *r);
+void	ipcring_rsp_pop(struct Ipcring *r);
+void	ipcring_server_init(struct Ipcring_server *sv, struct Ipcring *r,
+			    envid_t client);
+int	ipcring_req_avail(struct Ipcring_server *sv);
+struct Ipcring_slot *ipcring_req_peek(struct Ipcring_server *sv);
+void	ipcring_rsp_push(struct Ipcring_server *sv);
+void	ipcring_client_wait(struct Ipcring_server *sv);
+int	ipcring_server_sleep(struct Ipcring_server *sv);
+
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
 envid_t	sfork(void);	// Challenge!
+int	dupq_begin(void);
+int	dupq_map(envid_t srcenv, unsigned pn, envid_t dstenv, int perm);
+int	dupq_end(void);
 
 // fd.c
 int	close(int fd);
@@ -112,6 +154,8 @@ int	open(const char *path, int mode);
 int	ftruncate(int fd, off_t size);
 int	remove(const char *path);
 int	sync(void);
+int	file_image(int fd, const struct Fsimage_seg *segs, int nseg,
+		   envid_t *pager);
 
 // pageref.c
 int	pageref(void *addr);
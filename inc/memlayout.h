@@ -53,13 +53,17 @@
  *                     |          RO PAGES            | R-/R-  PTSIZE
  *    UPAGES    ---->  +------------------------------+ 0xef000000
  *                     |           RO ENVS            | R-/R-  PTSIZE
- * UTOP,UENVS ------>  +------------------------------+ 0xeec00000
+ *    UENVS     ---->  +------------------------------+ 0xeec00000
+ *                     |        RO CLOCK PAGE         | R-/R-  PGSIZE
+ *    UCLOCK    ---->  +------------------------------+ 0xeebff000
+ *                     |       RO TRACE RINGS         | R-/R-  PTSIZE-PGSIZE
+ * UTOP,UTRACE ----->  +------------------------------+ 0xee800000
  * UXSTACKTOP -/       |     User Exception Stack     | RW/RW  PGSIZE
- *                     +------------------------------+ 0xeebff000
+ *                     +------------------------------+ 0xee7ff000
  *                     |       Empty Memory (*)       | --/--  PGSIZE
- *    USTACKTOP  --->  +------------------------------+ 0xeebfe000
+ *    USTACKTOP  --->  +------------------------------+ 0xee7fe000
  *                     |      Normal User Stack       | RW/RW  PGSIZE
- *                     +------------------------------+ 0xeebfd000
+ *                     +------------------------------+ 0xee7fd000
  *                     |                              |
  *                     |                              |
  *                     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -112,13 +116,18 @@
 #define UPAGES		(UVPT - PTSIZE)
 // Read-only copies of the global env structures
 #define UENVS		(UPAGES - PTSIZE)
+// Read-only per-CPU kernel trace rings (see inc/trace.h)
+#define UTRACE		(UENVS - PTSIZE)
+// Read-only kernel clock page (see inc/clock.h), in the top page of the
+// UTRACE slot, which the trace rings don't reach
+#define UCLOCK		(UENVS - PGSIZE)
 
 /*
  * Top of user VM. User can manipulate VA from UTOP-1 and down!
  */
 
 // Top of user-accessible VM
-#define UTOP		UENVS
+#define UTOP		UTRACE
 // Top of one-page user exception stack
 #define UXSTACKTOP	UTOP
 // Next page left invalid to guard against exception stack overflow; then:
@@ -188,6 +197,11 @@ struct Page {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// If this page starts a free block in the kernel's buddy allocator,
+	// the block's order and the link that points at it; else order -1.
+	int16_t pp_order;
+	struct Page **pp_prevlink;
 };
 
 #endif /* !__ASSEMBLER__ */
@@ -69,6 +69,11 @@
 // hardware, so user processes are allowed to set them arbitrarily.
 #define PTE_AVAIL	0xE00	// Available for software use
 
+// PTE_AVAIL bits with a meaning agreed on by the library and the kernel.
+#define PTE_SHARE	0x400	// Mapping is shared across fork and spawn
+#define PTE_COW		0x800	// Copy-on-write
+#define PTE_NOFORK	0x200	// Mapping is not inherited across fork
+
 // Flags in PTE_SYSCALL may be used in system calls.  (Others may not.)
 #define PTE_SYSCALL	(PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
@@ -0,0 +1,33 @@
+// Sampling profiler interface shared by the kernel and user tools.
+// See kern/prof.c.
+
+#ifndef JOS_INC_PROF_H
+#define JOS_INC_PROF_H
+
+#include <inc/types.h>
+#include <inc/env.h>
+
+// Commands for sys_prof
+enum {
+	PROF_START = 0,		// Start sampling, recording 'arg' callers
+	PROF_STOP,		// Stop sampling, keeping the samples
+	PROF_RESET,		// Discard all samples
+	PROF_REPORT,		// Copy out up to 'arg' Prof_entry's
+};
+
+// Most callers recorded with each sample
+#define PROF_DEPTH	4
+
+// Length of the function name in a Prof_entry, including the NUL
+#define PROF_FNLEN	32
+
+// One line of a profile: the samples that landed in one function of
+// one environment.  pe_envid is 0 for samples taken in the kernel.
+struct Prof_entry {
+	envid_t pe_envid;
+	uintptr_t pe_fn_addr;
+	uint32_t pe_count;
+	char pe_fn[PROF_FNLEN];
+};
+
+#endif /* !JOS_INC_PROF_H */
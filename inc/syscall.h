@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
 	SYS_cputs = 0,
@@ -17,6 +19,9 @@ enum {
 	SYS_yield,
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
+	SYS_ipc_send,
+	SYS_ipc_call,
+	SYS_ipc_reply_recv,
 	SYS_time_msec,
 	SYS_env_swap,
 	SYS_net_try_send,
@@ -29,7 +34,26 @@ enum {
 	SYS_migrate,
 	SYS_lease_complete,
 	SYS_env_set_thisenv,
+	SYS_env_set_sched,
+	SYS_batch,
+	SYS_fork,
+	SYS_env_set_cow,
+	SYS_env_service,
+	SYS_prof,
+	SYS_env_stats,
+	SYS_trace,
+	SYS_env_set_pager,
+	SYS_net_wait,
+	SYS_net_recv_page,
+	SYS_pager_retire,
 	NSYSCALLS
 };
 
+// One system call in a sys_batch request
+struct Syscall_desc {
+	uint32_t sd_num;		// SYS_* number
+	uint32_t sd_args[5];		// Arguments, as for syscall()
+	int32_t sd_ret;			// Result, filled in by the kernel
+};
+
 #endif /* !JOS_INC_SYSCALL_H */
@@ -0,0 +1,69 @@
+// Kernel trace events, shared by the kernel and user-space readers.
+// See kern/trace.c.
+
+#ifndef JOS_INC_TRACE_H
+#define JOS_INC_TRACE_H
+
+#include <inc/types.h>
+
+// Event types (te_type).  Bit (1 << type) enables a type in the mask
+// passed to sys_trace.
+enum {
+	TRACE_SWITCH = 0,	// envid starts running; args: previous env
+	TRACE_SYSCALL_ENTER,	// args: syscall number, a1, a2
+	TRACE_SYSCALL_EXIT,	// args: syscall number, return value
+	TRACE_IPC_SEND,		// IPC delivered; args: sender, receiver, value
+	TRACE_IPC_RECV,		// envid blocks receiving; args: from, dstva
+	TRACE_PGFAULT,		// args: fault va, eip, error code
+	TRACE_ENV_CREATE,	// args: new env, its parent
+	TRACE_ENV_DESTROY,	// args: env freed
+	TRACE_NET_TX,		// args: length, descriptor, result
+	TRACE_NET_RX,		// args: length, descriptor
+	NTRACE
+};
+
+#define TRACE_ALL	((1 << NTRACE) - 1)
+
+// One event; 32 bytes.
+struct Trace_event {
+	uint64_t te_tsc;		// Time stamp counter at the event
+	uint32_t te_seq;		// Index of the event in its ring
+	uint16_t te_type;		// TRACE_*
+	uint16_t te_cpu;		// CPU that recorded it
+	int32_t te_envid;		// curenv's id, 0 if none
+	uint32_t te_args[3];
+};
+
+// Events kept per CPU; must be a power of two
+#define TRACE_NEVENT	1024
+
+// Number of rings mapped at UTRACE, one per possible CPU
+#define TRACE_NRING	8
+
+// Each CPU appends to its own ring without locks.  To record event i
+// it sets the slot's te_seq to ~0, fills in the event, sets te_seq to
+// i and then advances tr_head past i.  A reader that finds te_seq == i
+// both before and after copying the slot has a consistent copy of
+// event i.
+struct Trace_ring {
+	volatile uint32_t tr_head;	// Events ever recorded
+	uint32_t tr_pad[7];
+	struct Trace_event tr_events[TRACE_NEVENT];
+};
+
+// A trace file written by user/tracedump: this header, then th_nevent
+// events.  Each CPU's events are in order; merge CPUs by te_tsc.
+struct Trace_file_header {
+	uint32_t th_magic;		// TRACE_FILE_MAGIC
+	uint16_t th_version;		// TRACE_FILE_VERSION
+	uint16_t th_event_size;		// sizeof(struct Trace_event)
+	uint32_t th_nevent;		// Events that follow
+	uint32_t th_nlost;		// Events overwritten before being read
+	uint64_t th_tsc[2];		// TSC at the start and end ...
+	uint32_t th_msec[2];		// ... and sys_time_msec() then
+};
+
+#define TRACE_FILE_MAGIC	0x4352544a	// "JTRC"
+#define TRACE_FILE_VERSION	1
+
+#endif /* !JOS_INC_TRACE_H */
@@ -38,6 +38,8 @@
 #define IRQ_SPURIOUS     7
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
+#define IRQ_WAKEUP      20	// IPI that wakes a halted CPU
+#define IRQ_TLB         21	// IPI that asks for a TLB shootdown
 
 #ifndef __ASSEMBLER__
 
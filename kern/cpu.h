@@ -14,6 +14,7 @@
 enum {
 	CPU_UNUSED = 0,
 	CPU_STARTED,
+	CPU_HALTED,
 };
 
 // Per-CPU state
@@ -22,6 +23,13 @@ struct Cpu {
 	volatile unsigned cpu_status;   // The status of the CPU
 	struct Env *cpu_env;            // The currently-running environment.
 	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+	bool cpu_timer_on;              // Is the local APIC timer running?
+	struct Page *cpu_pages;         // Free pages cached by this CPU
+	int cpu_npages;                 // Length of cpu_pages
+	pde_t *cpu_pgdir;               // Page directory loaded in CR3
+	volatile bool cpu_in_kernel;    // Trapped in, maybe waiting for the lock
+	volatile bool cpu_tlb_pending;  // A TLB shootdown awaits this CPU
+	uint64_t cpu_run_tsc;           // TSC at the last env_run
 };
 
 // Initialized in mpconfig.c
@@ -41,5 +49,8 @@ void lapic_init(void);
 void lapic_startap(uint8_t apicid, uint32_t addr);
 void lapic_eoi(void);
 void lapic_ipi(int vector);
+void lapic_ipi_dest(int apicid, int vector);
+void lapic_timer_start(void);
+void lapic_timer_stop(void);
 
 #endif
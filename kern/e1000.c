@@ -4,6 +4,10 @@
 #include <inc/stdio.h>
 #include <inc/string.h>
 #include <kern/pmap.h>
+#include <kern/trace.h>
+#include <kern/env.h>
+#include <kern/sched.h>
+#include <kern/picirq.h>
 
 //volatile uint32_t *e1000; // MMIO address to access E1000 BAR
 
@@ -11,7 +15,15 @@ struct tx_desc tx_desc_array[E1000_TXDESC] __attribute__ ((aligned (16)));
 struct tx_pkt tx_pkt_bufs[E1000_TXDESC];
 
 struct rcv_desc rcv_desc_array[E1000_RCVDESC] __attribute__ ((aligned (16)));
-struct rcv_pkt rcv_pkt_bufs[E1000_RCVDESC];
+
+// Each receive descriptor has a page of its own, which the card fills
+// from RCV_PKT_OFFSET on, so that a received page can be handed to the
+// input env as it is (see e1000_receive_page).  The ring holds a
+// reference to each.
+struct Page *rcv_pages[E1000_RCVDESC];
+
+// The env blocked in e1000_rx_wait, if any
+static envid_t e1000_rx_waiter;
 
 // LAB 6: Your driver code here
 int
@@ -39,10 +51,13 @@ e1000_attach(struct pci_func *pcif)
 	}
 
 	// Initialize rcv desc buffer array
+	static_assert(RCV_PKT_OFFSET + RCV_PKT_SIZE <= PGSIZE);
 	memset(rcv_desc_array, 0x0, sizeof(struct rcv_desc) * E1000_RCVDESC);
-	memset(rcv_pkt_bufs, 0x0, sizeof(struct rcv_pkt) * E1000_RCVDESC);
 	for (i = 0; i < E1000_RCVDESC; i++) {
-		rcv_desc_array[i].addr = PADDR(rcv_pkt_bufs[i].buf);
+		if (!(rcv_pages[i] = page_alloc(0)))
+			panic("e1000_attach: out of memory");
+		rcv_pages[i]->pp_ref++;
+		rcv_desc_array[i].addr = page2pa(rcv_pages[i]) + RCV_PKT_OFFSET;
 	}
 
 	/* Transmit initialization */
@@ -111,6 +126,20 @@ e1000_attach(struct pci_func *pcif)
 	e1000[E1000_RCTL] &= ~E1000_RCTL_SZ; // 2048 byte size
 	e1000[E1000_RCTL] |= E1000_RCTL_SECRC;
 
+	// Interrupt on received packets, moderated, if the card has an
+	// IRQ line the 8259A can deliver
+	if (pcif->irq_line > 0 && pcif->irq_line < MAX_IRQS &&
+	    pcif->irq_line != IRQ_SLAVE) {
+		e1000[E1000_RDTR] = E1000_RDTR_DELAY;
+		e1000[E1000_RADV] = E1000_RADV_DELAY;
+		e1000[E1000_ITR] = E1000_ITR_INTERVAL;
+		e1000[E1000_IMC] = ~0;
+		(void) e1000[E1000_ICR];
+		e1000[E1000_IMS] = E1000_ICR_RX;
+		e1000_irq = pcif->irq_line;
+		irq_setmask_8259A(irq_mask_8259A & ~(1 << e1000_irq));
+	}
+
 	return 0;
 }
 
@@ -135,9 +164,11 @@ e1000_transmit(char *data, int len)
 		e1000[E1000_TDT] = (tdt + 1) % E1000_TXDESC;
 	}
 	else { // tx queue is full!
+		trace(TRACE_NET_TX, len, tdt, -E_TX_FULL);
 		return -E_TX_FULL;
 	}
 	
+	trace(TRACE_NET_TX, len, tdt, 0);
 	return 0;
 }
 
@@ -152,13 +183,101 @@ e1000_receive(char *data)
 			panic("Don't allow jumbo frames!\n");
 		}
 		len = rcv_desc_array[rdt].length;
-		memmove(data, rcv_pkt_bufs[rdt].buf, len);
+		memmove(data, page2kva(rcv_pages[rdt]) + RCV_PKT_OFFSET, len);
 		rcv_desc_array[rdt].status &= ~E1000_RXD_STAT_DD;
 		rcv_desc_array[rdt].status &= ~E1000_RXD_STAT_EOP;
 		e1000[E1000_RDT] = (rdt + 1) % E1000_RCVDESC;
 
+		trace(TRACE_NET_RX, len, rdt, 0);
 		return len;
 	}
 
 	return -E_RCV_EMPTY;
 }
+
+// Take the page the next packet was received into, without copying,
+// and give its descriptor a fresh page.  The page starts with a struct
+// jif_pkt: the packet's length, then its data.  The caller gets the
+// ring's reference to the page in *pp_store.
+//
+// Returns the packet's length, < 0 on error.  Errors are:
+//	-E_RCV_EMPTY if no packet has been received.
+//	-E_NO_MEM if there is no page to refill the ring with; the packet
+//		stays in the ring.
+int
+e1000_receive_page(struct Page **pp_store)
+{
+	struct Page *pp;
+	uint32_t rdt, len;
+
+	rdt = e1000[E1000_RDT];
+	if (!(rcv_desc_array[rdt].status & E1000_RXD_STAT_DD))
+		return -E_RCV_EMPTY;
+	if (!(rcv_desc_array[rdt].status & E1000_RXD_STAT_EOP))
+		panic("Don't allow jumbo frames!\n");
+
+	if (!(pp = page_alloc(0)))
+		return -E_NO_MEM;
+	pp->pp_ref++;
+
+	// The whole page goes to user space, so clear whatever its last
+	// owner, or a longer packet, left past this one
+	len = rcv_desc_array[rdt].length;
+	*pp_store = rcv_pages[rdt];
+	*(int *) page2kva(*pp_store) = len;
+	memset(page2kva(*pp_store) + RCV_PKT_OFFSET + len, 0,
+	       PGSIZE - RCV_PKT_OFFSET - len);
+
+	rcv_pages[rdt] = pp;
+	rcv_desc_array[rdt].addr = page2pa(pp) + RCV_PKT_OFFSET;
+	rcv_desc_array[rdt].status &= ~E1000_RXD_STAT_DD;
+	rcv_desc_array[rdt].status &= ~E1000_RXD_STAT_EOP;
+	e1000[E1000_RDT] = (rdt + 1) % E1000_RCVDESC;
+
+	trace(TRACE_NET_RX, len, rdt, 0);
+	return len;
+}
+
+static void
+e1000_intr_wake(void)
+{
+	struct Env *e;
+
+	if (e1000_rx_waiter && envid2env(e1000_rx_waiter, &e, 0) == 0 &&
+	    e->env_net_waiting) {
+		e->env_net_waiting = 0;
+		e->env_status = ENV_RUNNABLE;
+		sched_wakeup();
+	}
+	e1000_rx_waiter = 0;
+}
+
+// Block curenv until the card interrupts for received packets, unless
+// a packet is already waiting.  Only one env waits at a time; a new
+// waiter wakes the old one, which goes back to polling.
+//
+// Returns 0 on success, -E_NOT_SUPP if the card doesn't interrupt.
+int
+e1000_rx_wait(void)
+{
+	if (!e1000_irq)
+		return -E_NOT_SUPP;
+	if (rcv_desc_array[e1000[E1000_RDT]].status & E1000_RXD_STAT_DD)
+		return 0;
+
+	e1000_intr_wake();
+	e1000_rx_waiter = curenv->env_id;
+	curenv->env_net_waiting = 1;
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	return 0;
+}
+
+// Handle the card's interrupt: wake the env waiting for packets.
+void
+e1000_intr(void)
+{
+	// Reading ICR acknowledges the interrupt
+	if (e1000[E1000_ICR] & E1000_ICR_RX)
+		e1000_intr_wake();
+	irq_eoi();
+}
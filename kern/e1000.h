@@ -1,6 +1,7 @@
 #ifndef JOS_KERN_E1000_H
 #define JOS_KERN_E1000_H
 
+#include <inc/memlayout.h>
 #include <kern/pci.h>
 
 volatile uint32_t *e1000; // MMIO address to access E1000 BAR
@@ -14,6 +15,7 @@ volatile uint32_t *e1000; // MMIO address to access E1000 BAR
 #define E1000_RCVDESC 64
 #define TX_PKT_SIZE 1518
 #define RCV_PKT_SIZE 2048
+#define RCV_PKT_OFFSET 4 /* Receive after a jif_pkt's jp_len (inc/ns.h) */
 
 // Register Set
 #define E1000_STATUS   0x00008/4  /* Device Status - RO */
@@ -54,6 +56,26 @@ volatile uint32_t *e1000; // MMIO address to access E1000 BAR
 
 #define E1000_TIPG     0x00410/4  /* TX Inter-packet gap -RW */
 
+#define E1000_ICR      0x000C0/4  /* Interrupt Cause Read - R/clr */
+#define E1000_ITR      0x000C4/4  /* Interrupt Throttling Rate - RW */
+#define E1000_IMS      0x000D0/4  /* Interrupt Mask Set - RW */
+#define E1000_IMC      0x000D8/4  /* Interrupt Mask Clear - WO */
+#define E1000_RDTR     0x02820/4  /* RX Delay Timer - RW */
+#define E1000_RADV     0x0282C/4  /* RX Interrupt Absolute Delay Timer - RW */
+
+#define E1000_ICR_RXDMT0 0x00000010 /* rx desc min. threshold */
+#define E1000_ICR_RXO    0x00000040 /* rx overrun */
+#define E1000_ICR_RXT0   0x00000080 /* rx timer intr */
+#define E1000_ICR_RX     (E1000_ICR_RXDMT0 | E1000_ICR_RXO | E1000_ICR_RXT0)
+
+// Receive interrupt moderation.  The card waits RDTR (in 1.024us
+// units) after a packet for another before interrupting, but no more
+// than RADV after the first, and interrupts at most once per ITR (in
+// 256ns units), here 8000 times a second.
+#define E1000_RDTR_DELAY  20
+#define E1000_RADV_DELAY  64
+#define E1000_ITR_INTERVAL (1000000000 / (8000 * 256))
+
 /* Transmit Descriptor bit definitions */
 #define E1000_TXD_CMD_RS     0x00000008 /* Report Status */
 #define E1000_TXD_CMD_EOP    0x00000001 /* End of Packet */
@@ -89,14 +111,14 @@ struct tx_pkt
 	uint8_t buf[TX_PKT_SIZE];
 } __attribute__((packed));
 
-struct rcv_pkt
-{
-	uint8_t buf[RCV_PKT_SIZE];
-} __attribute__((packed));
 
+uint8_t e1000_irq;	// IRQ line the card interrupts on, 0 if none
 
 int e1000_attach(struct pci_func *pcif);
 int e1000_transmit(char *data, int len);
 int e1000_receive(char *data);
+int e1000_receive_page(struct Page **pp_store);
+int e1000_rx_wait(void);
+void e1000_intr(void);
 
 #endif	// JOS_KERN_E1000_H
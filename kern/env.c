@@ -14,7 +14,10 @@
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/syscall.h>
 #include <kern/e1000.h>
+#include <kern/trace.h>
+#include <kern/textcache.h>
 
 struct Env *envs = NULL;		// All environments
 static struct Env *env_free_list;	// Free environment list
@@ -121,6 +124,66 @@ bypass:
 	return 0;
 }
 
+// The env providing each service type (other than ENV_TYPE_USER and
+// ENV_TYPE_IDLE), or 0.  Kept by env_set_type and env_free so that
+// servers are found without scanning envs[].
+static envid_t env_services[NENVTYPE];
+
+// Page directories of freed envs, linked through pp_link, whose user
+// memory env_reclaim has yet to release.
+static struct Page *env_reclaim_list;
+
+// Page directories ready for env_setup_vm, linked through pp_link: the
+// user half empty and the rest set up as for a new env.  Each holds the
+// reference its env will own.  Refilled by idle CPUs (env_pgdir_fill)
+// and with the page directories env_reclaim empties.
+#define ENV_PGDIR_POOL	16
+static struct Page *env_pgdir_pool;
+static int env_pgdir_npool;
+
+//
+// Set e's type.  If e is the only live env of a service type,
+// it becomes the env env_service returns for that type.
+//
+void
+env_set_type(struct Env *e, enum EnvType type)
+{
+	e->env_type = type;
+	if (type != ENV_TYPE_USER && type != ENV_TYPE_IDLE &&
+	    !env_services[type])
+		env_services[type] = e->env_id;
+}
+
+//
+// Returns the id of the env providing service 'type', or 0 if there is
+// no such env.
+//
+envid_t
+env_service(enum EnvType type)
+{
+	if (type < 0 || type >= NENVTYPE)
+		return 0;
+	return env_services[type];
+}
+
+//
+// e is going away: hand its service to another env of the same type,
+// if there is one.  Slow, but servers rarely exit.
+//
+static void
+env_service_drop(struct Env *e)
+{
+	int i;
+
+	env_services[e->env_type] = 0;
+	for (i = 0; i < NENV; i++)
+		if (&envs[i] != e && envs[i].env_status != ENV_FREE &&
+		    envs[i].env_type == e->env_type) {
+			env_services[e->env_type] = envs[i].env_id;
+			break;
+		}
+}
+
 // Mark all environments in 'envs' as free, set their env_ids to 0,
 // and insert them into the env_free_list.
 // Make sure the environments are in the free list in the same order
@@ -170,6 +233,62 @@ env_init_percpu(void)
 	lldt(0);
 }
 
+//
+// Allocate and initialize a page directory for a new env, holding one
+// reference to it.  Returns NULL if out of memory.
+//
+static struct Page *
+env_pgdir_build(void)
+{
+	struct Page *p;
+	pde_t *pgdir;
+	int i;
+
+	if (!(p = page_alloc(ALLOC_ZERO)))
+		return NULL;
+	p->pp_ref++;
+	pgdir = page2kva(p);
+
+	// The VA space of all envs is identical above UTOP, except at
+	// UVPT, and empty below it.  In general, pp_ref is not maintained
+	// for physical pages mapped only above UTOP, but env_pgdir is an
+	// exception, for env_free to work correctly.
+	for (i = PDX(UTOP); i < NPDENTRIES; i++)
+		pgdir[i] = kern_pgdir[i];
+
+	// UVPT maps the env's own page table read-only.
+	// Permissions: kernel R, user R
+	pgdir[PDX(UVPT)] = PADDR(pgdir) | PTE_P | PTE_U;
+
+	return p;
+}
+
+// Put the page directory p, whose user half is empty, in the pool.
+static void
+env_pgdir_put(struct Page *p)
+{
+	p->pp_link = env_pgdir_pool;
+	env_pgdir_pool = p;
+	env_pgdir_npool++;
+}
+
+//
+// Build a page directory for the pool, if it is not full, so that
+// env_alloc needn't.  Called by idle CPUs.
+//
+// Returns the number of page directories built.
+//
+int
+env_pgdir_fill(void)
+{
+	struct Page *p;
+
+	if (env_pgdir_npool >= ENV_PGDIR_POOL || !(p = env_pgdir_build()))
+		return 0;
+	env_pgdir_put(p);
+	return 1;
+}
+
 //
 // Initialize the kernel virtual memory layout for environment e.
 // Allocate a page directory, set e->env_pgdir accordingly,
@@ -183,43 +302,17 @@ env_init_percpu(void)
 static int
 env_setup_vm(struct Env *e)
 {
-	int i;
-	struct Page *p = NULL;
-
-	// Allocate a page for the page directory
-	if (!(p = page_alloc(ALLOC_ZERO)))
+	struct Page *p;
+
+	// Take a page directory from the pool if there is one
+	if ((p = env_pgdir_pool)) {
+		env_pgdir_pool = p->pp_link;
+		env_pgdir_npool--;
+		p->pp_link = NULL;
+	} else if (!(p = env_pgdir_build()))
 		return -E_NO_MEM;
 
-	// Now, set e->env_pgdir and initialize the page directory.
-	//
-	// Hint:
-	//    - The VA space of all envs is identical above UTOP
-	//	(except at UVPT, which we've set below).
-	//	See inc/memlayout.h for permissions and layout.
-	//	Can you use kern_pgdir as a template?  Hint: Yes.
-	//	(Make sure you got the permissions right in Lab 2.)
-	//    - The initial VA below UTOP is empty.
-	//    - You do not need to make any more calls to page_alloc.
-	//    - Note: In general, pp_ref is not maintained for
-	//	physical pages mapped only above UTOP, but env_pgdir
-	//	is an exception -- you need to increment env_pgdir's
-	//	pp_ref for env_free to work correctly.
-	//    - The functions in kern/pmap.h are handy.
-
-	// LAB 3: Your code here.
 	e->env_pgdir = page2kva(p);
-	memset(e->env_pgdir, 0x0, PGSIZE); // clear pgdir
-	p->pp_ref++; // Increment pp_ref 
-
-	// Copy all mappings from kern_pgdir above UTOP
-	for (i = PDX(UTOP); i < NPDENTRIES; i++) {
-		e->env_pgdir[i] = kern_pgdir[i];
-	}
-
-	// UVPT maps the env's own page table read-only.
-	// Permissions: kernel R, user R
-	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
-
 	return 0;
 }
 
@@ -271,6 +364,8 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	e->env_type = ENV_TYPE_USER;
 	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
+	memset(&e->env_stats, 0, sizeof(e->env_stats));
+	sched_env_init(e);
 
 	// Clear out all the saved register state,
 	// to prevent the register values
@@ -299,13 +394,23 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
-
-	// Also clear the IPC receiving flag.
+	e->env_cow_kernel = 0;
+	e->env_pager = 0;
+	e->env_pager_cookie = 0;
+	e->env_pager_waiting = 0;
+	e->env_pager_va = 0;
+	e->env_net_waiting = 0;
+
+	// Also clear the IPC receiving flag and send queue.
 	e->env_ipc_recving = 0;
+	e->env_ipc_sending = 0;
+	e->env_ipc_sendq = NULL;
+	e->env_ipc_sendq_tail = NULL;
 
 	// commit the allocation
 	env_free_list = e->env_link;
 	*newenv_store = e;
+	trace(TRACE_ENV_CREATE, e->env_id, parent_id, 0);
 
 	// cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 	return 0;
@@ -462,13 +567,20 @@ env_create(uint8_t *binary, size_t size, enum EnvType type)
 		return;
 	}
 	load_icode(env, binary, size);
-	env->env_type = type;
+	env_set_type(env, type);
 
 	// If this is the file server (type == ENV_TYPE_FS) give it I/O privileges.
 	// LAB 5: Your code here.
 	if (type == ENV_TYPE_FS) {
 		env->env_tf.tf_eflags |= FL_IOPL_MASK;
 	}
+
+	// System servers run in the RT class so that requests through
+	// them are not delayed behind CPU-bound user envs.
+	if (type == ENV_TYPE_FS || type == ENV_TYPE_NS ||
+	    type == ENV_TYPE_JDOSC || type == ENV_TYPE_JDOSS) {
+		sched_set_class(env, SCHED_CLASS_RT, SCHED_PRIO_SERVER);
+	}
 }
 
 //
@@ -477,46 +589,38 @@ env_create(uint8_t *binary, size_t size, enum EnvType type)
 void
 env_free(struct Env *e)
 {
-	pte_t *pt;
-	uint32_t pdeno, pteno;
-	physaddr_t pa;
+	struct Page *pp;
 
 	// If freeing the current environment, switch to kern_pgdir
 	// before freeing the page directory, just in case the page
 	// gets reused.
-	if (e == curenv)
+	if (e == curenv) {
 		lcr3(PADDR(kern_pgdir));
+		thiscpu->cpu_pgdir = kern_pgdir;
+	}
 
-	// Note the environment's demise.
-	// cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
-
-	// Flush all mapped pages in the user portion of the address space
-	static_assert(UTOP % PTSIZE == 0);
-	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
-
-		// only look at mapped page tables
-		if (!(e->env_pgdir[pdeno] & PTE_P))
-			continue;
+	// Wake envs blocked sending to e, and leave any queue e is on.
+	ipc_cancel(e);
 
-		// find the pa and va of the page table
-		pa = PTE_ADDR(e->env_pgdir[pdeno]);
-		pt = (pte_t*) KADDR(pa);
+	// Let another env of e's type provide e's service
+	if (env_services[e->env_type] == e->env_id)
+		env_service_drop(e);
 
-		// unmap all PTEs in this page table
-		for (pteno = 0; pteno <= PTX(~0); pteno++) {
-			if (pt[pteno] & PTE_P)
-				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
-		}
+	// Release the text pages e provided as a pager
+	textcache_drop(e->env_id);
 
-		// free the page table itself
-		e->env_pgdir[pdeno] = 0;
-		page_decref(pa2page(pa));
-	}
-
-	// free the page directory
-	pa = PADDR(e->env_pgdir);
+	// Note the environment's demise.
+	// cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+	trace(TRACE_ENV_DESTROY, e->env_id, 0, 0);
+
+	// Leave the user portion of the address space to env_reclaim().
+	// No CPU has the page directory loaded any more (env_run reloads
+	// CR3 on every switch, and we switched away above if e was ours),
+	// so the CR3 load above is the only TLB flush teardown needs.
+	pp = pa2page(PADDR(e->env_pgdir));
+	pp->pp_link = env_reclaim_list;
+	env_reclaim_list = pp;
 	e->env_pgdir = 0;
-	page_decref(pa2page(pa));
 
 	// return the environment to the free list
 	e->env_status = ENV_FREE;
@@ -524,6 +628,75 @@ env_free(struct Env *e)
 	env_free_list = e;
 }
 
+//
+// Release the user memory and page tables of freed envs' page
+// directories, up to 'npt' page tables' worth (all of it if npt < 0).
+// Called by idle CPUs and when memory runs out.
+//
+// Returns the number of page tables (or 4MB pages) released, counting
+// the pooled page directories given up when npt < 0.
+//
+int
+env_reclaim(int npt)
+{
+	pde_t *pgdir;
+	pte_t *pt;
+	uint32_t pdeno, pteno;
+	physaddr_t pa;
+	struct Page *pp;
+	int n = 0;
+
+	static_assert(UTOP % PTSIZE == 0);
+	while ((pp = env_reclaim_list) && n != npt) {
+		pgdir = page2kva(pp);
+		for (pdeno = 0; pdeno < PDX(UTOP) && n != npt; pdeno++) {
+
+			// only look at mapped page tables
+			if (!(pgdir[pdeno] & PTE_P))
+				continue;
+			pa = PTE_ADDR(pgdir[pdeno]);
+			n++;
+
+			// a large page holds a reference on each of its pages
+			if (pgdir[pdeno] & PTE_PS) {
+				for (pteno = 0; pteno <= PTX(~0); pteno++)
+					page_decref(pa2page(pa + pteno * PGSIZE));
+				pgdir[pdeno] = 0;
+				continue;
+			}
+
+			// drop the reference of every PTE, then the table
+			pt = (pte_t*) KADDR(pa);
+			for (pteno = 0; pteno <= PTX(~0); pteno++)
+				if (pt[pteno] & PTE_P)
+					page_decref(pa2page(PTE_ADDR(pt[pteno])));
+			pgdir[pdeno] = 0;
+			page_decref(pa2page(pa));
+		}
+		if (pdeno < PDX(UTOP))
+			break;
+
+		// keep the now empty page directory for the next env,
+		// unless memory is short
+		env_reclaim_list = pp->pp_link;
+		pp->pp_link = NULL;
+		if (npt >= 0 && env_pgdir_npool < ENV_PGDIR_POOL)
+			env_pgdir_put(pp);
+		else
+			page_decref(pp);
+	}
+
+	// Out of memory: give up the pool as well
+	while (npt < 0 && (pp = env_pgdir_pool)) {
+		env_pgdir_pool = pp->pp_link;
+		env_pgdir_npool--;
+		pp->pp_link = NULL;
+		page_decref(pp);
+		n++;
+	}
+	return n;
+}
+
 //
 // Frees environment e.
 // If e was the current env, then runs a new environment (and does not return
@@ -571,6 +744,22 @@ env_pop_tf(struct Trapframe *tf)
 	panic("iret failed");  /* mostly to placate the compiler */
 }
 
+//
+// Charge the time since the last env_run or env_charge on this CPU,
+// kernel time included, to the env that was running.
+//
+void
+env_charge(void)
+{
+	uint64_t now = read_tsc();
+
+	if (curenv) {
+		curenv->env_stats.es_cpu_tsc += now - thiscpu->cpu_run_tsc;
+		sched_charge(curenv, now - thiscpu->cpu_run_tsc);
+	}
+	thiscpu->cpu_run_tsc = now;
+}
+
 //
 // Context switch from curenv to env e.
 // Note: if this is the first call to env_run, curenv is NULL.
@@ -598,16 +787,30 @@ env_run(struct Env *e)
 	//	e->env_tf to sensible values.
 
 	// LAB 3: Your code here.
+	envid_t prev;
+
+	env_charge();
+
 	if (curenv == NULL || curenv->env_id != e->env_id) { // context switch!
 		if (curenv != NULL && curenv->env_status == ENV_RUNNING) {
 			curenv->env_status = ENV_RUNNABLE;
 		}
+		prev = curenv ? curenv->env_id : 0;
 		curenv = e;
+		trace(TRACE_SWITCH, prev, 0, 0);
 		curenv->env_status = ENV_RUNNING;
 		curenv->env_runs++;
 		lcr3(PADDR(curenv->env_pgdir));
+		thiscpu->cpu_pgdir = curenv->env_pgdir;
+
+		// sched_halt() may have stopped this CPU's timer
+		if (e->env_type != ENV_TYPE_IDLE)
+			lapic_timer_start();
 	}
 
+	// Send TLB invalidations batched on our way through the kernel
+	tlb_shootdown();
+	thiscpu->cpu_in_kernel = 0;
 	unlock_kernel();
 	env_pop_tf(&curenv->env_tf);
 }
@@ -135,6 +135,7 @@ mp_main(void)
 {
 	// We are in high EIP now, safe to switch to kern_pgdir 
 	lcr3(PADDR(kern_pgdir));
+	lcr4(rcr4() | CR4_PSE);
 	cprintf("SMP: CPU %d starting\n", cpunum());
 
 	lapic_init();
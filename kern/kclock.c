@@ -1,6 +1,7 @@
 /* See COPYRIGHT for copyright information. */
 
-/* Support for reading the NVRAM from the real-time clock. */
+/* Support for reading the NVRAM from the real-time clock,
+ * and for busy-waiting on the interval timer. */
 
 #include <inc/x86.h>
 
@@ -20,3 +21,22 @@ mc146818_write(unsigned reg, unsigned datum)
 	outb(IO_RTC, reg);
 	outb(IO_RTC+1, datum);
 }
+
+// Busy-wait for 'ms' milliseconds (at most 50) on channel 2 of the PIT.
+// Channel 2 never raises an interrupt, so this is safe to use for
+// calibrating other clocks before interrupts are set up.
+void
+pit_delay(unsigned ms)
+{
+	unsigned count = TIMER_FREQ / 1000 * ms;
+
+	// Gate channel 2 on, speaker off
+	outb(IO_PPI, (inb(IO_PPI) & ~0x02) | 0x01);
+	// Channel 2, lo/hi byte access, mode 0 (interrupt on terminal count)
+	outb(TIMER_MODE, 0xb0);
+	outb(TIMER_CNTR2, count & 0xff);
+	outb(TIMER_CNTR2, (count >> 8) & 0xff);
+	// OUT2 goes high when the count reaches zero
+	while (!(inb(IO_PPI) & 0x20))
+		;
+}
@@ -26,7 +26,15 @@
 /* NVRAM byte 36: current century.  (please increment in Dec99!) */
 #define NVRAM_CENTURY	(MC_NVRAM_START + 36)	/* RTC offset 0x32 */
 
+/* 8253/8254 programmable interval timer */
+#define	IO_TIMER1	0x040		/* PIT channel ports */
+#define	TIMER_CNTR2	(IO_TIMER1 + 2)	/* channel 2 counter */
+#define	TIMER_MODE	(IO_TIMER1 + 3)	/* mode control */
+#define	IO_PPI		0x061		/* channel 2 gate and output */
+#define	TIMER_FREQ	1193182		/* PIT input clock, Hz */
+
 unsigned mc146818_read(unsigned reg);
 void mc146818_write(unsigned reg, unsigned datum);
+void pit_delay(unsigned ms);
 
 #endif	// !JOS_KERN_KCLOCK_H
@@ -9,6 +9,8 @@
 #include <inc/x86.h>
 #include <kern/pmap.h>
 #include <kern/cpu.h>
+#include <kern/kclock.h>
+#include <kern/time.h>
 
 // Local APIC registers, divided by 4 for use as uint32_t[] indices.
 #define ID      (0x0020/4)   // ID
@@ -44,6 +46,12 @@
 
 volatile uint32_t *lapic;  // Initialized in mp.c
 
+// Length of the PIT window used to calibrate the timer.
+#define LAPIC_CALIBRATE_MS	10
+
+// Timer initial count giving TIMER_HZ interrupts per second.
+static uint32_t lapic_timer_count;
+
 static void
 lapicw(int index, int value)
 {
@@ -51,6 +59,50 @@ lapicw(int index, int value)
 	lapic[ID];  // wait for write to finish, by reading
 }
 
+// Count how fast the timer runs over a PIT-timed window and return
+// the initial count for TIMER_HZ interrupts per second.
+static uint32_t
+lapic_timer_calibrate(void)
+{
+	uint32_t per_msec;
+
+	lapicw(TDCR, X1);
+	lapicw(TIMER, MASKED);
+	lapicw(TICR, 0xffffffff);
+	pit_delay(LAPIC_CALIBRATE_MS);
+	per_msec = (0xffffffff - lapic[TCCR]) / LAPIC_CALIBRATE_MS;
+	lapicw(TICR, 0);
+
+	if (per_msec == 0) {
+		cprintf("LAPIC timer: calibration failed\n");
+		per_msec = 1000000;
+	}
+	return per_msec * (1000 / TIMER_HZ);
+}
+
+// Start this CPU's periodic timer if it isn't already running.
+void
+lapic_timer_start(void)
+{
+	if (!lapic || thiscpu->cpu_timer_on)
+		return;
+	lapicw(TDCR, X1);
+	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+	lapicw(TICR, lapic_timer_count);
+	thiscpu->cpu_timer_on = 1;
+}
+
+// Stop this CPU's timer, e.g. while it is halted with nothing to run.
+void
+lapic_timer_stop(void)
+{
+	if (!lapic || !thiscpu->cpu_timer_on)
+		return;
+	lapicw(TIMER, MASKED);
+	lapicw(TICR, 0);
+	thiscpu->cpu_timer_on = 0;
+}
+
 void
 lapic_init(void)
 {
@@ -61,12 +113,11 @@ lapic_init(void)
 	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
 
 	// The timer repeatedly counts down at bus frequency
-	// from lapic[TICR] and then issues an interrupt.  
-	// If we cared more about precise timekeeping,
-	// TICR would be calibrated using an external time source.
-	lapicw(TDCR, X1);
-	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
-	lapicw(TICR, 10000000); 
+	// from lapic[TICR] and then issues an interrupt.
+	// The bus frequency is measured once, on the BSP, against the PIT.
+	if (!lapic_timer_count)
+		lapic_timer_count = lapic_timer_calibrate();
+	lapic_timer_start();
 
 	// Leave LINT0 of the BSP enabled so that it can get
 	// interrupts from the 8259A chip.
@@ -129,8 +180,6 @@ microdelay(int us)
 {
 }
 
-#define IO_RTC  0x70
-
 // Start additional processor running entry code at addr.
 // See Appendix B of MultiProcessor Specification.
 void
@@ -175,3 +224,13 @@ lapic_ipi(int vector)
 	while (lapic[ICRLO] & DELIVS)
 		;
 }
+
+// Send an IPI to the single CPU whose local APIC ID is apicid.
+void
+lapic_ipi_dest(int apicid, int vector)
+{
+	lapicw(ICRHI, apicid << 24);
+	lapicw(ICRLO, FIXED | vector);
+	while (lapic[ICRLO] & DELIVS)
+		;
+}
@@ -13,6 +13,7 @@
 #include <kern/kdebug.h>
 #include <kern/trap.h>
 #include <kern/pmap.h>
+#include <kern/prof.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -34,6 +35,7 @@ static struct Command commands[] = {
 	{ "examinep", "Examine contents of PA range", mon_examinep },
 	{ "step", "Step to next instruction in current env", mon_step },
 	{ "continue", "Continue executing current env", mon_continue },
+	{ "prof", "Sample PCs: prof [on [depth] | off | reset | recent [n]]", mon_prof },
 };
 #define NCOMMANDS (sizeof(commands)/sizeof(commands[0]))
 
@@ -313,6 +315,34 @@ mon_continue(int argc, char **argv, struct Trapframe *tf)
 	return -1; // need to break from monitor loop
 }
 
+int
+mon_prof(int argc, char **argv, struct Trapframe *tf)
+{
+	static struct Prof_entry entries[20];
+	int i, n;
+
+	if (argc == 1) {
+		n = prof_report(entries, sizeof(entries) / sizeof(entries[0]));
+		cprintf("  samples  env       function\n");
+		for (i = 0; i < n; i++)
+			cprintf("  %7u  %08x  %s\n", entries[i].pe_count,
+				entries[i].pe_envid, entries[i].pe_fn);
+	} else if (strcmp(argv[1], "on") == 0) {
+		n = argc > 2 ? strtol(argv[2], NULL, 0) : 0;
+		if (prof_ctl(PROF_START, n) < 0)
+			cprintf("depth must be at most %d\n", PROF_DEPTH);
+	} else if (strcmp(argv[1], "off") == 0) {
+		prof_ctl(PROF_STOP, 0);
+	} else if (strcmp(argv[1], "reset") == 0) {
+		prof_ctl(PROF_RESET, 0);
+	} else if (strcmp(argv[1], "recent") == 0) {
+		prof_print_recent(argc > 2 ? strtol(argv[2], NULL, 0) : 10);
+	} else
+		cprintf("Usage: prof [on [depth] | off | reset | recent [n]]\n");
+
+	return 0;
+}
+
 /***** Kernel monitor command interpreter *****/
 
 #define WHITESPACE "\t\r\n "
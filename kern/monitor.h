@@ -21,6 +21,7 @@ int mon_examine(int argc, char **argv, struct Trapframe *tf);
 int mon_examinep(int argc, char **argv, struct Trapframe *tf);
 int mon_step(int argc, char **argv, struct Trapframe *tf);
 int mon_continue(int argc, char **argv, struct Trapframe *tf);
+int mon_prof(int argc, char **argv, struct Trapframe *tf);
 
 // Helper functions
 void dump_mem(uintptr_t va, uint32_t length);
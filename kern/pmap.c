@@ -5,11 +5,16 @@
 #include <inc/error.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/trap.h>
 
 #include <kern/pmap.h>
 #include <kern/kclock.h>
 #include <kern/env.h>
 #include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/trace.h>
+#include <kern/time.h>
+#include <kern/syscall.h>
 
 // These variables are set by i386_detect_memory()
 size_t npages;			// Amount of physical memory (in pages)
@@ -19,6 +24,39 @@ static size_t npages_basemem;	// Amount of base memory (in pages)
 pde_t *kern_pgdir;		// Kernel's initial page directory
 struct Page *pages;		// Physical page state array
 static struct Page *page_free_list;	// Free list of physical pages
+static uint16_t *page_urefs;		// Scratch for page_compact
+
+// Once mem_init is done, free memory is kept by a buddy allocator: free
+// blocks of 2^order pages, aligned to their size, on one list per order
+// up to 4MB.  A freed block merges with its buddy whenever the buddy is
+// free too.  page_free_list is only used until then.
+#define BUDDY_NORDER		(PDXSHIFT - PGSHIFT + 1)
+static struct Page *buddy_free[BUDDY_NORDER];
+static struct Page *page_zero_list;	// Free pages known to be all zero
+static int page_nzero;			// Length of page_zero_list
+static struct spinlock page_free_lock;	// Protects the lists above
+
+// page_alloc and page_free go through a small per-CPU cache of free
+// pages (cpu_pages), refilled from and drained to the buddy allocator
+// PAGE_CACHE_BATCH pages at a time.
+#define PAGE_CACHE_BATCH	16
+#define PAGE_CACHE_HIGH		(4 * PAGE_CACHE_BATCH)
+static bool page_cache_on;
+
+// Invalidations of other CPUs' TLBs, held until tlb_shootdown sends
+// them all with one IPI per CPU.  Protected by the big kernel lock.
+#define TLB_BATCH		32
+static struct {
+	int n;				// Entries in pgdir[] and va[]
+	pde_t *pgdir[TLB_BATCH];
+	uintptr_t va[TLB_BATCH];
+	uint32_t cpus;			// CPUs to interrupt, by index
+} tlb_batch;
+
+// Idle CPUs zero free pages into page_zero_list (see page_zero_idle),
+// which ALLOC_ZERO allocations draw from first.
+#define PAGE_ZERO_BATCH		8
+#define PAGE_ZERO_MAX		256
 
 
 // --------------------------------------------------------------
@@ -66,6 +104,13 @@ static void check_kern_pgdir(void);
 static physaddr_t check_va2pa(pde_t *pgdir, uintptr_t va);
 static void check_page(void);
 static void check_page_installed_pgdir(void);
+static void check_buddy(void);
+static void buddy_init(void);
+static void page_cache_drain(struct Cpu *c, int n);
+static int page_cache_drain_all(struct Cpu *except);
+static struct Page *page_zero_pop(void);
+static struct Page *page_compact(int order);
+static int page_split(pde_t *pgdir, const void *va);
 
 // This simple physical memory allocator is used only while JOS is setting
 // up its virtual memory system.  page_alloc() is the real allocator.
@@ -169,6 +214,19 @@ mem_init(void)
 	envs = (struct Env *) boot_alloc(NENV * sizeof(struct Env));
 	memset(envs, 0, NENV * sizeof(struct Env));
 
+	// Per-CPU trace rings, read by user programs at UTRACE.
+	static_assert(NCPU <= TRACE_NRING);
+	trace_rings = (struct Trace_ring *)
+		boot_alloc(TRACE_NRING * sizeof(struct Trace_ring));
+	memset(trace_rings, 0, TRACE_NRING * sizeof(struct Trace_ring));
+
+	// The clock page, read by user programs at UCLOCK.
+	clock_page = (struct Clock_page *) boot_alloc(PGSIZE);
+	memset(clock_page, 0, PGSIZE);
+
+	// Per-page scratch counts for page_compact.
+	page_urefs = (uint16_t *) boot_alloc(npages * sizeof(uint16_t));
+
 	//////////////////////////////////////////////////////////////////////
 	// Now that we've allocated the initial kernel data structures, we set
 	// up the list of free physical pages. Once we've done so, all further
@@ -206,6 +264,19 @@ mem_init(void)
 			ROUNDUP(NENV * sizeof(struct Env), PGSIZE),
 			PADDR(envs), PTE_U);
 
+	//////////////////////////////////////////////////////////////////////
+	// Map the trace rings read-only by the user at UTRACE.
+	boot_map_region(kern_pgdir, UTRACE,
+			ROUNDUP(TRACE_NRING * sizeof(struct Trace_ring), PGSIZE),
+			PADDR(trace_rings), PTE_U);
+
+	//////////////////////////////////////////////////////////////////////
+	// Map the clock page read-only by the user at UCLOCK, above the
+	// trace rings in the same 4MB.
+	static_assert(TRACE_NRING * sizeof(struct Trace_ring) <=
+		      UCLOCK - UTRACE);
+	boot_map_region(kern_pgdir, UCLOCK, PGSIZE, PADDR(clock_page), PTE_U);
+
 	//////////////////////////////////////////////////////////////////////
 	// Use the physical memory that 'bootstack' refers to as the kernel
 	// stack.  The kernel stack grows down from virtual address KSTACKTOP.
@@ -253,8 +324,19 @@ mem_init(void)
 	cr0 &= ~(CR0_TS|CR0_EM);
 	lcr0(cr0);
 
+	// Allow 4MB pages in user address spaces (see page_insert_large).
+	lcr4(rcr4() | CR4_PSE);
+
 	// Some more checks, only possible after kern_pgdir is installed.
 	check_page_installed_pgdir();
+
+	// The checks above manipulate page_free_list directly, so only
+	// hand free pages to the buddy allocator and start caching them per
+	// CPU now.
+	spin_initlock(&page_free_lock);
+	buddy_init();
+	check_buddy();
+	page_cache_on = 1;
 }
 
 // Modify mappings in kern_pgdir to support SMP
@@ -378,6 +460,250 @@ page_init(void)
 	}
 }
 
+//
+// Put the block of 2^order pages starting at pp on its free list.
+//
+static void
+buddy_push(struct Page *pp, int order)
+{
+	pp->pp_order = order;
+	pp->pp_prevlink = &buddy_free[order];
+	if ((pp->pp_link = buddy_free[order]))
+		pp->pp_link->pp_prevlink = &pp->pp_link;
+	buddy_free[order] = pp;
+}
+
+//
+// Take the free block starting at pp off its free list.
+//
+static void
+buddy_unlink(struct Page *pp)
+{
+	if ((*pp->pp_prevlink = pp->pp_link))
+		pp->pp_link->pp_prevlink = pp->pp_prevlink;
+	pp->pp_link = NULL;
+	pp->pp_order = -1;
+}
+
+//
+// Free the block of 2^order pages starting at pp, merging it with its
+// buddy as long as the buddy is a free block of the same order.
+// The caller must hold page_free_lock.
+//
+static void
+buddy_free_block(struct Page *pp, int order)
+{
+	size_t i = pp - pages, b;
+
+	for (; order < BUDDY_NORDER - 1; order++) {
+		b = i ^ (1 << order);
+		if (b + (1 << order) > npages || pages[b].pp_order != order)
+			break;
+		buddy_unlink(&pages[b]);
+		i &= ~(1 << order);
+	}
+	buddy_push(&pages[i], order);
+}
+
+//
+// Allocate a free block of 2^order pages, splitting a larger one if
+// needed.  The caller must hold page_free_lock.
+//
+static struct Page *
+buddy_alloc_block(int order)
+{
+	struct Page *pp;
+	int o;
+
+	for (o = order; o < BUDDY_NORDER && !buddy_free[o]; o++)
+		;
+	if (o == BUDDY_NORDER)
+		return NULL;
+
+	pp = buddy_free[o];
+	buddy_unlink(pp);
+	while (o > order) {
+		o--;
+		buddy_push(pp + (1 << o), o);
+	}
+	return pp;
+}
+
+//
+// Move every page on page_free_list into the buddy allocator.
+//
+static void
+buddy_init(void)
+{
+	struct Page *pp;
+	size_t i;
+
+	for (i = 0; i < npages; i++)
+		pages[i].pp_order = -1;
+
+	spin_lock(&page_free_lock);
+	while ((pp = page_free_list)) {
+		page_free_list = pp->pp_link;
+		buddy_free_block(pp, 0);
+	}
+	spin_unlock(&page_free_lock);
+}
+
+//
+// Move up to PAGE_CACHE_BATCH pages from the buddy allocator to c's
+// cache.  If it is empty, take back the pages cached by other CPUs
+// rather than fail an allocation while free pages exist.  The caller
+// must own c; other CPUs' caches are only safe to touch under the big
+// kernel lock.
+//
+static void
+page_cache_refill(struct Cpu *c)
+{
+	struct Page *pp;
+	int i;
+
+	spin_lock(&page_free_lock);
+	for (i = 0; i < PAGE_CACHE_BATCH && (pp = buddy_alloc_block(0)); i++) {
+		pp->pp_link = c->cpu_pages;
+		c->cpu_pages = pp;
+		c->cpu_npages++;
+	}
+	spin_unlock(&page_free_lock);
+
+	if (c->cpu_pages)
+		return;
+
+	// Out of memory: take back other CPUs' pages, then finish tearing
+	// down freed envs
+	if (page_cache_drain_all(c) || env_reclaim(-1))
+		page_cache_refill(c);
+}
+
+//
+// Return n pages from c's cache to the buddy allocator.
+//
+static void
+page_cache_drain(struct Cpu *c, int n)
+{
+	struct Page *pp;
+
+	spin_lock(&page_free_lock);
+	while (n-- > 0 && (pp = c->cpu_pages)) {
+		c->cpu_pages = pp->pp_link;
+		c->cpu_npages--;
+		buddy_free_block(pp, 0);
+	}
+	spin_unlock(&page_free_lock);
+}
+
+//
+// Return the pages cached by every CPU other than 'except' to the buddy
+// allocator, so they can merge into larger blocks.  Only safe under the
+// big kernel lock.
+//
+// Returns the number of pages returned.
+//
+static int
+page_cache_drain_all(struct Cpu *except)
+{
+	int i, n = 0;
+
+	for (i = 0; i < ncpu; i++)
+		if (&cpus[i] != except) {
+			n += cpus[i].cpu_npages;
+			page_cache_drain(&cpus[i], cpus[i].cpu_npages);
+		}
+	return n;
+}
+
+//
+// Take a page off page_zero_list, or return NULL if it is empty.
+//
+static struct Page *
+page_zero_pop(void)
+{
+	struct Page *pp;
+
+	spin_lock(&page_free_lock);
+	if ((pp = page_zero_list)) {
+		page_zero_list = pp->pp_link;
+		page_nzero--;
+		pp->pp_link = NULL;
+	}
+	spin_unlock(&page_free_lock);
+	return pp;
+}
+
+//
+// Zero up to PAGE_ZERO_BATCH free pages into page_zero_list, keeping at
+// most PAGE_ZERO_MAX pages zeroed.  Called by the scheduler, with the
+// big kernel lock held, when this CPU has nothing else to run.  The
+// pages are off every free list while they are zeroed, so the big
+// kernel lock is released meanwhile to let other CPUs into the kernel.
+//
+// Returns the number of pages zeroed.
+//
+int
+page_zero_idle(void)
+{
+	struct Page *pp, *batch = NULL;
+	int i, n;
+
+	if (!page_cache_on)
+		return 0;
+	tlb_shootdown();
+
+	spin_lock(&page_free_lock);
+	for (n = 0; n < PAGE_ZERO_BATCH && page_nzero + n < PAGE_ZERO_MAX &&
+		    (pp = buddy_alloc_block(0)); n++) {
+		pp->pp_link = batch;
+		batch = pp;
+	}
+	spin_unlock(&page_free_lock);
+	if (!n)
+		return 0;
+
+	unlock_kernel();
+	for (pp = batch; pp; pp = pp->pp_link)
+		memset(page2kva(pp), 0, PGSIZE);
+	lock_kernel();
+	tlb_shootdown_sync();
+
+	spin_lock(&page_free_lock);
+	for (i = 0; i < n; i++) {
+		pp = batch;
+		batch = pp->pp_link;
+		pp->pp_link = page_zero_list;
+		page_zero_list = pp;
+	}
+	page_nzero += n;
+	spin_unlock(&page_free_lock);
+	return n;
+}
+
+//
+// Return every page on page_zero_list to the buddy allocator, so they
+// can merge into larger blocks.
+//
+// Returns the number of pages returned.
+//
+static int
+page_zero_drain(void)
+{
+	struct Page *pp;
+	int n;
+
+	spin_lock(&page_free_lock);
+	n = page_nzero;
+	while ((pp = page_zero_list)) {
+		page_zero_list = pp->pp_link;
+		buddy_free_block(pp, 0);
+	}
+	page_nzero = 0;
+	spin_unlock(&page_free_lock);
+	return n;
+}
+
 //
 // Allocates a physical page.  If (alloc_flags & ALLOC_ZERO), fills the entire
 // returned physical page with '\0' bytes.  Does NOT increment the reference
@@ -390,13 +716,28 @@ page_init(void)
 struct Page *
 page_alloc(int alloc_flags)
 {
-	// Check if out of memory
-	if (page_free_list == NULL) {
-		return NULL;
-	}
+	struct Cpu *c = thiscpu;
+	struct Page *pp;
 
-	struct Page* pp = page_free_list;
-	page_free_list = page_free_list->pp_link;
+	// Other CPUs may still reach a freed page through stale TLB entries
+	tlb_shootdown();
+
+	if ((alloc_flags & ALLOC_ZERO) && (pp = page_zero_pop()))
+		return pp;
+
+	if (!page_cache_on) {
+		if (!(pp = page_free_list))
+			return page_zero_pop();
+		page_free_list = pp->pp_link;
+	} else {
+		if (!c->cpu_pages)
+			page_cache_refill(c);
+		if (!(pp = c->cpu_pages))
+			return page_zero_pop();
+		c->cpu_pages = pp->pp_link;
+		c->cpu_npages--;
+	}
+	pp->pp_link = NULL;
 
 	// Fill page with 0s. Must use VA as VM enabled
 	if (alloc_flags & ALLOC_ZERO) {
@@ -413,12 +754,22 @@ page_alloc(int alloc_flags)
 void
 page_free(struct Page *pp)
 {
+	struct Cpu *c = thiscpu;
+
 	if (pp->pp_ref != 0) {
 		panic("page_free: %p has non-zero pp_ref\n", pp);
 	}
 
-	pp->pp_link = page_free_list;
-	page_free_list = pp;
+	if (!page_cache_on) {
+		pp->pp_link = page_free_list;
+		page_free_list = pp;
+		return;
+	}
+
+	pp->pp_link = c->cpu_pages;
+	c->cpu_pages = pp;
+	if (++c->cpu_npages > PAGE_CACHE_HIGH)
+		page_cache_drain(c, PAGE_CACHE_BATCH);
 }
 
 //
@@ -432,6 +783,254 @@ page_decref(struct Page* pp)
 		page_free(pp);
 }
 
+//
+// Allocates 2^order physically contiguous pages, aligned to their total
+// size, for large pages.  order may be at most PDXSHIFT - PGSHIFT (4MB).
+// If no such block is free, freed envs are torn down and the pages
+// cached by CPUs and the zeroed pages are returned to the buddy
+// allocator to let blocks merge, and if (alloc_flags & ALLOC_COMPACT),
+// user pages are moved out of the way (see page_compact).
+// If (alloc_flags & ALLOC_ZERO), the whole block is zeroed.  Like
+// page_alloc, leaves every pp_ref at zero.  The pages may be freed with
+// page_free_npages or one at a time with page_free.
+//
+// Returns the first page of the block, or NULL if there is none.
+//
+struct Page *
+page_alloc_npages(int order, int alloc_flags)
+{
+	struct Page *pp;
+	int i;
+
+	if (!page_cache_on || order < 0 || order >= BUDDY_NORDER)
+		return NULL;
+	tlb_shootdown();
+
+	spin_lock(&page_free_lock);
+	pp = buddy_alloc_block(order);
+	spin_unlock(&page_free_lock);
+
+	if (!pp && (env_reclaim(-1) | page_cache_drain_all(NULL) |
+		    page_zero_drain())) {
+		spin_lock(&page_free_lock);
+		pp = buddy_alloc_block(order);
+		spin_unlock(&page_free_lock);
+	}
+
+	if (!pp && (alloc_flags & ALLOC_COMPACT))
+		pp = page_compact(order);
+
+	if (!pp)
+		return NULL;
+
+	for (i = 0; i < (1 << order); i++)
+		pp[i].pp_link = NULL;
+	if (alloc_flags & ALLOC_ZERO)
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
+//
+// Free the 2^order pages from page_alloc_npages starting at pp.
+//
+void
+page_free_npages(struct Page *pp, int order)
+{
+	int i;
+
+	for (i = 0; i < (1 << order); i++)
+		if (pp[i].pp_ref != 0)
+			panic("page_free_npages: %p has non-zero pp_ref\n", &pp[i]);
+
+	spin_lock(&page_free_lock);
+	buddy_free_block(pp, order);
+	spin_unlock(&page_free_lock);
+}
+
+//
+// Is page i inside a free buddy block?
+//
+static bool
+page_is_free(size_t i)
+{
+	size_t head;
+	int o;
+
+	for (o = 0; o < BUDDY_NORDER; o++) {
+		head = i & ~((1 << o) - 1);
+		if (pages[head].pp_order == o)
+			return 1;
+	}
+	return 0;
+}
+
+//
+// Make a free block of 2^order pages by moving user pages out of one.
+// A page can be moved only if every reference to it is a 4KB PTE below
+// UTOP of an env that is not running on another CPU, since only those
+// PTEs can be found and rewritten and only the TLBs of this CPU and of
+// envs yet to run are known to be safe.  The page tables of all such
+// envs are scanned once to count those references into page_urefs.
+// The caller must hold the big kernel lock and have drained the
+// per-CPU caches and page_zero_list.
+//
+// Returns the block, off the free lists, or NULL if none can be made.
+//
+static struct Page *
+page_compact(int order)
+{
+	static struct Page *moved[1 << (BUDDY_NORDER - 1)];
+	size_t n = 1 << order, base, i;
+	struct Env *e;
+	pte_t *pt;
+	uint32_t pdeno, pteno;
+	struct Page *pp;
+
+	// Count the references we know how to move
+	memset(page_urefs, 0, npages * sizeof(uint16_t));
+	for (e = envs; e < envs + NENV; e++) {
+		if (!e->env_pgdir || (e->env_status == ENV_RUNNING &&
+				      e->env_cpunum != cpunum()))
+			continue;
+		for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+			if ((e->env_pgdir[pdeno] & (PTE_P | PTE_PS)) != PTE_P)
+				continue;
+			pt = KADDR(PTE_ADDR(e->env_pgdir[pdeno]));
+			for (pteno = 0; pteno < NPTENTRIES; pteno++)
+				if (pt[pteno] & PTE_P)
+					page_urefs[PGNUM(pt[pteno])]++;
+		}
+	}
+
+	// Find a block in which every page is free or movable, searching
+	// from the top of memory down
+	for (base = ROUNDDOWN(npages, n); base >= n; base -= n) {
+		for (i = base - n; i < base; i++)
+			if (!page_is_free(i) &&
+			    (!pages[i].pp_ref || pages[i].pp_ref != page_urefs[i]))
+				break;
+		if (i == base)
+			break;
+	}
+	if (base < n)
+		return NULL;
+	base -= n;
+
+	// Take the block's free pages off the free lists, so that the
+	// replacement pages come from elsewhere
+	spin_lock(&page_free_lock);
+	for (i = base; i < base + n; i++)
+		if (pages[i].pp_order >= 0)
+			buddy_unlink(&pages[i]);
+
+	for (i = 0; i < n; i++) {
+		moved[i] = NULL;
+		if (pages[base + i].pp_ref && !(moved[i] = buddy_alloc_block(0)))
+			break;
+	}
+	if (i < n) {
+		// Out of memory: put everything back
+		for (i = 0; i < n; i++) {
+			if (moved[i])
+				buddy_free_block(moved[i], 0);
+			if (!pages[base + i].pp_ref)
+				buddy_free_block(&pages[base + i], 0);
+		}
+		spin_unlock(&page_free_lock);
+		return NULL;
+	}
+	spin_unlock(&page_free_lock);
+
+	for (i = 0; i < n; i++)
+		if (moved[i])
+			memmove(page2kva(moved[i]), page2kva(&pages[base + i]),
+				PGSIZE);
+
+	// Point every counted PTE at the copy
+	for (e = envs; e < envs + NENV; e++) {
+		if (!e->env_pgdir || (e->env_status == ENV_RUNNING &&
+				      e->env_cpunum != cpunum()))
+			continue;
+		for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+			if ((e->env_pgdir[pdeno] & (PTE_P | PTE_PS)) != PTE_P)
+				continue;
+			pt = KADDR(PTE_ADDR(e->env_pgdir[pdeno]));
+			for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+				if (!(pt[pteno] & PTE_P) || PGNUM(pt[pteno]) < base ||
+				    PGNUM(pt[pteno]) >= base + n)
+					continue;
+				pp = moved[PGNUM(pt[pteno]) - base];
+				pt[pteno] = page2pa(pp) | (pt[pteno] & 0xFFF);
+				pp->pp_ref++;
+				tlb_invalidate(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+			}
+		}
+	}
+
+	for (i = 0; i < n; i++) {
+		pages[base + i].pp_ref = 0;
+		pages[base + i].pp_link = NULL;
+	}
+	return &pages[base];
+}
+
+//
+// Map the NPTENTRIES pages starting at 'pp' as one 4MB page at 'va',
+// which must be 4MB aligned and have nothing mapped in its 4MB.  The
+// mapping holds a reference on each of the pages, so they are freed
+// one by one as the mapping, or the pieces page_split leaves of it,
+// go away.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if 'va' or 'pp' is misaligned or something is mapped there
+//
+int
+page_insert_large(pde_t *pgdir, struct Page *pp, void *va, int perm)
+{
+	int i;
+
+	if ((uintptr_t) va % PTSIZE || page2pa(pp) % PTSIZE ||
+	    (pgdir[PDX(va)] & PTE_P))
+		return -E_INVAL;
+
+	for (i = 0; i < NPTENTRIES; i++)
+		pp[i].pp_ref++;
+	pgdir[PDX(va)] = page2pa(pp) | perm | PTE_P | PTE_PS;
+	tlb_invalidate(pgdir, va);
+	return 0;
+}
+
+//
+// Replace the large page mapped at 'va' with a page table mapping the
+// same pages with the same permissions.  Each page keeps the reference
+// the large mapping held on it.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if the page table couldn't be allocated
+//
+static int
+page_split(pde_t *pgdir, const void *va)
+{
+	pde_t pde = pgdir[PDX(va)];
+	struct Page *pt;
+	pte_t *ptes;
+	int i;
+
+	if (!(pt = page_alloc(0)))
+		return -E_NO_MEM;
+	pt->pp_ref++;
+
+	ptes = page2kva(pt);
+	for (i = 0; i < NPTENTRIES; i++)
+		ptes[i] = (PTE_ADDR(pde) + i * PGSIZE) |
+			  (pde & (PTE_SYSCALL | PTE_A | PTE_D));
+	pgdir[PDX(va)] = page2pa(pt) | PTE_P | PTE_W | PTE_U;
+	tlb_invalidate(pgdir, (void *) va);
+	return 0;
+}
+
 // Given 'pgdir', a pointer to a page directory, pgdir_walk returns
 // a pointer to the page table entry (PTE) for linear address 'va'.
 // This requires walking the two-level page table structure.
@@ -463,6 +1062,13 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 
 	pde_t pde = pgdir[PDX(va)];
 
+	// Callers deal only in 4KB PTEs, so turn a large page into a page
+	// table the first time something needs a PTE inside it.
+	if ((pde & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)) {
+		if (page_split(pgdir, va) < 0) return NULL;
+		pde = pgdir[PDX(va)];
+	}
+
 	// If page table page is present
 	if (pde & PTE_P) {
 		pte_t* pgt = KADDR(PTE_ADDR(pgdir[PDX(va)]));
@@ -550,21 +1156,17 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 int
 page_insert(pde_t *pgdir, struct Page *pp, void *va, int perm)
 {
-	pte_t* pte = pgdir_walk(pgdir, va, 0);
+	pte_t* pte = pgdir_walk(pgdir, va, 1); // Allocate page table if needed
 	physaddr_t ppa = page2pa(pp);
 
-	// If some page is already mapped there
-	if (pte != NULL) { 
-		if (*pte & PTE_P) page_remove(pgdir, va); // also invalidates tlb
-		if (page_free_list == pp) page_free_list = page_free_list->pp_link; 
-	}
-	else {
-		pte = pgdir_walk(pgdir, va, 1); // Allocate new page table
-		if (pte == NULL) return -E_NO_MEM; // failed to alloc page table
-	}
+	if (pte == NULL) return -E_NO_MEM; // failed to alloc page table
 
-	*pte = ppa | perm | PTE_P;
+	// Take the new reference first, so re-inserting the page already
+	// mapped at va doesn't free it in page_remove
 	pp->pp_ref++;
+	if (*pte & PTE_P) page_remove(pgdir, va); // also invalidates tlb
+
+	*pte = ppa | perm | PTE_P;
 	tlb_invalidate(pgdir, va);
 	return 0;
 }
@@ -627,16 +1229,133 @@ page_remove(pde_t *pgdir, void *va)
 	}
 }
 
+//
+// Resolve a write to the copy-on-write page mapped at 'va': give the
+// mapping a private copy of the page, or, if no other mapping refers to
+// the page, simply make it writable.  The new mapping keeps the other
+// PTE_SYSCALL bits of the old one.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if 'va' is not mapped user-accessible and PTE_COW
+//   -E_NO_MEM, if there's no memory for the copy
+//
+int
+page_cow(pde_t *pgdir, void *va)
+{
+	pte_t *pte;
+	struct Page *pp, *np;
+	int perm;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (!(pp = page_lookup(pgdir, va, &pte)) ||
+	    (*pte & (PTE_U | PTE_COW)) != (PTE_U | PTE_COW))
+		return -E_INVAL;
+
+	perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+	if (pp->pp_ref == 1) {
+		*pte = page2pa(pp) | perm;
+		tlb_invalidate(pgdir, va);
+		return 0;
+	}
+
+	if (!(np = page_alloc(0)))
+		return -E_NO_MEM;
+	memmove(page2kva(np), page2kva(pp), PGSIZE);
+	if (page_insert(pgdir, np, va, perm) < 0) {
+		page_free(np);
+		return -E_NO_MEM;
+	}
+	return 0;
+}
+
 //
 // Invalidate a TLB entry, but only if the page tables being
 // edited are the ones currently in use by the processor.
+// Other CPUs with pgdir loaded are told in the next tlb_shootdown.
 //
 void
 tlb_invalidate(pde_t *pgdir, void *va)
 {
+	struct Cpu *c;
+	uint32_t mask = 0;
+
 	// Flush the entry only if we're modifying the current address space.
 	if (!curenv || curenv->env_pgdir == pgdir)
 		invlpg(va);
+
+	for (c = cpus; c < cpus + ncpu; c++)
+		if (c != thiscpu && c->cpu_pgdir == pgdir)
+			mask |= 1 << (c - cpus);
+	if (!mask)
+		return;
+
+	if (tlb_batch.n == TLB_BATCH)
+		tlb_shootdown();
+	tlb_batch.pgdir[tlb_batch.n] = pgdir;
+	tlb_batch.va[tlb_batch.n++] = (uintptr_t) va;
+	tlb_batch.cpus |= mask;
+}
+
+//
+// Send the batched invalidations to the CPUs that need them, one IPI
+// each, and wait until each has flushed or has trapped into the kernel
+// (a CPU spinning on the kernel lock can't take the IPI, and flushes
+// its whole TLB in tlb_shootdown_sync once it has the lock).  Called
+// before the big kernel lock is released and before a freed page can
+// be reused.
+//
+void
+tlb_shootdown(void)
+{
+	struct Cpu *c;
+
+	if (!tlb_batch.cpus)
+		return;
+
+	for (c = cpus; c < cpus + ncpu; c++)
+		if (tlb_batch.cpus & (1 << (c - cpus))) {
+			c->cpu_tlb_pending = 1;
+			lapic_ipi_dest(c->cpu_id, IRQ_OFFSET + IRQ_TLB);
+		}
+	for (c = cpus; c < cpus + ncpu; c++)
+		if (tlb_batch.cpus & (1 << (c - cpus)))
+			while (c->cpu_tlb_pending && !c->cpu_in_kernel)
+				asm volatile("pause");
+
+	tlb_batch.n = 0;
+	tlb_batch.cpus = 0;
+}
+
+//
+// IRQ_TLB handler: apply the invalidations for our page directory.
+// Runs without the kernel lock, which the sender holds.
+//
+void
+tlb_shootdown_handler(void)
+{
+	struct Cpu *c = thiscpu;
+	int i;
+
+	if (!c->cpu_tlb_pending)
+		return;
+	for (i = 0; i < tlb_batch.n; i++)
+		if (tlb_batch.pgdir[i] == c->cpu_pgdir)
+			invlpg((void *) tlb_batch.va[i]);
+	c->cpu_tlb_pending = 0;
+}
+
+//
+// Called right after taking the kernel lock: if a shootdown was sent
+// while this CPU was on its way in, flush the whole TLB.
+//
+void
+tlb_shootdown_sync(void)
+{
+	if (thiscpu->cpu_tlb_pending) {
+		lcr3(rcr3());
+		thiscpu->cpu_tlb_pending = 0;
+	}
 }
 
 static uintptr_t user_mem_check_addr;
@@ -669,8 +1388,12 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
 
 	// Start allocating pages, by setting PTEs
 	for (; start < end; start += PGSIZE) {
-		pte_t *pte = pgdir_walk(env->env_pgdir, (void *) start, 0);
-		if (start >= ULIM || !pte || !(*pte && perm == perm)) { // invalid
+		pte_t *pte = &env->env_pgdir[PDX(start)];
+
+		// A large page's PDE holds its permissions; don't split it
+		if (!(*pte & PTE_PS))
+			pte = pgdir_walk(env->env_pgdir, (void *) start, 0);
+		if (start >= ULIM || !pte || (*pte & perm) != perm) { // invalid
 			user_mem_check_addr = start < (uint32_t) va ? (uint32_t) va : start;
 			return -E_FAULT;
 		}
@@ -685,11 +1408,34 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
 // If it can, then the function simply returns.
 // If it cannot, 'env' is destroyed and, if env is the current
 // environment, this function will not return.
+// Copy-on-write pages that 'env' lets the kernel copy (see
+// sys_env_set_cow) are copied here, as a write fault on them would be.
 //
 void
 user_mem_assert(struct Env *env, const void *va, size_t len, int perm)
 {
-	if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
+	pte_t *pte;
+	int r;
+
+	while ((r = user_mem_check(env, va, len, perm | PTE_U)) < 0 &&
+	       (perm & PTE_W) && env->env_cow_kernel &&
+	       page_cow(env->env_pgdir, (void *) user_mem_check_addr) == 0)
+		/* check the rest of the range */;
+
+	if (r < 0) {
+		// A demand-paged env may just not have touched the page
+		// yet: back up over its int or sysenter instruction and
+		// let it make the system call again once the page is in.
+		if (env == curenv && env->env_tf.tf_trapno == T_SYSCALL &&
+		    !(env->env_pgdir[PDX(user_mem_check_addr)] & PTE_PS) &&
+		    (!(pte = pgdir_walk(env->env_pgdir,
+					(void *) user_mem_check_addr, 0)) ||
+		     !(*pte & PTE_P))) {
+			env->env_tf.tf_eip -= 2;
+			if (ipc_page_fault(user_mem_check_addr) == 0)
+				env_run(env);
+			env->env_tf.tf_eip += 2;
+		}
 		cprintf("[%08x] user_mem_check assertion failure for "
 			"va %08x\n", env->env_id, user_mem_check_addr);
 		env_destroy(env);	// may not return
@@ -868,6 +1614,14 @@ check_kern_pgdir(void)
 	for (i = 0; i < n; i += PGSIZE)
 		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
 
+	// check trace rings
+	n = ROUNDUP(TRACE_NRING * sizeof(struct Trace_ring), PGSIZE);
+	for (i = 0; i < n; i += PGSIZE)
+		assert(check_va2pa(pgdir, UTRACE + i) == PADDR(trace_rings) + i);
+
+	// check clock page
+	assert(check_va2pa(pgdir, UCLOCK) == PADDR(clock_page));
+
 	// check phys mem
 	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
 		assert(check_va2pa(pgdir, KERNBASE + i) == i);
@@ -894,6 +1648,7 @@ check_kern_pgdir(void)
 		case PDX(KSTACKTOP-1):
 		case PDX(UPAGES):
 		case PDX(UENVS):
+		case PDX(UTRACE):	// and UCLOCK
 			assert(pgdir[i] & PTE_P);
 			break;
 		default:
@@ -1112,3 +1867,57 @@ check_page_installed_pgdir(void)
 
 	cprintf("check_page_installed_pgdir() succeeded!\n");
 }
+
+// Count the free blocks on each buddy list into nfree.
+static void
+buddy_count(int nfree[BUDDY_NORDER])
+{
+	struct Page *pp;
+	int o;
+
+	for (o = 0; o < BUDDY_NORDER; o++)
+		for (nfree[o] = 0, pp = buddy_free[o]; pp; pp = pp->pp_link) {
+			assert(pp->pp_order == o);
+			nfree[o]++;
+		}
+}
+
+// check the buddy allocator: blocks of several orders come out aligned
+// to their size and disjoint, and merge back when they are freed
+static void
+check_buddy(void)
+{
+	static const int orders[] = { 0, 0, 1, 3, 6, BUDDY_NORDER - 1 };
+	struct Page *pp[sizeof(orders) / sizeof(orders[0])];
+	int before[BUDDY_NORDER], after[BUDDY_NORDER];
+	int n = sizeof(orders) / sizeof(orders[0]);
+	int i, j;
+
+	buddy_count(before);
+
+	spin_lock(&page_free_lock);
+	for (i = 0; i < n; i++) {
+		// Memory may be too small or fragmented for a 4MB block
+		if (!(pp[i] = buddy_alloc_block(orders[i]))) {
+			assert(orders[i] == BUDDY_NORDER - 1);
+			continue;
+		}
+		assert(page2pa(pp[i]) % (PGSIZE << orders[i]) == 0);
+		assert(pp[i]->pp_order == -1 && pp[i]->pp_ref == 0);
+		for (j = 0; j < i; j++)
+			assert(!pp[j] ||
+			       pp[i] + (1 << orders[i]) <= pp[j] ||
+			       pp[j] + (1 << orders[j]) <= pp[i]);
+	}
+	spin_unlock(&page_free_lock);
+
+	// Freeing everything must merge the lists back to what they were
+	for (i = n - 1; i >= 0; i--)
+		if (pp[i])
+			page_free_npages(pp[i], orders[i]);
+	buddy_count(after);
+	for (i = 0; i < BUDDY_NORDER; i++)
+		assert(before[i] == after[i]);
+
+	cprintf("check_buddy() succeeded!\n");
+}
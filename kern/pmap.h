@@ -49,6 +49,8 @@ _kaddr(const char *file, int line, physaddr_t pa)
 enum {
 	// For page_alloc, zero the returned physical page.
 	ALLOC_ZERO = 1<<0,
+	// For page_alloc_npages, move user pages to make a contiguous block.
+	ALLOC_COMPACT = 1<<1,
 };
 
 void	mem_init(void);
@@ -57,12 +59,20 @@ void	boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int
 void	page_init(void);
 struct Page *page_alloc(int alloc_flags);
 void	page_free(struct Page *pp);
+int	page_zero_idle(void);
 int	page_insert(pde_t *pgdir, struct Page *pp, void *va, int perm);
 void	page_remove(pde_t *pgdir, void *va);
 struct Page *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
 void	page_decref(struct Page *pp);
+int	page_cow(pde_t *pgdir, void *va);
+struct Page *page_alloc_npages(int order, int alloc_flags);
+void	page_free_npages(struct Page *pp, int order);
+int	page_insert_large(pde_t *pgdir, struct Page *pp, void *va, int perm);
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
+void	tlb_shootdown(void);
+void	tlb_shootdown_handler(void);
+void	tlb_shootdown_sync(void);
 
 int	user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
@@ -0,0 +1,214 @@
+// Sampling profiler.
+//
+// While sampling is on, every local APIC timer tick records the
+// interrupted EIP and environment in a per-CPU ring, along with the
+// first few return addresses found by following the frame pointer.
+// Samples are only symbolized, through debuginfo_eip(), when a report
+// is asked for.
+
+#include <inc/string.h>
+#include <inc/error.h>
+#include <inc/x86.h>
+
+#include <kern/prof.h>
+#include <kern/cpu.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/kdebug.h>
+
+// Samples kept per CPU; older samples are overwritten
+#define PROF_NSAMPLE	512
+
+// Distinct (env, function) pairs a report can tell apart.  Samples
+// beyond these are dropped from the report.
+#define PROF_NFN	128
+
+struct Prof_sample {
+	uintptr_t ps_eip;
+	envid_t ps_envid;		// curenv's id, 0 if there was none
+	uintptr_t ps_callers[PROF_DEPTH];
+};
+
+static struct Prof_ring {
+	uint32_t pr_nsample;		// Samples ever taken on this CPU
+	struct Prof_sample pr_samples[PROF_NSAMPLE];
+} prof_rings[NCPU];
+
+static bool prof_on;
+static int prof_depth;
+
+// Record a sample of the code the timer interrupt in 'tf' interrupted.
+// Called with the kernel lock held.
+void
+prof_tick(struct Trapframe *tf)
+{
+	struct Prof_ring *r = &prof_rings[cpunum()];
+	struct Prof_sample *s;
+	bool user = (tf->tf_cs & 3) == 3;
+	uint32_t *ebp;
+	int i;
+
+	if (!prof_on)
+		return;
+
+	s = &r->pr_samples[r->pr_nsample++ % PROF_NSAMPLE];
+	s->ps_eip = tf->tf_eip;
+	s->ps_envid = curenv ? curenv->env_id : 0;
+	memset(s->ps_callers, 0, sizeof(s->ps_callers));
+
+	// Walk the frame pointer chain for as long as it stays readable.
+	// User frames are checked against the env's page tables, which
+	// are the ones loaded.
+	ebp = (uint32_t *) tf->tf_regs.reg_ebp;
+	for (i = 0; i < prof_depth && ebp; i++) {
+		if (user ? user_mem_check(curenv, ebp, 2 * sizeof(uint32_t),
+					  PTE_U) < 0
+			 : (uintptr_t) ebp < ULIM)
+			break;
+		s->ps_callers[i] = ebp[1];
+		ebp = (uint32_t *) ebp[0];
+	}
+}
+
+// Start, stop or reset sampling.  'arg' is the number of callers to
+// record per sample for PROF_START.
+//
+// Returns 0 on success, -E_INVAL if cmd or arg is invalid.
+int
+prof_ctl(int cmd, int arg)
+{
+	int i;
+
+	switch (cmd) {
+	case PROF_START:
+		if (arg < 0 || arg > PROF_DEPTH)
+			return -E_INVAL;
+		prof_depth = arg;
+		prof_on = 1;
+		return 0;
+	case PROF_STOP:
+		prof_on = 0;
+		return 0;
+	case PROF_RESET:
+		for (i = 0; i < NCPU; i++)
+			prof_rings[i].pr_nsample = 0;
+		return 0;
+	default:
+		return -E_INVAL;
+	}
+}
+
+// Look up 'eip' in the kernel's symbols or, for a user address, in
+// those of env 'envid', and copy the function name into 'buf'.
+// debuginfo_eip reads the user stabs through curenv and the loaded
+// page tables, so both are switched to the env for the lookup.
+//
+// Returns the address of the function, or 'eip' if it is unknown.
+static uintptr_t
+prof_symbolize(envid_t envid, uintptr_t eip, char *buf, int len)
+{
+	struct Eipdebuginfo info;
+	struct Env *e = NULL, *saved = curenv;
+	uint32_t cr3 = rcr3();
+
+	if (eip < ULIM) {
+		if (envid2env(envid, &e, 0) < 0 || !e->env_pgdir) {
+			snprintf(buf, len, "<exited>");
+			return eip;
+		}
+		curenv = e;
+		lcr3(PADDR(e->env_pgdir));
+	}
+
+	debuginfo_eip(eip, &info);
+	snprintf(buf, len, "%.*s", info.eip_fn_namelen, info.eip_fn_name);
+
+	if (e) {
+		curenv = saved;
+		lcr3(cr3);
+	}
+	return info.eip_fn_addr;
+}
+
+// Aggregate the samples of all CPUs by environment and function and
+// store up to 'max' entries at 'out', most frequent first.
+// Returns the number of entries stored.
+int
+prof_report(struct Prof_entry *out, int max)
+{
+	static struct Prof_entry fns[PROF_NFN];
+	struct Prof_entry tmp;
+	struct Prof_sample *s;
+	char name[PROF_FNLEN];
+	uintptr_t fn;
+	envid_t envid;
+	uint32_t i, n;
+	int c, j, nfn = 0;
+
+	for (c = 0; c < ncpu; c++) {
+		n = MIN(prof_rings[c].pr_nsample, PROF_NSAMPLE);
+		for (i = 0; i < n; i++) {
+			s = &prof_rings[c].pr_samples[i];
+			envid = s->ps_eip < ULIM ? s->ps_envid : 0;
+			fn = prof_symbolize(envid, s->ps_eip, name, sizeof(name));
+			for (j = 0; j < nfn; j++)
+				if (fns[j].pe_envid == envid &&
+				    fns[j].pe_fn_addr == fn)
+					break;
+			if (j == nfn) {
+				if (nfn == PROF_NFN)
+					continue;
+				fns[j].pe_envid = envid;
+				fns[j].pe_fn_addr = fn;
+				fns[j].pe_count = 0;
+				strcpy(fns[j].pe_fn, name);
+				nfn++;
+			}
+			fns[j].pe_count++;
+		}
+	}
+
+	// Insertion sort by count; nfn is small
+	for (i = 1; i < nfn; i++) {
+		tmp = fns[i];
+		for (j = i; j > 0 && fns[j - 1].pe_count < tmp.pe_count; j--)
+			fns[j] = fns[j - 1];
+		fns[j] = tmp;
+	}
+
+	n = MIN(nfn, max);
+	memmove(out, fns, n * sizeof(struct Prof_entry));
+	return n;
+}
+
+// Print the last 'n' samples of each CPU with their callers.
+void
+prof_print_recent(int n)
+{
+	struct Prof_ring *r;
+	struct Prof_sample *s;
+	char name[PROF_FNLEN];
+	envid_t envid;
+	uint32_t i;
+	int c, k;
+
+	for (c = 0; c < ncpu; c++) {
+		r = &prof_rings[c];
+		cprintf("CPU %d: %u samples\n", c, r->pr_nsample);
+		i = r->pr_nsample > (uint32_t) n ? r->pr_nsample - n : 0;
+		if (r->pr_nsample - i > PROF_NSAMPLE)
+			i = r->pr_nsample - PROF_NSAMPLE;
+		for (; i < r->pr_nsample; i++) {
+			s = &r->pr_samples[i % PROF_NSAMPLE];
+			envid = s->ps_eip < ULIM ? s->ps_envid : 0;
+			prof_symbolize(envid, s->ps_eip, name, sizeof(name));
+			cprintf("  [%08x] %08x %s", s->ps_envid, s->ps_eip, name);
+			for (k = 0; k < PROF_DEPTH && s->ps_callers[k]; k++) {
+				prof_symbolize(s->ps_envid, s->ps_callers[k],
+					       name, sizeof(name));
+				cprintf(" < %s", name);
+			}
+			cprintf("\n");
+		}
+	}
+}
@@ -0,0 +1,15 @@
+#ifndef JOS_KERN_PROF_H
+#define JOS_KERN_PROF_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/trap.h>
+#include <inc/prof.h>
+
+void prof_tick(struct Trapframe *tf);
+int prof_ctl(int cmd, int arg);
+int prof_report(struct Prof_entry *out, int max);
+void prof_print_recent(int n);
+
+#endif /* JOS_KERN_PROF_H */
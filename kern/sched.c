@@ -1,58 +1,140 @@
 #include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/x86.h>
 
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/sched.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/time.h>
 
+// Virtual runtime charged per timer tick's worth of running to an env
+// of weight w is SCHED_VRT_TICK / w, so an env of default weight ages
+// by SCHED_VRT_TICK / SCHED_WEIGHT_DEFAULT per tick.
+#define SCHED_VRT_TICK		(SCHED_WEIGHT_DEFAULT << 10)
 
-// Choose a user environment to run and run it.
+// How far below sched_min_vruntime an env that slept may fall.  Without
+// this an env that blocked for a long time would monopolize the CPU
+// once it woke up.
+#define SCHED_WAKEUP_CREDIT	(4 * (SCHED_VRT_TICK / SCHED_WEIGHT_DEFAULT))
+
+// Page tables of freed envs released per idle pass (see env_reclaim).
+#define SCHED_RECLAIM_BATCH	4
+
+// Monotonic lower bound on the vruntime of runnable FAIR envs.
+static uint64_t sched_min_vruntime;
+
+// Set the default scheduling parameters of a newly allocated env.
 void
-sched_yield(void)
+sched_env_init(struct Env *e)
 {
-	struct Env *idle;
-	int i;
-	
-	// Implement simple round-robin scheduling.
-	//
-	// Search through 'envs' for an ENV_RUNNABLE environment in
-	// circular fashion starting just after the env this CPU was
-	// last running.  Switch to the first such environment found.
-	//
-	// If no envs are runnable, but the environment previously
-	// running on this CPU is still ENV_RUNNING, it's okay to
-	// choose that environment.
-	//
-	// Never choose an environment that's currently running on
-	// another CPU (env_status == ENV_RUNNING) and never choose an
-	// idle environment (env_type == ENV_TYPE_IDLE).  If there are
-	// no runnable environments, simply drop through to the code
-	// below to switch to this CPU's idle environment.
-
-	// LAB 4: Your code here.
-	int start_id = 0;
-	struct Env *e;
+	e->env_sched_class = SCHED_CLASS_FAIR;
+	e->env_priority = 0;
+	e->env_weight = SCHED_WEIGHT_DEFAULT;
+	e->env_vruntime = sched_min_vruntime;
+}
 
-	if (curenv) {
-		start_id = ENVX(curenv->env_id) + 1;
+// Move env e to scheduling class 'sched_class'.  'param' is the RT
+// priority for SCHED_CLASS_RT and the share weight for SCHED_CLASS_FAIR.
+//
+// Returns 0 on success, -E_INVAL if the class or param is out of range.
+int
+sched_set_class(struct Env *e, int sched_class, int param)
+{
+	switch (sched_class) {
+	case SCHED_CLASS_RT:
+		if (param < 0 || param > SCHED_PRIO_MAX)
+			return -E_INVAL;
+		e->env_priority = param;
+		break;
+	case SCHED_CLASS_FAIR:
+		if (param < SCHED_WEIGHT_MIN || param > SCHED_WEIGHT_MAX)
+			return -E_INVAL;
+		e->env_weight = param;
+		// Don't let an env coming out of RT carry stale vruntime
+		if (e->env_sched_class != SCHED_CLASS_FAIR)
+			e->env_vruntime = sched_min_vruntime;
+		break;
+	default:
+		return -E_INVAL;
 	}
 
-	int o = start_id;
+	e->env_sched_class = sched_class;
+	return 0;
+}
+
+// Find the best ENV_RUNNABLE environment, not counting curenv.
+//
+// Envs are scanned in circular order starting just after the env this
+// CPU was last running, so ties (equal RT priority or equal vruntime)
+// are broken round-robin.  Any RT env beats every FAIR env.
+//
+// Never chooses an environment that's currently running on another CPU
+// (env_status == ENV_RUNNING) or an idle environment.
+static struct Env *
+sched_pick(void)
+{
+	struct Env *e, *rt = NULL, *fair = NULL;
+	int i, start_id = 0;
+
+	if (curenv)
+		start_id = ENVX(curenv->env_id) + 1;
 
 	for (i = 0; i < NENV; i++, start_id++) {
 		e = &envs[start_id % NENV];
-		
-		if (e->env_type == ENV_TYPE_IDLE) {
-			continue; // Ignore idle envs
-		}
 
-		if (e->env_status == ENV_RUNNABLE) {
-			env_run(e);
-		}
-		
-		if (e == curenv && e->env_status == ENV_RUNNING) {
-			// Back to one that we were running before
-			env_run(e);
+		if (e->env_type == ENV_TYPE_IDLE ||
+		    e->env_status != ENV_RUNNABLE)
+			continue;
+
+		if (e->env_sched_class == SCHED_CLASS_RT) {
+			if (!rt || e->env_priority > rt->env_priority)
+				rt = e;
+			continue;
 		}
+
+		// Clamp the credit of envs that have been asleep
+		if (e->env_vruntime + SCHED_WAKEUP_CREDIT < sched_min_vruntime)
+			e->env_vruntime = sched_min_vruntime - SCHED_WAKEUP_CREDIT;
+
+		if (!fair || e->env_vruntime < fair->env_vruntime)
+			fair = e;
+	}
+
+	if (rt)
+		return rt;
+
+	if (fair && fair->env_vruntime > sched_min_vruntime)
+		sched_min_vruntime = fair->env_vruntime;
+
+	return fair;
+}
+
+// Choose a user environment to run and run it.
+void
+sched_yield(void)
+{
+	struct Env *idle, *e;
+	int i;
+
+	// Switch to the best runnable environment other than curenv.
+	//
+	// If no envs are runnable, but the environment previously
+	// running on this CPU is still ENV_RUNNING, it's okay to
+	// choose that environment.  A voluntary yield therefore always
+	// lets another env run, even if it is in a lower class.
+	//
+	// If there are no runnable environments, simply drop through to
+	// the code below to switch to this CPU's idle environment.
+	if ((e = sched_pick()))
+		env_run(e);
+
+	if (curenv && curenv->env_type != ENV_TYPE_IDLE &&
+	    curenv->env_status == ENV_RUNNING) {
+		// Back to one that we were running before
+		env_run(curenv);
 	}
 
 	// For debugging and testing purposes, if there are no
@@ -72,8 +154,111 @@ sched_yield(void)
 	}
 
 	// Run this CPU's idle environment when nothing else is runnable.
+	// If the idle environment itself yielded, use the time to release
+	// freed envs' memory, to zero free pages and then to build page
+	// directories for new envs, a batch at a time, checking for
+	// runnable envs between batches.  Once there is
+	// nothing left to do, halt until another CPU or a device interrupts
+	// us.
 	idle = &envs[cpunum()];
 	if (!(idle->env_status == ENV_RUNNABLE || idle->env_status == ENV_RUNNING))
 		panic("CPU %d: No idle environment!", cpunum());
+	if (curenv == idle && !env_reclaim(SCHED_RECLAIM_BATCH) &&
+	    !page_zero_idle() && !env_pgdir_fill())
+		sched_halt();
 	env_run(idle);
 }
+
+// Halt this CPU with its timer stopped until an interrupt arrives.
+// sched_wakeup() sends one when an env becomes runnable; trap() retakes
+// the kernel lock and the idle env goes back through sched_yield().
+void
+sched_halt(void)
+{
+	// The BSP's ticks are the clock if the TSC is uncalibrated
+	if (thiscpu != bootcpu || time_tsc_calibrated())
+		lapic_timer_stop();
+
+	tlb_shootdown();
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+	unlock_kernel();
+
+	// Reset the stack pointer, enable interrupts and then halt.
+	asm volatile (
+		"movl $0, %%ebp\n"
+		"movl %0, %%esp\n"
+		"pushl $0\n"
+		"pushl $0\n"
+		"sti\n"
+		"1:\n"
+		"hlt\n"
+		"jmp 1b\n"
+	: : "a" (thiscpu->cpu_ts.ts_esp0));
+}
+
+// Wake one halted CPU, if any, to run a newly runnable env.
+// The caller must hold the kernel lock.
+void
+sched_wakeup(void)
+{
+	struct Cpu *c;
+
+	for (c = cpus; c < cpus + ncpu; c++)
+		if (c != thiscpu && c->cpu_status == CPU_HALTED) {
+			lapic_ipi_dest(c->cpu_id, IRQ_OFFSET + IRQ_WAKEUP);
+			return;
+		}
+}
+
+// Charge FAIR env e for running 'tsc' TSC cycles.  This happens every
+// time e leaves the CPU (see env_charge), so an env that blocks or
+// yields before the timer fires pays for its time all the same.
+// Without a calibrated TSC, sched_tick charges whole ticks instead.
+void
+sched_charge(struct Env *e, uint64_t tsc)
+{
+	uint64_t tsc_per_tick;
+
+	if (e->env_sched_class != SCHED_CLASS_FAIR || !time_tsc_calibrated())
+		return;
+	tsc_per_tick = (uint64_t) clock_page->cp_tsc_per_msec *
+		       (1000 / TIMER_HZ);
+	e->env_vruntime += tsc * (SCHED_VRT_TICK / e->env_weight) /
+			   tsc_per_tick;
+}
+
+// Called on every timer interrupt.  Charges curenv for its time so far
+// and preempts it if a better env is runnable.  Returns if curenv should
+// keep running.
+void
+sched_tick(void)
+{
+	struct Env *e;
+
+	if (curenv)
+		curenv->env_stats.es_ticks++;
+
+	if (!curenv || curenv->env_type == ENV_TYPE_IDLE ||
+	    curenv->env_status != ENV_RUNNING)
+		sched_yield();
+
+	env_charge();
+	if (curenv->env_sched_class == SCHED_CLASS_FAIR &&
+	    !time_tsc_calibrated())
+		curenv->env_vruntime += SCHED_VRT_TICK / curenv->env_weight;
+
+	if (!(e = sched_pick()))
+		return;
+
+	if (curenv->env_sched_class == SCHED_CLASS_RT) {
+		// Only an RT env of at least the same priority preempts
+		if (e->env_sched_class == SCHED_CLASS_RT &&
+		    e->env_priority >= curenv->env_priority)
+			env_run(e);
+		return;
+	}
+
+	if (e->env_sched_class == SCHED_CLASS_RT ||
+	    e->env_vruntime <= curenv->env_vruntime)
+		env_run(e);
+}
@@ -6,7 +6,20 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+struct Env;
+
 // This function does not return.
 void sched_yield(void) __attribute__((noreturn));
 
+// Halts this CPU until an interrupt; does not return.
+void sched_halt(void);
+void sched_wakeup(void);
+
+// Timer preemption: returns if curenv should keep running.
+void sched_tick(void);
+void sched_charge(struct Env *e, uint64_t tsc);
+
+void sched_env_init(struct Env *e);
+int sched_set_class(struct Env *e, int sched_class, int param);
+
 #endif	// !JOS_KERN_SCHED_H
@@ -12,6 +12,9 @@
 #include <kern/console.h>
 #include <kern/sched.h>
 #include <kern/time.h>
+#include <kern/prof.h>
+#include <kern/trace.h>
+#include <kern/textcache.h>
 #include <kern/e1000.h>
 #include <user/djos.h>
 
@@ -95,7 +98,108 @@ sys_exofork(void)
 	e->env_tf = curenv->env_tf;
 	e->env_tf.tf_regs.reg_eax = 0; // Return val in %eax
 
+	// The child's pages come from the same program image
+	e->env_pager = curenv->env_pager;
+	e->env_pager_cookie = curenv->env_pager_cookie;
+
+	return e->env_id;
+}
+
+// Fork the current environment with copy-on-write inside the kernel.
+// The child gets a copy of every page table entry from UTEXT up to the
+// user exception stack: PTE_SHARE mappings are copied as they are,
+// PTE_NOFORK mappings are left out, and writable or copy-on-write pages
+// become read-only PTE_COW in both parent and child.  The child gets a fresh exception stack and the
+// parent's page fault upcall, and is made runnable with sys_fork
+// appearing to return 0 in it.  The caller must already have a page
+// fault handler that resolves PTE_COW faults.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void)
+{
+	struct Env *e;
+	struct Page *pp;
+	pte_t *pt, *pte;
+	uint32_t pdeno, pteno;
+	uintptr_t va;
+	int perm, err;
+
+	if ((err = env_alloc(&e, curenv->env_id)) < 0)
+		return err;
+
+	e->env_tf = curenv->env_tf;
+	e->env_tf.tf_regs.reg_eax = 0; // Return val in %eax
+
+	for (pdeno = PDX(UTEXT); pdeno < PDX(UXSTACKTOP); pdeno++) {
+		if (!(curenv->env_pgdir[pdeno] & PTE_P))
+			continue;
+
+		// Share a shared 4MB page whole, split any other so its
+		// pages can be copied on write one by one
+		if (curenv->env_pgdir[pdeno] & PTE_PS) {
+			va = (uintptr_t) PGADDR(pdeno, 0, 0);
+			if (curenv->env_pgdir[pdeno] & PTE_SHARE) {
+				pp = pa2page(PTE_ADDR(curenv->env_pgdir[pdeno]));
+				if (page_insert_large(e->env_pgdir, pp, (void *) va,
+						      curenv->env_pgdir[pdeno] & PTE_SYSCALL) < 0)
+					goto nomem;
+				continue;
+			}
+			if (!pgdir_walk(curenv->env_pgdir, (void *) va, 0))
+				goto nomem;
+		}
+
+		pt = (pte_t *) KADDR(PTE_ADDR(curenv->env_pgdir[pdeno]));
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+			va = (uintptr_t) PGADDR(pdeno, pteno, 0);
+			pte = &pt[pteno];
+			if (va == UXSTACKTOP - PGSIZE)
+				break;
+			if (!(*pte & PTE_P))
+				continue;
+
+			perm = *pte & PTE_SYSCALL;
+			if (perm & PTE_NOFORK)
+				continue;
+			if (!(perm & PTE_SHARE) && (perm & (PTE_W | PTE_COW))) {
+				perm = (perm & ~PTE_W) | PTE_COW;
+				*pte = PTE_ADDR(*pte) | perm;
+			}
+
+			pp = pa2page(PTE_ADDR(*pte));
+			if (page_insert(e->env_pgdir, pp, (void *) va, perm) < 0)
+				goto nomem;
+		}
+	}
+
+	// The parent's writable pages just became read-only
+	lcr3(PADDR(curenv->env_pgdir));
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		goto nomem;
+	if (page_insert(e->env_pgdir, pp, (void *) (UXSTACKTOP - PGSIZE),
+			PTE_U | PTE_P | PTE_W) < 0) {
+		page_free(pp);
+		goto nomem;
+	}
+
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	e->env_cow_kernel = curenv->env_cow_kernel;
+	e->env_pager = curenv->env_pager;
+	e->env_pager_cookie = curenv->env_pager_cookie;
+	e->env_status = ENV_RUNNABLE;
+	sched_wakeup();
 	return e->env_id;
+
+nomem:
+	// Pages already made copy-on-write stay that way in the parent,
+	// which is harmless since its fault handler resolves them.
+	lcr3(PADDR(curenv->env_pgdir));
+	env_free(e);
+	return -E_NO_MEM;
 }
 
 // Set envid's env_status to status, which must be ENV_RUNNABLE
@@ -126,6 +230,8 @@ sys_env_set_status(envid_t envid, int status)
 	}
 
 	e->env_status = status;
+	if (status == ENV_RUNNABLE)
+		sched_wakeup();
 	return 0;
 }
 
@@ -183,6 +289,167 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 	return 0;
 }
 
+// Set whether the kernel resolves envid's write faults on PTE_COW pages
+// itself (see page_cow) instead of passing them to its page fault upcall.
+// The setting is inherited by children created with sys_fork.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_cow(envid_t envid, bool in_kernel)
+{
+	struct Env *e;
+
+	if (envid2env(envid, &e, 1) < 0)
+		return -E_BAD_ENV;
+
+	e->env_cow_kernel = in_kernel;
+	return 0;
+}
+
+// Make env 'pager' provide the pages of envid that are not present
+// when it touches them (see ipc_page_fault), or stop if pager is 0.
+// 'cookie' tells the pager which of its images envid is running and
+// must be nonzero and less than PGSIZE.  Pages of the image already in
+// the kernel's text cache are mapped into envid at once.  The setting is inherited by
+// children created with sys_exofork or sys_fork.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid or pager doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if pager is nonzero and cookie is out of range.
+static int
+sys_env_set_pager(envid_t envid, envid_t pager, uint32_t cookie)
+{
+	struct Env *e, *p;
+
+	if (envid2env(envid, &e, 1) < 0)
+		return -E_BAD_ENV;
+	if (pager && envid2env(pager, &p, 0) < 0)
+		return -E_BAD_ENV;
+	if (pager && (cookie == 0 || cookie >= PGSIZE))
+		return -E_INVAL;
+
+	e->env_pager = pager;
+	e->env_pager_cookie = pager ? cookie : 0;
+	e->env_pager_va = 0;
+
+	// Start it off with the text other envs have already paged in
+	if (pager)
+		textcache_map(e);
+	return 0;
+}
+
+// curenv, as a pager, no longer serves the image 'cookie' (see
+// sys_env_set_pager), typically because its program changed.  Forget
+// the image's pages in the text cache, so that the cookie can later be
+// reused for something else, and take the pager away from the envs
+// still running the image, whose next fault in it is then handled as
+// an ordinary page fault.
+//
+// Returns 0.
+static int
+sys_pager_retire(uint32_t cookie)
+{
+	struct Env *e;
+
+	textcache_retire(curenv->env_id, cookie);
+	for (e = envs; e < envs + NENV; e++)
+		if (e->env_status != ENV_FREE &&
+		    e->env_pager == curenv->env_id &&
+		    e->env_pager_cookie == cookie) {
+			e->env_pager = 0;
+			e->env_pager_cookie = 0;
+		}
+	return 0;
+}
+
+// Count the pages mapped in the user part of pgdir.
+static uint32_t
+pgdir_npages(pde_t *pgdir)
+{
+	uint32_t n = 0;
+	pte_t *pt;
+	int i, j;
+
+	for (i = 0; i < PDX(UTOP); i++) {
+		if (!(pgdir[i] & PTE_P))
+			continue;
+		if (pgdir[i] & PTE_PS) {
+			n += NPTENTRIES;
+			continue;
+		}
+		pt = KADDR(PTE_ADDR(pgdir[i]));
+		for (j = 0; j < NPTENTRIES; j++)
+			if (pt[j] & PTE_P)
+				n++;
+	}
+	return n;
+}
+
+// Copy envid's resource usage (struct Env_stats) to 'buf'.  Any env may
+// read any other env's statistics.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist.
+static int
+sys_env_stats(envid_t envid, struct Env_stats *buf)
+{
+	struct Env *e;
+
+	if (envid2env(envid, &e, 0) < 0)
+		return -E_BAD_ENV;
+	user_mem_assert(curenv, buf, sizeof(*buf), PTE_U | PTE_W);
+
+	*buf = e->env_stats;
+	buf->es_cpu_msec = time_tsc_msec(e->env_stats.es_cpu_tsc,
+					 e->env_stats.es_ticks);
+	buf->es_npages = pgdir_npages(e->env_pgdir);
+	return 0;
+}
+
+// Return the id of the env providing service 'type' (see env_service),
+// or 0 if there is none.
+//
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if type is not a valid EnvType.
+static envid_t
+sys_env_service(enum EnvType type)
+{
+	if (type < 0 || type >= NENVTYPE)
+		return -E_INVAL;
+	return env_service(type);
+}
+
+// Set envid's scheduling class and class parameter: the RT priority
+// for SCHED_CLASS_RT, the share weight for SCHED_CLASS_FAIR.
+// Only system environments (env_type != ENV_TYPE_USER) may put an
+// environment in the RT class or give it a weight above
+// SCHED_WEIGHT_DEFAULT; user environments may only lower their share.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if sched_class or param is invalid.
+static int
+sys_env_set_sched(envid_t envid, int sched_class, int param)
+{
+	struct Env *e;
+
+	if (envid2env(envid, &e, 1) < 0) {
+		return -E_BAD_ENV;
+	}
+
+	if (curenv->env_type == ENV_TYPE_USER &&
+	    (sched_class == SCHED_CLASS_RT ||
+	     (sched_class == SCHED_CLASS_FAIR && param > SCHED_WEIGHT_DEFAULT))) {
+		return -E_INVAL;
+	}
+
+	return sched_set_class(e, sched_class, param);
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -191,6 +458,11 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 //
 // perm -- PTE_U | PTE_P must be set, PTE_AVAIL | PTE_W may or may not be set,
 //         but no other bits may be set.  See PTE_SYSCALL in inc/mmu.h.
+//         As a special case, PTE_PS asks for a whole 4MB page at a
+//         4MB-aligned va with nothing mapped in its 4MB.  User pages
+//         are moved to make a free 4MB block if need be (see
+//         page_compact).  If that isn't possible, an ordinary page is
+//         allocated instead.
 //
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
@@ -228,11 +500,21 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 		return -E_INVAL;
 	}
 
-	// Only U, P, W and AVAIL can be set
-	if ((perm & ~(PTE_U | PTE_P | PTE_W | PTE_AVAIL)) != 0) {
+	// Only U, P, W and AVAIL can be set, and PS to ask for a large page
+	if ((perm & ~(PTE_U | PTE_P | PTE_W | PTE_AVAIL | PTE_PS)) != 0) {
 		return -E_INVAL;
 	}
 
+	if (perm & PTE_PS) {
+		perm &= ~PTE_PS;
+		if ((uintptr_t)va % PTSIZE == 0 && 
+		    !(e->env_pgdir[PDX(va)] & PTE_P) &&
+		    (pp = page_alloc_npages(PDXSHIFT - PGSHIFT,
+					    ALLOC_ZERO | ALLOC_COMPACT)) != NULL) {
+			return page_insert_large(e->env_pgdir, pp, va, perm);
+		}
+	}
+
 	if ((pp = page_alloc(ALLOC_ZERO)) == NULL) {
 		return -E_NO_MEM;
 	}
@@ -260,6 +542,9 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 //	-E_INVAL if perm is inappropriate (see sys_page_alloc).
 //	-E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
 //		address space.
+//	-E_INVAL if (perm & PTE_PS), but srcva is not the start of a 4MB
+//		page, or dstva is not 4MB aligned or has something mapped
+//		in its 4MB.  Without PTE_PS, one page of a 4MB page is mapped.
 //	-E_NO_MEM if there's no memory to allocate any necessary page tables.
 static int
 sys_page_map(envid_t srcenvid, void *srcva,
@@ -290,6 +575,20 @@ sys_page_map(envid_t srcenvid, void *srcva,
 		return -E_INVAL;
 	}
 
+	// Map a 4MB page whole; page_lookup below would split it
+	if (perm & PTE_PS) {
+		pte = &srcenv->env_pgdir[PDX(srcva)];
+		perm &= ~PTE_PS;
+		if (!(*pte & PTE_PS) || (uintptr_t)srcva % PTSIZE ||
+		    (perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) ||
+		    (perm & ~(PTE_U | PTE_P | PTE_W | PTE_AVAIL)) != 0 ||
+		    ((perm & PTE_W) && (*pte & PTE_W) == 0)) {
+			return -E_INVAL;
+		}
+		return page_insert_large(dstenv->env_pgdir,
+					 pa2page(PTE_ADDR(*pte)), dstva, perm);
+	}
+
 	if ((pp = page_lookup(srcenv->env_pgdir, srcva, &pte)) == NULL) {
 		return -E_INVAL;
 	}
@@ -346,6 +645,225 @@ sys_page_unmap(envid_t envid, void *va)
 	return 0;
 }
 
+// Deliver an IPC from snd to rcv, which must be blocked in a local
+// receive, and mark rcv runnable.  Shared by sys_ipc_try_send, the
+// blocking send queues and the direct-switch calls below; returns the
+// same errors as the local half of sys_ipc_try_send.
+static int
+ipc_deliver(struct Env *snd, struct Env *rcv, uint32_t value, void *srcva,
+	    unsigned perm)
+{
+	pte_t *pte;
+	struct Page *pp = NULL;
+
+	// Is receiver waiting, and waiting for us?
+	if (!rcv->env_ipc_recving ||
+	    (rcv->env_ipc_waitfor && rcv->env_ipc_waitfor != snd->env_id)) {
+		return -E_IPC_NOT_RECV;
+	}
+	
+	// Try mapping page from sender to receiver (if receiver 
+	// wants it, and sender wants to send it)
+	// NOTE: Can't use sys_map_page as it checks for env perms
+	if ((uint32_t) rcv->env_ipc_dstva < UTOP && 
+	    (uint32_t) srcva < UTOP) {
+		if (!(pp = page_lookup(snd->env_pgdir, 
+				       srcva, &pte)))
+			return -E_INVAL;
+		
+		if ((perm & PTE_W) && !(*pte & PTE_W))
+			return -E_INVAL;
+		
+		if (page_insert(rcv->env_pgdir, pp, 
+				rcv->env_ipc_dstva, perm) < 0)
+			return -E_NO_MEM;
+	}
+
+	// A pager's reply only maps the page; the receiver goes back to
+	// the instruction that faulted with its own IPC state untouched
+	if (rcv->env_pager_waiting) {
+		if (pp) {
+			rcv->env_pager_va = 0;
+			// No cookie if the image was retired meanwhile
+			if (!(perm & PTE_W) && rcv->env_pager_cookie)
+				textcache_insert(snd->env_id,
+						 rcv->env_pager_cookie,
+						 (uintptr_t) rcv->env_ipc_dstva,
+						 pp);
+		}
+		rcv->env_pager_waiting = 0;
+		rcv->env_ipc_recving = 0;
+		rcv->env_ipc_waitfor = 0;
+		rcv->env_ipc_dstva = (void *) UTOP;
+		rcv->env_status = ENV_RUNNABLE;
+		return 0;
+	}
+	
+	// Set fields which mark receiver as not waiting
+	rcv->env_ipc_recving = 0;
+	rcv->env_ipc_waitfor = 0;
+	rcv->env_ipc_dstva = (void *) UTOP; // invalid dstva
+	
+	// Set received data fields of receiver
+	rcv->env_ipc_value = value;
+	rcv->env_ipc_from = snd->env_id;	
+	rcv->env_ipc_perm = perm;
+	
+	snd->env_stats.es_ipc_sends++;
+	rcv->env_stats.es_ipc_recvs++;
+	trace(TRACE_IPC_SEND, snd->env_id, rcv->env_id, value);
+
+	// Mark receiver as RUNNABLE
+	rcv->env_status = ENV_RUNNABLE;
+	return 0;
+}
+
+// Block curenv at the tail of rcv's send queue.  The IPC is delivered
+// when rcv next receives.  If 'from' is nonzero this is an ipc_call, and
+// once the IPC is delivered curenv goes on to receive at 'dstva' from
+// 'from' instead of becoming runnable.
+static void
+ipc_enqueue(struct Env *rcv, uint32_t value, void *srcva, unsigned perm,
+	    void *dstva, envid_t from)
+{
+	curenv->env_ipc_sending = 1;
+	curenv->env_ipc_send_to = rcv->env_id;
+	curenv->env_ipc_send_value = value;
+	curenv->env_ipc_send_srcva = srcva;
+	curenv->env_ipc_send_perm = perm;
+	curenv->env_ipc_send_next = NULL;
+	curenv->env_ipc_waitfor = from;
+	curenv->env_ipc_dstva = dstva;
+
+	if (rcv->env_ipc_sendq)
+		rcv->env_ipc_sendq_tail->env_ipc_send_next = curenv;
+	else
+		rcv->env_ipc_sendq = curenv;
+	rcv->env_ipc_sendq_tail = curenv;
+
+	curenv->env_status = ENV_NOT_RUNNABLE;
+}
+
+// Unlink snd, whose predecessor is prev (or NULL), from rcv's send queue.
+static void
+ipc_dequeue(struct Env *rcv, struct Env *prev, struct Env *snd)
+{
+	if (prev)
+		prev->env_ipc_send_next = snd->env_ipc_send_next;
+	else
+		rcv->env_ipc_sendq = snd->env_ipc_send_next;
+	if (rcv->env_ipc_sendq_tail == snd)
+		rcv->env_ipc_sendq_tail = prev;
+
+	snd->env_ipc_send_next = NULL;
+	snd->env_ipc_sending = 0;
+}
+
+static int ipc_recv_queued(struct Env *rcv);
+
+// Complete the blocked send of a dequeued sender with result r.
+static void
+ipc_send_done(struct Env *snd, int r)
+{
+	if (snd->env_pager_waiting) {
+		// A forwarded page fault: wait for the page without
+		// disturbing the faulting code's registers
+		if (r == 0) {
+			snd->env_ipc_recving = 1;
+			if (!ipc_recv_queued(snd))
+				return;
+		}
+		snd->env_pager_waiting = 0;
+	} else {
+		snd->env_tf.tf_regs.reg_eax = r;
+		if (r == 0 && snd->env_ipc_waitfor) {
+			// An ipc_call: start waiting for the reply
+			snd->env_ipc_recving = 1;
+			snd->env_ipc_value = 0;
+			snd->env_ipc_from = 0;
+			snd->env_ipc_perm = 0;
+			if (!ipc_recv_queued(snd))
+				return;
+		}
+	}
+
+	snd->env_ipc_waitfor = 0;
+	snd->env_status = ENV_RUNNABLE;
+	sched_wakeup();
+}
+
+// Deliver the oldest IPC queued on rcv that rcv will accept.
+// Returns 1 if rcv received something, 0 if it is still waiting.
+static int
+ipc_recv_queued(struct Env *rcv)
+{
+	struct Env *snd, *prev = NULL, *next;
+	int r;
+
+	for (snd = rcv->env_ipc_sendq; snd; snd = next) {
+		next = snd->env_ipc_send_next;
+		if (rcv->env_ipc_waitfor && rcv->env_ipc_waitfor != snd->env_id) {
+			prev = snd;
+			continue;
+		}
+
+		ipc_dequeue(rcv, prev, snd);
+		r = ipc_deliver(snd, rcv, snd->env_ipc_send_value,
+				snd->env_ipc_send_srcva,
+				snd->env_ipc_send_perm);
+		ipc_send_done(snd, r);
+		if (r == 0)
+			return 1;
+	}
+	return 0;
+}
+
+// Take env e off any IPC send queue and fail the sends blocked on it.
+// Called when e is freed.
+void
+ipc_cancel(struct Env *e)
+{
+	struct Env *rcv, *snd, *prev = NULL;
+
+	if (e->env_ipc_sending &&
+	    envid2env(e->env_ipc_send_to, &rcv, 0) == 0) {
+		for (snd = rcv->env_ipc_sendq; snd != e;
+		     prev = snd, snd = snd->env_ipc_send_next)
+			assert(snd);
+		ipc_dequeue(rcv, prev, e);
+	}
+
+	while ((snd = e->env_ipc_sendq)) {
+		ipc_dequeue(e, NULL, snd);
+		ipc_send_done(snd, -E_BAD_ENV);
+	}
+}
+
+// Mark curenv as blocked receiving at dstva.  If 'from' is nonzero,
+// only an IPC from env 'from' will be accepted.  If a sender is already
+// queued, the receive completes at once and curenv keeps running.
+static void
+ipc_block_recv(void *dstva, envid_t from)
+{
+	trace(TRACE_IPC_RECV, from, (uint32_t) dstva, 0);
+
+	// Set fields which mark as waiting
+	curenv->env_ipc_recving = 1;
+	curenv->env_ipc_waitfor = from;
+	curenv->env_ipc_dstva = dstva;
+
+	// Reset previous received data fields
+	curenv->env_ipc_value = 0;
+	curenv->env_ipc_from = 0;	
+	curenv->env_ipc_perm = 0;
+	
+	// Mark as NOT_RUNNABLE (waiting)
+	curenv->env_status = ENV_NOT_RUNNABLE;
+
+	if (ipc_recv_queued(curenv))
+		curenv->env_status = ENV_RUNNING;
+}
+
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
@@ -389,12 +907,9 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 {
 	// LAB 4: Your code here.
 	struct Env *rcv;
-	pte_t *pte;
-	struct Page *pp;
-
 	envid_t jdos_client = 0;
 	struct Env *e;
-	int i, r;
+	int r;
 
 	if (curenv->env_alien && 
 	     ((curenv->env_hosteid & 0xfff00000) == 
@@ -413,12 +928,7 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 
 	if (rcv->env_status == ENV_LEASED) { // is leased?
 	djos_send:
-		for (i = 0; i < NENV; i++) {
-			if (envs[i].env_type == ENV_TYPE_JDOSC) {
-				jdos_client = envs[i].env_id;
-				break;
-			}
-		}
+		jdos_client = env_service(ENV_TYPE_JDOSC);
 
 		// jdos client running?
 		if (!jdos_client) return -E_BAD_ENV; 
@@ -450,44 +960,53 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 		}
 	}
 	else {
-		// Is receiver waiting?
-		if (!rcv->env_ipc_recving) {
-			return -E_IPC_NOT_RECV;
-		}
-		
-		// Try mapping page from sender to receiver (if receiver 
-		// wants it, and sender wants to send it)
-		// NOTE: Can't use sys_map_page as it checks for env perms
-		if ((uint32_t) rcv->env_ipc_dstva < UTOP && 
-		    (uint32_t) srcva < UTOP) {
-			if (!(pp = page_lookup(curenv->env_pgdir, 
-					       srcva, &pte)))
-				return -E_INVAL;
-			
-			if ((perm & PTE_W) && !(*pte & PTE_W))
-				return -E_INVAL;
-			
-			if (page_insert(rcv->env_pgdir, pp, 
-					rcv->env_ipc_dstva, perm) < 0)
-				return -E_NO_MEM;
-		}
-		
-		// Set fields which mark receiver as not waiting
-		rcv->env_ipc_recving = 0;
-		rcv->env_ipc_dstva = (void *) UTOP; // invalid dstva
-		
-		// Set received data fields of receiver
-		rcv->env_ipc_value = value;
-		rcv->env_ipc_from = curenv->env_id;	
-		rcv->env_ipc_perm = perm;
-		
-		// Mark receiver as RUNNABLE
-		rcv->env_status = ENV_RUNNABLE;
+		if ((r = ipc_deliver(curenv, rcv, value, srcva, perm)) < 0)
+			return r;
+		sched_wakeup();
 	}
 	
 	return 0;
 }
 
+// Like sys_ipc_try_send, but if envid is not blocked in sys_ipc_recv,
+// block the caller on envid's send queue until it is.  Queued senders
+// are served in FIFO order.
+//
+// Returns 0 once the IPC has been delivered, < 0 on error.  Errors are
+// those of sys_ipc_try_send, except that -E_IPC_NOT_RECV is only
+// returned for an env that is suspended for migration, and:
+//	-E_BAD_ENV if envid exits while the caller is queued.
+static int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+{
+	struct Env *rcv;
+	int r;
+
+	// DJOS sends are never queued here
+	if (curenv->env_alien &&
+	    (curenv->env_hosteid & 0xfff00000) == (envid & 0xfff00000))
+		return sys_ipc_try_send(envid, value, srcva, perm);
+
+	if (envid2env(envid, &rcv, 0) < 0)
+		return -E_BAD_ENV;
+
+	if (rcv->env_status == ENV_LEASED || rcv->env_status == ENV_SUSPENDED)
+		return sys_ipc_try_send(envid, value, srcva, perm);
+
+	if ((uintptr_t) srcva < UTOP &&
+	    !page_lookup(curenv->env_pgdir, srcva, NULL))
+		return -E_INVAL;
+
+	r = ipc_deliver(curenv, rcv, value, srcva, perm);
+	if (r == -E_IPC_NOT_RECV) {
+		ipc_enqueue(rcv, value, srcva, perm, (void *) UTOP, 0);
+		return 0;
+	}
+	if (r == 0)
+		sched_wakeup();
+	return r;
+}
+
 // Block until a value is ready.  Record that you want to receive
 // using the env_ipc_recving and env_ipc_dstva fields of struct Env,
 // mark yourself not runnable, and then give up the CPU.
@@ -507,19 +1026,150 @@ sys_ipc_recv(void *dstva)
 		return -E_INVAL;
 	}
 
-	// Set fields which mark as waiting
-	curenv->env_ipc_recving = 1;
-	curenv->env_ipc_dstva = dstva;
+	ipc_block_recv(dstva, 0);
+	return 0;
+}
 
-	// Reset previous received data fields
-	curenv->env_ipc_value = 0;
-	curenv->env_ipc_from = 0;	
-	curenv->env_ipc_perm = 0;
-	
-	// Mark as NOT_RUNNABLE (waiting)
-	curenv->env_status = ENV_NOT_RUNNABLE;
+// Send to a local env blocked in receive and block receiving in the
+// same step, then switch straight to the receiver, donating the rest
+// of curenv's timeslice.  'from' restricts the receive as for
+// ipc_block_recv.  A call (nonzero 'from') to an env that isn't
+// receiving is queued as by sys_ipc_send.  Does not return if it
+// switches.
+static int
+ipc_send_switch(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+		void *dstva, envid_t from)
+{
+	struct Env *rcv;
+	int r;
 
-	return 0;
+	if ((uintptr_t) dstva < UTOP && ((uintptr_t) dstva % PGSIZE))
+		return -E_INVAL;
+
+	// DJOS sends go through the jdos client; no direct switch
+	if (curenv->env_alien &&
+	    (curenv->env_hosteid & 0xfff00000) == (envid & 0xfff00000))
+		return -E_NOT_SUPP;
+
+	if (envid2env(envid, &rcv, 0) < 0)
+		return -E_BAD_ENV;
+
+	if (rcv->env_status == ENV_LEASED)
+		return -E_NOT_SUPP;
+
+	if (rcv->env_status == ENV_SUSPENDED)
+		return -E_IPC_NOT_RECV;
+
+	r = ipc_deliver(curenv, rcv, value, srcva, perm);
+	if (r == -E_IPC_NOT_RECV && from) {
+		if ((uintptr_t) srcva < UTOP &&
+		    !page_lookup(curenv->env_pgdir, srcva, NULL))
+			return -E_INVAL;
+		ipc_enqueue(rcv, value, srcva, perm, dstva, from);
+		return 0;
+	}
+	if (r < 0)
+		return r;
+
+	ipc_block_recv(dstva, from);
+	curenv->env_tf.tf_regs.reg_eax = 0;
+
+	// A request was already queued for us; keep serving
+	if (curenv->env_status == ENV_RUNNING) {
+		sched_wakeup();
+		return 0;
+	}
+	env_run(rcv);
+}
+
+// Send an IPC request to envid and wait for its reply, like
+// sys_ipc_try_send followed by sys_ipc_recv, except that only a reply
+// from envid wakes the caller and the CPU switches directly to envid.
+//
+// Returns 0 once the reply has arrived, < 0 on error.  Errors are
+// those of sys_ipc_send and sys_ipc_recv, and:
+//	-E_NOT_SUPP if envid is leased or remote (use ipc_send instead).
+static int
+sys_ipc_call(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+	     void *dstva)
+{
+	return ipc_send_switch(envid, value, srcva, perm, dstva, envid);
+}
+
+// Reply to envid and wait for the next request from anyone, switching
+// directly to envid.  This is the server half of sys_ipc_call.
+//
+// Returns 0 once the next request has arrived, < 0 on error.  On error
+// the reply was not sent and the caller is not receiving.  Errors are
+// those of sys_ipc_call.
+static int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+		   void *dstva)
+{
+	return ipc_send_switch(envid, value, srcva, perm, dstva, 0);
+}
+
+// Ask curenv's pager (see sys_env_set_pager) for the page at 'va',
+// which curenv just faulted on because it is not present.  The pager
+// gets an IPC from curenv whose value is the page address ORed with
+// curenv's pager cookie, and replies with the page to map there, or
+// with no page if it has none.  Meanwhile curenv is blocked receiving
+// from the pager, but with its registers and IPC state left alone, so
+// that once mapped it simply retries the faulting instruction.
+//
+// Read-only pages the pager has provided before for the same image
+// are mapped from the kernel's cache (see kern/textcache.c) instead.
+//
+// Does not return if the fault was forwarded.  Returns 0 if the page
+// came from the cache, and -E_FAULT if curenv has no pager, 'va' is
+// outside the program image, or the pager already failed to provide
+// this page, so the fault should be handled as usual.
+int
+ipc_page_fault(uintptr_t va)
+{
+	struct Env *pager;
+	struct Page *pp;
+	uint32_t value;
+	int r;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (!curenv->env_pager || va < UTEXT || va >= UTOP ||
+	    curenv->env_pager_va == va ||
+	    envid2env(curenv->env_pager, &pager, 0) < 0 ||
+	    pager->env_status == ENV_LEASED ||
+	    pager->env_status == ENV_SUSPENDED) {
+		curenv->env_pager_va = 0;
+		return -E_FAULT;
+	}
+
+	pp = textcache_lookup(pager->env_id, curenv->env_pager_cookie, va);
+	if (pp && page_insert(curenv->env_pgdir, pp, (void *) va,
+			      PTE_P | PTE_U) == 0) {
+		curenv->env_pager_va = 0;
+		return 0;
+	}
+
+	// Cleared by a reply that maps the page
+	curenv->env_pager_va = va;
+	curenv->env_pager_waiting = 1;
+	value = va | curenv->env_pager_cookie;
+
+	r = ipc_deliver(curenv, pager, value, (void *) UTOP, 0);
+	if (r == -E_IPC_NOT_RECV) {
+		ipc_enqueue(pager, value, (void *) UTOP, 0, (void *) va,
+			    pager->env_id);
+		sched_yield();
+	}
+	if (r < 0) {
+		curenv->env_pager_waiting = 0;
+		return -E_FAULT;
+	}
+
+	curenv->env_ipc_recving = 1;
+	curenv->env_ipc_waitfor = pager->env_id;
+	curenv->env_ipc_dstva = (void *) va;
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	env_run(pager);
 }
 
 static int
@@ -538,6 +1188,9 @@ sys_env_swap(envid_t envid)
 	struct Env temp = *curenv;
 	curenv->env_tf = e->env_tf;	
 	curenv->env_pgdir = e->env_pgdir;
+	curenv->env_pager = e->env_pager;
+	curenv->env_pager_cookie = e->env_pager_cookie;
+	curenv->env_pager_va = 0;
 	lcr3(PADDR(curenv->env_pgdir));
 	
 	// Need to do this to free old pgdir
@@ -556,6 +1209,42 @@ sys_time_msec(void)
 	return time_msec();
 }
 
+// Record the kernel trace events whose types are set in 'mask'
+// (bit 1 << TRACE_*), and none if it is 0.  Events can be read at UTRACE.
+//
+// Returns the previous mask, < 0 on error.  Errors are:
+//	-E_INVAL if mask has bits for unknown event types.
+static int
+sys_trace(uint32_t mask)
+{
+	uint32_t old = trace_mask;
+
+	if (mask & ~TRACE_ALL)
+		return -E_INVAL;
+	trace_mask = mask;
+	return old;
+}
+
+// Control the sampling profiler (see kern/prof.c).  PROF_START starts
+// sampling with 'arg' callers recorded per sample, PROF_STOP stops it
+// and PROF_RESET discards the samples taken so far.  PROF_REPORT
+// stores up to 'arg' struct Prof_entry's at 'buf', most frequent first.
+//
+// Returns the number of entries stored for PROF_REPORT, 0 for the
+// other commands, < 0 on error.  Errors are:
+//	-E_INVAL if cmd or arg is invalid.
+static int
+sys_prof(int cmd, int arg, struct Prof_entry *buf)
+{
+	if (cmd != PROF_REPORT)
+		return prof_ctl(cmd, arg);
+	if (arg < 0 || arg > ULIM / sizeof(struct Prof_entry))
+		return -E_INVAL;
+	user_mem_assert(curenv, buf, arg * sizeof(struct Prof_entry),
+			PTE_U | PTE_W);
+	return prof_report(buf, arg);
+}
+
 // Try to send packet over network
 static int
 sys_net_try_send(char *data, int len)
@@ -583,6 +1272,48 @@ sys_net_try_receive(char *data, int *len)
 	return *len;
 }
 
+// Receive a packet without copying it, by mapping the page it was
+// received into at 'va' in curenv (read-write), replacing whatever
+// was mapped there.  The page holds a struct jif_pkt (see inc/ns.h),
+// ready to pass on to the network server.
+//
+// Returns the packet's length, < 0 on error.  Errors are:
+//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_RCV_EMPTY if no packet has been received.
+//	-E_NO_MEM if there's no memory to map the page or refill the
+//		card's ring; the packet is not lost.
+static int
+sys_net_recv_page(void *va)
+{
+	struct Page *pp;
+	int len;
+
+	if ((uintptr_t) va >= UTOP || PGOFF(va))
+		return -E_INVAL;
+
+	// Make sure page_insert below can't fail
+	if (!pgdir_walk(curenv->env_pgdir, va, 1))
+		return -E_NO_MEM;
+
+	if ((len = e1000_receive_page(&pp)) < 0)
+		return len;
+	page_insert(curenv->env_pgdir, pp, va, PTE_P | PTE_U | PTE_W);
+	page_decref(pp);
+	return len;
+}
+
+// Block until the network card interrupts for received packets, so
+// that an empty sys_net_try_receive need not be retried at once.
+// Returns at once if a packet is already waiting.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_SUPP if the card has no interrupt; poll instead.
+static int
+sys_net_wait(void)
+{
+	return e1000_rx_wait();
+}
+
 static int
 sys_get_mac(uint32_t *low, uint32_t *high)
 {
@@ -610,7 +1341,7 @@ sys_env_lease(struct Env *src, envid_t *dst_id)
 	e->env_parent_id = src->env_parent_id;
 
 	e->env_status = src->env_status;
-	e->env_type = src->env_type;
+	env_set_type(e, src->env_type);
 	e->env_runs = src->env_runs;
 
 	e->env_pgfault_upcall = src->env_pgfault_upcall;
@@ -635,6 +1366,7 @@ int // Only copies 1024 bytes! server and client call
 sys_copy_mem(envid_t env_id, void* addr, void* buf, int perm, bool frombuf)
 {
 	void *pgva = (void *) ROUNDDOWN(addr, PGSIZE);
+	struct Env *e;
 
 	if (sys_page_map(env_id, pgva, curenv->env_id, (void *) UTEMP, 
 			 perm) < 0) 
@@ -650,6 +1382,10 @@ sys_copy_mem(envid_t env_id, void* addr, void* buf, int perm, bool frombuf)
 	if (sys_page_unmap(curenv->env_id, (void *) UTEMP) < 0)
 		return -E_INVAL;
 
+	// sys_page_map already found env_id
+	envid2env(env_id, &e, 0);
+	e->env_stats.es_migrated += 1024;
+
 	return 0;
 }
 
@@ -687,6 +1423,8 @@ sys_env_unsuspend(envid_t envid, uint32_t status, uint32_t value)
 
 	e->env_tf.tf_regs.reg_eax = value;
 	e->env_status = status;
+	if (status == ENV_RUNNABLE)
+		sched_wakeup();
 
 	return 0;
 }
@@ -696,14 +1434,9 @@ sys_migrate(void *thisenv)
 {
 	envid_t jdos_client = 0;
 	struct Env *e;
-	int i, r;
+	int r;
 
-	for (i = 0; i < NENV; i++) {
-		if (envs[i].env_type == ENV_TYPE_JDOSC) {
-			jdos_client = envs[i].env_id;
-			break;
-		}
-	}
+	jdos_client = env_service(ENV_TYPE_JDOSC);
 
 	// jdos client running?
 	if (!jdos_client) return -E_BAD_ENV; 
@@ -738,14 +1471,9 @@ sys_lease_complete()
 {
 	envid_t jdos_client = 0;
 	struct Env *e;
-	int i, r;
+	int r;
 
-	for (i = 0; i < NENV; i++) {
-		if (envs[i].env_type == ENV_TYPE_JDOSC) {
-			jdos_client = envs[i].env_id;
-			break;
-		}
-	}
+	jdos_client = env_service(ENV_TYPE_JDOSC);
 
 	// jdos client running?
 	if (!jdos_client) return -E_BAD_ENV; 
@@ -791,9 +1519,60 @@ sys_env_set_thisenv(envid_t envid, void *thisenv)
 	return 0;
 }
 
+// Run the 'n' system calls described by descs[0..n-1] in order under a
+// single kernel entry, storing each result in its sd_ret.  Only calls
+// that never block or switch environments may be batched:
+// page_alloc, page_map, page_unmap, env_set_status,
+// env_set_pgfault_upcall and env_set_trapframe.  Stops at the first
+// call that fails, including one that may not be batched (-E_INVAL).
+//
+// Returns the number of calls that succeeded, < 0 on error.  Errors are:
+//	-E_INVAL if n < 0.
+//	-E_FAULT if a descriptor is not writable by the caller.  Each is
+//		checked as it is reached, since earlier calls may have
+//		remapped the array.
+static int
+sys_batch(struct Syscall_desc *descs, int n)
+{
+	struct Syscall_desc *d;
+	int32_t r;
+	int i;
+
+	if (n < 0)
+		return -E_INVAL;
+
+	for (i = 0; i < n; i++) {
+		d = &descs[i];
+		if (user_mem_check(curenv, d, sizeof(*d), PTE_U | PTE_W) < 0)
+			return -E_FAULT;
+
+		switch (d->sd_num) {
+		case SYS_page_alloc:
+		case SYS_page_map:
+		case SYS_page_unmap:
+		case SYS_env_set_status:
+		case SYS_env_set_pgfault_upcall:
+		case SYS_env_set_trapframe:
+			r = syscall(d->sd_num, d->sd_args[0], d->sd_args[1],
+				    d->sd_args[2], d->sd_args[3],
+				    d->sd_args[4]);
+			break;
+		default:
+			r = -E_INVAL;
+		}
+
+		if (user_mem_check(curenv, d, sizeof(*d), PTE_U | PTE_W) < 0)
+			return -E_FAULT;
+		d->sd_ret = r;
+		if (r < 0)
+			break;
+	}
+	return i;
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
-int32_t
-syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+static int32_t
+syscall_dispatch(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
 	// Call the function corresponding to the 'syscallno' parameter.
 	// Return any appropriate return value.
@@ -813,6 +1592,12 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		break;
 	case SYS_exofork:
 		return sys_exofork();
+	case SYS_fork:
+		return sys_fork();
+	case SYS_env_set_cow:
+		return sys_env_set_cow(a1, a2);
+	case SYS_env_service:
+		return sys_env_service(a1);
 	case SYS_env_set_status:
 		return sys_env_set_status((envid_t) a1, (int) a2);
 	case SYS_env_set_trapframe:
@@ -828,16 +1613,40 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		return sys_env_set_pgfault_upcall((envid_t) a1, (void *) a2);
 	case SYS_ipc_try_send:
 		return sys_ipc_try_send((envid_t) a1, (uint32_t) a2, (void *) a3, (unsigned) a4);
+	case SYS_ipc_send:
+		return sys_ipc_send((envid_t) a1, (uint32_t) a2, (void *) a3,
+				    (unsigned) a4);
+	case SYS_ipc_call:
+		return sys_ipc_call((envid_t) a1, (uint32_t) a2, (void *) a3,
+				    (unsigned) a4, (void *) a5);
+	case SYS_ipc_reply_recv:
+		return sys_ipc_reply_recv((envid_t) a1, (uint32_t) a2,
+					  (void *) a3, (unsigned) a4,
+					  (void *) a5);
 	case SYS_ipc_recv:
 		return sys_ipc_recv((void *) a1);
 	case SYS_env_swap:
 		return sys_env_swap((envid_t) a1);
 	case SYS_time_msec:
 		return sys_time_msec();
+	case SYS_trace:
+		return sys_trace(a1);
+	case SYS_env_set_pager:
+		return sys_env_set_pager((envid_t) a1, (envid_t) a2, a3);
+	case SYS_pager_retire:
+		return sys_pager_retire(a1);
+	case SYS_env_stats:
+		return sys_env_stats((envid_t) a1, (struct Env_stats *) a2);
+	case SYS_prof:
+		return sys_prof((int) a1, (int) a2, (struct Prof_entry *) a3);
 	case SYS_net_try_send:
 		return sys_net_try_send((char *) a1, (int) a2);
 	case SYS_net_try_receive:
 		return sys_net_try_receive((char *) a1, (int *) a2);
+	case SYS_net_wait:
+		return sys_net_wait();
+	case SYS_net_recv_page:
+		return sys_net_recv_page((void *) a1);
 	case SYS_get_mac:
 		return sys_get_mac((uint32_t *) a1, (uint32_t *) a2);
 	case SYS_env_lease:
@@ -855,6 +1664,10 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		return sys_migrate((void *) a1);
 	case SYS_lease_complete:
 		return sys_lease_complete();
+	case SYS_batch:
+		return sys_batch((struct Syscall_desc *) a1, (int) a2);
+	case SYS_env_set_sched:
+		return sys_env_set_sched((envid_t) a1, (int) a2, (int) a3);
 	default:
 		return -E_INVAL;
 	}
@@ -862,3 +1675,19 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	return 0; // for syscall that return void
 }
 
+// Account and trace a system call around its dispatch.  System calls
+// that block or switch envs never come back here, so they have no
+// TRACE_SYSCALL_EXIT event.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	int32_t r;
+
+	if (syscallno < NSYSCALLS)
+		curenv->env_stats.es_syscalls[syscallno]++;
+
+	trace(TRACE_SYSCALL_ENTER, syscallno, a1, a2);
+	r = syscall_dispatch(syscallno, a1, a2, a3, a4, a5);
+	trace(TRACE_SYSCALL_EXIT, syscallno, r, 0);
+	return r;
+}
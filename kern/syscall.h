@@ -8,5 +8,7 @@
 
 int32_t syscall(uint32_t num, uint32_t a1, uint32_t a2, uint32_t a3, 
 		uint32_t a4, uint32_t a5);
+void ipc_cancel(struct Env *e);
+int ipc_page_fault(uintptr_t va);
 
 #endif /* !JOS_KERN_SYSCALL_H */
@@ -0,0 +1,110 @@
+// Cache of the read-only pages pagers have provided.
+//
+// A demand-paged env's pager (see ipc_page_fault) is told which program
+// image the env runs by its cookie, so the read-only page it returns
+// for a given (pager, cookie, va) is the same for every env running
+// that image.  We keep a reference to each such page here and map it
+// straight into the next env that faults on it, or into a new env as
+// soon as it gets its pager, without asking the pager again.  A pager
+// whose image changes retires its cookie (sys_pager_retire), which
+// drops the image's pages, and gives the image a new one.
+
+#include <kern/textcache.h>
+#include <kern/pmap.h>
+#include <kern/env.h>
+
+// Pages cached; must be a power of two
+#define NTEXTCACHE	512
+
+struct Textpage {
+	envid_t tp_pager;
+	uint32_t tp_cookie;
+	uintptr_t tp_va;
+	struct Page *tp_page;		// NULL if the slot is empty
+};
+
+static struct Textpage textcache[NTEXTCACHE];
+
+static struct Textpage *
+textcache_slot(uint32_t cookie, uintptr_t va)
+{
+	return &textcache[(PGNUM(va) + cookie * 37) % NTEXTCACHE];
+}
+
+// Return the page cached for 'va' of the image 'cookie' of 'pager',
+// or NULL.
+struct Page *
+textcache_lookup(envid_t pager, uint32_t cookie, uintptr_t va)
+{
+	struct Textpage *tp = textcache_slot(cookie, va);
+
+	if (tp->tp_page && tp->tp_pager == pager &&
+	    tp->tp_cookie == cookie && tp->tp_va == va)
+		return tp->tp_page;
+	return NULL;
+}
+
+// Cache pp as 'va' of the image 'cookie' of 'pager', replacing
+// whatever held its slot.
+void
+textcache_insert(envid_t pager, uint32_t cookie, uintptr_t va,
+		 struct Page *pp)
+{
+	struct Textpage *tp = textcache_slot(cookie, va);
+
+	pp->pp_ref++;
+	if (tp->tp_page)
+		page_decref(tp->tp_page);
+	tp->tp_pager = pager;
+	tp->tp_cookie = cookie;
+	tp->tp_va = va;
+	tp->tp_page = pp;
+}
+
+// Map every cached page of e's image that e doesn't map yet into e.
+// Stops quietly if memory runs out, since e can still fault them in.
+void
+textcache_map(struct Env *e)
+{
+	struct Textpage *tp;
+	pte_t *pte;
+
+	for (tp = textcache; tp < textcache + NTEXTCACHE; tp++) {
+		if (!tp->tp_page || tp->tp_pager != e->env_pager ||
+		    tp->tp_cookie != e->env_pager_cookie)
+			continue;
+		pte = pgdir_walk(e->env_pgdir, (void *) tp->tp_va, 0);
+		if (pte && (*pte & PTE_P))
+			continue;
+		if (page_insert(e->env_pgdir, tp->tp_page, (void *) tp->tp_va,
+				PTE_P | PTE_U) < 0)
+			return;
+	}
+}
+
+// Forget the pages of the image 'cookie' of 'pager'.
+void
+textcache_retire(envid_t pager, uint32_t cookie)
+{
+	struct Textpage *tp;
+
+	for (tp = textcache; tp < textcache + NTEXTCACHE; tp++)
+		if (tp->tp_page && tp->tp_pager == pager &&
+		    tp->tp_cookie == cookie) {
+			page_decref(tp->tp_page);
+			tp->tp_page = NULL;
+		}
+}
+
+// Forget the pages provided by 'pager', which is going away.
+void
+textcache_drop(envid_t pager)
+{
+	struct Textpage *tp;
+
+	for (tp = textcache; tp < textcache + NTEXTCACHE; tp++)
+		if (tp->tp_page && tp->tp_pager == pager) {
+			page_decref(tp->tp_page);
+			tp->tp_page = NULL;
+		}
+}
@@ -0,0 +1,17 @@
+#ifndef JOS_KERN_TEXTCACHE_H
+#define JOS_KERN_TEXTCACHE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/env.h>
+#include <inc/memlayout.h>
+
+struct Page *textcache_lookup(envid_t pager, uint32_t cookie, uintptr_t va);
+void textcache_insert(envid_t pager, uint32_t cookie, uintptr_t va,
+		      struct Page *pp);
+void textcache_map(struct Env *e);
+void textcache_retire(envid_t pager, uint32_t cookie);
+void textcache_drop(envid_t pager);
+
+#endif /* JOS_KERN_TEXTCACHE_H */
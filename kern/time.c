@@ -1,26 +1,80 @@
 #include <kern/time.h>
+#include <kern/kclock.h>
+#include <kern/cpu.h>
 #include <inc/assert.h>
+#include <inc/x86.h>
+
+// Length of the PIT window used to calibrate the TSC.
+#define TSC_CALIBRATE_MS	10
 
 static unsigned int ticks;
+static uint64_t tsc_boot;
+static uint32_t tsc_per_msec;
+
+struct Clock_page *clock_page;
 
 void
 time_init(void)
 {
+	uint64_t t0;
+
 	ticks = 0;
+
+	// Measure the TSC against the PIT so that time_msec() can read
+	// the TSC instead of counting timer interrupts.
+	t0 = read_tsc();
+	pit_delay(TSC_CALIBRATE_MS);
+	tsc_boot = read_tsc();
+	tsc_per_msec = (tsc_boot - t0) / TSC_CALIBRATE_MS;
+	if (tsc_per_msec)
+		cprintf("TSC: %u kHz\n", tsc_per_msec);
+	else
+		cprintf("TSC: calibration failed, using timer ticks\n");
+
+	// Publish the calibration for the user library's sys_time_msec()
+	clock_page->cp_tsc_boot = tsc_boot;
+	clock_page->cp_tsc_per_msec = tsc_per_msec;
+	clock_page->cp_msec = 0;
 }
 
 // This should be called once per timer interrupt.  A timer interrupt
-// fires every 10 ms.
+// fires every 1000/TIMER_HZ ms on every CPU, but only the boot CPU's
+// interrupts advance the tick count.
 void
 time_tick(void)
 {
+	if (thiscpu != bootcpu)
+		return;
 	ticks++;
-	if (ticks * 10 < ticks)
+	if (ticks * (1000 / TIMER_HZ) < ticks)
 		panic("time_tick: time overflowed");
+	clock_page->cp_msec = time_msec();
 }
 
+// Returns the number of milliseconds since boot, with millisecond
+// resolution when the TSC has been calibrated.
 unsigned int
 time_msec(void)
 {
-	return ticks * 10;
+	if (tsc_per_msec)
+		return (read_tsc() - tsc_boot) / tsc_per_msec;
+	return ticks * (1000 / TIMER_HZ);
+}
+
+// Convert a count of TSC cycles to milliseconds, or, if the TSC has not
+// been calibrated, return 'ticks' timer ticks in milliseconds instead.
+unsigned int
+time_tsc_msec(uint64_t tsc, unsigned int ticks)
+{
+	if (tsc_per_msec)
+		return tsc / tsc_per_msec;
+	return ticks * (1000 / TIMER_HZ);
+}
+
+// Returns true if time_msec() does not depend on timer interrupts, so
+// that the timer may be stopped on any CPU.
+bool
+time_tsc_calibrated(void)
+{
+	return tsc_per_msec != 0;
 }
@@ -4,8 +4,24 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/types.h>
+#include <inc/clock.h>
+
+// Timer interrupts per second on each CPU.  Override at build time with
+// e.g. 'make DEFS=-DTIMER_HZ=250'; it must divide 1000.
+#ifndef TIMER_HZ
+#define TIMER_HZ	100
+#endif
+#if TIMER_HZ <= 0 || 1000 % TIMER_HZ
+# error "TIMER_HZ must divide 1000"
+#endif
+
+extern struct Clock_page *clock_page;	// Mapped read-only at UCLOCK
+
 void time_init(void);
 void time_tick(void);
 unsigned int time_msec(void);
+unsigned int time_tsc_msec(uint64_t tsc, unsigned int ticks);
+bool time_tsc_calibrated(void);
 
 #endif /* JOS_KERN_TIME_H */
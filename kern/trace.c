@@ -0,0 +1,33 @@
+// Kernel event tracing.
+//
+// Each CPU appends timestamped events to its own ring, which user
+// programs can read at UTRACE (see inc/trace.h for the protocol).
+// Recording is off until sys_trace enables some event types.
+
+#include <inc/x86.h>
+
+#include <kern/trace.h>
+#include <kern/cpu.h>
+#include <kern/env.h>
+
+struct Trace_ring *trace_rings;
+uint32_t trace_mask;
+
+void
+trace_record(int type, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+	struct Trace_ring *r = &trace_rings[cpunum()];
+	uint32_t i = r->tr_head;
+	volatile struct Trace_event *te = &r->tr_events[i % TRACE_NEVENT];
+
+	te->te_seq = ~0;
+	te->te_tsc = read_tsc();
+	te->te_type = type;
+	te->te_cpu = cpunum();
+	te->te_envid = curenv ? curenv->env_id : 0;
+	te->te_args[0] = a0;
+	te->te_args[1] = a1;
+	te->te_args[2] = a2;
+	te->te_seq = i;
+	r->tr_head = i + 1;
+}
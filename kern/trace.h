@@ -0,0 +1,22 @@
+#ifndef JOS_KERN_TRACE_H
+#define JOS_KERN_TRACE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/trace.h>
+
+extern struct Trace_ring *trace_rings;	// Mapped read-only at UTRACE
+extern uint32_t trace_mask;		// Bit (1 << type) records 'type'
+
+void trace_record(int type, uint32_t a0, uint32_t a1, uint32_t a2);
+
+// Record an event of 'type' on this CPU if that type is enabled.
+static inline void
+trace(int type, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+	if (trace_mask & (1 << type))
+		trace_record(type, a0, a1, a2);
+}
+
+#endif /* JOS_KERN_TRACE_H */
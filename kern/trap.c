@@ -14,6 +14,9 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/prof.h>
+#include <kern/trace.h>
+#include <kern/e1000.h>
 
 static struct Taskstate ts;
 
@@ -112,6 +115,8 @@ trap_init(void)
 	extern void handler_irq13();
 	extern void handler_irq14();
 	extern void handler_irq15();
+	extern void handler_wakeup();
+	extern void handler_tlb();
 
 	// Initialize entries in idt
 	SETGATE(idt[T_DIVIDE], 0, GD_KT, handler_divide, DPL_KERN);
@@ -155,6 +160,8 @@ trap_init(void)
 	SETGATE(idt[IRQ_OFFSET + 13], 0, GD_KT, handler_irq13, DPL_KERN);
 	SETGATE(idt[IRQ_OFFSET + 14], 0, GD_KT, handler_irq14, DPL_KERN);
 	SETGATE(idt[IRQ_OFFSET + 15], 0, GD_KT, handler_irq15, DPL_KERN);
+	SETGATE(idt[IRQ_OFFSET + IRQ_WAKEUP], 0, GD_KT, handler_wakeup, DPL_KERN);
+	SETGATE(idt[IRQ_OFFSET + IRQ_TLB], 0, GD_KT, handler_tlb, DPL_KERN);
 
 	// Per-CPU setup 
 	trap_init_percpu();
@@ -164,6 +171,8 @@ trap_init(void)
 void
 trap_init_percpu(void)
 {
+	uint32_t edx;
+
 	// The example code here sets up the Task State Segment (TSS) and
 	// the TSS descriptor for CPU 0. But it is incorrect if we are
 	// running on other CPUs because each CPU has its own kernel stack.
@@ -200,6 +209,26 @@ trap_init_percpu(void)
 
 	// Load the IDT
 	lidt(&idt_pd);
+
+	// Set up the sysenter fast system call path, if the CPU has it.
+	// sysenter uses the same kernel stack as interrupts.  The user
+	// library uses it only if the clock page says every CPU has it;
+	// the APs get here before any env runs.
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (edx & CPUID_SEP) {
+		extern void sysenter_handler();
+
+		wrmsr(MSR_IA32_SYSENTER_CS, GD_KT);
+		wrmsr(MSR_IA32_SYSENTER_ESP, thiscpu->cpu_ts.ts_esp0);
+		wrmsr(MSR_IA32_SYSENTER_EIP, (uint32_t) sysenter_handler);
+		if (thiscpu == bootcpu)
+			clock_page->cp_sysenter = 1;
+	} else {
+		if (clock_page->cp_sysenter || thiscpu == bootcpu)
+			cprintf("CPU %d has no sysenter; using int $T_SYSCALL\n",
+				cpunum());
+		clock_page->cp_sysenter = 0;
+	}
 }
 
 void
@@ -288,12 +317,19 @@ trap_dispatch(struct Trapframe *tf)
 	// LAB 4: Your code here.
 	// LAB 6: Your code here.
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
+		prof_tick(tf);
 		time_tick();
 		lapic_eoi();
-		sched_yield();
+		sched_tick();
 		return;
 	}
 
+	// Another CPU made an env runnable while this one was halted.
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_WAKEUP) {
+		lapic_eoi();
+		sched_yield();
+	}
+
 	// Handle keyboard and serial interrupts.
 	// LAB 7: Your code here.
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_SERIAL) {
@@ -306,6 +342,11 @@ trap_dispatch(struct Trapframe *tf)
 		return;
 	}
 
+	if (e1000_irq && tf->tf_trapno == IRQ_OFFSET + e1000_irq) {
+		e1000_intr();
+		return;
+	}
+
 	// Unexpected trap: The user process or the kernel has a bug.
 	print_trapframe(tf);
 	if (tf->tf_cs == GD_KT)
@@ -333,12 +374,28 @@ trap(struct Trapframe *tf)
 	// the interrupt path.
 	assert(!(read_eflags() & FL_IF));
 
+	// The CPU asking for a TLB shootdown holds the big kernel lock and
+	// is waiting for us, so answer without taking it.
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLB) {
+		tlb_shootdown_handler();
+		lapic_eoi();
+		env_pop_tf(tf);
+	}
+
+	// Re-acquire the big kernel lock if we were halted in sched_halt()
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED) {
+		lock_kernel();
+		tlb_shootdown_sync();
+	}
+
 	if ((tf->tf_cs & 3) == 3) {
 		// Trapped from user mode.
 		// Acquire the big kernel lock before doing any
 		// serious kernel work.
 		// LAB 4: Your code here.
+		thiscpu->cpu_in_kernel = 1;
 		lock_kernel();
+		tlb_shootdown_sync();
 		assert(curenv);
 
 		// Garbage collect if current enviroment is a zombie
@@ -421,6 +478,23 @@ page_fault_handler(struct Trapframe *tf)
 	//   To change what the user environment runs, modify 'curenv->env_tf'
 	//   (the 'tf' variable points at 'curenv->env_tf').
 
+	curenv->env_stats.es_pgfaults++;
+	trace(TRACE_PGFAULT, fault_va, tf->tf_eip, tf->tf_err);
+
+	// Envs that opted in have write faults on copy-on-write pages
+	// resolved here, without a round trip through the upcall.
+	if (curenv->env_cow_kernel && (tf->tf_err & FEC_WR) &&
+	    fault_va < UTOP &&
+	    page_cow(curenv->env_pgdir, (void *) fault_va) == 0) {
+		curenv->env_stats.es_cow_faults++;
+		return;
+	}
+
+	// Pages of a demand-paged program that it hasn't touched yet come
+	// from its pager, or its text cache.
+	if (!(tf->tf_err & FEC_PR) && ipc_page_fault(fault_va) == 0)
+		return;
+
 	// LAB 4: Your code here.
 	if (!curenv->env_pgfault_upcall) {
 		goto destroy;
@@ -467,3 +541,78 @@ page_fault_handler(struct Trapframe *tf)
 	print_trapframe(tf);
 	env_destroy(curenv);
 }
+
+// Returns true if system call 'num' takes a fifth argument.
+static bool
+syscall_has_a5(uint32_t num)
+{
+	switch (num) {
+	case SYS_page_map:
+	case SYS_ipc_call:
+	case SYS_ipc_reply_recv:
+	case SYS_copy_mem:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+// Fast system call entry, from sysenter_handler.  'regs' holds the
+// user's general registers: %eax is the syscall number, %edx, %ecx,
+// %ebx and %edi are the first four arguments, %esi is the return %eip
+// and %ebp the user stack pointer, with the fifth argument, for the
+// calls that take one, at 4(%ebp).
+// The user's EFLAGS, less FL_IF, follow 'regs' on the stack.
+// Stores the result in regs->reg_eax and returns to sysexit, unless the
+// system call switched away from curenv.
+void
+sysenter_syscall(struct PushRegs *regs)
+{
+	struct Trapframe *tf;
+	uint32_t a5 = 0;
+	int32_t r;
+
+	thiscpu->cpu_in_kernel = 1;
+	lock_kernel();
+	tlb_shootdown_sync();
+	assert(curenv);
+
+	// Garbage collect if current enviroment is a zombie
+	if (curenv->env_status == ENV_DYING) {
+		env_free(curenv);
+		curenv = NULL;
+		sched_yield();
+	}
+
+	// Save the user's state in the same form trap() would, in case
+	// the system call blocks or another env runs before we return.
+	tf = &curenv->env_tf;
+	tf->tf_regs = *regs;
+	tf->tf_eip = regs->reg_esi;
+	tf->tf_esp = regs->reg_ebp;
+	tf->tf_cs = GD_UT | 3;
+	tf->tf_ds = tf->tf_es = tf->tf_ss = GD_UD | 3;
+	// Keep FL_IOPL_MASK in particular, or an I/O env (the file
+	// server) that blocks here resumes unable to do I/O
+	tf->tf_eflags = *(uint32_t *) (regs + 1) | FL_IF;
+	tf->tf_trapno = T_SYSCALL;
+	last_tf = tf;
+
+	if (syscall_has_a5(regs->reg_eax)) {
+		user_mem_assert(curenv, (void *) (regs->reg_ebp + 4), 4, PTE_U);
+		a5 = *(uint32_t *) (regs->reg_ebp + 4);
+	}
+
+	r = syscall(regs->reg_eax, regs->reg_edx, regs->reg_ecx,
+		    regs->reg_ebx, regs->reg_edi, a5);
+	tf->tf_regs.reg_eax = r;
+
+	// The env blocked or was destroyed; it resumes through env_run
+	if (!curenv || curenv->env_status != ENV_RUNNING)
+		sched_yield();
+
+	regs->reg_eax = r;
+	tlb_shootdown();
+	thiscpu->cpu_in_kernel = 0;
+	unlock_kernel();
+}
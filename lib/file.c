@@ -6,6 +6,8 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 
+static envid_t fsenv;
+
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
 // response may be written back to fsipcbuf.
@@ -15,7 +17,6 @@ union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 static int
 fsipc(unsigned type, void *dstva)
 {
-	static envid_t fsenv;
 	if (fsenv == 0)
 		fsenv = ipc_find_env(ENV_TYPE_FS);
 
@@ -24,8 +25,142 @@ fsipc(unsigned type, void *dstva)
 	if (debug)
 		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
 
-	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
-	return ipc_recv(NULL, dstva, NULL);
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+			dstva, NULL);
+}
+
+// The FS request ring (see lib/ipcring.c) is used to pipeline reads and
+// writes of more than one page.  Its Ipcring page is at FSRINGVA,
+// followed by one Fsipc buffer page per slot.  All are PTE_NOFORK, so a
+// child neither inherits the ring nor holds its server slot; it sets up
+// its own on first use.
+#define FSRINGVA	0xCFF00000
+#define FSRINGBUF(s)	((union Fsipc *) (FSRINGVA + (1 + (s))*PGSIZE))
+#define FSRINGPERM	(PTE_P | PTE_U | PTE_W | PTE_NOFORK)
+
+// How long to go without a ring after failing to set one up, so that a
+// moment with every server ring in use doesn't cost a failed setup on
+// every read.
+#define FSRING_RETRY_MSEC	1000
+
+static void
+fsring_unmap(void)
+{
+	int i;
+
+	for (i = 0; i <= IPCRING_NSLOT; i++)
+		sys_page_unmap(0, (void *) (FSRINGVA + i*PGSIZE));
+}
+
+// Return this environment's FS ring, setting it up on first use.
+// Returns NULL if the ring can't be set up.
+static struct Ipcring *
+fsring_get(void)
+{
+	static unsigned fsring_retry;
+	static envid_t fsring_retry_env;
+	struct Ipcring *r = (struct Ipcring *) FSRINGVA;
+	int i, id;
+
+	if ((vpd[PDX(r)] & PTE_P) && (vpt[PGNUM(r)] & PTE_P))
+		return r;
+	// A forked child starts over with its own ring
+	if (fsring_retry_env == thisenv->env_id &&
+	    (int) (sys_time_msec() - fsring_retry) < 0)
+		return NULL;
+
+	if (fsenv == 0)
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	for (i = 0; i <= IPCRING_NSLOT; i++)
+		if (sys_page_alloc(0, (void *) (FSRINGVA + i*PGSIZE),
+				   FSRINGPERM) < 0)
+			goto fail;
+	ipcring_init(r, fsenv, FSREQ_RING_NOTIFY, FSREQ_RING_WAIT);
+
+	if ((id = ipc_call(fsenv, FSREQ_RING_OPEN, r, FSRINGPERM,
+			   NULL, NULL)) < 0)
+		goto fail;
+	for (i = 0; i < IPCRING_NSLOT; i++) {
+		FSRINGBUF(i)->ring_buf.req_ringid = id;
+		FSRINGBUF(i)->ring_buf.req_slot = i;
+		if (ipc_call(fsenv, FSREQ_RING_BUF, FSRINGBUF(i), FSRINGPERM,
+			     NULL, NULL) < 0)
+			goto fail;
+	}
+	return r;
+
+fail:
+	fsring_unmap();
+	fsring_retry = sys_time_msec() + FSRING_RETRY_MSEC;
+	fsring_retry_env = thisenv->env_id;
+	return NULL;
+}
+
+// Read or write 'n' bytes at fd's seek position as a pipeline of
+// page-sized FSREQ_PREAD or FSREQ_PWRITE requests on the FS ring, so
+// that the file server can serve them all in one wakeup.  Each request
+// carries its own offset, so one that fails can't move the data of
+// those queued behind it.  Stops queueing at the first error or short
+// read, and advances the seek position by the bytes transferred in
+// order before it.
+//
+// Returns the number of bytes transferred, < 0 on error, or
+// -E_NOT_SUPP if there is no ring.
+static ssize_t
+fsring_rw(struct Fd *fd, unsigned type, char *buf, size_t n)
+{
+	struct Ipcring *r;
+	struct Ipcring_slot *slot;
+	union Fsipc *req;
+	size_t chunk, len, queued = 0;
+	ssize_t total = 0;
+	int s, res, err = 0, stop = 0, ended = 0;
+
+	if (!(r = fsring_get()))
+		return -E_NOT_SUPP;
+
+	chunk = (type == FSREQ_PREAD) ? PGSIZE : sizeof(req->pwrite.req_buf);
+	while (r->ir_rsp_cons != r->ir_req_prod || (!stop && queued < n)) {
+		// Queue as many pieces as there are free slots
+		while (!stop && queued < n && (slot = ipcring_req_slot(r))) {
+			req = FSRINGBUF(r->ir_req_prod % IPCRING_NSLOT);
+			len = MIN(n - queued, chunk);
+			if (type == FSREQ_PREAD) {
+				req->pread.req_fileid = fd->fd_file.id;
+				req->pread.req_n = len;
+				req->pread.req_offset = fd->fd_offset + queued;
+			} else {
+				req->pwrite.req_fileid = fd->fd_file.id;
+				req->pwrite.req_n = len;
+				req->pwrite.req_offset = fd->fd_offset + queued;
+				memmove(req->pwrite.req_buf, buf + queued, len);
+			}
+			slot->is_type = type;
+			ipcring_req_push(r);
+			queued += len;
+		}
+
+		// Reap the oldest response.  Once one fails or comes up
+		// short, those behind it only need to be drained.
+		s = r->ir_rsp_cons % IPCRING_NSLOT;
+		res = ipcring_rsp_wait(r)->is_result;
+		if (!ended && res < 0) {
+			err = res;
+			ended = stop = 1;
+		} else if (!ended) {
+			if (type == FSREQ_PREAD)
+				memmove(buf + total, FSRINGBUF(s)->readRet.ret_buf,
+					res);
+			if (res < (int) MIN(n - total, chunk))
+				ended = stop = 1;
+			total += res;
+		}
+		ipcring_rsp_pop(r);
+	}
+
+	fd->fd_offset += total;
+	return total ? total : err;
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -91,6 +226,35 @@ open(const char *path, int mode)
 	return fd2num(fd);
 }
 
+// Have the file server provide the pages of the program open as fdnum,
+// whose loadable segments are segs[0..nseg-1], to environments that
+// fault on them (see sys_env_set_pager).  Stores the server's envid in
+// *pager_store.
+//
+// Returns the cookie to pass to sys_env_set_pager, < 0 on error.
+int
+file_image(int fdnum, const struct Fsimage_seg *segs, int nseg,
+	   envid_t *pager_store)
+{
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+		return -E_NOT_SUPP;
+	if (nseg < 0 || nseg > FSIMAGE_NSEG)
+		return -E_INVAL;
+
+	fsipcbuf.image.req_fileid = fd->fd_file.id;
+	fsipcbuf.image.req_nseg = nseg;
+	memmove(fsipcbuf.image.req_segs, segs, nseg * sizeof(segs[0]));
+	if ((r = fsipc(FSREQ_IMAGE, NULL)) < 0)
+		return r;
+	*pager_store = fsenv;
+	return r;
+}
+
 // Flush the file descriptor.  After this the fileid is invalid.
 //
 // This function is called by fd_close.  fd_close will take care of
@@ -121,6 +285,10 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
 	// LAB 5: Your code here
 	int r;
 
+	// Pipeline reads of more than a page on the FS ring
+	if (n > PGSIZE && (r = fsring_rw(fd, FSREQ_PREAD, buf, n)) != -E_NOT_SUPP)
+		return r;
+
 	fsipcbuf.read.req_fileid = fd->fd_file.id;
 	fsipcbuf.read.req_n = n;
 	
@@ -148,6 +316,11 @@ devfile_write(struct Fd *fd, const void *buf, size_t n)
 	int r;
 	uint32_t max_n = PGSIZE - (sizeof(int) + sizeof(size_t));
 
+	// Pipeline writes of more than one request on the FS ring
+	if (n > max_n &&
+	    (r = fsring_rw(fd, FSREQ_PWRITE, (char *) buf, n)) != -E_NOT_SUPP)
+		return r;
+
 	n = n > max_n ? max_n : n;
 
 	fsipcbuf.write.req_fileid = fd->fd_file.id;
@@ -3,10 +3,6 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
@@ -65,6 +61,67 @@ pgfault(struct UTrapframe *utf)
 	}
 }
 
+// sfork() and spawn's copy_shared_pages() queue their sys_page_map calls
+// here, and the queue hands them to the kernel with sys_batch a page of
+// descriptors at a time instead of trapping once or twice per page.
+// The queue lives at UTEMP, below UTEXT, so sfork never marks it
+// copy-on-write in the middle of a batch.
+#define DUPQ		((struct Syscall_desc *) UTEMP)
+#define DUPQ_MAX	(PGSIZE / sizeof(struct Syscall_desc))
+
+static int dupq_len;
+
+// Set up an empty queue at UTEMP.
+int
+dupq_begin(void)
+{
+	dupq_len = 0; // a forked child inherits a stale count
+	return sys_page_alloc(0, DUPQ, PTE_U | PTE_P | PTE_W);
+}
+
+static int
+dupq_flush(void)
+{
+	int r, n = dupq_len;
+
+	dupq_len = 0;
+	if ((r = sys_batch(DUPQ, n)) < 0)
+		return r;
+	return r < n ? DUPQ[r].sd_ret : 0;
+}
+
+// Queue a sys_page_map of page pn (or of the 4MB page at pn, if perm
+// has PTE_PS) from srcenv to the same address in dstenv.
+int
+dupq_map(envid_t srcenv, unsigned pn, envid_t dstenv, int perm)
+{
+	struct Syscall_desc *d;
+	int r;
+
+	if (dupq_len == DUPQ_MAX && (r = dupq_flush()) < 0)
+		return r;
+
+	d = &DUPQ[dupq_len++];
+	d->sd_num = SYS_page_map;
+	d->sd_args[0] = srcenv;
+	d->sd_args[1] = pn * PGSIZE;
+	d->sd_args[2] = dstenv;
+	d->sd_args[3] = pn * PGSIZE;
+	d->sd_args[4] = perm;
+	return 0;
+}
+
+// Make the queued mappings and release the queue.  Returns the first
+// error, if any.
+int
+dupq_end(void)
+{
+	int r = dupq_flush();
+
+	sys_page_unmap(0, DUPQ);
+	return r;
+}
+
 //
 // Map our virtual page pn (address pn*PGSIZE) into the target envid
 // at the same virtual address.  If the page is writable or copy-on-write,
@@ -73,6 +130,8 @@ pgfault(struct UTrapframe *utf)
 // copy-on-write again if it was already copy-on-write at the beginning of
 // this function?)
 //
+// The mappings are queued; call dupq_flush() to make them.
+//
 // Returns: 0 on success, < 0 on error.
 // It is also OK to panic on error.
 //
@@ -88,9 +147,7 @@ duppage(envid_t envid, unsigned pn)
 
 	// If PTE_SHARE, copy mapping directly
 	if (pte & PTE_SHARE) {
-		if ((r = sys_page_map(myenvid, (void *) (pn * PGSIZE), envid, 
-				      (void *) (pn * PGSIZE), 
-				      pte & PTE_SYSCALL)) < 0) {
+		if ((r = dupq_map(myenvid, pn, envid, pte & PTE_SYSCALL)) < 0) {
 			return r;
 		}
 	}
@@ -101,17 +158,13 @@ duppage(envid_t envid, unsigned pn)
 		}
 
 		// Map to envid VA
-		if ((r = sys_page_map(myenvid, (void *) (pn * PGSIZE), envid, 
-				      (void *) (pn * PGSIZE), perm)) < 0) {
+		if ((r = dupq_map(myenvid, pn, envid, perm)) < 0) {
 			return r;
 		}
 
 		// If COW remap to self
 		if (perm & PTE_COW) {
-			if ((r = sys_page_map(myenvid, (void *) (pn * PGSIZE), 
-					      myenvid,
-					      (void *) (pn * PGSIZE), 
-					      perm)) < 0) {
+			if ((r = dupq_map(myenvid, pn, myenvid, perm)) < 0) {
 				return r;
 			}
 		}
@@ -121,86 +174,29 @@ duppage(envid_t envid, unsigned pn)
 }
 
 //
-// User-level fork with copy-on-write.
-// Set up our page fault handler appropriately.
-// Create a child.
-// Copy our address space and page fault handler setup to the child.
-// Then mark the child as runnable and return.
+// Fork with copy-on-write.
+// Set up our page fault handler appropriately, then let the kernel
+// copy our page tables to a new child, marking writable pages
+// copy-on-write in both of us, and start it.
 //
 // Returns: child's envid to the parent, 0 to the child, < 0 on error.
-// It is also OK to panic on error.
-//
-// Hint:
-//   Use vpd, vpt, and duppage.
-//   Remember to fix "thisenv" in the child process.
-//   Neither user exception stack should ever be marked copy-on-write,
-//   so you must allocate a new page for the child's user exception stack.
 //
 envid_t
 fork(void)
 {
-	// LAB 4: Your code here.	
-	extern void _pgfault_upcall(void);
-	envid_t myenvid = sys_getenvid();
 	envid_t envid;
-	uint32_t i, j, pn;
 
-	// Set page fault handler
+	// Our own writable pages are about to become copy-on-write.  Have
+	// the kernel copy them on write; pgfault() is the fallback.
 	set_pgfault_handler(pgfault);
-	
-	// Create a child
-	if ((envid = sys_exofork()) < 0) {
-		return -1;
+	sys_env_set_cow(0, 1);
+
+	if ((envid = sys_fork()) < 0) {
+		return envid;
 	}
 
 	if (envid == 0) {
 		thisenv = &envs[ENVX(sys_getenvid())];
-		return envid; // in child env? return simply
-	}
-
-	// Copy address space to child
-	for (i = PDX(UTEXT); i < PDX(UXSTACKTOP); i++) {
-		if (vpd[i] & PTE_P) { // If page table present
-			for (j = 0; j < NPTENTRIES; j++) {			
-				pn = PGNUM(PGADDR(i, j, 0));
-				if (pn == PGNUM(UXSTACKTOP - PGSIZE)) {
-					break; // Don't map when reach uxstack
-				}
-
-				if (vpt[pn] & PTE_P) {
-					duppage(envid, pn);
-				}			
-			}
-		}
-	}
-
-	// Allocate new exception stack for child	
-	if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W) < 0) {
-		return -1;
-	}
-
-	// Map child uxstack to temp page 
-	if (sys_page_map(envid, (void *) (UXSTACKTOP - PGSIZE), myenvid, PFTEMP, 
-			PTE_U | PTE_P | PTE_W) < 0) {
-		return -1;
-	}
-
-	// Copy own uxstack to temp page
-	memmove((void *)(UXSTACKTOP - PGSIZE), PFTEMP, PGSIZE);
-
-	// Unmap temp page
-	if (sys_page_unmap(myenvid, PFTEMP) < 0) {
-		return -1;
-	}	
-
-	// Set page fault handler in child
-	if (sys_env_set_pgfault_upcall(envid, _pgfault_upcall) < 0) {
-		return -1;
-	}
-
-	// Mark child env as RUNNABLE
-	if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
-		return -1;
 	}
 
 	return envid;
@@ -231,7 +227,18 @@ sfork(void)
 	}
 
 	// Copy address space to child
+	if (dupq_begin() < 0) {
+		return -1;
+	}
 	for (i = PDX(UTEXT); i < PDX(UXSTACKTOP); i++) {
+		if ((vpd[i] & PTE_P) && (vpd[i] & PTE_PS)) { // Share 4MB page
+			if (dupq_map(myenvid, PGNUM(PGADDR(i, 0, 0)), envid,
+				     (vpd[i] & PTE_SYSCALL) | PTE_PS) < 0) {
+				return -1;
+			}
+			continue;
+		}
+
 		if (vpd[i] & PTE_P) { // If page table present
 			for (j = 0; j < NPTENTRIES; j++) {			
 				pn = PGNUM(PGADDR(i, j, 0));
@@ -245,10 +252,9 @@ sfork(void)
 				}
 
 				// Map same page to child env with same perms
-				if (vpt[pn] & PTE_P) {
+				if ((vpt[pn] & PTE_P) && !(vpt[pn] & PTE_NOFORK)) {
 					perm = vpt[pn] & ~(vpt[pn] & ~(PTE_P | PTE_U | PTE_W | PTE_AVAIL));
-					if (sys_page_map(myenvid, (void *) (PGADDR(i, j, 0)),
-						envid, (void *) (PGADDR(i, j, 0)), perm) < 0) {			
+					if (dupq_map(myenvid, pn, envid, perm) < 0) {
 						return -1;
 					}
 				}		
@@ -256,6 +262,10 @@ sfork(void)
 		}
 	}
 
+	if (dupq_end() < 0) {
+		return -1;
+	}
+
 	// Allocate new exception stack for child	
 	if (sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W) < 0) {
 		return -1;
@@ -52,7 +52,8 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 }
 
 // Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
-// This function keeps trying until it succeeds.
+// The kernel blocks us until 'toenv' receives, so this only retries
+// while 'toenv' is suspended for migration.
 // It should panic() on any error other than -E_IPC_NOT_RECV.
 //
 // Hint:
@@ -70,7 +71,7 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 	}
 
 	while (1) {
-		err = sys_ipc_try_send(to_env, val, pg, perm);
+		err = sys_ipc_send(to_env, val, pg, perm);
 		if (!err) {
 			break; // success
 		} 
@@ -82,15 +83,73 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 	}
 }
 
-// Find the first environment of the given type.  We'll use this to
-// find special environments.
+// Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'to_env' and
+// wait for its reply, which is returned as by ipc_recv with any reply
+// page mapped at 'rcv_pg'.  The kernel switches straight to 'to_env', and
+// only a message from 'to_env' counts as the reply.
+// Blocks in the kernel until 'to_env' receives, like ipc_send.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+	void *srcva = pg ? pg : (void *) UTOP;
+	void *dstva = rcv_pg ? rcv_pg : (void *) UTOP;
+	int err;
+
+	while ((err = sys_ipc_call(to_env, val, srcva, pg ? perm : 0,
+				   dstva)) == -E_IPC_NOT_RECV)
+		sys_yield();
+
+	// Leased and remote envs can't take a direct switch
+	if (err == -E_NOT_SUPP) {
+		ipc_send(to_env, val, pg, perm);
+		return ipc_recv(NULL, rcv_pg, perm_store);
+	}
+	if (err < 0)
+		panic("ipc_call failed with error %e", err);
+
+	if (perm_store)
+		*perm_store = thisenv->env_ipc_perm;
+	return thisenv->env_ipc_value;
+}
+
+// Send the reply 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to
+// 'to_env', then receive the next request as ipc_recv would.  Servers
+// loop on this so that a client blocked in ipc_call runs as soon as its
+// reply is sent.  A server must not wait on its clients, so if 'to_env'
+// is gone or isn't receiving, the reply is dropped.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store)
+{
+	void *srcva = pg ? pg : (void *) UTOP;
+	void *dstva = rcv_pg ? rcv_pg : (void *) UTOP;
+	int r;
+
+	if (sys_ipc_reply_recv(to_env, val, srcva, pg ? perm : 0, dstva) < 0) {
+		// The client can't take a direct switch (it may be leased);
+		// try once to reply the slow way
+		r = sys_ipc_try_send(to_env, val, srcva, pg ? perm : 0);
+		if (r < 0 && r != -E_BAD_ENV && r != -E_IPC_NOT_RECV)
+			cprintf("ipc_reply_recv: reply to %08x: %e\n",
+				to_env, r);
+		return ipc_recv(from_env_store, rcv_pg, perm_store);
+	}
+
+	if (from_env_store)
+		*from_env_store = thisenv->env_ipc_from;
+	if (perm_store)
+		*perm_store = thisenv->env_ipc_perm;
+	return thisenv->env_ipc_value;
+}
+
+// Find the environment providing the given service type, as registered
+// with the kernel.  We'll use this to find special environments.
 // Returns 0 if no such environment exists.
 envid_t
 ipc_find_env(enum EnvType type)
 {
-	int i;
-	for (i = 0; i < NENV; i++)
-		if (envs[i].env_type == type)
-			return envs[i].env_id;
-	return 0;
+	envid_t envid = sys_env_service(type);
+
+	return envid < 0 ? 0 : envid;
 }
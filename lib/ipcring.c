@@ -0,0 +1,148 @@
+// Asynchronous IPC over shared-memory rings.
+//
+// A client queues any number of requests (up to IPCRING_NSLOT) on a
+// ring shared with a server and reaps the responses later.  Neither
+// end enters the kernel while its peer is awake and polling.  The
+// client wakes a sleeping server with an ir_notify IPC, and when it
+// runs out of responses it blocks in an ipc_call of ir_wait, which the
+// server answers once there is a response.  The client thus only ever
+// sleeps in a receive from the server, and the server never needs to
+// know whether the client is about to sleep.
+// How request payloads are passed (e.g. one shared page per slot) is
+// up to the protocol built on top.
+//
+// The server trusts nothing on the shared page: its consumer index and
+// the client's identity are kept in a private struct Ipcring_server.
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+ipcring_init(struct Ipcring *r, envid_t server, uint32_t notify,
+	     uint32_t wait)
+{
+	memset(r, 0, sizeof(*r));
+	r->ir_client = thisenv->env_id;
+	r->ir_server = server;
+	r->ir_notify = notify;
+	r->ir_wait = wait;
+}
+
+// Client: return the next free request slot, or NULL if the ring is full.
+struct Ipcring_slot *
+ipcring_req_slot(struct Ipcring *r)
+{
+	if (r->ir_req_prod - r->ir_rsp_cons >= IPCRING_NSLOT)
+		return NULL;
+	return &r->ir_slot[r->ir_req_prod % IPCRING_NSLOT];
+}
+
+// Client: publish the slot returned by ipcring_req_slot.  The server is
+// only notified if it is asleep, so publishing several requests in a
+// row costs at most one IPC.  Errors are ignored: a server that has
+// exited doesn't need waking.
+void
+ipcring_req_push(struct Ipcring *r)
+{
+	// xchg orders the slot contents before the index, and the index
+	// before our read of ir_server_sleeping.
+	xchg(&r->ir_req_prod, r->ir_req_prod + 1);
+	if (xchg(&r->ir_server_sleeping, 0))
+		sys_ipc_send(r->ir_server, r->ir_notify, (void *) UTOP, 0);
+}
+
+// Client: wait for the response to the oldest outstanding request and
+// return its slot.  Release it with ipcring_rsp_pop.
+struct Ipcring_slot *
+ipcring_rsp_wait(struct Ipcring *r)
+{
+	assert(r->ir_rsp_cons != r->ir_req_prod);
+	while (r->ir_rsp_prod == r->ir_rsp_cons)
+		ipc_call(r->ir_server, r->ir_wait, NULL, 0, NULL, NULL);
+	return &r->ir_slot[r->ir_rsp_cons % IPCRING_NSLOT];
+}
+
+void
+ipcring_rsp_pop(struct Ipcring *r)
+{
+	r->ir_rsp_cons++;
+}
+
+// Server: start serving ring 'r', opened by 'client'.
+void
+ipcring_server_init(struct Ipcring_server *sv, struct Ipcring *r,
+		    envid_t client)
+{
+	sv->sv_ring = r;
+	sv->sv_client = client;
+	sv->sv_req_cons = 0;
+	sv->sv_client_waiting = 0;
+}
+
+// Server: return the number of requests queued.  A client following the
+// protocol never has more than IPCRING_NSLOT outstanding, so no larger
+// count is believed.
+int
+ipcring_req_avail(struct Ipcring_server *sv)
+{
+	return MIN(sv->sv_ring->ir_req_prod - sv->sv_req_cons,
+		   IPCRING_NSLOT);
+}
+
+// Server: return the slot of the oldest request, which
+// ipcring_req_avail must have counted.  Answer it with ipcring_rsp_push.
+struct Ipcring_slot *
+ipcring_req_peek(struct Ipcring_server *sv)
+{
+	return &sv->sv_ring->ir_slot[sv->sv_req_cons % IPCRING_NSLOT];
+}
+
+// Server: answer the client's ir_wait call if it is waiting.  A client
+// blocked in ipc_call is receiving, so the send never has to block;
+// that matters because the server may be the client's pager, and a
+// client faulting on its way into ir_wait is queued on us.  A client
+// that has exited, or sent ir_wait without waiting for the answer,
+// simply misses the wakeup.
+static void
+ipcring_wake(struct Ipcring_server *sv)
+{
+	if (sv->sv_client_waiting) {
+		sv->sv_client_waiting = 0;
+		sys_ipc_try_send(sv->sv_client, 0, (void *) UTOP, 0);
+	}
+}
+
+// Server: publish the response written into the slot from
+// ipcring_req_peek, waking the client if it is waiting.
+void
+ipcring_rsp_push(struct Ipcring_server *sv)
+{
+	sv->sv_req_cons++;
+	xchg(&sv->sv_ring->ir_rsp_prod, sv->sv_req_cons);
+	ipcring_wake(sv);
+}
+
+// Server: the client sent ir_wait.  Answer it as soon as it has a
+// response to reap, which may already be the case.
+void
+ipcring_client_wait(struct Ipcring_server *sv)
+{
+	sv->sv_client_waiting = 1;
+	if (sv->sv_ring->ir_rsp_cons != sv->sv_req_cons)
+		ipcring_wake(sv);
+}
+
+// Server: announce that we are about to sleep in ipc_recv.  Returns 0 if
+// requests arrived meanwhile, in which case the server should keep
+// serving.  A wakeup IPC the client already committed to sending is
+// then simply received later.
+int
+ipcring_server_sleep(struct Ipcring_server *sv)
+{
+	xchg(&sv->sv_ring->ir_server_sleeping, 1);
+	if (sv->sv_ring->ir_req_prod != sv->sv_req_cons) {
+		xchg(&sv->sv_ring->ir_server_sleeping, 0);
+		return 0;
+	}
+	return 1;
+}
@@ -41,7 +41,9 @@ execv(const char *prog, const char **argv, bool fork)
 	int fd, i, r;
 	struct Elf *elf;
 	struct Proghdr *ph;
-	int perm;
+	struct Fsimage_seg segs[FSIMAGE_NSEG];
+	envid_t pager;
+	int perm, nseg, cookie;
 
 	// This code follows this procedure:
 	//
@@ -125,7 +127,12 @@ execv(const char *prog, const char **argv, bool fork)
 	if ((r = init_stack(child, argv, &child_tf.tf_esp)) < 0)
 		return r;
 
-	// Set up program segments as defined in ELF header.
+	// Set up program segments as defined in ELF header.  The file
+	// server pages in the program proper as the child touches it (see
+	// file_image), sharing read-only pages straight from its block
+	// cache.  The debugging info below UTEXT, and everything if the
+	// file server can't page it, is loaded now.
+	nseg = 0;
 	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
 	for (i = 0; i < elf->e_phnum; i++, ph++) {
 		if (ph->p_type != ELF_PROG_LOAD)
@@ -133,10 +140,30 @@ execv(const char *prog, const char **argv, bool fork)
 		perm = PTE_P | PTE_U;
 		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
 			perm |= PTE_W;
+		if (ph->p_va >= UTEXT && nseg < FSIMAGE_NSEG) {
+			segs[nseg].seg_va = ph->p_va;
+			segs[nseg].seg_memsz = ph->p_memsz;
+			segs[nseg].seg_filesz = ph->p_filesz;
+			segs[nseg].seg_offset = ph->p_offset;
+			segs[nseg].seg_perm = perm;
+			nseg++;
+			continue;
+		}
 		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
 				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
 			goto error;
 	}
+
+	pager = cookie = 0;
+	if (nseg > 0 && (cookie = file_image(fd, segs, nseg, &pager)) < 0)
+		pager = cookie = 0;
+	for (i = 0; !pager && i < nseg; i++)
+		if ((r = map_segment(child, segs[i].seg_va, segs[i].seg_memsz,
+				     fd, segs[i].seg_filesz,
+				     segs[i].seg_offset, segs[i].seg_perm)) < 0)
+			goto error;
+	if ((r = sys_env_set_pager(child, pager, cookie)) < 0)
+		goto error;
 	close(fd);
 	fd = -1;
 
@@ -351,6 +378,7 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
 }
 
 // Copy the mappings for shared pages into the child address space.
+// The mappings are made in batches (see dupq_map in lib/fork.c).
 static int
 copy_shared_pages(envid_t child)
 {
@@ -358,8 +386,19 @@ copy_shared_pages(envid_t child)
 	int r;
 	uint32_t i, j, pn;
 
+	if ((r = dupq_begin()) < 0)
+		return r;
+
 	// Copy shared address space to child
 	for (i = PDX(UTEXT); i < PDX(UXSTACKTOP); i++) {
+		if ((vpd[i] & PTE_P) && (vpd[i] & PTE_PS)) { // 4MB page
+			if ((vpd[i] & PTE_SHARE) &&
+			    (r = dupq_map(0, PGNUM(PGADDR(i, 0, 0)), child,
+					  (vpd[i] & PTE_SYSCALL) | PTE_PS)) < 0)
+				goto out;
+			continue;
+		}
+
 		if (vpd[i] & PTE_P) { // If page table present
 			for (j = 0; j < NPTENTRIES; j++) {	
 				pn = PGNUM(PGADDR(i, j, 0));
@@ -368,20 +407,19 @@ copy_shared_pages(envid_t child)
 				}
 
 				if ((vpt[pn] & PTE_P) && 
-				    (vpt[pn] & PTE_SHARE)) {
-					if ((r = sys_page_map(0, 
-							      (void *) (pn * PGSIZE), 
-							      child, 
-							      (void *) (pn * PGSIZE), 
-							      vpt[pn] & PTE_SYSCALL)) < 0) {
-			return r;
-		}
-
-				}			
+				    (vpt[pn] & PTE_SHARE) &&
+				    (r = dupq_map(0, pn, child,
+						  vpt[pn] & PTE_SYSCALL)) < 0)
+					goto out;
 			}
 		}
 	}
 
-	return 0;
+out:
+	if (r < 0) {
+		dupq_end();
+		return r;
+	}
+	return dupq_end();
 }
 
@@ -2,6 +2,7 @@
 
 #include <inc/syscall.h>
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 static inline int32_t
 syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
@@ -37,6 +38,42 @@ syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	return ret;
 }
 
+// Fast system call through sysenter, for the hot paths.  Arguments are
+// passed as for syscall(), except that %esi holds the return address and
+// %ebp the stack pointer, so the fifth argument goes on the stack where
+// the kernel finds it at 4(%ebp).  The kernel's sysexit clobbers %ecx
+// and %edx.  Falls back to syscall() if the kernel didn't set up
+// sysenter on every CPU.
+static inline int32_t
+fast_syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	int32_t ret;
+
+	if (!((const struct Clock_page *) UCLOCK)->cp_sysenter)
+		return syscall(num, check, a1, a2, a3, a4, a5);
+
+	asm volatile("pushl %[a5]\n\t"
+		     "pushl %%ebp\n\t"
+		     "movl %%esp, %%ebp\n\t"
+		     "leal 1f, %%esi\n\t"
+		     "sysenter\n"
+		     "1:\tpopl %%ebp\n\t"
+		     "addl $4, %%esp"
+		: "=a" (ret),
+		  "+d" (a1),
+		  "+c" (a2)
+		: "a" (num),
+		  "b" (a3),
+		  "D" (a4),
+		  [a5] "g" (a5)
+		: "esi", "cc", "memory");
+
+	if(check && ret > 0)
+		panic("syscall %d returned %d (> 0)", num, ret);
+
+	return ret;
+}
+
 void
 sys_cputs(const char *s, size_t len)
 {
@@ -64,7 +101,7 @@ sys_getenvid(void)
 void
 sys_yield(void)
 {
-	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+	fast_syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
 }
 
 int
@@ -76,7 +113,7 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 int
 sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
 {
-	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+	return fast_syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
 }
 
 int
@@ -87,6 +124,12 @@ sys_page_unmap(envid_t envid, void *va)
 
 // sys_exofork is inlined in lib.h
 
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
 int
 sys_env_set_status(envid_t envid, int status)
 {
@@ -99,6 +142,18 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
 	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
 }
 
+int
+sys_env_set_cow(envid_t envid, bool in_kernel)
+{
+	return syscall(SYS_env_set_cow, 1, envid, in_kernel, 0, 0, 0);
+}
+
+envid_t
+sys_env_service(enum EnvType type)
+{
+	return syscall(SYS_env_service, 0, type, 0, 0, 0, 0);
+}
+
 int
 sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 {
@@ -108,19 +163,47 @@ sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 int
 sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
 {
-	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+	return fast_syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
 }
 
 int
 sys_ipc_recv(void *dstva)
 {
-	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+	return fast_syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+	return fast_syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, 0);
 }
 
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *srcva, int perm, void *dstva)
+{
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) srcva, perm,
+		       (uint32_t) dstva);
+}
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *srcva, int perm,
+		   void *dstva)
+{
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) srcva,
+		       perm, (uint32_t) dstva);
+}
+
+// Read the time from the kernel's clock page at UCLOCK instead of
+// trapping; SYS_time_msec returns the same value.
 unsigned int
 sys_time_msec(void)
 {
-	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+	const volatile struct Clock_page *cp =
+		(const volatile struct Clock_page *) UCLOCK;
+
+	if (cp->cp_tsc_per_msec)
+		return (read_tsc() - cp->cp_tsc_boot) / cp->cp_tsc_per_msec;
+	return cp->cp_msec;
 }
 
 int
@@ -141,6 +224,18 @@ sys_net_try_receive(char *data, int *len)
 	return syscall(SYS_net_try_receive, 1, (uint32_t) data, (uint32_t) len, 0, 0, 0); 
 }
 
+int
+sys_net_recv_page(void *va)
+{
+	return syscall(SYS_net_recv_page, 0, (uint32_t) va, 0, 0, 0, 0);
+}
+
+int
+sys_net_wait(void)
+{
+	return syscall(SYS_net_wait, 0, 0, 0, 0, 0, 0);
+}
+
 int
 sys_get_mac(uint32_t *low, uint32_t *high) 
 {
@@ -174,6 +269,14 @@ sys_env_unsuspend(envid_t envid, uint32_t status, uint32_t value)
 int
 sys_migrate(void *thisenv)
 {
+	extern char end[];
+	uintptr_t va;
+
+	// Touch any pages of our image that are still left to our pager,
+	// which the node we move to cannot reach
+	for (va = UTEXT; va < (uintptr_t) end; va += PGSIZE)
+		(void) *(volatile char *) va;
+
 	return syscall(SYS_migrate, 1, (uint32_t) thisenv, 0, 0, 0, 0);
 }
 
@@ -188,3 +291,45 @@ sys_env_set_thisenv(envid_t envid, void *thisenv)
 {
 	return syscall(SYS_env_set_thisenv, 1, (uint32_t) envid,(uint32_t) thisenv, 0, 0, 0);
 }
+
+int
+sys_env_set_sched(envid_t envid, int sched_class, int param)
+{
+	return syscall(SYS_env_set_sched, 1, envid, sched_class, param, 0, 0);
+}
+
+int
+sys_batch(struct Syscall_desc *descs, int n)
+{
+	return syscall(SYS_batch, 0, (uint32_t) descs, n, 0, 0, 0);
+}
+
+int
+sys_env_stats(envid_t envid, struct Env_stats *buf)
+{
+	return syscall(SYS_env_stats, 0, envid, (uint32_t) buf, 0, 0, 0);
+}
+
+int
+sys_trace(uint32_t mask)
+{
+	return syscall(SYS_trace, 0, mask, 0, 0, 0, 0);
+}
+
+int
+sys_env_set_pager(envid_t envid, envid_t pager, uint32_t cookie)
+{
+	return syscall(SYS_env_set_pager, 1, envid, pager, cookie, 0, 0);
+}
+
+int
+sys_pager_retire(uint32_t cookie)
+{
+	return syscall(SYS_pager_retire, 0, cookie, 0, 0, 0, 0);
+}
+
+int
+sys_prof(int cmd, int arg, struct Prof_entry *buf)
+{
+	return syscall(SYS_prof, 0, cmd, arg, (uint32_t) buf, 0, 0);
+}
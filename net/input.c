@@ -13,23 +13,19 @@ input(envid_t ns_envid)
 	// Hint: When you IPC a page to the network server, it will be
 	// reading from it for a while, so don't immediately receive
 	// another packet in to the same physical page.	
-	char buf[2048];
-
-	int len, r, i;
+	int r;
 
 	while (1) {
-		while ((r = sys_net_try_receive(buf, &len)) < 0) {
-			sys_yield();
+		// The kernel maps the page the card received the packet
+		// into at nsipcbuf, replacing the last one, which the
+		// network server still holds.  The page is already laid
+		// out as the jif_pkt the server expects.  Sleep until the
+		// card interrupts, or poll if it can't.
+		while ((r = sys_net_recv_page(&nsipcbuf)) < 0) {
+			if (r != -E_RCV_EMPTY || sys_net_wait() < 0)
+				sys_yield();
 		}
 
-		// Whenever a new page is allocated, old will be deallocated
-		// by page_insert automatically.
-		while ((r = sys_page_alloc(0, &nsipcbuf, 
-					   PTE_U | PTE_P | PTE_W)) < 0);
-
-		nsipcbuf.pkt.jp_len = len;
-		memmove(nsipcbuf.pkt.jp_data, buf, len);
-
 		while ((r = sys_ipc_try_send(ns_envid, NSREQ_INPUT, &nsipcbuf, 
 					     PTE_P | PTE_W | PTE_U)) < 0);
 	}
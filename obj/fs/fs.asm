@@ -0,0 +1,8005 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 f5 22 00 00       	call   802326 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	89 c3                	mov    %eax,%ebx
+  800039:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80003e:	ec                   	in     (%dx),%al
+  80003f:	89 c1                	mov    %eax,%ecx
+  800041:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800044:	80 f9 40             	cmp    $0x40,%cl
+  800047:	75 f5                	jne    80003e <ide_wait_ready+0xb>
+  800049:	85 db                	test   %ebx,%ebx
+  80004b:	74 0a                	je     800057 <ide_wait_ready+0x24>
+  80004d:	a8 21                	test   $0x21,%al
+  80004f:	0f 95 c3             	setne  %bl
+  800052:	0f b6 db             	movzbl %bl,%ebx
+  800055:	f7 db                	neg    %ebx
+  800057:	89 d8                	mov    %ebx,%eax
+  800059:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <ide_probe_disk1>:
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	53                   	push   %ebx
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006a:	e8 c4 ff ff ff       	call   800033 <ide_wait_ready>
+  80006f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800074:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800079:	ee                   	out    %al,(%dx)
+  80007a:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80007f:	ec                   	in     (%dx),%al
+  800080:	a8 a1                	test   $0xa1,%al
+  800082:	74 41                	je     8000c5 <ide_probe_disk1+0x67>
+  800084:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800089:	83 c1 01             	add    $0x1,%ecx
+  80008c:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800092:	74 05                	je     800099 <ide_probe_disk1+0x3b>
+  800094:	ec                   	in     (%dx),%al
+  800095:	a8 a1                	test   $0xa1,%al
+  800097:	75 f0                	jne    800089 <ide_probe_disk1+0x2b>
+  800099:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  80009e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000a3:	ee                   	out    %al,(%dx)
+  8000a4:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000aa:	0f 9e c3             	setle  %bl
+  8000ad:	0f b6 db             	movzbl %bl,%ebx
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	53                   	push   %ebx
+  8000b4:	68 00 55 80 00       	push   $0x805500
+  8000b9:	e8 bc 23 00 00       	call   80247a <cprintf>
+  8000be:	89 d8                	mov    %ebx,%eax
+  8000c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000c3:	c9                   	leave
+  8000c4:	c3                   	ret
+  8000c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ca:	eb cd                	jmp    800099 <ide_probe_disk1+0x3b>
+
+008000cc <ide_set_disk>:
+  8000cc:	55                   	push   %ebp
+  8000cd:	89 e5                	mov    %esp,%ebp
+  8000cf:	83 ec 08             	sub    $0x8,%esp
+  8000d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000d5:	83 f8 01             	cmp    $0x1,%eax
+  8000d8:	77 07                	ja     8000e1 <ide_set_disk+0x15>
+  8000da:	a3 00 70 80 00       	mov    %eax,0x807000
+  8000df:	c9                   	leave
+  8000e0:	c3                   	ret
+  8000e1:	83 ec 04             	sub    $0x4,%esp
+  8000e4:	68 17 55 80 00       	push   $0x805517
+  8000e9:	6a 3a                	push   $0x3a
+  8000eb:	68 27 55 80 00       	push   $0x805527
+  8000f0:	e8 aa 22 00 00       	call   80239f <_panic>
+
+008000f5 <ide_read>:
+  8000f5:	55                   	push   %ebp
+  8000f6:	89 e5                	mov    %esp,%ebp
+  8000f8:	57                   	push   %edi
+  8000f9:	56                   	push   %esi
+  8000fa:	53                   	push   %ebx
+  8000fb:	83 ec 0c             	sub    $0xc,%esp
+  8000fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800101:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800104:	8b 75 10             	mov    0x10(%ebp),%esi
+  800107:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  80010d:	0f 87 96 00 00 00    	ja     8001a9 <ide_read+0xb4>
+  800113:	b8 00 00 00 00       	mov    $0x0,%eax
+  800118:	e8 16 ff ff ff       	call   800033 <ide_wait_ready>
+  80011d:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800122:	89 f0                	mov    %esi,%eax
+  800124:	ee                   	out    %al,(%dx)
+  800125:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  80012a:	89 f8                	mov    %edi,%eax
+  80012c:	ee                   	out    %al,(%dx)
+  80012d:	89 f8                	mov    %edi,%eax
+  80012f:	c1 e8 08             	shr    $0x8,%eax
+  800132:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800137:	ee                   	out    %al,(%dx)
+  800138:	89 f8                	mov    %edi,%eax
+  80013a:	c1 e8 10             	shr    $0x10,%eax
+  80013d:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800142:	ee                   	out    %al,(%dx)
+  800143:	0f b6 05 00 70 80 00 	movzbl 0x807000,%eax
+  80014a:	c1 e0 04             	shl    $0x4,%eax
+  80014d:	83 e0 10             	and    $0x10,%eax
+  800150:	c1 ef 18             	shr    $0x18,%edi
+  800153:	83 e7 0f             	and    $0xf,%edi
+  800156:	09 f8                	or     %edi,%eax
+  800158:	83 c8 e0             	or     $0xffffffe0,%eax
+  80015b:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800160:	ee                   	out    %al,(%dx)
+  800161:	b8 20 00 00 00       	mov    $0x20,%eax
+  800166:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80016b:	ee                   	out    %al,(%dx)
+  80016c:	85 f6                	test   %esi,%esi
+  80016e:	74 4f                	je     8001bf <ide_read+0xca>
+  800170:	c1 e6 09             	shl    $0x9,%esi
+  800173:	01 de                	add    %ebx,%esi
+  800175:	b8 01 00 00 00       	mov    $0x1,%eax
+  80017a:	e8 b4 fe ff ff       	call   800033 <ide_wait_ready>
+  80017f:	85 c0                	test   %eax,%eax
+  800181:	78 1e                	js     8001a1 <ide_read+0xac>
+  800183:	89 df                	mov    %ebx,%edi
+  800185:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80018a:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  80018f:	fc                   	cld
+  800190:	f2 6d                	repnz insl (%dx),%es:(%edi)
+  800192:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800198:	39 de                	cmp    %ebx,%esi
+  80019a:	75 d9                	jne    800175 <ide_read+0x80>
+  80019c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a4:	5b                   	pop    %ebx
+  8001a5:	5e                   	pop    %esi
+  8001a6:	5f                   	pop    %edi
+  8001a7:	5d                   	pop    %ebp
+  8001a8:	c3                   	ret
+  8001a9:	68 30 55 80 00       	push   $0x805530
+  8001ae:	68 3d 55 80 00       	push   $0x80553d
+  8001b3:	6a 43                	push   $0x43
+  8001b5:	68 27 55 80 00       	push   $0x805527
+  8001ba:	e8 e0 21 00 00       	call   80239f <_panic>
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	eb db                	jmp    8001a1 <ide_read+0xac>
+
+008001c6 <ide_write>:
+  8001c6:	55                   	push   %ebp
+  8001c7:	89 e5                	mov    %esp,%ebp
+  8001c9:	57                   	push   %edi
+  8001ca:	56                   	push   %esi
+  8001cb:	53                   	push   %ebx
+  8001cc:	83 ec 0c             	sub    $0xc,%esp
+  8001cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001d5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8001d8:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  8001de:	0f 87 96 00 00 00    	ja     80027a <ide_write+0xb4>
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e9:	e8 45 fe ff ff       	call   800033 <ide_wait_ready>
+  8001ee:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  8001f3:	89 f8                	mov    %edi,%eax
+  8001f5:	ee                   	out    %al,(%dx)
+  8001f6:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  8001fb:	89 f0                	mov    %esi,%eax
+  8001fd:	ee                   	out    %al,(%dx)
+  8001fe:	89 f0                	mov    %esi,%eax
+  800200:	c1 e8 08             	shr    $0x8,%eax
+  800203:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800208:	ee                   	out    %al,(%dx)
+  800209:	89 f0                	mov    %esi,%eax
+  80020b:	c1 e8 10             	shr    $0x10,%eax
+  80020e:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800213:	ee                   	out    %al,(%dx)
+  800214:	0f b6 05 00 70 80 00 	movzbl 0x807000,%eax
+  80021b:	c1 e0 04             	shl    $0x4,%eax
+  80021e:	83 e0 10             	and    $0x10,%eax
+  800221:	c1 ee 18             	shr    $0x18,%esi
+  800224:	83 e6 0f             	and    $0xf,%esi
+  800227:	09 f0                	or     %esi,%eax
+  800229:	83 c8 e0             	or     $0xffffffe0,%eax
+  80022c:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800231:	ee                   	out    %al,(%dx)
+  800232:	b8 30 00 00 00       	mov    $0x30,%eax
+  800237:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80023c:	ee                   	out    %al,(%dx)
+  80023d:	85 ff                	test   %edi,%edi
+  80023f:	74 4f                	je     800290 <ide_write+0xca>
+  800241:	c1 e7 09             	shl    $0x9,%edi
+  800244:	01 df                	add    %ebx,%edi
+  800246:	b8 01 00 00 00       	mov    $0x1,%eax
+  80024b:	e8 e3 fd ff ff       	call   800033 <ide_wait_ready>
+  800250:	85 c0                	test   %eax,%eax
+  800252:	78 1e                	js     800272 <ide_write+0xac>
+  800254:	89 de                	mov    %ebx,%esi
+  800256:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80025b:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800260:	fc                   	cld
+  800261:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+  800263:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800269:	39 df                	cmp    %ebx,%edi
+  80026b:	75 d9                	jne    800246 <ide_write+0x80>
+  80026d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800275:	5b                   	pop    %ebx
+  800276:	5e                   	pop    %esi
+  800277:	5f                   	pop    %edi
+  800278:	5d                   	pop    %ebp
+  800279:	c3                   	ret
+  80027a:	68 30 55 80 00       	push   $0x805530
+  80027f:	68 3d 55 80 00       	push   $0x80553d
+  800284:	6a 5c                	push   $0x5c
+  800286:	68 27 55 80 00       	push   $0x805527
+  80028b:	e8 0f 21 00 00       	call   80239f <_panic>
+  800290:	b8 00 00 00 00       	mov    $0x0,%eax
+  800295:	eb db                	jmp    800272 <ide_write+0xac>
+
+00800297 <bc_pgfault>:
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	57                   	push   %edi
+  80029b:	56                   	push   %esi
+  80029c:	53                   	push   %ebx
+  80029d:	83 ec 0c             	sub    $0xc,%esp
+  8002a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002a3:	8b 01                	mov    (%ecx),%eax
+  8002a5:	8d 90 00 00 00 f0    	lea    -0x10000000(%eax),%edx
+  8002ab:	89 d7                	mov    %edx,%edi
+  8002ad:	c1 ef 0c             	shr    $0xc,%edi
+  8002b0:	8b 1d 20 d9 80 00    	mov    0x80d920,%ebx
+  8002b6:	8b 73 48             	mov    0x48(%ebx),%esi
+  8002b9:	89 c3                	mov    %eax,%ebx
+  8002bb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8002c1:	81 fa ff ff ff bf    	cmp    $0xbfffffff,%edx
+  8002c7:	77 7f                	ja     800348 <bc_pgfault+0xb1>
+  8002c9:	a1 14 c0 80 00       	mov    0x80c014,%eax
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	74 09                	je     8002db <bc_pgfault+0x44>
+  8002d2:	3b 78 04             	cmp    0x4(%eax),%edi
+  8002d5:	0f 83 88 00 00 00    	jae    800363 <bc_pgfault+0xcc>
+  8002db:	83 ec 04             	sub    $0x4,%esp
+  8002de:	68 07 0e 00 00       	push   $0xe07
+  8002e3:	53                   	push   %ebx
+  8002e4:	56                   	push   %esi
+  8002e5:	e8 e7 2c 00 00       	call   802fd1 <sys_page_alloc>
+  8002ea:	83 c4 10             	add    $0x10,%esp
+  8002ed:	85 c0                	test   %eax,%eax
+  8002ef:	0f 88 80 00 00 00    	js     800375 <bc_pgfault+0xde>
+  8002f5:	83 ec 04             	sub    $0x4,%esp
+  8002f8:	6a 08                	push   $0x8
+  8002fa:	53                   	push   %ebx
+  8002fb:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+  800302:	50                   	push   %eax
+  800303:	e8 ed fd ff ff       	call   8000f5 <ide_read>
+  800308:	83 c4 10             	add    $0x10,%esp
+  80030b:	85 c0                	test   %eax,%eax
+  80030d:	78 7a                	js     800389 <bc_pgfault+0xf2>
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 07 0e 00 00       	push   $0xe07
+  800317:	53                   	push   %ebx
+  800318:	56                   	push   %esi
+  800319:	53                   	push   %ebx
+  80031a:	56                   	push   %esi
+  80031b:	e8 f4 2c 00 00       	call   803014 <sys_page_map>
+  800320:	83 c4 20             	add    $0x20,%esp
+  800323:	85 c0                	test   %eax,%eax
+  800325:	78 76                	js     80039d <bc_pgfault+0x106>
+  800327:	83 3d 10 c0 80 00 00 	cmpl   $0x0,0x80c010
+  80032e:	74 10                	je     800340 <bc_pgfault+0xa9>
+  800330:	83 ec 0c             	sub    $0xc,%esp
+  800333:	57                   	push   %edi
+  800334:	e8 57 04 00 00       	call   800790 <block_is_free>
+  800339:	83 c4 10             	add    $0x10,%esp
+  80033c:	85 c0                	test   %eax,%eax
+  80033e:	75 71                	jne    8003b1 <bc_pgfault+0x11a>
+  800340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800343:	5b                   	pop    %ebx
+  800344:	5e                   	pop    %esi
+  800345:	5f                   	pop    %edi
+  800346:	5d                   	pop    %ebp
+  800347:	c3                   	ret
+  800348:	83 ec 08             	sub    $0x8,%esp
+  80034b:	ff 71 04             	push   0x4(%ecx)
+  80034e:	50                   	push   %eax
+  80034f:	ff 71 28             	push   0x28(%ecx)
+  800352:	68 54 55 80 00       	push   $0x805554
+  800357:	6a 29                	push   $0x29
+  800359:	68 dc 56 80 00       	push   $0x8056dc
+  80035e:	e8 3c 20 00 00       	call   80239f <_panic>
+  800363:	57                   	push   %edi
+  800364:	68 84 55 80 00       	push   $0x805584
+  800369:	6a 2e                	push   $0x2e
+  80036b:	68 dc 56 80 00       	push   $0x8056dc
+  800370:	e8 2a 20 00 00       	call   80239f <_panic>
+  800375:	83 ec 04             	sub    $0x4,%esp
+  800378:	68 a8 55 80 00       	push   $0x8055a8
+  80037d:	6a 37                	push   $0x37
+  80037f:	68 dc 56 80 00       	push   $0x8056dc
+  800384:	e8 16 20 00 00       	call   80239f <_panic>
+  800389:	83 ec 04             	sub    $0x4,%esp
+  80038c:	68 dc 55 80 00       	push   $0x8055dc
+  800391:	6a 3b                	push   $0x3b
+  800393:	68 dc 56 80 00       	push   $0x8056dc
+  800398:	e8 02 20 00 00       	call   80239f <_panic>
+  80039d:	83 ec 04             	sub    $0x4,%esp
+  8003a0:	68 04 56 80 00       	push   $0x805604
+  8003a5:	6a 3f                	push   $0x3f
+  8003a7:	68 dc 56 80 00       	push   $0x8056dc
+  8003ac:	e8 ee 1f 00 00       	call   80239f <_panic>
+  8003b1:	57                   	push   %edi
+  8003b2:	68 e4 56 80 00       	push   $0x8056e4
+  8003b7:	6a 46                	push   $0x46
+  8003b9:	68 dc 56 80 00       	push   $0x8056dc
+  8003be:	e8 dc 1f 00 00       	call   80239f <_panic>
+
+008003c3 <diskaddr>:
+  8003c3:	55                   	push   %ebp
+  8003c4:	89 e5                	mov    %esp,%ebp
+  8003c6:	83 ec 08             	sub    $0x8,%esp
+  8003c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cc:	85 c0                	test   %eax,%eax
+  8003ce:	74 19                	je     8003e9 <diskaddr+0x26>
+  8003d0:	8b 15 14 c0 80 00    	mov    0x80c014,%edx
+  8003d6:	85 d2                	test   %edx,%edx
+  8003d8:	74 05                	je     8003df <diskaddr+0x1c>
+  8003da:	3b 42 04             	cmp    0x4(%edx),%eax
+  8003dd:	73 0a                	jae    8003e9 <diskaddr+0x26>
+  8003df:	05 00 00 01 00       	add    $0x10000,%eax
+  8003e4:	c1 e0 0c             	shl    $0xc,%eax
+  8003e7:	c9                   	leave
+  8003e8:	c3                   	ret
+  8003e9:	50                   	push   %eax
+  8003ea:	68 38 56 80 00       	push   $0x805638
+  8003ef:	6a 09                	push   $0x9
+  8003f1:	68 dc 56 80 00       	push   $0x8056dc
+  8003f6:	e8 a4 1f 00 00       	call   80239f <_panic>
+
+008003fb <va_is_mapped>:
+  8003fb:	55                   	push   %ebp
+  8003fc:	89 e5                	mov    %esp,%ebp
+  8003fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800401:	89 d0                	mov    %edx,%eax
+  800403:	c1 e8 16             	shr    $0x16,%eax
+  800406:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80040d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800412:	f6 c1 01             	test   $0x1,%cl
+  800415:	74 0d                	je     800424 <va_is_mapped+0x29>
+  800417:	c1 ea 0c             	shr    $0xc,%edx
+  80041a:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  800421:	83 e0 01             	and    $0x1,%eax
+  800424:	5d                   	pop    %ebp
+  800425:	c3                   	ret
+
+00800426 <va_is_dirty>:
+  800426:	55                   	push   %ebp
+  800427:	89 e5                	mov    %esp,%ebp
+  800429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042c:	c1 e8 0c             	shr    $0xc,%eax
+  80042f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800436:	c1 e8 06             	shr    $0x6,%eax
+  800439:	83 e0 01             	and    $0x1,%eax
+  80043c:	5d                   	pop    %ebp
+  80043d:	c3                   	ret
+
+0080043e <bc_unshare>:
+  80043e:	55                   	push   %ebp
+  80043f:	89 e5                	mov    %esp,%ebp
+  800441:	53                   	push   %ebx
+  800442:	83 ec 10             	sub    $0x10,%esp
+  800445:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800448:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80044e:	53                   	push   %ebx
+  80044f:	e8 a7 ff ff ff       	call   8003fb <va_is_mapped>
+  800454:	83 c4 10             	add    $0x10,%esp
+  800457:	85 c0                	test   %eax,%eax
+  800459:	75 05                	jne    800460 <bc_unshare+0x22>
+  80045b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045e:	c9                   	leave
+  80045f:	c3                   	ret
+  800460:	83 ec 0c             	sub    $0xc,%esp
+  800463:	53                   	push   %ebx
+  800464:	e8 ef 42 00 00       	call   804758 <pageref>
+  800469:	89 c2                	mov    %eax,%edx
+  80046b:	83 c4 10             	add    $0x10,%esp
+  80046e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800473:	83 fa 01             	cmp    $0x1,%edx
+  800476:	7e e3                	jle    80045b <bc_unshare+0x1d>
+  800478:	83 ec 04             	sub    $0x4,%esp
+  80047b:	68 07 0e 00 00       	push   $0xe07
+  800480:	68 00 00 40 00       	push   $0x400000
+  800485:	6a 00                	push   $0x0
+  800487:	e8 45 2b 00 00       	call   802fd1 <sys_page_alloc>
+  80048c:	83 c4 10             	add    $0x10,%esp
+  80048f:	85 c0                	test   %eax,%eax
+  800491:	78 c8                	js     80045b <bc_unshare+0x1d>
+  800493:	83 ec 04             	sub    $0x4,%esp
+  800496:	68 00 10 00 00       	push   $0x1000
+  80049b:	53                   	push   %ebx
+  80049c:	68 00 00 40 00       	push   $0x400000
+  8004a1:	e8 7b 28 00 00       	call   802d21 <memmove>
+  8004a6:	c7 04 24 07 0e 00 00 	movl   $0xe07,(%esp)
+  8004ad:	53                   	push   %ebx
+  8004ae:	6a 00                	push   $0x0
+  8004b0:	68 00 00 40 00       	push   $0x400000
+  8004b5:	6a 00                	push   $0x0
+  8004b7:	e8 58 2b 00 00       	call   803014 <sys_page_map>
+  8004bc:	83 c4 20             	add    $0x20,%esp
+  8004bf:	85 c0                	test   %eax,%eax
+  8004c1:	78 98                	js     80045b <bc_unshare+0x1d>
+  8004c3:	83 ec 08             	sub    $0x8,%esp
+  8004c6:	68 00 00 40 00       	push   $0x400000
+  8004cb:	6a 00                	push   $0x0
+  8004cd:	e8 d1 2b 00 00       	call   8030a3 <sys_page_unmap>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+  8004d5:	eb 84                	jmp    80045b <bc_unshare+0x1d>
+
+008004d7 <flush_block>:
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	57                   	push   %edi
+  8004db:	56                   	push   %esi
+  8004dc:	53                   	push   %ebx
+  8004dd:	83 ec 0c             	sub    $0xc,%esp
+  8004e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004e3:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+  8004e9:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  8004ee:	8b 78 48             	mov    0x48(%eax),%edi
+  8004f1:	81 fe ff ff ff bf    	cmp    $0xbfffffff,%esi
+  8004f7:	77 18                	ja     800511 <flush_block+0x3a>
+  8004f9:	83 ec 0c             	sub    $0xc,%esp
+  8004fc:	53                   	push   %ebx
+  8004fd:	e8 f9 fe ff ff       	call   8003fb <va_is_mapped>
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	85 c0                	test   %eax,%eax
+  800507:	75 1a                	jne    800523 <flush_block+0x4c>
+  800509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80050c:	5b                   	pop    %ebx
+  80050d:	5e                   	pop    %esi
+  80050e:	5f                   	pop    %edi
+  80050f:	5d                   	pop    %ebp
+  800510:	c3                   	ret
+  800511:	53                   	push   %ebx
+  800512:	68 fd 56 80 00       	push   $0x8056fd
+  800517:	6a 6d                	push   $0x6d
+  800519:	68 dc 56 80 00       	push   $0x8056dc
+  80051e:	e8 7c 1e 00 00       	call   80239f <_panic>
+  800523:	83 ec 0c             	sub    $0xc,%esp
+  800526:	53                   	push   %ebx
+  800527:	e8 fa fe ff ff       	call   800426 <va_is_dirty>
+  80052c:	83 c4 10             	add    $0x10,%esp
+  80052f:	85 c0                	test   %eax,%eax
+  800531:	74 d6                	je     800509 <flush_block+0x32>
+  800533:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  800539:	83 ec 04             	sub    $0x4,%esp
+  80053c:	6a 08                	push   $0x8
+  80053e:	53                   	push   %ebx
+  80053f:	c1 ee 0c             	shr    $0xc,%esi
+  800542:	c1 e6 03             	shl    $0x3,%esi
+  800545:	56                   	push   %esi
+  800546:	e8 7b fc ff ff       	call   8001c6 <ide_write>
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	85 c0                	test   %eax,%eax
+  800550:	78 2c                	js     80057e <flush_block+0xa7>
+  800552:	83 ec 0c             	sub    $0xc,%esp
+  800555:	68 07 0e 00 00       	push   $0xe07
+  80055a:	53                   	push   %ebx
+  80055b:	57                   	push   %edi
+  80055c:	53                   	push   %ebx
+  80055d:	57                   	push   %edi
+  80055e:	e8 b1 2a 00 00       	call   803014 <sys_page_map>
+  800563:	83 c4 20             	add    $0x20,%esp
+  800566:	85 c0                	test   %eax,%eax
+  800568:	79 9f                	jns    800509 <flush_block+0x32>
+  80056a:	83 ec 04             	sub    $0x4,%esp
+  80056d:	68 84 56 80 00       	push   $0x805684
+  800572:	6a 79                	push   $0x79
+  800574:	68 dc 56 80 00       	push   $0x8056dc
+  800579:	e8 21 1e 00 00       	call   80239f <_panic>
+  80057e:	83 ec 04             	sub    $0x4,%esp
+  800581:	68 5c 56 80 00       	push   $0x80565c
+  800586:	6a 75                	push   $0x75
+  800588:	68 dc 56 80 00       	push   $0x8056dc
+  80058d:	e8 0d 1e 00 00       	call   80239f <_panic>
+
+00800592 <check_bc>:
+  800592:	55                   	push   %ebp
+  800593:	89 e5                	mov    %esp,%ebp
+  800595:	81 ec 24 01 00 00    	sub    $0x124,%esp
+  80059b:	6a 01                	push   $0x1
+  80059d:	e8 21 fe ff ff       	call   8003c3 <diskaddr>
+  8005a2:	83 c4 0c             	add    $0xc,%esp
+  8005a5:	68 08 01 00 00       	push   $0x108
+  8005aa:	50                   	push   %eax
+  8005ab:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005b1:	50                   	push   %eax
+  8005b2:	e8 6a 27 00 00       	call   802d21 <memmove>
+  8005b7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8005be:	e8 00 fe ff ff       	call   8003c3 <diskaddr>
+  8005c3:	83 c4 08             	add    $0x8,%esp
+  8005c6:	68 18 57 80 00       	push   $0x805718
+  8005cb:	50                   	push   %eax
+  8005cc:	e8 a0 25 00 00       	call   802b71 <strcpy>
+  8005d1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8005d8:	e8 e6 fd ff ff       	call   8003c3 <diskaddr>
+  8005dd:	89 04 24             	mov    %eax,(%esp)
+  8005e0:	e8 f2 fe ff ff       	call   8004d7 <flush_block>
+  8005e5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8005ec:	e8 d2 fd ff ff       	call   8003c3 <diskaddr>
+  8005f1:	89 04 24             	mov    %eax,(%esp)
+  8005f4:	e8 02 fe ff ff       	call   8003fb <va_is_mapped>
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	85 c0                	test   %eax,%eax
+  8005fe:	0f 84 b8 00 00 00    	je     8006bc <check_bc+0x12a>
+  800604:	83 ec 0c             	sub    $0xc,%esp
+  800607:	6a 01                	push   $0x1
+  800609:	e8 b5 fd ff ff       	call   8003c3 <diskaddr>
+  80060e:	89 04 24             	mov    %eax,(%esp)
+  800611:	e8 10 fe ff ff       	call   800426 <va_is_dirty>
+  800616:	83 c4 10             	add    $0x10,%esp
+  800619:	85 c0                	test   %eax,%eax
+  80061b:	0f 85 b4 00 00 00    	jne    8006d5 <check_bc+0x143>
+  800621:	83 ec 0c             	sub    $0xc,%esp
+  800624:	6a 01                	push   $0x1
+  800626:	e8 98 fd ff ff       	call   8003c3 <diskaddr>
+  80062b:	83 c4 08             	add    $0x8,%esp
+  80062e:	50                   	push   %eax
+  80062f:	6a 00                	push   $0x0
+  800631:	e8 6d 2a 00 00       	call   8030a3 <sys_page_unmap>
+  800636:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80063d:	e8 81 fd ff ff       	call   8003c3 <diskaddr>
+  800642:	89 04 24             	mov    %eax,(%esp)
+  800645:	e8 b1 fd ff ff       	call   8003fb <va_is_mapped>
+  80064a:	83 c4 10             	add    $0x10,%esp
+  80064d:	85 c0                	test   %eax,%eax
+  80064f:	0f 85 99 00 00 00    	jne    8006ee <check_bc+0x15c>
+  800655:	83 ec 0c             	sub    $0xc,%esp
+  800658:	6a 01                	push   $0x1
+  80065a:	e8 64 fd ff ff       	call   8003c3 <diskaddr>
+  80065f:	83 c4 08             	add    $0x8,%esp
+  800662:	68 18 57 80 00       	push   $0x805718
+  800667:	50                   	push   %eax
+  800668:	e8 b4 25 00 00       	call   802c21 <strcmp>
+  80066d:	83 c4 10             	add    $0x10,%esp
+  800670:	85 c0                	test   %eax,%eax
+  800672:	0f 85 8f 00 00 00    	jne    800707 <check_bc+0x175>
+  800678:	83 ec 0c             	sub    $0xc,%esp
+  80067b:	6a 01                	push   $0x1
+  80067d:	e8 41 fd ff ff       	call   8003c3 <diskaddr>
+  800682:	83 c4 0c             	add    $0xc,%esp
+  800685:	68 08 01 00 00       	push   $0x108
+  80068a:	8d 95 f0 fe ff ff    	lea    -0x110(%ebp),%edx
+  800690:	52                   	push   %edx
+  800691:	50                   	push   %eax
+  800692:	e8 8a 26 00 00       	call   802d21 <memmove>
+  800697:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80069e:	e8 20 fd ff ff       	call   8003c3 <diskaddr>
+  8006a3:	89 04 24             	mov    %eax,(%esp)
+  8006a6:	e8 2c fe ff ff       	call   8004d7 <flush_block>
+  8006ab:	c7 04 24 54 57 80 00 	movl   $0x805754,(%esp)
+  8006b2:	e8 c3 1d 00 00       	call   80247a <cprintf>
+  8006b7:	83 c4 10             	add    $0x10,%esp
+  8006ba:	c9                   	leave
+  8006bb:	c3                   	ret
+  8006bc:	68 3a 57 80 00       	push   $0x80573a
+  8006c1:	68 3d 55 80 00       	push   $0x80553d
+  8006c6:	68 8a 00 00 00       	push   $0x8a
+  8006cb:	68 dc 56 80 00       	push   $0x8056dc
+  8006d0:	e8 ca 1c 00 00       	call   80239f <_panic>
+  8006d5:	68 1f 57 80 00       	push   $0x80571f
+  8006da:	68 3d 55 80 00       	push   $0x80553d
+  8006df:	68 8b 00 00 00       	push   $0x8b
+  8006e4:	68 dc 56 80 00       	push   $0x8056dc
+  8006e9:	e8 b1 1c 00 00       	call   80239f <_panic>
+  8006ee:	68 39 57 80 00       	push   $0x805739
+  8006f3:	68 3d 55 80 00       	push   $0x80553d
+  8006f8:	68 8f 00 00 00       	push   $0x8f
+  8006fd:	68 dc 56 80 00       	push   $0x8056dc
+  800702:	e8 98 1c 00 00       	call   80239f <_panic>
+  800707:	68 b8 56 80 00       	push   $0x8056b8
+  80070c:	68 3d 55 80 00       	push   $0x80553d
+  800711:	68 92 00 00 00       	push   $0x92
+  800716:	68 dc 56 80 00       	push   $0x8056dc
+  80071b:	e8 7f 1c 00 00       	call   80239f <_panic>
+
+00800720 <bc_init>:
+  800720:	55                   	push   %ebp
+  800721:	89 e5                	mov    %esp,%ebp
+  800723:	83 ec 14             	sub    $0x14,%esp
+  800726:	68 97 02 80 00       	push   $0x800297
+  80072b:	e8 0f 31 00 00       	call   80383f <set_pgfault_handler>
+  800730:	e8 5d fe ff ff       	call   800592 <check_bc>
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	c9                   	leave
+  800739:	c3                   	ret
+
+0080073a <check_super>:
+  80073a:	55                   	push   %ebp
+  80073b:	89 e5                	mov    %esp,%ebp
+  80073d:	83 ec 08             	sub    $0x8,%esp
+  800740:	a1 14 c0 80 00       	mov    0x80c014,%eax
+  800745:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  80074b:	75 1b                	jne    800768 <check_super+0x2e>
+  80074d:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  800754:	77 26                	ja     80077c <check_super+0x42>
+  800756:	83 ec 0c             	sub    $0xc,%esp
+  800759:	68 a7 57 80 00       	push   $0x8057a7
+  80075e:	e8 17 1d 00 00       	call   80247a <cprintf>
+  800763:	83 c4 10             	add    $0x10,%esp
+  800766:	c9                   	leave
+  800767:	c3                   	ret
+  800768:	83 ec 04             	sub    $0x4,%esp
+  80076b:	68 69 57 80 00       	push   $0x805769
+  800770:	6a 0e                	push   $0xe
+  800772:	68 86 57 80 00       	push   $0x805786
+  800777:	e8 23 1c 00 00       	call   80239f <_panic>
+  80077c:	83 ec 04             	sub    $0x4,%esp
+  80077f:	68 8e 57 80 00       	push   $0x80578e
+  800784:	6a 11                	push   $0x11
+  800786:	68 86 57 80 00       	push   $0x805786
+  80078b:	e8 0f 1c 00 00       	call   80239f <_panic>
+
+00800790 <block_is_free>:
+  800790:	55                   	push   %ebp
+  800791:	89 e5                	mov    %esp,%ebp
+  800793:	53                   	push   %ebx
+  800794:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800797:	a1 14 c0 80 00       	mov    0x80c014,%eax
+  80079c:	85 c0                	test   %eax,%eax
+  80079e:	74 2c                	je     8007cc <block_is_free+0x3c>
+  8007a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007a5:	3b 48 04             	cmp    0x4(%eax),%ecx
+  8007a8:	73 1b                	jae    8007c5 <block_is_free+0x35>
+  8007aa:	89 cb                	mov    %ecx,%ebx
+  8007ac:	c1 eb 05             	shr    $0x5,%ebx
+  8007af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007b4:	d3 e0                	shl    %cl,%eax
+  8007b6:	8b 15 10 c0 80 00    	mov    0x80c010,%edx
+  8007bc:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  8007bf:	0f 95 c2             	setne  %dl
+  8007c2:	0f b6 d2             	movzbl %dl,%edx
+  8007c5:	89 d0                	mov    %edx,%eax
+  8007c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ca:	c9                   	leave
+  8007cb:	c3                   	ret
+  8007cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d1:	eb f2                	jmp    8007c5 <block_is_free+0x35>
+
+008007d3 <free_block>:
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	53                   	push   %ebx
+  8007d7:	83 ec 04             	sub    $0x4,%esp
+  8007da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007dd:	85 c9                	test   %ecx,%ecx
+  8007df:	74 1a                	je     8007fb <free_block+0x28>
+  8007e1:	89 cb                	mov    %ecx,%ebx
+  8007e3:	c1 eb 05             	shr    $0x5,%ebx
+  8007e6:	8b 15 10 c0 80 00    	mov    0x80c010,%edx
+  8007ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007f1:	d3 e0                	shl    %cl,%eax
+  8007f3:	09 04 9a             	or     %eax,(%edx,%ebx,4)
+  8007f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f9:	c9                   	leave
+  8007fa:	c3                   	ret
+  8007fb:	83 ec 04             	sub    $0x4,%esp
+  8007fe:	68 bb 57 80 00       	push   $0x8057bb
+  800803:	6a 2c                	push   $0x2c
+  800805:	68 86 57 80 00       	push   $0x805786
+  80080a:	e8 90 1b 00 00       	call   80239f <_panic>
+
+0080080f <alloc_block>:
+  80080f:	55                   	push   %ebp
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	57                   	push   %edi
+  800813:	56                   	push   %esi
+  800814:	53                   	push   %ebx
+  800815:	83 ec 1c             	sub    $0x1c,%esp
+  800818:	a1 14 c0 80 00       	mov    0x80c014,%eax
+  80081d:	8b 40 04             	mov    0x4(%eax),%eax
+  800820:	89 c7                	mov    %eax,%edi
+  800822:	c1 ef 05             	shr    $0x5,%edi
+  800825:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800828:	83 f8 1f             	cmp    $0x1f,%eax
+  80082b:	0f 86 80 00 00 00    	jbe    8008b1 <alloc_block+0xa2>
+  800831:	8b 3d 10 c0 80 00    	mov    0x80c010,%edi
+  800837:	be 00 00 00 00       	mov    $0x0,%esi
+  80083c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800841:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  800844:	8b 17                	mov    (%edi),%edx
+  800846:	89 d1                	mov    %edx,%ecx
+  800848:	83 e1 01             	and    $0x1,%ecx
+  80084b:	75 44                	jne    800891 <alloc_block+0x82>
+  80084d:	83 c1 01             	add    $0x1,%ecx
+  800850:	83 f9 20             	cmp    $0x20,%ecx
+  800853:	74 48                	je     80089d <alloc_block+0x8e>
+  800855:	89 d8                	mov    %ebx,%eax
+  800857:	d3 e0                	shl    %cl,%eax
+  800859:	85 d0                	test   %edx,%eax
+  80085b:	74 f0                	je     80084d <alloc_block+0x3e>
+  80085d:	f7 d0                	not    %eax
+  80085f:	21 d0                	and    %edx,%eax
+  800861:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800864:	89 07                	mov    %eax,(%edi)
+  800866:	c1 e6 05             	shl    $0x5,%esi
+  800869:	09 ce                	or     %ecx,%esi
+  80086b:	83 ec 0c             	sub    $0xc,%esp
+  80086e:	89 f0                	mov    %esi,%eax
+  800870:	c1 e8 0f             	shr    $0xf,%eax
+  800873:	83 c0 02             	add    $0x2,%eax
+  800876:	50                   	push   %eax
+  800877:	e8 47 fb ff ff       	call   8003c3 <diskaddr>
+  80087c:	89 04 24             	mov    %eax,(%esp)
+  80087f:	e8 53 fc ff ff       	call   8004d7 <flush_block>
+  800884:	89 f0                	mov    %esi,%eax
+  800886:	83 c4 10             	add    $0x10,%esp
+  800889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80088c:	5b                   	pop    %ebx
+  80088d:	5e                   	pop    %esi
+  80088e:	5f                   	pop    %edi
+  80088f:	5d                   	pop    %ebp
+  800890:	c3                   	ret
+  800891:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800896:	b8 01 00 00 00       	mov    $0x1,%eax
+  80089b:	eb c0                	jmp    80085d <alloc_block+0x4e>
+  80089d:	83 c6 01             	add    $0x1,%esi
+  8008a0:	83 c7 04             	add    $0x4,%edi
+  8008a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a6:	39 c6                	cmp    %eax,%esi
+  8008a8:	72 97                	jb     800841 <alloc_block+0x32>
+  8008aa:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8008af:	eb d8                	jmp    800889 <alloc_block+0x7a>
+  8008b1:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8008b6:	eb d1                	jmp    800889 <alloc_block+0x7a>
+
+008008b8 <file_block_walk>:
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	57                   	push   %edi
+  8008bc:	56                   	push   %esi
+  8008bd:	53                   	push   %ebx
+  8008be:	83 ec 0c             	sub    $0xc,%esp
+  8008c1:	89 c6                	mov    %eax,%esi
+  8008c3:	89 d3                	mov    %edx,%ebx
+  8008c5:	89 cf                	mov    %ecx,%edi
+  8008c7:	83 fa 09             	cmp    $0x9,%edx
+  8008ca:	77 16                	ja     8008e2 <file_block_walk+0x2a>
+  8008cc:	8d 84 90 88 00 00 00 	lea    0x88(%eax,%edx,4),%eax
+  8008d3:	89 01                	mov    %eax,(%ecx)
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008dd:	5b                   	pop    %ebx
+  8008de:	5e                   	pop    %esi
+  8008df:	5f                   	pop    %edi
+  8008e0:	5d                   	pop    %ebp
+  8008e1:	c3                   	ret
+  8008e2:	81 fa 09 04 00 00    	cmp    $0x409,%edx
+  8008e8:	77 54                	ja     80093e <file_block_walk+0x86>
+  8008ea:	83 b8 b0 00 00 00 00 	cmpl   $0x0,0xb0(%eax)
+  8008f1:	75 2d                	jne    800920 <file_block_walk+0x68>
+  8008f3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8008f7:	74 4c                	je     800945 <file_block_walk+0x8d>
+  8008f9:	e8 11 ff ff ff       	call   80080f <alloc_block>
+  8008fe:	89 86 b0 00 00 00    	mov    %eax,0xb0(%esi)
+  800904:	83 ec 0c             	sub    $0xc,%esp
+  800907:	50                   	push   %eax
+  800908:	e8 b6 fa ff ff       	call   8003c3 <diskaddr>
+  80090d:	83 c4 0c             	add    $0xc,%esp
+  800910:	68 00 10 00 00       	push   $0x1000
+  800915:	6a 00                	push   $0x0
+  800917:	50                   	push   %eax
+  800918:	e8 cf 23 00 00       	call   802cec <memset>
+  80091d:	83 c4 10             	add    $0x10,%esp
+  800920:	83 ec 0c             	sub    $0xc,%esp
+  800923:	ff b6 b0 00 00 00    	push   0xb0(%esi)
+  800929:	e8 95 fa ff ff       	call   8003c3 <diskaddr>
+  80092e:	8d 44 98 d8          	lea    -0x28(%eax,%ebx,4),%eax
+  800932:	89 07                	mov    %eax,(%edi)
+  800934:	83 c4 10             	add    $0x10,%esp
+  800937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093c:	eb 9c                	jmp    8008da <file_block_walk+0x22>
+  80093e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800943:	eb 95                	jmp    8008da <file_block_walk+0x22>
+  800945:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80094a:	eb 8e                	jmp    8008da <file_block_walk+0x22>
+
+0080094c <file_truncate_blocks>:
+  80094c:	55                   	push   %ebp
+  80094d:	89 e5                	mov    %esp,%ebp
+  80094f:	57                   	push   %edi
+  800950:	56                   	push   %esi
+  800951:	53                   	push   %ebx
+  800952:	83 ec 2c             	sub    $0x2c,%esp
+  800955:	89 c6                	mov    %eax,%esi
+  800957:	89 d0                	mov    %edx,%eax
+  800959:	8b 8e 80 00 00 00    	mov    0x80(%esi),%ecx
+  80095f:	8d 91 fe 1f 00 00    	lea    0x1ffe(%ecx),%edx
+  800965:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+  80096b:	0f 49 d1             	cmovns %ecx,%edx
+  80096e:	c1 fa 0c             	sar    $0xc,%edx
+  800971:	8d b8 fe 1f 00 00    	lea    0x1ffe(%eax),%edi
+  800977:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80097c:	0f 49 f8             	cmovns %eax,%edi
+  80097f:	c1 ff 0c             	sar    $0xc,%edi
+  800982:	39 d7                	cmp    %edx,%edi
+  800984:	73 12                	jae    800998 <file_truncate_blocks+0x4c>
+  800986:	89 fb                	mov    %edi,%ebx
+  800988:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80098b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  80098e:	89 d7                	mov    %edx,%edi
+  800990:	eb 4d                	jmp    8009df <file_truncate_blocks+0x93>
+  800992:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  800995:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800998:	83 ff 0a             	cmp    $0xa,%edi
+  80099b:	77 0a                	ja     8009a7 <file_truncate_blocks+0x5b>
+  80099d:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  8009a3:	85 c0                	test   %eax,%eax
+  8009a5:	75 08                	jne    8009af <file_truncate_blocks+0x63>
+  8009a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009aa:	5b                   	pop    %ebx
+  8009ab:	5e                   	pop    %esi
+  8009ac:	5f                   	pop    %edi
+  8009ad:	5d                   	pop    %ebp
+  8009ae:	c3                   	ret
+  8009af:	83 ec 0c             	sub    $0xc,%esp
+  8009b2:	50                   	push   %eax
+  8009b3:	e8 1b fe ff ff       	call   8007d3 <free_block>
+  8009b8:	c7 86 b0 00 00 00 00 	movl   $0x0,0xb0(%esi)
+  8009bf:	00 00 00 
+  8009c2:	83 c4 10             	add    $0x10,%esp
+  8009c5:	eb e0                	jmp    8009a7 <file_truncate_blocks+0x5b>
+  8009c7:	83 ec 08             	sub    $0x8,%esp
+  8009ca:	50                   	push   %eax
+  8009cb:	68 d6 57 80 00       	push   $0x8057d6
+  8009d0:	e8 a5 1a 00 00       	call   80247a <cprintf>
+  8009d5:	83 c4 10             	add    $0x10,%esp
+  8009d8:	83 c3 01             	add    $0x1,%ebx
+  8009db:	39 fb                	cmp    %edi,%ebx
+  8009dd:	73 b3                	jae    800992 <file_truncate_blocks+0x46>
+  8009df:	83 ec 0c             	sub    $0xc,%esp
+  8009e2:	6a 00                	push   $0x0
+  8009e4:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8009e7:	89 da                	mov    %ebx,%edx
+  8009e9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8009ec:	e8 c7 fe ff ff       	call   8008b8 <file_block_walk>
+  8009f1:	83 c4 10             	add    $0x10,%esp
+  8009f4:	85 c0                	test   %eax,%eax
+  8009f6:	78 cf                	js     8009c7 <file_truncate_blocks+0x7b>
+  8009f8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8009fb:	8b 06                	mov    (%esi),%eax
+  8009fd:	85 c0                	test   %eax,%eax
+  8009ff:	74 d7                	je     8009d8 <file_truncate_blocks+0x8c>
+  800a01:	83 ec 0c             	sub    $0xc,%esp
+  800a04:	50                   	push   %eax
+  800a05:	e8 c9 fd ff ff       	call   8007d3 <free_block>
+  800a0a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  800a10:	83 c4 10             	add    $0x10,%esp
+  800a13:	eb c3                	jmp    8009d8 <file_truncate_blocks+0x8c>
+
+00800a15 <check_bitmap>:
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	56                   	push   %esi
+  800a19:	53                   	push   %ebx
+  800a1a:	a1 14 c0 80 00       	mov    0x80c014,%eax
+  800a1f:	8b 70 04             	mov    0x4(%eax),%esi
+  800a22:	85 f6                	test   %esi,%esi
+  800a24:	74 24                	je     800a4a <check_bitmap+0x35>
+  800a26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a2b:	83 ec 0c             	sub    $0xc,%esp
+  800a2e:	8d 43 02             	lea    0x2(%ebx),%eax
+  800a31:	50                   	push   %eax
+  800a32:	e8 59 fd ff ff       	call   800790 <block_is_free>
+  800a37:	83 c4 10             	add    $0x10,%esp
+  800a3a:	85 c0                	test   %eax,%eax
+  800a3c:	75 45                	jne    800a83 <check_bitmap+0x6e>
+  800a3e:	83 c3 01             	add    $0x1,%ebx
+  800a41:	89 d8                	mov    %ebx,%eax
+  800a43:	c1 e0 0f             	shl    $0xf,%eax
+  800a46:	39 f0                	cmp    %esi,%eax
+  800a48:	72 e1                	jb     800a2b <check_bitmap+0x16>
+  800a4a:	83 ec 0c             	sub    $0xc,%esp
+  800a4d:	6a 00                	push   $0x0
+  800a4f:	e8 3c fd ff ff       	call   800790 <block_is_free>
+  800a54:	83 c4 10             	add    $0x10,%esp
+  800a57:	85 c0                	test   %eax,%eax
+  800a59:	75 3e                	jne    800a99 <check_bitmap+0x84>
+  800a5b:	83 ec 0c             	sub    $0xc,%esp
+  800a5e:	6a 01                	push   $0x1
+  800a60:	e8 2b fd ff ff       	call   800790 <block_is_free>
+  800a65:	83 c4 10             	add    $0x10,%esp
+  800a68:	85 c0                	test   %eax,%eax
+  800a6a:	75 43                	jne    800aaf <check_bitmap+0x9a>
+  800a6c:	83 ec 0c             	sub    $0xc,%esp
+  800a6f:	68 2b 58 80 00       	push   $0x80582b
+  800a74:	e8 01 1a 00 00       	call   80247a <cprintf>
+  800a79:	83 c4 10             	add    $0x10,%esp
+  800a7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a7f:	5b                   	pop    %ebx
+  800a80:	5e                   	pop    %esi
+  800a81:	5d                   	pop    %ebp
+  800a82:	c3                   	ret
+  800a83:	68 f3 57 80 00       	push   $0x8057f3
+  800a88:	68 3d 55 80 00       	push   $0x80553d
+  800a8d:	6a 5a                	push   $0x5a
+  800a8f:	68 86 57 80 00       	push   $0x805786
+  800a94:	e8 06 19 00 00       	call   80239f <_panic>
+  800a99:	68 07 58 80 00       	push   $0x805807
+  800a9e:	68 3d 55 80 00       	push   $0x80553d
+  800aa3:	6a 5d                	push   $0x5d
+  800aa5:	68 86 57 80 00       	push   $0x805786
+  800aaa:	e8 f0 18 00 00       	call   80239f <_panic>
+  800aaf:	68 19 58 80 00       	push   $0x805819
+  800ab4:	68 3d 55 80 00       	push   $0x80553d
+  800ab9:	6a 5e                	push   $0x5e
+  800abb:	68 86 57 80 00       	push   $0x805786
+  800ac0:	e8 da 18 00 00       	call   80239f <_panic>
+
+00800ac5 <fs_init>:
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	83 ec 08             	sub    $0x8,%esp
+  800acb:	e8 8e f5 ff ff       	call   80005e <ide_probe_disk1>
+  800ad0:	85 c0                	test   %eax,%eax
+  800ad2:	74 41                	je     800b15 <fs_init+0x50>
+  800ad4:	83 ec 0c             	sub    $0xc,%esp
+  800ad7:	6a 01                	push   $0x1
+  800ad9:	e8 ee f5 ff ff       	call   8000cc <ide_set_disk>
+  800ade:	83 c4 10             	add    $0x10,%esp
+  800ae1:	e8 3a fc ff ff       	call   800720 <bc_init>
+  800ae6:	83 ec 0c             	sub    $0xc,%esp
+  800ae9:	6a 01                	push   $0x1
+  800aeb:	e8 d3 f8 ff ff       	call   8003c3 <diskaddr>
+  800af0:	a3 14 c0 80 00       	mov    %eax,0x80c014
+  800af5:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  800afc:	e8 c2 f8 ff ff       	call   8003c3 <diskaddr>
+  800b01:	a3 10 c0 80 00       	mov    %eax,0x80c010
+  800b06:	e8 2f fc ff ff       	call   80073a <check_super>
+  800b0b:	e8 05 ff ff ff       	call   800a15 <check_bitmap>
+  800b10:	83 c4 10             	add    $0x10,%esp
+  800b13:	c9                   	leave
+  800b14:	c3                   	ret
+  800b15:	83 ec 0c             	sub    $0xc,%esp
+  800b18:	6a 00                	push   $0x0
+  800b1a:	e8 ad f5 ff ff       	call   8000cc <ide_set_disk>
+  800b1f:	83 c4 10             	add    $0x10,%esp
+  800b22:	eb bd                	jmp    800ae1 <fs_init+0x1c>
+
+00800b24 <file_get_block>:
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	53                   	push   %ebx
+  800b28:	83 ec 20             	sub    $0x20,%esp
+  800b2b:	6a 01                	push   $0x1
+  800b2d:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800b30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b36:	e8 7d fd ff ff       	call   8008b8 <file_block_walk>
+  800b3b:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  800b3e:	83 c4 10             	add    $0x10,%esp
+  800b41:	83 3b 00             	cmpl   $0x0,(%ebx)
+  800b44:	74 19                	je     800b5f <file_get_block+0x3b>
+  800b46:	83 ec 0c             	sub    $0xc,%esp
+  800b49:	ff 33                	push   (%ebx)
+  800b4b:	e8 73 f8 ff ff       	call   8003c3 <diskaddr>
+  800b50:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b53:	89 02                	mov    %eax,(%edx)
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b5d:	c9                   	leave
+  800b5e:	c3                   	ret
+  800b5f:	e8 ab fc ff ff       	call   80080f <alloc_block>
+  800b64:	89 03                	mov    %eax,(%ebx)
+  800b66:	eb de                	jmp    800b46 <file_get_block+0x22>
+
+00800b68 <walk_path>:
+  800b68:	55                   	push   %ebp
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	57                   	push   %edi
+  800b6c:	56                   	push   %esi
+  800b6d:	53                   	push   %ebx
+  800b6e:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  800b74:	89 95 44 ff ff ff    	mov    %edx,-0xbc(%ebp)
+  800b7a:	89 8d 40 ff ff ff    	mov    %ecx,-0xc0(%ebp)
+  800b80:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800b83:	75 08                	jne    800b8d <walk_path+0x25>
+  800b85:	83 c0 01             	add    $0x1,%eax
+  800b88:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800b8b:	74 f8                	je     800b85 <walk_path+0x1d>
+  800b8d:	8b 0d 14 c0 80 00    	mov    0x80c014,%ecx
+  800b93:	83 c1 08             	add    $0x8,%ecx
+  800b96:	89 8d 50 ff ff ff    	mov    %ecx,-0xb0(%ebp)
+  800b9c:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+  800ba3:	8b 8d 44 ff ff ff    	mov    -0xbc(%ebp),%ecx
+  800ba9:	85 c9                	test   %ecx,%ecx
+  800bab:	74 06                	je     800bb3 <walk_path+0x4b>
+  800bad:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  800bb3:	8b 8d 40 ff ff ff    	mov    -0xc0(%ebp),%ecx
+  800bb9:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  800bbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  800bca:	e9 bd 00 00 00       	jmp    800c8c <walk_path+0x124>
+  800bcf:	89 c6                	mov    %eax,%esi
+  800bd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd6:	e9 db 00 00 00       	jmp    800cb6 <walk_path+0x14e>
+  800bdb:	68 3b 58 80 00       	push   $0x80583b
+  800be0:	68 3d 55 80 00       	push   $0x80553d
+  800be5:	68 d8 00 00 00       	push   $0xd8
+  800bea:	68 86 57 80 00       	push   $0x805786
+  800bef:	e8 ab 17 00 00       	call   80239f <_panic>
+  800bf4:	8b b5 48 ff ff ff    	mov    -0xb8(%ebp),%esi
+  800bfa:	89 c3                	mov    %eax,%ebx
+  800bfc:	83 fb f5             	cmp    $0xfffffff5,%ebx
+  800bff:	75 5f                	jne    800c60 <walk_path+0xf8>
+  800c01:	80 3e 00             	cmpb   $0x0,(%esi)
+  800c04:	75 5a                	jne    800c60 <walk_path+0xf8>
+  800c06:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+  800c0c:	85 c0                	test   %eax,%eax
+  800c0e:	74 08                	je     800c18 <walk_path+0xb0>
+  800c10:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800c16:	89 08                	mov    %ecx,(%eax)
+  800c18:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800c1c:	74 15                	je     800c33 <walk_path+0xcb>
+  800c1e:	83 ec 08             	sub    $0x8,%esp
+  800c21:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800c27:	50                   	push   %eax
+  800c28:	ff 75 08             	push   0x8(%ebp)
+  800c2b:	e8 41 1f 00 00       	call   802b71 <strcpy>
+  800c30:	83 c4 10             	add    $0x10,%esp
+  800c33:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800c39:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  800c3f:	eb 1f                	jmp    800c60 <walk_path+0xf8>
+  800c41:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+  800c47:	85 c0                	test   %eax,%eax
+  800c49:	74 02                	je     800c4d <walk_path+0xe5>
+  800c4b:	89 08                	mov    %ecx,(%eax)
+  800c4d:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800c53:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800c59:	89 08                	mov    %ecx,(%eax)
+  800c5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c60:	89 d8                	mov    %ebx,%eax
+  800c62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+  800c6a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  800c6f:	eb ef                	jmp    800c60 <walk_path+0xf8>
+  800c71:	bb f5 ff ff ff       	mov    $0xfffffff5,%ebx
+  800c76:	eb e8                	jmp    800c60 <walk_path+0xf8>
+  800c78:	8b b5 48 ff ff ff    	mov    -0xb8(%ebp),%esi
+  800c7e:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800c84:	89 9d 50 ff ff ff    	mov    %ebx,-0xb0(%ebp)
+  800c8a:	89 f0                	mov    %esi,%eax
+  800c8c:	0f b6 10             	movzbl (%eax),%edx
+  800c8f:	84 d2                	test   %dl,%dl
+  800c91:	74 ae                	je     800c41 <walk_path+0xd9>
+  800c93:	80 fa 2f             	cmp    $0x2f,%dl
+  800c96:	0f 84 33 ff ff ff    	je     800bcf <walk_path+0x67>
+  800c9c:	89 c6                	mov    %eax,%esi
+  800c9e:	83 c6 01             	add    $0x1,%esi
+  800ca1:	0f b6 16             	movzbl (%esi),%edx
+  800ca4:	80 fa 2f             	cmp    $0x2f,%dl
+  800ca7:	74 04                	je     800cad <walk_path+0x145>
+  800ca9:	84 d2                	test   %dl,%dl
+  800cab:	75 f1                	jne    800c9e <walk_path+0x136>
+  800cad:	89 f3                	mov    %esi,%ebx
+  800caf:	29 c3                	sub    %eax,%ebx
+  800cb1:	83 fb 7f             	cmp    $0x7f,%ebx
+  800cb4:	7f b4                	jg     800c6a <walk_path+0x102>
+  800cb6:	83 ec 04             	sub    $0x4,%esp
+  800cb9:	53                   	push   %ebx
+  800cba:	50                   	push   %eax
+  800cbb:	57                   	push   %edi
+  800cbc:	e8 60 20 00 00       	call   802d21 <memmove>
+  800cc1:	c6 84 1d 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%ebx,1)
+  800cc8:	00 
+  800cc9:	83 c4 10             	add    $0x10,%esp
+  800ccc:	80 3e 2f             	cmpb   $0x2f,(%esi)
+  800ccf:	75 08                	jne    800cd9 <walk_path+0x171>
+  800cd1:	83 c6 01             	add    $0x1,%esi
+  800cd4:	80 3e 2f             	cmpb   $0x2f,(%esi)
+  800cd7:	74 f8                	je     800cd1 <walk_path+0x169>
+  800cd9:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  800cdf:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  800ce6:	75 89                	jne    800c71 <walk_path+0x109>
+  800ce8:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  800cee:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  800cf4:	0f 85 e1 fe ff ff    	jne    800bdb <walk_path+0x73>
+  800cfa:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  800d00:	85 d2                	test   %edx,%edx
+  800d02:	0f 49 c2             	cmovns %edx,%eax
+  800d05:	c1 f8 0c             	sar    $0xc,%eax
+  800d08:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800d0e:	74 7c                	je     800d8c <walk_path+0x224>
+  800d10:	c7 85 54 ff ff ff 00 	movl   $0x0,-0xac(%ebp)
+  800d17:	00 00 00 
+  800d1a:	89 b5 48 ff ff ff    	mov    %esi,-0xb8(%ebp)
+  800d20:	83 ec 04             	sub    $0x4,%esp
+  800d23:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  800d29:	50                   	push   %eax
+  800d2a:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  800d30:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  800d36:	e8 e9 fd ff ff       	call   800b24 <file_get_block>
+  800d3b:	83 c4 10             	add    $0x10,%esp
+  800d3e:	85 c0                	test   %eax,%eax
+  800d40:	0f 88 ae fe ff ff    	js     800bf4 <walk_path+0x8c>
+  800d46:	8b 9d 64 ff ff ff    	mov    -0x9c(%ebp),%ebx
+  800d4c:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  800d52:	83 ec 08             	sub    $0x8,%esp
+  800d55:	57                   	push   %edi
+  800d56:	53                   	push   %ebx
+  800d57:	e8 c5 1e 00 00       	call   802c21 <strcmp>
+  800d5c:	83 c4 10             	add    $0x10,%esp
+  800d5f:	85 c0                	test   %eax,%eax
+  800d61:	0f 84 11 ff ff ff    	je     800c78 <walk_path+0x110>
+  800d67:	81 c3 00 01 00 00    	add    $0x100,%ebx
+  800d6d:	39 f3                	cmp    %esi,%ebx
+  800d6f:	75 e1                	jne    800d52 <walk_path+0x1ea>
+  800d71:	83 85 54 ff ff ff 01 	addl   $0x1,-0xac(%ebp)
+  800d78:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  800d7e:	39 85 4c ff ff ff    	cmp    %eax,-0xb4(%ebp)
+  800d84:	75 9a                	jne    800d20 <walk_path+0x1b8>
+  800d86:	8b b5 48 ff ff ff    	mov    -0xb8(%ebp),%esi
+  800d8c:	bb f5 ff ff ff       	mov    $0xfffffff5,%ebx
+  800d91:	e9 66 fe ff ff       	jmp    800bfc <walk_path+0x94>
+
+00800d96 <file_open>:
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	83 ec 14             	sub    $0x14,%esp
+  800d9c:	6a 00                	push   $0x0
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da9:	e8 ba fd ff ff       	call   800b68 <walk_path>
+  800dae:	c9                   	leave
+  800daf:	c3                   	ret
+
+00800db0 <file_read>:
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  800db6:	83 ec 2c             	sub    $0x2c,%esp
+  800db9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800dbc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800dbf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc5:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  800dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd0:	39 da                	cmp    %ebx,%edx
+  800dd2:	0f 8e 85 00 00 00    	jle    800e5d <file_read+0xad>
+  800dd8:	29 da                	sub    %ebx,%edx
+  800dda:	39 ca                	cmp    %ecx,%edx
+  800ddc:	0f 46 ca             	cmovbe %edx,%ecx
+  800ddf:	89 ce                	mov    %ecx,%esi
+  800de1:	8d 0c 19             	lea    (%ecx,%ebx,1),%ecx
+  800de4:	39 cb                	cmp    %ecx,%ebx
+  800de6:	73 73                	jae    800e5b <file_read+0xab>
+  800de8:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  800deb:	89 de                	mov    %ebx,%esi
+  800ded:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800df0:	83 ec 04             	sub    $0x4,%esp
+  800df3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800df6:	50                   	push   %eax
+  800df7:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800dfd:	85 db                	test   %ebx,%ebx
+  800dff:	0f 49 c3             	cmovns %ebx,%eax
+  800e02:	c1 f8 0c             	sar    $0xc,%eax
+  800e05:	50                   	push   %eax
+  800e06:	ff 75 08             	push   0x8(%ebp)
+  800e09:	e8 16 fd ff ff       	call   800b24 <file_get_block>
+  800e0e:	83 c4 10             	add    $0x10,%esp
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	78 48                	js     800e5d <file_read+0xad>
+  800e15:	89 da                	mov    %ebx,%edx
+  800e17:	c1 fa 1f             	sar    $0x1f,%edx
+  800e1a:	c1 ea 14             	shr    $0x14,%edx
+  800e1d:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800e20:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800e25:	29 d0                	sub    %edx,%eax
+  800e27:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e2c:	29 c1                	sub    %eax,%ecx
+  800e2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800e31:	29 f2                	sub    %esi,%edx
+  800e33:	39 d1                	cmp    %edx,%ecx
+  800e35:	89 d6                	mov    %edx,%esi
+  800e37:	0f 46 f1             	cmovbe %ecx,%esi
+  800e3a:	83 ec 04             	sub    $0x4,%esp
+  800e3d:	56                   	push   %esi
+  800e3e:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800e41:	50                   	push   %eax
+  800e42:	57                   	push   %edi
+  800e43:	e8 d9 1e 00 00       	call   802d21 <memmove>
+  800e48:	01 f3                	add    %esi,%ebx
+  800e4a:	01 f7                	add    %esi,%edi
+  800e4c:	89 de                	mov    %ebx,%esi
+  800e4e:	83 c4 10             	add    $0x10,%esp
+  800e51:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800e54:	39 d3                	cmp    %edx,%ebx
+  800e56:	72 98                	jb     800df0 <file_read+0x40>
+  800e58:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800e5b:	89 f0                	mov    %esi,%eax
+  800e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+
+00800e65 <file_set_size>:
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	56                   	push   %esi
+  800e69:	53                   	push   %ebx
+  800e6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e6d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e70:	39 b3 80 00 00 00    	cmp    %esi,0x80(%ebx)
+  800e76:	7f 1b                	jg     800e93 <file_set_size+0x2e>
+  800e78:	89 b3 80 00 00 00    	mov    %esi,0x80(%ebx)
+  800e7e:	83 ec 0c             	sub    $0xc,%esp
+  800e81:	53                   	push   %ebx
+  800e82:	e8 50 f6 ff ff       	call   8004d7 <flush_block>
+  800e87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+  800e93:	89 f2                	mov    %esi,%edx
+  800e95:	89 d8                	mov    %ebx,%eax
+  800e97:	e8 b0 fa ff ff       	call   80094c <file_truncate_blocks>
+  800e9c:	eb da                	jmp    800e78 <file_set_size+0x13>
+
+00800e9e <file_write>:
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	57                   	push   %edi
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	83 ec 2c             	sub    $0x2c,%esp
+  800ea7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800eaa:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  800ead:	89 de                	mov    %ebx,%esi
+  800eaf:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+  800eb2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800eb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800eb8:	39 81 80 00 00 00    	cmp    %eax,0x80(%ecx)
+  800ebe:	0f 82 98 00 00 00    	jb     800f5c <file_write+0xbe>
+  800ec4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800ec7:	39 c6                	cmp    %eax,%esi
+  800ec9:	0f 83 83 00 00 00    	jae    800f52 <file_write+0xb4>
+  800ecf:	89 7d 10             	mov    %edi,0x10(%ebp)
+  800ed2:	83 ec 04             	sub    $0x4,%esp
+  800ed5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800ed8:	50                   	push   %eax
+  800ed9:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800edf:	85 db                	test   %ebx,%ebx
+  800ee1:	0f 49 c3             	cmovns %ebx,%eax
+  800ee4:	c1 f8 0c             	sar    $0xc,%eax
+  800ee7:	50                   	push   %eax
+  800ee8:	ff 75 08             	push   0x8(%ebp)
+  800eeb:	e8 34 fc ff ff       	call   800b24 <file_get_block>
+  800ef0:	83 c4 10             	add    $0x10,%esp
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	78 5d                	js     800f54 <file_write+0xb6>
+  800ef7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	57                   	push   %edi
+  800efe:	e8 3b f5 ff ff       	call   80043e <bc_unshare>
+  800f03:	83 c4 10             	add    $0x10,%esp
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	78 4a                	js     800f54 <file_write+0xb6>
+  800f0a:	89 da                	mov    %ebx,%edx
+  800f0c:	c1 fa 1f             	sar    $0x1f,%edx
+  800f0f:	c1 ea 14             	shr    $0x14,%edx
+  800f12:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800f15:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f1a:	29 d0                	sub    %edx,%eax
+  800f1c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f21:	29 c1                	sub    %eax,%ecx
+  800f23:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800f26:	29 f2                	sub    %esi,%edx
+  800f28:	39 d1                	cmp    %edx,%ecx
+  800f2a:	89 d6                	mov    %edx,%esi
+  800f2c:	0f 46 f1             	cmovbe %ecx,%esi
+  800f2f:	83 ec 04             	sub    $0x4,%esp
+  800f32:	56                   	push   %esi
+  800f33:	ff 75 0c             	push   0xc(%ebp)
+  800f36:	01 c7                	add    %eax,%edi
+  800f38:	57                   	push   %edi
+  800f39:	e8 e3 1d 00 00       	call   802d21 <memmove>
+  800f3e:	01 f3                	add    %esi,%ebx
+  800f40:	01 75 0c             	add    %esi,0xc(%ebp)
+  800f43:	89 de                	mov    %ebx,%esi
+  800f45:	83 c4 10             	add    $0x10,%esp
+  800f48:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800f4b:	39 d3                	cmp    %edx,%ebx
+  800f4d:	72 83                	jb     800ed2 <file_write+0x34>
+  800f4f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f52:	89 f8                	mov    %edi,%eax
+  800f54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5f                   	pop    %edi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	c3                   	ret
+  800f5c:	83 ec 08             	sub    $0x8,%esp
+  800f5f:	50                   	push   %eax
+  800f60:	51                   	push   %ecx
+  800f61:	e8 ff fe ff ff       	call   800e65 <file_set_size>
+  800f66:	83 c4 10             	add    $0x10,%esp
+  800f69:	85 c0                	test   %eax,%eax
+  800f6b:	0f 89 53 ff ff ff    	jns    800ec4 <file_write+0x26>
+  800f71:	eb e1                	jmp    800f54 <file_write+0xb6>
+
+00800f73 <file_flush>:
+  800f73:	55                   	push   %ebp
+  800f74:	89 e5                	mov    %esp,%ebp
+  800f76:	56                   	push   %esi
+  800f77:	53                   	push   %ebx
+  800f78:	83 ec 10             	sub    $0x10,%esp
+  800f7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f7e:	83 be 80 00 00 00 00 	cmpl   $0x0,0x80(%esi)
+  800f85:	7e 61                	jle    800fe8 <file_flush+0x75>
+  800f87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8c:	eb 1f                	jmp    800fad <file_flush+0x3a>
+  800f8e:	83 c3 01             	add    $0x1,%ebx
+  800f91:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+  800f97:	8d 82 fe 1f 00 00    	lea    0x1ffe(%edx),%eax
+  800f9d:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  800fa3:	0f 49 c2             	cmovns %edx,%eax
+  800fa6:	c1 f8 0c             	sar    $0xc,%eax
+  800fa9:	39 d8                	cmp    %ebx,%eax
+  800fab:	7e 3b                	jle    800fe8 <file_flush+0x75>
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+  800fb0:	6a 00                	push   $0x0
+  800fb2:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800fb5:	89 da                	mov    %ebx,%edx
+  800fb7:	89 f0                	mov    %esi,%eax
+  800fb9:	e8 fa f8 ff ff       	call   8008b8 <file_block_walk>
+  800fbe:	83 c4 10             	add    $0x10,%esp
+  800fc1:	85 c0                	test   %eax,%eax
+  800fc3:	78 c9                	js     800f8e <file_flush+0x1b>
+  800fc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800fc8:	85 c0                	test   %eax,%eax
+  800fca:	74 c2                	je     800f8e <file_flush+0x1b>
+  800fcc:	8b 00                	mov    (%eax),%eax
+  800fce:	85 c0                	test   %eax,%eax
+  800fd0:	74 bc                	je     800f8e <file_flush+0x1b>
+  800fd2:	83 ec 0c             	sub    $0xc,%esp
+  800fd5:	50                   	push   %eax
+  800fd6:	e8 e8 f3 ff ff       	call   8003c3 <diskaddr>
+  800fdb:	89 04 24             	mov    %eax,(%esp)
+  800fde:	e8 f4 f4 ff ff       	call   8004d7 <flush_block>
+  800fe3:	83 c4 10             	add    $0x10,%esp
+  800fe6:	eb a6                	jmp    800f8e <file_flush+0x1b>
+  800fe8:	83 ec 0c             	sub    $0xc,%esp
+  800feb:	56                   	push   %esi
+  800fec:	e8 e6 f4 ff ff       	call   8004d7 <flush_block>
+  800ff1:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  800ff7:	83 c4 10             	add    $0x10,%esp
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	75 07                	jne    801005 <file_flush+0x92>
+  800ffe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+  801005:	83 ec 0c             	sub    $0xc,%esp
+  801008:	50                   	push   %eax
+  801009:	e8 b5 f3 ff ff       	call   8003c3 <diskaddr>
+  80100e:	89 04 24             	mov    %eax,(%esp)
+  801011:	e8 c1 f4 ff ff       	call   8004d7 <flush_block>
+  801016:	83 c4 10             	add    $0x10,%esp
+  801019:	eb e3                	jmp    800ffe <file_flush+0x8b>
+
+0080101b <file_create>:
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  801027:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80102d:	50                   	push   %eax
+  80102e:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  801034:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  80103a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103d:	e8 26 fb ff ff       	call   800b68 <walk_path>
+  801042:	83 c4 10             	add    $0x10,%esp
+  801045:	85 c0                	test   %eax,%eax
+  801047:	0f 84 04 01 00 00    	je     801151 <file_create+0x136>
+  80104d:	89 c3                	mov    %eax,%ebx
+  80104f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801052:	0f 85 eb 00 00 00    	jne    801143 <file_create+0x128>
+  801058:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  80105e:	85 ff                	test   %edi,%edi
+  801060:	0f 84 dd 00 00 00    	je     801143 <file_create+0x128>
+  801066:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  80106c:	89 c3                	mov    %eax,%ebx
+  80106e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  801074:	75 5e                	jne    8010d4 <file_create+0xb9>
+  801076:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  80107c:	85 c0                	test   %eax,%eax
+  80107e:	0f 48 c2             	cmovs  %edx,%eax
+  801081:	c1 f8 0c             	sar    $0xc,%eax
+  801084:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80108a:	74 61                	je     8010ed <file_create+0xd2>
+  80108c:	be 00 00 00 00       	mov    $0x0,%esi
+  801091:	83 ec 04             	sub    $0x4,%esp
+  801094:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80109a:	50                   	push   %eax
+  80109b:	56                   	push   %esi
+  80109c:	57                   	push   %edi
+  80109d:	e8 82 fa ff ff       	call   800b24 <file_get_block>
+  8010a2:	83 c4 10             	add    $0x10,%esp
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	0f 88 a0 00 00 00    	js     80114d <file_create+0x132>
+  8010ad:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  8010b3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010b9:	80 38 00             	cmpb   $0x0,(%eax)
+  8010bc:	74 5d                	je     80111b <file_create+0x100>
+  8010be:	05 00 01 00 00       	add    $0x100,%eax
+  8010c3:	39 d0                	cmp    %edx,%eax
+  8010c5:	75 f2                	jne    8010b9 <file_create+0x9e>
+  8010c7:	83 c6 01             	add    $0x1,%esi
+  8010ca:	39 b5 54 ff ff ff    	cmp    %esi,-0xac(%ebp)
+  8010d0:	75 bf                	jne    801091 <file_create+0x76>
+  8010d2:	eb 1f                	jmp    8010f3 <file_create+0xd8>
+  8010d4:	68 3b 58 80 00       	push   $0x80583b
+  8010d9:	68 3d 55 80 00       	push   $0x80553d
+  8010de:	68 f1 00 00 00       	push   $0xf1
+  8010e3:	68 86 57 80 00       	push   $0x805786
+  8010e8:	e8 b2 12 00 00       	call   80239f <_panic>
+  8010ed:	8b b5 54 ff ff ff    	mov    -0xac(%ebp),%esi
+  8010f3:	81 87 80 00 00 00 00 	addl   $0x1000,0x80(%edi)
+  8010fa:	10 00 00 
+  8010fd:	83 ec 04             	sub    $0x4,%esp
+  801100:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  801106:	50                   	push   %eax
+  801107:	56                   	push   %esi
+  801108:	57                   	push   %edi
+  801109:	e8 16 fa ff ff       	call   800b24 <file_get_block>
+  80110e:	83 c4 10             	add    $0x10,%esp
+  801111:	85 c0                	test   %eax,%eax
+  801113:	78 43                	js     801158 <file_create+0x13d>
+  801115:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  80111b:	89 c6                	mov    %eax,%esi
+  80111d:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  801123:	83 ec 08             	sub    $0x8,%esp
+  801126:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80112c:	50                   	push   %eax
+  80112d:	56                   	push   %esi
+  80112e:	e8 3e 1a 00 00       	call   802b71 <strcpy>
+  801133:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801136:	89 30                	mov    %esi,(%eax)
+  801138:	89 3c 24             	mov    %edi,(%esp)
+  80113b:	e8 33 fe ff ff       	call   800f73 <file_flush>
+  801140:	83 c4 10             	add    $0x10,%esp
+  801143:	89 d8                	mov    %ebx,%eax
+  801145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+  80114d:	89 c3                	mov    %eax,%ebx
+  80114f:	eb f2                	jmp    801143 <file_create+0x128>
+  801151:	bb f3 ff ff ff       	mov    $0xfffffff3,%ebx
+  801156:	eb eb                	jmp    801143 <file_create+0x128>
+  801158:	89 c3                	mov    %eax,%ebx
+  80115a:	eb e7                	jmp    801143 <file_create+0x128>
+
+0080115c <file_remove>:
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	53                   	push   %ebx
+  801160:	83 ec 20             	sub    $0x20,%esp
+  801163:	6a 00                	push   $0x0
+  801165:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801170:	e8 f3 f9 ff ff       	call   800b68 <walk_path>
+  801175:	83 c4 10             	add    $0x10,%esp
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	78 2d                	js     8011a9 <file_remove+0x4d>
+  80117c:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  80117f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801184:	89 d8                	mov    %ebx,%eax
+  801186:	e8 c1 f7 ff ff       	call   80094c <file_truncate_blocks>
+  80118b:	c6 03 00             	movb   $0x0,(%ebx)
+  80118e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801195:	00 00 00 
+  801198:	83 ec 0c             	sub    $0xc,%esp
+  80119b:	53                   	push   %ebx
+  80119c:	e8 36 f3 ff ff       	call   8004d7 <flush_block>
+  8011a1:	83 c4 10             	add    $0x10,%esp
+  8011a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ac:	c9                   	leave
+  8011ad:	c3                   	ret
+
+008011ae <fs_sync>:
+  8011ae:	a1 14 c0 80 00       	mov    0x80c014,%eax
+  8011b3:	83 78 04 01          	cmpl   $0x1,0x4(%eax)
+  8011b7:	76 32                	jbe    8011eb <fs_sync+0x3d>
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	53                   	push   %ebx
+  8011bd:	83 ec 04             	sub    $0x4,%esp
+  8011c0:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8011c5:	83 ec 0c             	sub    $0xc,%esp
+  8011c8:	53                   	push   %ebx
+  8011c9:	e8 f5 f1 ff ff       	call   8003c3 <diskaddr>
+  8011ce:	89 04 24             	mov    %eax,(%esp)
+  8011d1:	e8 01 f3 ff ff       	call   8004d7 <flush_block>
+  8011d6:	83 c3 01             	add    $0x1,%ebx
+  8011d9:	83 c4 10             	add    $0x10,%esp
+  8011dc:	a1 14 c0 80 00       	mov    0x80c014,%eax
+  8011e1:	3b 58 04             	cmp    0x4(%eax),%ebx
+  8011e4:	72 df                	jb     8011c5 <fs_sync+0x17>
+  8011e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011e9:	c9                   	leave
+  8011ea:	c3                   	ret
+  8011eb:	c3                   	ret
+
+008011ec <image_new_version>:
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	57                   	push   %edi
+  8011f0:	56                   	push   %esi
+  8011f1:	53                   	push   %ebx
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+  8011f5:	89 c3                	mov    %eax,%ebx
+  8011f7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8011fa:	c1 e0 05             	shl    $0x5,%eax
+  8011fd:	83 b8 28 c0 80 00 00 	cmpl   $0x0,0x80c028(%eax)
+  801204:	75 08                	jne    80120e <image_new_version+0x22>
+  801206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801209:	5b                   	pop    %ebx
+  80120a:	5e                   	pop    %esi
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+  80120e:	83 ec 0c             	sub    $0xc,%esp
+  801211:	8d 3c 1b             	lea    (%ebx,%ebx,1),%edi
+  801214:	89 c6                	mov    %eax,%esi
+  801216:	8b 80 24 c0 80 00    	mov    0x80c024(%eax),%eax
+  80121c:	c1 e0 06             	shl    $0x6,%eax
+  80121f:	09 d8                	or     %ebx,%eax
+  801221:	50                   	push   %eax
+  801222:	e8 d6 25 00 00       	call   8037fd <sys_pager_retire>
+  801227:	8b 86 24 c0 80 00    	mov    0x80c024(%esi),%eax
+  80122d:	83 c0 01             	add    $0x1,%eax
+  801230:	83 e0 3f             	and    $0x3f,%eax
+  801233:	89 86 24 c0 80 00    	mov    %eax,0x80c024(%esi)
+  801239:	01 df                	add    %ebx,%edi
+  80123b:	c1 e7 05             	shl    $0x5,%edi
+  80123e:	c7 87 28 c0 80 00 00 	movl   $0x0,0x80c028(%edi)
+  801245:	00 00 00 
+  801248:	83 c4 10             	add    $0x10,%esp
+  80124b:	eb b9                	jmp    801206 <image_new_version+0x1a>
+
+0080124d <image_changed>:
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+  801252:	89 c6                	mov    %eax,%esi
+  801254:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801259:	eb 08                	jmp    801263 <image_changed+0x16>
+  80125b:	83 c3 01             	add    $0x1,%ebx
+  80125e:	83 fb 40             	cmp    $0x40,%ebx
+  801261:	74 17                	je     80127a <image_changed+0x2d>
+  801263:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801266:	c1 e0 05             	shl    $0x5,%eax
+  801269:	39 b0 20 c0 80 00    	cmp    %esi,0x80c020(%eax)
+  80126f:	75 ea                	jne    80125b <image_changed+0xe>
+  801271:	89 d8                	mov    %ebx,%eax
+  801273:	e8 74 ff ff ff       	call   8011ec <image_new_version>
+  801278:	eb e1                	jmp    80125b <image_changed+0xe>
+  80127a:	5b                   	pop    %ebx
+  80127b:	5e                   	pop    %esi
+  80127c:	5d                   	pop    %ebp
+  80127d:	c3                   	ret
+
+0080127e <serve_remove>:
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	53                   	push   %ebx
+  801282:	81 ec 08 04 00 00    	sub    $0x408,%esp
+  801288:	68 00 04 00 00       	push   $0x400
+  80128d:	ff 75 0c             	push   0xc(%ebp)
+  801290:	8d 9d f8 fb ff ff    	lea    -0x408(%ebp),%ebx
+  801296:	53                   	push   %ebx
+  801297:	e8 85 1a 00 00       	call   802d21 <memmove>
+  80129c:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+  8012a0:	89 1c 24             	mov    %ebx,(%esp)
+  8012a3:	e8 b4 fe ff ff       	call   80115c <file_remove>
+  8012a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ab:	c9                   	leave
+  8012ac:	c3                   	ret
+
+008012ad <serve_sync>:
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	83 ec 08             	sub    $0x8,%esp
+  8012b3:	e8 f6 fe ff ff       	call   8011ae <fs_sync>
+  8012b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bd:	c9                   	leave
+  8012be:	c3                   	ret
+
+008012bf <serve_rings>:
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	57                   	push   %edi
+  8012c3:	56                   	push   %esi
+  8012c4:	53                   	push   %ebx
+  8012c5:	83 ec 1c             	sub    $0x1c,%esp
+  8012c8:	be 20 d8 80 00       	mov    $0x80d820,%esi
+  8012cd:	c7 45 e4 00 00 40 d0 	movl   $0xd0400000,-0x1c(%ebp)
+  8012d4:	e9 97 00 00 00       	jmp    801370 <serve_rings+0xb1>
+  8012d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012de:	89 46 04             	mov    %eax,0x4(%esi)
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	57                   	push   %edi
+  8012e5:	e8 cf 3d 00 00       	call   8050b9 <ipcring_rsp_push>
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	83 eb 01             	sub    $0x1,%ebx
+  8012f0:	74 5b                	je     80134d <serve_rings+0x8e>
+  8012f2:	83 ec 0c             	sub    $0xc,%esp
+  8012f5:	57                   	push   %edi
+  8012f6:	e8 aa 3d 00 00       	call   8050a5 <ipcring_req_peek>
+  8012fb:	89 c6                	mov    %eax,%esi
+  8012fd:	8b 47 08             	mov    0x8(%edi),%eax
+  801300:	8b 16                	mov    (%esi),%edx
+  801302:	83 c4 10             	add    $0x10,%esp
+  801305:	83 fa 0f             	cmp    $0xf,%edx
+  801308:	77 cf                	ja     8012d9 <serve_rings+0x1a>
+  80130a:	83 3c 95 20 70 80 00 	cmpl   $0x0,0x807020(,%edx,4)
+  801311:	00 
+  801312:	74 c5                	je     8012d9 <serve_rings+0x1a>
+  801314:	83 e0 07             	and    $0x7,%eax
+  801317:	83 c0 01             	add    $0x1,%eax
+  80131a:	c1 e0 0c             	shl    $0xc,%eax
+  80131d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801320:	01 c8                	add    %ecx,%eax
+  801322:	83 ec 0c             	sub    $0xc,%esp
+  801325:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801328:	50                   	push   %eax
+  801329:	e8 2a 34 00 00       	call   804758 <pageref>
+  80132e:	83 c4 10             	add    $0x10,%esp
+  801331:	83 f8 01             	cmp    $0x1,%eax
+  801334:	7e a3                	jle    8012d9 <serve_rings+0x1a>
+  801336:	83 ec 08             	sub    $0x8,%esp
+  801339:	8b 06                	mov    (%esi),%eax
+  80133b:	ff 75 e0             	push   -0x20(%ebp)
+  80133e:	ff 77 04             	push   0x4(%edi)
+  801341:	ff 14 85 20 70 80 00 	call   *0x807020(,%eax,4)
+  801348:	83 c4 10             	add    $0x10,%esp
+  80134b:	eb 91                	jmp    8012de <serve_rings+0x1f>
+  80134d:	8b 75 dc             	mov    -0x24(%ebp),%esi
+  801350:	83 ec 0c             	sub    $0xc,%esp
+  801353:	57                   	push   %edi
+  801354:	e8 d8 3d 00 00       	call   805131 <ipcring_server_sleep>
+  801359:	83 c4 10             	add    $0x10,%esp
+  80135c:	81 45 e4 00 90 00 00 	addl   $0x9000,-0x1c(%ebp)
+  801363:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801366:	83 c6 10             	add    $0x10,%esi
+  801369:	3d 00 00 49 d0       	cmp    $0xd0490000,%eax
+  80136e:	74 2f                	je     80139f <serve_rings+0xe0>
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	ff 75 e4             	push   -0x1c(%ebp)
+  801376:	e8 dd 33 00 00       	call   804758 <pageref>
+  80137b:	83 c4 10             	add    $0x10,%esp
+  80137e:	83 f8 01             	cmp    $0x1,%eax
+  801381:	7e d9                	jle    80135c <serve_rings+0x9d>
+  801383:	89 f7                	mov    %esi,%edi
+  801385:	83 ec 0c             	sub    $0xc,%esp
+  801388:	56                   	push   %esi
+  801389:	e8 fd 3c 00 00       	call   80508b <ipcring_req_avail>
+  80138e:	89 c3                	mov    %eax,%ebx
+  801390:	83 c4 10             	add    $0x10,%esp
+  801393:	85 c0                	test   %eax,%eax
+  801395:	7e b9                	jle    801350 <serve_rings+0x91>
+  801397:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  80139a:	e9 53 ff ff ff       	jmp    8012f2 <serve_rings+0x33>
+  80139f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5f                   	pop    %edi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+
+008013a7 <serve_init>:
+  8013a7:	ba 80 70 80 00       	mov    $0x807080,%edx
+  8013ac:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+  8013b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b6:	89 02                	mov    %eax,(%edx)
+  8013b8:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  8013bb:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  8013c1:	83 c0 01             	add    $0x1,%eax
+  8013c4:	83 c2 10             	add    $0x10,%edx
+  8013c7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8013cc:	75 e8                	jne    8013b6 <serve_init+0xf>
+  8013ce:	c3                   	ret
+
+008013cf <openfile_alloc>:
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	57                   	push   %edi
+  8013d3:	56                   	push   %esi
+  8013d4:	53                   	push   %ebx
+  8013d5:	83 ec 0c             	sub    $0xc,%esp
+  8013d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e0:	89 de                	mov    %ebx,%esi
+  8013e2:	c1 e6 04             	shl    $0x4,%esi
+  8013e5:	83 ec 0c             	sub    $0xc,%esp
+  8013e8:	ff b6 8c 70 80 00    	push   0x80708c(%esi)
+  8013ee:	e8 65 33 00 00       	call   804758 <pageref>
+  8013f3:	83 c4 10             	add    $0x10,%esp
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	74 17                	je     801411 <openfile_alloc+0x42>
+  8013fa:	83 f8 01             	cmp    $0x1,%eax
+  8013fd:	74 30                	je     80142f <openfile_alloc+0x60>
+  8013ff:	83 c3 01             	add    $0x1,%ebx
+  801402:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  801408:	75 d6                	jne    8013e0 <openfile_alloc+0x11>
+  80140a:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80140f:	eb 4f                	jmp    801460 <openfile_alloc+0x91>
+  801411:	83 ec 04             	sub    $0x4,%esp
+  801414:	6a 07                	push   $0x7
+  801416:	89 d8                	mov    %ebx,%eax
+  801418:	c1 e0 04             	shl    $0x4,%eax
+  80141b:	ff b0 8c 70 80 00    	push   0x80708c(%eax)
+  801421:	6a 00                	push   $0x0
+  801423:	e8 a9 1b 00 00       	call   802fd1 <sys_page_alloc>
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	85 c0                	test   %eax,%eax
+  80142d:	78 31                	js     801460 <openfile_alloc+0x91>
+  80142f:	c1 e3 04             	shl    $0x4,%ebx
+  801432:	81 83 80 70 80 00 00 	addl   $0x400,0x807080(%ebx)
+  801439:	04 00 00 
+  80143c:	81 c6 80 70 80 00    	add    $0x807080,%esi
+  801442:	89 37                	mov    %esi,(%edi)
+  801444:	83 ec 04             	sub    $0x4,%esp
+  801447:	68 00 10 00 00       	push   $0x1000
+  80144c:	6a 00                	push   $0x0
+  80144e:	ff b3 8c 70 80 00    	push   0x80708c(%ebx)
+  801454:	e8 93 18 00 00       	call   802cec <memset>
+  801459:	8b 07                	mov    (%edi),%eax
+  80145b:	8b 00                	mov    (%eax),%eax
+  80145d:	83 c4 10             	add    $0x10,%esp
+  801460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801463:	5b                   	pop    %ebx
+  801464:	5e                   	pop    %esi
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+
+00801468 <openfile_lookup>:
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	57                   	push   %edi
+  80146c:	56                   	push   %esi
+  80146d:	53                   	push   %ebx
+  80146e:	83 ec 18             	sub    $0x18,%esp
+  801471:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801474:	89 fb                	mov    %edi,%ebx
+  801476:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80147c:	89 de                	mov    %ebx,%esi
+  80147e:	c1 e6 04             	shl    $0x4,%esi
+  801481:	ff b6 8c 70 80 00    	push   0x80708c(%esi)
+  801487:	81 c6 80 70 80 00    	add    $0x807080,%esi
+  80148d:	e8 c6 32 00 00       	call   804758 <pageref>
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	83 f8 01             	cmp    $0x1,%eax
+  801498:	74 1d                	je     8014b7 <openfile_lookup+0x4f>
+  80149a:	c1 e3 04             	shl    $0x4,%ebx
+  80149d:	39 bb 80 70 80 00    	cmp    %edi,0x807080(%ebx)
+  8014a3:	75 19                	jne    8014be <openfile_lookup+0x56>
+  8014a5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8014a8:	89 30                	mov    %esi,(%eax)
+  8014aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b2:	5b                   	pop    %ebx
+  8014b3:	5e                   	pop    %esi
+  8014b4:	5f                   	pop    %edi
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	c3                   	ret
+  8014b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014bc:	eb f1                	jmp    8014af <openfile_lookup+0x47>
+  8014be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014c3:	eb ea                	jmp    8014af <openfile_lookup+0x47>
+
+008014c5 <serve_set_size>:
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	56                   	push   %esi
+  8014c9:	53                   	push   %ebx
+  8014ca:	83 ec 14             	sub    $0x14,%esp
+  8014cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8014d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d3:	50                   	push   %eax
+  8014d4:	ff 33                	push   (%ebx)
+  8014d6:	ff 75 08             	push   0x8(%ebp)
+  8014d9:	e8 8a ff ff ff       	call   801468 <openfile_lookup>
+  8014de:	83 c4 10             	add    $0x10,%esp
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	78 1c                	js     801501 <serve_set_size+0x3c>
+  8014e5:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8014e8:	8b 46 04             	mov    0x4(%esi),%eax
+  8014eb:	e8 5d fd ff ff       	call   80124d <image_changed>
+  8014f0:	83 ec 08             	sub    $0x8,%esp
+  8014f3:	ff 73 04             	push   0x4(%ebx)
+  8014f6:	ff 76 04             	push   0x4(%esi)
+  8014f9:	e8 67 f9 ff ff       	call   800e65 <file_set_size>
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801504:	5b                   	pop    %ebx
+  801505:	5e                   	pop    %esi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+
+00801508 <serve_read>:
+  801508:	55                   	push   %ebp
+  801509:	89 e5                	mov    %esp,%ebp
+  80150b:	57                   	push   %edi
+  80150c:	56                   	push   %esi
+  80150d:	53                   	push   %ebx
+  80150e:	83 ec 20             	sub    $0x20,%esp
+  801511:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801514:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801517:	50                   	push   %eax
+  801518:	ff 36                	push   (%esi)
+  80151a:	ff 75 08             	push   0x8(%ebp)
+  80151d:	e8 46 ff ff ff       	call   801468 <openfile_lookup>
+  801522:	83 c4 10             	add    $0x10,%esp
+  801525:	85 c0                	test   %eax,%eax
+  801527:	78 35                	js     80155e <serve_read+0x56>
+  801529:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80152c:	8b 47 0c             	mov    0xc(%edi),%eax
+  80152f:	ff 70 04             	push   0x4(%eax)
+  801532:	8b 46 04             	mov    0x4(%esi),%eax
+  801535:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80153a:	39 d0                	cmp    %edx,%eax
+  80153c:	0f 47 c2             	cmova  %edx,%eax
+  80153f:	50                   	push   %eax
+  801540:	56                   	push   %esi
+  801541:	ff 77 04             	push   0x4(%edi)
+  801544:	e8 67 f8 ff ff       	call   800db0 <file_read>
+  801549:	89 c3                	mov    %eax,%ebx
+  80154b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80154e:	01 58 04             	add    %ebx,0x4(%eax)
+  801551:	83 c4 10             	add    $0x10,%esp
+  801554:	89 d8                	mov    %ebx,%eax
+  801556:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801559:	5b                   	pop    %ebx
+  80155a:	5e                   	pop    %esi
+  80155b:	5f                   	pop    %edi
+  80155c:	5d                   	pop    %ebp
+  80155d:	c3                   	ret
+  80155e:	89 c3                	mov    %eax,%ebx
+  801560:	83 ec 0c             	sub    $0xc,%esp
+  801563:	68 58 58 80 00       	push   $0x805858
+  801568:	e8 0d 0f 00 00       	call   80247a <cprintf>
+  80156d:	83 c4 10             	add    $0x10,%esp
+  801570:	eb e2                	jmp    801554 <serve_read+0x4c>
+
+00801572 <serve_write>:
+  801572:	55                   	push   %ebp
+  801573:	89 e5                	mov    %esp,%ebp
+  801575:	57                   	push   %edi
+  801576:	56                   	push   %esi
+  801577:	53                   	push   %ebx
+  801578:	83 ec 20             	sub    $0x20,%esp
+  80157b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80157e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801581:	50                   	push   %eax
+  801582:	ff 36                	push   (%esi)
+  801584:	ff 75 08             	push   0x8(%ebp)
+  801587:	e8 dc fe ff ff       	call   801468 <openfile_lookup>
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	78 35                	js     8015c8 <serve_write+0x56>
+  801593:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801596:	8b 47 04             	mov    0x4(%edi),%eax
+  801599:	e8 af fc ff ff       	call   80124d <image_changed>
+  80159e:	8b 47 0c             	mov    0xc(%edi),%eax
+  8015a1:	ff 70 04             	push   0x4(%eax)
+  8015a4:	ff 76 04             	push   0x4(%esi)
+  8015a7:	83 c6 08             	add    $0x8,%esi
+  8015aa:	56                   	push   %esi
+  8015ab:	ff 77 04             	push   0x4(%edi)
+  8015ae:	e8 eb f8 ff ff       	call   800e9e <file_write>
+  8015b3:	89 c3                	mov    %eax,%ebx
+  8015b5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8015b8:	01 58 04             	add    %ebx,0x4(%eax)
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	89 d8                	mov    %ebx,%eax
+  8015c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c3:	5b                   	pop    %ebx
+  8015c4:	5e                   	pop    %esi
+  8015c5:	5f                   	pop    %edi
+  8015c6:	5d                   	pop    %ebp
+  8015c7:	c3                   	ret
+  8015c8:	89 c3                	mov    %eax,%ebx
+  8015ca:	83 ec 0c             	sub    $0xc,%esp
+  8015cd:	68 84 58 80 00       	push   $0x805884
+  8015d2:	e8 a3 0e 00 00       	call   80247a <cprintf>
+  8015d7:	83 c4 10             	add    $0x10,%esp
+  8015da:	eb e2                	jmp    8015be <serve_write+0x4c>
+
+008015dc <serve_pread>:
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	57                   	push   %edi
+  8015e0:	56                   	push   %esi
+  8015e1:	53                   	push   %ebx
+  8015e2:	83 ec 20             	sub    $0x20,%esp
+  8015e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8015e8:	8b 7b 08             	mov    0x8(%ebx),%edi
+  8015eb:	8b 73 04             	mov    0x4(%ebx),%esi
+  8015ee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	ff 33                	push   (%ebx)
+  8015f4:	ff 75 08             	push   0x8(%ebp)
+  8015f7:	e8 6c fe ff ff       	call   801468 <openfile_lookup>
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	78 1f                	js     801622 <serve_pread+0x46>
+  801603:	85 ff                	test   %edi,%edi
+  801605:	78 23                	js     80162a <serve_pread+0x4e>
+  801607:	57                   	push   %edi
+  801608:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80160d:	39 c6                	cmp    %eax,%esi
+  80160f:	0f 47 f0             	cmova  %eax,%esi
+  801612:	56                   	push   %esi
+  801613:	53                   	push   %ebx
+  801614:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801617:	ff 70 04             	push   0x4(%eax)
+  80161a:	e8 91 f7 ff ff       	call   800db0 <file_read>
+  80161f:	83 c4 10             	add    $0x10,%esp
+  801622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801625:	5b                   	pop    %ebx
+  801626:	5e                   	pop    %esi
+  801627:	5f                   	pop    %edi
+  801628:	5d                   	pop    %ebp
+  801629:	c3                   	ret
+  80162a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80162f:	eb f1                	jmp    801622 <serve_pread+0x46>
+
+00801631 <serve_pwrite>:
+  801631:	55                   	push   %ebp
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	56                   	push   %esi
+  801635:	53                   	push   %ebx
+  801636:	83 ec 14             	sub    $0x14,%esp
+  801639:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80163c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80163f:	50                   	push   %eax
+  801640:	ff 33                	push   (%ebx)
+  801642:	ff 75 08             	push   0x8(%ebp)
+  801645:	e8 1e fe ff ff       	call   801468 <openfile_lookup>
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 31                	js     801682 <serve_pwrite+0x51>
+  801651:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+  801655:	78 32                	js     801689 <serve_pwrite+0x58>
+  801657:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80165a:	8b 46 04             	mov    0x4(%esi),%eax
+  80165d:	e8 eb fb ff ff       	call   80124d <image_changed>
+  801662:	ff 73 08             	push   0x8(%ebx)
+  801665:	8b 43 04             	mov    0x4(%ebx),%eax
+  801668:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80166d:	39 d0                	cmp    %edx,%eax
+  80166f:	0f 47 c2             	cmova  %edx,%eax
+  801672:	50                   	push   %eax
+  801673:	83 c3 0c             	add    $0xc,%ebx
+  801676:	53                   	push   %ebx
+  801677:	ff 76 04             	push   0x4(%esi)
+  80167a:	e8 1f f8 ff ff       	call   800e9e <file_write>
+  80167f:	83 c4 10             	add    $0x10,%esp
+  801682:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801685:	5b                   	pop    %ebx
+  801686:	5e                   	pop    %esi
+  801687:	5d                   	pop    %ebp
+  801688:	c3                   	ret
+  801689:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80168e:	eb f2                	jmp    801682 <serve_pwrite+0x51>
+
+00801690 <serve_stat>:
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	56                   	push   %esi
+  801694:	53                   	push   %ebx
+  801695:	83 ec 14             	sub    $0x14,%esp
+  801698:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80169b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169e:	50                   	push   %eax
+  80169f:	ff 33                	push   (%ebx)
+  8016a1:	ff 75 08             	push   0x8(%ebp)
+  8016a4:	e8 bf fd ff ff       	call   801468 <openfile_lookup>
+  8016a9:	83 c4 10             	add    $0x10,%esp
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	78 3c                	js     8016ec <serve_stat+0x5c>
+  8016b0:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016b3:	83 ec 08             	sub    $0x8,%esp
+  8016b6:	ff 76 04             	push   0x4(%esi)
+  8016b9:	53                   	push   %ebx
+  8016ba:	e8 b2 14 00 00       	call   802b71 <strcpy>
+  8016bf:	8b 46 04             	mov    0x4(%esi),%eax
+  8016c2:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8016c8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8016ce:	8b 46 04             	mov    0x4(%esi),%eax
+  8016d1:	83 c4 10             	add    $0x10,%esp
+  8016d4:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  8016db:	0f 94 c0             	sete   %al
+  8016de:	0f b6 c0             	movzbl %al,%eax
+  8016e1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8016e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ef:	5b                   	pop    %ebx
+  8016f0:	5e                   	pop    %esi
+  8016f1:	5d                   	pop    %ebp
+  8016f2:	c3                   	ret
+
+008016f3 <serve_flush>:
+  8016f3:	55                   	push   %ebp
+  8016f4:	89 e5                	mov    %esp,%ebp
+  8016f6:	83 ec 1c             	sub    $0x1c,%esp
+  8016f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016fc:	50                   	push   %eax
+  8016fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801700:	ff 30                	push   (%eax)
+  801702:	ff 75 08             	push   0x8(%ebp)
+  801705:	e8 5e fd ff ff       	call   801468 <openfile_lookup>
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	78 16                	js     801727 <serve_flush+0x34>
+  801711:	83 ec 0c             	sub    $0xc,%esp
+  801714:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801717:	ff 70 04             	push   0x4(%eax)
+  80171a:	e8 54 f8 ff ff       	call   800f73 <file_flush>
+  80171f:	83 c4 10             	add    $0x10,%esp
+  801722:	b8 00 00 00 00       	mov    $0x0,%eax
+  801727:	c9                   	leave
+  801728:	c3                   	ret
+
+00801729 <serve_image>:
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	57                   	push   %edi
+  80172d:	56                   	push   %esi
+  80172e:	53                   	push   %ebx
+  80172f:	83 ec 30             	sub    $0x30,%esp
+  801732:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801735:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801738:	50                   	push   %eax
+  801739:	ff 37                	push   (%edi)
+  80173b:	ff 75 08             	push   0x8(%ebp)
+  80173e:	e8 25 fd ff ff       	call   801468 <openfile_lookup>
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	85 c0                	test   %eax,%eax
+  801748:	0f 88 0f 01 00 00    	js     80185d <serve_image+0x134>
+  80174e:	8b 47 04             	mov    0x4(%edi),%eax
+  801751:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801754:	83 f8 04             	cmp    $0x4,%eax
+  801757:	0f 87 08 01 00 00    	ja     801865 <serve_image+0x13c>
+  80175d:	85 c0                	test   %eax,%eax
+  80175f:	7e 4f                	jle    8017b0 <serve_image+0x87>
+  801761:	8d 57 08             	lea    0x8(%edi),%edx
+  801764:	be 00 00 00 00       	mov    $0x0,%esi
+  801769:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  80176c:	8b 02                	mov    (%edx),%eax
+  80176e:	3d ff ff 7f 00       	cmp    $0x7fffff,%eax
+  801773:	0f 86 f3 00 00 00    	jbe    80186c <serve_image+0x143>
+  801779:	8b 4a 04             	mov    0x4(%edx),%ecx
+  80177c:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801781:	29 c7                	sub    %eax,%edi
+  801783:	39 cf                	cmp    %ecx,%edi
+  801785:	0f 82 e8 00 00 00    	jb     801873 <serve_image+0x14a>
+  80178b:	3b 4a 08             	cmp    0x8(%edx),%ecx
+  80178e:	0f 82 e6 00 00 00    	jb     80187a <serve_image+0x151>
+  801794:	33 42 0c             	xor    0xc(%edx),%eax
+  801797:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  80179c:	0f 85 df 00 00 00    	jne    801881 <serve_image+0x158>
+  8017a2:	83 c6 01             	add    $0x1,%esi
+  8017a5:	83 c2 14             	add    $0x14,%edx
+  8017a8:	39 75 d4             	cmp    %esi,-0x2c(%ebp)
+  8017ab:	75 bf                	jne    80176c <serve_image+0x43>
+  8017ad:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8017b0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8017b3:	8b 56 04             	mov    0x4(%esi),%edx
+  8017b6:	b8 80 c0 80 00       	mov    $0x80c080,%eax
+  8017bb:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8017c0:	39 10                	cmp    %edx,(%eax)
+  8017c2:	74 43                	je     801807 <serve_image+0xde>
+  8017c4:	83 c3 01             	add    $0x1,%ebx
+  8017c7:	83 c0 60             	add    $0x60,%eax
+  8017ca:	83 fb 40             	cmp    $0x40,%ebx
+  8017cd:	75 f1                	jne    8017c0 <serve_image+0x97>
+  8017cf:	8b 1d 60 70 80 00    	mov    0x807060,%ebx
+  8017d5:	ba 83 20 08 82       	mov    $0x82082083,%edx
+  8017da:	89 d8                	mov    %ebx,%eax
+  8017dc:	f7 ea                	imul   %edx
+  8017de:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+  8017e1:	c1 f8 05             	sar    $0x5,%eax
+  8017e4:	89 da                	mov    %ebx,%edx
+  8017e6:	c1 fa 1f             	sar    $0x1f,%edx
+  8017e9:	29 d0                	sub    %edx,%eax
+  8017eb:	89 c2                	mov    %eax,%edx
+  8017ed:	c1 e2 06             	shl    $0x6,%edx
+  8017f0:	29 c2                	sub    %eax,%edx
+  8017f2:	89 d8                	mov    %ebx,%eax
+  8017f4:	29 d0                	sub    %edx,%eax
+  8017f6:	83 c0 01             	add    $0x1,%eax
+  8017f9:	a3 60 70 80 00       	mov    %eax,0x807060
+  8017fe:	89 d8                	mov    %ebx,%eax
+  801800:	e8 e7 f9 ff ff       	call   8011ec <image_new_version>
+  801805:	eb 05                	jmp    80180c <serve_image+0xe3>
+  801807:	83 fb 3f             	cmp    $0x3f,%ebx
+  80180a:	7f c3                	jg     8017cf <serve_image+0xa6>
+  80180c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80180f:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+  801812:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  801815:	c1 e2 05             	shl    $0x5,%edx
+  801818:	8d b2 20 c0 80 00    	lea    0x80c020(%edx),%esi
+  80181e:	89 8a 20 c0 80 00    	mov    %ecx,0x80c020(%edx)
+  801824:	c7 82 28 c0 80 00 01 	movl   $0x1,0x80c028(%edx)
+  80182b:	00 00 00 
+  80182e:	8b 57 04             	mov    0x4(%edi),%edx
+  801831:	89 56 0c             	mov    %edx,0xc(%esi)
+  801834:	83 ec 04             	sub    $0x4,%esp
+  801837:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  80183a:	c1 e2 02             	shl    $0x2,%edx
+  80183d:	52                   	push   %edx
+  80183e:	83 c7 08             	add    $0x8,%edi
+  801841:	57                   	push   %edi
+  801842:	01 d8                	add    %ebx,%eax
+  801844:	c1 e0 05             	shl    $0x5,%eax
+  801847:	05 30 c0 80 00       	add    $0x80c030,%eax
+  80184c:	50                   	push   %eax
+  80184d:	e8 cf 14 00 00       	call   802d21 <memmove>
+  801852:	8b 46 04             	mov    0x4(%esi),%eax
+  801855:	c1 e0 06             	shl    $0x6,%eax
+  801858:	09 d8                	or     %ebx,%eax
+  80185a:	83 c4 10             	add    $0x10,%esp
+  80185d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5f                   	pop    %edi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+  801865:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186a:	eb f1                	jmp    80185d <serve_image+0x134>
+  80186c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801871:	eb ea                	jmp    80185d <serve_image+0x134>
+  801873:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801878:	eb e3                	jmp    80185d <serve_image+0x134>
+  80187a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80187f:	eb dc                	jmp    80185d <serve_image+0x134>
+  801881:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801886:	eb d5                	jmp    80185d <serve_image+0x134>
+
+00801888 <serve_open>:
+  801888:	55                   	push   %ebp
+  801889:	89 e5                	mov    %esp,%ebp
+  80188b:	53                   	push   %ebx
+  80188c:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  801892:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801895:	68 00 04 00 00       	push   $0x400
+  80189a:	53                   	push   %ebx
+  80189b:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8018a1:	50                   	push   %eax
+  8018a2:	e8 7a 14 00 00       	call   802d21 <memmove>
+  8018a7:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+  8018ab:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  8018b1:	89 04 24             	mov    %eax,(%esp)
+  8018b4:	e8 16 fb ff ff       	call   8013cf <openfile_alloc>
+  8018b9:	83 c4 10             	add    $0x10,%esp
+  8018bc:	85 c0                	test   %eax,%eax
+  8018be:	0f 88 aa 00 00 00    	js     80196e <serve_open+0xe6>
+  8018c4:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%ebx)
+  8018cb:	74 2b                	je     8018f8 <serve_open+0x70>
+  8018cd:	83 ec 08             	sub    $0x8,%esp
+  8018d0:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8018d6:	50                   	push   %eax
+  8018d7:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8018dd:	50                   	push   %eax
+  8018de:	e8 38 f7 ff ff       	call   80101b <file_create>
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	79 2b                	jns    801915 <serve_open+0x8d>
+  8018ea:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  8018f1:	75 7b                	jne    80196e <serve_open+0xe6>
+  8018f3:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  8018f6:	75 76                	jne    80196e <serve_open+0xe6>
+  8018f8:	83 ec 08             	sub    $0x8,%esp
+  8018fb:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  801901:	50                   	push   %eax
+  801902:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  801908:	50                   	push   %eax
+  801909:	e8 88 f4 ff ff       	call   800d96 <file_open>
+  80190e:	83 c4 10             	add    $0x10,%esp
+  801911:	85 c0                	test   %eax,%eax
+  801913:	78 59                	js     80196e <serve_open+0xe6>
+  801915:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  80191c:	75 55                	jne    801973 <serve_open+0xeb>
+  80191e:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  801924:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  80192a:	89 50 04             	mov    %edx,0x4(%eax)
+  80192d:	8b 50 0c             	mov    0xc(%eax),%edx
+  801930:	8b 08                	mov    (%eax),%ecx
+  801932:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  801935:	8b 48 0c             	mov    0xc(%eax),%ecx
+  801938:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  80193e:	83 e2 03             	and    $0x3,%edx
+  801941:	89 51 08             	mov    %edx,0x8(%ecx)
+  801944:	8b 50 0c             	mov    0xc(%eax),%edx
+  801947:	8b 0d 84 b0 80 00    	mov    0x80b084,%ecx
+  80194d:	89 0a                	mov    %ecx,(%edx)
+  80194f:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  801955:	89 50 08             	mov    %edx,0x8(%eax)
+  801958:	8b 50 0c             	mov    0xc(%eax),%edx
+  80195b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80195e:	89 10                	mov    %edx,(%eax)
+  801960:	8b 45 14             	mov    0x14(%ebp),%eax
+  801963:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801971:	c9                   	leave
+  801972:	c3                   	ret
+  801973:	83 ec 08             	sub    $0x8,%esp
+  801976:	6a 00                	push   $0x0
+  801978:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  80197e:	e8 e2 f4 ff ff       	call   800e65 <file_set_size>
+  801983:	83 c4 10             	add    $0x10,%esp
+  801986:	85 c0                	test   %eax,%eax
+  801988:	79 94                	jns    80191e <serve_open+0x96>
+  80198a:	eb e2                	jmp    80196e <serve_open+0xe6>
+
+0080198c <serve>:
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	57                   	push   %edi
+  801990:	56                   	push   %esi
+  801991:	53                   	push   %ebx
+  801992:	83 ec 40             	sub    $0x40,%esp
+  801995:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  80199c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80199f:	50                   	push   %eax
+  8019a0:	ff 35 64 70 80 00    	push   0x807064
+  8019a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019a9:	50                   	push   %eax
+  8019aa:	e8 33 1f 00 00       	call   8038e2 <ipc_recv>
+  8019af:	83 c4 10             	add    $0x10,%esp
+  8019b2:	e9 6b 04 00 00       	jmp    801e22 <serve+0x496>
+  8019b7:	83 f8 0e             	cmp    $0xe,%eax
+  8019ba:	74 2a                	je     8019e6 <serve+0x5a>
+  8019bc:	e8 fe f8 ff ff       	call   8012bf <serve_rings>
+  8019c1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  8019c8:	83 ec 04             	sub    $0x4,%esp
+  8019cb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019ce:	50                   	push   %eax
+  8019cf:	ff 35 64 70 80 00    	push   0x807064
+  8019d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019d8:	50                   	push   %eax
+  8019d9:	e8 04 1f 00 00       	call   8038e2 <ipc_recv>
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	e9 3c 04 00 00       	jmp    801e22 <serve+0x496>
+  8019e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019e9:	be 00 00 40 d0       	mov    $0xd0400000,%esi
+  8019ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f3:	eb 0e                	jmp    801a03 <serve+0x77>
+  8019f5:	83 c3 01             	add    $0x1,%ebx
+  8019f8:	81 c6 00 90 00 00    	add    $0x9000,%esi
+  8019fe:	83 fb 10             	cmp    $0x10,%ebx
+  801a01:	74 31                	je     801a34 <serve+0xa8>
+  801a03:	83 ec 0c             	sub    $0xc,%esp
+  801a06:	56                   	push   %esi
+  801a07:	e8 4c 2d 00 00       	call   804758 <pageref>
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	83 f8 01             	cmp    $0x1,%eax
+  801a12:	7e e1                	jle    8019f5 <serve+0x69>
+  801a14:	89 d8                	mov    %ebx,%eax
+  801a16:	c1 e0 04             	shl    $0x4,%eax
+  801a19:	3b b8 24 d8 80 00    	cmp    0x80d824(%eax),%edi
+  801a1f:	75 d4                	jne    8019f5 <serve+0x69>
+  801a21:	83 ec 0c             	sub    $0xc,%esp
+  801a24:	05 20 d8 80 00       	add    $0x80d820,%eax
+  801a29:	50                   	push   %eax
+  801a2a:	e8 c9 36 00 00       	call   8050f8 <ipcring_client_wait>
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	eb 88                	jmp    8019bc <serve+0x30>
+  801a34:	6a 00                	push   $0x0
+  801a36:	68 00 00 80 ee       	push   $0xee800000
+  801a3b:	6a fd                	push   $0xfffffffd
+  801a3d:	57                   	push   %edi
+  801a3e:	e8 e9 17 00 00       	call   80322c <sys_ipc_try_send>
+  801a43:	83 c4 10             	add    $0x10,%esp
+  801a46:	e9 71 ff ff ff       	jmp    8019bc <serve+0x30>
+  801a4b:	89 c6                	mov    %eax,%esi
+  801a4d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801a53:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  801a56:	89 c7                	mov    %eax,%edi
+  801a58:	83 e7 3f             	and    $0x3f,%edi
+  801a5b:	c1 e8 06             	shr    $0x6,%eax
+  801a5e:	83 e0 3f             	and    $0x3f,%eax
+  801a61:	8d 57 ff             	lea    -0x1(%edi),%edx
+  801a64:	83 fa 3e             	cmp    $0x3e,%edx
+  801a67:	0f 87 8d 01 00 00    	ja     801bfa <serve+0x26e>
+  801a6d:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+  801a70:	c1 e2 05             	shl    $0x5,%edx
+  801a73:	8b 92 20 c0 80 00    	mov    0x80c020(%edx),%edx
+  801a79:	85 d2                	test   %edx,%edx
+  801a7b:	0f 84 85 01 00 00    	je     801c06 <serve+0x27a>
+  801a81:	8d 0c 7f             	lea    (%edi,%edi,2),%ecx
+  801a84:	c1 e1 05             	shl    $0x5,%ecx
+  801a87:	3b 81 24 c0 80 00    	cmp    0x80c024(%ecx),%eax
+  801a8d:	0f 85 7f 01 00 00    	jne    801c12 <serve+0x286>
+  801a93:	89 cb                	mov    %ecx,%ebx
+  801a95:	81 c3 30 c0 80 00    	add    $0x80c030,%ebx
+  801a9b:	8b 81 2c c0 80 00    	mov    0x80c02c(%ecx),%eax
+  801aa1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801aa4:	8d 0c 83             	lea    (%ebx,%eax,4),%ecx
+  801aa7:	39 cb                	cmp    %ecx,%ebx
+  801aa9:	73 2f                	jae    801ada <serve+0x14e>
+  801aab:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  801aae:	eb 07                	jmp    801ab7 <serve+0x12b>
+  801ab0:	83 c3 14             	add    $0x14,%ebx
+  801ab3:	39 cb                	cmp    %ecx,%ebx
+  801ab5:	73 1d                	jae    801ad4 <serve+0x148>
+  801ab7:	8b 03                	mov    (%ebx),%eax
+  801ab9:	89 c7                	mov    %eax,%edi
+  801abb:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  801ac1:	39 fe                	cmp    %edi,%esi
+  801ac3:	72 eb                	jb     801ab0 <serve+0x124>
+  801ac5:	03 43 04             	add    0x4(%ebx),%eax
+  801ac8:	39 c6                	cmp    %eax,%esi
+  801aca:	73 e4                	jae    801ab0 <serve+0x124>
+  801acc:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  801acf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801ad2:	eb 06                	jmp    801ada <serve+0x14e>
+  801ad4:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  801ad7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801ada:	39 cb                	cmp    %ecx,%ebx
+  801adc:	0f 84 3c 01 00 00    	je     801c1e <serve+0x292>
+  801ae2:	8b 03                	mov    (%ebx),%eax
+  801ae4:	89 c1                	mov    %eax,%ecx
+  801ae6:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  801aec:	89 ce                	mov    %ecx,%esi
+  801aee:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+  801af1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801af4:	29 f1                	sub    %esi,%ecx
+  801af6:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  801af9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801afe:	03 43 08             	add    0x8(%ebx),%eax
+  801b01:	89 c6                	mov    %eax,%esi
+  801b03:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b06:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b0b:	01 c8                	add    %ecx,%eax
+  801b0d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801b10:	8b 43 10             	mov    0x10(%ebx),%eax
+  801b13:	83 e0 02             	and    $0x2,%eax
+  801b16:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801b19:	75 15                	jne    801b30 <serve+0x1a4>
+  801b1b:	8d 81 00 10 00 00    	lea    0x1000(%ecx),%eax
+  801b21:	39 c6                	cmp    %eax,%esi
+  801b23:	72 0b                	jb     801b30 <serve+0x1a4>
+  801b25:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b28:	3b 82 80 00 00 00    	cmp    0x80(%edx),%eax
+  801b2e:	72 4f                	jb     801b7f <serve+0x1f3>
+  801b30:	83 ec 04             	sub    $0x4,%esp
+  801b33:	6a 07                	push   $0x7
+  801b35:	a1 64 70 80 00       	mov    0x807064,%eax
+  801b3a:	2d 00 10 00 00       	sub    $0x1000,%eax
+  801b3f:	50                   	push   %eax
+  801b40:	6a 00                	push   $0x0
+  801b42:	e8 8a 14 00 00       	call   802fd1 <sys_page_alloc>
+  801b47:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801b4a:	83 c4 10             	add    $0x10,%esp
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	0f 88 a3 02 00 00    	js     801df8 <serve+0x46c>
+  801b55:	39 75 cc             	cmp    %esi,-0x34(%ebp)
+  801b58:	72 59                	jb     801bb3 <serve+0x227>
+  801b5a:	a1 64 70 80 00       	mov    0x807064,%eax
+  801b5f:	2d 00 10 00 00       	sub    $0x1000,%eax
+  801b64:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801b67:	8b 43 10             	mov    0x10(%ebx),%eax
+  801b6a:	83 e0 02             	and    $0x2,%eax
+  801b6d:	83 c8 05             	or     $0x5,%eax
+  801b70:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801b73:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801b7a:	e9 79 02 00 00       	jmp    801df8 <serve+0x46c>
+  801b7f:	83 ec 04             	sub    $0x4,%esp
+  801b82:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  801b85:	50                   	push   %eax
+  801b86:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  801b89:	c1 e8 0c             	shr    $0xc,%eax
+  801b8c:	50                   	push   %eax
+  801b8d:	52                   	push   %edx
+  801b8e:	e8 91 ef ff ff       	call   800b24 <file_get_block>
+  801b93:	83 c4 10             	add    $0x10,%esp
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	0f 88 8c 00 00 00    	js     801c2a <serve+0x29e>
+  801b9e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801ba1:	0f b6 10             	movzbl (%eax),%edx
+  801ba4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801ba7:	c7 45 e0 05 00 00 00 	movl   $0x5,-0x20(%ebp)
+  801bae:	e9 45 02 00 00       	jmp    801df8 <serve+0x46c>
+  801bb3:	ff 75 c8             	push   -0x38(%ebp)
+  801bb6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  801bb9:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  801bbc:	29 d0                	sub    %edx,%eax
+  801bbe:	01 f0                	add    %esi,%eax
+  801bc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bc5:	39 d0                	cmp    %edx,%eax
+  801bc7:	0f 47 c2             	cmova  %edx,%eax
+  801bca:	50                   	push   %eax
+  801bcb:	a1 64 70 80 00       	mov    0x807064,%eax
+  801bd0:	2d 00 10 00 00       	sub    $0x1000,%eax
+  801bd5:	50                   	push   %eax
+  801bd6:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+  801bd9:	c1 e0 05             	shl    $0x5,%eax
+  801bdc:	ff b0 20 c0 80 00    	push   0x80c020(%eax)
+  801be2:	e8 c9 f1 ff ff       	call   800db0 <file_read>
+  801be7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801bea:	83 c4 10             	add    $0x10,%esp
+  801bed:	85 c0                	test   %eax,%eax
+  801bef:	0f 89 65 ff ff ff    	jns    801b5a <serve+0x1ce>
+  801bf5:	e9 fe 01 00 00       	jmp    801df8 <serve+0x46c>
+  801bfa:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801c01:	e9 f2 01 00 00       	jmp    801df8 <serve+0x46c>
+  801c06:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801c0d:	e9 e6 01 00 00       	jmp    801df8 <serve+0x46c>
+  801c12:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801c19:	e9 da 01 00 00       	jmp    801df8 <serve+0x46c>
+  801c1e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801c25:	e9 ce 01 00 00       	jmp    801df8 <serve+0x46c>
+  801c2a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c2d:	e9 c6 01 00 00       	jmp    801df8 <serve+0x46c>
+  801c32:	83 ec 08             	sub    $0x8,%esp
+  801c35:	ff 75 e4             	push   -0x1c(%ebp)
+  801c38:	68 b0 58 80 00       	push   $0x8058b0
+  801c3d:	e8 38 08 00 00       	call   80247a <cprintf>
+  801c42:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  801c49:	83 c4 0c             	add    $0xc,%esp
+  801c4c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c4f:	50                   	push   %eax
+  801c50:	ff 35 64 70 80 00    	push   0x807064
+  801c56:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c59:	50                   	push   %eax
+  801c5a:	e8 83 1c 00 00       	call   8038e2 <ipc_recv>
+  801c5f:	83 c4 10             	add    $0x10,%esp
+  801c62:	e9 bb 01 00 00       	jmp    801e22 <serve+0x496>
+  801c67:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c6a:	50                   	push   %eax
+  801c6b:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  801c6e:	50                   	push   %eax
+  801c6f:	ff 35 64 70 80 00    	push   0x807064
+  801c75:	ff 75 e4             	push   -0x1c(%ebp)
+  801c78:	e8 0b fc ff ff       	call   801888 <serve_open>
+  801c7d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c80:	83 c4 10             	add    $0x10,%esp
+  801c83:	e9 5d 01 00 00       	jmp    801de5 <serve+0x459>
+  801c88:	a1 64 70 80 00       	mov    0x807064,%eax
+  801c8d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c93:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  801c96:	bb 00 00 40 d0       	mov    $0xd0400000,%ebx
+  801c9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca0:	83 ec 0c             	sub    $0xc,%esp
+  801ca3:	53                   	push   %ebx
+  801ca4:	e8 af 2a 00 00       	call   804758 <pageref>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+  801cac:	83 f8 01             	cmp    $0x1,%eax
+  801caf:	7e 1a                	jle    801ccb <serve+0x33f>
+  801cb1:	83 c6 01             	add    $0x1,%esi
+  801cb4:	81 c3 00 90 00 00    	add    $0x9000,%ebx
+  801cba:	83 fe 10             	cmp    $0x10,%esi
+  801cbd:	75 e1                	jne    801ca0 <serve+0x314>
+  801cbf:	c7 45 d4 f6 ff ff ff 	movl   $0xfffffff6,-0x2c(%ebp)
+  801cc6:	e9 1a 01 00 00       	jmp    801de5 <serve+0x459>
+  801ccb:	83 fe 10             	cmp    $0x10,%esi
+  801cce:	0f 84 c7 01 00 00    	je     801e9b <serve+0x50f>
+  801cd4:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  801cd7:	c1 e0 0c             	shl    $0xc,%eax
+  801cda:	8d 98 00 00 40 d0    	lea    -0x2fc00000(%eax),%ebx
+  801ce0:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  801ce3:	2d 00 70 bf 2f       	sub    $0x2fbf7000,%eax
+  801ce8:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  801ceb:	89 c7                	mov    %eax,%edi
+  801ced:	83 ec 08             	sub    $0x8,%esp
+  801cf0:	53                   	push   %ebx
+  801cf1:	6a 00                	push   $0x0
+  801cf3:	e8 ab 13 00 00       	call   8030a3 <sys_page_unmap>
+  801cf8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	39 fb                	cmp    %edi,%ebx
+  801d03:	75 e8                	jne    801ced <serve+0x361>
+  801d05:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  801d08:	83 ec 0c             	sub    $0xc,%esp
+  801d0b:	57                   	push   %edi
+  801d0c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801d0f:	57                   	push   %edi
+  801d10:	6a 00                	push   $0x0
+  801d12:	ff 75 d4             	push   -0x2c(%ebp)
+  801d15:	6a 00                	push   $0x0
+  801d17:	e8 f8 12 00 00       	call   803014 <sys_page_map>
+  801d1c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d1f:	83 c4 20             	add    $0x20,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	0f 88 bb 00 00 00    	js     801de5 <serve+0x459>
+  801d2a:	83 ec 04             	sub    $0x4,%esp
+  801d2d:	ff 75 c8             	push   -0x38(%ebp)
+  801d30:	57                   	push   %edi
+  801d31:	89 f0                	mov    %esi,%eax
+  801d33:	c1 e0 04             	shl    $0x4,%eax
+  801d36:	05 20 d8 80 00       	add    $0x80d820,%eax
+  801d3b:	50                   	push   %eax
+  801d3c:	e8 29 33 00 00       	call   80506a <ipcring_server_init>
+  801d41:	83 c4 10             	add    $0x10,%esp
+  801d44:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  801d47:	e9 99 00 00 00       	jmp    801de5 <serve+0x459>
+  801d4c:	8b 1d 64 70 80 00    	mov    0x807064,%ebx
+  801d52:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801d55:	8b 03                	mov    (%ebx),%eax
+  801d57:	83 f8 0f             	cmp    $0xf,%eax
+  801d5a:	0f 87 47 01 00 00    	ja     801ea7 <serve+0x51b>
+  801d60:	83 7b 04 07          	cmpl   $0x7,0x4(%ebx)
+  801d64:	0f 87 49 01 00 00    	ja     801eb3 <serve+0x527>
+  801d6a:	83 ec 0c             	sub    $0xc,%esp
+  801d6d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801d70:	c1 e0 0c             	shl    $0xc,%eax
+  801d73:	2d 00 00 c0 2f       	sub    $0x2fc00000,%eax
+  801d78:	50                   	push   %eax
+  801d79:	e8 da 29 00 00       	call   804758 <pageref>
+  801d7e:	83 c4 10             	add    $0x10,%esp
+  801d81:	83 f8 01             	cmp    $0x1,%eax
+  801d84:	0f 8e 35 01 00 00    	jle    801ebf <serve+0x533>
+  801d8a:	8b 13                	mov    (%ebx),%edx
+  801d8c:	89 d0                	mov    %edx,%eax
+  801d8e:	c1 e0 04             	shl    $0x4,%eax
+  801d91:	3b b0 24 d8 80 00    	cmp    0x80d824(%eax),%esi
+  801d97:	0f 85 2e 01 00 00    	jne    801ecb <serve+0x53f>
+  801d9d:	83 ec 0c             	sub    $0xc,%esp
+  801da0:	57                   	push   %edi
+  801da1:	8b 43 04             	mov    0x4(%ebx),%eax
+  801da4:	83 c0 01             	add    $0x1,%eax
+  801da7:	c1 e0 0c             	shl    $0xc,%eax
+  801daa:	8d 14 d2             	lea    (%edx,%edx,8),%edx
+  801dad:	c1 e2 0c             	shl    $0xc,%edx
+  801db0:	8d 84 10 00 00 40 d0 	lea    -0x2fc00000(%eax,%edx,1),%eax
+  801db7:	50                   	push   %eax
+  801db8:	6a 00                	push   $0x0
+  801dba:	53                   	push   %ebx
+  801dbb:	6a 00                	push   $0x0
+  801dbd:	e8 52 12 00 00       	call   803014 <sys_page_map>
+  801dc2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dc5:	83 c4 20             	add    $0x20,%esp
+  801dc8:	eb 1b                	jmp    801de5 <serve+0x459>
+  801dca:	83 ec 04             	sub    $0x4,%esp
+  801dcd:	50                   	push   %eax
+  801dce:	ff 75 e4             	push   -0x1c(%ebp)
+  801dd1:	68 e0 58 80 00       	push   $0x8058e0
+  801dd6:	e8 9f 06 00 00       	call   80247a <cprintf>
+  801ddb:	83 c4 10             	add    $0x10,%esp
+  801dde:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801de5:	83 ec 08             	sub    $0x8,%esp
+  801de8:	ff 35 64 70 80 00    	push   0x807064
+  801dee:	6a 00                	push   $0x0
+  801df0:	e8 ae 12 00 00       	call   8030a3 <sys_page_unmap>
+  801df5:	83 c4 10             	add    $0x10,%esp
+  801df8:	e8 c2 f4 ff ff       	call   8012bf <serve_rings>
+  801dfd:	83 ec 04             	sub    $0x4,%esp
+  801e00:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e03:	50                   	push   %eax
+  801e04:	ff 35 64 70 80 00    	push   0x807064
+  801e0a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e0d:	50                   	push   %eax
+  801e0e:	ff 75 e0             	push   -0x20(%ebp)
+  801e11:	ff 75 dc             	push   -0x24(%ebp)
+  801e14:	ff 75 d4             	push   -0x2c(%ebp)
+  801e17:	ff 75 e4             	push   -0x1c(%ebp)
+  801e1a:	e8 35 1c 00 00       	call   803a54 <ipc_reply_recv>
+  801e1f:	83 c4 20             	add    $0x20,%esp
+  801e22:	8d 50 f3             	lea    -0xd(%eax),%edx
+  801e25:	83 fa 01             	cmp    $0x1,%edx
+  801e28:	0f 86 89 fb ff ff    	jbe    8019b7 <serve+0x2b>
+  801e2e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  801e35:	3d ff ff 7f 00       	cmp    $0x7fffff,%eax
+  801e3a:	0f 87 0b fc ff ff    	ja     801a4b <serve+0xbf>
+  801e40:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801e43:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  801e49:	0f 84 e3 fd ff ff    	je     801c32 <serve+0x2a6>
+  801e4f:	83 f8 01             	cmp    $0x1,%eax
+  801e52:	0f 84 0f fe ff ff    	je     801c67 <serve+0x2db>
+  801e58:	83 f8 0b             	cmp    $0xb,%eax
+  801e5b:	0f 84 27 fe ff ff    	je     801c88 <serve+0x2fc>
+  801e61:	83 f8 0c             	cmp    $0xc,%eax
+  801e64:	0f 84 e2 fe ff ff    	je     801d4c <serve+0x3c0>
+  801e6a:	83 f8 0f             	cmp    $0xf,%eax
+  801e6d:	0f 87 57 ff ff ff    	ja     801dca <serve+0x43e>
+  801e73:	8b 14 85 20 70 80 00 	mov    0x807020(,%eax,4),%edx
+  801e7a:	85 d2                	test   %edx,%edx
+  801e7c:	0f 84 48 ff ff ff    	je     801dca <serve+0x43e>
+  801e82:	83 ec 08             	sub    $0x8,%esp
+  801e85:	ff 35 64 70 80 00    	push   0x807064
+  801e8b:	ff 75 e4             	push   -0x1c(%ebp)
+  801e8e:	ff d2                	call   *%edx
+  801e90:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	e9 4a ff ff ff       	jmp    801de5 <serve+0x459>
+  801e9b:	c7 45 d4 f6 ff ff ff 	movl   $0xfffffff6,-0x2c(%ebp)
+  801ea2:	e9 3e ff ff ff       	jmp    801de5 <serve+0x459>
+  801ea7:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801eae:	e9 32 ff ff ff       	jmp    801de5 <serve+0x459>
+  801eb3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801eba:	e9 26 ff ff ff       	jmp    801de5 <serve+0x459>
+  801ebf:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801ec6:	e9 1a ff ff ff       	jmp    801de5 <serve+0x459>
+  801ecb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801ed2:	e9 0e ff ff ff       	jmp    801de5 <serve+0x459>
+
+00801ed7 <umain>:
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+  801eda:	83 ec 14             	sub    $0x14,%esp
+  801edd:	c7 05 80 b0 80 00 03 	movl   $0x805903,0x80b080
+  801ee4:	59 80 00 
+  801ee7:	68 06 59 80 00       	push   $0x805906
+  801eec:	e8 89 05 00 00       	call   80247a <cprintf>
+  801ef1:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  801ef6:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  801efb:	66 ef                	out    %ax,(%dx)
+  801efd:	c7 04 24 15 59 80 00 	movl   $0x805915,(%esp)
+  801f04:	e8 71 05 00 00       	call   80247a <cprintf>
+  801f09:	e8 99 f4 ff ff       	call   8013a7 <serve_init>
+  801f0e:	e8 b2 eb ff ff       	call   800ac5 <fs_init>
+  801f13:	e8 74 fa ff ff       	call   80198c <serve>
+
+00801f18 <fs_test>:
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	83 ec 1c             	sub    $0x1c,%esp
+  801f1e:	6a 07                	push   $0x7
+  801f20:	68 00 10 00 00       	push   $0x1000
+  801f25:	6a 00                	push   $0x0
+  801f27:	e8 a5 10 00 00       	call   802fd1 <sys_page_alloc>
+  801f2c:	83 c4 10             	add    $0x10,%esp
+  801f2f:	85 c0                	test   %eax,%eax
+  801f31:	0f 88 52 02 00 00    	js     802189 <fs_test+0x271>
+  801f37:	83 ec 04             	sub    $0x4,%esp
+  801f3a:	68 00 10 00 00       	push   $0x1000
+  801f3f:	ff 35 10 c0 80 00    	push   0x80c010
+  801f45:	68 00 10 00 00       	push   $0x1000
+  801f4a:	e8 d2 0d 00 00       	call   802d21 <memmove>
+  801f4f:	e8 bb e8 ff ff       	call   80080f <alloc_block>
+  801f54:	89 c1                	mov    %eax,%ecx
+  801f56:	83 c4 10             	add    $0x10,%esp
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	0f 88 3a 02 00 00    	js     80219b <fs_test+0x283>
+  801f61:	8d 40 1f             	lea    0x1f(%eax),%eax
+  801f64:	0f 49 c1             	cmovns %ecx,%eax
+  801f67:	c1 f8 05             	sar    $0x5,%eax
+  801f6a:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f6f:	d3 e2                	shl    %cl,%edx
+  801f71:	89 d1                	mov    %edx,%ecx
+  801f73:	23 0c 85 00 10 00 00 	and    0x1000(,%eax,4),%ecx
+  801f7a:	0f 84 2d 02 00 00    	je     8021ad <fs_test+0x295>
+  801f80:	8b 0d 10 c0 80 00    	mov    0x80c010,%ecx
+  801f86:	23 14 81             	and    (%ecx,%eax,4),%edx
+  801f89:	0f 85 34 02 00 00    	jne    8021c3 <fs_test+0x2ab>
+  801f8f:	83 ec 0c             	sub    $0xc,%esp
+  801f92:	68 6c 59 80 00       	push   $0x80596c
+  801f97:	e8 de 04 00 00       	call   80247a <cprintf>
+  801f9c:	83 c4 08             	add    $0x8,%esp
+  801f9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fa2:	50                   	push   %eax
+  801fa3:	68 81 59 80 00       	push   $0x805981
+  801fa8:	e8 e9 ed ff ff       	call   800d96 <file_open>
+  801fad:	83 c4 10             	add    $0x10,%esp
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	0f 88 21 02 00 00    	js     8021d9 <fs_test+0x2c1>
+  801fb8:	0f 84 36 02 00 00    	je     8021f4 <fs_test+0x2dc>
+  801fbe:	83 ec 08             	sub    $0x8,%esp
+  801fc1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc4:	50                   	push   %eax
+  801fc5:	68 a5 59 80 00       	push   $0x8059a5
+  801fca:	e8 c7 ed ff ff       	call   800d96 <file_open>
+  801fcf:	83 c4 10             	add    $0x10,%esp
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	0f 88 2e 02 00 00    	js     802208 <fs_test+0x2f0>
+  801fda:	83 ec 0c             	sub    $0xc,%esp
+  801fdd:	68 c5 59 80 00       	push   $0x8059c5
+  801fe2:	e8 93 04 00 00       	call   80247a <cprintf>
+  801fe7:	83 c4 0c             	add    $0xc,%esp
+  801fea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fed:	50                   	push   %eax
+  801fee:	6a 00                	push   $0x0
+  801ff0:	ff 75 f4             	push   -0xc(%ebp)
+  801ff3:	e8 2c eb ff ff       	call   800b24 <file_get_block>
+  801ff8:	83 c4 10             	add    $0x10,%esp
+  801ffb:	85 c0                	test   %eax,%eax
+  801ffd:	0f 88 17 02 00 00    	js     80221a <fs_test+0x302>
+  802003:	83 ec 08             	sub    $0x8,%esp
+  802006:	68 08 5b 80 00       	push   $0x805b08
+  80200b:	ff 75 f0             	push   -0x10(%ebp)
+  80200e:	e8 0e 0c 00 00       	call   802c21 <strcmp>
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	85 c0                	test   %eax,%eax
+  802018:	0f 85 0e 02 00 00    	jne    80222c <fs_test+0x314>
+  80201e:	83 ec 0c             	sub    $0xc,%esp
+  802021:	68 eb 59 80 00       	push   $0x8059eb
+  802026:	e8 4f 04 00 00       	call   80247a <cprintf>
+  80202b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80202e:	0f b6 10             	movzbl (%eax),%edx
+  802031:	88 10                	mov    %dl,(%eax)
+  802033:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802036:	c1 e8 0c             	shr    $0xc,%eax
+  802039:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	a8 40                	test   $0x40,%al
+  802045:	0f 84 f5 01 00 00    	je     802240 <fs_test+0x328>
+  80204b:	83 ec 0c             	sub    $0xc,%esp
+  80204e:	ff 75 f4             	push   -0xc(%ebp)
+  802051:	e8 1d ef ff ff       	call   800f73 <file_flush>
+  802056:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802059:	c1 e8 0c             	shr    $0xc,%eax
+  80205c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802063:	83 c4 10             	add    $0x10,%esp
+  802066:	a8 40                	test   $0x40,%al
+  802068:	0f 85 e8 01 00 00    	jne    802256 <fs_test+0x33e>
+  80206e:	83 ec 0c             	sub    $0xc,%esp
+  802071:	68 1e 5a 80 00       	push   $0x805a1e
+  802076:	e8 ff 03 00 00       	call   80247a <cprintf>
+  80207b:	83 c4 08             	add    $0x8,%esp
+  80207e:	6a 00                	push   $0x0
+  802080:	ff 75 f4             	push   -0xc(%ebp)
+  802083:	e8 dd ed ff ff       	call   800e65 <file_set_size>
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	0f 88 d9 01 00 00    	js     80226c <fs_test+0x354>
+  802093:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802096:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  80209d:	0f 85 db 01 00 00    	jne    80227e <fs_test+0x366>
+  8020a3:	c1 e8 0c             	shr    $0xc,%eax
+  8020a6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8020ad:	a8 40                	test   $0x40,%al
+  8020af:	0f 85 df 01 00 00    	jne    802294 <fs_test+0x37c>
+  8020b5:	83 ec 0c             	sub    $0xc,%esp
+  8020b8:	68 71 5a 80 00       	push   $0x805a71
+  8020bd:	e8 b8 03 00 00       	call   80247a <cprintf>
+  8020c2:	c7 04 24 08 5b 80 00 	movl   $0x805b08,(%esp)
+  8020c9:	e8 57 0a 00 00       	call   802b25 <strlen>
+  8020ce:	83 c4 08             	add    $0x8,%esp
+  8020d1:	50                   	push   %eax
+  8020d2:	ff 75 f4             	push   -0xc(%ebp)
+  8020d5:	e8 8b ed ff ff       	call   800e65 <file_set_size>
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	0f 88 c5 01 00 00    	js     8022aa <fs_test+0x392>
+  8020e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e8:	89 c2                	mov    %eax,%edx
+  8020ea:	c1 ea 0c             	shr    $0xc,%edx
+  8020ed:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8020f4:	f6 c2 40             	test   $0x40,%dl
+  8020f7:	0f 85 bf 01 00 00    	jne    8022bc <fs_test+0x3a4>
+  8020fd:	83 ec 04             	sub    $0x4,%esp
+  802100:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  802103:	52                   	push   %edx
+  802104:	6a 00                	push   $0x0
+  802106:	50                   	push   %eax
+  802107:	e8 18 ea ff ff       	call   800b24 <file_get_block>
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	85 c0                	test   %eax,%eax
+  802111:	0f 88 bb 01 00 00    	js     8022d2 <fs_test+0x3ba>
+  802117:	83 ec 08             	sub    $0x8,%esp
+  80211a:	68 08 5b 80 00       	push   $0x805b08
+  80211f:	ff 75 f0             	push   -0x10(%ebp)
+  802122:	e8 4a 0a 00 00       	call   802b71 <strcpy>
+  802127:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80212a:	c1 e8 0c             	shr    $0xc,%eax
+  80212d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802134:	83 c4 10             	add    $0x10,%esp
+  802137:	a8 40                	test   $0x40,%al
+  802139:	0f 84 a5 01 00 00    	je     8022e4 <fs_test+0x3cc>
+  80213f:	83 ec 0c             	sub    $0xc,%esp
+  802142:	ff 75 f4             	push   -0xc(%ebp)
+  802145:	e8 29 ee ff ff       	call   800f73 <file_flush>
+  80214a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80214d:	c1 e8 0c             	shr    $0xc,%eax
+  802150:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	a8 40                	test   $0x40,%al
+  80215c:	0f 85 98 01 00 00    	jne    8022fa <fs_test+0x3e2>
+  802162:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802165:	c1 e8 0c             	shr    $0xc,%eax
+  802168:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80216f:	a8 40                	test   $0x40,%al
+  802171:	0f 85 99 01 00 00    	jne    802310 <fs_test+0x3f8>
+  802177:	83 ec 0c             	sub    $0xc,%esp
+  80217a:	68 b1 5a 80 00       	push   $0x805ab1
+  80217f:	e8 f6 02 00 00       	call   80247a <cprintf>
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	c9                   	leave
+  802188:	c3                   	ret
+  802189:	50                   	push   %eax
+  80218a:	68 24 59 80 00       	push   $0x805924
+  80218f:	6a 13                	push   $0x13
+  802191:	68 37 59 80 00       	push   $0x805937
+  802196:	e8 04 02 00 00       	call   80239f <_panic>
+  80219b:	50                   	push   %eax
+  80219c:	68 41 59 80 00       	push   $0x805941
+  8021a1:	6a 18                	push   $0x18
+  8021a3:	68 37 59 80 00       	push   $0x805937
+  8021a8:	e8 f2 01 00 00       	call   80239f <_panic>
+  8021ad:	68 51 59 80 00       	push   $0x805951
+  8021b2:	68 3d 55 80 00       	push   $0x80553d
+  8021b7:	6a 1a                	push   $0x1a
+  8021b9:	68 37 59 80 00       	push   $0x805937
+  8021be:	e8 dc 01 00 00       	call   80239f <_panic>
+  8021c3:	68 c8 5a 80 00       	push   $0x805ac8
+  8021c8:	68 3d 55 80 00       	push   $0x80553d
+  8021cd:	6a 1c                	push   $0x1c
+  8021cf:	68 37 59 80 00       	push   $0x805937
+  8021d4:	e8 c6 01 00 00       	call   80239f <_panic>
+  8021d9:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8021dc:	0f 84 dc fd ff ff    	je     801fbe <fs_test+0xa6>
+  8021e2:	50                   	push   %eax
+  8021e3:	68 8c 59 80 00       	push   $0x80598c
+  8021e8:	6a 20                	push   $0x20
+  8021ea:	68 37 59 80 00       	push   $0x805937
+  8021ef:	e8 ab 01 00 00       	call   80239f <_panic>
+  8021f4:	83 ec 04             	sub    $0x4,%esp
+  8021f7:	68 e8 5a 80 00       	push   $0x805ae8
+  8021fc:	6a 22                	push   $0x22
+  8021fe:	68 37 59 80 00       	push   $0x805937
+  802203:	e8 97 01 00 00       	call   80239f <_panic>
+  802208:	50                   	push   %eax
+  802209:	68 ae 59 80 00       	push   $0x8059ae
+  80220e:	6a 24                	push   $0x24
+  802210:	68 37 59 80 00       	push   $0x805937
+  802215:	e8 85 01 00 00       	call   80239f <_panic>
+  80221a:	50                   	push   %eax
+  80221b:	68 d8 59 80 00       	push   $0x8059d8
+  802220:	6a 28                	push   $0x28
+  802222:	68 37 59 80 00       	push   $0x805937
+  802227:	e8 73 01 00 00       	call   80239f <_panic>
+  80222c:	83 ec 04             	sub    $0x4,%esp
+  80222f:	68 30 5b 80 00       	push   $0x805b30
+  802234:	6a 2a                	push   $0x2a
+  802236:	68 37 59 80 00       	push   $0x805937
+  80223b:	e8 5f 01 00 00       	call   80239f <_panic>
+  802240:	68 04 5a 80 00       	push   $0x805a04
+  802245:	68 3d 55 80 00       	push   $0x80553d
+  80224a:	6a 2e                	push   $0x2e
+  80224c:	68 37 59 80 00       	push   $0x805937
+  802251:	e8 49 01 00 00       	call   80239f <_panic>
+  802256:	68 03 5a 80 00       	push   $0x805a03
+  80225b:	68 3d 55 80 00       	push   $0x80553d
+  802260:	6a 30                	push   $0x30
+  802262:	68 37 59 80 00       	push   $0x805937
+  802267:	e8 33 01 00 00       	call   80239f <_panic>
+  80226c:	50                   	push   %eax
+  80226d:	68 32 5a 80 00       	push   $0x805a32
+  802272:	6a 34                	push   $0x34
+  802274:	68 37 59 80 00       	push   $0x805937
+  802279:	e8 21 01 00 00       	call   80239f <_panic>
+  80227e:	68 44 5a 80 00       	push   $0x805a44
+  802283:	68 3d 55 80 00       	push   $0x80553d
+  802288:	6a 35                	push   $0x35
+  80228a:	68 37 59 80 00       	push   $0x805937
+  80228f:	e8 0b 01 00 00       	call   80239f <_panic>
+  802294:	68 58 5a 80 00       	push   $0x805a58
+  802299:	68 3d 55 80 00       	push   $0x80553d
+  80229e:	6a 36                	push   $0x36
+  8022a0:	68 37 59 80 00       	push   $0x805937
+  8022a5:	e8 f5 00 00 00       	call   80239f <_panic>
+  8022aa:	50                   	push   %eax
+  8022ab:	68 88 5a 80 00       	push   $0x805a88
+  8022b0:	6a 3a                	push   $0x3a
+  8022b2:	68 37 59 80 00       	push   $0x805937
+  8022b7:	e8 e3 00 00 00       	call   80239f <_panic>
+  8022bc:	68 58 5a 80 00       	push   $0x805a58
+  8022c1:	68 3d 55 80 00       	push   $0x80553d
+  8022c6:	6a 3b                	push   $0x3b
+  8022c8:	68 37 59 80 00       	push   $0x805937
+  8022cd:	e8 cd 00 00 00       	call   80239f <_panic>
+  8022d2:	50                   	push   %eax
+  8022d3:	68 9c 5a 80 00       	push   $0x805a9c
+  8022d8:	6a 3d                	push   $0x3d
+  8022da:	68 37 59 80 00       	push   $0x805937
+  8022df:	e8 bb 00 00 00       	call   80239f <_panic>
+  8022e4:	68 04 5a 80 00       	push   $0x805a04
+  8022e9:	68 3d 55 80 00       	push   $0x80553d
+  8022ee:	6a 3f                	push   $0x3f
+  8022f0:	68 37 59 80 00       	push   $0x805937
+  8022f5:	e8 a5 00 00 00       	call   80239f <_panic>
+  8022fa:	68 03 5a 80 00       	push   $0x805a03
+  8022ff:	68 3d 55 80 00       	push   $0x80553d
+  802304:	6a 41                	push   $0x41
+  802306:	68 37 59 80 00       	push   $0x805937
+  80230b:	e8 8f 00 00 00       	call   80239f <_panic>
+  802310:	68 58 5a 80 00       	push   $0x805a58
+  802315:	68 3d 55 80 00       	push   $0x80553d
+  80231a:	6a 42                	push   $0x42
+  80231c:	68 37 59 80 00       	push   $0x805937
+  802321:	e8 79 00 00 00       	call   80239f <_panic>
+
+00802326 <libmain>:
+  802326:	55                   	push   %ebp
+  802327:	89 e5                	mov    %esp,%ebp
+  802329:	56                   	push   %esi
+  80232a:	53                   	push   %ebx
+  80232b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80232e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802331:	e8 31 0c 00 00       	call   802f67 <sys_getenvid>
+  802336:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80233b:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  802341:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802346:	a3 20 d9 80 00       	mov    %eax,0x80d920
+  80234b:	85 db                	test   %ebx,%ebx
+  80234d:	7e 07                	jle    802356 <libmain+0x30>
+  80234f:	8b 06                	mov    (%esi),%eax
+  802351:	a3 80 b0 80 00       	mov    %eax,0x80b080
+  802356:	83 ec 08             	sub    $0x8,%esp
+  802359:	56                   	push   %esi
+  80235a:	53                   	push   %ebx
+  80235b:	e8 77 fb ff ff       	call   801ed7 <umain>
+  802360:	e8 0a 00 00 00       	call   80236f <exit>
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80236b:	5b                   	pop    %ebx
+  80236c:	5e                   	pop    %esi
+  80236d:	5d                   	pop    %ebp
+  80236e:	c3                   	ret
+
+0080236f <exit>:
+  80236f:	55                   	push   %ebp
+  802370:	89 e5                	mov    %esp,%ebp
+  802372:	83 ec 08             	sub    $0x8,%esp
+  802375:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  80237a:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  802380:	85 c0                	test   %eax,%eax
+  802382:	75 14                	jne    802398 <exit+0x29>
+  802384:	e8 90 19 00 00       	call   803d19 <close_all>
+  802389:	83 ec 0c             	sub    $0xc,%esp
+  80238c:	6a 00                	push   $0x0
+  80238e:	e8 93 0b 00 00       	call   802f26 <sys_env_destroy>
+  802393:	83 c4 10             	add    $0x10,%esp
+  802396:	c9                   	leave
+  802397:	c3                   	ret
+  802398:	e8 f6 12 00 00       	call   803693 <sys_lease_complete>
+  80239d:	eb e5                	jmp    802384 <exit+0x15>
+
+0080239f <_panic>:
+  80239f:	55                   	push   %ebp
+  8023a0:	89 e5                	mov    %esp,%ebp
+  8023a2:	56                   	push   %esi
+  8023a3:	53                   	push   %ebx
+  8023a4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8023a7:	8b 35 80 b0 80 00    	mov    0x80b080,%esi
+  8023ad:	e8 b5 0b 00 00       	call   802f67 <sys_getenvid>
+  8023b2:	83 ec 0c             	sub    $0xc,%esp
+  8023b5:	ff 75 0c             	push   0xc(%ebp)
+  8023b8:	ff 75 08             	push   0x8(%ebp)
+  8023bb:	56                   	push   %esi
+  8023bc:	50                   	push   %eax
+  8023bd:	68 60 5b 80 00       	push   $0x805b60
+  8023c2:	e8 b3 00 00 00       	call   80247a <cprintf>
+  8023c7:	83 c4 18             	add    $0x18,%esp
+  8023ca:	53                   	push   %ebx
+  8023cb:	ff 75 10             	push   0x10(%ebp)
+  8023ce:	e8 56 00 00 00       	call   802429 <vcprintf>
+  8023d3:	c7 04 24 1d 57 80 00 	movl   $0x80571d,(%esp)
+  8023da:	e8 9b 00 00 00       	call   80247a <cprintf>
+  8023df:	83 c4 10             	add    $0x10,%esp
+  8023e2:	cc                   	int3
+  8023e3:	eb fd                	jmp    8023e2 <_panic+0x43>
+
+008023e5 <putch>:
+  8023e5:	55                   	push   %ebp
+  8023e6:	89 e5                	mov    %esp,%ebp
+  8023e8:	53                   	push   %ebx
+  8023e9:	83 ec 04             	sub    $0x4,%esp
+  8023ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023ef:	8b 13                	mov    (%ebx),%edx
+  8023f1:	8d 42 01             	lea    0x1(%edx),%eax
+  8023f4:	89 03                	mov    %eax,(%ebx)
+  8023f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023f9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8023fd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802402:	74 09                	je     80240d <putch+0x28>
+  802404:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  802408:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+  80240d:	83 ec 08             	sub    $0x8,%esp
+  802410:	68 ff 00 00 00       	push   $0xff
+  802415:	8d 43 08             	lea    0x8(%ebx),%eax
+  802418:	50                   	push   %eax
+  802419:	e8 cb 0a 00 00       	call   802ee9 <sys_cputs>
+  80241e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802424:	83 c4 10             	add    $0x10,%esp
+  802427:	eb db                	jmp    802404 <putch+0x1f>
+
+00802429 <vcprintf>:
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802432:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802439:	00 00 00 
+  80243c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802443:	00 00 00 
+  802446:	ff 75 0c             	push   0xc(%ebp)
+  802449:	ff 75 08             	push   0x8(%ebp)
+  80244c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802452:	50                   	push   %eax
+  802453:	68 e5 23 80 00       	push   $0x8023e5
+  802458:	e8 1c 01 00 00       	call   802579 <vprintfmt>
+  80245d:	83 c4 08             	add    $0x8,%esp
+  802460:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802466:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80246c:	50                   	push   %eax
+  80246d:	e8 77 0a 00 00       	call   802ee9 <sys_cputs>
+  802472:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802478:	c9                   	leave
+  802479:	c3                   	ret
+
+0080247a <cprintf>:
+  80247a:	55                   	push   %ebp
+  80247b:	89 e5                	mov    %esp,%ebp
+  80247d:	83 ec 10             	sub    $0x10,%esp
+  802480:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802483:	50                   	push   %eax
+  802484:	ff 75 08             	push   0x8(%ebp)
+  802487:	e8 9d ff ff ff       	call   802429 <vcprintf>
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+
+0080248e <printnum>:
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	57                   	push   %edi
+  802492:	56                   	push   %esi
+  802493:	53                   	push   %ebx
+  802494:	83 ec 1c             	sub    $0x1c,%esp
+  802497:	89 c3                	mov    %eax,%ebx
+  802499:	89 d6                	mov    %edx,%esi
+  80249b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024a1:	89 d1                	mov    %edx,%ecx
+  8024a3:	89 c2                	mov    %eax,%edx
+  8024a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024a8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024ab:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8024b1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8024b8:	39 c2                	cmp    %eax,%edx
+  8024ba:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8024bd:	73 4b                	jae    80250a <printnum+0x7c>
+  8024bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024c2:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8024c5:	85 ff                	test   %edi,%edi
+  8024c7:	7e 11                	jle    8024da <printnum+0x4c>
+  8024c9:	83 ec 08             	sub    $0x8,%esp
+  8024cc:	56                   	push   %esi
+  8024cd:	ff 75 18             	push   0x18(%ebp)
+  8024d0:	ff d3                	call   *%ebx
+  8024d2:	83 c4 10             	add    $0x10,%esp
+  8024d5:	83 ef 01             	sub    $0x1,%edi
+  8024d8:	75 ef                	jne    8024c9 <printnum+0x3b>
+  8024da:	83 ec 08             	sub    $0x8,%esp
+  8024dd:	56                   	push   %esi
+  8024de:	83 ec 04             	sub    $0x4,%esp
+  8024e1:	ff 75 e4             	push   -0x1c(%ebp)
+  8024e4:	ff 75 e0             	push   -0x20(%ebp)
+  8024e7:	ff 75 dc             	push   -0x24(%ebp)
+  8024ea:	ff 75 d8             	push   -0x28(%ebp)
+  8024ed:	e8 f3 2e 00 00       	call   8053e5 <__umoddi3>
+  8024f2:	83 c4 14             	add    $0x14,%esp
+  8024f5:	0f be 80 83 5b 80 00 	movsbl 0x805b83(%eax),%eax
+  8024fc:	50                   	push   %eax
+  8024fd:	ff d3                	call   *%ebx
+  8024ff:	83 c4 10             	add    $0x10,%esp
+  802502:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802505:	5b                   	pop    %ebx
+  802506:	5e                   	pop    %esi
+  802507:	5f                   	pop    %edi
+  802508:	5d                   	pop    %ebp
+  802509:	c3                   	ret
+  80250a:	83 ec 0c             	sub    $0xc,%esp
+  80250d:	ff 75 18             	push   0x18(%ebp)
+  802510:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802513:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802516:	52                   	push   %edx
+  802517:	50                   	push   %eax
+  802518:	83 ec 08             	sub    $0x8,%esp
+  80251b:	ff 75 e4             	push   -0x1c(%ebp)
+  80251e:	ff 75 e0             	push   -0x20(%ebp)
+  802521:	ff 75 dc             	push   -0x24(%ebp)
+  802524:	ff 75 d8             	push   -0x28(%ebp)
+  802527:	e8 9b 2e 00 00       	call   8053c7 <__udivdi3>
+  80252c:	83 c4 18             	add    $0x18,%esp
+  80252f:	52                   	push   %edx
+  802530:	50                   	push   %eax
+  802531:	89 f2                	mov    %esi,%edx
+  802533:	89 d8                	mov    %ebx,%eax
+  802535:	e8 54 ff ff ff       	call   80248e <printnum>
+  80253a:	83 c4 20             	add    $0x20,%esp
+  80253d:	eb 9b                	jmp    8024da <printnum+0x4c>
+
+0080253f <sprintputch>:
+  80253f:	55                   	push   %ebp
+  802540:	89 e5                	mov    %esp,%ebp
+  802542:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802545:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802549:	8b 10                	mov    (%eax),%edx
+  80254b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80254e:	73 0a                	jae    80255a <sprintputch+0x1b>
+  802550:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802553:	89 08                	mov    %ecx,(%eax)
+  802555:	8b 45 08             	mov    0x8(%ebp),%eax
+  802558:	88 02                	mov    %al,(%edx)
+  80255a:	5d                   	pop    %ebp
+  80255b:	c3                   	ret
+
+0080255c <printfmt>:
+  80255c:	55                   	push   %ebp
+  80255d:	89 e5                	mov    %esp,%ebp
+  80255f:	83 ec 08             	sub    $0x8,%esp
+  802562:	8d 45 14             	lea    0x14(%ebp),%eax
+  802565:	50                   	push   %eax
+  802566:	ff 75 10             	push   0x10(%ebp)
+  802569:	ff 75 0c             	push   0xc(%ebp)
+  80256c:	ff 75 08             	push   0x8(%ebp)
+  80256f:	e8 05 00 00 00       	call   802579 <vprintfmt>
+  802574:	83 c4 10             	add    $0x10,%esp
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+
+00802579 <vprintfmt>:
+  802579:	55                   	push   %ebp
+  80257a:	89 e5                	mov    %esp,%ebp
+  80257c:	57                   	push   %edi
+  80257d:	56                   	push   %esi
+  80257e:	53                   	push   %ebx
+  80257f:	83 ec 2c             	sub    $0x2c,%esp
+  802582:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802585:	89 df                	mov    %ebx,%edi
+  802587:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80258a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80258d:	8d 70 01             	lea    0x1(%eax),%esi
+  802590:	0f b6 00             	movzbl (%eax),%eax
+  802593:	83 f8 25             	cmp    $0x25,%eax
+  802596:	74 1e                	je     8025b6 <vprintfmt+0x3d>
+  802598:	85 c0                	test   %eax,%eax
+  80259a:	0f 84 15 05 00 00    	je     802ab5 <vprintfmt+0x53c>
+  8025a0:	83 ec 08             	sub    $0x8,%esp
+  8025a3:	53                   	push   %ebx
+  8025a4:	50                   	push   %eax
+  8025a5:	ff d7                	call   *%edi
+  8025a7:	83 c6 01             	add    $0x1,%esi
+  8025aa:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	83 f8 25             	cmp    $0x25,%eax
+  8025b4:	75 e2                	jne    802598 <vprintfmt+0x1f>
+  8025b6:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8025ba:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8025c1:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8025c8:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8025cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025d4:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8025d7:	8d 56 01             	lea    0x1(%esi),%edx
+  8025da:	0f b6 0e             	movzbl (%esi),%ecx
+  8025dd:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8025e0:	3c 55                	cmp    $0x55,%al
+  8025e2:	0f 87 3b 04 00 00    	ja     802a23 <vprintfmt+0x4aa>
+  8025e8:	0f b6 c0             	movzbl %al,%eax
+  8025eb:	ff 24 85 c0 5c 80 00 	jmp    *0x805cc0(,%eax,4)
+  8025f2:	89 75 10             	mov    %esi,0x10(%ebp)
+  8025f5:	eb 93                	jmp    80258a <vprintfmt+0x11>
+  8025f7:	89 d6                	mov    %edx,%esi
+  8025f9:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8025fd:	eb d8                	jmp    8025d7 <vprintfmt+0x5e>
+  8025ff:	89 d6                	mov    %edx,%esi
+  802601:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802605:	eb d0                	jmp    8025d7 <vprintfmt+0x5e>
+  802607:	0f b6 c9             	movzbl %cl,%ecx
+  80260a:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80260d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802610:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  802614:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802617:	83 f9 09             	cmp    $0x9,%ecx
+  80261a:	77 6f                	ja     80268b <vprintfmt+0x112>
+  80261c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80261f:	83 c2 01             	add    $0x1,%edx
+  802622:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802625:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  802629:	0f be 02             	movsbl (%edx),%eax
+  80262c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80262f:	83 fe 09             	cmp    $0x9,%esi
+  802632:	76 eb                	jbe    80261f <vprintfmt+0xa6>
+  802634:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802637:	89 d6                	mov    %edx,%esi
+  802639:	eb 13                	jmp    80264e <vprintfmt+0xd5>
+  80263b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80263e:	8b 00                	mov    (%eax),%eax
+  802640:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802643:	8b 45 14             	mov    0x14(%ebp),%eax
+  802646:	8d 40 04             	lea    0x4(%eax),%eax
+  802649:	89 45 14             	mov    %eax,0x14(%ebp)
+  80264c:	89 d6                	mov    %edx,%esi
+  80264e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802652:	79 83                	jns    8025d7 <vprintfmt+0x5e>
+  802654:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802657:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80265a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802661:	e9 71 ff ff ff       	jmp    8025d7 <vprintfmt+0x5e>
+  802666:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802669:	85 c9                	test   %ecx,%ecx
+  80266b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802670:	0f 49 c1             	cmovns %ecx,%eax
+  802673:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802676:	89 d6                	mov    %edx,%esi
+  802678:	e9 5a ff ff ff       	jmp    8025d7 <vprintfmt+0x5e>
+  80267d:	89 d6                	mov    %edx,%esi
+  80267f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  802686:	e9 4c ff ff ff       	jmp    8025d7 <vprintfmt+0x5e>
+  80268b:	89 d6                	mov    %edx,%esi
+  80268d:	eb bf                	jmp    80264e <vprintfmt+0xd5>
+  80268f:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802693:	89 d6                	mov    %edx,%esi
+  802695:	e9 3d ff ff ff       	jmp    8025d7 <vprintfmt+0x5e>
+  80269a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80269d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a0:	8d 70 04             	lea    0x4(%eax),%esi
+  8026a3:	83 ec 08             	sub    $0x8,%esp
+  8026a6:	53                   	push   %ebx
+  8026a7:	ff 30                	push   (%eax)
+  8026a9:	ff d7                	call   *%edi
+  8026ab:	83 c4 10             	add    $0x10,%esp
+  8026ae:	89 75 14             	mov    %esi,0x14(%ebp)
+  8026b1:	e9 d4 fe ff ff       	jmp    80258a <vprintfmt+0x11>
+  8026b6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026bc:	8d 70 04             	lea    0x4(%eax),%esi
+  8026bf:	8b 10                	mov    (%eax),%edx
+  8026c1:	89 d0                	mov    %edx,%eax
+  8026c3:	f7 d8                	neg    %eax
+  8026c5:	0f 48 c2             	cmovs  %edx,%eax
+  8026c8:	83 f8 12             	cmp    $0x12,%eax
+  8026cb:	7f 23                	jg     8026f0 <vprintfmt+0x177>
+  8026cd:	8b 14 85 20 5e 80 00 	mov    0x805e20(,%eax,4),%edx
+  8026d4:	85 d2                	test   %edx,%edx
+  8026d6:	74 18                	je     8026f0 <vprintfmt+0x177>
+  8026d8:	52                   	push   %edx
+  8026d9:	68 4f 55 80 00       	push   $0x80554f
+  8026de:	53                   	push   %ebx
+  8026df:	57                   	push   %edi
+  8026e0:	e8 77 fe ff ff       	call   80255c <printfmt>
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	89 75 14             	mov    %esi,0x14(%ebp)
+  8026eb:	e9 9a fe ff ff       	jmp    80258a <vprintfmt+0x11>
+  8026f0:	50                   	push   %eax
+  8026f1:	68 9b 5b 80 00       	push   $0x805b9b
+  8026f6:	53                   	push   %ebx
+  8026f7:	57                   	push   %edi
+  8026f8:	e8 5f fe ff ff       	call   80255c <printfmt>
+  8026fd:	83 c4 10             	add    $0x10,%esp
+  802700:	89 75 14             	mov    %esi,0x14(%ebp)
+  802703:	e9 82 fe ff ff       	jmp    80258a <vprintfmt+0x11>
+  802708:	89 55 10             	mov    %edx,0x10(%ebp)
+  80270b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80270e:	83 c0 04             	add    $0x4,%eax
+  802711:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802714:	8b 45 14             	mov    0x14(%ebp),%eax
+  802717:	8b 00                	mov    (%eax),%eax
+  802719:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	0f 84 61 03 00 00    	je     802a85 <vprintfmt+0x50c>
+  802724:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802728:	7e 06                	jle    802730 <vprintfmt+0x1b7>
+  80272a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80272e:	75 29                	jne    802759 <vprintfmt+0x1e0>
+  802730:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802733:	8d 70 01             	lea    0x1(%eax),%esi
+  802736:	0f b6 00             	movzbl (%eax),%eax
+  802739:	0f be d0             	movsbl %al,%edx
+  80273c:	85 d2                	test   %edx,%edx
+  80273e:	0f 84 bb 00 00 00    	je     8027ff <vprintfmt+0x286>
+  802744:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802747:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80274a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80274d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802750:	eb 7a                	jmp    8027cc <vprintfmt+0x253>
+  802752:	c7 45 d0 94 5b 80 00 	movl   $0x805b94,-0x30(%ebp)
+  802759:	83 ec 08             	sub    $0x8,%esp
+  80275c:	ff 75 d4             	push   -0x2c(%ebp)
+  80275f:	ff 75 d0             	push   -0x30(%ebp)
+  802762:	e8 e0 03 00 00       	call   802b47 <strnlen>
+  802767:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80276a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80276d:	83 c4 10             	add    $0x10,%esp
+  802770:	85 d2                	test   %edx,%edx
+  802772:	0f 8e d6 02 00 00    	jle    802a4e <vprintfmt+0x4d5>
+  802778:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80277c:	83 ec 08             	sub    $0x8,%esp
+  80277f:	53                   	push   %ebx
+  802780:	56                   	push   %esi
+  802781:	ff d7                	call   *%edi
+  802783:	83 c4 10             	add    $0x10,%esp
+  802786:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80278a:	75 f0                	jne    80277c <vprintfmt+0x203>
+  80278c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80278f:	8d 70 01             	lea    0x1(%eax),%esi
+  802792:	0f b6 00             	movzbl (%eax),%eax
+  802795:	0f be d0             	movsbl %al,%edx
+  802798:	85 d2                	test   %edx,%edx
+  80279a:	0f 84 da 02 00 00    	je     802a7a <vprintfmt+0x501>
+  8027a0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8027a3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8027a6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8027a9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8027ac:	eb 1e                	jmp    8027cc <vprintfmt+0x253>
+  8027ae:	83 ec 08             	sub    $0x8,%esp
+  8027b1:	ff 75 0c             	push   0xc(%ebp)
+  8027b4:	52                   	push   %edx
+  8027b5:	ff 55 08             	call   *0x8(%ebp)
+  8027b8:	83 c4 10             	add    $0x10,%esp
+  8027bb:	83 eb 01             	sub    $0x1,%ebx
+  8027be:	83 c6 01             	add    $0x1,%esi
+  8027c1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8027c5:	0f be d0             	movsbl %al,%edx
+  8027c8:	85 d2                	test   %edx,%edx
+  8027ca:	74 2a                	je     8027f6 <vprintfmt+0x27d>
+  8027cc:	85 ff                	test   %edi,%edi
+  8027ce:	78 05                	js     8027d5 <vprintfmt+0x25c>
+  8027d0:	83 ef 01             	sub    $0x1,%edi
+  8027d3:	78 59                	js     80282e <vprintfmt+0x2b5>
+  8027d5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8027d9:	74 d3                	je     8027ae <vprintfmt+0x235>
+  8027db:	0f be c0             	movsbl %al,%eax
+  8027de:	83 e8 20             	sub    $0x20,%eax
+  8027e1:	83 f8 5e             	cmp    $0x5e,%eax
+  8027e4:	76 c8                	jbe    8027ae <vprintfmt+0x235>
+  8027e6:	83 ec 08             	sub    $0x8,%esp
+  8027e9:	ff 75 0c             	push   0xc(%ebp)
+  8027ec:	6a 3f                	push   $0x3f
+  8027ee:	ff 55 08             	call   *0x8(%ebp)
+  8027f1:	83 c4 10             	add    $0x10,%esp
+  8027f4:	eb c5                	jmp    8027bb <vprintfmt+0x242>
+  8027f6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8027f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027ff:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802802:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802806:	7e 1b                	jle    802823 <vprintfmt+0x2aa>
+  802808:	83 ec 08             	sub    $0x8,%esp
+  80280b:	53                   	push   %ebx
+  80280c:	6a 20                	push   $0x20
+  80280e:	ff d7                	call   *%edi
+  802810:	83 c4 10             	add    $0x10,%esp
+  802813:	83 ee 01             	sub    $0x1,%esi
+  802816:	75 f0                	jne    802808 <vprintfmt+0x28f>
+  802818:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80281b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80281e:	e9 67 fd ff ff       	jmp    80258a <vprintfmt+0x11>
+  802823:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802826:	89 45 14             	mov    %eax,0x14(%ebp)
+  802829:	e9 5c fd ff ff       	jmp    80258a <vprintfmt+0x11>
+  80282e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802831:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802834:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802837:	eb c6                	jmp    8027ff <vprintfmt+0x286>
+  802839:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80283c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80283f:	83 f9 01             	cmp    $0x1,%ecx
+  802842:	7f 1f                	jg     802863 <vprintfmt+0x2ea>
+  802844:	85 c9                	test   %ecx,%ecx
+  802846:	74 67                	je     8028af <vprintfmt+0x336>
+  802848:	8b 45 14             	mov    0x14(%ebp),%eax
+  80284b:	8b 30                	mov    (%eax),%esi
+  80284d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802850:	89 f0                	mov    %esi,%eax
+  802852:	c1 f8 1f             	sar    $0x1f,%eax
+  802855:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802858:	8b 45 14             	mov    0x14(%ebp),%eax
+  80285b:	8d 40 04             	lea    0x4(%eax),%eax
+  80285e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802861:	eb 17                	jmp    80287a <vprintfmt+0x301>
+  802863:	8b 45 14             	mov    0x14(%ebp),%eax
+  802866:	8b 50 04             	mov    0x4(%eax),%edx
+  802869:	8b 00                	mov    (%eax),%eax
+  80286b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80286e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802871:	8b 45 14             	mov    0x14(%ebp),%eax
+  802874:	8d 40 08             	lea    0x8(%eax),%eax
+  802877:	89 45 14             	mov    %eax,0x14(%ebp)
+  80287a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80287d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802880:	be 0a 00 00 00       	mov    $0xa,%esi
+  802885:	85 c9                	test   %ecx,%ecx
+  802887:	0f 89 12 01 00 00    	jns    80299f <vprintfmt+0x426>
+  80288d:	83 ec 08             	sub    $0x8,%esp
+  802890:	53                   	push   %ebx
+  802891:	6a 2d                	push   $0x2d
+  802893:	ff d7                	call   *%edi
+  802895:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802898:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80289b:	f7 da                	neg    %edx
+  80289d:	83 d1 00             	adc    $0x0,%ecx
+  8028a0:	f7 d9                	neg    %ecx
+  8028a2:	83 c4 10             	add    $0x10,%esp
+  8028a5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8028aa:	e9 f0 00 00 00       	jmp    80299f <vprintfmt+0x426>
+  8028af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028b2:	8b 30                	mov    (%eax),%esi
+  8028b4:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8028b7:	89 f0                	mov    %esi,%eax
+  8028b9:	c1 f8 1f             	sar    $0x1f,%eax
+  8028bc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8028bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8028c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8028c8:	eb b0                	jmp    80287a <vprintfmt+0x301>
+  8028ca:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8028cd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8028d0:	83 f9 01             	cmp    $0x1,%ecx
+  8028d3:	7f 1e                	jg     8028f3 <vprintfmt+0x37a>
+  8028d5:	85 c9                	test   %ecx,%ecx
+  8028d7:	74 32                	je     80290b <vprintfmt+0x392>
+  8028d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028dc:	8b 10                	mov    (%eax),%edx
+  8028de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8028e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8028e9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8028ee:	e9 ac 00 00 00       	jmp    80299f <vprintfmt+0x426>
+  8028f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028f6:	8b 10                	mov    (%eax),%edx
+  8028f8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8028fb:	8d 40 08             	lea    0x8(%eax),%eax
+  8028fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  802901:	be 0a 00 00 00       	mov    $0xa,%esi
+  802906:	e9 94 00 00 00       	jmp    80299f <vprintfmt+0x426>
+  80290b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80290e:	8b 10                	mov    (%eax),%edx
+  802910:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802915:	8d 40 04             	lea    0x4(%eax),%eax
+  802918:	89 45 14             	mov    %eax,0x14(%ebp)
+  80291b:	be 0a 00 00 00       	mov    $0xa,%esi
+  802920:	eb 7d                	jmp    80299f <vprintfmt+0x426>
+  802922:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802925:	89 55 10             	mov    %edx,0x10(%ebp)
+  802928:	83 f9 01             	cmp    $0x1,%ecx
+  80292b:	7f 1b                	jg     802948 <vprintfmt+0x3cf>
+  80292d:	85 c9                	test   %ecx,%ecx
+  80292f:	74 2c                	je     80295d <vprintfmt+0x3e4>
+  802931:	8b 45 14             	mov    0x14(%ebp),%eax
+  802934:	8b 10                	mov    (%eax),%edx
+  802936:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80293b:	8d 40 04             	lea    0x4(%eax),%eax
+  80293e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802941:	be 08 00 00 00       	mov    $0x8,%esi
+  802946:	eb 57                	jmp    80299f <vprintfmt+0x426>
+  802948:	8b 45 14             	mov    0x14(%ebp),%eax
+  80294b:	8b 10                	mov    (%eax),%edx
+  80294d:	8b 48 04             	mov    0x4(%eax),%ecx
+  802950:	8d 40 08             	lea    0x8(%eax),%eax
+  802953:	89 45 14             	mov    %eax,0x14(%ebp)
+  802956:	be 08 00 00 00       	mov    $0x8,%esi
+  80295b:	eb 42                	jmp    80299f <vprintfmt+0x426>
+  80295d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802960:	8b 10                	mov    (%eax),%edx
+  802962:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802967:	8d 40 04             	lea    0x4(%eax),%eax
+  80296a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80296d:	be 08 00 00 00       	mov    $0x8,%esi
+  802972:	eb 2b                	jmp    80299f <vprintfmt+0x426>
+  802974:	89 55 10             	mov    %edx,0x10(%ebp)
+  802977:	83 ec 08             	sub    $0x8,%esp
+  80297a:	53                   	push   %ebx
+  80297b:	6a 30                	push   $0x30
+  80297d:	ff d7                	call   *%edi
+  80297f:	83 c4 08             	add    $0x8,%esp
+  802982:	53                   	push   %ebx
+  802983:	6a 78                	push   $0x78
+  802985:	ff d7                	call   *%edi
+  802987:	8b 45 14             	mov    0x14(%ebp),%eax
+  80298a:	8b 10                	mov    (%eax),%edx
+  80298c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802991:	83 c4 10             	add    $0x10,%esp
+  802994:	8d 40 04             	lea    0x4(%eax),%eax
+  802997:	89 45 14             	mov    %eax,0x14(%ebp)
+  80299a:	be 10 00 00 00       	mov    $0x10,%esi
+  80299f:	83 ec 0c             	sub    $0xc,%esp
+  8029a2:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8029a6:	50                   	push   %eax
+  8029a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8029aa:	56                   	push   %esi
+  8029ab:	51                   	push   %ecx
+  8029ac:	52                   	push   %edx
+  8029ad:	89 da                	mov    %ebx,%edx
+  8029af:	89 f8                	mov    %edi,%eax
+  8029b1:	e8 d8 fa ff ff       	call   80248e <printnum>
+  8029b6:	83 c4 20             	add    $0x20,%esp
+  8029b9:	e9 cc fb ff ff       	jmp    80258a <vprintfmt+0x11>
+  8029be:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8029c1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8029c4:	83 f9 01             	cmp    $0x1,%ecx
+  8029c7:	7f 1b                	jg     8029e4 <vprintfmt+0x46b>
+  8029c9:	85 c9                	test   %ecx,%ecx
+  8029cb:	74 2c                	je     8029f9 <vprintfmt+0x480>
+  8029cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029d0:	8b 10                	mov    (%eax),%edx
+  8029d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8029da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029dd:	be 10 00 00 00       	mov    $0x10,%esi
+  8029e2:	eb bb                	jmp    80299f <vprintfmt+0x426>
+  8029e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029e7:	8b 10                	mov    (%eax),%edx
+  8029e9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8029ec:	8d 40 08             	lea    0x8(%eax),%eax
+  8029ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029f2:	be 10 00 00 00       	mov    $0x10,%esi
+  8029f7:	eb a6                	jmp    80299f <vprintfmt+0x426>
+  8029f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029fc:	8b 10                	mov    (%eax),%edx
+  8029fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a03:	8d 40 04             	lea    0x4(%eax),%eax
+  802a06:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a09:	be 10 00 00 00       	mov    $0x10,%esi
+  802a0e:	eb 8f                	jmp    80299f <vprintfmt+0x426>
+  802a10:	89 55 10             	mov    %edx,0x10(%ebp)
+  802a13:	83 ec 08             	sub    $0x8,%esp
+  802a16:	53                   	push   %ebx
+  802a17:	6a 25                	push   $0x25
+  802a19:	ff d7                	call   *%edi
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	e9 67 fb ff ff       	jmp    80258a <vprintfmt+0x11>
+  802a23:	83 ec 08             	sub    $0x8,%esp
+  802a26:	53                   	push   %ebx
+  802a27:	6a 25                	push   $0x25
+  802a29:	ff d7                	call   *%edi
+  802a2b:	83 c4 10             	add    $0x10,%esp
+  802a2e:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  802a32:	0f 84 ba fb ff ff    	je     8025f2 <vprintfmt+0x79>
+  802a38:	89 75 10             	mov    %esi,0x10(%ebp)
+  802a3b:	89 f0                	mov    %esi,%eax
+  802a3d:	83 e8 01             	sub    $0x1,%eax
+  802a40:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802a44:	75 f7                	jne    802a3d <vprintfmt+0x4c4>
+  802a46:	89 45 10             	mov    %eax,0x10(%ebp)
+  802a49:	e9 3c fb ff ff       	jmp    80258a <vprintfmt+0x11>
+  802a4e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802a51:	8d 70 01             	lea    0x1(%eax),%esi
+  802a54:	0f b6 00             	movzbl (%eax),%eax
+  802a57:	0f be d0             	movsbl %al,%edx
+  802a5a:	85 d2                	test   %edx,%edx
+  802a5c:	74 11                	je     802a6f <vprintfmt+0x4f6>
+  802a5e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802a61:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802a64:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802a67:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802a6a:	e9 5d fd ff ff       	jmp    8027cc <vprintfmt+0x253>
+  802a6f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802a72:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a75:	e9 10 fb ff ff       	jmp    80258a <vprintfmt+0x11>
+  802a7a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802a7d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a80:	e9 05 fb ff ff       	jmp    80258a <vprintfmt+0x11>
+  802a85:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802a89:	7e 0a                	jle    802a95 <vprintfmt+0x51c>
+  802a8b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802a8f:	0f 85 bd fc ff ff    	jne    802752 <vprintfmt+0x1d9>
+  802a95:	ba 28 00 00 00       	mov    $0x28,%edx
+  802a9a:	b8 28 00 00 00       	mov    $0x28,%eax
+  802a9f:	be 95 5b 80 00       	mov    $0x805b95,%esi
+  802aa4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802aa7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802aaa:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802aad:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ab0:	e9 17 fd ff ff       	jmp    8027cc <vprintfmt+0x253>
+  802ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab8:	5b                   	pop    %ebx
+  802ab9:	5e                   	pop    %esi
+  802aba:	5f                   	pop    %edi
+  802abb:	5d                   	pop    %ebp
+  802abc:	c3                   	ret
+
+00802abd <vsnprintf>:
+  802abd:	55                   	push   %ebp
+  802abe:	89 e5                	mov    %esp,%ebp
+  802ac0:	83 ec 18             	sub    $0x18,%esp
+  802ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ac9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802acc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802ad0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802ad3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  802ada:	85 c0                	test   %eax,%eax
+  802adc:	74 26                	je     802b04 <vsnprintf+0x47>
+  802ade:	85 d2                	test   %edx,%edx
+  802ae0:	7e 22                	jle    802b04 <vsnprintf+0x47>
+  802ae2:	ff 75 14             	push   0x14(%ebp)
+  802ae5:	ff 75 10             	push   0x10(%ebp)
+  802ae8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802aeb:	50                   	push   %eax
+  802aec:	68 3f 25 80 00       	push   $0x80253f
+  802af1:	e8 83 fa ff ff       	call   802579 <vprintfmt>
+  802af6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802af9:	c6 00 00             	movb   $0x0,(%eax)
+  802afc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aff:	83 c4 10             	add    $0x10,%esp
+  802b02:	c9                   	leave
+  802b03:	c3                   	ret
+  802b04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b09:	eb f7                	jmp    802b02 <vsnprintf+0x45>
+
+00802b0b <snprintf>:
+  802b0b:	55                   	push   %ebp
+  802b0c:	89 e5                	mov    %esp,%ebp
+  802b0e:	83 ec 08             	sub    $0x8,%esp
+  802b11:	8d 45 14             	lea    0x14(%ebp),%eax
+  802b14:	50                   	push   %eax
+  802b15:	ff 75 10             	push   0x10(%ebp)
+  802b18:	ff 75 0c             	push   0xc(%ebp)
+  802b1b:	ff 75 08             	push   0x8(%ebp)
+  802b1e:	e8 9a ff ff ff       	call   802abd <vsnprintf>
+  802b23:	c9                   	leave
+  802b24:	c3                   	ret
+
+00802b25 <strlen>:
+  802b25:	55                   	push   %ebp
+  802b26:	89 e5                	mov    %esp,%ebp
+  802b28:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b2b:	80 3a 00             	cmpb   $0x0,(%edx)
+  802b2e:	74 10                	je     802b40 <strlen+0x1b>
+  802b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b35:	83 c0 01             	add    $0x1,%eax
+  802b38:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802b3c:	75 f7                	jne    802b35 <strlen+0x10>
+  802b3e:	5d                   	pop    %ebp
+  802b3f:	c3                   	ret
+  802b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b45:	eb f7                	jmp    802b3e <strlen+0x19>
+
+00802b47 <strnlen>:
+  802b47:	55                   	push   %ebp
+  802b48:	89 e5                	mov    %esp,%ebp
+  802b4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b50:	85 d2                	test   %edx,%edx
+  802b52:	74 16                	je     802b6a <strnlen+0x23>
+  802b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b59:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802b5d:	74 09                	je     802b68 <strnlen+0x21>
+  802b5f:	83 c0 01             	add    $0x1,%eax
+  802b62:	39 d0                	cmp    %edx,%eax
+  802b64:	75 f3                	jne    802b59 <strnlen+0x12>
+  802b66:	89 d0                	mov    %edx,%eax
+  802b68:	5d                   	pop    %ebp
+  802b69:	c3                   	ret
+  802b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6f:	eb f7                	jmp    802b68 <strnlen+0x21>
+
+00802b71 <strcpy>:
+  802b71:	55                   	push   %ebp
+  802b72:	89 e5                	mov    %esp,%ebp
+  802b74:	53                   	push   %ebx
+  802b75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802b84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802b87:	83 c0 01             	add    $0x1,%eax
+  802b8a:	84 d2                	test   %dl,%dl
+  802b8c:	75 f2                	jne    802b80 <strcpy+0xf>
+  802b8e:	89 c8                	mov    %ecx,%eax
+  802b90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b93:	c9                   	leave
+  802b94:	c3                   	ret
+
+00802b95 <strcat>:
+  802b95:	55                   	push   %ebp
+  802b96:	89 e5                	mov    %esp,%ebp
+  802b98:	53                   	push   %ebx
+  802b99:	83 ec 10             	sub    $0x10,%esp
+  802b9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b9f:	53                   	push   %ebx
+  802ba0:	e8 80 ff ff ff       	call   802b25 <strlen>
+  802ba5:	83 c4 08             	add    $0x8,%esp
+  802ba8:	ff 75 0c             	push   0xc(%ebp)
+  802bab:	01 d8                	add    %ebx,%eax
+  802bad:	50                   	push   %eax
+  802bae:	e8 be ff ff ff       	call   802b71 <strcpy>
+  802bb3:	89 d8                	mov    %ebx,%eax
+  802bb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb8:	c9                   	leave
+  802bb9:	c3                   	ret
+
+00802bba <strncpy>:
+  802bba:	55                   	push   %ebp
+  802bbb:	89 e5                	mov    %esp,%ebp
+  802bbd:	56                   	push   %esi
+  802bbe:	53                   	push   %ebx
+  802bbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  802bc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bc8:	85 db                	test   %ebx,%ebx
+  802bca:	74 17                	je     802be3 <strncpy+0x29>
+  802bcc:	01 f3                	add    %esi,%ebx
+  802bce:	89 f0                	mov    %esi,%eax
+  802bd0:	83 c0 01             	add    $0x1,%eax
+  802bd3:	0f b6 0a             	movzbl (%edx),%ecx
+  802bd6:	88 48 ff             	mov    %cl,-0x1(%eax)
+  802bd9:	80 f9 01             	cmp    $0x1,%cl
+  802bdc:	83 da ff             	sbb    $0xffffffff,%edx
+  802bdf:	39 c3                	cmp    %eax,%ebx
+  802be1:	75 ed                	jne    802bd0 <strncpy+0x16>
+  802be3:	89 f0                	mov    %esi,%eax
+  802be5:	5b                   	pop    %ebx
+  802be6:	5e                   	pop    %esi
+  802be7:	5d                   	pop    %ebp
+  802be8:	c3                   	ret
+
+00802be9 <strlcpy>:
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	56                   	push   %esi
+  802bed:	53                   	push   %ebx
+  802bee:	8b 75 08             	mov    0x8(%ebp),%esi
+  802bf1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bf4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bf7:	89 f0                	mov    %esi,%eax
+  802bf9:	85 db                	test   %ebx,%ebx
+  802bfb:	74 1e                	je     802c1b <strlcpy+0x32>
+  802bfd:	83 eb 01             	sub    $0x1,%ebx
+  802c00:	74 16                	je     802c18 <strlcpy+0x2f>
+  802c02:	01 f3                	add    %esi,%ebx
+  802c04:	0f b6 0a             	movzbl (%edx),%ecx
+  802c07:	84 c9                	test   %cl,%cl
+  802c09:	74 0d                	je     802c18 <strlcpy+0x2f>
+  802c0b:	83 c2 01             	add    $0x1,%edx
+  802c0e:	83 c0 01             	add    $0x1,%eax
+  802c11:	88 48 ff             	mov    %cl,-0x1(%eax)
+  802c14:	39 d8                	cmp    %ebx,%eax
+  802c16:	75 ec                	jne    802c04 <strlcpy+0x1b>
+  802c18:	c6 00 00             	movb   $0x0,(%eax)
+  802c1b:	29 f0                	sub    %esi,%eax
+  802c1d:	5b                   	pop    %ebx
+  802c1e:	5e                   	pop    %esi
+  802c1f:	5d                   	pop    %ebp
+  802c20:	c3                   	ret
+
+00802c21 <strcmp>:
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c2a:	0f b6 01             	movzbl (%ecx),%eax
+  802c2d:	84 c0                	test   %al,%al
+  802c2f:	74 11                	je     802c42 <strcmp+0x21>
+  802c31:	38 02                	cmp    %al,(%edx)
+  802c33:	75 0d                	jne    802c42 <strcmp+0x21>
+  802c35:	83 c1 01             	add    $0x1,%ecx
+  802c38:	83 c2 01             	add    $0x1,%edx
+  802c3b:	0f b6 01             	movzbl (%ecx),%eax
+  802c3e:	84 c0                	test   %al,%al
+  802c40:	75 ef                	jne    802c31 <strcmp+0x10>
+  802c42:	0f b6 c0             	movzbl %al,%eax
+  802c45:	0f b6 12             	movzbl (%edx),%edx
+  802c48:	29 d0                	sub    %edx,%eax
+  802c4a:	5d                   	pop    %ebp
+  802c4b:	c3                   	ret
+
+00802c4c <strncmp>:
+  802c4c:	55                   	push   %ebp
+  802c4d:	89 e5                	mov    %esp,%ebp
+  802c4f:	53                   	push   %ebx
+  802c50:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802c56:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5e:	85 d2                	test   %edx,%edx
+  802c60:	74 2e                	je     802c90 <strncmp+0x44>
+  802c62:	0f b6 01             	movzbl (%ecx),%eax
+  802c65:	84 c0                	test   %al,%al
+  802c67:	74 16                	je     802c7f <strncmp+0x33>
+  802c69:	3a 03                	cmp    (%ebx),%al
+  802c6b:	75 12                	jne    802c7f <strncmp+0x33>
+  802c6d:	83 c1 01             	add    $0x1,%ecx
+  802c70:	83 c3 01             	add    $0x1,%ebx
+  802c73:	83 ea 01             	sub    $0x1,%edx
+  802c76:	75 ea                	jne    802c62 <strncmp+0x16>
+  802c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7d:	eb 11                	jmp    802c90 <strncmp+0x44>
+  802c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c84:	85 d2                	test   %edx,%edx
+  802c86:	74 08                	je     802c90 <strncmp+0x44>
+  802c88:	0f b6 01             	movzbl (%ecx),%eax
+  802c8b:	0f b6 13             	movzbl (%ebx),%edx
+  802c8e:	29 d0                	sub    %edx,%eax
+  802c90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c93:	c9                   	leave
+  802c94:	c3                   	ret
+
+00802c95 <strchr>:
+  802c95:	55                   	push   %ebp
+  802c96:	89 e5                	mov    %esp,%ebp
+  802c98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802c9f:	0f b6 10             	movzbl (%eax),%edx
+  802ca2:	84 d2                	test   %dl,%dl
+  802ca4:	74 15                	je     802cbb <strchr+0x26>
+  802ca6:	38 d1                	cmp    %dl,%cl
+  802ca8:	74 0f                	je     802cb9 <strchr+0x24>
+  802caa:	83 c0 01             	add    $0x1,%eax
+  802cad:	0f b6 10             	movzbl (%eax),%edx
+  802cb0:	84 d2                	test   %dl,%dl
+  802cb2:	75 f2                	jne    802ca6 <strchr+0x11>
+  802cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb9:	5d                   	pop    %ebp
+  802cba:	c3                   	ret
+  802cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc0:	eb f7                	jmp    802cb9 <strchr+0x24>
+
+00802cc2 <strfind>:
+  802cc2:	55                   	push   %ebp
+  802cc3:	89 e5                	mov    %esp,%ebp
+  802cc5:	53                   	push   %ebx
+  802cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ccc:	0f b6 18             	movzbl (%eax),%ebx
+  802ccf:	38 d3                	cmp    %dl,%bl
+  802cd1:	74 14                	je     802ce7 <strfind+0x25>
+  802cd3:	89 d1                	mov    %edx,%ecx
+  802cd5:	84 db                	test   %bl,%bl
+  802cd7:	74 0e                	je     802ce7 <strfind+0x25>
+  802cd9:	83 c0 01             	add    $0x1,%eax
+  802cdc:	0f b6 10             	movzbl (%eax),%edx
+  802cdf:	38 ca                	cmp    %cl,%dl
+  802ce1:	74 04                	je     802ce7 <strfind+0x25>
+  802ce3:	84 d2                	test   %dl,%dl
+  802ce5:	75 f2                	jne    802cd9 <strfind+0x17>
+  802ce7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cea:	c9                   	leave
+  802ceb:	c3                   	ret
+
+00802cec <memset>:
+  802cec:	55                   	push   %ebp
+  802ced:	89 e5                	mov    %esp,%ebp
+  802cef:	57                   	push   %edi
+  802cf0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cf3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802cf6:	85 c9                	test   %ecx,%ecx
+  802cf8:	74 20                	je     802d1a <memset+0x2e>
+  802cfa:	89 f8                	mov    %edi,%eax
+  802cfc:	09 c8                	or     %ecx,%eax
+  802cfe:	a8 03                	test   $0x3,%al
+  802d00:	75 12                	jne    802d14 <memset+0x28>
+  802d02:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d06:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802d0c:	c1 e9 02             	shr    $0x2,%ecx
+  802d0f:	fc                   	cld
+  802d10:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d12:	eb 06                	jmp    802d1a <memset+0x2e>
+  802d14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d17:	fc                   	cld
+  802d18:	f3 aa                	rep stos %al,%es:(%edi)
+  802d1a:	89 f8                	mov    %edi,%eax
+  802d1c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d1f:	c9                   	leave
+  802d20:	c3                   	ret
+
+00802d21 <memmove>:
+  802d21:	55                   	push   %ebp
+  802d22:	89 e5                	mov    %esp,%ebp
+  802d24:	57                   	push   %edi
+  802d25:	56                   	push   %esi
+  802d26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d29:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d2c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802d2f:	39 c6                	cmp    %eax,%esi
+  802d31:	73 32                	jae    802d65 <memmove+0x44>
+  802d33:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802d36:	39 d0                	cmp    %edx,%eax
+  802d38:	73 2b                	jae    802d65 <memmove+0x44>
+  802d3a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802d3d:	89 d6                	mov    %edx,%esi
+  802d3f:	09 fe                	or     %edi,%esi
+  802d41:	09 ce                	or     %ecx,%esi
+  802d43:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802d49:	75 0e                	jne    802d59 <memmove+0x38>
+  802d4b:	83 ef 04             	sub    $0x4,%edi
+  802d4e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802d51:	c1 e9 02             	shr    $0x2,%ecx
+  802d54:	fd                   	std
+  802d55:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802d57:	eb 09                	jmp    802d62 <memmove+0x41>
+  802d59:	83 ef 01             	sub    $0x1,%edi
+  802d5c:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802d5f:	fd                   	std
+  802d60:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802d62:	fc                   	cld
+  802d63:	eb 1a                	jmp    802d7f <memmove+0x5e>
+  802d65:	89 f2                	mov    %esi,%edx
+  802d67:	09 c2                	or     %eax,%edx
+  802d69:	09 ca                	or     %ecx,%edx
+  802d6b:	f6 c2 03             	test   $0x3,%dl
+  802d6e:	75 0a                	jne    802d7a <memmove+0x59>
+  802d70:	c1 e9 02             	shr    $0x2,%ecx
+  802d73:	89 c7                	mov    %eax,%edi
+  802d75:	fc                   	cld
+  802d76:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802d78:	eb 05                	jmp    802d7f <memmove+0x5e>
+  802d7a:	89 c7                	mov    %eax,%edi
+  802d7c:	fc                   	cld
+  802d7d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802d7f:	5e                   	pop    %esi
+  802d80:	5f                   	pop    %edi
+  802d81:	5d                   	pop    %ebp
+  802d82:	c3                   	ret
+
+00802d83 <memcpy>:
+  802d83:	55                   	push   %ebp
+  802d84:	89 e5                	mov    %esp,%ebp
+  802d86:	83 ec 0c             	sub    $0xc,%esp
+  802d89:	ff 75 10             	push   0x10(%ebp)
+  802d8c:	ff 75 0c             	push   0xc(%ebp)
+  802d8f:	ff 75 08             	push   0x8(%ebp)
+  802d92:	e8 8a ff ff ff       	call   802d21 <memmove>
+  802d97:	c9                   	leave
+  802d98:	c3                   	ret
+
+00802d99 <memcmp>:
+  802d99:	55                   	push   %ebp
+  802d9a:	89 e5                	mov    %esp,%ebp
+  802d9c:	56                   	push   %esi
+  802d9d:	53                   	push   %ebx
+  802d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802da4:	8b 75 10             	mov    0x10(%ebp),%esi
+  802da7:	85 f6                	test   %esi,%esi
+  802da9:	74 29                	je     802dd4 <memcmp+0x3b>
+  802dab:	01 c6                	add    %eax,%esi
+  802dad:	0f b6 08             	movzbl (%eax),%ecx
+  802db0:	0f b6 1a             	movzbl (%edx),%ebx
+  802db3:	38 d9                	cmp    %bl,%cl
+  802db5:	75 11                	jne    802dc8 <memcmp+0x2f>
+  802db7:	83 c0 01             	add    $0x1,%eax
+  802dba:	83 c2 01             	add    $0x1,%edx
+  802dbd:	39 c6                	cmp    %eax,%esi
+  802dbf:	75 ec                	jne    802dad <memcmp+0x14>
+  802dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc6:	eb 08                	jmp    802dd0 <memcmp+0x37>
+  802dc8:	0f b6 c1             	movzbl %cl,%eax
+  802dcb:	0f b6 db             	movzbl %bl,%ebx
+  802dce:	29 d8                	sub    %ebx,%eax
+  802dd0:	5b                   	pop    %ebx
+  802dd1:	5e                   	pop    %esi
+  802dd2:	5d                   	pop    %ebp
+  802dd3:	c3                   	ret
+  802dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd9:	eb f5                	jmp    802dd0 <memcmp+0x37>
+
+00802ddb <memfind>:
+  802ddb:	55                   	push   %ebp
+  802ddc:	89 e5                	mov    %esp,%ebp
+  802dde:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802de4:	89 c2                	mov    %eax,%edx
+  802de6:	03 55 10             	add    0x10(%ebp),%edx
+  802de9:	39 d0                	cmp    %edx,%eax
+  802deb:	73 0d                	jae    802dfa <memfind+0x1f>
+  802ded:	38 08                	cmp    %cl,(%eax)
+  802def:	74 0d                	je     802dfe <memfind+0x23>
+  802df1:	83 c0 01             	add    $0x1,%eax
+  802df4:	39 c2                	cmp    %eax,%edx
+  802df6:	75 f5                	jne    802ded <memfind+0x12>
+  802df8:	eb 06                	jmp    802e00 <memfind+0x25>
+  802dfa:	89 c2                	mov    %eax,%edx
+  802dfc:	eb 02                	jmp    802e00 <memfind+0x25>
+  802dfe:	89 c2                	mov    %eax,%edx
+  802e00:	89 d0                	mov    %edx,%eax
+  802e02:	5d                   	pop    %ebp
+  802e03:	c3                   	ret
+
+00802e04 <strtol>:
+  802e04:	55                   	push   %ebp
+  802e05:	89 e5                	mov    %esp,%ebp
+  802e07:	57                   	push   %edi
+  802e08:	56                   	push   %esi
+  802e09:	53                   	push   %ebx
+  802e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e10:	0f b6 02             	movzbl (%edx),%eax
+  802e13:	3c 20                	cmp    $0x20,%al
+  802e15:	74 04                	je     802e1b <strtol+0x17>
+  802e17:	3c 09                	cmp    $0x9,%al
+  802e19:	75 0e                	jne    802e29 <strtol+0x25>
+  802e1b:	83 c2 01             	add    $0x1,%edx
+  802e1e:	0f b6 02             	movzbl (%edx),%eax
+  802e21:	3c 20                	cmp    $0x20,%al
+  802e23:	74 f6                	je     802e1b <strtol+0x17>
+  802e25:	3c 09                	cmp    $0x9,%al
+  802e27:	74 f2                	je     802e1b <strtol+0x17>
+  802e29:	3c 2b                	cmp    $0x2b,%al
+  802e2b:	74 2a                	je     802e57 <strtol+0x53>
+  802e2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e32:	3c 2d                	cmp    $0x2d,%al
+  802e34:	74 2b                	je     802e61 <strtol+0x5d>
+  802e36:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e3c:	75 0f                	jne    802e4d <strtol+0x49>
+  802e3e:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e41:	74 28                	je     802e6b <strtol+0x67>
+  802e43:	85 db                	test   %ebx,%ebx
+  802e45:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e4a:	0f 44 d8             	cmove  %eax,%ebx
+  802e4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e52:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802e55:	eb 46                	jmp    802e9d <strtol+0x99>
+  802e57:	83 c2 01             	add    $0x1,%edx
+  802e5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5f:	eb d5                	jmp    802e36 <strtol+0x32>
+  802e61:	83 c2 01             	add    $0x1,%edx
+  802e64:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e69:	eb cb                	jmp    802e36 <strtol+0x32>
+  802e6b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802e6f:	74 0e                	je     802e7f <strtol+0x7b>
+  802e71:	85 db                	test   %ebx,%ebx
+  802e73:	75 d8                	jne    802e4d <strtol+0x49>
+  802e75:	83 c2 01             	add    $0x1,%edx
+  802e78:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802e7d:	eb ce                	jmp    802e4d <strtol+0x49>
+  802e7f:	83 c2 02             	add    $0x2,%edx
+  802e82:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802e87:	eb c4                	jmp    802e4d <strtol+0x49>
+  802e89:	0f be c0             	movsbl %al,%eax
+  802e8c:	83 e8 30             	sub    $0x30,%eax
+  802e8f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e92:	7d 3a                	jge    802ece <strtol+0xca>
+  802e94:	83 c2 01             	add    $0x1,%edx
+  802e97:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802e9b:	01 c1                	add    %eax,%ecx
+  802e9d:	0f b6 02             	movzbl (%edx),%eax
+  802ea0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802ea3:	89 f3                	mov    %esi,%ebx
+  802ea5:	80 fb 09             	cmp    $0x9,%bl
+  802ea8:	76 df                	jbe    802e89 <strtol+0x85>
+  802eaa:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802ead:	89 f3                	mov    %esi,%ebx
+  802eaf:	80 fb 19             	cmp    $0x19,%bl
+  802eb2:	77 08                	ja     802ebc <strtol+0xb8>
+  802eb4:	0f be c0             	movsbl %al,%eax
+  802eb7:	83 e8 57             	sub    $0x57,%eax
+  802eba:	eb d3                	jmp    802e8f <strtol+0x8b>
+  802ebc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802ebf:	89 f3                	mov    %esi,%ebx
+  802ec1:	80 fb 19             	cmp    $0x19,%bl
+  802ec4:	77 08                	ja     802ece <strtol+0xca>
+  802ec6:	0f be c0             	movsbl %al,%eax
+  802ec9:	83 e8 37             	sub    $0x37,%eax
+  802ecc:	eb c1                	jmp    802e8f <strtol+0x8b>
+  802ece:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802ed2:	74 05                	je     802ed9 <strtol+0xd5>
+  802ed4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ed7:	89 10                	mov    %edx,(%eax)
+  802ed9:	89 c8                	mov    %ecx,%eax
+  802edb:	f7 d8                	neg    %eax
+  802edd:	85 ff                	test   %edi,%edi
+  802edf:	0f 45 c8             	cmovne %eax,%ecx
+  802ee2:	89 c8                	mov    %ecx,%eax
+  802ee4:	5b                   	pop    %ebx
+  802ee5:	5e                   	pop    %esi
+  802ee6:	5f                   	pop    %edi
+  802ee7:	5d                   	pop    %ebp
+  802ee8:	c3                   	ret
+
+00802ee9 <sys_cputs>:
+  802ee9:	55                   	push   %ebp
+  802eea:	89 e5                	mov    %esp,%ebp
+  802eec:	57                   	push   %edi
+  802eed:	56                   	push   %esi
+  802eee:	53                   	push   %ebx
+  802eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802efa:	89 c3                	mov    %eax,%ebx
+  802efc:	89 c7                	mov    %eax,%edi
+  802efe:	89 c6                	mov    %eax,%esi
+  802f00:	cd 30                	int    $0x30
+  802f02:	5b                   	pop    %ebx
+  802f03:	5e                   	pop    %esi
+  802f04:	5f                   	pop    %edi
+  802f05:	5d                   	pop    %ebp
+  802f06:	c3                   	ret
+
+00802f07 <sys_cgetc>:
+  802f07:	55                   	push   %ebp
+  802f08:	89 e5                	mov    %esp,%ebp
+  802f0a:	57                   	push   %edi
+  802f0b:	56                   	push   %esi
+  802f0c:	53                   	push   %ebx
+  802f0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f12:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f17:	89 d1                	mov    %edx,%ecx
+  802f19:	89 d3                	mov    %edx,%ebx
+  802f1b:	89 d7                	mov    %edx,%edi
+  802f1d:	89 d6                	mov    %edx,%esi
+  802f1f:	cd 30                	int    $0x30
+  802f21:	5b                   	pop    %ebx
+  802f22:	5e                   	pop    %esi
+  802f23:	5f                   	pop    %edi
+  802f24:	5d                   	pop    %ebp
+  802f25:	c3                   	ret
+
+00802f26 <sys_env_destroy>:
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	57                   	push   %edi
+  802f2a:	56                   	push   %esi
+  802f2b:	53                   	push   %ebx
+  802f2c:	83 ec 0c             	sub    $0xc,%esp
+  802f2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f37:	b8 03 00 00 00       	mov    $0x3,%eax
+  802f3c:	89 cb                	mov    %ecx,%ebx
+  802f3e:	89 cf                	mov    %ecx,%edi
+  802f40:	89 ce                	mov    %ecx,%esi
+  802f42:	cd 30                	int    $0x30
+  802f44:	85 c0                	test   %eax,%eax
+  802f46:	7f 08                	jg     802f50 <sys_env_destroy+0x2a>
+  802f48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f4b:	5b                   	pop    %ebx
+  802f4c:	5e                   	pop    %esi
+  802f4d:	5f                   	pop    %edi
+  802f4e:	5d                   	pop    %ebp
+  802f4f:	c3                   	ret
+  802f50:	83 ec 0c             	sub    $0xc,%esp
+  802f53:	50                   	push   %eax
+  802f54:	6a 03                	push   $0x3
+  802f56:	68 8b 5e 80 00       	push   $0x805e8b
+  802f5b:	6a 24                	push   $0x24
+  802f5d:	68 a8 5e 80 00       	push   $0x805ea8
+  802f62:	e8 38 f4 ff ff       	call   80239f <_panic>
+
+00802f67 <sys_getenvid>:
+  802f67:	55                   	push   %ebp
+  802f68:	89 e5                	mov    %esp,%ebp
+  802f6a:	57                   	push   %edi
+  802f6b:	56                   	push   %esi
+  802f6c:	53                   	push   %ebx
+  802f6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f72:	b8 02 00 00 00       	mov    $0x2,%eax
+  802f77:	89 d1                	mov    %edx,%ecx
+  802f79:	89 d3                	mov    %edx,%ebx
+  802f7b:	89 d7                	mov    %edx,%edi
+  802f7d:	89 d6                	mov    %edx,%esi
+  802f7f:	cd 30                	int    $0x30
+  802f81:	5b                   	pop    %ebx
+  802f82:	5e                   	pop    %esi
+  802f83:	5f                   	pop    %edi
+  802f84:	5d                   	pop    %ebp
+  802f85:	c3                   	ret
+
+00802f86 <sys_yield>:
+  802f86:	55                   	push   %ebp
+  802f87:	89 e5                	mov    %esp,%ebp
+  802f89:	57                   	push   %edi
+  802f8a:	56                   	push   %esi
+  802f8b:	53                   	push   %ebx
+  802f8c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  802f93:	74 26                	je     802fbb <sys_yield+0x35>
+  802f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802f9f:	89 d1                	mov    %edx,%ecx
+  802fa1:	89 d3                	mov    %edx,%ebx
+  802fa3:	89 d7                	mov    %edx,%edi
+  802fa5:	6a 00                	push   $0x0
+  802fa7:	55                   	push   %ebp
+  802fa8:	89 e5                	mov    %esp,%ebp
+  802faa:	8d 35 b2 2f 80 00    	lea    0x802fb2,%esi
+  802fb0:	0f 34                	sysenter
+  802fb2:	5d                   	pop    %ebp
+  802fb3:	83 c4 04             	add    $0x4,%esp
+  802fb6:	5b                   	pop    %ebx
+  802fb7:	5e                   	pop    %esi
+  802fb8:	5f                   	pop    %edi
+  802fb9:	5d                   	pop    %ebp
+  802fba:	c3                   	ret
+  802fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802fc5:	89 d1                	mov    %edx,%ecx
+  802fc7:	89 d3                	mov    %edx,%ebx
+  802fc9:	89 d7                	mov    %edx,%edi
+  802fcb:	89 d6                	mov    %edx,%esi
+  802fcd:	cd 30                	int    $0x30
+  802fcf:	eb e5                	jmp    802fb6 <sys_yield+0x30>
+
+00802fd1 <sys_page_alloc>:
+  802fd1:	55                   	push   %ebp
+  802fd2:	89 e5                	mov    %esp,%ebp
+  802fd4:	57                   	push   %edi
+  802fd5:	56                   	push   %esi
+  802fd6:	53                   	push   %ebx
+  802fd7:	83 ec 0c             	sub    $0xc,%esp
+  802fda:	be 00 00 00 00       	mov    $0x0,%esi
+  802fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fe5:	b8 04 00 00 00       	mov    $0x4,%eax
+  802fea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fed:	89 f7                	mov    %esi,%edi
+  802fef:	cd 30                	int    $0x30
+  802ff1:	85 c0                	test   %eax,%eax
+  802ff3:	7f 08                	jg     802ffd <sys_page_alloc+0x2c>
+  802ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff8:	5b                   	pop    %ebx
+  802ff9:	5e                   	pop    %esi
+  802ffa:	5f                   	pop    %edi
+  802ffb:	5d                   	pop    %ebp
+  802ffc:	c3                   	ret
+  802ffd:	83 ec 0c             	sub    $0xc,%esp
+  803000:	50                   	push   %eax
+  803001:	6a 04                	push   $0x4
+  803003:	68 8b 5e 80 00       	push   $0x805e8b
+  803008:	6a 24                	push   $0x24
+  80300a:	68 a8 5e 80 00       	push   $0x805ea8
+  80300f:	e8 8b f3 ff ff       	call   80239f <_panic>
+
+00803014 <sys_page_map>:
+  803014:	55                   	push   %ebp
+  803015:	89 e5                	mov    %esp,%ebp
+  803017:	57                   	push   %edi
+  803018:	56                   	push   %esi
+  803019:	53                   	push   %ebx
+  80301a:	83 ec 0c             	sub    $0xc,%esp
+  80301d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  803024:	74 33                	je     803059 <sys_page_map+0x45>
+  803026:	8b 55 08             	mov    0x8(%ebp),%edx
+  803029:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80302c:	b8 05 00 00 00       	mov    $0x5,%eax
+  803031:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803034:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803037:	ff 75 18             	push   0x18(%ebp)
+  80303a:	55                   	push   %ebp
+  80303b:	89 e5                	mov    %esp,%ebp
+  80303d:	8d 35 45 30 80 00    	lea    0x803045,%esi
+  803043:	0f 34                	sysenter
+  803045:	5d                   	pop    %ebp
+  803046:	83 c4 04             	add    $0x4,%esp
+  803049:	89 c2                	mov    %eax,%edx
+  80304b:	85 c0                	test   %eax,%eax
+  80304d:	7f 3d                	jg     80308c <sys_page_map+0x78>
+  80304f:	89 d0                	mov    %edx,%eax
+  803051:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803054:	5b                   	pop    %ebx
+  803055:	5e                   	pop    %esi
+  803056:	5f                   	pop    %edi
+  803057:	5d                   	pop    %ebp
+  803058:	c3                   	ret
+  803059:	b8 05 00 00 00       	mov    $0x5,%eax
+  80305e:	8b 55 08             	mov    0x8(%ebp),%edx
+  803061:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803064:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803067:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80306a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80306d:	cd 30                	int    $0x30
+  80306f:	89 c2                	mov    %eax,%edx
+  803071:	85 c0                	test   %eax,%eax
+  803073:	7e da                	jle    80304f <sys_page_map+0x3b>
+  803075:	83 ec 0c             	sub    $0xc,%esp
+  803078:	50                   	push   %eax
+  803079:	6a 05                	push   $0x5
+  80307b:	68 8b 5e 80 00       	push   $0x805e8b
+  803080:	6a 24                	push   $0x24
+  803082:	68 a8 5e 80 00       	push   $0x805ea8
+  803087:	e8 13 f3 ff ff       	call   80239f <_panic>
+  80308c:	83 ec 0c             	sub    $0xc,%esp
+  80308f:	50                   	push   %eax
+  803090:	6a 05                	push   $0x5
+  803092:	68 8b 5e 80 00       	push   $0x805e8b
+  803097:	6a 48                	push   $0x48
+  803099:	68 a8 5e 80 00       	push   $0x805ea8
+  80309e:	e8 fc f2 ff ff       	call   80239f <_panic>
+
+008030a3 <sys_page_unmap>:
+  8030a3:	55                   	push   %ebp
+  8030a4:	89 e5                	mov    %esp,%ebp
+  8030a6:	57                   	push   %edi
+  8030a7:	56                   	push   %esi
+  8030a8:	53                   	push   %ebx
+  8030a9:	83 ec 0c             	sub    $0xc,%esp
+  8030ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030b7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8030bc:	89 df                	mov    %ebx,%edi
+  8030be:	89 de                	mov    %ebx,%esi
+  8030c0:	cd 30                	int    $0x30
+  8030c2:	85 c0                	test   %eax,%eax
+  8030c4:	7f 08                	jg     8030ce <sys_page_unmap+0x2b>
+  8030c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c9:	5b                   	pop    %ebx
+  8030ca:	5e                   	pop    %esi
+  8030cb:	5f                   	pop    %edi
+  8030cc:	5d                   	pop    %ebp
+  8030cd:	c3                   	ret
+  8030ce:	83 ec 0c             	sub    $0xc,%esp
+  8030d1:	50                   	push   %eax
+  8030d2:	6a 06                	push   $0x6
+  8030d4:	68 8b 5e 80 00       	push   $0x805e8b
+  8030d9:	6a 24                	push   $0x24
+  8030db:	68 a8 5e 80 00       	push   $0x805ea8
+  8030e0:	e8 ba f2 ff ff       	call   80239f <_panic>
+
+008030e5 <sys_fork>:
+  8030e5:	55                   	push   %ebp
+  8030e6:	89 e5                	mov    %esp,%ebp
+  8030e8:	57                   	push   %edi
+  8030e9:	56                   	push   %esi
+  8030ea:	53                   	push   %ebx
+  8030eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8030f5:	89 d1                	mov    %edx,%ecx
+  8030f7:	89 d3                	mov    %edx,%ebx
+  8030f9:	89 d7                	mov    %edx,%edi
+  8030fb:	89 d6                	mov    %edx,%esi
+  8030fd:	cd 30                	int    $0x30
+  8030ff:	5b                   	pop    %ebx
+  803100:	5e                   	pop    %esi
+  803101:	5f                   	pop    %edi
+  803102:	5d                   	pop    %ebp
+  803103:	c3                   	ret
+
+00803104 <sys_env_set_status>:
+  803104:	55                   	push   %ebp
+  803105:	89 e5                	mov    %esp,%ebp
+  803107:	57                   	push   %edi
+  803108:	56                   	push   %esi
+  803109:	53                   	push   %ebx
+  80310a:	83 ec 0c             	sub    $0xc,%esp
+  80310d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803112:	8b 55 08             	mov    0x8(%ebp),%edx
+  803115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803118:	b8 08 00 00 00       	mov    $0x8,%eax
+  80311d:	89 df                	mov    %ebx,%edi
+  80311f:	89 de                	mov    %ebx,%esi
+  803121:	cd 30                	int    $0x30
+  803123:	85 c0                	test   %eax,%eax
+  803125:	7f 08                	jg     80312f <sys_env_set_status+0x2b>
+  803127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80312a:	5b                   	pop    %ebx
+  80312b:	5e                   	pop    %esi
+  80312c:	5f                   	pop    %edi
+  80312d:	5d                   	pop    %ebp
+  80312e:	c3                   	ret
+  80312f:	83 ec 0c             	sub    $0xc,%esp
+  803132:	50                   	push   %eax
+  803133:	6a 08                	push   $0x8
+  803135:	68 8b 5e 80 00       	push   $0x805e8b
+  80313a:	6a 24                	push   $0x24
+  80313c:	68 a8 5e 80 00       	push   $0x805ea8
+  803141:	e8 59 f2 ff ff       	call   80239f <_panic>
+
+00803146 <sys_env_set_trapframe>:
+  803146:	55                   	push   %ebp
+  803147:	89 e5                	mov    %esp,%ebp
+  803149:	57                   	push   %edi
+  80314a:	56                   	push   %esi
+  80314b:	53                   	push   %ebx
+  80314c:	83 ec 0c             	sub    $0xc,%esp
+  80314f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803154:	8b 55 08             	mov    0x8(%ebp),%edx
+  803157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80315a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80315f:	89 df                	mov    %ebx,%edi
+  803161:	89 de                	mov    %ebx,%esi
+  803163:	cd 30                	int    $0x30
+  803165:	85 c0                	test   %eax,%eax
+  803167:	7f 08                	jg     803171 <sys_env_set_trapframe+0x2b>
+  803169:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80316c:	5b                   	pop    %ebx
+  80316d:	5e                   	pop    %esi
+  80316e:	5f                   	pop    %edi
+  80316f:	5d                   	pop    %ebp
+  803170:	c3                   	ret
+  803171:	83 ec 0c             	sub    $0xc,%esp
+  803174:	50                   	push   %eax
+  803175:	6a 09                	push   $0x9
+  803177:	68 8b 5e 80 00       	push   $0x805e8b
+  80317c:	6a 24                	push   $0x24
+  80317e:	68 a8 5e 80 00       	push   $0x805ea8
+  803183:	e8 17 f2 ff ff       	call   80239f <_panic>
+
+00803188 <sys_env_set_cow>:
+  803188:	55                   	push   %ebp
+  803189:	89 e5                	mov    %esp,%ebp
+  80318b:	57                   	push   %edi
+  80318c:	56                   	push   %esi
+  80318d:	53                   	push   %ebx
+  80318e:	83 ec 0c             	sub    $0xc,%esp
+  803191:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803196:	8b 55 08             	mov    0x8(%ebp),%edx
+  803199:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80319c:	b8 20 00 00 00       	mov    $0x20,%eax
+  8031a1:	89 df                	mov    %ebx,%edi
+  8031a3:	89 de                	mov    %ebx,%esi
+  8031a5:	cd 30                	int    $0x30
+  8031a7:	85 c0                	test   %eax,%eax
+  8031a9:	7f 08                	jg     8031b3 <sys_env_set_cow+0x2b>
+  8031ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031ae:	5b                   	pop    %ebx
+  8031af:	5e                   	pop    %esi
+  8031b0:	5f                   	pop    %edi
+  8031b1:	5d                   	pop    %ebp
+  8031b2:	c3                   	ret
+  8031b3:	83 ec 0c             	sub    $0xc,%esp
+  8031b6:	50                   	push   %eax
+  8031b7:	6a 20                	push   $0x20
+  8031b9:	68 8b 5e 80 00       	push   $0x805e8b
+  8031be:	6a 24                	push   $0x24
+  8031c0:	68 a8 5e 80 00       	push   $0x805ea8
+  8031c5:	e8 d5 f1 ff ff       	call   80239f <_panic>
+
+008031ca <sys_env_service>:
+  8031ca:	55                   	push   %ebp
+  8031cb:	89 e5                	mov    %esp,%ebp
+  8031cd:	57                   	push   %edi
+  8031ce:	56                   	push   %esi
+  8031cf:	53                   	push   %ebx
+  8031d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031d8:	b8 21 00 00 00       	mov    $0x21,%eax
+  8031dd:	89 cb                	mov    %ecx,%ebx
+  8031df:	89 cf                	mov    %ecx,%edi
+  8031e1:	89 ce                	mov    %ecx,%esi
+  8031e3:	cd 30                	int    $0x30
+  8031e5:	5b                   	pop    %ebx
+  8031e6:	5e                   	pop    %esi
+  8031e7:	5f                   	pop    %edi
+  8031e8:	5d                   	pop    %ebp
+  8031e9:	c3                   	ret
+
+008031ea <sys_env_set_pgfault_upcall>:
+  8031ea:	55                   	push   %ebp
+  8031eb:	89 e5                	mov    %esp,%ebp
+  8031ed:	57                   	push   %edi
+  8031ee:	56                   	push   %esi
+  8031ef:	53                   	push   %ebx
+  8031f0:	83 ec 0c             	sub    $0xc,%esp
+  8031f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803203:	89 df                	mov    %ebx,%edi
+  803205:	89 de                	mov    %ebx,%esi
+  803207:	cd 30                	int    $0x30
+  803209:	85 c0                	test   %eax,%eax
+  80320b:	7f 08                	jg     803215 <sys_env_set_pgfault_upcall+0x2b>
+  80320d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803210:	5b                   	pop    %ebx
+  803211:	5e                   	pop    %esi
+  803212:	5f                   	pop    %edi
+  803213:	5d                   	pop    %ebp
+  803214:	c3                   	ret
+  803215:	83 ec 0c             	sub    $0xc,%esp
+  803218:	50                   	push   %eax
+  803219:	6a 0a                	push   $0xa
+  80321b:	68 8b 5e 80 00       	push   $0x805e8b
+  803220:	6a 24                	push   $0x24
+  803222:	68 a8 5e 80 00       	push   $0x805ea8
+  803227:	e8 73 f1 ff ff       	call   80239f <_panic>
+
+0080322c <sys_ipc_try_send>:
+  80322c:	55                   	push   %ebp
+  80322d:	89 e5                	mov    %esp,%ebp
+  80322f:	57                   	push   %edi
+  803230:	56                   	push   %esi
+  803231:	53                   	push   %ebx
+  803232:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  803239:	74 27                	je     803262 <sys_ipc_try_send+0x36>
+  80323b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80323e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803241:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803249:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80324c:	6a 00                	push   $0x0
+  80324e:	55                   	push   %ebp
+  80324f:	89 e5                	mov    %esp,%ebp
+  803251:	8d 35 59 32 80 00    	lea    0x803259,%esi
+  803257:	0f 34                	sysenter
+  803259:	5d                   	pop    %ebp
+  80325a:	83 c4 04             	add    $0x4,%esp
+  80325d:	5b                   	pop    %ebx
+  80325e:	5e                   	pop    %esi
+  80325f:	5f                   	pop    %edi
+  803260:	5d                   	pop    %ebp
+  803261:	c3                   	ret
+  803262:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803267:	be 00 00 00 00       	mov    $0x0,%esi
+  80326c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80326f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803272:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803275:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803278:	cd 30                	int    $0x30
+  80327a:	eb e1                	jmp    80325d <sys_ipc_try_send+0x31>
+
+0080327c <sys_ipc_recv>:
+  80327c:	55                   	push   %ebp
+  80327d:	89 e5                	mov    %esp,%ebp
+  80327f:	57                   	push   %edi
+  803280:	56                   	push   %esi
+  803281:	53                   	push   %ebx
+  803282:	83 ec 0c             	sub    $0xc,%esp
+  803285:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80328c:	74 32                	je     8032c0 <sys_ipc_recv+0x44>
+  80328e:	8b 55 08             	mov    0x8(%ebp),%edx
+  803291:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803296:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80329b:	89 cb                	mov    %ecx,%ebx
+  80329d:	89 cf                	mov    %ecx,%edi
+  80329f:	6a 00                	push   $0x0
+  8032a1:	55                   	push   %ebp
+  8032a2:	89 e5                	mov    %esp,%ebp
+  8032a4:	8d 35 ac 32 80 00    	lea    0x8032ac,%esi
+  8032aa:	0f 34                	sysenter
+  8032ac:	5d                   	pop    %ebp
+  8032ad:	83 c4 04             	add    $0x4,%esp
+  8032b0:	89 c2                	mov    %eax,%edx
+  8032b2:	85 c0                	test   %eax,%eax
+  8032b4:	7f 3c                	jg     8032f2 <sys_ipc_recv+0x76>
+  8032b6:	89 d0                	mov    %edx,%eax
+  8032b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032bb:	5b                   	pop    %ebx
+  8032bc:	5e                   	pop    %esi
+  8032bd:	5f                   	pop    %edi
+  8032be:	5d                   	pop    %ebp
+  8032bf:	c3                   	ret
+  8032c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032c5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8032ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8032cd:	89 cb                	mov    %ecx,%ebx
+  8032cf:	89 cf                	mov    %ecx,%edi
+  8032d1:	89 ce                	mov    %ecx,%esi
+  8032d3:	cd 30                	int    $0x30
+  8032d5:	89 c2                	mov    %eax,%edx
+  8032d7:	85 c0                	test   %eax,%eax
+  8032d9:	7e db                	jle    8032b6 <sys_ipc_recv+0x3a>
+  8032db:	83 ec 0c             	sub    $0xc,%esp
+  8032de:	50                   	push   %eax
+  8032df:	6a 0d                	push   $0xd
+  8032e1:	68 8b 5e 80 00       	push   $0x805e8b
+  8032e6:	6a 24                	push   $0x24
+  8032e8:	68 a8 5e 80 00       	push   $0x805ea8
+  8032ed:	e8 ad f0 ff ff       	call   80239f <_panic>
+  8032f2:	83 ec 0c             	sub    $0xc,%esp
+  8032f5:	50                   	push   %eax
+  8032f6:	6a 0d                	push   $0xd
+  8032f8:	68 8b 5e 80 00       	push   $0x805e8b
+  8032fd:	6a 48                	push   $0x48
+  8032ff:	68 a8 5e 80 00       	push   $0x805ea8
+  803304:	e8 96 f0 ff ff       	call   80239f <_panic>
+
+00803309 <sys_ipc_send>:
+  803309:	55                   	push   %ebp
+  80330a:	89 e5                	mov    %esp,%ebp
+  80330c:	57                   	push   %edi
+  80330d:	56                   	push   %esi
+  80330e:	53                   	push   %ebx
+  80330f:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  803316:	74 27                	je     80333f <sys_ipc_send+0x36>
+  803318:	8b 55 08             	mov    0x8(%ebp),%edx
+  80331b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80331e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803323:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803326:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803329:	6a 00                	push   $0x0
+  80332b:	55                   	push   %ebp
+  80332c:	89 e5                	mov    %esp,%ebp
+  80332e:	8d 35 36 33 80 00    	lea    0x803336,%esi
+  803334:	0f 34                	sysenter
+  803336:	5d                   	pop    %ebp
+  803337:	83 c4 04             	add    $0x4,%esp
+  80333a:	5b                   	pop    %ebx
+  80333b:	5e                   	pop    %esi
+  80333c:	5f                   	pop    %edi
+  80333d:	5d                   	pop    %ebp
+  80333e:	c3                   	ret
+  80333f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803344:	be 00 00 00 00       	mov    $0x0,%esi
+  803349:	8b 55 08             	mov    0x8(%ebp),%edx
+  80334c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80334f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803352:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803355:	cd 30                	int    $0x30
+  803357:	eb e1                	jmp    80333a <sys_ipc_send+0x31>
+
+00803359 <sys_ipc_call>:
+  803359:	55                   	push   %ebp
+  80335a:	89 e5                	mov    %esp,%ebp
+  80335c:	57                   	push   %edi
+  80335d:	56                   	push   %esi
+  80335e:	53                   	push   %ebx
+  80335f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803362:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803365:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80336a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80336d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803370:	8b 75 18             	mov    0x18(%ebp),%esi
+  803373:	cd 30                	int    $0x30
+  803375:	5b                   	pop    %ebx
+  803376:	5e                   	pop    %esi
+  803377:	5f                   	pop    %edi
+  803378:	5d                   	pop    %ebp
+  803379:	c3                   	ret
+
+0080337a <sys_ipc_reply_recv>:
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	57                   	push   %edi
+  80337e:	56                   	push   %esi
+  80337f:	53                   	push   %ebx
+  803380:	8b 55 08             	mov    0x8(%ebp),%edx
+  803383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803386:	b8 10 00 00 00       	mov    $0x10,%eax
+  80338b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80338e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803391:	8b 75 18             	mov    0x18(%ebp),%esi
+  803394:	cd 30                	int    $0x30
+  803396:	5b                   	pop    %ebx
+  803397:	5e                   	pop    %esi
+  803398:	5f                   	pop    %edi
+  803399:	5d                   	pop    %ebp
+  80339a:	c3                   	ret
+
+0080339b <sys_time_msec>:
+  80339b:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8033a0:	85 c0                	test   %eax,%eax
+  8033a2:	75 06                	jne    8033aa <sys_time_msec+0xf>
+  8033a4:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8033a9:	c3                   	ret
+  8033aa:	55                   	push   %ebp
+  8033ab:	89 e5                	mov    %esp,%ebp
+  8033ad:	57                   	push   %edi
+  8033ae:	56                   	push   %esi
+  8033af:	53                   	push   %ebx
+  8033b0:	83 ec 0c             	sub    $0xc,%esp
+  8033b3:	0f 31                	rdtsc
+  8033b5:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8033bb:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8033c1:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8033c7:	29 c8                	sub    %ecx,%eax
+  8033c9:	19 da                	sbb    %ebx,%edx
+  8033cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d0:	57                   	push   %edi
+  8033d1:	56                   	push   %esi
+  8033d2:	52                   	push   %edx
+  8033d3:	50                   	push   %eax
+  8033d4:	e8 ee 1f 00 00       	call   8053c7 <__udivdi3>
+  8033d9:	83 c4 10             	add    $0x10,%esp
+  8033dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033df:	5b                   	pop    %ebx
+  8033e0:	5e                   	pop    %esi
+  8033e1:	5f                   	pop    %edi
+  8033e2:	5d                   	pop    %ebp
+  8033e3:	c3                   	ret
+
+008033e4 <sys_env_swap>:
+  8033e4:	55                   	push   %ebp
+  8033e5:	89 e5                	mov    %esp,%ebp
+  8033e7:	57                   	push   %edi
+  8033e8:	56                   	push   %esi
+  8033e9:	53                   	push   %ebx
+  8033ea:	83 ec 0c             	sub    $0xc,%esp
+  8033ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033f5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8033fa:	89 cb                	mov    %ecx,%ebx
+  8033fc:	89 cf                	mov    %ecx,%edi
+  8033fe:	89 ce                	mov    %ecx,%esi
+  803400:	cd 30                	int    $0x30
+  803402:	85 c0                	test   %eax,%eax
+  803404:	7f 08                	jg     80340e <sys_env_swap+0x2a>
+  803406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803409:	5b                   	pop    %ebx
+  80340a:	5e                   	pop    %esi
+  80340b:	5f                   	pop    %edi
+  80340c:	5d                   	pop    %ebp
+  80340d:	c3                   	ret
+  80340e:	83 ec 0c             	sub    $0xc,%esp
+  803411:	50                   	push   %eax
+  803412:	6a 12                	push   $0x12
+  803414:	68 8b 5e 80 00       	push   $0x805e8b
+  803419:	6a 24                	push   $0x24
+  80341b:	68 a8 5e 80 00       	push   $0x805ea8
+  803420:	e8 7a ef ff ff       	call   80239f <_panic>
+
+00803425 <sys_net_try_send>:
+  803425:	55                   	push   %ebp
+  803426:	89 e5                	mov    %esp,%ebp
+  803428:	57                   	push   %edi
+  803429:	56                   	push   %esi
+  80342a:	53                   	push   %ebx
+  80342b:	83 ec 0c             	sub    $0xc,%esp
+  80342e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803433:	8b 55 08             	mov    0x8(%ebp),%edx
+  803436:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803439:	b8 13 00 00 00       	mov    $0x13,%eax
+  80343e:	89 df                	mov    %ebx,%edi
+  803440:	89 de                	mov    %ebx,%esi
+  803442:	cd 30                	int    $0x30
+  803444:	85 c0                	test   %eax,%eax
+  803446:	7f 08                	jg     803450 <sys_net_try_send+0x2b>
+  803448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80344b:	5b                   	pop    %ebx
+  80344c:	5e                   	pop    %esi
+  80344d:	5f                   	pop    %edi
+  80344e:	5d                   	pop    %ebp
+  80344f:	c3                   	ret
+  803450:	83 ec 0c             	sub    $0xc,%esp
+  803453:	50                   	push   %eax
+  803454:	6a 13                	push   $0x13
+  803456:	68 8b 5e 80 00       	push   $0x805e8b
+  80345b:	6a 24                	push   $0x24
+  80345d:	68 a8 5e 80 00       	push   $0x805ea8
+  803462:	e8 38 ef ff ff       	call   80239f <_panic>
+
+00803467 <sys_net_try_receive>:
+  803467:	55                   	push   %ebp
+  803468:	89 e5                	mov    %esp,%ebp
+  80346a:	57                   	push   %edi
+  80346b:	56                   	push   %esi
+  80346c:	53                   	push   %ebx
+  80346d:	83 ec 0c             	sub    $0xc,%esp
+  803470:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803475:	8b 55 08             	mov    0x8(%ebp),%edx
+  803478:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80347b:	b8 14 00 00 00       	mov    $0x14,%eax
+  803480:	89 df                	mov    %ebx,%edi
+  803482:	89 de                	mov    %ebx,%esi
+  803484:	cd 30                	int    $0x30
+  803486:	85 c0                	test   %eax,%eax
+  803488:	7f 08                	jg     803492 <sys_net_try_receive+0x2b>
+  80348a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80348d:	5b                   	pop    %ebx
+  80348e:	5e                   	pop    %esi
+  80348f:	5f                   	pop    %edi
+  803490:	5d                   	pop    %ebp
+  803491:	c3                   	ret
+  803492:	83 ec 0c             	sub    $0xc,%esp
+  803495:	50                   	push   %eax
+  803496:	6a 14                	push   $0x14
+  803498:	68 8b 5e 80 00       	push   $0x805e8b
+  80349d:	6a 24                	push   $0x24
+  80349f:	68 a8 5e 80 00       	push   $0x805ea8
+  8034a4:	e8 f6 ee ff ff       	call   80239f <_panic>
+
+008034a9 <sys_net_recv_page>:
+  8034a9:	55                   	push   %ebp
+  8034aa:	89 e5                	mov    %esp,%ebp
+  8034ac:	57                   	push   %edi
+  8034ad:	56                   	push   %esi
+  8034ae:	53                   	push   %ebx
+  8034af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8034b7:	b8 27 00 00 00       	mov    $0x27,%eax
+  8034bc:	89 cb                	mov    %ecx,%ebx
+  8034be:	89 cf                	mov    %ecx,%edi
+  8034c0:	89 ce                	mov    %ecx,%esi
+  8034c2:	cd 30                	int    $0x30
+  8034c4:	5b                   	pop    %ebx
+  8034c5:	5e                   	pop    %esi
+  8034c6:	5f                   	pop    %edi
+  8034c7:	5d                   	pop    %ebp
+  8034c8:	c3                   	ret
+
+008034c9 <sys_net_wait>:
+  8034c9:	55                   	push   %ebp
+  8034ca:	89 e5                	mov    %esp,%ebp
+  8034cc:	57                   	push   %edi
+  8034cd:	56                   	push   %esi
+  8034ce:	53                   	push   %ebx
+  8034cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d4:	b8 26 00 00 00       	mov    $0x26,%eax
+  8034d9:	89 d1                	mov    %edx,%ecx
+  8034db:	89 d3                	mov    %edx,%ebx
+  8034dd:	89 d7                	mov    %edx,%edi
+  8034df:	89 d6                	mov    %edx,%esi
+  8034e1:	cd 30                	int    $0x30
+  8034e3:	5b                   	pop    %ebx
+  8034e4:	5e                   	pop    %esi
+  8034e5:	5f                   	pop    %edi
+  8034e6:	5d                   	pop    %ebp
+  8034e7:	c3                   	ret
+
+008034e8 <sys_get_mac>:
+  8034e8:	55                   	push   %ebp
+  8034e9:	89 e5                	mov    %esp,%ebp
+  8034eb:	57                   	push   %edi
+  8034ec:	56                   	push   %esi
+  8034ed:	53                   	push   %ebx
+  8034ee:	83 ec 0c             	sub    $0xc,%esp
+  8034f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8034f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034fc:	b8 15 00 00 00       	mov    $0x15,%eax
+  803501:	89 df                	mov    %ebx,%edi
+  803503:	89 de                	mov    %ebx,%esi
+  803505:	cd 30                	int    $0x30
+  803507:	85 c0                	test   %eax,%eax
+  803509:	7f 08                	jg     803513 <sys_get_mac+0x2b>
+  80350b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80350e:	5b                   	pop    %ebx
+  80350f:	5e                   	pop    %esi
+  803510:	5f                   	pop    %edi
+  803511:	5d                   	pop    %ebp
+  803512:	c3                   	ret
+  803513:	83 ec 0c             	sub    $0xc,%esp
+  803516:	50                   	push   %eax
+  803517:	6a 15                	push   $0x15
+  803519:	68 8b 5e 80 00       	push   $0x805e8b
+  80351e:	6a 24                	push   $0x24
+  803520:	68 a8 5e 80 00       	push   $0x805ea8
+  803525:	e8 75 ee ff ff       	call   80239f <_panic>
+
+0080352a <sys_env_lease>:
+  80352a:	55                   	push   %ebp
+  80352b:	89 e5                	mov    %esp,%ebp
+  80352d:	57                   	push   %edi
+  80352e:	56                   	push   %esi
+  80352f:	53                   	push   %ebx
+  803530:	83 ec 0c             	sub    $0xc,%esp
+  803533:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803538:	8b 55 08             	mov    0x8(%ebp),%edx
+  80353b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80353e:	b8 16 00 00 00       	mov    $0x16,%eax
+  803543:	89 df                	mov    %ebx,%edi
+  803545:	89 de                	mov    %ebx,%esi
+  803547:	cd 30                	int    $0x30
+  803549:	85 c0                	test   %eax,%eax
+  80354b:	7f 08                	jg     803555 <sys_env_lease+0x2b>
+  80354d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803550:	5b                   	pop    %ebx
+  803551:	5e                   	pop    %esi
+  803552:	5f                   	pop    %edi
+  803553:	5d                   	pop    %ebp
+  803554:	c3                   	ret
+  803555:	83 ec 0c             	sub    $0xc,%esp
+  803558:	50                   	push   %eax
+  803559:	6a 16                	push   $0x16
+  80355b:	68 8b 5e 80 00       	push   $0x805e8b
+  803560:	6a 24                	push   $0x24
+  803562:	68 a8 5e 80 00       	push   $0x805ea8
+  803567:	e8 33 ee ff ff       	call   80239f <_panic>
+
+0080356c <sys_copy_mem>:
+  80356c:	55                   	push   %ebp
+  80356d:	89 e5                	mov    %esp,%ebp
+  80356f:	57                   	push   %edi
+  803570:	56                   	push   %esi
+  803571:	53                   	push   %ebx
+  803572:	83 ec 0c             	sub    $0xc,%esp
+  803575:	8b 55 08             	mov    0x8(%ebp),%edx
+  803578:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80357b:	b8 17 00 00 00       	mov    $0x17,%eax
+  803580:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803583:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803586:	8b 75 18             	mov    0x18(%ebp),%esi
+  803589:	cd 30                	int    $0x30
+  80358b:	85 c0                	test   %eax,%eax
+  80358d:	7f 08                	jg     803597 <sys_copy_mem+0x2b>
+  80358f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803592:	5b                   	pop    %ebx
+  803593:	5e                   	pop    %esi
+  803594:	5f                   	pop    %edi
+  803595:	5d                   	pop    %ebp
+  803596:	c3                   	ret
+  803597:	83 ec 0c             	sub    $0xc,%esp
+  80359a:	50                   	push   %eax
+  80359b:	6a 17                	push   $0x17
+  80359d:	68 8b 5e 80 00       	push   $0x805e8b
+  8035a2:	6a 24                	push   $0x24
+  8035a4:	68 a8 5e 80 00       	push   $0x805ea8
+  8035a9:	e8 f1 ed ff ff       	call   80239f <_panic>
+
+008035ae <sys_get_perms>:
+  8035ae:	55                   	push   %ebp
+  8035af:	89 e5                	mov    %esp,%ebp
+  8035b1:	57                   	push   %edi
+  8035b2:	56                   	push   %esi
+  8035b3:	53                   	push   %ebx
+  8035b4:	83 ec 0c             	sub    $0xc,%esp
+  8035b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8035bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8035bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8035c2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8035c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035ca:	89 f7                	mov    %esi,%edi
+  8035cc:	cd 30                	int    $0x30
+  8035ce:	85 c0                	test   %eax,%eax
+  8035d0:	7f 08                	jg     8035da <sys_get_perms+0x2c>
+  8035d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035d5:	5b                   	pop    %ebx
+  8035d6:	5e                   	pop    %esi
+  8035d7:	5f                   	pop    %edi
+  8035d8:	5d                   	pop    %ebp
+  8035d9:	c3                   	ret
+  8035da:	83 ec 0c             	sub    $0xc,%esp
+  8035dd:	50                   	push   %eax
+  8035de:	6a 18                	push   $0x18
+  8035e0:	68 8b 5e 80 00       	push   $0x805e8b
+  8035e5:	6a 24                	push   $0x24
+  8035e7:	68 a8 5e 80 00       	push   $0x805ea8
+  8035ec:	e8 ae ed ff ff       	call   80239f <_panic>
+
+008035f1 <sys_env_unsuspend>:
+  8035f1:	55                   	push   %ebp
+  8035f2:	89 e5                	mov    %esp,%ebp
+  8035f4:	57                   	push   %edi
+  8035f5:	56                   	push   %esi
+  8035f6:	53                   	push   %ebx
+  8035f7:	83 ec 0c             	sub    $0xc,%esp
+  8035fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8035ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  803602:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803605:	b8 19 00 00 00       	mov    $0x19,%eax
+  80360a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80360d:	89 f7                	mov    %esi,%edi
+  80360f:	cd 30                	int    $0x30
+  803611:	85 c0                	test   %eax,%eax
+  803613:	7f 08                	jg     80361d <sys_env_unsuspend+0x2c>
+  803615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803618:	5b                   	pop    %ebx
+  803619:	5e                   	pop    %esi
+  80361a:	5f                   	pop    %edi
+  80361b:	5d                   	pop    %ebp
+  80361c:	c3                   	ret
+  80361d:	83 ec 0c             	sub    $0xc,%esp
+  803620:	50                   	push   %eax
+  803621:	6a 19                	push   $0x19
+  803623:	68 8b 5e 80 00       	push   $0x805e8b
+  803628:	6a 24                	push   $0x24
+  80362a:	68 a8 5e 80 00       	push   $0x805ea8
+  80362f:	e8 6b ed ff ff       	call   80239f <_panic>
+
+00803634 <sys_migrate>:
+  803634:	55                   	push   %ebp
+  803635:	89 e5                	mov    %esp,%ebp
+  803637:	57                   	push   %edi
+  803638:	56                   	push   %esi
+  803639:	53                   	push   %ebx
+  80363a:	83 ec 0c             	sub    $0xc,%esp
+  80363d:	ba 00 00 81 00       	mov    $0x810000,%edx
+  803642:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  803648:	76 11                	jbe    80365b <sys_migrate+0x27>
+  80364a:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80364f:	0f b6 08             	movzbl (%eax),%ecx
+  803652:	05 00 10 00 00       	add    $0x1000,%eax
+  803657:	39 d0                	cmp    %edx,%eax
+  803659:	72 f4                	jb     80364f <sys_migrate+0x1b>
+  80365b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803660:	8b 55 08             	mov    0x8(%ebp),%edx
+  803663:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  803668:	89 cb                	mov    %ecx,%ebx
+  80366a:	89 cf                	mov    %ecx,%edi
+  80366c:	89 ce                	mov    %ecx,%esi
+  80366e:	cd 30                	int    $0x30
+  803670:	85 c0                	test   %eax,%eax
+  803672:	7f 08                	jg     80367c <sys_migrate+0x48>
+  803674:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803677:	5b                   	pop    %ebx
+  803678:	5e                   	pop    %esi
+  803679:	5f                   	pop    %edi
+  80367a:	5d                   	pop    %ebp
+  80367b:	c3                   	ret
+  80367c:	83 ec 0c             	sub    $0xc,%esp
+  80367f:	50                   	push   %eax
+  803680:	6a 1a                	push   $0x1a
+  803682:	68 8b 5e 80 00       	push   $0x805e8b
+  803687:	6a 24                	push   $0x24
+  803689:	68 a8 5e 80 00       	push   $0x805ea8
+  80368e:	e8 0c ed ff ff       	call   80239f <_panic>
+
+00803693 <sys_lease_complete>:
+  803693:	55                   	push   %ebp
+  803694:	89 e5                	mov    %esp,%ebp
+  803696:	57                   	push   %edi
+  803697:	56                   	push   %esi
+  803698:	53                   	push   %ebx
+  803699:	83 ec 0c             	sub    $0xc,%esp
+  80369c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8036a6:	89 d1                	mov    %edx,%ecx
+  8036a8:	89 d3                	mov    %edx,%ebx
+  8036aa:	89 d7                	mov    %edx,%edi
+  8036ac:	89 d6                	mov    %edx,%esi
+  8036ae:	cd 30                	int    $0x30
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	7f 08                	jg     8036bc <sys_lease_complete+0x29>
+  8036b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b7:	5b                   	pop    %ebx
+  8036b8:	5e                   	pop    %esi
+  8036b9:	5f                   	pop    %edi
+  8036ba:	5d                   	pop    %ebp
+  8036bb:	c3                   	ret
+  8036bc:	83 ec 0c             	sub    $0xc,%esp
+  8036bf:	50                   	push   %eax
+  8036c0:	6a 1b                	push   $0x1b
+  8036c2:	68 8b 5e 80 00       	push   $0x805e8b
+  8036c7:	6a 24                	push   $0x24
+  8036c9:	68 a8 5e 80 00       	push   $0x805ea8
+  8036ce:	e8 cc ec ff ff       	call   80239f <_panic>
+
+008036d3 <sys_env_set_thisenv>:
+  8036d3:	55                   	push   %ebp
+  8036d4:	89 e5                	mov    %esp,%ebp
+  8036d6:	57                   	push   %edi
+  8036d7:	56                   	push   %esi
+  8036d8:	53                   	push   %ebx
+  8036d9:	83 ec 0c             	sub    $0xc,%esp
+  8036dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8036e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8036e7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8036ec:	89 df                	mov    %ebx,%edi
+  8036ee:	89 de                	mov    %ebx,%esi
+  8036f0:	cd 30                	int    $0x30
+  8036f2:	85 c0                	test   %eax,%eax
+  8036f4:	7f 08                	jg     8036fe <sys_env_set_thisenv+0x2b>
+  8036f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f9:	5b                   	pop    %ebx
+  8036fa:	5e                   	pop    %esi
+  8036fb:	5f                   	pop    %edi
+  8036fc:	5d                   	pop    %ebp
+  8036fd:	c3                   	ret
+  8036fe:	83 ec 0c             	sub    $0xc,%esp
+  803701:	50                   	push   %eax
+  803702:	6a 1c                	push   $0x1c
+  803704:	68 8b 5e 80 00       	push   $0x805e8b
+  803709:	6a 24                	push   $0x24
+  80370b:	68 a8 5e 80 00       	push   $0x805ea8
+  803710:	e8 8a ec ff ff       	call   80239f <_panic>
+
+00803715 <sys_env_set_sched>:
+  803715:	55                   	push   %ebp
+  803716:	89 e5                	mov    %esp,%ebp
+  803718:	57                   	push   %edi
+  803719:	56                   	push   %esi
+  80371a:	53                   	push   %ebx
+  80371b:	83 ec 0c             	sub    $0xc,%esp
+  80371e:	be 00 00 00 00       	mov    $0x0,%esi
+  803723:	8b 55 08             	mov    0x8(%ebp),%edx
+  803726:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803729:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80372e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803731:	89 f7                	mov    %esi,%edi
+  803733:	cd 30                	int    $0x30
+  803735:	85 c0                	test   %eax,%eax
+  803737:	7f 08                	jg     803741 <sys_env_set_sched+0x2c>
+  803739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80373c:	5b                   	pop    %ebx
+  80373d:	5e                   	pop    %esi
+  80373e:	5f                   	pop    %edi
+  80373f:	5d                   	pop    %ebp
+  803740:	c3                   	ret
+  803741:	83 ec 0c             	sub    $0xc,%esp
+  803744:	50                   	push   %eax
+  803745:	6a 1d                	push   $0x1d
+  803747:	68 8b 5e 80 00       	push   $0x805e8b
+  80374c:	6a 24                	push   $0x24
+  80374e:	68 a8 5e 80 00       	push   $0x805ea8
+  803753:	e8 47 ec ff ff       	call   80239f <_panic>
+
+00803758 <sys_batch>:
+  803758:	55                   	push   %ebp
+  803759:	89 e5                	mov    %esp,%ebp
+  80375b:	57                   	push   %edi
+  80375c:	56                   	push   %esi
+  80375d:	53                   	push   %ebx
+  80375e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803763:	8b 55 08             	mov    0x8(%ebp),%edx
+  803766:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803769:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80376e:	89 df                	mov    %ebx,%edi
+  803770:	89 de                	mov    %ebx,%esi
+  803772:	cd 30                	int    $0x30
+  803774:	5b                   	pop    %ebx
+  803775:	5e                   	pop    %esi
+  803776:	5f                   	pop    %edi
+  803777:	5d                   	pop    %ebp
+  803778:	c3                   	ret
+
+00803779 <sys_env_stats>:
+  803779:	55                   	push   %ebp
+  80377a:	89 e5                	mov    %esp,%ebp
+  80377c:	57                   	push   %edi
+  80377d:	56                   	push   %esi
+  80377e:	53                   	push   %ebx
+  80377f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803784:	8b 55 08             	mov    0x8(%ebp),%edx
+  803787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80378a:	b8 23 00 00 00       	mov    $0x23,%eax
+  80378f:	89 df                	mov    %ebx,%edi
+  803791:	89 de                	mov    %ebx,%esi
+  803793:	cd 30                	int    $0x30
+  803795:	5b                   	pop    %ebx
+  803796:	5e                   	pop    %esi
+  803797:	5f                   	pop    %edi
+  803798:	5d                   	pop    %ebp
+  803799:	c3                   	ret
+
+0080379a <sys_trace>:
+  80379a:	55                   	push   %ebp
+  80379b:	89 e5                	mov    %esp,%ebp
+  80379d:	57                   	push   %edi
+  80379e:	56                   	push   %esi
+  80379f:	53                   	push   %ebx
+  8037a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8037a8:	b8 24 00 00 00       	mov    $0x24,%eax
+  8037ad:	89 cb                	mov    %ecx,%ebx
+  8037af:	89 cf                	mov    %ecx,%edi
+  8037b1:	89 ce                	mov    %ecx,%esi
+  8037b3:	cd 30                	int    $0x30
+  8037b5:	5b                   	pop    %ebx
+  8037b6:	5e                   	pop    %esi
+  8037b7:	5f                   	pop    %edi
+  8037b8:	5d                   	pop    %ebp
+  8037b9:	c3                   	ret
+
+008037ba <sys_env_set_pager>:
+  8037ba:	55                   	push   %ebp
+  8037bb:	89 e5                	mov    %esp,%ebp
+  8037bd:	57                   	push   %edi
+  8037be:	56                   	push   %esi
+  8037bf:	53                   	push   %ebx
+  8037c0:	83 ec 0c             	sub    $0xc,%esp
+  8037c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8037c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8037cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8037ce:	b8 25 00 00 00       	mov    $0x25,%eax
+  8037d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8037d6:	89 f7                	mov    %esi,%edi
+  8037d8:	cd 30                	int    $0x30
+  8037da:	85 c0                	test   %eax,%eax
+  8037dc:	7f 08                	jg     8037e6 <sys_env_set_pager+0x2c>
+  8037de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037e1:	5b                   	pop    %ebx
+  8037e2:	5e                   	pop    %esi
+  8037e3:	5f                   	pop    %edi
+  8037e4:	5d                   	pop    %ebp
+  8037e5:	c3                   	ret
+  8037e6:	83 ec 0c             	sub    $0xc,%esp
+  8037e9:	50                   	push   %eax
+  8037ea:	6a 25                	push   $0x25
+  8037ec:	68 8b 5e 80 00       	push   $0x805e8b
+  8037f1:	6a 24                	push   $0x24
+  8037f3:	68 a8 5e 80 00       	push   $0x805ea8
+  8037f8:	e8 a2 eb ff ff       	call   80239f <_panic>
+
+008037fd <sys_pager_retire>:
+  8037fd:	55                   	push   %ebp
+  8037fe:	89 e5                	mov    %esp,%ebp
+  803800:	57                   	push   %edi
+  803801:	56                   	push   %esi
+  803802:	53                   	push   %ebx
+  803803:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803808:	8b 55 08             	mov    0x8(%ebp),%edx
+  80380b:	b8 28 00 00 00       	mov    $0x28,%eax
+  803810:	89 cb                	mov    %ecx,%ebx
+  803812:	89 cf                	mov    %ecx,%edi
+  803814:	89 ce                	mov    %ecx,%esi
+  803816:	cd 30                	int    $0x30
+  803818:	5b                   	pop    %ebx
+  803819:	5e                   	pop    %esi
+  80381a:	5f                   	pop    %edi
+  80381b:	5d                   	pop    %ebp
+  80381c:	c3                   	ret
+
+0080381d <sys_prof>:
+  80381d:	55                   	push   %ebp
+  80381e:	89 e5                	mov    %esp,%ebp
+  803820:	57                   	push   %edi
+  803821:	56                   	push   %esi
+  803822:	53                   	push   %ebx
+  803823:	be 00 00 00 00       	mov    $0x0,%esi
+  803828:	8b 55 08             	mov    0x8(%ebp),%edx
+  80382b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80382e:	b8 22 00 00 00       	mov    $0x22,%eax
+  803833:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803836:	89 f7                	mov    %esi,%edi
+  803838:	cd 30                	int    $0x30
+  80383a:	5b                   	pop    %ebx
+  80383b:	5e                   	pop    %esi
+  80383c:	5f                   	pop    %edi
+  80383d:	5d                   	pop    %ebp
+  80383e:	c3                   	ret
+
+0080383f <set_pgfault_handler>:
+  80383f:	55                   	push   %ebp
+  803840:	89 e5                	mov    %esp,%ebp
+  803842:	53                   	push   %ebx
+  803843:	83 ec 04             	sub    $0x4,%esp
+  803846:	83 3d 24 d9 80 00 00 	cmpl   $0x0,0x80d924
+  80384d:	74 0d                	je     80385c <set_pgfault_handler+0x1d>
+  80384f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803852:	a3 24 d9 80 00       	mov    %eax,0x80d924
+  803857:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80385a:	c9                   	leave
+  80385b:	c3                   	ret
+  80385c:	e8 06 f7 ff ff       	call   802f67 <sys_getenvid>
+  803861:	89 c3                	mov    %eax,%ebx
+  803863:	83 ec 04             	sub    $0x4,%esp
+  803866:	6a 07                	push   $0x7
+  803868:	68 00 f0 7f ee       	push   $0xee7ff000
+  80386d:	50                   	push   %eax
+  80386e:	e8 5e f7 ff ff       	call   802fd1 <sys_page_alloc>
+  803873:	83 c4 10             	add    $0x10,%esp
+  803876:	85 c0                	test   %eax,%eax
+  803878:	78 29                	js     8038a3 <set_pgfault_handler+0x64>
+  80387a:	83 ec 08             	sub    $0x8,%esp
+  80387d:	68 b7 38 80 00       	push   $0x8038b7
+  803882:	53                   	push   %ebx
+  803883:	e8 62 f9 ff ff       	call   8031ea <sys_env_set_pgfault_upcall>
+  803888:	83 c4 10             	add    $0x10,%esp
+  80388b:	85 c0                	test   %eax,%eax
+  80388d:	79 c0                	jns    80384f <set_pgfault_handler+0x10>
+  80388f:	83 ec 04             	sub    $0x4,%esp
+  803892:	68 f0 5e 80 00       	push   $0x805ef0
+  803897:	6a 27                	push   $0x27
+  803899:	68 22 5f 80 00       	push   $0x805f22
+  80389e:	e8 fc ea ff ff       	call   80239f <_panic>
+  8038a3:	83 ec 04             	sub    $0x4,%esp
+  8038a6:	68 b8 5e 80 00       	push   $0x805eb8
+  8038ab:	6a 23                	push   $0x23
+  8038ad:	68 22 5f 80 00       	push   $0x805f22
+  8038b2:	e8 e8 ea ff ff       	call   80239f <_panic>
+
+008038b7 <_pgfault_upcall>:
+  8038b7:	54                   	push   %esp
+  8038b8:	a1 24 d9 80 00       	mov    0x80d924,%eax
+  8038bd:	ff d0                	call   *%eax
+  8038bf:	83 c4 04             	add    $0x4,%esp
+  8038c2:	89 e3                	mov    %esp,%ebx
+  8038c4:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8038c8:	8b 54 24 30          	mov    0x30(%esp),%edx
+  8038cc:	89 d4                	mov    %edx,%esp
+  8038ce:	51                   	push   %ecx
+  8038cf:	89 dc                	mov    %ebx,%esp
+  8038d1:	83 ea 04             	sub    $0x4,%edx
+  8038d4:	89 54 24 30          	mov    %edx,0x30(%esp)
+  8038d8:	83 c4 08             	add    $0x8,%esp
+  8038db:	61                   	popa
+  8038dc:	83 c4 04             	add    $0x4,%esp
+  8038df:	9d                   	popf
+  8038e0:	5c                   	pop    %esp
+  8038e1:	c3                   	ret
+
+008038e2 <ipc_recv>:
+  8038e2:	55                   	push   %ebp
+  8038e3:	89 e5                	mov    %esp,%ebp
+  8038e5:	56                   	push   %esi
+  8038e6:	53                   	push   %ebx
+  8038e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8038f0:	85 c0                	test   %eax,%eax
+  8038f2:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  8038f7:	0f 44 c2             	cmove  %edx,%eax
+  8038fa:	83 ec 0c             	sub    $0xc,%esp
+  8038fd:	50                   	push   %eax
+  8038fe:	e8 79 f9 ff ff       	call   80327c <sys_ipc_recv>
+  803903:	83 c4 10             	add    $0x10,%esp
+  803906:	85 c0                	test   %eax,%eax
+  803908:	78 2a                	js     803934 <ipc_recv+0x52>
+  80390a:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  80390f:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803915:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  80391b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803921:	85 f6                	test   %esi,%esi
+  803923:	74 02                	je     803927 <ipc_recv+0x45>
+  803925:	89 0e                	mov    %ecx,(%esi)
+  803927:	85 db                	test   %ebx,%ebx
+  803929:	74 02                	je     80392d <ipc_recv+0x4b>
+  80392b:	89 13                	mov    %edx,(%ebx)
+  80392d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803930:	5b                   	pop    %ebx
+  803931:	5e                   	pop    %esi
+  803932:	5d                   	pop    %ebp
+  803933:	c3                   	ret
+  803934:	ba 00 00 00 00       	mov    $0x0,%edx
+  803939:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80393e:	eb e1                	jmp    803921 <ipc_recv+0x3f>
+
+00803940 <ipc_send>:
+  803940:	55                   	push   %ebp
+  803941:	89 e5                	mov    %esp,%ebp
+  803943:	57                   	push   %edi
+  803944:	56                   	push   %esi
+  803945:	53                   	push   %ebx
+  803946:	83 ec 0c             	sub    $0xc,%esp
+  803949:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80394c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80394f:	8b 75 14             	mov    0x14(%ebp),%esi
+  803952:	85 db                	test   %ebx,%ebx
+  803954:	74 1e                	je     803974 <ipc_send+0x34>
+  803956:	56                   	push   %esi
+  803957:	53                   	push   %ebx
+  803958:	57                   	push   %edi
+  803959:	ff 75 08             	push   0x8(%ebp)
+  80395c:	e8 a8 f9 ff ff       	call   803309 <sys_ipc_send>
+  803961:	83 c4 10             	add    $0x10,%esp
+  803964:	85 c0                	test   %eax,%eax
+  803966:	74 2a                	je     803992 <ipc_send+0x52>
+  803968:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80396b:	75 13                	jne    803980 <ipc_send+0x40>
+  80396d:	e8 14 f6 ff ff       	call   802f86 <sys_yield>
+  803972:	eb e2                	jmp    803956 <ipc_send+0x16>
+  803974:	be 00 00 00 00       	mov    $0x0,%esi
+  803979:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80397e:	eb d6                	jmp    803956 <ipc_send+0x16>
+  803980:	50                   	push   %eax
+  803981:	68 30 5f 80 00       	push   $0x805f30
+  803986:	6a 4f                	push   $0x4f
+  803988:	68 73 5f 80 00       	push   $0x805f73
+  80398d:	e8 0d ea ff ff       	call   80239f <_panic>
+  803992:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803995:	5b                   	pop    %ebx
+  803996:	5e                   	pop    %esi
+  803997:	5f                   	pop    %edi
+  803998:	5d                   	pop    %ebp
+  803999:	c3                   	ret
+
+0080399a <ipc_call>:
+  80399a:	55                   	push   %ebp
+  80399b:	89 e5                	mov    %esp,%ebp
+  80399d:	57                   	push   %edi
+  80399e:	56                   	push   %esi
+  80399f:	53                   	push   %ebx
+  8039a0:	83 ec 0c             	sub    $0xc,%esp
+  8039a3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039a7:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8039ac:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8039b0:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8039b4:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8039b9:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8039bd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039c6:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  8039ca:	eb 05                	jmp    8039d1 <ipc_call+0x37>
+  8039cc:	e8 b5 f5 ff ff       	call   802f86 <sys_yield>
+  8039d1:	83 ec 0c             	sub    $0xc,%esp
+  8039d4:	56                   	push   %esi
+  8039d5:	53                   	push   %ebx
+  8039d6:	57                   	push   %edi
+  8039d7:	ff 75 0c             	push   0xc(%ebp)
+  8039da:	ff 75 08             	push   0x8(%ebp)
+  8039dd:	e8 77 f9 ff ff       	call   803359 <sys_ipc_call>
+  8039e2:	83 c4 20             	add    $0x20,%esp
+  8039e5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8039e8:	74 e2                	je     8039cc <ipc_call+0x32>
+  8039ea:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8039ed:	74 2d                	je     803a1c <ipc_call+0x82>
+  8039ef:	85 c0                	test   %eax,%eax
+  8039f1:	78 4f                	js     803a42 <ipc_call+0xa8>
+  8039f3:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8039f7:	74 10                	je     803a09 <ipc_call+0x6f>
+  8039f9:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  8039fe:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803a04:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803a07:	89 02                	mov    %eax,(%edx)
+  803a09:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  803a0e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a17:	5b                   	pop    %ebx
+  803a18:	5e                   	pop    %esi
+  803a19:	5f                   	pop    %edi
+  803a1a:	5d                   	pop    %ebp
+  803a1b:	c3                   	ret
+  803a1c:	ff 75 14             	push   0x14(%ebp)
+  803a1f:	ff 75 10             	push   0x10(%ebp)
+  803a22:	ff 75 0c             	push   0xc(%ebp)
+  803a25:	ff 75 08             	push   0x8(%ebp)
+  803a28:	e8 13 ff ff ff       	call   803940 <ipc_send>
+  803a2d:	83 c4 0c             	add    $0xc,%esp
+  803a30:	ff 75 1c             	push   0x1c(%ebp)
+  803a33:	ff 75 18             	push   0x18(%ebp)
+  803a36:	6a 00                	push   $0x0
+  803a38:	e8 a5 fe ff ff       	call   8038e2 <ipc_recv>
+  803a3d:	83 c4 10             	add    $0x10,%esp
+  803a40:	eb d2                	jmp    803a14 <ipc_call+0x7a>
+  803a42:	50                   	push   %eax
+  803a43:	68 7d 5f 80 00       	push   $0x805f7d
+  803a48:	6a 6d                	push   $0x6d
+  803a4a:	68 73 5f 80 00       	push   $0x805f73
+  803a4f:	e8 4b e9 ff ff       	call   80239f <_panic>
+
+00803a54 <ipc_reply_recv>:
+  803a54:	55                   	push   %ebp
+  803a55:	89 e5                	mov    %esp,%ebp
+  803a57:	57                   	push   %edi
+  803a58:	56                   	push   %esi
+  803a59:	53                   	push   %ebx
+  803a5a:	83 ec 0c             	sub    $0xc,%esp
+  803a5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803a60:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803a63:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803a66:	85 db                	test   %ebx,%ebx
+  803a68:	0f 84 ac 00 00 00    	je     803b1a <ipc_reply_recv+0xc6>
+  803a6e:	85 f6                	test   %esi,%esi
+  803a70:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803a75:	0f 45 c6             	cmovne %esi,%eax
+  803a78:	83 ec 0c             	sub    $0xc,%esp
+  803a7b:	50                   	push   %eax
+  803a7c:	ff 75 14             	push   0x14(%ebp)
+  803a7f:	53                   	push   %ebx
+  803a80:	ff 75 0c             	push   0xc(%ebp)
+  803a83:	ff 75 08             	push   0x8(%ebp)
+  803a86:	e8 ef f8 ff ff       	call   80337a <sys_ipc_reply_recv>
+  803a8b:	83 c4 20             	add    $0x20,%esp
+  803a8e:	85 c0                	test   %eax,%eax
+  803a90:	78 3a                	js     803acc <ipc_reply_recv+0x78>
+  803a92:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803a96:	74 10                	je     803aa8 <ipc_reply_recv+0x54>
+  803a98:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  803a9d:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803aa3:	8b 55 18             	mov    0x18(%ebp),%edx
+  803aa6:	89 02                	mov    %eax,(%edx)
+  803aa8:	85 ff                	test   %edi,%edi
+  803aaa:	74 0d                	je     803ab9 <ipc_reply_recv+0x65>
+  803aac:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  803ab1:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803ab7:	89 07                	mov    %eax,(%edi)
+  803ab9:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  803abe:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803ac4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac7:	5b                   	pop    %ebx
+  803ac8:	5e                   	pop    %esi
+  803ac9:	5f                   	pop    %edi
+  803aca:	5d                   	pop    %ebp
+  803acb:	c3                   	ret
+  803acc:	ff 75 14             	push   0x14(%ebp)
+  803acf:	53                   	push   %ebx
+  803ad0:	ff 75 0c             	push   0xc(%ebp)
+  803ad3:	ff 75 08             	push   0x8(%ebp)
+  803ad6:	e8 51 f7 ff ff       	call   80322c <sys_ipc_try_send>
+  803adb:	89 c2                	mov    %eax,%edx
+  803add:	c1 ea 1f             	shr    $0x1f,%edx
+  803ae0:	83 c4 10             	add    $0x10,%esp
+  803ae3:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803ae6:	0f 95 c1             	setne  %cl
+  803ae9:	84 d1                	test   %dl,%cl
+  803aeb:	74 05                	je     803af2 <ipc_reply_recv+0x9e>
+  803aed:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803af0:	75 12                	jne    803b04 <ipc_reply_recv+0xb0>
+  803af2:	83 ec 04             	sub    $0x4,%esp
+  803af5:	57                   	push   %edi
+  803af6:	56                   	push   %esi
+  803af7:	ff 75 18             	push   0x18(%ebp)
+  803afa:	e8 e3 fd ff ff       	call   8038e2 <ipc_recv>
+  803aff:	83 c4 10             	add    $0x10,%esp
+  803b02:	eb c0                	jmp    803ac4 <ipc_reply_recv+0x70>
+  803b04:	83 ec 04             	sub    $0x4,%esp
+  803b07:	50                   	push   %eax
+  803b08:	ff 75 08             	push   0x8(%ebp)
+  803b0b:	68 50 5f 80 00       	push   $0x805f50
+  803b10:	e8 65 e9 ff ff       	call   80247a <cprintf>
+  803b15:	83 c4 10             	add    $0x10,%esp
+  803b18:	eb d8                	jmp    803af2 <ipc_reply_recv+0x9e>
+  803b1a:	85 f6                	test   %esi,%esi
+  803b1c:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803b21:	0f 45 c6             	cmovne %esi,%eax
+  803b24:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803b29:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803b30:	e9 43 ff ff ff       	jmp    803a78 <ipc_reply_recv+0x24>
+
+00803b35 <ipc_find_env>:
+  803b35:	55                   	push   %ebp
+  803b36:	89 e5                	mov    %esp,%ebp
+  803b38:	83 ec 14             	sub    $0x14,%esp
+  803b3b:	ff 75 08             	push   0x8(%ebp)
+  803b3e:	e8 87 f6 ff ff       	call   8031ca <sys_env_service>
+  803b43:	85 c0                	test   %eax,%eax
+  803b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b4a:	0f 48 c2             	cmovs  %edx,%eax
+  803b4d:	c9                   	leave
+  803b4e:	c3                   	ret
+
+00803b4f <fd2num>:
+  803b4f:	55                   	push   %ebp
+  803b50:	89 e5                	mov    %esp,%ebp
+  803b52:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b55:	05 00 00 00 30       	add    $0x30000000,%eax
+  803b5a:	c1 e8 0c             	shr    $0xc,%eax
+  803b5d:	5d                   	pop    %ebp
+  803b5e:	c3                   	ret
+
+00803b5f <fd2data>:
+  803b5f:	55                   	push   %ebp
+  803b60:	89 e5                	mov    %esp,%ebp
+  803b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b65:	05 00 00 00 30       	add    $0x30000000,%eax
+  803b6a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803b6f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  803b74:	5d                   	pop    %ebp
+  803b75:	c3                   	ret
+
+00803b76 <fd_alloc>:
+  803b76:	55                   	push   %ebp
+  803b77:	89 e5                	mov    %esp,%ebp
+  803b79:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803b7e:	89 c2                	mov    %eax,%edx
+  803b80:	c1 ea 16             	shr    $0x16,%edx
+  803b83:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803b8a:	f6 c2 01             	test   $0x1,%dl
+  803b8d:	74 29                	je     803bb8 <fd_alloc+0x42>
+  803b8f:	89 c2                	mov    %eax,%edx
+  803b91:	c1 ea 0c             	shr    $0xc,%edx
+  803b94:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803b9b:	f6 c2 01             	test   $0x1,%dl
+  803b9e:	74 18                	je     803bb8 <fd_alloc+0x42>
+  803ba0:	05 00 10 00 00       	add    $0x1000,%eax
+  803ba5:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  803baa:	75 d2                	jne    803b7e <fd_alloc+0x8>
+  803bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  803bb6:	eb 05                	jmp    803bbd <fd_alloc+0x47>
+  803bb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  803bc0:	89 02                	mov    %eax,(%edx)
+  803bc2:	89 c8                	mov    %ecx,%eax
+  803bc4:	5d                   	pop    %ebp
+  803bc5:	c3                   	ret
+
+00803bc6 <fd_lookup>:
+  803bc6:	55                   	push   %ebp
+  803bc7:	89 e5                	mov    %esp,%ebp
+  803bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bcc:	83 f8 1f             	cmp    $0x1f,%eax
+  803bcf:	77 30                	ja     803c01 <fd_lookup+0x3b>
+  803bd1:	c1 e0 0c             	shl    $0xc,%eax
+  803bd4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  803bd9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  803bdf:	f6 c2 01             	test   $0x1,%dl
+  803be2:	74 24                	je     803c08 <fd_lookup+0x42>
+  803be4:	89 c2                	mov    %eax,%edx
+  803be6:	c1 ea 0c             	shr    $0xc,%edx
+  803be9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803bf0:	f6 c2 01             	test   $0x1,%dl
+  803bf3:	74 1a                	je     803c0f <fd_lookup+0x49>
+  803bf5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803bf8:	89 02                	mov    %eax,(%edx)
+  803bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bff:	5d                   	pop    %ebp
+  803c00:	c3                   	ret
+  803c01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c06:	eb f7                	jmp    803bff <fd_lookup+0x39>
+  803c08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c0d:	eb f0                	jmp    803bff <fd_lookup+0x39>
+  803c0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c14:	eb e9                	jmp    803bff <fd_lookup+0x39>
+
+00803c16 <dev_lookup>:
+  803c16:	55                   	push   %ebp
+  803c17:	89 e5                	mov    %esp,%ebp
+  803c19:	53                   	push   %ebx
+  803c1a:	83 ec 04             	sub    $0x4,%esp
+  803c1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c25:	bb 84 b0 80 00       	mov    $0x80b084,%ebx
+  803c2a:	39 13                	cmp    %edx,(%ebx)
+  803c2c:	74 37                	je     803c65 <dev_lookup+0x4f>
+  803c2e:	83 c0 01             	add    $0x1,%eax
+  803c31:	8b 1c 85 18 60 80 00 	mov    0x806018(,%eax,4),%ebx
+  803c38:	85 db                	test   %ebx,%ebx
+  803c3a:	75 ee                	jne    803c2a <dev_lookup+0x14>
+  803c3c:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  803c41:	8b 40 48             	mov    0x48(%eax),%eax
+  803c44:	83 ec 04             	sub    $0x4,%esp
+  803c47:	52                   	push   %edx
+  803c48:	50                   	push   %eax
+  803c49:	68 9c 5f 80 00       	push   $0x805f9c
+  803c4e:	e8 27 e8 ff ff       	call   80247a <cprintf>
+  803c53:	83 c4 10             	add    $0x10,%esp
+  803c56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c5b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c5e:	89 1a                	mov    %ebx,(%edx)
+  803c60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c63:	c9                   	leave
+  803c64:	c3                   	ret
+  803c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c6a:	eb ef                	jmp    803c5b <dev_lookup+0x45>
+
+00803c6c <fd_close>:
+  803c6c:	55                   	push   %ebp
+  803c6d:	89 e5                	mov    %esp,%ebp
+  803c6f:	57                   	push   %edi
+  803c70:	56                   	push   %esi
+  803c71:	53                   	push   %ebx
+  803c72:	83 ec 24             	sub    $0x24,%esp
+  803c75:	8b 75 08             	mov    0x8(%ebp),%esi
+  803c78:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803c7b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803c7e:	50                   	push   %eax
+  803c7f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  803c85:	c1 e8 0c             	shr    $0xc,%eax
+  803c88:	50                   	push   %eax
+  803c89:	e8 38 ff ff ff       	call   803bc6 <fd_lookup>
+  803c8e:	89 c3                	mov    %eax,%ebx
+  803c90:	83 c4 10             	add    $0x10,%esp
+  803c93:	85 c0                	test   %eax,%eax
+  803c95:	78 05                	js     803c9c <fd_close+0x30>
+  803c97:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  803c9a:	74 0f                	je     803cab <fd_close+0x3f>
+  803c9c:	85 ff                	test   %edi,%edi
+  803c9e:	0f 44 df             	cmove  %edi,%ebx
+  803ca1:	89 d8                	mov    %ebx,%eax
+  803ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ca6:	5b                   	pop    %ebx
+  803ca7:	5e                   	pop    %esi
+  803ca8:	5f                   	pop    %edi
+  803ca9:	5d                   	pop    %ebp
+  803caa:	c3                   	ret
+  803cab:	83 ec 08             	sub    $0x8,%esp
+  803cae:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  803cb1:	50                   	push   %eax
+  803cb2:	ff 36                	push   (%esi)
+  803cb4:	e8 5d ff ff ff       	call   803c16 <dev_lookup>
+  803cb9:	89 c3                	mov    %eax,%ebx
+  803cbb:	83 c4 10             	add    $0x10,%esp
+  803cbe:	85 c0                	test   %eax,%eax
+  803cc0:	78 1a                	js     803cdc <fd_close+0x70>
+  803cc2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803cc5:	8b 40 10             	mov    0x10(%eax),%eax
+  803cc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ccd:	85 c0                	test   %eax,%eax
+  803ccf:	74 0b                	je     803cdc <fd_close+0x70>
+  803cd1:	83 ec 0c             	sub    $0xc,%esp
+  803cd4:	56                   	push   %esi
+  803cd5:	ff d0                	call   *%eax
+  803cd7:	89 c3                	mov    %eax,%ebx
+  803cd9:	83 c4 10             	add    $0x10,%esp
+  803cdc:	83 ec 08             	sub    $0x8,%esp
+  803cdf:	56                   	push   %esi
+  803ce0:	6a 00                	push   $0x0
+  803ce2:	e8 bc f3 ff ff       	call   8030a3 <sys_page_unmap>
+  803ce7:	83 c4 10             	add    $0x10,%esp
+  803cea:	eb b5                	jmp    803ca1 <fd_close+0x35>
+
+00803cec <close>:
+  803cec:	55                   	push   %ebp
+  803ced:	89 e5                	mov    %esp,%ebp
+  803cef:	83 ec 20             	sub    $0x20,%esp
+  803cf2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cf5:	50                   	push   %eax
+  803cf6:	ff 75 08             	push   0x8(%ebp)
+  803cf9:	e8 c8 fe ff ff       	call   803bc6 <fd_lookup>
+  803cfe:	83 c4 10             	add    $0x10,%esp
+  803d01:	85 c0                	test   %eax,%eax
+  803d03:	79 02                	jns    803d07 <close+0x1b>
+  803d05:	c9                   	leave
+  803d06:	c3                   	ret
+  803d07:	83 ec 08             	sub    $0x8,%esp
+  803d0a:	6a 01                	push   $0x1
+  803d0c:	ff 75 f4             	push   -0xc(%ebp)
+  803d0f:	e8 58 ff ff ff       	call   803c6c <fd_close>
+  803d14:	83 c4 10             	add    $0x10,%esp
+  803d17:	eb ec                	jmp    803d05 <close+0x19>
+
+00803d19 <close_all>:
+  803d19:	55                   	push   %ebp
+  803d1a:	89 e5                	mov    %esp,%ebp
+  803d1c:	53                   	push   %ebx
+  803d1d:	83 ec 04             	sub    $0x4,%esp
+  803d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d25:	83 ec 0c             	sub    $0xc,%esp
+  803d28:	53                   	push   %ebx
+  803d29:	e8 be ff ff ff       	call   803cec <close>
+  803d2e:	83 c3 01             	add    $0x1,%ebx
+  803d31:	83 c4 10             	add    $0x10,%esp
+  803d34:	83 fb 20             	cmp    $0x20,%ebx
+  803d37:	75 ec                	jne    803d25 <close_all+0xc>
+  803d39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d3c:	c9                   	leave
+  803d3d:	c3                   	ret
+
+00803d3e <dup>:
+  803d3e:	55                   	push   %ebp
+  803d3f:	89 e5                	mov    %esp,%ebp
+  803d41:	57                   	push   %edi
+  803d42:	56                   	push   %esi
+  803d43:	53                   	push   %ebx
+  803d44:	83 ec 34             	sub    $0x34,%esp
+  803d47:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803d4a:	50                   	push   %eax
+  803d4b:	ff 75 08             	push   0x8(%ebp)
+  803d4e:	e8 73 fe ff ff       	call   803bc6 <fd_lookup>
+  803d53:	89 c3                	mov    %eax,%ebx
+  803d55:	83 c4 10             	add    $0x10,%esp
+  803d58:	85 c0                	test   %eax,%eax
+  803d5a:	78 7f                	js     803ddb <dup+0x9d>
+  803d5c:	83 ec 0c             	sub    $0xc,%esp
+  803d5f:	ff 75 0c             	push   0xc(%ebp)
+  803d62:	e8 85 ff ff ff       	call   803cec <close>
+  803d67:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803d6a:	c1 e6 0c             	shl    $0xc,%esi
+  803d6d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  803d73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803d76:	89 3c 24             	mov    %edi,(%esp)
+  803d79:	e8 e1 fd ff ff       	call   803b5f <fd2data>
+  803d7e:	89 c3                	mov    %eax,%ebx
+  803d80:	89 34 24             	mov    %esi,(%esp)
+  803d83:	e8 d7 fd ff ff       	call   803b5f <fd2data>
+  803d88:	83 c4 10             	add    $0x10,%esp
+  803d8b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803d8e:	89 d8                	mov    %ebx,%eax
+  803d90:	c1 e8 16             	shr    $0x16,%eax
+  803d93:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803d9a:	a8 01                	test   $0x1,%al
+  803d9c:	74 11                	je     803daf <dup+0x71>
+  803d9e:	89 d8                	mov    %ebx,%eax
+  803da0:	c1 e8 0c             	shr    $0xc,%eax
+  803da3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803daa:	f6 c2 01             	test   $0x1,%dl
+  803dad:	75 36                	jne    803de5 <dup+0xa7>
+  803daf:	89 f8                	mov    %edi,%eax
+  803db1:	c1 e8 0c             	shr    $0xc,%eax
+  803db4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803dbb:	83 ec 0c             	sub    $0xc,%esp
+  803dbe:	25 07 0e 00 00       	and    $0xe07,%eax
+  803dc3:	50                   	push   %eax
+  803dc4:	56                   	push   %esi
+  803dc5:	6a 00                	push   $0x0
+  803dc7:	57                   	push   %edi
+  803dc8:	6a 00                	push   $0x0
+  803dca:	e8 45 f2 ff ff       	call   803014 <sys_page_map>
+  803dcf:	89 c3                	mov    %eax,%ebx
+  803dd1:	83 c4 20             	add    $0x20,%esp
+  803dd4:	85 c0                	test   %eax,%eax
+  803dd6:	78 33                	js     803e0b <dup+0xcd>
+  803dd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803ddb:	89 d8                	mov    %ebx,%eax
+  803ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803de0:	5b                   	pop    %ebx
+  803de1:	5e                   	pop    %esi
+  803de2:	5f                   	pop    %edi
+  803de3:	5d                   	pop    %ebp
+  803de4:	c3                   	ret
+  803de5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803dec:	83 ec 0c             	sub    $0xc,%esp
+  803def:	25 07 0e 00 00       	and    $0xe07,%eax
+  803df4:	50                   	push   %eax
+  803df5:	ff 75 d4             	push   -0x2c(%ebp)
+  803df8:	6a 00                	push   $0x0
+  803dfa:	53                   	push   %ebx
+  803dfb:	6a 00                	push   $0x0
+  803dfd:	e8 12 f2 ff ff       	call   803014 <sys_page_map>
+  803e02:	89 c3                	mov    %eax,%ebx
+  803e04:	83 c4 20             	add    $0x20,%esp
+  803e07:	85 c0                	test   %eax,%eax
+  803e09:	79 a4                	jns    803daf <dup+0x71>
+  803e0b:	83 ec 08             	sub    $0x8,%esp
+  803e0e:	56                   	push   %esi
+  803e0f:	6a 00                	push   $0x0
+  803e11:	e8 8d f2 ff ff       	call   8030a3 <sys_page_unmap>
+  803e16:	83 c4 08             	add    $0x8,%esp
+  803e19:	ff 75 d4             	push   -0x2c(%ebp)
+  803e1c:	6a 00                	push   $0x0
+  803e1e:	e8 80 f2 ff ff       	call   8030a3 <sys_page_unmap>
+  803e23:	83 c4 10             	add    $0x10,%esp
+  803e26:	eb b3                	jmp    803ddb <dup+0x9d>
+
+00803e28 <read>:
+  803e28:	55                   	push   %ebp
+  803e29:	89 e5                	mov    %esp,%ebp
+  803e2b:	56                   	push   %esi
+  803e2c:	53                   	push   %ebx
+  803e2d:	83 ec 18             	sub    $0x18,%esp
+  803e30:	8b 75 08             	mov    0x8(%ebp),%esi
+  803e33:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803e36:	50                   	push   %eax
+  803e37:	56                   	push   %esi
+  803e38:	e8 89 fd ff ff       	call   803bc6 <fd_lookup>
+  803e3d:	83 c4 10             	add    $0x10,%esp
+  803e40:	85 c0                	test   %eax,%eax
+  803e42:	78 3c                	js     803e80 <read+0x58>
+  803e44:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  803e47:	83 ec 08             	sub    $0x8,%esp
+  803e4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e4d:	50                   	push   %eax
+  803e4e:	ff 33                	push   (%ebx)
+  803e50:	e8 c1 fd ff ff       	call   803c16 <dev_lookup>
+  803e55:	83 c4 10             	add    $0x10,%esp
+  803e58:	85 c0                	test   %eax,%eax
+  803e5a:	78 24                	js     803e80 <read+0x58>
+  803e5c:	8b 43 08             	mov    0x8(%ebx),%eax
+  803e5f:	83 e0 03             	and    $0x3,%eax
+  803e62:	83 f8 01             	cmp    $0x1,%eax
+  803e65:	74 20                	je     803e87 <read+0x5f>
+  803e67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e6a:	8b 40 08             	mov    0x8(%eax),%eax
+  803e6d:	85 c0                	test   %eax,%eax
+  803e6f:	74 37                	je     803ea8 <read+0x80>
+  803e71:	83 ec 04             	sub    $0x4,%esp
+  803e74:	ff 75 10             	push   0x10(%ebp)
+  803e77:	ff 75 0c             	push   0xc(%ebp)
+  803e7a:	53                   	push   %ebx
+  803e7b:	ff d0                	call   *%eax
+  803e7d:	83 c4 10             	add    $0x10,%esp
+  803e80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e83:	5b                   	pop    %ebx
+  803e84:	5e                   	pop    %esi
+  803e85:	5d                   	pop    %ebp
+  803e86:	c3                   	ret
+  803e87:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  803e8c:	8b 40 48             	mov    0x48(%eax),%eax
+  803e8f:	83 ec 04             	sub    $0x4,%esp
+  803e92:	56                   	push   %esi
+  803e93:	50                   	push   %eax
+  803e94:	68 dd 5f 80 00       	push   $0x805fdd
+  803e99:	e8 dc e5 ff ff       	call   80247a <cprintf>
+  803e9e:	83 c4 10             	add    $0x10,%esp
+  803ea1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ea6:	eb d8                	jmp    803e80 <read+0x58>
+  803ea8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ead:	eb d1                	jmp    803e80 <read+0x58>
+
+00803eaf <readn>:
+  803eaf:	55                   	push   %ebp
+  803eb0:	89 e5                	mov    %esp,%ebp
+  803eb2:	57                   	push   %edi
+  803eb3:	56                   	push   %esi
+  803eb4:	53                   	push   %ebx
+  803eb5:	83 ec 0c             	sub    $0xc,%esp
+  803eb8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803ebb:	8b 75 10             	mov    0x10(%ebp),%esi
+  803ebe:	85 f6                	test   %esi,%esi
+  803ec0:	74 30                	je     803ef2 <readn+0x43>
+  803ec2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecc:	83 ec 04             	sub    $0x4,%esp
+  803ecf:	89 f2                	mov    %esi,%edx
+  803ed1:	29 c2                	sub    %eax,%edx
+  803ed3:	52                   	push   %edx
+  803ed4:	01 f8                	add    %edi,%eax
+  803ed6:	50                   	push   %eax
+  803ed7:	ff 75 08             	push   0x8(%ebp)
+  803eda:	e8 49 ff ff ff       	call   803e28 <read>
+  803edf:	83 c4 10             	add    $0x10,%esp
+  803ee2:	85 c0                	test   %eax,%eax
+  803ee4:	78 15                	js     803efb <readn+0x4c>
+  803ee6:	74 11                	je     803ef9 <readn+0x4a>
+  803ee8:	01 c3                	add    %eax,%ebx
+  803eea:	89 d8                	mov    %ebx,%eax
+  803eec:	39 f3                	cmp    %esi,%ebx
+  803eee:	72 dc                	jb     803ecc <readn+0x1d>
+  803ef0:	eb 09                	jmp    803efb <readn+0x4c>
+  803ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef7:	eb 02                	jmp    803efb <readn+0x4c>
+  803ef9:	89 d8                	mov    %ebx,%eax
+  803efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803efe:	5b                   	pop    %ebx
+  803eff:	5e                   	pop    %esi
+  803f00:	5f                   	pop    %edi
+  803f01:	5d                   	pop    %ebp
+  803f02:	c3                   	ret
+
+00803f03 <write>:
+  803f03:	55                   	push   %ebp
+  803f04:	89 e5                	mov    %esp,%ebp
+  803f06:	56                   	push   %esi
+  803f07:	53                   	push   %ebx
+  803f08:	83 ec 18             	sub    $0x18,%esp
+  803f0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f0e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803f11:	50                   	push   %eax
+  803f12:	53                   	push   %ebx
+  803f13:	e8 ae fc ff ff       	call   803bc6 <fd_lookup>
+  803f18:	83 c4 10             	add    $0x10,%esp
+  803f1b:	85 c0                	test   %eax,%eax
+  803f1d:	78 37                	js     803f56 <write+0x53>
+  803f1f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803f22:	83 ec 08             	sub    $0x8,%esp
+  803f25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f28:	50                   	push   %eax
+  803f29:	ff 36                	push   (%esi)
+  803f2b:	e8 e6 fc ff ff       	call   803c16 <dev_lookup>
+  803f30:	83 c4 10             	add    $0x10,%esp
+  803f33:	85 c0                	test   %eax,%eax
+  803f35:	78 1f                	js     803f56 <write+0x53>
+  803f37:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  803f3b:	74 20                	je     803f5d <write+0x5a>
+  803f3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f40:	8b 40 0c             	mov    0xc(%eax),%eax
+  803f43:	85 c0                	test   %eax,%eax
+  803f45:	74 37                	je     803f7e <write+0x7b>
+  803f47:	83 ec 04             	sub    $0x4,%esp
+  803f4a:	ff 75 10             	push   0x10(%ebp)
+  803f4d:	ff 75 0c             	push   0xc(%ebp)
+  803f50:	56                   	push   %esi
+  803f51:	ff d0                	call   *%eax
+  803f53:	83 c4 10             	add    $0x10,%esp
+  803f56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f59:	5b                   	pop    %ebx
+  803f5a:	5e                   	pop    %esi
+  803f5b:	5d                   	pop    %ebp
+  803f5c:	c3                   	ret
+  803f5d:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  803f62:	8b 40 48             	mov    0x48(%eax),%eax
+  803f65:	83 ec 04             	sub    $0x4,%esp
+  803f68:	53                   	push   %ebx
+  803f69:	50                   	push   %eax
+  803f6a:	68 f9 5f 80 00       	push   $0x805ff9
+  803f6f:	e8 06 e5 ff ff       	call   80247a <cprintf>
+  803f74:	83 c4 10             	add    $0x10,%esp
+  803f77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f7c:	eb d8                	jmp    803f56 <write+0x53>
+  803f7e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803f83:	eb d1                	jmp    803f56 <write+0x53>
+
+00803f85 <seek>:
+  803f85:	55                   	push   %ebp
+  803f86:	89 e5                	mov    %esp,%ebp
+  803f88:	83 ec 20             	sub    $0x20,%esp
+  803f8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f8e:	50                   	push   %eax
+  803f8f:	ff 75 08             	push   0x8(%ebp)
+  803f92:	e8 2f fc ff ff       	call   803bc6 <fd_lookup>
+  803f97:	83 c4 10             	add    $0x10,%esp
+  803f9a:	85 c0                	test   %eax,%eax
+  803f9c:	78 0e                	js     803fac <seek+0x27>
+  803f9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fa1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fa4:	89 50 04             	mov    %edx,0x4(%eax)
+  803fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fac:	c9                   	leave
+  803fad:	c3                   	ret
+
+00803fae <ftruncate>:
+  803fae:	55                   	push   %ebp
+  803faf:	89 e5                	mov    %esp,%ebp
+  803fb1:	56                   	push   %esi
+  803fb2:	53                   	push   %ebx
+  803fb3:	83 ec 18             	sub    $0x18,%esp
+  803fb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803fb9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803fbc:	50                   	push   %eax
+  803fbd:	53                   	push   %ebx
+  803fbe:	e8 03 fc ff ff       	call   803bc6 <fd_lookup>
+  803fc3:	83 c4 10             	add    $0x10,%esp
+  803fc6:	85 c0                	test   %eax,%eax
+  803fc8:	78 34                	js     803ffe <ftruncate+0x50>
+  803fca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803fcd:	83 ec 08             	sub    $0x8,%esp
+  803fd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803fd3:	50                   	push   %eax
+  803fd4:	ff 36                	push   (%esi)
+  803fd6:	e8 3b fc ff ff       	call   803c16 <dev_lookup>
+  803fdb:	83 c4 10             	add    $0x10,%esp
+  803fde:	85 c0                	test   %eax,%eax
+  803fe0:	78 1c                	js     803ffe <ftruncate+0x50>
+  803fe2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  803fe6:	74 1d                	je     804005 <ftruncate+0x57>
+  803fe8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803feb:	8b 40 18             	mov    0x18(%eax),%eax
+  803fee:	85 c0                	test   %eax,%eax
+  803ff0:	74 34                	je     804026 <ftruncate+0x78>
+  803ff2:	83 ec 08             	sub    $0x8,%esp
+  803ff5:	ff 75 0c             	push   0xc(%ebp)
+  803ff8:	56                   	push   %esi
+  803ff9:	ff d0                	call   *%eax
+  803ffb:	83 c4 10             	add    $0x10,%esp
+  803ffe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804001:	5b                   	pop    %ebx
+  804002:	5e                   	pop    %esi
+  804003:	5d                   	pop    %ebp
+  804004:	c3                   	ret
+  804005:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  80400a:	8b 40 48             	mov    0x48(%eax),%eax
+  80400d:	83 ec 04             	sub    $0x4,%esp
+  804010:	53                   	push   %ebx
+  804011:	50                   	push   %eax
+  804012:	68 bc 5f 80 00       	push   $0x805fbc
+  804017:	e8 5e e4 ff ff       	call   80247a <cprintf>
+  80401c:	83 c4 10             	add    $0x10,%esp
+  80401f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804024:	eb d8                	jmp    803ffe <ftruncate+0x50>
+  804026:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80402b:	eb d1                	jmp    803ffe <ftruncate+0x50>
+
+0080402d <fstat>:
+  80402d:	55                   	push   %ebp
+  80402e:	89 e5                	mov    %esp,%ebp
+  804030:	56                   	push   %esi
+  804031:	53                   	push   %ebx
+  804032:	83 ec 18             	sub    $0x18,%esp
+  804035:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804038:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80403b:	50                   	push   %eax
+  80403c:	ff 75 08             	push   0x8(%ebp)
+  80403f:	e8 82 fb ff ff       	call   803bc6 <fd_lookup>
+  804044:	83 c4 10             	add    $0x10,%esp
+  804047:	85 c0                	test   %eax,%eax
+  804049:	78 49                	js     804094 <fstat+0x67>
+  80404b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80404e:	83 ec 08             	sub    $0x8,%esp
+  804051:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804054:	50                   	push   %eax
+  804055:	ff 36                	push   (%esi)
+  804057:	e8 ba fb ff ff       	call   803c16 <dev_lookup>
+  80405c:	83 c4 10             	add    $0x10,%esp
+  80405f:	85 c0                	test   %eax,%eax
+  804061:	78 31                	js     804094 <fstat+0x67>
+  804063:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804066:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80406a:	74 2f                	je     80409b <fstat+0x6e>
+  80406c:	c6 03 00             	movb   $0x0,(%ebx)
+  80406f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  804076:	00 00 00 
+  804079:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804080:	00 00 00 
+  804083:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  804089:	83 ec 08             	sub    $0x8,%esp
+  80408c:	53                   	push   %ebx
+  80408d:	56                   	push   %esi
+  80408e:	ff 50 14             	call   *0x14(%eax)
+  804091:	83 c4 10             	add    $0x10,%esp
+  804094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804097:	5b                   	pop    %ebx
+  804098:	5e                   	pop    %esi
+  804099:	5d                   	pop    %ebp
+  80409a:	c3                   	ret
+  80409b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8040a0:	eb f2                	jmp    804094 <fstat+0x67>
+
+008040a2 <stat>:
+  8040a2:	55                   	push   %ebp
+  8040a3:	89 e5                	mov    %esp,%ebp
+  8040a5:	56                   	push   %esi
+  8040a6:	53                   	push   %ebx
+  8040a7:	83 ec 08             	sub    $0x8,%esp
+  8040aa:	6a 00                	push   $0x0
+  8040ac:	ff 75 08             	push   0x8(%ebp)
+  8040af:	e8 31 05 00 00       	call   8045e5 <open>
+  8040b4:	89 c3                	mov    %eax,%ebx
+  8040b6:	83 c4 10             	add    $0x10,%esp
+  8040b9:	85 c0                	test   %eax,%eax
+  8040bb:	78 1b                	js     8040d8 <stat+0x36>
+  8040bd:	83 ec 08             	sub    $0x8,%esp
+  8040c0:	ff 75 0c             	push   0xc(%ebp)
+  8040c3:	50                   	push   %eax
+  8040c4:	e8 64 ff ff ff       	call   80402d <fstat>
+  8040c9:	89 c6                	mov    %eax,%esi
+  8040cb:	89 1c 24             	mov    %ebx,(%esp)
+  8040ce:	e8 19 fc ff ff       	call   803cec <close>
+  8040d3:	83 c4 10             	add    $0x10,%esp
+  8040d6:	89 f3                	mov    %esi,%ebx
+  8040d8:	89 d8                	mov    %ebx,%eax
+  8040da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040dd:	5b                   	pop    %ebx
+  8040de:	5e                   	pop    %esi
+  8040df:	5d                   	pop    %ebp
+  8040e0:	c3                   	ret
+
+008040e1 <fsipc>:
+  8040e1:	55                   	push   %ebp
+  8040e2:	89 e5                	mov    %esp,%ebp
+  8040e4:	56                   	push   %esi
+  8040e5:	53                   	push   %ebx
+  8040e6:	89 c3                	mov    %eax,%ebx
+  8040e8:	89 d6                	mov    %edx,%esi
+  8040ea:	83 3d 08 c0 80 00 00 	cmpl   $0x0,0x80c008
+  8040f1:	74 20                	je     804113 <fsipc+0x32>
+  8040f3:	83 ec 08             	sub    $0x8,%esp
+  8040f6:	6a 00                	push   $0x0
+  8040f8:	56                   	push   %esi
+  8040f9:	6a 07                	push   $0x7
+  8040fb:	68 00 e0 80 00       	push   $0x80e000
+  804100:	53                   	push   %ebx
+  804101:	ff 35 08 c0 80 00    	push   0x80c008
+  804107:	e8 8e f8 ff ff       	call   80399a <ipc_call>
+  80410c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80410f:	5b                   	pop    %ebx
+  804110:	5e                   	pop    %esi
+  804111:	5d                   	pop    %ebp
+  804112:	c3                   	ret
+  804113:	83 ec 0c             	sub    $0xc,%esp
+  804116:	6a 02                	push   $0x2
+  804118:	e8 18 fa ff ff       	call   803b35 <ipc_find_env>
+  80411d:	a3 08 c0 80 00       	mov    %eax,0x80c008
+  804122:	83 c4 10             	add    $0x10,%esp
+  804125:	eb cc                	jmp    8040f3 <fsipc+0x12>
+
+00804127 <devfile_trunc>:
+  804127:	55                   	push   %ebp
+  804128:	89 e5                	mov    %esp,%ebp
+  80412a:	83 ec 08             	sub    $0x8,%esp
+  80412d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804130:	8b 40 0c             	mov    0xc(%eax),%eax
+  804133:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  804138:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80413b:	a3 04 e0 80 00       	mov    %eax,0x80e004
+  804140:	ba 00 00 00 00       	mov    $0x0,%edx
+  804145:	b8 02 00 00 00       	mov    $0x2,%eax
+  80414a:	e8 92 ff ff ff       	call   8040e1 <fsipc>
+  80414f:	c9                   	leave
+  804150:	c3                   	ret
+
+00804151 <devfile_flush>:
+  804151:	55                   	push   %ebp
+  804152:	89 e5                	mov    %esp,%ebp
+  804154:	83 ec 08             	sub    $0x8,%esp
+  804157:	8b 45 08             	mov    0x8(%ebp),%eax
+  80415a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80415d:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  804162:	ba 00 00 00 00       	mov    $0x0,%edx
+  804167:	b8 08 00 00 00       	mov    $0x8,%eax
+  80416c:	e8 70 ff ff ff       	call   8040e1 <fsipc>
+  804171:	c9                   	leave
+  804172:	c3                   	ret
+
+00804173 <devfile_stat>:
+  804173:	55                   	push   %ebp
+  804174:	89 e5                	mov    %esp,%ebp
+  804176:	53                   	push   %ebx
+  804177:	83 ec 04             	sub    $0x4,%esp
+  80417a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80417d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804180:	8b 40 0c             	mov    0xc(%eax),%eax
+  804183:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  804188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80418d:	b8 07 00 00 00       	mov    $0x7,%eax
+  804192:	e8 4a ff ff ff       	call   8040e1 <fsipc>
+  804197:	85 c0                	test   %eax,%eax
+  804199:	78 2c                	js     8041c7 <devfile_stat+0x54>
+  80419b:	83 ec 08             	sub    $0x8,%esp
+  80419e:	68 00 e0 80 00       	push   $0x80e000
+  8041a3:	53                   	push   %ebx
+  8041a4:	e8 c8 e9 ff ff       	call   802b71 <strcpy>
+  8041a9:	a1 80 e0 80 00       	mov    0x80e080,%eax
+  8041ae:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8041b4:	a1 84 e0 80 00       	mov    0x80e084,%eax
+  8041b9:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8041bf:	83 c4 10             	add    $0x10,%esp
+  8041c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041ca:	c9                   	leave
+  8041cb:	c3                   	ret
+
+008041cc <fsring_rw>:
+  8041cc:	55                   	push   %ebp
+  8041cd:	89 e5                	mov    %esp,%ebp
+  8041cf:	57                   	push   %edi
+  8041d0:	56                   	push   %esi
+  8041d1:	53                   	push   %ebx
+  8041d2:	83 ec 2c             	sub    $0x2c,%esp
+  8041d5:	89 c7                	mov    %eax,%edi
+  8041d7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8041da:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8041dd:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8041e2:	a8 01                	test   $0x1,%al
+  8041e4:	74 0d                	je     8041f3 <fsring_rw+0x27>
+  8041e6:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8041eb:	a8 01                	test   $0x1,%al
+  8041ed:	0f 85 d5 00 00 00    	jne    8042c8 <fsring_rw+0xfc>
+  8041f3:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  8041f8:	8b 40 48             	mov    0x48(%eax),%eax
+  8041fb:	3b 05 04 c0 80 00    	cmp    0x80c004,%eax
+  804201:	0f 84 fc 00 00 00    	je     804303 <fsring_rw+0x137>
+  804207:	83 3d 08 c0 80 00 00 	cmpl   $0x0,0x80c008
+  80420e:	0f 84 02 01 00 00    	je     804316 <fsring_rw+0x14a>
+  804214:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  804219:	83 ec 04             	sub    $0x4,%esp
+  80421c:	68 07 02 00 00       	push   $0x207
+  804221:	53                   	push   %ebx
+  804222:	6a 00                	push   $0x0
+  804224:	e8 a8 ed ff ff       	call   802fd1 <sys_page_alloc>
+  804229:	83 c4 10             	add    $0x10,%esp
+  80422c:	85 c0                	test   %eax,%eax
+  80422e:	0f 88 f9 00 00 00    	js     80432d <fsring_rw+0x161>
+  804234:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80423a:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  804240:	75 d7                	jne    804219 <fsring_rw+0x4d>
+  804242:	6a 0e                	push   $0xe
+  804244:	6a 0d                	push   $0xd
+  804246:	ff 35 08 c0 80 00    	push   0x80c008
+  80424c:	68 00 00 f0 cf       	push   $0xcff00000
+  804251:	e8 06 0d 00 00       	call   804f5c <ipcring_init>
+  804256:	83 c4 08             	add    $0x8,%esp
+  804259:	6a 00                	push   $0x0
+  80425b:	6a 00                	push   $0x0
+  80425d:	68 07 02 00 00       	push   $0x207
+  804262:	68 00 00 f0 cf       	push   $0xcff00000
+  804267:	6a 0b                	push   $0xb
+  804269:	ff 35 08 c0 80 00    	push   0x80c008
+  80426f:	e8 26 f7 ff ff       	call   80399a <ipc_call>
+  804274:	89 c6                	mov    %eax,%esi
+  804276:	83 c4 20             	add    $0x20,%esp
+  804279:	85 c0                	test   %eax,%eax
+  80427b:	0f 88 ac 00 00 00    	js     80432d <fsring_rw+0x161>
+  804281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804286:	89 d9                	mov    %ebx,%ecx
+  804288:	83 c3 01             	add    $0x1,%ebx
+  80428b:	89 da                	mov    %ebx,%edx
+  80428d:	c1 e2 0c             	shl    $0xc,%edx
+  804290:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  804296:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80429c:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8042a2:	83 ec 08             	sub    $0x8,%esp
+  8042a5:	6a 00                	push   $0x0
+  8042a7:	6a 00                	push   $0x0
+  8042a9:	68 07 02 00 00       	push   $0x207
+  8042ae:	50                   	push   %eax
+  8042af:	6a 0c                	push   $0xc
+  8042b1:	ff 35 08 c0 80 00    	push   0x80c008
+  8042b7:	e8 de f6 ff ff       	call   80399a <ipc_call>
+  8042bc:	83 c4 20             	add    $0x20,%esp
+  8042bf:	85 c0                	test   %eax,%eax
+  8042c1:	78 6a                	js     80432d <fsring_rw+0x161>
+  8042c3:	83 fb 08             	cmp    $0x8,%ebx
+  8042c6:	75 be                	jne    804286 <fsring_rw+0xba>
+  8042c8:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8042cc:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8042d1:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8042d6:	0f 45 c2             	cmovne %edx,%eax
+  8042d9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8042dc:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8042e3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8042ea:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8042f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8042fb:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8042fe:	e9 4b 01 00 00       	jmp    80444e <fsring_rw+0x282>
+  804303:	e8 93 f0 ff ff       	call   80339b <sys_time_msec>
+  804308:	3b 05 00 c0 80 00    	cmp    0x80c000,%eax
+  80430e:	0f 89 f3 fe ff ff    	jns    804207 <fsring_rw+0x3b>
+  804314:	eb 54                	jmp    80436a <fsring_rw+0x19e>
+  804316:	83 ec 0c             	sub    $0xc,%esp
+  804319:	6a 02                	push   $0x2
+  80431b:	e8 15 f8 ff ff       	call   803b35 <ipc_find_env>
+  804320:	a3 08 c0 80 00       	mov    %eax,0x80c008
+  804325:	83 c4 10             	add    $0x10,%esp
+  804328:	e9 e7 fe ff ff       	jmp    804214 <fsring_rw+0x48>
+  80432d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  804332:	83 ec 08             	sub    $0x8,%esp
+  804335:	53                   	push   %ebx
+  804336:	6a 00                	push   $0x0
+  804338:	e8 66 ed ff ff       	call   8030a3 <sys_page_unmap>
+  80433d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804343:	83 c4 10             	add    $0x10,%esp
+  804346:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80434c:	75 e4                	jne    804332 <fsring_rw+0x166>
+  80434e:	e8 48 f0 ff ff       	call   80339b <sys_time_msec>
+  804353:	05 e8 03 00 00       	add    $0x3e8,%eax
+  804358:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  80435d:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  804362:	8b 40 48             	mov    0x48(%eax),%eax
+  804365:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  80436a:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  804371:	e9 7a 01 00 00       	jmp    8044f0 <fsring_rw+0x324>
+  804376:	8b 57 0c             	mov    0xc(%edi),%edx
+  804379:	89 10                	mov    %edx,(%eax)
+  80437b:	89 58 04             	mov    %ebx,0x4(%eax)
+  80437e:	89 f2                	mov    %esi,%edx
+  804380:	03 57 04             	add    0x4(%edi),%edx
+  804383:	89 50 08             	mov    %edx,0x8(%eax)
+  804386:	83 ec 04             	sub    $0x4,%esp
+  804389:	53                   	push   %ebx
+  80438a:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80438d:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  804390:	52                   	push   %edx
+  804391:	83 c0 0c             	add    $0xc,%eax
+  804394:	50                   	push   %eax
+  804395:	e8 87 e9 ff ff       	call   802d21 <memmove>
+  80439a:	83 c4 10             	add    $0x10,%esp
+  80439d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8043a0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8043a3:	89 08                	mov    %ecx,(%eax)
+  8043a5:	83 ec 0c             	sub    $0xc,%esp
+  8043a8:	68 00 00 f0 cf       	push   $0xcff00000
+  8043ad:	e8 08 0c 00 00       	call   804fba <ipcring_req_push>
+  8043b2:	01 de                	add    %ebx,%esi
+  8043b4:	83 c4 10             	add    $0x10,%esp
+  8043b7:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8043ba:	73 4c                	jae    804408 <fsring_rw+0x23c>
+  8043bc:	83 ec 0c             	sub    $0xc,%esp
+  8043bf:	68 00 00 f0 cf       	push   $0xcff00000
+  8043c4:	e8 cb 0b 00 00       	call   804f94 <ipcring_req_slot>
+  8043c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8043cc:	83 c4 10             	add    $0x10,%esp
+  8043cf:	85 c0                	test   %eax,%eax
+  8043d1:	74 35                	je     804408 <fsring_rw+0x23c>
+  8043d3:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8043d8:	83 e0 07             	and    $0x7,%eax
+  8043db:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8043e0:	c1 e0 0c             	shl    $0xc,%eax
+  8043e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8043e6:	29 f3                	sub    %esi,%ebx
+  8043e8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8043eb:	39 cb                	cmp    %ecx,%ebx
+  8043ed:	0f 47 d9             	cmova  %ecx,%ebx
+  8043f0:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8043f4:	75 80                	jne    804376 <fsring_rw+0x1aa>
+  8043f6:	8b 57 0c             	mov    0xc(%edi),%edx
+  8043f9:	89 10                	mov    %edx,(%eax)
+  8043fb:	89 58 04             	mov    %ebx,0x4(%eax)
+  8043fe:	89 f2                	mov    %esi,%edx
+  804400:	03 57 04             	add    0x4(%edi),%edx
+  804403:	89 50 08             	mov    %edx,0x8(%eax)
+  804406:	eb 95                	jmp    80439d <fsring_rw+0x1d1>
+  804408:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80440d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804410:	83 ec 0c             	sub    $0xc,%esp
+  804413:	68 00 00 f0 cf       	push   $0xcff00000
+  804418:	e8 d6 0b 00 00       	call   804ff3 <ipcring_rsp_wait>
+  80441d:	8b 58 04             	mov    0x4(%eax),%ebx
+  804420:	83 c4 10             	add    $0x10,%esp
+  804423:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  804427:	75 45                	jne    80446e <fsring_rw+0x2a2>
+  804429:	85 db                	test   %ebx,%ebx
+  80442b:	79 41                	jns    80446e <fsring_rw+0x2a2>
+  80442d:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  804430:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  804437:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  80443e:	83 ec 0c             	sub    $0xc,%esp
+  804441:	68 00 00 f0 cf       	push   $0xcff00000
+  804446:	e8 0e 0c 00 00       	call   805059 <ipcring_rsp_pop>
+  80444b:	83 c4 10             	add    $0x10,%esp
+  80444e:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  804454:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  804459:	39 c2                	cmp    %eax,%edx
+  80445b:	74 75                	je     8044d2 <fsring_rw+0x306>
+  80445d:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  804461:	75 a5                	jne    804408 <fsring_rw+0x23c>
+  804463:	3b 75 08             	cmp    0x8(%ebp),%esi
+  804466:	0f 82 50 ff ff ff    	jb     8043bc <fsring_rw+0x1f0>
+  80446c:	eb 9a                	jmp    804408 <fsring_rw+0x23c>
+  80446e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  804472:	75 ca                	jne    80443e <fsring_rw+0x272>
+  804474:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  804478:	74 31                	je     8044ab <fsring_rw+0x2df>
+  80447a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80447d:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  804480:	29 c8                	sub    %ecx,%eax
+  804482:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  804485:	39 d0                	cmp    %edx,%eax
+  804487:	0f 47 c2             	cmova  %edx,%eax
+  80448a:	39 d8                	cmp    %ebx,%eax
+  80448c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804491:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  804495:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  804498:	b8 01 00 00 00       	mov    $0x1,%eax
+  80449d:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8044a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8044a4:	01 d9                	add    %ebx,%ecx
+  8044a6:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8044a9:	eb 93                	jmp    80443e <fsring_rw+0x272>
+  8044ab:	83 ec 04             	sub    $0x4,%esp
+  8044ae:	53                   	push   %ebx
+  8044af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8044b2:	83 e0 07             	and    $0x7,%eax
+  8044b5:	c1 e0 0c             	shl    $0xc,%eax
+  8044b8:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8044be:	50                   	push   %eax
+  8044bf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8044c2:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8044c5:	01 c8                	add    %ecx,%eax
+  8044c7:	50                   	push   %eax
+  8044c8:	e8 54 e8 ff ff       	call   802d21 <memmove>
+  8044cd:	83 c4 10             	add    $0x10,%esp
+  8044d0:	eb a8                	jmp    80447a <fsring_rw+0x2ae>
+  8044d2:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8044d6:	75 09                	jne    8044e1 <fsring_rw+0x315>
+  8044d8:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8044db:	0f 82 db fe ff ff    	jb     8043bc <fsring_rw+0x1f0>
+  8044e1:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8044e4:	01 57 04             	add    %edx,0x4(%edi)
+  8044e7:	85 d2                	test   %edx,%edx
+  8044e9:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8044ed:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8044f0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8044f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044f6:	5b                   	pop    %ebx
+  8044f7:	5e                   	pop    %esi
+  8044f8:	5f                   	pop    %edi
+  8044f9:	5d                   	pop    %ebp
+  8044fa:	c3                   	ret
+
+008044fb <devfile_write>:
+  8044fb:	55                   	push   %ebp
+  8044fc:	89 e5                	mov    %esp,%ebp
+  8044fe:	57                   	push   %edi
+  8044ff:	56                   	push   %esi
+  804500:	53                   	push   %ebx
+  804501:	83 ec 0c             	sub    $0xc,%esp
+  804504:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804507:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80450a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80450d:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  804513:	76 1a                	jbe    80452f <devfile_write+0x34>
+  804515:	83 ec 0c             	sub    $0xc,%esp
+  804518:	53                   	push   %ebx
+  804519:	89 f1                	mov    %esi,%ecx
+  80451b:	ba 06 00 00 00       	mov    $0x6,%edx
+  804520:	89 f8                	mov    %edi,%eax
+  804522:	e8 a5 fc ff ff       	call   8041cc <fsring_rw>
+  804527:	83 c4 10             	add    $0x10,%esp
+  80452a:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80452d:	75 39                	jne    804568 <devfile_write+0x6d>
+  80452f:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  804534:	39 c3                	cmp    %eax,%ebx
+  804536:	0f 47 d8             	cmova  %eax,%ebx
+  804539:	8b 47 0c             	mov    0xc(%edi),%eax
+  80453c:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  804541:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+  804547:	83 ec 04             	sub    $0x4,%esp
+  80454a:	53                   	push   %ebx
+  80454b:	56                   	push   %esi
+  80454c:	68 08 e0 80 00       	push   $0x80e008
+  804551:	e8 cb e7 ff ff       	call   802d21 <memmove>
+  804556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80455b:	b8 04 00 00 00       	mov    $0x4,%eax
+  804560:	e8 7c fb ff ff       	call   8040e1 <fsipc>
+  804565:	83 c4 10             	add    $0x10,%esp
+  804568:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80456b:	5b                   	pop    %ebx
+  80456c:	5e                   	pop    %esi
+  80456d:	5f                   	pop    %edi
+  80456e:	5d                   	pop    %ebp
+  80456f:	c3                   	ret
+
+00804570 <devfile_read>:
+  804570:	55                   	push   %ebp
+  804571:	89 e5                	mov    %esp,%ebp
+  804573:	57                   	push   %edi
+  804574:	56                   	push   %esi
+  804575:	53                   	push   %ebx
+  804576:	83 ec 0c             	sub    $0xc,%esp
+  804579:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80457c:	8b 75 10             	mov    0x10(%ebp),%esi
+  80457f:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  804585:	76 1d                	jbe    8045a4 <devfile_read+0x34>
+  804587:	83 ec 0c             	sub    $0xc,%esp
+  80458a:	56                   	push   %esi
+  80458b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80458e:	ba 05 00 00 00       	mov    $0x5,%edx
+  804593:	89 f8                	mov    %edi,%eax
+  804595:	e8 32 fc ff ff       	call   8041cc <fsring_rw>
+  80459a:	89 c3                	mov    %eax,%ebx
+  80459c:	83 c4 10             	add    $0x10,%esp
+  80459f:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8045a2:	75 37                	jne    8045db <devfile_read+0x6b>
+  8045a4:	8b 47 0c             	mov    0xc(%edi),%eax
+  8045a7:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  8045ac:	89 35 04 e0 80 00    	mov    %esi,0x80e004
+  8045b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8045bc:	e8 20 fb ff ff       	call   8040e1 <fsipc>
+  8045c1:	89 c3                	mov    %eax,%ebx
+  8045c3:	85 c0                	test   %eax,%eax
+  8045c5:	78 14                	js     8045db <devfile_read+0x6b>
+  8045c7:	83 ec 04             	sub    $0x4,%esp
+  8045ca:	50                   	push   %eax
+  8045cb:	68 00 e0 80 00       	push   $0x80e000
+  8045d0:	ff 75 0c             	push   0xc(%ebp)
+  8045d3:	e8 49 e7 ff ff       	call   802d21 <memmove>
+  8045d8:	83 c4 10             	add    $0x10,%esp
+  8045db:	89 d8                	mov    %ebx,%eax
+  8045dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045e0:	5b                   	pop    %ebx
+  8045e1:	5e                   	pop    %esi
+  8045e2:	5f                   	pop    %edi
+  8045e3:	5d                   	pop    %ebp
+  8045e4:	c3                   	ret
+
+008045e5 <open>:
+  8045e5:	55                   	push   %ebp
+  8045e6:	89 e5                	mov    %esp,%ebp
+  8045e8:	56                   	push   %esi
+  8045e9:	53                   	push   %ebx
+  8045ea:	83 ec 1c             	sub    $0x1c,%esp
+  8045ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8045f0:	56                   	push   %esi
+  8045f1:	e8 2f e5 ff ff       	call   802b25 <strlen>
+  8045f6:	83 c4 10             	add    $0x10,%esp
+  8045f9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8045fe:	7f 6c                	jg     80466c <open+0x87>
+  804600:	83 ec 0c             	sub    $0xc,%esp
+  804603:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804606:	50                   	push   %eax
+  804607:	e8 6a f5 ff ff       	call   803b76 <fd_alloc>
+  80460c:	89 c3                	mov    %eax,%ebx
+  80460e:	83 c4 10             	add    $0x10,%esp
+  804611:	85 c0                	test   %eax,%eax
+  804613:	78 3c                	js     804651 <open+0x6c>
+  804615:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804618:	a3 00 e4 80 00       	mov    %eax,0x80e400
+  80461d:	83 ec 08             	sub    $0x8,%esp
+  804620:	56                   	push   %esi
+  804621:	68 00 e0 80 00       	push   $0x80e000
+  804626:	e8 46 e5 ff ff       	call   802b71 <strcpy>
+  80462b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80462e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804633:	e8 a9 fa ff ff       	call   8040e1 <fsipc>
+  804638:	89 c3                	mov    %eax,%ebx
+  80463a:	83 c4 10             	add    $0x10,%esp
+  80463d:	85 c0                	test   %eax,%eax
+  80463f:	78 19                	js     80465a <open+0x75>
+  804641:	83 ec 0c             	sub    $0xc,%esp
+  804644:	ff 75 f4             	push   -0xc(%ebp)
+  804647:	e8 03 f5 ff ff       	call   803b4f <fd2num>
+  80464c:	89 c3                	mov    %eax,%ebx
+  80464e:	83 c4 10             	add    $0x10,%esp
+  804651:	89 d8                	mov    %ebx,%eax
+  804653:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804656:	5b                   	pop    %ebx
+  804657:	5e                   	pop    %esi
+  804658:	5d                   	pop    %ebp
+  804659:	c3                   	ret
+  80465a:	83 ec 08             	sub    $0x8,%esp
+  80465d:	6a 00                	push   $0x0
+  80465f:	ff 75 f4             	push   -0xc(%ebp)
+  804662:	e8 05 f6 ff ff       	call   803c6c <fd_close>
+  804667:	83 c4 10             	add    $0x10,%esp
+  80466a:	eb e5                	jmp    804651 <open+0x6c>
+  80466c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  804671:	eb de                	jmp    804651 <open+0x6c>
+
+00804673 <file_image>:
+  804673:	55                   	push   %ebp
+  804674:	89 e5                	mov    %esp,%ebp
+  804676:	53                   	push   %ebx
+  804677:	83 ec 1c             	sub    $0x1c,%esp
+  80467a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80467d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804680:	50                   	push   %eax
+  804681:	ff 75 08             	push   0x8(%ebp)
+  804684:	e8 3d f5 ff ff       	call   803bc6 <fd_lookup>
+  804689:	83 c4 10             	add    $0x10,%esp
+  80468c:	85 c0                	test   %eax,%eax
+  80468e:	78 58                	js     8046e8 <file_image+0x75>
+  804690:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804693:	8b 0d 84 b0 80 00    	mov    0x80b084,%ecx
+  804699:	39 08                	cmp    %ecx,(%eax)
+  80469b:	75 50                	jne    8046ed <file_image+0x7a>
+  80469d:	83 fb 04             	cmp    $0x4,%ebx
+  8046a0:	77 52                	ja     8046f4 <file_image+0x81>
+  8046a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8046a5:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  8046aa:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+  8046b0:	83 ec 04             	sub    $0x4,%esp
+  8046b3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8046b6:	c1 e0 02             	shl    $0x2,%eax
+  8046b9:	50                   	push   %eax
+  8046ba:	ff 75 0c             	push   0xc(%ebp)
+  8046bd:	68 08 e0 80 00       	push   $0x80e008
+  8046c2:	e8 5a e6 ff ff       	call   802d21 <memmove>
+  8046c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8046d1:	e8 0b fa ff ff       	call   8040e1 <fsipc>
+  8046d6:	83 c4 10             	add    $0x10,%esp
+  8046d9:	85 c0                	test   %eax,%eax
+  8046db:	78 0b                	js     8046e8 <file_image+0x75>
+  8046dd:	8b 55 14             	mov    0x14(%ebp),%edx
+  8046e0:	8b 0d 08 c0 80 00    	mov    0x80c008,%ecx
+  8046e6:	89 0a                	mov    %ecx,(%edx)
+  8046e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8046eb:	c9                   	leave
+  8046ec:	c3                   	ret
+  8046ed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8046f2:	eb f4                	jmp    8046e8 <file_image+0x75>
+  8046f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8046f9:	eb ed                	jmp    8046e8 <file_image+0x75>
+
+008046fb <remove>:
+  8046fb:	55                   	push   %ebp
+  8046fc:	89 e5                	mov    %esp,%ebp
+  8046fe:	53                   	push   %ebx
+  8046ff:	83 ec 10             	sub    $0x10,%esp
+  804702:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804705:	53                   	push   %ebx
+  804706:	e8 1a e4 ff ff       	call   802b25 <strlen>
+  80470b:	83 c4 10             	add    $0x10,%esp
+  80470e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804713:	7f 25                	jg     80473a <remove+0x3f>
+  804715:	83 ec 08             	sub    $0x8,%esp
+  804718:	53                   	push   %ebx
+  804719:	68 00 e0 80 00       	push   $0x80e000
+  80471e:	e8 4e e4 ff ff       	call   802b71 <strcpy>
+  804723:	ba 00 00 00 00       	mov    $0x0,%edx
+  804728:	b8 09 00 00 00       	mov    $0x9,%eax
+  80472d:	e8 af f9 ff ff       	call   8040e1 <fsipc>
+  804732:	83 c4 10             	add    $0x10,%esp
+  804735:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804738:	c9                   	leave
+  804739:	c3                   	ret
+  80473a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80473f:	eb f4                	jmp    804735 <remove+0x3a>
+
+00804741 <sync>:
+  804741:	55                   	push   %ebp
+  804742:	89 e5                	mov    %esp,%ebp
+  804744:	83 ec 08             	sub    $0x8,%esp
+  804747:	ba 00 00 00 00       	mov    $0x0,%edx
+  80474c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  804751:	e8 8b f9 ff ff       	call   8040e1 <fsipc>
+  804756:	c9                   	leave
+  804757:	c3                   	ret
+
+00804758 <pageref>:
+  804758:	55                   	push   %ebp
+  804759:	89 e5                	mov    %esp,%ebp
+  80475b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80475e:	89 c2                	mov    %eax,%edx
+  804760:	c1 ea 16             	shr    $0x16,%edx
+  804763:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80476a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80476f:	f6 c1 01             	test   $0x1,%cl
+  804772:	74 22                	je     804796 <pageref+0x3e>
+  804774:	c1 e8 0c             	shr    $0xc,%eax
+  804777:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80477e:	a8 01                	test   $0x1,%al
+  804780:	74 14                	je     804796 <pageref+0x3e>
+  804782:	c1 e8 0c             	shr    $0xc,%eax
+  804785:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  804788:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80478f:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  804793:	0f b7 d2             	movzwl %dx,%edx
+  804796:	89 d0                	mov    %edx,%eax
+  804798:	5d                   	pop    %ebp
+  804799:	c3                   	ret
+
+0080479a <devsock_stat>:
+  80479a:	55                   	push   %ebp
+  80479b:	89 e5                	mov    %esp,%ebp
+  80479d:	83 ec 10             	sub    $0x10,%esp
+  8047a0:	68 2c 60 80 00       	push   $0x80602c
+  8047a5:	ff 75 0c             	push   0xc(%ebp)
+  8047a8:	e8 c4 e3 ff ff       	call   802b71 <strcpy>
+  8047ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b2:	c9                   	leave
+  8047b3:	c3                   	ret
+
+008047b4 <devsock_close>:
+  8047b4:	55                   	push   %ebp
+  8047b5:	89 e5                	mov    %esp,%ebp
+  8047b7:	53                   	push   %ebx
+  8047b8:	83 ec 10             	sub    $0x10,%esp
+  8047bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8047be:	53                   	push   %ebx
+  8047bf:	e8 94 ff ff ff       	call   804758 <pageref>
+  8047c4:	89 c2                	mov    %eax,%edx
+  8047c6:	83 c4 10             	add    $0x10,%esp
+  8047c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ce:	83 fa 01             	cmp    $0x1,%edx
+  8047d1:	74 05                	je     8047d8 <devsock_close+0x24>
+  8047d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8047d6:	c9                   	leave
+  8047d7:	c3                   	ret
+  8047d8:	83 ec 0c             	sub    $0xc,%esp
+  8047db:	ff 73 0c             	push   0xc(%ebx)
+  8047de:	e8 aa 02 00 00       	call   804a8d <nsipc_close>
+  8047e3:	83 c4 10             	add    $0x10,%esp
+  8047e6:	eb eb                	jmp    8047d3 <devsock_close+0x1f>
+
+008047e8 <devsock_write>:
+  8047e8:	55                   	push   %ebp
+  8047e9:	89 e5                	mov    %esp,%ebp
+  8047eb:	83 ec 08             	sub    $0x8,%esp
+  8047ee:	6a 00                	push   $0x0
+  8047f0:	ff 75 10             	push   0x10(%ebp)
+  8047f3:	ff 75 0c             	push   0xc(%ebp)
+  8047f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047f9:	ff 70 0c             	push   0xc(%eax)
+  8047fc:	e8 6c 03 00 00       	call   804b6d <nsipc_send>
+  804801:	c9                   	leave
+  804802:	c3                   	ret
+
+00804803 <devsock_read>:
+  804803:	55                   	push   %ebp
+  804804:	89 e5                	mov    %esp,%ebp
+  804806:	83 ec 08             	sub    $0x8,%esp
+  804809:	6a 00                	push   $0x0
+  80480b:	ff 75 10             	push   0x10(%ebp)
+  80480e:	ff 75 0c             	push   0xc(%ebp)
+  804811:	8b 45 08             	mov    0x8(%ebp),%eax
+  804814:	ff 70 0c             	push   0xc(%eax)
+  804817:	e8 e2 02 00 00       	call   804afe <nsipc_recv>
+  80481c:	c9                   	leave
+  80481d:	c3                   	ret
+
+0080481e <fd2sockid>:
+  80481e:	55                   	push   %ebp
+  80481f:	89 e5                	mov    %esp,%ebp
+  804821:	83 ec 20             	sub    $0x20,%esp
+  804824:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804827:	52                   	push   %edx
+  804828:	50                   	push   %eax
+  804829:	e8 98 f3 ff ff       	call   803bc6 <fd_lookup>
+  80482e:	83 c4 10             	add    $0x10,%esp
+  804831:	85 c0                	test   %eax,%eax
+  804833:	78 10                	js     804845 <fd2sockid+0x27>
+  804835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804838:	8b 0d a0 b0 80 00    	mov    0x80b0a0,%ecx
+  80483e:	39 08                	cmp    %ecx,(%eax)
+  804840:	75 05                	jne    804847 <fd2sockid+0x29>
+  804842:	8b 40 0c             	mov    0xc(%eax),%eax
+  804845:	c9                   	leave
+  804846:	c3                   	ret
+  804847:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80484c:	eb f7                	jmp    804845 <fd2sockid+0x27>
+
+0080484e <alloc_sockfd>:
+  80484e:	55                   	push   %ebp
+  80484f:	89 e5                	mov    %esp,%ebp
+  804851:	56                   	push   %esi
+  804852:	53                   	push   %ebx
+  804853:	83 ec 1c             	sub    $0x1c,%esp
+  804856:	89 c6                	mov    %eax,%esi
+  804858:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80485b:	50                   	push   %eax
+  80485c:	e8 15 f3 ff ff       	call   803b76 <fd_alloc>
+  804861:	89 c3                	mov    %eax,%ebx
+  804863:	83 c4 10             	add    $0x10,%esp
+  804866:	85 c0                	test   %eax,%eax
+  804868:	78 43                	js     8048ad <alloc_sockfd+0x5f>
+  80486a:	83 ec 04             	sub    $0x4,%esp
+  80486d:	68 07 04 00 00       	push   $0x407
+  804872:	ff 75 f4             	push   -0xc(%ebp)
+  804875:	6a 00                	push   $0x0
+  804877:	e8 55 e7 ff ff       	call   802fd1 <sys_page_alloc>
+  80487c:	89 c3                	mov    %eax,%ebx
+  80487e:	83 c4 10             	add    $0x10,%esp
+  804881:	85 c0                	test   %eax,%eax
+  804883:	78 28                	js     8048ad <alloc_sockfd+0x5f>
+  804885:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804888:	8b 15 a0 b0 80 00    	mov    0x80b0a0,%edx
+  80488e:	89 10                	mov    %edx,(%eax)
+  804890:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804893:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80489a:	89 70 0c             	mov    %esi,0xc(%eax)
+  80489d:	83 ec 0c             	sub    $0xc,%esp
+  8048a0:	50                   	push   %eax
+  8048a1:	e8 a9 f2 ff ff       	call   803b4f <fd2num>
+  8048a6:	89 c3                	mov    %eax,%ebx
+  8048a8:	83 c4 10             	add    $0x10,%esp
+  8048ab:	eb 0c                	jmp    8048b9 <alloc_sockfd+0x6b>
+  8048ad:	83 ec 0c             	sub    $0xc,%esp
+  8048b0:	56                   	push   %esi
+  8048b1:	e8 d7 01 00 00       	call   804a8d <nsipc_close>
+  8048b6:	83 c4 10             	add    $0x10,%esp
+  8048b9:	89 d8                	mov    %ebx,%eax
+  8048bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8048be:	5b                   	pop    %ebx
+  8048bf:	5e                   	pop    %esi
+  8048c0:	5d                   	pop    %ebp
+  8048c1:	c3                   	ret
+
+008048c2 <accept>:
+  8048c2:	55                   	push   %ebp
+  8048c3:	89 e5                	mov    %esp,%ebp
+  8048c5:	83 ec 08             	sub    $0x8,%esp
+  8048c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048cb:	e8 4e ff ff ff       	call   80481e <fd2sockid>
+  8048d0:	85 c0                	test   %eax,%eax
+  8048d2:	78 1b                	js     8048ef <accept+0x2d>
+  8048d4:	83 ec 04             	sub    $0x4,%esp
+  8048d7:	ff 75 10             	push   0x10(%ebp)
+  8048da:	ff 75 0c             	push   0xc(%ebp)
+  8048dd:	50                   	push   %eax
+  8048de:	e8 07 01 00 00       	call   8049ea <nsipc_accept>
+  8048e3:	83 c4 10             	add    $0x10,%esp
+  8048e6:	85 c0                	test   %eax,%eax
+  8048e8:	78 05                	js     8048ef <accept+0x2d>
+  8048ea:	e8 5f ff ff ff       	call   80484e <alloc_sockfd>
+  8048ef:	c9                   	leave
+  8048f0:	c3                   	ret
+
+008048f1 <bind>:
+  8048f1:	55                   	push   %ebp
+  8048f2:	89 e5                	mov    %esp,%ebp
+  8048f4:	83 ec 08             	sub    $0x8,%esp
+  8048f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048fa:	e8 1f ff ff ff       	call   80481e <fd2sockid>
+  8048ff:	85 c0                	test   %eax,%eax
+  804901:	78 12                	js     804915 <bind+0x24>
+  804903:	83 ec 04             	sub    $0x4,%esp
+  804906:	ff 75 10             	push   0x10(%ebp)
+  804909:	ff 75 0c             	push   0xc(%ebp)
+  80490c:	50                   	push   %eax
+  80490d:	e8 24 01 00 00       	call   804a36 <nsipc_bind>
+  804912:	83 c4 10             	add    $0x10,%esp
+  804915:	c9                   	leave
+  804916:	c3                   	ret
+
+00804917 <shutdown>:
+  804917:	55                   	push   %ebp
+  804918:	89 e5                	mov    %esp,%ebp
+  80491a:	83 ec 08             	sub    $0x8,%esp
+  80491d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804920:	e8 f9 fe ff ff       	call   80481e <fd2sockid>
+  804925:	85 c0                	test   %eax,%eax
+  804927:	78 0f                	js     804938 <shutdown+0x21>
+  804929:	83 ec 08             	sub    $0x8,%esp
+  80492c:	ff 75 0c             	push   0xc(%ebp)
+  80492f:	50                   	push   %eax
+  804930:	e8 36 01 00 00       	call   804a6b <nsipc_shutdown>
+  804935:	83 c4 10             	add    $0x10,%esp
+  804938:	c9                   	leave
+  804939:	c3                   	ret
+
+0080493a <connect>:
+  80493a:	55                   	push   %ebp
+  80493b:	89 e5                	mov    %esp,%ebp
+  80493d:	83 ec 08             	sub    $0x8,%esp
+  804940:	8b 45 08             	mov    0x8(%ebp),%eax
+  804943:	e8 d6 fe ff ff       	call   80481e <fd2sockid>
+  804948:	85 c0                	test   %eax,%eax
+  80494a:	78 12                	js     80495e <connect+0x24>
+  80494c:	83 ec 04             	sub    $0x4,%esp
+  80494f:	ff 75 10             	push   0x10(%ebp)
+  804952:	ff 75 0c             	push   0xc(%ebp)
+  804955:	50                   	push   %eax
+  804956:	e8 4c 01 00 00       	call   804aa7 <nsipc_connect>
+  80495b:	83 c4 10             	add    $0x10,%esp
+  80495e:	c9                   	leave
+  80495f:	c3                   	ret
+
+00804960 <listen>:
+  804960:	55                   	push   %ebp
+  804961:	89 e5                	mov    %esp,%ebp
+  804963:	83 ec 08             	sub    $0x8,%esp
+  804966:	8b 45 08             	mov    0x8(%ebp),%eax
+  804969:	e8 b0 fe ff ff       	call   80481e <fd2sockid>
+  80496e:	85 c0                	test   %eax,%eax
+  804970:	78 0f                	js     804981 <listen+0x21>
+  804972:	83 ec 08             	sub    $0x8,%esp
+  804975:	ff 75 0c             	push   0xc(%ebp)
+  804978:	50                   	push   %eax
+  804979:	e8 5e 01 00 00       	call   804adc <nsipc_listen>
+  80497e:	83 c4 10             	add    $0x10,%esp
+  804981:	c9                   	leave
+  804982:	c3                   	ret
+
+00804983 <socket>:
+  804983:	55                   	push   %ebp
+  804984:	89 e5                	mov    %esp,%ebp
+  804986:	83 ec 0c             	sub    $0xc,%esp
+  804989:	ff 75 10             	push   0x10(%ebp)
+  80498c:	ff 75 0c             	push   0xc(%ebp)
+  80498f:	ff 75 08             	push   0x8(%ebp)
+  804992:	e8 34 02 00 00       	call   804bcb <nsipc_socket>
+  804997:	83 c4 10             	add    $0x10,%esp
+  80499a:	85 c0                	test   %eax,%eax
+  80499c:	78 05                	js     8049a3 <socket+0x20>
+  80499e:	e8 ab fe ff ff       	call   80484e <alloc_sockfd>
+  8049a3:	c9                   	leave
+  8049a4:	c3                   	ret
+
+008049a5 <nsipc>:
+  8049a5:	55                   	push   %ebp
+  8049a6:	89 e5                	mov    %esp,%ebp
+  8049a8:	53                   	push   %ebx
+  8049a9:	83 ec 04             	sub    $0x4,%esp
+  8049ac:	89 c3                	mov    %eax,%ebx
+  8049ae:	83 3d 0c c0 80 00 00 	cmpl   $0x0,0x80c00c
+  8049b5:	74 1f                	je     8049d6 <nsipc+0x31>
+  8049b7:	83 ec 08             	sub    $0x8,%esp
+  8049ba:	6a 00                	push   $0x0
+  8049bc:	6a 00                	push   $0x0
+  8049be:	6a 07                	push   $0x7
+  8049c0:	68 00 f0 80 00       	push   $0x80f000
+  8049c5:	53                   	push   %ebx
+  8049c6:	ff 35 0c c0 80 00    	push   0x80c00c
+  8049cc:	e8 c9 ef ff ff       	call   80399a <ipc_call>
+  8049d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8049d4:	c9                   	leave
+  8049d5:	c3                   	ret
+  8049d6:	83 ec 0c             	sub    $0xc,%esp
+  8049d9:	6a 03                	push   $0x3
+  8049db:	e8 55 f1 ff ff       	call   803b35 <ipc_find_env>
+  8049e0:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+  8049e5:	83 c4 10             	add    $0x10,%esp
+  8049e8:	eb cd                	jmp    8049b7 <nsipc+0x12>
+
+008049ea <nsipc_accept>:
+  8049ea:	55                   	push   %ebp
+  8049eb:	89 e5                	mov    %esp,%ebp
+  8049ed:	53                   	push   %ebx
+  8049ee:	83 ec 04             	sub    $0x4,%esp
+  8049f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8049f4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  8049f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049fe:	e8 a2 ff ff ff       	call   8049a5 <nsipc>
+  804a03:	89 c3                	mov    %eax,%ebx
+  804a05:	85 c0                	test   %eax,%eax
+  804a07:	79 07                	jns    804a10 <nsipc_accept+0x26>
+  804a09:	89 d8                	mov    %ebx,%eax
+  804a0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804a0e:	c9                   	leave
+  804a0f:	c3                   	ret
+  804a10:	83 ec 04             	sub    $0x4,%esp
+  804a13:	ff 35 10 f0 80 00    	push   0x80f010
+  804a19:	68 00 f0 80 00       	push   $0x80f000
+  804a1e:	ff 75 0c             	push   0xc(%ebp)
+  804a21:	e8 fb e2 ff ff       	call   802d21 <memmove>
+  804a26:	8b 15 10 f0 80 00    	mov    0x80f010,%edx
+  804a2c:	8b 45 10             	mov    0x10(%ebp),%eax
+  804a2f:	89 10                	mov    %edx,(%eax)
+  804a31:	83 c4 10             	add    $0x10,%esp
+  804a34:	eb d3                	jmp    804a09 <nsipc_accept+0x1f>
+
+00804a36 <nsipc_bind>:
+  804a36:	55                   	push   %ebp
+  804a37:	89 e5                	mov    %esp,%ebp
+  804a39:	53                   	push   %ebx
+  804a3a:	83 ec 08             	sub    $0x8,%esp
+  804a3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804a40:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a43:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804a48:	53                   	push   %ebx
+  804a49:	ff 75 0c             	push   0xc(%ebp)
+  804a4c:	68 04 f0 80 00       	push   $0x80f004
+  804a51:	e8 cb e2 ff ff       	call   802d21 <memmove>
+  804a56:	89 1d 14 f0 80 00    	mov    %ebx,0x80f014
+  804a5c:	b8 02 00 00 00       	mov    $0x2,%eax
+  804a61:	e8 3f ff ff ff       	call   8049a5 <nsipc>
+  804a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804a69:	c9                   	leave
+  804a6a:	c3                   	ret
+
+00804a6b <nsipc_shutdown>:
+  804a6b:	55                   	push   %ebp
+  804a6c:	89 e5                	mov    %esp,%ebp
+  804a6e:	83 ec 08             	sub    $0x8,%esp
+  804a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a74:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804a7c:	a3 04 f0 80 00       	mov    %eax,0x80f004
+  804a81:	b8 03 00 00 00       	mov    $0x3,%eax
+  804a86:	e8 1a ff ff ff       	call   8049a5 <nsipc>
+  804a8b:	c9                   	leave
+  804a8c:	c3                   	ret
+
+00804a8d <nsipc_close>:
+  804a8d:	55                   	push   %ebp
+  804a8e:	89 e5                	mov    %esp,%ebp
+  804a90:	83 ec 08             	sub    $0x8,%esp
+  804a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a96:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804a9b:	b8 04 00 00 00       	mov    $0x4,%eax
+  804aa0:	e8 00 ff ff ff       	call   8049a5 <nsipc>
+  804aa5:	c9                   	leave
+  804aa6:	c3                   	ret
+
+00804aa7 <nsipc_connect>:
+  804aa7:	55                   	push   %ebp
+  804aa8:	89 e5                	mov    %esp,%ebp
+  804aaa:	53                   	push   %ebx
+  804aab:	83 ec 08             	sub    $0x8,%esp
+  804aae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ab4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804ab9:	53                   	push   %ebx
+  804aba:	ff 75 0c             	push   0xc(%ebp)
+  804abd:	68 04 f0 80 00       	push   $0x80f004
+  804ac2:	e8 5a e2 ff ff       	call   802d21 <memmove>
+  804ac7:	89 1d 14 f0 80 00    	mov    %ebx,0x80f014
+  804acd:	b8 05 00 00 00       	mov    $0x5,%eax
+  804ad2:	e8 ce fe ff ff       	call   8049a5 <nsipc>
+  804ad7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804ada:	c9                   	leave
+  804adb:	c3                   	ret
+
+00804adc <nsipc_listen>:
+  804adc:	55                   	push   %ebp
+  804add:	89 e5                	mov    %esp,%ebp
+  804adf:	83 ec 08             	sub    $0x8,%esp
+  804ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ae5:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804aea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804aed:	a3 04 f0 80 00       	mov    %eax,0x80f004
+  804af2:	b8 06 00 00 00       	mov    $0x6,%eax
+  804af7:	e8 a9 fe ff ff       	call   8049a5 <nsipc>
+  804afc:	c9                   	leave
+  804afd:	c3                   	ret
+
+00804afe <nsipc_recv>:
+  804afe:	55                   	push   %ebp
+  804aff:	89 e5                	mov    %esp,%ebp
+  804b01:	56                   	push   %esi
+  804b02:	53                   	push   %ebx
+  804b03:	8b 75 10             	mov    0x10(%ebp),%esi
+  804b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b09:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804b0e:	89 35 04 f0 80 00    	mov    %esi,0x80f004
+  804b14:	8b 45 14             	mov    0x14(%ebp),%eax
+  804b17:	a3 08 f0 80 00       	mov    %eax,0x80f008
+  804b1c:	b8 07 00 00 00       	mov    $0x7,%eax
+  804b21:	e8 7f fe ff ff       	call   8049a5 <nsipc>
+  804b26:	89 c3                	mov    %eax,%ebx
+  804b28:	85 c0                	test   %eax,%eax
+  804b2a:	78 22                	js     804b4e <nsipc_recv+0x50>
+  804b2c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  804b31:	39 c6                	cmp    %eax,%esi
+  804b33:	0f 4e c6             	cmovle %esi,%eax
+  804b36:	39 c3                	cmp    %eax,%ebx
+  804b38:	7f 1d                	jg     804b57 <nsipc_recv+0x59>
+  804b3a:	83 ec 04             	sub    $0x4,%esp
+  804b3d:	53                   	push   %ebx
+  804b3e:	68 00 f0 80 00       	push   $0x80f000
+  804b43:	ff 75 0c             	push   0xc(%ebp)
+  804b46:	e8 d6 e1 ff ff       	call   802d21 <memmove>
+  804b4b:	83 c4 10             	add    $0x10,%esp
+  804b4e:	89 d8                	mov    %ebx,%eax
+  804b50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804b53:	5b                   	pop    %ebx
+  804b54:	5e                   	pop    %esi
+  804b55:	5d                   	pop    %ebp
+  804b56:	c3                   	ret
+  804b57:	68 38 60 80 00       	push   $0x806038
+  804b5c:	68 3d 55 80 00       	push   $0x80553d
+  804b61:	6a 60                	push   $0x60
+  804b63:	68 4d 60 80 00       	push   $0x80604d
+  804b68:	e8 32 d8 ff ff       	call   80239f <_panic>
+
+00804b6d <nsipc_send>:
+  804b6d:	55                   	push   %ebp
+  804b6e:	89 e5                	mov    %esp,%ebp
+  804b70:	53                   	push   %ebx
+  804b71:	83 ec 04             	sub    $0x4,%esp
+  804b74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804b77:	8b 45 08             	mov    0x8(%ebp),%eax
+  804b7a:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804b7f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  804b85:	7f 2e                	jg     804bb5 <nsipc_send+0x48>
+  804b87:	83 ec 04             	sub    $0x4,%esp
+  804b8a:	53                   	push   %ebx
+  804b8b:	ff 75 0c             	push   0xc(%ebp)
+  804b8e:	68 0c f0 80 00       	push   $0x80f00c
+  804b93:	e8 89 e1 ff ff       	call   802d21 <memmove>
+  804b98:	89 1d 04 f0 80 00    	mov    %ebx,0x80f004
+  804b9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  804ba1:	a3 08 f0 80 00       	mov    %eax,0x80f008
+  804ba6:	b8 08 00 00 00       	mov    $0x8,%eax
+  804bab:	e8 f5 fd ff ff       	call   8049a5 <nsipc>
+  804bb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804bb3:	c9                   	leave
+  804bb4:	c3                   	ret
+  804bb5:	68 59 60 80 00       	push   $0x806059
+  804bba:	68 3d 55 80 00       	push   $0x80553d
+  804bbf:	6a 6b                	push   $0x6b
+  804bc1:	68 4d 60 80 00       	push   $0x80604d
+  804bc6:	e8 d4 d7 ff ff       	call   80239f <_panic>
+
+00804bcb <nsipc_socket>:
+  804bcb:	55                   	push   %ebp
+  804bcc:	89 e5                	mov    %esp,%ebp
+  804bce:	83 ec 08             	sub    $0x8,%esp
+  804bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  804bd4:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  804bd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804bdc:	a3 04 f0 80 00       	mov    %eax,0x80f004
+  804be1:	8b 45 10             	mov    0x10(%ebp),%eax
+  804be4:	a3 08 f0 80 00       	mov    %eax,0x80f008
+  804be9:	b8 09 00 00 00       	mov    $0x9,%eax
+  804bee:	e8 b2 fd ff ff       	call   8049a5 <nsipc>
+  804bf3:	c9                   	leave
+  804bf4:	c3                   	ret
+
+00804bf5 <devpipe_stat>:
+  804bf5:	55                   	push   %ebp
+  804bf6:	89 e5                	mov    %esp,%ebp
+  804bf8:	56                   	push   %esi
+  804bf9:	53                   	push   %ebx
+  804bfa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804bfd:	83 ec 0c             	sub    $0xc,%esp
+  804c00:	ff 75 08             	push   0x8(%ebp)
+  804c03:	e8 57 ef ff ff       	call   803b5f <fd2data>
+  804c08:	89 c6                	mov    %eax,%esi
+  804c0a:	83 c4 08             	add    $0x8,%esp
+  804c0d:	68 65 60 80 00       	push   $0x806065
+  804c12:	53                   	push   %ebx
+  804c13:	e8 59 df ff ff       	call   802b71 <strcpy>
+  804c18:	8b 46 04             	mov    0x4(%esi),%eax
+  804c1b:	2b 06                	sub    (%esi),%eax
+  804c1d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  804c23:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804c2a:	00 00 00 
+  804c2d:	c7 83 88 00 00 00 bc 	movl   $0x80b0bc,0x88(%ebx)
+  804c34:	b0 80 00 
+  804c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804c3f:	5b                   	pop    %ebx
+  804c40:	5e                   	pop    %esi
+  804c41:	5d                   	pop    %ebp
+  804c42:	c3                   	ret
+
+00804c43 <devpipe_close>:
+  804c43:	55                   	push   %ebp
+  804c44:	89 e5                	mov    %esp,%ebp
+  804c46:	53                   	push   %ebx
+  804c47:	83 ec 0c             	sub    $0xc,%esp
+  804c4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804c4d:	53                   	push   %ebx
+  804c4e:	6a 00                	push   $0x0
+  804c50:	e8 4e e4 ff ff       	call   8030a3 <sys_page_unmap>
+  804c55:	89 1c 24             	mov    %ebx,(%esp)
+  804c58:	e8 02 ef ff ff       	call   803b5f <fd2data>
+  804c5d:	83 c4 08             	add    $0x8,%esp
+  804c60:	50                   	push   %eax
+  804c61:	6a 00                	push   $0x0
+  804c63:	e8 3b e4 ff ff       	call   8030a3 <sys_page_unmap>
+  804c68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804c6b:	c9                   	leave
+  804c6c:	c3                   	ret
+
+00804c6d <_pipeisclosed>:
+  804c6d:	55                   	push   %ebp
+  804c6e:	89 e5                	mov    %esp,%ebp
+  804c70:	57                   	push   %edi
+  804c71:	56                   	push   %esi
+  804c72:	53                   	push   %ebx
+  804c73:	83 ec 1c             	sub    $0x1c,%esp
+  804c76:	89 c7                	mov    %eax,%edi
+  804c78:	89 d6                	mov    %edx,%esi
+  804c7a:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  804c7f:	8b 58 58             	mov    0x58(%eax),%ebx
+  804c82:	83 ec 0c             	sub    $0xc,%esp
+  804c85:	57                   	push   %edi
+  804c86:	e8 cd fa ff ff       	call   804758 <pageref>
+  804c8b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804c8e:	89 34 24             	mov    %esi,(%esp)
+  804c91:	e8 c2 fa ff ff       	call   804758 <pageref>
+  804c96:	8b 15 20 d9 80 00    	mov    0x80d920,%edx
+  804c9c:	8b 4a 58             	mov    0x58(%edx),%ecx
+  804c9f:	83 c4 10             	add    $0x10,%esp
+  804ca2:	39 cb                	cmp    %ecx,%ebx
+  804ca4:	74 1b                	je     804cc1 <_pipeisclosed+0x54>
+  804ca6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804ca9:	75 cf                	jne    804c7a <_pipeisclosed+0xd>
+  804cab:	8b 42 58             	mov    0x58(%edx),%eax
+  804cae:	6a 01                	push   $0x1
+  804cb0:	50                   	push   %eax
+  804cb1:	53                   	push   %ebx
+  804cb2:	68 6c 60 80 00       	push   $0x80606c
+  804cb7:	e8 be d7 ff ff       	call   80247a <cprintf>
+  804cbc:	83 c4 10             	add    $0x10,%esp
+  804cbf:	eb b9                	jmp    804c7a <_pipeisclosed+0xd>
+  804cc1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  804cc4:	0f 94 c0             	sete   %al
+  804cc7:	0f b6 c0             	movzbl %al,%eax
+  804cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ccd:	5b                   	pop    %ebx
+  804cce:	5e                   	pop    %esi
+  804ccf:	5f                   	pop    %edi
+  804cd0:	5d                   	pop    %ebp
+  804cd1:	c3                   	ret
+
+00804cd2 <devpipe_write>:
+  804cd2:	55                   	push   %ebp
+  804cd3:	89 e5                	mov    %esp,%ebp
+  804cd5:	57                   	push   %edi
+  804cd6:	56                   	push   %esi
+  804cd7:	53                   	push   %ebx
+  804cd8:	83 ec 28             	sub    $0x28,%esp
+  804cdb:	8b 75 08             	mov    0x8(%ebp),%esi
+  804cde:	56                   	push   %esi
+  804cdf:	e8 7b ee ff ff       	call   803b5f <fd2data>
+  804ce4:	89 c3                	mov    %eax,%ebx
+  804ce6:	83 c4 10             	add    $0x10,%esp
+  804ce9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cee:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804cf2:	74 5c                	je     804d50 <devpipe_write+0x7e>
+  804cf4:	8b 43 04             	mov    0x4(%ebx),%eax
+  804cf7:	8b 0b                	mov    (%ebx),%ecx
+  804cf9:	8d 51 20             	lea    0x20(%ecx),%edx
+  804cfc:	39 d0                	cmp    %edx,%eax
+  804cfe:	72 1e                	jb     804d1e <devpipe_write+0x4c>
+  804d00:	89 da                	mov    %ebx,%edx
+  804d02:	89 f0                	mov    %esi,%eax
+  804d04:	e8 64 ff ff ff       	call   804c6d <_pipeisclosed>
+  804d09:	85 c0                	test   %eax,%eax
+  804d0b:	75 48                	jne    804d55 <devpipe_write+0x83>
+  804d0d:	e8 74 e2 ff ff       	call   802f86 <sys_yield>
+  804d12:	8b 43 04             	mov    0x4(%ebx),%eax
+  804d15:	8b 0b                	mov    (%ebx),%ecx
+  804d17:	8d 51 20             	lea    0x20(%ecx),%edx
+  804d1a:	39 d0                	cmp    %edx,%eax
+  804d1c:	73 e2                	jae    804d00 <devpipe_write+0x2e>
+  804d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804d21:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  804d25:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  804d28:	89 c2                	mov    %eax,%edx
+  804d2a:	c1 fa 1f             	sar    $0x1f,%edx
+  804d2d:	89 d1                	mov    %edx,%ecx
+  804d2f:	c1 e9 1b             	shr    $0x1b,%ecx
+  804d32:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  804d35:	83 e2 1f             	and    $0x1f,%edx
+  804d38:	29 ca                	sub    %ecx,%edx
+  804d3a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  804d3e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  804d42:	83 c0 01             	add    $0x1,%eax
+  804d45:	89 43 04             	mov    %eax,0x4(%ebx)
+  804d48:	83 c7 01             	add    $0x1,%edi
+  804d4b:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  804d4e:	75 a4                	jne    804cf4 <devpipe_write+0x22>
+  804d50:	8b 45 10             	mov    0x10(%ebp),%eax
+  804d53:	eb 05                	jmp    804d5a <devpipe_write+0x88>
+  804d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d5d:	5b                   	pop    %ebx
+  804d5e:	5e                   	pop    %esi
+  804d5f:	5f                   	pop    %edi
+  804d60:	5d                   	pop    %ebp
+  804d61:	c3                   	ret
+
+00804d62 <devpipe_read>:
+  804d62:	55                   	push   %ebp
+  804d63:	89 e5                	mov    %esp,%ebp
+  804d65:	57                   	push   %edi
+  804d66:	56                   	push   %esi
+  804d67:	53                   	push   %ebx
+  804d68:	83 ec 18             	sub    $0x18,%esp
+  804d6b:	8b 75 08             	mov    0x8(%ebp),%esi
+  804d6e:	56                   	push   %esi
+  804d6f:	e8 eb ed ff ff       	call   803b5f <fd2data>
+  804d74:	89 c3                	mov    %eax,%ebx
+  804d76:	83 c4 10             	add    $0x10,%esp
+  804d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d7e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804d82:	74 45                	je     804dc9 <devpipe_read+0x67>
+  804d84:	8b 03                	mov    (%ebx),%eax
+  804d86:	3b 43 04             	cmp    0x4(%ebx),%eax
+  804d89:	75 1d                	jne    804da8 <devpipe_read+0x46>
+  804d8b:	85 ff                	test   %edi,%edi
+  804d8d:	75 3f                	jne    804dce <devpipe_read+0x6c>
+  804d8f:	89 da                	mov    %ebx,%edx
+  804d91:	89 f0                	mov    %esi,%eax
+  804d93:	e8 d5 fe ff ff       	call   804c6d <_pipeisclosed>
+  804d98:	85 c0                	test   %eax,%eax
+  804d9a:	75 3c                	jne    804dd8 <devpipe_read+0x76>
+  804d9c:	e8 e5 e1 ff ff       	call   802f86 <sys_yield>
+  804da1:	8b 03                	mov    (%ebx),%eax
+  804da3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  804da6:	74 e7                	je     804d8f <devpipe_read+0x2d>
+  804da8:	99                   	cltd
+  804da9:	c1 ea 1b             	shr    $0x1b,%edx
+  804dac:	01 d0                	add    %edx,%eax
+  804dae:	83 e0 1f             	and    $0x1f,%eax
+  804db1:	29 d0                	sub    %edx,%eax
+  804db3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  804db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804dbb:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  804dbe:	83 03 01             	addl   $0x1,(%ebx)
+  804dc1:	83 c7 01             	add    $0x1,%edi
+  804dc4:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  804dc7:	75 bb                	jne    804d84 <devpipe_read+0x22>
+  804dc9:	8b 45 10             	mov    0x10(%ebp),%eax
+  804dcc:	eb 02                	jmp    804dd0 <devpipe_read+0x6e>
+  804dce:	89 f8                	mov    %edi,%eax
+  804dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804dd3:	5b                   	pop    %ebx
+  804dd4:	5e                   	pop    %esi
+  804dd5:	5f                   	pop    %edi
+  804dd6:	5d                   	pop    %ebp
+  804dd7:	c3                   	ret
+  804dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ddd:	eb f1                	jmp    804dd0 <devpipe_read+0x6e>
+
+00804ddf <pipe>:
+  804ddf:	55                   	push   %ebp
+  804de0:	89 e5                	mov    %esp,%ebp
+  804de2:	56                   	push   %esi
+  804de3:	53                   	push   %ebx
+  804de4:	83 ec 1c             	sub    $0x1c,%esp
+  804de7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804dea:	50                   	push   %eax
+  804deb:	e8 86 ed ff ff       	call   803b76 <fd_alloc>
+  804df0:	89 c3                	mov    %eax,%ebx
+  804df2:	83 c4 10             	add    $0x10,%esp
+  804df5:	85 c0                	test   %eax,%eax
+  804df7:	0f 88 23 01 00 00    	js     804f20 <pipe+0x141>
+  804dfd:	83 ec 04             	sub    $0x4,%esp
+  804e00:	68 07 04 00 00       	push   $0x407
+  804e05:	ff 75 f4             	push   -0xc(%ebp)
+  804e08:	6a 00                	push   $0x0
+  804e0a:	e8 c2 e1 ff ff       	call   802fd1 <sys_page_alloc>
+  804e0f:	89 c3                	mov    %eax,%ebx
+  804e11:	83 c4 10             	add    $0x10,%esp
+  804e14:	85 c0                	test   %eax,%eax
+  804e16:	0f 88 04 01 00 00    	js     804f20 <pipe+0x141>
+  804e1c:	83 ec 0c             	sub    $0xc,%esp
+  804e1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804e22:	50                   	push   %eax
+  804e23:	e8 4e ed ff ff       	call   803b76 <fd_alloc>
+  804e28:	89 c3                	mov    %eax,%ebx
+  804e2a:	83 c4 10             	add    $0x10,%esp
+  804e2d:	85 c0                	test   %eax,%eax
+  804e2f:	0f 88 db 00 00 00    	js     804f10 <pipe+0x131>
+  804e35:	83 ec 04             	sub    $0x4,%esp
+  804e38:	68 07 04 00 00       	push   $0x407
+  804e3d:	ff 75 f0             	push   -0x10(%ebp)
+  804e40:	6a 00                	push   $0x0
+  804e42:	e8 8a e1 ff ff       	call   802fd1 <sys_page_alloc>
+  804e47:	89 c3                	mov    %eax,%ebx
+  804e49:	83 c4 10             	add    $0x10,%esp
+  804e4c:	85 c0                	test   %eax,%eax
+  804e4e:	0f 88 bc 00 00 00    	js     804f10 <pipe+0x131>
+  804e54:	83 ec 0c             	sub    $0xc,%esp
+  804e57:	ff 75 f4             	push   -0xc(%ebp)
+  804e5a:	e8 00 ed ff ff       	call   803b5f <fd2data>
+  804e5f:	89 c6                	mov    %eax,%esi
+  804e61:	83 c4 0c             	add    $0xc,%esp
+  804e64:	68 07 04 00 00       	push   $0x407
+  804e69:	50                   	push   %eax
+  804e6a:	6a 00                	push   $0x0
+  804e6c:	e8 60 e1 ff ff       	call   802fd1 <sys_page_alloc>
+  804e71:	89 c3                	mov    %eax,%ebx
+  804e73:	83 c4 10             	add    $0x10,%esp
+  804e76:	85 c0                	test   %eax,%eax
+  804e78:	0f 88 82 00 00 00    	js     804f00 <pipe+0x121>
+  804e7e:	83 ec 0c             	sub    $0xc,%esp
+  804e81:	ff 75 f0             	push   -0x10(%ebp)
+  804e84:	e8 d6 ec ff ff       	call   803b5f <fd2data>
+  804e89:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  804e90:	50                   	push   %eax
+  804e91:	6a 00                	push   $0x0
+  804e93:	56                   	push   %esi
+  804e94:	6a 00                	push   $0x0
+  804e96:	e8 79 e1 ff ff       	call   803014 <sys_page_map>
+  804e9b:	89 c3                	mov    %eax,%ebx
+  804e9d:	83 c4 20             	add    $0x20,%esp
+  804ea0:	85 c0                	test   %eax,%eax
+  804ea2:	78 4e                	js     804ef2 <pipe+0x113>
+  804ea4:	a1 bc b0 80 00       	mov    0x80b0bc,%eax
+  804ea9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804eac:	89 02                	mov    %eax,(%edx)
+  804eae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804eb1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  804eb8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804ebb:	89 02                	mov    %eax,(%edx)
+  804ebd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804ec0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  804ec7:	83 ec 0c             	sub    $0xc,%esp
+  804eca:	ff 75 f4             	push   -0xc(%ebp)
+  804ecd:	e8 7d ec ff ff       	call   803b4f <fd2num>
+  804ed2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804ed5:	89 01                	mov    %eax,(%ecx)
+  804ed7:	83 c4 04             	add    $0x4,%esp
+  804eda:	ff 75 f0             	push   -0x10(%ebp)
+  804edd:	e8 6d ec ff ff       	call   803b4f <fd2num>
+  804ee2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804ee5:	89 41 04             	mov    %eax,0x4(%ecx)
+  804ee8:	83 c4 10             	add    $0x10,%esp
+  804eeb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804ef0:	eb 2e                	jmp    804f20 <pipe+0x141>
+  804ef2:	83 ec 08             	sub    $0x8,%esp
+  804ef5:	56                   	push   %esi
+  804ef6:	6a 00                	push   $0x0
+  804ef8:	e8 a6 e1 ff ff       	call   8030a3 <sys_page_unmap>
+  804efd:	83 c4 10             	add    $0x10,%esp
+  804f00:	83 ec 08             	sub    $0x8,%esp
+  804f03:	ff 75 f0             	push   -0x10(%ebp)
+  804f06:	6a 00                	push   $0x0
+  804f08:	e8 96 e1 ff ff       	call   8030a3 <sys_page_unmap>
+  804f0d:	83 c4 10             	add    $0x10,%esp
+  804f10:	83 ec 08             	sub    $0x8,%esp
+  804f13:	ff 75 f4             	push   -0xc(%ebp)
+  804f16:	6a 00                	push   $0x0
+  804f18:	e8 86 e1 ff ff       	call   8030a3 <sys_page_unmap>
+  804f1d:	83 c4 10             	add    $0x10,%esp
+  804f20:	89 d8                	mov    %ebx,%eax
+  804f22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804f25:	5b                   	pop    %ebx
+  804f26:	5e                   	pop    %esi
+  804f27:	5d                   	pop    %ebp
+  804f28:	c3                   	ret
+
+00804f29 <pipeisclosed>:
+  804f29:	55                   	push   %ebp
+  804f2a:	89 e5                	mov    %esp,%ebp
+  804f2c:	83 ec 20             	sub    $0x20,%esp
+  804f2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804f32:	50                   	push   %eax
+  804f33:	ff 75 08             	push   0x8(%ebp)
+  804f36:	e8 8b ec ff ff       	call   803bc6 <fd_lookup>
+  804f3b:	83 c4 10             	add    $0x10,%esp
+  804f3e:	85 c0                	test   %eax,%eax
+  804f40:	78 18                	js     804f5a <pipeisclosed+0x31>
+  804f42:	83 ec 0c             	sub    $0xc,%esp
+  804f45:	ff 75 f4             	push   -0xc(%ebp)
+  804f48:	e8 12 ec ff ff       	call   803b5f <fd2data>
+  804f4d:	89 c2                	mov    %eax,%edx
+  804f4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f52:	e8 16 fd ff ff       	call   804c6d <_pipeisclosed>
+  804f57:	83 c4 10             	add    $0x10,%esp
+  804f5a:	c9                   	leave
+  804f5b:	c3                   	ret
+
+00804f5c <ipcring_init>:
+  804f5c:	55                   	push   %ebp
+  804f5d:	89 e5                	mov    %esp,%ebp
+  804f5f:	53                   	push   %ebx
+  804f60:	83 ec 08             	sub    $0x8,%esp
+  804f63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804f66:	6a 60                	push   $0x60
+  804f68:	6a 00                	push   $0x0
+  804f6a:	53                   	push   %ebx
+  804f6b:	e8 7c dd ff ff       	call   802cec <memset>
+  804f70:	a1 20 d9 80 00       	mov    0x80d920,%eax
+  804f75:	8b 40 48             	mov    0x48(%eax),%eax
+  804f78:	89 03                	mov    %eax,(%ebx)
+  804f7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804f7d:	89 43 04             	mov    %eax,0x4(%ebx)
+  804f80:	8b 45 10             	mov    0x10(%ebp),%eax
+  804f83:	89 43 08             	mov    %eax,0x8(%ebx)
+  804f86:	8b 45 14             	mov    0x14(%ebp),%eax
+  804f89:	89 43 0c             	mov    %eax,0xc(%ebx)
+  804f8c:	83 c4 10             	add    $0x10,%esp
+  804f8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804f92:	c9                   	leave
+  804f93:	c3                   	ret
+
+00804f94 <ipcring_req_slot>:
+  804f94:	55                   	push   %ebp
+  804f95:	89 e5                	mov    %esp,%ebp
+  804f97:	8b 45 08             	mov    0x8(%ebp),%eax
+  804f9a:	8b 50 10             	mov    0x10(%eax),%edx
+  804f9d:	8b 48 18             	mov    0x18(%eax),%ecx
+  804fa0:	29 ca                	sub    %ecx,%edx
+  804fa2:	83 fa 07             	cmp    $0x7,%edx
+  804fa5:	77 0c                	ja     804fb3 <ipcring_req_slot+0x1f>
+  804fa7:	8b 50 10             	mov    0x10(%eax),%edx
+  804faa:	83 e2 07             	and    $0x7,%edx
+  804fad:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  804fb1:	5d                   	pop    %ebp
+  804fb2:	c3                   	ret
+  804fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb8:	eb f7                	jmp    804fb1 <ipcring_req_slot+0x1d>
+
+00804fba <ipcring_req_push>:
+  804fba:	55                   	push   %ebp
+  804fbb:	89 e5                	mov    %esp,%ebp
+  804fbd:	83 ec 08             	sub    $0x8,%esp
+  804fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  804fc3:	8b 42 10             	mov    0x10(%edx),%eax
+  804fc6:	83 c0 01             	add    $0x1,%eax
+  804fc9:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  804fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fd2:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  804fd6:	85 c0                	test   %eax,%eax
+  804fd8:	75 02                	jne    804fdc <ipcring_req_push+0x22>
+  804fda:	c9                   	leave
+  804fdb:	c3                   	ret
+  804fdc:	6a 00                	push   $0x0
+  804fde:	68 00 00 80 ee       	push   $0xee800000
+  804fe3:	ff 72 08             	push   0x8(%edx)
+  804fe6:	ff 72 04             	push   0x4(%edx)
+  804fe9:	e8 1b e3 ff ff       	call   803309 <sys_ipc_send>
+  804fee:	83 c4 10             	add    $0x10,%esp
+  804ff1:	eb e7                	jmp    804fda <ipcring_req_push+0x20>
+
+00804ff3 <ipcring_rsp_wait>:
+  804ff3:	55                   	push   %ebp
+  804ff4:	89 e5                	mov    %esp,%ebp
+  804ff6:	53                   	push   %ebx
+  804ff7:	83 ec 04             	sub    $0x4,%esp
+  804ffa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804ffd:	8b 53 18             	mov    0x18(%ebx),%edx
+  805000:	8b 43 10             	mov    0x10(%ebx),%eax
+  805003:	39 c2                	cmp    %eax,%edx
+  805005:	74 3c                	je     805043 <ipcring_rsp_wait+0x50>
+  805007:	8b 53 14             	mov    0x14(%ebx),%edx
+  80500a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80500d:	39 c2                	cmp    %eax,%edx
+  80500f:	75 23                	jne    805034 <ipcring_rsp_wait+0x41>
+  805011:	83 ec 08             	sub    $0x8,%esp
+  805014:	6a 00                	push   $0x0
+  805016:	6a 00                	push   $0x0
+  805018:	6a 00                	push   $0x0
+  80501a:	6a 00                	push   $0x0
+  80501c:	ff 73 0c             	push   0xc(%ebx)
+  80501f:	ff 73 04             	push   0x4(%ebx)
+  805022:	e8 73 e9 ff ff       	call   80399a <ipc_call>
+  805027:	8b 53 14             	mov    0x14(%ebx),%edx
+  80502a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80502d:	83 c4 20             	add    $0x20,%esp
+  805030:	39 c2                	cmp    %eax,%edx
+  805032:	74 dd                	je     805011 <ipcring_rsp_wait+0x1e>
+  805034:	8b 43 18             	mov    0x18(%ebx),%eax
+  805037:	83 e0 07             	and    $0x7,%eax
+  80503a:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  80503e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805041:	c9                   	leave
+  805042:	c3                   	ret
+  805043:	68 84 60 80 00       	push   $0x806084
+  805048:	68 3d 55 80 00       	push   $0x80553d
+  80504d:	6a 3b                	push   $0x3b
+  80504f:	68 a5 60 80 00       	push   $0x8060a5
+  805054:	e8 46 d3 ff ff       	call   80239f <_panic>
+
+00805059 <ipcring_rsp_pop>:
+  805059:	55                   	push   %ebp
+  80505a:	89 e5                	mov    %esp,%ebp
+  80505c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80505f:	8b 42 18             	mov    0x18(%edx),%eax
+  805062:	83 c0 01             	add    $0x1,%eax
+  805065:	89 42 18             	mov    %eax,0x18(%edx)
+  805068:	5d                   	pop    %ebp
+  805069:	c3                   	ret
+
+0080506a <ipcring_server_init>:
+  80506a:	55                   	push   %ebp
+  80506b:	89 e5                	mov    %esp,%ebp
+  80506d:	8b 45 08             	mov    0x8(%ebp),%eax
+  805070:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805073:	89 10                	mov    %edx,(%eax)
+  805075:	8b 55 10             	mov    0x10(%ebp),%edx
+  805078:	89 50 04             	mov    %edx,0x4(%eax)
+  80507b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  805082:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  805089:	5d                   	pop    %ebp
+  80508a:	c3                   	ret
+
+0080508b <ipcring_req_avail>:
+  80508b:	55                   	push   %ebp
+  80508c:	89 e5                	mov    %esp,%ebp
+  80508e:	8b 55 08             	mov    0x8(%ebp),%edx
+  805091:	8b 02                	mov    (%edx),%eax
+  805093:	8b 40 10             	mov    0x10(%eax),%eax
+  805096:	2b 42 08             	sub    0x8(%edx),%eax
+  805099:	ba 08 00 00 00       	mov    $0x8,%edx
+  80509e:	39 d0                	cmp    %edx,%eax
+  8050a0:	0f 47 c2             	cmova  %edx,%eax
+  8050a3:	5d                   	pop    %ebp
+  8050a4:	c3                   	ret
+
+008050a5 <ipcring_req_peek>:
+  8050a5:	55                   	push   %ebp
+  8050a6:	89 e5                	mov    %esp,%ebp
+  8050a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8050ab:	8b 42 08             	mov    0x8(%edx),%eax
+  8050ae:	83 e0 07             	and    $0x7,%eax
+  8050b1:	8b 12                	mov    (%edx),%edx
+  8050b3:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8050b7:	5d                   	pop    %ebp
+  8050b8:	c3                   	ret
+
+008050b9 <ipcring_rsp_push>:
+  8050b9:	55                   	push   %ebp
+  8050ba:	89 e5                	mov    %esp,%ebp
+  8050bc:	83 ec 08             	sub    $0x8,%esp
+  8050bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8050c2:	8b 41 08             	mov    0x8(%ecx),%eax
+  8050c5:	83 c0 01             	add    $0x1,%eax
+  8050c8:	89 41 08             	mov    %eax,0x8(%ecx)
+  8050cb:	8b 11                	mov    (%ecx),%edx
+  8050cd:	83 c2 14             	add    $0x14,%edx
+  8050d0:	f0 87 02             	lock xchg %eax,(%edx)
+  8050d3:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8050d7:	75 02                	jne    8050db <ipcring_rsp_push+0x22>
+  8050d9:	c9                   	leave
+  8050da:	c3                   	ret
+  8050db:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8050e2:	6a 00                	push   $0x0
+  8050e4:	68 00 00 80 ee       	push   $0xee800000
+  8050e9:	6a 00                	push   $0x0
+  8050eb:	ff 71 04             	push   0x4(%ecx)
+  8050ee:	e8 39 e1 ff ff       	call   80322c <sys_ipc_try_send>
+  8050f3:	83 c4 10             	add    $0x10,%esp
+  8050f6:	eb e1                	jmp    8050d9 <ipcring_rsp_push+0x20>
+
+008050f8 <ipcring_client_wait>:
+  8050f8:	55                   	push   %ebp
+  8050f9:	89 e5                	mov    %esp,%ebp
+  8050fb:	83 ec 08             	sub    $0x8,%esp
+  8050fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  805101:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  805108:	8b 10                	mov    (%eax),%edx
+  80510a:	8b 52 18             	mov    0x18(%edx),%edx
+  80510d:	3b 50 08             	cmp    0x8(%eax),%edx
+  805110:	75 02                	jne    805114 <ipcring_client_wait+0x1c>
+  805112:	c9                   	leave
+  805113:	c3                   	ret
+  805114:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80511b:	6a 00                	push   $0x0
+  80511d:	68 00 00 80 ee       	push   $0xee800000
+  805122:	6a 00                	push   $0x0
+  805124:	ff 70 04             	push   0x4(%eax)
+  805127:	e8 00 e1 ff ff       	call   80322c <sys_ipc_try_send>
+  80512c:	83 c4 10             	add    $0x10,%esp
+  80512f:	eb e1                	jmp    805112 <ipcring_client_wait+0x1a>
+
+00805131 <ipcring_server_sleep>:
+  805131:	55                   	push   %ebp
+  805132:	89 e5                	mov    %esp,%ebp
+  805134:	53                   	push   %ebx
+  805135:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  805138:	8b 01                	mov    (%ecx),%eax
+  80513a:	8d 50 1c             	lea    0x1c(%eax),%edx
+  80513d:	b8 01 00 00 00       	mov    $0x1,%eax
+  805142:	f0 87 02             	lock xchg %eax,(%edx)
+  805145:	8b 11                	mov    (%ecx),%edx
+  805147:	8b 5a 10             	mov    0x10(%edx),%ebx
+  80514a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80514f:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  805152:	74 0e                	je     805162 <ipcring_server_sleep+0x31>
+  805154:	b8 00 00 00 00       	mov    $0x0,%eax
+  805159:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80515d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805162:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805165:	c9                   	leave
+  805166:	c3                   	ret
+
+00805167 <devcons_close>:
+  805167:	b8 00 00 00 00       	mov    $0x0,%eax
+  80516c:	c3                   	ret
+
+0080516d <devcons_stat>:
+  80516d:	55                   	push   %ebp
+  80516e:	89 e5                	mov    %esp,%ebp
+  805170:	83 ec 10             	sub    $0x10,%esp
+  805173:	68 b3 60 80 00       	push   $0x8060b3
+  805178:	ff 75 0c             	push   0xc(%ebp)
+  80517b:	e8 f1 d9 ff ff       	call   802b71 <strcpy>
+  805180:	b8 00 00 00 00       	mov    $0x0,%eax
+  805185:	c9                   	leave
+  805186:	c3                   	ret
+
+00805187 <devcons_write>:
+  805187:	55                   	push   %ebp
+  805188:	89 e5                	mov    %esp,%ebp
+  80518a:	57                   	push   %edi
+  80518b:	56                   	push   %esi
+  80518c:	53                   	push   %ebx
+  80518d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  805193:	8b 7d 10             	mov    0x10(%ebp),%edi
+  805196:	85 ff                	test   %edi,%edi
+  805198:	74 51                	je     8051eb <devcons_write+0x64>
+  80519a:	be 00 00 00 00       	mov    $0x0,%esi
+  80519f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a4:	89 fb                	mov    %edi,%ebx
+  8051a6:	29 c3                	sub    %eax,%ebx
+  8051a8:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8051ad:	39 d3                	cmp    %edx,%ebx
+  8051af:	0f 47 da             	cmova  %edx,%ebx
+  8051b2:	83 ec 04             	sub    $0x4,%esp
+  8051b5:	53                   	push   %ebx
+  8051b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8051b9:	50                   	push   %eax
+  8051ba:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8051c0:	50                   	push   %eax
+  8051c1:	e8 5b db ff ff       	call   802d21 <memmove>
+  8051c6:	83 c4 08             	add    $0x8,%esp
+  8051c9:	53                   	push   %ebx
+  8051ca:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8051d0:	50                   	push   %eax
+  8051d1:	e8 13 dd ff ff       	call   802ee9 <sys_cputs>
+  8051d6:	01 de                	add    %ebx,%esi
+  8051d8:	89 f0                	mov    %esi,%eax
+  8051da:	83 c4 10             	add    $0x10,%esp
+  8051dd:	39 fe                	cmp    %edi,%esi
+  8051df:	72 c3                	jb     8051a4 <devcons_write+0x1d>
+  8051e1:	89 f0                	mov    %esi,%eax
+  8051e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051e6:	5b                   	pop    %ebx
+  8051e7:	5e                   	pop    %esi
+  8051e8:	5f                   	pop    %edi
+  8051e9:	5d                   	pop    %ebp
+  8051ea:	c3                   	ret
+  8051eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8051f0:	eb ef                	jmp    8051e1 <devcons_write+0x5a>
+
+008051f2 <devcons_read>:
+  8051f2:	55                   	push   %ebp
+  8051f3:	89 e5                	mov    %esp,%ebp
+  8051f5:	83 ec 08             	sub    $0x8,%esp
+  8051f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051fd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  805201:	75 07                	jne    80520a <devcons_read+0x18>
+  805203:	eb 1f                	jmp    805224 <devcons_read+0x32>
+  805205:	e8 7c dd ff ff       	call   802f86 <sys_yield>
+  80520a:	e8 f8 dc ff ff       	call   802f07 <sys_cgetc>
+  80520f:	85 c0                	test   %eax,%eax
+  805211:	74 f2                	je     805205 <devcons_read+0x13>
+  805213:	78 0f                	js     805224 <devcons_read+0x32>
+  805215:	83 f8 04             	cmp    $0x4,%eax
+  805218:	74 0c                	je     805226 <devcons_read+0x34>
+  80521a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80521d:	88 02                	mov    %al,(%edx)
+  80521f:	b8 01 00 00 00       	mov    $0x1,%eax
+  805224:	c9                   	leave
+  805225:	c3                   	ret
+  805226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80522b:	eb f7                	jmp    805224 <devcons_read+0x32>
+
+0080522d <cputchar>:
+  80522d:	55                   	push   %ebp
+  80522e:	89 e5                	mov    %esp,%ebp
+  805230:	83 ec 20             	sub    $0x20,%esp
+  805233:	8b 45 08             	mov    0x8(%ebp),%eax
+  805236:	88 45 f7             	mov    %al,-0x9(%ebp)
+  805239:	6a 01                	push   $0x1
+  80523b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80523e:	50                   	push   %eax
+  80523f:	e8 a5 dc ff ff       	call   802ee9 <sys_cputs>
+  805244:	83 c4 10             	add    $0x10,%esp
+  805247:	c9                   	leave
+  805248:	c3                   	ret
+
+00805249 <getchar>:
+  805249:	55                   	push   %ebp
+  80524a:	89 e5                	mov    %esp,%ebp
+  80524c:	83 ec 1c             	sub    $0x1c,%esp
+  80524f:	6a 01                	push   $0x1
+  805251:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805254:	50                   	push   %eax
+  805255:	6a 00                	push   $0x0
+  805257:	e8 cc eb ff ff       	call   803e28 <read>
+  80525c:	83 c4 10             	add    $0x10,%esp
+  80525f:	85 c0                	test   %eax,%eax
+  805261:	78 06                	js     805269 <getchar+0x20>
+  805263:	74 06                	je     80526b <getchar+0x22>
+  805265:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  805269:	c9                   	leave
+  80526a:	c3                   	ret
+  80526b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  805270:	eb f7                	jmp    805269 <getchar+0x20>
+
+00805272 <iscons>:
+  805272:	55                   	push   %ebp
+  805273:	89 e5                	mov    %esp,%ebp
+  805275:	83 ec 20             	sub    $0x20,%esp
+  805278:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80527b:	50                   	push   %eax
+  80527c:	ff 75 08             	push   0x8(%ebp)
+  80527f:	e8 42 e9 ff ff       	call   803bc6 <fd_lookup>
+  805284:	83 c4 10             	add    $0x10,%esp
+  805287:	85 c0                	test   %eax,%eax
+  805289:	78 11                	js     80529c <iscons+0x2a>
+  80528b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80528e:	8b 15 d8 b0 80 00    	mov    0x80b0d8,%edx
+  805294:	39 10                	cmp    %edx,(%eax)
+  805296:	0f 94 c0             	sete   %al
+  805299:	0f b6 c0             	movzbl %al,%eax
+  80529c:	c9                   	leave
+  80529d:	c3                   	ret
+
+0080529e <opencons>:
+  80529e:	55                   	push   %ebp
+  80529f:	89 e5                	mov    %esp,%ebp
+  8052a1:	83 ec 24             	sub    $0x24,%esp
+  8052a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8052a7:	50                   	push   %eax
+  8052a8:	e8 c9 e8 ff ff       	call   803b76 <fd_alloc>
+  8052ad:	83 c4 10             	add    $0x10,%esp
+  8052b0:	85 c0                	test   %eax,%eax
+  8052b2:	78 3a                	js     8052ee <opencons+0x50>
+  8052b4:	83 ec 04             	sub    $0x4,%esp
+  8052b7:	68 07 04 00 00       	push   $0x407
+  8052bc:	ff 75 f4             	push   -0xc(%ebp)
+  8052bf:	6a 00                	push   $0x0
+  8052c1:	e8 0b dd ff ff       	call   802fd1 <sys_page_alloc>
+  8052c6:	83 c4 10             	add    $0x10,%esp
+  8052c9:	85 c0                	test   %eax,%eax
+  8052cb:	78 21                	js     8052ee <opencons+0x50>
+  8052cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8052d0:	8b 15 d8 b0 80 00    	mov    0x80b0d8,%edx
+  8052d6:	89 10                	mov    %edx,(%eax)
+  8052d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8052db:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8052e2:	83 ec 0c             	sub    $0xc,%esp
+  8052e5:	50                   	push   %eax
+  8052e6:	e8 64 e8 ff ff       	call   803b4f <fd2num>
+  8052eb:	83 c4 10             	add    $0x10,%esp
+  8052ee:	c9                   	leave
+  8052ef:	c3                   	ret
+
+008052f0 <__udivmoddi4>:
+  8052f0:	55                   	push   %ebp
+  8052f1:	57                   	push   %edi
+  8052f2:	56                   	push   %esi
+  8052f3:	53                   	push   %ebx
+  8052f4:	83 ec 24             	sub    $0x24,%esp
+  8052f7:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8052fb:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8052ff:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805303:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805307:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80530b:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80530f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805313:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805317:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80531b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805320:	ba 00 00 00 00       	mov    $0x0,%edx
+  805325:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80532a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805331:	00 
+  805332:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805339:	00 
+  80533a:	89 fb                	mov    %edi,%ebx
+  80533c:	eb 08                	jmp    805346 <__udivmoddi4+0x56>
+  80533e:	83 e9 01             	sub    $0x1,%ecx
+  805341:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805344:	74 68                	je     8053ae <__udivmoddi4+0xbe>
+  805346:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80534a:	01 c0                	add    %eax,%eax
+  80534c:	89 c6                	mov    %eax,%esi
+  80534e:	89 d7                	mov    %edx,%edi
+  805350:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805354:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805358:	0f ad d0             	shrd   %cl,%edx,%eax
+  80535b:	d3 ea                	shr    %cl,%edx
+  80535d:	f6 c1 20             	test   $0x20,%cl
+  805360:	74 04                	je     805366 <__udivmoddi4+0x76>
+  805362:	89 d0                	mov    %edx,%eax
+  805364:	31 d2                	xor    %edx,%edx
+  805366:	83 e0 01             	and    $0x1,%eax
+  805369:	89 04 24             	mov    %eax,(%esp)
+  80536c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805373:	00 
+  805374:	8b 04 24             	mov    (%esp),%eax
+  805377:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80537b:	09 f0                	or     %esi,%eax
+  80537d:	09 fa                	or     %edi,%edx
+  80537f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805383:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805387:	39 f0                	cmp    %esi,%eax
+  805389:	89 d5                	mov    %edx,%ebp
+  80538b:	19 fd                	sbb    %edi,%ebp
+  80538d:	72 af                	jb     80533e <__udivmoddi4+0x4e>
+  80538f:	29 f0                	sub    %esi,%eax
+  805391:	19 fa                	sbb    %edi,%edx
+  805393:	89 cf                	mov    %ecx,%edi
+  805395:	c1 ef 05             	shr    $0x5,%edi
+  805398:	83 e7 01             	and    $0x1,%edi
+  80539b:	89 fe                	mov    %edi,%esi
+  80539d:	83 f6 01             	xor    $0x1,%esi
+  8053a0:	d3 e6                	shl    %cl,%esi
+  8053a2:	d3 e7                	shl    %cl,%edi
+  8053a4:	09 74 24 18          	or     %esi,0x18(%esp)
+  8053a8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8053ac:	eb 90                	jmp    80533e <__udivmoddi4+0x4e>
+  8053ae:	85 db                	test   %ebx,%ebx
+  8053b0:	74 05                	je     8053b7 <__udivmoddi4+0xc7>
+  8053b2:	89 03                	mov    %eax,(%ebx)
+  8053b4:	89 53 04             	mov    %edx,0x4(%ebx)
+  8053b7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8053bb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8053bf:	83 c4 24             	add    $0x24,%esp
+  8053c2:	5b                   	pop    %ebx
+  8053c3:	5e                   	pop    %esi
+  8053c4:	5f                   	pop    %edi
+  8053c5:	5d                   	pop    %ebp
+  8053c6:	c3                   	ret
+
+008053c7 <__udivdi3>:
+  8053c7:	83 ec 08             	sub    $0x8,%esp
+  8053ca:	6a 00                	push   $0x0
+  8053cc:	ff 74 24 1c          	push   0x1c(%esp)
+  8053d0:	ff 74 24 1c          	push   0x1c(%esp)
+  8053d4:	ff 74 24 1c          	push   0x1c(%esp)
+  8053d8:	ff 74 24 1c          	push   0x1c(%esp)
+  8053dc:	e8 0f ff ff ff       	call   8052f0 <__udivmoddi4>
+  8053e1:	83 c4 1c             	add    $0x1c,%esp
+  8053e4:	c3                   	ret
+
+008053e5 <__umoddi3>:
+  8053e5:	83 ec 18             	sub    $0x18,%esp
+  8053e8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8053ec:	50                   	push   %eax
+  8053ed:	ff 74 24 2c          	push   0x2c(%esp)
+  8053f1:	ff 74 24 2c          	push   0x2c(%esp)
+  8053f5:	ff 74 24 2c          	push   0x2c(%esp)
+  8053f9:	ff 74 24 2c          	push   0x2c(%esp)
+  8053fd:	e8 ee fe ff ff       	call   8052f0 <__udivmoddi4>
+  805402:	8b 44 24 20          	mov    0x20(%esp),%eax
+  805406:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80540a:	83 c4 2c             	add    $0x2c,%esp
+  80540d:	c3                   	ret
+
+0080540e <__divdi3>:
+  80540e:	53                   	push   %ebx
+  80540f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805413:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805417:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80541b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80541f:	85 d2                	test   %edx,%edx
+  805421:	78 12                	js     805435 <__divdi3+0x27>
+  805423:	85 db                	test   %ebx,%ebx
+  805425:	78 2e                	js     805455 <__divdi3+0x47>
+  805427:	53                   	push   %ebx
+  805428:	51                   	push   %ecx
+  805429:	52                   	push   %edx
+  80542a:	50                   	push   %eax
+  80542b:	e8 97 ff ff ff       	call   8053c7 <__udivdi3>
+  805430:	83 c4 10             	add    $0x10,%esp
+  805433:	eb 1e                	jmp    805453 <__divdi3+0x45>
+  805435:	f7 d8                	neg    %eax
+  805437:	83 d2 00             	adc    $0x0,%edx
+  80543a:	f7 da                	neg    %edx
+  80543c:	85 db                	test   %ebx,%ebx
+  80543e:	78 2a                	js     80546a <__divdi3+0x5c>
+  805440:	53                   	push   %ebx
+  805441:	51                   	push   %ecx
+  805442:	52                   	push   %edx
+  805443:	50                   	push   %eax
+  805444:	e8 7e ff ff ff       	call   8053c7 <__udivdi3>
+  805449:	83 c4 10             	add    $0x10,%esp
+  80544c:	f7 d8                	neg    %eax
+  80544e:	83 d2 00             	adc    $0x0,%edx
+  805451:	f7 da                	neg    %edx
+  805453:	5b                   	pop    %ebx
+  805454:	c3                   	ret
+  805455:	f7 d9                	neg    %ecx
+  805457:	83 d3 00             	adc    $0x0,%ebx
+  80545a:	f7 db                	neg    %ebx
+  80545c:	53                   	push   %ebx
+  80545d:	51                   	push   %ecx
+  80545e:	52                   	push   %edx
+  80545f:	50                   	push   %eax
+  805460:	e8 62 ff ff ff       	call   8053c7 <__udivdi3>
+  805465:	83 c4 10             	add    $0x10,%esp
+  805468:	eb e2                	jmp    80544c <__divdi3+0x3e>
+  80546a:	f7 d9                	neg    %ecx
+  80546c:	83 d3 00             	adc    $0x0,%ebx
+  80546f:	f7 db                	neg    %ebx
+  805471:	53                   	push   %ebx
+  805472:	51                   	push   %ecx
+  805473:	52                   	push   %edx
+  805474:	50                   	push   %eax
+  805475:	e8 4d ff ff ff       	call   8053c7 <__udivdi3>
+  80547a:	83 c4 10             	add    $0x10,%esp
+  80547d:	eb d4                	jmp    805453 <__divdi3+0x45>
+
+0080547f <__moddi3>:
+  80547f:	55                   	push   %ebp
+  805480:	57                   	push   %edi
+  805481:	56                   	push   %esi
+  805482:	53                   	push   %ebx
+  805483:	83 ec 0c             	sub    $0xc,%esp
+  805486:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80548a:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80548e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805492:	89 e9                	mov    %ebp,%ecx
+  805494:	f7 d9                	neg    %ecx
+  805496:	89 d0                	mov    %edx,%eax
+  805498:	83 d0 00             	adc    $0x0,%eax
+  80549b:	f7 d8                	neg    %eax
+  80549d:	0f 49 e9             	cmovns %ecx,%ebp
+  8054a0:	0f 49 d0             	cmovns %eax,%edx
+  8054a3:	52                   	push   %edx
+  8054a4:	55                   	push   %ebp
+  8054a5:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8054a9:	f7 da                	neg    %edx
+  8054ab:	89 d8                	mov    %ebx,%eax
+  8054ad:	83 d0 00             	adc    $0x0,%eax
+  8054b0:	f7 d8                	neg    %eax
+  8054b2:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8054b7:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8054bb:	0f 48 c3             	cmovs  %ebx,%eax
+  8054be:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8054c2:	ff 74 24 0c          	push   0xc(%esp)
+  8054c6:	ff 74 24 0c          	push   0xc(%esp)
+  8054ca:	e8 16 ff ff ff       	call   8053e5 <__umoddi3>
+  8054cf:	83 c4 10             	add    $0x10,%esp
+  8054d2:	85 db                	test   %ebx,%ebx
+  8054d4:	78 08                	js     8054de <__moddi3+0x5f>
+  8054d6:	83 c4 0c             	add    $0xc,%esp
+  8054d9:	5b                   	pop    %ebx
+  8054da:	5e                   	pop    %esi
+  8054db:	5f                   	pop    %edi
+  8054dc:	5d                   	pop    %ebp
+  8054dd:	c3                   	ret
+  8054de:	f7 d8                	neg    %eax
+  8054e0:	83 d2 00             	adc    $0x0,%edx
+  8054e3:	f7 da                	neg    %edx
+  8054e5:	eb ef                	jmp    8054d6 <__moddi3+0x57>
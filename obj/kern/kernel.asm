@@ -0,0 +1,15486 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+f0100015:	b8 00 80 11 00       	mov    $0x118000,%eax
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+f010001d:	0f 20 c0             	mov    %cr0,%eax
+f0100020:	0d 01 00 01 80       	or     $0x80010001,%eax
+f0100025:	0f 22 c0             	mov    %eax,%cr0
+f0100028:	b8 2f 00 10 f0       	mov    $0xf010002f,%eax
+f010002d:	ff e0                	jmp    *%eax
+
+f010002f <relocated>:
+f010002f:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0100034:	bc 00 80 11 f0       	mov    $0xf0118000,%esp
+f0100039:	e8 61 00 00 00       	call   f010009f <i386_init>
+
+f010003e <spin>:
+f010003e:	eb fe                	jmp    f010003e <spin>
+
+f0100040 <_panic>:
+f0100040:	55                   	push   %ebp
+f0100041:	89 e5                	mov    %esp,%ebp
+f0100043:	53                   	push   %ebx
+f0100044:	83 ec 04             	sub    $0x4,%esp
+f0100047:	83 3d 60 1a 2d f0 00 	cmpl   $0x0,0xf02d1a60
+f010004e:	74 0f                	je     f010005f <_panic+0x1f>
+f0100050:	83 ec 0c             	sub    $0xc,%esp
+f0100053:	6a 00                	push   $0x0
+f0100055:	e8 17 10 00 00       	call   f0101071 <monitor>
+f010005a:	83 c4 10             	add    $0x10,%esp
+f010005d:	eb f1                	jmp    f0100050 <_panic+0x10>
+f010005f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100062:	a3 60 1a 2d f0       	mov    %eax,0xf02d1a60
+f0100067:	fa                   	cli
+f0100068:	fc                   	cld
+f0100069:	8d 5d 14             	lea    0x14(%ebp),%ebx
+f010006c:	e8 e0 ae 00 00       	call   f010af51 <cpunum>
+f0100071:	ff 75 0c             	push   0xc(%ebp)
+f0100074:	ff 75 08             	push   0x8(%ebp)
+f0100077:	50                   	push   %eax
+f0100078:	68 00 d0 10 f0       	push   $0xf010d000
+f010007d:	e8 85 5c 00 00       	call   f0105d07 <cprintf>
+f0100082:	83 c4 08             	add    $0x8,%esp
+f0100085:	53                   	push   %ebx
+f0100086:	ff 75 10             	push   0x10(%ebp)
+f0100089:	e8 53 5c 00 00       	call   f0105ce1 <vcprintf>
+f010008e:	c7 04 24 0e e5 10 f0 	movl   $0xf010e50e,(%esp)
+f0100095:	e8 6d 5c 00 00       	call   f0105d07 <cprintf>
+f010009a:	83 c4 10             	add    $0x10,%esp
+f010009d:	eb b1                	jmp    f0100050 <_panic+0x10>
+
+f010009f <i386_init>:
+f010009f:	55                   	push   %ebp
+f01000a0:	89 e5                	mov    %esp,%ebp
+f01000a2:	53                   	push   %ebx
+f01000a3:	83 ec 08             	sub    $0x8,%esp
+f01000a6:	b8 ac b4 32 f0       	mov    $0xf032b4ac,%eax
+f01000ab:	2d dc 3b 2b f0       	sub    $0xf02b3bdc,%eax
+f01000b0:	50                   	push   %eax
+f01000b1:	6a 00                	push   $0x0
+f01000b3:	68 dc 3b 2b f0       	push   $0xf02b3bdc
+f01000b8:	e8 37 a8 00 00       	call   f010a8f4 <memset>
+f01000bd:	e8 46 06 00 00       	call   f0100708 <cons_init>
+f01000c2:	83 c4 08             	add    $0x8,%esp
+f01000c5:	68 ac 1a 00 00       	push   $0x1aac
+f01000ca:	68 6c d0 10 f0       	push   $0xf010d06c
+f01000cf:	e8 33 5c 00 00       	call   f0105d07 <cprintf>
+f01000d4:	e8 fc 21 00 00       	call   f01022d5 <mem_init>
+f01000d9:	c7 04 24 87 d0 10 f0 	movl   $0xf010d087,(%esp)
+f01000e0:	e8 22 5c 00 00       	call   f0105d07 <cprintf>
+f01000e5:	e8 be 4e 00 00       	call   f0104fa8 <env_init>
+f01000ea:	c7 04 24 9d d0 10 f0 	movl   $0xf010d09d,(%esp)
+f01000f1:	e8 11 5c 00 00       	call   f0105d07 <cprintf>
+f01000f6:	e8 b5 5d 00 00       	call   f0105eb0 <trap_init>
+f01000fb:	c7 04 24 b3 d0 10 f0 	movl   $0xf010d0b3,(%esp)
+f0100102:	e8 00 5c 00 00       	call   f0105d07 <cprintf>
+f0100107:	e8 10 ab 00 00       	call   f010ac1c <mp_init>
+f010010c:	e8 1c af 00 00       	call   f010b02d <lapic_init>
+f0100111:	e8 fd 5a 00 00       	call   f0105c13 <pic_init>
+f0100116:	e8 b7 c1 00 00       	call   f010c2d2 <time_init>
+f010011b:	e8 92 c1 00 00       	call   f010c2b2 <pci_init>
+f0100120:	c7 04 24 a0 a3 11 f0 	movl   $0xf011a3a0,(%esp)
+f0100127:	e8 ff b1 00 00       	call   f010b32b <spin_lock>
+f010012c:	83 c4 10             	add    $0x10,%esp
+f010012f:	83 3d 68 1a 2d f0 07 	cmpl   $0x7,0xf02d1a68
+f0100136:	76 41                	jbe    f0100179 <i386_init+0xda>
+f0100138:	83 ec 04             	sub    $0x4,%esp
+f010013b:	b8 6e ab 10 f0       	mov    $0xf010ab6e,%eax
+f0100140:	2d f4 aa 10 f0       	sub    $0xf010aaf4,%eax
+f0100145:	50                   	push   %eax
+f0100146:	68 f4 aa 10 f0       	push   $0xf010aaf4
+f010014b:	68 00 70 00 f0       	push   $0xf0007000
+f0100150:	e8 d4 a7 00 00       	call   f010a929 <memmove>
+f0100155:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f010015c:	00 00 00 
+f010015f:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0100164:	83 c4 10             	add    $0x10,%esp
+f0100167:	3d 20 20 2d f0       	cmp    $0xf02d2020,%eax
+f010016c:	0f 86 86 00 00 00    	jbe    f01001f8 <i386_init+0x159>
+f0100172:	bb 20 20 2d f0       	mov    $0xf02d2020,%ebx
+f0100177:	eb 2f                	jmp    f01001a8 <i386_init+0x109>
+f0100179:	68 00 70 00 00       	push   $0x7000
+f010017e:	68 24 d0 10 f0       	push   $0xf010d024
+f0100183:	6a 72                	push   $0x72
+f0100185:	68 ca d0 10 f0       	push   $0xf010d0ca
+f010018a:	e8 b1 fe ff ff       	call   f0100040 <_panic>
+f010018f:	81 c3 94 00 00 00    	add    $0x94,%ebx
+f0100195:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f010019c:	00 00 00 
+f010019f:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f01001a4:	39 c3                	cmp    %eax,%ebx
+f01001a6:	73 50                	jae    f01001f8 <i386_init+0x159>
+f01001a8:	e8 a4 ad 00 00       	call   f010af51 <cpunum>
+f01001ad:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01001b3:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f01001b8:	39 c3                	cmp    %eax,%ebx
+f01001ba:	74 d3                	je     f010018f <i386_init+0xf0>
+f01001bc:	89 d8                	mov    %ebx,%eax
+f01001be:	2d 20 20 2d f0       	sub    $0xf02d2020,%eax
+f01001c3:	c1 f8 02             	sar    $0x2,%eax
+f01001c6:	69 c0 ad 1b 4c 91    	imul   $0x914c1bad,%eax,%eax
+f01001cc:	c1 e0 0f             	shl    $0xf,%eax
+f01001cf:	8d 80 00 b0 2d f0    	lea    -0xfd25000(%eax),%eax
+f01001d5:	a3 64 1a 2d f0       	mov    %eax,0xf02d1a64
+f01001da:	83 ec 08             	sub    $0x8,%esp
+f01001dd:	68 00 70 00 00       	push   $0x7000
+f01001e2:	0f b6 03             	movzbl (%ebx),%eax
+f01001e5:	50                   	push   %eax
+f01001e6:	e8 02 b0 00 00       	call   f010b1ed <lapic_startap>
+f01001eb:	83 c4 10             	add    $0x10,%esp
+f01001ee:	8b 43 04             	mov    0x4(%ebx),%eax
+f01001f1:	83 f8 01             	cmp    $0x1,%eax
+f01001f4:	75 f8                	jne    f01001ee <i386_init+0x14f>
+f01001f6:	eb 97                	jmp    f010018f <i386_init+0xf0>
+f01001f8:	bb 08 00 00 00       	mov    $0x8,%ebx
+f01001fd:	83 ec 04             	sub    $0x4,%esp
+f0100200:	6a 01                	push   $0x1
+f0100202:	68 30 66 00 00       	push   $0x6630
+f0100207:	68 60 d6 16 f0       	push   $0xf016d660
+f010020c:	e8 35 50 00 00       	call   f0105246 <env_create>
+f0100211:	83 c4 10             	add    $0x10,%esp
+f0100214:	83 eb 01             	sub    $0x1,%ebx
+f0100217:	75 e4                	jne    f01001fd <i386_init+0x15e>
+f0100219:	83 ec 04             	sub    $0x4,%esp
+f010021c:	6a 02                	push   $0x2
+f010021e:	68 08 de 00 00       	push   $0xde08
+f0100223:	68 20 ff 1e f0       	push   $0xf01eff20
+f0100228:	e8 19 50 00 00       	call   f0105246 <env_create>
+f010022d:	83 c4 0c             	add    $0xc,%esp
+f0100230:	6a 03                	push   $0x3
+f0100232:	68 a8 a6 01 00       	push   $0x1a6a8
+f0100237:	68 90 f4 22 f0       	push   $0xf022f490
+f010023c:	e8 05 50 00 00       	call   f0105246 <env_create>
+f0100241:	83 c4 0c             	add    $0xc,%esp
+f0100244:	6a 05                	push   $0x5
+f0100246:	68 6c 79 00 00       	push   $0x796c
+f010024b:	68 9c 48 2a f0       	push   $0xf02a489c
+f0100250:	e8 f1 4f 00 00       	call   f0105246 <env_create>
+f0100255:	83 c4 0c             	add    $0xc,%esp
+f0100258:	6a 04                	push   $0x4
+f010025a:	68 d4 79 00 00       	push   $0x79d4
+f010025f:	68 08 c2 2a f0       	push   $0xf02ac208
+f0100264:	e8 dd 4f 00 00       	call   f0105246 <env_create>
+f0100269:	e8 46 04 00 00       	call   f01006b4 <kbd_intr>
+f010026e:	e8 88 6f 00 00       	call   f01071fb <sched_yield>
+
+f0100273 <mp_main>:
+f0100273:	55                   	push   %ebp
+f0100274:	89 e5                	mov    %esp,%ebp
+f0100276:	83 ec 08             	sub    $0x8,%esp
+f0100279:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f010027e:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100283:	76 5e                	jbe    f01002e3 <mp_main+0x70>
+f0100285:	05 00 00 00 10       	add    $0x10000000,%eax
+f010028a:	0f 22 d8             	mov    %eax,%cr3
+f010028d:	0f 20 e0             	mov    %cr4,%eax
+f0100290:	83 c8 10             	or     $0x10,%eax
+f0100293:	0f 22 e0             	mov    %eax,%cr4
+f0100296:	e8 b6 ac 00 00       	call   f010af51 <cpunum>
+f010029b:	83 ec 08             	sub    $0x8,%esp
+f010029e:	50                   	push   %eax
+f010029f:	68 d6 d0 10 f0       	push   $0xf010d0d6
+f01002a4:	e8 5e 5a 00 00       	call   f0105d07 <cprintf>
+f01002a9:	e8 7f ad 00 00       	call   f010b02d <lapic_init>
+f01002ae:	e8 c9 4c 00 00       	call   f0104f7c <env_init_percpu>
+f01002b3:	e8 63 5a 00 00       	call   f0105d1b <trap_init_percpu>
+f01002b8:	e8 94 ac 00 00       	call   f010af51 <cpunum>
+f01002bd:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+f01002c3:	83 c2 04             	add    $0x4,%edx
+f01002c6:	b8 01 00 00 00       	mov    $0x1,%eax
+f01002cb:	f0 87 82 20 20 2d f0 	lock xchg %eax,-0xfd2dfe0(%edx)
+f01002d2:	c7 04 24 a0 a3 11 f0 	movl   $0xf011a3a0,(%esp)
+f01002d9:	e8 4d b0 00 00       	call   f010b32b <spin_lock>
+f01002de:	e8 18 6f 00 00       	call   f01071fb <sched_yield>
+f01002e3:	50                   	push   %eax
+f01002e4:	68 48 d0 10 f0       	push   $0xf010d048
+f01002e9:	68 89 00 00 00       	push   $0x89
+f01002ee:	68 ca d0 10 f0       	push   $0xf010d0ca
+f01002f3:	e8 48 fd ff ff       	call   f0100040 <_panic>
+
+f01002f8 <_warn>:
+f01002f8:	55                   	push   %ebp
+f01002f9:	89 e5                	mov    %esp,%ebp
+f01002fb:	53                   	push   %ebx
+f01002fc:	83 ec 08             	sub    $0x8,%esp
+f01002ff:	8d 5d 14             	lea    0x14(%ebp),%ebx
+f0100302:	ff 75 0c             	push   0xc(%ebp)
+f0100305:	ff 75 08             	push   0x8(%ebp)
+f0100308:	68 ec d0 10 f0       	push   $0xf010d0ec
+f010030d:	e8 f5 59 00 00       	call   f0105d07 <cprintf>
+f0100312:	83 c4 08             	add    $0x8,%esp
+f0100315:	53                   	push   %ebx
+f0100316:	ff 75 10             	push   0x10(%ebp)
+f0100319:	e8 c3 59 00 00       	call   f0105ce1 <vcprintf>
+f010031e:	c7 04 24 0e e5 10 f0 	movl   $0xf010e50e,(%esp)
+f0100325:	e8 dd 59 00 00       	call   f0105d07 <cprintf>
+f010032a:	83 c4 10             	add    $0x10,%esp
+f010032d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100330:	c9                   	leave
+f0100331:	c3                   	ret
+
+f0100332 <serial_proc_data>:
+f0100332:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100337:	ec                   	in     (%dx),%al
+f0100338:	a8 01                	test   $0x1,%al
+f010033a:	74 0a                	je     f0100346 <serial_proc_data+0x14>
+f010033c:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100341:	ec                   	in     (%dx),%al
+f0100342:	0f b6 c0             	movzbl %al,%eax
+f0100345:	c3                   	ret
+f0100346:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010034b:	c3                   	ret
+
+f010034c <cons_intr>:
+f010034c:	55                   	push   %ebp
+f010034d:	89 e5                	mov    %esp,%ebp
+f010034f:	53                   	push   %ebx
+f0100350:	83 ec 04             	sub    $0x4,%esp
+f0100353:	89 c3                	mov    %eax,%ebx
+f0100355:	eb 23                	jmp    f010037a <cons_intr+0x2e>
+f0100357:	8b 0d 24 42 2b f0    	mov    0xf02b4224,%ecx
+f010035d:	8d 51 01             	lea    0x1(%ecx),%edx
+f0100360:	88 81 20 40 2b f0    	mov    %al,-0xfd4bfe0(%ecx)
+f0100366:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+f010036c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100371:	0f 44 d0             	cmove  %eax,%edx
+f0100374:	89 15 24 42 2b f0    	mov    %edx,0xf02b4224
+f010037a:	ff d3                	call   *%ebx
+f010037c:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010037f:	74 06                	je     f0100387 <cons_intr+0x3b>
+f0100381:	85 c0                	test   %eax,%eax
+f0100383:	75 d2                	jne    f0100357 <cons_intr+0xb>
+f0100385:	eb f3                	jmp    f010037a <cons_intr+0x2e>
+f0100387:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010038a:	c9                   	leave
+f010038b:	c3                   	ret
+
+f010038c <kbd_proc_data>:
+f010038c:	55                   	push   %ebp
+f010038d:	89 e5                	mov    %esp,%ebp
+f010038f:	53                   	push   %ebx
+f0100390:	83 ec 04             	sub    $0x4,%esp
+f0100393:	ba 64 00 00 00       	mov    $0x64,%edx
+f0100398:	ec                   	in     (%dx),%al
+f0100399:	a8 01                	test   $0x1,%al
+f010039b:	0f 84 e6 00 00 00    	je     f0100487 <kbd_proc_data+0xfb>
+f01003a1:	ba 60 00 00 00       	mov    $0x60,%edx
+f01003a6:	ec                   	in     (%dx),%al
+f01003a7:	89 c2                	mov    %eax,%edx
+f01003a9:	3c e0                	cmp    $0xe0,%al
+f01003ab:	74 61                	je     f010040e <kbd_proc_data+0x82>
+f01003ad:	84 c0                	test   %al,%al
+f01003af:	78 70                	js     f0100421 <kbd_proc_data+0x95>
+f01003b1:	8b 0d 00 40 2b f0    	mov    0xf02b4000,%ecx
+f01003b7:	f6 c1 40             	test   $0x40,%cl
+f01003ba:	74 0e                	je     f01003ca <kbd_proc_data+0x3e>
+f01003bc:	83 c8 80             	or     $0xffffff80,%eax
+f01003bf:	89 c2                	mov    %eax,%edx
+f01003c1:	83 e1 bf             	and    $0xffffffbf,%ecx
+f01003c4:	89 0d 00 40 2b f0    	mov    %ecx,0xf02b4000
+f01003ca:	0f b6 d2             	movzbl %dl,%edx
+f01003cd:	0f b6 82 60 d2 10 f0 	movzbl -0xfef2da0(%edx),%eax
+f01003d4:	0b 05 00 40 2b f0    	or     0xf02b4000,%eax
+f01003da:	0f b6 8a 60 d1 10 f0 	movzbl -0xfef2ea0(%edx),%ecx
+f01003e1:	31 c8                	xor    %ecx,%eax
+f01003e3:	a3 00 40 2b f0       	mov    %eax,0xf02b4000
+f01003e8:	89 c1                	mov    %eax,%ecx
+f01003ea:	83 e1 03             	and    $0x3,%ecx
+f01003ed:	8b 0c 8d 40 d1 10 f0 	mov    -0xfef2ec0(,%ecx,4),%ecx
+f01003f4:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f01003f8:	0f b6 da             	movzbl %dl,%ebx
+f01003fb:	a8 08                	test   $0x8,%al
+f01003fd:	74 5d                	je     f010045c <kbd_proc_data+0xd0>
+f01003ff:	89 da                	mov    %ebx,%edx
+f0100401:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f0100404:	83 f9 19             	cmp    $0x19,%ecx
+f0100407:	77 47                	ja     f0100450 <kbd_proc_data+0xc4>
+f0100409:	83 eb 20             	sub    $0x20,%ebx
+f010040c:	eb 0c                	jmp    f010041a <kbd_proc_data+0x8e>
+f010040e:	83 0d 00 40 2b f0 40 	orl    $0x40,0xf02b4000
+f0100415:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010041a:	89 d8                	mov    %ebx,%eax
+f010041c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010041f:	c9                   	leave
+f0100420:	c3                   	ret
+f0100421:	8b 0d 00 40 2b f0    	mov    0xf02b4000,%ecx
+f0100427:	83 e0 7f             	and    $0x7f,%eax
+f010042a:	f6 c1 40             	test   $0x40,%cl
+f010042d:	0f 44 d0             	cmove  %eax,%edx
+f0100430:	0f b6 d2             	movzbl %dl,%edx
+f0100433:	0f b6 82 60 d2 10 f0 	movzbl -0xfef2da0(%edx),%eax
+f010043a:	83 c8 40             	or     $0x40,%eax
+f010043d:	0f b6 c0             	movzbl %al,%eax
+f0100440:	f7 d0                	not    %eax
+f0100442:	21 c8                	and    %ecx,%eax
+f0100444:	a3 00 40 2b f0       	mov    %eax,0xf02b4000
+f0100449:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010044e:	eb ca                	jmp    f010041a <kbd_proc_data+0x8e>
+f0100450:	83 ea 41             	sub    $0x41,%edx
+f0100453:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f0100456:	83 fa 1a             	cmp    $0x1a,%edx
+f0100459:	0f 42 d9             	cmovb  %ecx,%ebx
+f010045c:	f7 d0                	not    %eax
+f010045e:	a8 06                	test   $0x6,%al
+f0100460:	75 b8                	jne    f010041a <kbd_proc_data+0x8e>
+f0100462:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f0100468:	75 b0                	jne    f010041a <kbd_proc_data+0x8e>
+f010046a:	83 ec 0c             	sub    $0xc,%esp
+f010046d:	68 06 d1 10 f0       	push   $0xf010d106
+f0100472:	e8 90 58 00 00       	call   f0105d07 <cprintf>
+f0100477:	b8 03 00 00 00       	mov    $0x3,%eax
+f010047c:	ba 92 00 00 00       	mov    $0x92,%edx
+f0100481:	ee                   	out    %al,(%dx)
+f0100482:	83 c4 10             	add    $0x10,%esp
+f0100485:	eb 93                	jmp    f010041a <kbd_proc_data+0x8e>
+f0100487:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f010048c:	eb 8c                	jmp    f010041a <kbd_proc_data+0x8e>
+
+f010048e <cons_putc>:
+f010048e:	55                   	push   %ebp
+f010048f:	89 e5                	mov    %esp,%ebp
+f0100491:	57                   	push   %edi
+f0100492:	56                   	push   %esi
+f0100493:	53                   	push   %ebx
+f0100494:	83 ec 1c             	sub    $0x1c,%esp
+f0100497:	89 c7                	mov    %eax,%edi
+f0100499:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f010049e:	ec                   	in     (%dx),%al
+f010049f:	a8 20                	test   $0x20,%al
+f01004a1:	75 27                	jne    f01004ca <cons_putc+0x3c>
+f01004a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01004a8:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01004ad:	be fd 03 00 00       	mov    $0x3fd,%esi
+f01004b2:	89 ca                	mov    %ecx,%edx
+f01004b4:	ec                   	in     (%dx),%al
+f01004b5:	ec                   	in     (%dx),%al
+f01004b6:	ec                   	in     (%dx),%al
+f01004b7:	ec                   	in     (%dx),%al
+f01004b8:	83 c3 01             	add    $0x1,%ebx
+f01004bb:	89 f2                	mov    %esi,%edx
+f01004bd:	ec                   	in     (%dx),%al
+f01004be:	a8 20                	test   $0x20,%al
+f01004c0:	75 08                	jne    f01004ca <cons_putc+0x3c>
+f01004c2:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f01004c8:	7e e8                	jle    f01004b2 <cons_putc+0x24>
+f01004ca:	89 f8                	mov    %edi,%eax
+f01004cc:	88 45 e7             	mov    %al,-0x19(%ebp)
+f01004cf:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01004d4:	ee                   	out    %al,(%dx)
+f01004d5:	ba 79 03 00 00       	mov    $0x379,%edx
+f01004da:	ec                   	in     (%dx),%al
+f01004db:	84 c0                	test   %al,%al
+f01004dd:	78 27                	js     f0100506 <cons_putc+0x78>
+f01004df:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01004e4:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01004e9:	be 79 03 00 00       	mov    $0x379,%esi
+f01004ee:	89 ca                	mov    %ecx,%edx
+f01004f0:	ec                   	in     (%dx),%al
+f01004f1:	ec                   	in     (%dx),%al
+f01004f2:	ec                   	in     (%dx),%al
+f01004f3:	ec                   	in     (%dx),%al
+f01004f4:	83 c3 01             	add    $0x1,%ebx
+f01004f7:	89 f2                	mov    %esi,%edx
+f01004f9:	ec                   	in     (%dx),%al
+f01004fa:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100500:	7f 04                	jg     f0100506 <cons_putc+0x78>
+f0100502:	84 c0                	test   %al,%al
+f0100504:	79 e8                	jns    f01004ee <cons_putc+0x60>
+f0100506:	ba 78 03 00 00       	mov    $0x378,%edx
+f010050b:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f010050f:	ee                   	out    %al,(%dx)
+f0100510:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100515:	b8 0d 00 00 00       	mov    $0xd,%eax
+f010051a:	ee                   	out    %al,(%dx)
+f010051b:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100520:	ee                   	out    %al,(%dx)
+f0100521:	89 f8                	mov    %edi,%eax
+f0100523:	80 cc 07             	or     $0x7,%ah
+f0100526:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f010052c:	0f 42 f8             	cmovb  %eax,%edi
+f010052f:	89 f8                	mov    %edi,%eax
+f0100531:	0f b6 c0             	movzbl %al,%eax
+f0100534:	89 fb                	mov    %edi,%ebx
+f0100536:	80 fb 0a             	cmp    $0xa,%bl
+f0100539:	0f 84 e1 00 00 00    	je     f0100620 <cons_putc+0x192>
+f010053f:	83 f8 0a             	cmp    $0xa,%eax
+f0100542:	7f 46                	jg     f010058a <cons_putc+0xfc>
+f0100544:	83 f8 08             	cmp    $0x8,%eax
+f0100547:	0f 84 a7 00 00 00    	je     f01005f4 <cons_putc+0x166>
+f010054d:	83 f8 09             	cmp    $0x9,%eax
+f0100550:	0f 85 d7 00 00 00    	jne    f010062d <cons_putc+0x19f>
+f0100556:	b8 20 00 00 00       	mov    $0x20,%eax
+f010055b:	e8 2e ff ff ff       	call   f010048e <cons_putc>
+f0100560:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100565:	e8 24 ff ff ff       	call   f010048e <cons_putc>
+f010056a:	b8 20 00 00 00       	mov    $0x20,%eax
+f010056f:	e8 1a ff ff ff       	call   f010048e <cons_putc>
+f0100574:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100579:	e8 10 ff ff ff       	call   f010048e <cons_putc>
+f010057e:	b8 20 00 00 00       	mov    $0x20,%eax
+f0100583:	e8 06 ff ff ff       	call   f010048e <cons_putc>
+f0100588:	eb 25                	jmp    f01005af <cons_putc+0x121>
+f010058a:	83 f8 0d             	cmp    $0xd,%eax
+f010058d:	0f 85 9a 00 00 00    	jne    f010062d <cons_putc+0x19f>
+f0100593:	0f b7 05 28 42 2b f0 	movzwl 0xf02b4228,%eax
+f010059a:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f01005a0:	c1 e8 16             	shr    $0x16,%eax
+f01005a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01005a6:	c1 e0 04             	shl    $0x4,%eax
+f01005a9:	66 a3 28 42 2b f0    	mov    %ax,0xf02b4228
+f01005af:	66 81 3d 28 42 2b f0 	cmpw   $0x7cf,0xf02b4228
+f01005b6:	cf 07 
+f01005b8:	0f 87 92 00 00 00    	ja     f0100650 <cons_putc+0x1c2>
+f01005be:	8b 0d 30 42 2b f0    	mov    0xf02b4230,%ecx
+f01005c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01005c9:	89 ca                	mov    %ecx,%edx
+f01005cb:	ee                   	out    %al,(%dx)
+f01005cc:	0f b7 1d 28 42 2b f0 	movzwl 0xf02b4228,%ebx
+f01005d3:	8d 71 01             	lea    0x1(%ecx),%esi
+f01005d6:	89 d8                	mov    %ebx,%eax
+f01005d8:	66 c1 e8 08          	shr    $0x8,%ax
+f01005dc:	89 f2                	mov    %esi,%edx
+f01005de:	ee                   	out    %al,(%dx)
+f01005df:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01005e4:	89 ca                	mov    %ecx,%edx
+f01005e6:	ee                   	out    %al,(%dx)
+f01005e7:	89 d8                	mov    %ebx,%eax
+f01005e9:	89 f2                	mov    %esi,%edx
+f01005eb:	ee                   	out    %al,(%dx)
+f01005ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01005ef:	5b                   	pop    %ebx
+f01005f0:	5e                   	pop    %esi
+f01005f1:	5f                   	pop    %edi
+f01005f2:	5d                   	pop    %ebp
+f01005f3:	c3                   	ret
+f01005f4:	0f b7 05 28 42 2b f0 	movzwl 0xf02b4228,%eax
+f01005fb:	66 85 c0             	test   %ax,%ax
+f01005fe:	74 be                	je     f01005be <cons_putc+0x130>
+f0100600:	83 e8 01             	sub    $0x1,%eax
+f0100603:	66 a3 28 42 2b f0    	mov    %ax,0xf02b4228
+f0100609:	0f b7 c0             	movzwl %ax,%eax
+f010060c:	66 81 e7 00 ff       	and    $0xff00,%di
+f0100611:	83 cf 20             	or     $0x20,%edi
+f0100614:	8b 15 2c 42 2b f0    	mov    0xf02b422c,%edx
+f010061a:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f010061e:	eb 8f                	jmp    f01005af <cons_putc+0x121>
+f0100620:	66 83 05 28 42 2b f0 	addw   $0x50,0xf02b4228
+f0100627:	50 
+f0100628:	e9 66 ff ff ff       	jmp    f0100593 <cons_putc+0x105>
+f010062d:	0f b7 05 28 42 2b f0 	movzwl 0xf02b4228,%eax
+f0100634:	8d 50 01             	lea    0x1(%eax),%edx
+f0100637:	66 89 15 28 42 2b f0 	mov    %dx,0xf02b4228
+f010063e:	0f b7 c0             	movzwl %ax,%eax
+f0100641:	8b 15 2c 42 2b f0    	mov    0xf02b422c,%edx
+f0100647:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f010064b:	e9 5f ff ff ff       	jmp    f01005af <cons_putc+0x121>
+f0100650:	a1 2c 42 2b f0       	mov    0xf02b422c,%eax
+f0100655:	83 ec 04             	sub    $0x4,%esp
+f0100658:	68 00 0f 00 00       	push   $0xf00
+f010065d:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f0100663:	52                   	push   %edx
+f0100664:	50                   	push   %eax
+f0100665:	e8 bf a2 00 00       	call   f010a929 <memmove>
+f010066a:	8b 15 2c 42 2b f0    	mov    0xf02b422c,%edx
+f0100670:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f0100676:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+f010067c:	83 c4 10             	add    $0x10,%esp
+f010067f:	66 c7 00 20 07       	movw   $0x720,(%eax)
+f0100684:	83 c0 02             	add    $0x2,%eax
+f0100687:	39 d0                	cmp    %edx,%eax
+f0100689:	75 f4                	jne    f010067f <cons_putc+0x1f1>
+f010068b:	66 83 2d 28 42 2b f0 	subw   $0x50,0xf02b4228
+f0100692:	50 
+f0100693:	e9 26 ff ff ff       	jmp    f01005be <cons_putc+0x130>
+
+f0100698 <serial_intr>:
+f0100698:	83 3d 34 42 2b f0 00 	cmpl   $0x0,0xf02b4234
+f010069f:	75 01                	jne    f01006a2 <serial_intr+0xa>
+f01006a1:	c3                   	ret
+f01006a2:	55                   	push   %ebp
+f01006a3:	89 e5                	mov    %esp,%ebp
+f01006a5:	83 ec 08             	sub    $0x8,%esp
+f01006a8:	b8 32 03 10 f0       	mov    $0xf0100332,%eax
+f01006ad:	e8 9a fc ff ff       	call   f010034c <cons_intr>
+f01006b2:	c9                   	leave
+f01006b3:	c3                   	ret
+
+f01006b4 <kbd_intr>:
+f01006b4:	55                   	push   %ebp
+f01006b5:	89 e5                	mov    %esp,%ebp
+f01006b7:	83 ec 08             	sub    $0x8,%esp
+f01006ba:	b8 8c 03 10 f0       	mov    $0xf010038c,%eax
+f01006bf:	e8 88 fc ff ff       	call   f010034c <cons_intr>
+f01006c4:	c9                   	leave
+f01006c5:	c3                   	ret
+
+f01006c6 <cons_getc>:
+f01006c6:	55                   	push   %ebp
+f01006c7:	89 e5                	mov    %esp,%ebp
+f01006c9:	83 ec 08             	sub    $0x8,%esp
+f01006cc:	e8 c7 ff ff ff       	call   f0100698 <serial_intr>
+f01006d1:	e8 de ff ff ff       	call   f01006b4 <kbd_intr>
+f01006d6:	a1 20 42 2b f0       	mov    0xf02b4220,%eax
+f01006db:	ba 00 00 00 00       	mov    $0x0,%edx
+f01006e0:	3b 05 24 42 2b f0    	cmp    0xf02b4224,%eax
+f01006e6:	74 1c                	je     f0100704 <cons_getc+0x3e>
+f01006e8:	8d 48 01             	lea    0x1(%eax),%ecx
+f01006eb:	0f b6 90 20 40 2b f0 	movzbl -0xfd4bfe0(%eax),%edx
+f01006f2:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f01006f7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01006fc:	0f 45 c1             	cmovne %ecx,%eax
+f01006ff:	a3 20 42 2b f0       	mov    %eax,0xf02b4220
+f0100704:	89 d0                	mov    %edx,%eax
+f0100706:	c9                   	leave
+f0100707:	c3                   	ret
+
+f0100708 <cons_init>:
+f0100708:	55                   	push   %ebp
+f0100709:	89 e5                	mov    %esp,%ebp
+f010070b:	57                   	push   %edi
+f010070c:	56                   	push   %esi
+f010070d:	53                   	push   %ebx
+f010070e:	83 ec 0c             	sub    $0xc,%esp
+f0100711:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+f0100718:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f010071f:	5a a5 
+f0100721:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f0100728:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+f010072d:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+f0100732:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f0100736:	0f 84 d1 00 00 00    	je     f010080d <cons_init+0x105>
+f010073c:	89 1d 30 42 2b f0    	mov    %ebx,0xf02b4230
+f0100742:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100747:	89 da                	mov    %ebx,%edx
+f0100749:	ee                   	out    %al,(%dx)
+f010074a:	8d 7b 01             	lea    0x1(%ebx),%edi
+f010074d:	89 fa                	mov    %edi,%edx
+f010074f:	ec                   	in     (%dx),%al
+f0100750:	0f b6 c8             	movzbl %al,%ecx
+f0100753:	c1 e1 08             	shl    $0x8,%ecx
+f0100756:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010075b:	89 da                	mov    %ebx,%edx
+f010075d:	ee                   	out    %al,(%dx)
+f010075e:	89 fa                	mov    %edi,%edx
+f0100760:	ec                   	in     (%dx),%al
+f0100761:	89 35 2c 42 2b f0    	mov    %esi,0xf02b422c
+f0100767:	0f b6 c0             	movzbl %al,%eax
+f010076a:	09 c8                	or     %ecx,%eax
+f010076c:	66 a3 28 42 2b f0    	mov    %ax,0xf02b4228
+f0100772:	e8 3d ff ff ff       	call   f01006b4 <kbd_intr>
+f0100777:	83 ec 0c             	sub    $0xc,%esp
+f010077a:	0f b7 05 88 a3 11 f0 	movzwl 0xf011a388,%eax
+f0100781:	25 fd ff 00 00       	and    $0xfffd,%eax
+f0100786:	50                   	push   %eax
+f0100787:	e8 04 54 00 00       	call   f0105b90 <irq_setmask_8259A>
+f010078c:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100791:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f0100796:	89 c8                	mov    %ecx,%eax
+f0100798:	89 da                	mov    %ebx,%edx
+f010079a:	ee                   	out    %al,(%dx)
+f010079b:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f01007a0:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f01007a5:	89 fa                	mov    %edi,%edx
+f01007a7:	ee                   	out    %al,(%dx)
+f01007a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+f01007ad:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01007b2:	ee                   	out    %al,(%dx)
+f01007b3:	be f9 03 00 00       	mov    $0x3f9,%esi
+f01007b8:	89 c8                	mov    %ecx,%eax
+f01007ba:	89 f2                	mov    %esi,%edx
+f01007bc:	ee                   	out    %al,(%dx)
+f01007bd:	b8 03 00 00 00       	mov    $0x3,%eax
+f01007c2:	89 fa                	mov    %edi,%edx
+f01007c4:	ee                   	out    %al,(%dx)
+f01007c5:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f01007ca:	89 c8                	mov    %ecx,%eax
+f01007cc:	ee                   	out    %al,(%dx)
+f01007cd:	b8 01 00 00 00       	mov    $0x1,%eax
+f01007d2:	89 f2                	mov    %esi,%edx
+f01007d4:	ee                   	out    %al,(%dx)
+f01007d5:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01007da:	ec                   	in     (%dx),%al
+f01007db:	89 c1                	mov    %eax,%ecx
+f01007dd:	83 c4 10             	add    $0x10,%esp
+f01007e0:	3c ff                	cmp    $0xff,%al
+f01007e2:	0f 95 c0             	setne  %al
+f01007e5:	0f b6 c0             	movzbl %al,%eax
+f01007e8:	a3 34 42 2b f0       	mov    %eax,0xf02b4234
+f01007ed:	89 da                	mov    %ebx,%edx
+f01007ef:	ec                   	in     (%dx),%al
+f01007f0:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01007f5:	ec                   	in     (%dx),%al
+f01007f6:	80 f9 ff             	cmp    $0xff,%cl
+f01007f9:	75 28                	jne    f0100823 <cons_init+0x11b>
+f01007fb:	83 ec 0c             	sub    $0xc,%esp
+f01007fe:	68 12 d1 10 f0       	push   $0xf010d112
+f0100803:	e8 ff 54 00 00       	call   f0105d07 <cprintf>
+f0100808:	83 c4 10             	add    $0x10,%esp
+f010080b:	eb 37                	jmp    f0100844 <cons_init+0x13c>
+f010080d:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f0100814:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+f0100819:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f010081e:	e9 19 ff ff ff       	jmp    f010073c <cons_init+0x34>
+f0100823:	83 ec 0c             	sub    $0xc,%esp
+f0100826:	0f b7 05 88 a3 11 f0 	movzwl 0xf011a388,%eax
+f010082d:	25 ef ff 00 00       	and    $0xffef,%eax
+f0100832:	50                   	push   %eax
+f0100833:	e8 58 53 00 00       	call   f0105b90 <irq_setmask_8259A>
+f0100838:	83 c4 10             	add    $0x10,%esp
+f010083b:	83 3d 34 42 2b f0 00 	cmpl   $0x0,0xf02b4234
+f0100842:	74 b7                	je     f01007fb <cons_init+0xf3>
+f0100844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100847:	5b                   	pop    %ebx
+f0100848:	5e                   	pop    %esi
+f0100849:	5f                   	pop    %edi
+f010084a:	5d                   	pop    %ebp
+f010084b:	c3                   	ret
+
+f010084c <cputchar>:
+f010084c:	55                   	push   %ebp
+f010084d:	89 e5                	mov    %esp,%ebp
+f010084f:	83 ec 08             	sub    $0x8,%esp
+f0100852:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100855:	e8 34 fc ff ff       	call   f010048e <cons_putc>
+f010085a:	c9                   	leave
+f010085b:	c3                   	ret
+
+f010085c <getchar>:
+f010085c:	55                   	push   %ebp
+f010085d:	89 e5                	mov    %esp,%ebp
+f010085f:	83 ec 08             	sub    $0x8,%esp
+f0100862:	e8 5f fe ff ff       	call   f01006c6 <cons_getc>
+f0100867:	85 c0                	test   %eax,%eax
+f0100869:	74 f7                	je     f0100862 <getchar+0x6>
+f010086b:	c9                   	leave
+f010086c:	c3                   	ret
+
+f010086d <iscons>:
+f010086d:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100872:	c3                   	ret
+
+f0100873 <mon_help>:
+f0100873:	55                   	push   %ebp
+f0100874:	89 e5                	mov    %esp,%ebp
+f0100876:	56                   	push   %esi
+f0100877:	53                   	push   %ebx
+f0100878:	bb e0 d8 10 f0       	mov    $0xf010d8e0,%ebx
+f010087d:	be 58 d9 10 f0       	mov    $0xf010d958,%esi
+f0100882:	83 ec 04             	sub    $0x4,%esp
+f0100885:	ff 73 04             	push   0x4(%ebx)
+f0100888:	ff 33                	push   (%ebx)
+f010088a:	68 60 d3 10 f0       	push   $0xf010d360
+f010088f:	e8 73 54 00 00       	call   f0105d07 <cprintf>
+f0100894:	83 c3 0c             	add    $0xc,%ebx
+f0100897:	83 c4 10             	add    $0x10,%esp
+f010089a:	39 f3                	cmp    %esi,%ebx
+f010089c:	75 e4                	jne    f0100882 <mon_help+0xf>
+f010089e:	b8 00 00 00 00       	mov    $0x0,%eax
+f01008a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01008a6:	5b                   	pop    %ebx
+f01008a7:	5e                   	pop    %esi
+f01008a8:	5d                   	pop    %ebp
+f01008a9:	c3                   	ret
+
+f01008aa <mon_kerninfo>:
+f01008aa:	55                   	push   %ebp
+f01008ab:	89 e5                	mov    %esp,%ebp
+f01008ad:	83 ec 14             	sub    $0x14,%esp
+f01008b0:	68 69 d3 10 f0       	push   $0xf010d369
+f01008b5:	e8 4d 54 00 00       	call   f0105d07 <cprintf>
+f01008ba:	83 c4 0c             	add    $0xc,%esp
+f01008bd:	68 0c 00 10 00       	push   $0x10000c
+f01008c2:	68 0c 00 10 f0       	push   $0xf010000c
+f01008c7:	68 a0 d5 10 f0       	push   $0xf010d5a0
+f01008cc:	e8 36 54 00 00       	call   f0105d07 <cprintf>
+f01008d1:	83 c4 0c             	add    $0xc,%esp
+f01008d4:	68 ff cf 10 00       	push   $0x10cfff
+f01008d9:	68 ff cf 10 f0       	push   $0xf010cfff
+f01008de:	68 c4 d5 10 f0       	push   $0xf010d5c4
+f01008e3:	e8 1f 54 00 00       	call   f0105d07 <cprintf>
+f01008e8:	83 c4 0c             	add    $0xc,%esp
+f01008eb:	68 dc 3b 2b 00       	push   $0x2b3bdc
+f01008f0:	68 dc 3b 2b f0       	push   $0xf02b3bdc
+f01008f5:	68 e8 d5 10 f0       	push   $0xf010d5e8
+f01008fa:	e8 08 54 00 00       	call   f0105d07 <cprintf>
+f01008ff:	83 c4 0c             	add    $0xc,%esp
+f0100902:	68 ac b4 32 00       	push   $0x32b4ac
+f0100907:	68 ac b4 32 f0       	push   $0xf032b4ac
+f010090c:	68 0c d6 10 f0       	push   $0xf010d60c
+f0100911:	e8 f1 53 00 00       	call   f0105d07 <cprintf>
+f0100916:	83 c4 08             	add    $0x8,%esp
+f0100919:	ba ac b4 32 f0       	mov    $0xf032b4ac,%edx
+f010091e:	89 d0                	mov    %edx,%eax
+f0100920:	2d 0e f8 0f f0       	sub    $0xf00ff80e,%eax
+f0100925:	81 ea 0d fc 0f f0    	sub    $0xf00ffc0d,%edx
+f010092b:	0f 49 c2             	cmovns %edx,%eax
+f010092e:	c1 f8 0a             	sar    $0xa,%eax
+f0100931:	50                   	push   %eax
+f0100932:	68 30 d6 10 f0       	push   $0xf010d630
+f0100937:	e8 cb 53 00 00       	call   f0105d07 <cprintf>
+f010093c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100941:	c9                   	leave
+f0100942:	c3                   	ret
+
+f0100943 <mon_step>:
+f0100943:	55                   	push   %ebp
+f0100944:	89 e5                	mov    %esp,%ebp
+f0100946:	83 ec 08             	sub    $0x8,%esp
+f0100949:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f010094d:	75 1d                	jne    f010096c <mon_step+0x29>
+f010094f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0100953:	75 2e                	jne    f0100983 <mon_step+0x40>
+f0100955:	83 ec 0c             	sub    $0xc,%esp
+f0100958:	68 5c d6 10 f0       	push   $0xf010d65c
+f010095d:	e8 a5 53 00 00       	call   f0105d07 <cprintf>
+f0100962:	83 c4 10             	add    $0x10,%esp
+f0100965:	b8 00 00 00 00       	mov    $0x0,%eax
+f010096a:	c9                   	leave
+f010096b:	c3                   	ret
+f010096c:	83 ec 0c             	sub    $0xc,%esp
+f010096f:	68 82 d3 10 f0       	push   $0xf010d382
+f0100974:	e8 8e 53 00 00       	call   f0105d07 <cprintf>
+f0100979:	83 c4 10             	add    $0x10,%esp
+f010097c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100981:	eb e7                	jmp    f010096a <mon_step+0x27>
+f0100983:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100986:	81 48 38 00 01 00 00 	orl    $0x100,0x38(%eax)
+f010098d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0100992:	eb d6                	jmp    f010096a <mon_step+0x27>
+
+f0100994 <mon_continue>:
+f0100994:	55                   	push   %ebp
+f0100995:	89 e5                	mov    %esp,%ebp
+f0100997:	83 ec 08             	sub    $0x8,%esp
+f010099a:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f010099e:	75 1d                	jne    f01009bd <mon_continue+0x29>
+f01009a0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01009a4:	75 2e                	jne    f01009d4 <mon_continue+0x40>
+f01009a6:	83 ec 0c             	sub    $0xc,%esp
+f01009a9:	68 90 d6 10 f0       	push   $0xf010d690
+f01009ae:	e8 54 53 00 00       	call   f0105d07 <cprintf>
+f01009b3:	83 c4 10             	add    $0x10,%esp
+f01009b6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01009bb:	c9                   	leave
+f01009bc:	c3                   	ret
+f01009bd:	83 ec 0c             	sub    $0xc,%esp
+f01009c0:	68 82 d3 10 f0       	push   $0xf010d382
+f01009c5:	e8 3d 53 00 00       	call   f0105d07 <cprintf>
+f01009ca:	83 c4 10             	add    $0x10,%esp
+f01009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+f01009d2:	eb e7                	jmp    f01009bb <mon_continue+0x27>
+f01009d4:	8b 45 10             	mov    0x10(%ebp),%eax
+f01009d7:	81 60 38 ff fe ff ff 	andl   $0xfffffeff,0x38(%eax)
+f01009de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01009e3:	eb d6                	jmp    f01009bb <mon_continue+0x27>
+
+f01009e5 <mon_backtrace>:
+f01009e5:	55                   	push   %ebp
+f01009e6:	89 e5                	mov    %esp,%ebp
+f01009e8:	57                   	push   %edi
+f01009e9:	56                   	push   %esi
+f01009ea:	53                   	push   %ebx
+f01009eb:	83 ec 38             	sub    $0x38,%esp
+f01009ee:	68 92 d3 10 f0       	push   $0xf010d392
+f01009f3:	e8 0f 53 00 00       	call   f0105d07 <cprintf>
+f01009f8:	89 e8                	mov    %ebp,%eax
+f01009fa:	89 c6                	mov    %eax,%esi
+f01009fc:	83 c4 10             	add    $0x10,%esp
+f01009ff:	85 c0                	test   %eax,%eax
+f0100a01:	75 6b                	jne    f0100a6e <mon_backtrace+0x89>
+f0100a03:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100a08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100a0b:	5b                   	pop    %ebx
+f0100a0c:	5e                   	pop    %esi
+f0100a0d:	5f                   	pop    %edi
+f0100a0e:	5d                   	pop    %ebp
+f0100a0f:	c3                   	ret
+f0100a10:	83 ec 08             	sub    $0x8,%esp
+f0100a13:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0100a16:	50                   	push   %eax
+f0100a17:	ff 76 04             	push   0x4(%esi)
+f0100a1a:	e8 96 92 00 00       	call   f0109cb5 <debuginfo_eip>
+f0100a1f:	83 c4 0c             	add    $0xc,%esp
+f0100a22:	ff 75 d4             	push   -0x2c(%ebp)
+f0100a25:	ff 75 d0             	push   -0x30(%ebp)
+f0100a28:	68 c1 d3 10 f0       	push   $0xf010d3c1
+f0100a2d:	e8 d5 52 00 00       	call   f0105d07 <cprintf>
+f0100a32:	83 c4 0c             	add    $0xc,%esp
+f0100a35:	ff 75 d8             	push   -0x28(%ebp)
+f0100a38:	ff 75 dc             	push   -0x24(%ebp)
+f0100a3b:	68 d2 d3 10 f0       	push   $0xf010d3d2
+f0100a40:	e8 c2 52 00 00       	call   f0105d07 <cprintf>
+f0100a45:	83 c4 08             	add    $0x8,%esp
+f0100a48:	8b 46 04             	mov    0x4(%esi),%eax
+f0100a4b:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f0100a4e:	50                   	push   %eax
+f0100a4f:	68 d7 d3 10 f0       	push   $0xf010d3d7
+f0100a54:	e8 ae 52 00 00       	call   f0105d07 <cprintf>
+f0100a59:	c7 04 24 0e e5 10 f0 	movl   $0xf010e50e,(%esp)
+f0100a60:	e8 a2 52 00 00       	call   f0105d07 <cprintf>
+f0100a65:	8b 36                	mov    (%esi),%esi
+f0100a67:	83 c4 10             	add    $0x10,%esp
+f0100a6a:	85 f6                	test   %esi,%esi
+f0100a6c:	74 95                	je     f0100a03 <mon_backtrace+0x1e>
+f0100a6e:	83 ec 08             	sub    $0x8,%esp
+f0100a71:	56                   	push   %esi
+f0100a72:	68 a4 d3 10 f0       	push   $0xf010d3a4
+f0100a77:	e8 8b 52 00 00       	call   f0105d07 <cprintf>
+f0100a7c:	83 c4 08             	add    $0x8,%esp
+f0100a7f:	ff 76 04             	push   0x4(%esi)
+f0100a82:	68 af d3 10 f0       	push   $0xf010d3af
+f0100a87:	e8 7b 52 00 00       	call   f0105d07 <cprintf>
+f0100a8c:	c7 04 24 ba d3 10 f0 	movl   $0xf010d3ba,(%esp)
+f0100a93:	e8 6f 52 00 00       	call   f0105d07 <cprintf>
+f0100a98:	8d 5e 08             	lea    0x8(%esi),%ebx
+f0100a9b:	8d 7e 1c             	lea    0x1c(%esi),%edi
+f0100a9e:	83 c4 10             	add    $0x10,%esp
+f0100aa1:	83 ec 08             	sub    $0x8,%esp
+f0100aa4:	ff 33                	push   (%ebx)
+f0100aa6:	68 a9 d3 10 f0       	push   $0xf010d3a9
+f0100aab:	e8 57 52 00 00       	call   f0105d07 <cprintf>
+f0100ab0:	83 c3 04             	add    $0x4,%ebx
+f0100ab3:	83 c4 10             	add    $0x10,%esp
+f0100ab6:	39 fb                	cmp    %edi,%ebx
+f0100ab8:	75 e7                	jne    f0100aa1 <mon_backtrace+0xbc>
+f0100aba:	e9 51 ff ff ff       	jmp    f0100a10 <mon_backtrace+0x2b>
+
+f0100abf <mon_showmappings>:
+f0100abf:	55                   	push   %ebp
+f0100ac0:	89 e5                	mov    %esp,%ebp
+f0100ac2:	56                   	push   %esi
+f0100ac3:	53                   	push   %ebx
+f0100ac4:	8b 75 08             	mov    0x8(%ebp),%esi
+f0100ac7:	8d 46 fe             	lea    -0x2(%esi),%eax
+f0100aca:	83 f8 01             	cmp    $0x1,%eax
+f0100acd:	77 4d                	ja     f0100b1c <mon_showmappings+0x5d>
+f0100acf:	83 ec 0c             	sub    $0xc,%esp
+f0100ad2:	68 db d3 10 f0       	push   $0xf010d3db
+f0100ad7:	e8 2b 52 00 00       	call   f0105d07 <cprintf>
+f0100adc:	83 c4 0c             	add    $0xc,%esp
+f0100adf:	6a 10                	push   $0x10
+f0100ae1:	6a 00                	push   $0x0
+f0100ae3:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100ae6:	ff 70 04             	push   0x4(%eax)
+f0100ae9:	e8 1e 9f 00 00       	call   f010aa0c <strtol>
+f0100aee:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100af3:	89 c3                	mov    %eax,%ebx
+f0100af5:	83 c4 10             	add    $0x10,%esp
+f0100af8:	83 fe 02             	cmp    $0x2,%esi
+f0100afb:	75 3b                	jne    f0100b38 <mon_showmappings+0x79>
+f0100afd:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+f0100b03:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0100b09:	3d 00 f0 ff ff       	cmp    $0xfffff000,%eax
+f0100b0e:	b8 00 f0 ff ff       	mov    $0xfffff000,%eax
+f0100b13:	0f 47 f0             	cmova  %eax,%esi
+f0100b16:	39 de                	cmp    %ebx,%esi
+f0100b18:	73 60                	jae    f0100b7a <mon_showmappings+0xbb>
+f0100b1a:	eb 10                	jmp    f0100b2c <mon_showmappings+0x6d>
+f0100b1c:	83 ec 0c             	sub    $0xc,%esp
+f0100b1f:	68 82 d3 10 f0       	push   $0xf010d382
+f0100b24:	e8 de 51 00 00       	call   f0105d07 <cprintf>
+f0100b29:	83 c4 10             	add    $0x10,%esp
+f0100b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100b31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100b34:	5b                   	pop    %ebx
+f0100b35:	5e                   	pop    %esi
+f0100b36:	5d                   	pop    %ebp
+f0100b37:	c3                   	ret
+f0100b38:	83 ec 04             	sub    $0x4,%esp
+f0100b3b:	6a 10                	push   $0x10
+f0100b3d:	6a 00                	push   $0x0
+f0100b3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100b42:	ff 70 08             	push   0x8(%eax)
+f0100b45:	e8 c2 9e 00 00       	call   f010aa0c <strtol>
+f0100b4a:	83 c4 10             	add    $0x10,%esp
+f0100b4d:	eb ae                	jmp    f0100afd <mon_showmappings+0x3e>
+f0100b4f:	83 ec 08             	sub    $0x8,%esp
+f0100b52:	6a 2d                	push   $0x2d
+f0100b54:	6a 2d                	push   $0x2d
+f0100b56:	6a 2d                	push   $0x2d
+f0100b58:	6a 2d                	push   $0x2d
+f0100b5a:	53                   	push   %ebx
+f0100b5b:	68 10 d4 10 f0       	push   $0xf010d410
+f0100b60:	e8 a2 51 00 00       	call   f0105d07 <cprintf>
+f0100b65:	83 c4 20             	add    $0x20,%esp
+f0100b68:	81 fb 00 f0 ff ff    	cmp    $0xfffff000,%ebx
+f0100b6e:	74 bc                	je     f0100b2c <mon_showmappings+0x6d>
+f0100b70:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0100b76:	39 de                	cmp    %ebx,%esi
+f0100b78:	72 b2                	jb     f0100b2c <mon_showmappings+0x6d>
+f0100b7a:	83 ec 04             	sub    $0x4,%esp
+f0100b7d:	6a 00                	push   $0x0
+f0100b7f:	53                   	push   %ebx
+f0100b80:	68 00 d0 7b ef       	push   $0xef7bd000
+f0100b85:	e8 82 13 00 00       	call   f0101f0c <pgdir_walk>
+f0100b8a:	83 c4 10             	add    $0x10,%esp
+f0100b8d:	85 c0                	test   %eax,%eax
+f0100b8f:	74 be                	je     f0100b4f <mon_showmappings+0x90>
+f0100b91:	8b 00                	mov    (%eax),%eax
+f0100b93:	83 ec 08             	sub    $0x8,%esp
+f0100b96:	89 c2                	mov    %eax,%edx
+f0100b98:	83 e2 01             	and    $0x1,%edx
+f0100b9b:	52                   	push   %edx
+f0100b9c:	89 c2                	mov    %eax,%edx
+f0100b9e:	d1 ea                	shr    %edx
+f0100ba0:	83 e2 01             	and    $0x1,%edx
+f0100ba3:	52                   	push   %edx
+f0100ba4:	89 c2                	mov    %eax,%edx
+f0100ba6:	c1 ea 02             	shr    $0x2,%edx
+f0100ba9:	83 e2 01             	and    $0x1,%edx
+f0100bac:	52                   	push   %edx
+f0100bad:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100bb2:	50                   	push   %eax
+f0100bb3:	53                   	push   %ebx
+f0100bb4:	68 f8 d3 10 f0       	push   $0xf010d3f8
+f0100bb9:	e8 49 51 00 00       	call   f0105d07 <cprintf>
+f0100bbe:	83 c4 20             	add    $0x20,%esp
+f0100bc1:	eb a5                	jmp    f0100b68 <mon_showmappings+0xa9>
+
+f0100bc3 <mon_examine>:
+f0100bc3:	55                   	push   %ebp
+f0100bc4:	89 e5                	mov    %esp,%ebp
+f0100bc6:	56                   	push   %esi
+f0100bc7:	53                   	push   %ebx
+f0100bc8:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0100bcc:	74 1c                	je     f0100bea <mon_examine+0x27>
+f0100bce:	83 ec 0c             	sub    $0xc,%esp
+f0100bd1:	68 82 d3 10 f0       	push   $0xf010d382
+f0100bd6:	e8 2c 51 00 00       	call   f0105d07 <cprintf>
+f0100bdb:	83 c4 10             	add    $0x10,%esp
+f0100bde:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100be6:	5b                   	pop    %ebx
+f0100be7:	5e                   	pop    %esi
+f0100be8:	5d                   	pop    %ebp
+f0100be9:	c3                   	ret
+f0100bea:	83 ec 04             	sub    $0x4,%esp
+f0100bed:	6a 10                	push   $0x10
+f0100bef:	6a 00                	push   $0x0
+f0100bf1:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100bf4:	ff 70 04             	push   0x4(%eax)
+f0100bf7:	e8 10 9e 00 00       	call   f010aa0c <strtol>
+f0100bfc:	89 c3                	mov    %eax,%ebx
+f0100bfe:	83 c4 0c             	add    $0xc,%esp
+f0100c01:	6a 10                	push   $0x10
+f0100c03:	6a 00                	push   $0x0
+f0100c05:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100c08:	ff 70 08             	push   0x8(%eax)
+f0100c0b:	e8 fc 9d 00 00       	call   f010aa0c <strtol>
+f0100c10:	89 c6                	mov    %eax,%esi
+f0100c12:	83 c4 10             	add    $0x10,%esp
+f0100c15:	85 c0                	test   %eax,%eax
+f0100c17:	75 4a                	jne    f0100c63 <mon_examine+0xa0>
+f0100c19:	eb c3                	jmp    f0100bde <mon_examine+0x1b>
+f0100c1b:	83 ec 04             	sub    $0x4,%esp
+f0100c1e:	68 2e d4 10 f0       	push   $0xf010d42e
+f0100c23:	53                   	push   %ebx
+f0100c24:	68 40 d4 10 f0       	push   $0xf010d440
+f0100c29:	e8 d9 50 00 00       	call   f0105d07 <cprintf>
+f0100c2e:	89 d8                	mov    %ebx,%eax
+f0100c30:	83 c4 10             	add    $0x10,%esp
+f0100c33:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+f0100c39:	76 56                	jbe    f0100c91 <mon_examine+0xce>
+f0100c3b:	81 fb ff ef ff ff    	cmp    $0xffffefff,%ebx
+f0100c41:	77 4e                	ja     f0100c91 <mon_examine+0xce>
+f0100c43:	8d 93 ff 0f 00 00    	lea    0xfff(%ebx),%edx
+f0100c49:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100c4f:	89 d3                	mov    %edx,%ebx
+f0100c51:	01 f0                	add    %esi,%eax
+f0100c53:	29 d0                	sub    %edx,%eax
+f0100c55:	89 c6                	mov    %eax,%esi
+f0100c57:	83 c3 01             	add    $0x1,%ebx
+f0100c5a:	83 ee 01             	sub    $0x1,%esi
+f0100c5d:	0f 84 7b ff ff ff    	je     f0100bde <mon_examine+0x1b>
+f0100c63:	83 ec 04             	sub    $0x4,%esp
+f0100c66:	6a 00                	push   $0x0
+f0100c68:	53                   	push   %ebx
+f0100c69:	68 00 d0 7b ef       	push   $0xef7bd000
+f0100c6e:	e8 99 12 00 00       	call   f0101f0c <pgdir_walk>
+f0100c73:	83 c4 10             	add    $0x10,%esp
+f0100c76:	85 c0                	test   %eax,%eax
+f0100c78:	74 a1                	je     f0100c1b <mon_examine+0x58>
+f0100c7a:	83 ec 04             	sub    $0x4,%esp
+f0100c7d:	0f b6 03             	movzbl (%ebx),%eax
+f0100c80:	50                   	push   %eax
+f0100c81:	53                   	push   %ebx
+f0100c82:	68 48 d4 10 f0       	push   $0xf010d448
+f0100c87:	e8 7b 50 00 00       	call   f0105d07 <cprintf>
+f0100c8c:	83 c4 10             	add    $0x10,%esp
+f0100c8f:	eb c6                	jmp    f0100c57 <mon_examine+0x94>
+f0100c91:	83 ec 0c             	sub    $0xc,%esp
+f0100c94:	68 c4 d6 10 f0       	push   $0xf010d6c4
+f0100c99:	e8 69 50 00 00       	call   f0105d07 <cprintf>
+f0100c9e:	83 c4 10             	add    $0x10,%esp
+f0100ca1:	e9 38 ff ff ff       	jmp    f0100bde <mon_examine+0x1b>
+
+f0100ca6 <mon_setpgperms>:
+f0100ca6:	55                   	push   %ebp
+f0100ca7:	89 e5                	mov    %esp,%ebp
+f0100ca9:	57                   	push   %edi
+f0100caa:	56                   	push   %esi
+f0100cab:	53                   	push   %ebx
+f0100cac:	83 ec 1c             	sub    $0x1c,%esp
+f0100caf:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0100cb3:	74 1d                	je     f0100cd2 <mon_setpgperms+0x2c>
+f0100cb5:	83 ec 0c             	sub    $0xc,%esp
+f0100cb8:	68 82 d3 10 f0       	push   $0xf010d382
+f0100cbd:	e8 45 50 00 00       	call   f0105d07 <cprintf>
+f0100cc2:	83 c4 10             	add    $0x10,%esp
+f0100cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100ccd:	5b                   	pop    %ebx
+f0100cce:	5e                   	pop    %esi
+f0100ccf:	5f                   	pop    %edi
+f0100cd0:	5d                   	pop    %ebp
+f0100cd1:	c3                   	ret
+f0100cd2:	83 ec 04             	sub    $0x4,%esp
+f0100cd5:	6a 10                	push   $0x10
+f0100cd7:	6a 00                	push   $0x0
+f0100cd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100cdc:	ff 70 04             	push   0x4(%eax)
+f0100cdf:	e8 28 9d 00 00       	call   f010aa0c <strtol>
+f0100ce4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100ce9:	89 c6                	mov    %eax,%esi
+f0100ceb:	83 c4 0c             	add    $0xc,%esp
+f0100cee:	6a 00                	push   $0x0
+f0100cf0:	50                   	push   %eax
+f0100cf1:	68 00 d0 7b ef       	push   $0xef7bd000
+f0100cf6:	e8 11 12 00 00       	call   f0101f0c <pgdir_walk>
+f0100cfb:	89 c3                	mov    %eax,%ebx
+f0100cfd:	83 c4 10             	add    $0x10,%esp
+f0100d00:	85 c0                	test   %eax,%eax
+f0100d02:	74 26                	je     f0100d2a <mon_setpgperms+0x84>
+f0100d04:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100d07:	8b 70 08             	mov    0x8(%eax),%esi
+f0100d0a:	83 ec 0c             	sub    $0xc,%esp
+f0100d0d:	56                   	push   %esi
+f0100d0e:	e8 1a 9a 00 00       	call   f010a72d <strlen>
+f0100d13:	89 c7                	mov    %eax,%edi
+f0100d15:	8d 04 06             	lea    (%esi,%eax,1),%eax
+f0100d18:	83 c4 10             	add    $0x10,%esp
+f0100d1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100d20:	ba 00 00 00 00       	mov    $0x0,%edx
+f0100d25:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f0100d28:	eb 31                	jmp    f0100d5b <mon_setpgperms+0xb5>
+f0100d2a:	83 ec 08             	sub    $0x8,%esp
+f0100d2d:	56                   	push   %esi
+f0100d2e:	68 50 d4 10 f0       	push   $0xf010d450
+f0100d33:	e8 cf 4f 00 00       	call   f0105d07 <cprintf>
+f0100d38:	83 c4 10             	add    $0x10,%esp
+f0100d3b:	eb 88                	jmp    f0100cc5 <mon_setpgperms+0x1f>
+f0100d3d:	be 01 00 00 00       	mov    $0x1,%esi
+f0100d42:	d3 e6                	shl    %cl,%esi
+f0100d44:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0100d47:	23 33                	and    (%ebx),%esi
+f0100d49:	0f 95 c3             	setne  %bl
+f0100d4c:	89 de                	mov    %ebx,%esi
+f0100d4e:	09 f2                	or     %esi,%edx
+f0100d50:	83 c1 01             	add    $0x1,%ecx
+f0100d53:	83 e8 01             	sub    $0x1,%eax
+f0100d56:	83 f9 03             	cmp    $0x3,%ecx
+f0100d59:	74 1f                	je     f0100d7a <mon_setpgperms+0xd4>
+f0100d5b:	39 cf                	cmp    %ecx,%edi
+f0100d5d:	7e de                	jle    f0100d3d <mon_setpgperms+0x97>
+f0100d5f:	0f b6 70 ff          	movzbl -0x1(%eax),%esi
+f0100d63:	89 f3                	mov    %esi,%ebx
+f0100d65:	80 fb 30             	cmp    $0x30,%bl
+f0100d68:	74 e6                	je     f0100d50 <mon_setpgperms+0xaa>
+f0100d6a:	80 fb 31             	cmp    $0x31,%bl
+f0100d6d:	75 ce                	jne    f0100d3d <mon_setpgperms+0x97>
+f0100d6f:	be 01 00 00 00       	mov    $0x1,%esi
+f0100d74:	d3 e6                	shl    %cl,%esi
+f0100d76:	09 f2                	or     %esi,%edx
+f0100d78:	eb d6                	jmp    f0100d50 <mon_setpgperms+0xaa>
+f0100d7a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0100d7d:	8b 03                	mov    (%ebx),%eax
+f0100d7f:	83 e0 fc             	and    $0xfffffffc,%eax
+f0100d82:	0f b6 d2             	movzbl %dl,%edx
+f0100d85:	09 d0                	or     %edx,%eax
+f0100d87:	89 03                	mov    %eax,(%ebx)
+f0100d89:	e9 37 ff ff ff       	jmp    f0100cc5 <mon_setpgperms+0x1f>
+
+f0100d8e <mon_prof>:
+f0100d8e:	55                   	push   %ebp
+f0100d8f:	89 e5                	mov    %esp,%ebp
+f0100d91:	57                   	push   %edi
+f0100d92:	56                   	push   %esi
+f0100d93:	53                   	push   %ebx
+f0100d94:	83 ec 0c             	sub    $0xc,%esp
+f0100d97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0100d9a:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0100d9d:	83 fb 01             	cmp    $0x1,%ebx
+f0100da0:	74 3f                	je     f0100de1 <mon_prof+0x53>
+f0100da2:	83 ec 08             	sub    $0x8,%esp
+f0100da5:	68 eb e9 10 f0       	push   $0xf010e9eb
+f0100daa:	ff 76 04             	push   0x4(%esi)
+f0100dad:	e8 77 9a 00 00       	call   f010a829 <strcmp>
+f0100db2:	83 c4 10             	add    $0x10,%esp
+f0100db5:	85 c0                	test   %eax,%eax
+f0100db7:	0f 85 a0 00 00 00    	jne    f0100e5d <mon_prof+0xcf>
+f0100dbd:	83 fb 02             	cmp    $0x2,%ebx
+f0100dc0:	7f 6d                	jg     f0100e2f <mon_prof+0xa1>
+f0100dc2:	83 ec 08             	sub    $0x8,%esp
+f0100dc5:	50                   	push   %eax
+f0100dc6:	6a 00                	push   $0x0
+f0100dc8:	e8 f2 b8 00 00       	call   f010c6bf <prof_ctl>
+f0100dcd:	83 c4 10             	add    $0x10,%esp
+f0100dd0:	85 c0                	test   %eax,%eax
+f0100dd2:	78 72                	js     f0100e46 <mon_prof+0xb8>
+f0100dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100ddc:	5b                   	pop    %ebx
+f0100ddd:	5e                   	pop    %esi
+f0100dde:	5f                   	pop    %edi
+f0100ddf:	5d                   	pop    %ebp
+f0100de0:	c3                   	ret
+f0100de1:	83 ec 08             	sub    $0x8,%esp
+f0100de4:	6a 14                	push   $0x14
+f0100de6:	68 40 42 2b f0       	push   $0xf02b4240
+f0100deb:	e8 82 b9 00 00       	call   f010c772 <prof_report>
+f0100df0:	89 c7                	mov    %eax,%edi
+f0100df2:	c7 04 24 ec d6 10 f0 	movl   $0xf010d6ec,(%esp)
+f0100df9:	e8 09 4f 00 00       	call   f0105d07 <cprintf>
+f0100dfe:	83 c4 10             	add    $0x10,%esp
+f0100e01:	85 ff                	test   %edi,%edi
+f0100e03:	7e cf                	jle    f0100dd4 <mon_prof+0x46>
+f0100e05:	bb 4c 42 2b f0       	mov    $0xf02b424c,%ebx
+f0100e0a:	be 00 00 00 00       	mov    $0x0,%esi
+f0100e0f:	53                   	push   %ebx
+f0100e10:	ff 73 f4             	push   -0xc(%ebx)
+f0100e13:	ff 73 fc             	push   -0x4(%ebx)
+f0100e16:	68 6c d4 10 f0       	push   $0xf010d46c
+f0100e1b:	e8 e7 4e 00 00       	call   f0105d07 <cprintf>
+f0100e20:	83 c6 01             	add    $0x1,%esi
+f0100e23:	83 c3 2c             	add    $0x2c,%ebx
+f0100e26:	83 c4 10             	add    $0x10,%esp
+f0100e29:	39 f7                	cmp    %esi,%edi
+f0100e2b:	75 e2                	jne    f0100e0f <mon_prof+0x81>
+f0100e2d:	eb a5                	jmp    f0100dd4 <mon_prof+0x46>
+f0100e2f:	83 ec 04             	sub    $0x4,%esp
+f0100e32:	6a 00                	push   $0x0
+f0100e34:	6a 00                	push   $0x0
+f0100e36:	ff 76 08             	push   0x8(%esi)
+f0100e39:	e8 ce 9b 00 00       	call   f010aa0c <strtol>
+f0100e3e:	83 c4 10             	add    $0x10,%esp
+f0100e41:	e9 7c ff ff ff       	jmp    f0100dc2 <mon_prof+0x34>
+f0100e46:	83 ec 08             	sub    $0x8,%esp
+f0100e49:	6a 04                	push   $0x4
+f0100e4b:	68 7d d4 10 f0       	push   $0xf010d47d
+f0100e50:	e8 b2 4e 00 00       	call   f0105d07 <cprintf>
+f0100e55:	83 c4 10             	add    $0x10,%esp
+f0100e58:	e9 77 ff ff ff       	jmp    f0100dd4 <mon_prof+0x46>
+f0100e5d:	83 ec 08             	sub    $0x8,%esp
+f0100e60:	68 97 d4 10 f0       	push   $0xf010d497
+f0100e65:	ff 76 04             	push   0x4(%esi)
+f0100e68:	e8 bc 99 00 00       	call   f010a829 <strcmp>
+f0100e6d:	83 c4 10             	add    $0x10,%esp
+f0100e70:	85 c0                	test   %eax,%eax
+f0100e72:	75 14                	jne    f0100e88 <mon_prof+0xfa>
+f0100e74:	83 ec 08             	sub    $0x8,%esp
+f0100e77:	6a 00                	push   $0x0
+f0100e79:	6a 01                	push   $0x1
+f0100e7b:	e8 3f b8 00 00       	call   f010c6bf <prof_ctl>
+f0100e80:	83 c4 10             	add    $0x10,%esp
+f0100e83:	e9 4c ff ff ff       	jmp    f0100dd4 <mon_prof+0x46>
+f0100e88:	83 ec 08             	sub    $0x8,%esp
+f0100e8b:	68 9b d4 10 f0       	push   $0xf010d49b
+f0100e90:	ff 76 04             	push   0x4(%esi)
+f0100e93:	e8 91 99 00 00       	call   f010a829 <strcmp>
+f0100e98:	83 c4 10             	add    $0x10,%esp
+f0100e9b:	85 c0                	test   %eax,%eax
+f0100e9d:	75 14                	jne    f0100eb3 <mon_prof+0x125>
+f0100e9f:	83 ec 08             	sub    $0x8,%esp
+f0100ea2:	6a 00                	push   $0x0
+f0100ea4:	6a 02                	push   $0x2
+f0100ea6:	e8 14 b8 00 00       	call   f010c6bf <prof_ctl>
+f0100eab:	83 c4 10             	add    $0x10,%esp
+f0100eae:	e9 21 ff ff ff       	jmp    f0100dd4 <mon_prof+0x46>
+f0100eb3:	83 ec 08             	sub    $0x8,%esp
+f0100eb6:	68 a1 d4 10 f0       	push   $0xf010d4a1
+f0100ebb:	ff 76 04             	push   0x4(%esi)
+f0100ebe:	e8 66 99 00 00       	call   f010a829 <strcmp>
+f0100ec3:	83 c4 10             	add    $0x10,%esp
+f0100ec6:	85 c0                	test   %eax,%eax
+f0100ec8:	75 2f                	jne    f0100ef9 <mon_prof+0x16b>
+f0100eca:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0100ecf:	83 fb 02             	cmp    $0x2,%ebx
+f0100ed2:	7f 11                	jg     f0100ee5 <mon_prof+0x157>
+f0100ed4:	83 ec 0c             	sub    $0xc,%esp
+f0100ed7:	50                   	push   %eax
+f0100ed8:	e8 2f bb 00 00       	call   f010ca0c <prof_print_recent>
+f0100edd:	83 c4 10             	add    $0x10,%esp
+f0100ee0:	e9 ef fe ff ff       	jmp    f0100dd4 <mon_prof+0x46>
+f0100ee5:	83 ec 04             	sub    $0x4,%esp
+f0100ee8:	6a 00                	push   $0x0
+f0100eea:	6a 00                	push   $0x0
+f0100eec:	ff 76 08             	push   0x8(%esi)
+f0100eef:	e8 18 9b 00 00       	call   f010aa0c <strtol>
+f0100ef4:	83 c4 10             	add    $0x10,%esp
+f0100ef7:	eb db                	jmp    f0100ed4 <mon_prof+0x146>
+f0100ef9:	83 ec 0c             	sub    $0xc,%esp
+f0100efc:	68 0c d7 10 f0       	push   $0xf010d70c
+f0100f01:	e8 01 4e 00 00       	call   f0105d07 <cprintf>
+f0100f06:	83 c4 10             	add    $0x10,%esp
+f0100f09:	e9 c6 fe ff ff       	jmp    f0100dd4 <mon_prof+0x46>
+
+f0100f0e <mon_examinep>:
+f0100f0e:	55                   	push   %ebp
+f0100f0f:	89 e5                	mov    %esp,%ebp
+f0100f11:	57                   	push   %edi
+f0100f12:	56                   	push   %esi
+f0100f13:	53                   	push   %ebx
+f0100f14:	83 ec 1c             	sub    $0x1c,%esp
+f0100f17:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0100f1a:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0100f1e:	74 1d                	je     f0100f3d <mon_examinep+0x2f>
+f0100f20:	83 ec 0c             	sub    $0xc,%esp
+f0100f23:	68 82 d3 10 f0       	push   $0xf010d382
+f0100f28:	e8 da 4d 00 00       	call   f0105d07 <cprintf>
+f0100f2d:	83 c4 10             	add    $0x10,%esp
+f0100f30:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100f38:	5b                   	pop    %ebx
+f0100f39:	5e                   	pop    %esi
+f0100f3a:	5f                   	pop    %edi
+f0100f3b:	5d                   	pop    %ebp
+f0100f3c:	c3                   	ret
+f0100f3d:	83 ec 04             	sub    $0x4,%esp
+f0100f40:	6a 10                	push   $0x10
+f0100f42:	6a 00                	push   $0x0
+f0100f44:	ff 76 04             	push   0x4(%esi)
+f0100f47:	e8 c0 9a 00 00       	call   f010aa0c <strtol>
+f0100f4c:	89 c3                	mov    %eax,%ebx
+f0100f4e:	83 c4 0c             	add    $0xc,%esp
+f0100f51:	6a 10                	push   $0x10
+f0100f53:	6a 00                	push   $0x0
+f0100f55:	ff 76 08             	push   0x8(%esi)
+f0100f58:	e8 af 9a 00 00       	call   f010aa0c <strtol>
+f0100f5d:	89 df                	mov    %ebx,%edi
+f0100f5f:	83 c4 10             	add    $0x10,%esp
+f0100f62:	85 c0                	test   %eax,%eax
+f0100f64:	74 ca                	je     f0100f30 <mon_examinep+0x22>
+f0100f66:	01 d8                	add    %ebx,%eax
+f0100f68:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0100f6b:	eb 7f                	jmp    f0100fec <mon_examinep+0xde>
+f0100f6d:	83 ec 04             	sub    $0x4,%esp
+f0100f70:	68 44 d7 10 f0       	push   $0xf010d744
+f0100f75:	6a 5a                	push   $0x5a
+f0100f77:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0100f7c:	e8 bf f0 ff ff       	call   f0100040 <_panic>
+f0100f81:	51                   	push   %ecx
+f0100f82:	68 24 d0 10 f0       	push   $0xf010d024
+f0100f87:	6a 61                	push   $0x61
+f0100f89:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0100f8e:	e8 ad f0 ff ff       	call   f0100040 <_panic>
+f0100f93:	83 ec 04             	sub    $0x4,%esp
+f0100f96:	68 2e d4 10 f0       	push   $0xf010d42e
+f0100f9b:	57                   	push   %edi
+f0100f9c:	68 40 d4 10 f0       	push   $0xf010d440
+f0100fa1:	e8 61 4d 00 00       	call   f0105d07 <cprintf>
+f0100fa6:	83 c4 10             	add    $0x10,%esp
+f0100fa9:	eb 33                	jmp    f0100fde <mon_examinep+0xd0>
+f0100fab:	83 ec 04             	sub    $0x4,%esp
+f0100fae:	68 44 d7 10 f0       	push   $0xf010d744
+f0100fb3:	6a 5a                	push   $0x5a
+f0100fb5:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0100fba:	e8 81 f0 ff ff       	call   f0100040 <_panic>
+f0100fbf:	83 ec 04             	sub    $0x4,%esp
+f0100fc2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0100fc5:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0100fca:	09 f0                	or     %esi,%eax
+f0100fcc:	0f b6 00             	movzbl (%eax),%eax
+f0100fcf:	50                   	push   %eax
+f0100fd0:	57                   	push   %edi
+f0100fd1:	68 48 d4 10 f0       	push   $0xf010d448
+f0100fd6:	e8 2c 4d 00 00       	call   f0105d07 <cprintf>
+f0100fdb:	83 c4 10             	add    $0x10,%esp
+f0100fde:	83 c7 01             	add    $0x1,%edi
+f0100fe1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0100fe4:	39 c7                	cmp    %eax,%edi
+f0100fe6:	0f 84 44 ff ff ff    	je     f0100f30 <mon_examinep+0x22>
+f0100fec:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0100fef:	89 fb                	mov    %edi,%ebx
+f0100ff1:	c1 eb 0c             	shr    $0xc,%ebx
+f0100ff4:	8b 15 68 1a 2d f0    	mov    0xf02d1a68,%edx
+f0100ffa:	39 d3                	cmp    %edx,%ebx
+f0100ffc:	0f 83 6b ff ff ff    	jae    f0100f6d <mon_examinep+0x5f>
+f0101002:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0101005:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010100b:	89 c1                	mov    %eax,%ecx
+f010100d:	c1 e1 0c             	shl    $0xc,%ecx
+f0101010:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f0101013:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101018:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010101b:	39 d0                	cmp    %edx,%eax
+f010101d:	0f 83 5e ff ff ff    	jae    f0100f81 <mon_examinep+0x73>
+f0101023:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101026:	8d b0 00 00 00 f0    	lea    -0x10000000(%eax),%esi
+f010102c:	83 ec 04             	sub    $0x4,%esp
+f010102f:	6a 00                	push   $0x0
+f0101031:	56                   	push   %esi
+f0101032:	68 00 d0 7b ef       	push   $0xef7bd000
+f0101037:	e8 d0 0e 00 00       	call   f0101f0c <pgdir_walk>
+f010103c:	83 c4 10             	add    $0x10,%esp
+f010103f:	85 c0                	test   %eax,%eax
+f0101041:	0f 84 4c ff ff ff    	je     f0100f93 <mon_examinep+0x85>
+f0101047:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f010104c:	39 c3                	cmp    %eax,%ebx
+f010104e:	0f 83 57 ff ff ff    	jae    f0100fab <mon_examinep+0x9d>
+f0101054:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+f0101057:	0f 82 62 ff ff ff    	jb     f0100fbf <mon_examinep+0xb1>
+f010105d:	ff 75 e4             	push   -0x1c(%ebp)
+f0101060:	68 24 d0 10 f0       	push   $0xf010d024
+f0101065:	6a 61                	push   $0x61
+f0101067:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f010106c:	e8 cf ef ff ff       	call   f0100040 <_panic>
+
+f0101071 <monitor>:
+f0101071:	55                   	push   %ebp
+f0101072:	89 e5                	mov    %esp,%ebp
+f0101074:	57                   	push   %edi
+f0101075:	56                   	push   %esi
+f0101076:	53                   	push   %ebx
+f0101077:	83 ec 58             	sub    $0x58,%esp
+f010107a:	68 64 d7 10 f0       	push   $0xf010d764
+f010107f:	e8 83 4c 00 00       	call   f0105d07 <cprintf>
+f0101084:	c7 04 24 88 d7 10 f0 	movl   $0xf010d788,(%esp)
+f010108b:	e8 77 4c 00 00       	call   f0105d07 <cprintf>
+f0101090:	83 c4 10             	add    $0x10,%esp
+f0101093:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0101097:	0f 84 d8 00 00 00    	je     f0101175 <monitor+0x104>
+f010109d:	83 ec 0c             	sub    $0xc,%esp
+f01010a0:	ff 75 08             	push   0x8(%ebp)
+f01010a3:	e8 da 54 00 00       	call   f0106582 <print_trapframe>
+f01010a8:	83 c4 10             	add    $0x10,%esp
+f01010ab:	e9 c5 00 00 00       	jmp    f0101175 <monitor+0x104>
+f01010b0:	83 ec 08             	sub    $0x8,%esp
+f01010b3:	0f be c0             	movsbl %al,%eax
+f01010b6:	50                   	push   %eax
+f01010b7:	68 ba d4 10 f0       	push   $0xf010d4ba
+f01010bc:	e8 dc 97 00 00       	call   f010a89d <strchr>
+f01010c1:	83 c4 10             	add    $0x10,%esp
+f01010c4:	85 c0                	test   %eax,%eax
+f01010c6:	74 0a                	je     f01010d2 <monitor+0x61>
+f01010c8:	c6 03 00             	movb   $0x0,(%ebx)
+f01010cb:	89 f7                	mov    %esi,%edi
+f01010cd:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f01010d0:	eb 3e                	jmp    f0101110 <monitor+0x9f>
+f01010d2:	80 3b 00             	cmpb   $0x0,(%ebx)
+f01010d5:	74 42                	je     f0101119 <monitor+0xa8>
+f01010d7:	83 fe 0f             	cmp    $0xf,%esi
+f01010da:	0f 84 83 00 00 00    	je     f0101163 <monitor+0xf2>
+f01010e0:	8d 7e 01             	lea    0x1(%esi),%edi
+f01010e3:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+f01010e7:	0f b6 03             	movzbl (%ebx),%eax
+f01010ea:	84 c0                	test   %al,%al
+f01010ec:	74 22                	je     f0101110 <monitor+0x9f>
+f01010ee:	83 ec 08             	sub    $0x8,%esp
+f01010f1:	0f be c0             	movsbl %al,%eax
+f01010f4:	50                   	push   %eax
+f01010f5:	68 ba d4 10 f0       	push   $0xf010d4ba
+f01010fa:	e8 9e 97 00 00       	call   f010a89d <strchr>
+f01010ff:	83 c4 10             	add    $0x10,%esp
+f0101102:	85 c0                	test   %eax,%eax
+f0101104:	75 0a                	jne    f0101110 <monitor+0x9f>
+f0101106:	83 c3 01             	add    $0x1,%ebx
+f0101109:	0f b6 03             	movzbl (%ebx),%eax
+f010110c:	84 c0                	test   %al,%al
+f010110e:	75 de                	jne    f01010ee <monitor+0x7d>
+f0101110:	89 fe                	mov    %edi,%esi
+f0101112:	0f b6 03             	movzbl (%ebx),%eax
+f0101115:	84 c0                	test   %al,%al
+f0101117:	75 97                	jne    f01010b0 <monitor+0x3f>
+f0101119:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f0101120:	00 
+f0101121:	85 f6                	test   %esi,%esi
+f0101123:	74 50                	je     f0101175 <monitor+0x104>
+f0101125:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010112a:	83 ec 08             	sub    $0x8,%esp
+f010112d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0101130:	ff 34 85 e0 d8 10 f0 	push   -0xfef2720(,%eax,4)
+f0101137:	ff 75 a8             	push   -0x58(%ebp)
+f010113a:	e8 ea 96 00 00       	call   f010a829 <strcmp>
+f010113f:	83 c4 10             	add    $0x10,%esp
+f0101142:	85 c0                	test   %eax,%eax
+f0101144:	74 56                	je     f010119c <monitor+0x12b>
+f0101146:	83 c3 01             	add    $0x1,%ebx
+f0101149:	83 fb 0a             	cmp    $0xa,%ebx
+f010114c:	75 dc                	jne    f010112a <monitor+0xb9>
+f010114e:	83 ec 08             	sub    $0x8,%esp
+f0101151:	ff 75 a8             	push   -0x58(%ebp)
+f0101154:	68 dc d4 10 f0       	push   $0xf010d4dc
+f0101159:	e8 a9 4b 00 00       	call   f0105d07 <cprintf>
+f010115e:	83 c4 10             	add    $0x10,%esp
+f0101161:	eb 12                	jmp    f0101175 <monitor+0x104>
+f0101163:	83 ec 08             	sub    $0x8,%esp
+f0101166:	6a 10                	push   $0x10
+f0101168:	68 bf d4 10 f0       	push   $0xf010d4bf
+f010116d:	e8 95 4b 00 00       	call   f0105d07 <cprintf>
+f0101172:	83 c4 10             	add    $0x10,%esp
+f0101175:	83 ec 0c             	sub    $0xc,%esp
+f0101178:	68 b6 d4 10 f0       	push   $0xf010d4b6
+f010117d:	e8 bd 94 00 00       	call   f010a63f <readline>
+f0101182:	89 c3                	mov    %eax,%ebx
+f0101184:	83 c4 10             	add    $0x10,%esp
+f0101187:	85 c0                	test   %eax,%eax
+f0101189:	74 ea                	je     f0101175 <monitor+0x104>
+f010118b:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+f0101192:	be 00 00 00 00       	mov    $0x0,%esi
+f0101197:	e9 76 ff ff ff       	jmp    f0101112 <monitor+0xa1>
+f010119c:	83 ec 04             	sub    $0x4,%esp
+f010119f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01011a2:	ff 75 08             	push   0x8(%ebp)
+f01011a5:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f01011a8:	52                   	push   %edx
+f01011a9:	56                   	push   %esi
+f01011aa:	ff 14 85 e8 d8 10 f0 	call   *-0xfef2718(,%eax,4)
+f01011b1:	83 c4 10             	add    $0x10,%esp
+f01011b4:	85 c0                	test   %eax,%eax
+f01011b6:	79 bd                	jns    f0101175 <monitor+0x104>
+f01011b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01011bb:	5b                   	pop    %ebx
+f01011bc:	5e                   	pop    %esi
+f01011bd:	5f                   	pop    %edi
+f01011be:	5d                   	pop    %ebp
+f01011bf:	c3                   	ret
+
+f01011c0 <read_eip>:
+f01011c0:	8b 45 04             	mov    0x4(%ebp),%eax
+f01011c3:	c3                   	ret
+
+f01011c4 <buddy_unlink>:
+f01011c4:	8b 48 08             	mov    0x8(%eax),%ecx
+f01011c7:	8b 10                	mov    (%eax),%edx
+f01011c9:	89 11                	mov    %edx,(%ecx)
+f01011cb:	85 d2                	test   %edx,%edx
+f01011cd:	74 06                	je     f01011d5 <buddy_unlink+0x11>
+f01011cf:	8b 48 08             	mov    0x8(%eax),%ecx
+f01011d2:	89 4a 08             	mov    %ecx,0x8(%edx)
+f01011d5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f01011db:	66 c7 40 06 ff ff    	movw   $0xffff,0x6(%eax)
+f01011e1:	c3                   	ret
+
+f01011e2 <buddy_free_block>:
+f01011e2:	55                   	push   %ebp
+f01011e3:	89 e5                	mov    %esp,%ebp
+f01011e5:	57                   	push   %edi
+f01011e6:	56                   	push   %esi
+f01011e7:	53                   	push   %ebx
+f01011e8:	83 ec 0c             	sub    $0xc,%esp
+f01011eb:	89 d6                	mov    %edx,%esi
+f01011ed:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f01011f3:	c1 f8 02             	sar    $0x2,%eax
+f01011f6:	69 f8 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edi
+f01011fc:	83 fa 09             	cmp    $0x9,%edx
+f01011ff:	7f 3c                	jg     f010123d <buddy_free_block+0x5b>
+f0101201:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0101206:	89 f1                	mov    %esi,%ecx
+f0101208:	d3 e3                	shl    %cl,%ebx
+f010120a:	89 d8                	mov    %ebx,%eax
+f010120c:	31 f8                	xor    %edi,%eax
+f010120e:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+f0101211:	39 15 68 1a 2d f0    	cmp    %edx,0xf02d1a68
+f0101217:	72 24                	jb     f010123d <buddy_free_block+0x5b>
+f0101219:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f010121c:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f0101221:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0101224:	0f bf 50 06          	movswl 0x6(%eax),%edx
+f0101228:	39 f2                	cmp    %esi,%edx
+f010122a:	75 11                	jne    f010123d <buddy_free_block+0x5b>
+f010122c:	e8 93 ff ff ff       	call   f01011c4 <buddy_unlink>
+f0101231:	f7 d3                	not    %ebx
+f0101233:	21 df                	and    %ebx,%edi
+f0101235:	83 c6 01             	add    $0x1,%esi
+f0101238:	83 fe 0a             	cmp    $0xa,%esi
+f010123b:	75 c4                	jne    f0101201 <buddy_free_block+0x1f>
+f010123d:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+f0101240:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f0101245:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0101248:	66 89 70 06          	mov    %si,0x6(%eax)
+f010124c:	8d 14 b5 40 57 2b f0 	lea    -0xfd4a8c0(,%esi,4),%edx
+f0101253:	89 50 08             	mov    %edx,0x8(%eax)
+f0101256:	8b 14 b5 40 57 2b f0 	mov    -0xfd4a8c0(,%esi,4),%edx
+f010125d:	89 10                	mov    %edx,(%eax)
+f010125f:	85 d2                	test   %edx,%edx
+f0101261:	74 03                	je     f0101266 <buddy_free_block+0x84>
+f0101263:	89 42 08             	mov    %eax,0x8(%edx)
+f0101266:	89 04 b5 40 57 2b f0 	mov    %eax,-0xfd4a8c0(,%esi,4)
+f010126d:	83 c4 0c             	add    $0xc,%esp
+f0101270:	5b                   	pop    %ebx
+f0101271:	5e                   	pop    %esi
+f0101272:	5f                   	pop    %edi
+f0101273:	5d                   	pop    %ebp
+f0101274:	c3                   	ret
+
+f0101275 <boot_alloc>:
+f0101275:	83 3d c0 55 2b f0 00 	cmpl   $0x0,0xf02b55c0
+f010127c:	74 26                	je     f01012a4 <boot_alloc+0x2f>
+f010127e:	8b 15 c0 55 2b f0    	mov    0xf02b55c0,%edx
+f0101284:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f010128a:	75 2b                	jne    f01012b7 <boot_alloc+0x42>
+f010128c:	85 c0                	test   %eax,%eax
+f010128e:	74 11                	je     f01012a1 <boot_alloc+0x2c>
+f0101290:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0101295:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f010129a:	01 d0                	add    %edx,%eax
+f010129c:	a3 c0 55 2b f0       	mov    %eax,0xf02b55c0
+f01012a1:	89 d0                	mov    %edx,%eax
+f01012a3:	c3                   	ret
+f01012a4:	ba ab c4 32 f0       	mov    $0xf032c4ab,%edx
+f01012a9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f01012af:	89 15 c0 55 2b f0    	mov    %edx,0xf02b55c0
+f01012b5:	eb c7                	jmp    f010127e <boot_alloc+0x9>
+f01012b7:	55                   	push   %ebp
+f01012b8:	89 e5                	mov    %esp,%ebp
+f01012ba:	83 ec 08             	sub    $0x8,%esp
+f01012bd:	68 58 d9 10 f0       	push   $0xf010d958
+f01012c2:	68 0d e2 10 f0       	push   $0xf010e20d
+f01012c7:	68 96 00 00 00       	push   $0x96
+f01012cc:	68 22 e2 10 f0       	push   $0xf010e222
+f01012d1:	e8 6a ed ff ff       	call   f0100040 <_panic>
+
+f01012d6 <buddy_count>:
+f01012d6:	55                   	push   %ebp
+f01012d7:	89 e5                	mov    %esp,%ebp
+f01012d9:	56                   	push   %esi
+f01012da:	53                   	push   %ebx
+f01012db:	89 c6                	mov    %eax,%esi
+f01012dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01012e2:	89 f1                	mov    %esi,%ecx
+f01012e4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+f01012ea:	8b 14 9d 40 57 2b f0 	mov    -0xfd4a8c0(,%ebx,4),%edx
+f01012f1:	85 d2                	test   %edx,%edx
+f01012f3:	74 11                	je     f0101306 <buddy_count+0x30>
+f01012f5:	0f bf 42 06          	movswl 0x6(%edx),%eax
+f01012f9:	39 d8                	cmp    %ebx,%eax
+f01012fb:	75 1b                	jne    f0101318 <buddy_count+0x42>
+f01012fd:	83 01 01             	addl   $0x1,(%ecx)
+f0101300:	8b 12                	mov    (%edx),%edx
+f0101302:	85 d2                	test   %edx,%edx
+f0101304:	75 ef                	jne    f01012f5 <buddy_count+0x1f>
+f0101306:	83 c3 01             	add    $0x1,%ebx
+f0101309:	83 c6 04             	add    $0x4,%esi
+f010130c:	83 fb 0b             	cmp    $0xb,%ebx
+f010130f:	75 d1                	jne    f01012e2 <buddy_count+0xc>
+f0101311:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101314:	5b                   	pop    %ebx
+f0101315:	5e                   	pop    %esi
+f0101316:	5d                   	pop    %ebp
+f0101317:	c3                   	ret
+f0101318:	68 2e e2 10 f0       	push   $0xf010e22e
+f010131d:	68 0d e2 10 f0       	push   $0xf010e20d
+f0101322:	68 58 07 00 00       	push   $0x758
+f0101327:	68 22 e2 10 f0       	push   $0xf010e222
+f010132c:	e8 0f ed ff ff       	call   f0100040 <_panic>
+
+f0101331 <page_cache_drain>:
+f0101331:	55                   	push   %ebp
+f0101332:	89 e5                	mov    %esp,%ebp
+f0101334:	57                   	push   %edi
+f0101335:	56                   	push   %esi
+f0101336:	53                   	push   %ebx
+f0101337:	83 ec 18             	sub    $0x18,%esp
+f010133a:	89 c3                	mov    %eax,%ebx
+f010133c:	89 d7                	mov    %edx,%edi
+f010133e:	68 00 57 2b f0       	push   $0xf02b5700
+f0101343:	e8 e3 9f 00 00       	call   f010b32b <spin_lock>
+f0101348:	8d 77 ff             	lea    -0x1(%edi),%esi
+f010134b:	83 c4 10             	add    $0x10,%esp
+f010134e:	85 ff                	test   %edi,%edi
+f0101350:	7e 22                	jle    f0101374 <page_cache_drain+0x43>
+f0101352:	8b 43 78             	mov    0x78(%ebx),%eax
+f0101355:	85 c0                	test   %eax,%eax
+f0101357:	74 1b                	je     f0101374 <page_cache_drain+0x43>
+f0101359:	8b 10                	mov    (%eax),%edx
+f010135b:	89 53 78             	mov    %edx,0x78(%ebx)
+f010135e:	83 6b 7c 01          	subl   $0x1,0x7c(%ebx)
+f0101362:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101367:	e8 76 fe ff ff       	call   f01011e2 <buddy_free_block>
+f010136c:	83 ee 01             	sub    $0x1,%esi
+f010136f:	83 fe ff             	cmp    $0xffffffff,%esi
+f0101372:	75 de                	jne    f0101352 <page_cache_drain+0x21>
+f0101374:	83 ec 0c             	sub    $0xc,%esp
+f0101377:	68 00 57 2b f0       	push   $0xf02b5700
+f010137c:	e8 7e a0 00 00       	call   f010b3ff <spin_unlock>
+f0101381:	83 c4 10             	add    $0x10,%esp
+f0101384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101387:	5b                   	pop    %ebx
+f0101388:	5e                   	pop    %esi
+f0101389:	5f                   	pop    %edi
+f010138a:	5d                   	pop    %ebp
+f010138b:	c3                   	ret
+
+f010138c <page_cache_drain_all>:
+f010138c:	55                   	push   %ebp
+f010138d:	89 e5                	mov    %esp,%ebp
+f010138f:	57                   	push   %edi
+f0101390:	56                   	push   %esi
+f0101391:	53                   	push   %ebx
+f0101392:	83 ec 1c             	sub    $0x1c,%esp
+f0101395:	83 3d c4 24 2d f0 00 	cmpl   $0x0,0xf02d24c4
+f010139c:	7e 39                	jle    f01013d7 <page_cache_drain_all+0x4b>
+f010139e:	89 c7                	mov    %eax,%edi
+f01013a0:	bb 20 20 2d f0       	mov    $0xf02d2020,%ebx
+f01013a5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f01013ac:	be 00 00 00 00       	mov    $0x0,%esi
+f01013b1:	eb 11                	jmp    f01013c4 <page_cache_drain_all+0x38>
+f01013b3:	83 c6 01             	add    $0x1,%esi
+f01013b6:	81 c3 94 00 00 00    	add    $0x94,%ebx
+f01013bc:	39 35 c4 24 2d f0    	cmp    %esi,0xf02d24c4
+f01013c2:	7e 1a                	jle    f01013de <page_cache_drain_all+0x52>
+f01013c4:	39 fb                	cmp    %edi,%ebx
+f01013c6:	74 eb                	je     f01013b3 <page_cache_drain_all+0x27>
+f01013c8:	8b 53 7c             	mov    0x7c(%ebx),%edx
+f01013cb:	01 55 e4             	add    %edx,-0x1c(%ebp)
+f01013ce:	89 d8                	mov    %ebx,%eax
+f01013d0:	e8 5c ff ff ff       	call   f0101331 <page_cache_drain>
+f01013d5:	eb dc                	jmp    f01013b3 <page_cache_drain_all+0x27>
+f01013d7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f01013de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01013e1:	83 c4 1c             	add    $0x1c,%esp
+f01013e4:	5b                   	pop    %ebx
+f01013e5:	5e                   	pop    %esi
+f01013e6:	5f                   	pop    %edi
+f01013e7:	5d                   	pop    %ebp
+f01013e8:	c3                   	ret
+
+f01013e9 <page_zero_pop>:
+f01013e9:	55                   	push   %ebp
+f01013ea:	89 e5                	mov    %esp,%ebp
+f01013ec:	53                   	push   %ebx
+f01013ed:	83 ec 10             	sub    $0x10,%esp
+f01013f0:	68 00 57 2b f0       	push   $0xf02b5700
+f01013f5:	e8 31 9f 00 00       	call   f010b32b <spin_lock>
+f01013fa:	8b 1d 38 57 2b f0    	mov    0xf02b5738,%ebx
+f0101400:	83 c4 10             	add    $0x10,%esp
+f0101403:	85 db                	test   %ebx,%ebx
+f0101405:	74 14                	je     f010141b <page_zero_pop+0x32>
+f0101407:	8b 03                	mov    (%ebx),%eax
+f0101409:	a3 38 57 2b f0       	mov    %eax,0xf02b5738
+f010140e:	83 2d 34 57 2b f0 01 	subl   $0x1,0xf02b5734
+f0101415:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+f010141b:	83 ec 0c             	sub    $0xc,%esp
+f010141e:	68 00 57 2b f0       	push   $0xf02b5700
+f0101423:	e8 d7 9f 00 00       	call   f010b3ff <spin_unlock>
+f0101428:	89 d8                	mov    %ebx,%eax
+f010142a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010142d:	c9                   	leave
+f010142e:	c3                   	ret
+
+f010142f <check_va2pa>:
+f010142f:	89 d1                	mov    %edx,%ecx
+f0101431:	c1 e9 16             	shr    $0x16,%ecx
+f0101434:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0101437:	a8 01                	test   $0x1,%al
+f0101439:	74 51                	je     f010148c <check_va2pa+0x5d>
+f010143b:	89 c1                	mov    %eax,%ecx
+f010143d:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0101443:	c1 e8 0c             	shr    $0xc,%eax
+f0101446:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f010144c:	73 23                	jae    f0101471 <check_va2pa+0x42>
+f010144e:	c1 ea 0c             	shr    $0xc,%edx
+f0101451:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0101457:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+f010145e:	89 d0                	mov    %edx,%eax
+f0101460:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101465:	f6 c2 01             	test   $0x1,%dl
+f0101468:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f010146d:	0f 44 c2             	cmove  %edx,%eax
+f0101470:	c3                   	ret
+f0101471:	55                   	push   %ebp
+f0101472:	89 e5                	mov    %esp,%ebp
+f0101474:	83 ec 08             	sub    $0x8,%esp
+f0101477:	51                   	push   %ecx
+f0101478:	68 24 d0 10 f0       	push   $0xf010d024
+f010147d:	68 8f 06 00 00       	push   $0x68f
+f0101482:	68 22 e2 10 f0       	push   $0xf010e222
+f0101487:	e8 b4 eb ff ff       	call   f0100040 <_panic>
+f010148c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0101491:	c3                   	ret
+
+f0101492 <check_page_free_list>:
+f0101492:	55                   	push   %ebp
+f0101493:	89 e5                	mov    %esp,%ebp
+f0101495:	57                   	push   %edi
+f0101496:	56                   	push   %esi
+f0101497:	53                   	push   %ebx
+f0101498:	83 ec 2c             	sub    $0x2c,%esp
+f010149b:	85 c0                	test   %eax,%eax
+f010149d:	0f 85 bb 02 00 00    	jne    f010175e <check_page_free_list+0x2cc>
+f01014a3:	83 3d 70 57 2b f0 00 	cmpl   $0x0,0xf02b5770
+f01014aa:	74 0d                	je     f01014b9 <check_page_free_list+0x27>
+f01014ac:	8b 1d 70 57 2b f0    	mov    0xf02b5770,%ebx
+f01014b2:	be 00 04 00 00       	mov    $0x400,%esi
+f01014b7:	eb 2f                	jmp    f01014e8 <check_page_free_list+0x56>
+f01014b9:	83 ec 04             	sub    $0x4,%esp
+f01014bc:	68 7c d9 10 f0       	push   $0xf010d97c
+f01014c1:	68 b6 05 00 00       	push   $0x5b6
+f01014c6:	68 22 e2 10 f0       	push   $0xf010e222
+f01014cb:	e8 70 eb ff ff       	call   f0100040 <_panic>
+f01014d0:	50                   	push   %eax
+f01014d1:	68 24 d0 10 f0       	push   $0xf010d024
+f01014d6:	6a 61                	push   $0x61
+f01014d8:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01014dd:	e8 5e eb ff ff       	call   f0100040 <_panic>
+f01014e2:	8b 1b                	mov    (%ebx),%ebx
+f01014e4:	85 db                	test   %ebx,%ebx
+f01014e6:	74 47                	je     f010152f <check_page_free_list+0x9d>
+f01014e8:	89 d8                	mov    %ebx,%eax
+f01014ea:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f01014f0:	c1 f8 02             	sar    $0x2,%eax
+f01014f3:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01014f9:	c1 e0 0c             	shl    $0xc,%eax
+f01014fc:	89 c2                	mov    %eax,%edx
+f01014fe:	c1 ea 16             	shr    $0x16,%edx
+f0101501:	39 f2                	cmp    %esi,%edx
+f0101503:	73 dd                	jae    f01014e2 <check_page_free_list+0x50>
+f0101505:	89 c2                	mov    %eax,%edx
+f0101507:	c1 ea 0c             	shr    $0xc,%edx
+f010150a:	3b 15 68 1a 2d f0    	cmp    0xf02d1a68,%edx
+f0101510:	73 be                	jae    f01014d0 <check_page_free_list+0x3e>
+f0101512:	83 ec 04             	sub    $0x4,%esp
+f0101515:	68 80 00 00 00       	push   $0x80
+f010151a:	68 97 00 00 00       	push   $0x97
+f010151f:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0101524:	50                   	push   %eax
+f0101525:	e8 ca 93 00 00       	call   f010a8f4 <memset>
+f010152a:	83 c4 10             	add    $0x10,%esp
+f010152d:	eb b3                	jmp    f01014e2 <check_page_free_list+0x50>
+f010152f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101534:	e8 3c fd ff ff       	call   f0101275 <boot_alloc>
+f0101539:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f010153c:	8b 1d 70 57 2b f0    	mov    0xf02b5770,%ebx
+f0101542:	85 db                	test   %ebx,%ebx
+f0101544:	0f 84 e2 01 00 00    	je     f010172c <check_page_free_list+0x29a>
+f010154a:	8b 3d 70 1a 2d f0    	mov    0xf02d1a70,%edi
+f0101550:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f0101555:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0101558:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010155b:	8d 34 87             	lea    (%edi,%eax,4),%esi
+f010155e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+f0101565:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f010156c:	e9 07 01 00 00       	jmp    f0101678 <check_page_free_list+0x1e6>
+f0101571:	68 40 e2 10 f0       	push   $0xf010e240
+f0101576:	68 0d e2 10 f0       	push   $0xf010e20d
+f010157b:	68 d0 05 00 00       	push   $0x5d0
+f0101580:	68 22 e2 10 f0       	push   $0xf010e222
+f0101585:	e8 b6 ea ff ff       	call   f0100040 <_panic>
+f010158a:	68 4c e2 10 f0       	push   $0xf010e24c
+f010158f:	68 0d e2 10 f0       	push   $0xf010e20d
+f0101594:	68 d1 05 00 00       	push   $0x5d1
+f0101599:	68 22 e2 10 f0       	push   $0xf010e222
+f010159e:	e8 9d ea ff ff       	call   f0100040 <_panic>
+f01015a3:	68 a0 d9 10 f0       	push   $0xf010d9a0
+f01015a8:	68 0d e2 10 f0       	push   $0xf010e20d
+f01015ad:	68 d2 05 00 00       	push   $0x5d2
+f01015b2:	68 22 e2 10 f0       	push   $0xf010e222
+f01015b7:	e8 84 ea ff ff       	call   f0100040 <_panic>
+f01015bc:	68 60 e2 10 f0       	push   $0xf010e260
+f01015c1:	68 0d e2 10 f0       	push   $0xf010e20d
+f01015c6:	68 d5 05 00 00       	push   $0x5d5
+f01015cb:	68 22 e2 10 f0       	push   $0xf010e222
+f01015d0:	e8 6b ea ff ff       	call   f0100040 <_panic>
+f01015d5:	68 71 e2 10 f0       	push   $0xf010e271
+f01015da:	68 0d e2 10 f0       	push   $0xf010e20d
+f01015df:	68 d6 05 00 00       	push   $0x5d6
+f01015e4:	68 22 e2 10 f0       	push   $0xf010e222
+f01015e9:	e8 52 ea ff ff       	call   f0100040 <_panic>
+f01015ee:	68 d4 d9 10 f0       	push   $0xf010d9d4
+f01015f3:	68 0d e2 10 f0       	push   $0xf010e20d
+f01015f8:	68 d7 05 00 00       	push   $0x5d7
+f01015fd:	68 22 e2 10 f0       	push   $0xf010e222
+f0101602:	e8 39 ea ff ff       	call   f0100040 <_panic>
+f0101607:	68 8a e2 10 f0       	push   $0xf010e28a
+f010160c:	68 0d e2 10 f0       	push   $0xf010e20d
+f0101611:	68 d8 05 00 00       	push   $0x5d8
+f0101616:	68 22 e2 10 f0       	push   $0xf010e222
+f010161b:	e8 20 ea ff ff       	call   f0100040 <_panic>
+f0101620:	89 c8                	mov    %ecx,%eax
+f0101622:	c1 e8 0c             	shr    $0xc,%eax
+f0101625:	8b 55 c8             	mov    -0x38(%ebp),%edx
+f0101628:	39 d0                	cmp    %edx,%eax
+f010162a:	73 13                	jae    f010163f <check_page_free_list+0x1ad>
+f010162c:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0101632:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0101635:	39 c1                	cmp    %eax,%ecx
+f0101637:	72 18                	jb     f0101651 <check_page_free_list+0x1bf>
+f0101639:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f010163d:	eb 2f                	jmp    f010166e <check_page_free_list+0x1dc>
+f010163f:	51                   	push   %ecx
+f0101640:	68 24 d0 10 f0       	push   $0xf010d024
+f0101645:	6a 61                	push   $0x61
+f0101647:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f010164c:	e8 ef e9 ff ff       	call   f0100040 <_panic>
+f0101651:	68 f8 d9 10 f0       	push   $0xf010d9f8
+f0101656:	68 0d e2 10 f0       	push   $0xf010e20d
+f010165b:	68 d9 05 00 00       	push   $0x5d9
+f0101660:	68 22 e2 10 f0       	push   $0xf010e222
+f0101665:	e8 d6 e9 ff ff       	call   f0100040 <_panic>
+f010166a:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+f010166e:	8b 1b                	mov    (%ebx),%ebx
+f0101670:	85 db                	test   %ebx,%ebx
+f0101672:	0f 84 93 00 00 00    	je     f010170b <check_page_free_list+0x279>
+f0101678:	39 fb                	cmp    %edi,%ebx
+f010167a:	0f 82 f1 fe ff ff    	jb     f0101571 <check_page_free_list+0xdf>
+f0101680:	39 f3                	cmp    %esi,%ebx
+f0101682:	0f 83 02 ff ff ff    	jae    f010158a <check_page_free_list+0xf8>
+f0101688:	89 d9                	mov    %ebx,%ecx
+f010168a:	29 f9                	sub    %edi,%ecx
+f010168c:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+f0101691:	f7 e1                	mul    %ecx
+f0101693:	c1 ea 03             	shr    $0x3,%edx
+f0101696:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0101699:	c1 e0 02             	shl    $0x2,%eax
+f010169c:	39 c1                	cmp    %eax,%ecx
+f010169e:	0f 85 ff fe ff ff    	jne    f01015a3 <check_page_free_list+0x111>
+f01016a4:	c1 f9 02             	sar    $0x2,%ecx
+f01016a7:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+f01016ad:	c1 e1 0c             	shl    $0xc,%ecx
+f01016b0:	0f 84 06 ff ff ff    	je     f01015bc <check_page_free_list+0x12a>
+f01016b6:	81 f9 00 00 0a 00    	cmp    $0xa0000,%ecx
+f01016bc:	0f 84 13 ff ff ff    	je     f01015d5 <check_page_free_list+0x143>
+f01016c2:	81 f9 00 f0 0f 00    	cmp    $0xff000,%ecx
+f01016c8:	0f 84 20 ff ff ff    	je     f01015ee <check_page_free_list+0x15c>
+f01016ce:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+f01016d4:	0f 84 2d ff ff ff    	je     f0101607 <check_page_free_list+0x175>
+f01016da:	81 f9 ff ff 0f 00    	cmp    $0xfffff,%ecx
+f01016e0:	0f 87 3a ff ff ff    	ja     f0101620 <check_page_free_list+0x18e>
+f01016e6:	81 f9 00 70 00 00    	cmp    $0x7000,%ecx
+f01016ec:	0f 85 78 ff ff ff    	jne    f010166a <check_page_free_list+0x1d8>
+f01016f2:	68 a4 e2 10 f0       	push   $0xf010e2a4
+f01016f7:	68 0d e2 10 f0       	push   $0xf010e20d
+f01016fc:	68 db 05 00 00       	push   $0x5db
+f0101701:	68 22 e2 10 f0       	push   $0xf010e222
+f0101706:	e8 35 e9 ff ff       	call   f0100040 <_panic>
+f010170b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f010170f:	7e 1b                	jle    f010172c <check_page_free_list+0x29a>
+f0101711:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+f0101715:	7e 2e                	jle    f0101745 <check_page_free_list+0x2b3>
+f0101717:	83 ec 0c             	sub    $0xc,%esp
+f010171a:	68 40 da 10 f0       	push   $0xf010da40
+f010171f:	e8 e3 45 00 00       	call   f0105d07 <cprintf>
+f0101724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101727:	5b                   	pop    %ebx
+f0101728:	5e                   	pop    %esi
+f0101729:	5f                   	pop    %edi
+f010172a:	5d                   	pop    %ebp
+f010172b:	c3                   	ret
+f010172c:	68 c1 e2 10 f0       	push   $0xf010e2c1
+f0101731:	68 0d e2 10 f0       	push   $0xf010e20d
+f0101736:	68 e3 05 00 00       	push   $0x5e3
+f010173b:	68 22 e2 10 f0       	push   $0xf010e222
+f0101740:	e8 fb e8 ff ff       	call   f0100040 <_panic>
+f0101745:	68 d3 e2 10 f0       	push   $0xf010e2d3
+f010174a:	68 0d e2 10 f0       	push   $0xf010e20d
+f010174f:	68 e4 05 00 00       	push   $0x5e4
+f0101754:	68 22 e2 10 f0       	push   $0xf010e222
+f0101759:	e8 e2 e8 ff ff       	call   f0100040 <_panic>
+f010175e:	a1 70 57 2b f0       	mov    0xf02b5770,%eax
+f0101763:	85 c0                	test   %eax,%eax
+f0101765:	0f 84 4e fd ff ff    	je     f01014b9 <check_page_free_list+0x27>
+f010176b:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f010176e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0101771:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0101774:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101777:	89 c2                	mov    %eax,%edx
+f0101779:	2b 15 70 1a 2d f0    	sub    0xf02d1a70,%edx
+f010177f:	c1 fa 02             	sar    $0x2,%edx
+f0101782:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+f0101788:	f7 c2 00 fc 0f 00    	test   $0xffc00,%edx
+f010178e:	0f 95 c2             	setne  %dl
+f0101791:	0f b6 d2             	movzbl %dl,%edx
+f0101794:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f0101798:	89 01                	mov    %eax,(%ecx)
+f010179a:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+f010179e:	8b 00                	mov    (%eax),%eax
+f01017a0:	85 c0                	test   %eax,%eax
+f01017a2:	75 d3                	jne    f0101777 <check_page_free_list+0x2e5>
+f01017a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01017a7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f01017ad:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01017b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01017b3:	89 10                	mov    %edx,(%eax)
+f01017b5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01017b8:	a3 70 57 2b f0       	mov    %eax,0xf02b5770
+f01017bd:	89 c3                	mov    %eax,%ebx
+f01017bf:	85 c0                	test   %eax,%eax
+f01017c1:	0f 84 68 fd ff ff    	je     f010152f <check_page_free_list+0x9d>
+f01017c7:	be 01 00 00 00       	mov    $0x1,%esi
+f01017cc:	e9 17 fd ff ff       	jmp    f01014e8 <check_page_free_list+0x56>
+
+f01017d1 <buddy_alloc_block>:
+f01017d1:	55                   	push   %ebp
+f01017d2:	89 e5                	mov    %esp,%ebp
+f01017d4:	57                   	push   %edi
+f01017d5:	56                   	push   %esi
+f01017d6:	53                   	push   %ebx
+f01017d7:	83 ec 0c             	sub    $0xc,%esp
+f01017da:	89 c7                	mov    %eax,%edi
+f01017dc:	89 c3                	mov    %eax,%ebx
+f01017de:	83 f8 0a             	cmp    $0xa,%eax
+f01017e1:	7f 1d                	jg     f0101800 <buddy_alloc_block+0x2f>
+f01017e3:	8b 34 9d 40 57 2b f0 	mov    -0xfd4a8c0(,%ebx,4),%esi
+f01017ea:	85 f6                	test   %esi,%esi
+f01017ec:	75 12                	jne    f0101800 <buddy_alloc_block+0x2f>
+f01017ee:	83 c3 01             	add    $0x1,%ebx
+f01017f1:	83 fb 0b             	cmp    $0xb,%ebx
+f01017f4:	75 ed                	jne    f01017e3 <buddy_alloc_block+0x12>
+f01017f6:	89 f0                	mov    %esi,%eax
+f01017f8:	83 c4 0c             	add    $0xc,%esp
+f01017fb:	5b                   	pop    %ebx
+f01017fc:	5e                   	pop    %esi
+f01017fd:	5f                   	pop    %edi
+f01017fe:	5d                   	pop    %ebp
+f01017ff:	c3                   	ret
+f0101800:	83 fb 0b             	cmp    $0xb,%ebx
+f0101803:	74 4f                	je     f0101854 <buddy_alloc_block+0x83>
+f0101805:	8b 34 9d 40 57 2b f0 	mov    -0xfd4a8c0(,%ebx,4),%esi
+f010180c:	89 f0                	mov    %esi,%eax
+f010180e:	e8 b1 f9 ff ff       	call   f01011c4 <buddy_unlink>
+f0101813:	39 df                	cmp    %ebx,%edi
+f0101815:	7d df                	jge    f01017f6 <buddy_alloc_block+0x25>
+f0101817:	89 d9                	mov    %ebx,%ecx
+f0101819:	eb 0b                	jmp    f0101826 <buddy_alloc_block+0x55>
+f010181b:	89 04 9d 40 57 2b f0 	mov    %eax,-0xfd4a8c0(,%ebx,4)
+f0101822:	39 cf                	cmp    %ecx,%edi
+f0101824:	74 d0                	je     f01017f6 <buddy_alloc_block+0x25>
+f0101826:	83 e9 01             	sub    $0x1,%ecx
+f0101829:	b8 0c 00 00 00       	mov    $0xc,%eax
+f010182e:	d3 e0                	shl    %cl,%eax
+f0101830:	01 f0                	add    %esi,%eax
+f0101832:	66 89 48 06          	mov    %cx,0x6(%eax)
+f0101836:	89 cb                	mov    %ecx,%ebx
+f0101838:	8d 14 8d 40 57 2b f0 	lea    -0xfd4a8c0(,%ecx,4),%edx
+f010183f:	89 50 08             	mov    %edx,0x8(%eax)
+f0101842:	8b 14 8d 40 57 2b f0 	mov    -0xfd4a8c0(,%ecx,4),%edx
+f0101849:	89 10                	mov    %edx,(%eax)
+f010184b:	85 d2                	test   %edx,%edx
+f010184d:	74 cc                	je     f010181b <buddy_alloc_block+0x4a>
+f010184f:	89 42 08             	mov    %eax,0x8(%edx)
+f0101852:	eb c7                	jmp    f010181b <buddy_alloc_block+0x4a>
+f0101854:	be 00 00 00 00       	mov    $0x0,%esi
+f0101859:	eb 9b                	jmp    f01017f6 <buddy_alloc_block+0x25>
+
+f010185b <page_cache_refill>:
+f010185b:	55                   	push   %ebp
+f010185c:	89 e5                	mov    %esp,%ebp
+f010185e:	56                   	push   %esi
+f010185f:	53                   	push   %ebx
+f0101860:	89 c3                	mov    %eax,%ebx
+f0101862:	83 ec 0c             	sub    $0xc,%esp
+f0101865:	68 00 57 2b f0       	push   $0xf02b5700
+f010186a:	e8 bc 9a 00 00       	call   f010b32b <spin_lock>
+f010186f:	83 c4 10             	add    $0x10,%esp
+f0101872:	be 10 00 00 00       	mov    $0x10,%esi
+f0101877:	b8 00 00 00 00       	mov    $0x0,%eax
+f010187c:	e8 50 ff ff ff       	call   f01017d1 <buddy_alloc_block>
+f0101881:	85 c0                	test   %eax,%eax
+f0101883:	74 11                	je     f0101896 <page_cache_refill+0x3b>
+f0101885:	8b 53 78             	mov    0x78(%ebx),%edx
+f0101888:	89 10                	mov    %edx,(%eax)
+f010188a:	89 43 78             	mov    %eax,0x78(%ebx)
+f010188d:	83 43 7c 01          	addl   $0x1,0x7c(%ebx)
+f0101891:	83 ee 01             	sub    $0x1,%esi
+f0101894:	75 e1                	jne    f0101877 <page_cache_refill+0x1c>
+f0101896:	83 ec 0c             	sub    $0xc,%esp
+f0101899:	68 00 57 2b f0       	push   $0xf02b5700
+f010189e:	e8 5c 9b 00 00       	call   f010b3ff <spin_unlock>
+f01018a3:	83 c4 10             	add    $0x10,%esp
+f01018a6:	83 7b 78 00          	cmpl   $0x0,0x78(%ebx)
+f01018aa:	74 07                	je     f01018b3 <page_cache_refill+0x58>
+f01018ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01018af:	5b                   	pop    %ebx
+f01018b0:	5e                   	pop    %esi
+f01018b1:	5d                   	pop    %ebp
+f01018b2:	c3                   	ret
+f01018b3:	89 d8                	mov    %ebx,%eax
+f01018b5:	e8 d2 fa ff ff       	call   f010138c <page_cache_drain_all>
+f01018ba:	85 c0                	test   %eax,%eax
+f01018bc:	75 11                	jne    f01018cf <page_cache_refill+0x74>
+f01018be:	83 ec 0c             	sub    $0xc,%esp
+f01018c1:	6a ff                	push   $0xffffffff
+f01018c3:	e8 91 3c 00 00       	call   f0105559 <env_reclaim>
+f01018c8:	83 c4 10             	add    $0x10,%esp
+f01018cb:	85 c0                	test   %eax,%eax
+f01018cd:	74 dd                	je     f01018ac <page_cache_refill+0x51>
+f01018cf:	89 d8                	mov    %ebx,%eax
+f01018d1:	e8 85 ff ff ff       	call   f010185b <page_cache_refill>
+f01018d6:	eb d4                	jmp    f01018ac <page_cache_refill+0x51>
+
+f01018d8 <page_init>:
+f01018d8:	55                   	push   %ebp
+f01018d9:	89 e5                	mov    %esp,%ebp
+f01018db:	57                   	push   %edi
+f01018dc:	56                   	push   %esi
+f01018dd:	53                   	push   %ebx
+f01018de:	83 ec 0c             	sub    $0xc,%esp
+f01018e1:	c7 05 70 57 2b f0 00 	movl   $0x0,0xf02b5770
+f01018e8:	00 00 00 
+f01018eb:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f01018f0:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+f01018f6:	8b 1d 74 57 2b f0    	mov    0xf02b5774,%ebx
+f01018fc:	83 fb 01             	cmp    $0x1,%ebx
+f01018ff:	0f 86 2c 01 00 00    	jbe    f0101a31 <page_init+0x159>
+f0101905:	ba 00 00 00 00       	mov    $0x0,%edx
+f010190a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010190f:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101914:	be 01 00 00 00       	mov    $0x1,%esi
+f0101919:	eb 07                	jmp    f0101922 <page_init+0x4a>
+f010191b:	83 c0 01             	add    $0x1,%eax
+f010191e:	39 d8                	cmp    %ebx,%eax
+f0101920:	74 27                	je     f0101949 <page_init+0x71>
+f0101922:	83 f8 07             	cmp    $0x7,%eax
+f0101925:	74 f4                	je     f010191b <page_init+0x43>
+f0101927:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f010192a:	c1 e2 02             	shl    $0x2,%edx
+f010192d:	89 d7                	mov    %edx,%edi
+f010192f:	03 3d 70 1a 2d f0    	add    0xf02d1a70,%edi
+f0101935:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+f010193b:	89 0f                	mov    %ecx,(%edi)
+f010193d:	89 d1                	mov    %edx,%ecx
+f010193f:	03 0d 70 1a 2d f0    	add    0xf02d1a70,%ecx
+f0101945:	89 f2                	mov    %esi,%edx
+f0101947:	eb d2                	jmp    f010191b <page_init+0x43>
+f0101949:	84 d2                	test   %dl,%dl
+f010194b:	74 06                	je     f0101953 <page_init+0x7b>
+f010194d:	89 0d 70 57 2b f0    	mov    %ecx,0xf02b5770
+f0101953:	89 d8                	mov    %ebx,%eax
+f0101955:	c1 e0 0c             	shl    $0xc,%eax
+f0101958:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f010195d:	75 2e                	jne    f010198d <page_init+0xb5>
+f010195f:	81 fb ff 00 00 00    	cmp    $0xff,%ebx
+f0101965:	77 54                	ja     f01019bb <page_init+0xe3>
+f0101967:	8b 15 70 1a 2d f0    	mov    0xf02d1a70,%edx
+f010196d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0101970:	8d 44 82 04          	lea    0x4(%edx,%eax,4),%eax
+f0101974:	81 c2 04 0c 00 00    	add    $0xc04,%edx
+f010197a:	66 c7 00 01 00       	movw   $0x1,(%eax)
+f010197f:	83 c0 0c             	add    $0xc,%eax
+f0101982:	39 d0                	cmp    %edx,%eax
+f0101984:	75 f4                	jne    f010197a <page_init+0xa2>
+f0101986:	bb 00 01 00 00       	mov    $0x100,%ebx
+f010198b:	eb 2e                	jmp    f01019bb <page_init+0xe3>
+f010198d:	68 64 da 10 f0       	push   $0xf010da64
+f0101992:	68 0d e2 10 f0       	push   $0xf010e20d
+f0101997:	68 ba 01 00 00       	push   $0x1ba
+f010199c:	68 22 e2 10 f0       	push   $0xf010e222
+f01019a1:	e8 9a e6 ff ff       	call   f0100040 <_panic>
+f01019a6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01019a9:	c1 e0 02             	shl    $0x2,%eax
+f01019ac:	03 05 70 1a 2d f0    	add    0xf02d1a70,%eax
+f01019b2:	66 c7 40 04 01 00    	movw   $0x1,0x4(%eax)
+f01019b8:	83 c3 01             	add    $0x1,%ebx
+f01019bb:	b8 00 00 00 00       	mov    $0x0,%eax
+f01019c0:	e8 b0 f8 ff ff       	call   f0101275 <boot_alloc>
+f01019c5:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01019ca:	76 50                	jbe    f0101a1c <page_init+0x144>
+f01019cc:	05 00 00 00 10       	add    $0x10000000,%eax
+f01019d1:	c1 e8 0c             	shr    $0xc,%eax
+f01019d4:	39 c3                	cmp    %eax,%ebx
+f01019d6:	72 ce                	jb     f01019a6 <page_init+0xce>
+f01019d8:	3b 1d 68 1a 2d f0    	cmp    0xf02d1a68,%ebx
+f01019de:	73 34                	jae    f0101a14 <page_init+0x13c>
+f01019e0:	8b 0d 70 57 2b f0    	mov    0xf02b5770,%ecx
+f01019e6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01019e9:	c1 e0 02             	shl    $0x2,%eax
+f01019ec:	89 c2                	mov    %eax,%edx
+f01019ee:	03 15 70 1a 2d f0    	add    0xf02d1a70,%edx
+f01019f4:	66 c7 42 04 00 00    	movw   $0x0,0x4(%edx)
+f01019fa:	89 0a                	mov    %ecx,(%edx)
+f01019fc:	03 05 70 1a 2d f0    	add    0xf02d1a70,%eax
+f0101a02:	89 c1                	mov    %eax,%ecx
+f0101a04:	83 c3 01             	add    $0x1,%ebx
+f0101a07:	3b 1d 68 1a 2d f0    	cmp    0xf02d1a68,%ebx
+f0101a0d:	72 d7                	jb     f01019e6 <page_init+0x10e>
+f0101a0f:	a3 70 57 2b f0       	mov    %eax,0xf02b5770
+f0101a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101a17:	5b                   	pop    %ebx
+f0101a18:	5e                   	pop    %esi
+f0101a19:	5f                   	pop    %edi
+f0101a1a:	5d                   	pop    %ebp
+f0101a1b:	c3                   	ret
+f0101a1c:	50                   	push   %eax
+f0101a1d:	68 48 d0 10 f0       	push   $0xf010d048
+f0101a22:	68 c3 01 00 00       	push   $0x1c3
+f0101a27:	68 22 e2 10 f0       	push   $0xf010e222
+f0101a2c:	e8 0f e6 ff ff       	call   f0100040 <_panic>
+f0101a31:	c1 e3 0c             	shl    $0xc,%ebx
+f0101a34:	81 fb 00 00 0a 00    	cmp    $0xa0000,%ebx
+f0101a3a:	0f 85 4d ff ff ff    	jne    f010198d <page_init+0xb5>
+f0101a40:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0101a45:	e9 1d ff ff ff       	jmp    f0101967 <page_init+0x8f>
+
+f0101a4a <page_free>:
+f0101a4a:	55                   	push   %ebp
+f0101a4b:	89 e5                	mov    %esp,%ebp
+f0101a4d:	53                   	push   %ebx
+f0101a4e:	83 ec 04             	sub    $0x4,%esp
+f0101a51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0101a54:	e8 f8 94 00 00       	call   f010af51 <cpunum>
+f0101a59:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0101a5e:	75 3c                	jne    f0101a9c <page_free+0x52>
+f0101a60:	83 3d e8 56 2b f0 00 	cmpl   $0x0,0xf02b56e8
+f0101a67:	74 48                	je     f0101ab1 <page_free+0x67>
+f0101a69:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+f0101a6f:	8b 8a 98 20 2d f0    	mov    -0xfd2df68(%edx),%ecx
+f0101a75:	89 0b                	mov    %ecx,(%ebx)
+f0101a77:	89 9a 98 20 2d f0    	mov    %ebx,-0xfd2df68(%edx)
+f0101a7d:	8b 8a 9c 20 2d f0    	mov    -0xfd2df64(%edx),%ecx
+f0101a83:	83 c1 01             	add    $0x1,%ecx
+f0101a86:	89 8a 9c 20 2d f0    	mov    %ecx,-0xfd2df64(%edx)
+f0101a8c:	81 c2 20 20 2d f0    	add    $0xf02d2020,%edx
+f0101a92:	83 f9 40             	cmp    $0x40,%ecx
+f0101a95:	7f 29                	jg     f0101ac0 <page_free+0x76>
+f0101a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101a9a:	c9                   	leave
+f0101a9b:	c3                   	ret
+f0101a9c:	53                   	push   %ebx
+f0101a9d:	68 8c da 10 f0       	push   $0xf010da8c
+f0101aa2:	68 f8 02 00 00       	push   $0x2f8
+f0101aa7:	68 22 e2 10 f0       	push   $0xf010e222
+f0101aac:	e8 8f e5 ff ff       	call   f0100040 <_panic>
+f0101ab1:	a1 70 57 2b f0       	mov    0xf02b5770,%eax
+f0101ab6:	89 03                	mov    %eax,(%ebx)
+f0101ab8:	89 1d 70 57 2b f0    	mov    %ebx,0xf02b5770
+f0101abe:	eb d7                	jmp    f0101a97 <page_free+0x4d>
+f0101ac0:	89 d0                	mov    %edx,%eax
+f0101ac2:	ba 10 00 00 00       	mov    $0x10,%edx
+f0101ac7:	e8 65 f8 ff ff       	call   f0101331 <page_cache_drain>
+f0101acc:	eb c9                	jmp    f0101a97 <page_free+0x4d>
+
+f0101ace <page_decref>:
+f0101ace:	55                   	push   %ebp
+f0101acf:	89 e5                	mov    %esp,%ebp
+f0101ad1:	83 ec 08             	sub    $0x8,%esp
+f0101ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101ad7:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+f0101adb:	83 e8 01             	sub    $0x1,%eax
+f0101ade:	66 89 42 04          	mov    %ax,0x4(%edx)
+f0101ae2:	66 85 c0             	test   %ax,%ax
+f0101ae5:	74 02                	je     f0101ae9 <page_decref+0x1b>
+f0101ae7:	c9                   	leave
+f0101ae8:	c3                   	ret
+f0101ae9:	83 ec 0c             	sub    $0xc,%esp
+f0101aec:	52                   	push   %edx
+f0101aed:	e8 58 ff ff ff       	call   f0101a4a <page_free>
+f0101af2:	83 c4 10             	add    $0x10,%esp
+f0101af5:	eb f0                	jmp    f0101ae7 <page_decref+0x19>
+
+f0101af7 <page_free_npages>:
+f0101af7:	55                   	push   %ebp
+f0101af8:	89 e5                	mov    %esp,%ebp
+f0101afa:	56                   	push   %esi
+f0101afb:	53                   	push   %ebx
+f0101afc:	8b 75 08             	mov    0x8(%ebp),%esi
+f0101aff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0101b02:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101b07:	89 d9                	mov    %ebx,%ecx
+f0101b09:	d3 e0                	shl    %cl,%eax
+f0101b0b:	85 c0                	test   %eax,%eax
+f0101b0d:	7e 1a                	jle    f0101b29 <page_free_npages+0x32>
+f0101b0f:	89 c1                	mov    %eax,%ecx
+f0101b11:	89 f0                	mov    %esi,%eax
+f0101b13:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101b18:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f0101b1d:	75 36                	jne    f0101b55 <page_free_npages+0x5e>
+f0101b1f:	83 c2 01             	add    $0x1,%edx
+f0101b22:	83 c0 0c             	add    $0xc,%eax
+f0101b25:	39 ca                	cmp    %ecx,%edx
+f0101b27:	75 ef                	jne    f0101b18 <page_free_npages+0x21>
+f0101b29:	83 ec 0c             	sub    $0xc,%esp
+f0101b2c:	68 00 57 2b f0       	push   $0xf02b5700
+f0101b31:	e8 f5 97 00 00       	call   f010b32b <spin_lock>
+f0101b36:	89 da                	mov    %ebx,%edx
+f0101b38:	89 f0                	mov    %esi,%eax
+f0101b3a:	e8 a3 f6 ff ff       	call   f01011e2 <buddy_free_block>
+f0101b3f:	c7 04 24 00 57 2b f0 	movl   $0xf02b5700,(%esp)
+f0101b46:	e8 b4 98 00 00       	call   f010b3ff <spin_unlock>
+f0101b4b:	83 c4 10             	add    $0x10,%esp
+f0101b4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101b51:	5b                   	pop    %ebx
+f0101b52:	5e                   	pop    %esi
+f0101b53:	5d                   	pop    %ebp
+f0101b54:	c3                   	ret
+f0101b55:	50                   	push   %eax
+f0101b56:	68 b0 da 10 f0       	push   $0xf010dab0
+f0101b5b:	68 4b 03 00 00       	push   $0x34b
+f0101b60:	68 22 e2 10 f0       	push   $0xf010e222
+f0101b65:	e8 d6 e4 ff ff       	call   f0100040 <_panic>
+
+f0101b6a <tlb_shootdown>:
+f0101b6a:	83 3d e4 56 2b f0 00 	cmpl   $0x0,0xf02b56e4
+f0101b71:	0f 84 15 01 00 00    	je     f0101c8c <tlb_shootdown+0x122>
+f0101b77:	55                   	push   %ebp
+f0101b78:	89 e5                	mov    %esp,%ebp
+f0101b7a:	57                   	push   %edi
+f0101b7b:	56                   	push   %esi
+f0101b7c:	53                   	push   %ebx
+f0101b7d:	83 ec 0c             	sub    $0xc,%esp
+f0101b80:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f0101b87:	00 00 00 
+f0101b8a:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0101b8f:	3d 20 20 2d f0       	cmp    $0xf02d2020,%eax
+f0101b94:	0f 86 d6 00 00 00    	jbe    f0101c70 <tlb_shootdown+0x106>
+f0101b9a:	bb 20 20 2d f0       	mov    $0xf02d2020,%ebx
+f0101b9f:	bf 01 00 00 00       	mov    $0x1,%edi
+f0101ba4:	be e0 55 2b f0       	mov    $0xf02b55e0,%esi
+f0101ba9:	eb 19                	jmp    f0101bc4 <tlb_shootdown+0x5a>
+f0101bab:	81 c3 94 00 00 00    	add    $0x94,%ebx
+f0101bb1:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f0101bb8:	00 00 00 
+f0101bbb:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0101bc0:	39 c3                	cmp    %eax,%ebx
+f0101bc2:	73 3a                	jae    f0101bfe <tlb_shootdown+0x94>
+f0101bc4:	89 d9                	mov    %ebx,%ecx
+f0101bc6:	81 e9 20 20 2d f0    	sub    $0xf02d2020,%ecx
+f0101bcc:	c1 f9 02             	sar    $0x2,%ecx
+f0101bcf:	69 c9 ad 1b 4c 91    	imul   $0x914c1bad,%ecx,%ecx
+f0101bd5:	89 f8                	mov    %edi,%eax
+f0101bd7:	d3 e0                	shl    %cl,%eax
+f0101bd9:	23 86 04 01 00 00    	and    0x104(%esi),%eax
+f0101bdf:	74 ca                	je     f0101bab <tlb_shootdown+0x41>
+f0101be1:	c7 83 88 00 00 00 01 	movl   $0x1,0x88(%ebx)
+f0101be8:	00 00 00 
+f0101beb:	83 ec 08             	sub    $0x8,%esp
+f0101bee:	6a 35                	push   $0x35
+f0101bf0:	0f b6 03             	movzbl (%ebx),%eax
+f0101bf3:	50                   	push   %eax
+f0101bf4:	e8 e1 96 00 00       	call   f010b2da <lapic_ipi_dest>
+f0101bf9:	83 c4 10             	add    $0x10,%esp
+f0101bfc:	eb ad                	jmp    f0101bab <tlb_shootdown+0x41>
+f0101bfe:	3d 20 20 2d f0       	cmp    $0xf02d2020,%eax
+f0101c03:	76 6b                	jbe    f0101c70 <tlb_shootdown+0x106>
+f0101c05:	b8 20 20 2d f0       	mov    $0xf02d2020,%eax
+f0101c0a:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0101c0f:	ba e0 55 2b f0       	mov    $0xf02b55e0,%edx
+f0101c14:	eb 19                	jmp    f0101c2f <tlb_shootdown+0xc5>
+f0101c16:	05 94 00 00 00       	add    $0x94,%eax
+f0101c1b:	69 0d c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%ecx
+f0101c22:	00 00 00 
+f0101c25:	81 c1 20 20 2d f0    	add    $0xf02d2020,%ecx
+f0101c2b:	39 c8                	cmp    %ecx,%eax
+f0101c2d:	73 41                	jae    f0101c70 <tlb_shootdown+0x106>
+f0101c2f:	89 c1                	mov    %eax,%ecx
+f0101c31:	81 e9 20 20 2d f0    	sub    $0xf02d2020,%ecx
+f0101c37:	c1 f9 02             	sar    $0x2,%ecx
+f0101c3a:	69 c9 ad 1b 4c 91    	imul   $0x914c1bad,%ecx,%ecx
+f0101c40:	89 de                	mov    %ebx,%esi
+f0101c42:	d3 e6                	shl    %cl,%esi
+f0101c44:	89 f1                	mov    %esi,%ecx
+f0101c46:	23 8a 04 01 00 00    	and    0x104(%edx),%ecx
+f0101c4c:	74 c8                	je     f0101c16 <tlb_shootdown+0xac>
+f0101c4e:	8b 88 88 00 00 00    	mov    0x88(%eax),%ecx
+f0101c54:	85 c9                	test   %ecx,%ecx
+f0101c56:	74 be                	je     f0101c16 <tlb_shootdown+0xac>
+f0101c58:	8b 88 84 00 00 00    	mov    0x84(%eax),%ecx
+f0101c5e:	85 c9                	test   %ecx,%ecx
+f0101c60:	75 b4                	jne    f0101c16 <tlb_shootdown+0xac>
+f0101c62:	f3 90                	pause
+f0101c64:	8b 88 88 00 00 00    	mov    0x88(%eax),%ecx
+f0101c6a:	85 c9                	test   %ecx,%ecx
+f0101c6c:	75 ea                	jne    f0101c58 <tlb_shootdown+0xee>
+f0101c6e:	eb a6                	jmp    f0101c16 <tlb_shootdown+0xac>
+f0101c70:	c7 05 e0 55 2b f0 00 	movl   $0x0,0xf02b55e0
+f0101c77:	00 00 00 
+f0101c7a:	c7 05 e4 56 2b f0 00 	movl   $0x0,0xf02b56e4
+f0101c81:	00 00 00 
+f0101c84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101c87:	5b                   	pop    %ebx
+f0101c88:	5e                   	pop    %esi
+f0101c89:	5f                   	pop    %edi
+f0101c8a:	5d                   	pop    %ebp
+f0101c8b:	c3                   	ret
+f0101c8c:	c3                   	ret
+
+f0101c8d <page_alloc>:
+f0101c8d:	55                   	push   %ebp
+f0101c8e:	89 e5                	mov    %esp,%ebp
+f0101c90:	57                   	push   %edi
+f0101c91:	56                   	push   %esi
+f0101c92:	53                   	push   %ebx
+f0101c93:	83 ec 0c             	sub    $0xc,%esp
+f0101c96:	e8 b6 92 00 00       	call   f010af51 <cpunum>
+f0101c9b:	89 c7                	mov    %eax,%edi
+f0101c9d:	e8 c8 fe ff ff       	call   f0101b6a <tlb_shootdown>
+f0101ca2:	8b 75 08             	mov    0x8(%ebp),%esi
+f0101ca5:	83 e6 01             	and    $0x1,%esi
+f0101ca8:	75 2e                	jne    f0101cd8 <page_alloc+0x4b>
+f0101caa:	83 3d e8 56 2b f0 00 	cmpl   $0x0,0xf02b56e8
+f0101cb1:	75 3b                	jne    f0101cee <page_alloc+0x61>
+f0101cb3:	8b 1d 70 57 2b f0    	mov    0xf02b5770,%ebx
+f0101cb9:	85 db                	test   %ebx,%ebx
+f0101cbb:	74 28                	je     f0101ce5 <page_alloc+0x58>
+f0101cbd:	8b 03                	mov    (%ebx),%eax
+f0101cbf:	a3 70 57 2b f0       	mov    %eax,0xf02b5770
+f0101cc4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+f0101cca:	85 f6                	test   %esi,%esi
+f0101ccc:	75 68                	jne    f0101d36 <page_alloc+0xa9>
+f0101cce:	89 d8                	mov    %ebx,%eax
+f0101cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101cd3:	5b                   	pop    %ebx
+f0101cd4:	5e                   	pop    %esi
+f0101cd5:	5f                   	pop    %edi
+f0101cd6:	5d                   	pop    %ebp
+f0101cd7:	c3                   	ret
+f0101cd8:	e8 0c f7 ff ff       	call   f01013e9 <page_zero_pop>
+f0101cdd:	89 c3                	mov    %eax,%ebx
+f0101cdf:	85 c0                	test   %eax,%eax
+f0101ce1:	75 eb                	jne    f0101cce <page_alloc+0x41>
+f0101ce3:	eb c5                	jmp    f0101caa <page_alloc+0x1d>
+f0101ce5:	e8 ff f6 ff ff       	call   f01013e9 <page_zero_pop>
+f0101cea:	89 c3                	mov    %eax,%ebx
+f0101cec:	eb e0                	jmp    f0101cce <page_alloc+0x41>
+f0101cee:	69 c7 94 00 00 00    	imul   $0x94,%edi,%eax
+f0101cf4:	8b 98 98 20 2d f0    	mov    -0xfd2df68(%eax),%ebx
+f0101cfa:	85 db                	test   %ebx,%ebx
+f0101cfc:	74 19                	je     f0101d17 <page_alloc+0x8a>
+f0101cfe:	8b 13                	mov    (%ebx),%edx
+f0101d00:	69 c7 94 00 00 00    	imul   $0x94,%edi,%eax
+f0101d06:	89 90 98 20 2d f0    	mov    %edx,-0xfd2df68(%eax)
+f0101d0c:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0101d11:	83 68 7c 01          	subl   $0x1,0x7c(%eax)
+f0101d15:	eb ad                	jmp    f0101cc4 <page_alloc+0x37>
+f0101d17:	89 c3                	mov    %eax,%ebx
+f0101d19:	81 c3 20 20 2d f0    	add    $0xf02d2020,%ebx
+f0101d1f:	89 d8                	mov    %ebx,%eax
+f0101d21:	e8 35 fb ff ff       	call   f010185b <page_cache_refill>
+f0101d26:	8b 5b 78             	mov    0x78(%ebx),%ebx
+f0101d29:	85 db                	test   %ebx,%ebx
+f0101d2b:	75 d1                	jne    f0101cfe <page_alloc+0x71>
+f0101d2d:	e8 b7 f6 ff ff       	call   f01013e9 <page_zero_pop>
+f0101d32:	89 c3                	mov    %eax,%ebx
+f0101d34:	eb 98                	jmp    f0101cce <page_alloc+0x41>
+f0101d36:	89 d8                	mov    %ebx,%eax
+f0101d38:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0101d3e:	c1 f8 02             	sar    $0x2,%eax
+f0101d41:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101d47:	89 c2                	mov    %eax,%edx
+f0101d49:	c1 e2 0c             	shl    $0xc,%edx
+f0101d4c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101d51:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0101d57:	73 1e                	jae    f0101d77 <page_alloc+0xea>
+f0101d59:	83 ec 04             	sub    $0x4,%esp
+f0101d5c:	68 00 10 00 00       	push   $0x1000
+f0101d61:	6a 00                	push   $0x0
+f0101d63:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101d69:	52                   	push   %edx
+f0101d6a:	e8 85 8b 00 00       	call   f010a8f4 <memset>
+f0101d6f:	83 c4 10             	add    $0x10,%esp
+f0101d72:	e9 57 ff ff ff       	jmp    f0101cce <page_alloc+0x41>
+f0101d77:	52                   	push   %edx
+f0101d78:	68 24 d0 10 f0       	push   $0xf010d024
+f0101d7d:	6a 61                	push   $0x61
+f0101d7f:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0101d84:	e8 b7 e2 ff ff       	call   f0100040 <_panic>
+
+f0101d89 <tlb_invalidate>:
+f0101d89:	55                   	push   %ebp
+f0101d8a:	89 e5                	mov    %esp,%ebp
+f0101d8c:	57                   	push   %edi
+f0101d8d:	56                   	push   %esi
+f0101d8e:	53                   	push   %ebx
+f0101d8f:	83 ec 0c             	sub    $0xc,%esp
+f0101d92:	8b 75 08             	mov    0x8(%ebp),%esi
+f0101d95:	e8 b7 91 00 00       	call   f010af51 <cpunum>
+f0101d9a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0101da0:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0101da7:	74 16                	je     f0101dbf <tlb_invalidate+0x36>
+f0101da9:	e8 a3 91 00 00       	call   f010af51 <cpunum>
+f0101dae:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0101db4:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0101dba:	39 70 78             	cmp    %esi,0x78(%eax)
+f0101dbd:	75 06                	jne    f0101dc5 <tlb_invalidate+0x3c>
+f0101dbf:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101dc2:	0f 01 38             	invlpg (%eax)
+f0101dc5:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f0101dcc:	00 00 00 
+f0101dcf:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0101dd4:	3d 20 20 2d f0       	cmp    $0xf02d2020,%eax
+f0101dd9:	0f 86 8f 00 00 00    	jbe    f0101e6e <tlb_invalidate+0xe5>
+f0101ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101de4:	bb 20 20 2d f0       	mov    $0xf02d2020,%ebx
+f0101de9:	eb 19                	jmp    f0101e04 <tlb_invalidate+0x7b>
+f0101deb:	81 c3 94 00 00 00    	add    $0x94,%ebx
+f0101df1:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f0101df8:	00 00 00 
+f0101dfb:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0101e00:	39 c3                	cmp    %eax,%ebx
+f0101e02:	73 38                	jae    f0101e3c <tlb_invalidate+0xb3>
+f0101e04:	e8 48 91 00 00       	call   f010af51 <cpunum>
+f0101e09:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0101e0f:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0101e14:	39 c3                	cmp    %eax,%ebx
+f0101e16:	74 d3                	je     f0101deb <tlb_invalidate+0x62>
+f0101e18:	39 b3 80 00 00 00    	cmp    %esi,0x80(%ebx)
+f0101e1e:	75 cb                	jne    f0101deb <tlb_invalidate+0x62>
+f0101e20:	89 d9                	mov    %ebx,%ecx
+f0101e22:	81 e9 20 20 2d f0    	sub    $0xf02d2020,%ecx
+f0101e28:	c1 f9 02             	sar    $0x2,%ecx
+f0101e2b:	69 c9 ad 1b 4c 91    	imul   $0x914c1bad,%ecx,%ecx
+f0101e31:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101e36:	d3 e0                	shl    %cl,%eax
+f0101e38:	09 c7                	or     %eax,%edi
+f0101e3a:	eb af                	jmp    f0101deb <tlb_invalidate+0x62>
+f0101e3c:	85 ff                	test   %edi,%edi
+f0101e3e:	74 2e                	je     f0101e6e <tlb_invalidate+0xe5>
+f0101e40:	83 3d e0 55 2b f0 20 	cmpl   $0x20,0xf02b55e0
+f0101e47:	74 2d                	je     f0101e76 <tlb_invalidate+0xed>
+f0101e49:	a1 e0 55 2b f0       	mov    0xf02b55e0,%eax
+f0101e4e:	89 34 85 e4 55 2b f0 	mov    %esi,-0xfd4aa1c(,%eax,4)
+f0101e55:	8d 50 01             	lea    0x1(%eax),%edx
+f0101e58:	89 15 e0 55 2b f0    	mov    %edx,0xf02b55e0
+f0101e5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0101e61:	89 14 85 64 56 2b f0 	mov    %edx,-0xfd4a99c(,%eax,4)
+f0101e68:	09 3d e4 56 2b f0    	or     %edi,0xf02b56e4
+f0101e6e:	83 c4 0c             	add    $0xc,%esp
+f0101e71:	5b                   	pop    %ebx
+f0101e72:	5e                   	pop    %esi
+f0101e73:	5f                   	pop    %edi
+f0101e74:	5d                   	pop    %ebp
+f0101e75:	c3                   	ret
+f0101e76:	e8 ef fc ff ff       	call   f0101b6a <tlb_shootdown>
+f0101e7b:	eb cc                	jmp    f0101e49 <tlb_invalidate+0xc0>
+
+f0101e7d <page_insert_large>:
+f0101e7d:	55                   	push   %ebp
+f0101e7e:	89 e5                	mov    %esp,%ebp
+f0101e80:	57                   	push   %edi
+f0101e81:	56                   	push   %esi
+f0101e82:	53                   	push   %ebx
+f0101e83:	83 ec 0c             	sub    $0xc,%esp
+f0101e86:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0101e89:	8b 75 10             	mov    0x10(%ebp),%esi
+f0101e8c:	f7 c6 ff ff 3f 00    	test   $0x3fffff,%esi
+f0101e92:	75 63                	jne    f0101ef7 <page_insert_large+0x7a>
+f0101e94:	89 d1                	mov    %edx,%ecx
+f0101e96:	2b 0d 70 1a 2d f0    	sub    0xf02d1a70,%ecx
+f0101e9c:	c1 f9 02             	sar    $0x2,%ecx
+f0101e9f:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+f0101ea5:	c1 e1 0c             	shl    $0xc,%ecx
+f0101ea8:	89 cb                	mov    %ecx,%ebx
+f0101eaa:	81 e3 ff ff 3f 00    	and    $0x3fffff,%ebx
+f0101eb0:	75 4c                	jne    f0101efe <page_insert_large+0x81>
+f0101eb2:	89 f0                	mov    %esi,%eax
+f0101eb4:	c1 e8 16             	shr    $0x16,%eax
+f0101eb7:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0101eba:	8d 3c 87             	lea    (%edi,%eax,4),%edi
+f0101ebd:	f6 07 01             	testb  $0x1,(%edi)
+f0101ec0:	75 43                	jne    f0101f05 <page_insert_large+0x88>
+f0101ec2:	8d 42 04             	lea    0x4(%edx),%eax
+f0101ec5:	81 c2 04 30 00 00    	add    $0x3004,%edx
+f0101ecb:	66 83 00 01          	addw   $0x1,(%eax)
+f0101ecf:	83 c0 0c             	add    $0xc,%eax
+f0101ed2:	39 d0                	cmp    %edx,%eax
+f0101ed4:	75 f5                	jne    f0101ecb <page_insert_large+0x4e>
+f0101ed6:	0b 4d 14             	or     0x14(%ebp),%ecx
+f0101ed9:	80 c9 81             	or     $0x81,%cl
+f0101edc:	89 0f                	mov    %ecx,(%edi)
+f0101ede:	83 ec 08             	sub    $0x8,%esp
+f0101ee1:	56                   	push   %esi
+f0101ee2:	ff 75 08             	push   0x8(%ebp)
+f0101ee5:	e8 9f fe ff ff       	call   f0101d89 <tlb_invalidate>
+f0101eea:	83 c4 10             	add    $0x10,%esp
+f0101eed:	89 d8                	mov    %ebx,%eax
+f0101eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101ef2:	5b                   	pop    %ebx
+f0101ef3:	5e                   	pop    %esi
+f0101ef4:	5f                   	pop    %edi
+f0101ef5:	5d                   	pop    %ebp
+f0101ef6:	c3                   	ret
+f0101ef7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0101efc:	eb ef                	jmp    f0101eed <page_insert_large+0x70>
+f0101efe:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0101f03:	eb e8                	jmp    f0101eed <page_insert_large+0x70>
+f0101f05:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0101f0a:	eb e1                	jmp    f0101eed <page_insert_large+0x70>
+
+f0101f0c <pgdir_walk>:
+f0101f0c:	55                   	push   %ebp
+f0101f0d:	89 e5                	mov    %esp,%ebp
+f0101f0f:	57                   	push   %edi
+f0101f10:	56                   	push   %esi
+f0101f11:	53                   	push   %ebx
+f0101f12:	83 ec 1c             	sub    $0x1c,%esp
+f0101f15:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0101f19:	0f 84 a9 00 00 00    	je     f0101fc8 <pgdir_walk+0xbc>
+f0101f1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101f22:	c1 e8 16             	shr    $0x16,%eax
+f0101f25:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0101f28:	8d 04 87             	lea    (%edi,%eax,4),%eax
+f0101f2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0101f2e:	8b 18                	mov    (%eax),%ebx
+f0101f30:	89 d8                	mov    %ebx,%eax
+f0101f32:	25 81 00 00 00       	and    $0x81,%eax
+f0101f37:	3d 81 00 00 00       	cmp    $0x81,%eax
+f0101f3c:	0f 84 9d 00 00 00    	je     f0101fdf <pgdir_walk+0xd3>
+f0101f42:	f6 c3 01             	test   $0x1,%bl
+f0101f45:	0f 85 40 01 00 00    	jne    f010208b <pgdir_walk+0x17f>
+f0101f4b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0101f4f:	0f 84 8c 01 00 00    	je     f01020e1 <pgdir_walk+0x1d5>
+f0101f55:	83 ec 0c             	sub    $0xc,%esp
+f0101f58:	6a 01                	push   $0x1
+f0101f5a:	e8 2e fd ff ff       	call   f0101c8d <page_alloc>
+f0101f5f:	89 c7                	mov    %eax,%edi
+f0101f61:	83 c4 10             	add    $0x10,%esp
+f0101f64:	85 c0                	test   %eax,%eax
+f0101f66:	74 56                	je     f0101fbe <pgdir_walk+0xb2>
+f0101f68:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f0101f6d:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0101f73:	c1 f8 02             	sar    $0x2,%eax
+f0101f76:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101f7c:	c1 e0 0c             	shl    $0xc,%eax
+f0101f7f:	83 c8 07             	or     $0x7,%eax
+f0101f82:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0101f85:	89 06                	mov    %eax,(%esi)
+f0101f87:	2b 3d 70 1a 2d f0    	sub    0xf02d1a70,%edi
+f0101f8d:	c1 ff 02             	sar    $0x2,%edi
+f0101f90:	69 c7 ab aa aa aa    	imul   $0xaaaaaaab,%edi,%eax
+f0101f96:	89 c2                	mov    %eax,%edx
+f0101f98:	c1 e2 0c             	shl    $0xc,%edx
+f0101f9b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101fa0:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0101fa6:	0f 83 23 01 00 00    	jae    f01020cf <pgdir_walk+0x1c3>
+f0101fac:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101faf:	c1 e8 0a             	shr    $0xa,%eax
+f0101fb2:	25 fc 0f 00 00       	and    $0xffc,%eax
+f0101fb7:	8d bc 02 00 00 00 f0 	lea    -0x10000000(%edx,%eax,1),%edi
+f0101fbe:	89 f8                	mov    %edi,%eax
+f0101fc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101fc3:	5b                   	pop    %ebx
+f0101fc4:	5e                   	pop    %esi
+f0101fc5:	5f                   	pop    %edi
+f0101fc6:	5d                   	pop    %ebp
+f0101fc7:	c3                   	ret
+f0101fc8:	83 ec 04             	sub    $0x4,%esp
+f0101fcb:	68 e4 e2 10 f0       	push   $0xf010e2e4
+f0101fd0:	68 24 04 00 00       	push   $0x424
+f0101fd5:	68 22 e2 10 f0       	push   $0xf010e222
+f0101fda:	e8 61 e0 ff ff       	call   f0100040 <_panic>
+f0101fdf:	83 ec 0c             	sub    $0xc,%esp
+f0101fe2:	6a 00                	push   $0x0
+f0101fe4:	e8 a4 fc ff ff       	call   f0101c8d <page_alloc>
+f0101fe9:	89 c7                	mov    %eax,%edi
+f0101feb:	83 c4 10             	add    $0x10,%esp
+f0101fee:	85 c0                	test   %eax,%eax
+f0101ff0:	74 cc                	je     f0101fbe <pgdir_walk+0xb2>
+f0101ff2:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f0101ff7:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0101ffd:	c1 f8 02             	sar    $0x2,%eax
+f0102000:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102006:	89 c1                	mov    %eax,%ecx
+f0102008:	c1 e1 0c             	shl    $0xc,%ecx
+f010200b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102010:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0102016:	73 61                	jae    f0102079 <pgdir_walk+0x16d>
+f0102018:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f010201e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0102023:	89 de                	mov    %ebx,%esi
+f0102025:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f010202b:	81 e3 67 0e 00 00    	and    $0xe67,%ebx
+f0102031:	8d 14 06             	lea    (%esi,%eax,1),%edx
+f0102034:	09 da                	or     %ebx,%edx
+f0102036:	89 11                	mov    %edx,(%ecx)
+f0102038:	05 00 10 00 00       	add    $0x1000,%eax
+f010203d:	83 c1 04             	add    $0x4,%ecx
+f0102040:	3d 00 00 40 00       	cmp    $0x400000,%eax
+f0102045:	75 ea                	jne    f0102031 <pgdir_walk+0x125>
+f0102047:	2b 3d 70 1a 2d f0    	sub    0xf02d1a70,%edi
+f010204d:	c1 ff 02             	sar    $0x2,%edi
+f0102050:	69 c7 ab aa aa aa    	imul   $0xaaaaaaab,%edi,%eax
+f0102056:	c1 e0 0c             	shl    $0xc,%eax
+f0102059:	83 c8 07             	or     $0x7,%eax
+f010205c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010205f:	89 07                	mov    %eax,(%edi)
+f0102061:	83 ec 08             	sub    $0x8,%esp
+f0102064:	ff 75 0c             	push   0xc(%ebp)
+f0102067:	ff 75 08             	push   0x8(%ebp)
+f010206a:	e8 1a fd ff ff       	call   f0101d89 <tlb_invalidate>
+f010206f:	8b 1f                	mov    (%edi),%ebx
+f0102071:	83 c4 10             	add    $0x10,%esp
+f0102074:	e9 c9 fe ff ff       	jmp    f0101f42 <pgdir_walk+0x36>
+f0102079:	51                   	push   %ecx
+f010207a:	68 24 d0 10 f0       	push   $0xf010d024
+f010207f:	6a 61                	push   $0x61
+f0102081:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0102086:	e8 b5 df ff ff       	call   f0100040 <_panic>
+f010208b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010208e:	8b 00                	mov    (%eax),%eax
+f0102090:	89 c2                	mov    %eax,%edx
+f0102092:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102098:	c1 e8 0c             	shr    $0xc,%eax
+f010209b:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f01020a1:	73 17                	jae    f01020ba <pgdir_walk+0x1ae>
+f01020a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01020a6:	c1 e8 0a             	shr    $0xa,%eax
+f01020a9:	25 fc 0f 00 00       	and    $0xffc,%eax
+f01020ae:	8d bc 02 00 00 00 f0 	lea    -0x10000000(%edx,%eax,1),%edi
+f01020b5:	e9 04 ff ff ff       	jmp    f0101fbe <pgdir_walk+0xb2>
+f01020ba:	52                   	push   %edx
+f01020bb:	68 24 d0 10 f0       	push   $0xf010d024
+f01020c0:	68 32 04 00 00       	push   $0x432
+f01020c5:	68 22 e2 10 f0       	push   $0xf010e222
+f01020ca:	e8 71 df ff ff       	call   f0100040 <_panic>
+f01020cf:	52                   	push   %edx
+f01020d0:	68 24 d0 10 f0       	push   $0xf010d024
+f01020d5:	6a 61                	push   $0x61
+f01020d7:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01020dc:	e8 5f df ff ff       	call   f0100040 <_panic>
+f01020e1:	bf 00 00 00 00       	mov    $0x0,%edi
+f01020e6:	e9 d3 fe ff ff       	jmp    f0101fbe <pgdir_walk+0xb2>
+
+f01020eb <boot_map_region>:
+f01020eb:	55                   	push   %ebp
+f01020ec:	89 e5                	mov    %esp,%ebp
+f01020ee:	57                   	push   %edi
+f01020ef:	56                   	push   %esi
+f01020f0:	53                   	push   %ebx
+f01020f1:	83 ec 1c             	sub    $0x1c,%esp
+f01020f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01020f7:	8b 45 10             	mov    0x10(%ebp),%eax
+f01020fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+f01020fd:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f0102102:	75 58                	jne    f010215c <boot_map_region+0x71>
+f0102104:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f010210a:	75 69                	jne    f0102175 <boot_map_region+0x8a>
+f010210c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+f0102112:	75 7a                	jne    f010218e <boot_map_region+0xa3>
+f0102114:	85 c0                	test   %eax,%eax
+f0102116:	74 3c                	je     f0102154 <boot_map_region+0x69>
+f0102118:	89 d3                	mov    %edx,%ebx
+f010211a:	29 d7                	sub    %edx,%edi
+f010211c:	01 d0                	add    %edx,%eax
+f010211e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0102121:	89 55 0c             	mov    %edx,0xc(%ebp)
+f0102124:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+f0102127:	83 ec 04             	sub    $0x4,%esp
+f010212a:	6a 01                	push   $0x1
+f010212c:	53                   	push   %ebx
+f010212d:	ff 75 08             	push   0x8(%ebp)
+f0102130:	e8 d7 fd ff ff       	call   f0101f0c <pgdir_walk>
+f0102135:	83 c4 10             	add    $0x10,%esp
+f0102138:	85 c0                	test   %eax,%eax
+f010213a:	74 18                	je     f0102154 <boot_map_region+0x69>
+f010213c:	0b 75 18             	or     0x18(%ebp),%esi
+f010213f:	83 ce 01             	or     $0x1,%esi
+f0102142:	89 30                	mov    %esi,(%eax)
+f0102144:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010214a:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+f010214d:	74 05                	je     f0102154 <boot_map_region+0x69>
+f010214f:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+f0102152:	73 d0                	jae    f0102124 <boot_map_region+0x39>
+f0102154:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102157:	5b                   	pop    %ebx
+f0102158:	5e                   	pop    %esi
+f0102159:	5f                   	pop    %edi
+f010215a:	5d                   	pop    %ebp
+f010215b:	c3                   	ret
+f010215c:	68 ff e2 10 f0       	push   $0xf010e2ff
+f0102161:	68 0d e2 10 f0       	push   $0xf010e20d
+f0102166:	68 51 04 00 00       	push   $0x451
+f010216b:	68 22 e2 10 f0       	push   $0xf010e222
+f0102170:	e8 cb de ff ff       	call   f0100040 <_panic>
+f0102175:	68 12 e3 10 f0       	push   $0xf010e312
+f010217a:	68 0d e2 10 f0       	push   $0xf010e20d
+f010217f:	68 52 04 00 00       	push   $0x452
+f0102184:	68 22 e2 10 f0       	push   $0xf010e222
+f0102189:	e8 b2 de ff ff       	call   f0100040 <_panic>
+f010218e:	68 23 e3 10 f0       	push   $0xf010e323
+f0102193:	68 0d e2 10 f0       	push   $0xf010e20d
+f0102198:	68 53 04 00 00       	push   $0x453
+f010219d:	68 22 e2 10 f0       	push   $0xf010e222
+f01021a2:	e8 99 de ff ff       	call   f0100040 <_panic>
+
+f01021a7 <page_lookup>:
+f01021a7:	55                   	push   %ebp
+f01021a8:	89 e5                	mov    %esp,%ebp
+f01021aa:	53                   	push   %ebx
+f01021ab:	83 ec 08             	sub    $0x8,%esp
+f01021ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f01021b1:	6a 00                	push   $0x0
+f01021b3:	ff 75 0c             	push   0xc(%ebp)
+f01021b6:	ff 75 08             	push   0x8(%ebp)
+f01021b9:	e8 4e fd ff ff       	call   f0101f0c <pgdir_walk>
+f01021be:	83 c4 10             	add    $0x10,%esp
+f01021c1:	85 c0                	test   %eax,%eax
+f01021c3:	74 3f                	je     f0102204 <page_lookup+0x5d>
+f01021c5:	8b 10                	mov    (%eax),%edx
+f01021c7:	f6 c2 01             	test   $0x1,%dl
+f01021ca:	74 3c                	je     f0102208 <page_lookup+0x61>
+f01021cc:	c1 ea 0c             	shr    $0xc,%edx
+f01021cf:	3b 15 68 1a 2d f0    	cmp    0xf02d1a68,%edx
+f01021d5:	73 19                	jae    f01021f0 <page_lookup+0x49>
+f01021d7:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+f01021da:	8b 15 70 1a 2d f0    	mov    0xf02d1a70,%edx
+f01021e0:	8d 14 8a             	lea    (%edx,%ecx,4),%edx
+f01021e3:	85 db                	test   %ebx,%ebx
+f01021e5:	74 02                	je     f01021e9 <page_lookup+0x42>
+f01021e7:	89 03                	mov    %eax,(%ebx)
+f01021e9:	89 d0                	mov    %edx,%eax
+f01021eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01021ee:	c9                   	leave
+f01021ef:	c3                   	ret
+f01021f0:	83 ec 04             	sub    $0x4,%esp
+f01021f3:	68 44 d7 10 f0       	push   $0xf010d744
+f01021f8:	6a 5a                	push   $0x5a
+f01021fa:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01021ff:	e8 3c de ff ff       	call   f0100040 <_panic>
+f0102204:	89 c2                	mov    %eax,%edx
+f0102206:	eb e1                	jmp    f01021e9 <page_lookup+0x42>
+f0102208:	ba 00 00 00 00       	mov    $0x0,%edx
+f010220d:	eb da                	jmp    f01021e9 <page_lookup+0x42>
+
+f010220f <page_remove>:
+f010220f:	55                   	push   %ebp
+f0102210:	89 e5                	mov    %esp,%ebp
+f0102212:	56                   	push   %esi
+f0102213:	53                   	push   %ebx
+f0102214:	83 ec 14             	sub    $0x14,%esp
+f0102217:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010221a:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010221d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0102220:	50                   	push   %eax
+f0102221:	56                   	push   %esi
+f0102222:	53                   	push   %ebx
+f0102223:	e8 7f ff ff ff       	call   f01021a7 <page_lookup>
+f0102228:	83 c4 10             	add    $0x10,%esp
+f010222b:	85 c0                	test   %eax,%eax
+f010222d:	74 1f                	je     f010224e <page_remove+0x3f>
+f010222f:	83 ec 0c             	sub    $0xc,%esp
+f0102232:	50                   	push   %eax
+f0102233:	e8 96 f8 ff ff       	call   f0101ace <page_decref>
+f0102238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010223b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0102241:	83 c4 08             	add    $0x8,%esp
+f0102244:	56                   	push   %esi
+f0102245:	53                   	push   %ebx
+f0102246:	e8 3e fb ff ff       	call   f0101d89 <tlb_invalidate>
+f010224b:	83 c4 10             	add    $0x10,%esp
+f010224e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0102251:	5b                   	pop    %ebx
+f0102252:	5e                   	pop    %esi
+f0102253:	5d                   	pop    %ebp
+f0102254:	c3                   	ret
+
+f0102255 <page_insert>:
+f0102255:	55                   	push   %ebp
+f0102256:	89 e5                	mov    %esp,%ebp
+f0102258:	57                   	push   %edi
+f0102259:	56                   	push   %esi
+f010225a:	53                   	push   %ebx
+f010225b:	83 ec 10             	sub    $0x10,%esp
+f010225e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0102261:	6a 01                	push   $0x1
+f0102263:	ff 75 10             	push   0x10(%ebp)
+f0102266:	ff 75 08             	push   0x8(%ebp)
+f0102269:	e8 9e fc ff ff       	call   f0101f0c <pgdir_walk>
+f010226e:	89 fb                	mov    %edi,%ebx
+f0102270:	2b 1d 70 1a 2d f0    	sub    0xf02d1a70,%ebx
+f0102276:	c1 fb 02             	sar    $0x2,%ebx
+f0102279:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f010227f:	c1 e3 0c             	shl    $0xc,%ebx
+f0102282:	83 c4 10             	add    $0x10,%esp
+f0102285:	85 c0                	test   %eax,%eax
+f0102287:	74 45                	je     f01022ce <page_insert+0x79>
+f0102289:	89 c6                	mov    %eax,%esi
+f010228b:	66 83 47 04 01       	addw   $0x1,0x4(%edi)
+f0102290:	f6 00 01             	testb  $0x1,(%eax)
+f0102293:	75 26                	jne    f01022bb <page_insert+0x66>
+f0102295:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0102298:	83 cb 01             	or     $0x1,%ebx
+f010229b:	89 1e                	mov    %ebx,(%esi)
+f010229d:	83 ec 08             	sub    $0x8,%esp
+f01022a0:	ff 75 10             	push   0x10(%ebp)
+f01022a3:	ff 75 08             	push   0x8(%ebp)
+f01022a6:	e8 de fa ff ff       	call   f0101d89 <tlb_invalidate>
+f01022ab:	83 c4 10             	add    $0x10,%esp
+f01022ae:	b8 00 00 00 00       	mov    $0x0,%eax
+f01022b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01022b6:	5b                   	pop    %ebx
+f01022b7:	5e                   	pop    %esi
+f01022b8:	5f                   	pop    %edi
+f01022b9:	5d                   	pop    %ebp
+f01022ba:	c3                   	ret
+f01022bb:	83 ec 08             	sub    $0x8,%esp
+f01022be:	ff 75 10             	push   0x10(%ebp)
+f01022c1:	ff 75 08             	push   0x8(%ebp)
+f01022c4:	e8 46 ff ff ff       	call   f010220f <page_remove>
+f01022c9:	83 c4 10             	add    $0x10,%esp
+f01022cc:	eb c7                	jmp    f0102295 <page_insert+0x40>
+f01022ce:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01022d3:	eb de                	jmp    f01022b3 <page_insert+0x5e>
+
+f01022d5 <mem_init>:
+f01022d5:	55                   	push   %ebp
+f01022d6:	89 e5                	mov    %esp,%ebp
+f01022d8:	57                   	push   %edi
+f01022d9:	56                   	push   %esi
+f01022da:	53                   	push   %ebx
+f01022db:	81 ec a8 00 00 00    	sub    $0xa8,%esp
+f01022e1:	6a 15                	push   $0x15
+f01022e3:	e8 3e 38 00 00       	call   f0105b26 <mc146818_read>
+f01022e8:	89 c3                	mov    %eax,%ebx
+f01022ea:	c7 04 24 16 00 00 00 	movl   $0x16,(%esp)
+f01022f1:	e8 30 38 00 00       	call   f0105b26 <mc146818_read>
+f01022f6:	c1 e0 08             	shl    $0x8,%eax
+f01022f9:	09 d8                	or     %ebx,%eax
+f01022fb:	8d 50 03             	lea    0x3(%eax),%edx
+f01022fe:	85 c0                	test   %eax,%eax
+f0102300:	0f 48 c2             	cmovs  %edx,%eax
+f0102303:	c1 f8 02             	sar    $0x2,%eax
+f0102306:	a3 74 57 2b f0       	mov    %eax,0xf02b5774
+f010230b:	c7 04 24 17 00 00 00 	movl   $0x17,(%esp)
+f0102312:	e8 0f 38 00 00       	call   f0105b26 <mc146818_read>
+f0102317:	89 c3                	mov    %eax,%ebx
+f0102319:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+f0102320:	e8 01 38 00 00       	call   f0105b26 <mc146818_read>
+f0102325:	c1 e0 08             	shl    $0x8,%eax
+f0102328:	89 c2                	mov    %eax,%edx
+f010232a:	09 da                	or     %ebx,%edx
+f010232c:	8d 42 03             	lea    0x3(%edx),%eax
+f010232f:	83 c4 10             	add    $0x10,%esp
+f0102332:	85 d2                	test   %edx,%edx
+f0102334:	0f 49 c2             	cmovns %edx,%eax
+f0102337:	c1 f8 02             	sar    $0x2,%eax
+f010233a:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+f0102340:	0f 44 15 74 57 2b f0 	cmove  0xf02b5774,%edx
+f0102347:	89 15 68 1a 2d f0    	mov    %edx,0xf02d1a68
+f010234d:	c1 e0 0c             	shl    $0xc,%eax
+f0102350:	c1 e8 0a             	shr    $0xa,%eax
+f0102353:	50                   	push   %eax
+f0102354:	a1 74 57 2b f0       	mov    0xf02b5774,%eax
+f0102359:	c1 e0 0c             	shl    $0xc,%eax
+f010235c:	c1 e8 0a             	shr    $0xa,%eax
+f010235f:	50                   	push   %eax
+f0102360:	c1 e2 0c             	shl    $0xc,%edx
+f0102363:	c1 ea 0a             	shr    $0xa,%edx
+f0102366:	52                   	push   %edx
+f0102367:	68 dc da 10 f0       	push   $0xf010dadc
+f010236c:	e8 96 39 00 00       	call   f0105d07 <cprintf>
+f0102371:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0102376:	e8 fa ee ff ff       	call   f0101275 <boot_alloc>
+f010237b:	a3 6c 1a 2d f0       	mov    %eax,0xf02d1a6c
+f0102380:	83 c4 0c             	add    $0xc,%esp
+f0102383:	68 00 10 00 00       	push   $0x1000
+f0102388:	6a 00                	push   $0x0
+f010238a:	50                   	push   %eax
+f010238b:	e8 64 85 00 00       	call   f010a8f4 <memset>
+f0102390:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f0102395:	83 c4 10             	add    $0x10,%esp
+f0102398:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010239d:	0f 86 c6 0b 00 00    	jbe    f0102f69 <mem_init+0xc94>
+f01023a3:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f01023a9:	83 ca 05             	or     $0x5,%edx
+f01023ac:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+f01023b2:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f01023b7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f01023ba:	c1 e0 02             	shl    $0x2,%eax
+f01023bd:	e8 b3 ee ff ff       	call   f0101275 <boot_alloc>
+f01023c2:	a3 70 1a 2d f0       	mov    %eax,0xf02d1a70
+f01023c7:	83 ec 04             	sub    $0x4,%esp
+f01023ca:	8b 15 68 1a 2d f0    	mov    0xf02d1a68,%edx
+f01023d0:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f01023d3:	c1 e2 02             	shl    $0x2,%edx
+f01023d6:	52                   	push   %edx
+f01023d7:	6a 00                	push   $0x0
+f01023d9:	50                   	push   %eax
+f01023da:	e8 15 85 00 00       	call   f010a8f4 <memset>
+f01023df:	b8 00 b0 06 00       	mov    $0x6b000,%eax
+f01023e4:	e8 8c ee ff ff       	call   f0101275 <boot_alloc>
+f01023e9:	a3 78 57 2b f0       	mov    %eax,0xf02b5778
+f01023ee:	83 c4 0c             	add    $0xc,%esp
+f01023f1:	68 00 b0 06 00       	push   $0x6b000
+f01023f6:	6a 00                	push   $0x0
+f01023f8:	50                   	push   %eax
+f01023f9:	e8 f6 84 00 00       	call   f010a8f4 <memset>
+f01023fe:	b8 00 01 04 00       	mov    $0x40100,%eax
+f0102403:	e8 6d ee ff ff       	call   f0101275 <boot_alloc>
+f0102408:	a3 a4 b4 32 f0       	mov    %eax,0xf032b4a4
+f010240d:	83 c4 0c             	add    $0xc,%esp
+f0102410:	68 00 01 04 00       	push   $0x40100
+f0102415:	6a 00                	push   $0x0
+f0102417:	50                   	push   %eax
+f0102418:	e8 d7 84 00 00       	call   f010a8f4 <memset>
+f010241d:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0102422:	e8 4e ee ff ff       	call   f0101275 <boot_alloc>
+f0102427:	a3 a0 b4 32 f0       	mov    %eax,0xf032b4a0
+f010242c:	83 c4 0c             	add    $0xc,%esp
+f010242f:	68 00 10 00 00       	push   $0x1000
+f0102434:	6a 00                	push   $0x0
+f0102436:	50                   	push   %eax
+f0102437:	e8 b8 84 00 00       	call   f010a8f4 <memset>
+f010243c:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f0102441:	01 c0                	add    %eax,%eax
+f0102443:	e8 2d ee ff ff       	call   f0101275 <boot_alloc>
+f0102448:	a3 6c 57 2b f0       	mov    %eax,0xf02b576c
+f010244d:	e8 86 f4 ff ff       	call   f01018d8 <page_init>
+f0102452:	b8 01 00 00 00       	mov    $0x1,%eax
+f0102457:	e8 36 f0 ff ff       	call   f0101492 <check_page_free_list>
+f010245c:	83 c4 10             	add    $0x10,%esp
+f010245f:	83 3d 70 1a 2d f0 00 	cmpl   $0x0,0xf02d1a70
+f0102466:	0f 84 12 0b 00 00    	je     f0102f7e <mem_init+0xca9>
+f010246c:	a1 70 57 2b f0       	mov    0xf02b5770,%eax
+f0102471:	85 c0                	test   %eax,%eax
+f0102473:	0f 84 1c 0b 00 00    	je     f0102f95 <mem_init+0xcc0>
+f0102479:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010247e:	83 c3 01             	add    $0x1,%ebx
+f0102481:	8b 00                	mov    (%eax),%eax
+f0102483:	85 c0                	test   %eax,%eax
+f0102485:	75 f7                	jne    f010247e <mem_init+0x1a9>
+f0102487:	83 ec 0c             	sub    $0xc,%esp
+f010248a:	6a 00                	push   $0x0
+f010248c:	e8 fc f7 ff ff       	call   f0101c8d <page_alloc>
+f0102491:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%ebp)
+f0102497:	83 c4 10             	add    $0x10,%esp
+f010249a:	85 c0                	test   %eax,%eax
+f010249c:	0f 84 fd 0a 00 00    	je     f0102f9f <mem_init+0xcca>
+f01024a2:	83 ec 0c             	sub    $0xc,%esp
+f01024a5:	6a 00                	push   $0x0
+f01024a7:	e8 e1 f7 ff ff       	call   f0101c8d <page_alloc>
+f01024ac:	89 c7                	mov    %eax,%edi
+f01024ae:	83 c4 10             	add    $0x10,%esp
+f01024b1:	85 c0                	test   %eax,%eax
+f01024b3:	0f 84 ff 0a 00 00    	je     f0102fb8 <mem_init+0xce3>
+f01024b9:	83 ec 0c             	sub    $0xc,%esp
+f01024bc:	6a 00                	push   $0x0
+f01024be:	e8 ca f7 ff ff       	call   f0101c8d <page_alloc>
+f01024c3:	89 c6                	mov    %eax,%esi
+f01024c5:	83 c4 10             	add    $0x10,%esp
+f01024c8:	85 c0                	test   %eax,%eax
+f01024ca:	0f 84 01 0b 00 00    	je     f0102fd1 <mem_init+0xcfc>
+f01024d0:	39 bd 74 ff ff ff    	cmp    %edi,-0x8c(%ebp)
+f01024d6:	0f 84 0e 0b 00 00    	je     f0102fea <mem_init+0xd15>
+f01024dc:	39 85 74 ff ff ff    	cmp    %eax,-0x8c(%ebp)
+f01024e2:	0f 84 1b 0b 00 00    	je     f0103003 <mem_init+0xd2e>
+f01024e8:	39 c7                	cmp    %eax,%edi
+f01024ea:	0f 84 13 0b 00 00    	je     f0103003 <mem_init+0xd2e>
+f01024f0:	8b 0d 70 1a 2d f0    	mov    0xf02d1a70,%ecx
+f01024f6:	8b 15 68 1a 2d f0    	mov    0xf02d1a68,%edx
+f01024fc:	c1 e2 0c             	shl    $0xc,%edx
+f01024ff:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0102505:	29 c8                	sub    %ecx,%eax
+f0102507:	c1 f8 02             	sar    $0x2,%eax
+f010250a:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102510:	c1 e0 0c             	shl    $0xc,%eax
+f0102513:	39 d0                	cmp    %edx,%eax
+f0102515:	0f 83 01 0b 00 00    	jae    f010301c <mem_init+0xd47>
+f010251b:	89 f8                	mov    %edi,%eax
+f010251d:	29 c8                	sub    %ecx,%eax
+f010251f:	c1 f8 02             	sar    $0x2,%eax
+f0102522:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102528:	c1 e0 0c             	shl    $0xc,%eax
+f010252b:	39 d0                	cmp    %edx,%eax
+f010252d:	0f 83 02 0b 00 00    	jae    f0103035 <mem_init+0xd60>
+f0102533:	89 f0                	mov    %esi,%eax
+f0102535:	29 c8                	sub    %ecx,%eax
+f0102537:	c1 f8 02             	sar    $0x2,%eax
+f010253a:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102540:	c1 e0 0c             	shl    $0xc,%eax
+f0102543:	39 d0                	cmp    %edx,%eax
+f0102545:	0f 83 03 0b 00 00    	jae    f010304e <mem_init+0xd79>
+f010254b:	a1 70 57 2b f0       	mov    0xf02b5770,%eax
+f0102550:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+f0102556:	c7 05 70 57 2b f0 00 	movl   $0x0,0xf02b5770
+f010255d:	00 00 00 
+f0102560:	83 ec 0c             	sub    $0xc,%esp
+f0102563:	6a 00                	push   $0x0
+f0102565:	e8 23 f7 ff ff       	call   f0101c8d <page_alloc>
+f010256a:	83 c4 10             	add    $0x10,%esp
+f010256d:	85 c0                	test   %eax,%eax
+f010256f:	0f 85 f2 0a 00 00    	jne    f0103067 <mem_init+0xd92>
+f0102575:	83 ec 0c             	sub    $0xc,%esp
+f0102578:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+f010257e:	e8 c7 f4 ff ff       	call   f0101a4a <page_free>
+f0102583:	89 3c 24             	mov    %edi,(%esp)
+f0102586:	e8 bf f4 ff ff       	call   f0101a4a <page_free>
+f010258b:	89 34 24             	mov    %esi,(%esp)
+f010258e:	e8 b7 f4 ff ff       	call   f0101a4a <page_free>
+f0102593:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f010259a:	e8 ee f6 ff ff       	call   f0101c8d <page_alloc>
+f010259f:	89 c6                	mov    %eax,%esi
+f01025a1:	83 c4 10             	add    $0x10,%esp
+f01025a4:	85 c0                	test   %eax,%eax
+f01025a6:	0f 84 d4 0a 00 00    	je     f0103080 <mem_init+0xdab>
+f01025ac:	83 ec 0c             	sub    $0xc,%esp
+f01025af:	6a 00                	push   $0x0
+f01025b1:	e8 d7 f6 ff ff       	call   f0101c8d <page_alloc>
+f01025b6:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%ebp)
+f01025bc:	83 c4 10             	add    $0x10,%esp
+f01025bf:	85 c0                	test   %eax,%eax
+f01025c1:	0f 84 d2 0a 00 00    	je     f0103099 <mem_init+0xdc4>
+f01025c7:	83 ec 0c             	sub    $0xc,%esp
+f01025ca:	6a 00                	push   $0x0
+f01025cc:	e8 bc f6 ff ff       	call   f0101c8d <page_alloc>
+f01025d1:	89 c7                	mov    %eax,%edi
+f01025d3:	83 c4 10             	add    $0x10,%esp
+f01025d6:	85 c0                	test   %eax,%eax
+f01025d8:	0f 84 d4 0a 00 00    	je     f01030b2 <mem_init+0xddd>
+f01025de:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f01025e4:	39 c6                	cmp    %eax,%esi
+f01025e6:	0f 84 df 0a 00 00    	je     f01030cb <mem_init+0xdf6>
+f01025ec:	39 bd 74 ff ff ff    	cmp    %edi,-0x8c(%ebp)
+f01025f2:	0f 84 ec 0a 00 00    	je     f01030e4 <mem_init+0xe0f>
+f01025f8:	39 fe                	cmp    %edi,%esi
+f01025fa:	0f 84 e4 0a 00 00    	je     f01030e4 <mem_init+0xe0f>
+f0102600:	83 ec 0c             	sub    $0xc,%esp
+f0102603:	6a 00                	push   $0x0
+f0102605:	e8 83 f6 ff ff       	call   f0101c8d <page_alloc>
+f010260a:	83 c4 10             	add    $0x10,%esp
+f010260d:	85 c0                	test   %eax,%eax
+f010260f:	0f 85 e8 0a 00 00    	jne    f01030fd <mem_init+0xe28>
+f0102615:	89 f0                	mov    %esi,%eax
+f0102617:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010261d:	c1 f8 02             	sar    $0x2,%eax
+f0102620:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102626:	89 c2                	mov    %eax,%edx
+f0102628:	c1 e2 0c             	shl    $0xc,%edx
+f010262b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102630:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0102636:	0f 83 da 0a 00 00    	jae    f0103116 <mem_init+0xe41>
+f010263c:	83 ec 04             	sub    $0x4,%esp
+f010263f:	68 00 10 00 00       	push   $0x1000
+f0102644:	6a 01                	push   $0x1
+f0102646:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f010264c:	52                   	push   %edx
+f010264d:	e8 a2 82 00 00       	call   f010a8f4 <memset>
+f0102652:	89 34 24             	mov    %esi,(%esp)
+f0102655:	e8 f0 f3 ff ff       	call   f0101a4a <page_free>
+f010265a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f0102661:	e8 27 f6 ff ff       	call   f0101c8d <page_alloc>
+f0102666:	83 c4 10             	add    $0x10,%esp
+f0102669:	85 c0                	test   %eax,%eax
+f010266b:	0f 84 b7 0a 00 00    	je     f0103128 <mem_init+0xe53>
+f0102671:	39 c6                	cmp    %eax,%esi
+f0102673:	0f 85 c8 0a 00 00    	jne    f0103141 <mem_init+0xe6c>
+f0102679:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010267f:	c1 f8 02             	sar    $0x2,%eax
+f0102682:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102688:	89 c2                	mov    %eax,%edx
+f010268a:	c1 e2 0c             	shl    $0xc,%edx
+f010268d:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102692:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0102698:	0f 83 bc 0a 00 00    	jae    f010315a <mem_init+0xe85>
+f010269e:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f01026a4:	81 ea 00 f0 ff 0f    	sub    $0xffff000,%edx
+f01026aa:	80 38 00             	cmpb   $0x0,(%eax)
+f01026ad:	0f 85 b9 0a 00 00    	jne    f010316c <mem_init+0xe97>
+f01026b3:	83 c0 01             	add    $0x1,%eax
+f01026b6:	39 d0                	cmp    %edx,%eax
+f01026b8:	75 f0                	jne    f01026aa <mem_init+0x3d5>
+f01026ba:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+f01026c0:	a3 70 57 2b f0       	mov    %eax,0xf02b5770
+f01026c5:	83 ec 0c             	sub    $0xc,%esp
+f01026c8:	56                   	push   %esi
+f01026c9:	e8 7c f3 ff ff       	call   f0101a4a <page_free>
+f01026ce:	83 c4 04             	add    $0x4,%esp
+f01026d1:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+f01026d7:	e8 6e f3 ff ff       	call   f0101a4a <page_free>
+f01026dc:	89 3c 24             	mov    %edi,(%esp)
+f01026df:	e8 66 f3 ff ff       	call   f0101a4a <page_free>
+f01026e4:	a1 70 57 2b f0       	mov    0xf02b5770,%eax
+f01026e9:	83 c4 10             	add    $0x10,%esp
+f01026ec:	85 c0                	test   %eax,%eax
+f01026ee:	74 09                	je     f01026f9 <mem_init+0x424>
+f01026f0:	83 eb 01             	sub    $0x1,%ebx
+f01026f3:	8b 00                	mov    (%eax),%eax
+f01026f5:	85 c0                	test   %eax,%eax
+f01026f7:	75 f7                	jne    f01026f0 <mem_init+0x41b>
+f01026f9:	85 db                	test   %ebx,%ebx
+f01026fb:	0f 85 84 0a 00 00    	jne    f0103185 <mem_init+0xeb0>
+f0102701:	83 ec 0c             	sub    $0xc,%esp
+f0102704:	68 38 db 10 f0       	push   $0xf010db38
+f0102709:	e8 f9 35 00 00       	call   f0105d07 <cprintf>
+f010270e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0102715:	e8 73 f5 ff ff       	call   f0101c8d <page_alloc>
+f010271a:	89 c7                	mov    %eax,%edi
+f010271c:	83 c4 10             	add    $0x10,%esp
+f010271f:	85 c0                	test   %eax,%eax
+f0102721:	0f 84 77 0a 00 00    	je     f010319e <mem_init+0xec9>
+f0102727:	83 ec 0c             	sub    $0xc,%esp
+f010272a:	6a 00                	push   $0x0
+f010272c:	e8 5c f5 ff ff       	call   f0101c8d <page_alloc>
+f0102731:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%ebp)
+f0102737:	83 c4 10             	add    $0x10,%esp
+f010273a:	85 c0                	test   %eax,%eax
+f010273c:	0f 84 75 0a 00 00    	je     f01031b7 <mem_init+0xee2>
+f0102742:	83 ec 0c             	sub    $0xc,%esp
+f0102745:	6a 00                	push   $0x0
+f0102747:	e8 41 f5 ff ff       	call   f0101c8d <page_alloc>
+f010274c:	89 c3                	mov    %eax,%ebx
+f010274e:	83 c4 10             	add    $0x10,%esp
+f0102751:	85 c0                	test   %eax,%eax
+f0102753:	0f 84 77 0a 00 00    	je     f01031d0 <mem_init+0xefb>
+f0102759:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f010275f:	39 c7                	cmp    %eax,%edi
+f0102761:	0f 84 82 0a 00 00    	je     f01031e9 <mem_init+0xf14>
+f0102767:	39 df                	cmp    %ebx,%edi
+f0102769:	0f 84 93 0a 00 00    	je     f0103202 <mem_init+0xf2d>
+f010276f:	39 9d 74 ff ff ff    	cmp    %ebx,-0x8c(%ebp)
+f0102775:	0f 84 87 0a 00 00    	je     f0103202 <mem_init+0xf2d>
+f010277b:	a1 70 57 2b f0       	mov    0xf02b5770,%eax
+f0102780:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+f0102786:	c7 05 70 57 2b f0 00 	movl   $0x0,0xf02b5770
+f010278d:	00 00 00 
+f0102790:	83 ec 0c             	sub    $0xc,%esp
+f0102793:	6a 00                	push   $0x0
+f0102795:	e8 f3 f4 ff ff       	call   f0101c8d <page_alloc>
+f010279a:	83 c4 10             	add    $0x10,%esp
+f010279d:	85 c0                	test   %eax,%eax
+f010279f:	0f 85 76 0a 00 00    	jne    f010321b <mem_init+0xf46>
+f01027a5:	83 ec 04             	sub    $0x4,%esp
+f01027a8:	8d 45 bc             	lea    -0x44(%ebp),%eax
+f01027ab:	50                   	push   %eax
+f01027ac:	6a 00                	push   $0x0
+f01027ae:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f01027b4:	e8 ee f9 ff ff       	call   f01021a7 <page_lookup>
+f01027b9:	83 c4 10             	add    $0x10,%esp
+f01027bc:	85 c0                	test   %eax,%eax
+f01027be:	0f 85 70 0a 00 00    	jne    f0103234 <mem_init+0xf5f>
+f01027c4:	6a 02                	push   $0x2
+f01027c6:	6a 00                	push   $0x0
+f01027c8:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+f01027ce:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f01027d4:	e8 7c fa ff ff       	call   f0102255 <page_insert>
+f01027d9:	83 c4 10             	add    $0x10,%esp
+f01027dc:	85 c0                	test   %eax,%eax
+f01027de:	0f 89 69 0a 00 00    	jns    f010324d <mem_init+0xf78>
+f01027e4:	83 ec 0c             	sub    $0xc,%esp
+f01027e7:	57                   	push   %edi
+f01027e8:	e8 5d f2 ff ff       	call   f0101a4a <page_free>
+f01027ed:	6a 02                	push   $0x2
+f01027ef:	6a 00                	push   $0x0
+f01027f1:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+f01027f7:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f01027fd:	e8 53 fa ff ff       	call   f0102255 <page_insert>
+f0102802:	83 c4 20             	add    $0x20,%esp
+f0102805:	85 c0                	test   %eax,%eax
+f0102807:	0f 85 59 0a 00 00    	jne    f0103266 <mem_init+0xf91>
+f010280d:	8b 35 6c 1a 2d f0    	mov    0xf02d1a6c,%esi
+f0102813:	8b 0d 70 1a 2d f0    	mov    0xf02d1a70,%ecx
+f0102819:	89 8d 70 ff ff ff    	mov    %ecx,-0x90(%ebp)
+f010281f:	8b 16                	mov    (%esi),%edx
+f0102821:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102827:	89 f8                	mov    %edi,%eax
+f0102829:	29 c8                	sub    %ecx,%eax
+f010282b:	c1 f8 02             	sar    $0x2,%eax
+f010282e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102834:	c1 e0 0c             	shl    $0xc,%eax
+f0102837:	39 c2                	cmp    %eax,%edx
+f0102839:	0f 85 40 0a 00 00    	jne    f010327f <mem_init+0xfaa>
+f010283f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102844:	89 f0                	mov    %esi,%eax
+f0102846:	e8 e4 eb ff ff       	call   f010142f <check_va2pa>
+f010284b:	89 c2                	mov    %eax,%edx
+f010284d:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0102853:	8b 8d 70 ff ff ff    	mov    -0x90(%ebp),%ecx
+f0102859:	29 c8                	sub    %ecx,%eax
+f010285b:	c1 f8 02             	sar    $0x2,%eax
+f010285e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102864:	c1 e0 0c             	shl    $0xc,%eax
+f0102867:	39 c2                	cmp    %eax,%edx
+f0102869:	0f 85 29 0a 00 00    	jne    f0103298 <mem_init+0xfc3>
+f010286f:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0102875:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010287a:	0f 85 31 0a 00 00    	jne    f01032b1 <mem_init+0xfdc>
+f0102880:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102885:	0f 85 3f 0a 00 00    	jne    f01032ca <mem_init+0xff5>
+f010288b:	6a 02                	push   $0x2
+f010288d:	68 00 10 00 00       	push   $0x1000
+f0102892:	53                   	push   %ebx
+f0102893:	56                   	push   %esi
+f0102894:	e8 bc f9 ff ff       	call   f0102255 <page_insert>
+f0102899:	83 c4 10             	add    $0x10,%esp
+f010289c:	85 c0                	test   %eax,%eax
+f010289e:	0f 85 3f 0a 00 00    	jne    f01032e3 <mem_init+0x100e>
+f01028a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01028a9:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f01028ae:	e8 7c eb ff ff       	call   f010142f <check_va2pa>
+f01028b3:	89 c2                	mov    %eax,%edx
+f01028b5:	89 d8                	mov    %ebx,%eax
+f01028b7:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f01028bd:	c1 f8 02             	sar    $0x2,%eax
+f01028c0:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01028c6:	c1 e0 0c             	shl    $0xc,%eax
+f01028c9:	39 c2                	cmp    %eax,%edx
+f01028cb:	0f 85 2b 0a 00 00    	jne    f01032fc <mem_init+0x1027>
+f01028d1:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01028d6:	0f 85 39 0a 00 00    	jne    f0103315 <mem_init+0x1040>
+f01028dc:	83 ec 0c             	sub    $0xc,%esp
+f01028df:	6a 00                	push   $0x0
+f01028e1:	e8 a7 f3 ff ff       	call   f0101c8d <page_alloc>
+f01028e6:	83 c4 10             	add    $0x10,%esp
+f01028e9:	85 c0                	test   %eax,%eax
+f01028eb:	0f 85 3d 0a 00 00    	jne    f010332e <mem_init+0x1059>
+f01028f1:	6a 02                	push   $0x2
+f01028f3:	68 00 10 00 00       	push   $0x1000
+f01028f8:	53                   	push   %ebx
+f01028f9:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f01028ff:	e8 51 f9 ff ff       	call   f0102255 <page_insert>
+f0102904:	83 c4 10             	add    $0x10,%esp
+f0102907:	85 c0                	test   %eax,%eax
+f0102909:	0f 85 38 0a 00 00    	jne    f0103347 <mem_init+0x1072>
+f010290f:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102914:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f0102919:	e8 11 eb ff ff       	call   f010142f <check_va2pa>
+f010291e:	89 c2                	mov    %eax,%edx
+f0102920:	89 d8                	mov    %ebx,%eax
+f0102922:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0102928:	c1 f8 02             	sar    $0x2,%eax
+f010292b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102931:	c1 e0 0c             	shl    $0xc,%eax
+f0102934:	39 c2                	cmp    %eax,%edx
+f0102936:	0f 85 24 0a 00 00    	jne    f0103360 <mem_init+0x108b>
+f010293c:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0102941:	0f 85 32 0a 00 00    	jne    f0103379 <mem_init+0x10a4>
+f0102947:	83 ec 0c             	sub    $0xc,%esp
+f010294a:	6a 00                	push   $0x0
+f010294c:	e8 3c f3 ff ff       	call   f0101c8d <page_alloc>
+f0102951:	83 c4 10             	add    $0x10,%esp
+f0102954:	85 c0                	test   %eax,%eax
+f0102956:	0f 85 36 0a 00 00    	jne    f0103392 <mem_init+0x10bd>
+f010295c:	8b 15 6c 1a 2d f0    	mov    0xf02d1a6c,%edx
+f0102962:	8b 02                	mov    (%edx),%eax
+f0102964:	89 c6                	mov    %eax,%esi
+f0102966:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f010296c:	c1 e8 0c             	shr    $0xc,%eax
+f010296f:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0102975:	0f 83 30 0a 00 00    	jae    f01033ab <mem_init+0x10d6>
+f010297b:	83 ec 04             	sub    $0x4,%esp
+f010297e:	6a 00                	push   $0x0
+f0102980:	68 00 10 00 00       	push   $0x1000
+f0102985:	52                   	push   %edx
+f0102986:	e8 81 f5 ff ff       	call   f0101f0c <pgdir_walk>
+f010298b:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0102991:	83 c4 10             	add    $0x10,%esp
+f0102994:	39 f0                	cmp    %esi,%eax
+f0102996:	0f 85 24 0a 00 00    	jne    f01033c0 <mem_init+0x10eb>
+f010299c:	6a 06                	push   $0x6
+f010299e:	68 00 10 00 00       	push   $0x1000
+f01029a3:	53                   	push   %ebx
+f01029a4:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f01029aa:	e8 a6 f8 ff ff       	call   f0102255 <page_insert>
+f01029af:	83 c4 10             	add    $0x10,%esp
+f01029b2:	85 c0                	test   %eax,%eax
+f01029b4:	0f 85 1f 0a 00 00    	jne    f01033d9 <mem_init+0x1104>
+f01029ba:	8b 35 6c 1a 2d f0    	mov    0xf02d1a6c,%esi
+f01029c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01029c5:	89 f0                	mov    %esi,%eax
+f01029c7:	e8 63 ea ff ff       	call   f010142f <check_va2pa>
+f01029cc:	89 c2                	mov    %eax,%edx
+f01029ce:	89 d8                	mov    %ebx,%eax
+f01029d0:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f01029d6:	c1 f8 02             	sar    $0x2,%eax
+f01029d9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01029df:	c1 e0 0c             	shl    $0xc,%eax
+f01029e2:	39 c2                	cmp    %eax,%edx
+f01029e4:	0f 85 08 0a 00 00    	jne    f01033f2 <mem_init+0x111d>
+f01029ea:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01029ef:	0f 85 16 0a 00 00    	jne    f010340b <mem_init+0x1136>
+f01029f5:	83 ec 04             	sub    $0x4,%esp
+f01029f8:	6a 00                	push   $0x0
+f01029fa:	68 00 10 00 00       	push   $0x1000
+f01029ff:	56                   	push   %esi
+f0102a00:	e8 07 f5 ff ff       	call   f0101f0c <pgdir_walk>
+f0102a05:	83 c4 10             	add    $0x10,%esp
+f0102a08:	f6 00 04             	testb  $0x4,(%eax)
+f0102a0b:	0f 84 13 0a 00 00    	je     f0103424 <mem_init+0x114f>
+f0102a11:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f0102a16:	f6 00 04             	testb  $0x4,(%eax)
+f0102a19:	0f 84 1e 0a 00 00    	je     f010343d <mem_init+0x1168>
+f0102a1f:	6a 02                	push   $0x2
+f0102a21:	68 00 00 40 00       	push   $0x400000
+f0102a26:	57                   	push   %edi
+f0102a27:	50                   	push   %eax
+f0102a28:	e8 28 f8 ff ff       	call   f0102255 <page_insert>
+f0102a2d:	83 c4 10             	add    $0x10,%esp
+f0102a30:	85 c0                	test   %eax,%eax
+f0102a32:	0f 89 1e 0a 00 00    	jns    f0103456 <mem_init+0x1181>
+f0102a38:	6a 02                	push   $0x2
+f0102a3a:	68 00 10 00 00       	push   $0x1000
+f0102a3f:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+f0102a45:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102a4b:	e8 05 f8 ff ff       	call   f0102255 <page_insert>
+f0102a50:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+f0102a56:	83 c4 10             	add    $0x10,%esp
+f0102a59:	85 c0                	test   %eax,%eax
+f0102a5b:	0f 85 0e 0a 00 00    	jne    f010346f <mem_init+0x119a>
+f0102a61:	83 ec 04             	sub    $0x4,%esp
+f0102a64:	6a 00                	push   $0x0
+f0102a66:	68 00 10 00 00       	push   $0x1000
+f0102a6b:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102a71:	e8 96 f4 ff ff       	call   f0101f0c <pgdir_walk>
+f0102a76:	83 c4 10             	add    $0x10,%esp
+f0102a79:	f6 00 04             	testb  $0x4,(%eax)
+f0102a7c:	0f 85 06 0a 00 00    	jne    f0103488 <mem_init+0x11b3>
+f0102a82:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f0102a87:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+f0102a8d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102a92:	e8 98 e9 ff ff       	call   f010142f <check_va2pa>
+f0102a97:	8b b5 74 ff ff ff    	mov    -0x8c(%ebp),%esi
+f0102a9d:	2b 35 70 1a 2d f0    	sub    0xf02d1a70,%esi
+f0102aa3:	c1 fe 02             	sar    $0x2,%esi
+f0102aa6:	69 f6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%esi
+f0102aac:	c1 e6 0c             	shl    $0xc,%esi
+f0102aaf:	39 f0                	cmp    %esi,%eax
+f0102ab1:	0f 85 ea 09 00 00    	jne    f01034a1 <mem_init+0x11cc>
+f0102ab7:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102abc:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+f0102ac2:	e8 68 e9 ff ff       	call   f010142f <check_va2pa>
+f0102ac7:	39 c6                	cmp    %eax,%esi
+f0102ac9:	0f 85 eb 09 00 00    	jne    f01034ba <mem_init+0x11e5>
+f0102acf:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0102ad5:	66 83 78 04 02       	cmpw   $0x2,0x4(%eax)
+f0102ada:	0f 85 f3 09 00 00    	jne    f01034d3 <mem_init+0x11fe>
+f0102ae0:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102ae5:	0f 85 01 0a 00 00    	jne    f01034ec <mem_init+0x1217>
+f0102aeb:	83 ec 0c             	sub    $0xc,%esp
+f0102aee:	6a 00                	push   $0x0
+f0102af0:	e8 98 f1 ff ff       	call   f0101c8d <page_alloc>
+f0102af5:	83 c4 10             	add    $0x10,%esp
+f0102af8:	85 c0                	test   %eax,%eax
+f0102afa:	0f 84 05 0a 00 00    	je     f0103505 <mem_init+0x1230>
+f0102b00:	39 c3                	cmp    %eax,%ebx
+f0102b02:	0f 85 fd 09 00 00    	jne    f0103505 <mem_init+0x1230>
+f0102b08:	83 ec 08             	sub    $0x8,%esp
+f0102b0b:	6a 00                	push   $0x0
+f0102b0d:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102b13:	e8 f7 f6 ff ff       	call   f010220f <page_remove>
+f0102b18:	8b 35 6c 1a 2d f0    	mov    0xf02d1a6c,%esi
+f0102b1e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102b23:	89 f0                	mov    %esi,%eax
+f0102b25:	e8 05 e9 ff ff       	call   f010142f <check_va2pa>
+f0102b2a:	83 c4 10             	add    $0x10,%esp
+f0102b2d:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102b30:	0f 85 e8 09 00 00    	jne    f010351e <mem_init+0x1249>
+f0102b36:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102b3b:	89 f0                	mov    %esi,%eax
+f0102b3d:	e8 ed e8 ff ff       	call   f010142f <check_va2pa>
+f0102b42:	89 c2                	mov    %eax,%edx
+f0102b44:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0102b4a:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0102b50:	c1 f8 02             	sar    $0x2,%eax
+f0102b53:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102b59:	c1 e0 0c             	shl    $0xc,%eax
+f0102b5c:	39 c2                	cmp    %eax,%edx
+f0102b5e:	0f 85 d3 09 00 00    	jne    f0103537 <mem_init+0x1262>
+f0102b64:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0102b6a:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0102b6f:	0f 85 db 09 00 00    	jne    f0103550 <mem_init+0x127b>
+f0102b75:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102b7a:	0f 85 e9 09 00 00    	jne    f0103569 <mem_init+0x1294>
+f0102b80:	83 ec 08             	sub    $0x8,%esp
+f0102b83:	68 00 10 00 00       	push   $0x1000
+f0102b88:	56                   	push   %esi
+f0102b89:	e8 81 f6 ff ff       	call   f010220f <page_remove>
+f0102b8e:	8b 35 6c 1a 2d f0    	mov    0xf02d1a6c,%esi
+f0102b94:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102b99:	89 f0                	mov    %esi,%eax
+f0102b9b:	e8 8f e8 ff ff       	call   f010142f <check_va2pa>
+f0102ba0:	83 c4 10             	add    $0x10,%esp
+f0102ba3:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102ba6:	0f 85 d6 09 00 00    	jne    f0103582 <mem_init+0x12ad>
+f0102bac:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102bb1:	89 f0                	mov    %esi,%eax
+f0102bb3:	e8 77 e8 ff ff       	call   f010142f <check_va2pa>
+f0102bb8:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102bbb:	0f 85 da 09 00 00    	jne    f010359b <mem_init+0x12c6>
+f0102bc1:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0102bc7:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f0102bcc:	0f 85 e2 09 00 00    	jne    f01035b4 <mem_init+0x12df>
+f0102bd2:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f0102bd7:	0f 85 f0 09 00 00    	jne    f01035cd <mem_init+0x12f8>
+f0102bdd:	83 ec 0c             	sub    $0xc,%esp
+f0102be0:	6a 00                	push   $0x0
+f0102be2:	e8 a6 f0 ff ff       	call   f0101c8d <page_alloc>
+f0102be7:	83 c4 10             	add    $0x10,%esp
+f0102bea:	39 85 74 ff ff ff    	cmp    %eax,-0x8c(%ebp)
+f0102bf0:	0f 85 f0 09 00 00    	jne    f01035e6 <mem_init+0x1311>
+f0102bf6:	85 c0                	test   %eax,%eax
+f0102bf8:	0f 84 e8 09 00 00    	je     f01035e6 <mem_init+0x1311>
+f0102bfe:	83 ec 0c             	sub    $0xc,%esp
+f0102c01:	6a 00                	push   $0x0
+f0102c03:	e8 85 f0 ff ff       	call   f0101c8d <page_alloc>
+f0102c08:	83 c4 10             	add    $0x10,%esp
+f0102c0b:	85 c0                	test   %eax,%eax
+f0102c0d:	0f 85 ec 09 00 00    	jne    f01035ff <mem_init+0x132a>
+f0102c13:	8b 0d 6c 1a 2d f0    	mov    0xf02d1a6c,%ecx
+f0102c19:	8b 11                	mov    (%ecx),%edx
+f0102c1b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102c21:	89 f8                	mov    %edi,%eax
+f0102c23:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0102c29:	c1 f8 02             	sar    $0x2,%eax
+f0102c2c:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102c32:	c1 e0 0c             	shl    $0xc,%eax
+f0102c35:	39 c2                	cmp    %eax,%edx
+f0102c37:	0f 85 db 09 00 00    	jne    f0103618 <mem_init+0x1343>
+f0102c3d:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+f0102c43:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102c48:	0f 85 e3 09 00 00    	jne    f0103631 <mem_init+0x135c>
+f0102c4e:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+f0102c54:	83 ec 0c             	sub    $0xc,%esp
+f0102c57:	57                   	push   %edi
+f0102c58:	e8 ed ed ff ff       	call   f0101a4a <page_free>
+f0102c5d:	83 c4 0c             	add    $0xc,%esp
+f0102c60:	6a 01                	push   $0x1
+f0102c62:	68 00 10 40 00       	push   $0x401000
+f0102c67:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102c6d:	e8 9a f2 ff ff       	call   f0101f0c <pgdir_walk>
+f0102c72:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+f0102c78:	8b 0d 6c 1a 2d f0    	mov    0xf02d1a6c,%ecx
+f0102c7e:	8b 41 04             	mov    0x4(%ecx),%eax
+f0102c81:	89 c2                	mov    %eax,%edx
+f0102c83:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102c89:	8b 35 68 1a 2d f0    	mov    0xf02d1a68,%esi
+f0102c8f:	c1 e8 0c             	shr    $0xc,%eax
+f0102c92:	83 c4 10             	add    $0x10,%esp
+f0102c95:	39 f0                	cmp    %esi,%eax
+f0102c97:	0f 83 ad 09 00 00    	jae    f010364a <mem_init+0x1375>
+f0102c9d:	81 ea fc ff ff 0f    	sub    $0xffffffc,%edx
+f0102ca3:	39 95 70 ff ff ff    	cmp    %edx,-0x90(%ebp)
+f0102ca9:	0f 85 b0 09 00 00    	jne    f010365f <mem_init+0x138a>
+f0102caf:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+f0102cb6:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+f0102cbc:	89 f8                	mov    %edi,%eax
+f0102cbe:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0102cc4:	c1 f8 02             	sar    $0x2,%eax
+f0102cc7:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102ccd:	89 c2                	mov    %eax,%edx
+f0102ccf:	c1 e2 0c             	shl    $0xc,%edx
+f0102cd2:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102cd7:	39 f0                	cmp    %esi,%eax
+f0102cd9:	0f 83 99 09 00 00    	jae    f0103678 <mem_init+0x13a3>
+f0102cdf:	83 ec 04             	sub    $0x4,%esp
+f0102ce2:	68 00 10 00 00       	push   $0x1000
+f0102ce7:	68 ff 00 00 00       	push   $0xff
+f0102cec:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0102cf2:	52                   	push   %edx
+f0102cf3:	e8 fc 7b 00 00       	call   f010a8f4 <memset>
+f0102cf8:	89 3c 24             	mov    %edi,(%esp)
+f0102cfb:	e8 4a ed ff ff       	call   f0101a4a <page_free>
+f0102d00:	83 c4 0c             	add    $0xc,%esp
+f0102d03:	6a 01                	push   $0x1
+f0102d05:	6a 00                	push   $0x0
+f0102d07:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102d0d:	e8 fa f1 ff ff       	call   f0101f0c <pgdir_walk>
+f0102d12:	89 f8                	mov    %edi,%eax
+f0102d14:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0102d1a:	c1 f8 02             	sar    $0x2,%eax
+f0102d1d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102d23:	89 c2                	mov    %eax,%edx
+f0102d25:	c1 e2 0c             	shl    $0xc,%edx
+f0102d28:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102d2d:	83 c4 10             	add    $0x10,%esp
+f0102d30:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0102d36:	0f 83 4e 09 00 00    	jae    f010368a <mem_init+0x13b5>
+f0102d3c:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f0102d42:	81 ea 00 f0 ff 0f    	sub    $0xffff000,%edx
+f0102d48:	8b 08                	mov    (%eax),%ecx
+f0102d4a:	83 e1 01             	and    $0x1,%ecx
+f0102d4d:	0f 85 49 09 00 00    	jne    f010369c <mem_init+0x13c7>
+f0102d53:	83 c0 04             	add    $0x4,%eax
+f0102d56:	39 d0                	cmp    %edx,%eax
+f0102d58:	75 ee                	jne    f0102d48 <mem_init+0xa73>
+f0102d5a:	89 8d 5c ff ff ff    	mov    %ecx,-0xa4(%ebp)
+f0102d60:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f0102d65:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0102d6b:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+f0102d71:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+f0102d77:	a3 70 57 2b f0       	mov    %eax,0xf02b5770
+f0102d7c:	83 ec 0c             	sub    $0xc,%esp
+f0102d7f:	57                   	push   %edi
+f0102d80:	e8 c5 ec ff ff       	call   f0101a4a <page_free>
+f0102d85:	83 c4 04             	add    $0x4,%esp
+f0102d88:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+f0102d8e:	e8 b7 ec ff ff       	call   f0101a4a <page_free>
+f0102d93:	89 1c 24             	mov    %ebx,(%esp)
+f0102d96:	e8 af ec ff ff       	call   f0101a4a <page_free>
+f0102d9b:	c7 04 24 f7 e4 10 f0 	movl   $0xf010e4f7,(%esp)
+f0102da2:	e8 60 2f 00 00       	call   f0105d07 <cprintf>
+f0102da7:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f0102dac:	83 c4 10             	add    $0x10,%esp
+f0102daf:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102db4:	0f 86 fb 08 00 00    	jbe    f01036b5 <mem_init+0x13e0>
+f0102dba:	83 ec 0c             	sub    $0xc,%esp
+f0102dbd:	6a 04                	push   $0x4
+f0102dbf:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102dc4:	50                   	push   %eax
+f0102dc5:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f0102dca:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0102dcd:	8d 04 85 ff 0f 00 00 	lea    0xfff(,%eax,4),%eax
+f0102dd4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0102dd9:	50                   	push   %eax
+f0102dda:	68 00 00 00 ef       	push   $0xef000000
+f0102ddf:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102de5:	e8 01 f3 ff ff       	call   f01020eb <boot_map_region>
+f0102dea:	a1 78 57 2b f0       	mov    0xf02b5778,%eax
+f0102def:	83 c4 20             	add    $0x20,%esp
+f0102df2:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102df7:	0f 86 cd 08 00 00    	jbe    f01036ca <mem_init+0x13f5>
+f0102dfd:	83 ec 0c             	sub    $0xc,%esp
+f0102e00:	6a 04                	push   $0x4
+f0102e02:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102e07:	50                   	push   %eax
+f0102e08:	68 00 b0 06 00       	push   $0x6b000
+f0102e0d:	68 00 00 c0 ee       	push   $0xeec00000
+f0102e12:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102e18:	e8 ce f2 ff ff       	call   f01020eb <boot_map_region>
+f0102e1d:	a1 a4 b4 32 f0       	mov    0xf032b4a4,%eax
+f0102e22:	83 c4 20             	add    $0x20,%esp
+f0102e25:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102e2a:	0f 86 af 08 00 00    	jbe    f01036df <mem_init+0x140a>
+f0102e30:	83 ec 0c             	sub    $0xc,%esp
+f0102e33:	6a 04                	push   $0x4
+f0102e35:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102e3a:	50                   	push   %eax
+f0102e3b:	68 00 10 04 00       	push   $0x41000
+f0102e40:	68 00 00 80 ee       	push   $0xee800000
+f0102e45:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102e4b:	e8 9b f2 ff ff       	call   f01020eb <boot_map_region>
+f0102e50:	a1 a0 b4 32 f0       	mov    0xf032b4a0,%eax
+f0102e55:	83 c4 20             	add    $0x20,%esp
+f0102e58:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102e5d:	0f 86 91 08 00 00    	jbe    f01036f4 <mem_init+0x141f>
+f0102e63:	83 ec 0c             	sub    $0xc,%esp
+f0102e66:	6a 04                	push   $0x4
+f0102e68:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102e6d:	50                   	push   %eax
+f0102e6e:	68 00 10 00 00       	push   $0x1000
+f0102e73:	68 00 f0 bf ee       	push   $0xeebff000
+f0102e78:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102e7e:	e8 68 f2 ff ff       	call   f01020eb <boot_map_region>
+f0102e83:	83 c4 20             	add    $0x20,%esp
+f0102e86:	b8 00 00 11 f0       	mov    $0xf0110000,%eax
+f0102e8b:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102e90:	0f 86 73 08 00 00    	jbe    f0103709 <mem_init+0x1434>
+f0102e96:	83 ec 0c             	sub    $0xc,%esp
+f0102e99:	6a 02                	push   $0x2
+f0102e9b:	68 00 00 11 00       	push   $0x110000
+f0102ea0:	68 00 80 00 00       	push   $0x8000
+f0102ea5:	68 00 80 bf ef       	push   $0xefbf8000
+f0102eaa:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102eb0:	e8 36 f2 ff ff       	call   f01020eb <boot_map_region>
+f0102eb5:	83 c4 14             	add    $0x14,%esp
+f0102eb8:	6a 02                	push   $0x2
+f0102eba:	6a 00                	push   $0x0
+f0102ebc:	68 00 00 00 0e       	push   $0xe000000
+f0102ec1:	68 00 00 00 f0       	push   $0xf0000000
+f0102ec6:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102ecc:	e8 1a f2 ff ff       	call   f01020eb <boot_map_region>
+f0102ed1:	83 c4 14             	add    $0x14,%esp
+f0102ed4:	6a 02                	push   $0x2
+f0102ed6:	68 00 00 00 fe       	push   $0xfe000000
+f0102edb:	68 00 00 00 02       	push   $0x2000000
+f0102ee0:	68 00 00 00 fe       	push   $0xfe000000
+f0102ee5:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102eeb:	e8 fb f1 ff ff       	call   f01020eb <boot_map_region>
+f0102ef0:	b8 00 30 2d f0       	mov    $0xf02d3000,%eax
+f0102ef5:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+f0102efb:	83 c4 20             	add    $0x20,%esp
+f0102efe:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102f03:	0f 86 15 08 00 00    	jbe    f010371e <mem_init+0x1449>
+f0102f09:	be 00 b0 30 f0       	mov    $0xf030b000,%esi
+f0102f0e:	bb 00 30 2d f0       	mov    $0xf02d3000,%ebx
+f0102f13:	bf 00 80 bf ef       	mov    $0xefbf8000,%edi
+f0102f18:	83 ec 0c             	sub    $0xc,%esp
+f0102f1b:	6a 02                	push   $0x2
+f0102f1d:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0102f23:	50                   	push   %eax
+f0102f24:	68 00 80 00 00       	push   $0x8000
+f0102f29:	57                   	push   %edi
+f0102f2a:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0102f30:	e8 b6 f1 ff ff       	call   f01020eb <boot_map_region>
+f0102f35:	83 c4 20             	add    $0x20,%esp
+f0102f38:	39 f3                	cmp    %esi,%ebx
+f0102f3a:	0f 84 e8 07 00 00    	je     f0103728 <mem_init+0x1453>
+f0102f40:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f0102f46:	81 ef 00 00 01 00    	sub    $0x10000,%edi
+f0102f4c:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0102f52:	77 c4                	ja     f0102f18 <mem_init+0xc43>
+f0102f54:	53                   	push   %ebx
+f0102f55:	68 48 d0 10 f0       	push   $0xf010d048
+f0102f5a:	68 78 01 00 00       	push   $0x178
+f0102f5f:	68 22 e2 10 f0       	push   $0xf010e222
+f0102f64:	e8 d7 d0 ff ff       	call   f0100040 <_panic>
+f0102f69:	50                   	push   %eax
+f0102f6a:	68 48 d0 10 f0       	push   $0xf010d048
+f0102f6f:	68 c8 00 00 00       	push   $0xc8
+f0102f74:	68 22 e2 10 f0       	push   $0xf010e222
+f0102f79:	e8 c2 d0 ff ff       	call   f0100040 <_panic>
+f0102f7e:	83 ec 04             	sub    $0x4,%esp
+f0102f81:	68 34 e3 10 f0       	push   $0xf010e334
+f0102f86:	68 f7 05 00 00       	push   $0x5f7
+f0102f8b:	68 22 e2 10 f0       	push   $0xf010e222
+f0102f90:	e8 ab d0 ff ff       	call   f0100040 <_panic>
+f0102f95:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0102f9a:	e9 e8 f4 ff ff       	jmp    f0102487 <mem_init+0x1b2>
+f0102f9f:	68 4f e3 10 f0       	push   $0xf010e34f
+f0102fa4:	68 0d e2 10 f0       	push   $0xf010e20d
+f0102fa9:	68 ff 05 00 00       	push   $0x5ff
+f0102fae:	68 22 e2 10 f0       	push   $0xf010e222
+f0102fb3:	e8 88 d0 ff ff       	call   f0100040 <_panic>
+f0102fb8:	68 65 e3 10 f0       	push   $0xf010e365
+f0102fbd:	68 0d e2 10 f0       	push   $0xf010e20d
+f0102fc2:	68 00 06 00 00       	push   $0x600
+f0102fc7:	68 22 e2 10 f0       	push   $0xf010e222
+f0102fcc:	e8 6f d0 ff ff       	call   f0100040 <_panic>
+f0102fd1:	68 7b e3 10 f0       	push   $0xf010e37b
+f0102fd6:	68 0d e2 10 f0       	push   $0xf010e20d
+f0102fdb:	68 01 06 00 00       	push   $0x601
+f0102fe0:	68 22 e2 10 f0       	push   $0xf010e222
+f0102fe5:	e8 56 d0 ff ff       	call   f0100040 <_panic>
+f0102fea:	68 91 e3 10 f0       	push   $0xf010e391
+f0102fef:	68 0d e2 10 f0       	push   $0xf010e20d
+f0102ff4:	68 04 06 00 00       	push   $0x604
+f0102ff9:	68 22 e2 10 f0       	push   $0xf010e222
+f0102ffe:	e8 3d d0 ff ff       	call   f0100040 <_panic>
+f0103003:	68 18 db 10 f0       	push   $0xf010db18
+f0103008:	68 0d e2 10 f0       	push   $0xf010e20d
+f010300d:	68 05 06 00 00       	push   $0x605
+f0103012:	68 22 e2 10 f0       	push   $0xf010e222
+f0103017:	e8 24 d0 ff ff       	call   f0100040 <_panic>
+f010301c:	68 a3 e3 10 f0       	push   $0xf010e3a3
+f0103021:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103026:	68 06 06 00 00       	push   $0x606
+f010302b:	68 22 e2 10 f0       	push   $0xf010e222
+f0103030:	e8 0b d0 ff ff       	call   f0100040 <_panic>
+f0103035:	68 c0 e3 10 f0       	push   $0xf010e3c0
+f010303a:	68 0d e2 10 f0       	push   $0xf010e20d
+f010303f:	68 07 06 00 00       	push   $0x607
+f0103044:	68 22 e2 10 f0       	push   $0xf010e222
+f0103049:	e8 f2 cf ff ff       	call   f0100040 <_panic>
+f010304e:	68 dd e3 10 f0       	push   $0xf010e3dd
+f0103053:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103058:	68 08 06 00 00       	push   $0x608
+f010305d:	68 22 e2 10 f0       	push   $0xf010e222
+f0103062:	e8 d9 cf ff ff       	call   f0100040 <_panic>
+f0103067:	68 fa e3 10 f0       	push   $0xf010e3fa
+f010306c:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103071:	68 0f 06 00 00       	push   $0x60f
+f0103076:	68 22 e2 10 f0       	push   $0xf010e222
+f010307b:	e8 c0 cf ff ff       	call   f0100040 <_panic>
+f0103080:	68 4f e3 10 f0       	push   $0xf010e34f
+f0103085:	68 0d e2 10 f0       	push   $0xf010e20d
+f010308a:	68 16 06 00 00       	push   $0x616
+f010308f:	68 22 e2 10 f0       	push   $0xf010e222
+f0103094:	e8 a7 cf ff ff       	call   f0100040 <_panic>
+f0103099:	68 65 e3 10 f0       	push   $0xf010e365
+f010309e:	68 0d e2 10 f0       	push   $0xf010e20d
+f01030a3:	68 17 06 00 00       	push   $0x617
+f01030a8:	68 22 e2 10 f0       	push   $0xf010e222
+f01030ad:	e8 8e cf ff ff       	call   f0100040 <_panic>
+f01030b2:	68 7b e3 10 f0       	push   $0xf010e37b
+f01030b7:	68 0d e2 10 f0       	push   $0xf010e20d
+f01030bc:	68 18 06 00 00       	push   $0x618
+f01030c1:	68 22 e2 10 f0       	push   $0xf010e222
+f01030c6:	e8 75 cf ff ff       	call   f0100040 <_panic>
+f01030cb:	68 91 e3 10 f0       	push   $0xf010e391
+f01030d0:	68 0d e2 10 f0       	push   $0xf010e20d
+f01030d5:	68 1a 06 00 00       	push   $0x61a
+f01030da:	68 22 e2 10 f0       	push   $0xf010e222
+f01030df:	e8 5c cf ff ff       	call   f0100040 <_panic>
+f01030e4:	68 18 db 10 f0       	push   $0xf010db18
+f01030e9:	68 0d e2 10 f0       	push   $0xf010e20d
+f01030ee:	68 1b 06 00 00       	push   $0x61b
+f01030f3:	68 22 e2 10 f0       	push   $0xf010e222
+f01030f8:	e8 43 cf ff ff       	call   f0100040 <_panic>
+f01030fd:	68 fa e3 10 f0       	push   $0xf010e3fa
+f0103102:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103107:	68 1c 06 00 00       	push   $0x61c
+f010310c:	68 22 e2 10 f0       	push   $0xf010e222
+f0103111:	e8 2a cf ff ff       	call   f0100040 <_panic>
+f0103116:	52                   	push   %edx
+f0103117:	68 24 d0 10 f0       	push   $0xf010d024
+f010311c:	6a 61                	push   $0x61
+f010311e:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0103123:	e8 18 cf ff ff       	call   f0100040 <_panic>
+f0103128:	68 09 e4 10 f0       	push   $0xf010e409
+f010312d:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103132:	68 21 06 00 00       	push   $0x621
+f0103137:	68 22 e2 10 f0       	push   $0xf010e222
+f010313c:	e8 ff ce ff ff       	call   f0100040 <_panic>
+f0103141:	68 27 e4 10 f0       	push   $0xf010e427
+f0103146:	68 0d e2 10 f0       	push   $0xf010e20d
+f010314b:	68 22 06 00 00       	push   $0x622
+f0103150:	68 22 e2 10 f0       	push   $0xf010e222
+f0103155:	e8 e6 ce ff ff       	call   f0100040 <_panic>
+f010315a:	52                   	push   %edx
+f010315b:	68 24 d0 10 f0       	push   $0xf010d024
+f0103160:	6a 61                	push   $0x61
+f0103162:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0103167:	e8 d4 ce ff ff       	call   f0100040 <_panic>
+f010316c:	68 37 e4 10 f0       	push   $0xf010e437
+f0103171:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103176:	68 25 06 00 00       	push   $0x625
+f010317b:	68 22 e2 10 f0       	push   $0xf010e222
+f0103180:	e8 bb ce ff ff       	call   f0100040 <_panic>
+f0103185:	68 41 e4 10 f0       	push   $0xf010e441
+f010318a:	68 0d e2 10 f0       	push   $0xf010e20d
+f010318f:	68 32 06 00 00       	push   $0x632
+f0103194:	68 22 e2 10 f0       	push   $0xf010e222
+f0103199:	e8 a2 ce ff ff       	call   f0100040 <_panic>
+f010319e:	68 4f e3 10 f0       	push   $0xf010e34f
+f01031a3:	68 0d e2 10 f0       	push   $0xf010e20d
+f01031a8:	68 a3 06 00 00       	push   $0x6a3
+f01031ad:	68 22 e2 10 f0       	push   $0xf010e222
+f01031b2:	e8 89 ce ff ff       	call   f0100040 <_panic>
+f01031b7:	68 65 e3 10 f0       	push   $0xf010e365
+f01031bc:	68 0d e2 10 f0       	push   $0xf010e20d
+f01031c1:	68 a4 06 00 00       	push   $0x6a4
+f01031c6:	68 22 e2 10 f0       	push   $0xf010e222
+f01031cb:	e8 70 ce ff ff       	call   f0100040 <_panic>
+f01031d0:	68 7b e3 10 f0       	push   $0xf010e37b
+f01031d5:	68 0d e2 10 f0       	push   $0xf010e20d
+f01031da:	68 a5 06 00 00       	push   $0x6a5
+f01031df:	68 22 e2 10 f0       	push   $0xf010e222
+f01031e4:	e8 57 ce ff ff       	call   f0100040 <_panic>
+f01031e9:	68 91 e3 10 f0       	push   $0xf010e391
+f01031ee:	68 0d e2 10 f0       	push   $0xf010e20d
+f01031f3:	68 a8 06 00 00       	push   $0x6a8
+f01031f8:	68 22 e2 10 f0       	push   $0xf010e222
+f01031fd:	e8 3e ce ff ff       	call   f0100040 <_panic>
+f0103202:	68 18 db 10 f0       	push   $0xf010db18
+f0103207:	68 0d e2 10 f0       	push   $0xf010e20d
+f010320c:	68 a9 06 00 00       	push   $0x6a9
+f0103211:	68 22 e2 10 f0       	push   $0xf010e222
+f0103216:	e8 25 ce ff ff       	call   f0100040 <_panic>
+f010321b:	68 fa e3 10 f0       	push   $0xf010e3fa
+f0103220:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103225:	68 b0 06 00 00       	push   $0x6b0
+f010322a:	68 22 e2 10 f0       	push   $0xf010e222
+f010322f:	e8 0c ce ff ff       	call   f0100040 <_panic>
+f0103234:	68 58 db 10 f0       	push   $0xf010db58
+f0103239:	68 0d e2 10 f0       	push   $0xf010e20d
+f010323e:	68 b3 06 00 00       	push   $0x6b3
+f0103243:	68 22 e2 10 f0       	push   $0xf010e222
+f0103248:	e8 f3 cd ff ff       	call   f0100040 <_panic>
+f010324d:	68 90 db 10 f0       	push   $0xf010db90
+f0103252:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103257:	68 b6 06 00 00       	push   $0x6b6
+f010325c:	68 22 e2 10 f0       	push   $0xf010e222
+f0103261:	e8 da cd ff ff       	call   f0100040 <_panic>
+f0103266:	68 c0 db 10 f0       	push   $0xf010dbc0
+f010326b:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103270:	68 ba 06 00 00       	push   $0x6ba
+f0103275:	68 22 e2 10 f0       	push   $0xf010e222
+f010327a:	e8 c1 cd ff ff       	call   f0100040 <_panic>
+f010327f:	68 f0 db 10 f0       	push   $0xf010dbf0
+f0103284:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103289:	68 bb 06 00 00       	push   $0x6bb
+f010328e:	68 22 e2 10 f0       	push   $0xf010e222
+f0103293:	e8 a8 cd ff ff       	call   f0100040 <_panic>
+f0103298:	68 18 dc 10 f0       	push   $0xf010dc18
+f010329d:	68 0d e2 10 f0       	push   $0xf010e20d
+f01032a2:	68 bc 06 00 00       	push   $0x6bc
+f01032a7:	68 22 e2 10 f0       	push   $0xf010e222
+f01032ac:	e8 8f cd ff ff       	call   f0100040 <_panic>
+f01032b1:	68 4c e4 10 f0       	push   $0xf010e44c
+f01032b6:	68 0d e2 10 f0       	push   $0xf010e20d
+f01032bb:	68 bd 06 00 00       	push   $0x6bd
+f01032c0:	68 22 e2 10 f0       	push   $0xf010e222
+f01032c5:	e8 76 cd ff ff       	call   f0100040 <_panic>
+f01032ca:	68 5d e4 10 f0       	push   $0xf010e45d
+f01032cf:	68 0d e2 10 f0       	push   $0xf010e20d
+f01032d4:	68 be 06 00 00       	push   $0x6be
+f01032d9:	68 22 e2 10 f0       	push   $0xf010e222
+f01032de:	e8 5d cd ff ff       	call   f0100040 <_panic>
+f01032e3:	68 48 dc 10 f0       	push   $0xf010dc48
+f01032e8:	68 0d e2 10 f0       	push   $0xf010e20d
+f01032ed:	68 c1 06 00 00       	push   $0x6c1
+f01032f2:	68 22 e2 10 f0       	push   $0xf010e222
+f01032f7:	e8 44 cd ff ff       	call   f0100040 <_panic>
+f01032fc:	68 84 dc 10 f0       	push   $0xf010dc84
+f0103301:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103306:	68 c2 06 00 00       	push   $0x6c2
+f010330b:	68 22 e2 10 f0       	push   $0xf010e222
+f0103310:	e8 2b cd ff ff       	call   f0100040 <_panic>
+f0103315:	68 6e e4 10 f0       	push   $0xf010e46e
+f010331a:	68 0d e2 10 f0       	push   $0xf010e20d
+f010331f:	68 c3 06 00 00       	push   $0x6c3
+f0103324:	68 22 e2 10 f0       	push   $0xf010e222
+f0103329:	e8 12 cd ff ff       	call   f0100040 <_panic>
+f010332e:	68 fa e3 10 f0       	push   $0xf010e3fa
+f0103333:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103338:	68 c6 06 00 00       	push   $0x6c6
+f010333d:	68 22 e2 10 f0       	push   $0xf010e222
+f0103342:	e8 f9 cc ff ff       	call   f0100040 <_panic>
+f0103347:	68 48 dc 10 f0       	push   $0xf010dc48
+f010334c:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103351:	68 c9 06 00 00       	push   $0x6c9
+f0103356:	68 22 e2 10 f0       	push   $0xf010e222
+f010335b:	e8 e0 cc ff ff       	call   f0100040 <_panic>
+f0103360:	68 84 dc 10 f0       	push   $0xf010dc84
+f0103365:	68 0d e2 10 f0       	push   $0xf010e20d
+f010336a:	68 ca 06 00 00       	push   $0x6ca
+f010336f:	68 22 e2 10 f0       	push   $0xf010e222
+f0103374:	e8 c7 cc ff ff       	call   f0100040 <_panic>
+f0103379:	68 6e e4 10 f0       	push   $0xf010e46e
+f010337e:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103383:	68 cb 06 00 00       	push   $0x6cb
+f0103388:	68 22 e2 10 f0       	push   $0xf010e222
+f010338d:	e8 ae cc ff ff       	call   f0100040 <_panic>
+f0103392:	68 fa e3 10 f0       	push   $0xf010e3fa
+f0103397:	68 0d e2 10 f0       	push   $0xf010e20d
+f010339c:	68 cf 06 00 00       	push   $0x6cf
+f01033a1:	68 22 e2 10 f0       	push   $0xf010e222
+f01033a6:	e8 95 cc ff ff       	call   f0100040 <_panic>
+f01033ab:	56                   	push   %esi
+f01033ac:	68 24 d0 10 f0       	push   $0xf010d024
+f01033b1:	68 d2 06 00 00       	push   $0x6d2
+f01033b6:	68 22 e2 10 f0       	push   $0xf010e222
+f01033bb:	e8 80 cc ff ff       	call   f0100040 <_panic>
+f01033c0:	68 b4 dc 10 f0       	push   $0xf010dcb4
+f01033c5:	68 0d e2 10 f0       	push   $0xf010e20d
+f01033ca:	68 d3 06 00 00       	push   $0x6d3
+f01033cf:	68 22 e2 10 f0       	push   $0xf010e222
+f01033d4:	e8 67 cc ff ff       	call   f0100040 <_panic>
+f01033d9:	68 f4 dc 10 f0       	push   $0xf010dcf4
+f01033de:	68 0d e2 10 f0       	push   $0xf010e20d
+f01033e3:	68 d6 06 00 00       	push   $0x6d6
+f01033e8:	68 22 e2 10 f0       	push   $0xf010e222
+f01033ed:	e8 4e cc ff ff       	call   f0100040 <_panic>
+f01033f2:	68 84 dc 10 f0       	push   $0xf010dc84
+f01033f7:	68 0d e2 10 f0       	push   $0xf010e20d
+f01033fc:	68 d7 06 00 00       	push   $0x6d7
+f0103401:	68 22 e2 10 f0       	push   $0xf010e222
+f0103406:	e8 35 cc ff ff       	call   f0100040 <_panic>
+f010340b:	68 6e e4 10 f0       	push   $0xf010e46e
+f0103410:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103415:	68 d8 06 00 00       	push   $0x6d8
+f010341a:	68 22 e2 10 f0       	push   $0xf010e222
+f010341f:	e8 1c cc ff ff       	call   f0100040 <_panic>
+f0103424:	68 34 dd 10 f0       	push   $0xf010dd34
+f0103429:	68 0d e2 10 f0       	push   $0xf010e20d
+f010342e:	68 d9 06 00 00       	push   $0x6d9
+f0103433:	68 22 e2 10 f0       	push   $0xf010e222
+f0103438:	e8 03 cc ff ff       	call   f0100040 <_panic>
+f010343d:	68 7f e4 10 f0       	push   $0xf010e47f
+f0103442:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103447:	68 da 06 00 00       	push   $0x6da
+f010344c:	68 22 e2 10 f0       	push   $0xf010e222
+f0103451:	e8 ea cb ff ff       	call   f0100040 <_panic>
+f0103456:	68 68 dd 10 f0       	push   $0xf010dd68
+f010345b:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103460:	68 dd 06 00 00       	push   $0x6dd
+f0103465:	68 22 e2 10 f0       	push   $0xf010e222
+f010346a:	e8 d1 cb ff ff       	call   f0100040 <_panic>
+f010346f:	68 a0 dd 10 f0       	push   $0xf010dda0
+f0103474:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103479:	68 e0 06 00 00       	push   $0x6e0
+f010347e:	68 22 e2 10 f0       	push   $0xf010e222
+f0103483:	e8 b8 cb ff ff       	call   f0100040 <_panic>
+f0103488:	68 dc dd 10 f0       	push   $0xf010dddc
+f010348d:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103492:	68 e1 06 00 00       	push   $0x6e1
+f0103497:	68 22 e2 10 f0       	push   $0xf010e222
+f010349c:	e8 9f cb ff ff       	call   f0100040 <_panic>
+f01034a1:	68 14 de 10 f0       	push   $0xf010de14
+f01034a6:	68 0d e2 10 f0       	push   $0xf010e20d
+f01034ab:	68 e4 06 00 00       	push   $0x6e4
+f01034b0:	68 22 e2 10 f0       	push   $0xf010e222
+f01034b5:	e8 86 cb ff ff       	call   f0100040 <_panic>
+f01034ba:	68 40 de 10 f0       	push   $0xf010de40
+f01034bf:	68 0d e2 10 f0       	push   $0xf010e20d
+f01034c4:	68 e5 06 00 00       	push   $0x6e5
+f01034c9:	68 22 e2 10 f0       	push   $0xf010e222
+f01034ce:	e8 6d cb ff ff       	call   f0100040 <_panic>
+f01034d3:	68 95 e4 10 f0       	push   $0xf010e495
+f01034d8:	68 0d e2 10 f0       	push   $0xf010e20d
+f01034dd:	68 e7 06 00 00       	push   $0x6e7
+f01034e2:	68 22 e2 10 f0       	push   $0xf010e222
+f01034e7:	e8 54 cb ff ff       	call   f0100040 <_panic>
+f01034ec:	68 a6 e4 10 f0       	push   $0xf010e4a6
+f01034f1:	68 0d e2 10 f0       	push   $0xf010e20d
+f01034f6:	68 e8 06 00 00       	push   $0x6e8
+f01034fb:	68 22 e2 10 f0       	push   $0xf010e222
+f0103500:	e8 3b cb ff ff       	call   f0100040 <_panic>
+f0103505:	68 70 de 10 f0       	push   $0xf010de70
+f010350a:	68 0d e2 10 f0       	push   $0xf010e20d
+f010350f:	68 eb 06 00 00       	push   $0x6eb
+f0103514:	68 22 e2 10 f0       	push   $0xf010e222
+f0103519:	e8 22 cb ff ff       	call   f0100040 <_panic>
+f010351e:	68 94 de 10 f0       	push   $0xf010de94
+f0103523:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103528:	68 ef 06 00 00       	push   $0x6ef
+f010352d:	68 22 e2 10 f0       	push   $0xf010e222
+f0103532:	e8 09 cb ff ff       	call   f0100040 <_panic>
+f0103537:	68 40 de 10 f0       	push   $0xf010de40
+f010353c:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103541:	68 f0 06 00 00       	push   $0x6f0
+f0103546:	68 22 e2 10 f0       	push   $0xf010e222
+f010354b:	e8 f0 ca ff ff       	call   f0100040 <_panic>
+f0103550:	68 4c e4 10 f0       	push   $0xf010e44c
+f0103555:	68 0d e2 10 f0       	push   $0xf010e20d
+f010355a:	68 f1 06 00 00       	push   $0x6f1
+f010355f:	68 22 e2 10 f0       	push   $0xf010e222
+f0103564:	e8 d7 ca ff ff       	call   f0100040 <_panic>
+f0103569:	68 a6 e4 10 f0       	push   $0xf010e4a6
+f010356e:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103573:	68 f2 06 00 00       	push   $0x6f2
+f0103578:	68 22 e2 10 f0       	push   $0xf010e222
+f010357d:	e8 be ca ff ff       	call   f0100040 <_panic>
+f0103582:	68 94 de 10 f0       	push   $0xf010de94
+f0103587:	68 0d e2 10 f0       	push   $0xf010e20d
+f010358c:	68 f6 06 00 00       	push   $0x6f6
+f0103591:	68 22 e2 10 f0       	push   $0xf010e222
+f0103596:	e8 a5 ca ff ff       	call   f0100040 <_panic>
+f010359b:	68 b8 de 10 f0       	push   $0xf010deb8
+f01035a0:	68 0d e2 10 f0       	push   $0xf010e20d
+f01035a5:	68 f7 06 00 00       	push   $0x6f7
+f01035aa:	68 22 e2 10 f0       	push   $0xf010e222
+f01035af:	e8 8c ca ff ff       	call   f0100040 <_panic>
+f01035b4:	68 b7 e4 10 f0       	push   $0xf010e4b7
+f01035b9:	68 0d e2 10 f0       	push   $0xf010e20d
+f01035be:	68 f8 06 00 00       	push   $0x6f8
+f01035c3:	68 22 e2 10 f0       	push   $0xf010e222
+f01035c8:	e8 73 ca ff ff       	call   f0100040 <_panic>
+f01035cd:	68 a6 e4 10 f0       	push   $0xf010e4a6
+f01035d2:	68 0d e2 10 f0       	push   $0xf010e20d
+f01035d7:	68 f9 06 00 00       	push   $0x6f9
+f01035dc:	68 22 e2 10 f0       	push   $0xf010e222
+f01035e1:	e8 5a ca ff ff       	call   f0100040 <_panic>
+f01035e6:	68 e0 de 10 f0       	push   $0xf010dee0
+f01035eb:	68 0d e2 10 f0       	push   $0xf010e20d
+f01035f0:	68 fc 06 00 00       	push   $0x6fc
+f01035f5:	68 22 e2 10 f0       	push   $0xf010e222
+f01035fa:	e8 41 ca ff ff       	call   f0100040 <_panic>
+f01035ff:	68 fa e3 10 f0       	push   $0xf010e3fa
+f0103604:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103609:	68 ff 06 00 00       	push   $0x6ff
+f010360e:	68 22 e2 10 f0       	push   $0xf010e222
+f0103613:	e8 28 ca ff ff       	call   f0100040 <_panic>
+f0103618:	68 f0 db 10 f0       	push   $0xf010dbf0
+f010361d:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103622:	68 02 07 00 00       	push   $0x702
+f0103627:	68 22 e2 10 f0       	push   $0xf010e222
+f010362c:	e8 0f ca ff ff       	call   f0100040 <_panic>
+f0103631:	68 5d e4 10 f0       	push   $0xf010e45d
+f0103636:	68 0d e2 10 f0       	push   $0xf010e20d
+f010363b:	68 04 07 00 00       	push   $0x704
+f0103640:	68 22 e2 10 f0       	push   $0xf010e222
+f0103645:	e8 f6 c9 ff ff       	call   f0100040 <_panic>
+f010364a:	52                   	push   %edx
+f010364b:	68 24 d0 10 f0       	push   $0xf010d024
+f0103650:	68 0b 07 00 00       	push   $0x70b
+f0103655:	68 22 e2 10 f0       	push   $0xf010e222
+f010365a:	e8 e1 c9 ff ff       	call   f0100040 <_panic>
+f010365f:	68 c8 e4 10 f0       	push   $0xf010e4c8
+f0103664:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103669:	68 0c 07 00 00       	push   $0x70c
+f010366e:	68 22 e2 10 f0       	push   $0xf010e222
+f0103673:	e8 c8 c9 ff ff       	call   f0100040 <_panic>
+f0103678:	52                   	push   %edx
+f0103679:	68 24 d0 10 f0       	push   $0xf010d024
+f010367e:	6a 61                	push   $0x61
+f0103680:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0103685:	e8 b6 c9 ff ff       	call   f0100040 <_panic>
+f010368a:	52                   	push   %edx
+f010368b:	68 24 d0 10 f0       	push   $0xf010d024
+f0103690:	6a 61                	push   $0x61
+f0103692:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0103697:	e8 a4 c9 ff ff       	call   f0100040 <_panic>
+f010369c:	68 e0 e4 10 f0       	push   $0xf010e4e0
+f01036a1:	68 0d e2 10 f0       	push   $0xf010e20d
+f01036a6:	68 16 07 00 00       	push   $0x716
+f01036ab:	68 22 e2 10 f0       	push   $0xf010e222
+f01036b0:	e8 8b c9 ff ff       	call   f0100040 <_panic>
+f01036b5:	50                   	push   %eax
+f01036b6:	68 48 d0 10 f0       	push   $0xf010d048
+f01036bb:	68 fe 00 00 00       	push   $0xfe
+f01036c0:	68 22 e2 10 f0       	push   $0xf010e222
+f01036c5:	e8 76 c9 ff ff       	call   f0100040 <_panic>
+f01036ca:	50                   	push   %eax
+f01036cb:	68 48 d0 10 f0       	push   $0xf010d048
+f01036d0:	68 09 01 00 00       	push   $0x109
+f01036d5:	68 22 e2 10 f0       	push   $0xf010e222
+f01036da:	e8 61 c9 ff ff       	call   f0100040 <_panic>
+f01036df:	50                   	push   %eax
+f01036e0:	68 48 d0 10 f0       	push   $0xf010d048
+f01036e5:	68 0f 01 00 00       	push   $0x10f
+f01036ea:	68 22 e2 10 f0       	push   $0xf010e222
+f01036ef:	e8 4c c9 ff ff       	call   f0100040 <_panic>
+f01036f4:	50                   	push   %eax
+f01036f5:	68 48 d0 10 f0       	push   $0xf010d048
+f01036fa:	68 16 01 00 00       	push   $0x116
+f01036ff:	68 22 e2 10 f0       	push   $0xf010e222
+f0103704:	e8 37 c9 ff ff       	call   f0100040 <_panic>
+f0103709:	50                   	push   %eax
+f010370a:	68 48 d0 10 f0       	push   $0xf010d048
+f010370f:	68 23 01 00 00       	push   $0x123
+f0103714:	68 22 e2 10 f0       	push   $0xf010e222
+f0103719:	e8 22 c9 ff ff       	call   f0100040 <_panic>
+f010371e:	bb 00 30 2d f0       	mov    $0xf02d3000,%ebx
+f0103723:	e9 2c f8 ff ff       	jmp    f0102f54 <mem_init+0xc7f>
+f0103728:	8b 3d 6c 1a 2d f0    	mov    0xf02d1a6c,%edi
+f010372e:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f0103733:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+f0103739:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010373c:	8d 04 85 ff 0f 00 00 	lea    0xfff(,%eax,4),%eax
+f0103743:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0103748:	74 5e                	je     f01037a8 <mem_init+0x14d3>
+f010374a:	8b 35 70 1a 2d f0    	mov    0xf02d1a70,%esi
+f0103750:	8d 8e 00 00 00 10    	lea    0x10000000(%esi),%ecx
+f0103756:	8b 9d 5c ff ff ff    	mov    -0xa4(%ebp),%ebx
+f010375c:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+f0103762:	89 b5 6c ff ff ff    	mov    %esi,-0x94(%ebp)
+f0103768:	89 c6                	mov    %eax,%esi
+f010376a:	89 cf                	mov    %ecx,%edi
+f010376c:	8d 93 00 00 00 ef    	lea    -0x11000000(%ebx),%edx
+f0103772:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0103778:	e8 b2 dc ff ff       	call   f010142f <check_va2pa>
+f010377d:	81 bd 6c ff ff ff ff 	cmpl   $0xefffffff,-0x94(%ebp)
+f0103784:	ff ff ef 
+f0103787:	0f 86 58 01 00 00    	jbe    f01038e5 <mem_init+0x1610>
+f010378d:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+f0103790:	39 d0                	cmp    %edx,%eax
+f0103792:	0f 85 68 01 00 00    	jne    f0103900 <mem_init+0x162b>
+f0103798:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010379e:	39 f3                	cmp    %esi,%ebx
+f01037a0:	72 ca                	jb     f010376c <mem_init+0x1497>
+f01037a2:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+f01037a8:	8b 35 78 57 2b f0    	mov    0xf02b5778,%esi
+f01037ae:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+f01037b3:	8d 86 00 00 40 21    	lea    0x21400000(%esi),%eax
+f01037b9:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+f01037bf:	89 c7                	mov    %eax,%edi
+f01037c1:	89 da                	mov    %ebx,%edx
+f01037c3:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f01037c9:	e8 61 dc ff ff       	call   f010142f <check_va2pa>
+f01037ce:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f01037d4:	0f 86 3f 01 00 00    	jbe    f0103919 <mem_init+0x1644>
+f01037da:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+f01037dd:	39 d0                	cmp    %edx,%eax
+f01037df:	0f 85 49 01 00 00    	jne    f010392e <mem_init+0x1659>
+f01037e5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01037eb:	81 fb 00 b0 c6 ee    	cmp    $0xeec6b000,%ebx
+f01037f1:	75 ce                	jne    f01037c1 <mem_init+0x14ec>
+f01037f3:	8b 35 a4 b4 32 f0    	mov    0xf032b4a4,%esi
+f01037f9:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+f01037fe:	8d 86 00 00 80 21    	lea    0x21800000(%esi),%eax
+f0103804:	89 c7                	mov    %eax,%edi
+f0103806:	89 da                	mov    %ebx,%edx
+f0103808:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f010380e:	e8 1c dc ff ff       	call   f010142f <check_va2pa>
+f0103813:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f0103819:	0f 86 28 01 00 00    	jbe    f0103947 <mem_init+0x1672>
+f010381f:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+f0103822:	39 d0                	cmp    %edx,%eax
+f0103824:	0f 85 32 01 00 00    	jne    f010395c <mem_init+0x1687>
+f010382a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103830:	81 fb 00 10 84 ee    	cmp    $0xee841000,%ebx
+f0103836:	75 ce                	jne    f0103806 <mem_init+0x1531>
+f0103838:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+f010383e:	ba 00 f0 bf ee       	mov    $0xeebff000,%edx
+f0103843:	89 f8                	mov    %edi,%eax
+f0103845:	e8 e5 db ff ff       	call   f010142f <check_va2pa>
+f010384a:	8b 15 a0 b4 32 f0    	mov    0xf032b4a0,%edx
+f0103850:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0103856:	0f 86 19 01 00 00    	jbe    f0103975 <mem_init+0x16a0>
+f010385c:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+f0103862:	39 d0                	cmp    %edx,%eax
+f0103864:	0f 85 2a 01 00 00    	jne    f0103994 <mem_init+0x16bf>
+f010386a:	8b 9d 5c ff ff ff    	mov    -0xa4(%ebp),%ebx
+f0103870:	8b b5 68 ff ff ff    	mov    -0x98(%ebp),%esi
+f0103876:	c1 e6 0c             	shl    $0xc,%esi
+f0103879:	0f 84 0b 01 00 00    	je     f010398a <mem_init+0x16b5>
+f010387f:	8d 93 00 00 00 f0    	lea    -0x10000000(%ebx),%edx
+f0103885:	89 f8                	mov    %edi,%eax
+f0103887:	e8 a3 db ff ff       	call   f010142f <check_va2pa>
+f010388c:	39 d8                	cmp    %ebx,%eax
+f010388e:	0f 85 19 01 00 00    	jne    f01039ad <mem_init+0x16d8>
+f0103894:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f010389a:	39 f3                	cmp    %esi,%ebx
+f010389c:	72 e1                	jb     f010387f <mem_init+0x15aa>
+f010389e:	bb 00 00 00 fe       	mov    $0xfe000000,%ebx
+f01038a3:	89 da                	mov    %ebx,%edx
+f01038a5:	89 f8                	mov    %edi,%eax
+f01038a7:	e8 83 db ff ff       	call   f010142f <check_va2pa>
+f01038ac:	39 d8                	cmp    %ebx,%eax
+f01038ae:	0f 85 12 01 00 00    	jne    f01039c6 <mem_init+0x16f1>
+f01038b4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01038ba:	81 fb 00 f0 ff ff    	cmp    $0xfffff000,%ebx
+f01038c0:	75 e1                	jne    f01038a3 <mem_init+0x15ce>
+f01038c2:	c7 85 68 ff ff ff 00 	movl   $0x6e3000,-0x98(%ebp)
+f01038c9:	30 6e 00 
+f01038cc:	c7 85 74 ff ff ff 00 	movl   $0xefc00000,-0x8c(%ebp)
+f01038d3:	00 c0 ef 
+f01038d6:	c7 85 6c ff ff ff 00 	movl   $0xefbf8000,-0x94(%ebp)
+f01038dd:	80 bf ef 
+f01038e0:	e9 82 01 00 00       	jmp    f0103a67 <mem_init+0x1792>
+f01038e5:	8b b5 6c ff ff ff    	mov    -0x94(%ebp),%esi
+f01038eb:	56                   	push   %esi
+f01038ec:	68 48 d0 10 f0       	push   $0xf010d048
+f01038f1:	68 4a 06 00 00       	push   $0x64a
+f01038f6:	68 22 e2 10 f0       	push   $0xf010e222
+f01038fb:	e8 40 c7 ff ff       	call   f0100040 <_panic>
+f0103900:	68 04 df 10 f0       	push   $0xf010df04
+f0103905:	68 0d e2 10 f0       	push   $0xf010e20d
+f010390a:	68 4a 06 00 00       	push   $0x64a
+f010390f:	68 22 e2 10 f0       	push   $0xf010e222
+f0103914:	e8 27 c7 ff ff       	call   f0100040 <_panic>
+f0103919:	56                   	push   %esi
+f010391a:	68 48 d0 10 f0       	push   $0xf010d048
+f010391f:	68 4f 06 00 00       	push   $0x64f
+f0103924:	68 22 e2 10 f0       	push   $0xf010e222
+f0103929:	e8 12 c7 ff ff       	call   f0100040 <_panic>
+f010392e:	68 38 df 10 f0       	push   $0xf010df38
+f0103933:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103938:	68 4f 06 00 00       	push   $0x64f
+f010393d:	68 22 e2 10 f0       	push   $0xf010e222
+f0103942:	e8 f9 c6 ff ff       	call   f0100040 <_panic>
+f0103947:	56                   	push   %esi
+f0103948:	68 48 d0 10 f0       	push   $0xf010d048
+f010394d:	68 54 06 00 00       	push   $0x654
+f0103952:	68 22 e2 10 f0       	push   $0xf010e222
+f0103957:	e8 e4 c6 ff ff       	call   f0100040 <_panic>
+f010395c:	68 6c df 10 f0       	push   $0xf010df6c
+f0103961:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103966:	68 54 06 00 00       	push   $0x654
+f010396b:	68 22 e2 10 f0       	push   $0xf010e222
+f0103970:	e8 cb c6 ff ff       	call   f0100040 <_panic>
+f0103975:	52                   	push   %edx
+f0103976:	68 48 d0 10 f0       	push   $0xf010d048
+f010397b:	68 57 06 00 00       	push   $0x657
+f0103980:	68 22 e2 10 f0       	push   $0xf010e222
+f0103985:	e8 b6 c6 ff ff       	call   f0100040 <_panic>
+f010398a:	bb 00 00 00 fe       	mov    $0xfe000000,%ebx
+f010398f:	e9 0f ff ff ff       	jmp    f01038a3 <mem_init+0x15ce>
+f0103994:	68 a8 df 10 f0       	push   $0xf010dfa8
+f0103999:	68 0d e2 10 f0       	push   $0xf010e20d
+f010399e:	68 57 06 00 00       	push   $0x657
+f01039a3:	68 22 e2 10 f0       	push   $0xf010e222
+f01039a8:	e8 93 c6 ff ff       	call   f0100040 <_panic>
+f01039ad:	68 d8 df 10 f0       	push   $0xf010dfd8
+f01039b2:	68 0d e2 10 f0       	push   $0xf010e20d
+f01039b7:	68 5b 06 00 00       	push   $0x65b
+f01039bc:	68 22 e2 10 f0       	push   $0xf010e222
+f01039c1:	e8 7a c6 ff ff       	call   f0100040 <_panic>
+f01039c6:	68 10 e5 10 f0       	push   $0xf010e510
+f01039cb:	68 0d e2 10 f0       	push   $0xf010e20d
+f01039d0:	68 5f 06 00 00       	push   $0x65f
+f01039d5:	68 22 e2 10 f0       	push   $0xf010e222
+f01039da:	e8 61 c6 ff ff       	call   f0100040 <_panic>
+f01039df:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+f01039e5:	68 48 d0 10 f0       	push   $0xf010d048
+f01039ea:	68 67 06 00 00       	push   $0x667
+f01039ef:	68 22 e2 10 f0       	push   $0xf010e222
+f01039f4:	e8 47 c6 ff ff       	call   f0100040 <_panic>
+f01039f9:	68 00 e0 10 f0       	push   $0xf010e000
+f01039fe:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103a03:	68 66 06 00 00       	push   $0x666
+f0103a08:	68 22 e2 10 f0       	push   $0xf010e222
+f0103a0d:	e8 2e c6 ff ff       	call   f0100040 <_panic>
+f0103a12:	68 48 e0 10 f0       	push   $0xf010e048
+f0103a17:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103a1c:	68 69 06 00 00       	push   $0x669
+f0103a21:	68 22 e2 10 f0       	push   $0xf010e222
+f0103a26:	e8 15 c6 ff ff       	call   f0100040 <_panic>
+f0103a2b:	89 d8                	mov    %ebx,%eax
+f0103a2d:	2d 00 00 01 00       	sub    $0x10000,%eax
+f0103a32:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+f0103a38:	81 ad 74 ff ff ff 00 	subl   $0x10000,-0x8c(%ebp)
+f0103a3f:	00 01 00 
+f0103a42:	81 85 70 ff ff ff 00 	addl   $0x8000,-0x90(%ebp)
+f0103a49:	80 00 00 
+f0103a4c:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+f0103a52:	81 85 68 ff ff ff 00 	addl   $0x18000,-0x98(%ebp)
+f0103a59:	80 01 00 
+f0103a5c:	3d 00 30 31 f0       	cmp    $0xf0313000,%eax
+f0103a61:	0f 84 80 00 00 00    	je     f0103ae7 <mem_init+0x1812>
+f0103a67:	8b 9d 6c ff ff ff    	mov    -0x94(%ebp),%ebx
+f0103a6d:	8d b3 00 80 ff ff    	lea    -0x8000(%ebx),%esi
+f0103a73:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+f0103a79:	05 00 80 ff 0f       	add    $0xfff8000,%eax
+f0103a7e:	89 b5 64 ff ff ff    	mov    %esi,-0x9c(%ebp)
+f0103a84:	89 c6                	mov    %eax,%esi
+f0103a86:	89 da                	mov    %ebx,%edx
+f0103a88:	89 f8                	mov    %edi,%eax
+f0103a8a:	e8 a0 d9 ff ff       	call   f010142f <check_va2pa>
+f0103a8f:	81 bd 70 ff ff ff ff 	cmpl   $0xefffffff,-0x90(%ebp)
+f0103a96:	ff ff ef 
+f0103a99:	0f 86 40 ff ff ff    	jbe    f01039df <mem_init+0x170a>
+f0103a9f:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f0103aa2:	39 c2                	cmp    %eax,%edx
+f0103aa4:	0f 85 4f ff ff ff    	jne    f01039f9 <mem_init+0x1724>
+f0103aaa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103ab0:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+f0103ab6:	39 c3                	cmp    %eax,%ebx
+f0103ab8:	75 cc                	jne    f0103a86 <mem_init+0x17b1>
+f0103aba:	8b b5 64 ff ff ff    	mov    -0x9c(%ebp),%esi
+f0103ac0:	8b 9d 6c ff ff ff    	mov    -0x94(%ebp),%ebx
+f0103ac6:	89 f2                	mov    %esi,%edx
+f0103ac8:	89 f8                	mov    %edi,%eax
+f0103aca:	e8 60 d9 ff ff       	call   f010142f <check_va2pa>
+f0103acf:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0103ad2:	0f 85 3a ff ff ff    	jne    f0103a12 <mem_init+0x173d>
+f0103ad8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103ade:	39 f3                	cmp    %esi,%ebx
+f0103ae0:	75 e4                	jne    f0103ac6 <mem_init+0x17f1>
+f0103ae2:	e9 44 ff ff ff       	jmp    f0103a2b <mem_init+0x1756>
+f0103ae7:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+f0103aed:	eb 36                	jmp    f0103b25 <mem_init+0x1850>
+f0103aef:	f6 04 87 01          	testb  $0x1,(%edi,%eax,4)
+f0103af3:	75 48                	jne    f0103b3d <mem_init+0x1868>
+f0103af5:	68 2b e5 10 f0       	push   $0xf010e52b
+f0103afa:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103aff:	68 74 06 00 00       	push   $0x674
+f0103b04:	68 22 e2 10 f0       	push   $0xf010e222
+f0103b09:	e8 32 c5 ff ff       	call   f0100040 <_panic>
+f0103b0e:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f0103b11:	f6 c2 01             	test   $0x1,%dl
+f0103b14:	74 2c                	je     f0103b42 <mem_init+0x186d>
+f0103b16:	f6 c2 02             	test   $0x2,%dl
+f0103b19:	74 40                	je     f0103b5b <mem_init+0x1886>
+f0103b1b:	83 c0 01             	add    $0x1,%eax
+f0103b1e:	3d 00 04 00 00       	cmp    $0x400,%eax
+f0103b23:	74 68                	je     f0103b8d <mem_init+0x18b8>
+f0103b25:	8d 90 46 fc ff ff    	lea    -0x3ba(%eax),%edx
+f0103b2b:	83 fa 04             	cmp    $0x4,%edx
+f0103b2e:	76 bf                	jbe    f0103aef <mem_init+0x181a>
+f0103b30:	3d bf 03 00 00       	cmp    $0x3bf,%eax
+f0103b35:	77 d7                	ja     f0103b0e <mem_init+0x1839>
+f0103b37:	83 3c 87 00          	cmpl   $0x0,(%edi,%eax,4)
+f0103b3b:	75 37                	jne    f0103b74 <mem_init+0x189f>
+f0103b3d:	83 c0 01             	add    $0x1,%eax
+f0103b40:	eb e3                	jmp    f0103b25 <mem_init+0x1850>
+f0103b42:	68 2b e5 10 f0       	push   $0xf010e52b
+f0103b47:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103b4c:	68 78 06 00 00       	push   $0x678
+f0103b51:	68 22 e2 10 f0       	push   $0xf010e222
+f0103b56:	e8 e5 c4 ff ff       	call   f0100040 <_panic>
+f0103b5b:	68 3c e5 10 f0       	push   $0xf010e53c
+f0103b60:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103b65:	68 79 06 00 00       	push   $0x679
+f0103b6a:	68 22 e2 10 f0       	push   $0xf010e222
+f0103b6f:	e8 cc c4 ff ff       	call   f0100040 <_panic>
+f0103b74:	68 4d e5 10 f0       	push   $0xf010e54d
+f0103b79:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103b7e:	68 7b 06 00 00       	push   $0x67b
+f0103b83:	68 22 e2 10 f0       	push   $0xf010e222
+f0103b88:	e8 b3 c4 ff ff       	call   f0100040 <_panic>
+f0103b8d:	83 ec 0c             	sub    $0xc,%esp
+f0103b90:	68 6c e0 10 f0       	push   $0xf010e06c
+f0103b95:	e8 6d 21 00 00       	call   f0105d07 <cprintf>
+f0103b9a:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f0103b9f:	83 c4 10             	add    $0x10,%esp
+f0103ba2:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103ba7:	0f 86 b8 02 00 00    	jbe    f0103e65 <mem_init+0x1b90>
+f0103bad:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103bb2:	0f 22 d8             	mov    %eax,%cr3
+f0103bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103bba:	e8 d3 d8 ff ff       	call   f0101492 <check_page_free_list>
+f0103bbf:	0f 20 c0             	mov    %cr0,%eax
+f0103bc2:	83 e0 f3             	and    $0xfffffff3,%eax
+f0103bc5:	0d 23 00 05 80       	or     $0x80050023,%eax
+f0103bca:	0f 22 c0             	mov    %eax,%cr0
+f0103bcd:	0f 20 e0             	mov    %cr4,%eax
+f0103bd0:	83 c8 10             	or     $0x10,%eax
+f0103bd3:	0f 22 e0             	mov    %eax,%cr4
+f0103bd6:	83 ec 0c             	sub    $0xc,%esp
+f0103bd9:	6a 00                	push   $0x0
+f0103bdb:	e8 ad e0 ff ff       	call   f0101c8d <page_alloc>
+f0103be0:	89 c3                	mov    %eax,%ebx
+f0103be2:	83 c4 10             	add    $0x10,%esp
+f0103be5:	85 c0                	test   %eax,%eax
+f0103be7:	0f 84 8d 02 00 00    	je     f0103e7a <mem_init+0x1ba5>
+f0103bed:	83 ec 0c             	sub    $0xc,%esp
+f0103bf0:	6a 00                	push   $0x0
+f0103bf2:	e8 96 e0 ff ff       	call   f0101c8d <page_alloc>
+f0103bf7:	89 c7                	mov    %eax,%edi
+f0103bf9:	83 c4 10             	add    $0x10,%esp
+f0103bfc:	85 c0                	test   %eax,%eax
+f0103bfe:	0f 84 8f 02 00 00    	je     f0103e93 <mem_init+0x1bbe>
+f0103c04:	83 ec 0c             	sub    $0xc,%esp
+f0103c07:	6a 00                	push   $0x0
+f0103c09:	e8 7f e0 ff ff       	call   f0101c8d <page_alloc>
+f0103c0e:	89 c6                	mov    %eax,%esi
+f0103c10:	83 c4 10             	add    $0x10,%esp
+f0103c13:	85 c0                	test   %eax,%eax
+f0103c15:	0f 84 91 02 00 00    	je     f0103eac <mem_init+0x1bd7>
+f0103c1b:	83 ec 0c             	sub    $0xc,%esp
+f0103c1e:	53                   	push   %ebx
+f0103c1f:	e8 26 de ff ff       	call   f0101a4a <page_free>
+f0103c24:	89 f8                	mov    %edi,%eax
+f0103c26:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0103c2c:	c1 f8 02             	sar    $0x2,%eax
+f0103c2f:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103c35:	89 c2                	mov    %eax,%edx
+f0103c37:	c1 e2 0c             	shl    $0xc,%edx
+f0103c3a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103c3f:	83 c4 10             	add    $0x10,%esp
+f0103c42:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0103c48:	0f 83 77 02 00 00    	jae    f0103ec5 <mem_init+0x1bf0>
+f0103c4e:	83 ec 04             	sub    $0x4,%esp
+f0103c51:	68 00 10 00 00       	push   $0x1000
+f0103c56:	6a 01                	push   $0x1
+f0103c58:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103c5e:	52                   	push   %edx
+f0103c5f:	e8 90 6c 00 00       	call   f010a8f4 <memset>
+f0103c64:	89 f0                	mov    %esi,%eax
+f0103c66:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0103c6c:	c1 f8 02             	sar    $0x2,%eax
+f0103c6f:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103c75:	89 c2                	mov    %eax,%edx
+f0103c77:	c1 e2 0c             	shl    $0xc,%edx
+f0103c7a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103c7f:	83 c4 10             	add    $0x10,%esp
+f0103c82:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0103c88:	0f 83 49 02 00 00    	jae    f0103ed7 <mem_init+0x1c02>
+f0103c8e:	83 ec 04             	sub    $0x4,%esp
+f0103c91:	68 00 10 00 00       	push   $0x1000
+f0103c96:	6a 02                	push   $0x2
+f0103c98:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103c9e:	52                   	push   %edx
+f0103c9f:	e8 50 6c 00 00       	call   f010a8f4 <memset>
+f0103ca4:	6a 02                	push   $0x2
+f0103ca6:	68 00 10 00 00       	push   $0x1000
+f0103cab:	57                   	push   %edi
+f0103cac:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0103cb2:	e8 9e e5 ff ff       	call   f0102255 <page_insert>
+f0103cb7:	83 c4 20             	add    $0x20,%esp
+f0103cba:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0103cbf:	0f 85 24 02 00 00    	jne    f0103ee9 <mem_init+0x1c14>
+f0103cc5:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f0103ccc:	01 01 01 
+f0103ccf:	0f 85 2d 02 00 00    	jne    f0103f02 <mem_init+0x1c2d>
+f0103cd5:	6a 02                	push   $0x2
+f0103cd7:	68 00 10 00 00       	push   $0x1000
+f0103cdc:	56                   	push   %esi
+f0103cdd:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0103ce3:	e8 6d e5 ff ff       	call   f0102255 <page_insert>
+f0103ce8:	83 c4 10             	add    $0x10,%esp
+f0103ceb:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f0103cf2:	02 02 02 
+f0103cf5:	0f 85 20 02 00 00    	jne    f0103f1b <mem_init+0x1c46>
+f0103cfb:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0103d00:	0f 85 2e 02 00 00    	jne    f0103f34 <mem_init+0x1c5f>
+f0103d06:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0103d0b:	0f 85 3c 02 00 00    	jne    f0103f4d <mem_init+0x1c78>
+f0103d11:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f0103d18:	03 03 03 
+f0103d1b:	89 f0                	mov    %esi,%eax
+f0103d1d:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0103d23:	c1 f8 02             	sar    $0x2,%eax
+f0103d26:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103d2c:	89 c2                	mov    %eax,%edx
+f0103d2e:	c1 e2 0c             	shl    $0xc,%edx
+f0103d31:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103d36:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0103d3c:	0f 83 24 02 00 00    	jae    f0103f66 <mem_init+0x1c91>
+f0103d42:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0103d49:	03 03 03 
+f0103d4c:	0f 85 26 02 00 00    	jne    f0103f78 <mem_init+0x1ca3>
+f0103d52:	83 ec 08             	sub    $0x8,%esp
+f0103d55:	68 00 10 00 00       	push   $0x1000
+f0103d5a:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f0103d60:	e8 aa e4 ff ff       	call   f010220f <page_remove>
+f0103d65:	83 c4 10             	add    $0x10,%esp
+f0103d68:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f0103d6d:	0f 85 1e 02 00 00    	jne    f0103f91 <mem_init+0x1cbc>
+f0103d73:	8b 0d 6c 1a 2d f0    	mov    0xf02d1a6c,%ecx
+f0103d79:	8b 11                	mov    (%ecx),%edx
+f0103d7b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0103d81:	89 d8                	mov    %ebx,%eax
+f0103d83:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0103d89:	c1 f8 02             	sar    $0x2,%eax
+f0103d8c:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103d92:	c1 e0 0c             	shl    $0xc,%eax
+f0103d95:	39 c2                	cmp    %eax,%edx
+f0103d97:	0f 85 0d 02 00 00    	jne    f0103faa <mem_init+0x1cd5>
+f0103d9d:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+f0103da3:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0103da8:	0f 85 15 02 00 00    	jne    f0103fc3 <mem_init+0x1cee>
+f0103dae:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+f0103db4:	83 ec 0c             	sub    $0xc,%esp
+f0103db7:	53                   	push   %ebx
+f0103db8:	e8 8d dc ff ff       	call   f0101a4a <page_free>
+f0103dbd:	c7 04 24 00 e1 10 f0 	movl   $0xf010e100,(%esp)
+f0103dc4:	e8 3e 1f 00 00       	call   f0105d07 <cprintf>
+f0103dc9:	83 c4 08             	add    $0x8,%esp
+f0103dcc:	68 5b e5 10 f0       	push   $0xf010e55b
+f0103dd1:	68 00 57 2b f0       	push   $0xf02b5700
+f0103dd6:	e8 35 75 00 00       	call   f010b310 <__spin_initlock>
+f0103ddb:	8b 15 68 1a 2d f0    	mov    0xf02d1a68,%edx
+f0103de1:	83 c4 10             	add    $0x10,%esp
+f0103de4:	85 d2                	test   %edx,%edx
+f0103de6:	74 1c                	je     f0103e04 <mem_init+0x1b2f>
+f0103de8:	8b 0d 70 1a 2d f0    	mov    0xf02d1a70,%ecx
+f0103dee:	8d 41 06             	lea    0x6(%ecx),%eax
+f0103df1:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0103df4:	8d 54 91 06          	lea    0x6(%ecx,%edx,4),%edx
+f0103df8:	66 c7 00 ff ff       	movw   $0xffff,(%eax)
+f0103dfd:	83 c0 0c             	add    $0xc,%eax
+f0103e00:	39 d0                	cmp    %edx,%eax
+f0103e02:	75 f4                	jne    f0103df8 <mem_init+0x1b23>
+f0103e04:	83 ec 0c             	sub    $0xc,%esp
+f0103e07:	68 00 57 2b f0       	push   $0xf02b5700
+f0103e0c:	e8 1a 75 00 00       	call   f010b32b <spin_lock>
+f0103e11:	8b 1d 70 57 2b f0    	mov    0xf02b5770,%ebx
+f0103e17:	83 c4 10             	add    $0x10,%esp
+f0103e1a:	85 db                	test   %ebx,%ebx
+f0103e1c:	74 18                	je     f0103e36 <mem_init+0x1b61>
+f0103e1e:	89 d8                	mov    %ebx,%eax
+f0103e20:	8b 1b                	mov    (%ebx),%ebx
+f0103e22:	89 1d 70 57 2b f0    	mov    %ebx,0xf02b5770
+f0103e28:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103e2d:	e8 b0 d3 ff ff       	call   f01011e2 <buddy_free_block>
+f0103e32:	85 db                	test   %ebx,%ebx
+f0103e34:	75 e8                	jne    f0103e1e <mem_init+0x1b49>
+f0103e36:	83 ec 0c             	sub    $0xc,%esp
+f0103e39:	68 00 57 2b f0       	push   $0xf02b5700
+f0103e3e:	e8 bc 75 00 00       	call   f010b3ff <spin_unlock>
+f0103e43:	8d 45 90             	lea    -0x70(%ebp),%eax
+f0103e46:	e8 8b d4 ff ff       	call   f01012d6 <buddy_count>
+f0103e4b:	c7 04 24 00 57 2b f0 	movl   $0xf02b5700,(%esp)
+f0103e52:	e8 d4 74 00 00       	call   f010b32b <spin_lock>
+f0103e57:	83 c4 10             	add    $0x10,%esp
+f0103e5a:	8b 9d 60 ff ff ff    	mov    -0xa0(%ebp),%ebx
+f0103e60:	e9 44 02 00 00       	jmp    f01040a9 <mem_init+0x1dd4>
+f0103e65:	50                   	push   %eax
+f0103e66:	68 48 d0 10 f0       	push   $0xf010d048
+f0103e6b:	68 3c 01 00 00       	push   $0x13c
+f0103e70:	68 22 e2 10 f0       	push   $0xf010e222
+f0103e75:	e8 c6 c1 ff ff       	call   f0100040 <_panic>
+f0103e7a:	68 4f e3 10 f0       	push   $0xf010e34f
+f0103e7f:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103e84:	68 31 07 00 00       	push   $0x731
+f0103e89:	68 22 e2 10 f0       	push   $0xf010e222
+f0103e8e:	e8 ad c1 ff ff       	call   f0100040 <_panic>
+f0103e93:	68 65 e3 10 f0       	push   $0xf010e365
+f0103e98:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103e9d:	68 32 07 00 00       	push   $0x732
+f0103ea2:	68 22 e2 10 f0       	push   $0xf010e222
+f0103ea7:	e8 94 c1 ff ff       	call   f0100040 <_panic>
+f0103eac:	68 7b e3 10 f0       	push   $0xf010e37b
+f0103eb1:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103eb6:	68 33 07 00 00       	push   $0x733
+f0103ebb:	68 22 e2 10 f0       	push   $0xf010e222
+f0103ec0:	e8 7b c1 ff ff       	call   f0100040 <_panic>
+f0103ec5:	52                   	push   %edx
+f0103ec6:	68 24 d0 10 f0       	push   $0xf010d024
+f0103ecb:	6a 61                	push   $0x61
+f0103ecd:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0103ed2:	e8 69 c1 ff ff       	call   f0100040 <_panic>
+f0103ed7:	52                   	push   %edx
+f0103ed8:	68 24 d0 10 f0       	push   $0xf010d024
+f0103edd:	6a 61                	push   $0x61
+f0103edf:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0103ee4:	e8 57 c1 ff ff       	call   f0100040 <_panic>
+f0103ee9:	68 4c e4 10 f0       	push   $0xf010e44c
+f0103eee:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103ef3:	68 38 07 00 00       	push   $0x738
+f0103ef8:	68 22 e2 10 f0       	push   $0xf010e222
+f0103efd:	e8 3e c1 ff ff       	call   f0100040 <_panic>
+f0103f02:	68 8c e0 10 f0       	push   $0xf010e08c
+f0103f07:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103f0c:	68 39 07 00 00       	push   $0x739
+f0103f11:	68 22 e2 10 f0       	push   $0xf010e222
+f0103f16:	e8 25 c1 ff ff       	call   f0100040 <_panic>
+f0103f1b:	68 b0 e0 10 f0       	push   $0xf010e0b0
+f0103f20:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103f25:	68 3b 07 00 00       	push   $0x73b
+f0103f2a:	68 22 e2 10 f0       	push   $0xf010e222
+f0103f2f:	e8 0c c1 ff ff       	call   f0100040 <_panic>
+f0103f34:	68 6e e4 10 f0       	push   $0xf010e46e
+f0103f39:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103f3e:	68 3c 07 00 00       	push   $0x73c
+f0103f43:	68 22 e2 10 f0       	push   $0xf010e222
+f0103f48:	e8 f3 c0 ff ff       	call   f0100040 <_panic>
+f0103f4d:	68 b7 e4 10 f0       	push   $0xf010e4b7
+f0103f52:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103f57:	68 3d 07 00 00       	push   $0x73d
+f0103f5c:	68 22 e2 10 f0       	push   $0xf010e222
+f0103f61:	e8 da c0 ff ff       	call   f0100040 <_panic>
+f0103f66:	52                   	push   %edx
+f0103f67:	68 24 d0 10 f0       	push   $0xf010d024
+f0103f6c:	6a 61                	push   $0x61
+f0103f6e:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0103f73:	e8 c8 c0 ff ff       	call   f0100040 <_panic>
+f0103f78:	68 d4 e0 10 f0       	push   $0xf010e0d4
+f0103f7d:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103f82:	68 3f 07 00 00       	push   $0x73f
+f0103f87:	68 22 e2 10 f0       	push   $0xf010e222
+f0103f8c:	e8 af c0 ff ff       	call   f0100040 <_panic>
+f0103f91:	68 a6 e4 10 f0       	push   $0xf010e4a6
+f0103f96:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103f9b:	68 41 07 00 00       	push   $0x741
+f0103fa0:	68 22 e2 10 f0       	push   $0xf010e222
+f0103fa5:	e8 96 c0 ff ff       	call   f0100040 <_panic>
+f0103faa:	68 f0 db 10 f0       	push   $0xf010dbf0
+f0103faf:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103fb4:	68 44 07 00 00       	push   $0x744
+f0103fb9:	68 22 e2 10 f0       	push   $0xf010e222
+f0103fbe:	e8 7d c0 ff ff       	call   f0100040 <_panic>
+f0103fc3:	68 5d e4 10 f0       	push   $0xf010e45d
+f0103fc8:	68 0d e2 10 f0       	push   $0xf010e20d
+f0103fcd:	68 46 07 00 00       	push   $0x746
+f0103fd2:	68 22 e2 10 f0       	push   $0xf010e222
+f0103fd7:	e8 64 c0 ff ff       	call   f0100040 <_panic>
+f0103fdc:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0103fe2:	c1 f8 02             	sar    $0x2,%eax
+f0103fe5:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103feb:	c1 e0 0c             	shl    $0xc,%eax
+f0103fee:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103ff3:	89 f9                	mov    %edi,%ecx
+f0103ff5:	d3 e2                	shl    %cl,%edx
+f0103ff7:	83 ea 01             	sub    $0x1,%edx
+f0103ffa:	85 d0                	test   %edx,%eax
+f0103ffc:	75 2a                	jne    f0104028 <mem_init+0x1d53>
+f0103ffe:	81 7e 04 00 00 ff ff 	cmpl   $0xffff0000,0x4(%esi)
+f0104005:	75 3a                	jne    f0104041 <mem_init+0x1d6c>
+f0104007:	b8 0c 00 00 00       	mov    $0xc,%eax
+f010400c:	d3 e0                	shl    %cl,%eax
+f010400e:	89 c7                	mov    %eax,%edi
+f0104010:	01 f7                	add    %esi,%edi
+f0104012:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+f0104018:	85 db                	test   %ebx,%ebx
+f010401a:	0f 8e 81 00 00 00    	jle    f01040a1 <mem_init+0x1dcc>
+f0104020:	89 b5 74 ff ff ff    	mov    %esi,-0x8c(%ebp)
+f0104026:	eb 39                	jmp    f0104061 <mem_init+0x1d8c>
+f0104028:	68 2c e1 10 f0       	push   $0xf010e12c
+f010402d:	68 0d e2 10 f0       	push   $0xf010e20d
+f0104032:	68 71 07 00 00       	push   $0x771
+f0104037:	68 22 e2 10 f0       	push   $0xf010e222
+f010403c:	e8 ff bf ff ff       	call   f0100040 <_panic>
+f0104041:	68 58 e1 10 f0       	push   $0xf010e158
+f0104046:	68 0d e2 10 f0       	push   $0xf010e20d
+f010404b:	68 72 07 00 00       	push   $0x772
+f0104050:	68 22 e2 10 f0       	push   $0xf010e222
+f0104055:	e8 e6 bf ff ff       	call   f0100040 <_panic>
+f010405a:	83 c0 01             	add    $0x1,%eax
+f010405d:	39 d8                	cmp    %ebx,%eax
+f010405f:	74 40                	je     f01040a1 <mem_init+0x1dcc>
+f0104061:	8b 94 85 78 ff ff ff 	mov    -0x88(%ebp,%eax,4),%edx
+f0104068:	85 d2                	test   %edx,%edx
+f010406a:	74 ee                	je     f010405a <mem_init+0x1d85>
+f010406c:	39 fa                	cmp    %edi,%edx
+f010406e:	73 ea                	jae    f010405a <mem_init+0x1d85>
+f0104070:	8b 0c 85 bc e5 10 f0 	mov    -0xfef1a44(,%eax,4),%ecx
+f0104077:	be 0c 00 00 00       	mov    $0xc,%esi
+f010407c:	d3 e6                	shl    %cl,%esi
+f010407e:	01 f2                	add    %esi,%edx
+f0104080:	39 95 74 ff ff ff    	cmp    %edx,-0x8c(%ebp)
+f0104086:	73 d2                	jae    f010405a <mem_init+0x1d85>
+f0104088:	68 84 e1 10 f0       	push   $0xf010e184
+f010408d:	68 0d e2 10 f0       	push   $0xf010e20d
+f0104092:	68 74 07 00 00       	push   $0x774
+f0104097:	68 22 e2 10 f0       	push   $0xf010e222
+f010409c:	e8 9f bf ff ff       	call   f0100040 <_panic>
+f01040a1:	83 c3 01             	add    $0x1,%ebx
+f01040a4:	83 fb 06             	cmp    $0x6,%ebx
+f01040a7:	74 3d                	je     f01040e6 <mem_init+0x1e11>
+f01040a9:	8b 3c 9d bc e5 10 f0 	mov    -0xfef1a44(,%ebx,4),%edi
+f01040b0:	89 f8                	mov    %edi,%eax
+f01040b2:	e8 1a d7 ff ff       	call   f01017d1 <buddy_alloc_block>
+f01040b7:	89 c6                	mov    %eax,%esi
+f01040b9:	89 84 9d 78 ff ff ff 	mov    %eax,-0x88(%ebp,%ebx,4)
+f01040c0:	85 c0                	test   %eax,%eax
+f01040c2:	0f 85 14 ff ff ff    	jne    f0103fdc <mem_init+0x1d07>
+f01040c8:	83 ff 0a             	cmp    $0xa,%edi
+f01040cb:	74 d4                	je     f01040a1 <mem_init+0x1dcc>
+f01040cd:	68 6b e5 10 f0       	push   $0xf010e56b
+f01040d2:	68 0d e2 10 f0       	push   $0xf010e20d
+f01040d7:	68 6e 07 00 00       	push   $0x76e
+f01040dc:	68 22 e2 10 f0       	push   $0xf010e222
+f01040e1:	e8 5a bf ff ff       	call   f0100040 <_panic>
+f01040e6:	83 ec 0c             	sub    $0xc,%esp
+f01040e9:	68 00 57 2b f0       	push   $0xf02b5700
+f01040ee:	e8 0c 73 00 00       	call   f010b3ff <spin_unlock>
+f01040f3:	83 c4 10             	add    $0x10,%esp
+f01040f6:	bb 05 00 00 00       	mov    $0x5,%ebx
+f01040fb:	eb 08                	jmp    f0104105 <mem_init+0x1e30>
+f01040fd:	83 eb 01             	sub    $0x1,%ebx
+f0104100:	83 fb ff             	cmp    $0xffffffff,%ebx
+f0104103:	74 20                	je     f0104125 <mem_init+0x1e50>
+f0104105:	8b 84 9d 78 ff ff ff 	mov    -0x88(%ebp,%ebx,4),%eax
+f010410c:	85 c0                	test   %eax,%eax
+f010410e:	74 ed                	je     f01040fd <mem_init+0x1e28>
+f0104110:	83 ec 08             	sub    $0x8,%esp
+f0104113:	ff 34 9d bc e5 10 f0 	push   -0xfef1a44(,%ebx,4)
+f010411a:	50                   	push   %eax
+f010411b:	e8 d7 d9 ff ff       	call   f0101af7 <page_free_npages>
+f0104120:	83 c4 10             	add    $0x10,%esp
+f0104123:	eb d8                	jmp    f01040fd <mem_init+0x1e28>
+f0104125:	8d 45 bc             	lea    -0x44(%ebp),%eax
+f0104128:	e8 a9 d1 ff ff       	call   f01012d6 <buddy_count>
+f010412d:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+f0104133:	8b 74 85 bc          	mov    -0x44(%ebp,%eax,4),%esi
+f0104137:	39 74 85 90          	cmp    %esi,-0x70(%ebp,%eax,4)
+f010413b:	75 27                	jne    f0104164 <mem_init+0x1e8f>
+f010413d:	83 c0 01             	add    $0x1,%eax
+f0104140:	83 f8 0b             	cmp    $0xb,%eax
+f0104143:	75 ee                	jne    f0104133 <mem_init+0x1e5e>
+f0104145:	83 ec 0c             	sub    $0xc,%esp
+f0104148:	68 9f e5 10 f0       	push   $0xf010e59f
+f010414d:	e8 b5 1b 00 00       	call   f0105d07 <cprintf>
+f0104152:	c7 05 e8 56 2b f0 01 	movl   $0x1,0xf02b56e8
+f0104159:	00 00 00 
+f010415c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010415f:	5b                   	pop    %ebx
+f0104160:	5e                   	pop    %esi
+f0104161:	5f                   	pop    %edi
+f0104162:	5d                   	pop    %ebp
+f0104163:	c3                   	ret
+f0104164:	68 89 e5 10 f0       	push   $0xf010e589
+f0104169:	68 0d e2 10 f0       	push   $0xf010e20d
+f010416e:	68 80 07 00 00       	push   $0x780
+f0104173:	68 22 e2 10 f0       	push   $0xf010e222
+f0104178:	e8 c3 be ff ff       	call   f0100040 <_panic>
+
+f010417d <page_cow>:
+f010417d:	55                   	push   %ebp
+f010417e:	89 e5                	mov    %esp,%ebp
+f0104180:	57                   	push   %edi
+f0104181:	56                   	push   %esi
+f0104182:	53                   	push   %ebx
+f0104183:	83 ec 30             	sub    $0x30,%esp
+f0104186:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0104189:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f010418f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0104192:	50                   	push   %eax
+f0104193:	56                   	push   %esi
+f0104194:	ff 75 08             	push   0x8(%ebp)
+f0104197:	e8 0b e0 ff ff       	call   f01021a7 <page_lookup>
+f010419c:	83 c4 10             	add    $0x10,%esp
+f010419f:	85 c0                	test   %eax,%eax
+f01041a1:	0f 84 2c 01 00 00    	je     f01042d3 <page_cow+0x156>
+f01041a7:	89 c3                	mov    %eax,%ebx
+f01041a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01041ac:	8b 02                	mov    (%edx),%eax
+f01041ae:	89 c1                	mov    %eax,%ecx
+f01041b0:	81 e1 04 08 00 00    	and    $0x804,%ecx
+f01041b6:	81 f9 04 08 00 00    	cmp    $0x804,%ecx
+f01041bc:	0f 85 18 01 00 00    	jne    f01042da <page_cow+0x15d>
+f01041c2:	25 05 06 00 00       	and    $0x605,%eax
+f01041c7:	83 c8 02             	or     $0x2,%eax
+f01041ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f01041cd:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01041d2:	0f 84 98 00 00 00    	je     f0104270 <page_cow+0xf3>
+f01041d8:	83 ec 0c             	sub    $0xc,%esp
+f01041db:	6a 00                	push   $0x0
+f01041dd:	e8 ab da ff ff       	call   f0101c8d <page_alloc>
+f01041e2:	89 c7                	mov    %eax,%edi
+f01041e4:	83 c4 10             	add    $0x10,%esp
+f01041e7:	85 c0                	test   %eax,%eax
+f01041e9:	0f 84 f2 00 00 00    	je     f01042e1 <page_cow+0x164>
+f01041ef:	8b 15 70 1a 2d f0    	mov    0xf02d1a70,%edx
+f01041f5:	29 d3                	sub    %edx,%ebx
+f01041f7:	c1 fb 02             	sar    $0x2,%ebx
+f01041fa:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f0104200:	89 d8                	mov    %ebx,%eax
+f0104202:	c1 e0 0c             	shl    $0xc,%eax
+f0104205:	8b 0d 68 1a 2d f0    	mov    0xf02d1a68,%ecx
+f010420b:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+f0104211:	39 cb                	cmp    %ecx,%ebx
+f0104213:	0f 83 83 00 00 00    	jae    f010429c <page_cow+0x11f>
+f0104219:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f010421e:	89 fb                	mov    %edi,%ebx
+f0104220:	29 d3                	sub    %edx,%ebx
+f0104222:	c1 fb 02             	sar    $0x2,%ebx
+f0104225:	69 d3 ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%edx
+f010422b:	89 d3                	mov    %edx,%ebx
+f010422d:	c1 e3 0c             	shl    $0xc,%ebx
+f0104230:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0104236:	39 ca                	cmp    %ecx,%edx
+f0104238:	73 74                	jae    f01042ae <page_cow+0x131>
+f010423a:	83 ec 04             	sub    $0x4,%esp
+f010423d:	68 00 10 00 00       	push   $0x1000
+f0104242:	50                   	push   %eax
+f0104243:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f0104249:	53                   	push   %ebx
+f010424a:	e8 da 66 00 00       	call   f010a929 <memmove>
+f010424f:	ff 75 d4             	push   -0x2c(%ebp)
+f0104252:	56                   	push   %esi
+f0104253:	57                   	push   %edi
+f0104254:	ff 75 08             	push   0x8(%ebp)
+f0104257:	e8 f9 df ff ff       	call   f0102255 <page_insert>
+f010425c:	83 c4 20             	add    $0x20,%esp
+f010425f:	85 c0                	test   %eax,%eax
+f0104261:	78 5d                	js     f01042c0 <page_cow+0x143>
+f0104263:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010426b:	5b                   	pop    %ebx
+f010426c:	5e                   	pop    %esi
+f010426d:	5f                   	pop    %edi
+f010426e:	5d                   	pop    %ebp
+f010426f:	c3                   	ret
+f0104270:	2b 1d 70 1a 2d f0    	sub    0xf02d1a70,%ebx
+f0104276:	c1 fb 02             	sar    $0x2,%ebx
+f0104279:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f010427f:	c1 e3 0c             	shl    $0xc,%ebx
+f0104282:	09 c3                	or     %eax,%ebx
+f0104284:	89 1a                	mov    %ebx,(%edx)
+f0104286:	83 ec 08             	sub    $0x8,%esp
+f0104289:	56                   	push   %esi
+f010428a:	ff 75 08             	push   0x8(%ebp)
+f010428d:	e8 f7 da ff ff       	call   f0101d89 <tlb_invalidate>
+f0104292:	83 c4 10             	add    $0x10,%esp
+f0104295:	b8 00 00 00 00       	mov    $0x0,%eax
+f010429a:	eb cc                	jmp    f0104268 <page_cow+0xeb>
+f010429c:	50                   	push   %eax
+f010429d:	68 24 d0 10 f0       	push   $0xf010d024
+f01042a2:	6a 61                	push   $0x61
+f01042a4:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01042a9:	e8 92 bd ff ff       	call   f0100040 <_panic>
+f01042ae:	53                   	push   %ebx
+f01042af:	68 24 d0 10 f0       	push   $0xf010d024
+f01042b4:	6a 61                	push   $0x61
+f01042b6:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01042bb:	e8 80 bd ff ff       	call   f0100040 <_panic>
+f01042c0:	83 ec 0c             	sub    $0xc,%esp
+f01042c3:	57                   	push   %edi
+f01042c4:	e8 81 d7 ff ff       	call   f0101a4a <page_free>
+f01042c9:	83 c4 10             	add    $0x10,%esp
+f01042cc:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01042d1:	eb 95                	jmp    f0104268 <page_cow+0xeb>
+f01042d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01042d8:	eb 8e                	jmp    f0104268 <page_cow+0xeb>
+f01042da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01042df:	eb 87                	jmp    f0104268 <page_cow+0xeb>
+f01042e1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01042e6:	eb 80                	jmp    f0104268 <page_cow+0xeb>
+
+f01042e8 <page_alloc_npages>:
+f01042e8:	55                   	push   %ebp
+f01042e9:	89 e5                	mov    %esp,%ebp
+f01042eb:	57                   	push   %edi
+f01042ec:	56                   	push   %esi
+f01042ed:	53                   	push   %ebx
+f01042ee:	83 ec 3c             	sub    $0x3c,%esp
+f01042f1:	83 3d e8 56 2b f0 00 	cmpl   $0x0,0xf02b56e8
+f01042f8:	0f 84 f4 05 00 00    	je     f01048f2 <page_alloc_npages+0x60a>
+f01042fe:	83 7d 08 0a          	cmpl   $0xa,0x8(%ebp)
+f0104302:	0f 87 f6 05 00 00    	ja     f01048fe <page_alloc_npages+0x616>
+f0104308:	e8 5d d8 ff ff       	call   f0101b6a <tlb_shootdown>
+f010430d:	83 ec 0c             	sub    $0xc,%esp
+f0104310:	68 00 57 2b f0       	push   $0xf02b5700
+f0104315:	e8 11 70 00 00       	call   f010b32b <spin_lock>
+f010431a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010431d:	e8 af d4 ff ff       	call   f01017d1 <buddy_alloc_block>
+f0104322:	89 c7                	mov    %eax,%edi
+f0104324:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0104327:	c7 04 24 00 57 2b f0 	movl   $0xf02b5700,(%esp)
+f010432e:	e8 cc 70 00 00       	call   f010b3ff <spin_unlock>
+f0104333:	83 c4 10             	add    $0x10,%esp
+f0104336:	85 ff                	test   %edi,%edi
+f0104338:	74 34                	je     f010436e <page_alloc_npages+0x86>
+f010433a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010433d:	89 f8                	mov    %edi,%eax
+f010433f:	ba 0c 00 00 00       	mov    $0xc,%edx
+f0104344:	0f b6 4d 08          	movzbl 0x8(%ebp),%ecx
+f0104348:	d3 e2                	shl    %cl,%edx
+f010434a:	01 fa                	add    %edi,%edx
+f010434c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0104352:	83 c0 0c             	add    $0xc,%eax
+f0104355:	39 c2                	cmp    %eax,%edx
+f0104357:	75 f3                	jne    f010434c <page_alloc_npages+0x64>
+f0104359:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+f010435d:	0f 85 34 05 00 00    	jne    f0104897 <page_alloc_npages+0x5af>
+f0104363:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0104366:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104369:	5b                   	pop    %ebx
+f010436a:	5e                   	pop    %esi
+f010436b:	5f                   	pop    %edi
+f010436c:	5d                   	pop    %ebp
+f010436d:	c3                   	ret
+f010436e:	83 ec 0c             	sub    $0xc,%esp
+f0104371:	6a ff                	push   $0xffffffff
+f0104373:	e8 e1 11 00 00       	call   f0105559 <env_reclaim>
+f0104378:	89 c3                	mov    %eax,%ebx
+f010437a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010437f:	e8 08 d0 ff ff       	call   f010138c <page_cache_drain_all>
+f0104384:	89 de                	mov    %ebx,%esi
+f0104386:	09 c6                	or     %eax,%esi
+f0104388:	c7 04 24 00 57 2b f0 	movl   $0xf02b5700,(%esp)
+f010438f:	e8 97 6f 00 00       	call   f010b32b <spin_lock>
+f0104394:	8b 3d 34 57 2b f0    	mov    0xf02b5734,%edi
+f010439a:	8b 1d 38 57 2b f0    	mov    0xf02b5738,%ebx
+f01043a0:	83 c4 10             	add    $0x10,%esp
+f01043a3:	85 db                	test   %ebx,%ebx
+f01043a5:	74 18                	je     f01043bf <page_alloc_npages+0xd7>
+f01043a7:	89 d8                	mov    %ebx,%eax
+f01043a9:	8b 1b                	mov    (%ebx),%ebx
+f01043ab:	89 1d 38 57 2b f0    	mov    %ebx,0xf02b5738
+f01043b1:	ba 00 00 00 00       	mov    $0x0,%edx
+f01043b6:	e8 27 ce ff ff       	call   f01011e2 <buddy_free_block>
+f01043bb:	85 db                	test   %ebx,%ebx
+f01043bd:	75 e8                	jne    f01043a7 <page_alloc_npages+0xbf>
+f01043bf:	c7 05 34 57 2b f0 00 	movl   $0x0,0xf02b5734
+f01043c6:	00 00 00 
+f01043c9:	83 ec 0c             	sub    $0xc,%esp
+f01043cc:	68 00 57 2b f0       	push   $0xf02b5700
+f01043d1:	e8 29 70 00 00       	call   f010b3ff <spin_unlock>
+f01043d6:	83 c4 10             	add    $0x10,%esp
+f01043d9:	09 f7                	or     %esi,%edi
+f01043db:	75 37                	jne    f0104414 <page_alloc_npages+0x12c>
+f01043dd:	f6 45 0c 02          	testb  $0x2,0xc(%ebp)
+f01043e1:	74 80                	je     f0104363 <page_alloc_npages+0x7b>
+f01043e3:	b8 01 00 00 00       	mov    $0x1,%eax
+f01043e8:	0f b6 4d 08          	movzbl 0x8(%ebp),%ecx
+f01043ec:	d3 e0                	shl    %cl,%eax
+f01043ee:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01043f1:	83 ec 04             	sub    $0x4,%esp
+f01043f4:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f01043f9:	01 c0                	add    %eax,%eax
+f01043fb:	50                   	push   %eax
+f01043fc:	6a 00                	push   $0x0
+f01043fe:	ff 35 6c 57 2b f0    	push   0xf02b576c
+f0104404:	e8 eb 64 00 00       	call   f010a8f4 <memset>
+f0104409:	8b 1d 78 57 2b f0    	mov    0xf02b5778,%ebx
+f010440f:	83 c4 10             	add    $0x10,%esp
+f0104412:	eb 56                	jmp    f010446a <page_alloc_npages+0x182>
+f0104414:	83 ec 0c             	sub    $0xc,%esp
+f0104417:	68 00 57 2b f0       	push   $0xf02b5700
+f010441c:	e8 0a 6f 00 00       	call   f010b32b <spin_lock>
+f0104421:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104424:	e8 a8 d3 ff ff       	call   f01017d1 <buddy_alloc_block>
+f0104429:	89 c3                	mov    %eax,%ebx
+f010442b:	c7 04 24 00 57 2b f0 	movl   $0xf02b5700,(%esp)
+f0104432:	e8 c8 6f 00 00       	call   f010b3ff <spin_unlock>
+f0104437:	83 c4 10             	add    $0x10,%esp
+f010443a:	85 db                	test   %ebx,%ebx
+f010443c:	74 9f                	je     f01043dd <page_alloc_npages+0xf5>
+f010443e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f0104441:	e9 f4 fe ff ff       	jmp    f010433a <page_alloc_npages+0x52>
+f0104446:	8b 73 5c             	mov    0x5c(%ebx),%esi
+f0104449:	e8 03 6b 00 00       	call   f010af51 <cpunum>
+f010444e:	39 c6                	cmp    %eax,%esi
+f0104450:	74 24                	je     f0104476 <page_alloc_npages+0x18e>
+f0104452:	81 c3 ac 01 00 00    	add    $0x1ac,%ebx
+f0104458:	a1 78 57 2b f0       	mov    0xf02b5778,%eax
+f010445d:	05 00 b0 06 00       	add    $0x6b000,%eax
+f0104462:	39 c3                	cmp    %eax,%ebx
+f0104464:	0f 83 85 00 00 00    	jae    f01044ef <page_alloc_npages+0x207>
+f010446a:	83 7b 78 00          	cmpl   $0x0,0x78(%ebx)
+f010446e:	74 e2                	je     f0104452 <page_alloc_npages+0x16a>
+f0104470:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f0104474:	74 d0                	je     f0104446 <page_alloc_npages+0x15e>
+f0104476:	8b 35 6c 57 2b f0    	mov    0xf02b576c,%esi
+f010447c:	bf 00 00 00 00       	mov    $0x0,%edi
+f0104481:	eb 38                	jmp    f01044bb <page_alloc_npages+0x1d3>
+f0104483:	51                   	push   %ecx
+f0104484:	68 24 d0 10 f0       	push   $0xf010d024
+f0104489:	68 82 03 00 00       	push   $0x382
+f010448e:	68 22 e2 10 f0       	push   $0xf010e222
+f0104493:	e8 a8 bb ff ff       	call   f0100040 <_panic>
+f0104498:	83 c0 04             	add    $0x4,%eax
+f010449b:	39 c1                	cmp    %eax,%ecx
+f010449d:	74 11                	je     f01044b0 <page_alloc_npages+0x1c8>
+f010449f:	8b 10                	mov    (%eax),%edx
+f01044a1:	f6 c2 01             	test   $0x1,%dl
+f01044a4:	74 f2                	je     f0104498 <page_alloc_npages+0x1b0>
+f01044a6:	c1 ea 0c             	shr    $0xc,%edx
+f01044a9:	66 83 04 56 01       	addw   $0x1,(%esi,%edx,2)
+f01044ae:	eb e8                	jmp    f0104498 <page_alloc_npages+0x1b0>
+f01044b0:	83 c7 04             	add    $0x4,%edi
+f01044b3:	81 ff e8 0e 00 00    	cmp    $0xee8,%edi
+f01044b9:	74 97                	je     f0104452 <page_alloc_npages+0x16a>
+f01044bb:	8b 43 78             	mov    0x78(%ebx),%eax
+f01044be:	8b 04 38             	mov    (%eax,%edi,1),%eax
+f01044c1:	89 c2                	mov    %eax,%edx
+f01044c3:	81 e2 81 00 00 00    	and    $0x81,%edx
+f01044c9:	83 fa 01             	cmp    $0x1,%edx
+f01044cc:	75 e2                	jne    f01044b0 <page_alloc_npages+0x1c8>
+f01044ce:	89 c1                	mov    %eax,%ecx
+f01044d0:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f01044d6:	c1 e8 0c             	shr    $0xc,%eax
+f01044d9:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f01044df:	73 a2                	jae    f0104483 <page_alloc_npages+0x19b>
+f01044e1:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+f01044e7:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f01044ed:	eb b0                	jmp    f010449f <page_alloc_npages+0x1b7>
+f01044ef:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01044f2:	f7 d8                	neg    %eax
+f01044f4:	23 05 68 1a 2d f0    	and    0xf02d1a68,%eax
+f01044fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01044fd:	8b 1d 70 1a 2d f0    	mov    0xf02d1a70,%ebx
+f0104503:	8b 3d 6c 57 2b f0    	mov    0xf02b576c,%edi
+f0104509:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f010450c:	bf 01 00 00 00       	mov    $0x1,%edi
+f0104511:	89 c6                	mov    %eax,%esi
+f0104513:	eb 5d                	jmp    f0104572 <page_alloc_npages+0x28a>
+f0104515:	83 c2 01             	add    $0x1,%edx
+f0104518:	39 d6                	cmp    %edx,%esi
+f010451a:	74 40                	je     f010455c <page_alloc_npages+0x274>
+f010451c:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0104521:	89 f8                	mov    %edi,%eax
+f0104523:	d3 e0                	shl    %cl,%eax
+f0104525:	f7 d8                	neg    %eax
+f0104527:	21 d0                	and    %edx,%eax
+f0104529:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010452c:	0f bf 44 83 06       	movswl 0x6(%ebx,%eax,4),%eax
+f0104531:	39 c8                	cmp    %ecx,%eax
+f0104533:	74 e0                	je     f0104515 <page_alloc_npages+0x22d>
+f0104535:	83 c1 01             	add    $0x1,%ecx
+f0104538:	83 f9 0b             	cmp    $0xb,%ecx
+f010453b:	75 e4                	jne    f0104521 <page_alloc_npages+0x239>
+f010453d:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0104540:	0f b7 44 83 04       	movzwl 0x4(%ebx,%eax,4),%eax
+f0104545:	66 85 c0             	test   %ax,%ax
+f0104548:	0f 84 01 04 00 00    	je     f010494f <page_alloc_npages+0x667>
+f010454e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0104551:	66 3b 04 51          	cmp    (%ecx,%edx,2),%ax
+f0104555:	74 be                	je     f0104515 <page_alloc_npages+0x22d>
+f0104557:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010455a:	eb 05                	jmp    f0104561 <page_alloc_npages+0x279>
+f010455c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010455f:	89 f2                	mov    %esi,%edx
+f0104561:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0104564:	29 ce                	sub    %ecx,%esi
+f0104566:	39 55 d0             	cmp    %edx,-0x30(%ebp)
+f0104569:	0f 84 9b 03 00 00    	je     f010490a <page_alloc_npages+0x622>
+f010456f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0104572:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0104575:	39 4d d0             	cmp    %ecx,-0x30(%ebp)
+f0104578:	0f 82 e5 fd ff ff    	jb     f0104363 <page_alloc_npages+0x7b>
+f010457e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0104581:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0104584:	29 c8                	sub    %ecx,%eax
+f0104586:	89 c2                	mov    %eax,%edx
+f0104588:	39 f0                	cmp    %esi,%eax
+f010458a:	73 d5                	jae    f0104561 <page_alloc_npages+0x279>
+f010458c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010458f:	eb 8b                	jmp    f010451c <page_alloc_npages+0x234>
+f0104591:	83 c3 01             	add    $0x1,%ebx
+f0104594:	39 5d d0             	cmp    %ebx,-0x30(%ebp)
+f0104597:	0f 84 96 03 00 00    	je     f0104933 <page_alloc_npages+0x64b>
+f010459d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01045a0:	8b 15 70 1a 2d f0    	mov    0xf02d1a70,%edx
+f01045a6:	8d 04 82             	lea    (%edx,%eax,4),%eax
+f01045a9:	66 83 78 06 00       	cmpw   $0x0,0x6(%eax)
+f01045ae:	78 e1                	js     f0104591 <page_alloc_npages+0x2a9>
+f01045b0:	e8 0f cc ff ff       	call   f01011c4 <buddy_unlink>
+f01045b5:	eb da                	jmp    f0104591 <page_alloc_npages+0x2a9>
+f01045b7:	83 c3 01             	add    $0x1,%ebx
+f01045ba:	83 45 d8 0c          	addl   $0xc,-0x28(%ebp)
+f01045be:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+f01045c1:	0f 84 90 00 00 00    	je     f0104657 <page_alloc_npages+0x36f>
+f01045c7:	c7 04 9d c0 45 2b f0 	movl   $0x0,-0xfd4ba40(,%ebx,4)
+f01045ce:	00 00 00 00 
+f01045d2:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f01045d7:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01045da:	66 83 7c 08 04 00    	cmpw   $0x0,0x4(%eax,%ecx,1)
+f01045e0:	74 d5                	je     f01045b7 <page_alloc_npages+0x2cf>
+f01045e2:	b8 00 00 00 00       	mov    $0x0,%eax
+f01045e7:	e8 e5 d1 ff ff       	call   f01017d1 <buddy_alloc_block>
+f01045ec:	89 04 9d c0 45 2b f0 	mov    %eax,-0xfd4ba40(,%ebx,4)
+f01045f3:	85 c0                	test   %eax,%eax
+f01045f5:	75 c0                	jne    f01045b7 <page_alloc_npages+0x2cf>
+f01045f7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01045fa:	39 c3                	cmp    %eax,%ebx
+f01045fc:	73 59                	jae    f0104657 <page_alloc_npages+0x36f>
+f01045fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104603:	eb 1a                	jmp    f010461f <page_alloc_npages+0x337>
+f0104605:	89 f0                	mov    %esi,%eax
+f0104607:	03 05 70 1a 2d f0    	add    0xf02d1a70,%eax
+f010460d:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f0104612:	74 22                	je     f0104636 <page_alloc_npages+0x34e>
+f0104614:	83 c3 01             	add    $0x1,%ebx
+f0104617:	83 c6 0c             	add    $0xc,%esi
+f010461a:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+f010461d:	74 23                	je     f0104642 <page_alloc_npages+0x35a>
+f010461f:	8b 04 9d c0 45 2b f0 	mov    -0xfd4ba40(,%ebx,4),%eax
+f0104626:	85 c0                	test   %eax,%eax
+f0104628:	74 db                	je     f0104605 <page_alloc_npages+0x31d>
+f010462a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010462f:	e8 ae cb ff ff       	call   f01011e2 <buddy_free_block>
+f0104634:	eb cf                	jmp    f0104605 <page_alloc_npages+0x31d>
+f0104636:	ba 00 00 00 00       	mov    $0x0,%edx
+f010463b:	e8 a2 cb ff ff       	call   f01011e2 <buddy_free_block>
+f0104640:	eb d2                	jmp    f0104614 <page_alloc_npages+0x32c>
+f0104642:	83 ec 0c             	sub    $0xc,%esp
+f0104645:	68 00 57 2b f0       	push   $0xf02b5700
+f010464a:	e8 b0 6d 00 00       	call   f010b3ff <spin_unlock>
+f010464f:	83 c4 10             	add    $0x10,%esp
+f0104652:	e9 0c fd ff ff       	jmp    f0104363 <page_alloc_npages+0x7b>
+f0104657:	83 ec 0c             	sub    $0xc,%esp
+f010465a:	68 00 57 2b f0       	push   $0xf02b5700
+f010465f:	e8 9b 6d 00 00       	call   f010b3ff <spin_unlock>
+f0104664:	83 c4 10             	add    $0x10,%esp
+f0104667:	89 fe                	mov    %edi,%esi
+f0104669:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+f0104670:	eb 3d                	jmp    f01046af <page_alloc_npages+0x3c7>
+f0104672:	ff 75 e4             	push   -0x1c(%ebp)
+f0104675:	68 24 d0 10 f0       	push   $0xf010d024
+f010467a:	6a 61                	push   $0x61
+f010467c:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0104681:	e8 ba b9 ff ff       	call   f0100040 <_panic>
+f0104686:	83 ec 04             	sub    $0x4,%esp
+f0104689:	68 00 10 00 00       	push   $0x1000
+f010468e:	52                   	push   %edx
+f010468f:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f0104695:	53                   	push   %ebx
+f0104696:	e8 8e 62 00 00       	call   f010a929 <memmove>
+f010469b:	83 c4 10             	add    $0x10,%esp
+f010469e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01046a1:	83 c0 01             	add    $0x1,%eax
+f01046a4:	83 c6 0c             	add    $0xc,%esi
+f01046a7:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+f01046aa:	74 72                	je     f010471e <page_alloc_npages+0x436>
+f01046ac:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01046af:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01046b2:	8b 04 85 c0 45 2b f0 	mov    -0xfd4ba40(,%eax,4),%eax
+f01046b9:	85 c0                	test   %eax,%eax
+f01046bb:	74 e1                	je     f010469e <page_alloc_npages+0x3b6>
+f01046bd:	8b 1d 70 1a 2d f0    	mov    0xf02d1a70,%ebx
+f01046c3:	89 f2                	mov    %esi,%edx
+f01046c5:	c1 fa 02             	sar    $0x2,%edx
+f01046c8:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+f01046ce:	89 d1                	mov    %edx,%ecx
+f01046d0:	c1 e1 0c             	shl    $0xc,%ecx
+f01046d3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f01046d6:	8b 0d 68 1a 2d f0    	mov    0xf02d1a68,%ecx
+f01046dc:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f01046e2:	39 ca                	cmp    %ecx,%edx
+f01046e4:	73 8c                	jae    f0104672 <page_alloc_npages+0x38a>
+f01046e6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01046e9:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01046ef:	29 d8                	sub    %ebx,%eax
+f01046f1:	c1 f8 02             	sar    $0x2,%eax
+f01046f4:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01046fa:	89 c3                	mov    %eax,%ebx
+f01046fc:	c1 e3 0c             	shl    $0xc,%ebx
+f01046ff:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0104704:	39 c8                	cmp    %ecx,%eax
+f0104706:	0f 82 7a ff ff ff    	jb     f0104686 <page_alloc_npages+0x39e>
+f010470c:	53                   	push   %ebx
+f010470d:	68 24 d0 10 f0       	push   $0xf010d024
+f0104712:	6a 61                	push   $0x61
+f0104714:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0104719:	e8 22 b9 ff ff       	call   f0100040 <_panic>
+f010471e:	8b 35 78 57 2b f0    	mov    0xf02b5778,%esi
+f0104724:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f0104727:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f010472a:	29 f0                	sub    %esi,%eax
+f010472c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010472f:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f0104732:	eb 28                	jmp    f010475c <page_alloc_npages+0x474>
+f0104734:	8b 58 5c             	mov    0x5c(%eax),%ebx
+f0104737:	e8 15 68 00 00       	call   f010af51 <cpunum>
+f010473c:	39 c3                	cmp    %eax,%ebx
+f010473e:	74 2b                	je     f010476b <page_alloc_npages+0x483>
+f0104740:	81 45 dc ac 01 00 00 	addl   $0x1ac,-0x24(%ebp)
+f0104747:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f010474a:	a1 78 57 2b f0       	mov    0xf02b5778,%eax
+f010474f:	05 00 b0 06 00       	add    $0x6b000,%eax
+f0104754:	39 c7                	cmp    %eax,%edi
+f0104756:	0f 83 fc 00 00 00    	jae    f0104858 <page_alloc_npages+0x570>
+f010475c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010475f:	83 78 78 00          	cmpl   $0x0,0x78(%eax)
+f0104763:	74 db                	je     f0104740 <page_alloc_npages+0x458>
+f0104765:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104769:	74 c9                	je     f0104734 <page_alloc_npages+0x44c>
+f010476b:	bf 00 00 00 00       	mov    $0x0,%edi
+f0104770:	e9 98 00 00 00       	jmp    f010480d <page_alloc_npages+0x525>
+f0104775:	53                   	push   %ebx
+f0104776:	68 24 d0 10 f0       	push   $0xf010d024
+f010477b:	68 bd 03 00 00       	push   $0x3bd
+f0104780:	68 22 e2 10 f0       	push   $0xf010e222
+f0104785:	e8 b6 b8 ff ff       	call   f0100040 <_panic>
+f010478a:	83 c3 04             	add    $0x4,%ebx
+f010478d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0104793:	81 fe 00 00 40 00    	cmp    $0x400000,%esi
+f0104799:	74 60                	je     f01047fb <page_alloc_npages+0x513>
+f010479b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f010479e:	8b 03                	mov    (%ebx),%eax
+f01047a0:	a8 01                	test   $0x1,%al
+f01047a2:	74 e6                	je     f010478a <page_alloc_npages+0x4a2>
+f01047a4:	89 c2                	mov    %eax,%edx
+f01047a6:	c1 ea 0c             	shr    $0xc,%edx
+f01047a9:	39 fa                	cmp    %edi,%edx
+f01047ab:	73 dd                	jae    f010478a <page_alloc_npages+0x4a2>
+f01047ad:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01047b0:	39 ca                	cmp    %ecx,%edx
+f01047b2:	72 d6                	jb     f010478a <page_alloc_npages+0x4a2>
+f01047b4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f01047b7:	01 ca                	add    %ecx,%edx
+f01047b9:	8b 0c 95 c0 45 2b f0 	mov    -0xfd4ba40(,%edx,4),%ecx
+f01047c0:	89 ca                	mov    %ecx,%edx
+f01047c2:	2b 15 70 1a 2d f0    	sub    0xf02d1a70,%edx
+f01047c8:	c1 fa 02             	sar    $0x2,%edx
+f01047cb:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+f01047d1:	c1 e2 0c             	shl    $0xc,%edx
+f01047d4:	25 ff 0f 00 00       	and    $0xfff,%eax
+f01047d9:	09 c2                	or     %eax,%edx
+f01047db:	89 13                	mov    %edx,(%ebx)
+f01047dd:	66 83 41 04 01       	addw   $0x1,0x4(%ecx)
+f01047e2:	83 ec 08             	sub    $0x8,%esp
+f01047e5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01047e8:	09 f0                	or     %esi,%eax
+f01047ea:	50                   	push   %eax
+f01047eb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01047ee:	ff 70 78             	push   0x78(%eax)
+f01047f1:	e8 93 d5 ff ff       	call   f0101d89 <tlb_invalidate>
+f01047f6:	83 c4 10             	add    $0x10,%esp
+f01047f9:	eb 8f                	jmp    f010478a <page_alloc_npages+0x4a2>
+f01047fb:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f01047fe:	83 c7 04             	add    $0x4,%edi
+f0104801:	81 ff e8 0e 00 00    	cmp    $0xee8,%edi
+f0104807:	0f 84 33 ff ff ff    	je     f0104740 <page_alloc_npages+0x458>
+f010480d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0104810:	8b 40 78             	mov    0x78(%eax),%eax
+f0104813:	8b 04 38             	mov    (%eax,%edi,1),%eax
+f0104816:	89 c2                	mov    %eax,%edx
+f0104818:	81 e2 81 00 00 00    	and    $0x81,%edx
+f010481e:	83 fa 01             	cmp    $0x1,%edx
+f0104821:	75 db                	jne    f01047fe <page_alloc_npages+0x516>
+f0104823:	89 c3                	mov    %eax,%ebx
+f0104825:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f010482b:	c1 e8 0c             	shr    $0xc,%eax
+f010482e:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0104834:	0f 83 3b ff ff ff    	jae    f0104775 <page_alloc_npages+0x48d>
+f010483a:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f0104840:	89 f8                	mov    %edi,%eax
+f0104842:	c1 e0 14             	shl    $0x14,%eax
+f0104845:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0104848:	be 00 00 00 00       	mov    $0x0,%esi
+f010484d:	89 7d cc             	mov    %edi,-0x34(%ebp)
+f0104850:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0104853:	e9 43 ff ff ff       	jmp    f010479b <page_alloc_npages+0x4b3>
+f0104858:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f010485b:	89 fa                	mov    %edi,%edx
+f010485d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104862:	89 d1                	mov    %edx,%ecx
+f0104864:	03 0d 70 1a 2d f0    	add    0xf02d1a70,%ecx
+f010486a:	66 c7 41 04 00 00    	movw   $0x0,0x4(%ecx)
+f0104870:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+f0104876:	89 c1                	mov    %eax,%ecx
+f0104878:	83 c0 01             	add    $0x1,%eax
+f010487b:	83 c2 0c             	add    $0xc,%edx
+f010487e:	39 4d c8             	cmp    %ecx,-0x38(%ebp)
+f0104881:	75 df                	jne    f0104862 <page_alloc_npages+0x57a>
+f0104883:	03 3d 70 1a 2d f0    	add    0xf02d1a70,%edi
+f0104889:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010488c:	0f 84 d1 fa ff ff    	je     f0104363 <page_alloc_npages+0x7b>
+f0104892:	e9 a3 fa ff ff       	jmp    f010433a <page_alloc_npages+0x52>
+f0104897:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010489c:	0f b6 4d 08          	movzbl 0x8(%ebp),%ecx
+f01048a0:	d3 e2                	shl    %cl,%edx
+f01048a2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01048a5:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f01048ab:	c1 f8 02             	sar    $0x2,%eax
+f01048ae:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01048b4:	89 c1                	mov    %eax,%ecx
+f01048b6:	c1 e1 0c             	shl    $0xc,%ecx
+f01048b9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01048be:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f01048c4:	73 1a                	jae    f01048e0 <page_alloc_npages+0x5f8>
+f01048c6:	83 ec 04             	sub    $0x4,%esp
+f01048c9:	52                   	push   %edx
+f01048ca:	6a 00                	push   $0x0
+f01048cc:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f01048d2:	51                   	push   %ecx
+f01048d3:	e8 1c 60 00 00       	call   f010a8f4 <memset>
+f01048d8:	83 c4 10             	add    $0x10,%esp
+f01048db:	e9 83 fa ff ff       	jmp    f0104363 <page_alloc_npages+0x7b>
+f01048e0:	51                   	push   %ecx
+f01048e1:	68 24 d0 10 f0       	push   $0xf010d024
+f01048e6:	6a 61                	push   $0x61
+f01048e8:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01048ed:	e8 4e b7 ff ff       	call   f0100040 <_panic>
+f01048f2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f01048f9:	e9 65 fa ff ff       	jmp    f0104363 <page_alloc_npages+0x7b>
+f01048fe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0104905:	e9 59 fa ff ff       	jmp    f0104363 <page_alloc_npages+0x7b>
+f010490a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f010490d:	89 f8                	mov    %edi,%eax
+f010490f:	8b 75 dc             	mov    -0x24(%ebp),%esi
+f0104912:	29 f0                	sub    %esi,%eax
+f0104914:	89 c6                	mov    %eax,%esi
+f0104916:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104919:	83 ec 0c             	sub    $0xc,%esp
+f010491c:	68 00 57 2b f0       	push   $0xf02b5700
+f0104921:	e8 05 6a 00 00       	call   f010b32b <spin_lock>
+f0104926:	83 c4 10             	add    $0x10,%esp
+f0104929:	89 f3                	mov    %esi,%ebx
+f010492b:	39 fe                	cmp    %edi,%esi
+f010492d:	0f 82 6a fc ff ff    	jb     f010459d <page_alloc_npages+0x2b5>
+f0104933:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104936:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0104939:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+f0104940:	89 fe                	mov    %edi,%esi
+f0104942:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0104945:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010494a:	e9 78 fc ff ff       	jmp    f01045c7 <page_alloc_npages+0x2df>
+f010494f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0104952:	e9 0a fc ff ff       	jmp    f0104561 <page_alloc_npages+0x279>
+
+f0104957 <tlb_shootdown_handler>:
+f0104957:	55                   	push   %ebp
+f0104958:	89 e5                	mov    %esp,%ebp
+f010495a:	53                   	push   %ebx
+f010495b:	83 ec 04             	sub    $0x4,%esp
+f010495e:	e8 ee 65 00 00       	call   f010af51 <cpunum>
+f0104963:	89 c2                	mov    %eax,%edx
+f0104965:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010496b:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0104970:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+f0104976:	85 c0                	test   %eax,%eax
+f0104978:	74 52                	je     f01049cc <tlb_shootdown_handler+0x75>
+f010497a:	83 3d e0 55 2b f0 00 	cmpl   $0x0,0xf02b55e0
+f0104981:	7e 39                	jle    f01049bc <tlb_shootdown_handler+0x65>
+f0104983:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104988:	69 ca 94 00 00 00    	imul   $0x94,%edx,%ecx
+f010498e:	81 c1 20 20 2d f0    	add    $0xf02d2020,%ecx
+f0104994:	eb 0b                	jmp    f01049a1 <tlb_shootdown_handler+0x4a>
+f0104996:	83 c0 01             	add    $0x1,%eax
+f0104999:	39 05 e0 55 2b f0    	cmp    %eax,0xf02b55e0
+f010499f:	7e 1b                	jle    f01049bc <tlb_shootdown_handler+0x65>
+f01049a1:	8b 99 80 00 00 00    	mov    0x80(%ecx),%ebx
+f01049a7:	39 1c 85 e4 55 2b f0 	cmp    %ebx,-0xfd4aa1c(,%eax,4)
+f01049ae:	75 e6                	jne    f0104996 <tlb_shootdown_handler+0x3f>
+f01049b0:	8b 1c 85 64 56 2b f0 	mov    -0xfd4a99c(,%eax,4),%ebx
+f01049b7:	0f 01 3b             	invlpg (%ebx)
+f01049ba:	eb da                	jmp    f0104996 <tlb_shootdown_handler+0x3f>
+f01049bc:	69 d2 94 00 00 00    	imul   $0x94,%edx,%edx
+f01049c2:	c7 82 a8 20 2d f0 00 	movl   $0x0,-0xfd2df58(%edx)
+f01049c9:	00 00 00 
+f01049cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01049cf:	c9                   	leave
+f01049d0:	c3                   	ret
+
+f01049d1 <tlb_shootdown_sync>:
+f01049d1:	55                   	push   %ebp
+f01049d2:	89 e5                	mov    %esp,%ebp
+f01049d4:	83 ec 08             	sub    $0x8,%esp
+f01049d7:	e8 75 65 00 00       	call   f010af51 <cpunum>
+f01049dc:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01049e2:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f01049e7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+f01049ed:	85 c0                	test   %eax,%eax
+f01049ef:	75 02                	jne    f01049f3 <tlb_shootdown_sync+0x22>
+f01049f1:	c9                   	leave
+f01049f2:	c3                   	ret
+f01049f3:	0f 20 d8             	mov    %cr3,%eax
+f01049f6:	0f 22 d8             	mov    %eax,%cr3
+f01049f9:	e8 53 65 00 00       	call   f010af51 <cpunum>
+f01049fe:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0104a04:	c7 80 a8 20 2d f0 00 	movl   $0x0,-0xfd2df58(%eax)
+f0104a0b:	00 00 00 
+f0104a0e:	eb e1                	jmp    f01049f1 <tlb_shootdown_sync+0x20>
+
+f0104a10 <page_zero_idle>:
+f0104a10:	55                   	push   %ebp
+f0104a11:	89 e5                	mov    %esp,%ebp
+f0104a13:	57                   	push   %edi
+f0104a14:	56                   	push   %esi
+f0104a15:	53                   	push   %ebx
+f0104a16:	83 ec 1c             	sub    $0x1c,%esp
+f0104a19:	8b 35 e8 56 2b f0    	mov    0xf02b56e8,%esi
+f0104a1f:	85 f6                	test   %esi,%esi
+f0104a21:	75 0a                	jne    f0104a2d <page_zero_idle+0x1d>
+f0104a23:	89 f0                	mov    %esi,%eax
+f0104a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104a28:	5b                   	pop    %ebx
+f0104a29:	5e                   	pop    %esi
+f0104a2a:	5f                   	pop    %edi
+f0104a2b:	5d                   	pop    %ebp
+f0104a2c:	c3                   	ret
+f0104a2d:	e8 38 d1 ff ff       	call   f0101b6a <tlb_shootdown>
+f0104a32:	83 ec 0c             	sub    $0xc,%esp
+f0104a35:	68 00 57 2b f0       	push   $0xf02b5700
+f0104a3a:	e8 ec 68 00 00       	call   f010b32b <spin_lock>
+f0104a3f:	a1 34 57 2b f0       	mov    0xf02b5734,%eax
+f0104a44:	83 c4 10             	add    $0x10,%esp
+f0104a47:	3d ff 00 00 00       	cmp    $0xff,%eax
+f0104a4c:	0f 8f 94 00 00 00    	jg     f0104ae6 <page_zero_idle+0xd6>
+f0104a52:	ba 00 01 00 00       	mov    $0x100,%edx
+f0104a57:	29 c2                	sub    %eax,%edx
+f0104a59:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0104a5c:	be 00 00 00 00       	mov    $0x0,%esi
+f0104a61:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104a66:	89 df                	mov    %ebx,%edi
+f0104a68:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104a6d:	e8 5f cd ff ff       	call   f01017d1 <buddy_alloc_block>
+f0104a72:	89 c3                	mov    %eax,%ebx
+f0104a74:	85 c0                	test   %eax,%eax
+f0104a76:	74 14                	je     f0104a8c <page_zero_idle+0x7c>
+f0104a78:	89 3b                	mov    %edi,(%ebx)
+f0104a7a:	83 c6 01             	add    $0x1,%esi
+f0104a7d:	83 fe 08             	cmp    $0x8,%esi
+f0104a80:	74 7e                	je     f0104b00 <page_zero_idle+0xf0>
+f0104a82:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+f0104a85:	75 df                	jne    f0104a66 <page_zero_idle+0x56>
+f0104a87:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0104a8a:	89 df                	mov    %ebx,%edi
+f0104a8c:	83 ec 0c             	sub    $0xc,%esp
+f0104a8f:	68 00 57 2b f0       	push   $0xf02b5700
+f0104a94:	e8 66 69 00 00       	call   f010b3ff <spin_unlock>
+f0104a99:	83 c4 10             	add    $0x10,%esp
+f0104a9c:	85 f6                	test   %esi,%esi
+f0104a9e:	74 83                	je     f0104a23 <page_zero_idle+0x13>
+f0104aa0:	89 fb                	mov    %edi,%ebx
+f0104aa2:	eb 6c                	jmp    f0104b10 <page_zero_idle+0x100>
+f0104aa4:	52                   	push   %edx
+f0104aa5:	68 24 d0 10 f0       	push   $0xf010d024
+f0104aaa:	6a 61                	push   $0x61
+f0104aac:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0104ab1:	e8 8a b5 ff ff       	call   f0100040 <_panic>
+f0104ab6:	89 cb                	mov    %ecx,%ebx
+f0104ab8:	8b 0b                	mov    (%ebx),%ecx
+f0104aba:	89 13                	mov    %edx,(%ebx)
+f0104abc:	83 c0 01             	add    $0x1,%eax
+f0104abf:	89 da                	mov    %ebx,%edx
+f0104ac1:	39 c6                	cmp    %eax,%esi
+f0104ac3:	75 f1                	jne    f0104ab6 <page_zero_idle+0xa6>
+f0104ac5:	89 1d 38 57 2b f0    	mov    %ebx,0xf02b5738
+f0104acb:	01 35 34 57 2b f0    	add    %esi,0xf02b5734
+f0104ad1:	83 ec 0c             	sub    $0xc,%esp
+f0104ad4:	68 00 57 2b f0       	push   $0xf02b5700
+f0104ad9:	e8 21 69 00 00       	call   f010b3ff <spin_unlock>
+f0104ade:	83 c4 10             	add    $0x10,%esp
+f0104ae1:	e9 3d ff ff ff       	jmp    f0104a23 <page_zero_idle+0x13>
+f0104ae6:	83 ec 0c             	sub    $0xc,%esp
+f0104ae9:	68 00 57 2b f0       	push   $0xf02b5700
+f0104aee:	e8 0c 69 00 00       	call   f010b3ff <spin_unlock>
+f0104af3:	83 c4 10             	add    $0x10,%esp
+f0104af6:	be 00 00 00 00       	mov    $0x0,%esi
+f0104afb:	e9 23 ff ff ff       	jmp    f0104a23 <page_zero_idle+0x13>
+f0104b00:	83 ec 0c             	sub    $0xc,%esp
+f0104b03:	68 00 57 2b f0       	push   $0xf02b5700
+f0104b08:	e8 f2 68 00 00       	call   f010b3ff <spin_unlock>
+f0104b0d:	83 c4 10             	add    $0x10,%esp
+f0104b10:	83 ec 0c             	sub    $0xc,%esp
+f0104b13:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f0104b18:	e8 e2 68 00 00       	call   f010b3ff <spin_unlock>
+f0104b1d:	f3 90                	pause
+f0104b1f:	83 c4 10             	add    $0x10,%esp
+f0104b22:	85 db                	test   %ebx,%ebx
+f0104b24:	74 48                	je     f0104b6e <page_zero_idle+0x15e>
+f0104b26:	89 df                	mov    %ebx,%edi
+f0104b28:	89 f8                	mov    %edi,%eax
+f0104b2a:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0104b30:	c1 f8 02             	sar    $0x2,%eax
+f0104b33:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104b39:	89 c2                	mov    %eax,%edx
+f0104b3b:	c1 e2 0c             	shl    $0xc,%edx
+f0104b3e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0104b43:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0104b49:	0f 83 55 ff ff ff    	jae    f0104aa4 <page_zero_idle+0x94>
+f0104b4f:	83 ec 04             	sub    $0x4,%esp
+f0104b52:	68 00 10 00 00       	push   $0x1000
+f0104b57:	6a 00                	push   $0x0
+f0104b59:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0104b5f:	52                   	push   %edx
+f0104b60:	e8 8f 5d 00 00       	call   f010a8f4 <memset>
+f0104b65:	8b 3f                	mov    (%edi),%edi
+f0104b67:	83 c4 10             	add    $0x10,%esp
+f0104b6a:	85 ff                	test   %edi,%edi
+f0104b6c:	75 ba                	jne    f0104b28 <page_zero_idle+0x118>
+f0104b6e:	83 ec 0c             	sub    $0xc,%esp
+f0104b71:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f0104b76:	e8 b0 67 00 00       	call   f010b32b <spin_lock>
+f0104b7b:	e8 51 fe ff ff       	call   f01049d1 <tlb_shootdown_sync>
+f0104b80:	c7 04 24 00 57 2b f0 	movl   $0xf02b5700,(%esp)
+f0104b87:	e8 9f 67 00 00       	call   f010b32b <spin_lock>
+f0104b8c:	83 c4 10             	add    $0x10,%esp
+f0104b8f:	85 f6                	test   %esi,%esi
+f0104b91:	0f 8e 34 ff ff ff    	jle    f0104acb <page_zero_idle+0xbb>
+f0104b97:	8b 15 38 57 2b f0    	mov    0xf02b5738,%edx
+f0104b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104ba2:	e9 11 ff ff ff       	jmp    f0104ab8 <page_zero_idle+0xa8>
+
+f0104ba7 <user_mem_check>:
+f0104ba7:	55                   	push   %ebp
+f0104ba8:	89 e5                	mov    %esp,%ebp
+f0104baa:	57                   	push   %edi
+f0104bab:	56                   	push   %esi
+f0104bac:	53                   	push   %ebx
+f0104bad:	83 ec 0c             	sub    $0xc,%esp
+f0104bb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0104bb3:	89 d3                	mov    %edx,%ebx
+f0104bb5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f0104bbb:	89 d7                	mov    %edx,%edi
+f0104bbd:	03 7d 10             	add    0x10(%ebp),%edi
+f0104bc0:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+f0104bc6:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+f0104bcc:	8b 75 14             	mov    0x14(%ebp),%esi
+f0104bcf:	83 ce 01             	or     $0x1,%esi
+f0104bd2:	39 fb                	cmp    %edi,%ebx
+f0104bd4:	72 25                	jb     f0104bfb <user_mem_check+0x54>
+f0104bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104bdb:	eb 55                	jmp    f0104c32 <user_mem_check+0x8b>
+f0104bdd:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f0104be3:	77 3a                	ja     f0104c1f <user_mem_check+0x78>
+f0104be5:	85 c0                	test   %eax,%eax
+f0104be7:	74 36                	je     f0104c1f <user_mem_check+0x78>
+f0104be9:	89 f1                	mov    %esi,%ecx
+f0104beb:	23 08                	and    (%eax),%ecx
+f0104bed:	39 ce                	cmp    %ecx,%esi
+f0104bef:	75 2e                	jne    f0104c1f <user_mem_check+0x78>
+f0104bf1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0104bf7:	39 fb                	cmp    %edi,%ebx
+f0104bf9:	73 3f                	jae    f0104c3a <user_mem_check+0x93>
+f0104bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104bfe:	8b 50 78             	mov    0x78(%eax),%edx
+f0104c01:	89 d8                	mov    %ebx,%eax
+f0104c03:	c1 e8 16             	shr    $0x16,%eax
+f0104c06:	8d 04 82             	lea    (%edx,%eax,4),%eax
+f0104c09:	f6 00 80             	testb  $0x80,(%eax)
+f0104c0c:	75 cf                	jne    f0104bdd <user_mem_check+0x36>
+f0104c0e:	83 ec 04             	sub    $0x4,%esp
+f0104c11:	6a 00                	push   $0x0
+f0104c13:	53                   	push   %ebx
+f0104c14:	52                   	push   %edx
+f0104c15:	e8 f2 d2 ff ff       	call   f0101f0c <pgdir_walk>
+f0104c1a:	83 c4 10             	add    $0x10,%esp
+f0104c1d:	eb be                	jmp    f0104bdd <user_mem_check+0x36>
+f0104c1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0104c22:	39 da                	cmp    %ebx,%edx
+f0104c24:	0f 42 d3             	cmovb  %ebx,%edx
+f0104c27:	89 15 c4 55 2b f0    	mov    %edx,0xf02b55c4
+f0104c2d:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+f0104c32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104c35:	5b                   	pop    %ebx
+f0104c36:	5e                   	pop    %esi
+f0104c37:	5f                   	pop    %edi
+f0104c38:	5d                   	pop    %ebp
+f0104c39:	c3                   	ret
+f0104c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104c3f:	eb f1                	jmp    f0104c32 <user_mem_check+0x8b>
+
+f0104c41 <user_mem_assert>:
+f0104c41:	55                   	push   %ebp
+f0104c42:	89 e5                	mov    %esp,%ebp
+f0104c44:	57                   	push   %edi
+f0104c45:	56                   	push   %esi
+f0104c46:	53                   	push   %ebx
+f0104c47:	83 ec 0c             	sub    $0xc,%esp
+f0104c4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104c4d:	8b 75 14             	mov    0x14(%ebp),%esi
+f0104c50:	89 f7                	mov    %esi,%edi
+f0104c52:	83 cf 04             	or     $0x4,%edi
+f0104c55:	83 e6 02             	and    $0x2,%esi
+f0104c58:	57                   	push   %edi
+f0104c59:	ff 75 10             	push   0x10(%ebp)
+f0104c5c:	ff 75 0c             	push   0xc(%ebp)
+f0104c5f:	53                   	push   %ebx
+f0104c60:	e8 42 ff ff ff       	call   f0104ba7 <user_mem_check>
+f0104c65:	83 c4 10             	add    $0x10,%esp
+f0104c68:	85 c0                	test   %eax,%eax
+f0104c6a:	79 59                	jns    f0104cc5 <user_mem_assert+0x84>
+f0104c6c:	85 f6                	test   %esi,%esi
+f0104c6e:	74 21                	je     f0104c91 <user_mem_assert+0x50>
+f0104c70:	83 bb 80 00 00 00 00 	cmpl   $0x0,0x80(%ebx)
+f0104c77:	74 18                	je     f0104c91 <user_mem_assert+0x50>
+f0104c79:	83 ec 08             	sub    $0x8,%esp
+f0104c7c:	ff 35 c4 55 2b f0    	push   0xf02b55c4
+f0104c82:	ff 73 78             	push   0x78(%ebx)
+f0104c85:	e8 f3 f4 ff ff       	call   f010417d <page_cow>
+f0104c8a:	83 c4 10             	add    $0x10,%esp
+f0104c8d:	85 c0                	test   %eax,%eax
+f0104c8f:	74 c7                	je     f0104c58 <user_mem_assert+0x17>
+f0104c91:	e8 bb 62 00 00       	call   f010af51 <cpunum>
+f0104c96:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0104c9c:	39 98 28 20 2d f0    	cmp    %ebx,-0xfd2dfd8(%eax)
+f0104ca2:	74 29                	je     f0104ccd <user_mem_assert+0x8c>
+f0104ca4:	83 ec 04             	sub    $0x4,%esp
+f0104ca7:	ff 35 c4 55 2b f0    	push   0xf02b55c4
+f0104cad:	ff 73 48             	push   0x48(%ebx)
+f0104cb0:	68 d8 e1 10 f0       	push   $0xf010e1d8
+f0104cb5:	e8 4d 10 00 00       	call   f0105d07 <cprintf>
+f0104cba:	89 1c 24             	mov    %ebx,(%esp)
+f0104cbd:	e8 15 0b 00 00       	call   f01057d7 <env_destroy>
+f0104cc2:	83 c4 10             	add    $0x10,%esp
+f0104cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104cc8:	5b                   	pop    %ebx
+f0104cc9:	5e                   	pop    %esi
+f0104cca:	5f                   	pop    %edi
+f0104ccb:	5d                   	pop    %ebp
+f0104ccc:	c3                   	ret
+f0104ccd:	83 7b 28 30          	cmpl   $0x30,0x28(%ebx)
+f0104cd1:	75 d1                	jne    f0104ca4 <user_mem_assert+0x63>
+f0104cd3:	8b 43 78             	mov    0x78(%ebx),%eax
+f0104cd6:	8b 15 c4 55 2b f0    	mov    0xf02b55c4,%edx
+f0104cdc:	89 d1                	mov    %edx,%ecx
+f0104cde:	c1 e9 16             	shr    $0x16,%ecx
+f0104ce1:	f6 04 88 80          	testb  $0x80,(%eax,%ecx,4)
+f0104ce5:	75 bd                	jne    f0104ca4 <user_mem_assert+0x63>
+f0104ce7:	83 ec 04             	sub    $0x4,%esp
+f0104cea:	6a 00                	push   $0x0
+f0104cec:	52                   	push   %edx
+f0104ced:	50                   	push   %eax
+f0104cee:	e8 19 d2 ff ff       	call   f0101f0c <pgdir_walk>
+f0104cf3:	83 c4 10             	add    $0x10,%esp
+f0104cf6:	85 c0                	test   %eax,%eax
+f0104cf8:	74 05                	je     f0104cff <user_mem_assert+0xbe>
+f0104cfa:	f6 00 01             	testb  $0x1,(%eax)
+f0104cfd:	75 a5                	jne    f0104ca4 <user_mem_assert+0x63>
+f0104cff:	83 6b 30 02          	subl   $0x2,0x30(%ebx)
+f0104d03:	83 ec 0c             	sub    $0xc,%esp
+f0104d06:	ff 35 c4 55 2b f0    	push   0xf02b55c4
+f0104d0c:	e8 bc 37 00 00       	call   f01084cd <ipc_page_fault>
+f0104d11:	83 c4 10             	add    $0x10,%esp
+f0104d14:	85 c0                	test   %eax,%eax
+f0104d16:	74 06                	je     f0104d1e <user_mem_assert+0xdd>
+f0104d18:	83 43 30 02          	addl   $0x2,0x30(%ebx)
+f0104d1c:	eb 86                	jmp    f0104ca4 <user_mem_assert+0x63>
+f0104d1e:	83 ec 0c             	sub    $0xc,%esp
+f0104d21:	53                   	push   %ebx
+f0104d22:	e8 32 0c 00 00       	call   f0105959 <env_run>
+
+f0104d27 <env_pgdir_build>:
+f0104d27:	55                   	push   %ebp
+f0104d28:	89 e5                	mov    %esp,%ebp
+f0104d2a:	56                   	push   %esi
+f0104d2b:	53                   	push   %ebx
+f0104d2c:	83 ec 0c             	sub    $0xc,%esp
+f0104d2f:	6a 01                	push   $0x1
+f0104d31:	e8 57 cf ff ff       	call   f0101c8d <page_alloc>
+f0104d36:	89 c3                	mov    %eax,%ebx
+f0104d38:	83 c4 10             	add    $0x10,%esp
+f0104d3b:	85 c0                	test   %eax,%eax
+f0104d3d:	74 58                	je     f0104d97 <env_pgdir_build+0x70>
+f0104d3f:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f0104d44:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f0104d4a:	c1 f8 02             	sar    $0x2,%eax
+f0104d4d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104d53:	89 c6                	mov    %eax,%esi
+f0104d55:	c1 e6 0c             	shl    $0xc,%esi
+f0104d58:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0104d5d:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0104d63:	73 3b                	jae    f0104da0 <env_pgdir_build+0x79>
+f0104d65:	8d 8e 00 00 00 f0    	lea    -0x10000000(%esi),%ecx
+f0104d6b:	b8 e8 0e 00 00       	mov    $0xee8,%eax
+f0104d70:	8b 15 6c 1a 2d f0    	mov    0xf02d1a6c,%edx
+f0104d76:	8b 14 02             	mov    (%edx,%eax,1),%edx
+f0104d79:	89 14 08             	mov    %edx,(%eax,%ecx,1)
+f0104d7c:	83 c0 04             	add    $0x4,%eax
+f0104d7f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0104d84:	75 ea                	jne    f0104d70 <env_pgdir_build+0x49>
+f0104d86:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f0104d8c:	76 24                	jbe    f0104db2 <env_pgdir_build+0x8b>
+f0104d8e:	83 ce 05             	or     $0x5,%esi
+f0104d91:	89 b1 f4 0e 00 00    	mov    %esi,0xef4(%ecx)
+f0104d97:	89 d8                	mov    %ebx,%eax
+f0104d99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104d9c:	5b                   	pop    %ebx
+f0104d9d:	5e                   	pop    %esi
+f0104d9e:	5d                   	pop    %ebp
+f0104d9f:	c3                   	ret
+f0104da0:	56                   	push   %esi
+f0104da1:	68 24 d0 10 f0       	push   $0xf010d024
+f0104da6:	6a 61                	push   $0x61
+f0104da8:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0104dad:	e8 8e b2 ff ff       	call   f0100040 <_panic>
+f0104db2:	51                   	push   %ecx
+f0104db3:	68 48 d0 10 f0       	push   $0xf010d048
+f0104db8:	68 05 01 00 00       	push   $0x105
+f0104dbd:	68 26 e6 10 f0       	push   $0xf010e626
+f0104dc2:	e8 79 b2 ff ff       	call   f0100040 <_panic>
+
+f0104dc7 <region_alloc>:
+f0104dc7:	55                   	push   %ebp
+f0104dc8:	89 e5                	mov    %esp,%ebp
+f0104dca:	57                   	push   %edi
+f0104dcb:	56                   	push   %esi
+f0104dcc:	53                   	push   %ebx
+f0104dcd:	83 ec 1c             	sub    $0x1c,%esp
+f0104dd0:	89 c7                	mov    %eax,%edi
+f0104dd2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0104dd5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0104dd8:	89 d3                	mov    %edx,%ebx
+f0104dda:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f0104de0:	8d b4 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%esi
+f0104de7:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0104ded:	39 f3                	cmp    %esi,%ebx
+f0104def:	73 2f                	jae    f0104e20 <region_alloc+0x59>
+f0104df1:	83 ec 0c             	sub    $0xc,%esp
+f0104df4:	6a 00                	push   $0x0
+f0104df6:	e8 92 ce ff ff       	call   f0101c8d <page_alloc>
+f0104dfb:	83 c4 10             	add    $0x10,%esp
+f0104dfe:	85 c0                	test   %eax,%eax
+f0104e00:	74 26                	je     f0104e28 <region_alloc+0x61>
+f0104e02:	6a 06                	push   $0x6
+f0104e04:	53                   	push   %ebx
+f0104e05:	50                   	push   %eax
+f0104e06:	ff 77 78             	push   0x78(%edi)
+f0104e09:	e8 47 d4 ff ff       	call   f0102255 <page_insert>
+f0104e0e:	83 c4 10             	add    $0x10,%esp
+f0104e11:	83 f8 fc             	cmp    $0xfffffffc,%eax
+f0104e14:	74 2f                	je     f0104e45 <region_alloc+0x7e>
+f0104e16:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0104e1c:	39 f3                	cmp    %esi,%ebx
+f0104e1e:	72 d1                	jb     f0104df1 <region_alloc+0x2a>
+f0104e20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104e23:	5b                   	pop    %ebx
+f0104e24:	5e                   	pop    %esi
+f0104e25:	5f                   	pop    %edi
+f0104e26:	5d                   	pop    %ebp
+f0104e27:	c3                   	ret
+f0104e28:	83 ec 0c             	sub    $0xc,%esp
+f0104e2b:	ff 75 e0             	push   -0x20(%ebp)
+f0104e2e:	ff 75 e4             	push   -0x1c(%ebp)
+f0104e31:	68 d4 e5 10 f0       	push   $0xf010e5d4
+f0104e36:	68 bd 01 00 00       	push   $0x1bd
+f0104e3b:	68 26 e6 10 f0       	push   $0xf010e626
+f0104e40:	e8 fb b1 ff ff       	call   f0100040 <_panic>
+f0104e45:	83 ec 0c             	sub    $0xc,%esp
+f0104e48:	ff 75 e0             	push   -0x20(%ebp)
+f0104e4b:	ff 75 e4             	push   -0x1c(%ebp)
+f0104e4e:	68 d4 e5 10 f0       	push   $0xf010e5d4
+f0104e53:	68 c1 01 00 00       	push   $0x1c1
+f0104e58:	68 26 e6 10 f0       	push   $0xf010e626
+f0104e5d:	e8 de b1 ff ff       	call   f0100040 <_panic>
+
+f0104e62 <envid2env>:
+f0104e62:	55                   	push   %ebp
+f0104e63:	89 e5                	mov    %esp,%ebp
+f0104e65:	56                   	push   %esi
+f0104e66:	53                   	push   %ebx
+f0104e67:	8b 75 08             	mov    0x8(%ebp),%esi
+f0104e6a:	85 f6                	test   %esi,%esi
+f0104e6c:	74 69                	je     f0104ed7 <envid2env+0x75>
+f0104e6e:	89 f3                	mov    %esi,%ebx
+f0104e70:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+f0104e76:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+f0104e7c:	03 1d 78 57 2b f0    	add    0xf02b5778,%ebx
+f0104e82:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f0104e86:	0f 84 98 00 00 00    	je     f0104f24 <envid2env+0xc2>
+f0104e8c:	39 73 48             	cmp    %esi,0x48(%ebx)
+f0104e8f:	0f 85 9b 00 00 00    	jne    f0104f30 <envid2env+0xce>
+f0104e95:	e8 b7 60 00 00       	call   f010af51 <cpunum>
+f0104e9a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0104ea0:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0104ea6:	83 78 50 04          	cmpl   $0x4,0x50(%eax)
+f0104eaa:	74 1d                	je     f0104ec9 <envid2env+0x67>
+f0104eac:	e8 a0 60 00 00       	call   f010af51 <cpunum>
+f0104eb1:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0104eb7:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0104ebd:	83 78 50 05          	cmpl   $0x5,0x50(%eax)
+f0104ec1:	74 06                	je     f0104ec9 <envid2env+0x67>
+f0104ec3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0104ec7:	75 23                	jne    f0104eec <envid2env+0x8a>
+f0104ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104ece:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0104ed1:	89 1a                	mov    %ebx,(%edx)
+f0104ed3:	5b                   	pop    %ebx
+f0104ed4:	5e                   	pop    %esi
+f0104ed5:	5d                   	pop    %ebp
+f0104ed6:	c3                   	ret
+f0104ed7:	e8 75 60 00 00       	call   f010af51 <cpunum>
+f0104edc:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0104ee2:	8b 98 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%ebx
+f0104ee8:	89 f0                	mov    %esi,%eax
+f0104eea:	eb e2                	jmp    f0104ece <envid2env+0x6c>
+f0104eec:	e8 60 60 00 00       	call   f010af51 <cpunum>
+f0104ef1:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0104ef7:	39 98 28 20 2d f0    	cmp    %ebx,-0xfd2dfd8(%eax)
+f0104efd:	74 ca                	je     f0104ec9 <envid2env+0x67>
+f0104eff:	8b 73 4c             	mov    0x4c(%ebx),%esi
+f0104f02:	e8 4a 60 00 00       	call   f010af51 <cpunum>
+f0104f07:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0104f0d:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0104f13:	3b 70 48             	cmp    0x48(%eax),%esi
+f0104f16:	74 b1                	je     f0104ec9 <envid2env+0x67>
+f0104f18:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104f1d:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0104f22:	eb aa                	jmp    f0104ece <envid2env+0x6c>
+f0104f24:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104f29:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0104f2e:	eb 9e                	jmp    f0104ece <envid2env+0x6c>
+f0104f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104f35:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0104f3a:	eb 92                	jmp    f0104ece <envid2env+0x6c>
+
+f0104f3c <env_set_type>:
+f0104f3c:	55                   	push   %ebp
+f0104f3d:	89 e5                	mov    %esp,%ebp
+f0104f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+f0104f42:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0104f45:	89 42 50             	mov    %eax,0x50(%edx)
+f0104f48:	83 f8 01             	cmp    $0x1,%eax
+f0104f4b:	76 14                	jbe    f0104f61 <env_set_type+0x25>
+f0104f4d:	83 3c 85 88 57 2b f0 	cmpl   $0x0,-0xfd4a878(,%eax,4)
+f0104f54:	00 
+f0104f55:	75 0a                	jne    f0104f61 <env_set_type+0x25>
+f0104f57:	8b 52 48             	mov    0x48(%edx),%edx
+f0104f5a:	89 14 85 88 57 2b f0 	mov    %edx,-0xfd4a878(,%eax,4)
+f0104f61:	5d                   	pop    %ebp
+f0104f62:	c3                   	ret
+
+f0104f63 <env_service>:
+f0104f63:	55                   	push   %ebp
+f0104f64:	89 e5                	mov    %esp,%ebp
+f0104f66:	8b 55 08             	mov    0x8(%ebp),%edx
+f0104f69:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104f6e:	83 fa 05             	cmp    $0x5,%edx
+f0104f71:	77 07                	ja     f0104f7a <env_service+0x17>
+f0104f73:	8b 04 95 88 57 2b f0 	mov    -0xfd4a878(,%edx,4),%eax
+f0104f7a:	5d                   	pop    %ebp
+f0104f7b:	c3                   	ret
+
+f0104f7c <env_init_percpu>:
+f0104f7c:	b8 00 a3 11 f0       	mov    $0xf011a300,%eax
+f0104f81:	0f 01 10             	lgdtl  (%eax)
+f0104f84:	b8 23 00 00 00       	mov    $0x23,%eax
+f0104f89:	8e e8                	mov    %eax,%gs
+f0104f8b:	8e e0                	mov    %eax,%fs
+f0104f8d:	b8 10 00 00 00       	mov    $0x10,%eax
+f0104f92:	8e c0                	mov    %eax,%es
+f0104f94:	8e d8                	mov    %eax,%ds
+f0104f96:	8e d0                	mov    %eax,%ss
+f0104f98:	ea 9f 4f 10 f0 08 00 	ljmp   $0x8,$0xf0104f9f
+f0104f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104fa4:	0f 00 d0             	lldt   %ax
+f0104fa7:	c3                   	ret
+
+f0104fa8 <env_init>:
+f0104fa8:	55                   	push   %ebp
+f0104fa9:	89 e5                	mov    %esp,%ebp
+f0104fab:	53                   	push   %ebx
+f0104fac:	83 ec 04             	sub    $0x4,%esp
+f0104faf:	8b 1d 78 57 2b f0    	mov    0xf02b5778,%ebx
+f0104fb5:	8d 83 54 ae 06 00    	lea    0x6ae54(%ebx),%eax
+f0104fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104fc0:	89 d1                	mov    %edx,%ecx
+f0104fc2:	89 c2                	mov    %eax,%edx
+f0104fc4:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+f0104fcb:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+f0104fd2:	89 48 44             	mov    %ecx,0x44(%eax)
+f0104fd5:	2d ac 01 00 00       	sub    $0x1ac,%eax
+f0104fda:	39 da                	cmp    %ebx,%edx
+f0104fdc:	75 e2                	jne    f0104fc0 <env_init+0x18>
+f0104fde:	89 1d a0 57 2b f0    	mov    %ebx,0xf02b57a0
+f0104fe4:	e8 93 ff ff ff       	call   f0104f7c <env_init_percpu>
+f0104fe9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104fec:	c9                   	leave
+f0104fed:	c3                   	ret
+
+f0104fee <env_pgdir_fill>:
+f0104fee:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104ff3:	83 3d 7c 57 2b f0 0f 	cmpl   $0xf,0xf02b577c
+f0104ffa:	7e 01                	jle    f0104ffd <env_pgdir_fill+0xf>
+f0104ffc:	c3                   	ret
+f0104ffd:	55                   	push   %ebp
+f0104ffe:	89 e5                	mov    %esp,%ebp
+f0105000:	83 ec 08             	sub    $0x8,%esp
+f0105003:	e8 1f fd ff ff       	call   f0104d27 <env_pgdir_build>
+f0105008:	89 c2                	mov    %eax,%edx
+f010500a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010500f:	85 d2                	test   %edx,%edx
+f0105011:	74 19                	je     f010502c <env_pgdir_fill+0x3e>
+f0105013:	a1 80 57 2b f0       	mov    0xf02b5780,%eax
+f0105018:	89 02                	mov    %eax,(%edx)
+f010501a:	89 15 80 57 2b f0    	mov    %edx,0xf02b5780
+f0105020:	83 05 7c 57 2b f0 01 	addl   $0x1,0xf02b577c
+f0105027:	b8 01 00 00 00       	mov    $0x1,%eax
+f010502c:	c9                   	leave
+f010502d:	c3                   	ret
+
+f010502e <env_alloc>:
+f010502e:	55                   	push   %ebp
+f010502f:	89 e5                	mov    %esp,%ebp
+f0105031:	53                   	push   %ebx
+f0105032:	83 ec 04             	sub    $0x4,%esp
+f0105035:	8b 1d a0 57 2b f0    	mov    0xf02b57a0,%ebx
+f010503b:	85 db                	test   %ebx,%ebx
+f010503d:	0f 84 fc 01 00 00    	je     f010523f <env_alloc+0x211>
+f0105043:	a1 80 57 2b f0       	mov    0xf02b5780,%eax
+f0105048:	85 c0                	test   %eax,%eax
+f010504a:	0f 84 99 01 00 00    	je     f01051e9 <env_alloc+0x1bb>
+f0105050:	8b 10                	mov    (%eax),%edx
+f0105052:	89 15 80 57 2b f0    	mov    %edx,0xf02b5780
+f0105058:	83 2d 7c 57 2b f0 01 	subl   $0x1,0xf02b577c
+f010505f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0105065:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010506b:	c1 f8 02             	sar    $0x2,%eax
+f010506e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0105074:	89 c2                	mov    %eax,%edx
+f0105076:	c1 e2 0c             	shl    $0xc,%edx
+f0105079:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010507e:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0105084:	0f 83 73 01 00 00    	jae    f01051fd <env_alloc+0x1cf>
+f010508a:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0105090:	89 53 78             	mov    %edx,0x78(%ebx)
+f0105093:	8b 43 48             	mov    0x48(%ebx),%eax
+f0105096:	25 00 f0 0f 00       	and    $0xff000,%eax
+f010509b:	89 da                	mov    %ebx,%edx
+f010509d:	2b 15 78 57 2b f0    	sub    0xf02b5778,%edx
+f01050a3:	c1 fa 02             	sar    $0x2,%edx
+f01050a6:	69 d2 43 ac 28 8d    	imul   $0x8d28ac43,%edx,%edx
+f01050ac:	05 00 10 00 00       	add    $0x1000,%eax
+f01050b1:	09 c2                	or     %eax,%edx
+f01050b3:	89 53 48             	mov    %edx,0x48(%ebx)
+f01050b6:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f01050bb:	8b 80 00 54 00 00    	mov    0x5400(%eax),%eax
+f01050c1:	c1 e0 14             	shl    $0x14,%eax
+f01050c4:	25 00 00 f0 3f       	and    $0x3ff00000,%eax
+f01050c9:	09 d0                	or     %edx,%eax
+f01050cb:	89 43 48             	mov    %eax,0x48(%ebx)
+f01050ce:	0f 88 3b 01 00 00    	js     f010520f <env_alloc+0x1e1>
+f01050d4:	c7 83 cc 00 00 00 00 	movl   $0x0,0xcc(%ebx)
+f01050db:	00 00 00 
+f01050de:	c7 83 d4 00 00 00 00 	movl   $0x0,0xd4(%ebx)
+f01050e5:	00 00 00 
+f01050e8:	c7 83 d8 00 00 00 00 	movl   $0x0,0xd8(%ebx)
+f01050ef:	00 00 00 
+f01050f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01050f5:	89 43 4c             	mov    %eax,0x4c(%ebx)
+f01050f8:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+f01050ff:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f0105106:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+f010510d:	83 ec 04             	sub    $0x4,%esp
+f0105110:	68 d0 00 00 00       	push   $0xd0
+f0105115:	6a 00                	push   $0x0
+f0105117:	8d 83 dc 00 00 00    	lea    0xdc(%ebx),%eax
+f010511d:	50                   	push   %eax
+f010511e:	e8 d1 57 00 00       	call   f010a8f4 <memset>
+f0105123:	89 1c 24             	mov    %ebx,(%esp)
+f0105126:	e8 bd 1f 00 00       	call   f01070e8 <sched_env_init>
+f010512b:	83 c4 0c             	add    $0xc,%esp
+f010512e:	6a 44                	push   $0x44
+f0105130:	6a 00                	push   $0x0
+f0105132:	53                   	push   %ebx
+f0105133:	e8 bc 57 00 00       	call   f010a8f4 <memset>
+f0105138:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+f010513e:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+f0105144:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+f010514a:	c7 43 3c 00 e0 7f ee 	movl   $0xee7fe000,0x3c(%ebx)
+f0105151:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+f0105157:	81 4b 38 00 02 00 00 	orl    $0x200,0x38(%ebx)
+f010515e:	c7 43 7c 00 00 00 00 	movl   $0x0,0x7c(%ebx)
+f0105165:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+f010516c:	00 00 00 
+f010516f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+f0105176:	00 00 00 
+f0105179:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+f0105180:	00 00 00 
+f0105183:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+f010518a:	00 00 00 
+f010518d:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+f0105194:	00 00 00 
+f0105197:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+f010519e:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+f01051a5:	00 00 00 
+f01051a8:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+f01051af:	00 00 00 
+f01051b2:	c7 83 c4 00 00 00 00 	movl   $0x0,0xc4(%ebx)
+f01051b9:	00 00 00 
+f01051bc:	c7 83 c8 00 00 00 00 	movl   $0x0,0xc8(%ebx)
+f01051c3:	00 00 00 
+f01051c6:	8b 43 44             	mov    0x44(%ebx),%eax
+f01051c9:	a3 a0 57 2b f0       	mov    %eax,0xf02b57a0
+f01051ce:	8b 45 08             	mov    0x8(%ebp),%eax
+f01051d1:	89 18                	mov    %ebx,(%eax)
+f01051d3:	83 c4 10             	add    $0x10,%esp
+f01051d6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01051db:	f6 05 a8 b4 32 f0 40 	testb  $0x40,0xf032b4a8
+f01051e2:	75 42                	jne    f0105226 <env_alloc+0x1f8>
+f01051e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01051e7:	c9                   	leave
+f01051e8:	c3                   	ret
+f01051e9:	e8 39 fb ff ff       	call   f0104d27 <env_pgdir_build>
+f01051ee:	85 c0                	test   %eax,%eax
+f01051f0:	0f 85 6f fe ff ff    	jne    f0105065 <env_alloc+0x37>
+f01051f6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f01051fb:	eb e7                	jmp    f01051e4 <env_alloc+0x1b6>
+f01051fd:	52                   	push   %edx
+f01051fe:	68 24 d0 10 f0       	push   $0xf010d024
+f0105203:	6a 61                	push   $0x61
+f0105205:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f010520a:	e8 31 ae ff ff       	call   f0100040 <_panic>
+f010520f:	83 ec 04             	sub    $0x4,%esp
+f0105212:	68 04 e6 10 f0       	push   $0xf010e604
+f0105217:	68 5e 01 00 00       	push   $0x15e
+f010521c:	68 26 e6 10 f0       	push   $0xf010e626
+f0105221:	e8 1a ae ff ff       	call   f0100040 <_panic>
+f0105226:	6a 00                	push   $0x0
+f0105228:	ff 75 0c             	push   0xc(%ebp)
+f010522b:	ff 73 48             	push   0x48(%ebx)
+f010522e:	6a 06                	push   $0x6
+f0105230:	e8 52 79 00 00       	call   f010cb87 <trace_record>
+f0105235:	83 c4 10             	add    $0x10,%esp
+f0105238:	b8 00 00 00 00       	mov    $0x0,%eax
+f010523d:	eb a5                	jmp    f01051e4 <env_alloc+0x1b6>
+f010523f:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f0105244:	eb 9e                	jmp    f01051e4 <env_alloc+0x1b6>
+
+f0105246 <env_create>:
+f0105246:	55                   	push   %ebp
+f0105247:	89 e5                	mov    %esp,%ebp
+f0105249:	57                   	push   %edi
+f010524a:	56                   	push   %esi
+f010524b:	53                   	push   %ebx
+f010524c:	83 ec 34             	sub    $0x34,%esp
+f010524f:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0105252:	6a 00                	push   $0x0
+f0105254:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105257:	50                   	push   %eax
+f0105258:	e8 d1 fd ff ff       	call   f010502e <env_alloc>
+f010525d:	83 c4 10             	add    $0x10,%esp
+f0105260:	85 c0                	test   %eax,%eax
+f0105262:	0f 88 9d 00 00 00    	js     f0105305 <env_create+0xbf>
+f0105268:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010526b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010526e:	81 3f 7f 45 4c 46    	cmpl   $0x464c457f,(%edi)
+f0105274:	0f 85 93 00 00 00    	jne    f010530d <env_create+0xc7>
+f010527a:	89 fb                	mov    %edi,%ebx
+f010527c:	03 5f 1c             	add    0x1c(%edi),%ebx
+f010527f:	0f b7 77 2c          	movzwl 0x2c(%edi),%esi
+f0105283:	c1 e6 05             	shl    $0x5,%esi
+f0105286:	01 de                	add    %ebx,%esi
+f0105288:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010528b:	8b 40 78             	mov    0x78(%eax),%eax
+f010528e:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0105293:	0f 86 8b 00 00 00    	jbe    f0105324 <env_create+0xde>
+f0105299:	05 00 00 00 10       	add    $0x10000000,%eax
+f010529e:	0f 22 d8             	mov    %eax,%cr3
+f01052a1:	39 f3                	cmp    %esi,%ebx
+f01052a3:	0f 82 eb 00 00 00    	jb     f0105394 <env_create+0x14e>
+f01052a9:	8b 47 18             	mov    0x18(%edi),%eax
+f01052ac:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f01052af:	89 47 30             	mov    %eax,0x30(%edi)
+f01052b2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f01052b7:	ba 00 d0 7f ee       	mov    $0xee7fd000,%edx
+f01052bc:	89 f8                	mov    %edi,%eax
+f01052be:	e8 04 fb ff ff       	call   f0104dc7 <region_alloc>
+f01052c3:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f01052c8:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01052cd:	0f 86 d0 00 00 00    	jbe    f01053a3 <env_create+0x15d>
+f01052d3:	05 00 00 00 10       	add    $0x10000000,%eax
+f01052d8:	0f 22 d8             	mov    %eax,%cr3
+f01052db:	83 ec 08             	sub    $0x8,%esp
+f01052de:	ff 75 10             	push   0x10(%ebp)
+f01052e1:	ff 75 d4             	push   -0x2c(%ebp)
+f01052e4:	e8 53 fc ff ff       	call   f0104f3c <env_set_type>
+f01052e9:	83 c4 10             	add    $0x10,%esp
+f01052ec:	83 7d 10 02          	cmpl   $0x2,0x10(%ebp)
+f01052f0:	0f 84 c2 00 00 00    	je     f01053b8 <env_create+0x172>
+f01052f6:	8b 45 10             	mov    0x10(%ebp),%eax
+f01052f9:	83 e8 02             	sub    $0x2,%eax
+f01052fc:	83 f8 03             	cmp    $0x3,%eax
+f01052ff:	0f 86 bd 00 00 00    	jbe    f01053c2 <env_create+0x17c>
+f0105305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105308:	5b                   	pop    %ebx
+f0105309:	5e                   	pop    %esi
+f010530a:	5f                   	pop    %edi
+f010530b:	5d                   	pop    %ebp
+f010530c:	c3                   	ret
+f010530d:	83 ec 04             	sub    $0x4,%esp
+f0105310:	68 31 e6 10 f0       	push   $0xf010e631
+f0105315:	68 02 02 00 00       	push   $0x202
+f010531a:	68 26 e6 10 f0       	push   $0xf010e626
+f010531f:	e8 1c ad ff ff       	call   f0100040 <_panic>
+f0105324:	50                   	push   %eax
+f0105325:	68 48 d0 10 f0       	push   $0xf010d048
+f010532a:	68 08 02 00 00       	push   $0x208
+f010532f:	68 26 e6 10 f0       	push   $0xf010e626
+f0105334:	e8 07 ad ff ff       	call   f0100040 <_panic>
+f0105339:	83 ec 04             	sub    $0x4,%esp
+f010533c:	68 4d e6 10 f0       	push   $0xf010e64d
+f0105341:	68 0d 02 00 00       	push   $0x20d
+f0105346:	68 26 e6 10 f0       	push   $0xf010e626
+f010534b:	e8 f0 ac ff ff       	call   f0100040 <_panic>
+f0105350:	8b 53 0c             	mov    0xc(%ebx),%edx
+f0105353:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0105356:	e8 6c fa ff ff       	call   f0104dc7 <region_alloc>
+f010535b:	83 ec 04             	sub    $0x4,%esp
+f010535e:	ff 73 10             	push   0x10(%ebx)
+f0105361:	89 f8                	mov    %edi,%eax
+f0105363:	03 43 04             	add    0x4(%ebx),%eax
+f0105366:	50                   	push   %eax
+f0105367:	ff 73 08             	push   0x8(%ebx)
+f010536a:	e8 ba 55 00 00       	call   f010a929 <memmove>
+f010536f:	8b 43 10             	mov    0x10(%ebx),%eax
+f0105372:	83 c4 0c             	add    $0xc,%esp
+f0105375:	8b 53 14             	mov    0x14(%ebx),%edx
+f0105378:	29 c2                	sub    %eax,%edx
+f010537a:	52                   	push   %edx
+f010537b:	6a 00                	push   $0x0
+f010537d:	03 43 08             	add    0x8(%ebx),%eax
+f0105380:	50                   	push   %eax
+f0105381:	e8 6e 55 00 00       	call   f010a8f4 <memset>
+f0105386:	83 c4 10             	add    $0x10,%esp
+f0105389:	83 c3 20             	add    $0x20,%ebx
+f010538c:	39 f3                	cmp    %esi,%ebx
+f010538e:	0f 83 15 ff ff ff    	jae    f01052a9 <env_create+0x63>
+f0105394:	8b 4b 14             	mov    0x14(%ebx),%ecx
+f0105397:	3b 4b 10             	cmp    0x10(%ebx),%ecx
+f010539a:	72 9d                	jb     f0105339 <env_create+0xf3>
+f010539c:	83 3b 01             	cmpl   $0x1,(%ebx)
+f010539f:	75 e8                	jne    f0105389 <env_create+0x143>
+f01053a1:	eb ad                	jmp    f0105350 <env_create+0x10a>
+f01053a3:	50                   	push   %eax
+f01053a4:	68 48 d0 10 f0       	push   $0xf010d048
+f01053a9:	68 27 02 00 00       	push   $0x227
+f01053ae:	68 26 e6 10 f0       	push   $0xf010e626
+f01053b3:	e8 88 ac ff ff       	call   f0100040 <_panic>
+f01053b8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01053bb:	81 48 38 00 30 00 00 	orl    $0x3000,0x38(%eax)
+f01053c2:	83 ec 04             	sub    $0x4,%esp
+f01053c5:	6a 10                	push   $0x10
+f01053c7:	6a 01                	push   $0x1
+f01053c9:	ff 75 d4             	push   -0x2c(%ebp)
+f01053cc:	e8 45 1d 00 00       	call   f0107116 <sched_set_class>
+f01053d1:	83 c4 10             	add    $0x10,%esp
+f01053d4:	e9 2c ff ff ff       	jmp    f0105305 <env_create+0xbf>
+
+f01053d9 <env_free>:
+f01053d9:	55                   	push   %ebp
+f01053da:	89 e5                	mov    %esp,%ebp
+f01053dc:	57                   	push   %edi
+f01053dd:	56                   	push   %esi
+f01053de:	53                   	push   %ebx
+f01053df:	83 ec 0c             	sub    $0xc,%esp
+f01053e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01053e5:	e8 67 5b 00 00       	call   f010af51 <cpunum>
+f01053ea:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01053f0:	39 98 28 20 2d f0    	cmp    %ebx,-0xfd2dfd8(%eax)
+f01053f6:	0f 84 96 00 00 00    	je     f0105492 <env_free+0xb9>
+f01053fc:	83 ec 0c             	sub    $0xc,%esp
+f01053ff:	53                   	push   %ebx
+f0105400:	e8 91 2f 00 00       	call   f0108396 <ipc_cancel>
+f0105405:	8b 73 50             	mov    0x50(%ebx),%esi
+f0105408:	8b 7b 48             	mov    0x48(%ebx),%edi
+f010540b:	83 c4 10             	add    $0x10,%esp
+f010540e:	39 3c b5 88 57 2b f0 	cmp    %edi,-0xfd4a878(,%esi,4)
+f0105415:	0f 84 bc 00 00 00    	je     f01054d7 <env_free+0xfe>
+f010541b:	83 ec 0c             	sub    $0xc,%esp
+f010541e:	57                   	push   %edi
+f010541f:	e8 a3 79 00 00       	call   f010cdc7 <textcache_drop>
+f0105424:	83 c4 10             	add    $0x10,%esp
+f0105427:	f6 05 a8 b4 32 f0 80 	testb  $0x80,0xf032b4a8
+f010542e:	0f 85 e6 00 00 00    	jne    f010551a <env_free+0x141>
+f0105434:	8b 43 78             	mov    0x78(%ebx),%eax
+f0105437:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010543c:	0f 86 ee 00 00 00    	jbe    f0105530 <env_free+0x157>
+f0105442:	05 00 00 00 10       	add    $0x10000000,%eax
+f0105447:	c1 e8 0c             	shr    $0xc,%eax
+f010544a:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0105450:	0f 83 ef 00 00 00    	jae    f0105545 <env_free+0x16c>
+f0105456:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0105459:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f010545e:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0105461:	8b 15 84 57 2b f0    	mov    0xf02b5784,%edx
+f0105467:	89 10                	mov    %edx,(%eax)
+f0105469:	a3 84 57 2b f0       	mov    %eax,0xf02b5784
+f010546e:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+f0105475:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+f010547c:	a1 a0 57 2b f0       	mov    0xf02b57a0,%eax
+f0105481:	89 43 44             	mov    %eax,0x44(%ebx)
+f0105484:	89 1d a0 57 2b f0    	mov    %ebx,0xf02b57a0
+f010548a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010548d:	5b                   	pop    %ebx
+f010548e:	5e                   	pop    %esi
+f010548f:	5f                   	pop    %edi
+f0105490:	5d                   	pop    %ebp
+f0105491:	c3                   	ret
+f0105492:	a1 6c 1a 2d f0       	mov    0xf02d1a6c,%eax
+f0105497:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010549c:	76 24                	jbe    f01054c2 <env_free+0xe9>
+f010549e:	05 00 00 00 10       	add    $0x10000000,%eax
+f01054a3:	0f 22 d8             	mov    %eax,%cr3
+f01054a6:	e8 a6 5a 00 00       	call   f010af51 <cpunum>
+f01054ab:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01054b1:	8b 15 6c 1a 2d f0    	mov    0xf02d1a6c,%edx
+f01054b7:	89 90 a0 20 2d f0    	mov    %edx,-0xfd2df60(%eax)
+f01054bd:	e9 3a ff ff ff       	jmp    f01053fc <env_free+0x23>
+f01054c2:	50                   	push   %eax
+f01054c3:	68 48 d0 10 f0       	push   $0xf010d048
+f01054c8:	68 56 02 00 00       	push   $0x256
+f01054cd:	68 26 e6 10 f0       	push   $0xf010e626
+f01054d2:	e8 69 ab ff ff       	call   f0100040 <_panic>
+f01054d7:	c7 04 b5 88 57 2b f0 	movl   $0x0,-0xfd4a878(,%esi,4)
+f01054de:	00 00 00 00 
+f01054e2:	a1 78 57 2b f0       	mov    0xf02b5778,%eax
+f01054e7:	8d 88 00 b0 06 00    	lea    0x6b000(%eax),%ecx
+f01054ed:	eb 0d                	jmp    f01054fc <env_free+0x123>
+f01054ef:	05 ac 01 00 00       	add    $0x1ac,%eax
+f01054f4:	39 c1                	cmp    %eax,%ecx
+f01054f6:	0f 84 1f ff ff ff    	je     f010541b <env_free+0x42>
+f01054fc:	39 c3                	cmp    %eax,%ebx
+f01054fe:	74 ef                	je     f01054ef <env_free+0x116>
+f0105500:	83 78 54 00          	cmpl   $0x0,0x54(%eax)
+f0105504:	74 e9                	je     f01054ef <env_free+0x116>
+f0105506:	3b 70 50             	cmp    0x50(%eax),%esi
+f0105509:	75 e4                	jne    f01054ef <env_free+0x116>
+f010550b:	8b 40 48             	mov    0x48(%eax),%eax
+f010550e:	89 04 b5 88 57 2b f0 	mov    %eax,-0xfd4a878(,%esi,4)
+f0105515:	e9 01 ff ff ff       	jmp    f010541b <env_free+0x42>
+f010551a:	6a 00                	push   $0x0
+f010551c:	6a 00                	push   $0x0
+f010551e:	ff 73 48             	push   0x48(%ebx)
+f0105521:	6a 07                	push   $0x7
+f0105523:	e8 5f 76 00 00       	call   f010cb87 <trace_record>
+f0105528:	83 c4 10             	add    $0x10,%esp
+f010552b:	e9 04 ff ff ff       	jmp    f0105434 <env_free+0x5b>
+f0105530:	50                   	push   %eax
+f0105531:	68 48 d0 10 f0       	push   $0xf010d048
+f0105536:	68 6c 02 00 00       	push   $0x26c
+f010553b:	68 26 e6 10 f0       	push   $0xf010e626
+f0105540:	e8 fb aa ff ff       	call   f0100040 <_panic>
+f0105545:	83 ec 04             	sub    $0x4,%esp
+f0105548:	68 44 d7 10 f0       	push   $0xf010d744
+f010554d:	6a 5a                	push   $0x5a
+f010554f:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0105554:	e8 e7 aa ff ff       	call   f0100040 <_panic>
+
+f0105559 <env_reclaim>:
+f0105559:	55                   	push   %ebp
+f010555a:	89 e5                	mov    %esp,%ebp
+f010555c:	57                   	push   %edi
+f010555d:	56                   	push   %esi
+f010555e:	53                   	push   %ebx
+f010555f:	83 ec 2c             	sub    $0x2c,%esp
+f0105562:	a1 84 57 2b f0       	mov    0xf02b5784,%eax
+f0105567:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f010556b:	0f 84 19 02 00 00    	je     f010578a <env_reclaim+0x231>
+f0105571:	85 c0                	test   %eax,%eax
+f0105573:	0f 84 11 02 00 00    	je     f010578a <env_reclaim+0x231>
+f0105579:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0105580:	89 c1                	mov    %eax,%ecx
+f0105582:	e9 a6 01 00 00       	jmp    f010572d <env_reclaim+0x1d4>
+f0105587:	50                   	push   %eax
+f0105588:	68 24 d0 10 f0       	push   $0xf010d024
+f010558d:	6a 61                	push   $0x61
+f010558f:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0105594:	e8 a7 aa ff ff       	call   f0100040 <_panic>
+f0105599:	83 ec 04             	sub    $0x4,%esp
+f010559c:	68 44 d7 10 f0       	push   $0xf010d744
+f01055a1:	6a 5a                	push   $0x5a
+f01055a3:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01055a8:	e8 93 aa ff ff       	call   f0100040 <_panic>
+f01055ad:	89 f2                	mov    %esi,%edx
+f01055af:	c1 ea 0c             	shr    $0xc,%edx
+f01055b2:	3b 15 68 1a 2d f0    	cmp    0xf02d1a68,%edx
+f01055b8:	73 11                	jae    f01055cb <env_reclaim+0x72>
+f01055ba:	8d 9e 00 00 00 f0    	lea    -0x10000000(%esi),%ebx
+f01055c0:	81 ee 00 f0 ff 0f    	sub    $0xffff000,%esi
+f01055c6:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f01055c9:	eb 30                	jmp    f01055fb <env_reclaim+0xa2>
+f01055cb:	56                   	push   %esi
+f01055cc:	68 24 d0 10 f0       	push   $0xf010d024
+f01055d1:	68 9d 02 00 00       	push   $0x29d
+f01055d6:	68 26 e6 10 f0       	push   $0xf010e626
+f01055db:	e8 60 aa ff ff       	call   f0100040 <_panic>
+f01055e0:	83 ec 04             	sub    $0x4,%esp
+f01055e3:	68 44 d7 10 f0       	push   $0xf010d744
+f01055e8:	6a 5a                	push   $0x5a
+f01055ea:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01055ef:	e8 4c aa ff ff       	call   f0100040 <_panic>
+f01055f4:	83 c3 04             	add    $0x4,%ebx
+f01055f7:	39 f3                	cmp    %esi,%ebx
+f01055f9:	74 2a                	je     f0105625 <env_reclaim+0xcc>
+f01055fb:	8b 03                	mov    (%ebx),%eax
+f01055fd:	a8 01                	test   $0x1,%al
+f01055ff:	74 f3                	je     f01055f4 <env_reclaim+0x9b>
+f0105601:	c1 e8 0c             	shr    $0xc,%eax
+f0105604:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f010560a:	73 d4                	jae    f01055e0 <env_reclaim+0x87>
+f010560c:	83 ec 0c             	sub    $0xc,%esp
+f010560f:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0105612:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f0105617:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f010561a:	50                   	push   %eax
+f010561b:	e8 ae c4 ff ff       	call   f0101ace <page_decref>
+f0105620:	83 c4 10             	add    $0x10,%esp
+f0105623:	eb cf                	jmp    f01055f4 <env_reclaim+0x9b>
+f0105625:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0105628:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010562b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f0105631:	3b 15 68 1a 2d f0    	cmp    0xf02d1a68,%edx
+f0105637:	0f 83 95 00 00 00    	jae    f01056d2 <env_reclaim+0x179>
+f010563d:	83 ec 0c             	sub    $0xc,%esp
+f0105640:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0105643:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f0105648:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f010564b:	50                   	push   %eax
+f010564c:	e8 7d c4 ff ff       	call   f0101ace <page_decref>
+f0105651:	83 c4 10             	add    $0x10,%esp
+f0105654:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+f0105658:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010565b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010565e:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+f0105661:	0f 95 c3             	setne  %bl
+f0105664:	83 c7 04             	add    $0x4,%edi
+f0105667:	3d b9 03 00 00       	cmp    $0x3b9,%eax
+f010566c:	77 78                	ja     f01056e6 <env_reclaim+0x18d>
+f010566e:	84 db                	test   %bl,%bl
+f0105670:	74 74                	je     f01056e6 <env_reclaim+0x18d>
+f0105672:	89 7d dc             	mov    %edi,-0x24(%ebp)
+f0105675:	8b 07                	mov    (%edi),%eax
+f0105677:	a8 01                	test   $0x1,%al
+f0105679:	74 d9                	je     f0105654 <env_reclaim+0xfb>
+f010567b:	89 c6                	mov    %eax,%esi
+f010567d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0105683:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+f0105687:	a8 80                	test   $0x80,%al
+f0105689:	0f 84 1e ff ff ff    	je     f01055ad <env_reclaim+0x54>
+f010568f:	8d 9e 00 00 40 00    	lea    0x400000(%esi),%ebx
+f0105695:	89 f0                	mov    %esi,%eax
+f0105697:	c1 e8 0c             	shr    $0xc,%eax
+f010569a:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f01056a0:	0f 83 f3 fe ff ff    	jae    f0105599 <env_reclaim+0x40>
+f01056a6:	83 ec 0c             	sub    $0xc,%esp
+f01056a9:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01056ac:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f01056b1:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01056b4:	50                   	push   %eax
+f01056b5:	e8 14 c4 ff ff       	call   f0101ace <page_decref>
+f01056ba:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01056c0:	83 c4 10             	add    $0x10,%esp
+f01056c3:	39 de                	cmp    %ebx,%esi
+f01056c5:	75 ce                	jne    f0105695 <env_reclaim+0x13c>
+f01056c7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01056ca:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f01056d0:	eb 82                	jmp    f0105654 <env_reclaim+0xfb>
+f01056d2:	83 ec 04             	sub    $0x4,%esp
+f01056d5:	68 44 d7 10 f0       	push   $0xf010d744
+f01056da:	6a 5a                	push   $0x5a
+f01056dc:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f01056e1:	e8 5a a9 ff ff       	call   f0100040 <_panic>
+f01056e6:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f01056e9:	81 7d e4 b9 03 00 00 	cmpl   $0x3b9,-0x1c(%ebp)
+f01056f0:	0f 86 9b 00 00 00    	jbe    f0105791 <env_reclaim+0x238>
+f01056f6:	8b 01                	mov    (%ecx),%eax
+f01056f8:	a3 84 57 2b f0       	mov    %eax,0xf02b5784
+f01056fd:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+f0105703:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0105707:	78 0a                	js     f0105713 <env_reclaim+0x1ba>
+f0105709:	a1 7c 57 2b f0       	mov    0xf02b577c,%eax
+f010570e:	83 f8 0f             	cmp    $0xf,%eax
+f0105711:	7e 5f                	jle    f0105772 <env_reclaim+0x219>
+f0105713:	83 ec 0c             	sub    $0xc,%esp
+f0105716:	51                   	push   %ecx
+f0105717:	e8 b2 c3 ff ff       	call   f0101ace <page_decref>
+f010571c:	83 c4 10             	add    $0x10,%esp
+f010571f:	8b 0d 84 57 2b f0    	mov    0xf02b5784,%ecx
+f0105725:	85 c9                	test   %ecx,%ecx
+f0105727:	74 68                	je     f0105791 <env_reclaim+0x238>
+f0105729:	84 db                	test   %bl,%bl
+f010572b:	74 64                	je     f0105791 <env_reclaim+0x238>
+f010572d:	89 ca                	mov    %ecx,%edx
+f010572f:	2b 15 70 1a 2d f0    	sub    0xf02d1a70,%edx
+f0105735:	c1 fa 02             	sar    $0x2,%edx
+f0105738:	69 d2 ab aa aa aa    	imul   $0xaaaaaaab,%edx,%edx
+f010573e:	89 d0                	mov    %edx,%eax
+f0105740:	c1 e0 0c             	shl    $0xc,%eax
+f0105743:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0105749:	3b 15 68 1a 2d f0    	cmp    0xf02d1a68,%edx
+f010574f:	0f 83 32 fe ff ff    	jae    f0105587 <env_reclaim+0x2e>
+f0105755:	8d b8 00 00 00 f0    	lea    -0x10000000(%eax),%edi
+f010575b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010575e:	39 45 08             	cmp    %eax,0x8(%ebp)
+f0105761:	74 2e                	je     f0105791 <env_reclaim+0x238>
+f0105763:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f010576a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+f010576d:	e9 00 ff ff ff       	jmp    f0105672 <env_reclaim+0x119>
+f0105772:	8b 15 80 57 2b f0    	mov    0xf02b5780,%edx
+f0105778:	89 11                	mov    %edx,(%ecx)
+f010577a:	89 0d 80 57 2b f0    	mov    %ecx,0xf02b5780
+f0105780:	83 c0 01             	add    $0x1,%eax
+f0105783:	a3 7c 57 2b f0       	mov    %eax,0xf02b577c
+f0105788:	eb 95                	jmp    f010571f <env_reclaim+0x1c6>
+f010578a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0105791:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0105794:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0105798:	78 26                	js     f01057c0 <env_reclaim+0x267>
+f010579a:	eb 30                	jmp    f01057cc <env_reclaim+0x273>
+f010579c:	8b 10                	mov    (%eax),%edx
+f010579e:	89 15 80 57 2b f0    	mov    %edx,0xf02b5780
+f01057a4:	83 2d 7c 57 2b f0 01 	subl   $0x1,0xf02b577c
+f01057ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f01057b1:	83 ec 0c             	sub    $0xc,%esp
+f01057b4:	50                   	push   %eax
+f01057b5:	e8 14 c3 ff ff       	call   f0101ace <page_decref>
+f01057ba:	83 c3 01             	add    $0x1,%ebx
+f01057bd:	83 c4 10             	add    $0x10,%esp
+f01057c0:	a1 80 57 2b f0       	mov    0xf02b5780,%eax
+f01057c5:	85 c0                	test   %eax,%eax
+f01057c7:	75 d3                	jne    f010579c <env_reclaim+0x243>
+f01057c9:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+f01057cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01057cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01057d2:	5b                   	pop    %ebx
+f01057d3:	5e                   	pop    %esi
+f01057d4:	5f                   	pop    %edi
+f01057d5:	5d                   	pop    %ebp
+f01057d6:	c3                   	ret
+
+f01057d7 <env_destroy>:
+f01057d7:	55                   	push   %ebp
+f01057d8:	89 e5                	mov    %esp,%ebp
+f01057da:	53                   	push   %ebx
+f01057db:	83 ec 04             	sub    $0x4,%esp
+f01057de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01057e1:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f01057e5:	74 24                	je     f010580b <env_destroy+0x34>
+f01057e7:	83 ec 0c             	sub    $0xc,%esp
+f01057ea:	53                   	push   %ebx
+f01057eb:	e8 e9 fb ff ff       	call   f01053d9 <env_free>
+f01057f0:	e8 5c 57 00 00       	call   f010af51 <cpunum>
+f01057f5:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01057fb:	83 c4 10             	add    $0x10,%esp
+f01057fe:	39 98 28 20 2d f0    	cmp    %ebx,-0xfd2dfd8(%eax)
+f0105804:	74 21                	je     f0105827 <env_destroy+0x50>
+f0105806:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105809:	c9                   	leave
+f010580a:	c3                   	ret
+f010580b:	e8 41 57 00 00       	call   f010af51 <cpunum>
+f0105810:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105816:	39 98 28 20 2d f0    	cmp    %ebx,-0xfd2dfd8(%eax)
+f010581c:	74 c9                	je     f01057e7 <env_destroy+0x10>
+f010581e:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+f0105825:	eb df                	jmp    f0105806 <env_destroy+0x2f>
+f0105827:	e8 25 57 00 00       	call   f010af51 <cpunum>
+f010582c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105832:	c7 80 28 20 2d f0 00 	movl   $0x0,-0xfd2dfd8(%eax)
+f0105839:	00 00 00 
+f010583c:	e8 ba 19 00 00       	call   f01071fb <sched_yield>
+
+f0105841 <env_pop_tf>:
+f0105841:	55                   	push   %ebp
+f0105842:	89 e5                	mov    %esp,%ebp
+f0105844:	53                   	push   %ebx
+f0105845:	83 ec 04             	sub    $0x4,%esp
+f0105848:	e8 04 57 00 00       	call   f010af51 <cpunum>
+f010584d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105853:	8b 98 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%ebx
+f0105859:	e8 f3 56 00 00       	call   f010af51 <cpunum>
+f010585e:	89 43 5c             	mov    %eax,0x5c(%ebx)
+f0105861:	8b 65 08             	mov    0x8(%ebp),%esp
+f0105864:	61                   	popa
+f0105865:	07                   	pop    %es
+f0105866:	1f                   	pop    %ds
+f0105867:	83 c4 08             	add    $0x8,%esp
+f010586a:	cf                   	iret
+f010586b:	83 ec 04             	sub    $0x4,%esp
+f010586e:	68 6b e6 10 f0       	push   $0xf010e66b
+f0105873:	68 e8 02 00 00       	push   $0x2e8
+f0105878:	68 26 e6 10 f0       	push   $0xf010e626
+f010587d:	e8 be a7 ff ff       	call   f0100040 <_panic>
+
+f0105882 <env_charge>:
+f0105882:	55                   	push   %ebp
+f0105883:	89 e5                	mov    %esp,%ebp
+f0105885:	57                   	push   %edi
+f0105886:	56                   	push   %esi
+f0105887:	83 ec 10             	sub    $0x10,%esp
+f010588a:	0f 31                	rdtsc
+f010588c:	89 c6                	mov    %eax,%esi
+f010588e:	89 d7                	mov    %edx,%edi
+f0105890:	e8 bc 56 00 00       	call   f010af51 <cpunum>
+f0105895:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010589b:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f01058a2:	0f 84 93 00 00 00    	je     f010593b <env_charge+0xb9>
+f01058a8:	e8 a4 56 00 00       	call   f010af51 <cpunum>
+f01058ad:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01058b3:	8b 90 b0 20 2d f0    	mov    -0xfd2df50(%eax),%edx
+f01058b9:	8b 80 ac 20 2d f0    	mov    -0xfd2df54(%eax),%eax
+f01058bf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f01058c2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+f01058c5:	e8 87 56 00 00       	call   f010af51 <cpunum>
+f01058ca:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01058d0:	8b 88 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%ecx
+f01058d6:	8b 81 dc 00 00 00    	mov    0xdc(%ecx),%eax
+f01058dc:	8b 91 e0 00 00 00    	mov    0xe0(%ecx),%edx
+f01058e2:	2b 45 f0             	sub    -0x10(%ebp),%eax
+f01058e5:	1b 55 f4             	sbb    -0xc(%ebp),%edx
+f01058e8:	01 f0                	add    %esi,%eax
+f01058ea:	11 fa                	adc    %edi,%edx
+f01058ec:	89 81 dc 00 00 00    	mov    %eax,0xdc(%ecx)
+f01058f2:	89 91 e0 00 00 00    	mov    %edx,0xe0(%ecx)
+f01058f8:	e8 54 56 00 00       	call   f010af51 <cpunum>
+f01058fd:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105903:	89 f2                	mov    %esi,%edx
+f0105905:	89 f9                	mov    %edi,%ecx
+f0105907:	2b 90 ac 20 2d f0    	sub    -0xfd2df54(%eax),%edx
+f010590d:	1b 88 b0 20 2d f0    	sbb    -0xfd2df50(%eax),%ecx
+f0105913:	89 55 f0             	mov    %edx,-0x10(%ebp)
+f0105916:	89 4d f4             	mov    %ecx,-0xc(%ebp)
+f0105919:	e8 33 56 00 00       	call   f010af51 <cpunum>
+f010591e:	83 ec 04             	sub    $0x4,%esp
+f0105921:	ff 75 f4             	push   -0xc(%ebp)
+f0105924:	ff 75 f0             	push   -0x10(%ebp)
+f0105927:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010592d:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0105933:	e8 76 1a 00 00       	call   f01073ae <sched_charge>
+f0105938:	83 c4 10             	add    $0x10,%esp
+f010593b:	e8 11 56 00 00       	call   f010af51 <cpunum>
+f0105940:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105946:	89 b0 ac 20 2d f0    	mov    %esi,-0xfd2df54(%eax)
+f010594c:	89 b8 b0 20 2d f0    	mov    %edi,-0xfd2df50(%eax)
+f0105952:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105955:	5e                   	pop    %esi
+f0105956:	5f                   	pop    %edi
+f0105957:	5d                   	pop    %ebp
+f0105958:	c3                   	ret
+
+f0105959 <env_run>:
+f0105959:	55                   	push   %ebp
+f010595a:	89 e5                	mov    %esp,%ebp
+f010595c:	56                   	push   %esi
+f010595d:	53                   	push   %ebx
+f010595e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0105961:	e8 1c ff ff ff       	call   f0105882 <env_charge>
+f0105966:	e8 e6 55 00 00       	call   f010af51 <cpunum>
+f010596b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105971:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0105978:	74 1d                	je     f0105997 <env_run+0x3e>
+f010597a:	e8 d2 55 00 00       	call   f010af51 <cpunum>
+f010597f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105985:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010598b:	8b 4b 48             	mov    0x48(%ebx),%ecx
+f010598e:	39 48 48             	cmp    %ecx,0x48(%eax)
+f0105991:	0f 84 fd 00 00 00    	je     f0105a94 <env_run+0x13b>
+f0105997:	e8 b5 55 00 00       	call   f010af51 <cpunum>
+f010599c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01059a2:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f01059a9:	74 1b                	je     f01059c6 <env_run+0x6d>
+f01059ab:	e8 a1 55 00 00       	call   f010af51 <cpunum>
+f01059b0:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01059b6:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01059bc:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01059c0:	0f 84 10 01 00 00    	je     f0105ad6 <env_run+0x17d>
+f01059c6:	e8 86 55 00 00       	call   f010af51 <cpunum>
+f01059cb:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01059d1:	be 00 00 00 00       	mov    $0x0,%esi
+f01059d6:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f01059dd:	74 14                	je     f01059f3 <env_run+0x9a>
+f01059df:	e8 6d 55 00 00       	call   f010af51 <cpunum>
+f01059e4:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01059ea:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01059f0:	8b 70 48             	mov    0x48(%eax),%esi
+f01059f3:	e8 59 55 00 00       	call   f010af51 <cpunum>
+f01059f8:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01059fe:	89 98 28 20 2d f0    	mov    %ebx,-0xfd2dfd8(%eax)
+f0105a04:	f6 05 a8 b4 32 f0 01 	testb  $0x1,0xf032b4a8
+f0105a0b:	0f 85 e2 00 00 00    	jne    f0105af3 <env_run+0x19a>
+f0105a11:	e8 3b 55 00 00       	call   f010af51 <cpunum>
+f0105a16:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105a1c:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0105a22:	c7 40 54 03 00 00 00 	movl   $0x3,0x54(%eax)
+f0105a29:	e8 23 55 00 00       	call   f010af51 <cpunum>
+f0105a2e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105a34:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0105a3a:	83 40 58 01          	addl   $0x1,0x58(%eax)
+f0105a3e:	e8 0e 55 00 00       	call   f010af51 <cpunum>
+f0105a43:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105a49:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0105a4f:	8b 40 78             	mov    0x78(%eax),%eax
+f0105a52:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0105a57:	0f 86 aa 00 00 00    	jbe    f0105b07 <env_run+0x1ae>
+f0105a5d:	05 00 00 00 10       	add    $0x10000000,%eax
+f0105a62:	0f 22 d8             	mov    %eax,%cr3
+f0105a65:	e8 e7 54 00 00       	call   f010af51 <cpunum>
+f0105a6a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105a70:	8b b0 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%esi
+f0105a76:	e8 d6 54 00 00       	call   f010af51 <cpunum>
+f0105a7b:	8b 56 78             	mov    0x78(%esi),%edx
+f0105a7e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105a84:	89 90 a0 20 2d f0    	mov    %edx,-0xfd2df60(%eax)
+f0105a8a:	83 7b 50 01          	cmpl   $0x1,0x50(%ebx)
+f0105a8e:	0f 85 88 00 00 00    	jne    f0105b1c <env_run+0x1c3>
+f0105a94:	e8 d1 c0 ff ff       	call   f0101b6a <tlb_shootdown>
+f0105a99:	e8 b3 54 00 00       	call   f010af51 <cpunum>
+f0105a9e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105aa4:	c7 80 a4 20 2d f0 00 	movl   $0x0,-0xfd2df5c(%eax)
+f0105aab:	00 00 00 
+f0105aae:	83 ec 0c             	sub    $0xc,%esp
+f0105ab1:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f0105ab6:	e8 44 59 00 00       	call   f010b3ff <spin_unlock>
+f0105abb:	f3 90                	pause
+f0105abd:	e8 8f 54 00 00       	call   f010af51 <cpunum>
+f0105ac2:	83 c4 04             	add    $0x4,%esp
+f0105ac5:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105acb:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0105ad1:	e8 6b fd ff ff       	call   f0105841 <env_pop_tf>
+f0105ad6:	e8 76 54 00 00       	call   f010af51 <cpunum>
+f0105adb:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105ae1:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0105ae7:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0105aee:	e9 d3 fe ff ff       	jmp    f01059c6 <env_run+0x6d>
+f0105af3:	6a 00                	push   $0x0
+f0105af5:	6a 00                	push   $0x0
+f0105af7:	56                   	push   %esi
+f0105af8:	6a 00                	push   $0x0
+f0105afa:	e8 88 70 00 00       	call   f010cb87 <trace_record>
+f0105aff:	83 c4 10             	add    $0x10,%esp
+f0105b02:	e9 0a ff ff ff       	jmp    f0105a11 <env_run+0xb8>
+f0105b07:	50                   	push   %eax
+f0105b08:	68 48 d0 10 f0       	push   $0xf010d048
+f0105b0d:	68 23 03 00 00       	push   $0x323
+f0105b12:	68 26 e6 10 f0       	push   $0xf010e626
+f0105b17:	e8 24 a5 ff ff       	call   f0100040 <_panic>
+f0105b1c:	e8 46 54 00 00       	call   f010af67 <lapic_timer_start>
+f0105b21:	e9 6e ff ff ff       	jmp    f0105a94 <env_run+0x13b>
+
+f0105b26 <mc146818_read>:
+f0105b26:	55                   	push   %ebp
+f0105b27:	89 e5                	mov    %esp,%ebp
+f0105b29:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105b2c:	ba 70 00 00 00       	mov    $0x70,%edx
+f0105b31:	ee                   	out    %al,(%dx)
+f0105b32:	ba 71 00 00 00       	mov    $0x71,%edx
+f0105b37:	ec                   	in     (%dx),%al
+f0105b38:	0f b6 c0             	movzbl %al,%eax
+f0105b3b:	5d                   	pop    %ebp
+f0105b3c:	c3                   	ret
+
+f0105b3d <mc146818_write>:
+f0105b3d:	55                   	push   %ebp
+f0105b3e:	89 e5                	mov    %esp,%ebp
+f0105b40:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105b43:	ba 70 00 00 00       	mov    $0x70,%edx
+f0105b48:	ee                   	out    %al,(%dx)
+f0105b49:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105b4c:	ba 71 00 00 00       	mov    $0x71,%edx
+f0105b51:	ee                   	out    %al,(%dx)
+f0105b52:	5d                   	pop    %ebp
+f0105b53:	c3                   	ret
+
+f0105b54 <pit_delay>:
+f0105b54:	55                   	push   %ebp
+f0105b55:	89 e5                	mov    %esp,%ebp
+f0105b57:	69 4d 08 a9 04 00 00 	imul   $0x4a9,0x8(%ebp),%ecx
+f0105b5e:	ba 61 00 00 00       	mov    $0x61,%edx
+f0105b63:	ec                   	in     (%dx),%al
+f0105b64:	83 e0 fc             	and    $0xfffffffc,%eax
+f0105b67:	83 c8 01             	or     $0x1,%eax
+f0105b6a:	ee                   	out    %al,(%dx)
+f0105b6b:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+f0105b70:	ba 43 00 00 00       	mov    $0x43,%edx
+f0105b75:	ee                   	out    %al,(%dx)
+f0105b76:	ba 42 00 00 00       	mov    $0x42,%edx
+f0105b7b:	89 c8                	mov    %ecx,%eax
+f0105b7d:	ee                   	out    %al,(%dx)
+f0105b7e:	89 c8                	mov    %ecx,%eax
+f0105b80:	c1 e8 08             	shr    $0x8,%eax
+f0105b83:	ee                   	out    %al,(%dx)
+f0105b84:	ba 61 00 00 00       	mov    $0x61,%edx
+f0105b89:	ec                   	in     (%dx),%al
+f0105b8a:	a8 20                	test   $0x20,%al
+f0105b8c:	74 fb                	je     f0105b89 <pit_delay+0x35>
+f0105b8e:	5d                   	pop    %ebp
+f0105b8f:	c3                   	ret
+
+f0105b90 <irq_setmask_8259A>:
+f0105b90:	55                   	push   %ebp
+f0105b91:	89 e5                	mov    %esp,%ebp
+f0105b93:	56                   	push   %esi
+f0105b94:	53                   	push   %ebx
+f0105b95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0105b98:	66 89 0d 88 a3 11 f0 	mov    %cx,0xf011a388
+f0105b9f:	83 3d a4 57 2b f0 00 	cmpl   $0x0,0xf02b57a4
+f0105ba6:	75 07                	jne    f0105baf <irq_setmask_8259A+0x1f>
+f0105ba8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105bab:	5b                   	pop    %ebx
+f0105bac:	5e                   	pop    %esi
+f0105bad:	5d                   	pop    %ebp
+f0105bae:	c3                   	ret
+f0105baf:	89 ce                	mov    %ecx,%esi
+f0105bb1:	ba 21 00 00 00       	mov    $0x21,%edx
+f0105bb6:	89 c8                	mov    %ecx,%eax
+f0105bb8:	ee                   	out    %al,(%dx)
+f0105bb9:	89 c8                	mov    %ecx,%eax
+f0105bbb:	66 c1 e8 08          	shr    $0x8,%ax
+f0105bbf:	ba a1 00 00 00       	mov    $0xa1,%edx
+f0105bc4:	ee                   	out    %al,(%dx)
+f0105bc5:	83 ec 0c             	sub    $0xc,%esp
+f0105bc8:	68 77 e6 10 f0       	push   $0xf010e677
+f0105bcd:	e8 35 01 00 00       	call   f0105d07 <cprintf>
+f0105bd2:	83 c4 10             	add    $0x10,%esp
+f0105bd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105bda:	0f b7 f6             	movzwl %si,%esi
+f0105bdd:	f7 d6                	not    %esi
+f0105bdf:	eb 08                	jmp    f0105be9 <irq_setmask_8259A+0x59>
+f0105be1:	83 c3 01             	add    $0x1,%ebx
+f0105be4:	83 fb 10             	cmp    $0x10,%ebx
+f0105be7:	74 18                	je     f0105c01 <irq_setmask_8259A+0x71>
+f0105be9:	0f a3 de             	bt     %ebx,%esi
+f0105bec:	73 f3                	jae    f0105be1 <irq_setmask_8259A+0x51>
+f0105bee:	83 ec 08             	sub    $0x8,%esp
+f0105bf1:	53                   	push   %ebx
+f0105bf2:	68 57 ec 10 f0       	push   $0xf010ec57
+f0105bf7:	e8 0b 01 00 00       	call   f0105d07 <cprintf>
+f0105bfc:	83 c4 10             	add    $0x10,%esp
+f0105bff:	eb e0                	jmp    f0105be1 <irq_setmask_8259A+0x51>
+f0105c01:	83 ec 0c             	sub    $0xc,%esp
+f0105c04:	68 0e e5 10 f0       	push   $0xf010e50e
+f0105c09:	e8 f9 00 00 00       	call   f0105d07 <cprintf>
+f0105c0e:	83 c4 10             	add    $0x10,%esp
+f0105c11:	eb 95                	jmp    f0105ba8 <irq_setmask_8259A+0x18>
+
+f0105c13 <pic_init>:
+f0105c13:	55                   	push   %ebp
+f0105c14:	89 e5                	mov    %esp,%ebp
+f0105c16:	57                   	push   %edi
+f0105c17:	56                   	push   %esi
+f0105c18:	53                   	push   %ebx
+f0105c19:	83 ec 0c             	sub    $0xc,%esp
+f0105c1c:	c7 05 a4 57 2b f0 01 	movl   $0x1,0xf02b57a4
+f0105c23:	00 00 00 
+f0105c26:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0105c2b:	bb 21 00 00 00       	mov    $0x21,%ebx
+f0105c30:	89 da                	mov    %ebx,%edx
+f0105c32:	ee                   	out    %al,(%dx)
+f0105c33:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f0105c38:	89 ca                	mov    %ecx,%edx
+f0105c3a:	ee                   	out    %al,(%dx)
+f0105c3b:	bf 11 00 00 00       	mov    $0x11,%edi
+f0105c40:	be 20 00 00 00       	mov    $0x20,%esi
+f0105c45:	89 f8                	mov    %edi,%eax
+f0105c47:	89 f2                	mov    %esi,%edx
+f0105c49:	ee                   	out    %al,(%dx)
+f0105c4a:	b8 20 00 00 00       	mov    $0x20,%eax
+f0105c4f:	89 da                	mov    %ebx,%edx
+f0105c51:	ee                   	out    %al,(%dx)
+f0105c52:	b8 04 00 00 00       	mov    $0x4,%eax
+f0105c57:	ee                   	out    %al,(%dx)
+f0105c58:	b8 03 00 00 00       	mov    $0x3,%eax
+f0105c5d:	ee                   	out    %al,(%dx)
+f0105c5e:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f0105c63:	89 f8                	mov    %edi,%eax
+f0105c65:	89 da                	mov    %ebx,%edx
+f0105c67:	ee                   	out    %al,(%dx)
+f0105c68:	b8 28 00 00 00       	mov    $0x28,%eax
+f0105c6d:	89 ca                	mov    %ecx,%edx
+f0105c6f:	ee                   	out    %al,(%dx)
+f0105c70:	b8 02 00 00 00       	mov    $0x2,%eax
+f0105c75:	ee                   	out    %al,(%dx)
+f0105c76:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105c7b:	ee                   	out    %al,(%dx)
+f0105c7c:	bf 68 00 00 00       	mov    $0x68,%edi
+f0105c81:	89 f8                	mov    %edi,%eax
+f0105c83:	89 f2                	mov    %esi,%edx
+f0105c85:	ee                   	out    %al,(%dx)
+f0105c86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f0105c8b:	89 c8                	mov    %ecx,%eax
+f0105c8d:	ee                   	out    %al,(%dx)
+f0105c8e:	89 f8                	mov    %edi,%eax
+f0105c90:	89 da                	mov    %ebx,%edx
+f0105c92:	ee                   	out    %al,(%dx)
+f0105c93:	89 c8                	mov    %ecx,%eax
+f0105c95:	ee                   	out    %al,(%dx)
+f0105c96:	0f b7 05 88 a3 11 f0 	movzwl 0xf011a388,%eax
+f0105c9d:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0105ca1:	75 08                	jne    f0105cab <pic_init+0x98>
+f0105ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105ca6:	5b                   	pop    %ebx
+f0105ca7:	5e                   	pop    %esi
+f0105ca8:	5f                   	pop    %edi
+f0105ca9:	5d                   	pop    %ebp
+f0105caa:	c3                   	ret
+f0105cab:	83 ec 0c             	sub    $0xc,%esp
+f0105cae:	0f b7 c0             	movzwl %ax,%eax
+f0105cb1:	50                   	push   %eax
+f0105cb2:	e8 d9 fe ff ff       	call   f0105b90 <irq_setmask_8259A>
+f0105cb7:	83 c4 10             	add    $0x10,%esp
+f0105cba:	eb e7                	jmp    f0105ca3 <pic_init+0x90>
+
+f0105cbc <irq_eoi>:
+f0105cbc:	b8 20 00 00 00       	mov    $0x20,%eax
+f0105cc1:	ba 20 00 00 00       	mov    $0x20,%edx
+f0105cc6:	ee                   	out    %al,(%dx)
+f0105cc7:	ba a0 00 00 00       	mov    $0xa0,%edx
+f0105ccc:	ee                   	out    %al,(%dx)
+f0105ccd:	c3                   	ret
+
+f0105cce <putch>:
+f0105cce:	55                   	push   %ebp
+f0105ccf:	89 e5                	mov    %esp,%ebp
+f0105cd1:	83 ec 14             	sub    $0x14,%esp
+f0105cd4:	ff 75 08             	push   0x8(%ebp)
+f0105cd7:	e8 70 ab ff ff       	call   f010084c <cputchar>
+f0105cdc:	83 c4 10             	add    $0x10,%esp
+f0105cdf:	c9                   	leave
+f0105ce0:	c3                   	ret
+
+f0105ce1 <vcprintf>:
+f0105ce1:	55                   	push   %ebp
+f0105ce2:	89 e5                	mov    %esp,%ebp
+f0105ce4:	83 ec 18             	sub    $0x18,%esp
+f0105ce7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+f0105cee:	ff 75 0c             	push   0xc(%ebp)
+f0105cf1:	ff 75 08             	push   0x8(%ebp)
+f0105cf4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0105cf7:	50                   	push   %eax
+f0105cf8:	68 ce 5c 10 f0       	push   $0xf0105cce
+f0105cfd:	e8 91 43 00 00       	call   f010a093 <vprintfmt>
+f0105d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105d05:	c9                   	leave
+f0105d06:	c3                   	ret
+
+f0105d07 <cprintf>:
+f0105d07:	55                   	push   %ebp
+f0105d08:	89 e5                	mov    %esp,%ebp
+f0105d0a:	83 ec 10             	sub    $0x10,%esp
+f0105d0d:	8d 45 0c             	lea    0xc(%ebp),%eax
+f0105d10:	50                   	push   %eax
+f0105d11:	ff 75 08             	push   0x8(%ebp)
+f0105d14:	e8 c8 ff ff ff       	call   f0105ce1 <vcprintf>
+f0105d19:	c9                   	leave
+f0105d1a:	c3                   	ret
+
+f0105d1b <trap_init_percpu>:
+f0105d1b:	55                   	push   %ebp
+f0105d1c:	89 e5                	mov    %esp,%ebp
+f0105d1e:	57                   	push   %edi
+f0105d1f:	56                   	push   %esi
+f0105d20:	53                   	push   %ebx
+f0105d21:	83 ec 0c             	sub    $0xc,%esp
+f0105d24:	e8 28 52 00 00       	call   f010af51 <cpunum>
+f0105d29:	89 c3                	mov    %eax,%ebx
+f0105d2b:	e8 21 52 00 00       	call   f010af51 <cpunum>
+f0105d30:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105d36:	c1 e3 10             	shl    $0x10,%ebx
+f0105d39:	ba 00 00 c0 ef       	mov    $0xefc00000,%edx
+f0105d3e:	29 da                	sub    %ebx,%edx
+f0105d40:	89 90 30 20 2d f0    	mov    %edx,-0xfd2dfd0(%eax)
+f0105d46:	e8 06 52 00 00       	call   f010af51 <cpunum>
+f0105d4b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105d51:	66 c7 80 34 20 2d f0 	movw   $0x10,-0xfd2dfcc(%eax)
+f0105d58:	10 00 
+f0105d5a:	e8 f2 51 00 00       	call   f010af51 <cpunum>
+f0105d5f:	8d 70 05             	lea    0x5(%eax),%esi
+f0105d62:	e8 ea 51 00 00       	call   f010af51 <cpunum>
+f0105d67:	89 c7                	mov    %eax,%edi
+f0105d69:	e8 e3 51 00 00       	call   f010af51 <cpunum>
+f0105d6e:	89 c3                	mov    %eax,%ebx
+f0105d70:	e8 dc 51 00 00       	call   f010af51 <cpunum>
+f0105d75:	66 c7 04 f5 20 a3 11 	movw   $0x68,-0xfee5ce0(,%esi,8)
+f0105d7c:	f0 68 00 
+f0105d7f:	69 ff 94 00 00 00    	imul   $0x94,%edi,%edi
+f0105d85:	81 c7 2c 20 2d f0    	add    $0xf02d202c,%edi
+f0105d8b:	66 89 3c f5 22 a3 11 	mov    %di,-0xfee5cde(,%esi,8)
+f0105d92:	f0 
+f0105d93:	69 db 94 00 00 00    	imul   $0x94,%ebx,%ebx
+f0105d99:	81 c3 2c 20 2d f0    	add    $0xf02d202c,%ebx
+f0105d9f:	c1 eb 10             	shr    $0x10,%ebx
+f0105da2:	88 1c f5 24 a3 11 f0 	mov    %bl,-0xfee5cdc(,%esi,8)
+f0105da9:	c6 04 f5 25 a3 11 f0 	movb   $0x99,-0xfee5cdb(,%esi,8)
+f0105db0:	99 
+f0105db1:	c6 04 f5 26 a3 11 f0 	movb   $0x40,-0xfee5cda(,%esi,8)
+f0105db8:	40 
+f0105db9:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105dbf:	05 2c 20 2d f0       	add    $0xf02d202c,%eax
+f0105dc4:	c1 e8 18             	shr    $0x18,%eax
+f0105dc7:	88 04 f5 27 a3 11 f0 	mov    %al,-0xfee5cd9(,%esi,8)
+f0105dce:	e8 7e 51 00 00       	call   f010af51 <cpunum>
+f0105dd3:	80 24 c5 4d a3 11 f0 	andb   $0xef,-0xfee5cb3(,%eax,8)
+f0105dda:	ef 
+f0105ddb:	e8 71 51 00 00       	call   f010af51 <cpunum>
+f0105de0:	8d 04 c5 28 00 00 00 	lea    0x28(,%eax,8),%eax
+f0105de7:	0f 00 d8             	ltr    %ax
+f0105dea:	b8 8c a3 11 f0       	mov    $0xf011a38c,%eax
+f0105def:	0f 01 18             	lidtl  (%eax)
+f0105df2:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105df7:	0f a2                	cpuid
+f0105df9:	f6 c6 08             	test   $0x8,%dh
+f0105dfc:	75 4d                	jne    f0105e4b <trap_init_percpu+0x130>
+f0105dfe:	a1 a0 b4 32 f0       	mov    0xf032b4a0,%eax
+f0105e03:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+f0105e07:	75 18                	jne    f0105e21 <trap_init_percpu+0x106>
+f0105e09:	e8 43 51 00 00       	call   f010af51 <cpunum>
+f0105e0e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105e14:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0105e19:	39 05 c0 24 2d f0    	cmp    %eax,0xf02d24c0
+f0105e1f:	75 16                	jne    f0105e37 <trap_init_percpu+0x11c>
+f0105e21:	e8 2b 51 00 00       	call   f010af51 <cpunum>
+f0105e26:	83 ec 08             	sub    $0x8,%esp
+f0105e29:	50                   	push   %eax
+f0105e2a:	68 8c e6 10 f0       	push   $0xf010e68c
+f0105e2f:	e8 d3 fe ff ff       	call   f0105d07 <cprintf>
+f0105e34:	83 c4 10             	add    $0x10,%esp
+f0105e37:	a1 a0 b4 32 f0       	mov    0xf032b4a0,%eax
+f0105e3c:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+f0105e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105e46:	5b                   	pop    %ebx
+f0105e47:	5e                   	pop    %esi
+f0105e48:	5f                   	pop    %edi
+f0105e49:	5d                   	pop    %ebp
+f0105e4a:	c3                   	ret
+f0105e4b:	b9 74 01 00 00       	mov    $0x174,%ecx
+f0105e50:	b8 08 00 00 00       	mov    $0x8,%eax
+f0105e55:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105e5a:	0f 30                	wrmsr
+f0105e5c:	e8 f0 50 00 00       	call   f010af51 <cpunum>
+f0105e61:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105e67:	8b 80 30 20 2d f0    	mov    -0xfd2dfd0(%eax),%eax
+f0105e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105e72:	b9 75 01 00 00       	mov    $0x175,%ecx
+f0105e77:	0f 30                	wrmsr
+f0105e79:	b9 76 01 00 00       	mov    $0x176,%ecx
+f0105e7e:	b8 82 6f 10 f0       	mov    $0xf0106f82,%eax
+f0105e83:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105e88:	0f 30                	wrmsr
+f0105e8a:	e8 c2 50 00 00       	call   f010af51 <cpunum>
+f0105e8f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0105e95:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0105e9a:	39 05 c0 24 2d f0    	cmp    %eax,0xf02d24c0
+f0105ea0:	75 a1                	jne    f0105e43 <trap_init_percpu+0x128>
+f0105ea2:	a1 a0 b4 32 f0       	mov    0xf032b4a0,%eax
+f0105ea7:	c7 40 10 01 00 00 00 	movl   $0x1,0x10(%eax)
+f0105eae:	eb 93                	jmp    f0105e43 <trap_init_percpu+0x128>
+
+f0105eb0 <trap_init>:
+f0105eb0:	55                   	push   %ebp
+f0105eb1:	89 e5                	mov    %esp,%ebp
+f0105eb3:	83 ec 08             	sub    $0x8,%esp
+f0105eb6:	b8 5a 6e 10 f0       	mov    $0xf0106e5a,%eax
+f0105ebb:	66 a3 c0 57 2b f0    	mov    %ax,0xf02b57c0
+f0105ec1:	66 c7 05 c2 57 2b f0 	movw   $0x8,0xf02b57c2
+f0105ec8:	08 00 
+f0105eca:	c6 05 c4 57 2b f0 00 	movb   $0x0,0xf02b57c4
+f0105ed1:	c6 05 c5 57 2b f0 8e 	movb   $0x8e,0xf02b57c5
+f0105ed8:	c1 e8 10             	shr    $0x10,%eax
+f0105edb:	66 a3 c6 57 2b f0    	mov    %ax,0xf02b57c6
+f0105ee1:	b8 64 6e 10 f0       	mov    $0xf0106e64,%eax
+f0105ee6:	66 a3 c8 57 2b f0    	mov    %ax,0xf02b57c8
+f0105eec:	66 c7 05 ca 57 2b f0 	movw   $0x8,0xf02b57ca
+f0105ef3:	08 00 
+f0105ef5:	c6 05 cc 57 2b f0 00 	movb   $0x0,0xf02b57cc
+f0105efc:	c6 05 cd 57 2b f0 8e 	movb   $0x8e,0xf02b57cd
+f0105f03:	c1 e8 10             	shr    $0x10,%eax
+f0105f06:	66 a3 ce 57 2b f0    	mov    %ax,0xf02b57ce
+f0105f0c:	b8 6e 6e 10 f0       	mov    $0xf0106e6e,%eax
+f0105f11:	66 a3 d0 57 2b f0    	mov    %ax,0xf02b57d0
+f0105f17:	66 c7 05 d2 57 2b f0 	movw   $0x8,0xf02b57d2
+f0105f1e:	08 00 
+f0105f20:	c6 05 d4 57 2b f0 00 	movb   $0x0,0xf02b57d4
+f0105f27:	c6 05 d5 57 2b f0 8e 	movb   $0x8e,0xf02b57d5
+f0105f2e:	c1 e8 10             	shr    $0x10,%eax
+f0105f31:	66 a3 d6 57 2b f0    	mov    %ax,0xf02b57d6
+f0105f37:	b8 78 6e 10 f0       	mov    $0xf0106e78,%eax
+f0105f3c:	66 a3 d8 57 2b f0    	mov    %ax,0xf02b57d8
+f0105f42:	66 c7 05 da 57 2b f0 	movw   $0x8,0xf02b57da
+f0105f49:	08 00 
+f0105f4b:	c6 05 dc 57 2b f0 00 	movb   $0x0,0xf02b57dc
+f0105f52:	c6 05 dd 57 2b f0 ee 	movb   $0xee,0xf02b57dd
+f0105f59:	c1 e8 10             	shr    $0x10,%eax
+f0105f5c:	66 a3 de 57 2b f0    	mov    %ax,0xf02b57de
+f0105f62:	b8 82 6e 10 f0       	mov    $0xf0106e82,%eax
+f0105f67:	66 a3 e0 57 2b f0    	mov    %ax,0xf02b57e0
+f0105f6d:	66 c7 05 e2 57 2b f0 	movw   $0x8,0xf02b57e2
+f0105f74:	08 00 
+f0105f76:	c6 05 e4 57 2b f0 00 	movb   $0x0,0xf02b57e4
+f0105f7d:	c6 05 e5 57 2b f0 8e 	movb   $0x8e,0xf02b57e5
+f0105f84:	c1 e8 10             	shr    $0x10,%eax
+f0105f87:	66 a3 e6 57 2b f0    	mov    %ax,0xf02b57e6
+f0105f8d:	b8 8c 6e 10 f0       	mov    $0xf0106e8c,%eax
+f0105f92:	66 a3 e8 57 2b f0    	mov    %ax,0xf02b57e8
+f0105f98:	66 c7 05 ea 57 2b f0 	movw   $0x8,0xf02b57ea
+f0105f9f:	08 00 
+f0105fa1:	c6 05 ec 57 2b f0 00 	movb   $0x0,0xf02b57ec
+f0105fa8:	c6 05 ed 57 2b f0 8e 	movb   $0x8e,0xf02b57ed
+f0105faf:	c1 e8 10             	shr    $0x10,%eax
+f0105fb2:	66 a3 ee 57 2b f0    	mov    %ax,0xf02b57ee
+f0105fb8:	b8 96 6e 10 f0       	mov    $0xf0106e96,%eax
+f0105fbd:	66 a3 f0 57 2b f0    	mov    %ax,0xf02b57f0
+f0105fc3:	66 c7 05 f2 57 2b f0 	movw   $0x8,0xf02b57f2
+f0105fca:	08 00 
+f0105fcc:	c6 05 f4 57 2b f0 00 	movb   $0x0,0xf02b57f4
+f0105fd3:	c6 05 f5 57 2b f0 8e 	movb   $0x8e,0xf02b57f5
+f0105fda:	c1 e8 10             	shr    $0x10,%eax
+f0105fdd:	66 a3 f6 57 2b f0    	mov    %ax,0xf02b57f6
+f0105fe3:	b8 a0 6e 10 f0       	mov    $0xf0106ea0,%eax
+f0105fe8:	66 a3 f8 57 2b f0    	mov    %ax,0xf02b57f8
+f0105fee:	66 c7 05 fa 57 2b f0 	movw   $0x8,0xf02b57fa
+f0105ff5:	08 00 
+f0105ff7:	c6 05 fc 57 2b f0 00 	movb   $0x0,0xf02b57fc
+f0105ffe:	c6 05 fd 57 2b f0 8e 	movb   $0x8e,0xf02b57fd
+f0106005:	c1 e8 10             	shr    $0x10,%eax
+f0106008:	66 a3 fe 57 2b f0    	mov    %ax,0xf02b57fe
+f010600e:	b8 aa 6e 10 f0       	mov    $0xf0106eaa,%eax
+f0106013:	66 a3 00 58 2b f0    	mov    %ax,0xf02b5800
+f0106019:	66 c7 05 02 58 2b f0 	movw   $0x8,0xf02b5802
+f0106020:	08 00 
+f0106022:	c6 05 04 58 2b f0 00 	movb   $0x0,0xf02b5804
+f0106029:	c6 05 05 58 2b f0 8e 	movb   $0x8e,0xf02b5805
+f0106030:	c1 e8 10             	shr    $0x10,%eax
+f0106033:	66 a3 06 58 2b f0    	mov    %ax,0xf02b5806
+f0106039:	b8 b2 6e 10 f0       	mov    $0xf0106eb2,%eax
+f010603e:	66 a3 10 58 2b f0    	mov    %ax,0xf02b5810
+f0106044:	66 c7 05 12 58 2b f0 	movw   $0x8,0xf02b5812
+f010604b:	08 00 
+f010604d:	c6 05 14 58 2b f0 00 	movb   $0x0,0xf02b5814
+f0106054:	c6 05 15 58 2b f0 8e 	movb   $0x8e,0xf02b5815
+f010605b:	c1 e8 10             	shr    $0x10,%eax
+f010605e:	66 a3 16 58 2b f0    	mov    %ax,0xf02b5816
+f0106064:	b8 ba 6e 10 f0       	mov    $0xf0106eba,%eax
+f0106069:	66 a3 18 58 2b f0    	mov    %ax,0xf02b5818
+f010606f:	66 c7 05 1a 58 2b f0 	movw   $0x8,0xf02b581a
+f0106076:	08 00 
+f0106078:	c6 05 1c 58 2b f0 00 	movb   $0x0,0xf02b581c
+f010607f:	c6 05 1d 58 2b f0 8e 	movb   $0x8e,0xf02b581d
+f0106086:	c1 e8 10             	shr    $0x10,%eax
+f0106089:	66 a3 1e 58 2b f0    	mov    %ax,0xf02b581e
+f010608f:	b8 c2 6e 10 f0       	mov    $0xf0106ec2,%eax
+f0106094:	66 a3 20 58 2b f0    	mov    %ax,0xf02b5820
+f010609a:	66 c7 05 22 58 2b f0 	movw   $0x8,0xf02b5822
+f01060a1:	08 00 
+f01060a3:	c6 05 24 58 2b f0 00 	movb   $0x0,0xf02b5824
+f01060aa:	c6 05 25 58 2b f0 8e 	movb   $0x8e,0xf02b5825
+f01060b1:	c1 e8 10             	shr    $0x10,%eax
+f01060b4:	66 a3 26 58 2b f0    	mov    %ax,0xf02b5826
+f01060ba:	b8 ca 6e 10 f0       	mov    $0xf0106eca,%eax
+f01060bf:	66 a3 28 58 2b f0    	mov    %ax,0xf02b5828
+f01060c5:	66 c7 05 2a 58 2b f0 	movw   $0x8,0xf02b582a
+f01060cc:	08 00 
+f01060ce:	c6 05 2c 58 2b f0 00 	movb   $0x0,0xf02b582c
+f01060d5:	c6 05 2d 58 2b f0 8e 	movb   $0x8e,0xf02b582d
+f01060dc:	c1 e8 10             	shr    $0x10,%eax
+f01060df:	66 a3 2e 58 2b f0    	mov    %ax,0xf02b582e
+f01060e5:	b8 d2 6e 10 f0       	mov    $0xf0106ed2,%eax
+f01060ea:	66 a3 30 58 2b f0    	mov    %ax,0xf02b5830
+f01060f0:	66 c7 05 32 58 2b f0 	movw   $0x8,0xf02b5832
+f01060f7:	08 00 
+f01060f9:	c6 05 34 58 2b f0 00 	movb   $0x0,0xf02b5834
+f0106100:	c6 05 35 58 2b f0 8e 	movb   $0x8e,0xf02b5835
+f0106107:	c1 e8 10             	shr    $0x10,%eax
+f010610a:	66 a3 36 58 2b f0    	mov    %ax,0xf02b5836
+f0106110:	b8 da 6e 10 f0       	mov    $0xf0106eda,%eax
+f0106115:	66 a3 40 58 2b f0    	mov    %ax,0xf02b5840
+f010611b:	66 c7 05 42 58 2b f0 	movw   $0x8,0xf02b5842
+f0106122:	08 00 
+f0106124:	c6 05 44 58 2b f0 00 	movb   $0x0,0xf02b5844
+f010612b:	c6 05 45 58 2b f0 8e 	movb   $0x8e,0xf02b5845
+f0106132:	c1 e8 10             	shr    $0x10,%eax
+f0106135:	66 a3 46 58 2b f0    	mov    %ax,0xf02b5846
+f010613b:	b8 e4 6e 10 f0       	mov    $0xf0106ee4,%eax
+f0106140:	66 a3 48 58 2b f0    	mov    %ax,0xf02b5848
+f0106146:	66 c7 05 4a 58 2b f0 	movw   $0x8,0xf02b584a
+f010614d:	08 00 
+f010614f:	c6 05 4c 58 2b f0 00 	movb   $0x0,0xf02b584c
+f0106156:	c6 05 4d 58 2b f0 8e 	movb   $0x8e,0xf02b584d
+f010615d:	c1 e8 10             	shr    $0x10,%eax
+f0106160:	66 a3 4e 58 2b f0    	mov    %ax,0xf02b584e
+f0106166:	b8 e8 6e 10 f0       	mov    $0xf0106ee8,%eax
+f010616b:	66 a3 50 58 2b f0    	mov    %ax,0xf02b5850
+f0106171:	66 c7 05 52 58 2b f0 	movw   $0x8,0xf02b5852
+f0106178:	08 00 
+f010617a:	c6 05 54 58 2b f0 00 	movb   $0x0,0xf02b5854
+f0106181:	c6 05 55 58 2b f0 8e 	movb   $0x8e,0xf02b5855
+f0106188:	c1 e8 10             	shr    $0x10,%eax
+f010618b:	66 a3 56 58 2b f0    	mov    %ax,0xf02b5856
+f0106191:	b8 ee 6e 10 f0       	mov    $0xf0106eee,%eax
+f0106196:	66 a3 58 58 2b f0    	mov    %ax,0xf02b5858
+f010619c:	66 c7 05 5a 58 2b f0 	movw   $0x8,0xf02b585a
+f01061a3:	08 00 
+f01061a5:	c6 05 5c 58 2b f0 00 	movb   $0x0,0xf02b585c
+f01061ac:	c6 05 5d 58 2b f0 8e 	movb   $0x8e,0xf02b585d
+f01061b3:	c1 e8 10             	shr    $0x10,%eax
+f01061b6:	66 a3 5e 58 2b f0    	mov    %ax,0xf02b585e
+f01061bc:	b8 f4 6e 10 f0       	mov    $0xf0106ef4,%eax
+f01061c1:	66 a3 40 59 2b f0    	mov    %ax,0xf02b5940
+f01061c7:	66 c7 05 42 59 2b f0 	movw   $0x8,0xf02b5942
+f01061ce:	08 00 
+f01061d0:	c6 05 44 59 2b f0 00 	movb   $0x0,0xf02b5944
+f01061d7:	c6 05 45 59 2b f0 ee 	movb   $0xee,0xf02b5945
+f01061de:	c1 e8 10             	shr    $0x10,%eax
+f01061e1:	66 a3 46 59 2b f0    	mov    %ax,0xf02b5946
+f01061e7:	b8 fa 6e 10 f0       	mov    $0xf0106efa,%eax
+f01061ec:	66 a3 c0 58 2b f0    	mov    %ax,0xf02b58c0
+f01061f2:	66 c7 05 c2 58 2b f0 	movw   $0x8,0xf02b58c2
+f01061f9:	08 00 
+f01061fb:	c6 05 c4 58 2b f0 00 	movb   $0x0,0xf02b58c4
+f0106202:	c6 05 c5 58 2b f0 8e 	movb   $0x8e,0xf02b58c5
+f0106209:	c1 e8 10             	shr    $0x10,%eax
+f010620c:	66 a3 c6 58 2b f0    	mov    %ax,0xf02b58c6
+f0106212:	b8 00 6f 10 f0       	mov    $0xf0106f00,%eax
+f0106217:	66 a3 c8 58 2b f0    	mov    %ax,0xf02b58c8
+f010621d:	66 c7 05 ca 58 2b f0 	movw   $0x8,0xf02b58ca
+f0106224:	08 00 
+f0106226:	c6 05 cc 58 2b f0 00 	movb   $0x0,0xf02b58cc
+f010622d:	c6 05 cd 58 2b f0 8e 	movb   $0x8e,0xf02b58cd
+f0106234:	c1 e8 10             	shr    $0x10,%eax
+f0106237:	66 a3 ce 58 2b f0    	mov    %ax,0xf02b58ce
+f010623d:	b8 06 6f 10 f0       	mov    $0xf0106f06,%eax
+f0106242:	66 a3 d0 58 2b f0    	mov    %ax,0xf02b58d0
+f0106248:	66 c7 05 d2 58 2b f0 	movw   $0x8,0xf02b58d2
+f010624f:	08 00 
+f0106251:	c6 05 d4 58 2b f0 00 	movb   $0x0,0xf02b58d4
+f0106258:	c6 05 d5 58 2b f0 8e 	movb   $0x8e,0xf02b58d5
+f010625f:	c1 e8 10             	shr    $0x10,%eax
+f0106262:	66 a3 d6 58 2b f0    	mov    %ax,0xf02b58d6
+f0106268:	b8 0c 6f 10 f0       	mov    $0xf0106f0c,%eax
+f010626d:	66 a3 d8 58 2b f0    	mov    %ax,0xf02b58d8
+f0106273:	66 c7 05 da 58 2b f0 	movw   $0x8,0xf02b58da
+f010627a:	08 00 
+f010627c:	c6 05 dc 58 2b f0 00 	movb   $0x0,0xf02b58dc
+f0106283:	c6 05 dd 58 2b f0 8e 	movb   $0x8e,0xf02b58dd
+f010628a:	c1 e8 10             	shr    $0x10,%eax
+f010628d:	66 a3 de 58 2b f0    	mov    %ax,0xf02b58de
+f0106293:	b8 12 6f 10 f0       	mov    $0xf0106f12,%eax
+f0106298:	66 a3 e0 58 2b f0    	mov    %ax,0xf02b58e0
+f010629e:	66 c7 05 e2 58 2b f0 	movw   $0x8,0xf02b58e2
+f01062a5:	08 00 
+f01062a7:	c6 05 e4 58 2b f0 00 	movb   $0x0,0xf02b58e4
+f01062ae:	c6 05 e5 58 2b f0 8e 	movb   $0x8e,0xf02b58e5
+f01062b5:	c1 e8 10             	shr    $0x10,%eax
+f01062b8:	66 a3 e6 58 2b f0    	mov    %ax,0xf02b58e6
+f01062be:	b8 18 6f 10 f0       	mov    $0xf0106f18,%eax
+f01062c3:	66 a3 e8 58 2b f0    	mov    %ax,0xf02b58e8
+f01062c9:	66 c7 05 ea 58 2b f0 	movw   $0x8,0xf02b58ea
+f01062d0:	08 00 
+f01062d2:	c6 05 ec 58 2b f0 00 	movb   $0x0,0xf02b58ec
+f01062d9:	c6 05 ed 58 2b f0 8e 	movb   $0x8e,0xf02b58ed
+f01062e0:	c1 e8 10             	shr    $0x10,%eax
+f01062e3:	66 a3 ee 58 2b f0    	mov    %ax,0xf02b58ee
+f01062e9:	b8 1e 6f 10 f0       	mov    $0xf0106f1e,%eax
+f01062ee:	66 a3 f0 58 2b f0    	mov    %ax,0xf02b58f0
+f01062f4:	66 c7 05 f2 58 2b f0 	movw   $0x8,0xf02b58f2
+f01062fb:	08 00 
+f01062fd:	c6 05 f4 58 2b f0 00 	movb   $0x0,0xf02b58f4
+f0106304:	c6 05 f5 58 2b f0 8e 	movb   $0x8e,0xf02b58f5
+f010630b:	c1 e8 10             	shr    $0x10,%eax
+f010630e:	66 a3 f6 58 2b f0    	mov    %ax,0xf02b58f6
+f0106314:	b8 24 6f 10 f0       	mov    $0xf0106f24,%eax
+f0106319:	66 a3 f8 58 2b f0    	mov    %ax,0xf02b58f8
+f010631f:	66 c7 05 fa 58 2b f0 	movw   $0x8,0xf02b58fa
+f0106326:	08 00 
+f0106328:	c6 05 fc 58 2b f0 00 	movb   $0x0,0xf02b58fc
+f010632f:	c6 05 fd 58 2b f0 8e 	movb   $0x8e,0xf02b58fd
+f0106336:	c1 e8 10             	shr    $0x10,%eax
+f0106339:	66 a3 fe 58 2b f0    	mov    %ax,0xf02b58fe
+f010633f:	b8 2a 6f 10 f0       	mov    $0xf0106f2a,%eax
+f0106344:	66 a3 00 59 2b f0    	mov    %ax,0xf02b5900
+f010634a:	66 c7 05 02 59 2b f0 	movw   $0x8,0xf02b5902
+f0106351:	08 00 
+f0106353:	c6 05 04 59 2b f0 00 	movb   $0x0,0xf02b5904
+f010635a:	c6 05 05 59 2b f0 8e 	movb   $0x8e,0xf02b5905
+f0106361:	c1 e8 10             	shr    $0x10,%eax
+f0106364:	66 a3 06 59 2b f0    	mov    %ax,0xf02b5906
+f010636a:	b8 30 6f 10 f0       	mov    $0xf0106f30,%eax
+f010636f:	66 a3 08 59 2b f0    	mov    %ax,0xf02b5908
+f0106375:	66 c7 05 0a 59 2b f0 	movw   $0x8,0xf02b590a
+f010637c:	08 00 
+f010637e:	c6 05 0c 59 2b f0 00 	movb   $0x0,0xf02b590c
+f0106385:	c6 05 0d 59 2b f0 8e 	movb   $0x8e,0xf02b590d
+f010638c:	c1 e8 10             	shr    $0x10,%eax
+f010638f:	66 a3 0e 59 2b f0    	mov    %ax,0xf02b590e
+f0106395:	b8 36 6f 10 f0       	mov    $0xf0106f36,%eax
+f010639a:	66 a3 10 59 2b f0    	mov    %ax,0xf02b5910
+f01063a0:	66 c7 05 12 59 2b f0 	movw   $0x8,0xf02b5912
+f01063a7:	08 00 
+f01063a9:	c6 05 14 59 2b f0 00 	movb   $0x0,0xf02b5914
+f01063b0:	c6 05 15 59 2b f0 8e 	movb   $0x8e,0xf02b5915
+f01063b7:	c1 e8 10             	shr    $0x10,%eax
+f01063ba:	66 a3 16 59 2b f0    	mov    %ax,0xf02b5916
+f01063c0:	b8 3c 6f 10 f0       	mov    $0xf0106f3c,%eax
+f01063c5:	66 a3 18 59 2b f0    	mov    %ax,0xf02b5918
+f01063cb:	66 c7 05 1a 59 2b f0 	movw   $0x8,0xf02b591a
+f01063d2:	08 00 
+f01063d4:	c6 05 1c 59 2b f0 00 	movb   $0x0,0xf02b591c
+f01063db:	c6 05 1d 59 2b f0 8e 	movb   $0x8e,0xf02b591d
+f01063e2:	c1 e8 10             	shr    $0x10,%eax
+f01063e5:	66 a3 1e 59 2b f0    	mov    %ax,0xf02b591e
+f01063eb:	b8 42 6f 10 f0       	mov    $0xf0106f42,%eax
+f01063f0:	66 a3 20 59 2b f0    	mov    %ax,0xf02b5920
+f01063f6:	66 c7 05 22 59 2b f0 	movw   $0x8,0xf02b5922
+f01063fd:	08 00 
+f01063ff:	c6 05 24 59 2b f0 00 	movb   $0x0,0xf02b5924
+f0106406:	c6 05 25 59 2b f0 8e 	movb   $0x8e,0xf02b5925
+f010640d:	c1 e8 10             	shr    $0x10,%eax
+f0106410:	66 a3 26 59 2b f0    	mov    %ax,0xf02b5926
+f0106416:	b8 48 6f 10 f0       	mov    $0xf0106f48,%eax
+f010641b:	66 a3 28 59 2b f0    	mov    %ax,0xf02b5928
+f0106421:	66 c7 05 2a 59 2b f0 	movw   $0x8,0xf02b592a
+f0106428:	08 00 
+f010642a:	c6 05 2c 59 2b f0 00 	movb   $0x0,0xf02b592c
+f0106431:	c6 05 2d 59 2b f0 8e 	movb   $0x8e,0xf02b592d
+f0106438:	c1 e8 10             	shr    $0x10,%eax
+f010643b:	66 a3 2e 59 2b f0    	mov    %ax,0xf02b592e
+f0106441:	b8 4e 6f 10 f0       	mov    $0xf0106f4e,%eax
+f0106446:	66 a3 30 59 2b f0    	mov    %ax,0xf02b5930
+f010644c:	66 c7 05 32 59 2b f0 	movw   $0x8,0xf02b5932
+f0106453:	08 00 
+f0106455:	c6 05 34 59 2b f0 00 	movb   $0x0,0xf02b5934
+f010645c:	c6 05 35 59 2b f0 8e 	movb   $0x8e,0xf02b5935
+f0106463:	c1 e8 10             	shr    $0x10,%eax
+f0106466:	66 a3 36 59 2b f0    	mov    %ax,0xf02b5936
+f010646c:	b8 54 6f 10 f0       	mov    $0xf0106f54,%eax
+f0106471:	66 a3 38 59 2b f0    	mov    %ax,0xf02b5938
+f0106477:	66 c7 05 3a 59 2b f0 	movw   $0x8,0xf02b593a
+f010647e:	08 00 
+f0106480:	c6 05 3c 59 2b f0 00 	movb   $0x0,0xf02b593c
+f0106487:	c6 05 3d 59 2b f0 8e 	movb   $0x8e,0xf02b593d
+f010648e:	c1 e8 10             	shr    $0x10,%eax
+f0106491:	66 a3 3e 59 2b f0    	mov    %ax,0xf02b593e
+f0106497:	b8 5a 6f 10 f0       	mov    $0xf0106f5a,%eax
+f010649c:	66 a3 60 59 2b f0    	mov    %ax,0xf02b5960
+f01064a2:	66 c7 05 62 59 2b f0 	movw   $0x8,0xf02b5962
+f01064a9:	08 00 
+f01064ab:	c6 05 64 59 2b f0 00 	movb   $0x0,0xf02b5964
+f01064b2:	c6 05 65 59 2b f0 8e 	movb   $0x8e,0xf02b5965
+f01064b9:	c1 e8 10             	shr    $0x10,%eax
+f01064bc:	66 a3 66 59 2b f0    	mov    %ax,0xf02b5966
+f01064c2:	b8 60 6f 10 f0       	mov    $0xf0106f60,%eax
+f01064c7:	66 a3 68 59 2b f0    	mov    %ax,0xf02b5968
+f01064cd:	66 c7 05 6a 59 2b f0 	movw   $0x8,0xf02b596a
+f01064d4:	08 00 
+f01064d6:	c6 05 6c 59 2b f0 00 	movb   $0x0,0xf02b596c
+f01064dd:	c6 05 6d 59 2b f0 8e 	movb   $0x8e,0xf02b596d
+f01064e4:	c1 e8 10             	shr    $0x10,%eax
+f01064e7:	66 a3 6e 59 2b f0    	mov    %ax,0xf02b596e
+f01064ed:	e8 29 f8 ff ff       	call   f0105d1b <trap_init_percpu>
+f01064f2:	c9                   	leave
+f01064f3:	c3                   	ret
+
+f01064f4 <print_regs>:
+f01064f4:	55                   	push   %ebp
+f01064f5:	89 e5                	mov    %esp,%ebp
+f01064f7:	53                   	push   %ebx
+f01064f8:	83 ec 0c             	sub    $0xc,%esp
+f01064fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01064fe:	ff 33                	push   (%ebx)
+f0106500:	68 0b e7 10 f0       	push   $0xf010e70b
+f0106505:	e8 fd f7 ff ff       	call   f0105d07 <cprintf>
+f010650a:	83 c4 08             	add    $0x8,%esp
+f010650d:	ff 73 04             	push   0x4(%ebx)
+f0106510:	68 1a e7 10 f0       	push   $0xf010e71a
+f0106515:	e8 ed f7 ff ff       	call   f0105d07 <cprintf>
+f010651a:	83 c4 08             	add    $0x8,%esp
+f010651d:	ff 73 08             	push   0x8(%ebx)
+f0106520:	68 29 e7 10 f0       	push   $0xf010e729
+f0106525:	e8 dd f7 ff ff       	call   f0105d07 <cprintf>
+f010652a:	83 c4 08             	add    $0x8,%esp
+f010652d:	ff 73 0c             	push   0xc(%ebx)
+f0106530:	68 38 e7 10 f0       	push   $0xf010e738
+f0106535:	e8 cd f7 ff ff       	call   f0105d07 <cprintf>
+f010653a:	83 c4 08             	add    $0x8,%esp
+f010653d:	ff 73 10             	push   0x10(%ebx)
+f0106540:	68 47 e7 10 f0       	push   $0xf010e747
+f0106545:	e8 bd f7 ff ff       	call   f0105d07 <cprintf>
+f010654a:	83 c4 08             	add    $0x8,%esp
+f010654d:	ff 73 14             	push   0x14(%ebx)
+f0106550:	68 56 e7 10 f0       	push   $0xf010e756
+f0106555:	e8 ad f7 ff ff       	call   f0105d07 <cprintf>
+f010655a:	83 c4 08             	add    $0x8,%esp
+f010655d:	ff 73 18             	push   0x18(%ebx)
+f0106560:	68 65 e7 10 f0       	push   $0xf010e765
+f0106565:	e8 9d f7 ff ff       	call   f0105d07 <cprintf>
+f010656a:	83 c4 08             	add    $0x8,%esp
+f010656d:	ff 73 1c             	push   0x1c(%ebx)
+f0106570:	68 74 e7 10 f0       	push   $0xf010e774
+f0106575:	e8 8d f7 ff ff       	call   f0105d07 <cprintf>
+f010657a:	83 c4 10             	add    $0x10,%esp
+f010657d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106580:	c9                   	leave
+f0106581:	c3                   	ret
+
+f0106582 <print_trapframe>:
+f0106582:	55                   	push   %ebp
+f0106583:	89 e5                	mov    %esp,%ebp
+f0106585:	56                   	push   %esi
+f0106586:	53                   	push   %ebx
+f0106587:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010658a:	e8 c2 49 00 00       	call   f010af51 <cpunum>
+f010658f:	83 ec 04             	sub    $0x4,%esp
+f0106592:	50                   	push   %eax
+f0106593:	53                   	push   %ebx
+f0106594:	68 d8 e7 10 f0       	push   $0xf010e7d8
+f0106599:	e8 69 f7 ff ff       	call   f0105d07 <cprintf>
+f010659e:	89 1c 24             	mov    %ebx,(%esp)
+f01065a1:	e8 4e ff ff ff       	call   f01064f4 <print_regs>
+f01065a6:	83 c4 08             	add    $0x8,%esp
+f01065a9:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f01065ad:	50                   	push   %eax
+f01065ae:	68 f6 e7 10 f0       	push   $0xf010e7f6
+f01065b3:	e8 4f f7 ff ff       	call   f0105d07 <cprintf>
+f01065b8:	83 c4 08             	add    $0x8,%esp
+f01065bb:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f01065bf:	50                   	push   %eax
+f01065c0:	68 09 e8 10 f0       	push   $0xf010e809
+f01065c5:	e8 3d f7 ff ff       	call   f0105d07 <cprintf>
+f01065ca:	8b 43 28             	mov    0x28(%ebx),%eax
+f01065cd:	83 c4 10             	add    $0x10,%esp
+f01065d0:	83 f8 13             	cmp    $0x13,%eax
+f01065d3:	0f 86 da 00 00 00    	jbe    f01066b3 <print_trapframe+0x131>
+f01065d9:	ba 83 e7 10 f0       	mov    $0xf010e783,%edx
+f01065de:	83 f8 30             	cmp    $0x30,%eax
+f01065e1:	74 13                	je     f01065f6 <print_trapframe+0x74>
+f01065e3:	8d 50 e0             	lea    -0x20(%eax),%edx
+f01065e6:	83 fa 10             	cmp    $0x10,%edx
+f01065e9:	ba 9e e7 10 f0       	mov    $0xf010e79e,%edx
+f01065ee:	b9 8f e7 10 f0       	mov    $0xf010e78f,%ecx
+f01065f3:	0f 43 d1             	cmovae %ecx,%edx
+f01065f6:	83 ec 04             	sub    $0x4,%esp
+f01065f9:	52                   	push   %edx
+f01065fa:	50                   	push   %eax
+f01065fb:	68 1c e8 10 f0       	push   $0xf010e81c
+f0106600:	e8 02 f7 ff ff       	call   f0105d07 <cprintf>
+f0106605:	83 c4 10             	add    $0x10,%esp
+f0106608:	39 1d c0 5f 2b f0    	cmp    %ebx,0xf02b5fc0
+f010660e:	0f 84 ab 00 00 00    	je     f01066bf <print_trapframe+0x13d>
+f0106614:	83 ec 08             	sub    $0x8,%esp
+f0106617:	ff 73 2c             	push   0x2c(%ebx)
+f010661a:	68 3d e8 10 f0       	push   $0xf010e83d
+f010661f:	e8 e3 f6 ff ff       	call   f0105d07 <cprintf>
+f0106624:	83 c4 10             	add    $0x10,%esp
+f0106627:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f010662b:	0f 85 b1 00 00 00    	jne    f01066e2 <print_trapframe+0x160>
+f0106631:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f0106634:	a8 01                	test   $0x1,%al
+f0106636:	b9 bc e7 10 f0       	mov    $0xf010e7bc,%ecx
+f010663b:	ba b1 e7 10 f0       	mov    $0xf010e7b1,%edx
+f0106640:	0f 45 ca             	cmovne %edx,%ecx
+f0106643:	a8 02                	test   $0x2,%al
+f0106645:	ba ce e7 10 f0       	mov    $0xf010e7ce,%edx
+f010664a:	be c8 e7 10 f0       	mov    $0xf010e7c8,%esi
+f010664f:	0f 45 d6             	cmovne %esi,%edx
+f0106652:	a8 04                	test   $0x4,%al
+f0106654:	b8 08 e9 10 f0       	mov    $0xf010e908,%eax
+f0106659:	be d3 e7 10 f0       	mov    $0xf010e7d3,%esi
+f010665e:	0f 45 c6             	cmovne %esi,%eax
+f0106661:	51                   	push   %ecx
+f0106662:	52                   	push   %edx
+f0106663:	50                   	push   %eax
+f0106664:	68 4b e8 10 f0       	push   $0xf010e84b
+f0106669:	e8 99 f6 ff ff       	call   f0105d07 <cprintf>
+f010666e:	83 c4 10             	add    $0x10,%esp
+f0106671:	83 ec 08             	sub    $0x8,%esp
+f0106674:	ff 73 30             	push   0x30(%ebx)
+f0106677:	68 5a e8 10 f0       	push   $0xf010e85a
+f010667c:	e8 86 f6 ff ff       	call   f0105d07 <cprintf>
+f0106681:	83 c4 08             	add    $0x8,%esp
+f0106684:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0106688:	50                   	push   %eax
+f0106689:	68 69 e8 10 f0       	push   $0xf010e869
+f010668e:	e8 74 f6 ff ff       	call   f0105d07 <cprintf>
+f0106693:	83 c4 08             	add    $0x8,%esp
+f0106696:	ff 73 38             	push   0x38(%ebx)
+f0106699:	68 7c e8 10 f0       	push   $0xf010e87c
+f010669e:	e8 64 f6 ff ff       	call   f0105d07 <cprintf>
+f01066a3:	83 c4 10             	add    $0x10,%esp
+f01066a6:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f01066aa:	75 4b                	jne    f01066f7 <print_trapframe+0x175>
+f01066ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01066af:	5b                   	pop    %ebx
+f01066b0:	5e                   	pop    %esi
+f01066b1:	5d                   	pop    %ebp
+f01066b2:	c3                   	ret
+f01066b3:	8b 14 85 60 ea 10 f0 	mov    -0xfef15a0(,%eax,4),%edx
+f01066ba:	e9 37 ff ff ff       	jmp    f01065f6 <print_trapframe+0x74>
+f01066bf:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f01066c3:	0f 85 4b ff ff ff    	jne    f0106614 <print_trapframe+0x92>
+f01066c9:	0f 20 d0             	mov    %cr2,%eax
+f01066cc:	83 ec 08             	sub    $0x8,%esp
+f01066cf:	50                   	push   %eax
+f01066d0:	68 2e e8 10 f0       	push   $0xf010e82e
+f01066d5:	e8 2d f6 ff ff       	call   f0105d07 <cprintf>
+f01066da:	83 c4 10             	add    $0x10,%esp
+f01066dd:	e9 32 ff ff ff       	jmp    f0106614 <print_trapframe+0x92>
+f01066e2:	83 ec 0c             	sub    $0xc,%esp
+f01066e5:	68 0e e5 10 f0       	push   $0xf010e50e
+f01066ea:	e8 18 f6 ff ff       	call   f0105d07 <cprintf>
+f01066ef:	83 c4 10             	add    $0x10,%esp
+f01066f2:	e9 7a ff ff ff       	jmp    f0106671 <print_trapframe+0xef>
+f01066f7:	83 ec 08             	sub    $0x8,%esp
+f01066fa:	ff 73 3c             	push   0x3c(%ebx)
+f01066fd:	68 8b e8 10 f0       	push   $0xf010e88b
+f0106702:	e8 00 f6 ff ff       	call   f0105d07 <cprintf>
+f0106707:	83 c4 08             	add    $0x8,%esp
+f010670a:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f010670e:	50                   	push   %eax
+f010670f:	68 9a e8 10 f0       	push   $0xf010e89a
+f0106714:	e8 ee f5 ff ff       	call   f0105d07 <cprintf>
+f0106719:	83 c4 10             	add    $0x10,%esp
+f010671c:	eb 8e                	jmp    f01066ac <print_trapframe+0x12a>
+
+f010671e <page_fault_handler>:
+f010671e:	55                   	push   %ebp
+f010671f:	89 e5                	mov    %esp,%ebp
+f0106721:	57                   	push   %edi
+f0106722:	56                   	push   %esi
+f0106723:	53                   	push   %ebx
+f0106724:	83 ec 0c             	sub    $0xc,%esp
+f0106727:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010672a:	0f 20 d6             	mov    %cr2,%esi
+f010672d:	66 83 7b 34 08       	cmpw   $0x8,0x34(%ebx)
+f0106732:	0f 84 16 01 00 00    	je     f010684e <page_fault_handler+0x130>
+f0106738:	e8 14 48 00 00       	call   f010af51 <cpunum>
+f010673d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106743:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106749:	83 80 90 01 00 00 01 	addl   $0x1,0x190(%eax)
+f0106750:	f6 05 a8 b4 32 f0 20 	testb  $0x20,0xf032b4a8
+f0106757:	0f 85 29 01 00 00    	jne    f0106886 <page_fault_handler+0x168>
+f010675d:	e8 ef 47 00 00       	call   f010af51 <cpunum>
+f0106762:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106768:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010676e:	83 b8 80 00 00 00 00 	cmpl   $0x0,0x80(%eax)
+f0106775:	74 12                	je     f0106789 <page_fault_handler+0x6b>
+f0106777:	f6 43 2c 02          	testb  $0x2,0x2c(%ebx)
+f010677b:	74 0c                	je     f0106789 <page_fault_handler+0x6b>
+f010677d:	81 fe ff ff 7f ee    	cmp    $0xee7fffff,%esi
+f0106783:	0f 86 13 01 00 00    	jbe    f010689c <page_fault_handler+0x17e>
+f0106789:	f6 43 2c 01          	testb  $0x1,0x2c(%ebx)
+f010678d:	75 14                	jne    f01067a3 <page_fault_handler+0x85>
+f010678f:	83 ec 0c             	sub    $0xc,%esp
+f0106792:	56                   	push   %esi
+f0106793:	e8 35 1d 00 00       	call   f01084cd <ipc_page_fault>
+f0106798:	83 c4 10             	add    $0x10,%esp
+f010679b:	85 c0                	test   %eax,%eax
+f010679d:	0f 84 a3 00 00 00    	je     f0106846 <page_fault_handler+0x128>
+f01067a3:	e8 a9 47 00 00       	call   f010af51 <cpunum>
+f01067a8:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01067ae:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01067b4:	83 78 7c 00          	cmpl   $0x0,0x7c(%eax)
+f01067b8:	74 45                	je     f01067ff <page_fault_handler+0xe1>
+f01067ba:	e8 92 47 00 00       	call   f010af51 <cpunum>
+f01067bf:	6a 00                	push   $0x0
+f01067c1:	6a 04                	push   $0x4
+f01067c3:	68 fc ff 7f ee       	push   $0xee7ffffc
+f01067c8:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01067ce:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f01067d4:	e8 68 e4 ff ff       	call   f0104c41 <user_mem_assert>
+f01067d9:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f01067dc:	8d 90 00 10 80 11    	lea    0x11801000(%eax),%edx
+f01067e2:	83 c4 10             	add    $0x10,%esp
+f01067e5:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f01067eb:	0f 87 f0 00 00 00    	ja     f01068e1 <page_fault_handler+0x1c3>
+f01067f1:	83 e8 38             	sub    $0x38,%eax
+f01067f4:	3d ff ef 7f ee       	cmp    $0xee7fefff,%eax
+f01067f9:	0f 87 e7 00 00 00    	ja     f01068e6 <page_fault_handler+0x1c8>
+f01067ff:	8b 7b 30             	mov    0x30(%ebx),%edi
+f0106802:	e8 4a 47 00 00       	call   f010af51 <cpunum>
+f0106807:	57                   	push   %edi
+f0106808:	56                   	push   %esi
+f0106809:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010680f:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106815:	ff 70 48             	push   0x48(%eax)
+f0106818:	68 e8 e6 10 f0       	push   $0xf010e6e8
+f010681d:	e8 e5 f4 ff ff       	call   f0105d07 <cprintf>
+f0106822:	89 1c 24             	mov    %ebx,(%esp)
+f0106825:	e8 58 fd ff ff       	call   f0106582 <print_trapframe>
+f010682a:	e8 22 47 00 00       	call   f010af51 <cpunum>
+f010682f:	83 c4 04             	add    $0x4,%esp
+f0106832:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106838:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f010683e:	e8 94 ef ff ff       	call   f01057d7 <env_destroy>
+f0106843:	83 c4 10             	add    $0x10,%esp
+f0106846:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106849:	5b                   	pop    %ebx
+f010684a:	5e                   	pop    %esi
+f010684b:	5f                   	pop    %edi
+f010684c:	5d                   	pop    %ebp
+f010684d:	c3                   	ret
+f010684e:	83 ec 0c             	sub    $0xc,%esp
+f0106851:	53                   	push   %ebx
+f0106852:	e8 2b fd ff ff       	call   f0106582 <print_trapframe>
+f0106857:	e8 f5 46 00 00       	call   f010af51 <cpunum>
+f010685c:	83 c4 08             	add    $0x8,%esp
+f010685f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106865:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010686b:	ff 70 48             	push   0x48(%eax)
+f010686e:	ff 73 30             	push   0x30(%ebx)
+f0106871:	56                   	push   %esi
+f0106872:	68 bc e6 10 f0       	push   $0xf010e6bc
+f0106877:	68 be 01 00 00       	push   $0x1be
+f010687c:	68 ad e8 10 f0       	push   $0xf010e8ad
+f0106881:	e8 ba 97 ff ff       	call   f0100040 <_panic>
+f0106886:	ff 73 2c             	push   0x2c(%ebx)
+f0106889:	ff 73 30             	push   0x30(%ebx)
+f010688c:	56                   	push   %esi
+f010688d:	6a 05                	push   $0x5
+f010688f:	e8 f3 62 00 00       	call   f010cb87 <trace_record>
+f0106894:	83 c4 10             	add    $0x10,%esp
+f0106897:	e9 c1 fe ff ff       	jmp    f010675d <page_fault_handler+0x3f>
+f010689c:	e8 b0 46 00 00       	call   f010af51 <cpunum>
+f01068a1:	83 ec 08             	sub    $0x8,%esp
+f01068a4:	56                   	push   %esi
+f01068a5:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01068ab:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01068b1:	ff 70 78             	push   0x78(%eax)
+f01068b4:	e8 c4 d8 ff ff       	call   f010417d <page_cow>
+f01068b9:	83 c4 10             	add    $0x10,%esp
+f01068bc:	85 c0                	test   %eax,%eax
+f01068be:	0f 85 c5 fe ff ff    	jne    f0106789 <page_fault_handler+0x6b>
+f01068c4:	e8 88 46 00 00       	call   f010af51 <cpunum>
+f01068c9:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01068cf:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01068d5:	83 80 94 01 00 00 01 	addl   $0x1,0x194(%eax)
+f01068dc:	e9 65 ff ff ff       	jmp    f0106846 <page_fault_handler+0x128>
+f01068e1:	b8 cc ff 7f ee       	mov    $0xee7fffcc,%eax
+f01068e6:	89 30                	mov    %esi,(%eax)
+f01068e8:	8b 53 2c             	mov    0x2c(%ebx),%edx
+f01068eb:	89 50 04             	mov    %edx,0x4(%eax)
+f01068ee:	8d 78 08             	lea    0x8(%eax),%edi
+f01068f1:	b9 08 00 00 00       	mov    $0x8,%ecx
+f01068f6:	89 de                	mov    %ebx,%esi
+f01068f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01068fa:	8b 53 30             	mov    0x30(%ebx),%edx
+f01068fd:	89 50 28             	mov    %edx,0x28(%eax)
+f0106900:	8b 53 38             	mov    0x38(%ebx),%edx
+f0106903:	89 50 2c             	mov    %edx,0x2c(%eax)
+f0106906:	8b 53 3c             	mov    0x3c(%ebx),%edx
+f0106909:	89 50 30             	mov    %edx,0x30(%eax)
+f010690c:	89 43 3c             	mov    %eax,0x3c(%ebx)
+f010690f:	e8 3d 46 00 00       	call   f010af51 <cpunum>
+f0106914:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010691a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106920:	8b 40 7c             	mov    0x7c(%eax),%eax
+f0106923:	89 43 30             	mov    %eax,0x30(%ebx)
+f0106926:	e8 26 46 00 00       	call   f010af51 <cpunum>
+f010692b:	83 ec 0c             	sub    $0xc,%esp
+f010692e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106934:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f010693a:	e8 1a f0 ff ff       	call   f0105959 <env_run>
+
+f010693f <trap>:
+f010693f:	55                   	push   %ebp
+f0106940:	89 e5                	mov    %esp,%ebp
+f0106942:	57                   	push   %edi
+f0106943:	56                   	push   %esi
+f0106944:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106947:	fc                   	cld
+f0106948:	83 3d 60 1a 2d f0 00 	cmpl   $0x0,0xf02d1a60
+f010694f:	74 01                	je     f0106952 <trap+0x13>
+f0106951:	f4                   	hlt
+f0106952:	9c                   	pushf
+f0106953:	58                   	pop    %eax
+f0106954:	f6 c4 02             	test   $0x2,%ah
+f0106957:	0f 85 b5 00 00 00    	jne    f0106a12 <trap+0xd3>
+f010695d:	83 7e 28 35          	cmpl   $0x35,0x28(%esi)
+f0106961:	0f 84 c4 00 00 00    	je     f0106a2b <trap+0xec>
+f0106967:	e8 e5 45 00 00       	call   f010af51 <cpunum>
+f010696c:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+f0106972:	83 c2 04             	add    $0x4,%edx
+f0106975:	b8 01 00 00 00       	mov    $0x1,%eax
+f010697a:	f0 87 82 20 20 2d f0 	lock xchg %eax,-0xfd2dfe0(%edx)
+f0106981:	83 f8 02             	cmp    $0x2,%eax
+f0106984:	0f 84 b4 00 00 00    	je     f0106a3e <trap+0xff>
+f010698a:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f010698e:	83 e0 03             	and    $0x3,%eax
+f0106991:	66 83 f8 03          	cmp    $0x3,%ax
+f0106995:	0f 84 bd 00 00 00    	je     f0106a58 <trap+0x119>
+f010699b:	89 35 c0 5f 2b f0    	mov    %esi,0xf02b5fc0
+f01069a1:	8b 46 28             	mov    0x28(%esi),%eax
+f01069a4:	83 f8 0e             	cmp    $0xe,%eax
+f01069a7:	0f 84 a2 01 00 00    	je     f0106b4f <trap+0x210>
+f01069ad:	0f 87 76 01 00 00    	ja     f0106b29 <trap+0x1ea>
+f01069b3:	89 c2                	mov    %eax,%edx
+f01069b5:	83 e2 fd             	and    $0xfffffffd,%edx
+f01069b8:	83 fa 01             	cmp    $0x1,%edx
+f01069bb:	0f 84 ce 01 00 00    	je     f0106b8f <trap+0x250>
+f01069c1:	0f b6 15 78 1a 2d f0 	movzbl 0xf02d1a78,%edx
+f01069c8:	84 d2                	test   %dl,%dl
+f01069ca:	74 0e                	je     f01069da <trap+0x9b>
+f01069cc:	0f b6 d2             	movzbl %dl,%edx
+f01069cf:	83 c2 20             	add    $0x20,%edx
+f01069d2:	39 d0                	cmp    %edx,%eax
+f01069d4:	0f 84 35 02 00 00    	je     f0106c0f <trap+0x2d0>
+f01069da:	83 ec 0c             	sub    $0xc,%esp
+f01069dd:	56                   	push   %esi
+f01069de:	e8 9f fb ff ff       	call   f0106582 <print_trapframe>
+f01069e3:	83 c4 10             	add    $0x10,%esp
+f01069e6:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f01069eb:	0f 84 28 02 00 00    	je     f0106c19 <trap+0x2da>
+f01069f1:	e8 5b 45 00 00       	call   f010af51 <cpunum>
+f01069f6:	83 ec 0c             	sub    $0xc,%esp
+f01069f9:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01069ff:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0106a05:	e8 cd ed ff ff       	call   f01057d7 <env_destroy>
+f0106a0a:	83 c4 10             	add    $0x10,%esp
+f0106a0d:	e9 49 01 00 00       	jmp    f0106b5b <trap+0x21c>
+f0106a12:	68 b9 e8 10 f0       	push   $0xf010e8b9
+f0106a17:	68 0d e2 10 f0       	push   $0xf010e20d
+f0106a1c:	68 77 01 00 00       	push   $0x177
+f0106a21:	68 ad e8 10 f0       	push   $0xf010e8ad
+f0106a26:	e8 15 96 ff ff       	call   f0100040 <_panic>
+f0106a2b:	e8 27 df ff ff       	call   f0104957 <tlb_shootdown_handler>
+f0106a30:	e8 97 47 00 00       	call   f010b1cc <lapic_eoi>
+f0106a35:	83 ec 0c             	sub    $0xc,%esp
+f0106a38:	56                   	push   %esi
+f0106a39:	e8 03 ee ff ff       	call   f0105841 <env_pop_tf>
+f0106a3e:	83 ec 0c             	sub    $0xc,%esp
+f0106a41:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f0106a46:	e8 e0 48 00 00       	call   f010b32b <spin_lock>
+f0106a4b:	e8 81 df ff ff       	call   f01049d1 <tlb_shootdown_sync>
+f0106a50:	83 c4 10             	add    $0x10,%esp
+f0106a53:	e9 32 ff ff ff       	jmp    f010698a <trap+0x4b>
+f0106a58:	e8 f4 44 00 00       	call   f010af51 <cpunum>
+f0106a5d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106a63:	c7 80 a4 20 2d f0 01 	movl   $0x1,-0xfd2df5c(%eax)
+f0106a6a:	00 00 00 
+f0106a6d:	83 ec 0c             	sub    $0xc,%esp
+f0106a70:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f0106a75:	e8 b1 48 00 00       	call   f010b32b <spin_lock>
+f0106a7a:	e8 52 df ff ff       	call   f01049d1 <tlb_shootdown_sync>
+f0106a7f:	e8 cd 44 00 00       	call   f010af51 <cpunum>
+f0106a84:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106a8a:	83 c4 10             	add    $0x10,%esp
+f0106a8d:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0106a94:	74 47                	je     f0106add <trap+0x19e>
+f0106a96:	e8 b6 44 00 00       	call   f010af51 <cpunum>
+f0106a9b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106aa1:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106aa7:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f0106aab:	74 49                	je     f0106af6 <trap+0x1b7>
+f0106aad:	e8 9f 44 00 00       	call   f010af51 <cpunum>
+f0106ab2:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106ab8:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106abe:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0106ac3:	89 c7                	mov    %eax,%edi
+f0106ac5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0106ac7:	e8 85 44 00 00       	call   f010af51 <cpunum>
+f0106acc:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106ad2:	8b b0 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%esi
+f0106ad8:	e9 be fe ff ff       	jmp    f010699b <trap+0x5c>
+f0106add:	68 d2 e8 10 f0       	push   $0xf010e8d2
+f0106ae2:	68 0d e2 10 f0       	push   $0xf010e20d
+f0106ae7:	68 8f 01 00 00       	push   $0x18f
+f0106aec:	68 ad e8 10 f0       	push   $0xf010e8ad
+f0106af1:	e8 4a 95 ff ff       	call   f0100040 <_panic>
+f0106af6:	e8 56 44 00 00       	call   f010af51 <cpunum>
+f0106afb:	83 ec 0c             	sub    $0xc,%esp
+f0106afe:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106b04:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0106b0a:	e8 ca e8 ff ff       	call   f01053d9 <env_free>
+f0106b0f:	e8 3d 44 00 00       	call   f010af51 <cpunum>
+f0106b14:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106b1a:	c7 80 28 20 2d f0 00 	movl   $0x0,-0xfd2dfd8(%eax)
+f0106b21:	00 00 00 
+f0106b24:	e8 d2 06 00 00       	call   f01071fb <sched_yield>
+f0106b29:	83 f8 30             	cmp    $0x30,%eax
+f0106b2c:	75 6f                	jne    f0106b9d <trap+0x25e>
+f0106b2e:	83 ec 08             	sub    $0x8,%esp
+f0106b31:	ff 76 04             	push   0x4(%esi)
+f0106b34:	ff 36                	push   (%esi)
+f0106b36:	ff 76 10             	push   0x10(%esi)
+f0106b39:	ff 76 18             	push   0x18(%esi)
+f0106b3c:	ff 76 14             	push   0x14(%esi)
+f0106b3f:	ff 76 1c             	push   0x1c(%esi)
+f0106b42:	e8 44 20 00 00       	call   f0108b8b <syscall>
+f0106b47:	89 46 1c             	mov    %eax,0x1c(%esi)
+f0106b4a:	83 c4 20             	add    $0x20,%esp
+f0106b4d:	eb 0c                	jmp    f0106b5b <trap+0x21c>
+f0106b4f:	83 ec 0c             	sub    $0xc,%esp
+f0106b52:	56                   	push   %esi
+f0106b53:	e8 c6 fb ff ff       	call   f010671e <page_fault_handler>
+f0106b58:	83 c4 10             	add    $0x10,%esp
+f0106b5b:	e8 f1 43 00 00       	call   f010af51 <cpunum>
+f0106b60:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106b66:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0106b6d:	74 1b                	je     f0106b8a <trap+0x24b>
+f0106b6f:	e8 dd 43 00 00       	call   f010af51 <cpunum>
+f0106b74:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106b7a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106b80:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0106b84:	0f 84 a6 00 00 00    	je     f0106c30 <trap+0x2f1>
+f0106b8a:	e8 6c 06 00 00       	call   f01071fb <sched_yield>
+f0106b8f:	83 ec 0c             	sub    $0xc,%esp
+f0106b92:	56                   	push   %esi
+f0106b93:	e8 d9 a4 ff ff       	call   f0101071 <monitor>
+f0106b98:	83 c4 10             	add    $0x10,%esp
+f0106b9b:	eb be                	jmp    f0106b5b <trap+0x21c>
+f0106b9d:	83 f8 27             	cmp    $0x27,%eax
+f0106ba0:	74 16                	je     f0106bb8 <trap+0x279>
+f0106ba2:	83 f8 20             	cmp    $0x20,%eax
+f0106ba5:	74 2b                	je     f0106bd2 <trap+0x293>
+f0106ba7:	83 f8 34             	cmp    $0x34,%eax
+f0106baa:	74 46                	je     f0106bf2 <trap+0x2b3>
+f0106bac:	83 f8 24             	cmp    $0x24,%eax
+f0106baf:	75 4b                	jne    f0106bfc <trap+0x2bd>
+f0106bb1:	e8 e2 9a ff ff       	call   f0100698 <serial_intr>
+f0106bb6:	eb a3                	jmp    f0106b5b <trap+0x21c>
+f0106bb8:	83 ec 0c             	sub    $0xc,%esp
+f0106bbb:	68 d9 e8 10 f0       	push   $0xf010e8d9
+f0106bc0:	e8 42 f1 ff ff       	call   f0105d07 <cprintf>
+f0106bc5:	89 34 24             	mov    %esi,(%esp)
+f0106bc8:	e8 b5 f9 ff ff       	call   f0106582 <print_trapframe>
+f0106bcd:	83 c4 10             	add    $0x10,%esp
+f0106bd0:	eb 89                	jmp    f0106b5b <trap+0x21c>
+f0106bd2:	83 ec 0c             	sub    $0xc,%esp
+f0106bd5:	56                   	push   %esi
+f0106bd6:	e8 a9 59 00 00       	call   f010c584 <prof_tick>
+f0106bdb:	e8 0c 58 00 00       	call   f010c3ec <time_tick>
+f0106be0:	e8 e7 45 00 00       	call   f010b1cc <lapic_eoi>
+f0106be5:	e8 29 08 00 00       	call   f0107413 <sched_tick>
+f0106bea:	83 c4 10             	add    $0x10,%esp
+f0106bed:	e9 69 ff ff ff       	jmp    f0106b5b <trap+0x21c>
+f0106bf2:	e8 d5 45 00 00       	call   f010b1cc <lapic_eoi>
+f0106bf7:	e8 ff 05 00 00       	call   f01071fb <sched_yield>
+f0106bfc:	83 f8 21             	cmp    $0x21,%eax
+f0106bff:	0f 85 bc fd ff ff    	jne    f01069c1 <trap+0x82>
+f0106c05:	e8 aa 9a ff ff       	call   f01006b4 <kbd_intr>
+f0106c0a:	e9 4c ff ff ff       	jmp    f0106b5b <trap+0x21c>
+f0106c0f:	e8 4f 51 00 00       	call   f010bd63 <e1000_intr>
+f0106c14:	e9 42 ff ff ff       	jmp    f0106b5b <trap+0x21c>
+f0106c19:	83 ec 04             	sub    $0x4,%esp
+f0106c1c:	68 f6 e8 10 f0       	push   $0xf010e8f6
+f0106c21:	68 61 01 00 00       	push   $0x161
+f0106c26:	68 ad e8 10 f0       	push   $0xf010e8ad
+f0106c2b:	e8 10 94 ff ff       	call   f0100040 <_panic>
+f0106c30:	e8 1c 43 00 00       	call   f010af51 <cpunum>
+f0106c35:	83 ec 0c             	sub    $0xc,%esp
+f0106c38:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106c3e:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0106c44:	e8 10 ed ff ff       	call   f0105959 <env_run>
+
+f0106c49 <sysenter_syscall>:
+f0106c49:	55                   	push   %ebp
+f0106c4a:	89 e5                	mov    %esp,%ebp
+f0106c4c:	57                   	push   %edi
+f0106c4d:	56                   	push   %esi
+f0106c4e:	53                   	push   %ebx
+f0106c4f:	83 ec 0c             	sub    $0xc,%esp
+f0106c52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0106c55:	e8 f7 42 00 00       	call   f010af51 <cpunum>
+f0106c5a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106c60:	c7 80 a4 20 2d f0 01 	movl   $0x1,-0xfd2df5c(%eax)
+f0106c67:	00 00 00 
+f0106c6a:	83 ec 0c             	sub    $0xc,%esp
+f0106c6d:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f0106c72:	e8 b4 46 00 00       	call   f010b32b <spin_lock>
+f0106c77:	e8 55 dd ff ff       	call   f01049d1 <tlb_shootdown_sync>
+f0106c7c:	e8 d0 42 00 00       	call   f010af51 <cpunum>
+f0106c81:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106c87:	83 c4 10             	add    $0x10,%esp
+f0106c8a:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0106c91:	0f 84 39 01 00 00    	je     f0106dd0 <sysenter_syscall+0x187>
+f0106c97:	e8 b5 42 00 00       	call   f010af51 <cpunum>
+f0106c9c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106ca2:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106ca8:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f0106cac:	0f 84 37 01 00 00    	je     f0106de9 <sysenter_syscall+0x1a0>
+f0106cb2:	e8 9a 42 00 00       	call   f010af51 <cpunum>
+f0106cb7:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106cbd:	8b b0 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%esi
+f0106cc3:	8b 03                	mov    (%ebx),%eax
+f0106cc5:	89 06                	mov    %eax,(%esi)
+f0106cc7:	8b 43 04             	mov    0x4(%ebx),%eax
+f0106cca:	89 46 04             	mov    %eax,0x4(%esi)
+f0106ccd:	8b 43 08             	mov    0x8(%ebx),%eax
+f0106cd0:	89 46 08             	mov    %eax,0x8(%esi)
+f0106cd3:	8b 43 0c             	mov    0xc(%ebx),%eax
+f0106cd6:	89 46 0c             	mov    %eax,0xc(%esi)
+f0106cd9:	8b 43 10             	mov    0x10(%ebx),%eax
+f0106cdc:	89 46 10             	mov    %eax,0x10(%esi)
+f0106cdf:	8b 43 14             	mov    0x14(%ebx),%eax
+f0106ce2:	89 46 14             	mov    %eax,0x14(%esi)
+f0106ce5:	8b 43 18             	mov    0x18(%ebx),%eax
+f0106ce8:	89 46 18             	mov    %eax,0x18(%esi)
+f0106ceb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+f0106cee:	89 46 1c             	mov    %eax,0x1c(%esi)
+f0106cf1:	8b 43 04             	mov    0x4(%ebx),%eax
+f0106cf4:	89 46 30             	mov    %eax,0x30(%esi)
+f0106cf7:	8b 43 08             	mov    0x8(%ebx),%eax
+f0106cfa:	89 46 3c             	mov    %eax,0x3c(%esi)
+f0106cfd:	66 c7 46 34 1b 00    	movw   $0x1b,0x34(%esi)
+f0106d03:	66 c7 46 40 23 00    	movw   $0x23,0x40(%esi)
+f0106d09:	66 c7 46 20 23 00    	movw   $0x23,0x20(%esi)
+f0106d0f:	66 c7 46 24 23 00    	movw   $0x23,0x24(%esi)
+f0106d15:	8b 43 20             	mov    0x20(%ebx),%eax
+f0106d18:	80 cc 02             	or     $0x2,%ah
+f0106d1b:	89 46 38             	mov    %eax,0x38(%esi)
+f0106d1e:	c7 46 28 30 00 00 00 	movl   $0x30,0x28(%esi)
+f0106d25:	89 35 c0 5f 2b f0    	mov    %esi,0xf02b5fc0
+f0106d2b:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+f0106d2e:	83 f9 17             	cmp    $0x17,%ecx
+f0106d31:	0f 87 14 01 00 00    	ja     f0106e4b <sysenter_syscall+0x202>
+f0106d37:	b8 20 80 81 00       	mov    $0x818020,%eax
+f0106d3c:	d3 e8                	shr    %cl,%eax
+f0106d3e:	83 e0 01             	and    $0x1,%eax
+f0106d41:	0f 85 d5 00 00 00    	jne    f0106e1c <sysenter_syscall+0x1d3>
+f0106d47:	83 ec 08             	sub    $0x8,%esp
+f0106d4a:	50                   	push   %eax
+f0106d4b:	ff 33                	push   (%ebx)
+f0106d4d:	ff 73 10             	push   0x10(%ebx)
+f0106d50:	ff 73 18             	push   0x18(%ebx)
+f0106d53:	ff 73 14             	push   0x14(%ebx)
+f0106d56:	ff 73 1c             	push   0x1c(%ebx)
+f0106d59:	e8 2d 1e 00 00       	call   f0108b8b <syscall>
+f0106d5e:	89 c7                	mov    %eax,%edi
+f0106d60:	89 46 1c             	mov    %eax,0x1c(%esi)
+f0106d63:	83 c4 20             	add    $0x20,%esp
+f0106d66:	e8 e6 41 00 00       	call   f010af51 <cpunum>
+f0106d6b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106d71:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0106d78:	0f 84 d7 00 00 00    	je     f0106e55 <sysenter_syscall+0x20c>
+f0106d7e:	e8 ce 41 00 00       	call   f010af51 <cpunum>
+f0106d83:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106d89:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106d8f:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0106d93:	0f 85 bc 00 00 00    	jne    f0106e55 <sysenter_syscall+0x20c>
+f0106d99:	89 7b 1c             	mov    %edi,0x1c(%ebx)
+f0106d9c:	e8 c9 ad ff ff       	call   f0101b6a <tlb_shootdown>
+f0106da1:	e8 ab 41 00 00       	call   f010af51 <cpunum>
+f0106da6:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106dac:	c7 80 a4 20 2d f0 00 	movl   $0x0,-0xfd2df5c(%eax)
+f0106db3:	00 00 00 
+f0106db6:	83 ec 0c             	sub    $0xc,%esp
+f0106db9:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f0106dbe:	e8 3c 46 00 00       	call   f010b3ff <spin_unlock>
+f0106dc3:	f3 90                	pause
+f0106dc5:	83 c4 10             	add    $0x10,%esp
+f0106dc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106dcb:	5b                   	pop    %ebx
+f0106dcc:	5e                   	pop    %esi
+f0106dcd:	5f                   	pop    %edi
+f0106dce:	5d                   	pop    %ebp
+f0106dcf:	c3                   	ret
+f0106dd0:	68 d2 e8 10 f0       	push   $0xf010e8d2
+f0106dd5:	68 0d e2 10 f0       	push   $0xf010e20d
+f0106dda:	68 42 02 00 00       	push   $0x242
+f0106ddf:	68 ad e8 10 f0       	push   $0xf010e8ad
+f0106de4:	e8 57 92 ff ff       	call   f0100040 <_panic>
+f0106de9:	e8 63 41 00 00       	call   f010af51 <cpunum>
+f0106dee:	83 ec 0c             	sub    $0xc,%esp
+f0106df1:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106df7:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0106dfd:	e8 d7 e5 ff ff       	call   f01053d9 <env_free>
+f0106e02:	e8 4a 41 00 00       	call   f010af51 <cpunum>
+f0106e07:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106e0d:	c7 80 28 20 2d f0 00 	movl   $0x0,-0xfd2dfd8(%eax)
+f0106e14:	00 00 00 
+f0106e17:	e8 df 03 00 00       	call   f01071fb <sched_yield>
+f0106e1c:	8b 43 08             	mov    0x8(%ebx),%eax
+f0106e1f:	8d 78 04             	lea    0x4(%eax),%edi
+f0106e22:	e8 2a 41 00 00       	call   f010af51 <cpunum>
+f0106e27:	6a 04                	push   $0x4
+f0106e29:	6a 04                	push   $0x4
+f0106e2b:	57                   	push   %edi
+f0106e2c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106e32:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0106e38:	e8 04 de ff ff       	call   f0104c41 <user_mem_assert>
+f0106e3d:	8b 43 08             	mov    0x8(%ebx),%eax
+f0106e40:	8b 40 04             	mov    0x4(%eax),%eax
+f0106e43:	83 c4 10             	add    $0x10,%esp
+f0106e46:	e9 fc fe ff ff       	jmp    f0106d47 <sysenter_syscall+0xfe>
+f0106e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106e50:	e9 f2 fe ff ff       	jmp    f0106d47 <sysenter_syscall+0xfe>
+f0106e55:	e8 a1 03 00 00       	call   f01071fb <sched_yield>
+
+f0106e5a <handler_divide>:
+f0106e5a:	6a 00                	push   $0x0
+f0106e5c:	6a 00                	push   $0x0
+f0106e5e:	e9 03 01 00 00       	jmp    f0106f66 <_alltraps>
+f0106e63:	90                   	nop
+
+f0106e64 <handler_debug>:
+f0106e64:	6a 00                	push   $0x0
+f0106e66:	6a 01                	push   $0x1
+f0106e68:	e9 f9 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106e6d:	90                   	nop
+
+f0106e6e <handler_nmi>:
+f0106e6e:	6a 00                	push   $0x0
+f0106e70:	6a 02                	push   $0x2
+f0106e72:	e9 ef 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106e77:	90                   	nop
+
+f0106e78 <handler_brkpt>:
+f0106e78:	6a 00                	push   $0x0
+f0106e7a:	6a 03                	push   $0x3
+f0106e7c:	e9 e5 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106e81:	90                   	nop
+
+f0106e82 <handler_oflow>:
+f0106e82:	6a 00                	push   $0x0
+f0106e84:	6a 04                	push   $0x4
+f0106e86:	e9 db 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106e8b:	90                   	nop
+
+f0106e8c <handler_bound>:
+f0106e8c:	6a 00                	push   $0x0
+f0106e8e:	6a 05                	push   $0x5
+f0106e90:	e9 d1 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106e95:	90                   	nop
+
+f0106e96 <handler_illop>:
+f0106e96:	6a 00                	push   $0x0
+f0106e98:	6a 06                	push   $0x6
+f0106e9a:	e9 c7 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106e9f:	90                   	nop
+
+f0106ea0 <handler_device>:
+f0106ea0:	6a 00                	push   $0x0
+f0106ea2:	6a 07                	push   $0x7
+f0106ea4:	e9 bd 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106ea9:	90                   	nop
+
+f0106eaa <handler_dblflt>:
+f0106eaa:	6a 08                	push   $0x8
+f0106eac:	e9 b5 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106eb1:	90                   	nop
+
+f0106eb2 <handler_tss>:
+f0106eb2:	6a 0a                	push   $0xa
+f0106eb4:	e9 ad 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106eb9:	90                   	nop
+
+f0106eba <handler_segnp>:
+f0106eba:	6a 0b                	push   $0xb
+f0106ebc:	e9 a5 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106ec1:	90                   	nop
+
+f0106ec2 <handler_stack>:
+f0106ec2:	6a 0c                	push   $0xc
+f0106ec4:	e9 9d 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106ec9:	90                   	nop
+
+f0106eca <handler_gpflt>:
+f0106eca:	6a 0d                	push   $0xd
+f0106ecc:	e9 95 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106ed1:	90                   	nop
+
+f0106ed2 <handler_pgflt>:
+f0106ed2:	6a 0e                	push   $0xe
+f0106ed4:	e9 8d 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106ed9:	90                   	nop
+
+f0106eda <handler_fperr>:
+f0106eda:	6a 00                	push   $0x0
+f0106edc:	6a 10                	push   $0x10
+f0106ede:	e9 83 00 00 00       	jmp    f0106f66 <_alltraps>
+f0106ee3:	90                   	nop
+
+f0106ee4 <handler_align>:
+f0106ee4:	6a 11                	push   $0x11
+f0106ee6:	eb 7e                	jmp    f0106f66 <_alltraps>
+
+f0106ee8 <handler_mchk>:
+f0106ee8:	6a 00                	push   $0x0
+f0106eea:	6a 12                	push   $0x12
+f0106eec:	eb 78                	jmp    f0106f66 <_alltraps>
+
+f0106eee <handler_simderr>:
+f0106eee:	6a 00                	push   $0x0
+f0106ef0:	6a 13                	push   $0x13
+f0106ef2:	eb 72                	jmp    f0106f66 <_alltraps>
+
+f0106ef4 <handler_syscall>:
+f0106ef4:	6a 00                	push   $0x0
+f0106ef6:	6a 30                	push   $0x30
+f0106ef8:	eb 6c                	jmp    f0106f66 <_alltraps>
+
+f0106efa <handler_irq0>:
+f0106efa:	6a 00                	push   $0x0
+f0106efc:	6a 20                	push   $0x20
+f0106efe:	eb 66                	jmp    f0106f66 <_alltraps>
+
+f0106f00 <handler_irq1>:
+f0106f00:	6a 00                	push   $0x0
+f0106f02:	6a 21                	push   $0x21
+f0106f04:	eb 60                	jmp    f0106f66 <_alltraps>
+
+f0106f06 <handler_irq2>:
+f0106f06:	6a 00                	push   $0x0
+f0106f08:	6a 22                	push   $0x22
+f0106f0a:	eb 5a                	jmp    f0106f66 <_alltraps>
+
+f0106f0c <handler_irq3>:
+f0106f0c:	6a 00                	push   $0x0
+f0106f0e:	6a 23                	push   $0x23
+f0106f10:	eb 54                	jmp    f0106f66 <_alltraps>
+
+f0106f12 <handler_irq4>:
+f0106f12:	6a 00                	push   $0x0
+f0106f14:	6a 24                	push   $0x24
+f0106f16:	eb 4e                	jmp    f0106f66 <_alltraps>
+
+f0106f18 <handler_irq5>:
+f0106f18:	6a 00                	push   $0x0
+f0106f1a:	6a 25                	push   $0x25
+f0106f1c:	eb 48                	jmp    f0106f66 <_alltraps>
+
+f0106f1e <handler_irq6>:
+f0106f1e:	6a 00                	push   $0x0
+f0106f20:	6a 26                	push   $0x26
+f0106f22:	eb 42                	jmp    f0106f66 <_alltraps>
+
+f0106f24 <handler_irq7>:
+f0106f24:	6a 00                	push   $0x0
+f0106f26:	6a 27                	push   $0x27
+f0106f28:	eb 3c                	jmp    f0106f66 <_alltraps>
+
+f0106f2a <handler_irq8>:
+f0106f2a:	6a 00                	push   $0x0
+f0106f2c:	6a 28                	push   $0x28
+f0106f2e:	eb 36                	jmp    f0106f66 <_alltraps>
+
+f0106f30 <handler_irq9>:
+f0106f30:	6a 00                	push   $0x0
+f0106f32:	6a 29                	push   $0x29
+f0106f34:	eb 30                	jmp    f0106f66 <_alltraps>
+
+f0106f36 <handler_irq10>:
+f0106f36:	6a 00                	push   $0x0
+f0106f38:	6a 2a                	push   $0x2a
+f0106f3a:	eb 2a                	jmp    f0106f66 <_alltraps>
+
+f0106f3c <handler_irq11>:
+f0106f3c:	6a 00                	push   $0x0
+f0106f3e:	6a 2b                	push   $0x2b
+f0106f40:	eb 24                	jmp    f0106f66 <_alltraps>
+
+f0106f42 <handler_irq12>:
+f0106f42:	6a 00                	push   $0x0
+f0106f44:	6a 2c                	push   $0x2c
+f0106f46:	eb 1e                	jmp    f0106f66 <_alltraps>
+
+f0106f48 <handler_irq13>:
+f0106f48:	6a 00                	push   $0x0
+f0106f4a:	6a 2d                	push   $0x2d
+f0106f4c:	eb 18                	jmp    f0106f66 <_alltraps>
+
+f0106f4e <handler_irq14>:
+f0106f4e:	6a 00                	push   $0x0
+f0106f50:	6a 2e                	push   $0x2e
+f0106f52:	eb 12                	jmp    f0106f66 <_alltraps>
+
+f0106f54 <handler_irq15>:
+f0106f54:	6a 00                	push   $0x0
+f0106f56:	6a 2f                	push   $0x2f
+f0106f58:	eb 0c                	jmp    f0106f66 <_alltraps>
+
+f0106f5a <handler_wakeup>:
+f0106f5a:	6a 00                	push   $0x0
+f0106f5c:	6a 34                	push   $0x34
+f0106f5e:	eb 06                	jmp    f0106f66 <_alltraps>
+
+f0106f60 <handler_tlb>:
+f0106f60:	6a 00                	push   $0x0
+f0106f62:	6a 35                	push   $0x35
+f0106f64:	eb 00                	jmp    f0106f66 <_alltraps>
+
+f0106f66 <_alltraps>:
+f0106f66:	1e                   	push   %ds
+f0106f67:	06                   	push   %es
+f0106f68:	60                   	pusha
+f0106f69:	66 b8 10 00          	mov    $0x10,%ax
+f0106f6d:	8e d8                	mov    %eax,%ds
+f0106f6f:	8e c0                	mov    %eax,%es
+f0106f71:	54                   	push   %esp
+f0106f72:	e8 c8 f9 ff ff       	call   f010693f <trap>
+f0106f77:	83 c4 04             	add    $0x4,%esp
+
+f0106f7a <trapret>:
+f0106f7a:	61                   	popa
+f0106f7b:	07                   	pop    %es
+f0106f7c:	1f                   	pop    %ds
+f0106f7d:	83 c4 08             	add    $0x8,%esp
+f0106f80:	cf                   	iret
+f0106f81:	90                   	nop
+
+f0106f82 <sysenter_handler>:
+f0106f82:	9c                   	pushf
+f0106f83:	60                   	pusha
+f0106f84:	54                   	push   %esp
+f0106f85:	e8 bf fc ff ff       	call   f0106c49 <sysenter_syscall>
+f0106f8a:	83 c4 04             	add    $0x4,%esp
+f0106f8d:	61                   	popa
+f0106f8e:	83 c4 04             	add    $0x4,%esp
+f0106f91:	89 f2                	mov    %esi,%edx
+f0106f93:	89 e9                	mov    %ebp,%ecx
+f0106f95:	fb                   	sti
+f0106f96:	0f 35                	sysexit
+
+f0106f98 <sched_pick>:
+f0106f98:	55                   	push   %ebp
+f0106f99:	89 e5                	mov    %esp,%ebp
+f0106f9b:	57                   	push   %edi
+f0106f9c:	56                   	push   %esi
+f0106f9d:	53                   	push   %ebx
+f0106f9e:	83 ec 2c             	sub    $0x2c,%esp
+f0106fa1:	e8 ab 3f 00 00       	call   f010af51 <cpunum>
+f0106fa6:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106fac:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106fb1:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0106fb8:	74 1d                	je     f0106fd7 <sched_pick+0x3f>
+f0106fba:	e8 92 3f 00 00       	call   f010af51 <cpunum>
+f0106fbf:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0106fc5:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0106fcb:	8b 50 48             	mov    0x48(%eax),%edx
+f0106fce:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0106fd4:	83 c2 01             	add    $0x1,%edx
+f0106fd7:	8b 3d 78 57 2b f0    	mov    0xf02b5778,%edi
+f0106fdd:	8b 1d c8 5f 2b f0    	mov    0xf02b5fc8,%ebx
+f0106fe3:	8b 35 cc 5f 2b f0    	mov    0xf02b5fcc,%esi
+f0106fe9:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+f0106fec:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f0106fef:	81 c3 00 f0 ff ff    	add    $0xfffff000,%ebx
+f0106ff5:	83 d6 ff             	adc    $0xffffffff,%esi
+f0106ff8:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+f0106ffb:	89 75 cc             	mov    %esi,-0x34(%ebp)
+f0106ffe:	8d 82 00 04 00 00    	lea    0x400(%edx),%eax
+f0107004:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107007:	be 00 00 00 00       	mov    $0x0,%esi
+f010700c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f0107013:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0107016:	eb 36                	jmp    f010704e <sched_pick+0xb6>
+f0107018:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f010701b:	85 db                	test   %ebx,%ebx
+f010701d:	0f 84 83 00 00 00    	je     f01070a6 <sched_pick+0x10e>
+f0107023:	8b 7b 68             	mov    0x68(%ebx),%edi
+f0107026:	39 78 68             	cmp    %edi,0x68(%eax)
+f0107029:	0f 4e c3             	cmovle %ebx,%eax
+f010702c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010702f:	eb 13                	jmp    f0107044 <sched_pick+0xac>
+f0107031:	85 f6                	test   %esi,%esi
+f0107033:	74 76                	je     f01070ab <sched_pick+0x113>
+f0107035:	8b 48 74             	mov    0x74(%eax),%ecx
+f0107038:	8b 7e 70             	mov    0x70(%esi),%edi
+f010703b:	39 78 70             	cmp    %edi,0x70(%eax)
+f010703e:	1b 4e 74             	sbb    0x74(%esi),%ecx
+f0107041:	0f 42 f0             	cmovb  %eax,%esi
+f0107044:	83 c2 01             	add    $0x1,%edx
+f0107047:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010704a:	39 c2                	cmp    %eax,%edx
+f010704c:	74 61                	je     f01070af <sched_pick+0x117>
+f010704e:	89 d1                	mov    %edx,%ecx
+f0107050:	c1 f9 1f             	sar    $0x1f,%ecx
+f0107053:	c1 e9 16             	shr    $0x16,%ecx
+f0107056:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+f0107059:	25 ff 03 00 00       	and    $0x3ff,%eax
+f010705e:	29 c8                	sub    %ecx,%eax
+f0107060:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+f0107066:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0107069:	01 d8                	add    %ebx,%eax
+f010706b:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f010706f:	74 d3                	je     f0107044 <sched_pick+0xac>
+f0107071:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f0107075:	75 cd                	jne    f0107044 <sched_pick+0xac>
+f0107077:	83 78 64 01          	cmpl   $0x1,0x64(%eax)
+f010707b:	74 9b                	je     f0107018 <sched_pick+0x80>
+f010707d:	8b 48 70             	mov    0x70(%eax),%ecx
+f0107080:	8b 58 74             	mov    0x74(%eax),%ebx
+f0107083:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+f0107089:	83 d3 00             	adc    $0x0,%ebx
+f010708c:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f010708f:	39 f9                	cmp    %edi,%ecx
+f0107091:	89 df                	mov    %ebx,%edi
+f0107093:	1b 7d dc             	sbb    -0x24(%ebp),%edi
+f0107096:	73 99                	jae    f0107031 <sched_pick+0x99>
+f0107098:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+f010709b:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f010709e:	89 48 70             	mov    %ecx,0x70(%eax)
+f01070a1:	89 58 74             	mov    %ebx,0x74(%eax)
+f01070a4:	eb 8b                	jmp    f0107031 <sched_pick+0x99>
+f01070a6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f01070a9:	eb 99                	jmp    f0107044 <sched_pick+0xac>
+f01070ab:	89 c6                	mov    %eax,%esi
+f01070ad:	eb 95                	jmp    f0107044 <sched_pick+0xac>
+f01070af:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f01070b3:	74 0b                	je     f01070c0 <sched_pick+0x128>
+f01070b5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01070b8:	83 c4 2c             	add    $0x2c,%esp
+f01070bb:	5b                   	pop    %ebx
+f01070bc:	5e                   	pop    %esi
+f01070bd:	5f                   	pop    %edi
+f01070be:	5d                   	pop    %ebp
+f01070bf:	c3                   	ret
+f01070c0:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f01070c3:	85 f6                	test   %esi,%esi
+f01070c5:	74 ee                	je     f01070b5 <sched_pick+0x11d>
+f01070c7:	8b 56 70             	mov    0x70(%esi),%edx
+f01070ca:	8b 46 74             	mov    0x74(%esi),%eax
+f01070cd:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01070d0:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01070d3:	39 d1                	cmp    %edx,%ecx
+f01070d5:	89 df                	mov    %ebx,%edi
+f01070d7:	19 c7                	sbb    %eax,%edi
+f01070d9:	73 da                	jae    f01070b5 <sched_pick+0x11d>
+f01070db:	89 15 c8 5f 2b f0    	mov    %edx,0xf02b5fc8
+f01070e1:	a3 cc 5f 2b f0       	mov    %eax,0xf02b5fcc
+f01070e6:	eb cd                	jmp    f01070b5 <sched_pick+0x11d>
+
+f01070e8 <sched_env_init>:
+f01070e8:	55                   	push   %ebp
+f01070e9:	89 e5                	mov    %esp,%ebp
+f01070eb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01070ee:	c7 41 64 00 00 00 00 	movl   $0x0,0x64(%ecx)
+f01070f5:	c7 41 68 00 00 00 00 	movl   $0x0,0x68(%ecx)
+f01070fc:	c7 41 6c 00 04 00 00 	movl   $0x400,0x6c(%ecx)
+f0107103:	a1 c8 5f 2b f0       	mov    0xf02b5fc8,%eax
+f0107108:	8b 15 cc 5f 2b f0    	mov    0xf02b5fcc,%edx
+f010710e:	89 41 70             	mov    %eax,0x70(%ecx)
+f0107111:	89 51 74             	mov    %edx,0x74(%ecx)
+f0107114:	5d                   	pop    %ebp
+f0107115:	c3                   	ret
+
+f0107116 <sched_set_class>:
+f0107116:	55                   	push   %ebp
+f0107117:	89 e5                	mov    %esp,%ebp
+f0107119:	53                   	push   %ebx
+f010711a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010711d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0107120:	8b 55 10             	mov    0x10(%ebp),%edx
+f0107123:	85 c9                	test   %ecx,%ecx
+f0107125:	74 1f                	je     f0107146 <sched_set_class+0x30>
+f0107127:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010712c:	83 f9 01             	cmp    $0x1,%ecx
+f010712f:	75 10                	jne    f0107141 <sched_set_class+0x2b>
+f0107131:	83 fa 1f             	cmp    $0x1f,%edx
+f0107134:	77 36                	ja     f010716c <sched_set_class+0x56>
+f0107136:	89 53 68             	mov    %edx,0x68(%ebx)
+f0107139:	89 4b 64             	mov    %ecx,0x64(%ebx)
+f010713c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107144:	c9                   	leave
+f0107145:	c3                   	ret
+f0107146:	8d 42 f0             	lea    -0x10(%edx),%eax
+f0107149:	3d f0 3f 00 00       	cmp    $0x3ff0,%eax
+f010714e:	77 23                	ja     f0107173 <sched_set_class+0x5d>
+f0107150:	89 53 6c             	mov    %edx,0x6c(%ebx)
+f0107153:	83 7b 64 00          	cmpl   $0x0,0x64(%ebx)
+f0107157:	74 e0                	je     f0107139 <sched_set_class+0x23>
+f0107159:	a1 c8 5f 2b f0       	mov    0xf02b5fc8,%eax
+f010715e:	8b 15 cc 5f 2b f0    	mov    0xf02b5fcc,%edx
+f0107164:	89 43 70             	mov    %eax,0x70(%ebx)
+f0107167:	89 53 74             	mov    %edx,0x74(%ebx)
+f010716a:	eb cd                	jmp    f0107139 <sched_set_class+0x23>
+f010716c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107171:	eb ce                	jmp    f0107141 <sched_set_class+0x2b>
+f0107173:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107178:	eb c7                	jmp    f0107141 <sched_set_class+0x2b>
+
+f010717a <sched_halt>:
+f010717a:	55                   	push   %ebp
+f010717b:	89 e5                	mov    %esp,%ebp
+f010717d:	83 ec 08             	sub    $0x8,%esp
+f0107180:	e8 cc 3d 00 00       	call   f010af51 <cpunum>
+f0107185:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010718b:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0107190:	39 05 c0 24 2d f0    	cmp    %eax,0xf02d24c0
+f0107196:	74 58                	je     f01071f0 <sched_halt+0x76>
+f0107198:	e8 35 3e 00 00       	call   f010afd2 <lapic_timer_stop>
+f010719d:	e8 c8 a9 ff ff       	call   f0101b6a <tlb_shootdown>
+f01071a2:	e8 aa 3d 00 00       	call   f010af51 <cpunum>
+f01071a7:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+f01071ad:	83 c2 04             	add    $0x4,%edx
+f01071b0:	b8 02 00 00 00       	mov    $0x2,%eax
+f01071b5:	f0 87 82 20 20 2d f0 	lock xchg %eax,-0xfd2dfe0(%edx)
+f01071bc:	83 ec 0c             	sub    $0xc,%esp
+f01071bf:	68 a0 a3 11 f0       	push   $0xf011a3a0
+f01071c4:	e8 36 42 00 00       	call   f010b3ff <spin_unlock>
+f01071c9:	f3 90                	pause
+f01071cb:	e8 81 3d 00 00       	call   f010af51 <cpunum>
+f01071d0:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01071d6:	8b 80 30 20 2d f0    	mov    -0xfd2dfd0(%eax),%eax
+f01071dc:	bd 00 00 00 00       	mov    $0x0,%ebp
+f01071e1:	89 c4                	mov    %eax,%esp
+f01071e3:	6a 00                	push   $0x0
+f01071e5:	6a 00                	push   $0x0
+f01071e7:	fb                   	sti
+f01071e8:	f4                   	hlt
+f01071e9:	eb fd                	jmp    f01071e8 <sched_halt+0x6e>
+f01071eb:	83 c4 10             	add    $0x10,%esp
+f01071ee:	c9                   	leave
+f01071ef:	c3                   	ret
+f01071f0:	e8 8b 52 00 00       	call   f010c480 <time_tsc_calibrated>
+f01071f5:	85 c0                	test   %eax,%eax
+f01071f7:	74 a4                	je     f010719d <sched_halt+0x23>
+f01071f9:	eb 9d                	jmp    f0107198 <sched_halt+0x1e>
+
+f01071fb <sched_yield>:
+f01071fb:	55                   	push   %ebp
+f01071fc:	89 e5                	mov    %esp,%ebp
+f01071fe:	53                   	push   %ebx
+f01071ff:	83 ec 04             	sub    $0x4,%esp
+f0107202:	e8 91 fd ff ff       	call   f0106f98 <sched_pick>
+f0107207:	85 c0                	test   %eax,%eax
+f0107209:	74 09                	je     f0107214 <sched_yield+0x19>
+f010720b:	83 ec 0c             	sub    $0xc,%esp
+f010720e:	50                   	push   %eax
+f010720f:	e8 45 e7 ff ff       	call   f0105959 <env_run>
+f0107214:	e8 38 3d 00 00       	call   f010af51 <cpunum>
+f0107219:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010721f:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f0107226:	74 17                	je     f010723f <sched_yield+0x44>
+f0107228:	e8 24 3d 00 00       	call   f010af51 <cpunum>
+f010722d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107233:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107239:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f010723d:	75 10                	jne    f010724f <sched_yield+0x54>
+f010723f:	8b 1d 78 57 2b f0    	mov    0xf02b5778,%ebx
+f0107245:	8d 43 50             	lea    0x50(%ebx),%eax
+f0107248:	ba 00 00 00 00       	mov    $0x0,%edx
+f010724d:	eb 40                	jmp    f010728f <sched_yield+0x94>
+f010724f:	e8 fd 3c 00 00       	call   f010af51 <cpunum>
+f0107254:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010725a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107260:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0107264:	75 d9                	jne    f010723f <sched_yield+0x44>
+f0107266:	e8 e6 3c 00 00       	call   f010af51 <cpunum>
+f010726b:	83 ec 0c             	sub    $0xc,%esp
+f010726e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107274:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f010727a:	e8 da e6 ff ff       	call   f0105959 <env_run>
+f010727f:	83 c2 01             	add    $0x1,%edx
+f0107282:	05 ac 01 00 00       	add    $0x1ac,%eax
+f0107287:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+f010728d:	74 4a                	je     f01072d9 <sched_yield+0xde>
+f010728f:	83 38 01             	cmpl   $0x1,(%eax)
+f0107292:	74 eb                	je     f010727f <sched_yield+0x84>
+f0107294:	8b 48 04             	mov    0x4(%eax),%ecx
+f0107297:	83 e9 02             	sub    $0x2,%ecx
+f010729a:	83 f9 01             	cmp    $0x1,%ecx
+f010729d:	77 e0                	ja     f010727f <sched_yield+0x84>
+f010729f:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+f01072a5:	74 32                	je     f01072d9 <sched_yield+0xde>
+f01072a7:	e8 a5 3c 00 00       	call   f010af51 <cpunum>
+f01072ac:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+f01072b2:	01 c3                	add    %eax,%ebx
+f01072b4:	8b 43 54             	mov    0x54(%ebx),%eax
+f01072b7:	83 e8 02             	sub    $0x2,%eax
+f01072ba:	83 f8 01             	cmp    $0x1,%eax
+f01072bd:	76 39                	jbe    f01072f8 <sched_yield+0xfd>
+f01072bf:	e8 8d 3c 00 00       	call   f010af51 <cpunum>
+f01072c4:	50                   	push   %eax
+f01072c5:	68 d0 ea 10 f0       	push   $0xf010ead0
+f01072ca:	68 a5 00 00 00       	push   $0xa5
+f01072cf:	68 ed ea 10 f0       	push   $0xf010eaed
+f01072d4:	e8 67 8d ff ff       	call   f0100040 <_panic>
+f01072d9:	83 ec 0c             	sub    $0xc,%esp
+f01072dc:	68 b0 ea 10 f0       	push   $0xf010eab0
+f01072e1:	e8 21 ea ff ff       	call   f0105d07 <cprintf>
+f01072e6:	83 c4 10             	add    $0x10,%esp
+f01072e9:	83 ec 0c             	sub    $0xc,%esp
+f01072ec:	6a 00                	push   $0x0
+f01072ee:	e8 7e 9d ff ff       	call   f0101071 <monitor>
+f01072f3:	83 c4 10             	add    $0x10,%esp
+f01072f6:	eb f1                	jmp    f01072e9 <sched_yield+0xee>
+f01072f8:	e8 54 3c 00 00       	call   f010af51 <cpunum>
+f01072fd:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107303:	39 98 28 20 2d f0    	cmp    %ebx,-0xfd2dfd8(%eax)
+f0107309:	74 09                	je     f0107314 <sched_yield+0x119>
+f010730b:	83 ec 0c             	sub    $0xc,%esp
+f010730e:	53                   	push   %ebx
+f010730f:	e8 45 e6 ff ff       	call   f0105959 <env_run>
+f0107314:	83 ec 0c             	sub    $0xc,%esp
+f0107317:	6a 04                	push   $0x4
+f0107319:	e8 3b e2 ff ff       	call   f0105559 <env_reclaim>
+f010731e:	83 c4 10             	add    $0x10,%esp
+f0107321:	85 c0                	test   %eax,%eax
+f0107323:	75 e6                	jne    f010730b <sched_yield+0x110>
+f0107325:	e8 e6 d6 ff ff       	call   f0104a10 <page_zero_idle>
+f010732a:	85 c0                	test   %eax,%eax
+f010732c:	75 dd                	jne    f010730b <sched_yield+0x110>
+f010732e:	e8 bb dc ff ff       	call   f0104fee <env_pgdir_fill>
+f0107333:	85 c0                	test   %eax,%eax
+f0107335:	75 d4                	jne    f010730b <sched_yield+0x110>
+f0107337:	e8 3e fe ff ff       	call   f010717a <sched_halt>
+f010733c:	eb cd                	jmp    f010730b <sched_yield+0x110>
+
+f010733e <sched_wakeup>:
+f010733e:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f0107345:	00 00 00 
+f0107348:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010734d:	3d 20 20 2d f0       	cmp    $0xf02d2020,%eax
+f0107352:	76 59                	jbe    f01073ad <sched_wakeup+0x6f>
+f0107354:	55                   	push   %ebp
+f0107355:	89 e5                	mov    %esp,%ebp
+f0107357:	53                   	push   %ebx
+f0107358:	83 ec 04             	sub    $0x4,%esp
+f010735b:	bb 20 20 2d f0       	mov    $0xf02d2020,%ebx
+f0107360:	eb 19                	jmp    f010737b <sched_wakeup+0x3d>
+f0107362:	81 c3 94 00 00 00    	add    $0x94,%ebx
+f0107368:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f010736f:	00 00 00 
+f0107372:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f0107377:	39 c3                	cmp    %eax,%ebx
+f0107379:	73 2d                	jae    f01073a8 <sched_wakeup+0x6a>
+f010737b:	e8 d1 3b 00 00       	call   f010af51 <cpunum>
+f0107380:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107386:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010738b:	39 c3                	cmp    %eax,%ebx
+f010738d:	74 d3                	je     f0107362 <sched_wakeup+0x24>
+f010738f:	8b 43 04             	mov    0x4(%ebx),%eax
+f0107392:	83 f8 02             	cmp    $0x2,%eax
+f0107395:	75 cb                	jne    f0107362 <sched_wakeup+0x24>
+f0107397:	83 ec 08             	sub    $0x8,%esp
+f010739a:	6a 34                	push   $0x34
+f010739c:	0f b6 03             	movzbl (%ebx),%eax
+f010739f:	50                   	push   %eax
+f01073a0:	e8 35 3f 00 00       	call   f010b2da <lapic_ipi_dest>
+f01073a5:	83 c4 10             	add    $0x10,%esp
+f01073a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01073ab:	c9                   	leave
+f01073ac:	c3                   	ret
+f01073ad:	c3                   	ret
+
+f01073ae <sched_charge>:
+f01073ae:	55                   	push   %ebp
+f01073af:	89 e5                	mov    %esp,%ebp
+f01073b1:	57                   	push   %edi
+f01073b2:	56                   	push   %esi
+f01073b3:	53                   	push   %ebx
+f01073b4:	83 ec 0c             	sub    $0xc,%esp
+f01073b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01073ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f01073bd:	8b 75 10             	mov    0x10(%ebp),%esi
+f01073c0:	83 7b 64 00          	cmpl   $0x0,0x64(%ebx)
+f01073c4:	74 08                	je     f01073ce <sched_charge+0x20>
+f01073c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01073c9:	5b                   	pop    %ebx
+f01073ca:	5e                   	pop    %esi
+f01073cb:	5f                   	pop    %edi
+f01073cc:	5d                   	pop    %ebp
+f01073cd:	c3                   	ret
+f01073ce:	e8 ad 50 00 00       	call   f010c480 <time_tsc_calibrated>
+f01073d3:	85 c0                	test   %eax,%eax
+f01073d5:	74 ef                	je     f01073c6 <sched_charge+0x18>
+f01073d7:	b8 00 00 10 00       	mov    $0x100000,%eax
+f01073dc:	ba 00 00 00 00       	mov    $0x0,%edx
+f01073e1:	f7 73 6c             	divl   0x6c(%ebx)
+f01073e4:	89 f1                	mov    %esi,%ecx
+f01073e6:	0f af c8             	imul   %eax,%ecx
+f01073e9:	f7 e7                	mul    %edi
+f01073eb:	89 c6                	mov    %eax,%esi
+f01073ed:	89 d7                	mov    %edx,%edi
+f01073ef:	01 cf                	add    %ecx,%edi
+f01073f1:	8b 15 a0 b4 32 f0    	mov    0xf032b4a0,%edx
+f01073f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01073fc:	f7 62 08             	mull   0x8(%edx)
+f01073ff:	52                   	push   %edx
+f0107400:	50                   	push   %eax
+f0107401:	57                   	push   %edi
+f0107402:	56                   	push   %esi
+f0107403:	e8 d7 5a 00 00       	call   f010cedf <__udivdi3>
+f0107408:	83 c4 10             	add    $0x10,%esp
+f010740b:	01 43 70             	add    %eax,0x70(%ebx)
+f010740e:	11 53 74             	adc    %edx,0x74(%ebx)
+f0107411:	eb b3                	jmp    f01073c6 <sched_charge+0x18>
+
+f0107413 <sched_tick>:
+f0107413:	55                   	push   %ebp
+f0107414:	89 e5                	mov    %esp,%ebp
+f0107416:	57                   	push   %edi
+f0107417:	56                   	push   %esi
+f0107418:	53                   	push   %ebx
+f0107419:	83 ec 0c             	sub    $0xc,%esp
+f010741c:	e8 30 3b 00 00       	call   f010af51 <cpunum>
+f0107421:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107427:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f010742e:	74 18                	je     f0107448 <sched_tick+0x35>
+f0107430:	e8 1c 3b 00 00       	call   f010af51 <cpunum>
+f0107435:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010743b:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107441:	83 80 e8 00 00 00 01 	addl   $0x1,0xe8(%eax)
+f0107448:	e8 04 3b 00 00       	call   f010af51 <cpunum>
+f010744d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107453:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f010745a:	0f 84 a7 00 00 00    	je     f0107507 <sched_tick+0xf4>
+f0107460:	e8 ec 3a 00 00       	call   f010af51 <cpunum>
+f0107465:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010746b:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107471:	83 78 50 01          	cmpl   $0x1,0x50(%eax)
+f0107475:	0f 84 8c 00 00 00    	je     f0107507 <sched_tick+0xf4>
+f010747b:	e8 d1 3a 00 00       	call   f010af51 <cpunum>
+f0107480:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107486:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010748c:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0107490:	75 75                	jne    f0107507 <sched_tick+0xf4>
+f0107492:	e8 eb e3 ff ff       	call   f0105882 <env_charge>
+f0107497:	e8 b5 3a 00 00       	call   f010af51 <cpunum>
+f010749c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01074a2:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01074a8:	83 78 64 00          	cmpl   $0x0,0x64(%eax)
+f01074ac:	74 5e                	je     f010750c <sched_tick+0xf9>
+f01074ae:	e8 e5 fa ff ff       	call   f0106f98 <sched_pick>
+f01074b3:	89 c3                	mov    %eax,%ebx
+f01074b5:	85 c0                	test   %eax,%eax
+f01074b7:	74 46                	je     f01074ff <sched_tick+0xec>
+f01074b9:	e8 93 3a 00 00       	call   f010af51 <cpunum>
+f01074be:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01074c4:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01074ca:	83 78 64 01          	cmpl   $0x1,0x64(%eax)
+f01074ce:	0f 84 82 00 00 00    	je     f0107556 <sched_tick+0x143>
+f01074d4:	83 7b 64 01          	cmpl   $0x1,0x64(%ebx)
+f01074d8:	0f 84 a0 00 00 00    	je     f010757e <sched_tick+0x16b>
+f01074de:	8b 7b 70             	mov    0x70(%ebx),%edi
+f01074e1:	8b 73 74             	mov    0x74(%ebx),%esi
+f01074e4:	e8 68 3a 00 00       	call   f010af51 <cpunum>
+f01074e9:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01074ef:	8b 90 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%edx
+f01074f5:	8b 42 74             	mov    0x74(%edx),%eax
+f01074f8:	39 7a 70             	cmp    %edi,0x70(%edx)
+f01074fb:	19 f0                	sbb    %esi,%eax
+f01074fd:	73 7f                	jae    f010757e <sched_tick+0x16b>
+f01074ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107502:	5b                   	pop    %ebx
+f0107503:	5e                   	pop    %esi
+f0107504:	5f                   	pop    %edi
+f0107505:	5d                   	pop    %ebp
+f0107506:	c3                   	ret
+f0107507:	e8 ef fc ff ff       	call   f01071fb <sched_yield>
+f010750c:	e8 6f 4f 00 00       	call   f010c480 <time_tsc_calibrated>
+f0107511:	85 c0                	test   %eax,%eax
+f0107513:	75 99                	jne    f01074ae <sched_tick+0x9b>
+f0107515:	e8 37 3a 00 00       	call   f010af51 <cpunum>
+f010751a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107520:	8b 88 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%ecx
+f0107526:	b8 00 00 10 00       	mov    $0x100000,%eax
+f010752b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107530:	f7 71 6c             	divl   0x6c(%ecx)
+f0107533:	89 c3                	mov    %eax,%ebx
+f0107535:	e8 17 3a 00 00       	call   f010af51 <cpunum>
+f010753a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107540:	8b 88 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%ecx
+f0107546:	ba 00 00 00 00       	mov    $0x0,%edx
+f010754b:	01 59 70             	add    %ebx,0x70(%ecx)
+f010754e:	11 51 74             	adc    %edx,0x74(%ecx)
+f0107551:	e9 58 ff ff ff       	jmp    f01074ae <sched_tick+0x9b>
+f0107556:	83 7b 64 01          	cmpl   $0x1,0x64(%ebx)
+f010755a:	75 a3                	jne    f01074ff <sched_tick+0xec>
+f010755c:	8b 73 68             	mov    0x68(%ebx),%esi
+f010755f:	e8 ed 39 00 00       	call   f010af51 <cpunum>
+f0107564:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010756a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107570:	3b 70 68             	cmp    0x68(%eax),%esi
+f0107573:	7c 8a                	jl     f01074ff <sched_tick+0xec>
+f0107575:	83 ec 0c             	sub    $0xc,%esp
+f0107578:	53                   	push   %ebx
+f0107579:	e8 db e3 ff ff       	call   f0105959 <env_run>
+f010757e:	83 ec 0c             	sub    $0xc,%esp
+f0107581:	53                   	push   %ebx
+f0107582:	e8 d2 e3 ff ff       	call   f0105959 <env_run>
+
+f0107587 <ipc_deliver>:
+f0107587:	83 ba 94 00 00 00 00 	cmpl   $0x0,0x94(%edx)
+f010758e:	0f 84 8c 01 00 00    	je     f0107720 <ipc_deliver+0x199>
+f0107594:	55                   	push   %ebp
+f0107595:	89 e5                	mov    %esp,%ebp
+f0107597:	57                   	push   %edi
+f0107598:	56                   	push   %esi
+f0107599:	53                   	push   %ebx
+f010759a:	83 ec 2c             	sub    $0x2c,%esp
+f010759d:	89 c6                	mov    %eax,%esi
+f010759f:	89 d3                	mov    %edx,%ebx
+f01075a1:	89 cf                	mov    %ecx,%edi
+f01075a3:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+f01075a9:	85 c0                	test   %eax,%eax
+f01075ab:	74 09                	je     f01075b6 <ipc_deliver+0x2f>
+f01075ad:	3b 46 48             	cmp    0x48(%esi),%eax
+f01075b0:	0f 85 70 01 00 00    	jne    f0107726 <ipc_deliver+0x19f>
+f01075b6:	81 bb 9c 00 00 00 ff 	cmpl   $0xee7fffff,0x9c(%ebx)
+f01075bd:	ff 7f ee 
+f01075c0:	77 09                	ja     f01075cb <ipc_deliver+0x44>
+f01075c2:	81 7d 08 ff ff 7f ee 	cmpl   $0xee7fffff,0x8(%ebp)
+f01075c9:	76 6f                	jbe    f010763a <ipc_deliver+0xb3>
+f01075cb:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+f01075d2:	0f 85 df 00 00 00    	jne    f01076b7 <ipc_deliver+0x130>
+f01075d8:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+f01075df:	00 00 00 
+f01075e2:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+f01075e9:	00 00 00 
+f01075ec:	c7 83 9c 00 00 00 00 	movl   $0xee800000,0x9c(%ebx)
+f01075f3:	00 80 ee 
+f01075f6:	89 bb a0 00 00 00    	mov    %edi,0xa0(%ebx)
+f01075fc:	8b 46 48             	mov    0x48(%esi),%eax
+f01075ff:	89 83 a4 00 00 00    	mov    %eax,0xa4(%ebx)
+f0107605:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107608:	89 83 a8 00 00 00    	mov    %eax,0xa8(%ebx)
+f010760e:	83 86 98 01 00 00 01 	addl   $0x1,0x198(%esi)
+f0107615:	83 83 9c 01 00 00 01 	addl   $0x1,0x19c(%ebx)
+f010761c:	f6 05 a8 b4 32 f0 08 	testb  $0x8,0xf032b4a8
+f0107623:	0f 85 e1 00 00 00    	jne    f010770a <ipc_deliver+0x183>
+f0107629:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f0107630:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107635:	e9 b1 00 00 00       	jmp    f01076eb <ipc_deliver+0x164>
+f010763a:	83 ec 04             	sub    $0x4,%esp
+f010763d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0107640:	50                   	push   %eax
+f0107641:	ff 75 08             	push   0x8(%ebp)
+f0107644:	ff 76 78             	push   0x78(%esi)
+f0107647:	e8 5b ab ff ff       	call   f01021a7 <page_lookup>
+f010764c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f010764f:	83 c4 10             	add    $0x10,%esp
+f0107652:	85 c0                	test   %eax,%eax
+f0107654:	0f 84 d3 00 00 00    	je     f010772d <ipc_deliver+0x1a6>
+f010765a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010765d:	83 e0 02             	and    $0x2,%eax
+f0107660:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0107663:	74 0c                	je     f0107671 <ipc_deliver+0xea>
+f0107665:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107668:	f6 00 02             	testb  $0x2,(%eax)
+f010766b:	0f 84 c3 00 00 00    	je     f0107734 <ipc_deliver+0x1ad>
+f0107671:	ff 75 0c             	push   0xc(%ebp)
+f0107674:	ff b3 9c 00 00 00    	push   0x9c(%ebx)
+f010767a:	ff 75 d0             	push   -0x30(%ebp)
+f010767d:	ff 73 78             	push   0x78(%ebx)
+f0107680:	e8 d0 ab ff ff       	call   f0102255 <page_insert>
+f0107685:	83 c4 10             	add    $0x10,%esp
+f0107688:	85 c0                	test   %eax,%eax
+f010768a:	0f 88 ab 00 00 00    	js     f010773b <ipc_deliver+0x1b4>
+f0107690:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+f0107697:	0f 84 3b ff ff ff    	je     f01075d8 <ipc_deliver+0x51>
+f010769d:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+f01076a4:	00 00 00 
+f01076a7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f01076ab:	75 0a                	jne    f01076b7 <ipc_deliver+0x130>
+f01076ad:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+f01076b3:	85 c0                	test   %eax,%eax
+f01076b5:	75 3c                	jne    f01076f3 <ipc_deliver+0x16c>
+f01076b7:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+f01076be:	00 00 00 
+f01076c1:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+f01076c8:	00 00 00 
+f01076cb:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+f01076d2:	00 00 00 
+f01076d5:	c7 83 9c 00 00 00 00 	movl   $0xee800000,0x9c(%ebx)
+f01076dc:	00 80 ee 
+f01076df:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f01076e6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01076eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01076ee:	5b                   	pop    %ebx
+f01076ef:	5e                   	pop    %esi
+f01076f0:	5f                   	pop    %edi
+f01076f1:	5d                   	pop    %ebp
+f01076f2:	c3                   	ret
+f01076f3:	ff 75 d0             	push   -0x30(%ebp)
+f01076f6:	ff b3 9c 00 00 00    	push   0x9c(%ebx)
+f01076fc:	50                   	push   %eax
+f01076fd:	ff 76 48             	push   0x48(%esi)
+f0107700:	e8 97 55 00 00       	call   f010cc9c <textcache_insert>
+f0107705:	83 c4 10             	add    $0x10,%esp
+f0107708:	eb ad                	jmp    f01076b7 <ipc_deliver+0x130>
+f010770a:	57                   	push   %edi
+f010770b:	ff 73 48             	push   0x48(%ebx)
+f010770e:	ff 76 48             	push   0x48(%esi)
+f0107711:	6a 03                	push   $0x3
+f0107713:	e8 6f 54 00 00       	call   f010cb87 <trace_record>
+f0107718:	83 c4 10             	add    $0x10,%esp
+f010771b:	e9 09 ff ff ff       	jmp    f0107629 <ipc_deliver+0xa2>
+f0107720:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f0107725:	c3                   	ret
+f0107726:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f010772b:	eb be                	jmp    f01076eb <ipc_deliver+0x164>
+f010772d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107732:	eb b7                	jmp    f01076eb <ipc_deliver+0x164>
+f0107734:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107739:	eb b0                	jmp    f01076eb <ipc_deliver+0x164>
+f010773b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0107740:	eb a9                	jmp    f01076eb <ipc_deliver+0x164>
+
+f0107742 <ipc_recv_queued>:
+f0107742:	55                   	push   %ebp
+f0107743:	89 e5                	mov    %esp,%ebp
+f0107745:	57                   	push   %edi
+f0107746:	56                   	push   %esi
+f0107747:	53                   	push   %ebx
+f0107748:	83 ec 1c             	sub    $0x1c,%esp
+f010774b:	8b b0 c4 00 00 00    	mov    0xc4(%eax),%esi
+f0107751:	85 f6                	test   %esi,%esi
+f0107753:	0f 84 63 01 00 00    	je     f01078bc <ipc_recv_queued+0x17a>
+f0107759:	89 c7                	mov    %eax,%edi
+f010775b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0107762:	eb 45                	jmp    f01077a9 <ipc_recv_queued+0x67>
+f0107764:	89 b7 c4 00 00 00    	mov    %esi,0xc4(%edi)
+f010776a:	eb 65                	jmp    f01077d1 <ipc_recv_queued+0x8f>
+f010776c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010776f:	89 87 c8 00 00 00    	mov    %eax,0xc8(%edi)
+f0107775:	eb 62                	jmp    f01077d9 <ipc_recv_queued+0x97>
+f0107777:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+f010777e:	00 00 00 
+f0107781:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+f0107788:	00 00 00 
+f010778b:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f0107792:	e8 a7 fb ff ff       	call   f010733e <sched_wakeup>
+f0107797:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f010779b:	0f 84 22 01 00 00    	je     f01078c3 <ipc_recv_queued+0x181>
+f01077a1:	85 f6                	test   %esi,%esi
+f01077a3:	0f 84 06 01 00 00    	je     f01078af <ipc_recv_queued+0x16d>
+f01077a9:	89 f3                	mov    %esi,%ebx
+f01077ab:	8b b6 c0 00 00 00    	mov    0xc0(%esi),%esi
+f01077b1:	8b 87 98 00 00 00    	mov    0x98(%edi),%eax
+f01077b7:	85 c0                	test   %eax,%eax
+f01077b9:	74 09                	je     f01077c4 <ipc_recv_queued+0x82>
+f01077bb:	3b 43 48             	cmp    0x48(%ebx),%eax
+f01077be:	0f 85 e3 00 00 00    	jne    f01078a7 <ipc_recv_queued+0x165>
+f01077c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01077c7:	85 c0                	test   %eax,%eax
+f01077c9:	74 99                	je     f0107764 <ipc_recv_queued+0x22>
+f01077cb:	89 b0 c0 00 00 00    	mov    %esi,0xc0(%eax)
+f01077d1:	3b 9f c8 00 00 00    	cmp    0xc8(%edi),%ebx
+f01077d7:	74 93                	je     f010776c <ipc_recv_queued+0x2a>
+f01077d9:	c7 83 c0 00 00 00 00 	movl   $0x0,0xc0(%ebx)
+f01077e0:	00 00 00 
+f01077e3:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+f01077ea:	00 00 00 
+f01077ed:	8b 8b b4 00 00 00    	mov    0xb4(%ebx),%ecx
+f01077f3:	83 ec 08             	sub    $0x8,%esp
+f01077f6:	ff b3 bc 00 00 00    	push   0xbc(%ebx)
+f01077fc:	ff b3 b8 00 00 00    	push   0xb8(%ebx)
+f0107802:	89 fa                	mov    %edi,%edx
+f0107804:	89 d8                	mov    %ebx,%eax
+f0107806:	e8 7c fd ff ff       	call   f0107587 <ipc_deliver>
+f010780b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010780e:	83 c4 10             	add    $0x10,%esp
+f0107811:	83 bb 8c 00 00 00 00 	cmpl   $0x0,0x8c(%ebx)
+f0107818:	74 28                	je     f0107842 <ipc_recv_queued+0x100>
+f010781a:	85 c0                	test   %eax,%eax
+f010781c:	0f 85 55 ff ff ff    	jne    f0107777 <ipc_recv_queued+0x35>
+f0107822:	c7 83 94 00 00 00 01 	movl   $0x1,0x94(%ebx)
+f0107829:	00 00 00 
+f010782c:	89 d8                	mov    %ebx,%eax
+f010782e:	e8 0f ff ff ff       	call   f0107742 <ipc_recv_queued>
+f0107833:	85 c0                	test   %eax,%eax
+f0107835:	0f 85 3c ff ff ff    	jne    f0107777 <ipc_recv_queued+0x35>
+f010783b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107840:	eb 72                	jmp    f01078b4 <ipc_recv_queued+0x172>
+f0107842:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107845:	89 43 1c             	mov    %eax,0x1c(%ebx)
+f0107848:	85 c0                	test   %eax,%eax
+f010784a:	75 7e                	jne    f01078ca <ipc_recv_queued+0x188>
+f010784c:	83 bb 98 00 00 00 00 	cmpl   $0x0,0x98(%ebx)
+f0107853:	75 1d                	jne    f0107872 <ipc_recv_queued+0x130>
+f0107855:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+f010785c:	00 00 00 
+f010785f:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f0107866:	e8 d3 fa ff ff       	call   f010733e <sched_wakeup>
+f010786b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107870:	eb 42                	jmp    f01078b4 <ipc_recv_queued+0x172>
+f0107872:	c7 83 94 00 00 00 01 	movl   $0x1,0x94(%ebx)
+f0107879:	00 00 00 
+f010787c:	c7 83 a0 00 00 00 00 	movl   $0x0,0xa0(%ebx)
+f0107883:	00 00 00 
+f0107886:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+f010788d:	00 00 00 
+f0107890:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+f0107897:	00 00 00 
+f010789a:	89 d8                	mov    %ebx,%eax
+f010789c:	e8 a1 fe ff ff       	call   f0107742 <ipc_recv_queued>
+f01078a1:	85 c0                	test   %eax,%eax
+f01078a3:	75 b0                	jne    f0107855 <ipc_recv_queued+0x113>
+f01078a5:	eb 94                	jmp    f010783b <ipc_recv_queued+0xf9>
+f01078a7:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+f01078aa:	e9 f2 fe ff ff       	jmp    f01077a1 <ipc_recv_queued+0x5f>
+f01078af:	b8 00 00 00 00       	mov    $0x0,%eax
+f01078b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01078b7:	5b                   	pop    %ebx
+f01078b8:	5e                   	pop    %esi
+f01078b9:	5f                   	pop    %edi
+f01078ba:	5d                   	pop    %ebp
+f01078bb:	c3                   	ret
+f01078bc:	b8 00 00 00 00       	mov    $0x0,%eax
+f01078c1:	eb f1                	jmp    f01078b4 <ipc_recv_queued+0x172>
+f01078c3:	b8 01 00 00 00       	mov    $0x1,%eax
+f01078c8:	eb ea                	jmp    f01078b4 <ipc_recv_queued+0x172>
+f01078ca:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+f01078d1:	00 00 00 
+f01078d4:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f01078db:	e8 5e fa ff ff       	call   f010733e <sched_wakeup>
+f01078e0:	e9 bc fe ff ff       	jmp    f01077a1 <ipc_recv_queued+0x5f>
+
+f01078e5 <ipc_enqueue>:
+f01078e5:	55                   	push   %ebp
+f01078e6:	89 e5                	mov    %esp,%ebp
+f01078e8:	57                   	push   %edi
+f01078e9:	56                   	push   %esi
+f01078ea:	53                   	push   %ebx
+f01078eb:	83 ec 0c             	sub    $0xc,%esp
+f01078ee:	89 c3                	mov    %eax,%ebx
+f01078f0:	89 d7                	mov    %edx,%edi
+f01078f2:	89 ce                	mov    %ecx,%esi
+f01078f4:	e8 58 36 00 00       	call   f010af51 <cpunum>
+f01078f9:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01078ff:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107905:	c7 80 ac 00 00 00 01 	movl   $0x1,0xac(%eax)
+f010790c:	00 00 00 
+f010790f:	e8 3d 36 00 00       	call   f010af51 <cpunum>
+f0107914:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010791a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107920:	8b 53 48             	mov    0x48(%ebx),%edx
+f0107923:	89 90 b0 00 00 00    	mov    %edx,0xb0(%eax)
+f0107929:	e8 23 36 00 00       	call   f010af51 <cpunum>
+f010792e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107934:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010793a:	89 b8 b4 00 00 00    	mov    %edi,0xb4(%eax)
+f0107940:	e8 0c 36 00 00       	call   f010af51 <cpunum>
+f0107945:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010794b:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107951:	89 b0 b8 00 00 00    	mov    %esi,0xb8(%eax)
+f0107957:	e8 f5 35 00 00       	call   f010af51 <cpunum>
+f010795c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107962:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107968:	8b 55 08             	mov    0x8(%ebp),%edx
+f010796b:	89 90 bc 00 00 00    	mov    %edx,0xbc(%eax)
+f0107971:	e8 db 35 00 00       	call   f010af51 <cpunum>
+f0107976:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010797c:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107982:	c7 80 c0 00 00 00 00 	movl   $0x0,0xc0(%eax)
+f0107989:	00 00 00 
+f010798c:	e8 c0 35 00 00       	call   f010af51 <cpunum>
+f0107991:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107997:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010799d:	8b 55 10             	mov    0x10(%ebp),%edx
+f01079a0:	89 90 98 00 00 00    	mov    %edx,0x98(%eax)
+f01079a6:	e8 a6 35 00 00       	call   f010af51 <cpunum>
+f01079ab:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01079b1:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01079b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01079ba:	89 90 9c 00 00 00    	mov    %edx,0x9c(%eax)
+f01079c0:	83 bb c4 00 00 00 00 	cmpl   $0x0,0xc4(%ebx)
+f01079c7:	74 54                	je     f0107a1d <ipc_enqueue+0x138>
+f01079c9:	e8 83 35 00 00       	call   f010af51 <cpunum>
+f01079ce:	8b 93 c8 00 00 00    	mov    0xc8(%ebx),%edx
+f01079d4:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01079da:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01079e0:	89 82 c0 00 00 00    	mov    %eax,0xc0(%edx)
+f01079e6:	e8 66 35 00 00       	call   f010af51 <cpunum>
+f01079eb:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01079f1:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01079f7:	89 83 c8 00 00 00    	mov    %eax,0xc8(%ebx)
+f01079fd:	e8 4f 35 00 00       	call   f010af51 <cpunum>
+f0107a02:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107a08:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107a0e:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+f0107a15:	83 c4 0c             	add    $0xc,%esp
+f0107a18:	5b                   	pop    %ebx
+f0107a19:	5e                   	pop    %esi
+f0107a1a:	5f                   	pop    %edi
+f0107a1b:	5d                   	pop    %ebp
+f0107a1c:	c3                   	ret
+f0107a1d:	e8 2f 35 00 00       	call   f010af51 <cpunum>
+f0107a22:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107a28:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107a2e:	89 83 c4 00 00 00    	mov    %eax,0xc4(%ebx)
+f0107a34:	eb b0                	jmp    f01079e6 <ipc_enqueue+0x101>
+
+f0107a36 <sys_page_unmap>:
+f0107a36:	55                   	push   %ebp
+f0107a37:	89 e5                	mov    %esp,%ebp
+f0107a39:	53                   	push   %ebx
+f0107a3a:	83 ec 18             	sub    $0x18,%esp
+f0107a3d:	89 d3                	mov    %edx,%ebx
+f0107a3f:	6a 01                	push   $0x1
+f0107a41:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f0107a44:	52                   	push   %edx
+f0107a45:	50                   	push   %eax
+f0107a46:	e8 17 d4 ff ff       	call   f0104e62 <envid2env>
+f0107a4b:	83 c4 10             	add    $0x10,%esp
+f0107a4e:	85 c0                	test   %eax,%eax
+f0107a50:	78 2c                	js     f0107a7e <sys_page_unmap+0x48>
+f0107a52:	81 fb ff ff 7f ee    	cmp    $0xee7fffff,%ebx
+f0107a58:	77 2b                	ja     f0107a85 <sys_page_unmap+0x4f>
+f0107a5a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0107a60:	75 2a                	jne    f0107a8c <sys_page_unmap+0x56>
+f0107a62:	83 ec 08             	sub    $0x8,%esp
+f0107a65:	53                   	push   %ebx
+f0107a66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0107a69:	ff 70 78             	push   0x78(%eax)
+f0107a6c:	e8 9e a7 ff ff       	call   f010220f <page_remove>
+f0107a71:	83 c4 10             	add    $0x10,%esp
+f0107a74:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107a79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107a7c:	c9                   	leave
+f0107a7d:	c3                   	ret
+f0107a7e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0107a83:	eb f4                	jmp    f0107a79 <sys_page_unmap+0x43>
+f0107a85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107a8a:	eb ed                	jmp    f0107a79 <sys_page_unmap+0x43>
+f0107a8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107a91:	eb e6                	jmp    f0107a79 <sys_page_unmap+0x43>
+
+f0107a93 <sys_page_alloc>:
+f0107a93:	55                   	push   %ebp
+f0107a94:	89 e5                	mov    %esp,%ebp
+f0107a96:	57                   	push   %edi
+f0107a97:	56                   	push   %esi
+f0107a98:	53                   	push   %ebx
+f0107a99:	83 ec 30             	sub    $0x30,%esp
+f0107a9c:	89 d6                	mov    %edx,%esi
+f0107a9e:	89 cb                	mov    %ecx,%ebx
+f0107aa0:	6a 01                	push   $0x1
+f0107aa2:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0107aa5:	52                   	push   %edx
+f0107aa6:	50                   	push   %eax
+f0107aa7:	e8 b6 d3 ff ff       	call   f0104e62 <envid2env>
+f0107aac:	83 c4 10             	add    $0x10,%esp
+f0107aaf:	85 c0                	test   %eax,%eax
+f0107ab1:	0f 88 ca 00 00 00    	js     f0107b81 <sys_page_alloc+0xee>
+f0107ab7:	81 fe ff ff 7f ee    	cmp    $0xee7fffff,%esi
+f0107abd:	0f 87 c7 00 00 00    	ja     f0107b8a <sys_page_alloc+0xf7>
+f0107ac3:	89 f0                	mov    %esi,%eax
+f0107ac5:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0107aca:	89 da                	mov    %ebx,%edx
+f0107acc:	83 e2 05             	and    $0x5,%edx
+f0107acf:	83 fa 05             	cmp    $0x5,%edx
+f0107ad2:	0f 85 bb 00 00 00    	jne    f0107b93 <sys_page_alloc+0x100>
+f0107ad8:	89 da                	mov    %ebx,%edx
+f0107ada:	81 e2 78 f1 ff ff    	and    $0xfffff178,%edx
+f0107ae0:	09 c2                	or     %eax,%edx
+f0107ae2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0107ae5:	0f 85 b1 00 00 00    	jne    f0107b9c <sys_page_alloc+0x109>
+f0107aeb:	f6 c3 80             	test   $0x80,%bl
+f0107aee:	74 1c                	je     f0107b0c <sys_page_alloc+0x79>
+f0107af0:	80 e3 7f             	and    $0x7f,%bl
+f0107af3:	f7 c6 ff ff 3f 00    	test   $0x3fffff,%esi
+f0107af9:	75 11                	jne    f0107b0c <sys_page_alloc+0x79>
+f0107afb:	89 f2                	mov    %esi,%edx
+f0107afd:	c1 ea 16             	shr    $0x16,%edx
+f0107b00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107b03:	8b 40 78             	mov    0x78(%eax),%eax
+f0107b06:	f6 04 90 01          	testb  $0x1,(%eax,%edx,4)
+f0107b0a:	74 37                	je     f0107b43 <sys_page_alloc+0xb0>
+f0107b0c:	83 ec 0c             	sub    $0xc,%esp
+f0107b0f:	6a 01                	push   $0x1
+f0107b11:	e8 77 a1 ff ff       	call   f0101c8d <page_alloc>
+f0107b16:	89 c7                	mov    %eax,%edi
+f0107b18:	83 c4 10             	add    $0x10,%esp
+f0107b1b:	85 c0                	test   %eax,%eax
+f0107b1d:	0f 84 82 00 00 00    	je     f0107ba5 <sys_page_alloc+0x112>
+f0107b23:	53                   	push   %ebx
+f0107b24:	56                   	push   %esi
+f0107b25:	50                   	push   %eax
+f0107b26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107b29:	ff 70 78             	push   0x78(%eax)
+f0107b2c:	e8 24 a7 ff ff       	call   f0102255 <page_insert>
+f0107b31:	83 c4 10             	add    $0x10,%esp
+f0107b34:	85 c0                	test   %eax,%eax
+f0107b36:	78 34                	js     f0107b6c <sys_page_alloc+0xd9>
+f0107b38:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0107b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107b3e:	5b                   	pop    %ebx
+f0107b3f:	5e                   	pop    %esi
+f0107b40:	5f                   	pop    %edi
+f0107b41:	5d                   	pop    %ebp
+f0107b42:	c3                   	ret
+f0107b43:	83 ec 08             	sub    $0x8,%esp
+f0107b46:	6a 03                	push   $0x3
+f0107b48:	6a 0a                	push   $0xa
+f0107b4a:	e8 99 c7 ff ff       	call   f01042e8 <page_alloc_npages>
+f0107b4f:	83 c4 10             	add    $0x10,%esp
+f0107b52:	85 c0                	test   %eax,%eax
+f0107b54:	74 b6                	je     f0107b0c <sys_page_alloc+0x79>
+f0107b56:	53                   	push   %ebx
+f0107b57:	56                   	push   %esi
+f0107b58:	50                   	push   %eax
+f0107b59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107b5c:	ff 70 78             	push   0x78(%eax)
+f0107b5f:	e8 19 a3 ff ff       	call   f0101e7d <page_insert_large>
+f0107b64:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0107b67:	83 c4 10             	add    $0x10,%esp
+f0107b6a:	eb cc                	jmp    f0107b38 <sys_page_alloc+0xa5>
+f0107b6c:	83 ec 0c             	sub    $0xc,%esp
+f0107b6f:	57                   	push   %edi
+f0107b70:	e8 d5 9e ff ff       	call   f0101a4a <page_free>
+f0107b75:	83 c4 10             	add    $0x10,%esp
+f0107b78:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0107b7f:	eb b7                	jmp    f0107b38 <sys_page_alloc+0xa5>
+f0107b81:	c7 45 d4 fe ff ff ff 	movl   $0xfffffffe,-0x2c(%ebp)
+f0107b88:	eb ae                	jmp    f0107b38 <sys_page_alloc+0xa5>
+f0107b8a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0107b91:	eb a5                	jmp    f0107b38 <sys_page_alloc+0xa5>
+f0107b93:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0107b9a:	eb 9c                	jmp    f0107b38 <sys_page_alloc+0xa5>
+f0107b9c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0107ba3:	eb 93                	jmp    f0107b38 <sys_page_alloc+0xa5>
+f0107ba5:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0107bac:	eb 8a                	jmp    f0107b38 <sys_page_alloc+0xa5>
+
+f0107bae <sys_ipc_try_send>:
+f0107bae:	55                   	push   %ebp
+f0107baf:	89 e5                	mov    %esp,%ebp
+f0107bb1:	57                   	push   %edi
+f0107bb2:	56                   	push   %esi
+f0107bb3:	53                   	push   %ebx
+f0107bb4:	83 ec 2c             	sub    $0x2c,%esp
+f0107bb7:	89 c6                	mov    %eax,%esi
+f0107bb9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0107bbc:	89 cf                	mov    %ecx,%edi
+f0107bbe:	e8 8e 33 00 00       	call   f010af51 <cpunum>
+f0107bc3:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107bc9:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107bcf:	83 b8 d4 00 00 00 00 	cmpl   $0x0,0xd4(%eax)
+f0107bd6:	74 21                	je     f0107bf9 <sys_ipc_try_send+0x4b>
+f0107bd8:	e8 74 33 00 00       	call   f010af51 <cpunum>
+f0107bdd:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107be3:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107be9:	89 f1                	mov    %esi,%ecx
+f0107beb:	33 88 d8 00 00 00    	xor    0xd8(%eax),%ecx
+f0107bf1:	81 f9 ff ff 0f 00    	cmp    $0xfffff,%ecx
+f0107bf7:	76 32                	jbe    f0107c2b <sys_ipc_try_send+0x7d>
+f0107bf9:	83 ec 04             	sub    $0x4,%esp
+f0107bfc:	6a 00                	push   $0x0
+f0107bfe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0107c01:	50                   	push   %eax
+f0107c02:	56                   	push   %esi
+f0107c03:	e8 5a d2 ff ff       	call   f0104e62 <envid2env>
+f0107c08:	83 c4 10             	add    $0x10,%esp
+f0107c0b:	85 c0                	test   %eax,%eax
+f0107c0d:	0f 88 4a 01 00 00    	js     f0107d5d <sys_ipc_try_send+0x1af>
+f0107c13:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0107c16:	8b 43 54             	mov    0x54(%ebx),%eax
+f0107c19:	83 f8 06             	cmp    $0x6,%eax
+f0107c1c:	0f 84 42 01 00 00    	je     f0107d64 <sys_ipc_try_send+0x1b6>
+f0107c22:	83 f8 05             	cmp    $0x5,%eax
+f0107c25:	0f 85 fb 00 00 00    	jne    f0107d26 <sys_ipc_try_send+0x178>
+f0107c2b:	83 ec 0c             	sub    $0xc,%esp
+f0107c2e:	6a 04                	push   $0x4
+f0107c30:	e8 2e d3 ff ff       	call   f0104f63 <env_service>
+f0107c35:	89 c7                	mov    %eax,%edi
+f0107c37:	83 c4 10             	add    $0x10,%esp
+f0107c3a:	85 c0                	test   %eax,%eax
+f0107c3c:	0f 84 29 01 00 00    	je     f0107d6b <sys_ipc_try_send+0x1bd>
+f0107c42:	83 ec 04             	sub    $0x4,%esp
+f0107c45:	6a 00                	push   $0x0
+f0107c47:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0107c4a:	50                   	push   %eax
+f0107c4b:	57                   	push   %edi
+f0107c4c:	e8 11 d2 ff ff       	call   f0104e62 <envid2env>
+f0107c51:	89 c3                	mov    %eax,%ebx
+f0107c53:	83 c4 10             	add    $0x10,%esp
+f0107c56:	85 c0                	test   %eax,%eax
+f0107c58:	0f 88 93 00 00 00    	js     f0107cf1 <sys_ipc_try_send+0x143>
+f0107c5e:	e8 ee 32 00 00       	call   f010af51 <cpunum>
+f0107c63:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107c69:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107c6f:	c7 40 54 06 00 00 00 	movl   $0x6,0x54(%eax)
+f0107c76:	e8 d6 32 00 00       	call   f010af51 <cpunum>
+f0107c7b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107c81:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107c87:	8b 40 48             	mov    0x48(%eax),%eax
+f0107c8a:	b9 07 00 00 00       	mov    $0x7,%ecx
+f0107c8f:	ba 00 10 40 00       	mov    $0x401000,%edx
+f0107c94:	e8 fa fd ff ff       	call   f0107a93 <sys_page_alloc>
+f0107c99:	89 35 00 10 40 00    	mov    %esi,0x401000
+f0107c9f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0107ca2:	a3 04 10 40 00       	mov    %eax,0x401004
+f0107ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107caa:	a3 08 10 40 00       	mov    %eax,0x401008
+f0107caf:	83 ec 0c             	sub    $0xc,%esp
+f0107cb2:	6a 05                	push   $0x5
+f0107cb4:	b9 00 10 40 00       	mov    $0x401000,%ecx
+f0107cb9:	ba 02 00 00 00       	mov    $0x2,%edx
+f0107cbe:	89 f8                	mov    %edi,%eax
+f0107cc0:	e8 e9 fe ff ff       	call   f0107bae <sys_ipc_try_send>
+f0107cc5:	89 c3                	mov    %eax,%ebx
+f0107cc7:	e8 85 32 00 00       	call   f010af51 <cpunum>
+f0107ccc:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107cd2:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107cd8:	8b 40 48             	mov    0x48(%eax),%eax
+f0107cdb:	ba 00 10 40 00       	mov    $0x401000,%edx
+f0107ce0:	e8 51 fd ff ff       	call   f0107a36 <sys_page_unmap>
+f0107ce5:	83 c4 10             	add    $0x10,%esp
+f0107ce8:	85 db                	test   %ebx,%ebx
+f0107cea:	78 0f                	js     f0107cfb <sys_ipc_try_send+0x14d>
+f0107cec:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107cf1:	89 d8                	mov    %ebx,%eax
+f0107cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107cf6:	5b                   	pop    %ebx
+f0107cf7:	5e                   	pop    %esi
+f0107cf8:	5f                   	pop    %edi
+f0107cf9:	5d                   	pop    %ebp
+f0107cfa:	c3                   	ret
+f0107cfb:	83 ec 08             	sub    $0x8,%esp
+f0107cfe:	53                   	push   %ebx
+f0107cff:	68 fc ea 10 f0       	push   $0xf010eafc
+f0107d04:	e8 fe df ff ff       	call   f0105d07 <cprintf>
+f0107d09:	e8 43 32 00 00       	call   f010af51 <cpunum>
+f0107d0e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107d14:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107d1a:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0107d21:	83 c4 10             	add    $0x10,%esp
+f0107d24:	eb cb                	jmp    f0107cf1 <sys_ipc_try_send+0x143>
+f0107d26:	e8 26 32 00 00       	call   f010af51 <cpunum>
+f0107d2b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107d31:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107d37:	83 ec 08             	sub    $0x8,%esp
+f0107d3a:	ff 75 08             	push   0x8(%ebp)
+f0107d3d:	57                   	push   %edi
+f0107d3e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0107d41:	89 da                	mov    %ebx,%edx
+f0107d43:	e8 3f f8 ff ff       	call   f0107587 <ipc_deliver>
+f0107d48:	89 c3                	mov    %eax,%ebx
+f0107d4a:	83 c4 10             	add    $0x10,%esp
+f0107d4d:	85 c0                	test   %eax,%eax
+f0107d4f:	78 a0                	js     f0107cf1 <sys_ipc_try_send+0x143>
+f0107d51:	e8 e8 f5 ff ff       	call   f010733e <sched_wakeup>
+f0107d56:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107d5b:	eb 94                	jmp    f0107cf1 <sys_ipc_try_send+0x143>
+f0107d5d:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0107d62:	eb 8d                	jmp    f0107cf1 <sys_ipc_try_send+0x143>
+f0107d64:	bb f9 ff ff ff       	mov    $0xfffffff9,%ebx
+f0107d69:	eb 86                	jmp    f0107cf1 <sys_ipc_try_send+0x143>
+f0107d6b:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0107d70:	e9 7c ff ff ff       	jmp    f0107cf1 <sys_ipc_try_send+0x143>
+
+f0107d75 <sys_env_swap>:
+f0107d75:	55                   	push   %ebp
+f0107d76:	89 e5                	mov    %esp,%ebp
+f0107d78:	57                   	push   %edi
+f0107d79:	56                   	push   %esi
+f0107d7a:	53                   	push   %ebx
+f0107d7b:	81 ec c0 01 00 00    	sub    $0x1c0,%esp
+f0107d81:	6a 01                	push   $0x1
+f0107d83:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0107d86:	52                   	push   %edx
+f0107d87:	50                   	push   %eax
+f0107d88:	e8 d5 d0 ff ff       	call   f0104e62 <envid2env>
+f0107d8d:	83 c4 10             	add    $0x10,%esp
+f0107d90:	85 c0                	test   %eax,%eax
+f0107d92:	0f 88 28 01 00 00    	js     f0107ec0 <sys_env_swap+0x14b>
+f0107d98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107d9b:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f0107d9f:	0f 85 22 01 00 00    	jne    f0107ec7 <sys_env_swap+0x152>
+f0107da5:	e8 a7 31 00 00       	call   f010af51 <cpunum>
+f0107daa:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107db0:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107db6:	8d bd 38 fe ff ff    	lea    -0x1c8(%ebp),%edi
+f0107dbc:	b9 6b 00 00 00       	mov    $0x6b,%ecx
+f0107dc1:	89 c6                	mov    %eax,%esi
+f0107dc3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0107dc5:	8b 58 78             	mov    0x78(%eax),%ebx
+f0107dc8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107dcb:	e8 81 31 00 00       	call   f010af51 <cpunum>
+f0107dd0:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107dd6:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107ddc:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0107de1:	89 c7                	mov    %eax,%edi
+f0107de3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0107de5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107de8:	e8 64 31 00 00       	call   f010af51 <cpunum>
+f0107ded:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107df3:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107df9:	8b 56 78             	mov    0x78(%esi),%edx
+f0107dfc:	89 50 78             	mov    %edx,0x78(%eax)
+f0107dff:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107e02:	e8 4a 31 00 00       	call   f010af51 <cpunum>
+f0107e07:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107e0d:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107e13:	8b 96 84 00 00 00    	mov    0x84(%esi),%edx
+f0107e19:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+f0107e1f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107e22:	e8 2a 31 00 00       	call   f010af51 <cpunum>
+f0107e27:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107e2d:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107e33:	8b 96 88 00 00 00    	mov    0x88(%esi),%edx
+f0107e39:	89 90 88 00 00 00    	mov    %edx,0x88(%eax)
+f0107e3f:	e8 0d 31 00 00       	call   f010af51 <cpunum>
+f0107e44:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107e4a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107e50:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f0107e57:	00 00 00 
+f0107e5a:	e8 f2 30 00 00       	call   f010af51 <cpunum>
+f0107e5f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107e65:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107e6b:	8b 40 78             	mov    0x78(%eax),%eax
+f0107e6e:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0107e73:	76 36                	jbe    f0107eab <sys_env_swap+0x136>
+f0107e75:	05 00 00 00 10       	add    $0x10000000,%eax
+f0107e7a:	0f 22 d8             	mov    %eax,%cr3
+f0107e7d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107e80:	89 58 78             	mov    %ebx,0x78(%eax)
+f0107e83:	8d b5 38 fe ff ff    	lea    -0x1c8(%ebp),%esi
+f0107e89:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0107e8e:	89 c7                	mov    %eax,%edi
+f0107e90:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0107e92:	83 ec 0c             	sub    $0xc,%esp
+f0107e95:	50                   	push   %eax
+f0107e96:	e8 3c d9 ff ff       	call   f01057d7 <env_destroy>
+f0107e9b:	83 c4 10             	add    $0x10,%esp
+f0107e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107ea3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107ea6:	5b                   	pop    %ebx
+f0107ea7:	5e                   	pop    %esi
+f0107ea8:	5f                   	pop    %edi
+f0107ea9:	5d                   	pop    %ebp
+f0107eaa:	c3                   	ret
+f0107eab:	50                   	push   %eax
+f0107eac:	68 48 d0 10 f0       	push   $0xf010d048
+f0107eb1:	68 aa 04 00 00       	push   $0x4aa
+f0107eb6:	68 78 eb 10 f0       	push   $0xf010eb78
+f0107ebb:	e8 80 81 ff ff       	call   f0100040 <_panic>
+f0107ec0:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0107ec5:	eb dc                	jmp    f0107ea3 <sys_env_swap+0x12e>
+f0107ec7:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0107ecc:	eb d5                	jmp    f0107ea3 <sys_env_swap+0x12e>
+
+f0107ece <ipc_block_recv>:
+f0107ece:	55                   	push   %ebp
+f0107ecf:	89 e5                	mov    %esp,%ebp
+f0107ed1:	56                   	push   %esi
+f0107ed2:	53                   	push   %ebx
+f0107ed3:	89 c3                	mov    %eax,%ebx
+f0107ed5:	89 d6                	mov    %edx,%esi
+f0107ed7:	f6 05 a8 b4 32 f0 10 	testb  $0x10,0xf032b4a8
+f0107ede:	0f 85 d3 00 00 00    	jne    f0107fb7 <ipc_block_recv+0xe9>
+f0107ee4:	e8 68 30 00 00       	call   f010af51 <cpunum>
+f0107ee9:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107eef:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107ef5:	c7 80 94 00 00 00 01 	movl   $0x1,0x94(%eax)
+f0107efc:	00 00 00 
+f0107eff:	e8 4d 30 00 00       	call   f010af51 <cpunum>
+f0107f04:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107f0a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107f10:	89 b0 98 00 00 00    	mov    %esi,0x98(%eax)
+f0107f16:	e8 36 30 00 00       	call   f010af51 <cpunum>
+f0107f1b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107f21:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107f27:	89 98 9c 00 00 00    	mov    %ebx,0x9c(%eax)
+f0107f2d:	e8 1f 30 00 00       	call   f010af51 <cpunum>
+f0107f32:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107f38:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107f3e:	c7 80 a0 00 00 00 00 	movl   $0x0,0xa0(%eax)
+f0107f45:	00 00 00 
+f0107f48:	e8 04 30 00 00       	call   f010af51 <cpunum>
+f0107f4d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107f53:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107f59:	c7 80 a4 00 00 00 00 	movl   $0x0,0xa4(%eax)
+f0107f60:	00 00 00 
+f0107f63:	e8 e9 2f 00 00       	call   f010af51 <cpunum>
+f0107f68:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107f6e:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107f74:	c7 80 a8 00 00 00 00 	movl   $0x0,0xa8(%eax)
+f0107f7b:	00 00 00 
+f0107f7e:	e8 ce 2f 00 00       	call   f010af51 <cpunum>
+f0107f83:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107f89:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107f8f:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+f0107f96:	e8 b6 2f 00 00       	call   f010af51 <cpunum>
+f0107f9b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107fa1:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107fa7:	e8 96 f7 ff ff       	call   f0107742 <ipc_recv_queued>
+f0107fac:	85 c0                	test   %eax,%eax
+f0107fae:	75 1a                	jne    f0107fca <ipc_block_recv+0xfc>
+f0107fb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107fb3:	5b                   	pop    %ebx
+f0107fb4:	5e                   	pop    %esi
+f0107fb5:	5d                   	pop    %ebp
+f0107fb6:	c3                   	ret
+f0107fb7:	6a 00                	push   $0x0
+f0107fb9:	50                   	push   %eax
+f0107fba:	52                   	push   %edx
+f0107fbb:	6a 04                	push   $0x4
+f0107fbd:	e8 c5 4b 00 00       	call   f010cb87 <trace_record>
+f0107fc2:	83 c4 10             	add    $0x10,%esp
+f0107fc5:	e9 1a ff ff ff       	jmp    f0107ee4 <ipc_block_recv+0x16>
+f0107fca:	e8 82 2f 00 00       	call   f010af51 <cpunum>
+f0107fcf:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0107fd5:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0107fdb:	c7 40 54 03 00 00 00 	movl   $0x3,0x54(%eax)
+f0107fe2:	eb cc                	jmp    f0107fb0 <ipc_block_recv+0xe2>
+
+f0107fe4 <ipc_send_switch>:
+f0107fe4:	55                   	push   %ebp
+f0107fe5:	89 e5                	mov    %esp,%ebp
+f0107fe7:	57                   	push   %edi
+f0107fe8:	56                   	push   %esi
+f0107fe9:	53                   	push   %ebx
+f0107fea:	83 ec 1c             	sub    $0x1c,%esp
+f0107fed:	89 c6                	mov    %eax,%esi
+f0107fef:	89 d7                	mov    %edx,%edi
+f0107ff1:	89 cb                	mov    %ecx,%ebx
+f0107ff3:	81 7d 0c ff ff 7f ee 	cmpl   $0xee7fffff,0xc(%ebp)
+f0107ffa:	77 0d                	ja     f0108009 <ipc_send_switch+0x25>
+f0107ffc:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f0108003:	0f 85 4f 01 00 00    	jne    f0108158 <ipc_send_switch+0x174>
+f0108009:	e8 43 2f 00 00       	call   f010af51 <cpunum>
+f010800e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108014:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010801a:	83 b8 d4 00 00 00 00 	cmpl   $0x0,0xd4(%eax)
+f0108021:	74 25                	je     f0108048 <ipc_send_switch+0x64>
+f0108023:	e8 29 2f 00 00       	call   f010af51 <cpunum>
+f0108028:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010802e:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108034:	89 f1                	mov    %esi,%ecx
+f0108036:	33 88 d8 00 00 00    	xor    0xd8(%eax),%ecx
+f010803c:	81 f9 ff ff 0f 00    	cmp    $0xfffff,%ecx
+f0108042:	0f 86 17 01 00 00    	jbe    f010815f <ipc_send_switch+0x17b>
+f0108048:	83 ec 04             	sub    $0x4,%esp
+f010804b:	6a 00                	push   $0x0
+f010804d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108050:	50                   	push   %eax
+f0108051:	56                   	push   %esi
+f0108052:	e8 0b ce ff ff       	call   f0104e62 <envid2env>
+f0108057:	83 c4 10             	add    $0x10,%esp
+f010805a:	85 c0                	test   %eax,%eax
+f010805c:	0f 88 04 01 00 00    	js     f0108166 <ipc_send_switch+0x182>
+f0108062:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0108065:	8b 46 54             	mov    0x54(%esi),%eax
+f0108068:	83 f8 05             	cmp    $0x5,%eax
+f010806b:	0f 84 fc 00 00 00    	je     f010816d <ipc_send_switch+0x189>
+f0108071:	83 f8 06             	cmp    $0x6,%eax
+f0108074:	0f 84 fa 00 00 00    	je     f0108174 <ipc_send_switch+0x190>
+f010807a:	e8 d2 2e 00 00       	call   f010af51 <cpunum>
+f010807f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108085:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010808b:	83 ec 08             	sub    $0x8,%esp
+f010808e:	ff 75 08             	push   0x8(%ebp)
+f0108091:	53                   	push   %ebx
+f0108092:	89 f9                	mov    %edi,%ecx
+f0108094:	89 f2                	mov    %esi,%edx
+f0108096:	e8 ec f4 ff ff       	call   f0107587 <ipc_deliver>
+f010809b:	83 c4 10             	add    $0x10,%esp
+f010809e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+f01080a1:	75 60                	jne    f0108103 <ipc_send_switch+0x11f>
+f01080a3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01080a7:	74 5a                	je     f0108103 <ipc_send_switch+0x11f>
+f01080a9:	81 fb ff ff 7f ee    	cmp    $0xee7fffff,%ebx
+f01080af:	77 2a                	ja     f01080db <ipc_send_switch+0xf7>
+f01080b1:	e8 9b 2e 00 00       	call   f010af51 <cpunum>
+f01080b6:	83 ec 04             	sub    $0x4,%esp
+f01080b9:	6a 00                	push   $0x0
+f01080bb:	53                   	push   %ebx
+f01080bc:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01080c2:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01080c8:	ff 70 78             	push   0x78(%eax)
+f01080cb:	e8 d7 a0 ff ff       	call   f01021a7 <page_lookup>
+f01080d0:	83 c4 10             	add    $0x10,%esp
+f01080d3:	85 c0                	test   %eax,%eax
+f01080d5:	0f 84 a0 00 00 00    	je     f010817b <ipc_send_switch+0x197>
+f01080db:	83 ec 04             	sub    $0x4,%esp
+f01080de:	ff 75 10             	push   0x10(%ebp)
+f01080e1:	ff 75 0c             	push   0xc(%ebp)
+f01080e4:	ff 75 08             	push   0x8(%ebp)
+f01080e7:	89 d9                	mov    %ebx,%ecx
+f01080e9:	89 fa                	mov    %edi,%edx
+f01080eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01080ee:	e8 f2 f7 ff ff       	call   f01078e5 <ipc_enqueue>
+f01080f3:	83 c4 10             	add    $0x10,%esp
+f01080f6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01080fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01080fe:	5b                   	pop    %ebx
+f01080ff:	5e                   	pop    %esi
+f0108100:	5f                   	pop    %edi
+f0108101:	5d                   	pop    %ebp
+f0108102:	c3                   	ret
+f0108103:	85 c0                	test   %eax,%eax
+f0108105:	78 f4                	js     f01080fb <ipc_send_switch+0x117>
+f0108107:	8b 55 10             	mov    0x10(%ebp),%edx
+f010810a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010810d:	e8 bc fd ff ff       	call   f0107ece <ipc_block_recv>
+f0108112:	e8 3a 2e 00 00       	call   f010af51 <cpunum>
+f0108117:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010811d:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108123:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+f010812a:	e8 22 2e 00 00       	call   f010af51 <cpunum>
+f010812f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108135:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010813b:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f010813f:	75 0c                	jne    f010814d <ipc_send_switch+0x169>
+f0108141:	e8 f8 f1 ff ff       	call   f010733e <sched_wakeup>
+f0108146:	b8 00 00 00 00       	mov    $0x0,%eax
+f010814b:	eb ae                	jmp    f01080fb <ipc_send_switch+0x117>
+f010814d:	83 ec 0c             	sub    $0xc,%esp
+f0108150:	ff 75 e4             	push   -0x1c(%ebp)
+f0108153:	e8 01 d8 ff ff       	call   f0105959 <env_run>
+f0108158:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010815d:	eb 9c                	jmp    f01080fb <ipc_send_switch+0x117>
+f010815f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+f0108164:	eb 95                	jmp    f01080fb <ipc_send_switch+0x117>
+f0108166:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f010816b:	eb 8e                	jmp    f01080fb <ipc_send_switch+0x117>
+f010816d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+f0108172:	eb 87                	jmp    f01080fb <ipc_send_switch+0x117>
+f0108174:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f0108179:	eb 80                	jmp    f01080fb <ipc_send_switch+0x117>
+f010817b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108180:	e9 76 ff ff ff       	jmp    f01080fb <ipc_send_switch+0x117>
+
+f0108185 <sys_page_map>:
+f0108185:	55                   	push   %ebp
+f0108186:	89 e5                	mov    %esp,%ebp
+f0108188:	57                   	push   %edi
+f0108189:	56                   	push   %esi
+f010818a:	53                   	push   %ebx
+f010818b:	83 ec 30             	sub    $0x30,%esp
+f010818e:	89 d3                	mov    %edx,%ebx
+f0108190:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+f0108193:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0108196:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0108199:	6a 01                	push   $0x1
+f010819b:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f010819e:	52                   	push   %edx
+f010819f:	50                   	push   %eax
+f01081a0:	e8 bd cc ff ff       	call   f0104e62 <envid2env>
+f01081a5:	83 c4 10             	add    $0x10,%esp
+f01081a8:	85 c0                	test   %eax,%eax
+f01081aa:	0f 88 5a 01 00 00    	js     f010830a <sys_page_map+0x185>
+f01081b0:	83 ec 04             	sub    $0x4,%esp
+f01081b3:	6a 01                	push   $0x1
+f01081b5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01081b8:	50                   	push   %eax
+f01081b9:	ff 75 d4             	push   -0x2c(%ebp)
+f01081bc:	e8 a1 cc ff ff       	call   f0104e62 <envid2env>
+f01081c1:	83 c4 10             	add    $0x10,%esp
+f01081c4:	85 c0                	test   %eax,%eax
+f01081c6:	0f 88 48 01 00 00    	js     f0108314 <sys_page_map+0x18f>
+f01081cc:	81 fb ff ff 7f ee    	cmp    $0xee7fffff,%ebx
+f01081d2:	0f 87 46 01 00 00    	ja     f010831e <sys_page_map+0x199>
+f01081d8:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f01081de:	0f 85 44 01 00 00    	jne    f0108328 <sys_page_map+0x1a3>
+f01081e4:	81 ff ff ff 7f ee    	cmp    $0xee7fffff,%edi
+f01081ea:	0f 87 42 01 00 00    	ja     f0108332 <sys_page_map+0x1ad>
+f01081f0:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+f01081f6:	0f 85 40 01 00 00    	jne    f010833c <sys_page_map+0x1b7>
+f01081fc:	f7 c6 80 00 00 00    	test   $0x80,%esi
+f0108202:	0f 84 94 00 00 00    	je     f010829c <sys_page_map+0x117>
+f0108208:	89 da                	mov    %ebx,%edx
+f010820a:	c1 ea 16             	shr    $0x16,%edx
+f010820d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108210:	8b 40 78             	mov    0x78(%eax),%eax
+f0108213:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0108216:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0108219:	89 f2                	mov    %esi,%edx
+f010821b:	80 e2 7f             	and    $0x7f,%dl
+f010821e:	8b 00                	mov    (%eax),%eax
+f0108220:	a8 80                	test   $0x80,%al
+f0108222:	0f 84 1e 01 00 00    	je     f0108346 <sys_page_map+0x1c1>
+f0108228:	f7 c3 ff ff 3f 00    	test   $0x3fffff,%ebx
+f010822e:	0f 85 1c 01 00 00    	jne    f0108350 <sys_page_map+0x1cb>
+f0108234:	89 f1                	mov    %esi,%ecx
+f0108236:	81 e1 7d f1 ff ff    	and    $0xfffff17d,%ecx
+f010823c:	83 f9 05             	cmp    $0x5,%ecx
+f010823f:	0f 85 15 01 00 00    	jne    f010835a <sys_page_map+0x1d5>
+f0108245:	f7 c6 02 00 00 00    	test   $0x2,%esi
+f010824b:	74 08                	je     f0108255 <sys_page_map+0xd0>
+f010824d:	a8 02                	test   $0x2,%al
+f010824f:	0f 84 0f 01 00 00    	je     f0108364 <sys_page_map+0x1df>
+f0108255:	c1 e8 0c             	shr    $0xc,%eax
+f0108258:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f010825e:	73 28                	jae    f0108288 <sys_page_map+0x103>
+f0108260:	52                   	push   %edx
+f0108261:	57                   	push   %edi
+f0108262:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0108265:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f010826a:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f010826d:	50                   	push   %eax
+f010826e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0108271:	ff 70 78             	push   0x78(%eax)
+f0108274:	e8 04 9c ff ff       	call   f0101e7d <page_insert_large>
+f0108279:	89 c3                	mov    %eax,%ebx
+f010827b:	83 c4 10             	add    $0x10,%esp
+f010827e:	89 d8                	mov    %ebx,%eax
+f0108280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108283:	5b                   	pop    %ebx
+f0108284:	5e                   	pop    %esi
+f0108285:	5f                   	pop    %edi
+f0108286:	5d                   	pop    %ebp
+f0108287:	c3                   	ret
+f0108288:	83 ec 04             	sub    $0x4,%esp
+f010828b:	68 44 d7 10 f0       	push   $0xf010d744
+f0108290:	6a 5a                	push   $0x5a
+f0108292:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0108297:	e8 a4 7d ff ff       	call   f0100040 <_panic>
+f010829c:	83 ec 04             	sub    $0x4,%esp
+f010829f:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f01082a2:	50                   	push   %eax
+f01082a3:	53                   	push   %ebx
+f01082a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01082a7:	ff 70 78             	push   0x78(%eax)
+f01082aa:	e8 f8 9e ff ff       	call   f01021a7 <page_lookup>
+f01082af:	83 c4 10             	add    $0x10,%esp
+f01082b2:	85 c0                	test   %eax,%eax
+f01082b4:	0f 84 b4 00 00 00    	je     f010836e <sys_page_map+0x1e9>
+f01082ba:	89 f2                	mov    %esi,%edx
+f01082bc:	83 e2 05             	and    $0x5,%edx
+f01082bf:	83 fa 05             	cmp    $0x5,%edx
+f01082c2:	0f 85 b0 00 00 00    	jne    f0108378 <sys_page_map+0x1f3>
+f01082c8:	89 f3                	mov    %esi,%ebx
+f01082ca:	81 e3 f8 f1 ff ff    	and    $0xfffff1f8,%ebx
+f01082d0:	0f 85 ac 00 00 00    	jne    f0108382 <sys_page_map+0x1fd>
+f01082d6:	f7 c6 02 00 00 00    	test   $0x2,%esi
+f01082dc:	74 0c                	je     f01082ea <sys_page_map+0x165>
+f01082de:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01082e1:	f6 02 02             	testb  $0x2,(%edx)
+f01082e4:	0f 84 a2 00 00 00    	je     f010838c <sys_page_map+0x207>
+f01082ea:	56                   	push   %esi
+f01082eb:	57                   	push   %edi
+f01082ec:	50                   	push   %eax
+f01082ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01082f0:	ff 70 78             	push   0x78(%eax)
+f01082f3:	e8 5d 9f ff ff       	call   f0102255 <page_insert>
+f01082f8:	83 c4 10             	add    $0x10,%esp
+f01082fb:	85 c0                	test   %eax,%eax
+f01082fd:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0108302:	0f 48 d8             	cmovs  %eax,%ebx
+f0108305:	e9 74 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f010830a:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f010830f:	e9 6a ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108314:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0108319:	e9 60 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f010831e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108323:	e9 56 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108328:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010832d:	e9 4c ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108332:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108337:	e9 42 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f010833c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108341:	e9 38 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108346:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010834b:	e9 2e ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108350:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108355:	e9 24 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f010835a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010835f:	e9 1a ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108364:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108369:	e9 10 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f010836e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108373:	e9 06 ff ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108378:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f010837d:	e9 fc fe ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f0108382:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108387:	e9 f2 fe ff ff       	jmp    f010827e <sys_page_map+0xf9>
+f010838c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+f0108391:	e9 e8 fe ff ff       	jmp    f010827e <sys_page_map+0xf9>
+
+f0108396 <ipc_cancel>:
+f0108396:	55                   	push   %ebp
+f0108397:	89 e5                	mov    %esp,%ebp
+f0108399:	53                   	push   %ebx
+f010839a:	83 ec 14             	sub    $0x14,%esp
+f010839d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01083a0:	83 bb ac 00 00 00 00 	cmpl   $0x0,0xac(%ebx)
+f01083a7:	75 13                	jne    f01083bc <ipc_cancel+0x26>
+f01083a9:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+f01083af:	85 c0                	test   %eax,%eax
+f01083b1:	0f 85 d9 00 00 00    	jne    f0108490 <ipc_cancel+0xfa>
+f01083b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01083ba:	c9                   	leave
+f01083bb:	c3                   	ret
+f01083bc:	83 ec 04             	sub    $0x4,%esp
+f01083bf:	6a 00                	push   $0x0
+f01083c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01083c4:	50                   	push   %eax
+f01083c5:	ff b3 b0 00 00 00    	push   0xb0(%ebx)
+f01083cb:	e8 92 ca ff ff       	call   f0104e62 <envid2env>
+f01083d0:	83 c4 10             	add    $0x10,%esp
+f01083d3:	85 c0                	test   %eax,%eax
+f01083d5:	75 d2                	jne    f01083a9 <ipc_cancel+0x13>
+f01083d7:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+f01083da:	8b 81 c4 00 00 00    	mov    0xc4(%ecx),%eax
+f01083e0:	39 c3                	cmp    %eax,%ebx
+f01083e2:	74 5a                	je     f010843e <ipc_cancel+0xa8>
+f01083e4:	85 c0                	test   %eax,%eax
+f01083e6:	74 10                	je     f01083f8 <ipc_cancel+0x62>
+f01083e8:	89 c2                	mov    %eax,%edx
+f01083ea:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+f01083f0:	39 c3                	cmp    %eax,%ebx
+f01083f2:	74 1d                	je     f0108411 <ipc_cancel+0x7b>
+f01083f4:	85 c0                	test   %eax,%eax
+f01083f6:	75 f0                	jne    f01083e8 <ipc_cancel+0x52>
+f01083f8:	68 87 eb 10 f0       	push   $0xf010eb87
+f01083fd:	68 0d e2 10 f0       	push   $0xf010e20d
+f0108402:	68 40 03 00 00       	push   $0x340
+f0108407:	68 78 eb 10 f0       	push   $0xf010eb78
+f010840c:	e8 2f 7c ff ff       	call   f0100040 <_panic>
+f0108411:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+f0108417:	89 82 c0 00 00 00    	mov    %eax,0xc0(%edx)
+f010841d:	3b 99 c8 00 00 00    	cmp    0xc8(%ecx),%ebx
+f0108423:	74 2c                	je     f0108451 <ipc_cancel+0xbb>
+f0108425:	c7 83 c0 00 00 00 00 	movl   $0x0,0xc0(%ebx)
+f010842c:	00 00 00 
+f010842f:	c7 83 ac 00 00 00 00 	movl   $0x0,0xac(%ebx)
+f0108436:	00 00 00 
+f0108439:	e9 6b ff ff ff       	jmp    f01083a9 <ipc_cancel+0x13>
+f010843e:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+f0108444:	89 81 c4 00 00 00    	mov    %eax,0xc4(%ecx)
+f010844a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010844f:	eb cc                	jmp    f010841d <ipc_cancel+0x87>
+f0108451:	89 91 c8 00 00 00    	mov    %edx,0xc8(%ecx)
+f0108457:	eb cc                	jmp    f0108425 <ipc_cancel+0x8f>
+f0108459:	c7 83 c8 00 00 00 00 	movl   $0x0,0xc8(%ebx)
+f0108460:	00 00 00 
+f0108463:	eb 3f                	jmp    f01084a4 <ipc_cancel+0x10e>
+f0108465:	c7 40 1c fe ff ff ff 	movl   $0xfffffffe,0x1c(%eax)
+f010846c:	c7 80 98 00 00 00 00 	movl   $0x0,0x98(%eax)
+f0108473:	00 00 00 
+f0108476:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f010847d:	e8 bc ee ff ff       	call   f010733e <sched_wakeup>
+f0108482:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+f0108488:	85 c0                	test   %eax,%eax
+f010848a:	0f 84 27 ff ff ff    	je     f01083b7 <ipc_cancel+0x21>
+f0108490:	8b 90 c0 00 00 00    	mov    0xc0(%eax),%edx
+f0108496:	89 93 c4 00 00 00    	mov    %edx,0xc4(%ebx)
+f010849c:	3b 83 c8 00 00 00    	cmp    0xc8(%ebx),%eax
+f01084a2:	74 b5                	je     f0108459 <ipc_cancel+0xc3>
+f01084a4:	c7 80 c0 00 00 00 00 	movl   $0x0,0xc0(%eax)
+f01084ab:	00 00 00 
+f01084ae:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+f01084b5:	00 00 00 
+f01084b8:	83 b8 8c 00 00 00 00 	cmpl   $0x0,0x8c(%eax)
+f01084bf:	74 a4                	je     f0108465 <ipc_cancel+0xcf>
+f01084c1:	c7 80 8c 00 00 00 00 	movl   $0x0,0x8c(%eax)
+f01084c8:	00 00 00 
+f01084cb:	eb 9f                	jmp    f010846c <ipc_cancel+0xd6>
+
+f01084cd <ipc_page_fault>:
+f01084cd:	55                   	push   %ebp
+f01084ce:	89 e5                	mov    %esp,%ebp
+f01084d0:	57                   	push   %edi
+f01084d1:	56                   	push   %esi
+f01084d2:	53                   	push   %ebx
+f01084d3:	83 ec 1c             	sub    $0x1c,%esp
+f01084d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01084d9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f01084df:	e8 6d 2a 00 00       	call   f010af51 <cpunum>
+f01084e4:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01084ea:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01084f0:	83 b8 84 00 00 00 00 	cmpl   $0x0,0x84(%eax)
+f01084f7:	0f 84 75 01 00 00    	je     f0108672 <ipc_page_fault+0x1a5>
+f01084fd:	8d 83 00 00 80 ff    	lea    -0x800000(%ebx),%eax
+f0108503:	3d ff ff ff ed       	cmp    $0xedffffff,%eax
+f0108508:	0f 87 64 01 00 00    	ja     f0108672 <ipc_page_fault+0x1a5>
+f010850e:	e8 3e 2a 00 00       	call   f010af51 <cpunum>
+f0108513:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108519:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010851f:	39 98 90 00 00 00    	cmp    %ebx,0x90(%eax)
+f0108525:	0f 84 47 01 00 00    	je     f0108672 <ipc_page_fault+0x1a5>
+f010852b:	e8 21 2a 00 00       	call   f010af51 <cpunum>
+f0108530:	83 ec 04             	sub    $0x4,%esp
+f0108533:	6a 00                	push   $0x0
+f0108535:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0108538:	52                   	push   %edx
+f0108539:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010853f:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108545:	ff b0 84 00 00 00    	push   0x84(%eax)
+f010854b:	e8 12 c9 ff ff       	call   f0104e62 <envid2env>
+f0108550:	83 c4 10             	add    $0x10,%esp
+f0108553:	85 c0                	test   %eax,%eax
+f0108555:	0f 88 17 01 00 00    	js     f0108672 <ipc_page_fault+0x1a5>
+f010855b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010855e:	8b 40 54             	mov    0x54(%eax),%eax
+f0108561:	83 e8 05             	sub    $0x5,%eax
+f0108564:	83 f8 01             	cmp    $0x1,%eax
+f0108567:	0f 86 05 01 00 00    	jbe    f0108672 <ipc_page_fault+0x1a5>
+f010856d:	e8 df 29 00 00       	call   f010af51 <cpunum>
+f0108572:	83 ec 04             	sub    $0x4,%esp
+f0108575:	53                   	push   %ebx
+f0108576:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010857c:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108582:	ff b0 88 00 00 00    	push   0x88(%eax)
+f0108588:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010858b:	ff 70 48             	push   0x48(%eax)
+f010858e:	e8 9c 46 00 00       	call   f010cc2f <textcache_lookup>
+f0108593:	89 c6                	mov    %eax,%esi
+f0108595:	83 c4 10             	add    $0x10,%esp
+f0108598:	85 c0                	test   %eax,%eax
+f010859a:	74 2a                	je     f01085c6 <ipc_page_fault+0xf9>
+f010859c:	e8 b0 29 00 00       	call   f010af51 <cpunum>
+f01085a1:	6a 05                	push   $0x5
+f01085a3:	53                   	push   %ebx
+f01085a4:	56                   	push   %esi
+f01085a5:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01085ab:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01085b1:	ff 70 78             	push   0x78(%eax)
+f01085b4:	e8 9c 9c ff ff       	call   f0102255 <page_insert>
+f01085b9:	89 c6                	mov    %eax,%esi
+f01085bb:	83 c4 10             	add    $0x10,%esp
+f01085be:	85 c0                	test   %eax,%eax
+f01085c0:	0f 84 ce 00 00 00    	je     f0108694 <ipc_page_fault+0x1c7>
+f01085c6:	e8 86 29 00 00       	call   f010af51 <cpunum>
+f01085cb:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01085d1:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01085d7:	89 98 90 00 00 00    	mov    %ebx,0x90(%eax)
+f01085dd:	e8 6f 29 00 00       	call   f010af51 <cpunum>
+f01085e2:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01085e8:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01085ee:	c7 80 8c 00 00 00 01 	movl   $0x1,0x8c(%eax)
+f01085f5:	00 00 00 
+f01085f8:	e8 54 29 00 00       	call   f010af51 <cpunum>
+f01085fd:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108603:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108609:	89 de                	mov    %ebx,%esi
+f010860b:	0b b0 88 00 00 00    	or     0x88(%eax),%esi
+f0108611:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0108614:	e8 38 29 00 00       	call   f010af51 <cpunum>
+f0108619:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010861f:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108625:	83 ec 08             	sub    $0x8,%esp
+f0108628:	6a 00                	push   $0x0
+f010862a:	68 00 00 80 ee       	push   $0xee800000
+f010862f:	89 f1                	mov    %esi,%ecx
+f0108631:	89 fa                	mov    %edi,%edx
+f0108633:	e8 4f ef ff ff       	call   f0107587 <ipc_deliver>
+f0108638:	83 c4 10             	add    $0x10,%esp
+f010863b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+f010863e:	74 71                	je     f01086b1 <ipc_page_fault+0x1e4>
+f0108640:	85 c0                	test   %eax,%eax
+f0108642:	0f 89 86 00 00 00    	jns    f01086ce <ipc_page_fault+0x201>
+f0108648:	e8 04 29 00 00       	call   f010af51 <cpunum>
+f010864d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108653:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108659:	c7 80 8c 00 00 00 00 	movl   $0x0,0x8c(%eax)
+f0108660:	00 00 00 
+f0108663:	be fa ff ff ff       	mov    $0xfffffffa,%esi
+f0108668:	89 f0                	mov    %esi,%eax
+f010866a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010866d:	5b                   	pop    %ebx
+f010866e:	5e                   	pop    %esi
+f010866f:	5f                   	pop    %edi
+f0108670:	5d                   	pop    %ebp
+f0108671:	c3                   	ret
+f0108672:	e8 da 28 00 00       	call   f010af51 <cpunum>
+f0108677:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010867d:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108683:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f010868a:	00 00 00 
+f010868d:	be fa ff ff ff       	mov    $0xfffffffa,%esi
+f0108692:	eb d4                	jmp    f0108668 <ipc_page_fault+0x19b>
+f0108694:	e8 b8 28 00 00       	call   f010af51 <cpunum>
+f0108699:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010869f:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01086a5:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f01086ac:	00 00 00 
+f01086af:	eb b7                	jmp    f0108668 <ipc_page_fault+0x19b>
+f01086b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01086b4:	83 ec 04             	sub    $0x4,%esp
+f01086b7:	ff 70 48             	push   0x48(%eax)
+f01086ba:	53                   	push   %ebx
+f01086bb:	6a 00                	push   $0x0
+f01086bd:	b9 00 00 80 ee       	mov    $0xee800000,%ecx
+f01086c2:	89 f2                	mov    %esi,%edx
+f01086c4:	e8 1c f2 ff ff       	call   f01078e5 <ipc_enqueue>
+f01086c9:	e8 2d eb ff ff       	call   f01071fb <sched_yield>
+f01086ce:	e8 7e 28 00 00       	call   f010af51 <cpunum>
+f01086d3:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01086d9:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01086df:	c7 80 94 00 00 00 01 	movl   $0x1,0x94(%eax)
+f01086e6:	00 00 00 
+f01086e9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01086ec:	e8 60 28 00 00       	call   f010af51 <cpunum>
+f01086f1:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01086f7:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01086fd:	8b 56 48             	mov    0x48(%esi),%edx
+f0108700:	89 90 98 00 00 00    	mov    %edx,0x98(%eax)
+f0108706:	e8 46 28 00 00       	call   f010af51 <cpunum>
+f010870b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108711:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108717:	89 98 9c 00 00 00    	mov    %ebx,0x9c(%eax)
+f010871d:	e8 2f 28 00 00       	call   f010af51 <cpunum>
+f0108722:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108728:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010872e:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+f0108735:	83 ec 0c             	sub    $0xc,%esp
+f0108738:	ff 75 e4             	push   -0x1c(%ebp)
+f010873b:	e8 19 d2 ff ff       	call   f0105959 <env_run>
+
+f0108740 <sys_copy_mem>:
+f0108740:	55                   	push   %ebp
+f0108741:	89 e5                	mov    %esp,%ebp
+f0108743:	56                   	push   %esi
+f0108744:	53                   	push   %ebx
+f0108745:	83 ec 10             	sub    $0x10,%esp
+f0108748:	8b 75 08             	mov    0x8(%ebp),%esi
+f010874b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010874e:	e8 fe 27 00 00       	call   f010af51 <cpunum>
+f0108753:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108759:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010875f:	8b 48 48             	mov    0x48(%eax),%ecx
+f0108762:	89 da                	mov    %ebx,%edx
+f0108764:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010876a:	83 ec 08             	sub    $0x8,%esp
+f010876d:	ff 75 14             	push   0x14(%ebp)
+f0108770:	68 00 00 40 00       	push   $0x400000
+f0108775:	89 f0                	mov    %esi,%eax
+f0108777:	e8 09 fa ff ff       	call   f0108185 <sys_page_map>
+f010877c:	83 c4 10             	add    $0x10,%esp
+f010877f:	85 c0                	test   %eax,%eax
+f0108781:	0f 88 9c 00 00 00    	js     f0108823 <sys_copy_mem+0xe3>
+f0108787:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+f010878b:	74 74                	je     f0108801 <sys_copy_mem+0xc1>
+f010878d:	83 ec 04             	sub    $0x4,%esp
+f0108790:	68 00 04 00 00       	push   $0x400
+f0108795:	ff 75 10             	push   0x10(%ebp)
+f0108798:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f010879e:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+f01087a4:	53                   	push   %ebx
+f01087a5:	e8 7f 21 00 00       	call   f010a929 <memmove>
+f01087aa:	83 c4 10             	add    $0x10,%esp
+f01087ad:	e8 9f 27 00 00       	call   f010af51 <cpunum>
+f01087b2:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01087b8:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01087be:	8b 40 48             	mov    0x48(%eax),%eax
+f01087c1:	ba 00 00 40 00       	mov    $0x400000,%edx
+f01087c6:	e8 6b f2 ff ff       	call   f0107a36 <sys_page_unmap>
+f01087cb:	85 c0                	test   %eax,%eax
+f01087cd:	78 5b                	js     f010882a <sys_copy_mem+0xea>
+f01087cf:	83 ec 04             	sub    $0x4,%esp
+f01087d2:	6a 00                	push   $0x0
+f01087d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01087d7:	50                   	push   %eax
+f01087d8:	56                   	push   %esi
+f01087d9:	e8 84 c6 ff ff       	call   f0104e62 <envid2env>
+f01087de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01087e1:	81 80 a4 01 00 00 00 	addl   $0x400,0x1a4(%eax)
+f01087e8:	04 00 00 
+f01087eb:	83 90 a8 01 00 00 00 	adcl   $0x0,0x1a8(%eax)
+f01087f2:	83 c4 10             	add    $0x10,%esp
+f01087f5:	b8 00 00 00 00       	mov    $0x0,%eax
+f01087fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01087fd:	5b                   	pop    %ebx
+f01087fe:	5e                   	pop    %esi
+f01087ff:	5d                   	pop    %ebp
+f0108800:	c3                   	ret
+f0108801:	83 ec 04             	sub    $0x4,%esp
+f0108804:	68 00 04 00 00       	push   $0x400
+f0108809:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f010880f:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+f0108815:	53                   	push   %ebx
+f0108816:	ff 75 10             	push   0x10(%ebp)
+f0108819:	e8 0b 21 00 00       	call   f010a929 <memmove>
+f010881e:	83 c4 10             	add    $0x10,%esp
+f0108821:	eb 8a                	jmp    f01087ad <sys_copy_mem+0x6d>
+f0108823:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108828:	eb d0                	jmp    f01087fa <sys_copy_mem+0xba>
+f010882a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010882f:	eb c9                	jmp    f01087fa <sys_copy_mem+0xba>
+
+f0108831 <sys_get_perms>:
+f0108831:	55                   	push   %ebp
+f0108832:	89 e5                	mov    %esp,%ebp
+f0108834:	53                   	push   %ebx
+f0108835:	83 ec 14             	sub    $0x14,%esp
+f0108838:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010883b:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0108841:	75 4b                	jne    f010888e <sys_get_perms+0x5d>
+f0108843:	83 ec 04             	sub    $0x4,%esp
+f0108846:	6a 00                	push   $0x0
+f0108848:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010884b:	50                   	push   %eax
+f010884c:	ff 75 08             	push   0x8(%ebp)
+f010884f:	e8 0e c6 ff ff       	call   f0104e62 <envid2env>
+f0108854:	83 c4 10             	add    $0x10,%esp
+f0108857:	85 c0                	test   %eax,%eax
+f0108859:	78 2e                	js     f0108889 <sys_get_perms+0x58>
+f010885b:	83 ec 04             	sub    $0x4,%esp
+f010885e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+f0108861:	50                   	push   %eax
+f0108862:	53                   	push   %ebx
+f0108863:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0108866:	ff 70 78             	push   0x78(%eax)
+f0108869:	e8 39 99 ff ff       	call   f01021a7 <page_lookup>
+f010886e:	83 c4 10             	add    $0x10,%esp
+f0108871:	85 c0                	test   %eax,%eax
+f0108873:	74 20                	je     f0108895 <sys_get_perms+0x64>
+f0108875:	8b 45 f0             	mov    -0x10(%ebp),%eax
+f0108878:	8b 00                	mov    (%eax),%eax
+f010887a:	25 07 0e 00 00       	and    $0xe07,%eax
+f010887f:	8b 55 10             	mov    0x10(%ebp),%edx
+f0108882:	89 02                	mov    %eax,(%edx)
+f0108884:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108889:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010888c:	c9                   	leave
+f010888d:	c3                   	ret
+f010888e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108893:	eb f4                	jmp    f0108889 <sys_get_perms+0x58>
+f0108895:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010889a:	eb ed                	jmp    f0108889 <sys_get_perms+0x58>
+
+f010889c <sys_env_unsuspend>:
+f010889c:	55                   	push   %ebp
+f010889d:	89 e5                	mov    %esp,%ebp
+f010889f:	53                   	push   %ebx
+f01088a0:	83 ec 18             	sub    $0x18,%esp
+f01088a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01088a6:	6a 00                	push   $0x0
+f01088a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01088ab:	50                   	push   %eax
+f01088ac:	ff 75 08             	push   0x8(%ebp)
+f01088af:	e8 ae c5 ff ff       	call   f0104e62 <envid2env>
+f01088b4:	83 c4 10             	add    $0x10,%esp
+f01088b7:	85 c0                	test   %eax,%eax
+f01088b9:	78 16                	js     f01088d1 <sys_env_unsuspend+0x35>
+f01088bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01088be:	8b 55 10             	mov    0x10(%ebp),%edx
+f01088c1:	89 50 1c             	mov    %edx,0x1c(%eax)
+f01088c4:	89 58 54             	mov    %ebx,0x54(%eax)
+f01088c7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01088cc:	83 fb 02             	cmp    $0x2,%ebx
+f01088cf:	74 05                	je     f01088d6 <sys_env_unsuspend+0x3a>
+f01088d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01088d4:	c9                   	leave
+f01088d5:	c3                   	ret
+f01088d6:	e8 63 ea ff ff       	call   f010733e <sched_wakeup>
+f01088db:	b8 00 00 00 00       	mov    $0x0,%eax
+f01088e0:	eb ef                	jmp    f01088d1 <sys_env_unsuspend+0x35>
+
+f01088e2 <sys_migrate>:
+f01088e2:	55                   	push   %ebp
+f01088e3:	89 e5                	mov    %esp,%ebp
+f01088e5:	56                   	push   %esi
+f01088e6:	53                   	push   %ebx
+f01088e7:	83 ec 1c             	sub    $0x1c,%esp
+f01088ea:	6a 04                	push   $0x4
+f01088ec:	e8 72 c6 ff ff       	call   f0104f63 <env_service>
+f01088f1:	83 c4 10             	add    $0x10,%esp
+f01088f4:	85 c0                	test   %eax,%eax
+f01088f6:	0f 84 f0 00 00 00    	je     f01089ec <sys_migrate+0x10a>
+f01088fc:	89 c6                	mov    %eax,%esi
+f01088fe:	83 ec 04             	sub    $0x4,%esp
+f0108901:	6a 00                	push   $0x0
+f0108903:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0108906:	50                   	push   %eax
+f0108907:	56                   	push   %esi
+f0108908:	e8 55 c5 ff ff       	call   f0104e62 <envid2env>
+f010890d:	89 c3                	mov    %eax,%ebx
+f010890f:	83 c4 10             	add    $0x10,%esp
+f0108912:	85 c0                	test   %eax,%eax
+f0108914:	0f 88 9e 00 00 00    	js     f01089b8 <sys_migrate+0xd6>
+f010891a:	e8 32 26 00 00       	call   f010af51 <cpunum>
+f010891f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108925:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010892b:	c7 40 54 06 00 00 00 	movl   $0x6,0x54(%eax)
+f0108932:	e8 1a 26 00 00       	call   f010af51 <cpunum>
+f0108937:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010893d:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108943:	8b 40 48             	mov    0x48(%eax),%eax
+f0108946:	b9 07 00 00 00       	mov    $0x7,%ecx
+f010894b:	ba 00 10 40 00       	mov    $0x401000,%edx
+f0108950:	e8 3e f1 ff ff       	call   f0107a93 <sys_page_alloc>
+f0108955:	e8 f7 25 00 00       	call   f010af51 <cpunum>
+f010895a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108960:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108966:	8b 40 48             	mov    0x48(%eax),%eax
+f0108969:	a3 00 10 40 00       	mov    %eax,0x401000
+f010896e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108971:	a3 04 10 40 00       	mov    %eax,0x401004
+f0108976:	83 ec 0c             	sub    $0xc,%esp
+f0108979:	6a 05                	push   $0x5
+f010897b:	b9 00 10 40 00       	mov    $0x401000,%ecx
+f0108980:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108985:	89 f0                	mov    %esi,%eax
+f0108987:	e8 22 f2 ff ff       	call   f0107bae <sys_ipc_try_send>
+f010898c:	89 c3                	mov    %eax,%ebx
+f010898e:	e8 be 25 00 00       	call   f010af51 <cpunum>
+f0108993:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108999:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010899f:	8b 40 48             	mov    0x48(%eax),%eax
+f01089a2:	ba 00 10 40 00       	mov    $0x401000,%edx
+f01089a7:	e8 8a f0 ff ff       	call   f0107a36 <sys_page_unmap>
+f01089ac:	83 c4 10             	add    $0x10,%esp
+f01089af:	85 db                	test   %ebx,%ebx
+f01089b1:	78 0e                	js     f01089c1 <sys_migrate+0xdf>
+f01089b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01089b8:	89 d8                	mov    %ebx,%eax
+f01089ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01089bd:	5b                   	pop    %ebx
+f01089be:	5e                   	pop    %esi
+f01089bf:	5d                   	pop    %ebp
+f01089c0:	c3                   	ret
+f01089c1:	83 ec 08             	sub    $0x8,%esp
+f01089c4:	53                   	push   %ebx
+f01089c5:	68 24 eb 10 f0       	push   $0xf010eb24
+f01089ca:	e8 38 d3 ff ff       	call   f0105d07 <cprintf>
+f01089cf:	e8 7d 25 00 00       	call   f010af51 <cpunum>
+f01089d4:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01089da:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01089e0:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f01089e7:	83 c4 10             	add    $0x10,%esp
+f01089ea:	eb cc                	jmp    f01089b8 <sys_migrate+0xd6>
+f01089ec:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f01089f1:	eb c5                	jmp    f01089b8 <sys_migrate+0xd6>
+
+f01089f3 <sys_lease_complete>:
+f01089f3:	55                   	push   %ebp
+f01089f4:	89 e5                	mov    %esp,%ebp
+f01089f6:	56                   	push   %esi
+f01089f7:	53                   	push   %ebx
+f01089f8:	83 ec 1c             	sub    $0x1c,%esp
+f01089fb:	6a 04                	push   $0x4
+f01089fd:	e8 61 c5 ff ff       	call   f0104f63 <env_service>
+f0108a02:	83 c4 10             	add    $0x10,%esp
+f0108a05:	85 c0                	test   %eax,%eax
+f0108a07:	0f 84 e8 00 00 00    	je     f0108af5 <sys_lease_complete+0x102>
+f0108a0d:	89 c6                	mov    %eax,%esi
+f0108a0f:	83 ec 04             	sub    $0x4,%esp
+f0108a12:	6a 00                	push   $0x0
+f0108a14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0108a17:	50                   	push   %eax
+f0108a18:	56                   	push   %esi
+f0108a19:	e8 44 c4 ff ff       	call   f0104e62 <envid2env>
+f0108a1e:	89 c3                	mov    %eax,%ebx
+f0108a20:	83 c4 10             	add    $0x10,%esp
+f0108a23:	85 c0                	test   %eax,%eax
+f0108a25:	0f 88 96 00 00 00    	js     f0108ac1 <sys_lease_complete+0xce>
+f0108a2b:	e8 21 25 00 00       	call   f010af51 <cpunum>
+f0108a30:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108a36:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108a3c:	c7 40 54 06 00 00 00 	movl   $0x6,0x54(%eax)
+f0108a43:	e8 09 25 00 00       	call   f010af51 <cpunum>
+f0108a48:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108a4e:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108a54:	8b 40 48             	mov    0x48(%eax),%eax
+f0108a57:	b9 07 00 00 00       	mov    $0x7,%ecx
+f0108a5c:	ba 00 10 40 00       	mov    $0x401000,%edx
+f0108a61:	e8 2d f0 ff ff       	call   f0107a93 <sys_page_alloc>
+f0108a66:	e8 e6 24 00 00       	call   f010af51 <cpunum>
+f0108a6b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108a71:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108a77:	8b 40 48             	mov    0x48(%eax),%eax
+f0108a7a:	a3 00 10 40 00       	mov    %eax,0x401000
+f0108a7f:	83 ec 0c             	sub    $0xc,%esp
+f0108a82:	6a 05                	push   $0x5
+f0108a84:	b9 00 10 40 00       	mov    $0x401000,%ecx
+f0108a89:	ba 01 00 00 00       	mov    $0x1,%edx
+f0108a8e:	89 f0                	mov    %esi,%eax
+f0108a90:	e8 19 f1 ff ff       	call   f0107bae <sys_ipc_try_send>
+f0108a95:	89 c3                	mov    %eax,%ebx
+f0108a97:	e8 b5 24 00 00       	call   f010af51 <cpunum>
+f0108a9c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108aa2:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108aa8:	8b 40 48             	mov    0x48(%eax),%eax
+f0108aab:	ba 00 10 40 00       	mov    $0x401000,%edx
+f0108ab0:	e8 81 ef ff ff       	call   f0107a36 <sys_page_unmap>
+f0108ab5:	83 c4 10             	add    $0x10,%esp
+f0108ab8:	85 db                	test   %ebx,%ebx
+f0108aba:	78 0e                	js     f0108aca <sys_lease_complete+0xd7>
+f0108abc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0108ac1:	89 d8                	mov    %ebx,%eax
+f0108ac3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108ac6:	5b                   	pop    %ebx
+f0108ac7:	5e                   	pop    %esi
+f0108ac8:	5d                   	pop    %ebp
+f0108ac9:	c3                   	ret
+f0108aca:	83 ec 08             	sub    $0x8,%esp
+f0108acd:	53                   	push   %ebx
+f0108ace:	68 4c eb 10 f0       	push   $0xf010eb4c
+f0108ad3:	e8 2f d2 ff ff       	call   f0105d07 <cprintf>
+f0108ad8:	e8 74 24 00 00       	call   f010af51 <cpunum>
+f0108add:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108ae3:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108ae9:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0108af0:	83 c4 10             	add    $0x10,%esp
+f0108af3:	eb cc                	jmp    f0108ac1 <sys_lease_complete+0xce>
+f0108af5:	bb fe ff ff ff       	mov    $0xfffffffe,%ebx
+f0108afa:	eb c5                	jmp    f0108ac1 <sys_lease_complete+0xce>
+
+f0108afc <sys_env_set_thisenv>:
+f0108afc:	55                   	push   %ebp
+f0108afd:	89 e5                	mov    %esp,%ebp
+f0108aff:	56                   	push   %esi
+f0108b00:	53                   	push   %ebx
+f0108b01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0108b04:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0108b07:	e8 45 24 00 00       	call   f010af51 <cpunum>
+f0108b0c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108b12:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108b18:	8b 48 48             	mov    0x48(%eax),%ecx
+f0108b1b:	89 f2                	mov    %esi,%edx
+f0108b1d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0108b23:	83 ec 08             	sub    $0x8,%esp
+f0108b26:	6a 07                	push   $0x7
+f0108b28:	68 00 00 40 00       	push   $0x400000
+f0108b2d:	89 d8                	mov    %ebx,%eax
+f0108b2f:	e8 51 f6 ff ff       	call   f0108185 <sys_page_map>
+f0108b34:	83 c4 10             	add    $0x10,%esp
+f0108b37:	85 c0                	test   %eax,%eax
+f0108b39:	78 49                	js     f0108b84 <sys_env_set_thisenv+0x88>
+f0108b3b:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+f0108b41:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+f0108b47:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+f0108b4d:	81 eb 00 00 40 11    	sub    $0x11400000,%ebx
+f0108b53:	89 9e 00 00 40 00    	mov    %ebx,0x400000(%esi)
+f0108b59:	e8 f3 23 00 00       	call   f010af51 <cpunum>
+f0108b5e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108b64:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108b6a:	8b 40 48             	mov    0x48(%eax),%eax
+f0108b6d:	ba 00 00 40 00       	mov    $0x400000,%edx
+f0108b72:	e8 bf ee ff ff       	call   f0107a36 <sys_page_unmap>
+f0108b77:	c1 f8 1f             	sar    $0x1f,%eax
+f0108b7a:	83 e0 fd             	and    $0xfffffffd,%eax
+f0108b7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108b80:	5b                   	pop    %ebx
+f0108b81:	5e                   	pop    %esi
+f0108b82:	5d                   	pop    %ebp
+f0108b83:	c3                   	ret
+f0108b84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0108b89:	eb f2                	jmp    f0108b7d <sys_env_set_thisenv+0x81>
+
+f0108b8b <syscall>:
+f0108b8b:	55                   	push   %ebp
+f0108b8c:	89 e5                	mov    %esp,%ebp
+f0108b8e:	57                   	push   %edi
+f0108b8f:	56                   	push   %esi
+f0108b90:	53                   	push   %ebx
+f0108b91:	83 ec 2c             	sub    $0x2c,%esp
+f0108b94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0108b97:	83 7d 08 28          	cmpl   $0x28,0x8(%ebp)
+f0108b9b:	76 1d                	jbe    f0108bba <syscall+0x2f>
+f0108b9d:	f6 05 a8 b4 32 f0 02 	testb  $0x2,0xf032b4a8
+f0108ba4:	75 32                	jne    f0108bd8 <syscall+0x4d>
+f0108ba6:	83 7d 08 28          	cmpl   $0x28,0x8(%ebp)
+f0108baa:	0f 87 77 0f 00 00    	ja     f0109b27 <syscall+0xf9c>
+f0108bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108bb3:	ff 24 85 8c eb 10 f0 	jmp    *-0xfef1474(,%eax,4)
+f0108bba:	e8 92 23 00 00       	call   f010af51 <cpunum>
+f0108bbf:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108bc5:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108bcb:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0108bce:	83 84 b8 ec 00 00 00 	addl   $0x1,0xec(%eax,%edi,4)
+f0108bd5:	01 
+f0108bd6:	eb c5                	jmp    f0108b9d <syscall+0x12>
+f0108bd8:	ff 75 10             	push   0x10(%ebp)
+f0108bdb:	53                   	push   %ebx
+f0108bdc:	ff 75 08             	push   0x8(%ebp)
+f0108bdf:	6a 01                	push   $0x1
+f0108be1:	e8 a1 3f 00 00       	call   f010cb87 <trace_record>
+f0108be6:	83 c4 10             	add    $0x10,%esp
+f0108be9:	eb bb                	jmp    f0108ba6 <syscall+0x1b>
+f0108beb:	e8 61 23 00 00       	call   f010af51 <cpunum>
+f0108bf0:	6a 04                	push   $0x4
+f0108bf2:	ff 75 10             	push   0x10(%ebp)
+f0108bf5:	53                   	push   %ebx
+f0108bf6:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108bfc:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0108c02:	e8 3a c0 ff ff       	call   f0104c41 <user_mem_assert>
+f0108c07:	83 c4 0c             	add    $0xc,%esp
+f0108c0a:	53                   	push   %ebx
+f0108c0b:	ff 75 10             	push   0x10(%ebp)
+f0108c0e:	68 d2 d3 10 f0       	push   $0xf010d3d2
+f0108c13:	e8 ef d0 ff ff       	call   f0105d07 <cprintf>
+f0108c18:	83 c4 10             	add    $0x10,%esp
+f0108c1b:	be 00 00 00 00       	mov    $0x0,%esi
+f0108c20:	f6 05 a8 b4 32 f0 04 	testb  $0x4,0xf032b4a8
+f0108c27:	0f 85 68 0f 00 00    	jne    f0109b95 <syscall+0x100a>
+f0108c2d:	89 f0                	mov    %esi,%eax
+f0108c2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108c32:	5b                   	pop    %ebx
+f0108c33:	5e                   	pop    %esi
+f0108c34:	5f                   	pop    %edi
+f0108c35:	5d                   	pop    %ebp
+f0108c36:	c3                   	ret
+f0108c37:	e8 8a 7a ff ff       	call   f01006c6 <cons_getc>
+f0108c3c:	89 c6                	mov    %eax,%esi
+f0108c3e:	eb e0                	jmp    f0108c20 <syscall+0x95>
+f0108c40:	e8 0c 23 00 00       	call   f010af51 <cpunum>
+f0108c45:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108c4b:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108c51:	8b 70 48             	mov    0x48(%eax),%esi
+f0108c54:	eb ca                	jmp    f0108c20 <syscall+0x95>
+f0108c56:	83 ec 04             	sub    $0x4,%esp
+f0108c59:	6a 01                	push   $0x1
+f0108c5b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108c5e:	50                   	push   %eax
+f0108c5f:	53                   	push   %ebx
+f0108c60:	e8 fd c1 ff ff       	call   f0104e62 <envid2env>
+f0108c65:	89 c6                	mov    %eax,%esi
+f0108c67:	83 c4 10             	add    $0x10,%esp
+f0108c6a:	85 c0                	test   %eax,%eax
+f0108c6c:	78 b2                	js     f0108c20 <syscall+0x95>
+f0108c6e:	83 ec 0c             	sub    $0xc,%esp
+f0108c71:	ff 75 e4             	push   -0x1c(%ebp)
+f0108c74:	e8 5e cb ff ff       	call   f01057d7 <env_destroy>
+f0108c79:	83 c4 10             	add    $0x10,%esp
+f0108c7c:	be 00 00 00 00       	mov    $0x0,%esi
+f0108c81:	eb 9d                	jmp    f0108c20 <syscall+0x95>
+f0108c83:	e8 73 e5 ff ff       	call   f01071fb <sched_yield>
+f0108c88:	e8 c4 22 00 00       	call   f010af51 <cpunum>
+f0108c8d:	83 ec 08             	sub    $0x8,%esp
+f0108c90:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108c96:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108c9c:	ff 70 48             	push   0x48(%eax)
+f0108c9f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108ca2:	50                   	push   %eax
+f0108ca3:	e8 86 c3 ff ff       	call   f010502e <env_alloc>
+f0108ca8:	89 c6                	mov    %eax,%esi
+f0108caa:	83 c4 10             	add    $0x10,%esp
+f0108cad:	85 c0                	test   %eax,%eax
+f0108caf:	0f 88 6b ff ff ff    	js     f0108c20 <syscall+0x95>
+f0108cb5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108cb8:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+f0108cbf:	e8 8d 22 00 00       	call   f010af51 <cpunum>
+f0108cc4:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108cca:	8b b0 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%esi
+f0108cd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108cd3:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0108cd8:	89 c7                	mov    %eax,%edi
+f0108cda:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0108cdc:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+f0108ce3:	e8 69 22 00 00       	call   f010af51 <cpunum>
+f0108ce8:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108cee:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108cf4:	8b 90 84 00 00 00    	mov    0x84(%eax),%edx
+f0108cfa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108cfd:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+f0108d03:	e8 49 22 00 00       	call   f010af51 <cpunum>
+f0108d08:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0108d0b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108d11:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108d17:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+f0108d1d:	89 82 88 00 00 00    	mov    %eax,0x88(%edx)
+f0108d23:	8b 72 48             	mov    0x48(%edx),%esi
+f0108d26:	e9 f5 fe ff ff       	jmp    f0108c20 <syscall+0x95>
+f0108d2b:	e8 21 22 00 00       	call   f010af51 <cpunum>
+f0108d30:	83 ec 08             	sub    $0x8,%esp
+f0108d33:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108d39:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108d3f:	ff 70 48             	push   0x48(%eax)
+f0108d42:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0108d45:	50                   	push   %eax
+f0108d46:	e8 e3 c2 ff ff       	call   f010502e <env_alloc>
+f0108d4b:	89 c6                	mov    %eax,%esi
+f0108d4d:	83 c4 10             	add    $0x10,%esp
+f0108d50:	85 c0                	test   %eax,%eax
+f0108d52:	0f 88 c8 fe ff ff    	js     f0108c20 <syscall+0x95>
+f0108d58:	e8 f4 21 00 00       	call   f010af51 <cpunum>
+f0108d5d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108d63:	8b b0 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%esi
+f0108d69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108d6c:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0108d71:	89 c7                	mov    %eax,%edi
+f0108d73:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0108d75:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+f0108d7c:	bf 00 00 80 00       	mov    $0x800000,%edi
+f0108d81:	c7 45 d0 08 00 00 00 	movl   $0x8,-0x30(%ebp)
+f0108d88:	e9 4d 01 00 00       	jmp    f0108eda <syscall+0x34f>
+f0108d8d:	83 ec 04             	sub    $0x4,%esp
+f0108d90:	68 44 d7 10 f0       	push   $0xf010d744
+f0108d95:	6a 5a                	push   $0x5a
+f0108d97:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0108d9c:	e8 9f 72 ff ff       	call   f0100040 <_panic>
+f0108da1:	e8 ab 21 00 00       	call   f010af51 <cpunum>
+f0108da6:	83 ec 04             	sub    $0x4,%esp
+f0108da9:	6a 00                	push   $0x0
+f0108dab:	57                   	push   %edi
+f0108dac:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108db2:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108db8:	ff 70 78             	push   0x78(%eax)
+f0108dbb:	e8 4c 91 ff ff       	call   f0101f0c <pgdir_walk>
+f0108dc0:	83 c4 10             	add    $0x10,%esp
+f0108dc3:	85 c0                	test   %eax,%eax
+f0108dc5:	0f 84 d3 01 00 00    	je     f0108f9e <syscall+0x413>
+f0108dcb:	e8 81 21 00 00       	call   f010af51 <cpunum>
+f0108dd0:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108dd6:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108ddc:	8b 40 78             	mov    0x78(%eax),%eax
+f0108ddf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0108de2:	8b 04 30             	mov    (%eax,%esi,1),%eax
+f0108de5:	89 c3                	mov    %eax,%ebx
+f0108de7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f0108ded:	c1 e8 0c             	shr    $0xc,%eax
+f0108df0:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0108df6:	73 0f                	jae    f0108e07 <syscall+0x27c>
+f0108df8:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+f0108dfe:	89 f9                	mov    %edi,%ecx
+f0108e00:	bb 00 10 00 00       	mov    $0x1000,%ebx
+f0108e05:	eb 69                	jmp    f0108e70 <syscall+0x2e5>
+f0108e07:	53                   	push   %ebx
+f0108e08:	68 24 d0 10 f0       	push   $0xf010d024
+f0108e0d:	68 9b 00 00 00       	push   $0x9b
+f0108e12:	68 78 eb 10 f0       	push   $0xf010eb78
+f0108e17:	e8 24 72 ff ff       	call   f0100040 <_panic>
+f0108e1c:	8b 06                	mov    (%esi),%eax
+f0108e1e:	c1 e8 0c             	shr    $0xc,%eax
+f0108e21:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0108e27:	0f 83 81 00 00 00    	jae    f0108eae <syscall+0x323>
+f0108e2d:	ff 75 d4             	push   -0x2c(%ebp)
+f0108e30:	51                   	push   %ecx
+f0108e31:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0108e34:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f0108e39:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0108e3c:	50                   	push   %eax
+f0108e3d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108e40:	ff 70 78             	push   0x78(%eax)
+f0108e43:	e8 0d 94 ff ff       	call   f0102255 <page_insert>
+f0108e48:	83 c4 10             	add    $0x10,%esp
+f0108e4b:	85 c0                	test   %eax,%eax
+f0108e4d:	0f 88 4b 01 00 00    	js     f0108f9e <syscall+0x413>
+f0108e53:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0108e59:	74 67                	je     f0108ec2 <syscall+0x337>
+f0108e5b:	89 d9                	mov    %ebx,%ecx
+f0108e5d:	09 f9                	or     %edi,%ecx
+f0108e5f:	83 c6 04             	add    $0x4,%esi
+f0108e62:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0108e68:	81 f9 00 f0 7f ee    	cmp    $0xee7ff000,%ecx
+f0108e6e:	74 52                	je     f0108ec2 <syscall+0x337>
+f0108e70:	8b 06                	mov    (%esi),%eax
+f0108e72:	a8 01                	test   $0x1,%al
+f0108e74:	74 dd                	je     f0108e53 <syscall+0x2c8>
+f0108e76:	89 c2                	mov    %eax,%edx
+f0108e78:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+f0108e7e:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0108e81:	f6 c4 02             	test   $0x2,%ah
+f0108e84:	75 cd                	jne    f0108e53 <syscall+0x2c8>
+f0108e86:	f6 c4 04             	test   $0x4,%ah
+f0108e89:	75 91                	jne    f0108e1c <syscall+0x291>
+f0108e8b:	a9 02 08 00 00       	test   $0x802,%eax
+f0108e90:	74 8a                	je     f0108e1c <syscall+0x291>
+f0108e92:	89 c2                	mov    %eax,%edx
+f0108e94:	81 e2 05 06 00 00    	and    $0x605,%edx
+f0108e9a:	80 ce 08             	or     $0x8,%dh
+f0108e9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0108ea0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0108ea5:	09 d0                	or     %edx,%eax
+f0108ea7:	89 06                	mov    %eax,(%esi)
+f0108ea9:	e9 6e ff ff ff       	jmp    f0108e1c <syscall+0x291>
+f0108eae:	83 ec 04             	sub    $0x4,%esp
+f0108eb1:	68 44 d7 10 f0       	push   $0xf010d744
+f0108eb6:	6a 5a                	push   $0x5a
+f0108eb8:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f0108ebd:	e8 7e 71 ff ff       	call   f0100040 <_panic>
+f0108ec2:	83 45 d0 04          	addl   $0x4,-0x30(%ebp)
+f0108ec6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0108ec9:	81 c7 00 00 40 00    	add    $0x400000,%edi
+f0108ecf:	3d e8 0e 00 00       	cmp    $0xee8,%eax
+f0108ed4:	0f 84 03 01 00 00    	je     f0108fdd <syscall+0x452>
+f0108eda:	e8 72 20 00 00       	call   f010af51 <cpunum>
+f0108edf:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108ee5:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108eeb:	8b 40 78             	mov    0x78(%eax),%eax
+f0108eee:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0108ef1:	f6 04 30 01          	testb  $0x1,(%eax,%esi,1)
+f0108ef5:	74 cb                	je     f0108ec2 <syscall+0x337>
+f0108ef7:	e8 55 20 00 00       	call   f010af51 <cpunum>
+f0108efc:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108f02:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108f08:	8b 40 78             	mov    0x78(%eax),%eax
+f0108f0b:	f6 04 30 80          	testb  $0x80,(%eax,%esi,1)
+f0108f0f:	0f 84 b6 fe ff ff    	je     f0108dcb <syscall+0x240>
+f0108f15:	e8 37 20 00 00       	call   f010af51 <cpunum>
+f0108f1a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108f20:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108f26:	8b 40 78             	mov    0x78(%eax),%eax
+f0108f29:	8b 04 30             	mov    (%eax,%esi,1),%eax
+f0108f2c:	f6 c4 04             	test   $0x4,%ah
+f0108f2f:	0f 84 6c fe ff ff    	je     f0108da1 <syscall+0x216>
+f0108f35:	e8 17 20 00 00       	call   f010af51 <cpunum>
+f0108f3a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108f40:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108f46:	8b 40 78             	mov    0x78(%eax),%eax
+f0108f49:	8b 04 30             	mov    (%eax,%esi,1),%eax
+f0108f4c:	c1 e8 0c             	shr    $0xc,%eax
+f0108f4f:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f0108f55:	0f 83 32 fe ff ff    	jae    f0108d8d <syscall+0x202>
+f0108f5b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0108f5e:	a1 70 1a 2d f0       	mov    0xf02d1a70,%eax
+f0108f63:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+f0108f66:	e8 e6 1f 00 00       	call   f010af51 <cpunum>
+f0108f6b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108f71:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108f77:	8b 40 78             	mov    0x78(%eax),%eax
+f0108f7a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0108f7d:	8b 04 30             	mov    (%eax,%esi,1),%eax
+f0108f80:	25 07 0e 00 00       	and    $0xe07,%eax
+f0108f85:	50                   	push   %eax
+f0108f86:	57                   	push   %edi
+f0108f87:	53                   	push   %ebx
+f0108f88:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108f8b:	ff 70 78             	push   0x78(%eax)
+f0108f8e:	e8 ea 8e ff ff       	call   f0101e7d <page_insert_large>
+f0108f93:	83 c4 10             	add    $0x10,%esp
+f0108f96:	85 c0                	test   %eax,%eax
+f0108f98:	0f 89 24 ff ff ff    	jns    f0108ec2 <syscall+0x337>
+f0108f9e:	e8 ae 1f 00 00       	call   f010af51 <cpunum>
+f0108fa3:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108fa9:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108faf:	8b 40 78             	mov    0x78(%eax),%eax
+f0108fb2:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0108fb7:	0f 86 2f 01 00 00    	jbe    f01090ec <syscall+0x561>
+f0108fbd:	05 00 00 00 10       	add    $0x10000000,%eax
+f0108fc2:	0f 22 d8             	mov    %eax,%cr3
+f0108fc5:	83 ec 0c             	sub    $0xc,%esp
+f0108fc8:	ff 75 e4             	push   -0x1c(%ebp)
+f0108fcb:	e8 09 c4 ff ff       	call   f01053d9 <env_free>
+f0108fd0:	83 c4 10             	add    $0x10,%esp
+f0108fd3:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0108fd8:	e9 43 fc ff ff       	jmp    f0108c20 <syscall+0x95>
+f0108fdd:	e8 6f 1f 00 00       	call   f010af51 <cpunum>
+f0108fe2:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0108fe8:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0108fee:	8b 40 78             	mov    0x78(%eax),%eax
+f0108ff1:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0108ff6:	0f 86 ca 00 00 00    	jbe    f01090c6 <syscall+0x53b>
+f0108ffc:	05 00 00 00 10       	add    $0x10000000,%eax
+f0109001:	0f 22 d8             	mov    %eax,%cr3
+f0109004:	83 ec 0c             	sub    $0xc,%esp
+f0109007:	6a 01                	push   $0x1
+f0109009:	e8 7f 8c ff ff       	call   f0101c8d <page_alloc>
+f010900e:	89 c3                	mov    %eax,%ebx
+f0109010:	83 c4 10             	add    $0x10,%esp
+f0109013:	85 c0                	test   %eax,%eax
+f0109015:	74 87                	je     f0108f9e <syscall+0x413>
+f0109017:	6a 07                	push   $0x7
+f0109019:	68 00 f0 7f ee       	push   $0xee7ff000
+f010901e:	50                   	push   %eax
+f010901f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109022:	ff 70 78             	push   0x78(%eax)
+f0109025:	e8 2b 92 ff ff       	call   f0102255 <page_insert>
+f010902a:	83 c4 10             	add    $0x10,%esp
+f010902d:	85 c0                	test   %eax,%eax
+f010902f:	0f 88 a6 00 00 00    	js     f01090db <syscall+0x550>
+f0109035:	e8 17 1f 00 00       	call   f010af51 <cpunum>
+f010903a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109040:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109046:	8b 50 7c             	mov    0x7c(%eax),%edx
+f0109049:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010904c:	89 50 7c             	mov    %edx,0x7c(%eax)
+f010904f:	e8 fd 1e 00 00       	call   f010af51 <cpunum>
+f0109054:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010905a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109060:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+f0109066:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109069:	89 90 80 00 00 00    	mov    %edx,0x80(%eax)
+f010906f:	e8 dd 1e 00 00       	call   f010af51 <cpunum>
+f0109074:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010907a:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109080:	8b 90 84 00 00 00    	mov    0x84(%eax),%edx
+f0109086:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109089:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+f010908f:	e8 bd 1e 00 00       	call   f010af51 <cpunum>
+f0109094:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0109097:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010909d:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01090a3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+f01090a9:	89 82 88 00 00 00    	mov    %eax,0x88(%edx)
+f01090af:	c7 42 54 02 00 00 00 	movl   $0x2,0x54(%edx)
+f01090b6:	e8 83 e2 ff ff       	call   f010733e <sched_wakeup>
+f01090bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01090be:	8b 70 48             	mov    0x48(%eax),%esi
+f01090c1:	e9 5a fb ff ff       	jmp    f0108c20 <syscall+0x95>
+f01090c6:	50                   	push   %eax
+f01090c7:	68 48 d0 10 f0       	push   $0xf010d048
+f01090cc:	68 b3 00 00 00       	push   $0xb3
+f01090d1:	68 78 eb 10 f0       	push   $0xf010eb78
+f01090d6:	e8 65 6f ff ff       	call   f0100040 <_panic>
+f01090db:	83 ec 0c             	sub    $0xc,%esp
+f01090de:	53                   	push   %ebx
+f01090df:	e8 66 89 ff ff       	call   f0101a4a <page_free>
+f01090e4:	83 c4 10             	add    $0x10,%esp
+f01090e7:	e9 b2 fe ff ff       	jmp    f0108f9e <syscall+0x413>
+f01090ec:	50                   	push   %eax
+f01090ed:	68 48 d0 10 f0       	push   $0xf010d048
+f01090f2:	68 c8 00 00 00       	push   $0xc8
+f01090f7:	68 78 eb 10 f0       	push   $0xf010eb78
+f01090fc:	e8 3f 6f ff ff       	call   f0100040 <_panic>
+f0109101:	83 ec 04             	sub    $0x4,%esp
+f0109104:	6a 01                	push   $0x1
+f0109106:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109109:	50                   	push   %eax
+f010910a:	53                   	push   %ebx
+f010910b:	e8 52 bd ff ff       	call   f0104e62 <envid2env>
+f0109110:	83 c4 10             	add    $0x10,%esp
+f0109113:	85 c0                	test   %eax,%eax
+f0109115:	78 16                	js     f010912d <syscall+0x5a2>
+f0109117:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010911a:	8b 7d 10             	mov    0x10(%ebp),%edi
+f010911d:	89 b8 80 00 00 00    	mov    %edi,0x80(%eax)
+f0109123:	be 00 00 00 00       	mov    $0x0,%esi
+f0109128:	e9 f3 fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f010912d:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0109132:	e9 e9 fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109137:	83 fb 05             	cmp    $0x5,%ebx
+f010913a:	0f 87 f1 09 00 00    	ja     f0109b31 <syscall+0xfa6>
+f0109140:	83 ec 0c             	sub    $0xc,%esp
+f0109143:	53                   	push   %ebx
+f0109144:	e8 1a be ff ff       	call   f0104f63 <env_service>
+f0109149:	89 c6                	mov    %eax,%esi
+f010914b:	83 c4 10             	add    $0x10,%esp
+f010914e:	e9 cd fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109153:	83 ec 04             	sub    $0x4,%esp
+f0109156:	6a 01                	push   $0x1
+f0109158:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010915b:	50                   	push   %eax
+f010915c:	53                   	push   %ebx
+f010915d:	e8 00 bd ff ff       	call   f0104e62 <envid2env>
+f0109162:	83 c4 10             	add    $0x10,%esp
+f0109165:	85 c0                	test   %eax,%eax
+f0109167:	78 2e                	js     f0109197 <syscall+0x60c>
+f0109169:	8b 45 10             	mov    0x10(%ebp),%eax
+f010916c:	83 e8 02             	sub    $0x2,%eax
+f010916f:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0109174:	75 2b                	jne    f01091a1 <syscall+0x616>
+f0109176:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109179:	8b 7d 10             	mov    0x10(%ebp),%edi
+f010917c:	89 78 54             	mov    %edi,0x54(%eax)
+f010917f:	be 00 00 00 00       	mov    $0x0,%esi
+f0109184:	83 ff 02             	cmp    $0x2,%edi
+f0109187:	0f 85 93 fa ff ff    	jne    f0108c20 <syscall+0x95>
+f010918d:	e8 ac e1 ff ff       	call   f010733e <sched_wakeup>
+f0109192:	e9 89 fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109197:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f010919c:	e9 7f fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f01091a1:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01091a6:	e9 75 fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f01091ab:	8b 75 10             	mov    0x10(%ebp),%esi
+f01091ae:	83 ec 04             	sub    $0x4,%esp
+f01091b1:	6a 01                	push   $0x1
+f01091b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01091b6:	50                   	push   %eax
+f01091b7:	53                   	push   %ebx
+f01091b8:	e8 a5 bc ff ff       	call   f0104e62 <envid2env>
+f01091bd:	83 c4 10             	add    $0x10,%esp
+f01091c0:	85 c0                	test   %eax,%eax
+f01091c2:	78 29                	js     f01091ed <syscall+0x662>
+f01091c4:	8b 45 10             	mov    0x10(%ebp),%eax
+f01091c7:	81 78 30 ff ff 7f ee 	cmpl   $0xee7fffff,0x30(%eax)
+f01091ce:	77 27                	ja     f01091f7 <syscall+0x66c>
+f01091d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01091d3:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01091d8:	89 c7                	mov    %eax,%edi
+f01091da:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01091dc:	81 48 38 00 02 00 00 	orl    $0x200,0x38(%eax)
+f01091e3:	be 00 00 00 00       	mov    $0x0,%esi
+f01091e8:	e9 33 fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f01091ed:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f01091f2:	e9 29 fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f01091f7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f01091fc:	e9 1f fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109201:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0109204:	8b 55 10             	mov    0x10(%ebp),%edx
+f0109207:	89 d8                	mov    %ebx,%eax
+f0109209:	e8 85 e8 ff ff       	call   f0107a93 <sys_page_alloc>
+f010920e:	89 c6                	mov    %eax,%esi
+f0109210:	e9 0b fa ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109215:	83 ec 08             	sub    $0x8,%esp
+f0109218:	ff 75 1c             	push   0x1c(%ebp)
+f010921b:	ff 75 18             	push   0x18(%ebp)
+f010921e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0109221:	8b 55 10             	mov    0x10(%ebp),%edx
+f0109224:	89 d8                	mov    %ebx,%eax
+f0109226:	e8 5a ef ff ff       	call   f0108185 <sys_page_map>
+f010922b:	89 c6                	mov    %eax,%esi
+f010922d:	83 c4 10             	add    $0x10,%esp
+f0109230:	e9 eb f9 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109235:	8b 55 10             	mov    0x10(%ebp),%edx
+f0109238:	89 d8                	mov    %ebx,%eax
+f010923a:	e8 f7 e7 ff ff       	call   f0107a36 <sys_page_unmap>
+f010923f:	89 c6                	mov    %eax,%esi
+f0109241:	e9 da f9 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109246:	83 ec 04             	sub    $0x4,%esp
+f0109249:	6a 01                	push   $0x1
+f010924b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f010924e:	50                   	push   %eax
+f010924f:	53                   	push   %ebx
+f0109250:	e8 0d bc ff ff       	call   f0104e62 <envid2env>
+f0109255:	83 c4 10             	add    $0x10,%esp
+f0109258:	85 c0                	test   %eax,%eax
+f010925a:	78 21                	js     f010927d <syscall+0x6f2>
+f010925c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010925f:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109262:	89 78 7c             	mov    %edi,0x7c(%eax)
+f0109265:	6a 00                	push   $0x0
+f0109267:	6a 04                	push   $0x4
+f0109269:	57                   	push   %edi
+f010926a:	50                   	push   %eax
+f010926b:	e8 d1 b9 ff ff       	call   f0104c41 <user_mem_assert>
+f0109270:	83 c4 10             	add    $0x10,%esp
+f0109273:	be 00 00 00 00       	mov    $0x0,%esi
+f0109278:	e9 a3 f9 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010927d:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0109282:	e9 99 f9 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109287:	83 ec 0c             	sub    $0xc,%esp
+f010928a:	ff 75 18             	push   0x18(%ebp)
+f010928d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0109290:	8b 55 10             	mov    0x10(%ebp),%edx
+f0109293:	89 d8                	mov    %ebx,%eax
+f0109295:	e8 14 e9 ff ff       	call   f0107bae <sys_ipc_try_send>
+f010929a:	89 c6                	mov    %eax,%esi
+f010929c:	83 c4 10             	add    $0x10,%esp
+f010929f:	e9 7c f9 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01092a4:	89 de                	mov    %ebx,%esi
+f01092a6:	e8 a6 1c 00 00       	call   f010af51 <cpunum>
+f01092ab:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01092b1:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01092b7:	83 b8 d4 00 00 00 00 	cmpl   $0x0,0xd4(%eax)
+f01092be:	74 23                	je     f01092e3 <syscall+0x758>
+f01092c0:	e8 8c 1c 00 00       	call   f010af51 <cpunum>
+f01092c5:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01092cb:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01092d1:	33 98 d8 00 00 00    	xor    0xd8(%eax),%ebx
+f01092d7:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+f01092dd:	0f 86 a4 00 00 00    	jbe    f0109387 <syscall+0x7fc>
+f01092e3:	83 ec 04             	sub    $0x4,%esp
+f01092e6:	6a 00                	push   $0x0
+f01092e8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01092eb:	50                   	push   %eax
+f01092ec:	56                   	push   %esi
+f01092ed:	e8 70 bb ff ff       	call   f0104e62 <envid2env>
+f01092f2:	83 c4 10             	add    $0x10,%esp
+f01092f5:	85 c0                	test   %eax,%eax
+f01092f7:	0f 88 ec 00 00 00    	js     f01093e9 <syscall+0x85e>
+f01092fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109300:	8b 40 54             	mov    0x54(%eax),%eax
+f0109303:	83 e8 05             	sub    $0x5,%eax
+f0109306:	83 f8 01             	cmp    $0x1,%eax
+f0109309:	0f 86 95 00 00 00    	jbe    f01093a4 <syscall+0x819>
+f010930f:	81 7d 14 ff ff 7f ee 	cmpl   $0xee7fffff,0x14(%ebp)
+f0109316:	77 2c                	ja     f0109344 <syscall+0x7b9>
+f0109318:	e8 34 1c 00 00       	call   f010af51 <cpunum>
+f010931d:	83 ec 04             	sub    $0x4,%esp
+f0109320:	6a 00                	push   $0x0
+f0109322:	ff 75 14             	push   0x14(%ebp)
+f0109325:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010932b:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109331:	ff 70 78             	push   0x78(%eax)
+f0109334:	e8 6e 8e ff ff       	call   f01021a7 <page_lookup>
+f0109339:	83 c4 10             	add    $0x10,%esp
+f010933c:	85 c0                	test   %eax,%eax
+f010933e:	0f 84 af 00 00 00    	je     f01093f3 <syscall+0x868>
+f0109344:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0109347:	e8 05 1c 00 00       	call   f010af51 <cpunum>
+f010934c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109352:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109358:	83 ec 08             	sub    $0x8,%esp
+f010935b:	ff 75 18             	push   0x18(%ebp)
+f010935e:	ff 75 14             	push   0x14(%ebp)
+f0109361:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0109364:	89 da                	mov    %ebx,%edx
+f0109366:	e8 1c e2 ff ff       	call   f0107587 <ipc_deliver>
+f010936b:	89 c6                	mov    %eax,%esi
+f010936d:	83 c4 10             	add    $0x10,%esp
+f0109370:	83 f8 f9             	cmp    $0xfffffff9,%eax
+f0109373:	74 4c                	je     f01093c1 <syscall+0x836>
+f0109375:	85 c0                	test   %eax,%eax
+f0109377:	0f 85 a3 f8 ff ff    	jne    f0108c20 <syscall+0x95>
+f010937d:	e8 bc df ff ff       	call   f010733e <sched_wakeup>
+f0109382:	e9 99 f8 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109387:	83 ec 0c             	sub    $0xc,%esp
+f010938a:	ff 75 18             	push   0x18(%ebp)
+f010938d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0109390:	8b 55 10             	mov    0x10(%ebp),%edx
+f0109393:	89 f0                	mov    %esi,%eax
+f0109395:	e8 14 e8 ff ff       	call   f0107bae <sys_ipc_try_send>
+f010939a:	89 c6                	mov    %eax,%esi
+f010939c:	83 c4 10             	add    $0x10,%esp
+f010939f:	e9 7c f8 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01093a4:	83 ec 0c             	sub    $0xc,%esp
+f01093a7:	ff 75 18             	push   0x18(%ebp)
+f01093aa:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01093ad:	8b 55 10             	mov    0x10(%ebp),%edx
+f01093b0:	89 f0                	mov    %esi,%eax
+f01093b2:	e8 f7 e7 ff ff       	call   f0107bae <sys_ipc_try_send>
+f01093b7:	89 c6                	mov    %eax,%esi
+f01093b9:	83 c4 10             	add    $0x10,%esp
+f01093bc:	e9 5f f8 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01093c1:	83 ec 04             	sub    $0x4,%esp
+f01093c4:	6a 00                	push   $0x0
+f01093c6:	68 00 00 80 ee       	push   $0xee800000
+f01093cb:	ff 75 18             	push   0x18(%ebp)
+f01093ce:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f01093d1:	8b 55 10             	mov    0x10(%ebp),%edx
+f01093d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01093d7:	e8 09 e5 ff ff       	call   f01078e5 <ipc_enqueue>
+f01093dc:	83 c4 10             	add    $0x10,%esp
+f01093df:	be 00 00 00 00       	mov    $0x0,%esi
+f01093e4:	e9 37 f8 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01093e9:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f01093ee:	e9 2d f8 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01093f3:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f01093f8:	e9 23 f8 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01093fd:	83 ec 04             	sub    $0x4,%esp
+f0109400:	53                   	push   %ebx
+f0109401:	ff 75 1c             	push   0x1c(%ebp)
+f0109404:	ff 75 18             	push   0x18(%ebp)
+f0109407:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f010940a:	8b 55 10             	mov    0x10(%ebp),%edx
+f010940d:	89 d8                	mov    %ebx,%eax
+f010940f:	e8 d0 eb ff ff       	call   f0107fe4 <ipc_send_switch>
+f0109414:	89 c6                	mov    %eax,%esi
+f0109416:	83 c4 10             	add    $0x10,%esp
+f0109419:	e9 02 f8 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010941e:	83 ec 04             	sub    $0x4,%esp
+f0109421:	6a 00                	push   $0x0
+f0109423:	ff 75 1c             	push   0x1c(%ebp)
+f0109426:	ff 75 18             	push   0x18(%ebp)
+f0109429:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f010942c:	8b 55 10             	mov    0x10(%ebp),%edx
+f010942f:	89 d8                	mov    %ebx,%eax
+f0109431:	e8 ae eb ff ff       	call   f0107fe4 <ipc_send_switch>
+f0109436:	89 c6                	mov    %eax,%esi
+f0109438:	83 c4 10             	add    $0x10,%esp
+f010943b:	e9 e0 f7 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109440:	89 d8                	mov    %ebx,%eax
+f0109442:	81 fb ff ff 7f ee    	cmp    $0xee7fffff,%ebx
+f0109448:	77 0c                	ja     f0109456 <syscall+0x8cb>
+f010944a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f0109450:	0f 85 e5 06 00 00    	jne    f0109b3b <syscall+0xfb0>
+f0109456:	ba 00 00 00 00       	mov    $0x0,%edx
+f010945b:	e8 6e ea ff ff       	call   f0107ece <ipc_block_recv>
+f0109460:	be 00 00 00 00       	mov    $0x0,%esi
+f0109465:	e9 b6 f7 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010946a:	89 d8                	mov    %ebx,%eax
+f010946c:	e8 04 e9 ff ff       	call   f0107d75 <sys_env_swap>
+f0109471:	89 c6                	mov    %eax,%esi
+f0109473:	e9 a8 f7 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109478:	e8 2f 2f 00 00       	call   f010c3ac <time_msec>
+f010947d:	89 c6                	mov    %eax,%esi
+f010947f:	e9 9c f7 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109484:	a1 a8 b4 32 f0       	mov    0xf032b4a8,%eax
+f0109489:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+f010948f:	0f 87 b0 06 00 00    	ja     f0109b45 <syscall+0xfba>
+f0109495:	89 1d a8 b4 32 f0    	mov    %ebx,0xf032b4a8
+f010949b:	89 c6                	mov    %eax,%esi
+f010949d:	e9 7e f7 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01094a2:	8b 75 10             	mov    0x10(%ebp),%esi
+f01094a5:	83 ec 04             	sub    $0x4,%esp
+f01094a8:	6a 01                	push   $0x1
+f01094aa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01094ad:	50                   	push   %eax
+f01094ae:	53                   	push   %ebx
+f01094af:	e8 ae b9 ff ff       	call   f0104e62 <envid2env>
+f01094b4:	83 c4 10             	add    $0x10,%esp
+f01094b7:	85 c0                	test   %eax,%eax
+f01094b9:	0f 88 90 00 00 00    	js     f010954f <syscall+0x9c4>
+f01094bf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01094c3:	75 26                	jne    f01094eb <syscall+0x960>
+f01094c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01094c8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%eax)
+f01094cf:	00 00 00 
+f01094d2:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+f01094d9:	00 00 00 
+f01094dc:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f01094e3:	00 00 00 
+f01094e6:	e9 35 f7 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01094eb:	83 ec 04             	sub    $0x4,%esp
+f01094ee:	6a 00                	push   $0x0
+f01094f0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01094f3:	50                   	push   %eax
+f01094f4:	ff 75 10             	push   0x10(%ebp)
+f01094f7:	e8 66 b9 ff ff       	call   f0104e62 <envid2env>
+f01094fc:	83 c4 10             	add    $0x10,%esp
+f01094ff:	85 c0                	test   %eax,%eax
+f0109501:	78 56                	js     f0109559 <syscall+0x9ce>
+f0109503:	8b 45 14             	mov    0x14(%ebp),%eax
+f0109506:	83 e8 01             	sub    $0x1,%eax
+f0109509:	3d fe 0f 00 00       	cmp    $0xffe,%eax
+f010950e:	77 35                	ja     f0109545 <syscall+0x9ba>
+f0109510:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109513:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109516:	89 b8 84 00 00 00    	mov    %edi,0x84(%eax)
+f010951c:	8b 7d 14             	mov    0x14(%ebp),%edi
+f010951f:	89 b8 88 00 00 00    	mov    %edi,0x88(%eax)
+f0109525:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+f010952c:	00 00 00 
+f010952f:	83 ec 0c             	sub    $0xc,%esp
+f0109532:	50                   	push   %eax
+f0109533:	e8 d0 37 00 00       	call   f010cd08 <textcache_map>
+f0109538:	83 c4 10             	add    $0x10,%esp
+f010953b:	be 00 00 00 00       	mov    $0x0,%esi
+f0109540:	e9 db f6 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109545:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010954a:	e9 d1 f6 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010954f:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0109554:	e9 c7 f6 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109559:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f010955e:	e9 bd f6 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109563:	e8 e9 19 00 00       	call   f010af51 <cpunum>
+f0109568:	83 ec 08             	sub    $0x8,%esp
+f010956b:	53                   	push   %ebx
+f010956c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109572:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109578:	ff 70 48             	push   0x48(%eax)
+f010957b:	e8 f9 37 00 00       	call   f010cd79 <textcache_retire>
+f0109580:	8b 35 78 57 2b f0    	mov    0xf02b5778,%esi
+f0109586:	83 c4 10             	add    $0x10,%esp
+f0109589:	eb 14                	jmp    f010959f <syscall+0xa14>
+f010958b:	81 c6 ac 01 00 00    	add    $0x1ac,%esi
+f0109591:	a1 78 57 2b f0       	mov    0xf02b5778,%eax
+f0109596:	05 00 b0 06 00       	add    $0x6b000,%eax
+f010959b:	39 c6                	cmp    %eax,%esi
+f010959d:	73 40                	jae    f01095df <syscall+0xa54>
+f010959f:	83 7e 54 00          	cmpl   $0x0,0x54(%esi)
+f01095a3:	74 e6                	je     f010958b <syscall+0xa00>
+f01095a5:	8b be 84 00 00 00    	mov    0x84(%esi),%edi
+f01095ab:	e8 a1 19 00 00       	call   f010af51 <cpunum>
+f01095b0:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01095b6:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01095bc:	3b 78 48             	cmp    0x48(%eax),%edi
+f01095bf:	75 ca                	jne    f010958b <syscall+0xa00>
+f01095c1:	3b 9e 88 00 00 00    	cmp    0x88(%esi),%ebx
+f01095c7:	75 c2                	jne    f010958b <syscall+0xa00>
+f01095c9:	c7 86 84 00 00 00 00 	movl   $0x0,0x84(%esi)
+f01095d0:	00 00 00 
+f01095d3:	c7 86 88 00 00 00 00 	movl   $0x0,0x88(%esi)
+f01095da:	00 00 00 
+f01095dd:	eb ac                	jmp    f010958b <syscall+0xa00>
+f01095df:	be 00 00 00 00       	mov    $0x0,%esi
+f01095e4:	e9 37 f6 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01095e9:	8b 7d 10             	mov    0x10(%ebp),%edi
+f01095ec:	83 ec 04             	sub    $0x4,%esp
+f01095ef:	6a 00                	push   $0x0
+f01095f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01095f4:	50                   	push   %eax
+f01095f5:	53                   	push   %ebx
+f01095f6:	e8 67 b8 ff ff       	call   f0104e62 <envid2env>
+f01095fb:	83 c4 10             	add    $0x10,%esp
+f01095fe:	85 c0                	test   %eax,%eax
+f0109600:	0f 88 df 00 00 00    	js     f01096e5 <syscall+0xb5a>
+f0109606:	e8 46 19 00 00       	call   f010af51 <cpunum>
+f010960b:	6a 06                	push   $0x6
+f010960d:	68 d0 00 00 00       	push   $0xd0
+f0109612:	ff 75 10             	push   0x10(%ebp)
+f0109615:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010961b:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0109621:	e8 1b b6 ff ff       	call   f0104c41 <user_mem_assert>
+f0109626:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109629:	8d b0 dc 00 00 00    	lea    0xdc(%eax),%esi
+f010962f:	b9 34 00 00 00       	mov    $0x34,%ecx
+f0109634:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0109636:	83 c4 0c             	add    $0xc,%esp
+f0109639:	ff b0 e8 00 00 00    	push   0xe8(%eax)
+f010963f:	ff b0 e0 00 00 00    	push   0xe0(%eax)
+f0109645:	ff b0 dc 00 00 00    	push   0xdc(%eax)
+f010964b:	e8 fa 2d 00 00       	call   f010c44a <time_tsc_msec>
+f0109650:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109653:	89 47 08             	mov    %eax,0x8(%edi)
+f0109656:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f010965b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010965e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109661:	8b 70 78             	mov    0x78(%eax),%esi
+f0109664:	8d be e8 0e 00 00    	lea    0xee8(%esi),%edi
+f010966a:	83 c4 10             	add    $0x10,%esp
+f010966d:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0109672:	eb 37                	jmp    f01096ab <syscall+0xb20>
+f0109674:	89 c3                	mov    %eax,%ebx
+f0109676:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f010967c:	c1 e8 0c             	shr    $0xc,%eax
+f010967f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0109682:	39 d0                	cmp    %edx,%eax
+f0109684:	73 37                	jae    f01096bd <syscall+0xb32>
+f0109686:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+f010968c:	81 eb 00 f0 ff 0f    	sub    $0xffff000,%ebx
+f0109692:	8b 10                	mov    (%eax),%edx
+f0109694:	83 e2 01             	and    $0x1,%edx
+f0109697:	83 fa 01             	cmp    $0x1,%edx
+f010969a:	83 d9 ff             	sbb    $0xffffffff,%ecx
+f010969d:	83 c0 04             	add    $0x4,%eax
+f01096a0:	39 c3                	cmp    %eax,%ebx
+f01096a2:	75 ee                	jne    f0109692 <syscall+0xb07>
+f01096a4:	83 c6 04             	add    $0x4,%esi
+f01096a7:	39 f7                	cmp    %esi,%edi
+f01096a9:	74 27                	je     f01096d2 <syscall+0xb47>
+f01096ab:	8b 06                	mov    (%esi),%eax
+f01096ad:	a8 01                	test   $0x1,%al
+f01096af:	74 f3                	je     f01096a4 <syscall+0xb19>
+f01096b1:	a8 80                	test   $0x80,%al
+f01096b3:	74 bf                	je     f0109674 <syscall+0xae9>
+f01096b5:	81 c1 00 04 00 00    	add    $0x400,%ecx
+f01096bb:	eb e7                	jmp    f01096a4 <syscall+0xb19>
+f01096bd:	53                   	push   %ebx
+f01096be:	68 24 d0 10 f0       	push   $0xf010d024
+f01096c3:	68 7f 01 00 00       	push   $0x17f
+f01096c8:	68 78 eb 10 f0       	push   $0xf010eb78
+f01096cd:	e8 6e 69 ff ff       	call   f0100040 <_panic>
+f01096d2:	8b 45 10             	mov    0x10(%ebp),%eax
+f01096d5:	89 88 c4 00 00 00    	mov    %ecx,0xc4(%eax)
+f01096db:	be 00 00 00 00       	mov    $0x0,%esi
+f01096e0:	e9 3b f5 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01096e5:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f01096ea:	e9 31 f5 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01096ef:	83 fb 03             	cmp    $0x3,%ebx
+f01096f2:	75 45                	jne    f0109739 <syscall+0xbae>
+f01096f4:	81 7d 10 5d 74 71 05 	cmpl   $0x571745d,0x10(%ebp)
+f01096fb:	0f 87 4e 04 00 00    	ja     f0109b4f <syscall+0xfc4>
+f0109701:	e8 4b 18 00 00       	call   f010af51 <cpunum>
+f0109706:	6a 06                	push   $0x6
+f0109708:	6b 55 10 2c          	imul   $0x2c,0x10(%ebp),%edx
+f010970c:	52                   	push   %edx
+f010970d:	ff 75 14             	push   0x14(%ebp)
+f0109710:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109716:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f010971c:	e8 20 b5 ff ff       	call   f0104c41 <user_mem_assert>
+f0109721:	83 c4 08             	add    $0x8,%esp
+f0109724:	ff 75 10             	push   0x10(%ebp)
+f0109727:	ff 75 14             	push   0x14(%ebp)
+f010972a:	e8 43 30 00 00       	call   f010c772 <prof_report>
+f010972f:	89 c6                	mov    %eax,%esi
+f0109731:	83 c4 10             	add    $0x10,%esp
+f0109734:	e9 e7 f4 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109739:	83 ec 08             	sub    $0x8,%esp
+f010973c:	ff 75 10             	push   0x10(%ebp)
+f010973f:	53                   	push   %ebx
+f0109740:	e8 7a 2f 00 00       	call   f010c6bf <prof_ctl>
+f0109745:	89 c6                	mov    %eax,%esi
+f0109747:	83 c4 10             	add    $0x10,%esp
+f010974a:	e9 d1 f4 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010974f:	81 fb ff ff 7f ee    	cmp    $0xee7fffff,%ebx
+f0109755:	0f 87 fe 03 00 00    	ja     f0109b59 <syscall+0xfce>
+f010975b:	83 ec 08             	sub    $0x8,%esp
+f010975e:	ff 75 10             	push   0x10(%ebp)
+f0109761:	53                   	push   %ebx
+f0109762:	e8 1f 22 00 00       	call   f010b986 <e1000_transmit>
+f0109767:	89 c6                	mov    %eax,%esi
+f0109769:	83 c4 10             	add    $0x10,%esp
+f010976c:	e9 af f4 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109771:	81 fb ff ff 7f ee    	cmp    $0xee7fffff,%ebx
+f0109777:	0f 87 e6 03 00 00    	ja     f0109b63 <syscall+0xfd8>
+f010977d:	83 ec 0c             	sub    $0xc,%esp
+f0109780:	53                   	push   %ebx
+f0109781:	e8 c7 22 00 00       	call   f010ba4d <e1000_receive>
+f0109786:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109789:	89 07                	mov    %eax,(%edi)
+f010978b:	85 c0                	test   %eax,%eax
+f010978d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109792:	89 d6                	mov    %edx,%esi
+f0109794:	0f 4e f0             	cmovle %eax,%esi
+f0109797:	83 c4 10             	add    $0x10,%esp
+f010979a:	e9 81 f4 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010979f:	e8 33 25 00 00       	call   f010bcd7 <e1000_rx_wait>
+f01097a4:	89 c6                	mov    %eax,%esi
+f01097a6:	e9 75 f4 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01097ab:	89 df                	mov    %ebx,%edi
+f01097ad:	81 fb ff ff 7f ee    	cmp    $0xee7fffff,%ebx
+f01097b3:	77 7a                	ja     f010982f <syscall+0xca4>
+f01097b5:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+f01097bb:	75 7c                	jne    f0109839 <syscall+0xcae>
+f01097bd:	e8 8f 17 00 00       	call   f010af51 <cpunum>
+f01097c2:	83 ec 04             	sub    $0x4,%esp
+f01097c5:	6a 01                	push   $0x1
+f01097c7:	53                   	push   %ebx
+f01097c8:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f01097ce:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f01097d4:	ff 70 78             	push   0x78(%eax)
+f01097d7:	e8 30 87 ff ff       	call   f0101f0c <pgdir_walk>
+f01097dc:	83 c4 10             	add    $0x10,%esp
+f01097df:	85 c0                	test   %eax,%eax
+f01097e1:	74 60                	je     f0109843 <syscall+0xcb8>
+f01097e3:	83 ec 0c             	sub    $0xc,%esp
+f01097e6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01097e9:	50                   	push   %eax
+f01097ea:	e8 49 23 00 00       	call   f010bb38 <e1000_receive_page>
+f01097ef:	89 c6                	mov    %eax,%esi
+f01097f1:	83 c4 10             	add    $0x10,%esp
+f01097f4:	85 c0                	test   %eax,%eax
+f01097f6:	0f 88 24 f4 ff ff    	js     f0108c20 <syscall+0x95>
+f01097fc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01097ff:	e8 4d 17 00 00       	call   f010af51 <cpunum>
+f0109804:	6a 07                	push   $0x7
+f0109806:	57                   	push   %edi
+f0109807:	53                   	push   %ebx
+f0109808:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010980e:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109814:	ff 70 78             	push   0x78(%eax)
+f0109817:	e8 39 8a ff ff       	call   f0102255 <page_insert>
+f010981c:	83 c4 04             	add    $0x4,%esp
+f010981f:	ff 75 e4             	push   -0x1c(%ebp)
+f0109822:	e8 a7 82 ff ff       	call   f0101ace <page_decref>
+f0109827:	83 c4 10             	add    $0x10,%esp
+f010982a:	e9 f1 f3 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010982f:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109834:	e9 e7 f3 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109839:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f010983e:	e9 dd f3 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109843:	be fc ff ff ff       	mov    $0xfffffffc,%esi
+f0109848:	e9 d3 f3 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010984d:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f0109852:	8b 80 00 54 00 00    	mov    0x5400(%eax),%eax
+f0109858:	89 03                	mov    %eax,(%ebx)
+f010985a:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f010985f:	8b 80 04 54 00 00    	mov    0x5404(%eax),%eax
+f0109865:	25 ff ff 00 00       	and    $0xffff,%eax
+f010986a:	8b 7d 10             	mov    0x10(%ebp),%edi
+f010986d:	89 07                	mov    %eax,(%edi)
+f010986f:	be 00 00 00 00       	mov    $0x0,%esi
+f0109874:	e9 a7 f3 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109879:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f010987c:	83 ec 08             	sub    $0x8,%esp
+f010987f:	ff 73 4c             	push   0x4c(%ebx)
+f0109882:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109885:	50                   	push   %eax
+f0109886:	e8 a3 b7 ff ff       	call   f010502e <env_alloc>
+f010988b:	89 c6                	mov    %eax,%esi
+f010988d:	83 c4 10             	add    $0x10,%esp
+f0109890:	85 c0                	test   %eax,%eax
+f0109892:	0f 88 88 f3 ff ff    	js     f0108c20 <syscall+0x95>
+f0109898:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010989b:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01098a0:	89 c7                	mov    %eax,%edi
+f01098a2:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f01098a5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01098a7:	8b 53 4c             	mov    0x4c(%ebx),%edx
+f01098aa:	89 50 4c             	mov    %edx,0x4c(%eax)
+f01098ad:	8b 53 54             	mov    0x54(%ebx),%edx
+f01098b0:	89 50 54             	mov    %edx,0x54(%eax)
+f01098b3:	83 ec 08             	sub    $0x8,%esp
+f01098b6:	ff 73 50             	push   0x50(%ebx)
+f01098b9:	50                   	push   %eax
+f01098ba:	e8 7d b6 ff ff       	call   f0104f3c <env_set_type>
+f01098bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01098c2:	8b 53 58             	mov    0x58(%ebx),%edx
+f01098c5:	89 50 58             	mov    %edx,0x58(%eax)
+f01098c8:	8b 53 7c             	mov    0x7c(%ebx),%edx
+f01098cb:	89 50 7c             	mov    %edx,0x7c(%eax)
+f01098ce:	8b 93 94 00 00 00    	mov    0x94(%ebx),%edx
+f01098d4:	89 90 94 00 00 00    	mov    %edx,0x94(%eax)
+f01098da:	8b 93 9c 00 00 00    	mov    0x9c(%ebx),%edx
+f01098e0:	89 90 9c 00 00 00    	mov    %edx,0x9c(%eax)
+f01098e6:	8b 93 a0 00 00 00    	mov    0xa0(%ebx),%edx
+f01098ec:	89 90 a0 00 00 00    	mov    %edx,0xa0(%eax)
+f01098f2:	8b 93 a4 00 00 00    	mov    0xa4(%ebx),%edx
+f01098f8:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+f01098fe:	8b 93 a8 00 00 00    	mov    0xa8(%ebx),%edx
+f0109904:	89 90 a8 00 00 00    	mov    %edx,0xa8(%eax)
+f010990a:	8b 93 cc 00 00 00    	mov    0xcc(%ebx),%edx
+f0109910:	89 90 cc 00 00 00    	mov    %edx,0xcc(%eax)
+f0109916:	c7 80 d4 00 00 00 01 	movl   $0x1,0xd4(%eax)
+f010991d:	00 00 00 
+f0109920:	0f b7 93 d0 00 00 00 	movzwl 0xd0(%ebx),%edx
+f0109927:	66 89 90 d0 00 00 00 	mov    %dx,0xd0(%eax)
+f010992e:	8b 93 d8 00 00 00    	mov    0xd8(%ebx),%edx
+f0109934:	89 90 d8 00 00 00    	mov    %edx,0xd8(%eax)
+f010993a:	8b 40 48             	mov    0x48(%eax),%eax
+f010993d:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0109940:	89 07                	mov    %eax,(%edi)
+f0109942:	83 c4 10             	add    $0x10,%esp
+f0109945:	be 00 00 00 00       	mov    $0x0,%esi
+f010994a:	e9 d1 f2 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010994f:	83 ec 0c             	sub    $0xc,%esp
+f0109952:	ff 75 1c             	push   0x1c(%ebp)
+f0109955:	ff 75 18             	push   0x18(%ebp)
+f0109958:	ff 75 14             	push   0x14(%ebp)
+f010995b:	ff 75 10             	push   0x10(%ebp)
+f010995e:	53                   	push   %ebx
+f010995f:	e8 dc ed ff ff       	call   f0108740 <sys_copy_mem>
+f0109964:	89 c6                	mov    %eax,%esi
+f0109966:	83 c4 20             	add    $0x20,%esp
+f0109969:	e9 b2 f2 ff ff       	jmp    f0108c20 <syscall+0x95>
+f010996e:	83 ec 04             	sub    $0x4,%esp
+f0109971:	ff 75 14             	push   0x14(%ebp)
+f0109974:	ff 75 10             	push   0x10(%ebp)
+f0109977:	53                   	push   %ebx
+f0109978:	e8 b4 ee ff ff       	call   f0108831 <sys_get_perms>
+f010997d:	89 c6                	mov    %eax,%esi
+f010997f:	83 c4 10             	add    $0x10,%esp
+f0109982:	e9 99 f2 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109987:	83 ec 04             	sub    $0x4,%esp
+f010998a:	ff 75 14             	push   0x14(%ebp)
+f010998d:	ff 75 10             	push   0x10(%ebp)
+f0109990:	53                   	push   %ebx
+f0109991:	e8 06 ef ff ff       	call   f010889c <sys_env_unsuspend>
+f0109996:	89 c6                	mov    %eax,%esi
+f0109998:	83 c4 10             	add    $0x10,%esp
+f010999b:	e9 80 f2 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01099a0:	83 ec 08             	sub    $0x8,%esp
+f01099a3:	ff 75 10             	push   0x10(%ebp)
+f01099a6:	53                   	push   %ebx
+f01099a7:	e8 50 f1 ff ff       	call   f0108afc <sys_env_set_thisenv>
+f01099ac:	89 c6                	mov    %eax,%esi
+f01099ae:	83 c4 10             	add    $0x10,%esp
+f01099b1:	e9 6a f2 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01099b6:	83 ec 0c             	sub    $0xc,%esp
+f01099b9:	53                   	push   %ebx
+f01099ba:	e8 23 ef ff ff       	call   f01088e2 <sys_migrate>
+f01099bf:	89 c6                	mov    %eax,%esi
+f01099c1:	83 c4 10             	add    $0x10,%esp
+f01099c4:	e9 57 f2 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01099c9:	e8 25 f0 ff ff       	call   f01089f3 <sys_lease_complete>
+f01099ce:	89 c6                	mov    %eax,%esi
+f01099d0:	e9 4b f2 ff ff       	jmp    f0108c20 <syscall+0x95>
+f01099d5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01099d9:	0f 88 8e 01 00 00    	js     f0109b6d <syscall+0xfe2>
+f01099df:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01099e3:	0f 8e 8e 01 00 00    	jle    f0109b77 <syscall+0xfec>
+f01099e9:	be 00 00 00 00       	mov    $0x0,%esi
+f01099ee:	eb 53                	jmp    f0109a43 <syscall+0xeb8>
+f01099f0:	83 f8 03             	cmp    $0x3,%eax
+f01099f3:	0f 87 90 00 00 00    	ja     f0109a89 <syscall+0xefe>
+f01099f9:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0109a00:	e8 4c 15 00 00       	call   f010af51 <cpunum>
+f0109a05:	6a 06                	push   $0x6
+f0109a07:	6a 1c                	push   $0x1c
+f0109a09:	57                   	push   %edi
+f0109a0a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109a10:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0109a16:	e8 8c b1 ff ff       	call   f0104ba7 <user_mem_check>
+f0109a1b:	83 c4 10             	add    $0x10,%esp
+f0109a1e:	85 c0                	test   %eax,%eax
+f0109a20:	0f 88 65 01 00 00    	js     f0109b8b <syscall+0x1000>
+f0109a26:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0109a29:	89 47 18             	mov    %eax,0x18(%edi)
+f0109a2c:	85 c0                	test   %eax,%eax
+f0109a2e:	0f 88 ec f1 ff ff    	js     f0108c20 <syscall+0x95>
+f0109a34:	83 c6 01             	add    $0x1,%esi
+f0109a37:	83 c3 1c             	add    $0x1c,%ebx
+f0109a3a:	39 75 10             	cmp    %esi,0x10(%ebp)
+f0109a3d:	0f 84 dd f1 ff ff    	je     f0108c20 <syscall+0x95>
+f0109a43:	89 df                	mov    %ebx,%edi
+f0109a45:	e8 07 15 00 00       	call   f010af51 <cpunum>
+f0109a4a:	6a 06                	push   $0x6
+f0109a4c:	6a 1c                	push   $0x1c
+f0109a4e:	53                   	push   %ebx
+f0109a4f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109a55:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0109a5b:	e8 47 b1 ff ff       	call   f0104ba7 <user_mem_check>
+f0109a60:	83 c4 10             	add    $0x10,%esp
+f0109a63:	85 c0                	test   %eax,%eax
+f0109a65:	0f 88 16 01 00 00    	js     f0109b81 <syscall+0xff6>
+f0109a6b:	8b 03                	mov    (%ebx),%eax
+f0109a6d:	83 f8 06             	cmp    $0x6,%eax
+f0109a70:	0f 86 7a ff ff ff    	jbe    f01099f0 <syscall+0xe65>
+f0109a76:	8d 50 f8             	lea    -0x8(%eax),%edx
+f0109a79:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f0109a80:	83 fa 02             	cmp    $0x2,%edx
+f0109a83:	0f 87 77 ff ff ff    	ja     f0109a00 <syscall+0xe75>
+f0109a89:	83 ec 08             	sub    $0x8,%esp
+f0109a8c:	ff 77 14             	push   0x14(%edi)
+f0109a8f:	ff 77 10             	push   0x10(%edi)
+f0109a92:	ff 77 0c             	push   0xc(%edi)
+f0109a95:	ff 77 08             	push   0x8(%edi)
+f0109a98:	ff 77 04             	push   0x4(%edi)
+f0109a9b:	50                   	push   %eax
+f0109a9c:	e8 ea f0 ff ff       	call   f0108b8b <syscall>
+f0109aa1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0109aa4:	83 c4 20             	add    $0x20,%esp
+f0109aa7:	e9 54 ff ff ff       	jmp    f0109a00 <syscall+0xe75>
+f0109aac:	83 ec 04             	sub    $0x4,%esp
+f0109aaf:	6a 01                	push   $0x1
+f0109ab1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109ab4:	50                   	push   %eax
+f0109ab5:	53                   	push   %ebx
+f0109ab6:	e8 a7 b3 ff ff       	call   f0104e62 <envid2env>
+f0109abb:	83 c4 10             	add    $0x10,%esp
+f0109abe:	85 c0                	test   %eax,%eax
+f0109ac0:	78 47                	js     f0109b09 <syscall+0xf7e>
+f0109ac2:	e8 8a 14 00 00       	call   f010af51 <cpunum>
+f0109ac7:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109acd:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f0109ad3:	83 78 50 00          	cmpl   $0x0,0x50(%eax)
+f0109ad7:	75 15                	jne    f0109aee <syscall+0xf63>
+f0109ad9:	83 7d 10 01          	cmpl   $0x1,0x10(%ebp)
+f0109add:	74 34                	je     f0109b13 <syscall+0xf88>
+f0109adf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0109ae3:	75 09                	jne    f0109aee <syscall+0xf63>
+f0109ae5:	81 7d 14 00 04 00 00 	cmpl   $0x400,0x14(%ebp)
+f0109aec:	7f 2f                	jg     f0109b1d <syscall+0xf92>
+f0109aee:	83 ec 04             	sub    $0x4,%esp
+f0109af1:	ff 75 14             	push   0x14(%ebp)
+f0109af4:	ff 75 10             	push   0x10(%ebp)
+f0109af7:	ff 75 e4             	push   -0x1c(%ebp)
+f0109afa:	e8 17 d6 ff ff       	call   f0107116 <sched_set_class>
+f0109aff:	89 c6                	mov    %eax,%esi
+f0109b01:	83 c4 10             	add    $0x10,%esp
+f0109b04:	e9 17 f1 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b09:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+f0109b0e:	e9 0d f1 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b13:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b18:	e9 03 f1 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b1d:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b22:	e9 f9 f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b27:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b2c:	e9 ef f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b31:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b36:	e9 e5 f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b3b:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b40:	e9 db f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b45:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b4a:	e9 d1 f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b4f:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b54:	e9 c7 f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b59:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b5e:	e9 bd f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b63:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b68:	e9 b3 f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b6d:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+f0109b72:	e9 a9 f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b77:	be 00 00 00 00       	mov    $0x0,%esi
+f0109b7c:	e9 9f f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b81:	be fa ff ff ff       	mov    $0xfffffffa,%esi
+f0109b86:	e9 95 f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b8b:	be fa ff ff ff       	mov    $0xfffffffa,%esi
+f0109b90:	e9 8b f0 ff ff       	jmp    f0108c20 <syscall+0x95>
+f0109b95:	6a 00                	push   $0x0
+f0109b97:	56                   	push   %esi
+f0109b98:	ff 75 08             	push   0x8(%ebp)
+f0109b9b:	6a 02                	push   $0x2
+f0109b9d:	e8 e5 2f 00 00       	call   f010cb87 <trace_record>
+f0109ba2:	83 c4 10             	add    $0x10,%esp
+f0109ba5:	e9 83 f0 ff ff       	jmp    f0108c2d <syscall+0xa2>
+
+f0109baa <stab_binsearch>:
+f0109baa:	55                   	push   %ebp
+f0109bab:	89 e5                	mov    %esp,%ebp
+f0109bad:	57                   	push   %edi
+f0109bae:	56                   	push   %esi
+f0109baf:	53                   	push   %ebx
+f0109bb0:	83 ec 14             	sub    $0x14,%esp
+f0109bb3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0109bb6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0109bb9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0109bbc:	8b 1a                	mov    (%edx),%ebx
+f0109bbe:	8b 09                	mov    (%ecx),%ecx
+f0109bc0:	39 cb                	cmp    %ecx,%ebx
+f0109bc2:	0f 8f d8 00 00 00    	jg     f0109ca0 <stab_binsearch+0xf6>
+f0109bc8:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+f0109bcf:	eb 2c                	jmp    f0109bfd <stab_binsearch+0x53>
+f0109bd1:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+f0109bd4:	89 75 08             	mov    %esi,0x8(%ebp)
+f0109bd7:	39 c3                	cmp    %eax,%ebx
+f0109bd9:	7f 5b                	jg     f0109c36 <stab_binsearch+0x8c>
+f0109bdb:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0109bde:	8b 75 ec             	mov    -0x14(%ebp),%esi
+f0109be1:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0109be5:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0109be8:	73 51                	jae    f0109c3b <stab_binsearch+0x91>
+f0109bea:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0109bed:	89 06                	mov    %eax,(%esi)
+f0109bef:	8d 5f 01             	lea    0x1(%edi),%ebx
+f0109bf2:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0109bf9:	39 cb                	cmp    %ecx,%ebx
+f0109bfb:	7f 68                	jg     f0109c65 <stab_binsearch+0xbb>
+f0109bfd:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0109c00:	89 c7                	mov    %eax,%edi
+f0109c02:	c1 ef 1f             	shr    $0x1f,%edi
+f0109c05:	01 c7                	add    %eax,%edi
+f0109c07:	d1 ff                	sar    %edi
+f0109c09:	39 df                	cmp    %ebx,%edi
+f0109c0b:	7c 29                	jl     f0109c36 <stab_binsearch+0x8c>
+f0109c0d:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+f0109c10:	8b 55 ec             	mov    -0x14(%ebp),%edx
+f0109c13:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+f0109c17:	89 f8                	mov    %edi,%eax
+f0109c19:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0109c1c:	8b 75 08             	mov    0x8(%ebp),%esi
+f0109c1f:	0f b6 0a             	movzbl (%edx),%ecx
+f0109c22:	39 f1                	cmp    %esi,%ecx
+f0109c24:	74 ab                	je     f0109bd1 <stab_binsearch+0x27>
+f0109c26:	83 e8 01             	sub    $0x1,%eax
+f0109c29:	83 ea 0c             	sub    $0xc,%edx
+f0109c2c:	39 d8                	cmp    %ebx,%eax
+f0109c2e:	7d ef                	jge    f0109c1f <stab_binsearch+0x75>
+f0109c30:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+f0109c33:	89 75 08             	mov    %esi,0x8(%ebp)
+f0109c36:	8d 5f 01             	lea    0x1(%edi),%ebx
+f0109c39:	eb be                	jmp    f0109bf9 <stab_binsearch+0x4f>
+f0109c3b:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0109c3e:	73 11                	jae    f0109c51 <stab_binsearch+0xa7>
+f0109c40:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0109c43:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109c46:	89 08                	mov    %ecx,(%eax)
+f0109c48:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0109c4f:	eb a8                	jmp    f0109bf9 <stab_binsearch+0x4f>
+f0109c51:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0109c54:	89 06                	mov    %eax,(%esi)
+f0109c56:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f0109c5a:	89 c3                	mov    %eax,%ebx
+f0109c5c:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0109c63:	eb 94                	jmp    f0109bf9 <stab_binsearch+0x4f>
+f0109c65:	8b 75 08             	mov    0x8(%ebp),%esi
+f0109c68:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0109c6c:	74 32                	je     f0109ca0 <stab_binsearch+0xf6>
+f0109c6e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109c71:	8b 00                	mov    (%eax),%eax
+f0109c73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0109c76:	8b 0f                	mov    (%edi),%ecx
+f0109c78:	39 c8                	cmp    %ecx,%eax
+f0109c7a:	7e 1d                	jle    f0109c99 <stab_binsearch+0xef>
+f0109c7c:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0109c7f:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f0109c82:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0109c86:	0f b6 1a             	movzbl (%edx),%ebx
+f0109c89:	39 f3                	cmp    %esi,%ebx
+f0109c8b:	74 0c                	je     f0109c99 <stab_binsearch+0xef>
+f0109c8d:	83 e8 01             	sub    $0x1,%eax
+f0109c90:	83 ea 0c             	sub    $0xc,%edx
+f0109c93:	39 c8                	cmp    %ecx,%eax
+f0109c95:	75 ef                	jne    f0109c86 <stab_binsearch+0xdc>
+f0109c97:	89 c8                	mov    %ecx,%eax
+f0109c99:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0109c9c:	89 06                	mov    %eax,(%esi)
+f0109c9e:	eb 0d                	jmp    f0109cad <stab_binsearch+0x103>
+f0109ca0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109ca3:	8b 00                	mov    (%eax),%eax
+f0109ca5:	83 e8 01             	sub    $0x1,%eax
+f0109ca8:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0109cab:	89 06                	mov    %eax,(%esi)
+f0109cad:	83 c4 14             	add    $0x14,%esp
+f0109cb0:	5b                   	pop    %ebx
+f0109cb1:	5e                   	pop    %esi
+f0109cb2:	5f                   	pop    %edi
+f0109cb3:	5d                   	pop    %ebp
+f0109cb4:	c3                   	ret
+
+f0109cb5 <debuginfo_eip>:
+f0109cb5:	55                   	push   %ebp
+f0109cb6:	89 e5                	mov    %esp,%ebp
+f0109cb8:	57                   	push   %edi
+f0109cb9:	56                   	push   %esi
+f0109cba:	53                   	push   %ebx
+f0109cbb:	83 ec 3c             	sub    $0x3c,%esp
+f0109cbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109cc1:	c7 00 30 ec 10 f0    	movl   $0xf010ec30,(%eax)
+f0109cc7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f0109cce:	c7 40 08 30 ec 10 f0 	movl   $0xf010ec30,0x8(%eax)
+f0109cd5:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+f0109cdc:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0109cdf:	89 78 10             	mov    %edi,0x10(%eax)
+f0109ce2:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+f0109ce9:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0109cef:	0f 86 36 01 00 00    	jbe    f0109e2b <debuginfo_eip+0x176>
+f0109cf5:	c7 45 c4 15 f5 10 f0 	movl   $0xf010f515,-0x3c(%ebp)
+f0109cfc:	c7 45 c0 15 f5 10 f0 	movl   $0xf010f515,-0x40(%ebp)
+f0109d03:	be 14 f5 10 f0       	mov    $0xf010f514,%esi
+f0109d08:	bf 14 f5 10 f0       	mov    $0xf010f514,%edi
+f0109d0d:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0109d10:	39 4d c0             	cmp    %ecx,-0x40(%ebp)
+f0109d13:	0f 83 6c 02 00 00    	jae    f0109f85 <debuginfo_eip+0x2d0>
+f0109d19:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f0109d1d:	0f 85 69 02 00 00    	jne    f0109f8c <debuginfo_eip+0x2d7>
+f0109d23:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0109d2a:	29 fe                	sub    %edi,%esi
+f0109d2c:	c1 fe 02             	sar    $0x2,%esi
+f0109d2f:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f0109d35:	83 e8 01             	sub    $0x1,%eax
+f0109d38:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0109d3b:	83 ec 08             	sub    $0x8,%esp
+f0109d3e:	ff 75 08             	push   0x8(%ebp)
+f0109d41:	6a 64                	push   $0x64
+f0109d43:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0109d46:	89 c1                	mov    %eax,%ecx
+f0109d48:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0109d4b:	89 f8                	mov    %edi,%eax
+f0109d4d:	e8 58 fe ff ff       	call   f0109baa <stab_binsearch>
+f0109d52:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0109d55:	83 c4 10             	add    $0x10,%esp
+f0109d58:	85 f6                	test   %esi,%esi
+f0109d5a:	0f 84 33 02 00 00    	je     f0109f93 <debuginfo_eip+0x2de>
+f0109d60:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f0109d63:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0109d66:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+f0109d69:	83 ec 08             	sub    $0x8,%esp
+f0109d6c:	ff 75 08             	push   0x8(%ebp)
+f0109d6f:	6a 24                	push   $0x24
+f0109d71:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0109d74:	89 c1                	mov    %eax,%ecx
+f0109d76:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0109d79:	89 f8                	mov    %edi,%eax
+f0109d7b:	e8 2a fe ff ff       	call   f0109baa <stab_binsearch>
+f0109d80:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0109d83:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0109d86:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0109d89:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0109d8c:	83 c4 10             	add    $0x10,%esp
+f0109d8f:	39 d0                	cmp    %edx,%eax
+f0109d91:	0f 8f 3f 01 00 00    	jg     f0109ed6 <debuginfo_eip+0x221>
+f0109d97:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0109d9a:	8d 14 87             	lea    (%edi,%eax,4),%edx
+f0109d9d:	8b 02                	mov    (%edx),%eax
+f0109d9f:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0109da2:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f0109da5:	29 d9                	sub    %ebx,%ecx
+f0109da7:	39 c8                	cmp    %ecx,%eax
+f0109da9:	73 08                	jae    f0109db3 <debuginfo_eip+0xfe>
+f0109dab:	01 d8                	add    %ebx,%eax
+f0109dad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109db0:	89 43 08             	mov    %eax,0x8(%ebx)
+f0109db3:	8b 42 08             	mov    0x8(%edx),%eax
+f0109db6:	29 45 08             	sub    %eax,0x8(%ebp)
+f0109db9:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0109dbc:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+f0109dbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0109dc2:	89 41 10             	mov    %eax,0x10(%ecx)
+f0109dc5:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0109dc8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f0109dcb:	83 ec 08             	sub    $0x8,%esp
+f0109dce:	6a 3a                	push   $0x3a
+f0109dd0:	ff 71 08             	push   0x8(%ecx)
+f0109dd3:	e8 f2 0a 00 00       	call   f010a8ca <strfind>
+f0109dd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109ddb:	2b 43 08             	sub    0x8(%ebx),%eax
+f0109dde:	89 43 0c             	mov    %eax,0xc(%ebx)
+f0109de1:	83 c4 08             	add    $0x8,%esp
+f0109de4:	ff 75 08             	push   0x8(%ebp)
+f0109de7:	6a 44                	push   $0x44
+f0109de9:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0109dec:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0109def:	89 f8                	mov    %edi,%eax
+f0109df1:	e8 b4 fd ff ff       	call   f0109baa <stab_binsearch>
+f0109df6:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0109df9:	83 c4 10             	add    $0x10,%esp
+f0109dfc:	39 55 d0             	cmp    %edx,-0x30(%ebp)
+f0109dff:	0f 8f db 00 00 00    	jg     f0109ee0 <debuginfo_eip+0x22b>
+f0109e05:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0109e08:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+f0109e0f:	0f b7 44 87 06       	movzwl 0x6(%edi,%eax,4),%eax
+f0109e14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0109e17:	89 43 04             	mov    %eax,0x4(%ebx)
+f0109e1a:	39 d6                	cmp    %edx,%esi
+f0109e1c:	0f 8f 0b 01 00 00    	jg     f0109f2d <debuginfo_eip+0x278>
+f0109e22:	8d 44 0f 04          	lea    0x4(%edi,%ecx,1),%eax
+f0109e26:	e9 d0 00 00 00       	jmp    f0109efb <debuginfo_eip+0x246>
+f0109e2b:	e8 21 11 00 00       	call   f010af51 <cpunum>
+f0109e30:	6a 04                	push   $0x4
+f0109e32:	6a 10                	push   $0x10
+f0109e34:	68 00 00 20 00       	push   $0x200000
+f0109e39:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109e3f:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0109e45:	e8 5d ad ff ff       	call   f0104ba7 <user_mem_check>
+f0109e4a:	83 c4 10             	add    $0x10,%esp
+f0109e4d:	85 c0                	test   %eax,%eax
+f0109e4f:	0f 88 22 01 00 00    	js     f0109f77 <debuginfo_eip+0x2c2>
+f0109e55:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+f0109e5b:	8b 35 04 00 20 00    	mov    0x200004,%esi
+f0109e61:	a1 08 00 20 00       	mov    0x200008,%eax
+f0109e66:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0109e69:	8b 1d 0c 00 20 00    	mov    0x20000c,%ebx
+f0109e6f:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+f0109e72:	89 f1                	mov    %esi,%ecx
+f0109e74:	29 f9                	sub    %edi,%ecx
+f0109e76:	89 cb                	mov    %ecx,%ebx
+f0109e78:	e8 d4 10 00 00       	call   f010af51 <cpunum>
+f0109e7d:	6a 04                	push   $0x4
+f0109e7f:	53                   	push   %ebx
+f0109e80:	57                   	push   %edi
+f0109e81:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109e87:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0109e8d:	e8 15 ad ff ff       	call   f0104ba7 <user_mem_check>
+f0109e92:	83 c4 10             	add    $0x10,%esp
+f0109e95:	85 c0                	test   %eax,%eax
+f0109e97:	0f 88 e1 00 00 00    	js     f0109f7e <debuginfo_eip+0x2c9>
+f0109e9d:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0109ea0:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0109ea3:	29 c3                	sub    %eax,%ebx
+f0109ea5:	e8 a7 10 00 00       	call   f010af51 <cpunum>
+f0109eaa:	6a 04                	push   $0x4
+f0109eac:	53                   	push   %ebx
+f0109ead:	ff 75 c0             	push   -0x40(%ebp)
+f0109eb0:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0109eb6:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f0109ebc:	e8 e6 ac ff ff       	call   f0104ba7 <user_mem_check>
+f0109ec1:	83 c4 10             	add    $0x10,%esp
+f0109ec4:	85 c0                	test   %eax,%eax
+f0109ec6:	0f 89 41 fe ff ff    	jns    f0109d0d <debuginfo_eip+0x58>
+f0109ecc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109ed1:	e9 99 00 00 00       	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109ed6:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109ed9:	89 f2                	mov    %esi,%edx
+f0109edb:	e9 df fe ff ff       	jmp    f0109dbf <debuginfo_eip+0x10a>
+f0109ee0:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0109ee3:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+f0109eea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109eef:	eb 7e                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109ef1:	83 ea 01             	sub    $0x1,%edx
+f0109ef4:	83 e8 0c             	sub    $0xc,%eax
+f0109ef7:	39 d6                	cmp    %edx,%esi
+f0109ef9:	7f 32                	jg     f0109f2d <debuginfo_eip+0x278>
+f0109efb:	0f b6 08             	movzbl (%eax),%ecx
+f0109efe:	80 f9 84             	cmp    $0x84,%cl
+f0109f01:	74 0b                	je     f0109f0e <debuginfo_eip+0x259>
+f0109f03:	80 f9 64             	cmp    $0x64,%cl
+f0109f06:	75 e9                	jne    f0109ef1 <debuginfo_eip+0x23c>
+f0109f08:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0109f0c:	74 e3                	je     f0109ef1 <debuginfo_eip+0x23c>
+f0109f0e:	39 d6                	cmp    %edx,%esi
+f0109f10:	7f 1b                	jg     f0109f2d <debuginfo_eip+0x278>
+f0109f12:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0109f15:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f0109f18:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0109f1b:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f0109f1e:	29 f0                	sub    %esi,%eax
+f0109f20:	39 c2                	cmp    %eax,%edx
+f0109f22:	73 09                	jae    f0109f2d <debuginfo_eip+0x278>
+f0109f24:	89 f0                	mov    %esi,%eax
+f0109f26:	01 d0                	add    %edx,%eax
+f0109f28:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0109f2b:	89 06                	mov    %eax,(%esi)
+f0109f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109f32:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0109f35:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f0109f38:	39 f3                	cmp    %esi,%ebx
+f0109f3a:	7d 33                	jge    f0109f6f <debuginfo_eip+0x2ba>
+f0109f3c:	8d 43 01             	lea    0x1(%ebx),%eax
+f0109f3f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0109f42:	39 c6                	cmp    %eax,%esi
+f0109f44:	7e 54                	jle    f0109f9a <debuginfo_eip+0x2e5>
+f0109f46:	8d 53 02             	lea    0x2(%ebx),%edx
+f0109f49:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0109f4c:	8d 44 87 10          	lea    0x10(%edi,%eax,4),%eax
+f0109f50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0109f53:	80 38 a0             	cmpb   $0xa0,(%eax)
+f0109f56:	75 12                	jne    f0109f6a <debuginfo_eip+0x2b5>
+f0109f58:	83 41 14 01          	addl   $0x1,0x14(%ecx)
+f0109f5c:	8d 5a 01             	lea    0x1(%edx),%ebx
+f0109f5f:	83 c0 0c             	add    $0xc,%eax
+f0109f62:	39 d6                	cmp    %edx,%esi
+f0109f64:	74 3b                	je     f0109fa1 <debuginfo_eip+0x2ec>
+f0109f66:	89 da                	mov    %ebx,%edx
+f0109f68:	eb e9                	jmp    f0109f53 <debuginfo_eip+0x29e>
+f0109f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109f72:	5b                   	pop    %ebx
+f0109f73:	5e                   	pop    %esi
+f0109f74:	5f                   	pop    %edi
+f0109f75:	5d                   	pop    %ebp
+f0109f76:	c3                   	ret
+f0109f77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109f7c:	eb f1                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109f7e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109f83:	eb ea                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109f85:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109f8a:	eb e3                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109f8c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109f91:	eb dc                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109f93:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0109f98:	eb d5                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109f9f:	eb ce                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+f0109fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109fa6:	eb c7                	jmp    f0109f6f <debuginfo_eip+0x2ba>
+
+f0109fa8 <printnum>:
+f0109fa8:	55                   	push   %ebp
+f0109fa9:	89 e5                	mov    %esp,%ebp
+f0109fab:	57                   	push   %edi
+f0109fac:	56                   	push   %esi
+f0109fad:	53                   	push   %ebx
+f0109fae:	83 ec 1c             	sub    $0x1c,%esp
+f0109fb1:	89 c3                	mov    %eax,%ebx
+f0109fb3:	89 d6                	mov    %edx,%esi
+f0109fb5:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109fb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109fbb:	89 d1                	mov    %edx,%ecx
+f0109fbd:	89 c2                	mov    %eax,%edx
+f0109fbf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0109fc2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0109fc5:	8b 45 10             	mov    0x10(%ebp),%eax
+f0109fc8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0109fcb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0109fd2:	39 c2                	cmp    %eax,%edx
+f0109fd4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0109fd7:	73 4b                	jae    f010a024 <printnum+0x7c>
+f0109fd9:	8b 45 14             	mov    0x14(%ebp),%eax
+f0109fdc:	8d 78 ff             	lea    -0x1(%eax),%edi
+f0109fdf:	85 ff                	test   %edi,%edi
+f0109fe1:	7e 11                	jle    f0109ff4 <printnum+0x4c>
+f0109fe3:	83 ec 08             	sub    $0x8,%esp
+f0109fe6:	56                   	push   %esi
+f0109fe7:	ff 75 18             	push   0x18(%ebp)
+f0109fea:	ff d3                	call   *%ebx
+f0109fec:	83 c4 10             	add    $0x10,%esp
+f0109fef:	83 ef 01             	sub    $0x1,%edi
+f0109ff2:	75 ef                	jne    f0109fe3 <printnum+0x3b>
+f0109ff4:	83 ec 08             	sub    $0x8,%esp
+f0109ff7:	56                   	push   %esi
+f0109ff8:	83 ec 04             	sub    $0x4,%esp
+f0109ffb:	ff 75 e4             	push   -0x1c(%ebp)
+f0109ffe:	ff 75 e0             	push   -0x20(%ebp)
+f010a001:	ff 75 dc             	push   -0x24(%ebp)
+f010a004:	ff 75 d8             	push   -0x28(%ebp)
+f010a007:	e8 f1 2e 00 00       	call   f010cefd <__umoddi3>
+f010a00c:	83 c4 14             	add    $0x14,%esp
+f010a00f:	0f be 80 3a ec 10 f0 	movsbl -0xfef13c6(%eax),%eax
+f010a016:	50                   	push   %eax
+f010a017:	ff d3                	call   *%ebx
+f010a019:	83 c4 10             	add    $0x10,%esp
+f010a01c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a01f:	5b                   	pop    %ebx
+f010a020:	5e                   	pop    %esi
+f010a021:	5f                   	pop    %edi
+f010a022:	5d                   	pop    %ebp
+f010a023:	c3                   	ret
+f010a024:	83 ec 0c             	sub    $0xc,%esp
+f010a027:	ff 75 18             	push   0x18(%ebp)
+f010a02a:	8b 7d 14             	mov    0x14(%ebp),%edi
+f010a02d:	8d 57 ff             	lea    -0x1(%edi),%edx
+f010a030:	52                   	push   %edx
+f010a031:	50                   	push   %eax
+f010a032:	83 ec 08             	sub    $0x8,%esp
+f010a035:	ff 75 e4             	push   -0x1c(%ebp)
+f010a038:	ff 75 e0             	push   -0x20(%ebp)
+f010a03b:	ff 75 dc             	push   -0x24(%ebp)
+f010a03e:	ff 75 d8             	push   -0x28(%ebp)
+f010a041:	e8 99 2e 00 00       	call   f010cedf <__udivdi3>
+f010a046:	83 c4 18             	add    $0x18,%esp
+f010a049:	52                   	push   %edx
+f010a04a:	50                   	push   %eax
+f010a04b:	89 f2                	mov    %esi,%edx
+f010a04d:	89 d8                	mov    %ebx,%eax
+f010a04f:	e8 54 ff ff ff       	call   f0109fa8 <printnum>
+f010a054:	83 c4 20             	add    $0x20,%esp
+f010a057:	eb 9b                	jmp    f0109ff4 <printnum+0x4c>
+
+f010a059 <sprintputch>:
+f010a059:	55                   	push   %ebp
+f010a05a:	89 e5                	mov    %esp,%ebp
+f010a05c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a05f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+f010a063:	8b 10                	mov    (%eax),%edx
+f010a065:	3b 50 04             	cmp    0x4(%eax),%edx
+f010a068:	73 0a                	jae    f010a074 <sprintputch+0x1b>
+f010a06a:	8d 4a 01             	lea    0x1(%edx),%ecx
+f010a06d:	89 08                	mov    %ecx,(%eax)
+f010a06f:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a072:	88 02                	mov    %al,(%edx)
+f010a074:	5d                   	pop    %ebp
+f010a075:	c3                   	ret
+
+f010a076 <printfmt>:
+f010a076:	55                   	push   %ebp
+f010a077:	89 e5                	mov    %esp,%ebp
+f010a079:	83 ec 08             	sub    $0x8,%esp
+f010a07c:	8d 45 14             	lea    0x14(%ebp),%eax
+f010a07f:	50                   	push   %eax
+f010a080:	ff 75 10             	push   0x10(%ebp)
+f010a083:	ff 75 0c             	push   0xc(%ebp)
+f010a086:	ff 75 08             	push   0x8(%ebp)
+f010a089:	e8 05 00 00 00       	call   f010a093 <vprintfmt>
+f010a08e:	83 c4 10             	add    $0x10,%esp
+f010a091:	c9                   	leave
+f010a092:	c3                   	ret
+
+f010a093 <vprintfmt>:
+f010a093:	55                   	push   %ebp
+f010a094:	89 e5                	mov    %esp,%ebp
+f010a096:	57                   	push   %edi
+f010a097:	56                   	push   %esi
+f010a098:	53                   	push   %ebx
+f010a099:	83 ec 2c             	sub    $0x2c,%esp
+f010a09c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010a09f:	89 df                	mov    %ebx,%edi
+f010a0a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010a0a4:	8b 45 10             	mov    0x10(%ebp),%eax
+f010a0a7:	8d 70 01             	lea    0x1(%eax),%esi
+f010a0aa:	0f b6 00             	movzbl (%eax),%eax
+f010a0ad:	83 f8 25             	cmp    $0x25,%eax
+f010a0b0:	74 1e                	je     f010a0d0 <vprintfmt+0x3d>
+f010a0b2:	85 c0                	test   %eax,%eax
+f010a0b4:	0f 84 15 05 00 00    	je     f010a5cf <vprintfmt+0x53c>
+f010a0ba:	83 ec 08             	sub    $0x8,%esp
+f010a0bd:	53                   	push   %ebx
+f010a0be:	50                   	push   %eax
+f010a0bf:	ff d7                	call   *%edi
+f010a0c1:	83 c6 01             	add    $0x1,%esi
+f010a0c4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f010a0c8:	83 c4 10             	add    $0x10,%esp
+f010a0cb:	83 f8 25             	cmp    $0x25,%eax
+f010a0ce:	75 e2                	jne    f010a0b2 <vprintfmt+0x1f>
+f010a0d0:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+f010a0d4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f010a0db:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+f010a0e2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+f010a0e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a0ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f010a0f1:	8d 56 01             	lea    0x1(%esi),%edx
+f010a0f4:	0f b6 0e             	movzbl (%esi),%ecx
+f010a0f7:	8d 41 dd             	lea    -0x23(%ecx),%eax
+f010a0fa:	3c 55                	cmp    $0x55,%al
+f010a0fc:	0f 87 3b 04 00 00    	ja     f010a53d <vprintfmt+0x4aa>
+f010a102:	0f b6 c0             	movzbl %al,%eax
+f010a105:	ff 24 85 60 ed 10 f0 	jmp    *-0xfef12a0(,%eax,4)
+f010a10c:	89 75 10             	mov    %esi,0x10(%ebp)
+f010a10f:	eb 93                	jmp    f010a0a4 <vprintfmt+0x11>
+f010a111:	89 d6                	mov    %edx,%esi
+f010a113:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+f010a117:	eb d8                	jmp    f010a0f1 <vprintfmt+0x5e>
+f010a119:	89 d6                	mov    %edx,%esi
+f010a11b:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+f010a11f:	eb d0                	jmp    f010a0f1 <vprintfmt+0x5e>
+f010a121:	0f b6 c9             	movzbl %cl,%ecx
+f010a124:	8d 41 d0             	lea    -0x30(%ecx),%eax
+f010a127:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010a12a:	0f be 46 01          	movsbl 0x1(%esi),%eax
+f010a12e:	8d 48 d0             	lea    -0x30(%eax),%ecx
+f010a131:	83 f9 09             	cmp    $0x9,%ecx
+f010a134:	77 6f                	ja     f010a1a5 <vprintfmt+0x112>
+f010a136:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010a139:	83 c2 01             	add    $0x1,%edx
+f010a13c:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+f010a13f:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+f010a143:	0f be 02             	movsbl (%edx),%eax
+f010a146:	8d 70 d0             	lea    -0x30(%eax),%esi
+f010a149:	83 fe 09             	cmp    $0x9,%esi
+f010a14c:	76 eb                	jbe    f010a139 <vprintfmt+0xa6>
+f010a14e:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+f010a151:	89 d6                	mov    %edx,%esi
+f010a153:	eb 13                	jmp    f010a168 <vprintfmt+0xd5>
+f010a155:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a158:	8b 00                	mov    (%eax),%eax
+f010a15a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010a15d:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a160:	8d 40 04             	lea    0x4(%eax),%eax
+f010a163:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a166:	89 d6                	mov    %edx,%esi
+f010a168:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f010a16c:	79 83                	jns    f010a0f1 <vprintfmt+0x5e>
+f010a16e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010a171:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010a174:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+f010a17b:	e9 71 ff ff ff       	jmp    f010a0f1 <vprintfmt+0x5e>
+f010a180:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010a183:	85 c9                	test   %ecx,%ecx
+f010a185:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a18a:	0f 49 c1             	cmovns %ecx,%eax
+f010a18d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010a190:	89 d6                	mov    %edx,%esi
+f010a192:	e9 5a ff ff ff       	jmp    f010a0f1 <vprintfmt+0x5e>
+f010a197:	89 d6                	mov    %edx,%esi
+f010a199:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+f010a1a0:	e9 4c ff ff ff       	jmp    f010a0f1 <vprintfmt+0x5e>
+f010a1a5:	89 d6                	mov    %edx,%esi
+f010a1a7:	eb bf                	jmp    f010a168 <vprintfmt+0xd5>
+f010a1a9:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f010a1ad:	89 d6                	mov    %edx,%esi
+f010a1af:	e9 3d ff ff ff       	jmp    f010a0f1 <vprintfmt+0x5e>
+f010a1b4:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a1b7:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a1ba:	8d 70 04             	lea    0x4(%eax),%esi
+f010a1bd:	83 ec 08             	sub    $0x8,%esp
+f010a1c0:	53                   	push   %ebx
+f010a1c1:	ff 30                	push   (%eax)
+f010a1c3:	ff d7                	call   *%edi
+f010a1c5:	83 c4 10             	add    $0x10,%esp
+f010a1c8:	89 75 14             	mov    %esi,0x14(%ebp)
+f010a1cb:	e9 d4 fe ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a1d0:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a1d3:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a1d6:	8d 70 04             	lea    0x4(%eax),%esi
+f010a1d9:	8b 10                	mov    (%eax),%edx
+f010a1db:	89 d0                	mov    %edx,%eax
+f010a1dd:	f7 d8                	neg    %eax
+f010a1df:	0f 48 c2             	cmovs  %edx,%eax
+f010a1e2:	83 f8 12             	cmp    $0x12,%eax
+f010a1e5:	7f 23                	jg     f010a20a <vprintfmt+0x177>
+f010a1e7:	8b 14 85 c0 ee 10 f0 	mov    -0xfef1140(,%eax,4),%edx
+f010a1ee:	85 d2                	test   %edx,%edx
+f010a1f0:	74 18                	je     f010a20a <vprintfmt+0x177>
+f010a1f2:	52                   	push   %edx
+f010a1f3:	68 1f e2 10 f0       	push   $0xf010e21f
+f010a1f8:	53                   	push   %ebx
+f010a1f9:	57                   	push   %edi
+f010a1fa:	e8 77 fe ff ff       	call   f010a076 <printfmt>
+f010a1ff:	83 c4 10             	add    $0x10,%esp
+f010a202:	89 75 14             	mov    %esi,0x14(%ebp)
+f010a205:	e9 9a fe ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a20a:	50                   	push   %eax
+f010a20b:	68 52 ec 10 f0       	push   $0xf010ec52
+f010a210:	53                   	push   %ebx
+f010a211:	57                   	push   %edi
+f010a212:	e8 5f fe ff ff       	call   f010a076 <printfmt>
+f010a217:	83 c4 10             	add    $0x10,%esp
+f010a21a:	89 75 14             	mov    %esi,0x14(%ebp)
+f010a21d:	e9 82 fe ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a222:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a225:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a228:	83 c0 04             	add    $0x4,%eax
+f010a22b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f010a22e:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a231:	8b 00                	mov    (%eax),%eax
+f010a233:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f010a236:	85 c0                	test   %eax,%eax
+f010a238:	0f 84 61 03 00 00    	je     f010a59f <vprintfmt+0x50c>
+f010a23e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f010a242:	7e 06                	jle    f010a24a <vprintfmt+0x1b7>
+f010a244:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+f010a248:	75 29                	jne    f010a273 <vprintfmt+0x1e0>
+f010a24a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010a24d:	8d 70 01             	lea    0x1(%eax),%esi
+f010a250:	0f b6 00             	movzbl (%eax),%eax
+f010a253:	0f be d0             	movsbl %al,%edx
+f010a256:	85 d2                	test   %edx,%edx
+f010a258:	0f 84 bb 00 00 00    	je     f010a319 <vprintfmt+0x286>
+f010a25e:	89 7d 08             	mov    %edi,0x8(%ebp)
+f010a261:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010a264:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f010a267:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f010a26a:	eb 7a                	jmp    f010a2e6 <vprintfmt+0x253>
+f010a26c:	c7 45 d0 4b ec 10 f0 	movl   $0xf010ec4b,-0x30(%ebp)
+f010a273:	83 ec 08             	sub    $0x8,%esp
+f010a276:	ff 75 d4             	push   -0x2c(%ebp)
+f010a279:	ff 75 d0             	push   -0x30(%ebp)
+f010a27c:	e8 ce 04 00 00       	call   f010a74f <strnlen>
+f010a281:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+f010a284:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010a287:	83 c4 10             	add    $0x10,%esp
+f010a28a:	85 d2                	test   %edx,%edx
+f010a28c:	0f 8e d6 02 00 00    	jle    f010a568 <vprintfmt+0x4d5>
+f010a292:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+f010a296:	83 ec 08             	sub    $0x8,%esp
+f010a299:	53                   	push   %ebx
+f010a29a:	56                   	push   %esi
+f010a29b:	ff d7                	call   *%edi
+f010a29d:	83 c4 10             	add    $0x10,%esp
+f010a2a0:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+f010a2a4:	75 f0                	jne    f010a296 <vprintfmt+0x203>
+f010a2a6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010a2a9:	8d 70 01             	lea    0x1(%eax),%esi
+f010a2ac:	0f b6 00             	movzbl (%eax),%eax
+f010a2af:	0f be d0             	movsbl %al,%edx
+f010a2b2:	85 d2                	test   %edx,%edx
+f010a2b4:	0f 84 da 02 00 00    	je     f010a594 <vprintfmt+0x501>
+f010a2ba:	89 7d 08             	mov    %edi,0x8(%ebp)
+f010a2bd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010a2c0:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f010a2c3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f010a2c6:	eb 1e                	jmp    f010a2e6 <vprintfmt+0x253>
+f010a2c8:	83 ec 08             	sub    $0x8,%esp
+f010a2cb:	ff 75 0c             	push   0xc(%ebp)
+f010a2ce:	52                   	push   %edx
+f010a2cf:	ff 55 08             	call   *0x8(%ebp)
+f010a2d2:	83 c4 10             	add    $0x10,%esp
+f010a2d5:	83 eb 01             	sub    $0x1,%ebx
+f010a2d8:	83 c6 01             	add    $0x1,%esi
+f010a2db:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f010a2df:	0f be d0             	movsbl %al,%edx
+f010a2e2:	85 d2                	test   %edx,%edx
+f010a2e4:	74 2a                	je     f010a310 <vprintfmt+0x27d>
+f010a2e6:	85 ff                	test   %edi,%edi
+f010a2e8:	78 05                	js     f010a2ef <vprintfmt+0x25c>
+f010a2ea:	83 ef 01             	sub    $0x1,%edi
+f010a2ed:	78 59                	js     f010a348 <vprintfmt+0x2b5>
+f010a2ef:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f010a2f3:	74 d3                	je     f010a2c8 <vprintfmt+0x235>
+f010a2f5:	0f be c0             	movsbl %al,%eax
+f010a2f8:	83 e8 20             	sub    $0x20,%eax
+f010a2fb:	83 f8 5e             	cmp    $0x5e,%eax
+f010a2fe:	76 c8                	jbe    f010a2c8 <vprintfmt+0x235>
+f010a300:	83 ec 08             	sub    $0x8,%esp
+f010a303:	ff 75 0c             	push   0xc(%ebp)
+f010a306:	6a 3f                	push   $0x3f
+f010a308:	ff 55 08             	call   *0x8(%ebp)
+f010a30b:	83 c4 10             	add    $0x10,%esp
+f010a30e:	eb c5                	jmp    f010a2d5 <vprintfmt+0x242>
+f010a310:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f010a313:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010a316:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010a319:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f010a31c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f010a320:	7e 1b                	jle    f010a33d <vprintfmt+0x2aa>
+f010a322:	83 ec 08             	sub    $0x8,%esp
+f010a325:	53                   	push   %ebx
+f010a326:	6a 20                	push   $0x20
+f010a328:	ff d7                	call   *%edi
+f010a32a:	83 c4 10             	add    $0x10,%esp
+f010a32d:	83 ee 01             	sub    $0x1,%esi
+f010a330:	75 f0                	jne    f010a322 <vprintfmt+0x28f>
+f010a332:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010a335:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a338:	e9 67 fd ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a33d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010a340:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a343:	e9 5c fd ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a348:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f010a34b:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010a34e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010a351:	eb c6                	jmp    f010a319 <vprintfmt+0x286>
+f010a353:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010a356:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a359:	83 f9 01             	cmp    $0x1,%ecx
+f010a35c:	7f 1f                	jg     f010a37d <vprintfmt+0x2ea>
+f010a35e:	85 c9                	test   %ecx,%ecx
+f010a360:	74 67                	je     f010a3c9 <vprintfmt+0x336>
+f010a362:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a365:	8b 30                	mov    (%eax),%esi
+f010a367:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f010a36a:	89 f0                	mov    %esi,%eax
+f010a36c:	c1 f8 1f             	sar    $0x1f,%eax
+f010a36f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010a372:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a375:	8d 40 04             	lea    0x4(%eax),%eax
+f010a378:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a37b:	eb 17                	jmp    f010a394 <vprintfmt+0x301>
+f010a37d:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a380:	8b 50 04             	mov    0x4(%eax),%edx
+f010a383:	8b 00                	mov    (%eax),%eax
+f010a385:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010a388:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f010a38b:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a38e:	8d 40 08             	lea    0x8(%eax),%eax
+f010a391:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a394:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f010a397:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010a39a:	be 0a 00 00 00       	mov    $0xa,%esi
+f010a39f:	85 c9                	test   %ecx,%ecx
+f010a3a1:	0f 89 12 01 00 00    	jns    f010a4b9 <vprintfmt+0x426>
+f010a3a7:	83 ec 08             	sub    $0x8,%esp
+f010a3aa:	53                   	push   %ebx
+f010a3ab:	6a 2d                	push   $0x2d
+f010a3ad:	ff d7                	call   *%edi
+f010a3af:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f010a3b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010a3b5:	f7 da                	neg    %edx
+f010a3b7:	83 d1 00             	adc    $0x0,%ecx
+f010a3ba:	f7 d9                	neg    %ecx
+f010a3bc:	83 c4 10             	add    $0x10,%esp
+f010a3bf:	be 0a 00 00 00       	mov    $0xa,%esi
+f010a3c4:	e9 f0 00 00 00       	jmp    f010a4b9 <vprintfmt+0x426>
+f010a3c9:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a3cc:	8b 30                	mov    (%eax),%esi
+f010a3ce:	89 75 d8             	mov    %esi,-0x28(%ebp)
+f010a3d1:	89 f0                	mov    %esi,%eax
+f010a3d3:	c1 f8 1f             	sar    $0x1f,%eax
+f010a3d6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010a3d9:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a3dc:	8d 40 04             	lea    0x4(%eax),%eax
+f010a3df:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a3e2:	eb b0                	jmp    f010a394 <vprintfmt+0x301>
+f010a3e4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010a3e7:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a3ea:	83 f9 01             	cmp    $0x1,%ecx
+f010a3ed:	7f 1e                	jg     f010a40d <vprintfmt+0x37a>
+f010a3ef:	85 c9                	test   %ecx,%ecx
+f010a3f1:	74 32                	je     f010a425 <vprintfmt+0x392>
+f010a3f3:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a3f6:	8b 10                	mov    (%eax),%edx
+f010a3f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a3fd:	8d 40 04             	lea    0x4(%eax),%eax
+f010a400:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a403:	be 0a 00 00 00       	mov    $0xa,%esi
+f010a408:	e9 ac 00 00 00       	jmp    f010a4b9 <vprintfmt+0x426>
+f010a40d:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a410:	8b 10                	mov    (%eax),%edx
+f010a412:	8b 48 04             	mov    0x4(%eax),%ecx
+f010a415:	8d 40 08             	lea    0x8(%eax),%eax
+f010a418:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a41b:	be 0a 00 00 00       	mov    $0xa,%esi
+f010a420:	e9 94 00 00 00       	jmp    f010a4b9 <vprintfmt+0x426>
+f010a425:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a428:	8b 10                	mov    (%eax),%edx
+f010a42a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a42f:	8d 40 04             	lea    0x4(%eax),%eax
+f010a432:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a435:	be 0a 00 00 00       	mov    $0xa,%esi
+f010a43a:	eb 7d                	jmp    f010a4b9 <vprintfmt+0x426>
+f010a43c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010a43f:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a442:	83 f9 01             	cmp    $0x1,%ecx
+f010a445:	7f 1b                	jg     f010a462 <vprintfmt+0x3cf>
+f010a447:	85 c9                	test   %ecx,%ecx
+f010a449:	74 2c                	je     f010a477 <vprintfmt+0x3e4>
+f010a44b:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a44e:	8b 10                	mov    (%eax),%edx
+f010a450:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a455:	8d 40 04             	lea    0x4(%eax),%eax
+f010a458:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a45b:	be 08 00 00 00       	mov    $0x8,%esi
+f010a460:	eb 57                	jmp    f010a4b9 <vprintfmt+0x426>
+f010a462:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a465:	8b 10                	mov    (%eax),%edx
+f010a467:	8b 48 04             	mov    0x4(%eax),%ecx
+f010a46a:	8d 40 08             	lea    0x8(%eax),%eax
+f010a46d:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a470:	be 08 00 00 00       	mov    $0x8,%esi
+f010a475:	eb 42                	jmp    f010a4b9 <vprintfmt+0x426>
+f010a477:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a47a:	8b 10                	mov    (%eax),%edx
+f010a47c:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a481:	8d 40 04             	lea    0x4(%eax),%eax
+f010a484:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a487:	be 08 00 00 00       	mov    $0x8,%esi
+f010a48c:	eb 2b                	jmp    f010a4b9 <vprintfmt+0x426>
+f010a48e:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a491:	83 ec 08             	sub    $0x8,%esp
+f010a494:	53                   	push   %ebx
+f010a495:	6a 30                	push   $0x30
+f010a497:	ff d7                	call   *%edi
+f010a499:	83 c4 08             	add    $0x8,%esp
+f010a49c:	53                   	push   %ebx
+f010a49d:	6a 78                	push   $0x78
+f010a49f:	ff d7                	call   *%edi
+f010a4a1:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a4a4:	8b 10                	mov    (%eax),%edx
+f010a4a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a4ab:	83 c4 10             	add    $0x10,%esp
+f010a4ae:	8d 40 04             	lea    0x4(%eax),%eax
+f010a4b1:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a4b4:	be 10 00 00 00       	mov    $0x10,%esi
+f010a4b9:	83 ec 0c             	sub    $0xc,%esp
+f010a4bc:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+f010a4c0:	50                   	push   %eax
+f010a4c1:	ff 75 e4             	push   -0x1c(%ebp)
+f010a4c4:	56                   	push   %esi
+f010a4c5:	51                   	push   %ecx
+f010a4c6:	52                   	push   %edx
+f010a4c7:	89 da                	mov    %ebx,%edx
+f010a4c9:	89 f8                	mov    %edi,%eax
+f010a4cb:	e8 d8 fa ff ff       	call   f0109fa8 <printnum>
+f010a4d0:	83 c4 20             	add    $0x20,%esp
+f010a4d3:	e9 cc fb ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a4d8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010a4db:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a4de:	83 f9 01             	cmp    $0x1,%ecx
+f010a4e1:	7f 1b                	jg     f010a4fe <vprintfmt+0x46b>
+f010a4e3:	85 c9                	test   %ecx,%ecx
+f010a4e5:	74 2c                	je     f010a513 <vprintfmt+0x480>
+f010a4e7:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a4ea:	8b 10                	mov    (%eax),%edx
+f010a4ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a4f1:	8d 40 04             	lea    0x4(%eax),%eax
+f010a4f4:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a4f7:	be 10 00 00 00       	mov    $0x10,%esi
+f010a4fc:	eb bb                	jmp    f010a4b9 <vprintfmt+0x426>
+f010a4fe:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a501:	8b 10                	mov    (%eax),%edx
+f010a503:	8b 48 04             	mov    0x4(%eax),%ecx
+f010a506:	8d 40 08             	lea    0x8(%eax),%eax
+f010a509:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a50c:	be 10 00 00 00       	mov    $0x10,%esi
+f010a511:	eb a6                	jmp    f010a4b9 <vprintfmt+0x426>
+f010a513:	8b 45 14             	mov    0x14(%ebp),%eax
+f010a516:	8b 10                	mov    (%eax),%edx
+f010a518:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010a51d:	8d 40 04             	lea    0x4(%eax),%eax
+f010a520:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a523:	be 10 00 00 00       	mov    $0x10,%esi
+f010a528:	eb 8f                	jmp    f010a4b9 <vprintfmt+0x426>
+f010a52a:	89 55 10             	mov    %edx,0x10(%ebp)
+f010a52d:	83 ec 08             	sub    $0x8,%esp
+f010a530:	53                   	push   %ebx
+f010a531:	6a 25                	push   $0x25
+f010a533:	ff d7                	call   *%edi
+f010a535:	83 c4 10             	add    $0x10,%esp
+f010a538:	e9 67 fb ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a53d:	83 ec 08             	sub    $0x8,%esp
+f010a540:	53                   	push   %ebx
+f010a541:	6a 25                	push   $0x25
+f010a543:	ff d7                	call   *%edi
+f010a545:	83 c4 10             	add    $0x10,%esp
+f010a548:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+f010a54c:	0f 84 ba fb ff ff    	je     f010a10c <vprintfmt+0x79>
+f010a552:	89 75 10             	mov    %esi,0x10(%ebp)
+f010a555:	89 f0                	mov    %esi,%eax
+f010a557:	83 e8 01             	sub    $0x1,%eax
+f010a55a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f010a55e:	75 f7                	jne    f010a557 <vprintfmt+0x4c4>
+f010a560:	89 45 10             	mov    %eax,0x10(%ebp)
+f010a563:	e9 3c fb ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a568:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010a56b:	8d 70 01             	lea    0x1(%eax),%esi
+f010a56e:	0f b6 00             	movzbl (%eax),%eax
+f010a571:	0f be d0             	movsbl %al,%edx
+f010a574:	85 d2                	test   %edx,%edx
+f010a576:	74 11                	je     f010a589 <vprintfmt+0x4f6>
+f010a578:	89 7d 08             	mov    %edi,0x8(%ebp)
+f010a57b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010a57e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f010a581:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f010a584:	e9 5d fd ff ff       	jmp    f010a2e6 <vprintfmt+0x253>
+f010a589:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010a58c:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a58f:	e9 10 fb ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a594:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010a597:	89 45 14             	mov    %eax,0x14(%ebp)
+f010a59a:	e9 05 fb ff ff       	jmp    f010a0a4 <vprintfmt+0x11>
+f010a59f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f010a5a3:	7e 0a                	jle    f010a5af <vprintfmt+0x51c>
+f010a5a5:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+f010a5a9:	0f 85 bd fc ff ff    	jne    f010a26c <vprintfmt+0x1d9>
+f010a5af:	ba 28 00 00 00       	mov    $0x28,%edx
+f010a5b4:	b8 28 00 00 00       	mov    $0x28,%eax
+f010a5b9:	be 4c ec 10 f0       	mov    $0xf010ec4c,%esi
+f010a5be:	89 7d 08             	mov    %edi,0x8(%ebp)
+f010a5c1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010a5c4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+f010a5c7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f010a5ca:	e9 17 fd ff ff       	jmp    f010a2e6 <vprintfmt+0x253>
+f010a5cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a5d2:	5b                   	pop    %ebx
+f010a5d3:	5e                   	pop    %esi
+f010a5d4:	5f                   	pop    %edi
+f010a5d5:	5d                   	pop    %ebp
+f010a5d6:	c3                   	ret
+
+f010a5d7 <vsnprintf>:
+f010a5d7:	55                   	push   %ebp
+f010a5d8:	89 e5                	mov    %esp,%ebp
+f010a5da:	83 ec 18             	sub    $0x18,%esp
+f010a5dd:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a5e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a5e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f010a5e6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f010a5ea:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f010a5ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+f010a5f4:	85 c0                	test   %eax,%eax
+f010a5f6:	74 26                	je     f010a61e <vsnprintf+0x47>
+f010a5f8:	85 d2                	test   %edx,%edx
+f010a5fa:	7e 22                	jle    f010a61e <vsnprintf+0x47>
+f010a5fc:	ff 75 14             	push   0x14(%ebp)
+f010a5ff:	ff 75 10             	push   0x10(%ebp)
+f010a602:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f010a605:	50                   	push   %eax
+f010a606:	68 59 a0 10 f0       	push   $0xf010a059
+f010a60b:	e8 83 fa ff ff       	call   f010a093 <vprintfmt>
+f010a610:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f010a613:	c6 00 00             	movb   $0x0,(%eax)
+f010a616:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010a619:	83 c4 10             	add    $0x10,%esp
+f010a61c:	c9                   	leave
+f010a61d:	c3                   	ret
+f010a61e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010a623:	eb f7                	jmp    f010a61c <vsnprintf+0x45>
+
+f010a625 <snprintf>:
+f010a625:	55                   	push   %ebp
+f010a626:	89 e5                	mov    %esp,%ebp
+f010a628:	83 ec 08             	sub    $0x8,%esp
+f010a62b:	8d 45 14             	lea    0x14(%ebp),%eax
+f010a62e:	50                   	push   %eax
+f010a62f:	ff 75 10             	push   0x10(%ebp)
+f010a632:	ff 75 0c             	push   0xc(%ebp)
+f010a635:	ff 75 08             	push   0x8(%ebp)
+f010a638:	e8 9a ff ff ff       	call   f010a5d7 <vsnprintf>
+f010a63d:	c9                   	leave
+f010a63e:	c3                   	ret
+
+f010a63f <readline>:
+f010a63f:	55                   	push   %ebp
+f010a640:	89 e5                	mov    %esp,%ebp
+f010a642:	57                   	push   %edi
+f010a643:	56                   	push   %esi
+f010a644:	53                   	push   %ebx
+f010a645:	83 ec 0c             	sub    $0xc,%esp
+f010a648:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a64b:	85 c0                	test   %eax,%eax
+f010a64d:	74 11                	je     f010a660 <readline+0x21>
+f010a64f:	83 ec 08             	sub    $0x8,%esp
+f010a652:	50                   	push   %eax
+f010a653:	68 1f e2 10 f0       	push   $0xf010e21f
+f010a658:	e8 aa b6 ff ff       	call   f0105d07 <cprintf>
+f010a65d:	83 c4 10             	add    $0x10,%esp
+f010a660:	83 ec 0c             	sub    $0xc,%esp
+f010a663:	6a 00                	push   $0x0
+f010a665:	e8 03 62 ff ff       	call   f010086d <iscons>
+f010a66a:	89 c7                	mov    %eax,%edi
+f010a66c:	83 c4 10             	add    $0x10,%esp
+f010a66f:	be 00 00 00 00       	mov    $0x0,%esi
+f010a674:	eb 4b                	jmp    f010a6c1 <readline+0x82>
+f010a676:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a67b:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f010a67e:	75 08                	jne    f010a688 <readline+0x49>
+f010a680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a683:	5b                   	pop    %ebx
+f010a684:	5e                   	pop    %esi
+f010a685:	5f                   	pop    %edi
+f010a686:	5d                   	pop    %ebp
+f010a687:	c3                   	ret
+f010a688:	83 ec 08             	sub    $0x8,%esp
+f010a68b:	53                   	push   %ebx
+f010a68c:	68 2b ef 10 f0       	push   $0xf010ef2b
+f010a691:	e8 71 b6 ff ff       	call   f0105d07 <cprintf>
+f010a696:	83 c4 10             	add    $0x10,%esp
+f010a699:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a69e:	eb e0                	jmp    f010a680 <readline+0x41>
+f010a6a0:	85 ff                	test   %edi,%edi
+f010a6a2:	75 05                	jne    f010a6a9 <readline+0x6a>
+f010a6a4:	83 ee 01             	sub    $0x1,%esi
+f010a6a7:	eb 18                	jmp    f010a6c1 <readline+0x82>
+f010a6a9:	83 ec 0c             	sub    $0xc,%esp
+f010a6ac:	6a 08                	push   $0x8
+f010a6ae:	e8 99 61 ff ff       	call   f010084c <cputchar>
+f010a6b3:	83 c4 10             	add    $0x10,%esp
+f010a6b6:	eb ec                	jmp    f010a6a4 <readline+0x65>
+f010a6b8:	88 9e e0 5f 2b f0    	mov    %bl,-0xfd4a020(%esi)
+f010a6be:	8d 76 01             	lea    0x1(%esi),%esi
+f010a6c1:	e8 96 61 ff ff       	call   f010085c <getchar>
+f010a6c6:	89 c3                	mov    %eax,%ebx
+f010a6c8:	85 c0                	test   %eax,%eax
+f010a6ca:	78 aa                	js     f010a676 <readline+0x37>
+f010a6cc:	83 f8 08             	cmp    $0x8,%eax
+f010a6cf:	0f 94 c0             	sete   %al
+f010a6d2:	83 fb 7f             	cmp    $0x7f,%ebx
+f010a6d5:	0f 94 c2             	sete   %dl
+f010a6d8:	08 d0                	or     %dl,%al
+f010a6da:	74 04                	je     f010a6e0 <readline+0xa1>
+f010a6dc:	85 f6                	test   %esi,%esi
+f010a6de:	7f c0                	jg     f010a6a0 <readline+0x61>
+f010a6e0:	83 fb 1f             	cmp    $0x1f,%ebx
+f010a6e3:	7e 1a                	jle    f010a6ff <readline+0xc0>
+f010a6e5:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f010a6eb:	7f 12                	jg     f010a6ff <readline+0xc0>
+f010a6ed:	85 ff                	test   %edi,%edi
+f010a6ef:	74 c7                	je     f010a6b8 <readline+0x79>
+f010a6f1:	83 ec 0c             	sub    $0xc,%esp
+f010a6f4:	53                   	push   %ebx
+f010a6f5:	e8 52 61 ff ff       	call   f010084c <cputchar>
+f010a6fa:	83 c4 10             	add    $0x10,%esp
+f010a6fd:	eb b9                	jmp    f010a6b8 <readline+0x79>
+f010a6ff:	83 fb 0a             	cmp    $0xa,%ebx
+f010a702:	74 05                	je     f010a709 <readline+0xca>
+f010a704:	83 fb 0d             	cmp    $0xd,%ebx
+f010a707:	75 b8                	jne    f010a6c1 <readline+0x82>
+f010a709:	85 ff                	test   %edi,%edi
+f010a70b:	75 11                	jne    f010a71e <readline+0xdf>
+f010a70d:	c6 86 e0 5f 2b f0 00 	movb   $0x0,-0xfd4a020(%esi)
+f010a714:	b8 e0 5f 2b f0       	mov    $0xf02b5fe0,%eax
+f010a719:	e9 62 ff ff ff       	jmp    f010a680 <readline+0x41>
+f010a71e:	83 ec 0c             	sub    $0xc,%esp
+f010a721:	6a 0a                	push   $0xa
+f010a723:	e8 24 61 ff ff       	call   f010084c <cputchar>
+f010a728:	83 c4 10             	add    $0x10,%esp
+f010a72b:	eb e0                	jmp    f010a70d <readline+0xce>
+
+f010a72d <strlen>:
+f010a72d:	55                   	push   %ebp
+f010a72e:	89 e5                	mov    %esp,%ebp
+f010a730:	8b 55 08             	mov    0x8(%ebp),%edx
+f010a733:	80 3a 00             	cmpb   $0x0,(%edx)
+f010a736:	74 10                	je     f010a748 <strlen+0x1b>
+f010a738:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a73d:	83 c0 01             	add    $0x1,%eax
+f010a740:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f010a744:	75 f7                	jne    f010a73d <strlen+0x10>
+f010a746:	5d                   	pop    %ebp
+f010a747:	c3                   	ret
+f010a748:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a74d:	eb f7                	jmp    f010a746 <strlen+0x19>
+
+f010a74f <strnlen>:
+f010a74f:	55                   	push   %ebp
+f010a750:	89 e5                	mov    %esp,%ebp
+f010a752:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010a755:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a758:	85 d2                	test   %edx,%edx
+f010a75a:	74 16                	je     f010a772 <strnlen+0x23>
+f010a75c:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a761:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f010a765:	74 09                	je     f010a770 <strnlen+0x21>
+f010a767:	83 c0 01             	add    $0x1,%eax
+f010a76a:	39 d0                	cmp    %edx,%eax
+f010a76c:	75 f3                	jne    f010a761 <strnlen+0x12>
+f010a76e:	89 d0                	mov    %edx,%eax
+f010a770:	5d                   	pop    %ebp
+f010a771:	c3                   	ret
+f010a772:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a777:	eb f7                	jmp    f010a770 <strnlen+0x21>
+
+f010a779 <strcpy>:
+f010a779:	55                   	push   %ebp
+f010a77a:	89 e5                	mov    %esp,%ebp
+f010a77c:	53                   	push   %ebx
+f010a77d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010a780:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010a783:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a788:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f010a78c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f010a78f:	83 c0 01             	add    $0x1,%eax
+f010a792:	84 d2                	test   %dl,%dl
+f010a794:	75 f2                	jne    f010a788 <strcpy+0xf>
+f010a796:	89 c8                	mov    %ecx,%eax
+f010a798:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a79b:	c9                   	leave
+f010a79c:	c3                   	ret
+
+f010a79d <strcat>:
+f010a79d:	55                   	push   %ebp
+f010a79e:	89 e5                	mov    %esp,%ebp
+f010a7a0:	53                   	push   %ebx
+f010a7a1:	83 ec 10             	sub    $0x10,%esp
+f010a7a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010a7a7:	53                   	push   %ebx
+f010a7a8:	e8 80 ff ff ff       	call   f010a72d <strlen>
+f010a7ad:	83 c4 08             	add    $0x8,%esp
+f010a7b0:	ff 75 0c             	push   0xc(%ebp)
+f010a7b3:	01 d8                	add    %ebx,%eax
+f010a7b5:	50                   	push   %eax
+f010a7b6:	e8 be ff ff ff       	call   f010a779 <strcpy>
+f010a7bb:	89 d8                	mov    %ebx,%eax
+f010a7bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a7c0:	c9                   	leave
+f010a7c1:	c3                   	ret
+
+f010a7c2 <strncpy>:
+f010a7c2:	55                   	push   %ebp
+f010a7c3:	89 e5                	mov    %esp,%ebp
+f010a7c5:	56                   	push   %esi
+f010a7c6:	53                   	push   %ebx
+f010a7c7:	8b 75 08             	mov    0x8(%ebp),%esi
+f010a7ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a7cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f010a7d0:	85 db                	test   %ebx,%ebx
+f010a7d2:	74 17                	je     f010a7eb <strncpy+0x29>
+f010a7d4:	01 f3                	add    %esi,%ebx
+f010a7d6:	89 f0                	mov    %esi,%eax
+f010a7d8:	83 c0 01             	add    $0x1,%eax
+f010a7db:	0f b6 0a             	movzbl (%edx),%ecx
+f010a7de:	88 48 ff             	mov    %cl,-0x1(%eax)
+f010a7e1:	80 f9 01             	cmp    $0x1,%cl
+f010a7e4:	83 da ff             	sbb    $0xffffffff,%edx
+f010a7e7:	39 c3                	cmp    %eax,%ebx
+f010a7e9:	75 ed                	jne    f010a7d8 <strncpy+0x16>
+f010a7eb:	89 f0                	mov    %esi,%eax
+f010a7ed:	5b                   	pop    %ebx
+f010a7ee:	5e                   	pop    %esi
+f010a7ef:	5d                   	pop    %ebp
+f010a7f0:	c3                   	ret
+
+f010a7f1 <strlcpy>:
+f010a7f1:	55                   	push   %ebp
+f010a7f2:	89 e5                	mov    %esp,%ebp
+f010a7f4:	56                   	push   %esi
+f010a7f5:	53                   	push   %ebx
+f010a7f6:	8b 75 08             	mov    0x8(%ebp),%esi
+f010a7f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a7fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f010a7ff:	89 f0                	mov    %esi,%eax
+f010a801:	85 db                	test   %ebx,%ebx
+f010a803:	74 1e                	je     f010a823 <strlcpy+0x32>
+f010a805:	83 eb 01             	sub    $0x1,%ebx
+f010a808:	74 16                	je     f010a820 <strlcpy+0x2f>
+f010a80a:	01 f3                	add    %esi,%ebx
+f010a80c:	0f b6 0a             	movzbl (%edx),%ecx
+f010a80f:	84 c9                	test   %cl,%cl
+f010a811:	74 0d                	je     f010a820 <strlcpy+0x2f>
+f010a813:	83 c2 01             	add    $0x1,%edx
+f010a816:	83 c0 01             	add    $0x1,%eax
+f010a819:	88 48 ff             	mov    %cl,-0x1(%eax)
+f010a81c:	39 d8                	cmp    %ebx,%eax
+f010a81e:	75 ec                	jne    f010a80c <strlcpy+0x1b>
+f010a820:	c6 00 00             	movb   $0x0,(%eax)
+f010a823:	29 f0                	sub    %esi,%eax
+f010a825:	5b                   	pop    %ebx
+f010a826:	5e                   	pop    %esi
+f010a827:	5d                   	pop    %ebp
+f010a828:	c3                   	ret
+
+f010a829 <strcmp>:
+f010a829:	55                   	push   %ebp
+f010a82a:	89 e5                	mov    %esp,%ebp
+f010a82c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010a82f:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a832:	0f b6 01             	movzbl (%ecx),%eax
+f010a835:	84 c0                	test   %al,%al
+f010a837:	74 11                	je     f010a84a <strcmp+0x21>
+f010a839:	38 02                	cmp    %al,(%edx)
+f010a83b:	75 0d                	jne    f010a84a <strcmp+0x21>
+f010a83d:	83 c1 01             	add    $0x1,%ecx
+f010a840:	83 c2 01             	add    $0x1,%edx
+f010a843:	0f b6 01             	movzbl (%ecx),%eax
+f010a846:	84 c0                	test   %al,%al
+f010a848:	75 ef                	jne    f010a839 <strcmp+0x10>
+f010a84a:	0f b6 c0             	movzbl %al,%eax
+f010a84d:	0f b6 12             	movzbl (%edx),%edx
+f010a850:	29 d0                	sub    %edx,%eax
+f010a852:	5d                   	pop    %ebp
+f010a853:	c3                   	ret
+
+f010a854 <strncmp>:
+f010a854:	55                   	push   %ebp
+f010a855:	89 e5                	mov    %esp,%ebp
+f010a857:	53                   	push   %ebx
+f010a858:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010a85b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010a85e:	8b 55 10             	mov    0x10(%ebp),%edx
+f010a861:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a866:	85 d2                	test   %edx,%edx
+f010a868:	74 2e                	je     f010a898 <strncmp+0x44>
+f010a86a:	0f b6 01             	movzbl (%ecx),%eax
+f010a86d:	84 c0                	test   %al,%al
+f010a86f:	74 16                	je     f010a887 <strncmp+0x33>
+f010a871:	3a 03                	cmp    (%ebx),%al
+f010a873:	75 12                	jne    f010a887 <strncmp+0x33>
+f010a875:	83 c1 01             	add    $0x1,%ecx
+f010a878:	83 c3 01             	add    $0x1,%ebx
+f010a87b:	83 ea 01             	sub    $0x1,%edx
+f010a87e:	75 ea                	jne    f010a86a <strncmp+0x16>
+f010a880:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a885:	eb 11                	jmp    f010a898 <strncmp+0x44>
+f010a887:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a88c:	85 d2                	test   %edx,%edx
+f010a88e:	74 08                	je     f010a898 <strncmp+0x44>
+f010a890:	0f b6 01             	movzbl (%ecx),%eax
+f010a893:	0f b6 13             	movzbl (%ebx),%edx
+f010a896:	29 d0                	sub    %edx,%eax
+f010a898:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a89b:	c9                   	leave
+f010a89c:	c3                   	ret
+
+f010a89d <strchr>:
+f010a89d:	55                   	push   %ebp
+f010a89e:	89 e5                	mov    %esp,%ebp
+f010a8a0:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a8a3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+f010a8a7:	0f b6 10             	movzbl (%eax),%edx
+f010a8aa:	84 d2                	test   %dl,%dl
+f010a8ac:	74 15                	je     f010a8c3 <strchr+0x26>
+f010a8ae:	38 d1                	cmp    %dl,%cl
+f010a8b0:	74 0f                	je     f010a8c1 <strchr+0x24>
+f010a8b2:	83 c0 01             	add    $0x1,%eax
+f010a8b5:	0f b6 10             	movzbl (%eax),%edx
+f010a8b8:	84 d2                	test   %dl,%dl
+f010a8ba:	75 f2                	jne    f010a8ae <strchr+0x11>
+f010a8bc:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a8c1:	5d                   	pop    %ebp
+f010a8c2:	c3                   	ret
+f010a8c3:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a8c8:	eb f7                	jmp    f010a8c1 <strchr+0x24>
+
+f010a8ca <strfind>:
+f010a8ca:	55                   	push   %ebp
+f010a8cb:	89 e5                	mov    %esp,%ebp
+f010a8cd:	53                   	push   %ebx
+f010a8ce:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a8d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a8d4:	0f b6 18             	movzbl (%eax),%ebx
+f010a8d7:	38 d3                	cmp    %dl,%bl
+f010a8d9:	74 14                	je     f010a8ef <strfind+0x25>
+f010a8db:	89 d1                	mov    %edx,%ecx
+f010a8dd:	84 db                	test   %bl,%bl
+f010a8df:	74 0e                	je     f010a8ef <strfind+0x25>
+f010a8e1:	83 c0 01             	add    $0x1,%eax
+f010a8e4:	0f b6 10             	movzbl (%eax),%edx
+f010a8e7:	38 ca                	cmp    %cl,%dl
+f010a8e9:	74 04                	je     f010a8ef <strfind+0x25>
+f010a8eb:	84 d2                	test   %dl,%dl
+f010a8ed:	75 f2                	jne    f010a8e1 <strfind+0x17>
+f010a8ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a8f2:	c9                   	leave
+f010a8f3:	c3                   	ret
+
+f010a8f4 <memset>:
+f010a8f4:	55                   	push   %ebp
+f010a8f5:	89 e5                	mov    %esp,%ebp
+f010a8f7:	57                   	push   %edi
+f010a8f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010a8fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010a8fe:	85 c9                	test   %ecx,%ecx
+f010a900:	74 20                	je     f010a922 <memset+0x2e>
+f010a902:	89 f8                	mov    %edi,%eax
+f010a904:	09 c8                	or     %ecx,%eax
+f010a906:	a8 03                	test   $0x3,%al
+f010a908:	75 12                	jne    f010a91c <memset+0x28>
+f010a90a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f010a90e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+f010a914:	c1 e9 02             	shr    $0x2,%ecx
+f010a917:	fc                   	cld
+f010a918:	f3 ab                	rep stos %eax,%es:(%edi)
+f010a91a:	eb 06                	jmp    f010a922 <memset+0x2e>
+f010a91c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010a91f:	fc                   	cld
+f010a920:	f3 aa                	rep stos %al,%es:(%edi)
+f010a922:	89 f8                	mov    %edi,%eax
+f010a924:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f010a927:	c9                   	leave
+f010a928:	c3                   	ret
+
+f010a929 <memmove>:
+f010a929:	55                   	push   %ebp
+f010a92a:	89 e5                	mov    %esp,%ebp
+f010a92c:	57                   	push   %edi
+f010a92d:	56                   	push   %esi
+f010a92e:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a931:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010a934:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010a937:	39 c6                	cmp    %eax,%esi
+f010a939:	73 32                	jae    f010a96d <memmove+0x44>
+f010a93b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f010a93e:	39 d0                	cmp    %edx,%eax
+f010a940:	73 2b                	jae    f010a96d <memmove+0x44>
+f010a942:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+f010a945:	89 d6                	mov    %edx,%esi
+f010a947:	09 fe                	or     %edi,%esi
+f010a949:	09 ce                	or     %ecx,%esi
+f010a94b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f010a951:	75 0e                	jne    f010a961 <memmove+0x38>
+f010a953:	83 ef 04             	sub    $0x4,%edi
+f010a956:	8d 72 fc             	lea    -0x4(%edx),%esi
+f010a959:	c1 e9 02             	shr    $0x2,%ecx
+f010a95c:	fd                   	std
+f010a95d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010a95f:	eb 09                	jmp    f010a96a <memmove+0x41>
+f010a961:	83 ef 01             	sub    $0x1,%edi
+f010a964:	8d 72 ff             	lea    -0x1(%edx),%esi
+f010a967:	fd                   	std
+f010a968:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f010a96a:	fc                   	cld
+f010a96b:	eb 1a                	jmp    f010a987 <memmove+0x5e>
+f010a96d:	89 f2                	mov    %esi,%edx
+f010a96f:	09 c2                	or     %eax,%edx
+f010a971:	09 ca                	or     %ecx,%edx
+f010a973:	f6 c2 03             	test   $0x3,%dl
+f010a976:	75 0a                	jne    f010a982 <memmove+0x59>
+f010a978:	c1 e9 02             	shr    $0x2,%ecx
+f010a97b:	89 c7                	mov    %eax,%edi
+f010a97d:	fc                   	cld
+f010a97e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010a980:	eb 05                	jmp    f010a987 <memmove+0x5e>
+f010a982:	89 c7                	mov    %eax,%edi
+f010a984:	fc                   	cld
+f010a985:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f010a987:	5e                   	pop    %esi
+f010a988:	5f                   	pop    %edi
+f010a989:	5d                   	pop    %ebp
+f010a98a:	c3                   	ret
+
+f010a98b <memcpy>:
+f010a98b:	55                   	push   %ebp
+f010a98c:	89 e5                	mov    %esp,%ebp
+f010a98e:	83 ec 0c             	sub    $0xc,%esp
+f010a991:	ff 75 10             	push   0x10(%ebp)
+f010a994:	ff 75 0c             	push   0xc(%ebp)
+f010a997:	ff 75 08             	push   0x8(%ebp)
+f010a99a:	e8 8a ff ff ff       	call   f010a929 <memmove>
+f010a99f:	c9                   	leave
+f010a9a0:	c3                   	ret
+
+f010a9a1 <memcmp>:
+f010a9a1:	55                   	push   %ebp
+f010a9a2:	89 e5                	mov    %esp,%ebp
+f010a9a4:	56                   	push   %esi
+f010a9a5:	53                   	push   %ebx
+f010a9a6:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a9a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010a9ac:	8b 75 10             	mov    0x10(%ebp),%esi
+f010a9af:	85 f6                	test   %esi,%esi
+f010a9b1:	74 29                	je     f010a9dc <memcmp+0x3b>
+f010a9b3:	01 c6                	add    %eax,%esi
+f010a9b5:	0f b6 08             	movzbl (%eax),%ecx
+f010a9b8:	0f b6 1a             	movzbl (%edx),%ebx
+f010a9bb:	38 d9                	cmp    %bl,%cl
+f010a9bd:	75 11                	jne    f010a9d0 <memcmp+0x2f>
+f010a9bf:	83 c0 01             	add    $0x1,%eax
+f010a9c2:	83 c2 01             	add    $0x1,%edx
+f010a9c5:	39 c6                	cmp    %eax,%esi
+f010a9c7:	75 ec                	jne    f010a9b5 <memcmp+0x14>
+f010a9c9:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a9ce:	eb 08                	jmp    f010a9d8 <memcmp+0x37>
+f010a9d0:	0f b6 c1             	movzbl %cl,%eax
+f010a9d3:	0f b6 db             	movzbl %bl,%ebx
+f010a9d6:	29 d8                	sub    %ebx,%eax
+f010a9d8:	5b                   	pop    %ebx
+f010a9d9:	5e                   	pop    %esi
+f010a9da:	5d                   	pop    %ebp
+f010a9db:	c3                   	ret
+f010a9dc:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a9e1:	eb f5                	jmp    f010a9d8 <memcmp+0x37>
+
+f010a9e3 <memfind>:
+f010a9e3:	55                   	push   %ebp
+f010a9e4:	89 e5                	mov    %esp,%ebp
+f010a9e6:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a9e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010a9ec:	89 c2                	mov    %eax,%edx
+f010a9ee:	03 55 10             	add    0x10(%ebp),%edx
+f010a9f1:	39 d0                	cmp    %edx,%eax
+f010a9f3:	73 0d                	jae    f010aa02 <memfind+0x1f>
+f010a9f5:	38 08                	cmp    %cl,(%eax)
+f010a9f7:	74 0d                	je     f010aa06 <memfind+0x23>
+f010a9f9:	83 c0 01             	add    $0x1,%eax
+f010a9fc:	39 c2                	cmp    %eax,%edx
+f010a9fe:	75 f5                	jne    f010a9f5 <memfind+0x12>
+f010aa00:	eb 06                	jmp    f010aa08 <memfind+0x25>
+f010aa02:	89 c2                	mov    %eax,%edx
+f010aa04:	eb 02                	jmp    f010aa08 <memfind+0x25>
+f010aa06:	89 c2                	mov    %eax,%edx
+f010aa08:	89 d0                	mov    %edx,%eax
+f010aa0a:	5d                   	pop    %ebp
+f010aa0b:	c3                   	ret
+
+f010aa0c <strtol>:
+f010aa0c:	55                   	push   %ebp
+f010aa0d:	89 e5                	mov    %esp,%ebp
+f010aa0f:	57                   	push   %edi
+f010aa10:	56                   	push   %esi
+f010aa11:	53                   	push   %ebx
+f010aa12:	8b 55 08             	mov    0x8(%ebp),%edx
+f010aa15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f010aa18:	0f b6 02             	movzbl (%edx),%eax
+f010aa1b:	3c 20                	cmp    $0x20,%al
+f010aa1d:	74 04                	je     f010aa23 <strtol+0x17>
+f010aa1f:	3c 09                	cmp    $0x9,%al
+f010aa21:	75 0e                	jne    f010aa31 <strtol+0x25>
+f010aa23:	83 c2 01             	add    $0x1,%edx
+f010aa26:	0f b6 02             	movzbl (%edx),%eax
+f010aa29:	3c 20                	cmp    $0x20,%al
+f010aa2b:	74 f6                	je     f010aa23 <strtol+0x17>
+f010aa2d:	3c 09                	cmp    $0x9,%al
+f010aa2f:	74 f2                	je     f010aa23 <strtol+0x17>
+f010aa31:	3c 2b                	cmp    $0x2b,%al
+f010aa33:	74 2a                	je     f010aa5f <strtol+0x53>
+f010aa35:	bf 00 00 00 00       	mov    $0x0,%edi
+f010aa3a:	3c 2d                	cmp    $0x2d,%al
+f010aa3c:	74 2b                	je     f010aa69 <strtol+0x5d>
+f010aa3e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f010aa44:	75 0f                	jne    f010aa55 <strtol+0x49>
+f010aa46:	80 3a 30             	cmpb   $0x30,(%edx)
+f010aa49:	74 28                	je     f010aa73 <strtol+0x67>
+f010aa4b:	85 db                	test   %ebx,%ebx
+f010aa4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+f010aa52:	0f 44 d8             	cmove  %eax,%ebx
+f010aa55:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010aa5a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f010aa5d:	eb 46                	jmp    f010aaa5 <strtol+0x99>
+f010aa5f:	83 c2 01             	add    $0x1,%edx
+f010aa62:	bf 00 00 00 00       	mov    $0x0,%edi
+f010aa67:	eb d5                	jmp    f010aa3e <strtol+0x32>
+f010aa69:	83 c2 01             	add    $0x1,%edx
+f010aa6c:	bf 01 00 00 00       	mov    $0x1,%edi
+f010aa71:	eb cb                	jmp    f010aa3e <strtol+0x32>
+f010aa73:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f010aa77:	74 0e                	je     f010aa87 <strtol+0x7b>
+f010aa79:	85 db                	test   %ebx,%ebx
+f010aa7b:	75 d8                	jne    f010aa55 <strtol+0x49>
+f010aa7d:	83 c2 01             	add    $0x1,%edx
+f010aa80:	bb 08 00 00 00       	mov    $0x8,%ebx
+f010aa85:	eb ce                	jmp    f010aa55 <strtol+0x49>
+f010aa87:	83 c2 02             	add    $0x2,%edx
+f010aa8a:	bb 10 00 00 00       	mov    $0x10,%ebx
+f010aa8f:	eb c4                	jmp    f010aa55 <strtol+0x49>
+f010aa91:	0f be c0             	movsbl %al,%eax
+f010aa94:	83 e8 30             	sub    $0x30,%eax
+f010aa97:	3b 45 10             	cmp    0x10(%ebp),%eax
+f010aa9a:	7d 3a                	jge    f010aad6 <strtol+0xca>
+f010aa9c:	83 c2 01             	add    $0x1,%edx
+f010aa9f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f010aaa3:	01 c1                	add    %eax,%ecx
+f010aaa5:	0f b6 02             	movzbl (%edx),%eax
+f010aaa8:	8d 70 d0             	lea    -0x30(%eax),%esi
+f010aaab:	89 f3                	mov    %esi,%ebx
+f010aaad:	80 fb 09             	cmp    $0x9,%bl
+f010aab0:	76 df                	jbe    f010aa91 <strtol+0x85>
+f010aab2:	8d 70 9f             	lea    -0x61(%eax),%esi
+f010aab5:	89 f3                	mov    %esi,%ebx
+f010aab7:	80 fb 19             	cmp    $0x19,%bl
+f010aaba:	77 08                	ja     f010aac4 <strtol+0xb8>
+f010aabc:	0f be c0             	movsbl %al,%eax
+f010aabf:	83 e8 57             	sub    $0x57,%eax
+f010aac2:	eb d3                	jmp    f010aa97 <strtol+0x8b>
+f010aac4:	8d 70 bf             	lea    -0x41(%eax),%esi
+f010aac7:	89 f3                	mov    %esi,%ebx
+f010aac9:	80 fb 19             	cmp    $0x19,%bl
+f010aacc:	77 08                	ja     f010aad6 <strtol+0xca>
+f010aace:	0f be c0             	movsbl %al,%eax
+f010aad1:	83 e8 37             	sub    $0x37,%eax
+f010aad4:	eb c1                	jmp    f010aa97 <strtol+0x8b>
+f010aad6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f010aada:	74 05                	je     f010aae1 <strtol+0xd5>
+f010aadc:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010aadf:	89 10                	mov    %edx,(%eax)
+f010aae1:	89 c8                	mov    %ecx,%eax
+f010aae3:	f7 d8                	neg    %eax
+f010aae5:	85 ff                	test   %edi,%edi
+f010aae7:	0f 45 c8             	cmovne %eax,%ecx
+f010aaea:	89 c8                	mov    %ecx,%eax
+f010aaec:	5b                   	pop    %ebx
+f010aaed:	5e                   	pop    %esi
+f010aaee:	5f                   	pop    %edi
+f010aaef:	5d                   	pop    %ebp
+f010aaf0:	c3                   	ret
+f010aaf1:	66 90                	xchg   %ax,%ax
+f010aaf3:	90                   	nop
+
+f010aaf4 <mpentry_start>:
+f010aaf4:	fa                   	cli
+f010aaf5:	31 c0                	xor    %eax,%eax
+f010aaf7:	8e d8                	mov    %eax,%ds
+f010aaf9:	8e c0                	mov    %eax,%es
+f010aafb:	8e d0                	mov    %eax,%ss
+f010aafd:	0f 01 16             	lgdtl  (%esi)
+f010ab00:	74 70                	je     f010ab72 <mpsearch1+0x3>
+f010ab02:	0f 20 c0             	mov    %cr0,%eax
+f010ab05:	66 83 c8 01          	or     $0x1,%ax
+f010ab09:	0f 22 c0             	mov    %eax,%cr0
+f010ab0c:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f010ab12:	08 00                	or     %al,(%eax)
+
+f010ab14 <start32>:
+f010ab14:	66 b8 10 00          	mov    $0x10,%ax
+f010ab18:	8e d8                	mov    %eax,%ds
+f010ab1a:	8e c0                	mov    %eax,%es
+f010ab1c:	8e d0                	mov    %eax,%ss
+f010ab1e:	66 b8 00 00          	mov    $0x0,%ax
+f010ab22:	8e e0                	mov    %eax,%fs
+f010ab24:	8e e8                	mov    %eax,%gs
+f010ab26:	b8 00 80 11 00       	mov    $0x118000,%eax
+f010ab2b:	0f 22 d8             	mov    %eax,%cr3
+f010ab2e:	0f 20 c0             	mov    %cr0,%eax
+f010ab31:	0d 01 00 01 80       	or     $0x80010001,%eax
+f010ab36:	0f 22 c0             	mov    %eax,%cr0
+f010ab39:	8b 25 64 1a 2d f0    	mov    0xf02d1a64,%esp
+f010ab3f:	bd 00 00 00 00       	mov    $0x0,%ebp
+f010ab44:	b8 73 02 10 f0       	mov    $0xf0100273,%eax
+f010ab49:	ff d0                	call   *%eax
+
+f010ab4b <spin>:
+f010ab4b:	eb fe                	jmp    f010ab4b <spin>
+f010ab4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+f010ab50 <gdt>:
+	...
+f010ab58:	ff                   	(bad)
+f010ab59:	ff 00                	incl   (%eax)
+f010ab5b:	00 00                	add    %al,(%eax)
+f010ab5d:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f010ab64:	00                   	.byte 0x0
+f010ab65:	92                   	xchg   %eax,%edx
+f010ab66:	cf                   	iret
+	...
+
+f010ab68 <gdtdesc>:
+f010ab68:	17                   	pop    %ss
+f010ab69:	00 5c 70 00          	add    %bl,0x0(%eax,%esi,2)
+	...
+
+f010ab6e <mpentry_end>:
+f010ab6e:	90                   	nop
+
+f010ab6f <mpsearch1>:
+f010ab6f:	55                   	push   %ebp
+f010ab70:	89 e5                	mov    %esp,%ebp
+f010ab72:	57                   	push   %edi
+f010ab73:	56                   	push   %esi
+f010ab74:	53                   	push   %ebx
+f010ab75:	83 ec 0c             	sub    $0xc,%esp
+f010ab78:	89 c3                	mov    %eax,%ebx
+f010ab7a:	89 d7                	mov    %edx,%edi
+f010ab7c:	a1 68 1a 2d f0       	mov    0xf02d1a68,%eax
+f010ab81:	89 da                	mov    %ebx,%edx
+f010ab83:	c1 ea 0c             	shr    $0xc,%edx
+f010ab86:	39 c2                	cmp    %eax,%edx
+f010ab88:	73 23                	jae    f010abad <mpsearch1+0x3e>
+f010ab8a:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+f010ab90:	01 df                	add    %ebx,%edi
+f010ab92:	89 fa                	mov    %edi,%edx
+f010ab94:	c1 ea 0c             	shr    $0xc,%edx
+f010ab97:	39 c2                	cmp    %eax,%edx
+f010ab99:	73 24                	jae    f010abbf <mpsearch1+0x50>
+f010ab9b:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+f010aba1:	39 fe                	cmp    %edi,%esi
+f010aba3:	73 70                	jae    f010ac15 <mpsearch1+0xa6>
+f010aba5:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f010abab:	eb 32                	jmp    f010abdf <mpsearch1+0x70>
+f010abad:	53                   	push   %ebx
+f010abae:	68 24 d0 10 f0       	push   $0xf010d024
+f010abb3:	6a 57                	push   $0x57
+f010abb5:	68 c9 f0 10 f0       	push   $0xf010f0c9
+f010abba:	e8 81 54 ff ff       	call   f0100040 <_panic>
+f010abbf:	57                   	push   %edi
+f010abc0:	68 24 d0 10 f0       	push   $0xf010d024
+f010abc5:	6a 57                	push   $0x57
+f010abc7:	68 c9 f0 10 f0       	push   $0xf010f0c9
+f010abcc:	e8 6f 54 ff ff       	call   f0100040 <_panic>
+f010abd1:	84 c0                	test   %al,%al
+f010abd3:	74 36                	je     f010ac0b <mpsearch1+0x9c>
+f010abd5:	83 c6 10             	add    $0x10,%esi
+f010abd8:	83 c3 10             	add    $0x10,%ebx
+f010abdb:	39 fe                	cmp    %edi,%esi
+f010abdd:	73 27                	jae    f010ac06 <mpsearch1+0x97>
+f010abdf:	83 ec 04             	sub    $0x4,%esp
+f010abe2:	6a 04                	push   $0x4
+f010abe4:	68 d9 f0 10 f0       	push   $0xf010f0d9
+f010abe9:	56                   	push   %esi
+f010abea:	e8 b2 fd ff ff       	call   f010a9a1 <memcmp>
+f010abef:	83 c4 10             	add    $0x10,%esp
+f010abf2:	85 c0                	test   %eax,%eax
+f010abf4:	75 df                	jne    f010abd5 <mpsearch1+0x66>
+f010abf6:	89 f2                	mov    %esi,%edx
+f010abf8:	0f b6 0a             	movzbl (%edx),%ecx
+f010abfb:	01 c8                	add    %ecx,%eax
+f010abfd:	83 c2 01             	add    $0x1,%edx
+f010ac00:	39 da                	cmp    %ebx,%edx
+f010ac02:	75 f4                	jne    f010abf8 <mpsearch1+0x89>
+f010ac04:	eb cb                	jmp    f010abd1 <mpsearch1+0x62>
+f010ac06:	be 00 00 00 00       	mov    $0x0,%esi
+f010ac0b:	89 f0                	mov    %esi,%eax
+f010ac0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010ac10:	5b                   	pop    %ebx
+f010ac11:	5e                   	pop    %esi
+f010ac12:	5f                   	pop    %edi
+f010ac13:	5d                   	pop    %ebp
+f010ac14:	c3                   	ret
+f010ac15:	be 00 00 00 00       	mov    $0x0,%esi
+f010ac1a:	eb ef                	jmp    f010ac0b <mpsearch1+0x9c>
+
+f010ac1c <mp_init>:
+f010ac1c:	55                   	push   %ebp
+f010ac1d:	89 e5                	mov    %esp,%ebp
+f010ac1f:	57                   	push   %edi
+f010ac20:	56                   	push   %esi
+f010ac21:	53                   	push   %ebx
+f010ac22:	83 ec 1c             	sub    $0x1c,%esp
+f010ac25:	c7 05 c0 24 2d f0 20 	movl   $0xf02d2020,0xf02d24c0
+f010ac2c:	20 2d f0 
+f010ac2f:	83 3d 68 1a 2d f0 00 	cmpl   $0x0,0xf02d1a68
+f010ac36:	0f 84 5a 01 00 00    	je     f010ad96 <mp_init+0x17a>
+f010ac3c:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f010ac43:	85 c0                	test   %eax,%eax
+f010ac45:	0f 84 61 01 00 00    	je     f010adac <mp_init+0x190>
+f010ac4b:	c1 e0 04             	shl    $0x4,%eax
+f010ac4e:	ba 00 04 00 00       	mov    $0x400,%edx
+f010ac53:	e8 17 ff ff ff       	call   f010ab6f <mpsearch1>
+f010ac58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010ac5b:	85 c0                	test   %eax,%eax
+f010ac5d:	75 1a                	jne    f010ac79 <mp_init+0x5d>
+f010ac5f:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010ac64:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f010ac69:	e8 01 ff ff ff       	call   f010ab6f <mpsearch1>
+f010ac6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010ac71:	85 c0                	test   %eax,%eax
+f010ac73:	0f 84 15 01 00 00    	je     f010ad8e <mp_init+0x172>
+f010ac79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010ac7c:	8b 78 04             	mov    0x4(%eax),%edi
+f010ac7f:	85 ff                	test   %edi,%edi
+f010ac81:	0f 84 4e 01 00 00    	je     f010add5 <mp_init+0x1b9>
+f010ac87:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f010ac8b:	0f 85 44 01 00 00    	jne    f010add5 <mp_init+0x1b9>
+f010ac91:	89 f8                	mov    %edi,%eax
+f010ac93:	c1 e8 0c             	shr    $0xc,%eax
+f010ac96:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f010ac9c:	0f 83 45 01 00 00    	jae    f010ade7 <mp_init+0x1cb>
+f010aca2:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+f010aca8:	83 ec 04             	sub    $0x4,%esp
+f010acab:	6a 04                	push   $0x4
+f010acad:	68 de f0 10 f0       	push   $0xf010f0de
+f010acb2:	57                   	push   %edi
+f010acb3:	e8 e9 fc ff ff       	call   f010a9a1 <memcmp>
+f010acb8:	89 c2                	mov    %eax,%edx
+f010acba:	83 c4 10             	add    $0x10,%esp
+f010acbd:	85 c0                	test   %eax,%eax
+f010acbf:	0f 85 37 01 00 00    	jne    f010adfc <mp_init+0x1e0>
+f010acc5:	0f b7 5f 04          	movzwl 0x4(%edi),%ebx
+f010acc9:	66 85 db             	test   %bx,%bx
+f010accc:	74 23                	je     f010acf1 <mp_init+0xd5>
+f010acce:	0f b7 f3             	movzwl %bx,%esi
+f010acd1:	01 fe                	add    %edi,%esi
+f010acd3:	89 f8                	mov    %edi,%eax
+f010acd5:	89 d1                	mov    %edx,%ecx
+f010acd7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f010acda:	0f b6 10             	movzbl (%eax),%edx
+f010acdd:	01 d1                	add    %edx,%ecx
+f010acdf:	83 c0 01             	add    $0x1,%eax
+f010ace2:	39 f0                	cmp    %esi,%eax
+f010ace4:	75 f4                	jne    f010acda <mp_init+0xbe>
+f010ace6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f010ace9:	84 c9                	test   %cl,%cl
+f010aceb:	0f 85 1d 01 00 00    	jne    f010ae0e <mp_init+0x1f2>
+f010acf1:	0f b6 47 06          	movzbl 0x6(%edi),%eax
+f010acf5:	3c 01                	cmp    $0x1,%al
+f010acf7:	74 08                	je     f010ad01 <mp_init+0xe5>
+f010acf9:	3c 04                	cmp    $0x4,%al
+f010acfb:	0f 85 22 01 00 00    	jne    f010ae23 <mp_init+0x207>
+f010ad01:	0f b7 4f 28          	movzwl 0x28(%edi),%ecx
+f010ad05:	0f b7 db             	movzwl %bx,%ebx
+f010ad08:	66 85 c9             	test   %cx,%cx
+f010ad0b:	74 13                	je     f010ad20 <mp_init+0x104>
+f010ad0d:	01 fb                	add    %edi,%ebx
+f010ad0f:	0f b7 c9             	movzwl %cx,%ecx
+f010ad12:	01 d9                	add    %ebx,%ecx
+f010ad14:	0f b6 03             	movzbl (%ebx),%eax
+f010ad17:	01 c2                	add    %eax,%edx
+f010ad19:	83 c3 01             	add    $0x1,%ebx
+f010ad1c:	39 cb                	cmp    %ecx,%ebx
+f010ad1e:	75 f4                	jne    f010ad14 <mp_init+0xf8>
+f010ad20:	38 57 2a             	cmp    %dl,0x2a(%edi)
+f010ad23:	0f 85 13 01 00 00    	jne    f010ae3c <mp_init+0x220>
+f010ad29:	c7 05 00 20 2d f0 01 	movl   $0x1,0xf02d2000
+f010ad30:	00 00 00 
+f010ad33:	8b 47 24             	mov    0x24(%edi),%eax
+f010ad36:	a3 00 30 31 f0       	mov    %eax,0xf0313000
+f010ad3b:	8d 77 2c             	lea    0x2c(%edi),%esi
+f010ad3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010ad43:	66 83 7f 22 00       	cmpw   $0x0,0x22(%edi)
+f010ad48:	0f 85 4d 01 00 00    	jne    f010ae9b <mp_init+0x27f>
+f010ad4e:	a1 c0 24 2d f0       	mov    0xf02d24c0,%eax
+f010ad53:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+f010ad5a:	83 3d 00 20 2d f0 00 	cmpl   $0x0,0xf02d2000
+f010ad61:	0f 84 83 01 00 00    	je     f010aeea <mp_init+0x2ce>
+f010ad67:	83 ec 04             	sub    $0x4,%esp
+f010ad6a:	ff 35 c4 24 2d f0    	push   0xf02d24c4
+f010ad70:	0f b6 00             	movzbl (%eax),%eax
+f010ad73:	50                   	push   %eax
+f010ad74:	68 e3 f0 10 f0       	push   $0xf010f0e3
+f010ad79:	e8 89 af ff ff       	call   f0105d07 <cprintf>
+f010ad7e:	83 c4 10             	add    $0x10,%esp
+f010ad81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010ad84:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f010ad88:	0f 85 85 01 00 00    	jne    f010af13 <mp_init+0x2f7>
+f010ad8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010ad91:	5b                   	pop    %ebx
+f010ad92:	5e                   	pop    %esi
+f010ad93:	5f                   	pop    %edi
+f010ad94:	5d                   	pop    %ebp
+f010ad95:	c3                   	ret
+f010ad96:	68 00 04 00 00       	push   $0x400
+f010ad9b:	68 24 d0 10 f0       	push   $0xf010d024
+f010ada0:	6a 6f                	push   $0x6f
+f010ada2:	68 c9 f0 10 f0       	push   $0xf010f0c9
+f010ada7:	e8 94 52 ff ff       	call   f0100040 <_panic>
+f010adac:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f010adb3:	c1 e0 0a             	shl    $0xa,%eax
+f010adb6:	2d 00 04 00 00       	sub    $0x400,%eax
+f010adbb:	ba 00 04 00 00       	mov    $0x400,%edx
+f010adc0:	e8 aa fd ff ff       	call   f010ab6f <mpsearch1>
+f010adc5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010adc8:	85 c0                	test   %eax,%eax
+f010adca:	0f 85 a9 fe ff ff    	jne    f010ac79 <mp_init+0x5d>
+f010add0:	e9 8a fe ff ff       	jmp    f010ac5f <mp_init+0x43>
+f010add5:	83 ec 0c             	sub    $0xc,%esp
+f010add8:	68 3c ef 10 f0       	push   $0xf010ef3c
+f010addd:	e8 25 af ff ff       	call   f0105d07 <cprintf>
+f010ade2:	83 c4 10             	add    $0x10,%esp
+f010ade5:	eb a7                	jmp    f010ad8e <mp_init+0x172>
+f010ade7:	57                   	push   %edi
+f010ade8:	68 24 d0 10 f0       	push   $0xf010d024
+f010aded:	68 90 00 00 00       	push   $0x90
+f010adf2:	68 c9 f0 10 f0       	push   $0xf010f0c9
+f010adf7:	e8 44 52 ff ff       	call   f0100040 <_panic>
+f010adfc:	83 ec 0c             	sub    $0xc,%esp
+f010adff:	68 6c ef 10 f0       	push   $0xf010ef6c
+f010ae04:	e8 fe ae ff ff       	call   f0105d07 <cprintf>
+f010ae09:	83 c4 10             	add    $0x10,%esp
+f010ae0c:	eb 80                	jmp    f010ad8e <mp_init+0x172>
+f010ae0e:	83 ec 0c             	sub    $0xc,%esp
+f010ae11:	68 a0 ef 10 f0       	push   $0xf010efa0
+f010ae16:	e8 ec ae ff ff       	call   f0105d07 <cprintf>
+f010ae1b:	83 c4 10             	add    $0x10,%esp
+f010ae1e:	e9 6b ff ff ff       	jmp    f010ad8e <mp_init+0x172>
+f010ae23:	83 ec 08             	sub    $0x8,%esp
+f010ae26:	0f b6 c0             	movzbl %al,%eax
+f010ae29:	50                   	push   %eax
+f010ae2a:	68 c4 ef 10 f0       	push   $0xf010efc4
+f010ae2f:	e8 d3 ae ff ff       	call   f0105d07 <cprintf>
+f010ae34:	83 c4 10             	add    $0x10,%esp
+f010ae37:	e9 52 ff ff ff       	jmp    f010ad8e <mp_init+0x172>
+f010ae3c:	83 ec 0c             	sub    $0xc,%esp
+f010ae3f:	68 e4 ef 10 f0       	push   $0xf010efe4
+f010ae44:	e8 be ae ff ff       	call   f0105d07 <cprintf>
+f010ae49:	83 c4 10             	add    $0x10,%esp
+f010ae4c:	e9 3d ff ff ff       	jmp    f010ad8e <mp_init+0x172>
+f010ae51:	f6 46 03 02          	testb  $0x2,0x3(%esi)
+f010ae55:	74 14                	je     f010ae6b <mp_init+0x24f>
+f010ae57:	69 05 c4 24 2d f0 94 	imul   $0x94,0xf02d24c4,%eax
+f010ae5e:	00 00 00 
+f010ae61:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010ae66:	a3 c0 24 2d f0       	mov    %eax,0xf02d24c0
+f010ae6b:	a1 c4 24 2d f0       	mov    0xf02d24c4,%eax
+f010ae70:	83 f8 07             	cmp    $0x7,%eax
+f010ae73:	7f 3a                	jg     f010aeaf <mp_init+0x293>
+f010ae75:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+f010ae7b:	88 82 20 20 2d f0    	mov    %al,-0xfd2dfe0(%edx)
+f010ae81:	83 c0 01             	add    $0x1,%eax
+f010ae84:	a3 c4 24 2d f0       	mov    %eax,0xf02d24c4
+f010ae89:	83 c6 14             	add    $0x14,%esi
+f010ae8c:	83 c3 01             	add    $0x1,%ebx
+f010ae8f:	0f b7 47 22          	movzwl 0x22(%edi),%eax
+f010ae93:	39 c3                	cmp    %eax,%ebx
+f010ae95:	0f 83 b3 fe ff ff    	jae    f010ad4e <mp_init+0x132>
+f010ae9b:	0f b6 06             	movzbl (%esi),%eax
+f010ae9e:	84 c0                	test   %al,%al
+f010aea0:	74 af                	je     f010ae51 <mp_init+0x235>
+f010aea2:	8d 50 ff             	lea    -0x1(%eax),%edx
+f010aea5:	80 fa 03             	cmp    $0x3,%dl
+f010aea8:	77 1c                	ja     f010aec6 <mp_init+0x2aa>
+f010aeaa:	83 c6 08             	add    $0x8,%esi
+f010aead:	eb dd                	jmp    f010ae8c <mp_init+0x270>
+f010aeaf:	83 ec 08             	sub    $0x8,%esp
+f010aeb2:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+f010aeb6:	50                   	push   %eax
+f010aeb7:	68 14 f0 10 f0       	push   $0xf010f014
+f010aebc:	e8 46 ae ff ff       	call   f0105d07 <cprintf>
+f010aec1:	83 c4 10             	add    $0x10,%esp
+f010aec4:	eb c3                	jmp    f010ae89 <mp_init+0x26d>
+f010aec6:	83 ec 08             	sub    $0x8,%esp
+f010aec9:	0f b6 c0             	movzbl %al,%eax
+f010aecc:	50                   	push   %eax
+f010aecd:	68 3c f0 10 f0       	push   $0xf010f03c
+f010aed2:	e8 30 ae ff ff       	call   f0105d07 <cprintf>
+f010aed7:	c7 05 00 20 2d f0 00 	movl   $0x0,0xf02d2000
+f010aede:	00 00 00 
+f010aee1:	0f b7 5f 22          	movzwl 0x22(%edi),%ebx
+f010aee5:	83 c4 10             	add    $0x10,%esp
+f010aee8:	eb a2                	jmp    f010ae8c <mp_init+0x270>
+f010aeea:	c7 05 c4 24 2d f0 01 	movl   $0x1,0xf02d24c4
+f010aef1:	00 00 00 
+f010aef4:	c7 05 00 30 31 f0 00 	movl   $0x0,0xf0313000
+f010aefb:	00 00 00 
+f010aefe:	83 ec 0c             	sub    $0xc,%esp
+f010af01:	68 5c f0 10 f0       	push   $0xf010f05c
+f010af06:	e8 fc ad ff ff       	call   f0105d07 <cprintf>
+f010af0b:	83 c4 10             	add    $0x10,%esp
+f010af0e:	e9 7b fe ff ff       	jmp    f010ad8e <mp_init+0x172>
+f010af13:	83 ec 0c             	sub    $0xc,%esp
+f010af16:	68 88 f0 10 f0       	push   $0xf010f088
+f010af1b:	e8 e7 ad ff ff       	call   f0105d07 <cprintf>
+f010af20:	b8 70 00 00 00       	mov    $0x70,%eax
+f010af25:	ba 22 00 00 00       	mov    $0x22,%edx
+f010af2a:	ee                   	out    %al,(%dx)
+f010af2b:	ba 23 00 00 00       	mov    $0x23,%edx
+f010af30:	ec                   	in     (%dx),%al
+f010af31:	83 c8 01             	or     $0x1,%eax
+f010af34:	ee                   	out    %al,(%dx)
+f010af35:	83 c4 10             	add    $0x10,%esp
+f010af38:	e9 51 fe ff ff       	jmp    f010ad8e <mp_init+0x172>
+
+f010af3d <lapicw>:
+f010af3d:	8b 0d 00 30 31 f0    	mov    0xf0313000,%ecx
+f010af43:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f010af46:	89 10                	mov    %edx,(%eax)
+f010af48:	a1 00 30 31 f0       	mov    0xf0313000,%eax
+f010af4d:	8b 40 20             	mov    0x20(%eax),%eax
+f010af50:	c3                   	ret
+
+f010af51 <cpunum>:
+f010af51:	8b 15 00 30 31 f0    	mov    0xf0313000,%edx
+f010af57:	b8 00 00 00 00       	mov    $0x0,%eax
+f010af5c:	85 d2                	test   %edx,%edx
+f010af5e:	74 06                	je     f010af66 <cpunum+0x15>
+f010af60:	8b 42 20             	mov    0x20(%edx),%eax
+f010af63:	c1 e8 18             	shr    $0x18,%eax
+f010af66:	c3                   	ret
+
+f010af67 <lapic_timer_start>:
+f010af67:	83 3d 00 30 31 f0 00 	cmpl   $0x0,0xf0313000
+f010af6e:	74 61                	je     f010afd1 <lapic_timer_start+0x6a>
+f010af70:	55                   	push   %ebp
+f010af71:	89 e5                	mov    %esp,%ebp
+f010af73:	83 ec 08             	sub    $0x8,%esp
+f010af76:	e8 d6 ff ff ff       	call   f010af51 <cpunum>
+f010af7b:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010af81:	83 b8 94 20 2d f0 00 	cmpl   $0x0,-0xfd2df6c(%eax)
+f010af88:	74 02                	je     f010af8c <lapic_timer_start+0x25>
+f010af8a:	c9                   	leave
+f010af8b:	c3                   	ret
+f010af8c:	ba 0b 00 00 00       	mov    $0xb,%edx
+f010af91:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f010af96:	e8 a2 ff ff ff       	call   f010af3d <lapicw>
+f010af9b:	ba 20 00 02 00       	mov    $0x20020,%edx
+f010afa0:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010afa5:	e8 93 ff ff ff       	call   f010af3d <lapicw>
+f010afaa:	8b 15 e0 63 2b f0    	mov    0xf02b63e0,%edx
+f010afb0:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f010afb5:	e8 83 ff ff ff       	call   f010af3d <lapicw>
+f010afba:	e8 92 ff ff ff       	call   f010af51 <cpunum>
+f010afbf:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010afc5:	c7 80 94 20 2d f0 01 	movl   $0x1,-0xfd2df6c(%eax)
+f010afcc:	00 00 00 
+f010afcf:	eb b9                	jmp    f010af8a <lapic_timer_start+0x23>
+f010afd1:	c3                   	ret
+
+f010afd2 <lapic_timer_stop>:
+f010afd2:	83 3d 00 30 31 f0 00 	cmpl   $0x0,0xf0313000
+f010afd9:	74 51                	je     f010b02c <lapic_timer_stop+0x5a>
+f010afdb:	55                   	push   %ebp
+f010afdc:	89 e5                	mov    %esp,%ebp
+f010afde:	83 ec 08             	sub    $0x8,%esp
+f010afe1:	e8 6b ff ff ff       	call   f010af51 <cpunum>
+f010afe6:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010afec:	83 b8 94 20 2d f0 00 	cmpl   $0x0,-0xfd2df6c(%eax)
+f010aff3:	75 02                	jne    f010aff7 <lapic_timer_stop+0x25>
+f010aff5:	c9                   	leave
+f010aff6:	c3                   	ret
+f010aff7:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010affc:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010b001:	e8 37 ff ff ff       	call   f010af3d <lapicw>
+f010b006:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b00b:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f010b010:	e8 28 ff ff ff       	call   f010af3d <lapicw>
+f010b015:	e8 37 ff ff ff       	call   f010af51 <cpunum>
+f010b01a:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010b020:	c7 80 94 20 2d f0 00 	movl   $0x0,-0xfd2df6c(%eax)
+f010b027:	00 00 00 
+f010b02a:	eb c9                	jmp    f010aff5 <lapic_timer_stop+0x23>
+f010b02c:	c3                   	ret
+
+f010b02d <lapic_init>:
+f010b02d:	83 3d 00 30 31 f0 00 	cmpl   $0x0,0xf0313000
+f010b034:	0f 84 91 01 00 00    	je     f010b1cb <lapic_init+0x19e>
+f010b03a:	55                   	push   %ebp
+f010b03b:	89 e5                	mov    %esp,%ebp
+f010b03d:	53                   	push   %ebx
+f010b03e:	83 ec 04             	sub    $0x4,%esp
+f010b041:	ba 27 01 00 00       	mov    $0x127,%edx
+f010b046:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f010b04b:	e8 ed fe ff ff       	call   f010af3d <lapicw>
+f010b050:	83 3d e0 63 2b f0 00 	cmpl   $0x0,0xf02b63e0
+f010b057:	0f 84 cd 00 00 00    	je     f010b12a <lapic_init+0xfd>
+f010b05d:	e8 05 ff ff ff       	call   f010af67 <lapic_timer_start>
+f010b062:	e8 ea fe ff ff       	call   f010af51 <cpunum>
+f010b067:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010b06d:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010b072:	39 05 c0 24 2d f0    	cmp    %eax,0xf02d24c0
+f010b078:	74 0f                	je     f010b089 <lapic_init+0x5c>
+f010b07a:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010b07f:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f010b084:	e8 b4 fe ff ff       	call   f010af3d <lapicw>
+f010b089:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010b08e:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f010b093:	e8 a5 fe ff ff       	call   f010af3d <lapicw>
+f010b098:	a1 00 30 31 f0       	mov    0xf0313000,%eax
+f010b09d:	8b 40 30             	mov    0x30(%eax),%eax
+f010b0a0:	c1 e8 10             	shr    $0x10,%eax
+f010b0a3:	a8 fc                	test   $0xfc,%al
+f010b0a5:	0f 85 0c 01 00 00    	jne    f010b1b7 <lapic_init+0x18a>
+f010b0ab:	ba 33 00 00 00       	mov    $0x33,%edx
+f010b0b0:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f010b0b5:	e8 83 fe ff ff       	call   f010af3d <lapicw>
+f010b0ba:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b0bf:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f010b0c4:	e8 74 fe ff ff       	call   f010af3d <lapicw>
+f010b0c9:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b0ce:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f010b0d3:	e8 65 fe ff ff       	call   f010af3d <lapicw>
+f010b0d8:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b0dd:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f010b0e2:	e8 56 fe ff ff       	call   f010af3d <lapicw>
+f010b0e7:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b0ec:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010b0f1:	e8 47 fe ff ff       	call   f010af3d <lapicw>
+f010b0f6:	ba 00 85 08 00       	mov    $0x88500,%edx
+f010b0fb:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010b100:	e8 38 fe ff ff       	call   f010af3d <lapicw>
+f010b105:	8b 15 00 30 31 f0    	mov    0xf0313000,%edx
+f010b10b:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010b111:	f6 c4 10             	test   $0x10,%ah
+f010b114:	75 f5                	jne    f010b10b <lapic_init+0xde>
+f010b116:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b11b:	b8 20 00 00 00       	mov    $0x20,%eax
+f010b120:	e8 18 fe ff ff       	call   f010af3d <lapicw>
+f010b125:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010b128:	c9                   	leave
+f010b129:	c3                   	ret
+f010b12a:	ba 0b 00 00 00       	mov    $0xb,%edx
+f010b12f:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f010b134:	e8 04 fe ff ff       	call   f010af3d <lapicw>
+f010b139:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010b13e:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010b143:	e8 f5 fd ff ff       	call   f010af3d <lapicw>
+f010b148:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f010b14d:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f010b152:	e8 e6 fd ff ff       	call   f010af3d <lapicw>
+f010b157:	83 ec 0c             	sub    $0xc,%esp
+f010b15a:	6a 0a                	push   $0xa
+f010b15c:	e8 f3 a9 ff ff       	call   f0105b54 <pit_delay>
+f010b161:	a1 00 30 31 f0       	mov    0xf0313000,%eax
+f010b166:	8b 98 90 03 00 00    	mov    0x390(%eax),%ebx
+f010b16c:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b171:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f010b176:	e8 c2 fd ff ff       	call   f010af3d <lapicw>
+f010b17b:	83 c4 10             	add    $0x10,%esp
+f010b17e:	83 fb f5             	cmp    $0xfffffff5,%ebx
+f010b181:	77 1d                	ja     f010b1a0 <lapic_init+0x173>
+f010b183:	f7 d3                	not    %ebx
+f010b185:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+f010b18a:	89 d8                	mov    %ebx,%eax
+f010b18c:	f7 e2                	mul    %edx
+f010b18e:	c1 ea 03             	shr    $0x3,%edx
+f010b191:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f010b194:	01 c0                	add    %eax,%eax
+f010b196:	a3 e0 63 2b f0       	mov    %eax,0xf02b63e0
+f010b19b:	e9 bd fe ff ff       	jmp    f010b05d <lapic_init+0x30>
+f010b1a0:	83 ec 0c             	sub    $0xc,%esp
+f010b1a3:	68 00 f1 10 f0       	push   $0xf010f100
+f010b1a8:	e8 5a ab ff ff       	call   f0105d07 <cprintf>
+f010b1ad:	83 c4 10             	add    $0x10,%esp
+f010b1b0:	ba 40 42 0f 00       	mov    $0xf4240,%edx
+f010b1b5:	eb da                	jmp    f010b191 <lapic_init+0x164>
+f010b1b7:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010b1bc:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f010b1c1:	e8 77 fd ff ff       	call   f010af3d <lapicw>
+f010b1c6:	e9 e0 fe ff ff       	jmp    f010b0ab <lapic_init+0x7e>
+f010b1cb:	c3                   	ret
+
+f010b1cc <lapic_eoi>:
+f010b1cc:	83 3d 00 30 31 f0 00 	cmpl   $0x0,0xf0313000
+f010b1d3:	74 17                	je     f010b1ec <lapic_eoi+0x20>
+f010b1d5:	55                   	push   %ebp
+f010b1d6:	89 e5                	mov    %esp,%ebp
+f010b1d8:	83 ec 08             	sub    $0x8,%esp
+f010b1db:	ba 00 00 00 00       	mov    $0x0,%edx
+f010b1e0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f010b1e5:	e8 53 fd ff ff       	call   f010af3d <lapicw>
+f010b1ea:	c9                   	leave
+f010b1eb:	c3                   	ret
+f010b1ec:	c3                   	ret
+
+f010b1ed <lapic_startap>:
+f010b1ed:	55                   	push   %ebp
+f010b1ee:	89 e5                	mov    %esp,%ebp
+f010b1f0:	56                   	push   %esi
+f010b1f1:	53                   	push   %ebx
+f010b1f2:	8b 75 08             	mov    0x8(%ebp),%esi
+f010b1f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010b1f8:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010b1fd:	ba 70 00 00 00       	mov    $0x70,%edx
+f010b202:	ee                   	out    %al,(%dx)
+f010b203:	b8 0a 00 00 00       	mov    $0xa,%eax
+f010b208:	ba 71 00 00 00       	mov    $0x71,%edx
+f010b20d:	ee                   	out    %al,(%dx)
+f010b20e:	83 3d 68 1a 2d f0 00 	cmpl   $0x0,0xf02d1a68
+f010b215:	74 7e                	je     f010b295 <lapic_startap+0xa8>
+f010b217:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f010b21e:	00 00 
+f010b220:	89 d8                	mov    %ebx,%eax
+f010b222:	c1 e8 04             	shr    $0x4,%eax
+f010b225:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+f010b22b:	c1 e6 18             	shl    $0x18,%esi
+f010b22e:	89 f2                	mov    %esi,%edx
+f010b230:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010b235:	e8 03 fd ff ff       	call   f010af3d <lapicw>
+f010b23a:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f010b23f:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010b244:	e8 f4 fc ff ff       	call   f010af3d <lapicw>
+f010b249:	ba 00 85 00 00       	mov    $0x8500,%edx
+f010b24e:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010b253:	e8 e5 fc ff ff       	call   f010af3d <lapicw>
+f010b258:	c1 eb 0c             	shr    $0xc,%ebx
+f010b25b:	80 cf 06             	or     $0x6,%bh
+f010b25e:	89 f2                	mov    %esi,%edx
+f010b260:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010b265:	e8 d3 fc ff ff       	call   f010af3d <lapicw>
+f010b26a:	89 da                	mov    %ebx,%edx
+f010b26c:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010b271:	e8 c7 fc ff ff       	call   f010af3d <lapicw>
+f010b276:	89 f2                	mov    %esi,%edx
+f010b278:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010b27d:	e8 bb fc ff ff       	call   f010af3d <lapicw>
+f010b282:	89 da                	mov    %ebx,%edx
+f010b284:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010b289:	e8 af fc ff ff       	call   f010af3d <lapicw>
+f010b28e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010b291:	5b                   	pop    %ebx
+f010b292:	5e                   	pop    %esi
+f010b293:	5d                   	pop    %ebp
+f010b294:	c3                   	ret
+f010b295:	68 67 04 00 00       	push   $0x467
+f010b29a:	68 24 d0 10 f0       	push   $0xf010d024
+f010b29f:	68 c4 00 00 00       	push   $0xc4
+f010b2a4:	68 21 f1 10 f0       	push   $0xf010f121
+f010b2a9:	e8 92 4d ff ff       	call   f0100040 <_panic>
+
+f010b2ae <lapic_ipi>:
+f010b2ae:	55                   	push   %ebp
+f010b2af:	89 e5                	mov    %esp,%ebp
+f010b2b1:	83 ec 08             	sub    $0x8,%esp
+f010b2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+f010b2b7:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f010b2bd:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010b2c2:	e8 76 fc ff ff       	call   f010af3d <lapicw>
+f010b2c7:	8b 15 00 30 31 f0    	mov    0xf0313000,%edx
+f010b2cd:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010b2d3:	f6 c4 10             	test   $0x10,%ah
+f010b2d6:	75 f5                	jne    f010b2cd <lapic_ipi+0x1f>
+f010b2d8:	c9                   	leave
+f010b2d9:	c3                   	ret
+
+f010b2da <lapic_ipi_dest>:
+f010b2da:	55                   	push   %ebp
+f010b2db:	89 e5                	mov    %esp,%ebp
+f010b2dd:	83 ec 08             	sub    $0x8,%esp
+f010b2e0:	8b 55 08             	mov    0x8(%ebp),%edx
+f010b2e3:	c1 e2 18             	shl    $0x18,%edx
+f010b2e6:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f010b2eb:	e8 4d fc ff ff       	call   f010af3d <lapicw>
+f010b2f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010b2f3:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f010b2f8:	e8 40 fc ff ff       	call   f010af3d <lapicw>
+f010b2fd:	8b 15 00 30 31 f0    	mov    0xf0313000,%edx
+f010b303:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f010b309:	f6 c4 10             	test   $0x10,%ah
+f010b30c:	75 f5                	jne    f010b303 <lapic_ipi_dest+0x29>
+f010b30e:	c9                   	leave
+f010b30f:	c3                   	ret
+
+f010b310 <__spin_initlock>:
+f010b310:	55                   	push   %ebp
+f010b311:	89 e5                	mov    %esp,%ebp
+f010b313:	8b 45 08             	mov    0x8(%ebp),%eax
+f010b316:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f010b31c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010b31f:	89 50 04             	mov    %edx,0x4(%eax)
+f010b322:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+f010b329:	5d                   	pop    %ebp
+f010b32a:	c3                   	ret
+
+f010b32b <spin_lock>:
+f010b32b:	55                   	push   %ebp
+f010b32c:	89 e5                	mov    %esp,%ebp
+f010b32e:	56                   	push   %esi
+f010b32f:	53                   	push   %ebx
+f010b330:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010b333:	83 3b 00             	cmpl   $0x0,(%ebx)
+f010b336:	0f 85 83 00 00 00    	jne    f010b3bf <spin_lock+0x94>
+f010b33c:	b8 01 00 00 00       	mov    $0x1,%eax
+f010b341:	f0 87 03             	lock xchg %eax,(%ebx)
+f010b344:	ba 01 00 00 00       	mov    $0x1,%edx
+f010b349:	85 c0                	test   %eax,%eax
+f010b34b:	74 0b                	je     f010b358 <spin_lock+0x2d>
+f010b34d:	f3 90                	pause
+f010b34f:	89 d0                	mov    %edx,%eax
+f010b351:	f0 87 03             	lock xchg %eax,(%ebx)
+f010b354:	85 c0                	test   %eax,%eax
+f010b356:	75 f5                	jne    f010b34d <spin_lock+0x22>
+f010b358:	e8 f4 fb ff ff       	call   f010af51 <cpunum>
+f010b35d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010b363:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010b368:	89 43 08             	mov    %eax,0x8(%ebx)
+f010b36b:	89 e8                	mov    %ebp,%eax
+f010b36d:	89 c2                	mov    %eax,%edx
+f010b36f:	05 00 00 80 10       	add    $0x10800000,%eax
+f010b374:	3d ff ff 7f 0e       	cmp    $0xe7fffff,%eax
+f010b379:	77 7d                	ja     f010b3f8 <spin_lock+0xcd>
+f010b37b:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b380:	8b 4a 04             	mov    0x4(%edx),%ecx
+f010b383:	89 4c 83 0c          	mov    %ecx,0xc(%ebx,%eax,4)
+f010b387:	8b 12                	mov    (%edx),%edx
+f010b389:	83 c0 01             	add    $0x1,%eax
+f010b38c:	83 f8 0a             	cmp    $0xa,%eax
+f010b38f:	74 27                	je     f010b3b8 <spin_lock+0x8d>
+f010b391:	8d 8a 00 00 80 10    	lea    0x10800000(%edx),%ecx
+f010b397:	81 f9 ff ff 7f 0e    	cmp    $0xe7fffff,%ecx
+f010b39d:	76 e1                	jbe    f010b380 <spin_lock+0x55>
+f010b39f:	83 f8 09             	cmp    $0x9,%eax
+f010b3a2:	7f 14                	jg     f010b3b8 <spin_lock+0x8d>
+f010b3a4:	8d 44 83 0c          	lea    0xc(%ebx,%eax,4),%eax
+f010b3a8:	83 c3 34             	add    $0x34,%ebx
+f010b3ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+f010b3b1:	83 c0 04             	add    $0x4,%eax
+f010b3b4:	39 d8                	cmp    %ebx,%eax
+f010b3b6:	75 f3                	jne    f010b3ab <spin_lock+0x80>
+f010b3b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010b3bb:	5b                   	pop    %ebx
+f010b3bc:	5e                   	pop    %esi
+f010b3bd:	5d                   	pop    %ebp
+f010b3be:	c3                   	ret
+f010b3bf:	8b 73 08             	mov    0x8(%ebx),%esi
+f010b3c2:	e8 8a fb ff ff       	call   f010af51 <cpunum>
+f010b3c7:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010b3cd:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010b3d2:	39 c6                	cmp    %eax,%esi
+f010b3d4:	0f 85 62 ff ff ff    	jne    f010b33c <spin_lock+0x11>
+f010b3da:	8b 5b 04             	mov    0x4(%ebx),%ebx
+f010b3dd:	e8 6f fb ff ff       	call   f010af51 <cpunum>
+f010b3e2:	83 ec 0c             	sub    $0xc,%esp
+f010b3e5:	53                   	push   %ebx
+f010b3e6:	50                   	push   %eax
+f010b3e7:	68 30 f1 10 f0       	push   $0xf010f130
+f010b3ec:	6a 42                	push   $0x42
+f010b3ee:	68 92 f1 10 f0       	push   $0xf010f192
+f010b3f3:	e8 48 4c ff ff       	call   f0100040 <_panic>
+f010b3f8:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b3fd:	eb a5                	jmp    f010b3a4 <spin_lock+0x79>
+
+f010b3ff <spin_unlock>:
+f010b3ff:	55                   	push   %ebp
+f010b400:	89 e5                	mov    %esp,%ebp
+f010b402:	57                   	push   %edi
+f010b403:	56                   	push   %esi
+f010b404:	53                   	push   %ebx
+f010b405:	83 ec 5c             	sub    $0x5c,%esp
+f010b408:	8b 75 08             	mov    0x8(%ebp),%esi
+f010b40b:	83 3e 00             	cmpl   $0x0,(%esi)
+f010b40e:	75 38                	jne    f010b448 <spin_unlock+0x49>
+f010b410:	83 ec 04             	sub    $0x4,%esp
+f010b413:	6a 28                	push   $0x28
+f010b415:	8d 46 0c             	lea    0xc(%esi),%eax
+f010b418:	50                   	push   %eax
+f010b419:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f010b41c:	53                   	push   %ebx
+f010b41d:	e8 07 f5 ff ff       	call   f010a929 <memmove>
+f010b422:	8b 46 08             	mov    0x8(%esi),%eax
+f010b425:	0f b6 38             	movzbl (%eax),%edi
+f010b428:	8b 76 04             	mov    0x4(%esi),%esi
+f010b42b:	e8 21 fb ff ff       	call   f010af51 <cpunum>
+f010b430:	57                   	push   %edi
+f010b431:	56                   	push   %esi
+f010b432:	50                   	push   %eax
+f010b433:	68 5c f1 10 f0       	push   $0xf010f15c
+f010b438:	e8 ca a8 ff ff       	call   f0105d07 <cprintf>
+f010b43d:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f010b440:	83 c4 20             	add    $0x20,%esp
+f010b443:	8d 75 a8             	lea    -0x58(%ebp),%esi
+f010b446:	eb 51                	jmp    f010b499 <spin_unlock+0x9a>
+f010b448:	8b 5e 08             	mov    0x8(%esi),%ebx
+f010b44b:	e8 01 fb ff ff       	call   f010af51 <cpunum>
+f010b450:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010b456:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010b45b:	39 c3                	cmp    %eax,%ebx
+f010b45d:	75 b1                	jne    f010b410 <spin_unlock+0x11>
+f010b45f:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+f010b466:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+f010b46d:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b472:	f0 87 06             	lock xchg %eax,(%esi)
+f010b475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010b478:	5b                   	pop    %ebx
+f010b479:	5e                   	pop    %esi
+f010b47a:	5f                   	pop    %edi
+f010b47b:	5d                   	pop    %ebp
+f010b47c:	c3                   	ret
+f010b47d:	83 ec 08             	sub    $0x8,%esp
+f010b480:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010b483:	ff 30                	push   (%eax)
+f010b485:	68 b9 f1 10 f0       	push   $0xf010f1b9
+f010b48a:	e8 78 a8 ff ff       	call   f0105d07 <cprintf>
+f010b48f:	83 c4 10             	add    $0x10,%esp
+f010b492:	83 c3 04             	add    $0x4,%ebx
+f010b495:	39 fb                	cmp    %edi,%ebx
+f010b497:	74 44                	je     f010b4dd <spin_unlock+0xde>
+f010b499:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f010b49c:	8b 03                	mov    (%ebx),%eax
+f010b49e:	85 c0                	test   %eax,%eax
+f010b4a0:	74 3b                	je     f010b4dd <spin_unlock+0xde>
+f010b4a2:	83 ec 08             	sub    $0x8,%esp
+f010b4a5:	56                   	push   %esi
+f010b4a6:	50                   	push   %eax
+f010b4a7:	e8 09 e8 ff ff       	call   f0109cb5 <debuginfo_eip>
+f010b4ac:	83 c4 10             	add    $0x10,%esp
+f010b4af:	85 c0                	test   %eax,%eax
+f010b4b1:	78 ca                	js     f010b47d <spin_unlock+0x7e>
+f010b4b3:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010b4b6:	8b 00                	mov    (%eax),%eax
+f010b4b8:	83 ec 04             	sub    $0x4,%esp
+f010b4bb:	89 c2                	mov    %eax,%edx
+f010b4bd:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f010b4c0:	52                   	push   %edx
+f010b4c1:	ff 75 b0             	push   -0x50(%ebp)
+f010b4c4:	ff 75 b4             	push   -0x4c(%ebp)
+f010b4c7:	ff 75 ac             	push   -0x54(%ebp)
+f010b4ca:	ff 75 a8             	push   -0x58(%ebp)
+f010b4cd:	50                   	push   %eax
+f010b4ce:	68 a2 f1 10 f0       	push   $0xf010f1a2
+f010b4d3:	e8 2f a8 ff ff       	call   f0105d07 <cprintf>
+f010b4d8:	83 c4 20             	add    $0x20,%esp
+f010b4db:	eb b5                	jmp    f010b492 <spin_unlock+0x93>
+f010b4dd:	83 ec 04             	sub    $0x4,%esp
+f010b4e0:	68 c1 f1 10 f0       	push   $0xf010f1c1
+f010b4e5:	6a 68                	push   $0x68
+f010b4e7:	68 92 f1 10 f0       	push   $0xf010f192
+f010b4ec:	e8 4f 4b ff ff       	call   f0100040 <_panic>
+
+f010b4f1 <e1000_intr_wake>:
+f010b4f1:	a1 e4 63 2b f0       	mov    0xf02b63e4,%eax
+f010b4f6:	85 c0                	test   %eax,%eax
+f010b4f8:	75 0b                	jne    f010b505 <e1000_intr_wake+0x14>
+f010b4fa:	c7 05 e4 63 2b f0 00 	movl   $0x0,0xf02b63e4
+f010b501:	00 00 00 
+f010b504:	c3                   	ret
+f010b505:	55                   	push   %ebp
+f010b506:	89 e5                	mov    %esp,%ebp
+f010b508:	83 ec 1c             	sub    $0x1c,%esp
+f010b50b:	6a 00                	push   $0x0
+f010b50d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f010b510:	52                   	push   %edx
+f010b511:	50                   	push   %eax
+f010b512:	e8 4b 99 ff ff       	call   f0104e62 <envid2env>
+f010b517:	83 c4 10             	add    $0x10,%esp
+f010b51a:	85 c0                	test   %eax,%eax
+f010b51c:	75 09                	jne    f010b527 <e1000_intr_wake+0x36>
+f010b51e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010b521:	83 78 60 00          	cmpl   $0x0,0x60(%eax)
+f010b525:	75 0c                	jne    f010b533 <e1000_intr_wake+0x42>
+f010b527:	c7 05 e4 63 2b f0 00 	movl   $0x0,0xf02b63e4
+f010b52e:	00 00 00 
+f010b531:	c9                   	leave
+f010b532:	c3                   	ret
+f010b533:	c7 40 60 00 00 00 00 	movl   $0x0,0x60(%eax)
+f010b53a:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f010b541:	e8 f8 bd ff ff       	call   f010733e <sched_wakeup>
+f010b546:	eb df                	jmp    f010b527 <e1000_intr_wake+0x36>
+
+f010b548 <e1000_attach>:
+f010b548:	55                   	push   %ebp
+f010b549:	89 e5                	mov    %esp,%ebp
+f010b54b:	56                   	push   %esi
+f010b54c:	53                   	push   %ebx
+f010b54d:	8b 75 08             	mov    0x8(%ebp),%esi
+f010b550:	83 ec 0c             	sub    $0xc,%esp
+f010b553:	56                   	push   %esi
+f010b554:	e8 15 0c 00 00       	call   f010c16e <pci_func_enable>
+f010b559:	c7 04 24 1a 00 00 00 	movl   $0x1a,(%esp)
+f010b560:	ff 76 14             	push   0x14(%esi)
+f010b563:	ff 76 2c             	push   0x2c(%esi)
+f010b566:	68 00 00 c0 ef       	push   $0xefc00000
+f010b56b:	ff 35 6c 1a 2d f0    	push   0xf02d1a6c
+f010b571:	e8 75 6b ff ff       	call   f01020eb <boot_map_region>
+f010b576:	c7 05 74 1a 2d f0 00 	movl   $0xefc00000,0xf02d1a74
+f010b57d:	00 c0 ef 
+f010b580:	a1 08 00 c0 ef       	mov    0xefc00008,%eax
+f010b585:	83 c4 20             	add    $0x20,%esp
+f010b588:	3d 83 07 08 80       	cmp    $0x80080783,%eax
+f010b58d:	75 72                	jne    f010b601 <e1000_attach+0xb9>
+f010b58f:	83 ec 04             	sub    $0x4,%esp
+f010b592:	68 00 04 00 00       	push   $0x400
+f010b597:	6a 00                	push   $0x0
+f010b599:	68 20 31 31 f0       	push   $0xf0313120
+f010b59e:	e8 51 f3 ff ff       	call   f010a8f4 <memset>
+f010b5a3:	83 c4 0c             	add    $0xc,%esp
+f010b5a6:	68 80 7b 01 00       	push   $0x17b80
+f010b5ab:	6a 00                	push   $0x0
+f010b5ad:	68 20 35 31 f0       	push   $0xf0313520
+f010b5b2:	e8 3d f3 ff ff       	call   f010a8f4 <memset>
+f010b5b7:	83 c4 10             	add    $0x10,%esp
+f010b5ba:	b8 20 35 31 f0       	mov    $0xf0313520,%eax
+f010b5bf:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010b5c4:	76 51                	jbe    f010b617 <e1000_attach+0xcf>
+f010b5c6:	ba 0e 3b 31 f0       	mov    $0xf0313b0e,%edx
+f010b5cb:	b8 2c 31 31 f0       	mov    $0xf031312c,%eax
+f010b5d0:	bb a0 b0 32 f0       	mov    $0xf032b0a0,%ebx
+f010b5d5:	8d 8a 12 fa ff 0f    	lea    0xffffa12(%edx),%ecx
+f010b5db:	89 48 f4             	mov    %ecx,-0xc(%eax)
+f010b5de:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+f010b5e5:	80 08 01             	orb    $0x1,(%eax)
+f010b5e8:	39 da                	cmp    %ebx,%edx
+f010b5ea:	74 42                	je     f010b62e <e1000_attach+0xe6>
+f010b5ec:	8d 8a ee 05 00 00    	lea    0x5ee(%edx),%ecx
+f010b5f2:	83 c0 10             	add    $0x10,%eax
+f010b5f5:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f010b5fb:	76 1f                	jbe    f010b61c <e1000_attach+0xd4>
+f010b5fd:	89 ca                	mov    %ecx,%edx
+f010b5ff:	eb d4                	jmp    f010b5d5 <e1000_attach+0x8d>
+f010b601:	68 dc f1 10 f0       	push   $0xf010f1dc
+f010b606:	68 0d e2 10 f0       	push   $0xf010e20d
+f010b60b:	6a 2b                	push   $0x2b
+f010b60d:	68 fe f1 10 f0       	push   $0xf010f1fe
+f010b612:	e8 29 4a ff ff       	call   f0100040 <_panic>
+f010b617:	ba 20 35 31 f0       	mov    $0xf0313520,%edx
+f010b61c:	52                   	push   %edx
+f010b61d:	68 48 d0 10 f0       	push   $0xf010d048
+f010b622:	6a 31                	push   $0x31
+f010b624:	68 fe f1 10 f0       	push   $0xf010f1fe
+f010b629:	e8 12 4a ff ff       	call   f0100040 <_panic>
+f010b62e:	83 ec 04             	sub    $0x4,%esp
+f010b631:	68 00 04 00 00       	push   $0x400
+f010b636:	6a 00                	push   $0x0
+f010b638:	68 a0 b0 32 f0       	push   $0xf032b0a0
+f010b63d:	e8 b2 f2 ff ff       	call   f010a8f4 <memset>
+f010b642:	83 c4 10             	add    $0x10,%esp
+f010b645:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010b64a:	83 ec 0c             	sub    $0xc,%esp
+f010b64d:	6a 00                	push   $0x0
+f010b64f:	e8 39 66 ff ff       	call   f0101c8d <page_alloc>
+f010b654:	89 04 9d 20 30 31 f0 	mov    %eax,-0xfcecfe0(,%ebx,4)
+f010b65b:	83 c4 10             	add    $0x10,%esp
+f010b65e:	85 c0                	test   %eax,%eax
+f010b660:	0f 84 88 02 00 00    	je     f010b8ee <e1000_attach+0x3a6>
+f010b666:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f010b66b:	89 da                	mov    %ebx,%edx
+f010b66d:	c1 e2 04             	shl    $0x4,%edx
+f010b670:	8b 04 9d 20 30 31 f0 	mov    -0xfcecfe0(,%ebx,4),%eax
+f010b677:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010b67d:	c1 f8 02             	sar    $0x2,%eax
+f010b680:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010b686:	c1 e0 0c             	shl    $0xc,%eax
+f010b689:	83 c0 04             	add    $0x4,%eax
+f010b68c:	89 82 a0 b0 32 f0    	mov    %eax,-0xfcd4f60(%edx)
+f010b692:	c7 82 a4 b0 32 f0 00 	movl   $0x0,-0xfcd4f5c(%edx)
+f010b699:	00 00 00 
+f010b69c:	83 c3 01             	add    $0x1,%ebx
+f010b69f:	83 fb 40             	cmp    $0x40,%ebx
+f010b6a2:	75 a6                	jne    f010b64a <e1000_attach+0x102>
+f010b6a4:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f010b6a9:	ba 20 31 31 f0       	mov    $0xf0313120,%edx
+f010b6ae:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f010b6b4:	0f 86 48 02 00 00    	jbe    f010b902 <e1000_attach+0x3ba>
+f010b6ba:	c7 80 00 38 00 00 20 	movl   $0x313120,0x3800(%eax)
+f010b6c1:	31 31 00 
+f010b6c4:	c7 80 04 38 00 00 00 	movl   $0x0,0x3804(%eax)
+f010b6cb:	00 00 00 
+f010b6ce:	c7 80 08 38 00 00 00 	movl   $0x400,0x3808(%eax)
+f010b6d5:	04 00 00 
+f010b6d8:	c7 80 10 38 00 00 00 	movl   $0x0,0x3810(%eax)
+f010b6df:	00 00 00 
+f010b6e2:	c7 80 18 38 00 00 00 	movl   $0x0,0x3818(%eax)
+f010b6e9:	00 00 00 
+f010b6ec:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f010b6f2:	83 ca 02             	or     $0x2,%edx
+f010b6f5:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+f010b6fb:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f010b701:	83 ca 08             	or     $0x8,%edx
+f010b704:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+f010b70a:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f010b710:	81 e2 0f f0 ff ff    	and    $0xfffff00f,%edx
+f010b716:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+f010b71c:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f010b722:	80 ce 01             	or     $0x1,%dh
+f010b725:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+f010b72b:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f010b731:	81 e2 ff 0f c0 ff    	and    $0xffc00fff,%edx
+f010b737:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+f010b73d:	8b 90 00 04 00 00    	mov    0x400(%eax),%edx
+f010b743:	81 ca 00 00 04 00    	or     $0x40000,%edx
+f010b749:	89 90 00 04 00 00    	mov    %edx,0x400(%eax)
+f010b74f:	c7 80 10 04 00 00 00 	movl   $0x0,0x410(%eax)
+f010b756:	00 00 00 
+f010b759:	8b 90 10 04 00 00    	mov    0x410(%eax),%edx
+f010b75f:	81 ca 00 00 60 00    	or     $0x600000,%edx
+f010b765:	89 90 10 04 00 00    	mov    %edx,0x410(%eax)
+f010b76b:	8b 90 10 04 00 00    	mov    0x410(%eax),%edx
+f010b771:	80 ce 10             	or     $0x10,%dh
+f010b774:	89 90 10 04 00 00    	mov    %edx,0x410(%eax)
+f010b77a:	8b 90 10 04 00 00    	mov    0x410(%eax),%edx
+f010b780:	83 ca 0a             	or     $0xa,%edx
+f010b783:	89 90 10 04 00 00    	mov    %edx,0x410(%eax)
+f010b789:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+f010b790:	8b 50 14             	mov    0x14(%eax),%edx
+f010b793:	83 ca 01             	or     $0x1,%edx
+f010b796:	89 50 14             	mov    %edx,0x14(%eax)
+f010b799:	8b 50 14             	mov    0x14(%eax),%edx
+f010b79c:	f6 c2 10             	test   $0x10,%dl
+f010b79f:	74 f8                	je     f010b799 <e1000_attach+0x251>
+f010b7a1:	8b 50 14             	mov    0x14(%eax),%edx
+f010b7a4:	c1 ea 10             	shr    $0x10,%edx
+f010b7a7:	89 90 00 54 00 00    	mov    %edx,0x5400(%eax)
+f010b7ad:	c7 40 14 00 01 00 00 	movl   $0x100,0x14(%eax)
+f010b7b4:	8b 50 14             	mov    0x14(%eax),%edx
+f010b7b7:	83 ca 01             	or     $0x1,%edx
+f010b7ba:	89 50 14             	mov    %edx,0x14(%eax)
+f010b7bd:	8b 50 14             	mov    0x14(%eax),%edx
+f010b7c0:	f6 c2 10             	test   $0x10,%dl
+f010b7c3:	74 f8                	je     f010b7bd <e1000_attach+0x275>
+f010b7c5:	8b 50 14             	mov    0x14(%eax),%edx
+f010b7c8:	8b 88 00 54 00 00    	mov    0x5400(%eax),%ecx
+f010b7ce:	66 ba 00 00          	mov    $0x0,%dx
+f010b7d2:	09 ca                	or     %ecx,%edx
+f010b7d4:	89 90 00 54 00 00    	mov    %edx,0x5400(%eax)
+f010b7da:	c7 40 14 00 02 00 00 	movl   $0x200,0x14(%eax)
+f010b7e1:	8b 50 14             	mov    0x14(%eax),%edx
+f010b7e4:	83 ca 01             	or     $0x1,%edx
+f010b7e7:	89 50 14             	mov    %edx,0x14(%eax)
+f010b7ea:	8b 50 14             	mov    0x14(%eax),%edx
+f010b7ed:	f6 c2 10             	test   $0x10,%dl
+f010b7f0:	74 f8                	je     f010b7ea <e1000_attach+0x2a2>
+f010b7f2:	8b 50 14             	mov    0x14(%eax),%edx
+f010b7f5:	c1 ea 10             	shr    $0x10,%edx
+f010b7f8:	89 90 04 54 00 00    	mov    %edx,0x5404(%eax)
+f010b7fe:	8b 90 04 54 00 00    	mov    0x5404(%eax),%edx
+f010b804:	81 ca 00 00 00 80    	or     $0x80000000,%edx
+f010b80a:	89 90 04 54 00 00    	mov    %edx,0x5404(%eax)
+f010b810:	ba a0 b0 32 f0       	mov    $0xf032b0a0,%edx
+f010b815:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f010b81b:	0f 86 f3 00 00 00    	jbe    f010b914 <e1000_attach+0x3cc>
+f010b821:	c7 80 00 28 00 00 a0 	movl   $0x32b0a0,0x2800(%eax)
+f010b828:	b0 32 00 
+f010b82b:	c7 80 04 28 00 00 00 	movl   $0x0,0x2804(%eax)
+f010b832:	00 00 00 
+f010b835:	c7 80 08 28 00 00 00 	movl   $0x400,0x2808(%eax)
+f010b83c:	04 00 00 
+f010b83f:	c7 80 10 28 00 00 00 	movl   $0x0,0x2810(%eax)
+f010b846:	00 00 00 
+f010b849:	c7 80 18 28 00 00 00 	movl   $0x0,0x2818(%eax)
+f010b850:	00 00 00 
+f010b853:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b859:	83 ca 02             	or     $0x2,%edx
+f010b85c:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b862:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b868:	83 e2 df             	and    $0xffffffdf,%edx
+f010b86b:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b871:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b877:	80 e2 3f             	and    $0x3f,%dl
+f010b87a:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b880:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b886:	80 e6 fc             	and    $0xfc,%dh
+f010b889:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b88f:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b895:	80 e6 cf             	and    $0xcf,%dh
+f010b898:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b89e:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b8a4:	80 ce 80             	or     $0x80,%dh
+f010b8a7:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b8ad:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b8b3:	81 e2 ff ff fc ff    	and    $0xfffcffff,%edx
+f010b8b9:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b8bf:	8b 90 00 01 00 00    	mov    0x100(%eax),%edx
+f010b8c5:	81 ca 00 00 00 04    	or     $0x4000000,%edx
+f010b8cb:	89 90 00 01 00 00    	mov    %edx,0x100(%eax)
+f010b8d1:	0f b6 56 44          	movzbl 0x44(%esi),%edx
+f010b8d5:	8d 4a ff             	lea    -0x1(%edx),%ecx
+f010b8d8:	80 f9 0e             	cmp    $0xe,%cl
+f010b8db:	77 05                	ja     f010b8e2 <e1000_attach+0x39a>
+f010b8dd:	80 fa 02             	cmp    $0x2,%dl
+f010b8e0:	75 44                	jne    f010b926 <e1000_attach+0x3de>
+f010b8e2:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b8e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010b8ea:	5b                   	pop    %ebx
+f010b8eb:	5e                   	pop    %esi
+f010b8ec:	5d                   	pop    %ebp
+f010b8ed:	c3                   	ret
+f010b8ee:	83 ec 04             	sub    $0x4,%esp
+f010b8f1:	68 0b f2 10 f0       	push   $0xf010f20b
+f010b8f6:	6a 3a                	push   $0x3a
+f010b8f8:	68 fe f1 10 f0       	push   $0xf010f1fe
+f010b8fd:	e8 3e 47 ff ff       	call   f0100040 <_panic>
+f010b902:	52                   	push   %edx
+f010b903:	68 48 d0 10 f0       	push   $0xf010d048
+f010b908:	6a 41                	push   $0x41
+f010b90a:	68 fe f1 10 f0       	push   $0xf010f1fe
+f010b90f:	e8 2c 47 ff ff       	call   f0100040 <_panic>
+f010b914:	52                   	push   %edx
+f010b915:	68 48 d0 10 f0       	push   $0xf010d048
+f010b91a:	6a 6d                	push   $0x6d
+f010b91c:	68 fe f1 10 f0       	push   $0xf010f1fe
+f010b921:	e8 1a 47 ff ff       	call   f0100040 <_panic>
+f010b926:	c7 80 20 28 00 00 14 	movl   $0x14,0x2820(%eax)
+f010b92d:	00 00 00 
+f010b930:	c7 80 2c 28 00 00 40 	movl   $0x40,0x282c(%eax)
+f010b937:	00 00 00 
+f010b93a:	c7 80 c4 00 00 00 e8 	movl   $0x1e8,0xc4(%eax)
+f010b941:	01 00 00 
+f010b944:	c7 80 d8 00 00 00 ff 	movl   $0xffffffff,0xd8(%eax)
+f010b94b:	ff ff ff 
+f010b94e:	8b 90 c0 00 00 00    	mov    0xc0(%eax),%edx
+f010b954:	c7 80 d0 00 00 00 d0 	movl   $0xd0,0xd0(%eax)
+f010b95b:	00 00 00 
+f010b95e:	0f b6 56 44          	movzbl 0x44(%esi),%edx
+f010b962:	88 15 78 1a 2d f0    	mov    %dl,0xf02d1a78
+f010b968:	83 ec 0c             	sub    $0xc,%esp
+f010b96b:	0f b7 05 88 a3 11 f0 	movzwl 0xf011a388,%eax
+f010b972:	0f b3 d0             	btr    %edx,%eax
+f010b975:	0f b7 c0             	movzwl %ax,%eax
+f010b978:	50                   	push   %eax
+f010b979:	e8 12 a2 ff ff       	call   f0105b90 <irq_setmask_8259A>
+f010b97e:	83 c4 10             	add    $0x10,%esp
+f010b981:	e9 5c ff ff ff       	jmp    f010b8e2 <e1000_attach+0x39a>
+
+f010b986 <e1000_transmit>:
+f010b986:	55                   	push   %ebp
+f010b987:	89 e5                	mov    %esp,%ebp
+f010b989:	56                   	push   %esi
+f010b98a:	53                   	push   %ebx
+f010b98b:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010b98e:	81 fe ee 05 00 00    	cmp    $0x5ee,%esi
+f010b994:	0f 8f ac 00 00 00    	jg     f010ba46 <e1000_transmit+0xc0>
+f010b99a:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f010b99f:	8b 98 18 38 00 00    	mov    0x3818(%eax),%ebx
+f010b9a5:	89 d8                	mov    %ebx,%eax
+f010b9a7:	c1 e0 04             	shl    $0x4,%eax
+f010b9aa:	f6 80 2c 31 31 f0 01 	testb  $0x1,-0xfceced4(%eax)
+f010b9b1:	74 70                	je     f010ba23 <e1000_transmit+0x9d>
+f010b9b3:	83 ec 04             	sub    $0x4,%esp
+f010b9b6:	56                   	push   %esi
+f010b9b7:	ff 75 08             	push   0x8(%ebp)
+f010b9ba:	69 c3 ee 05 00 00    	imul   $0x5ee,%ebx,%eax
+f010b9c0:	05 20 35 31 f0       	add    $0xf0313520,%eax
+f010b9c5:	50                   	push   %eax
+f010b9c6:	e8 5e ef ff ff       	call   f010a929 <memmove>
+f010b9cb:	89 d8                	mov    %ebx,%eax
+f010b9cd:	c1 e0 04             	shl    $0x4,%eax
+f010b9d0:	66 89 b0 28 31 31 f0 	mov    %si,-0xfceced8(%eax)
+f010b9d7:	05 20 31 31 f0       	add    $0xf0313120,%eax
+f010b9dc:	80 60 0c fe          	andb   $0xfe,0xc(%eax)
+f010b9e0:	80 48 0b 09          	orb    $0x9,0xb(%eax)
+f010b9e4:	8d 43 01             	lea    0x1(%ebx),%eax
+f010b9e7:	83 e0 3f             	and    $0x3f,%eax
+f010b9ea:	8b 15 74 1a 2d f0    	mov    0xf02d1a74,%edx
+f010b9f0:	89 82 18 38 00 00    	mov    %eax,0x3818(%edx)
+f010b9f6:	83 c4 10             	add    $0x10,%esp
+f010b9f9:	b8 00 00 00 00       	mov    $0x0,%eax
+f010b9fe:	f6 05 a9 b4 32 f0 01 	testb  $0x1,0xf032b4a9
+f010ba05:	75 07                	jne    f010ba0e <e1000_transmit+0x88>
+f010ba07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010ba0a:	5b                   	pop    %ebx
+f010ba0b:	5e                   	pop    %esi
+f010ba0c:	5d                   	pop    %ebp
+f010ba0d:	c3                   	ret
+f010ba0e:	6a 00                	push   $0x0
+f010ba10:	53                   	push   %ebx
+f010ba11:	56                   	push   %esi
+f010ba12:	6a 08                	push   $0x8
+f010ba14:	e8 6e 11 00 00       	call   f010cb87 <trace_record>
+f010ba19:	83 c4 10             	add    $0x10,%esp
+f010ba1c:	b8 00 00 00 00       	mov    $0x0,%eax
+f010ba21:	eb e4                	jmp    f010ba07 <e1000_transmit+0x81>
+f010ba23:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+f010ba28:	f6 05 a9 b4 32 f0 01 	testb  $0x1,0xf032b4a9
+f010ba2f:	74 d6                	je     f010ba07 <e1000_transmit+0x81>
+f010ba31:	6a f0                	push   $0xfffffff0
+f010ba33:	53                   	push   %ebx
+f010ba34:	56                   	push   %esi
+f010ba35:	6a 08                	push   $0x8
+f010ba37:	e8 4b 11 00 00       	call   f010cb87 <trace_record>
+f010ba3c:	83 c4 10             	add    $0x10,%esp
+f010ba3f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+f010ba44:	eb c1                	jmp    f010ba07 <e1000_transmit+0x81>
+f010ba46:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+f010ba4b:	eb ba                	jmp    f010ba07 <e1000_transmit+0x81>
+
+f010ba4d <e1000_receive>:
+f010ba4d:	55                   	push   %ebp
+f010ba4e:	89 e5                	mov    %esp,%ebp
+f010ba50:	57                   	push   %edi
+f010ba51:	56                   	push   %esi
+f010ba52:	53                   	push   %ebx
+f010ba53:	83 ec 0c             	sub    $0xc,%esp
+f010ba56:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f010ba5b:	8b 98 18 28 00 00    	mov    0x2818(%eax),%ebx
+f010ba61:	89 d8                	mov    %ebx,%eax
+f010ba63:	c1 e0 04             	shl    $0x4,%eax
+f010ba66:	0f b6 80 ac b0 32 f0 	movzbl -0xfcd4f54(%eax),%eax
+f010ba6d:	a8 01                	test   $0x1,%al
+f010ba6f:	0f 84 bc 00 00 00    	je     f010bb31 <e1000_receive+0xe4>
+f010ba75:	a8 02                	test   $0x2,%al
+f010ba77:	74 7f                	je     f010baf8 <e1000_receive+0xab>
+f010ba79:	89 d8                	mov    %ebx,%eax
+f010ba7b:	c1 e0 04             	shl    $0x4,%eax
+f010ba7e:	0f b7 b0 a8 b0 32 f0 	movzwl -0xfcd4f58(%eax),%esi
+f010ba85:	0f b7 fe             	movzwl %si,%edi
+f010ba88:	8b 04 9d 20 30 31 f0 	mov    -0xfcecfe0(,%ebx,4),%eax
+f010ba8f:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010ba95:	c1 f8 02             	sar    $0x2,%eax
+f010ba98:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010ba9e:	89 c2                	mov    %eax,%edx
+f010baa0:	c1 e2 0c             	shl    $0xc,%edx
+f010baa3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010baa8:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f010baae:	73 5f                	jae    f010bb0f <e1000_receive+0xc2>
+f010bab0:	83 ec 04             	sub    $0x4,%esp
+f010bab3:	57                   	push   %edi
+f010bab4:	81 ea fc ff ff 0f    	sub    $0xffffffc,%edx
+f010baba:	52                   	push   %edx
+f010babb:	ff 75 08             	push   0x8(%ebp)
+f010babe:	e8 66 ee ff ff       	call   f010a929 <memmove>
+f010bac3:	89 d8                	mov    %ebx,%eax
+f010bac5:	c1 e0 04             	shl    $0x4,%eax
+f010bac8:	80 a0 ac b0 32 f0 fc 	andb   $0xfc,-0xfcd4f54(%eax)
+f010bacf:	8d 43 01             	lea    0x1(%ebx),%eax
+f010bad2:	83 e0 3f             	and    $0x3f,%eax
+f010bad5:	8b 15 74 1a 2d f0    	mov    0xf02d1a74,%edx
+f010badb:	89 82 18 28 00 00    	mov    %eax,0x2818(%edx)
+f010bae1:	83 c4 10             	add    $0x10,%esp
+f010bae4:	f6 05 a9 b4 32 f0 02 	testb  $0x2,0xf032b4a9
+f010baeb:	75 34                	jne    f010bb21 <e1000_receive+0xd4>
+f010baed:	0f b7 c6             	movzwl %si,%eax
+f010baf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010baf3:	5b                   	pop    %ebx
+f010baf4:	5e                   	pop    %esi
+f010baf5:	5f                   	pop    %edi
+f010baf6:	5d                   	pop    %ebp
+f010baf7:	c3                   	ret
+f010baf8:	83 ec 04             	sub    $0x4,%esp
+f010bafb:	68 27 f2 10 f0       	push   $0xf010f227
+f010bb00:	68 b7 00 00 00       	push   $0xb7
+f010bb05:	68 fe f1 10 f0       	push   $0xf010f1fe
+f010bb0a:	e8 31 45 ff ff       	call   f0100040 <_panic>
+f010bb0f:	52                   	push   %edx
+f010bb10:	68 24 d0 10 f0       	push   $0xf010d024
+f010bb15:	6a 61                	push   $0x61
+f010bb17:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f010bb1c:	e8 1f 45 ff ff       	call   f0100040 <_panic>
+f010bb21:	6a 00                	push   $0x0
+f010bb23:	53                   	push   %ebx
+f010bb24:	57                   	push   %edi
+f010bb25:	6a 09                	push   $0x9
+f010bb27:	e8 5b 10 00 00       	call   f010cb87 <trace_record>
+f010bb2c:	83 c4 10             	add    $0x10,%esp
+f010bb2f:	eb bc                	jmp    f010baed <e1000_receive+0xa0>
+f010bb31:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+f010bb36:	eb b8                	jmp    f010baf0 <e1000_receive+0xa3>
+
+f010bb38 <e1000_receive_page>:
+f010bb38:	55                   	push   %ebp
+f010bb39:	89 e5                	mov    %esp,%ebp
+f010bb3b:	57                   	push   %edi
+f010bb3c:	56                   	push   %esi
+f010bb3d:	53                   	push   %ebx
+f010bb3e:	83 ec 1c             	sub    $0x1c,%esp
+f010bb41:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f010bb46:	8b b0 18 28 00 00    	mov    0x2818(%eax),%esi
+f010bb4c:	89 f0                	mov    %esi,%eax
+f010bb4e:	c1 e0 04             	shl    $0x4,%eax
+f010bb51:	0f b6 80 ac b0 32 f0 	movzbl -0xfcd4f54(%eax),%eax
+f010bb58:	a8 01                	test   $0x1,%al
+f010bb5a:	0f 84 69 01 00 00    	je     f010bcc9 <e1000_receive_page+0x191>
+f010bb60:	a8 02                	test   $0x2,%al
+f010bb62:	0f 84 14 01 00 00    	je     f010bc7c <e1000_receive_page+0x144>
+f010bb68:	83 ec 0c             	sub    $0xc,%esp
+f010bb6b:	6a 00                	push   $0x0
+f010bb6d:	e8 1b 61 ff ff       	call   f0101c8d <page_alloc>
+f010bb72:	89 c3                	mov    %eax,%ebx
+f010bb74:	83 c4 10             	add    $0x10,%esp
+f010bb77:	85 c0                	test   %eax,%eax
+f010bb79:	0f 84 51 01 00 00    	je     f010bcd0 <e1000_receive_page+0x198>
+f010bb7f:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f010bb84:	89 f0                	mov    %esi,%eax
+f010bb86:	c1 e0 04             	shl    $0x4,%eax
+f010bb89:	0f b7 b8 a8 b0 32 f0 	movzwl -0xfcd4f58(%eax),%edi
+f010bb90:	0f b7 c7             	movzwl %di,%eax
+f010bb93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010bb96:	8b 04 b5 20 30 31 f0 	mov    -0xfcecfe0(,%esi,4),%eax
+f010bb9d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010bba0:	89 01                	mov    %eax,(%ecx)
+f010bba2:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010bba8:	c1 f8 02             	sar    $0x2,%eax
+f010bbab:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010bbb1:	89 c2                	mov    %eax,%edx
+f010bbb3:	c1 e2 0c             	shl    $0xc,%edx
+f010bbb6:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010bbbb:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f010bbc1:	0f 83 cc 00 00 00    	jae    f010bc93 <e1000_receive_page+0x15b>
+f010bbc7:	0f b7 ff             	movzwl %di,%edi
+f010bbca:	89 ba 00 00 00 f0    	mov    %edi,-0x10000000(%edx)
+f010bbd0:	ba fc 0f 00 00       	mov    $0xffc,%edx
+f010bbd5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010bbd8:	29 c2                	sub    %eax,%edx
+f010bbda:	8b 45 08             	mov    0x8(%ebp),%eax
+f010bbdd:	8b 00                	mov    (%eax),%eax
+f010bbdf:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010bbe5:	c1 f8 02             	sar    $0x2,%eax
+f010bbe8:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010bbee:	89 c1                	mov    %eax,%ecx
+f010bbf0:	c1 e1 0c             	shl    $0xc,%ecx
+f010bbf3:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010bbf8:	3b 05 68 1a 2d f0    	cmp    0xf02d1a68,%eax
+f010bbfe:	0f 83 a1 00 00 00    	jae    f010bca5 <e1000_receive_page+0x16d>
+f010bc04:	83 ec 04             	sub    $0x4,%esp
+f010bc07:	52                   	push   %edx
+f010bc08:	6a 00                	push   $0x0
+f010bc0a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010bc0d:	8d 84 08 04 00 00 f0 	lea    -0xffffffc(%eax,%ecx,1),%eax
+f010bc14:	50                   	push   %eax
+f010bc15:	e8 da ec ff ff       	call   f010a8f4 <memset>
+f010bc1a:	89 1c b5 20 30 31 f0 	mov    %ebx,-0xfcecfe0(,%esi,4)
+f010bc21:	89 f2                	mov    %esi,%edx
+f010bc23:	c1 e2 04             	shl    $0x4,%edx
+f010bc26:	89 d8                	mov    %ebx,%eax
+f010bc28:	2b 05 70 1a 2d f0    	sub    0xf02d1a70,%eax
+f010bc2e:	c1 f8 02             	sar    $0x2,%eax
+f010bc31:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010bc37:	c1 e0 0c             	shl    $0xc,%eax
+f010bc3a:	83 c0 04             	add    $0x4,%eax
+f010bc3d:	89 82 a0 b0 32 f0    	mov    %eax,-0xfcd4f60(%edx)
+f010bc43:	c7 82 a4 b0 32 f0 00 	movl   $0x0,-0xfcd4f5c(%edx)
+f010bc4a:	00 00 00 
+f010bc4d:	80 a2 ac b0 32 f0 fc 	andb   $0xfc,-0xfcd4f54(%edx)
+f010bc54:	8d 46 01             	lea    0x1(%esi),%eax
+f010bc57:	83 e0 3f             	and    $0x3f,%eax
+f010bc5a:	8b 15 74 1a 2d f0    	mov    0xf02d1a74,%edx
+f010bc60:	89 82 18 28 00 00    	mov    %eax,0x2818(%edx)
+f010bc66:	83 c4 10             	add    $0x10,%esp
+f010bc69:	f6 05 a9 b4 32 f0 02 	testb  $0x2,0xf032b4a9
+f010bc70:	75 45                	jne    f010bcb7 <e1000_receive_page+0x17f>
+f010bc72:	89 f8                	mov    %edi,%eax
+f010bc74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010bc77:	5b                   	pop    %ebx
+f010bc78:	5e                   	pop    %esi
+f010bc79:	5f                   	pop    %edi
+f010bc7a:	5d                   	pop    %ebp
+f010bc7b:	c3                   	ret
+f010bc7c:	83 ec 04             	sub    $0x4,%esp
+f010bc7f:	68 27 f2 10 f0       	push   $0xf010f227
+f010bc84:	68 d9 00 00 00       	push   $0xd9
+f010bc89:	68 fe f1 10 f0       	push   $0xf010f1fe
+f010bc8e:	e8 ad 43 ff ff       	call   f0100040 <_panic>
+f010bc93:	52                   	push   %edx
+f010bc94:	68 24 d0 10 f0       	push   $0xf010d024
+f010bc99:	6a 61                	push   $0x61
+f010bc9b:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f010bca0:	e8 9b 43 ff ff       	call   f0100040 <_panic>
+f010bca5:	51                   	push   %ecx
+f010bca6:	68 24 d0 10 f0       	push   $0xf010d024
+f010bcab:	6a 61                	push   $0x61
+f010bcad:	68 a8 d4 10 f0       	push   $0xf010d4a8
+f010bcb2:	e8 89 43 ff ff       	call   f0100040 <_panic>
+f010bcb7:	6a 00                	push   $0x0
+f010bcb9:	56                   	push   %esi
+f010bcba:	ff 75 e4             	push   -0x1c(%ebp)
+f010bcbd:	6a 09                	push   $0x9
+f010bcbf:	e8 c3 0e 00 00       	call   f010cb87 <trace_record>
+f010bcc4:	83 c4 10             	add    $0x10,%esp
+f010bcc7:	eb a9                	jmp    f010bc72 <e1000_receive_page+0x13a>
+f010bcc9:	bf ef ff ff ff       	mov    $0xffffffef,%edi
+f010bcce:	eb a2                	jmp    f010bc72 <e1000_receive_page+0x13a>
+f010bcd0:	bf fc ff ff ff       	mov    $0xfffffffc,%edi
+f010bcd5:	eb 9b                	jmp    f010bc72 <e1000_receive_page+0x13a>
+
+f010bcd7 <e1000_rx_wait>:
+f010bcd7:	80 3d 78 1a 2d f0 00 	cmpb   $0x0,0xf02d1a78
+f010bcde:	74 7c                	je     f010bd5c <e1000_rx_wait+0x85>
+f010bce0:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f010bce5:	8b 80 18 28 00 00    	mov    0x2818(%eax),%eax
+f010bceb:	c1 e0 04             	shl    $0x4,%eax
+f010bcee:	ba 00 00 00 00       	mov    $0x0,%edx
+f010bcf3:	f6 80 ac b0 32 f0 01 	testb  $0x1,-0xfcd4f54(%eax)
+f010bcfa:	74 03                	je     f010bcff <e1000_rx_wait+0x28>
+f010bcfc:	89 d0                	mov    %edx,%eax
+f010bcfe:	c3                   	ret
+f010bcff:	55                   	push   %ebp
+f010bd00:	89 e5                	mov    %esp,%ebp
+f010bd02:	83 ec 08             	sub    $0x8,%esp
+f010bd05:	e8 e7 f7 ff ff       	call   f010b4f1 <e1000_intr_wake>
+f010bd0a:	e8 42 f2 ff ff       	call   f010af51 <cpunum>
+f010bd0f:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010bd15:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010bd1b:	8b 40 48             	mov    0x48(%eax),%eax
+f010bd1e:	a3 e4 63 2b f0       	mov    %eax,0xf02b63e4
+f010bd23:	e8 29 f2 ff ff       	call   f010af51 <cpunum>
+f010bd28:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010bd2e:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010bd34:	c7 40 60 01 00 00 00 	movl   $0x1,0x60(%eax)
+f010bd3b:	e8 11 f2 ff ff       	call   f010af51 <cpunum>
+f010bd40:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010bd46:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010bd4c:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+f010bd53:	ba 00 00 00 00       	mov    $0x0,%edx
+f010bd58:	89 d0                	mov    %edx,%eax
+f010bd5a:	c9                   	leave
+f010bd5b:	c3                   	ret
+f010bd5c:	ba f1 ff ff ff       	mov    $0xfffffff1,%edx
+f010bd61:	eb 99                	jmp    f010bcfc <e1000_rx_wait+0x25>
+
+f010bd63 <e1000_intr>:
+f010bd63:	55                   	push   %ebp
+f010bd64:	89 e5                	mov    %esp,%ebp
+f010bd66:	83 ec 08             	sub    $0x8,%esp
+f010bd69:	a1 74 1a 2d f0       	mov    0xf02d1a74,%eax
+f010bd6e:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+f010bd74:	a8 d0                	test   $0xd0,%al
+f010bd76:	75 07                	jne    f010bd7f <e1000_intr+0x1c>
+f010bd78:	e8 3f 9f ff ff       	call   f0105cbc <irq_eoi>
+f010bd7d:	c9                   	leave
+f010bd7e:	c3                   	ret
+f010bd7f:	e8 6d f7 ff ff       	call   f010b4f1 <e1000_intr_wake>
+f010bd84:	eb f2                	jmp    f010bd78 <e1000_intr+0x15>
+
+f010bd86 <pci_attach_match>:
+f010bd86:	55                   	push   %ebp
+f010bd87:	89 e5                	mov    %esp,%ebp
+f010bd89:	57                   	push   %edi
+f010bd8a:	56                   	push   %esi
+f010bd8b:	53                   	push   %ebx
+f010bd8c:	83 ec 1c             	sub    $0x1c,%esp
+f010bd8f:	89 c6                	mov    %eax,%esi
+f010bd91:	89 d7                	mov    %edx,%edi
+f010bd93:	89 cb                	mov    %ecx,%ebx
+f010bd95:	8b 41 08             	mov    0x8(%ecx),%eax
+f010bd98:	85 c0                	test   %eax,%eax
+f010bd9a:	75 17                	jne    f010bdb3 <pci_attach_match+0x2d>
+f010bd9c:	b8 00 00 00 00       	mov    $0x0,%eax
+f010bda1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010bda4:	5b                   	pop    %ebx
+f010bda5:	5e                   	pop    %esi
+f010bda6:	5f                   	pop    %edi
+f010bda7:	5d                   	pop    %ebp
+f010bda8:	c3                   	ret
+f010bda9:	83 c3 0c             	add    $0xc,%ebx
+f010bdac:	8b 43 08             	mov    0x8(%ebx),%eax
+f010bdaf:	85 c0                	test   %eax,%eax
+f010bdb1:	74 ee                	je     f010bda1 <pci_attach_match+0x1b>
+f010bdb3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f010bdb6:	39 33                	cmp    %esi,(%ebx)
+f010bdb8:	75 ef                	jne    f010bda9 <pci_attach_match+0x23>
+f010bdba:	39 7b 04             	cmp    %edi,0x4(%ebx)
+f010bdbd:	75 ea                	jne    f010bda9 <pci_attach_match+0x23>
+f010bdbf:	83 ec 0c             	sub    $0xc,%esp
+f010bdc2:	ff 75 08             	push   0x8(%ebp)
+f010bdc5:	ff d0                	call   *%eax
+f010bdc7:	83 c4 10             	add    $0x10,%esp
+f010bdca:	85 c0                	test   %eax,%eax
+f010bdcc:	7f d3                	jg     f010bda1 <pci_attach_match+0x1b>
+f010bdce:	79 d9                	jns    f010bda9 <pci_attach_match+0x23>
+f010bdd0:	83 ec 0c             	sub    $0xc,%esp
+f010bdd3:	50                   	push   %eax
+f010bdd4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010bdd7:	ff 70 08             	push   0x8(%eax)
+f010bdda:	57                   	push   %edi
+f010bddb:	56                   	push   %esi
+f010bddc:	68 44 f2 10 f0       	push   $0xf010f244
+f010bde1:	e8 21 9f ff ff       	call   f0105d07 <cprintf>
+f010bde6:	83 c4 20             	add    $0x20,%esp
+f010bde9:	eb be                	jmp    f010bda9 <pci_attach_match+0x23>
+
+f010bdeb <pci_conf1_set_addr>:
+f010bdeb:	55                   	push   %ebp
+f010bdec:	89 e5                	mov    %esp,%ebp
+f010bdee:	56                   	push   %esi
+f010bdef:	53                   	push   %ebx
+f010bdf0:	8b 75 08             	mov    0x8(%ebp),%esi
+f010bdf3:	3d ff 00 00 00       	cmp    $0xff,%eax
+f010bdf8:	77 3b                	ja     f010be35 <pci_conf1_set_addr+0x4a>
+f010bdfa:	83 fa 1f             	cmp    $0x1f,%edx
+f010bdfd:	77 4c                	ja     f010be4b <pci_conf1_set_addr+0x60>
+f010bdff:	83 f9 07             	cmp    $0x7,%ecx
+f010be02:	77 5d                	ja     f010be61 <pci_conf1_set_addr+0x76>
+f010be04:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+f010be0a:	77 6b                	ja     f010be77 <pci_conf1_set_addr+0x8c>
+f010be0c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f010be12:	75 79                	jne    f010be8d <pci_conf1_set_addr+0xa2>
+f010be14:	c1 e0 10             	shl    $0x10,%eax
+f010be17:	09 f0                	or     %esi,%eax
+f010be19:	c1 e1 08             	shl    $0x8,%ecx
+f010be1c:	09 c8                	or     %ecx,%eax
+f010be1e:	c1 e2 0b             	shl    $0xb,%edx
+f010be21:	09 d0                	or     %edx,%eax
+f010be23:	0d 00 00 00 80       	or     $0x80000000,%eax
+f010be28:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f010be2d:	ef                   	out    %eax,(%dx)
+f010be2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010be31:	5b                   	pop    %ebx
+f010be32:	5e                   	pop    %esi
+f010be33:	5d                   	pop    %ebp
+f010be34:	c3                   	ret
+f010be35:	68 9b f3 10 f0       	push   $0xf010f39b
+f010be3a:	68 0d e2 10 f0       	push   $0xf010e20d
+f010be3f:	6a 2b                	push   $0x2b
+f010be41:	68 a5 f3 10 f0       	push   $0xf010f3a5
+f010be46:	e8 f5 41 ff ff       	call   f0100040 <_panic>
+f010be4b:	68 b0 f3 10 f0       	push   $0xf010f3b0
+f010be50:	68 0d e2 10 f0       	push   $0xf010e20d
+f010be55:	6a 2c                	push   $0x2c
+f010be57:	68 a5 f3 10 f0       	push   $0xf010f3a5
+f010be5c:	e8 df 41 ff ff       	call   f0100040 <_panic>
+f010be61:	68 b9 f3 10 f0       	push   $0xf010f3b9
+f010be66:	68 0d e2 10 f0       	push   $0xf010e20d
+f010be6b:	6a 2d                	push   $0x2d
+f010be6d:	68 a5 f3 10 f0       	push   $0xf010f3a5
+f010be72:	e8 c9 41 ff ff       	call   f0100040 <_panic>
+f010be77:	68 c2 f3 10 f0       	push   $0xf010f3c2
+f010be7c:	68 0d e2 10 f0       	push   $0xf010e20d
+f010be81:	6a 2e                	push   $0x2e
+f010be83:	68 a5 f3 10 f0       	push   $0xf010f3a5
+f010be88:	e8 b3 41 ff ff       	call   f0100040 <_panic>
+f010be8d:	68 cf f3 10 f0       	push   $0xf010f3cf
+f010be92:	68 0d e2 10 f0       	push   $0xf010e20d
+f010be97:	6a 2f                	push   $0x2f
+f010be99:	68 a5 f3 10 f0       	push   $0xf010f3a5
+f010be9e:	e8 9d 41 ff ff       	call   f0100040 <_panic>
+
+f010bea3 <pci_conf_read>:
+f010bea3:	55                   	push   %ebp
+f010bea4:	89 e5                	mov    %esp,%ebp
+f010bea6:	53                   	push   %ebx
+f010bea7:	83 ec 10             	sub    $0x10,%esp
+f010beaa:	89 d3                	mov    %edx,%ebx
+f010beac:	8b 48 08             	mov    0x8(%eax),%ecx
+f010beaf:	8b 50 04             	mov    0x4(%eax),%edx
+f010beb2:	8b 00                	mov    (%eax),%eax
+f010beb4:	8b 40 04             	mov    0x4(%eax),%eax
+f010beb7:	53                   	push   %ebx
+f010beb8:	e8 2e ff ff ff       	call   f010bdeb <pci_conf1_set_addr>
+f010bebd:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010bec2:	ed                   	in     (%dx),%eax
+f010bec3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010bec6:	c9                   	leave
+f010bec7:	c3                   	ret
+
+f010bec8 <pci_scan_bus>:
+f010bec8:	55                   	push   %ebp
+f010bec9:	89 e5                	mov    %esp,%ebp
+f010becb:	57                   	push   %edi
+f010becc:	56                   	push   %esi
+f010becd:	53                   	push   %ebx
+f010bece:	81 ec 00 01 00 00    	sub    $0x100,%esp
+f010bed4:	89 c3                	mov    %eax,%ebx
+f010bed6:	6a 48                	push   $0x48
+f010bed8:	6a 00                	push   $0x0
+f010beda:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010bedd:	50                   	push   %eax
+f010bede:	e8 11 ea ff ff       	call   f010a8f4 <memset>
+f010bee3:	89 5d a0             	mov    %ebx,-0x60(%ebp)
+f010bee6:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+f010beed:	83 c4 10             	add    $0x10,%esp
+f010bef0:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f010bef7:	00 00 00 
+f010befa:	e9 46 01 00 00       	jmp    f010c045 <pci_scan_bus+0x17d>
+f010beff:	83 ec 08             	sub    $0x8,%esp
+f010bf02:	89 fa                	mov    %edi,%edx
+f010bf04:	0f b6 fa             	movzbl %dl,%edi
+f010bf07:	57                   	push   %edi
+f010bf08:	51                   	push   %ecx
+f010bf09:	c1 e8 10             	shr    $0x10,%eax
+f010bf0c:	0f b6 c0             	movzbl %al,%eax
+f010bf0f:	50                   	push   %eax
+f010bf10:	ff b5 00 ff ff ff    	push   -0x100(%ebp)
+f010bf16:	c1 ee 10             	shr    $0x10,%esi
+f010bf19:	56                   	push   %esi
+f010bf1a:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+f010bf20:	53                   	push   %ebx
+f010bf21:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+f010bf27:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f010bf2d:	ff 70 04             	push   0x4(%eax)
+f010bf30:	68 70 f2 10 f0       	push   $0xf010f270
+f010bf35:	e8 cd 9d ff ff       	call   f0105d07 <cprintf>
+f010bf3a:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+f010bf40:	83 c4 24             	add    $0x24,%esp
+f010bf43:	89 c2                	mov    %eax,%edx
+f010bf45:	c1 ea 10             	shr    $0x10,%edx
+f010bf48:	0f b6 d2             	movzbl %dl,%edx
+f010bf4b:	c1 e8 18             	shr    $0x18,%eax
+f010bf4e:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+f010bf54:	51                   	push   %ecx
+f010bf55:	b9 ec a3 11 f0       	mov    $0xf011a3ec,%ecx
+f010bf5a:	e8 27 fe ff ff       	call   f010bd86 <pci_attach_match>
+f010bf5f:	83 c4 10             	add    $0x10,%esp
+f010bf62:	85 c0                	test   %eax,%eax
+f010bf64:	0f 84 a3 00 00 00    	je     f010c00d <pci_scan_bus+0x145>
+f010bf6a:	83 c3 01             	add    $0x1,%ebx
+f010bf6d:	89 9d 18 ff ff ff    	mov    %ebx,-0xe8(%ebp)
+f010bf73:	8b 85 fc fe ff ff    	mov    -0x104(%ebp),%eax
+f010bf79:	39 c3                	cmp    %eax,%ebx
+f010bf7b:	0f 83 b6 00 00 00    	jae    f010c037 <pci_scan_bus+0x16f>
+f010bf81:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010bf87:	8d b5 10 ff ff ff    	lea    -0xf0(%ebp),%esi
+f010bf8d:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010bf92:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010bf94:	ba 00 00 00 00       	mov    $0x0,%edx
+f010bf99:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+f010bf9f:	e8 ff fe ff ff       	call   f010bea3 <pci_conf_read>
+f010bfa4:	89 c6                	mov    %eax,%esi
+f010bfa6:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+f010bfac:	0f b7 c0             	movzwl %ax,%eax
+f010bfaf:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+f010bfb5:	66 83 fe ff          	cmp    $0xffff,%si
+f010bfb9:	74 af                	je     f010bf6a <pci_scan_bus+0xa2>
+f010bfbb:	ba 3c 00 00 00       	mov    $0x3c,%edx
+f010bfc0:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010bfc6:	e8 d8 fe ff ff       	call   f010bea3 <pci_conf_read>
+f010bfcb:	89 c7                	mov    %eax,%edi
+f010bfcd:	88 45 9c             	mov    %al,-0x64(%ebp)
+f010bfd0:	ba 08 00 00 00       	mov    $0x8,%edx
+f010bfd5:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010bfdb:	e8 c3 fe ff ff       	call   f010bea3 <pci_conf_read>
+f010bfe0:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+f010bfe6:	89 c2                	mov    %eax,%edx
+f010bfe8:	c1 ea 18             	shr    $0x18,%edx
+f010bfeb:	89 95 00 ff ff ff    	mov    %edx,-0x100(%ebp)
+f010bff1:	b9 e3 f3 10 f0       	mov    $0xf010f3e3,%ecx
+f010bff6:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+f010bffb:	0f 87 fe fe ff ff    	ja     f010beff <pci_scan_bus+0x37>
+f010c001:	8b 0c 95 58 f4 10 f0 	mov    -0xfef0ba8(,%edx,4),%ecx
+f010c008:	e9 f2 fe ff ff       	jmp    f010beff <pci_scan_bus+0x37>
+f010c00d:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+f010c013:	89 c2                	mov    %eax,%edx
+f010c015:	c1 ea 10             	shr    $0x10,%edx
+f010c018:	0f b7 c0             	movzwl %ax,%eax
+f010c01b:	83 ec 0c             	sub    $0xc,%esp
+f010c01e:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010c024:	57                   	push   %edi
+f010c025:	b9 d4 a3 11 f0       	mov    $0xf011a3d4,%ecx
+f010c02a:	e8 57 fd ff ff       	call   f010bd86 <pci_attach_match>
+f010c02f:	83 c4 10             	add    $0x10,%esp
+f010c032:	e9 33 ff ff ff       	jmp    f010bf6a <pci_scan_bus+0xa2>
+f010c037:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010c03a:	83 c0 01             	add    $0x1,%eax
+f010c03d:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f010c040:	83 f8 1f             	cmp    $0x1f,%eax
+f010c043:	77 4b                	ja     f010c090 <pci_scan_bus+0x1c8>
+f010c045:	ba 0c 00 00 00       	mov    $0xc,%edx
+f010c04a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010c04d:	e8 51 fe ff ff       	call   f010bea3 <pci_conf_read>
+f010c052:	89 c2                	mov    %eax,%edx
+f010c054:	c1 ea 10             	shr    $0x10,%edx
+f010c057:	89 d3                	mov    %edx,%ebx
+f010c059:	83 e3 7e             	and    $0x7e,%ebx
+f010c05c:	75 d9                	jne    f010c037 <pci_scan_bus+0x16f>
+f010c05e:	83 85 f8 fe ff ff 01 	addl   $0x1,-0x108(%ebp)
+f010c065:	8d bd 10 ff ff ff    	lea    -0xf0(%ebp),%edi
+f010c06b:	8d 75 a0             	lea    -0x60(%ebp),%esi
+f010c06e:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010c073:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f010c075:	25 00 00 80 00       	and    $0x800000,%eax
+f010c07a:	83 f8 01             	cmp    $0x1,%eax
+f010c07d:	19 c0                	sbb    %eax,%eax
+f010c07f:	83 e0 f9             	and    $0xfffffff9,%eax
+f010c082:	83 c0 08             	add    $0x8,%eax
+f010c085:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+f010c08b:	e9 dd fe ff ff       	jmp    f010bf6d <pci_scan_bus+0xa5>
+f010c090:	8b 85 f8 fe ff ff    	mov    -0x108(%ebp),%eax
+f010c096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010c099:	5b                   	pop    %ebx
+f010c09a:	5e                   	pop    %esi
+f010c09b:	5f                   	pop    %edi
+f010c09c:	5d                   	pop    %ebp
+f010c09d:	c3                   	ret
+
+f010c09e <pci_bridge_attach>:
+f010c09e:	55                   	push   %ebp
+f010c09f:	89 e5                	mov    %esp,%ebp
+f010c0a1:	57                   	push   %edi
+f010c0a2:	56                   	push   %esi
+f010c0a3:	53                   	push   %ebx
+f010c0a4:	83 ec 1c             	sub    $0x1c,%esp
+f010c0a7:	8b 75 08             	mov    0x8(%ebp),%esi
+f010c0aa:	ba 1c 00 00 00       	mov    $0x1c,%edx
+f010c0af:	89 f0                	mov    %esi,%eax
+f010c0b1:	e8 ed fd ff ff       	call   f010bea3 <pci_conf_read>
+f010c0b6:	89 c7                	mov    %eax,%edi
+f010c0b8:	ba 18 00 00 00       	mov    $0x18,%edx
+f010c0bd:	89 f0                	mov    %esi,%eax
+f010c0bf:	e8 df fd ff ff       	call   f010bea3 <pci_conf_read>
+f010c0c4:	83 e7 0f             	and    $0xf,%edi
+f010c0c7:	83 ff 01             	cmp    $0x1,%edi
+f010c0ca:	74 52                	je     f010c11e <pci_bridge_attach+0x80>
+f010c0cc:	89 c3                	mov    %eax,%ebx
+f010c0ce:	83 ec 04             	sub    $0x4,%esp
+f010c0d1:	6a 08                	push   $0x8
+f010c0d3:	6a 00                	push   $0x0
+f010c0d5:	8d 7d e0             	lea    -0x20(%ebp),%edi
+f010c0d8:	57                   	push   %edi
+f010c0d9:	e8 16 e8 ff ff       	call   f010a8f4 <memset>
+f010c0de:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f010c0e1:	0f b6 c7             	movzbl %bh,%eax
+f010c0e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010c0e7:	83 c4 08             	add    $0x8,%esp
+f010c0ea:	c1 eb 10             	shr    $0x10,%ebx
+f010c0ed:	0f b6 db             	movzbl %bl,%ebx
+f010c0f0:	53                   	push   %ebx
+f010c0f1:	50                   	push   %eax
+f010c0f2:	ff 76 08             	push   0x8(%esi)
+f010c0f5:	ff 76 04             	push   0x4(%esi)
+f010c0f8:	8b 06                	mov    (%esi),%eax
+f010c0fa:	ff 70 04             	push   0x4(%eax)
+f010c0fd:	68 e0 f2 10 f0       	push   $0xf010f2e0
+f010c102:	e8 00 9c ff ff       	call   f0105d07 <cprintf>
+f010c107:	83 c4 20             	add    $0x20,%esp
+f010c10a:	89 f8                	mov    %edi,%eax
+f010c10c:	e8 b7 fd ff ff       	call   f010bec8 <pci_scan_bus>
+f010c111:	b8 01 00 00 00       	mov    $0x1,%eax
+f010c116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010c119:	5b                   	pop    %ebx
+f010c11a:	5e                   	pop    %esi
+f010c11b:	5f                   	pop    %edi
+f010c11c:	5d                   	pop    %ebp
+f010c11d:	c3                   	ret
+f010c11e:	ff 76 08             	push   0x8(%esi)
+f010c121:	ff 76 04             	push   0x4(%esi)
+f010c124:	8b 06                	mov    (%esi),%eax
+f010c126:	ff 70 04             	push   0x4(%eax)
+f010c129:	68 ac f2 10 f0       	push   $0xf010f2ac
+f010c12e:	e8 d4 9b ff ff       	call   f0105d07 <cprintf>
+f010c133:	83 c4 10             	add    $0x10,%esp
+f010c136:	b8 00 00 00 00       	mov    $0x0,%eax
+f010c13b:	eb d9                	jmp    f010c116 <pci_bridge_attach+0x78>
+
+f010c13d <pci_conf_write>:
+f010c13d:	55                   	push   %ebp
+f010c13e:	89 e5                	mov    %esp,%ebp
+f010c140:	57                   	push   %edi
+f010c141:	56                   	push   %esi
+f010c142:	53                   	push   %ebx
+f010c143:	83 ec 18             	sub    $0x18,%esp
+f010c146:	89 d7                	mov    %edx,%edi
+f010c148:	89 ce                	mov    %ecx,%esi
+f010c14a:	8b 48 08             	mov    0x8(%eax),%ecx
+f010c14d:	8b 50 04             	mov    0x4(%eax),%edx
+f010c150:	8b 00                	mov    (%eax),%eax
+f010c152:	8b 40 04             	mov    0x4(%eax),%eax
+f010c155:	57                   	push   %edi
+f010c156:	e8 90 fc ff ff       	call   f010bdeb <pci_conf1_set_addr>
+f010c15b:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010c160:	89 f0                	mov    %esi,%eax
+f010c162:	ef                   	out    %eax,(%dx)
+f010c163:	83 c4 10             	add    $0x10,%esp
+f010c166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010c169:	5b                   	pop    %ebx
+f010c16a:	5e                   	pop    %esi
+f010c16b:	5f                   	pop    %edi
+f010c16c:	5d                   	pop    %ebp
+f010c16d:	c3                   	ret
+
+f010c16e <pci_func_enable>:
+f010c16e:	55                   	push   %ebp
+f010c16f:	89 e5                	mov    %esp,%ebp
+f010c171:	57                   	push   %edi
+f010c172:	56                   	push   %esi
+f010c173:	53                   	push   %ebx
+f010c174:	83 ec 1c             	sub    $0x1c,%esp
+f010c177:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010c17a:	b9 07 00 00 00       	mov    $0x7,%ecx
+f010c17f:	ba 04 00 00 00       	mov    $0x4,%edx
+f010c184:	89 f8                	mov    %edi,%eax
+f010c186:	e8 b2 ff ff ff       	call   f010c13d <pci_conf_write>
+f010c18b:	be 10 00 00 00       	mov    $0x10,%esi
+f010c190:	eb 29                	jmp    f010c1bb <pci_func_enable+0x4d>
+f010c192:	89 d8                	mov    %ebx,%eax
+f010c194:	83 e0 fc             	and    $0xfffffffc,%eax
+f010c197:	f7 d8                	neg    %eax
+f010c199:	21 c3                	and    %eax,%ebx
+f010c19b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010c19e:	83 e0 fc             	and    $0xfffffffc,%eax
+f010c1a1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010c1a4:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+f010c1ab:	eb 7a                	jmp    f010c227 <pci_func_enable+0xb9>
+f010c1ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010c1b0:	01 c6                	add    %eax,%esi
+f010c1b2:	83 fe 27             	cmp    $0x27,%esi
+f010c1b5:	0f 87 c7 00 00 00    	ja     f010c282 <pci_func_enable+0x114>
+f010c1bb:	89 f2                	mov    %esi,%edx
+f010c1bd:	89 f8                	mov    %edi,%eax
+f010c1bf:	e8 df fc ff ff       	call   f010bea3 <pci_conf_read>
+f010c1c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010c1c7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f010c1cc:	89 f2                	mov    %esi,%edx
+f010c1ce:	89 f8                	mov    %edi,%eax
+f010c1d0:	e8 68 ff ff ff       	call   f010c13d <pci_conf_write>
+f010c1d5:	89 f2                	mov    %esi,%edx
+f010c1d7:	89 f8                	mov    %edi,%eax
+f010c1d9:	e8 c5 fc ff ff       	call   f010bea3 <pci_conf_read>
+f010c1de:	89 c3                	mov    %eax,%ebx
+f010c1e0:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+f010c1e7:	85 c0                	test   %eax,%eax
+f010c1e9:	74 c2                	je     f010c1ad <pci_func_enable+0x3f>
+f010c1eb:	8d 46 f0             	lea    -0x10(%esi),%eax
+f010c1ee:	89 c2                	mov    %eax,%edx
+f010c1f0:	c1 ea 02             	shr    $0x2,%edx
+f010c1f3:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f010c1f6:	f6 c3 01             	test   $0x1,%bl
+f010c1f9:	75 97                	jne    f010c192 <pci_func_enable+0x24>
+f010c1fb:	89 da                	mov    %ebx,%edx
+f010c1fd:	83 e2 06             	and    $0x6,%edx
+f010c200:	83 fa 04             	cmp    $0x4,%edx
+f010c203:	0f 94 c1             	sete   %cl
+f010c206:	0f b6 c9             	movzbl %cl,%ecx
+f010c209:	8d 14 8d 04 00 00 00 	lea    0x4(,%ecx,4),%edx
+f010c210:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010c213:	89 da                	mov    %ebx,%edx
+f010c215:	83 e2 f0             	and    $0xfffffff0,%edx
+f010c218:	89 d0                	mov    %edx,%eax
+f010c21a:	f7 d8                	neg    %eax
+f010c21c:	21 c3                	and    %eax,%ebx
+f010c21e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010c221:	83 e0 f0             	and    $0xfffffff0,%eax
+f010c224:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010c227:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010c22a:	89 f2                	mov    %esi,%edx
+f010c22c:	89 f8                	mov    %edi,%eax
+f010c22e:	e8 0a ff ff ff       	call   f010c13d <pci_conf_write>
+f010c233:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010c236:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010c239:	89 44 8f 14          	mov    %eax,0x14(%edi,%ecx,4)
+f010c23d:	89 5c 8f 2c          	mov    %ebx,0x2c(%edi,%ecx,4)
+f010c241:	85 db                	test   %ebx,%ebx
+f010c243:	0f 84 64 ff ff ff    	je     f010c1ad <pci_func_enable+0x3f>
+f010c249:	85 c0                	test   %eax,%eax
+f010c24b:	0f 85 5c ff ff ff    	jne    f010c1ad <pci_func_enable+0x3f>
+f010c251:	8b 47 0c             	mov    0xc(%edi),%eax
+f010c254:	83 ec 0c             	sub    $0xc,%esp
+f010c257:	53                   	push   %ebx
+f010c258:	6a 00                	push   $0x0
+f010c25a:	51                   	push   %ecx
+f010c25b:	89 c2                	mov    %eax,%edx
+f010c25d:	c1 ea 10             	shr    $0x10,%edx
+f010c260:	52                   	push   %edx
+f010c261:	0f b7 c0             	movzwl %ax,%eax
+f010c264:	50                   	push   %eax
+f010c265:	ff 77 08             	push   0x8(%edi)
+f010c268:	ff 77 04             	push   0x4(%edi)
+f010c26b:	8b 07                	mov    (%edi),%eax
+f010c26d:	ff 70 04             	push   0x4(%eax)
+f010c270:	68 10 f3 10 f0       	push   $0xf010f310
+f010c275:	e8 8d 9a ff ff       	call   f0105d07 <cprintf>
+f010c27a:	83 c4 30             	add    $0x30,%esp
+f010c27d:	e9 2b ff ff ff       	jmp    f010c1ad <pci_func_enable+0x3f>
+f010c282:	8b 47 0c             	mov    0xc(%edi),%eax
+f010c285:	83 ec 08             	sub    $0x8,%esp
+f010c288:	89 c2                	mov    %eax,%edx
+f010c28a:	c1 ea 10             	shr    $0x10,%edx
+f010c28d:	52                   	push   %edx
+f010c28e:	0f b7 c0             	movzwl %ax,%eax
+f010c291:	50                   	push   %eax
+f010c292:	ff 77 08             	push   0x8(%edi)
+f010c295:	ff 77 04             	push   0x4(%edi)
+f010c298:	8b 07                	mov    (%edi),%eax
+f010c29a:	ff 70 04             	push   0x4(%eax)
+f010c29d:	68 6c f3 10 f0       	push   $0xf010f36c
+f010c2a2:	e8 60 9a ff ff       	call   f0105d07 <cprintf>
+f010c2a7:	83 c4 20             	add    $0x20,%esp
+f010c2aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010c2ad:	5b                   	pop    %ebx
+f010c2ae:	5e                   	pop    %esi
+f010c2af:	5f                   	pop    %edi
+f010c2b0:	5d                   	pop    %ebp
+f010c2b1:	c3                   	ret
+
+f010c2b2 <pci_init>:
+f010c2b2:	55                   	push   %ebp
+f010c2b3:	89 e5                	mov    %esp,%ebp
+f010c2b5:	83 ec 0c             	sub    $0xc,%esp
+f010c2b8:	6a 08                	push   $0x8
+f010c2ba:	6a 00                	push   $0x0
+f010c2bc:	68 e8 63 2b f0       	push   $0xf02b63e8
+f010c2c1:	e8 2e e6 ff ff       	call   f010a8f4 <memset>
+f010c2c6:	b8 e8 63 2b f0       	mov    $0xf02b63e8,%eax
+f010c2cb:	e8 f8 fb ff ff       	call   f010bec8 <pci_scan_bus>
+f010c2d0:	c9                   	leave
+f010c2d1:	c3                   	ret
+
+f010c2d2 <time_init>:
+f010c2d2:	55                   	push   %ebp
+f010c2d3:	89 e5                	mov    %esp,%ebp
+f010c2d5:	57                   	push   %edi
+f010c2d6:	56                   	push   %esi
+f010c2d7:	53                   	push   %ebx
+f010c2d8:	83 ec 28             	sub    $0x28,%esp
+f010c2db:	c7 05 00 64 2b f0 00 	movl   $0x0,0xf02b6400
+f010c2e2:	00 00 00 
+f010c2e5:	0f 31                	rdtsc
+f010c2e7:	89 c6                	mov    %eax,%esi
+f010c2e9:	89 d7                	mov    %edx,%edi
+f010c2eb:	6a 0a                	push   $0xa
+f010c2ed:	e8 62 98 ff ff       	call   f0105b54 <pit_delay>
+f010c2f2:	0f 31                	rdtsc
+f010c2f4:	a3 f8 63 2b f0       	mov    %eax,0xf02b63f8
+f010c2f9:	89 15 fc 63 2b f0    	mov    %edx,0xf02b63fc
+f010c2ff:	29 f0                	sub    %esi,%eax
+f010c301:	19 fa                	sbb    %edi,%edx
+f010c303:	89 c1                	mov    %eax,%ecx
+f010c305:	89 d3                	mov    %edx,%ebx
+f010c307:	83 c4 10             	add    $0x10,%esp
+f010c30a:	89 c7                	mov    %eax,%edi
+f010c30c:	01 d7                	add    %edx,%edi
+f010c30e:	83 d7 00             	adc    $0x0,%edi
+f010c311:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+f010c316:	89 f8                	mov    %edi,%eax
+f010c318:	f7 e6                	mul    %esi
+f010c31a:	89 d0                	mov    %edx,%eax
+f010c31c:	c1 e8 02             	shr    $0x2,%eax
+f010c31f:	83 e2 fc             	and    $0xfffffffc,%edx
+f010c322:	01 c2                	add    %eax,%edx
+f010c324:	29 d7                	sub    %edx,%edi
+f010c326:	ba 00 00 00 00       	mov    $0x0,%edx
+f010c32b:	29 f9                	sub    %edi,%ecx
+f010c32d:	19 d3                	sbb    %edx,%ebx
+f010c32f:	89 da                	mov    %ebx,%edx
+f010c331:	69 db cd cc cc cc    	imul   $0xcccccccd,%ebx,%ebx
+f010c337:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f010c33a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010c33d:	69 45 e0 cc cc cc cc 	imul   $0xcccccccc,-0x20(%ebp),%eax
+f010c344:	01 c3                	add    %eax,%ebx
+f010c346:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010c349:	f7 e6                	mul    %esi
+f010c34b:	01 da                	add    %ebx,%edx
+f010c34d:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+f010c351:	d1 ea                	shr    %edx
+f010c353:	a3 f0 63 2b f0       	mov    %eax,0xf02b63f0
+f010c358:	85 c0                	test   %eax,%eax
+f010c35a:	74 3e                	je     f010c39a <time_init+0xc8>
+f010c35c:	83 ec 08             	sub    $0x8,%esp
+f010c35f:	50                   	push   %eax
+f010c360:	68 74 f4 10 f0       	push   $0xf010f474
+f010c365:	e8 9d 99 ff ff       	call   f0105d07 <cprintf>
+f010c36a:	83 c4 10             	add    $0x10,%esp
+f010c36d:	8b 0d a0 b4 32 f0    	mov    0xf032b4a0,%ecx
+f010c373:	a1 f8 63 2b f0       	mov    0xf02b63f8,%eax
+f010c378:	8b 15 fc 63 2b f0    	mov    0xf02b63fc,%edx
+f010c37e:	89 01                	mov    %eax,(%ecx)
+f010c380:	89 51 04             	mov    %edx,0x4(%ecx)
+f010c383:	a1 f0 63 2b f0       	mov    0xf02b63f0,%eax
+f010c388:	89 41 08             	mov    %eax,0x8(%ecx)
+f010c38b:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+f010c392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010c395:	5b                   	pop    %ebx
+f010c396:	5e                   	pop    %esi
+f010c397:	5f                   	pop    %edi
+f010c398:	5d                   	pop    %ebp
+f010c399:	c3                   	ret
+f010c39a:	83 ec 0c             	sub    $0xc,%esp
+f010c39d:	68 a8 f4 10 f0       	push   $0xf010f4a8
+f010c3a2:	e8 60 99 ff ff       	call   f0105d07 <cprintf>
+f010c3a7:	83 c4 10             	add    $0x10,%esp
+f010c3aa:	eb c1                	jmp    f010c36d <time_init+0x9b>
+
+f010c3ac <time_msec>:
+f010c3ac:	8b 0d f0 63 2b f0    	mov    0xf02b63f0,%ecx
+f010c3b2:	85 c9                	test   %ecx,%ecx
+f010c3b4:	75 0b                	jne    f010c3c1 <time_msec+0x15>
+f010c3b6:	a1 00 64 2b f0       	mov    0xf02b6400,%eax
+f010c3bb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010c3be:	01 c0                	add    %eax,%eax
+f010c3c0:	c3                   	ret
+f010c3c1:	55                   	push   %ebp
+f010c3c2:	89 e5                	mov    %esp,%ebp
+f010c3c4:	53                   	push   %ebx
+f010c3c5:	83 ec 04             	sub    $0x4,%esp
+f010c3c8:	0f 31                	rdtsc
+f010c3ca:	2b 05 f8 63 2b f0    	sub    0xf02b63f8,%eax
+f010c3d0:	1b 15 fc 63 2b f0    	sbb    0xf02b63fc,%edx
+f010c3d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010c3db:	53                   	push   %ebx
+f010c3dc:	51                   	push   %ecx
+f010c3dd:	52                   	push   %edx
+f010c3de:	50                   	push   %eax
+f010c3df:	e8 fb 0a 00 00       	call   f010cedf <__udivdi3>
+f010c3e4:	83 c4 10             	add    $0x10,%esp
+f010c3e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010c3ea:	c9                   	leave
+f010c3eb:	c3                   	ret
+
+f010c3ec <time_tick>:
+f010c3ec:	55                   	push   %ebp
+f010c3ed:	89 e5                	mov    %esp,%ebp
+f010c3ef:	53                   	push   %ebx
+f010c3f0:	83 ec 04             	sub    $0x4,%esp
+f010c3f3:	e8 59 eb ff ff       	call   f010af51 <cpunum>
+f010c3f8:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010c3fe:	05 20 20 2d f0       	add    $0xf02d2020,%eax
+f010c403:	39 05 c0 24 2d f0    	cmp    %eax,0xf02d24c0
+f010c409:	74 05                	je     f010c410 <time_tick+0x24>
+f010c40b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010c40e:	c9                   	leave
+f010c40f:	c3                   	ret
+f010c410:	a1 00 64 2b f0       	mov    0xf02b6400,%eax
+f010c415:	83 c0 01             	add    $0x1,%eax
+f010c418:	a3 00 64 2b f0       	mov    %eax,0xf02b6400
+f010c41d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f010c420:	01 d2                	add    %edx,%edx
+f010c422:	39 c2                	cmp    %eax,%edx
+f010c424:	72 10                	jb     f010c436 <time_tick+0x4a>
+f010c426:	8b 1d a0 b4 32 f0    	mov    0xf032b4a0,%ebx
+f010c42c:	e8 7b ff ff ff       	call   f010c3ac <time_msec>
+f010c431:	89 43 0c             	mov    %eax,0xc(%ebx)
+f010c434:	eb d5                	jmp    f010c40b <time_tick+0x1f>
+f010c436:	83 ec 04             	sub    $0x4,%esp
+f010c439:	68 81 f4 10 f0       	push   $0xf010f481
+f010c43e:	6a 32                	push   $0x32
+f010c440:	68 9c f4 10 f0       	push   $0xf010f49c
+f010c445:	e8 f6 3b ff ff       	call   f0100040 <_panic>
+
+f010c44a <time_tsc_msec>:
+f010c44a:	55                   	push   %ebp
+f010c44b:	89 e5                	mov    %esp,%ebp
+f010c44d:	53                   	push   %ebx
+f010c44e:	83 ec 04             	sub    $0x4,%esp
+f010c451:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010c454:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010c457:	8b 55 10             	mov    0x10(%ebp),%edx
+f010c45a:	a1 f0 63 2b f0       	mov    0xf02b63f0,%eax
+f010c45f:	85 c0                	test   %eax,%eax
+f010c461:	75 0a                	jne    f010c46d <time_tsc_msec+0x23>
+f010c463:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f010c466:	01 c0                	add    %eax,%eax
+f010c468:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010c46b:	c9                   	leave
+f010c46c:	c3                   	ret
+f010c46d:	ba 00 00 00 00       	mov    $0x0,%edx
+f010c472:	52                   	push   %edx
+f010c473:	50                   	push   %eax
+f010c474:	53                   	push   %ebx
+f010c475:	51                   	push   %ecx
+f010c476:	e8 64 0a 00 00       	call   f010cedf <__udivdi3>
+f010c47b:	83 c4 10             	add    $0x10,%esp
+f010c47e:	eb e8                	jmp    f010c468 <time_tsc_msec+0x1e>
+
+f010c480 <time_tsc_calibrated>:
+f010c480:	83 3d f0 63 2b f0 00 	cmpl   $0x0,0xf02b63f0
+f010c487:	0f 95 c0             	setne  %al
+f010c48a:	0f b6 c0             	movzbl %al,%eax
+f010c48d:	c3                   	ret
+
+f010c48e <prof_symbolize>:
+f010c48e:	55                   	push   %ebp
+f010c48f:	89 e5                	mov    %esp,%ebp
+f010c491:	57                   	push   %edi
+f010c492:	56                   	push   %esi
+f010c493:	53                   	push   %ebx
+f010c494:	83 ec 3c             	sub    $0x3c,%esp
+f010c497:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f010c49a:	89 d3                	mov    %edx,%ebx
+f010c49c:	89 ce                	mov    %ecx,%esi
+f010c49e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+f010c4a5:	e8 a7 ea ff ff       	call   f010af51 <cpunum>
+f010c4aa:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010c4b0:	8b b8 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%edi
+f010c4b6:	0f 20 d8             	mov    %cr3,%eax
+f010c4b9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f010c4bc:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f010c4c2:	77 47                	ja     f010c50b <prof_symbolize+0x7d>
+f010c4c4:	83 ec 04             	sub    $0x4,%esp
+f010c4c7:	6a 00                	push   $0x0
+f010c4c9:	8d 45 cc             	lea    -0x34(%ebp),%eax
+f010c4cc:	50                   	push   %eax
+f010c4cd:	ff 75 c4             	push   -0x3c(%ebp)
+f010c4d0:	e8 8d 89 ff ff       	call   f0104e62 <envid2env>
+f010c4d5:	83 c4 10             	add    $0x10,%esp
+f010c4d8:	85 c0                	test   %eax,%eax
+f010c4da:	78 7e                	js     f010c55a <prof_symbolize+0xcc>
+f010c4dc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010c4df:	83 78 78 00          	cmpl   $0x0,0x78(%eax)
+f010c4e3:	74 75                	je     f010c55a <prof_symbolize+0xcc>
+f010c4e5:	e8 67 ea ff ff       	call   f010af51 <cpunum>
+f010c4ea:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f010c4ed:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010c4f3:	89 90 28 20 2d f0    	mov    %edx,-0xfd2dfd8(%eax)
+f010c4f9:	8b 42 78             	mov    0x78(%edx),%eax
+f010c4fc:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010c501:	76 6f                	jbe    f010c572 <prof_symbolize+0xe4>
+f010c503:	05 00 00 00 10       	add    $0x10000000,%eax
+f010c508:	0f 22 d8             	mov    %eax,%cr3
+f010c50b:	83 ec 08             	sub    $0x8,%esp
+f010c50e:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f010c511:	50                   	push   %eax
+f010c512:	53                   	push   %ebx
+f010c513:	e8 9d d7 ff ff       	call   f0109cb5 <debuginfo_eip>
+f010c518:	83 c4 04             	add    $0x4,%esp
+f010c51b:	ff 75 d8             	push   -0x28(%ebp)
+f010c51e:	ff 75 dc             	push   -0x24(%ebp)
+f010c521:	68 d2 d3 10 f0       	push   $0xf010d3d2
+f010c526:	ff 75 08             	push   0x8(%ebp)
+f010c529:	56                   	push   %esi
+f010c52a:	e8 f6 e0 ff ff       	call   f010a625 <snprintf>
+f010c52f:	83 c4 20             	add    $0x20,%esp
+f010c532:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+f010c536:	74 17                	je     f010c54f <prof_symbolize+0xc1>
+f010c538:	e8 14 ea ff ff       	call   f010af51 <cpunum>
+f010c53d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010c543:	89 b8 28 20 2d f0    	mov    %edi,-0xfd2dfd8(%eax)
+f010c549:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f010c54c:	0f 22 d8             	mov    %eax,%cr3
+f010c54f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010c552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010c555:	5b                   	pop    %ebx
+f010c556:	5e                   	pop    %esi
+f010c557:	5f                   	pop    %edi
+f010c558:	5d                   	pop    %ebp
+f010c559:	c3                   	ret
+f010c55a:	83 ec 04             	sub    $0x4,%esp
+f010c55d:	68 d4 f4 10 f0       	push   $0xf010f4d4
+f010c562:	ff 75 08             	push   0x8(%ebp)
+f010c565:	56                   	push   %esi
+f010c566:	e8 ba e0 ff ff       	call   f010a625 <snprintf>
+f010c56b:	83 c4 10             	add    $0x10,%esp
+f010c56e:	89 d8                	mov    %ebx,%eax
+f010c570:	eb e0                	jmp    f010c552 <prof_symbolize+0xc4>
+f010c572:	50                   	push   %eax
+f010c573:	68 48 d0 10 f0       	push   $0xf010d048
+f010c578:	6a 78                	push   $0x78
+f010c57a:	68 dd f4 10 f0       	push   $0xf010f4dd
+f010c57f:	e8 bc 3a ff ff       	call   f0100040 <_panic>
+
+f010c584 <prof_tick>:
+f010c584:	55                   	push   %ebp
+f010c585:	89 e5                	mov    %esp,%ebp
+f010c587:	57                   	push   %edi
+f010c588:	56                   	push   %esi
+f010c589:	53                   	push   %ebx
+f010c58a:	83 ec 1c             	sub    $0x1c,%esp
+f010c58d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010c590:	e8 bc e9 ff ff       	call   f010af51 <cpunum>
+f010c595:	83 3d 24 7a 2b f0 00 	cmpl   $0x0,0xf02b7a24
+f010c59c:	75 08                	jne    f010c5a6 <prof_tick+0x22>
+f010c59e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010c5a1:	5b                   	pop    %ebx
+f010c5a2:	5e                   	pop    %esi
+f010c5a3:	5f                   	pop    %edi
+f010c5a4:	5d                   	pop    %ebp
+f010c5a5:	c3                   	ret
+f010c5a6:	89 c6                	mov    %eax,%esi
+f010c5a8:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f010c5ac:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+f010c5b0:	69 c6 04 30 00 00    	imul   $0x3004,%esi,%eax
+f010c5b6:	8b b8 40 7a 2b f0    	mov    -0xfd485c0(%eax),%edi
+f010c5bc:	8d 57 01             	lea    0x1(%edi),%edx
+f010c5bf:	89 90 40 7a 2b f0    	mov    %edx,-0xfd485c0(%eax)
+f010c5c5:	81 e7 ff 01 00 00    	and    $0x1ff,%edi
+f010c5cb:	8b 4b 30             	mov    0x30(%ebx),%ecx
+f010c5ce:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+f010c5d1:	89 8c d0 44 7a 2b f0 	mov    %ecx,-0xfd485bc(%eax,%edx,8)
+f010c5d8:	e8 74 e9 ff ff       	call   f010af51 <cpunum>
+f010c5dd:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010c5e3:	ba 00 00 00 00       	mov    $0x0,%edx
+f010c5e8:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f010c5ef:	74 14                	je     f010c605 <prof_tick+0x81>
+f010c5f1:	e8 5b e9 ff ff       	call   f010af51 <cpunum>
+f010c5f6:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010c5fc:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010c602:	8b 50 48             	mov    0x48(%eax),%edx
+f010c605:	8d 04 3f             	lea    (%edi,%edi,1),%eax
+f010c608:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+f010c60b:	69 f6 04 30 00 00    	imul   $0x3004,%esi,%esi
+f010c611:	89 94 ce 48 7a 2b f0 	mov    %edx,-0xfd485b8(%esi,%ecx,8)
+f010c618:	89 cf                	mov    %ecx,%edi
+f010c61a:	c1 e7 03             	shl    $0x3,%edi
+f010c61d:	83 ec 04             	sub    $0x4,%esp
+f010c620:	6a 10                	push   $0x10
+f010c622:	6a 00                	push   $0x0
+f010c624:	8d 84 3e 4c 7a 2b f0 	lea    -0xfd485b4(%esi,%edi,1),%eax
+f010c62b:	50                   	push   %eax
+f010c62c:	e8 c3 e2 ff ff       	call   f010a8f4 <memset>
+f010c631:	8b 43 08             	mov    0x8(%ebx),%eax
+f010c634:	89 c3                	mov    %eax,%ebx
+f010c636:	83 c4 10             	add    $0x10,%esp
+f010c639:	83 3d 20 7a 2b f0 00 	cmpl   $0x0,0xf02b7a20
+f010c640:	0f 8e 58 ff ff ff    	jle    f010c59e <prof_tick+0x1a>
+f010c646:	85 c0                	test   %eax,%eax
+f010c648:	0f 84 50 ff ff ff    	je     f010c59e <prof_tick+0x1a>
+f010c64e:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+f010c652:	83 e0 03             	and    $0x3,%eax
+f010c655:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+f010c659:	01 f7                	add    %esi,%edi
+f010c65b:	be 00 00 00 00       	mov    $0x0,%esi
+f010c660:	eb 49                	jmp    f010c6ab <prof_tick+0x127>
+f010c662:	e8 ea e8 ff ff       	call   f010af51 <cpunum>
+f010c667:	6a 04                	push   $0x4
+f010c669:	6a 08                	push   $0x8
+f010c66b:	53                   	push   %ebx
+f010c66c:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010c672:	ff b0 28 20 2d f0    	push   -0xfd2dfd8(%eax)
+f010c678:	e8 2a 85 ff ff       	call   f0104ba7 <user_mem_check>
+f010c67d:	83 c4 10             	add    $0x10,%esp
+f010c680:	85 c0                	test   %eax,%eax
+f010c682:	0f 88 16 ff ff ff    	js     f010c59e <prof_tick+0x1a>
+f010c688:	8b 43 04             	mov    0x4(%ebx),%eax
+f010c68b:	89 84 b7 4c 7a 2b f0 	mov    %eax,-0xfd485b4(%edi,%esi,4)
+f010c692:	8b 1b                	mov    (%ebx),%ebx
+f010c694:	83 c6 01             	add    $0x1,%esi
+f010c697:	39 35 20 7a 2b f0    	cmp    %esi,0xf02b7a20
+f010c69d:	0f 8e fb fe ff ff    	jle    f010c59e <prof_tick+0x1a>
+f010c6a3:	85 db                	test   %ebx,%ebx
+f010c6a5:	0f 84 f3 fe ff ff    	je     f010c59e <prof_tick+0x1a>
+f010c6ab:	66 83 7d e6 03       	cmpw   $0x3,-0x1a(%ebp)
+f010c6b0:	74 b0                	je     f010c662 <prof_tick+0xde>
+f010c6b2:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f010c6b8:	77 ce                	ja     f010c688 <prof_tick+0x104>
+f010c6ba:	e9 df fe ff ff       	jmp    f010c59e <prof_tick+0x1a>
+
+f010c6bf <prof_ctl>:
+f010c6bf:	55                   	push   %ebp
+f010c6c0:	89 e5                	mov    %esp,%ebp
+f010c6c2:	8b 45 08             	mov    0x8(%ebp),%eax
+f010c6c5:	83 f8 01             	cmp    $0x1,%eax
+f010c6c8:	74 33                	je     f010c6fd <prof_ctl+0x3e>
+f010c6ca:	83 f8 02             	cmp    $0x2,%eax
+f010c6cd:	74 3f                	je     f010c70e <prof_ctl+0x4f>
+f010c6cf:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f010c6d4:	85 c0                	test   %eax,%eax
+f010c6d6:	74 04                	je     f010c6dc <prof_ctl+0x1d>
+f010c6d8:	89 d0                	mov    %edx,%eax
+f010c6da:	5d                   	pop    %ebp
+f010c6db:	c3                   	ret
+f010c6dc:	83 7d 0c 04          	cmpl   $0x4,0xc(%ebp)
+f010c6e0:	0f 87 82 00 00 00    	ja     f010c768 <prof_ctl+0xa9>
+f010c6e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010c6e9:	89 0d 20 7a 2b f0    	mov    %ecx,0xf02b7a20
+f010c6ef:	c7 05 24 7a 2b f0 01 	movl   $0x1,0xf02b7a24
+f010c6f6:	00 00 00 
+f010c6f9:	89 c2                	mov    %eax,%edx
+f010c6fb:	eb db                	jmp    f010c6d8 <prof_ctl+0x19>
+f010c6fd:	c7 05 24 7a 2b f0 00 	movl   $0x0,0xf02b7a24
+f010c704:	00 00 00 
+f010c707:	ba 00 00 00 00       	mov    $0x0,%edx
+f010c70c:	eb ca                	jmp    f010c6d8 <prof_ctl+0x19>
+f010c70e:	c7 05 40 7a 2b f0 00 	movl   $0x0,0xf02b7a40
+f010c715:	00 00 00 
+f010c718:	c7 05 44 aa 2b f0 00 	movl   $0x0,0xf02baa44
+f010c71f:	00 00 00 
+f010c722:	c7 05 48 da 2b f0 00 	movl   $0x0,0xf02bda48
+f010c729:	00 00 00 
+f010c72c:	c7 05 4c 0a 2c f0 00 	movl   $0x0,0xf02c0a4c
+f010c733:	00 00 00 
+f010c736:	c7 05 50 3a 2c f0 00 	movl   $0x0,0xf02c3a50
+f010c73d:	00 00 00 
+f010c740:	c7 05 54 6a 2c f0 00 	movl   $0x0,0xf02c6a54
+f010c747:	00 00 00 
+f010c74a:	c7 05 58 9a 2c f0 00 	movl   $0x0,0xf02c9a58
+f010c751:	00 00 00 
+f010c754:	c7 05 5c ca 2c f0 00 	movl   $0x0,0xf02cca5c
+f010c75b:	00 00 00 
+f010c75e:	ba 00 00 00 00       	mov    $0x0,%edx
+f010c763:	e9 70 ff ff ff       	jmp    f010c6d8 <prof_ctl+0x19>
+f010c768:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+f010c76d:	e9 66 ff ff ff       	jmp    f010c6d8 <prof_ctl+0x19>
+
+f010c772 <prof_report>:
+f010c772:	55                   	push   %ebp
+f010c773:	89 e5                	mov    %esp,%ebp
+f010c775:	57                   	push   %edi
+f010c776:	56                   	push   %esi
+f010c777:	53                   	push   %ebx
+f010c778:	83 ec 7c             	sub    $0x7c,%esp
+f010c77b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010c77e:	83 3d c4 24 2d f0 00 	cmpl   $0x0,0xf02d24c4
+f010c785:	0f 8e 7a 02 00 00    	jle    f010ca05 <prof_report+0x293>
+f010c78b:	be 40 7a 2b f0       	mov    $0xf02b7a40,%esi
+f010c790:	bf 00 00 00 00       	mov    $0x0,%edi
+f010c795:	b8 00 00 00 00       	mov    $0x0,%eax
+f010c79a:	e9 d2 00 00 00       	jmp    f010c871 <prof_report+0xff>
+f010c79f:	83 c3 01             	add    $0x1,%ebx
+f010c7a2:	83 c0 2c             	add    $0x2c,%eax
+f010c7a5:	39 fb                	cmp    %edi,%ebx
+f010c7a7:	74 67                	je     f010c810 <prof_report+0x9e>
+f010c7a9:	39 30                	cmp    %esi,(%eax)
+f010c7ab:	75 f2                	jne    f010c79f <prof_report+0x2d>
+f010c7ad:	39 50 04             	cmp    %edx,0x4(%eax)
+f010c7b0:	75 ed                	jne    f010c79f <prof_report+0x2d>
+f010c7b2:	39 fb                	cmp    %edi,%ebx
+f010c7b4:	74 5c                	je     f010c812 <prof_report+0xa0>
+f010c7b6:	6b db 2c             	imul   $0x2c,%ebx,%ebx
+f010c7b9:	83 83 28 64 2b f0 01 	addl   $0x1,-0xfd49bd8(%ebx)
+f010c7c0:	83 45 94 01          	addl   $0x1,-0x6c(%ebp)
+f010c7c4:	8b 45 94             	mov    -0x6c(%ebp),%eax
+f010c7c7:	83 45 90 18          	addl   $0x18,-0x70(%ebp)
+f010c7cb:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+f010c7ce:	39 c8                	cmp    %ecx,%eax
+f010c7d0:	0f 83 84 00 00 00    	jae    f010c85a <prof_report+0xe8>
+f010c7d6:	8b 45 90             	mov    -0x70(%ebp),%eax
+f010c7d9:	8b 50 04             	mov    0x4(%eax),%edx
+f010c7dc:	be 00 00 00 00       	mov    $0x0,%esi
+f010c7e1:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f010c7e7:	77 03                	ja     f010c7ec <prof_report+0x7a>
+f010c7e9:	8b 70 08             	mov    0x8(%eax),%esi
+f010c7ec:	83 ec 0c             	sub    $0xc,%esp
+f010c7ef:	6a 20                	push   $0x20
+f010c7f1:	8d 4d 9c             	lea    -0x64(%ebp),%ecx
+f010c7f4:	89 f0                	mov    %esi,%eax
+f010c7f6:	e8 93 fc ff ff       	call   f010c48e <prof_symbolize>
+f010c7fb:	89 c2                	mov    %eax,%edx
+f010c7fd:	83 c4 10             	add    $0x10,%esp
+f010c800:	85 ff                	test   %edi,%edi
+f010c802:	7e 4c                	jle    f010c850 <prof_report+0xde>
+f010c804:	b8 20 64 2b f0       	mov    $0xf02b6420,%eax
+f010c809:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010c80e:	eb 99                	jmp    f010c7a9 <prof_report+0x37>
+f010c810:	89 fb                	mov    %edi,%ebx
+f010c812:	81 ff 80 00 00 00    	cmp    $0x80,%edi
+f010c818:	74 a6                	je     f010c7c0 <prof_report+0x4e>
+f010c81a:	6b c3 2c             	imul   $0x2c,%ebx,%eax
+f010c81d:	89 b0 20 64 2b f0    	mov    %esi,-0xfd49be0(%eax)
+f010c823:	89 90 24 64 2b f0    	mov    %edx,-0xfd49bdc(%eax)
+f010c829:	c7 80 28 64 2b f0 00 	movl   $0x0,-0xfd49bd8(%eax)
+f010c830:	00 00 00 
+f010c833:	83 ec 08             	sub    $0x8,%esp
+f010c836:	8d 4d 9c             	lea    -0x64(%ebp),%ecx
+f010c839:	51                   	push   %ecx
+f010c83a:	05 2c 64 2b f0       	add    $0xf02b642c,%eax
+f010c83f:	50                   	push   %eax
+f010c840:	e8 34 df ff ff       	call   f010a779 <strcpy>
+f010c845:	83 c7 01             	add    $0x1,%edi
+f010c848:	83 c4 10             	add    $0x10,%esp
+f010c84b:	e9 66 ff ff ff       	jmp    f010c7b6 <prof_report+0x44>
+f010c850:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010c855:	e9 58 ff ff ff       	jmp    f010c7b2 <prof_report+0x40>
+f010c85a:	8b 45 88             	mov    -0x78(%ebp),%eax
+f010c85d:	8b 75 84             	mov    -0x7c(%ebp),%esi
+f010c860:	83 c0 01             	add    $0x1,%eax
+f010c863:	81 c6 04 30 00 00    	add    $0x3004,%esi
+f010c869:	39 05 c4 24 2d f0    	cmp    %eax,0xf02d24c4
+f010c86f:	7e 28                	jle    f010c899 <prof_report+0x127>
+f010c871:	8b 16                	mov    (%esi),%edx
+f010c873:	b9 00 02 00 00       	mov    $0x200,%ecx
+f010c878:	39 ca                	cmp    %ecx,%edx
+f010c87a:	0f 46 ca             	cmovbe %edx,%ecx
+f010c87d:	89 4d 8c             	mov    %ecx,-0x74(%ebp)
+f010c880:	85 d2                	test   %edx,%edx
+f010c882:	74 dc                	je     f010c860 <prof_report+0xee>
+f010c884:	89 75 90             	mov    %esi,-0x70(%ebp)
+f010c887:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+f010c88e:	89 45 88             	mov    %eax,-0x78(%ebp)
+f010c891:	89 75 84             	mov    %esi,-0x7c(%ebp)
+f010c894:	e9 3d ff ff ff       	jmp    f010c7d6 <prof_report+0x64>
+f010c899:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010c89c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+f010c89f:	83 ff 01             	cmp    $0x1,%edi
+f010c8a2:	0f 86 3a 01 00 00    	jbe    f010c9e2 <prof_report+0x270>
+f010c8a8:	b9 4c 64 2b f0       	mov    $0xf02b644c,%ecx
+f010c8ad:	b8 01 00 00 00       	mov    $0x1,%eax
+f010c8b2:	89 7d 90             	mov    %edi,-0x70(%ebp)
+f010c8b5:	89 c7                	mov    %eax,%edi
+f010c8b7:	eb 77                	jmp    f010c930 <prof_report+0x1be>
+f010c8b9:	6b db 2c             	imul   $0x2c,%ebx,%ebx
+f010c8bc:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f010c8bf:	89 93 20 64 2b f0    	mov    %edx,-0xfd49be0(%ebx)
+f010c8c5:	8b 55 c0             	mov    -0x40(%ebp),%edx
+f010c8c8:	89 93 24 64 2b f0    	mov    %edx,-0xfd49bdc(%ebx)
+f010c8ce:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f010c8d1:	89 93 28 64 2b f0    	mov    %edx,-0xfd49bd8(%ebx)
+f010c8d7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+f010c8da:	89 93 2c 64 2b f0    	mov    %edx,-0xfd49bd4(%ebx)
+f010c8e0:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f010c8e3:	89 93 30 64 2b f0    	mov    %edx,-0xfd49bd0(%ebx)
+f010c8e9:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f010c8ec:	89 93 34 64 2b f0    	mov    %edx,-0xfd49bcc(%ebx)
+f010c8f2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f010c8f5:	89 93 38 64 2b f0    	mov    %edx,-0xfd49bc8(%ebx)
+f010c8fb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f010c8fe:	89 93 3c 64 2b f0    	mov    %edx,-0xfd49bc4(%ebx)
+f010c904:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010c907:	89 93 40 64 2b f0    	mov    %edx,-0xfd49bc0(%ebx)
+f010c90d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f010c910:	89 93 44 64 2b f0    	mov    %edx,-0xfd49bbc(%ebx)
+f010c916:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010c919:	89 93 48 64 2b f0    	mov    %edx,-0xfd49bb8(%ebx)
+f010c91f:	83 c7 01             	add    $0x1,%edi
+f010c922:	83 c1 2c             	add    $0x2c,%ecx
+f010c925:	8b 45 94             	mov    -0x6c(%ebp),%eax
+f010c928:	39 c7                	cmp    %eax,%edi
+f010c92a:	0f 84 ac 00 00 00    	je     f010c9dc <prof_report+0x26a>
+f010c930:	8b 01                	mov    (%ecx),%eax
+f010c932:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f010c935:	8b 41 04             	mov    0x4(%ecx),%eax
+f010c938:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f010c93b:	8b 71 08             	mov    0x8(%ecx),%esi
+f010c93e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+f010c941:	8b 41 0c             	mov    0xc(%ecx),%eax
+f010c944:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f010c947:	8b 41 10             	mov    0x10(%ecx),%eax
+f010c94a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f010c94d:	8b 41 14             	mov    0x14(%ecx),%eax
+f010c950:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f010c953:	8b 41 18             	mov    0x18(%ecx),%eax
+f010c956:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010c959:	8b 41 1c             	mov    0x1c(%ecx),%eax
+f010c95c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010c95f:	8b 41 20             	mov    0x20(%ecx),%eax
+f010c962:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010c965:	8b 41 24             	mov    0x24(%ecx),%eax
+f010c968:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010c96b:	8b 41 28             	mov    0x28(%ecx),%eax
+f010c96e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010c971:	89 fa                	mov    %edi,%edx
+f010c973:	89 c8                	mov    %ecx,%eax
+f010c975:	89 fb                	mov    %edi,%ebx
+f010c977:	85 ff                	test   %edi,%edi
+f010c979:	0f 8e 3a ff ff ff    	jle    f010c8b9 <prof_report+0x147>
+f010c97f:	89 d3                	mov    %edx,%ebx
+f010c981:	83 ea 01             	sub    $0x1,%edx
+f010c984:	39 70 dc             	cmp    %esi,-0x24(%eax)
+f010c987:	0f 83 2c ff ff ff    	jae    f010c8b9 <prof_report+0x147>
+f010c98d:	8b 58 d4             	mov    -0x2c(%eax),%ebx
+f010c990:	89 18                	mov    %ebx,(%eax)
+f010c992:	8b 58 d8             	mov    -0x28(%eax),%ebx
+f010c995:	89 58 04             	mov    %ebx,0x4(%eax)
+f010c998:	8b 58 dc             	mov    -0x24(%eax),%ebx
+f010c99b:	89 58 08             	mov    %ebx,0x8(%eax)
+f010c99e:	8b 58 e0             	mov    -0x20(%eax),%ebx
+f010c9a1:	89 58 0c             	mov    %ebx,0xc(%eax)
+f010c9a4:	8b 58 e4             	mov    -0x1c(%eax),%ebx
+f010c9a7:	89 58 10             	mov    %ebx,0x10(%eax)
+f010c9aa:	8b 58 e8             	mov    -0x18(%eax),%ebx
+f010c9ad:	89 58 14             	mov    %ebx,0x14(%eax)
+f010c9b0:	8b 58 ec             	mov    -0x14(%eax),%ebx
+f010c9b3:	89 58 18             	mov    %ebx,0x18(%eax)
+f010c9b6:	8b 58 f0             	mov    -0x10(%eax),%ebx
+f010c9b9:	89 58 1c             	mov    %ebx,0x1c(%eax)
+f010c9bc:	8b 58 f4             	mov    -0xc(%eax),%ebx
+f010c9bf:	89 58 20             	mov    %ebx,0x20(%eax)
+f010c9c2:	8b 58 f8             	mov    -0x8(%eax),%ebx
+f010c9c5:	89 58 24             	mov    %ebx,0x24(%eax)
+f010c9c8:	8b 58 fc             	mov    -0x4(%eax),%ebx
+f010c9cb:	89 58 28             	mov    %ebx,0x28(%eax)
+f010c9ce:	83 e8 2c             	sub    $0x2c,%eax
+f010c9d1:	85 d2                	test   %edx,%edx
+f010c9d3:	75 aa                	jne    f010c97f <prof_report+0x20d>
+f010c9d5:	89 d3                	mov    %edx,%ebx
+f010c9d7:	e9 dd fe ff ff       	jmp    f010c8b9 <prof_report+0x147>
+f010c9dc:	8b 7d 90             	mov    -0x70(%ebp),%edi
+f010c9df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010c9e2:	39 df                	cmp    %ebx,%edi
+f010c9e4:	0f 4e df             	cmovle %edi,%ebx
+f010c9e7:	83 ec 04             	sub    $0x4,%esp
+f010c9ea:	6b c3 2c             	imul   $0x2c,%ebx,%eax
+f010c9ed:	50                   	push   %eax
+f010c9ee:	68 20 64 2b f0       	push   $0xf02b6420
+f010c9f3:	ff 75 08             	push   0x8(%ebp)
+f010c9f6:	e8 2e df ff ff       	call   f010a929 <memmove>
+f010c9fb:	89 d8                	mov    %ebx,%eax
+f010c9fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010ca00:	5b                   	pop    %ebx
+f010ca01:	5e                   	pop    %esi
+f010ca02:	5f                   	pop    %edi
+f010ca03:	5d                   	pop    %ebp
+f010ca04:	c3                   	ret
+f010ca05:	bf 00 00 00 00       	mov    $0x0,%edi
+f010ca0a:	eb d6                	jmp    f010c9e2 <prof_report+0x270>
+
+f010ca0c <prof_print_recent>:
+f010ca0c:	83 3d c4 24 2d f0 00 	cmpl   $0x0,0xf02d24c4
+f010ca13:	0f 8e 6d 01 00 00    	jle    f010cb86 <prof_print_recent+0x17a>
+f010ca19:	55                   	push   %ebp
+f010ca1a:	89 e5                	mov    %esp,%ebp
+f010ca1c:	57                   	push   %edi
+f010ca1d:	56                   	push   %esi
+f010ca1e:	53                   	push   %ebx
+f010ca1f:	83 ec 4c             	sub    $0x4c,%esp
+f010ca22:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+f010ca29:	be 00 00 00 00       	mov    $0x0,%esi
+f010ca2e:	8d 7d c8             	lea    -0x38(%ebp),%edi
+f010ca31:	e9 ed 00 00 00       	jmp    f010cb23 <prof_print_recent+0x117>
+f010ca36:	83 ec 0c             	sub    $0xc,%esp
+f010ca39:	6a 20                	push   $0x20
+f010ca3b:	89 f9                	mov    %edi,%ecx
+f010ca3d:	e8 4c fa ff ff       	call   f010c48e <prof_symbolize>
+f010ca42:	57                   	push   %edi
+f010ca43:	8d 1c 36             	lea    (%esi,%esi,1),%ebx
+f010ca46:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+f010ca49:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010ca4c:	8d 84 c1 40 7a 2b f0 	lea    -0xfd485c0(%ecx,%eax,8),%eax
+f010ca53:	ff 70 04             	push   0x4(%eax)
+f010ca56:	ff 70 08             	push   0x8(%eax)
+f010ca59:	68 fd f4 10 f0       	push   $0xf010f4fd
+f010ca5e:	e8 a4 92 ff ff       	call   f0105d07 <cprintf>
+f010ca63:	01 f3                	add    %esi,%ebx
+f010ca65:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f010ca68:	8d 04 d8             	lea    (%eax,%ebx,8),%eax
+f010ca6b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f010ca6e:	83 c4 20             	add    $0x20,%esp
+f010ca71:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010ca76:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f010ca79:	8b 94 98 4c 7a 2b f0 	mov    -0xfd485b4(%eax,%ebx,4),%edx
+f010ca80:	85 d2                	test   %edx,%edx
+f010ca82:	74 32                	je     f010cab6 <prof_print_recent+0xaa>
+f010ca84:	8d 04 76             	lea    (%esi,%esi,2),%eax
+f010ca87:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010ca8a:	8b 84 c1 48 7a 2b f0 	mov    -0xfd485b8(%ecx,%eax,8),%eax
+f010ca91:	83 ec 0c             	sub    $0xc,%esp
+f010ca94:	6a 20                	push   $0x20
+f010ca96:	89 f9                	mov    %edi,%ecx
+f010ca98:	e8 f1 f9 ff ff       	call   f010c48e <prof_symbolize>
+f010ca9d:	83 c4 08             	add    $0x8,%esp
+f010caa0:	57                   	push   %edi
+f010caa1:	68 0e f5 10 f0       	push   $0xf010f50e
+f010caa6:	e8 5c 92 ff ff       	call   f0105d07 <cprintf>
+f010caab:	83 c3 01             	add    $0x1,%ebx
+f010caae:	83 c4 10             	add    $0x10,%esp
+f010cab1:	83 fb 04             	cmp    $0x4,%ebx
+f010cab4:	75 c0                	jne    f010ca76 <prof_print_recent+0x6a>
+f010cab6:	83 ec 0c             	sub    $0xc,%esp
+f010cab9:	68 0e e5 10 f0       	push   $0xf010e50e
+f010cabe:	e8 44 92 ff ff       	call   f0105d07 <cprintf>
+f010cac3:	83 45 bc 01          	addl   $0x1,-0x44(%ebp)
+f010cac7:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f010caca:	83 c4 10             	add    $0x10,%esp
+f010cacd:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f010cad0:	3b 86 40 7a 2b f0    	cmp    -0xfd485c0(%esi),%eax
+f010cad6:	73 36                	jae    f010cb0e <prof_print_recent+0x102>
+f010cad8:	8b 75 bc             	mov    -0x44(%ebp),%esi
+f010cadb:	81 e6 ff 01 00 00    	and    $0x1ff,%esi
+f010cae1:	8d 04 76             	lea    (%esi,%esi,2),%eax
+f010cae4:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010cae7:	8b 94 c1 44 7a 2b f0 	mov    -0xfd485bc(%ecx,%eax,8),%edx
+f010caee:	b8 00 00 00 00       	mov    $0x0,%eax
+f010caf3:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f010caf9:	0f 87 37 ff ff ff    	ja     f010ca36 <prof_print_recent+0x2a>
+f010caff:	8d 04 76             	lea    (%esi,%esi,2),%eax
+f010cb02:	8b 84 c1 48 7a 2b f0 	mov    -0xfd485b8(%ecx,%eax,8),%eax
+f010cb09:	e9 28 ff ff ff       	jmp    f010ca36 <prof_print_recent+0x2a>
+f010cb0e:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+f010cb11:	83 c6 01             	add    $0x1,%esi
+f010cb14:	81 45 b8 04 30 00 00 	addl   $0x3004,-0x48(%ebp)
+f010cb1b:	39 35 c4 24 2d f0    	cmp    %esi,0xf02d24c4
+f010cb21:	7e 5b                	jle    f010cb7e <prof_print_recent+0x172>
+f010cb23:	83 ec 04             	sub    $0x4,%esp
+f010cb26:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+f010cb29:	ff b3 40 7a 2b f0    	push   -0xfd485c0(%ebx)
+f010cb2f:	56                   	push   %esi
+f010cb30:	68 e9 f4 10 f0       	push   $0xf010f4e9
+f010cb35:	e8 cd 91 ff ff       	call   f0105d07 <cprintf>
+f010cb3a:	8b 83 40 7a 2b f0    	mov    -0xfd485c0(%ebx),%eax
+f010cb40:	83 c4 10             	add    $0x10,%esp
+f010cb43:	89 c1                	mov    %eax,%ecx
+f010cb45:	2b 4d 08             	sub    0x8(%ebp),%ecx
+f010cb48:	39 45 08             	cmp    %eax,0x8(%ebp)
+f010cb4b:	ba 00 00 00 00       	mov    $0x0,%edx
+f010cb50:	0f 43 ca             	cmovae %edx,%ecx
+f010cb53:	89 c3                	mov    %eax,%ebx
+f010cb55:	29 cb                	sub    %ecx,%ebx
+f010cb57:	8d 90 00 fe ff ff    	lea    -0x200(%eax),%edx
+f010cb5d:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+f010cb63:	0f 47 ca             	cmova  %edx,%ecx
+f010cb66:	39 c1                	cmp    %eax,%ecx
+f010cb68:	73 a7                	jae    f010cb11 <prof_print_recent+0x105>
+f010cb6a:	69 c6 04 30 00 00    	imul   $0x3004,%esi,%eax
+f010cb70:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f010cb73:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+f010cb76:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+f010cb79:	e9 5a ff ff ff       	jmp    f010cad8 <prof_print_recent+0xcc>
+f010cb7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010cb81:	5b                   	pop    %ebx
+f010cb82:	5e                   	pop    %esi
+f010cb83:	5f                   	pop    %edi
+f010cb84:	5d                   	pop    %ebp
+f010cb85:	c3                   	ret
+f010cb86:	c3                   	ret
+
+f010cb87 <trace_record>:
+f010cb87:	55                   	push   %ebp
+f010cb88:	89 e5                	mov    %esp,%ebp
+f010cb8a:	57                   	push   %edi
+f010cb8b:	56                   	push   %esi
+f010cb8c:	53                   	push   %ebx
+f010cb8d:	83 ec 1c             	sub    $0x1c,%esp
+f010cb90:	8b 35 a4 b4 32 f0    	mov    0xf032b4a4,%esi
+f010cb96:	e8 b6 e3 ff ff       	call   f010af51 <cpunum>
+f010cb9b:	69 c0 20 80 00 00    	imul   $0x8020,%eax,%eax
+f010cba1:	01 c6                	add    %eax,%esi
+f010cba3:	8b 3e                	mov    (%esi),%edi
+f010cba5:	89 f8                	mov    %edi,%eax
+f010cba7:	25 ff 03 00 00       	and    $0x3ff,%eax
+f010cbac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010cbaf:	89 c3                	mov    %eax,%ebx
+f010cbb1:	c1 e3 05             	shl    $0x5,%ebx
+f010cbb4:	01 f3                	add    %esi,%ebx
+f010cbb6:	c7 43 28 ff ff ff ff 	movl   $0xffffffff,0x28(%ebx)
+f010cbbd:	0f 31                	rdtsc
+f010cbbf:	89 43 20             	mov    %eax,0x20(%ebx)
+f010cbc2:	89 53 24             	mov    %edx,0x24(%ebx)
+f010cbc5:	8b 45 08             	mov    0x8(%ebp),%eax
+f010cbc8:	66 89 43 2c          	mov    %ax,0x2c(%ebx)
+f010cbcc:	e8 80 e3 ff ff       	call   f010af51 <cpunum>
+f010cbd1:	66 89 43 2e          	mov    %ax,0x2e(%ebx)
+f010cbd5:	e8 77 e3 ff ff       	call   f010af51 <cpunum>
+f010cbda:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010cbe0:	ba 00 00 00 00       	mov    $0x0,%edx
+f010cbe5:	83 b8 28 20 2d f0 00 	cmpl   $0x0,-0xfd2dfd8(%eax)
+f010cbec:	74 14                	je     f010cc02 <trace_record+0x7b>
+f010cbee:	e8 5e e3 ff ff       	call   f010af51 <cpunum>
+f010cbf3:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010cbf9:	8b 80 28 20 2d f0    	mov    -0xfd2dfd8(%eax),%eax
+f010cbff:	8b 50 48             	mov    0x48(%eax),%edx
+f010cc02:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010cc05:	c1 e0 05             	shl    $0x5,%eax
+f010cc08:	01 f0                	add    %esi,%eax
+f010cc0a:	89 50 30             	mov    %edx,0x30(%eax)
+f010cc0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010cc10:	89 50 34             	mov    %edx,0x34(%eax)
+f010cc13:	8b 55 10             	mov    0x10(%ebp),%edx
+f010cc16:	89 50 38             	mov    %edx,0x38(%eax)
+f010cc19:	8b 55 14             	mov    0x14(%ebp),%edx
+f010cc1c:	89 50 3c             	mov    %edx,0x3c(%eax)
+f010cc1f:	89 7b 28             	mov    %edi,0x28(%ebx)
+f010cc22:	83 c7 01             	add    $0x1,%edi
+f010cc25:	89 3e                	mov    %edi,(%esi)
+f010cc27:	83 c4 1c             	add    $0x1c,%esp
+f010cc2a:	5b                   	pop    %ebx
+f010cc2b:	5e                   	pop    %esi
+f010cc2c:	5f                   	pop    %edi
+f010cc2d:	5d                   	pop    %ebp
+f010cc2e:	c3                   	ret
+
+f010cc2f <textcache_lookup>:
+f010cc2f:	55                   	push   %ebp
+f010cc30:	89 e5                	mov    %esp,%ebp
+f010cc32:	57                   	push   %edi
+f010cc33:	56                   	push   %esi
+f010cc34:	53                   	push   %ebx
+f010cc35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010cc38:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010cc3b:	89 c8                	mov    %ecx,%eax
+f010cc3d:	c1 e8 0c             	shr    $0xc,%eax
+f010cc40:	8d 14 db             	lea    (%ebx,%ebx,8),%edx
+f010cc43:	8d 14 93             	lea    (%ebx,%edx,4),%edx
+f010cc46:	01 d0                	add    %edx,%eax
+f010cc48:	25 ff 01 00 00       	and    $0x1ff,%eax
+f010cc4d:	89 c2                	mov    %eax,%edx
+f010cc4f:	c1 e2 04             	shl    $0x4,%edx
+f010cc52:	8b 92 6c fa 2c f0    	mov    -0xfd30594(%edx),%edx
+f010cc58:	85 d2                	test   %edx,%edx
+f010cc5a:	74 32                	je     f010cc8e <textcache_lookup+0x5f>
+f010cc5c:	89 c6                	mov    %eax,%esi
+f010cc5e:	c1 e6 04             	shl    $0x4,%esi
+f010cc61:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010cc64:	39 be 60 fa 2c f0    	cmp    %edi,-0xfd305a0(%esi)
+f010cc6a:	75 1d                	jne    f010cc89 <textcache_lookup+0x5a>
+f010cc6c:	89 c6                	mov    %eax,%esi
+f010cc6e:	c1 e6 04             	shl    $0x4,%esi
+f010cc71:	39 9e 64 fa 2c f0    	cmp    %ebx,-0xfd3059c(%esi)
+f010cc77:	75 1c                	jne    f010cc95 <textcache_lookup+0x66>
+f010cc79:	39 8e 68 fa 2c f0    	cmp    %ecx,-0xfd30598(%esi)
+f010cc7f:	b8 00 00 00 00       	mov    $0x0,%eax
+f010cc84:	0f 45 d0             	cmovne %eax,%edx
+f010cc87:	eb 05                	jmp    f010cc8e <textcache_lookup+0x5f>
+f010cc89:	ba 00 00 00 00       	mov    $0x0,%edx
+f010cc8e:	89 d0                	mov    %edx,%eax
+f010cc90:	5b                   	pop    %ebx
+f010cc91:	5e                   	pop    %esi
+f010cc92:	5f                   	pop    %edi
+f010cc93:	5d                   	pop    %ebp
+f010cc94:	c3                   	ret
+f010cc95:	ba 00 00 00 00       	mov    $0x0,%edx
+f010cc9a:	eb f2                	jmp    f010cc8e <textcache_lookup+0x5f>
+
+f010cc9c <textcache_insert>:
+f010cc9c:	55                   	push   %ebp
+f010cc9d:	89 e5                	mov    %esp,%ebp
+f010cc9f:	57                   	push   %edi
+f010cca0:	56                   	push   %esi
+f010cca1:	53                   	push   %ebx
+f010cca2:	83 ec 0c             	sub    $0xc,%esp
+f010cca5:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010cca8:	8b 7d 14             	mov    0x14(%ebp),%edi
+f010ccab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f010ccae:	c1 eb 0c             	shr    $0xc,%ebx
+f010ccb1:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+f010ccb4:	8d 04 86             	lea    (%esi,%eax,4),%eax
+f010ccb7:	01 c3                	add    %eax,%ebx
+f010ccb9:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+f010ccbf:	66 83 47 04 01       	addw   $0x1,0x4(%edi)
+f010ccc4:	89 d8                	mov    %ebx,%eax
+f010ccc6:	c1 e0 04             	shl    $0x4,%eax
+f010ccc9:	8b 80 6c fa 2c f0    	mov    -0xfd30594(%eax),%eax
+f010cccf:	85 c0                	test   %eax,%eax
+f010ccd1:	74 0c                	je     f010ccdf <textcache_insert+0x43>
+f010ccd3:	83 ec 0c             	sub    $0xc,%esp
+f010ccd6:	50                   	push   %eax
+f010ccd7:	e8 f2 4d ff ff       	call   f0101ace <page_decref>
+f010ccdc:	83 c4 10             	add    $0x10,%esp
+f010ccdf:	c1 e3 04             	shl    $0x4,%ebx
+f010cce2:	8b 55 08             	mov    0x8(%ebp),%edx
+f010cce5:	89 93 60 fa 2c f0    	mov    %edx,-0xfd305a0(%ebx)
+f010cceb:	89 b3 64 fa 2c f0    	mov    %esi,-0xfd3059c(%ebx)
+f010ccf1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010ccf4:	89 8b 68 fa 2c f0    	mov    %ecx,-0xfd30598(%ebx)
+f010ccfa:	89 bb 6c fa 2c f0    	mov    %edi,-0xfd30594(%ebx)
+f010cd00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010cd03:	5b                   	pop    %ebx
+f010cd04:	5e                   	pop    %esi
+f010cd05:	5f                   	pop    %edi
+f010cd06:	5d                   	pop    %ebp
+f010cd07:	c3                   	ret
+
+f010cd08 <textcache_map>:
+f010cd08:	55                   	push   %ebp
+f010cd09:	89 e5                	mov    %esp,%ebp
+f010cd0b:	56                   	push   %esi
+f010cd0c:	53                   	push   %ebx
+f010cd0d:	8b 75 08             	mov    0x8(%ebp),%esi
+f010cd10:	bb 60 fa 2c f0       	mov    $0xf02cfa60,%ebx
+f010cd15:	eb 22                	jmp    f010cd39 <textcache_map+0x31>
+f010cd17:	6a 05                	push   $0x5
+f010cd19:	ff 73 08             	push   0x8(%ebx)
+f010cd1c:	ff 73 0c             	push   0xc(%ebx)
+f010cd1f:	ff 76 78             	push   0x78(%esi)
+f010cd22:	e8 2e 55 ff ff       	call   f0102255 <page_insert>
+f010cd27:	83 c4 10             	add    $0x10,%esp
+f010cd2a:	85 c0                	test   %eax,%eax
+f010cd2c:	78 44                	js     f010cd72 <textcache_map+0x6a>
+f010cd2e:	83 c3 10             	add    $0x10,%ebx
+f010cd31:	81 fb 60 1a 2d f0    	cmp    $0xf02d1a60,%ebx
+f010cd37:	74 39                	je     f010cd72 <textcache_map+0x6a>
+f010cd39:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+f010cd3d:	74 ef                	je     f010cd2e <textcache_map+0x26>
+f010cd3f:	8b 86 84 00 00 00    	mov    0x84(%esi),%eax
+f010cd45:	39 03                	cmp    %eax,(%ebx)
+f010cd47:	75 e5                	jne    f010cd2e <textcache_map+0x26>
+f010cd49:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+f010cd4f:	39 43 04             	cmp    %eax,0x4(%ebx)
+f010cd52:	75 da                	jne    f010cd2e <textcache_map+0x26>
+f010cd54:	83 ec 04             	sub    $0x4,%esp
+f010cd57:	6a 00                	push   $0x0
+f010cd59:	ff 73 08             	push   0x8(%ebx)
+f010cd5c:	ff 76 78             	push   0x78(%esi)
+f010cd5f:	e8 a8 51 ff ff       	call   f0101f0c <pgdir_walk>
+f010cd64:	83 c4 10             	add    $0x10,%esp
+f010cd67:	85 c0                	test   %eax,%eax
+f010cd69:	74 ac                	je     f010cd17 <textcache_map+0xf>
+f010cd6b:	f6 00 01             	testb  $0x1,(%eax)
+f010cd6e:	74 a7                	je     f010cd17 <textcache_map+0xf>
+f010cd70:	eb bc                	jmp    f010cd2e <textcache_map+0x26>
+f010cd72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010cd75:	5b                   	pop    %ebx
+f010cd76:	5e                   	pop    %esi
+f010cd77:	5d                   	pop    %ebp
+f010cd78:	c3                   	ret
+
+f010cd79 <textcache_retire>:
+f010cd79:	55                   	push   %ebp
+f010cd7a:	89 e5                	mov    %esp,%ebp
+f010cd7c:	57                   	push   %edi
+f010cd7d:	56                   	push   %esi
+f010cd7e:	53                   	push   %ebx
+f010cd7f:	83 ec 0c             	sub    $0xc,%esp
+f010cd82:	8b 75 08             	mov    0x8(%ebp),%esi
+f010cd85:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f010cd88:	bb 60 fa 2c f0       	mov    $0xf02cfa60,%ebx
+f010cd8d:	eb 0b                	jmp    f010cd9a <textcache_retire+0x21>
+f010cd8f:	83 c3 10             	add    $0x10,%ebx
+f010cd92:	81 fb 60 1a 2d f0    	cmp    $0xf02d1a60,%ebx
+f010cd98:	74 25                	je     f010cdbf <textcache_retire+0x46>
+f010cd9a:	8b 43 0c             	mov    0xc(%ebx),%eax
+f010cd9d:	85 c0                	test   %eax,%eax
+f010cd9f:	74 ee                	je     f010cd8f <textcache_retire+0x16>
+f010cda1:	39 33                	cmp    %esi,(%ebx)
+f010cda3:	75 ea                	jne    f010cd8f <textcache_retire+0x16>
+f010cda5:	39 7b 04             	cmp    %edi,0x4(%ebx)
+f010cda8:	75 e5                	jne    f010cd8f <textcache_retire+0x16>
+f010cdaa:	83 ec 0c             	sub    $0xc,%esp
+f010cdad:	50                   	push   %eax
+f010cdae:	e8 1b 4d ff ff       	call   f0101ace <page_decref>
+f010cdb3:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+f010cdba:	83 c4 10             	add    $0x10,%esp
+f010cdbd:	eb d0                	jmp    f010cd8f <textcache_retire+0x16>
+f010cdbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010cdc2:	5b                   	pop    %ebx
+f010cdc3:	5e                   	pop    %esi
+f010cdc4:	5f                   	pop    %edi
+f010cdc5:	5d                   	pop    %ebp
+f010cdc6:	c3                   	ret
+
+f010cdc7 <textcache_drop>:
+f010cdc7:	55                   	push   %ebp
+f010cdc8:	89 e5                	mov    %esp,%ebp
+f010cdca:	56                   	push   %esi
+f010cdcb:	53                   	push   %ebx
+f010cdcc:	8b 75 08             	mov    0x8(%ebp),%esi
+f010cdcf:	bb 60 fa 2c f0       	mov    $0xf02cfa60,%ebx
+f010cdd4:	eb 0b                	jmp    f010cde1 <textcache_drop+0x1a>
+f010cdd6:	83 c3 10             	add    $0x10,%ebx
+f010cdd9:	81 fb 60 1a 2d f0    	cmp    $0xf02d1a60,%ebx
+f010cddf:	74 20                	je     f010ce01 <textcache_drop+0x3a>
+f010cde1:	8b 43 0c             	mov    0xc(%ebx),%eax
+f010cde4:	85 c0                	test   %eax,%eax
+f010cde6:	74 ee                	je     f010cdd6 <textcache_drop+0xf>
+f010cde8:	39 33                	cmp    %esi,(%ebx)
+f010cdea:	75 ea                	jne    f010cdd6 <textcache_drop+0xf>
+f010cdec:	83 ec 0c             	sub    $0xc,%esp
+f010cdef:	50                   	push   %eax
+f010cdf0:	e8 d9 4c ff ff       	call   f0101ace <page_decref>
+f010cdf5:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+f010cdfc:	83 c4 10             	add    $0x10,%esp
+f010cdff:	eb d5                	jmp    f010cdd6 <textcache_drop+0xf>
+f010ce01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010ce04:	5b                   	pop    %ebx
+f010ce05:	5e                   	pop    %esi
+f010ce06:	5d                   	pop    %ebp
+f010ce07:	c3                   	ret
+
+f010ce08 <__udivmoddi4>:
+f010ce08:	55                   	push   %ebp
+f010ce09:	57                   	push   %edi
+f010ce0a:	56                   	push   %esi
+f010ce0b:	53                   	push   %ebx
+f010ce0c:	83 ec 24             	sub    $0x24,%esp
+f010ce0f:	8b 44 24 38          	mov    0x38(%esp),%eax
+f010ce13:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f010ce17:	89 44 24 08          	mov    %eax,0x8(%esp)
+f010ce1b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f010ce1f:	8b 44 24 40          	mov    0x40(%esp),%eax
+f010ce23:	8b 54 24 44          	mov    0x44(%esp),%edx
+f010ce27:	89 44 24 10          	mov    %eax,0x10(%esp)
+f010ce2b:	89 54 24 14          	mov    %edx,0x14(%esp)
+f010ce2f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+f010ce33:	b8 00 00 00 00       	mov    $0x0,%eax
+f010ce38:	ba 00 00 00 00       	mov    $0x0,%edx
+f010ce3d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010ce42:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f010ce49:	00 
+f010ce4a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f010ce51:	00 
+f010ce52:	89 fb                	mov    %edi,%ebx
+f010ce54:	eb 08                	jmp    f010ce5e <__udivmoddi4+0x56>
+f010ce56:	83 e9 01             	sub    $0x1,%ecx
+f010ce59:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f010ce5c:	74 68                	je     f010cec6 <__udivmoddi4+0xbe>
+f010ce5e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f010ce62:	01 c0                	add    %eax,%eax
+f010ce64:	89 c6                	mov    %eax,%esi
+f010ce66:	89 d7                	mov    %edx,%edi
+f010ce68:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010ce6c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010ce70:	0f ad d0             	shrd   %cl,%edx,%eax
+f010ce73:	d3 ea                	shr    %cl,%edx
+f010ce75:	f6 c1 20             	test   $0x20,%cl
+f010ce78:	74 04                	je     f010ce7e <__udivmoddi4+0x76>
+f010ce7a:	89 d0                	mov    %edx,%eax
+f010ce7c:	31 d2                	xor    %edx,%edx
+f010ce7e:	83 e0 01             	and    $0x1,%eax
+f010ce81:	89 04 24             	mov    %eax,(%esp)
+f010ce84:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f010ce8b:	00 
+f010ce8c:	8b 04 24             	mov    (%esp),%eax
+f010ce8f:	8b 54 24 04          	mov    0x4(%esp),%edx
+f010ce93:	09 f0                	or     %esi,%eax
+f010ce95:	09 fa                	or     %edi,%edx
+f010ce97:	8b 74 24 10          	mov    0x10(%esp),%esi
+f010ce9b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f010ce9f:	39 f0                	cmp    %esi,%eax
+f010cea1:	89 d5                	mov    %edx,%ebp
+f010cea3:	19 fd                	sbb    %edi,%ebp
+f010cea5:	72 af                	jb     f010ce56 <__udivmoddi4+0x4e>
+f010cea7:	29 f0                	sub    %esi,%eax
+f010cea9:	19 fa                	sbb    %edi,%edx
+f010ceab:	89 cf                	mov    %ecx,%edi
+f010cead:	c1 ef 05             	shr    $0x5,%edi
+f010ceb0:	83 e7 01             	and    $0x1,%edi
+f010ceb3:	89 fe                	mov    %edi,%esi
+f010ceb5:	83 f6 01             	xor    $0x1,%esi
+f010ceb8:	d3 e6                	shl    %cl,%esi
+f010ceba:	d3 e7                	shl    %cl,%edi
+f010cebc:	09 74 24 18          	or     %esi,0x18(%esp)
+f010cec0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f010cec4:	eb 90                	jmp    f010ce56 <__udivmoddi4+0x4e>
+f010cec6:	85 db                	test   %ebx,%ebx
+f010cec8:	74 05                	je     f010cecf <__udivmoddi4+0xc7>
+f010ceca:	89 03                	mov    %eax,(%ebx)
+f010cecc:	89 53 04             	mov    %edx,0x4(%ebx)
+f010cecf:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010ced3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010ced7:	83 c4 24             	add    $0x24,%esp
+f010ceda:	5b                   	pop    %ebx
+f010cedb:	5e                   	pop    %esi
+f010cedc:	5f                   	pop    %edi
+f010cedd:	5d                   	pop    %ebp
+f010cede:	c3                   	ret
+
+f010cedf <__udivdi3>:
+f010cedf:	83 ec 08             	sub    $0x8,%esp
+f010cee2:	6a 00                	push   $0x0
+f010cee4:	ff 74 24 1c          	push   0x1c(%esp)
+f010cee8:	ff 74 24 1c          	push   0x1c(%esp)
+f010ceec:	ff 74 24 1c          	push   0x1c(%esp)
+f010cef0:	ff 74 24 1c          	push   0x1c(%esp)
+f010cef4:	e8 0f ff ff ff       	call   f010ce08 <__udivmoddi4>
+f010cef9:	83 c4 1c             	add    $0x1c,%esp
+f010cefc:	c3                   	ret
+
+f010cefd <__umoddi3>:
+f010cefd:	83 ec 18             	sub    $0x18,%esp
+f010cf00:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f010cf04:	50                   	push   %eax
+f010cf05:	ff 74 24 2c          	push   0x2c(%esp)
+f010cf09:	ff 74 24 2c          	push   0x2c(%esp)
+f010cf0d:	ff 74 24 2c          	push   0x2c(%esp)
+f010cf11:	ff 74 24 2c          	push   0x2c(%esp)
+f010cf15:	e8 ee fe ff ff       	call   f010ce08 <__udivmoddi4>
+f010cf1a:	8b 44 24 20          	mov    0x20(%esp),%eax
+f010cf1e:	8b 54 24 24          	mov    0x24(%esp),%edx
+f010cf22:	83 c4 2c             	add    $0x2c,%esp
+f010cf25:	c3                   	ret
+
+f010cf26 <__divdi3>:
+f010cf26:	53                   	push   %ebx
+f010cf27:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010cf2b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010cf2f:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+f010cf33:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+f010cf37:	85 d2                	test   %edx,%edx
+f010cf39:	78 12                	js     f010cf4d <__divdi3+0x27>
+f010cf3b:	85 db                	test   %ebx,%ebx
+f010cf3d:	78 2e                	js     f010cf6d <__divdi3+0x47>
+f010cf3f:	53                   	push   %ebx
+f010cf40:	51                   	push   %ecx
+f010cf41:	52                   	push   %edx
+f010cf42:	50                   	push   %eax
+f010cf43:	e8 97 ff ff ff       	call   f010cedf <__udivdi3>
+f010cf48:	83 c4 10             	add    $0x10,%esp
+f010cf4b:	eb 1e                	jmp    f010cf6b <__divdi3+0x45>
+f010cf4d:	f7 d8                	neg    %eax
+f010cf4f:	83 d2 00             	adc    $0x0,%edx
+f010cf52:	f7 da                	neg    %edx
+f010cf54:	85 db                	test   %ebx,%ebx
+f010cf56:	78 2a                	js     f010cf82 <__divdi3+0x5c>
+f010cf58:	53                   	push   %ebx
+f010cf59:	51                   	push   %ecx
+f010cf5a:	52                   	push   %edx
+f010cf5b:	50                   	push   %eax
+f010cf5c:	e8 7e ff ff ff       	call   f010cedf <__udivdi3>
+f010cf61:	83 c4 10             	add    $0x10,%esp
+f010cf64:	f7 d8                	neg    %eax
+f010cf66:	83 d2 00             	adc    $0x0,%edx
+f010cf69:	f7 da                	neg    %edx
+f010cf6b:	5b                   	pop    %ebx
+f010cf6c:	c3                   	ret
+f010cf6d:	f7 d9                	neg    %ecx
+f010cf6f:	83 d3 00             	adc    $0x0,%ebx
+f010cf72:	f7 db                	neg    %ebx
+f010cf74:	53                   	push   %ebx
+f010cf75:	51                   	push   %ecx
+f010cf76:	52                   	push   %edx
+f010cf77:	50                   	push   %eax
+f010cf78:	e8 62 ff ff ff       	call   f010cedf <__udivdi3>
+f010cf7d:	83 c4 10             	add    $0x10,%esp
+f010cf80:	eb e2                	jmp    f010cf64 <__divdi3+0x3e>
+f010cf82:	f7 d9                	neg    %ecx
+f010cf84:	83 d3 00             	adc    $0x0,%ebx
+f010cf87:	f7 db                	neg    %ebx
+f010cf89:	53                   	push   %ebx
+f010cf8a:	51                   	push   %ecx
+f010cf8b:	52                   	push   %edx
+f010cf8c:	50                   	push   %eax
+f010cf8d:	e8 4d ff ff ff       	call   f010cedf <__udivdi3>
+f010cf92:	83 c4 10             	add    $0x10,%esp
+f010cf95:	eb d4                	jmp    f010cf6b <__divdi3+0x45>
+
+f010cf97 <__moddi3>:
+f010cf97:	55                   	push   %ebp
+f010cf98:	57                   	push   %edi
+f010cf99:	56                   	push   %esi
+f010cf9a:	53                   	push   %ebx
+f010cf9b:	83 ec 0c             	sub    $0xc,%esp
+f010cf9e:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+f010cfa2:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+f010cfa6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010cfaa:	89 e9                	mov    %ebp,%ecx
+f010cfac:	f7 d9                	neg    %ecx
+f010cfae:	89 d0                	mov    %edx,%eax
+f010cfb0:	83 d0 00             	adc    $0x0,%eax
+f010cfb3:	f7 d8                	neg    %eax
+f010cfb5:	0f 49 e9             	cmovns %ecx,%ebp
+f010cfb8:	0f 49 d0             	cmovns %eax,%edx
+f010cfbb:	52                   	push   %edx
+f010cfbc:	55                   	push   %ebp
+f010cfbd:	8b 54 24 28          	mov    0x28(%esp),%edx
+f010cfc1:	f7 da                	neg    %edx
+f010cfc3:	89 d8                	mov    %ebx,%eax
+f010cfc5:	83 d0 00             	adc    $0x0,%eax
+f010cfc8:	f7 d8                	neg    %eax
+f010cfca:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+f010cfcf:	89 54 24 08          	mov    %edx,0x8(%esp)
+f010cfd3:	0f 48 c3             	cmovs  %ebx,%eax
+f010cfd6:	89 44 24 0c          	mov    %eax,0xc(%esp)
+f010cfda:	ff 74 24 0c          	push   0xc(%esp)
+f010cfde:	ff 74 24 0c          	push   0xc(%esp)
+f010cfe2:	e8 16 ff ff ff       	call   f010cefd <__umoddi3>
+f010cfe7:	83 c4 10             	add    $0x10,%esp
+f010cfea:	85 db                	test   %ebx,%ebx
+f010cfec:	78 08                	js     f010cff6 <__moddi3+0x5f>
+f010cfee:	83 c4 0c             	add    $0xc,%esp
+f010cff1:	5b                   	pop    %ebx
+f010cff2:	5e                   	pop    %esi
+f010cff3:	5f                   	pop    %edi
+f010cff4:	5d                   	pop    %ebp
+f010cff5:	c3                   	ret
+f010cff6:	f7 d8                	neg    %eax
+f010cff8:	83 d2 00             	adc    $0x0,%edx
+f010cffb:	f7 da                	neg    %edx
+f010cffd:	eb ef                	jmp    f010cfee <__moddi3+0x57>
@@ -0,0 +1,6149 @@
+
+obj/net/testinput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b5 04 00 00       	call   8004e6 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 7c             	sub    $0x7c,%esp
+  80003c:	e8 e6 10 00 00       	call   801127 <sys_getenvid>
+  800041:	89 c3                	mov    %eax,%ebx
+  800043:	c7 05 00 50 80 00 00 	movl   $0x803f00,0x805000
+  80004a:	3f 80 00 
+  80004d:	e8 8d 1b 00 00       	call   801bdf <fork>
+  800052:	a3 04 60 80 00       	mov    %eax,0x806004
+  800057:	85 c0                	test   %eax,%eax
+  800059:	0f 88 7a 01 00 00    	js     8001d9 <umain+0x1a6>
+  80005f:	0f 84 88 01 00 00    	je     8001ed <umain+0x1ba>
+  800065:	e8 75 1b 00 00       	call   801bdf <fork>
+  80006a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	0f 88 8a 01 00 00    	js     800201 <umain+0x1ce>
+  800077:	0f 84 98 01 00 00    	je     800215 <umain+0x1e2>
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	68 28 3f 80 00       	push   $0x803f28
+  800085:	e8 b0 05 00 00       	call   80063a <cprintf>
+  80008a:	c7 45 98 52 54 00 12 	movl   $0x12005452,-0x68(%ebp)
+  800091:	66 c7 45 9c 34 56    	movw   $0x5634,-0x64(%ebp)
+  800097:	c7 04 24 45 3f 80 00 	movl   $0x803f45,(%esp)
+  80009e:	e8 29 3c 00 00       	call   803ccc <inet_addr>
+  8000a3:	89 45 90             	mov    %eax,-0x70(%ebp)
+  8000a6:	c7 04 24 4f 3f 80 00 	movl   $0x803f4f,(%esp)
+  8000ad:	e8 1a 3c 00 00       	call   803ccc <inet_addr>
+  8000b2:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  8000b5:	83 c4 0c             	add    $0xc,%esp
+  8000b8:	6a 07                	push   $0x7
+  8000ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000bf:	6a 00                	push   $0x0
+  8000c1:	e8 cb 10 00 00       	call   801191 <sys_page_alloc>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	0f 88 52 01 00 00    	js     800223 <umain+0x1f0>
+  8000d1:	c7 05 00 b0 fe 0f 2a 	movl   $0x2a,0xffeb000
+  8000d8:	00 00 00 
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	6a 06                	push   $0x6
+  8000e0:	68 ff 00 00 00       	push   $0xff
+  8000e5:	68 04 b0 fe 0f       	push   $0xffeb004
+  8000ea:	e8 bd 0d 00 00       	call   800eac <memset>
+  8000ef:	83 c4 0c             	add    $0xc,%esp
+  8000f2:	6a 06                	push   $0x6
+  8000f4:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 0a b0 fe 0f       	push   $0xffeb00a
+  8000fd:	e8 41 0e 00 00       	call   800f43 <memcpy>
+  800102:	c7 04 24 06 08 00 00 	movl   $0x806,(%esp)
+  800109:	e8 87 39 00 00       	call   803a95 <htons>
+  80010e:	66 a3 10 b0 fe 0f    	mov    %ax,0xffeb010
+  800114:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80011b:	e8 75 39 00 00       	call   803a95 <htons>
+  800120:	66 a3 12 b0 fe 0f    	mov    %ax,0xffeb012
+  800126:	c7 04 24 00 08 00 00 	movl   $0x800,(%esp)
+  80012d:	e8 63 39 00 00       	call   803a95 <htons>
+  800132:	66 a3 14 b0 fe 0f    	mov    %ax,0xffeb014
+  800138:	c7 04 24 04 06 00 00 	movl   $0x604,(%esp)
+  80013f:	e8 51 39 00 00       	call   803a95 <htons>
+  800144:	66 a3 16 b0 fe 0f    	mov    %ax,0xffeb016
+  80014a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800151:	e8 3f 39 00 00       	call   803a95 <htons>
+  800156:	66 a3 18 b0 fe 0f    	mov    %ax,0xffeb018
+  80015c:	83 c4 0c             	add    $0xc,%esp
+  80015f:	6a 06                	push   $0x6
+  800161:	53                   	push   %ebx
+  800162:	68 1a b0 fe 0f       	push   $0xffeb01a
+  800167:	e8 d7 0d 00 00       	call   800f43 <memcpy>
+  80016c:	83 c4 0c             	add    $0xc,%esp
+  80016f:	6a 04                	push   $0x4
+  800171:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800174:	50                   	push   %eax
+  800175:	68 20 b0 fe 0f       	push   $0xffeb020
+  80017a:	e8 c4 0d 00 00       	call   800f43 <memcpy>
+  80017f:	83 c4 0c             	add    $0xc,%esp
+  800182:	6a 06                	push   $0x6
+  800184:	6a 00                	push   $0x0
+  800186:	68 24 b0 fe 0f       	push   $0xffeb024
+  80018b:	e8 1c 0d 00 00       	call   800eac <memset>
+  800190:	83 c4 0c             	add    $0xc,%esp
+  800193:	6a 04                	push   $0x4
+  800195:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800198:	50                   	push   %eax
+  800199:	68 2a b0 fe 0f       	push   $0xffeb02a
+  80019e:	e8 a0 0d 00 00       	call   800f43 <memcpy>
+  8001a3:	6a 07                	push   $0x7
+  8001a5:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001aa:	6a 0b                	push   $0xb
+  8001ac:	ff 35 04 60 80 00    	push   0x806004
+  8001b2:	e8 d7 1d 00 00       	call   801f8e <ipc_send>
+  8001b7:	83 c4 18             	add    $0x18,%esp
+  8001ba:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001bf:	6a 00                	push   $0x0
+  8001c1:	e8 9d 10 00 00       	call   801263 <sys_page_unmap>
+  8001c6:	83 c4 10             	add    $0x10,%esp
+  8001c9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001ce:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%ebp)
+  8001d4:	e9 65 01 00 00       	jmp    80033e <umain+0x30b>
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	68 0a 3f 80 00       	push   $0x803f0a
+  8001e1:	6a 4d                	push   $0x4d
+  8001e3:	68 18 3f 80 00       	push   $0x803f18
+  8001e8:	e8 72 03 00 00       	call   80055f <_panic>
+  8001ed:	83 ec 0c             	sub    $0xc,%esp
+  8001f0:	53                   	push   %ebx
+  8001f1:	e8 9c 02 00 00       	call   800492 <output>
+  8001f6:	83 c4 10             	add    $0x10,%esp
+  8001f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fc:	5b                   	pop    %ebx
+  8001fd:	5e                   	pop    %esi
+  8001fe:	5f                   	pop    %edi
+  8001ff:	5d                   	pop    %ebp
+  800200:	c3                   	ret
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	68 0a 3f 80 00       	push   $0x803f0a
+  800209:	6a 55                	push   $0x55
+  80020b:	68 18 3f 80 00       	push   $0x803f18
+  800210:	e8 4a 03 00 00       	call   80055f <_panic>
+  800215:	83 ec 0c             	sub    $0xc,%esp
+  800218:	53                   	push   %ebx
+  800219:	e8 1d 02 00 00       	call   80043b <input>
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	eb d6                	jmp    8001f9 <umain+0x1c6>
+  800223:	50                   	push   %eax
+  800224:	68 58 3f 80 00       	push   $0x803f58
+  800229:	6a 19                	push   $0x19
+  80022b:	68 18 3f 80 00       	push   $0x803f18
+  800230:	e8 2a 03 00 00       	call   80055f <_panic>
+  800235:	50                   	push   %eax
+  800236:	68 69 3f 80 00       	push   $0x803f69
+  80023b:	6a 64                	push   $0x64
+  80023d:	68 18 3f 80 00       	push   $0x803f18
+  800242:	e8 18 03 00 00       	call   80055f <_panic>
+  800247:	52                   	push   %edx
+  800248:	68 c0 3f 80 00       	push   $0x803fc0
+  80024d:	6a 66                	push   $0x66
+  80024f:	68 18 3f 80 00       	push   $0x803f18
+  800254:	e8 06 03 00 00       	call   80055f <_panic>
+  800259:	50                   	push   %eax
+  80025a:	68 76 3f 80 00       	push   $0x803f76
+  80025f:	6a 68                	push   $0x68
+  800261:	68 18 3f 80 00       	push   $0x803f18
+  800266:	e8 f4 02 00 00       	call   80055f <_panic>
+  80026b:	83 ec 0c             	sub    $0xc,%esp
+  80026e:	53                   	push   %ebx
+  80026f:	68 88 3f 80 00       	push   $0x803f88
+  800274:	68 90 3f 80 00       	push   $0x803f90
+  800279:	6a 50                	push   $0x50
+  80027b:	8d 45 98             	lea    -0x68(%ebp),%eax
+  80027e:	50                   	push   %eax
+  80027f:	e8 47 0a 00 00       	call   800ccb <snprintf>
+  800284:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800287:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  80028a:	83 c4 20             	add    $0x20,%esp
+  80028d:	eb 40                	jmp    8002cf <umain+0x29c>
+  80028f:	83 ec 04             	sub    $0x4,%esp
+  800292:	8d 45 98             	lea    -0x68(%ebp),%eax
+  800295:	50                   	push   %eax
+  800296:	89 f0                	mov    %esi,%eax
+  800298:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  80029b:	29 c8                	sub    %ecx,%eax
+  80029d:	50                   	push   %eax
+  80029e:	68 9f 3f 80 00       	push   $0x803f9f
+  8002a3:	e8 92 03 00 00       	call   80063a <cprintf>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	89 da                	mov    %ebx,%edx
+  8002ad:	c1 ea 1f             	shr    $0x1f,%edx
+  8002b0:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8002b3:	83 e0 01             	and    $0x1,%eax
+  8002b6:	29 d0                	sub    %edx,%eax
+  8002b8:	83 f8 01             	cmp    $0x1,%eax
+  8002bb:	74 4e                	je     80030b <umain+0x2d8>
+  8002bd:	83 ff 07             	cmp    $0x7,%edi
+  8002c0:	74 51                	je     800313 <umain+0x2e0>
+  8002c2:	83 c3 01             	add    $0x1,%ebx
+  8002c5:	39 5d 84             	cmp    %ebx,-0x7c(%ebp)
+  8002c8:	74 51                	je     80031b <umain+0x2e8>
+  8002ca:	f6 c3 0f             	test   $0xf,%bl
+  8002cd:	74 9c                	je     80026b <umain+0x238>
+  8002cf:	0f b6 83 04 b0 fe 0f 	movzbl 0xffeb004(%ebx),%eax
+  8002d6:	50                   	push   %eax
+  8002d7:	68 9a 3f 80 00       	push   $0x803f9a
+  8002dc:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002df:	29 f0                	sub    %esi,%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	56                   	push   %esi
+  8002e3:	e8 e3 09 00 00       	call   800ccb <snprintf>
+  8002e8:	01 c6                	add    %eax,%esi
+  8002ea:	89 d8                	mov    %ebx,%eax
+  8002ec:	c1 f8 1f             	sar    $0x1f,%eax
+  8002ef:	c1 e8 1c             	shr    $0x1c,%eax
+  8002f2:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+  8002f5:	83 e7 0f             	and    $0xf,%edi
+  8002f8:	29 c7                	sub    %eax,%edi
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	83 ff 0f             	cmp    $0xf,%edi
+  800300:	74 8d                	je     80028f <umain+0x25c>
+  800302:	8b 45 80             	mov    -0x80(%ebp),%eax
+  800305:	39 c3                	cmp    %eax,%ebx
+  800307:	75 a2                	jne    8002ab <umain+0x278>
+  800309:	eb 84                	jmp    80028f <umain+0x25c>
+  80030b:	c6 06 20             	movb   $0x20,(%esi)
+  80030e:	8d 76 01             	lea    0x1(%esi),%esi
+  800311:	eb aa                	jmp    8002bd <umain+0x28a>
+  800313:	c6 06 20             	movb   $0x20,(%esi)
+  800316:	8d 76 01             	lea    0x1(%esi),%esi
+  800319:	eb a7                	jmp    8002c2 <umain+0x28f>
+  80031b:	83 ec 0c             	sub    $0xc,%esp
+  80031e:	68 bb 3f 80 00       	push   $0x803fbb
+  800323:	e8 12 03 00 00       	call   80063a <cprintf>
+  800328:	83 c4 10             	add    $0x10,%esp
+  80032b:	83 bd 7c ff ff ff 00 	cmpl   $0x0,-0x84(%ebp)
+  800332:	75 64                	jne    800398 <umain+0x365>
+  800334:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  80033b:	00 00 00 
+  80033e:	83 ec 04             	sub    $0x4,%esp
+  800341:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800344:	50                   	push   %eax
+  800345:	68 00 b0 fe 0f       	push   $0xffeb000
+  80034a:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	e8 dd 1b 00 00       	call   801f30 <ipc_recv>
+  800353:	83 c4 10             	add    $0x10,%esp
+  800356:	85 c0                	test   %eax,%eax
+  800358:	0f 88 d7 fe ff ff    	js     800235 <umain+0x202>
+  80035e:	8b 55 90             	mov    -0x70(%ebp),%edx
+  800361:	3b 15 00 60 80 00    	cmp    0x806000,%edx
+  800367:	0f 85 da fe ff ff    	jne    800247 <umain+0x214>
+  80036d:	83 f8 0a             	cmp    $0xa,%eax
+  800370:	0f 85 e3 fe ff ff    	jne    800259 <umain+0x226>
+  800376:	8b 0d 00 b0 fe 0f    	mov    0xffeb000,%ecx
+  80037c:	85 c9                	test   %ecx,%ecx
+  80037e:	7e 9b                	jle    80031b <umain+0x2e8>
+  800380:	be 00 00 00 00       	mov    $0x0,%esi
+  800385:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80038a:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  80038d:	89 45 80             	mov    %eax,-0x80(%ebp)
+  800390:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+  800393:	e9 32 ff ff ff       	jmp    8002ca <umain+0x297>
+  800398:	83 ec 0c             	sub    $0xc,%esp
+  80039b:	68 a5 3f 80 00       	push   $0x803fa5
+  8003a0:	e8 95 02 00 00       	call   80063a <cprintf>
+  8003a5:	83 c4 10             	add    $0x10,%esp
+  8003a8:	eb 8a                	jmp    800334 <umain+0x301>
+
+008003aa <timer>:
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	57                   	push   %edi
+  8003ae:	56                   	push   %esi
+  8003af:	53                   	push   %ebx
+  8003b0:	83 ec 1c             	sub    $0x1c,%esp
+  8003b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003b6:	e8 a0 11 00 00       	call   80155b <sys_time_msec>
+  8003bb:	03 45 0c             	add    0xc(%ebp),%eax
+  8003be:	89 c3                	mov    %eax,%ebx
+  8003c0:	c7 05 00 50 80 00 e5 	movl   $0x803fe5,0x805000
+  8003c7:	3f 80 00 
+  8003ca:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  8003cd:	eb 05                	jmp    8003d4 <timer+0x2a>
+  8003cf:	e8 72 0d 00 00       	call   801146 <sys_yield>
+  8003d4:	e8 82 11 00 00       	call   80155b <sys_time_msec>
+  8003d9:	39 d8                	cmp    %ebx,%eax
+  8003db:	73 16                	jae    8003f3 <timer+0x49>
+  8003dd:	85 c0                	test   %eax,%eax
+  8003df:	79 ee                	jns    8003cf <timer+0x25>
+  8003e1:	50                   	push   %eax
+  8003e2:	68 ee 3f 80 00       	push   $0x803fee
+  8003e7:	6a 0f                	push   $0xf
+  8003e9:	68 00 40 80 00       	push   $0x804000
+  8003ee:	e8 6c 01 00 00       	call   80055f <_panic>
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	78 ea                	js     8003e1 <timer+0x37>
+  8003f7:	6a 00                	push   $0x0
+  8003f9:	6a 00                	push   $0x0
+  8003fb:	6a 0c                	push   $0xc
+  8003fd:	56                   	push   %esi
+  8003fe:	e8 8b 1b 00 00       	call   801f8e <ipc_send>
+  800403:	83 c4 10             	add    $0x10,%esp
+  800406:	83 ec 04             	sub    $0x4,%esp
+  800409:	6a 00                	push   $0x0
+  80040b:	6a 00                	push   $0x0
+  80040d:	57                   	push   %edi
+  80040e:	e8 1d 1b 00 00       	call   801f30 <ipc_recv>
+  800413:	89 c3                	mov    %eax,%ebx
+  800415:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800418:	83 c4 10             	add    $0x10,%esp
+  80041b:	39 f0                	cmp    %esi,%eax
+  80041d:	75 09                	jne    800428 <timer+0x7e>
+  80041f:	e8 37 11 00 00       	call   80155b <sys_time_msec>
+  800424:	01 c3                	add    %eax,%ebx
+  800426:	eb ac                	jmp    8003d4 <timer+0x2a>
+  800428:	83 ec 08             	sub    $0x8,%esp
+  80042b:	50                   	push   %eax
+  80042c:	68 0c 40 80 00       	push   $0x80400c
+  800431:	e8 04 02 00 00       	call   80063a <cprintf>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	eb cb                	jmp    800406 <timer+0x5c>
+
+0080043b <input>:
+  80043b:	55                   	push   %ebp
+  80043c:	89 e5                	mov    %esp,%ebp
+  80043e:	53                   	push   %ebx
+  80043f:	83 ec 04             	sub    $0x4,%esp
+  800442:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800445:	c7 05 00 50 80 00 47 	movl   $0x804047,0x805000
+  80044c:	40 80 00 
+  80044f:	eb 05                	jmp    800456 <input+0x1b>
+  800451:	e8 f0 0c 00 00       	call   801146 <sys_yield>
+  800456:	83 ec 0c             	sub    $0xc,%esp
+  800459:	68 00 80 80 00       	push   $0x808000
+  80045e:	e8 06 12 00 00       	call   801669 <sys_net_recv_page>
+  800463:	83 c4 10             	add    $0x10,%esp
+  800466:	85 c0                	test   %eax,%eax
+  800468:	79 10                	jns    80047a <input+0x3f>
+  80046a:	83 f8 ef             	cmp    $0xffffffef,%eax
+  80046d:	75 e2                	jne    800451 <input+0x16>
+  80046f:	e8 15 12 00 00       	call   801689 <sys_net_wait>
+  800474:	85 c0                	test   %eax,%eax
+  800476:	79 de                	jns    800456 <input+0x1b>
+  800478:	eb d7                	jmp    800451 <input+0x16>
+  80047a:	6a 07                	push   $0x7
+  80047c:	68 00 80 80 00       	push   $0x808000
+  800481:	6a 0a                	push   $0xa
+  800483:	53                   	push   %ebx
+  800484:	e8 63 0f 00 00       	call   8013ec <sys_ipc_try_send>
+  800489:	83 c4 10             	add    $0x10,%esp
+  80048c:	85 c0                	test   %eax,%eax
+  80048e:	78 ea                	js     80047a <input+0x3f>
+  800490:	eb c4                	jmp    800456 <input+0x1b>
+
+00800492 <output>:
+  800492:	55                   	push   %ebp
+  800493:	89 e5                	mov    %esp,%ebp
+  800495:	53                   	push   %ebx
+  800496:	83 ec 04             	sub    $0x4,%esp
+  800499:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80049c:	c7 05 00 50 80 00 50 	movl   $0x804050,0x805000
+  8004a3:	40 80 00 
+  8004a6:	83 ec 0c             	sub    $0xc,%esp
+  8004a9:	68 00 80 80 00       	push   $0x808000
+  8004ae:	e8 89 0f 00 00       	call   80143c <sys_ipc_recv>
+  8004b3:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  8004b8:	8b 50 74             	mov    0x74(%eax),%edx
+  8004bb:	83 c4 10             	add    $0x10,%esp
+  8004be:	39 da                	cmp    %ebx,%edx
+  8004c0:	75 e4                	jne    8004a6 <output+0x14>
+  8004c2:	8b 40 70             	mov    0x70(%eax),%eax
+  8004c5:	83 f8 0b             	cmp    $0xb,%eax
+  8004c8:	75 dc                	jne    8004a6 <output+0x14>
+  8004ca:	83 ec 08             	sub    $0x8,%esp
+  8004cd:	ff 35 00 80 80 00    	push   0x808000
+  8004d3:	68 04 80 80 00       	push   $0x808004
+  8004d8:	e8 08 11 00 00       	call   8015e5 <sys_net_try_send>
+  8004dd:	83 c4 10             	add    $0x10,%esp
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	75 e6                	jne    8004ca <output+0x38>
+  8004e4:	eb c0                	jmp    8004a6 <output+0x14>
+
+008004e6 <libmain>:
+  8004e6:	55                   	push   %ebp
+  8004e7:	89 e5                	mov    %esp,%ebp
+  8004e9:	56                   	push   %esi
+  8004ea:	53                   	push   %ebx
+  8004eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8004f1:	e8 31 0c 00 00       	call   801127 <sys_getenvid>
+  8004f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004fb:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800501:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800506:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  80050b:	85 db                	test   %ebx,%ebx
+  80050d:	7e 07                	jle    800516 <libmain+0x30>
+  80050f:	8b 06                	mov    (%esi),%eax
+  800511:	a3 00 50 80 00       	mov    %eax,0x805000
+  800516:	83 ec 08             	sub    $0x8,%esp
+  800519:	56                   	push   %esi
+  80051a:	53                   	push   %ebx
+  80051b:	e8 13 fb ff ff       	call   800033 <umain>
+  800520:	e8 0a 00 00 00       	call   80052f <exit>
+  800525:	83 c4 10             	add    $0x10,%esp
+  800528:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80052b:	5b                   	pop    %ebx
+  80052c:	5e                   	pop    %esi
+  80052d:	5d                   	pop    %ebp
+  80052e:	c3                   	ret
+
+0080052f <exit>:
+  80052f:	55                   	push   %ebp
+  800530:	89 e5                	mov    %esp,%ebp
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  80053a:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800540:	85 c0                	test   %eax,%eax
+  800542:	75 14                	jne    800558 <exit+0x29>
+  800544:	e8 1e 1e 00 00       	call   802367 <close_all>
+  800549:	83 ec 0c             	sub    $0xc,%esp
+  80054c:	6a 00                	push   $0x0
+  80054e:	e8 93 0b 00 00       	call   8010e6 <sys_env_destroy>
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	c9                   	leave
+  800557:	c3                   	ret
+  800558:	e8 f6 12 00 00       	call   801853 <sys_lease_complete>
+  80055d:	eb e5                	jmp    800544 <exit+0x15>
+
+0080055f <_panic>:
+  80055f:	55                   	push   %ebp
+  800560:	89 e5                	mov    %esp,%ebp
+  800562:	56                   	push   %esi
+  800563:	53                   	push   %ebx
+  800564:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800567:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80056d:	e8 b5 0b 00 00       	call   801127 <sys_getenvid>
+  800572:	83 ec 0c             	sub    $0xc,%esp
+  800575:	ff 75 0c             	push   0xc(%ebp)
+  800578:	ff 75 08             	push   0x8(%ebp)
+  80057b:	56                   	push   %esi
+  80057c:	50                   	push   %eax
+  80057d:	68 64 40 80 00       	push   $0x804064
+  800582:	e8 b3 00 00 00       	call   80063a <cprintf>
+  800587:	83 c4 18             	add    $0x18,%esp
+  80058a:	53                   	push   %ebx
+  80058b:	ff 75 10             	push   0x10(%ebp)
+  80058e:	e8 56 00 00 00       	call   8005e9 <vcprintf>
+  800593:	c7 04 24 bb 3f 80 00 	movl   $0x803fbb,(%esp)
+  80059a:	e8 9b 00 00 00       	call   80063a <cprintf>
+  80059f:	83 c4 10             	add    $0x10,%esp
+  8005a2:	cc                   	int3
+  8005a3:	eb fd                	jmp    8005a2 <_panic+0x43>
+
+008005a5 <putch>:
+  8005a5:	55                   	push   %ebp
+  8005a6:	89 e5                	mov    %esp,%ebp
+  8005a8:	53                   	push   %ebx
+  8005a9:	83 ec 04             	sub    $0x4,%esp
+  8005ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005af:	8b 13                	mov    (%ebx),%edx
+  8005b1:	8d 42 01             	lea    0x1(%edx),%eax
+  8005b4:	89 03                	mov    %eax,(%ebx)
+  8005b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005b9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8005bd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005c2:	74 09                	je     8005cd <putch+0x28>
+  8005c4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8005c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005cb:	c9                   	leave
+  8005cc:	c3                   	ret
+  8005cd:	83 ec 08             	sub    $0x8,%esp
+  8005d0:	68 ff 00 00 00       	push   $0xff
+  8005d5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005d8:	50                   	push   %eax
+  8005d9:	e8 cb 0a 00 00       	call   8010a9 <sys_cputs>
+  8005de:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005e4:	83 c4 10             	add    $0x10,%esp
+  8005e7:	eb db                	jmp    8005c4 <putch+0x1f>
+
+008005e9 <vcprintf>:
+  8005e9:	55                   	push   %ebp
+  8005ea:	89 e5                	mov    %esp,%ebp
+  8005ec:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8005f2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005f9:	00 00 00 
+  8005fc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800603:	00 00 00 
+  800606:	ff 75 0c             	push   0xc(%ebp)
+  800609:	ff 75 08             	push   0x8(%ebp)
+  80060c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800612:	50                   	push   %eax
+  800613:	68 a5 05 80 00       	push   $0x8005a5
+  800618:	e8 1c 01 00 00       	call   800739 <vprintfmt>
+  80061d:	83 c4 08             	add    $0x8,%esp
+  800620:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800626:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80062c:	50                   	push   %eax
+  80062d:	e8 77 0a 00 00       	call   8010a9 <sys_cputs>
+  800632:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800638:	c9                   	leave
+  800639:	c3                   	ret
+
+0080063a <cprintf>:
+  80063a:	55                   	push   %ebp
+  80063b:	89 e5                	mov    %esp,%ebp
+  80063d:	83 ec 10             	sub    $0x10,%esp
+  800640:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800643:	50                   	push   %eax
+  800644:	ff 75 08             	push   0x8(%ebp)
+  800647:	e8 9d ff ff ff       	call   8005e9 <vcprintf>
+  80064c:	c9                   	leave
+  80064d:	c3                   	ret
+
+0080064e <printnum>:
+  80064e:	55                   	push   %ebp
+  80064f:	89 e5                	mov    %esp,%ebp
+  800651:	57                   	push   %edi
+  800652:	56                   	push   %esi
+  800653:	53                   	push   %ebx
+  800654:	83 ec 1c             	sub    $0x1c,%esp
+  800657:	89 c3                	mov    %eax,%ebx
+  800659:	89 d6                	mov    %edx,%esi
+  80065b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80065e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800661:	89 d1                	mov    %edx,%ecx
+  800663:	89 c2                	mov    %eax,%edx
+  800665:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800668:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80066b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80066e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800671:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800678:	39 c2                	cmp    %eax,%edx
+  80067a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80067d:	73 4b                	jae    8006ca <printnum+0x7c>
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800685:	85 ff                	test   %edi,%edi
+  800687:	7e 11                	jle    80069a <printnum+0x4c>
+  800689:	83 ec 08             	sub    $0x8,%esp
+  80068c:	56                   	push   %esi
+  80068d:	ff 75 18             	push   0x18(%ebp)
+  800690:	ff d3                	call   *%ebx
+  800692:	83 c4 10             	add    $0x10,%esp
+  800695:	83 ef 01             	sub    $0x1,%edi
+  800698:	75 ef                	jne    800689 <printnum+0x3b>
+  80069a:	83 ec 08             	sub    $0x8,%esp
+  80069d:	56                   	push   %esi
+  80069e:	83 ec 04             	sub    $0x4,%esp
+  8006a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8006a4:	ff 75 e0             	push   -0x20(%ebp)
+  8006a7:	ff 75 dc             	push   -0x24(%ebp)
+  8006aa:	ff 75 d8             	push   -0x28(%ebp)
+  8006ad:	e8 49 37 00 00       	call   803dfb <__umoddi3>
+  8006b2:	83 c4 14             	add    $0x14,%esp
+  8006b5:	0f be 80 87 40 80 00 	movsbl 0x804087(%eax),%eax
+  8006bc:	50                   	push   %eax
+  8006bd:	ff d3                	call   *%ebx
+  8006bf:	83 c4 10             	add    $0x10,%esp
+  8006c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c5:	5b                   	pop    %ebx
+  8006c6:	5e                   	pop    %esi
+  8006c7:	5f                   	pop    %edi
+  8006c8:	5d                   	pop    %ebp
+  8006c9:	c3                   	ret
+  8006ca:	83 ec 0c             	sub    $0xc,%esp
+  8006cd:	ff 75 18             	push   0x18(%ebp)
+  8006d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006d3:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8006d6:	52                   	push   %edx
+  8006d7:	50                   	push   %eax
+  8006d8:	83 ec 08             	sub    $0x8,%esp
+  8006db:	ff 75 e4             	push   -0x1c(%ebp)
+  8006de:	ff 75 e0             	push   -0x20(%ebp)
+  8006e1:	ff 75 dc             	push   -0x24(%ebp)
+  8006e4:	ff 75 d8             	push   -0x28(%ebp)
+  8006e7:	e8 f1 36 00 00       	call   803ddd <__udivdi3>
+  8006ec:	83 c4 18             	add    $0x18,%esp
+  8006ef:	52                   	push   %edx
+  8006f0:	50                   	push   %eax
+  8006f1:	89 f2                	mov    %esi,%edx
+  8006f3:	89 d8                	mov    %ebx,%eax
+  8006f5:	e8 54 ff ff ff       	call   80064e <printnum>
+  8006fa:	83 c4 20             	add    $0x20,%esp
+  8006fd:	eb 9b                	jmp    80069a <printnum+0x4c>
+
+008006ff <sprintputch>:
+  8006ff:	55                   	push   %ebp
+  800700:	89 e5                	mov    %esp,%ebp
+  800702:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800705:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800709:	8b 10                	mov    (%eax),%edx
+  80070b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80070e:	73 0a                	jae    80071a <sprintputch+0x1b>
+  800710:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800713:	89 08                	mov    %ecx,(%eax)
+  800715:	8b 45 08             	mov    0x8(%ebp),%eax
+  800718:	88 02                	mov    %al,(%edx)
+  80071a:	5d                   	pop    %ebp
+  80071b:	c3                   	ret
+
+0080071c <printfmt>:
+  80071c:	55                   	push   %ebp
+  80071d:	89 e5                	mov    %esp,%ebp
+  80071f:	83 ec 08             	sub    $0x8,%esp
+  800722:	8d 45 14             	lea    0x14(%ebp),%eax
+  800725:	50                   	push   %eax
+  800726:	ff 75 10             	push   0x10(%ebp)
+  800729:	ff 75 0c             	push   0xc(%ebp)
+  80072c:	ff 75 08             	push   0x8(%ebp)
+  80072f:	e8 05 00 00 00       	call   800739 <vprintfmt>
+  800734:	83 c4 10             	add    $0x10,%esp
+  800737:	c9                   	leave
+  800738:	c3                   	ret
+
+00800739 <vprintfmt>:
+  800739:	55                   	push   %ebp
+  80073a:	89 e5                	mov    %esp,%ebp
+  80073c:	57                   	push   %edi
+  80073d:	56                   	push   %esi
+  80073e:	53                   	push   %ebx
+  80073f:	83 ec 2c             	sub    $0x2c,%esp
+  800742:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800745:	89 df                	mov    %ebx,%edi
+  800747:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80074a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80074d:	8d 70 01             	lea    0x1(%eax),%esi
+  800750:	0f b6 00             	movzbl (%eax),%eax
+  800753:	83 f8 25             	cmp    $0x25,%eax
+  800756:	74 1e                	je     800776 <vprintfmt+0x3d>
+  800758:	85 c0                	test   %eax,%eax
+  80075a:	0f 84 15 05 00 00    	je     800c75 <vprintfmt+0x53c>
+  800760:	83 ec 08             	sub    $0x8,%esp
+  800763:	53                   	push   %ebx
+  800764:	50                   	push   %eax
+  800765:	ff d7                	call   *%edi
+  800767:	83 c6 01             	add    $0x1,%esi
+  80076a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80076e:	83 c4 10             	add    $0x10,%esp
+  800771:	83 f8 25             	cmp    $0x25,%eax
+  800774:	75 e2                	jne    800758 <vprintfmt+0x1f>
+  800776:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80077a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800781:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800788:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80078f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800794:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800797:	8d 56 01             	lea    0x1(%esi),%edx
+  80079a:	0f b6 0e             	movzbl (%esi),%ecx
+  80079d:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8007a0:	3c 55                	cmp    $0x55,%al
+  8007a2:	0f 87 3b 04 00 00    	ja     800be3 <vprintfmt+0x4aa>
+  8007a8:	0f b6 c0             	movzbl %al,%eax
+  8007ab:	ff 24 85 c0 41 80 00 	jmp    *0x8041c0(,%eax,4)
+  8007b2:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007b5:	eb 93                	jmp    80074a <vprintfmt+0x11>
+  8007b7:	89 d6                	mov    %edx,%esi
+  8007b9:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8007bd:	eb d8                	jmp    800797 <vprintfmt+0x5e>
+  8007bf:	89 d6                	mov    %edx,%esi
+  8007c1:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8007c5:	eb d0                	jmp    800797 <vprintfmt+0x5e>
+  8007c7:	0f b6 c9             	movzbl %cl,%ecx
+  8007ca:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8007cd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8007d0:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8007d4:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8007d7:	83 f9 09             	cmp    $0x9,%ecx
+  8007da:	77 6f                	ja     80084b <vprintfmt+0x112>
+  8007dc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8007df:	83 c2 01             	add    $0x1,%edx
+  8007e2:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8007e5:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8007e9:	0f be 02             	movsbl (%edx),%eax
+  8007ec:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8007ef:	83 fe 09             	cmp    $0x9,%esi
+  8007f2:	76 eb                	jbe    8007df <vprintfmt+0xa6>
+  8007f4:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8007f7:	89 d6                	mov    %edx,%esi
+  8007f9:	eb 13                	jmp    80080e <vprintfmt+0xd5>
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8b 00                	mov    (%eax),%eax
+  800800:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8d 40 04             	lea    0x4(%eax),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080c:	89 d6                	mov    %edx,%esi
+  80080e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800812:	79 83                	jns    800797 <vprintfmt+0x5e>
+  800814:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800817:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80081a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800821:	e9 71 ff ff ff       	jmp    800797 <vprintfmt+0x5e>
+  800826:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800829:	85 c9                	test   %ecx,%ecx
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	0f 49 c1             	cmovns %ecx,%eax
+  800833:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800836:	89 d6                	mov    %edx,%esi
+  800838:	e9 5a ff ff ff       	jmp    800797 <vprintfmt+0x5e>
+  80083d:	89 d6                	mov    %edx,%esi
+  80083f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800846:	e9 4c ff ff ff       	jmp    800797 <vprintfmt+0x5e>
+  80084b:	89 d6                	mov    %edx,%esi
+  80084d:	eb bf                	jmp    80080e <vprintfmt+0xd5>
+  80084f:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800853:	89 d6                	mov    %edx,%esi
+  800855:	e9 3d ff ff ff       	jmp    800797 <vprintfmt+0x5e>
+  80085a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80085d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800860:	8d 70 04             	lea    0x4(%eax),%esi
+  800863:	83 ec 08             	sub    $0x8,%esp
+  800866:	53                   	push   %ebx
+  800867:	ff 30                	push   (%eax)
+  800869:	ff d7                	call   *%edi
+  80086b:	83 c4 10             	add    $0x10,%esp
+  80086e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800871:	e9 d4 fe ff ff       	jmp    80074a <vprintfmt+0x11>
+  800876:	89 55 10             	mov    %edx,0x10(%ebp)
+  800879:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087c:	8d 70 04             	lea    0x4(%eax),%esi
+  80087f:	8b 10                	mov    (%eax),%edx
+  800881:	89 d0                	mov    %edx,%eax
+  800883:	f7 d8                	neg    %eax
+  800885:	0f 48 c2             	cmovs  %edx,%eax
+  800888:	83 f8 12             	cmp    $0x12,%eax
+  80088b:	7f 23                	jg     8008b0 <vprintfmt+0x177>
+  80088d:	8b 14 85 20 43 80 00 	mov    0x804320(,%eax,4),%edx
+  800894:	85 d2                	test   %edx,%edx
+  800896:	74 18                	je     8008b0 <vprintfmt+0x177>
+  800898:	52                   	push   %edx
+  800899:	68 cf 45 80 00       	push   $0x8045cf
+  80089e:	53                   	push   %ebx
+  80089f:	57                   	push   %edi
+  8008a0:	e8 77 fe ff ff       	call   80071c <printfmt>
+  8008a5:	83 c4 10             	add    $0x10,%esp
+  8008a8:	89 75 14             	mov    %esi,0x14(%ebp)
+  8008ab:	e9 9a fe ff ff       	jmp    80074a <vprintfmt+0x11>
+  8008b0:	50                   	push   %eax
+  8008b1:	68 9f 40 80 00       	push   $0x80409f
+  8008b6:	53                   	push   %ebx
+  8008b7:	57                   	push   %edi
+  8008b8:	e8 5f fe ff ff       	call   80071c <printfmt>
+  8008bd:	83 c4 10             	add    $0x10,%esp
+  8008c0:	89 75 14             	mov    %esi,0x14(%ebp)
+  8008c3:	e9 82 fe ff ff       	jmp    80074a <vprintfmt+0x11>
+  8008c8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ce:	83 c0 04             	add    $0x4,%eax
+  8008d1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d7:	8b 00                	mov    (%eax),%eax
+  8008d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008dc:	85 c0                	test   %eax,%eax
+  8008de:	0f 84 61 03 00 00    	je     800c45 <vprintfmt+0x50c>
+  8008e4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008e8:	7e 06                	jle    8008f0 <vprintfmt+0x1b7>
+  8008ea:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008ee:	75 29                	jne    800919 <vprintfmt+0x1e0>
+  8008f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008f3:	8d 70 01             	lea    0x1(%eax),%esi
+  8008f6:	0f b6 00             	movzbl (%eax),%eax
+  8008f9:	0f be d0             	movsbl %al,%edx
+  8008fc:	85 d2                	test   %edx,%edx
+  8008fe:	0f 84 bb 00 00 00    	je     8009bf <vprintfmt+0x286>
+  800904:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800907:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80090a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80090d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800910:	eb 7a                	jmp    80098c <vprintfmt+0x253>
+  800912:	c7 45 d0 98 40 80 00 	movl   $0x804098,-0x30(%ebp)
+  800919:	83 ec 08             	sub    $0x8,%esp
+  80091c:	ff 75 d4             	push   -0x2c(%ebp)
+  80091f:	ff 75 d0             	push   -0x30(%ebp)
+  800922:	e8 e0 03 00 00       	call   800d07 <strnlen>
+  800927:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80092a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80092d:	83 c4 10             	add    $0x10,%esp
+  800930:	85 d2                	test   %edx,%edx
+  800932:	0f 8e d6 02 00 00    	jle    800c0e <vprintfmt+0x4d5>
+  800938:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80093c:	83 ec 08             	sub    $0x8,%esp
+  80093f:	53                   	push   %ebx
+  800940:	56                   	push   %esi
+  800941:	ff d7                	call   *%edi
+  800943:	83 c4 10             	add    $0x10,%esp
+  800946:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80094a:	75 f0                	jne    80093c <vprintfmt+0x203>
+  80094c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80094f:	8d 70 01             	lea    0x1(%eax),%esi
+  800952:	0f b6 00             	movzbl (%eax),%eax
+  800955:	0f be d0             	movsbl %al,%edx
+  800958:	85 d2                	test   %edx,%edx
+  80095a:	0f 84 da 02 00 00    	je     800c3a <vprintfmt+0x501>
+  800960:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800963:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800966:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800969:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80096c:	eb 1e                	jmp    80098c <vprintfmt+0x253>
+  80096e:	83 ec 08             	sub    $0x8,%esp
+  800971:	ff 75 0c             	push   0xc(%ebp)
+  800974:	52                   	push   %edx
+  800975:	ff 55 08             	call   *0x8(%ebp)
+  800978:	83 c4 10             	add    $0x10,%esp
+  80097b:	83 eb 01             	sub    $0x1,%ebx
+  80097e:	83 c6 01             	add    $0x1,%esi
+  800981:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800985:	0f be d0             	movsbl %al,%edx
+  800988:	85 d2                	test   %edx,%edx
+  80098a:	74 2a                	je     8009b6 <vprintfmt+0x27d>
+  80098c:	85 ff                	test   %edi,%edi
+  80098e:	78 05                	js     800995 <vprintfmt+0x25c>
+  800990:	83 ef 01             	sub    $0x1,%edi
+  800993:	78 59                	js     8009ee <vprintfmt+0x2b5>
+  800995:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800999:	74 d3                	je     80096e <vprintfmt+0x235>
+  80099b:	0f be c0             	movsbl %al,%eax
+  80099e:	83 e8 20             	sub    $0x20,%eax
+  8009a1:	83 f8 5e             	cmp    $0x5e,%eax
+  8009a4:	76 c8                	jbe    80096e <vprintfmt+0x235>
+  8009a6:	83 ec 08             	sub    $0x8,%esp
+  8009a9:	ff 75 0c             	push   0xc(%ebp)
+  8009ac:	6a 3f                	push   $0x3f
+  8009ae:	ff 55 08             	call   *0x8(%ebp)
+  8009b1:	83 c4 10             	add    $0x10,%esp
+  8009b4:	eb c5                	jmp    80097b <vprintfmt+0x242>
+  8009b6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009bf:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8009c2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009c6:	7e 1b                	jle    8009e3 <vprintfmt+0x2aa>
+  8009c8:	83 ec 08             	sub    $0x8,%esp
+  8009cb:	53                   	push   %ebx
+  8009cc:	6a 20                	push   $0x20
+  8009ce:	ff d7                	call   *%edi
+  8009d0:	83 c4 10             	add    $0x10,%esp
+  8009d3:	83 ee 01             	sub    $0x1,%esi
+  8009d6:	75 f0                	jne    8009c8 <vprintfmt+0x28f>
+  8009d8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009de:	e9 67 fd ff ff       	jmp    80074a <vprintfmt+0x11>
+  8009e3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009e9:	e9 5c fd ff ff       	jmp    80074a <vprintfmt+0x11>
+  8009ee:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009f7:	eb c6                	jmp    8009bf <vprintfmt+0x286>
+  8009f9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009fc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009ff:	83 f9 01             	cmp    $0x1,%ecx
+  800a02:	7f 1f                	jg     800a23 <vprintfmt+0x2ea>
+  800a04:	85 c9                	test   %ecx,%ecx
+  800a06:	74 67                	je     800a6f <vprintfmt+0x336>
+  800a08:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0b:	8b 30                	mov    (%eax),%esi
+  800a0d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a10:	89 f0                	mov    %esi,%eax
+  800a12:	c1 f8 1f             	sar    $0x1f,%eax
+  800a15:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a1e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a21:	eb 17                	jmp    800a3a <vprintfmt+0x301>
+  800a23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a26:	8b 50 04             	mov    0x4(%eax),%edx
+  800a29:	8b 00                	mov    (%eax),%eax
+  800a2b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a2e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a31:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a34:	8d 40 08             	lea    0x8(%eax),%eax
+  800a37:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a3a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a3d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a40:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a45:	85 c9                	test   %ecx,%ecx
+  800a47:	0f 89 12 01 00 00    	jns    800b5f <vprintfmt+0x426>
+  800a4d:	83 ec 08             	sub    $0x8,%esp
+  800a50:	53                   	push   %ebx
+  800a51:	6a 2d                	push   $0x2d
+  800a53:	ff d7                	call   *%edi
+  800a55:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a58:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a5b:	f7 da                	neg    %edx
+  800a5d:	83 d1 00             	adc    $0x0,%ecx
+  800a60:	f7 d9                	neg    %ecx
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a6a:	e9 f0 00 00 00       	jmp    800b5f <vprintfmt+0x426>
+  800a6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a72:	8b 30                	mov    (%eax),%esi
+  800a74:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a77:	89 f0                	mov    %esi,%eax
+  800a79:	c1 f8 1f             	sar    $0x1f,%eax
+  800a7c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a82:	8d 40 04             	lea    0x4(%eax),%eax
+  800a85:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a88:	eb b0                	jmp    800a3a <vprintfmt+0x301>
+  800a8a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a8d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a90:	83 f9 01             	cmp    $0x1,%ecx
+  800a93:	7f 1e                	jg     800ab3 <vprintfmt+0x37a>
+  800a95:	85 c9                	test   %ecx,%ecx
+  800a97:	74 32                	je     800acb <vprintfmt+0x392>
+  800a99:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9c:	8b 10                	mov    (%eax),%edx
+  800a9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa3:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa9:	be 0a 00 00 00       	mov    $0xa,%esi
+  800aae:	e9 ac 00 00 00       	jmp    800b5f <vprintfmt+0x426>
+  800ab3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab6:	8b 10                	mov    (%eax),%edx
+  800ab8:	8b 48 04             	mov    0x4(%eax),%ecx
+  800abb:	8d 40 08             	lea    0x8(%eax),%eax
+  800abe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac1:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ac6:	e9 94 00 00 00       	jmp    800b5f <vprintfmt+0x426>
+  800acb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ace:	8b 10                	mov    (%eax),%edx
+  800ad0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad8:	89 45 14             	mov    %eax,0x14(%ebp)
+  800adb:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ae0:	eb 7d                	jmp    800b5f <vprintfmt+0x426>
+  800ae2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ae5:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ae8:	83 f9 01             	cmp    $0x1,%ecx
+  800aeb:	7f 1b                	jg     800b08 <vprintfmt+0x3cf>
+  800aed:	85 c9                	test   %ecx,%ecx
+  800aef:	74 2c                	je     800b1d <vprintfmt+0x3e4>
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 10                	mov    (%eax),%edx
+  800af6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afb:	8d 40 04             	lea    0x4(%eax),%eax
+  800afe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b01:	be 08 00 00 00       	mov    $0x8,%esi
+  800b06:	eb 57                	jmp    800b5f <vprintfmt+0x426>
+  800b08:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0b:	8b 10                	mov    (%eax),%edx
+  800b0d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b10:	8d 40 08             	lea    0x8(%eax),%eax
+  800b13:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b16:	be 08 00 00 00       	mov    $0x8,%esi
+  800b1b:	eb 42                	jmp    800b5f <vprintfmt+0x426>
+  800b1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b20:	8b 10                	mov    (%eax),%edx
+  800b22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b27:	8d 40 04             	lea    0x4(%eax),%eax
+  800b2a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b2d:	be 08 00 00 00       	mov    $0x8,%esi
+  800b32:	eb 2b                	jmp    800b5f <vprintfmt+0x426>
+  800b34:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b37:	83 ec 08             	sub    $0x8,%esp
+  800b3a:	53                   	push   %ebx
+  800b3b:	6a 30                	push   $0x30
+  800b3d:	ff d7                	call   *%edi
+  800b3f:	83 c4 08             	add    $0x8,%esp
+  800b42:	53                   	push   %ebx
+  800b43:	6a 78                	push   $0x78
+  800b45:	ff d7                	call   *%edi
+  800b47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4a:	8b 10                	mov    (%eax),%edx
+  800b4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b51:	83 c4 10             	add    $0x10,%esp
+  800b54:	8d 40 04             	lea    0x4(%eax),%eax
+  800b57:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b5a:	be 10 00 00 00       	mov    $0x10,%esi
+  800b5f:	83 ec 0c             	sub    $0xc,%esp
+  800b62:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800b66:	50                   	push   %eax
+  800b67:	ff 75 e4             	push   -0x1c(%ebp)
+  800b6a:	56                   	push   %esi
+  800b6b:	51                   	push   %ecx
+  800b6c:	52                   	push   %edx
+  800b6d:	89 da                	mov    %ebx,%edx
+  800b6f:	89 f8                	mov    %edi,%eax
+  800b71:	e8 d8 fa ff ff       	call   80064e <printnum>
+  800b76:	83 c4 20             	add    $0x20,%esp
+  800b79:	e9 cc fb ff ff       	jmp    80074a <vprintfmt+0x11>
+  800b7e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b81:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b84:	83 f9 01             	cmp    $0x1,%ecx
+  800b87:	7f 1b                	jg     800ba4 <vprintfmt+0x46b>
+  800b89:	85 c9                	test   %ecx,%ecx
+  800b8b:	74 2c                	je     800bb9 <vprintfmt+0x480>
+  800b8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b90:	8b 10                	mov    (%eax),%edx
+  800b92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b97:	8d 40 04             	lea    0x4(%eax),%eax
+  800b9a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b9d:	be 10 00 00 00       	mov    $0x10,%esi
+  800ba2:	eb bb                	jmp    800b5f <vprintfmt+0x426>
+  800ba4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba7:	8b 10                	mov    (%eax),%edx
+  800ba9:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bac:	8d 40 08             	lea    0x8(%eax),%eax
+  800baf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bb2:	be 10 00 00 00       	mov    $0x10,%esi
+  800bb7:	eb a6                	jmp    800b5f <vprintfmt+0x426>
+  800bb9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bbc:	8b 10                	mov    (%eax),%edx
+  800bbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc3:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bc9:	be 10 00 00 00       	mov    $0x10,%esi
+  800bce:	eb 8f                	jmp    800b5f <vprintfmt+0x426>
+  800bd0:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bd3:	83 ec 08             	sub    $0x8,%esp
+  800bd6:	53                   	push   %ebx
+  800bd7:	6a 25                	push   $0x25
+  800bd9:	ff d7                	call   *%edi
+  800bdb:	83 c4 10             	add    $0x10,%esp
+  800bde:	e9 67 fb ff ff       	jmp    80074a <vprintfmt+0x11>
+  800be3:	83 ec 08             	sub    $0x8,%esp
+  800be6:	53                   	push   %ebx
+  800be7:	6a 25                	push   $0x25
+  800be9:	ff d7                	call   *%edi
+  800beb:	83 c4 10             	add    $0x10,%esp
+  800bee:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800bf2:	0f 84 ba fb ff ff    	je     8007b2 <vprintfmt+0x79>
+  800bf8:	89 75 10             	mov    %esi,0x10(%ebp)
+  800bfb:	89 f0                	mov    %esi,%eax
+  800bfd:	83 e8 01             	sub    $0x1,%eax
+  800c00:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c04:	75 f7                	jne    800bfd <vprintfmt+0x4c4>
+  800c06:	89 45 10             	mov    %eax,0x10(%ebp)
+  800c09:	e9 3c fb ff ff       	jmp    80074a <vprintfmt+0x11>
+  800c0e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800c11:	8d 70 01             	lea    0x1(%eax),%esi
+  800c14:	0f b6 00             	movzbl (%eax),%eax
+  800c17:	0f be d0             	movsbl %al,%edx
+  800c1a:	85 d2                	test   %edx,%edx
+  800c1c:	74 11                	je     800c2f <vprintfmt+0x4f6>
+  800c1e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c21:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c24:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c27:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c2a:	e9 5d fd ff ff       	jmp    80098c <vprintfmt+0x253>
+  800c2f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c32:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c35:	e9 10 fb ff ff       	jmp    80074a <vprintfmt+0x11>
+  800c3a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c3d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c40:	e9 05 fb ff ff       	jmp    80074a <vprintfmt+0x11>
+  800c45:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c49:	7e 0a                	jle    800c55 <vprintfmt+0x51c>
+  800c4b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800c4f:	0f 85 bd fc ff ff    	jne    800912 <vprintfmt+0x1d9>
+  800c55:	ba 28 00 00 00       	mov    $0x28,%edx
+  800c5a:	b8 28 00 00 00       	mov    $0x28,%eax
+  800c5f:	be 99 40 80 00       	mov    $0x804099,%esi
+  800c64:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c67:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c6a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c6d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c70:	e9 17 fd ff ff       	jmp    80098c <vprintfmt+0x253>
+  800c75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c78:	5b                   	pop    %ebx
+  800c79:	5e                   	pop    %esi
+  800c7a:	5f                   	pop    %edi
+  800c7b:	5d                   	pop    %ebp
+  800c7c:	c3                   	ret
+
+00800c7d <vsnprintf>:
+  800c7d:	55                   	push   %ebp
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	83 ec 18             	sub    $0x18,%esp
+  800c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c89:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c8c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c90:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c93:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800c9a:	85 c0                	test   %eax,%eax
+  800c9c:	74 26                	je     800cc4 <vsnprintf+0x47>
+  800c9e:	85 d2                	test   %edx,%edx
+  800ca0:	7e 22                	jle    800cc4 <vsnprintf+0x47>
+  800ca2:	ff 75 14             	push   0x14(%ebp)
+  800ca5:	ff 75 10             	push   0x10(%ebp)
+  800ca8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800cab:	50                   	push   %eax
+  800cac:	68 ff 06 80 00       	push   $0x8006ff
+  800cb1:	e8 83 fa ff ff       	call   800739 <vprintfmt>
+  800cb6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800cb9:	c6 00 00             	movb   $0x0,(%eax)
+  800cbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cbf:	83 c4 10             	add    $0x10,%esp
+  800cc2:	c9                   	leave
+  800cc3:	c3                   	ret
+  800cc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc9:	eb f7                	jmp    800cc2 <vsnprintf+0x45>
+
+00800ccb <snprintf>:
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	83 ec 08             	sub    $0x8,%esp
+  800cd1:	8d 45 14             	lea    0x14(%ebp),%eax
+  800cd4:	50                   	push   %eax
+  800cd5:	ff 75 10             	push   0x10(%ebp)
+  800cd8:	ff 75 0c             	push   0xc(%ebp)
+  800cdb:	ff 75 08             	push   0x8(%ebp)
+  800cde:	e8 9a ff ff ff       	call   800c7d <vsnprintf>
+  800ce3:	c9                   	leave
+  800ce4:	c3                   	ret
+
+00800ce5 <strlen>:
+  800ce5:	55                   	push   %ebp
+  800ce6:	89 e5                	mov    %esp,%ebp
+  800ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ceb:	80 3a 00             	cmpb   $0x0,(%edx)
+  800cee:	74 10                	je     800d00 <strlen+0x1b>
+  800cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf5:	83 c0 01             	add    $0x1,%eax
+  800cf8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cfc:	75 f7                	jne    800cf5 <strlen+0x10>
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+  800d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d05:	eb f7                	jmp    800cfe <strlen+0x19>
+
+00800d07 <strnlen>:
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d10:	85 d2                	test   %edx,%edx
+  800d12:	74 16                	je     800d2a <strnlen+0x23>
+  800d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d19:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d1d:	74 09                	je     800d28 <strnlen+0x21>
+  800d1f:	83 c0 01             	add    $0x1,%eax
+  800d22:	39 d0                	cmp    %edx,%eax
+  800d24:	75 f3                	jne    800d19 <strnlen+0x12>
+  800d26:	89 d0                	mov    %edx,%eax
+  800d28:	5d                   	pop    %ebp
+  800d29:	c3                   	ret
+  800d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2f:	eb f7                	jmp    800d28 <strnlen+0x21>
+
+00800d31 <strcpy>:
+  800d31:	55                   	push   %ebp
+  800d32:	89 e5                	mov    %esp,%ebp
+  800d34:	53                   	push   %ebx
+  800d35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d47:	83 c0 01             	add    $0x1,%eax
+  800d4a:	84 d2                	test   %dl,%dl
+  800d4c:	75 f2                	jne    800d40 <strcpy+0xf>
+  800d4e:	89 c8                	mov    %ecx,%eax
+  800d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d53:	c9                   	leave
+  800d54:	c3                   	ret
+
+00800d55 <strcat>:
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	53                   	push   %ebx
+  800d59:	83 ec 10             	sub    $0x10,%esp
+  800d5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d5f:	53                   	push   %ebx
+  800d60:	e8 80 ff ff ff       	call   800ce5 <strlen>
+  800d65:	83 c4 08             	add    $0x8,%esp
+  800d68:	ff 75 0c             	push   0xc(%ebp)
+  800d6b:	01 d8                	add    %ebx,%eax
+  800d6d:	50                   	push   %eax
+  800d6e:	e8 be ff ff ff       	call   800d31 <strcpy>
+  800d73:	89 d8                	mov    %ebx,%eax
+  800d75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d78:	c9                   	leave
+  800d79:	c3                   	ret
+
+00800d7a <strncpy>:
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d88:	85 db                	test   %ebx,%ebx
+  800d8a:	74 17                	je     800da3 <strncpy+0x29>
+  800d8c:	01 f3                	add    %esi,%ebx
+  800d8e:	89 f0                	mov    %esi,%eax
+  800d90:	83 c0 01             	add    $0x1,%eax
+  800d93:	0f b6 0a             	movzbl (%edx),%ecx
+  800d96:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800d99:	80 f9 01             	cmp    $0x1,%cl
+  800d9c:	83 da ff             	sbb    $0xffffffff,%edx
+  800d9f:	39 c3                	cmp    %eax,%ebx
+  800da1:	75 ed                	jne    800d90 <strncpy+0x16>
+  800da3:	89 f0                	mov    %esi,%eax
+  800da5:	5b                   	pop    %ebx
+  800da6:	5e                   	pop    %esi
+  800da7:	5d                   	pop    %ebp
+  800da8:	c3                   	ret
+
+00800da9 <strlcpy>:
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	56                   	push   %esi
+  800dad:	53                   	push   %ebx
+  800dae:	8b 75 08             	mov    0x8(%ebp),%esi
+  800db1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800db4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db7:	89 f0                	mov    %esi,%eax
+  800db9:	85 db                	test   %ebx,%ebx
+  800dbb:	74 1e                	je     800ddb <strlcpy+0x32>
+  800dbd:	83 eb 01             	sub    $0x1,%ebx
+  800dc0:	74 16                	je     800dd8 <strlcpy+0x2f>
+  800dc2:	01 f3                	add    %esi,%ebx
+  800dc4:	0f b6 0a             	movzbl (%edx),%ecx
+  800dc7:	84 c9                	test   %cl,%cl
+  800dc9:	74 0d                	je     800dd8 <strlcpy+0x2f>
+  800dcb:	83 c2 01             	add    $0x1,%edx
+  800dce:	83 c0 01             	add    $0x1,%eax
+  800dd1:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800dd4:	39 d8                	cmp    %ebx,%eax
+  800dd6:	75 ec                	jne    800dc4 <strlcpy+0x1b>
+  800dd8:	c6 00 00             	movb   $0x0,(%eax)
+  800ddb:	29 f0                	sub    %esi,%eax
+  800ddd:	5b                   	pop    %ebx
+  800dde:	5e                   	pop    %esi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <strcmp>:
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800de7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dea:	0f b6 01             	movzbl (%ecx),%eax
+  800ded:	84 c0                	test   %al,%al
+  800def:	74 11                	je     800e02 <strcmp+0x21>
+  800df1:	38 02                	cmp    %al,(%edx)
+  800df3:	75 0d                	jne    800e02 <strcmp+0x21>
+  800df5:	83 c1 01             	add    $0x1,%ecx
+  800df8:	83 c2 01             	add    $0x1,%edx
+  800dfb:	0f b6 01             	movzbl (%ecx),%eax
+  800dfe:	84 c0                	test   %al,%al
+  800e00:	75 ef                	jne    800df1 <strcmp+0x10>
+  800e02:	0f b6 c0             	movzbl %al,%eax
+  800e05:	0f b6 12             	movzbl (%edx),%edx
+  800e08:	29 d0                	sub    %edx,%eax
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+
+00800e0c <strncmp>:
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	53                   	push   %ebx
+  800e10:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e16:	8b 55 10             	mov    0x10(%ebp),%edx
+  800e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1e:	85 d2                	test   %edx,%edx
+  800e20:	74 2e                	je     800e50 <strncmp+0x44>
+  800e22:	0f b6 01             	movzbl (%ecx),%eax
+  800e25:	84 c0                	test   %al,%al
+  800e27:	74 16                	je     800e3f <strncmp+0x33>
+  800e29:	3a 03                	cmp    (%ebx),%al
+  800e2b:	75 12                	jne    800e3f <strncmp+0x33>
+  800e2d:	83 c1 01             	add    $0x1,%ecx
+  800e30:	83 c3 01             	add    $0x1,%ebx
+  800e33:	83 ea 01             	sub    $0x1,%edx
+  800e36:	75 ea                	jne    800e22 <strncmp+0x16>
+  800e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3d:	eb 11                	jmp    800e50 <strncmp+0x44>
+  800e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e44:	85 d2                	test   %edx,%edx
+  800e46:	74 08                	je     800e50 <strncmp+0x44>
+  800e48:	0f b6 01             	movzbl (%ecx),%eax
+  800e4b:	0f b6 13             	movzbl (%ebx),%edx
+  800e4e:	29 d0                	sub    %edx,%eax
+  800e50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e53:	c9                   	leave
+  800e54:	c3                   	ret
+
+00800e55 <strchr>:
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e5b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800e5f:	0f b6 10             	movzbl (%eax),%edx
+  800e62:	84 d2                	test   %dl,%dl
+  800e64:	74 15                	je     800e7b <strchr+0x26>
+  800e66:	38 d1                	cmp    %dl,%cl
+  800e68:	74 0f                	je     800e79 <strchr+0x24>
+  800e6a:	83 c0 01             	add    $0x1,%eax
+  800e6d:	0f b6 10             	movzbl (%eax),%edx
+  800e70:	84 d2                	test   %dl,%dl
+  800e72:	75 f2                	jne    800e66 <strchr+0x11>
+  800e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e79:	5d                   	pop    %ebp
+  800e7a:	c3                   	ret
+  800e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e80:	eb f7                	jmp    800e79 <strchr+0x24>
+
+00800e82 <strfind>:
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	53                   	push   %ebx
+  800e86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e8c:	0f b6 18             	movzbl (%eax),%ebx
+  800e8f:	38 d3                	cmp    %dl,%bl
+  800e91:	74 14                	je     800ea7 <strfind+0x25>
+  800e93:	89 d1                	mov    %edx,%ecx
+  800e95:	84 db                	test   %bl,%bl
+  800e97:	74 0e                	je     800ea7 <strfind+0x25>
+  800e99:	83 c0 01             	add    $0x1,%eax
+  800e9c:	0f b6 10             	movzbl (%eax),%edx
+  800e9f:	38 ca                	cmp    %cl,%dl
+  800ea1:	74 04                	je     800ea7 <strfind+0x25>
+  800ea3:	84 d2                	test   %dl,%dl
+  800ea5:	75 f2                	jne    800e99 <strfind+0x17>
+  800ea7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eaa:	c9                   	leave
+  800eab:	c3                   	ret
+
+00800eac <memset>:
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800eb3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800eb6:	85 c9                	test   %ecx,%ecx
+  800eb8:	74 20                	je     800eda <memset+0x2e>
+  800eba:	89 f8                	mov    %edi,%eax
+  800ebc:	09 c8                	or     %ecx,%eax
+  800ebe:	a8 03                	test   $0x3,%al
+  800ec0:	75 12                	jne    800ed4 <memset+0x28>
+  800ec2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ec6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ecc:	c1 e9 02             	shr    $0x2,%ecx
+  800ecf:	fc                   	cld
+  800ed0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ed2:	eb 06                	jmp    800eda <memset+0x2e>
+  800ed4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ed7:	fc                   	cld
+  800ed8:	f3 aa                	rep stos %al,%es:(%edi)
+  800eda:	89 f8                	mov    %edi,%eax
+  800edc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800edf:	c9                   	leave
+  800ee0:	c3                   	ret
+
+00800ee1 <memmove>:
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800eec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800eef:	39 c6                	cmp    %eax,%esi
+  800ef1:	73 32                	jae    800f25 <memmove+0x44>
+  800ef3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ef6:	39 d0                	cmp    %edx,%eax
+  800ef8:	73 2b                	jae    800f25 <memmove+0x44>
+  800efa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800efd:	89 d6                	mov    %edx,%esi
+  800eff:	09 fe                	or     %edi,%esi
+  800f01:	09 ce                	or     %ecx,%esi
+  800f03:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f09:	75 0e                	jne    800f19 <memmove+0x38>
+  800f0b:	83 ef 04             	sub    $0x4,%edi
+  800f0e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f11:	c1 e9 02             	shr    $0x2,%ecx
+  800f14:	fd                   	std
+  800f15:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f17:	eb 09                	jmp    800f22 <memmove+0x41>
+  800f19:	83 ef 01             	sub    $0x1,%edi
+  800f1c:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800f1f:	fd                   	std
+  800f20:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800f22:	fc                   	cld
+  800f23:	eb 1a                	jmp    800f3f <memmove+0x5e>
+  800f25:	89 f2                	mov    %esi,%edx
+  800f27:	09 c2                	or     %eax,%edx
+  800f29:	09 ca                	or     %ecx,%edx
+  800f2b:	f6 c2 03             	test   $0x3,%dl
+  800f2e:	75 0a                	jne    800f3a <memmove+0x59>
+  800f30:	c1 e9 02             	shr    $0x2,%ecx
+  800f33:	89 c7                	mov    %eax,%edi
+  800f35:	fc                   	cld
+  800f36:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f38:	eb 05                	jmp    800f3f <memmove+0x5e>
+  800f3a:	89 c7                	mov    %eax,%edi
+  800f3c:	fc                   	cld
+  800f3d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <memcpy>:
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	83 ec 0c             	sub    $0xc,%esp
+  800f49:	ff 75 10             	push   0x10(%ebp)
+  800f4c:	ff 75 0c             	push   0xc(%ebp)
+  800f4f:	ff 75 08             	push   0x8(%ebp)
+  800f52:	e8 8a ff ff ff       	call   800ee1 <memmove>
+  800f57:	c9                   	leave
+  800f58:	c3                   	ret
+
+00800f59 <memcmp>:
+  800f59:	55                   	push   %ebp
+  800f5a:	89 e5                	mov    %esp,%ebp
+  800f5c:	56                   	push   %esi
+  800f5d:	53                   	push   %ebx
+  800f5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f64:	8b 75 10             	mov    0x10(%ebp),%esi
+  800f67:	85 f6                	test   %esi,%esi
+  800f69:	74 29                	je     800f94 <memcmp+0x3b>
+  800f6b:	01 c6                	add    %eax,%esi
+  800f6d:	0f b6 08             	movzbl (%eax),%ecx
+  800f70:	0f b6 1a             	movzbl (%edx),%ebx
+  800f73:	38 d9                	cmp    %bl,%cl
+  800f75:	75 11                	jne    800f88 <memcmp+0x2f>
+  800f77:	83 c0 01             	add    $0x1,%eax
+  800f7a:	83 c2 01             	add    $0x1,%edx
+  800f7d:	39 c6                	cmp    %eax,%esi
+  800f7f:	75 ec                	jne    800f6d <memcmp+0x14>
+  800f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f86:	eb 08                	jmp    800f90 <memcmp+0x37>
+  800f88:	0f b6 c1             	movzbl %cl,%eax
+  800f8b:	0f b6 db             	movzbl %bl,%ebx
+  800f8e:	29 d8                	sub    %ebx,%eax
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+  800f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f99:	eb f5                	jmp    800f90 <memcmp+0x37>
+
+00800f9b <memfind>:
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa4:	89 c2                	mov    %eax,%edx
+  800fa6:	03 55 10             	add    0x10(%ebp),%edx
+  800fa9:	39 d0                	cmp    %edx,%eax
+  800fab:	73 0d                	jae    800fba <memfind+0x1f>
+  800fad:	38 08                	cmp    %cl,(%eax)
+  800faf:	74 0d                	je     800fbe <memfind+0x23>
+  800fb1:	83 c0 01             	add    $0x1,%eax
+  800fb4:	39 c2                	cmp    %eax,%edx
+  800fb6:	75 f5                	jne    800fad <memfind+0x12>
+  800fb8:	eb 06                	jmp    800fc0 <memfind+0x25>
+  800fba:	89 c2                	mov    %eax,%edx
+  800fbc:	eb 02                	jmp    800fc0 <memfind+0x25>
+  800fbe:	89 c2                	mov    %eax,%edx
+  800fc0:	89 d0                	mov    %edx,%eax
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+
+00800fc4 <strtol>:
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	57                   	push   %edi
+  800fc8:	56                   	push   %esi
+  800fc9:	53                   	push   %ebx
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd0:	0f b6 02             	movzbl (%edx),%eax
+  800fd3:	3c 20                	cmp    $0x20,%al
+  800fd5:	74 04                	je     800fdb <strtol+0x17>
+  800fd7:	3c 09                	cmp    $0x9,%al
+  800fd9:	75 0e                	jne    800fe9 <strtol+0x25>
+  800fdb:	83 c2 01             	add    $0x1,%edx
+  800fde:	0f b6 02             	movzbl (%edx),%eax
+  800fe1:	3c 20                	cmp    $0x20,%al
+  800fe3:	74 f6                	je     800fdb <strtol+0x17>
+  800fe5:	3c 09                	cmp    $0x9,%al
+  800fe7:	74 f2                	je     800fdb <strtol+0x17>
+  800fe9:	3c 2b                	cmp    $0x2b,%al
+  800feb:	74 2a                	je     801017 <strtol+0x53>
+  800fed:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff2:	3c 2d                	cmp    $0x2d,%al
+  800ff4:	74 2b                	je     801021 <strtol+0x5d>
+  800ff6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ffc:	75 0f                	jne    80100d <strtol+0x49>
+  800ffe:	80 3a 30             	cmpb   $0x30,(%edx)
+  801001:	74 28                	je     80102b <strtol+0x67>
+  801003:	85 db                	test   %ebx,%ebx
+  801005:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80100a:	0f 44 d8             	cmove  %eax,%ebx
+  80100d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801012:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801015:	eb 46                	jmp    80105d <strtol+0x99>
+  801017:	83 c2 01             	add    $0x1,%edx
+  80101a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101f:	eb d5                	jmp    800ff6 <strtol+0x32>
+  801021:	83 c2 01             	add    $0x1,%edx
+  801024:	bf 01 00 00 00       	mov    $0x1,%edi
+  801029:	eb cb                	jmp    800ff6 <strtol+0x32>
+  80102b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80102f:	74 0e                	je     80103f <strtol+0x7b>
+  801031:	85 db                	test   %ebx,%ebx
+  801033:	75 d8                	jne    80100d <strtol+0x49>
+  801035:	83 c2 01             	add    $0x1,%edx
+  801038:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80103d:	eb ce                	jmp    80100d <strtol+0x49>
+  80103f:	83 c2 02             	add    $0x2,%edx
+  801042:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801047:	eb c4                	jmp    80100d <strtol+0x49>
+  801049:	0f be c0             	movsbl %al,%eax
+  80104c:	83 e8 30             	sub    $0x30,%eax
+  80104f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801052:	7d 3a                	jge    80108e <strtol+0xca>
+  801054:	83 c2 01             	add    $0x1,%edx
+  801057:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80105b:	01 c1                	add    %eax,%ecx
+  80105d:	0f b6 02             	movzbl (%edx),%eax
+  801060:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801063:	89 f3                	mov    %esi,%ebx
+  801065:	80 fb 09             	cmp    $0x9,%bl
+  801068:	76 df                	jbe    801049 <strtol+0x85>
+  80106a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80106d:	89 f3                	mov    %esi,%ebx
+  80106f:	80 fb 19             	cmp    $0x19,%bl
+  801072:	77 08                	ja     80107c <strtol+0xb8>
+  801074:	0f be c0             	movsbl %al,%eax
+  801077:	83 e8 57             	sub    $0x57,%eax
+  80107a:	eb d3                	jmp    80104f <strtol+0x8b>
+  80107c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80107f:	89 f3                	mov    %esi,%ebx
+  801081:	80 fb 19             	cmp    $0x19,%bl
+  801084:	77 08                	ja     80108e <strtol+0xca>
+  801086:	0f be c0             	movsbl %al,%eax
+  801089:	83 e8 37             	sub    $0x37,%eax
+  80108c:	eb c1                	jmp    80104f <strtol+0x8b>
+  80108e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801092:	74 05                	je     801099 <strtol+0xd5>
+  801094:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801097:	89 10                	mov    %edx,(%eax)
+  801099:	89 c8                	mov    %ecx,%eax
+  80109b:	f7 d8                	neg    %eax
+  80109d:	85 ff                	test   %edi,%edi
+  80109f:	0f 45 c8             	cmovne %eax,%ecx
+  8010a2:	89 c8                	mov    %ecx,%eax
+  8010a4:	5b                   	pop    %ebx
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5f                   	pop    %edi
+  8010a7:	5d                   	pop    %ebp
+  8010a8:	c3                   	ret
+
+008010a9 <sys_cputs>:
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	57                   	push   %edi
+  8010ad:	56                   	push   %esi
+  8010ae:	53                   	push   %ebx
+  8010af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ba:	89 c3                	mov    %eax,%ebx
+  8010bc:	89 c7                	mov    %eax,%edi
+  8010be:	89 c6                	mov    %eax,%esi
+  8010c0:	cd 30                	int    $0x30
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+
+008010c7 <sys_cgetc>:
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+  8010cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010d7:	89 d1                	mov    %edx,%ecx
+  8010d9:	89 d3                	mov    %edx,%ebx
+  8010db:	89 d7                	mov    %edx,%edi
+  8010dd:	89 d6                	mov    %edx,%esi
+  8010df:	cd 30                	int    $0x30
+  8010e1:	5b                   	pop    %ebx
+  8010e2:	5e                   	pop    %esi
+  8010e3:	5f                   	pop    %edi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	c3                   	ret
+
+008010e6 <sys_env_destroy>:
+  8010e6:	55                   	push   %ebp
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	57                   	push   %edi
+  8010ea:	56                   	push   %esi
+  8010eb:	53                   	push   %ebx
+  8010ec:	83 ec 0c             	sub    $0xc,%esp
+  8010ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010fc:	89 cb                	mov    %ecx,%ebx
+  8010fe:	89 cf                	mov    %ecx,%edi
+  801100:	89 ce                	mov    %ecx,%esi
+  801102:	cd 30                	int    $0x30
+  801104:	85 c0                	test   %eax,%eax
+  801106:	7f 08                	jg     801110 <sys_env_destroy+0x2a>
+  801108:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110b:	5b                   	pop    %ebx
+  80110c:	5e                   	pop    %esi
+  80110d:	5f                   	pop    %edi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	50                   	push   %eax
+  801114:	6a 03                	push   $0x3
+  801116:	68 8b 43 80 00       	push   $0x80438b
+  80111b:	6a 24                	push   $0x24
+  80111d:	68 a8 43 80 00       	push   $0x8043a8
+  801122:	e8 38 f4 ff ff       	call   80055f <_panic>
+
+00801127 <sys_getenvid>:
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	57                   	push   %edi
+  80112b:	56                   	push   %esi
+  80112c:	53                   	push   %ebx
+  80112d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801132:	b8 02 00 00 00       	mov    $0x2,%eax
+  801137:	89 d1                	mov    %edx,%ecx
+  801139:	89 d3                	mov    %edx,%ebx
+  80113b:	89 d7                	mov    %edx,%edi
+  80113d:	89 d6                	mov    %edx,%esi
+  80113f:	cd 30                	int    $0x30
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <sys_yield>:
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	57                   	push   %edi
+  80114a:	56                   	push   %esi
+  80114b:	53                   	push   %ebx
+  80114c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801153:	74 26                	je     80117b <sys_yield+0x35>
+  801155:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80115f:	89 d1                	mov    %edx,%ecx
+  801161:	89 d3                	mov    %edx,%ebx
+  801163:	89 d7                	mov    %edx,%edi
+  801165:	6a 00                	push   $0x0
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	8d 35 72 11 80 00    	lea    0x801172,%esi
+  801170:	0f 34                	sysenter
+  801172:	5d                   	pop    %ebp
+  801173:	83 c4 04             	add    $0x4,%esp
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+  80117b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801180:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801185:	89 d1                	mov    %edx,%ecx
+  801187:	89 d3                	mov    %edx,%ebx
+  801189:	89 d7                	mov    %edx,%edi
+  80118b:	89 d6                	mov    %edx,%esi
+  80118d:	cd 30                	int    $0x30
+  80118f:	eb e5                	jmp    801176 <sys_yield+0x30>
+
+00801191 <sys_page_alloc>:
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+  801197:	83 ec 0c             	sub    $0xc,%esp
+  80119a:	be 00 00 00 00       	mov    $0x0,%esi
+  80119f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ad:	89 f7                	mov    %esi,%edi
+  8011af:	cd 30                	int    $0x30
+  8011b1:	85 c0                	test   %eax,%eax
+  8011b3:	7f 08                	jg     8011bd <sys_page_alloc+0x2c>
+  8011b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b8:	5b                   	pop    %ebx
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5f                   	pop    %edi
+  8011bb:	5d                   	pop    %ebp
+  8011bc:	c3                   	ret
+  8011bd:	83 ec 0c             	sub    $0xc,%esp
+  8011c0:	50                   	push   %eax
+  8011c1:	6a 04                	push   $0x4
+  8011c3:	68 8b 43 80 00       	push   $0x80438b
+  8011c8:	6a 24                	push   $0x24
+  8011ca:	68 a8 43 80 00       	push   $0x8043a8
+  8011cf:	e8 8b f3 ff ff       	call   80055f <_panic>
+
+008011d4 <sys_page_map>:
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+  8011dd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011e4:	74 33                	je     801219 <sys_page_map+0x45>
+  8011e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ec:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f7:	ff 75 18             	push   0x18(%ebp)
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	8d 35 05 12 80 00    	lea    0x801205,%esi
+  801203:	0f 34                	sysenter
+  801205:	5d                   	pop    %ebp
+  801206:	83 c4 04             	add    $0x4,%esp
+  801209:	89 c2                	mov    %eax,%edx
+  80120b:	85 c0                	test   %eax,%eax
+  80120d:	7f 3d                	jg     80124c <sys_page_map+0x78>
+  80120f:	89 d0                	mov    %edx,%eax
+  801211:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801214:	5b                   	pop    %ebx
+  801215:	5e                   	pop    %esi
+  801216:	5f                   	pop    %edi
+  801217:	5d                   	pop    %ebp
+  801218:	c3                   	ret
+  801219:	b8 05 00 00 00       	mov    $0x5,%eax
+  80121e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801221:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801224:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801227:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80122d:	cd 30                	int    $0x30
+  80122f:	89 c2                	mov    %eax,%edx
+  801231:	85 c0                	test   %eax,%eax
+  801233:	7e da                	jle    80120f <sys_page_map+0x3b>
+  801235:	83 ec 0c             	sub    $0xc,%esp
+  801238:	50                   	push   %eax
+  801239:	6a 05                	push   $0x5
+  80123b:	68 8b 43 80 00       	push   $0x80438b
+  801240:	6a 24                	push   $0x24
+  801242:	68 a8 43 80 00       	push   $0x8043a8
+  801247:	e8 13 f3 ff ff       	call   80055f <_panic>
+  80124c:	83 ec 0c             	sub    $0xc,%esp
+  80124f:	50                   	push   %eax
+  801250:	6a 05                	push   $0x5
+  801252:	68 8b 43 80 00       	push   $0x80438b
+  801257:	6a 48                	push   $0x48
+  801259:	68 a8 43 80 00       	push   $0x8043a8
+  80125e:	e8 fc f2 ff ff       	call   80055f <_panic>
+
+00801263 <sys_page_unmap>:
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 06 00 00 00       	mov    $0x6,%eax
+  80127c:	89 df                	mov    %ebx,%edi
+  80127e:	89 de                	mov    %ebx,%esi
+  801280:	cd 30                	int    $0x30
+  801282:	85 c0                	test   %eax,%eax
+  801284:	7f 08                	jg     80128e <sys_page_unmap+0x2b>
+  801286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801289:	5b                   	pop    %ebx
+  80128a:	5e                   	pop    %esi
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+  80128e:	83 ec 0c             	sub    $0xc,%esp
+  801291:	50                   	push   %eax
+  801292:	6a 06                	push   $0x6
+  801294:	68 8b 43 80 00       	push   $0x80438b
+  801299:	6a 24                	push   $0x24
+  80129b:	68 a8 43 80 00       	push   $0x8043a8
+  8012a0:	e8 ba f2 ff ff       	call   80055f <_panic>
+
+008012a5 <sys_fork>:
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+  8012ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8012b5:	89 d1                	mov    %edx,%ecx
+  8012b7:	89 d3                	mov    %edx,%ebx
+  8012b9:	89 d7                	mov    %edx,%edi
+  8012bb:	89 d6                	mov    %edx,%esi
+  8012bd:	cd 30                	int    $0x30
+  8012bf:	5b                   	pop    %ebx
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5f                   	pop    %edi
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+
+008012c4 <sys_env_set_status>:
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	57                   	push   %edi
+  8012c8:	56                   	push   %esi
+  8012c9:	53                   	push   %ebx
+  8012ca:	83 ec 0c             	sub    $0xc,%esp
+  8012cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012dd:	89 df                	mov    %ebx,%edi
+  8012df:	89 de                	mov    %ebx,%esi
+  8012e1:	cd 30                	int    $0x30
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	7f 08                	jg     8012ef <sys_env_set_status+0x2b>
+  8012e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+  8012ef:	83 ec 0c             	sub    $0xc,%esp
+  8012f2:	50                   	push   %eax
+  8012f3:	6a 08                	push   $0x8
+  8012f5:	68 8b 43 80 00       	push   $0x80438b
+  8012fa:	6a 24                	push   $0x24
+  8012fc:	68 a8 43 80 00       	push   $0x8043a8
+  801301:	e8 59 f2 ff ff       	call   80055f <_panic>
+
+00801306 <sys_env_set_trapframe>:
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	57                   	push   %edi
+  80130a:	56                   	push   %esi
+  80130b:	53                   	push   %ebx
+  80130c:	83 ec 0c             	sub    $0xc,%esp
+  80130f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801314:	8b 55 08             	mov    0x8(%ebp),%edx
+  801317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80131f:	89 df                	mov    %ebx,%edi
+  801321:	89 de                	mov    %ebx,%esi
+  801323:	cd 30                	int    $0x30
+  801325:	85 c0                	test   %eax,%eax
+  801327:	7f 08                	jg     801331 <sys_env_set_trapframe+0x2b>
+  801329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+  801331:	83 ec 0c             	sub    $0xc,%esp
+  801334:	50                   	push   %eax
+  801335:	6a 09                	push   $0x9
+  801337:	68 8b 43 80 00       	push   $0x80438b
+  80133c:	6a 24                	push   $0x24
+  80133e:	68 a8 43 80 00       	push   $0x8043a8
+  801343:	e8 17 f2 ff ff       	call   80055f <_panic>
+
+00801348 <sys_env_set_cow>:
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	57                   	push   %edi
+  80134c:	56                   	push   %esi
+  80134d:	53                   	push   %ebx
+  80134e:	83 ec 0c             	sub    $0xc,%esp
+  801351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801356:	8b 55 08             	mov    0x8(%ebp),%edx
+  801359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135c:	b8 20 00 00 00       	mov    $0x20,%eax
+  801361:	89 df                	mov    %ebx,%edi
+  801363:	89 de                	mov    %ebx,%esi
+  801365:	cd 30                	int    $0x30
+  801367:	85 c0                	test   %eax,%eax
+  801369:	7f 08                	jg     801373 <sys_env_set_cow+0x2b>
+  80136b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5f                   	pop    %edi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+  801373:	83 ec 0c             	sub    $0xc,%esp
+  801376:	50                   	push   %eax
+  801377:	6a 20                	push   $0x20
+  801379:	68 8b 43 80 00       	push   $0x80438b
+  80137e:	6a 24                	push   $0x24
+  801380:	68 a8 43 80 00       	push   $0x8043a8
+  801385:	e8 d5 f1 ff ff       	call   80055f <_panic>
+
+0080138a <sys_env_service>:
+  80138a:	55                   	push   %ebp
+  80138b:	89 e5                	mov    %esp,%ebp
+  80138d:	57                   	push   %edi
+  80138e:	56                   	push   %esi
+  80138f:	53                   	push   %ebx
+  801390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	b8 21 00 00 00       	mov    $0x21,%eax
+  80139d:	89 cb                	mov    %ecx,%ebx
+  80139f:	89 cf                	mov    %ecx,%edi
+  8013a1:	89 ce                	mov    %ecx,%esi
+  8013a3:	cd 30                	int    $0x30
+  8013a5:	5b                   	pop    %ebx
+  8013a6:	5e                   	pop    %esi
+  8013a7:	5f                   	pop    %edi
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+
+008013aa <sys_env_set_pgfault_upcall>:
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	57                   	push   %edi
+  8013ae:	56                   	push   %esi
+  8013af:	53                   	push   %ebx
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013be:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013c3:	89 df                	mov    %ebx,%edi
+  8013c5:	89 de                	mov    %ebx,%esi
+  8013c7:	cd 30                	int    $0x30
+  8013c9:	85 c0                	test   %eax,%eax
+  8013cb:	7f 08                	jg     8013d5 <sys_env_set_pgfault_upcall+0x2b>
+  8013cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d0:	5b                   	pop    %ebx
+  8013d1:	5e                   	pop    %esi
+  8013d2:	5f                   	pop    %edi
+  8013d3:	5d                   	pop    %ebp
+  8013d4:	c3                   	ret
+  8013d5:	83 ec 0c             	sub    $0xc,%esp
+  8013d8:	50                   	push   %eax
+  8013d9:	6a 0a                	push   $0xa
+  8013db:	68 8b 43 80 00       	push   $0x80438b
+  8013e0:	6a 24                	push   $0x24
+  8013e2:	68 a8 43 80 00       	push   $0x8043a8
+  8013e7:	e8 73 f1 ff ff       	call   80055f <_panic>
+
+008013ec <sys_ipc_try_send>:
+  8013ec:	55                   	push   %ebp
+  8013ed:	89 e5                	mov    %esp,%ebp
+  8013ef:	57                   	push   %edi
+  8013f0:	56                   	push   %esi
+  8013f1:	53                   	push   %ebx
+  8013f2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8013f9:	74 27                	je     801422 <sys_ipc_try_send+0x36>
+  8013fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801401:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801406:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801409:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80140c:	6a 00                	push   $0x0
+  80140e:	55                   	push   %ebp
+  80140f:	89 e5                	mov    %esp,%ebp
+  801411:	8d 35 19 14 80 00    	lea    0x801419,%esi
+  801417:	0f 34                	sysenter
+  801419:	5d                   	pop    %ebp
+  80141a:	83 c4 04             	add    $0x4,%esp
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5f                   	pop    %edi
+  801420:	5d                   	pop    %ebp
+  801421:	c3                   	ret
+  801422:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801427:	be 00 00 00 00       	mov    $0x0,%esi
+  80142c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801432:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801435:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801438:	cd 30                	int    $0x30
+  80143a:	eb e1                	jmp    80141d <sys_ipc_try_send+0x31>
+
+0080143c <sys_ipc_recv>:
+  80143c:	55                   	push   %ebp
+  80143d:	89 e5                	mov    %esp,%ebp
+  80143f:	57                   	push   %edi
+  801440:	56                   	push   %esi
+  801441:	53                   	push   %ebx
+  801442:	83 ec 0c             	sub    $0xc,%esp
+  801445:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80144c:	74 32                	je     801480 <sys_ipc_recv+0x44>
+  80144e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801451:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801456:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80145b:	89 cb                	mov    %ecx,%ebx
+  80145d:	89 cf                	mov    %ecx,%edi
+  80145f:	6a 00                	push   $0x0
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	8d 35 6c 14 80 00    	lea    0x80146c,%esi
+  80146a:	0f 34                	sysenter
+  80146c:	5d                   	pop    %ebp
+  80146d:	83 c4 04             	add    $0x4,%esp
+  801470:	89 c2                	mov    %eax,%edx
+  801472:	85 c0                	test   %eax,%eax
+  801474:	7f 3c                	jg     8014b2 <sys_ipc_recv+0x76>
+  801476:	89 d0                	mov    %edx,%eax
+  801478:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147b:	5b                   	pop    %ebx
+  80147c:	5e                   	pop    %esi
+  80147d:	5f                   	pop    %edi
+  80147e:	5d                   	pop    %ebp
+  80147f:	c3                   	ret
+  801480:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801485:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80148a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148d:	89 cb                	mov    %ecx,%ebx
+  80148f:	89 cf                	mov    %ecx,%edi
+  801491:	89 ce                	mov    %ecx,%esi
+  801493:	cd 30                	int    $0x30
+  801495:	89 c2                	mov    %eax,%edx
+  801497:	85 c0                	test   %eax,%eax
+  801499:	7e db                	jle    801476 <sys_ipc_recv+0x3a>
+  80149b:	83 ec 0c             	sub    $0xc,%esp
+  80149e:	50                   	push   %eax
+  80149f:	6a 0d                	push   $0xd
+  8014a1:	68 8b 43 80 00       	push   $0x80438b
+  8014a6:	6a 24                	push   $0x24
+  8014a8:	68 a8 43 80 00       	push   $0x8043a8
+  8014ad:	e8 ad f0 ff ff       	call   80055f <_panic>
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	50                   	push   %eax
+  8014b6:	6a 0d                	push   $0xd
+  8014b8:	68 8b 43 80 00       	push   $0x80438b
+  8014bd:	6a 48                	push   $0x48
+  8014bf:	68 a8 43 80 00       	push   $0x8043a8
+  8014c4:	e8 96 f0 ff ff       	call   80055f <_panic>
+
+008014c9 <sys_ipc_send>:
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	57                   	push   %edi
+  8014cd:	56                   	push   %esi
+  8014ce:	53                   	push   %ebx
+  8014cf:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8014d6:	74 27                	je     8014ff <sys_ipc_send+0x36>
+  8014d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014de:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014e9:	6a 00                	push   $0x0
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	8d 35 f6 14 80 00    	lea    0x8014f6,%esi
+  8014f4:	0f 34                	sysenter
+  8014f6:	5d                   	pop    %ebp
+  8014f7:	83 c4 04             	add    $0x4,%esp
+  8014fa:	5b                   	pop    %ebx
+  8014fb:	5e                   	pop    %esi
+  8014fc:	5f                   	pop    %edi
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	c3                   	ret
+  8014ff:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801504:	be 00 00 00 00       	mov    $0x0,%esi
+  801509:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801512:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801515:	cd 30                	int    $0x30
+  801517:	eb e1                	jmp    8014fa <sys_ipc_send+0x31>
+
+00801519 <sys_ipc_call>:
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	57                   	push   %edi
+  80151d:	56                   	push   %esi
+  80151e:	53                   	push   %ebx
+  80151f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801522:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801525:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80152a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801530:	8b 75 18             	mov    0x18(%ebp),%esi
+  801533:	cd 30                	int    $0x30
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5f                   	pop    %edi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+
+0080153a <sys_ipc_reply_recv>:
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	57                   	push   %edi
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  801540:	8b 55 08             	mov    0x8(%ebp),%edx
+  801543:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801546:	b8 10 00 00 00       	mov    $0x10,%eax
+  80154b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801551:	8b 75 18             	mov    0x18(%ebp),%esi
+  801554:	cd 30                	int    $0x30
+  801556:	5b                   	pop    %ebx
+  801557:	5e                   	pop    %esi
+  801558:	5f                   	pop    %edi
+  801559:	5d                   	pop    %ebp
+  80155a:	c3                   	ret
+
+0080155b <sys_time_msec>:
+  80155b:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801560:	85 c0                	test   %eax,%eax
+  801562:	75 06                	jne    80156a <sys_time_msec+0xf>
+  801564:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801569:	c3                   	ret
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	57                   	push   %edi
+  80156e:	56                   	push   %esi
+  80156f:	53                   	push   %ebx
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	0f 31                	rdtsc
+  801575:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80157b:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801581:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801587:	29 c8                	sub    %ecx,%eax
+  801589:	19 da                	sbb    %ebx,%edx
+  80158b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801590:	57                   	push   %edi
+  801591:	56                   	push   %esi
+  801592:	52                   	push   %edx
+  801593:	50                   	push   %eax
+  801594:	e8 44 28 00 00       	call   803ddd <__udivdi3>
+  801599:	83 c4 10             	add    $0x10,%esp
+  80159c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159f:	5b                   	pop    %ebx
+  8015a0:	5e                   	pop    %esi
+  8015a1:	5f                   	pop    %edi
+  8015a2:	5d                   	pop    %ebp
+  8015a3:	c3                   	ret
+
+008015a4 <sys_env_swap>:
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	57                   	push   %edi
+  8015a8:	56                   	push   %esi
+  8015a9:	53                   	push   %ebx
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+  8015ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8015ba:	89 cb                	mov    %ecx,%ebx
+  8015bc:	89 cf                	mov    %ecx,%edi
+  8015be:	89 ce                	mov    %ecx,%esi
+  8015c0:	cd 30                	int    $0x30
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	7f 08                	jg     8015ce <sys_env_swap+0x2a>
+  8015c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c9:	5b                   	pop    %ebx
+  8015ca:	5e                   	pop    %esi
+  8015cb:	5f                   	pop    %edi
+  8015cc:	5d                   	pop    %ebp
+  8015cd:	c3                   	ret
+  8015ce:	83 ec 0c             	sub    $0xc,%esp
+  8015d1:	50                   	push   %eax
+  8015d2:	6a 12                	push   $0x12
+  8015d4:	68 8b 43 80 00       	push   $0x80438b
+  8015d9:	6a 24                	push   $0x24
+  8015db:	68 a8 43 80 00       	push   $0x8043a8
+  8015e0:	e8 7a ef ff ff       	call   80055f <_panic>
+
+008015e5 <sys_net_try_send>:
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+  8015e8:	57                   	push   %edi
+  8015e9:	56                   	push   %esi
+  8015ea:	53                   	push   %ebx
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015fe:	89 df                	mov    %ebx,%edi
+  801600:	89 de                	mov    %ebx,%esi
+  801602:	cd 30                	int    $0x30
+  801604:	85 c0                	test   %eax,%eax
+  801606:	7f 08                	jg     801610 <sys_net_try_send+0x2b>
+  801608:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160b:	5b                   	pop    %ebx
+  80160c:	5e                   	pop    %esi
+  80160d:	5f                   	pop    %edi
+  80160e:	5d                   	pop    %ebp
+  80160f:	c3                   	ret
+  801610:	83 ec 0c             	sub    $0xc,%esp
+  801613:	50                   	push   %eax
+  801614:	6a 13                	push   $0x13
+  801616:	68 8b 43 80 00       	push   $0x80438b
+  80161b:	6a 24                	push   $0x24
+  80161d:	68 a8 43 80 00       	push   $0x8043a8
+  801622:	e8 38 ef ff ff       	call   80055f <_panic>
+
+00801627 <sys_net_try_receive>:
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+  80162a:	57                   	push   %edi
+  80162b:	56                   	push   %esi
+  80162c:	53                   	push   %ebx
+  80162d:	83 ec 0c             	sub    $0xc,%esp
+  801630:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801635:	8b 55 08             	mov    0x8(%ebp),%edx
+  801638:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801640:	89 df                	mov    %ebx,%edi
+  801642:	89 de                	mov    %ebx,%esi
+  801644:	cd 30                	int    $0x30
+  801646:	85 c0                	test   %eax,%eax
+  801648:	7f 08                	jg     801652 <sys_net_try_receive+0x2b>
+  80164a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164d:	5b                   	pop    %ebx
+  80164e:	5e                   	pop    %esi
+  80164f:	5f                   	pop    %edi
+  801650:	5d                   	pop    %ebp
+  801651:	c3                   	ret
+  801652:	83 ec 0c             	sub    $0xc,%esp
+  801655:	50                   	push   %eax
+  801656:	6a 14                	push   $0x14
+  801658:	68 8b 43 80 00       	push   $0x80438b
+  80165d:	6a 24                	push   $0x24
+  80165f:	68 a8 43 80 00       	push   $0x8043a8
+  801664:	e8 f6 ee ff ff       	call   80055f <_panic>
+
+00801669 <sys_net_recv_page>:
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	57                   	push   %edi
+  80166d:	56                   	push   %esi
+  80166e:	53                   	push   %ebx
+  80166f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801674:	8b 55 08             	mov    0x8(%ebp),%edx
+  801677:	b8 27 00 00 00       	mov    $0x27,%eax
+  80167c:	89 cb                	mov    %ecx,%ebx
+  80167e:	89 cf                	mov    %ecx,%edi
+  801680:	89 ce                	mov    %ecx,%esi
+  801682:	cd 30                	int    $0x30
+  801684:	5b                   	pop    %ebx
+  801685:	5e                   	pop    %esi
+  801686:	5f                   	pop    %edi
+  801687:	5d                   	pop    %ebp
+  801688:	c3                   	ret
+
+00801689 <sys_net_wait>:
+  801689:	55                   	push   %ebp
+  80168a:	89 e5                	mov    %esp,%ebp
+  80168c:	57                   	push   %edi
+  80168d:	56                   	push   %esi
+  80168e:	53                   	push   %ebx
+  80168f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801694:	b8 26 00 00 00       	mov    $0x26,%eax
+  801699:	89 d1                	mov    %edx,%ecx
+  80169b:	89 d3                	mov    %edx,%ebx
+  80169d:	89 d7                	mov    %edx,%edi
+  80169f:	89 d6                	mov    %edx,%esi
+  8016a1:	cd 30                	int    $0x30
+  8016a3:	5b                   	pop    %ebx
+  8016a4:	5e                   	pop    %esi
+  8016a5:	5f                   	pop    %edi
+  8016a6:	5d                   	pop    %ebp
+  8016a7:	c3                   	ret
+
+008016a8 <sys_get_mac>:
+  8016a8:	55                   	push   %ebp
+  8016a9:	89 e5                	mov    %esp,%ebp
+  8016ab:	57                   	push   %edi
+  8016ac:	56                   	push   %esi
+  8016ad:	53                   	push   %ebx
+  8016ae:	83 ec 0c             	sub    $0xc,%esp
+  8016b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bc:	b8 15 00 00 00       	mov    $0x15,%eax
+  8016c1:	89 df                	mov    %ebx,%edi
+  8016c3:	89 de                	mov    %ebx,%esi
+  8016c5:	cd 30                	int    $0x30
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	7f 08                	jg     8016d3 <sys_get_mac+0x2b>
+  8016cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ce:	5b                   	pop    %ebx
+  8016cf:	5e                   	pop    %esi
+  8016d0:	5f                   	pop    %edi
+  8016d1:	5d                   	pop    %ebp
+  8016d2:	c3                   	ret
+  8016d3:	83 ec 0c             	sub    $0xc,%esp
+  8016d6:	50                   	push   %eax
+  8016d7:	6a 15                	push   $0x15
+  8016d9:	68 8b 43 80 00       	push   $0x80438b
+  8016de:	6a 24                	push   $0x24
+  8016e0:	68 a8 43 80 00       	push   $0x8043a8
+  8016e5:	e8 75 ee ff ff       	call   80055f <_panic>
+
+008016ea <sys_env_lease>:
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	57                   	push   %edi
+  8016ee:	56                   	push   %esi
+  8016ef:	53                   	push   %ebx
+  8016f0:	83 ec 0c             	sub    $0xc,%esp
+  8016f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fe:	b8 16 00 00 00       	mov    $0x16,%eax
+  801703:	89 df                	mov    %ebx,%edi
+  801705:	89 de                	mov    %ebx,%esi
+  801707:	cd 30                	int    $0x30
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	7f 08                	jg     801715 <sys_env_lease+0x2b>
+  80170d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801710:	5b                   	pop    %ebx
+  801711:	5e                   	pop    %esi
+  801712:	5f                   	pop    %edi
+  801713:	5d                   	pop    %ebp
+  801714:	c3                   	ret
+  801715:	83 ec 0c             	sub    $0xc,%esp
+  801718:	50                   	push   %eax
+  801719:	6a 16                	push   $0x16
+  80171b:	68 8b 43 80 00       	push   $0x80438b
+  801720:	6a 24                	push   $0x24
+  801722:	68 a8 43 80 00       	push   $0x8043a8
+  801727:	e8 33 ee ff ff       	call   80055f <_panic>
+
+0080172c <sys_copy_mem>:
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	57                   	push   %edi
+  801730:	56                   	push   %esi
+  801731:	53                   	push   %ebx
+  801732:	83 ec 0c             	sub    $0xc,%esp
+  801735:	8b 55 08             	mov    0x8(%ebp),%edx
+  801738:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801740:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801743:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801746:	8b 75 18             	mov    0x18(%ebp),%esi
+  801749:	cd 30                	int    $0x30
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	7f 08                	jg     801757 <sys_copy_mem+0x2b>
+  80174f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801752:	5b                   	pop    %ebx
+  801753:	5e                   	pop    %esi
+  801754:	5f                   	pop    %edi
+  801755:	5d                   	pop    %ebp
+  801756:	c3                   	ret
+  801757:	83 ec 0c             	sub    $0xc,%esp
+  80175a:	50                   	push   %eax
+  80175b:	6a 17                	push   $0x17
+  80175d:	68 8b 43 80 00       	push   $0x80438b
+  801762:	6a 24                	push   $0x24
+  801764:	68 a8 43 80 00       	push   $0x8043a8
+  801769:	e8 f1 ed ff ff       	call   80055f <_panic>
+
+0080176e <sys_get_perms>:
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	57                   	push   %edi
+  801772:	56                   	push   %esi
+  801773:	53                   	push   %ebx
+  801774:	83 ec 0c             	sub    $0xc,%esp
+  801777:	be 00 00 00 00       	mov    $0x0,%esi
+  80177c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801782:	b8 18 00 00 00       	mov    $0x18,%eax
+  801787:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80178a:	89 f7                	mov    %esi,%edi
+  80178c:	cd 30                	int    $0x30
+  80178e:	85 c0                	test   %eax,%eax
+  801790:	7f 08                	jg     80179a <sys_get_perms+0x2c>
+  801792:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801795:	5b                   	pop    %ebx
+  801796:	5e                   	pop    %esi
+  801797:	5f                   	pop    %edi
+  801798:	5d                   	pop    %ebp
+  801799:	c3                   	ret
+  80179a:	83 ec 0c             	sub    $0xc,%esp
+  80179d:	50                   	push   %eax
+  80179e:	6a 18                	push   $0x18
+  8017a0:	68 8b 43 80 00       	push   $0x80438b
+  8017a5:	6a 24                	push   $0x24
+  8017a7:	68 a8 43 80 00       	push   $0x8043a8
+  8017ac:	e8 ae ed ff ff       	call   80055f <_panic>
+
+008017b1 <sys_env_unsuspend>:
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	57                   	push   %edi
+  8017b5:	56                   	push   %esi
+  8017b6:	53                   	push   %ebx
+  8017b7:	83 ec 0c             	sub    $0xc,%esp
+  8017ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017cd:	89 f7                	mov    %esi,%edi
+  8017cf:	cd 30                	int    $0x30
+  8017d1:	85 c0                	test   %eax,%eax
+  8017d3:	7f 08                	jg     8017dd <sys_env_unsuspend+0x2c>
+  8017d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d8:	5b                   	pop    %ebx
+  8017d9:	5e                   	pop    %esi
+  8017da:	5f                   	pop    %edi
+  8017db:	5d                   	pop    %ebp
+  8017dc:	c3                   	ret
+  8017dd:	83 ec 0c             	sub    $0xc,%esp
+  8017e0:	50                   	push   %eax
+  8017e1:	6a 19                	push   $0x19
+  8017e3:	68 8b 43 80 00       	push   $0x80438b
+  8017e8:	6a 24                	push   $0x24
+  8017ea:	68 a8 43 80 00       	push   $0x8043a8
+  8017ef:	e8 6b ed ff ff       	call   80055f <_panic>
+
+008017f4 <sys_migrate>:
+  8017f4:	55                   	push   %ebp
+  8017f5:	89 e5                	mov    %esp,%ebp
+  8017f7:	57                   	push   %edi
+  8017f8:	56                   	push   %esi
+  8017f9:	53                   	push   %ebx
+  8017fa:	83 ec 0c             	sub    $0xc,%esp
+  8017fd:	ba 04 90 80 00       	mov    $0x809004,%edx
+  801802:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801808:	76 11                	jbe    80181b <sys_migrate+0x27>
+  80180a:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80180f:	0f b6 08             	movzbl (%eax),%ecx
+  801812:	05 00 10 00 00       	add    $0x1000,%eax
+  801817:	39 d0                	cmp    %edx,%eax
+  801819:	72 f4                	jb     80180f <sys_migrate+0x1b>
+  80181b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801820:	8b 55 08             	mov    0x8(%ebp),%edx
+  801823:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801828:	89 cb                	mov    %ecx,%ebx
+  80182a:	89 cf                	mov    %ecx,%edi
+  80182c:	89 ce                	mov    %ecx,%esi
+  80182e:	cd 30                	int    $0x30
+  801830:	85 c0                	test   %eax,%eax
+  801832:	7f 08                	jg     80183c <sys_migrate+0x48>
+  801834:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801837:	5b                   	pop    %ebx
+  801838:	5e                   	pop    %esi
+  801839:	5f                   	pop    %edi
+  80183a:	5d                   	pop    %ebp
+  80183b:	c3                   	ret
+  80183c:	83 ec 0c             	sub    $0xc,%esp
+  80183f:	50                   	push   %eax
+  801840:	6a 1a                	push   $0x1a
+  801842:	68 8b 43 80 00       	push   $0x80438b
+  801847:	6a 24                	push   $0x24
+  801849:	68 a8 43 80 00       	push   $0x8043a8
+  80184e:	e8 0c ed ff ff       	call   80055f <_panic>
+
+00801853 <sys_lease_complete>:
+  801853:	55                   	push   %ebp
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	57                   	push   %edi
+  801857:	56                   	push   %esi
+  801858:	53                   	push   %ebx
+  801859:	83 ec 0c             	sub    $0xc,%esp
+  80185c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801861:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801866:	89 d1                	mov    %edx,%ecx
+  801868:	89 d3                	mov    %edx,%ebx
+  80186a:	89 d7                	mov    %edx,%edi
+  80186c:	89 d6                	mov    %edx,%esi
+  80186e:	cd 30                	int    $0x30
+  801870:	85 c0                	test   %eax,%eax
+  801872:	7f 08                	jg     80187c <sys_lease_complete+0x29>
+  801874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801877:	5b                   	pop    %ebx
+  801878:	5e                   	pop    %esi
+  801879:	5f                   	pop    %edi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+  80187c:	83 ec 0c             	sub    $0xc,%esp
+  80187f:	50                   	push   %eax
+  801880:	6a 1b                	push   $0x1b
+  801882:	68 8b 43 80 00       	push   $0x80438b
+  801887:	6a 24                	push   $0x24
+  801889:	68 a8 43 80 00       	push   $0x8043a8
+  80188e:	e8 cc ec ff ff       	call   80055f <_panic>
+
+00801893 <sys_env_set_thisenv>:
+  801893:	55                   	push   %ebp
+  801894:	89 e5                	mov    %esp,%ebp
+  801896:	57                   	push   %edi
+  801897:	56                   	push   %esi
+  801898:	53                   	push   %ebx
+  801899:	83 ec 0c             	sub    $0xc,%esp
+  80189c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8018ac:	89 df                	mov    %ebx,%edi
+  8018ae:	89 de                	mov    %ebx,%esi
+  8018b0:	cd 30                	int    $0x30
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	7f 08                	jg     8018be <sys_env_set_thisenv+0x2b>
+  8018b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b9:	5b                   	pop    %ebx
+  8018ba:	5e                   	pop    %esi
+  8018bb:	5f                   	pop    %edi
+  8018bc:	5d                   	pop    %ebp
+  8018bd:	c3                   	ret
+  8018be:	83 ec 0c             	sub    $0xc,%esp
+  8018c1:	50                   	push   %eax
+  8018c2:	6a 1c                	push   $0x1c
+  8018c4:	68 8b 43 80 00       	push   $0x80438b
+  8018c9:	6a 24                	push   $0x24
+  8018cb:	68 a8 43 80 00       	push   $0x8043a8
+  8018d0:	e8 8a ec ff ff       	call   80055f <_panic>
+
+008018d5 <sys_env_set_sched>:
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	57                   	push   %edi
+  8018d9:	56                   	push   %esi
+  8018da:	53                   	push   %ebx
+  8018db:	83 ec 0c             	sub    $0xc,%esp
+  8018de:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8018ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018f1:	89 f7                	mov    %esi,%edi
+  8018f3:	cd 30                	int    $0x30
+  8018f5:	85 c0                	test   %eax,%eax
+  8018f7:	7f 08                	jg     801901 <sys_env_set_sched+0x2c>
+  8018f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fc:	5b                   	pop    %ebx
+  8018fd:	5e                   	pop    %esi
+  8018fe:	5f                   	pop    %edi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+  801901:	83 ec 0c             	sub    $0xc,%esp
+  801904:	50                   	push   %eax
+  801905:	6a 1d                	push   $0x1d
+  801907:	68 8b 43 80 00       	push   $0x80438b
+  80190c:	6a 24                	push   $0x24
+  80190e:	68 a8 43 80 00       	push   $0x8043a8
+  801913:	e8 47 ec ff ff       	call   80055f <_panic>
+
+00801918 <sys_batch>:
+  801918:	55                   	push   %ebp
+  801919:	89 e5                	mov    %esp,%ebp
+  80191b:	57                   	push   %edi
+  80191c:	56                   	push   %esi
+  80191d:	53                   	push   %ebx
+  80191e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801923:	8b 55 08             	mov    0x8(%ebp),%edx
+  801926:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801929:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80192e:	89 df                	mov    %ebx,%edi
+  801930:	89 de                	mov    %ebx,%esi
+  801932:	cd 30                	int    $0x30
+  801934:	5b                   	pop    %ebx
+  801935:	5e                   	pop    %esi
+  801936:	5f                   	pop    %edi
+  801937:	5d                   	pop    %ebp
+  801938:	c3                   	ret
+
+00801939 <sys_env_stats>:
+  801939:	55                   	push   %ebp
+  80193a:	89 e5                	mov    %esp,%ebp
+  80193c:	57                   	push   %edi
+  80193d:	56                   	push   %esi
+  80193e:	53                   	push   %ebx
+  80193f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801944:	8b 55 08             	mov    0x8(%ebp),%edx
+  801947:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194a:	b8 23 00 00 00       	mov    $0x23,%eax
+  80194f:	89 df                	mov    %ebx,%edi
+  801951:	89 de                	mov    %ebx,%esi
+  801953:	cd 30                	int    $0x30
+  801955:	5b                   	pop    %ebx
+  801956:	5e                   	pop    %esi
+  801957:	5f                   	pop    %edi
+  801958:	5d                   	pop    %ebp
+  801959:	c3                   	ret
+
+0080195a <sys_trace>:
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	57                   	push   %edi
+  80195e:	56                   	push   %esi
+  80195f:	53                   	push   %ebx
+  801960:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801965:	8b 55 08             	mov    0x8(%ebp),%edx
+  801968:	b8 24 00 00 00       	mov    $0x24,%eax
+  80196d:	89 cb                	mov    %ecx,%ebx
+  80196f:	89 cf                	mov    %ecx,%edi
+  801971:	89 ce                	mov    %ecx,%esi
+  801973:	cd 30                	int    $0x30
+  801975:	5b                   	pop    %ebx
+  801976:	5e                   	pop    %esi
+  801977:	5f                   	pop    %edi
+  801978:	5d                   	pop    %ebp
+  801979:	c3                   	ret
+
+0080197a <sys_env_set_pager>:
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	57                   	push   %edi
+  80197e:	56                   	push   %esi
+  80197f:	53                   	push   %ebx
+  801980:	83 ec 0c             	sub    $0xc,%esp
+  801983:	be 00 00 00 00       	mov    $0x0,%esi
+  801988:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198e:	b8 25 00 00 00       	mov    $0x25,%eax
+  801993:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801996:	89 f7                	mov    %esi,%edi
+  801998:	cd 30                	int    $0x30
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	7f 08                	jg     8019a6 <sys_env_set_pager+0x2c>
+  80199e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a1:	5b                   	pop    %ebx
+  8019a2:	5e                   	pop    %esi
+  8019a3:	5f                   	pop    %edi
+  8019a4:	5d                   	pop    %ebp
+  8019a5:	c3                   	ret
+  8019a6:	83 ec 0c             	sub    $0xc,%esp
+  8019a9:	50                   	push   %eax
+  8019aa:	6a 25                	push   $0x25
+  8019ac:	68 8b 43 80 00       	push   $0x80438b
+  8019b1:	6a 24                	push   $0x24
+  8019b3:	68 a8 43 80 00       	push   $0x8043a8
+  8019b8:	e8 a2 eb ff ff       	call   80055f <_panic>
+
+008019bd <sys_pager_retire>:
+  8019bd:	55                   	push   %ebp
+  8019be:	89 e5                	mov    %esp,%ebp
+  8019c0:	57                   	push   %edi
+  8019c1:	56                   	push   %esi
+  8019c2:	53                   	push   %ebx
+  8019c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019cb:	b8 28 00 00 00       	mov    $0x28,%eax
+  8019d0:	89 cb                	mov    %ecx,%ebx
+  8019d2:	89 cf                	mov    %ecx,%edi
+  8019d4:	89 ce                	mov    %ecx,%esi
+  8019d6:	cd 30                	int    $0x30
+  8019d8:	5b                   	pop    %ebx
+  8019d9:	5e                   	pop    %esi
+  8019da:	5f                   	pop    %edi
+  8019db:	5d                   	pop    %ebp
+  8019dc:	c3                   	ret
+
+008019dd <sys_prof>:
+  8019dd:	55                   	push   %ebp
+  8019de:	89 e5                	mov    %esp,%ebp
+  8019e0:	57                   	push   %edi
+  8019e1:	56                   	push   %esi
+  8019e2:	53                   	push   %ebx
+  8019e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ee:	b8 22 00 00 00       	mov    $0x22,%eax
+  8019f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019f6:	89 f7                	mov    %esi,%edi
+  8019f8:	cd 30                	int    $0x30
+  8019fa:	5b                   	pop    %ebx
+  8019fb:	5e                   	pop    %esi
+  8019fc:	5f                   	pop    %edi
+  8019fd:	5d                   	pop    %ebp
+  8019fe:	c3                   	ret
+
+008019ff <dupq_flush>:
+  8019ff:	55                   	push   %ebp
+  801a00:	89 e5                	mov    %esp,%ebp
+  801a02:	53                   	push   %ebx
+  801a03:	83 ec 0c             	sub    $0xc,%esp
+  801a06:	8b 1d 08 60 80 00    	mov    0x806008,%ebx
+  801a0c:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801a13:	00 00 00 
+  801a16:	53                   	push   %ebx
+  801a17:	68 00 00 40 00       	push   $0x400000
+  801a1c:	e8 f7 fe ff ff       	call   801918 <sys_batch>
+  801a21:	83 c4 10             	add    $0x10,%esp
+  801a24:	85 c0                	test   %eax,%eax
+  801a26:	78 14                	js     801a3c <dupq_flush+0x3d>
+  801a28:	39 c3                	cmp    %eax,%ebx
+  801a2a:	7e 0b                	jle    801a37 <dupq_flush+0x38>
+  801a2c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801a2f:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801a35:	eb 05                	jmp    801a3c <dupq_flush+0x3d>
+  801a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3f:	c9                   	leave
+  801a40:	c3                   	ret
+
+00801a41 <pgfault>:
+  801a41:	55                   	push   %ebp
+  801a42:	89 e5                	mov    %esp,%ebp
+  801a44:	56                   	push   %esi
+  801a45:	53                   	push   %ebx
+  801a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a49:	8b 30                	mov    (%eax),%esi
+  801a4b:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801a4f:	0f 84 83 00 00 00    	je     801ad8 <pgfault+0x97>
+  801a55:	89 f0                	mov    %esi,%eax
+  801a57:	c1 e8 0c             	shr    $0xc,%eax
+  801a5a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a61:	f6 c4 08             	test   $0x8,%ah
+  801a64:	0f 84 80 00 00 00    	je     801aea <pgfault+0xa9>
+  801a6a:	e8 b8 f6 ff ff       	call   801127 <sys_getenvid>
+  801a6f:	89 c3                	mov    %eax,%ebx
+  801a71:	83 ec 04             	sub    $0x4,%esp
+  801a74:	6a 07                	push   $0x7
+  801a76:	68 00 f0 7f 00       	push   $0x7ff000
+  801a7b:	50                   	push   %eax
+  801a7c:	e8 10 f7 ff ff       	call   801191 <sys_page_alloc>
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 74                	js     801afc <pgfault+0xbb>
+  801a88:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801a8e:	83 ec 04             	sub    $0x4,%esp
+  801a91:	68 00 10 00 00       	push   $0x1000
+  801a96:	56                   	push   %esi
+  801a97:	68 00 f0 7f 00       	push   $0x7ff000
+  801a9c:	e8 40 f4 ff ff       	call   800ee1 <memmove>
+  801aa1:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801aa8:	56                   	push   %esi
+  801aa9:	53                   	push   %ebx
+  801aaa:	68 00 f0 7f 00       	push   $0x7ff000
+  801aaf:	53                   	push   %ebx
+  801ab0:	e8 1f f7 ff ff       	call   8011d4 <sys_page_map>
+  801ab5:	83 c4 20             	add    $0x20,%esp
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	78 54                	js     801b10 <pgfault+0xcf>
+  801abc:	83 ec 08             	sub    $0x8,%esp
+  801abf:	68 00 f0 7f 00       	push   $0x7ff000
+  801ac4:	53                   	push   %ebx
+  801ac5:	e8 99 f7 ff ff       	call   801263 <sys_page_unmap>
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	78 53                	js     801b24 <pgfault+0xe3>
+  801ad1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad4:	5b                   	pop    %ebx
+  801ad5:	5e                   	pop    %esi
+  801ad6:	5d                   	pop    %ebp
+  801ad7:	c3                   	ret
+  801ad8:	56                   	push   %esi
+  801ad9:	68 b8 43 80 00       	push   $0x8043b8
+  801ade:	6a 19                	push   $0x19
+  801ae0:	68 94 44 80 00       	push   $0x804494
+  801ae5:	e8 75 ea ff ff       	call   80055f <_panic>
+  801aea:	56                   	push   %esi
+  801aeb:	68 ec 43 80 00       	push   $0x8043ec
+  801af0:	6a 1e                	push   $0x1e
+  801af2:	68 94 44 80 00       	push   $0x804494
+  801af7:	e8 63 ea ff ff       	call   80055f <_panic>
+  801afc:	83 ec 04             	sub    $0x4,%esp
+  801aff:	68 20 44 80 00       	push   $0x804420
+  801b04:	6a 2e                	push   $0x2e
+  801b06:	68 94 44 80 00       	push   $0x804494
+  801b0b:	e8 4f ea ff ff       	call   80055f <_panic>
+  801b10:	83 ec 04             	sub    $0x4,%esp
+  801b13:	68 44 44 80 00       	push   $0x804444
+  801b18:	6a 37                	push   $0x37
+  801b1a:	68 94 44 80 00       	push   $0x804494
+  801b1f:	e8 3b ea ff ff       	call   80055f <_panic>
+  801b24:	83 ec 04             	sub    $0x4,%esp
+  801b27:	68 70 44 80 00       	push   $0x804470
+  801b2c:	6a 3c                	push   $0x3c
+  801b2e:	68 94 44 80 00       	push   $0x804494
+  801b33:	e8 27 ea ff ff       	call   80055f <_panic>
+
+00801b38 <dupq_begin>:
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	83 ec 0c             	sub    $0xc,%esp
+  801b3e:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801b45:	00 00 00 
+  801b48:	6a 07                	push   $0x7
+  801b4a:	68 00 00 40 00       	push   $0x400000
+  801b4f:	6a 00                	push   $0x0
+  801b51:	e8 3b f6 ff ff       	call   801191 <sys_page_alloc>
+  801b56:	c9                   	leave
+  801b57:	c3                   	ret
+
+00801b58 <dupq_map>:
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	83 ec 08             	sub    $0x8,%esp
+  801b5e:	81 3d 08 60 80 00 92 	cmpl   $0x92,0x806008
+  801b65:	00 00 00 
+  801b68:	74 46                	je     801bb0 <dupq_map+0x58>
+  801b6a:	8b 15 08 60 80 00    	mov    0x806008,%edx
+  801b70:	8d 42 01             	lea    0x1(%edx),%eax
+  801b73:	a3 08 60 80 00       	mov    %eax,0x806008
+  801b78:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801b7b:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801b81:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801b88:	00 00 00 
+  801b8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b8e:	89 50 04             	mov    %edx,0x4(%eax)
+  801b91:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b94:	c1 e2 0c             	shl    $0xc,%edx
+  801b97:	89 50 08             	mov    %edx,0x8(%eax)
+  801b9a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801b9d:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801ba0:	89 50 10             	mov    %edx,0x10(%eax)
+  801ba3:	8b 55 14             	mov    0x14(%ebp),%edx
+  801ba6:	89 50 14             	mov    %edx,0x14(%eax)
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	c9                   	leave
+  801baf:	c3                   	ret
+  801bb0:	e8 4a fe ff ff       	call   8019ff <dupq_flush>
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	79 b1                	jns    801b6a <dupq_map+0x12>
+  801bb9:	eb f3                	jmp    801bae <dupq_map+0x56>
+
+00801bbb <dupq_end>:
+  801bbb:	55                   	push   %ebp
+  801bbc:	89 e5                	mov    %esp,%ebp
+  801bbe:	53                   	push   %ebx
+  801bbf:	83 ec 04             	sub    $0x4,%esp
+  801bc2:	e8 38 fe ff ff       	call   8019ff <dupq_flush>
+  801bc7:	89 c3                	mov    %eax,%ebx
+  801bc9:	83 ec 08             	sub    $0x8,%esp
+  801bcc:	68 00 00 40 00       	push   $0x400000
+  801bd1:	6a 00                	push   $0x0
+  801bd3:	e8 8b f6 ff ff       	call   801263 <sys_page_unmap>
+  801bd8:	89 d8                	mov    %ebx,%eax
+  801bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bdd:	c9                   	leave
+  801bde:	c3                   	ret
+
+00801bdf <fork>:
+  801bdf:	55                   	push   %ebp
+  801be0:	89 e5                	mov    %esp,%ebp
+  801be2:	53                   	push   %ebx
+  801be3:	83 ec 10             	sub    $0x10,%esp
+  801be6:	68 41 1a 80 00       	push   $0x801a41
+  801beb:	e8 0c 1d 00 00       	call   8038fc <set_pgfault_handler>
+  801bf0:	83 c4 08             	add    $0x8,%esp
+  801bf3:	6a 01                	push   $0x1
+  801bf5:	6a 00                	push   $0x0
+  801bf7:	e8 4c f7 ff ff       	call   801348 <sys_env_set_cow>
+  801bfc:	e8 a4 f6 ff ff       	call   8012a5 <sys_fork>
+  801c01:	89 c3                	mov    %eax,%ebx
+  801c03:	83 c4 10             	add    $0x10,%esp
+  801c06:	85 c0                	test   %eax,%eax
+  801c08:	74 07                	je     801c11 <fork+0x32>
+  801c0a:	89 d8                	mov    %ebx,%eax
+  801c0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c0f:	c9                   	leave
+  801c10:	c3                   	ret
+  801c11:	e8 11 f5 ff ff       	call   801127 <sys_getenvid>
+  801c16:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c1b:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801c21:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c26:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  801c2b:	eb dd                	jmp    801c0a <fork+0x2b>
+
+00801c2d <sfork>:
+  801c2d:	55                   	push   %ebp
+  801c2e:	89 e5                	mov    %esp,%ebp
+  801c30:	57                   	push   %edi
+  801c31:	56                   	push   %esi
+  801c32:	53                   	push   %ebx
+  801c33:	83 ec 1c             	sub    $0x1c,%esp
+  801c36:	e8 ec f4 ff ff       	call   801127 <sys_getenvid>
+  801c3b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801c3e:	83 ec 0c             	sub    $0xc,%esp
+  801c41:	68 41 1a 80 00       	push   $0x801a41
+  801c46:	e8 b1 1c 00 00       	call   8038fc <set_pgfault_handler>
+  801c4b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c50:	cd 30                	int    $0x30
+  801c52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c55:	83 c4 10             	add    $0x10,%esp
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	0f 88 45 02 00 00    	js     801ea5 <sfork+0x278>
+  801c60:	89 c6                	mov    %eax,%esi
+  801c62:	74 17                	je     801c7b <sfork+0x4e>
+  801c64:	e8 cf fe ff ff       	call   801b38 <dupq_begin>
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	0f 88 40 02 00 00    	js     801eb1 <sfork+0x284>
+  801c71:	bf 02 00 00 00       	mov    $0x2,%edi
+  801c76:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801c79:	eb 39                	jmp    801cb4 <sfork+0x87>
+  801c7b:	e8 a7 f4 ff ff       	call   801127 <sys_getenvid>
+  801c80:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c85:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801c8b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c90:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  801c95:	e9 23 01 00 00       	jmp    801dbd <sfork+0x190>
+  801c9a:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801ca1:	a8 01                	test   $0x1,%al
+  801ca3:	75 5b                	jne    801d00 <sfork+0xd3>
+  801ca5:	83 c7 01             	add    $0x1,%edi
+  801ca8:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801cae:	0f 84 40 01 00 00    	je     801df4 <sfork+0x1c7>
+  801cb4:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801cbb:	a8 01                	test   $0x1,%al
+  801cbd:	74 db                	je     801c9a <sfork+0x6d>
+  801cbf:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801cc6:	a8 80                	test   $0x80,%al
+  801cc8:	74 d0                	je     801c9a <sfork+0x6d>
+  801cca:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801cd1:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cd6:	0c 80                	or     $0x80,%al
+  801cd8:	50                   	push   %eax
+  801cd9:	ff 75 e4             	push   -0x1c(%ebp)
+  801cdc:	89 f8                	mov    %edi,%eax
+  801cde:	c1 e0 16             	shl    $0x16,%eax
+  801ce1:	c1 e8 0c             	shr    $0xc,%eax
+  801ce4:	50                   	push   %eax
+  801ce5:	ff 75 e0             	push   -0x20(%ebp)
+  801ce8:	e8 6b fe ff ff       	call   801b58 <dupq_map>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	79 b1                	jns    801ca5 <sfork+0x78>
+  801cf4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cfb:	e9 bd 00 00 00       	jmp    801dbd <sfork+0x190>
+  801d00:	89 fe                	mov    %edi,%esi
+  801d02:	c1 e6 16             	shl    $0x16,%esi
+  801d05:	89 f0                	mov    %esi,%eax
+  801d07:	c1 e8 0c             	shr    $0xc,%eax
+  801d0a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801d0f:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801d12:	eb 57                	jmp    801d6b <sfork+0x13e>
+  801d14:	e8 0e f4 ff ff       	call   801127 <sys_getenvid>
+  801d19:	89 c7                	mov    %eax,%edi
+  801d1b:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801d20:	f6 c4 04             	test   $0x4,%ah
+  801d23:	0f 85 9f 00 00 00    	jne    801dc8 <sfork+0x19b>
+  801d29:	a9 02 08 00 00       	test   $0x802,%eax
+  801d2e:	0f 85 c5 01 00 00    	jne    801ef9 <sfork+0x2cc>
+  801d34:	6a 05                	push   $0x5
+  801d36:	ff 75 e4             	push   -0x1c(%ebp)
+  801d39:	68 fd e7 0e 00       	push   $0xee7fd
+  801d3e:	57                   	push   %edi
+  801d3f:	e8 14 fe ff ff       	call   801b58 <dupq_map>
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801d4d:	0f 84 91 00 00 00    	je     801de4 <sfork+0x1b7>
+  801d53:	89 f0                	mov    %esi,%eax
+  801d55:	09 d8                	or     %ebx,%eax
+  801d57:	c1 e8 0c             	shr    $0xc,%eax
+  801d5a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d60:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801d65:	0f 84 81 00 00 00    	je     801dec <sfork+0x1bf>
+  801d6b:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801d70:	74 a2                	je     801d14 <sfork+0xe7>
+  801d72:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d79:	f6 c2 01             	test   $0x1,%dl
+  801d7c:	74 c9                	je     801d47 <sfork+0x11a>
+  801d7e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d85:	f6 c6 02             	test   $0x2,%dh
+  801d88:	75 bd                	jne    801d47 <sfork+0x11a>
+  801d8a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801d91:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d98:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801d9e:	f7 d2                	not    %edx
+  801da0:	21 ca                	and    %ecx,%edx
+  801da2:	52                   	push   %edx
+  801da3:	ff 75 e4             	push   -0x1c(%ebp)
+  801da6:	50                   	push   %eax
+  801da7:	ff 75 e0             	push   -0x20(%ebp)
+  801daa:	e8 a9 fd ff ff       	call   801b58 <dupq_map>
+  801daf:	83 c4 10             	add    $0x10,%esp
+  801db2:	85 c0                	test   %eax,%eax
+  801db4:	79 91                	jns    801d47 <sfork+0x11a>
+  801db6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801dbd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc3:	5b                   	pop    %ebx
+  801dc4:	5e                   	pop    %esi
+  801dc5:	5f                   	pop    %edi
+  801dc6:	5d                   	pop    %ebp
+  801dc7:	c3                   	ret
+  801dc8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801dcd:	50                   	push   %eax
+  801dce:	ff 75 e4             	push   -0x1c(%ebp)
+  801dd1:	68 fd e7 0e 00       	push   $0xee7fd
+  801dd6:	57                   	push   %edi
+  801dd7:	e8 7c fd ff ff       	call   801b58 <dupq_map>
+  801ddc:	83 c4 10             	add    $0x10,%esp
+  801ddf:	e9 63 ff ff ff       	jmp    801d47 <sfork+0x11a>
+  801de4:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801de7:	e9 b9 fe ff ff       	jmp    801ca5 <sfork+0x78>
+  801dec:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801def:	e9 b1 fe ff ff       	jmp    801ca5 <sfork+0x78>
+  801df4:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801df7:	e8 bf fd ff ff       	call   801bbb <dupq_end>
+  801dfc:	85 c0                	test   %eax,%eax
+  801dfe:	0f 88 b9 00 00 00    	js     801ebd <sfork+0x290>
+  801e04:	83 ec 04             	sub    $0x4,%esp
+  801e07:	6a 07                	push   $0x7
+  801e09:	68 00 f0 7f ee       	push   $0xee7ff000
+  801e0e:	56                   	push   %esi
+  801e0f:	e8 7d f3 ff ff       	call   801191 <sys_page_alloc>
+  801e14:	83 c4 10             	add    $0x10,%esp
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	0f 88 aa 00 00 00    	js     801ec9 <sfork+0x29c>
+  801e1f:	83 ec 0c             	sub    $0xc,%esp
+  801e22:	6a 07                	push   $0x7
+  801e24:	68 00 f0 7f 00       	push   $0x7ff000
+  801e29:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801e2c:	57                   	push   %edi
+  801e2d:	68 00 f0 7f ee       	push   $0xee7ff000
+  801e32:	56                   	push   %esi
+  801e33:	e8 9c f3 ff ff       	call   8011d4 <sys_page_map>
+  801e38:	83 c4 20             	add    $0x20,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	0f 88 92 00 00 00    	js     801ed5 <sfork+0x2a8>
+  801e43:	83 ec 04             	sub    $0x4,%esp
+  801e46:	68 00 10 00 00       	push   $0x1000
+  801e4b:	68 00 f0 7f 00       	push   $0x7ff000
+  801e50:	68 00 f0 7f ee       	push   $0xee7ff000
+  801e55:	e8 87 f0 ff ff       	call   800ee1 <memmove>
+  801e5a:	83 c4 08             	add    $0x8,%esp
+  801e5d:	68 00 f0 7f 00       	push   $0x7ff000
+  801e62:	57                   	push   %edi
+  801e63:	e8 fb f3 ff ff       	call   801263 <sys_page_unmap>
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 72                	js     801ee1 <sfork+0x2b4>
+  801e6f:	83 ec 08             	sub    $0x8,%esp
+  801e72:	68 74 39 80 00       	push   $0x803974
+  801e77:	56                   	push   %esi
+  801e78:	e8 2d f5 ff ff       	call   8013aa <sys_env_set_pgfault_upcall>
+  801e7d:	83 c4 10             	add    $0x10,%esp
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	78 69                	js     801eed <sfork+0x2c0>
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	6a 02                	push   $0x2
+  801e89:	56                   	push   %esi
+  801e8a:	e8 35 f4 ff ff       	call   8012c4 <sys_env_set_status>
+  801e8f:	83 c4 10             	add    $0x10,%esp
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801e99:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801e9d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ea0:	e9 18 ff ff ff       	jmp    801dbd <sfork+0x190>
+  801ea5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801eac:	e9 0c ff ff ff       	jmp    801dbd <sfork+0x190>
+  801eb1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801eb8:	e9 00 ff ff ff       	jmp    801dbd <sfork+0x190>
+  801ebd:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ec4:	e9 f4 fe ff ff       	jmp    801dbd <sfork+0x190>
+  801ec9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ed0:	e9 e8 fe ff ff       	jmp    801dbd <sfork+0x190>
+  801ed5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801edc:	e9 dc fe ff ff       	jmp    801dbd <sfork+0x190>
+  801ee1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ee8:	e9 d0 fe ff ff       	jmp    801dbd <sfork+0x190>
+  801eed:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ef4:	e9 c4 fe ff ff       	jmp    801dbd <sfork+0x190>
+  801ef9:	68 05 08 00 00       	push   $0x805
+  801efe:	ff 75 e4             	push   -0x1c(%ebp)
+  801f01:	68 fd e7 0e 00       	push   $0xee7fd
+  801f06:	57                   	push   %edi
+  801f07:	e8 4c fc ff ff       	call   801b58 <dupq_map>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  801f0f:	85 c0                	test   %eax,%eax
+  801f11:	0f 88 30 fe ff ff    	js     801d47 <sfork+0x11a>
+  801f17:	68 05 08 00 00       	push   $0x805
+  801f1c:	57                   	push   %edi
+  801f1d:	68 fd e7 0e 00       	push   $0xee7fd
+  801f22:	57                   	push   %edi
+  801f23:	e8 30 fc ff ff       	call   801b58 <dupq_map>
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	e9 17 fe ff ff       	jmp    801d47 <sfork+0x11a>
+
+00801f30 <ipc_recv>:
+  801f30:	55                   	push   %ebp
+  801f31:	89 e5                	mov    %esp,%ebp
+  801f33:	56                   	push   %esi
+  801f34:	53                   	push   %ebx
+  801f35:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801f45:	0f 44 c2             	cmove  %edx,%eax
+  801f48:	83 ec 0c             	sub    $0xc,%esp
+  801f4b:	50                   	push   %eax
+  801f4c:	e8 eb f4 ff ff       	call   80143c <sys_ipc_recv>
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	78 2a                	js     801f82 <ipc_recv+0x52>
+  801f58:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  801f5d:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801f63:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801f69:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801f6f:	85 f6                	test   %esi,%esi
+  801f71:	74 02                	je     801f75 <ipc_recv+0x45>
+  801f73:	89 0e                	mov    %ecx,(%esi)
+  801f75:	85 db                	test   %ebx,%ebx
+  801f77:	74 02                	je     801f7b <ipc_recv+0x4b>
+  801f79:	89 13                	mov    %edx,(%ebx)
+  801f7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f7e:	5b                   	pop    %ebx
+  801f7f:	5e                   	pop    %esi
+  801f80:	5d                   	pop    %ebp
+  801f81:	c3                   	ret
+  801f82:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f8c:	eb e1                	jmp    801f6f <ipc_recv+0x3f>
+
+00801f8e <ipc_send>:
+  801f8e:	55                   	push   %ebp
+  801f8f:	89 e5                	mov    %esp,%ebp
+  801f91:	57                   	push   %edi
+  801f92:	56                   	push   %esi
+  801f93:	53                   	push   %ebx
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+  801f97:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f9d:	8b 75 14             	mov    0x14(%ebp),%esi
+  801fa0:	85 db                	test   %ebx,%ebx
+  801fa2:	74 1e                	je     801fc2 <ipc_send+0x34>
+  801fa4:	56                   	push   %esi
+  801fa5:	53                   	push   %ebx
+  801fa6:	57                   	push   %edi
+  801fa7:	ff 75 08             	push   0x8(%ebp)
+  801faa:	e8 1a f5 ff ff       	call   8014c9 <sys_ipc_send>
+  801faf:	83 c4 10             	add    $0x10,%esp
+  801fb2:	85 c0                	test   %eax,%eax
+  801fb4:	74 2a                	je     801fe0 <ipc_send+0x52>
+  801fb6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801fb9:	75 13                	jne    801fce <ipc_send+0x40>
+  801fbb:	e8 86 f1 ff ff       	call   801146 <sys_yield>
+  801fc0:	eb e2                	jmp    801fa4 <ipc_send+0x16>
+  801fc2:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc7:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801fcc:	eb d6                	jmp    801fa4 <ipc_send+0x16>
+  801fce:	50                   	push   %eax
+  801fcf:	68 a0 44 80 00       	push   $0x8044a0
+  801fd4:	6a 4f                	push   $0x4f
+  801fd6:	68 e3 44 80 00       	push   $0x8044e3
+  801fdb:	e8 7f e5 ff ff       	call   80055f <_panic>
+  801fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe3:	5b                   	pop    %ebx
+  801fe4:	5e                   	pop    %esi
+  801fe5:	5f                   	pop    %edi
+  801fe6:	5d                   	pop    %ebp
+  801fe7:	c3                   	ret
+
+00801fe8 <ipc_call>:
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	57                   	push   %edi
+  801fec:	56                   	push   %esi
+  801fed:	53                   	push   %ebx
+  801fee:	83 ec 0c             	sub    $0xc,%esp
+  801ff1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ff5:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801ffa:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801ffe:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802002:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802007:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80200b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80200f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802014:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802018:	eb 05                	jmp    80201f <ipc_call+0x37>
+  80201a:	e8 27 f1 ff ff       	call   801146 <sys_yield>
+  80201f:	83 ec 0c             	sub    $0xc,%esp
+  802022:	56                   	push   %esi
+  802023:	53                   	push   %ebx
+  802024:	57                   	push   %edi
+  802025:	ff 75 0c             	push   0xc(%ebp)
+  802028:	ff 75 08             	push   0x8(%ebp)
+  80202b:	e8 e9 f4 ff ff       	call   801519 <sys_ipc_call>
+  802030:	83 c4 20             	add    $0x20,%esp
+  802033:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802036:	74 e2                	je     80201a <ipc_call+0x32>
+  802038:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80203b:	74 2d                	je     80206a <ipc_call+0x82>
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 4f                	js     802090 <ipc_call+0xa8>
+  802041:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802045:	74 10                	je     802057 <ipc_call+0x6f>
+  802047:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  80204c:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802052:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802055:	89 02                	mov    %eax,(%edx)
+  802057:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  80205c:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802062:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802065:	5b                   	pop    %ebx
+  802066:	5e                   	pop    %esi
+  802067:	5f                   	pop    %edi
+  802068:	5d                   	pop    %ebp
+  802069:	c3                   	ret
+  80206a:	ff 75 14             	push   0x14(%ebp)
+  80206d:	ff 75 10             	push   0x10(%ebp)
+  802070:	ff 75 0c             	push   0xc(%ebp)
+  802073:	ff 75 08             	push   0x8(%ebp)
+  802076:	e8 13 ff ff ff       	call   801f8e <ipc_send>
+  80207b:	83 c4 0c             	add    $0xc,%esp
+  80207e:	ff 75 1c             	push   0x1c(%ebp)
+  802081:	ff 75 18             	push   0x18(%ebp)
+  802084:	6a 00                	push   $0x0
+  802086:	e8 a5 fe ff ff       	call   801f30 <ipc_recv>
+  80208b:	83 c4 10             	add    $0x10,%esp
+  80208e:	eb d2                	jmp    802062 <ipc_call+0x7a>
+  802090:	50                   	push   %eax
+  802091:	68 ed 44 80 00       	push   $0x8044ed
+  802096:	6a 6d                	push   $0x6d
+  802098:	68 e3 44 80 00       	push   $0x8044e3
+  80209d:	e8 bd e4 ff ff       	call   80055f <_panic>
+
+008020a2 <ipc_reply_recv>:
+  8020a2:	55                   	push   %ebp
+  8020a3:	89 e5                	mov    %esp,%ebp
+  8020a5:	57                   	push   %edi
+  8020a6:	56                   	push   %esi
+  8020a7:	53                   	push   %ebx
+  8020a8:	83 ec 0c             	sub    $0xc,%esp
+  8020ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020ae:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8020b1:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8020b4:	85 db                	test   %ebx,%ebx
+  8020b6:	0f 84 ac 00 00 00    	je     802168 <ipc_reply_recv+0xc6>
+  8020bc:	85 f6                	test   %esi,%esi
+  8020be:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8020c3:	0f 45 c6             	cmovne %esi,%eax
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+  8020c9:	50                   	push   %eax
+  8020ca:	ff 75 14             	push   0x14(%ebp)
+  8020cd:	53                   	push   %ebx
+  8020ce:	ff 75 0c             	push   0xc(%ebp)
+  8020d1:	ff 75 08             	push   0x8(%ebp)
+  8020d4:	e8 61 f4 ff ff       	call   80153a <sys_ipc_reply_recv>
+  8020d9:	83 c4 20             	add    $0x20,%esp
+  8020dc:	85 c0                	test   %eax,%eax
+  8020de:	78 3a                	js     80211a <ipc_reply_recv+0x78>
+  8020e0:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8020e4:	74 10                	je     8020f6 <ipc_reply_recv+0x54>
+  8020e6:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  8020eb:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8020f1:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020f4:	89 02                	mov    %eax,(%edx)
+  8020f6:	85 ff                	test   %edi,%edi
+  8020f8:	74 0d                	je     802107 <ipc_reply_recv+0x65>
+  8020fa:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  8020ff:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802105:	89 07                	mov    %eax,(%edi)
+  802107:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  80210c:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802115:	5b                   	pop    %ebx
+  802116:	5e                   	pop    %esi
+  802117:	5f                   	pop    %edi
+  802118:	5d                   	pop    %ebp
+  802119:	c3                   	ret
+  80211a:	ff 75 14             	push   0x14(%ebp)
+  80211d:	53                   	push   %ebx
+  80211e:	ff 75 0c             	push   0xc(%ebp)
+  802121:	ff 75 08             	push   0x8(%ebp)
+  802124:	e8 c3 f2 ff ff       	call   8013ec <sys_ipc_try_send>
+  802129:	89 c2                	mov    %eax,%edx
+  80212b:	c1 ea 1f             	shr    $0x1f,%edx
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802134:	0f 95 c1             	setne  %cl
+  802137:	84 d1                	test   %dl,%cl
+  802139:	74 05                	je     802140 <ipc_reply_recv+0x9e>
+  80213b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80213e:	75 12                	jne    802152 <ipc_reply_recv+0xb0>
+  802140:	83 ec 04             	sub    $0x4,%esp
+  802143:	57                   	push   %edi
+  802144:	56                   	push   %esi
+  802145:	ff 75 18             	push   0x18(%ebp)
+  802148:	e8 e3 fd ff ff       	call   801f30 <ipc_recv>
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	eb c0                	jmp    802112 <ipc_reply_recv+0x70>
+  802152:	83 ec 04             	sub    $0x4,%esp
+  802155:	50                   	push   %eax
+  802156:	ff 75 08             	push   0x8(%ebp)
+  802159:	68 c0 44 80 00       	push   $0x8044c0
+  80215e:	e8 d7 e4 ff ff       	call   80063a <cprintf>
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	eb d8                	jmp    802140 <ipc_reply_recv+0x9e>
+  802168:	85 f6                	test   %esi,%esi
+  80216a:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80216f:	0f 45 c6             	cmovne %esi,%eax
+  802172:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802177:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80217e:	e9 43 ff ff ff       	jmp    8020c6 <ipc_reply_recv+0x24>
+
+00802183 <ipc_find_env>:
+  802183:	55                   	push   %ebp
+  802184:	89 e5                	mov    %esp,%ebp
+  802186:	83 ec 14             	sub    $0x14,%esp
+  802189:	ff 75 08             	push   0x8(%ebp)
+  80218c:	e8 f9 f1 ff ff       	call   80138a <sys_env_service>
+  802191:	85 c0                	test   %eax,%eax
+  802193:	ba 00 00 00 00       	mov    $0x0,%edx
+  802198:	0f 48 c2             	cmovs  %edx,%eax
+  80219b:	c9                   	leave
+  80219c:	c3                   	ret
+
+0080219d <fd2num>:
+  80219d:	55                   	push   %ebp
+  80219e:	89 e5                	mov    %esp,%ebp
+  8021a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8021a8:	c1 e8 0c             	shr    $0xc,%eax
+  8021ab:	5d                   	pop    %ebp
+  8021ac:	c3                   	ret
+
+008021ad <fd2data>:
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8021b8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021bd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8021c2:	5d                   	pop    %ebp
+  8021c3:	c3                   	ret
+
+008021c4 <fd_alloc>:
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8021cc:	89 c2                	mov    %eax,%edx
+  8021ce:	c1 ea 16             	shr    $0x16,%edx
+  8021d1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8021d8:	f6 c2 01             	test   $0x1,%dl
+  8021db:	74 29                	je     802206 <fd_alloc+0x42>
+  8021dd:	89 c2                	mov    %eax,%edx
+  8021df:	c1 ea 0c             	shr    $0xc,%edx
+  8021e2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8021e9:	f6 c2 01             	test   $0x1,%dl
+  8021ec:	74 18                	je     802206 <fd_alloc+0x42>
+  8021ee:	05 00 10 00 00       	add    $0x1000,%eax
+  8021f3:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8021f8:	75 d2                	jne    8021cc <fd_alloc+0x8>
+  8021fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ff:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802204:	eb 05                	jmp    80220b <fd_alloc+0x47>
+  802206:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80220b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80220e:	89 02                	mov    %eax,(%edx)
+  802210:	89 c8                	mov    %ecx,%eax
+  802212:	5d                   	pop    %ebp
+  802213:	c3                   	ret
+
+00802214 <fd_lookup>:
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221a:	83 f8 1f             	cmp    $0x1f,%eax
+  80221d:	77 30                	ja     80224f <fd_lookup+0x3b>
+  80221f:	c1 e0 0c             	shl    $0xc,%eax
+  802222:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  802227:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80222d:	f6 c2 01             	test   $0x1,%dl
+  802230:	74 24                	je     802256 <fd_lookup+0x42>
+  802232:	89 c2                	mov    %eax,%edx
+  802234:	c1 ea 0c             	shr    $0xc,%edx
+  802237:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80223e:	f6 c2 01             	test   $0x1,%dl
+  802241:	74 1a                	je     80225d <fd_lookup+0x49>
+  802243:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802246:	89 02                	mov    %eax,(%edx)
+  802248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224d:	5d                   	pop    %ebp
+  80224e:	c3                   	ret
+  80224f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802254:	eb f7                	jmp    80224d <fd_lookup+0x39>
+  802256:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80225b:	eb f0                	jmp    80224d <fd_lookup+0x39>
+  80225d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802262:	eb e9                	jmp    80224d <fd_lookup+0x39>
+
+00802264 <dev_lookup>:
+  802264:	55                   	push   %ebp
+  802265:	89 e5                	mov    %esp,%ebp
+  802267:	53                   	push   %ebx
+  802268:	83 ec 04             	sub    $0x4,%esp
+  80226b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802273:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  802278:	39 13                	cmp    %edx,(%ebx)
+  80227a:	74 37                	je     8022b3 <dev_lookup+0x4f>
+  80227c:	83 c0 01             	add    $0x1,%eax
+  80227f:	8b 1c 85 88 45 80 00 	mov    0x804588(,%eax,4),%ebx
+  802286:	85 db                	test   %ebx,%ebx
+  802288:	75 ee                	jne    802278 <dev_lookup+0x14>
+  80228a:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  80228f:	8b 40 48             	mov    0x48(%eax),%eax
+  802292:	83 ec 04             	sub    $0x4,%esp
+  802295:	52                   	push   %edx
+  802296:	50                   	push   %eax
+  802297:	68 0c 45 80 00       	push   $0x80450c
+  80229c:	e8 99 e3 ff ff       	call   80063a <cprintf>
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022ac:	89 1a                	mov    %ebx,(%edx)
+  8022ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b1:	c9                   	leave
+  8022b2:	c3                   	ret
+  8022b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b8:	eb ef                	jmp    8022a9 <dev_lookup+0x45>
+
+008022ba <fd_close>:
+  8022ba:	55                   	push   %ebp
+  8022bb:	89 e5                	mov    %esp,%ebp
+  8022bd:	57                   	push   %edi
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	83 ec 24             	sub    $0x24,%esp
+  8022c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022c6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8022c9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022cc:	50                   	push   %eax
+  8022cd:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8022d3:	c1 e8 0c             	shr    $0xc,%eax
+  8022d6:	50                   	push   %eax
+  8022d7:	e8 38 ff ff ff       	call   802214 <fd_lookup>
+  8022dc:	89 c3                	mov    %eax,%ebx
+  8022de:	83 c4 10             	add    $0x10,%esp
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	78 05                	js     8022ea <fd_close+0x30>
+  8022e5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8022e8:	74 0f                	je     8022f9 <fd_close+0x3f>
+  8022ea:	85 ff                	test   %edi,%edi
+  8022ec:	0f 44 df             	cmove  %edi,%ebx
+  8022ef:	89 d8                	mov    %ebx,%eax
+  8022f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f4:	5b                   	pop    %ebx
+  8022f5:	5e                   	pop    %esi
+  8022f6:	5f                   	pop    %edi
+  8022f7:	5d                   	pop    %ebp
+  8022f8:	c3                   	ret
+  8022f9:	83 ec 08             	sub    $0x8,%esp
+  8022fc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8022ff:	50                   	push   %eax
+  802300:	ff 36                	push   (%esi)
+  802302:	e8 5d ff ff ff       	call   802264 <dev_lookup>
+  802307:	89 c3                	mov    %eax,%ebx
+  802309:	83 c4 10             	add    $0x10,%esp
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	78 1a                	js     80232a <fd_close+0x70>
+  802310:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802313:	8b 40 10             	mov    0x10(%eax),%eax
+  802316:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	74 0b                	je     80232a <fd_close+0x70>
+  80231f:	83 ec 0c             	sub    $0xc,%esp
+  802322:	56                   	push   %esi
+  802323:	ff d0                	call   *%eax
+  802325:	89 c3                	mov    %eax,%ebx
+  802327:	83 c4 10             	add    $0x10,%esp
+  80232a:	83 ec 08             	sub    $0x8,%esp
+  80232d:	56                   	push   %esi
+  80232e:	6a 00                	push   $0x0
+  802330:	e8 2e ef ff ff       	call   801263 <sys_page_unmap>
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	eb b5                	jmp    8022ef <fd_close+0x35>
+
+0080233a <close>:
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	83 ec 20             	sub    $0x20,%esp
+  802340:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802343:	50                   	push   %eax
+  802344:	ff 75 08             	push   0x8(%ebp)
+  802347:	e8 c8 fe ff ff       	call   802214 <fd_lookup>
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	79 02                	jns    802355 <close+0x1b>
+  802353:	c9                   	leave
+  802354:	c3                   	ret
+  802355:	83 ec 08             	sub    $0x8,%esp
+  802358:	6a 01                	push   $0x1
+  80235a:	ff 75 f4             	push   -0xc(%ebp)
+  80235d:	e8 58 ff ff ff       	call   8022ba <fd_close>
+  802362:	83 c4 10             	add    $0x10,%esp
+  802365:	eb ec                	jmp    802353 <close+0x19>
+
+00802367 <close_all>:
+  802367:	55                   	push   %ebp
+  802368:	89 e5                	mov    %esp,%ebp
+  80236a:	53                   	push   %ebx
+  80236b:	83 ec 04             	sub    $0x4,%esp
+  80236e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802373:	83 ec 0c             	sub    $0xc,%esp
+  802376:	53                   	push   %ebx
+  802377:	e8 be ff ff ff       	call   80233a <close>
+  80237c:	83 c3 01             	add    $0x1,%ebx
+  80237f:	83 c4 10             	add    $0x10,%esp
+  802382:	83 fb 20             	cmp    $0x20,%ebx
+  802385:	75 ec                	jne    802373 <close_all+0xc>
+  802387:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80238a:	c9                   	leave
+  80238b:	c3                   	ret
+
+0080238c <dup>:
+  80238c:	55                   	push   %ebp
+  80238d:	89 e5                	mov    %esp,%ebp
+  80238f:	57                   	push   %edi
+  802390:	56                   	push   %esi
+  802391:	53                   	push   %ebx
+  802392:	83 ec 34             	sub    $0x34,%esp
+  802395:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802398:	50                   	push   %eax
+  802399:	ff 75 08             	push   0x8(%ebp)
+  80239c:	e8 73 fe ff ff       	call   802214 <fd_lookup>
+  8023a1:	89 c3                	mov    %eax,%ebx
+  8023a3:	83 c4 10             	add    $0x10,%esp
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	78 7f                	js     802429 <dup+0x9d>
+  8023aa:	83 ec 0c             	sub    $0xc,%esp
+  8023ad:	ff 75 0c             	push   0xc(%ebp)
+  8023b0:	e8 85 ff ff ff       	call   80233a <close>
+  8023b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023b8:	c1 e6 0c             	shl    $0xc,%esi
+  8023bb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8023c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8023c4:	89 3c 24             	mov    %edi,(%esp)
+  8023c7:	e8 e1 fd ff ff       	call   8021ad <fd2data>
+  8023cc:	89 c3                	mov    %eax,%ebx
+  8023ce:	89 34 24             	mov    %esi,(%esp)
+  8023d1:	e8 d7 fd ff ff       	call   8021ad <fd2data>
+  8023d6:	83 c4 10             	add    $0x10,%esp
+  8023d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023dc:	89 d8                	mov    %ebx,%eax
+  8023de:	c1 e8 16             	shr    $0x16,%eax
+  8023e1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8023e8:	a8 01                	test   $0x1,%al
+  8023ea:	74 11                	je     8023fd <dup+0x71>
+  8023ec:	89 d8                	mov    %ebx,%eax
+  8023ee:	c1 e8 0c             	shr    $0xc,%eax
+  8023f1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8023f8:	f6 c2 01             	test   $0x1,%dl
+  8023fb:	75 36                	jne    802433 <dup+0xa7>
+  8023fd:	89 f8                	mov    %edi,%eax
+  8023ff:	c1 e8 0c             	shr    $0xc,%eax
+  802402:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802409:	83 ec 0c             	sub    $0xc,%esp
+  80240c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802411:	50                   	push   %eax
+  802412:	56                   	push   %esi
+  802413:	6a 00                	push   $0x0
+  802415:	57                   	push   %edi
+  802416:	6a 00                	push   $0x0
+  802418:	e8 b7 ed ff ff       	call   8011d4 <sys_page_map>
+  80241d:	89 c3                	mov    %eax,%ebx
+  80241f:	83 c4 20             	add    $0x20,%esp
+  802422:	85 c0                	test   %eax,%eax
+  802424:	78 33                	js     802459 <dup+0xcd>
+  802426:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802429:	89 d8                	mov    %ebx,%eax
+  80242b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242e:	5b                   	pop    %ebx
+  80242f:	5e                   	pop    %esi
+  802430:	5f                   	pop    %edi
+  802431:	5d                   	pop    %ebp
+  802432:	c3                   	ret
+  802433:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80243a:	83 ec 0c             	sub    $0xc,%esp
+  80243d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802442:	50                   	push   %eax
+  802443:	ff 75 d4             	push   -0x2c(%ebp)
+  802446:	6a 00                	push   $0x0
+  802448:	53                   	push   %ebx
+  802449:	6a 00                	push   $0x0
+  80244b:	e8 84 ed ff ff       	call   8011d4 <sys_page_map>
+  802450:	89 c3                	mov    %eax,%ebx
+  802452:	83 c4 20             	add    $0x20,%esp
+  802455:	85 c0                	test   %eax,%eax
+  802457:	79 a4                	jns    8023fd <dup+0x71>
+  802459:	83 ec 08             	sub    $0x8,%esp
+  80245c:	56                   	push   %esi
+  80245d:	6a 00                	push   $0x0
+  80245f:	e8 ff ed ff ff       	call   801263 <sys_page_unmap>
+  802464:	83 c4 08             	add    $0x8,%esp
+  802467:	ff 75 d4             	push   -0x2c(%ebp)
+  80246a:	6a 00                	push   $0x0
+  80246c:	e8 f2 ed ff ff       	call   801263 <sys_page_unmap>
+  802471:	83 c4 10             	add    $0x10,%esp
+  802474:	eb b3                	jmp    802429 <dup+0x9d>
+
+00802476 <read>:
+  802476:	55                   	push   %ebp
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	56                   	push   %esi
+  80247a:	53                   	push   %ebx
+  80247b:	83 ec 18             	sub    $0x18,%esp
+  80247e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802481:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802484:	50                   	push   %eax
+  802485:	56                   	push   %esi
+  802486:	e8 89 fd ff ff       	call   802214 <fd_lookup>
+  80248b:	83 c4 10             	add    $0x10,%esp
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	78 3c                	js     8024ce <read+0x58>
+  802492:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802495:	83 ec 08             	sub    $0x8,%esp
+  802498:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80249b:	50                   	push   %eax
+  80249c:	ff 33                	push   (%ebx)
+  80249e:	e8 c1 fd ff ff       	call   802264 <dev_lookup>
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	78 24                	js     8024ce <read+0x58>
+  8024aa:	8b 43 08             	mov    0x8(%ebx),%eax
+  8024ad:	83 e0 03             	and    $0x3,%eax
+  8024b0:	83 f8 01             	cmp    $0x1,%eax
+  8024b3:	74 20                	je     8024d5 <read+0x5f>
+  8024b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024b8:	8b 40 08             	mov    0x8(%eax),%eax
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	74 37                	je     8024f6 <read+0x80>
+  8024bf:	83 ec 04             	sub    $0x4,%esp
+  8024c2:	ff 75 10             	push   0x10(%ebp)
+  8024c5:	ff 75 0c             	push   0xc(%ebp)
+  8024c8:	53                   	push   %ebx
+  8024c9:	ff d0                	call   *%eax
+  8024cb:	83 c4 10             	add    $0x10,%esp
+  8024ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d1:	5b                   	pop    %ebx
+  8024d2:	5e                   	pop    %esi
+  8024d3:	5d                   	pop    %ebp
+  8024d4:	c3                   	ret
+  8024d5:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  8024da:	8b 40 48             	mov    0x48(%eax),%eax
+  8024dd:	83 ec 04             	sub    $0x4,%esp
+  8024e0:	56                   	push   %esi
+  8024e1:	50                   	push   %eax
+  8024e2:	68 4d 45 80 00       	push   $0x80454d
+  8024e7:	e8 4e e1 ff ff       	call   80063a <cprintf>
+  8024ec:	83 c4 10             	add    $0x10,%esp
+  8024ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024f4:	eb d8                	jmp    8024ce <read+0x58>
+  8024f6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024fb:	eb d1                	jmp    8024ce <read+0x58>
+
+008024fd <readn>:
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	57                   	push   %edi
+  802501:	56                   	push   %esi
+  802502:	53                   	push   %ebx
+  802503:	83 ec 0c             	sub    $0xc,%esp
+  802506:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802509:	8b 75 10             	mov    0x10(%ebp),%esi
+  80250c:	85 f6                	test   %esi,%esi
+  80250e:	74 30                	je     802540 <readn+0x43>
+  802510:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251a:	83 ec 04             	sub    $0x4,%esp
+  80251d:	89 f2                	mov    %esi,%edx
+  80251f:	29 c2                	sub    %eax,%edx
+  802521:	52                   	push   %edx
+  802522:	01 f8                	add    %edi,%eax
+  802524:	50                   	push   %eax
+  802525:	ff 75 08             	push   0x8(%ebp)
+  802528:	e8 49 ff ff ff       	call   802476 <read>
+  80252d:	83 c4 10             	add    $0x10,%esp
+  802530:	85 c0                	test   %eax,%eax
+  802532:	78 15                	js     802549 <readn+0x4c>
+  802534:	74 11                	je     802547 <readn+0x4a>
+  802536:	01 c3                	add    %eax,%ebx
+  802538:	89 d8                	mov    %ebx,%eax
+  80253a:	39 f3                	cmp    %esi,%ebx
+  80253c:	72 dc                	jb     80251a <readn+0x1d>
+  80253e:	eb 09                	jmp    802549 <readn+0x4c>
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+  802545:	eb 02                	jmp    802549 <readn+0x4c>
+  802547:	89 d8                	mov    %ebx,%eax
+  802549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254c:	5b                   	pop    %ebx
+  80254d:	5e                   	pop    %esi
+  80254e:	5f                   	pop    %edi
+  80254f:	5d                   	pop    %ebp
+  802550:	c3                   	ret
+
+00802551 <write>:
+  802551:	55                   	push   %ebp
+  802552:	89 e5                	mov    %esp,%ebp
+  802554:	56                   	push   %esi
+  802555:	53                   	push   %ebx
+  802556:	83 ec 18             	sub    $0x18,%esp
+  802559:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80255c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80255f:	50                   	push   %eax
+  802560:	53                   	push   %ebx
+  802561:	e8 ae fc ff ff       	call   802214 <fd_lookup>
+  802566:	83 c4 10             	add    $0x10,%esp
+  802569:	85 c0                	test   %eax,%eax
+  80256b:	78 37                	js     8025a4 <write+0x53>
+  80256d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802570:	83 ec 08             	sub    $0x8,%esp
+  802573:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802576:	50                   	push   %eax
+  802577:	ff 36                	push   (%esi)
+  802579:	e8 e6 fc ff ff       	call   802264 <dev_lookup>
+  80257e:	83 c4 10             	add    $0x10,%esp
+  802581:	85 c0                	test   %eax,%eax
+  802583:	78 1f                	js     8025a4 <write+0x53>
+  802585:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802589:	74 20                	je     8025ab <write+0x5a>
+  80258b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80258e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802591:	85 c0                	test   %eax,%eax
+  802593:	74 37                	je     8025cc <write+0x7b>
+  802595:	83 ec 04             	sub    $0x4,%esp
+  802598:	ff 75 10             	push   0x10(%ebp)
+  80259b:	ff 75 0c             	push   0xc(%ebp)
+  80259e:	56                   	push   %esi
+  80259f:	ff d0                	call   *%eax
+  8025a1:	83 c4 10             	add    $0x10,%esp
+  8025a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025a7:	5b                   	pop    %ebx
+  8025a8:	5e                   	pop    %esi
+  8025a9:	5d                   	pop    %ebp
+  8025aa:	c3                   	ret
+  8025ab:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  8025b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8025b3:	83 ec 04             	sub    $0x4,%esp
+  8025b6:	53                   	push   %ebx
+  8025b7:	50                   	push   %eax
+  8025b8:	68 69 45 80 00       	push   $0x804569
+  8025bd:	e8 78 e0 ff ff       	call   80063a <cprintf>
+  8025c2:	83 c4 10             	add    $0x10,%esp
+  8025c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025ca:	eb d8                	jmp    8025a4 <write+0x53>
+  8025cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025d1:	eb d1                	jmp    8025a4 <write+0x53>
+
+008025d3 <seek>:
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	83 ec 20             	sub    $0x20,%esp
+  8025d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025dc:	50                   	push   %eax
+  8025dd:	ff 75 08             	push   0x8(%ebp)
+  8025e0:	e8 2f fc ff ff       	call   802214 <fd_lookup>
+  8025e5:	83 c4 10             	add    $0x10,%esp
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	78 0e                	js     8025fa <seek+0x27>
+  8025ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025f2:	89 50 04             	mov    %edx,0x4(%eax)
+  8025f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fa:	c9                   	leave
+  8025fb:	c3                   	ret
+
+008025fc <ftruncate>:
+  8025fc:	55                   	push   %ebp
+  8025fd:	89 e5                	mov    %esp,%ebp
+  8025ff:	56                   	push   %esi
+  802600:	53                   	push   %ebx
+  802601:	83 ec 18             	sub    $0x18,%esp
+  802604:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802607:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80260a:	50                   	push   %eax
+  80260b:	53                   	push   %ebx
+  80260c:	e8 03 fc ff ff       	call   802214 <fd_lookup>
+  802611:	83 c4 10             	add    $0x10,%esp
+  802614:	85 c0                	test   %eax,%eax
+  802616:	78 34                	js     80264c <ftruncate+0x50>
+  802618:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80261b:	83 ec 08             	sub    $0x8,%esp
+  80261e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802621:	50                   	push   %eax
+  802622:	ff 36                	push   (%esi)
+  802624:	e8 3b fc ff ff       	call   802264 <dev_lookup>
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	85 c0                	test   %eax,%eax
+  80262e:	78 1c                	js     80264c <ftruncate+0x50>
+  802630:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802634:	74 1d                	je     802653 <ftruncate+0x57>
+  802636:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802639:	8b 40 18             	mov    0x18(%eax),%eax
+  80263c:	85 c0                	test   %eax,%eax
+  80263e:	74 34                	je     802674 <ftruncate+0x78>
+  802640:	83 ec 08             	sub    $0x8,%esp
+  802643:	ff 75 0c             	push   0xc(%ebp)
+  802646:	56                   	push   %esi
+  802647:	ff d0                	call   *%eax
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80264f:	5b                   	pop    %ebx
+  802650:	5e                   	pop    %esi
+  802651:	5d                   	pop    %ebp
+  802652:	c3                   	ret
+  802653:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  802658:	8b 40 48             	mov    0x48(%eax),%eax
+  80265b:	83 ec 04             	sub    $0x4,%esp
+  80265e:	53                   	push   %ebx
+  80265f:	50                   	push   %eax
+  802660:	68 2c 45 80 00       	push   $0x80452c
+  802665:	e8 d0 df ff ff       	call   80063a <cprintf>
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802672:	eb d8                	jmp    80264c <ftruncate+0x50>
+  802674:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802679:	eb d1                	jmp    80264c <ftruncate+0x50>
+
+0080267b <fstat>:
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	56                   	push   %esi
+  80267f:	53                   	push   %ebx
+  802680:	83 ec 18             	sub    $0x18,%esp
+  802683:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802686:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802689:	50                   	push   %eax
+  80268a:	ff 75 08             	push   0x8(%ebp)
+  80268d:	e8 82 fb ff ff       	call   802214 <fd_lookup>
+  802692:	83 c4 10             	add    $0x10,%esp
+  802695:	85 c0                	test   %eax,%eax
+  802697:	78 49                	js     8026e2 <fstat+0x67>
+  802699:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80269c:	83 ec 08             	sub    $0x8,%esp
+  80269f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026a2:	50                   	push   %eax
+  8026a3:	ff 36                	push   (%esi)
+  8026a5:	e8 ba fb ff ff       	call   802264 <dev_lookup>
+  8026aa:	83 c4 10             	add    $0x10,%esp
+  8026ad:	85 c0                	test   %eax,%eax
+  8026af:	78 31                	js     8026e2 <fstat+0x67>
+  8026b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026b4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8026b8:	74 2f                	je     8026e9 <fstat+0x6e>
+  8026ba:	c6 03 00             	movb   $0x0,(%ebx)
+  8026bd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8026c4:	00 00 00 
+  8026c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026ce:	00 00 00 
+  8026d1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8026d7:	83 ec 08             	sub    $0x8,%esp
+  8026da:	53                   	push   %ebx
+  8026db:	56                   	push   %esi
+  8026dc:	ff 50 14             	call   *0x14(%eax)
+  8026df:	83 c4 10             	add    $0x10,%esp
+  8026e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e5:	5b                   	pop    %ebx
+  8026e6:	5e                   	pop    %esi
+  8026e7:	5d                   	pop    %ebp
+  8026e8:	c3                   	ret
+  8026e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026ee:	eb f2                	jmp    8026e2 <fstat+0x67>
+
+008026f0 <stat>:
+  8026f0:	55                   	push   %ebp
+  8026f1:	89 e5                	mov    %esp,%ebp
+  8026f3:	56                   	push   %esi
+  8026f4:	53                   	push   %ebx
+  8026f5:	83 ec 08             	sub    $0x8,%esp
+  8026f8:	6a 00                	push   $0x0
+  8026fa:	ff 75 08             	push   0x8(%ebp)
+  8026fd:	e8 31 05 00 00       	call   802c33 <open>
+  802702:	89 c3                	mov    %eax,%ebx
+  802704:	83 c4 10             	add    $0x10,%esp
+  802707:	85 c0                	test   %eax,%eax
+  802709:	78 1b                	js     802726 <stat+0x36>
+  80270b:	83 ec 08             	sub    $0x8,%esp
+  80270e:	ff 75 0c             	push   0xc(%ebp)
+  802711:	50                   	push   %eax
+  802712:	e8 64 ff ff ff       	call   80267b <fstat>
+  802717:	89 c6                	mov    %eax,%esi
+  802719:	89 1c 24             	mov    %ebx,(%esp)
+  80271c:	e8 19 fc ff ff       	call   80233a <close>
+  802721:	83 c4 10             	add    $0x10,%esp
+  802724:	89 f3                	mov    %esi,%ebx
+  802726:	89 d8                	mov    %ebx,%eax
+  802728:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80272b:	5b                   	pop    %ebx
+  80272c:	5e                   	pop    %esi
+  80272d:	5d                   	pop    %ebp
+  80272e:	c3                   	ret
+
+0080272f <fsipc>:
+  80272f:	55                   	push   %ebp
+  802730:	89 e5                	mov    %esp,%ebp
+  802732:	56                   	push   %esi
+  802733:	53                   	push   %ebx
+  802734:	89 c3                	mov    %eax,%ebx
+  802736:	89 d6                	mov    %edx,%esi
+  802738:	83 3d 14 60 80 00 00 	cmpl   $0x0,0x806014
+  80273f:	74 20                	je     802761 <fsipc+0x32>
+  802741:	83 ec 08             	sub    $0x8,%esp
+  802744:	6a 00                	push   $0x0
+  802746:	56                   	push   %esi
+  802747:	6a 07                	push   $0x7
+  802749:	68 00 70 80 00       	push   $0x807000
+  80274e:	53                   	push   %ebx
+  80274f:	ff 35 14 60 80 00    	push   0x806014
+  802755:	e8 8e f8 ff ff       	call   801fe8 <ipc_call>
+  80275a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80275d:	5b                   	pop    %ebx
+  80275e:	5e                   	pop    %esi
+  80275f:	5d                   	pop    %ebp
+  802760:	c3                   	ret
+  802761:	83 ec 0c             	sub    $0xc,%esp
+  802764:	6a 02                	push   $0x2
+  802766:	e8 18 fa ff ff       	call   802183 <ipc_find_env>
+  80276b:	a3 14 60 80 00       	mov    %eax,0x806014
+  802770:	83 c4 10             	add    $0x10,%esp
+  802773:	eb cc                	jmp    802741 <fsipc+0x12>
+
+00802775 <devfile_trunc>:
+  802775:	55                   	push   %ebp
+  802776:	89 e5                	mov    %esp,%ebp
+  802778:	83 ec 08             	sub    $0x8,%esp
+  80277b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802781:	a3 00 70 80 00       	mov    %eax,0x807000
+  802786:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802789:	a3 04 70 80 00       	mov    %eax,0x807004
+  80278e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802793:	b8 02 00 00 00       	mov    $0x2,%eax
+  802798:	e8 92 ff ff ff       	call   80272f <fsipc>
+  80279d:	c9                   	leave
+  80279e:	c3                   	ret
+
+0080279f <devfile_flush>:
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	83 ec 08             	sub    $0x8,%esp
+  8027a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027ab:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027ba:	e8 70 ff ff ff       	call   80272f <fsipc>
+  8027bf:	c9                   	leave
+  8027c0:	c3                   	ret
+
+008027c1 <devfile_stat>:
+  8027c1:	55                   	push   %ebp
+  8027c2:	89 e5                	mov    %esp,%ebp
+  8027c4:	53                   	push   %ebx
+  8027c5:	83 ec 04             	sub    $0x4,%esp
+  8027c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ce:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027d1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027db:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027e0:	e8 4a ff ff ff       	call   80272f <fsipc>
+  8027e5:	85 c0                	test   %eax,%eax
+  8027e7:	78 2c                	js     802815 <devfile_stat+0x54>
+  8027e9:	83 ec 08             	sub    $0x8,%esp
+  8027ec:	68 00 70 80 00       	push   $0x807000
+  8027f1:	53                   	push   %ebx
+  8027f2:	e8 3a e5 ff ff       	call   800d31 <strcpy>
+  8027f7:	a1 80 70 80 00       	mov    0x807080,%eax
+  8027fc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802802:	a1 84 70 80 00       	mov    0x807084,%eax
+  802807:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80280d:	83 c4 10             	add    $0x10,%esp
+  802810:	b8 00 00 00 00       	mov    $0x0,%eax
+  802815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802818:	c9                   	leave
+  802819:	c3                   	ret
+
+0080281a <fsring_rw>:
+  80281a:	55                   	push   %ebp
+  80281b:	89 e5                	mov    %esp,%ebp
+  80281d:	57                   	push   %edi
+  80281e:	56                   	push   %esi
+  80281f:	53                   	push   %ebx
+  802820:	83 ec 2c             	sub    $0x2c,%esp
+  802823:	89 c7                	mov    %eax,%edi
+  802825:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802828:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80282b:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802830:	a8 01                	test   $0x1,%al
+  802832:	74 0d                	je     802841 <fsring_rw+0x27>
+  802834:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802839:	a8 01                	test   $0x1,%al
+  80283b:	0f 85 d5 00 00 00    	jne    802916 <fsring_rw+0xfc>
+  802841:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  802846:	8b 40 48             	mov    0x48(%eax),%eax
+  802849:	3b 05 10 60 80 00    	cmp    0x806010,%eax
+  80284f:	0f 84 fc 00 00 00    	je     802951 <fsring_rw+0x137>
+  802855:	83 3d 14 60 80 00 00 	cmpl   $0x0,0x806014
+  80285c:	0f 84 02 01 00 00    	je     802964 <fsring_rw+0x14a>
+  802862:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802867:	83 ec 04             	sub    $0x4,%esp
+  80286a:	68 07 02 00 00       	push   $0x207
+  80286f:	53                   	push   %ebx
+  802870:	6a 00                	push   $0x0
+  802872:	e8 1a e9 ff ff       	call   801191 <sys_page_alloc>
+  802877:	83 c4 10             	add    $0x10,%esp
+  80287a:	85 c0                	test   %eax,%eax
+  80287c:	0f 88 f9 00 00 00    	js     80297b <fsring_rw+0x161>
+  802882:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802888:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80288e:	75 d7                	jne    802867 <fsring_rw+0x4d>
+  802890:	6a 0e                	push   $0xe
+  802892:	6a 0d                	push   $0xd
+  802894:	ff 35 14 60 80 00    	push   0x806014
+  80289a:	68 00 00 f0 cf       	push   $0xcff00000
+  80289f:	e8 c4 0c 00 00       	call   803568 <ipcring_init>
+  8028a4:	83 c4 08             	add    $0x8,%esp
+  8028a7:	6a 00                	push   $0x0
+  8028a9:	6a 00                	push   $0x0
+  8028ab:	68 07 02 00 00       	push   $0x207
+  8028b0:	68 00 00 f0 cf       	push   $0xcff00000
+  8028b5:	6a 0b                	push   $0xb
+  8028b7:	ff 35 14 60 80 00    	push   0x806014
+  8028bd:	e8 26 f7 ff ff       	call   801fe8 <ipc_call>
+  8028c2:	89 c6                	mov    %eax,%esi
+  8028c4:	83 c4 20             	add    $0x20,%esp
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	0f 88 ac 00 00 00    	js     80297b <fsring_rw+0x161>
+  8028cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d4:	89 d9                	mov    %ebx,%ecx
+  8028d6:	83 c3 01             	add    $0x1,%ebx
+  8028d9:	89 da                	mov    %ebx,%edx
+  8028db:	c1 e2 0c             	shl    $0xc,%edx
+  8028de:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8028e4:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8028ea:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8028f0:	83 ec 08             	sub    $0x8,%esp
+  8028f3:	6a 00                	push   $0x0
+  8028f5:	6a 00                	push   $0x0
+  8028f7:	68 07 02 00 00       	push   $0x207
+  8028fc:	50                   	push   %eax
+  8028fd:	6a 0c                	push   $0xc
+  8028ff:	ff 35 14 60 80 00    	push   0x806014
+  802905:	e8 de f6 ff ff       	call   801fe8 <ipc_call>
+  80290a:	83 c4 20             	add    $0x20,%esp
+  80290d:	85 c0                	test   %eax,%eax
+  80290f:	78 6a                	js     80297b <fsring_rw+0x161>
+  802911:	83 fb 08             	cmp    $0x8,%ebx
+  802914:	75 be                	jne    8028d4 <fsring_rw+0xba>
+  802916:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80291a:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80291f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802924:	0f 45 c2             	cmovne %edx,%eax
+  802927:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80292a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802931:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802938:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  80293f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802944:	be 00 00 00 00       	mov    $0x0,%esi
+  802949:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80294c:	e9 4b 01 00 00       	jmp    802a9c <fsring_rw+0x282>
+  802951:	e8 05 ec ff ff       	call   80155b <sys_time_msec>
+  802956:	3b 05 0c 60 80 00    	cmp    0x80600c,%eax
+  80295c:	0f 89 f3 fe ff ff    	jns    802855 <fsring_rw+0x3b>
+  802962:	eb 54                	jmp    8029b8 <fsring_rw+0x19e>
+  802964:	83 ec 0c             	sub    $0xc,%esp
+  802967:	6a 02                	push   $0x2
+  802969:	e8 15 f8 ff ff       	call   802183 <ipc_find_env>
+  80296e:	a3 14 60 80 00       	mov    %eax,0x806014
+  802973:	83 c4 10             	add    $0x10,%esp
+  802976:	e9 e7 fe ff ff       	jmp    802862 <fsring_rw+0x48>
+  80297b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802980:	83 ec 08             	sub    $0x8,%esp
+  802983:	53                   	push   %ebx
+  802984:	6a 00                	push   $0x0
+  802986:	e8 d8 e8 ff ff       	call   801263 <sys_page_unmap>
+  80298b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802991:	83 c4 10             	add    $0x10,%esp
+  802994:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80299a:	75 e4                	jne    802980 <fsring_rw+0x166>
+  80299c:	e8 ba eb ff ff       	call   80155b <sys_time_msec>
+  8029a1:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8029a6:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8029ab:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  8029b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8029b3:	a3 10 60 80 00       	mov    %eax,0x806010
+  8029b8:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8029bf:	e9 7a 01 00 00       	jmp    802b3e <fsring_rw+0x324>
+  8029c4:	8b 57 0c             	mov    0xc(%edi),%edx
+  8029c7:	89 10                	mov    %edx,(%eax)
+  8029c9:	89 58 04             	mov    %ebx,0x4(%eax)
+  8029cc:	89 f2                	mov    %esi,%edx
+  8029ce:	03 57 04             	add    0x4(%edi),%edx
+  8029d1:	89 50 08             	mov    %edx,0x8(%eax)
+  8029d4:	83 ec 04             	sub    $0x4,%esp
+  8029d7:	53                   	push   %ebx
+  8029d8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8029db:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8029de:	52                   	push   %edx
+  8029df:	83 c0 0c             	add    $0xc,%eax
+  8029e2:	50                   	push   %eax
+  8029e3:	e8 f9 e4 ff ff       	call   800ee1 <memmove>
+  8029e8:	83 c4 10             	add    $0x10,%esp
+  8029eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ee:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8029f1:	89 08                	mov    %ecx,(%eax)
+  8029f3:	83 ec 0c             	sub    $0xc,%esp
+  8029f6:	68 00 00 f0 cf       	push   $0xcff00000
+  8029fb:	e8 c6 0b 00 00       	call   8035c6 <ipcring_req_push>
+  802a00:	01 de                	add    %ebx,%esi
+  802a02:	83 c4 10             	add    $0x10,%esp
+  802a05:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802a08:	73 4c                	jae    802a56 <fsring_rw+0x23c>
+  802a0a:	83 ec 0c             	sub    $0xc,%esp
+  802a0d:	68 00 00 f0 cf       	push   $0xcff00000
+  802a12:	e8 89 0b 00 00       	call   8035a0 <ipcring_req_slot>
+  802a17:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a1a:	83 c4 10             	add    $0x10,%esp
+  802a1d:	85 c0                	test   %eax,%eax
+  802a1f:	74 35                	je     802a56 <fsring_rw+0x23c>
+  802a21:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802a26:	83 e0 07             	and    $0x7,%eax
+  802a29:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802a2e:	c1 e0 0c             	shl    $0xc,%eax
+  802a31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a34:	29 f3                	sub    %esi,%ebx
+  802a36:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802a39:	39 cb                	cmp    %ecx,%ebx
+  802a3b:	0f 47 d9             	cmova  %ecx,%ebx
+  802a3e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802a42:	75 80                	jne    8029c4 <fsring_rw+0x1aa>
+  802a44:	8b 57 0c             	mov    0xc(%edi),%edx
+  802a47:	89 10                	mov    %edx,(%eax)
+  802a49:	89 58 04             	mov    %ebx,0x4(%eax)
+  802a4c:	89 f2                	mov    %esi,%edx
+  802a4e:	03 57 04             	add    0x4(%edi),%edx
+  802a51:	89 50 08             	mov    %edx,0x8(%eax)
+  802a54:	eb 95                	jmp    8029eb <fsring_rw+0x1d1>
+  802a56:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802a5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a5e:	83 ec 0c             	sub    $0xc,%esp
+  802a61:	68 00 00 f0 cf       	push   $0xcff00000
+  802a66:	e8 94 0b 00 00       	call   8035ff <ipcring_rsp_wait>
+  802a6b:	8b 58 04             	mov    0x4(%eax),%ebx
+  802a6e:	83 c4 10             	add    $0x10,%esp
+  802a71:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802a75:	75 45                	jne    802abc <fsring_rw+0x2a2>
+  802a77:	85 db                	test   %ebx,%ebx
+  802a79:	79 41                	jns    802abc <fsring_rw+0x2a2>
+  802a7b:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802a7e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802a85:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802a8c:	83 ec 0c             	sub    $0xc,%esp
+  802a8f:	68 00 00 f0 cf       	push   $0xcff00000
+  802a94:	e8 cc 0b 00 00       	call   803665 <ipcring_rsp_pop>
+  802a99:	83 c4 10             	add    $0x10,%esp
+  802a9c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802aa2:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802aa7:	39 c2                	cmp    %eax,%edx
+  802aa9:	74 75                	je     802b20 <fsring_rw+0x306>
+  802aab:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802aaf:	75 a5                	jne    802a56 <fsring_rw+0x23c>
+  802ab1:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802ab4:	0f 82 50 ff ff ff    	jb     802a0a <fsring_rw+0x1f0>
+  802aba:	eb 9a                	jmp    802a56 <fsring_rw+0x23c>
+  802abc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802ac0:	75 ca                	jne    802a8c <fsring_rw+0x272>
+  802ac2:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802ac6:	74 31                	je     802af9 <fsring_rw+0x2df>
+  802ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acb:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802ace:	29 c8                	sub    %ecx,%eax
+  802ad0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802ad3:	39 d0                	cmp    %edx,%eax
+  802ad5:	0f 47 c2             	cmova  %edx,%eax
+  802ad8:	39 d8                	cmp    %ebx,%eax
+  802ada:	ba 01 00 00 00       	mov    $0x1,%edx
+  802adf:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802ae3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802ae6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802aeb:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802aef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802af2:	01 d9                	add    %ebx,%ecx
+  802af4:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802af7:	eb 93                	jmp    802a8c <fsring_rw+0x272>
+  802af9:	83 ec 04             	sub    $0x4,%esp
+  802afc:	53                   	push   %ebx
+  802afd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b00:	83 e0 07             	and    $0x7,%eax
+  802b03:	c1 e0 0c             	shl    $0xc,%eax
+  802b06:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802b0c:	50                   	push   %eax
+  802b0d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802b10:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802b13:	01 c8                	add    %ecx,%eax
+  802b15:	50                   	push   %eax
+  802b16:	e8 c6 e3 ff ff       	call   800ee1 <memmove>
+  802b1b:	83 c4 10             	add    $0x10,%esp
+  802b1e:	eb a8                	jmp    802ac8 <fsring_rw+0x2ae>
+  802b20:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802b24:	75 09                	jne    802b2f <fsring_rw+0x315>
+  802b26:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802b29:	0f 82 db fe ff ff    	jb     802a0a <fsring_rw+0x1f0>
+  802b2f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802b32:	01 57 04             	add    %edx,0x4(%edi)
+  802b35:	85 d2                	test   %edx,%edx
+  802b37:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802b3b:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802b3e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802b41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b44:	5b                   	pop    %ebx
+  802b45:	5e                   	pop    %esi
+  802b46:	5f                   	pop    %edi
+  802b47:	5d                   	pop    %ebp
+  802b48:	c3                   	ret
+
+00802b49 <devfile_write>:
+  802b49:	55                   	push   %ebp
+  802b4a:	89 e5                	mov    %esp,%ebp
+  802b4c:	57                   	push   %edi
+  802b4d:	56                   	push   %esi
+  802b4e:	53                   	push   %ebx
+  802b4f:	83 ec 0c             	sub    $0xc,%esp
+  802b52:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b55:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b5b:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802b61:	76 1a                	jbe    802b7d <devfile_write+0x34>
+  802b63:	83 ec 0c             	sub    $0xc,%esp
+  802b66:	53                   	push   %ebx
+  802b67:	89 f1                	mov    %esi,%ecx
+  802b69:	ba 06 00 00 00       	mov    $0x6,%edx
+  802b6e:	89 f8                	mov    %edi,%eax
+  802b70:	e8 a5 fc ff ff       	call   80281a <fsring_rw>
+  802b75:	83 c4 10             	add    $0x10,%esp
+  802b78:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802b7b:	75 39                	jne    802bb6 <devfile_write+0x6d>
+  802b7d:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802b82:	39 c3                	cmp    %eax,%ebx
+  802b84:	0f 47 d8             	cmova  %eax,%ebx
+  802b87:	8b 47 0c             	mov    0xc(%edi),%eax
+  802b8a:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b8f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802b95:	83 ec 04             	sub    $0x4,%esp
+  802b98:	53                   	push   %ebx
+  802b99:	56                   	push   %esi
+  802b9a:	68 08 70 80 00       	push   $0x807008
+  802b9f:	e8 3d e3 ff ff       	call   800ee1 <memmove>
+  802ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba9:	b8 04 00 00 00       	mov    $0x4,%eax
+  802bae:	e8 7c fb ff ff       	call   80272f <fsipc>
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb9:	5b                   	pop    %ebx
+  802bba:	5e                   	pop    %esi
+  802bbb:	5f                   	pop    %edi
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+
+00802bbe <devfile_read>:
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	57                   	push   %edi
+  802bc2:	56                   	push   %esi
+  802bc3:	53                   	push   %ebx
+  802bc4:	83 ec 0c             	sub    $0xc,%esp
+  802bc7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bca:	8b 75 10             	mov    0x10(%ebp),%esi
+  802bcd:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802bd3:	76 1d                	jbe    802bf2 <devfile_read+0x34>
+  802bd5:	83 ec 0c             	sub    $0xc,%esp
+  802bd8:	56                   	push   %esi
+  802bd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bdc:	ba 05 00 00 00       	mov    $0x5,%edx
+  802be1:	89 f8                	mov    %edi,%eax
+  802be3:	e8 32 fc ff ff       	call   80281a <fsring_rw>
+  802be8:	89 c3                	mov    %eax,%ebx
+  802bea:	83 c4 10             	add    $0x10,%esp
+  802bed:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802bf0:	75 37                	jne    802c29 <devfile_read+0x6b>
+  802bf2:	8b 47 0c             	mov    0xc(%edi),%eax
+  802bf5:	a3 00 70 80 00       	mov    %eax,0x807000
+  802bfa:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802c00:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c05:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c0a:	e8 20 fb ff ff       	call   80272f <fsipc>
+  802c0f:	89 c3                	mov    %eax,%ebx
+  802c11:	85 c0                	test   %eax,%eax
+  802c13:	78 14                	js     802c29 <devfile_read+0x6b>
+  802c15:	83 ec 04             	sub    $0x4,%esp
+  802c18:	50                   	push   %eax
+  802c19:	68 00 70 80 00       	push   $0x807000
+  802c1e:	ff 75 0c             	push   0xc(%ebp)
+  802c21:	e8 bb e2 ff ff       	call   800ee1 <memmove>
+  802c26:	83 c4 10             	add    $0x10,%esp
+  802c29:	89 d8                	mov    %ebx,%eax
+  802c2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c2e:	5b                   	pop    %ebx
+  802c2f:	5e                   	pop    %esi
+  802c30:	5f                   	pop    %edi
+  802c31:	5d                   	pop    %ebp
+  802c32:	c3                   	ret
+
+00802c33 <open>:
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	56                   	push   %esi
+  802c37:	53                   	push   %ebx
+  802c38:	83 ec 1c             	sub    $0x1c,%esp
+  802c3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c3e:	56                   	push   %esi
+  802c3f:	e8 a1 e0 ff ff       	call   800ce5 <strlen>
+  802c44:	83 c4 10             	add    $0x10,%esp
+  802c47:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c4c:	7f 6c                	jg     802cba <open+0x87>
+  802c4e:	83 ec 0c             	sub    $0xc,%esp
+  802c51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c54:	50                   	push   %eax
+  802c55:	e8 6a f5 ff ff       	call   8021c4 <fd_alloc>
+  802c5a:	89 c3                	mov    %eax,%ebx
+  802c5c:	83 c4 10             	add    $0x10,%esp
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	78 3c                	js     802c9f <open+0x6c>
+  802c63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c66:	a3 00 74 80 00       	mov    %eax,0x807400
+  802c6b:	83 ec 08             	sub    $0x8,%esp
+  802c6e:	56                   	push   %esi
+  802c6f:	68 00 70 80 00       	push   $0x807000
+  802c74:	e8 b8 e0 ff ff       	call   800d31 <strcpy>
+  802c79:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c81:	e8 a9 fa ff ff       	call   80272f <fsipc>
+  802c86:	89 c3                	mov    %eax,%ebx
+  802c88:	83 c4 10             	add    $0x10,%esp
+  802c8b:	85 c0                	test   %eax,%eax
+  802c8d:	78 19                	js     802ca8 <open+0x75>
+  802c8f:	83 ec 0c             	sub    $0xc,%esp
+  802c92:	ff 75 f4             	push   -0xc(%ebp)
+  802c95:	e8 03 f5 ff ff       	call   80219d <fd2num>
+  802c9a:	89 c3                	mov    %eax,%ebx
+  802c9c:	83 c4 10             	add    $0x10,%esp
+  802c9f:	89 d8                	mov    %ebx,%eax
+  802ca1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ca4:	5b                   	pop    %ebx
+  802ca5:	5e                   	pop    %esi
+  802ca6:	5d                   	pop    %ebp
+  802ca7:	c3                   	ret
+  802ca8:	83 ec 08             	sub    $0x8,%esp
+  802cab:	6a 00                	push   $0x0
+  802cad:	ff 75 f4             	push   -0xc(%ebp)
+  802cb0:	e8 05 f6 ff ff       	call   8022ba <fd_close>
+  802cb5:	83 c4 10             	add    $0x10,%esp
+  802cb8:	eb e5                	jmp    802c9f <open+0x6c>
+  802cba:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802cbf:	eb de                	jmp    802c9f <open+0x6c>
+
+00802cc1 <file_image>:
+  802cc1:	55                   	push   %ebp
+  802cc2:	89 e5                	mov    %esp,%ebp
+  802cc4:	53                   	push   %ebx
+  802cc5:	83 ec 1c             	sub    $0x1c,%esp
+  802cc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ccb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cce:	50                   	push   %eax
+  802ccf:	ff 75 08             	push   0x8(%ebp)
+  802cd2:	e8 3d f5 ff ff       	call   802214 <fd_lookup>
+  802cd7:	83 c4 10             	add    $0x10,%esp
+  802cda:	85 c0                	test   %eax,%eax
+  802cdc:	78 58                	js     802d36 <file_image+0x75>
+  802cde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ce1:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802ce7:	39 08                	cmp    %ecx,(%eax)
+  802ce9:	75 50                	jne    802d3b <file_image+0x7a>
+  802ceb:	83 fb 04             	cmp    $0x4,%ebx
+  802cee:	77 52                	ja     802d42 <file_image+0x81>
+  802cf0:	8b 40 0c             	mov    0xc(%eax),%eax
+  802cf3:	a3 00 70 80 00       	mov    %eax,0x807000
+  802cf8:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802cfe:	83 ec 04             	sub    $0x4,%esp
+  802d01:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d04:	c1 e0 02             	shl    $0x2,%eax
+  802d07:	50                   	push   %eax
+  802d08:	ff 75 0c             	push   0xc(%ebp)
+  802d0b:	68 08 70 80 00       	push   $0x807008
+  802d10:	e8 cc e1 ff ff       	call   800ee1 <memmove>
+  802d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d1a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802d1f:	e8 0b fa ff ff       	call   80272f <fsipc>
+  802d24:	83 c4 10             	add    $0x10,%esp
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	78 0b                	js     802d36 <file_image+0x75>
+  802d2b:	8b 55 14             	mov    0x14(%ebp),%edx
+  802d2e:	8b 0d 14 60 80 00    	mov    0x806014,%ecx
+  802d34:	89 0a                	mov    %ecx,(%edx)
+  802d36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d39:	c9                   	leave
+  802d3a:	c3                   	ret
+  802d3b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802d40:	eb f4                	jmp    802d36 <file_image+0x75>
+  802d42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d47:	eb ed                	jmp    802d36 <file_image+0x75>
+
+00802d49 <remove>:
+  802d49:	55                   	push   %ebp
+  802d4a:	89 e5                	mov    %esp,%ebp
+  802d4c:	53                   	push   %ebx
+  802d4d:	83 ec 10             	sub    $0x10,%esp
+  802d50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802d53:	53                   	push   %ebx
+  802d54:	e8 8c df ff ff       	call   800ce5 <strlen>
+  802d59:	83 c4 10             	add    $0x10,%esp
+  802d5c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d61:	7f 25                	jg     802d88 <remove+0x3f>
+  802d63:	83 ec 08             	sub    $0x8,%esp
+  802d66:	53                   	push   %ebx
+  802d67:	68 00 70 80 00       	push   $0x807000
+  802d6c:	e8 c0 df ff ff       	call   800d31 <strcpy>
+  802d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d76:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d7b:	e8 af f9 ff ff       	call   80272f <fsipc>
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d86:	c9                   	leave
+  802d87:	c3                   	ret
+  802d88:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802d8d:	eb f4                	jmp    802d83 <remove+0x3a>
+
+00802d8f <sync>:
+  802d8f:	55                   	push   %ebp
+  802d90:	89 e5                	mov    %esp,%ebp
+  802d92:	83 ec 08             	sub    $0x8,%esp
+  802d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802d9f:	e8 8b f9 ff ff       	call   80272f <fsipc>
+  802da4:	c9                   	leave
+  802da5:	c3                   	ret
+
+00802da6 <devsock_stat>:
+  802da6:	55                   	push   %ebp
+  802da7:	89 e5                	mov    %esp,%ebp
+  802da9:	83 ec 10             	sub    $0x10,%esp
+  802dac:	68 9c 45 80 00       	push   $0x80459c
+  802db1:	ff 75 0c             	push   0xc(%ebp)
+  802db4:	e8 78 df ff ff       	call   800d31 <strcpy>
+  802db9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbe:	c9                   	leave
+  802dbf:	c3                   	ret
+
+00802dc0 <devsock_close>:
+  802dc0:	55                   	push   %ebp
+  802dc1:	89 e5                	mov    %esp,%ebp
+  802dc3:	53                   	push   %ebx
+  802dc4:	83 ec 10             	sub    $0x10,%esp
+  802dc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802dca:	53                   	push   %ebx
+  802dcb:	e8 cf 0b 00 00       	call   80399f <pageref>
+  802dd0:	89 c2                	mov    %eax,%edx
+  802dd2:	83 c4 10             	add    $0x10,%esp
+  802dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dda:	83 fa 01             	cmp    $0x1,%edx
+  802ddd:	74 05                	je     802de4 <devsock_close+0x24>
+  802ddf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802de2:	c9                   	leave
+  802de3:	c3                   	ret
+  802de4:	83 ec 0c             	sub    $0xc,%esp
+  802de7:	ff 73 0c             	push   0xc(%ebx)
+  802dea:	e8 aa 02 00 00       	call   803099 <nsipc_close>
+  802def:	83 c4 10             	add    $0x10,%esp
+  802df2:	eb eb                	jmp    802ddf <devsock_close+0x1f>
+
+00802df4 <devsock_write>:
+  802df4:	55                   	push   %ebp
+  802df5:	89 e5                	mov    %esp,%ebp
+  802df7:	83 ec 08             	sub    $0x8,%esp
+  802dfa:	6a 00                	push   $0x0
+  802dfc:	ff 75 10             	push   0x10(%ebp)
+  802dff:	ff 75 0c             	push   0xc(%ebp)
+  802e02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e05:	ff 70 0c             	push   0xc(%eax)
+  802e08:	e8 6c 03 00 00       	call   803179 <nsipc_send>
+  802e0d:	c9                   	leave
+  802e0e:	c3                   	ret
+
+00802e0f <devsock_read>:
+  802e0f:	55                   	push   %ebp
+  802e10:	89 e5                	mov    %esp,%ebp
+  802e12:	83 ec 08             	sub    $0x8,%esp
+  802e15:	6a 00                	push   $0x0
+  802e17:	ff 75 10             	push   0x10(%ebp)
+  802e1a:	ff 75 0c             	push   0xc(%ebp)
+  802e1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e20:	ff 70 0c             	push   0xc(%eax)
+  802e23:	e8 e2 02 00 00       	call   80310a <nsipc_recv>
+  802e28:	c9                   	leave
+  802e29:	c3                   	ret
+
+00802e2a <fd2sockid>:
+  802e2a:	55                   	push   %ebp
+  802e2b:	89 e5                	mov    %esp,%ebp
+  802e2d:	83 ec 20             	sub    $0x20,%esp
+  802e30:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802e33:	52                   	push   %edx
+  802e34:	50                   	push   %eax
+  802e35:	e8 da f3 ff ff       	call   802214 <fd_lookup>
+  802e3a:	83 c4 10             	add    $0x10,%esp
+  802e3d:	85 c0                	test   %eax,%eax
+  802e3f:	78 10                	js     802e51 <fd2sockid+0x27>
+  802e41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e44:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802e4a:	39 08                	cmp    %ecx,(%eax)
+  802e4c:	75 05                	jne    802e53 <fd2sockid+0x29>
+  802e4e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+  802e53:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e58:	eb f7                	jmp    802e51 <fd2sockid+0x27>
+
+00802e5a <alloc_sockfd>:
+  802e5a:	55                   	push   %ebp
+  802e5b:	89 e5                	mov    %esp,%ebp
+  802e5d:	56                   	push   %esi
+  802e5e:	53                   	push   %ebx
+  802e5f:	83 ec 1c             	sub    $0x1c,%esp
+  802e62:	89 c6                	mov    %eax,%esi
+  802e64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e67:	50                   	push   %eax
+  802e68:	e8 57 f3 ff ff       	call   8021c4 <fd_alloc>
+  802e6d:	89 c3                	mov    %eax,%ebx
+  802e6f:	83 c4 10             	add    $0x10,%esp
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	78 43                	js     802eb9 <alloc_sockfd+0x5f>
+  802e76:	83 ec 04             	sub    $0x4,%esp
+  802e79:	68 07 04 00 00       	push   $0x407
+  802e7e:	ff 75 f4             	push   -0xc(%ebp)
+  802e81:	6a 00                	push   $0x0
+  802e83:	e8 09 e3 ff ff       	call   801191 <sys_page_alloc>
+  802e88:	89 c3                	mov    %eax,%ebx
+  802e8a:	83 c4 10             	add    $0x10,%esp
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	78 28                	js     802eb9 <alloc_sockfd+0x5f>
+  802e91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e94:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802e9a:	89 10                	mov    %edx,(%eax)
+  802e9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e9f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802ea6:	89 70 0c             	mov    %esi,0xc(%eax)
+  802ea9:	83 ec 0c             	sub    $0xc,%esp
+  802eac:	50                   	push   %eax
+  802ead:	e8 eb f2 ff ff       	call   80219d <fd2num>
+  802eb2:	89 c3                	mov    %eax,%ebx
+  802eb4:	83 c4 10             	add    $0x10,%esp
+  802eb7:	eb 0c                	jmp    802ec5 <alloc_sockfd+0x6b>
+  802eb9:	83 ec 0c             	sub    $0xc,%esp
+  802ebc:	56                   	push   %esi
+  802ebd:	e8 d7 01 00 00       	call   803099 <nsipc_close>
+  802ec2:	83 c4 10             	add    $0x10,%esp
+  802ec5:	89 d8                	mov    %ebx,%eax
+  802ec7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eca:	5b                   	pop    %ebx
+  802ecb:	5e                   	pop    %esi
+  802ecc:	5d                   	pop    %ebp
+  802ecd:	c3                   	ret
+
+00802ece <accept>:
+  802ece:	55                   	push   %ebp
+  802ecf:	89 e5                	mov    %esp,%ebp
+  802ed1:	83 ec 08             	sub    $0x8,%esp
+  802ed4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ed7:	e8 4e ff ff ff       	call   802e2a <fd2sockid>
+  802edc:	85 c0                	test   %eax,%eax
+  802ede:	78 1b                	js     802efb <accept+0x2d>
+  802ee0:	83 ec 04             	sub    $0x4,%esp
+  802ee3:	ff 75 10             	push   0x10(%ebp)
+  802ee6:	ff 75 0c             	push   0xc(%ebp)
+  802ee9:	50                   	push   %eax
+  802eea:	e8 07 01 00 00       	call   802ff6 <nsipc_accept>
+  802eef:	83 c4 10             	add    $0x10,%esp
+  802ef2:	85 c0                	test   %eax,%eax
+  802ef4:	78 05                	js     802efb <accept+0x2d>
+  802ef6:	e8 5f ff ff ff       	call   802e5a <alloc_sockfd>
+  802efb:	c9                   	leave
+  802efc:	c3                   	ret
+
+00802efd <bind>:
+  802efd:	55                   	push   %ebp
+  802efe:	89 e5                	mov    %esp,%ebp
+  802f00:	83 ec 08             	sub    $0x8,%esp
+  802f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f06:	e8 1f ff ff ff       	call   802e2a <fd2sockid>
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	78 12                	js     802f21 <bind+0x24>
+  802f0f:	83 ec 04             	sub    $0x4,%esp
+  802f12:	ff 75 10             	push   0x10(%ebp)
+  802f15:	ff 75 0c             	push   0xc(%ebp)
+  802f18:	50                   	push   %eax
+  802f19:	e8 24 01 00 00       	call   803042 <nsipc_bind>
+  802f1e:	83 c4 10             	add    $0x10,%esp
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+
+00802f23 <shutdown>:
+  802f23:	55                   	push   %ebp
+  802f24:	89 e5                	mov    %esp,%ebp
+  802f26:	83 ec 08             	sub    $0x8,%esp
+  802f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2c:	e8 f9 fe ff ff       	call   802e2a <fd2sockid>
+  802f31:	85 c0                	test   %eax,%eax
+  802f33:	78 0f                	js     802f44 <shutdown+0x21>
+  802f35:	83 ec 08             	sub    $0x8,%esp
+  802f38:	ff 75 0c             	push   0xc(%ebp)
+  802f3b:	50                   	push   %eax
+  802f3c:	e8 36 01 00 00       	call   803077 <nsipc_shutdown>
+  802f41:	83 c4 10             	add    $0x10,%esp
+  802f44:	c9                   	leave
+  802f45:	c3                   	ret
+
+00802f46 <connect>:
+  802f46:	55                   	push   %ebp
+  802f47:	89 e5                	mov    %esp,%ebp
+  802f49:	83 ec 08             	sub    $0x8,%esp
+  802f4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f4f:	e8 d6 fe ff ff       	call   802e2a <fd2sockid>
+  802f54:	85 c0                	test   %eax,%eax
+  802f56:	78 12                	js     802f6a <connect+0x24>
+  802f58:	83 ec 04             	sub    $0x4,%esp
+  802f5b:	ff 75 10             	push   0x10(%ebp)
+  802f5e:	ff 75 0c             	push   0xc(%ebp)
+  802f61:	50                   	push   %eax
+  802f62:	e8 4c 01 00 00       	call   8030b3 <nsipc_connect>
+  802f67:	83 c4 10             	add    $0x10,%esp
+  802f6a:	c9                   	leave
+  802f6b:	c3                   	ret
+
+00802f6c <listen>:
+  802f6c:	55                   	push   %ebp
+  802f6d:	89 e5                	mov    %esp,%ebp
+  802f6f:	83 ec 08             	sub    $0x8,%esp
+  802f72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f75:	e8 b0 fe ff ff       	call   802e2a <fd2sockid>
+  802f7a:	85 c0                	test   %eax,%eax
+  802f7c:	78 0f                	js     802f8d <listen+0x21>
+  802f7e:	83 ec 08             	sub    $0x8,%esp
+  802f81:	ff 75 0c             	push   0xc(%ebp)
+  802f84:	50                   	push   %eax
+  802f85:	e8 5e 01 00 00       	call   8030e8 <nsipc_listen>
+  802f8a:	83 c4 10             	add    $0x10,%esp
+  802f8d:	c9                   	leave
+  802f8e:	c3                   	ret
+
+00802f8f <socket>:
+  802f8f:	55                   	push   %ebp
+  802f90:	89 e5                	mov    %esp,%ebp
+  802f92:	83 ec 0c             	sub    $0xc,%esp
+  802f95:	ff 75 10             	push   0x10(%ebp)
+  802f98:	ff 75 0c             	push   0xc(%ebp)
+  802f9b:	ff 75 08             	push   0x8(%ebp)
+  802f9e:	e8 34 02 00 00       	call   8031d7 <nsipc_socket>
+  802fa3:	83 c4 10             	add    $0x10,%esp
+  802fa6:	85 c0                	test   %eax,%eax
+  802fa8:	78 05                	js     802faf <socket+0x20>
+  802faa:	e8 ab fe ff ff       	call   802e5a <alloc_sockfd>
+  802faf:	c9                   	leave
+  802fb0:	c3                   	ret
+
+00802fb1 <nsipc>:
+  802fb1:	55                   	push   %ebp
+  802fb2:	89 e5                	mov    %esp,%ebp
+  802fb4:	53                   	push   %ebx
+  802fb5:	83 ec 04             	sub    $0x4,%esp
+  802fb8:	89 c3                	mov    %eax,%ebx
+  802fba:	83 3d 18 60 80 00 00 	cmpl   $0x0,0x806018
+  802fc1:	74 1f                	je     802fe2 <nsipc+0x31>
+  802fc3:	83 ec 08             	sub    $0x8,%esp
+  802fc6:	6a 00                	push   $0x0
+  802fc8:	6a 00                	push   $0x0
+  802fca:	6a 07                	push   $0x7
+  802fcc:	68 00 80 80 00       	push   $0x808000
+  802fd1:	53                   	push   %ebx
+  802fd2:	ff 35 18 60 80 00    	push   0x806018
+  802fd8:	e8 0b f0 ff ff       	call   801fe8 <ipc_call>
+  802fdd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fe0:	c9                   	leave
+  802fe1:	c3                   	ret
+  802fe2:	83 ec 0c             	sub    $0xc,%esp
+  802fe5:	6a 03                	push   $0x3
+  802fe7:	e8 97 f1 ff ff       	call   802183 <ipc_find_env>
+  802fec:	a3 18 60 80 00       	mov    %eax,0x806018
+  802ff1:	83 c4 10             	add    $0x10,%esp
+  802ff4:	eb cd                	jmp    802fc3 <nsipc+0x12>
+
+00802ff6 <nsipc_accept>:
+  802ff6:	55                   	push   %ebp
+  802ff7:	89 e5                	mov    %esp,%ebp
+  802ff9:	53                   	push   %ebx
+  802ffa:	83 ec 04             	sub    $0x4,%esp
+  802ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803000:	a3 00 80 80 00       	mov    %eax,0x808000
+  803005:	b8 01 00 00 00       	mov    $0x1,%eax
+  80300a:	e8 a2 ff ff ff       	call   802fb1 <nsipc>
+  80300f:	89 c3                	mov    %eax,%ebx
+  803011:	85 c0                	test   %eax,%eax
+  803013:	79 07                	jns    80301c <nsipc_accept+0x26>
+  803015:	89 d8                	mov    %ebx,%eax
+  803017:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80301a:	c9                   	leave
+  80301b:	c3                   	ret
+  80301c:	83 ec 04             	sub    $0x4,%esp
+  80301f:	ff 35 10 80 80 00    	push   0x808010
+  803025:	68 00 80 80 00       	push   $0x808000
+  80302a:	ff 75 0c             	push   0xc(%ebp)
+  80302d:	e8 af de ff ff       	call   800ee1 <memmove>
+  803032:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803038:	8b 45 10             	mov    0x10(%ebp),%eax
+  80303b:	89 10                	mov    %edx,(%eax)
+  80303d:	83 c4 10             	add    $0x10,%esp
+  803040:	eb d3                	jmp    803015 <nsipc_accept+0x1f>
+
+00803042 <nsipc_bind>:
+  803042:	55                   	push   %ebp
+  803043:	89 e5                	mov    %esp,%ebp
+  803045:	53                   	push   %ebx
+  803046:	83 ec 08             	sub    $0x8,%esp
+  803049:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80304c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80304f:	a3 00 80 80 00       	mov    %eax,0x808000
+  803054:	53                   	push   %ebx
+  803055:	ff 75 0c             	push   0xc(%ebp)
+  803058:	68 04 80 80 00       	push   $0x808004
+  80305d:	e8 7f de ff ff       	call   800ee1 <memmove>
+  803062:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  803068:	b8 02 00 00 00       	mov    $0x2,%eax
+  80306d:	e8 3f ff ff ff       	call   802fb1 <nsipc>
+  803072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803075:	c9                   	leave
+  803076:	c3                   	ret
+
+00803077 <nsipc_shutdown>:
+  803077:	55                   	push   %ebp
+  803078:	89 e5                	mov    %esp,%ebp
+  80307a:	83 ec 08             	sub    $0x8,%esp
+  80307d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803080:	a3 00 80 80 00       	mov    %eax,0x808000
+  803085:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803088:	a3 04 80 80 00       	mov    %eax,0x808004
+  80308d:	b8 03 00 00 00       	mov    $0x3,%eax
+  803092:	e8 1a ff ff ff       	call   802fb1 <nsipc>
+  803097:	c9                   	leave
+  803098:	c3                   	ret
+
+00803099 <nsipc_close>:
+  803099:	55                   	push   %ebp
+  80309a:	89 e5                	mov    %esp,%ebp
+  80309c:	83 ec 08             	sub    $0x8,%esp
+  80309f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a2:	a3 00 80 80 00       	mov    %eax,0x808000
+  8030a7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8030ac:	e8 00 ff ff ff       	call   802fb1 <nsipc>
+  8030b1:	c9                   	leave
+  8030b2:	c3                   	ret
+
+008030b3 <nsipc_connect>:
+  8030b3:	55                   	push   %ebp
+  8030b4:	89 e5                	mov    %esp,%ebp
+  8030b6:	53                   	push   %ebx
+  8030b7:	83 ec 08             	sub    $0x8,%esp
+  8030ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c0:	a3 00 80 80 00       	mov    %eax,0x808000
+  8030c5:	53                   	push   %ebx
+  8030c6:	ff 75 0c             	push   0xc(%ebp)
+  8030c9:	68 04 80 80 00       	push   $0x808004
+  8030ce:	e8 0e de ff ff       	call   800ee1 <memmove>
+  8030d3:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  8030d9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8030de:	e8 ce fe ff ff       	call   802fb1 <nsipc>
+  8030e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030e6:	c9                   	leave
+  8030e7:	c3                   	ret
+
+008030e8 <nsipc_listen>:
+  8030e8:	55                   	push   %ebp
+  8030e9:	89 e5                	mov    %esp,%ebp
+  8030eb:	83 ec 08             	sub    $0x8,%esp
+  8030ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030f1:	a3 00 80 80 00       	mov    %eax,0x808000
+  8030f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030f9:	a3 04 80 80 00       	mov    %eax,0x808004
+  8030fe:	b8 06 00 00 00       	mov    $0x6,%eax
+  803103:	e8 a9 fe ff ff       	call   802fb1 <nsipc>
+  803108:	c9                   	leave
+  803109:	c3                   	ret
+
+0080310a <nsipc_recv>:
+  80310a:	55                   	push   %ebp
+  80310b:	89 e5                	mov    %esp,%ebp
+  80310d:	56                   	push   %esi
+  80310e:	53                   	push   %ebx
+  80310f:	8b 75 10             	mov    0x10(%ebp),%esi
+  803112:	8b 45 08             	mov    0x8(%ebp),%eax
+  803115:	a3 00 80 80 00       	mov    %eax,0x808000
+  80311a:	89 35 04 80 80 00    	mov    %esi,0x808004
+  803120:	8b 45 14             	mov    0x14(%ebp),%eax
+  803123:	a3 08 80 80 00       	mov    %eax,0x808008
+  803128:	b8 07 00 00 00       	mov    $0x7,%eax
+  80312d:	e8 7f fe ff ff       	call   802fb1 <nsipc>
+  803132:	89 c3                	mov    %eax,%ebx
+  803134:	85 c0                	test   %eax,%eax
+  803136:	78 22                	js     80315a <nsipc_recv+0x50>
+  803138:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80313d:	39 c6                	cmp    %eax,%esi
+  80313f:	0f 4e c6             	cmovle %esi,%eax
+  803142:	39 c3                	cmp    %eax,%ebx
+  803144:	7f 1d                	jg     803163 <nsipc_recv+0x59>
+  803146:	83 ec 04             	sub    $0x4,%esp
+  803149:	53                   	push   %ebx
+  80314a:	68 00 80 80 00       	push   $0x808000
+  80314f:	ff 75 0c             	push   0xc(%ebp)
+  803152:	e8 8a dd ff ff       	call   800ee1 <memmove>
+  803157:	83 c4 10             	add    $0x10,%esp
+  80315a:	89 d8                	mov    %ebx,%eax
+  80315c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80315f:	5b                   	pop    %ebx
+  803160:	5e                   	pop    %esi
+  803161:	5d                   	pop    %ebp
+  803162:	c3                   	ret
+  803163:	68 a8 45 80 00       	push   $0x8045a8
+  803168:	68 bd 45 80 00       	push   $0x8045bd
+  80316d:	6a 60                	push   $0x60
+  80316f:	68 d2 45 80 00       	push   $0x8045d2
+  803174:	e8 e6 d3 ff ff       	call   80055f <_panic>
+
+00803179 <nsipc_send>:
+  803179:	55                   	push   %ebp
+  80317a:	89 e5                	mov    %esp,%ebp
+  80317c:	53                   	push   %ebx
+  80317d:	83 ec 04             	sub    $0x4,%esp
+  803180:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803183:	8b 45 08             	mov    0x8(%ebp),%eax
+  803186:	a3 00 80 80 00       	mov    %eax,0x808000
+  80318b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803191:	7f 2e                	jg     8031c1 <nsipc_send+0x48>
+  803193:	83 ec 04             	sub    $0x4,%esp
+  803196:	53                   	push   %ebx
+  803197:	ff 75 0c             	push   0xc(%ebp)
+  80319a:	68 0c 80 80 00       	push   $0x80800c
+  80319f:	e8 3d dd ff ff       	call   800ee1 <memmove>
+  8031a4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  8031aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031ad:	a3 08 80 80 00       	mov    %eax,0x808008
+  8031b2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8031b7:	e8 f5 fd ff ff       	call   802fb1 <nsipc>
+  8031bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031bf:	c9                   	leave
+  8031c0:	c3                   	ret
+  8031c1:	68 de 45 80 00       	push   $0x8045de
+  8031c6:	68 bd 45 80 00       	push   $0x8045bd
+  8031cb:	6a 6b                	push   $0x6b
+  8031cd:	68 d2 45 80 00       	push   $0x8045d2
+  8031d2:	e8 88 d3 ff ff       	call   80055f <_panic>
+
+008031d7 <nsipc_socket>:
+  8031d7:	55                   	push   %ebp
+  8031d8:	89 e5                	mov    %esp,%ebp
+  8031da:	83 ec 08             	sub    $0x8,%esp
+  8031dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031e0:	a3 00 80 80 00       	mov    %eax,0x808000
+  8031e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031e8:	a3 04 80 80 00       	mov    %eax,0x808004
+  8031ed:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031f0:	a3 08 80 80 00       	mov    %eax,0x808008
+  8031f5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8031fa:	e8 b2 fd ff ff       	call   802fb1 <nsipc>
+  8031ff:	c9                   	leave
+  803200:	c3                   	ret
+
+00803201 <devpipe_stat>:
+  803201:	55                   	push   %ebp
+  803202:	89 e5                	mov    %esp,%ebp
+  803204:	56                   	push   %esi
+  803205:	53                   	push   %ebx
+  803206:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803209:	83 ec 0c             	sub    $0xc,%esp
+  80320c:	ff 75 08             	push   0x8(%ebp)
+  80320f:	e8 99 ef ff ff       	call   8021ad <fd2data>
+  803214:	89 c6                	mov    %eax,%esi
+  803216:	83 c4 08             	add    $0x8,%esp
+  803219:	68 ea 45 80 00       	push   $0x8045ea
+  80321e:	53                   	push   %ebx
+  80321f:	e8 0d db ff ff       	call   800d31 <strcpy>
+  803224:	8b 46 04             	mov    0x4(%esi),%eax
+  803227:	2b 06                	sub    (%esi),%eax
+  803229:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80322f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803236:	00 00 00 
+  803239:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  803240:	50 80 00 
+  803243:	b8 00 00 00 00       	mov    $0x0,%eax
+  803248:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80324b:	5b                   	pop    %ebx
+  80324c:	5e                   	pop    %esi
+  80324d:	5d                   	pop    %ebp
+  80324e:	c3                   	ret
+
+0080324f <devpipe_close>:
+  80324f:	55                   	push   %ebp
+  803250:	89 e5                	mov    %esp,%ebp
+  803252:	53                   	push   %ebx
+  803253:	83 ec 0c             	sub    $0xc,%esp
+  803256:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803259:	53                   	push   %ebx
+  80325a:	6a 00                	push   $0x0
+  80325c:	e8 02 e0 ff ff       	call   801263 <sys_page_unmap>
+  803261:	89 1c 24             	mov    %ebx,(%esp)
+  803264:	e8 44 ef ff ff       	call   8021ad <fd2data>
+  803269:	83 c4 08             	add    $0x8,%esp
+  80326c:	50                   	push   %eax
+  80326d:	6a 00                	push   $0x0
+  80326f:	e8 ef df ff ff       	call   801263 <sys_page_unmap>
+  803274:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803277:	c9                   	leave
+  803278:	c3                   	ret
+
+00803279 <_pipeisclosed>:
+  803279:	55                   	push   %ebp
+  80327a:	89 e5                	mov    %esp,%ebp
+  80327c:	57                   	push   %edi
+  80327d:	56                   	push   %esi
+  80327e:	53                   	push   %ebx
+  80327f:	83 ec 1c             	sub    $0x1c,%esp
+  803282:	89 c7                	mov    %eax,%edi
+  803284:	89 d6                	mov    %edx,%esi
+  803286:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  80328b:	8b 58 58             	mov    0x58(%eax),%ebx
+  80328e:	83 ec 0c             	sub    $0xc,%esp
+  803291:	57                   	push   %edi
+  803292:	e8 08 07 00 00       	call   80399f <pageref>
+  803297:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80329a:	89 34 24             	mov    %esi,(%esp)
+  80329d:	e8 fd 06 00 00       	call   80399f <pageref>
+  8032a2:	8b 15 2c 60 80 00    	mov    0x80602c,%edx
+  8032a8:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8032ab:	83 c4 10             	add    $0x10,%esp
+  8032ae:	39 cb                	cmp    %ecx,%ebx
+  8032b0:	74 1b                	je     8032cd <_pipeisclosed+0x54>
+  8032b2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032b5:	75 cf                	jne    803286 <_pipeisclosed+0xd>
+  8032b7:	8b 42 58             	mov    0x58(%edx),%eax
+  8032ba:	6a 01                	push   $0x1
+  8032bc:	50                   	push   %eax
+  8032bd:	53                   	push   %ebx
+  8032be:	68 f1 45 80 00       	push   $0x8045f1
+  8032c3:	e8 72 d3 ff ff       	call   80063a <cprintf>
+  8032c8:	83 c4 10             	add    $0x10,%esp
+  8032cb:	eb b9                	jmp    803286 <_pipeisclosed+0xd>
+  8032cd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032d0:	0f 94 c0             	sete   %al
+  8032d3:	0f b6 c0             	movzbl %al,%eax
+  8032d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032d9:	5b                   	pop    %ebx
+  8032da:	5e                   	pop    %esi
+  8032db:	5f                   	pop    %edi
+  8032dc:	5d                   	pop    %ebp
+  8032dd:	c3                   	ret
+
+008032de <devpipe_write>:
+  8032de:	55                   	push   %ebp
+  8032df:	89 e5                	mov    %esp,%ebp
+  8032e1:	57                   	push   %edi
+  8032e2:	56                   	push   %esi
+  8032e3:	53                   	push   %ebx
+  8032e4:	83 ec 28             	sub    $0x28,%esp
+  8032e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032ea:	56                   	push   %esi
+  8032eb:	e8 bd ee ff ff       	call   8021ad <fd2data>
+  8032f0:	89 c3                	mov    %eax,%ebx
+  8032f2:	83 c4 10             	add    $0x10,%esp
+  8032f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032fa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032fe:	74 5c                	je     80335c <devpipe_write+0x7e>
+  803300:	8b 43 04             	mov    0x4(%ebx),%eax
+  803303:	8b 0b                	mov    (%ebx),%ecx
+  803305:	8d 51 20             	lea    0x20(%ecx),%edx
+  803308:	39 d0                	cmp    %edx,%eax
+  80330a:	72 1e                	jb     80332a <devpipe_write+0x4c>
+  80330c:	89 da                	mov    %ebx,%edx
+  80330e:	89 f0                	mov    %esi,%eax
+  803310:	e8 64 ff ff ff       	call   803279 <_pipeisclosed>
+  803315:	85 c0                	test   %eax,%eax
+  803317:	75 48                	jne    803361 <devpipe_write+0x83>
+  803319:	e8 28 de ff ff       	call   801146 <sys_yield>
+  80331e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803321:	8b 0b                	mov    (%ebx),%ecx
+  803323:	8d 51 20             	lea    0x20(%ecx),%edx
+  803326:	39 d0                	cmp    %edx,%eax
+  803328:	73 e2                	jae    80330c <devpipe_write+0x2e>
+  80332a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80332d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803331:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803334:	89 c2                	mov    %eax,%edx
+  803336:	c1 fa 1f             	sar    $0x1f,%edx
+  803339:	89 d1                	mov    %edx,%ecx
+  80333b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80333e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803341:	83 e2 1f             	and    $0x1f,%edx
+  803344:	29 ca                	sub    %ecx,%edx
+  803346:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80334a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80334e:	83 c0 01             	add    $0x1,%eax
+  803351:	89 43 04             	mov    %eax,0x4(%ebx)
+  803354:	83 c7 01             	add    $0x1,%edi
+  803357:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80335a:	75 a4                	jne    803300 <devpipe_write+0x22>
+  80335c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80335f:	eb 05                	jmp    803366 <devpipe_write+0x88>
+  803361:	b8 00 00 00 00       	mov    $0x0,%eax
+  803366:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803369:	5b                   	pop    %ebx
+  80336a:	5e                   	pop    %esi
+  80336b:	5f                   	pop    %edi
+  80336c:	5d                   	pop    %ebp
+  80336d:	c3                   	ret
+
+0080336e <devpipe_read>:
+  80336e:	55                   	push   %ebp
+  80336f:	89 e5                	mov    %esp,%ebp
+  803371:	57                   	push   %edi
+  803372:	56                   	push   %esi
+  803373:	53                   	push   %ebx
+  803374:	83 ec 18             	sub    $0x18,%esp
+  803377:	8b 75 08             	mov    0x8(%ebp),%esi
+  80337a:	56                   	push   %esi
+  80337b:	e8 2d ee ff ff       	call   8021ad <fd2data>
+  803380:	89 c3                	mov    %eax,%ebx
+  803382:	83 c4 10             	add    $0x10,%esp
+  803385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80338a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80338e:	74 45                	je     8033d5 <devpipe_read+0x67>
+  803390:	8b 03                	mov    (%ebx),%eax
+  803392:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803395:	75 1d                	jne    8033b4 <devpipe_read+0x46>
+  803397:	85 ff                	test   %edi,%edi
+  803399:	75 3f                	jne    8033da <devpipe_read+0x6c>
+  80339b:	89 da                	mov    %ebx,%edx
+  80339d:	89 f0                	mov    %esi,%eax
+  80339f:	e8 d5 fe ff ff       	call   803279 <_pipeisclosed>
+  8033a4:	85 c0                	test   %eax,%eax
+  8033a6:	75 3c                	jne    8033e4 <devpipe_read+0x76>
+  8033a8:	e8 99 dd ff ff       	call   801146 <sys_yield>
+  8033ad:	8b 03                	mov    (%ebx),%eax
+  8033af:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8033b2:	74 e7                	je     80339b <devpipe_read+0x2d>
+  8033b4:	99                   	cltd
+  8033b5:	c1 ea 1b             	shr    $0x1b,%edx
+  8033b8:	01 d0                	add    %edx,%eax
+  8033ba:	83 e0 1f             	and    $0x1f,%eax
+  8033bd:	29 d0                	sub    %edx,%eax
+  8033bf:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8033c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8033c7:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8033ca:	83 03 01             	addl   $0x1,(%ebx)
+  8033cd:	83 c7 01             	add    $0x1,%edi
+  8033d0:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8033d3:	75 bb                	jne    803390 <devpipe_read+0x22>
+  8033d5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033d8:	eb 02                	jmp    8033dc <devpipe_read+0x6e>
+  8033da:	89 f8                	mov    %edi,%eax
+  8033dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033df:	5b                   	pop    %ebx
+  8033e0:	5e                   	pop    %esi
+  8033e1:	5f                   	pop    %edi
+  8033e2:	5d                   	pop    %ebp
+  8033e3:	c3                   	ret
+  8033e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e9:	eb f1                	jmp    8033dc <devpipe_read+0x6e>
+
+008033eb <pipe>:
+  8033eb:	55                   	push   %ebp
+  8033ec:	89 e5                	mov    %esp,%ebp
+  8033ee:	56                   	push   %esi
+  8033ef:	53                   	push   %ebx
+  8033f0:	83 ec 1c             	sub    $0x1c,%esp
+  8033f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033f6:	50                   	push   %eax
+  8033f7:	e8 c8 ed ff ff       	call   8021c4 <fd_alloc>
+  8033fc:	89 c3                	mov    %eax,%ebx
+  8033fe:	83 c4 10             	add    $0x10,%esp
+  803401:	85 c0                	test   %eax,%eax
+  803403:	0f 88 23 01 00 00    	js     80352c <pipe+0x141>
+  803409:	83 ec 04             	sub    $0x4,%esp
+  80340c:	68 07 04 00 00       	push   $0x407
+  803411:	ff 75 f4             	push   -0xc(%ebp)
+  803414:	6a 00                	push   $0x0
+  803416:	e8 76 dd ff ff       	call   801191 <sys_page_alloc>
+  80341b:	89 c3                	mov    %eax,%ebx
+  80341d:	83 c4 10             	add    $0x10,%esp
+  803420:	85 c0                	test   %eax,%eax
+  803422:	0f 88 04 01 00 00    	js     80352c <pipe+0x141>
+  803428:	83 ec 0c             	sub    $0xc,%esp
+  80342b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80342e:	50                   	push   %eax
+  80342f:	e8 90 ed ff ff       	call   8021c4 <fd_alloc>
+  803434:	89 c3                	mov    %eax,%ebx
+  803436:	83 c4 10             	add    $0x10,%esp
+  803439:	85 c0                	test   %eax,%eax
+  80343b:	0f 88 db 00 00 00    	js     80351c <pipe+0x131>
+  803441:	83 ec 04             	sub    $0x4,%esp
+  803444:	68 07 04 00 00       	push   $0x407
+  803449:	ff 75 f0             	push   -0x10(%ebp)
+  80344c:	6a 00                	push   $0x0
+  80344e:	e8 3e dd ff ff       	call   801191 <sys_page_alloc>
+  803453:	89 c3                	mov    %eax,%ebx
+  803455:	83 c4 10             	add    $0x10,%esp
+  803458:	85 c0                	test   %eax,%eax
+  80345a:	0f 88 bc 00 00 00    	js     80351c <pipe+0x131>
+  803460:	83 ec 0c             	sub    $0xc,%esp
+  803463:	ff 75 f4             	push   -0xc(%ebp)
+  803466:	e8 42 ed ff ff       	call   8021ad <fd2data>
+  80346b:	89 c6                	mov    %eax,%esi
+  80346d:	83 c4 0c             	add    $0xc,%esp
+  803470:	68 07 04 00 00       	push   $0x407
+  803475:	50                   	push   %eax
+  803476:	6a 00                	push   $0x0
+  803478:	e8 14 dd ff ff       	call   801191 <sys_page_alloc>
+  80347d:	89 c3                	mov    %eax,%ebx
+  80347f:	83 c4 10             	add    $0x10,%esp
+  803482:	85 c0                	test   %eax,%eax
+  803484:	0f 88 82 00 00 00    	js     80350c <pipe+0x121>
+  80348a:	83 ec 0c             	sub    $0xc,%esp
+  80348d:	ff 75 f0             	push   -0x10(%ebp)
+  803490:	e8 18 ed ff ff       	call   8021ad <fd2data>
+  803495:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80349c:	50                   	push   %eax
+  80349d:	6a 00                	push   $0x0
+  80349f:	56                   	push   %esi
+  8034a0:	6a 00                	push   $0x0
+  8034a2:	e8 2d dd ff ff       	call   8011d4 <sys_page_map>
+  8034a7:	89 c3                	mov    %eax,%ebx
+  8034a9:	83 c4 20             	add    $0x20,%esp
+  8034ac:	85 c0                	test   %eax,%eax
+  8034ae:	78 4e                	js     8034fe <pipe+0x113>
+  8034b0:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  8034b5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8034b8:	89 02                	mov    %eax,(%edx)
+  8034ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8034bd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8034c4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8034c7:	89 02                	mov    %eax,(%edx)
+  8034c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8034cc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8034d3:	83 ec 0c             	sub    $0xc,%esp
+  8034d6:	ff 75 f4             	push   -0xc(%ebp)
+  8034d9:	e8 bf ec ff ff       	call   80219d <fd2num>
+  8034de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034e1:	89 01                	mov    %eax,(%ecx)
+  8034e3:	83 c4 04             	add    $0x4,%esp
+  8034e6:	ff 75 f0             	push   -0x10(%ebp)
+  8034e9:	e8 af ec ff ff       	call   80219d <fd2num>
+  8034ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034f1:	89 41 04             	mov    %eax,0x4(%ecx)
+  8034f4:	83 c4 10             	add    $0x10,%esp
+  8034f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034fc:	eb 2e                	jmp    80352c <pipe+0x141>
+  8034fe:	83 ec 08             	sub    $0x8,%esp
+  803501:	56                   	push   %esi
+  803502:	6a 00                	push   $0x0
+  803504:	e8 5a dd ff ff       	call   801263 <sys_page_unmap>
+  803509:	83 c4 10             	add    $0x10,%esp
+  80350c:	83 ec 08             	sub    $0x8,%esp
+  80350f:	ff 75 f0             	push   -0x10(%ebp)
+  803512:	6a 00                	push   $0x0
+  803514:	e8 4a dd ff ff       	call   801263 <sys_page_unmap>
+  803519:	83 c4 10             	add    $0x10,%esp
+  80351c:	83 ec 08             	sub    $0x8,%esp
+  80351f:	ff 75 f4             	push   -0xc(%ebp)
+  803522:	6a 00                	push   $0x0
+  803524:	e8 3a dd ff ff       	call   801263 <sys_page_unmap>
+  803529:	83 c4 10             	add    $0x10,%esp
+  80352c:	89 d8                	mov    %ebx,%eax
+  80352e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803531:	5b                   	pop    %ebx
+  803532:	5e                   	pop    %esi
+  803533:	5d                   	pop    %ebp
+  803534:	c3                   	ret
+
+00803535 <pipeisclosed>:
+  803535:	55                   	push   %ebp
+  803536:	89 e5                	mov    %esp,%ebp
+  803538:	83 ec 20             	sub    $0x20,%esp
+  80353b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80353e:	50                   	push   %eax
+  80353f:	ff 75 08             	push   0x8(%ebp)
+  803542:	e8 cd ec ff ff       	call   802214 <fd_lookup>
+  803547:	83 c4 10             	add    $0x10,%esp
+  80354a:	85 c0                	test   %eax,%eax
+  80354c:	78 18                	js     803566 <pipeisclosed+0x31>
+  80354e:	83 ec 0c             	sub    $0xc,%esp
+  803551:	ff 75 f4             	push   -0xc(%ebp)
+  803554:	e8 54 ec ff ff       	call   8021ad <fd2data>
+  803559:	89 c2                	mov    %eax,%edx
+  80355b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80355e:	e8 16 fd ff ff       	call   803279 <_pipeisclosed>
+  803563:	83 c4 10             	add    $0x10,%esp
+  803566:	c9                   	leave
+  803567:	c3                   	ret
+
+00803568 <ipcring_init>:
+  803568:	55                   	push   %ebp
+  803569:	89 e5                	mov    %esp,%ebp
+  80356b:	53                   	push   %ebx
+  80356c:	83 ec 08             	sub    $0x8,%esp
+  80356f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803572:	6a 60                	push   $0x60
+  803574:	6a 00                	push   $0x0
+  803576:	53                   	push   %ebx
+  803577:	e8 30 d9 ff ff       	call   800eac <memset>
+  80357c:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  803581:	8b 40 48             	mov    0x48(%eax),%eax
+  803584:	89 03                	mov    %eax,(%ebx)
+  803586:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803589:	89 43 04             	mov    %eax,0x4(%ebx)
+  80358c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80358f:	89 43 08             	mov    %eax,0x8(%ebx)
+  803592:	8b 45 14             	mov    0x14(%ebp),%eax
+  803595:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803598:	83 c4 10             	add    $0x10,%esp
+  80359b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80359e:	c9                   	leave
+  80359f:	c3                   	ret
+
+008035a0 <ipcring_req_slot>:
+  8035a0:	55                   	push   %ebp
+  8035a1:	89 e5                	mov    %esp,%ebp
+  8035a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035a6:	8b 50 10             	mov    0x10(%eax),%edx
+  8035a9:	8b 48 18             	mov    0x18(%eax),%ecx
+  8035ac:	29 ca                	sub    %ecx,%edx
+  8035ae:	83 fa 07             	cmp    $0x7,%edx
+  8035b1:	77 0c                	ja     8035bf <ipcring_req_slot+0x1f>
+  8035b3:	8b 50 10             	mov    0x10(%eax),%edx
+  8035b6:	83 e2 07             	and    $0x7,%edx
+  8035b9:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  8035bd:	5d                   	pop    %ebp
+  8035be:	c3                   	ret
+  8035bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c4:	eb f7                	jmp    8035bd <ipcring_req_slot+0x1d>
+
+008035c6 <ipcring_req_push>:
+  8035c6:	55                   	push   %ebp
+  8035c7:	89 e5                	mov    %esp,%ebp
+  8035c9:	83 ec 08             	sub    $0x8,%esp
+  8035cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8035cf:	8b 42 10             	mov    0x10(%edx),%eax
+  8035d2:	83 c0 01             	add    $0x1,%eax
+  8035d5:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8035d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035de:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8035e2:	85 c0                	test   %eax,%eax
+  8035e4:	75 02                	jne    8035e8 <ipcring_req_push+0x22>
+  8035e6:	c9                   	leave
+  8035e7:	c3                   	ret
+  8035e8:	6a 00                	push   $0x0
+  8035ea:	68 00 00 80 ee       	push   $0xee800000
+  8035ef:	ff 72 08             	push   0x8(%edx)
+  8035f2:	ff 72 04             	push   0x4(%edx)
+  8035f5:	e8 cf de ff ff       	call   8014c9 <sys_ipc_send>
+  8035fa:	83 c4 10             	add    $0x10,%esp
+  8035fd:	eb e7                	jmp    8035e6 <ipcring_req_push+0x20>
+
+008035ff <ipcring_rsp_wait>:
+  8035ff:	55                   	push   %ebp
+  803600:	89 e5                	mov    %esp,%ebp
+  803602:	53                   	push   %ebx
+  803603:	83 ec 04             	sub    $0x4,%esp
+  803606:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803609:	8b 53 18             	mov    0x18(%ebx),%edx
+  80360c:	8b 43 10             	mov    0x10(%ebx),%eax
+  80360f:	39 c2                	cmp    %eax,%edx
+  803611:	74 3c                	je     80364f <ipcring_rsp_wait+0x50>
+  803613:	8b 53 14             	mov    0x14(%ebx),%edx
+  803616:	8b 43 18             	mov    0x18(%ebx),%eax
+  803619:	39 c2                	cmp    %eax,%edx
+  80361b:	75 23                	jne    803640 <ipcring_rsp_wait+0x41>
+  80361d:	83 ec 08             	sub    $0x8,%esp
+  803620:	6a 00                	push   $0x0
+  803622:	6a 00                	push   $0x0
+  803624:	6a 00                	push   $0x0
+  803626:	6a 00                	push   $0x0
+  803628:	ff 73 0c             	push   0xc(%ebx)
+  80362b:	ff 73 04             	push   0x4(%ebx)
+  80362e:	e8 b5 e9 ff ff       	call   801fe8 <ipc_call>
+  803633:	8b 53 14             	mov    0x14(%ebx),%edx
+  803636:	8b 43 18             	mov    0x18(%ebx),%eax
+  803639:	83 c4 20             	add    $0x20,%esp
+  80363c:	39 c2                	cmp    %eax,%edx
+  80363e:	74 dd                	je     80361d <ipcring_rsp_wait+0x1e>
+  803640:	8b 43 18             	mov    0x18(%ebx),%eax
+  803643:	83 e0 07             	and    $0x7,%eax
+  803646:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  80364a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80364d:	c9                   	leave
+  80364e:	c3                   	ret
+  80364f:	68 0c 46 80 00       	push   $0x80460c
+  803654:	68 bd 45 80 00       	push   $0x8045bd
+  803659:	6a 3b                	push   $0x3b
+  80365b:	68 2d 46 80 00       	push   $0x80462d
+  803660:	e8 fa ce ff ff       	call   80055f <_panic>
+
+00803665 <ipcring_rsp_pop>:
+  803665:	55                   	push   %ebp
+  803666:	89 e5                	mov    %esp,%ebp
+  803668:	8b 55 08             	mov    0x8(%ebp),%edx
+  80366b:	8b 42 18             	mov    0x18(%edx),%eax
+  80366e:	83 c0 01             	add    $0x1,%eax
+  803671:	89 42 18             	mov    %eax,0x18(%edx)
+  803674:	5d                   	pop    %ebp
+  803675:	c3                   	ret
+
+00803676 <ipcring_server_init>:
+  803676:	55                   	push   %ebp
+  803677:	89 e5                	mov    %esp,%ebp
+  803679:	8b 45 08             	mov    0x8(%ebp),%eax
+  80367c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80367f:	89 10                	mov    %edx,(%eax)
+  803681:	8b 55 10             	mov    0x10(%ebp),%edx
+  803684:	89 50 04             	mov    %edx,0x4(%eax)
+  803687:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80368e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803695:	5d                   	pop    %ebp
+  803696:	c3                   	ret
+
+00803697 <ipcring_req_avail>:
+  803697:	55                   	push   %ebp
+  803698:	89 e5                	mov    %esp,%ebp
+  80369a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80369d:	8b 02                	mov    (%edx),%eax
+  80369f:	8b 40 10             	mov    0x10(%eax),%eax
+  8036a2:	2b 42 08             	sub    0x8(%edx),%eax
+  8036a5:	ba 08 00 00 00       	mov    $0x8,%edx
+  8036aa:	39 d0                	cmp    %edx,%eax
+  8036ac:	0f 47 c2             	cmova  %edx,%eax
+  8036af:	5d                   	pop    %ebp
+  8036b0:	c3                   	ret
+
+008036b1 <ipcring_req_peek>:
+  8036b1:	55                   	push   %ebp
+  8036b2:	89 e5                	mov    %esp,%ebp
+  8036b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8036b7:	8b 42 08             	mov    0x8(%edx),%eax
+  8036ba:	83 e0 07             	and    $0x7,%eax
+  8036bd:	8b 12                	mov    (%edx),%edx
+  8036bf:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8036c3:	5d                   	pop    %ebp
+  8036c4:	c3                   	ret
+
+008036c5 <ipcring_rsp_push>:
+  8036c5:	55                   	push   %ebp
+  8036c6:	89 e5                	mov    %esp,%ebp
+  8036c8:	83 ec 08             	sub    $0x8,%esp
+  8036cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8036ce:	8b 41 08             	mov    0x8(%ecx),%eax
+  8036d1:	83 c0 01             	add    $0x1,%eax
+  8036d4:	89 41 08             	mov    %eax,0x8(%ecx)
+  8036d7:	8b 11                	mov    (%ecx),%edx
+  8036d9:	83 c2 14             	add    $0x14,%edx
+  8036dc:	f0 87 02             	lock xchg %eax,(%edx)
+  8036df:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8036e3:	75 02                	jne    8036e7 <ipcring_rsp_push+0x22>
+  8036e5:	c9                   	leave
+  8036e6:	c3                   	ret
+  8036e7:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8036ee:	6a 00                	push   $0x0
+  8036f0:	68 00 00 80 ee       	push   $0xee800000
+  8036f5:	6a 00                	push   $0x0
+  8036f7:	ff 71 04             	push   0x4(%ecx)
+  8036fa:	e8 ed dc ff ff       	call   8013ec <sys_ipc_try_send>
+  8036ff:	83 c4 10             	add    $0x10,%esp
+  803702:	eb e1                	jmp    8036e5 <ipcring_rsp_push+0x20>
+
+00803704 <ipcring_client_wait>:
+  803704:	55                   	push   %ebp
+  803705:	89 e5                	mov    %esp,%ebp
+  803707:	83 ec 08             	sub    $0x8,%esp
+  80370a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80370d:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803714:	8b 10                	mov    (%eax),%edx
+  803716:	8b 52 18             	mov    0x18(%edx),%edx
+  803719:	3b 50 08             	cmp    0x8(%eax),%edx
+  80371c:	75 02                	jne    803720 <ipcring_client_wait+0x1c>
+  80371e:	c9                   	leave
+  80371f:	c3                   	ret
+  803720:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803727:	6a 00                	push   $0x0
+  803729:	68 00 00 80 ee       	push   $0xee800000
+  80372e:	6a 00                	push   $0x0
+  803730:	ff 70 04             	push   0x4(%eax)
+  803733:	e8 b4 dc ff ff       	call   8013ec <sys_ipc_try_send>
+  803738:	83 c4 10             	add    $0x10,%esp
+  80373b:	eb e1                	jmp    80371e <ipcring_client_wait+0x1a>
+
+0080373d <ipcring_server_sleep>:
+  80373d:	55                   	push   %ebp
+  80373e:	89 e5                	mov    %esp,%ebp
+  803740:	53                   	push   %ebx
+  803741:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803744:	8b 01                	mov    (%ecx),%eax
+  803746:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803749:	b8 01 00 00 00       	mov    $0x1,%eax
+  80374e:	f0 87 02             	lock xchg %eax,(%edx)
+  803751:	8b 11                	mov    (%ecx),%edx
+  803753:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803756:	b8 01 00 00 00       	mov    $0x1,%eax
+  80375b:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80375e:	74 0e                	je     80376e <ipcring_server_sleep+0x31>
+  803760:	b8 00 00 00 00       	mov    $0x0,%eax
+  803765:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803771:	c9                   	leave
+  803772:	c3                   	ret
+
+00803773 <devcons_close>:
+  803773:	b8 00 00 00 00       	mov    $0x0,%eax
+  803778:	c3                   	ret
+
+00803779 <devcons_stat>:
+  803779:	55                   	push   %ebp
+  80377a:	89 e5                	mov    %esp,%ebp
+  80377c:	83 ec 10             	sub    $0x10,%esp
+  80377f:	68 3b 46 80 00       	push   $0x80463b
+  803784:	ff 75 0c             	push   0xc(%ebp)
+  803787:	e8 a5 d5 ff ff       	call   800d31 <strcpy>
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803791:	c9                   	leave
+  803792:	c3                   	ret
+
+00803793 <devcons_write>:
+  803793:	55                   	push   %ebp
+  803794:	89 e5                	mov    %esp,%ebp
+  803796:	57                   	push   %edi
+  803797:	56                   	push   %esi
+  803798:	53                   	push   %ebx
+  803799:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80379f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8037a2:	85 ff                	test   %edi,%edi
+  8037a4:	74 51                	je     8037f7 <devcons_write+0x64>
+  8037a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b0:	89 fb                	mov    %edi,%ebx
+  8037b2:	29 c3                	sub    %eax,%ebx
+  8037b4:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8037b9:	39 d3                	cmp    %edx,%ebx
+  8037bb:	0f 47 da             	cmova  %edx,%ebx
+  8037be:	83 ec 04             	sub    $0x4,%esp
+  8037c1:	53                   	push   %ebx
+  8037c2:	03 45 0c             	add    0xc(%ebp),%eax
+  8037c5:	50                   	push   %eax
+  8037c6:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8037cc:	50                   	push   %eax
+  8037cd:	e8 0f d7 ff ff       	call   800ee1 <memmove>
+  8037d2:	83 c4 08             	add    $0x8,%esp
+  8037d5:	53                   	push   %ebx
+  8037d6:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8037dc:	50                   	push   %eax
+  8037dd:	e8 c7 d8 ff ff       	call   8010a9 <sys_cputs>
+  8037e2:	01 de                	add    %ebx,%esi
+  8037e4:	89 f0                	mov    %esi,%eax
+  8037e6:	83 c4 10             	add    $0x10,%esp
+  8037e9:	39 fe                	cmp    %edi,%esi
+  8037eb:	72 c3                	jb     8037b0 <devcons_write+0x1d>
+  8037ed:	89 f0                	mov    %esi,%eax
+  8037ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037f2:	5b                   	pop    %ebx
+  8037f3:	5e                   	pop    %esi
+  8037f4:	5f                   	pop    %edi
+  8037f5:	5d                   	pop    %ebp
+  8037f6:	c3                   	ret
+  8037f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8037fc:	eb ef                	jmp    8037ed <devcons_write+0x5a>
+
+008037fe <devcons_read>:
+  8037fe:	55                   	push   %ebp
+  8037ff:	89 e5                	mov    %esp,%ebp
+  803801:	83 ec 08             	sub    $0x8,%esp
+  803804:	b8 00 00 00 00       	mov    $0x0,%eax
+  803809:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80380d:	75 07                	jne    803816 <devcons_read+0x18>
+  80380f:	eb 1f                	jmp    803830 <devcons_read+0x32>
+  803811:	e8 30 d9 ff ff       	call   801146 <sys_yield>
+  803816:	e8 ac d8 ff ff       	call   8010c7 <sys_cgetc>
+  80381b:	85 c0                	test   %eax,%eax
+  80381d:	74 f2                	je     803811 <devcons_read+0x13>
+  80381f:	78 0f                	js     803830 <devcons_read+0x32>
+  803821:	83 f8 04             	cmp    $0x4,%eax
+  803824:	74 0c                	je     803832 <devcons_read+0x34>
+  803826:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803829:	88 02                	mov    %al,(%edx)
+  80382b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803830:	c9                   	leave
+  803831:	c3                   	ret
+  803832:	b8 00 00 00 00       	mov    $0x0,%eax
+  803837:	eb f7                	jmp    803830 <devcons_read+0x32>
+
+00803839 <cputchar>:
+  803839:	55                   	push   %ebp
+  80383a:	89 e5                	mov    %esp,%ebp
+  80383c:	83 ec 20             	sub    $0x20,%esp
+  80383f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803842:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803845:	6a 01                	push   $0x1
+  803847:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80384a:	50                   	push   %eax
+  80384b:	e8 59 d8 ff ff       	call   8010a9 <sys_cputs>
+  803850:	83 c4 10             	add    $0x10,%esp
+  803853:	c9                   	leave
+  803854:	c3                   	ret
+
+00803855 <getchar>:
+  803855:	55                   	push   %ebp
+  803856:	89 e5                	mov    %esp,%ebp
+  803858:	83 ec 1c             	sub    $0x1c,%esp
+  80385b:	6a 01                	push   $0x1
+  80385d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803860:	50                   	push   %eax
+  803861:	6a 00                	push   $0x0
+  803863:	e8 0e ec ff ff       	call   802476 <read>
+  803868:	83 c4 10             	add    $0x10,%esp
+  80386b:	85 c0                	test   %eax,%eax
+  80386d:	78 06                	js     803875 <getchar+0x20>
+  80386f:	74 06                	je     803877 <getchar+0x22>
+  803871:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803875:	c9                   	leave
+  803876:	c3                   	ret
+  803877:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80387c:	eb f7                	jmp    803875 <getchar+0x20>
+
+0080387e <iscons>:
+  80387e:	55                   	push   %ebp
+  80387f:	89 e5                	mov    %esp,%ebp
+  803881:	83 ec 20             	sub    $0x20,%esp
+  803884:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803887:	50                   	push   %eax
+  803888:	ff 75 08             	push   0x8(%ebp)
+  80388b:	e8 84 e9 ff ff       	call   802214 <fd_lookup>
+  803890:	83 c4 10             	add    $0x10,%esp
+  803893:	85 c0                	test   %eax,%eax
+  803895:	78 11                	js     8038a8 <iscons+0x2a>
+  803897:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80389a:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  8038a0:	39 10                	cmp    %edx,(%eax)
+  8038a2:	0f 94 c0             	sete   %al
+  8038a5:	0f b6 c0             	movzbl %al,%eax
+  8038a8:	c9                   	leave
+  8038a9:	c3                   	ret
+
+008038aa <opencons>:
+  8038aa:	55                   	push   %ebp
+  8038ab:	89 e5                	mov    %esp,%ebp
+  8038ad:	83 ec 24             	sub    $0x24,%esp
+  8038b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038b3:	50                   	push   %eax
+  8038b4:	e8 0b e9 ff ff       	call   8021c4 <fd_alloc>
+  8038b9:	83 c4 10             	add    $0x10,%esp
+  8038bc:	85 c0                	test   %eax,%eax
+  8038be:	78 3a                	js     8038fa <opencons+0x50>
+  8038c0:	83 ec 04             	sub    $0x4,%esp
+  8038c3:	68 07 04 00 00       	push   $0x407
+  8038c8:	ff 75 f4             	push   -0xc(%ebp)
+  8038cb:	6a 00                	push   $0x0
+  8038cd:	e8 bf d8 ff ff       	call   801191 <sys_page_alloc>
+  8038d2:	83 c4 10             	add    $0x10,%esp
+  8038d5:	85 c0                	test   %eax,%eax
+  8038d7:	78 21                	js     8038fa <opencons+0x50>
+  8038d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038dc:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  8038e2:	89 10                	mov    %edx,(%eax)
+  8038e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038e7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8038ee:	83 ec 0c             	sub    $0xc,%esp
+  8038f1:	50                   	push   %eax
+  8038f2:	e8 a6 e8 ff ff       	call   80219d <fd2num>
+  8038f7:	83 c4 10             	add    $0x10,%esp
+  8038fa:	c9                   	leave
+  8038fb:	c3                   	ret
+
+008038fc <set_pgfault_handler>:
+  8038fc:	55                   	push   %ebp
+  8038fd:	89 e5                	mov    %esp,%ebp
+  8038ff:	53                   	push   %ebx
+  803900:	83 ec 04             	sub    $0x4,%esp
+  803903:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80390a:	74 0d                	je     803919 <set_pgfault_handler+0x1d>
+  80390c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80390f:	a3 00 90 80 00       	mov    %eax,0x809000
+  803914:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803917:	c9                   	leave
+  803918:	c3                   	ret
+  803919:	e8 09 d8 ff ff       	call   801127 <sys_getenvid>
+  80391e:	89 c3                	mov    %eax,%ebx
+  803920:	83 ec 04             	sub    $0x4,%esp
+  803923:	6a 07                	push   $0x7
+  803925:	68 00 f0 7f ee       	push   $0xee7ff000
+  80392a:	50                   	push   %eax
+  80392b:	e8 61 d8 ff ff       	call   801191 <sys_page_alloc>
+  803930:	83 c4 10             	add    $0x10,%esp
+  803933:	85 c0                	test   %eax,%eax
+  803935:	78 29                	js     803960 <set_pgfault_handler+0x64>
+  803937:	83 ec 08             	sub    $0x8,%esp
+  80393a:	68 74 39 80 00       	push   $0x803974
+  80393f:	53                   	push   %ebx
+  803940:	e8 65 da ff ff       	call   8013aa <sys_env_set_pgfault_upcall>
+  803945:	83 c4 10             	add    $0x10,%esp
+  803948:	85 c0                	test   %eax,%eax
+  80394a:	79 c0                	jns    80390c <set_pgfault_handler+0x10>
+  80394c:	83 ec 04             	sub    $0x4,%esp
+  80394f:	68 80 46 80 00       	push   $0x804680
+  803954:	6a 27                	push   $0x27
+  803956:	68 b2 46 80 00       	push   $0x8046b2
+  80395b:	e8 ff cb ff ff       	call   80055f <_panic>
+  803960:	83 ec 04             	sub    $0x4,%esp
+  803963:	68 48 46 80 00       	push   $0x804648
+  803968:	6a 23                	push   $0x23
+  80396a:	68 b2 46 80 00       	push   $0x8046b2
+  80396f:	e8 eb cb ff ff       	call   80055f <_panic>
+
+00803974 <_pgfault_upcall>:
+  803974:	54                   	push   %esp
+  803975:	a1 00 90 80 00       	mov    0x809000,%eax
+  80397a:	ff d0                	call   *%eax
+  80397c:	83 c4 04             	add    $0x4,%esp
+  80397f:	89 e3                	mov    %esp,%ebx
+  803981:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803985:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803989:	89 d4                	mov    %edx,%esp
+  80398b:	51                   	push   %ecx
+  80398c:	89 dc                	mov    %ebx,%esp
+  80398e:	83 ea 04             	sub    $0x4,%edx
+  803991:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803995:	83 c4 08             	add    $0x8,%esp
+  803998:	61                   	popa
+  803999:	83 c4 04             	add    $0x4,%esp
+  80399c:	9d                   	popf
+  80399d:	5c                   	pop    %esp
+  80399e:	c3                   	ret
+
+0080399f <pageref>:
+  80399f:	55                   	push   %ebp
+  8039a0:	89 e5                	mov    %esp,%ebp
+  8039a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039a5:	89 c2                	mov    %eax,%edx
+  8039a7:	c1 ea 16             	shr    $0x16,%edx
+  8039aa:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8039b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039b6:	f6 c1 01             	test   $0x1,%cl
+  8039b9:	74 22                	je     8039dd <pageref+0x3e>
+  8039bb:	c1 e8 0c             	shr    $0xc,%eax
+  8039be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039c5:	a8 01                	test   $0x1,%al
+  8039c7:	74 14                	je     8039dd <pageref+0x3e>
+  8039c9:	c1 e8 0c             	shr    $0xc,%eax
+  8039cc:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8039cf:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8039d6:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8039da:	0f b7 d2             	movzwl %dx,%edx
+  8039dd:	89 d0                	mov    %edx,%eax
+  8039df:	5d                   	pop    %ebp
+  8039e0:	c3                   	ret
+
+008039e1 <inet_ntoa>:
+  8039e1:	55                   	push   %ebp
+  8039e2:	89 e5                	mov    %esp,%ebp
+  8039e4:	57                   	push   %edi
+  8039e5:	56                   	push   %esi
+  8039e6:	53                   	push   %ebx
+  8039e7:	83 ec 1c             	sub    $0x1c,%esp
+  8039ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  8039f0:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  8039f3:	bf 1c 60 80 00       	mov    $0x80601c,%edi
+  8039f8:	0f b6 16             	movzbl (%esi),%edx
+  8039fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a00:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803a03:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  803a06:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803a0b:	f6 e2                	mul    %dl
+  803a0d:	66 c1 e8 0b          	shr    $0xb,%ax
+  803a11:	89 c7                	mov    %eax,%edi
+  803a13:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803a16:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803a19:	01 db                	add    %ebx,%ebx
+  803a1b:	89 d0                	mov    %edx,%eax
+  803a1d:	29 d8                	sub    %ebx,%eax
+  803a1f:	89 d6                	mov    %edx,%esi
+  803a21:	89 fa                	mov    %edi,%edx
+  803a23:	89 cb                	mov    %ecx,%ebx
+  803a25:	83 c1 01             	add    $0x1,%ecx
+  803a28:	0f b6 fb             	movzbl %bl,%edi
+  803a2b:	83 c0 30             	add    $0x30,%eax
+  803a2e:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+  803a32:	89 f0                	mov    %esi,%eax
+  803a34:	3c 09                	cmp    $0x9,%al
+  803a36:	77 ce                	ja     803a06 <inet_ntoa+0x25>
+  803a38:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803a3b:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803a3e:	88 16                	mov    %dl,(%esi)
+  803a40:	84 c9                	test   %cl,%cl
+  803a42:	74 4d                	je     803a91 <inet_ntoa+0xb0>
+  803a44:	0f b6 db             	movzbl %bl,%ebx
+  803a47:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803a4a:	01 d8                	add    %ebx,%eax
+  803a4c:	89 f9                	mov    %edi,%ecx
+  803a4e:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803a51:	83 c1 01             	add    $0x1,%ecx
+  803a54:	0f b6 10             	movzbl (%eax),%edx
+  803a57:	88 51 ff             	mov    %dl,-0x1(%ecx)
+  803a5a:	89 c2                	mov    %eax,%edx
+  803a5c:	83 e8 01             	sub    $0x1,%eax
+  803a5f:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803a62:	39 da                	cmp    %ebx,%edx
+  803a64:	75 eb                	jne    803a51 <inet_ntoa+0x70>
+  803a66:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803a69:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  803a6d:	8d 78 01             	lea    0x1(%eax),%edi
+  803a70:	c6 00 2e             	movb   $0x2e,(%eax)
+  803a73:	83 c6 01             	add    $0x1,%esi
+  803a76:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803a79:	39 ce                	cmp    %ecx,%esi
+  803a7b:	0f 85 77 ff ff ff    	jne    8039f8 <inet_ntoa+0x17>
+  803a81:	c6 00 00             	movb   $0x0,(%eax)
+  803a84:	b8 1c 60 80 00       	mov    $0x80601c,%eax
+  803a89:	83 c4 1c             	add    $0x1c,%esp
+  803a8c:	5b                   	pop    %ebx
+  803a8d:	5e                   	pop    %esi
+  803a8e:	5f                   	pop    %edi
+  803a8f:	5d                   	pop    %ebp
+  803a90:	c3                   	ret
+  803a91:	89 f8                	mov    %edi,%eax
+  803a93:	eb d8                	jmp    803a6d <inet_ntoa+0x8c>
+
+00803a95 <htons>:
+  803a95:	55                   	push   %ebp
+  803a96:	89 e5                	mov    %esp,%ebp
+  803a98:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803a9c:	66 c1 c0 08          	rol    $0x8,%ax
+  803aa0:	5d                   	pop    %ebp
+  803aa1:	c3                   	ret
+
+00803aa2 <ntohs>:
+  803aa2:	55                   	push   %ebp
+  803aa3:	89 e5                	mov    %esp,%ebp
+  803aa5:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803aa9:	66 c1 c0 08          	rol    $0x8,%ax
+  803aad:	5d                   	pop    %ebp
+  803aae:	c3                   	ret
+
+00803aaf <htonl>:
+  803aaf:	55                   	push   %ebp
+  803ab0:	89 e5                	mov    %esp,%ebp
+  803ab2:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ab5:	89 d0                	mov    %edx,%eax
+  803ab7:	c1 e0 18             	shl    $0x18,%eax
+  803aba:	89 d1                	mov    %edx,%ecx
+  803abc:	c1 e9 18             	shr    $0x18,%ecx
+  803abf:	09 c8                	or     %ecx,%eax
+  803ac1:	89 d1                	mov    %edx,%ecx
+  803ac3:	c1 e1 08             	shl    $0x8,%ecx
+  803ac6:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+  803acc:	09 c8                	or     %ecx,%eax
+  803ace:	c1 ea 08             	shr    $0x8,%edx
+  803ad1:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803ad7:	09 d0                	or     %edx,%eax
+  803ad9:	5d                   	pop    %ebp
+  803ada:	c3                   	ret
+
+00803adb <inet_aton>:
+  803adb:	55                   	push   %ebp
+  803adc:	89 e5                	mov    %esp,%ebp
+  803ade:	57                   	push   %edi
+  803adf:	56                   	push   %esi
+  803ae0:	53                   	push   %ebx
+  803ae1:	83 ec 2c             	sub    $0x2c,%esp
+  803ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  803ae7:	0f b6 0a             	movzbl (%edx),%ecx
+  803aea:	0f be c1             	movsbl %cl,%eax
+  803aed:	83 e9 30             	sub    $0x30,%ecx
+  803af0:	80 f9 09             	cmp    $0x9,%cl
+  803af3:	0f 87 b6 01 00 00    	ja     803caf <inet_aton+0x1d4>
+  803af9:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  803afc:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803aff:	e9 aa 00 00 00       	jmp    803bae <inet_aton+0xd3>
+  803b04:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  803b08:	89 c1                	mov    %eax,%ecx
+  803b0a:	83 e1 df             	and    $0xffffffdf,%ecx
+  803b0d:	80 f9 58             	cmp    $0x58,%cl
+  803b10:	74 10                	je     803b22 <inet_aton+0x47>
+  803b12:	83 c2 01             	add    $0x1,%edx
+  803b15:	0f be c0             	movsbl %al,%eax
+  803b18:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b1d:	e9 9a 00 00 00       	jmp    803bbc <inet_aton+0xe1>
+  803b22:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803b26:	8d 52 02             	lea    0x2(%edx),%edx
+  803b29:	bf 10 00 00 00       	mov    $0x10,%edi
+  803b2e:	e9 89 00 00 00       	jmp    803bbc <inet_aton+0xe1>
+  803b33:	0f af d7             	imul   %edi,%edx
+  803b36:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  803b3a:	0f be 01             	movsbl (%ecx),%eax
+  803b3d:	83 c1 01             	add    $0x1,%ecx
+  803b40:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803b43:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803b46:	80 fb 09             	cmp    $0x9,%bl
+  803b49:	76 e8                	jbe    803b33 <inet_aton+0x58>
+  803b4b:	83 ff 10             	cmp    $0x10,%edi
+  803b4e:	75 2e                	jne    803b7e <inet_aton+0xa3>
+  803b50:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803b54:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803b57:	83 e3 df             	and    $0xffffffdf,%ebx
+  803b5a:	83 eb 41             	sub    $0x41,%ebx
+  803b5d:	80 fb 05             	cmp    $0x5,%bl
+  803b60:	77 1c                	ja     803b7e <inet_aton+0xa3>
+  803b62:	c1 e2 04             	shl    $0x4,%edx
+  803b65:	83 c0 0a             	add    $0xa,%eax
+  803b68:	89 f3                	mov    %esi,%ebx
+  803b6a:	80 fb 1a             	cmp    $0x1a,%bl
+  803b6d:	19 db                	sbb    %ebx,%ebx
+  803b6f:	83 e3 20             	and    $0x20,%ebx
+  803b72:	83 c3 41             	add    $0x41,%ebx
+  803b75:	29 d8                	sub    %ebx,%eax
+  803b77:	09 c2                	or     %eax,%edx
+  803b79:	0f be 01             	movsbl (%ecx),%eax
+  803b7c:	eb bf                	jmp    803b3d <inet_aton+0x62>
+  803b7e:	83 f8 2e             	cmp    $0x2e,%eax
+  803b81:	75 46                	jne    803bc9 <inet_aton+0xee>
+  803b83:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803b86:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803b89:	39 f0                	cmp    %esi,%eax
+  803b8b:	0f 84 25 01 00 00    	je     803cb6 <inet_aton+0x1db>
+  803b91:	83 c0 04             	add    $0x4,%eax
+  803b94:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803b97:	89 50 fc             	mov    %edx,-0x4(%eax)
+  803b9a:	89 ca                	mov    %ecx,%edx
+  803b9c:	0f b6 09             	movzbl (%ecx),%ecx
+  803b9f:	0f be c1             	movsbl %cl,%eax
+  803ba2:	83 e9 30             	sub    $0x30,%ecx
+  803ba5:	80 f9 09             	cmp    $0x9,%cl
+  803ba8:	0f 87 17 01 00 00    	ja     803cc5 <inet_aton+0x1ea>
+  803bae:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803bb3:	83 f8 30             	cmp    $0x30,%eax
+  803bb6:	0f 84 48 ff ff ff    	je     803b04 <inet_aton+0x29>
+  803bbc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc4:	e9 77 ff ff ff       	jmp    803b40 <inet_aton+0x65>
+  803bc9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803bcd:	89 d6                	mov    %edx,%esi
+  803bcf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803bd2:	85 c0                	test   %eax,%eax
+  803bd4:	74 2e                	je     803c04 <inet_aton+0x129>
+  803bd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bdb:	89 fa                	mov    %edi,%edx
+  803bdd:	80 fa 1f             	cmp    $0x1f,%dl
+  803be0:	0f 86 d5 00 00 00    	jbe    803cbb <inet_aton+0x1e0>
+  803be6:	84 c0                	test   %al,%al
+  803be8:	0f 88 cd 00 00 00    	js     803cbb <inet_aton+0x1e0>
+  803bee:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803bf1:	83 f9 04             	cmp    $0x4,%ecx
+  803bf4:	76 0e                	jbe    803c04 <inet_aton+0x129>
+  803bf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bfb:	83 f8 20             	cmp    $0x20,%eax
+  803bfe:	0f 85 b7 00 00 00    	jne    803cbb <inet_aton+0x1e0>
+  803c04:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803c07:	89 d8                	mov    %ebx,%eax
+  803c09:	29 c8                	sub    %ecx,%eax
+  803c0b:	c1 f8 02             	sar    $0x2,%eax
+  803c0e:	8d 48 01             	lea    0x1(%eax),%ecx
+  803c11:	83 f8 02             	cmp    $0x2,%eax
+  803c14:	74 7a                	je     803c90 <inet_aton+0x1b5>
+  803c16:	83 f9 03             	cmp    $0x3,%ecx
+  803c19:	7f 49                	jg     803c64 <inet_aton+0x189>
+  803c1b:	85 c9                	test   %ecx,%ecx
+  803c1d:	0f 84 98 00 00 00    	je     803cbb <inet_aton+0x1e0>
+  803c23:	83 f9 02             	cmp    $0x2,%ecx
+  803c26:	75 19                	jne    803c41 <inet_aton+0x166>
+  803c28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c2d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803c33:	0f 87 82 00 00 00    	ja     803cbb <inet_aton+0x1e0>
+  803c39:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803c3c:	c1 e0 18             	shl    $0x18,%eax
+  803c3f:	09 c6                	or     %eax,%esi
+  803c41:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c46:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803c4a:	74 6f                	je     803cbb <inet_aton+0x1e0>
+  803c4c:	83 ec 0c             	sub    $0xc,%esp
+  803c4f:	56                   	push   %esi
+  803c50:	e8 5a fe ff ff       	call   803aaf <htonl>
+  803c55:	83 c4 10             	add    $0x10,%esp
+  803c58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803c5b:	89 06                	mov    %eax,(%esi)
+  803c5d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c62:	eb 57                	jmp    803cbb <inet_aton+0x1e0>
+  803c64:	83 f9 04             	cmp    $0x4,%ecx
+  803c67:	75 d8                	jne    803c41 <inet_aton+0x166>
+  803c69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c6e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803c74:	77 45                	ja     803cbb <inet_aton+0x1e0>
+  803c76:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803c79:	c1 e0 18             	shl    $0x18,%eax
+  803c7c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803c7f:	c1 e1 10             	shl    $0x10,%ecx
+  803c82:	09 c8                	or     %ecx,%eax
+  803c84:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803c87:	c1 e1 08             	shl    $0x8,%ecx
+  803c8a:	09 c8                	or     %ecx,%eax
+  803c8c:	09 c6                	or     %eax,%esi
+  803c8e:	eb b1                	jmp    803c41 <inet_aton+0x166>
+  803c90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c95:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803c9b:	77 1e                	ja     803cbb <inet_aton+0x1e0>
+  803c9d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803ca0:	c1 e0 18             	shl    $0x18,%eax
+  803ca3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803ca6:	c1 e1 10             	shl    $0x10,%ecx
+  803ca9:	09 c8                	or     %ecx,%eax
+  803cab:	09 c6                	or     %eax,%esi
+  803cad:	eb 92                	jmp    803c41 <inet_aton+0x166>
+  803caf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cb4:	eb 05                	jmp    803cbb <inet_aton+0x1e0>
+  803cb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cbb:	89 c8                	mov    %ecx,%eax
+  803cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cc0:	5b                   	pop    %ebx
+  803cc1:	5e                   	pop    %esi
+  803cc2:	5f                   	pop    %edi
+  803cc3:	5d                   	pop    %ebp
+  803cc4:	c3                   	ret
+  803cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cca:	eb ef                	jmp    803cbb <inet_aton+0x1e0>
+
+00803ccc <inet_addr>:
+  803ccc:	55                   	push   %ebp
+  803ccd:	89 e5                	mov    %esp,%ebp
+  803ccf:	83 ec 20             	sub    $0x20,%esp
+  803cd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cd5:	50                   	push   %eax
+  803cd6:	ff 75 08             	push   0x8(%ebp)
+  803cd9:	e8 fd fd ff ff       	call   803adb <inet_aton>
+  803cde:	89 c2                	mov    %eax,%edx
+  803ce0:	83 c4 10             	add    $0x10,%esp
+  803ce3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803ce8:	85 d2                	test   %edx,%edx
+  803cea:	75 02                	jne    803cee <inet_addr+0x22>
+  803cec:	c9                   	leave
+  803ced:	c3                   	ret
+  803cee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cf1:	eb f9                	jmp    803cec <inet_addr+0x20>
+
+00803cf3 <ntohl>:
+  803cf3:	55                   	push   %ebp
+  803cf4:	89 e5                	mov    %esp,%ebp
+  803cf6:	83 ec 14             	sub    $0x14,%esp
+  803cf9:	ff 75 08             	push   0x8(%ebp)
+  803cfc:	e8 ae fd ff ff       	call   803aaf <htonl>
+  803d01:	83 c4 10             	add    $0x10,%esp
+  803d04:	c9                   	leave
+  803d05:	c3                   	ret
+
+00803d06 <__udivmoddi4>:
+  803d06:	55                   	push   %ebp
+  803d07:	57                   	push   %edi
+  803d08:	56                   	push   %esi
+  803d09:	53                   	push   %ebx
+  803d0a:	83 ec 24             	sub    $0x24,%esp
+  803d0d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803d11:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803d15:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803d19:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803d1d:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803d21:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803d25:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803d29:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803d2d:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d36:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d3b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803d40:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803d47:	00 
+  803d48:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803d4f:	00 
+  803d50:	89 fb                	mov    %edi,%ebx
+  803d52:	eb 08                	jmp    803d5c <__udivmoddi4+0x56>
+  803d54:	83 e9 01             	sub    $0x1,%ecx
+  803d57:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803d5a:	74 68                	je     803dc4 <__udivmoddi4+0xbe>
+  803d5c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803d60:	01 c0                	add    %eax,%eax
+  803d62:	89 c6                	mov    %eax,%esi
+  803d64:	89 d7                	mov    %edx,%edi
+  803d66:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803d6a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803d6e:	0f ad d0             	shrd   %cl,%edx,%eax
+  803d71:	d3 ea                	shr    %cl,%edx
+  803d73:	f6 c1 20             	test   $0x20,%cl
+  803d76:	74 04                	je     803d7c <__udivmoddi4+0x76>
+  803d78:	89 d0                	mov    %edx,%eax
+  803d7a:	31 d2                	xor    %edx,%edx
+  803d7c:	83 e0 01             	and    $0x1,%eax
+  803d7f:	89 04 24             	mov    %eax,(%esp)
+  803d82:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803d89:	00 
+  803d8a:	8b 04 24             	mov    (%esp),%eax
+  803d8d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803d91:	09 f0                	or     %esi,%eax
+  803d93:	09 fa                	or     %edi,%edx
+  803d95:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803d99:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803d9d:	39 f0                	cmp    %esi,%eax
+  803d9f:	89 d5                	mov    %edx,%ebp
+  803da1:	19 fd                	sbb    %edi,%ebp
+  803da3:	72 af                	jb     803d54 <__udivmoddi4+0x4e>
+  803da5:	29 f0                	sub    %esi,%eax
+  803da7:	19 fa                	sbb    %edi,%edx
+  803da9:	89 cf                	mov    %ecx,%edi
+  803dab:	c1 ef 05             	shr    $0x5,%edi
+  803dae:	83 e7 01             	and    $0x1,%edi
+  803db1:	89 fe                	mov    %edi,%esi
+  803db3:	83 f6 01             	xor    $0x1,%esi
+  803db6:	d3 e6                	shl    %cl,%esi
+  803db8:	d3 e7                	shl    %cl,%edi
+  803dba:	09 74 24 18          	or     %esi,0x18(%esp)
+  803dbe:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803dc2:	eb 90                	jmp    803d54 <__udivmoddi4+0x4e>
+  803dc4:	85 db                	test   %ebx,%ebx
+  803dc6:	74 05                	je     803dcd <__udivmoddi4+0xc7>
+  803dc8:	89 03                	mov    %eax,(%ebx)
+  803dca:	89 53 04             	mov    %edx,0x4(%ebx)
+  803dcd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803dd1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803dd5:	83 c4 24             	add    $0x24,%esp
+  803dd8:	5b                   	pop    %ebx
+  803dd9:	5e                   	pop    %esi
+  803dda:	5f                   	pop    %edi
+  803ddb:	5d                   	pop    %ebp
+  803ddc:	c3                   	ret
+
+00803ddd <__udivdi3>:
+  803ddd:	83 ec 08             	sub    $0x8,%esp
+  803de0:	6a 00                	push   $0x0
+  803de2:	ff 74 24 1c          	push   0x1c(%esp)
+  803de6:	ff 74 24 1c          	push   0x1c(%esp)
+  803dea:	ff 74 24 1c          	push   0x1c(%esp)
+  803dee:	ff 74 24 1c          	push   0x1c(%esp)
+  803df2:	e8 0f ff ff ff       	call   803d06 <__udivmoddi4>
+  803df7:	83 c4 1c             	add    $0x1c,%esp
+  803dfa:	c3                   	ret
+
+00803dfb <__umoddi3>:
+  803dfb:	83 ec 18             	sub    $0x18,%esp
+  803dfe:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803e02:	50                   	push   %eax
+  803e03:	ff 74 24 2c          	push   0x2c(%esp)
+  803e07:	ff 74 24 2c          	push   0x2c(%esp)
+  803e0b:	ff 74 24 2c          	push   0x2c(%esp)
+  803e0f:	ff 74 24 2c          	push   0x2c(%esp)
+  803e13:	e8 ee fe ff ff       	call   803d06 <__udivmoddi4>
+  803e18:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803e1c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803e20:	83 c4 2c             	add    $0x2c,%esp
+  803e23:	c3                   	ret
+
+00803e24 <__divdi3>:
+  803e24:	53                   	push   %ebx
+  803e25:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803e29:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803e2d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803e31:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803e35:	85 d2                	test   %edx,%edx
+  803e37:	78 12                	js     803e4b <__divdi3+0x27>
+  803e39:	85 db                	test   %ebx,%ebx
+  803e3b:	78 2e                	js     803e6b <__divdi3+0x47>
+  803e3d:	53                   	push   %ebx
+  803e3e:	51                   	push   %ecx
+  803e3f:	52                   	push   %edx
+  803e40:	50                   	push   %eax
+  803e41:	e8 97 ff ff ff       	call   803ddd <__udivdi3>
+  803e46:	83 c4 10             	add    $0x10,%esp
+  803e49:	eb 1e                	jmp    803e69 <__divdi3+0x45>
+  803e4b:	f7 d8                	neg    %eax
+  803e4d:	83 d2 00             	adc    $0x0,%edx
+  803e50:	f7 da                	neg    %edx
+  803e52:	85 db                	test   %ebx,%ebx
+  803e54:	78 2a                	js     803e80 <__divdi3+0x5c>
+  803e56:	53                   	push   %ebx
+  803e57:	51                   	push   %ecx
+  803e58:	52                   	push   %edx
+  803e59:	50                   	push   %eax
+  803e5a:	e8 7e ff ff ff       	call   803ddd <__udivdi3>
+  803e5f:	83 c4 10             	add    $0x10,%esp
+  803e62:	f7 d8                	neg    %eax
+  803e64:	83 d2 00             	adc    $0x0,%edx
+  803e67:	f7 da                	neg    %edx
+  803e69:	5b                   	pop    %ebx
+  803e6a:	c3                   	ret
+  803e6b:	f7 d9                	neg    %ecx
+  803e6d:	83 d3 00             	adc    $0x0,%ebx
+  803e70:	f7 db                	neg    %ebx
+  803e72:	53                   	push   %ebx
+  803e73:	51                   	push   %ecx
+  803e74:	52                   	push   %edx
+  803e75:	50                   	push   %eax
+  803e76:	e8 62 ff ff ff       	call   803ddd <__udivdi3>
+  803e7b:	83 c4 10             	add    $0x10,%esp
+  803e7e:	eb e2                	jmp    803e62 <__divdi3+0x3e>
+  803e80:	f7 d9                	neg    %ecx
+  803e82:	83 d3 00             	adc    $0x0,%ebx
+  803e85:	f7 db                	neg    %ebx
+  803e87:	53                   	push   %ebx
+  803e88:	51                   	push   %ecx
+  803e89:	52                   	push   %edx
+  803e8a:	50                   	push   %eax
+  803e8b:	e8 4d ff ff ff       	call   803ddd <__udivdi3>
+  803e90:	83 c4 10             	add    $0x10,%esp
+  803e93:	eb d4                	jmp    803e69 <__divdi3+0x45>
+
+00803e95 <__moddi3>:
+  803e95:	55                   	push   %ebp
+  803e96:	57                   	push   %edi
+  803e97:	56                   	push   %esi
+  803e98:	53                   	push   %ebx
+  803e99:	83 ec 0c             	sub    $0xc,%esp
+  803e9c:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803ea0:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803ea4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803ea8:	89 e9                	mov    %ebp,%ecx
+  803eaa:	f7 d9                	neg    %ecx
+  803eac:	89 d0                	mov    %edx,%eax
+  803eae:	83 d0 00             	adc    $0x0,%eax
+  803eb1:	f7 d8                	neg    %eax
+  803eb3:	0f 49 e9             	cmovns %ecx,%ebp
+  803eb6:	0f 49 d0             	cmovns %eax,%edx
+  803eb9:	52                   	push   %edx
+  803eba:	55                   	push   %ebp
+  803ebb:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803ebf:	f7 da                	neg    %edx
+  803ec1:	89 d8                	mov    %ebx,%eax
+  803ec3:	83 d0 00             	adc    $0x0,%eax
+  803ec6:	f7 d8                	neg    %eax
+  803ec8:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803ecd:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803ed1:	0f 48 c3             	cmovs  %ebx,%eax
+  803ed4:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803ed8:	ff 74 24 0c          	push   0xc(%esp)
+  803edc:	ff 74 24 0c          	push   0xc(%esp)
+  803ee0:	e8 16 ff ff ff       	call   803dfb <__umoddi3>
+  803ee5:	83 c4 10             	add    $0x10,%esp
+  803ee8:	85 db                	test   %ebx,%ebx
+  803eea:	78 08                	js     803ef4 <__moddi3+0x5f>
+  803eec:	83 c4 0c             	add    $0xc,%esp
+  803eef:	5b                   	pop    %ebx
+  803ef0:	5e                   	pop    %esi
+  803ef1:	5f                   	pop    %edi
+  803ef2:	5d                   	pop    %ebp
+  803ef3:	c3                   	ret
+  803ef4:	f7 d8                	neg    %eax
+  803ef6:	83 d2 00             	adc    $0x0,%edx
+  803ef9:	f7 da                	neg    %edx
+  803efb:	eb ef                	jmp    803eec <__moddi3+0x57>
@@ -0,0 +1,5674 @@
+
+obj/net/testoutput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 2d 02 00 00       	call   80025e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	e8 62 0e 00 00       	call   800e9f <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+  80003f:	c7 05 00 50 80 00 60 	movl   $0x803960,0x805000
+  800046:	39 80 00 
+  800049:	e8 09 19 00 00       	call   801957 <fork>
+  80004e:	a3 00 60 80 00       	mov    %eax,0x806000
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 93 00 00 00    	js     8000ee <umain+0xbb>
+  80005b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800060:	0f 84 9c 00 00 00    	je     800102 <umain+0xcf>
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	6a 07                	push   $0x7
+  80006b:	68 00 b0 fe 0f       	push   $0xffeb000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 92 0e 00 00       	call   800f09 <sys_page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	0f 88 8e 00 00 00    	js     800110 <umain+0xdd>
+  800082:	53                   	push   %ebx
+  800083:	68 9d 39 80 00       	push   $0x80399d
+  800088:	68 fc 0f 00 00       	push   $0xffc
+  80008d:	68 04 b0 fe 0f       	push   $0xffeb004
+  800092:	e8 ac 09 00 00       	call   800a43 <snprintf>
+  800097:	a3 00 b0 fe 0f       	mov    %eax,0xffeb000
+  80009c:	83 c4 08             	add    $0x8,%esp
+  80009f:	53                   	push   %ebx
+  8000a0:	68 a9 39 80 00       	push   $0x8039a9
+  8000a5:	e8 08 03 00 00       	call   8003b2 <cprintf>
+  8000aa:	6a 07                	push   $0x7
+  8000ac:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000b1:	6a 0b                	push   $0xb
+  8000b3:	ff 35 00 60 80 00    	push   0x806000
+  8000b9:	e8 48 1c 00 00       	call   801d06 <ipc_send>
+  8000be:	83 c4 18             	add    $0x18,%esp
+  8000c1:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000c6:	6a 00                	push   $0x0
+  8000c8:	e8 0e 0f 00 00       	call   800fdb <sys_page_unmap>
+  8000cd:	83 c3 01             	add    $0x1,%ebx
+  8000d0:	83 c4 10             	add    $0x10,%esp
+  8000d3:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d6:	75 8e                	jne    800066 <umain+0x33>
+  8000d8:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8000dd:	e8 dc 0d 00 00       	call   800ebe <sys_yield>
+  8000e2:	83 eb 01             	sub    $0x1,%ebx
+  8000e5:	75 f6                	jne    8000dd <umain+0xaa>
+  8000e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000ea:	5b                   	pop    %ebx
+  8000eb:	5e                   	pop    %esi
+  8000ec:	5d                   	pop    %ebp
+  8000ed:	c3                   	ret
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	68 6b 39 80 00       	push   $0x80396b
+  8000f6:	6a 16                	push   $0x16
+  8000f8:	68 79 39 80 00       	push   $0x803979
+  8000fd:	e8 d5 01 00 00       	call   8002d7 <_panic>
+  800102:	83 ec 0c             	sub    $0xc,%esp
+  800105:	56                   	push   %esi
+  800106:	e8 ff 00 00 00       	call   80020a <output>
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	eb d7                	jmp    8000e7 <umain+0xb4>
+  800110:	50                   	push   %eax
+  800111:	68 8a 39 80 00       	push   $0x80398a
+  800116:	6a 1e                	push   $0x1e
+  800118:	68 79 39 80 00       	push   $0x803979
+  80011d:	e8 b5 01 00 00       	call   8002d7 <_panic>
+
+00800122 <timer>:
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	57                   	push   %edi
+  800126:	56                   	push   %esi
+  800127:	53                   	push   %ebx
+  800128:	83 ec 1c             	sub    $0x1c,%esp
+  80012b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80012e:	e8 a0 11 00 00       	call   8012d3 <sys_time_msec>
+  800133:	03 45 0c             	add    0xc(%ebp),%eax
+  800136:	89 c3                	mov    %eax,%ebx
+  800138:	c7 05 00 50 80 00 c1 	movl   $0x8039c1,0x805000
+  80013f:	39 80 00 
+  800142:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800145:	eb 05                	jmp    80014c <timer+0x2a>
+  800147:	e8 72 0d 00 00       	call   800ebe <sys_yield>
+  80014c:	e8 82 11 00 00       	call   8012d3 <sys_time_msec>
+  800151:	39 d8                	cmp    %ebx,%eax
+  800153:	73 16                	jae    80016b <timer+0x49>
+  800155:	85 c0                	test   %eax,%eax
+  800157:	79 ee                	jns    800147 <timer+0x25>
+  800159:	50                   	push   %eax
+  80015a:	68 ca 39 80 00       	push   $0x8039ca
+  80015f:	6a 0f                	push   $0xf
+  800161:	68 dc 39 80 00       	push   $0x8039dc
+  800166:	e8 6c 01 00 00       	call   8002d7 <_panic>
+  80016b:	85 c0                	test   %eax,%eax
+  80016d:	78 ea                	js     800159 <timer+0x37>
+  80016f:	6a 00                	push   $0x0
+  800171:	6a 00                	push   $0x0
+  800173:	6a 0c                	push   $0xc
+  800175:	56                   	push   %esi
+  800176:	e8 8b 1b 00 00       	call   801d06 <ipc_send>
+  80017b:	83 c4 10             	add    $0x10,%esp
+  80017e:	83 ec 04             	sub    $0x4,%esp
+  800181:	6a 00                	push   $0x0
+  800183:	6a 00                	push   $0x0
+  800185:	57                   	push   %edi
+  800186:	e8 1d 1b 00 00       	call   801ca8 <ipc_recv>
+  80018b:	89 c3                	mov    %eax,%ebx
+  80018d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800190:	83 c4 10             	add    $0x10,%esp
+  800193:	39 f0                	cmp    %esi,%eax
+  800195:	75 09                	jne    8001a0 <timer+0x7e>
+  800197:	e8 37 11 00 00       	call   8012d3 <sys_time_msec>
+  80019c:	01 c3                	add    %eax,%ebx
+  80019e:	eb ac                	jmp    80014c <timer+0x2a>
+  8001a0:	83 ec 08             	sub    $0x8,%esp
+  8001a3:	50                   	push   %eax
+  8001a4:	68 e8 39 80 00       	push   $0x8039e8
+  8001a9:	e8 04 02 00 00       	call   8003b2 <cprintf>
+  8001ae:	83 c4 10             	add    $0x10,%esp
+  8001b1:	eb cb                	jmp    80017e <timer+0x5c>
+
+008001b3 <input>:
+  8001b3:	55                   	push   %ebp
+  8001b4:	89 e5                	mov    %esp,%ebp
+  8001b6:	53                   	push   %ebx
+  8001b7:	83 ec 04             	sub    $0x4,%esp
+  8001ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001bd:	c7 05 00 50 80 00 23 	movl   $0x803a23,0x805000
+  8001c4:	3a 80 00 
+  8001c7:	eb 05                	jmp    8001ce <input+0x1b>
+  8001c9:	e8 f0 0c 00 00       	call   800ebe <sys_yield>
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	68 00 80 80 00       	push   $0x808000
+  8001d6:	e8 06 12 00 00       	call   8013e1 <sys_net_recv_page>
+  8001db:	83 c4 10             	add    $0x10,%esp
+  8001de:	85 c0                	test   %eax,%eax
+  8001e0:	79 10                	jns    8001f2 <input+0x3f>
+  8001e2:	83 f8 ef             	cmp    $0xffffffef,%eax
+  8001e5:	75 e2                	jne    8001c9 <input+0x16>
+  8001e7:	e8 15 12 00 00       	call   801401 <sys_net_wait>
+  8001ec:	85 c0                	test   %eax,%eax
+  8001ee:	79 de                	jns    8001ce <input+0x1b>
+  8001f0:	eb d7                	jmp    8001c9 <input+0x16>
+  8001f2:	6a 07                	push   $0x7
+  8001f4:	68 00 80 80 00       	push   $0x808000
+  8001f9:	6a 0a                	push   $0xa
+  8001fb:	53                   	push   %ebx
+  8001fc:	e8 63 0f 00 00       	call   801164 <sys_ipc_try_send>
+  800201:	83 c4 10             	add    $0x10,%esp
+  800204:	85 c0                	test   %eax,%eax
+  800206:	78 ea                	js     8001f2 <input+0x3f>
+  800208:	eb c4                	jmp    8001ce <input+0x1b>
+
+0080020a <output>:
+  80020a:	55                   	push   %ebp
+  80020b:	89 e5                	mov    %esp,%ebp
+  80020d:	53                   	push   %ebx
+  80020e:	83 ec 04             	sub    $0x4,%esp
+  800211:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800214:	c7 05 00 50 80 00 2c 	movl   $0x803a2c,0x805000
+  80021b:	3a 80 00 
+  80021e:	83 ec 0c             	sub    $0xc,%esp
+  800221:	68 00 80 80 00       	push   $0x808000
+  800226:	e8 89 0f 00 00       	call   8011b4 <sys_ipc_recv>
+  80022b:	a1 18 60 80 00       	mov    0x806018,%eax
+  800230:	8b 50 74             	mov    0x74(%eax),%edx
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	39 da                	cmp    %ebx,%edx
+  800238:	75 e4                	jne    80021e <output+0x14>
+  80023a:	8b 40 70             	mov    0x70(%eax),%eax
+  80023d:	83 f8 0b             	cmp    $0xb,%eax
+  800240:	75 dc                	jne    80021e <output+0x14>
+  800242:	83 ec 08             	sub    $0x8,%esp
+  800245:	ff 35 00 80 80 00    	push   0x808000
+  80024b:	68 04 80 80 00       	push   $0x808004
+  800250:	e8 08 11 00 00       	call   80135d <sys_net_try_send>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	85 c0                	test   %eax,%eax
+  80025a:	75 e6                	jne    800242 <output+0x38>
+  80025c:	eb c0                	jmp    80021e <output+0x14>
+
+0080025e <libmain>:
+  80025e:	55                   	push   %ebp
+  80025f:	89 e5                	mov    %esp,%ebp
+  800261:	56                   	push   %esi
+  800262:	53                   	push   %ebx
+  800263:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800266:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800269:	e8 31 0c 00 00       	call   800e9f <sys_getenvid>
+  80026e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800273:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800279:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80027e:	a3 18 60 80 00       	mov    %eax,0x806018
+  800283:	85 db                	test   %ebx,%ebx
+  800285:	7e 07                	jle    80028e <libmain+0x30>
+  800287:	8b 06                	mov    (%esi),%eax
+  800289:	a3 00 50 80 00       	mov    %eax,0x805000
+  80028e:	83 ec 08             	sub    $0x8,%esp
+  800291:	56                   	push   %esi
+  800292:	53                   	push   %ebx
+  800293:	e8 9b fd ff ff       	call   800033 <umain>
+  800298:	e8 0a 00 00 00       	call   8002a7 <exit>
+  80029d:	83 c4 10             	add    $0x10,%esp
+  8002a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002a3:	5b                   	pop    %ebx
+  8002a4:	5e                   	pop    %esi
+  8002a5:	5d                   	pop    %ebp
+  8002a6:	c3                   	ret
+
+008002a7 <exit>:
+  8002a7:	55                   	push   %ebp
+  8002a8:	89 e5                	mov    %esp,%ebp
+  8002aa:	83 ec 08             	sub    $0x8,%esp
+  8002ad:	a1 18 60 80 00       	mov    0x806018,%eax
+  8002b2:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8002b8:	85 c0                	test   %eax,%eax
+  8002ba:	75 14                	jne    8002d0 <exit+0x29>
+  8002bc:	e8 1e 1e 00 00       	call   8020df <close_all>
+  8002c1:	83 ec 0c             	sub    $0xc,%esp
+  8002c4:	6a 00                	push   $0x0
+  8002c6:	e8 93 0b 00 00       	call   800e5e <sys_env_destroy>
+  8002cb:	83 c4 10             	add    $0x10,%esp
+  8002ce:	c9                   	leave
+  8002cf:	c3                   	ret
+  8002d0:	e8 f6 12 00 00       	call   8015cb <sys_lease_complete>
+  8002d5:	eb e5                	jmp    8002bc <exit+0x15>
+
+008002d7 <_panic>:
+  8002d7:	55                   	push   %ebp
+  8002d8:	89 e5                	mov    %esp,%ebp
+  8002da:	56                   	push   %esi
+  8002db:	53                   	push   %ebx
+  8002dc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8002df:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002e5:	e8 b5 0b 00 00       	call   800e9f <sys_getenvid>
+  8002ea:	83 ec 0c             	sub    $0xc,%esp
+  8002ed:	ff 75 0c             	push   0xc(%ebp)
+  8002f0:	ff 75 08             	push   0x8(%ebp)
+  8002f3:	56                   	push   %esi
+  8002f4:	50                   	push   %eax
+  8002f5:	68 40 3a 80 00       	push   $0x803a40
+  8002fa:	e8 b3 00 00 00       	call   8003b2 <cprintf>
+  8002ff:	83 c4 18             	add    $0x18,%esp
+  800302:	53                   	push   %ebx
+  800303:	ff 75 10             	push   0x10(%ebp)
+  800306:	e8 56 00 00 00       	call   800361 <vcprintf>
+  80030b:	c7 04 24 bf 39 80 00 	movl   $0x8039bf,(%esp)
+  800312:	e8 9b 00 00 00       	call   8003b2 <cprintf>
+  800317:	83 c4 10             	add    $0x10,%esp
+  80031a:	cc                   	int3
+  80031b:	eb fd                	jmp    80031a <_panic+0x43>
+
+0080031d <putch>:
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	53                   	push   %ebx
+  800321:	83 ec 04             	sub    $0x4,%esp
+  800324:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800327:	8b 13                	mov    (%ebx),%edx
+  800329:	8d 42 01             	lea    0x1(%edx),%eax
+  80032c:	89 03                	mov    %eax,(%ebx)
+  80032e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800331:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800335:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80033a:	74 09                	je     800345 <putch+0x28>
+  80033c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800343:	c9                   	leave
+  800344:	c3                   	ret
+  800345:	83 ec 08             	sub    $0x8,%esp
+  800348:	68 ff 00 00 00       	push   $0xff
+  80034d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800350:	50                   	push   %eax
+  800351:	e8 cb 0a 00 00       	call   800e21 <sys_cputs>
+  800356:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80035c:	83 c4 10             	add    $0x10,%esp
+  80035f:	eb db                	jmp    80033c <putch+0x1f>
+
+00800361 <vcprintf>:
+  800361:	55                   	push   %ebp
+  800362:	89 e5                	mov    %esp,%ebp
+  800364:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80036a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800371:	00 00 00 
+  800374:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80037b:	00 00 00 
+  80037e:	ff 75 0c             	push   0xc(%ebp)
+  800381:	ff 75 08             	push   0x8(%ebp)
+  800384:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80038a:	50                   	push   %eax
+  80038b:	68 1d 03 80 00       	push   $0x80031d
+  800390:	e8 1c 01 00 00       	call   8004b1 <vprintfmt>
+  800395:	83 c4 08             	add    $0x8,%esp
+  800398:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80039e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003a4:	50                   	push   %eax
+  8003a5:	e8 77 0a 00 00       	call   800e21 <sys_cputs>
+  8003aa:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003b0:	c9                   	leave
+  8003b1:	c3                   	ret
+
+008003b2 <cprintf>:
+  8003b2:	55                   	push   %ebp
+  8003b3:	89 e5                	mov    %esp,%ebp
+  8003b5:	83 ec 10             	sub    $0x10,%esp
+  8003b8:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8003bb:	50                   	push   %eax
+  8003bc:	ff 75 08             	push   0x8(%ebp)
+  8003bf:	e8 9d ff ff ff       	call   800361 <vcprintf>
+  8003c4:	c9                   	leave
+  8003c5:	c3                   	ret
+
+008003c6 <printnum>:
+  8003c6:	55                   	push   %ebp
+  8003c7:	89 e5                	mov    %esp,%ebp
+  8003c9:	57                   	push   %edi
+  8003ca:	56                   	push   %esi
+  8003cb:	53                   	push   %ebx
+  8003cc:	83 ec 1c             	sub    $0x1c,%esp
+  8003cf:	89 c3                	mov    %eax,%ebx
+  8003d1:	89 d6                	mov    %edx,%esi
+  8003d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003d9:	89 d1                	mov    %edx,%ecx
+  8003db:	89 c2                	mov    %eax,%edx
+  8003dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003e0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003e3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003f0:	39 c2                	cmp    %eax,%edx
+  8003f2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003f5:	73 4b                	jae    800442 <printnum+0x7c>
+  8003f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fa:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003fd:	85 ff                	test   %edi,%edi
+  8003ff:	7e 11                	jle    800412 <printnum+0x4c>
+  800401:	83 ec 08             	sub    $0x8,%esp
+  800404:	56                   	push   %esi
+  800405:	ff 75 18             	push   0x18(%ebp)
+  800408:	ff d3                	call   *%ebx
+  80040a:	83 c4 10             	add    $0x10,%esp
+  80040d:	83 ef 01             	sub    $0x1,%edi
+  800410:	75 ef                	jne    800401 <printnum+0x3b>
+  800412:	83 ec 08             	sub    $0x8,%esp
+  800415:	56                   	push   %esi
+  800416:	83 ec 04             	sub    $0x4,%esp
+  800419:	ff 75 e4             	push   -0x1c(%ebp)
+  80041c:	ff 75 e0             	push   -0x20(%ebp)
+  80041f:	ff 75 dc             	push   -0x24(%ebp)
+  800422:	ff 75 d8             	push   -0x28(%ebp)
+  800425:	e8 24 34 00 00       	call   80384e <__umoddi3>
+  80042a:	83 c4 14             	add    $0x14,%esp
+  80042d:	0f be 80 63 3a 80 00 	movsbl 0x803a63(%eax),%eax
+  800434:	50                   	push   %eax
+  800435:	ff d3                	call   *%ebx
+  800437:	83 c4 10             	add    $0x10,%esp
+  80043a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043d:	5b                   	pop    %ebx
+  80043e:	5e                   	pop    %esi
+  80043f:	5f                   	pop    %edi
+  800440:	5d                   	pop    %ebp
+  800441:	c3                   	ret
+  800442:	83 ec 0c             	sub    $0xc,%esp
+  800445:	ff 75 18             	push   0x18(%ebp)
+  800448:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80044b:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80044e:	52                   	push   %edx
+  80044f:	50                   	push   %eax
+  800450:	83 ec 08             	sub    $0x8,%esp
+  800453:	ff 75 e4             	push   -0x1c(%ebp)
+  800456:	ff 75 e0             	push   -0x20(%ebp)
+  800459:	ff 75 dc             	push   -0x24(%ebp)
+  80045c:	ff 75 d8             	push   -0x28(%ebp)
+  80045f:	e8 cc 33 00 00       	call   803830 <__udivdi3>
+  800464:	83 c4 18             	add    $0x18,%esp
+  800467:	52                   	push   %edx
+  800468:	50                   	push   %eax
+  800469:	89 f2                	mov    %esi,%edx
+  80046b:	89 d8                	mov    %ebx,%eax
+  80046d:	e8 54 ff ff ff       	call   8003c6 <printnum>
+  800472:	83 c4 20             	add    $0x20,%esp
+  800475:	eb 9b                	jmp    800412 <printnum+0x4c>
+
+00800477 <sprintputch>:
+  800477:	55                   	push   %ebp
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80047d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800481:	8b 10                	mov    (%eax),%edx
+  800483:	3b 50 04             	cmp    0x4(%eax),%edx
+  800486:	73 0a                	jae    800492 <sprintputch+0x1b>
+  800488:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80048b:	89 08                	mov    %ecx,(%eax)
+  80048d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800490:	88 02                	mov    %al,(%edx)
+  800492:	5d                   	pop    %ebp
+  800493:	c3                   	ret
+
+00800494 <printfmt>:
+  800494:	55                   	push   %ebp
+  800495:	89 e5                	mov    %esp,%ebp
+  800497:	83 ec 08             	sub    $0x8,%esp
+  80049a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80049d:	50                   	push   %eax
+  80049e:	ff 75 10             	push   0x10(%ebp)
+  8004a1:	ff 75 0c             	push   0xc(%ebp)
+  8004a4:	ff 75 08             	push   0x8(%ebp)
+  8004a7:	e8 05 00 00 00       	call   8004b1 <vprintfmt>
+  8004ac:	83 c4 10             	add    $0x10,%esp
+  8004af:	c9                   	leave
+  8004b0:	c3                   	ret
+
+008004b1 <vprintfmt>:
+  8004b1:	55                   	push   %ebp
+  8004b2:	89 e5                	mov    %esp,%ebp
+  8004b4:	57                   	push   %edi
+  8004b5:	56                   	push   %esi
+  8004b6:	53                   	push   %ebx
+  8004b7:	83 ec 2c             	sub    $0x2c,%esp
+  8004ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004bd:	89 df                	mov    %ebx,%edi
+  8004bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004c5:	8d 70 01             	lea    0x1(%eax),%esi
+  8004c8:	0f b6 00             	movzbl (%eax),%eax
+  8004cb:	83 f8 25             	cmp    $0x25,%eax
+  8004ce:	74 1e                	je     8004ee <vprintfmt+0x3d>
+  8004d0:	85 c0                	test   %eax,%eax
+  8004d2:	0f 84 15 05 00 00    	je     8009ed <vprintfmt+0x53c>
+  8004d8:	83 ec 08             	sub    $0x8,%esp
+  8004db:	53                   	push   %ebx
+  8004dc:	50                   	push   %eax
+  8004dd:	ff d7                	call   *%edi
+  8004df:	83 c6 01             	add    $0x1,%esi
+  8004e2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004e6:	83 c4 10             	add    $0x10,%esp
+  8004e9:	83 f8 25             	cmp    $0x25,%eax
+  8004ec:	75 e2                	jne    8004d0 <vprintfmt+0x1f>
+  8004ee:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8004f2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8004f9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800500:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800507:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80050c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80050f:	8d 56 01             	lea    0x1(%esi),%edx
+  800512:	0f b6 0e             	movzbl (%esi),%ecx
+  800515:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800518:	3c 55                	cmp    $0x55,%al
+  80051a:	0f 87 3b 04 00 00    	ja     80095b <vprintfmt+0x4aa>
+  800520:	0f b6 c0             	movzbl %al,%eax
+  800523:	ff 24 85 a0 3b 80 00 	jmp    *0x803ba0(,%eax,4)
+  80052a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80052d:	eb 93                	jmp    8004c2 <vprintfmt+0x11>
+  80052f:	89 d6                	mov    %edx,%esi
+  800531:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800535:	eb d8                	jmp    80050f <vprintfmt+0x5e>
+  800537:	89 d6                	mov    %edx,%esi
+  800539:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80053d:	eb d0                	jmp    80050f <vprintfmt+0x5e>
+  80053f:	0f b6 c9             	movzbl %cl,%ecx
+  800542:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800545:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800548:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80054c:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80054f:	83 f9 09             	cmp    $0x9,%ecx
+  800552:	77 6f                	ja     8005c3 <vprintfmt+0x112>
+  800554:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800557:	83 c2 01             	add    $0x1,%edx
+  80055a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80055d:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800561:	0f be 02             	movsbl (%edx),%eax
+  800564:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800567:	83 fe 09             	cmp    $0x9,%esi
+  80056a:	76 eb                	jbe    800557 <vprintfmt+0xa6>
+  80056c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80056f:	89 d6                	mov    %edx,%esi
+  800571:	eb 13                	jmp    800586 <vprintfmt+0xd5>
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8b 00                	mov    (%eax),%eax
+  800578:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	8d 40 04             	lea    0x4(%eax),%eax
+  800581:	89 45 14             	mov    %eax,0x14(%ebp)
+  800584:	89 d6                	mov    %edx,%esi
+  800586:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80058a:	79 83                	jns    80050f <vprintfmt+0x5e>
+  80058c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80058f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800592:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800599:	e9 71 ff ff ff       	jmp    80050f <vprintfmt+0x5e>
+  80059e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005a1:	85 c9                	test   %ecx,%ecx
+  8005a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a8:	0f 49 c1             	cmovns %ecx,%eax
+  8005ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005ae:	89 d6                	mov    %edx,%esi
+  8005b0:	e9 5a ff ff ff       	jmp    80050f <vprintfmt+0x5e>
+  8005b5:	89 d6                	mov    %edx,%esi
+  8005b7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8005be:	e9 4c ff ff ff       	jmp    80050f <vprintfmt+0x5e>
+  8005c3:	89 d6                	mov    %edx,%esi
+  8005c5:	eb bf                	jmp    800586 <vprintfmt+0xd5>
+  8005c7:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8005cb:	89 d6                	mov    %edx,%esi
+  8005cd:	e9 3d ff ff ff       	jmp    80050f <vprintfmt+0x5e>
+  8005d2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8d 70 04             	lea    0x4(%eax),%esi
+  8005db:	83 ec 08             	sub    $0x8,%esp
+  8005de:	53                   	push   %ebx
+  8005df:	ff 30                	push   (%eax)
+  8005e1:	ff d7                	call   *%edi
+  8005e3:	83 c4 10             	add    $0x10,%esp
+  8005e6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005e9:	e9 d4 fe ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  8005ee:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8d 70 04             	lea    0x4(%eax),%esi
+  8005f7:	8b 10                	mov    (%eax),%edx
+  8005f9:	89 d0                	mov    %edx,%eax
+  8005fb:	f7 d8                	neg    %eax
+  8005fd:	0f 48 c2             	cmovs  %edx,%eax
+  800600:	83 f8 12             	cmp    $0x12,%eax
+  800603:	7f 23                	jg     800628 <vprintfmt+0x177>
+  800605:	8b 14 85 00 3d 80 00 	mov    0x803d00(,%eax,4),%edx
+  80060c:	85 d2                	test   %edx,%edx
+  80060e:	74 18                	je     800628 <vprintfmt+0x177>
+  800610:	52                   	push   %edx
+  800611:	68 af 3f 80 00       	push   $0x803faf
+  800616:	53                   	push   %ebx
+  800617:	57                   	push   %edi
+  800618:	e8 77 fe ff ff       	call   800494 <printfmt>
+  80061d:	83 c4 10             	add    $0x10,%esp
+  800620:	89 75 14             	mov    %esi,0x14(%ebp)
+  800623:	e9 9a fe ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  800628:	50                   	push   %eax
+  800629:	68 7b 3a 80 00       	push   $0x803a7b
+  80062e:	53                   	push   %ebx
+  80062f:	57                   	push   %edi
+  800630:	e8 5f fe ff ff       	call   800494 <printfmt>
+  800635:	83 c4 10             	add    $0x10,%esp
+  800638:	89 75 14             	mov    %esi,0x14(%ebp)
+  80063b:	e9 82 fe ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  800640:	89 55 10             	mov    %edx,0x10(%ebp)
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	83 c0 04             	add    $0x4,%eax
+  800649:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 00                	mov    (%eax),%eax
+  800651:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800654:	85 c0                	test   %eax,%eax
+  800656:	0f 84 61 03 00 00    	je     8009bd <vprintfmt+0x50c>
+  80065c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800660:	7e 06                	jle    800668 <vprintfmt+0x1b7>
+  800662:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800666:	75 29                	jne    800691 <vprintfmt+0x1e0>
+  800668:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80066b:	8d 70 01             	lea    0x1(%eax),%esi
+  80066e:	0f b6 00             	movzbl (%eax),%eax
+  800671:	0f be d0             	movsbl %al,%edx
+  800674:	85 d2                	test   %edx,%edx
+  800676:	0f 84 bb 00 00 00    	je     800737 <vprintfmt+0x286>
+  80067c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80067f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800682:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800685:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800688:	eb 7a                	jmp    800704 <vprintfmt+0x253>
+  80068a:	c7 45 d0 74 3a 80 00 	movl   $0x803a74,-0x30(%ebp)
+  800691:	83 ec 08             	sub    $0x8,%esp
+  800694:	ff 75 d4             	push   -0x2c(%ebp)
+  800697:	ff 75 d0             	push   -0x30(%ebp)
+  80069a:	e8 e0 03 00 00       	call   800a7f <strnlen>
+  80069f:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8006a2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8006a5:	83 c4 10             	add    $0x10,%esp
+  8006a8:	85 d2                	test   %edx,%edx
+  8006aa:	0f 8e d6 02 00 00    	jle    800986 <vprintfmt+0x4d5>
+  8006b0:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	56                   	push   %esi
+  8006b9:	ff d7                	call   *%edi
+  8006bb:	83 c4 10             	add    $0x10,%esp
+  8006be:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8006c2:	75 f0                	jne    8006b4 <vprintfmt+0x203>
+  8006c4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006c7:	8d 70 01             	lea    0x1(%eax),%esi
+  8006ca:	0f b6 00             	movzbl (%eax),%eax
+  8006cd:	0f be d0             	movsbl %al,%edx
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 84 da 02 00 00    	je     8009b2 <vprintfmt+0x501>
+  8006d8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006db:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006de:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006e1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006e4:	eb 1e                	jmp    800704 <vprintfmt+0x253>
+  8006e6:	83 ec 08             	sub    $0x8,%esp
+  8006e9:	ff 75 0c             	push   0xc(%ebp)
+  8006ec:	52                   	push   %edx
+  8006ed:	ff 55 08             	call   *0x8(%ebp)
+  8006f0:	83 c4 10             	add    $0x10,%esp
+  8006f3:	83 eb 01             	sub    $0x1,%ebx
+  8006f6:	83 c6 01             	add    $0x1,%esi
+  8006f9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006fd:	0f be d0             	movsbl %al,%edx
+  800700:	85 d2                	test   %edx,%edx
+  800702:	74 2a                	je     80072e <vprintfmt+0x27d>
+  800704:	85 ff                	test   %edi,%edi
+  800706:	78 05                	js     80070d <vprintfmt+0x25c>
+  800708:	83 ef 01             	sub    $0x1,%edi
+  80070b:	78 59                	js     800766 <vprintfmt+0x2b5>
+  80070d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800711:	74 d3                	je     8006e6 <vprintfmt+0x235>
+  800713:	0f be c0             	movsbl %al,%eax
+  800716:	83 e8 20             	sub    $0x20,%eax
+  800719:	83 f8 5e             	cmp    $0x5e,%eax
+  80071c:	76 c8                	jbe    8006e6 <vprintfmt+0x235>
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	ff 75 0c             	push   0xc(%ebp)
+  800724:	6a 3f                	push   $0x3f
+  800726:	ff 55 08             	call   *0x8(%ebp)
+  800729:	83 c4 10             	add    $0x10,%esp
+  80072c:	eb c5                	jmp    8006f3 <vprintfmt+0x242>
+  80072e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800731:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800734:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800737:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80073a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80073e:	7e 1b                	jle    80075b <vprintfmt+0x2aa>
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	53                   	push   %ebx
+  800744:	6a 20                	push   $0x20
+  800746:	ff d7                	call   *%edi
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	83 ee 01             	sub    $0x1,%esi
+  80074e:	75 f0                	jne    800740 <vprintfmt+0x28f>
+  800750:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+  800756:	e9 67 fd ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  80075b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800761:	e9 5c fd ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  800766:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800769:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80076c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80076f:	eb c6                	jmp    800737 <vprintfmt+0x286>
+  800771:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800774:	89 55 10             	mov    %edx,0x10(%ebp)
+  800777:	83 f9 01             	cmp    $0x1,%ecx
+  80077a:	7f 1f                	jg     80079b <vprintfmt+0x2ea>
+  80077c:	85 c9                	test   %ecx,%ecx
+  80077e:	74 67                	je     8007e7 <vprintfmt+0x336>
+  800780:	8b 45 14             	mov    0x14(%ebp),%eax
+  800783:	8b 30                	mov    (%eax),%esi
+  800785:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800788:	89 f0                	mov    %esi,%eax
+  80078a:	c1 f8 1f             	sar    $0x1f,%eax
+  80078d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800790:	8b 45 14             	mov    0x14(%ebp),%eax
+  800793:	8d 40 04             	lea    0x4(%eax),%eax
+  800796:	89 45 14             	mov    %eax,0x14(%ebp)
+  800799:	eb 17                	jmp    8007b2 <vprintfmt+0x301>
+  80079b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079e:	8b 50 04             	mov    0x4(%eax),%edx
+  8007a1:	8b 00                	mov    (%eax),%eax
+  8007a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8d 40 08             	lea    0x8(%eax),%eax
+  8007af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007b5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007b8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007bd:	85 c9                	test   %ecx,%ecx
+  8007bf:	0f 89 12 01 00 00    	jns    8008d7 <vprintfmt+0x426>
+  8007c5:	83 ec 08             	sub    $0x8,%esp
+  8007c8:	53                   	push   %ebx
+  8007c9:	6a 2d                	push   $0x2d
+  8007cb:	ff d7                	call   *%edi
+  8007cd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007d0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007d3:	f7 da                	neg    %edx
+  8007d5:	83 d1 00             	adc    $0x0,%ecx
+  8007d8:	f7 d9                	neg    %ecx
+  8007da:	83 c4 10             	add    $0x10,%esp
+  8007dd:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007e2:	e9 f0 00 00 00       	jmp    8008d7 <vprintfmt+0x426>
+  8007e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ea:	8b 30                	mov    (%eax),%esi
+  8007ec:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007ef:	89 f0                	mov    %esi,%eax
+  8007f1:	c1 f8 1f             	sar    $0x1f,%eax
+  8007f4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800800:	eb b0                	jmp    8007b2 <vprintfmt+0x301>
+  800802:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800805:	89 55 10             	mov    %edx,0x10(%ebp)
+  800808:	83 f9 01             	cmp    $0x1,%ecx
+  80080b:	7f 1e                	jg     80082b <vprintfmt+0x37a>
+  80080d:	85 c9                	test   %ecx,%ecx
+  80080f:	74 32                	je     800843 <vprintfmt+0x392>
+  800811:	8b 45 14             	mov    0x14(%ebp),%eax
+  800814:	8b 10                	mov    (%eax),%edx
+  800816:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081b:	8d 40 04             	lea    0x4(%eax),%eax
+  80081e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800821:	be 0a 00 00 00       	mov    $0xa,%esi
+  800826:	e9 ac 00 00 00       	jmp    8008d7 <vprintfmt+0x426>
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	8b 10                	mov    (%eax),%edx
+  800830:	8b 48 04             	mov    0x4(%eax),%ecx
+  800833:	8d 40 08             	lea    0x8(%eax),%eax
+  800836:	89 45 14             	mov    %eax,0x14(%ebp)
+  800839:	be 0a 00 00 00       	mov    $0xa,%esi
+  80083e:	e9 94 00 00 00       	jmp    8008d7 <vprintfmt+0x426>
+  800843:	8b 45 14             	mov    0x14(%ebp),%eax
+  800846:	8b 10                	mov    (%eax),%edx
+  800848:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084d:	8d 40 04             	lea    0x4(%eax),%eax
+  800850:	89 45 14             	mov    %eax,0x14(%ebp)
+  800853:	be 0a 00 00 00       	mov    $0xa,%esi
+  800858:	eb 7d                	jmp    8008d7 <vprintfmt+0x426>
+  80085a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80085d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800860:	83 f9 01             	cmp    $0x1,%ecx
+  800863:	7f 1b                	jg     800880 <vprintfmt+0x3cf>
+  800865:	85 c9                	test   %ecx,%ecx
+  800867:	74 2c                	je     800895 <vprintfmt+0x3e4>
+  800869:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086c:	8b 10                	mov    (%eax),%edx
+  80086e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800873:	8d 40 04             	lea    0x4(%eax),%eax
+  800876:	89 45 14             	mov    %eax,0x14(%ebp)
+  800879:	be 08 00 00 00       	mov    $0x8,%esi
+  80087e:	eb 57                	jmp    8008d7 <vprintfmt+0x426>
+  800880:	8b 45 14             	mov    0x14(%ebp),%eax
+  800883:	8b 10                	mov    (%eax),%edx
+  800885:	8b 48 04             	mov    0x4(%eax),%ecx
+  800888:	8d 40 08             	lea    0x8(%eax),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088e:	be 08 00 00 00       	mov    $0x8,%esi
+  800893:	eb 42                	jmp    8008d7 <vprintfmt+0x426>
+  800895:	8b 45 14             	mov    0x14(%ebp),%eax
+  800898:	8b 10                	mov    (%eax),%edx
+  80089a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80089f:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008a5:	be 08 00 00 00       	mov    $0x8,%esi
+  8008aa:	eb 2b                	jmp    8008d7 <vprintfmt+0x426>
+  8008ac:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008af:	83 ec 08             	sub    $0x8,%esp
+  8008b2:	53                   	push   %ebx
+  8008b3:	6a 30                	push   $0x30
+  8008b5:	ff d7                	call   *%edi
+  8008b7:	83 c4 08             	add    $0x8,%esp
+  8008ba:	53                   	push   %ebx
+  8008bb:	6a 78                	push   $0x78
+  8008bd:	ff d7                	call   *%edi
+  8008bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c2:	8b 10                	mov    (%eax),%edx
+  8008c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c9:	83 c4 10             	add    $0x10,%esp
+  8008cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008d2:	be 10 00 00 00       	mov    $0x10,%esi
+  8008d7:	83 ec 0c             	sub    $0xc,%esp
+  8008da:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008de:	50                   	push   %eax
+  8008df:	ff 75 e4             	push   -0x1c(%ebp)
+  8008e2:	56                   	push   %esi
+  8008e3:	51                   	push   %ecx
+  8008e4:	52                   	push   %edx
+  8008e5:	89 da                	mov    %ebx,%edx
+  8008e7:	89 f8                	mov    %edi,%eax
+  8008e9:	e8 d8 fa ff ff       	call   8003c6 <printnum>
+  8008ee:	83 c4 20             	add    $0x20,%esp
+  8008f1:	e9 cc fb ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  8008f6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008f9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008fc:	83 f9 01             	cmp    $0x1,%ecx
+  8008ff:	7f 1b                	jg     80091c <vprintfmt+0x46b>
+  800901:	85 c9                	test   %ecx,%ecx
+  800903:	74 2c                	je     800931 <vprintfmt+0x480>
+  800905:	8b 45 14             	mov    0x14(%ebp),%eax
+  800908:	8b 10                	mov    (%eax),%edx
+  80090a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80090f:	8d 40 04             	lea    0x4(%eax),%eax
+  800912:	89 45 14             	mov    %eax,0x14(%ebp)
+  800915:	be 10 00 00 00       	mov    $0x10,%esi
+  80091a:	eb bb                	jmp    8008d7 <vprintfmt+0x426>
+  80091c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091f:	8b 10                	mov    (%eax),%edx
+  800921:	8b 48 04             	mov    0x4(%eax),%ecx
+  800924:	8d 40 08             	lea    0x8(%eax),%eax
+  800927:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092a:	be 10 00 00 00       	mov    $0x10,%esi
+  80092f:	eb a6                	jmp    8008d7 <vprintfmt+0x426>
+  800931:	8b 45 14             	mov    0x14(%ebp),%eax
+  800934:	8b 10                	mov    (%eax),%edx
+  800936:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80093b:	8d 40 04             	lea    0x4(%eax),%eax
+  80093e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800941:	be 10 00 00 00       	mov    $0x10,%esi
+  800946:	eb 8f                	jmp    8008d7 <vprintfmt+0x426>
+  800948:	89 55 10             	mov    %edx,0x10(%ebp)
+  80094b:	83 ec 08             	sub    $0x8,%esp
+  80094e:	53                   	push   %ebx
+  80094f:	6a 25                	push   $0x25
+  800951:	ff d7                	call   *%edi
+  800953:	83 c4 10             	add    $0x10,%esp
+  800956:	e9 67 fb ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  80095b:	83 ec 08             	sub    $0x8,%esp
+  80095e:	53                   	push   %ebx
+  80095f:	6a 25                	push   $0x25
+  800961:	ff d7                	call   *%edi
+  800963:	83 c4 10             	add    $0x10,%esp
+  800966:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80096a:	0f 84 ba fb ff ff    	je     80052a <vprintfmt+0x79>
+  800970:	89 75 10             	mov    %esi,0x10(%ebp)
+  800973:	89 f0                	mov    %esi,%eax
+  800975:	83 e8 01             	sub    $0x1,%eax
+  800978:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80097c:	75 f7                	jne    800975 <vprintfmt+0x4c4>
+  80097e:	89 45 10             	mov    %eax,0x10(%ebp)
+  800981:	e9 3c fb ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  800986:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800989:	8d 70 01             	lea    0x1(%eax),%esi
+  80098c:	0f b6 00             	movzbl (%eax),%eax
+  80098f:	0f be d0             	movsbl %al,%edx
+  800992:	85 d2                	test   %edx,%edx
+  800994:	74 11                	je     8009a7 <vprintfmt+0x4f6>
+  800996:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800999:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80099c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80099f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009a2:	e9 5d fd ff ff       	jmp    800704 <vprintfmt+0x253>
+  8009a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ad:	e9 10 fb ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  8009b2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009b8:	e9 05 fb ff ff       	jmp    8004c2 <vprintfmt+0x11>
+  8009bd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009c1:	7e 0a                	jle    8009cd <vprintfmt+0x51c>
+  8009c3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009c7:	0f 85 bd fc ff ff    	jne    80068a <vprintfmt+0x1d9>
+  8009cd:	ba 28 00 00 00       	mov    $0x28,%edx
+  8009d2:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009d7:	be 75 3a 80 00       	mov    $0x803a75,%esi
+  8009dc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009df:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009e2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009e5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009e8:	e9 17 fd ff ff       	jmp    800704 <vprintfmt+0x253>
+  8009ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009f0:	5b                   	pop    %ebx
+  8009f1:	5e                   	pop    %esi
+  8009f2:	5f                   	pop    %edi
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+
+008009f5 <vsnprintf>:
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	83 ec 18             	sub    $0x18,%esp
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a01:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a04:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a08:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a0b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a12:	85 c0                	test   %eax,%eax
+  800a14:	74 26                	je     800a3c <vsnprintf+0x47>
+  800a16:	85 d2                	test   %edx,%edx
+  800a18:	7e 22                	jle    800a3c <vsnprintf+0x47>
+  800a1a:	ff 75 14             	push   0x14(%ebp)
+  800a1d:	ff 75 10             	push   0x10(%ebp)
+  800a20:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a23:	50                   	push   %eax
+  800a24:	68 77 04 80 00       	push   $0x800477
+  800a29:	e8 83 fa ff ff       	call   8004b1 <vprintfmt>
+  800a2e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a31:	c6 00 00             	movb   $0x0,(%eax)
+  800a34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a37:	83 c4 10             	add    $0x10,%esp
+  800a3a:	c9                   	leave
+  800a3b:	c3                   	ret
+  800a3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a41:	eb f7                	jmp    800a3a <vsnprintf+0x45>
+
+00800a43 <snprintf>:
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	83 ec 08             	sub    $0x8,%esp
+  800a49:	8d 45 14             	lea    0x14(%ebp),%eax
+  800a4c:	50                   	push   %eax
+  800a4d:	ff 75 10             	push   0x10(%ebp)
+  800a50:	ff 75 0c             	push   0xc(%ebp)
+  800a53:	ff 75 08             	push   0x8(%ebp)
+  800a56:	e8 9a ff ff ff       	call   8009f5 <vsnprintf>
+  800a5b:	c9                   	leave
+  800a5c:	c3                   	ret
+
+00800a5d <strlen>:
+  800a5d:	55                   	push   %ebp
+  800a5e:	89 e5                	mov    %esp,%ebp
+  800a60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a63:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a66:	74 10                	je     800a78 <strlen+0x1b>
+  800a68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6d:	83 c0 01             	add    $0x1,%eax
+  800a70:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a74:	75 f7                	jne    800a6d <strlen+0x10>
+  800a76:	5d                   	pop    %ebp
+  800a77:	c3                   	ret
+  800a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7d:	eb f7                	jmp    800a76 <strlen+0x19>
+
+00800a7f <strnlen>:
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a88:	85 d2                	test   %edx,%edx
+  800a8a:	74 16                	je     800aa2 <strnlen+0x23>
+  800a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a91:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a95:	74 09                	je     800aa0 <strnlen+0x21>
+  800a97:	83 c0 01             	add    $0x1,%eax
+  800a9a:	39 d0                	cmp    %edx,%eax
+  800a9c:	75 f3                	jne    800a91 <strnlen+0x12>
+  800a9e:	89 d0                	mov    %edx,%eax
+  800aa0:	5d                   	pop    %ebp
+  800aa1:	c3                   	ret
+  800aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa7:	eb f7                	jmp    800aa0 <strnlen+0x21>
+
+00800aa9 <strcpy>:
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	53                   	push   %ebx
+  800aad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800abc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800abf:	83 c0 01             	add    $0x1,%eax
+  800ac2:	84 d2                	test   %dl,%dl
+  800ac4:	75 f2                	jne    800ab8 <strcpy+0xf>
+  800ac6:	89 c8                	mov    %ecx,%eax
+  800ac8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800acb:	c9                   	leave
+  800acc:	c3                   	ret
+
+00800acd <strcat>:
+  800acd:	55                   	push   %ebp
+  800ace:	89 e5                	mov    %esp,%ebp
+  800ad0:	53                   	push   %ebx
+  800ad1:	83 ec 10             	sub    $0x10,%esp
+  800ad4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ad7:	53                   	push   %ebx
+  800ad8:	e8 80 ff ff ff       	call   800a5d <strlen>
+  800add:	83 c4 08             	add    $0x8,%esp
+  800ae0:	ff 75 0c             	push   0xc(%ebp)
+  800ae3:	01 d8                	add    %ebx,%eax
+  800ae5:	50                   	push   %eax
+  800ae6:	e8 be ff ff ff       	call   800aa9 <strcpy>
+  800aeb:	89 d8                	mov    %ebx,%eax
+  800aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af0:	c9                   	leave
+  800af1:	c3                   	ret
+
+00800af2 <strncpy>:
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+  800af7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800afd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b00:	85 db                	test   %ebx,%ebx
+  800b02:	74 17                	je     800b1b <strncpy+0x29>
+  800b04:	01 f3                	add    %esi,%ebx
+  800b06:	89 f0                	mov    %esi,%eax
+  800b08:	83 c0 01             	add    $0x1,%eax
+  800b0b:	0f b6 0a             	movzbl (%edx),%ecx
+  800b0e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b11:	80 f9 01             	cmp    $0x1,%cl
+  800b14:	83 da ff             	sbb    $0xffffffff,%edx
+  800b17:	39 c3                	cmp    %eax,%ebx
+  800b19:	75 ed                	jne    800b08 <strncpy+0x16>
+  800b1b:	89 f0                	mov    %esi,%eax
+  800b1d:	5b                   	pop    %ebx
+  800b1e:	5e                   	pop    %esi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <strlcpy>:
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	56                   	push   %esi
+  800b25:	53                   	push   %ebx
+  800b26:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b2f:	89 f0                	mov    %esi,%eax
+  800b31:	85 db                	test   %ebx,%ebx
+  800b33:	74 1e                	je     800b53 <strlcpy+0x32>
+  800b35:	83 eb 01             	sub    $0x1,%ebx
+  800b38:	74 16                	je     800b50 <strlcpy+0x2f>
+  800b3a:	01 f3                	add    %esi,%ebx
+  800b3c:	0f b6 0a             	movzbl (%edx),%ecx
+  800b3f:	84 c9                	test   %cl,%cl
+  800b41:	74 0d                	je     800b50 <strlcpy+0x2f>
+  800b43:	83 c2 01             	add    $0x1,%edx
+  800b46:	83 c0 01             	add    $0x1,%eax
+  800b49:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b4c:	39 d8                	cmp    %ebx,%eax
+  800b4e:	75 ec                	jne    800b3c <strlcpy+0x1b>
+  800b50:	c6 00 00             	movb   $0x0,(%eax)
+  800b53:	29 f0                	sub    %esi,%eax
+  800b55:	5b                   	pop    %ebx
+  800b56:	5e                   	pop    %esi
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+
+00800b59 <strcmp>:
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b62:	0f b6 01             	movzbl (%ecx),%eax
+  800b65:	84 c0                	test   %al,%al
+  800b67:	74 11                	je     800b7a <strcmp+0x21>
+  800b69:	38 02                	cmp    %al,(%edx)
+  800b6b:	75 0d                	jne    800b7a <strcmp+0x21>
+  800b6d:	83 c1 01             	add    $0x1,%ecx
+  800b70:	83 c2 01             	add    $0x1,%edx
+  800b73:	0f b6 01             	movzbl (%ecx),%eax
+  800b76:	84 c0                	test   %al,%al
+  800b78:	75 ef                	jne    800b69 <strcmp+0x10>
+  800b7a:	0f b6 c0             	movzbl %al,%eax
+  800b7d:	0f b6 12             	movzbl (%edx),%edx
+  800b80:	29 d0                	sub    %edx,%eax
+  800b82:	5d                   	pop    %ebp
+  800b83:	c3                   	ret
+
+00800b84 <strncmp>:
+  800b84:	55                   	push   %ebp
+  800b85:	89 e5                	mov    %esp,%ebp
+  800b87:	53                   	push   %ebx
+  800b88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b8e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b96:	85 d2                	test   %edx,%edx
+  800b98:	74 2e                	je     800bc8 <strncmp+0x44>
+  800b9a:	0f b6 01             	movzbl (%ecx),%eax
+  800b9d:	84 c0                	test   %al,%al
+  800b9f:	74 16                	je     800bb7 <strncmp+0x33>
+  800ba1:	3a 03                	cmp    (%ebx),%al
+  800ba3:	75 12                	jne    800bb7 <strncmp+0x33>
+  800ba5:	83 c1 01             	add    $0x1,%ecx
+  800ba8:	83 c3 01             	add    $0x1,%ebx
+  800bab:	83 ea 01             	sub    $0x1,%edx
+  800bae:	75 ea                	jne    800b9a <strncmp+0x16>
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb5:	eb 11                	jmp    800bc8 <strncmp+0x44>
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbc:	85 d2                	test   %edx,%edx
+  800bbe:	74 08                	je     800bc8 <strncmp+0x44>
+  800bc0:	0f b6 01             	movzbl (%ecx),%eax
+  800bc3:	0f b6 13             	movzbl (%ebx),%edx
+  800bc6:	29 d0                	sub    %edx,%eax
+  800bc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bcb:	c9                   	leave
+  800bcc:	c3                   	ret
+
+00800bcd <strchr>:
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800bd7:	0f b6 10             	movzbl (%eax),%edx
+  800bda:	84 d2                	test   %dl,%dl
+  800bdc:	74 15                	je     800bf3 <strchr+0x26>
+  800bde:	38 d1                	cmp    %dl,%cl
+  800be0:	74 0f                	je     800bf1 <strchr+0x24>
+  800be2:	83 c0 01             	add    $0x1,%eax
+  800be5:	0f b6 10             	movzbl (%eax),%edx
+  800be8:	84 d2                	test   %dl,%dl
+  800bea:	75 f2                	jne    800bde <strchr+0x11>
+  800bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf1:	5d                   	pop    %ebp
+  800bf2:	c3                   	ret
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf8:	eb f7                	jmp    800bf1 <strchr+0x24>
+
+00800bfa <strfind>:
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	53                   	push   %ebx
+  800bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c04:	0f b6 18             	movzbl (%eax),%ebx
+  800c07:	38 d3                	cmp    %dl,%bl
+  800c09:	74 14                	je     800c1f <strfind+0x25>
+  800c0b:	89 d1                	mov    %edx,%ecx
+  800c0d:	84 db                	test   %bl,%bl
+  800c0f:	74 0e                	je     800c1f <strfind+0x25>
+  800c11:	83 c0 01             	add    $0x1,%eax
+  800c14:	0f b6 10             	movzbl (%eax),%edx
+  800c17:	38 ca                	cmp    %cl,%dl
+  800c19:	74 04                	je     800c1f <strfind+0x25>
+  800c1b:	84 d2                	test   %dl,%dl
+  800c1d:	75 f2                	jne    800c11 <strfind+0x17>
+  800c1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c22:	c9                   	leave
+  800c23:	c3                   	ret
+
+00800c24 <memset>:
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c2b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c2e:	85 c9                	test   %ecx,%ecx
+  800c30:	74 20                	je     800c52 <memset+0x2e>
+  800c32:	89 f8                	mov    %edi,%eax
+  800c34:	09 c8                	or     %ecx,%eax
+  800c36:	a8 03                	test   $0x3,%al
+  800c38:	75 12                	jne    800c4c <memset+0x28>
+  800c3a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c3e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800c44:	c1 e9 02             	shr    $0x2,%ecx
+  800c47:	fc                   	cld
+  800c48:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c4a:	eb 06                	jmp    800c52 <memset+0x2e>
+  800c4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c4f:	fc                   	cld
+  800c50:	f3 aa                	rep stos %al,%es:(%edi)
+  800c52:	89 f8                	mov    %edi,%eax
+  800c54:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c57:	c9                   	leave
+  800c58:	c3                   	ret
+
+00800c59 <memmove>:
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c61:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c64:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c67:	39 c6                	cmp    %eax,%esi
+  800c69:	73 32                	jae    800c9d <memmove+0x44>
+  800c6b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c6e:	39 d0                	cmp    %edx,%eax
+  800c70:	73 2b                	jae    800c9d <memmove+0x44>
+  800c72:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800c75:	89 d6                	mov    %edx,%esi
+  800c77:	09 fe                	or     %edi,%esi
+  800c79:	09 ce                	or     %ecx,%esi
+  800c7b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c81:	75 0e                	jne    800c91 <memmove+0x38>
+  800c83:	83 ef 04             	sub    $0x4,%edi
+  800c86:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c89:	c1 e9 02             	shr    $0x2,%ecx
+  800c8c:	fd                   	std
+  800c8d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c8f:	eb 09                	jmp    800c9a <memmove+0x41>
+  800c91:	83 ef 01             	sub    $0x1,%edi
+  800c94:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800c97:	fd                   	std
+  800c98:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c9a:	fc                   	cld
+  800c9b:	eb 1a                	jmp    800cb7 <memmove+0x5e>
+  800c9d:	89 f2                	mov    %esi,%edx
+  800c9f:	09 c2                	or     %eax,%edx
+  800ca1:	09 ca                	or     %ecx,%edx
+  800ca3:	f6 c2 03             	test   $0x3,%dl
+  800ca6:	75 0a                	jne    800cb2 <memmove+0x59>
+  800ca8:	c1 e9 02             	shr    $0x2,%ecx
+  800cab:	89 c7                	mov    %eax,%edi
+  800cad:	fc                   	cld
+  800cae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cb0:	eb 05                	jmp    800cb7 <memmove+0x5e>
+  800cb2:	89 c7                	mov    %eax,%edi
+  800cb4:	fc                   	cld
+  800cb5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+
+00800cbb <memcpy>:
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	83 ec 0c             	sub    $0xc,%esp
+  800cc1:	ff 75 10             	push   0x10(%ebp)
+  800cc4:	ff 75 0c             	push   0xc(%ebp)
+  800cc7:	ff 75 08             	push   0x8(%ebp)
+  800cca:	e8 8a ff ff ff       	call   800c59 <memmove>
+  800ccf:	c9                   	leave
+  800cd0:	c3                   	ret
+
+00800cd1 <memcmp>:
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	56                   	push   %esi
+  800cd5:	53                   	push   %ebx
+  800cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cdc:	8b 75 10             	mov    0x10(%ebp),%esi
+  800cdf:	85 f6                	test   %esi,%esi
+  800ce1:	74 29                	je     800d0c <memcmp+0x3b>
+  800ce3:	01 c6                	add    %eax,%esi
+  800ce5:	0f b6 08             	movzbl (%eax),%ecx
+  800ce8:	0f b6 1a             	movzbl (%edx),%ebx
+  800ceb:	38 d9                	cmp    %bl,%cl
+  800ced:	75 11                	jne    800d00 <memcmp+0x2f>
+  800cef:	83 c0 01             	add    $0x1,%eax
+  800cf2:	83 c2 01             	add    $0x1,%edx
+  800cf5:	39 c6                	cmp    %eax,%esi
+  800cf7:	75 ec                	jne    800ce5 <memcmp+0x14>
+  800cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfe:	eb 08                	jmp    800d08 <memcmp+0x37>
+  800d00:	0f b6 c1             	movzbl %cl,%eax
+  800d03:	0f b6 db             	movzbl %bl,%ebx
+  800d06:	29 d8                	sub    %ebx,%eax
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+  800d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d11:	eb f5                	jmp    800d08 <memcmp+0x37>
+
+00800d13 <memfind>:
+  800d13:	55                   	push   %ebp
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1c:	89 c2                	mov    %eax,%edx
+  800d1e:	03 55 10             	add    0x10(%ebp),%edx
+  800d21:	39 d0                	cmp    %edx,%eax
+  800d23:	73 0d                	jae    800d32 <memfind+0x1f>
+  800d25:	38 08                	cmp    %cl,(%eax)
+  800d27:	74 0d                	je     800d36 <memfind+0x23>
+  800d29:	83 c0 01             	add    $0x1,%eax
+  800d2c:	39 c2                	cmp    %eax,%edx
+  800d2e:	75 f5                	jne    800d25 <memfind+0x12>
+  800d30:	eb 06                	jmp    800d38 <memfind+0x25>
+  800d32:	89 c2                	mov    %eax,%edx
+  800d34:	eb 02                	jmp    800d38 <memfind+0x25>
+  800d36:	89 c2                	mov    %eax,%edx
+  800d38:	89 d0                	mov    %edx,%eax
+  800d3a:	5d                   	pop    %ebp
+  800d3b:	c3                   	ret
+
+00800d3c <strtol>:
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d48:	0f b6 02             	movzbl (%edx),%eax
+  800d4b:	3c 20                	cmp    $0x20,%al
+  800d4d:	74 04                	je     800d53 <strtol+0x17>
+  800d4f:	3c 09                	cmp    $0x9,%al
+  800d51:	75 0e                	jne    800d61 <strtol+0x25>
+  800d53:	83 c2 01             	add    $0x1,%edx
+  800d56:	0f b6 02             	movzbl (%edx),%eax
+  800d59:	3c 20                	cmp    $0x20,%al
+  800d5b:	74 f6                	je     800d53 <strtol+0x17>
+  800d5d:	3c 09                	cmp    $0x9,%al
+  800d5f:	74 f2                	je     800d53 <strtol+0x17>
+  800d61:	3c 2b                	cmp    $0x2b,%al
+  800d63:	74 2a                	je     800d8f <strtol+0x53>
+  800d65:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d6a:	3c 2d                	cmp    $0x2d,%al
+  800d6c:	74 2b                	je     800d99 <strtol+0x5d>
+  800d6e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d74:	75 0f                	jne    800d85 <strtol+0x49>
+  800d76:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d79:	74 28                	je     800da3 <strtol+0x67>
+  800d7b:	85 db                	test   %ebx,%ebx
+  800d7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d82:	0f 44 d8             	cmove  %eax,%ebx
+  800d85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d8a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d8d:	eb 46                	jmp    800dd5 <strtol+0x99>
+  800d8f:	83 c2 01             	add    $0x1,%edx
+  800d92:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d97:	eb d5                	jmp    800d6e <strtol+0x32>
+  800d99:	83 c2 01             	add    $0x1,%edx
+  800d9c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800da1:	eb cb                	jmp    800d6e <strtol+0x32>
+  800da3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800da7:	74 0e                	je     800db7 <strtol+0x7b>
+  800da9:	85 db                	test   %ebx,%ebx
+  800dab:	75 d8                	jne    800d85 <strtol+0x49>
+  800dad:	83 c2 01             	add    $0x1,%edx
+  800db0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800db5:	eb ce                	jmp    800d85 <strtol+0x49>
+  800db7:	83 c2 02             	add    $0x2,%edx
+  800dba:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800dbf:	eb c4                	jmp    800d85 <strtol+0x49>
+  800dc1:	0f be c0             	movsbl %al,%eax
+  800dc4:	83 e8 30             	sub    $0x30,%eax
+  800dc7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dca:	7d 3a                	jge    800e06 <strtol+0xca>
+  800dcc:	83 c2 01             	add    $0x1,%edx
+  800dcf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dd3:	01 c1                	add    %eax,%ecx
+  800dd5:	0f b6 02             	movzbl (%edx),%eax
+  800dd8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ddb:	89 f3                	mov    %esi,%ebx
+  800ddd:	80 fb 09             	cmp    $0x9,%bl
+  800de0:	76 df                	jbe    800dc1 <strtol+0x85>
+  800de2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800de5:	89 f3                	mov    %esi,%ebx
+  800de7:	80 fb 19             	cmp    $0x19,%bl
+  800dea:	77 08                	ja     800df4 <strtol+0xb8>
+  800dec:	0f be c0             	movsbl %al,%eax
+  800def:	83 e8 57             	sub    $0x57,%eax
+  800df2:	eb d3                	jmp    800dc7 <strtol+0x8b>
+  800df4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800df7:	89 f3                	mov    %esi,%ebx
+  800df9:	80 fb 19             	cmp    $0x19,%bl
+  800dfc:	77 08                	ja     800e06 <strtol+0xca>
+  800dfe:	0f be c0             	movsbl %al,%eax
+  800e01:	83 e8 37             	sub    $0x37,%eax
+  800e04:	eb c1                	jmp    800dc7 <strtol+0x8b>
+  800e06:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e0a:	74 05                	je     800e11 <strtol+0xd5>
+  800e0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e0f:	89 10                	mov    %edx,(%eax)
+  800e11:	89 c8                	mov    %ecx,%eax
+  800e13:	f7 d8                	neg    %eax
+  800e15:	85 ff                	test   %edi,%edi
+  800e17:	0f 45 c8             	cmovne %eax,%ecx
+  800e1a:	89 c8                	mov    %ecx,%eax
+  800e1c:	5b                   	pop    %ebx
+  800e1d:	5e                   	pop    %esi
+  800e1e:	5f                   	pop    %edi
+  800e1f:	5d                   	pop    %ebp
+  800e20:	c3                   	ret
+
+00800e21 <sys_cputs>:
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	57                   	push   %edi
+  800e25:	56                   	push   %esi
+  800e26:	53                   	push   %ebx
+  800e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e32:	89 c3                	mov    %eax,%ebx
+  800e34:	89 c7                	mov    %eax,%edi
+  800e36:	89 c6                	mov    %eax,%esi
+  800e38:	cd 30                	int    $0x30
+  800e3a:	5b                   	pop    %ebx
+  800e3b:	5e                   	pop    %esi
+  800e3c:	5f                   	pop    %edi
+  800e3d:	5d                   	pop    %ebp
+  800e3e:	c3                   	ret
+
+00800e3f <sys_cgetc>:
+  800e3f:	55                   	push   %ebp
+  800e40:	89 e5                	mov    %esp,%ebp
+  800e42:	57                   	push   %edi
+  800e43:	56                   	push   %esi
+  800e44:	53                   	push   %ebx
+  800e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e4f:	89 d1                	mov    %edx,%ecx
+  800e51:	89 d3                	mov    %edx,%ebx
+  800e53:	89 d7                	mov    %edx,%edi
+  800e55:	89 d6                	mov    %edx,%esi
+  800e57:	cd 30                	int    $0x30
+  800e59:	5b                   	pop    %ebx
+  800e5a:	5e                   	pop    %esi
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <sys_env_destroy>:
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	53                   	push   %ebx
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+  800e67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e74:	89 cb                	mov    %ecx,%ebx
+  800e76:	89 cf                	mov    %ecx,%edi
+  800e78:	89 ce                	mov    %ecx,%esi
+  800e7a:	cd 30                	int    $0x30
+  800e7c:	85 c0                	test   %eax,%eax
+  800e7e:	7f 08                	jg     800e88 <sys_env_destroy+0x2a>
+  800e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e83:	5b                   	pop    %ebx
+  800e84:	5e                   	pop    %esi
+  800e85:	5f                   	pop    %edi
+  800e86:	5d                   	pop    %ebp
+  800e87:	c3                   	ret
+  800e88:	83 ec 0c             	sub    $0xc,%esp
+  800e8b:	50                   	push   %eax
+  800e8c:	6a 03                	push   $0x3
+  800e8e:	68 6b 3d 80 00       	push   $0x803d6b
+  800e93:	6a 24                	push   $0x24
+  800e95:	68 88 3d 80 00       	push   $0x803d88
+  800e9a:	e8 38 f4 ff ff       	call   8002d7 <_panic>
+
+00800e9f <sys_getenvid>:
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	57                   	push   %edi
+  800ea3:	56                   	push   %esi
+  800ea4:	53                   	push   %ebx
+  800ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eaa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800eaf:	89 d1                	mov    %edx,%ecx
+  800eb1:	89 d3                	mov    %edx,%ebx
+  800eb3:	89 d7                	mov    %edx,%edi
+  800eb5:	89 d6                	mov    %edx,%esi
+  800eb7:	cd 30                	int    $0x30
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+
+00800ebe <sys_yield>:
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	57                   	push   %edi
+  800ec2:	56                   	push   %esi
+  800ec3:	53                   	push   %ebx
+  800ec4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ecb:	74 26                	je     800ef3 <sys_yield+0x35>
+  800ecd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ed7:	89 d1                	mov    %edx,%ecx
+  800ed9:	89 d3                	mov    %edx,%ebx
+  800edb:	89 d7                	mov    %edx,%edi
+  800edd:	6a 00                	push   $0x0
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	8d 35 ea 0e 80 00    	lea    0x800eea,%esi
+  800ee8:	0f 34                	sysenter
+  800eea:	5d                   	pop    %ebp
+  800eeb:	83 c4 04             	add    $0x4,%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+  800ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800efd:	89 d1                	mov    %edx,%ecx
+  800eff:	89 d3                	mov    %edx,%ebx
+  800f01:	89 d7                	mov    %edx,%edi
+  800f03:	89 d6                	mov    %edx,%esi
+  800f05:	cd 30                	int    $0x30
+  800f07:	eb e5                	jmp    800eee <sys_yield+0x30>
+
+00800f09 <sys_page_alloc>:
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+  800f12:	be 00 00 00 00       	mov    $0x0,%esi
+  800f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f25:	89 f7                	mov    %esi,%edi
+  800f27:	cd 30                	int    $0x30
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	7f 08                	jg     800f35 <sys_page_alloc+0x2c>
+  800f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+  800f35:	83 ec 0c             	sub    $0xc,%esp
+  800f38:	50                   	push   %eax
+  800f39:	6a 04                	push   $0x4
+  800f3b:	68 6b 3d 80 00       	push   $0x803d6b
+  800f40:	6a 24                	push   $0x24
+  800f42:	68 88 3d 80 00       	push   $0x803d88
+  800f47:	e8 8b f3 ff ff       	call   8002d7 <_panic>
+
+00800f4c <sys_page_map>:
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f5c:	74 33                	je     800f91 <sys_page_map+0x45>
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f64:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6f:	ff 75 18             	push   0x18(%ebp)
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	8d 35 7d 0f 80 00    	lea    0x800f7d,%esi
+  800f7b:	0f 34                	sysenter
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	83 c4 04             	add    $0x4,%esp
+  800f81:	89 c2                	mov    %eax,%edx
+  800f83:	85 c0                	test   %eax,%eax
+  800f85:	7f 3d                	jg     800fc4 <sys_page_map+0x78>
+  800f87:	89 d0                	mov    %edx,%eax
+  800f89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8c:	5b                   	pop    %ebx
+  800f8d:	5e                   	pop    %esi
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+  800f91:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f9f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa2:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fa5:	cd 30                	int    $0x30
+  800fa7:	89 c2                	mov    %eax,%edx
+  800fa9:	85 c0                	test   %eax,%eax
+  800fab:	7e da                	jle    800f87 <sys_page_map+0x3b>
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+  800fb0:	50                   	push   %eax
+  800fb1:	6a 05                	push   $0x5
+  800fb3:	68 6b 3d 80 00       	push   $0x803d6b
+  800fb8:	6a 24                	push   $0x24
+  800fba:	68 88 3d 80 00       	push   $0x803d88
+  800fbf:	e8 13 f3 ff ff       	call   8002d7 <_panic>
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	50                   	push   %eax
+  800fc8:	6a 05                	push   $0x5
+  800fca:	68 6b 3d 80 00       	push   $0x803d6b
+  800fcf:	6a 48                	push   $0x48
+  800fd1:	68 88 3d 80 00       	push   $0x803d88
+  800fd6:	e8 fc f2 ff ff       	call   8002d7 <_panic>
+
+00800fdb <sys_page_unmap>:
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	56                   	push   %esi
+  800fe0:	53                   	push   %ebx
+  800fe1:	83 ec 0c             	sub    $0xc,%esp
+  800fe4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ff4:	89 df                	mov    %ebx,%edi
+  800ff6:	89 de                	mov    %ebx,%esi
+  800ff8:	cd 30                	int    $0x30
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	7f 08                	jg     801006 <sys_page_unmap+0x2b>
+  800ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+  801006:	83 ec 0c             	sub    $0xc,%esp
+  801009:	50                   	push   %eax
+  80100a:	6a 06                	push   $0x6
+  80100c:	68 6b 3d 80 00       	push   $0x803d6b
+  801011:	6a 24                	push   $0x24
+  801013:	68 88 3d 80 00       	push   $0x803d88
+  801018:	e8 ba f2 ff ff       	call   8002d7 <_panic>
+
+0080101d <sys_fork>:
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+  801023:	ba 00 00 00 00       	mov    $0x0,%edx
+  801028:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80102d:	89 d1                	mov    %edx,%ecx
+  80102f:	89 d3                	mov    %edx,%ebx
+  801031:	89 d7                	mov    %edx,%edi
+  801033:	89 d6                	mov    %edx,%esi
+  801035:	cd 30                	int    $0x30
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <sys_env_set_status>:
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	57                   	push   %edi
+  801040:	56                   	push   %esi
+  801041:	53                   	push   %ebx
+  801042:	83 ec 0c             	sub    $0xc,%esp
+  801045:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801050:	b8 08 00 00 00       	mov    $0x8,%eax
+  801055:	89 df                	mov    %ebx,%edi
+  801057:	89 de                	mov    %ebx,%esi
+  801059:	cd 30                	int    $0x30
+  80105b:	85 c0                	test   %eax,%eax
+  80105d:	7f 08                	jg     801067 <sys_env_set_status+0x2b>
+  80105f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801062:	5b                   	pop    %ebx
+  801063:	5e                   	pop    %esi
+  801064:	5f                   	pop    %edi
+  801065:	5d                   	pop    %ebp
+  801066:	c3                   	ret
+  801067:	83 ec 0c             	sub    $0xc,%esp
+  80106a:	50                   	push   %eax
+  80106b:	6a 08                	push   $0x8
+  80106d:	68 6b 3d 80 00       	push   $0x803d6b
+  801072:	6a 24                	push   $0x24
+  801074:	68 88 3d 80 00       	push   $0x803d88
+  801079:	e8 59 f2 ff ff       	call   8002d7 <_panic>
+
+0080107e <sys_env_set_trapframe>:
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 09 00 00 00       	mov    $0x9,%eax
+  801097:	89 df                	mov    %ebx,%edi
+  801099:	89 de                	mov    %ebx,%esi
+  80109b:	cd 30                	int    $0x30
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	7f 08                	jg     8010a9 <sys_env_set_trapframe+0x2b>
+  8010a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a4:	5b                   	pop    %ebx
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5f                   	pop    %edi
+  8010a7:	5d                   	pop    %ebp
+  8010a8:	c3                   	ret
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 09                	push   $0x9
+  8010af:	68 6b 3d 80 00       	push   $0x803d6b
+  8010b4:	6a 24                	push   $0x24
+  8010b6:	68 88 3d 80 00       	push   $0x803d88
+  8010bb:	e8 17 f2 ff ff       	call   8002d7 <_panic>
+
+008010c0 <sys_env_set_cow>:
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	83 ec 0c             	sub    $0xc,%esp
+  8010c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8010d9:	89 df                	mov    %ebx,%edi
+  8010db:	89 de                	mov    %ebx,%esi
+  8010dd:	cd 30                	int    $0x30
+  8010df:	85 c0                	test   %eax,%eax
+  8010e1:	7f 08                	jg     8010eb <sys_env_set_cow+0x2b>
+  8010e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5f                   	pop    %edi
+  8010e9:	5d                   	pop    %ebp
+  8010ea:	c3                   	ret
+  8010eb:	83 ec 0c             	sub    $0xc,%esp
+  8010ee:	50                   	push   %eax
+  8010ef:	6a 20                	push   $0x20
+  8010f1:	68 6b 3d 80 00       	push   $0x803d6b
+  8010f6:	6a 24                	push   $0x24
+  8010f8:	68 88 3d 80 00       	push   $0x803d88
+  8010fd:	e8 d5 f1 ff ff       	call   8002d7 <_panic>
+
+00801102 <sys_env_service>:
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+  801108:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80110d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801110:	b8 21 00 00 00       	mov    $0x21,%eax
+  801115:	89 cb                	mov    %ecx,%ebx
+  801117:	89 cf                	mov    %ecx,%edi
+  801119:	89 ce                	mov    %ecx,%esi
+  80111b:	cd 30                	int    $0x30
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+
+00801122 <sys_env_set_pgfault_upcall>:
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+  80112b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801136:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80113b:	89 df                	mov    %ebx,%edi
+  80113d:	89 de                	mov    %ebx,%esi
+  80113f:	cd 30                	int    $0x30
+  801141:	85 c0                	test   %eax,%eax
+  801143:	7f 08                	jg     80114d <sys_env_set_pgfault_upcall+0x2b>
+  801145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	50                   	push   %eax
+  801151:	6a 0a                	push   $0xa
+  801153:	68 6b 3d 80 00       	push   $0x803d6b
+  801158:	6a 24                	push   $0x24
+  80115a:	68 88 3d 80 00       	push   $0x803d88
+  80115f:	e8 73 f1 ff ff       	call   8002d7 <_panic>
+
+00801164 <sys_ipc_try_send>:
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801171:	74 27                	je     80119a <sys_ipc_try_send+0x36>
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80117e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801181:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801184:	6a 00                	push   $0x0
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	8d 35 91 11 80 00    	lea    0x801191,%esi
+  80118f:	0f 34                	sysenter
+  801191:	5d                   	pop    %ebp
+  801192:	83 c4 04             	add    $0x4,%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+  80119a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80119f:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b0:	cd 30                	int    $0x30
+  8011b2:	eb e1                	jmp    801195 <sys_ipc_try_send+0x31>
+
+008011b4 <sys_ipc_recv>:
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+  8011bd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011c4:	74 32                	je     8011f8 <sys_ipc_recv+0x44>
+  8011c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d3:	89 cb                	mov    %ecx,%ebx
+  8011d5:	89 cf                	mov    %ecx,%edi
+  8011d7:	6a 00                	push   $0x0
+  8011d9:	55                   	push   %ebp
+  8011da:	89 e5                	mov    %esp,%ebp
+  8011dc:	8d 35 e4 11 80 00    	lea    0x8011e4,%esi
+  8011e2:	0f 34                	sysenter
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	83 c4 04             	add    $0x4,%esp
+  8011e8:	89 c2                	mov    %eax,%edx
+  8011ea:	85 c0                	test   %eax,%eax
+  8011ec:	7f 3c                	jg     80122a <sys_ipc_recv+0x76>
+  8011ee:	89 d0                	mov    %edx,%eax
+  8011f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f3:	5b                   	pop    %ebx
+  8011f4:	5e                   	pop    %esi
+  8011f5:	5f                   	pop    %edi
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+  8011f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801202:	8b 55 08             	mov    0x8(%ebp),%edx
+  801205:	89 cb                	mov    %ecx,%ebx
+  801207:	89 cf                	mov    %ecx,%edi
+  801209:	89 ce                	mov    %ecx,%esi
+  80120b:	cd 30                	int    $0x30
+  80120d:	89 c2                	mov    %eax,%edx
+  80120f:	85 c0                	test   %eax,%eax
+  801211:	7e db                	jle    8011ee <sys_ipc_recv+0x3a>
+  801213:	83 ec 0c             	sub    $0xc,%esp
+  801216:	50                   	push   %eax
+  801217:	6a 0d                	push   $0xd
+  801219:	68 6b 3d 80 00       	push   $0x803d6b
+  80121e:	6a 24                	push   $0x24
+  801220:	68 88 3d 80 00       	push   $0x803d88
+  801225:	e8 ad f0 ff ff       	call   8002d7 <_panic>
+  80122a:	83 ec 0c             	sub    $0xc,%esp
+  80122d:	50                   	push   %eax
+  80122e:	6a 0d                	push   $0xd
+  801230:	68 6b 3d 80 00       	push   $0x803d6b
+  801235:	6a 48                	push   $0x48
+  801237:	68 88 3d 80 00       	push   $0x803d88
+  80123c:	e8 96 f0 ff ff       	call   8002d7 <_panic>
+
+00801241 <sys_ipc_send>:
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+  801247:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80124e:	74 27                	je     801277 <sys_ipc_send+0x36>
+  801250:	8b 55 08             	mov    0x8(%ebp),%edx
+  801253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801256:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80125b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801261:	6a 00                	push   $0x0
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	8d 35 6e 12 80 00    	lea    0x80126e,%esi
+  80126c:	0f 34                	sysenter
+  80126e:	5d                   	pop    %ebp
+  80126f:	83 c4 04             	add    $0x4,%esp
+  801272:	5b                   	pop    %ebx
+  801273:	5e                   	pop    %esi
+  801274:	5f                   	pop    %edi
+  801275:	5d                   	pop    %ebp
+  801276:	c3                   	ret
+  801277:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80127c:	be 00 00 00 00       	mov    $0x0,%esi
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80128a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80128d:	cd 30                	int    $0x30
+  80128f:	eb e1                	jmp    801272 <sys_ipc_send+0x31>
+
+00801291 <sys_ipc_call>:
+  801291:	55                   	push   %ebp
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	57                   	push   %edi
+  801295:	56                   	push   %esi
+  801296:	53                   	push   %ebx
+  801297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012ab:	cd 30                	int    $0x30
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5f                   	pop    %edi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+
+008012b2 <sys_ipc_reply_recv>:
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	57                   	push   %edi
+  8012b6:	56                   	push   %esi
+  8012b7:	53                   	push   %ebx
+  8012b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012be:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012cc:	cd 30                	int    $0x30
+  8012ce:	5b                   	pop    %ebx
+  8012cf:	5e                   	pop    %esi
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+
+008012d3 <sys_time_msec>:
+  8012d3:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	75 06                	jne    8012e2 <sys_time_msec+0xf>
+  8012dc:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8012e1:	c3                   	ret
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	57                   	push   %edi
+  8012e6:	56                   	push   %esi
+  8012e7:	53                   	push   %ebx
+  8012e8:	83 ec 0c             	sub    $0xc,%esp
+  8012eb:	0f 31                	rdtsc
+  8012ed:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8012f3:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8012f9:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8012ff:	29 c8                	sub    %ecx,%eax
+  801301:	19 da                	sbb    %ebx,%edx
+  801303:	bf 00 00 00 00       	mov    $0x0,%edi
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	52                   	push   %edx
+  80130b:	50                   	push   %eax
+  80130c:	e8 1f 25 00 00       	call   803830 <__udivdi3>
+  801311:	83 c4 10             	add    $0x10,%esp
+  801314:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801317:	5b                   	pop    %ebx
+  801318:	5e                   	pop    %esi
+  801319:	5f                   	pop    %edi
+  80131a:	5d                   	pop    %ebp
+  80131b:	c3                   	ret
+
+0080131c <sys_env_swap>:
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	57                   	push   %edi
+  801320:	56                   	push   %esi
+  801321:	53                   	push   %ebx
+  801322:	83 ec 0c             	sub    $0xc,%esp
+  801325:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801332:	89 cb                	mov    %ecx,%ebx
+  801334:	89 cf                	mov    %ecx,%edi
+  801336:	89 ce                	mov    %ecx,%esi
+  801338:	cd 30                	int    $0x30
+  80133a:	85 c0                	test   %eax,%eax
+  80133c:	7f 08                	jg     801346 <sys_env_swap+0x2a>
+  80133e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801341:	5b                   	pop    %ebx
+  801342:	5e                   	pop    %esi
+  801343:	5f                   	pop    %edi
+  801344:	5d                   	pop    %ebp
+  801345:	c3                   	ret
+  801346:	83 ec 0c             	sub    $0xc,%esp
+  801349:	50                   	push   %eax
+  80134a:	6a 12                	push   $0x12
+  80134c:	68 6b 3d 80 00       	push   $0x803d6b
+  801351:	6a 24                	push   $0x24
+  801353:	68 88 3d 80 00       	push   $0x803d88
+  801358:	e8 7a ef ff ff       	call   8002d7 <_panic>
+
+0080135d <sys_net_try_send>:
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	57                   	push   %edi
+  801361:	56                   	push   %esi
+  801362:	53                   	push   %ebx
+  801363:	83 ec 0c             	sub    $0xc,%esp
+  801366:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801371:	b8 13 00 00 00       	mov    $0x13,%eax
+  801376:	89 df                	mov    %ebx,%edi
+  801378:	89 de                	mov    %ebx,%esi
+  80137a:	cd 30                	int    $0x30
+  80137c:	85 c0                	test   %eax,%eax
+  80137e:	7f 08                	jg     801388 <sys_net_try_send+0x2b>
+  801380:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801383:	5b                   	pop    %ebx
+  801384:	5e                   	pop    %esi
+  801385:	5f                   	pop    %edi
+  801386:	5d                   	pop    %ebp
+  801387:	c3                   	ret
+  801388:	83 ec 0c             	sub    $0xc,%esp
+  80138b:	50                   	push   %eax
+  80138c:	6a 13                	push   $0x13
+  80138e:	68 6b 3d 80 00       	push   $0x803d6b
+  801393:	6a 24                	push   $0x24
+  801395:	68 88 3d 80 00       	push   $0x803d88
+  80139a:	e8 38 ef ff ff       	call   8002d7 <_panic>
+
+0080139f <sys_net_try_receive>:
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	57                   	push   %edi
+  8013a3:	56                   	push   %esi
+  8013a4:	53                   	push   %ebx
+  8013a5:	83 ec 0c             	sub    $0xc,%esp
+  8013a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013b8:	89 df                	mov    %ebx,%edi
+  8013ba:	89 de                	mov    %ebx,%esi
+  8013bc:	cd 30                	int    $0x30
+  8013be:	85 c0                	test   %eax,%eax
+  8013c0:	7f 08                	jg     8013ca <sys_net_try_receive+0x2b>
+  8013c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c5:	5b                   	pop    %ebx
+  8013c6:	5e                   	pop    %esi
+  8013c7:	5f                   	pop    %edi
+  8013c8:	5d                   	pop    %ebp
+  8013c9:	c3                   	ret
+  8013ca:	83 ec 0c             	sub    $0xc,%esp
+  8013cd:	50                   	push   %eax
+  8013ce:	6a 14                	push   $0x14
+  8013d0:	68 6b 3d 80 00       	push   $0x803d6b
+  8013d5:	6a 24                	push   $0x24
+  8013d7:	68 88 3d 80 00       	push   $0x803d88
+  8013dc:	e8 f6 ee ff ff       	call   8002d7 <_panic>
+
+008013e1 <sys_net_recv_page>:
+  8013e1:	55                   	push   %ebp
+  8013e2:	89 e5                	mov    %esp,%ebp
+  8013e4:	57                   	push   %edi
+  8013e5:	56                   	push   %esi
+  8013e6:	53                   	push   %ebx
+  8013e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ef:	b8 27 00 00 00       	mov    $0x27,%eax
+  8013f4:	89 cb                	mov    %ecx,%ebx
+  8013f6:	89 cf                	mov    %ecx,%edi
+  8013f8:	89 ce                	mov    %ecx,%esi
+  8013fa:	cd 30                	int    $0x30
+  8013fc:	5b                   	pop    %ebx
+  8013fd:	5e                   	pop    %esi
+  8013fe:	5f                   	pop    %edi
+  8013ff:	5d                   	pop    %ebp
+  801400:	c3                   	ret
+
+00801401 <sys_net_wait>:
+  801401:	55                   	push   %ebp
+  801402:	89 e5                	mov    %esp,%ebp
+  801404:	57                   	push   %edi
+  801405:	56                   	push   %esi
+  801406:	53                   	push   %ebx
+  801407:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140c:	b8 26 00 00 00       	mov    $0x26,%eax
+  801411:	89 d1                	mov    %edx,%ecx
+  801413:	89 d3                	mov    %edx,%ebx
+  801415:	89 d7                	mov    %edx,%edi
+  801417:	89 d6                	mov    %edx,%esi
+  801419:	cd 30                	int    $0x30
+  80141b:	5b                   	pop    %ebx
+  80141c:	5e                   	pop    %esi
+  80141d:	5f                   	pop    %edi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+
+00801420 <sys_get_mac>:
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	57                   	push   %edi
+  801424:	56                   	push   %esi
+  801425:	53                   	push   %ebx
+  801426:	83 ec 0c             	sub    $0xc,%esp
+  801429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801434:	b8 15 00 00 00       	mov    $0x15,%eax
+  801439:	89 df                	mov    %ebx,%edi
+  80143b:	89 de                	mov    %ebx,%esi
+  80143d:	cd 30                	int    $0x30
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	7f 08                	jg     80144b <sys_get_mac+0x2b>
+  801443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801446:	5b                   	pop    %ebx
+  801447:	5e                   	pop    %esi
+  801448:	5f                   	pop    %edi
+  801449:	5d                   	pop    %ebp
+  80144a:	c3                   	ret
+  80144b:	83 ec 0c             	sub    $0xc,%esp
+  80144e:	50                   	push   %eax
+  80144f:	6a 15                	push   $0x15
+  801451:	68 6b 3d 80 00       	push   $0x803d6b
+  801456:	6a 24                	push   $0x24
+  801458:	68 88 3d 80 00       	push   $0x803d88
+  80145d:	e8 75 ee ff ff       	call   8002d7 <_panic>
+
+00801462 <sys_env_lease>:
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	57                   	push   %edi
+  801466:	56                   	push   %esi
+  801467:	53                   	push   %ebx
+  801468:	83 ec 0c             	sub    $0xc,%esp
+  80146b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801470:	8b 55 08             	mov    0x8(%ebp),%edx
+  801473:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801476:	b8 16 00 00 00       	mov    $0x16,%eax
+  80147b:	89 df                	mov    %ebx,%edi
+  80147d:	89 de                	mov    %ebx,%esi
+  80147f:	cd 30                	int    $0x30
+  801481:	85 c0                	test   %eax,%eax
+  801483:	7f 08                	jg     80148d <sys_env_lease+0x2b>
+  801485:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801488:	5b                   	pop    %ebx
+  801489:	5e                   	pop    %esi
+  80148a:	5f                   	pop    %edi
+  80148b:	5d                   	pop    %ebp
+  80148c:	c3                   	ret
+  80148d:	83 ec 0c             	sub    $0xc,%esp
+  801490:	50                   	push   %eax
+  801491:	6a 16                	push   $0x16
+  801493:	68 6b 3d 80 00       	push   $0x803d6b
+  801498:	6a 24                	push   $0x24
+  80149a:	68 88 3d 80 00       	push   $0x803d88
+  80149f:	e8 33 ee ff ff       	call   8002d7 <_panic>
+
+008014a4 <sys_copy_mem>:
+  8014a4:	55                   	push   %ebp
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	57                   	push   %edi
+  8014a8:	56                   	push   %esi
+  8014a9:	53                   	push   %ebx
+  8014aa:	83 ec 0c             	sub    $0xc,%esp
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b3:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014bb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014be:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014c1:	cd 30                	int    $0x30
+  8014c3:	85 c0                	test   %eax,%eax
+  8014c5:	7f 08                	jg     8014cf <sys_copy_mem+0x2b>
+  8014c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ca:	5b                   	pop    %ebx
+  8014cb:	5e                   	pop    %esi
+  8014cc:	5f                   	pop    %edi
+  8014cd:	5d                   	pop    %ebp
+  8014ce:	c3                   	ret
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	50                   	push   %eax
+  8014d3:	6a 17                	push   $0x17
+  8014d5:	68 6b 3d 80 00       	push   $0x803d6b
+  8014da:	6a 24                	push   $0x24
+  8014dc:	68 88 3d 80 00       	push   $0x803d88
+  8014e1:	e8 f1 ed ff ff       	call   8002d7 <_panic>
+
+008014e6 <sys_get_perms>:
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	57                   	push   %edi
+  8014ea:	56                   	push   %esi
+  8014eb:	53                   	push   %ebx
+  8014ec:	83 ec 0c             	sub    $0xc,%esp
+  8014ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fa:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801502:	89 f7                	mov    %esi,%edi
+  801504:	cd 30                	int    $0x30
+  801506:	85 c0                	test   %eax,%eax
+  801508:	7f 08                	jg     801512 <sys_get_perms+0x2c>
+  80150a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150d:	5b                   	pop    %ebx
+  80150e:	5e                   	pop    %esi
+  80150f:	5f                   	pop    %edi
+  801510:	5d                   	pop    %ebp
+  801511:	c3                   	ret
+  801512:	83 ec 0c             	sub    $0xc,%esp
+  801515:	50                   	push   %eax
+  801516:	6a 18                	push   $0x18
+  801518:	68 6b 3d 80 00       	push   $0x803d6b
+  80151d:	6a 24                	push   $0x24
+  80151f:	68 88 3d 80 00       	push   $0x803d88
+  801524:	e8 ae ed ff ff       	call   8002d7 <_panic>
+
+00801529 <sys_env_unsuspend>:
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	57                   	push   %edi
+  80152d:	56                   	push   %esi
+  80152e:	53                   	push   %ebx
+  80152f:	83 ec 0c             	sub    $0xc,%esp
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801542:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801545:	89 f7                	mov    %esi,%edi
+  801547:	cd 30                	int    $0x30
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	7f 08                	jg     801555 <sys_env_unsuspend+0x2c>
+  80154d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801550:	5b                   	pop    %ebx
+  801551:	5e                   	pop    %esi
+  801552:	5f                   	pop    %edi
+  801553:	5d                   	pop    %ebp
+  801554:	c3                   	ret
+  801555:	83 ec 0c             	sub    $0xc,%esp
+  801558:	50                   	push   %eax
+  801559:	6a 19                	push   $0x19
+  80155b:	68 6b 3d 80 00       	push   $0x803d6b
+  801560:	6a 24                	push   $0x24
+  801562:	68 88 3d 80 00       	push   $0x803d88
+  801567:	e8 6b ed ff ff       	call   8002d7 <_panic>
+
+0080156c <sys_migrate>:
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+  801572:	83 ec 0c             	sub    $0xc,%esp
+  801575:	ba 04 90 80 00       	mov    $0x809004,%edx
+  80157a:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801580:	76 11                	jbe    801593 <sys_migrate+0x27>
+  801582:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801587:	0f b6 08             	movzbl (%eax),%ecx
+  80158a:	05 00 10 00 00       	add    $0x1000,%eax
+  80158f:	39 d0                	cmp    %edx,%eax
+  801591:	72 f4                	jb     801587 <sys_migrate+0x1b>
+  801593:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801598:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015a0:	89 cb                	mov    %ecx,%ebx
+  8015a2:	89 cf                	mov    %ecx,%edi
+  8015a4:	89 ce                	mov    %ecx,%esi
+  8015a6:	cd 30                	int    $0x30
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	7f 08                	jg     8015b4 <sys_migrate+0x48>
+  8015ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+  8015b4:	83 ec 0c             	sub    $0xc,%esp
+  8015b7:	50                   	push   %eax
+  8015b8:	6a 1a                	push   $0x1a
+  8015ba:	68 6b 3d 80 00       	push   $0x803d6b
+  8015bf:	6a 24                	push   $0x24
+  8015c1:	68 88 3d 80 00       	push   $0x803d88
+  8015c6:	e8 0c ed ff ff       	call   8002d7 <_panic>
+
+008015cb <sys_lease_complete>:
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+  8015d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015de:	89 d1                	mov    %edx,%ecx
+  8015e0:	89 d3                	mov    %edx,%ebx
+  8015e2:	89 d7                	mov    %edx,%edi
+  8015e4:	89 d6                	mov    %edx,%esi
+  8015e6:	cd 30                	int    $0x30
+  8015e8:	85 c0                	test   %eax,%eax
+  8015ea:	7f 08                	jg     8015f4 <sys_lease_complete+0x29>
+  8015ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ef:	5b                   	pop    %ebx
+  8015f0:	5e                   	pop    %esi
+  8015f1:	5f                   	pop    %edi
+  8015f2:	5d                   	pop    %ebp
+  8015f3:	c3                   	ret
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+  8015f7:	50                   	push   %eax
+  8015f8:	6a 1b                	push   $0x1b
+  8015fa:	68 6b 3d 80 00       	push   $0x803d6b
+  8015ff:	6a 24                	push   $0x24
+  801601:	68 88 3d 80 00       	push   $0x803d88
+  801606:	e8 cc ec ff ff       	call   8002d7 <_panic>
+
+0080160b <sys_env_set_thisenv>:
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	57                   	push   %edi
+  80160f:	56                   	push   %esi
+  801610:	53                   	push   %ebx
+  801611:	83 ec 0c             	sub    $0xc,%esp
+  801614:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801619:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801624:	89 df                	mov    %ebx,%edi
+  801626:	89 de                	mov    %ebx,%esi
+  801628:	cd 30                	int    $0x30
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	7f 08                	jg     801636 <sys_env_set_thisenv+0x2b>
+  80162e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801631:	5b                   	pop    %ebx
+  801632:	5e                   	pop    %esi
+  801633:	5f                   	pop    %edi
+  801634:	5d                   	pop    %ebp
+  801635:	c3                   	ret
+  801636:	83 ec 0c             	sub    $0xc,%esp
+  801639:	50                   	push   %eax
+  80163a:	6a 1c                	push   $0x1c
+  80163c:	68 6b 3d 80 00       	push   $0x803d6b
+  801641:	6a 24                	push   $0x24
+  801643:	68 88 3d 80 00       	push   $0x803d88
+  801648:	e8 8a ec ff ff       	call   8002d7 <_panic>
+
+0080164d <sys_env_set_sched>:
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	57                   	push   %edi
+  801651:	56                   	push   %esi
+  801652:	53                   	push   %ebx
+  801653:	83 ec 0c             	sub    $0xc,%esp
+  801656:	be 00 00 00 00       	mov    $0x0,%esi
+  80165b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801661:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801666:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801669:	89 f7                	mov    %esi,%edi
+  80166b:	cd 30                	int    $0x30
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	7f 08                	jg     801679 <sys_env_set_sched+0x2c>
+  801671:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5f                   	pop    %edi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+  801679:	83 ec 0c             	sub    $0xc,%esp
+  80167c:	50                   	push   %eax
+  80167d:	6a 1d                	push   $0x1d
+  80167f:	68 6b 3d 80 00       	push   $0x803d6b
+  801684:	6a 24                	push   $0x24
+  801686:	68 88 3d 80 00       	push   $0x803d88
+  80168b:	e8 47 ec ff ff       	call   8002d7 <_panic>
+
+00801690 <sys_batch>:
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	57                   	push   %edi
+  801694:	56                   	push   %esi
+  801695:	53                   	push   %ebx
+  801696:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8016a6:	89 df                	mov    %ebx,%edi
+  8016a8:	89 de                	mov    %ebx,%esi
+  8016aa:	cd 30                	int    $0x30
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5f                   	pop    %edi
+  8016af:	5d                   	pop    %ebp
+  8016b0:	c3                   	ret
+
+008016b1 <sys_env_stats>:
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	57                   	push   %edi
+  8016b5:	56                   	push   %esi
+  8016b6:	53                   	push   %ebx
+  8016b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c2:	b8 23 00 00 00       	mov    $0x23,%eax
+  8016c7:	89 df                	mov    %ebx,%edi
+  8016c9:	89 de                	mov    %ebx,%esi
+  8016cb:	cd 30                	int    $0x30
+  8016cd:	5b                   	pop    %ebx
+  8016ce:	5e                   	pop    %esi
+  8016cf:	5f                   	pop    %edi
+  8016d0:	5d                   	pop    %ebp
+  8016d1:	c3                   	ret
+
+008016d2 <sys_trace>:
+  8016d2:	55                   	push   %ebp
+  8016d3:	89 e5                	mov    %esp,%ebp
+  8016d5:	57                   	push   %edi
+  8016d6:	56                   	push   %esi
+  8016d7:	53                   	push   %ebx
+  8016d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e0:	b8 24 00 00 00       	mov    $0x24,%eax
+  8016e5:	89 cb                	mov    %ecx,%ebx
+  8016e7:	89 cf                	mov    %ecx,%edi
+  8016e9:	89 ce                	mov    %ecx,%esi
+  8016eb:	cd 30                	int    $0x30
+  8016ed:	5b                   	pop    %ebx
+  8016ee:	5e                   	pop    %esi
+  8016ef:	5f                   	pop    %edi
+  8016f0:	5d                   	pop    %ebp
+  8016f1:	c3                   	ret
+
+008016f2 <sys_env_set_pager>:
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	57                   	push   %edi
+  8016f6:	56                   	push   %esi
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 0c             	sub    $0xc,%esp
+  8016fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801700:	8b 55 08             	mov    0x8(%ebp),%edx
+  801703:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801706:	b8 25 00 00 00       	mov    $0x25,%eax
+  80170b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170e:	89 f7                	mov    %esi,%edi
+  801710:	cd 30                	int    $0x30
+  801712:	85 c0                	test   %eax,%eax
+  801714:	7f 08                	jg     80171e <sys_env_set_pager+0x2c>
+  801716:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801719:	5b                   	pop    %ebx
+  80171a:	5e                   	pop    %esi
+  80171b:	5f                   	pop    %edi
+  80171c:	5d                   	pop    %ebp
+  80171d:	c3                   	ret
+  80171e:	83 ec 0c             	sub    $0xc,%esp
+  801721:	50                   	push   %eax
+  801722:	6a 25                	push   $0x25
+  801724:	68 6b 3d 80 00       	push   $0x803d6b
+  801729:	6a 24                	push   $0x24
+  80172b:	68 88 3d 80 00       	push   $0x803d88
+  801730:	e8 a2 eb ff ff       	call   8002d7 <_panic>
+
+00801735 <sys_pager_retire>:
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	57                   	push   %edi
+  801739:	56                   	push   %esi
+  80173a:	53                   	push   %ebx
+  80173b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801740:	8b 55 08             	mov    0x8(%ebp),%edx
+  801743:	b8 28 00 00 00       	mov    $0x28,%eax
+  801748:	89 cb                	mov    %ecx,%ebx
+  80174a:	89 cf                	mov    %ecx,%edi
+  80174c:	89 ce                	mov    %ecx,%esi
+  80174e:	cd 30                	int    $0x30
+  801750:	5b                   	pop    %ebx
+  801751:	5e                   	pop    %esi
+  801752:	5f                   	pop    %edi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+
+00801755 <sys_prof>:
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	57                   	push   %edi
+  801759:	56                   	push   %esi
+  80175a:	53                   	push   %ebx
+  80175b:	be 00 00 00 00       	mov    $0x0,%esi
+  801760:	8b 55 08             	mov    0x8(%ebp),%edx
+  801763:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801766:	b8 22 00 00 00       	mov    $0x22,%eax
+  80176b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80176e:	89 f7                	mov    %esi,%edi
+  801770:	cd 30                	int    $0x30
+  801772:	5b                   	pop    %ebx
+  801773:	5e                   	pop    %esi
+  801774:	5f                   	pop    %edi
+  801775:	5d                   	pop    %ebp
+  801776:	c3                   	ret
+
+00801777 <dupq_flush>:
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	53                   	push   %ebx
+  80177b:	83 ec 0c             	sub    $0xc,%esp
+  80177e:	8b 1d 04 60 80 00    	mov    0x806004,%ebx
+  801784:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80178b:	00 00 00 
+  80178e:	53                   	push   %ebx
+  80178f:	68 00 00 40 00       	push   $0x400000
+  801794:	e8 f7 fe ff ff       	call   801690 <sys_batch>
+  801799:	83 c4 10             	add    $0x10,%esp
+  80179c:	85 c0                	test   %eax,%eax
+  80179e:	78 14                	js     8017b4 <dupq_flush+0x3d>
+  8017a0:	39 c3                	cmp    %eax,%ebx
+  8017a2:	7e 0b                	jle    8017af <dupq_flush+0x38>
+  8017a4:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8017a7:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8017ad:	eb 05                	jmp    8017b4 <dupq_flush+0x3d>
+  8017af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b7:	c9                   	leave
+  8017b8:	c3                   	ret
+
+008017b9 <pgfault>:
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+  8017bc:	56                   	push   %esi
+  8017bd:	53                   	push   %ebx
+  8017be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c1:	8b 30                	mov    (%eax),%esi
+  8017c3:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8017c7:	0f 84 83 00 00 00    	je     801850 <pgfault+0x97>
+  8017cd:	89 f0                	mov    %esi,%eax
+  8017cf:	c1 e8 0c             	shr    $0xc,%eax
+  8017d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017d9:	f6 c4 08             	test   $0x8,%ah
+  8017dc:	0f 84 80 00 00 00    	je     801862 <pgfault+0xa9>
+  8017e2:	e8 b8 f6 ff ff       	call   800e9f <sys_getenvid>
+  8017e7:	89 c3                	mov    %eax,%ebx
+  8017e9:	83 ec 04             	sub    $0x4,%esp
+  8017ec:	6a 07                	push   $0x7
+  8017ee:	68 00 f0 7f 00       	push   $0x7ff000
+  8017f3:	50                   	push   %eax
+  8017f4:	e8 10 f7 ff ff       	call   800f09 <sys_page_alloc>
+  8017f9:	83 c4 10             	add    $0x10,%esp
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	78 74                	js     801874 <pgfault+0xbb>
+  801800:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801806:	83 ec 04             	sub    $0x4,%esp
+  801809:	68 00 10 00 00       	push   $0x1000
+  80180e:	56                   	push   %esi
+  80180f:	68 00 f0 7f 00       	push   $0x7ff000
+  801814:	e8 40 f4 ff ff       	call   800c59 <memmove>
+  801819:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801820:	56                   	push   %esi
+  801821:	53                   	push   %ebx
+  801822:	68 00 f0 7f 00       	push   $0x7ff000
+  801827:	53                   	push   %ebx
+  801828:	e8 1f f7 ff ff       	call   800f4c <sys_page_map>
+  80182d:	83 c4 20             	add    $0x20,%esp
+  801830:	85 c0                	test   %eax,%eax
+  801832:	78 54                	js     801888 <pgfault+0xcf>
+  801834:	83 ec 08             	sub    $0x8,%esp
+  801837:	68 00 f0 7f 00       	push   $0x7ff000
+  80183c:	53                   	push   %ebx
+  80183d:	e8 99 f7 ff ff       	call   800fdb <sys_page_unmap>
+  801842:	83 c4 10             	add    $0x10,%esp
+  801845:	85 c0                	test   %eax,%eax
+  801847:	78 53                	js     80189c <pgfault+0xe3>
+  801849:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184c:	5b                   	pop    %ebx
+  80184d:	5e                   	pop    %esi
+  80184e:	5d                   	pop    %ebp
+  80184f:	c3                   	ret
+  801850:	56                   	push   %esi
+  801851:	68 98 3d 80 00       	push   $0x803d98
+  801856:	6a 19                	push   $0x19
+  801858:	68 74 3e 80 00       	push   $0x803e74
+  80185d:	e8 75 ea ff ff       	call   8002d7 <_panic>
+  801862:	56                   	push   %esi
+  801863:	68 cc 3d 80 00       	push   $0x803dcc
+  801868:	6a 1e                	push   $0x1e
+  80186a:	68 74 3e 80 00       	push   $0x803e74
+  80186f:	e8 63 ea ff ff       	call   8002d7 <_panic>
+  801874:	83 ec 04             	sub    $0x4,%esp
+  801877:	68 00 3e 80 00       	push   $0x803e00
+  80187c:	6a 2e                	push   $0x2e
+  80187e:	68 74 3e 80 00       	push   $0x803e74
+  801883:	e8 4f ea ff ff       	call   8002d7 <_panic>
+  801888:	83 ec 04             	sub    $0x4,%esp
+  80188b:	68 24 3e 80 00       	push   $0x803e24
+  801890:	6a 37                	push   $0x37
+  801892:	68 74 3e 80 00       	push   $0x803e74
+  801897:	e8 3b ea ff ff       	call   8002d7 <_panic>
+  80189c:	83 ec 04             	sub    $0x4,%esp
+  80189f:	68 50 3e 80 00       	push   $0x803e50
+  8018a4:	6a 3c                	push   $0x3c
+  8018a6:	68 74 3e 80 00       	push   $0x803e74
+  8018ab:	e8 27 ea ff ff       	call   8002d7 <_panic>
+
+008018b0 <dupq_begin>:
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	83 ec 0c             	sub    $0xc,%esp
+  8018b6:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8018bd:	00 00 00 
+  8018c0:	6a 07                	push   $0x7
+  8018c2:	68 00 00 40 00       	push   $0x400000
+  8018c7:	6a 00                	push   $0x0
+  8018c9:	e8 3b f6 ff ff       	call   800f09 <sys_page_alloc>
+  8018ce:	c9                   	leave
+  8018cf:	c3                   	ret
+
+008018d0 <dupq_map>:
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	83 ec 08             	sub    $0x8,%esp
+  8018d6:	81 3d 04 60 80 00 92 	cmpl   $0x92,0x806004
+  8018dd:	00 00 00 
+  8018e0:	74 46                	je     801928 <dupq_map+0x58>
+  8018e2:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  8018e8:	8d 42 01             	lea    0x1(%edx),%eax
+  8018eb:	a3 04 60 80 00       	mov    %eax,0x806004
+  8018f0:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8018f3:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  8018f9:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801900:	00 00 00 
+  801903:	8b 55 08             	mov    0x8(%ebp),%edx
+  801906:	89 50 04             	mov    %edx,0x4(%eax)
+  801909:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80190c:	c1 e2 0c             	shl    $0xc,%edx
+  80190f:	89 50 08             	mov    %edx,0x8(%eax)
+  801912:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801915:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801918:	89 50 10             	mov    %edx,0x10(%eax)
+  80191b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80191e:	89 50 14             	mov    %edx,0x14(%eax)
+  801921:	b8 00 00 00 00       	mov    $0x0,%eax
+  801926:	c9                   	leave
+  801927:	c3                   	ret
+  801928:	e8 4a fe ff ff       	call   801777 <dupq_flush>
+  80192d:	85 c0                	test   %eax,%eax
+  80192f:	79 b1                	jns    8018e2 <dupq_map+0x12>
+  801931:	eb f3                	jmp    801926 <dupq_map+0x56>
+
+00801933 <dupq_end>:
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+  801936:	53                   	push   %ebx
+  801937:	83 ec 04             	sub    $0x4,%esp
+  80193a:	e8 38 fe ff ff       	call   801777 <dupq_flush>
+  80193f:	89 c3                	mov    %eax,%ebx
+  801941:	83 ec 08             	sub    $0x8,%esp
+  801944:	68 00 00 40 00       	push   $0x400000
+  801949:	6a 00                	push   $0x0
+  80194b:	e8 8b f6 ff ff       	call   800fdb <sys_page_unmap>
+  801950:	89 d8                	mov    %ebx,%eax
+  801952:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801955:	c9                   	leave
+  801956:	c3                   	ret
+
+00801957 <fork>:
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	53                   	push   %ebx
+  80195b:	83 ec 10             	sub    $0x10,%esp
+  80195e:	68 b9 17 80 00       	push   $0x8017b9
+  801963:	e8 0c 1d 00 00       	call   803674 <set_pgfault_handler>
+  801968:	83 c4 08             	add    $0x8,%esp
+  80196b:	6a 01                	push   $0x1
+  80196d:	6a 00                	push   $0x0
+  80196f:	e8 4c f7 ff ff       	call   8010c0 <sys_env_set_cow>
+  801974:	e8 a4 f6 ff ff       	call   80101d <sys_fork>
+  801979:	89 c3                	mov    %eax,%ebx
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	74 07                	je     801989 <fork+0x32>
+  801982:	89 d8                	mov    %ebx,%eax
+  801984:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801987:	c9                   	leave
+  801988:	c3                   	ret
+  801989:	e8 11 f5 ff ff       	call   800e9f <sys_getenvid>
+  80198e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801993:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801999:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80199e:	a3 18 60 80 00       	mov    %eax,0x806018
+  8019a3:	eb dd                	jmp    801982 <fork+0x2b>
+
+008019a5 <sfork>:
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	57                   	push   %edi
+  8019a9:	56                   	push   %esi
+  8019aa:	53                   	push   %ebx
+  8019ab:	83 ec 1c             	sub    $0x1c,%esp
+  8019ae:	e8 ec f4 ff ff       	call   800e9f <sys_getenvid>
+  8019b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019b6:	83 ec 0c             	sub    $0xc,%esp
+  8019b9:	68 b9 17 80 00       	push   $0x8017b9
+  8019be:	e8 b1 1c 00 00       	call   803674 <set_pgfault_handler>
+  8019c3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019c8:	cd 30                	int    $0x30
+  8019ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	0f 88 45 02 00 00    	js     801c1d <sfork+0x278>
+  8019d8:	89 c6                	mov    %eax,%esi
+  8019da:	74 17                	je     8019f3 <sfork+0x4e>
+  8019dc:	e8 cf fe ff ff       	call   8018b0 <dupq_begin>
+  8019e1:	85 c0                	test   %eax,%eax
+  8019e3:	0f 88 40 02 00 00    	js     801c29 <sfork+0x284>
+  8019e9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8019ee:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8019f1:	eb 39                	jmp    801a2c <sfork+0x87>
+  8019f3:	e8 a7 f4 ff ff       	call   800e9f <sys_getenvid>
+  8019f8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019fd:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801a03:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a08:	a3 18 60 80 00       	mov    %eax,0x806018
+  801a0d:	e9 23 01 00 00       	jmp    801b35 <sfork+0x190>
+  801a12:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a19:	a8 01                	test   $0x1,%al
+  801a1b:	75 5b                	jne    801a78 <sfork+0xd3>
+  801a1d:	83 c7 01             	add    $0x1,%edi
+  801a20:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801a26:	0f 84 40 01 00 00    	je     801b6c <sfork+0x1c7>
+  801a2c:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a33:	a8 01                	test   $0x1,%al
+  801a35:	74 db                	je     801a12 <sfork+0x6d>
+  801a37:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a3e:	a8 80                	test   $0x80,%al
+  801a40:	74 d0                	je     801a12 <sfork+0x6d>
+  801a42:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a49:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a4e:	0c 80                	or     $0x80,%al
+  801a50:	50                   	push   %eax
+  801a51:	ff 75 e4             	push   -0x1c(%ebp)
+  801a54:	89 f8                	mov    %edi,%eax
+  801a56:	c1 e0 16             	shl    $0x16,%eax
+  801a59:	c1 e8 0c             	shr    $0xc,%eax
+  801a5c:	50                   	push   %eax
+  801a5d:	ff 75 e0             	push   -0x20(%ebp)
+  801a60:	e8 6b fe ff ff       	call   8018d0 <dupq_map>
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	79 b1                	jns    801a1d <sfork+0x78>
+  801a6c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a73:	e9 bd 00 00 00       	jmp    801b35 <sfork+0x190>
+  801a78:	89 fe                	mov    %edi,%esi
+  801a7a:	c1 e6 16             	shl    $0x16,%esi
+  801a7d:	89 f0                	mov    %esi,%eax
+  801a7f:	c1 e8 0c             	shr    $0xc,%eax
+  801a82:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801a87:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801a8a:	eb 57                	jmp    801ae3 <sfork+0x13e>
+  801a8c:	e8 0e f4 ff ff       	call   800e9f <sys_getenvid>
+  801a91:	89 c7                	mov    %eax,%edi
+  801a93:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801a98:	f6 c4 04             	test   $0x4,%ah
+  801a9b:	0f 85 9f 00 00 00    	jne    801b40 <sfork+0x19b>
+  801aa1:	a9 02 08 00 00       	test   $0x802,%eax
+  801aa6:	0f 85 c5 01 00 00    	jne    801c71 <sfork+0x2cc>
+  801aac:	6a 05                	push   $0x5
+  801aae:	ff 75 e4             	push   -0x1c(%ebp)
+  801ab1:	68 fd e7 0e 00       	push   $0xee7fd
+  801ab6:	57                   	push   %edi
+  801ab7:	e8 14 fe ff ff       	call   8018d0 <dupq_map>
+  801abc:	83 c4 10             	add    $0x10,%esp
+  801abf:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801ac5:	0f 84 91 00 00 00    	je     801b5c <sfork+0x1b7>
+  801acb:	89 f0                	mov    %esi,%eax
+  801acd:	09 d8                	or     %ebx,%eax
+  801acf:	c1 e8 0c             	shr    $0xc,%eax
+  801ad2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ad8:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801add:	0f 84 81 00 00 00    	je     801b64 <sfork+0x1bf>
+  801ae3:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801ae8:	74 a2                	je     801a8c <sfork+0xe7>
+  801aea:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801af1:	f6 c2 01             	test   $0x1,%dl
+  801af4:	74 c9                	je     801abf <sfork+0x11a>
+  801af6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801afd:	f6 c6 02             	test   $0x2,%dh
+  801b00:	75 bd                	jne    801abf <sfork+0x11a>
+  801b02:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801b09:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b10:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801b16:	f7 d2                	not    %edx
+  801b18:	21 ca                	and    %ecx,%edx
+  801b1a:	52                   	push   %edx
+  801b1b:	ff 75 e4             	push   -0x1c(%ebp)
+  801b1e:	50                   	push   %eax
+  801b1f:	ff 75 e0             	push   -0x20(%ebp)
+  801b22:	e8 a9 fd ff ff       	call   8018d0 <dupq_map>
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	79 91                	jns    801abf <sfork+0x11a>
+  801b2e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3b:	5b                   	pop    %ebx
+  801b3c:	5e                   	pop    %esi
+  801b3d:	5f                   	pop    %edi
+  801b3e:	5d                   	pop    %ebp
+  801b3f:	c3                   	ret
+  801b40:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b45:	50                   	push   %eax
+  801b46:	ff 75 e4             	push   -0x1c(%ebp)
+  801b49:	68 fd e7 0e 00       	push   $0xee7fd
+  801b4e:	57                   	push   %edi
+  801b4f:	e8 7c fd ff ff       	call   8018d0 <dupq_map>
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	e9 63 ff ff ff       	jmp    801abf <sfork+0x11a>
+  801b5c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b5f:	e9 b9 fe ff ff       	jmp    801a1d <sfork+0x78>
+  801b64:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b67:	e9 b1 fe ff ff       	jmp    801a1d <sfork+0x78>
+  801b6c:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801b6f:	e8 bf fd ff ff       	call   801933 <dupq_end>
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	0f 88 b9 00 00 00    	js     801c35 <sfork+0x290>
+  801b7c:	83 ec 04             	sub    $0x4,%esp
+  801b7f:	6a 07                	push   $0x7
+  801b81:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b86:	56                   	push   %esi
+  801b87:	e8 7d f3 ff ff       	call   800f09 <sys_page_alloc>
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	0f 88 aa 00 00 00    	js     801c41 <sfork+0x29c>
+  801b97:	83 ec 0c             	sub    $0xc,%esp
+  801b9a:	6a 07                	push   $0x7
+  801b9c:	68 00 f0 7f 00       	push   $0x7ff000
+  801ba1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801ba4:	57                   	push   %edi
+  801ba5:	68 00 f0 7f ee       	push   $0xee7ff000
+  801baa:	56                   	push   %esi
+  801bab:	e8 9c f3 ff ff       	call   800f4c <sys_page_map>
+  801bb0:	83 c4 20             	add    $0x20,%esp
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	0f 88 92 00 00 00    	js     801c4d <sfork+0x2a8>
+  801bbb:	83 ec 04             	sub    $0x4,%esp
+  801bbe:	68 00 10 00 00       	push   $0x1000
+  801bc3:	68 00 f0 7f 00       	push   $0x7ff000
+  801bc8:	68 00 f0 7f ee       	push   $0xee7ff000
+  801bcd:	e8 87 f0 ff ff       	call   800c59 <memmove>
+  801bd2:	83 c4 08             	add    $0x8,%esp
+  801bd5:	68 00 f0 7f 00       	push   $0x7ff000
+  801bda:	57                   	push   %edi
+  801bdb:	e8 fb f3 ff ff       	call   800fdb <sys_page_unmap>
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	78 72                	js     801c59 <sfork+0x2b4>
+  801be7:	83 ec 08             	sub    $0x8,%esp
+  801bea:	68 ec 36 80 00       	push   $0x8036ec
+  801bef:	56                   	push   %esi
+  801bf0:	e8 2d f5 ff ff       	call   801122 <sys_env_set_pgfault_upcall>
+  801bf5:	83 c4 10             	add    $0x10,%esp
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	78 69                	js     801c65 <sfork+0x2c0>
+  801bfc:	83 ec 08             	sub    $0x8,%esp
+  801bff:	6a 02                	push   $0x2
+  801c01:	56                   	push   %esi
+  801c02:	e8 35 f4 ff ff       	call   80103c <sys_env_set_status>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c11:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801c15:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c18:	e9 18 ff ff ff       	jmp    801b35 <sfork+0x190>
+  801c1d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c24:	e9 0c ff ff ff       	jmp    801b35 <sfork+0x190>
+  801c29:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c30:	e9 00 ff ff ff       	jmp    801b35 <sfork+0x190>
+  801c35:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c3c:	e9 f4 fe ff ff       	jmp    801b35 <sfork+0x190>
+  801c41:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c48:	e9 e8 fe ff ff       	jmp    801b35 <sfork+0x190>
+  801c4d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c54:	e9 dc fe ff ff       	jmp    801b35 <sfork+0x190>
+  801c59:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c60:	e9 d0 fe ff ff       	jmp    801b35 <sfork+0x190>
+  801c65:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c6c:	e9 c4 fe ff ff       	jmp    801b35 <sfork+0x190>
+  801c71:	68 05 08 00 00       	push   $0x805
+  801c76:	ff 75 e4             	push   -0x1c(%ebp)
+  801c79:	68 fd e7 0e 00       	push   $0xee7fd
+  801c7e:	57                   	push   %edi
+  801c7f:	e8 4c fc ff ff       	call   8018d0 <dupq_map>
+  801c84:	83 c4 10             	add    $0x10,%esp
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	0f 88 30 fe ff ff    	js     801abf <sfork+0x11a>
+  801c8f:	68 05 08 00 00       	push   $0x805
+  801c94:	57                   	push   %edi
+  801c95:	68 fd e7 0e 00       	push   $0xee7fd
+  801c9a:	57                   	push   %edi
+  801c9b:	e8 30 fc ff ff       	call   8018d0 <dupq_map>
+  801ca0:	83 c4 10             	add    $0x10,%esp
+  801ca3:	e9 17 fe ff ff       	jmp    801abf <sfork+0x11a>
+
+00801ca8 <ipc_recv>:
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	56                   	push   %esi
+  801cac:	53                   	push   %ebx
+  801cad:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cb0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801cbd:	0f 44 c2             	cmove  %edx,%eax
+  801cc0:	83 ec 0c             	sub    $0xc,%esp
+  801cc3:	50                   	push   %eax
+  801cc4:	e8 eb f4 ff ff       	call   8011b4 <sys_ipc_recv>
+  801cc9:	83 c4 10             	add    $0x10,%esp
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	78 2a                	js     801cfa <ipc_recv+0x52>
+  801cd0:	a1 18 60 80 00       	mov    0x806018,%eax
+  801cd5:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801cdb:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801ce1:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801ce7:	85 f6                	test   %esi,%esi
+  801ce9:	74 02                	je     801ced <ipc_recv+0x45>
+  801ceb:	89 0e                	mov    %ecx,(%esi)
+  801ced:	85 db                	test   %ebx,%ebx
+  801cef:	74 02                	je     801cf3 <ipc_recv+0x4b>
+  801cf1:	89 13                	mov    %edx,(%ebx)
+  801cf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf6:	5b                   	pop    %ebx
+  801cf7:	5e                   	pop    %esi
+  801cf8:	5d                   	pop    %ebp
+  801cf9:	c3                   	ret
+  801cfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d04:	eb e1                	jmp    801ce7 <ipc_recv+0x3f>
+
+00801d06 <ipc_send>:
+  801d06:	55                   	push   %ebp
+  801d07:	89 e5                	mov    %esp,%ebp
+  801d09:	57                   	push   %edi
+  801d0a:	56                   	push   %esi
+  801d0b:	53                   	push   %ebx
+  801d0c:	83 ec 0c             	sub    $0xc,%esp
+  801d0f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801d12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d15:	8b 75 14             	mov    0x14(%ebp),%esi
+  801d18:	85 db                	test   %ebx,%ebx
+  801d1a:	74 1e                	je     801d3a <ipc_send+0x34>
+  801d1c:	56                   	push   %esi
+  801d1d:	53                   	push   %ebx
+  801d1e:	57                   	push   %edi
+  801d1f:	ff 75 08             	push   0x8(%ebp)
+  801d22:	e8 1a f5 ff ff       	call   801241 <sys_ipc_send>
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	74 2a                	je     801d58 <ipc_send+0x52>
+  801d2e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d31:	75 13                	jne    801d46 <ipc_send+0x40>
+  801d33:	e8 86 f1 ff ff       	call   800ebe <sys_yield>
+  801d38:	eb e2                	jmp    801d1c <ipc_send+0x16>
+  801d3a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d3f:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801d44:	eb d6                	jmp    801d1c <ipc_send+0x16>
+  801d46:	50                   	push   %eax
+  801d47:	68 80 3e 80 00       	push   $0x803e80
+  801d4c:	6a 4f                	push   $0x4f
+  801d4e:	68 c3 3e 80 00       	push   $0x803ec3
+  801d53:	e8 7f e5 ff ff       	call   8002d7 <_panic>
+  801d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5b:	5b                   	pop    %ebx
+  801d5c:	5e                   	pop    %esi
+  801d5d:	5f                   	pop    %edi
+  801d5e:	5d                   	pop    %ebp
+  801d5f:	c3                   	ret
+
+00801d60 <ipc_call>:
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	57                   	push   %edi
+  801d64:	56                   	push   %esi
+  801d65:	53                   	push   %ebx
+  801d66:	83 ec 0c             	sub    $0xc,%esp
+  801d69:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801d6d:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801d72:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801d76:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801d7a:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801d7f:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801d83:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801d87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8c:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801d90:	eb 05                	jmp    801d97 <ipc_call+0x37>
+  801d92:	e8 27 f1 ff ff       	call   800ebe <sys_yield>
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+  801d9a:	56                   	push   %esi
+  801d9b:	53                   	push   %ebx
+  801d9c:	57                   	push   %edi
+  801d9d:	ff 75 0c             	push   0xc(%ebp)
+  801da0:	ff 75 08             	push   0x8(%ebp)
+  801da3:	e8 e9 f4 ff ff       	call   801291 <sys_ipc_call>
+  801da8:	83 c4 20             	add    $0x20,%esp
+  801dab:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801dae:	74 e2                	je     801d92 <ipc_call+0x32>
+  801db0:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801db3:	74 2d                	je     801de2 <ipc_call+0x82>
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 4f                	js     801e08 <ipc_call+0xa8>
+  801db9:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801dbd:	74 10                	je     801dcf <ipc_call+0x6f>
+  801dbf:	a1 18 60 80 00       	mov    0x806018,%eax
+  801dc4:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801dca:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801dcd:	89 02                	mov    %eax,(%edx)
+  801dcf:	a1 18 60 80 00       	mov    0x806018,%eax
+  801dd4:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801dda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ddd:	5b                   	pop    %ebx
+  801dde:	5e                   	pop    %esi
+  801ddf:	5f                   	pop    %edi
+  801de0:	5d                   	pop    %ebp
+  801de1:	c3                   	ret
+  801de2:	ff 75 14             	push   0x14(%ebp)
+  801de5:	ff 75 10             	push   0x10(%ebp)
+  801de8:	ff 75 0c             	push   0xc(%ebp)
+  801deb:	ff 75 08             	push   0x8(%ebp)
+  801dee:	e8 13 ff ff ff       	call   801d06 <ipc_send>
+  801df3:	83 c4 0c             	add    $0xc,%esp
+  801df6:	ff 75 1c             	push   0x1c(%ebp)
+  801df9:	ff 75 18             	push   0x18(%ebp)
+  801dfc:	6a 00                	push   $0x0
+  801dfe:	e8 a5 fe ff ff       	call   801ca8 <ipc_recv>
+  801e03:	83 c4 10             	add    $0x10,%esp
+  801e06:	eb d2                	jmp    801dda <ipc_call+0x7a>
+  801e08:	50                   	push   %eax
+  801e09:	68 cd 3e 80 00       	push   $0x803ecd
+  801e0e:	6a 6d                	push   $0x6d
+  801e10:	68 c3 3e 80 00       	push   $0x803ec3
+  801e15:	e8 bd e4 ff ff       	call   8002d7 <_panic>
+
+00801e1a <ipc_reply_recv>:
+  801e1a:	55                   	push   %ebp
+  801e1b:	89 e5                	mov    %esp,%ebp
+  801e1d:	57                   	push   %edi
+  801e1e:	56                   	push   %esi
+  801e1f:	53                   	push   %ebx
+  801e20:	83 ec 0c             	sub    $0xc,%esp
+  801e23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e26:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801e29:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801e2c:	85 db                	test   %ebx,%ebx
+  801e2e:	0f 84 ac 00 00 00    	je     801ee0 <ipc_reply_recv+0xc6>
+  801e34:	85 f6                	test   %esi,%esi
+  801e36:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801e3b:	0f 45 c6             	cmovne %esi,%eax
+  801e3e:	83 ec 0c             	sub    $0xc,%esp
+  801e41:	50                   	push   %eax
+  801e42:	ff 75 14             	push   0x14(%ebp)
+  801e45:	53                   	push   %ebx
+  801e46:	ff 75 0c             	push   0xc(%ebp)
+  801e49:	ff 75 08             	push   0x8(%ebp)
+  801e4c:	e8 61 f4 ff ff       	call   8012b2 <sys_ipc_reply_recv>
+  801e51:	83 c4 20             	add    $0x20,%esp
+  801e54:	85 c0                	test   %eax,%eax
+  801e56:	78 3a                	js     801e92 <ipc_reply_recv+0x78>
+  801e58:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801e5c:	74 10                	je     801e6e <ipc_reply_recv+0x54>
+  801e5e:	a1 18 60 80 00       	mov    0x806018,%eax
+  801e63:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801e69:	8b 55 18             	mov    0x18(%ebp),%edx
+  801e6c:	89 02                	mov    %eax,(%edx)
+  801e6e:	85 ff                	test   %edi,%edi
+  801e70:	74 0d                	je     801e7f <ipc_reply_recv+0x65>
+  801e72:	a1 18 60 80 00       	mov    0x806018,%eax
+  801e77:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801e7d:	89 07                	mov    %eax,(%edi)
+  801e7f:	a1 18 60 80 00       	mov    0x806018,%eax
+  801e84:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8d:	5b                   	pop    %ebx
+  801e8e:	5e                   	pop    %esi
+  801e8f:	5f                   	pop    %edi
+  801e90:	5d                   	pop    %ebp
+  801e91:	c3                   	ret
+  801e92:	ff 75 14             	push   0x14(%ebp)
+  801e95:	53                   	push   %ebx
+  801e96:	ff 75 0c             	push   0xc(%ebp)
+  801e99:	ff 75 08             	push   0x8(%ebp)
+  801e9c:	e8 c3 f2 ff ff       	call   801164 <sys_ipc_try_send>
+  801ea1:	89 c2                	mov    %eax,%edx
+  801ea3:	c1 ea 1f             	shr    $0x1f,%edx
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801eac:	0f 95 c1             	setne  %cl
+  801eaf:	84 d1                	test   %dl,%cl
+  801eb1:	74 05                	je     801eb8 <ipc_reply_recv+0x9e>
+  801eb3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801eb6:	75 12                	jne    801eca <ipc_reply_recv+0xb0>
+  801eb8:	83 ec 04             	sub    $0x4,%esp
+  801ebb:	57                   	push   %edi
+  801ebc:	56                   	push   %esi
+  801ebd:	ff 75 18             	push   0x18(%ebp)
+  801ec0:	e8 e3 fd ff ff       	call   801ca8 <ipc_recv>
+  801ec5:	83 c4 10             	add    $0x10,%esp
+  801ec8:	eb c0                	jmp    801e8a <ipc_reply_recv+0x70>
+  801eca:	83 ec 04             	sub    $0x4,%esp
+  801ecd:	50                   	push   %eax
+  801ece:	ff 75 08             	push   0x8(%ebp)
+  801ed1:	68 a0 3e 80 00       	push   $0x803ea0
+  801ed6:	e8 d7 e4 ff ff       	call   8003b2 <cprintf>
+  801edb:	83 c4 10             	add    $0x10,%esp
+  801ede:	eb d8                	jmp    801eb8 <ipc_reply_recv+0x9e>
+  801ee0:	85 f6                	test   %esi,%esi
+  801ee2:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801ee7:	0f 45 c6             	cmovne %esi,%eax
+  801eea:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801eef:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801ef6:	e9 43 ff ff ff       	jmp    801e3e <ipc_reply_recv+0x24>
+
+00801efb <ipc_find_env>:
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	83 ec 14             	sub    $0x14,%esp
+  801f01:	ff 75 08             	push   0x8(%ebp)
+  801f04:	e8 f9 f1 ff ff       	call   801102 <sys_env_service>
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f10:	0f 48 c2             	cmovs  %edx,%eax
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+
+00801f15 <fd2num>:
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f20:	c1 e8 0c             	shr    $0xc,%eax
+  801f23:	5d                   	pop    %ebp
+  801f24:	c3                   	ret
+
+00801f25 <fd2data>:
+  801f25:	55                   	push   %ebp
+  801f26:	89 e5                	mov    %esp,%ebp
+  801f28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f30:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f35:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801f3a:	5d                   	pop    %ebp
+  801f3b:	c3                   	ret
+
+00801f3c <fd_alloc>:
+  801f3c:	55                   	push   %ebp
+  801f3d:	89 e5                	mov    %esp,%ebp
+  801f3f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801f44:	89 c2                	mov    %eax,%edx
+  801f46:	c1 ea 16             	shr    $0x16,%edx
+  801f49:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f50:	f6 c2 01             	test   $0x1,%dl
+  801f53:	74 29                	je     801f7e <fd_alloc+0x42>
+  801f55:	89 c2                	mov    %eax,%edx
+  801f57:	c1 ea 0c             	shr    $0xc,%edx
+  801f5a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f61:	f6 c2 01             	test   $0x1,%dl
+  801f64:	74 18                	je     801f7e <fd_alloc+0x42>
+  801f66:	05 00 10 00 00       	add    $0x1000,%eax
+  801f6b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801f70:	75 d2                	jne    801f44 <fd_alloc+0x8>
+  801f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f77:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f7c:	eb 05                	jmp    801f83 <fd_alloc+0x47>
+  801f7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f86:	89 02                	mov    %eax,(%edx)
+  801f88:	89 c8                	mov    %ecx,%eax
+  801f8a:	5d                   	pop    %ebp
+  801f8b:	c3                   	ret
+
+00801f8c <fd_lookup>:
+  801f8c:	55                   	push   %ebp
+  801f8d:	89 e5                	mov    %esp,%ebp
+  801f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f92:	83 f8 1f             	cmp    $0x1f,%eax
+  801f95:	77 30                	ja     801fc7 <fd_lookup+0x3b>
+  801f97:	c1 e0 0c             	shl    $0xc,%eax
+  801f9a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801f9f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801fa5:	f6 c2 01             	test   $0x1,%dl
+  801fa8:	74 24                	je     801fce <fd_lookup+0x42>
+  801faa:	89 c2                	mov    %eax,%edx
+  801fac:	c1 ea 0c             	shr    $0xc,%edx
+  801faf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fb6:	f6 c2 01             	test   $0x1,%dl
+  801fb9:	74 1a                	je     801fd5 <fd_lookup+0x49>
+  801fbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fbe:	89 02                	mov    %eax,(%edx)
+  801fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+  801fc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fcc:	eb f7                	jmp    801fc5 <fd_lookup+0x39>
+  801fce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd3:	eb f0                	jmp    801fc5 <fd_lookup+0x39>
+  801fd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fda:	eb e9                	jmp    801fc5 <fd_lookup+0x39>
+
+00801fdc <dev_lookup>:
+  801fdc:	55                   	push   %ebp
+  801fdd:	89 e5                	mov    %esp,%ebp
+  801fdf:	53                   	push   %ebx
+  801fe0:	83 ec 04             	sub    $0x4,%esp
+  801fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801feb:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801ff0:	39 13                	cmp    %edx,(%ebx)
+  801ff2:	74 37                	je     80202b <dev_lookup+0x4f>
+  801ff4:	83 c0 01             	add    $0x1,%eax
+  801ff7:	8b 1c 85 68 3f 80 00 	mov    0x803f68(,%eax,4),%ebx
+  801ffe:	85 db                	test   %ebx,%ebx
+  802000:	75 ee                	jne    801ff0 <dev_lookup+0x14>
+  802002:	a1 18 60 80 00       	mov    0x806018,%eax
+  802007:	8b 40 48             	mov    0x48(%eax),%eax
+  80200a:	83 ec 04             	sub    $0x4,%esp
+  80200d:	52                   	push   %edx
+  80200e:	50                   	push   %eax
+  80200f:	68 ec 3e 80 00       	push   $0x803eec
+  802014:	e8 99 e3 ff ff       	call   8003b2 <cprintf>
+  802019:	83 c4 10             	add    $0x10,%esp
+  80201c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802021:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802024:	89 1a                	mov    %ebx,(%edx)
+  802026:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802029:	c9                   	leave
+  80202a:	c3                   	ret
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802030:	eb ef                	jmp    802021 <dev_lookup+0x45>
+
+00802032 <fd_close>:
+  802032:	55                   	push   %ebp
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	57                   	push   %edi
+  802036:	56                   	push   %esi
+  802037:	53                   	push   %ebx
+  802038:	83 ec 24             	sub    $0x24,%esp
+  80203b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80203e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802041:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802044:	50                   	push   %eax
+  802045:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80204b:	c1 e8 0c             	shr    $0xc,%eax
+  80204e:	50                   	push   %eax
+  80204f:	e8 38 ff ff ff       	call   801f8c <fd_lookup>
+  802054:	89 c3                	mov    %eax,%ebx
+  802056:	83 c4 10             	add    $0x10,%esp
+  802059:	85 c0                	test   %eax,%eax
+  80205b:	78 05                	js     802062 <fd_close+0x30>
+  80205d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802060:	74 0f                	je     802071 <fd_close+0x3f>
+  802062:	85 ff                	test   %edi,%edi
+  802064:	0f 44 df             	cmove  %edi,%ebx
+  802067:	89 d8                	mov    %ebx,%eax
+  802069:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206c:	5b                   	pop    %ebx
+  80206d:	5e                   	pop    %esi
+  80206e:	5f                   	pop    %edi
+  80206f:	5d                   	pop    %ebp
+  802070:	c3                   	ret
+  802071:	83 ec 08             	sub    $0x8,%esp
+  802074:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802077:	50                   	push   %eax
+  802078:	ff 36                	push   (%esi)
+  80207a:	e8 5d ff ff ff       	call   801fdc <dev_lookup>
+  80207f:	89 c3                	mov    %eax,%ebx
+  802081:	83 c4 10             	add    $0x10,%esp
+  802084:	85 c0                	test   %eax,%eax
+  802086:	78 1a                	js     8020a2 <fd_close+0x70>
+  802088:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80208b:	8b 40 10             	mov    0x10(%eax),%eax
+  80208e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802093:	85 c0                	test   %eax,%eax
+  802095:	74 0b                	je     8020a2 <fd_close+0x70>
+  802097:	83 ec 0c             	sub    $0xc,%esp
+  80209a:	56                   	push   %esi
+  80209b:	ff d0                	call   *%eax
+  80209d:	89 c3                	mov    %eax,%ebx
+  80209f:	83 c4 10             	add    $0x10,%esp
+  8020a2:	83 ec 08             	sub    $0x8,%esp
+  8020a5:	56                   	push   %esi
+  8020a6:	6a 00                	push   $0x0
+  8020a8:	e8 2e ef ff ff       	call   800fdb <sys_page_unmap>
+  8020ad:	83 c4 10             	add    $0x10,%esp
+  8020b0:	eb b5                	jmp    802067 <fd_close+0x35>
+
+008020b2 <close>:
+  8020b2:	55                   	push   %ebp
+  8020b3:	89 e5                	mov    %esp,%ebp
+  8020b5:	83 ec 20             	sub    $0x20,%esp
+  8020b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020bb:	50                   	push   %eax
+  8020bc:	ff 75 08             	push   0x8(%ebp)
+  8020bf:	e8 c8 fe ff ff       	call   801f8c <fd_lookup>
+  8020c4:	83 c4 10             	add    $0x10,%esp
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	79 02                	jns    8020cd <close+0x1b>
+  8020cb:	c9                   	leave
+  8020cc:	c3                   	ret
+  8020cd:	83 ec 08             	sub    $0x8,%esp
+  8020d0:	6a 01                	push   $0x1
+  8020d2:	ff 75 f4             	push   -0xc(%ebp)
+  8020d5:	e8 58 ff ff ff       	call   802032 <fd_close>
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	eb ec                	jmp    8020cb <close+0x19>
+
+008020df <close_all>:
+  8020df:	55                   	push   %ebp
+  8020e0:	89 e5                	mov    %esp,%ebp
+  8020e2:	53                   	push   %ebx
+  8020e3:	83 ec 04             	sub    $0x4,%esp
+  8020e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020eb:	83 ec 0c             	sub    $0xc,%esp
+  8020ee:	53                   	push   %ebx
+  8020ef:	e8 be ff ff ff       	call   8020b2 <close>
+  8020f4:	83 c3 01             	add    $0x1,%ebx
+  8020f7:	83 c4 10             	add    $0x10,%esp
+  8020fa:	83 fb 20             	cmp    $0x20,%ebx
+  8020fd:	75 ec                	jne    8020eb <close_all+0xc>
+  8020ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+
+00802104 <dup>:
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	57                   	push   %edi
+  802108:	56                   	push   %esi
+  802109:	53                   	push   %ebx
+  80210a:	83 ec 34             	sub    $0x34,%esp
+  80210d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802110:	50                   	push   %eax
+  802111:	ff 75 08             	push   0x8(%ebp)
+  802114:	e8 73 fe ff ff       	call   801f8c <fd_lookup>
+  802119:	89 c3                	mov    %eax,%ebx
+  80211b:	83 c4 10             	add    $0x10,%esp
+  80211e:	85 c0                	test   %eax,%eax
+  802120:	78 7f                	js     8021a1 <dup+0x9d>
+  802122:	83 ec 0c             	sub    $0xc,%esp
+  802125:	ff 75 0c             	push   0xc(%ebp)
+  802128:	e8 85 ff ff ff       	call   8020b2 <close>
+  80212d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802130:	c1 e6 0c             	shl    $0xc,%esi
+  802133:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  802139:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80213c:	89 3c 24             	mov    %edi,(%esp)
+  80213f:	e8 e1 fd ff ff       	call   801f25 <fd2data>
+  802144:	89 c3                	mov    %eax,%ebx
+  802146:	89 34 24             	mov    %esi,(%esp)
+  802149:	e8 d7 fd ff ff       	call   801f25 <fd2data>
+  80214e:	83 c4 10             	add    $0x10,%esp
+  802151:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802154:	89 d8                	mov    %ebx,%eax
+  802156:	c1 e8 16             	shr    $0x16,%eax
+  802159:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802160:	a8 01                	test   $0x1,%al
+  802162:	74 11                	je     802175 <dup+0x71>
+  802164:	89 d8                	mov    %ebx,%eax
+  802166:	c1 e8 0c             	shr    $0xc,%eax
+  802169:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802170:	f6 c2 01             	test   $0x1,%dl
+  802173:	75 36                	jne    8021ab <dup+0xa7>
+  802175:	89 f8                	mov    %edi,%eax
+  802177:	c1 e8 0c             	shr    $0xc,%eax
+  80217a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802181:	83 ec 0c             	sub    $0xc,%esp
+  802184:	25 07 0e 00 00       	and    $0xe07,%eax
+  802189:	50                   	push   %eax
+  80218a:	56                   	push   %esi
+  80218b:	6a 00                	push   $0x0
+  80218d:	57                   	push   %edi
+  80218e:	6a 00                	push   $0x0
+  802190:	e8 b7 ed ff ff       	call   800f4c <sys_page_map>
+  802195:	89 c3                	mov    %eax,%ebx
+  802197:	83 c4 20             	add    $0x20,%esp
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	78 33                	js     8021d1 <dup+0xcd>
+  80219e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021a1:	89 d8                	mov    %ebx,%eax
+  8021a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a6:	5b                   	pop    %ebx
+  8021a7:	5e                   	pop    %esi
+  8021a8:	5f                   	pop    %edi
+  8021a9:	5d                   	pop    %ebp
+  8021aa:	c3                   	ret
+  8021ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021b2:	83 ec 0c             	sub    $0xc,%esp
+  8021b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021ba:	50                   	push   %eax
+  8021bb:	ff 75 d4             	push   -0x2c(%ebp)
+  8021be:	6a 00                	push   $0x0
+  8021c0:	53                   	push   %ebx
+  8021c1:	6a 00                	push   $0x0
+  8021c3:	e8 84 ed ff ff       	call   800f4c <sys_page_map>
+  8021c8:	89 c3                	mov    %eax,%ebx
+  8021ca:	83 c4 20             	add    $0x20,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	79 a4                	jns    802175 <dup+0x71>
+  8021d1:	83 ec 08             	sub    $0x8,%esp
+  8021d4:	56                   	push   %esi
+  8021d5:	6a 00                	push   $0x0
+  8021d7:	e8 ff ed ff ff       	call   800fdb <sys_page_unmap>
+  8021dc:	83 c4 08             	add    $0x8,%esp
+  8021df:	ff 75 d4             	push   -0x2c(%ebp)
+  8021e2:	6a 00                	push   $0x0
+  8021e4:	e8 f2 ed ff ff       	call   800fdb <sys_page_unmap>
+  8021e9:	83 c4 10             	add    $0x10,%esp
+  8021ec:	eb b3                	jmp    8021a1 <dup+0x9d>
+
+008021ee <read>:
+  8021ee:	55                   	push   %ebp
+  8021ef:	89 e5                	mov    %esp,%ebp
+  8021f1:	56                   	push   %esi
+  8021f2:	53                   	push   %ebx
+  8021f3:	83 ec 18             	sub    $0x18,%esp
+  8021f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021fc:	50                   	push   %eax
+  8021fd:	56                   	push   %esi
+  8021fe:	e8 89 fd ff ff       	call   801f8c <fd_lookup>
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	85 c0                	test   %eax,%eax
+  802208:	78 3c                	js     802246 <read+0x58>
+  80220a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80220d:	83 ec 08             	sub    $0x8,%esp
+  802210:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802213:	50                   	push   %eax
+  802214:	ff 33                	push   (%ebx)
+  802216:	e8 c1 fd ff ff       	call   801fdc <dev_lookup>
+  80221b:	83 c4 10             	add    $0x10,%esp
+  80221e:	85 c0                	test   %eax,%eax
+  802220:	78 24                	js     802246 <read+0x58>
+  802222:	8b 43 08             	mov    0x8(%ebx),%eax
+  802225:	83 e0 03             	and    $0x3,%eax
+  802228:	83 f8 01             	cmp    $0x1,%eax
+  80222b:	74 20                	je     80224d <read+0x5f>
+  80222d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802230:	8b 40 08             	mov    0x8(%eax),%eax
+  802233:	85 c0                	test   %eax,%eax
+  802235:	74 37                	je     80226e <read+0x80>
+  802237:	83 ec 04             	sub    $0x4,%esp
+  80223a:	ff 75 10             	push   0x10(%ebp)
+  80223d:	ff 75 0c             	push   0xc(%ebp)
+  802240:	53                   	push   %ebx
+  802241:	ff d0                	call   *%eax
+  802243:	83 c4 10             	add    $0x10,%esp
+  802246:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802249:	5b                   	pop    %ebx
+  80224a:	5e                   	pop    %esi
+  80224b:	5d                   	pop    %ebp
+  80224c:	c3                   	ret
+  80224d:	a1 18 60 80 00       	mov    0x806018,%eax
+  802252:	8b 40 48             	mov    0x48(%eax),%eax
+  802255:	83 ec 04             	sub    $0x4,%esp
+  802258:	56                   	push   %esi
+  802259:	50                   	push   %eax
+  80225a:	68 2d 3f 80 00       	push   $0x803f2d
+  80225f:	e8 4e e1 ff ff       	call   8003b2 <cprintf>
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80226c:	eb d8                	jmp    802246 <read+0x58>
+  80226e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802273:	eb d1                	jmp    802246 <read+0x58>
+
+00802275 <readn>:
+  802275:	55                   	push   %ebp
+  802276:	89 e5                	mov    %esp,%ebp
+  802278:	57                   	push   %edi
+  802279:	56                   	push   %esi
+  80227a:	53                   	push   %ebx
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802281:	8b 75 10             	mov    0x10(%ebp),%esi
+  802284:	85 f6                	test   %esi,%esi
+  802286:	74 30                	je     8022b8 <readn+0x43>
+  802288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80228d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802292:	83 ec 04             	sub    $0x4,%esp
+  802295:	89 f2                	mov    %esi,%edx
+  802297:	29 c2                	sub    %eax,%edx
+  802299:	52                   	push   %edx
+  80229a:	01 f8                	add    %edi,%eax
+  80229c:	50                   	push   %eax
+  80229d:	ff 75 08             	push   0x8(%ebp)
+  8022a0:	e8 49 ff ff ff       	call   8021ee <read>
+  8022a5:	83 c4 10             	add    $0x10,%esp
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	78 15                	js     8022c1 <readn+0x4c>
+  8022ac:	74 11                	je     8022bf <readn+0x4a>
+  8022ae:	01 c3                	add    %eax,%ebx
+  8022b0:	89 d8                	mov    %ebx,%eax
+  8022b2:	39 f3                	cmp    %esi,%ebx
+  8022b4:	72 dc                	jb     802292 <readn+0x1d>
+  8022b6:	eb 09                	jmp    8022c1 <readn+0x4c>
+  8022b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bd:	eb 02                	jmp    8022c1 <readn+0x4c>
+  8022bf:	89 d8                	mov    %ebx,%eax
+  8022c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c4:	5b                   	pop    %ebx
+  8022c5:	5e                   	pop    %esi
+  8022c6:	5f                   	pop    %edi
+  8022c7:	5d                   	pop    %ebp
+  8022c8:	c3                   	ret
+
+008022c9 <write>:
+  8022c9:	55                   	push   %ebp
+  8022ca:	89 e5                	mov    %esp,%ebp
+  8022cc:	56                   	push   %esi
+  8022cd:	53                   	push   %ebx
+  8022ce:	83 ec 18             	sub    $0x18,%esp
+  8022d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022d7:	50                   	push   %eax
+  8022d8:	53                   	push   %ebx
+  8022d9:	e8 ae fc ff ff       	call   801f8c <fd_lookup>
+  8022de:	83 c4 10             	add    $0x10,%esp
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	78 37                	js     80231c <write+0x53>
+  8022e5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022e8:	83 ec 08             	sub    $0x8,%esp
+  8022eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ee:	50                   	push   %eax
+  8022ef:	ff 36                	push   (%esi)
+  8022f1:	e8 e6 fc ff ff       	call   801fdc <dev_lookup>
+  8022f6:	83 c4 10             	add    $0x10,%esp
+  8022f9:	85 c0                	test   %eax,%eax
+  8022fb:	78 1f                	js     80231c <write+0x53>
+  8022fd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802301:	74 20                	je     802323 <write+0x5a>
+  802303:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802306:	8b 40 0c             	mov    0xc(%eax),%eax
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	74 37                	je     802344 <write+0x7b>
+  80230d:	83 ec 04             	sub    $0x4,%esp
+  802310:	ff 75 10             	push   0x10(%ebp)
+  802313:	ff 75 0c             	push   0xc(%ebp)
+  802316:	56                   	push   %esi
+  802317:	ff d0                	call   *%eax
+  802319:	83 c4 10             	add    $0x10,%esp
+  80231c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80231f:	5b                   	pop    %ebx
+  802320:	5e                   	pop    %esi
+  802321:	5d                   	pop    %ebp
+  802322:	c3                   	ret
+  802323:	a1 18 60 80 00       	mov    0x806018,%eax
+  802328:	8b 40 48             	mov    0x48(%eax),%eax
+  80232b:	83 ec 04             	sub    $0x4,%esp
+  80232e:	53                   	push   %ebx
+  80232f:	50                   	push   %eax
+  802330:	68 49 3f 80 00       	push   $0x803f49
+  802335:	e8 78 e0 ff ff       	call   8003b2 <cprintf>
+  80233a:	83 c4 10             	add    $0x10,%esp
+  80233d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802342:	eb d8                	jmp    80231c <write+0x53>
+  802344:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802349:	eb d1                	jmp    80231c <write+0x53>
+
+0080234b <seek>:
+  80234b:	55                   	push   %ebp
+  80234c:	89 e5                	mov    %esp,%ebp
+  80234e:	83 ec 20             	sub    $0x20,%esp
+  802351:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802354:	50                   	push   %eax
+  802355:	ff 75 08             	push   0x8(%ebp)
+  802358:	e8 2f fc ff ff       	call   801f8c <fd_lookup>
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	85 c0                	test   %eax,%eax
+  802362:	78 0e                	js     802372 <seek+0x27>
+  802364:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802367:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236a:	89 50 04             	mov    %edx,0x4(%eax)
+  80236d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+
+00802374 <ftruncate>:
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	56                   	push   %esi
+  802378:	53                   	push   %ebx
+  802379:	83 ec 18             	sub    $0x18,%esp
+  80237c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80237f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802382:	50                   	push   %eax
+  802383:	53                   	push   %ebx
+  802384:	e8 03 fc ff ff       	call   801f8c <fd_lookup>
+  802389:	83 c4 10             	add    $0x10,%esp
+  80238c:	85 c0                	test   %eax,%eax
+  80238e:	78 34                	js     8023c4 <ftruncate+0x50>
+  802390:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802393:	83 ec 08             	sub    $0x8,%esp
+  802396:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802399:	50                   	push   %eax
+  80239a:	ff 36                	push   (%esi)
+  80239c:	e8 3b fc ff ff       	call   801fdc <dev_lookup>
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	78 1c                	js     8023c4 <ftruncate+0x50>
+  8023a8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8023ac:	74 1d                	je     8023cb <ftruncate+0x57>
+  8023ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b1:	8b 40 18             	mov    0x18(%eax),%eax
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	74 34                	je     8023ec <ftruncate+0x78>
+  8023b8:	83 ec 08             	sub    $0x8,%esp
+  8023bb:	ff 75 0c             	push   0xc(%ebp)
+  8023be:	56                   	push   %esi
+  8023bf:	ff d0                	call   *%eax
+  8023c1:	83 c4 10             	add    $0x10,%esp
+  8023c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c7:	5b                   	pop    %ebx
+  8023c8:	5e                   	pop    %esi
+  8023c9:	5d                   	pop    %ebp
+  8023ca:	c3                   	ret
+  8023cb:	a1 18 60 80 00       	mov    0x806018,%eax
+  8023d0:	8b 40 48             	mov    0x48(%eax),%eax
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	53                   	push   %ebx
+  8023d7:	50                   	push   %eax
+  8023d8:	68 0c 3f 80 00       	push   $0x803f0c
+  8023dd:	e8 d0 df ff ff       	call   8003b2 <cprintf>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+  8023e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ea:	eb d8                	jmp    8023c4 <ftruncate+0x50>
+  8023ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023f1:	eb d1                	jmp    8023c4 <ftruncate+0x50>
+
+008023f3 <fstat>:
+  8023f3:	55                   	push   %ebp
+  8023f4:	89 e5                	mov    %esp,%ebp
+  8023f6:	56                   	push   %esi
+  8023f7:	53                   	push   %ebx
+  8023f8:	83 ec 18             	sub    $0x18,%esp
+  8023fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802401:	50                   	push   %eax
+  802402:	ff 75 08             	push   0x8(%ebp)
+  802405:	e8 82 fb ff ff       	call   801f8c <fd_lookup>
+  80240a:	83 c4 10             	add    $0x10,%esp
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 49                	js     80245a <fstat+0x67>
+  802411:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802414:	83 ec 08             	sub    $0x8,%esp
+  802417:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241a:	50                   	push   %eax
+  80241b:	ff 36                	push   (%esi)
+  80241d:	e8 ba fb ff ff       	call   801fdc <dev_lookup>
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	85 c0                	test   %eax,%eax
+  802427:	78 31                	js     80245a <fstat+0x67>
+  802429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802430:	74 2f                	je     802461 <fstat+0x6e>
+  802432:	c6 03 00             	movb   $0x0,(%ebx)
+  802435:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80243c:	00 00 00 
+  80243f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802446:	00 00 00 
+  802449:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  80244f:	83 ec 08             	sub    $0x8,%esp
+  802452:	53                   	push   %ebx
+  802453:	56                   	push   %esi
+  802454:	ff 50 14             	call   *0x14(%eax)
+  802457:	83 c4 10             	add    $0x10,%esp
+  80245a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80245d:	5b                   	pop    %ebx
+  80245e:	5e                   	pop    %esi
+  80245f:	5d                   	pop    %ebp
+  802460:	c3                   	ret
+  802461:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802466:	eb f2                	jmp    80245a <fstat+0x67>
+
+00802468 <stat>:
+  802468:	55                   	push   %ebp
+  802469:	89 e5                	mov    %esp,%ebp
+  80246b:	56                   	push   %esi
+  80246c:	53                   	push   %ebx
+  80246d:	83 ec 08             	sub    $0x8,%esp
+  802470:	6a 00                	push   $0x0
+  802472:	ff 75 08             	push   0x8(%ebp)
+  802475:	e8 31 05 00 00       	call   8029ab <open>
+  80247a:	89 c3                	mov    %eax,%ebx
+  80247c:	83 c4 10             	add    $0x10,%esp
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	78 1b                	js     80249e <stat+0x36>
+  802483:	83 ec 08             	sub    $0x8,%esp
+  802486:	ff 75 0c             	push   0xc(%ebp)
+  802489:	50                   	push   %eax
+  80248a:	e8 64 ff ff ff       	call   8023f3 <fstat>
+  80248f:	89 c6                	mov    %eax,%esi
+  802491:	89 1c 24             	mov    %ebx,(%esp)
+  802494:	e8 19 fc ff ff       	call   8020b2 <close>
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	89 f3                	mov    %esi,%ebx
+  80249e:	89 d8                	mov    %ebx,%eax
+  8024a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a3:	5b                   	pop    %ebx
+  8024a4:	5e                   	pop    %esi
+  8024a5:	5d                   	pop    %ebp
+  8024a6:	c3                   	ret
+
+008024a7 <fsipc>:
+  8024a7:	55                   	push   %ebp
+  8024a8:	89 e5                	mov    %esp,%ebp
+  8024aa:	56                   	push   %esi
+  8024ab:	53                   	push   %ebx
+  8024ac:	89 c3                	mov    %eax,%ebx
+  8024ae:	89 d6                	mov    %edx,%esi
+  8024b0:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  8024b7:	74 20                	je     8024d9 <fsipc+0x32>
+  8024b9:	83 ec 08             	sub    $0x8,%esp
+  8024bc:	6a 00                	push   $0x0
+  8024be:	56                   	push   %esi
+  8024bf:	6a 07                	push   $0x7
+  8024c1:	68 00 70 80 00       	push   $0x807000
+  8024c6:	53                   	push   %ebx
+  8024c7:	ff 35 10 60 80 00    	push   0x806010
+  8024cd:	e8 8e f8 ff ff       	call   801d60 <ipc_call>
+  8024d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d5:	5b                   	pop    %ebx
+  8024d6:	5e                   	pop    %esi
+  8024d7:	5d                   	pop    %ebp
+  8024d8:	c3                   	ret
+  8024d9:	83 ec 0c             	sub    $0xc,%esp
+  8024dc:	6a 02                	push   $0x2
+  8024de:	e8 18 fa ff ff       	call   801efb <ipc_find_env>
+  8024e3:	a3 10 60 80 00       	mov    %eax,0x806010
+  8024e8:	83 c4 10             	add    $0x10,%esp
+  8024eb:	eb cc                	jmp    8024b9 <fsipc+0x12>
+
+008024ed <devfile_trunc>:
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	83 ec 08             	sub    $0x8,%esp
+  8024f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024f9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802501:	a3 04 70 80 00       	mov    %eax,0x807004
+  802506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802510:	e8 92 ff ff ff       	call   8024a7 <fsipc>
+  802515:	c9                   	leave
+  802516:	c3                   	ret
+
+00802517 <devfile_flush>:
+  802517:	55                   	push   %ebp
+  802518:	89 e5                	mov    %esp,%ebp
+  80251a:	83 ec 08             	sub    $0x8,%esp
+  80251d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802520:	8b 40 0c             	mov    0xc(%eax),%eax
+  802523:	a3 00 70 80 00       	mov    %eax,0x807000
+  802528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80252d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802532:	e8 70 ff ff ff       	call   8024a7 <fsipc>
+  802537:	c9                   	leave
+  802538:	c3                   	ret
+
+00802539 <devfile_stat>:
+  802539:	55                   	push   %ebp
+  80253a:	89 e5                	mov    %esp,%ebp
+  80253c:	53                   	push   %ebx
+  80253d:	83 ec 04             	sub    $0x4,%esp
+  802540:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802543:	8b 45 08             	mov    0x8(%ebp),%eax
+  802546:	8b 40 0c             	mov    0xc(%eax),%eax
+  802549:	a3 00 70 80 00       	mov    %eax,0x807000
+  80254e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802553:	b8 07 00 00 00       	mov    $0x7,%eax
+  802558:	e8 4a ff ff ff       	call   8024a7 <fsipc>
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	78 2c                	js     80258d <devfile_stat+0x54>
+  802561:	83 ec 08             	sub    $0x8,%esp
+  802564:	68 00 70 80 00       	push   $0x807000
+  802569:	53                   	push   %ebx
+  80256a:	e8 3a e5 ff ff       	call   800aa9 <strcpy>
+  80256f:	a1 80 70 80 00       	mov    0x807080,%eax
+  802574:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80257a:	a1 84 70 80 00       	mov    0x807084,%eax
+  80257f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802585:	83 c4 10             	add    $0x10,%esp
+  802588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802590:	c9                   	leave
+  802591:	c3                   	ret
+
+00802592 <fsring_rw>:
+  802592:	55                   	push   %ebp
+  802593:	89 e5                	mov    %esp,%ebp
+  802595:	57                   	push   %edi
+  802596:	56                   	push   %esi
+  802597:	53                   	push   %ebx
+  802598:	83 ec 2c             	sub    $0x2c,%esp
+  80259b:	89 c7                	mov    %eax,%edi
+  80259d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8025a0:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8025a3:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8025a8:	a8 01                	test   $0x1,%al
+  8025aa:	74 0d                	je     8025b9 <fsring_rw+0x27>
+  8025ac:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8025b1:	a8 01                	test   $0x1,%al
+  8025b3:	0f 85 d5 00 00 00    	jne    80268e <fsring_rw+0xfc>
+  8025b9:	a1 18 60 80 00       	mov    0x806018,%eax
+  8025be:	8b 40 48             	mov    0x48(%eax),%eax
+  8025c1:	3b 05 0c 60 80 00    	cmp    0x80600c,%eax
+  8025c7:	0f 84 fc 00 00 00    	je     8026c9 <fsring_rw+0x137>
+  8025cd:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  8025d4:	0f 84 02 01 00 00    	je     8026dc <fsring_rw+0x14a>
+  8025da:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8025df:	83 ec 04             	sub    $0x4,%esp
+  8025e2:	68 07 02 00 00       	push   $0x207
+  8025e7:	53                   	push   %ebx
+  8025e8:	6a 00                	push   $0x0
+  8025ea:	e8 1a e9 ff ff       	call   800f09 <sys_page_alloc>
+  8025ef:	83 c4 10             	add    $0x10,%esp
+  8025f2:	85 c0                	test   %eax,%eax
+  8025f4:	0f 88 f9 00 00 00    	js     8026f3 <fsring_rw+0x161>
+  8025fa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802600:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802606:	75 d7                	jne    8025df <fsring_rw+0x4d>
+  802608:	6a 0e                	push   $0xe
+  80260a:	6a 0d                	push   $0xd
+  80260c:	ff 35 10 60 80 00    	push   0x806010
+  802612:	68 00 00 f0 cf       	push   $0xcff00000
+  802617:	e8 c4 0c 00 00       	call   8032e0 <ipcring_init>
+  80261c:	83 c4 08             	add    $0x8,%esp
+  80261f:	6a 00                	push   $0x0
+  802621:	6a 00                	push   $0x0
+  802623:	68 07 02 00 00       	push   $0x207
+  802628:	68 00 00 f0 cf       	push   $0xcff00000
+  80262d:	6a 0b                	push   $0xb
+  80262f:	ff 35 10 60 80 00    	push   0x806010
+  802635:	e8 26 f7 ff ff       	call   801d60 <ipc_call>
+  80263a:	89 c6                	mov    %eax,%esi
+  80263c:	83 c4 20             	add    $0x20,%esp
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	0f 88 ac 00 00 00    	js     8026f3 <fsring_rw+0x161>
+  802647:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80264c:	89 d9                	mov    %ebx,%ecx
+  80264e:	83 c3 01             	add    $0x1,%ebx
+  802651:	89 da                	mov    %ebx,%edx
+  802653:	c1 e2 0c             	shl    $0xc,%edx
+  802656:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80265c:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802662:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802668:	83 ec 08             	sub    $0x8,%esp
+  80266b:	6a 00                	push   $0x0
+  80266d:	6a 00                	push   $0x0
+  80266f:	68 07 02 00 00       	push   $0x207
+  802674:	50                   	push   %eax
+  802675:	6a 0c                	push   $0xc
+  802677:	ff 35 10 60 80 00    	push   0x806010
+  80267d:	e8 de f6 ff ff       	call   801d60 <ipc_call>
+  802682:	83 c4 20             	add    $0x20,%esp
+  802685:	85 c0                	test   %eax,%eax
+  802687:	78 6a                	js     8026f3 <fsring_rw+0x161>
+  802689:	83 fb 08             	cmp    $0x8,%ebx
+  80268c:	75 be                	jne    80264c <fsring_rw+0xba>
+  80268e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802692:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802697:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80269c:	0f 45 c2             	cmovne %edx,%eax
+  80269f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8026a2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8026a9:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8026b0:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8026b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c1:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8026c4:	e9 4b 01 00 00       	jmp    802814 <fsring_rw+0x282>
+  8026c9:	e8 05 ec ff ff       	call   8012d3 <sys_time_msec>
+  8026ce:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  8026d4:	0f 89 f3 fe ff ff    	jns    8025cd <fsring_rw+0x3b>
+  8026da:	eb 54                	jmp    802730 <fsring_rw+0x19e>
+  8026dc:	83 ec 0c             	sub    $0xc,%esp
+  8026df:	6a 02                	push   $0x2
+  8026e1:	e8 15 f8 ff ff       	call   801efb <ipc_find_env>
+  8026e6:	a3 10 60 80 00       	mov    %eax,0x806010
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	e9 e7 fe ff ff       	jmp    8025da <fsring_rw+0x48>
+  8026f3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8026f8:	83 ec 08             	sub    $0x8,%esp
+  8026fb:	53                   	push   %ebx
+  8026fc:	6a 00                	push   $0x0
+  8026fe:	e8 d8 e8 ff ff       	call   800fdb <sys_page_unmap>
+  802703:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802712:	75 e4                	jne    8026f8 <fsring_rw+0x166>
+  802714:	e8 ba eb ff ff       	call   8012d3 <sys_time_msec>
+  802719:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80271e:	a3 08 60 80 00       	mov    %eax,0x806008
+  802723:	a1 18 60 80 00       	mov    0x806018,%eax
+  802728:	8b 40 48             	mov    0x48(%eax),%eax
+  80272b:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802730:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802737:	e9 7a 01 00 00       	jmp    8028b6 <fsring_rw+0x324>
+  80273c:	8b 57 0c             	mov    0xc(%edi),%edx
+  80273f:	89 10                	mov    %edx,(%eax)
+  802741:	89 58 04             	mov    %ebx,0x4(%eax)
+  802744:	89 f2                	mov    %esi,%edx
+  802746:	03 57 04             	add    0x4(%edi),%edx
+  802749:	89 50 08             	mov    %edx,0x8(%eax)
+  80274c:	83 ec 04             	sub    $0x4,%esp
+  80274f:	53                   	push   %ebx
+  802750:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802753:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802756:	52                   	push   %edx
+  802757:	83 c0 0c             	add    $0xc,%eax
+  80275a:	50                   	push   %eax
+  80275b:	e8 f9 e4 ff ff       	call   800c59 <memmove>
+  802760:	83 c4 10             	add    $0x10,%esp
+  802763:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802766:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802769:	89 08                	mov    %ecx,(%eax)
+  80276b:	83 ec 0c             	sub    $0xc,%esp
+  80276e:	68 00 00 f0 cf       	push   $0xcff00000
+  802773:	e8 c6 0b 00 00       	call   80333e <ipcring_req_push>
+  802778:	01 de                	add    %ebx,%esi
+  80277a:	83 c4 10             	add    $0x10,%esp
+  80277d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802780:	73 4c                	jae    8027ce <fsring_rw+0x23c>
+  802782:	83 ec 0c             	sub    $0xc,%esp
+  802785:	68 00 00 f0 cf       	push   $0xcff00000
+  80278a:	e8 89 0b 00 00       	call   803318 <ipcring_req_slot>
+  80278f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802792:	83 c4 10             	add    $0x10,%esp
+  802795:	85 c0                	test   %eax,%eax
+  802797:	74 35                	je     8027ce <fsring_rw+0x23c>
+  802799:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80279e:	83 e0 07             	and    $0x7,%eax
+  8027a1:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8027a6:	c1 e0 0c             	shl    $0xc,%eax
+  8027a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027ac:	29 f3                	sub    %esi,%ebx
+  8027ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8027b1:	39 cb                	cmp    %ecx,%ebx
+  8027b3:	0f 47 d9             	cmova  %ecx,%ebx
+  8027b6:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8027ba:	75 80                	jne    80273c <fsring_rw+0x1aa>
+  8027bc:	8b 57 0c             	mov    0xc(%edi),%edx
+  8027bf:	89 10                	mov    %edx,(%eax)
+  8027c1:	89 58 04             	mov    %ebx,0x4(%eax)
+  8027c4:	89 f2                	mov    %esi,%edx
+  8027c6:	03 57 04             	add    0x4(%edi),%edx
+  8027c9:	89 50 08             	mov    %edx,0x8(%eax)
+  8027cc:	eb 95                	jmp    802763 <fsring_rw+0x1d1>
+  8027ce:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8027d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027d6:	83 ec 0c             	sub    $0xc,%esp
+  8027d9:	68 00 00 f0 cf       	push   $0xcff00000
+  8027de:	e8 94 0b 00 00       	call   803377 <ipcring_rsp_wait>
+  8027e3:	8b 58 04             	mov    0x4(%eax),%ebx
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8027ed:	75 45                	jne    802834 <fsring_rw+0x2a2>
+  8027ef:	85 db                	test   %ebx,%ebx
+  8027f1:	79 41                	jns    802834 <fsring_rw+0x2a2>
+  8027f3:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8027f6:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8027fd:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802804:	83 ec 0c             	sub    $0xc,%esp
+  802807:	68 00 00 f0 cf       	push   $0xcff00000
+  80280c:	e8 cc 0b 00 00       	call   8033dd <ipcring_rsp_pop>
+  802811:	83 c4 10             	add    $0x10,%esp
+  802814:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80281a:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80281f:	39 c2                	cmp    %eax,%edx
+  802821:	74 75                	je     802898 <fsring_rw+0x306>
+  802823:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802827:	75 a5                	jne    8027ce <fsring_rw+0x23c>
+  802829:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80282c:	0f 82 50 ff ff ff    	jb     802782 <fsring_rw+0x1f0>
+  802832:	eb 9a                	jmp    8027ce <fsring_rw+0x23c>
+  802834:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802838:	75 ca                	jne    802804 <fsring_rw+0x272>
+  80283a:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80283e:	74 31                	je     802871 <fsring_rw+0x2df>
+  802840:	8b 45 08             	mov    0x8(%ebp),%eax
+  802843:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802846:	29 c8                	sub    %ecx,%eax
+  802848:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80284b:	39 d0                	cmp    %edx,%eax
+  80284d:	0f 47 c2             	cmova  %edx,%eax
+  802850:	39 d8                	cmp    %ebx,%eax
+  802852:	ba 01 00 00 00       	mov    $0x1,%edx
+  802857:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80285b:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80285e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802863:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802867:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80286a:	01 d9                	add    %ebx,%ecx
+  80286c:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80286f:	eb 93                	jmp    802804 <fsring_rw+0x272>
+  802871:	83 ec 04             	sub    $0x4,%esp
+  802874:	53                   	push   %ebx
+  802875:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802878:	83 e0 07             	and    $0x7,%eax
+  80287b:	c1 e0 0c             	shl    $0xc,%eax
+  80287e:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802884:	50                   	push   %eax
+  802885:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802888:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80288b:	01 c8                	add    %ecx,%eax
+  80288d:	50                   	push   %eax
+  80288e:	e8 c6 e3 ff ff       	call   800c59 <memmove>
+  802893:	83 c4 10             	add    $0x10,%esp
+  802896:	eb a8                	jmp    802840 <fsring_rw+0x2ae>
+  802898:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80289c:	75 09                	jne    8028a7 <fsring_rw+0x315>
+  80289e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8028a1:	0f 82 db fe ff ff    	jb     802782 <fsring_rw+0x1f0>
+  8028a7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8028aa:	01 57 04             	add    %edx,0x4(%edi)
+  8028ad:	85 d2                	test   %edx,%edx
+  8028af:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8028b3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8028b6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8028b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028bc:	5b                   	pop    %ebx
+  8028bd:	5e                   	pop    %esi
+  8028be:	5f                   	pop    %edi
+  8028bf:	5d                   	pop    %ebp
+  8028c0:	c3                   	ret
+
+008028c1 <devfile_write>:
+  8028c1:	55                   	push   %ebp
+  8028c2:	89 e5                	mov    %esp,%ebp
+  8028c4:	57                   	push   %edi
+  8028c5:	56                   	push   %esi
+  8028c6:	53                   	push   %ebx
+  8028c7:	83 ec 0c             	sub    $0xc,%esp
+  8028ca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028d3:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8028d9:	76 1a                	jbe    8028f5 <devfile_write+0x34>
+  8028db:	83 ec 0c             	sub    $0xc,%esp
+  8028de:	53                   	push   %ebx
+  8028df:	89 f1                	mov    %esi,%ecx
+  8028e1:	ba 06 00 00 00       	mov    $0x6,%edx
+  8028e6:	89 f8                	mov    %edi,%eax
+  8028e8:	e8 a5 fc ff ff       	call   802592 <fsring_rw>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+  8028f0:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8028f3:	75 39                	jne    80292e <devfile_write+0x6d>
+  8028f5:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8028fa:	39 c3                	cmp    %eax,%ebx
+  8028fc:	0f 47 d8             	cmova  %eax,%ebx
+  8028ff:	8b 47 0c             	mov    0xc(%edi),%eax
+  802902:	a3 00 70 80 00       	mov    %eax,0x807000
+  802907:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80290d:	83 ec 04             	sub    $0x4,%esp
+  802910:	53                   	push   %ebx
+  802911:	56                   	push   %esi
+  802912:	68 08 70 80 00       	push   $0x807008
+  802917:	e8 3d e3 ff ff       	call   800c59 <memmove>
+  80291c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802921:	b8 04 00 00 00       	mov    $0x4,%eax
+  802926:	e8 7c fb ff ff       	call   8024a7 <fsipc>
+  80292b:	83 c4 10             	add    $0x10,%esp
+  80292e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802931:	5b                   	pop    %ebx
+  802932:	5e                   	pop    %esi
+  802933:	5f                   	pop    %edi
+  802934:	5d                   	pop    %ebp
+  802935:	c3                   	ret
+
+00802936 <devfile_read>:
+  802936:	55                   	push   %ebp
+  802937:	89 e5                	mov    %esp,%ebp
+  802939:	57                   	push   %edi
+  80293a:	56                   	push   %esi
+  80293b:	53                   	push   %ebx
+  80293c:	83 ec 0c             	sub    $0xc,%esp
+  80293f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802942:	8b 75 10             	mov    0x10(%ebp),%esi
+  802945:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80294b:	76 1d                	jbe    80296a <devfile_read+0x34>
+  80294d:	83 ec 0c             	sub    $0xc,%esp
+  802950:	56                   	push   %esi
+  802951:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802954:	ba 05 00 00 00       	mov    $0x5,%edx
+  802959:	89 f8                	mov    %edi,%eax
+  80295b:	e8 32 fc ff ff       	call   802592 <fsring_rw>
+  802960:	89 c3                	mov    %eax,%ebx
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802968:	75 37                	jne    8029a1 <devfile_read+0x6b>
+  80296a:	8b 47 0c             	mov    0xc(%edi),%eax
+  80296d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802972:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802978:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802982:	e8 20 fb ff ff       	call   8024a7 <fsipc>
+  802987:	89 c3                	mov    %eax,%ebx
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	78 14                	js     8029a1 <devfile_read+0x6b>
+  80298d:	83 ec 04             	sub    $0x4,%esp
+  802990:	50                   	push   %eax
+  802991:	68 00 70 80 00       	push   $0x807000
+  802996:	ff 75 0c             	push   0xc(%ebp)
+  802999:	e8 bb e2 ff ff       	call   800c59 <memmove>
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	89 d8                	mov    %ebx,%eax
+  8029a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a6:	5b                   	pop    %ebx
+  8029a7:	5e                   	pop    %esi
+  8029a8:	5f                   	pop    %edi
+  8029a9:	5d                   	pop    %ebp
+  8029aa:	c3                   	ret
+
+008029ab <open>:
+  8029ab:	55                   	push   %ebp
+  8029ac:	89 e5                	mov    %esp,%ebp
+  8029ae:	56                   	push   %esi
+  8029af:	53                   	push   %ebx
+  8029b0:	83 ec 1c             	sub    $0x1c,%esp
+  8029b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029b6:	56                   	push   %esi
+  8029b7:	e8 a1 e0 ff ff       	call   800a5d <strlen>
+  8029bc:	83 c4 10             	add    $0x10,%esp
+  8029bf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029c4:	7f 6c                	jg     802a32 <open+0x87>
+  8029c6:	83 ec 0c             	sub    $0xc,%esp
+  8029c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029cc:	50                   	push   %eax
+  8029cd:	e8 6a f5 ff ff       	call   801f3c <fd_alloc>
+  8029d2:	89 c3                	mov    %eax,%ebx
+  8029d4:	83 c4 10             	add    $0x10,%esp
+  8029d7:	85 c0                	test   %eax,%eax
+  8029d9:	78 3c                	js     802a17 <open+0x6c>
+  8029db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029de:	a3 00 74 80 00       	mov    %eax,0x807400
+  8029e3:	83 ec 08             	sub    $0x8,%esp
+  8029e6:	56                   	push   %esi
+  8029e7:	68 00 70 80 00       	push   $0x807000
+  8029ec:	e8 b8 e0 ff ff       	call   800aa9 <strcpy>
+  8029f1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f9:	e8 a9 fa ff ff       	call   8024a7 <fsipc>
+  8029fe:	89 c3                	mov    %eax,%ebx
+  802a00:	83 c4 10             	add    $0x10,%esp
+  802a03:	85 c0                	test   %eax,%eax
+  802a05:	78 19                	js     802a20 <open+0x75>
+  802a07:	83 ec 0c             	sub    $0xc,%esp
+  802a0a:	ff 75 f4             	push   -0xc(%ebp)
+  802a0d:	e8 03 f5 ff ff       	call   801f15 <fd2num>
+  802a12:	89 c3                	mov    %eax,%ebx
+  802a14:	83 c4 10             	add    $0x10,%esp
+  802a17:	89 d8                	mov    %ebx,%eax
+  802a19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a1c:	5b                   	pop    %ebx
+  802a1d:	5e                   	pop    %esi
+  802a1e:	5d                   	pop    %ebp
+  802a1f:	c3                   	ret
+  802a20:	83 ec 08             	sub    $0x8,%esp
+  802a23:	6a 00                	push   $0x0
+  802a25:	ff 75 f4             	push   -0xc(%ebp)
+  802a28:	e8 05 f6 ff ff       	call   802032 <fd_close>
+  802a2d:	83 c4 10             	add    $0x10,%esp
+  802a30:	eb e5                	jmp    802a17 <open+0x6c>
+  802a32:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a37:	eb de                	jmp    802a17 <open+0x6c>
+
+00802a39 <file_image>:
+  802a39:	55                   	push   %ebp
+  802a3a:	89 e5                	mov    %esp,%ebp
+  802a3c:	53                   	push   %ebx
+  802a3d:	83 ec 1c             	sub    $0x1c,%esp
+  802a40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a46:	50                   	push   %eax
+  802a47:	ff 75 08             	push   0x8(%ebp)
+  802a4a:	e8 3d f5 ff ff       	call   801f8c <fd_lookup>
+  802a4f:	83 c4 10             	add    $0x10,%esp
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	78 58                	js     802aae <file_image+0x75>
+  802a56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a59:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802a5f:	39 08                	cmp    %ecx,(%eax)
+  802a61:	75 50                	jne    802ab3 <file_image+0x7a>
+  802a63:	83 fb 04             	cmp    $0x4,%ebx
+  802a66:	77 52                	ja     802aba <file_image+0x81>
+  802a68:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a6b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a70:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802a76:	83 ec 04             	sub    $0x4,%esp
+  802a79:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802a7c:	c1 e0 02             	shl    $0x2,%eax
+  802a7f:	50                   	push   %eax
+  802a80:	ff 75 0c             	push   0xc(%ebp)
+  802a83:	68 08 70 80 00       	push   $0x807008
+  802a88:	e8 cc e1 ff ff       	call   800c59 <memmove>
+  802a8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a92:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a97:	e8 0b fa ff ff       	call   8024a7 <fsipc>
+  802a9c:	83 c4 10             	add    $0x10,%esp
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	78 0b                	js     802aae <file_image+0x75>
+  802aa3:	8b 55 14             	mov    0x14(%ebp),%edx
+  802aa6:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+  802aac:	89 0a                	mov    %ecx,(%edx)
+  802aae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab1:	c9                   	leave
+  802ab2:	c3                   	ret
+  802ab3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ab8:	eb f4                	jmp    802aae <file_image+0x75>
+  802aba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802abf:	eb ed                	jmp    802aae <file_image+0x75>
+
+00802ac1 <remove>:
+  802ac1:	55                   	push   %ebp
+  802ac2:	89 e5                	mov    %esp,%ebp
+  802ac4:	53                   	push   %ebx
+  802ac5:	83 ec 10             	sub    $0x10,%esp
+  802ac8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802acb:	53                   	push   %ebx
+  802acc:	e8 8c df ff ff       	call   800a5d <strlen>
+  802ad1:	83 c4 10             	add    $0x10,%esp
+  802ad4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ad9:	7f 25                	jg     802b00 <remove+0x3f>
+  802adb:	83 ec 08             	sub    $0x8,%esp
+  802ade:	53                   	push   %ebx
+  802adf:	68 00 70 80 00       	push   $0x807000
+  802ae4:	e8 c0 df ff ff       	call   800aa9 <strcpy>
+  802ae9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aee:	b8 09 00 00 00       	mov    $0x9,%eax
+  802af3:	e8 af f9 ff ff       	call   8024a7 <fsipc>
+  802af8:	83 c4 10             	add    $0x10,%esp
+  802afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+  802b00:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b05:	eb f4                	jmp    802afb <remove+0x3a>
+
+00802b07 <sync>:
+  802b07:	55                   	push   %ebp
+  802b08:	89 e5                	mov    %esp,%ebp
+  802b0a:	83 ec 08             	sub    $0x8,%esp
+  802b0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b12:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b17:	e8 8b f9 ff ff       	call   8024a7 <fsipc>
+  802b1c:	c9                   	leave
+  802b1d:	c3                   	ret
+
+00802b1e <devsock_stat>:
+  802b1e:	55                   	push   %ebp
+  802b1f:	89 e5                	mov    %esp,%ebp
+  802b21:	83 ec 10             	sub    $0x10,%esp
+  802b24:	68 7c 3f 80 00       	push   $0x803f7c
+  802b29:	ff 75 0c             	push   0xc(%ebp)
+  802b2c:	e8 78 df ff ff       	call   800aa9 <strcpy>
+  802b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b36:	c9                   	leave
+  802b37:	c3                   	ret
+
+00802b38 <devsock_close>:
+  802b38:	55                   	push   %ebp
+  802b39:	89 e5                	mov    %esp,%ebp
+  802b3b:	53                   	push   %ebx
+  802b3c:	83 ec 10             	sub    $0x10,%esp
+  802b3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b42:	53                   	push   %ebx
+  802b43:	e8 cf 0b 00 00       	call   803717 <pageref>
+  802b48:	89 c2                	mov    %eax,%edx
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b52:	83 fa 01             	cmp    $0x1,%edx
+  802b55:	74 05                	je     802b5c <devsock_close+0x24>
+  802b57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+  802b5c:	83 ec 0c             	sub    $0xc,%esp
+  802b5f:	ff 73 0c             	push   0xc(%ebx)
+  802b62:	e8 aa 02 00 00       	call   802e11 <nsipc_close>
+  802b67:	83 c4 10             	add    $0x10,%esp
+  802b6a:	eb eb                	jmp    802b57 <devsock_close+0x1f>
+
+00802b6c <devsock_write>:
+  802b6c:	55                   	push   %ebp
+  802b6d:	89 e5                	mov    %esp,%ebp
+  802b6f:	83 ec 08             	sub    $0x8,%esp
+  802b72:	6a 00                	push   $0x0
+  802b74:	ff 75 10             	push   0x10(%ebp)
+  802b77:	ff 75 0c             	push   0xc(%ebp)
+  802b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7d:	ff 70 0c             	push   0xc(%eax)
+  802b80:	e8 6c 03 00 00       	call   802ef1 <nsipc_send>
+  802b85:	c9                   	leave
+  802b86:	c3                   	ret
+
+00802b87 <devsock_read>:
+  802b87:	55                   	push   %ebp
+  802b88:	89 e5                	mov    %esp,%ebp
+  802b8a:	83 ec 08             	sub    $0x8,%esp
+  802b8d:	6a 00                	push   $0x0
+  802b8f:	ff 75 10             	push   0x10(%ebp)
+  802b92:	ff 75 0c             	push   0xc(%ebp)
+  802b95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b98:	ff 70 0c             	push   0xc(%eax)
+  802b9b:	e8 e2 02 00 00       	call   802e82 <nsipc_recv>
+  802ba0:	c9                   	leave
+  802ba1:	c3                   	ret
+
+00802ba2 <fd2sockid>:
+  802ba2:	55                   	push   %ebp
+  802ba3:	89 e5                	mov    %esp,%ebp
+  802ba5:	83 ec 20             	sub    $0x20,%esp
+  802ba8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bab:	52                   	push   %edx
+  802bac:	50                   	push   %eax
+  802bad:	e8 da f3 ff ff       	call   801f8c <fd_lookup>
+  802bb2:	83 c4 10             	add    $0x10,%esp
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	78 10                	js     802bc9 <fd2sockid+0x27>
+  802bb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bbc:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802bc2:	39 08                	cmp    %ecx,(%eax)
+  802bc4:	75 05                	jne    802bcb <fd2sockid+0x29>
+  802bc6:	8b 40 0c             	mov    0xc(%eax),%eax
+  802bc9:	c9                   	leave
+  802bca:	c3                   	ret
+  802bcb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bd0:	eb f7                	jmp    802bc9 <fd2sockid+0x27>
+
+00802bd2 <alloc_sockfd>:
+  802bd2:	55                   	push   %ebp
+  802bd3:	89 e5                	mov    %esp,%ebp
+  802bd5:	56                   	push   %esi
+  802bd6:	53                   	push   %ebx
+  802bd7:	83 ec 1c             	sub    $0x1c,%esp
+  802bda:	89 c6                	mov    %eax,%esi
+  802bdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bdf:	50                   	push   %eax
+  802be0:	e8 57 f3 ff ff       	call   801f3c <fd_alloc>
+  802be5:	89 c3                	mov    %eax,%ebx
+  802be7:	83 c4 10             	add    $0x10,%esp
+  802bea:	85 c0                	test   %eax,%eax
+  802bec:	78 43                	js     802c31 <alloc_sockfd+0x5f>
+  802bee:	83 ec 04             	sub    $0x4,%esp
+  802bf1:	68 07 04 00 00       	push   $0x407
+  802bf6:	ff 75 f4             	push   -0xc(%ebp)
+  802bf9:	6a 00                	push   $0x0
+  802bfb:	e8 09 e3 ff ff       	call   800f09 <sys_page_alloc>
+  802c00:	89 c3                	mov    %eax,%ebx
+  802c02:	83 c4 10             	add    $0x10,%esp
+  802c05:	85 c0                	test   %eax,%eax
+  802c07:	78 28                	js     802c31 <alloc_sockfd+0x5f>
+  802c09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c0c:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802c12:	89 10                	mov    %edx,(%eax)
+  802c14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c17:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c1e:	89 70 0c             	mov    %esi,0xc(%eax)
+  802c21:	83 ec 0c             	sub    $0xc,%esp
+  802c24:	50                   	push   %eax
+  802c25:	e8 eb f2 ff ff       	call   801f15 <fd2num>
+  802c2a:	89 c3                	mov    %eax,%ebx
+  802c2c:	83 c4 10             	add    $0x10,%esp
+  802c2f:	eb 0c                	jmp    802c3d <alloc_sockfd+0x6b>
+  802c31:	83 ec 0c             	sub    $0xc,%esp
+  802c34:	56                   	push   %esi
+  802c35:	e8 d7 01 00 00       	call   802e11 <nsipc_close>
+  802c3a:	83 c4 10             	add    $0x10,%esp
+  802c3d:	89 d8                	mov    %ebx,%eax
+  802c3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c42:	5b                   	pop    %ebx
+  802c43:	5e                   	pop    %esi
+  802c44:	5d                   	pop    %ebp
+  802c45:	c3                   	ret
+
+00802c46 <accept>:
+  802c46:	55                   	push   %ebp
+  802c47:	89 e5                	mov    %esp,%ebp
+  802c49:	83 ec 08             	sub    $0x8,%esp
+  802c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4f:	e8 4e ff ff ff       	call   802ba2 <fd2sockid>
+  802c54:	85 c0                	test   %eax,%eax
+  802c56:	78 1b                	js     802c73 <accept+0x2d>
+  802c58:	83 ec 04             	sub    $0x4,%esp
+  802c5b:	ff 75 10             	push   0x10(%ebp)
+  802c5e:	ff 75 0c             	push   0xc(%ebp)
+  802c61:	50                   	push   %eax
+  802c62:	e8 07 01 00 00       	call   802d6e <nsipc_accept>
+  802c67:	83 c4 10             	add    $0x10,%esp
+  802c6a:	85 c0                	test   %eax,%eax
+  802c6c:	78 05                	js     802c73 <accept+0x2d>
+  802c6e:	e8 5f ff ff ff       	call   802bd2 <alloc_sockfd>
+  802c73:	c9                   	leave
+  802c74:	c3                   	ret
+
+00802c75 <bind>:
+  802c75:	55                   	push   %ebp
+  802c76:	89 e5                	mov    %esp,%ebp
+  802c78:	83 ec 08             	sub    $0x8,%esp
+  802c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7e:	e8 1f ff ff ff       	call   802ba2 <fd2sockid>
+  802c83:	85 c0                	test   %eax,%eax
+  802c85:	78 12                	js     802c99 <bind+0x24>
+  802c87:	83 ec 04             	sub    $0x4,%esp
+  802c8a:	ff 75 10             	push   0x10(%ebp)
+  802c8d:	ff 75 0c             	push   0xc(%ebp)
+  802c90:	50                   	push   %eax
+  802c91:	e8 24 01 00 00       	call   802dba <nsipc_bind>
+  802c96:	83 c4 10             	add    $0x10,%esp
+  802c99:	c9                   	leave
+  802c9a:	c3                   	ret
+
+00802c9b <shutdown>:
+  802c9b:	55                   	push   %ebp
+  802c9c:	89 e5                	mov    %esp,%ebp
+  802c9e:	83 ec 08             	sub    $0x8,%esp
+  802ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca4:	e8 f9 fe ff ff       	call   802ba2 <fd2sockid>
+  802ca9:	85 c0                	test   %eax,%eax
+  802cab:	78 0f                	js     802cbc <shutdown+0x21>
+  802cad:	83 ec 08             	sub    $0x8,%esp
+  802cb0:	ff 75 0c             	push   0xc(%ebp)
+  802cb3:	50                   	push   %eax
+  802cb4:	e8 36 01 00 00       	call   802def <nsipc_shutdown>
+  802cb9:	83 c4 10             	add    $0x10,%esp
+  802cbc:	c9                   	leave
+  802cbd:	c3                   	ret
+
+00802cbe <connect>:
+  802cbe:	55                   	push   %ebp
+  802cbf:	89 e5                	mov    %esp,%ebp
+  802cc1:	83 ec 08             	sub    $0x8,%esp
+  802cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc7:	e8 d6 fe ff ff       	call   802ba2 <fd2sockid>
+  802ccc:	85 c0                	test   %eax,%eax
+  802cce:	78 12                	js     802ce2 <connect+0x24>
+  802cd0:	83 ec 04             	sub    $0x4,%esp
+  802cd3:	ff 75 10             	push   0x10(%ebp)
+  802cd6:	ff 75 0c             	push   0xc(%ebp)
+  802cd9:	50                   	push   %eax
+  802cda:	e8 4c 01 00 00       	call   802e2b <nsipc_connect>
+  802cdf:	83 c4 10             	add    $0x10,%esp
+  802ce2:	c9                   	leave
+  802ce3:	c3                   	ret
+
+00802ce4 <listen>:
+  802ce4:	55                   	push   %ebp
+  802ce5:	89 e5                	mov    %esp,%ebp
+  802ce7:	83 ec 08             	sub    $0x8,%esp
+  802cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ced:	e8 b0 fe ff ff       	call   802ba2 <fd2sockid>
+  802cf2:	85 c0                	test   %eax,%eax
+  802cf4:	78 0f                	js     802d05 <listen+0x21>
+  802cf6:	83 ec 08             	sub    $0x8,%esp
+  802cf9:	ff 75 0c             	push   0xc(%ebp)
+  802cfc:	50                   	push   %eax
+  802cfd:	e8 5e 01 00 00       	call   802e60 <nsipc_listen>
+  802d02:	83 c4 10             	add    $0x10,%esp
+  802d05:	c9                   	leave
+  802d06:	c3                   	ret
+
+00802d07 <socket>:
+  802d07:	55                   	push   %ebp
+  802d08:	89 e5                	mov    %esp,%ebp
+  802d0a:	83 ec 0c             	sub    $0xc,%esp
+  802d0d:	ff 75 10             	push   0x10(%ebp)
+  802d10:	ff 75 0c             	push   0xc(%ebp)
+  802d13:	ff 75 08             	push   0x8(%ebp)
+  802d16:	e8 34 02 00 00       	call   802f4f <nsipc_socket>
+  802d1b:	83 c4 10             	add    $0x10,%esp
+  802d1e:	85 c0                	test   %eax,%eax
+  802d20:	78 05                	js     802d27 <socket+0x20>
+  802d22:	e8 ab fe ff ff       	call   802bd2 <alloc_sockfd>
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+00802d29 <nsipc>:
+  802d29:	55                   	push   %ebp
+  802d2a:	89 e5                	mov    %esp,%ebp
+  802d2c:	53                   	push   %ebx
+  802d2d:	83 ec 04             	sub    $0x4,%esp
+  802d30:	89 c3                	mov    %eax,%ebx
+  802d32:	83 3d 14 60 80 00 00 	cmpl   $0x0,0x806014
+  802d39:	74 1f                	je     802d5a <nsipc+0x31>
+  802d3b:	83 ec 08             	sub    $0x8,%esp
+  802d3e:	6a 00                	push   $0x0
+  802d40:	6a 00                	push   $0x0
+  802d42:	6a 07                	push   $0x7
+  802d44:	68 00 80 80 00       	push   $0x808000
+  802d49:	53                   	push   %ebx
+  802d4a:	ff 35 14 60 80 00    	push   0x806014
+  802d50:	e8 0b f0 ff ff       	call   801d60 <ipc_call>
+  802d55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d58:	c9                   	leave
+  802d59:	c3                   	ret
+  802d5a:	83 ec 0c             	sub    $0xc,%esp
+  802d5d:	6a 03                	push   $0x3
+  802d5f:	e8 97 f1 ff ff       	call   801efb <ipc_find_env>
+  802d64:	a3 14 60 80 00       	mov    %eax,0x806014
+  802d69:	83 c4 10             	add    $0x10,%esp
+  802d6c:	eb cd                	jmp    802d3b <nsipc+0x12>
+
+00802d6e <nsipc_accept>:
+  802d6e:	55                   	push   %ebp
+  802d6f:	89 e5                	mov    %esp,%ebp
+  802d71:	53                   	push   %ebx
+  802d72:	83 ec 04             	sub    $0x4,%esp
+  802d75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d78:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d82:	e8 a2 ff ff ff       	call   802d29 <nsipc>
+  802d87:	89 c3                	mov    %eax,%ebx
+  802d89:	85 c0                	test   %eax,%eax
+  802d8b:	79 07                	jns    802d94 <nsipc_accept+0x26>
+  802d8d:	89 d8                	mov    %ebx,%eax
+  802d8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d92:	c9                   	leave
+  802d93:	c3                   	ret
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	ff 35 10 80 80 00    	push   0x808010
+  802d9d:	68 00 80 80 00       	push   $0x808000
+  802da2:	ff 75 0c             	push   0xc(%ebp)
+  802da5:	e8 af de ff ff       	call   800c59 <memmove>
+  802daa:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802db0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802db3:	89 10                	mov    %edx,(%eax)
+  802db5:	83 c4 10             	add    $0x10,%esp
+  802db8:	eb d3                	jmp    802d8d <nsipc_accept+0x1f>
+
+00802dba <nsipc_bind>:
+  802dba:	55                   	push   %ebp
+  802dbb:	89 e5                	mov    %esp,%ebp
+  802dbd:	53                   	push   %ebx
+  802dbe:	83 ec 08             	sub    $0x8,%esp
+  802dc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc7:	a3 00 80 80 00       	mov    %eax,0x808000
+  802dcc:	53                   	push   %ebx
+  802dcd:	ff 75 0c             	push   0xc(%ebp)
+  802dd0:	68 04 80 80 00       	push   $0x808004
+  802dd5:	e8 7f de ff ff       	call   800c59 <memmove>
+  802dda:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802de0:	b8 02 00 00 00       	mov    $0x2,%eax
+  802de5:	e8 3f ff ff ff       	call   802d29 <nsipc>
+  802dea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ded:	c9                   	leave
+  802dee:	c3                   	ret
+
+00802def <nsipc_shutdown>:
+  802def:	55                   	push   %ebp
+  802df0:	89 e5                	mov    %esp,%ebp
+  802df2:	83 ec 08             	sub    $0x8,%esp
+  802df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df8:	a3 00 80 80 00       	mov    %eax,0x808000
+  802dfd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e00:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e05:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e0a:	e8 1a ff ff ff       	call   802d29 <nsipc>
+  802e0f:	c9                   	leave
+  802e10:	c3                   	ret
+
+00802e11 <nsipc_close>:
+  802e11:	55                   	push   %ebp
+  802e12:	89 e5                	mov    %esp,%ebp
+  802e14:	83 ec 08             	sub    $0x8,%esp
+  802e17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e1a:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e1f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e24:	e8 00 ff ff ff       	call   802d29 <nsipc>
+  802e29:	c9                   	leave
+  802e2a:	c3                   	ret
+
+00802e2b <nsipc_connect>:
+  802e2b:	55                   	push   %ebp
+  802e2c:	89 e5                	mov    %esp,%ebp
+  802e2e:	53                   	push   %ebx
+  802e2f:	83 ec 08             	sub    $0x8,%esp
+  802e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e38:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e3d:	53                   	push   %ebx
+  802e3e:	ff 75 0c             	push   0xc(%ebp)
+  802e41:	68 04 80 80 00       	push   $0x808004
+  802e46:	e8 0e de ff ff       	call   800c59 <memmove>
+  802e4b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802e51:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e56:	e8 ce fe ff ff       	call   802d29 <nsipc>
+  802e5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e5e:	c9                   	leave
+  802e5f:	c3                   	ret
+
+00802e60 <nsipc_listen>:
+  802e60:	55                   	push   %ebp
+  802e61:	89 e5                	mov    %esp,%ebp
+  802e63:	83 ec 08             	sub    $0x8,%esp
+  802e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e69:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e71:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e76:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e7b:	e8 a9 fe ff ff       	call   802d29 <nsipc>
+  802e80:	c9                   	leave
+  802e81:	c3                   	ret
+
+00802e82 <nsipc_recv>:
+  802e82:	55                   	push   %ebp
+  802e83:	89 e5                	mov    %esp,%ebp
+  802e85:	56                   	push   %esi
+  802e86:	53                   	push   %ebx
+  802e87:	8b 75 10             	mov    0x10(%ebp),%esi
+  802e8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8d:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e92:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802e98:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9b:	a3 08 80 80 00       	mov    %eax,0x808008
+  802ea0:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ea5:	e8 7f fe ff ff       	call   802d29 <nsipc>
+  802eaa:	89 c3                	mov    %eax,%ebx
+  802eac:	85 c0                	test   %eax,%eax
+  802eae:	78 22                	js     802ed2 <nsipc_recv+0x50>
+  802eb0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802eb5:	39 c6                	cmp    %eax,%esi
+  802eb7:	0f 4e c6             	cmovle %esi,%eax
+  802eba:	39 c3                	cmp    %eax,%ebx
+  802ebc:	7f 1d                	jg     802edb <nsipc_recv+0x59>
+  802ebe:	83 ec 04             	sub    $0x4,%esp
+  802ec1:	53                   	push   %ebx
+  802ec2:	68 00 80 80 00       	push   $0x808000
+  802ec7:	ff 75 0c             	push   0xc(%ebp)
+  802eca:	e8 8a dd ff ff       	call   800c59 <memmove>
+  802ecf:	83 c4 10             	add    $0x10,%esp
+  802ed2:	89 d8                	mov    %ebx,%eax
+  802ed4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ed7:	5b                   	pop    %ebx
+  802ed8:	5e                   	pop    %esi
+  802ed9:	5d                   	pop    %ebp
+  802eda:	c3                   	ret
+  802edb:	68 88 3f 80 00       	push   $0x803f88
+  802ee0:	68 9d 3f 80 00       	push   $0x803f9d
+  802ee5:	6a 60                	push   $0x60
+  802ee7:	68 b2 3f 80 00       	push   $0x803fb2
+  802eec:	e8 e6 d3 ff ff       	call   8002d7 <_panic>
+
+00802ef1 <nsipc_send>:
+  802ef1:	55                   	push   %ebp
+  802ef2:	89 e5                	mov    %esp,%ebp
+  802ef4:	53                   	push   %ebx
+  802ef5:	83 ec 04             	sub    $0x4,%esp
+  802ef8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802efb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efe:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f03:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f09:	7f 2e                	jg     802f39 <nsipc_send+0x48>
+  802f0b:	83 ec 04             	sub    $0x4,%esp
+  802f0e:	53                   	push   %ebx
+  802f0f:	ff 75 0c             	push   0xc(%ebp)
+  802f12:	68 0c 80 80 00       	push   $0x80800c
+  802f17:	e8 3d dd ff ff       	call   800c59 <memmove>
+  802f1c:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802f22:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f25:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f2a:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f2f:	e8 f5 fd ff ff       	call   802d29 <nsipc>
+  802f34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f37:	c9                   	leave
+  802f38:	c3                   	ret
+  802f39:	68 be 3f 80 00       	push   $0x803fbe
+  802f3e:	68 9d 3f 80 00       	push   $0x803f9d
+  802f43:	6a 6b                	push   $0x6b
+  802f45:	68 b2 3f 80 00       	push   $0x803fb2
+  802f4a:	e8 88 d3 ff ff       	call   8002d7 <_panic>
+
+00802f4f <nsipc_socket>:
+  802f4f:	55                   	push   %ebp
+  802f50:	89 e5                	mov    %esp,%ebp
+  802f52:	83 ec 08             	sub    $0x8,%esp
+  802f55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f58:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f60:	a3 04 80 80 00       	mov    %eax,0x808004
+  802f65:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f68:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f6d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f72:	e8 b2 fd ff ff       	call   802d29 <nsipc>
+  802f77:	c9                   	leave
+  802f78:	c3                   	ret
+
+00802f79 <devpipe_stat>:
+  802f79:	55                   	push   %ebp
+  802f7a:	89 e5                	mov    %esp,%ebp
+  802f7c:	56                   	push   %esi
+  802f7d:	53                   	push   %ebx
+  802f7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802f81:	83 ec 0c             	sub    $0xc,%esp
+  802f84:	ff 75 08             	push   0x8(%ebp)
+  802f87:	e8 99 ef ff ff       	call   801f25 <fd2data>
+  802f8c:	89 c6                	mov    %eax,%esi
+  802f8e:	83 c4 08             	add    $0x8,%esp
+  802f91:	68 ca 3f 80 00       	push   $0x803fca
+  802f96:	53                   	push   %ebx
+  802f97:	e8 0d db ff ff       	call   800aa9 <strcpy>
+  802f9c:	8b 46 04             	mov    0x4(%esi),%eax
+  802f9f:	2b 06                	sub    (%esi),%eax
+  802fa1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802fa7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fae:	00 00 00 
+  802fb1:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802fb8:	50 80 00 
+  802fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fc3:	5b                   	pop    %ebx
+  802fc4:	5e                   	pop    %esi
+  802fc5:	5d                   	pop    %ebp
+  802fc6:	c3                   	ret
+
+00802fc7 <devpipe_close>:
+  802fc7:	55                   	push   %ebp
+  802fc8:	89 e5                	mov    %esp,%ebp
+  802fca:	53                   	push   %ebx
+  802fcb:	83 ec 0c             	sub    $0xc,%esp
+  802fce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fd1:	53                   	push   %ebx
+  802fd2:	6a 00                	push   $0x0
+  802fd4:	e8 02 e0 ff ff       	call   800fdb <sys_page_unmap>
+  802fd9:	89 1c 24             	mov    %ebx,(%esp)
+  802fdc:	e8 44 ef ff ff       	call   801f25 <fd2data>
+  802fe1:	83 c4 08             	add    $0x8,%esp
+  802fe4:	50                   	push   %eax
+  802fe5:	6a 00                	push   $0x0
+  802fe7:	e8 ef df ff ff       	call   800fdb <sys_page_unmap>
+  802fec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fef:	c9                   	leave
+  802ff0:	c3                   	ret
+
+00802ff1 <_pipeisclosed>:
+  802ff1:	55                   	push   %ebp
+  802ff2:	89 e5                	mov    %esp,%ebp
+  802ff4:	57                   	push   %edi
+  802ff5:	56                   	push   %esi
+  802ff6:	53                   	push   %ebx
+  802ff7:	83 ec 1c             	sub    $0x1c,%esp
+  802ffa:	89 c7                	mov    %eax,%edi
+  802ffc:	89 d6                	mov    %edx,%esi
+  802ffe:	a1 18 60 80 00       	mov    0x806018,%eax
+  803003:	8b 58 58             	mov    0x58(%eax),%ebx
+  803006:	83 ec 0c             	sub    $0xc,%esp
+  803009:	57                   	push   %edi
+  80300a:	e8 08 07 00 00       	call   803717 <pageref>
+  80300f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803012:	89 34 24             	mov    %esi,(%esp)
+  803015:	e8 fd 06 00 00       	call   803717 <pageref>
+  80301a:	8b 15 18 60 80 00    	mov    0x806018,%edx
+  803020:	8b 4a 58             	mov    0x58(%edx),%ecx
+  803023:	83 c4 10             	add    $0x10,%esp
+  803026:	39 cb                	cmp    %ecx,%ebx
+  803028:	74 1b                	je     803045 <_pipeisclosed+0x54>
+  80302a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80302d:	75 cf                	jne    802ffe <_pipeisclosed+0xd>
+  80302f:	8b 42 58             	mov    0x58(%edx),%eax
+  803032:	6a 01                	push   $0x1
+  803034:	50                   	push   %eax
+  803035:	53                   	push   %ebx
+  803036:	68 d1 3f 80 00       	push   $0x803fd1
+  80303b:	e8 72 d3 ff ff       	call   8003b2 <cprintf>
+  803040:	83 c4 10             	add    $0x10,%esp
+  803043:	eb b9                	jmp    802ffe <_pipeisclosed+0xd>
+  803045:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803048:	0f 94 c0             	sete   %al
+  80304b:	0f b6 c0             	movzbl %al,%eax
+  80304e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803051:	5b                   	pop    %ebx
+  803052:	5e                   	pop    %esi
+  803053:	5f                   	pop    %edi
+  803054:	5d                   	pop    %ebp
+  803055:	c3                   	ret
+
+00803056 <devpipe_write>:
+  803056:	55                   	push   %ebp
+  803057:	89 e5                	mov    %esp,%ebp
+  803059:	57                   	push   %edi
+  80305a:	56                   	push   %esi
+  80305b:	53                   	push   %ebx
+  80305c:	83 ec 28             	sub    $0x28,%esp
+  80305f:	8b 75 08             	mov    0x8(%ebp),%esi
+  803062:	56                   	push   %esi
+  803063:	e8 bd ee ff ff       	call   801f25 <fd2data>
+  803068:	89 c3                	mov    %eax,%ebx
+  80306a:	83 c4 10             	add    $0x10,%esp
+  80306d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803072:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803076:	74 5c                	je     8030d4 <devpipe_write+0x7e>
+  803078:	8b 43 04             	mov    0x4(%ebx),%eax
+  80307b:	8b 0b                	mov    (%ebx),%ecx
+  80307d:	8d 51 20             	lea    0x20(%ecx),%edx
+  803080:	39 d0                	cmp    %edx,%eax
+  803082:	72 1e                	jb     8030a2 <devpipe_write+0x4c>
+  803084:	89 da                	mov    %ebx,%edx
+  803086:	89 f0                	mov    %esi,%eax
+  803088:	e8 64 ff ff ff       	call   802ff1 <_pipeisclosed>
+  80308d:	85 c0                	test   %eax,%eax
+  80308f:	75 48                	jne    8030d9 <devpipe_write+0x83>
+  803091:	e8 28 de ff ff       	call   800ebe <sys_yield>
+  803096:	8b 43 04             	mov    0x4(%ebx),%eax
+  803099:	8b 0b                	mov    (%ebx),%ecx
+  80309b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80309e:	39 d0                	cmp    %edx,%eax
+  8030a0:	73 e2                	jae    803084 <devpipe_write+0x2e>
+  8030a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030a5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030a9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030ac:	89 c2                	mov    %eax,%edx
+  8030ae:	c1 fa 1f             	sar    $0x1f,%edx
+  8030b1:	89 d1                	mov    %edx,%ecx
+  8030b3:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030b6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030b9:	83 e2 1f             	and    $0x1f,%edx
+  8030bc:	29 ca                	sub    %ecx,%edx
+  8030be:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030c2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8030c6:	83 c0 01             	add    $0x1,%eax
+  8030c9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030cc:	83 c7 01             	add    $0x1,%edi
+  8030cf:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8030d2:	75 a4                	jne    803078 <devpipe_write+0x22>
+  8030d4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030d7:	eb 05                	jmp    8030de <devpipe_write+0x88>
+  8030d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030e1:	5b                   	pop    %ebx
+  8030e2:	5e                   	pop    %esi
+  8030e3:	5f                   	pop    %edi
+  8030e4:	5d                   	pop    %ebp
+  8030e5:	c3                   	ret
+
+008030e6 <devpipe_read>:
+  8030e6:	55                   	push   %ebp
+  8030e7:	89 e5                	mov    %esp,%ebp
+  8030e9:	57                   	push   %edi
+  8030ea:	56                   	push   %esi
+  8030eb:	53                   	push   %ebx
+  8030ec:	83 ec 18             	sub    $0x18,%esp
+  8030ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030f2:	56                   	push   %esi
+  8030f3:	e8 2d ee ff ff       	call   801f25 <fd2data>
+  8030f8:	89 c3                	mov    %eax,%ebx
+  8030fa:	83 c4 10             	add    $0x10,%esp
+  8030fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803102:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803106:	74 45                	je     80314d <devpipe_read+0x67>
+  803108:	8b 03                	mov    (%ebx),%eax
+  80310a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80310d:	75 1d                	jne    80312c <devpipe_read+0x46>
+  80310f:	85 ff                	test   %edi,%edi
+  803111:	75 3f                	jne    803152 <devpipe_read+0x6c>
+  803113:	89 da                	mov    %ebx,%edx
+  803115:	89 f0                	mov    %esi,%eax
+  803117:	e8 d5 fe ff ff       	call   802ff1 <_pipeisclosed>
+  80311c:	85 c0                	test   %eax,%eax
+  80311e:	75 3c                	jne    80315c <devpipe_read+0x76>
+  803120:	e8 99 dd ff ff       	call   800ebe <sys_yield>
+  803125:	8b 03                	mov    (%ebx),%eax
+  803127:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80312a:	74 e7                	je     803113 <devpipe_read+0x2d>
+  80312c:	99                   	cltd
+  80312d:	c1 ea 1b             	shr    $0x1b,%edx
+  803130:	01 d0                	add    %edx,%eax
+  803132:	83 e0 1f             	and    $0x1f,%eax
+  803135:	29 d0                	sub    %edx,%eax
+  803137:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80313c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80313f:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  803142:	83 03 01             	addl   $0x1,(%ebx)
+  803145:	83 c7 01             	add    $0x1,%edi
+  803148:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80314b:	75 bb                	jne    803108 <devpipe_read+0x22>
+  80314d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803150:	eb 02                	jmp    803154 <devpipe_read+0x6e>
+  803152:	89 f8                	mov    %edi,%eax
+  803154:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803157:	5b                   	pop    %ebx
+  803158:	5e                   	pop    %esi
+  803159:	5f                   	pop    %edi
+  80315a:	5d                   	pop    %ebp
+  80315b:	c3                   	ret
+  80315c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803161:	eb f1                	jmp    803154 <devpipe_read+0x6e>
+
+00803163 <pipe>:
+  803163:	55                   	push   %ebp
+  803164:	89 e5                	mov    %esp,%ebp
+  803166:	56                   	push   %esi
+  803167:	53                   	push   %ebx
+  803168:	83 ec 1c             	sub    $0x1c,%esp
+  80316b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80316e:	50                   	push   %eax
+  80316f:	e8 c8 ed ff ff       	call   801f3c <fd_alloc>
+  803174:	89 c3                	mov    %eax,%ebx
+  803176:	83 c4 10             	add    $0x10,%esp
+  803179:	85 c0                	test   %eax,%eax
+  80317b:	0f 88 23 01 00 00    	js     8032a4 <pipe+0x141>
+  803181:	83 ec 04             	sub    $0x4,%esp
+  803184:	68 07 04 00 00       	push   $0x407
+  803189:	ff 75 f4             	push   -0xc(%ebp)
+  80318c:	6a 00                	push   $0x0
+  80318e:	e8 76 dd ff ff       	call   800f09 <sys_page_alloc>
+  803193:	89 c3                	mov    %eax,%ebx
+  803195:	83 c4 10             	add    $0x10,%esp
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	0f 88 04 01 00 00    	js     8032a4 <pipe+0x141>
+  8031a0:	83 ec 0c             	sub    $0xc,%esp
+  8031a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031a6:	50                   	push   %eax
+  8031a7:	e8 90 ed ff ff       	call   801f3c <fd_alloc>
+  8031ac:	89 c3                	mov    %eax,%ebx
+  8031ae:	83 c4 10             	add    $0x10,%esp
+  8031b1:	85 c0                	test   %eax,%eax
+  8031b3:	0f 88 db 00 00 00    	js     803294 <pipe+0x131>
+  8031b9:	83 ec 04             	sub    $0x4,%esp
+  8031bc:	68 07 04 00 00       	push   $0x407
+  8031c1:	ff 75 f0             	push   -0x10(%ebp)
+  8031c4:	6a 00                	push   $0x0
+  8031c6:	e8 3e dd ff ff       	call   800f09 <sys_page_alloc>
+  8031cb:	89 c3                	mov    %eax,%ebx
+  8031cd:	83 c4 10             	add    $0x10,%esp
+  8031d0:	85 c0                	test   %eax,%eax
+  8031d2:	0f 88 bc 00 00 00    	js     803294 <pipe+0x131>
+  8031d8:	83 ec 0c             	sub    $0xc,%esp
+  8031db:	ff 75 f4             	push   -0xc(%ebp)
+  8031de:	e8 42 ed ff ff       	call   801f25 <fd2data>
+  8031e3:	89 c6                	mov    %eax,%esi
+  8031e5:	83 c4 0c             	add    $0xc,%esp
+  8031e8:	68 07 04 00 00       	push   $0x407
+  8031ed:	50                   	push   %eax
+  8031ee:	6a 00                	push   $0x0
+  8031f0:	e8 14 dd ff ff       	call   800f09 <sys_page_alloc>
+  8031f5:	89 c3                	mov    %eax,%ebx
+  8031f7:	83 c4 10             	add    $0x10,%esp
+  8031fa:	85 c0                	test   %eax,%eax
+  8031fc:	0f 88 82 00 00 00    	js     803284 <pipe+0x121>
+  803202:	83 ec 0c             	sub    $0xc,%esp
+  803205:	ff 75 f0             	push   -0x10(%ebp)
+  803208:	e8 18 ed ff ff       	call   801f25 <fd2data>
+  80320d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803214:	50                   	push   %eax
+  803215:	6a 00                	push   $0x0
+  803217:	56                   	push   %esi
+  803218:	6a 00                	push   $0x0
+  80321a:	e8 2d dd ff ff       	call   800f4c <sys_page_map>
+  80321f:	89 c3                	mov    %eax,%ebx
+  803221:	83 c4 20             	add    $0x20,%esp
+  803224:	85 c0                	test   %eax,%eax
+  803226:	78 4e                	js     803276 <pipe+0x113>
+  803228:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  80322d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803230:	89 02                	mov    %eax,(%edx)
+  803232:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803235:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80323c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80323f:	89 02                	mov    %eax,(%edx)
+  803241:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803244:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80324b:	83 ec 0c             	sub    $0xc,%esp
+  80324e:	ff 75 f4             	push   -0xc(%ebp)
+  803251:	e8 bf ec ff ff       	call   801f15 <fd2num>
+  803256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803259:	89 01                	mov    %eax,(%ecx)
+  80325b:	83 c4 04             	add    $0x4,%esp
+  80325e:	ff 75 f0             	push   -0x10(%ebp)
+  803261:	e8 af ec ff ff       	call   801f15 <fd2num>
+  803266:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803269:	89 41 04             	mov    %eax,0x4(%ecx)
+  80326c:	83 c4 10             	add    $0x10,%esp
+  80326f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803274:	eb 2e                	jmp    8032a4 <pipe+0x141>
+  803276:	83 ec 08             	sub    $0x8,%esp
+  803279:	56                   	push   %esi
+  80327a:	6a 00                	push   $0x0
+  80327c:	e8 5a dd ff ff       	call   800fdb <sys_page_unmap>
+  803281:	83 c4 10             	add    $0x10,%esp
+  803284:	83 ec 08             	sub    $0x8,%esp
+  803287:	ff 75 f0             	push   -0x10(%ebp)
+  80328a:	6a 00                	push   $0x0
+  80328c:	e8 4a dd ff ff       	call   800fdb <sys_page_unmap>
+  803291:	83 c4 10             	add    $0x10,%esp
+  803294:	83 ec 08             	sub    $0x8,%esp
+  803297:	ff 75 f4             	push   -0xc(%ebp)
+  80329a:	6a 00                	push   $0x0
+  80329c:	e8 3a dd ff ff       	call   800fdb <sys_page_unmap>
+  8032a1:	83 c4 10             	add    $0x10,%esp
+  8032a4:	89 d8                	mov    %ebx,%eax
+  8032a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a9:	5b                   	pop    %ebx
+  8032aa:	5e                   	pop    %esi
+  8032ab:	5d                   	pop    %ebp
+  8032ac:	c3                   	ret
+
+008032ad <pipeisclosed>:
+  8032ad:	55                   	push   %ebp
+  8032ae:	89 e5                	mov    %esp,%ebp
+  8032b0:	83 ec 20             	sub    $0x20,%esp
+  8032b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032b6:	50                   	push   %eax
+  8032b7:	ff 75 08             	push   0x8(%ebp)
+  8032ba:	e8 cd ec ff ff       	call   801f8c <fd_lookup>
+  8032bf:	83 c4 10             	add    $0x10,%esp
+  8032c2:	85 c0                	test   %eax,%eax
+  8032c4:	78 18                	js     8032de <pipeisclosed+0x31>
+  8032c6:	83 ec 0c             	sub    $0xc,%esp
+  8032c9:	ff 75 f4             	push   -0xc(%ebp)
+  8032cc:	e8 54 ec ff ff       	call   801f25 <fd2data>
+  8032d1:	89 c2                	mov    %eax,%edx
+  8032d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032d6:	e8 16 fd ff ff       	call   802ff1 <_pipeisclosed>
+  8032db:	83 c4 10             	add    $0x10,%esp
+  8032de:	c9                   	leave
+  8032df:	c3                   	ret
+
+008032e0 <ipcring_init>:
+  8032e0:	55                   	push   %ebp
+  8032e1:	89 e5                	mov    %esp,%ebp
+  8032e3:	53                   	push   %ebx
+  8032e4:	83 ec 08             	sub    $0x8,%esp
+  8032e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8032ea:	6a 60                	push   $0x60
+  8032ec:	6a 00                	push   $0x0
+  8032ee:	53                   	push   %ebx
+  8032ef:	e8 30 d9 ff ff       	call   800c24 <memset>
+  8032f4:	a1 18 60 80 00       	mov    0x806018,%eax
+  8032f9:	8b 40 48             	mov    0x48(%eax),%eax
+  8032fc:	89 03                	mov    %eax,(%ebx)
+  8032fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803301:	89 43 04             	mov    %eax,0x4(%ebx)
+  803304:	8b 45 10             	mov    0x10(%ebp),%eax
+  803307:	89 43 08             	mov    %eax,0x8(%ebx)
+  80330a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80330d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803310:	83 c4 10             	add    $0x10,%esp
+  803313:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803316:	c9                   	leave
+  803317:	c3                   	ret
+
+00803318 <ipcring_req_slot>:
+  803318:	55                   	push   %ebp
+  803319:	89 e5                	mov    %esp,%ebp
+  80331b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80331e:	8b 50 10             	mov    0x10(%eax),%edx
+  803321:	8b 48 18             	mov    0x18(%eax),%ecx
+  803324:	29 ca                	sub    %ecx,%edx
+  803326:	83 fa 07             	cmp    $0x7,%edx
+  803329:	77 0c                	ja     803337 <ipcring_req_slot+0x1f>
+  80332b:	8b 50 10             	mov    0x10(%eax),%edx
+  80332e:	83 e2 07             	and    $0x7,%edx
+  803331:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803335:	5d                   	pop    %ebp
+  803336:	c3                   	ret
+  803337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333c:	eb f7                	jmp    803335 <ipcring_req_slot+0x1d>
+
+0080333e <ipcring_req_push>:
+  80333e:	55                   	push   %ebp
+  80333f:	89 e5                	mov    %esp,%ebp
+  803341:	83 ec 08             	sub    $0x8,%esp
+  803344:	8b 55 08             	mov    0x8(%ebp),%edx
+  803347:	8b 42 10             	mov    0x10(%edx),%eax
+  80334a:	83 c0 01             	add    $0x1,%eax
+  80334d:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803351:	b8 00 00 00 00       	mov    $0x0,%eax
+  803356:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80335a:	85 c0                	test   %eax,%eax
+  80335c:	75 02                	jne    803360 <ipcring_req_push+0x22>
+  80335e:	c9                   	leave
+  80335f:	c3                   	ret
+  803360:	6a 00                	push   $0x0
+  803362:	68 00 00 80 ee       	push   $0xee800000
+  803367:	ff 72 08             	push   0x8(%edx)
+  80336a:	ff 72 04             	push   0x4(%edx)
+  80336d:	e8 cf de ff ff       	call   801241 <sys_ipc_send>
+  803372:	83 c4 10             	add    $0x10,%esp
+  803375:	eb e7                	jmp    80335e <ipcring_req_push+0x20>
+
+00803377 <ipcring_rsp_wait>:
+  803377:	55                   	push   %ebp
+  803378:	89 e5                	mov    %esp,%ebp
+  80337a:	53                   	push   %ebx
+  80337b:	83 ec 04             	sub    $0x4,%esp
+  80337e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803381:	8b 53 18             	mov    0x18(%ebx),%edx
+  803384:	8b 43 10             	mov    0x10(%ebx),%eax
+  803387:	39 c2                	cmp    %eax,%edx
+  803389:	74 3c                	je     8033c7 <ipcring_rsp_wait+0x50>
+  80338b:	8b 53 14             	mov    0x14(%ebx),%edx
+  80338e:	8b 43 18             	mov    0x18(%ebx),%eax
+  803391:	39 c2                	cmp    %eax,%edx
+  803393:	75 23                	jne    8033b8 <ipcring_rsp_wait+0x41>
+  803395:	83 ec 08             	sub    $0x8,%esp
+  803398:	6a 00                	push   $0x0
+  80339a:	6a 00                	push   $0x0
+  80339c:	6a 00                	push   $0x0
+  80339e:	6a 00                	push   $0x0
+  8033a0:	ff 73 0c             	push   0xc(%ebx)
+  8033a3:	ff 73 04             	push   0x4(%ebx)
+  8033a6:	e8 b5 e9 ff ff       	call   801d60 <ipc_call>
+  8033ab:	8b 53 14             	mov    0x14(%ebx),%edx
+  8033ae:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033b1:	83 c4 20             	add    $0x20,%esp
+  8033b4:	39 c2                	cmp    %eax,%edx
+  8033b6:	74 dd                	je     803395 <ipcring_rsp_wait+0x1e>
+  8033b8:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033bb:	83 e0 07             	and    $0x7,%eax
+  8033be:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8033c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033c5:	c9                   	leave
+  8033c6:	c3                   	ret
+  8033c7:	68 ec 3f 80 00       	push   $0x803fec
+  8033cc:	68 9d 3f 80 00       	push   $0x803f9d
+  8033d1:	6a 3b                	push   $0x3b
+  8033d3:	68 0d 40 80 00       	push   $0x80400d
+  8033d8:	e8 fa ce ff ff       	call   8002d7 <_panic>
+
+008033dd <ipcring_rsp_pop>:
+  8033dd:	55                   	push   %ebp
+  8033de:	89 e5                	mov    %esp,%ebp
+  8033e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033e3:	8b 42 18             	mov    0x18(%edx),%eax
+  8033e6:	83 c0 01             	add    $0x1,%eax
+  8033e9:	89 42 18             	mov    %eax,0x18(%edx)
+  8033ec:	5d                   	pop    %ebp
+  8033ed:	c3                   	ret
+
+008033ee <ipcring_server_init>:
+  8033ee:	55                   	push   %ebp
+  8033ef:	89 e5                	mov    %esp,%ebp
+  8033f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033f7:	89 10                	mov    %edx,(%eax)
+  8033f9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033fc:	89 50 04             	mov    %edx,0x4(%eax)
+  8033ff:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803406:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80340d:	5d                   	pop    %ebp
+  80340e:	c3                   	ret
+
+0080340f <ipcring_req_avail>:
+  80340f:	55                   	push   %ebp
+  803410:	89 e5                	mov    %esp,%ebp
+  803412:	8b 55 08             	mov    0x8(%ebp),%edx
+  803415:	8b 02                	mov    (%edx),%eax
+  803417:	8b 40 10             	mov    0x10(%eax),%eax
+  80341a:	2b 42 08             	sub    0x8(%edx),%eax
+  80341d:	ba 08 00 00 00       	mov    $0x8,%edx
+  803422:	39 d0                	cmp    %edx,%eax
+  803424:	0f 47 c2             	cmova  %edx,%eax
+  803427:	5d                   	pop    %ebp
+  803428:	c3                   	ret
+
+00803429 <ipcring_req_peek>:
+  803429:	55                   	push   %ebp
+  80342a:	89 e5                	mov    %esp,%ebp
+  80342c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80342f:	8b 42 08             	mov    0x8(%edx),%eax
+  803432:	83 e0 07             	and    $0x7,%eax
+  803435:	8b 12                	mov    (%edx),%edx
+  803437:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80343b:	5d                   	pop    %ebp
+  80343c:	c3                   	ret
+
+0080343d <ipcring_rsp_push>:
+  80343d:	55                   	push   %ebp
+  80343e:	89 e5                	mov    %esp,%ebp
+  803440:	83 ec 08             	sub    $0x8,%esp
+  803443:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803446:	8b 41 08             	mov    0x8(%ecx),%eax
+  803449:	83 c0 01             	add    $0x1,%eax
+  80344c:	89 41 08             	mov    %eax,0x8(%ecx)
+  80344f:	8b 11                	mov    (%ecx),%edx
+  803451:	83 c2 14             	add    $0x14,%edx
+  803454:	f0 87 02             	lock xchg %eax,(%edx)
+  803457:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80345b:	75 02                	jne    80345f <ipcring_rsp_push+0x22>
+  80345d:	c9                   	leave
+  80345e:	c3                   	ret
+  80345f:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803466:	6a 00                	push   $0x0
+  803468:	68 00 00 80 ee       	push   $0xee800000
+  80346d:	6a 00                	push   $0x0
+  80346f:	ff 71 04             	push   0x4(%ecx)
+  803472:	e8 ed dc ff ff       	call   801164 <sys_ipc_try_send>
+  803477:	83 c4 10             	add    $0x10,%esp
+  80347a:	eb e1                	jmp    80345d <ipcring_rsp_push+0x20>
+
+0080347c <ipcring_client_wait>:
+  80347c:	55                   	push   %ebp
+  80347d:	89 e5                	mov    %esp,%ebp
+  80347f:	83 ec 08             	sub    $0x8,%esp
+  803482:	8b 45 08             	mov    0x8(%ebp),%eax
+  803485:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  80348c:	8b 10                	mov    (%eax),%edx
+  80348e:	8b 52 18             	mov    0x18(%edx),%edx
+  803491:	3b 50 08             	cmp    0x8(%eax),%edx
+  803494:	75 02                	jne    803498 <ipcring_client_wait+0x1c>
+  803496:	c9                   	leave
+  803497:	c3                   	ret
+  803498:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80349f:	6a 00                	push   $0x0
+  8034a1:	68 00 00 80 ee       	push   $0xee800000
+  8034a6:	6a 00                	push   $0x0
+  8034a8:	ff 70 04             	push   0x4(%eax)
+  8034ab:	e8 b4 dc ff ff       	call   801164 <sys_ipc_try_send>
+  8034b0:	83 c4 10             	add    $0x10,%esp
+  8034b3:	eb e1                	jmp    803496 <ipcring_client_wait+0x1a>
+
+008034b5 <ipcring_server_sleep>:
+  8034b5:	55                   	push   %ebp
+  8034b6:	89 e5                	mov    %esp,%ebp
+  8034b8:	53                   	push   %ebx
+  8034b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034bc:	8b 01                	mov    (%ecx),%eax
+  8034be:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8034c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034c6:	f0 87 02             	lock xchg %eax,(%edx)
+  8034c9:	8b 11                	mov    (%ecx),%edx
+  8034cb:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8034ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034d3:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8034d6:	74 0e                	je     8034e6 <ipcring_server_sleep+0x31>
+  8034d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034dd:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8034e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034e9:	c9                   	leave
+  8034ea:	c3                   	ret
+
+008034eb <devcons_close>:
+  8034eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f0:	c3                   	ret
+
+008034f1 <devcons_stat>:
+  8034f1:	55                   	push   %ebp
+  8034f2:	89 e5                	mov    %esp,%ebp
+  8034f4:	83 ec 10             	sub    $0x10,%esp
+  8034f7:	68 1b 40 80 00       	push   $0x80401b
+  8034fc:	ff 75 0c             	push   0xc(%ebp)
+  8034ff:	e8 a5 d5 ff ff       	call   800aa9 <strcpy>
+  803504:	b8 00 00 00 00       	mov    $0x0,%eax
+  803509:	c9                   	leave
+  80350a:	c3                   	ret
+
+0080350b <devcons_write>:
+  80350b:	55                   	push   %ebp
+  80350c:	89 e5                	mov    %esp,%ebp
+  80350e:	57                   	push   %edi
+  80350f:	56                   	push   %esi
+  803510:	53                   	push   %ebx
+  803511:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803517:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80351a:	85 ff                	test   %edi,%edi
+  80351c:	74 51                	je     80356f <devcons_write+0x64>
+  80351e:	be 00 00 00 00       	mov    $0x0,%esi
+  803523:	b8 00 00 00 00       	mov    $0x0,%eax
+  803528:	89 fb                	mov    %edi,%ebx
+  80352a:	29 c3                	sub    %eax,%ebx
+  80352c:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803531:	39 d3                	cmp    %edx,%ebx
+  803533:	0f 47 da             	cmova  %edx,%ebx
+  803536:	83 ec 04             	sub    $0x4,%esp
+  803539:	53                   	push   %ebx
+  80353a:	03 45 0c             	add    0xc(%ebp),%eax
+  80353d:	50                   	push   %eax
+  80353e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803544:	50                   	push   %eax
+  803545:	e8 0f d7 ff ff       	call   800c59 <memmove>
+  80354a:	83 c4 08             	add    $0x8,%esp
+  80354d:	53                   	push   %ebx
+  80354e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803554:	50                   	push   %eax
+  803555:	e8 c7 d8 ff ff       	call   800e21 <sys_cputs>
+  80355a:	01 de                	add    %ebx,%esi
+  80355c:	89 f0                	mov    %esi,%eax
+  80355e:	83 c4 10             	add    $0x10,%esp
+  803561:	39 fe                	cmp    %edi,%esi
+  803563:	72 c3                	jb     803528 <devcons_write+0x1d>
+  803565:	89 f0                	mov    %esi,%eax
+  803567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80356a:	5b                   	pop    %ebx
+  80356b:	5e                   	pop    %esi
+  80356c:	5f                   	pop    %edi
+  80356d:	5d                   	pop    %ebp
+  80356e:	c3                   	ret
+  80356f:	be 00 00 00 00       	mov    $0x0,%esi
+  803574:	eb ef                	jmp    803565 <devcons_write+0x5a>
+
+00803576 <devcons_read>:
+  803576:	55                   	push   %ebp
+  803577:	89 e5                	mov    %esp,%ebp
+  803579:	83 ec 08             	sub    $0x8,%esp
+  80357c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803581:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803585:	75 07                	jne    80358e <devcons_read+0x18>
+  803587:	eb 1f                	jmp    8035a8 <devcons_read+0x32>
+  803589:	e8 30 d9 ff ff       	call   800ebe <sys_yield>
+  80358e:	e8 ac d8 ff ff       	call   800e3f <sys_cgetc>
+  803593:	85 c0                	test   %eax,%eax
+  803595:	74 f2                	je     803589 <devcons_read+0x13>
+  803597:	78 0f                	js     8035a8 <devcons_read+0x32>
+  803599:	83 f8 04             	cmp    $0x4,%eax
+  80359c:	74 0c                	je     8035aa <devcons_read+0x34>
+  80359e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035a1:	88 02                	mov    %al,(%edx)
+  8035a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035a8:	c9                   	leave
+  8035a9:	c3                   	ret
+  8035aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035af:	eb f7                	jmp    8035a8 <devcons_read+0x32>
+
+008035b1 <cputchar>:
+  8035b1:	55                   	push   %ebp
+  8035b2:	89 e5                	mov    %esp,%ebp
+  8035b4:	83 ec 20             	sub    $0x20,%esp
+  8035b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ba:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8035bd:	6a 01                	push   $0x1
+  8035bf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035c2:	50                   	push   %eax
+  8035c3:	e8 59 d8 ff ff       	call   800e21 <sys_cputs>
+  8035c8:	83 c4 10             	add    $0x10,%esp
+  8035cb:	c9                   	leave
+  8035cc:	c3                   	ret
+
+008035cd <getchar>:
+  8035cd:	55                   	push   %ebp
+  8035ce:	89 e5                	mov    %esp,%ebp
+  8035d0:	83 ec 1c             	sub    $0x1c,%esp
+  8035d3:	6a 01                	push   $0x1
+  8035d5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035d8:	50                   	push   %eax
+  8035d9:	6a 00                	push   $0x0
+  8035db:	e8 0e ec ff ff       	call   8021ee <read>
+  8035e0:	83 c4 10             	add    $0x10,%esp
+  8035e3:	85 c0                	test   %eax,%eax
+  8035e5:	78 06                	js     8035ed <getchar+0x20>
+  8035e7:	74 06                	je     8035ef <getchar+0x22>
+  8035e9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8035ed:	c9                   	leave
+  8035ee:	c3                   	ret
+  8035ef:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8035f4:	eb f7                	jmp    8035ed <getchar+0x20>
+
+008035f6 <iscons>:
+  8035f6:	55                   	push   %ebp
+  8035f7:	89 e5                	mov    %esp,%ebp
+  8035f9:	83 ec 20             	sub    $0x20,%esp
+  8035fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035ff:	50                   	push   %eax
+  803600:	ff 75 08             	push   0x8(%ebp)
+  803603:	e8 84 e9 ff ff       	call   801f8c <fd_lookup>
+  803608:	83 c4 10             	add    $0x10,%esp
+  80360b:	85 c0                	test   %eax,%eax
+  80360d:	78 11                	js     803620 <iscons+0x2a>
+  80360f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803612:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803618:	39 10                	cmp    %edx,(%eax)
+  80361a:	0f 94 c0             	sete   %al
+  80361d:	0f b6 c0             	movzbl %al,%eax
+  803620:	c9                   	leave
+  803621:	c3                   	ret
+
+00803622 <opencons>:
+  803622:	55                   	push   %ebp
+  803623:	89 e5                	mov    %esp,%ebp
+  803625:	83 ec 24             	sub    $0x24,%esp
+  803628:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80362b:	50                   	push   %eax
+  80362c:	e8 0b e9 ff ff       	call   801f3c <fd_alloc>
+  803631:	83 c4 10             	add    $0x10,%esp
+  803634:	85 c0                	test   %eax,%eax
+  803636:	78 3a                	js     803672 <opencons+0x50>
+  803638:	83 ec 04             	sub    $0x4,%esp
+  80363b:	68 07 04 00 00       	push   $0x407
+  803640:	ff 75 f4             	push   -0xc(%ebp)
+  803643:	6a 00                	push   $0x0
+  803645:	e8 bf d8 ff ff       	call   800f09 <sys_page_alloc>
+  80364a:	83 c4 10             	add    $0x10,%esp
+  80364d:	85 c0                	test   %eax,%eax
+  80364f:	78 21                	js     803672 <opencons+0x50>
+  803651:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803654:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  80365a:	89 10                	mov    %edx,(%eax)
+  80365c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80365f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803666:	83 ec 0c             	sub    $0xc,%esp
+  803669:	50                   	push   %eax
+  80366a:	e8 a6 e8 ff ff       	call   801f15 <fd2num>
+  80366f:	83 c4 10             	add    $0x10,%esp
+  803672:	c9                   	leave
+  803673:	c3                   	ret
+
+00803674 <set_pgfault_handler>:
+  803674:	55                   	push   %ebp
+  803675:	89 e5                	mov    %esp,%ebp
+  803677:	53                   	push   %ebx
+  803678:	83 ec 04             	sub    $0x4,%esp
+  80367b:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803682:	74 0d                	je     803691 <set_pgfault_handler+0x1d>
+  803684:	8b 45 08             	mov    0x8(%ebp),%eax
+  803687:	a3 00 90 80 00       	mov    %eax,0x809000
+  80368c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80368f:	c9                   	leave
+  803690:	c3                   	ret
+  803691:	e8 09 d8 ff ff       	call   800e9f <sys_getenvid>
+  803696:	89 c3                	mov    %eax,%ebx
+  803698:	83 ec 04             	sub    $0x4,%esp
+  80369b:	6a 07                	push   $0x7
+  80369d:	68 00 f0 7f ee       	push   $0xee7ff000
+  8036a2:	50                   	push   %eax
+  8036a3:	e8 61 d8 ff ff       	call   800f09 <sys_page_alloc>
+  8036a8:	83 c4 10             	add    $0x10,%esp
+  8036ab:	85 c0                	test   %eax,%eax
+  8036ad:	78 29                	js     8036d8 <set_pgfault_handler+0x64>
+  8036af:	83 ec 08             	sub    $0x8,%esp
+  8036b2:	68 ec 36 80 00       	push   $0x8036ec
+  8036b7:	53                   	push   %ebx
+  8036b8:	e8 65 da ff ff       	call   801122 <sys_env_set_pgfault_upcall>
+  8036bd:	83 c4 10             	add    $0x10,%esp
+  8036c0:	85 c0                	test   %eax,%eax
+  8036c2:	79 c0                	jns    803684 <set_pgfault_handler+0x10>
+  8036c4:	83 ec 04             	sub    $0x4,%esp
+  8036c7:	68 60 40 80 00       	push   $0x804060
+  8036cc:	6a 27                	push   $0x27
+  8036ce:	68 92 40 80 00       	push   $0x804092
+  8036d3:	e8 ff cb ff ff       	call   8002d7 <_panic>
+  8036d8:	83 ec 04             	sub    $0x4,%esp
+  8036db:	68 28 40 80 00       	push   $0x804028
+  8036e0:	6a 23                	push   $0x23
+  8036e2:	68 92 40 80 00       	push   $0x804092
+  8036e7:	e8 eb cb ff ff       	call   8002d7 <_panic>
+
+008036ec <_pgfault_upcall>:
+  8036ec:	54                   	push   %esp
+  8036ed:	a1 00 90 80 00       	mov    0x809000,%eax
+  8036f2:	ff d0                	call   *%eax
+  8036f4:	83 c4 04             	add    $0x4,%esp
+  8036f7:	89 e3                	mov    %esp,%ebx
+  8036f9:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8036fd:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803701:	89 d4                	mov    %edx,%esp
+  803703:	51                   	push   %ecx
+  803704:	89 dc                	mov    %ebx,%esp
+  803706:	83 ea 04             	sub    $0x4,%edx
+  803709:	89 54 24 30          	mov    %edx,0x30(%esp)
+  80370d:	83 c4 08             	add    $0x8,%esp
+  803710:	61                   	popa
+  803711:	83 c4 04             	add    $0x4,%esp
+  803714:	9d                   	popf
+  803715:	5c                   	pop    %esp
+  803716:	c3                   	ret
+
+00803717 <pageref>:
+  803717:	55                   	push   %ebp
+  803718:	89 e5                	mov    %esp,%ebp
+  80371a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80371d:	89 c2                	mov    %eax,%edx
+  80371f:	c1 ea 16             	shr    $0x16,%edx
+  803722:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803729:	ba 00 00 00 00       	mov    $0x0,%edx
+  80372e:	f6 c1 01             	test   $0x1,%cl
+  803731:	74 22                	je     803755 <pageref+0x3e>
+  803733:	c1 e8 0c             	shr    $0xc,%eax
+  803736:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80373d:	a8 01                	test   $0x1,%al
+  80373f:	74 14                	je     803755 <pageref+0x3e>
+  803741:	c1 e8 0c             	shr    $0xc,%eax
+  803744:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803747:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80374e:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803752:	0f b7 d2             	movzwl %dx,%edx
+  803755:	89 d0                	mov    %edx,%eax
+  803757:	5d                   	pop    %ebp
+  803758:	c3                   	ret
+
+00803759 <__udivmoddi4>:
+  803759:	55                   	push   %ebp
+  80375a:	57                   	push   %edi
+  80375b:	56                   	push   %esi
+  80375c:	53                   	push   %ebx
+  80375d:	83 ec 24             	sub    $0x24,%esp
+  803760:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803764:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803768:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80376c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803770:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803774:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803778:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80377c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803780:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803784:	b8 00 00 00 00       	mov    $0x0,%eax
+  803789:	ba 00 00 00 00       	mov    $0x0,%edx
+  80378e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803793:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80379a:	00 
+  80379b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8037a2:	00 
+  8037a3:	89 fb                	mov    %edi,%ebx
+  8037a5:	eb 08                	jmp    8037af <__udivmoddi4+0x56>
+  8037a7:	83 e9 01             	sub    $0x1,%ecx
+  8037aa:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8037ad:	74 68                	je     803817 <__udivmoddi4+0xbe>
+  8037af:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8037b3:	01 c0                	add    %eax,%eax
+  8037b5:	89 c6                	mov    %eax,%esi
+  8037b7:	89 d7                	mov    %edx,%edi
+  8037b9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037bd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037c1:	0f ad d0             	shrd   %cl,%edx,%eax
+  8037c4:	d3 ea                	shr    %cl,%edx
+  8037c6:	f6 c1 20             	test   $0x20,%cl
+  8037c9:	74 04                	je     8037cf <__udivmoddi4+0x76>
+  8037cb:	89 d0                	mov    %edx,%eax
+  8037cd:	31 d2                	xor    %edx,%edx
+  8037cf:	83 e0 01             	and    $0x1,%eax
+  8037d2:	89 04 24             	mov    %eax,(%esp)
+  8037d5:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8037dc:	00 
+  8037dd:	8b 04 24             	mov    (%esp),%eax
+  8037e0:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8037e4:	09 f0                	or     %esi,%eax
+  8037e6:	09 fa                	or     %edi,%edx
+  8037e8:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8037ec:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8037f0:	39 f0                	cmp    %esi,%eax
+  8037f2:	89 d5                	mov    %edx,%ebp
+  8037f4:	19 fd                	sbb    %edi,%ebp
+  8037f6:	72 af                	jb     8037a7 <__udivmoddi4+0x4e>
+  8037f8:	29 f0                	sub    %esi,%eax
+  8037fa:	19 fa                	sbb    %edi,%edx
+  8037fc:	89 cf                	mov    %ecx,%edi
+  8037fe:	c1 ef 05             	shr    $0x5,%edi
+  803801:	83 e7 01             	and    $0x1,%edi
+  803804:	89 fe                	mov    %edi,%esi
+  803806:	83 f6 01             	xor    $0x1,%esi
+  803809:	d3 e6                	shl    %cl,%esi
+  80380b:	d3 e7                	shl    %cl,%edi
+  80380d:	09 74 24 18          	or     %esi,0x18(%esp)
+  803811:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803815:	eb 90                	jmp    8037a7 <__udivmoddi4+0x4e>
+  803817:	85 db                	test   %ebx,%ebx
+  803819:	74 05                	je     803820 <__udivmoddi4+0xc7>
+  80381b:	89 03                	mov    %eax,(%ebx)
+  80381d:	89 53 04             	mov    %edx,0x4(%ebx)
+  803820:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803824:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803828:	83 c4 24             	add    $0x24,%esp
+  80382b:	5b                   	pop    %ebx
+  80382c:	5e                   	pop    %esi
+  80382d:	5f                   	pop    %edi
+  80382e:	5d                   	pop    %ebp
+  80382f:	c3                   	ret
+
+00803830 <__udivdi3>:
+  803830:	83 ec 08             	sub    $0x8,%esp
+  803833:	6a 00                	push   $0x0
+  803835:	ff 74 24 1c          	push   0x1c(%esp)
+  803839:	ff 74 24 1c          	push   0x1c(%esp)
+  80383d:	ff 74 24 1c          	push   0x1c(%esp)
+  803841:	ff 74 24 1c          	push   0x1c(%esp)
+  803845:	e8 0f ff ff ff       	call   803759 <__udivmoddi4>
+  80384a:	83 c4 1c             	add    $0x1c,%esp
+  80384d:	c3                   	ret
+
+0080384e <__umoddi3>:
+  80384e:	83 ec 18             	sub    $0x18,%esp
+  803851:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803855:	50                   	push   %eax
+  803856:	ff 74 24 2c          	push   0x2c(%esp)
+  80385a:	ff 74 24 2c          	push   0x2c(%esp)
+  80385e:	ff 74 24 2c          	push   0x2c(%esp)
+  803862:	ff 74 24 2c          	push   0x2c(%esp)
+  803866:	e8 ee fe ff ff       	call   803759 <__udivmoddi4>
+  80386b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80386f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803873:	83 c4 2c             	add    $0x2c,%esp
+  803876:	c3                   	ret
+
+00803877 <__divdi3>:
+  803877:	53                   	push   %ebx
+  803878:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80387c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803880:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803884:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803888:	85 d2                	test   %edx,%edx
+  80388a:	78 12                	js     80389e <__divdi3+0x27>
+  80388c:	85 db                	test   %ebx,%ebx
+  80388e:	78 2e                	js     8038be <__divdi3+0x47>
+  803890:	53                   	push   %ebx
+  803891:	51                   	push   %ecx
+  803892:	52                   	push   %edx
+  803893:	50                   	push   %eax
+  803894:	e8 97 ff ff ff       	call   803830 <__udivdi3>
+  803899:	83 c4 10             	add    $0x10,%esp
+  80389c:	eb 1e                	jmp    8038bc <__divdi3+0x45>
+  80389e:	f7 d8                	neg    %eax
+  8038a0:	83 d2 00             	adc    $0x0,%edx
+  8038a3:	f7 da                	neg    %edx
+  8038a5:	85 db                	test   %ebx,%ebx
+  8038a7:	78 2a                	js     8038d3 <__divdi3+0x5c>
+  8038a9:	53                   	push   %ebx
+  8038aa:	51                   	push   %ecx
+  8038ab:	52                   	push   %edx
+  8038ac:	50                   	push   %eax
+  8038ad:	e8 7e ff ff ff       	call   803830 <__udivdi3>
+  8038b2:	83 c4 10             	add    $0x10,%esp
+  8038b5:	f7 d8                	neg    %eax
+  8038b7:	83 d2 00             	adc    $0x0,%edx
+  8038ba:	f7 da                	neg    %edx
+  8038bc:	5b                   	pop    %ebx
+  8038bd:	c3                   	ret
+  8038be:	f7 d9                	neg    %ecx
+  8038c0:	83 d3 00             	adc    $0x0,%ebx
+  8038c3:	f7 db                	neg    %ebx
+  8038c5:	53                   	push   %ebx
+  8038c6:	51                   	push   %ecx
+  8038c7:	52                   	push   %edx
+  8038c8:	50                   	push   %eax
+  8038c9:	e8 62 ff ff ff       	call   803830 <__udivdi3>
+  8038ce:	83 c4 10             	add    $0x10,%esp
+  8038d1:	eb e2                	jmp    8038b5 <__divdi3+0x3e>
+  8038d3:	f7 d9                	neg    %ecx
+  8038d5:	83 d3 00             	adc    $0x0,%ebx
+  8038d8:	f7 db                	neg    %ebx
+  8038da:	53                   	push   %ebx
+  8038db:	51                   	push   %ecx
+  8038dc:	52                   	push   %edx
+  8038dd:	50                   	push   %eax
+  8038de:	e8 4d ff ff ff       	call   803830 <__udivdi3>
+  8038e3:	83 c4 10             	add    $0x10,%esp
+  8038e6:	eb d4                	jmp    8038bc <__divdi3+0x45>
+
+008038e8 <__moddi3>:
+  8038e8:	55                   	push   %ebp
+  8038e9:	57                   	push   %edi
+  8038ea:	56                   	push   %esi
+  8038eb:	53                   	push   %ebx
+  8038ec:	83 ec 0c             	sub    $0xc,%esp
+  8038ef:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8038f3:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8038f7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038fb:	89 e9                	mov    %ebp,%ecx
+  8038fd:	f7 d9                	neg    %ecx
+  8038ff:	89 d0                	mov    %edx,%eax
+  803901:	83 d0 00             	adc    $0x0,%eax
+  803904:	f7 d8                	neg    %eax
+  803906:	0f 49 e9             	cmovns %ecx,%ebp
+  803909:	0f 49 d0             	cmovns %eax,%edx
+  80390c:	52                   	push   %edx
+  80390d:	55                   	push   %ebp
+  80390e:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803912:	f7 da                	neg    %edx
+  803914:	89 d8                	mov    %ebx,%eax
+  803916:	83 d0 00             	adc    $0x0,%eax
+  803919:	f7 d8                	neg    %eax
+  80391b:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803920:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803924:	0f 48 c3             	cmovs  %ebx,%eax
+  803927:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80392b:	ff 74 24 0c          	push   0xc(%esp)
+  80392f:	ff 74 24 0c          	push   0xc(%esp)
+  803933:	e8 16 ff ff ff       	call   80384e <__umoddi3>
+  803938:	83 c4 10             	add    $0x10,%esp
+  80393b:	85 db                	test   %ebx,%ebx
+  80393d:	78 08                	js     803947 <__moddi3+0x5f>
+  80393f:	83 c4 0c             	add    $0xc,%esp
+  803942:	5b                   	pop    %ebx
+  803943:	5e                   	pop    %esi
+  803944:	5f                   	pop    %edi
+  803945:	5d                   	pop    %ebp
+  803946:	c3                   	ret
+  803947:	f7 d8                	neg    %eax
+  803949:	83 d2 00             	adc    $0x0,%edx
+  80394c:	f7 da                	neg    %edx
+  80394e:	eb ef                	jmp    80393f <__moddi3+0x57>
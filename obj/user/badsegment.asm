@@ -0,0 +1,5034 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800045:	e8 e7 00 00 00       	call   800131 <sys_getenvid>
+  80004a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004f:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800055:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005a:	a3 10 50 80 00       	mov    %eax,0x805010
+  80005f:	85 db                	test   %ebx,%ebx
+  800061:	7e 07                	jle    80006a <libmain+0x30>
+  800063:	8b 06                	mov    (%esi),%eax
+  800065:	a3 00 40 80 00       	mov    %eax,0x804000
+  80006a:	83 ec 08             	sub    $0x8,%esp
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	e8 bf ff ff ff       	call   800033 <umain>
+  800074:	e8 0a 00 00 00       	call   800083 <exit>
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007f:	5b                   	pop    %ebx
+  800080:	5e                   	pop    %esi
+  800081:	5d                   	pop    %ebp
+  800082:	c3                   	ret
+
+00800083 <exit>:
+  800083:	55                   	push   %ebp
+  800084:	89 e5                	mov    %esp,%ebp
+  800086:	83 ec 08             	sub    $0x8,%esp
+  800089:	a1 10 50 80 00       	mov    0x805010,%eax
+  80008e:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800094:	85 c0                	test   %eax,%eax
+  800096:	75 14                	jne    8000ac <exit+0x29>
+  800098:	e8 36 0b 00 00       	call   800bd3 <close_all>
+  80009d:	83 ec 0c             	sub    $0xc,%esp
+  8000a0:	6a 00                	push   $0x0
+  8000a2:	e8 49 00 00 00       	call   8000f0 <sys_env_destroy>
+  8000a7:	83 c4 10             	add    $0x10,%esp
+  8000aa:	c9                   	leave
+  8000ab:	c3                   	ret
+  8000ac:	e8 ac 07 00 00       	call   80085d <sys_lease_complete>
+  8000b1:	eb e5                	jmp    800098 <exit+0x15>
+
+008000b3 <sys_cputs>:
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	57                   	push   %edi
+  8000b7:	56                   	push   %esi
+  8000b8:	53                   	push   %ebx
+  8000b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c4:	89 c3                	mov    %eax,%ebx
+  8000c6:	89 c7                	mov    %eax,%edi
+  8000c8:	89 c6                	mov    %eax,%esi
+  8000ca:	cd 30                	int    $0x30
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+
+008000d1 <sys_cgetc>:
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	57                   	push   %edi
+  8000d5:	56                   	push   %esi
+  8000d6:	53                   	push   %ebx
+  8000d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e1:	89 d1                	mov    %edx,%ecx
+  8000e3:	89 d3                	mov    %edx,%ebx
+  8000e5:	89 d7                	mov    %edx,%edi
+  8000e7:	89 d6                	mov    %edx,%esi
+  8000e9:	cd 30                	int    $0x30
+  8000eb:	5b                   	pop    %ebx
+  8000ec:	5e                   	pop    %esi
+  8000ed:	5f                   	pop    %edi
+  8000ee:	5d                   	pop    %ebp
+  8000ef:	c3                   	ret
+
+008000f0 <sys_env_destroy>:
+  8000f0:	55                   	push   %ebp
+  8000f1:	89 e5                	mov    %esp,%ebp
+  8000f3:	57                   	push   %edi
+  8000f4:	56                   	push   %esi
+  8000f5:	53                   	push   %ebx
+  8000f6:	83 ec 0c             	sub    $0xc,%esp
+  8000f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800101:	b8 03 00 00 00       	mov    $0x3,%eax
+  800106:	89 cb                	mov    %ecx,%ebx
+  800108:	89 cf                	mov    %ecx,%edi
+  80010a:	89 ce                	mov    %ecx,%esi
+  80010c:	cd 30                	int    $0x30
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	7f 08                	jg     80011a <sys_env_destroy+0x2a>
+  800112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800115:	5b                   	pop    %ebx
+  800116:	5e                   	pop    %esi
+  800117:	5f                   	pop    %edi
+  800118:	5d                   	pop    %ebp
+  800119:	c3                   	ret
+  80011a:	83 ec 0c             	sub    $0xc,%esp
+  80011d:	50                   	push   %eax
+  80011e:	6a 03                	push   $0x3
+  800120:	68 6a 31 80 00       	push   $0x80316a
+  800125:	6a 24                	push   $0x24
+  800127:	68 87 31 80 00       	push   $0x803187
+  80012c:	e8 37 20 00 00       	call   802168 <_panic>
+
+00800131 <sys_getenvid>:
+  800131:	55                   	push   %ebp
+  800132:	89 e5                	mov    %esp,%ebp
+  800134:	57                   	push   %edi
+  800135:	56                   	push   %esi
+  800136:	53                   	push   %ebx
+  800137:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800141:	89 d1                	mov    %edx,%ecx
+  800143:	89 d3                	mov    %edx,%ebx
+  800145:	89 d7                	mov    %edx,%edi
+  800147:	89 d6                	mov    %edx,%esi
+  800149:	cd 30                	int    $0x30
+  80014b:	5b                   	pop    %ebx
+  80014c:	5e                   	pop    %esi
+  80014d:	5f                   	pop    %edi
+  80014e:	5d                   	pop    %ebp
+  80014f:	c3                   	ret
+
+00800150 <sys_yield>:
+  800150:	55                   	push   %ebp
+  800151:	89 e5                	mov    %esp,%ebp
+  800153:	57                   	push   %edi
+  800154:	56                   	push   %esi
+  800155:	53                   	push   %ebx
+  800156:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80015d:	74 26                	je     800185 <sys_yield+0x35>
+  80015f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800164:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800169:	89 d1                	mov    %edx,%ecx
+  80016b:	89 d3                	mov    %edx,%ebx
+  80016d:	89 d7                	mov    %edx,%edi
+  80016f:	6a 00                	push   $0x0
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	8d 35 7c 01 80 00    	lea    0x80017c,%esi
+  80017a:	0f 34                	sysenter
+  80017c:	5d                   	pop    %ebp
+  80017d:	83 c4 04             	add    $0x4,%esp
+  800180:	5b                   	pop    %ebx
+  800181:	5e                   	pop    %esi
+  800182:	5f                   	pop    %edi
+  800183:	5d                   	pop    %ebp
+  800184:	c3                   	ret
+  800185:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80018f:	89 d1                	mov    %edx,%ecx
+  800191:	89 d3                	mov    %edx,%ebx
+  800193:	89 d7                	mov    %edx,%edi
+  800195:	89 d6                	mov    %edx,%esi
+  800197:	cd 30                	int    $0x30
+  800199:	eb e5                	jmp    800180 <sys_yield+0x30>
+
+0080019b <sys_page_alloc>:
+  80019b:	55                   	push   %ebp
+  80019c:	89 e5                	mov    %esp,%ebp
+  80019e:	57                   	push   %edi
+  80019f:	56                   	push   %esi
+  8001a0:	53                   	push   %ebx
+  8001a1:	83 ec 0c             	sub    $0xc,%esp
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001af:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b7:	89 f7                	mov    %esi,%edi
+  8001b9:	cd 30                	int    $0x30
+  8001bb:	85 c0                	test   %eax,%eax
+  8001bd:	7f 08                	jg     8001c7 <sys_page_alloc+0x2c>
+  8001bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c2:	5b                   	pop    %ebx
+  8001c3:	5e                   	pop    %esi
+  8001c4:	5f                   	pop    %edi
+  8001c5:	5d                   	pop    %ebp
+  8001c6:	c3                   	ret
+  8001c7:	83 ec 0c             	sub    $0xc,%esp
+  8001ca:	50                   	push   %eax
+  8001cb:	6a 04                	push   $0x4
+  8001cd:	68 6a 31 80 00       	push   $0x80316a
+  8001d2:	6a 24                	push   $0x24
+  8001d4:	68 87 31 80 00       	push   $0x803187
+  8001d9:	e8 8a 1f 00 00       	call   802168 <_panic>
+
+008001de <sys_page_map>:
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	57                   	push   %edi
+  8001e2:	56                   	push   %esi
+  8001e3:	53                   	push   %ebx
+  8001e4:	83 ec 0c             	sub    $0xc,%esp
+  8001e7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8001ee:	74 33                	je     800223 <sys_page_map+0x45>
+  8001f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800201:	ff 75 18             	push   0x18(%ebp)
+  800204:	55                   	push   %ebp
+  800205:	89 e5                	mov    %esp,%ebp
+  800207:	8d 35 0f 02 80 00    	lea    0x80020f,%esi
+  80020d:	0f 34                	sysenter
+  80020f:	5d                   	pop    %ebp
+  800210:	83 c4 04             	add    $0x4,%esp
+  800213:	89 c2                	mov    %eax,%edx
+  800215:	85 c0                	test   %eax,%eax
+  800217:	7f 3d                	jg     800256 <sys_page_map+0x78>
+  800219:	89 d0                	mov    %edx,%eax
+  80021b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021e:	5b                   	pop    %ebx
+  80021f:	5e                   	pop    %esi
+  800220:	5f                   	pop    %edi
+  800221:	5d                   	pop    %ebp
+  800222:	c3                   	ret
+  800223:	b8 05 00 00 00       	mov    $0x5,%eax
+  800228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800231:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800234:	8b 75 18             	mov    0x18(%ebp),%esi
+  800237:	cd 30                	int    $0x30
+  800239:	89 c2                	mov    %eax,%edx
+  80023b:	85 c0                	test   %eax,%eax
+  80023d:	7e da                	jle    800219 <sys_page_map+0x3b>
+  80023f:	83 ec 0c             	sub    $0xc,%esp
+  800242:	50                   	push   %eax
+  800243:	6a 05                	push   $0x5
+  800245:	68 6a 31 80 00       	push   $0x80316a
+  80024a:	6a 24                	push   $0x24
+  80024c:	68 87 31 80 00       	push   $0x803187
+  800251:	e8 12 1f 00 00       	call   802168 <_panic>
+  800256:	83 ec 0c             	sub    $0xc,%esp
+  800259:	50                   	push   %eax
+  80025a:	6a 05                	push   $0x5
+  80025c:	68 6a 31 80 00       	push   $0x80316a
+  800261:	6a 48                	push   $0x48
+  800263:	68 87 31 80 00       	push   $0x803187
+  800268:	e8 fb 1e 00 00       	call   802168 <_panic>
+
+0080026d <sys_page_unmap>:
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	57                   	push   %edi
+  800271:	56                   	push   %esi
+  800272:	53                   	push   %ebx
+  800273:	83 ec 0c             	sub    $0xc,%esp
+  800276:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80027b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800281:	b8 06 00 00 00       	mov    $0x6,%eax
+  800286:	89 df                	mov    %ebx,%edi
+  800288:	89 de                	mov    %ebx,%esi
+  80028a:	cd 30                	int    $0x30
+  80028c:	85 c0                	test   %eax,%eax
+  80028e:	7f 08                	jg     800298 <sys_page_unmap+0x2b>
+  800290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800293:	5b                   	pop    %ebx
+  800294:	5e                   	pop    %esi
+  800295:	5f                   	pop    %edi
+  800296:	5d                   	pop    %ebp
+  800297:	c3                   	ret
+  800298:	83 ec 0c             	sub    $0xc,%esp
+  80029b:	50                   	push   %eax
+  80029c:	6a 06                	push   $0x6
+  80029e:	68 6a 31 80 00       	push   $0x80316a
+  8002a3:	6a 24                	push   $0x24
+  8002a5:	68 87 31 80 00       	push   $0x803187
+  8002aa:	e8 b9 1e 00 00       	call   802168 <_panic>
+
+008002af <sys_fork>:
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	57                   	push   %edi
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ba:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002bf:	89 d1                	mov    %edx,%ecx
+  8002c1:	89 d3                	mov    %edx,%ebx
+  8002c3:	89 d7                	mov    %edx,%edi
+  8002c5:	89 d6                	mov    %edx,%esi
+  8002c7:	cd 30                	int    $0x30
+  8002c9:	5b                   	pop    %ebx
+  8002ca:	5e                   	pop    %esi
+  8002cb:	5f                   	pop    %edi
+  8002cc:	5d                   	pop    %ebp
+  8002cd:	c3                   	ret
+
+008002ce <sys_env_set_status>:
+  8002ce:	55                   	push   %ebp
+  8002cf:	89 e5                	mov    %esp,%ebp
+  8002d1:	57                   	push   %edi
+  8002d2:	56                   	push   %esi
+  8002d3:	53                   	push   %ebx
+  8002d4:	83 ec 0c             	sub    $0xc,%esp
+  8002d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002e7:	89 df                	mov    %ebx,%edi
+  8002e9:	89 de                	mov    %ebx,%esi
+  8002eb:	cd 30                	int    $0x30
+  8002ed:	85 c0                	test   %eax,%eax
+  8002ef:	7f 08                	jg     8002f9 <sys_env_set_status+0x2b>
+  8002f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f4:	5b                   	pop    %ebx
+  8002f5:	5e                   	pop    %esi
+  8002f6:	5f                   	pop    %edi
+  8002f7:	5d                   	pop    %ebp
+  8002f8:	c3                   	ret
+  8002f9:	83 ec 0c             	sub    $0xc,%esp
+  8002fc:	50                   	push   %eax
+  8002fd:	6a 08                	push   $0x8
+  8002ff:	68 6a 31 80 00       	push   $0x80316a
+  800304:	6a 24                	push   $0x24
+  800306:	68 87 31 80 00       	push   $0x803187
+  80030b:	e8 58 1e 00 00       	call   802168 <_panic>
+
+00800310 <sys_env_set_trapframe>:
+  800310:	55                   	push   %ebp
+  800311:	89 e5                	mov    %esp,%ebp
+  800313:	57                   	push   %edi
+  800314:	56                   	push   %esi
+  800315:	53                   	push   %ebx
+  800316:	83 ec 0c             	sub    $0xc,%esp
+  800319:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80031e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800321:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800324:	b8 09 00 00 00       	mov    $0x9,%eax
+  800329:	89 df                	mov    %ebx,%edi
+  80032b:	89 de                	mov    %ebx,%esi
+  80032d:	cd 30                	int    $0x30
+  80032f:	85 c0                	test   %eax,%eax
+  800331:	7f 08                	jg     80033b <sys_env_set_trapframe+0x2b>
+  800333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800336:	5b                   	pop    %ebx
+  800337:	5e                   	pop    %esi
+  800338:	5f                   	pop    %edi
+  800339:	5d                   	pop    %ebp
+  80033a:	c3                   	ret
+  80033b:	83 ec 0c             	sub    $0xc,%esp
+  80033e:	50                   	push   %eax
+  80033f:	6a 09                	push   $0x9
+  800341:	68 6a 31 80 00       	push   $0x80316a
+  800346:	6a 24                	push   $0x24
+  800348:	68 87 31 80 00       	push   $0x803187
+  80034d:	e8 16 1e 00 00       	call   802168 <_panic>
+
+00800352 <sys_env_set_cow>:
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	57                   	push   %edi
+  800356:	56                   	push   %esi
+  800357:	53                   	push   %ebx
+  800358:	83 ec 0c             	sub    $0xc,%esp
+  80035b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800360:	8b 55 08             	mov    0x8(%ebp),%edx
+  800363:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800366:	b8 20 00 00 00       	mov    $0x20,%eax
+  80036b:	89 df                	mov    %ebx,%edi
+  80036d:	89 de                	mov    %ebx,%esi
+  80036f:	cd 30                	int    $0x30
+  800371:	85 c0                	test   %eax,%eax
+  800373:	7f 08                	jg     80037d <sys_env_set_cow+0x2b>
+  800375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800378:	5b                   	pop    %ebx
+  800379:	5e                   	pop    %esi
+  80037a:	5f                   	pop    %edi
+  80037b:	5d                   	pop    %ebp
+  80037c:	c3                   	ret
+  80037d:	83 ec 0c             	sub    $0xc,%esp
+  800380:	50                   	push   %eax
+  800381:	6a 20                	push   $0x20
+  800383:	68 6a 31 80 00       	push   $0x80316a
+  800388:	6a 24                	push   $0x24
+  80038a:	68 87 31 80 00       	push   $0x803187
+  80038f:	e8 d4 1d 00 00       	call   802168 <_panic>
+
+00800394 <sys_env_service>:
+  800394:	55                   	push   %ebp
+  800395:	89 e5                	mov    %esp,%ebp
+  800397:	57                   	push   %edi
+  800398:	56                   	push   %esi
+  800399:	53                   	push   %ebx
+  80039a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80039f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a2:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003a7:	89 cb                	mov    %ecx,%ebx
+  8003a9:	89 cf                	mov    %ecx,%edi
+  8003ab:	89 ce                	mov    %ecx,%esi
+  8003ad:	cd 30                	int    $0x30
+  8003af:	5b                   	pop    %ebx
+  8003b0:	5e                   	pop    %esi
+  8003b1:	5f                   	pop    %edi
+  8003b2:	5d                   	pop    %ebp
+  8003b3:	c3                   	ret
+
+008003b4 <sys_env_set_pgfault_upcall>:
+  8003b4:	55                   	push   %ebp
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	57                   	push   %edi
+  8003b8:	56                   	push   %esi
+  8003b9:	53                   	push   %ebx
+  8003ba:	83 ec 0c             	sub    $0xc,%esp
+  8003bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003cd:	89 df                	mov    %ebx,%edi
+  8003cf:	89 de                	mov    %ebx,%esi
+  8003d1:	cd 30                	int    $0x30
+  8003d3:	85 c0                	test   %eax,%eax
+  8003d5:	7f 08                	jg     8003df <sys_env_set_pgfault_upcall+0x2b>
+  8003d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003da:	5b                   	pop    %ebx
+  8003db:	5e                   	pop    %esi
+  8003dc:	5f                   	pop    %edi
+  8003dd:	5d                   	pop    %ebp
+  8003de:	c3                   	ret
+  8003df:	83 ec 0c             	sub    $0xc,%esp
+  8003e2:	50                   	push   %eax
+  8003e3:	6a 0a                	push   $0xa
+  8003e5:	68 6a 31 80 00       	push   $0x80316a
+  8003ea:	6a 24                	push   $0x24
+  8003ec:	68 87 31 80 00       	push   $0x803187
+  8003f1:	e8 72 1d 00 00       	call   802168 <_panic>
+
+008003f6 <sys_ipc_try_send>:
+  8003f6:	55                   	push   %ebp
+  8003f7:	89 e5                	mov    %esp,%ebp
+  8003f9:	57                   	push   %edi
+  8003fa:	56                   	push   %esi
+  8003fb:	53                   	push   %ebx
+  8003fc:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800403:	74 27                	je     80042c <sys_ipc_try_send+0x36>
+  800405:	8b 55 08             	mov    0x8(%ebp),%edx
+  800408:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80040b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800410:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800413:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800416:	6a 00                	push   $0x0
+  800418:	55                   	push   %ebp
+  800419:	89 e5                	mov    %esp,%ebp
+  80041b:	8d 35 23 04 80 00    	lea    0x800423,%esi
+  800421:	0f 34                	sysenter
+  800423:	5d                   	pop    %ebp
+  800424:	83 c4 04             	add    $0x4,%esp
+  800427:	5b                   	pop    %ebx
+  800428:	5e                   	pop    %esi
+  800429:	5f                   	pop    %edi
+  80042a:	5d                   	pop    %ebp
+  80042b:	c3                   	ret
+  80042c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800431:	be 00 00 00 00       	mov    $0x0,%esi
+  800436:	8b 55 08             	mov    0x8(%ebp),%edx
+  800439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80043f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800442:	cd 30                	int    $0x30
+  800444:	eb e1                	jmp    800427 <sys_ipc_try_send+0x31>
+
+00800446 <sys_ipc_recv>:
+  800446:	55                   	push   %ebp
+  800447:	89 e5                	mov    %esp,%ebp
+  800449:	57                   	push   %edi
+  80044a:	56                   	push   %esi
+  80044b:	53                   	push   %ebx
+  80044c:	83 ec 0c             	sub    $0xc,%esp
+  80044f:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800456:	74 32                	je     80048a <sys_ipc_recv+0x44>
+  800458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800460:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800465:	89 cb                	mov    %ecx,%ebx
+  800467:	89 cf                	mov    %ecx,%edi
+  800469:	6a 00                	push   $0x0
+  80046b:	55                   	push   %ebp
+  80046c:	89 e5                	mov    %esp,%ebp
+  80046e:	8d 35 76 04 80 00    	lea    0x800476,%esi
+  800474:	0f 34                	sysenter
+  800476:	5d                   	pop    %ebp
+  800477:	83 c4 04             	add    $0x4,%esp
+  80047a:	89 c2                	mov    %eax,%edx
+  80047c:	85 c0                	test   %eax,%eax
+  80047e:	7f 3c                	jg     8004bc <sys_ipc_recv+0x76>
+  800480:	89 d0                	mov    %edx,%eax
+  800482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800485:	5b                   	pop    %ebx
+  800486:	5e                   	pop    %esi
+  800487:	5f                   	pop    %edi
+  800488:	5d                   	pop    %ebp
+  800489:	c3                   	ret
+  80048a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800494:	8b 55 08             	mov    0x8(%ebp),%edx
+  800497:	89 cb                	mov    %ecx,%ebx
+  800499:	89 cf                	mov    %ecx,%edi
+  80049b:	89 ce                	mov    %ecx,%esi
+  80049d:	cd 30                	int    $0x30
+  80049f:	89 c2                	mov    %eax,%edx
+  8004a1:	85 c0                	test   %eax,%eax
+  8004a3:	7e db                	jle    800480 <sys_ipc_recv+0x3a>
+  8004a5:	83 ec 0c             	sub    $0xc,%esp
+  8004a8:	50                   	push   %eax
+  8004a9:	6a 0d                	push   $0xd
+  8004ab:	68 6a 31 80 00       	push   $0x80316a
+  8004b0:	6a 24                	push   $0x24
+  8004b2:	68 87 31 80 00       	push   $0x803187
+  8004b7:	e8 ac 1c 00 00       	call   802168 <_panic>
+  8004bc:	83 ec 0c             	sub    $0xc,%esp
+  8004bf:	50                   	push   %eax
+  8004c0:	6a 0d                	push   $0xd
+  8004c2:	68 6a 31 80 00       	push   $0x80316a
+  8004c7:	6a 48                	push   $0x48
+  8004c9:	68 87 31 80 00       	push   $0x803187
+  8004ce:	e8 95 1c 00 00       	call   802168 <_panic>
+
+008004d3 <sys_ipc_send>:
+  8004d3:	55                   	push   %ebp
+  8004d4:	89 e5                	mov    %esp,%ebp
+  8004d6:	57                   	push   %edi
+  8004d7:	56                   	push   %esi
+  8004d8:	53                   	push   %ebx
+  8004d9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004e0:	74 27                	je     800509 <sys_ipc_send+0x36>
+  8004e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f3:	6a 00                	push   $0x0
+  8004f5:	55                   	push   %ebp
+  8004f6:	89 e5                	mov    %esp,%ebp
+  8004f8:	8d 35 00 05 80 00    	lea    0x800500,%esi
+  8004fe:	0f 34                	sysenter
+  800500:	5d                   	pop    %ebp
+  800501:	83 c4 04             	add    $0x4,%esp
+  800504:	5b                   	pop    %ebx
+  800505:	5e                   	pop    %esi
+  800506:	5f                   	pop    %edi
+  800507:	5d                   	pop    %ebp
+  800508:	c3                   	ret
+  800509:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80050e:	be 00 00 00 00       	mov    $0x0,%esi
+  800513:	8b 55 08             	mov    0x8(%ebp),%edx
+  800516:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800519:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80051c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80051f:	cd 30                	int    $0x30
+  800521:	eb e1                	jmp    800504 <sys_ipc_send+0x31>
+
+00800523 <sys_ipc_call>:
+  800523:	55                   	push   %ebp
+  800524:	89 e5                	mov    %esp,%ebp
+  800526:	57                   	push   %edi
+  800527:	56                   	push   %esi
+  800528:	53                   	push   %ebx
+  800529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800534:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800537:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80053a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80053d:	cd 30                	int    $0x30
+  80053f:	5b                   	pop    %ebx
+  800540:	5e                   	pop    %esi
+  800541:	5f                   	pop    %edi
+  800542:	5d                   	pop    %ebp
+  800543:	c3                   	ret
+
+00800544 <sys_ipc_reply_recv>:
+  800544:	55                   	push   %ebp
+  800545:	89 e5                	mov    %esp,%ebp
+  800547:	57                   	push   %edi
+  800548:	56                   	push   %esi
+  800549:	53                   	push   %ebx
+  80054a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800550:	b8 10 00 00 00       	mov    $0x10,%eax
+  800555:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800558:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80055b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80055e:	cd 30                	int    $0x30
+  800560:	5b                   	pop    %ebx
+  800561:	5e                   	pop    %esi
+  800562:	5f                   	pop    %edi
+  800563:	5d                   	pop    %ebp
+  800564:	c3                   	ret
+
+00800565 <sys_time_msec>:
+  800565:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80056a:	85 c0                	test   %eax,%eax
+  80056c:	75 06                	jne    800574 <sys_time_msec+0xf>
+  80056e:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  800573:	c3                   	ret
+  800574:	55                   	push   %ebp
+  800575:	89 e5                	mov    %esp,%ebp
+  800577:	57                   	push   %edi
+  800578:	56                   	push   %esi
+  800579:	53                   	push   %ebx
+  80057a:	83 ec 0c             	sub    $0xc,%esp
+  80057d:	0f 31                	rdtsc
+  80057f:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800585:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80058b:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  800591:	29 c8                	sub    %ecx,%eax
+  800593:	19 da                	sbb    %ebx,%edx
+  800595:	bf 00 00 00 00       	mov    $0x0,%edi
+  80059a:	57                   	push   %edi
+  80059b:	56                   	push   %esi
+  80059c:	52                   	push   %edx
+  80059d:	50                   	push   %eax
+  80059e:	e8 95 2a 00 00       	call   803038 <__udivdi3>
+  8005a3:	83 c4 10             	add    $0x10,%esp
+  8005a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a9:	5b                   	pop    %ebx
+  8005aa:	5e                   	pop    %esi
+  8005ab:	5f                   	pop    %edi
+  8005ac:	5d                   	pop    %ebp
+  8005ad:	c3                   	ret
+
+008005ae <sys_env_swap>:
+  8005ae:	55                   	push   %ebp
+  8005af:	89 e5                	mov    %esp,%ebp
+  8005b1:	57                   	push   %edi
+  8005b2:	56                   	push   %esi
+  8005b3:	53                   	push   %ebx
+  8005b4:	83 ec 0c             	sub    $0xc,%esp
+  8005b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005c4:	89 cb                	mov    %ecx,%ebx
+  8005c6:	89 cf                	mov    %ecx,%edi
+  8005c8:	89 ce                	mov    %ecx,%esi
+  8005ca:	cd 30                	int    $0x30
+  8005cc:	85 c0                	test   %eax,%eax
+  8005ce:	7f 08                	jg     8005d8 <sys_env_swap+0x2a>
+  8005d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d3:	5b                   	pop    %ebx
+  8005d4:	5e                   	pop    %esi
+  8005d5:	5f                   	pop    %edi
+  8005d6:	5d                   	pop    %ebp
+  8005d7:	c3                   	ret
+  8005d8:	83 ec 0c             	sub    $0xc,%esp
+  8005db:	50                   	push   %eax
+  8005dc:	6a 12                	push   $0x12
+  8005de:	68 6a 31 80 00       	push   $0x80316a
+  8005e3:	6a 24                	push   $0x24
+  8005e5:	68 87 31 80 00       	push   $0x803187
+  8005ea:	e8 79 1b 00 00       	call   802168 <_panic>
+
+008005ef <sys_net_try_send>:
+  8005ef:	55                   	push   %ebp
+  8005f0:	89 e5                	mov    %esp,%ebp
+  8005f2:	57                   	push   %edi
+  8005f3:	56                   	push   %esi
+  8005f4:	53                   	push   %ebx
+  8005f5:	83 ec 0c             	sub    $0xc,%esp
+  8005f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800600:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800603:	b8 13 00 00 00       	mov    $0x13,%eax
+  800608:	89 df                	mov    %ebx,%edi
+  80060a:	89 de                	mov    %ebx,%esi
+  80060c:	cd 30                	int    $0x30
+  80060e:	85 c0                	test   %eax,%eax
+  800610:	7f 08                	jg     80061a <sys_net_try_send+0x2b>
+  800612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800615:	5b                   	pop    %ebx
+  800616:	5e                   	pop    %esi
+  800617:	5f                   	pop    %edi
+  800618:	5d                   	pop    %ebp
+  800619:	c3                   	ret
+  80061a:	83 ec 0c             	sub    $0xc,%esp
+  80061d:	50                   	push   %eax
+  80061e:	6a 13                	push   $0x13
+  800620:	68 6a 31 80 00       	push   $0x80316a
+  800625:	6a 24                	push   $0x24
+  800627:	68 87 31 80 00       	push   $0x803187
+  80062c:	e8 37 1b 00 00       	call   802168 <_panic>
+
+00800631 <sys_net_try_receive>:
+  800631:	55                   	push   %ebp
+  800632:	89 e5                	mov    %esp,%ebp
+  800634:	57                   	push   %edi
+  800635:	56                   	push   %esi
+  800636:	53                   	push   %ebx
+  800637:	83 ec 0c             	sub    $0xc,%esp
+  80063a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80063f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800642:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800645:	b8 14 00 00 00       	mov    $0x14,%eax
+  80064a:	89 df                	mov    %ebx,%edi
+  80064c:	89 de                	mov    %ebx,%esi
+  80064e:	cd 30                	int    $0x30
+  800650:	85 c0                	test   %eax,%eax
+  800652:	7f 08                	jg     80065c <sys_net_try_receive+0x2b>
+  800654:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800657:	5b                   	pop    %ebx
+  800658:	5e                   	pop    %esi
+  800659:	5f                   	pop    %edi
+  80065a:	5d                   	pop    %ebp
+  80065b:	c3                   	ret
+  80065c:	83 ec 0c             	sub    $0xc,%esp
+  80065f:	50                   	push   %eax
+  800660:	6a 14                	push   $0x14
+  800662:	68 6a 31 80 00       	push   $0x80316a
+  800667:	6a 24                	push   $0x24
+  800669:	68 87 31 80 00       	push   $0x803187
+  80066e:	e8 f5 1a 00 00       	call   802168 <_panic>
+
+00800673 <sys_net_recv_page>:
+  800673:	55                   	push   %ebp
+  800674:	89 e5                	mov    %esp,%ebp
+  800676:	57                   	push   %edi
+  800677:	56                   	push   %esi
+  800678:	53                   	push   %ebx
+  800679:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800681:	b8 27 00 00 00       	mov    $0x27,%eax
+  800686:	89 cb                	mov    %ecx,%ebx
+  800688:	89 cf                	mov    %ecx,%edi
+  80068a:	89 ce                	mov    %ecx,%esi
+  80068c:	cd 30                	int    $0x30
+  80068e:	5b                   	pop    %ebx
+  80068f:	5e                   	pop    %esi
+  800690:	5f                   	pop    %edi
+  800691:	5d                   	pop    %ebp
+  800692:	c3                   	ret
+
+00800693 <sys_net_wait>:
+  800693:	55                   	push   %ebp
+  800694:	89 e5                	mov    %esp,%ebp
+  800696:	57                   	push   %edi
+  800697:	56                   	push   %esi
+  800698:	53                   	push   %ebx
+  800699:	ba 00 00 00 00       	mov    $0x0,%edx
+  80069e:	b8 26 00 00 00       	mov    $0x26,%eax
+  8006a3:	89 d1                	mov    %edx,%ecx
+  8006a5:	89 d3                	mov    %edx,%ebx
+  8006a7:	89 d7                	mov    %edx,%edi
+  8006a9:	89 d6                	mov    %edx,%esi
+  8006ab:	cd 30                	int    $0x30
+  8006ad:	5b                   	pop    %ebx
+  8006ae:	5e                   	pop    %esi
+  8006af:	5f                   	pop    %edi
+  8006b0:	5d                   	pop    %ebp
+  8006b1:	c3                   	ret
+
+008006b2 <sys_get_mac>:
+  8006b2:	55                   	push   %ebp
+  8006b3:	89 e5                	mov    %esp,%ebp
+  8006b5:	57                   	push   %edi
+  8006b6:	56                   	push   %esi
+  8006b7:	53                   	push   %ebx
+  8006b8:	83 ec 0c             	sub    $0xc,%esp
+  8006bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006cb:	89 df                	mov    %ebx,%edi
+  8006cd:	89 de                	mov    %ebx,%esi
+  8006cf:	cd 30                	int    $0x30
+  8006d1:	85 c0                	test   %eax,%eax
+  8006d3:	7f 08                	jg     8006dd <sys_get_mac+0x2b>
+  8006d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d8:	5b                   	pop    %ebx
+  8006d9:	5e                   	pop    %esi
+  8006da:	5f                   	pop    %edi
+  8006db:	5d                   	pop    %ebp
+  8006dc:	c3                   	ret
+  8006dd:	83 ec 0c             	sub    $0xc,%esp
+  8006e0:	50                   	push   %eax
+  8006e1:	6a 15                	push   $0x15
+  8006e3:	68 6a 31 80 00       	push   $0x80316a
+  8006e8:	6a 24                	push   $0x24
+  8006ea:	68 87 31 80 00       	push   $0x803187
+  8006ef:	e8 74 1a 00 00       	call   802168 <_panic>
+
+008006f4 <sys_env_lease>:
+  8006f4:	55                   	push   %ebp
+  8006f5:	89 e5                	mov    %esp,%ebp
+  8006f7:	57                   	push   %edi
+  8006f8:	56                   	push   %esi
+  8006f9:	53                   	push   %ebx
+  8006fa:	83 ec 0c             	sub    $0xc,%esp
+  8006fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800702:	8b 55 08             	mov    0x8(%ebp),%edx
+  800705:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800708:	b8 16 00 00 00       	mov    $0x16,%eax
+  80070d:	89 df                	mov    %ebx,%edi
+  80070f:	89 de                	mov    %ebx,%esi
+  800711:	cd 30                	int    $0x30
+  800713:	85 c0                	test   %eax,%eax
+  800715:	7f 08                	jg     80071f <sys_env_lease+0x2b>
+  800717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80071a:	5b                   	pop    %ebx
+  80071b:	5e                   	pop    %esi
+  80071c:	5f                   	pop    %edi
+  80071d:	5d                   	pop    %ebp
+  80071e:	c3                   	ret
+  80071f:	83 ec 0c             	sub    $0xc,%esp
+  800722:	50                   	push   %eax
+  800723:	6a 16                	push   $0x16
+  800725:	68 6a 31 80 00       	push   $0x80316a
+  80072a:	6a 24                	push   $0x24
+  80072c:	68 87 31 80 00       	push   $0x803187
+  800731:	e8 32 1a 00 00       	call   802168 <_panic>
+
+00800736 <sys_copy_mem>:
+  800736:	55                   	push   %ebp
+  800737:	89 e5                	mov    %esp,%ebp
+  800739:	57                   	push   %edi
+  80073a:	56                   	push   %esi
+  80073b:	53                   	push   %ebx
+  80073c:	83 ec 0c             	sub    $0xc,%esp
+  80073f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800742:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800745:	b8 17 00 00 00       	mov    $0x17,%eax
+  80074a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80074d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800750:	8b 75 18             	mov    0x18(%ebp),%esi
+  800753:	cd 30                	int    $0x30
+  800755:	85 c0                	test   %eax,%eax
+  800757:	7f 08                	jg     800761 <sys_copy_mem+0x2b>
+  800759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80075c:	5b                   	pop    %ebx
+  80075d:	5e                   	pop    %esi
+  80075e:	5f                   	pop    %edi
+  80075f:	5d                   	pop    %ebp
+  800760:	c3                   	ret
+  800761:	83 ec 0c             	sub    $0xc,%esp
+  800764:	50                   	push   %eax
+  800765:	6a 17                	push   $0x17
+  800767:	68 6a 31 80 00       	push   $0x80316a
+  80076c:	6a 24                	push   $0x24
+  80076e:	68 87 31 80 00       	push   $0x803187
+  800773:	e8 f0 19 00 00       	call   802168 <_panic>
+
+00800778 <sys_get_perms>:
+  800778:	55                   	push   %ebp
+  800779:	89 e5                	mov    %esp,%ebp
+  80077b:	57                   	push   %edi
+  80077c:	56                   	push   %esi
+  80077d:	53                   	push   %ebx
+  80077e:	83 ec 0c             	sub    $0xc,%esp
+  800781:	be 00 00 00 00       	mov    $0x0,%esi
+  800786:	8b 55 08             	mov    0x8(%ebp),%edx
+  800789:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80078c:	b8 18 00 00 00       	mov    $0x18,%eax
+  800791:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800794:	89 f7                	mov    %esi,%edi
+  800796:	cd 30                	int    $0x30
+  800798:	85 c0                	test   %eax,%eax
+  80079a:	7f 08                	jg     8007a4 <sys_get_perms+0x2c>
+  80079c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80079f:	5b                   	pop    %ebx
+  8007a0:	5e                   	pop    %esi
+  8007a1:	5f                   	pop    %edi
+  8007a2:	5d                   	pop    %ebp
+  8007a3:	c3                   	ret
+  8007a4:	83 ec 0c             	sub    $0xc,%esp
+  8007a7:	50                   	push   %eax
+  8007a8:	6a 18                	push   $0x18
+  8007aa:	68 6a 31 80 00       	push   $0x80316a
+  8007af:	6a 24                	push   $0x24
+  8007b1:	68 87 31 80 00       	push   $0x803187
+  8007b6:	e8 ad 19 00 00       	call   802168 <_panic>
+
+008007bb <sys_env_unsuspend>:
+  8007bb:	55                   	push   %ebp
+  8007bc:	89 e5                	mov    %esp,%ebp
+  8007be:	57                   	push   %edi
+  8007bf:	56                   	push   %esi
+  8007c0:	53                   	push   %ebx
+  8007c1:	83 ec 0c             	sub    $0xc,%esp
+  8007c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8007c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007cf:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007d7:	89 f7                	mov    %esi,%edi
+  8007d9:	cd 30                	int    $0x30
+  8007db:	85 c0                	test   %eax,%eax
+  8007dd:	7f 08                	jg     8007e7 <sys_env_unsuspend+0x2c>
+  8007df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e2:	5b                   	pop    %ebx
+  8007e3:	5e                   	pop    %esi
+  8007e4:	5f                   	pop    %edi
+  8007e5:	5d                   	pop    %ebp
+  8007e6:	c3                   	ret
+  8007e7:	83 ec 0c             	sub    $0xc,%esp
+  8007ea:	50                   	push   %eax
+  8007eb:	6a 19                	push   $0x19
+  8007ed:	68 6a 31 80 00       	push   $0x80316a
+  8007f2:	6a 24                	push   $0x24
+  8007f4:	68 87 31 80 00       	push   $0x803187
+  8007f9:	e8 6a 19 00 00       	call   802168 <_panic>
+
+008007fe <sys_migrate>:
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	57                   	push   %edi
+  800802:	56                   	push   %esi
+  800803:	53                   	push   %ebx
+  800804:	83 ec 0c             	sub    $0xc,%esp
+  800807:	ba 00 80 80 00       	mov    $0x808000,%edx
+  80080c:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  800812:	76 11                	jbe    800825 <sys_migrate+0x27>
+  800814:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800819:	0f b6 08             	movzbl (%eax),%ecx
+  80081c:	05 00 10 00 00       	add    $0x1000,%eax
+  800821:	39 d0                	cmp    %edx,%eax
+  800823:	72 f4                	jb     800819 <sys_migrate+0x1b>
+  800825:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80082d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800832:	89 cb                	mov    %ecx,%ebx
+  800834:	89 cf                	mov    %ecx,%edi
+  800836:	89 ce                	mov    %ecx,%esi
+  800838:	cd 30                	int    $0x30
+  80083a:	85 c0                	test   %eax,%eax
+  80083c:	7f 08                	jg     800846 <sys_migrate+0x48>
+  80083e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800841:	5b                   	pop    %ebx
+  800842:	5e                   	pop    %esi
+  800843:	5f                   	pop    %edi
+  800844:	5d                   	pop    %ebp
+  800845:	c3                   	ret
+  800846:	83 ec 0c             	sub    $0xc,%esp
+  800849:	50                   	push   %eax
+  80084a:	6a 1a                	push   $0x1a
+  80084c:	68 6a 31 80 00       	push   $0x80316a
+  800851:	6a 24                	push   $0x24
+  800853:	68 87 31 80 00       	push   $0x803187
+  800858:	e8 0b 19 00 00       	call   802168 <_panic>
+
+0080085d <sys_lease_complete>:
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	57                   	push   %edi
+  800861:	56                   	push   %esi
+  800862:	53                   	push   %ebx
+  800863:	83 ec 0c             	sub    $0xc,%esp
+  800866:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800870:	89 d1                	mov    %edx,%ecx
+  800872:	89 d3                	mov    %edx,%ebx
+  800874:	89 d7                	mov    %edx,%edi
+  800876:	89 d6                	mov    %edx,%esi
+  800878:	cd 30                	int    $0x30
+  80087a:	85 c0                	test   %eax,%eax
+  80087c:	7f 08                	jg     800886 <sys_lease_complete+0x29>
+  80087e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800881:	5b                   	pop    %ebx
+  800882:	5e                   	pop    %esi
+  800883:	5f                   	pop    %edi
+  800884:	5d                   	pop    %ebp
+  800885:	c3                   	ret
+  800886:	83 ec 0c             	sub    $0xc,%esp
+  800889:	50                   	push   %eax
+  80088a:	6a 1b                	push   $0x1b
+  80088c:	68 6a 31 80 00       	push   $0x80316a
+  800891:	6a 24                	push   $0x24
+  800893:	68 87 31 80 00       	push   $0x803187
+  800898:	e8 cb 18 00 00       	call   802168 <_panic>
+
+0080089d <sys_env_set_thisenv>:
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	57                   	push   %edi
+  8008a1:	56                   	push   %esi
+  8008a2:	53                   	push   %ebx
+  8008a3:	83 ec 0c             	sub    $0xc,%esp
+  8008a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008b6:	89 df                	mov    %ebx,%edi
+  8008b8:	89 de                	mov    %ebx,%esi
+  8008ba:	cd 30                	int    $0x30
+  8008bc:	85 c0                	test   %eax,%eax
+  8008be:	7f 08                	jg     8008c8 <sys_env_set_thisenv+0x2b>
+  8008c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c3:	5b                   	pop    %ebx
+  8008c4:	5e                   	pop    %esi
+  8008c5:	5f                   	pop    %edi
+  8008c6:	5d                   	pop    %ebp
+  8008c7:	c3                   	ret
+  8008c8:	83 ec 0c             	sub    $0xc,%esp
+  8008cb:	50                   	push   %eax
+  8008cc:	6a 1c                	push   $0x1c
+  8008ce:	68 6a 31 80 00       	push   $0x80316a
+  8008d3:	6a 24                	push   $0x24
+  8008d5:	68 87 31 80 00       	push   $0x803187
+  8008da:	e8 89 18 00 00       	call   802168 <_panic>
+
+008008df <sys_env_set_sched>:
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	57                   	push   %edi
+  8008e3:	56                   	push   %esi
+  8008e4:	53                   	push   %ebx
+  8008e5:	83 ec 0c             	sub    $0xc,%esp
+  8008e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8008ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8008f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008fb:	89 f7                	mov    %esi,%edi
+  8008fd:	cd 30                	int    $0x30
+  8008ff:	85 c0                	test   %eax,%eax
+  800901:	7f 08                	jg     80090b <sys_env_set_sched+0x2c>
+  800903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800906:	5b                   	pop    %ebx
+  800907:	5e                   	pop    %esi
+  800908:	5f                   	pop    %edi
+  800909:	5d                   	pop    %ebp
+  80090a:	c3                   	ret
+  80090b:	83 ec 0c             	sub    $0xc,%esp
+  80090e:	50                   	push   %eax
+  80090f:	6a 1d                	push   $0x1d
+  800911:	68 6a 31 80 00       	push   $0x80316a
+  800916:	6a 24                	push   $0x24
+  800918:	68 87 31 80 00       	push   $0x803187
+  80091d:	e8 46 18 00 00       	call   802168 <_panic>
+
+00800922 <sys_batch>:
+  800922:	55                   	push   %ebp
+  800923:	89 e5                	mov    %esp,%ebp
+  800925:	57                   	push   %edi
+  800926:	56                   	push   %esi
+  800927:	53                   	push   %ebx
+  800928:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80092d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800930:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800933:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800938:	89 df                	mov    %ebx,%edi
+  80093a:	89 de                	mov    %ebx,%esi
+  80093c:	cd 30                	int    $0x30
+  80093e:	5b                   	pop    %ebx
+  80093f:	5e                   	pop    %esi
+  800940:	5f                   	pop    %edi
+  800941:	5d                   	pop    %ebp
+  800942:	c3                   	ret
+
+00800943 <sys_env_stats>:
+  800943:	55                   	push   %ebp
+  800944:	89 e5                	mov    %esp,%ebp
+  800946:	57                   	push   %edi
+  800947:	56                   	push   %esi
+  800948:	53                   	push   %ebx
+  800949:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80094e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800951:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800954:	b8 23 00 00 00       	mov    $0x23,%eax
+  800959:	89 df                	mov    %ebx,%edi
+  80095b:	89 de                	mov    %ebx,%esi
+  80095d:	cd 30                	int    $0x30
+  80095f:	5b                   	pop    %ebx
+  800960:	5e                   	pop    %esi
+  800961:	5f                   	pop    %edi
+  800962:	5d                   	pop    %ebp
+  800963:	c3                   	ret
+
+00800964 <sys_trace>:
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	57                   	push   %edi
+  800968:	56                   	push   %esi
+  800969:	53                   	push   %ebx
+  80096a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800972:	b8 24 00 00 00       	mov    $0x24,%eax
+  800977:	89 cb                	mov    %ecx,%ebx
+  800979:	89 cf                	mov    %ecx,%edi
+  80097b:	89 ce                	mov    %ecx,%esi
+  80097d:	cd 30                	int    $0x30
+  80097f:	5b                   	pop    %ebx
+  800980:	5e                   	pop    %esi
+  800981:	5f                   	pop    %edi
+  800982:	5d                   	pop    %ebp
+  800983:	c3                   	ret
+
+00800984 <sys_env_set_pager>:
+  800984:	55                   	push   %ebp
+  800985:	89 e5                	mov    %esp,%ebp
+  800987:	57                   	push   %edi
+  800988:	56                   	push   %esi
+  800989:	53                   	push   %ebx
+  80098a:	83 ec 0c             	sub    $0xc,%esp
+  80098d:	be 00 00 00 00       	mov    $0x0,%esi
+  800992:	8b 55 08             	mov    0x8(%ebp),%edx
+  800995:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800998:	b8 25 00 00 00       	mov    $0x25,%eax
+  80099d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009a0:	89 f7                	mov    %esi,%edi
+  8009a2:	cd 30                	int    $0x30
+  8009a4:	85 c0                	test   %eax,%eax
+  8009a6:	7f 08                	jg     8009b0 <sys_env_set_pager+0x2c>
+  8009a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ab:	5b                   	pop    %ebx
+  8009ac:	5e                   	pop    %esi
+  8009ad:	5f                   	pop    %edi
+  8009ae:	5d                   	pop    %ebp
+  8009af:	c3                   	ret
+  8009b0:	83 ec 0c             	sub    $0xc,%esp
+  8009b3:	50                   	push   %eax
+  8009b4:	6a 25                	push   $0x25
+  8009b6:	68 6a 31 80 00       	push   $0x80316a
+  8009bb:	6a 24                	push   $0x24
+  8009bd:	68 87 31 80 00       	push   $0x803187
+  8009c2:	e8 a1 17 00 00       	call   802168 <_panic>
+
+008009c7 <sys_pager_retire>:
+  8009c7:	55                   	push   %ebp
+  8009c8:	89 e5                	mov    %esp,%ebp
+  8009ca:	57                   	push   %edi
+  8009cb:	56                   	push   %esi
+  8009cc:	53                   	push   %ebx
+  8009cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009da:	89 cb                	mov    %ecx,%ebx
+  8009dc:	89 cf                	mov    %ecx,%edi
+  8009de:	89 ce                	mov    %ecx,%esi
+  8009e0:	cd 30                	int    $0x30
+  8009e2:	5b                   	pop    %ebx
+  8009e3:	5e                   	pop    %esi
+  8009e4:	5f                   	pop    %edi
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <sys_prof>:
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	57                   	push   %edi
+  8009eb:	56                   	push   %esi
+  8009ec:	53                   	push   %ebx
+  8009ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f8:	b8 22 00 00 00       	mov    $0x22,%eax
+  8009fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a00:	89 f7                	mov    %esi,%edi
+  800a02:	cd 30                	int    $0x30
+  800a04:	5b                   	pop    %ebx
+  800a05:	5e                   	pop    %esi
+  800a06:	5f                   	pop    %edi
+  800a07:	5d                   	pop    %ebp
+  800a08:	c3                   	ret
+
+00800a09 <fd2num>:
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a14:	c1 e8 0c             	shr    $0xc,%eax
+  800a17:	5d                   	pop    %ebp
+  800a18:	c3                   	ret
+
+00800a19 <fd2data>:
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a24:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a29:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a2e:	5d                   	pop    %ebp
+  800a2f:	c3                   	ret
+
+00800a30 <fd_alloc>:
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a38:	89 c2                	mov    %eax,%edx
+  800a3a:	c1 ea 16             	shr    $0x16,%edx
+  800a3d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a44:	f6 c2 01             	test   $0x1,%dl
+  800a47:	74 29                	je     800a72 <fd_alloc+0x42>
+  800a49:	89 c2                	mov    %eax,%edx
+  800a4b:	c1 ea 0c             	shr    $0xc,%edx
+  800a4e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a55:	f6 c2 01             	test   $0x1,%dl
+  800a58:	74 18                	je     800a72 <fd_alloc+0x42>
+  800a5a:	05 00 10 00 00       	add    $0x1000,%eax
+  800a5f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a64:	75 d2                	jne    800a38 <fd_alloc+0x8>
+  800a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a70:	eb 05                	jmp    800a77 <fd_alloc+0x47>
+  800a72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7a:	89 02                	mov    %eax,(%edx)
+  800a7c:	89 c8                	mov    %ecx,%eax
+  800a7e:	5d                   	pop    %ebp
+  800a7f:	c3                   	ret
+
+00800a80 <fd_lookup>:
+  800a80:	55                   	push   %ebp
+  800a81:	89 e5                	mov    %esp,%ebp
+  800a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a86:	83 f8 1f             	cmp    $0x1f,%eax
+  800a89:	77 30                	ja     800abb <fd_lookup+0x3b>
+  800a8b:	c1 e0 0c             	shl    $0xc,%eax
+  800a8e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800a93:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800a99:	f6 c2 01             	test   $0x1,%dl
+  800a9c:	74 24                	je     800ac2 <fd_lookup+0x42>
+  800a9e:	89 c2                	mov    %eax,%edx
+  800aa0:	c1 ea 0c             	shr    $0xc,%edx
+  800aa3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800aaa:	f6 c2 01             	test   $0x1,%dl
+  800aad:	74 1a                	je     800ac9 <fd_lookup+0x49>
+  800aaf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab2:	89 02                	mov    %eax,(%edx)
+  800ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+  800abb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac0:	eb f7                	jmp    800ab9 <fd_lookup+0x39>
+  800ac2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac7:	eb f0                	jmp    800ab9 <fd_lookup+0x39>
+  800ac9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ace:	eb e9                	jmp    800ab9 <fd_lookup+0x39>
+
+00800ad0 <dev_lookup>:
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	53                   	push   %ebx
+  800ad4:	83 ec 04             	sub    $0x4,%esp
+  800ad7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adf:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800ae4:	39 13                	cmp    %edx,(%ebx)
+  800ae6:	74 37                	je     800b1f <dev_lookup+0x4f>
+  800ae8:	83 c0 01             	add    $0x1,%eax
+  800aeb:	8b 1c 85 14 32 80 00 	mov    0x803214(,%eax,4),%ebx
+  800af2:	85 db                	test   %ebx,%ebx
+  800af4:	75 ee                	jne    800ae4 <dev_lookup+0x14>
+  800af6:	a1 10 50 80 00       	mov    0x805010,%eax
+  800afb:	8b 40 48             	mov    0x48(%eax),%eax
+  800afe:	83 ec 04             	sub    $0x4,%esp
+  800b01:	52                   	push   %edx
+  800b02:	50                   	push   %eax
+  800b03:	68 98 31 80 00       	push   $0x803198
+  800b08:	e8 36 17 00 00       	call   802243 <cprintf>
+  800b0d:	83 c4 10             	add    $0x10,%esp
+  800b10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b15:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b18:	89 1a                	mov    %ebx,(%edx)
+  800b1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1d:	c9                   	leave
+  800b1e:	c3                   	ret
+  800b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b24:	eb ef                	jmp    800b15 <dev_lookup+0x45>
+
+00800b26 <fd_close>:
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	57                   	push   %edi
+  800b2a:	56                   	push   %esi
+  800b2b:	53                   	push   %ebx
+  800b2c:	83 ec 24             	sub    $0x24,%esp
+  800b2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b32:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b35:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b38:	50                   	push   %eax
+  800b39:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b3f:	c1 e8 0c             	shr    $0xc,%eax
+  800b42:	50                   	push   %eax
+  800b43:	e8 38 ff ff ff       	call   800a80 <fd_lookup>
+  800b48:	89 c3                	mov    %eax,%ebx
+  800b4a:	83 c4 10             	add    $0x10,%esp
+  800b4d:	85 c0                	test   %eax,%eax
+  800b4f:	78 05                	js     800b56 <fd_close+0x30>
+  800b51:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b54:	74 0f                	je     800b65 <fd_close+0x3f>
+  800b56:	85 ff                	test   %edi,%edi
+  800b58:	0f 44 df             	cmove  %edi,%ebx
+  800b5b:	89 d8                	mov    %ebx,%eax
+  800b5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b60:	5b                   	pop    %ebx
+  800b61:	5e                   	pop    %esi
+  800b62:	5f                   	pop    %edi
+  800b63:	5d                   	pop    %ebp
+  800b64:	c3                   	ret
+  800b65:	83 ec 08             	sub    $0x8,%esp
+  800b68:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b6b:	50                   	push   %eax
+  800b6c:	ff 36                	push   (%esi)
+  800b6e:	e8 5d ff ff ff       	call   800ad0 <dev_lookup>
+  800b73:	89 c3                	mov    %eax,%ebx
+  800b75:	83 c4 10             	add    $0x10,%esp
+  800b78:	85 c0                	test   %eax,%eax
+  800b7a:	78 1a                	js     800b96 <fd_close+0x70>
+  800b7c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b7f:	8b 40 10             	mov    0x10(%eax),%eax
+  800b82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b87:	85 c0                	test   %eax,%eax
+  800b89:	74 0b                	je     800b96 <fd_close+0x70>
+  800b8b:	83 ec 0c             	sub    $0xc,%esp
+  800b8e:	56                   	push   %esi
+  800b8f:	ff d0                	call   *%eax
+  800b91:	89 c3                	mov    %eax,%ebx
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	83 ec 08             	sub    $0x8,%esp
+  800b99:	56                   	push   %esi
+  800b9a:	6a 00                	push   $0x0
+  800b9c:	e8 cc f6 ff ff       	call   80026d <sys_page_unmap>
+  800ba1:	83 c4 10             	add    $0x10,%esp
+  800ba4:	eb b5                	jmp    800b5b <fd_close+0x35>
+
+00800ba6 <close>:
+  800ba6:	55                   	push   %ebp
+  800ba7:	89 e5                	mov    %esp,%ebp
+  800ba9:	83 ec 20             	sub    $0x20,%esp
+  800bac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800baf:	50                   	push   %eax
+  800bb0:	ff 75 08             	push   0x8(%ebp)
+  800bb3:	e8 c8 fe ff ff       	call   800a80 <fd_lookup>
+  800bb8:	83 c4 10             	add    $0x10,%esp
+  800bbb:	85 c0                	test   %eax,%eax
+  800bbd:	79 02                	jns    800bc1 <close+0x1b>
+  800bbf:	c9                   	leave
+  800bc0:	c3                   	ret
+  800bc1:	83 ec 08             	sub    $0x8,%esp
+  800bc4:	6a 01                	push   $0x1
+  800bc6:	ff 75 f4             	push   -0xc(%ebp)
+  800bc9:	e8 58 ff ff ff       	call   800b26 <fd_close>
+  800bce:	83 c4 10             	add    $0x10,%esp
+  800bd1:	eb ec                	jmp    800bbf <close+0x19>
+
+00800bd3 <close_all>:
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	53                   	push   %ebx
+  800bd7:	83 ec 04             	sub    $0x4,%esp
+  800bda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdf:	83 ec 0c             	sub    $0xc,%esp
+  800be2:	53                   	push   %ebx
+  800be3:	e8 be ff ff ff       	call   800ba6 <close>
+  800be8:	83 c3 01             	add    $0x1,%ebx
+  800beb:	83 c4 10             	add    $0x10,%esp
+  800bee:	83 fb 20             	cmp    $0x20,%ebx
+  800bf1:	75 ec                	jne    800bdf <close_all+0xc>
+  800bf3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf6:	c9                   	leave
+  800bf7:	c3                   	ret
+
+00800bf8 <dup>:
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	57                   	push   %edi
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+  800bfe:	83 ec 34             	sub    $0x34,%esp
+  800c01:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c04:	50                   	push   %eax
+  800c05:	ff 75 08             	push   0x8(%ebp)
+  800c08:	e8 73 fe ff ff       	call   800a80 <fd_lookup>
+  800c0d:	89 c3                	mov    %eax,%ebx
+  800c0f:	83 c4 10             	add    $0x10,%esp
+  800c12:	85 c0                	test   %eax,%eax
+  800c14:	78 7f                	js     800c95 <dup+0x9d>
+  800c16:	83 ec 0c             	sub    $0xc,%esp
+  800c19:	ff 75 0c             	push   0xc(%ebp)
+  800c1c:	e8 85 ff ff ff       	call   800ba6 <close>
+  800c21:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c24:	c1 e6 0c             	shl    $0xc,%esi
+  800c27:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c2d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c30:	89 3c 24             	mov    %edi,(%esp)
+  800c33:	e8 e1 fd ff ff       	call   800a19 <fd2data>
+  800c38:	89 c3                	mov    %eax,%ebx
+  800c3a:	89 34 24             	mov    %esi,(%esp)
+  800c3d:	e8 d7 fd ff ff       	call   800a19 <fd2data>
+  800c42:	83 c4 10             	add    $0x10,%esp
+  800c45:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c48:	89 d8                	mov    %ebx,%eax
+  800c4a:	c1 e8 16             	shr    $0x16,%eax
+  800c4d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c54:	a8 01                	test   $0x1,%al
+  800c56:	74 11                	je     800c69 <dup+0x71>
+  800c58:	89 d8                	mov    %ebx,%eax
+  800c5a:	c1 e8 0c             	shr    $0xc,%eax
+  800c5d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c64:	f6 c2 01             	test   $0x1,%dl
+  800c67:	75 36                	jne    800c9f <dup+0xa7>
+  800c69:	89 f8                	mov    %edi,%eax
+  800c6b:	c1 e8 0c             	shr    $0xc,%eax
+  800c6e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c75:	83 ec 0c             	sub    $0xc,%esp
+  800c78:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c7d:	50                   	push   %eax
+  800c7e:	56                   	push   %esi
+  800c7f:	6a 00                	push   $0x0
+  800c81:	57                   	push   %edi
+  800c82:	6a 00                	push   $0x0
+  800c84:	e8 55 f5 ff ff       	call   8001de <sys_page_map>
+  800c89:	89 c3                	mov    %eax,%ebx
+  800c8b:	83 c4 20             	add    $0x20,%esp
+  800c8e:	85 c0                	test   %eax,%eax
+  800c90:	78 33                	js     800cc5 <dup+0xcd>
+  800c92:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c95:	89 d8                	mov    %ebx,%eax
+  800c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9a:	5b                   	pop    %ebx
+  800c9b:	5e                   	pop    %esi
+  800c9c:	5f                   	pop    %edi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+  800c9f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ca6:	83 ec 0c             	sub    $0xc,%esp
+  800ca9:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cae:	50                   	push   %eax
+  800caf:	ff 75 d4             	push   -0x2c(%ebp)
+  800cb2:	6a 00                	push   $0x0
+  800cb4:	53                   	push   %ebx
+  800cb5:	6a 00                	push   $0x0
+  800cb7:	e8 22 f5 ff ff       	call   8001de <sys_page_map>
+  800cbc:	89 c3                	mov    %eax,%ebx
+  800cbe:	83 c4 20             	add    $0x20,%esp
+  800cc1:	85 c0                	test   %eax,%eax
+  800cc3:	79 a4                	jns    800c69 <dup+0x71>
+  800cc5:	83 ec 08             	sub    $0x8,%esp
+  800cc8:	56                   	push   %esi
+  800cc9:	6a 00                	push   $0x0
+  800ccb:	e8 9d f5 ff ff       	call   80026d <sys_page_unmap>
+  800cd0:	83 c4 08             	add    $0x8,%esp
+  800cd3:	ff 75 d4             	push   -0x2c(%ebp)
+  800cd6:	6a 00                	push   $0x0
+  800cd8:	e8 90 f5 ff ff       	call   80026d <sys_page_unmap>
+  800cdd:	83 c4 10             	add    $0x10,%esp
+  800ce0:	eb b3                	jmp    800c95 <dup+0x9d>
+
+00800ce2 <read>:
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  800ce7:	83 ec 18             	sub    $0x18,%esp
+  800cea:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ced:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800cf0:	50                   	push   %eax
+  800cf1:	56                   	push   %esi
+  800cf2:	e8 89 fd ff ff       	call   800a80 <fd_lookup>
+  800cf7:	83 c4 10             	add    $0x10,%esp
+  800cfa:	85 c0                	test   %eax,%eax
+  800cfc:	78 3c                	js     800d3a <read+0x58>
+  800cfe:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d01:	83 ec 08             	sub    $0x8,%esp
+  800d04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d07:	50                   	push   %eax
+  800d08:	ff 33                	push   (%ebx)
+  800d0a:	e8 c1 fd ff ff       	call   800ad0 <dev_lookup>
+  800d0f:	83 c4 10             	add    $0x10,%esp
+  800d12:	85 c0                	test   %eax,%eax
+  800d14:	78 24                	js     800d3a <read+0x58>
+  800d16:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d19:	83 e0 03             	and    $0x3,%eax
+  800d1c:	83 f8 01             	cmp    $0x1,%eax
+  800d1f:	74 20                	je     800d41 <read+0x5f>
+  800d21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d24:	8b 40 08             	mov    0x8(%eax),%eax
+  800d27:	85 c0                	test   %eax,%eax
+  800d29:	74 37                	je     800d62 <read+0x80>
+  800d2b:	83 ec 04             	sub    $0x4,%esp
+  800d2e:	ff 75 10             	push   0x10(%ebp)
+  800d31:	ff 75 0c             	push   0xc(%ebp)
+  800d34:	53                   	push   %ebx
+  800d35:	ff d0                	call   *%eax
+  800d37:	83 c4 10             	add    $0x10,%esp
+  800d3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+  800d41:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d46:	8b 40 48             	mov    0x48(%eax),%eax
+  800d49:	83 ec 04             	sub    $0x4,%esp
+  800d4c:	56                   	push   %esi
+  800d4d:	50                   	push   %eax
+  800d4e:	68 d9 31 80 00       	push   $0x8031d9
+  800d53:	e8 eb 14 00 00       	call   802243 <cprintf>
+  800d58:	83 c4 10             	add    $0x10,%esp
+  800d5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d60:	eb d8                	jmp    800d3a <read+0x58>
+  800d62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d67:	eb d1                	jmp    800d3a <read+0x58>
+
+00800d69 <readn>:
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d75:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d78:	85 f6                	test   %esi,%esi
+  800d7a:	74 30                	je     800dac <readn+0x43>
+  800d7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d86:	83 ec 04             	sub    $0x4,%esp
+  800d89:	89 f2                	mov    %esi,%edx
+  800d8b:	29 c2                	sub    %eax,%edx
+  800d8d:	52                   	push   %edx
+  800d8e:	01 f8                	add    %edi,%eax
+  800d90:	50                   	push   %eax
+  800d91:	ff 75 08             	push   0x8(%ebp)
+  800d94:	e8 49 ff ff ff       	call   800ce2 <read>
+  800d99:	83 c4 10             	add    $0x10,%esp
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	78 15                	js     800db5 <readn+0x4c>
+  800da0:	74 11                	je     800db3 <readn+0x4a>
+  800da2:	01 c3                	add    %eax,%ebx
+  800da4:	89 d8                	mov    %ebx,%eax
+  800da6:	39 f3                	cmp    %esi,%ebx
+  800da8:	72 dc                	jb     800d86 <readn+0x1d>
+  800daa:	eb 09                	jmp    800db5 <readn+0x4c>
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	eb 02                	jmp    800db5 <readn+0x4c>
+  800db3:	89 d8                	mov    %ebx,%eax
+  800db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db8:	5b                   	pop    %ebx
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+
+00800dbd <write>:
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+  800dc2:	83 ec 18             	sub    $0x18,%esp
+  800dc5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dc8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dcb:	50                   	push   %eax
+  800dcc:	53                   	push   %ebx
+  800dcd:	e8 ae fc ff ff       	call   800a80 <fd_lookup>
+  800dd2:	83 c4 10             	add    $0x10,%esp
+  800dd5:	85 c0                	test   %eax,%eax
+  800dd7:	78 37                	js     800e10 <write+0x53>
+  800dd9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ddc:	83 ec 08             	sub    $0x8,%esp
+  800ddf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800de2:	50                   	push   %eax
+  800de3:	ff 36                	push   (%esi)
+  800de5:	e8 e6 fc ff ff       	call   800ad0 <dev_lookup>
+  800dea:	83 c4 10             	add    $0x10,%esp
+  800ded:	85 c0                	test   %eax,%eax
+  800def:	78 1f                	js     800e10 <write+0x53>
+  800df1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800df5:	74 20                	je     800e17 <write+0x5a>
+  800df7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800dfa:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dfd:	85 c0                	test   %eax,%eax
+  800dff:	74 37                	je     800e38 <write+0x7b>
+  800e01:	83 ec 04             	sub    $0x4,%esp
+  800e04:	ff 75 10             	push   0x10(%ebp)
+  800e07:	ff 75 0c             	push   0xc(%ebp)
+  800e0a:	56                   	push   %esi
+  800e0b:	ff d0                	call   *%eax
+  800e0d:	83 c4 10             	add    $0x10,%esp
+  800e10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+  800e17:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e1c:	8b 40 48             	mov    0x48(%eax),%eax
+  800e1f:	83 ec 04             	sub    $0x4,%esp
+  800e22:	53                   	push   %ebx
+  800e23:	50                   	push   %eax
+  800e24:	68 f5 31 80 00       	push   $0x8031f5
+  800e29:	e8 15 14 00 00       	call   802243 <cprintf>
+  800e2e:	83 c4 10             	add    $0x10,%esp
+  800e31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e36:	eb d8                	jmp    800e10 <write+0x53>
+  800e38:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e3d:	eb d1                	jmp    800e10 <write+0x53>
+
+00800e3f <seek>:
+  800e3f:	55                   	push   %ebp
+  800e40:	89 e5                	mov    %esp,%ebp
+  800e42:	83 ec 20             	sub    $0x20,%esp
+  800e45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e48:	50                   	push   %eax
+  800e49:	ff 75 08             	push   0x8(%ebp)
+  800e4c:	e8 2f fc ff ff       	call   800a80 <fd_lookup>
+  800e51:	83 c4 10             	add    $0x10,%esp
+  800e54:	85 c0                	test   %eax,%eax
+  800e56:	78 0e                	js     800e66 <seek+0x27>
+  800e58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e5e:	89 50 04             	mov    %edx,0x4(%eax)
+  800e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e66:	c9                   	leave
+  800e67:	c3                   	ret
+
+00800e68 <ftruncate>:
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+  800e6d:	83 ec 18             	sub    $0x18,%esp
+  800e70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e73:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e76:	50                   	push   %eax
+  800e77:	53                   	push   %ebx
+  800e78:	e8 03 fc ff ff       	call   800a80 <fd_lookup>
+  800e7d:	83 c4 10             	add    $0x10,%esp
+  800e80:	85 c0                	test   %eax,%eax
+  800e82:	78 34                	js     800eb8 <ftruncate+0x50>
+  800e84:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e87:	83 ec 08             	sub    $0x8,%esp
+  800e8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e8d:	50                   	push   %eax
+  800e8e:	ff 36                	push   (%esi)
+  800e90:	e8 3b fc ff ff       	call   800ad0 <dev_lookup>
+  800e95:	83 c4 10             	add    $0x10,%esp
+  800e98:	85 c0                	test   %eax,%eax
+  800e9a:	78 1c                	js     800eb8 <ftruncate+0x50>
+  800e9c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ea0:	74 1d                	je     800ebf <ftruncate+0x57>
+  800ea2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea5:	8b 40 18             	mov    0x18(%eax),%eax
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	74 34                	je     800ee0 <ftruncate+0x78>
+  800eac:	83 ec 08             	sub    $0x8,%esp
+  800eaf:	ff 75 0c             	push   0xc(%ebp)
+  800eb2:	56                   	push   %esi
+  800eb3:	ff d0                	call   *%eax
+  800eb5:	83 c4 10             	add    $0x10,%esp
+  800eb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5d                   	pop    %ebp
+  800ebe:	c3                   	ret
+  800ebf:	a1 10 50 80 00       	mov    0x805010,%eax
+  800ec4:	8b 40 48             	mov    0x48(%eax),%eax
+  800ec7:	83 ec 04             	sub    $0x4,%esp
+  800eca:	53                   	push   %ebx
+  800ecb:	50                   	push   %eax
+  800ecc:	68 b8 31 80 00       	push   $0x8031b8
+  800ed1:	e8 6d 13 00 00       	call   802243 <cprintf>
+  800ed6:	83 c4 10             	add    $0x10,%esp
+  800ed9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ede:	eb d8                	jmp    800eb8 <ftruncate+0x50>
+  800ee0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ee5:	eb d1                	jmp    800eb8 <ftruncate+0x50>
+
+00800ee7 <fstat>:
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	56                   	push   %esi
+  800eeb:	53                   	push   %ebx
+  800eec:	83 ec 18             	sub    $0x18,%esp
+  800eef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ef2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ef5:	50                   	push   %eax
+  800ef6:	ff 75 08             	push   0x8(%ebp)
+  800ef9:	e8 82 fb ff ff       	call   800a80 <fd_lookup>
+  800efe:	83 c4 10             	add    $0x10,%esp
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	78 49                	js     800f4e <fstat+0x67>
+  800f05:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f08:	83 ec 08             	sub    $0x8,%esp
+  800f0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f0e:	50                   	push   %eax
+  800f0f:	ff 36                	push   (%esi)
+  800f11:	e8 ba fb ff ff       	call   800ad0 <dev_lookup>
+  800f16:	83 c4 10             	add    $0x10,%esp
+  800f19:	85 c0                	test   %eax,%eax
+  800f1b:	78 31                	js     800f4e <fstat+0x67>
+  800f1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f20:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f24:	74 2f                	je     800f55 <fstat+0x6e>
+  800f26:	c6 03 00             	movb   $0x0,(%ebx)
+  800f29:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f30:	00 00 00 
+  800f33:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f3a:	00 00 00 
+  800f3d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f43:	83 ec 08             	sub    $0x8,%esp
+  800f46:	53                   	push   %ebx
+  800f47:	56                   	push   %esi
+  800f48:	ff 50 14             	call   *0x14(%eax)
+  800f4b:	83 c4 10             	add    $0x10,%esp
+  800f4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f51:	5b                   	pop    %ebx
+  800f52:	5e                   	pop    %esi
+  800f53:	5d                   	pop    %ebp
+  800f54:	c3                   	ret
+  800f55:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f5a:	eb f2                	jmp    800f4e <fstat+0x67>
+
+00800f5c <stat>:
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	56                   	push   %esi
+  800f60:	53                   	push   %ebx
+  800f61:	83 ec 08             	sub    $0x8,%esp
+  800f64:	6a 00                	push   $0x0
+  800f66:	ff 75 08             	push   0x8(%ebp)
+  800f69:	e8 31 05 00 00       	call   80149f <open>
+  800f6e:	89 c3                	mov    %eax,%ebx
+  800f70:	83 c4 10             	add    $0x10,%esp
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	78 1b                	js     800f92 <stat+0x36>
+  800f77:	83 ec 08             	sub    $0x8,%esp
+  800f7a:	ff 75 0c             	push   0xc(%ebp)
+  800f7d:	50                   	push   %eax
+  800f7e:	e8 64 ff ff ff       	call   800ee7 <fstat>
+  800f83:	89 c6                	mov    %eax,%esi
+  800f85:	89 1c 24             	mov    %ebx,(%esp)
+  800f88:	e8 19 fc ff ff       	call   800ba6 <close>
+  800f8d:	83 c4 10             	add    $0x10,%esp
+  800f90:	89 f3                	mov    %esi,%ebx
+  800f92:	89 d8                	mov    %ebx,%eax
+  800f94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f97:	5b                   	pop    %ebx
+  800f98:	5e                   	pop    %esi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <fsipc>:
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	56                   	push   %esi
+  800f9f:	53                   	push   %ebx
+  800fa0:	89 c3                	mov    %eax,%ebx
+  800fa2:	89 d6                	mov    %edx,%esi
+  800fa4:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800fab:	74 20                	je     800fcd <fsipc+0x32>
+  800fad:	83 ec 08             	sub    $0x8,%esp
+  800fb0:	6a 00                	push   $0x0
+  800fb2:	56                   	push   %esi
+  800fb3:	6a 07                	push   $0x7
+  800fb5:	68 00 60 80 00       	push   $0x806000
+  800fba:	53                   	push   %ebx
+  800fbb:	ff 35 08 50 80 00    	push   0x805008
+  800fc1:	e8 a4 1d 00 00       	call   802d6a <ipc_call>
+  800fc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5e                   	pop    %esi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+  800fcd:	83 ec 0c             	sub    $0xc,%esp
+  800fd0:	6a 02                	push   $0x2
+  800fd2:	e8 2e 1f 00 00       	call   802f05 <ipc_find_env>
+  800fd7:	a3 08 50 80 00       	mov    %eax,0x805008
+  800fdc:	83 c4 10             	add    $0x10,%esp
+  800fdf:	eb cc                	jmp    800fad <fsipc+0x12>
+
+00800fe1 <devfile_trunc>:
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	83 ec 08             	sub    $0x8,%esp
+  800fe7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fea:	8b 40 0c             	mov    0xc(%eax),%eax
+  800fed:	a3 00 60 80 00       	mov    %eax,0x806000
+  800ff2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff5:	a3 04 60 80 00       	mov    %eax,0x806004
+  800ffa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fff:	b8 02 00 00 00       	mov    $0x2,%eax
+  801004:	e8 92 ff ff ff       	call   800f9b <fsipc>
+  801009:	c9                   	leave
+  80100a:	c3                   	ret
+
+0080100b <devfile_flush>:
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	83 ec 08             	sub    $0x8,%esp
+  801011:	8b 45 08             	mov    0x8(%ebp),%eax
+  801014:	8b 40 0c             	mov    0xc(%eax),%eax
+  801017:	a3 00 60 80 00       	mov    %eax,0x806000
+  80101c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801021:	b8 08 00 00 00       	mov    $0x8,%eax
+  801026:	e8 70 ff ff ff       	call   800f9b <fsipc>
+  80102b:	c9                   	leave
+  80102c:	c3                   	ret
+
+0080102d <devfile_stat>:
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	53                   	push   %ebx
+  801031:	83 ec 04             	sub    $0x4,%esp
+  801034:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801037:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80103d:	a3 00 60 80 00       	mov    %eax,0x806000
+  801042:	ba 00 00 00 00       	mov    $0x0,%edx
+  801047:	b8 07 00 00 00       	mov    $0x7,%eax
+  80104c:	e8 4a ff ff ff       	call   800f9b <fsipc>
+  801051:	85 c0                	test   %eax,%eax
+  801053:	78 2c                	js     801081 <devfile_stat+0x54>
+  801055:	83 ec 08             	sub    $0x8,%esp
+  801058:	68 00 60 80 00       	push   $0x806000
+  80105d:	53                   	push   %ebx
+  80105e:	e8 d7 18 00 00       	call   80293a <strcpy>
+  801063:	a1 80 60 80 00       	mov    0x806080,%eax
+  801068:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80106e:	a1 84 60 80 00       	mov    0x806084,%eax
+  801073:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801079:	83 c4 10             	add    $0x10,%esp
+  80107c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801081:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801084:	c9                   	leave
+  801085:	c3                   	ret
+
+00801086 <fsring_rw>:
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 2c             	sub    $0x2c,%esp
+  80108f:	89 c7                	mov    %eax,%edi
+  801091:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801094:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801097:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80109c:	a8 01                	test   $0x1,%al
+  80109e:	74 0d                	je     8010ad <fsring_rw+0x27>
+  8010a0:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010a5:	a8 01                	test   $0x1,%al
+  8010a7:	0f 85 d5 00 00 00    	jne    801182 <fsring_rw+0xfc>
+  8010ad:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010b2:	8b 40 48             	mov    0x48(%eax),%eax
+  8010b5:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010bb:	0f 84 fc 00 00 00    	je     8011bd <fsring_rw+0x137>
+  8010c1:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010c8:	0f 84 02 01 00 00    	je     8011d0 <fsring_rw+0x14a>
+  8010ce:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010d3:	83 ec 04             	sub    $0x4,%esp
+  8010d6:	68 07 02 00 00       	push   $0x207
+  8010db:	53                   	push   %ebx
+  8010dc:	6a 00                	push   $0x0
+  8010de:	e8 b8 f0 ff ff       	call   80019b <sys_page_alloc>
+  8010e3:	83 c4 10             	add    $0x10,%esp
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	0f 88 f9 00 00 00    	js     8011e7 <fsring_rw+0x161>
+  8010ee:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010f4:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8010fa:	75 d7                	jne    8010d3 <fsring_rw+0x4d>
+  8010fc:	6a 0e                	push   $0xe
+  8010fe:	6a 0d                	push   $0xd
+  801100:	ff 35 08 50 80 00    	push   0x805008
+  801106:	68 00 00 f0 cf       	push   $0xcff00000
+  80110b:	e8 c4 0c 00 00       	call   801dd4 <ipcring_init>
+  801110:	83 c4 08             	add    $0x8,%esp
+  801113:	6a 00                	push   $0x0
+  801115:	6a 00                	push   $0x0
+  801117:	68 07 02 00 00       	push   $0x207
+  80111c:	68 00 00 f0 cf       	push   $0xcff00000
+  801121:	6a 0b                	push   $0xb
+  801123:	ff 35 08 50 80 00    	push   0x805008
+  801129:	e8 3c 1c 00 00       	call   802d6a <ipc_call>
+  80112e:	89 c6                	mov    %eax,%esi
+  801130:	83 c4 20             	add    $0x20,%esp
+  801133:	85 c0                	test   %eax,%eax
+  801135:	0f 88 ac 00 00 00    	js     8011e7 <fsring_rw+0x161>
+  80113b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801140:	89 d9                	mov    %ebx,%ecx
+  801142:	83 c3 01             	add    $0x1,%ebx
+  801145:	89 da                	mov    %ebx,%edx
+  801147:	c1 e2 0c             	shl    $0xc,%edx
+  80114a:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801150:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801156:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80115c:	83 ec 08             	sub    $0x8,%esp
+  80115f:	6a 00                	push   $0x0
+  801161:	6a 00                	push   $0x0
+  801163:	68 07 02 00 00       	push   $0x207
+  801168:	50                   	push   %eax
+  801169:	6a 0c                	push   $0xc
+  80116b:	ff 35 08 50 80 00    	push   0x805008
+  801171:	e8 f4 1b 00 00       	call   802d6a <ipc_call>
+  801176:	83 c4 20             	add    $0x20,%esp
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	78 6a                	js     8011e7 <fsring_rw+0x161>
+  80117d:	83 fb 08             	cmp    $0x8,%ebx
+  801180:	75 be                	jne    801140 <fsring_rw+0xba>
+  801182:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801186:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80118b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801190:	0f 45 c2             	cmovne %edx,%eax
+  801193:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801196:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80119d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011a4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b5:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011b8:	e9 4b 01 00 00       	jmp    801308 <fsring_rw+0x282>
+  8011bd:	e8 a3 f3 ff ff       	call   800565 <sys_time_msec>
+  8011c2:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011c8:	0f 89 f3 fe ff ff    	jns    8010c1 <fsring_rw+0x3b>
+  8011ce:	eb 54                	jmp    801224 <fsring_rw+0x19e>
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+  8011d3:	6a 02                	push   $0x2
+  8011d5:	e8 2b 1d 00 00       	call   802f05 <ipc_find_env>
+  8011da:	a3 08 50 80 00       	mov    %eax,0x805008
+  8011df:	83 c4 10             	add    $0x10,%esp
+  8011e2:	e9 e7 fe ff ff       	jmp    8010ce <fsring_rw+0x48>
+  8011e7:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	53                   	push   %ebx
+  8011f0:	6a 00                	push   $0x0
+  8011f2:	e8 76 f0 ff ff       	call   80026d <sys_page_unmap>
+  8011f7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011fd:	83 c4 10             	add    $0x10,%esp
+  801200:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801206:	75 e4                	jne    8011ec <fsring_rw+0x166>
+  801208:	e8 58 f3 ff ff       	call   800565 <sys_time_msec>
+  80120d:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801212:	a3 00 50 80 00       	mov    %eax,0x805000
+  801217:	a1 10 50 80 00       	mov    0x805010,%eax
+  80121c:	8b 40 48             	mov    0x48(%eax),%eax
+  80121f:	a3 04 50 80 00       	mov    %eax,0x805004
+  801224:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80122b:	e9 7a 01 00 00       	jmp    8013aa <fsring_rw+0x324>
+  801230:	8b 57 0c             	mov    0xc(%edi),%edx
+  801233:	89 10                	mov    %edx,(%eax)
+  801235:	89 58 04             	mov    %ebx,0x4(%eax)
+  801238:	89 f2                	mov    %esi,%edx
+  80123a:	03 57 04             	add    0x4(%edi),%edx
+  80123d:	89 50 08             	mov    %edx,0x8(%eax)
+  801240:	83 ec 04             	sub    $0x4,%esp
+  801243:	53                   	push   %ebx
+  801244:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801247:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80124a:	52                   	push   %edx
+  80124b:	83 c0 0c             	add    $0xc,%eax
+  80124e:	50                   	push   %eax
+  80124f:	e8 96 18 00 00       	call   802aea <memmove>
+  801254:	83 c4 10             	add    $0x10,%esp
+  801257:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80125a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80125d:	89 08                	mov    %ecx,(%eax)
+  80125f:	83 ec 0c             	sub    $0xc,%esp
+  801262:	68 00 00 f0 cf       	push   $0xcff00000
+  801267:	e8 c6 0b 00 00       	call   801e32 <ipcring_req_push>
+  80126c:	01 de                	add    %ebx,%esi
+  80126e:	83 c4 10             	add    $0x10,%esp
+  801271:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801274:	73 4c                	jae    8012c2 <fsring_rw+0x23c>
+  801276:	83 ec 0c             	sub    $0xc,%esp
+  801279:	68 00 00 f0 cf       	push   $0xcff00000
+  80127e:	e8 89 0b 00 00       	call   801e0c <ipcring_req_slot>
+  801283:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801286:	83 c4 10             	add    $0x10,%esp
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	74 35                	je     8012c2 <fsring_rw+0x23c>
+  80128d:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801292:	83 e0 07             	and    $0x7,%eax
+  801295:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80129a:	c1 e0 0c             	shl    $0xc,%eax
+  80129d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012a0:	29 f3                	sub    %esi,%ebx
+  8012a2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012a5:	39 cb                	cmp    %ecx,%ebx
+  8012a7:	0f 47 d9             	cmova  %ecx,%ebx
+  8012aa:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012ae:	75 80                	jne    801230 <fsring_rw+0x1aa>
+  8012b0:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012b3:	89 10                	mov    %edx,(%eax)
+  8012b5:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012b8:	89 f2                	mov    %esi,%edx
+  8012ba:	03 57 04             	add    0x4(%edi),%edx
+  8012bd:	89 50 08             	mov    %edx,0x8(%eax)
+  8012c0:	eb 95                	jmp    801257 <fsring_rw+0x1d1>
+  8012c2:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012ca:	83 ec 0c             	sub    $0xc,%esp
+  8012cd:	68 00 00 f0 cf       	push   $0xcff00000
+  8012d2:	e8 94 0b 00 00       	call   801e6b <ipcring_rsp_wait>
+  8012d7:	8b 58 04             	mov    0x4(%eax),%ebx
+  8012da:	83 c4 10             	add    $0x10,%esp
+  8012dd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8012e1:	75 45                	jne    801328 <fsring_rw+0x2a2>
+  8012e3:	85 db                	test   %ebx,%ebx
+  8012e5:	79 41                	jns    801328 <fsring_rw+0x2a2>
+  8012e7:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8012ea:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8012f1:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8012f8:	83 ec 0c             	sub    $0xc,%esp
+  8012fb:	68 00 00 f0 cf       	push   $0xcff00000
+  801300:	e8 cc 0b 00 00       	call   801ed1 <ipcring_rsp_pop>
+  801305:	83 c4 10             	add    $0x10,%esp
+  801308:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80130e:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801313:	39 c2                	cmp    %eax,%edx
+  801315:	74 75                	je     80138c <fsring_rw+0x306>
+  801317:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80131b:	75 a5                	jne    8012c2 <fsring_rw+0x23c>
+  80131d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801320:	0f 82 50 ff ff ff    	jb     801276 <fsring_rw+0x1f0>
+  801326:	eb 9a                	jmp    8012c2 <fsring_rw+0x23c>
+  801328:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80132c:	75 ca                	jne    8012f8 <fsring_rw+0x272>
+  80132e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801332:	74 31                	je     801365 <fsring_rw+0x2df>
+  801334:	8b 45 08             	mov    0x8(%ebp),%eax
+  801337:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80133a:	29 c8                	sub    %ecx,%eax
+  80133c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80133f:	39 d0                	cmp    %edx,%eax
+  801341:	0f 47 c2             	cmova  %edx,%eax
+  801344:	39 d8                	cmp    %ebx,%eax
+  801346:	ba 01 00 00 00       	mov    $0x1,%edx
+  80134b:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80134f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801352:	b8 01 00 00 00       	mov    $0x1,%eax
+  801357:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80135b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80135e:	01 d9                	add    %ebx,%ecx
+  801360:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801363:	eb 93                	jmp    8012f8 <fsring_rw+0x272>
+  801365:	83 ec 04             	sub    $0x4,%esp
+  801368:	53                   	push   %ebx
+  801369:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80136c:	83 e0 07             	and    $0x7,%eax
+  80136f:	c1 e0 0c             	shl    $0xc,%eax
+  801372:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801378:	50                   	push   %eax
+  801379:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80137c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80137f:	01 c8                	add    %ecx,%eax
+  801381:	50                   	push   %eax
+  801382:	e8 63 17 00 00       	call   802aea <memmove>
+  801387:	83 c4 10             	add    $0x10,%esp
+  80138a:	eb a8                	jmp    801334 <fsring_rw+0x2ae>
+  80138c:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801390:	75 09                	jne    80139b <fsring_rw+0x315>
+  801392:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801395:	0f 82 db fe ff ff    	jb     801276 <fsring_rw+0x1f0>
+  80139b:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80139e:	01 57 04             	add    %edx,0x4(%edi)
+  8013a1:	85 d2                	test   %edx,%edx
+  8013a3:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013a7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013aa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b0:	5b                   	pop    %ebx
+  8013b1:	5e                   	pop    %esi
+  8013b2:	5f                   	pop    %edi
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+
+008013b5 <devfile_write>:
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	57                   	push   %edi
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  8013be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c7:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013cd:	76 1a                	jbe    8013e9 <devfile_write+0x34>
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	53                   	push   %ebx
+  8013d3:	89 f1                	mov    %esi,%ecx
+  8013d5:	ba 06 00 00 00       	mov    $0x6,%edx
+  8013da:	89 f8                	mov    %edi,%eax
+  8013dc:	e8 a5 fc ff ff       	call   801086 <fsring_rw>
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013e7:	75 39                	jne    801422 <devfile_write+0x6d>
+  8013e9:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8013ee:	39 c3                	cmp    %eax,%ebx
+  8013f0:	0f 47 d8             	cmova  %eax,%ebx
+  8013f3:	8b 47 0c             	mov    0xc(%edi),%eax
+  8013f6:	a3 00 60 80 00       	mov    %eax,0x806000
+  8013fb:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801401:	83 ec 04             	sub    $0x4,%esp
+  801404:	53                   	push   %ebx
+  801405:	56                   	push   %esi
+  801406:	68 08 60 80 00       	push   $0x806008
+  80140b:	e8 da 16 00 00       	call   802aea <memmove>
+  801410:	ba 00 00 00 00       	mov    $0x0,%edx
+  801415:	b8 04 00 00 00       	mov    $0x4,%eax
+  80141a:	e8 7c fb ff ff       	call   800f9b <fsipc>
+  80141f:	83 c4 10             	add    $0x10,%esp
+  801422:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801425:	5b                   	pop    %ebx
+  801426:	5e                   	pop    %esi
+  801427:	5f                   	pop    %edi
+  801428:	5d                   	pop    %ebp
+  801429:	c3                   	ret
+
+0080142a <devfile_read>:
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+  801430:	83 ec 0c             	sub    $0xc,%esp
+  801433:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801436:	8b 75 10             	mov    0x10(%ebp),%esi
+  801439:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80143f:	76 1d                	jbe    80145e <devfile_read+0x34>
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	56                   	push   %esi
+  801445:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801448:	ba 05 00 00 00       	mov    $0x5,%edx
+  80144d:	89 f8                	mov    %edi,%eax
+  80144f:	e8 32 fc ff ff       	call   801086 <fsring_rw>
+  801454:	89 c3                	mov    %eax,%ebx
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80145c:	75 37                	jne    801495 <devfile_read+0x6b>
+  80145e:	8b 47 0c             	mov    0xc(%edi),%eax
+  801461:	a3 00 60 80 00       	mov    %eax,0x806000
+  801466:	89 35 04 60 80 00    	mov    %esi,0x806004
+  80146c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801471:	b8 03 00 00 00       	mov    $0x3,%eax
+  801476:	e8 20 fb ff ff       	call   800f9b <fsipc>
+  80147b:	89 c3                	mov    %eax,%ebx
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 14                	js     801495 <devfile_read+0x6b>
+  801481:	83 ec 04             	sub    $0x4,%esp
+  801484:	50                   	push   %eax
+  801485:	68 00 60 80 00       	push   $0x806000
+  80148a:	ff 75 0c             	push   0xc(%ebp)
+  80148d:	e8 58 16 00 00       	call   802aea <memmove>
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	89 d8                	mov    %ebx,%eax
+  801497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149a:	5b                   	pop    %ebx
+  80149b:	5e                   	pop    %esi
+  80149c:	5f                   	pop    %edi
+  80149d:	5d                   	pop    %ebp
+  80149e:	c3                   	ret
+
+0080149f <open>:
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+  8014a4:	83 ec 1c             	sub    $0x1c,%esp
+  8014a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014aa:	56                   	push   %esi
+  8014ab:	e8 3e 14 00 00       	call   8028ee <strlen>
+  8014b0:	83 c4 10             	add    $0x10,%esp
+  8014b3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014b8:	7f 6c                	jg     801526 <open+0x87>
+  8014ba:	83 ec 0c             	sub    $0xc,%esp
+  8014bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c0:	50                   	push   %eax
+  8014c1:	e8 6a f5 ff ff       	call   800a30 <fd_alloc>
+  8014c6:	89 c3                	mov    %eax,%ebx
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	78 3c                	js     80150b <open+0x6c>
+  8014cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014d2:	a3 00 64 80 00       	mov    %eax,0x806400
+  8014d7:	83 ec 08             	sub    $0x8,%esp
+  8014da:	56                   	push   %esi
+  8014db:	68 00 60 80 00       	push   $0x806000
+  8014e0:	e8 55 14 00 00       	call   80293a <strcpy>
+  8014e5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014ed:	e8 a9 fa ff ff       	call   800f9b <fsipc>
+  8014f2:	89 c3                	mov    %eax,%ebx
+  8014f4:	83 c4 10             	add    $0x10,%esp
+  8014f7:	85 c0                	test   %eax,%eax
+  8014f9:	78 19                	js     801514 <open+0x75>
+  8014fb:	83 ec 0c             	sub    $0xc,%esp
+  8014fe:	ff 75 f4             	push   -0xc(%ebp)
+  801501:	e8 03 f5 ff ff       	call   800a09 <fd2num>
+  801506:	89 c3                	mov    %eax,%ebx
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	89 d8                	mov    %ebx,%eax
+  80150d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801510:	5b                   	pop    %ebx
+  801511:	5e                   	pop    %esi
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+  801514:	83 ec 08             	sub    $0x8,%esp
+  801517:	6a 00                	push   $0x0
+  801519:	ff 75 f4             	push   -0xc(%ebp)
+  80151c:	e8 05 f6 ff ff       	call   800b26 <fd_close>
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	eb e5                	jmp    80150b <open+0x6c>
+  801526:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80152b:	eb de                	jmp    80150b <open+0x6c>
+
+0080152d <file_image>:
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	53                   	push   %ebx
+  801531:	83 ec 1c             	sub    $0x1c,%esp
+  801534:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801537:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153a:	50                   	push   %eax
+  80153b:	ff 75 08             	push   0x8(%ebp)
+  80153e:	e8 3d f5 ff ff       	call   800a80 <fd_lookup>
+  801543:	83 c4 10             	add    $0x10,%esp
+  801546:	85 c0                	test   %eax,%eax
+  801548:	78 58                	js     8015a2 <file_image+0x75>
+  80154a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80154d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801553:	39 08                	cmp    %ecx,(%eax)
+  801555:	75 50                	jne    8015a7 <file_image+0x7a>
+  801557:	83 fb 04             	cmp    $0x4,%ebx
+  80155a:	77 52                	ja     8015ae <file_image+0x81>
+  80155c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80155f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801564:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80156a:	83 ec 04             	sub    $0x4,%esp
+  80156d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  801570:	c1 e0 02             	shl    $0x2,%eax
+  801573:	50                   	push   %eax
+  801574:	ff 75 0c             	push   0xc(%ebp)
+  801577:	68 08 60 80 00       	push   $0x806008
+  80157c:	e8 69 15 00 00       	call   802aea <memmove>
+  801581:	ba 00 00 00 00       	mov    $0x0,%edx
+  801586:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80158b:	e8 0b fa ff ff       	call   800f9b <fsipc>
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	78 0b                	js     8015a2 <file_image+0x75>
+  801597:	8b 55 14             	mov    0x14(%ebp),%edx
+  80159a:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8015a0:	89 0a                	mov    %ecx,(%edx)
+  8015a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a5:	c9                   	leave
+  8015a6:	c3                   	ret
+  8015a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ac:	eb f4                	jmp    8015a2 <file_image+0x75>
+  8015ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b3:	eb ed                	jmp    8015a2 <file_image+0x75>
+
+008015b5 <remove>:
+  8015b5:	55                   	push   %ebp
+  8015b6:	89 e5                	mov    %esp,%ebp
+  8015b8:	53                   	push   %ebx
+  8015b9:	83 ec 10             	sub    $0x10,%esp
+  8015bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015bf:	53                   	push   %ebx
+  8015c0:	e8 29 13 00 00       	call   8028ee <strlen>
+  8015c5:	83 c4 10             	add    $0x10,%esp
+  8015c8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015cd:	7f 25                	jg     8015f4 <remove+0x3f>
+  8015cf:	83 ec 08             	sub    $0x8,%esp
+  8015d2:	53                   	push   %ebx
+  8015d3:	68 00 60 80 00       	push   $0x806000
+  8015d8:	e8 5d 13 00 00       	call   80293a <strcpy>
+  8015dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015e7:	e8 af f9 ff ff       	call   800f9b <fsipc>
+  8015ec:	83 c4 10             	add    $0x10,%esp
+  8015ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f2:	c9                   	leave
+  8015f3:	c3                   	ret
+  8015f4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8015f9:	eb f4                	jmp    8015ef <remove+0x3a>
+
+008015fb <sync>:
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	83 ec 08             	sub    $0x8,%esp
+  801601:	ba 00 00 00 00       	mov    $0x0,%edx
+  801606:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80160b:	e8 8b f9 ff ff       	call   800f9b <fsipc>
+  801610:	c9                   	leave
+  801611:	c3                   	ret
+
+00801612 <devsock_stat>:
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	83 ec 10             	sub    $0x10,%esp
+  801618:	68 28 32 80 00       	push   $0x803228
+  80161d:	ff 75 0c             	push   0xc(%ebp)
+  801620:	e8 15 13 00 00       	call   80293a <strcpy>
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	c9                   	leave
+  80162b:	c3                   	ret
+
+0080162c <devsock_close>:
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	53                   	push   %ebx
+  801630:	83 ec 10             	sub    $0x10,%esp
+  801633:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801636:	53                   	push   %ebx
+  801637:	e8 e3 18 00 00       	call   802f1f <pageref>
+  80163c:	89 c2                	mov    %eax,%edx
+  80163e:	83 c4 10             	add    $0x10,%esp
+  801641:	b8 00 00 00 00       	mov    $0x0,%eax
+  801646:	83 fa 01             	cmp    $0x1,%edx
+  801649:	74 05                	je     801650 <devsock_close+0x24>
+  80164b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+  801650:	83 ec 0c             	sub    $0xc,%esp
+  801653:	ff 73 0c             	push   0xc(%ebx)
+  801656:	e8 aa 02 00 00       	call   801905 <nsipc_close>
+  80165b:	83 c4 10             	add    $0x10,%esp
+  80165e:	eb eb                	jmp    80164b <devsock_close+0x1f>
+
+00801660 <devsock_write>:
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	83 ec 08             	sub    $0x8,%esp
+  801666:	6a 00                	push   $0x0
+  801668:	ff 75 10             	push   0x10(%ebp)
+  80166b:	ff 75 0c             	push   0xc(%ebp)
+  80166e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801671:	ff 70 0c             	push   0xc(%eax)
+  801674:	e8 6c 03 00 00       	call   8019e5 <nsipc_send>
+  801679:	c9                   	leave
+  80167a:	c3                   	ret
+
+0080167b <devsock_read>:
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	83 ec 08             	sub    $0x8,%esp
+  801681:	6a 00                	push   $0x0
+  801683:	ff 75 10             	push   0x10(%ebp)
+  801686:	ff 75 0c             	push   0xc(%ebp)
+  801689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80168c:	ff 70 0c             	push   0xc(%eax)
+  80168f:	e8 e2 02 00 00       	call   801976 <nsipc_recv>
+  801694:	c9                   	leave
+  801695:	c3                   	ret
+
+00801696 <fd2sockid>:
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	83 ec 20             	sub    $0x20,%esp
+  80169c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80169f:	52                   	push   %edx
+  8016a0:	50                   	push   %eax
+  8016a1:	e8 da f3 ff ff       	call   800a80 <fd_lookup>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	78 10                	js     8016bd <fd2sockid+0x27>
+  8016ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b0:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016b6:	39 08                	cmp    %ecx,(%eax)
+  8016b8:	75 05                	jne    8016bf <fd2sockid+0x29>
+  8016ba:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+  8016bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c4:	eb f7                	jmp    8016bd <fd2sockid+0x27>
+
+008016c6 <alloc_sockfd>:
+  8016c6:	55                   	push   %ebp
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	83 ec 1c             	sub    $0x1c,%esp
+  8016ce:	89 c6                	mov    %eax,%esi
+  8016d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d3:	50                   	push   %eax
+  8016d4:	e8 57 f3 ff ff       	call   800a30 <fd_alloc>
+  8016d9:	89 c3                	mov    %eax,%ebx
+  8016db:	83 c4 10             	add    $0x10,%esp
+  8016de:	85 c0                	test   %eax,%eax
+  8016e0:	78 43                	js     801725 <alloc_sockfd+0x5f>
+  8016e2:	83 ec 04             	sub    $0x4,%esp
+  8016e5:	68 07 04 00 00       	push   $0x407
+  8016ea:	ff 75 f4             	push   -0xc(%ebp)
+  8016ed:	6a 00                	push   $0x0
+  8016ef:	e8 a7 ea ff ff       	call   80019b <sys_page_alloc>
+  8016f4:	89 c3                	mov    %eax,%ebx
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	78 28                	js     801725 <alloc_sockfd+0x5f>
+  8016fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801700:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801706:	89 10                	mov    %edx,(%eax)
+  801708:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801712:	89 70 0c             	mov    %esi,0xc(%eax)
+  801715:	83 ec 0c             	sub    $0xc,%esp
+  801718:	50                   	push   %eax
+  801719:	e8 eb f2 ff ff       	call   800a09 <fd2num>
+  80171e:	89 c3                	mov    %eax,%ebx
+  801720:	83 c4 10             	add    $0x10,%esp
+  801723:	eb 0c                	jmp    801731 <alloc_sockfd+0x6b>
+  801725:	83 ec 0c             	sub    $0xc,%esp
+  801728:	56                   	push   %esi
+  801729:	e8 d7 01 00 00       	call   801905 <nsipc_close>
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	89 d8                	mov    %ebx,%eax
+  801733:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801736:	5b                   	pop    %ebx
+  801737:	5e                   	pop    %esi
+  801738:	5d                   	pop    %ebp
+  801739:	c3                   	ret
+
+0080173a <accept>:
+  80173a:	55                   	push   %ebp
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	83 ec 08             	sub    $0x8,%esp
+  801740:	8b 45 08             	mov    0x8(%ebp),%eax
+  801743:	e8 4e ff ff ff       	call   801696 <fd2sockid>
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	78 1b                	js     801767 <accept+0x2d>
+  80174c:	83 ec 04             	sub    $0x4,%esp
+  80174f:	ff 75 10             	push   0x10(%ebp)
+  801752:	ff 75 0c             	push   0xc(%ebp)
+  801755:	50                   	push   %eax
+  801756:	e8 07 01 00 00       	call   801862 <nsipc_accept>
+  80175b:	83 c4 10             	add    $0x10,%esp
+  80175e:	85 c0                	test   %eax,%eax
+  801760:	78 05                	js     801767 <accept+0x2d>
+  801762:	e8 5f ff ff ff       	call   8016c6 <alloc_sockfd>
+  801767:	c9                   	leave
+  801768:	c3                   	ret
+
+00801769 <bind>:
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	83 ec 08             	sub    $0x8,%esp
+  80176f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801772:	e8 1f ff ff ff       	call   801696 <fd2sockid>
+  801777:	85 c0                	test   %eax,%eax
+  801779:	78 12                	js     80178d <bind+0x24>
+  80177b:	83 ec 04             	sub    $0x4,%esp
+  80177e:	ff 75 10             	push   0x10(%ebp)
+  801781:	ff 75 0c             	push   0xc(%ebp)
+  801784:	50                   	push   %eax
+  801785:	e8 24 01 00 00       	call   8018ae <nsipc_bind>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	c9                   	leave
+  80178e:	c3                   	ret
+
+0080178f <shutdown>:
+  80178f:	55                   	push   %ebp
+  801790:	89 e5                	mov    %esp,%ebp
+  801792:	83 ec 08             	sub    $0x8,%esp
+  801795:	8b 45 08             	mov    0x8(%ebp),%eax
+  801798:	e8 f9 fe ff ff       	call   801696 <fd2sockid>
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 0f                	js     8017b0 <shutdown+0x21>
+  8017a1:	83 ec 08             	sub    $0x8,%esp
+  8017a4:	ff 75 0c             	push   0xc(%ebp)
+  8017a7:	50                   	push   %eax
+  8017a8:	e8 36 01 00 00       	call   8018e3 <nsipc_shutdown>
+  8017ad:	83 c4 10             	add    $0x10,%esp
+  8017b0:	c9                   	leave
+  8017b1:	c3                   	ret
+
+008017b2 <connect>:
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	83 ec 08             	sub    $0x8,%esp
+  8017b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017bb:	e8 d6 fe ff ff       	call   801696 <fd2sockid>
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	78 12                	js     8017d6 <connect+0x24>
+  8017c4:	83 ec 04             	sub    $0x4,%esp
+  8017c7:	ff 75 10             	push   0x10(%ebp)
+  8017ca:	ff 75 0c             	push   0xc(%ebp)
+  8017cd:	50                   	push   %eax
+  8017ce:	e8 4c 01 00 00       	call   80191f <nsipc_connect>
+  8017d3:	83 c4 10             	add    $0x10,%esp
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+
+008017d8 <listen>:
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e1:	e8 b0 fe ff ff       	call   801696 <fd2sockid>
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	78 0f                	js     8017f9 <listen+0x21>
+  8017ea:	83 ec 08             	sub    $0x8,%esp
+  8017ed:	ff 75 0c             	push   0xc(%ebp)
+  8017f0:	50                   	push   %eax
+  8017f1:	e8 5e 01 00 00       	call   801954 <nsipc_listen>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+008017fb <socket>:
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	83 ec 0c             	sub    $0xc,%esp
+  801801:	ff 75 10             	push   0x10(%ebp)
+  801804:	ff 75 0c             	push   0xc(%ebp)
+  801807:	ff 75 08             	push   0x8(%ebp)
+  80180a:	e8 34 02 00 00       	call   801a43 <nsipc_socket>
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	85 c0                	test   %eax,%eax
+  801814:	78 05                	js     80181b <socket+0x20>
+  801816:	e8 ab fe ff ff       	call   8016c6 <alloc_sockfd>
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+
+0080181d <nsipc>:
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	53                   	push   %ebx
+  801821:	83 ec 04             	sub    $0x4,%esp
+  801824:	89 c3                	mov    %eax,%ebx
+  801826:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80182d:	74 1f                	je     80184e <nsipc+0x31>
+  80182f:	83 ec 08             	sub    $0x8,%esp
+  801832:	6a 00                	push   $0x0
+  801834:	6a 00                	push   $0x0
+  801836:	6a 07                	push   $0x7
+  801838:	68 00 70 80 00       	push   $0x807000
+  80183d:	53                   	push   %ebx
+  80183e:	ff 35 0c 50 80 00    	push   0x80500c
+  801844:	e8 21 15 00 00       	call   802d6a <ipc_call>
+  801849:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80184c:	c9                   	leave
+  80184d:	c3                   	ret
+  80184e:	83 ec 0c             	sub    $0xc,%esp
+  801851:	6a 03                	push   $0x3
+  801853:	e8 ad 16 00 00       	call   802f05 <ipc_find_env>
+  801858:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80185d:	83 c4 10             	add    $0x10,%esp
+  801860:	eb cd                	jmp    80182f <nsipc+0x12>
+
+00801862 <nsipc_accept>:
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	53                   	push   %ebx
+  801866:	83 ec 04             	sub    $0x4,%esp
+  801869:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801871:	b8 01 00 00 00       	mov    $0x1,%eax
+  801876:	e8 a2 ff ff ff       	call   80181d <nsipc>
+  80187b:	89 c3                	mov    %eax,%ebx
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	79 07                	jns    801888 <nsipc_accept+0x26>
+  801881:	89 d8                	mov    %ebx,%eax
+  801883:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801886:	c9                   	leave
+  801887:	c3                   	ret
+  801888:	83 ec 04             	sub    $0x4,%esp
+  80188b:	ff 35 10 70 80 00    	push   0x807010
+  801891:	68 00 70 80 00       	push   $0x807000
+  801896:	ff 75 0c             	push   0xc(%ebp)
+  801899:	e8 4c 12 00 00       	call   802aea <memmove>
+  80189e:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018a7:	89 10                	mov    %edx,(%eax)
+  8018a9:	83 c4 10             	add    $0x10,%esp
+  8018ac:	eb d3                	jmp    801881 <nsipc_accept+0x1f>
+
+008018ae <nsipc_bind>:
+  8018ae:	55                   	push   %ebp
+  8018af:	89 e5                	mov    %esp,%ebp
+  8018b1:	53                   	push   %ebx
+  8018b2:	83 ec 08             	sub    $0x8,%esp
+  8018b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bb:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018c0:	53                   	push   %ebx
+  8018c1:	ff 75 0c             	push   0xc(%ebp)
+  8018c4:	68 04 70 80 00       	push   $0x807004
+  8018c9:	e8 1c 12 00 00       	call   802aea <memmove>
+  8018ce:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018d4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018d9:	e8 3f ff ff ff       	call   80181d <nsipc>
+  8018de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e1:	c9                   	leave
+  8018e2:	c3                   	ret
+
+008018e3 <nsipc_shutdown>:
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	83 ec 08             	sub    $0x8,%esp
+  8018e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ec:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f4:	a3 04 70 80 00       	mov    %eax,0x807004
+  8018f9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018fe:	e8 1a ff ff ff       	call   80181d <nsipc>
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+
+00801905 <nsipc_close>:
+  801905:	55                   	push   %ebp
+  801906:	89 e5                	mov    %esp,%ebp
+  801908:	83 ec 08             	sub    $0x8,%esp
+  80190b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190e:	a3 00 70 80 00       	mov    %eax,0x807000
+  801913:	b8 04 00 00 00       	mov    $0x4,%eax
+  801918:	e8 00 ff ff ff       	call   80181d <nsipc>
+  80191d:	c9                   	leave
+  80191e:	c3                   	ret
+
+0080191f <nsipc_connect>:
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	53                   	push   %ebx
+  801923:	83 ec 08             	sub    $0x8,%esp
+  801926:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801929:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801931:	53                   	push   %ebx
+  801932:	ff 75 0c             	push   0xc(%ebp)
+  801935:	68 04 70 80 00       	push   $0x807004
+  80193a:	e8 ab 11 00 00       	call   802aea <memmove>
+  80193f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801945:	b8 05 00 00 00       	mov    $0x5,%eax
+  80194a:	e8 ce fe ff ff       	call   80181d <nsipc>
+  80194f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801952:	c9                   	leave
+  801953:	c3                   	ret
+
+00801954 <nsipc_listen>:
+  801954:	55                   	push   %ebp
+  801955:	89 e5                	mov    %esp,%ebp
+  801957:	83 ec 08             	sub    $0x8,%esp
+  80195a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195d:	a3 00 70 80 00       	mov    %eax,0x807000
+  801962:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801965:	a3 04 70 80 00       	mov    %eax,0x807004
+  80196a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80196f:	e8 a9 fe ff ff       	call   80181d <nsipc>
+  801974:	c9                   	leave
+  801975:	c3                   	ret
+
+00801976 <nsipc_recv>:
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+  801979:	56                   	push   %esi
+  80197a:	53                   	push   %ebx
+  80197b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80197e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801981:	a3 00 70 80 00       	mov    %eax,0x807000
+  801986:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80198c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198f:	a3 08 70 80 00       	mov    %eax,0x807008
+  801994:	b8 07 00 00 00       	mov    $0x7,%eax
+  801999:	e8 7f fe ff ff       	call   80181d <nsipc>
+  80199e:	89 c3                	mov    %eax,%ebx
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 22                	js     8019c6 <nsipc_recv+0x50>
+  8019a4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019a9:	39 c6                	cmp    %eax,%esi
+  8019ab:	0f 4e c6             	cmovle %esi,%eax
+  8019ae:	39 c3                	cmp    %eax,%ebx
+  8019b0:	7f 1d                	jg     8019cf <nsipc_recv+0x59>
+  8019b2:	83 ec 04             	sub    $0x4,%esp
+  8019b5:	53                   	push   %ebx
+  8019b6:	68 00 70 80 00       	push   $0x807000
+  8019bb:	ff 75 0c             	push   0xc(%ebp)
+  8019be:	e8 27 11 00 00       	call   802aea <memmove>
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	89 d8                	mov    %ebx,%eax
+  8019c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019cb:	5b                   	pop    %ebx
+  8019cc:	5e                   	pop    %esi
+  8019cd:	5d                   	pop    %ebp
+  8019ce:	c3                   	ret
+  8019cf:	68 34 32 80 00       	push   $0x803234
+  8019d4:	68 49 32 80 00       	push   $0x803249
+  8019d9:	6a 60                	push   $0x60
+  8019db:	68 5e 32 80 00       	push   $0x80325e
+  8019e0:	e8 83 07 00 00       	call   802168 <_panic>
+
+008019e5 <nsipc_send>:
+  8019e5:	55                   	push   %ebp
+  8019e6:	89 e5                	mov    %esp,%ebp
+  8019e8:	53                   	push   %ebx
+  8019e9:	83 ec 04             	sub    $0x4,%esp
+  8019ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8019f7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019fd:	7f 2e                	jg     801a2d <nsipc_send+0x48>
+  8019ff:	83 ec 04             	sub    $0x4,%esp
+  801a02:	53                   	push   %ebx
+  801a03:	ff 75 0c             	push   0xc(%ebp)
+  801a06:	68 0c 70 80 00       	push   $0x80700c
+  801a0b:	e8 da 10 00 00       	call   802aea <memmove>
+  801a10:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a16:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a19:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a1e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a23:	e8 f5 fd ff ff       	call   80181d <nsipc>
+  801a28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a2b:	c9                   	leave
+  801a2c:	c3                   	ret
+  801a2d:	68 6a 32 80 00       	push   $0x80326a
+  801a32:	68 49 32 80 00       	push   $0x803249
+  801a37:	6a 6b                	push   $0x6b
+  801a39:	68 5e 32 80 00       	push   $0x80325e
+  801a3e:	e8 25 07 00 00       	call   802168 <_panic>
+
+00801a43 <nsipc_socket>:
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	83 ec 08             	sub    $0x8,%esp
+  801a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a4c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a51:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a54:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a59:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a5c:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a61:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a66:	e8 b2 fd ff ff       	call   80181d <nsipc>
+  801a6b:	c9                   	leave
+  801a6c:	c3                   	ret
+
+00801a6d <devpipe_stat>:
+  801a6d:	55                   	push   %ebp
+  801a6e:	89 e5                	mov    %esp,%ebp
+  801a70:	56                   	push   %esi
+  801a71:	53                   	push   %ebx
+  801a72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a75:	83 ec 0c             	sub    $0xc,%esp
+  801a78:	ff 75 08             	push   0x8(%ebp)
+  801a7b:	e8 99 ef ff ff       	call   800a19 <fd2data>
+  801a80:	89 c6                	mov    %eax,%esi
+  801a82:	83 c4 08             	add    $0x8,%esp
+  801a85:	68 76 32 80 00       	push   $0x803276
+  801a8a:	53                   	push   %ebx
+  801a8b:	e8 aa 0e 00 00       	call   80293a <strcpy>
+  801a90:	8b 46 04             	mov    0x4(%esi),%eax
+  801a93:	2b 06                	sub    (%esi),%eax
+  801a95:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801a9b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801aa2:	00 00 00 
+  801aa5:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801aac:	40 80 00 
+  801aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab7:	5b                   	pop    %ebx
+  801ab8:	5e                   	pop    %esi
+  801ab9:	5d                   	pop    %ebp
+  801aba:	c3                   	ret
+
+00801abb <devpipe_close>:
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	53                   	push   %ebx
+  801abf:	83 ec 0c             	sub    $0xc,%esp
+  801ac2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ac5:	53                   	push   %ebx
+  801ac6:	6a 00                	push   $0x0
+  801ac8:	e8 a0 e7 ff ff       	call   80026d <sys_page_unmap>
+  801acd:	89 1c 24             	mov    %ebx,(%esp)
+  801ad0:	e8 44 ef ff ff       	call   800a19 <fd2data>
+  801ad5:	83 c4 08             	add    $0x8,%esp
+  801ad8:	50                   	push   %eax
+  801ad9:	6a 00                	push   $0x0
+  801adb:	e8 8d e7 ff ff       	call   80026d <sys_page_unmap>
+  801ae0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+
+00801ae5 <_pipeisclosed>:
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	57                   	push   %edi
+  801ae9:	56                   	push   %esi
+  801aea:	53                   	push   %ebx
+  801aeb:	83 ec 1c             	sub    $0x1c,%esp
+  801aee:	89 c7                	mov    %eax,%edi
+  801af0:	89 d6                	mov    %edx,%esi
+  801af2:	a1 10 50 80 00       	mov    0x805010,%eax
+  801af7:	8b 58 58             	mov    0x58(%eax),%ebx
+  801afa:	83 ec 0c             	sub    $0xc,%esp
+  801afd:	57                   	push   %edi
+  801afe:	e8 1c 14 00 00       	call   802f1f <pageref>
+  801b03:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b06:	89 34 24             	mov    %esi,(%esp)
+  801b09:	e8 11 14 00 00       	call   802f1f <pageref>
+  801b0e:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b14:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b17:	83 c4 10             	add    $0x10,%esp
+  801b1a:	39 cb                	cmp    %ecx,%ebx
+  801b1c:	74 1b                	je     801b39 <_pipeisclosed+0x54>
+  801b1e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b21:	75 cf                	jne    801af2 <_pipeisclosed+0xd>
+  801b23:	8b 42 58             	mov    0x58(%edx),%eax
+  801b26:	6a 01                	push   $0x1
+  801b28:	50                   	push   %eax
+  801b29:	53                   	push   %ebx
+  801b2a:	68 7d 32 80 00       	push   $0x80327d
+  801b2f:	e8 0f 07 00 00       	call   802243 <cprintf>
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	eb b9                	jmp    801af2 <_pipeisclosed+0xd>
+  801b39:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b3c:	0f 94 c0             	sete   %al
+  801b3f:	0f b6 c0             	movzbl %al,%eax
+  801b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b45:	5b                   	pop    %ebx
+  801b46:	5e                   	pop    %esi
+  801b47:	5f                   	pop    %edi
+  801b48:	5d                   	pop    %ebp
+  801b49:	c3                   	ret
+
+00801b4a <devpipe_write>:
+  801b4a:	55                   	push   %ebp
+  801b4b:	89 e5                	mov    %esp,%ebp
+  801b4d:	57                   	push   %edi
+  801b4e:	56                   	push   %esi
+  801b4f:	53                   	push   %ebx
+  801b50:	83 ec 28             	sub    $0x28,%esp
+  801b53:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b56:	56                   	push   %esi
+  801b57:	e8 bd ee ff ff       	call   800a19 <fd2data>
+  801b5c:	89 c3                	mov    %eax,%ebx
+  801b5e:	83 c4 10             	add    $0x10,%esp
+  801b61:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b66:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b6a:	74 5c                	je     801bc8 <devpipe_write+0x7e>
+  801b6c:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b6f:	8b 0b                	mov    (%ebx),%ecx
+  801b71:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b74:	39 d0                	cmp    %edx,%eax
+  801b76:	72 1e                	jb     801b96 <devpipe_write+0x4c>
+  801b78:	89 da                	mov    %ebx,%edx
+  801b7a:	89 f0                	mov    %esi,%eax
+  801b7c:	e8 64 ff ff ff       	call   801ae5 <_pipeisclosed>
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	75 48                	jne    801bcd <devpipe_write+0x83>
+  801b85:	e8 c6 e5 ff ff       	call   800150 <sys_yield>
+  801b8a:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b8d:	8b 0b                	mov    (%ebx),%ecx
+  801b8f:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b92:	39 d0                	cmp    %edx,%eax
+  801b94:	73 e2                	jae    801b78 <devpipe_write+0x2e>
+  801b96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b99:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b9d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801ba0:	89 c2                	mov    %eax,%edx
+  801ba2:	c1 fa 1f             	sar    $0x1f,%edx
+  801ba5:	89 d1                	mov    %edx,%ecx
+  801ba7:	c1 e9 1b             	shr    $0x1b,%ecx
+  801baa:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bad:	83 e2 1f             	and    $0x1f,%edx
+  801bb0:	29 ca                	sub    %ecx,%edx
+  801bb2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bb6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bba:	83 c0 01             	add    $0x1,%eax
+  801bbd:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bc0:	83 c7 01             	add    $0x1,%edi
+  801bc3:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bc6:	75 a4                	jne    801b6c <devpipe_write+0x22>
+  801bc8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bcb:	eb 05                	jmp    801bd2 <devpipe_write+0x88>
+  801bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd5:	5b                   	pop    %ebx
+  801bd6:	5e                   	pop    %esi
+  801bd7:	5f                   	pop    %edi
+  801bd8:	5d                   	pop    %ebp
+  801bd9:	c3                   	ret
+
+00801bda <devpipe_read>:
+  801bda:	55                   	push   %ebp
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	57                   	push   %edi
+  801bde:	56                   	push   %esi
+  801bdf:	53                   	push   %ebx
+  801be0:	83 ec 18             	sub    $0x18,%esp
+  801be3:	8b 75 08             	mov    0x8(%ebp),%esi
+  801be6:	56                   	push   %esi
+  801be7:	e8 2d ee ff ff       	call   800a19 <fd2data>
+  801bec:	89 c3                	mov    %eax,%ebx
+  801bee:	83 c4 10             	add    $0x10,%esp
+  801bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801bfa:	74 45                	je     801c41 <devpipe_read+0x67>
+  801bfc:	8b 03                	mov    (%ebx),%eax
+  801bfe:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c01:	75 1d                	jne    801c20 <devpipe_read+0x46>
+  801c03:	85 ff                	test   %edi,%edi
+  801c05:	75 3f                	jne    801c46 <devpipe_read+0x6c>
+  801c07:	89 da                	mov    %ebx,%edx
+  801c09:	89 f0                	mov    %esi,%eax
+  801c0b:	e8 d5 fe ff ff       	call   801ae5 <_pipeisclosed>
+  801c10:	85 c0                	test   %eax,%eax
+  801c12:	75 3c                	jne    801c50 <devpipe_read+0x76>
+  801c14:	e8 37 e5 ff ff       	call   800150 <sys_yield>
+  801c19:	8b 03                	mov    (%ebx),%eax
+  801c1b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c1e:	74 e7                	je     801c07 <devpipe_read+0x2d>
+  801c20:	99                   	cltd
+  801c21:	c1 ea 1b             	shr    $0x1b,%edx
+  801c24:	01 d0                	add    %edx,%eax
+  801c26:	83 e0 1f             	and    $0x1f,%eax
+  801c29:	29 d0                	sub    %edx,%eax
+  801c2b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c33:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c36:	83 03 01             	addl   $0x1,(%ebx)
+  801c39:	83 c7 01             	add    $0x1,%edi
+  801c3c:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c3f:	75 bb                	jne    801bfc <devpipe_read+0x22>
+  801c41:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c44:	eb 02                	jmp    801c48 <devpipe_read+0x6e>
+  801c46:	89 f8                	mov    %edi,%eax
+  801c48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c4b:	5b                   	pop    %ebx
+  801c4c:	5e                   	pop    %esi
+  801c4d:	5f                   	pop    %edi
+  801c4e:	5d                   	pop    %ebp
+  801c4f:	c3                   	ret
+  801c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c55:	eb f1                	jmp    801c48 <devpipe_read+0x6e>
+
+00801c57 <pipe>:
+  801c57:	55                   	push   %ebp
+  801c58:	89 e5                	mov    %esp,%ebp
+  801c5a:	56                   	push   %esi
+  801c5b:	53                   	push   %ebx
+  801c5c:	83 ec 1c             	sub    $0x1c,%esp
+  801c5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c62:	50                   	push   %eax
+  801c63:	e8 c8 ed ff ff       	call   800a30 <fd_alloc>
+  801c68:	89 c3                	mov    %eax,%ebx
+  801c6a:	83 c4 10             	add    $0x10,%esp
+  801c6d:	85 c0                	test   %eax,%eax
+  801c6f:	0f 88 23 01 00 00    	js     801d98 <pipe+0x141>
+  801c75:	83 ec 04             	sub    $0x4,%esp
+  801c78:	68 07 04 00 00       	push   $0x407
+  801c7d:	ff 75 f4             	push   -0xc(%ebp)
+  801c80:	6a 00                	push   $0x0
+  801c82:	e8 14 e5 ff ff       	call   80019b <sys_page_alloc>
+  801c87:	89 c3                	mov    %eax,%ebx
+  801c89:	83 c4 10             	add    $0x10,%esp
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	0f 88 04 01 00 00    	js     801d98 <pipe+0x141>
+  801c94:	83 ec 0c             	sub    $0xc,%esp
+  801c97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c9a:	50                   	push   %eax
+  801c9b:	e8 90 ed ff ff       	call   800a30 <fd_alloc>
+  801ca0:	89 c3                	mov    %eax,%ebx
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	0f 88 db 00 00 00    	js     801d88 <pipe+0x131>
+  801cad:	83 ec 04             	sub    $0x4,%esp
+  801cb0:	68 07 04 00 00       	push   $0x407
+  801cb5:	ff 75 f0             	push   -0x10(%ebp)
+  801cb8:	6a 00                	push   $0x0
+  801cba:	e8 dc e4 ff ff       	call   80019b <sys_page_alloc>
+  801cbf:	89 c3                	mov    %eax,%ebx
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	0f 88 bc 00 00 00    	js     801d88 <pipe+0x131>
+  801ccc:	83 ec 0c             	sub    $0xc,%esp
+  801ccf:	ff 75 f4             	push   -0xc(%ebp)
+  801cd2:	e8 42 ed ff ff       	call   800a19 <fd2data>
+  801cd7:	89 c6                	mov    %eax,%esi
+  801cd9:	83 c4 0c             	add    $0xc,%esp
+  801cdc:	68 07 04 00 00       	push   $0x407
+  801ce1:	50                   	push   %eax
+  801ce2:	6a 00                	push   $0x0
+  801ce4:	e8 b2 e4 ff ff       	call   80019b <sys_page_alloc>
+  801ce9:	89 c3                	mov    %eax,%ebx
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	0f 88 82 00 00 00    	js     801d78 <pipe+0x121>
+  801cf6:	83 ec 0c             	sub    $0xc,%esp
+  801cf9:	ff 75 f0             	push   -0x10(%ebp)
+  801cfc:	e8 18 ed ff ff       	call   800a19 <fd2data>
+  801d01:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d08:	50                   	push   %eax
+  801d09:	6a 00                	push   $0x0
+  801d0b:	56                   	push   %esi
+  801d0c:	6a 00                	push   $0x0
+  801d0e:	e8 cb e4 ff ff       	call   8001de <sys_page_map>
+  801d13:	89 c3                	mov    %eax,%ebx
+  801d15:	83 c4 20             	add    $0x20,%esp
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	78 4e                	js     801d6a <pipe+0x113>
+  801d1c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d21:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d24:	89 02                	mov    %eax,(%edx)
+  801d26:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d29:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d30:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d33:	89 02                	mov    %eax,(%edx)
+  801d35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d38:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d3f:	83 ec 0c             	sub    $0xc,%esp
+  801d42:	ff 75 f4             	push   -0xc(%ebp)
+  801d45:	e8 bf ec ff ff       	call   800a09 <fd2num>
+  801d4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d4d:	89 01                	mov    %eax,(%ecx)
+  801d4f:	83 c4 04             	add    $0x4,%esp
+  801d52:	ff 75 f0             	push   -0x10(%ebp)
+  801d55:	e8 af ec ff ff       	call   800a09 <fd2num>
+  801d5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d5d:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d60:	83 c4 10             	add    $0x10,%esp
+  801d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d68:	eb 2e                	jmp    801d98 <pipe+0x141>
+  801d6a:	83 ec 08             	sub    $0x8,%esp
+  801d6d:	56                   	push   %esi
+  801d6e:	6a 00                	push   $0x0
+  801d70:	e8 f8 e4 ff ff       	call   80026d <sys_page_unmap>
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	83 ec 08             	sub    $0x8,%esp
+  801d7b:	ff 75 f0             	push   -0x10(%ebp)
+  801d7e:	6a 00                	push   $0x0
+  801d80:	e8 e8 e4 ff ff       	call   80026d <sys_page_unmap>
+  801d85:	83 c4 10             	add    $0x10,%esp
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	ff 75 f4             	push   -0xc(%ebp)
+  801d8e:	6a 00                	push   $0x0
+  801d90:	e8 d8 e4 ff ff       	call   80026d <sys_page_unmap>
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	89 d8                	mov    %ebx,%eax
+  801d9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9d:	5b                   	pop    %ebx
+  801d9e:	5e                   	pop    %esi
+  801d9f:	5d                   	pop    %ebp
+  801da0:	c3                   	ret
+
+00801da1 <pipeisclosed>:
+  801da1:	55                   	push   %ebp
+  801da2:	89 e5                	mov    %esp,%ebp
+  801da4:	83 ec 20             	sub    $0x20,%esp
+  801da7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801daa:	50                   	push   %eax
+  801dab:	ff 75 08             	push   0x8(%ebp)
+  801dae:	e8 cd ec ff ff       	call   800a80 <fd_lookup>
+  801db3:	83 c4 10             	add    $0x10,%esp
+  801db6:	85 c0                	test   %eax,%eax
+  801db8:	78 18                	js     801dd2 <pipeisclosed+0x31>
+  801dba:	83 ec 0c             	sub    $0xc,%esp
+  801dbd:	ff 75 f4             	push   -0xc(%ebp)
+  801dc0:	e8 54 ec ff ff       	call   800a19 <fd2data>
+  801dc5:	89 c2                	mov    %eax,%edx
+  801dc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dca:	e8 16 fd ff ff       	call   801ae5 <_pipeisclosed>
+  801dcf:	83 c4 10             	add    $0x10,%esp
+  801dd2:	c9                   	leave
+  801dd3:	c3                   	ret
+
+00801dd4 <ipcring_init>:
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	53                   	push   %ebx
+  801dd8:	83 ec 08             	sub    $0x8,%esp
+  801ddb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dde:	6a 60                	push   $0x60
+  801de0:	6a 00                	push   $0x0
+  801de2:	53                   	push   %ebx
+  801de3:	e8 cd 0c 00 00       	call   802ab5 <memset>
+  801de8:	a1 10 50 80 00       	mov    0x805010,%eax
+  801ded:	8b 40 48             	mov    0x48(%eax),%eax
+  801df0:	89 03                	mov    %eax,(%ebx)
+  801df2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801df5:	89 43 04             	mov    %eax,0x4(%ebx)
+  801df8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801dfb:	89 43 08             	mov    %eax,0x8(%ebx)
+  801dfe:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e01:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e04:	83 c4 10             	add    $0x10,%esp
+  801e07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0a:	c9                   	leave
+  801e0b:	c3                   	ret
+
+00801e0c <ipcring_req_slot>:
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e12:	8b 50 10             	mov    0x10(%eax),%edx
+  801e15:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e18:	29 ca                	sub    %ecx,%edx
+  801e1a:	83 fa 07             	cmp    $0x7,%edx
+  801e1d:	77 0c                	ja     801e2b <ipcring_req_slot+0x1f>
+  801e1f:	8b 50 10             	mov    0x10(%eax),%edx
+  801e22:	83 e2 07             	and    $0x7,%edx
+  801e25:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e29:	5d                   	pop    %ebp
+  801e2a:	c3                   	ret
+  801e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e30:	eb f7                	jmp    801e29 <ipcring_req_slot+0x1d>
+
+00801e32 <ipcring_req_push>:
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	83 ec 08             	sub    $0x8,%esp
+  801e38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e3b:	8b 42 10             	mov    0x10(%edx),%eax
+  801e3e:	83 c0 01             	add    $0x1,%eax
+  801e41:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4a:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	75 02                	jne    801e54 <ipcring_req_push+0x22>
+  801e52:	c9                   	leave
+  801e53:	c3                   	ret
+  801e54:	6a 00                	push   $0x0
+  801e56:	68 00 00 80 ee       	push   $0xee800000
+  801e5b:	ff 72 08             	push   0x8(%edx)
+  801e5e:	ff 72 04             	push   0x4(%edx)
+  801e61:	e8 6d e6 ff ff       	call   8004d3 <sys_ipc_send>
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	eb e7                	jmp    801e52 <ipcring_req_push+0x20>
+
+00801e6b <ipcring_rsp_wait>:
+  801e6b:	55                   	push   %ebp
+  801e6c:	89 e5                	mov    %esp,%ebp
+  801e6e:	53                   	push   %ebx
+  801e6f:	83 ec 04             	sub    $0x4,%esp
+  801e72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e75:	8b 53 18             	mov    0x18(%ebx),%edx
+  801e78:	8b 43 10             	mov    0x10(%ebx),%eax
+  801e7b:	39 c2                	cmp    %eax,%edx
+  801e7d:	74 3c                	je     801ebb <ipcring_rsp_wait+0x50>
+  801e7f:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e82:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e85:	39 c2                	cmp    %eax,%edx
+  801e87:	75 23                	jne    801eac <ipcring_rsp_wait+0x41>
+  801e89:	83 ec 08             	sub    $0x8,%esp
+  801e8c:	6a 00                	push   $0x0
+  801e8e:	6a 00                	push   $0x0
+  801e90:	6a 00                	push   $0x0
+  801e92:	6a 00                	push   $0x0
+  801e94:	ff 73 0c             	push   0xc(%ebx)
+  801e97:	ff 73 04             	push   0x4(%ebx)
+  801e9a:	e8 cb 0e 00 00       	call   802d6a <ipc_call>
+  801e9f:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ea2:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ea5:	83 c4 20             	add    $0x20,%esp
+  801ea8:	39 c2                	cmp    %eax,%edx
+  801eaa:	74 dd                	je     801e89 <ipcring_rsp_wait+0x1e>
+  801eac:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eaf:	83 e0 07             	and    $0x7,%eax
+  801eb2:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801eb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb9:	c9                   	leave
+  801eba:	c3                   	ret
+  801ebb:	68 98 32 80 00       	push   $0x803298
+  801ec0:	68 49 32 80 00       	push   $0x803249
+  801ec5:	6a 3b                	push   $0x3b
+  801ec7:	68 b9 32 80 00       	push   $0x8032b9
+  801ecc:	e8 97 02 00 00       	call   802168 <_panic>
+
+00801ed1 <ipcring_rsp_pop>:
+  801ed1:	55                   	push   %ebp
+  801ed2:	89 e5                	mov    %esp,%ebp
+  801ed4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ed7:	8b 42 18             	mov    0x18(%edx),%eax
+  801eda:	83 c0 01             	add    $0x1,%eax
+  801edd:	89 42 18             	mov    %eax,0x18(%edx)
+  801ee0:	5d                   	pop    %ebp
+  801ee1:	c3                   	ret
+
+00801ee2 <ipcring_server_init>:
+  801ee2:	55                   	push   %ebp
+  801ee3:	89 e5                	mov    %esp,%ebp
+  801ee5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eeb:	89 10                	mov    %edx,(%eax)
+  801eed:	8b 55 10             	mov    0x10(%ebp),%edx
+  801ef0:	89 50 04             	mov    %edx,0x4(%eax)
+  801ef3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801efa:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f01:	5d                   	pop    %ebp
+  801f02:	c3                   	ret
+
+00801f03 <ipcring_req_avail>:
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f09:	8b 02                	mov    (%edx),%eax
+  801f0b:	8b 40 10             	mov    0x10(%eax),%eax
+  801f0e:	2b 42 08             	sub    0x8(%edx),%eax
+  801f11:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f16:	39 d0                	cmp    %edx,%eax
+  801f18:	0f 47 c2             	cmova  %edx,%eax
+  801f1b:	5d                   	pop    %ebp
+  801f1c:	c3                   	ret
+
+00801f1d <ipcring_req_peek>:
+  801f1d:	55                   	push   %ebp
+  801f1e:	89 e5                	mov    %esp,%ebp
+  801f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f23:	8b 42 08             	mov    0x8(%edx),%eax
+  801f26:	83 e0 07             	and    $0x7,%eax
+  801f29:	8b 12                	mov    (%edx),%edx
+  801f2b:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f2f:	5d                   	pop    %ebp
+  801f30:	c3                   	ret
+
+00801f31 <ipcring_rsp_push>:
+  801f31:	55                   	push   %ebp
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	83 ec 08             	sub    $0x8,%esp
+  801f37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f3a:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f3d:	83 c0 01             	add    $0x1,%eax
+  801f40:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f43:	8b 11                	mov    (%ecx),%edx
+  801f45:	83 c2 14             	add    $0x14,%edx
+  801f48:	f0 87 02             	lock xchg %eax,(%edx)
+  801f4b:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f4f:	75 02                	jne    801f53 <ipcring_rsp_push+0x22>
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+  801f53:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	68 00 00 80 ee       	push   $0xee800000
+  801f61:	6a 00                	push   $0x0
+  801f63:	ff 71 04             	push   0x4(%ecx)
+  801f66:	e8 8b e4 ff ff       	call   8003f6 <sys_ipc_try_send>
+  801f6b:	83 c4 10             	add    $0x10,%esp
+  801f6e:	eb e1                	jmp    801f51 <ipcring_rsp_push+0x20>
+
+00801f70 <ipcring_client_wait>:
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	83 ec 08             	sub    $0x8,%esp
+  801f76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f79:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801f80:	8b 10                	mov    (%eax),%edx
+  801f82:	8b 52 18             	mov    0x18(%edx),%edx
+  801f85:	3b 50 08             	cmp    0x8(%eax),%edx
+  801f88:	75 02                	jne    801f8c <ipcring_client_wait+0x1c>
+  801f8a:	c9                   	leave
+  801f8b:	c3                   	ret
+  801f8c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f93:	6a 00                	push   $0x0
+  801f95:	68 00 00 80 ee       	push   $0xee800000
+  801f9a:	6a 00                	push   $0x0
+  801f9c:	ff 70 04             	push   0x4(%eax)
+  801f9f:	e8 52 e4 ff ff       	call   8003f6 <sys_ipc_try_send>
+  801fa4:	83 c4 10             	add    $0x10,%esp
+  801fa7:	eb e1                	jmp    801f8a <ipcring_client_wait+0x1a>
+
+00801fa9 <ipcring_server_sleep>:
+  801fa9:	55                   	push   %ebp
+  801faa:	89 e5                	mov    %esp,%ebp
+  801fac:	53                   	push   %ebx
+  801fad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fb0:	8b 01                	mov    (%ecx),%eax
+  801fb2:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fba:	f0 87 02             	lock xchg %eax,(%edx)
+  801fbd:	8b 11                	mov    (%ecx),%edx
+  801fbf:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fc7:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801fca:	74 0e                	je     801fda <ipcring_server_sleep+0x31>
+  801fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd1:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fdd:	c9                   	leave
+  801fde:	c3                   	ret
+
+00801fdf <devcons_close>:
+  801fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe4:	c3                   	ret
+
+00801fe5 <devcons_stat>:
+  801fe5:	55                   	push   %ebp
+  801fe6:	89 e5                	mov    %esp,%ebp
+  801fe8:	83 ec 10             	sub    $0x10,%esp
+  801feb:	68 c7 32 80 00       	push   $0x8032c7
+  801ff0:	ff 75 0c             	push   0xc(%ebp)
+  801ff3:	e8 42 09 00 00       	call   80293a <strcpy>
+  801ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffd:	c9                   	leave
+  801ffe:	c3                   	ret
+
+00801fff <devcons_write>:
+  801fff:	55                   	push   %ebp
+  802000:	89 e5                	mov    %esp,%ebp
+  802002:	57                   	push   %edi
+  802003:	56                   	push   %esi
+  802004:	53                   	push   %ebx
+  802005:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80200b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80200e:	85 ff                	test   %edi,%edi
+  802010:	74 51                	je     802063 <devcons_write+0x64>
+  802012:	be 00 00 00 00       	mov    $0x0,%esi
+  802017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201c:	89 fb                	mov    %edi,%ebx
+  80201e:	29 c3                	sub    %eax,%ebx
+  802020:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802025:	39 d3                	cmp    %edx,%ebx
+  802027:	0f 47 da             	cmova  %edx,%ebx
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	53                   	push   %ebx
+  80202e:	03 45 0c             	add    0xc(%ebp),%eax
+  802031:	50                   	push   %eax
+  802032:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802038:	50                   	push   %eax
+  802039:	e8 ac 0a 00 00       	call   802aea <memmove>
+  80203e:	83 c4 08             	add    $0x8,%esp
+  802041:	53                   	push   %ebx
+  802042:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802048:	50                   	push   %eax
+  802049:	e8 65 e0 ff ff       	call   8000b3 <sys_cputs>
+  80204e:	01 de                	add    %ebx,%esi
+  802050:	89 f0                	mov    %esi,%eax
+  802052:	83 c4 10             	add    $0x10,%esp
+  802055:	39 fe                	cmp    %edi,%esi
+  802057:	72 c3                	jb     80201c <devcons_write+0x1d>
+  802059:	89 f0                	mov    %esi,%eax
+  80205b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205e:	5b                   	pop    %ebx
+  80205f:	5e                   	pop    %esi
+  802060:	5f                   	pop    %edi
+  802061:	5d                   	pop    %ebp
+  802062:	c3                   	ret
+  802063:	be 00 00 00 00       	mov    $0x0,%esi
+  802068:	eb ef                	jmp    802059 <devcons_write+0x5a>
+
+0080206a <devcons_read>:
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	83 ec 08             	sub    $0x8,%esp
+  802070:	b8 00 00 00 00       	mov    $0x0,%eax
+  802075:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802079:	75 07                	jne    802082 <devcons_read+0x18>
+  80207b:	eb 1f                	jmp    80209c <devcons_read+0x32>
+  80207d:	e8 ce e0 ff ff       	call   800150 <sys_yield>
+  802082:	e8 4a e0 ff ff       	call   8000d1 <sys_cgetc>
+  802087:	85 c0                	test   %eax,%eax
+  802089:	74 f2                	je     80207d <devcons_read+0x13>
+  80208b:	78 0f                	js     80209c <devcons_read+0x32>
+  80208d:	83 f8 04             	cmp    $0x4,%eax
+  802090:	74 0c                	je     80209e <devcons_read+0x34>
+  802092:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802095:	88 02                	mov    %al,(%edx)
+  802097:	b8 01 00 00 00       	mov    $0x1,%eax
+  80209c:	c9                   	leave
+  80209d:	c3                   	ret
+  80209e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a3:	eb f7                	jmp    80209c <devcons_read+0x32>
+
+008020a5 <cputchar>:
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	83 ec 20             	sub    $0x20,%esp
+  8020ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ae:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020b1:	6a 01                	push   $0x1
+  8020b3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020b6:	50                   	push   %eax
+  8020b7:	e8 f7 df ff ff       	call   8000b3 <sys_cputs>
+  8020bc:	83 c4 10             	add    $0x10,%esp
+  8020bf:	c9                   	leave
+  8020c0:	c3                   	ret
+
+008020c1 <getchar>:
+  8020c1:	55                   	push   %ebp
+  8020c2:	89 e5                	mov    %esp,%ebp
+  8020c4:	83 ec 1c             	sub    $0x1c,%esp
+  8020c7:	6a 01                	push   $0x1
+  8020c9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020cc:	50                   	push   %eax
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	e8 0e ec ff ff       	call   800ce2 <read>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	78 06                	js     8020e1 <getchar+0x20>
+  8020db:	74 06                	je     8020e3 <getchar+0x22>
+  8020dd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8020e1:	c9                   	leave
+  8020e2:	c3                   	ret
+  8020e3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020e8:	eb f7                	jmp    8020e1 <getchar+0x20>
+
+008020ea <iscons>:
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	83 ec 20             	sub    $0x20,%esp
+  8020f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f3:	50                   	push   %eax
+  8020f4:	ff 75 08             	push   0x8(%ebp)
+  8020f7:	e8 84 e9 ff ff       	call   800a80 <fd_lookup>
+  8020fc:	83 c4 10             	add    $0x10,%esp
+  8020ff:	85 c0                	test   %eax,%eax
+  802101:	78 11                	js     802114 <iscons+0x2a>
+  802103:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802106:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80210c:	39 10                	cmp    %edx,(%eax)
+  80210e:	0f 94 c0             	sete   %al
+  802111:	0f b6 c0             	movzbl %al,%eax
+  802114:	c9                   	leave
+  802115:	c3                   	ret
+
+00802116 <opencons>:
+  802116:	55                   	push   %ebp
+  802117:	89 e5                	mov    %esp,%ebp
+  802119:	83 ec 24             	sub    $0x24,%esp
+  80211c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80211f:	50                   	push   %eax
+  802120:	e8 0b e9 ff ff       	call   800a30 <fd_alloc>
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 3a                	js     802166 <opencons+0x50>
+  80212c:	83 ec 04             	sub    $0x4,%esp
+  80212f:	68 07 04 00 00       	push   $0x407
+  802134:	ff 75 f4             	push   -0xc(%ebp)
+  802137:	6a 00                	push   $0x0
+  802139:	e8 5d e0 ff ff       	call   80019b <sys_page_alloc>
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 21                	js     802166 <opencons+0x50>
+  802145:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802148:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80214e:	89 10                	mov    %edx,(%eax)
+  802150:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802153:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80215a:	83 ec 0c             	sub    $0xc,%esp
+  80215d:	50                   	push   %eax
+  80215e:	e8 a6 e8 ff ff       	call   800a09 <fd2num>
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	c9                   	leave
+  802167:	c3                   	ret
+
+00802168 <_panic>:
+  802168:	55                   	push   %ebp
+  802169:	89 e5                	mov    %esp,%ebp
+  80216b:	56                   	push   %esi
+  80216c:	53                   	push   %ebx
+  80216d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802170:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802176:	e8 b6 df ff ff       	call   800131 <sys_getenvid>
+  80217b:	83 ec 0c             	sub    $0xc,%esp
+  80217e:	ff 75 0c             	push   0xc(%ebp)
+  802181:	ff 75 08             	push   0x8(%ebp)
+  802184:	56                   	push   %esi
+  802185:	50                   	push   %eax
+  802186:	68 d4 32 80 00       	push   $0x8032d4
+  80218b:	e8 b3 00 00 00       	call   802243 <cprintf>
+  802190:	83 c4 18             	add    $0x18,%esp
+  802193:	53                   	push   %ebx
+  802194:	ff 75 10             	push   0x10(%ebp)
+  802197:	e8 56 00 00 00       	call   8021f2 <vcprintf>
+  80219c:	c7 04 24 8e 32 80 00 	movl   $0x80328e,(%esp)
+  8021a3:	e8 9b 00 00 00       	call   802243 <cprintf>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	cc                   	int3
+  8021ac:	eb fd                	jmp    8021ab <_panic+0x43>
+
+008021ae <putch>:
+  8021ae:	55                   	push   %ebp
+  8021af:	89 e5                	mov    %esp,%ebp
+  8021b1:	53                   	push   %ebx
+  8021b2:	83 ec 04             	sub    $0x4,%esp
+  8021b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021b8:	8b 13                	mov    (%ebx),%edx
+  8021ba:	8d 42 01             	lea    0x1(%edx),%eax
+  8021bd:	89 03                	mov    %eax,(%ebx)
+  8021bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021c2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021c6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021cb:	74 09                	je     8021d6 <putch+0x28>
+  8021cd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021d4:	c9                   	leave
+  8021d5:	c3                   	ret
+  8021d6:	83 ec 08             	sub    $0x8,%esp
+  8021d9:	68 ff 00 00 00       	push   $0xff
+  8021de:	8d 43 08             	lea    0x8(%ebx),%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	e8 cc de ff ff       	call   8000b3 <sys_cputs>
+  8021e7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8021ed:	83 c4 10             	add    $0x10,%esp
+  8021f0:	eb db                	jmp    8021cd <putch+0x1f>
+
+008021f2 <vcprintf>:
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8021fb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802202:	00 00 00 
+  802205:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80220c:	00 00 00 
+  80220f:	ff 75 0c             	push   0xc(%ebp)
+  802212:	ff 75 08             	push   0x8(%ebp)
+  802215:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80221b:	50                   	push   %eax
+  80221c:	68 ae 21 80 00       	push   $0x8021ae
+  802221:	e8 1c 01 00 00       	call   802342 <vprintfmt>
+  802226:	83 c4 08             	add    $0x8,%esp
+  802229:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80222f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802235:	50                   	push   %eax
+  802236:	e8 78 de ff ff       	call   8000b3 <sys_cputs>
+  80223b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802241:	c9                   	leave
+  802242:	c3                   	ret
+
+00802243 <cprintf>:
+  802243:	55                   	push   %ebp
+  802244:	89 e5                	mov    %esp,%ebp
+  802246:	83 ec 10             	sub    $0x10,%esp
+  802249:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80224c:	50                   	push   %eax
+  80224d:	ff 75 08             	push   0x8(%ebp)
+  802250:	e8 9d ff ff ff       	call   8021f2 <vcprintf>
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+
+00802257 <printnum>:
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	57                   	push   %edi
+  80225b:	56                   	push   %esi
+  80225c:	53                   	push   %ebx
+  80225d:	83 ec 1c             	sub    $0x1c,%esp
+  802260:	89 c3                	mov    %eax,%ebx
+  802262:	89 d6                	mov    %edx,%esi
+  802264:	8b 45 08             	mov    0x8(%ebp),%eax
+  802267:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80226a:	89 d1                	mov    %edx,%ecx
+  80226c:	89 c2                	mov    %eax,%edx
+  80226e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802271:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802274:	8b 45 10             	mov    0x10(%ebp),%eax
+  802277:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80227a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802281:	39 c2                	cmp    %eax,%edx
+  802283:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802286:	73 4b                	jae    8022d3 <printnum+0x7c>
+  802288:	8b 45 14             	mov    0x14(%ebp),%eax
+  80228b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80228e:	85 ff                	test   %edi,%edi
+  802290:	7e 11                	jle    8022a3 <printnum+0x4c>
+  802292:	83 ec 08             	sub    $0x8,%esp
+  802295:	56                   	push   %esi
+  802296:	ff 75 18             	push   0x18(%ebp)
+  802299:	ff d3                	call   *%ebx
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	83 ef 01             	sub    $0x1,%edi
+  8022a1:	75 ef                	jne    802292 <printnum+0x3b>
+  8022a3:	83 ec 08             	sub    $0x8,%esp
+  8022a6:	56                   	push   %esi
+  8022a7:	83 ec 04             	sub    $0x4,%esp
+  8022aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8022ad:	ff 75 e0             	push   -0x20(%ebp)
+  8022b0:	ff 75 dc             	push   -0x24(%ebp)
+  8022b3:	ff 75 d8             	push   -0x28(%ebp)
+  8022b6:	e8 9b 0d 00 00       	call   803056 <__umoddi3>
+  8022bb:	83 c4 14             	add    $0x14,%esp
+  8022be:	0f be 80 f7 32 80 00 	movsbl 0x8032f7(%eax),%eax
+  8022c5:	50                   	push   %eax
+  8022c6:	ff d3                	call   *%ebx
+  8022c8:	83 c4 10             	add    $0x10,%esp
+  8022cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ce:	5b                   	pop    %ebx
+  8022cf:	5e                   	pop    %esi
+  8022d0:	5f                   	pop    %edi
+  8022d1:	5d                   	pop    %ebp
+  8022d2:	c3                   	ret
+  8022d3:	83 ec 0c             	sub    $0xc,%esp
+  8022d6:	ff 75 18             	push   0x18(%ebp)
+  8022d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022dc:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8022df:	52                   	push   %edx
+  8022e0:	50                   	push   %eax
+  8022e1:	83 ec 08             	sub    $0x8,%esp
+  8022e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8022e7:	ff 75 e0             	push   -0x20(%ebp)
+  8022ea:	ff 75 dc             	push   -0x24(%ebp)
+  8022ed:	ff 75 d8             	push   -0x28(%ebp)
+  8022f0:	e8 43 0d 00 00       	call   803038 <__udivdi3>
+  8022f5:	83 c4 18             	add    $0x18,%esp
+  8022f8:	52                   	push   %edx
+  8022f9:	50                   	push   %eax
+  8022fa:	89 f2                	mov    %esi,%edx
+  8022fc:	89 d8                	mov    %ebx,%eax
+  8022fe:	e8 54 ff ff ff       	call   802257 <printnum>
+  802303:	83 c4 20             	add    $0x20,%esp
+  802306:	eb 9b                	jmp    8022a3 <printnum+0x4c>
+
+00802308 <sprintputch>:
+  802308:	55                   	push   %ebp
+  802309:	89 e5                	mov    %esp,%ebp
+  80230b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80230e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802312:	8b 10                	mov    (%eax),%edx
+  802314:	3b 50 04             	cmp    0x4(%eax),%edx
+  802317:	73 0a                	jae    802323 <sprintputch+0x1b>
+  802319:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80231c:	89 08                	mov    %ecx,(%eax)
+  80231e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802321:	88 02                	mov    %al,(%edx)
+  802323:	5d                   	pop    %ebp
+  802324:	c3                   	ret
+
+00802325 <printfmt>:
+  802325:	55                   	push   %ebp
+  802326:	89 e5                	mov    %esp,%ebp
+  802328:	83 ec 08             	sub    $0x8,%esp
+  80232b:	8d 45 14             	lea    0x14(%ebp),%eax
+  80232e:	50                   	push   %eax
+  80232f:	ff 75 10             	push   0x10(%ebp)
+  802332:	ff 75 0c             	push   0xc(%ebp)
+  802335:	ff 75 08             	push   0x8(%ebp)
+  802338:	e8 05 00 00 00       	call   802342 <vprintfmt>
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	c9                   	leave
+  802341:	c3                   	ret
+
+00802342 <vprintfmt>:
+  802342:	55                   	push   %ebp
+  802343:	89 e5                	mov    %esp,%ebp
+  802345:	57                   	push   %edi
+  802346:	56                   	push   %esi
+  802347:	53                   	push   %ebx
+  802348:	83 ec 2c             	sub    $0x2c,%esp
+  80234b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80234e:	89 df                	mov    %ebx,%edi
+  802350:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802353:	8b 45 10             	mov    0x10(%ebp),%eax
+  802356:	8d 70 01             	lea    0x1(%eax),%esi
+  802359:	0f b6 00             	movzbl (%eax),%eax
+  80235c:	83 f8 25             	cmp    $0x25,%eax
+  80235f:	74 1e                	je     80237f <vprintfmt+0x3d>
+  802361:	85 c0                	test   %eax,%eax
+  802363:	0f 84 15 05 00 00    	je     80287e <vprintfmt+0x53c>
+  802369:	83 ec 08             	sub    $0x8,%esp
+  80236c:	53                   	push   %ebx
+  80236d:	50                   	push   %eax
+  80236e:	ff d7                	call   *%edi
+  802370:	83 c6 01             	add    $0x1,%esi
+  802373:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802377:	83 c4 10             	add    $0x10,%esp
+  80237a:	83 f8 25             	cmp    $0x25,%eax
+  80237d:	75 e2                	jne    802361 <vprintfmt+0x1f>
+  80237f:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  802383:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80238a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802391:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802398:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80239d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8023a0:	8d 56 01             	lea    0x1(%esi),%edx
+  8023a3:	0f b6 0e             	movzbl (%esi),%ecx
+  8023a6:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023a9:	3c 55                	cmp    $0x55,%al
+  8023ab:	0f 87 3b 04 00 00    	ja     8027ec <vprintfmt+0x4aa>
+  8023b1:	0f b6 c0             	movzbl %al,%eax
+  8023b4:	ff 24 85 40 34 80 00 	jmp    *0x803440(,%eax,4)
+  8023bb:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023be:	eb 93                	jmp    802353 <vprintfmt+0x11>
+  8023c0:	89 d6                	mov    %edx,%esi
+  8023c2:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023c6:	eb d8                	jmp    8023a0 <vprintfmt+0x5e>
+  8023c8:	89 d6                	mov    %edx,%esi
+  8023ca:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023ce:	eb d0                	jmp    8023a0 <vprintfmt+0x5e>
+  8023d0:	0f b6 c9             	movzbl %cl,%ecx
+  8023d3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8023d6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023d9:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8023dd:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8023e0:	83 f9 09             	cmp    $0x9,%ecx
+  8023e3:	77 6f                	ja     802454 <vprintfmt+0x112>
+  8023e5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8023e8:	83 c2 01             	add    $0x1,%edx
+  8023eb:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8023ee:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8023f2:	0f be 02             	movsbl (%edx),%eax
+  8023f5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8023f8:	83 fe 09             	cmp    $0x9,%esi
+  8023fb:	76 eb                	jbe    8023e8 <vprintfmt+0xa6>
+  8023fd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802400:	89 d6                	mov    %edx,%esi
+  802402:	eb 13                	jmp    802417 <vprintfmt+0xd5>
+  802404:	8b 45 14             	mov    0x14(%ebp),%eax
+  802407:	8b 00                	mov    (%eax),%eax
+  802409:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80240c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80240f:	8d 40 04             	lea    0x4(%eax),%eax
+  802412:	89 45 14             	mov    %eax,0x14(%ebp)
+  802415:	89 d6                	mov    %edx,%esi
+  802417:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80241b:	79 83                	jns    8023a0 <vprintfmt+0x5e>
+  80241d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802420:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802423:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80242a:	e9 71 ff ff ff       	jmp    8023a0 <vprintfmt+0x5e>
+  80242f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802432:	85 c9                	test   %ecx,%ecx
+  802434:	b8 00 00 00 00       	mov    $0x0,%eax
+  802439:	0f 49 c1             	cmovns %ecx,%eax
+  80243c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80243f:	89 d6                	mov    %edx,%esi
+  802441:	e9 5a ff ff ff       	jmp    8023a0 <vprintfmt+0x5e>
+  802446:	89 d6                	mov    %edx,%esi
+  802448:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80244f:	e9 4c ff ff ff       	jmp    8023a0 <vprintfmt+0x5e>
+  802454:	89 d6                	mov    %edx,%esi
+  802456:	eb bf                	jmp    802417 <vprintfmt+0xd5>
+  802458:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80245c:	89 d6                	mov    %edx,%esi
+  80245e:	e9 3d ff ff ff       	jmp    8023a0 <vprintfmt+0x5e>
+  802463:	89 55 10             	mov    %edx,0x10(%ebp)
+  802466:	8b 45 14             	mov    0x14(%ebp),%eax
+  802469:	8d 70 04             	lea    0x4(%eax),%esi
+  80246c:	83 ec 08             	sub    $0x8,%esp
+  80246f:	53                   	push   %ebx
+  802470:	ff 30                	push   (%eax)
+  802472:	ff d7                	call   *%edi
+  802474:	83 c4 10             	add    $0x10,%esp
+  802477:	89 75 14             	mov    %esi,0x14(%ebp)
+  80247a:	e9 d4 fe ff ff       	jmp    802353 <vprintfmt+0x11>
+  80247f:	89 55 10             	mov    %edx,0x10(%ebp)
+  802482:	8b 45 14             	mov    0x14(%ebp),%eax
+  802485:	8d 70 04             	lea    0x4(%eax),%esi
+  802488:	8b 10                	mov    (%eax),%edx
+  80248a:	89 d0                	mov    %edx,%eax
+  80248c:	f7 d8                	neg    %eax
+  80248e:	0f 48 c2             	cmovs  %edx,%eax
+  802491:	83 f8 12             	cmp    $0x12,%eax
+  802494:	7f 23                	jg     8024b9 <vprintfmt+0x177>
+  802496:	8b 14 85 a0 35 80 00 	mov    0x8035a0(,%eax,4),%edx
+  80249d:	85 d2                	test   %edx,%edx
+  80249f:	74 18                	je     8024b9 <vprintfmt+0x177>
+  8024a1:	52                   	push   %edx
+  8024a2:	68 5b 32 80 00       	push   $0x80325b
+  8024a7:	53                   	push   %ebx
+  8024a8:	57                   	push   %edi
+  8024a9:	e8 77 fe ff ff       	call   802325 <printfmt>
+  8024ae:	83 c4 10             	add    $0x10,%esp
+  8024b1:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024b4:	e9 9a fe ff ff       	jmp    802353 <vprintfmt+0x11>
+  8024b9:	50                   	push   %eax
+  8024ba:	68 0f 33 80 00       	push   $0x80330f
+  8024bf:	53                   	push   %ebx
+  8024c0:	57                   	push   %edi
+  8024c1:	e8 5f fe ff ff       	call   802325 <printfmt>
+  8024c6:	83 c4 10             	add    $0x10,%esp
+  8024c9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024cc:	e9 82 fe ff ff       	jmp    802353 <vprintfmt+0x11>
+  8024d1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d7:	83 c0 04             	add    $0x4,%eax
+  8024da:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8024dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e0:	8b 00                	mov    (%eax),%eax
+  8024e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	0f 84 61 03 00 00    	je     80284e <vprintfmt+0x50c>
+  8024ed:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8024f1:	7e 06                	jle    8024f9 <vprintfmt+0x1b7>
+  8024f3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8024f7:	75 29                	jne    802522 <vprintfmt+0x1e0>
+  8024f9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8024fc:	8d 70 01             	lea    0x1(%eax),%esi
+  8024ff:	0f b6 00             	movzbl (%eax),%eax
+  802502:	0f be d0             	movsbl %al,%edx
+  802505:	85 d2                	test   %edx,%edx
+  802507:	0f 84 bb 00 00 00    	je     8025c8 <vprintfmt+0x286>
+  80250d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802510:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802513:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802516:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802519:	eb 7a                	jmp    802595 <vprintfmt+0x253>
+  80251b:	c7 45 d0 08 33 80 00 	movl   $0x803308,-0x30(%ebp)
+  802522:	83 ec 08             	sub    $0x8,%esp
+  802525:	ff 75 d4             	push   -0x2c(%ebp)
+  802528:	ff 75 d0             	push   -0x30(%ebp)
+  80252b:	e8 e0 03 00 00       	call   802910 <strnlen>
+  802530:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802533:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	85 d2                	test   %edx,%edx
+  80253b:	0f 8e d6 02 00 00    	jle    802817 <vprintfmt+0x4d5>
+  802541:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802545:	83 ec 08             	sub    $0x8,%esp
+  802548:	53                   	push   %ebx
+  802549:	56                   	push   %esi
+  80254a:	ff d7                	call   *%edi
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802553:	75 f0                	jne    802545 <vprintfmt+0x203>
+  802555:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802558:	8d 70 01             	lea    0x1(%eax),%esi
+  80255b:	0f b6 00             	movzbl (%eax),%eax
+  80255e:	0f be d0             	movsbl %al,%edx
+  802561:	85 d2                	test   %edx,%edx
+  802563:	0f 84 da 02 00 00    	je     802843 <vprintfmt+0x501>
+  802569:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80256c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80256f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802572:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802575:	eb 1e                	jmp    802595 <vprintfmt+0x253>
+  802577:	83 ec 08             	sub    $0x8,%esp
+  80257a:	ff 75 0c             	push   0xc(%ebp)
+  80257d:	52                   	push   %edx
+  80257e:	ff 55 08             	call   *0x8(%ebp)
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	83 eb 01             	sub    $0x1,%ebx
+  802587:	83 c6 01             	add    $0x1,%esi
+  80258a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80258e:	0f be d0             	movsbl %al,%edx
+  802591:	85 d2                	test   %edx,%edx
+  802593:	74 2a                	je     8025bf <vprintfmt+0x27d>
+  802595:	85 ff                	test   %edi,%edi
+  802597:	78 05                	js     80259e <vprintfmt+0x25c>
+  802599:	83 ef 01             	sub    $0x1,%edi
+  80259c:	78 59                	js     8025f7 <vprintfmt+0x2b5>
+  80259e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8025a2:	74 d3                	je     802577 <vprintfmt+0x235>
+  8025a4:	0f be c0             	movsbl %al,%eax
+  8025a7:	83 e8 20             	sub    $0x20,%eax
+  8025aa:	83 f8 5e             	cmp    $0x5e,%eax
+  8025ad:	76 c8                	jbe    802577 <vprintfmt+0x235>
+  8025af:	83 ec 08             	sub    $0x8,%esp
+  8025b2:	ff 75 0c             	push   0xc(%ebp)
+  8025b5:	6a 3f                	push   $0x3f
+  8025b7:	ff 55 08             	call   *0x8(%ebp)
+  8025ba:	83 c4 10             	add    $0x10,%esp
+  8025bd:	eb c5                	jmp    802584 <vprintfmt+0x242>
+  8025bf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025c2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025c8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025cb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025cf:	7e 1b                	jle    8025ec <vprintfmt+0x2aa>
+  8025d1:	83 ec 08             	sub    $0x8,%esp
+  8025d4:	53                   	push   %ebx
+  8025d5:	6a 20                	push   $0x20
+  8025d7:	ff d7                	call   *%edi
+  8025d9:	83 c4 10             	add    $0x10,%esp
+  8025dc:	83 ee 01             	sub    $0x1,%esi
+  8025df:	75 f0                	jne    8025d1 <vprintfmt+0x28f>
+  8025e1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025e4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025e7:	e9 67 fd ff ff       	jmp    802353 <vprintfmt+0x11>
+  8025ec:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025f2:	e9 5c fd ff ff       	jmp    802353 <vprintfmt+0x11>
+  8025f7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802600:	eb c6                	jmp    8025c8 <vprintfmt+0x286>
+  802602:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802605:	89 55 10             	mov    %edx,0x10(%ebp)
+  802608:	83 f9 01             	cmp    $0x1,%ecx
+  80260b:	7f 1f                	jg     80262c <vprintfmt+0x2ea>
+  80260d:	85 c9                	test   %ecx,%ecx
+  80260f:	74 67                	je     802678 <vprintfmt+0x336>
+  802611:	8b 45 14             	mov    0x14(%ebp),%eax
+  802614:	8b 30                	mov    (%eax),%esi
+  802616:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802619:	89 f0                	mov    %esi,%eax
+  80261b:	c1 f8 1f             	sar    $0x1f,%eax
+  80261e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802621:	8b 45 14             	mov    0x14(%ebp),%eax
+  802624:	8d 40 04             	lea    0x4(%eax),%eax
+  802627:	89 45 14             	mov    %eax,0x14(%ebp)
+  80262a:	eb 17                	jmp    802643 <vprintfmt+0x301>
+  80262c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80262f:	8b 50 04             	mov    0x4(%eax),%edx
+  802632:	8b 00                	mov    (%eax),%eax
+  802634:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802637:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80263a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80263d:	8d 40 08             	lea    0x8(%eax),%eax
+  802640:	89 45 14             	mov    %eax,0x14(%ebp)
+  802643:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802646:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802649:	be 0a 00 00 00       	mov    $0xa,%esi
+  80264e:	85 c9                	test   %ecx,%ecx
+  802650:	0f 89 12 01 00 00    	jns    802768 <vprintfmt+0x426>
+  802656:	83 ec 08             	sub    $0x8,%esp
+  802659:	53                   	push   %ebx
+  80265a:	6a 2d                	push   $0x2d
+  80265c:	ff d7                	call   *%edi
+  80265e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802661:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802664:	f7 da                	neg    %edx
+  802666:	83 d1 00             	adc    $0x0,%ecx
+  802669:	f7 d9                	neg    %ecx
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	be 0a 00 00 00       	mov    $0xa,%esi
+  802673:	e9 f0 00 00 00       	jmp    802768 <vprintfmt+0x426>
+  802678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80267b:	8b 30                	mov    (%eax),%esi
+  80267d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802680:	89 f0                	mov    %esi,%eax
+  802682:	c1 f8 1f             	sar    $0x1f,%eax
+  802685:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80268b:	8d 40 04             	lea    0x4(%eax),%eax
+  80268e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802691:	eb b0                	jmp    802643 <vprintfmt+0x301>
+  802693:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802696:	89 55 10             	mov    %edx,0x10(%ebp)
+  802699:	83 f9 01             	cmp    $0x1,%ecx
+  80269c:	7f 1e                	jg     8026bc <vprintfmt+0x37a>
+  80269e:	85 c9                	test   %ecx,%ecx
+  8026a0:	74 32                	je     8026d4 <vprintfmt+0x392>
+  8026a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a5:	8b 10                	mov    (%eax),%edx
+  8026a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8026af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026b2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026b7:	e9 ac 00 00 00       	jmp    802768 <vprintfmt+0x426>
+  8026bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026bf:	8b 10                	mov    (%eax),%edx
+  8026c1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026c4:	8d 40 08             	lea    0x8(%eax),%eax
+  8026c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026ca:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026cf:	e9 94 00 00 00       	jmp    802768 <vprintfmt+0x426>
+  8026d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026d7:	8b 10                	mov    (%eax),%edx
+  8026d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026de:	8d 40 04             	lea    0x4(%eax),%eax
+  8026e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026e4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026e9:	eb 7d                	jmp    802768 <vprintfmt+0x426>
+  8026eb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026ee:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026f1:	83 f9 01             	cmp    $0x1,%ecx
+  8026f4:	7f 1b                	jg     802711 <vprintfmt+0x3cf>
+  8026f6:	85 c9                	test   %ecx,%ecx
+  8026f8:	74 2c                	je     802726 <vprintfmt+0x3e4>
+  8026fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026fd:	8b 10                	mov    (%eax),%edx
+  8026ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802704:	8d 40 04             	lea    0x4(%eax),%eax
+  802707:	89 45 14             	mov    %eax,0x14(%ebp)
+  80270a:	be 08 00 00 00       	mov    $0x8,%esi
+  80270f:	eb 57                	jmp    802768 <vprintfmt+0x426>
+  802711:	8b 45 14             	mov    0x14(%ebp),%eax
+  802714:	8b 10                	mov    (%eax),%edx
+  802716:	8b 48 04             	mov    0x4(%eax),%ecx
+  802719:	8d 40 08             	lea    0x8(%eax),%eax
+  80271c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80271f:	be 08 00 00 00       	mov    $0x8,%esi
+  802724:	eb 42                	jmp    802768 <vprintfmt+0x426>
+  802726:	8b 45 14             	mov    0x14(%ebp),%eax
+  802729:	8b 10                	mov    (%eax),%edx
+  80272b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802730:	8d 40 04             	lea    0x4(%eax),%eax
+  802733:	89 45 14             	mov    %eax,0x14(%ebp)
+  802736:	be 08 00 00 00       	mov    $0x8,%esi
+  80273b:	eb 2b                	jmp    802768 <vprintfmt+0x426>
+  80273d:	89 55 10             	mov    %edx,0x10(%ebp)
+  802740:	83 ec 08             	sub    $0x8,%esp
+  802743:	53                   	push   %ebx
+  802744:	6a 30                	push   $0x30
+  802746:	ff d7                	call   *%edi
+  802748:	83 c4 08             	add    $0x8,%esp
+  80274b:	53                   	push   %ebx
+  80274c:	6a 78                	push   $0x78
+  80274e:	ff d7                	call   *%edi
+  802750:	8b 45 14             	mov    0x14(%ebp),%eax
+  802753:	8b 10                	mov    (%eax),%edx
+  802755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	8d 40 04             	lea    0x4(%eax),%eax
+  802760:	89 45 14             	mov    %eax,0x14(%ebp)
+  802763:	be 10 00 00 00       	mov    $0x10,%esi
+  802768:	83 ec 0c             	sub    $0xc,%esp
+  80276b:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80276f:	50                   	push   %eax
+  802770:	ff 75 e4             	push   -0x1c(%ebp)
+  802773:	56                   	push   %esi
+  802774:	51                   	push   %ecx
+  802775:	52                   	push   %edx
+  802776:	89 da                	mov    %ebx,%edx
+  802778:	89 f8                	mov    %edi,%eax
+  80277a:	e8 d8 fa ff ff       	call   802257 <printnum>
+  80277f:	83 c4 20             	add    $0x20,%esp
+  802782:	e9 cc fb ff ff       	jmp    802353 <vprintfmt+0x11>
+  802787:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80278a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80278d:	83 f9 01             	cmp    $0x1,%ecx
+  802790:	7f 1b                	jg     8027ad <vprintfmt+0x46b>
+  802792:	85 c9                	test   %ecx,%ecx
+  802794:	74 2c                	je     8027c2 <vprintfmt+0x480>
+  802796:	8b 45 14             	mov    0x14(%ebp),%eax
+  802799:	8b 10                	mov    (%eax),%edx
+  80279b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8027a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027a6:	be 10 00 00 00       	mov    $0x10,%esi
+  8027ab:	eb bb                	jmp    802768 <vprintfmt+0x426>
+  8027ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027b0:	8b 10                	mov    (%eax),%edx
+  8027b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8027b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027bb:	be 10 00 00 00       	mov    $0x10,%esi
+  8027c0:	eb a6                	jmp    802768 <vprintfmt+0x426>
+  8027c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c5:	8b 10                	mov    (%eax),%edx
+  8027c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8027cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027d2:	be 10 00 00 00       	mov    $0x10,%esi
+  8027d7:	eb 8f                	jmp    802768 <vprintfmt+0x426>
+  8027d9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027dc:	83 ec 08             	sub    $0x8,%esp
+  8027df:	53                   	push   %ebx
+  8027e0:	6a 25                	push   $0x25
+  8027e2:	ff d7                	call   *%edi
+  8027e4:	83 c4 10             	add    $0x10,%esp
+  8027e7:	e9 67 fb ff ff       	jmp    802353 <vprintfmt+0x11>
+  8027ec:	83 ec 08             	sub    $0x8,%esp
+  8027ef:	53                   	push   %ebx
+  8027f0:	6a 25                	push   $0x25
+  8027f2:	ff d7                	call   *%edi
+  8027f4:	83 c4 10             	add    $0x10,%esp
+  8027f7:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8027fb:	0f 84 ba fb ff ff    	je     8023bb <vprintfmt+0x79>
+  802801:	89 75 10             	mov    %esi,0x10(%ebp)
+  802804:	89 f0                	mov    %esi,%eax
+  802806:	83 e8 01             	sub    $0x1,%eax
+  802809:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80280d:	75 f7                	jne    802806 <vprintfmt+0x4c4>
+  80280f:	89 45 10             	mov    %eax,0x10(%ebp)
+  802812:	e9 3c fb ff ff       	jmp    802353 <vprintfmt+0x11>
+  802817:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80281a:	8d 70 01             	lea    0x1(%eax),%esi
+  80281d:	0f b6 00             	movzbl (%eax),%eax
+  802820:	0f be d0             	movsbl %al,%edx
+  802823:	85 d2                	test   %edx,%edx
+  802825:	74 11                	je     802838 <vprintfmt+0x4f6>
+  802827:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80282a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80282d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802830:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802833:	e9 5d fd ff ff       	jmp    802595 <vprintfmt+0x253>
+  802838:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80283b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80283e:	e9 10 fb ff ff       	jmp    802353 <vprintfmt+0x11>
+  802843:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802846:	89 45 14             	mov    %eax,0x14(%ebp)
+  802849:	e9 05 fb ff ff       	jmp    802353 <vprintfmt+0x11>
+  80284e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802852:	7e 0a                	jle    80285e <vprintfmt+0x51c>
+  802854:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802858:	0f 85 bd fc ff ff    	jne    80251b <vprintfmt+0x1d9>
+  80285e:	ba 28 00 00 00       	mov    $0x28,%edx
+  802863:	b8 28 00 00 00       	mov    $0x28,%eax
+  802868:	be 09 33 80 00       	mov    $0x803309,%esi
+  80286d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802870:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802873:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802876:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802879:	e9 17 fd ff ff       	jmp    802595 <vprintfmt+0x253>
+  80287e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802881:	5b                   	pop    %ebx
+  802882:	5e                   	pop    %esi
+  802883:	5f                   	pop    %edi
+  802884:	5d                   	pop    %ebp
+  802885:	c3                   	ret
+
+00802886 <vsnprintf>:
+  802886:	55                   	push   %ebp
+  802887:	89 e5                	mov    %esp,%ebp
+  802889:	83 ec 18             	sub    $0x18,%esp
+  80288c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802892:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802895:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802899:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80289c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8028a3:	85 c0                	test   %eax,%eax
+  8028a5:	74 26                	je     8028cd <vsnprintf+0x47>
+  8028a7:	85 d2                	test   %edx,%edx
+  8028a9:	7e 22                	jle    8028cd <vsnprintf+0x47>
+  8028ab:	ff 75 14             	push   0x14(%ebp)
+  8028ae:	ff 75 10             	push   0x10(%ebp)
+  8028b1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028b4:	50                   	push   %eax
+  8028b5:	68 08 23 80 00       	push   $0x802308
+  8028ba:	e8 83 fa ff ff       	call   802342 <vprintfmt>
+  8028bf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028c2:	c6 00 00             	movb   $0x0,(%eax)
+  8028c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c8:	83 c4 10             	add    $0x10,%esp
+  8028cb:	c9                   	leave
+  8028cc:	c3                   	ret
+  8028cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028d2:	eb f7                	jmp    8028cb <vsnprintf+0x45>
+
+008028d4 <snprintf>:
+  8028d4:	55                   	push   %ebp
+  8028d5:	89 e5                	mov    %esp,%ebp
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+  8028da:	8d 45 14             	lea    0x14(%ebp),%eax
+  8028dd:	50                   	push   %eax
+  8028de:	ff 75 10             	push   0x10(%ebp)
+  8028e1:	ff 75 0c             	push   0xc(%ebp)
+  8028e4:	ff 75 08             	push   0x8(%ebp)
+  8028e7:	e8 9a ff ff ff       	call   802886 <vsnprintf>
+  8028ec:	c9                   	leave
+  8028ed:	c3                   	ret
+
+008028ee <strlen>:
+  8028ee:	55                   	push   %ebp
+  8028ef:	89 e5                	mov    %esp,%ebp
+  8028f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028f4:	80 3a 00             	cmpb   $0x0,(%edx)
+  8028f7:	74 10                	je     802909 <strlen+0x1b>
+  8028f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fe:	83 c0 01             	add    $0x1,%eax
+  802901:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802905:	75 f7                	jne    8028fe <strlen+0x10>
+  802907:	5d                   	pop    %ebp
+  802908:	c3                   	ret
+  802909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290e:	eb f7                	jmp    802907 <strlen+0x19>
+
+00802910 <strnlen>:
+  802910:	55                   	push   %ebp
+  802911:	89 e5                	mov    %esp,%ebp
+  802913:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802916:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802919:	85 d2                	test   %edx,%edx
+  80291b:	74 16                	je     802933 <strnlen+0x23>
+  80291d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802922:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802926:	74 09                	je     802931 <strnlen+0x21>
+  802928:	83 c0 01             	add    $0x1,%eax
+  80292b:	39 d0                	cmp    %edx,%eax
+  80292d:	75 f3                	jne    802922 <strnlen+0x12>
+  80292f:	89 d0                	mov    %edx,%eax
+  802931:	5d                   	pop    %ebp
+  802932:	c3                   	ret
+  802933:	b8 00 00 00 00       	mov    $0x0,%eax
+  802938:	eb f7                	jmp    802931 <strnlen+0x21>
+
+0080293a <strcpy>:
+  80293a:	55                   	push   %ebp
+  80293b:	89 e5                	mov    %esp,%ebp
+  80293d:	53                   	push   %ebx
+  80293e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802941:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802944:	b8 00 00 00 00       	mov    $0x0,%eax
+  802949:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80294d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802950:	83 c0 01             	add    $0x1,%eax
+  802953:	84 d2                	test   %dl,%dl
+  802955:	75 f2                	jne    802949 <strcpy+0xf>
+  802957:	89 c8                	mov    %ecx,%eax
+  802959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80295c:	c9                   	leave
+  80295d:	c3                   	ret
+
+0080295e <strcat>:
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	53                   	push   %ebx
+  802962:	83 ec 10             	sub    $0x10,%esp
+  802965:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802968:	53                   	push   %ebx
+  802969:	e8 80 ff ff ff       	call   8028ee <strlen>
+  80296e:	83 c4 08             	add    $0x8,%esp
+  802971:	ff 75 0c             	push   0xc(%ebp)
+  802974:	01 d8                	add    %ebx,%eax
+  802976:	50                   	push   %eax
+  802977:	e8 be ff ff ff       	call   80293a <strcpy>
+  80297c:	89 d8                	mov    %ebx,%eax
+  80297e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802981:	c9                   	leave
+  802982:	c3                   	ret
+
+00802983 <strncpy>:
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	56                   	push   %esi
+  802987:	53                   	push   %ebx
+  802988:	8b 75 08             	mov    0x8(%ebp),%esi
+  80298b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80298e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802991:	85 db                	test   %ebx,%ebx
+  802993:	74 17                	je     8029ac <strncpy+0x29>
+  802995:	01 f3                	add    %esi,%ebx
+  802997:	89 f0                	mov    %esi,%eax
+  802999:	83 c0 01             	add    $0x1,%eax
+  80299c:	0f b6 0a             	movzbl (%edx),%ecx
+  80299f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029a2:	80 f9 01             	cmp    $0x1,%cl
+  8029a5:	83 da ff             	sbb    $0xffffffff,%edx
+  8029a8:	39 c3                	cmp    %eax,%ebx
+  8029aa:	75 ed                	jne    802999 <strncpy+0x16>
+  8029ac:	89 f0                	mov    %esi,%eax
+  8029ae:	5b                   	pop    %ebx
+  8029af:	5e                   	pop    %esi
+  8029b0:	5d                   	pop    %ebp
+  8029b1:	c3                   	ret
+
+008029b2 <strlcpy>:
+  8029b2:	55                   	push   %ebp
+  8029b3:	89 e5                	mov    %esp,%ebp
+  8029b5:	56                   	push   %esi
+  8029b6:	53                   	push   %ebx
+  8029b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029c0:	89 f0                	mov    %esi,%eax
+  8029c2:	85 db                	test   %ebx,%ebx
+  8029c4:	74 1e                	je     8029e4 <strlcpy+0x32>
+  8029c6:	83 eb 01             	sub    $0x1,%ebx
+  8029c9:	74 16                	je     8029e1 <strlcpy+0x2f>
+  8029cb:	01 f3                	add    %esi,%ebx
+  8029cd:	0f b6 0a             	movzbl (%edx),%ecx
+  8029d0:	84 c9                	test   %cl,%cl
+  8029d2:	74 0d                	je     8029e1 <strlcpy+0x2f>
+  8029d4:	83 c2 01             	add    $0x1,%edx
+  8029d7:	83 c0 01             	add    $0x1,%eax
+  8029da:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029dd:	39 d8                	cmp    %ebx,%eax
+  8029df:	75 ec                	jne    8029cd <strlcpy+0x1b>
+  8029e1:	c6 00 00             	movb   $0x0,(%eax)
+  8029e4:	29 f0                	sub    %esi,%eax
+  8029e6:	5b                   	pop    %ebx
+  8029e7:	5e                   	pop    %esi
+  8029e8:	5d                   	pop    %ebp
+  8029e9:	c3                   	ret
+
+008029ea <strcmp>:
+  8029ea:	55                   	push   %ebp
+  8029eb:	89 e5                	mov    %esp,%ebp
+  8029ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029f3:	0f b6 01             	movzbl (%ecx),%eax
+  8029f6:	84 c0                	test   %al,%al
+  8029f8:	74 11                	je     802a0b <strcmp+0x21>
+  8029fa:	38 02                	cmp    %al,(%edx)
+  8029fc:	75 0d                	jne    802a0b <strcmp+0x21>
+  8029fe:	83 c1 01             	add    $0x1,%ecx
+  802a01:	83 c2 01             	add    $0x1,%edx
+  802a04:	0f b6 01             	movzbl (%ecx),%eax
+  802a07:	84 c0                	test   %al,%al
+  802a09:	75 ef                	jne    8029fa <strcmp+0x10>
+  802a0b:	0f b6 c0             	movzbl %al,%eax
+  802a0e:	0f b6 12             	movzbl (%edx),%edx
+  802a11:	29 d0                	sub    %edx,%eax
+  802a13:	5d                   	pop    %ebp
+  802a14:	c3                   	ret
+
+00802a15 <strncmp>:
+  802a15:	55                   	push   %ebp
+  802a16:	89 e5                	mov    %esp,%ebp
+  802a18:	53                   	push   %ebx
+  802a19:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a1f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a27:	85 d2                	test   %edx,%edx
+  802a29:	74 2e                	je     802a59 <strncmp+0x44>
+  802a2b:	0f b6 01             	movzbl (%ecx),%eax
+  802a2e:	84 c0                	test   %al,%al
+  802a30:	74 16                	je     802a48 <strncmp+0x33>
+  802a32:	3a 03                	cmp    (%ebx),%al
+  802a34:	75 12                	jne    802a48 <strncmp+0x33>
+  802a36:	83 c1 01             	add    $0x1,%ecx
+  802a39:	83 c3 01             	add    $0x1,%ebx
+  802a3c:	83 ea 01             	sub    $0x1,%edx
+  802a3f:	75 ea                	jne    802a2b <strncmp+0x16>
+  802a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a46:	eb 11                	jmp    802a59 <strncmp+0x44>
+  802a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4d:	85 d2                	test   %edx,%edx
+  802a4f:	74 08                	je     802a59 <strncmp+0x44>
+  802a51:	0f b6 01             	movzbl (%ecx),%eax
+  802a54:	0f b6 13             	movzbl (%ebx),%edx
+  802a57:	29 d0                	sub    %edx,%eax
+  802a59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5c:	c9                   	leave
+  802a5d:	c3                   	ret
+
+00802a5e <strchr>:
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a64:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a68:	0f b6 10             	movzbl (%eax),%edx
+  802a6b:	84 d2                	test   %dl,%dl
+  802a6d:	74 15                	je     802a84 <strchr+0x26>
+  802a6f:	38 d1                	cmp    %dl,%cl
+  802a71:	74 0f                	je     802a82 <strchr+0x24>
+  802a73:	83 c0 01             	add    $0x1,%eax
+  802a76:	0f b6 10             	movzbl (%eax),%edx
+  802a79:	84 d2                	test   %dl,%dl
+  802a7b:	75 f2                	jne    802a6f <strchr+0x11>
+  802a7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a82:	5d                   	pop    %ebp
+  802a83:	c3                   	ret
+  802a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a89:	eb f7                	jmp    802a82 <strchr+0x24>
+
+00802a8b <strfind>:
+  802a8b:	55                   	push   %ebp
+  802a8c:	89 e5                	mov    %esp,%ebp
+  802a8e:	53                   	push   %ebx
+  802a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a92:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a95:	0f b6 18             	movzbl (%eax),%ebx
+  802a98:	38 d3                	cmp    %dl,%bl
+  802a9a:	74 14                	je     802ab0 <strfind+0x25>
+  802a9c:	89 d1                	mov    %edx,%ecx
+  802a9e:	84 db                	test   %bl,%bl
+  802aa0:	74 0e                	je     802ab0 <strfind+0x25>
+  802aa2:	83 c0 01             	add    $0x1,%eax
+  802aa5:	0f b6 10             	movzbl (%eax),%edx
+  802aa8:	38 ca                	cmp    %cl,%dl
+  802aaa:	74 04                	je     802ab0 <strfind+0x25>
+  802aac:	84 d2                	test   %dl,%dl
+  802aae:	75 f2                	jne    802aa2 <strfind+0x17>
+  802ab0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab3:	c9                   	leave
+  802ab4:	c3                   	ret
+
+00802ab5 <memset>:
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	57                   	push   %edi
+  802ab9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802abc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802abf:	85 c9                	test   %ecx,%ecx
+  802ac1:	74 20                	je     802ae3 <memset+0x2e>
+  802ac3:	89 f8                	mov    %edi,%eax
+  802ac5:	09 c8                	or     %ecx,%eax
+  802ac7:	a8 03                	test   $0x3,%al
+  802ac9:	75 12                	jne    802add <memset+0x28>
+  802acb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802acf:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802ad5:	c1 e9 02             	shr    $0x2,%ecx
+  802ad8:	fc                   	cld
+  802ad9:	f3 ab                	rep stos %eax,%es:(%edi)
+  802adb:	eb 06                	jmp    802ae3 <memset+0x2e>
+  802add:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae0:	fc                   	cld
+  802ae1:	f3 aa                	rep stos %al,%es:(%edi)
+  802ae3:	89 f8                	mov    %edi,%eax
+  802ae5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802ae8:	c9                   	leave
+  802ae9:	c3                   	ret
+
+00802aea <memmove>:
+  802aea:	55                   	push   %ebp
+  802aeb:	89 e5                	mov    %esp,%ebp
+  802aed:	57                   	push   %edi
+  802aee:	56                   	push   %esi
+  802aef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802af5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802af8:	39 c6                	cmp    %eax,%esi
+  802afa:	73 32                	jae    802b2e <memmove+0x44>
+  802afc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802aff:	39 d0                	cmp    %edx,%eax
+  802b01:	73 2b                	jae    802b2e <memmove+0x44>
+  802b03:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b06:	89 d6                	mov    %edx,%esi
+  802b08:	09 fe                	or     %edi,%esi
+  802b0a:	09 ce                	or     %ecx,%esi
+  802b0c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b12:	75 0e                	jne    802b22 <memmove+0x38>
+  802b14:	83 ef 04             	sub    $0x4,%edi
+  802b17:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b1a:	c1 e9 02             	shr    $0x2,%ecx
+  802b1d:	fd                   	std
+  802b1e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b20:	eb 09                	jmp    802b2b <memmove+0x41>
+  802b22:	83 ef 01             	sub    $0x1,%edi
+  802b25:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b28:	fd                   	std
+  802b29:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b2b:	fc                   	cld
+  802b2c:	eb 1a                	jmp    802b48 <memmove+0x5e>
+  802b2e:	89 f2                	mov    %esi,%edx
+  802b30:	09 c2                	or     %eax,%edx
+  802b32:	09 ca                	or     %ecx,%edx
+  802b34:	f6 c2 03             	test   $0x3,%dl
+  802b37:	75 0a                	jne    802b43 <memmove+0x59>
+  802b39:	c1 e9 02             	shr    $0x2,%ecx
+  802b3c:	89 c7                	mov    %eax,%edi
+  802b3e:	fc                   	cld
+  802b3f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b41:	eb 05                	jmp    802b48 <memmove+0x5e>
+  802b43:	89 c7                	mov    %eax,%edi
+  802b45:	fc                   	cld
+  802b46:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b48:	5e                   	pop    %esi
+  802b49:	5f                   	pop    %edi
+  802b4a:	5d                   	pop    %ebp
+  802b4b:	c3                   	ret
+
+00802b4c <memcpy>:
+  802b4c:	55                   	push   %ebp
+  802b4d:	89 e5                	mov    %esp,%ebp
+  802b4f:	83 ec 0c             	sub    $0xc,%esp
+  802b52:	ff 75 10             	push   0x10(%ebp)
+  802b55:	ff 75 0c             	push   0xc(%ebp)
+  802b58:	ff 75 08             	push   0x8(%ebp)
+  802b5b:	e8 8a ff ff ff       	call   802aea <memmove>
+  802b60:	c9                   	leave
+  802b61:	c3                   	ret
+
+00802b62 <memcmp>:
+  802b62:	55                   	push   %ebp
+  802b63:	89 e5                	mov    %esp,%ebp
+  802b65:	56                   	push   %esi
+  802b66:	53                   	push   %ebx
+  802b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b6d:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b70:	85 f6                	test   %esi,%esi
+  802b72:	74 29                	je     802b9d <memcmp+0x3b>
+  802b74:	01 c6                	add    %eax,%esi
+  802b76:	0f b6 08             	movzbl (%eax),%ecx
+  802b79:	0f b6 1a             	movzbl (%edx),%ebx
+  802b7c:	38 d9                	cmp    %bl,%cl
+  802b7e:	75 11                	jne    802b91 <memcmp+0x2f>
+  802b80:	83 c0 01             	add    $0x1,%eax
+  802b83:	83 c2 01             	add    $0x1,%edx
+  802b86:	39 c6                	cmp    %eax,%esi
+  802b88:	75 ec                	jne    802b76 <memcmp+0x14>
+  802b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8f:	eb 08                	jmp    802b99 <memcmp+0x37>
+  802b91:	0f b6 c1             	movzbl %cl,%eax
+  802b94:	0f b6 db             	movzbl %bl,%ebx
+  802b97:	29 d8                	sub    %ebx,%eax
+  802b99:	5b                   	pop    %ebx
+  802b9a:	5e                   	pop    %esi
+  802b9b:	5d                   	pop    %ebp
+  802b9c:	c3                   	ret
+  802b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba2:	eb f5                	jmp    802b99 <memcmp+0x37>
+
+00802ba4 <memfind>:
+  802ba4:	55                   	push   %ebp
+  802ba5:	89 e5                	mov    %esp,%ebp
+  802ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802baa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bad:	89 c2                	mov    %eax,%edx
+  802baf:	03 55 10             	add    0x10(%ebp),%edx
+  802bb2:	39 d0                	cmp    %edx,%eax
+  802bb4:	73 0d                	jae    802bc3 <memfind+0x1f>
+  802bb6:	38 08                	cmp    %cl,(%eax)
+  802bb8:	74 0d                	je     802bc7 <memfind+0x23>
+  802bba:	83 c0 01             	add    $0x1,%eax
+  802bbd:	39 c2                	cmp    %eax,%edx
+  802bbf:	75 f5                	jne    802bb6 <memfind+0x12>
+  802bc1:	eb 06                	jmp    802bc9 <memfind+0x25>
+  802bc3:	89 c2                	mov    %eax,%edx
+  802bc5:	eb 02                	jmp    802bc9 <memfind+0x25>
+  802bc7:	89 c2                	mov    %eax,%edx
+  802bc9:	89 d0                	mov    %edx,%eax
+  802bcb:	5d                   	pop    %ebp
+  802bcc:	c3                   	ret
+
+00802bcd <strtol>:
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	57                   	push   %edi
+  802bd1:	56                   	push   %esi
+  802bd2:	53                   	push   %ebx
+  802bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bd9:	0f b6 02             	movzbl (%edx),%eax
+  802bdc:	3c 20                	cmp    $0x20,%al
+  802bde:	74 04                	je     802be4 <strtol+0x17>
+  802be0:	3c 09                	cmp    $0x9,%al
+  802be2:	75 0e                	jne    802bf2 <strtol+0x25>
+  802be4:	83 c2 01             	add    $0x1,%edx
+  802be7:	0f b6 02             	movzbl (%edx),%eax
+  802bea:	3c 20                	cmp    $0x20,%al
+  802bec:	74 f6                	je     802be4 <strtol+0x17>
+  802bee:	3c 09                	cmp    $0x9,%al
+  802bf0:	74 f2                	je     802be4 <strtol+0x17>
+  802bf2:	3c 2b                	cmp    $0x2b,%al
+  802bf4:	74 2a                	je     802c20 <strtol+0x53>
+  802bf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bfb:	3c 2d                	cmp    $0x2d,%al
+  802bfd:	74 2b                	je     802c2a <strtol+0x5d>
+  802bff:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c05:	75 0f                	jne    802c16 <strtol+0x49>
+  802c07:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c0a:	74 28                	je     802c34 <strtol+0x67>
+  802c0c:	85 db                	test   %ebx,%ebx
+  802c0e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c13:	0f 44 d8             	cmove  %eax,%ebx
+  802c16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c1b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c1e:	eb 46                	jmp    802c66 <strtol+0x99>
+  802c20:	83 c2 01             	add    $0x1,%edx
+  802c23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c28:	eb d5                	jmp    802bff <strtol+0x32>
+  802c2a:	83 c2 01             	add    $0x1,%edx
+  802c2d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c32:	eb cb                	jmp    802bff <strtol+0x32>
+  802c34:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c38:	74 0e                	je     802c48 <strtol+0x7b>
+  802c3a:	85 db                	test   %ebx,%ebx
+  802c3c:	75 d8                	jne    802c16 <strtol+0x49>
+  802c3e:	83 c2 01             	add    $0x1,%edx
+  802c41:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c46:	eb ce                	jmp    802c16 <strtol+0x49>
+  802c48:	83 c2 02             	add    $0x2,%edx
+  802c4b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c50:	eb c4                	jmp    802c16 <strtol+0x49>
+  802c52:	0f be c0             	movsbl %al,%eax
+  802c55:	83 e8 30             	sub    $0x30,%eax
+  802c58:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c5b:	7d 3a                	jge    802c97 <strtol+0xca>
+  802c5d:	83 c2 01             	add    $0x1,%edx
+  802c60:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c64:	01 c1                	add    %eax,%ecx
+  802c66:	0f b6 02             	movzbl (%edx),%eax
+  802c69:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c6c:	89 f3                	mov    %esi,%ebx
+  802c6e:	80 fb 09             	cmp    $0x9,%bl
+  802c71:	76 df                	jbe    802c52 <strtol+0x85>
+  802c73:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802c76:	89 f3                	mov    %esi,%ebx
+  802c78:	80 fb 19             	cmp    $0x19,%bl
+  802c7b:	77 08                	ja     802c85 <strtol+0xb8>
+  802c7d:	0f be c0             	movsbl %al,%eax
+  802c80:	83 e8 57             	sub    $0x57,%eax
+  802c83:	eb d3                	jmp    802c58 <strtol+0x8b>
+  802c85:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802c88:	89 f3                	mov    %esi,%ebx
+  802c8a:	80 fb 19             	cmp    $0x19,%bl
+  802c8d:	77 08                	ja     802c97 <strtol+0xca>
+  802c8f:	0f be c0             	movsbl %al,%eax
+  802c92:	83 e8 37             	sub    $0x37,%eax
+  802c95:	eb c1                	jmp    802c58 <strtol+0x8b>
+  802c97:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802c9b:	74 05                	je     802ca2 <strtol+0xd5>
+  802c9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ca0:	89 10                	mov    %edx,(%eax)
+  802ca2:	89 c8                	mov    %ecx,%eax
+  802ca4:	f7 d8                	neg    %eax
+  802ca6:	85 ff                	test   %edi,%edi
+  802ca8:	0f 45 c8             	cmovne %eax,%ecx
+  802cab:	89 c8                	mov    %ecx,%eax
+  802cad:	5b                   	pop    %ebx
+  802cae:	5e                   	pop    %esi
+  802caf:	5f                   	pop    %edi
+  802cb0:	5d                   	pop    %ebp
+  802cb1:	c3                   	ret
+
+00802cb2 <ipc_recv>:
+  802cb2:	55                   	push   %ebp
+  802cb3:	89 e5                	mov    %esp,%ebp
+  802cb5:	56                   	push   %esi
+  802cb6:	53                   	push   %ebx
+  802cb7:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cc7:	0f 44 c2             	cmove  %edx,%eax
+  802cca:	83 ec 0c             	sub    $0xc,%esp
+  802ccd:	50                   	push   %eax
+  802cce:	e8 73 d7 ff ff       	call   800446 <sys_ipc_recv>
+  802cd3:	83 c4 10             	add    $0x10,%esp
+  802cd6:	85 c0                	test   %eax,%eax
+  802cd8:	78 2a                	js     802d04 <ipc_recv+0x52>
+  802cda:	a1 10 50 80 00       	mov    0x805010,%eax
+  802cdf:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802ce5:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802ceb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802cf1:	85 f6                	test   %esi,%esi
+  802cf3:	74 02                	je     802cf7 <ipc_recv+0x45>
+  802cf5:	89 0e                	mov    %ecx,(%esi)
+  802cf7:	85 db                	test   %ebx,%ebx
+  802cf9:	74 02                	je     802cfd <ipc_recv+0x4b>
+  802cfb:	89 13                	mov    %edx,(%ebx)
+  802cfd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d00:	5b                   	pop    %ebx
+  802d01:	5e                   	pop    %esi
+  802d02:	5d                   	pop    %ebp
+  802d03:	c3                   	ret
+  802d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d0e:	eb e1                	jmp    802cf1 <ipc_recv+0x3f>
+
+00802d10 <ipc_send>:
+  802d10:	55                   	push   %ebp
+  802d11:	89 e5                	mov    %esp,%ebp
+  802d13:	57                   	push   %edi
+  802d14:	56                   	push   %esi
+  802d15:	53                   	push   %ebx
+  802d16:	83 ec 0c             	sub    $0xc,%esp
+  802d19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d1f:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d22:	85 db                	test   %ebx,%ebx
+  802d24:	74 1e                	je     802d44 <ipc_send+0x34>
+  802d26:	56                   	push   %esi
+  802d27:	53                   	push   %ebx
+  802d28:	57                   	push   %edi
+  802d29:	ff 75 08             	push   0x8(%ebp)
+  802d2c:	e8 a2 d7 ff ff       	call   8004d3 <sys_ipc_send>
+  802d31:	83 c4 10             	add    $0x10,%esp
+  802d34:	85 c0                	test   %eax,%eax
+  802d36:	74 2a                	je     802d62 <ipc_send+0x52>
+  802d38:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d3b:	75 13                	jne    802d50 <ipc_send+0x40>
+  802d3d:	e8 0e d4 ff ff       	call   800150 <sys_yield>
+  802d42:	eb e2                	jmp    802d26 <ipc_send+0x16>
+  802d44:	be 00 00 00 00       	mov    $0x0,%esi
+  802d49:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d4e:	eb d6                	jmp    802d26 <ipc_send+0x16>
+  802d50:	50                   	push   %eax
+  802d51:	68 0c 36 80 00       	push   $0x80360c
+  802d56:	6a 4f                	push   $0x4f
+  802d58:	68 4f 36 80 00       	push   $0x80364f
+  802d5d:	e8 06 f4 ff ff       	call   802168 <_panic>
+  802d62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d65:	5b                   	pop    %ebx
+  802d66:	5e                   	pop    %esi
+  802d67:	5f                   	pop    %edi
+  802d68:	5d                   	pop    %ebp
+  802d69:	c3                   	ret
+
+00802d6a <ipc_call>:
+  802d6a:	55                   	push   %ebp
+  802d6b:	89 e5                	mov    %esp,%ebp
+  802d6d:	57                   	push   %edi
+  802d6e:	56                   	push   %esi
+  802d6f:	53                   	push   %ebx
+  802d70:	83 ec 0c             	sub    $0xc,%esp
+  802d73:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d77:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d7c:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d80:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d84:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d89:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802d8d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d96:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802d9a:	eb 05                	jmp    802da1 <ipc_call+0x37>
+  802d9c:	e8 af d3 ff ff       	call   800150 <sys_yield>
+  802da1:	83 ec 0c             	sub    $0xc,%esp
+  802da4:	56                   	push   %esi
+  802da5:	53                   	push   %ebx
+  802da6:	57                   	push   %edi
+  802da7:	ff 75 0c             	push   0xc(%ebp)
+  802daa:	ff 75 08             	push   0x8(%ebp)
+  802dad:	e8 71 d7 ff ff       	call   800523 <sys_ipc_call>
+  802db2:	83 c4 20             	add    $0x20,%esp
+  802db5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802db8:	74 e2                	je     802d9c <ipc_call+0x32>
+  802dba:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802dbd:	74 2d                	je     802dec <ipc_call+0x82>
+  802dbf:	85 c0                	test   %eax,%eax
+  802dc1:	78 4f                	js     802e12 <ipc_call+0xa8>
+  802dc3:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802dc7:	74 10                	je     802dd9 <ipc_call+0x6f>
+  802dc9:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dce:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802dd4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802dd7:	89 02                	mov    %eax,(%edx)
+  802dd9:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dde:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802de4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de7:	5b                   	pop    %ebx
+  802de8:	5e                   	pop    %esi
+  802de9:	5f                   	pop    %edi
+  802dea:	5d                   	pop    %ebp
+  802deb:	c3                   	ret
+  802dec:	ff 75 14             	push   0x14(%ebp)
+  802def:	ff 75 10             	push   0x10(%ebp)
+  802df2:	ff 75 0c             	push   0xc(%ebp)
+  802df5:	ff 75 08             	push   0x8(%ebp)
+  802df8:	e8 13 ff ff ff       	call   802d10 <ipc_send>
+  802dfd:	83 c4 0c             	add    $0xc,%esp
+  802e00:	ff 75 1c             	push   0x1c(%ebp)
+  802e03:	ff 75 18             	push   0x18(%ebp)
+  802e06:	6a 00                	push   $0x0
+  802e08:	e8 a5 fe ff ff       	call   802cb2 <ipc_recv>
+  802e0d:	83 c4 10             	add    $0x10,%esp
+  802e10:	eb d2                	jmp    802de4 <ipc_call+0x7a>
+  802e12:	50                   	push   %eax
+  802e13:	68 59 36 80 00       	push   $0x803659
+  802e18:	6a 6d                	push   $0x6d
+  802e1a:	68 4f 36 80 00       	push   $0x80364f
+  802e1f:	e8 44 f3 ff ff       	call   802168 <_panic>
+
+00802e24 <ipc_reply_recv>:
+  802e24:	55                   	push   %ebp
+  802e25:	89 e5                	mov    %esp,%ebp
+  802e27:	57                   	push   %edi
+  802e28:	56                   	push   %esi
+  802e29:	53                   	push   %ebx
+  802e2a:	83 ec 0c             	sub    $0xc,%esp
+  802e2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e30:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e33:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e36:	85 db                	test   %ebx,%ebx
+  802e38:	0f 84 ac 00 00 00    	je     802eea <ipc_reply_recv+0xc6>
+  802e3e:	85 f6                	test   %esi,%esi
+  802e40:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e45:	0f 45 c6             	cmovne %esi,%eax
+  802e48:	83 ec 0c             	sub    $0xc,%esp
+  802e4b:	50                   	push   %eax
+  802e4c:	ff 75 14             	push   0x14(%ebp)
+  802e4f:	53                   	push   %ebx
+  802e50:	ff 75 0c             	push   0xc(%ebp)
+  802e53:	ff 75 08             	push   0x8(%ebp)
+  802e56:	e8 e9 d6 ff ff       	call   800544 <sys_ipc_reply_recv>
+  802e5b:	83 c4 20             	add    $0x20,%esp
+  802e5e:	85 c0                	test   %eax,%eax
+  802e60:	78 3a                	js     802e9c <ipc_reply_recv+0x78>
+  802e62:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e66:	74 10                	je     802e78 <ipc_reply_recv+0x54>
+  802e68:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e6d:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e73:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e76:	89 02                	mov    %eax,(%edx)
+  802e78:	85 ff                	test   %edi,%edi
+  802e7a:	74 0d                	je     802e89 <ipc_reply_recv+0x65>
+  802e7c:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e81:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e87:	89 07                	mov    %eax,(%edi)
+  802e89:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e8e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e97:	5b                   	pop    %ebx
+  802e98:	5e                   	pop    %esi
+  802e99:	5f                   	pop    %edi
+  802e9a:	5d                   	pop    %ebp
+  802e9b:	c3                   	ret
+  802e9c:	ff 75 14             	push   0x14(%ebp)
+  802e9f:	53                   	push   %ebx
+  802ea0:	ff 75 0c             	push   0xc(%ebp)
+  802ea3:	ff 75 08             	push   0x8(%ebp)
+  802ea6:	e8 4b d5 ff ff       	call   8003f6 <sys_ipc_try_send>
+  802eab:	89 c2                	mov    %eax,%edx
+  802ead:	c1 ea 1f             	shr    $0x1f,%edx
+  802eb0:	83 c4 10             	add    $0x10,%esp
+  802eb3:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802eb6:	0f 95 c1             	setne  %cl
+  802eb9:	84 d1                	test   %dl,%cl
+  802ebb:	74 05                	je     802ec2 <ipc_reply_recv+0x9e>
+  802ebd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ec0:	75 12                	jne    802ed4 <ipc_reply_recv+0xb0>
+  802ec2:	83 ec 04             	sub    $0x4,%esp
+  802ec5:	57                   	push   %edi
+  802ec6:	56                   	push   %esi
+  802ec7:	ff 75 18             	push   0x18(%ebp)
+  802eca:	e8 e3 fd ff ff       	call   802cb2 <ipc_recv>
+  802ecf:	83 c4 10             	add    $0x10,%esp
+  802ed2:	eb c0                	jmp    802e94 <ipc_reply_recv+0x70>
+  802ed4:	83 ec 04             	sub    $0x4,%esp
+  802ed7:	50                   	push   %eax
+  802ed8:	ff 75 08             	push   0x8(%ebp)
+  802edb:	68 2c 36 80 00       	push   $0x80362c
+  802ee0:	e8 5e f3 ff ff       	call   802243 <cprintf>
+  802ee5:	83 c4 10             	add    $0x10,%esp
+  802ee8:	eb d8                	jmp    802ec2 <ipc_reply_recv+0x9e>
+  802eea:	85 f6                	test   %esi,%esi
+  802eec:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802ef1:	0f 45 c6             	cmovne %esi,%eax
+  802ef4:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802ef9:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f00:	e9 43 ff ff ff       	jmp    802e48 <ipc_reply_recv+0x24>
+
+00802f05 <ipc_find_env>:
+  802f05:	55                   	push   %ebp
+  802f06:	89 e5                	mov    %esp,%ebp
+  802f08:	83 ec 14             	sub    $0x14,%esp
+  802f0b:	ff 75 08             	push   0x8(%ebp)
+  802f0e:	e8 81 d4 ff ff       	call   800394 <sys_env_service>
+  802f13:	85 c0                	test   %eax,%eax
+  802f15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1a:	0f 48 c2             	cmovs  %edx,%eax
+  802f1d:	c9                   	leave
+  802f1e:	c3                   	ret
+
+00802f1f <pageref>:
+  802f1f:	55                   	push   %ebp
+  802f20:	89 e5                	mov    %esp,%ebp
+  802f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f25:	89 c2                	mov    %eax,%edx
+  802f27:	c1 ea 16             	shr    $0x16,%edx
+  802f2a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f36:	f6 c1 01             	test   $0x1,%cl
+  802f39:	74 22                	je     802f5d <pageref+0x3e>
+  802f3b:	c1 e8 0c             	shr    $0xc,%eax
+  802f3e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f45:	a8 01                	test   $0x1,%al
+  802f47:	74 14                	je     802f5d <pageref+0x3e>
+  802f49:	c1 e8 0c             	shr    $0xc,%eax
+  802f4c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f4f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f56:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f5a:	0f b7 d2             	movzwl %dx,%edx
+  802f5d:	89 d0                	mov    %edx,%eax
+  802f5f:	5d                   	pop    %ebp
+  802f60:	c3                   	ret
+
+00802f61 <__udivmoddi4>:
+  802f61:	55                   	push   %ebp
+  802f62:	57                   	push   %edi
+  802f63:	56                   	push   %esi
+  802f64:	53                   	push   %ebx
+  802f65:	83 ec 24             	sub    $0x24,%esp
+  802f68:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f6c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f70:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f74:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f78:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f7c:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f80:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f84:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f88:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f96:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f9b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fa2:	00 
+  802fa3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802faa:	00 
+  802fab:	89 fb                	mov    %edi,%ebx
+  802fad:	eb 08                	jmp    802fb7 <__udivmoddi4+0x56>
+  802faf:	83 e9 01             	sub    $0x1,%ecx
+  802fb2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fb5:	74 68                	je     80301f <__udivmoddi4+0xbe>
+  802fb7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fbb:	01 c0                	add    %eax,%eax
+  802fbd:	89 c6                	mov    %eax,%esi
+  802fbf:	89 d7                	mov    %edx,%edi
+  802fc1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fc5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fc9:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fcc:	d3 ea                	shr    %cl,%edx
+  802fce:	f6 c1 20             	test   $0x20,%cl
+  802fd1:	74 04                	je     802fd7 <__udivmoddi4+0x76>
+  802fd3:	89 d0                	mov    %edx,%eax
+  802fd5:	31 d2                	xor    %edx,%edx
+  802fd7:	83 e0 01             	and    $0x1,%eax
+  802fda:	89 04 24             	mov    %eax,(%esp)
+  802fdd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fe4:	00 
+  802fe5:	8b 04 24             	mov    (%esp),%eax
+  802fe8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802fec:	09 f0                	or     %esi,%eax
+  802fee:	09 fa                	or     %edi,%edx
+  802ff0:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ff4:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802ff8:	39 f0                	cmp    %esi,%eax
+  802ffa:	89 d5                	mov    %edx,%ebp
+  802ffc:	19 fd                	sbb    %edi,%ebp
+  802ffe:	72 af                	jb     802faf <__udivmoddi4+0x4e>
+  803000:	29 f0                	sub    %esi,%eax
+  803002:	19 fa                	sbb    %edi,%edx
+  803004:	89 cf                	mov    %ecx,%edi
+  803006:	c1 ef 05             	shr    $0x5,%edi
+  803009:	83 e7 01             	and    $0x1,%edi
+  80300c:	89 fe                	mov    %edi,%esi
+  80300e:	83 f6 01             	xor    $0x1,%esi
+  803011:	d3 e6                	shl    %cl,%esi
+  803013:	d3 e7                	shl    %cl,%edi
+  803015:	09 74 24 18          	or     %esi,0x18(%esp)
+  803019:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80301d:	eb 90                	jmp    802faf <__udivmoddi4+0x4e>
+  80301f:	85 db                	test   %ebx,%ebx
+  803021:	74 05                	je     803028 <__udivmoddi4+0xc7>
+  803023:	89 03                	mov    %eax,(%ebx)
+  803025:	89 53 04             	mov    %edx,0x4(%ebx)
+  803028:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80302c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803030:	83 c4 24             	add    $0x24,%esp
+  803033:	5b                   	pop    %ebx
+  803034:	5e                   	pop    %esi
+  803035:	5f                   	pop    %edi
+  803036:	5d                   	pop    %ebp
+  803037:	c3                   	ret
+
+00803038 <__udivdi3>:
+  803038:	83 ec 08             	sub    $0x8,%esp
+  80303b:	6a 00                	push   $0x0
+  80303d:	ff 74 24 1c          	push   0x1c(%esp)
+  803041:	ff 74 24 1c          	push   0x1c(%esp)
+  803045:	ff 74 24 1c          	push   0x1c(%esp)
+  803049:	ff 74 24 1c          	push   0x1c(%esp)
+  80304d:	e8 0f ff ff ff       	call   802f61 <__udivmoddi4>
+  803052:	83 c4 1c             	add    $0x1c,%esp
+  803055:	c3                   	ret
+
+00803056 <__umoddi3>:
+  803056:	83 ec 18             	sub    $0x18,%esp
+  803059:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80305d:	50                   	push   %eax
+  80305e:	ff 74 24 2c          	push   0x2c(%esp)
+  803062:	ff 74 24 2c          	push   0x2c(%esp)
+  803066:	ff 74 24 2c          	push   0x2c(%esp)
+  80306a:	ff 74 24 2c          	push   0x2c(%esp)
+  80306e:	e8 ee fe ff ff       	call   802f61 <__udivmoddi4>
+  803073:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803077:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80307b:	83 c4 2c             	add    $0x2c,%esp
+  80307e:	c3                   	ret
+
+0080307f <__divdi3>:
+  80307f:	53                   	push   %ebx
+  803080:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803084:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803088:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80308c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803090:	85 d2                	test   %edx,%edx
+  803092:	78 12                	js     8030a6 <__divdi3+0x27>
+  803094:	85 db                	test   %ebx,%ebx
+  803096:	78 2e                	js     8030c6 <__divdi3+0x47>
+  803098:	53                   	push   %ebx
+  803099:	51                   	push   %ecx
+  80309a:	52                   	push   %edx
+  80309b:	50                   	push   %eax
+  80309c:	e8 97 ff ff ff       	call   803038 <__udivdi3>
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	eb 1e                	jmp    8030c4 <__divdi3+0x45>
+  8030a6:	f7 d8                	neg    %eax
+  8030a8:	83 d2 00             	adc    $0x0,%edx
+  8030ab:	f7 da                	neg    %edx
+  8030ad:	85 db                	test   %ebx,%ebx
+  8030af:	78 2a                	js     8030db <__divdi3+0x5c>
+  8030b1:	53                   	push   %ebx
+  8030b2:	51                   	push   %ecx
+  8030b3:	52                   	push   %edx
+  8030b4:	50                   	push   %eax
+  8030b5:	e8 7e ff ff ff       	call   803038 <__udivdi3>
+  8030ba:	83 c4 10             	add    $0x10,%esp
+  8030bd:	f7 d8                	neg    %eax
+  8030bf:	83 d2 00             	adc    $0x0,%edx
+  8030c2:	f7 da                	neg    %edx
+  8030c4:	5b                   	pop    %ebx
+  8030c5:	c3                   	ret
+  8030c6:	f7 d9                	neg    %ecx
+  8030c8:	83 d3 00             	adc    $0x0,%ebx
+  8030cb:	f7 db                	neg    %ebx
+  8030cd:	53                   	push   %ebx
+  8030ce:	51                   	push   %ecx
+  8030cf:	52                   	push   %edx
+  8030d0:	50                   	push   %eax
+  8030d1:	e8 62 ff ff ff       	call   803038 <__udivdi3>
+  8030d6:	83 c4 10             	add    $0x10,%esp
+  8030d9:	eb e2                	jmp    8030bd <__divdi3+0x3e>
+  8030db:	f7 d9                	neg    %ecx
+  8030dd:	83 d3 00             	adc    $0x0,%ebx
+  8030e0:	f7 db                	neg    %ebx
+  8030e2:	53                   	push   %ebx
+  8030e3:	51                   	push   %ecx
+  8030e4:	52                   	push   %edx
+  8030e5:	50                   	push   %eax
+  8030e6:	e8 4d ff ff ff       	call   803038 <__udivdi3>
+  8030eb:	83 c4 10             	add    $0x10,%esp
+  8030ee:	eb d4                	jmp    8030c4 <__divdi3+0x45>
+
+008030f0 <__moddi3>:
+  8030f0:	55                   	push   %ebp
+  8030f1:	57                   	push   %edi
+  8030f2:	56                   	push   %esi
+  8030f3:	53                   	push   %ebx
+  8030f4:	83 ec 0c             	sub    $0xc,%esp
+  8030f7:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8030fb:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8030ff:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803103:	89 e9                	mov    %ebp,%ecx
+  803105:	f7 d9                	neg    %ecx
+  803107:	89 d0                	mov    %edx,%eax
+  803109:	83 d0 00             	adc    $0x0,%eax
+  80310c:	f7 d8                	neg    %eax
+  80310e:	0f 49 e9             	cmovns %ecx,%ebp
+  803111:	0f 49 d0             	cmovns %eax,%edx
+  803114:	52                   	push   %edx
+  803115:	55                   	push   %ebp
+  803116:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80311a:	f7 da                	neg    %edx
+  80311c:	89 d8                	mov    %ebx,%eax
+  80311e:	83 d0 00             	adc    $0x0,%eax
+  803121:	f7 d8                	neg    %eax
+  803123:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803128:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80312c:	0f 48 c3             	cmovs  %ebx,%eax
+  80312f:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803133:	ff 74 24 0c          	push   0xc(%esp)
+  803137:	ff 74 24 0c          	push   0xc(%esp)
+  80313b:	e8 16 ff ff ff       	call   803056 <__umoddi3>
+  803140:	83 c4 10             	add    $0x10,%esp
+  803143:	85 db                	test   %ebx,%ebx
+  803145:	78 08                	js     80314f <__moddi3+0x5f>
+  803147:	83 c4 0c             	add    $0xc,%esp
+  80314a:	5b                   	pop    %ebx
+  80314b:	5e                   	pop    %esi
+  80314c:	5f                   	pop    %edi
+  80314d:	5d                   	pop    %ebp
+  80314e:	c3                   	ret
+  80314f:	f7 d8                	neg    %eax
+  803151:	83 d2 00             	adc    $0x0,%edx
+  803154:	f7 da                	neg    %edx
+  803156:	eb ef                	jmp    803147 <__moddi3+0x57>
@@ -0,0 +1,5033 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	cc                   	int3
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800040:	e8 e7 00 00 00       	call   80012c <sys_getenvid>
+  800045:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004a:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800050:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800055:	a3 10 50 80 00       	mov    %eax,0x805010
+  80005a:	85 db                	test   %ebx,%ebx
+  80005c:	7e 07                	jle    800065 <libmain+0x30>
+  80005e:	8b 06                	mov    (%esi),%eax
+  800060:	a3 00 40 80 00       	mov    %eax,0x804000
+  800065:	83 ec 08             	sub    $0x8,%esp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	e8 c4 ff ff ff       	call   800033 <umain>
+  80006f:	e8 0a 00 00 00       	call   80007e <exit>
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007a:	5b                   	pop    %ebx
+  80007b:	5e                   	pop    %esi
+  80007c:	5d                   	pop    %ebp
+  80007d:	c3                   	ret
+
+0080007e <exit>:
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	83 ec 08             	sub    $0x8,%esp
+  800084:	a1 10 50 80 00       	mov    0x805010,%eax
+  800089:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80008f:	85 c0                	test   %eax,%eax
+  800091:	75 14                	jne    8000a7 <exit+0x29>
+  800093:	e8 36 0b 00 00       	call   800bce <close_all>
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	6a 00                	push   $0x0
+  80009d:	e8 49 00 00 00       	call   8000eb <sys_env_destroy>
+  8000a2:	83 c4 10             	add    $0x10,%esp
+  8000a5:	c9                   	leave
+  8000a6:	c3                   	ret
+  8000a7:	e8 ac 07 00 00       	call   800858 <sys_lease_complete>
+  8000ac:	eb e5                	jmp    800093 <exit+0x15>
+
+008000ae <sys_cputs>:
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	57                   	push   %edi
+  8000b2:	56                   	push   %esi
+  8000b3:	53                   	push   %ebx
+  8000b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bf:	89 c3                	mov    %eax,%ebx
+  8000c1:	89 c7                	mov    %eax,%edi
+  8000c3:	89 c6                	mov    %eax,%esi
+  8000c5:	cd 30                	int    $0x30
+  8000c7:	5b                   	pop    %ebx
+  8000c8:	5e                   	pop    %esi
+  8000c9:	5f                   	pop    %edi
+  8000ca:	5d                   	pop    %ebp
+  8000cb:	c3                   	ret
+
+008000cc <sys_cgetc>:
+  8000cc:	55                   	push   %ebp
+  8000cd:	89 e5                	mov    %esp,%ebp
+  8000cf:	57                   	push   %edi
+  8000d0:	56                   	push   %esi
+  8000d1:	53                   	push   %ebx
+  8000d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000dc:	89 d1                	mov    %edx,%ecx
+  8000de:	89 d3                	mov    %edx,%ebx
+  8000e0:	89 d7                	mov    %edx,%edi
+  8000e2:	89 d6                	mov    %edx,%esi
+  8000e4:	cd 30                	int    $0x30
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <sys_env_destroy>:
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 0c             	sub    $0xc,%esp
+  8000f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800101:	89 cb                	mov    %ecx,%ebx
+  800103:	89 cf                	mov    %ecx,%edi
+  800105:	89 ce                	mov    %ecx,%esi
+  800107:	cd 30                	int    $0x30
+  800109:	85 c0                	test   %eax,%eax
+  80010b:	7f 08                	jg     800115 <sys_env_destroy+0x2a>
+  80010d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800110:	5b                   	pop    %ebx
+  800111:	5e                   	pop    %esi
+  800112:	5f                   	pop    %edi
+  800113:	5d                   	pop    %ebp
+  800114:	c3                   	ret
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	50                   	push   %eax
+  800119:	6a 03                	push   $0x3
+  80011b:	68 6a 31 80 00       	push   $0x80316a
+  800120:	6a 24                	push   $0x24
+  800122:	68 87 31 80 00       	push   $0x803187
+  800127:	e8 37 20 00 00       	call   802163 <_panic>
+
+0080012c <sys_getenvid>:
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	57                   	push   %edi
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+  800132:	ba 00 00 00 00       	mov    $0x0,%edx
+  800137:	b8 02 00 00 00       	mov    $0x2,%eax
+  80013c:	89 d1                	mov    %edx,%ecx
+  80013e:	89 d3                	mov    %edx,%ebx
+  800140:	89 d7                	mov    %edx,%edi
+  800142:	89 d6                	mov    %edx,%esi
+  800144:	cd 30                	int    $0x30
+  800146:	5b                   	pop    %ebx
+  800147:	5e                   	pop    %esi
+  800148:	5f                   	pop    %edi
+  800149:	5d                   	pop    %ebp
+  80014a:	c3                   	ret
+
+0080014b <sys_yield>:
+  80014b:	55                   	push   %ebp
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	57                   	push   %edi
+  80014f:	56                   	push   %esi
+  800150:	53                   	push   %ebx
+  800151:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800158:	74 26                	je     800180 <sys_yield+0x35>
+  80015a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800164:	89 d1                	mov    %edx,%ecx
+  800166:	89 d3                	mov    %edx,%ebx
+  800168:	89 d7                	mov    %edx,%edi
+  80016a:	6a 00                	push   $0x0
+  80016c:	55                   	push   %ebp
+  80016d:	89 e5                	mov    %esp,%ebp
+  80016f:	8d 35 77 01 80 00    	lea    0x800177,%esi
+  800175:	0f 34                	sysenter
+  800177:	5d                   	pop    %ebp
+  800178:	83 c4 04             	add    $0x4,%esp
+  80017b:	5b                   	pop    %ebx
+  80017c:	5e                   	pop    %esi
+  80017d:	5f                   	pop    %edi
+  80017e:	5d                   	pop    %ebp
+  80017f:	c3                   	ret
+  800180:	ba 00 00 00 00       	mov    $0x0,%edx
+  800185:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80018a:	89 d1                	mov    %edx,%ecx
+  80018c:	89 d3                	mov    %edx,%ebx
+  80018e:	89 d7                	mov    %edx,%edi
+  800190:	89 d6                	mov    %edx,%esi
+  800192:	cd 30                	int    $0x30
+  800194:	eb e5                	jmp    80017b <sys_yield+0x30>
+
+00800196 <sys_page_alloc>:
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	57                   	push   %edi
+  80019a:	56                   	push   %esi
+  80019b:	53                   	push   %ebx
+  80019c:	83 ec 0c             	sub    $0xc,%esp
+  80019f:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001aa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b2:	89 f7                	mov    %esi,%edi
+  8001b4:	cd 30                	int    $0x30
+  8001b6:	85 c0                	test   %eax,%eax
+  8001b8:	7f 08                	jg     8001c2 <sys_page_alloc+0x2c>
+  8001ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bd:	5b                   	pop    %ebx
+  8001be:	5e                   	pop    %esi
+  8001bf:	5f                   	pop    %edi
+  8001c0:	5d                   	pop    %ebp
+  8001c1:	c3                   	ret
+  8001c2:	83 ec 0c             	sub    $0xc,%esp
+  8001c5:	50                   	push   %eax
+  8001c6:	6a 04                	push   $0x4
+  8001c8:	68 6a 31 80 00       	push   $0x80316a
+  8001cd:	6a 24                	push   $0x24
+  8001cf:	68 87 31 80 00       	push   $0x803187
+  8001d4:	e8 8a 1f 00 00       	call   802163 <_panic>
+
+008001d9 <sys_page_map>:
+  8001d9:	55                   	push   %ebp
+  8001da:	89 e5                	mov    %esp,%ebp
+  8001dc:	57                   	push   %edi
+  8001dd:	56                   	push   %esi
+  8001de:	53                   	push   %ebx
+  8001df:	83 ec 0c             	sub    $0xc,%esp
+  8001e2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8001e9:	74 33                	je     80021e <sys_page_map+0x45>
+  8001eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001fc:	ff 75 18             	push   0x18(%ebp)
+  8001ff:	55                   	push   %ebp
+  800200:	89 e5                	mov    %esp,%ebp
+  800202:	8d 35 0a 02 80 00    	lea    0x80020a,%esi
+  800208:	0f 34                	sysenter
+  80020a:	5d                   	pop    %ebp
+  80020b:	83 c4 04             	add    $0x4,%esp
+  80020e:	89 c2                	mov    %eax,%edx
+  800210:	85 c0                	test   %eax,%eax
+  800212:	7f 3d                	jg     800251 <sys_page_map+0x78>
+  800214:	89 d0                	mov    %edx,%eax
+  800216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800219:	5b                   	pop    %ebx
+  80021a:	5e                   	pop    %esi
+  80021b:	5f                   	pop    %edi
+  80021c:	5d                   	pop    %ebp
+  80021d:	c3                   	ret
+  80021e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800223:	8b 55 08             	mov    0x8(%ebp),%edx
+  800226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800229:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80022c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80022f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800232:	cd 30                	int    $0x30
+  800234:	89 c2                	mov    %eax,%edx
+  800236:	85 c0                	test   %eax,%eax
+  800238:	7e da                	jle    800214 <sys_page_map+0x3b>
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	50                   	push   %eax
+  80023e:	6a 05                	push   $0x5
+  800240:	68 6a 31 80 00       	push   $0x80316a
+  800245:	6a 24                	push   $0x24
+  800247:	68 87 31 80 00       	push   $0x803187
+  80024c:	e8 12 1f 00 00       	call   802163 <_panic>
+  800251:	83 ec 0c             	sub    $0xc,%esp
+  800254:	50                   	push   %eax
+  800255:	6a 05                	push   $0x5
+  800257:	68 6a 31 80 00       	push   $0x80316a
+  80025c:	6a 48                	push   $0x48
+  80025e:	68 87 31 80 00       	push   $0x803187
+  800263:	e8 fb 1e 00 00       	call   802163 <_panic>
+
+00800268 <sys_page_unmap>:
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	57                   	push   %edi
+  80026c:	56                   	push   %esi
+  80026d:	53                   	push   %ebx
+  80026e:	83 ec 0c             	sub    $0xc,%esp
+  800271:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800276:	8b 55 08             	mov    0x8(%ebp),%edx
+  800279:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800281:	89 df                	mov    %ebx,%edi
+  800283:	89 de                	mov    %ebx,%esi
+  800285:	cd 30                	int    $0x30
+  800287:	85 c0                	test   %eax,%eax
+  800289:	7f 08                	jg     800293 <sys_page_unmap+0x2b>
+  80028b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028e:	5b                   	pop    %ebx
+  80028f:	5e                   	pop    %esi
+  800290:	5f                   	pop    %edi
+  800291:	5d                   	pop    %ebp
+  800292:	c3                   	ret
+  800293:	83 ec 0c             	sub    $0xc,%esp
+  800296:	50                   	push   %eax
+  800297:	6a 06                	push   $0x6
+  800299:	68 6a 31 80 00       	push   $0x80316a
+  80029e:	6a 24                	push   $0x24
+  8002a0:	68 87 31 80 00       	push   $0x803187
+  8002a5:	e8 b9 1e 00 00       	call   802163 <_panic>
+
+008002aa <sys_fork>:
+  8002aa:	55                   	push   %ebp
+  8002ab:	89 e5                	mov    %esp,%ebp
+  8002ad:	57                   	push   %edi
+  8002ae:	56                   	push   %esi
+  8002af:	53                   	push   %ebx
+  8002b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002ba:	89 d1                	mov    %edx,%ecx
+  8002bc:	89 d3                	mov    %edx,%ebx
+  8002be:	89 d7                	mov    %edx,%edi
+  8002c0:	89 d6                	mov    %edx,%esi
+  8002c2:	cd 30                	int    $0x30
+  8002c4:	5b                   	pop    %ebx
+  8002c5:	5e                   	pop    %esi
+  8002c6:	5f                   	pop    %edi
+  8002c7:	5d                   	pop    %ebp
+  8002c8:	c3                   	ret
+
+008002c9 <sys_env_set_status>:
+  8002c9:	55                   	push   %ebp
+  8002ca:	89 e5                	mov    %esp,%ebp
+  8002cc:	57                   	push   %edi
+  8002cd:	56                   	push   %esi
+  8002ce:	53                   	push   %ebx
+  8002cf:	83 ec 0c             	sub    $0xc,%esp
+  8002d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002dd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002e2:	89 df                	mov    %ebx,%edi
+  8002e4:	89 de                	mov    %ebx,%esi
+  8002e6:	cd 30                	int    $0x30
+  8002e8:	85 c0                	test   %eax,%eax
+  8002ea:	7f 08                	jg     8002f4 <sys_env_set_status+0x2b>
+  8002ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ef:	5b                   	pop    %ebx
+  8002f0:	5e                   	pop    %esi
+  8002f1:	5f                   	pop    %edi
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	c3                   	ret
+  8002f4:	83 ec 0c             	sub    $0xc,%esp
+  8002f7:	50                   	push   %eax
+  8002f8:	6a 08                	push   $0x8
+  8002fa:	68 6a 31 80 00       	push   $0x80316a
+  8002ff:	6a 24                	push   $0x24
+  800301:	68 87 31 80 00       	push   $0x803187
+  800306:	e8 58 1e 00 00       	call   802163 <_panic>
+
+0080030b <sys_env_set_trapframe>:
+  80030b:	55                   	push   %ebp
+  80030c:	89 e5                	mov    %esp,%ebp
+  80030e:	57                   	push   %edi
+  80030f:	56                   	push   %esi
+  800310:	53                   	push   %ebx
+  800311:	83 ec 0c             	sub    $0xc,%esp
+  800314:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800319:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80031f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800324:	89 df                	mov    %ebx,%edi
+  800326:	89 de                	mov    %ebx,%esi
+  800328:	cd 30                	int    $0x30
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	7f 08                	jg     800336 <sys_env_set_trapframe+0x2b>
+  80032e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800331:	5b                   	pop    %ebx
+  800332:	5e                   	pop    %esi
+  800333:	5f                   	pop    %edi
+  800334:	5d                   	pop    %ebp
+  800335:	c3                   	ret
+  800336:	83 ec 0c             	sub    $0xc,%esp
+  800339:	50                   	push   %eax
+  80033a:	6a 09                	push   $0x9
+  80033c:	68 6a 31 80 00       	push   $0x80316a
+  800341:	6a 24                	push   $0x24
+  800343:	68 87 31 80 00       	push   $0x803187
+  800348:	e8 16 1e 00 00       	call   802163 <_panic>
+
+0080034d <sys_env_set_cow>:
+  80034d:	55                   	push   %ebp
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	57                   	push   %edi
+  800351:	56                   	push   %esi
+  800352:	53                   	push   %ebx
+  800353:	83 ec 0c             	sub    $0xc,%esp
+  800356:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80035b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800361:	b8 20 00 00 00       	mov    $0x20,%eax
+  800366:	89 df                	mov    %ebx,%edi
+  800368:	89 de                	mov    %ebx,%esi
+  80036a:	cd 30                	int    $0x30
+  80036c:	85 c0                	test   %eax,%eax
+  80036e:	7f 08                	jg     800378 <sys_env_set_cow+0x2b>
+  800370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800373:	5b                   	pop    %ebx
+  800374:	5e                   	pop    %esi
+  800375:	5f                   	pop    %edi
+  800376:	5d                   	pop    %ebp
+  800377:	c3                   	ret
+  800378:	83 ec 0c             	sub    $0xc,%esp
+  80037b:	50                   	push   %eax
+  80037c:	6a 20                	push   $0x20
+  80037e:	68 6a 31 80 00       	push   $0x80316a
+  800383:	6a 24                	push   $0x24
+  800385:	68 87 31 80 00       	push   $0x803187
+  80038a:	e8 d4 1d 00 00       	call   802163 <_panic>
+
+0080038f <sys_env_service>:
+  80038f:	55                   	push   %ebp
+  800390:	89 e5                	mov    %esp,%ebp
+  800392:	57                   	push   %edi
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+  800395:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80039a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80039d:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003a2:	89 cb                	mov    %ecx,%ebx
+  8003a4:	89 cf                	mov    %ecx,%edi
+  8003a6:	89 ce                	mov    %ecx,%esi
+  8003a8:	cd 30                	int    $0x30
+  8003aa:	5b                   	pop    %ebx
+  8003ab:	5e                   	pop    %esi
+  8003ac:	5f                   	pop    %edi
+  8003ad:	5d                   	pop    %ebp
+  8003ae:	c3                   	ret
+
+008003af <sys_env_set_pgfault_upcall>:
+  8003af:	55                   	push   %ebp
+  8003b0:	89 e5                	mov    %esp,%ebp
+  8003b2:	57                   	push   %edi
+  8003b3:	56                   	push   %esi
+  8003b4:	53                   	push   %ebx
+  8003b5:	83 ec 0c             	sub    $0xc,%esp
+  8003b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003c8:	89 df                	mov    %ebx,%edi
+  8003ca:	89 de                	mov    %ebx,%esi
+  8003cc:	cd 30                	int    $0x30
+  8003ce:	85 c0                	test   %eax,%eax
+  8003d0:	7f 08                	jg     8003da <sys_env_set_pgfault_upcall+0x2b>
+  8003d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5f                   	pop    %edi
+  8003d8:	5d                   	pop    %ebp
+  8003d9:	c3                   	ret
+  8003da:	83 ec 0c             	sub    $0xc,%esp
+  8003dd:	50                   	push   %eax
+  8003de:	6a 0a                	push   $0xa
+  8003e0:	68 6a 31 80 00       	push   $0x80316a
+  8003e5:	6a 24                	push   $0x24
+  8003e7:	68 87 31 80 00       	push   $0x803187
+  8003ec:	e8 72 1d 00 00       	call   802163 <_panic>
+
+008003f1 <sys_ipc_try_send>:
+  8003f1:	55                   	push   %ebp
+  8003f2:	89 e5                	mov    %esp,%ebp
+  8003f4:	57                   	push   %edi
+  8003f5:	56                   	push   %esi
+  8003f6:	53                   	push   %ebx
+  8003f7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8003fe:	74 27                	je     800427 <sys_ipc_try_send+0x36>
+  800400:	8b 55 08             	mov    0x8(%ebp),%edx
+  800403:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800406:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80040b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80040e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800411:	6a 00                	push   $0x0
+  800413:	55                   	push   %ebp
+  800414:	89 e5                	mov    %esp,%ebp
+  800416:	8d 35 1e 04 80 00    	lea    0x80041e,%esi
+  80041c:	0f 34                	sysenter
+  80041e:	5d                   	pop    %ebp
+  80041f:	83 c4 04             	add    $0x4,%esp
+  800422:	5b                   	pop    %ebx
+  800423:	5e                   	pop    %esi
+  800424:	5f                   	pop    %edi
+  800425:	5d                   	pop    %ebp
+  800426:	c3                   	ret
+  800427:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80042c:	be 00 00 00 00       	mov    $0x0,%esi
+  800431:	8b 55 08             	mov    0x8(%ebp),%edx
+  800434:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800437:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80043a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80043d:	cd 30                	int    $0x30
+  80043f:	eb e1                	jmp    800422 <sys_ipc_try_send+0x31>
+
+00800441 <sys_ipc_recv>:
+  800441:	55                   	push   %ebp
+  800442:	89 e5                	mov    %esp,%ebp
+  800444:	57                   	push   %edi
+  800445:	56                   	push   %esi
+  800446:	53                   	push   %ebx
+  800447:	83 ec 0c             	sub    $0xc,%esp
+  80044a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800451:	74 32                	je     800485 <sys_ipc_recv+0x44>
+  800453:	8b 55 08             	mov    0x8(%ebp),%edx
+  800456:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80045b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800460:	89 cb                	mov    %ecx,%ebx
+  800462:	89 cf                	mov    %ecx,%edi
+  800464:	6a 00                	push   $0x0
+  800466:	55                   	push   %ebp
+  800467:	89 e5                	mov    %esp,%ebp
+  800469:	8d 35 71 04 80 00    	lea    0x800471,%esi
+  80046f:	0f 34                	sysenter
+  800471:	5d                   	pop    %ebp
+  800472:	83 c4 04             	add    $0x4,%esp
+  800475:	89 c2                	mov    %eax,%edx
+  800477:	85 c0                	test   %eax,%eax
+  800479:	7f 3c                	jg     8004b7 <sys_ipc_recv+0x76>
+  80047b:	89 d0                	mov    %edx,%eax
+  80047d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800480:	5b                   	pop    %ebx
+  800481:	5e                   	pop    %esi
+  800482:	5f                   	pop    %edi
+  800483:	5d                   	pop    %ebp
+  800484:	c3                   	ret
+  800485:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80048f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800492:	89 cb                	mov    %ecx,%ebx
+  800494:	89 cf                	mov    %ecx,%edi
+  800496:	89 ce                	mov    %ecx,%esi
+  800498:	cd 30                	int    $0x30
+  80049a:	89 c2                	mov    %eax,%edx
+  80049c:	85 c0                	test   %eax,%eax
+  80049e:	7e db                	jle    80047b <sys_ipc_recv+0x3a>
+  8004a0:	83 ec 0c             	sub    $0xc,%esp
+  8004a3:	50                   	push   %eax
+  8004a4:	6a 0d                	push   $0xd
+  8004a6:	68 6a 31 80 00       	push   $0x80316a
+  8004ab:	6a 24                	push   $0x24
+  8004ad:	68 87 31 80 00       	push   $0x803187
+  8004b2:	e8 ac 1c 00 00       	call   802163 <_panic>
+  8004b7:	83 ec 0c             	sub    $0xc,%esp
+  8004ba:	50                   	push   %eax
+  8004bb:	6a 0d                	push   $0xd
+  8004bd:	68 6a 31 80 00       	push   $0x80316a
+  8004c2:	6a 48                	push   $0x48
+  8004c4:	68 87 31 80 00       	push   $0x803187
+  8004c9:	e8 95 1c 00 00       	call   802163 <_panic>
+
+008004ce <sys_ipc_send>:
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	57                   	push   %edi
+  8004d2:	56                   	push   %esi
+  8004d3:	53                   	push   %ebx
+  8004d4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004db:	74 27                	je     800504 <sys_ipc_send+0x36>
+  8004dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004ee:	6a 00                	push   $0x0
+  8004f0:	55                   	push   %ebp
+  8004f1:	89 e5                	mov    %esp,%ebp
+  8004f3:	8d 35 fb 04 80 00    	lea    0x8004fb,%esi
+  8004f9:	0f 34                	sysenter
+  8004fb:	5d                   	pop    %ebp
+  8004fc:	83 c4 04             	add    $0x4,%esp
+  8004ff:	5b                   	pop    %ebx
+  800500:	5e                   	pop    %esi
+  800501:	5f                   	pop    %edi
+  800502:	5d                   	pop    %ebp
+  800503:	c3                   	ret
+  800504:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800509:	be 00 00 00 00       	mov    $0x0,%esi
+  80050e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800511:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800517:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80051a:	cd 30                	int    $0x30
+  80051c:	eb e1                	jmp    8004ff <sys_ipc_send+0x31>
+
+0080051e <sys_ipc_call>:
+  80051e:	55                   	push   %ebp
+  80051f:	89 e5                	mov    %esp,%ebp
+  800521:	57                   	push   %edi
+  800522:	56                   	push   %esi
+  800523:	53                   	push   %ebx
+  800524:	8b 55 08             	mov    0x8(%ebp),%edx
+  800527:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80052f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800532:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800535:	8b 75 18             	mov    0x18(%ebp),%esi
+  800538:	cd 30                	int    $0x30
+  80053a:	5b                   	pop    %ebx
+  80053b:	5e                   	pop    %esi
+  80053c:	5f                   	pop    %edi
+  80053d:	5d                   	pop    %ebp
+  80053e:	c3                   	ret
+
+0080053f <sys_ipc_reply_recv>:
+  80053f:	55                   	push   %ebp
+  800540:	89 e5                	mov    %esp,%ebp
+  800542:	57                   	push   %edi
+  800543:	56                   	push   %esi
+  800544:	53                   	push   %ebx
+  800545:	8b 55 08             	mov    0x8(%ebp),%edx
+  800548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80054b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800550:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800553:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800556:	8b 75 18             	mov    0x18(%ebp),%esi
+  800559:	cd 30                	int    $0x30
+  80055b:	5b                   	pop    %ebx
+  80055c:	5e                   	pop    %esi
+  80055d:	5f                   	pop    %edi
+  80055e:	5d                   	pop    %ebp
+  80055f:	c3                   	ret
+
+00800560 <sys_time_msec>:
+  800560:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  800565:	85 c0                	test   %eax,%eax
+  800567:	75 06                	jne    80056f <sys_time_msec+0xf>
+  800569:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80056e:	c3                   	ret
+  80056f:	55                   	push   %ebp
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	57                   	push   %edi
+  800573:	56                   	push   %esi
+  800574:	53                   	push   %ebx
+  800575:	83 ec 0c             	sub    $0xc,%esp
+  800578:	0f 31                	rdtsc
+  80057a:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800580:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  800586:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80058c:	29 c8                	sub    %ecx,%eax
+  80058e:	19 da                	sbb    %ebx,%edx
+  800590:	bf 00 00 00 00       	mov    $0x0,%edi
+  800595:	57                   	push   %edi
+  800596:	56                   	push   %esi
+  800597:	52                   	push   %edx
+  800598:	50                   	push   %eax
+  800599:	e8 95 2a 00 00       	call   803033 <__udivdi3>
+  80059e:	83 c4 10             	add    $0x10,%esp
+  8005a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a4:	5b                   	pop    %ebx
+  8005a5:	5e                   	pop    %esi
+  8005a6:	5f                   	pop    %edi
+  8005a7:	5d                   	pop    %ebp
+  8005a8:	c3                   	ret
+
+008005a9 <sys_env_swap>:
+  8005a9:	55                   	push   %ebp
+  8005aa:	89 e5                	mov    %esp,%ebp
+  8005ac:	57                   	push   %edi
+  8005ad:	56                   	push   %esi
+  8005ae:	53                   	push   %ebx
+  8005af:	83 ec 0c             	sub    $0xc,%esp
+  8005b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ba:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005bf:	89 cb                	mov    %ecx,%ebx
+  8005c1:	89 cf                	mov    %ecx,%edi
+  8005c3:	89 ce                	mov    %ecx,%esi
+  8005c5:	cd 30                	int    $0x30
+  8005c7:	85 c0                	test   %eax,%eax
+  8005c9:	7f 08                	jg     8005d3 <sys_env_swap+0x2a>
+  8005cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ce:	5b                   	pop    %ebx
+  8005cf:	5e                   	pop    %esi
+  8005d0:	5f                   	pop    %edi
+  8005d1:	5d                   	pop    %ebp
+  8005d2:	c3                   	ret
+  8005d3:	83 ec 0c             	sub    $0xc,%esp
+  8005d6:	50                   	push   %eax
+  8005d7:	6a 12                	push   $0x12
+  8005d9:	68 6a 31 80 00       	push   $0x80316a
+  8005de:	6a 24                	push   $0x24
+  8005e0:	68 87 31 80 00       	push   $0x803187
+  8005e5:	e8 79 1b 00 00       	call   802163 <_panic>
+
+008005ea <sys_net_try_send>:
+  8005ea:	55                   	push   %ebp
+  8005eb:	89 e5                	mov    %esp,%ebp
+  8005ed:	57                   	push   %edi
+  8005ee:	56                   	push   %esi
+  8005ef:	53                   	push   %ebx
+  8005f0:	83 ec 0c             	sub    $0xc,%esp
+  8005f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005fe:	b8 13 00 00 00       	mov    $0x13,%eax
+  800603:	89 df                	mov    %ebx,%edi
+  800605:	89 de                	mov    %ebx,%esi
+  800607:	cd 30                	int    $0x30
+  800609:	85 c0                	test   %eax,%eax
+  80060b:	7f 08                	jg     800615 <sys_net_try_send+0x2b>
+  80060d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800610:	5b                   	pop    %ebx
+  800611:	5e                   	pop    %esi
+  800612:	5f                   	pop    %edi
+  800613:	5d                   	pop    %ebp
+  800614:	c3                   	ret
+  800615:	83 ec 0c             	sub    $0xc,%esp
+  800618:	50                   	push   %eax
+  800619:	6a 13                	push   $0x13
+  80061b:	68 6a 31 80 00       	push   $0x80316a
+  800620:	6a 24                	push   $0x24
+  800622:	68 87 31 80 00       	push   $0x803187
+  800627:	e8 37 1b 00 00       	call   802163 <_panic>
+
+0080062c <sys_net_try_receive>:
+  80062c:	55                   	push   %ebp
+  80062d:	89 e5                	mov    %esp,%ebp
+  80062f:	57                   	push   %edi
+  800630:	56                   	push   %esi
+  800631:	53                   	push   %ebx
+  800632:	83 ec 0c             	sub    $0xc,%esp
+  800635:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80063a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80063d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800640:	b8 14 00 00 00       	mov    $0x14,%eax
+  800645:	89 df                	mov    %ebx,%edi
+  800647:	89 de                	mov    %ebx,%esi
+  800649:	cd 30                	int    $0x30
+  80064b:	85 c0                	test   %eax,%eax
+  80064d:	7f 08                	jg     800657 <sys_net_try_receive+0x2b>
+  80064f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800652:	5b                   	pop    %ebx
+  800653:	5e                   	pop    %esi
+  800654:	5f                   	pop    %edi
+  800655:	5d                   	pop    %ebp
+  800656:	c3                   	ret
+  800657:	83 ec 0c             	sub    $0xc,%esp
+  80065a:	50                   	push   %eax
+  80065b:	6a 14                	push   $0x14
+  80065d:	68 6a 31 80 00       	push   $0x80316a
+  800662:	6a 24                	push   $0x24
+  800664:	68 87 31 80 00       	push   $0x803187
+  800669:	e8 f5 1a 00 00       	call   802163 <_panic>
+
+0080066e <sys_net_recv_page>:
+  80066e:	55                   	push   %ebp
+  80066f:	89 e5                	mov    %esp,%ebp
+  800671:	57                   	push   %edi
+  800672:	56                   	push   %esi
+  800673:	53                   	push   %ebx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800679:	8b 55 08             	mov    0x8(%ebp),%edx
+  80067c:	b8 27 00 00 00       	mov    $0x27,%eax
+  800681:	89 cb                	mov    %ecx,%ebx
+  800683:	89 cf                	mov    %ecx,%edi
+  800685:	89 ce                	mov    %ecx,%esi
+  800687:	cd 30                	int    $0x30
+  800689:	5b                   	pop    %ebx
+  80068a:	5e                   	pop    %esi
+  80068b:	5f                   	pop    %edi
+  80068c:	5d                   	pop    %ebp
+  80068d:	c3                   	ret
+
+0080068e <sys_net_wait>:
+  80068e:	55                   	push   %ebp
+  80068f:	89 e5                	mov    %esp,%ebp
+  800691:	57                   	push   %edi
+  800692:	56                   	push   %esi
+  800693:	53                   	push   %ebx
+  800694:	ba 00 00 00 00       	mov    $0x0,%edx
+  800699:	b8 26 00 00 00       	mov    $0x26,%eax
+  80069e:	89 d1                	mov    %edx,%ecx
+  8006a0:	89 d3                	mov    %edx,%ebx
+  8006a2:	89 d7                	mov    %edx,%edi
+  8006a4:	89 d6                	mov    %edx,%esi
+  8006a6:	cd 30                	int    $0x30
+  8006a8:	5b                   	pop    %ebx
+  8006a9:	5e                   	pop    %esi
+  8006aa:	5f                   	pop    %edi
+  8006ab:	5d                   	pop    %ebp
+  8006ac:	c3                   	ret
+
+008006ad <sys_get_mac>:
+  8006ad:	55                   	push   %ebp
+  8006ae:	89 e5                	mov    %esp,%ebp
+  8006b0:	57                   	push   %edi
+  8006b1:	56                   	push   %esi
+  8006b2:	53                   	push   %ebx
+  8006b3:	83 ec 0c             	sub    $0xc,%esp
+  8006b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006c6:	89 df                	mov    %ebx,%edi
+  8006c8:	89 de                	mov    %ebx,%esi
+  8006ca:	cd 30                	int    $0x30
+  8006cc:	85 c0                	test   %eax,%eax
+  8006ce:	7f 08                	jg     8006d8 <sys_get_mac+0x2b>
+  8006d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d3:	5b                   	pop    %ebx
+  8006d4:	5e                   	pop    %esi
+  8006d5:	5f                   	pop    %edi
+  8006d6:	5d                   	pop    %ebp
+  8006d7:	c3                   	ret
+  8006d8:	83 ec 0c             	sub    $0xc,%esp
+  8006db:	50                   	push   %eax
+  8006dc:	6a 15                	push   $0x15
+  8006de:	68 6a 31 80 00       	push   $0x80316a
+  8006e3:	6a 24                	push   $0x24
+  8006e5:	68 87 31 80 00       	push   $0x803187
+  8006ea:	e8 74 1a 00 00       	call   802163 <_panic>
+
+008006ef <sys_env_lease>:
+  8006ef:	55                   	push   %ebp
+  8006f0:	89 e5                	mov    %esp,%ebp
+  8006f2:	57                   	push   %edi
+  8006f3:	56                   	push   %esi
+  8006f4:	53                   	push   %ebx
+  8006f5:	83 ec 0c             	sub    $0xc,%esp
+  8006f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800700:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800703:	b8 16 00 00 00       	mov    $0x16,%eax
+  800708:	89 df                	mov    %ebx,%edi
+  80070a:	89 de                	mov    %ebx,%esi
+  80070c:	cd 30                	int    $0x30
+  80070e:	85 c0                	test   %eax,%eax
+  800710:	7f 08                	jg     80071a <sys_env_lease+0x2b>
+  800712:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800715:	5b                   	pop    %ebx
+  800716:	5e                   	pop    %esi
+  800717:	5f                   	pop    %edi
+  800718:	5d                   	pop    %ebp
+  800719:	c3                   	ret
+  80071a:	83 ec 0c             	sub    $0xc,%esp
+  80071d:	50                   	push   %eax
+  80071e:	6a 16                	push   $0x16
+  800720:	68 6a 31 80 00       	push   $0x80316a
+  800725:	6a 24                	push   $0x24
+  800727:	68 87 31 80 00       	push   $0x803187
+  80072c:	e8 32 1a 00 00       	call   802163 <_panic>
+
+00800731 <sys_copy_mem>:
+  800731:	55                   	push   %ebp
+  800732:	89 e5                	mov    %esp,%ebp
+  800734:	57                   	push   %edi
+  800735:	56                   	push   %esi
+  800736:	53                   	push   %ebx
+  800737:	83 ec 0c             	sub    $0xc,%esp
+  80073a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80073d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800740:	b8 17 00 00 00       	mov    $0x17,%eax
+  800745:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800748:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80074b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80074e:	cd 30                	int    $0x30
+  800750:	85 c0                	test   %eax,%eax
+  800752:	7f 08                	jg     80075c <sys_copy_mem+0x2b>
+  800754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800757:	5b                   	pop    %ebx
+  800758:	5e                   	pop    %esi
+  800759:	5f                   	pop    %edi
+  80075a:	5d                   	pop    %ebp
+  80075b:	c3                   	ret
+  80075c:	83 ec 0c             	sub    $0xc,%esp
+  80075f:	50                   	push   %eax
+  800760:	6a 17                	push   $0x17
+  800762:	68 6a 31 80 00       	push   $0x80316a
+  800767:	6a 24                	push   $0x24
+  800769:	68 87 31 80 00       	push   $0x803187
+  80076e:	e8 f0 19 00 00       	call   802163 <_panic>
+
+00800773 <sys_get_perms>:
+  800773:	55                   	push   %ebp
+  800774:	89 e5                	mov    %esp,%ebp
+  800776:	57                   	push   %edi
+  800777:	56                   	push   %esi
+  800778:	53                   	push   %ebx
+  800779:	83 ec 0c             	sub    $0xc,%esp
+  80077c:	be 00 00 00 00       	mov    $0x0,%esi
+  800781:	8b 55 08             	mov    0x8(%ebp),%edx
+  800784:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800787:	b8 18 00 00 00       	mov    $0x18,%eax
+  80078c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80078f:	89 f7                	mov    %esi,%edi
+  800791:	cd 30                	int    $0x30
+  800793:	85 c0                	test   %eax,%eax
+  800795:	7f 08                	jg     80079f <sys_get_perms+0x2c>
+  800797:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80079a:	5b                   	pop    %ebx
+  80079b:	5e                   	pop    %esi
+  80079c:	5f                   	pop    %edi
+  80079d:	5d                   	pop    %ebp
+  80079e:	c3                   	ret
+  80079f:	83 ec 0c             	sub    $0xc,%esp
+  8007a2:	50                   	push   %eax
+  8007a3:	6a 18                	push   $0x18
+  8007a5:	68 6a 31 80 00       	push   $0x80316a
+  8007aa:	6a 24                	push   $0x24
+  8007ac:	68 87 31 80 00       	push   $0x803187
+  8007b1:	e8 ad 19 00 00       	call   802163 <_panic>
+
+008007b6 <sys_env_unsuspend>:
+  8007b6:	55                   	push   %ebp
+  8007b7:	89 e5                	mov    %esp,%ebp
+  8007b9:	57                   	push   %edi
+  8007ba:	56                   	push   %esi
+  8007bb:	53                   	push   %ebx
+  8007bc:	83 ec 0c             	sub    $0xc,%esp
+  8007bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8007c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007ca:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007d2:	89 f7                	mov    %esi,%edi
+  8007d4:	cd 30                	int    $0x30
+  8007d6:	85 c0                	test   %eax,%eax
+  8007d8:	7f 08                	jg     8007e2 <sys_env_unsuspend+0x2c>
+  8007da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007dd:	5b                   	pop    %ebx
+  8007de:	5e                   	pop    %esi
+  8007df:	5f                   	pop    %edi
+  8007e0:	5d                   	pop    %ebp
+  8007e1:	c3                   	ret
+  8007e2:	83 ec 0c             	sub    $0xc,%esp
+  8007e5:	50                   	push   %eax
+  8007e6:	6a 19                	push   $0x19
+  8007e8:	68 6a 31 80 00       	push   $0x80316a
+  8007ed:	6a 24                	push   $0x24
+  8007ef:	68 87 31 80 00       	push   $0x803187
+  8007f4:	e8 6a 19 00 00       	call   802163 <_panic>
+
+008007f9 <sys_migrate>:
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	57                   	push   %edi
+  8007fd:	56                   	push   %esi
+  8007fe:	53                   	push   %ebx
+  8007ff:	83 ec 0c             	sub    $0xc,%esp
+  800802:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800807:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80080d:	76 11                	jbe    800820 <sys_migrate+0x27>
+  80080f:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800814:	0f b6 08             	movzbl (%eax),%ecx
+  800817:	05 00 10 00 00       	add    $0x1000,%eax
+  80081c:	39 d0                	cmp    %edx,%eax
+  80081e:	72 f4                	jb     800814 <sys_migrate+0x1b>
+  800820:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800825:	8b 55 08             	mov    0x8(%ebp),%edx
+  800828:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80082d:	89 cb                	mov    %ecx,%ebx
+  80082f:	89 cf                	mov    %ecx,%edi
+  800831:	89 ce                	mov    %ecx,%esi
+  800833:	cd 30                	int    $0x30
+  800835:	85 c0                	test   %eax,%eax
+  800837:	7f 08                	jg     800841 <sys_migrate+0x48>
+  800839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80083c:	5b                   	pop    %ebx
+  80083d:	5e                   	pop    %esi
+  80083e:	5f                   	pop    %edi
+  80083f:	5d                   	pop    %ebp
+  800840:	c3                   	ret
+  800841:	83 ec 0c             	sub    $0xc,%esp
+  800844:	50                   	push   %eax
+  800845:	6a 1a                	push   $0x1a
+  800847:	68 6a 31 80 00       	push   $0x80316a
+  80084c:	6a 24                	push   $0x24
+  80084e:	68 87 31 80 00       	push   $0x803187
+  800853:	e8 0b 19 00 00       	call   802163 <_panic>
+
+00800858 <sys_lease_complete>:
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	57                   	push   %edi
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	83 ec 0c             	sub    $0xc,%esp
+  800861:	ba 00 00 00 00       	mov    $0x0,%edx
+  800866:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80086b:	89 d1                	mov    %edx,%ecx
+  80086d:	89 d3                	mov    %edx,%ebx
+  80086f:	89 d7                	mov    %edx,%edi
+  800871:	89 d6                	mov    %edx,%esi
+  800873:	cd 30                	int    $0x30
+  800875:	85 c0                	test   %eax,%eax
+  800877:	7f 08                	jg     800881 <sys_lease_complete+0x29>
+  800879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80087c:	5b                   	pop    %ebx
+  80087d:	5e                   	pop    %esi
+  80087e:	5f                   	pop    %edi
+  80087f:	5d                   	pop    %ebp
+  800880:	c3                   	ret
+  800881:	83 ec 0c             	sub    $0xc,%esp
+  800884:	50                   	push   %eax
+  800885:	6a 1b                	push   $0x1b
+  800887:	68 6a 31 80 00       	push   $0x80316a
+  80088c:	6a 24                	push   $0x24
+  80088e:	68 87 31 80 00       	push   $0x803187
+  800893:	e8 cb 18 00 00       	call   802163 <_panic>
+
+00800898 <sys_env_set_thisenv>:
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	57                   	push   %edi
+  80089c:	56                   	push   %esi
+  80089d:	53                   	push   %ebx
+  80089e:	83 ec 0c             	sub    $0xc,%esp
+  8008a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008b1:	89 df                	mov    %ebx,%edi
+  8008b3:	89 de                	mov    %ebx,%esi
+  8008b5:	cd 30                	int    $0x30
+  8008b7:	85 c0                	test   %eax,%eax
+  8008b9:	7f 08                	jg     8008c3 <sys_env_set_thisenv+0x2b>
+  8008bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008be:	5b                   	pop    %ebx
+  8008bf:	5e                   	pop    %esi
+  8008c0:	5f                   	pop    %edi
+  8008c1:	5d                   	pop    %ebp
+  8008c2:	c3                   	ret
+  8008c3:	83 ec 0c             	sub    $0xc,%esp
+  8008c6:	50                   	push   %eax
+  8008c7:	6a 1c                	push   $0x1c
+  8008c9:	68 6a 31 80 00       	push   $0x80316a
+  8008ce:	6a 24                	push   $0x24
+  8008d0:	68 87 31 80 00       	push   $0x803187
+  8008d5:	e8 89 18 00 00       	call   802163 <_panic>
+
+008008da <sys_env_set_sched>:
+  8008da:	55                   	push   %ebp
+  8008db:	89 e5                	mov    %esp,%ebp
+  8008dd:	57                   	push   %edi
+  8008de:	56                   	push   %esi
+  8008df:	53                   	push   %ebx
+  8008e0:	83 ec 0c             	sub    $0xc,%esp
+  8008e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ee:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8008f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008f6:	89 f7                	mov    %esi,%edi
+  8008f8:	cd 30                	int    $0x30
+  8008fa:	85 c0                	test   %eax,%eax
+  8008fc:	7f 08                	jg     800906 <sys_env_set_sched+0x2c>
+  8008fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800901:	5b                   	pop    %ebx
+  800902:	5e                   	pop    %esi
+  800903:	5f                   	pop    %edi
+  800904:	5d                   	pop    %ebp
+  800905:	c3                   	ret
+  800906:	83 ec 0c             	sub    $0xc,%esp
+  800909:	50                   	push   %eax
+  80090a:	6a 1d                	push   $0x1d
+  80090c:	68 6a 31 80 00       	push   $0x80316a
+  800911:	6a 24                	push   $0x24
+  800913:	68 87 31 80 00       	push   $0x803187
+  800918:	e8 46 18 00 00       	call   802163 <_panic>
+
+0080091d <sys_batch>:
+  80091d:	55                   	push   %ebp
+  80091e:	89 e5                	mov    %esp,%ebp
+  800920:	57                   	push   %edi
+  800921:	56                   	push   %esi
+  800922:	53                   	push   %ebx
+  800923:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800928:	8b 55 08             	mov    0x8(%ebp),%edx
+  80092b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80092e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800933:	89 df                	mov    %ebx,%edi
+  800935:	89 de                	mov    %ebx,%esi
+  800937:	cd 30                	int    $0x30
+  800939:	5b                   	pop    %ebx
+  80093a:	5e                   	pop    %esi
+  80093b:	5f                   	pop    %edi
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+
+0080093e <sys_env_stats>:
+  80093e:	55                   	push   %ebp
+  80093f:	89 e5                	mov    %esp,%ebp
+  800941:	57                   	push   %edi
+  800942:	56                   	push   %esi
+  800943:	53                   	push   %ebx
+  800944:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800949:	8b 55 08             	mov    0x8(%ebp),%edx
+  80094c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094f:	b8 23 00 00 00       	mov    $0x23,%eax
+  800954:	89 df                	mov    %ebx,%edi
+  800956:	89 de                	mov    %ebx,%esi
+  800958:	cd 30                	int    $0x30
+  80095a:	5b                   	pop    %ebx
+  80095b:	5e                   	pop    %esi
+  80095c:	5f                   	pop    %edi
+  80095d:	5d                   	pop    %ebp
+  80095e:	c3                   	ret
+
+0080095f <sys_trace>:
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	57                   	push   %edi
+  800963:	56                   	push   %esi
+  800964:	53                   	push   %ebx
+  800965:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096d:	b8 24 00 00 00       	mov    $0x24,%eax
+  800972:	89 cb                	mov    %ecx,%ebx
+  800974:	89 cf                	mov    %ecx,%edi
+  800976:	89 ce                	mov    %ecx,%esi
+  800978:	cd 30                	int    $0x30
+  80097a:	5b                   	pop    %ebx
+  80097b:	5e                   	pop    %esi
+  80097c:	5f                   	pop    %edi
+  80097d:	5d                   	pop    %ebp
+  80097e:	c3                   	ret
+
+0080097f <sys_env_set_pager>:
+  80097f:	55                   	push   %ebp
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	57                   	push   %edi
+  800983:	56                   	push   %esi
+  800984:	53                   	push   %ebx
+  800985:	83 ec 0c             	sub    $0xc,%esp
+  800988:	be 00 00 00 00       	mov    $0x0,%esi
+  80098d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800990:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800993:	b8 25 00 00 00       	mov    $0x25,%eax
+  800998:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80099b:	89 f7                	mov    %esi,%edi
+  80099d:	cd 30                	int    $0x30
+  80099f:	85 c0                	test   %eax,%eax
+  8009a1:	7f 08                	jg     8009ab <sys_env_set_pager+0x2c>
+  8009a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a6:	5b                   	pop    %ebx
+  8009a7:	5e                   	pop    %esi
+  8009a8:	5f                   	pop    %edi
+  8009a9:	5d                   	pop    %ebp
+  8009aa:	c3                   	ret
+  8009ab:	83 ec 0c             	sub    $0xc,%esp
+  8009ae:	50                   	push   %eax
+  8009af:	6a 25                	push   $0x25
+  8009b1:	68 6a 31 80 00       	push   $0x80316a
+  8009b6:	6a 24                	push   $0x24
+  8009b8:	68 87 31 80 00       	push   $0x803187
+  8009bd:	e8 a1 17 00 00       	call   802163 <_panic>
+
+008009c2 <sys_pager_retire>:
+  8009c2:	55                   	push   %ebp
+  8009c3:	89 e5                	mov    %esp,%ebp
+  8009c5:	57                   	push   %edi
+  8009c6:	56                   	push   %esi
+  8009c7:	53                   	push   %ebx
+  8009c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d0:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009d5:	89 cb                	mov    %ecx,%ebx
+  8009d7:	89 cf                	mov    %ecx,%edi
+  8009d9:	89 ce                	mov    %ecx,%esi
+  8009db:	cd 30                	int    $0x30
+  8009dd:	5b                   	pop    %ebx
+  8009de:	5e                   	pop    %esi
+  8009df:	5f                   	pop    %edi
+  8009e0:	5d                   	pop    %ebp
+  8009e1:	c3                   	ret
+
+008009e2 <sys_prof>:
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	57                   	push   %edi
+  8009e6:	56                   	push   %esi
+  8009e7:	53                   	push   %ebx
+  8009e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f3:	b8 22 00 00 00       	mov    $0x22,%eax
+  8009f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009fb:	89 f7                	mov    %esi,%edi
+  8009fd:	cd 30                	int    $0x30
+  8009ff:	5b                   	pop    %ebx
+  800a00:	5e                   	pop    %esi
+  800a01:	5f                   	pop    %edi
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+
+00800a04 <fd2num>:
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0a:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a0f:	c1 e8 0c             	shr    $0xc,%eax
+  800a12:	5d                   	pop    %ebp
+  800a13:	c3                   	ret
+
+00800a14 <fd2data>:
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1a:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a1f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a24:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a29:	5d                   	pop    %ebp
+  800a2a:	c3                   	ret
+
+00800a2b <fd_alloc>:
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a33:	89 c2                	mov    %eax,%edx
+  800a35:	c1 ea 16             	shr    $0x16,%edx
+  800a38:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a3f:	f6 c2 01             	test   $0x1,%dl
+  800a42:	74 29                	je     800a6d <fd_alloc+0x42>
+  800a44:	89 c2                	mov    %eax,%edx
+  800a46:	c1 ea 0c             	shr    $0xc,%edx
+  800a49:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a50:	f6 c2 01             	test   $0x1,%dl
+  800a53:	74 18                	je     800a6d <fd_alloc+0x42>
+  800a55:	05 00 10 00 00       	add    $0x1000,%eax
+  800a5a:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a5f:	75 d2                	jne    800a33 <fd_alloc+0x8>
+  800a61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a66:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a6b:	eb 05                	jmp    800a72 <fd_alloc+0x47>
+  800a6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a75:	89 02                	mov    %eax,(%edx)
+  800a77:	89 c8                	mov    %ecx,%eax
+  800a79:	5d                   	pop    %ebp
+  800a7a:	c3                   	ret
+
+00800a7b <fd_lookup>:
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a81:	83 f8 1f             	cmp    $0x1f,%eax
+  800a84:	77 30                	ja     800ab6 <fd_lookup+0x3b>
+  800a86:	c1 e0 0c             	shl    $0xc,%eax
+  800a89:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800a8e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800a94:	f6 c2 01             	test   $0x1,%dl
+  800a97:	74 24                	je     800abd <fd_lookup+0x42>
+  800a99:	89 c2                	mov    %eax,%edx
+  800a9b:	c1 ea 0c             	shr    $0xc,%edx
+  800a9e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800aa5:	f6 c2 01             	test   $0x1,%dl
+  800aa8:	74 1a                	je     800ac4 <fd_lookup+0x49>
+  800aaa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aad:	89 02                	mov    %eax,(%edx)
+  800aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab4:	5d                   	pop    %ebp
+  800ab5:	c3                   	ret
+  800ab6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800abb:	eb f7                	jmp    800ab4 <fd_lookup+0x39>
+  800abd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac2:	eb f0                	jmp    800ab4 <fd_lookup+0x39>
+  800ac4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac9:	eb e9                	jmp    800ab4 <fd_lookup+0x39>
+
+00800acb <dev_lookup>:
+  800acb:	55                   	push   %ebp
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	53                   	push   %ebx
+  800acf:	83 ec 04             	sub    $0x4,%esp
+  800ad2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ada:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800adf:	39 13                	cmp    %edx,(%ebx)
+  800ae1:	74 37                	je     800b1a <dev_lookup+0x4f>
+  800ae3:	83 c0 01             	add    $0x1,%eax
+  800ae6:	8b 1c 85 14 32 80 00 	mov    0x803214(,%eax,4),%ebx
+  800aed:	85 db                	test   %ebx,%ebx
+  800aef:	75 ee                	jne    800adf <dev_lookup+0x14>
+  800af1:	a1 10 50 80 00       	mov    0x805010,%eax
+  800af6:	8b 40 48             	mov    0x48(%eax),%eax
+  800af9:	83 ec 04             	sub    $0x4,%esp
+  800afc:	52                   	push   %edx
+  800afd:	50                   	push   %eax
+  800afe:	68 98 31 80 00       	push   $0x803198
+  800b03:	e8 36 17 00 00       	call   80223e <cprintf>
+  800b08:	83 c4 10             	add    $0x10,%esp
+  800b0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b10:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b13:	89 1a                	mov    %ebx,(%edx)
+  800b15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b18:	c9                   	leave
+  800b19:	c3                   	ret
+  800b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1f:	eb ef                	jmp    800b10 <dev_lookup+0x45>
+
+00800b21 <fd_close>:
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	57                   	push   %edi
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  800b27:	83 ec 24             	sub    $0x24,%esp
+  800b2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b30:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b33:	50                   	push   %eax
+  800b34:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b3a:	c1 e8 0c             	shr    $0xc,%eax
+  800b3d:	50                   	push   %eax
+  800b3e:	e8 38 ff ff ff       	call   800a7b <fd_lookup>
+  800b43:	89 c3                	mov    %eax,%ebx
+  800b45:	83 c4 10             	add    $0x10,%esp
+  800b48:	85 c0                	test   %eax,%eax
+  800b4a:	78 05                	js     800b51 <fd_close+0x30>
+  800b4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b4f:	74 0f                	je     800b60 <fd_close+0x3f>
+  800b51:	85 ff                	test   %edi,%edi
+  800b53:	0f 44 df             	cmove  %edi,%ebx
+  800b56:	89 d8                	mov    %ebx,%eax
+  800b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b5b:	5b                   	pop    %ebx
+  800b5c:	5e                   	pop    %esi
+  800b5d:	5f                   	pop    %edi
+  800b5e:	5d                   	pop    %ebp
+  800b5f:	c3                   	ret
+  800b60:	83 ec 08             	sub    $0x8,%esp
+  800b63:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b66:	50                   	push   %eax
+  800b67:	ff 36                	push   (%esi)
+  800b69:	e8 5d ff ff ff       	call   800acb <dev_lookup>
+  800b6e:	89 c3                	mov    %eax,%ebx
+  800b70:	83 c4 10             	add    $0x10,%esp
+  800b73:	85 c0                	test   %eax,%eax
+  800b75:	78 1a                	js     800b91 <fd_close+0x70>
+  800b77:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b7a:	8b 40 10             	mov    0x10(%eax),%eax
+  800b7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b82:	85 c0                	test   %eax,%eax
+  800b84:	74 0b                	je     800b91 <fd_close+0x70>
+  800b86:	83 ec 0c             	sub    $0xc,%esp
+  800b89:	56                   	push   %esi
+  800b8a:	ff d0                	call   *%eax
+  800b8c:	89 c3                	mov    %eax,%ebx
+  800b8e:	83 c4 10             	add    $0x10,%esp
+  800b91:	83 ec 08             	sub    $0x8,%esp
+  800b94:	56                   	push   %esi
+  800b95:	6a 00                	push   $0x0
+  800b97:	e8 cc f6 ff ff       	call   800268 <sys_page_unmap>
+  800b9c:	83 c4 10             	add    $0x10,%esp
+  800b9f:	eb b5                	jmp    800b56 <fd_close+0x35>
+
+00800ba1 <close>:
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	83 ec 20             	sub    $0x20,%esp
+  800ba7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800baa:	50                   	push   %eax
+  800bab:	ff 75 08             	push   0x8(%ebp)
+  800bae:	e8 c8 fe ff ff       	call   800a7b <fd_lookup>
+  800bb3:	83 c4 10             	add    $0x10,%esp
+  800bb6:	85 c0                	test   %eax,%eax
+  800bb8:	79 02                	jns    800bbc <close+0x1b>
+  800bba:	c9                   	leave
+  800bbb:	c3                   	ret
+  800bbc:	83 ec 08             	sub    $0x8,%esp
+  800bbf:	6a 01                	push   $0x1
+  800bc1:	ff 75 f4             	push   -0xc(%ebp)
+  800bc4:	e8 58 ff ff ff       	call   800b21 <fd_close>
+  800bc9:	83 c4 10             	add    $0x10,%esp
+  800bcc:	eb ec                	jmp    800bba <close+0x19>
+
+00800bce <close_all>:
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	53                   	push   %ebx
+  800bd2:	83 ec 04             	sub    $0x4,%esp
+  800bd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bda:	83 ec 0c             	sub    $0xc,%esp
+  800bdd:	53                   	push   %ebx
+  800bde:	e8 be ff ff ff       	call   800ba1 <close>
+  800be3:	83 c3 01             	add    $0x1,%ebx
+  800be6:	83 c4 10             	add    $0x10,%esp
+  800be9:	83 fb 20             	cmp    $0x20,%ebx
+  800bec:	75 ec                	jne    800bda <close_all+0xc>
+  800bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf1:	c9                   	leave
+  800bf2:	c3                   	ret
+
+00800bf3 <dup>:
+  800bf3:	55                   	push   %ebp
+  800bf4:	89 e5                	mov    %esp,%ebp
+  800bf6:	57                   	push   %edi
+  800bf7:	56                   	push   %esi
+  800bf8:	53                   	push   %ebx
+  800bf9:	83 ec 34             	sub    $0x34,%esp
+  800bfc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800bff:	50                   	push   %eax
+  800c00:	ff 75 08             	push   0x8(%ebp)
+  800c03:	e8 73 fe ff ff       	call   800a7b <fd_lookup>
+  800c08:	89 c3                	mov    %eax,%ebx
+  800c0a:	83 c4 10             	add    $0x10,%esp
+  800c0d:	85 c0                	test   %eax,%eax
+  800c0f:	78 7f                	js     800c90 <dup+0x9d>
+  800c11:	83 ec 0c             	sub    $0xc,%esp
+  800c14:	ff 75 0c             	push   0xc(%ebp)
+  800c17:	e8 85 ff ff ff       	call   800ba1 <close>
+  800c1c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c1f:	c1 e6 0c             	shl    $0xc,%esi
+  800c22:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c28:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c2b:	89 3c 24             	mov    %edi,(%esp)
+  800c2e:	e8 e1 fd ff ff       	call   800a14 <fd2data>
+  800c33:	89 c3                	mov    %eax,%ebx
+  800c35:	89 34 24             	mov    %esi,(%esp)
+  800c38:	e8 d7 fd ff ff       	call   800a14 <fd2data>
+  800c3d:	83 c4 10             	add    $0x10,%esp
+  800c40:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c43:	89 d8                	mov    %ebx,%eax
+  800c45:	c1 e8 16             	shr    $0x16,%eax
+  800c48:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c4f:	a8 01                	test   $0x1,%al
+  800c51:	74 11                	je     800c64 <dup+0x71>
+  800c53:	89 d8                	mov    %ebx,%eax
+  800c55:	c1 e8 0c             	shr    $0xc,%eax
+  800c58:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c5f:	f6 c2 01             	test   $0x1,%dl
+  800c62:	75 36                	jne    800c9a <dup+0xa7>
+  800c64:	89 f8                	mov    %edi,%eax
+  800c66:	c1 e8 0c             	shr    $0xc,%eax
+  800c69:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c70:	83 ec 0c             	sub    $0xc,%esp
+  800c73:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c78:	50                   	push   %eax
+  800c79:	56                   	push   %esi
+  800c7a:	6a 00                	push   $0x0
+  800c7c:	57                   	push   %edi
+  800c7d:	6a 00                	push   $0x0
+  800c7f:	e8 55 f5 ff ff       	call   8001d9 <sys_page_map>
+  800c84:	89 c3                	mov    %eax,%ebx
+  800c86:	83 c4 20             	add    $0x20,%esp
+  800c89:	85 c0                	test   %eax,%eax
+  800c8b:	78 33                	js     800cc0 <dup+0xcd>
+  800c8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c90:	89 d8                	mov    %ebx,%eax
+  800c92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c95:	5b                   	pop    %ebx
+  800c96:	5e                   	pop    %esi
+  800c97:	5f                   	pop    %edi
+  800c98:	5d                   	pop    %ebp
+  800c99:	c3                   	ret
+  800c9a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ca1:	83 ec 0c             	sub    $0xc,%esp
+  800ca4:	25 07 0e 00 00       	and    $0xe07,%eax
+  800ca9:	50                   	push   %eax
+  800caa:	ff 75 d4             	push   -0x2c(%ebp)
+  800cad:	6a 00                	push   $0x0
+  800caf:	53                   	push   %ebx
+  800cb0:	6a 00                	push   $0x0
+  800cb2:	e8 22 f5 ff ff       	call   8001d9 <sys_page_map>
+  800cb7:	89 c3                	mov    %eax,%ebx
+  800cb9:	83 c4 20             	add    $0x20,%esp
+  800cbc:	85 c0                	test   %eax,%eax
+  800cbe:	79 a4                	jns    800c64 <dup+0x71>
+  800cc0:	83 ec 08             	sub    $0x8,%esp
+  800cc3:	56                   	push   %esi
+  800cc4:	6a 00                	push   $0x0
+  800cc6:	e8 9d f5 ff ff       	call   800268 <sys_page_unmap>
+  800ccb:	83 c4 08             	add    $0x8,%esp
+  800cce:	ff 75 d4             	push   -0x2c(%ebp)
+  800cd1:	6a 00                	push   $0x0
+  800cd3:	e8 90 f5 ff ff       	call   800268 <sys_page_unmap>
+  800cd8:	83 c4 10             	add    $0x10,%esp
+  800cdb:	eb b3                	jmp    800c90 <dup+0x9d>
+
+00800cdd <read>:
+  800cdd:	55                   	push   %ebp
+  800cde:	89 e5                	mov    %esp,%ebp
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+  800ce2:	83 ec 18             	sub    $0x18,%esp
+  800ce5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ce8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ceb:	50                   	push   %eax
+  800cec:	56                   	push   %esi
+  800ced:	e8 89 fd ff ff       	call   800a7b <fd_lookup>
+  800cf2:	83 c4 10             	add    $0x10,%esp
+  800cf5:	85 c0                	test   %eax,%eax
+  800cf7:	78 3c                	js     800d35 <read+0x58>
+  800cf9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800cfc:	83 ec 08             	sub    $0x8,%esp
+  800cff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d02:	50                   	push   %eax
+  800d03:	ff 33                	push   (%ebx)
+  800d05:	e8 c1 fd ff ff       	call   800acb <dev_lookup>
+  800d0a:	83 c4 10             	add    $0x10,%esp
+  800d0d:	85 c0                	test   %eax,%eax
+  800d0f:	78 24                	js     800d35 <read+0x58>
+  800d11:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d14:	83 e0 03             	and    $0x3,%eax
+  800d17:	83 f8 01             	cmp    $0x1,%eax
+  800d1a:	74 20                	je     800d3c <read+0x5f>
+  800d1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d1f:	8b 40 08             	mov    0x8(%eax),%eax
+  800d22:	85 c0                	test   %eax,%eax
+  800d24:	74 37                	je     800d5d <read+0x80>
+  800d26:	83 ec 04             	sub    $0x4,%esp
+  800d29:	ff 75 10             	push   0x10(%ebp)
+  800d2c:	ff 75 0c             	push   0xc(%ebp)
+  800d2f:	53                   	push   %ebx
+  800d30:	ff d0                	call   *%eax
+  800d32:	83 c4 10             	add    $0x10,%esp
+  800d35:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d38:	5b                   	pop    %ebx
+  800d39:	5e                   	pop    %esi
+  800d3a:	5d                   	pop    %ebp
+  800d3b:	c3                   	ret
+  800d3c:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d41:	8b 40 48             	mov    0x48(%eax),%eax
+  800d44:	83 ec 04             	sub    $0x4,%esp
+  800d47:	56                   	push   %esi
+  800d48:	50                   	push   %eax
+  800d49:	68 d9 31 80 00       	push   $0x8031d9
+  800d4e:	e8 eb 14 00 00       	call   80223e <cprintf>
+  800d53:	83 c4 10             	add    $0x10,%esp
+  800d56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d5b:	eb d8                	jmp    800d35 <read+0x58>
+  800d5d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d62:	eb d1                	jmp    800d35 <read+0x58>
+
+00800d64 <readn>:
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+  800d6d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d70:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d73:	85 f6                	test   %esi,%esi
+  800d75:	74 30                	je     800da7 <readn+0x43>
+  800d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d81:	83 ec 04             	sub    $0x4,%esp
+  800d84:	89 f2                	mov    %esi,%edx
+  800d86:	29 c2                	sub    %eax,%edx
+  800d88:	52                   	push   %edx
+  800d89:	01 f8                	add    %edi,%eax
+  800d8b:	50                   	push   %eax
+  800d8c:	ff 75 08             	push   0x8(%ebp)
+  800d8f:	e8 49 ff ff ff       	call   800cdd <read>
+  800d94:	83 c4 10             	add    $0x10,%esp
+  800d97:	85 c0                	test   %eax,%eax
+  800d99:	78 15                	js     800db0 <readn+0x4c>
+  800d9b:	74 11                	je     800dae <readn+0x4a>
+  800d9d:	01 c3                	add    %eax,%ebx
+  800d9f:	89 d8                	mov    %ebx,%eax
+  800da1:	39 f3                	cmp    %esi,%ebx
+  800da3:	72 dc                	jb     800d81 <readn+0x1d>
+  800da5:	eb 09                	jmp    800db0 <readn+0x4c>
+  800da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dac:	eb 02                	jmp    800db0 <readn+0x4c>
+  800dae:	89 d8                	mov    %ebx,%eax
+  800db0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db3:	5b                   	pop    %ebx
+  800db4:	5e                   	pop    %esi
+  800db5:	5f                   	pop    %edi
+  800db6:	5d                   	pop    %ebp
+  800db7:	c3                   	ret
+
+00800db8 <write>:
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  800dbd:	83 ec 18             	sub    $0x18,%esp
+  800dc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dc3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dc6:	50                   	push   %eax
+  800dc7:	53                   	push   %ebx
+  800dc8:	e8 ae fc ff ff       	call   800a7b <fd_lookup>
+  800dcd:	83 c4 10             	add    $0x10,%esp
+  800dd0:	85 c0                	test   %eax,%eax
+  800dd2:	78 37                	js     800e0b <write+0x53>
+  800dd4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800dd7:	83 ec 08             	sub    $0x8,%esp
+  800dda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ddd:	50                   	push   %eax
+  800dde:	ff 36                	push   (%esi)
+  800de0:	e8 e6 fc ff ff       	call   800acb <dev_lookup>
+  800de5:	83 c4 10             	add    $0x10,%esp
+  800de8:	85 c0                	test   %eax,%eax
+  800dea:	78 1f                	js     800e0b <write+0x53>
+  800dec:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800df0:	74 20                	je     800e12 <write+0x5a>
+  800df2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800df5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800df8:	85 c0                	test   %eax,%eax
+  800dfa:	74 37                	je     800e33 <write+0x7b>
+  800dfc:	83 ec 04             	sub    $0x4,%esp
+  800dff:	ff 75 10             	push   0x10(%ebp)
+  800e02:	ff 75 0c             	push   0xc(%ebp)
+  800e05:	56                   	push   %esi
+  800e06:	ff d0                	call   *%eax
+  800e08:	83 c4 10             	add    $0x10,%esp
+  800e0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5d                   	pop    %ebp
+  800e11:	c3                   	ret
+  800e12:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e17:	8b 40 48             	mov    0x48(%eax),%eax
+  800e1a:	83 ec 04             	sub    $0x4,%esp
+  800e1d:	53                   	push   %ebx
+  800e1e:	50                   	push   %eax
+  800e1f:	68 f5 31 80 00       	push   $0x8031f5
+  800e24:	e8 15 14 00 00       	call   80223e <cprintf>
+  800e29:	83 c4 10             	add    $0x10,%esp
+  800e2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e31:	eb d8                	jmp    800e0b <write+0x53>
+  800e33:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e38:	eb d1                	jmp    800e0b <write+0x53>
+
+00800e3a <seek>:
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	83 ec 20             	sub    $0x20,%esp
+  800e40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e43:	50                   	push   %eax
+  800e44:	ff 75 08             	push   0x8(%ebp)
+  800e47:	e8 2f fc ff ff       	call   800a7b <fd_lookup>
+  800e4c:	83 c4 10             	add    $0x10,%esp
+  800e4f:	85 c0                	test   %eax,%eax
+  800e51:	78 0e                	js     800e61 <seek+0x27>
+  800e53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e59:	89 50 04             	mov    %edx,0x4(%eax)
+  800e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e61:	c9                   	leave
+  800e62:	c3                   	ret
+
+00800e63 <ftruncate>:
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 18             	sub    $0x18,%esp
+  800e6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e6e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e71:	50                   	push   %eax
+  800e72:	53                   	push   %ebx
+  800e73:	e8 03 fc ff ff       	call   800a7b <fd_lookup>
+  800e78:	83 c4 10             	add    $0x10,%esp
+  800e7b:	85 c0                	test   %eax,%eax
+  800e7d:	78 34                	js     800eb3 <ftruncate+0x50>
+  800e7f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e82:	83 ec 08             	sub    $0x8,%esp
+  800e85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e88:	50                   	push   %eax
+  800e89:	ff 36                	push   (%esi)
+  800e8b:	e8 3b fc ff ff       	call   800acb <dev_lookup>
+  800e90:	83 c4 10             	add    $0x10,%esp
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	78 1c                	js     800eb3 <ftruncate+0x50>
+  800e97:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e9b:	74 1d                	je     800eba <ftruncate+0x57>
+  800e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea0:	8b 40 18             	mov    0x18(%eax),%eax
+  800ea3:	85 c0                	test   %eax,%eax
+  800ea5:	74 34                	je     800edb <ftruncate+0x78>
+  800ea7:	83 ec 08             	sub    $0x8,%esp
+  800eaa:	ff 75 0c             	push   0xc(%ebp)
+  800ead:	56                   	push   %esi
+  800eae:	ff d0                	call   *%eax
+  800eb0:	83 c4 10             	add    $0x10,%esp
+  800eb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eb6:	5b                   	pop    %ebx
+  800eb7:	5e                   	pop    %esi
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+  800eba:	a1 10 50 80 00       	mov    0x805010,%eax
+  800ebf:	8b 40 48             	mov    0x48(%eax),%eax
+  800ec2:	83 ec 04             	sub    $0x4,%esp
+  800ec5:	53                   	push   %ebx
+  800ec6:	50                   	push   %eax
+  800ec7:	68 b8 31 80 00       	push   $0x8031b8
+  800ecc:	e8 6d 13 00 00       	call   80223e <cprintf>
+  800ed1:	83 c4 10             	add    $0x10,%esp
+  800ed4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed9:	eb d8                	jmp    800eb3 <ftruncate+0x50>
+  800edb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ee0:	eb d1                	jmp    800eb3 <ftruncate+0x50>
+
+00800ee2 <fstat>:
+  800ee2:	55                   	push   %ebp
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+  800ee7:	83 ec 18             	sub    $0x18,%esp
+  800eea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800eed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ef0:	50                   	push   %eax
+  800ef1:	ff 75 08             	push   0x8(%ebp)
+  800ef4:	e8 82 fb ff ff       	call   800a7b <fd_lookup>
+  800ef9:	83 c4 10             	add    $0x10,%esp
+  800efc:	85 c0                	test   %eax,%eax
+  800efe:	78 49                	js     800f49 <fstat+0x67>
+  800f00:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f03:	83 ec 08             	sub    $0x8,%esp
+  800f06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f09:	50                   	push   %eax
+  800f0a:	ff 36                	push   (%esi)
+  800f0c:	e8 ba fb ff ff       	call   800acb <dev_lookup>
+  800f11:	83 c4 10             	add    $0x10,%esp
+  800f14:	85 c0                	test   %eax,%eax
+  800f16:	78 31                	js     800f49 <fstat+0x67>
+  800f18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f1b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f1f:	74 2f                	je     800f50 <fstat+0x6e>
+  800f21:	c6 03 00             	movb   $0x0,(%ebx)
+  800f24:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f2b:	00 00 00 
+  800f2e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f35:	00 00 00 
+  800f38:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f3e:	83 ec 08             	sub    $0x8,%esp
+  800f41:	53                   	push   %ebx
+  800f42:	56                   	push   %esi
+  800f43:	ff 50 14             	call   *0x14(%eax)
+  800f46:	83 c4 10             	add    $0x10,%esp
+  800f49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4c:	5b                   	pop    %ebx
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5d                   	pop    %ebp
+  800f4f:	c3                   	ret
+  800f50:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f55:	eb f2                	jmp    800f49 <fstat+0x67>
+
+00800f57 <stat>:
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+  800f5c:	83 ec 08             	sub    $0x8,%esp
+  800f5f:	6a 00                	push   $0x0
+  800f61:	ff 75 08             	push   0x8(%ebp)
+  800f64:	e8 31 05 00 00       	call   80149a <open>
+  800f69:	89 c3                	mov    %eax,%ebx
+  800f6b:	83 c4 10             	add    $0x10,%esp
+  800f6e:	85 c0                	test   %eax,%eax
+  800f70:	78 1b                	js     800f8d <stat+0x36>
+  800f72:	83 ec 08             	sub    $0x8,%esp
+  800f75:	ff 75 0c             	push   0xc(%ebp)
+  800f78:	50                   	push   %eax
+  800f79:	e8 64 ff ff ff       	call   800ee2 <fstat>
+  800f7e:	89 c6                	mov    %eax,%esi
+  800f80:	89 1c 24             	mov    %ebx,(%esp)
+  800f83:	e8 19 fc ff ff       	call   800ba1 <close>
+  800f88:	83 c4 10             	add    $0x10,%esp
+  800f8b:	89 f3                	mov    %esi,%ebx
+  800f8d:	89 d8                	mov    %ebx,%eax
+  800f8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5d                   	pop    %ebp
+  800f95:	c3                   	ret
+
+00800f96 <fsipc>:
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	56                   	push   %esi
+  800f9a:	53                   	push   %ebx
+  800f9b:	89 c3                	mov    %eax,%ebx
+  800f9d:	89 d6                	mov    %edx,%esi
+  800f9f:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800fa6:	74 20                	je     800fc8 <fsipc+0x32>
+  800fa8:	83 ec 08             	sub    $0x8,%esp
+  800fab:	6a 00                	push   $0x0
+  800fad:	56                   	push   %esi
+  800fae:	6a 07                	push   $0x7
+  800fb0:	68 00 60 80 00       	push   $0x806000
+  800fb5:	53                   	push   %ebx
+  800fb6:	ff 35 08 50 80 00    	push   0x805008
+  800fbc:	e8 a4 1d 00 00       	call   802d65 <ipc_call>
+  800fc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc4:	5b                   	pop    %ebx
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5d                   	pop    %ebp
+  800fc7:	c3                   	ret
+  800fc8:	83 ec 0c             	sub    $0xc,%esp
+  800fcb:	6a 02                	push   $0x2
+  800fcd:	e8 2e 1f 00 00       	call   802f00 <ipc_find_env>
+  800fd2:	a3 08 50 80 00       	mov    %eax,0x805008
+  800fd7:	83 c4 10             	add    $0x10,%esp
+  800fda:	eb cc                	jmp    800fa8 <fsipc+0x12>
+
+00800fdc <devfile_trunc>:
+  800fdc:	55                   	push   %ebp
+  800fdd:	89 e5                	mov    %esp,%ebp
+  800fdf:	83 ec 08             	sub    $0x8,%esp
+  800fe2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800fe8:	a3 00 60 80 00       	mov    %eax,0x806000
+  800fed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff0:	a3 04 60 80 00       	mov    %eax,0x806004
+  800ff5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fff:	e8 92 ff ff ff       	call   800f96 <fsipc>
+  801004:	c9                   	leave
+  801005:	c3                   	ret
+
+00801006 <devfile_flush>:
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	83 ec 08             	sub    $0x8,%esp
+  80100c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80100f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801012:	a3 00 60 80 00       	mov    %eax,0x806000
+  801017:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801021:	e8 70 ff ff ff       	call   800f96 <fsipc>
+  801026:	c9                   	leave
+  801027:	c3                   	ret
+
+00801028 <devfile_stat>:
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	53                   	push   %ebx
+  80102c:	83 ec 04             	sub    $0x4,%esp
+  80102f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801032:	8b 45 08             	mov    0x8(%ebp),%eax
+  801035:	8b 40 0c             	mov    0xc(%eax),%eax
+  801038:	a3 00 60 80 00       	mov    %eax,0x806000
+  80103d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801042:	b8 07 00 00 00       	mov    $0x7,%eax
+  801047:	e8 4a ff ff ff       	call   800f96 <fsipc>
+  80104c:	85 c0                	test   %eax,%eax
+  80104e:	78 2c                	js     80107c <devfile_stat+0x54>
+  801050:	83 ec 08             	sub    $0x8,%esp
+  801053:	68 00 60 80 00       	push   $0x806000
+  801058:	53                   	push   %ebx
+  801059:	e8 d7 18 00 00       	call   802935 <strcpy>
+  80105e:	a1 80 60 80 00       	mov    0x806080,%eax
+  801063:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801069:	a1 84 60 80 00       	mov    0x806084,%eax
+  80106e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801074:	83 c4 10             	add    $0x10,%esp
+  801077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80107f:	c9                   	leave
+  801080:	c3                   	ret
+
+00801081 <fsring_rw>:
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	57                   	push   %edi
+  801085:	56                   	push   %esi
+  801086:	53                   	push   %ebx
+  801087:	83 ec 2c             	sub    $0x2c,%esp
+  80108a:	89 c7                	mov    %eax,%edi
+  80108c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80108f:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801092:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801097:	a8 01                	test   $0x1,%al
+  801099:	74 0d                	je     8010a8 <fsring_rw+0x27>
+  80109b:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010a0:	a8 01                	test   $0x1,%al
+  8010a2:	0f 85 d5 00 00 00    	jne    80117d <fsring_rw+0xfc>
+  8010a8:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8010b0:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010b6:	0f 84 fc 00 00 00    	je     8011b8 <fsring_rw+0x137>
+  8010bc:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010c3:	0f 84 02 01 00 00    	je     8011cb <fsring_rw+0x14a>
+  8010c9:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010ce:	83 ec 04             	sub    $0x4,%esp
+  8010d1:	68 07 02 00 00       	push   $0x207
+  8010d6:	53                   	push   %ebx
+  8010d7:	6a 00                	push   $0x0
+  8010d9:	e8 b8 f0 ff ff       	call   800196 <sys_page_alloc>
+  8010de:	83 c4 10             	add    $0x10,%esp
+  8010e1:	85 c0                	test   %eax,%eax
+  8010e3:	0f 88 f9 00 00 00    	js     8011e2 <fsring_rw+0x161>
+  8010e9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010ef:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8010f5:	75 d7                	jne    8010ce <fsring_rw+0x4d>
+  8010f7:	6a 0e                	push   $0xe
+  8010f9:	6a 0d                	push   $0xd
+  8010fb:	ff 35 08 50 80 00    	push   0x805008
+  801101:	68 00 00 f0 cf       	push   $0xcff00000
+  801106:	e8 c4 0c 00 00       	call   801dcf <ipcring_init>
+  80110b:	83 c4 08             	add    $0x8,%esp
+  80110e:	6a 00                	push   $0x0
+  801110:	6a 00                	push   $0x0
+  801112:	68 07 02 00 00       	push   $0x207
+  801117:	68 00 00 f0 cf       	push   $0xcff00000
+  80111c:	6a 0b                	push   $0xb
+  80111e:	ff 35 08 50 80 00    	push   0x805008
+  801124:	e8 3c 1c 00 00       	call   802d65 <ipc_call>
+  801129:	89 c6                	mov    %eax,%esi
+  80112b:	83 c4 20             	add    $0x20,%esp
+  80112e:	85 c0                	test   %eax,%eax
+  801130:	0f 88 ac 00 00 00    	js     8011e2 <fsring_rw+0x161>
+  801136:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113b:	89 d9                	mov    %ebx,%ecx
+  80113d:	83 c3 01             	add    $0x1,%ebx
+  801140:	89 da                	mov    %ebx,%edx
+  801142:	c1 e2 0c             	shl    $0xc,%edx
+  801145:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80114b:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801151:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801157:	83 ec 08             	sub    $0x8,%esp
+  80115a:	6a 00                	push   $0x0
+  80115c:	6a 00                	push   $0x0
+  80115e:	68 07 02 00 00       	push   $0x207
+  801163:	50                   	push   %eax
+  801164:	6a 0c                	push   $0xc
+  801166:	ff 35 08 50 80 00    	push   0x805008
+  80116c:	e8 f4 1b 00 00       	call   802d65 <ipc_call>
+  801171:	83 c4 20             	add    $0x20,%esp
+  801174:	85 c0                	test   %eax,%eax
+  801176:	78 6a                	js     8011e2 <fsring_rw+0x161>
+  801178:	83 fb 08             	cmp    $0x8,%ebx
+  80117b:	75 be                	jne    80113b <fsring_rw+0xba>
+  80117d:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801181:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801186:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80118b:	0f 45 c2             	cmovne %edx,%eax
+  80118e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801191:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801198:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  80119f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b0:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011b3:	e9 4b 01 00 00       	jmp    801303 <fsring_rw+0x282>
+  8011b8:	e8 a3 f3 ff ff       	call   800560 <sys_time_msec>
+  8011bd:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011c3:	0f 89 f3 fe ff ff    	jns    8010bc <fsring_rw+0x3b>
+  8011c9:	eb 54                	jmp    80121f <fsring_rw+0x19e>
+  8011cb:	83 ec 0c             	sub    $0xc,%esp
+  8011ce:	6a 02                	push   $0x2
+  8011d0:	e8 2b 1d 00 00       	call   802f00 <ipc_find_env>
+  8011d5:	a3 08 50 80 00       	mov    %eax,0x805008
+  8011da:	83 c4 10             	add    $0x10,%esp
+  8011dd:	e9 e7 fe ff ff       	jmp    8010c9 <fsring_rw+0x48>
+  8011e2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8011e7:	83 ec 08             	sub    $0x8,%esp
+  8011ea:	53                   	push   %ebx
+  8011eb:	6a 00                	push   $0x0
+  8011ed:	e8 76 f0 ff ff       	call   800268 <sys_page_unmap>
+  8011f2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011f8:	83 c4 10             	add    $0x10,%esp
+  8011fb:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801201:	75 e4                	jne    8011e7 <fsring_rw+0x166>
+  801203:	e8 58 f3 ff ff       	call   800560 <sys_time_msec>
+  801208:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80120d:	a3 00 50 80 00       	mov    %eax,0x805000
+  801212:	a1 10 50 80 00       	mov    0x805010,%eax
+  801217:	8b 40 48             	mov    0x48(%eax),%eax
+  80121a:	a3 04 50 80 00       	mov    %eax,0x805004
+  80121f:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801226:	e9 7a 01 00 00       	jmp    8013a5 <fsring_rw+0x324>
+  80122b:	8b 57 0c             	mov    0xc(%edi),%edx
+  80122e:	89 10                	mov    %edx,(%eax)
+  801230:	89 58 04             	mov    %ebx,0x4(%eax)
+  801233:	89 f2                	mov    %esi,%edx
+  801235:	03 57 04             	add    0x4(%edi),%edx
+  801238:	89 50 08             	mov    %edx,0x8(%eax)
+  80123b:	83 ec 04             	sub    $0x4,%esp
+  80123e:	53                   	push   %ebx
+  80123f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801242:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801245:	52                   	push   %edx
+  801246:	83 c0 0c             	add    $0xc,%eax
+  801249:	50                   	push   %eax
+  80124a:	e8 96 18 00 00       	call   802ae5 <memmove>
+  80124f:	83 c4 10             	add    $0x10,%esp
+  801252:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801255:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801258:	89 08                	mov    %ecx,(%eax)
+  80125a:	83 ec 0c             	sub    $0xc,%esp
+  80125d:	68 00 00 f0 cf       	push   $0xcff00000
+  801262:	e8 c6 0b 00 00       	call   801e2d <ipcring_req_push>
+  801267:	01 de                	add    %ebx,%esi
+  801269:	83 c4 10             	add    $0x10,%esp
+  80126c:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80126f:	73 4c                	jae    8012bd <fsring_rw+0x23c>
+  801271:	83 ec 0c             	sub    $0xc,%esp
+  801274:	68 00 00 f0 cf       	push   $0xcff00000
+  801279:	e8 89 0b 00 00       	call   801e07 <ipcring_req_slot>
+  80127e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801281:	83 c4 10             	add    $0x10,%esp
+  801284:	85 c0                	test   %eax,%eax
+  801286:	74 35                	je     8012bd <fsring_rw+0x23c>
+  801288:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80128d:	83 e0 07             	and    $0x7,%eax
+  801290:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801295:	c1 e0 0c             	shl    $0xc,%eax
+  801298:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80129b:	29 f3                	sub    %esi,%ebx
+  80129d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012a0:	39 cb                	cmp    %ecx,%ebx
+  8012a2:	0f 47 d9             	cmova  %ecx,%ebx
+  8012a5:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012a9:	75 80                	jne    80122b <fsring_rw+0x1aa>
+  8012ab:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012ae:	89 10                	mov    %edx,(%eax)
+  8012b0:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012b3:	89 f2                	mov    %esi,%edx
+  8012b5:	03 57 04             	add    0x4(%edi),%edx
+  8012b8:	89 50 08             	mov    %edx,0x8(%eax)
+  8012bb:	eb 95                	jmp    801252 <fsring_rw+0x1d1>
+  8012bd:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012c5:	83 ec 0c             	sub    $0xc,%esp
+  8012c8:	68 00 00 f0 cf       	push   $0xcff00000
+  8012cd:	e8 94 0b 00 00       	call   801e66 <ipcring_rsp_wait>
+  8012d2:	8b 58 04             	mov    0x4(%eax),%ebx
+  8012d5:	83 c4 10             	add    $0x10,%esp
+  8012d8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8012dc:	75 45                	jne    801323 <fsring_rw+0x2a2>
+  8012de:	85 db                	test   %ebx,%ebx
+  8012e0:	79 41                	jns    801323 <fsring_rw+0x2a2>
+  8012e2:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8012e5:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8012ec:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8012f3:	83 ec 0c             	sub    $0xc,%esp
+  8012f6:	68 00 00 f0 cf       	push   $0xcff00000
+  8012fb:	e8 cc 0b 00 00       	call   801ecc <ipcring_rsp_pop>
+  801300:	83 c4 10             	add    $0x10,%esp
+  801303:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801309:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80130e:	39 c2                	cmp    %eax,%edx
+  801310:	74 75                	je     801387 <fsring_rw+0x306>
+  801312:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801316:	75 a5                	jne    8012bd <fsring_rw+0x23c>
+  801318:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80131b:	0f 82 50 ff ff ff    	jb     801271 <fsring_rw+0x1f0>
+  801321:	eb 9a                	jmp    8012bd <fsring_rw+0x23c>
+  801323:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801327:	75 ca                	jne    8012f3 <fsring_rw+0x272>
+  801329:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80132d:	74 31                	je     801360 <fsring_rw+0x2df>
+  80132f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801332:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801335:	29 c8                	sub    %ecx,%eax
+  801337:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80133a:	39 d0                	cmp    %edx,%eax
+  80133c:	0f 47 c2             	cmova  %edx,%eax
+  80133f:	39 d8                	cmp    %ebx,%eax
+  801341:	ba 01 00 00 00       	mov    $0x1,%edx
+  801346:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80134a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80134d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801352:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801356:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801359:	01 d9                	add    %ebx,%ecx
+  80135b:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80135e:	eb 93                	jmp    8012f3 <fsring_rw+0x272>
+  801360:	83 ec 04             	sub    $0x4,%esp
+  801363:	53                   	push   %ebx
+  801364:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801367:	83 e0 07             	and    $0x7,%eax
+  80136a:	c1 e0 0c             	shl    $0xc,%eax
+  80136d:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801373:	50                   	push   %eax
+  801374:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801377:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80137a:	01 c8                	add    %ecx,%eax
+  80137c:	50                   	push   %eax
+  80137d:	e8 63 17 00 00       	call   802ae5 <memmove>
+  801382:	83 c4 10             	add    $0x10,%esp
+  801385:	eb a8                	jmp    80132f <fsring_rw+0x2ae>
+  801387:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80138b:	75 09                	jne    801396 <fsring_rw+0x315>
+  80138d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801390:	0f 82 db fe ff ff    	jb     801271 <fsring_rw+0x1f0>
+  801396:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801399:	01 57 04             	add    %edx,0x4(%edi)
+  80139c:	85 d2                	test   %edx,%edx
+  80139e:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013a2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013a5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ab:	5b                   	pop    %ebx
+  8013ac:	5e                   	pop    %esi
+  8013ad:	5f                   	pop    %edi
+  8013ae:	5d                   	pop    %ebp
+  8013af:	c3                   	ret
+
+008013b0 <devfile_write>:
+  8013b0:	55                   	push   %ebp
+  8013b1:	89 e5                	mov    %esp,%ebp
+  8013b3:	57                   	push   %edi
+  8013b4:	56                   	push   %esi
+  8013b5:	53                   	push   %ebx
+  8013b6:	83 ec 0c             	sub    $0xc,%esp
+  8013b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c2:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013c8:	76 1a                	jbe    8013e4 <devfile_write+0x34>
+  8013ca:	83 ec 0c             	sub    $0xc,%esp
+  8013cd:	53                   	push   %ebx
+  8013ce:	89 f1                	mov    %esi,%ecx
+  8013d0:	ba 06 00 00 00       	mov    $0x6,%edx
+  8013d5:	89 f8                	mov    %edi,%eax
+  8013d7:	e8 a5 fc ff ff       	call   801081 <fsring_rw>
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013e2:	75 39                	jne    80141d <devfile_write+0x6d>
+  8013e4:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8013e9:	39 c3                	cmp    %eax,%ebx
+  8013eb:	0f 47 d8             	cmova  %eax,%ebx
+  8013ee:	8b 47 0c             	mov    0xc(%edi),%eax
+  8013f1:	a3 00 60 80 00       	mov    %eax,0x806000
+  8013f6:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8013fc:	83 ec 04             	sub    $0x4,%esp
+  8013ff:	53                   	push   %ebx
+  801400:	56                   	push   %esi
+  801401:	68 08 60 80 00       	push   $0x806008
+  801406:	e8 da 16 00 00       	call   802ae5 <memmove>
+  80140b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801410:	b8 04 00 00 00       	mov    $0x4,%eax
+  801415:	e8 7c fb ff ff       	call   800f96 <fsipc>
+  80141a:	83 c4 10             	add    $0x10,%esp
+  80141d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801420:	5b                   	pop    %ebx
+  801421:	5e                   	pop    %esi
+  801422:	5f                   	pop    %edi
+  801423:	5d                   	pop    %ebp
+  801424:	c3                   	ret
+
+00801425 <devfile_read>:
+  801425:	55                   	push   %ebp
+  801426:	89 e5                	mov    %esp,%ebp
+  801428:	57                   	push   %edi
+  801429:	56                   	push   %esi
+  80142a:	53                   	push   %ebx
+  80142b:	83 ec 0c             	sub    $0xc,%esp
+  80142e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801431:	8b 75 10             	mov    0x10(%ebp),%esi
+  801434:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80143a:	76 1d                	jbe    801459 <devfile_read+0x34>
+  80143c:	83 ec 0c             	sub    $0xc,%esp
+  80143f:	56                   	push   %esi
+  801440:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801443:	ba 05 00 00 00       	mov    $0x5,%edx
+  801448:	89 f8                	mov    %edi,%eax
+  80144a:	e8 32 fc ff ff       	call   801081 <fsring_rw>
+  80144f:	89 c3                	mov    %eax,%ebx
+  801451:	83 c4 10             	add    $0x10,%esp
+  801454:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801457:	75 37                	jne    801490 <devfile_read+0x6b>
+  801459:	8b 47 0c             	mov    0xc(%edi),%eax
+  80145c:	a3 00 60 80 00       	mov    %eax,0x806000
+  801461:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801467:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801471:	e8 20 fb ff ff       	call   800f96 <fsipc>
+  801476:	89 c3                	mov    %eax,%ebx
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	78 14                	js     801490 <devfile_read+0x6b>
+  80147c:	83 ec 04             	sub    $0x4,%esp
+  80147f:	50                   	push   %eax
+  801480:	68 00 60 80 00       	push   $0x806000
+  801485:	ff 75 0c             	push   0xc(%ebp)
+  801488:	e8 58 16 00 00       	call   802ae5 <memmove>
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	89 d8                	mov    %ebx,%eax
+  801492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801495:	5b                   	pop    %ebx
+  801496:	5e                   	pop    %esi
+  801497:	5f                   	pop    %edi
+  801498:	5d                   	pop    %ebp
+  801499:	c3                   	ret
+
+0080149a <open>:
+  80149a:	55                   	push   %ebp
+  80149b:	89 e5                	mov    %esp,%ebp
+  80149d:	56                   	push   %esi
+  80149e:	53                   	push   %ebx
+  80149f:	83 ec 1c             	sub    $0x1c,%esp
+  8014a2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a5:	56                   	push   %esi
+  8014a6:	e8 3e 14 00 00       	call   8028e9 <strlen>
+  8014ab:	83 c4 10             	add    $0x10,%esp
+  8014ae:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014b3:	7f 6c                	jg     801521 <open+0x87>
+  8014b5:	83 ec 0c             	sub    $0xc,%esp
+  8014b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014bb:	50                   	push   %eax
+  8014bc:	e8 6a f5 ff ff       	call   800a2b <fd_alloc>
+  8014c1:	89 c3                	mov    %eax,%ebx
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	78 3c                	js     801506 <open+0x6c>
+  8014ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014cd:	a3 00 64 80 00       	mov    %eax,0x806400
+  8014d2:	83 ec 08             	sub    $0x8,%esp
+  8014d5:	56                   	push   %esi
+  8014d6:	68 00 60 80 00       	push   $0x806000
+  8014db:	e8 55 14 00 00       	call   802935 <strcpy>
+  8014e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e8:	e8 a9 fa ff ff       	call   800f96 <fsipc>
+  8014ed:	89 c3                	mov    %eax,%ebx
+  8014ef:	83 c4 10             	add    $0x10,%esp
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	78 19                	js     80150f <open+0x75>
+  8014f6:	83 ec 0c             	sub    $0xc,%esp
+  8014f9:	ff 75 f4             	push   -0xc(%ebp)
+  8014fc:	e8 03 f5 ff ff       	call   800a04 <fd2num>
+  801501:	89 c3                	mov    %eax,%ebx
+  801503:	83 c4 10             	add    $0x10,%esp
+  801506:	89 d8                	mov    %ebx,%eax
+  801508:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150b:	5b                   	pop    %ebx
+  80150c:	5e                   	pop    %esi
+  80150d:	5d                   	pop    %ebp
+  80150e:	c3                   	ret
+  80150f:	83 ec 08             	sub    $0x8,%esp
+  801512:	6a 00                	push   $0x0
+  801514:	ff 75 f4             	push   -0xc(%ebp)
+  801517:	e8 05 f6 ff ff       	call   800b21 <fd_close>
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	eb e5                	jmp    801506 <open+0x6c>
+  801521:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801526:	eb de                	jmp    801506 <open+0x6c>
+
+00801528 <file_image>:
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	53                   	push   %ebx
+  80152c:	83 ec 1c             	sub    $0x1c,%esp
+  80152f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801532:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801535:	50                   	push   %eax
+  801536:	ff 75 08             	push   0x8(%ebp)
+  801539:	e8 3d f5 ff ff       	call   800a7b <fd_lookup>
+  80153e:	83 c4 10             	add    $0x10,%esp
+  801541:	85 c0                	test   %eax,%eax
+  801543:	78 58                	js     80159d <file_image+0x75>
+  801545:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801548:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80154e:	39 08                	cmp    %ecx,(%eax)
+  801550:	75 50                	jne    8015a2 <file_image+0x7a>
+  801552:	83 fb 04             	cmp    $0x4,%ebx
+  801555:	77 52                	ja     8015a9 <file_image+0x81>
+  801557:	8b 40 0c             	mov    0xc(%eax),%eax
+  80155a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80155f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801565:	83 ec 04             	sub    $0x4,%esp
+  801568:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80156b:	c1 e0 02             	shl    $0x2,%eax
+  80156e:	50                   	push   %eax
+  80156f:	ff 75 0c             	push   0xc(%ebp)
+  801572:	68 08 60 80 00       	push   $0x806008
+  801577:	e8 69 15 00 00       	call   802ae5 <memmove>
+  80157c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801581:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801586:	e8 0b fa ff ff       	call   800f96 <fsipc>
+  80158b:	83 c4 10             	add    $0x10,%esp
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	78 0b                	js     80159d <file_image+0x75>
+  801592:	8b 55 14             	mov    0x14(%ebp),%edx
+  801595:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80159b:	89 0a                	mov    %ecx,(%edx)
+  80159d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a0:	c9                   	leave
+  8015a1:	c3                   	ret
+  8015a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015a7:	eb f4                	jmp    80159d <file_image+0x75>
+  8015a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ae:	eb ed                	jmp    80159d <file_image+0x75>
+
+008015b0 <remove>:
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	53                   	push   %ebx
+  8015b4:	83 ec 10             	sub    $0x10,%esp
+  8015b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015ba:	53                   	push   %ebx
+  8015bb:	e8 29 13 00 00       	call   8028e9 <strlen>
+  8015c0:	83 c4 10             	add    $0x10,%esp
+  8015c3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015c8:	7f 25                	jg     8015ef <remove+0x3f>
+  8015ca:	83 ec 08             	sub    $0x8,%esp
+  8015cd:	53                   	push   %ebx
+  8015ce:	68 00 60 80 00       	push   $0x806000
+  8015d3:	e8 5d 13 00 00       	call   802935 <strcpy>
+  8015d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015dd:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015e2:	e8 af f9 ff ff       	call   800f96 <fsipc>
+  8015e7:	83 c4 10             	add    $0x10,%esp
+  8015ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ed:	c9                   	leave
+  8015ee:	c3                   	ret
+  8015ef:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8015f4:	eb f4                	jmp    8015ea <remove+0x3a>
+
+008015f6 <sync>:
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	83 ec 08             	sub    $0x8,%esp
+  8015fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801601:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801606:	e8 8b f9 ff ff       	call   800f96 <fsipc>
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+
+0080160d <devsock_stat>:
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	83 ec 10             	sub    $0x10,%esp
+  801613:	68 28 32 80 00       	push   $0x803228
+  801618:	ff 75 0c             	push   0xc(%ebp)
+  80161b:	e8 15 13 00 00       	call   802935 <strcpy>
+  801620:	b8 00 00 00 00       	mov    $0x0,%eax
+  801625:	c9                   	leave
+  801626:	c3                   	ret
+
+00801627 <devsock_close>:
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+  80162a:	53                   	push   %ebx
+  80162b:	83 ec 10             	sub    $0x10,%esp
+  80162e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801631:	53                   	push   %ebx
+  801632:	e8 e3 18 00 00       	call   802f1a <pageref>
+  801637:	89 c2                	mov    %eax,%edx
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	83 fa 01             	cmp    $0x1,%edx
+  801644:	74 05                	je     80164b <devsock_close+0x24>
+  801646:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801649:	c9                   	leave
+  80164a:	c3                   	ret
+  80164b:	83 ec 0c             	sub    $0xc,%esp
+  80164e:	ff 73 0c             	push   0xc(%ebx)
+  801651:	e8 aa 02 00 00       	call   801900 <nsipc_close>
+  801656:	83 c4 10             	add    $0x10,%esp
+  801659:	eb eb                	jmp    801646 <devsock_close+0x1f>
+
+0080165b <devsock_write>:
+  80165b:	55                   	push   %ebp
+  80165c:	89 e5                	mov    %esp,%ebp
+  80165e:	83 ec 08             	sub    $0x8,%esp
+  801661:	6a 00                	push   $0x0
+  801663:	ff 75 10             	push   0x10(%ebp)
+  801666:	ff 75 0c             	push   0xc(%ebp)
+  801669:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166c:	ff 70 0c             	push   0xc(%eax)
+  80166f:	e8 6c 03 00 00       	call   8019e0 <nsipc_send>
+  801674:	c9                   	leave
+  801675:	c3                   	ret
+
+00801676 <devsock_read>:
+  801676:	55                   	push   %ebp
+  801677:	89 e5                	mov    %esp,%ebp
+  801679:	83 ec 08             	sub    $0x8,%esp
+  80167c:	6a 00                	push   $0x0
+  80167e:	ff 75 10             	push   0x10(%ebp)
+  801681:	ff 75 0c             	push   0xc(%ebp)
+  801684:	8b 45 08             	mov    0x8(%ebp),%eax
+  801687:	ff 70 0c             	push   0xc(%eax)
+  80168a:	e8 e2 02 00 00       	call   801971 <nsipc_recv>
+  80168f:	c9                   	leave
+  801690:	c3                   	ret
+
+00801691 <fd2sockid>:
+  801691:	55                   	push   %ebp
+  801692:	89 e5                	mov    %esp,%ebp
+  801694:	83 ec 20             	sub    $0x20,%esp
+  801697:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80169a:	52                   	push   %edx
+  80169b:	50                   	push   %eax
+  80169c:	e8 da f3 ff ff       	call   800a7b <fd_lookup>
+  8016a1:	83 c4 10             	add    $0x10,%esp
+  8016a4:	85 c0                	test   %eax,%eax
+  8016a6:	78 10                	js     8016b8 <fd2sockid+0x27>
+  8016a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ab:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016b1:	39 08                	cmp    %ecx,(%eax)
+  8016b3:	75 05                	jne    8016ba <fd2sockid+0x29>
+  8016b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016b8:	c9                   	leave
+  8016b9:	c3                   	ret
+  8016ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016bf:	eb f7                	jmp    8016b8 <fd2sockid+0x27>
+
+008016c1 <alloc_sockfd>:
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	56                   	push   %esi
+  8016c5:	53                   	push   %ebx
+  8016c6:	83 ec 1c             	sub    $0x1c,%esp
+  8016c9:	89 c6                	mov    %eax,%esi
+  8016cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ce:	50                   	push   %eax
+  8016cf:	e8 57 f3 ff ff       	call   800a2b <fd_alloc>
+  8016d4:	89 c3                	mov    %eax,%ebx
+  8016d6:	83 c4 10             	add    $0x10,%esp
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	78 43                	js     801720 <alloc_sockfd+0x5f>
+  8016dd:	83 ec 04             	sub    $0x4,%esp
+  8016e0:	68 07 04 00 00       	push   $0x407
+  8016e5:	ff 75 f4             	push   -0xc(%ebp)
+  8016e8:	6a 00                	push   $0x0
+  8016ea:	e8 a7 ea ff ff       	call   800196 <sys_page_alloc>
+  8016ef:	89 c3                	mov    %eax,%ebx
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	85 c0                	test   %eax,%eax
+  8016f6:	78 28                	js     801720 <alloc_sockfd+0x5f>
+  8016f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fb:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801701:	89 10                	mov    %edx,(%eax)
+  801703:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801706:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80170d:	89 70 0c             	mov    %esi,0xc(%eax)
+  801710:	83 ec 0c             	sub    $0xc,%esp
+  801713:	50                   	push   %eax
+  801714:	e8 eb f2 ff ff       	call   800a04 <fd2num>
+  801719:	89 c3                	mov    %eax,%ebx
+  80171b:	83 c4 10             	add    $0x10,%esp
+  80171e:	eb 0c                	jmp    80172c <alloc_sockfd+0x6b>
+  801720:	83 ec 0c             	sub    $0xc,%esp
+  801723:	56                   	push   %esi
+  801724:	e8 d7 01 00 00       	call   801900 <nsipc_close>
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	89 d8                	mov    %ebx,%eax
+  80172e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801731:	5b                   	pop    %ebx
+  801732:	5e                   	pop    %esi
+  801733:	5d                   	pop    %ebp
+  801734:	c3                   	ret
+
+00801735 <accept>:
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	83 ec 08             	sub    $0x8,%esp
+  80173b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80173e:	e8 4e ff ff ff       	call   801691 <fd2sockid>
+  801743:	85 c0                	test   %eax,%eax
+  801745:	78 1b                	js     801762 <accept+0x2d>
+  801747:	83 ec 04             	sub    $0x4,%esp
+  80174a:	ff 75 10             	push   0x10(%ebp)
+  80174d:	ff 75 0c             	push   0xc(%ebp)
+  801750:	50                   	push   %eax
+  801751:	e8 07 01 00 00       	call   80185d <nsipc_accept>
+  801756:	83 c4 10             	add    $0x10,%esp
+  801759:	85 c0                	test   %eax,%eax
+  80175b:	78 05                	js     801762 <accept+0x2d>
+  80175d:	e8 5f ff ff ff       	call   8016c1 <alloc_sockfd>
+  801762:	c9                   	leave
+  801763:	c3                   	ret
+
+00801764 <bind>:
+  801764:	55                   	push   %ebp
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	83 ec 08             	sub    $0x8,%esp
+  80176a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176d:	e8 1f ff ff ff       	call   801691 <fd2sockid>
+  801772:	85 c0                	test   %eax,%eax
+  801774:	78 12                	js     801788 <bind+0x24>
+  801776:	83 ec 04             	sub    $0x4,%esp
+  801779:	ff 75 10             	push   0x10(%ebp)
+  80177c:	ff 75 0c             	push   0xc(%ebp)
+  80177f:	50                   	push   %eax
+  801780:	e8 24 01 00 00       	call   8018a9 <nsipc_bind>
+  801785:	83 c4 10             	add    $0x10,%esp
+  801788:	c9                   	leave
+  801789:	c3                   	ret
+
+0080178a <shutdown>:
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	83 ec 08             	sub    $0x8,%esp
+  801790:	8b 45 08             	mov    0x8(%ebp),%eax
+  801793:	e8 f9 fe ff ff       	call   801691 <fd2sockid>
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	78 0f                	js     8017ab <shutdown+0x21>
+  80179c:	83 ec 08             	sub    $0x8,%esp
+  80179f:	ff 75 0c             	push   0xc(%ebp)
+  8017a2:	50                   	push   %eax
+  8017a3:	e8 36 01 00 00       	call   8018de <nsipc_shutdown>
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	c9                   	leave
+  8017ac:	c3                   	ret
+
+008017ad <connect>:
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	83 ec 08             	sub    $0x8,%esp
+  8017b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b6:	e8 d6 fe ff ff       	call   801691 <fd2sockid>
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	78 12                	js     8017d1 <connect+0x24>
+  8017bf:	83 ec 04             	sub    $0x4,%esp
+  8017c2:	ff 75 10             	push   0x10(%ebp)
+  8017c5:	ff 75 0c             	push   0xc(%ebp)
+  8017c8:	50                   	push   %eax
+  8017c9:	e8 4c 01 00 00       	call   80191a <nsipc_connect>
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	c9                   	leave
+  8017d2:	c3                   	ret
+
+008017d3 <listen>:
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	83 ec 08             	sub    $0x8,%esp
+  8017d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017dc:	e8 b0 fe ff ff       	call   801691 <fd2sockid>
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	78 0f                	js     8017f4 <listen+0x21>
+  8017e5:	83 ec 08             	sub    $0x8,%esp
+  8017e8:	ff 75 0c             	push   0xc(%ebp)
+  8017eb:	50                   	push   %eax
+  8017ec:	e8 5e 01 00 00       	call   80194f <nsipc_listen>
+  8017f1:	83 c4 10             	add    $0x10,%esp
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+
+008017f6 <socket>:
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	83 ec 0c             	sub    $0xc,%esp
+  8017fc:	ff 75 10             	push   0x10(%ebp)
+  8017ff:	ff 75 0c             	push   0xc(%ebp)
+  801802:	ff 75 08             	push   0x8(%ebp)
+  801805:	e8 34 02 00 00       	call   801a3e <nsipc_socket>
+  80180a:	83 c4 10             	add    $0x10,%esp
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	78 05                	js     801816 <socket+0x20>
+  801811:	e8 ab fe ff ff       	call   8016c1 <alloc_sockfd>
+  801816:	c9                   	leave
+  801817:	c3                   	ret
+
+00801818 <nsipc>:
+  801818:	55                   	push   %ebp
+  801819:	89 e5                	mov    %esp,%ebp
+  80181b:	53                   	push   %ebx
+  80181c:	83 ec 04             	sub    $0x4,%esp
+  80181f:	89 c3                	mov    %eax,%ebx
+  801821:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801828:	74 1f                	je     801849 <nsipc+0x31>
+  80182a:	83 ec 08             	sub    $0x8,%esp
+  80182d:	6a 00                	push   $0x0
+  80182f:	6a 00                	push   $0x0
+  801831:	6a 07                	push   $0x7
+  801833:	68 00 70 80 00       	push   $0x807000
+  801838:	53                   	push   %ebx
+  801839:	ff 35 0c 50 80 00    	push   0x80500c
+  80183f:	e8 21 15 00 00       	call   802d65 <ipc_call>
+  801844:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801847:	c9                   	leave
+  801848:	c3                   	ret
+  801849:	83 ec 0c             	sub    $0xc,%esp
+  80184c:	6a 03                	push   $0x3
+  80184e:	e8 ad 16 00 00       	call   802f00 <ipc_find_env>
+  801853:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801858:	83 c4 10             	add    $0x10,%esp
+  80185b:	eb cd                	jmp    80182a <nsipc+0x12>
+
+0080185d <nsipc_accept>:
+  80185d:	55                   	push   %ebp
+  80185e:	89 e5                	mov    %esp,%ebp
+  801860:	53                   	push   %ebx
+  801861:	83 ec 04             	sub    $0x4,%esp
+  801864:	8b 45 08             	mov    0x8(%ebp),%eax
+  801867:	a3 00 70 80 00       	mov    %eax,0x807000
+  80186c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801871:	e8 a2 ff ff ff       	call   801818 <nsipc>
+  801876:	89 c3                	mov    %eax,%ebx
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	79 07                	jns    801883 <nsipc_accept+0x26>
+  80187c:	89 d8                	mov    %ebx,%eax
+  80187e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801881:	c9                   	leave
+  801882:	c3                   	ret
+  801883:	83 ec 04             	sub    $0x4,%esp
+  801886:	ff 35 10 70 80 00    	push   0x807010
+  80188c:	68 00 70 80 00       	push   $0x807000
+  801891:	ff 75 0c             	push   0xc(%ebp)
+  801894:	e8 4c 12 00 00       	call   802ae5 <memmove>
+  801899:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80189f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018a2:	89 10                	mov    %edx,(%eax)
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  8018a7:	eb d3                	jmp    80187c <nsipc_accept+0x1f>
+
+008018a9 <nsipc_bind>:
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	53                   	push   %ebx
+  8018ad:	83 ec 08             	sub    $0x8,%esp
+  8018b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018bb:	53                   	push   %ebx
+  8018bc:	ff 75 0c             	push   0xc(%ebp)
+  8018bf:	68 04 70 80 00       	push   $0x807004
+  8018c4:	e8 1c 12 00 00       	call   802ae5 <memmove>
+  8018c9:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018d4:	e8 3f ff ff ff       	call   801818 <nsipc>
+  8018d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018dc:	c9                   	leave
+  8018dd:	c3                   	ret
+
+008018de <nsipc_shutdown>:
+  8018de:	55                   	push   %ebp
+  8018df:	89 e5                	mov    %esp,%ebp
+  8018e1:	83 ec 08             	sub    $0x8,%esp
+  8018e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e7:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018ef:	a3 04 70 80 00       	mov    %eax,0x807004
+  8018f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018f9:	e8 1a ff ff ff       	call   801818 <nsipc>
+  8018fe:	c9                   	leave
+  8018ff:	c3                   	ret
+
+00801900 <nsipc_close>:
+  801900:	55                   	push   %ebp
+  801901:	89 e5                	mov    %esp,%ebp
+  801903:	83 ec 08             	sub    $0x8,%esp
+  801906:	8b 45 08             	mov    0x8(%ebp),%eax
+  801909:	a3 00 70 80 00       	mov    %eax,0x807000
+  80190e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801913:	e8 00 ff ff ff       	call   801818 <nsipc>
+  801918:	c9                   	leave
+  801919:	c3                   	ret
+
+0080191a <nsipc_connect>:
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	53                   	push   %ebx
+  80191e:	83 ec 08             	sub    $0x8,%esp
+  801921:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801924:	8b 45 08             	mov    0x8(%ebp),%eax
+  801927:	a3 00 70 80 00       	mov    %eax,0x807000
+  80192c:	53                   	push   %ebx
+  80192d:	ff 75 0c             	push   0xc(%ebp)
+  801930:	68 04 70 80 00       	push   $0x807004
+  801935:	e8 ab 11 00 00       	call   802ae5 <memmove>
+  80193a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801940:	b8 05 00 00 00       	mov    $0x5,%eax
+  801945:	e8 ce fe ff ff       	call   801818 <nsipc>
+  80194a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80194d:	c9                   	leave
+  80194e:	c3                   	ret
+
+0080194f <nsipc_listen>:
+  80194f:	55                   	push   %ebp
+  801950:	89 e5                	mov    %esp,%ebp
+  801952:	83 ec 08             	sub    $0x8,%esp
+  801955:	8b 45 08             	mov    0x8(%ebp),%eax
+  801958:	a3 00 70 80 00       	mov    %eax,0x807000
+  80195d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801960:	a3 04 70 80 00       	mov    %eax,0x807004
+  801965:	b8 06 00 00 00       	mov    $0x6,%eax
+  80196a:	e8 a9 fe ff ff       	call   801818 <nsipc>
+  80196f:	c9                   	leave
+  801970:	c3                   	ret
+
+00801971 <nsipc_recv>:
+  801971:	55                   	push   %ebp
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	56                   	push   %esi
+  801975:	53                   	push   %ebx
+  801976:	8b 75 10             	mov    0x10(%ebp),%esi
+  801979:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801981:	89 35 04 70 80 00    	mov    %esi,0x807004
+  801987:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198a:	a3 08 70 80 00       	mov    %eax,0x807008
+  80198f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801994:	e8 7f fe ff ff       	call   801818 <nsipc>
+  801999:	89 c3                	mov    %eax,%ebx
+  80199b:	85 c0                	test   %eax,%eax
+  80199d:	78 22                	js     8019c1 <nsipc_recv+0x50>
+  80199f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019a4:	39 c6                	cmp    %eax,%esi
+  8019a6:	0f 4e c6             	cmovle %esi,%eax
+  8019a9:	39 c3                	cmp    %eax,%ebx
+  8019ab:	7f 1d                	jg     8019ca <nsipc_recv+0x59>
+  8019ad:	83 ec 04             	sub    $0x4,%esp
+  8019b0:	53                   	push   %ebx
+  8019b1:	68 00 70 80 00       	push   $0x807000
+  8019b6:	ff 75 0c             	push   0xc(%ebp)
+  8019b9:	e8 27 11 00 00       	call   802ae5 <memmove>
+  8019be:	83 c4 10             	add    $0x10,%esp
+  8019c1:	89 d8                	mov    %ebx,%eax
+  8019c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c6:	5b                   	pop    %ebx
+  8019c7:	5e                   	pop    %esi
+  8019c8:	5d                   	pop    %ebp
+  8019c9:	c3                   	ret
+  8019ca:	68 34 32 80 00       	push   $0x803234
+  8019cf:	68 49 32 80 00       	push   $0x803249
+  8019d4:	6a 60                	push   $0x60
+  8019d6:	68 5e 32 80 00       	push   $0x80325e
+  8019db:	e8 83 07 00 00       	call   802163 <_panic>
+
+008019e0 <nsipc_send>:
+  8019e0:	55                   	push   %ebp
+  8019e1:	89 e5                	mov    %esp,%ebp
+  8019e3:	53                   	push   %ebx
+  8019e4:	83 ec 04             	sub    $0x4,%esp
+  8019e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ed:	a3 00 70 80 00       	mov    %eax,0x807000
+  8019f2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019f8:	7f 2e                	jg     801a28 <nsipc_send+0x48>
+  8019fa:	83 ec 04             	sub    $0x4,%esp
+  8019fd:	53                   	push   %ebx
+  8019fe:	ff 75 0c             	push   0xc(%ebp)
+  801a01:	68 0c 70 80 00       	push   $0x80700c
+  801a06:	e8 da 10 00 00       	call   802ae5 <memmove>
+  801a0b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a11:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a14:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a19:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a1e:	e8 f5 fd ff ff       	call   801818 <nsipc>
+  801a23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a26:	c9                   	leave
+  801a27:	c3                   	ret
+  801a28:	68 6a 32 80 00       	push   $0x80326a
+  801a2d:	68 49 32 80 00       	push   $0x803249
+  801a32:	6a 6b                	push   $0x6b
+  801a34:	68 5e 32 80 00       	push   $0x80325e
+  801a39:	e8 25 07 00 00       	call   802163 <_panic>
+
+00801a3e <nsipc_socket>:
+  801a3e:	55                   	push   %ebp
+  801a3f:	89 e5                	mov    %esp,%ebp
+  801a41:	83 ec 08             	sub    $0x8,%esp
+  801a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a47:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a4f:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a54:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a57:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a5c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a61:	e8 b2 fd ff ff       	call   801818 <nsipc>
+  801a66:	c9                   	leave
+  801a67:	c3                   	ret
+
+00801a68 <devpipe_stat>:
+  801a68:	55                   	push   %ebp
+  801a69:	89 e5                	mov    %esp,%ebp
+  801a6b:	56                   	push   %esi
+  801a6c:	53                   	push   %ebx
+  801a6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a70:	83 ec 0c             	sub    $0xc,%esp
+  801a73:	ff 75 08             	push   0x8(%ebp)
+  801a76:	e8 99 ef ff ff       	call   800a14 <fd2data>
+  801a7b:	89 c6                	mov    %eax,%esi
+  801a7d:	83 c4 08             	add    $0x8,%esp
+  801a80:	68 76 32 80 00       	push   $0x803276
+  801a85:	53                   	push   %ebx
+  801a86:	e8 aa 0e 00 00       	call   802935 <strcpy>
+  801a8b:	8b 46 04             	mov    0x4(%esi),%eax
+  801a8e:	2b 06                	sub    (%esi),%eax
+  801a90:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801a96:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a9d:	00 00 00 
+  801aa0:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801aa7:	40 80 00 
+  801aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab2:	5b                   	pop    %ebx
+  801ab3:	5e                   	pop    %esi
+  801ab4:	5d                   	pop    %ebp
+  801ab5:	c3                   	ret
+
+00801ab6 <devpipe_close>:
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+  801ab9:	53                   	push   %ebx
+  801aba:	83 ec 0c             	sub    $0xc,%esp
+  801abd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ac0:	53                   	push   %ebx
+  801ac1:	6a 00                	push   $0x0
+  801ac3:	e8 a0 e7 ff ff       	call   800268 <sys_page_unmap>
+  801ac8:	89 1c 24             	mov    %ebx,(%esp)
+  801acb:	e8 44 ef ff ff       	call   800a14 <fd2data>
+  801ad0:	83 c4 08             	add    $0x8,%esp
+  801ad3:	50                   	push   %eax
+  801ad4:	6a 00                	push   $0x0
+  801ad6:	e8 8d e7 ff ff       	call   800268 <sys_page_unmap>
+  801adb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ade:	c9                   	leave
+  801adf:	c3                   	ret
+
+00801ae0 <_pipeisclosed>:
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	57                   	push   %edi
+  801ae4:	56                   	push   %esi
+  801ae5:	53                   	push   %ebx
+  801ae6:	83 ec 1c             	sub    $0x1c,%esp
+  801ae9:	89 c7                	mov    %eax,%edi
+  801aeb:	89 d6                	mov    %edx,%esi
+  801aed:	a1 10 50 80 00       	mov    0x805010,%eax
+  801af2:	8b 58 58             	mov    0x58(%eax),%ebx
+  801af5:	83 ec 0c             	sub    $0xc,%esp
+  801af8:	57                   	push   %edi
+  801af9:	e8 1c 14 00 00       	call   802f1a <pageref>
+  801afe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b01:	89 34 24             	mov    %esi,(%esp)
+  801b04:	e8 11 14 00 00       	call   802f1a <pageref>
+  801b09:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b0f:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	39 cb                	cmp    %ecx,%ebx
+  801b17:	74 1b                	je     801b34 <_pipeisclosed+0x54>
+  801b19:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b1c:	75 cf                	jne    801aed <_pipeisclosed+0xd>
+  801b1e:	8b 42 58             	mov    0x58(%edx),%eax
+  801b21:	6a 01                	push   $0x1
+  801b23:	50                   	push   %eax
+  801b24:	53                   	push   %ebx
+  801b25:	68 7d 32 80 00       	push   $0x80327d
+  801b2a:	e8 0f 07 00 00       	call   80223e <cprintf>
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	eb b9                	jmp    801aed <_pipeisclosed+0xd>
+  801b34:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b37:	0f 94 c0             	sete   %al
+  801b3a:	0f b6 c0             	movzbl %al,%eax
+  801b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b40:	5b                   	pop    %ebx
+  801b41:	5e                   	pop    %esi
+  801b42:	5f                   	pop    %edi
+  801b43:	5d                   	pop    %ebp
+  801b44:	c3                   	ret
+
+00801b45 <devpipe_write>:
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	57                   	push   %edi
+  801b49:	56                   	push   %esi
+  801b4a:	53                   	push   %ebx
+  801b4b:	83 ec 28             	sub    $0x28,%esp
+  801b4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b51:	56                   	push   %esi
+  801b52:	e8 bd ee ff ff       	call   800a14 <fd2data>
+  801b57:	89 c3                	mov    %eax,%ebx
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b61:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b65:	74 5c                	je     801bc3 <devpipe_write+0x7e>
+  801b67:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b6a:	8b 0b                	mov    (%ebx),%ecx
+  801b6c:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b6f:	39 d0                	cmp    %edx,%eax
+  801b71:	72 1e                	jb     801b91 <devpipe_write+0x4c>
+  801b73:	89 da                	mov    %ebx,%edx
+  801b75:	89 f0                	mov    %esi,%eax
+  801b77:	e8 64 ff ff ff       	call   801ae0 <_pipeisclosed>
+  801b7c:	85 c0                	test   %eax,%eax
+  801b7e:	75 48                	jne    801bc8 <devpipe_write+0x83>
+  801b80:	e8 c6 e5 ff ff       	call   80014b <sys_yield>
+  801b85:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b88:	8b 0b                	mov    (%ebx),%ecx
+  801b8a:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b8d:	39 d0                	cmp    %edx,%eax
+  801b8f:	73 e2                	jae    801b73 <devpipe_write+0x2e>
+  801b91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b94:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b98:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801b9b:	89 c2                	mov    %eax,%edx
+  801b9d:	c1 fa 1f             	sar    $0x1f,%edx
+  801ba0:	89 d1                	mov    %edx,%ecx
+  801ba2:	c1 e9 1b             	shr    $0x1b,%ecx
+  801ba5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ba8:	83 e2 1f             	and    $0x1f,%edx
+  801bab:	29 ca                	sub    %ecx,%edx
+  801bad:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bb1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bb5:	83 c0 01             	add    $0x1,%eax
+  801bb8:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bbb:	83 c7 01             	add    $0x1,%edi
+  801bbe:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bc1:	75 a4                	jne    801b67 <devpipe_write+0x22>
+  801bc3:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bc6:	eb 05                	jmp    801bcd <devpipe_write+0x88>
+  801bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd0:	5b                   	pop    %ebx
+  801bd1:	5e                   	pop    %esi
+  801bd2:	5f                   	pop    %edi
+  801bd3:	5d                   	pop    %ebp
+  801bd4:	c3                   	ret
+
+00801bd5 <devpipe_read>:
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	57                   	push   %edi
+  801bd9:	56                   	push   %esi
+  801bda:	53                   	push   %ebx
+  801bdb:	83 ec 18             	sub    $0x18,%esp
+  801bde:	8b 75 08             	mov    0x8(%ebp),%esi
+  801be1:	56                   	push   %esi
+  801be2:	e8 2d ee ff ff       	call   800a14 <fd2data>
+  801be7:	89 c3                	mov    %eax,%ebx
+  801be9:	83 c4 10             	add    $0x10,%esp
+  801bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801bf5:	74 45                	je     801c3c <devpipe_read+0x67>
+  801bf7:	8b 03                	mov    (%ebx),%eax
+  801bf9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801bfc:	75 1d                	jne    801c1b <devpipe_read+0x46>
+  801bfe:	85 ff                	test   %edi,%edi
+  801c00:	75 3f                	jne    801c41 <devpipe_read+0x6c>
+  801c02:	89 da                	mov    %ebx,%edx
+  801c04:	89 f0                	mov    %esi,%eax
+  801c06:	e8 d5 fe ff ff       	call   801ae0 <_pipeisclosed>
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	75 3c                	jne    801c4b <devpipe_read+0x76>
+  801c0f:	e8 37 e5 ff ff       	call   80014b <sys_yield>
+  801c14:	8b 03                	mov    (%ebx),%eax
+  801c16:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c19:	74 e7                	je     801c02 <devpipe_read+0x2d>
+  801c1b:	99                   	cltd
+  801c1c:	c1 ea 1b             	shr    $0x1b,%edx
+  801c1f:	01 d0                	add    %edx,%eax
+  801c21:	83 e0 1f             	and    $0x1f,%eax
+  801c24:	29 d0                	sub    %edx,%eax
+  801c26:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c2e:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c31:	83 03 01             	addl   $0x1,(%ebx)
+  801c34:	83 c7 01             	add    $0x1,%edi
+  801c37:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c3a:	75 bb                	jne    801bf7 <devpipe_read+0x22>
+  801c3c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c3f:	eb 02                	jmp    801c43 <devpipe_read+0x6e>
+  801c41:	89 f8                	mov    %edi,%eax
+  801c43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c46:	5b                   	pop    %ebx
+  801c47:	5e                   	pop    %esi
+  801c48:	5f                   	pop    %edi
+  801c49:	5d                   	pop    %ebp
+  801c4a:	c3                   	ret
+  801c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c50:	eb f1                	jmp    801c43 <devpipe_read+0x6e>
+
+00801c52 <pipe>:
+  801c52:	55                   	push   %ebp
+  801c53:	89 e5                	mov    %esp,%ebp
+  801c55:	56                   	push   %esi
+  801c56:	53                   	push   %ebx
+  801c57:	83 ec 1c             	sub    $0x1c,%esp
+  801c5a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c5d:	50                   	push   %eax
+  801c5e:	e8 c8 ed ff ff       	call   800a2b <fd_alloc>
+  801c63:	89 c3                	mov    %eax,%ebx
+  801c65:	83 c4 10             	add    $0x10,%esp
+  801c68:	85 c0                	test   %eax,%eax
+  801c6a:	0f 88 23 01 00 00    	js     801d93 <pipe+0x141>
+  801c70:	83 ec 04             	sub    $0x4,%esp
+  801c73:	68 07 04 00 00       	push   $0x407
+  801c78:	ff 75 f4             	push   -0xc(%ebp)
+  801c7b:	6a 00                	push   $0x0
+  801c7d:	e8 14 e5 ff ff       	call   800196 <sys_page_alloc>
+  801c82:	89 c3                	mov    %eax,%ebx
+  801c84:	83 c4 10             	add    $0x10,%esp
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	0f 88 04 01 00 00    	js     801d93 <pipe+0x141>
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+  801c92:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c95:	50                   	push   %eax
+  801c96:	e8 90 ed ff ff       	call   800a2b <fd_alloc>
+  801c9b:	89 c3                	mov    %eax,%ebx
+  801c9d:	83 c4 10             	add    $0x10,%esp
+  801ca0:	85 c0                	test   %eax,%eax
+  801ca2:	0f 88 db 00 00 00    	js     801d83 <pipe+0x131>
+  801ca8:	83 ec 04             	sub    $0x4,%esp
+  801cab:	68 07 04 00 00       	push   $0x407
+  801cb0:	ff 75 f0             	push   -0x10(%ebp)
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	e8 dc e4 ff ff       	call   800196 <sys_page_alloc>
+  801cba:	89 c3                	mov    %eax,%ebx
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	0f 88 bc 00 00 00    	js     801d83 <pipe+0x131>
+  801cc7:	83 ec 0c             	sub    $0xc,%esp
+  801cca:	ff 75 f4             	push   -0xc(%ebp)
+  801ccd:	e8 42 ed ff ff       	call   800a14 <fd2data>
+  801cd2:	89 c6                	mov    %eax,%esi
+  801cd4:	83 c4 0c             	add    $0xc,%esp
+  801cd7:	68 07 04 00 00       	push   $0x407
+  801cdc:	50                   	push   %eax
+  801cdd:	6a 00                	push   $0x0
+  801cdf:	e8 b2 e4 ff ff       	call   800196 <sys_page_alloc>
+  801ce4:	89 c3                	mov    %eax,%ebx
+  801ce6:	83 c4 10             	add    $0x10,%esp
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	0f 88 82 00 00 00    	js     801d73 <pipe+0x121>
+  801cf1:	83 ec 0c             	sub    $0xc,%esp
+  801cf4:	ff 75 f0             	push   -0x10(%ebp)
+  801cf7:	e8 18 ed ff ff       	call   800a14 <fd2data>
+  801cfc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d03:	50                   	push   %eax
+  801d04:	6a 00                	push   $0x0
+  801d06:	56                   	push   %esi
+  801d07:	6a 00                	push   $0x0
+  801d09:	e8 cb e4 ff ff       	call   8001d9 <sys_page_map>
+  801d0e:	89 c3                	mov    %eax,%ebx
+  801d10:	83 c4 20             	add    $0x20,%esp
+  801d13:	85 c0                	test   %eax,%eax
+  801d15:	78 4e                	js     801d65 <pipe+0x113>
+  801d17:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d1c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d1f:	89 02                	mov    %eax,(%edx)
+  801d21:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d24:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d2b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d2e:	89 02                	mov    %eax,(%edx)
+  801d30:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d33:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d3a:	83 ec 0c             	sub    $0xc,%esp
+  801d3d:	ff 75 f4             	push   -0xc(%ebp)
+  801d40:	e8 bf ec ff ff       	call   800a04 <fd2num>
+  801d45:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d48:	89 01                	mov    %eax,(%ecx)
+  801d4a:	83 c4 04             	add    $0x4,%esp
+  801d4d:	ff 75 f0             	push   -0x10(%ebp)
+  801d50:	e8 af ec ff ff       	call   800a04 <fd2num>
+  801d55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d58:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d63:	eb 2e                	jmp    801d93 <pipe+0x141>
+  801d65:	83 ec 08             	sub    $0x8,%esp
+  801d68:	56                   	push   %esi
+  801d69:	6a 00                	push   $0x0
+  801d6b:	e8 f8 e4 ff ff       	call   800268 <sys_page_unmap>
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	83 ec 08             	sub    $0x8,%esp
+  801d76:	ff 75 f0             	push   -0x10(%ebp)
+  801d79:	6a 00                	push   $0x0
+  801d7b:	e8 e8 e4 ff ff       	call   800268 <sys_page_unmap>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	83 ec 08             	sub    $0x8,%esp
+  801d86:	ff 75 f4             	push   -0xc(%ebp)
+  801d89:	6a 00                	push   $0x0
+  801d8b:	e8 d8 e4 ff ff       	call   800268 <sys_page_unmap>
+  801d90:	83 c4 10             	add    $0x10,%esp
+  801d93:	89 d8                	mov    %ebx,%eax
+  801d95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d98:	5b                   	pop    %ebx
+  801d99:	5e                   	pop    %esi
+  801d9a:	5d                   	pop    %ebp
+  801d9b:	c3                   	ret
+
+00801d9c <pipeisclosed>:
+  801d9c:	55                   	push   %ebp
+  801d9d:	89 e5                	mov    %esp,%ebp
+  801d9f:	83 ec 20             	sub    $0x20,%esp
+  801da2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da5:	50                   	push   %eax
+  801da6:	ff 75 08             	push   0x8(%ebp)
+  801da9:	e8 cd ec ff ff       	call   800a7b <fd_lookup>
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	78 18                	js     801dcd <pipeisclosed+0x31>
+  801db5:	83 ec 0c             	sub    $0xc,%esp
+  801db8:	ff 75 f4             	push   -0xc(%ebp)
+  801dbb:	e8 54 ec ff ff       	call   800a14 <fd2data>
+  801dc0:	89 c2                	mov    %eax,%edx
+  801dc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc5:	e8 16 fd ff ff       	call   801ae0 <_pipeisclosed>
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	c9                   	leave
+  801dce:	c3                   	ret
+
+00801dcf <ipcring_init>:
+  801dcf:	55                   	push   %ebp
+  801dd0:	89 e5                	mov    %esp,%ebp
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 08             	sub    $0x8,%esp
+  801dd6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dd9:	6a 60                	push   $0x60
+  801ddb:	6a 00                	push   $0x0
+  801ddd:	53                   	push   %ebx
+  801dde:	e8 cd 0c 00 00       	call   802ab0 <memset>
+  801de3:	a1 10 50 80 00       	mov    0x805010,%eax
+  801de8:	8b 40 48             	mov    0x48(%eax),%eax
+  801deb:	89 03                	mov    %eax,(%ebx)
+  801ded:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801df0:	89 43 04             	mov    %eax,0x4(%ebx)
+  801df3:	8b 45 10             	mov    0x10(%ebp),%eax
+  801df6:	89 43 08             	mov    %eax,0x8(%ebx)
+  801df9:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dfc:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801dff:	83 c4 10             	add    $0x10,%esp
+  801e02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+00801e07 <ipcring_req_slot>:
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0d:	8b 50 10             	mov    0x10(%eax),%edx
+  801e10:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e13:	29 ca                	sub    %ecx,%edx
+  801e15:	83 fa 07             	cmp    $0x7,%edx
+  801e18:	77 0c                	ja     801e26 <ipcring_req_slot+0x1f>
+  801e1a:	8b 50 10             	mov    0x10(%eax),%edx
+  801e1d:	83 e2 07             	and    $0x7,%edx
+  801e20:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e24:	5d                   	pop    %ebp
+  801e25:	c3                   	ret
+  801e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2b:	eb f7                	jmp    801e24 <ipcring_req_slot+0x1d>
+
+00801e2d <ipcring_req_push>:
+  801e2d:	55                   	push   %ebp
+  801e2e:	89 e5                	mov    %esp,%ebp
+  801e30:	83 ec 08             	sub    $0x8,%esp
+  801e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e36:	8b 42 10             	mov    0x10(%edx),%eax
+  801e39:	83 c0 01             	add    $0x1,%eax
+  801e3c:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e45:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e49:	85 c0                	test   %eax,%eax
+  801e4b:	75 02                	jne    801e4f <ipcring_req_push+0x22>
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+  801e4f:	6a 00                	push   $0x0
+  801e51:	68 00 00 80 ee       	push   $0xee800000
+  801e56:	ff 72 08             	push   0x8(%edx)
+  801e59:	ff 72 04             	push   0x4(%edx)
+  801e5c:	e8 6d e6 ff ff       	call   8004ce <sys_ipc_send>
+  801e61:	83 c4 10             	add    $0x10,%esp
+  801e64:	eb e7                	jmp    801e4d <ipcring_req_push+0x20>
+
+00801e66 <ipcring_rsp_wait>:
+  801e66:	55                   	push   %ebp
+  801e67:	89 e5                	mov    %esp,%ebp
+  801e69:	53                   	push   %ebx
+  801e6a:	83 ec 04             	sub    $0x4,%esp
+  801e6d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e70:	8b 53 18             	mov    0x18(%ebx),%edx
+  801e73:	8b 43 10             	mov    0x10(%ebx),%eax
+  801e76:	39 c2                	cmp    %eax,%edx
+  801e78:	74 3c                	je     801eb6 <ipcring_rsp_wait+0x50>
+  801e7a:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e7d:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e80:	39 c2                	cmp    %eax,%edx
+  801e82:	75 23                	jne    801ea7 <ipcring_rsp_wait+0x41>
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	6a 00                	push   $0x0
+  801e89:	6a 00                	push   $0x0
+  801e8b:	6a 00                	push   $0x0
+  801e8d:	6a 00                	push   $0x0
+  801e8f:	ff 73 0c             	push   0xc(%ebx)
+  801e92:	ff 73 04             	push   0x4(%ebx)
+  801e95:	e8 cb 0e 00 00       	call   802d65 <ipc_call>
+  801e9a:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e9d:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ea0:	83 c4 20             	add    $0x20,%esp
+  801ea3:	39 c2                	cmp    %eax,%edx
+  801ea5:	74 dd                	je     801e84 <ipcring_rsp_wait+0x1e>
+  801ea7:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eaa:	83 e0 07             	and    $0x7,%eax
+  801ead:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801eb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb4:	c9                   	leave
+  801eb5:	c3                   	ret
+  801eb6:	68 98 32 80 00       	push   $0x803298
+  801ebb:	68 49 32 80 00       	push   $0x803249
+  801ec0:	6a 3b                	push   $0x3b
+  801ec2:	68 b9 32 80 00       	push   $0x8032b9
+  801ec7:	e8 97 02 00 00       	call   802163 <_panic>
+
+00801ecc <ipcring_rsp_pop>:
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ed2:	8b 42 18             	mov    0x18(%edx),%eax
+  801ed5:	83 c0 01             	add    $0x1,%eax
+  801ed8:	89 42 18             	mov    %eax,0x18(%edx)
+  801edb:	5d                   	pop    %ebp
+  801edc:	c3                   	ret
+
+00801edd <ipcring_server_init>:
+  801edd:	55                   	push   %ebp
+  801ede:	89 e5                	mov    %esp,%ebp
+  801ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ee6:	89 10                	mov    %edx,(%eax)
+  801ee8:	8b 55 10             	mov    0x10(%ebp),%edx
+  801eeb:	89 50 04             	mov    %edx,0x4(%eax)
+  801eee:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801ef5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801efc:	5d                   	pop    %ebp
+  801efd:	c3                   	ret
+
+00801efe <ipcring_req_avail>:
+  801efe:	55                   	push   %ebp
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f04:	8b 02                	mov    (%edx),%eax
+  801f06:	8b 40 10             	mov    0x10(%eax),%eax
+  801f09:	2b 42 08             	sub    0x8(%edx),%eax
+  801f0c:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f11:	39 d0                	cmp    %edx,%eax
+  801f13:	0f 47 c2             	cmova  %edx,%eax
+  801f16:	5d                   	pop    %ebp
+  801f17:	c3                   	ret
+
+00801f18 <ipcring_req_peek>:
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1e:	8b 42 08             	mov    0x8(%edx),%eax
+  801f21:	83 e0 07             	and    $0x7,%eax
+  801f24:	8b 12                	mov    (%edx),%edx
+  801f26:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f2a:	5d                   	pop    %ebp
+  801f2b:	c3                   	ret
+
+00801f2c <ipcring_rsp_push>:
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	83 ec 08             	sub    $0x8,%esp
+  801f32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f35:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f38:	83 c0 01             	add    $0x1,%eax
+  801f3b:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f3e:	8b 11                	mov    (%ecx),%edx
+  801f40:	83 c2 14             	add    $0x14,%edx
+  801f43:	f0 87 02             	lock xchg %eax,(%edx)
+  801f46:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f4a:	75 02                	jne    801f4e <ipcring_rsp_push+0x22>
+  801f4c:	c9                   	leave
+  801f4d:	c3                   	ret
+  801f4e:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f55:	6a 00                	push   $0x0
+  801f57:	68 00 00 80 ee       	push   $0xee800000
+  801f5c:	6a 00                	push   $0x0
+  801f5e:	ff 71 04             	push   0x4(%ecx)
+  801f61:	e8 8b e4 ff ff       	call   8003f1 <sys_ipc_try_send>
+  801f66:	83 c4 10             	add    $0x10,%esp
+  801f69:	eb e1                	jmp    801f4c <ipcring_rsp_push+0x20>
+
+00801f6b <ipcring_client_wait>:
+  801f6b:	55                   	push   %ebp
+  801f6c:	89 e5                	mov    %esp,%ebp
+  801f6e:	83 ec 08             	sub    $0x8,%esp
+  801f71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f74:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801f7b:	8b 10                	mov    (%eax),%edx
+  801f7d:	8b 52 18             	mov    0x18(%edx),%edx
+  801f80:	3b 50 08             	cmp    0x8(%eax),%edx
+  801f83:	75 02                	jne    801f87 <ipcring_client_wait+0x1c>
+  801f85:	c9                   	leave
+  801f86:	c3                   	ret
+  801f87:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f8e:	6a 00                	push   $0x0
+  801f90:	68 00 00 80 ee       	push   $0xee800000
+  801f95:	6a 00                	push   $0x0
+  801f97:	ff 70 04             	push   0x4(%eax)
+  801f9a:	e8 52 e4 ff ff       	call   8003f1 <sys_ipc_try_send>
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	eb e1                	jmp    801f85 <ipcring_client_wait+0x1a>
+
+00801fa4 <ipcring_server_sleep>:
+  801fa4:	55                   	push   %ebp
+  801fa5:	89 e5                	mov    %esp,%ebp
+  801fa7:	53                   	push   %ebx
+  801fa8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fab:	8b 01                	mov    (%ecx),%eax
+  801fad:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb5:	f0 87 02             	lock xchg %eax,(%edx)
+  801fb8:	8b 11                	mov    (%ecx),%edx
+  801fba:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fbd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fc2:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801fc5:	74 0e                	je     801fd5 <ipcring_server_sleep+0x31>
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcc:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+
+00801fda <devcons_close>:
+  801fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdf:	c3                   	ret
+
+00801fe0 <devcons_stat>:
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	83 ec 10             	sub    $0x10,%esp
+  801fe6:	68 c7 32 80 00       	push   $0x8032c7
+  801feb:	ff 75 0c             	push   0xc(%ebp)
+  801fee:	e8 42 09 00 00       	call   802935 <strcpy>
+  801ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff8:	c9                   	leave
+  801ff9:	c3                   	ret
+
+00801ffa <devcons_write>:
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	57                   	push   %edi
+  801ffe:	56                   	push   %esi
+  801fff:	53                   	push   %ebx
+  802000:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802006:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802009:	85 ff                	test   %edi,%edi
+  80200b:	74 51                	je     80205e <devcons_write+0x64>
+  80200d:	be 00 00 00 00       	mov    $0x0,%esi
+  802012:	b8 00 00 00 00       	mov    $0x0,%eax
+  802017:	89 fb                	mov    %edi,%ebx
+  802019:	29 c3                	sub    %eax,%ebx
+  80201b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802020:	39 d3                	cmp    %edx,%ebx
+  802022:	0f 47 da             	cmova  %edx,%ebx
+  802025:	83 ec 04             	sub    $0x4,%esp
+  802028:	53                   	push   %ebx
+  802029:	03 45 0c             	add    0xc(%ebp),%eax
+  80202c:	50                   	push   %eax
+  80202d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802033:	50                   	push   %eax
+  802034:	e8 ac 0a 00 00       	call   802ae5 <memmove>
+  802039:	83 c4 08             	add    $0x8,%esp
+  80203c:	53                   	push   %ebx
+  80203d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802043:	50                   	push   %eax
+  802044:	e8 65 e0 ff ff       	call   8000ae <sys_cputs>
+  802049:	01 de                	add    %ebx,%esi
+  80204b:	89 f0                	mov    %esi,%eax
+  80204d:	83 c4 10             	add    $0x10,%esp
+  802050:	39 fe                	cmp    %edi,%esi
+  802052:	72 c3                	jb     802017 <devcons_write+0x1d>
+  802054:	89 f0                	mov    %esi,%eax
+  802056:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802059:	5b                   	pop    %ebx
+  80205a:	5e                   	pop    %esi
+  80205b:	5f                   	pop    %edi
+  80205c:	5d                   	pop    %ebp
+  80205d:	c3                   	ret
+  80205e:	be 00 00 00 00       	mov    $0x0,%esi
+  802063:	eb ef                	jmp    802054 <devcons_write+0x5a>
+
+00802065 <devcons_read>:
+  802065:	55                   	push   %ebp
+  802066:	89 e5                	mov    %esp,%ebp
+  802068:	83 ec 08             	sub    $0x8,%esp
+  80206b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802070:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802074:	75 07                	jne    80207d <devcons_read+0x18>
+  802076:	eb 1f                	jmp    802097 <devcons_read+0x32>
+  802078:	e8 ce e0 ff ff       	call   80014b <sys_yield>
+  80207d:	e8 4a e0 ff ff       	call   8000cc <sys_cgetc>
+  802082:	85 c0                	test   %eax,%eax
+  802084:	74 f2                	je     802078 <devcons_read+0x13>
+  802086:	78 0f                	js     802097 <devcons_read+0x32>
+  802088:	83 f8 04             	cmp    $0x4,%eax
+  80208b:	74 0c                	je     802099 <devcons_read+0x34>
+  80208d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802090:	88 02                	mov    %al,(%edx)
+  802092:	b8 01 00 00 00       	mov    $0x1,%eax
+  802097:	c9                   	leave
+  802098:	c3                   	ret
+  802099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209e:	eb f7                	jmp    802097 <devcons_read+0x32>
+
+008020a0 <cputchar>:
+  8020a0:	55                   	push   %ebp
+  8020a1:	89 e5                	mov    %esp,%ebp
+  8020a3:	83 ec 20             	sub    $0x20,%esp
+  8020a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020ac:	6a 01                	push   $0x1
+  8020ae:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020b1:	50                   	push   %eax
+  8020b2:	e8 f7 df ff ff       	call   8000ae <sys_cputs>
+  8020b7:	83 c4 10             	add    $0x10,%esp
+  8020ba:	c9                   	leave
+  8020bb:	c3                   	ret
+
+008020bc <getchar>:
+  8020bc:	55                   	push   %ebp
+  8020bd:	89 e5                	mov    %esp,%ebp
+  8020bf:	83 ec 1c             	sub    $0x1c,%esp
+  8020c2:	6a 01                	push   $0x1
+  8020c4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020c7:	50                   	push   %eax
+  8020c8:	6a 00                	push   $0x0
+  8020ca:	e8 0e ec ff ff       	call   800cdd <read>
+  8020cf:	83 c4 10             	add    $0x10,%esp
+  8020d2:	85 c0                	test   %eax,%eax
+  8020d4:	78 06                	js     8020dc <getchar+0x20>
+  8020d6:	74 06                	je     8020de <getchar+0x22>
+  8020d8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8020dc:	c9                   	leave
+  8020dd:	c3                   	ret
+  8020de:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020e3:	eb f7                	jmp    8020dc <getchar+0x20>
+
+008020e5 <iscons>:
+  8020e5:	55                   	push   %ebp
+  8020e6:	89 e5                	mov    %esp,%ebp
+  8020e8:	83 ec 20             	sub    $0x20,%esp
+  8020eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ee:	50                   	push   %eax
+  8020ef:	ff 75 08             	push   0x8(%ebp)
+  8020f2:	e8 84 e9 ff ff       	call   800a7b <fd_lookup>
+  8020f7:	83 c4 10             	add    $0x10,%esp
+  8020fa:	85 c0                	test   %eax,%eax
+  8020fc:	78 11                	js     80210f <iscons+0x2a>
+  8020fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802101:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802107:	39 10                	cmp    %edx,(%eax)
+  802109:	0f 94 c0             	sete   %al
+  80210c:	0f b6 c0             	movzbl %al,%eax
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+
+00802111 <opencons>:
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	83 ec 24             	sub    $0x24,%esp
+  802117:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80211a:	50                   	push   %eax
+  80211b:	e8 0b e9 ff ff       	call   800a2b <fd_alloc>
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	85 c0                	test   %eax,%eax
+  802125:	78 3a                	js     802161 <opencons+0x50>
+  802127:	83 ec 04             	sub    $0x4,%esp
+  80212a:	68 07 04 00 00       	push   $0x407
+  80212f:	ff 75 f4             	push   -0xc(%ebp)
+  802132:	6a 00                	push   $0x0
+  802134:	e8 5d e0 ff ff       	call   800196 <sys_page_alloc>
+  802139:	83 c4 10             	add    $0x10,%esp
+  80213c:	85 c0                	test   %eax,%eax
+  80213e:	78 21                	js     802161 <opencons+0x50>
+  802140:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802143:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802149:	89 10                	mov    %edx,(%eax)
+  80214b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802155:	83 ec 0c             	sub    $0xc,%esp
+  802158:	50                   	push   %eax
+  802159:	e8 a6 e8 ff ff       	call   800a04 <fd2num>
+  80215e:	83 c4 10             	add    $0x10,%esp
+  802161:	c9                   	leave
+  802162:	c3                   	ret
+
+00802163 <_panic>:
+  802163:	55                   	push   %ebp
+  802164:	89 e5                	mov    %esp,%ebp
+  802166:	56                   	push   %esi
+  802167:	53                   	push   %ebx
+  802168:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80216b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802171:	e8 b6 df ff ff       	call   80012c <sys_getenvid>
+  802176:	83 ec 0c             	sub    $0xc,%esp
+  802179:	ff 75 0c             	push   0xc(%ebp)
+  80217c:	ff 75 08             	push   0x8(%ebp)
+  80217f:	56                   	push   %esi
+  802180:	50                   	push   %eax
+  802181:	68 d4 32 80 00       	push   $0x8032d4
+  802186:	e8 b3 00 00 00       	call   80223e <cprintf>
+  80218b:	83 c4 18             	add    $0x18,%esp
+  80218e:	53                   	push   %ebx
+  80218f:	ff 75 10             	push   0x10(%ebp)
+  802192:	e8 56 00 00 00       	call   8021ed <vcprintf>
+  802197:	c7 04 24 8e 32 80 00 	movl   $0x80328e,(%esp)
+  80219e:	e8 9b 00 00 00       	call   80223e <cprintf>
+  8021a3:	83 c4 10             	add    $0x10,%esp
+  8021a6:	cc                   	int3
+  8021a7:	eb fd                	jmp    8021a6 <_panic+0x43>
+
+008021a9 <putch>:
+  8021a9:	55                   	push   %ebp
+  8021aa:	89 e5                	mov    %esp,%ebp
+  8021ac:	53                   	push   %ebx
+  8021ad:	83 ec 04             	sub    $0x4,%esp
+  8021b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021b3:	8b 13                	mov    (%ebx),%edx
+  8021b5:	8d 42 01             	lea    0x1(%edx),%eax
+  8021b8:	89 03                	mov    %eax,(%ebx)
+  8021ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021bd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021c1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021c6:	74 09                	je     8021d1 <putch+0x28>
+  8021c8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+  8021d1:	83 ec 08             	sub    $0x8,%esp
+  8021d4:	68 ff 00 00 00       	push   $0xff
+  8021d9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8021dc:	50                   	push   %eax
+  8021dd:	e8 cc de ff ff       	call   8000ae <sys_cputs>
+  8021e2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	eb db                	jmp    8021c8 <putch+0x1f>
+
+008021ed <vcprintf>:
+  8021ed:	55                   	push   %ebp
+  8021ee:	89 e5                	mov    %esp,%ebp
+  8021f0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8021f6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8021fd:	00 00 00 
+  802200:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802207:	00 00 00 
+  80220a:	ff 75 0c             	push   0xc(%ebp)
+  80220d:	ff 75 08             	push   0x8(%ebp)
+  802210:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802216:	50                   	push   %eax
+  802217:	68 a9 21 80 00       	push   $0x8021a9
+  80221c:	e8 1c 01 00 00       	call   80233d <vprintfmt>
+  802221:	83 c4 08             	add    $0x8,%esp
+  802224:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80222a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802230:	50                   	push   %eax
+  802231:	e8 78 de ff ff       	call   8000ae <sys_cputs>
+  802236:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80223c:	c9                   	leave
+  80223d:	c3                   	ret
+
+0080223e <cprintf>:
+  80223e:	55                   	push   %ebp
+  80223f:	89 e5                	mov    %esp,%ebp
+  802241:	83 ec 10             	sub    $0x10,%esp
+  802244:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802247:	50                   	push   %eax
+  802248:	ff 75 08             	push   0x8(%ebp)
+  80224b:	e8 9d ff ff ff       	call   8021ed <vcprintf>
+  802250:	c9                   	leave
+  802251:	c3                   	ret
+
+00802252 <printnum>:
+  802252:	55                   	push   %ebp
+  802253:	89 e5                	mov    %esp,%ebp
+  802255:	57                   	push   %edi
+  802256:	56                   	push   %esi
+  802257:	53                   	push   %ebx
+  802258:	83 ec 1c             	sub    $0x1c,%esp
+  80225b:	89 c3                	mov    %eax,%ebx
+  80225d:	89 d6                	mov    %edx,%esi
+  80225f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802262:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802265:	89 d1                	mov    %edx,%ecx
+  802267:	89 c2                	mov    %eax,%edx
+  802269:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80226c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80226f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802272:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802275:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80227c:	39 c2                	cmp    %eax,%edx
+  80227e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802281:	73 4b                	jae    8022ce <printnum+0x7c>
+  802283:	8b 45 14             	mov    0x14(%ebp),%eax
+  802286:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802289:	85 ff                	test   %edi,%edi
+  80228b:	7e 11                	jle    80229e <printnum+0x4c>
+  80228d:	83 ec 08             	sub    $0x8,%esp
+  802290:	56                   	push   %esi
+  802291:	ff 75 18             	push   0x18(%ebp)
+  802294:	ff d3                	call   *%ebx
+  802296:	83 c4 10             	add    $0x10,%esp
+  802299:	83 ef 01             	sub    $0x1,%edi
+  80229c:	75 ef                	jne    80228d <printnum+0x3b>
+  80229e:	83 ec 08             	sub    $0x8,%esp
+  8022a1:	56                   	push   %esi
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8022a8:	ff 75 e0             	push   -0x20(%ebp)
+  8022ab:	ff 75 dc             	push   -0x24(%ebp)
+  8022ae:	ff 75 d8             	push   -0x28(%ebp)
+  8022b1:	e8 9b 0d 00 00       	call   803051 <__umoddi3>
+  8022b6:	83 c4 14             	add    $0x14,%esp
+  8022b9:	0f be 80 f7 32 80 00 	movsbl 0x8032f7(%eax),%eax
+  8022c0:	50                   	push   %eax
+  8022c1:	ff d3                	call   *%ebx
+  8022c3:	83 c4 10             	add    $0x10,%esp
+  8022c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c9:	5b                   	pop    %ebx
+  8022ca:	5e                   	pop    %esi
+  8022cb:	5f                   	pop    %edi
+  8022cc:	5d                   	pop    %ebp
+  8022cd:	c3                   	ret
+  8022ce:	83 ec 0c             	sub    $0xc,%esp
+  8022d1:	ff 75 18             	push   0x18(%ebp)
+  8022d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022d7:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8022da:	52                   	push   %edx
+  8022db:	50                   	push   %eax
+  8022dc:	83 ec 08             	sub    $0x8,%esp
+  8022df:	ff 75 e4             	push   -0x1c(%ebp)
+  8022e2:	ff 75 e0             	push   -0x20(%ebp)
+  8022e5:	ff 75 dc             	push   -0x24(%ebp)
+  8022e8:	ff 75 d8             	push   -0x28(%ebp)
+  8022eb:	e8 43 0d 00 00       	call   803033 <__udivdi3>
+  8022f0:	83 c4 18             	add    $0x18,%esp
+  8022f3:	52                   	push   %edx
+  8022f4:	50                   	push   %eax
+  8022f5:	89 f2                	mov    %esi,%edx
+  8022f7:	89 d8                	mov    %ebx,%eax
+  8022f9:	e8 54 ff ff ff       	call   802252 <printnum>
+  8022fe:	83 c4 20             	add    $0x20,%esp
+  802301:	eb 9b                	jmp    80229e <printnum+0x4c>
+
+00802303 <sprintputch>:
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802309:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80230d:	8b 10                	mov    (%eax),%edx
+  80230f:	3b 50 04             	cmp    0x4(%eax),%edx
+  802312:	73 0a                	jae    80231e <sprintputch+0x1b>
+  802314:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802317:	89 08                	mov    %ecx,(%eax)
+  802319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231c:	88 02                	mov    %al,(%edx)
+  80231e:	5d                   	pop    %ebp
+  80231f:	c3                   	ret
+
+00802320 <printfmt>:
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	83 ec 08             	sub    $0x8,%esp
+  802326:	8d 45 14             	lea    0x14(%ebp),%eax
+  802329:	50                   	push   %eax
+  80232a:	ff 75 10             	push   0x10(%ebp)
+  80232d:	ff 75 0c             	push   0xc(%ebp)
+  802330:	ff 75 08             	push   0x8(%ebp)
+  802333:	e8 05 00 00 00       	call   80233d <vprintfmt>
+  802338:	83 c4 10             	add    $0x10,%esp
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+0080233d <vprintfmt>:
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	57                   	push   %edi
+  802341:	56                   	push   %esi
+  802342:	53                   	push   %ebx
+  802343:	83 ec 2c             	sub    $0x2c,%esp
+  802346:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802349:	89 df                	mov    %ebx,%edi
+  80234b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80234e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802351:	8d 70 01             	lea    0x1(%eax),%esi
+  802354:	0f b6 00             	movzbl (%eax),%eax
+  802357:	83 f8 25             	cmp    $0x25,%eax
+  80235a:	74 1e                	je     80237a <vprintfmt+0x3d>
+  80235c:	85 c0                	test   %eax,%eax
+  80235e:	0f 84 15 05 00 00    	je     802879 <vprintfmt+0x53c>
+  802364:	83 ec 08             	sub    $0x8,%esp
+  802367:	53                   	push   %ebx
+  802368:	50                   	push   %eax
+  802369:	ff d7                	call   *%edi
+  80236b:	83 c6 01             	add    $0x1,%esi
+  80236e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802372:	83 c4 10             	add    $0x10,%esp
+  802375:	83 f8 25             	cmp    $0x25,%eax
+  802378:	75 e2                	jne    80235c <vprintfmt+0x1f>
+  80237a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80237e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  802385:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80238c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802393:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802398:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80239b:	8d 56 01             	lea    0x1(%esi),%edx
+  80239e:	0f b6 0e             	movzbl (%esi),%ecx
+  8023a1:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023a4:	3c 55                	cmp    $0x55,%al
+  8023a6:	0f 87 3b 04 00 00    	ja     8027e7 <vprintfmt+0x4aa>
+  8023ac:	0f b6 c0             	movzbl %al,%eax
+  8023af:	ff 24 85 40 34 80 00 	jmp    *0x803440(,%eax,4)
+  8023b6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023b9:	eb 93                	jmp    80234e <vprintfmt+0x11>
+  8023bb:	89 d6                	mov    %edx,%esi
+  8023bd:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023c1:	eb d8                	jmp    80239b <vprintfmt+0x5e>
+  8023c3:	89 d6                	mov    %edx,%esi
+  8023c5:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023c9:	eb d0                	jmp    80239b <vprintfmt+0x5e>
+  8023cb:	0f b6 c9             	movzbl %cl,%ecx
+  8023ce:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8023d1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023d4:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8023d8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8023db:	83 f9 09             	cmp    $0x9,%ecx
+  8023de:	77 6f                	ja     80244f <vprintfmt+0x112>
+  8023e0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8023e3:	83 c2 01             	add    $0x1,%edx
+  8023e6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8023e9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8023ed:	0f be 02             	movsbl (%edx),%eax
+  8023f0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8023f3:	83 fe 09             	cmp    $0x9,%esi
+  8023f6:	76 eb                	jbe    8023e3 <vprintfmt+0xa6>
+  8023f8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8023fb:	89 d6                	mov    %edx,%esi
+  8023fd:	eb 13                	jmp    802412 <vprintfmt+0xd5>
+  8023ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  802402:	8b 00                	mov    (%eax),%eax
+  802404:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802407:	8b 45 14             	mov    0x14(%ebp),%eax
+  80240a:	8d 40 04             	lea    0x4(%eax),%eax
+  80240d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802410:	89 d6                	mov    %edx,%esi
+  802412:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802416:	79 83                	jns    80239b <vprintfmt+0x5e>
+  802418:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80241b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80241e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802425:	e9 71 ff ff ff       	jmp    80239b <vprintfmt+0x5e>
+  80242a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80242d:	85 c9                	test   %ecx,%ecx
+  80242f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802434:	0f 49 c1             	cmovns %ecx,%eax
+  802437:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80243a:	89 d6                	mov    %edx,%esi
+  80243c:	e9 5a ff ff ff       	jmp    80239b <vprintfmt+0x5e>
+  802441:	89 d6                	mov    %edx,%esi
+  802443:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80244a:	e9 4c ff ff ff       	jmp    80239b <vprintfmt+0x5e>
+  80244f:	89 d6                	mov    %edx,%esi
+  802451:	eb bf                	jmp    802412 <vprintfmt+0xd5>
+  802453:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802457:	89 d6                	mov    %edx,%esi
+  802459:	e9 3d ff ff ff       	jmp    80239b <vprintfmt+0x5e>
+  80245e:	89 55 10             	mov    %edx,0x10(%ebp)
+  802461:	8b 45 14             	mov    0x14(%ebp),%eax
+  802464:	8d 70 04             	lea    0x4(%eax),%esi
+  802467:	83 ec 08             	sub    $0x8,%esp
+  80246a:	53                   	push   %ebx
+  80246b:	ff 30                	push   (%eax)
+  80246d:	ff d7                	call   *%edi
+  80246f:	83 c4 10             	add    $0x10,%esp
+  802472:	89 75 14             	mov    %esi,0x14(%ebp)
+  802475:	e9 d4 fe ff ff       	jmp    80234e <vprintfmt+0x11>
+  80247a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80247d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802480:	8d 70 04             	lea    0x4(%eax),%esi
+  802483:	8b 10                	mov    (%eax),%edx
+  802485:	89 d0                	mov    %edx,%eax
+  802487:	f7 d8                	neg    %eax
+  802489:	0f 48 c2             	cmovs  %edx,%eax
+  80248c:	83 f8 12             	cmp    $0x12,%eax
+  80248f:	7f 23                	jg     8024b4 <vprintfmt+0x177>
+  802491:	8b 14 85 a0 35 80 00 	mov    0x8035a0(,%eax,4),%edx
+  802498:	85 d2                	test   %edx,%edx
+  80249a:	74 18                	je     8024b4 <vprintfmt+0x177>
+  80249c:	52                   	push   %edx
+  80249d:	68 5b 32 80 00       	push   $0x80325b
+  8024a2:	53                   	push   %ebx
+  8024a3:	57                   	push   %edi
+  8024a4:	e8 77 fe ff ff       	call   802320 <printfmt>
+  8024a9:	83 c4 10             	add    $0x10,%esp
+  8024ac:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024af:	e9 9a fe ff ff       	jmp    80234e <vprintfmt+0x11>
+  8024b4:	50                   	push   %eax
+  8024b5:	68 0f 33 80 00       	push   $0x80330f
+  8024ba:	53                   	push   %ebx
+  8024bb:	57                   	push   %edi
+  8024bc:	e8 5f fe ff ff       	call   802320 <printfmt>
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024c7:	e9 82 fe ff ff       	jmp    80234e <vprintfmt+0x11>
+  8024cc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d2:	83 c0 04             	add    $0x4,%eax
+  8024d5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8024d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024db:	8b 00                	mov    (%eax),%eax
+  8024dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024e0:	85 c0                	test   %eax,%eax
+  8024e2:	0f 84 61 03 00 00    	je     802849 <vprintfmt+0x50c>
+  8024e8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8024ec:	7e 06                	jle    8024f4 <vprintfmt+0x1b7>
+  8024ee:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8024f2:	75 29                	jne    80251d <vprintfmt+0x1e0>
+  8024f4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8024f7:	8d 70 01             	lea    0x1(%eax),%esi
+  8024fa:	0f b6 00             	movzbl (%eax),%eax
+  8024fd:	0f be d0             	movsbl %al,%edx
+  802500:	85 d2                	test   %edx,%edx
+  802502:	0f 84 bb 00 00 00    	je     8025c3 <vprintfmt+0x286>
+  802508:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80250b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80250e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802511:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802514:	eb 7a                	jmp    802590 <vprintfmt+0x253>
+  802516:	c7 45 d0 08 33 80 00 	movl   $0x803308,-0x30(%ebp)
+  80251d:	83 ec 08             	sub    $0x8,%esp
+  802520:	ff 75 d4             	push   -0x2c(%ebp)
+  802523:	ff 75 d0             	push   -0x30(%ebp)
+  802526:	e8 e0 03 00 00       	call   80290b <strnlen>
+  80252b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80252e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802531:	83 c4 10             	add    $0x10,%esp
+  802534:	85 d2                	test   %edx,%edx
+  802536:	0f 8e d6 02 00 00    	jle    802812 <vprintfmt+0x4d5>
+  80253c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802540:	83 ec 08             	sub    $0x8,%esp
+  802543:	53                   	push   %ebx
+  802544:	56                   	push   %esi
+  802545:	ff d7                	call   *%edi
+  802547:	83 c4 10             	add    $0x10,%esp
+  80254a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80254e:	75 f0                	jne    802540 <vprintfmt+0x203>
+  802550:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802553:	8d 70 01             	lea    0x1(%eax),%esi
+  802556:	0f b6 00             	movzbl (%eax),%eax
+  802559:	0f be d0             	movsbl %al,%edx
+  80255c:	85 d2                	test   %edx,%edx
+  80255e:	0f 84 da 02 00 00    	je     80283e <vprintfmt+0x501>
+  802564:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802567:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80256a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80256d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802570:	eb 1e                	jmp    802590 <vprintfmt+0x253>
+  802572:	83 ec 08             	sub    $0x8,%esp
+  802575:	ff 75 0c             	push   0xc(%ebp)
+  802578:	52                   	push   %edx
+  802579:	ff 55 08             	call   *0x8(%ebp)
+  80257c:	83 c4 10             	add    $0x10,%esp
+  80257f:	83 eb 01             	sub    $0x1,%ebx
+  802582:	83 c6 01             	add    $0x1,%esi
+  802585:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802589:	0f be d0             	movsbl %al,%edx
+  80258c:	85 d2                	test   %edx,%edx
+  80258e:	74 2a                	je     8025ba <vprintfmt+0x27d>
+  802590:	85 ff                	test   %edi,%edi
+  802592:	78 05                	js     802599 <vprintfmt+0x25c>
+  802594:	83 ef 01             	sub    $0x1,%edi
+  802597:	78 59                	js     8025f2 <vprintfmt+0x2b5>
+  802599:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80259d:	74 d3                	je     802572 <vprintfmt+0x235>
+  80259f:	0f be c0             	movsbl %al,%eax
+  8025a2:	83 e8 20             	sub    $0x20,%eax
+  8025a5:	83 f8 5e             	cmp    $0x5e,%eax
+  8025a8:	76 c8                	jbe    802572 <vprintfmt+0x235>
+  8025aa:	83 ec 08             	sub    $0x8,%esp
+  8025ad:	ff 75 0c             	push   0xc(%ebp)
+  8025b0:	6a 3f                	push   $0x3f
+  8025b2:	ff 55 08             	call   *0x8(%ebp)
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	eb c5                	jmp    80257f <vprintfmt+0x242>
+  8025ba:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025c3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025c6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025ca:	7e 1b                	jle    8025e7 <vprintfmt+0x2aa>
+  8025cc:	83 ec 08             	sub    $0x8,%esp
+  8025cf:	53                   	push   %ebx
+  8025d0:	6a 20                	push   $0x20
+  8025d2:	ff d7                	call   *%edi
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	83 ee 01             	sub    $0x1,%esi
+  8025da:	75 f0                	jne    8025cc <vprintfmt+0x28f>
+  8025dc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025e2:	e9 67 fd ff ff       	jmp    80234e <vprintfmt+0x11>
+  8025e7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025ed:	e9 5c fd ff ff       	jmp    80234e <vprintfmt+0x11>
+  8025f2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025fb:	eb c6                	jmp    8025c3 <vprintfmt+0x286>
+  8025fd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802600:	89 55 10             	mov    %edx,0x10(%ebp)
+  802603:	83 f9 01             	cmp    $0x1,%ecx
+  802606:	7f 1f                	jg     802627 <vprintfmt+0x2ea>
+  802608:	85 c9                	test   %ecx,%ecx
+  80260a:	74 67                	je     802673 <vprintfmt+0x336>
+  80260c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80260f:	8b 30                	mov    (%eax),%esi
+  802611:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802614:	89 f0                	mov    %esi,%eax
+  802616:	c1 f8 1f             	sar    $0x1f,%eax
+  802619:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80261c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80261f:	8d 40 04             	lea    0x4(%eax),%eax
+  802622:	89 45 14             	mov    %eax,0x14(%ebp)
+  802625:	eb 17                	jmp    80263e <vprintfmt+0x301>
+  802627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80262a:	8b 50 04             	mov    0x4(%eax),%edx
+  80262d:	8b 00                	mov    (%eax),%eax
+  80262f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802632:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802635:	8b 45 14             	mov    0x14(%ebp),%eax
+  802638:	8d 40 08             	lea    0x8(%eax),%eax
+  80263b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80263e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802641:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802644:	be 0a 00 00 00       	mov    $0xa,%esi
+  802649:	85 c9                	test   %ecx,%ecx
+  80264b:	0f 89 12 01 00 00    	jns    802763 <vprintfmt+0x426>
+  802651:	83 ec 08             	sub    $0x8,%esp
+  802654:	53                   	push   %ebx
+  802655:	6a 2d                	push   $0x2d
+  802657:	ff d7                	call   *%edi
+  802659:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80265c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80265f:	f7 da                	neg    %edx
+  802661:	83 d1 00             	adc    $0x0,%ecx
+  802664:	f7 d9                	neg    %ecx
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	be 0a 00 00 00       	mov    $0xa,%esi
+  80266e:	e9 f0 00 00 00       	jmp    802763 <vprintfmt+0x426>
+  802673:	8b 45 14             	mov    0x14(%ebp),%eax
+  802676:	8b 30                	mov    (%eax),%esi
+  802678:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80267b:	89 f0                	mov    %esi,%eax
+  80267d:	c1 f8 1f             	sar    $0x1f,%eax
+  802680:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802683:	8b 45 14             	mov    0x14(%ebp),%eax
+  802686:	8d 40 04             	lea    0x4(%eax),%eax
+  802689:	89 45 14             	mov    %eax,0x14(%ebp)
+  80268c:	eb b0                	jmp    80263e <vprintfmt+0x301>
+  80268e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802691:	89 55 10             	mov    %edx,0x10(%ebp)
+  802694:	83 f9 01             	cmp    $0x1,%ecx
+  802697:	7f 1e                	jg     8026b7 <vprintfmt+0x37a>
+  802699:	85 c9                	test   %ecx,%ecx
+  80269b:	74 32                	je     8026cf <vprintfmt+0x392>
+  80269d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a0:	8b 10                	mov    (%eax),%edx
+  8026a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8026aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026ad:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026b2:	e9 ac 00 00 00       	jmp    802763 <vprintfmt+0x426>
+  8026b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026ba:	8b 10                	mov    (%eax),%edx
+  8026bc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026bf:	8d 40 08             	lea    0x8(%eax),%eax
+  8026c2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026c5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026ca:	e9 94 00 00 00       	jmp    802763 <vprintfmt+0x426>
+  8026cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026d2:	8b 10                	mov    (%eax),%edx
+  8026d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8026dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026df:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026e4:	eb 7d                	jmp    802763 <vprintfmt+0x426>
+  8026e6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026e9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026ec:	83 f9 01             	cmp    $0x1,%ecx
+  8026ef:	7f 1b                	jg     80270c <vprintfmt+0x3cf>
+  8026f1:	85 c9                	test   %ecx,%ecx
+  8026f3:	74 2c                	je     802721 <vprintfmt+0x3e4>
+  8026f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026f8:	8b 10                	mov    (%eax),%edx
+  8026fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ff:	8d 40 04             	lea    0x4(%eax),%eax
+  802702:	89 45 14             	mov    %eax,0x14(%ebp)
+  802705:	be 08 00 00 00       	mov    $0x8,%esi
+  80270a:	eb 57                	jmp    802763 <vprintfmt+0x426>
+  80270c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80270f:	8b 10                	mov    (%eax),%edx
+  802711:	8b 48 04             	mov    0x4(%eax),%ecx
+  802714:	8d 40 08             	lea    0x8(%eax),%eax
+  802717:	89 45 14             	mov    %eax,0x14(%ebp)
+  80271a:	be 08 00 00 00       	mov    $0x8,%esi
+  80271f:	eb 42                	jmp    802763 <vprintfmt+0x426>
+  802721:	8b 45 14             	mov    0x14(%ebp),%eax
+  802724:	8b 10                	mov    (%eax),%edx
+  802726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80272b:	8d 40 04             	lea    0x4(%eax),%eax
+  80272e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802731:	be 08 00 00 00       	mov    $0x8,%esi
+  802736:	eb 2b                	jmp    802763 <vprintfmt+0x426>
+  802738:	89 55 10             	mov    %edx,0x10(%ebp)
+  80273b:	83 ec 08             	sub    $0x8,%esp
+  80273e:	53                   	push   %ebx
+  80273f:	6a 30                	push   $0x30
+  802741:	ff d7                	call   *%edi
+  802743:	83 c4 08             	add    $0x8,%esp
+  802746:	53                   	push   %ebx
+  802747:	6a 78                	push   $0x78
+  802749:	ff d7                	call   *%edi
+  80274b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80274e:	8b 10                	mov    (%eax),%edx
+  802750:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802755:	83 c4 10             	add    $0x10,%esp
+  802758:	8d 40 04             	lea    0x4(%eax),%eax
+  80275b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80275e:	be 10 00 00 00       	mov    $0x10,%esi
+  802763:	83 ec 0c             	sub    $0xc,%esp
+  802766:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80276a:	50                   	push   %eax
+  80276b:	ff 75 e4             	push   -0x1c(%ebp)
+  80276e:	56                   	push   %esi
+  80276f:	51                   	push   %ecx
+  802770:	52                   	push   %edx
+  802771:	89 da                	mov    %ebx,%edx
+  802773:	89 f8                	mov    %edi,%eax
+  802775:	e8 d8 fa ff ff       	call   802252 <printnum>
+  80277a:	83 c4 20             	add    $0x20,%esp
+  80277d:	e9 cc fb ff ff       	jmp    80234e <vprintfmt+0x11>
+  802782:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802785:	89 55 10             	mov    %edx,0x10(%ebp)
+  802788:	83 f9 01             	cmp    $0x1,%ecx
+  80278b:	7f 1b                	jg     8027a8 <vprintfmt+0x46b>
+  80278d:	85 c9                	test   %ecx,%ecx
+  80278f:	74 2c                	je     8027bd <vprintfmt+0x480>
+  802791:	8b 45 14             	mov    0x14(%ebp),%eax
+  802794:	8b 10                	mov    (%eax),%edx
+  802796:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80279b:	8d 40 04             	lea    0x4(%eax),%eax
+  80279e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027a1:	be 10 00 00 00       	mov    $0x10,%esi
+  8027a6:	eb bb                	jmp    802763 <vprintfmt+0x426>
+  8027a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027ab:	8b 10                	mov    (%eax),%edx
+  8027ad:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8027b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027b6:	be 10 00 00 00       	mov    $0x10,%esi
+  8027bb:	eb a6                	jmp    802763 <vprintfmt+0x426>
+  8027bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c0:	8b 10                	mov    (%eax),%edx
+  8027c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8027ca:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027cd:	be 10 00 00 00       	mov    $0x10,%esi
+  8027d2:	eb 8f                	jmp    802763 <vprintfmt+0x426>
+  8027d4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027d7:	83 ec 08             	sub    $0x8,%esp
+  8027da:	53                   	push   %ebx
+  8027db:	6a 25                	push   $0x25
+  8027dd:	ff d7                	call   *%edi
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	e9 67 fb ff ff       	jmp    80234e <vprintfmt+0x11>
+  8027e7:	83 ec 08             	sub    $0x8,%esp
+  8027ea:	53                   	push   %ebx
+  8027eb:	6a 25                	push   $0x25
+  8027ed:	ff d7                	call   *%edi
+  8027ef:	83 c4 10             	add    $0x10,%esp
+  8027f2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8027f6:	0f 84 ba fb ff ff    	je     8023b6 <vprintfmt+0x79>
+  8027fc:	89 75 10             	mov    %esi,0x10(%ebp)
+  8027ff:	89 f0                	mov    %esi,%eax
+  802801:	83 e8 01             	sub    $0x1,%eax
+  802804:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802808:	75 f7                	jne    802801 <vprintfmt+0x4c4>
+  80280a:	89 45 10             	mov    %eax,0x10(%ebp)
+  80280d:	e9 3c fb ff ff       	jmp    80234e <vprintfmt+0x11>
+  802812:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802815:	8d 70 01             	lea    0x1(%eax),%esi
+  802818:	0f b6 00             	movzbl (%eax),%eax
+  80281b:	0f be d0             	movsbl %al,%edx
+  80281e:	85 d2                	test   %edx,%edx
+  802820:	74 11                	je     802833 <vprintfmt+0x4f6>
+  802822:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802825:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802828:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80282b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80282e:	e9 5d fd ff ff       	jmp    802590 <vprintfmt+0x253>
+  802833:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802836:	89 45 14             	mov    %eax,0x14(%ebp)
+  802839:	e9 10 fb ff ff       	jmp    80234e <vprintfmt+0x11>
+  80283e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802841:	89 45 14             	mov    %eax,0x14(%ebp)
+  802844:	e9 05 fb ff ff       	jmp    80234e <vprintfmt+0x11>
+  802849:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80284d:	7e 0a                	jle    802859 <vprintfmt+0x51c>
+  80284f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802853:	0f 85 bd fc ff ff    	jne    802516 <vprintfmt+0x1d9>
+  802859:	ba 28 00 00 00       	mov    $0x28,%edx
+  80285e:	b8 28 00 00 00       	mov    $0x28,%eax
+  802863:	be 09 33 80 00       	mov    $0x803309,%esi
+  802868:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80286b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80286e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802871:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802874:	e9 17 fd ff ff       	jmp    802590 <vprintfmt+0x253>
+  802879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80287c:	5b                   	pop    %ebx
+  80287d:	5e                   	pop    %esi
+  80287e:	5f                   	pop    %edi
+  80287f:	5d                   	pop    %ebp
+  802880:	c3                   	ret
+
+00802881 <vsnprintf>:
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	83 ec 18             	sub    $0x18,%esp
+  802887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80288d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802890:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802894:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802897:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	74 26                	je     8028c8 <vsnprintf+0x47>
+  8028a2:	85 d2                	test   %edx,%edx
+  8028a4:	7e 22                	jle    8028c8 <vsnprintf+0x47>
+  8028a6:	ff 75 14             	push   0x14(%ebp)
+  8028a9:	ff 75 10             	push   0x10(%ebp)
+  8028ac:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028af:	50                   	push   %eax
+  8028b0:	68 03 23 80 00       	push   $0x802303
+  8028b5:	e8 83 fa ff ff       	call   80233d <vprintfmt>
+  8028ba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028bd:	c6 00 00             	movb   $0x0,(%eax)
+  8028c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c3:	83 c4 10             	add    $0x10,%esp
+  8028c6:	c9                   	leave
+  8028c7:	c3                   	ret
+  8028c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028cd:	eb f7                	jmp    8028c6 <vsnprintf+0x45>
+
+008028cf <snprintf>:
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	83 ec 08             	sub    $0x8,%esp
+  8028d5:	8d 45 14             	lea    0x14(%ebp),%eax
+  8028d8:	50                   	push   %eax
+  8028d9:	ff 75 10             	push   0x10(%ebp)
+  8028dc:	ff 75 0c             	push   0xc(%ebp)
+  8028df:	ff 75 08             	push   0x8(%ebp)
+  8028e2:	e8 9a ff ff ff       	call   802881 <vsnprintf>
+  8028e7:	c9                   	leave
+  8028e8:	c3                   	ret
+
+008028e9 <strlen>:
+  8028e9:	55                   	push   %ebp
+  8028ea:	89 e5                	mov    %esp,%ebp
+  8028ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028ef:	80 3a 00             	cmpb   $0x0,(%edx)
+  8028f2:	74 10                	je     802904 <strlen+0x1b>
+  8028f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f9:	83 c0 01             	add    $0x1,%eax
+  8028fc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802900:	75 f7                	jne    8028f9 <strlen+0x10>
+  802902:	5d                   	pop    %ebp
+  802903:	c3                   	ret
+  802904:	b8 00 00 00 00       	mov    $0x0,%eax
+  802909:	eb f7                	jmp    802902 <strlen+0x19>
+
+0080290b <strnlen>:
+  80290b:	55                   	push   %ebp
+  80290c:	89 e5                	mov    %esp,%ebp
+  80290e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802911:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802914:	85 d2                	test   %edx,%edx
+  802916:	74 16                	je     80292e <strnlen+0x23>
+  802918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802921:	74 09                	je     80292c <strnlen+0x21>
+  802923:	83 c0 01             	add    $0x1,%eax
+  802926:	39 d0                	cmp    %edx,%eax
+  802928:	75 f3                	jne    80291d <strnlen+0x12>
+  80292a:	89 d0                	mov    %edx,%eax
+  80292c:	5d                   	pop    %ebp
+  80292d:	c3                   	ret
+  80292e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802933:	eb f7                	jmp    80292c <strnlen+0x21>
+
+00802935 <strcpy>:
+  802935:	55                   	push   %ebp
+  802936:	89 e5                	mov    %esp,%ebp
+  802938:	53                   	push   %ebx
+  802939:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80293c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80293f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802944:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802948:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80294b:	83 c0 01             	add    $0x1,%eax
+  80294e:	84 d2                	test   %dl,%dl
+  802950:	75 f2                	jne    802944 <strcpy+0xf>
+  802952:	89 c8                	mov    %ecx,%eax
+  802954:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802957:	c9                   	leave
+  802958:	c3                   	ret
+
+00802959 <strcat>:
+  802959:	55                   	push   %ebp
+  80295a:	89 e5                	mov    %esp,%ebp
+  80295c:	53                   	push   %ebx
+  80295d:	83 ec 10             	sub    $0x10,%esp
+  802960:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802963:	53                   	push   %ebx
+  802964:	e8 80 ff ff ff       	call   8028e9 <strlen>
+  802969:	83 c4 08             	add    $0x8,%esp
+  80296c:	ff 75 0c             	push   0xc(%ebp)
+  80296f:	01 d8                	add    %ebx,%eax
+  802971:	50                   	push   %eax
+  802972:	e8 be ff ff ff       	call   802935 <strcpy>
+  802977:	89 d8                	mov    %ebx,%eax
+  802979:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80297c:	c9                   	leave
+  80297d:	c3                   	ret
+
+0080297e <strncpy>:
+  80297e:	55                   	push   %ebp
+  80297f:	89 e5                	mov    %esp,%ebp
+  802981:	56                   	push   %esi
+  802982:	53                   	push   %ebx
+  802983:	8b 75 08             	mov    0x8(%ebp),%esi
+  802986:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802989:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80298c:	85 db                	test   %ebx,%ebx
+  80298e:	74 17                	je     8029a7 <strncpy+0x29>
+  802990:	01 f3                	add    %esi,%ebx
+  802992:	89 f0                	mov    %esi,%eax
+  802994:	83 c0 01             	add    $0x1,%eax
+  802997:	0f b6 0a             	movzbl (%edx),%ecx
+  80299a:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80299d:	80 f9 01             	cmp    $0x1,%cl
+  8029a0:	83 da ff             	sbb    $0xffffffff,%edx
+  8029a3:	39 c3                	cmp    %eax,%ebx
+  8029a5:	75 ed                	jne    802994 <strncpy+0x16>
+  8029a7:	89 f0                	mov    %esi,%eax
+  8029a9:	5b                   	pop    %ebx
+  8029aa:	5e                   	pop    %esi
+  8029ab:	5d                   	pop    %ebp
+  8029ac:	c3                   	ret
+
+008029ad <strlcpy>:
+  8029ad:	55                   	push   %ebp
+  8029ae:	89 e5                	mov    %esp,%ebp
+  8029b0:	56                   	push   %esi
+  8029b1:	53                   	push   %ebx
+  8029b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029bb:	89 f0                	mov    %esi,%eax
+  8029bd:	85 db                	test   %ebx,%ebx
+  8029bf:	74 1e                	je     8029df <strlcpy+0x32>
+  8029c1:	83 eb 01             	sub    $0x1,%ebx
+  8029c4:	74 16                	je     8029dc <strlcpy+0x2f>
+  8029c6:	01 f3                	add    %esi,%ebx
+  8029c8:	0f b6 0a             	movzbl (%edx),%ecx
+  8029cb:	84 c9                	test   %cl,%cl
+  8029cd:	74 0d                	je     8029dc <strlcpy+0x2f>
+  8029cf:	83 c2 01             	add    $0x1,%edx
+  8029d2:	83 c0 01             	add    $0x1,%eax
+  8029d5:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029d8:	39 d8                	cmp    %ebx,%eax
+  8029da:	75 ec                	jne    8029c8 <strlcpy+0x1b>
+  8029dc:	c6 00 00             	movb   $0x0,(%eax)
+  8029df:	29 f0                	sub    %esi,%eax
+  8029e1:	5b                   	pop    %ebx
+  8029e2:	5e                   	pop    %esi
+  8029e3:	5d                   	pop    %ebp
+  8029e4:	c3                   	ret
+
+008029e5 <strcmp>:
+  8029e5:	55                   	push   %ebp
+  8029e6:	89 e5                	mov    %esp,%ebp
+  8029e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029ee:	0f b6 01             	movzbl (%ecx),%eax
+  8029f1:	84 c0                	test   %al,%al
+  8029f3:	74 11                	je     802a06 <strcmp+0x21>
+  8029f5:	38 02                	cmp    %al,(%edx)
+  8029f7:	75 0d                	jne    802a06 <strcmp+0x21>
+  8029f9:	83 c1 01             	add    $0x1,%ecx
+  8029fc:	83 c2 01             	add    $0x1,%edx
+  8029ff:	0f b6 01             	movzbl (%ecx),%eax
+  802a02:	84 c0                	test   %al,%al
+  802a04:	75 ef                	jne    8029f5 <strcmp+0x10>
+  802a06:	0f b6 c0             	movzbl %al,%eax
+  802a09:	0f b6 12             	movzbl (%edx),%edx
+  802a0c:	29 d0                	sub    %edx,%eax
+  802a0e:	5d                   	pop    %ebp
+  802a0f:	c3                   	ret
+
+00802a10 <strncmp>:
+  802a10:	55                   	push   %ebp
+  802a11:	89 e5                	mov    %esp,%ebp
+  802a13:	53                   	push   %ebx
+  802a14:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a1a:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a22:	85 d2                	test   %edx,%edx
+  802a24:	74 2e                	je     802a54 <strncmp+0x44>
+  802a26:	0f b6 01             	movzbl (%ecx),%eax
+  802a29:	84 c0                	test   %al,%al
+  802a2b:	74 16                	je     802a43 <strncmp+0x33>
+  802a2d:	3a 03                	cmp    (%ebx),%al
+  802a2f:	75 12                	jne    802a43 <strncmp+0x33>
+  802a31:	83 c1 01             	add    $0x1,%ecx
+  802a34:	83 c3 01             	add    $0x1,%ebx
+  802a37:	83 ea 01             	sub    $0x1,%edx
+  802a3a:	75 ea                	jne    802a26 <strncmp+0x16>
+  802a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a41:	eb 11                	jmp    802a54 <strncmp+0x44>
+  802a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a48:	85 d2                	test   %edx,%edx
+  802a4a:	74 08                	je     802a54 <strncmp+0x44>
+  802a4c:	0f b6 01             	movzbl (%ecx),%eax
+  802a4f:	0f b6 13             	movzbl (%ebx),%edx
+  802a52:	29 d0                	sub    %edx,%eax
+  802a54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a57:	c9                   	leave
+  802a58:	c3                   	ret
+
+00802a59 <strchr>:
+  802a59:	55                   	push   %ebp
+  802a5a:	89 e5                	mov    %esp,%ebp
+  802a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a63:	0f b6 10             	movzbl (%eax),%edx
+  802a66:	84 d2                	test   %dl,%dl
+  802a68:	74 15                	je     802a7f <strchr+0x26>
+  802a6a:	38 d1                	cmp    %dl,%cl
+  802a6c:	74 0f                	je     802a7d <strchr+0x24>
+  802a6e:	83 c0 01             	add    $0x1,%eax
+  802a71:	0f b6 10             	movzbl (%eax),%edx
+  802a74:	84 d2                	test   %dl,%dl
+  802a76:	75 f2                	jne    802a6a <strchr+0x11>
+  802a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7d:	5d                   	pop    %ebp
+  802a7e:	c3                   	ret
+  802a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a84:	eb f7                	jmp    802a7d <strchr+0x24>
+
+00802a86 <strfind>:
+  802a86:	55                   	push   %ebp
+  802a87:	89 e5                	mov    %esp,%ebp
+  802a89:	53                   	push   %ebx
+  802a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a90:	0f b6 18             	movzbl (%eax),%ebx
+  802a93:	38 d3                	cmp    %dl,%bl
+  802a95:	74 14                	je     802aab <strfind+0x25>
+  802a97:	89 d1                	mov    %edx,%ecx
+  802a99:	84 db                	test   %bl,%bl
+  802a9b:	74 0e                	je     802aab <strfind+0x25>
+  802a9d:	83 c0 01             	add    $0x1,%eax
+  802aa0:	0f b6 10             	movzbl (%eax),%edx
+  802aa3:	38 ca                	cmp    %cl,%dl
+  802aa5:	74 04                	je     802aab <strfind+0x25>
+  802aa7:	84 d2                	test   %dl,%dl
+  802aa9:	75 f2                	jne    802a9d <strfind+0x17>
+  802aab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aae:	c9                   	leave
+  802aaf:	c3                   	ret
+
+00802ab0 <memset>:
+  802ab0:	55                   	push   %ebp
+  802ab1:	89 e5                	mov    %esp,%ebp
+  802ab3:	57                   	push   %edi
+  802ab4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ab7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802aba:	85 c9                	test   %ecx,%ecx
+  802abc:	74 20                	je     802ade <memset+0x2e>
+  802abe:	89 f8                	mov    %edi,%eax
+  802ac0:	09 c8                	or     %ecx,%eax
+  802ac2:	a8 03                	test   $0x3,%al
+  802ac4:	75 12                	jne    802ad8 <memset+0x28>
+  802ac6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802aca:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802ad0:	c1 e9 02             	shr    $0x2,%ecx
+  802ad3:	fc                   	cld
+  802ad4:	f3 ab                	rep stos %eax,%es:(%edi)
+  802ad6:	eb 06                	jmp    802ade <memset+0x2e>
+  802ad8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802adb:	fc                   	cld
+  802adc:	f3 aa                	rep stos %al,%es:(%edi)
+  802ade:	89 f8                	mov    %edi,%eax
+  802ae0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802ae3:	c9                   	leave
+  802ae4:	c3                   	ret
+
+00802ae5 <memmove>:
+  802ae5:	55                   	push   %ebp
+  802ae6:	89 e5                	mov    %esp,%ebp
+  802ae8:	57                   	push   %edi
+  802ae9:	56                   	push   %esi
+  802aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802af0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802af3:	39 c6                	cmp    %eax,%esi
+  802af5:	73 32                	jae    802b29 <memmove+0x44>
+  802af7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802afa:	39 d0                	cmp    %edx,%eax
+  802afc:	73 2b                	jae    802b29 <memmove+0x44>
+  802afe:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b01:	89 d6                	mov    %edx,%esi
+  802b03:	09 fe                	or     %edi,%esi
+  802b05:	09 ce                	or     %ecx,%esi
+  802b07:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b0d:	75 0e                	jne    802b1d <memmove+0x38>
+  802b0f:	83 ef 04             	sub    $0x4,%edi
+  802b12:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b15:	c1 e9 02             	shr    $0x2,%ecx
+  802b18:	fd                   	std
+  802b19:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b1b:	eb 09                	jmp    802b26 <memmove+0x41>
+  802b1d:	83 ef 01             	sub    $0x1,%edi
+  802b20:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b23:	fd                   	std
+  802b24:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b26:	fc                   	cld
+  802b27:	eb 1a                	jmp    802b43 <memmove+0x5e>
+  802b29:	89 f2                	mov    %esi,%edx
+  802b2b:	09 c2                	or     %eax,%edx
+  802b2d:	09 ca                	or     %ecx,%edx
+  802b2f:	f6 c2 03             	test   $0x3,%dl
+  802b32:	75 0a                	jne    802b3e <memmove+0x59>
+  802b34:	c1 e9 02             	shr    $0x2,%ecx
+  802b37:	89 c7                	mov    %eax,%edi
+  802b39:	fc                   	cld
+  802b3a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b3c:	eb 05                	jmp    802b43 <memmove+0x5e>
+  802b3e:	89 c7                	mov    %eax,%edi
+  802b40:	fc                   	cld
+  802b41:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b43:	5e                   	pop    %esi
+  802b44:	5f                   	pop    %edi
+  802b45:	5d                   	pop    %ebp
+  802b46:	c3                   	ret
+
+00802b47 <memcpy>:
+  802b47:	55                   	push   %ebp
+  802b48:	89 e5                	mov    %esp,%ebp
+  802b4a:	83 ec 0c             	sub    $0xc,%esp
+  802b4d:	ff 75 10             	push   0x10(%ebp)
+  802b50:	ff 75 0c             	push   0xc(%ebp)
+  802b53:	ff 75 08             	push   0x8(%ebp)
+  802b56:	e8 8a ff ff ff       	call   802ae5 <memmove>
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <memcmp>:
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	56                   	push   %esi
+  802b61:	53                   	push   %ebx
+  802b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b68:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b6b:	85 f6                	test   %esi,%esi
+  802b6d:	74 29                	je     802b98 <memcmp+0x3b>
+  802b6f:	01 c6                	add    %eax,%esi
+  802b71:	0f b6 08             	movzbl (%eax),%ecx
+  802b74:	0f b6 1a             	movzbl (%edx),%ebx
+  802b77:	38 d9                	cmp    %bl,%cl
+  802b79:	75 11                	jne    802b8c <memcmp+0x2f>
+  802b7b:	83 c0 01             	add    $0x1,%eax
+  802b7e:	83 c2 01             	add    $0x1,%edx
+  802b81:	39 c6                	cmp    %eax,%esi
+  802b83:	75 ec                	jne    802b71 <memcmp+0x14>
+  802b85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8a:	eb 08                	jmp    802b94 <memcmp+0x37>
+  802b8c:	0f b6 c1             	movzbl %cl,%eax
+  802b8f:	0f b6 db             	movzbl %bl,%ebx
+  802b92:	29 d8                	sub    %ebx,%eax
+  802b94:	5b                   	pop    %ebx
+  802b95:	5e                   	pop    %esi
+  802b96:	5d                   	pop    %ebp
+  802b97:	c3                   	ret
+  802b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9d:	eb f5                	jmp    802b94 <memcmp+0x37>
+
+00802b9f <memfind>:
+  802b9f:	55                   	push   %ebp
+  802ba0:	89 e5                	mov    %esp,%ebp
+  802ba2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ba8:	89 c2                	mov    %eax,%edx
+  802baa:	03 55 10             	add    0x10(%ebp),%edx
+  802bad:	39 d0                	cmp    %edx,%eax
+  802baf:	73 0d                	jae    802bbe <memfind+0x1f>
+  802bb1:	38 08                	cmp    %cl,(%eax)
+  802bb3:	74 0d                	je     802bc2 <memfind+0x23>
+  802bb5:	83 c0 01             	add    $0x1,%eax
+  802bb8:	39 c2                	cmp    %eax,%edx
+  802bba:	75 f5                	jne    802bb1 <memfind+0x12>
+  802bbc:	eb 06                	jmp    802bc4 <memfind+0x25>
+  802bbe:	89 c2                	mov    %eax,%edx
+  802bc0:	eb 02                	jmp    802bc4 <memfind+0x25>
+  802bc2:	89 c2                	mov    %eax,%edx
+  802bc4:	89 d0                	mov    %edx,%eax
+  802bc6:	5d                   	pop    %ebp
+  802bc7:	c3                   	ret
+
+00802bc8 <strtol>:
+  802bc8:	55                   	push   %ebp
+  802bc9:	89 e5                	mov    %esp,%ebp
+  802bcb:	57                   	push   %edi
+  802bcc:	56                   	push   %esi
+  802bcd:	53                   	push   %ebx
+  802bce:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bd4:	0f b6 02             	movzbl (%edx),%eax
+  802bd7:	3c 20                	cmp    $0x20,%al
+  802bd9:	74 04                	je     802bdf <strtol+0x17>
+  802bdb:	3c 09                	cmp    $0x9,%al
+  802bdd:	75 0e                	jne    802bed <strtol+0x25>
+  802bdf:	83 c2 01             	add    $0x1,%edx
+  802be2:	0f b6 02             	movzbl (%edx),%eax
+  802be5:	3c 20                	cmp    $0x20,%al
+  802be7:	74 f6                	je     802bdf <strtol+0x17>
+  802be9:	3c 09                	cmp    $0x9,%al
+  802beb:	74 f2                	je     802bdf <strtol+0x17>
+  802bed:	3c 2b                	cmp    $0x2b,%al
+  802bef:	74 2a                	je     802c1b <strtol+0x53>
+  802bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf6:	3c 2d                	cmp    $0x2d,%al
+  802bf8:	74 2b                	je     802c25 <strtol+0x5d>
+  802bfa:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c00:	75 0f                	jne    802c11 <strtol+0x49>
+  802c02:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c05:	74 28                	je     802c2f <strtol+0x67>
+  802c07:	85 db                	test   %ebx,%ebx
+  802c09:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c0e:	0f 44 d8             	cmove  %eax,%ebx
+  802c11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c16:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c19:	eb 46                	jmp    802c61 <strtol+0x99>
+  802c1b:	83 c2 01             	add    $0x1,%edx
+  802c1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c23:	eb d5                	jmp    802bfa <strtol+0x32>
+  802c25:	83 c2 01             	add    $0x1,%edx
+  802c28:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c2d:	eb cb                	jmp    802bfa <strtol+0x32>
+  802c2f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c33:	74 0e                	je     802c43 <strtol+0x7b>
+  802c35:	85 db                	test   %ebx,%ebx
+  802c37:	75 d8                	jne    802c11 <strtol+0x49>
+  802c39:	83 c2 01             	add    $0x1,%edx
+  802c3c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c41:	eb ce                	jmp    802c11 <strtol+0x49>
+  802c43:	83 c2 02             	add    $0x2,%edx
+  802c46:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c4b:	eb c4                	jmp    802c11 <strtol+0x49>
+  802c4d:	0f be c0             	movsbl %al,%eax
+  802c50:	83 e8 30             	sub    $0x30,%eax
+  802c53:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c56:	7d 3a                	jge    802c92 <strtol+0xca>
+  802c58:	83 c2 01             	add    $0x1,%edx
+  802c5b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c5f:	01 c1                	add    %eax,%ecx
+  802c61:	0f b6 02             	movzbl (%edx),%eax
+  802c64:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c67:	89 f3                	mov    %esi,%ebx
+  802c69:	80 fb 09             	cmp    $0x9,%bl
+  802c6c:	76 df                	jbe    802c4d <strtol+0x85>
+  802c6e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802c71:	89 f3                	mov    %esi,%ebx
+  802c73:	80 fb 19             	cmp    $0x19,%bl
+  802c76:	77 08                	ja     802c80 <strtol+0xb8>
+  802c78:	0f be c0             	movsbl %al,%eax
+  802c7b:	83 e8 57             	sub    $0x57,%eax
+  802c7e:	eb d3                	jmp    802c53 <strtol+0x8b>
+  802c80:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802c83:	89 f3                	mov    %esi,%ebx
+  802c85:	80 fb 19             	cmp    $0x19,%bl
+  802c88:	77 08                	ja     802c92 <strtol+0xca>
+  802c8a:	0f be c0             	movsbl %al,%eax
+  802c8d:	83 e8 37             	sub    $0x37,%eax
+  802c90:	eb c1                	jmp    802c53 <strtol+0x8b>
+  802c92:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802c96:	74 05                	je     802c9d <strtol+0xd5>
+  802c98:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c9b:	89 10                	mov    %edx,(%eax)
+  802c9d:	89 c8                	mov    %ecx,%eax
+  802c9f:	f7 d8                	neg    %eax
+  802ca1:	85 ff                	test   %edi,%edi
+  802ca3:	0f 45 c8             	cmovne %eax,%ecx
+  802ca6:	89 c8                	mov    %ecx,%eax
+  802ca8:	5b                   	pop    %ebx
+  802ca9:	5e                   	pop    %esi
+  802caa:	5f                   	pop    %edi
+  802cab:	5d                   	pop    %ebp
+  802cac:	c3                   	ret
+
+00802cad <ipc_recv>:
+  802cad:	55                   	push   %ebp
+  802cae:	89 e5                	mov    %esp,%ebp
+  802cb0:	56                   	push   %esi
+  802cb1:	53                   	push   %ebx
+  802cb2:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cbb:	85 c0                	test   %eax,%eax
+  802cbd:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cc2:	0f 44 c2             	cmove  %edx,%eax
+  802cc5:	83 ec 0c             	sub    $0xc,%esp
+  802cc8:	50                   	push   %eax
+  802cc9:	e8 73 d7 ff ff       	call   800441 <sys_ipc_recv>
+  802cce:	83 c4 10             	add    $0x10,%esp
+  802cd1:	85 c0                	test   %eax,%eax
+  802cd3:	78 2a                	js     802cff <ipc_recv+0x52>
+  802cd5:	a1 10 50 80 00       	mov    0x805010,%eax
+  802cda:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802ce0:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802ce6:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802cec:	85 f6                	test   %esi,%esi
+  802cee:	74 02                	je     802cf2 <ipc_recv+0x45>
+  802cf0:	89 0e                	mov    %ecx,(%esi)
+  802cf2:	85 db                	test   %ebx,%ebx
+  802cf4:	74 02                	je     802cf8 <ipc_recv+0x4b>
+  802cf6:	89 13                	mov    %edx,(%ebx)
+  802cf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cfb:	5b                   	pop    %ebx
+  802cfc:	5e                   	pop    %esi
+  802cfd:	5d                   	pop    %ebp
+  802cfe:	c3                   	ret
+  802cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d09:	eb e1                	jmp    802cec <ipc_recv+0x3f>
+
+00802d0b <ipc_send>:
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	57                   	push   %edi
+  802d0f:	56                   	push   %esi
+  802d10:	53                   	push   %ebx
+  802d11:	83 ec 0c             	sub    $0xc,%esp
+  802d14:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d1a:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d1d:	85 db                	test   %ebx,%ebx
+  802d1f:	74 1e                	je     802d3f <ipc_send+0x34>
+  802d21:	56                   	push   %esi
+  802d22:	53                   	push   %ebx
+  802d23:	57                   	push   %edi
+  802d24:	ff 75 08             	push   0x8(%ebp)
+  802d27:	e8 a2 d7 ff ff       	call   8004ce <sys_ipc_send>
+  802d2c:	83 c4 10             	add    $0x10,%esp
+  802d2f:	85 c0                	test   %eax,%eax
+  802d31:	74 2a                	je     802d5d <ipc_send+0x52>
+  802d33:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d36:	75 13                	jne    802d4b <ipc_send+0x40>
+  802d38:	e8 0e d4 ff ff       	call   80014b <sys_yield>
+  802d3d:	eb e2                	jmp    802d21 <ipc_send+0x16>
+  802d3f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d44:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d49:	eb d6                	jmp    802d21 <ipc_send+0x16>
+  802d4b:	50                   	push   %eax
+  802d4c:	68 0c 36 80 00       	push   $0x80360c
+  802d51:	6a 4f                	push   $0x4f
+  802d53:	68 4f 36 80 00       	push   $0x80364f
+  802d58:	e8 06 f4 ff ff       	call   802163 <_panic>
+  802d5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d60:	5b                   	pop    %ebx
+  802d61:	5e                   	pop    %esi
+  802d62:	5f                   	pop    %edi
+  802d63:	5d                   	pop    %ebp
+  802d64:	c3                   	ret
+
+00802d65 <ipc_call>:
+  802d65:	55                   	push   %ebp
+  802d66:	89 e5                	mov    %esp,%ebp
+  802d68:	57                   	push   %edi
+  802d69:	56                   	push   %esi
+  802d6a:	53                   	push   %ebx
+  802d6b:	83 ec 0c             	sub    $0xc,%esp
+  802d6e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d72:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d77:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d7b:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d7f:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d84:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802d88:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d91:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802d95:	eb 05                	jmp    802d9c <ipc_call+0x37>
+  802d97:	e8 af d3 ff ff       	call   80014b <sys_yield>
+  802d9c:	83 ec 0c             	sub    $0xc,%esp
+  802d9f:	56                   	push   %esi
+  802da0:	53                   	push   %ebx
+  802da1:	57                   	push   %edi
+  802da2:	ff 75 0c             	push   0xc(%ebp)
+  802da5:	ff 75 08             	push   0x8(%ebp)
+  802da8:	e8 71 d7 ff ff       	call   80051e <sys_ipc_call>
+  802dad:	83 c4 20             	add    $0x20,%esp
+  802db0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802db3:	74 e2                	je     802d97 <ipc_call+0x32>
+  802db5:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802db8:	74 2d                	je     802de7 <ipc_call+0x82>
+  802dba:	85 c0                	test   %eax,%eax
+  802dbc:	78 4f                	js     802e0d <ipc_call+0xa8>
+  802dbe:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802dc2:	74 10                	je     802dd4 <ipc_call+0x6f>
+  802dc4:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dc9:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802dcf:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802dd2:	89 02                	mov    %eax,(%edx)
+  802dd4:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dd9:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de2:	5b                   	pop    %ebx
+  802de3:	5e                   	pop    %esi
+  802de4:	5f                   	pop    %edi
+  802de5:	5d                   	pop    %ebp
+  802de6:	c3                   	ret
+  802de7:	ff 75 14             	push   0x14(%ebp)
+  802dea:	ff 75 10             	push   0x10(%ebp)
+  802ded:	ff 75 0c             	push   0xc(%ebp)
+  802df0:	ff 75 08             	push   0x8(%ebp)
+  802df3:	e8 13 ff ff ff       	call   802d0b <ipc_send>
+  802df8:	83 c4 0c             	add    $0xc,%esp
+  802dfb:	ff 75 1c             	push   0x1c(%ebp)
+  802dfe:	ff 75 18             	push   0x18(%ebp)
+  802e01:	6a 00                	push   $0x0
+  802e03:	e8 a5 fe ff ff       	call   802cad <ipc_recv>
+  802e08:	83 c4 10             	add    $0x10,%esp
+  802e0b:	eb d2                	jmp    802ddf <ipc_call+0x7a>
+  802e0d:	50                   	push   %eax
+  802e0e:	68 59 36 80 00       	push   $0x803659
+  802e13:	6a 6d                	push   $0x6d
+  802e15:	68 4f 36 80 00       	push   $0x80364f
+  802e1a:	e8 44 f3 ff ff       	call   802163 <_panic>
+
+00802e1f <ipc_reply_recv>:
+  802e1f:	55                   	push   %ebp
+  802e20:	89 e5                	mov    %esp,%ebp
+  802e22:	57                   	push   %edi
+  802e23:	56                   	push   %esi
+  802e24:	53                   	push   %ebx
+  802e25:	83 ec 0c             	sub    $0xc,%esp
+  802e28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e2b:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e2e:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e31:	85 db                	test   %ebx,%ebx
+  802e33:	0f 84 ac 00 00 00    	je     802ee5 <ipc_reply_recv+0xc6>
+  802e39:	85 f6                	test   %esi,%esi
+  802e3b:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e40:	0f 45 c6             	cmovne %esi,%eax
+  802e43:	83 ec 0c             	sub    $0xc,%esp
+  802e46:	50                   	push   %eax
+  802e47:	ff 75 14             	push   0x14(%ebp)
+  802e4a:	53                   	push   %ebx
+  802e4b:	ff 75 0c             	push   0xc(%ebp)
+  802e4e:	ff 75 08             	push   0x8(%ebp)
+  802e51:	e8 e9 d6 ff ff       	call   80053f <sys_ipc_reply_recv>
+  802e56:	83 c4 20             	add    $0x20,%esp
+  802e59:	85 c0                	test   %eax,%eax
+  802e5b:	78 3a                	js     802e97 <ipc_reply_recv+0x78>
+  802e5d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e61:	74 10                	je     802e73 <ipc_reply_recv+0x54>
+  802e63:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e68:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e6e:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e71:	89 02                	mov    %eax,(%edx)
+  802e73:	85 ff                	test   %edi,%edi
+  802e75:	74 0d                	je     802e84 <ipc_reply_recv+0x65>
+  802e77:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e7c:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e82:	89 07                	mov    %eax,(%edi)
+  802e84:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e89:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e92:	5b                   	pop    %ebx
+  802e93:	5e                   	pop    %esi
+  802e94:	5f                   	pop    %edi
+  802e95:	5d                   	pop    %ebp
+  802e96:	c3                   	ret
+  802e97:	ff 75 14             	push   0x14(%ebp)
+  802e9a:	53                   	push   %ebx
+  802e9b:	ff 75 0c             	push   0xc(%ebp)
+  802e9e:	ff 75 08             	push   0x8(%ebp)
+  802ea1:	e8 4b d5 ff ff       	call   8003f1 <sys_ipc_try_send>
+  802ea6:	89 c2                	mov    %eax,%edx
+  802ea8:	c1 ea 1f             	shr    $0x1f,%edx
+  802eab:	83 c4 10             	add    $0x10,%esp
+  802eae:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802eb1:	0f 95 c1             	setne  %cl
+  802eb4:	84 d1                	test   %dl,%cl
+  802eb6:	74 05                	je     802ebd <ipc_reply_recv+0x9e>
+  802eb8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ebb:	75 12                	jne    802ecf <ipc_reply_recv+0xb0>
+  802ebd:	83 ec 04             	sub    $0x4,%esp
+  802ec0:	57                   	push   %edi
+  802ec1:	56                   	push   %esi
+  802ec2:	ff 75 18             	push   0x18(%ebp)
+  802ec5:	e8 e3 fd ff ff       	call   802cad <ipc_recv>
+  802eca:	83 c4 10             	add    $0x10,%esp
+  802ecd:	eb c0                	jmp    802e8f <ipc_reply_recv+0x70>
+  802ecf:	83 ec 04             	sub    $0x4,%esp
+  802ed2:	50                   	push   %eax
+  802ed3:	ff 75 08             	push   0x8(%ebp)
+  802ed6:	68 2c 36 80 00       	push   $0x80362c
+  802edb:	e8 5e f3 ff ff       	call   80223e <cprintf>
+  802ee0:	83 c4 10             	add    $0x10,%esp
+  802ee3:	eb d8                	jmp    802ebd <ipc_reply_recv+0x9e>
+  802ee5:	85 f6                	test   %esi,%esi
+  802ee7:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802eec:	0f 45 c6             	cmovne %esi,%eax
+  802eef:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802ef4:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802efb:	e9 43 ff ff ff       	jmp    802e43 <ipc_reply_recv+0x24>
+
+00802f00 <ipc_find_env>:
+  802f00:	55                   	push   %ebp
+  802f01:	89 e5                	mov    %esp,%ebp
+  802f03:	83 ec 14             	sub    $0x14,%esp
+  802f06:	ff 75 08             	push   0x8(%ebp)
+  802f09:	e8 81 d4 ff ff       	call   80038f <sys_env_service>
+  802f0e:	85 c0                	test   %eax,%eax
+  802f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f15:	0f 48 c2             	cmovs  %edx,%eax
+  802f18:	c9                   	leave
+  802f19:	c3                   	ret
+
+00802f1a <pageref>:
+  802f1a:	55                   	push   %ebp
+  802f1b:	89 e5                	mov    %esp,%ebp
+  802f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f20:	89 c2                	mov    %eax,%edx
+  802f22:	c1 ea 16             	shr    $0x16,%edx
+  802f25:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f31:	f6 c1 01             	test   $0x1,%cl
+  802f34:	74 22                	je     802f58 <pageref+0x3e>
+  802f36:	c1 e8 0c             	shr    $0xc,%eax
+  802f39:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f40:	a8 01                	test   $0x1,%al
+  802f42:	74 14                	je     802f58 <pageref+0x3e>
+  802f44:	c1 e8 0c             	shr    $0xc,%eax
+  802f47:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f4a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f51:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f55:	0f b7 d2             	movzwl %dx,%edx
+  802f58:	89 d0                	mov    %edx,%eax
+  802f5a:	5d                   	pop    %ebp
+  802f5b:	c3                   	ret
+
+00802f5c <__udivmoddi4>:
+  802f5c:	55                   	push   %ebp
+  802f5d:	57                   	push   %edi
+  802f5e:	56                   	push   %esi
+  802f5f:	53                   	push   %ebx
+  802f60:	83 ec 24             	sub    $0x24,%esp
+  802f63:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f67:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f6b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f6f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f73:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f77:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f7b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f7f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f83:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f91:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f96:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802f9d:	00 
+  802f9e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fa5:	00 
+  802fa6:	89 fb                	mov    %edi,%ebx
+  802fa8:	eb 08                	jmp    802fb2 <__udivmoddi4+0x56>
+  802faa:	83 e9 01             	sub    $0x1,%ecx
+  802fad:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fb0:	74 68                	je     80301a <__udivmoddi4+0xbe>
+  802fb2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fb6:	01 c0                	add    %eax,%eax
+  802fb8:	89 c6                	mov    %eax,%esi
+  802fba:	89 d7                	mov    %edx,%edi
+  802fbc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fc0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fc4:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fc7:	d3 ea                	shr    %cl,%edx
+  802fc9:	f6 c1 20             	test   $0x20,%cl
+  802fcc:	74 04                	je     802fd2 <__udivmoddi4+0x76>
+  802fce:	89 d0                	mov    %edx,%eax
+  802fd0:	31 d2                	xor    %edx,%edx
+  802fd2:	83 e0 01             	and    $0x1,%eax
+  802fd5:	89 04 24             	mov    %eax,(%esp)
+  802fd8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fdf:	00 
+  802fe0:	8b 04 24             	mov    (%esp),%eax
+  802fe3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802fe7:	09 f0                	or     %esi,%eax
+  802fe9:	09 fa                	or     %edi,%edx
+  802feb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802fef:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802ff3:	39 f0                	cmp    %esi,%eax
+  802ff5:	89 d5                	mov    %edx,%ebp
+  802ff7:	19 fd                	sbb    %edi,%ebp
+  802ff9:	72 af                	jb     802faa <__udivmoddi4+0x4e>
+  802ffb:	29 f0                	sub    %esi,%eax
+  802ffd:	19 fa                	sbb    %edi,%edx
+  802fff:	89 cf                	mov    %ecx,%edi
+  803001:	c1 ef 05             	shr    $0x5,%edi
+  803004:	83 e7 01             	and    $0x1,%edi
+  803007:	89 fe                	mov    %edi,%esi
+  803009:	83 f6 01             	xor    $0x1,%esi
+  80300c:	d3 e6                	shl    %cl,%esi
+  80300e:	d3 e7                	shl    %cl,%edi
+  803010:	09 74 24 18          	or     %esi,0x18(%esp)
+  803014:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803018:	eb 90                	jmp    802faa <__udivmoddi4+0x4e>
+  80301a:	85 db                	test   %ebx,%ebx
+  80301c:	74 05                	je     803023 <__udivmoddi4+0xc7>
+  80301e:	89 03                	mov    %eax,(%ebx)
+  803020:	89 53 04             	mov    %edx,0x4(%ebx)
+  803023:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803027:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80302b:	83 c4 24             	add    $0x24,%esp
+  80302e:	5b                   	pop    %ebx
+  80302f:	5e                   	pop    %esi
+  803030:	5f                   	pop    %edi
+  803031:	5d                   	pop    %ebp
+  803032:	c3                   	ret
+
+00803033 <__udivdi3>:
+  803033:	83 ec 08             	sub    $0x8,%esp
+  803036:	6a 00                	push   $0x0
+  803038:	ff 74 24 1c          	push   0x1c(%esp)
+  80303c:	ff 74 24 1c          	push   0x1c(%esp)
+  803040:	ff 74 24 1c          	push   0x1c(%esp)
+  803044:	ff 74 24 1c          	push   0x1c(%esp)
+  803048:	e8 0f ff ff ff       	call   802f5c <__udivmoddi4>
+  80304d:	83 c4 1c             	add    $0x1c,%esp
+  803050:	c3                   	ret
+
+00803051 <__umoddi3>:
+  803051:	83 ec 18             	sub    $0x18,%esp
+  803054:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803058:	50                   	push   %eax
+  803059:	ff 74 24 2c          	push   0x2c(%esp)
+  80305d:	ff 74 24 2c          	push   0x2c(%esp)
+  803061:	ff 74 24 2c          	push   0x2c(%esp)
+  803065:	ff 74 24 2c          	push   0x2c(%esp)
+  803069:	e8 ee fe ff ff       	call   802f5c <__udivmoddi4>
+  80306e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803072:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803076:	83 c4 2c             	add    $0x2c,%esp
+  803079:	c3                   	ret
+
+0080307a <__divdi3>:
+  80307a:	53                   	push   %ebx
+  80307b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80307f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803083:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803087:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80308b:	85 d2                	test   %edx,%edx
+  80308d:	78 12                	js     8030a1 <__divdi3+0x27>
+  80308f:	85 db                	test   %ebx,%ebx
+  803091:	78 2e                	js     8030c1 <__divdi3+0x47>
+  803093:	53                   	push   %ebx
+  803094:	51                   	push   %ecx
+  803095:	52                   	push   %edx
+  803096:	50                   	push   %eax
+  803097:	e8 97 ff ff ff       	call   803033 <__udivdi3>
+  80309c:	83 c4 10             	add    $0x10,%esp
+  80309f:	eb 1e                	jmp    8030bf <__divdi3+0x45>
+  8030a1:	f7 d8                	neg    %eax
+  8030a3:	83 d2 00             	adc    $0x0,%edx
+  8030a6:	f7 da                	neg    %edx
+  8030a8:	85 db                	test   %ebx,%ebx
+  8030aa:	78 2a                	js     8030d6 <__divdi3+0x5c>
+  8030ac:	53                   	push   %ebx
+  8030ad:	51                   	push   %ecx
+  8030ae:	52                   	push   %edx
+  8030af:	50                   	push   %eax
+  8030b0:	e8 7e ff ff ff       	call   803033 <__udivdi3>
+  8030b5:	83 c4 10             	add    $0x10,%esp
+  8030b8:	f7 d8                	neg    %eax
+  8030ba:	83 d2 00             	adc    $0x0,%edx
+  8030bd:	f7 da                	neg    %edx
+  8030bf:	5b                   	pop    %ebx
+  8030c0:	c3                   	ret
+  8030c1:	f7 d9                	neg    %ecx
+  8030c3:	83 d3 00             	adc    $0x0,%ebx
+  8030c6:	f7 db                	neg    %ebx
+  8030c8:	53                   	push   %ebx
+  8030c9:	51                   	push   %ecx
+  8030ca:	52                   	push   %edx
+  8030cb:	50                   	push   %eax
+  8030cc:	e8 62 ff ff ff       	call   803033 <__udivdi3>
+  8030d1:	83 c4 10             	add    $0x10,%esp
+  8030d4:	eb e2                	jmp    8030b8 <__divdi3+0x3e>
+  8030d6:	f7 d9                	neg    %ecx
+  8030d8:	83 d3 00             	adc    $0x0,%ebx
+  8030db:	f7 db                	neg    %ebx
+  8030dd:	53                   	push   %ebx
+  8030de:	51                   	push   %ecx
+  8030df:	52                   	push   %edx
+  8030e0:	50                   	push   %eax
+  8030e1:	e8 4d ff ff ff       	call   803033 <__udivdi3>
+  8030e6:	83 c4 10             	add    $0x10,%esp
+  8030e9:	eb d4                	jmp    8030bf <__divdi3+0x45>
+
+008030eb <__moddi3>:
+  8030eb:	55                   	push   %ebp
+  8030ec:	57                   	push   %edi
+  8030ed:	56                   	push   %esi
+  8030ee:	53                   	push   %ebx
+  8030ef:	83 ec 0c             	sub    $0xc,%esp
+  8030f2:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8030f6:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8030fa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030fe:	89 e9                	mov    %ebp,%ecx
+  803100:	f7 d9                	neg    %ecx
+  803102:	89 d0                	mov    %edx,%eax
+  803104:	83 d0 00             	adc    $0x0,%eax
+  803107:	f7 d8                	neg    %eax
+  803109:	0f 49 e9             	cmovns %ecx,%ebp
+  80310c:	0f 49 d0             	cmovns %eax,%edx
+  80310f:	52                   	push   %edx
+  803110:	55                   	push   %ebp
+  803111:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803115:	f7 da                	neg    %edx
+  803117:	89 d8                	mov    %ebx,%eax
+  803119:	83 d0 00             	adc    $0x0,%eax
+  80311c:	f7 d8                	neg    %eax
+  80311e:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803123:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803127:	0f 48 c3             	cmovs  %ebx,%eax
+  80312a:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80312e:	ff 74 24 0c          	push   0xc(%esp)
+  803132:	ff 74 24 0c          	push   0xc(%esp)
+  803136:	e8 16 ff ff ff       	call   803051 <__umoddi3>
+  80313b:	83 c4 10             	add    $0x10,%esp
+  80313e:	85 db                	test   %ebx,%ebx
+  803140:	78 08                	js     80314a <__moddi3+0x5f>
+  803142:	83 c4 0c             	add    $0xc,%esp
+  803145:	5b                   	pop    %ebx
+  803146:	5e                   	pop    %esi
+  803147:	5f                   	pop    %edi
+  803148:	5d                   	pop    %ebp
+  803149:	c3                   	ret
+  80314a:	f7 d8                	neg    %eax
+  80314c:	83 d2 00             	adc    $0x0,%edx
+  80314f:	f7 da                	neg    %edx
+  803151:	eb ef                	jmp    803142 <__moddi3+0x57>
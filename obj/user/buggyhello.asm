@@ -0,0 +1,5040 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 7e 00 00 00       	call   8000c0 <sys_cputs>
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800052:	e8 e7 00 00 00       	call   80013e <sys_getenvid>
+  800057:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800062:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800067:	a3 10 50 80 00       	mov    %eax,0x805010
+  80006c:	85 db                	test   %ebx,%ebx
+  80006e:	7e 07                	jle    800077 <libmain+0x30>
+  800070:	8b 06                	mov    (%esi),%eax
+  800072:	a3 00 40 80 00       	mov    %eax,0x804000
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	56                   	push   %esi
+  80007b:	53                   	push   %ebx
+  80007c:	e8 b2 ff ff ff       	call   800033 <umain>
+  800081:	e8 0a 00 00 00       	call   800090 <exit>
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008c:	5b                   	pop    %ebx
+  80008d:	5e                   	pop    %esi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+
+00800090 <exit>:
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	83 ec 08             	sub    $0x8,%esp
+  800096:	a1 10 50 80 00       	mov    0x805010,%eax
+  80009b:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000a1:	85 c0                	test   %eax,%eax
+  8000a3:	75 14                	jne    8000b9 <exit+0x29>
+  8000a5:	e8 36 0b 00 00       	call   800be0 <close_all>
+  8000aa:	83 ec 0c             	sub    $0xc,%esp
+  8000ad:	6a 00                	push   $0x0
+  8000af:	e8 49 00 00 00       	call   8000fd <sys_env_destroy>
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	c9                   	leave
+  8000b8:	c3                   	ret
+  8000b9:	e8 ac 07 00 00       	call   80086a <sys_lease_complete>
+  8000be:	eb e5                	jmp    8000a5 <exit+0x15>
+
+008000c0 <sys_cputs>:
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d1:	89 c3                	mov    %eax,%ebx
+  8000d3:	89 c7                	mov    %eax,%edi
+  8000d5:	89 c6                	mov    %eax,%esi
+  8000d7:	cd 30                	int    $0x30
+  8000d9:	5b                   	pop    %ebx
+  8000da:	5e                   	pop    %esi
+  8000db:	5f                   	pop    %edi
+  8000dc:	5d                   	pop    %ebp
+  8000dd:	c3                   	ret
+
+008000de <sys_cgetc>:
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	57                   	push   %edi
+  8000e2:	56                   	push   %esi
+  8000e3:	53                   	push   %ebx
+  8000e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ee:	89 d1                	mov    %edx,%ecx
+  8000f0:	89 d3                	mov    %edx,%ebx
+  8000f2:	89 d7                	mov    %edx,%edi
+  8000f4:	89 d6                	mov    %edx,%esi
+  8000f6:	cd 30                	int    $0x30
+  8000f8:	5b                   	pop    %ebx
+  8000f9:	5e                   	pop    %esi
+  8000fa:	5f                   	pop    %edi
+  8000fb:	5d                   	pop    %ebp
+  8000fc:	c3                   	ret
+
+008000fd <sys_env_destroy>:
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	57                   	push   %edi
+  800101:	56                   	push   %esi
+  800102:	53                   	push   %ebx
+  800103:	83 ec 0c             	sub    $0xc,%esp
+  800106:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80010e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800113:	89 cb                	mov    %ecx,%ebx
+  800115:	89 cf                	mov    %ecx,%edi
+  800117:	89 ce                	mov    %ecx,%esi
+  800119:	cd 30                	int    $0x30
+  80011b:	85 c0                	test   %eax,%eax
+  80011d:	7f 08                	jg     800127 <sys_env_destroy+0x2a>
+  80011f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800122:	5b                   	pop    %ebx
+  800123:	5e                   	pop    %esi
+  800124:	5f                   	pop    %edi
+  800125:	5d                   	pop    %ebp
+  800126:	c3                   	ret
+  800127:	83 ec 0c             	sub    $0xc,%esp
+  80012a:	50                   	push   %eax
+  80012b:	6a 03                	push   $0x3
+  80012d:	68 8a 31 80 00       	push   $0x80318a
+  800132:	6a 24                	push   $0x24
+  800134:	68 a7 31 80 00       	push   $0x8031a7
+  800139:	e8 37 20 00 00       	call   802175 <_panic>
+
+0080013e <sys_getenvid>:
+  80013e:	55                   	push   %ebp
+  80013f:	89 e5                	mov    %esp,%ebp
+  800141:	57                   	push   %edi
+  800142:	56                   	push   %esi
+  800143:	53                   	push   %ebx
+  800144:	ba 00 00 00 00       	mov    $0x0,%edx
+  800149:	b8 02 00 00 00       	mov    $0x2,%eax
+  80014e:	89 d1                	mov    %edx,%ecx
+  800150:	89 d3                	mov    %edx,%ebx
+  800152:	89 d7                	mov    %edx,%edi
+  800154:	89 d6                	mov    %edx,%esi
+  800156:	cd 30                	int    $0x30
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <sys_yield>:
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	57                   	push   %edi
+  800161:	56                   	push   %esi
+  800162:	53                   	push   %ebx
+  800163:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80016a:	74 26                	je     800192 <sys_yield+0x35>
+  80016c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800171:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800176:	89 d1                	mov    %edx,%ecx
+  800178:	89 d3                	mov    %edx,%ebx
+  80017a:	89 d7                	mov    %edx,%edi
+  80017c:	6a 00                	push   $0x0
+  80017e:	55                   	push   %ebp
+  80017f:	89 e5                	mov    %esp,%ebp
+  800181:	8d 35 89 01 80 00    	lea    0x800189,%esi
+  800187:	0f 34                	sysenter
+  800189:	5d                   	pop    %ebp
+  80018a:	83 c4 04             	add    $0x4,%esp
+  80018d:	5b                   	pop    %ebx
+  80018e:	5e                   	pop    %esi
+  80018f:	5f                   	pop    %edi
+  800190:	5d                   	pop    %ebp
+  800191:	c3                   	ret
+  800192:	ba 00 00 00 00       	mov    $0x0,%edx
+  800197:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80019c:	89 d1                	mov    %edx,%ecx
+  80019e:	89 d3                	mov    %edx,%ebx
+  8001a0:	89 d7                	mov    %edx,%edi
+  8001a2:	89 d6                	mov    %edx,%esi
+  8001a4:	cd 30                	int    $0x30
+  8001a6:	eb e5                	jmp    80018d <sys_yield+0x30>
+
+008001a8 <sys_page_alloc>:
+  8001a8:	55                   	push   %ebp
+  8001a9:	89 e5                	mov    %esp,%ebp
+  8001ab:	57                   	push   %edi
+  8001ac:	56                   	push   %esi
+  8001ad:	53                   	push   %ebx
+  8001ae:	83 ec 0c             	sub    $0xc,%esp
+  8001b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001bc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c4:	89 f7                	mov    %esi,%edi
+  8001c6:	cd 30                	int    $0x30
+  8001c8:	85 c0                	test   %eax,%eax
+  8001ca:	7f 08                	jg     8001d4 <sys_page_alloc+0x2c>
+  8001cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cf:	5b                   	pop    %ebx
+  8001d0:	5e                   	pop    %esi
+  8001d1:	5f                   	pop    %edi
+  8001d2:	5d                   	pop    %ebp
+  8001d3:	c3                   	ret
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+  8001d7:	50                   	push   %eax
+  8001d8:	6a 04                	push   $0x4
+  8001da:	68 8a 31 80 00       	push   $0x80318a
+  8001df:	6a 24                	push   $0x24
+  8001e1:	68 a7 31 80 00       	push   $0x8031a7
+  8001e6:	e8 8a 1f 00 00       	call   802175 <_panic>
+
+008001eb <sys_page_map>:
+  8001eb:	55                   	push   %ebp
+  8001ec:	89 e5                	mov    %esp,%ebp
+  8001ee:	57                   	push   %edi
+  8001ef:	56                   	push   %esi
+  8001f0:	53                   	push   %ebx
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+  8001f4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8001fb:	74 33                	je     800230 <sys_page_map+0x45>
+  8001fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800203:	b8 05 00 00 00       	mov    $0x5,%eax
+  800208:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80020b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80020e:	ff 75 18             	push   0x18(%ebp)
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	8d 35 1c 02 80 00    	lea    0x80021c,%esi
+  80021a:	0f 34                	sysenter
+  80021c:	5d                   	pop    %ebp
+  80021d:	83 c4 04             	add    $0x4,%esp
+  800220:	89 c2                	mov    %eax,%edx
+  800222:	85 c0                	test   %eax,%eax
+  800224:	7f 3d                	jg     800263 <sys_page_map+0x78>
+  800226:	89 d0                	mov    %edx,%eax
+  800228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80022b:	5b                   	pop    %ebx
+  80022c:	5e                   	pop    %esi
+  80022d:	5f                   	pop    %edi
+  80022e:	5d                   	pop    %ebp
+  80022f:	c3                   	ret
+  800230:	b8 05 00 00 00       	mov    $0x5,%eax
+  800235:	8b 55 08             	mov    0x8(%ebp),%edx
+  800238:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80023e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800241:	8b 75 18             	mov    0x18(%ebp),%esi
+  800244:	cd 30                	int    $0x30
+  800246:	89 c2                	mov    %eax,%edx
+  800248:	85 c0                	test   %eax,%eax
+  80024a:	7e da                	jle    800226 <sys_page_map+0x3b>
+  80024c:	83 ec 0c             	sub    $0xc,%esp
+  80024f:	50                   	push   %eax
+  800250:	6a 05                	push   $0x5
+  800252:	68 8a 31 80 00       	push   $0x80318a
+  800257:	6a 24                	push   $0x24
+  800259:	68 a7 31 80 00       	push   $0x8031a7
+  80025e:	e8 12 1f 00 00       	call   802175 <_panic>
+  800263:	83 ec 0c             	sub    $0xc,%esp
+  800266:	50                   	push   %eax
+  800267:	6a 05                	push   $0x5
+  800269:	68 8a 31 80 00       	push   $0x80318a
+  80026e:	6a 48                	push   $0x48
+  800270:	68 a7 31 80 00       	push   $0x8031a7
+  800275:	e8 fb 1e 00 00       	call   802175 <_panic>
+
+0080027a <sys_page_unmap>:
+  80027a:	55                   	push   %ebp
+  80027b:	89 e5                	mov    %esp,%ebp
+  80027d:	57                   	push   %edi
+  80027e:	56                   	push   %esi
+  80027f:	53                   	push   %ebx
+  800280:	83 ec 0c             	sub    $0xc,%esp
+  800283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800288:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80028e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800293:	89 df                	mov    %ebx,%edi
+  800295:	89 de                	mov    %ebx,%esi
+  800297:	cd 30                	int    $0x30
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	7f 08                	jg     8002a5 <sys_page_unmap+0x2b>
+  80029d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5f                   	pop    %edi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+  8002a5:	83 ec 0c             	sub    $0xc,%esp
+  8002a8:	50                   	push   %eax
+  8002a9:	6a 06                	push   $0x6
+  8002ab:	68 8a 31 80 00       	push   $0x80318a
+  8002b0:	6a 24                	push   $0x24
+  8002b2:	68 a7 31 80 00       	push   $0x8031a7
+  8002b7:	e8 b9 1e 00 00       	call   802175 <_panic>
+
+008002bc <sys_fork>:
+  8002bc:	55                   	push   %ebp
+  8002bd:	89 e5                	mov    %esp,%ebp
+  8002bf:	57                   	push   %edi
+  8002c0:	56                   	push   %esi
+  8002c1:	53                   	push   %ebx
+  8002c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002cc:	89 d1                	mov    %edx,%ecx
+  8002ce:	89 d3                	mov    %edx,%ebx
+  8002d0:	89 d7                	mov    %edx,%edi
+  8002d2:	89 d6                	mov    %edx,%esi
+  8002d4:	cd 30                	int    $0x30
+  8002d6:	5b                   	pop    %ebx
+  8002d7:	5e                   	pop    %esi
+  8002d8:	5f                   	pop    %edi
+  8002d9:	5d                   	pop    %ebp
+  8002da:	c3                   	ret
+
+008002db <sys_env_set_status>:
+  8002db:	55                   	push   %ebp
+  8002dc:	89 e5                	mov    %esp,%ebp
+  8002de:	57                   	push   %edi
+  8002df:	56                   	push   %esi
+  8002e0:	53                   	push   %ebx
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ef:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002f4:	89 df                	mov    %ebx,%edi
+  8002f6:	89 de                	mov    %ebx,%esi
+  8002f8:	cd 30                	int    $0x30
+  8002fa:	85 c0                	test   %eax,%eax
+  8002fc:	7f 08                	jg     800306 <sys_env_set_status+0x2b>
+  8002fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800301:	5b                   	pop    %ebx
+  800302:	5e                   	pop    %esi
+  800303:	5f                   	pop    %edi
+  800304:	5d                   	pop    %ebp
+  800305:	c3                   	ret
+  800306:	83 ec 0c             	sub    $0xc,%esp
+  800309:	50                   	push   %eax
+  80030a:	6a 08                	push   $0x8
+  80030c:	68 8a 31 80 00       	push   $0x80318a
+  800311:	6a 24                	push   $0x24
+  800313:	68 a7 31 80 00       	push   $0x8031a7
+  800318:	e8 58 1e 00 00       	call   802175 <_panic>
+
+0080031d <sys_env_set_trapframe>:
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	57                   	push   %edi
+  800321:	56                   	push   %esi
+  800322:	53                   	push   %ebx
+  800323:	83 ec 0c             	sub    $0xc,%esp
+  800326:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80032b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80032e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800331:	b8 09 00 00 00       	mov    $0x9,%eax
+  800336:	89 df                	mov    %ebx,%edi
+  800338:	89 de                	mov    %ebx,%esi
+  80033a:	cd 30                	int    $0x30
+  80033c:	85 c0                	test   %eax,%eax
+  80033e:	7f 08                	jg     800348 <sys_env_set_trapframe+0x2b>
+  800340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800343:	5b                   	pop    %ebx
+  800344:	5e                   	pop    %esi
+  800345:	5f                   	pop    %edi
+  800346:	5d                   	pop    %ebp
+  800347:	c3                   	ret
+  800348:	83 ec 0c             	sub    $0xc,%esp
+  80034b:	50                   	push   %eax
+  80034c:	6a 09                	push   $0x9
+  80034e:	68 8a 31 80 00       	push   $0x80318a
+  800353:	6a 24                	push   $0x24
+  800355:	68 a7 31 80 00       	push   $0x8031a7
+  80035a:	e8 16 1e 00 00       	call   802175 <_panic>
+
+0080035f <sys_env_set_cow>:
+  80035f:	55                   	push   %ebp
+  800360:	89 e5                	mov    %esp,%ebp
+  800362:	57                   	push   %edi
+  800363:	56                   	push   %esi
+  800364:	53                   	push   %ebx
+  800365:	83 ec 0c             	sub    $0xc,%esp
+  800368:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80036d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800370:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800373:	b8 20 00 00 00       	mov    $0x20,%eax
+  800378:	89 df                	mov    %ebx,%edi
+  80037a:	89 de                	mov    %ebx,%esi
+  80037c:	cd 30                	int    $0x30
+  80037e:	85 c0                	test   %eax,%eax
+  800380:	7f 08                	jg     80038a <sys_env_set_cow+0x2b>
+  800382:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800385:	5b                   	pop    %ebx
+  800386:	5e                   	pop    %esi
+  800387:	5f                   	pop    %edi
+  800388:	5d                   	pop    %ebp
+  800389:	c3                   	ret
+  80038a:	83 ec 0c             	sub    $0xc,%esp
+  80038d:	50                   	push   %eax
+  80038e:	6a 20                	push   $0x20
+  800390:	68 8a 31 80 00       	push   $0x80318a
+  800395:	6a 24                	push   $0x24
+  800397:	68 a7 31 80 00       	push   $0x8031a7
+  80039c:	e8 d4 1d 00 00       	call   802175 <_panic>
+
+008003a1 <sys_env_service>:
+  8003a1:	55                   	push   %ebp
+  8003a2:	89 e5                	mov    %esp,%ebp
+  8003a4:	57                   	push   %edi
+  8003a5:	56                   	push   %esi
+  8003a6:	53                   	push   %ebx
+  8003a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003af:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003b4:	89 cb                	mov    %ecx,%ebx
+  8003b6:	89 cf                	mov    %ecx,%edi
+  8003b8:	89 ce                	mov    %ecx,%esi
+  8003ba:	cd 30                	int    $0x30
+  8003bc:	5b                   	pop    %ebx
+  8003bd:	5e                   	pop    %esi
+  8003be:	5f                   	pop    %edi
+  8003bf:	5d                   	pop    %ebp
+  8003c0:	c3                   	ret
+
+008003c1 <sys_env_set_pgfault_upcall>:
+  8003c1:	55                   	push   %ebp
+  8003c2:	89 e5                	mov    %esp,%ebp
+  8003c4:	57                   	push   %edi
+  8003c5:	56                   	push   %esi
+  8003c6:	53                   	push   %ebx
+  8003c7:	83 ec 0c             	sub    $0xc,%esp
+  8003ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003da:	89 df                	mov    %ebx,%edi
+  8003dc:	89 de                	mov    %ebx,%esi
+  8003de:	cd 30                	int    $0x30
+  8003e0:	85 c0                	test   %eax,%eax
+  8003e2:	7f 08                	jg     8003ec <sys_env_set_pgfault_upcall+0x2b>
+  8003e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e7:	5b                   	pop    %ebx
+  8003e8:	5e                   	pop    %esi
+  8003e9:	5f                   	pop    %edi
+  8003ea:	5d                   	pop    %ebp
+  8003eb:	c3                   	ret
+  8003ec:	83 ec 0c             	sub    $0xc,%esp
+  8003ef:	50                   	push   %eax
+  8003f0:	6a 0a                	push   $0xa
+  8003f2:	68 8a 31 80 00       	push   $0x80318a
+  8003f7:	6a 24                	push   $0x24
+  8003f9:	68 a7 31 80 00       	push   $0x8031a7
+  8003fe:	e8 72 1d 00 00       	call   802175 <_panic>
+
+00800403 <sys_ipc_try_send>:
+  800403:	55                   	push   %ebp
+  800404:	89 e5                	mov    %esp,%ebp
+  800406:	57                   	push   %edi
+  800407:	56                   	push   %esi
+  800408:	53                   	push   %ebx
+  800409:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800410:	74 27                	je     800439 <sys_ipc_try_send+0x36>
+  800412:	8b 55 08             	mov    0x8(%ebp),%edx
+  800415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800418:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80041d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800420:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800423:	6a 00                	push   $0x0
+  800425:	55                   	push   %ebp
+  800426:	89 e5                	mov    %esp,%ebp
+  800428:	8d 35 30 04 80 00    	lea    0x800430,%esi
+  80042e:	0f 34                	sysenter
+  800430:	5d                   	pop    %ebp
+  800431:	83 c4 04             	add    $0x4,%esp
+  800434:	5b                   	pop    %ebx
+  800435:	5e                   	pop    %esi
+  800436:	5f                   	pop    %edi
+  800437:	5d                   	pop    %ebp
+  800438:	c3                   	ret
+  800439:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80043e:	be 00 00 00 00       	mov    $0x0,%esi
+  800443:	8b 55 08             	mov    0x8(%ebp),%edx
+  800446:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800449:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80044c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80044f:	cd 30                	int    $0x30
+  800451:	eb e1                	jmp    800434 <sys_ipc_try_send+0x31>
+
+00800453 <sys_ipc_recv>:
+  800453:	55                   	push   %ebp
+  800454:	89 e5                	mov    %esp,%ebp
+  800456:	57                   	push   %edi
+  800457:	56                   	push   %esi
+  800458:	53                   	push   %ebx
+  800459:	83 ec 0c             	sub    $0xc,%esp
+  80045c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800463:	74 32                	je     800497 <sys_ipc_recv+0x44>
+  800465:	8b 55 08             	mov    0x8(%ebp),%edx
+  800468:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80046d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800472:	89 cb                	mov    %ecx,%ebx
+  800474:	89 cf                	mov    %ecx,%edi
+  800476:	6a 00                	push   $0x0
+  800478:	55                   	push   %ebp
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	8d 35 83 04 80 00    	lea    0x800483,%esi
+  800481:	0f 34                	sysenter
+  800483:	5d                   	pop    %ebp
+  800484:	83 c4 04             	add    $0x4,%esp
+  800487:	89 c2                	mov    %eax,%edx
+  800489:	85 c0                	test   %eax,%eax
+  80048b:	7f 3c                	jg     8004c9 <sys_ipc_recv+0x76>
+  80048d:	89 d0                	mov    %edx,%eax
+  80048f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800492:	5b                   	pop    %ebx
+  800493:	5e                   	pop    %esi
+  800494:	5f                   	pop    %edi
+  800495:	5d                   	pop    %ebp
+  800496:	c3                   	ret
+  800497:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80049c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a4:	89 cb                	mov    %ecx,%ebx
+  8004a6:	89 cf                	mov    %ecx,%edi
+  8004a8:	89 ce                	mov    %ecx,%esi
+  8004aa:	cd 30                	int    $0x30
+  8004ac:	89 c2                	mov    %eax,%edx
+  8004ae:	85 c0                	test   %eax,%eax
+  8004b0:	7e db                	jle    80048d <sys_ipc_recv+0x3a>
+  8004b2:	83 ec 0c             	sub    $0xc,%esp
+  8004b5:	50                   	push   %eax
+  8004b6:	6a 0d                	push   $0xd
+  8004b8:	68 8a 31 80 00       	push   $0x80318a
+  8004bd:	6a 24                	push   $0x24
+  8004bf:	68 a7 31 80 00       	push   $0x8031a7
+  8004c4:	e8 ac 1c 00 00       	call   802175 <_panic>
+  8004c9:	83 ec 0c             	sub    $0xc,%esp
+  8004cc:	50                   	push   %eax
+  8004cd:	6a 0d                	push   $0xd
+  8004cf:	68 8a 31 80 00       	push   $0x80318a
+  8004d4:	6a 48                	push   $0x48
+  8004d6:	68 a7 31 80 00       	push   $0x8031a7
+  8004db:	e8 95 1c 00 00       	call   802175 <_panic>
+
+008004e0 <sys_ipc_send>:
+  8004e0:	55                   	push   %ebp
+  8004e1:	89 e5                	mov    %esp,%ebp
+  8004e3:	57                   	push   %edi
+  8004e4:	56                   	push   %esi
+  8004e5:	53                   	push   %ebx
+  8004e6:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004ed:	74 27                	je     800516 <sys_ipc_send+0x36>
+  8004ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004fd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800500:	6a 00                	push   $0x0
+  800502:	55                   	push   %ebp
+  800503:	89 e5                	mov    %esp,%ebp
+  800505:	8d 35 0d 05 80 00    	lea    0x80050d,%esi
+  80050b:	0f 34                	sysenter
+  80050d:	5d                   	pop    %ebp
+  80050e:	83 c4 04             	add    $0x4,%esp
+  800511:	5b                   	pop    %ebx
+  800512:	5e                   	pop    %esi
+  800513:	5f                   	pop    %edi
+  800514:	5d                   	pop    %ebp
+  800515:	c3                   	ret
+  800516:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80051b:	be 00 00 00 00       	mov    $0x0,%esi
+  800520:	8b 55 08             	mov    0x8(%ebp),%edx
+  800523:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800526:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800529:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80052c:	cd 30                	int    $0x30
+  80052e:	eb e1                	jmp    800511 <sys_ipc_send+0x31>
+
+00800530 <sys_ipc_call>:
+  800530:	55                   	push   %ebp
+  800531:	89 e5                	mov    %esp,%ebp
+  800533:	57                   	push   %edi
+  800534:	56                   	push   %esi
+  800535:	53                   	push   %ebx
+  800536:	8b 55 08             	mov    0x8(%ebp),%edx
+  800539:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800541:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800544:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800547:	8b 75 18             	mov    0x18(%ebp),%esi
+  80054a:	cd 30                	int    $0x30
+  80054c:	5b                   	pop    %ebx
+  80054d:	5e                   	pop    %esi
+  80054e:	5f                   	pop    %edi
+  80054f:	5d                   	pop    %ebp
+  800550:	c3                   	ret
+
+00800551 <sys_ipc_reply_recv>:
+  800551:	55                   	push   %ebp
+  800552:	89 e5                	mov    %esp,%ebp
+  800554:	57                   	push   %edi
+  800555:	56                   	push   %esi
+  800556:	53                   	push   %ebx
+  800557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80055d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800562:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800565:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800568:	8b 75 18             	mov    0x18(%ebp),%esi
+  80056b:	cd 30                	int    $0x30
+  80056d:	5b                   	pop    %ebx
+  80056e:	5e                   	pop    %esi
+  80056f:	5f                   	pop    %edi
+  800570:	5d                   	pop    %ebp
+  800571:	c3                   	ret
+
+00800572 <sys_time_msec>:
+  800572:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  800577:	85 c0                	test   %eax,%eax
+  800579:	75 06                	jne    800581 <sys_time_msec+0xf>
+  80057b:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  800580:	c3                   	ret
+  800581:	55                   	push   %ebp
+  800582:	89 e5                	mov    %esp,%ebp
+  800584:	57                   	push   %edi
+  800585:	56                   	push   %esi
+  800586:	53                   	push   %ebx
+  800587:	83 ec 0c             	sub    $0xc,%esp
+  80058a:	0f 31                	rdtsc
+  80058c:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800592:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  800598:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80059e:	29 c8                	sub    %ecx,%eax
+  8005a0:	19 da                	sbb    %ebx,%edx
+  8005a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005a7:	57                   	push   %edi
+  8005a8:	56                   	push   %esi
+  8005a9:	52                   	push   %edx
+  8005aa:	50                   	push   %eax
+  8005ab:	e8 95 2a 00 00       	call   803045 <__udivdi3>
+  8005b0:	83 c4 10             	add    $0x10,%esp
+  8005b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b6:	5b                   	pop    %ebx
+  8005b7:	5e                   	pop    %esi
+  8005b8:	5f                   	pop    %edi
+  8005b9:	5d                   	pop    %ebp
+  8005ba:	c3                   	ret
+
+008005bb <sys_env_swap>:
+  8005bb:	55                   	push   %ebp
+  8005bc:	89 e5                	mov    %esp,%ebp
+  8005be:	57                   	push   %edi
+  8005bf:	56                   	push   %esi
+  8005c0:	53                   	push   %ebx
+  8005c1:	83 ec 0c             	sub    $0xc,%esp
+  8005c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005cc:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005d1:	89 cb                	mov    %ecx,%ebx
+  8005d3:	89 cf                	mov    %ecx,%edi
+  8005d5:	89 ce                	mov    %ecx,%esi
+  8005d7:	cd 30                	int    $0x30
+  8005d9:	85 c0                	test   %eax,%eax
+  8005db:	7f 08                	jg     8005e5 <sys_env_swap+0x2a>
+  8005dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e0:	5b                   	pop    %ebx
+  8005e1:	5e                   	pop    %esi
+  8005e2:	5f                   	pop    %edi
+  8005e3:	5d                   	pop    %ebp
+  8005e4:	c3                   	ret
+  8005e5:	83 ec 0c             	sub    $0xc,%esp
+  8005e8:	50                   	push   %eax
+  8005e9:	6a 12                	push   $0x12
+  8005eb:	68 8a 31 80 00       	push   $0x80318a
+  8005f0:	6a 24                	push   $0x24
+  8005f2:	68 a7 31 80 00       	push   $0x8031a7
+  8005f7:	e8 79 1b 00 00       	call   802175 <_panic>
+
+008005fc <sys_net_try_send>:
+  8005fc:	55                   	push   %ebp
+  8005fd:	89 e5                	mov    %esp,%ebp
+  8005ff:	57                   	push   %edi
+  800600:	56                   	push   %esi
+  800601:	53                   	push   %ebx
+  800602:	83 ec 0c             	sub    $0xc,%esp
+  800605:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80060d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800610:	b8 13 00 00 00       	mov    $0x13,%eax
+  800615:	89 df                	mov    %ebx,%edi
+  800617:	89 de                	mov    %ebx,%esi
+  800619:	cd 30                	int    $0x30
+  80061b:	85 c0                	test   %eax,%eax
+  80061d:	7f 08                	jg     800627 <sys_net_try_send+0x2b>
+  80061f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800622:	5b                   	pop    %ebx
+  800623:	5e                   	pop    %esi
+  800624:	5f                   	pop    %edi
+  800625:	5d                   	pop    %ebp
+  800626:	c3                   	ret
+  800627:	83 ec 0c             	sub    $0xc,%esp
+  80062a:	50                   	push   %eax
+  80062b:	6a 13                	push   $0x13
+  80062d:	68 8a 31 80 00       	push   $0x80318a
+  800632:	6a 24                	push   $0x24
+  800634:	68 a7 31 80 00       	push   $0x8031a7
+  800639:	e8 37 1b 00 00       	call   802175 <_panic>
+
+0080063e <sys_net_try_receive>:
+  80063e:	55                   	push   %ebp
+  80063f:	89 e5                	mov    %esp,%ebp
+  800641:	57                   	push   %edi
+  800642:	56                   	push   %esi
+  800643:	53                   	push   %ebx
+  800644:	83 ec 0c             	sub    $0xc,%esp
+  800647:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80064c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80064f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800652:	b8 14 00 00 00       	mov    $0x14,%eax
+  800657:	89 df                	mov    %ebx,%edi
+  800659:	89 de                	mov    %ebx,%esi
+  80065b:	cd 30                	int    $0x30
+  80065d:	85 c0                	test   %eax,%eax
+  80065f:	7f 08                	jg     800669 <sys_net_try_receive+0x2b>
+  800661:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800664:	5b                   	pop    %ebx
+  800665:	5e                   	pop    %esi
+  800666:	5f                   	pop    %edi
+  800667:	5d                   	pop    %ebp
+  800668:	c3                   	ret
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	50                   	push   %eax
+  80066d:	6a 14                	push   $0x14
+  80066f:	68 8a 31 80 00       	push   $0x80318a
+  800674:	6a 24                	push   $0x24
+  800676:	68 a7 31 80 00       	push   $0x8031a7
+  80067b:	e8 f5 1a 00 00       	call   802175 <_panic>
+
+00800680 <sys_net_recv_page>:
+  800680:	55                   	push   %ebp
+  800681:	89 e5                	mov    %esp,%ebp
+  800683:	57                   	push   %edi
+  800684:	56                   	push   %esi
+  800685:	53                   	push   %ebx
+  800686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80068e:	b8 27 00 00 00       	mov    $0x27,%eax
+  800693:	89 cb                	mov    %ecx,%ebx
+  800695:	89 cf                	mov    %ecx,%edi
+  800697:	89 ce                	mov    %ecx,%esi
+  800699:	cd 30                	int    $0x30
+  80069b:	5b                   	pop    %ebx
+  80069c:	5e                   	pop    %esi
+  80069d:	5f                   	pop    %edi
+  80069e:	5d                   	pop    %ebp
+  80069f:	c3                   	ret
+
+008006a0 <sys_net_wait>:
+  8006a0:	55                   	push   %ebp
+  8006a1:	89 e5                	mov    %esp,%ebp
+  8006a3:	57                   	push   %edi
+  8006a4:	56                   	push   %esi
+  8006a5:	53                   	push   %ebx
+  8006a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ab:	b8 26 00 00 00       	mov    $0x26,%eax
+  8006b0:	89 d1                	mov    %edx,%ecx
+  8006b2:	89 d3                	mov    %edx,%ebx
+  8006b4:	89 d7                	mov    %edx,%edi
+  8006b6:	89 d6                	mov    %edx,%esi
+  8006b8:	cd 30                	int    $0x30
+  8006ba:	5b                   	pop    %ebx
+  8006bb:	5e                   	pop    %esi
+  8006bc:	5f                   	pop    %edi
+  8006bd:	5d                   	pop    %ebp
+  8006be:	c3                   	ret
+
+008006bf <sys_get_mac>:
+  8006bf:	55                   	push   %ebp
+  8006c0:	89 e5                	mov    %esp,%ebp
+  8006c2:	57                   	push   %edi
+  8006c3:	56                   	push   %esi
+  8006c4:	53                   	push   %ebx
+  8006c5:	83 ec 0c             	sub    $0xc,%esp
+  8006c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006d3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006d8:	89 df                	mov    %ebx,%edi
+  8006da:	89 de                	mov    %ebx,%esi
+  8006dc:	cd 30                	int    $0x30
+  8006de:	85 c0                	test   %eax,%eax
+  8006e0:	7f 08                	jg     8006ea <sys_get_mac+0x2b>
+  8006e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006e5:	5b                   	pop    %ebx
+  8006e6:	5e                   	pop    %esi
+  8006e7:	5f                   	pop    %edi
+  8006e8:	5d                   	pop    %ebp
+  8006e9:	c3                   	ret
+  8006ea:	83 ec 0c             	sub    $0xc,%esp
+  8006ed:	50                   	push   %eax
+  8006ee:	6a 15                	push   $0x15
+  8006f0:	68 8a 31 80 00       	push   $0x80318a
+  8006f5:	6a 24                	push   $0x24
+  8006f7:	68 a7 31 80 00       	push   $0x8031a7
+  8006fc:	e8 74 1a 00 00       	call   802175 <_panic>
+
+00800701 <sys_env_lease>:
+  800701:	55                   	push   %ebp
+  800702:	89 e5                	mov    %esp,%ebp
+  800704:	57                   	push   %edi
+  800705:	56                   	push   %esi
+  800706:	53                   	push   %ebx
+  800707:	83 ec 0c             	sub    $0xc,%esp
+  80070a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80070f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800712:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800715:	b8 16 00 00 00       	mov    $0x16,%eax
+  80071a:	89 df                	mov    %ebx,%edi
+  80071c:	89 de                	mov    %ebx,%esi
+  80071e:	cd 30                	int    $0x30
+  800720:	85 c0                	test   %eax,%eax
+  800722:	7f 08                	jg     80072c <sys_env_lease+0x2b>
+  800724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800727:	5b                   	pop    %ebx
+  800728:	5e                   	pop    %esi
+  800729:	5f                   	pop    %edi
+  80072a:	5d                   	pop    %ebp
+  80072b:	c3                   	ret
+  80072c:	83 ec 0c             	sub    $0xc,%esp
+  80072f:	50                   	push   %eax
+  800730:	6a 16                	push   $0x16
+  800732:	68 8a 31 80 00       	push   $0x80318a
+  800737:	6a 24                	push   $0x24
+  800739:	68 a7 31 80 00       	push   $0x8031a7
+  80073e:	e8 32 1a 00 00       	call   802175 <_panic>
+
+00800743 <sys_copy_mem>:
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	57                   	push   %edi
+  800747:	56                   	push   %esi
+  800748:	53                   	push   %ebx
+  800749:	83 ec 0c             	sub    $0xc,%esp
+  80074c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800752:	b8 17 00 00 00       	mov    $0x17,%eax
+  800757:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80075a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80075d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800760:	cd 30                	int    $0x30
+  800762:	85 c0                	test   %eax,%eax
+  800764:	7f 08                	jg     80076e <sys_copy_mem+0x2b>
+  800766:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800769:	5b                   	pop    %ebx
+  80076a:	5e                   	pop    %esi
+  80076b:	5f                   	pop    %edi
+  80076c:	5d                   	pop    %ebp
+  80076d:	c3                   	ret
+  80076e:	83 ec 0c             	sub    $0xc,%esp
+  800771:	50                   	push   %eax
+  800772:	6a 17                	push   $0x17
+  800774:	68 8a 31 80 00       	push   $0x80318a
+  800779:	6a 24                	push   $0x24
+  80077b:	68 a7 31 80 00       	push   $0x8031a7
+  800780:	e8 f0 19 00 00       	call   802175 <_panic>
+
+00800785 <sys_get_perms>:
+  800785:	55                   	push   %ebp
+  800786:	89 e5                	mov    %esp,%ebp
+  800788:	57                   	push   %edi
+  800789:	56                   	push   %esi
+  80078a:	53                   	push   %ebx
+  80078b:	83 ec 0c             	sub    $0xc,%esp
+  80078e:	be 00 00 00 00       	mov    $0x0,%esi
+  800793:	8b 55 08             	mov    0x8(%ebp),%edx
+  800796:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800799:	b8 18 00 00 00       	mov    $0x18,%eax
+  80079e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007a1:	89 f7                	mov    %esi,%edi
+  8007a3:	cd 30                	int    $0x30
+  8007a5:	85 c0                	test   %eax,%eax
+  8007a7:	7f 08                	jg     8007b1 <sys_get_perms+0x2c>
+  8007a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ac:	5b                   	pop    %ebx
+  8007ad:	5e                   	pop    %esi
+  8007ae:	5f                   	pop    %edi
+  8007af:	5d                   	pop    %ebp
+  8007b0:	c3                   	ret
+  8007b1:	83 ec 0c             	sub    $0xc,%esp
+  8007b4:	50                   	push   %eax
+  8007b5:	6a 18                	push   $0x18
+  8007b7:	68 8a 31 80 00       	push   $0x80318a
+  8007bc:	6a 24                	push   $0x24
+  8007be:	68 a7 31 80 00       	push   $0x8031a7
+  8007c3:	e8 ad 19 00 00       	call   802175 <_panic>
+
+008007c8 <sys_env_unsuspend>:
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	57                   	push   %edi
+  8007cc:	56                   	push   %esi
+  8007cd:	53                   	push   %ebx
+  8007ce:	83 ec 0c             	sub    $0xc,%esp
+  8007d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007dc:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007e4:	89 f7                	mov    %esi,%edi
+  8007e6:	cd 30                	int    $0x30
+  8007e8:	85 c0                	test   %eax,%eax
+  8007ea:	7f 08                	jg     8007f4 <sys_env_unsuspend+0x2c>
+  8007ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ef:	5b                   	pop    %ebx
+  8007f0:	5e                   	pop    %esi
+  8007f1:	5f                   	pop    %edi
+  8007f2:	5d                   	pop    %ebp
+  8007f3:	c3                   	ret
+  8007f4:	83 ec 0c             	sub    $0xc,%esp
+  8007f7:	50                   	push   %eax
+  8007f8:	6a 19                	push   $0x19
+  8007fa:	68 8a 31 80 00       	push   $0x80318a
+  8007ff:	6a 24                	push   $0x24
+  800801:	68 a7 31 80 00       	push   $0x8031a7
+  800806:	e8 6a 19 00 00       	call   802175 <_panic>
+
+0080080b <sys_migrate>:
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	57                   	push   %edi
+  80080f:	56                   	push   %esi
+  800810:	53                   	push   %ebx
+  800811:	83 ec 0c             	sub    $0xc,%esp
+  800814:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800819:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80081f:	76 11                	jbe    800832 <sys_migrate+0x27>
+  800821:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800826:	0f b6 08             	movzbl (%eax),%ecx
+  800829:	05 00 10 00 00       	add    $0x1000,%eax
+  80082e:	39 d0                	cmp    %edx,%eax
+  800830:	72 f4                	jb     800826 <sys_migrate+0x1b>
+  800832:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800837:	8b 55 08             	mov    0x8(%ebp),%edx
+  80083a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80083f:	89 cb                	mov    %ecx,%ebx
+  800841:	89 cf                	mov    %ecx,%edi
+  800843:	89 ce                	mov    %ecx,%esi
+  800845:	cd 30                	int    $0x30
+  800847:	85 c0                	test   %eax,%eax
+  800849:	7f 08                	jg     800853 <sys_migrate+0x48>
+  80084b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80084e:	5b                   	pop    %ebx
+  80084f:	5e                   	pop    %esi
+  800850:	5f                   	pop    %edi
+  800851:	5d                   	pop    %ebp
+  800852:	c3                   	ret
+  800853:	83 ec 0c             	sub    $0xc,%esp
+  800856:	50                   	push   %eax
+  800857:	6a 1a                	push   $0x1a
+  800859:	68 8a 31 80 00       	push   $0x80318a
+  80085e:	6a 24                	push   $0x24
+  800860:	68 a7 31 80 00       	push   $0x8031a7
+  800865:	e8 0b 19 00 00       	call   802175 <_panic>
+
+0080086a <sys_lease_complete>:
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	57                   	push   %edi
+  80086e:	56                   	push   %esi
+  80086f:	53                   	push   %ebx
+  800870:	83 ec 0c             	sub    $0xc,%esp
+  800873:	ba 00 00 00 00       	mov    $0x0,%edx
+  800878:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80087d:	89 d1                	mov    %edx,%ecx
+  80087f:	89 d3                	mov    %edx,%ebx
+  800881:	89 d7                	mov    %edx,%edi
+  800883:	89 d6                	mov    %edx,%esi
+  800885:	cd 30                	int    $0x30
+  800887:	85 c0                	test   %eax,%eax
+  800889:	7f 08                	jg     800893 <sys_lease_complete+0x29>
+  80088b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80088e:	5b                   	pop    %ebx
+  80088f:	5e                   	pop    %esi
+  800890:	5f                   	pop    %edi
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+  800893:	83 ec 0c             	sub    $0xc,%esp
+  800896:	50                   	push   %eax
+  800897:	6a 1b                	push   $0x1b
+  800899:	68 8a 31 80 00       	push   $0x80318a
+  80089e:	6a 24                	push   $0x24
+  8008a0:	68 a7 31 80 00       	push   $0x8031a7
+  8008a5:	e8 cb 18 00 00       	call   802175 <_panic>
+
+008008aa <sys_env_set_thisenv>:
+  8008aa:	55                   	push   %ebp
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	57                   	push   %edi
+  8008ae:	56                   	push   %esi
+  8008af:	53                   	push   %ebx
+  8008b0:	83 ec 0c             	sub    $0xc,%esp
+  8008b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008be:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008c3:	89 df                	mov    %ebx,%edi
+  8008c5:	89 de                	mov    %ebx,%esi
+  8008c7:	cd 30                	int    $0x30
+  8008c9:	85 c0                	test   %eax,%eax
+  8008cb:	7f 08                	jg     8008d5 <sys_env_set_thisenv+0x2b>
+  8008cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d0:	5b                   	pop    %ebx
+  8008d1:	5e                   	pop    %esi
+  8008d2:	5f                   	pop    %edi
+  8008d3:	5d                   	pop    %ebp
+  8008d4:	c3                   	ret
+  8008d5:	83 ec 0c             	sub    $0xc,%esp
+  8008d8:	50                   	push   %eax
+  8008d9:	6a 1c                	push   $0x1c
+  8008db:	68 8a 31 80 00       	push   $0x80318a
+  8008e0:	6a 24                	push   $0x24
+  8008e2:	68 a7 31 80 00       	push   $0x8031a7
+  8008e7:	e8 89 18 00 00       	call   802175 <_panic>
+
+008008ec <sys_env_set_sched>:
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	57                   	push   %edi
+  8008f0:	56                   	push   %esi
+  8008f1:	53                   	push   %ebx
+  8008f2:	83 ec 0c             	sub    $0xc,%esp
+  8008f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8008fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800900:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800905:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800908:	89 f7                	mov    %esi,%edi
+  80090a:	cd 30                	int    $0x30
+  80090c:	85 c0                	test   %eax,%eax
+  80090e:	7f 08                	jg     800918 <sys_env_set_sched+0x2c>
+  800910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800913:	5b                   	pop    %ebx
+  800914:	5e                   	pop    %esi
+  800915:	5f                   	pop    %edi
+  800916:	5d                   	pop    %ebp
+  800917:	c3                   	ret
+  800918:	83 ec 0c             	sub    $0xc,%esp
+  80091b:	50                   	push   %eax
+  80091c:	6a 1d                	push   $0x1d
+  80091e:	68 8a 31 80 00       	push   $0x80318a
+  800923:	6a 24                	push   $0x24
+  800925:	68 a7 31 80 00       	push   $0x8031a7
+  80092a:	e8 46 18 00 00       	call   802175 <_panic>
+
+0080092f <sys_batch>:
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	57                   	push   %edi
+  800933:	56                   	push   %esi
+  800934:	53                   	push   %ebx
+  800935:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80093a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80093d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800940:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800945:	89 df                	mov    %ebx,%edi
+  800947:	89 de                	mov    %ebx,%esi
+  800949:	cd 30                	int    $0x30
+  80094b:	5b                   	pop    %ebx
+  80094c:	5e                   	pop    %esi
+  80094d:	5f                   	pop    %edi
+  80094e:	5d                   	pop    %ebp
+  80094f:	c3                   	ret
+
+00800950 <sys_env_stats>:
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	57                   	push   %edi
+  800954:	56                   	push   %esi
+  800955:	53                   	push   %ebx
+  800956:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80095b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80095e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800961:	b8 23 00 00 00       	mov    $0x23,%eax
+  800966:	89 df                	mov    %ebx,%edi
+  800968:	89 de                	mov    %ebx,%esi
+  80096a:	cd 30                	int    $0x30
+  80096c:	5b                   	pop    %ebx
+  80096d:	5e                   	pop    %esi
+  80096e:	5f                   	pop    %edi
+  80096f:	5d                   	pop    %ebp
+  800970:	c3                   	ret
+
+00800971 <sys_trace>:
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	57                   	push   %edi
+  800975:	56                   	push   %esi
+  800976:	53                   	push   %ebx
+  800977:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80097f:	b8 24 00 00 00       	mov    $0x24,%eax
+  800984:	89 cb                	mov    %ecx,%ebx
+  800986:	89 cf                	mov    %ecx,%edi
+  800988:	89 ce                	mov    %ecx,%esi
+  80098a:	cd 30                	int    $0x30
+  80098c:	5b                   	pop    %ebx
+  80098d:	5e                   	pop    %esi
+  80098e:	5f                   	pop    %edi
+  80098f:	5d                   	pop    %ebp
+  800990:	c3                   	ret
+
+00800991 <sys_env_set_pager>:
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	57                   	push   %edi
+  800995:	56                   	push   %esi
+  800996:	53                   	push   %ebx
+  800997:	83 ec 0c             	sub    $0xc,%esp
+  80099a:	be 00 00 00 00       	mov    $0x0,%esi
+  80099f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a5:	b8 25 00 00 00       	mov    $0x25,%eax
+  8009aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009ad:	89 f7                	mov    %esi,%edi
+  8009af:	cd 30                	int    $0x30
+  8009b1:	85 c0                	test   %eax,%eax
+  8009b3:	7f 08                	jg     8009bd <sys_env_set_pager+0x2c>
+  8009b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009b8:	5b                   	pop    %ebx
+  8009b9:	5e                   	pop    %esi
+  8009ba:	5f                   	pop    %edi
+  8009bb:	5d                   	pop    %ebp
+  8009bc:	c3                   	ret
+  8009bd:	83 ec 0c             	sub    $0xc,%esp
+  8009c0:	50                   	push   %eax
+  8009c1:	6a 25                	push   $0x25
+  8009c3:	68 8a 31 80 00       	push   $0x80318a
+  8009c8:	6a 24                	push   $0x24
+  8009ca:	68 a7 31 80 00       	push   $0x8031a7
+  8009cf:	e8 a1 17 00 00       	call   802175 <_panic>
+
+008009d4 <sys_pager_retire>:
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	57                   	push   %edi
+  8009d8:	56                   	push   %esi
+  8009d9:	53                   	push   %ebx
+  8009da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e2:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009e7:	89 cb                	mov    %ecx,%ebx
+  8009e9:	89 cf                	mov    %ecx,%edi
+  8009eb:	89 ce                	mov    %ecx,%esi
+  8009ed:	cd 30                	int    $0x30
+  8009ef:	5b                   	pop    %ebx
+  8009f0:	5e                   	pop    %esi
+  8009f1:	5f                   	pop    %edi
+  8009f2:	5d                   	pop    %ebp
+  8009f3:	c3                   	ret
+
+008009f4 <sys_prof>:
+  8009f4:	55                   	push   %ebp
+  8009f5:	89 e5                	mov    %esp,%ebp
+  8009f7:	57                   	push   %edi
+  8009f8:	56                   	push   %esi
+  8009f9:	53                   	push   %ebx
+  8009fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a05:	b8 22 00 00 00       	mov    $0x22,%eax
+  800a0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a0d:	89 f7                	mov    %esi,%edi
+  800a0f:	cd 30                	int    $0x30
+  800a11:	5b                   	pop    %ebx
+  800a12:	5e                   	pop    %esi
+  800a13:	5f                   	pop    %edi
+  800a14:	5d                   	pop    %ebp
+  800a15:	c3                   	ret
+
+00800a16 <fd2num>:
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a21:	c1 e8 0c             	shr    $0xc,%eax
+  800a24:	5d                   	pop    %ebp
+  800a25:	c3                   	ret
+
+00800a26 <fd2data>:
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a36:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <fd_alloc>:
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a45:	89 c2                	mov    %eax,%edx
+  800a47:	c1 ea 16             	shr    $0x16,%edx
+  800a4a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a51:	f6 c2 01             	test   $0x1,%dl
+  800a54:	74 29                	je     800a7f <fd_alloc+0x42>
+  800a56:	89 c2                	mov    %eax,%edx
+  800a58:	c1 ea 0c             	shr    $0xc,%edx
+  800a5b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a62:	f6 c2 01             	test   $0x1,%dl
+  800a65:	74 18                	je     800a7f <fd_alloc+0x42>
+  800a67:	05 00 10 00 00       	add    $0x1000,%eax
+  800a6c:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a71:	75 d2                	jne    800a45 <fd_alloc+0x8>
+  800a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a78:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a7d:	eb 05                	jmp    800a84 <fd_alloc+0x47>
+  800a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a87:	89 02                	mov    %eax,(%edx)
+  800a89:	89 c8                	mov    %ecx,%eax
+  800a8b:	5d                   	pop    %ebp
+  800a8c:	c3                   	ret
+
+00800a8d <fd_lookup>:
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a93:	83 f8 1f             	cmp    $0x1f,%eax
+  800a96:	77 30                	ja     800ac8 <fd_lookup+0x3b>
+  800a98:	c1 e0 0c             	shl    $0xc,%eax
+  800a9b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800aa0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800aa6:	f6 c2 01             	test   $0x1,%dl
+  800aa9:	74 24                	je     800acf <fd_lookup+0x42>
+  800aab:	89 c2                	mov    %eax,%edx
+  800aad:	c1 ea 0c             	shr    $0xc,%edx
+  800ab0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800ab7:	f6 c2 01             	test   $0x1,%dl
+  800aba:	74 1a                	je     800ad6 <fd_lookup+0x49>
+  800abc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800abf:	89 02                	mov    %eax,(%edx)
+  800ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac6:	5d                   	pop    %ebp
+  800ac7:	c3                   	ret
+  800ac8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800acd:	eb f7                	jmp    800ac6 <fd_lookup+0x39>
+  800acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad4:	eb f0                	jmp    800ac6 <fd_lookup+0x39>
+  800ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800adb:	eb e9                	jmp    800ac6 <fd_lookup+0x39>
+
+00800add <dev_lookup>:
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	53                   	push   %ebx
+  800ae1:	83 ec 04             	sub    $0x4,%esp
+  800ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aec:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800af1:	39 13                	cmp    %edx,(%ebx)
+  800af3:	74 37                	je     800b2c <dev_lookup+0x4f>
+  800af5:	83 c0 01             	add    $0x1,%eax
+  800af8:	8b 1c 85 34 32 80 00 	mov    0x803234(,%eax,4),%ebx
+  800aff:	85 db                	test   %ebx,%ebx
+  800b01:	75 ee                	jne    800af1 <dev_lookup+0x14>
+  800b03:	a1 10 50 80 00       	mov    0x805010,%eax
+  800b08:	8b 40 48             	mov    0x48(%eax),%eax
+  800b0b:	83 ec 04             	sub    $0x4,%esp
+  800b0e:	52                   	push   %edx
+  800b0f:	50                   	push   %eax
+  800b10:	68 b8 31 80 00       	push   $0x8031b8
+  800b15:	e8 36 17 00 00       	call   802250 <cprintf>
+  800b1a:	83 c4 10             	add    $0x10,%esp
+  800b1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b25:	89 1a                	mov    %ebx,(%edx)
+  800b27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b2a:	c9                   	leave
+  800b2b:	c3                   	ret
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b31:	eb ef                	jmp    800b22 <dev_lookup+0x45>
+
+00800b33 <fd_close>:
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	57                   	push   %edi
+  800b37:	56                   	push   %esi
+  800b38:	53                   	push   %ebx
+  800b39:	83 ec 24             	sub    $0x24,%esp
+  800b3c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b3f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b42:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b45:	50                   	push   %eax
+  800b46:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b4c:	c1 e8 0c             	shr    $0xc,%eax
+  800b4f:	50                   	push   %eax
+  800b50:	e8 38 ff ff ff       	call   800a8d <fd_lookup>
+  800b55:	89 c3                	mov    %eax,%ebx
+  800b57:	83 c4 10             	add    $0x10,%esp
+  800b5a:	85 c0                	test   %eax,%eax
+  800b5c:	78 05                	js     800b63 <fd_close+0x30>
+  800b5e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b61:	74 0f                	je     800b72 <fd_close+0x3f>
+  800b63:	85 ff                	test   %edi,%edi
+  800b65:	0f 44 df             	cmove  %edi,%ebx
+  800b68:	89 d8                	mov    %ebx,%eax
+  800b6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b6d:	5b                   	pop    %ebx
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5f                   	pop    %edi
+  800b70:	5d                   	pop    %ebp
+  800b71:	c3                   	ret
+  800b72:	83 ec 08             	sub    $0x8,%esp
+  800b75:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b78:	50                   	push   %eax
+  800b79:	ff 36                	push   (%esi)
+  800b7b:	e8 5d ff ff ff       	call   800add <dev_lookup>
+  800b80:	89 c3                	mov    %eax,%ebx
+  800b82:	83 c4 10             	add    $0x10,%esp
+  800b85:	85 c0                	test   %eax,%eax
+  800b87:	78 1a                	js     800ba3 <fd_close+0x70>
+  800b89:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b8c:	8b 40 10             	mov    0x10(%eax),%eax
+  800b8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b94:	85 c0                	test   %eax,%eax
+  800b96:	74 0b                	je     800ba3 <fd_close+0x70>
+  800b98:	83 ec 0c             	sub    $0xc,%esp
+  800b9b:	56                   	push   %esi
+  800b9c:	ff d0                	call   *%eax
+  800b9e:	89 c3                	mov    %eax,%ebx
+  800ba0:	83 c4 10             	add    $0x10,%esp
+  800ba3:	83 ec 08             	sub    $0x8,%esp
+  800ba6:	56                   	push   %esi
+  800ba7:	6a 00                	push   $0x0
+  800ba9:	e8 cc f6 ff ff       	call   80027a <sys_page_unmap>
+  800bae:	83 c4 10             	add    $0x10,%esp
+  800bb1:	eb b5                	jmp    800b68 <fd_close+0x35>
+
+00800bb3 <close>:
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	83 ec 20             	sub    $0x20,%esp
+  800bb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bbc:	50                   	push   %eax
+  800bbd:	ff 75 08             	push   0x8(%ebp)
+  800bc0:	e8 c8 fe ff ff       	call   800a8d <fd_lookup>
+  800bc5:	83 c4 10             	add    $0x10,%esp
+  800bc8:	85 c0                	test   %eax,%eax
+  800bca:	79 02                	jns    800bce <close+0x1b>
+  800bcc:	c9                   	leave
+  800bcd:	c3                   	ret
+  800bce:	83 ec 08             	sub    $0x8,%esp
+  800bd1:	6a 01                	push   $0x1
+  800bd3:	ff 75 f4             	push   -0xc(%ebp)
+  800bd6:	e8 58 ff ff ff       	call   800b33 <fd_close>
+  800bdb:	83 c4 10             	add    $0x10,%esp
+  800bde:	eb ec                	jmp    800bcc <close+0x19>
+
+00800be0 <close_all>:
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	53                   	push   %ebx
+  800be4:	83 ec 04             	sub    $0x4,%esp
+  800be7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bec:	83 ec 0c             	sub    $0xc,%esp
+  800bef:	53                   	push   %ebx
+  800bf0:	e8 be ff ff ff       	call   800bb3 <close>
+  800bf5:	83 c3 01             	add    $0x1,%ebx
+  800bf8:	83 c4 10             	add    $0x10,%esp
+  800bfb:	83 fb 20             	cmp    $0x20,%ebx
+  800bfe:	75 ec                	jne    800bec <close_all+0xc>
+  800c00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c03:	c9                   	leave
+  800c04:	c3                   	ret
+
+00800c05 <dup>:
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	57                   	push   %edi
+  800c09:	56                   	push   %esi
+  800c0a:	53                   	push   %ebx
+  800c0b:	83 ec 34             	sub    $0x34,%esp
+  800c0e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c11:	50                   	push   %eax
+  800c12:	ff 75 08             	push   0x8(%ebp)
+  800c15:	e8 73 fe ff ff       	call   800a8d <fd_lookup>
+  800c1a:	89 c3                	mov    %eax,%ebx
+  800c1c:	83 c4 10             	add    $0x10,%esp
+  800c1f:	85 c0                	test   %eax,%eax
+  800c21:	78 7f                	js     800ca2 <dup+0x9d>
+  800c23:	83 ec 0c             	sub    $0xc,%esp
+  800c26:	ff 75 0c             	push   0xc(%ebp)
+  800c29:	e8 85 ff ff ff       	call   800bb3 <close>
+  800c2e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c31:	c1 e6 0c             	shl    $0xc,%esi
+  800c34:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c3a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c3d:	89 3c 24             	mov    %edi,(%esp)
+  800c40:	e8 e1 fd ff ff       	call   800a26 <fd2data>
+  800c45:	89 c3                	mov    %eax,%ebx
+  800c47:	89 34 24             	mov    %esi,(%esp)
+  800c4a:	e8 d7 fd ff ff       	call   800a26 <fd2data>
+  800c4f:	83 c4 10             	add    $0x10,%esp
+  800c52:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c55:	89 d8                	mov    %ebx,%eax
+  800c57:	c1 e8 16             	shr    $0x16,%eax
+  800c5a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c61:	a8 01                	test   $0x1,%al
+  800c63:	74 11                	je     800c76 <dup+0x71>
+  800c65:	89 d8                	mov    %ebx,%eax
+  800c67:	c1 e8 0c             	shr    $0xc,%eax
+  800c6a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c71:	f6 c2 01             	test   $0x1,%dl
+  800c74:	75 36                	jne    800cac <dup+0xa7>
+  800c76:	89 f8                	mov    %edi,%eax
+  800c78:	c1 e8 0c             	shr    $0xc,%eax
+  800c7b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c82:	83 ec 0c             	sub    $0xc,%esp
+  800c85:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c8a:	50                   	push   %eax
+  800c8b:	56                   	push   %esi
+  800c8c:	6a 00                	push   $0x0
+  800c8e:	57                   	push   %edi
+  800c8f:	6a 00                	push   $0x0
+  800c91:	e8 55 f5 ff ff       	call   8001eb <sys_page_map>
+  800c96:	89 c3                	mov    %eax,%ebx
+  800c98:	83 c4 20             	add    $0x20,%esp
+  800c9b:	85 c0                	test   %eax,%eax
+  800c9d:	78 33                	js     800cd2 <dup+0xcd>
+  800c9f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ca2:	89 d8                	mov    %ebx,%eax
+  800ca4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5e                   	pop    %esi
+  800ca9:	5f                   	pop    %edi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+  800cac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  800cb6:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cbb:	50                   	push   %eax
+  800cbc:	ff 75 d4             	push   -0x2c(%ebp)
+  800cbf:	6a 00                	push   $0x0
+  800cc1:	53                   	push   %ebx
+  800cc2:	6a 00                	push   $0x0
+  800cc4:	e8 22 f5 ff ff       	call   8001eb <sys_page_map>
+  800cc9:	89 c3                	mov    %eax,%ebx
+  800ccb:	83 c4 20             	add    $0x20,%esp
+  800cce:	85 c0                	test   %eax,%eax
+  800cd0:	79 a4                	jns    800c76 <dup+0x71>
+  800cd2:	83 ec 08             	sub    $0x8,%esp
+  800cd5:	56                   	push   %esi
+  800cd6:	6a 00                	push   $0x0
+  800cd8:	e8 9d f5 ff ff       	call   80027a <sys_page_unmap>
+  800cdd:	83 c4 08             	add    $0x8,%esp
+  800ce0:	ff 75 d4             	push   -0x2c(%ebp)
+  800ce3:	6a 00                	push   $0x0
+  800ce5:	e8 90 f5 ff ff       	call   80027a <sys_page_unmap>
+  800cea:	83 c4 10             	add    $0x10,%esp
+  800ced:	eb b3                	jmp    800ca2 <dup+0x9d>
+
+00800cef <read>:
+  800cef:	55                   	push   %ebp
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	56                   	push   %esi
+  800cf3:	53                   	push   %ebx
+  800cf4:	83 ec 18             	sub    $0x18,%esp
+  800cf7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cfa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800cfd:	50                   	push   %eax
+  800cfe:	56                   	push   %esi
+  800cff:	e8 89 fd ff ff       	call   800a8d <fd_lookup>
+  800d04:	83 c4 10             	add    $0x10,%esp
+  800d07:	85 c0                	test   %eax,%eax
+  800d09:	78 3c                	js     800d47 <read+0x58>
+  800d0b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d0e:	83 ec 08             	sub    $0x8,%esp
+  800d11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d14:	50                   	push   %eax
+  800d15:	ff 33                	push   (%ebx)
+  800d17:	e8 c1 fd ff ff       	call   800add <dev_lookup>
+  800d1c:	83 c4 10             	add    $0x10,%esp
+  800d1f:	85 c0                	test   %eax,%eax
+  800d21:	78 24                	js     800d47 <read+0x58>
+  800d23:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d26:	83 e0 03             	and    $0x3,%eax
+  800d29:	83 f8 01             	cmp    $0x1,%eax
+  800d2c:	74 20                	je     800d4e <read+0x5f>
+  800d2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d31:	8b 40 08             	mov    0x8(%eax),%eax
+  800d34:	85 c0                	test   %eax,%eax
+  800d36:	74 37                	je     800d6f <read+0x80>
+  800d38:	83 ec 04             	sub    $0x4,%esp
+  800d3b:	ff 75 10             	push   0x10(%ebp)
+  800d3e:	ff 75 0c             	push   0xc(%ebp)
+  800d41:	53                   	push   %ebx
+  800d42:	ff d0                	call   *%eax
+  800d44:	83 c4 10             	add    $0x10,%esp
+  800d47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+  800d4e:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d53:	8b 40 48             	mov    0x48(%eax),%eax
+  800d56:	83 ec 04             	sub    $0x4,%esp
+  800d59:	56                   	push   %esi
+  800d5a:	50                   	push   %eax
+  800d5b:	68 f9 31 80 00       	push   $0x8031f9
+  800d60:	e8 eb 14 00 00       	call   802250 <cprintf>
+  800d65:	83 c4 10             	add    $0x10,%esp
+  800d68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d6d:	eb d8                	jmp    800d47 <read+0x58>
+  800d6f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d74:	eb d1                	jmp    800d47 <read+0x58>
+
+00800d76 <readn>:
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	57                   	push   %edi
+  800d7a:	56                   	push   %esi
+  800d7b:	53                   	push   %ebx
+  800d7c:	83 ec 0c             	sub    $0xc,%esp
+  800d7f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d82:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d85:	85 f6                	test   %esi,%esi
+  800d87:	74 30                	je     800db9 <readn+0x43>
+  800d89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d93:	83 ec 04             	sub    $0x4,%esp
+  800d96:	89 f2                	mov    %esi,%edx
+  800d98:	29 c2                	sub    %eax,%edx
+  800d9a:	52                   	push   %edx
+  800d9b:	01 f8                	add    %edi,%eax
+  800d9d:	50                   	push   %eax
+  800d9e:	ff 75 08             	push   0x8(%ebp)
+  800da1:	e8 49 ff ff ff       	call   800cef <read>
+  800da6:	83 c4 10             	add    $0x10,%esp
+  800da9:	85 c0                	test   %eax,%eax
+  800dab:	78 15                	js     800dc2 <readn+0x4c>
+  800dad:	74 11                	je     800dc0 <readn+0x4a>
+  800daf:	01 c3                	add    %eax,%ebx
+  800db1:	89 d8                	mov    %ebx,%eax
+  800db3:	39 f3                	cmp    %esi,%ebx
+  800db5:	72 dc                	jb     800d93 <readn+0x1d>
+  800db7:	eb 09                	jmp    800dc2 <readn+0x4c>
+  800db9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbe:	eb 02                	jmp    800dc2 <readn+0x4c>
+  800dc0:	89 d8                	mov    %ebx,%eax
+  800dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+
+00800dca <write>:
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	56                   	push   %esi
+  800dce:	53                   	push   %ebx
+  800dcf:	83 ec 18             	sub    $0x18,%esp
+  800dd2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dd5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dd8:	50                   	push   %eax
+  800dd9:	53                   	push   %ebx
+  800dda:	e8 ae fc ff ff       	call   800a8d <fd_lookup>
+  800ddf:	83 c4 10             	add    $0x10,%esp
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	78 37                	js     800e1d <write+0x53>
+  800de6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800de9:	83 ec 08             	sub    $0x8,%esp
+  800dec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800def:	50                   	push   %eax
+  800df0:	ff 36                	push   (%esi)
+  800df2:	e8 e6 fc ff ff       	call   800add <dev_lookup>
+  800df7:	83 c4 10             	add    $0x10,%esp
+  800dfa:	85 c0                	test   %eax,%eax
+  800dfc:	78 1f                	js     800e1d <write+0x53>
+  800dfe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e02:	74 20                	je     800e24 <write+0x5a>
+  800e04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e07:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e0a:	85 c0                	test   %eax,%eax
+  800e0c:	74 37                	je     800e45 <write+0x7b>
+  800e0e:	83 ec 04             	sub    $0x4,%esp
+  800e11:	ff 75 10             	push   0x10(%ebp)
+  800e14:	ff 75 0c             	push   0xc(%ebp)
+  800e17:	56                   	push   %esi
+  800e18:	ff d0                	call   *%eax
+  800e1a:	83 c4 10             	add    $0x10,%esp
+  800e1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5d                   	pop    %ebp
+  800e23:	c3                   	ret
+  800e24:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e29:	8b 40 48             	mov    0x48(%eax),%eax
+  800e2c:	83 ec 04             	sub    $0x4,%esp
+  800e2f:	53                   	push   %ebx
+  800e30:	50                   	push   %eax
+  800e31:	68 15 32 80 00       	push   $0x803215
+  800e36:	e8 15 14 00 00       	call   802250 <cprintf>
+  800e3b:	83 c4 10             	add    $0x10,%esp
+  800e3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e43:	eb d8                	jmp    800e1d <write+0x53>
+  800e45:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e4a:	eb d1                	jmp    800e1d <write+0x53>
+
+00800e4c <seek>:
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	83 ec 20             	sub    $0x20,%esp
+  800e52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e55:	50                   	push   %eax
+  800e56:	ff 75 08             	push   0x8(%ebp)
+  800e59:	e8 2f fc ff ff       	call   800a8d <fd_lookup>
+  800e5e:	83 c4 10             	add    $0x10,%esp
+  800e61:	85 c0                	test   %eax,%eax
+  800e63:	78 0e                	js     800e73 <seek+0x27>
+  800e65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e6b:	89 50 04             	mov    %edx,0x4(%eax)
+  800e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e73:	c9                   	leave
+  800e74:	c3                   	ret
+
+00800e75 <ftruncate>:
+  800e75:	55                   	push   %ebp
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 18             	sub    $0x18,%esp
+  800e7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e80:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e83:	50                   	push   %eax
+  800e84:	53                   	push   %ebx
+  800e85:	e8 03 fc ff ff       	call   800a8d <fd_lookup>
+  800e8a:	83 c4 10             	add    $0x10,%esp
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	78 34                	js     800ec5 <ftruncate+0x50>
+  800e91:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e94:	83 ec 08             	sub    $0x8,%esp
+  800e97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e9a:	50                   	push   %eax
+  800e9b:	ff 36                	push   (%esi)
+  800e9d:	e8 3b fc ff ff       	call   800add <dev_lookup>
+  800ea2:	83 c4 10             	add    $0x10,%esp
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	78 1c                	js     800ec5 <ftruncate+0x50>
+  800ea9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ead:	74 1d                	je     800ecc <ftruncate+0x57>
+  800eaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb2:	8b 40 18             	mov    0x18(%eax),%eax
+  800eb5:	85 c0                	test   %eax,%eax
+  800eb7:	74 34                	je     800eed <ftruncate+0x78>
+  800eb9:	83 ec 08             	sub    $0x8,%esp
+  800ebc:	ff 75 0c             	push   0xc(%ebp)
+  800ebf:	56                   	push   %esi
+  800ec0:	ff d0                	call   *%eax
+  800ec2:	83 c4 10             	add    $0x10,%esp
+  800ec5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ec8:	5b                   	pop    %ebx
+  800ec9:	5e                   	pop    %esi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+  800ecc:	a1 10 50 80 00       	mov    0x805010,%eax
+  800ed1:	8b 40 48             	mov    0x48(%eax),%eax
+  800ed4:	83 ec 04             	sub    $0x4,%esp
+  800ed7:	53                   	push   %ebx
+  800ed8:	50                   	push   %eax
+  800ed9:	68 d8 31 80 00       	push   $0x8031d8
+  800ede:	e8 6d 13 00 00       	call   802250 <cprintf>
+  800ee3:	83 c4 10             	add    $0x10,%esp
+  800ee6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eeb:	eb d8                	jmp    800ec5 <ftruncate+0x50>
+  800eed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ef2:	eb d1                	jmp    800ec5 <ftruncate+0x50>
+
+00800ef4 <fstat>:
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  800ef9:	83 ec 18             	sub    $0x18,%esp
+  800efc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800eff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f02:	50                   	push   %eax
+  800f03:	ff 75 08             	push   0x8(%ebp)
+  800f06:	e8 82 fb ff ff       	call   800a8d <fd_lookup>
+  800f0b:	83 c4 10             	add    $0x10,%esp
+  800f0e:	85 c0                	test   %eax,%eax
+  800f10:	78 49                	js     800f5b <fstat+0x67>
+  800f12:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f15:	83 ec 08             	sub    $0x8,%esp
+  800f18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f1b:	50                   	push   %eax
+  800f1c:	ff 36                	push   (%esi)
+  800f1e:	e8 ba fb ff ff       	call   800add <dev_lookup>
+  800f23:	83 c4 10             	add    $0x10,%esp
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	78 31                	js     800f5b <fstat+0x67>
+  800f2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f2d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f31:	74 2f                	je     800f62 <fstat+0x6e>
+  800f33:	c6 03 00             	movb   $0x0,(%ebx)
+  800f36:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f3d:	00 00 00 
+  800f40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f47:	00 00 00 
+  800f4a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f50:	83 ec 08             	sub    $0x8,%esp
+  800f53:	53                   	push   %ebx
+  800f54:	56                   	push   %esi
+  800f55:	ff 50 14             	call   *0x14(%eax)
+  800f58:	83 c4 10             	add    $0x10,%esp
+  800f5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+  800f62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f67:	eb f2                	jmp    800f5b <fstat+0x67>
+
+00800f69 <stat>:
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	56                   	push   %esi
+  800f6d:	53                   	push   %ebx
+  800f6e:	83 ec 08             	sub    $0x8,%esp
+  800f71:	6a 00                	push   $0x0
+  800f73:	ff 75 08             	push   0x8(%ebp)
+  800f76:	e8 31 05 00 00       	call   8014ac <open>
+  800f7b:	89 c3                	mov    %eax,%ebx
+  800f7d:	83 c4 10             	add    $0x10,%esp
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	78 1b                	js     800f9f <stat+0x36>
+  800f84:	83 ec 08             	sub    $0x8,%esp
+  800f87:	ff 75 0c             	push   0xc(%ebp)
+  800f8a:	50                   	push   %eax
+  800f8b:	e8 64 ff ff ff       	call   800ef4 <fstat>
+  800f90:	89 c6                	mov    %eax,%esi
+  800f92:	89 1c 24             	mov    %ebx,(%esp)
+  800f95:	e8 19 fc ff ff       	call   800bb3 <close>
+  800f9a:	83 c4 10             	add    $0x10,%esp
+  800f9d:	89 f3                	mov    %esi,%ebx
+  800f9f:	89 d8                	mov    %ebx,%eax
+  800fa1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fa4:	5b                   	pop    %ebx
+  800fa5:	5e                   	pop    %esi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+
+00800fa8 <fsipc>:
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+  800fab:	56                   	push   %esi
+  800fac:	53                   	push   %ebx
+  800fad:	89 c3                	mov    %eax,%ebx
+  800faf:	89 d6                	mov    %edx,%esi
+  800fb1:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800fb8:	74 20                	je     800fda <fsipc+0x32>
+  800fba:	83 ec 08             	sub    $0x8,%esp
+  800fbd:	6a 00                	push   $0x0
+  800fbf:	56                   	push   %esi
+  800fc0:	6a 07                	push   $0x7
+  800fc2:	68 00 60 80 00       	push   $0x806000
+  800fc7:	53                   	push   %ebx
+  800fc8:	ff 35 08 50 80 00    	push   0x805008
+  800fce:	e8 a4 1d 00 00       	call   802d77 <ipc_call>
+  800fd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5e                   	pop    %esi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	6a 02                	push   $0x2
+  800fdf:	e8 2e 1f 00 00       	call   802f12 <ipc_find_env>
+  800fe4:	a3 08 50 80 00       	mov    %eax,0x805008
+  800fe9:	83 c4 10             	add    $0x10,%esp
+  800fec:	eb cc                	jmp    800fba <fsipc+0x12>
+
+00800fee <devfile_trunc>:
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	83 ec 08             	sub    $0x8,%esp
+  800ff4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff7:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ffa:	a3 00 60 80 00       	mov    %eax,0x806000
+  800fff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801002:	a3 04 60 80 00       	mov    %eax,0x806004
+  801007:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801011:	e8 92 ff ff ff       	call   800fa8 <fsipc>
+  801016:	c9                   	leave
+  801017:	c3                   	ret
+
+00801018 <devfile_flush>:
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	83 ec 08             	sub    $0x8,%esp
+  80101e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801021:	8b 40 0c             	mov    0xc(%eax),%eax
+  801024:	a3 00 60 80 00       	mov    %eax,0x806000
+  801029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801033:	e8 70 ff ff ff       	call   800fa8 <fsipc>
+  801038:	c9                   	leave
+  801039:	c3                   	ret
+
+0080103a <devfile_stat>:
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	53                   	push   %ebx
+  80103e:	83 ec 04             	sub    $0x4,%esp
+  801041:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801044:	8b 45 08             	mov    0x8(%ebp),%eax
+  801047:	8b 40 0c             	mov    0xc(%eax),%eax
+  80104a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80104f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801054:	b8 07 00 00 00       	mov    $0x7,%eax
+  801059:	e8 4a ff ff ff       	call   800fa8 <fsipc>
+  80105e:	85 c0                	test   %eax,%eax
+  801060:	78 2c                	js     80108e <devfile_stat+0x54>
+  801062:	83 ec 08             	sub    $0x8,%esp
+  801065:	68 00 60 80 00       	push   $0x806000
+  80106a:	53                   	push   %ebx
+  80106b:	e8 d7 18 00 00       	call   802947 <strcpy>
+  801070:	a1 80 60 80 00       	mov    0x806080,%eax
+  801075:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80107b:	a1 84 60 80 00       	mov    0x806084,%eax
+  801080:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801086:	83 c4 10             	add    $0x10,%esp
+  801089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801091:	c9                   	leave
+  801092:	c3                   	ret
+
+00801093 <fsring_rw>:
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+  801099:	83 ec 2c             	sub    $0x2c,%esp
+  80109c:	89 c7                	mov    %eax,%edi
+  80109e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8010a1:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8010a4:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8010a9:	a8 01                	test   $0x1,%al
+  8010ab:	74 0d                	je     8010ba <fsring_rw+0x27>
+  8010ad:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010b2:	a8 01                	test   $0x1,%al
+  8010b4:	0f 85 d5 00 00 00    	jne    80118f <fsring_rw+0xfc>
+  8010ba:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010bf:	8b 40 48             	mov    0x48(%eax),%eax
+  8010c2:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010c8:	0f 84 fc 00 00 00    	je     8011ca <fsring_rw+0x137>
+  8010ce:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010d5:	0f 84 02 01 00 00    	je     8011dd <fsring_rw+0x14a>
+  8010db:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010e0:	83 ec 04             	sub    $0x4,%esp
+  8010e3:	68 07 02 00 00       	push   $0x207
+  8010e8:	53                   	push   %ebx
+  8010e9:	6a 00                	push   $0x0
+  8010eb:	e8 b8 f0 ff ff       	call   8001a8 <sys_page_alloc>
+  8010f0:	83 c4 10             	add    $0x10,%esp
+  8010f3:	85 c0                	test   %eax,%eax
+  8010f5:	0f 88 f9 00 00 00    	js     8011f4 <fsring_rw+0x161>
+  8010fb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801101:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801107:	75 d7                	jne    8010e0 <fsring_rw+0x4d>
+  801109:	6a 0e                	push   $0xe
+  80110b:	6a 0d                	push   $0xd
+  80110d:	ff 35 08 50 80 00    	push   0x805008
+  801113:	68 00 00 f0 cf       	push   $0xcff00000
+  801118:	e8 c4 0c 00 00       	call   801de1 <ipcring_init>
+  80111d:	83 c4 08             	add    $0x8,%esp
+  801120:	6a 00                	push   $0x0
+  801122:	6a 00                	push   $0x0
+  801124:	68 07 02 00 00       	push   $0x207
+  801129:	68 00 00 f0 cf       	push   $0xcff00000
+  80112e:	6a 0b                	push   $0xb
+  801130:	ff 35 08 50 80 00    	push   0x805008
+  801136:	e8 3c 1c 00 00       	call   802d77 <ipc_call>
+  80113b:	89 c6                	mov    %eax,%esi
+  80113d:	83 c4 20             	add    $0x20,%esp
+  801140:	85 c0                	test   %eax,%eax
+  801142:	0f 88 ac 00 00 00    	js     8011f4 <fsring_rw+0x161>
+  801148:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114d:	89 d9                	mov    %ebx,%ecx
+  80114f:	83 c3 01             	add    $0x1,%ebx
+  801152:	89 da                	mov    %ebx,%edx
+  801154:	c1 e2 0c             	shl    $0xc,%edx
+  801157:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80115d:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801163:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801169:	83 ec 08             	sub    $0x8,%esp
+  80116c:	6a 00                	push   $0x0
+  80116e:	6a 00                	push   $0x0
+  801170:	68 07 02 00 00       	push   $0x207
+  801175:	50                   	push   %eax
+  801176:	6a 0c                	push   $0xc
+  801178:	ff 35 08 50 80 00    	push   0x805008
+  80117e:	e8 f4 1b 00 00       	call   802d77 <ipc_call>
+  801183:	83 c4 20             	add    $0x20,%esp
+  801186:	85 c0                	test   %eax,%eax
+  801188:	78 6a                	js     8011f4 <fsring_rw+0x161>
+  80118a:	83 fb 08             	cmp    $0x8,%ebx
+  80118d:	75 be                	jne    80114d <fsring_rw+0xba>
+  80118f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801193:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801198:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80119d:	0f 45 c2             	cmovne %edx,%eax
+  8011a0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011a3:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8011aa:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011b1:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c2:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011c5:	e9 4b 01 00 00       	jmp    801315 <fsring_rw+0x282>
+  8011ca:	e8 a3 f3 ff ff       	call   800572 <sys_time_msec>
+  8011cf:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011d5:	0f 89 f3 fe ff ff    	jns    8010ce <fsring_rw+0x3b>
+  8011db:	eb 54                	jmp    801231 <fsring_rw+0x19e>
+  8011dd:	83 ec 0c             	sub    $0xc,%esp
+  8011e0:	6a 02                	push   $0x2
+  8011e2:	e8 2b 1d 00 00       	call   802f12 <ipc_find_env>
+  8011e7:	a3 08 50 80 00       	mov    %eax,0x805008
+  8011ec:	83 c4 10             	add    $0x10,%esp
+  8011ef:	e9 e7 fe ff ff       	jmp    8010db <fsring_rw+0x48>
+  8011f4:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8011f9:	83 ec 08             	sub    $0x8,%esp
+  8011fc:	53                   	push   %ebx
+  8011fd:	6a 00                	push   $0x0
+  8011ff:	e8 76 f0 ff ff       	call   80027a <sys_page_unmap>
+  801204:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80120a:	83 c4 10             	add    $0x10,%esp
+  80120d:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801213:	75 e4                	jne    8011f9 <fsring_rw+0x166>
+  801215:	e8 58 f3 ff ff       	call   800572 <sys_time_msec>
+  80121a:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80121f:	a3 00 50 80 00       	mov    %eax,0x805000
+  801224:	a1 10 50 80 00       	mov    0x805010,%eax
+  801229:	8b 40 48             	mov    0x48(%eax),%eax
+  80122c:	a3 04 50 80 00       	mov    %eax,0x805004
+  801231:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801238:	e9 7a 01 00 00       	jmp    8013b7 <fsring_rw+0x324>
+  80123d:	8b 57 0c             	mov    0xc(%edi),%edx
+  801240:	89 10                	mov    %edx,(%eax)
+  801242:	89 58 04             	mov    %ebx,0x4(%eax)
+  801245:	89 f2                	mov    %esi,%edx
+  801247:	03 57 04             	add    0x4(%edi),%edx
+  80124a:	89 50 08             	mov    %edx,0x8(%eax)
+  80124d:	83 ec 04             	sub    $0x4,%esp
+  801250:	53                   	push   %ebx
+  801251:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801254:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801257:	52                   	push   %edx
+  801258:	83 c0 0c             	add    $0xc,%eax
+  80125b:	50                   	push   %eax
+  80125c:	e8 96 18 00 00       	call   802af7 <memmove>
+  801261:	83 c4 10             	add    $0x10,%esp
+  801264:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801267:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80126a:	89 08                	mov    %ecx,(%eax)
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+  80126f:	68 00 00 f0 cf       	push   $0xcff00000
+  801274:	e8 c6 0b 00 00       	call   801e3f <ipcring_req_push>
+  801279:	01 de                	add    %ebx,%esi
+  80127b:	83 c4 10             	add    $0x10,%esp
+  80127e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801281:	73 4c                	jae    8012cf <fsring_rw+0x23c>
+  801283:	83 ec 0c             	sub    $0xc,%esp
+  801286:	68 00 00 f0 cf       	push   $0xcff00000
+  80128b:	e8 89 0b 00 00       	call   801e19 <ipcring_req_slot>
+  801290:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801293:	83 c4 10             	add    $0x10,%esp
+  801296:	85 c0                	test   %eax,%eax
+  801298:	74 35                	je     8012cf <fsring_rw+0x23c>
+  80129a:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80129f:	83 e0 07             	and    $0x7,%eax
+  8012a2:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8012a7:	c1 e0 0c             	shl    $0xc,%eax
+  8012aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012ad:	29 f3                	sub    %esi,%ebx
+  8012af:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012b2:	39 cb                	cmp    %ecx,%ebx
+  8012b4:	0f 47 d9             	cmova  %ecx,%ebx
+  8012b7:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012bb:	75 80                	jne    80123d <fsring_rw+0x1aa>
+  8012bd:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012c0:	89 10                	mov    %edx,(%eax)
+  8012c2:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012c5:	89 f2                	mov    %esi,%edx
+  8012c7:	03 57 04             	add    0x4(%edi),%edx
+  8012ca:	89 50 08             	mov    %edx,0x8(%eax)
+  8012cd:	eb 95                	jmp    801264 <fsring_rw+0x1d1>
+  8012cf:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012d7:	83 ec 0c             	sub    $0xc,%esp
+  8012da:	68 00 00 f0 cf       	push   $0xcff00000
+  8012df:	e8 94 0b 00 00       	call   801e78 <ipcring_rsp_wait>
+  8012e4:	8b 58 04             	mov    0x4(%eax),%ebx
+  8012e7:	83 c4 10             	add    $0x10,%esp
+  8012ea:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8012ee:	75 45                	jne    801335 <fsring_rw+0x2a2>
+  8012f0:	85 db                	test   %ebx,%ebx
+  8012f2:	79 41                	jns    801335 <fsring_rw+0x2a2>
+  8012f4:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8012f7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8012fe:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801305:	83 ec 0c             	sub    $0xc,%esp
+  801308:	68 00 00 f0 cf       	push   $0xcff00000
+  80130d:	e8 cc 0b 00 00       	call   801ede <ipcring_rsp_pop>
+  801312:	83 c4 10             	add    $0x10,%esp
+  801315:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80131b:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801320:	39 c2                	cmp    %eax,%edx
+  801322:	74 75                	je     801399 <fsring_rw+0x306>
+  801324:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801328:	75 a5                	jne    8012cf <fsring_rw+0x23c>
+  80132a:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80132d:	0f 82 50 ff ff ff    	jb     801283 <fsring_rw+0x1f0>
+  801333:	eb 9a                	jmp    8012cf <fsring_rw+0x23c>
+  801335:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801339:	75 ca                	jne    801305 <fsring_rw+0x272>
+  80133b:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80133f:	74 31                	je     801372 <fsring_rw+0x2df>
+  801341:	8b 45 08             	mov    0x8(%ebp),%eax
+  801344:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801347:	29 c8                	sub    %ecx,%eax
+  801349:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80134c:	39 d0                	cmp    %edx,%eax
+  80134e:	0f 47 c2             	cmova  %edx,%eax
+  801351:	39 d8                	cmp    %ebx,%eax
+  801353:	ba 01 00 00 00       	mov    $0x1,%edx
+  801358:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80135c:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80135f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801364:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801368:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80136b:	01 d9                	add    %ebx,%ecx
+  80136d:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801370:	eb 93                	jmp    801305 <fsring_rw+0x272>
+  801372:	83 ec 04             	sub    $0x4,%esp
+  801375:	53                   	push   %ebx
+  801376:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801379:	83 e0 07             	and    $0x7,%eax
+  80137c:	c1 e0 0c             	shl    $0xc,%eax
+  80137f:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801385:	50                   	push   %eax
+  801386:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801389:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80138c:	01 c8                	add    %ecx,%eax
+  80138e:	50                   	push   %eax
+  80138f:	e8 63 17 00 00       	call   802af7 <memmove>
+  801394:	83 c4 10             	add    $0x10,%esp
+  801397:	eb a8                	jmp    801341 <fsring_rw+0x2ae>
+  801399:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80139d:	75 09                	jne    8013a8 <fsring_rw+0x315>
+  80139f:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8013a2:	0f 82 db fe ff ff    	jb     801283 <fsring_rw+0x1f0>
+  8013a8:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8013ab:	01 57 04             	add    %edx,0x4(%edi)
+  8013ae:	85 d2                	test   %edx,%edx
+  8013b0:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013b4:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5f                   	pop    %edi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+
+008013c2 <devfile_write>:
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	57                   	push   %edi
+  8013c6:	56                   	push   %esi
+  8013c7:	53                   	push   %ebx
+  8013c8:	83 ec 0c             	sub    $0xc,%esp
+  8013cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d4:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013da:	76 1a                	jbe    8013f6 <devfile_write+0x34>
+  8013dc:	83 ec 0c             	sub    $0xc,%esp
+  8013df:	53                   	push   %ebx
+  8013e0:	89 f1                	mov    %esi,%ecx
+  8013e2:	ba 06 00 00 00       	mov    $0x6,%edx
+  8013e7:	89 f8                	mov    %edi,%eax
+  8013e9:	e8 a5 fc ff ff       	call   801093 <fsring_rw>
+  8013ee:	83 c4 10             	add    $0x10,%esp
+  8013f1:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013f4:	75 39                	jne    80142f <devfile_write+0x6d>
+  8013f6:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8013fb:	39 c3                	cmp    %eax,%ebx
+  8013fd:	0f 47 d8             	cmova  %eax,%ebx
+  801400:	8b 47 0c             	mov    0xc(%edi),%eax
+  801403:	a3 00 60 80 00       	mov    %eax,0x806000
+  801408:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80140e:	83 ec 04             	sub    $0x4,%esp
+  801411:	53                   	push   %ebx
+  801412:	56                   	push   %esi
+  801413:	68 08 60 80 00       	push   $0x806008
+  801418:	e8 da 16 00 00       	call   802af7 <memmove>
+  80141d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801422:	b8 04 00 00 00       	mov    $0x4,%eax
+  801427:	e8 7c fb ff ff       	call   800fa8 <fsipc>
+  80142c:	83 c4 10             	add    $0x10,%esp
+  80142f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801432:	5b                   	pop    %ebx
+  801433:	5e                   	pop    %esi
+  801434:	5f                   	pop    %edi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+
+00801437 <devfile_read>:
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+  80143d:	83 ec 0c             	sub    $0xc,%esp
+  801440:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801443:	8b 75 10             	mov    0x10(%ebp),%esi
+  801446:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80144c:	76 1d                	jbe    80146b <devfile_read+0x34>
+  80144e:	83 ec 0c             	sub    $0xc,%esp
+  801451:	56                   	push   %esi
+  801452:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801455:	ba 05 00 00 00       	mov    $0x5,%edx
+  80145a:	89 f8                	mov    %edi,%eax
+  80145c:	e8 32 fc ff ff       	call   801093 <fsring_rw>
+  801461:	89 c3                	mov    %eax,%ebx
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801469:	75 37                	jne    8014a2 <devfile_read+0x6b>
+  80146b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80146e:	a3 00 60 80 00       	mov    %eax,0x806000
+  801473:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801483:	e8 20 fb ff ff       	call   800fa8 <fsipc>
+  801488:	89 c3                	mov    %eax,%ebx
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	78 14                	js     8014a2 <devfile_read+0x6b>
+  80148e:	83 ec 04             	sub    $0x4,%esp
+  801491:	50                   	push   %eax
+  801492:	68 00 60 80 00       	push   $0x806000
+  801497:	ff 75 0c             	push   0xc(%ebp)
+  80149a:	e8 58 16 00 00       	call   802af7 <memmove>
+  80149f:	83 c4 10             	add    $0x10,%esp
+  8014a2:	89 d8                	mov    %ebx,%eax
+  8014a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a7:	5b                   	pop    %ebx
+  8014a8:	5e                   	pop    %esi
+  8014a9:	5f                   	pop    %edi
+  8014aa:	5d                   	pop    %ebp
+  8014ab:	c3                   	ret
+
+008014ac <open>:
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	56                   	push   %esi
+  8014b0:	53                   	push   %ebx
+  8014b1:	83 ec 1c             	sub    $0x1c,%esp
+  8014b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014b7:	56                   	push   %esi
+  8014b8:	e8 3e 14 00 00       	call   8028fb <strlen>
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  8014c0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014c5:	7f 6c                	jg     801533 <open+0x87>
+  8014c7:	83 ec 0c             	sub    $0xc,%esp
+  8014ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014cd:	50                   	push   %eax
+  8014ce:	e8 6a f5 ff ff       	call   800a3d <fd_alloc>
+  8014d3:	89 c3                	mov    %eax,%ebx
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 3c                	js     801518 <open+0x6c>
+  8014dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014df:	a3 00 64 80 00       	mov    %eax,0x806400
+  8014e4:	83 ec 08             	sub    $0x8,%esp
+  8014e7:	56                   	push   %esi
+  8014e8:	68 00 60 80 00       	push   $0x806000
+  8014ed:	e8 55 14 00 00       	call   802947 <strcpy>
+  8014f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014fa:	e8 a9 fa ff ff       	call   800fa8 <fsipc>
+  8014ff:	89 c3                	mov    %eax,%ebx
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	85 c0                	test   %eax,%eax
+  801506:	78 19                	js     801521 <open+0x75>
+  801508:	83 ec 0c             	sub    $0xc,%esp
+  80150b:	ff 75 f4             	push   -0xc(%ebp)
+  80150e:	e8 03 f5 ff ff       	call   800a16 <fd2num>
+  801513:	89 c3                	mov    %eax,%ebx
+  801515:	83 c4 10             	add    $0x10,%esp
+  801518:	89 d8                	mov    %ebx,%eax
+  80151a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80151d:	5b                   	pop    %ebx
+  80151e:	5e                   	pop    %esi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+  801521:	83 ec 08             	sub    $0x8,%esp
+  801524:	6a 00                	push   $0x0
+  801526:	ff 75 f4             	push   -0xc(%ebp)
+  801529:	e8 05 f6 ff ff       	call   800b33 <fd_close>
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	eb e5                	jmp    801518 <open+0x6c>
+  801533:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801538:	eb de                	jmp    801518 <open+0x6c>
+
+0080153a <file_image>:
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	53                   	push   %ebx
+  80153e:	83 ec 1c             	sub    $0x1c,%esp
+  801541:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801544:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801547:	50                   	push   %eax
+  801548:	ff 75 08             	push   0x8(%ebp)
+  80154b:	e8 3d f5 ff ff       	call   800a8d <fd_lookup>
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	85 c0                	test   %eax,%eax
+  801555:	78 58                	js     8015af <file_image+0x75>
+  801557:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80155a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801560:	39 08                	cmp    %ecx,(%eax)
+  801562:	75 50                	jne    8015b4 <file_image+0x7a>
+  801564:	83 fb 04             	cmp    $0x4,%ebx
+  801567:	77 52                	ja     8015bb <file_image+0x81>
+  801569:	8b 40 0c             	mov    0xc(%eax),%eax
+  80156c:	a3 00 60 80 00       	mov    %eax,0x806000
+  801571:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801577:	83 ec 04             	sub    $0x4,%esp
+  80157a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80157d:	c1 e0 02             	shl    $0x2,%eax
+  801580:	50                   	push   %eax
+  801581:	ff 75 0c             	push   0xc(%ebp)
+  801584:	68 08 60 80 00       	push   $0x806008
+  801589:	e8 69 15 00 00       	call   802af7 <memmove>
+  80158e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801593:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801598:	e8 0b fa ff ff       	call   800fa8 <fsipc>
+  80159d:	83 c4 10             	add    $0x10,%esp
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	78 0b                	js     8015af <file_image+0x75>
+  8015a4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8015a7:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8015ad:	89 0a                	mov    %ecx,(%edx)
+  8015af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+  8015b4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b9:	eb f4                	jmp    8015af <file_image+0x75>
+  8015bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c0:	eb ed                	jmp    8015af <file_image+0x75>
+
+008015c2 <remove>:
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	53                   	push   %ebx
+  8015c6:	83 ec 10             	sub    $0x10,%esp
+  8015c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015cc:	53                   	push   %ebx
+  8015cd:	e8 29 13 00 00       	call   8028fb <strlen>
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015da:	7f 25                	jg     801601 <remove+0x3f>
+  8015dc:	83 ec 08             	sub    $0x8,%esp
+  8015df:	53                   	push   %ebx
+  8015e0:	68 00 60 80 00       	push   $0x806000
+  8015e5:	e8 5d 13 00 00       	call   802947 <strcpy>
+  8015ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ef:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015f4:	e8 af f9 ff ff       	call   800fa8 <fsipc>
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ff:	c9                   	leave
+  801600:	c3                   	ret
+  801601:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801606:	eb f4                	jmp    8015fc <remove+0x3a>
+
+00801608 <sync>:
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	83 ec 08             	sub    $0x8,%esp
+  80160e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801613:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801618:	e8 8b f9 ff ff       	call   800fa8 <fsipc>
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+
+0080161f <devsock_stat>:
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	83 ec 10             	sub    $0x10,%esp
+  801625:	68 48 32 80 00       	push   $0x803248
+  80162a:	ff 75 0c             	push   0xc(%ebp)
+  80162d:	e8 15 13 00 00       	call   802947 <strcpy>
+  801632:	b8 00 00 00 00       	mov    $0x0,%eax
+  801637:	c9                   	leave
+  801638:	c3                   	ret
+
+00801639 <devsock_close>:
+  801639:	55                   	push   %ebp
+  80163a:	89 e5                	mov    %esp,%ebp
+  80163c:	53                   	push   %ebx
+  80163d:	83 ec 10             	sub    $0x10,%esp
+  801640:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801643:	53                   	push   %ebx
+  801644:	e8 e3 18 00 00       	call   802f2c <pageref>
+  801649:	89 c2                	mov    %eax,%edx
+  80164b:	83 c4 10             	add    $0x10,%esp
+  80164e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801653:	83 fa 01             	cmp    $0x1,%edx
+  801656:	74 05                	je     80165d <devsock_close+0x24>
+  801658:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80165b:	c9                   	leave
+  80165c:	c3                   	ret
+  80165d:	83 ec 0c             	sub    $0xc,%esp
+  801660:	ff 73 0c             	push   0xc(%ebx)
+  801663:	e8 aa 02 00 00       	call   801912 <nsipc_close>
+  801668:	83 c4 10             	add    $0x10,%esp
+  80166b:	eb eb                	jmp    801658 <devsock_close+0x1f>
+
+0080166d <devsock_write>:
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	83 ec 08             	sub    $0x8,%esp
+  801673:	6a 00                	push   $0x0
+  801675:	ff 75 10             	push   0x10(%ebp)
+  801678:	ff 75 0c             	push   0xc(%ebp)
+  80167b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80167e:	ff 70 0c             	push   0xc(%eax)
+  801681:	e8 6c 03 00 00       	call   8019f2 <nsipc_send>
+  801686:	c9                   	leave
+  801687:	c3                   	ret
+
+00801688 <devsock_read>:
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	83 ec 08             	sub    $0x8,%esp
+  80168e:	6a 00                	push   $0x0
+  801690:	ff 75 10             	push   0x10(%ebp)
+  801693:	ff 75 0c             	push   0xc(%ebp)
+  801696:	8b 45 08             	mov    0x8(%ebp),%eax
+  801699:	ff 70 0c             	push   0xc(%eax)
+  80169c:	e8 e2 02 00 00       	call   801983 <nsipc_recv>
+  8016a1:	c9                   	leave
+  8016a2:	c3                   	ret
+
+008016a3 <fd2sockid>:
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	83 ec 20             	sub    $0x20,%esp
+  8016a9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016ac:	52                   	push   %edx
+  8016ad:	50                   	push   %eax
+  8016ae:	e8 da f3 ff ff       	call   800a8d <fd_lookup>
+  8016b3:	83 c4 10             	add    $0x10,%esp
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	78 10                	js     8016ca <fd2sockid+0x27>
+  8016ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016bd:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016c3:	39 08                	cmp    %ecx,(%eax)
+  8016c5:	75 05                	jne    8016cc <fd2sockid+0x29>
+  8016c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016ca:	c9                   	leave
+  8016cb:	c3                   	ret
+  8016cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d1:	eb f7                	jmp    8016ca <fd2sockid+0x27>
+
+008016d3 <alloc_sockfd>:
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	56                   	push   %esi
+  8016d7:	53                   	push   %ebx
+  8016d8:	83 ec 1c             	sub    $0x1c,%esp
+  8016db:	89 c6                	mov    %eax,%esi
+  8016dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e0:	50                   	push   %eax
+  8016e1:	e8 57 f3 ff ff       	call   800a3d <fd_alloc>
+  8016e6:	89 c3                	mov    %eax,%ebx
+  8016e8:	83 c4 10             	add    $0x10,%esp
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	78 43                	js     801732 <alloc_sockfd+0x5f>
+  8016ef:	83 ec 04             	sub    $0x4,%esp
+  8016f2:	68 07 04 00 00       	push   $0x407
+  8016f7:	ff 75 f4             	push   -0xc(%ebp)
+  8016fa:	6a 00                	push   $0x0
+  8016fc:	e8 a7 ea ff ff       	call   8001a8 <sys_page_alloc>
+  801701:	89 c3                	mov    %eax,%ebx
+  801703:	83 c4 10             	add    $0x10,%esp
+  801706:	85 c0                	test   %eax,%eax
+  801708:	78 28                	js     801732 <alloc_sockfd+0x5f>
+  80170a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801713:	89 10                	mov    %edx,(%eax)
+  801715:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801718:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80171f:	89 70 0c             	mov    %esi,0xc(%eax)
+  801722:	83 ec 0c             	sub    $0xc,%esp
+  801725:	50                   	push   %eax
+  801726:	e8 eb f2 ff ff       	call   800a16 <fd2num>
+  80172b:	89 c3                	mov    %eax,%ebx
+  80172d:	83 c4 10             	add    $0x10,%esp
+  801730:	eb 0c                	jmp    80173e <alloc_sockfd+0x6b>
+  801732:	83 ec 0c             	sub    $0xc,%esp
+  801735:	56                   	push   %esi
+  801736:	e8 d7 01 00 00       	call   801912 <nsipc_close>
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	89 d8                	mov    %ebx,%eax
+  801740:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801743:	5b                   	pop    %ebx
+  801744:	5e                   	pop    %esi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+
+00801747 <accept>:
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	83 ec 08             	sub    $0x8,%esp
+  80174d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801750:	e8 4e ff ff ff       	call   8016a3 <fd2sockid>
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 1b                	js     801774 <accept+0x2d>
+  801759:	83 ec 04             	sub    $0x4,%esp
+  80175c:	ff 75 10             	push   0x10(%ebp)
+  80175f:	ff 75 0c             	push   0xc(%ebp)
+  801762:	50                   	push   %eax
+  801763:	e8 07 01 00 00       	call   80186f <nsipc_accept>
+  801768:	83 c4 10             	add    $0x10,%esp
+  80176b:	85 c0                	test   %eax,%eax
+  80176d:	78 05                	js     801774 <accept+0x2d>
+  80176f:	e8 5f ff ff ff       	call   8016d3 <alloc_sockfd>
+  801774:	c9                   	leave
+  801775:	c3                   	ret
+
+00801776 <bind>:
+  801776:	55                   	push   %ebp
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	83 ec 08             	sub    $0x8,%esp
+  80177c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177f:	e8 1f ff ff ff       	call   8016a3 <fd2sockid>
+  801784:	85 c0                	test   %eax,%eax
+  801786:	78 12                	js     80179a <bind+0x24>
+  801788:	83 ec 04             	sub    $0x4,%esp
+  80178b:	ff 75 10             	push   0x10(%ebp)
+  80178e:	ff 75 0c             	push   0xc(%ebp)
+  801791:	50                   	push   %eax
+  801792:	e8 24 01 00 00       	call   8018bb <nsipc_bind>
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+
+0080179c <shutdown>:
+  80179c:	55                   	push   %ebp
+  80179d:	89 e5                	mov    %esp,%ebp
+  80179f:	83 ec 08             	sub    $0x8,%esp
+  8017a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a5:	e8 f9 fe ff ff       	call   8016a3 <fd2sockid>
+  8017aa:	85 c0                	test   %eax,%eax
+  8017ac:	78 0f                	js     8017bd <shutdown+0x21>
+  8017ae:	83 ec 08             	sub    $0x8,%esp
+  8017b1:	ff 75 0c             	push   0xc(%ebp)
+  8017b4:	50                   	push   %eax
+  8017b5:	e8 36 01 00 00       	call   8018f0 <nsipc_shutdown>
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	c9                   	leave
+  8017be:	c3                   	ret
+
+008017bf <connect>:
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	83 ec 08             	sub    $0x8,%esp
+  8017c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c8:	e8 d6 fe ff ff       	call   8016a3 <fd2sockid>
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	78 12                	js     8017e3 <connect+0x24>
+  8017d1:	83 ec 04             	sub    $0x4,%esp
+  8017d4:	ff 75 10             	push   0x10(%ebp)
+  8017d7:	ff 75 0c             	push   0xc(%ebp)
+  8017da:	50                   	push   %eax
+  8017db:	e8 4c 01 00 00       	call   80192c <nsipc_connect>
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+008017e5 <listen>:
+  8017e5:	55                   	push   %ebp
+  8017e6:	89 e5                	mov    %esp,%ebp
+  8017e8:	83 ec 08             	sub    $0x8,%esp
+  8017eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ee:	e8 b0 fe ff ff       	call   8016a3 <fd2sockid>
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	78 0f                	js     801806 <listen+0x21>
+  8017f7:	83 ec 08             	sub    $0x8,%esp
+  8017fa:	ff 75 0c             	push   0xc(%ebp)
+  8017fd:	50                   	push   %eax
+  8017fe:	e8 5e 01 00 00       	call   801961 <nsipc_listen>
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	c9                   	leave
+  801807:	c3                   	ret
+
+00801808 <socket>:
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	83 ec 0c             	sub    $0xc,%esp
+  80180e:	ff 75 10             	push   0x10(%ebp)
+  801811:	ff 75 0c             	push   0xc(%ebp)
+  801814:	ff 75 08             	push   0x8(%ebp)
+  801817:	e8 34 02 00 00       	call   801a50 <nsipc_socket>
+  80181c:	83 c4 10             	add    $0x10,%esp
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	78 05                	js     801828 <socket+0x20>
+  801823:	e8 ab fe ff ff       	call   8016d3 <alloc_sockfd>
+  801828:	c9                   	leave
+  801829:	c3                   	ret
+
+0080182a <nsipc>:
+  80182a:	55                   	push   %ebp
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	53                   	push   %ebx
+  80182e:	83 ec 04             	sub    $0x4,%esp
+  801831:	89 c3                	mov    %eax,%ebx
+  801833:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80183a:	74 1f                	je     80185b <nsipc+0x31>
+  80183c:	83 ec 08             	sub    $0x8,%esp
+  80183f:	6a 00                	push   $0x0
+  801841:	6a 00                	push   $0x0
+  801843:	6a 07                	push   $0x7
+  801845:	68 00 70 80 00       	push   $0x807000
+  80184a:	53                   	push   %ebx
+  80184b:	ff 35 0c 50 80 00    	push   0x80500c
+  801851:	e8 21 15 00 00       	call   802d77 <ipc_call>
+  801856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+  80185b:	83 ec 0c             	sub    $0xc,%esp
+  80185e:	6a 03                	push   $0x3
+  801860:	e8 ad 16 00 00       	call   802f12 <ipc_find_env>
+  801865:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80186a:	83 c4 10             	add    $0x10,%esp
+  80186d:	eb cd                	jmp    80183c <nsipc+0x12>
+
+0080186f <nsipc_accept>:
+  80186f:	55                   	push   %ebp
+  801870:	89 e5                	mov    %esp,%ebp
+  801872:	53                   	push   %ebx
+  801873:	83 ec 04             	sub    $0x4,%esp
+  801876:	8b 45 08             	mov    0x8(%ebp),%eax
+  801879:	a3 00 70 80 00       	mov    %eax,0x807000
+  80187e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801883:	e8 a2 ff ff ff       	call   80182a <nsipc>
+  801888:	89 c3                	mov    %eax,%ebx
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	79 07                	jns    801895 <nsipc_accept+0x26>
+  80188e:	89 d8                	mov    %ebx,%eax
+  801890:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801893:	c9                   	leave
+  801894:	c3                   	ret
+  801895:	83 ec 04             	sub    $0x4,%esp
+  801898:	ff 35 10 70 80 00    	push   0x807010
+  80189e:	68 00 70 80 00       	push   $0x807000
+  8018a3:	ff 75 0c             	push   0xc(%ebp)
+  8018a6:	e8 4c 12 00 00       	call   802af7 <memmove>
+  8018ab:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018b4:	89 10                	mov    %edx,(%eax)
+  8018b6:	83 c4 10             	add    $0x10,%esp
+  8018b9:	eb d3                	jmp    80188e <nsipc_accept+0x1f>
+
+008018bb <nsipc_bind>:
+  8018bb:	55                   	push   %ebp
+  8018bc:	89 e5                	mov    %esp,%ebp
+  8018be:	53                   	push   %ebx
+  8018bf:	83 ec 08             	sub    $0x8,%esp
+  8018c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c8:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018cd:	53                   	push   %ebx
+  8018ce:	ff 75 0c             	push   0xc(%ebp)
+  8018d1:	68 04 70 80 00       	push   $0x807004
+  8018d6:	e8 1c 12 00 00       	call   802af7 <memmove>
+  8018db:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018e1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018e6:	e8 3f ff ff ff       	call   80182a <nsipc>
+  8018eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+008018f0 <nsipc_shutdown>:
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	83 ec 08             	sub    $0x8,%esp
+  8018f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801901:	a3 04 70 80 00       	mov    %eax,0x807004
+  801906:	b8 03 00 00 00       	mov    $0x3,%eax
+  80190b:	e8 1a ff ff ff       	call   80182a <nsipc>
+  801910:	c9                   	leave
+  801911:	c3                   	ret
+
+00801912 <nsipc_close>:
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	83 ec 08             	sub    $0x8,%esp
+  801918:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191b:	a3 00 70 80 00       	mov    %eax,0x807000
+  801920:	b8 04 00 00 00       	mov    $0x4,%eax
+  801925:	e8 00 ff ff ff       	call   80182a <nsipc>
+  80192a:	c9                   	leave
+  80192b:	c3                   	ret
+
+0080192c <nsipc_connect>:
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	53                   	push   %ebx
+  801930:	83 ec 08             	sub    $0x8,%esp
+  801933:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801936:	8b 45 08             	mov    0x8(%ebp),%eax
+  801939:	a3 00 70 80 00       	mov    %eax,0x807000
+  80193e:	53                   	push   %ebx
+  80193f:	ff 75 0c             	push   0xc(%ebp)
+  801942:	68 04 70 80 00       	push   $0x807004
+  801947:	e8 ab 11 00 00       	call   802af7 <memmove>
+  80194c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801952:	b8 05 00 00 00       	mov    $0x5,%eax
+  801957:	e8 ce fe ff ff       	call   80182a <nsipc>
+  80195c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195f:	c9                   	leave
+  801960:	c3                   	ret
+
+00801961 <nsipc_listen>:
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	83 ec 08             	sub    $0x8,%esp
+  801967:	8b 45 08             	mov    0x8(%ebp),%eax
+  80196a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80196f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801972:	a3 04 70 80 00       	mov    %eax,0x807004
+  801977:	b8 06 00 00 00       	mov    $0x6,%eax
+  80197c:	e8 a9 fe ff ff       	call   80182a <nsipc>
+  801981:	c9                   	leave
+  801982:	c3                   	ret
+
+00801983 <nsipc_recv>:
+  801983:	55                   	push   %ebp
+  801984:	89 e5                	mov    %esp,%ebp
+  801986:	56                   	push   %esi
+  801987:	53                   	push   %ebx
+  801988:	8b 75 10             	mov    0x10(%ebp),%esi
+  80198b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198e:	a3 00 70 80 00       	mov    %eax,0x807000
+  801993:	89 35 04 70 80 00    	mov    %esi,0x807004
+  801999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199c:	a3 08 70 80 00       	mov    %eax,0x807008
+  8019a1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019a6:	e8 7f fe ff ff       	call   80182a <nsipc>
+  8019ab:	89 c3                	mov    %eax,%ebx
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	78 22                	js     8019d3 <nsipc_recv+0x50>
+  8019b1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019b6:	39 c6                	cmp    %eax,%esi
+  8019b8:	0f 4e c6             	cmovle %esi,%eax
+  8019bb:	39 c3                	cmp    %eax,%ebx
+  8019bd:	7f 1d                	jg     8019dc <nsipc_recv+0x59>
+  8019bf:	83 ec 04             	sub    $0x4,%esp
+  8019c2:	53                   	push   %ebx
+  8019c3:	68 00 70 80 00       	push   $0x807000
+  8019c8:	ff 75 0c             	push   0xc(%ebp)
+  8019cb:	e8 27 11 00 00       	call   802af7 <memmove>
+  8019d0:	83 c4 10             	add    $0x10,%esp
+  8019d3:	89 d8                	mov    %ebx,%eax
+  8019d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d8:	5b                   	pop    %ebx
+  8019d9:	5e                   	pop    %esi
+  8019da:	5d                   	pop    %ebp
+  8019db:	c3                   	ret
+  8019dc:	68 54 32 80 00       	push   $0x803254
+  8019e1:	68 69 32 80 00       	push   $0x803269
+  8019e6:	6a 60                	push   $0x60
+  8019e8:	68 7e 32 80 00       	push   $0x80327e
+  8019ed:	e8 83 07 00 00       	call   802175 <_panic>
+
+008019f2 <nsipc_send>:
+  8019f2:	55                   	push   %ebp
+  8019f3:	89 e5                	mov    %esp,%ebp
+  8019f5:	53                   	push   %ebx
+  8019f6:	83 ec 04             	sub    $0x4,%esp
+  8019f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ff:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a04:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a0a:	7f 2e                	jg     801a3a <nsipc_send+0x48>
+  801a0c:	83 ec 04             	sub    $0x4,%esp
+  801a0f:	53                   	push   %ebx
+  801a10:	ff 75 0c             	push   0xc(%ebp)
+  801a13:	68 0c 70 80 00       	push   $0x80700c
+  801a18:	e8 da 10 00 00       	call   802af7 <memmove>
+  801a1d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a23:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a26:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a2b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a30:	e8 f5 fd ff ff       	call   80182a <nsipc>
+  801a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a38:	c9                   	leave
+  801a39:	c3                   	ret
+  801a3a:	68 8a 32 80 00       	push   $0x80328a
+  801a3f:	68 69 32 80 00       	push   $0x803269
+  801a44:	6a 6b                	push   $0x6b
+  801a46:	68 7e 32 80 00       	push   $0x80327e
+  801a4b:	e8 25 07 00 00       	call   802175 <_panic>
+
+00801a50 <nsipc_socket>:
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	83 ec 08             	sub    $0x8,%esp
+  801a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a59:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a61:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a66:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a69:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a6e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a73:	e8 b2 fd ff ff       	call   80182a <nsipc>
+  801a78:	c9                   	leave
+  801a79:	c3                   	ret
+
+00801a7a <devpipe_stat>:
+  801a7a:	55                   	push   %ebp
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	56                   	push   %esi
+  801a7e:	53                   	push   %ebx
+  801a7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a82:	83 ec 0c             	sub    $0xc,%esp
+  801a85:	ff 75 08             	push   0x8(%ebp)
+  801a88:	e8 99 ef ff ff       	call   800a26 <fd2data>
+  801a8d:	89 c6                	mov    %eax,%esi
+  801a8f:	83 c4 08             	add    $0x8,%esp
+  801a92:	68 96 32 80 00       	push   $0x803296
+  801a97:	53                   	push   %ebx
+  801a98:	e8 aa 0e 00 00       	call   802947 <strcpy>
+  801a9d:	8b 46 04             	mov    0x4(%esi),%eax
+  801aa0:	2b 06                	sub    (%esi),%eax
+  801aa2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801aa8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801aaf:	00 00 00 
+  801ab2:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801ab9:	40 80 00 
+  801abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac4:	5b                   	pop    %ebx
+  801ac5:	5e                   	pop    %esi
+  801ac6:	5d                   	pop    %ebp
+  801ac7:	c3                   	ret
+
+00801ac8 <devpipe_close>:
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	53                   	push   %ebx
+  801acc:	83 ec 0c             	sub    $0xc,%esp
+  801acf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ad2:	53                   	push   %ebx
+  801ad3:	6a 00                	push   $0x0
+  801ad5:	e8 a0 e7 ff ff       	call   80027a <sys_page_unmap>
+  801ada:	89 1c 24             	mov    %ebx,(%esp)
+  801add:	e8 44 ef ff ff       	call   800a26 <fd2data>
+  801ae2:	83 c4 08             	add    $0x8,%esp
+  801ae5:	50                   	push   %eax
+  801ae6:	6a 00                	push   $0x0
+  801ae8:	e8 8d e7 ff ff       	call   80027a <sys_page_unmap>
+  801aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af0:	c9                   	leave
+  801af1:	c3                   	ret
+
+00801af2 <_pipeisclosed>:
+  801af2:	55                   	push   %ebp
+  801af3:	89 e5                	mov    %esp,%ebp
+  801af5:	57                   	push   %edi
+  801af6:	56                   	push   %esi
+  801af7:	53                   	push   %ebx
+  801af8:	83 ec 1c             	sub    $0x1c,%esp
+  801afb:	89 c7                	mov    %eax,%edi
+  801afd:	89 d6                	mov    %edx,%esi
+  801aff:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b04:	8b 58 58             	mov    0x58(%eax),%ebx
+  801b07:	83 ec 0c             	sub    $0xc,%esp
+  801b0a:	57                   	push   %edi
+  801b0b:	e8 1c 14 00 00       	call   802f2c <pageref>
+  801b10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b13:	89 34 24             	mov    %esi,(%esp)
+  801b16:	e8 11 14 00 00       	call   802f2c <pageref>
+  801b1b:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b21:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	39 cb                	cmp    %ecx,%ebx
+  801b29:	74 1b                	je     801b46 <_pipeisclosed+0x54>
+  801b2b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b2e:	75 cf                	jne    801aff <_pipeisclosed+0xd>
+  801b30:	8b 42 58             	mov    0x58(%edx),%eax
+  801b33:	6a 01                	push   $0x1
+  801b35:	50                   	push   %eax
+  801b36:	53                   	push   %ebx
+  801b37:	68 9d 32 80 00       	push   $0x80329d
+  801b3c:	e8 0f 07 00 00       	call   802250 <cprintf>
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	eb b9                	jmp    801aff <_pipeisclosed+0xd>
+  801b46:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b49:	0f 94 c0             	sete   %al
+  801b4c:	0f b6 c0             	movzbl %al,%eax
+  801b4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b52:	5b                   	pop    %ebx
+  801b53:	5e                   	pop    %esi
+  801b54:	5f                   	pop    %edi
+  801b55:	5d                   	pop    %ebp
+  801b56:	c3                   	ret
+
+00801b57 <devpipe_write>:
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	57                   	push   %edi
+  801b5b:	56                   	push   %esi
+  801b5c:	53                   	push   %ebx
+  801b5d:	83 ec 28             	sub    $0x28,%esp
+  801b60:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b63:	56                   	push   %esi
+  801b64:	e8 bd ee ff ff       	call   800a26 <fd2data>
+  801b69:	89 c3                	mov    %eax,%ebx
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b73:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b77:	74 5c                	je     801bd5 <devpipe_write+0x7e>
+  801b79:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b7c:	8b 0b                	mov    (%ebx),%ecx
+  801b7e:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b81:	39 d0                	cmp    %edx,%eax
+  801b83:	72 1e                	jb     801ba3 <devpipe_write+0x4c>
+  801b85:	89 da                	mov    %ebx,%edx
+  801b87:	89 f0                	mov    %esi,%eax
+  801b89:	e8 64 ff ff ff       	call   801af2 <_pipeisclosed>
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	75 48                	jne    801bda <devpipe_write+0x83>
+  801b92:	e8 c6 e5 ff ff       	call   80015d <sys_yield>
+  801b97:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b9a:	8b 0b                	mov    (%ebx),%ecx
+  801b9c:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b9f:	39 d0                	cmp    %edx,%eax
+  801ba1:	73 e2                	jae    801b85 <devpipe_write+0x2e>
+  801ba3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ba6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801baa:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801bad:	89 c2                	mov    %eax,%edx
+  801baf:	c1 fa 1f             	sar    $0x1f,%edx
+  801bb2:	89 d1                	mov    %edx,%ecx
+  801bb4:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bb7:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bba:	83 e2 1f             	and    $0x1f,%edx
+  801bbd:	29 ca                	sub    %ecx,%edx
+  801bbf:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bc3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bc7:	83 c0 01             	add    $0x1,%eax
+  801bca:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bcd:	83 c7 01             	add    $0x1,%edi
+  801bd0:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bd3:	75 a4                	jne    801b79 <devpipe_write+0x22>
+  801bd5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bd8:	eb 05                	jmp    801bdf <devpipe_write+0x88>
+  801bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be2:	5b                   	pop    %ebx
+  801be3:	5e                   	pop    %esi
+  801be4:	5f                   	pop    %edi
+  801be5:	5d                   	pop    %ebp
+  801be6:	c3                   	ret
+
+00801be7 <devpipe_read>:
+  801be7:	55                   	push   %ebp
+  801be8:	89 e5                	mov    %esp,%ebp
+  801bea:	57                   	push   %edi
+  801beb:	56                   	push   %esi
+  801bec:	53                   	push   %ebx
+  801bed:	83 ec 18             	sub    $0x18,%esp
+  801bf0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bf3:	56                   	push   %esi
+  801bf4:	e8 2d ee ff ff       	call   800a26 <fd2data>
+  801bf9:	89 c3                	mov    %eax,%ebx
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c03:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c07:	74 45                	je     801c4e <devpipe_read+0x67>
+  801c09:	8b 03                	mov    (%ebx),%eax
+  801c0b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c0e:	75 1d                	jne    801c2d <devpipe_read+0x46>
+  801c10:	85 ff                	test   %edi,%edi
+  801c12:	75 3f                	jne    801c53 <devpipe_read+0x6c>
+  801c14:	89 da                	mov    %ebx,%edx
+  801c16:	89 f0                	mov    %esi,%eax
+  801c18:	e8 d5 fe ff ff       	call   801af2 <_pipeisclosed>
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	75 3c                	jne    801c5d <devpipe_read+0x76>
+  801c21:	e8 37 e5 ff ff       	call   80015d <sys_yield>
+  801c26:	8b 03                	mov    (%ebx),%eax
+  801c28:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c2b:	74 e7                	je     801c14 <devpipe_read+0x2d>
+  801c2d:	99                   	cltd
+  801c2e:	c1 ea 1b             	shr    $0x1b,%edx
+  801c31:	01 d0                	add    %edx,%eax
+  801c33:	83 e0 1f             	and    $0x1f,%eax
+  801c36:	29 d0                	sub    %edx,%eax
+  801c38:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c40:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c43:	83 03 01             	addl   $0x1,(%ebx)
+  801c46:	83 c7 01             	add    $0x1,%edi
+  801c49:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c4c:	75 bb                	jne    801c09 <devpipe_read+0x22>
+  801c4e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c51:	eb 02                	jmp    801c55 <devpipe_read+0x6e>
+  801c53:	89 f8                	mov    %edi,%eax
+  801c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c58:	5b                   	pop    %ebx
+  801c59:	5e                   	pop    %esi
+  801c5a:	5f                   	pop    %edi
+  801c5b:	5d                   	pop    %ebp
+  801c5c:	c3                   	ret
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c62:	eb f1                	jmp    801c55 <devpipe_read+0x6e>
+
+00801c64 <pipe>:
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	56                   	push   %esi
+  801c68:	53                   	push   %ebx
+  801c69:	83 ec 1c             	sub    $0x1c,%esp
+  801c6c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6f:	50                   	push   %eax
+  801c70:	e8 c8 ed ff ff       	call   800a3d <fd_alloc>
+  801c75:	89 c3                	mov    %eax,%ebx
+  801c77:	83 c4 10             	add    $0x10,%esp
+  801c7a:	85 c0                	test   %eax,%eax
+  801c7c:	0f 88 23 01 00 00    	js     801da5 <pipe+0x141>
+  801c82:	83 ec 04             	sub    $0x4,%esp
+  801c85:	68 07 04 00 00       	push   $0x407
+  801c8a:	ff 75 f4             	push   -0xc(%ebp)
+  801c8d:	6a 00                	push   $0x0
+  801c8f:	e8 14 e5 ff ff       	call   8001a8 <sys_page_alloc>
+  801c94:	89 c3                	mov    %eax,%ebx
+  801c96:	83 c4 10             	add    $0x10,%esp
+  801c99:	85 c0                	test   %eax,%eax
+  801c9b:	0f 88 04 01 00 00    	js     801da5 <pipe+0x141>
+  801ca1:	83 ec 0c             	sub    $0xc,%esp
+  801ca4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca7:	50                   	push   %eax
+  801ca8:	e8 90 ed ff ff       	call   800a3d <fd_alloc>
+  801cad:	89 c3                	mov    %eax,%ebx
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	85 c0                	test   %eax,%eax
+  801cb4:	0f 88 db 00 00 00    	js     801d95 <pipe+0x131>
+  801cba:	83 ec 04             	sub    $0x4,%esp
+  801cbd:	68 07 04 00 00       	push   $0x407
+  801cc2:	ff 75 f0             	push   -0x10(%ebp)
+  801cc5:	6a 00                	push   $0x0
+  801cc7:	e8 dc e4 ff ff       	call   8001a8 <sys_page_alloc>
+  801ccc:	89 c3                	mov    %eax,%ebx
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	0f 88 bc 00 00 00    	js     801d95 <pipe+0x131>
+  801cd9:	83 ec 0c             	sub    $0xc,%esp
+  801cdc:	ff 75 f4             	push   -0xc(%ebp)
+  801cdf:	e8 42 ed ff ff       	call   800a26 <fd2data>
+  801ce4:	89 c6                	mov    %eax,%esi
+  801ce6:	83 c4 0c             	add    $0xc,%esp
+  801ce9:	68 07 04 00 00       	push   $0x407
+  801cee:	50                   	push   %eax
+  801cef:	6a 00                	push   $0x0
+  801cf1:	e8 b2 e4 ff ff       	call   8001a8 <sys_page_alloc>
+  801cf6:	89 c3                	mov    %eax,%ebx
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	0f 88 82 00 00 00    	js     801d85 <pipe+0x121>
+  801d03:	83 ec 0c             	sub    $0xc,%esp
+  801d06:	ff 75 f0             	push   -0x10(%ebp)
+  801d09:	e8 18 ed ff ff       	call   800a26 <fd2data>
+  801d0e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d15:	50                   	push   %eax
+  801d16:	6a 00                	push   $0x0
+  801d18:	56                   	push   %esi
+  801d19:	6a 00                	push   $0x0
+  801d1b:	e8 cb e4 ff ff       	call   8001eb <sys_page_map>
+  801d20:	89 c3                	mov    %eax,%ebx
+  801d22:	83 c4 20             	add    $0x20,%esp
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 4e                	js     801d77 <pipe+0x113>
+  801d29:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d31:	89 02                	mov    %eax,(%edx)
+  801d33:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d36:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d3d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d40:	89 02                	mov    %eax,(%edx)
+  801d42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d45:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d4c:	83 ec 0c             	sub    $0xc,%esp
+  801d4f:	ff 75 f4             	push   -0xc(%ebp)
+  801d52:	e8 bf ec ff ff       	call   800a16 <fd2num>
+  801d57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d5a:	89 01                	mov    %eax,(%ecx)
+  801d5c:	83 c4 04             	add    $0x4,%esp
+  801d5f:	ff 75 f0             	push   -0x10(%ebp)
+  801d62:	e8 af ec ff ff       	call   800a16 <fd2num>
+  801d67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d6a:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d6d:	83 c4 10             	add    $0x10,%esp
+  801d70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d75:	eb 2e                	jmp    801da5 <pipe+0x141>
+  801d77:	83 ec 08             	sub    $0x8,%esp
+  801d7a:	56                   	push   %esi
+  801d7b:	6a 00                	push   $0x0
+  801d7d:	e8 f8 e4 ff ff       	call   80027a <sys_page_unmap>
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	83 ec 08             	sub    $0x8,%esp
+  801d88:	ff 75 f0             	push   -0x10(%ebp)
+  801d8b:	6a 00                	push   $0x0
+  801d8d:	e8 e8 e4 ff ff       	call   80027a <sys_page_unmap>
+  801d92:	83 c4 10             	add    $0x10,%esp
+  801d95:	83 ec 08             	sub    $0x8,%esp
+  801d98:	ff 75 f4             	push   -0xc(%ebp)
+  801d9b:	6a 00                	push   $0x0
+  801d9d:	e8 d8 e4 ff ff       	call   80027a <sys_page_unmap>
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	89 d8                	mov    %ebx,%eax
+  801da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801daa:	5b                   	pop    %ebx
+  801dab:	5e                   	pop    %esi
+  801dac:	5d                   	pop    %ebp
+  801dad:	c3                   	ret
+
+00801dae <pipeisclosed>:
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	83 ec 20             	sub    $0x20,%esp
+  801db4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db7:	50                   	push   %eax
+  801db8:	ff 75 08             	push   0x8(%ebp)
+  801dbb:	e8 cd ec ff ff       	call   800a8d <fd_lookup>
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	78 18                	js     801ddf <pipeisclosed+0x31>
+  801dc7:	83 ec 0c             	sub    $0xc,%esp
+  801dca:	ff 75 f4             	push   -0xc(%ebp)
+  801dcd:	e8 54 ec ff ff       	call   800a26 <fd2data>
+  801dd2:	89 c2                	mov    %eax,%edx
+  801dd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd7:	e8 16 fd ff ff       	call   801af2 <_pipeisclosed>
+  801ddc:	83 c4 10             	add    $0x10,%esp
+  801ddf:	c9                   	leave
+  801de0:	c3                   	ret
+
+00801de1 <ipcring_init>:
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	53                   	push   %ebx
+  801de5:	83 ec 08             	sub    $0x8,%esp
+  801de8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801deb:	6a 60                	push   $0x60
+  801ded:	6a 00                	push   $0x0
+  801def:	53                   	push   %ebx
+  801df0:	e8 cd 0c 00 00       	call   802ac2 <memset>
+  801df5:	a1 10 50 80 00       	mov    0x805010,%eax
+  801dfa:	8b 40 48             	mov    0x48(%eax),%eax
+  801dfd:	89 03                	mov    %eax,(%ebx)
+  801dff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e02:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e05:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e08:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e0e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e11:	83 c4 10             	add    $0x10,%esp
+  801e14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e17:	c9                   	leave
+  801e18:	c3                   	ret
+
+00801e19 <ipcring_req_slot>:
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1f:	8b 50 10             	mov    0x10(%eax),%edx
+  801e22:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e25:	29 ca                	sub    %ecx,%edx
+  801e27:	83 fa 07             	cmp    $0x7,%edx
+  801e2a:	77 0c                	ja     801e38 <ipcring_req_slot+0x1f>
+  801e2c:	8b 50 10             	mov    0x10(%eax),%edx
+  801e2f:	83 e2 07             	and    $0x7,%edx
+  801e32:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e36:	5d                   	pop    %ebp
+  801e37:	c3                   	ret
+  801e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3d:	eb f7                	jmp    801e36 <ipcring_req_slot+0x1d>
+
+00801e3f <ipcring_req_push>:
+  801e3f:	55                   	push   %ebp
+  801e40:	89 e5                	mov    %esp,%ebp
+  801e42:	83 ec 08             	sub    $0x8,%esp
+  801e45:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e48:	8b 42 10             	mov    0x10(%edx),%eax
+  801e4b:	83 c0 01             	add    $0x1,%eax
+  801e4e:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e57:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	75 02                	jne    801e61 <ipcring_req_push+0x22>
+  801e5f:	c9                   	leave
+  801e60:	c3                   	ret
+  801e61:	6a 00                	push   $0x0
+  801e63:	68 00 00 80 ee       	push   $0xee800000
+  801e68:	ff 72 08             	push   0x8(%edx)
+  801e6b:	ff 72 04             	push   0x4(%edx)
+  801e6e:	e8 6d e6 ff ff       	call   8004e0 <sys_ipc_send>
+  801e73:	83 c4 10             	add    $0x10,%esp
+  801e76:	eb e7                	jmp    801e5f <ipcring_req_push+0x20>
+
+00801e78 <ipcring_rsp_wait>:
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	53                   	push   %ebx
+  801e7c:	83 ec 04             	sub    $0x4,%esp
+  801e7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e82:	8b 53 18             	mov    0x18(%ebx),%edx
+  801e85:	8b 43 10             	mov    0x10(%ebx),%eax
+  801e88:	39 c2                	cmp    %eax,%edx
+  801e8a:	74 3c                	je     801ec8 <ipcring_rsp_wait+0x50>
+  801e8c:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e8f:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e92:	39 c2                	cmp    %eax,%edx
+  801e94:	75 23                	jne    801eb9 <ipcring_rsp_wait+0x41>
+  801e96:	83 ec 08             	sub    $0x8,%esp
+  801e99:	6a 00                	push   $0x0
+  801e9b:	6a 00                	push   $0x0
+  801e9d:	6a 00                	push   $0x0
+  801e9f:	6a 00                	push   $0x0
+  801ea1:	ff 73 0c             	push   0xc(%ebx)
+  801ea4:	ff 73 04             	push   0x4(%ebx)
+  801ea7:	e8 cb 0e 00 00       	call   802d77 <ipc_call>
+  801eac:	8b 53 14             	mov    0x14(%ebx),%edx
+  801eaf:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eb2:	83 c4 20             	add    $0x20,%esp
+  801eb5:	39 c2                	cmp    %eax,%edx
+  801eb7:	74 dd                	je     801e96 <ipcring_rsp_wait+0x1e>
+  801eb9:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ebc:	83 e0 07             	and    $0x7,%eax
+  801ebf:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801ec3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec6:	c9                   	leave
+  801ec7:	c3                   	ret
+  801ec8:	68 b8 32 80 00       	push   $0x8032b8
+  801ecd:	68 69 32 80 00       	push   $0x803269
+  801ed2:	6a 3b                	push   $0x3b
+  801ed4:	68 d9 32 80 00       	push   $0x8032d9
+  801ed9:	e8 97 02 00 00       	call   802175 <_panic>
+
+00801ede <ipcring_rsp_pop>:
+  801ede:	55                   	push   %ebp
+  801edf:	89 e5                	mov    %esp,%ebp
+  801ee1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee4:	8b 42 18             	mov    0x18(%edx),%eax
+  801ee7:	83 c0 01             	add    $0x1,%eax
+  801eea:	89 42 18             	mov    %eax,0x18(%edx)
+  801eed:	5d                   	pop    %ebp
+  801eee:	c3                   	ret
+
+00801eef <ipcring_server_init>:
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ef8:	89 10                	mov    %edx,(%eax)
+  801efa:	8b 55 10             	mov    0x10(%ebp),%edx
+  801efd:	89 50 04             	mov    %edx,0x4(%eax)
+  801f00:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801f07:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f0e:	5d                   	pop    %ebp
+  801f0f:	c3                   	ret
+
+00801f10 <ipcring_req_avail>:
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f16:	8b 02                	mov    (%edx),%eax
+  801f18:	8b 40 10             	mov    0x10(%eax),%eax
+  801f1b:	2b 42 08             	sub    0x8(%edx),%eax
+  801f1e:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f23:	39 d0                	cmp    %edx,%eax
+  801f25:	0f 47 c2             	cmova  %edx,%eax
+  801f28:	5d                   	pop    %ebp
+  801f29:	c3                   	ret
+
+00801f2a <ipcring_req_peek>:
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f30:	8b 42 08             	mov    0x8(%edx),%eax
+  801f33:	83 e0 07             	and    $0x7,%eax
+  801f36:	8b 12                	mov    (%edx),%edx
+  801f38:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f3c:	5d                   	pop    %ebp
+  801f3d:	c3                   	ret
+
+00801f3e <ipcring_rsp_push>:
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	83 ec 08             	sub    $0x8,%esp
+  801f44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f47:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f4a:	83 c0 01             	add    $0x1,%eax
+  801f4d:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f50:	8b 11                	mov    (%ecx),%edx
+  801f52:	83 c2 14             	add    $0x14,%edx
+  801f55:	f0 87 02             	lock xchg %eax,(%edx)
+  801f58:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f5c:	75 02                	jne    801f60 <ipcring_rsp_push+0x22>
+  801f5e:	c9                   	leave
+  801f5f:	c3                   	ret
+  801f60:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f67:	6a 00                	push   $0x0
+  801f69:	68 00 00 80 ee       	push   $0xee800000
+  801f6e:	6a 00                	push   $0x0
+  801f70:	ff 71 04             	push   0x4(%ecx)
+  801f73:	e8 8b e4 ff ff       	call   800403 <sys_ipc_try_send>
+  801f78:	83 c4 10             	add    $0x10,%esp
+  801f7b:	eb e1                	jmp    801f5e <ipcring_rsp_push+0x20>
+
+00801f7d <ipcring_client_wait>:
+  801f7d:	55                   	push   %ebp
+  801f7e:	89 e5                	mov    %esp,%ebp
+  801f80:	83 ec 08             	sub    $0x8,%esp
+  801f83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f86:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801f8d:	8b 10                	mov    (%eax),%edx
+  801f8f:	8b 52 18             	mov    0x18(%edx),%edx
+  801f92:	3b 50 08             	cmp    0x8(%eax),%edx
+  801f95:	75 02                	jne    801f99 <ipcring_client_wait+0x1c>
+  801f97:	c9                   	leave
+  801f98:	c3                   	ret
+  801f99:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801fa0:	6a 00                	push   $0x0
+  801fa2:	68 00 00 80 ee       	push   $0xee800000
+  801fa7:	6a 00                	push   $0x0
+  801fa9:	ff 70 04             	push   0x4(%eax)
+  801fac:	e8 52 e4 ff ff       	call   800403 <sys_ipc_try_send>
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  801fb4:	eb e1                	jmp    801f97 <ipcring_client_wait+0x1a>
+
+00801fb6 <ipcring_server_sleep>:
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	53                   	push   %ebx
+  801fba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fbd:	8b 01                	mov    (%ecx),%eax
+  801fbf:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fc7:	f0 87 02             	lock xchg %eax,(%edx)
+  801fca:	8b 11                	mov    (%ecx),%edx
+  801fcc:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fcf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fd4:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801fd7:	74 0e                	je     801fe7 <ipcring_server_sleep+0x31>
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fde:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fea:	c9                   	leave
+  801feb:	c3                   	ret
+
+00801fec <devcons_close>:
+  801fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff1:	c3                   	ret
+
+00801ff2 <devcons_stat>:
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	83 ec 10             	sub    $0x10,%esp
+  801ff8:	68 e7 32 80 00       	push   $0x8032e7
+  801ffd:	ff 75 0c             	push   0xc(%ebp)
+  802000:	e8 42 09 00 00       	call   802947 <strcpy>
+  802005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200a:	c9                   	leave
+  80200b:	c3                   	ret
+
+0080200c <devcons_write>:
+  80200c:	55                   	push   %ebp
+  80200d:	89 e5                	mov    %esp,%ebp
+  80200f:	57                   	push   %edi
+  802010:	56                   	push   %esi
+  802011:	53                   	push   %ebx
+  802012:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802018:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80201b:	85 ff                	test   %edi,%edi
+  80201d:	74 51                	je     802070 <devcons_write+0x64>
+  80201f:	be 00 00 00 00       	mov    $0x0,%esi
+  802024:	b8 00 00 00 00       	mov    $0x0,%eax
+  802029:	89 fb                	mov    %edi,%ebx
+  80202b:	29 c3                	sub    %eax,%ebx
+  80202d:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802032:	39 d3                	cmp    %edx,%ebx
+  802034:	0f 47 da             	cmova  %edx,%ebx
+  802037:	83 ec 04             	sub    $0x4,%esp
+  80203a:	53                   	push   %ebx
+  80203b:	03 45 0c             	add    0xc(%ebp),%eax
+  80203e:	50                   	push   %eax
+  80203f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802045:	50                   	push   %eax
+  802046:	e8 ac 0a 00 00       	call   802af7 <memmove>
+  80204b:	83 c4 08             	add    $0x8,%esp
+  80204e:	53                   	push   %ebx
+  80204f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802055:	50                   	push   %eax
+  802056:	e8 65 e0 ff ff       	call   8000c0 <sys_cputs>
+  80205b:	01 de                	add    %ebx,%esi
+  80205d:	89 f0                	mov    %esi,%eax
+  80205f:	83 c4 10             	add    $0x10,%esp
+  802062:	39 fe                	cmp    %edi,%esi
+  802064:	72 c3                	jb     802029 <devcons_write+0x1d>
+  802066:	89 f0                	mov    %esi,%eax
+  802068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206b:	5b                   	pop    %ebx
+  80206c:	5e                   	pop    %esi
+  80206d:	5f                   	pop    %edi
+  80206e:	5d                   	pop    %ebp
+  80206f:	c3                   	ret
+  802070:	be 00 00 00 00       	mov    $0x0,%esi
+  802075:	eb ef                	jmp    802066 <devcons_write+0x5a>
+
+00802077 <devcons_read>:
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	83 ec 08             	sub    $0x8,%esp
+  80207d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802082:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802086:	75 07                	jne    80208f <devcons_read+0x18>
+  802088:	eb 1f                	jmp    8020a9 <devcons_read+0x32>
+  80208a:	e8 ce e0 ff ff       	call   80015d <sys_yield>
+  80208f:	e8 4a e0 ff ff       	call   8000de <sys_cgetc>
+  802094:	85 c0                	test   %eax,%eax
+  802096:	74 f2                	je     80208a <devcons_read+0x13>
+  802098:	78 0f                	js     8020a9 <devcons_read+0x32>
+  80209a:	83 f8 04             	cmp    $0x4,%eax
+  80209d:	74 0c                	je     8020ab <devcons_read+0x34>
+  80209f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020a2:	88 02                	mov    %al,(%edx)
+  8020a4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020a9:	c9                   	leave
+  8020aa:	c3                   	ret
+  8020ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b0:	eb f7                	jmp    8020a9 <devcons_read+0x32>
+
+008020b2 <cputchar>:
+  8020b2:	55                   	push   %ebp
+  8020b3:	89 e5                	mov    %esp,%ebp
+  8020b5:	83 ec 20             	sub    $0x20,%esp
+  8020b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bb:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020be:	6a 01                	push   $0x1
+  8020c0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020c3:	50                   	push   %eax
+  8020c4:	e8 f7 df ff ff       	call   8000c0 <sys_cputs>
+  8020c9:	83 c4 10             	add    $0x10,%esp
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+008020ce <getchar>:
+  8020ce:	55                   	push   %ebp
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	83 ec 1c             	sub    $0x1c,%esp
+  8020d4:	6a 01                	push   $0x1
+  8020d6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020d9:	50                   	push   %eax
+  8020da:	6a 00                	push   $0x0
+  8020dc:	e8 0e ec ff ff       	call   800cef <read>
+  8020e1:	83 c4 10             	add    $0x10,%esp
+  8020e4:	85 c0                	test   %eax,%eax
+  8020e6:	78 06                	js     8020ee <getchar+0x20>
+  8020e8:	74 06                	je     8020f0 <getchar+0x22>
+  8020ea:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8020ee:	c9                   	leave
+  8020ef:	c3                   	ret
+  8020f0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020f5:	eb f7                	jmp    8020ee <getchar+0x20>
+
+008020f7 <iscons>:
+  8020f7:	55                   	push   %ebp
+  8020f8:	89 e5                	mov    %esp,%ebp
+  8020fa:	83 ec 20             	sub    $0x20,%esp
+  8020fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802100:	50                   	push   %eax
+  802101:	ff 75 08             	push   0x8(%ebp)
+  802104:	e8 84 e9 ff ff       	call   800a8d <fd_lookup>
+  802109:	83 c4 10             	add    $0x10,%esp
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	78 11                	js     802121 <iscons+0x2a>
+  802110:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802113:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802119:	39 10                	cmp    %edx,(%eax)
+  80211b:	0f 94 c0             	sete   %al
+  80211e:	0f b6 c0             	movzbl %al,%eax
+  802121:	c9                   	leave
+  802122:	c3                   	ret
+
+00802123 <opencons>:
+  802123:	55                   	push   %ebp
+  802124:	89 e5                	mov    %esp,%ebp
+  802126:	83 ec 24             	sub    $0x24,%esp
+  802129:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212c:	50                   	push   %eax
+  80212d:	e8 0b e9 ff ff       	call   800a3d <fd_alloc>
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 3a                	js     802173 <opencons+0x50>
+  802139:	83 ec 04             	sub    $0x4,%esp
+  80213c:	68 07 04 00 00       	push   $0x407
+  802141:	ff 75 f4             	push   -0xc(%ebp)
+  802144:	6a 00                	push   $0x0
+  802146:	e8 5d e0 ff ff       	call   8001a8 <sys_page_alloc>
+  80214b:	83 c4 10             	add    $0x10,%esp
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 21                	js     802173 <opencons+0x50>
+  802152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802155:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80215b:	89 10                	mov    %edx,(%eax)
+  80215d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802160:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802167:	83 ec 0c             	sub    $0xc,%esp
+  80216a:	50                   	push   %eax
+  80216b:	e8 a6 e8 ff ff       	call   800a16 <fd2num>
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	c9                   	leave
+  802174:	c3                   	ret
+
+00802175 <_panic>:
+  802175:	55                   	push   %ebp
+  802176:	89 e5                	mov    %esp,%ebp
+  802178:	56                   	push   %esi
+  802179:	53                   	push   %ebx
+  80217a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80217d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802183:	e8 b6 df ff ff       	call   80013e <sys_getenvid>
+  802188:	83 ec 0c             	sub    $0xc,%esp
+  80218b:	ff 75 0c             	push   0xc(%ebp)
+  80218e:	ff 75 08             	push   0x8(%ebp)
+  802191:	56                   	push   %esi
+  802192:	50                   	push   %eax
+  802193:	68 f4 32 80 00       	push   $0x8032f4
+  802198:	e8 b3 00 00 00       	call   802250 <cprintf>
+  80219d:	83 c4 18             	add    $0x18,%esp
+  8021a0:	53                   	push   %ebx
+  8021a1:	ff 75 10             	push   0x10(%ebp)
+  8021a4:	e8 56 00 00 00       	call   8021ff <vcprintf>
+  8021a9:	c7 04 24 ae 32 80 00 	movl   $0x8032ae,(%esp)
+  8021b0:	e8 9b 00 00 00       	call   802250 <cprintf>
+  8021b5:	83 c4 10             	add    $0x10,%esp
+  8021b8:	cc                   	int3
+  8021b9:	eb fd                	jmp    8021b8 <_panic+0x43>
+
+008021bb <putch>:
+  8021bb:	55                   	push   %ebp
+  8021bc:	89 e5                	mov    %esp,%ebp
+  8021be:	53                   	push   %ebx
+  8021bf:	83 ec 04             	sub    $0x4,%esp
+  8021c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021c5:	8b 13                	mov    (%ebx),%edx
+  8021c7:	8d 42 01             	lea    0x1(%edx),%eax
+  8021ca:	89 03                	mov    %eax,(%ebx)
+  8021cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021d3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021d8:	74 09                	je     8021e3 <putch+0x28>
+  8021da:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e1:	c9                   	leave
+  8021e2:	c3                   	ret
+  8021e3:	83 ec 08             	sub    $0x8,%esp
+  8021e6:	68 ff 00 00 00       	push   $0xff
+  8021eb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8021ee:	50                   	push   %eax
+  8021ef:	e8 cc de ff ff       	call   8000c0 <sys_cputs>
+  8021f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8021fa:	83 c4 10             	add    $0x10,%esp
+  8021fd:	eb db                	jmp    8021da <putch+0x1f>
+
+008021ff <vcprintf>:
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+  802202:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802208:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80220f:	00 00 00 
+  802212:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802219:	00 00 00 
+  80221c:	ff 75 0c             	push   0xc(%ebp)
+  80221f:	ff 75 08             	push   0x8(%ebp)
+  802222:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802228:	50                   	push   %eax
+  802229:	68 bb 21 80 00       	push   $0x8021bb
+  80222e:	e8 1c 01 00 00       	call   80234f <vprintfmt>
+  802233:	83 c4 08             	add    $0x8,%esp
+  802236:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80223c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802242:	50                   	push   %eax
+  802243:	e8 78 de ff ff       	call   8000c0 <sys_cputs>
+  802248:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80224e:	c9                   	leave
+  80224f:	c3                   	ret
+
+00802250 <cprintf>:
+  802250:	55                   	push   %ebp
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	83 ec 10             	sub    $0x10,%esp
+  802256:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802259:	50                   	push   %eax
+  80225a:	ff 75 08             	push   0x8(%ebp)
+  80225d:	e8 9d ff ff ff       	call   8021ff <vcprintf>
+  802262:	c9                   	leave
+  802263:	c3                   	ret
+
+00802264 <printnum>:
+  802264:	55                   	push   %ebp
+  802265:	89 e5                	mov    %esp,%ebp
+  802267:	57                   	push   %edi
+  802268:	56                   	push   %esi
+  802269:	53                   	push   %ebx
+  80226a:	83 ec 1c             	sub    $0x1c,%esp
+  80226d:	89 c3                	mov    %eax,%ebx
+  80226f:	89 d6                	mov    %edx,%esi
+  802271:	8b 45 08             	mov    0x8(%ebp),%eax
+  802274:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802277:	89 d1                	mov    %edx,%ecx
+  802279:	89 c2                	mov    %eax,%edx
+  80227b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80227e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802281:	8b 45 10             	mov    0x10(%ebp),%eax
+  802284:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802287:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80228e:	39 c2                	cmp    %eax,%edx
+  802290:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802293:	73 4b                	jae    8022e0 <printnum+0x7c>
+  802295:	8b 45 14             	mov    0x14(%ebp),%eax
+  802298:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80229b:	85 ff                	test   %edi,%edi
+  80229d:	7e 11                	jle    8022b0 <printnum+0x4c>
+  80229f:	83 ec 08             	sub    $0x8,%esp
+  8022a2:	56                   	push   %esi
+  8022a3:	ff 75 18             	push   0x18(%ebp)
+  8022a6:	ff d3                	call   *%ebx
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	83 ef 01             	sub    $0x1,%edi
+  8022ae:	75 ef                	jne    80229f <printnum+0x3b>
+  8022b0:	83 ec 08             	sub    $0x8,%esp
+  8022b3:	56                   	push   %esi
+  8022b4:	83 ec 04             	sub    $0x4,%esp
+  8022b7:	ff 75 e4             	push   -0x1c(%ebp)
+  8022ba:	ff 75 e0             	push   -0x20(%ebp)
+  8022bd:	ff 75 dc             	push   -0x24(%ebp)
+  8022c0:	ff 75 d8             	push   -0x28(%ebp)
+  8022c3:	e8 9b 0d 00 00       	call   803063 <__umoddi3>
+  8022c8:	83 c4 14             	add    $0x14,%esp
+  8022cb:	0f be 80 17 33 80 00 	movsbl 0x803317(%eax),%eax
+  8022d2:	50                   	push   %eax
+  8022d3:	ff d3                	call   *%ebx
+  8022d5:	83 c4 10             	add    $0x10,%esp
+  8022d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022db:	5b                   	pop    %ebx
+  8022dc:	5e                   	pop    %esi
+  8022dd:	5f                   	pop    %edi
+  8022de:	5d                   	pop    %ebp
+  8022df:	c3                   	ret
+  8022e0:	83 ec 0c             	sub    $0xc,%esp
+  8022e3:	ff 75 18             	push   0x18(%ebp)
+  8022e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022e9:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8022ec:	52                   	push   %edx
+  8022ed:	50                   	push   %eax
+  8022ee:	83 ec 08             	sub    $0x8,%esp
+  8022f1:	ff 75 e4             	push   -0x1c(%ebp)
+  8022f4:	ff 75 e0             	push   -0x20(%ebp)
+  8022f7:	ff 75 dc             	push   -0x24(%ebp)
+  8022fa:	ff 75 d8             	push   -0x28(%ebp)
+  8022fd:	e8 43 0d 00 00       	call   803045 <__udivdi3>
+  802302:	83 c4 18             	add    $0x18,%esp
+  802305:	52                   	push   %edx
+  802306:	50                   	push   %eax
+  802307:	89 f2                	mov    %esi,%edx
+  802309:	89 d8                	mov    %ebx,%eax
+  80230b:	e8 54 ff ff ff       	call   802264 <printnum>
+  802310:	83 c4 20             	add    $0x20,%esp
+  802313:	eb 9b                	jmp    8022b0 <printnum+0x4c>
+
+00802315 <sprintputch>:
+  802315:	55                   	push   %ebp
+  802316:	89 e5                	mov    %esp,%ebp
+  802318:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80231f:	8b 10                	mov    (%eax),%edx
+  802321:	3b 50 04             	cmp    0x4(%eax),%edx
+  802324:	73 0a                	jae    802330 <sprintputch+0x1b>
+  802326:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802329:	89 08                	mov    %ecx,(%eax)
+  80232b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232e:	88 02                	mov    %al,(%edx)
+  802330:	5d                   	pop    %ebp
+  802331:	c3                   	ret
+
+00802332 <printfmt>:
+  802332:	55                   	push   %ebp
+  802333:	89 e5                	mov    %esp,%ebp
+  802335:	83 ec 08             	sub    $0x8,%esp
+  802338:	8d 45 14             	lea    0x14(%ebp),%eax
+  80233b:	50                   	push   %eax
+  80233c:	ff 75 10             	push   0x10(%ebp)
+  80233f:	ff 75 0c             	push   0xc(%ebp)
+  802342:	ff 75 08             	push   0x8(%ebp)
+  802345:	e8 05 00 00 00       	call   80234f <vprintfmt>
+  80234a:	83 c4 10             	add    $0x10,%esp
+  80234d:	c9                   	leave
+  80234e:	c3                   	ret
+
+0080234f <vprintfmt>:
+  80234f:	55                   	push   %ebp
+  802350:	89 e5                	mov    %esp,%ebp
+  802352:	57                   	push   %edi
+  802353:	56                   	push   %esi
+  802354:	53                   	push   %ebx
+  802355:	83 ec 2c             	sub    $0x2c,%esp
+  802358:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80235b:	89 df                	mov    %ebx,%edi
+  80235d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802360:	8b 45 10             	mov    0x10(%ebp),%eax
+  802363:	8d 70 01             	lea    0x1(%eax),%esi
+  802366:	0f b6 00             	movzbl (%eax),%eax
+  802369:	83 f8 25             	cmp    $0x25,%eax
+  80236c:	74 1e                	je     80238c <vprintfmt+0x3d>
+  80236e:	85 c0                	test   %eax,%eax
+  802370:	0f 84 15 05 00 00    	je     80288b <vprintfmt+0x53c>
+  802376:	83 ec 08             	sub    $0x8,%esp
+  802379:	53                   	push   %ebx
+  80237a:	50                   	push   %eax
+  80237b:	ff d7                	call   *%edi
+  80237d:	83 c6 01             	add    $0x1,%esi
+  802380:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802384:	83 c4 10             	add    $0x10,%esp
+  802387:	83 f8 25             	cmp    $0x25,%eax
+  80238a:	75 e2                	jne    80236e <vprintfmt+0x1f>
+  80238c:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  802390:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  802397:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80239e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8023a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023aa:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8023ad:	8d 56 01             	lea    0x1(%esi),%edx
+  8023b0:	0f b6 0e             	movzbl (%esi),%ecx
+  8023b3:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023b6:	3c 55                	cmp    $0x55,%al
+  8023b8:	0f 87 3b 04 00 00    	ja     8027f9 <vprintfmt+0x4aa>
+  8023be:	0f b6 c0             	movzbl %al,%eax
+  8023c1:	ff 24 85 60 34 80 00 	jmp    *0x803460(,%eax,4)
+  8023c8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023cb:	eb 93                	jmp    802360 <vprintfmt+0x11>
+  8023cd:	89 d6                	mov    %edx,%esi
+  8023cf:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023d3:	eb d8                	jmp    8023ad <vprintfmt+0x5e>
+  8023d5:	89 d6                	mov    %edx,%esi
+  8023d7:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023db:	eb d0                	jmp    8023ad <vprintfmt+0x5e>
+  8023dd:	0f b6 c9             	movzbl %cl,%ecx
+  8023e0:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8023e3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023e6:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8023ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8023ed:	83 f9 09             	cmp    $0x9,%ecx
+  8023f0:	77 6f                	ja     802461 <vprintfmt+0x112>
+  8023f2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8023f5:	83 c2 01             	add    $0x1,%edx
+  8023f8:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8023fb:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8023ff:	0f be 02             	movsbl (%edx),%eax
+  802402:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802405:	83 fe 09             	cmp    $0x9,%esi
+  802408:	76 eb                	jbe    8023f5 <vprintfmt+0xa6>
+  80240a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80240d:	89 d6                	mov    %edx,%esi
+  80240f:	eb 13                	jmp    802424 <vprintfmt+0xd5>
+  802411:	8b 45 14             	mov    0x14(%ebp),%eax
+  802414:	8b 00                	mov    (%eax),%eax
+  802416:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802419:	8b 45 14             	mov    0x14(%ebp),%eax
+  80241c:	8d 40 04             	lea    0x4(%eax),%eax
+  80241f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802422:	89 d6                	mov    %edx,%esi
+  802424:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802428:	79 83                	jns    8023ad <vprintfmt+0x5e>
+  80242a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80242d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802430:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802437:	e9 71 ff ff ff       	jmp    8023ad <vprintfmt+0x5e>
+  80243c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80243f:	85 c9                	test   %ecx,%ecx
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	0f 49 c1             	cmovns %ecx,%eax
+  802449:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80244c:	89 d6                	mov    %edx,%esi
+  80244e:	e9 5a ff ff ff       	jmp    8023ad <vprintfmt+0x5e>
+  802453:	89 d6                	mov    %edx,%esi
+  802455:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80245c:	e9 4c ff ff ff       	jmp    8023ad <vprintfmt+0x5e>
+  802461:	89 d6                	mov    %edx,%esi
+  802463:	eb bf                	jmp    802424 <vprintfmt+0xd5>
+  802465:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802469:	89 d6                	mov    %edx,%esi
+  80246b:	e9 3d ff ff ff       	jmp    8023ad <vprintfmt+0x5e>
+  802470:	89 55 10             	mov    %edx,0x10(%ebp)
+  802473:	8b 45 14             	mov    0x14(%ebp),%eax
+  802476:	8d 70 04             	lea    0x4(%eax),%esi
+  802479:	83 ec 08             	sub    $0x8,%esp
+  80247c:	53                   	push   %ebx
+  80247d:	ff 30                	push   (%eax)
+  80247f:	ff d7                	call   *%edi
+  802481:	83 c4 10             	add    $0x10,%esp
+  802484:	89 75 14             	mov    %esi,0x14(%ebp)
+  802487:	e9 d4 fe ff ff       	jmp    802360 <vprintfmt+0x11>
+  80248c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80248f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802492:	8d 70 04             	lea    0x4(%eax),%esi
+  802495:	8b 10                	mov    (%eax),%edx
+  802497:	89 d0                	mov    %edx,%eax
+  802499:	f7 d8                	neg    %eax
+  80249b:	0f 48 c2             	cmovs  %edx,%eax
+  80249e:	83 f8 12             	cmp    $0x12,%eax
+  8024a1:	7f 23                	jg     8024c6 <vprintfmt+0x177>
+  8024a3:	8b 14 85 c0 35 80 00 	mov    0x8035c0(,%eax,4),%edx
+  8024aa:	85 d2                	test   %edx,%edx
+  8024ac:	74 18                	je     8024c6 <vprintfmt+0x177>
+  8024ae:	52                   	push   %edx
+  8024af:	68 7b 32 80 00       	push   $0x80327b
+  8024b4:	53                   	push   %ebx
+  8024b5:	57                   	push   %edi
+  8024b6:	e8 77 fe ff ff       	call   802332 <printfmt>
+  8024bb:	83 c4 10             	add    $0x10,%esp
+  8024be:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024c1:	e9 9a fe ff ff       	jmp    802360 <vprintfmt+0x11>
+  8024c6:	50                   	push   %eax
+  8024c7:	68 2f 33 80 00       	push   $0x80332f
+  8024cc:	53                   	push   %ebx
+  8024cd:	57                   	push   %edi
+  8024ce:	e8 5f fe ff ff       	call   802332 <printfmt>
+  8024d3:	83 c4 10             	add    $0x10,%esp
+  8024d6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024d9:	e9 82 fe ff ff       	jmp    802360 <vprintfmt+0x11>
+  8024de:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e4:	83 c0 04             	add    $0x4,%eax
+  8024e7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8024ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ed:	8b 00                	mov    (%eax),%eax
+  8024ef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	0f 84 61 03 00 00    	je     80285b <vprintfmt+0x50c>
+  8024fa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8024fe:	7e 06                	jle    802506 <vprintfmt+0x1b7>
+  802500:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802504:	75 29                	jne    80252f <vprintfmt+0x1e0>
+  802506:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802509:	8d 70 01             	lea    0x1(%eax),%esi
+  80250c:	0f b6 00             	movzbl (%eax),%eax
+  80250f:	0f be d0             	movsbl %al,%edx
+  802512:	85 d2                	test   %edx,%edx
+  802514:	0f 84 bb 00 00 00    	je     8025d5 <vprintfmt+0x286>
+  80251a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80251d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802520:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802523:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802526:	eb 7a                	jmp    8025a2 <vprintfmt+0x253>
+  802528:	c7 45 d0 28 33 80 00 	movl   $0x803328,-0x30(%ebp)
+  80252f:	83 ec 08             	sub    $0x8,%esp
+  802532:	ff 75 d4             	push   -0x2c(%ebp)
+  802535:	ff 75 d0             	push   -0x30(%ebp)
+  802538:	e8 e0 03 00 00       	call   80291d <strnlen>
+  80253d:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802540:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802543:	83 c4 10             	add    $0x10,%esp
+  802546:	85 d2                	test   %edx,%edx
+  802548:	0f 8e d6 02 00 00    	jle    802824 <vprintfmt+0x4d5>
+  80254e:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802552:	83 ec 08             	sub    $0x8,%esp
+  802555:	53                   	push   %ebx
+  802556:	56                   	push   %esi
+  802557:	ff d7                	call   *%edi
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802560:	75 f0                	jne    802552 <vprintfmt+0x203>
+  802562:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802565:	8d 70 01             	lea    0x1(%eax),%esi
+  802568:	0f b6 00             	movzbl (%eax),%eax
+  80256b:	0f be d0             	movsbl %al,%edx
+  80256e:	85 d2                	test   %edx,%edx
+  802570:	0f 84 da 02 00 00    	je     802850 <vprintfmt+0x501>
+  802576:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802579:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80257c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80257f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802582:	eb 1e                	jmp    8025a2 <vprintfmt+0x253>
+  802584:	83 ec 08             	sub    $0x8,%esp
+  802587:	ff 75 0c             	push   0xc(%ebp)
+  80258a:	52                   	push   %edx
+  80258b:	ff 55 08             	call   *0x8(%ebp)
+  80258e:	83 c4 10             	add    $0x10,%esp
+  802591:	83 eb 01             	sub    $0x1,%ebx
+  802594:	83 c6 01             	add    $0x1,%esi
+  802597:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80259b:	0f be d0             	movsbl %al,%edx
+  80259e:	85 d2                	test   %edx,%edx
+  8025a0:	74 2a                	je     8025cc <vprintfmt+0x27d>
+  8025a2:	85 ff                	test   %edi,%edi
+  8025a4:	78 05                	js     8025ab <vprintfmt+0x25c>
+  8025a6:	83 ef 01             	sub    $0x1,%edi
+  8025a9:	78 59                	js     802604 <vprintfmt+0x2b5>
+  8025ab:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8025af:	74 d3                	je     802584 <vprintfmt+0x235>
+  8025b1:	0f be c0             	movsbl %al,%eax
+  8025b4:	83 e8 20             	sub    $0x20,%eax
+  8025b7:	83 f8 5e             	cmp    $0x5e,%eax
+  8025ba:	76 c8                	jbe    802584 <vprintfmt+0x235>
+  8025bc:	83 ec 08             	sub    $0x8,%esp
+  8025bf:	ff 75 0c             	push   0xc(%ebp)
+  8025c2:	6a 3f                	push   $0x3f
+  8025c4:	ff 55 08             	call   *0x8(%ebp)
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	eb c5                	jmp    802591 <vprintfmt+0x242>
+  8025cc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025d5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025d8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025dc:	7e 1b                	jle    8025f9 <vprintfmt+0x2aa>
+  8025de:	83 ec 08             	sub    $0x8,%esp
+  8025e1:	53                   	push   %ebx
+  8025e2:	6a 20                	push   $0x20
+  8025e4:	ff d7                	call   *%edi
+  8025e6:	83 c4 10             	add    $0x10,%esp
+  8025e9:	83 ee 01             	sub    $0x1,%esi
+  8025ec:	75 f0                	jne    8025de <vprintfmt+0x28f>
+  8025ee:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025f4:	e9 67 fd ff ff       	jmp    802360 <vprintfmt+0x11>
+  8025f9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025ff:	e9 5c fd ff ff       	jmp    802360 <vprintfmt+0x11>
+  802604:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802607:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80260a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80260d:	eb c6                	jmp    8025d5 <vprintfmt+0x286>
+  80260f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802612:	89 55 10             	mov    %edx,0x10(%ebp)
+  802615:	83 f9 01             	cmp    $0x1,%ecx
+  802618:	7f 1f                	jg     802639 <vprintfmt+0x2ea>
+  80261a:	85 c9                	test   %ecx,%ecx
+  80261c:	74 67                	je     802685 <vprintfmt+0x336>
+  80261e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802621:	8b 30                	mov    (%eax),%esi
+  802623:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802626:	89 f0                	mov    %esi,%eax
+  802628:	c1 f8 1f             	sar    $0x1f,%eax
+  80262b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80262e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802631:	8d 40 04             	lea    0x4(%eax),%eax
+  802634:	89 45 14             	mov    %eax,0x14(%ebp)
+  802637:	eb 17                	jmp    802650 <vprintfmt+0x301>
+  802639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80263c:	8b 50 04             	mov    0x4(%eax),%edx
+  80263f:	8b 00                	mov    (%eax),%eax
+  802641:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802644:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264a:	8d 40 08             	lea    0x8(%eax),%eax
+  80264d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802650:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802653:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802656:	be 0a 00 00 00       	mov    $0xa,%esi
+  80265b:	85 c9                	test   %ecx,%ecx
+  80265d:	0f 89 12 01 00 00    	jns    802775 <vprintfmt+0x426>
+  802663:	83 ec 08             	sub    $0x8,%esp
+  802666:	53                   	push   %ebx
+  802667:	6a 2d                	push   $0x2d
+  802669:	ff d7                	call   *%edi
+  80266b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80266e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802671:	f7 da                	neg    %edx
+  802673:	83 d1 00             	adc    $0x0,%ecx
+  802676:	f7 d9                	neg    %ecx
+  802678:	83 c4 10             	add    $0x10,%esp
+  80267b:	be 0a 00 00 00       	mov    $0xa,%esi
+  802680:	e9 f0 00 00 00       	jmp    802775 <vprintfmt+0x426>
+  802685:	8b 45 14             	mov    0x14(%ebp),%eax
+  802688:	8b 30                	mov    (%eax),%esi
+  80268a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80268d:	89 f0                	mov    %esi,%eax
+  80268f:	c1 f8 1f             	sar    $0x1f,%eax
+  802692:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802695:	8b 45 14             	mov    0x14(%ebp),%eax
+  802698:	8d 40 04             	lea    0x4(%eax),%eax
+  80269b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80269e:	eb b0                	jmp    802650 <vprintfmt+0x301>
+  8026a0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026a3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026a6:	83 f9 01             	cmp    $0x1,%ecx
+  8026a9:	7f 1e                	jg     8026c9 <vprintfmt+0x37a>
+  8026ab:	85 c9                	test   %ecx,%ecx
+  8026ad:	74 32                	je     8026e1 <vprintfmt+0x392>
+  8026af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026b2:	8b 10                	mov    (%eax),%edx
+  8026b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8026bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026bf:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026c4:	e9 ac 00 00 00       	jmp    802775 <vprintfmt+0x426>
+  8026c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026cc:	8b 10                	mov    (%eax),%edx
+  8026ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8026d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026d7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026dc:	e9 94 00 00 00       	jmp    802775 <vprintfmt+0x426>
+  8026e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026e4:	8b 10                	mov    (%eax),%edx
+  8026e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8026ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026f1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026f6:	eb 7d                	jmp    802775 <vprintfmt+0x426>
+  8026f8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026fb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026fe:	83 f9 01             	cmp    $0x1,%ecx
+  802701:	7f 1b                	jg     80271e <vprintfmt+0x3cf>
+  802703:	85 c9                	test   %ecx,%ecx
+  802705:	74 2c                	je     802733 <vprintfmt+0x3e4>
+  802707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80270a:	8b 10                	mov    (%eax),%edx
+  80270c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802711:	8d 40 04             	lea    0x4(%eax),%eax
+  802714:	89 45 14             	mov    %eax,0x14(%ebp)
+  802717:	be 08 00 00 00       	mov    $0x8,%esi
+  80271c:	eb 57                	jmp    802775 <vprintfmt+0x426>
+  80271e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802721:	8b 10                	mov    (%eax),%edx
+  802723:	8b 48 04             	mov    0x4(%eax),%ecx
+  802726:	8d 40 08             	lea    0x8(%eax),%eax
+  802729:	89 45 14             	mov    %eax,0x14(%ebp)
+  80272c:	be 08 00 00 00       	mov    $0x8,%esi
+  802731:	eb 42                	jmp    802775 <vprintfmt+0x426>
+  802733:	8b 45 14             	mov    0x14(%ebp),%eax
+  802736:	8b 10                	mov    (%eax),%edx
+  802738:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80273d:	8d 40 04             	lea    0x4(%eax),%eax
+  802740:	89 45 14             	mov    %eax,0x14(%ebp)
+  802743:	be 08 00 00 00       	mov    $0x8,%esi
+  802748:	eb 2b                	jmp    802775 <vprintfmt+0x426>
+  80274a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80274d:	83 ec 08             	sub    $0x8,%esp
+  802750:	53                   	push   %ebx
+  802751:	6a 30                	push   $0x30
+  802753:	ff d7                	call   *%edi
+  802755:	83 c4 08             	add    $0x8,%esp
+  802758:	53                   	push   %ebx
+  802759:	6a 78                	push   $0x78
+  80275b:	ff d7                	call   *%edi
+  80275d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802760:	8b 10                	mov    (%eax),%edx
+  802762:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802767:	83 c4 10             	add    $0x10,%esp
+  80276a:	8d 40 04             	lea    0x4(%eax),%eax
+  80276d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802770:	be 10 00 00 00       	mov    $0x10,%esi
+  802775:	83 ec 0c             	sub    $0xc,%esp
+  802778:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80277c:	50                   	push   %eax
+  80277d:	ff 75 e4             	push   -0x1c(%ebp)
+  802780:	56                   	push   %esi
+  802781:	51                   	push   %ecx
+  802782:	52                   	push   %edx
+  802783:	89 da                	mov    %ebx,%edx
+  802785:	89 f8                	mov    %edi,%eax
+  802787:	e8 d8 fa ff ff       	call   802264 <printnum>
+  80278c:	83 c4 20             	add    $0x20,%esp
+  80278f:	e9 cc fb ff ff       	jmp    802360 <vprintfmt+0x11>
+  802794:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802797:	89 55 10             	mov    %edx,0x10(%ebp)
+  80279a:	83 f9 01             	cmp    $0x1,%ecx
+  80279d:	7f 1b                	jg     8027ba <vprintfmt+0x46b>
+  80279f:	85 c9                	test   %ecx,%ecx
+  8027a1:	74 2c                	je     8027cf <vprintfmt+0x480>
+  8027a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027a6:	8b 10                	mov    (%eax),%edx
+  8027a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8027b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027b3:	be 10 00 00 00       	mov    $0x10,%esi
+  8027b8:	eb bb                	jmp    802775 <vprintfmt+0x426>
+  8027ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027bd:	8b 10                	mov    (%eax),%edx
+  8027bf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027c2:	8d 40 08             	lea    0x8(%eax),%eax
+  8027c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027c8:	be 10 00 00 00       	mov    $0x10,%esi
+  8027cd:	eb a6                	jmp    802775 <vprintfmt+0x426>
+  8027cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027d2:	8b 10                	mov    (%eax),%edx
+  8027d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8027dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027df:	be 10 00 00 00       	mov    $0x10,%esi
+  8027e4:	eb 8f                	jmp    802775 <vprintfmt+0x426>
+  8027e6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027e9:	83 ec 08             	sub    $0x8,%esp
+  8027ec:	53                   	push   %ebx
+  8027ed:	6a 25                	push   $0x25
+  8027ef:	ff d7                	call   *%edi
+  8027f1:	83 c4 10             	add    $0x10,%esp
+  8027f4:	e9 67 fb ff ff       	jmp    802360 <vprintfmt+0x11>
+  8027f9:	83 ec 08             	sub    $0x8,%esp
+  8027fc:	53                   	push   %ebx
+  8027fd:	6a 25                	push   $0x25
+  8027ff:	ff d7                	call   *%edi
+  802801:	83 c4 10             	add    $0x10,%esp
+  802804:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  802808:	0f 84 ba fb ff ff    	je     8023c8 <vprintfmt+0x79>
+  80280e:	89 75 10             	mov    %esi,0x10(%ebp)
+  802811:	89 f0                	mov    %esi,%eax
+  802813:	83 e8 01             	sub    $0x1,%eax
+  802816:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80281a:	75 f7                	jne    802813 <vprintfmt+0x4c4>
+  80281c:	89 45 10             	mov    %eax,0x10(%ebp)
+  80281f:	e9 3c fb ff ff       	jmp    802360 <vprintfmt+0x11>
+  802824:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802827:	8d 70 01             	lea    0x1(%eax),%esi
+  80282a:	0f b6 00             	movzbl (%eax),%eax
+  80282d:	0f be d0             	movsbl %al,%edx
+  802830:	85 d2                	test   %edx,%edx
+  802832:	74 11                	je     802845 <vprintfmt+0x4f6>
+  802834:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802837:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80283a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80283d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802840:	e9 5d fd ff ff       	jmp    8025a2 <vprintfmt+0x253>
+  802845:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802848:	89 45 14             	mov    %eax,0x14(%ebp)
+  80284b:	e9 10 fb ff ff       	jmp    802360 <vprintfmt+0x11>
+  802850:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802853:	89 45 14             	mov    %eax,0x14(%ebp)
+  802856:	e9 05 fb ff ff       	jmp    802360 <vprintfmt+0x11>
+  80285b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80285f:	7e 0a                	jle    80286b <vprintfmt+0x51c>
+  802861:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802865:	0f 85 bd fc ff ff    	jne    802528 <vprintfmt+0x1d9>
+  80286b:	ba 28 00 00 00       	mov    $0x28,%edx
+  802870:	b8 28 00 00 00       	mov    $0x28,%eax
+  802875:	be 29 33 80 00       	mov    $0x803329,%esi
+  80287a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80287d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802880:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802883:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802886:	e9 17 fd ff ff       	jmp    8025a2 <vprintfmt+0x253>
+  80288b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288e:	5b                   	pop    %ebx
+  80288f:	5e                   	pop    %esi
+  802890:	5f                   	pop    %edi
+  802891:	5d                   	pop    %ebp
+  802892:	c3                   	ret
+
+00802893 <vsnprintf>:
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	83 ec 18             	sub    $0x18,%esp
+  802899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80289f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8028a2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8028a6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8028a9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	74 26                	je     8028da <vsnprintf+0x47>
+  8028b4:	85 d2                	test   %edx,%edx
+  8028b6:	7e 22                	jle    8028da <vsnprintf+0x47>
+  8028b8:	ff 75 14             	push   0x14(%ebp)
+  8028bb:	ff 75 10             	push   0x10(%ebp)
+  8028be:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028c1:	50                   	push   %eax
+  8028c2:	68 15 23 80 00       	push   $0x802315
+  8028c7:	e8 83 fa ff ff       	call   80234f <vprintfmt>
+  8028cc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028cf:	c6 00 00             	movb   $0x0,(%eax)
+  8028d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028d5:	83 c4 10             	add    $0x10,%esp
+  8028d8:	c9                   	leave
+  8028d9:	c3                   	ret
+  8028da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028df:	eb f7                	jmp    8028d8 <vsnprintf+0x45>
+
+008028e1 <snprintf>:
+  8028e1:	55                   	push   %ebp
+  8028e2:	89 e5                	mov    %esp,%ebp
+  8028e4:	83 ec 08             	sub    $0x8,%esp
+  8028e7:	8d 45 14             	lea    0x14(%ebp),%eax
+  8028ea:	50                   	push   %eax
+  8028eb:	ff 75 10             	push   0x10(%ebp)
+  8028ee:	ff 75 0c             	push   0xc(%ebp)
+  8028f1:	ff 75 08             	push   0x8(%ebp)
+  8028f4:	e8 9a ff ff ff       	call   802893 <vsnprintf>
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+008028fb <strlen>:
+  8028fb:	55                   	push   %ebp
+  8028fc:	89 e5                	mov    %esp,%ebp
+  8028fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  802901:	80 3a 00             	cmpb   $0x0,(%edx)
+  802904:	74 10                	je     802916 <strlen+0x1b>
+  802906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290b:	83 c0 01             	add    $0x1,%eax
+  80290e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802912:	75 f7                	jne    80290b <strlen+0x10>
+  802914:	5d                   	pop    %ebp
+  802915:	c3                   	ret
+  802916:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291b:	eb f7                	jmp    802914 <strlen+0x19>
+
+0080291d <strnlen>:
+  80291d:	55                   	push   %ebp
+  80291e:	89 e5                	mov    %esp,%ebp
+  802920:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802923:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802926:	85 d2                	test   %edx,%edx
+  802928:	74 16                	je     802940 <strnlen+0x23>
+  80292a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802933:	74 09                	je     80293e <strnlen+0x21>
+  802935:	83 c0 01             	add    $0x1,%eax
+  802938:	39 d0                	cmp    %edx,%eax
+  80293a:	75 f3                	jne    80292f <strnlen+0x12>
+  80293c:	89 d0                	mov    %edx,%eax
+  80293e:	5d                   	pop    %ebp
+  80293f:	c3                   	ret
+  802940:	b8 00 00 00 00       	mov    $0x0,%eax
+  802945:	eb f7                	jmp    80293e <strnlen+0x21>
+
+00802947 <strcpy>:
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	53                   	push   %ebx
+  80294b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80294e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802951:	b8 00 00 00 00       	mov    $0x0,%eax
+  802956:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80295a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80295d:	83 c0 01             	add    $0x1,%eax
+  802960:	84 d2                	test   %dl,%dl
+  802962:	75 f2                	jne    802956 <strcpy+0xf>
+  802964:	89 c8                	mov    %ecx,%eax
+  802966:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802969:	c9                   	leave
+  80296a:	c3                   	ret
+
+0080296b <strcat>:
+  80296b:	55                   	push   %ebp
+  80296c:	89 e5                	mov    %esp,%ebp
+  80296e:	53                   	push   %ebx
+  80296f:	83 ec 10             	sub    $0x10,%esp
+  802972:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802975:	53                   	push   %ebx
+  802976:	e8 80 ff ff ff       	call   8028fb <strlen>
+  80297b:	83 c4 08             	add    $0x8,%esp
+  80297e:	ff 75 0c             	push   0xc(%ebp)
+  802981:	01 d8                	add    %ebx,%eax
+  802983:	50                   	push   %eax
+  802984:	e8 be ff ff ff       	call   802947 <strcpy>
+  802989:	89 d8                	mov    %ebx,%eax
+  80298b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298e:	c9                   	leave
+  80298f:	c3                   	ret
+
+00802990 <strncpy>:
+  802990:	55                   	push   %ebp
+  802991:	89 e5                	mov    %esp,%ebp
+  802993:	56                   	push   %esi
+  802994:	53                   	push   %ebx
+  802995:	8b 75 08             	mov    0x8(%ebp),%esi
+  802998:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80299b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80299e:	85 db                	test   %ebx,%ebx
+  8029a0:	74 17                	je     8029b9 <strncpy+0x29>
+  8029a2:	01 f3                	add    %esi,%ebx
+  8029a4:	89 f0                	mov    %esi,%eax
+  8029a6:	83 c0 01             	add    $0x1,%eax
+  8029a9:	0f b6 0a             	movzbl (%edx),%ecx
+  8029ac:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029af:	80 f9 01             	cmp    $0x1,%cl
+  8029b2:	83 da ff             	sbb    $0xffffffff,%edx
+  8029b5:	39 c3                	cmp    %eax,%ebx
+  8029b7:	75 ed                	jne    8029a6 <strncpy+0x16>
+  8029b9:	89 f0                	mov    %esi,%eax
+  8029bb:	5b                   	pop    %ebx
+  8029bc:	5e                   	pop    %esi
+  8029bd:	5d                   	pop    %ebp
+  8029be:	c3                   	ret
+
+008029bf <strlcpy>:
+  8029bf:	55                   	push   %ebp
+  8029c0:	89 e5                	mov    %esp,%ebp
+  8029c2:	56                   	push   %esi
+  8029c3:	53                   	push   %ebx
+  8029c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029cd:	89 f0                	mov    %esi,%eax
+  8029cf:	85 db                	test   %ebx,%ebx
+  8029d1:	74 1e                	je     8029f1 <strlcpy+0x32>
+  8029d3:	83 eb 01             	sub    $0x1,%ebx
+  8029d6:	74 16                	je     8029ee <strlcpy+0x2f>
+  8029d8:	01 f3                	add    %esi,%ebx
+  8029da:	0f b6 0a             	movzbl (%edx),%ecx
+  8029dd:	84 c9                	test   %cl,%cl
+  8029df:	74 0d                	je     8029ee <strlcpy+0x2f>
+  8029e1:	83 c2 01             	add    $0x1,%edx
+  8029e4:	83 c0 01             	add    $0x1,%eax
+  8029e7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029ea:	39 d8                	cmp    %ebx,%eax
+  8029ec:	75 ec                	jne    8029da <strlcpy+0x1b>
+  8029ee:	c6 00 00             	movb   $0x0,(%eax)
+  8029f1:	29 f0                	sub    %esi,%eax
+  8029f3:	5b                   	pop    %ebx
+  8029f4:	5e                   	pop    %esi
+  8029f5:	5d                   	pop    %ebp
+  8029f6:	c3                   	ret
+
+008029f7 <strcmp>:
+  8029f7:	55                   	push   %ebp
+  8029f8:	89 e5                	mov    %esp,%ebp
+  8029fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a00:	0f b6 01             	movzbl (%ecx),%eax
+  802a03:	84 c0                	test   %al,%al
+  802a05:	74 11                	je     802a18 <strcmp+0x21>
+  802a07:	38 02                	cmp    %al,(%edx)
+  802a09:	75 0d                	jne    802a18 <strcmp+0x21>
+  802a0b:	83 c1 01             	add    $0x1,%ecx
+  802a0e:	83 c2 01             	add    $0x1,%edx
+  802a11:	0f b6 01             	movzbl (%ecx),%eax
+  802a14:	84 c0                	test   %al,%al
+  802a16:	75 ef                	jne    802a07 <strcmp+0x10>
+  802a18:	0f b6 c0             	movzbl %al,%eax
+  802a1b:	0f b6 12             	movzbl (%edx),%edx
+  802a1e:	29 d0                	sub    %edx,%eax
+  802a20:	5d                   	pop    %ebp
+  802a21:	c3                   	ret
+
+00802a22 <strncmp>:
+  802a22:	55                   	push   %ebp
+  802a23:	89 e5                	mov    %esp,%ebp
+  802a25:	53                   	push   %ebx
+  802a26:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a29:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a2c:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a34:	85 d2                	test   %edx,%edx
+  802a36:	74 2e                	je     802a66 <strncmp+0x44>
+  802a38:	0f b6 01             	movzbl (%ecx),%eax
+  802a3b:	84 c0                	test   %al,%al
+  802a3d:	74 16                	je     802a55 <strncmp+0x33>
+  802a3f:	3a 03                	cmp    (%ebx),%al
+  802a41:	75 12                	jne    802a55 <strncmp+0x33>
+  802a43:	83 c1 01             	add    $0x1,%ecx
+  802a46:	83 c3 01             	add    $0x1,%ebx
+  802a49:	83 ea 01             	sub    $0x1,%edx
+  802a4c:	75 ea                	jne    802a38 <strncmp+0x16>
+  802a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a53:	eb 11                	jmp    802a66 <strncmp+0x44>
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5a:	85 d2                	test   %edx,%edx
+  802a5c:	74 08                	je     802a66 <strncmp+0x44>
+  802a5e:	0f b6 01             	movzbl (%ecx),%eax
+  802a61:	0f b6 13             	movzbl (%ebx),%edx
+  802a64:	29 d0                	sub    %edx,%eax
+  802a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+
+00802a6b <strchr>:
+  802a6b:	55                   	push   %ebp
+  802a6c:	89 e5                	mov    %esp,%ebp
+  802a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a71:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a75:	0f b6 10             	movzbl (%eax),%edx
+  802a78:	84 d2                	test   %dl,%dl
+  802a7a:	74 15                	je     802a91 <strchr+0x26>
+  802a7c:	38 d1                	cmp    %dl,%cl
+  802a7e:	74 0f                	je     802a8f <strchr+0x24>
+  802a80:	83 c0 01             	add    $0x1,%eax
+  802a83:	0f b6 10             	movzbl (%eax),%edx
+  802a86:	84 d2                	test   %dl,%dl
+  802a88:	75 f2                	jne    802a7c <strchr+0x11>
+  802a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8f:	5d                   	pop    %ebp
+  802a90:	c3                   	ret
+  802a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a96:	eb f7                	jmp    802a8f <strchr+0x24>
+
+00802a98 <strfind>:
+  802a98:	55                   	push   %ebp
+  802a99:	89 e5                	mov    %esp,%ebp
+  802a9b:	53                   	push   %ebx
+  802a9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aa2:	0f b6 18             	movzbl (%eax),%ebx
+  802aa5:	38 d3                	cmp    %dl,%bl
+  802aa7:	74 14                	je     802abd <strfind+0x25>
+  802aa9:	89 d1                	mov    %edx,%ecx
+  802aab:	84 db                	test   %bl,%bl
+  802aad:	74 0e                	je     802abd <strfind+0x25>
+  802aaf:	83 c0 01             	add    $0x1,%eax
+  802ab2:	0f b6 10             	movzbl (%eax),%edx
+  802ab5:	38 ca                	cmp    %cl,%dl
+  802ab7:	74 04                	je     802abd <strfind+0x25>
+  802ab9:	84 d2                	test   %dl,%dl
+  802abb:	75 f2                	jne    802aaf <strfind+0x17>
+  802abd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac0:	c9                   	leave
+  802ac1:	c3                   	ret
+
+00802ac2 <memset>:
+  802ac2:	55                   	push   %ebp
+  802ac3:	89 e5                	mov    %esp,%ebp
+  802ac5:	57                   	push   %edi
+  802ac6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ac9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802acc:	85 c9                	test   %ecx,%ecx
+  802ace:	74 20                	je     802af0 <memset+0x2e>
+  802ad0:	89 f8                	mov    %edi,%eax
+  802ad2:	09 c8                	or     %ecx,%eax
+  802ad4:	a8 03                	test   $0x3,%al
+  802ad6:	75 12                	jne    802aea <memset+0x28>
+  802ad8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802adc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802ae2:	c1 e9 02             	shr    $0x2,%ecx
+  802ae5:	fc                   	cld
+  802ae6:	f3 ab                	rep stos %eax,%es:(%edi)
+  802ae8:	eb 06                	jmp    802af0 <memset+0x2e>
+  802aea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aed:	fc                   	cld
+  802aee:	f3 aa                	rep stos %al,%es:(%edi)
+  802af0:	89 f8                	mov    %edi,%eax
+  802af2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+
+00802af7 <memmove>:
+  802af7:	55                   	push   %ebp
+  802af8:	89 e5                	mov    %esp,%ebp
+  802afa:	57                   	push   %edi
+  802afb:	56                   	push   %esi
+  802afc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b02:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802b05:	39 c6                	cmp    %eax,%esi
+  802b07:	73 32                	jae    802b3b <memmove+0x44>
+  802b09:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802b0c:	39 d0                	cmp    %edx,%eax
+  802b0e:	73 2b                	jae    802b3b <memmove+0x44>
+  802b10:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b13:	89 d6                	mov    %edx,%esi
+  802b15:	09 fe                	or     %edi,%esi
+  802b17:	09 ce                	or     %ecx,%esi
+  802b19:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b1f:	75 0e                	jne    802b2f <memmove+0x38>
+  802b21:	83 ef 04             	sub    $0x4,%edi
+  802b24:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b27:	c1 e9 02             	shr    $0x2,%ecx
+  802b2a:	fd                   	std
+  802b2b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b2d:	eb 09                	jmp    802b38 <memmove+0x41>
+  802b2f:	83 ef 01             	sub    $0x1,%edi
+  802b32:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b35:	fd                   	std
+  802b36:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b38:	fc                   	cld
+  802b39:	eb 1a                	jmp    802b55 <memmove+0x5e>
+  802b3b:	89 f2                	mov    %esi,%edx
+  802b3d:	09 c2                	or     %eax,%edx
+  802b3f:	09 ca                	or     %ecx,%edx
+  802b41:	f6 c2 03             	test   $0x3,%dl
+  802b44:	75 0a                	jne    802b50 <memmove+0x59>
+  802b46:	c1 e9 02             	shr    $0x2,%ecx
+  802b49:	89 c7                	mov    %eax,%edi
+  802b4b:	fc                   	cld
+  802b4c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b4e:	eb 05                	jmp    802b55 <memmove+0x5e>
+  802b50:	89 c7                	mov    %eax,%edi
+  802b52:	fc                   	cld
+  802b53:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b55:	5e                   	pop    %esi
+  802b56:	5f                   	pop    %edi
+  802b57:	5d                   	pop    %ebp
+  802b58:	c3                   	ret
+
+00802b59 <memcpy>:
+  802b59:	55                   	push   %ebp
+  802b5a:	89 e5                	mov    %esp,%ebp
+  802b5c:	83 ec 0c             	sub    $0xc,%esp
+  802b5f:	ff 75 10             	push   0x10(%ebp)
+  802b62:	ff 75 0c             	push   0xc(%ebp)
+  802b65:	ff 75 08             	push   0x8(%ebp)
+  802b68:	e8 8a ff ff ff       	call   802af7 <memmove>
+  802b6d:	c9                   	leave
+  802b6e:	c3                   	ret
+
+00802b6f <memcmp>:
+  802b6f:	55                   	push   %ebp
+  802b70:	89 e5                	mov    %esp,%ebp
+  802b72:	56                   	push   %esi
+  802b73:	53                   	push   %ebx
+  802b74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b7a:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b7d:	85 f6                	test   %esi,%esi
+  802b7f:	74 29                	je     802baa <memcmp+0x3b>
+  802b81:	01 c6                	add    %eax,%esi
+  802b83:	0f b6 08             	movzbl (%eax),%ecx
+  802b86:	0f b6 1a             	movzbl (%edx),%ebx
+  802b89:	38 d9                	cmp    %bl,%cl
+  802b8b:	75 11                	jne    802b9e <memcmp+0x2f>
+  802b8d:	83 c0 01             	add    $0x1,%eax
+  802b90:	83 c2 01             	add    $0x1,%edx
+  802b93:	39 c6                	cmp    %eax,%esi
+  802b95:	75 ec                	jne    802b83 <memcmp+0x14>
+  802b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9c:	eb 08                	jmp    802ba6 <memcmp+0x37>
+  802b9e:	0f b6 c1             	movzbl %cl,%eax
+  802ba1:	0f b6 db             	movzbl %bl,%ebx
+  802ba4:	29 d8                	sub    %ebx,%eax
+  802ba6:	5b                   	pop    %ebx
+  802ba7:	5e                   	pop    %esi
+  802ba8:	5d                   	pop    %ebp
+  802ba9:	c3                   	ret
+  802baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802baf:	eb f5                	jmp    802ba6 <memcmp+0x37>
+
+00802bb1 <memfind>:
+  802bb1:	55                   	push   %ebp
+  802bb2:	89 e5                	mov    %esp,%ebp
+  802bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bba:	89 c2                	mov    %eax,%edx
+  802bbc:	03 55 10             	add    0x10(%ebp),%edx
+  802bbf:	39 d0                	cmp    %edx,%eax
+  802bc1:	73 0d                	jae    802bd0 <memfind+0x1f>
+  802bc3:	38 08                	cmp    %cl,(%eax)
+  802bc5:	74 0d                	je     802bd4 <memfind+0x23>
+  802bc7:	83 c0 01             	add    $0x1,%eax
+  802bca:	39 c2                	cmp    %eax,%edx
+  802bcc:	75 f5                	jne    802bc3 <memfind+0x12>
+  802bce:	eb 06                	jmp    802bd6 <memfind+0x25>
+  802bd0:	89 c2                	mov    %eax,%edx
+  802bd2:	eb 02                	jmp    802bd6 <memfind+0x25>
+  802bd4:	89 c2                	mov    %eax,%edx
+  802bd6:	89 d0                	mov    %edx,%eax
+  802bd8:	5d                   	pop    %ebp
+  802bd9:	c3                   	ret
+
+00802bda <strtol>:
+  802bda:	55                   	push   %ebp
+  802bdb:	89 e5                	mov    %esp,%ebp
+  802bdd:	57                   	push   %edi
+  802bde:	56                   	push   %esi
+  802bdf:	53                   	push   %ebx
+  802be0:	8b 55 08             	mov    0x8(%ebp),%edx
+  802be3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802be6:	0f b6 02             	movzbl (%edx),%eax
+  802be9:	3c 20                	cmp    $0x20,%al
+  802beb:	74 04                	je     802bf1 <strtol+0x17>
+  802bed:	3c 09                	cmp    $0x9,%al
+  802bef:	75 0e                	jne    802bff <strtol+0x25>
+  802bf1:	83 c2 01             	add    $0x1,%edx
+  802bf4:	0f b6 02             	movzbl (%edx),%eax
+  802bf7:	3c 20                	cmp    $0x20,%al
+  802bf9:	74 f6                	je     802bf1 <strtol+0x17>
+  802bfb:	3c 09                	cmp    $0x9,%al
+  802bfd:	74 f2                	je     802bf1 <strtol+0x17>
+  802bff:	3c 2b                	cmp    $0x2b,%al
+  802c01:	74 2a                	je     802c2d <strtol+0x53>
+  802c03:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c08:	3c 2d                	cmp    $0x2d,%al
+  802c0a:	74 2b                	je     802c37 <strtol+0x5d>
+  802c0c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c12:	75 0f                	jne    802c23 <strtol+0x49>
+  802c14:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c17:	74 28                	je     802c41 <strtol+0x67>
+  802c19:	85 db                	test   %ebx,%ebx
+  802c1b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c20:	0f 44 d8             	cmove  %eax,%ebx
+  802c23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c28:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c2b:	eb 46                	jmp    802c73 <strtol+0x99>
+  802c2d:	83 c2 01             	add    $0x1,%edx
+  802c30:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c35:	eb d5                	jmp    802c0c <strtol+0x32>
+  802c37:	83 c2 01             	add    $0x1,%edx
+  802c3a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c3f:	eb cb                	jmp    802c0c <strtol+0x32>
+  802c41:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c45:	74 0e                	je     802c55 <strtol+0x7b>
+  802c47:	85 db                	test   %ebx,%ebx
+  802c49:	75 d8                	jne    802c23 <strtol+0x49>
+  802c4b:	83 c2 01             	add    $0x1,%edx
+  802c4e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c53:	eb ce                	jmp    802c23 <strtol+0x49>
+  802c55:	83 c2 02             	add    $0x2,%edx
+  802c58:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c5d:	eb c4                	jmp    802c23 <strtol+0x49>
+  802c5f:	0f be c0             	movsbl %al,%eax
+  802c62:	83 e8 30             	sub    $0x30,%eax
+  802c65:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c68:	7d 3a                	jge    802ca4 <strtol+0xca>
+  802c6a:	83 c2 01             	add    $0x1,%edx
+  802c6d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c71:	01 c1                	add    %eax,%ecx
+  802c73:	0f b6 02             	movzbl (%edx),%eax
+  802c76:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c79:	89 f3                	mov    %esi,%ebx
+  802c7b:	80 fb 09             	cmp    $0x9,%bl
+  802c7e:	76 df                	jbe    802c5f <strtol+0x85>
+  802c80:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802c83:	89 f3                	mov    %esi,%ebx
+  802c85:	80 fb 19             	cmp    $0x19,%bl
+  802c88:	77 08                	ja     802c92 <strtol+0xb8>
+  802c8a:	0f be c0             	movsbl %al,%eax
+  802c8d:	83 e8 57             	sub    $0x57,%eax
+  802c90:	eb d3                	jmp    802c65 <strtol+0x8b>
+  802c92:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802c95:	89 f3                	mov    %esi,%ebx
+  802c97:	80 fb 19             	cmp    $0x19,%bl
+  802c9a:	77 08                	ja     802ca4 <strtol+0xca>
+  802c9c:	0f be c0             	movsbl %al,%eax
+  802c9f:	83 e8 37             	sub    $0x37,%eax
+  802ca2:	eb c1                	jmp    802c65 <strtol+0x8b>
+  802ca4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802ca8:	74 05                	je     802caf <strtol+0xd5>
+  802caa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cad:	89 10                	mov    %edx,(%eax)
+  802caf:	89 c8                	mov    %ecx,%eax
+  802cb1:	f7 d8                	neg    %eax
+  802cb3:	85 ff                	test   %edi,%edi
+  802cb5:	0f 45 c8             	cmovne %eax,%ecx
+  802cb8:	89 c8                	mov    %ecx,%eax
+  802cba:	5b                   	pop    %ebx
+  802cbb:	5e                   	pop    %esi
+  802cbc:	5f                   	pop    %edi
+  802cbd:	5d                   	pop    %ebp
+  802cbe:	c3                   	ret
+
+00802cbf <ipc_recv>:
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	56                   	push   %esi
+  802cc3:	53                   	push   %ebx
+  802cc4:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ccd:	85 c0                	test   %eax,%eax
+  802ccf:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cd4:	0f 44 c2             	cmove  %edx,%eax
+  802cd7:	83 ec 0c             	sub    $0xc,%esp
+  802cda:	50                   	push   %eax
+  802cdb:	e8 73 d7 ff ff       	call   800453 <sys_ipc_recv>
+  802ce0:	83 c4 10             	add    $0x10,%esp
+  802ce3:	85 c0                	test   %eax,%eax
+  802ce5:	78 2a                	js     802d11 <ipc_recv+0x52>
+  802ce7:	a1 10 50 80 00       	mov    0x805010,%eax
+  802cec:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802cf2:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802cf8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802cfe:	85 f6                	test   %esi,%esi
+  802d00:	74 02                	je     802d04 <ipc_recv+0x45>
+  802d02:	89 0e                	mov    %ecx,(%esi)
+  802d04:	85 db                	test   %ebx,%ebx
+  802d06:	74 02                	je     802d0a <ipc_recv+0x4b>
+  802d08:	89 13                	mov    %edx,(%ebx)
+  802d0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d0d:	5b                   	pop    %ebx
+  802d0e:	5e                   	pop    %esi
+  802d0f:	5d                   	pop    %ebp
+  802d10:	c3                   	ret
+  802d11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d1b:	eb e1                	jmp    802cfe <ipc_recv+0x3f>
+
+00802d1d <ipc_send>:
+  802d1d:	55                   	push   %ebp
+  802d1e:	89 e5                	mov    %esp,%ebp
+  802d20:	57                   	push   %edi
+  802d21:	56                   	push   %esi
+  802d22:	53                   	push   %ebx
+  802d23:	83 ec 0c             	sub    $0xc,%esp
+  802d26:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d2c:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d2f:	85 db                	test   %ebx,%ebx
+  802d31:	74 1e                	je     802d51 <ipc_send+0x34>
+  802d33:	56                   	push   %esi
+  802d34:	53                   	push   %ebx
+  802d35:	57                   	push   %edi
+  802d36:	ff 75 08             	push   0x8(%ebp)
+  802d39:	e8 a2 d7 ff ff       	call   8004e0 <sys_ipc_send>
+  802d3e:	83 c4 10             	add    $0x10,%esp
+  802d41:	85 c0                	test   %eax,%eax
+  802d43:	74 2a                	je     802d6f <ipc_send+0x52>
+  802d45:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d48:	75 13                	jne    802d5d <ipc_send+0x40>
+  802d4a:	e8 0e d4 ff ff       	call   80015d <sys_yield>
+  802d4f:	eb e2                	jmp    802d33 <ipc_send+0x16>
+  802d51:	be 00 00 00 00       	mov    $0x0,%esi
+  802d56:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d5b:	eb d6                	jmp    802d33 <ipc_send+0x16>
+  802d5d:	50                   	push   %eax
+  802d5e:	68 2c 36 80 00       	push   $0x80362c
+  802d63:	6a 4f                	push   $0x4f
+  802d65:	68 6f 36 80 00       	push   $0x80366f
+  802d6a:	e8 06 f4 ff ff       	call   802175 <_panic>
+  802d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d72:	5b                   	pop    %ebx
+  802d73:	5e                   	pop    %esi
+  802d74:	5f                   	pop    %edi
+  802d75:	5d                   	pop    %ebp
+  802d76:	c3                   	ret
+
+00802d77 <ipc_call>:
+  802d77:	55                   	push   %ebp
+  802d78:	89 e5                	mov    %esp,%ebp
+  802d7a:	57                   	push   %edi
+  802d7b:	56                   	push   %esi
+  802d7c:	53                   	push   %ebx
+  802d7d:	83 ec 0c             	sub    $0xc,%esp
+  802d80:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d84:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d89:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d8d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d91:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d96:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802d9a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da3:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802da7:	eb 05                	jmp    802dae <ipc_call+0x37>
+  802da9:	e8 af d3 ff ff       	call   80015d <sys_yield>
+  802dae:	83 ec 0c             	sub    $0xc,%esp
+  802db1:	56                   	push   %esi
+  802db2:	53                   	push   %ebx
+  802db3:	57                   	push   %edi
+  802db4:	ff 75 0c             	push   0xc(%ebp)
+  802db7:	ff 75 08             	push   0x8(%ebp)
+  802dba:	e8 71 d7 ff ff       	call   800530 <sys_ipc_call>
+  802dbf:	83 c4 20             	add    $0x20,%esp
+  802dc2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dc5:	74 e2                	je     802da9 <ipc_call+0x32>
+  802dc7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802dca:	74 2d                	je     802df9 <ipc_call+0x82>
+  802dcc:	85 c0                	test   %eax,%eax
+  802dce:	78 4f                	js     802e1f <ipc_call+0xa8>
+  802dd0:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802dd4:	74 10                	je     802de6 <ipc_call+0x6f>
+  802dd6:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ddb:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802de1:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802de4:	89 02                	mov    %eax,(%edx)
+  802de6:	a1 10 50 80 00       	mov    0x805010,%eax
+  802deb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df4:	5b                   	pop    %ebx
+  802df5:	5e                   	pop    %esi
+  802df6:	5f                   	pop    %edi
+  802df7:	5d                   	pop    %ebp
+  802df8:	c3                   	ret
+  802df9:	ff 75 14             	push   0x14(%ebp)
+  802dfc:	ff 75 10             	push   0x10(%ebp)
+  802dff:	ff 75 0c             	push   0xc(%ebp)
+  802e02:	ff 75 08             	push   0x8(%ebp)
+  802e05:	e8 13 ff ff ff       	call   802d1d <ipc_send>
+  802e0a:	83 c4 0c             	add    $0xc,%esp
+  802e0d:	ff 75 1c             	push   0x1c(%ebp)
+  802e10:	ff 75 18             	push   0x18(%ebp)
+  802e13:	6a 00                	push   $0x0
+  802e15:	e8 a5 fe ff ff       	call   802cbf <ipc_recv>
+  802e1a:	83 c4 10             	add    $0x10,%esp
+  802e1d:	eb d2                	jmp    802df1 <ipc_call+0x7a>
+  802e1f:	50                   	push   %eax
+  802e20:	68 79 36 80 00       	push   $0x803679
+  802e25:	6a 6d                	push   $0x6d
+  802e27:	68 6f 36 80 00       	push   $0x80366f
+  802e2c:	e8 44 f3 ff ff       	call   802175 <_panic>
+
+00802e31 <ipc_reply_recv>:
+  802e31:	55                   	push   %ebp
+  802e32:	89 e5                	mov    %esp,%ebp
+  802e34:	57                   	push   %edi
+  802e35:	56                   	push   %esi
+  802e36:	53                   	push   %ebx
+  802e37:	83 ec 0c             	sub    $0xc,%esp
+  802e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e3d:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e40:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e43:	85 db                	test   %ebx,%ebx
+  802e45:	0f 84 ac 00 00 00    	je     802ef7 <ipc_reply_recv+0xc6>
+  802e4b:	85 f6                	test   %esi,%esi
+  802e4d:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e52:	0f 45 c6             	cmovne %esi,%eax
+  802e55:	83 ec 0c             	sub    $0xc,%esp
+  802e58:	50                   	push   %eax
+  802e59:	ff 75 14             	push   0x14(%ebp)
+  802e5c:	53                   	push   %ebx
+  802e5d:	ff 75 0c             	push   0xc(%ebp)
+  802e60:	ff 75 08             	push   0x8(%ebp)
+  802e63:	e8 e9 d6 ff ff       	call   800551 <sys_ipc_reply_recv>
+  802e68:	83 c4 20             	add    $0x20,%esp
+  802e6b:	85 c0                	test   %eax,%eax
+  802e6d:	78 3a                	js     802ea9 <ipc_reply_recv+0x78>
+  802e6f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e73:	74 10                	je     802e85 <ipc_reply_recv+0x54>
+  802e75:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e7a:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e80:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e83:	89 02                	mov    %eax,(%edx)
+  802e85:	85 ff                	test   %edi,%edi
+  802e87:	74 0d                	je     802e96 <ipc_reply_recv+0x65>
+  802e89:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e8e:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e94:	89 07                	mov    %eax,(%edi)
+  802e96:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e9b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ea1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea4:	5b                   	pop    %ebx
+  802ea5:	5e                   	pop    %esi
+  802ea6:	5f                   	pop    %edi
+  802ea7:	5d                   	pop    %ebp
+  802ea8:	c3                   	ret
+  802ea9:	ff 75 14             	push   0x14(%ebp)
+  802eac:	53                   	push   %ebx
+  802ead:	ff 75 0c             	push   0xc(%ebp)
+  802eb0:	ff 75 08             	push   0x8(%ebp)
+  802eb3:	e8 4b d5 ff ff       	call   800403 <sys_ipc_try_send>
+  802eb8:	89 c2                	mov    %eax,%edx
+  802eba:	c1 ea 1f             	shr    $0x1f,%edx
+  802ebd:	83 c4 10             	add    $0x10,%esp
+  802ec0:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802ec3:	0f 95 c1             	setne  %cl
+  802ec6:	84 d1                	test   %dl,%cl
+  802ec8:	74 05                	je     802ecf <ipc_reply_recv+0x9e>
+  802eca:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ecd:	75 12                	jne    802ee1 <ipc_reply_recv+0xb0>
+  802ecf:	83 ec 04             	sub    $0x4,%esp
+  802ed2:	57                   	push   %edi
+  802ed3:	56                   	push   %esi
+  802ed4:	ff 75 18             	push   0x18(%ebp)
+  802ed7:	e8 e3 fd ff ff       	call   802cbf <ipc_recv>
+  802edc:	83 c4 10             	add    $0x10,%esp
+  802edf:	eb c0                	jmp    802ea1 <ipc_reply_recv+0x70>
+  802ee1:	83 ec 04             	sub    $0x4,%esp
+  802ee4:	50                   	push   %eax
+  802ee5:	ff 75 08             	push   0x8(%ebp)
+  802ee8:	68 4c 36 80 00       	push   $0x80364c
+  802eed:	e8 5e f3 ff ff       	call   802250 <cprintf>
+  802ef2:	83 c4 10             	add    $0x10,%esp
+  802ef5:	eb d8                	jmp    802ecf <ipc_reply_recv+0x9e>
+  802ef7:	85 f6                	test   %esi,%esi
+  802ef9:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802efe:	0f 45 c6             	cmovne %esi,%eax
+  802f01:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f06:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f0d:	e9 43 ff ff ff       	jmp    802e55 <ipc_reply_recv+0x24>
+
+00802f12 <ipc_find_env>:
+  802f12:	55                   	push   %ebp
+  802f13:	89 e5                	mov    %esp,%ebp
+  802f15:	83 ec 14             	sub    $0x14,%esp
+  802f18:	ff 75 08             	push   0x8(%ebp)
+  802f1b:	e8 81 d4 ff ff       	call   8003a1 <sys_env_service>
+  802f20:	85 c0                	test   %eax,%eax
+  802f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f27:	0f 48 c2             	cmovs  %edx,%eax
+  802f2a:	c9                   	leave
+  802f2b:	c3                   	ret
+
+00802f2c <pageref>:
+  802f2c:	55                   	push   %ebp
+  802f2d:	89 e5                	mov    %esp,%ebp
+  802f2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f32:	89 c2                	mov    %eax,%edx
+  802f34:	c1 ea 16             	shr    $0x16,%edx
+  802f37:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f43:	f6 c1 01             	test   $0x1,%cl
+  802f46:	74 22                	je     802f6a <pageref+0x3e>
+  802f48:	c1 e8 0c             	shr    $0xc,%eax
+  802f4b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f52:	a8 01                	test   $0x1,%al
+  802f54:	74 14                	je     802f6a <pageref+0x3e>
+  802f56:	c1 e8 0c             	shr    $0xc,%eax
+  802f59:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f5c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f63:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f67:	0f b7 d2             	movzwl %dx,%edx
+  802f6a:	89 d0                	mov    %edx,%eax
+  802f6c:	5d                   	pop    %ebp
+  802f6d:	c3                   	ret
+
+00802f6e <__udivmoddi4>:
+  802f6e:	55                   	push   %ebp
+  802f6f:	57                   	push   %edi
+  802f70:	56                   	push   %esi
+  802f71:	53                   	push   %ebx
+  802f72:	83 ec 24             	sub    $0x24,%esp
+  802f75:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f79:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f7d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f81:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f85:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f89:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f8d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f91:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f95:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fa3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fa8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802faf:	00 
+  802fb0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fb7:	00 
+  802fb8:	89 fb                	mov    %edi,%ebx
+  802fba:	eb 08                	jmp    802fc4 <__udivmoddi4+0x56>
+  802fbc:	83 e9 01             	sub    $0x1,%ecx
+  802fbf:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fc2:	74 68                	je     80302c <__udivmoddi4+0xbe>
+  802fc4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fc8:	01 c0                	add    %eax,%eax
+  802fca:	89 c6                	mov    %eax,%esi
+  802fcc:	89 d7                	mov    %edx,%edi
+  802fce:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fd2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fd6:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fd9:	d3 ea                	shr    %cl,%edx
+  802fdb:	f6 c1 20             	test   $0x20,%cl
+  802fde:	74 04                	je     802fe4 <__udivmoddi4+0x76>
+  802fe0:	89 d0                	mov    %edx,%eax
+  802fe2:	31 d2                	xor    %edx,%edx
+  802fe4:	83 e0 01             	and    $0x1,%eax
+  802fe7:	89 04 24             	mov    %eax,(%esp)
+  802fea:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ff1:	00 
+  802ff2:	8b 04 24             	mov    (%esp),%eax
+  802ff5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ff9:	09 f0                	or     %esi,%eax
+  802ffb:	09 fa                	or     %edi,%edx
+  802ffd:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803001:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803005:	39 f0                	cmp    %esi,%eax
+  803007:	89 d5                	mov    %edx,%ebp
+  803009:	19 fd                	sbb    %edi,%ebp
+  80300b:	72 af                	jb     802fbc <__udivmoddi4+0x4e>
+  80300d:	29 f0                	sub    %esi,%eax
+  80300f:	19 fa                	sbb    %edi,%edx
+  803011:	89 cf                	mov    %ecx,%edi
+  803013:	c1 ef 05             	shr    $0x5,%edi
+  803016:	83 e7 01             	and    $0x1,%edi
+  803019:	89 fe                	mov    %edi,%esi
+  80301b:	83 f6 01             	xor    $0x1,%esi
+  80301e:	d3 e6                	shl    %cl,%esi
+  803020:	d3 e7                	shl    %cl,%edi
+  803022:	09 74 24 18          	or     %esi,0x18(%esp)
+  803026:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80302a:	eb 90                	jmp    802fbc <__udivmoddi4+0x4e>
+  80302c:	85 db                	test   %ebx,%ebx
+  80302e:	74 05                	je     803035 <__udivmoddi4+0xc7>
+  803030:	89 03                	mov    %eax,(%ebx)
+  803032:	89 53 04             	mov    %edx,0x4(%ebx)
+  803035:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803039:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80303d:	83 c4 24             	add    $0x24,%esp
+  803040:	5b                   	pop    %ebx
+  803041:	5e                   	pop    %esi
+  803042:	5f                   	pop    %edi
+  803043:	5d                   	pop    %ebp
+  803044:	c3                   	ret
+
+00803045 <__udivdi3>:
+  803045:	83 ec 08             	sub    $0x8,%esp
+  803048:	6a 00                	push   $0x0
+  80304a:	ff 74 24 1c          	push   0x1c(%esp)
+  80304e:	ff 74 24 1c          	push   0x1c(%esp)
+  803052:	ff 74 24 1c          	push   0x1c(%esp)
+  803056:	ff 74 24 1c          	push   0x1c(%esp)
+  80305a:	e8 0f ff ff ff       	call   802f6e <__udivmoddi4>
+  80305f:	83 c4 1c             	add    $0x1c,%esp
+  803062:	c3                   	ret
+
+00803063 <__umoddi3>:
+  803063:	83 ec 18             	sub    $0x18,%esp
+  803066:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80306a:	50                   	push   %eax
+  80306b:	ff 74 24 2c          	push   0x2c(%esp)
+  80306f:	ff 74 24 2c          	push   0x2c(%esp)
+  803073:	ff 74 24 2c          	push   0x2c(%esp)
+  803077:	ff 74 24 2c          	push   0x2c(%esp)
+  80307b:	e8 ee fe ff ff       	call   802f6e <__udivmoddi4>
+  803080:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803084:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803088:	83 c4 2c             	add    $0x2c,%esp
+  80308b:	c3                   	ret
+
+0080308c <__divdi3>:
+  80308c:	53                   	push   %ebx
+  80308d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803091:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803095:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803099:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80309d:	85 d2                	test   %edx,%edx
+  80309f:	78 12                	js     8030b3 <__divdi3+0x27>
+  8030a1:	85 db                	test   %ebx,%ebx
+  8030a3:	78 2e                	js     8030d3 <__divdi3+0x47>
+  8030a5:	53                   	push   %ebx
+  8030a6:	51                   	push   %ecx
+  8030a7:	52                   	push   %edx
+  8030a8:	50                   	push   %eax
+  8030a9:	e8 97 ff ff ff       	call   803045 <__udivdi3>
+  8030ae:	83 c4 10             	add    $0x10,%esp
+  8030b1:	eb 1e                	jmp    8030d1 <__divdi3+0x45>
+  8030b3:	f7 d8                	neg    %eax
+  8030b5:	83 d2 00             	adc    $0x0,%edx
+  8030b8:	f7 da                	neg    %edx
+  8030ba:	85 db                	test   %ebx,%ebx
+  8030bc:	78 2a                	js     8030e8 <__divdi3+0x5c>
+  8030be:	53                   	push   %ebx
+  8030bf:	51                   	push   %ecx
+  8030c0:	52                   	push   %edx
+  8030c1:	50                   	push   %eax
+  8030c2:	e8 7e ff ff ff       	call   803045 <__udivdi3>
+  8030c7:	83 c4 10             	add    $0x10,%esp
+  8030ca:	f7 d8                	neg    %eax
+  8030cc:	83 d2 00             	adc    $0x0,%edx
+  8030cf:	f7 da                	neg    %edx
+  8030d1:	5b                   	pop    %ebx
+  8030d2:	c3                   	ret
+  8030d3:	f7 d9                	neg    %ecx
+  8030d5:	83 d3 00             	adc    $0x0,%ebx
+  8030d8:	f7 db                	neg    %ebx
+  8030da:	53                   	push   %ebx
+  8030db:	51                   	push   %ecx
+  8030dc:	52                   	push   %edx
+  8030dd:	50                   	push   %eax
+  8030de:	e8 62 ff ff ff       	call   803045 <__udivdi3>
+  8030e3:	83 c4 10             	add    $0x10,%esp
+  8030e6:	eb e2                	jmp    8030ca <__divdi3+0x3e>
+  8030e8:	f7 d9                	neg    %ecx
+  8030ea:	83 d3 00             	adc    $0x0,%ebx
+  8030ed:	f7 db                	neg    %ebx
+  8030ef:	53                   	push   %ebx
+  8030f0:	51                   	push   %ecx
+  8030f1:	52                   	push   %edx
+  8030f2:	50                   	push   %eax
+  8030f3:	e8 4d ff ff ff       	call   803045 <__udivdi3>
+  8030f8:	83 c4 10             	add    $0x10,%esp
+  8030fb:	eb d4                	jmp    8030d1 <__divdi3+0x45>
+
+008030fd <__moddi3>:
+  8030fd:	55                   	push   %ebp
+  8030fe:	57                   	push   %edi
+  8030ff:	56                   	push   %esi
+  803100:	53                   	push   %ebx
+  803101:	83 ec 0c             	sub    $0xc,%esp
+  803104:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803108:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80310c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803110:	89 e9                	mov    %ebp,%ecx
+  803112:	f7 d9                	neg    %ecx
+  803114:	89 d0                	mov    %edx,%eax
+  803116:	83 d0 00             	adc    $0x0,%eax
+  803119:	f7 d8                	neg    %eax
+  80311b:	0f 49 e9             	cmovns %ecx,%ebp
+  80311e:	0f 49 d0             	cmovns %eax,%edx
+  803121:	52                   	push   %edx
+  803122:	55                   	push   %ebp
+  803123:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803127:	f7 da                	neg    %edx
+  803129:	89 d8                	mov    %ebx,%eax
+  80312b:	83 d0 00             	adc    $0x0,%eax
+  80312e:	f7 d8                	neg    %eax
+  803130:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803135:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803139:	0f 48 c3             	cmovs  %ebx,%eax
+  80313c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803140:	ff 74 24 0c          	push   0xc(%esp)
+  803144:	ff 74 24 0c          	push   0xc(%esp)
+  803148:	e8 16 ff ff ff       	call   803063 <__umoddi3>
+  80314d:	83 c4 10             	add    $0x10,%esp
+  803150:	85 db                	test   %ebx,%ebx
+  803152:	78 08                	js     80315c <__moddi3+0x5f>
+  803154:	83 c4 0c             	add    $0xc,%esp
+  803157:	5b                   	pop    %ebx
+  803158:	5e                   	pop    %esi
+  803159:	5f                   	pop    %edi
+  80315a:	5d                   	pop    %ebp
+  80315b:	c3                   	ret
+  80315c:	f7 d8                	neg    %eax
+  80315e:	83 d2 00             	adc    $0x0,%edx
+  803161:	f7 da                	neg    %edx
+  803163:	eb ef                	jmp    803154 <__moddi3+0x57>
@@ -0,0 +1,5040 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 40 80 00    	push   0x804000
+  800044:	e8 7e 00 00 00       	call   8000c7 <sys_cputs>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800059:	e8 e7 00 00 00       	call   800145 <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 10 50 80 00       	mov    %eax,0x805010
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 04 40 80 00       	mov    %eax,0x804004
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	a1 10 50 80 00       	mov    0x805010,%eax
+  8000a2:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000a8:	85 c0                	test   %eax,%eax
+  8000aa:	75 14                	jne    8000c0 <exit+0x29>
+  8000ac:	e8 36 0b 00 00       	call   800be7 <close_all>
+  8000b1:	83 ec 0c             	sub    $0xc,%esp
+  8000b4:	6a 00                	push   $0x0
+  8000b6:	e8 49 00 00 00       	call   800104 <sys_env_destroy>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	c9                   	leave
+  8000bf:	c3                   	ret
+  8000c0:	e8 ac 07 00 00       	call   800871 <sys_lease_complete>
+  8000c5:	eb e5                	jmp    8000ac <exit+0x15>
+
+008000c7 <sys_cputs>:
+  8000c7:	55                   	push   %ebp
+  8000c8:	89 e5                	mov    %esp,%ebp
+  8000ca:	57                   	push   %edi
+  8000cb:	56                   	push   %esi
+  8000cc:	53                   	push   %ebx
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d8:	89 c3                	mov    %eax,%ebx
+  8000da:	89 c7                	mov    %eax,%edi
+  8000dc:	89 c6                	mov    %eax,%esi
+  8000de:	cd 30                	int    $0x30
+  8000e0:	5b                   	pop    %ebx
+  8000e1:	5e                   	pop    %esi
+  8000e2:	5f                   	pop    %edi
+  8000e3:	5d                   	pop    %ebp
+  8000e4:	c3                   	ret
+
+008000e5 <sys_cgetc>:
+  8000e5:	55                   	push   %ebp
+  8000e6:	89 e5                	mov    %esp,%ebp
+  8000e8:	57                   	push   %edi
+  8000e9:	56                   	push   %esi
+  8000ea:	53                   	push   %ebx
+  8000eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000f5:	89 d1                	mov    %edx,%ecx
+  8000f7:	89 d3                	mov    %edx,%ebx
+  8000f9:	89 d7                	mov    %edx,%edi
+  8000fb:	89 d6                	mov    %edx,%esi
+  8000fd:	cd 30                	int    $0x30
+  8000ff:	5b                   	pop    %ebx
+  800100:	5e                   	pop    %esi
+  800101:	5f                   	pop    %edi
+  800102:	5d                   	pop    %ebp
+  800103:	c3                   	ret
+
+00800104 <sys_env_destroy>:
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	57                   	push   %edi
+  800108:	56                   	push   %esi
+  800109:	53                   	push   %ebx
+  80010a:	83 ec 0c             	sub    $0xc,%esp
+  80010d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800112:	8b 55 08             	mov    0x8(%ebp),%edx
+  800115:	b8 03 00 00 00       	mov    $0x3,%eax
+  80011a:	89 cb                	mov    %ecx,%ebx
+  80011c:	89 cf                	mov    %ecx,%edi
+  80011e:	89 ce                	mov    %ecx,%esi
+  800120:	cd 30                	int    $0x30
+  800122:	85 c0                	test   %eax,%eax
+  800124:	7f 08                	jg     80012e <sys_env_destroy+0x2a>
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+  80012e:	83 ec 0c             	sub    $0xc,%esp
+  800131:	50                   	push   %eax
+  800132:	6a 03                	push   $0x3
+  800134:	68 98 31 80 00       	push   $0x803198
+  800139:	6a 24                	push   $0x24
+  80013b:	68 b5 31 80 00       	push   $0x8031b5
+  800140:	e8 37 20 00 00       	call   80217c <_panic>
+
+00800145 <sys_getenvid>:
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	57                   	push   %edi
+  800149:	56                   	push   %esi
+  80014a:	53                   	push   %ebx
+  80014b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800150:	b8 02 00 00 00       	mov    $0x2,%eax
+  800155:	89 d1                	mov    %edx,%ecx
+  800157:	89 d3                	mov    %edx,%ebx
+  800159:	89 d7                	mov    %edx,%edi
+  80015b:	89 d6                	mov    %edx,%esi
+  80015d:	cd 30                	int    $0x30
+  80015f:	5b                   	pop    %ebx
+  800160:	5e                   	pop    %esi
+  800161:	5f                   	pop    %edi
+  800162:	5d                   	pop    %ebp
+  800163:	c3                   	ret
+
+00800164 <sys_yield>:
+  800164:	55                   	push   %ebp
+  800165:	89 e5                	mov    %esp,%ebp
+  800167:	57                   	push   %edi
+  800168:	56                   	push   %esi
+  800169:	53                   	push   %ebx
+  80016a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800171:	74 26                	je     800199 <sys_yield+0x35>
+  800173:	ba 00 00 00 00       	mov    $0x0,%edx
+  800178:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80017d:	89 d1                	mov    %edx,%ecx
+  80017f:	89 d3                	mov    %edx,%ebx
+  800181:	89 d7                	mov    %edx,%edi
+  800183:	6a 00                	push   $0x0
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	8d 35 90 01 80 00    	lea    0x800190,%esi
+  80018e:	0f 34                	sysenter
+  800190:	5d                   	pop    %ebp
+  800191:	83 c4 04             	add    $0x4,%esp
+  800194:	5b                   	pop    %ebx
+  800195:	5e                   	pop    %esi
+  800196:	5f                   	pop    %edi
+  800197:	5d                   	pop    %ebp
+  800198:	c3                   	ret
+  800199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001a3:	89 d1                	mov    %edx,%ecx
+  8001a5:	89 d3                	mov    %edx,%ebx
+  8001a7:	89 d7                	mov    %edx,%edi
+  8001a9:	89 d6                	mov    %edx,%esi
+  8001ab:	cd 30                	int    $0x30
+  8001ad:	eb e5                	jmp    800194 <sys_yield+0x30>
+
+008001af <sys_page_alloc>:
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	57                   	push   %edi
+  8001b3:	56                   	push   %esi
+  8001b4:	53                   	push   %ebx
+  8001b5:	83 ec 0c             	sub    $0xc,%esp
+  8001b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001cb:	89 f7                	mov    %esi,%edi
+  8001cd:	cd 30                	int    $0x30
+  8001cf:	85 c0                	test   %eax,%eax
+  8001d1:	7f 08                	jg     8001db <sys_page_alloc+0x2c>
+  8001d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d6:	5b                   	pop    %ebx
+  8001d7:	5e                   	pop    %esi
+  8001d8:	5f                   	pop    %edi
+  8001d9:	5d                   	pop    %ebp
+  8001da:	c3                   	ret
+  8001db:	83 ec 0c             	sub    $0xc,%esp
+  8001de:	50                   	push   %eax
+  8001df:	6a 04                	push   $0x4
+  8001e1:	68 98 31 80 00       	push   $0x803198
+  8001e6:	6a 24                	push   $0x24
+  8001e8:	68 b5 31 80 00       	push   $0x8031b5
+  8001ed:	e8 8a 1f 00 00       	call   80217c <_panic>
+
+008001f2 <sys_page_map>:
+  8001f2:	55                   	push   %ebp
+  8001f3:	89 e5                	mov    %esp,%ebp
+  8001f5:	57                   	push   %edi
+  8001f6:	56                   	push   %esi
+  8001f7:	53                   	push   %ebx
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  8001fb:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800202:	74 33                	je     800237 <sys_page_map+0x45>
+  800204:	8b 55 08             	mov    0x8(%ebp),%edx
+  800207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80020a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80020f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800212:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800215:	ff 75 18             	push   0x18(%ebp)
+  800218:	55                   	push   %ebp
+  800219:	89 e5                	mov    %esp,%ebp
+  80021b:	8d 35 23 02 80 00    	lea    0x800223,%esi
+  800221:	0f 34                	sysenter
+  800223:	5d                   	pop    %ebp
+  800224:	83 c4 04             	add    $0x4,%esp
+  800227:	89 c2                	mov    %eax,%edx
+  800229:	85 c0                	test   %eax,%eax
+  80022b:	7f 3d                	jg     80026a <sys_page_map+0x78>
+  80022d:	89 d0                	mov    %edx,%eax
+  80022f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800232:	5b                   	pop    %ebx
+  800233:	5e                   	pop    %esi
+  800234:	5f                   	pop    %edi
+  800235:	5d                   	pop    %ebp
+  800236:	c3                   	ret
+  800237:	b8 05 00 00 00       	mov    $0x5,%eax
+  80023c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800242:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800245:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800248:	8b 75 18             	mov    0x18(%ebp),%esi
+  80024b:	cd 30                	int    $0x30
+  80024d:	89 c2                	mov    %eax,%edx
+  80024f:	85 c0                	test   %eax,%eax
+  800251:	7e da                	jle    80022d <sys_page_map+0x3b>
+  800253:	83 ec 0c             	sub    $0xc,%esp
+  800256:	50                   	push   %eax
+  800257:	6a 05                	push   $0x5
+  800259:	68 98 31 80 00       	push   $0x803198
+  80025e:	6a 24                	push   $0x24
+  800260:	68 b5 31 80 00       	push   $0x8031b5
+  800265:	e8 12 1f 00 00       	call   80217c <_panic>
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+  80026d:	50                   	push   %eax
+  80026e:	6a 05                	push   $0x5
+  800270:	68 98 31 80 00       	push   $0x803198
+  800275:	6a 48                	push   $0x48
+  800277:	68 b5 31 80 00       	push   $0x8031b5
+  80027c:	e8 fb 1e 00 00       	call   80217c <_panic>
+
+00800281 <sys_page_unmap>:
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	57                   	push   %edi
+  800285:	56                   	push   %esi
+  800286:	53                   	push   %ebx
+  800287:	83 ec 0c             	sub    $0xc,%esp
+  80028a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80028f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800292:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800295:	b8 06 00 00 00       	mov    $0x6,%eax
+  80029a:	89 df                	mov    %ebx,%edi
+  80029c:	89 de                	mov    %ebx,%esi
+  80029e:	cd 30                	int    $0x30
+  8002a0:	85 c0                	test   %eax,%eax
+  8002a2:	7f 08                	jg     8002ac <sys_page_unmap+0x2b>
+  8002a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a7:	5b                   	pop    %ebx
+  8002a8:	5e                   	pop    %esi
+  8002a9:	5f                   	pop    %edi
+  8002aa:	5d                   	pop    %ebp
+  8002ab:	c3                   	ret
+  8002ac:	83 ec 0c             	sub    $0xc,%esp
+  8002af:	50                   	push   %eax
+  8002b0:	6a 06                	push   $0x6
+  8002b2:	68 98 31 80 00       	push   $0x803198
+  8002b7:	6a 24                	push   $0x24
+  8002b9:	68 b5 31 80 00       	push   $0x8031b5
+  8002be:	e8 b9 1e 00 00       	call   80217c <_panic>
+
+008002c3 <sys_fork>:
+  8002c3:	55                   	push   %ebp
+  8002c4:	89 e5                	mov    %esp,%ebp
+  8002c6:	57                   	push   %edi
+  8002c7:	56                   	push   %esi
+  8002c8:	53                   	push   %ebx
+  8002c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ce:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002d3:	89 d1                	mov    %edx,%ecx
+  8002d5:	89 d3                	mov    %edx,%ebx
+  8002d7:	89 d7                	mov    %edx,%edi
+  8002d9:	89 d6                	mov    %edx,%esi
+  8002db:	cd 30                	int    $0x30
+  8002dd:	5b                   	pop    %ebx
+  8002de:	5e                   	pop    %esi
+  8002df:	5f                   	pop    %edi
+  8002e0:	5d                   	pop    %ebp
+  8002e1:	c3                   	ret
+
+008002e2 <sys_env_set_status>:
+  8002e2:	55                   	push   %ebp
+  8002e3:	89 e5                	mov    %esp,%ebp
+  8002e5:	57                   	push   %edi
+  8002e6:	56                   	push   %esi
+  8002e7:	53                   	push   %ebx
+  8002e8:	83 ec 0c             	sub    $0xc,%esp
+  8002eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002fb:	89 df                	mov    %ebx,%edi
+  8002fd:	89 de                	mov    %ebx,%esi
+  8002ff:	cd 30                	int    $0x30
+  800301:	85 c0                	test   %eax,%eax
+  800303:	7f 08                	jg     80030d <sys_env_set_status+0x2b>
+  800305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800308:	5b                   	pop    %ebx
+  800309:	5e                   	pop    %esi
+  80030a:	5f                   	pop    %edi
+  80030b:	5d                   	pop    %ebp
+  80030c:	c3                   	ret
+  80030d:	83 ec 0c             	sub    $0xc,%esp
+  800310:	50                   	push   %eax
+  800311:	6a 08                	push   $0x8
+  800313:	68 98 31 80 00       	push   $0x803198
+  800318:	6a 24                	push   $0x24
+  80031a:	68 b5 31 80 00       	push   $0x8031b5
+  80031f:	e8 58 1e 00 00       	call   80217c <_panic>
+
+00800324 <sys_env_set_trapframe>:
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	57                   	push   %edi
+  800328:	56                   	push   %esi
+  800329:	53                   	push   %ebx
+  80032a:	83 ec 0c             	sub    $0xc,%esp
+  80032d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800332:	8b 55 08             	mov    0x8(%ebp),%edx
+  800335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800338:	b8 09 00 00 00       	mov    $0x9,%eax
+  80033d:	89 df                	mov    %ebx,%edi
+  80033f:	89 de                	mov    %ebx,%esi
+  800341:	cd 30                	int    $0x30
+  800343:	85 c0                	test   %eax,%eax
+  800345:	7f 08                	jg     80034f <sys_env_set_trapframe+0x2b>
+  800347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034a:	5b                   	pop    %ebx
+  80034b:	5e                   	pop    %esi
+  80034c:	5f                   	pop    %edi
+  80034d:	5d                   	pop    %ebp
+  80034e:	c3                   	ret
+  80034f:	83 ec 0c             	sub    $0xc,%esp
+  800352:	50                   	push   %eax
+  800353:	6a 09                	push   $0x9
+  800355:	68 98 31 80 00       	push   $0x803198
+  80035a:	6a 24                	push   $0x24
+  80035c:	68 b5 31 80 00       	push   $0x8031b5
+  800361:	e8 16 1e 00 00       	call   80217c <_panic>
+
+00800366 <sys_env_set_cow>:
+  800366:	55                   	push   %ebp
+  800367:	89 e5                	mov    %esp,%ebp
+  800369:	57                   	push   %edi
+  80036a:	56                   	push   %esi
+  80036b:	53                   	push   %ebx
+  80036c:	83 ec 0c             	sub    $0xc,%esp
+  80036f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800374:	8b 55 08             	mov    0x8(%ebp),%edx
+  800377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80037f:	89 df                	mov    %ebx,%edi
+  800381:	89 de                	mov    %ebx,%esi
+  800383:	cd 30                	int    $0x30
+  800385:	85 c0                	test   %eax,%eax
+  800387:	7f 08                	jg     800391 <sys_env_set_cow+0x2b>
+  800389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038c:	5b                   	pop    %ebx
+  80038d:	5e                   	pop    %esi
+  80038e:	5f                   	pop    %edi
+  80038f:	5d                   	pop    %ebp
+  800390:	c3                   	ret
+  800391:	83 ec 0c             	sub    $0xc,%esp
+  800394:	50                   	push   %eax
+  800395:	6a 20                	push   $0x20
+  800397:	68 98 31 80 00       	push   $0x803198
+  80039c:	6a 24                	push   $0x24
+  80039e:	68 b5 31 80 00       	push   $0x8031b5
+  8003a3:	e8 d4 1d 00 00       	call   80217c <_panic>
+
+008003a8 <sys_env_service>:
+  8003a8:	55                   	push   %ebp
+  8003a9:	89 e5                	mov    %esp,%ebp
+  8003ab:	57                   	push   %edi
+  8003ac:	56                   	push   %esi
+  8003ad:	53                   	push   %ebx
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003bb:	89 cb                	mov    %ecx,%ebx
+  8003bd:	89 cf                	mov    %ecx,%edi
+  8003bf:	89 ce                	mov    %ecx,%esi
+  8003c1:	cd 30                	int    $0x30
+  8003c3:	5b                   	pop    %ebx
+  8003c4:	5e                   	pop    %esi
+  8003c5:	5f                   	pop    %edi
+  8003c6:	5d                   	pop    %ebp
+  8003c7:	c3                   	ret
+
+008003c8 <sys_env_set_pgfault_upcall>:
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	57                   	push   %edi
+  8003cc:	56                   	push   %esi
+  8003cd:	53                   	push   %ebx
+  8003ce:	83 ec 0c             	sub    $0xc,%esp
+  8003d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003e1:	89 df                	mov    %ebx,%edi
+  8003e3:	89 de                	mov    %ebx,%esi
+  8003e5:	cd 30                	int    $0x30
+  8003e7:	85 c0                	test   %eax,%eax
+  8003e9:	7f 08                	jg     8003f3 <sys_env_set_pgfault_upcall+0x2b>
+  8003eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ee:	5b                   	pop    %ebx
+  8003ef:	5e                   	pop    %esi
+  8003f0:	5f                   	pop    %edi
+  8003f1:	5d                   	pop    %ebp
+  8003f2:	c3                   	ret
+  8003f3:	83 ec 0c             	sub    $0xc,%esp
+  8003f6:	50                   	push   %eax
+  8003f7:	6a 0a                	push   $0xa
+  8003f9:	68 98 31 80 00       	push   $0x803198
+  8003fe:	6a 24                	push   $0x24
+  800400:	68 b5 31 80 00       	push   $0x8031b5
+  800405:	e8 72 1d 00 00       	call   80217c <_panic>
+
+0080040a <sys_ipc_try_send>:
+  80040a:	55                   	push   %ebp
+  80040b:	89 e5                	mov    %esp,%ebp
+  80040d:	57                   	push   %edi
+  80040e:	56                   	push   %esi
+  80040f:	53                   	push   %ebx
+  800410:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800417:	74 27                	je     800440 <sys_ipc_try_send+0x36>
+  800419:	8b 55 08             	mov    0x8(%ebp),%edx
+  80041c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800424:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800427:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80042a:	6a 00                	push   $0x0
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+  80042f:	8d 35 37 04 80 00    	lea    0x800437,%esi
+  800435:	0f 34                	sysenter
+  800437:	5d                   	pop    %ebp
+  800438:	83 c4 04             	add    $0x4,%esp
+  80043b:	5b                   	pop    %ebx
+  80043c:	5e                   	pop    %esi
+  80043d:	5f                   	pop    %edi
+  80043e:	5d                   	pop    %ebp
+  80043f:	c3                   	ret
+  800440:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800445:	be 00 00 00 00       	mov    $0x0,%esi
+  80044a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80044d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800450:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800453:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800456:	cd 30                	int    $0x30
+  800458:	eb e1                	jmp    80043b <sys_ipc_try_send+0x31>
+
+0080045a <sys_ipc_recv>:
+  80045a:	55                   	push   %ebp
+  80045b:	89 e5                	mov    %esp,%ebp
+  80045d:	57                   	push   %edi
+  80045e:	56                   	push   %esi
+  80045f:	53                   	push   %ebx
+  800460:	83 ec 0c             	sub    $0xc,%esp
+  800463:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80046a:	74 32                	je     80049e <sys_ipc_recv+0x44>
+  80046c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800474:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800479:	89 cb                	mov    %ecx,%ebx
+  80047b:	89 cf                	mov    %ecx,%edi
+  80047d:	6a 00                	push   $0x0
+  80047f:	55                   	push   %ebp
+  800480:	89 e5                	mov    %esp,%ebp
+  800482:	8d 35 8a 04 80 00    	lea    0x80048a,%esi
+  800488:	0f 34                	sysenter
+  80048a:	5d                   	pop    %ebp
+  80048b:	83 c4 04             	add    $0x4,%esp
+  80048e:	89 c2                	mov    %eax,%edx
+  800490:	85 c0                	test   %eax,%eax
+  800492:	7f 3c                	jg     8004d0 <sys_ipc_recv+0x76>
+  800494:	89 d0                	mov    %edx,%eax
+  800496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800499:	5b                   	pop    %ebx
+  80049a:	5e                   	pop    %esi
+  80049b:	5f                   	pop    %edi
+  80049c:	5d                   	pop    %ebp
+  80049d:	c3                   	ret
+  80049e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ab:	89 cb                	mov    %ecx,%ebx
+  8004ad:	89 cf                	mov    %ecx,%edi
+  8004af:	89 ce                	mov    %ecx,%esi
+  8004b1:	cd 30                	int    $0x30
+  8004b3:	89 c2                	mov    %eax,%edx
+  8004b5:	85 c0                	test   %eax,%eax
+  8004b7:	7e db                	jle    800494 <sys_ipc_recv+0x3a>
+  8004b9:	83 ec 0c             	sub    $0xc,%esp
+  8004bc:	50                   	push   %eax
+  8004bd:	6a 0d                	push   $0xd
+  8004bf:	68 98 31 80 00       	push   $0x803198
+  8004c4:	6a 24                	push   $0x24
+  8004c6:	68 b5 31 80 00       	push   $0x8031b5
+  8004cb:	e8 ac 1c 00 00       	call   80217c <_panic>
+  8004d0:	83 ec 0c             	sub    $0xc,%esp
+  8004d3:	50                   	push   %eax
+  8004d4:	6a 0d                	push   $0xd
+  8004d6:	68 98 31 80 00       	push   $0x803198
+  8004db:	6a 48                	push   $0x48
+  8004dd:	68 b5 31 80 00       	push   $0x8031b5
+  8004e2:	e8 95 1c 00 00       	call   80217c <_panic>
+
+008004e7 <sys_ipc_send>:
+  8004e7:	55                   	push   %ebp
+  8004e8:	89 e5                	mov    %esp,%ebp
+  8004ea:	57                   	push   %edi
+  8004eb:	56                   	push   %esi
+  8004ec:	53                   	push   %ebx
+  8004ed:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004f4:	74 27                	je     80051d <sys_ipc_send+0x36>
+  8004f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800501:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800504:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800507:	6a 00                	push   $0x0
+  800509:	55                   	push   %ebp
+  80050a:	89 e5                	mov    %esp,%ebp
+  80050c:	8d 35 14 05 80 00    	lea    0x800514,%esi
+  800512:	0f 34                	sysenter
+  800514:	5d                   	pop    %ebp
+  800515:	83 c4 04             	add    $0x4,%esp
+  800518:	5b                   	pop    %ebx
+  800519:	5e                   	pop    %esi
+  80051a:	5f                   	pop    %edi
+  80051b:	5d                   	pop    %ebp
+  80051c:	c3                   	ret
+  80051d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800522:	be 00 00 00 00       	mov    $0x0,%esi
+  800527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800530:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800533:	cd 30                	int    $0x30
+  800535:	eb e1                	jmp    800518 <sys_ipc_send+0x31>
+
+00800537 <sys_ipc_call>:
+  800537:	55                   	push   %ebp
+  800538:	89 e5                	mov    %esp,%ebp
+  80053a:	57                   	push   %edi
+  80053b:	56                   	push   %esi
+  80053c:	53                   	push   %ebx
+  80053d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800540:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800543:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800548:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80054b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80054e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800551:	cd 30                	int    $0x30
+  800553:	5b                   	pop    %ebx
+  800554:	5e                   	pop    %esi
+  800555:	5f                   	pop    %edi
+  800556:	5d                   	pop    %ebp
+  800557:	c3                   	ret
+
+00800558 <sys_ipc_reply_recv>:
+  800558:	55                   	push   %ebp
+  800559:	89 e5                	mov    %esp,%ebp
+  80055b:	57                   	push   %edi
+  80055c:	56                   	push   %esi
+  80055d:	53                   	push   %ebx
+  80055e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800561:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800564:	b8 10 00 00 00       	mov    $0x10,%eax
+  800569:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80056c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80056f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800572:	cd 30                	int    $0x30
+  800574:	5b                   	pop    %ebx
+  800575:	5e                   	pop    %esi
+  800576:	5f                   	pop    %edi
+  800577:	5d                   	pop    %ebp
+  800578:	c3                   	ret
+
+00800579 <sys_time_msec>:
+  800579:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80057e:	85 c0                	test   %eax,%eax
+  800580:	75 06                	jne    800588 <sys_time_msec+0xf>
+  800582:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  800587:	c3                   	ret
+  800588:	55                   	push   %ebp
+  800589:	89 e5                	mov    %esp,%ebp
+  80058b:	57                   	push   %edi
+  80058c:	56                   	push   %esi
+  80058d:	53                   	push   %ebx
+  80058e:	83 ec 0c             	sub    $0xc,%esp
+  800591:	0f 31                	rdtsc
+  800593:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800599:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80059f:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8005a5:	29 c8                	sub    %ecx,%eax
+  8005a7:	19 da                	sbb    %ebx,%edx
+  8005a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005ae:	57                   	push   %edi
+  8005af:	56                   	push   %esi
+  8005b0:	52                   	push   %edx
+  8005b1:	50                   	push   %eax
+  8005b2:	e8 95 2a 00 00       	call   80304c <__udivdi3>
+  8005b7:	83 c4 10             	add    $0x10,%esp
+  8005ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005bd:	5b                   	pop    %ebx
+  8005be:	5e                   	pop    %esi
+  8005bf:	5f                   	pop    %edi
+  8005c0:	5d                   	pop    %ebp
+  8005c1:	c3                   	ret
+
+008005c2 <sys_env_swap>:
+  8005c2:	55                   	push   %ebp
+  8005c3:	89 e5                	mov    %esp,%ebp
+  8005c5:	57                   	push   %edi
+  8005c6:	56                   	push   %esi
+  8005c7:	53                   	push   %ebx
+  8005c8:	83 ec 0c             	sub    $0xc,%esp
+  8005cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005d8:	89 cb                	mov    %ecx,%ebx
+  8005da:	89 cf                	mov    %ecx,%edi
+  8005dc:	89 ce                	mov    %ecx,%esi
+  8005de:	cd 30                	int    $0x30
+  8005e0:	85 c0                	test   %eax,%eax
+  8005e2:	7f 08                	jg     8005ec <sys_env_swap+0x2a>
+  8005e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e7:	5b                   	pop    %ebx
+  8005e8:	5e                   	pop    %esi
+  8005e9:	5f                   	pop    %edi
+  8005ea:	5d                   	pop    %ebp
+  8005eb:	c3                   	ret
+  8005ec:	83 ec 0c             	sub    $0xc,%esp
+  8005ef:	50                   	push   %eax
+  8005f0:	6a 12                	push   $0x12
+  8005f2:	68 98 31 80 00       	push   $0x803198
+  8005f7:	6a 24                	push   $0x24
+  8005f9:	68 b5 31 80 00       	push   $0x8031b5
+  8005fe:	e8 79 1b 00 00       	call   80217c <_panic>
+
+00800603 <sys_net_try_send>:
+  800603:	55                   	push   %ebp
+  800604:	89 e5                	mov    %esp,%ebp
+  800606:	57                   	push   %edi
+  800607:	56                   	push   %esi
+  800608:	53                   	push   %ebx
+  800609:	83 ec 0c             	sub    $0xc,%esp
+  80060c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800611:	8b 55 08             	mov    0x8(%ebp),%edx
+  800614:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800617:	b8 13 00 00 00       	mov    $0x13,%eax
+  80061c:	89 df                	mov    %ebx,%edi
+  80061e:	89 de                	mov    %ebx,%esi
+  800620:	cd 30                	int    $0x30
+  800622:	85 c0                	test   %eax,%eax
+  800624:	7f 08                	jg     80062e <sys_net_try_send+0x2b>
+  800626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800629:	5b                   	pop    %ebx
+  80062a:	5e                   	pop    %esi
+  80062b:	5f                   	pop    %edi
+  80062c:	5d                   	pop    %ebp
+  80062d:	c3                   	ret
+  80062e:	83 ec 0c             	sub    $0xc,%esp
+  800631:	50                   	push   %eax
+  800632:	6a 13                	push   $0x13
+  800634:	68 98 31 80 00       	push   $0x803198
+  800639:	6a 24                	push   $0x24
+  80063b:	68 b5 31 80 00       	push   $0x8031b5
+  800640:	e8 37 1b 00 00       	call   80217c <_panic>
+
+00800645 <sys_net_try_receive>:
+  800645:	55                   	push   %ebp
+  800646:	89 e5                	mov    %esp,%ebp
+  800648:	57                   	push   %edi
+  800649:	56                   	push   %esi
+  80064a:	53                   	push   %ebx
+  80064b:	83 ec 0c             	sub    $0xc,%esp
+  80064e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800653:	8b 55 08             	mov    0x8(%ebp),%edx
+  800656:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800659:	b8 14 00 00 00       	mov    $0x14,%eax
+  80065e:	89 df                	mov    %ebx,%edi
+  800660:	89 de                	mov    %ebx,%esi
+  800662:	cd 30                	int    $0x30
+  800664:	85 c0                	test   %eax,%eax
+  800666:	7f 08                	jg     800670 <sys_net_try_receive+0x2b>
+  800668:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80066b:	5b                   	pop    %ebx
+  80066c:	5e                   	pop    %esi
+  80066d:	5f                   	pop    %edi
+  80066e:	5d                   	pop    %ebp
+  80066f:	c3                   	ret
+  800670:	83 ec 0c             	sub    $0xc,%esp
+  800673:	50                   	push   %eax
+  800674:	6a 14                	push   $0x14
+  800676:	68 98 31 80 00       	push   $0x803198
+  80067b:	6a 24                	push   $0x24
+  80067d:	68 b5 31 80 00       	push   $0x8031b5
+  800682:	e8 f5 1a 00 00       	call   80217c <_panic>
+
+00800687 <sys_net_recv_page>:
+  800687:	55                   	push   %ebp
+  800688:	89 e5                	mov    %esp,%ebp
+  80068a:	57                   	push   %edi
+  80068b:	56                   	push   %esi
+  80068c:	53                   	push   %ebx
+  80068d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800692:	8b 55 08             	mov    0x8(%ebp),%edx
+  800695:	b8 27 00 00 00       	mov    $0x27,%eax
+  80069a:	89 cb                	mov    %ecx,%ebx
+  80069c:	89 cf                	mov    %ecx,%edi
+  80069e:	89 ce                	mov    %ecx,%esi
+  8006a0:	cd 30                	int    $0x30
+  8006a2:	5b                   	pop    %ebx
+  8006a3:	5e                   	pop    %esi
+  8006a4:	5f                   	pop    %edi
+  8006a5:	5d                   	pop    %ebp
+  8006a6:	c3                   	ret
+
+008006a7 <sys_net_wait>:
+  8006a7:	55                   	push   %ebp
+  8006a8:	89 e5                	mov    %esp,%ebp
+  8006aa:	57                   	push   %edi
+  8006ab:	56                   	push   %esi
+  8006ac:	53                   	push   %ebx
+  8006ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006b2:	b8 26 00 00 00       	mov    $0x26,%eax
+  8006b7:	89 d1                	mov    %edx,%ecx
+  8006b9:	89 d3                	mov    %edx,%ebx
+  8006bb:	89 d7                	mov    %edx,%edi
+  8006bd:	89 d6                	mov    %edx,%esi
+  8006bf:	cd 30                	int    $0x30
+  8006c1:	5b                   	pop    %ebx
+  8006c2:	5e                   	pop    %esi
+  8006c3:	5f                   	pop    %edi
+  8006c4:	5d                   	pop    %ebp
+  8006c5:	c3                   	ret
+
+008006c6 <sys_get_mac>:
+  8006c6:	55                   	push   %ebp
+  8006c7:	89 e5                	mov    %esp,%ebp
+  8006c9:	57                   	push   %edi
+  8006ca:	56                   	push   %esi
+  8006cb:	53                   	push   %ebx
+  8006cc:	83 ec 0c             	sub    $0xc,%esp
+  8006cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006da:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006df:	89 df                	mov    %ebx,%edi
+  8006e1:	89 de                	mov    %ebx,%esi
+  8006e3:	cd 30                	int    $0x30
+  8006e5:	85 c0                	test   %eax,%eax
+  8006e7:	7f 08                	jg     8006f1 <sys_get_mac+0x2b>
+  8006e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ec:	5b                   	pop    %ebx
+  8006ed:	5e                   	pop    %esi
+  8006ee:	5f                   	pop    %edi
+  8006ef:	5d                   	pop    %ebp
+  8006f0:	c3                   	ret
+  8006f1:	83 ec 0c             	sub    $0xc,%esp
+  8006f4:	50                   	push   %eax
+  8006f5:	6a 15                	push   $0x15
+  8006f7:	68 98 31 80 00       	push   $0x803198
+  8006fc:	6a 24                	push   $0x24
+  8006fe:	68 b5 31 80 00       	push   $0x8031b5
+  800703:	e8 74 1a 00 00       	call   80217c <_panic>
+
+00800708 <sys_env_lease>:
+  800708:	55                   	push   %ebp
+  800709:	89 e5                	mov    %esp,%ebp
+  80070b:	57                   	push   %edi
+  80070c:	56                   	push   %esi
+  80070d:	53                   	push   %ebx
+  80070e:	83 ec 0c             	sub    $0xc,%esp
+  800711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800716:	8b 55 08             	mov    0x8(%ebp),%edx
+  800719:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80071c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800721:	89 df                	mov    %ebx,%edi
+  800723:	89 de                	mov    %ebx,%esi
+  800725:	cd 30                	int    $0x30
+  800727:	85 c0                	test   %eax,%eax
+  800729:	7f 08                	jg     800733 <sys_env_lease+0x2b>
+  80072b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80072e:	5b                   	pop    %ebx
+  80072f:	5e                   	pop    %esi
+  800730:	5f                   	pop    %edi
+  800731:	5d                   	pop    %ebp
+  800732:	c3                   	ret
+  800733:	83 ec 0c             	sub    $0xc,%esp
+  800736:	50                   	push   %eax
+  800737:	6a 16                	push   $0x16
+  800739:	68 98 31 80 00       	push   $0x803198
+  80073e:	6a 24                	push   $0x24
+  800740:	68 b5 31 80 00       	push   $0x8031b5
+  800745:	e8 32 1a 00 00       	call   80217c <_panic>
+
+0080074a <sys_copy_mem>:
+  80074a:	55                   	push   %ebp
+  80074b:	89 e5                	mov    %esp,%ebp
+  80074d:	57                   	push   %edi
+  80074e:	56                   	push   %esi
+  80074f:	53                   	push   %ebx
+  800750:	83 ec 0c             	sub    $0xc,%esp
+  800753:	8b 55 08             	mov    0x8(%ebp),%edx
+  800756:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800759:	b8 17 00 00 00       	mov    $0x17,%eax
+  80075e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800761:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800764:	8b 75 18             	mov    0x18(%ebp),%esi
+  800767:	cd 30                	int    $0x30
+  800769:	85 c0                	test   %eax,%eax
+  80076b:	7f 08                	jg     800775 <sys_copy_mem+0x2b>
+  80076d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800770:	5b                   	pop    %ebx
+  800771:	5e                   	pop    %esi
+  800772:	5f                   	pop    %edi
+  800773:	5d                   	pop    %ebp
+  800774:	c3                   	ret
+  800775:	83 ec 0c             	sub    $0xc,%esp
+  800778:	50                   	push   %eax
+  800779:	6a 17                	push   $0x17
+  80077b:	68 98 31 80 00       	push   $0x803198
+  800780:	6a 24                	push   $0x24
+  800782:	68 b5 31 80 00       	push   $0x8031b5
+  800787:	e8 f0 19 00 00       	call   80217c <_panic>
+
+0080078c <sys_get_perms>:
+  80078c:	55                   	push   %ebp
+  80078d:	89 e5                	mov    %esp,%ebp
+  80078f:	57                   	push   %edi
+  800790:	56                   	push   %esi
+  800791:	53                   	push   %ebx
+  800792:	83 ec 0c             	sub    $0xc,%esp
+  800795:	be 00 00 00 00       	mov    $0x0,%esi
+  80079a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80079d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007a0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8007a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007a8:	89 f7                	mov    %esi,%edi
+  8007aa:	cd 30                	int    $0x30
+  8007ac:	85 c0                	test   %eax,%eax
+  8007ae:	7f 08                	jg     8007b8 <sys_get_perms+0x2c>
+  8007b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007b3:	5b                   	pop    %ebx
+  8007b4:	5e                   	pop    %esi
+  8007b5:	5f                   	pop    %edi
+  8007b6:	5d                   	pop    %ebp
+  8007b7:	c3                   	ret
+  8007b8:	83 ec 0c             	sub    $0xc,%esp
+  8007bb:	50                   	push   %eax
+  8007bc:	6a 18                	push   $0x18
+  8007be:	68 98 31 80 00       	push   $0x803198
+  8007c3:	6a 24                	push   $0x24
+  8007c5:	68 b5 31 80 00       	push   $0x8031b5
+  8007ca:	e8 ad 19 00 00       	call   80217c <_panic>
+
+008007cf <sys_env_unsuspend>:
+  8007cf:	55                   	push   %ebp
+  8007d0:	89 e5                	mov    %esp,%ebp
+  8007d2:	57                   	push   %edi
+  8007d3:	56                   	push   %esi
+  8007d4:	53                   	push   %ebx
+  8007d5:	83 ec 0c             	sub    $0xc,%esp
+  8007d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8007dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e3:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007eb:	89 f7                	mov    %esi,%edi
+  8007ed:	cd 30                	int    $0x30
+  8007ef:	85 c0                	test   %eax,%eax
+  8007f1:	7f 08                	jg     8007fb <sys_env_unsuspend+0x2c>
+  8007f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007f6:	5b                   	pop    %ebx
+  8007f7:	5e                   	pop    %esi
+  8007f8:	5f                   	pop    %edi
+  8007f9:	5d                   	pop    %ebp
+  8007fa:	c3                   	ret
+  8007fb:	83 ec 0c             	sub    $0xc,%esp
+  8007fe:	50                   	push   %eax
+  8007ff:	6a 19                	push   $0x19
+  800801:	68 98 31 80 00       	push   $0x803198
+  800806:	6a 24                	push   $0x24
+  800808:	68 b5 31 80 00       	push   $0x8031b5
+  80080d:	e8 6a 19 00 00       	call   80217c <_panic>
+
+00800812 <sys_migrate>:
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	57                   	push   %edi
+  800816:	56                   	push   %esi
+  800817:	53                   	push   %ebx
+  800818:	83 ec 0c             	sub    $0xc,%esp
+  80081b:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800820:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  800826:	76 11                	jbe    800839 <sys_migrate+0x27>
+  800828:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80082d:	0f b6 08             	movzbl (%eax),%ecx
+  800830:	05 00 10 00 00       	add    $0x1000,%eax
+  800835:	39 d0                	cmp    %edx,%eax
+  800837:	72 f4                	jb     80082d <sys_migrate+0x1b>
+  800839:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800841:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800846:	89 cb                	mov    %ecx,%ebx
+  800848:	89 cf                	mov    %ecx,%edi
+  80084a:	89 ce                	mov    %ecx,%esi
+  80084c:	cd 30                	int    $0x30
+  80084e:	85 c0                	test   %eax,%eax
+  800850:	7f 08                	jg     80085a <sys_migrate+0x48>
+  800852:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800855:	5b                   	pop    %ebx
+  800856:	5e                   	pop    %esi
+  800857:	5f                   	pop    %edi
+  800858:	5d                   	pop    %ebp
+  800859:	c3                   	ret
+  80085a:	83 ec 0c             	sub    $0xc,%esp
+  80085d:	50                   	push   %eax
+  80085e:	6a 1a                	push   $0x1a
+  800860:	68 98 31 80 00       	push   $0x803198
+  800865:	6a 24                	push   $0x24
+  800867:	68 b5 31 80 00       	push   $0x8031b5
+  80086c:	e8 0b 19 00 00       	call   80217c <_panic>
+
+00800871 <sys_lease_complete>:
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	57                   	push   %edi
+  800875:	56                   	push   %esi
+  800876:	53                   	push   %ebx
+  800877:	83 ec 0c             	sub    $0xc,%esp
+  80087a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80087f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800884:	89 d1                	mov    %edx,%ecx
+  800886:	89 d3                	mov    %edx,%ebx
+  800888:	89 d7                	mov    %edx,%edi
+  80088a:	89 d6                	mov    %edx,%esi
+  80088c:	cd 30                	int    $0x30
+  80088e:	85 c0                	test   %eax,%eax
+  800890:	7f 08                	jg     80089a <sys_lease_complete+0x29>
+  800892:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800895:	5b                   	pop    %ebx
+  800896:	5e                   	pop    %esi
+  800897:	5f                   	pop    %edi
+  800898:	5d                   	pop    %ebp
+  800899:	c3                   	ret
+  80089a:	83 ec 0c             	sub    $0xc,%esp
+  80089d:	50                   	push   %eax
+  80089e:	6a 1b                	push   $0x1b
+  8008a0:	68 98 31 80 00       	push   $0x803198
+  8008a5:	6a 24                	push   $0x24
+  8008a7:	68 b5 31 80 00       	push   $0x8031b5
+  8008ac:	e8 cb 18 00 00       	call   80217c <_panic>
+
+008008b1 <sys_env_set_thisenv>:
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	57                   	push   %edi
+  8008b5:	56                   	push   %esi
+  8008b6:	53                   	push   %ebx
+  8008b7:	83 ec 0c             	sub    $0xc,%esp
+  8008ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008ca:	89 df                	mov    %ebx,%edi
+  8008cc:	89 de                	mov    %ebx,%esi
+  8008ce:	cd 30                	int    $0x30
+  8008d0:	85 c0                	test   %eax,%eax
+  8008d2:	7f 08                	jg     8008dc <sys_env_set_thisenv+0x2b>
+  8008d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d7:	5b                   	pop    %ebx
+  8008d8:	5e                   	pop    %esi
+  8008d9:	5f                   	pop    %edi
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+  8008dc:	83 ec 0c             	sub    $0xc,%esp
+  8008df:	50                   	push   %eax
+  8008e0:	6a 1c                	push   $0x1c
+  8008e2:	68 98 31 80 00       	push   $0x803198
+  8008e7:	6a 24                	push   $0x24
+  8008e9:	68 b5 31 80 00       	push   $0x8031b5
+  8008ee:	e8 89 18 00 00       	call   80217c <_panic>
+
+008008f3 <sys_env_set_sched>:
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	57                   	push   %edi
+  8008f7:	56                   	push   %esi
+  8008f8:	53                   	push   %ebx
+  8008f9:	83 ec 0c             	sub    $0xc,%esp
+  8008fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800901:	8b 55 08             	mov    0x8(%ebp),%edx
+  800904:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800907:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80090c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80090f:	89 f7                	mov    %esi,%edi
+  800911:	cd 30                	int    $0x30
+  800913:	85 c0                	test   %eax,%eax
+  800915:	7f 08                	jg     80091f <sys_env_set_sched+0x2c>
+  800917:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80091a:	5b                   	pop    %ebx
+  80091b:	5e                   	pop    %esi
+  80091c:	5f                   	pop    %edi
+  80091d:	5d                   	pop    %ebp
+  80091e:	c3                   	ret
+  80091f:	83 ec 0c             	sub    $0xc,%esp
+  800922:	50                   	push   %eax
+  800923:	6a 1d                	push   $0x1d
+  800925:	68 98 31 80 00       	push   $0x803198
+  80092a:	6a 24                	push   $0x24
+  80092c:	68 b5 31 80 00       	push   $0x8031b5
+  800931:	e8 46 18 00 00       	call   80217c <_panic>
+
+00800936 <sys_batch>:
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	57                   	push   %edi
+  80093a:	56                   	push   %esi
+  80093b:	53                   	push   %ebx
+  80093c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800941:	8b 55 08             	mov    0x8(%ebp),%edx
+  800944:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800947:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80094c:	89 df                	mov    %ebx,%edi
+  80094e:	89 de                	mov    %ebx,%esi
+  800950:	cd 30                	int    $0x30
+  800952:	5b                   	pop    %ebx
+  800953:	5e                   	pop    %esi
+  800954:	5f                   	pop    %edi
+  800955:	5d                   	pop    %ebp
+  800956:	c3                   	ret
+
+00800957 <sys_env_stats>:
+  800957:	55                   	push   %ebp
+  800958:	89 e5                	mov    %esp,%ebp
+  80095a:	57                   	push   %edi
+  80095b:	56                   	push   %esi
+  80095c:	53                   	push   %ebx
+  80095d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800962:	8b 55 08             	mov    0x8(%ebp),%edx
+  800965:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800968:	b8 23 00 00 00       	mov    $0x23,%eax
+  80096d:	89 df                	mov    %ebx,%edi
+  80096f:	89 de                	mov    %ebx,%esi
+  800971:	cd 30                	int    $0x30
+  800973:	5b                   	pop    %ebx
+  800974:	5e                   	pop    %esi
+  800975:	5f                   	pop    %edi
+  800976:	5d                   	pop    %ebp
+  800977:	c3                   	ret
+
+00800978 <sys_trace>:
+  800978:	55                   	push   %ebp
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	57                   	push   %edi
+  80097c:	56                   	push   %esi
+  80097d:	53                   	push   %ebx
+  80097e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800983:	8b 55 08             	mov    0x8(%ebp),%edx
+  800986:	b8 24 00 00 00       	mov    $0x24,%eax
+  80098b:	89 cb                	mov    %ecx,%ebx
+  80098d:	89 cf                	mov    %ecx,%edi
+  80098f:	89 ce                	mov    %ecx,%esi
+  800991:	cd 30                	int    $0x30
+  800993:	5b                   	pop    %ebx
+  800994:	5e                   	pop    %esi
+  800995:	5f                   	pop    %edi
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <sys_env_set_pager>:
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	57                   	push   %edi
+  80099c:	56                   	push   %esi
+  80099d:	53                   	push   %ebx
+  80099e:	83 ec 0c             	sub    $0xc,%esp
+  8009a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8009a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ac:	b8 25 00 00 00       	mov    $0x25,%eax
+  8009b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009b4:	89 f7                	mov    %esi,%edi
+  8009b6:	cd 30                	int    $0x30
+  8009b8:	85 c0                	test   %eax,%eax
+  8009ba:	7f 08                	jg     8009c4 <sys_env_set_pager+0x2c>
+  8009bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bf:	5b                   	pop    %ebx
+  8009c0:	5e                   	pop    %esi
+  8009c1:	5f                   	pop    %edi
+  8009c2:	5d                   	pop    %ebp
+  8009c3:	c3                   	ret
+  8009c4:	83 ec 0c             	sub    $0xc,%esp
+  8009c7:	50                   	push   %eax
+  8009c8:	6a 25                	push   $0x25
+  8009ca:	68 98 31 80 00       	push   $0x803198
+  8009cf:	6a 24                	push   $0x24
+  8009d1:	68 b5 31 80 00       	push   $0x8031b5
+  8009d6:	e8 a1 17 00 00       	call   80217c <_panic>
+
+008009db <sys_pager_retire>:
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	57                   	push   %edi
+  8009df:	56                   	push   %esi
+  8009e0:	53                   	push   %ebx
+  8009e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009ee:	89 cb                	mov    %ecx,%ebx
+  8009f0:	89 cf                	mov    %ecx,%edi
+  8009f2:	89 ce                	mov    %ecx,%esi
+  8009f4:	cd 30                	int    $0x30
+  8009f6:	5b                   	pop    %ebx
+  8009f7:	5e                   	pop    %esi
+  8009f8:	5f                   	pop    %edi
+  8009f9:	5d                   	pop    %ebp
+  8009fa:	c3                   	ret
+
+008009fb <sys_prof>:
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	57                   	push   %edi
+  8009ff:	56                   	push   %esi
+  800a00:	53                   	push   %ebx
+  800a01:	be 00 00 00 00       	mov    $0x0,%esi
+  800a06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a0c:	b8 22 00 00 00       	mov    $0x22,%eax
+  800a11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a14:	89 f7                	mov    %esi,%edi
+  800a16:	cd 30                	int    $0x30
+  800a18:	5b                   	pop    %ebx
+  800a19:	5e                   	pop    %esi
+  800a1a:	5f                   	pop    %edi
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+
+00800a1d <fd2num>:
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a28:	c1 e8 0c             	shr    $0xc,%eax
+  800a2b:	5d                   	pop    %ebp
+  800a2c:	c3                   	ret
+
+00800a2d <fd2data>:
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a33:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a38:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a3d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <fd_alloc>:
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a4c:	89 c2                	mov    %eax,%edx
+  800a4e:	c1 ea 16             	shr    $0x16,%edx
+  800a51:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a58:	f6 c2 01             	test   $0x1,%dl
+  800a5b:	74 29                	je     800a86 <fd_alloc+0x42>
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	c1 ea 0c             	shr    $0xc,%edx
+  800a62:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a69:	f6 c2 01             	test   $0x1,%dl
+  800a6c:	74 18                	je     800a86 <fd_alloc+0x42>
+  800a6e:	05 00 10 00 00       	add    $0x1000,%eax
+  800a73:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a78:	75 d2                	jne    800a4c <fd_alloc+0x8>
+  800a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a84:	eb 05                	jmp    800a8b <fd_alloc+0x47>
+  800a86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a8e:	89 02                	mov    %eax,(%edx)
+  800a90:	89 c8                	mov    %ecx,%eax
+  800a92:	5d                   	pop    %ebp
+  800a93:	c3                   	ret
+
+00800a94 <fd_lookup>:
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9a:	83 f8 1f             	cmp    $0x1f,%eax
+  800a9d:	77 30                	ja     800acf <fd_lookup+0x3b>
+  800a9f:	c1 e0 0c             	shl    $0xc,%eax
+  800aa2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800aa7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800aad:	f6 c2 01             	test   $0x1,%dl
+  800ab0:	74 24                	je     800ad6 <fd_lookup+0x42>
+  800ab2:	89 c2                	mov    %eax,%edx
+  800ab4:	c1 ea 0c             	shr    $0xc,%edx
+  800ab7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800abe:	f6 c2 01             	test   $0x1,%dl
+  800ac1:	74 1a                	je     800add <fd_lookup+0x49>
+  800ac3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac6:	89 02                	mov    %eax,(%edx)
+  800ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acd:	5d                   	pop    %ebp
+  800ace:	c3                   	ret
+  800acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad4:	eb f7                	jmp    800acd <fd_lookup+0x39>
+  800ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800adb:	eb f0                	jmp    800acd <fd_lookup+0x39>
+  800add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae2:	eb e9                	jmp    800acd <fd_lookup+0x39>
+
+00800ae4 <dev_lookup>:
+  800ae4:	55                   	push   %ebp
+  800ae5:	89 e5                	mov    %esp,%ebp
+  800ae7:	53                   	push   %ebx
+  800ae8:	83 ec 04             	sub    $0x4,%esp
+  800aeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af3:	bb 08 40 80 00       	mov    $0x804008,%ebx
+  800af8:	39 13                	cmp    %edx,(%ebx)
+  800afa:	74 37                	je     800b33 <dev_lookup+0x4f>
+  800afc:	83 c0 01             	add    $0x1,%eax
+  800aff:	8b 1c 85 40 32 80 00 	mov    0x803240(,%eax,4),%ebx
+  800b06:	85 db                	test   %ebx,%ebx
+  800b08:	75 ee                	jne    800af8 <dev_lookup+0x14>
+  800b0a:	a1 10 50 80 00       	mov    0x805010,%eax
+  800b0f:	8b 40 48             	mov    0x48(%eax),%eax
+  800b12:	83 ec 04             	sub    $0x4,%esp
+  800b15:	52                   	push   %edx
+  800b16:	50                   	push   %eax
+  800b17:	68 c4 31 80 00       	push   $0x8031c4
+  800b1c:	e8 36 17 00 00       	call   802257 <cprintf>
+  800b21:	83 c4 10             	add    $0x10,%esp
+  800b24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b2c:	89 1a                	mov    %ebx,(%edx)
+  800b2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b31:	c9                   	leave
+  800b32:	c3                   	ret
+  800b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b38:	eb ef                	jmp    800b29 <dev_lookup+0x45>
+
+00800b3a <fd_close>:
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	57                   	push   %edi
+  800b3e:	56                   	push   %esi
+  800b3f:	53                   	push   %ebx
+  800b40:	83 ec 24             	sub    $0x24,%esp
+  800b43:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b46:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b49:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b4c:	50                   	push   %eax
+  800b4d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b53:	c1 e8 0c             	shr    $0xc,%eax
+  800b56:	50                   	push   %eax
+  800b57:	e8 38 ff ff ff       	call   800a94 <fd_lookup>
+  800b5c:	89 c3                	mov    %eax,%ebx
+  800b5e:	83 c4 10             	add    $0x10,%esp
+  800b61:	85 c0                	test   %eax,%eax
+  800b63:	78 05                	js     800b6a <fd_close+0x30>
+  800b65:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b68:	74 0f                	je     800b79 <fd_close+0x3f>
+  800b6a:	85 ff                	test   %edi,%edi
+  800b6c:	0f 44 df             	cmove  %edi,%ebx
+  800b6f:	89 d8                	mov    %ebx,%eax
+  800b71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b74:	5b                   	pop    %ebx
+  800b75:	5e                   	pop    %esi
+  800b76:	5f                   	pop    %edi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+  800b79:	83 ec 08             	sub    $0x8,%esp
+  800b7c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b7f:	50                   	push   %eax
+  800b80:	ff 36                	push   (%esi)
+  800b82:	e8 5d ff ff ff       	call   800ae4 <dev_lookup>
+  800b87:	89 c3                	mov    %eax,%ebx
+  800b89:	83 c4 10             	add    $0x10,%esp
+  800b8c:	85 c0                	test   %eax,%eax
+  800b8e:	78 1a                	js     800baa <fd_close+0x70>
+  800b90:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b93:	8b 40 10             	mov    0x10(%eax),%eax
+  800b96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b9b:	85 c0                	test   %eax,%eax
+  800b9d:	74 0b                	je     800baa <fd_close+0x70>
+  800b9f:	83 ec 0c             	sub    $0xc,%esp
+  800ba2:	56                   	push   %esi
+  800ba3:	ff d0                	call   *%eax
+  800ba5:	89 c3                	mov    %eax,%ebx
+  800ba7:	83 c4 10             	add    $0x10,%esp
+  800baa:	83 ec 08             	sub    $0x8,%esp
+  800bad:	56                   	push   %esi
+  800bae:	6a 00                	push   $0x0
+  800bb0:	e8 cc f6 ff ff       	call   800281 <sys_page_unmap>
+  800bb5:	83 c4 10             	add    $0x10,%esp
+  800bb8:	eb b5                	jmp    800b6f <fd_close+0x35>
+
+00800bba <close>:
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	83 ec 20             	sub    $0x20,%esp
+  800bc0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bc3:	50                   	push   %eax
+  800bc4:	ff 75 08             	push   0x8(%ebp)
+  800bc7:	e8 c8 fe ff ff       	call   800a94 <fd_lookup>
+  800bcc:	83 c4 10             	add    $0x10,%esp
+  800bcf:	85 c0                	test   %eax,%eax
+  800bd1:	79 02                	jns    800bd5 <close+0x1b>
+  800bd3:	c9                   	leave
+  800bd4:	c3                   	ret
+  800bd5:	83 ec 08             	sub    $0x8,%esp
+  800bd8:	6a 01                	push   $0x1
+  800bda:	ff 75 f4             	push   -0xc(%ebp)
+  800bdd:	e8 58 ff ff ff       	call   800b3a <fd_close>
+  800be2:	83 c4 10             	add    $0x10,%esp
+  800be5:	eb ec                	jmp    800bd3 <close+0x19>
+
+00800be7 <close_all>:
+  800be7:	55                   	push   %ebp
+  800be8:	89 e5                	mov    %esp,%ebp
+  800bea:	53                   	push   %ebx
+  800beb:	83 ec 04             	sub    $0x4,%esp
+  800bee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bf3:	83 ec 0c             	sub    $0xc,%esp
+  800bf6:	53                   	push   %ebx
+  800bf7:	e8 be ff ff ff       	call   800bba <close>
+  800bfc:	83 c3 01             	add    $0x1,%ebx
+  800bff:	83 c4 10             	add    $0x10,%esp
+  800c02:	83 fb 20             	cmp    $0x20,%ebx
+  800c05:	75 ec                	jne    800bf3 <close_all+0xc>
+  800c07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c0a:	c9                   	leave
+  800c0b:	c3                   	ret
+
+00800c0c <dup>:
+  800c0c:	55                   	push   %ebp
+  800c0d:	89 e5                	mov    %esp,%ebp
+  800c0f:	57                   	push   %edi
+  800c10:	56                   	push   %esi
+  800c11:	53                   	push   %ebx
+  800c12:	83 ec 34             	sub    $0x34,%esp
+  800c15:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c18:	50                   	push   %eax
+  800c19:	ff 75 08             	push   0x8(%ebp)
+  800c1c:	e8 73 fe ff ff       	call   800a94 <fd_lookup>
+  800c21:	89 c3                	mov    %eax,%ebx
+  800c23:	83 c4 10             	add    $0x10,%esp
+  800c26:	85 c0                	test   %eax,%eax
+  800c28:	78 7f                	js     800ca9 <dup+0x9d>
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+  800c2d:	ff 75 0c             	push   0xc(%ebp)
+  800c30:	e8 85 ff ff ff       	call   800bba <close>
+  800c35:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c38:	c1 e6 0c             	shl    $0xc,%esi
+  800c3b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c41:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c44:	89 3c 24             	mov    %edi,(%esp)
+  800c47:	e8 e1 fd ff ff       	call   800a2d <fd2data>
+  800c4c:	89 c3                	mov    %eax,%ebx
+  800c4e:	89 34 24             	mov    %esi,(%esp)
+  800c51:	e8 d7 fd ff ff       	call   800a2d <fd2data>
+  800c56:	83 c4 10             	add    $0x10,%esp
+  800c59:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c5c:	89 d8                	mov    %ebx,%eax
+  800c5e:	c1 e8 16             	shr    $0x16,%eax
+  800c61:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c68:	a8 01                	test   $0x1,%al
+  800c6a:	74 11                	je     800c7d <dup+0x71>
+  800c6c:	89 d8                	mov    %ebx,%eax
+  800c6e:	c1 e8 0c             	shr    $0xc,%eax
+  800c71:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c78:	f6 c2 01             	test   $0x1,%dl
+  800c7b:	75 36                	jne    800cb3 <dup+0xa7>
+  800c7d:	89 f8                	mov    %edi,%eax
+  800c7f:	c1 e8 0c             	shr    $0xc,%eax
+  800c82:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c89:	83 ec 0c             	sub    $0xc,%esp
+  800c8c:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c91:	50                   	push   %eax
+  800c92:	56                   	push   %esi
+  800c93:	6a 00                	push   $0x0
+  800c95:	57                   	push   %edi
+  800c96:	6a 00                	push   $0x0
+  800c98:	e8 55 f5 ff ff       	call   8001f2 <sys_page_map>
+  800c9d:	89 c3                	mov    %eax,%ebx
+  800c9f:	83 c4 20             	add    $0x20,%esp
+  800ca2:	85 c0                	test   %eax,%eax
+  800ca4:	78 33                	js     800cd9 <dup+0xcd>
+  800ca6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ca9:	89 d8                	mov    %ebx,%eax
+  800cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+  800cb3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800cba:	83 ec 0c             	sub    $0xc,%esp
+  800cbd:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cc2:	50                   	push   %eax
+  800cc3:	ff 75 d4             	push   -0x2c(%ebp)
+  800cc6:	6a 00                	push   $0x0
+  800cc8:	53                   	push   %ebx
+  800cc9:	6a 00                	push   $0x0
+  800ccb:	e8 22 f5 ff ff       	call   8001f2 <sys_page_map>
+  800cd0:	89 c3                	mov    %eax,%ebx
+  800cd2:	83 c4 20             	add    $0x20,%esp
+  800cd5:	85 c0                	test   %eax,%eax
+  800cd7:	79 a4                	jns    800c7d <dup+0x71>
+  800cd9:	83 ec 08             	sub    $0x8,%esp
+  800cdc:	56                   	push   %esi
+  800cdd:	6a 00                	push   $0x0
+  800cdf:	e8 9d f5 ff ff       	call   800281 <sys_page_unmap>
+  800ce4:	83 c4 08             	add    $0x8,%esp
+  800ce7:	ff 75 d4             	push   -0x2c(%ebp)
+  800cea:	6a 00                	push   $0x0
+  800cec:	e8 90 f5 ff ff       	call   800281 <sys_page_unmap>
+  800cf1:	83 c4 10             	add    $0x10,%esp
+  800cf4:	eb b3                	jmp    800ca9 <dup+0x9d>
+
+00800cf6 <read>:
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+  800cfb:	83 ec 18             	sub    $0x18,%esp
+  800cfe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d01:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d04:	50                   	push   %eax
+  800d05:	56                   	push   %esi
+  800d06:	e8 89 fd ff ff       	call   800a94 <fd_lookup>
+  800d0b:	83 c4 10             	add    $0x10,%esp
+  800d0e:	85 c0                	test   %eax,%eax
+  800d10:	78 3c                	js     800d4e <read+0x58>
+  800d12:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d15:	83 ec 08             	sub    $0x8,%esp
+  800d18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d1b:	50                   	push   %eax
+  800d1c:	ff 33                	push   (%ebx)
+  800d1e:	e8 c1 fd ff ff       	call   800ae4 <dev_lookup>
+  800d23:	83 c4 10             	add    $0x10,%esp
+  800d26:	85 c0                	test   %eax,%eax
+  800d28:	78 24                	js     800d4e <read+0x58>
+  800d2a:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d2d:	83 e0 03             	and    $0x3,%eax
+  800d30:	83 f8 01             	cmp    $0x1,%eax
+  800d33:	74 20                	je     800d55 <read+0x5f>
+  800d35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d38:	8b 40 08             	mov    0x8(%eax),%eax
+  800d3b:	85 c0                	test   %eax,%eax
+  800d3d:	74 37                	je     800d76 <read+0x80>
+  800d3f:	83 ec 04             	sub    $0x4,%esp
+  800d42:	ff 75 10             	push   0x10(%ebp)
+  800d45:	ff 75 0c             	push   0xc(%ebp)
+  800d48:	53                   	push   %ebx
+  800d49:	ff d0                	call   *%eax
+  800d4b:	83 c4 10             	add    $0x10,%esp
+  800d4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5d                   	pop    %ebp
+  800d54:	c3                   	ret
+  800d55:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d5a:	8b 40 48             	mov    0x48(%eax),%eax
+  800d5d:	83 ec 04             	sub    $0x4,%esp
+  800d60:	56                   	push   %esi
+  800d61:	50                   	push   %eax
+  800d62:	68 05 32 80 00       	push   $0x803205
+  800d67:	e8 eb 14 00 00       	call   802257 <cprintf>
+  800d6c:	83 c4 10             	add    $0x10,%esp
+  800d6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d74:	eb d8                	jmp    800d4e <read+0x58>
+  800d76:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d7b:	eb d1                	jmp    800d4e <read+0x58>
+
+00800d7d <readn>:
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	57                   	push   %edi
+  800d81:	56                   	push   %esi
+  800d82:	53                   	push   %ebx
+  800d83:	83 ec 0c             	sub    $0xc,%esp
+  800d86:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d89:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d8c:	85 f6                	test   %esi,%esi
+  800d8e:	74 30                	je     800dc0 <readn+0x43>
+  800d90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9a:	83 ec 04             	sub    $0x4,%esp
+  800d9d:	89 f2                	mov    %esi,%edx
+  800d9f:	29 c2                	sub    %eax,%edx
+  800da1:	52                   	push   %edx
+  800da2:	01 f8                	add    %edi,%eax
+  800da4:	50                   	push   %eax
+  800da5:	ff 75 08             	push   0x8(%ebp)
+  800da8:	e8 49 ff ff ff       	call   800cf6 <read>
+  800dad:	83 c4 10             	add    $0x10,%esp
+  800db0:	85 c0                	test   %eax,%eax
+  800db2:	78 15                	js     800dc9 <readn+0x4c>
+  800db4:	74 11                	je     800dc7 <readn+0x4a>
+  800db6:	01 c3                	add    %eax,%ebx
+  800db8:	89 d8                	mov    %ebx,%eax
+  800dba:	39 f3                	cmp    %esi,%ebx
+  800dbc:	72 dc                	jb     800d9a <readn+0x1d>
+  800dbe:	eb 09                	jmp    800dc9 <readn+0x4c>
+  800dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc5:	eb 02                	jmp    800dc9 <readn+0x4c>
+  800dc7:	89 d8                	mov    %ebx,%eax
+  800dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+
+00800dd1 <write>:
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  800dd6:	83 ec 18             	sub    $0x18,%esp
+  800dd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ddc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ddf:	50                   	push   %eax
+  800de0:	53                   	push   %ebx
+  800de1:	e8 ae fc ff ff       	call   800a94 <fd_lookup>
+  800de6:	83 c4 10             	add    $0x10,%esp
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	78 37                	js     800e24 <write+0x53>
+  800ded:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800df0:	83 ec 08             	sub    $0x8,%esp
+  800df3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800df6:	50                   	push   %eax
+  800df7:	ff 36                	push   (%esi)
+  800df9:	e8 e6 fc ff ff       	call   800ae4 <dev_lookup>
+  800dfe:	83 c4 10             	add    $0x10,%esp
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	78 1f                	js     800e24 <write+0x53>
+  800e05:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e09:	74 20                	je     800e2b <write+0x5a>
+  800e0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e0e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	74 37                	je     800e4c <write+0x7b>
+  800e15:	83 ec 04             	sub    $0x4,%esp
+  800e18:	ff 75 10             	push   0x10(%ebp)
+  800e1b:	ff 75 0c             	push   0xc(%ebp)
+  800e1e:	56                   	push   %esi
+  800e1f:	ff d0                	call   *%eax
+  800e21:	83 c4 10             	add    $0x10,%esp
+  800e24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e27:	5b                   	pop    %ebx
+  800e28:	5e                   	pop    %esi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+  800e2b:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e30:	8b 40 48             	mov    0x48(%eax),%eax
+  800e33:	83 ec 04             	sub    $0x4,%esp
+  800e36:	53                   	push   %ebx
+  800e37:	50                   	push   %eax
+  800e38:	68 21 32 80 00       	push   $0x803221
+  800e3d:	e8 15 14 00 00       	call   802257 <cprintf>
+  800e42:	83 c4 10             	add    $0x10,%esp
+  800e45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e4a:	eb d8                	jmp    800e24 <write+0x53>
+  800e4c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e51:	eb d1                	jmp    800e24 <write+0x53>
+
+00800e53 <seek>:
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	83 ec 20             	sub    $0x20,%esp
+  800e59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e5c:	50                   	push   %eax
+  800e5d:	ff 75 08             	push   0x8(%ebp)
+  800e60:	e8 2f fc ff ff       	call   800a94 <fd_lookup>
+  800e65:	83 c4 10             	add    $0x10,%esp
+  800e68:	85 c0                	test   %eax,%eax
+  800e6a:	78 0e                	js     800e7a <seek+0x27>
+  800e6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e72:	89 50 04             	mov    %edx,0x4(%eax)
+  800e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7a:	c9                   	leave
+  800e7b:	c3                   	ret
+
+00800e7c <ftruncate>:
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	56                   	push   %esi
+  800e80:	53                   	push   %ebx
+  800e81:	83 ec 18             	sub    $0x18,%esp
+  800e84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e87:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e8a:	50                   	push   %eax
+  800e8b:	53                   	push   %ebx
+  800e8c:	e8 03 fc ff ff       	call   800a94 <fd_lookup>
+  800e91:	83 c4 10             	add    $0x10,%esp
+  800e94:	85 c0                	test   %eax,%eax
+  800e96:	78 34                	js     800ecc <ftruncate+0x50>
+  800e98:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e9b:	83 ec 08             	sub    $0x8,%esp
+  800e9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ea1:	50                   	push   %eax
+  800ea2:	ff 36                	push   (%esi)
+  800ea4:	e8 3b fc ff ff       	call   800ae4 <dev_lookup>
+  800ea9:	83 c4 10             	add    $0x10,%esp
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	78 1c                	js     800ecc <ftruncate+0x50>
+  800eb0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800eb4:	74 1d                	je     800ed3 <ftruncate+0x57>
+  800eb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb9:	8b 40 18             	mov    0x18(%eax),%eax
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	74 34                	je     800ef4 <ftruncate+0x78>
+  800ec0:	83 ec 08             	sub    $0x8,%esp
+  800ec3:	ff 75 0c             	push   0xc(%ebp)
+  800ec6:	56                   	push   %esi
+  800ec7:	ff d0                	call   *%eax
+  800ec9:	83 c4 10             	add    $0x10,%esp
+  800ecc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	c3                   	ret
+  800ed3:	a1 10 50 80 00       	mov    0x805010,%eax
+  800ed8:	8b 40 48             	mov    0x48(%eax),%eax
+  800edb:	83 ec 04             	sub    $0x4,%esp
+  800ede:	53                   	push   %ebx
+  800edf:	50                   	push   %eax
+  800ee0:	68 e4 31 80 00       	push   $0x8031e4
+  800ee5:	e8 6d 13 00 00       	call   802257 <cprintf>
+  800eea:	83 c4 10             	add    $0x10,%esp
+  800eed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef2:	eb d8                	jmp    800ecc <ftruncate+0x50>
+  800ef4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ef9:	eb d1                	jmp    800ecc <ftruncate+0x50>
+
+00800efb <fstat>:
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	56                   	push   %esi
+  800eff:	53                   	push   %ebx
+  800f00:	83 ec 18             	sub    $0x18,%esp
+  800f03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f06:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f09:	50                   	push   %eax
+  800f0a:	ff 75 08             	push   0x8(%ebp)
+  800f0d:	e8 82 fb ff ff       	call   800a94 <fd_lookup>
+  800f12:	83 c4 10             	add    $0x10,%esp
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	78 49                	js     800f62 <fstat+0x67>
+  800f19:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f1c:	83 ec 08             	sub    $0x8,%esp
+  800f1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f22:	50                   	push   %eax
+  800f23:	ff 36                	push   (%esi)
+  800f25:	e8 ba fb ff ff       	call   800ae4 <dev_lookup>
+  800f2a:	83 c4 10             	add    $0x10,%esp
+  800f2d:	85 c0                	test   %eax,%eax
+  800f2f:	78 31                	js     800f62 <fstat+0x67>
+  800f31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f34:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f38:	74 2f                	je     800f69 <fstat+0x6e>
+  800f3a:	c6 03 00             	movb   $0x0,(%ebx)
+  800f3d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f44:	00 00 00 
+  800f47:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f4e:	00 00 00 
+  800f51:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f57:	83 ec 08             	sub    $0x8,%esp
+  800f5a:	53                   	push   %ebx
+  800f5b:	56                   	push   %esi
+  800f5c:	ff 50 14             	call   *0x14(%eax)
+  800f5f:	83 c4 10             	add    $0x10,%esp
+  800f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f65:	5b                   	pop    %ebx
+  800f66:	5e                   	pop    %esi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+  800f69:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f6e:	eb f2                	jmp    800f62 <fstat+0x67>
+
+00800f70 <stat>:
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	56                   	push   %esi
+  800f74:	53                   	push   %ebx
+  800f75:	83 ec 08             	sub    $0x8,%esp
+  800f78:	6a 00                	push   $0x0
+  800f7a:	ff 75 08             	push   0x8(%ebp)
+  800f7d:	e8 31 05 00 00       	call   8014b3 <open>
+  800f82:	89 c3                	mov    %eax,%ebx
+  800f84:	83 c4 10             	add    $0x10,%esp
+  800f87:	85 c0                	test   %eax,%eax
+  800f89:	78 1b                	js     800fa6 <stat+0x36>
+  800f8b:	83 ec 08             	sub    $0x8,%esp
+  800f8e:	ff 75 0c             	push   0xc(%ebp)
+  800f91:	50                   	push   %eax
+  800f92:	e8 64 ff ff ff       	call   800efb <fstat>
+  800f97:	89 c6                	mov    %eax,%esi
+  800f99:	89 1c 24             	mov    %ebx,(%esp)
+  800f9c:	e8 19 fc ff ff       	call   800bba <close>
+  800fa1:	83 c4 10             	add    $0x10,%esp
+  800fa4:	89 f3                	mov    %esi,%ebx
+  800fa6:	89 d8                	mov    %ebx,%eax
+  800fa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fab:	5b                   	pop    %ebx
+  800fac:	5e                   	pop    %esi
+  800fad:	5d                   	pop    %ebp
+  800fae:	c3                   	ret
+
+00800faf <fsipc>:
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+  800fb4:	89 c3                	mov    %eax,%ebx
+  800fb6:	89 d6                	mov    %edx,%esi
+  800fb8:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800fbf:	74 20                	je     800fe1 <fsipc+0x32>
+  800fc1:	83 ec 08             	sub    $0x8,%esp
+  800fc4:	6a 00                	push   $0x0
+  800fc6:	56                   	push   %esi
+  800fc7:	6a 07                	push   $0x7
+  800fc9:	68 00 60 80 00       	push   $0x806000
+  800fce:	53                   	push   %ebx
+  800fcf:	ff 35 08 50 80 00    	push   0x805008
+  800fd5:	e8 a4 1d 00 00       	call   802d7e <ipc_call>
+  800fda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+  800fe1:	83 ec 0c             	sub    $0xc,%esp
+  800fe4:	6a 02                	push   $0x2
+  800fe6:	e8 2e 1f 00 00       	call   802f19 <ipc_find_env>
+  800feb:	a3 08 50 80 00       	mov    %eax,0x805008
+  800ff0:	83 c4 10             	add    $0x10,%esp
+  800ff3:	eb cc                	jmp    800fc1 <fsipc+0x12>
+
+00800ff5 <devfile_trunc>:
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	83 ec 08             	sub    $0x8,%esp
+  800ffb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ffe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801001:	a3 00 60 80 00       	mov    %eax,0x806000
+  801006:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801009:	a3 04 60 80 00       	mov    %eax,0x806004
+  80100e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801013:	b8 02 00 00 00       	mov    $0x2,%eax
+  801018:	e8 92 ff ff ff       	call   800faf <fsipc>
+  80101d:	c9                   	leave
+  80101e:	c3                   	ret
+
+0080101f <devfile_flush>:
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	83 ec 08             	sub    $0x8,%esp
+  801025:	8b 45 08             	mov    0x8(%ebp),%eax
+  801028:	8b 40 0c             	mov    0xc(%eax),%eax
+  80102b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801030:	ba 00 00 00 00       	mov    $0x0,%edx
+  801035:	b8 08 00 00 00       	mov    $0x8,%eax
+  80103a:	e8 70 ff ff ff       	call   800faf <fsipc>
+  80103f:	c9                   	leave
+  801040:	c3                   	ret
+
+00801041 <devfile_stat>:
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	53                   	push   %ebx
+  801045:	83 ec 04             	sub    $0x4,%esp
+  801048:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80104b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80104e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801051:	a3 00 60 80 00       	mov    %eax,0x806000
+  801056:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801060:	e8 4a ff ff ff       	call   800faf <fsipc>
+  801065:	85 c0                	test   %eax,%eax
+  801067:	78 2c                	js     801095 <devfile_stat+0x54>
+  801069:	83 ec 08             	sub    $0x8,%esp
+  80106c:	68 00 60 80 00       	push   $0x806000
+  801071:	53                   	push   %ebx
+  801072:	e8 d7 18 00 00       	call   80294e <strcpy>
+  801077:	a1 80 60 80 00       	mov    0x806080,%eax
+  80107c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801082:	a1 84 60 80 00       	mov    0x806084,%eax
+  801087:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80108d:	83 c4 10             	add    $0x10,%esp
+  801090:	b8 00 00 00 00       	mov    $0x0,%eax
+  801095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801098:	c9                   	leave
+  801099:	c3                   	ret
+
+0080109a <fsring_rw>:
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	57                   	push   %edi
+  80109e:	56                   	push   %esi
+  80109f:	53                   	push   %ebx
+  8010a0:	83 ec 2c             	sub    $0x2c,%esp
+  8010a3:	89 c7                	mov    %eax,%edi
+  8010a5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8010a8:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8010ab:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8010b0:	a8 01                	test   $0x1,%al
+  8010b2:	74 0d                	je     8010c1 <fsring_rw+0x27>
+  8010b4:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010b9:	a8 01                	test   $0x1,%al
+  8010bb:	0f 85 d5 00 00 00    	jne    801196 <fsring_rw+0xfc>
+  8010c1:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010c6:	8b 40 48             	mov    0x48(%eax),%eax
+  8010c9:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010cf:	0f 84 fc 00 00 00    	je     8011d1 <fsring_rw+0x137>
+  8010d5:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010dc:	0f 84 02 01 00 00    	je     8011e4 <fsring_rw+0x14a>
+  8010e2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010e7:	83 ec 04             	sub    $0x4,%esp
+  8010ea:	68 07 02 00 00       	push   $0x207
+  8010ef:	53                   	push   %ebx
+  8010f0:	6a 00                	push   $0x0
+  8010f2:	e8 b8 f0 ff ff       	call   8001af <sys_page_alloc>
+  8010f7:	83 c4 10             	add    $0x10,%esp
+  8010fa:	85 c0                	test   %eax,%eax
+  8010fc:	0f 88 f9 00 00 00    	js     8011fb <fsring_rw+0x161>
+  801102:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801108:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80110e:	75 d7                	jne    8010e7 <fsring_rw+0x4d>
+  801110:	6a 0e                	push   $0xe
+  801112:	6a 0d                	push   $0xd
+  801114:	ff 35 08 50 80 00    	push   0x805008
+  80111a:	68 00 00 f0 cf       	push   $0xcff00000
+  80111f:	e8 c4 0c 00 00       	call   801de8 <ipcring_init>
+  801124:	83 c4 08             	add    $0x8,%esp
+  801127:	6a 00                	push   $0x0
+  801129:	6a 00                	push   $0x0
+  80112b:	68 07 02 00 00       	push   $0x207
+  801130:	68 00 00 f0 cf       	push   $0xcff00000
+  801135:	6a 0b                	push   $0xb
+  801137:	ff 35 08 50 80 00    	push   0x805008
+  80113d:	e8 3c 1c 00 00       	call   802d7e <ipc_call>
+  801142:	89 c6                	mov    %eax,%esi
+  801144:	83 c4 20             	add    $0x20,%esp
+  801147:	85 c0                	test   %eax,%eax
+  801149:	0f 88 ac 00 00 00    	js     8011fb <fsring_rw+0x161>
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	89 d9                	mov    %ebx,%ecx
+  801156:	83 c3 01             	add    $0x1,%ebx
+  801159:	89 da                	mov    %ebx,%edx
+  80115b:	c1 e2 0c             	shl    $0xc,%edx
+  80115e:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801164:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80116a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801170:	83 ec 08             	sub    $0x8,%esp
+  801173:	6a 00                	push   $0x0
+  801175:	6a 00                	push   $0x0
+  801177:	68 07 02 00 00       	push   $0x207
+  80117c:	50                   	push   %eax
+  80117d:	6a 0c                	push   $0xc
+  80117f:	ff 35 08 50 80 00    	push   0x805008
+  801185:	e8 f4 1b 00 00       	call   802d7e <ipc_call>
+  80118a:	83 c4 20             	add    $0x20,%esp
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	78 6a                	js     8011fb <fsring_rw+0x161>
+  801191:	83 fb 08             	cmp    $0x8,%ebx
+  801194:	75 be                	jne    801154 <fsring_rw+0xba>
+  801196:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80119a:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80119f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8011a4:	0f 45 c2             	cmovne %edx,%eax
+  8011a7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011aa:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8011b1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011b8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011cc:	e9 4b 01 00 00       	jmp    80131c <fsring_rw+0x282>
+  8011d1:	e8 a3 f3 ff ff       	call   800579 <sys_time_msec>
+  8011d6:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011dc:	0f 89 f3 fe ff ff    	jns    8010d5 <fsring_rw+0x3b>
+  8011e2:	eb 54                	jmp    801238 <fsring_rw+0x19e>
+  8011e4:	83 ec 0c             	sub    $0xc,%esp
+  8011e7:	6a 02                	push   $0x2
+  8011e9:	e8 2b 1d 00 00       	call   802f19 <ipc_find_env>
+  8011ee:	a3 08 50 80 00       	mov    %eax,0x805008
+  8011f3:	83 c4 10             	add    $0x10,%esp
+  8011f6:	e9 e7 fe ff ff       	jmp    8010e2 <fsring_rw+0x48>
+  8011fb:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801200:	83 ec 08             	sub    $0x8,%esp
+  801203:	53                   	push   %ebx
+  801204:	6a 00                	push   $0x0
+  801206:	e8 76 f0 ff ff       	call   800281 <sys_page_unmap>
+  80120b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801211:	83 c4 10             	add    $0x10,%esp
+  801214:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80121a:	75 e4                	jne    801200 <fsring_rw+0x166>
+  80121c:	e8 58 f3 ff ff       	call   800579 <sys_time_msec>
+  801221:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801226:	a3 00 50 80 00       	mov    %eax,0x805000
+  80122b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801230:	8b 40 48             	mov    0x48(%eax),%eax
+  801233:	a3 04 50 80 00       	mov    %eax,0x805004
+  801238:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80123f:	e9 7a 01 00 00       	jmp    8013be <fsring_rw+0x324>
+  801244:	8b 57 0c             	mov    0xc(%edi),%edx
+  801247:	89 10                	mov    %edx,(%eax)
+  801249:	89 58 04             	mov    %ebx,0x4(%eax)
+  80124c:	89 f2                	mov    %esi,%edx
+  80124e:	03 57 04             	add    0x4(%edi),%edx
+  801251:	89 50 08             	mov    %edx,0x8(%eax)
+  801254:	83 ec 04             	sub    $0x4,%esp
+  801257:	53                   	push   %ebx
+  801258:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80125b:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80125e:	52                   	push   %edx
+  80125f:	83 c0 0c             	add    $0xc,%eax
+  801262:	50                   	push   %eax
+  801263:	e8 96 18 00 00       	call   802afe <memmove>
+  801268:	83 c4 10             	add    $0x10,%esp
+  80126b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80126e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801271:	89 08                	mov    %ecx,(%eax)
+  801273:	83 ec 0c             	sub    $0xc,%esp
+  801276:	68 00 00 f0 cf       	push   $0xcff00000
+  80127b:	e8 c6 0b 00 00       	call   801e46 <ipcring_req_push>
+  801280:	01 de                	add    %ebx,%esi
+  801282:	83 c4 10             	add    $0x10,%esp
+  801285:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801288:	73 4c                	jae    8012d6 <fsring_rw+0x23c>
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+  80128d:	68 00 00 f0 cf       	push   $0xcff00000
+  801292:	e8 89 0b 00 00       	call   801e20 <ipcring_req_slot>
+  801297:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80129a:	83 c4 10             	add    $0x10,%esp
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	74 35                	je     8012d6 <fsring_rw+0x23c>
+  8012a1:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8012a6:	83 e0 07             	and    $0x7,%eax
+  8012a9:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8012ae:	c1 e0 0c             	shl    $0xc,%eax
+  8012b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012b4:	29 f3                	sub    %esi,%ebx
+  8012b6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012b9:	39 cb                	cmp    %ecx,%ebx
+  8012bb:	0f 47 d9             	cmova  %ecx,%ebx
+  8012be:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012c2:	75 80                	jne    801244 <fsring_rw+0x1aa>
+  8012c4:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012c7:	89 10                	mov    %edx,(%eax)
+  8012c9:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012cc:	89 f2                	mov    %esi,%edx
+  8012ce:	03 57 04             	add    0x4(%edi),%edx
+  8012d1:	89 50 08             	mov    %edx,0x8(%eax)
+  8012d4:	eb 95                	jmp    80126b <fsring_rw+0x1d1>
+  8012d6:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012de:	83 ec 0c             	sub    $0xc,%esp
+  8012e1:	68 00 00 f0 cf       	push   $0xcff00000
+  8012e6:	e8 94 0b 00 00       	call   801e7f <ipcring_rsp_wait>
+  8012eb:	8b 58 04             	mov    0x4(%eax),%ebx
+  8012ee:	83 c4 10             	add    $0x10,%esp
+  8012f1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8012f5:	75 45                	jne    80133c <fsring_rw+0x2a2>
+  8012f7:	85 db                	test   %ebx,%ebx
+  8012f9:	79 41                	jns    80133c <fsring_rw+0x2a2>
+  8012fb:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8012fe:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801305:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  80130c:	83 ec 0c             	sub    $0xc,%esp
+  80130f:	68 00 00 f0 cf       	push   $0xcff00000
+  801314:	e8 cc 0b 00 00       	call   801ee5 <ipcring_rsp_pop>
+  801319:	83 c4 10             	add    $0x10,%esp
+  80131c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801322:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801327:	39 c2                	cmp    %eax,%edx
+  801329:	74 75                	je     8013a0 <fsring_rw+0x306>
+  80132b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80132f:	75 a5                	jne    8012d6 <fsring_rw+0x23c>
+  801331:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801334:	0f 82 50 ff ff ff    	jb     80128a <fsring_rw+0x1f0>
+  80133a:	eb 9a                	jmp    8012d6 <fsring_rw+0x23c>
+  80133c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801340:	75 ca                	jne    80130c <fsring_rw+0x272>
+  801342:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801346:	74 31                	je     801379 <fsring_rw+0x2df>
+  801348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80134b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80134e:	29 c8                	sub    %ecx,%eax
+  801350:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801353:	39 d0                	cmp    %edx,%eax
+  801355:	0f 47 c2             	cmova  %edx,%eax
+  801358:	39 d8                	cmp    %ebx,%eax
+  80135a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80135f:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801363:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801366:	b8 01 00 00 00       	mov    $0x1,%eax
+  80136b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80136f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801372:	01 d9                	add    %ebx,%ecx
+  801374:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801377:	eb 93                	jmp    80130c <fsring_rw+0x272>
+  801379:	83 ec 04             	sub    $0x4,%esp
+  80137c:	53                   	push   %ebx
+  80137d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801380:	83 e0 07             	and    $0x7,%eax
+  801383:	c1 e0 0c             	shl    $0xc,%eax
+  801386:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80138c:	50                   	push   %eax
+  80138d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801390:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801393:	01 c8                	add    %ecx,%eax
+  801395:	50                   	push   %eax
+  801396:	e8 63 17 00 00       	call   802afe <memmove>
+  80139b:	83 c4 10             	add    $0x10,%esp
+  80139e:	eb a8                	jmp    801348 <fsring_rw+0x2ae>
+  8013a0:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8013a4:	75 09                	jne    8013af <fsring_rw+0x315>
+  8013a6:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8013a9:	0f 82 db fe ff ff    	jb     80128a <fsring_rw+0x1f0>
+  8013af:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8013b2:	01 57 04             	add    %edx,0x4(%edi)
+  8013b5:	85 d2                	test   %edx,%edx
+  8013b7:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013bb:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013be:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c4:	5b                   	pop    %ebx
+  8013c5:	5e                   	pop    %esi
+  8013c6:	5f                   	pop    %edi
+  8013c7:	5d                   	pop    %ebp
+  8013c8:	c3                   	ret
+
+008013c9 <devfile_write>:
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013db:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013e1:	76 1a                	jbe    8013fd <devfile_write+0x34>
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	53                   	push   %ebx
+  8013e7:	89 f1                	mov    %esi,%ecx
+  8013e9:	ba 06 00 00 00       	mov    $0x6,%edx
+  8013ee:	89 f8                	mov    %edi,%eax
+  8013f0:	e8 a5 fc ff ff       	call   80109a <fsring_rw>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013fb:	75 39                	jne    801436 <devfile_write+0x6d>
+  8013fd:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801402:	39 c3                	cmp    %eax,%ebx
+  801404:	0f 47 d8             	cmova  %eax,%ebx
+  801407:	8b 47 0c             	mov    0xc(%edi),%eax
+  80140a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80140f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801415:	83 ec 04             	sub    $0x4,%esp
+  801418:	53                   	push   %ebx
+  801419:	56                   	push   %esi
+  80141a:	68 08 60 80 00       	push   $0x806008
+  80141f:	e8 da 16 00 00       	call   802afe <memmove>
+  801424:	ba 00 00 00 00       	mov    $0x0,%edx
+  801429:	b8 04 00 00 00       	mov    $0x4,%eax
+  80142e:	e8 7c fb ff ff       	call   800faf <fsipc>
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801439:	5b                   	pop    %ebx
+  80143a:	5e                   	pop    %esi
+  80143b:	5f                   	pop    %edi
+  80143c:	5d                   	pop    %ebp
+  80143d:	c3                   	ret
+
+0080143e <devfile_read>:
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	57                   	push   %edi
+  801442:	56                   	push   %esi
+  801443:	53                   	push   %ebx
+  801444:	83 ec 0c             	sub    $0xc,%esp
+  801447:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80144a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80144d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  801453:	76 1d                	jbe    801472 <devfile_read+0x34>
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	56                   	push   %esi
+  801459:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145c:	ba 05 00 00 00       	mov    $0x5,%edx
+  801461:	89 f8                	mov    %edi,%eax
+  801463:	e8 32 fc ff ff       	call   80109a <fsring_rw>
+  801468:	89 c3                	mov    %eax,%ebx
+  80146a:	83 c4 10             	add    $0x10,%esp
+  80146d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801470:	75 37                	jne    8014a9 <devfile_read+0x6b>
+  801472:	8b 47 0c             	mov    0xc(%edi),%eax
+  801475:	a3 00 60 80 00       	mov    %eax,0x806000
+  80147a:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801480:	ba 00 00 00 00       	mov    $0x0,%edx
+  801485:	b8 03 00 00 00       	mov    $0x3,%eax
+  80148a:	e8 20 fb ff ff       	call   800faf <fsipc>
+  80148f:	89 c3                	mov    %eax,%ebx
+  801491:	85 c0                	test   %eax,%eax
+  801493:	78 14                	js     8014a9 <devfile_read+0x6b>
+  801495:	83 ec 04             	sub    $0x4,%esp
+  801498:	50                   	push   %eax
+  801499:	68 00 60 80 00       	push   $0x806000
+  80149e:	ff 75 0c             	push   0xc(%ebp)
+  8014a1:	e8 58 16 00 00       	call   802afe <memmove>
+  8014a6:	83 c4 10             	add    $0x10,%esp
+  8014a9:	89 d8                	mov    %ebx,%eax
+  8014ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ae:	5b                   	pop    %ebx
+  8014af:	5e                   	pop    %esi
+  8014b0:	5f                   	pop    %edi
+  8014b1:	5d                   	pop    %ebp
+  8014b2:	c3                   	ret
+
+008014b3 <open>:
+  8014b3:	55                   	push   %ebp
+  8014b4:	89 e5                	mov    %esp,%ebp
+  8014b6:	56                   	push   %esi
+  8014b7:	53                   	push   %ebx
+  8014b8:	83 ec 1c             	sub    $0x1c,%esp
+  8014bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014be:	56                   	push   %esi
+  8014bf:	e8 3e 14 00 00       	call   802902 <strlen>
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014cc:	7f 6c                	jg     80153a <open+0x87>
+  8014ce:	83 ec 0c             	sub    $0xc,%esp
+  8014d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d4:	50                   	push   %eax
+  8014d5:	e8 6a f5 ff ff       	call   800a44 <fd_alloc>
+  8014da:	89 c3                	mov    %eax,%ebx
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 3c                	js     80151f <open+0x6c>
+  8014e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014e6:	a3 00 64 80 00       	mov    %eax,0x806400
+  8014eb:	83 ec 08             	sub    $0x8,%esp
+  8014ee:	56                   	push   %esi
+  8014ef:	68 00 60 80 00       	push   $0x806000
+  8014f4:	e8 55 14 00 00       	call   80294e <strcpy>
+  8014f9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801501:	e8 a9 fa ff ff       	call   800faf <fsipc>
+  801506:	89 c3                	mov    %eax,%ebx
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 19                	js     801528 <open+0x75>
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	ff 75 f4             	push   -0xc(%ebp)
+  801515:	e8 03 f5 ff ff       	call   800a1d <fd2num>
+  80151a:	89 c3                	mov    %eax,%ebx
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	89 d8                	mov    %ebx,%eax
+  801521:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801524:	5b                   	pop    %ebx
+  801525:	5e                   	pop    %esi
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+  801528:	83 ec 08             	sub    $0x8,%esp
+  80152b:	6a 00                	push   $0x0
+  80152d:	ff 75 f4             	push   -0xc(%ebp)
+  801530:	e8 05 f6 ff ff       	call   800b3a <fd_close>
+  801535:	83 c4 10             	add    $0x10,%esp
+  801538:	eb e5                	jmp    80151f <open+0x6c>
+  80153a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80153f:	eb de                	jmp    80151f <open+0x6c>
+
+00801541 <file_image>:
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	53                   	push   %ebx
+  801545:	83 ec 1c             	sub    $0x1c,%esp
+  801548:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154e:	50                   	push   %eax
+  80154f:	ff 75 08             	push   0x8(%ebp)
+  801552:	e8 3d f5 ff ff       	call   800a94 <fd_lookup>
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	85 c0                	test   %eax,%eax
+  80155c:	78 58                	js     8015b6 <file_image+0x75>
+  80155e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801561:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  801567:	39 08                	cmp    %ecx,(%eax)
+  801569:	75 50                	jne    8015bb <file_image+0x7a>
+  80156b:	83 fb 04             	cmp    $0x4,%ebx
+  80156e:	77 52                	ja     8015c2 <file_image+0x81>
+  801570:	8b 40 0c             	mov    0xc(%eax),%eax
+  801573:	a3 00 60 80 00       	mov    %eax,0x806000
+  801578:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80157e:	83 ec 04             	sub    $0x4,%esp
+  801581:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  801584:	c1 e0 02             	shl    $0x2,%eax
+  801587:	50                   	push   %eax
+  801588:	ff 75 0c             	push   0xc(%ebp)
+  80158b:	68 08 60 80 00       	push   $0x806008
+  801590:	e8 69 15 00 00       	call   802afe <memmove>
+  801595:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80159f:	e8 0b fa ff ff       	call   800faf <fsipc>
+  8015a4:	83 c4 10             	add    $0x10,%esp
+  8015a7:	85 c0                	test   %eax,%eax
+  8015a9:	78 0b                	js     8015b6 <file_image+0x75>
+  8015ab:	8b 55 14             	mov    0x14(%ebp),%edx
+  8015ae:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8015b4:	89 0a                	mov    %ecx,(%edx)
+  8015b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b9:	c9                   	leave
+  8015ba:	c3                   	ret
+  8015bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c0:	eb f4                	jmp    8015b6 <file_image+0x75>
+  8015c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c7:	eb ed                	jmp    8015b6 <file_image+0x75>
+
+008015c9 <remove>:
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	53                   	push   %ebx
+  8015cd:	83 ec 10             	sub    $0x10,%esp
+  8015d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015d3:	53                   	push   %ebx
+  8015d4:	e8 29 13 00 00       	call   802902 <strlen>
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015e1:	7f 25                	jg     801608 <remove+0x3f>
+  8015e3:	83 ec 08             	sub    $0x8,%esp
+  8015e6:	53                   	push   %ebx
+  8015e7:	68 00 60 80 00       	push   $0x806000
+  8015ec:	e8 5d 13 00 00       	call   80294e <strcpy>
+  8015f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015fb:	e8 af f9 ff ff       	call   800faf <fsipc>
+  801600:	83 c4 10             	add    $0x10,%esp
+  801603:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+  801608:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80160d:	eb f4                	jmp    801603 <remove+0x3a>
+
+0080160f <sync>:
+  80160f:	55                   	push   %ebp
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	83 ec 08             	sub    $0x8,%esp
+  801615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80161f:	e8 8b f9 ff ff       	call   800faf <fsipc>
+  801624:	c9                   	leave
+  801625:	c3                   	ret
+
+00801626 <devsock_stat>:
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  801629:	83 ec 10             	sub    $0x10,%esp
+  80162c:	68 54 32 80 00       	push   $0x803254
+  801631:	ff 75 0c             	push   0xc(%ebp)
+  801634:	e8 15 13 00 00       	call   80294e <strcpy>
+  801639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163e:	c9                   	leave
+  80163f:	c3                   	ret
+
+00801640 <devsock_close>:
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	53                   	push   %ebx
+  801644:	83 ec 10             	sub    $0x10,%esp
+  801647:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80164a:	53                   	push   %ebx
+  80164b:	e8 e3 18 00 00       	call   802f33 <pageref>
+  801650:	89 c2                	mov    %eax,%edx
+  801652:	83 c4 10             	add    $0x10,%esp
+  801655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165a:	83 fa 01             	cmp    $0x1,%edx
+  80165d:	74 05                	je     801664 <devsock_close+0x24>
+  80165f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801662:	c9                   	leave
+  801663:	c3                   	ret
+  801664:	83 ec 0c             	sub    $0xc,%esp
+  801667:	ff 73 0c             	push   0xc(%ebx)
+  80166a:	e8 aa 02 00 00       	call   801919 <nsipc_close>
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	eb eb                	jmp    80165f <devsock_close+0x1f>
+
+00801674 <devsock_write>:
+  801674:	55                   	push   %ebp
+  801675:	89 e5                	mov    %esp,%ebp
+  801677:	83 ec 08             	sub    $0x8,%esp
+  80167a:	6a 00                	push   $0x0
+  80167c:	ff 75 10             	push   0x10(%ebp)
+  80167f:	ff 75 0c             	push   0xc(%ebp)
+  801682:	8b 45 08             	mov    0x8(%ebp),%eax
+  801685:	ff 70 0c             	push   0xc(%eax)
+  801688:	e8 6c 03 00 00       	call   8019f9 <nsipc_send>
+  80168d:	c9                   	leave
+  80168e:	c3                   	ret
+
+0080168f <devsock_read>:
+  80168f:	55                   	push   %ebp
+  801690:	89 e5                	mov    %esp,%ebp
+  801692:	83 ec 08             	sub    $0x8,%esp
+  801695:	6a 00                	push   $0x0
+  801697:	ff 75 10             	push   0x10(%ebp)
+  80169a:	ff 75 0c             	push   0xc(%ebp)
+  80169d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016a0:	ff 70 0c             	push   0xc(%eax)
+  8016a3:	e8 e2 02 00 00       	call   80198a <nsipc_recv>
+  8016a8:	c9                   	leave
+  8016a9:	c3                   	ret
+
+008016aa <fd2sockid>:
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	83 ec 20             	sub    $0x20,%esp
+  8016b0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016b3:	52                   	push   %edx
+  8016b4:	50                   	push   %eax
+  8016b5:	e8 da f3 ff ff       	call   800a94 <fd_lookup>
+  8016ba:	83 c4 10             	add    $0x10,%esp
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	78 10                	js     8016d1 <fd2sockid+0x27>
+  8016c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c4:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  8016ca:	39 08                	cmp    %ecx,(%eax)
+  8016cc:	75 05                	jne    8016d3 <fd2sockid+0x29>
+  8016ce:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016d1:	c9                   	leave
+  8016d2:	c3                   	ret
+  8016d3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d8:	eb f7                	jmp    8016d1 <fd2sockid+0x27>
+
+008016da <alloc_sockfd>:
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	56                   	push   %esi
+  8016de:	53                   	push   %ebx
+  8016df:	83 ec 1c             	sub    $0x1c,%esp
+  8016e2:	89 c6                	mov    %eax,%esi
+  8016e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e7:	50                   	push   %eax
+  8016e8:	e8 57 f3 ff ff       	call   800a44 <fd_alloc>
+  8016ed:	89 c3                	mov    %eax,%ebx
+  8016ef:	83 c4 10             	add    $0x10,%esp
+  8016f2:	85 c0                	test   %eax,%eax
+  8016f4:	78 43                	js     801739 <alloc_sockfd+0x5f>
+  8016f6:	83 ec 04             	sub    $0x4,%esp
+  8016f9:	68 07 04 00 00       	push   $0x407
+  8016fe:	ff 75 f4             	push   -0xc(%ebp)
+  801701:	6a 00                	push   $0x0
+  801703:	e8 a7 ea ff ff       	call   8001af <sys_page_alloc>
+  801708:	89 c3                	mov    %eax,%ebx
+  80170a:	83 c4 10             	add    $0x10,%esp
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	78 28                	js     801739 <alloc_sockfd+0x5f>
+  801711:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801714:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  80171a:	89 10                	mov    %edx,(%eax)
+  80171c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80171f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801726:	89 70 0c             	mov    %esi,0xc(%eax)
+  801729:	83 ec 0c             	sub    $0xc,%esp
+  80172c:	50                   	push   %eax
+  80172d:	e8 eb f2 ff ff       	call   800a1d <fd2num>
+  801732:	89 c3                	mov    %eax,%ebx
+  801734:	83 c4 10             	add    $0x10,%esp
+  801737:	eb 0c                	jmp    801745 <alloc_sockfd+0x6b>
+  801739:	83 ec 0c             	sub    $0xc,%esp
+  80173c:	56                   	push   %esi
+  80173d:	e8 d7 01 00 00       	call   801919 <nsipc_close>
+  801742:	83 c4 10             	add    $0x10,%esp
+  801745:	89 d8                	mov    %ebx,%eax
+  801747:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174a:	5b                   	pop    %ebx
+  80174b:	5e                   	pop    %esi
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+
+0080174e <accept>:
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	8b 45 08             	mov    0x8(%ebp),%eax
+  801757:	e8 4e ff ff ff       	call   8016aa <fd2sockid>
+  80175c:	85 c0                	test   %eax,%eax
+  80175e:	78 1b                	js     80177b <accept+0x2d>
+  801760:	83 ec 04             	sub    $0x4,%esp
+  801763:	ff 75 10             	push   0x10(%ebp)
+  801766:	ff 75 0c             	push   0xc(%ebp)
+  801769:	50                   	push   %eax
+  80176a:	e8 07 01 00 00       	call   801876 <nsipc_accept>
+  80176f:	83 c4 10             	add    $0x10,%esp
+  801772:	85 c0                	test   %eax,%eax
+  801774:	78 05                	js     80177b <accept+0x2d>
+  801776:	e8 5f ff ff ff       	call   8016da <alloc_sockfd>
+  80177b:	c9                   	leave
+  80177c:	c3                   	ret
+
+0080177d <bind>:
+  80177d:	55                   	push   %ebp
+  80177e:	89 e5                	mov    %esp,%ebp
+  801780:	83 ec 08             	sub    $0x8,%esp
+  801783:	8b 45 08             	mov    0x8(%ebp),%eax
+  801786:	e8 1f ff ff ff       	call   8016aa <fd2sockid>
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	78 12                	js     8017a1 <bind+0x24>
+  80178f:	83 ec 04             	sub    $0x4,%esp
+  801792:	ff 75 10             	push   0x10(%ebp)
+  801795:	ff 75 0c             	push   0xc(%ebp)
+  801798:	50                   	push   %eax
+  801799:	e8 24 01 00 00       	call   8018c2 <nsipc_bind>
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	c9                   	leave
+  8017a2:	c3                   	ret
+
+008017a3 <shutdown>:
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	83 ec 08             	sub    $0x8,%esp
+  8017a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ac:	e8 f9 fe ff ff       	call   8016aa <fd2sockid>
+  8017b1:	85 c0                	test   %eax,%eax
+  8017b3:	78 0f                	js     8017c4 <shutdown+0x21>
+  8017b5:	83 ec 08             	sub    $0x8,%esp
+  8017b8:	ff 75 0c             	push   0xc(%ebp)
+  8017bb:	50                   	push   %eax
+  8017bc:	e8 36 01 00 00       	call   8018f7 <nsipc_shutdown>
+  8017c1:	83 c4 10             	add    $0x10,%esp
+  8017c4:	c9                   	leave
+  8017c5:	c3                   	ret
+
+008017c6 <connect>:
+  8017c6:	55                   	push   %ebp
+  8017c7:	89 e5                	mov    %esp,%ebp
+  8017c9:	83 ec 08             	sub    $0x8,%esp
+  8017cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017cf:	e8 d6 fe ff ff       	call   8016aa <fd2sockid>
+  8017d4:	85 c0                	test   %eax,%eax
+  8017d6:	78 12                	js     8017ea <connect+0x24>
+  8017d8:	83 ec 04             	sub    $0x4,%esp
+  8017db:	ff 75 10             	push   0x10(%ebp)
+  8017de:	ff 75 0c             	push   0xc(%ebp)
+  8017e1:	50                   	push   %eax
+  8017e2:	e8 4c 01 00 00       	call   801933 <nsipc_connect>
+  8017e7:	83 c4 10             	add    $0x10,%esp
+  8017ea:	c9                   	leave
+  8017eb:	c3                   	ret
+
+008017ec <listen>:
+  8017ec:	55                   	push   %ebp
+  8017ed:	89 e5                	mov    %esp,%ebp
+  8017ef:	83 ec 08             	sub    $0x8,%esp
+  8017f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f5:	e8 b0 fe ff ff       	call   8016aa <fd2sockid>
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	78 0f                	js     80180d <listen+0x21>
+  8017fe:	83 ec 08             	sub    $0x8,%esp
+  801801:	ff 75 0c             	push   0xc(%ebp)
+  801804:	50                   	push   %eax
+  801805:	e8 5e 01 00 00       	call   801968 <nsipc_listen>
+  80180a:	83 c4 10             	add    $0x10,%esp
+  80180d:	c9                   	leave
+  80180e:	c3                   	ret
+
+0080180f <socket>:
+  80180f:	55                   	push   %ebp
+  801810:	89 e5                	mov    %esp,%ebp
+  801812:	83 ec 0c             	sub    $0xc,%esp
+  801815:	ff 75 10             	push   0x10(%ebp)
+  801818:	ff 75 0c             	push   0xc(%ebp)
+  80181b:	ff 75 08             	push   0x8(%ebp)
+  80181e:	e8 34 02 00 00       	call   801a57 <nsipc_socket>
+  801823:	83 c4 10             	add    $0x10,%esp
+  801826:	85 c0                	test   %eax,%eax
+  801828:	78 05                	js     80182f <socket+0x20>
+  80182a:	e8 ab fe ff ff       	call   8016da <alloc_sockfd>
+  80182f:	c9                   	leave
+  801830:	c3                   	ret
+
+00801831 <nsipc>:
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	53                   	push   %ebx
+  801835:	83 ec 04             	sub    $0x4,%esp
+  801838:	89 c3                	mov    %eax,%ebx
+  80183a:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801841:	74 1f                	je     801862 <nsipc+0x31>
+  801843:	83 ec 08             	sub    $0x8,%esp
+  801846:	6a 00                	push   $0x0
+  801848:	6a 00                	push   $0x0
+  80184a:	6a 07                	push   $0x7
+  80184c:	68 00 70 80 00       	push   $0x807000
+  801851:	53                   	push   %ebx
+  801852:	ff 35 0c 50 80 00    	push   0x80500c
+  801858:	e8 21 15 00 00       	call   802d7e <ipc_call>
+  80185d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	6a 03                	push   $0x3
+  801867:	e8 ad 16 00 00       	call   802f19 <ipc_find_env>
+  80186c:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801871:	83 c4 10             	add    $0x10,%esp
+  801874:	eb cd                	jmp    801843 <nsipc+0x12>
+
+00801876 <nsipc_accept>:
+  801876:	55                   	push   %ebp
+  801877:	89 e5                	mov    %esp,%ebp
+  801879:	53                   	push   %ebx
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801880:	a3 00 70 80 00       	mov    %eax,0x807000
+  801885:	b8 01 00 00 00       	mov    $0x1,%eax
+  80188a:	e8 a2 ff ff ff       	call   801831 <nsipc>
+  80188f:	89 c3                	mov    %eax,%ebx
+  801891:	85 c0                	test   %eax,%eax
+  801893:	79 07                	jns    80189c <nsipc_accept+0x26>
+  801895:	89 d8                	mov    %ebx,%eax
+  801897:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80189a:	c9                   	leave
+  80189b:	c3                   	ret
+  80189c:	83 ec 04             	sub    $0x4,%esp
+  80189f:	ff 35 10 70 80 00    	push   0x807010
+  8018a5:	68 00 70 80 00       	push   $0x807000
+  8018aa:	ff 75 0c             	push   0xc(%ebp)
+  8018ad:	e8 4c 12 00 00       	call   802afe <memmove>
+  8018b2:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018b8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018bb:	89 10                	mov    %edx,(%eax)
+  8018bd:	83 c4 10             	add    $0x10,%esp
+  8018c0:	eb d3                	jmp    801895 <nsipc_accept+0x1f>
+
+008018c2 <nsipc_bind>:
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	53                   	push   %ebx
+  8018c6:	83 ec 08             	sub    $0x8,%esp
+  8018c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cf:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018d4:	53                   	push   %ebx
+  8018d5:	ff 75 0c             	push   0xc(%ebp)
+  8018d8:	68 04 70 80 00       	push   $0x807004
+  8018dd:	e8 1c 12 00 00       	call   802afe <memmove>
+  8018e2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018e8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018ed:	e8 3f ff ff ff       	call   801831 <nsipc>
+  8018f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+
+008018f7 <nsipc_shutdown>:
+  8018f7:	55                   	push   %ebp
+  8018f8:	89 e5                	mov    %esp,%ebp
+  8018fa:	83 ec 08             	sub    $0x8,%esp
+  8018fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801900:	a3 00 70 80 00       	mov    %eax,0x807000
+  801905:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801908:	a3 04 70 80 00       	mov    %eax,0x807004
+  80190d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801912:	e8 1a ff ff ff       	call   801831 <nsipc>
+  801917:	c9                   	leave
+  801918:	c3                   	ret
+
+00801919 <nsipc_close>:
+  801919:	55                   	push   %ebp
+  80191a:	89 e5                	mov    %esp,%ebp
+  80191c:	83 ec 08             	sub    $0x8,%esp
+  80191f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801922:	a3 00 70 80 00       	mov    %eax,0x807000
+  801927:	b8 04 00 00 00       	mov    $0x4,%eax
+  80192c:	e8 00 ff ff ff       	call   801831 <nsipc>
+  801931:	c9                   	leave
+  801932:	c3                   	ret
+
+00801933 <nsipc_connect>:
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+  801936:	53                   	push   %ebx
+  801937:	83 ec 08             	sub    $0x8,%esp
+  80193a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80193d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801940:	a3 00 70 80 00       	mov    %eax,0x807000
+  801945:	53                   	push   %ebx
+  801946:	ff 75 0c             	push   0xc(%ebp)
+  801949:	68 04 70 80 00       	push   $0x807004
+  80194e:	e8 ab 11 00 00       	call   802afe <memmove>
+  801953:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801959:	b8 05 00 00 00       	mov    $0x5,%eax
+  80195e:	e8 ce fe ff ff       	call   801831 <nsipc>
+  801963:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+00801968 <nsipc_listen>:
+  801968:	55                   	push   %ebp
+  801969:	89 e5                	mov    %esp,%ebp
+  80196b:	83 ec 08             	sub    $0x8,%esp
+  80196e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801971:	a3 00 70 80 00       	mov    %eax,0x807000
+  801976:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801979:	a3 04 70 80 00       	mov    %eax,0x807004
+  80197e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801983:	e8 a9 fe ff ff       	call   801831 <nsipc>
+  801988:	c9                   	leave
+  801989:	c3                   	ret
+
+0080198a <nsipc_recv>:
+  80198a:	55                   	push   %ebp
+  80198b:	89 e5                	mov    %esp,%ebp
+  80198d:	56                   	push   %esi
+  80198e:	53                   	push   %ebx
+  80198f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801992:	8b 45 08             	mov    0x8(%ebp),%eax
+  801995:	a3 00 70 80 00       	mov    %eax,0x807000
+  80199a:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8019a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019a3:	a3 08 70 80 00       	mov    %eax,0x807008
+  8019a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019ad:	e8 7f fe ff ff       	call   801831 <nsipc>
+  8019b2:	89 c3                	mov    %eax,%ebx
+  8019b4:	85 c0                	test   %eax,%eax
+  8019b6:	78 22                	js     8019da <nsipc_recv+0x50>
+  8019b8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019bd:	39 c6                	cmp    %eax,%esi
+  8019bf:	0f 4e c6             	cmovle %esi,%eax
+  8019c2:	39 c3                	cmp    %eax,%ebx
+  8019c4:	7f 1d                	jg     8019e3 <nsipc_recv+0x59>
+  8019c6:	83 ec 04             	sub    $0x4,%esp
+  8019c9:	53                   	push   %ebx
+  8019ca:	68 00 70 80 00       	push   $0x807000
+  8019cf:	ff 75 0c             	push   0xc(%ebp)
+  8019d2:	e8 27 11 00 00       	call   802afe <memmove>
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	89 d8                	mov    %ebx,%eax
+  8019dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019df:	5b                   	pop    %ebx
+  8019e0:	5e                   	pop    %esi
+  8019e1:	5d                   	pop    %ebp
+  8019e2:	c3                   	ret
+  8019e3:	68 60 32 80 00       	push   $0x803260
+  8019e8:	68 75 32 80 00       	push   $0x803275
+  8019ed:	6a 60                	push   $0x60
+  8019ef:	68 8a 32 80 00       	push   $0x80328a
+  8019f4:	e8 83 07 00 00       	call   80217c <_panic>
+
+008019f9 <nsipc_send>:
+  8019f9:	55                   	push   %ebp
+  8019fa:	89 e5                	mov    %esp,%ebp
+  8019fc:	53                   	push   %ebx
+  8019fd:	83 ec 04             	sub    $0x4,%esp
+  801a00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a06:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a0b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a11:	7f 2e                	jg     801a41 <nsipc_send+0x48>
+  801a13:	83 ec 04             	sub    $0x4,%esp
+  801a16:	53                   	push   %ebx
+  801a17:	ff 75 0c             	push   0xc(%ebp)
+  801a1a:	68 0c 70 80 00       	push   $0x80700c
+  801a1f:	e8 da 10 00 00       	call   802afe <memmove>
+  801a24:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a2d:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a32:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a37:	e8 f5 fd ff ff       	call   801831 <nsipc>
+  801a3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3f:	c9                   	leave
+  801a40:	c3                   	ret
+  801a41:	68 96 32 80 00       	push   $0x803296
+  801a46:	68 75 32 80 00       	push   $0x803275
+  801a4b:	6a 6b                	push   $0x6b
+  801a4d:	68 8a 32 80 00       	push   $0x80328a
+  801a52:	e8 25 07 00 00       	call   80217c <_panic>
+
+00801a57 <nsipc_socket>:
+  801a57:	55                   	push   %ebp
+  801a58:	89 e5                	mov    %esp,%ebp
+  801a5a:	83 ec 08             	sub    $0x8,%esp
+  801a5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a60:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a68:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a6d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a70:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a75:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a7a:	e8 b2 fd ff ff       	call   801831 <nsipc>
+  801a7f:	c9                   	leave
+  801a80:	c3                   	ret
+
+00801a81 <devpipe_stat>:
+  801a81:	55                   	push   %ebp
+  801a82:	89 e5                	mov    %esp,%ebp
+  801a84:	56                   	push   %esi
+  801a85:	53                   	push   %ebx
+  801a86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a89:	83 ec 0c             	sub    $0xc,%esp
+  801a8c:	ff 75 08             	push   0x8(%ebp)
+  801a8f:	e8 99 ef ff ff       	call   800a2d <fd2data>
+  801a94:	89 c6                	mov    %eax,%esi
+  801a96:	83 c4 08             	add    $0x8,%esp
+  801a99:	68 a2 32 80 00       	push   $0x8032a2
+  801a9e:	53                   	push   %ebx
+  801a9f:	e8 aa 0e 00 00       	call   80294e <strcpy>
+  801aa4:	8b 46 04             	mov    0x4(%esi),%eax
+  801aa7:	2b 06                	sub    (%esi),%eax
+  801aa9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801aaf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ab6:	00 00 00 
+  801ab9:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  801ac0:	40 80 00 
+  801ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801acb:	5b                   	pop    %ebx
+  801acc:	5e                   	pop    %esi
+  801acd:	5d                   	pop    %ebp
+  801ace:	c3                   	ret
+
+00801acf <devpipe_close>:
+  801acf:	55                   	push   %ebp
+  801ad0:	89 e5                	mov    %esp,%ebp
+  801ad2:	53                   	push   %ebx
+  801ad3:	83 ec 0c             	sub    $0xc,%esp
+  801ad6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ad9:	53                   	push   %ebx
+  801ada:	6a 00                	push   $0x0
+  801adc:	e8 a0 e7 ff ff       	call   800281 <sys_page_unmap>
+  801ae1:	89 1c 24             	mov    %ebx,(%esp)
+  801ae4:	e8 44 ef ff ff       	call   800a2d <fd2data>
+  801ae9:	83 c4 08             	add    $0x8,%esp
+  801aec:	50                   	push   %eax
+  801aed:	6a 00                	push   $0x0
+  801aef:	e8 8d e7 ff ff       	call   800281 <sys_page_unmap>
+  801af4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af7:	c9                   	leave
+  801af8:	c3                   	ret
+
+00801af9 <_pipeisclosed>:
+  801af9:	55                   	push   %ebp
+  801afa:	89 e5                	mov    %esp,%ebp
+  801afc:	57                   	push   %edi
+  801afd:	56                   	push   %esi
+  801afe:	53                   	push   %ebx
+  801aff:	83 ec 1c             	sub    $0x1c,%esp
+  801b02:	89 c7                	mov    %eax,%edi
+  801b04:	89 d6                	mov    %edx,%esi
+  801b06:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b0b:	8b 58 58             	mov    0x58(%eax),%ebx
+  801b0e:	83 ec 0c             	sub    $0xc,%esp
+  801b11:	57                   	push   %edi
+  801b12:	e8 1c 14 00 00       	call   802f33 <pageref>
+  801b17:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b1a:	89 34 24             	mov    %esi,(%esp)
+  801b1d:	e8 11 14 00 00       	call   802f33 <pageref>
+  801b22:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b28:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b2b:	83 c4 10             	add    $0x10,%esp
+  801b2e:	39 cb                	cmp    %ecx,%ebx
+  801b30:	74 1b                	je     801b4d <_pipeisclosed+0x54>
+  801b32:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b35:	75 cf                	jne    801b06 <_pipeisclosed+0xd>
+  801b37:	8b 42 58             	mov    0x58(%edx),%eax
+  801b3a:	6a 01                	push   $0x1
+  801b3c:	50                   	push   %eax
+  801b3d:	53                   	push   %ebx
+  801b3e:	68 a9 32 80 00       	push   $0x8032a9
+  801b43:	e8 0f 07 00 00       	call   802257 <cprintf>
+  801b48:	83 c4 10             	add    $0x10,%esp
+  801b4b:	eb b9                	jmp    801b06 <_pipeisclosed+0xd>
+  801b4d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b50:	0f 94 c0             	sete   %al
+  801b53:	0f b6 c0             	movzbl %al,%eax
+  801b56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b59:	5b                   	pop    %ebx
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5f                   	pop    %edi
+  801b5c:	5d                   	pop    %ebp
+  801b5d:	c3                   	ret
+
+00801b5e <devpipe_write>:
+  801b5e:	55                   	push   %ebp
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	57                   	push   %edi
+  801b62:	56                   	push   %esi
+  801b63:	53                   	push   %ebx
+  801b64:	83 ec 28             	sub    $0x28,%esp
+  801b67:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b6a:	56                   	push   %esi
+  801b6b:	e8 bd ee ff ff       	call   800a2d <fd2data>
+  801b70:	89 c3                	mov    %eax,%ebx
+  801b72:	83 c4 10             	add    $0x10,%esp
+  801b75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b7a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b7e:	74 5c                	je     801bdc <devpipe_write+0x7e>
+  801b80:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b83:	8b 0b                	mov    (%ebx),%ecx
+  801b85:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b88:	39 d0                	cmp    %edx,%eax
+  801b8a:	72 1e                	jb     801baa <devpipe_write+0x4c>
+  801b8c:	89 da                	mov    %ebx,%edx
+  801b8e:	89 f0                	mov    %esi,%eax
+  801b90:	e8 64 ff ff ff       	call   801af9 <_pipeisclosed>
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	75 48                	jne    801be1 <devpipe_write+0x83>
+  801b99:	e8 c6 e5 ff ff       	call   800164 <sys_yield>
+  801b9e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ba1:	8b 0b                	mov    (%ebx),%ecx
+  801ba3:	8d 51 20             	lea    0x20(%ecx),%edx
+  801ba6:	39 d0                	cmp    %edx,%eax
+  801ba8:	73 e2                	jae    801b8c <devpipe_write+0x2e>
+  801baa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bad:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801bb1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801bb4:	89 c2                	mov    %eax,%edx
+  801bb6:	c1 fa 1f             	sar    $0x1f,%edx
+  801bb9:	89 d1                	mov    %edx,%ecx
+  801bbb:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bbe:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bc1:	83 e2 1f             	and    $0x1f,%edx
+  801bc4:	29 ca                	sub    %ecx,%edx
+  801bc6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bca:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bce:	83 c0 01             	add    $0x1,%eax
+  801bd1:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bd4:	83 c7 01             	add    $0x1,%edi
+  801bd7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bda:	75 a4                	jne    801b80 <devpipe_write+0x22>
+  801bdc:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bdf:	eb 05                	jmp    801be6 <devpipe_write+0x88>
+  801be1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be9:	5b                   	pop    %ebx
+  801bea:	5e                   	pop    %esi
+  801beb:	5f                   	pop    %edi
+  801bec:	5d                   	pop    %ebp
+  801bed:	c3                   	ret
+
+00801bee <devpipe_read>:
+  801bee:	55                   	push   %ebp
+  801bef:	89 e5                	mov    %esp,%ebp
+  801bf1:	57                   	push   %edi
+  801bf2:	56                   	push   %esi
+  801bf3:	53                   	push   %ebx
+  801bf4:	83 ec 18             	sub    $0x18,%esp
+  801bf7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bfa:	56                   	push   %esi
+  801bfb:	e8 2d ee ff ff       	call   800a2d <fd2data>
+  801c00:	89 c3                	mov    %eax,%ebx
+  801c02:	83 c4 10             	add    $0x10,%esp
+  801c05:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c0e:	74 45                	je     801c55 <devpipe_read+0x67>
+  801c10:	8b 03                	mov    (%ebx),%eax
+  801c12:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c15:	75 1d                	jne    801c34 <devpipe_read+0x46>
+  801c17:	85 ff                	test   %edi,%edi
+  801c19:	75 3f                	jne    801c5a <devpipe_read+0x6c>
+  801c1b:	89 da                	mov    %ebx,%edx
+  801c1d:	89 f0                	mov    %esi,%eax
+  801c1f:	e8 d5 fe ff ff       	call   801af9 <_pipeisclosed>
+  801c24:	85 c0                	test   %eax,%eax
+  801c26:	75 3c                	jne    801c64 <devpipe_read+0x76>
+  801c28:	e8 37 e5 ff ff       	call   800164 <sys_yield>
+  801c2d:	8b 03                	mov    (%ebx),%eax
+  801c2f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c32:	74 e7                	je     801c1b <devpipe_read+0x2d>
+  801c34:	99                   	cltd
+  801c35:	c1 ea 1b             	shr    $0x1b,%edx
+  801c38:	01 d0                	add    %edx,%eax
+  801c3a:	83 e0 1f             	and    $0x1f,%eax
+  801c3d:	29 d0                	sub    %edx,%eax
+  801c3f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c47:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c4a:	83 03 01             	addl   $0x1,(%ebx)
+  801c4d:	83 c7 01             	add    $0x1,%edi
+  801c50:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c53:	75 bb                	jne    801c10 <devpipe_read+0x22>
+  801c55:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c58:	eb 02                	jmp    801c5c <devpipe_read+0x6e>
+  801c5a:	89 f8                	mov    %edi,%eax
+  801c5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5f:	5b                   	pop    %ebx
+  801c60:	5e                   	pop    %esi
+  801c61:	5f                   	pop    %edi
+  801c62:	5d                   	pop    %ebp
+  801c63:	c3                   	ret
+  801c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c69:	eb f1                	jmp    801c5c <devpipe_read+0x6e>
+
+00801c6b <pipe>:
+  801c6b:	55                   	push   %ebp
+  801c6c:	89 e5                	mov    %esp,%ebp
+  801c6e:	56                   	push   %esi
+  801c6f:	53                   	push   %ebx
+  801c70:	83 ec 1c             	sub    $0x1c,%esp
+  801c73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c76:	50                   	push   %eax
+  801c77:	e8 c8 ed ff ff       	call   800a44 <fd_alloc>
+  801c7c:	89 c3                	mov    %eax,%ebx
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	0f 88 23 01 00 00    	js     801dac <pipe+0x141>
+  801c89:	83 ec 04             	sub    $0x4,%esp
+  801c8c:	68 07 04 00 00       	push   $0x407
+  801c91:	ff 75 f4             	push   -0xc(%ebp)
+  801c94:	6a 00                	push   $0x0
+  801c96:	e8 14 e5 ff ff       	call   8001af <sys_page_alloc>
+  801c9b:	89 c3                	mov    %eax,%ebx
+  801c9d:	83 c4 10             	add    $0x10,%esp
+  801ca0:	85 c0                	test   %eax,%eax
+  801ca2:	0f 88 04 01 00 00    	js     801dac <pipe+0x141>
+  801ca8:	83 ec 0c             	sub    $0xc,%esp
+  801cab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cae:	50                   	push   %eax
+  801caf:	e8 90 ed ff ff       	call   800a44 <fd_alloc>
+  801cb4:	89 c3                	mov    %eax,%ebx
+  801cb6:	83 c4 10             	add    $0x10,%esp
+  801cb9:	85 c0                	test   %eax,%eax
+  801cbb:	0f 88 db 00 00 00    	js     801d9c <pipe+0x131>
+  801cc1:	83 ec 04             	sub    $0x4,%esp
+  801cc4:	68 07 04 00 00       	push   $0x407
+  801cc9:	ff 75 f0             	push   -0x10(%ebp)
+  801ccc:	6a 00                	push   $0x0
+  801cce:	e8 dc e4 ff ff       	call   8001af <sys_page_alloc>
+  801cd3:	89 c3                	mov    %eax,%ebx
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	0f 88 bc 00 00 00    	js     801d9c <pipe+0x131>
+  801ce0:	83 ec 0c             	sub    $0xc,%esp
+  801ce3:	ff 75 f4             	push   -0xc(%ebp)
+  801ce6:	e8 42 ed ff ff       	call   800a2d <fd2data>
+  801ceb:	89 c6                	mov    %eax,%esi
+  801ced:	83 c4 0c             	add    $0xc,%esp
+  801cf0:	68 07 04 00 00       	push   $0x407
+  801cf5:	50                   	push   %eax
+  801cf6:	6a 00                	push   $0x0
+  801cf8:	e8 b2 e4 ff ff       	call   8001af <sys_page_alloc>
+  801cfd:	89 c3                	mov    %eax,%ebx
+  801cff:	83 c4 10             	add    $0x10,%esp
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	0f 88 82 00 00 00    	js     801d8c <pipe+0x121>
+  801d0a:	83 ec 0c             	sub    $0xc,%esp
+  801d0d:	ff 75 f0             	push   -0x10(%ebp)
+  801d10:	e8 18 ed ff ff       	call   800a2d <fd2data>
+  801d15:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d1c:	50                   	push   %eax
+  801d1d:	6a 00                	push   $0x0
+  801d1f:	56                   	push   %esi
+  801d20:	6a 00                	push   $0x0
+  801d22:	e8 cb e4 ff ff       	call   8001f2 <sys_page_map>
+  801d27:	89 c3                	mov    %eax,%ebx
+  801d29:	83 c4 20             	add    $0x20,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 4e                	js     801d7e <pipe+0x113>
+  801d30:	a1 40 40 80 00       	mov    0x804040,%eax
+  801d35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d38:	89 02                	mov    %eax,(%edx)
+  801d3a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d3d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d44:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d47:	89 02                	mov    %eax,(%edx)
+  801d49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d4c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d53:	83 ec 0c             	sub    $0xc,%esp
+  801d56:	ff 75 f4             	push   -0xc(%ebp)
+  801d59:	e8 bf ec ff ff       	call   800a1d <fd2num>
+  801d5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d61:	89 01                	mov    %eax,(%ecx)
+  801d63:	83 c4 04             	add    $0x4,%esp
+  801d66:	ff 75 f0             	push   -0x10(%ebp)
+  801d69:	e8 af ec ff ff       	call   800a1d <fd2num>
+  801d6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d71:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7c:	eb 2e                	jmp    801dac <pipe+0x141>
+  801d7e:	83 ec 08             	sub    $0x8,%esp
+  801d81:	56                   	push   %esi
+  801d82:	6a 00                	push   $0x0
+  801d84:	e8 f8 e4 ff ff       	call   800281 <sys_page_unmap>
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	83 ec 08             	sub    $0x8,%esp
+  801d8f:	ff 75 f0             	push   -0x10(%ebp)
+  801d92:	6a 00                	push   $0x0
+  801d94:	e8 e8 e4 ff ff       	call   800281 <sys_page_unmap>
+  801d99:	83 c4 10             	add    $0x10,%esp
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+  801d9f:	ff 75 f4             	push   -0xc(%ebp)
+  801da2:	6a 00                	push   $0x0
+  801da4:	e8 d8 e4 ff ff       	call   800281 <sys_page_unmap>
+  801da9:	83 c4 10             	add    $0x10,%esp
+  801dac:	89 d8                	mov    %ebx,%eax
+  801dae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db1:	5b                   	pop    %ebx
+  801db2:	5e                   	pop    %esi
+  801db3:	5d                   	pop    %ebp
+  801db4:	c3                   	ret
+
+00801db5 <pipeisclosed>:
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	83 ec 20             	sub    $0x20,%esp
+  801dbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dbe:	50                   	push   %eax
+  801dbf:	ff 75 08             	push   0x8(%ebp)
+  801dc2:	e8 cd ec ff ff       	call   800a94 <fd_lookup>
+  801dc7:	83 c4 10             	add    $0x10,%esp
+  801dca:	85 c0                	test   %eax,%eax
+  801dcc:	78 18                	js     801de6 <pipeisclosed+0x31>
+  801dce:	83 ec 0c             	sub    $0xc,%esp
+  801dd1:	ff 75 f4             	push   -0xc(%ebp)
+  801dd4:	e8 54 ec ff ff       	call   800a2d <fd2data>
+  801dd9:	89 c2                	mov    %eax,%edx
+  801ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dde:	e8 16 fd ff ff       	call   801af9 <_pipeisclosed>
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	c9                   	leave
+  801de7:	c3                   	ret
+
+00801de8 <ipcring_init>:
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	53                   	push   %ebx
+  801dec:	83 ec 08             	sub    $0x8,%esp
+  801def:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801df2:	6a 60                	push   $0x60
+  801df4:	6a 00                	push   $0x0
+  801df6:	53                   	push   %ebx
+  801df7:	e8 cd 0c 00 00       	call   802ac9 <memset>
+  801dfc:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e01:	8b 40 48             	mov    0x48(%eax),%eax
+  801e04:	89 03                	mov    %eax,(%ebx)
+  801e06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e09:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e0c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e0f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e12:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e15:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e18:	83 c4 10             	add    $0x10,%esp
+  801e1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1e:	c9                   	leave
+  801e1f:	c3                   	ret
+
+00801e20 <ipcring_req_slot>:
+  801e20:	55                   	push   %ebp
+  801e21:	89 e5                	mov    %esp,%ebp
+  801e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e26:	8b 50 10             	mov    0x10(%eax),%edx
+  801e29:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e2c:	29 ca                	sub    %ecx,%edx
+  801e2e:	83 fa 07             	cmp    $0x7,%edx
+  801e31:	77 0c                	ja     801e3f <ipcring_req_slot+0x1f>
+  801e33:	8b 50 10             	mov    0x10(%eax),%edx
+  801e36:	83 e2 07             	and    $0x7,%edx
+  801e39:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e3d:	5d                   	pop    %ebp
+  801e3e:	c3                   	ret
+  801e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e44:	eb f7                	jmp    801e3d <ipcring_req_slot+0x1d>
+
+00801e46 <ipcring_req_push>:
+  801e46:	55                   	push   %ebp
+  801e47:	89 e5                	mov    %esp,%ebp
+  801e49:	83 ec 08             	sub    $0x8,%esp
+  801e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e4f:	8b 42 10             	mov    0x10(%edx),%eax
+  801e52:	83 c0 01             	add    $0x1,%eax
+  801e55:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5e:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	75 02                	jne    801e68 <ipcring_req_push+0x22>
+  801e66:	c9                   	leave
+  801e67:	c3                   	ret
+  801e68:	6a 00                	push   $0x0
+  801e6a:	68 00 00 80 ee       	push   $0xee800000
+  801e6f:	ff 72 08             	push   0x8(%edx)
+  801e72:	ff 72 04             	push   0x4(%edx)
+  801e75:	e8 6d e6 ff ff       	call   8004e7 <sys_ipc_send>
+  801e7a:	83 c4 10             	add    $0x10,%esp
+  801e7d:	eb e7                	jmp    801e66 <ipcring_req_push+0x20>
+
+00801e7f <ipcring_rsp_wait>:
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	53                   	push   %ebx
+  801e83:	83 ec 04             	sub    $0x4,%esp
+  801e86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e89:	8b 53 18             	mov    0x18(%ebx),%edx
+  801e8c:	8b 43 10             	mov    0x10(%ebx),%eax
+  801e8f:	39 c2                	cmp    %eax,%edx
+  801e91:	74 3c                	je     801ecf <ipcring_rsp_wait+0x50>
+  801e93:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e96:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e99:	39 c2                	cmp    %eax,%edx
+  801e9b:	75 23                	jne    801ec0 <ipcring_rsp_wait+0x41>
+  801e9d:	83 ec 08             	sub    $0x8,%esp
+  801ea0:	6a 00                	push   $0x0
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	6a 00                	push   $0x0
+  801ea6:	6a 00                	push   $0x0
+  801ea8:	ff 73 0c             	push   0xc(%ebx)
+  801eab:	ff 73 04             	push   0x4(%ebx)
+  801eae:	e8 cb 0e 00 00       	call   802d7e <ipc_call>
+  801eb3:	8b 53 14             	mov    0x14(%ebx),%edx
+  801eb6:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eb9:	83 c4 20             	add    $0x20,%esp
+  801ebc:	39 c2                	cmp    %eax,%edx
+  801ebe:	74 dd                	je     801e9d <ipcring_rsp_wait+0x1e>
+  801ec0:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ec3:	83 e0 07             	and    $0x7,%eax
+  801ec6:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801eca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ecd:	c9                   	leave
+  801ece:	c3                   	ret
+  801ecf:	68 c4 32 80 00       	push   $0x8032c4
+  801ed4:	68 75 32 80 00       	push   $0x803275
+  801ed9:	6a 3b                	push   $0x3b
+  801edb:	68 e5 32 80 00       	push   $0x8032e5
+  801ee0:	e8 97 02 00 00       	call   80217c <_panic>
+
+00801ee5 <ipcring_rsp_pop>:
+  801ee5:	55                   	push   %ebp
+  801ee6:	89 e5                	mov    %esp,%ebp
+  801ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eeb:	8b 42 18             	mov    0x18(%edx),%eax
+  801eee:	83 c0 01             	add    $0x1,%eax
+  801ef1:	89 42 18             	mov    %eax,0x18(%edx)
+  801ef4:	5d                   	pop    %ebp
+  801ef5:	c3                   	ret
+
+00801ef6 <ipcring_server_init>:
+  801ef6:	55                   	push   %ebp
+  801ef7:	89 e5                	mov    %esp,%ebp
+  801ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eff:	89 10                	mov    %edx,(%eax)
+  801f01:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f04:	89 50 04             	mov    %edx,0x4(%eax)
+  801f07:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801f0e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f15:	5d                   	pop    %ebp
+  801f16:	c3                   	ret
+
+00801f17 <ipcring_req_avail>:
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1d:	8b 02                	mov    (%edx),%eax
+  801f1f:	8b 40 10             	mov    0x10(%eax),%eax
+  801f22:	2b 42 08             	sub    0x8(%edx),%eax
+  801f25:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f2a:	39 d0                	cmp    %edx,%eax
+  801f2c:	0f 47 c2             	cmova  %edx,%eax
+  801f2f:	5d                   	pop    %ebp
+  801f30:	c3                   	ret
+
+00801f31 <ipcring_req_peek>:
+  801f31:	55                   	push   %ebp
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f37:	8b 42 08             	mov    0x8(%edx),%eax
+  801f3a:	83 e0 07             	and    $0x7,%eax
+  801f3d:	8b 12                	mov    (%edx),%edx
+  801f3f:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f43:	5d                   	pop    %ebp
+  801f44:	c3                   	ret
+
+00801f45 <ipcring_rsp_push>:
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	83 ec 08             	sub    $0x8,%esp
+  801f4b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f4e:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f51:	83 c0 01             	add    $0x1,%eax
+  801f54:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f57:	8b 11                	mov    (%ecx),%edx
+  801f59:	83 c2 14             	add    $0x14,%edx
+  801f5c:	f0 87 02             	lock xchg %eax,(%edx)
+  801f5f:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f63:	75 02                	jne    801f67 <ipcring_rsp_push+0x22>
+  801f65:	c9                   	leave
+  801f66:	c3                   	ret
+  801f67:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f6e:	6a 00                	push   $0x0
+  801f70:	68 00 00 80 ee       	push   $0xee800000
+  801f75:	6a 00                	push   $0x0
+  801f77:	ff 71 04             	push   0x4(%ecx)
+  801f7a:	e8 8b e4 ff ff       	call   80040a <sys_ipc_try_send>
+  801f7f:	83 c4 10             	add    $0x10,%esp
+  801f82:	eb e1                	jmp    801f65 <ipcring_rsp_push+0x20>
+
+00801f84 <ipcring_client_wait>:
+  801f84:	55                   	push   %ebp
+  801f85:	89 e5                	mov    %esp,%ebp
+  801f87:	83 ec 08             	sub    $0x8,%esp
+  801f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8d:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801f94:	8b 10                	mov    (%eax),%edx
+  801f96:	8b 52 18             	mov    0x18(%edx),%edx
+  801f99:	3b 50 08             	cmp    0x8(%eax),%edx
+  801f9c:	75 02                	jne    801fa0 <ipcring_client_wait+0x1c>
+  801f9e:	c9                   	leave
+  801f9f:	c3                   	ret
+  801fa0:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801fa7:	6a 00                	push   $0x0
+  801fa9:	68 00 00 80 ee       	push   $0xee800000
+  801fae:	6a 00                	push   $0x0
+  801fb0:	ff 70 04             	push   0x4(%eax)
+  801fb3:	e8 52 e4 ff ff       	call   80040a <sys_ipc_try_send>
+  801fb8:	83 c4 10             	add    $0x10,%esp
+  801fbb:	eb e1                	jmp    801f9e <ipcring_client_wait+0x1a>
+
+00801fbd <ipcring_server_sleep>:
+  801fbd:	55                   	push   %ebp
+  801fbe:	89 e5                	mov    %esp,%ebp
+  801fc0:	53                   	push   %ebx
+  801fc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fc4:	8b 01                	mov    (%ecx),%eax
+  801fc6:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fce:	f0 87 02             	lock xchg %eax,(%edx)
+  801fd1:	8b 11                	mov    (%ecx),%edx
+  801fd3:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fd6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fdb:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801fde:	74 0e                	je     801fee <ipcring_server_sleep+0x31>
+  801fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe5:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ff1:	c9                   	leave
+  801ff2:	c3                   	ret
+
+00801ff3 <devcons_close>:
+  801ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff8:	c3                   	ret
+
+00801ff9 <devcons_stat>:
+  801ff9:	55                   	push   %ebp
+  801ffa:	89 e5                	mov    %esp,%ebp
+  801ffc:	83 ec 10             	sub    $0x10,%esp
+  801fff:	68 f3 32 80 00       	push   $0x8032f3
+  802004:	ff 75 0c             	push   0xc(%ebp)
+  802007:	e8 42 09 00 00       	call   80294e <strcpy>
+  80200c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+
+00802013 <devcons_write>:
+  802013:	55                   	push   %ebp
+  802014:	89 e5                	mov    %esp,%ebp
+  802016:	57                   	push   %edi
+  802017:	56                   	push   %esi
+  802018:	53                   	push   %ebx
+  802019:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80201f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802022:	85 ff                	test   %edi,%edi
+  802024:	74 51                	je     802077 <devcons_write+0x64>
+  802026:	be 00 00 00 00       	mov    $0x0,%esi
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802030:	89 fb                	mov    %edi,%ebx
+  802032:	29 c3                	sub    %eax,%ebx
+  802034:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802039:	39 d3                	cmp    %edx,%ebx
+  80203b:	0f 47 da             	cmova  %edx,%ebx
+  80203e:	83 ec 04             	sub    $0x4,%esp
+  802041:	53                   	push   %ebx
+  802042:	03 45 0c             	add    0xc(%ebp),%eax
+  802045:	50                   	push   %eax
+  802046:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80204c:	50                   	push   %eax
+  80204d:	e8 ac 0a 00 00       	call   802afe <memmove>
+  802052:	83 c4 08             	add    $0x8,%esp
+  802055:	53                   	push   %ebx
+  802056:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80205c:	50                   	push   %eax
+  80205d:	e8 65 e0 ff ff       	call   8000c7 <sys_cputs>
+  802062:	01 de                	add    %ebx,%esi
+  802064:	89 f0                	mov    %esi,%eax
+  802066:	83 c4 10             	add    $0x10,%esp
+  802069:	39 fe                	cmp    %edi,%esi
+  80206b:	72 c3                	jb     802030 <devcons_write+0x1d>
+  80206d:	89 f0                	mov    %esi,%eax
+  80206f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802072:	5b                   	pop    %ebx
+  802073:	5e                   	pop    %esi
+  802074:	5f                   	pop    %edi
+  802075:	5d                   	pop    %ebp
+  802076:	c3                   	ret
+  802077:	be 00 00 00 00       	mov    $0x0,%esi
+  80207c:	eb ef                	jmp    80206d <devcons_write+0x5a>
+
+0080207e <devcons_read>:
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	83 ec 08             	sub    $0x8,%esp
+  802084:	b8 00 00 00 00       	mov    $0x0,%eax
+  802089:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80208d:	75 07                	jne    802096 <devcons_read+0x18>
+  80208f:	eb 1f                	jmp    8020b0 <devcons_read+0x32>
+  802091:	e8 ce e0 ff ff       	call   800164 <sys_yield>
+  802096:	e8 4a e0 ff ff       	call   8000e5 <sys_cgetc>
+  80209b:	85 c0                	test   %eax,%eax
+  80209d:	74 f2                	je     802091 <devcons_read+0x13>
+  80209f:	78 0f                	js     8020b0 <devcons_read+0x32>
+  8020a1:	83 f8 04             	cmp    $0x4,%eax
+  8020a4:	74 0c                	je     8020b2 <devcons_read+0x34>
+  8020a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020a9:	88 02                	mov    %al,(%edx)
+  8020ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020b0:	c9                   	leave
+  8020b1:	c3                   	ret
+  8020b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b7:	eb f7                	jmp    8020b0 <devcons_read+0x32>
+
+008020b9 <cputchar>:
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	83 ec 20             	sub    $0x20,%esp
+  8020bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c2:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020c5:	6a 01                	push   $0x1
+  8020c7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020ca:	50                   	push   %eax
+  8020cb:	e8 f7 df ff ff       	call   8000c7 <sys_cputs>
+  8020d0:	83 c4 10             	add    $0x10,%esp
+  8020d3:	c9                   	leave
+  8020d4:	c3                   	ret
+
+008020d5 <getchar>:
+  8020d5:	55                   	push   %ebp
+  8020d6:	89 e5                	mov    %esp,%ebp
+  8020d8:	83 ec 1c             	sub    $0x1c,%esp
+  8020db:	6a 01                	push   $0x1
+  8020dd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020e0:	50                   	push   %eax
+  8020e1:	6a 00                	push   $0x0
+  8020e3:	e8 0e ec ff ff       	call   800cf6 <read>
+  8020e8:	83 c4 10             	add    $0x10,%esp
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 06                	js     8020f5 <getchar+0x20>
+  8020ef:	74 06                	je     8020f7 <getchar+0x22>
+  8020f1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8020f5:	c9                   	leave
+  8020f6:	c3                   	ret
+  8020f7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020fc:	eb f7                	jmp    8020f5 <getchar+0x20>
+
+008020fe <iscons>:
+  8020fe:	55                   	push   %ebp
+  8020ff:	89 e5                	mov    %esp,%ebp
+  802101:	83 ec 20             	sub    $0x20,%esp
+  802104:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802107:	50                   	push   %eax
+  802108:	ff 75 08             	push   0x8(%ebp)
+  80210b:	e8 84 e9 ff ff       	call   800a94 <fd_lookup>
+  802110:	83 c4 10             	add    $0x10,%esp
+  802113:	85 c0                	test   %eax,%eax
+  802115:	78 11                	js     802128 <iscons+0x2a>
+  802117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80211a:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802120:	39 10                	cmp    %edx,(%eax)
+  802122:	0f 94 c0             	sete   %al
+  802125:	0f b6 c0             	movzbl %al,%eax
+  802128:	c9                   	leave
+  802129:	c3                   	ret
+
+0080212a <opencons>:
+  80212a:	55                   	push   %ebp
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	83 ec 24             	sub    $0x24,%esp
+  802130:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802133:	50                   	push   %eax
+  802134:	e8 0b e9 ff ff       	call   800a44 <fd_alloc>
+  802139:	83 c4 10             	add    $0x10,%esp
+  80213c:	85 c0                	test   %eax,%eax
+  80213e:	78 3a                	js     80217a <opencons+0x50>
+  802140:	83 ec 04             	sub    $0x4,%esp
+  802143:	68 07 04 00 00       	push   $0x407
+  802148:	ff 75 f4             	push   -0xc(%ebp)
+  80214b:	6a 00                	push   $0x0
+  80214d:	e8 5d e0 ff ff       	call   8001af <sys_page_alloc>
+  802152:	83 c4 10             	add    $0x10,%esp
+  802155:	85 c0                	test   %eax,%eax
+  802157:	78 21                	js     80217a <opencons+0x50>
+  802159:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80215c:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802162:	89 10                	mov    %edx,(%eax)
+  802164:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802167:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80216e:	83 ec 0c             	sub    $0xc,%esp
+  802171:	50                   	push   %eax
+  802172:	e8 a6 e8 ff ff       	call   800a1d <fd2num>
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	c9                   	leave
+  80217b:	c3                   	ret
+
+0080217c <_panic>:
+  80217c:	55                   	push   %ebp
+  80217d:	89 e5                	mov    %esp,%ebp
+  80217f:	56                   	push   %esi
+  802180:	53                   	push   %ebx
+  802181:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802184:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  80218a:	e8 b6 df ff ff       	call   800145 <sys_getenvid>
+  80218f:	83 ec 0c             	sub    $0xc,%esp
+  802192:	ff 75 0c             	push   0xc(%ebp)
+  802195:	ff 75 08             	push   0x8(%ebp)
+  802198:	56                   	push   %esi
+  802199:	50                   	push   %eax
+  80219a:	68 00 33 80 00       	push   $0x803300
+  80219f:	e8 b3 00 00 00       	call   802257 <cprintf>
+  8021a4:	83 c4 18             	add    $0x18,%esp
+  8021a7:	53                   	push   %ebx
+  8021a8:	ff 75 10             	push   0x10(%ebp)
+  8021ab:	e8 56 00 00 00       	call   802206 <vcprintf>
+  8021b0:	c7 04 24 ba 32 80 00 	movl   $0x8032ba,(%esp)
+  8021b7:	e8 9b 00 00 00       	call   802257 <cprintf>
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	cc                   	int3
+  8021c0:	eb fd                	jmp    8021bf <_panic+0x43>
+
+008021c2 <putch>:
+  8021c2:	55                   	push   %ebp
+  8021c3:	89 e5                	mov    %esp,%ebp
+  8021c5:	53                   	push   %ebx
+  8021c6:	83 ec 04             	sub    $0x4,%esp
+  8021c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021cc:	8b 13                	mov    (%ebx),%edx
+  8021ce:	8d 42 01             	lea    0x1(%edx),%eax
+  8021d1:	89 03                	mov    %eax,(%ebx)
+  8021d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021d6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021da:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021df:	74 09                	je     8021ea <putch+0x28>
+  8021e1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e8:	c9                   	leave
+  8021e9:	c3                   	ret
+  8021ea:	83 ec 08             	sub    $0x8,%esp
+  8021ed:	68 ff 00 00 00       	push   $0xff
+  8021f2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	e8 cc de ff ff       	call   8000c7 <sys_cputs>
+  8021fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	eb db                	jmp    8021e1 <putch+0x1f>
+
+00802206 <vcprintf>:
+  802206:	55                   	push   %ebp
+  802207:	89 e5                	mov    %esp,%ebp
+  802209:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80220f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802216:	00 00 00 
+  802219:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802220:	00 00 00 
+  802223:	ff 75 0c             	push   0xc(%ebp)
+  802226:	ff 75 08             	push   0x8(%ebp)
+  802229:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80222f:	50                   	push   %eax
+  802230:	68 c2 21 80 00       	push   $0x8021c2
+  802235:	e8 1c 01 00 00       	call   802356 <vprintfmt>
+  80223a:	83 c4 08             	add    $0x8,%esp
+  80223d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802243:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802249:	50                   	push   %eax
+  80224a:	e8 78 de ff ff       	call   8000c7 <sys_cputs>
+  80224f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+
+00802257 <cprintf>:
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	83 ec 10             	sub    $0x10,%esp
+  80225d:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802260:	50                   	push   %eax
+  802261:	ff 75 08             	push   0x8(%ebp)
+  802264:	e8 9d ff ff ff       	call   802206 <vcprintf>
+  802269:	c9                   	leave
+  80226a:	c3                   	ret
+
+0080226b <printnum>:
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	57                   	push   %edi
+  80226f:	56                   	push   %esi
+  802270:	53                   	push   %ebx
+  802271:	83 ec 1c             	sub    $0x1c,%esp
+  802274:	89 c3                	mov    %eax,%ebx
+  802276:	89 d6                	mov    %edx,%esi
+  802278:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80227e:	89 d1                	mov    %edx,%ecx
+  802280:	89 c2                	mov    %eax,%edx
+  802282:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802285:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802288:	8b 45 10             	mov    0x10(%ebp),%eax
+  80228b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80228e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802295:	39 c2                	cmp    %eax,%edx
+  802297:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80229a:	73 4b                	jae    8022e7 <printnum+0x7c>
+  80229c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80229f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8022a2:	85 ff                	test   %edi,%edi
+  8022a4:	7e 11                	jle    8022b7 <printnum+0x4c>
+  8022a6:	83 ec 08             	sub    $0x8,%esp
+  8022a9:	56                   	push   %esi
+  8022aa:	ff 75 18             	push   0x18(%ebp)
+  8022ad:	ff d3                	call   *%ebx
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	83 ef 01             	sub    $0x1,%edi
+  8022b5:	75 ef                	jne    8022a6 <printnum+0x3b>
+  8022b7:	83 ec 08             	sub    $0x8,%esp
+  8022ba:	56                   	push   %esi
+  8022bb:	83 ec 04             	sub    $0x4,%esp
+  8022be:	ff 75 e4             	push   -0x1c(%ebp)
+  8022c1:	ff 75 e0             	push   -0x20(%ebp)
+  8022c4:	ff 75 dc             	push   -0x24(%ebp)
+  8022c7:	ff 75 d8             	push   -0x28(%ebp)
+  8022ca:	e8 9b 0d 00 00       	call   80306a <__umoddi3>
+  8022cf:	83 c4 14             	add    $0x14,%esp
+  8022d2:	0f be 80 23 33 80 00 	movsbl 0x803323(%eax),%eax
+  8022d9:	50                   	push   %eax
+  8022da:	ff d3                	call   *%ebx
+  8022dc:	83 c4 10             	add    $0x10,%esp
+  8022df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e2:	5b                   	pop    %ebx
+  8022e3:	5e                   	pop    %esi
+  8022e4:	5f                   	pop    %edi
+  8022e5:	5d                   	pop    %ebp
+  8022e6:	c3                   	ret
+  8022e7:	83 ec 0c             	sub    $0xc,%esp
+  8022ea:	ff 75 18             	push   0x18(%ebp)
+  8022ed:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022f0:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8022f3:	52                   	push   %edx
+  8022f4:	50                   	push   %eax
+  8022f5:	83 ec 08             	sub    $0x8,%esp
+  8022f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8022fb:	ff 75 e0             	push   -0x20(%ebp)
+  8022fe:	ff 75 dc             	push   -0x24(%ebp)
+  802301:	ff 75 d8             	push   -0x28(%ebp)
+  802304:	e8 43 0d 00 00       	call   80304c <__udivdi3>
+  802309:	83 c4 18             	add    $0x18,%esp
+  80230c:	52                   	push   %edx
+  80230d:	50                   	push   %eax
+  80230e:	89 f2                	mov    %esi,%edx
+  802310:	89 d8                	mov    %ebx,%eax
+  802312:	e8 54 ff ff ff       	call   80226b <printnum>
+  802317:	83 c4 20             	add    $0x20,%esp
+  80231a:	eb 9b                	jmp    8022b7 <printnum+0x4c>
+
+0080231c <sprintputch>:
+  80231c:	55                   	push   %ebp
+  80231d:	89 e5                	mov    %esp,%ebp
+  80231f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802322:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802326:	8b 10                	mov    (%eax),%edx
+  802328:	3b 50 04             	cmp    0x4(%eax),%edx
+  80232b:	73 0a                	jae    802337 <sprintputch+0x1b>
+  80232d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802330:	89 08                	mov    %ecx,(%eax)
+  802332:	8b 45 08             	mov    0x8(%ebp),%eax
+  802335:	88 02                	mov    %al,(%edx)
+  802337:	5d                   	pop    %ebp
+  802338:	c3                   	ret
+
+00802339 <printfmt>:
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	83 ec 08             	sub    $0x8,%esp
+  80233f:	8d 45 14             	lea    0x14(%ebp),%eax
+  802342:	50                   	push   %eax
+  802343:	ff 75 10             	push   0x10(%ebp)
+  802346:	ff 75 0c             	push   0xc(%ebp)
+  802349:	ff 75 08             	push   0x8(%ebp)
+  80234c:	e8 05 00 00 00       	call   802356 <vprintfmt>
+  802351:	83 c4 10             	add    $0x10,%esp
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+00802356 <vprintfmt>:
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	57                   	push   %edi
+  80235a:	56                   	push   %esi
+  80235b:	53                   	push   %ebx
+  80235c:	83 ec 2c             	sub    $0x2c,%esp
+  80235f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802362:	89 df                	mov    %ebx,%edi
+  802364:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802367:	8b 45 10             	mov    0x10(%ebp),%eax
+  80236a:	8d 70 01             	lea    0x1(%eax),%esi
+  80236d:	0f b6 00             	movzbl (%eax),%eax
+  802370:	83 f8 25             	cmp    $0x25,%eax
+  802373:	74 1e                	je     802393 <vprintfmt+0x3d>
+  802375:	85 c0                	test   %eax,%eax
+  802377:	0f 84 15 05 00 00    	je     802892 <vprintfmt+0x53c>
+  80237d:	83 ec 08             	sub    $0x8,%esp
+  802380:	53                   	push   %ebx
+  802381:	50                   	push   %eax
+  802382:	ff d7                	call   *%edi
+  802384:	83 c6 01             	add    $0x1,%esi
+  802387:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80238b:	83 c4 10             	add    $0x10,%esp
+  80238e:	83 f8 25             	cmp    $0x25,%eax
+  802391:	75 e2                	jne    802375 <vprintfmt+0x1f>
+  802393:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  802397:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80239e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8023a5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8023ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023b1:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8023b4:	8d 56 01             	lea    0x1(%esi),%edx
+  8023b7:	0f b6 0e             	movzbl (%esi),%ecx
+  8023ba:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023bd:	3c 55                	cmp    $0x55,%al
+  8023bf:	0f 87 3b 04 00 00    	ja     802800 <vprintfmt+0x4aa>
+  8023c5:	0f b6 c0             	movzbl %al,%eax
+  8023c8:	ff 24 85 60 34 80 00 	jmp    *0x803460(,%eax,4)
+  8023cf:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023d2:	eb 93                	jmp    802367 <vprintfmt+0x11>
+  8023d4:	89 d6                	mov    %edx,%esi
+  8023d6:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023da:	eb d8                	jmp    8023b4 <vprintfmt+0x5e>
+  8023dc:	89 d6                	mov    %edx,%esi
+  8023de:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023e2:	eb d0                	jmp    8023b4 <vprintfmt+0x5e>
+  8023e4:	0f b6 c9             	movzbl %cl,%ecx
+  8023e7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8023ea:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023ed:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8023f1:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8023f4:	83 f9 09             	cmp    $0x9,%ecx
+  8023f7:	77 6f                	ja     802468 <vprintfmt+0x112>
+  8023f9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8023fc:	83 c2 01             	add    $0x1,%edx
+  8023ff:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802402:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  802406:	0f be 02             	movsbl (%edx),%eax
+  802409:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80240c:	83 fe 09             	cmp    $0x9,%esi
+  80240f:	76 eb                	jbe    8023fc <vprintfmt+0xa6>
+  802411:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802414:	89 d6                	mov    %edx,%esi
+  802416:	eb 13                	jmp    80242b <vprintfmt+0xd5>
+  802418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80241b:	8b 00                	mov    (%eax),%eax
+  80241d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802420:	8b 45 14             	mov    0x14(%ebp),%eax
+  802423:	8d 40 04             	lea    0x4(%eax),%eax
+  802426:	89 45 14             	mov    %eax,0x14(%ebp)
+  802429:	89 d6                	mov    %edx,%esi
+  80242b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80242f:	79 83                	jns    8023b4 <vprintfmt+0x5e>
+  802431:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802434:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802437:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80243e:	e9 71 ff ff ff       	jmp    8023b4 <vprintfmt+0x5e>
+  802443:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802446:	85 c9                	test   %ecx,%ecx
+  802448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244d:	0f 49 c1             	cmovns %ecx,%eax
+  802450:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802453:	89 d6                	mov    %edx,%esi
+  802455:	e9 5a ff ff ff       	jmp    8023b4 <vprintfmt+0x5e>
+  80245a:	89 d6                	mov    %edx,%esi
+  80245c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  802463:	e9 4c ff ff ff       	jmp    8023b4 <vprintfmt+0x5e>
+  802468:	89 d6                	mov    %edx,%esi
+  80246a:	eb bf                	jmp    80242b <vprintfmt+0xd5>
+  80246c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802470:	89 d6                	mov    %edx,%esi
+  802472:	e9 3d ff ff ff       	jmp    8023b4 <vprintfmt+0x5e>
+  802477:	89 55 10             	mov    %edx,0x10(%ebp)
+  80247a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80247d:	8d 70 04             	lea    0x4(%eax),%esi
+  802480:	83 ec 08             	sub    $0x8,%esp
+  802483:	53                   	push   %ebx
+  802484:	ff 30                	push   (%eax)
+  802486:	ff d7                	call   *%edi
+  802488:	83 c4 10             	add    $0x10,%esp
+  80248b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80248e:	e9 d4 fe ff ff       	jmp    802367 <vprintfmt+0x11>
+  802493:	89 55 10             	mov    %edx,0x10(%ebp)
+  802496:	8b 45 14             	mov    0x14(%ebp),%eax
+  802499:	8d 70 04             	lea    0x4(%eax),%esi
+  80249c:	8b 10                	mov    (%eax),%edx
+  80249e:	89 d0                	mov    %edx,%eax
+  8024a0:	f7 d8                	neg    %eax
+  8024a2:	0f 48 c2             	cmovs  %edx,%eax
+  8024a5:	83 f8 12             	cmp    $0x12,%eax
+  8024a8:	7f 23                	jg     8024cd <vprintfmt+0x177>
+  8024aa:	8b 14 85 c0 35 80 00 	mov    0x8035c0(,%eax,4),%edx
+  8024b1:	85 d2                	test   %edx,%edx
+  8024b3:	74 18                	je     8024cd <vprintfmt+0x177>
+  8024b5:	52                   	push   %edx
+  8024b6:	68 87 32 80 00       	push   $0x803287
+  8024bb:	53                   	push   %ebx
+  8024bc:	57                   	push   %edi
+  8024bd:	e8 77 fe ff ff       	call   802339 <printfmt>
+  8024c2:	83 c4 10             	add    $0x10,%esp
+  8024c5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024c8:	e9 9a fe ff ff       	jmp    802367 <vprintfmt+0x11>
+  8024cd:	50                   	push   %eax
+  8024ce:	68 3b 33 80 00       	push   $0x80333b
+  8024d3:	53                   	push   %ebx
+  8024d4:	57                   	push   %edi
+  8024d5:	e8 5f fe ff ff       	call   802339 <printfmt>
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024e0:	e9 82 fe ff ff       	jmp    802367 <vprintfmt+0x11>
+  8024e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024eb:	83 c0 04             	add    $0x4,%eax
+  8024ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8024f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024f4:	8b 00                	mov    (%eax),%eax
+  8024f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	0f 84 61 03 00 00    	je     802862 <vprintfmt+0x50c>
+  802501:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802505:	7e 06                	jle    80250d <vprintfmt+0x1b7>
+  802507:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80250b:	75 29                	jne    802536 <vprintfmt+0x1e0>
+  80250d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802510:	8d 70 01             	lea    0x1(%eax),%esi
+  802513:	0f b6 00             	movzbl (%eax),%eax
+  802516:	0f be d0             	movsbl %al,%edx
+  802519:	85 d2                	test   %edx,%edx
+  80251b:	0f 84 bb 00 00 00    	je     8025dc <vprintfmt+0x286>
+  802521:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802524:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802527:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80252a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80252d:	eb 7a                	jmp    8025a9 <vprintfmt+0x253>
+  80252f:	c7 45 d0 34 33 80 00 	movl   $0x803334,-0x30(%ebp)
+  802536:	83 ec 08             	sub    $0x8,%esp
+  802539:	ff 75 d4             	push   -0x2c(%ebp)
+  80253c:	ff 75 d0             	push   -0x30(%ebp)
+  80253f:	e8 e0 03 00 00       	call   802924 <strnlen>
+  802544:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802547:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80254a:	83 c4 10             	add    $0x10,%esp
+  80254d:	85 d2                	test   %edx,%edx
+  80254f:	0f 8e d6 02 00 00    	jle    80282b <vprintfmt+0x4d5>
+  802555:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802559:	83 ec 08             	sub    $0x8,%esp
+  80255c:	53                   	push   %ebx
+  80255d:	56                   	push   %esi
+  80255e:	ff d7                	call   *%edi
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802567:	75 f0                	jne    802559 <vprintfmt+0x203>
+  802569:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80256c:	8d 70 01             	lea    0x1(%eax),%esi
+  80256f:	0f b6 00             	movzbl (%eax),%eax
+  802572:	0f be d0             	movsbl %al,%edx
+  802575:	85 d2                	test   %edx,%edx
+  802577:	0f 84 da 02 00 00    	je     802857 <vprintfmt+0x501>
+  80257d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802580:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802583:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802586:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802589:	eb 1e                	jmp    8025a9 <vprintfmt+0x253>
+  80258b:	83 ec 08             	sub    $0x8,%esp
+  80258e:	ff 75 0c             	push   0xc(%ebp)
+  802591:	52                   	push   %edx
+  802592:	ff 55 08             	call   *0x8(%ebp)
+  802595:	83 c4 10             	add    $0x10,%esp
+  802598:	83 eb 01             	sub    $0x1,%ebx
+  80259b:	83 c6 01             	add    $0x1,%esi
+  80259e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8025a2:	0f be d0             	movsbl %al,%edx
+  8025a5:	85 d2                	test   %edx,%edx
+  8025a7:	74 2a                	je     8025d3 <vprintfmt+0x27d>
+  8025a9:	85 ff                	test   %edi,%edi
+  8025ab:	78 05                	js     8025b2 <vprintfmt+0x25c>
+  8025ad:	83 ef 01             	sub    $0x1,%edi
+  8025b0:	78 59                	js     80260b <vprintfmt+0x2b5>
+  8025b2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8025b6:	74 d3                	je     80258b <vprintfmt+0x235>
+  8025b8:	0f be c0             	movsbl %al,%eax
+  8025bb:	83 e8 20             	sub    $0x20,%eax
+  8025be:	83 f8 5e             	cmp    $0x5e,%eax
+  8025c1:	76 c8                	jbe    80258b <vprintfmt+0x235>
+  8025c3:	83 ec 08             	sub    $0x8,%esp
+  8025c6:	ff 75 0c             	push   0xc(%ebp)
+  8025c9:	6a 3f                	push   $0x3f
+  8025cb:	ff 55 08             	call   *0x8(%ebp)
+  8025ce:	83 c4 10             	add    $0x10,%esp
+  8025d1:	eb c5                	jmp    802598 <vprintfmt+0x242>
+  8025d3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025d6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025dc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025df:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025e3:	7e 1b                	jle    802600 <vprintfmt+0x2aa>
+  8025e5:	83 ec 08             	sub    $0x8,%esp
+  8025e8:	53                   	push   %ebx
+  8025e9:	6a 20                	push   $0x20
+  8025eb:	ff d7                	call   *%edi
+  8025ed:	83 c4 10             	add    $0x10,%esp
+  8025f0:	83 ee 01             	sub    $0x1,%esi
+  8025f3:	75 f0                	jne    8025e5 <vprintfmt+0x28f>
+  8025f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025fb:	e9 67 fd ff ff       	jmp    802367 <vprintfmt+0x11>
+  802600:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802603:	89 45 14             	mov    %eax,0x14(%ebp)
+  802606:	e9 5c fd ff ff       	jmp    802367 <vprintfmt+0x11>
+  80260b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80260e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802611:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802614:	eb c6                	jmp    8025dc <vprintfmt+0x286>
+  802616:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802619:	89 55 10             	mov    %edx,0x10(%ebp)
+  80261c:	83 f9 01             	cmp    $0x1,%ecx
+  80261f:	7f 1f                	jg     802640 <vprintfmt+0x2ea>
+  802621:	85 c9                	test   %ecx,%ecx
+  802623:	74 67                	je     80268c <vprintfmt+0x336>
+  802625:	8b 45 14             	mov    0x14(%ebp),%eax
+  802628:	8b 30                	mov    (%eax),%esi
+  80262a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80262d:	89 f0                	mov    %esi,%eax
+  80262f:	c1 f8 1f             	sar    $0x1f,%eax
+  802632:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802635:	8b 45 14             	mov    0x14(%ebp),%eax
+  802638:	8d 40 04             	lea    0x4(%eax),%eax
+  80263b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80263e:	eb 17                	jmp    802657 <vprintfmt+0x301>
+  802640:	8b 45 14             	mov    0x14(%ebp),%eax
+  802643:	8b 50 04             	mov    0x4(%eax),%edx
+  802646:	8b 00                	mov    (%eax),%eax
+  802648:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80264b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80264e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802651:	8d 40 08             	lea    0x8(%eax),%eax
+  802654:	89 45 14             	mov    %eax,0x14(%ebp)
+  802657:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80265a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80265d:	be 0a 00 00 00       	mov    $0xa,%esi
+  802662:	85 c9                	test   %ecx,%ecx
+  802664:	0f 89 12 01 00 00    	jns    80277c <vprintfmt+0x426>
+  80266a:	83 ec 08             	sub    $0x8,%esp
+  80266d:	53                   	push   %ebx
+  80266e:	6a 2d                	push   $0x2d
+  802670:	ff d7                	call   *%edi
+  802672:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802675:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802678:	f7 da                	neg    %edx
+  80267a:	83 d1 00             	adc    $0x0,%ecx
+  80267d:	f7 d9                	neg    %ecx
+  80267f:	83 c4 10             	add    $0x10,%esp
+  802682:	be 0a 00 00 00       	mov    $0xa,%esi
+  802687:	e9 f0 00 00 00       	jmp    80277c <vprintfmt+0x426>
+  80268c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80268f:	8b 30                	mov    (%eax),%esi
+  802691:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802694:	89 f0                	mov    %esi,%eax
+  802696:	c1 f8 1f             	sar    $0x1f,%eax
+  802699:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80269c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80269f:	8d 40 04             	lea    0x4(%eax),%eax
+  8026a2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026a5:	eb b0                	jmp    802657 <vprintfmt+0x301>
+  8026a7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026aa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026ad:	83 f9 01             	cmp    $0x1,%ecx
+  8026b0:	7f 1e                	jg     8026d0 <vprintfmt+0x37a>
+  8026b2:	85 c9                	test   %ecx,%ecx
+  8026b4:	74 32                	je     8026e8 <vprintfmt+0x392>
+  8026b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026b9:	8b 10                	mov    (%eax),%edx
+  8026bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8026c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026c6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026cb:	e9 ac 00 00 00       	jmp    80277c <vprintfmt+0x426>
+  8026d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026d3:	8b 10                	mov    (%eax),%edx
+  8026d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8026db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026de:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026e3:	e9 94 00 00 00       	jmp    80277c <vprintfmt+0x426>
+  8026e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026eb:	8b 10                	mov    (%eax),%edx
+  8026ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8026f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026f8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026fd:	eb 7d                	jmp    80277c <vprintfmt+0x426>
+  8026ff:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802702:	89 55 10             	mov    %edx,0x10(%ebp)
+  802705:	83 f9 01             	cmp    $0x1,%ecx
+  802708:	7f 1b                	jg     802725 <vprintfmt+0x3cf>
+  80270a:	85 c9                	test   %ecx,%ecx
+  80270c:	74 2c                	je     80273a <vprintfmt+0x3e4>
+  80270e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802711:	8b 10                	mov    (%eax),%edx
+  802713:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802718:	8d 40 04             	lea    0x4(%eax),%eax
+  80271b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80271e:	be 08 00 00 00       	mov    $0x8,%esi
+  802723:	eb 57                	jmp    80277c <vprintfmt+0x426>
+  802725:	8b 45 14             	mov    0x14(%ebp),%eax
+  802728:	8b 10                	mov    (%eax),%edx
+  80272a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80272d:	8d 40 08             	lea    0x8(%eax),%eax
+  802730:	89 45 14             	mov    %eax,0x14(%ebp)
+  802733:	be 08 00 00 00       	mov    $0x8,%esi
+  802738:	eb 42                	jmp    80277c <vprintfmt+0x426>
+  80273a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80273d:	8b 10                	mov    (%eax),%edx
+  80273f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802744:	8d 40 04             	lea    0x4(%eax),%eax
+  802747:	89 45 14             	mov    %eax,0x14(%ebp)
+  80274a:	be 08 00 00 00       	mov    $0x8,%esi
+  80274f:	eb 2b                	jmp    80277c <vprintfmt+0x426>
+  802751:	89 55 10             	mov    %edx,0x10(%ebp)
+  802754:	83 ec 08             	sub    $0x8,%esp
+  802757:	53                   	push   %ebx
+  802758:	6a 30                	push   $0x30
+  80275a:	ff d7                	call   *%edi
+  80275c:	83 c4 08             	add    $0x8,%esp
+  80275f:	53                   	push   %ebx
+  802760:	6a 78                	push   $0x78
+  802762:	ff d7                	call   *%edi
+  802764:	8b 45 14             	mov    0x14(%ebp),%eax
+  802767:	8b 10                	mov    (%eax),%edx
+  802769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80276e:	83 c4 10             	add    $0x10,%esp
+  802771:	8d 40 04             	lea    0x4(%eax),%eax
+  802774:	89 45 14             	mov    %eax,0x14(%ebp)
+  802777:	be 10 00 00 00       	mov    $0x10,%esi
+  80277c:	83 ec 0c             	sub    $0xc,%esp
+  80277f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802783:	50                   	push   %eax
+  802784:	ff 75 e4             	push   -0x1c(%ebp)
+  802787:	56                   	push   %esi
+  802788:	51                   	push   %ecx
+  802789:	52                   	push   %edx
+  80278a:	89 da                	mov    %ebx,%edx
+  80278c:	89 f8                	mov    %edi,%eax
+  80278e:	e8 d8 fa ff ff       	call   80226b <printnum>
+  802793:	83 c4 20             	add    $0x20,%esp
+  802796:	e9 cc fb ff ff       	jmp    802367 <vprintfmt+0x11>
+  80279b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80279e:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027a1:	83 f9 01             	cmp    $0x1,%ecx
+  8027a4:	7f 1b                	jg     8027c1 <vprintfmt+0x46b>
+  8027a6:	85 c9                	test   %ecx,%ecx
+  8027a8:	74 2c                	je     8027d6 <vprintfmt+0x480>
+  8027aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027ad:	8b 10                	mov    (%eax),%edx
+  8027af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8027b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027ba:	be 10 00 00 00       	mov    $0x10,%esi
+  8027bf:	eb bb                	jmp    80277c <vprintfmt+0x426>
+  8027c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c4:	8b 10                	mov    (%eax),%edx
+  8027c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8027cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027cf:	be 10 00 00 00       	mov    $0x10,%esi
+  8027d4:	eb a6                	jmp    80277c <vprintfmt+0x426>
+  8027d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027d9:	8b 10                	mov    (%eax),%edx
+  8027db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8027e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027e6:	be 10 00 00 00       	mov    $0x10,%esi
+  8027eb:	eb 8f                	jmp    80277c <vprintfmt+0x426>
+  8027ed:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027f0:	83 ec 08             	sub    $0x8,%esp
+  8027f3:	53                   	push   %ebx
+  8027f4:	6a 25                	push   $0x25
+  8027f6:	ff d7                	call   *%edi
+  8027f8:	83 c4 10             	add    $0x10,%esp
+  8027fb:	e9 67 fb ff ff       	jmp    802367 <vprintfmt+0x11>
+  802800:	83 ec 08             	sub    $0x8,%esp
+  802803:	53                   	push   %ebx
+  802804:	6a 25                	push   $0x25
+  802806:	ff d7                	call   *%edi
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80280f:	0f 84 ba fb ff ff    	je     8023cf <vprintfmt+0x79>
+  802815:	89 75 10             	mov    %esi,0x10(%ebp)
+  802818:	89 f0                	mov    %esi,%eax
+  80281a:	83 e8 01             	sub    $0x1,%eax
+  80281d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802821:	75 f7                	jne    80281a <vprintfmt+0x4c4>
+  802823:	89 45 10             	mov    %eax,0x10(%ebp)
+  802826:	e9 3c fb ff ff       	jmp    802367 <vprintfmt+0x11>
+  80282b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80282e:	8d 70 01             	lea    0x1(%eax),%esi
+  802831:	0f b6 00             	movzbl (%eax),%eax
+  802834:	0f be d0             	movsbl %al,%edx
+  802837:	85 d2                	test   %edx,%edx
+  802839:	74 11                	je     80284c <vprintfmt+0x4f6>
+  80283b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80283e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802841:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802844:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802847:	e9 5d fd ff ff       	jmp    8025a9 <vprintfmt+0x253>
+  80284c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80284f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802852:	e9 10 fb ff ff       	jmp    802367 <vprintfmt+0x11>
+  802857:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80285a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80285d:	e9 05 fb ff ff       	jmp    802367 <vprintfmt+0x11>
+  802862:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802866:	7e 0a                	jle    802872 <vprintfmt+0x51c>
+  802868:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80286c:	0f 85 bd fc ff ff    	jne    80252f <vprintfmt+0x1d9>
+  802872:	ba 28 00 00 00       	mov    $0x28,%edx
+  802877:	b8 28 00 00 00       	mov    $0x28,%eax
+  80287c:	be 35 33 80 00       	mov    $0x803335,%esi
+  802881:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802884:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802887:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80288a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80288d:	e9 17 fd ff ff       	jmp    8025a9 <vprintfmt+0x253>
+  802892:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802895:	5b                   	pop    %ebx
+  802896:	5e                   	pop    %esi
+  802897:	5f                   	pop    %edi
+  802898:	5d                   	pop    %ebp
+  802899:	c3                   	ret
+
+0080289a <vsnprintf>:
+  80289a:	55                   	push   %ebp
+  80289b:	89 e5                	mov    %esp,%ebp
+  80289d:	83 ec 18             	sub    $0x18,%esp
+  8028a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8028a9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8028ad:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8028b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	74 26                	je     8028e1 <vsnprintf+0x47>
+  8028bb:	85 d2                	test   %edx,%edx
+  8028bd:	7e 22                	jle    8028e1 <vsnprintf+0x47>
+  8028bf:	ff 75 14             	push   0x14(%ebp)
+  8028c2:	ff 75 10             	push   0x10(%ebp)
+  8028c5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028c8:	50                   	push   %eax
+  8028c9:	68 1c 23 80 00       	push   $0x80231c
+  8028ce:	e8 83 fa ff ff       	call   802356 <vprintfmt>
+  8028d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028d6:	c6 00 00             	movb   $0x0,(%eax)
+  8028d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028dc:	83 c4 10             	add    $0x10,%esp
+  8028df:	c9                   	leave
+  8028e0:	c3                   	ret
+  8028e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028e6:	eb f7                	jmp    8028df <vsnprintf+0x45>
+
+008028e8 <snprintf>:
+  8028e8:	55                   	push   %ebp
+  8028e9:	89 e5                	mov    %esp,%ebp
+  8028eb:	83 ec 08             	sub    $0x8,%esp
+  8028ee:	8d 45 14             	lea    0x14(%ebp),%eax
+  8028f1:	50                   	push   %eax
+  8028f2:	ff 75 10             	push   0x10(%ebp)
+  8028f5:	ff 75 0c             	push   0xc(%ebp)
+  8028f8:	ff 75 08             	push   0x8(%ebp)
+  8028fb:	e8 9a ff ff ff       	call   80289a <vsnprintf>
+  802900:	c9                   	leave
+  802901:	c3                   	ret
+
+00802902 <strlen>:
+  802902:	55                   	push   %ebp
+  802903:	89 e5                	mov    %esp,%ebp
+  802905:	8b 55 08             	mov    0x8(%ebp),%edx
+  802908:	80 3a 00             	cmpb   $0x0,(%edx)
+  80290b:	74 10                	je     80291d <strlen+0x1b>
+  80290d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802912:	83 c0 01             	add    $0x1,%eax
+  802915:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802919:	75 f7                	jne    802912 <strlen+0x10>
+  80291b:	5d                   	pop    %ebp
+  80291c:	c3                   	ret
+  80291d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802922:	eb f7                	jmp    80291b <strlen+0x19>
+
+00802924 <strnlen>:
+  802924:	55                   	push   %ebp
+  802925:	89 e5                	mov    %esp,%ebp
+  802927:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80292a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80292d:	85 d2                	test   %edx,%edx
+  80292f:	74 16                	je     802947 <strnlen+0x23>
+  802931:	b8 00 00 00 00       	mov    $0x0,%eax
+  802936:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80293a:	74 09                	je     802945 <strnlen+0x21>
+  80293c:	83 c0 01             	add    $0x1,%eax
+  80293f:	39 d0                	cmp    %edx,%eax
+  802941:	75 f3                	jne    802936 <strnlen+0x12>
+  802943:	89 d0                	mov    %edx,%eax
+  802945:	5d                   	pop    %ebp
+  802946:	c3                   	ret
+  802947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294c:	eb f7                	jmp    802945 <strnlen+0x21>
+
+0080294e <strcpy>:
+  80294e:	55                   	push   %ebp
+  80294f:	89 e5                	mov    %esp,%ebp
+  802951:	53                   	push   %ebx
+  802952:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802955:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802961:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802964:	83 c0 01             	add    $0x1,%eax
+  802967:	84 d2                	test   %dl,%dl
+  802969:	75 f2                	jne    80295d <strcpy+0xf>
+  80296b:	89 c8                	mov    %ecx,%eax
+  80296d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+
+00802972 <strcat>:
+  802972:	55                   	push   %ebp
+  802973:	89 e5                	mov    %esp,%ebp
+  802975:	53                   	push   %ebx
+  802976:	83 ec 10             	sub    $0x10,%esp
+  802979:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80297c:	53                   	push   %ebx
+  80297d:	e8 80 ff ff ff       	call   802902 <strlen>
+  802982:	83 c4 08             	add    $0x8,%esp
+  802985:	ff 75 0c             	push   0xc(%ebp)
+  802988:	01 d8                	add    %ebx,%eax
+  80298a:	50                   	push   %eax
+  80298b:	e8 be ff ff ff       	call   80294e <strcpy>
+  802990:	89 d8                	mov    %ebx,%eax
+  802992:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+
+00802997 <strncpy>:
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	56                   	push   %esi
+  80299b:	53                   	push   %ebx
+  80299c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80299f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029a5:	85 db                	test   %ebx,%ebx
+  8029a7:	74 17                	je     8029c0 <strncpy+0x29>
+  8029a9:	01 f3                	add    %esi,%ebx
+  8029ab:	89 f0                	mov    %esi,%eax
+  8029ad:	83 c0 01             	add    $0x1,%eax
+  8029b0:	0f b6 0a             	movzbl (%edx),%ecx
+  8029b3:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029b6:	80 f9 01             	cmp    $0x1,%cl
+  8029b9:	83 da ff             	sbb    $0xffffffff,%edx
+  8029bc:	39 c3                	cmp    %eax,%ebx
+  8029be:	75 ed                	jne    8029ad <strncpy+0x16>
+  8029c0:	89 f0                	mov    %esi,%eax
+  8029c2:	5b                   	pop    %ebx
+  8029c3:	5e                   	pop    %esi
+  8029c4:	5d                   	pop    %ebp
+  8029c5:	c3                   	ret
+
+008029c6 <strlcpy>:
+  8029c6:	55                   	push   %ebp
+  8029c7:	89 e5                	mov    %esp,%ebp
+  8029c9:	56                   	push   %esi
+  8029ca:	53                   	push   %ebx
+  8029cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029d4:	89 f0                	mov    %esi,%eax
+  8029d6:	85 db                	test   %ebx,%ebx
+  8029d8:	74 1e                	je     8029f8 <strlcpy+0x32>
+  8029da:	83 eb 01             	sub    $0x1,%ebx
+  8029dd:	74 16                	je     8029f5 <strlcpy+0x2f>
+  8029df:	01 f3                	add    %esi,%ebx
+  8029e1:	0f b6 0a             	movzbl (%edx),%ecx
+  8029e4:	84 c9                	test   %cl,%cl
+  8029e6:	74 0d                	je     8029f5 <strlcpy+0x2f>
+  8029e8:	83 c2 01             	add    $0x1,%edx
+  8029eb:	83 c0 01             	add    $0x1,%eax
+  8029ee:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029f1:	39 d8                	cmp    %ebx,%eax
+  8029f3:	75 ec                	jne    8029e1 <strlcpy+0x1b>
+  8029f5:	c6 00 00             	movb   $0x0,(%eax)
+  8029f8:	29 f0                	sub    %esi,%eax
+  8029fa:	5b                   	pop    %ebx
+  8029fb:	5e                   	pop    %esi
+  8029fc:	5d                   	pop    %ebp
+  8029fd:	c3                   	ret
+
+008029fe <strcmp>:
+  8029fe:	55                   	push   %ebp
+  8029ff:	89 e5                	mov    %esp,%ebp
+  802a01:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a07:	0f b6 01             	movzbl (%ecx),%eax
+  802a0a:	84 c0                	test   %al,%al
+  802a0c:	74 11                	je     802a1f <strcmp+0x21>
+  802a0e:	38 02                	cmp    %al,(%edx)
+  802a10:	75 0d                	jne    802a1f <strcmp+0x21>
+  802a12:	83 c1 01             	add    $0x1,%ecx
+  802a15:	83 c2 01             	add    $0x1,%edx
+  802a18:	0f b6 01             	movzbl (%ecx),%eax
+  802a1b:	84 c0                	test   %al,%al
+  802a1d:	75 ef                	jne    802a0e <strcmp+0x10>
+  802a1f:	0f b6 c0             	movzbl %al,%eax
+  802a22:	0f b6 12             	movzbl (%edx),%edx
+  802a25:	29 d0                	sub    %edx,%eax
+  802a27:	5d                   	pop    %ebp
+  802a28:	c3                   	ret
+
+00802a29 <strncmp>:
+  802a29:	55                   	push   %ebp
+  802a2a:	89 e5                	mov    %esp,%ebp
+  802a2c:	53                   	push   %ebx
+  802a2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a33:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3b:	85 d2                	test   %edx,%edx
+  802a3d:	74 2e                	je     802a6d <strncmp+0x44>
+  802a3f:	0f b6 01             	movzbl (%ecx),%eax
+  802a42:	84 c0                	test   %al,%al
+  802a44:	74 16                	je     802a5c <strncmp+0x33>
+  802a46:	3a 03                	cmp    (%ebx),%al
+  802a48:	75 12                	jne    802a5c <strncmp+0x33>
+  802a4a:	83 c1 01             	add    $0x1,%ecx
+  802a4d:	83 c3 01             	add    $0x1,%ebx
+  802a50:	83 ea 01             	sub    $0x1,%edx
+  802a53:	75 ea                	jne    802a3f <strncmp+0x16>
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5a:	eb 11                	jmp    802a6d <strncmp+0x44>
+  802a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a61:	85 d2                	test   %edx,%edx
+  802a63:	74 08                	je     802a6d <strncmp+0x44>
+  802a65:	0f b6 01             	movzbl (%ecx),%eax
+  802a68:	0f b6 13             	movzbl (%ebx),%edx
+  802a6b:	29 d0                	sub    %edx,%eax
+  802a6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a70:	c9                   	leave
+  802a71:	c3                   	ret
+
+00802a72 <strchr>:
+  802a72:	55                   	push   %ebp
+  802a73:	89 e5                	mov    %esp,%ebp
+  802a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a78:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a7c:	0f b6 10             	movzbl (%eax),%edx
+  802a7f:	84 d2                	test   %dl,%dl
+  802a81:	74 15                	je     802a98 <strchr+0x26>
+  802a83:	38 d1                	cmp    %dl,%cl
+  802a85:	74 0f                	je     802a96 <strchr+0x24>
+  802a87:	83 c0 01             	add    $0x1,%eax
+  802a8a:	0f b6 10             	movzbl (%eax),%edx
+  802a8d:	84 d2                	test   %dl,%dl
+  802a8f:	75 f2                	jne    802a83 <strchr+0x11>
+  802a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a96:	5d                   	pop    %ebp
+  802a97:	c3                   	ret
+  802a98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9d:	eb f7                	jmp    802a96 <strchr+0x24>
+
+00802a9f <strfind>:
+  802a9f:	55                   	push   %ebp
+  802aa0:	89 e5                	mov    %esp,%ebp
+  802aa2:	53                   	push   %ebx
+  802aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aa9:	0f b6 18             	movzbl (%eax),%ebx
+  802aac:	38 d3                	cmp    %dl,%bl
+  802aae:	74 14                	je     802ac4 <strfind+0x25>
+  802ab0:	89 d1                	mov    %edx,%ecx
+  802ab2:	84 db                	test   %bl,%bl
+  802ab4:	74 0e                	je     802ac4 <strfind+0x25>
+  802ab6:	83 c0 01             	add    $0x1,%eax
+  802ab9:	0f b6 10             	movzbl (%eax),%edx
+  802abc:	38 ca                	cmp    %cl,%dl
+  802abe:	74 04                	je     802ac4 <strfind+0x25>
+  802ac0:	84 d2                	test   %dl,%dl
+  802ac2:	75 f2                	jne    802ab6 <strfind+0x17>
+  802ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac7:	c9                   	leave
+  802ac8:	c3                   	ret
+
+00802ac9 <memset>:
+  802ac9:	55                   	push   %ebp
+  802aca:	89 e5                	mov    %esp,%ebp
+  802acc:	57                   	push   %edi
+  802acd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ad0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802ad3:	85 c9                	test   %ecx,%ecx
+  802ad5:	74 20                	je     802af7 <memset+0x2e>
+  802ad7:	89 f8                	mov    %edi,%eax
+  802ad9:	09 c8                	or     %ecx,%eax
+  802adb:	a8 03                	test   $0x3,%al
+  802add:	75 12                	jne    802af1 <memset+0x28>
+  802adf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802ae3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802ae9:	c1 e9 02             	shr    $0x2,%ecx
+  802aec:	fc                   	cld
+  802aed:	f3 ab                	rep stos %eax,%es:(%edi)
+  802aef:	eb 06                	jmp    802af7 <memset+0x2e>
+  802af1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af4:	fc                   	cld
+  802af5:	f3 aa                	rep stos %al,%es:(%edi)
+  802af7:	89 f8                	mov    %edi,%eax
+  802af9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802afc:	c9                   	leave
+  802afd:	c3                   	ret
+
+00802afe <memmove>:
+  802afe:	55                   	push   %ebp
+  802aff:	89 e5                	mov    %esp,%ebp
+  802b01:	57                   	push   %edi
+  802b02:	56                   	push   %esi
+  802b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b06:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b09:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802b0c:	39 c6                	cmp    %eax,%esi
+  802b0e:	73 32                	jae    802b42 <memmove+0x44>
+  802b10:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802b13:	39 d0                	cmp    %edx,%eax
+  802b15:	73 2b                	jae    802b42 <memmove+0x44>
+  802b17:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b1a:	89 d6                	mov    %edx,%esi
+  802b1c:	09 fe                	or     %edi,%esi
+  802b1e:	09 ce                	or     %ecx,%esi
+  802b20:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b26:	75 0e                	jne    802b36 <memmove+0x38>
+  802b28:	83 ef 04             	sub    $0x4,%edi
+  802b2b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b2e:	c1 e9 02             	shr    $0x2,%ecx
+  802b31:	fd                   	std
+  802b32:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b34:	eb 09                	jmp    802b3f <memmove+0x41>
+  802b36:	83 ef 01             	sub    $0x1,%edi
+  802b39:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b3c:	fd                   	std
+  802b3d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b3f:	fc                   	cld
+  802b40:	eb 1a                	jmp    802b5c <memmove+0x5e>
+  802b42:	89 f2                	mov    %esi,%edx
+  802b44:	09 c2                	or     %eax,%edx
+  802b46:	09 ca                	or     %ecx,%edx
+  802b48:	f6 c2 03             	test   $0x3,%dl
+  802b4b:	75 0a                	jne    802b57 <memmove+0x59>
+  802b4d:	c1 e9 02             	shr    $0x2,%ecx
+  802b50:	89 c7                	mov    %eax,%edi
+  802b52:	fc                   	cld
+  802b53:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b55:	eb 05                	jmp    802b5c <memmove+0x5e>
+  802b57:	89 c7                	mov    %eax,%edi
+  802b59:	fc                   	cld
+  802b5a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b5c:	5e                   	pop    %esi
+  802b5d:	5f                   	pop    %edi
+  802b5e:	5d                   	pop    %ebp
+  802b5f:	c3                   	ret
+
+00802b60 <memcpy>:
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	83 ec 0c             	sub    $0xc,%esp
+  802b66:	ff 75 10             	push   0x10(%ebp)
+  802b69:	ff 75 0c             	push   0xc(%ebp)
+  802b6c:	ff 75 08             	push   0x8(%ebp)
+  802b6f:	e8 8a ff ff ff       	call   802afe <memmove>
+  802b74:	c9                   	leave
+  802b75:	c3                   	ret
+
+00802b76 <memcmp>:
+  802b76:	55                   	push   %ebp
+  802b77:	89 e5                	mov    %esp,%ebp
+  802b79:	56                   	push   %esi
+  802b7a:	53                   	push   %ebx
+  802b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b81:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b84:	85 f6                	test   %esi,%esi
+  802b86:	74 29                	je     802bb1 <memcmp+0x3b>
+  802b88:	01 c6                	add    %eax,%esi
+  802b8a:	0f b6 08             	movzbl (%eax),%ecx
+  802b8d:	0f b6 1a             	movzbl (%edx),%ebx
+  802b90:	38 d9                	cmp    %bl,%cl
+  802b92:	75 11                	jne    802ba5 <memcmp+0x2f>
+  802b94:	83 c0 01             	add    $0x1,%eax
+  802b97:	83 c2 01             	add    $0x1,%edx
+  802b9a:	39 c6                	cmp    %eax,%esi
+  802b9c:	75 ec                	jne    802b8a <memcmp+0x14>
+  802b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba3:	eb 08                	jmp    802bad <memcmp+0x37>
+  802ba5:	0f b6 c1             	movzbl %cl,%eax
+  802ba8:	0f b6 db             	movzbl %bl,%ebx
+  802bab:	29 d8                	sub    %ebx,%eax
+  802bad:	5b                   	pop    %ebx
+  802bae:	5e                   	pop    %esi
+  802baf:	5d                   	pop    %ebp
+  802bb0:	c3                   	ret
+  802bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb6:	eb f5                	jmp    802bad <memcmp+0x37>
+
+00802bb8 <memfind>:
+  802bb8:	55                   	push   %ebp
+  802bb9:	89 e5                	mov    %esp,%ebp
+  802bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bc1:	89 c2                	mov    %eax,%edx
+  802bc3:	03 55 10             	add    0x10(%ebp),%edx
+  802bc6:	39 d0                	cmp    %edx,%eax
+  802bc8:	73 0d                	jae    802bd7 <memfind+0x1f>
+  802bca:	38 08                	cmp    %cl,(%eax)
+  802bcc:	74 0d                	je     802bdb <memfind+0x23>
+  802bce:	83 c0 01             	add    $0x1,%eax
+  802bd1:	39 c2                	cmp    %eax,%edx
+  802bd3:	75 f5                	jne    802bca <memfind+0x12>
+  802bd5:	eb 06                	jmp    802bdd <memfind+0x25>
+  802bd7:	89 c2                	mov    %eax,%edx
+  802bd9:	eb 02                	jmp    802bdd <memfind+0x25>
+  802bdb:	89 c2                	mov    %eax,%edx
+  802bdd:	89 d0                	mov    %edx,%eax
+  802bdf:	5d                   	pop    %ebp
+  802be0:	c3                   	ret
+
+00802be1 <strtol>:
+  802be1:	55                   	push   %ebp
+  802be2:	89 e5                	mov    %esp,%ebp
+  802be4:	57                   	push   %edi
+  802be5:	56                   	push   %esi
+  802be6:	53                   	push   %ebx
+  802be7:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bed:	0f b6 02             	movzbl (%edx),%eax
+  802bf0:	3c 20                	cmp    $0x20,%al
+  802bf2:	74 04                	je     802bf8 <strtol+0x17>
+  802bf4:	3c 09                	cmp    $0x9,%al
+  802bf6:	75 0e                	jne    802c06 <strtol+0x25>
+  802bf8:	83 c2 01             	add    $0x1,%edx
+  802bfb:	0f b6 02             	movzbl (%edx),%eax
+  802bfe:	3c 20                	cmp    $0x20,%al
+  802c00:	74 f6                	je     802bf8 <strtol+0x17>
+  802c02:	3c 09                	cmp    $0x9,%al
+  802c04:	74 f2                	je     802bf8 <strtol+0x17>
+  802c06:	3c 2b                	cmp    $0x2b,%al
+  802c08:	74 2a                	je     802c34 <strtol+0x53>
+  802c0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0f:	3c 2d                	cmp    $0x2d,%al
+  802c11:	74 2b                	je     802c3e <strtol+0x5d>
+  802c13:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c19:	75 0f                	jne    802c2a <strtol+0x49>
+  802c1b:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c1e:	74 28                	je     802c48 <strtol+0x67>
+  802c20:	85 db                	test   %ebx,%ebx
+  802c22:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c27:	0f 44 d8             	cmove  %eax,%ebx
+  802c2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c2f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c32:	eb 46                	jmp    802c7a <strtol+0x99>
+  802c34:	83 c2 01             	add    $0x1,%edx
+  802c37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c3c:	eb d5                	jmp    802c13 <strtol+0x32>
+  802c3e:	83 c2 01             	add    $0x1,%edx
+  802c41:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c46:	eb cb                	jmp    802c13 <strtol+0x32>
+  802c48:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c4c:	74 0e                	je     802c5c <strtol+0x7b>
+  802c4e:	85 db                	test   %ebx,%ebx
+  802c50:	75 d8                	jne    802c2a <strtol+0x49>
+  802c52:	83 c2 01             	add    $0x1,%edx
+  802c55:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c5a:	eb ce                	jmp    802c2a <strtol+0x49>
+  802c5c:	83 c2 02             	add    $0x2,%edx
+  802c5f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c64:	eb c4                	jmp    802c2a <strtol+0x49>
+  802c66:	0f be c0             	movsbl %al,%eax
+  802c69:	83 e8 30             	sub    $0x30,%eax
+  802c6c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c6f:	7d 3a                	jge    802cab <strtol+0xca>
+  802c71:	83 c2 01             	add    $0x1,%edx
+  802c74:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c78:	01 c1                	add    %eax,%ecx
+  802c7a:	0f b6 02             	movzbl (%edx),%eax
+  802c7d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c80:	89 f3                	mov    %esi,%ebx
+  802c82:	80 fb 09             	cmp    $0x9,%bl
+  802c85:	76 df                	jbe    802c66 <strtol+0x85>
+  802c87:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802c8a:	89 f3                	mov    %esi,%ebx
+  802c8c:	80 fb 19             	cmp    $0x19,%bl
+  802c8f:	77 08                	ja     802c99 <strtol+0xb8>
+  802c91:	0f be c0             	movsbl %al,%eax
+  802c94:	83 e8 57             	sub    $0x57,%eax
+  802c97:	eb d3                	jmp    802c6c <strtol+0x8b>
+  802c99:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802c9c:	89 f3                	mov    %esi,%ebx
+  802c9e:	80 fb 19             	cmp    $0x19,%bl
+  802ca1:	77 08                	ja     802cab <strtol+0xca>
+  802ca3:	0f be c0             	movsbl %al,%eax
+  802ca6:	83 e8 37             	sub    $0x37,%eax
+  802ca9:	eb c1                	jmp    802c6c <strtol+0x8b>
+  802cab:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802caf:	74 05                	je     802cb6 <strtol+0xd5>
+  802cb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb4:	89 10                	mov    %edx,(%eax)
+  802cb6:	89 c8                	mov    %ecx,%eax
+  802cb8:	f7 d8                	neg    %eax
+  802cba:	85 ff                	test   %edi,%edi
+  802cbc:	0f 45 c8             	cmovne %eax,%ecx
+  802cbf:	89 c8                	mov    %ecx,%eax
+  802cc1:	5b                   	pop    %ebx
+  802cc2:	5e                   	pop    %esi
+  802cc3:	5f                   	pop    %edi
+  802cc4:	5d                   	pop    %ebp
+  802cc5:	c3                   	ret
+
+00802cc6 <ipc_recv>:
+  802cc6:	55                   	push   %ebp
+  802cc7:	89 e5                	mov    %esp,%ebp
+  802cc9:	56                   	push   %esi
+  802cca:	53                   	push   %ebx
+  802ccb:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cd4:	85 c0                	test   %eax,%eax
+  802cd6:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cdb:	0f 44 c2             	cmove  %edx,%eax
+  802cde:	83 ec 0c             	sub    $0xc,%esp
+  802ce1:	50                   	push   %eax
+  802ce2:	e8 73 d7 ff ff       	call   80045a <sys_ipc_recv>
+  802ce7:	83 c4 10             	add    $0x10,%esp
+  802cea:	85 c0                	test   %eax,%eax
+  802cec:	78 2a                	js     802d18 <ipc_recv+0x52>
+  802cee:	a1 10 50 80 00       	mov    0x805010,%eax
+  802cf3:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802cf9:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802cff:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d05:	85 f6                	test   %esi,%esi
+  802d07:	74 02                	je     802d0b <ipc_recv+0x45>
+  802d09:	89 0e                	mov    %ecx,(%esi)
+  802d0b:	85 db                	test   %ebx,%ebx
+  802d0d:	74 02                	je     802d11 <ipc_recv+0x4b>
+  802d0f:	89 13                	mov    %edx,(%ebx)
+  802d11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d14:	5b                   	pop    %ebx
+  802d15:	5e                   	pop    %esi
+  802d16:	5d                   	pop    %ebp
+  802d17:	c3                   	ret
+  802d18:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d22:	eb e1                	jmp    802d05 <ipc_recv+0x3f>
+
+00802d24 <ipc_send>:
+  802d24:	55                   	push   %ebp
+  802d25:	89 e5                	mov    %esp,%ebp
+  802d27:	57                   	push   %edi
+  802d28:	56                   	push   %esi
+  802d29:	53                   	push   %ebx
+  802d2a:	83 ec 0c             	sub    $0xc,%esp
+  802d2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d33:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d36:	85 db                	test   %ebx,%ebx
+  802d38:	74 1e                	je     802d58 <ipc_send+0x34>
+  802d3a:	56                   	push   %esi
+  802d3b:	53                   	push   %ebx
+  802d3c:	57                   	push   %edi
+  802d3d:	ff 75 08             	push   0x8(%ebp)
+  802d40:	e8 a2 d7 ff ff       	call   8004e7 <sys_ipc_send>
+  802d45:	83 c4 10             	add    $0x10,%esp
+  802d48:	85 c0                	test   %eax,%eax
+  802d4a:	74 2a                	je     802d76 <ipc_send+0x52>
+  802d4c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d4f:	75 13                	jne    802d64 <ipc_send+0x40>
+  802d51:	e8 0e d4 ff ff       	call   800164 <sys_yield>
+  802d56:	eb e2                	jmp    802d3a <ipc_send+0x16>
+  802d58:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5d:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d62:	eb d6                	jmp    802d3a <ipc_send+0x16>
+  802d64:	50                   	push   %eax
+  802d65:	68 2c 36 80 00       	push   $0x80362c
+  802d6a:	6a 4f                	push   $0x4f
+  802d6c:	68 6f 36 80 00       	push   $0x80366f
+  802d71:	e8 06 f4 ff ff       	call   80217c <_panic>
+  802d76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d79:	5b                   	pop    %ebx
+  802d7a:	5e                   	pop    %esi
+  802d7b:	5f                   	pop    %edi
+  802d7c:	5d                   	pop    %ebp
+  802d7d:	c3                   	ret
+
+00802d7e <ipc_call>:
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	57                   	push   %edi
+  802d82:	56                   	push   %esi
+  802d83:	53                   	push   %ebx
+  802d84:	83 ec 0c             	sub    $0xc,%esp
+  802d87:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d8b:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d90:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d94:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d98:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d9d:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802da1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802daa:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802dae:	eb 05                	jmp    802db5 <ipc_call+0x37>
+  802db0:	e8 af d3 ff ff       	call   800164 <sys_yield>
+  802db5:	83 ec 0c             	sub    $0xc,%esp
+  802db8:	56                   	push   %esi
+  802db9:	53                   	push   %ebx
+  802dba:	57                   	push   %edi
+  802dbb:	ff 75 0c             	push   0xc(%ebp)
+  802dbe:	ff 75 08             	push   0x8(%ebp)
+  802dc1:	e8 71 d7 ff ff       	call   800537 <sys_ipc_call>
+  802dc6:	83 c4 20             	add    $0x20,%esp
+  802dc9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dcc:	74 e2                	je     802db0 <ipc_call+0x32>
+  802dce:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802dd1:	74 2d                	je     802e00 <ipc_call+0x82>
+  802dd3:	85 c0                	test   %eax,%eax
+  802dd5:	78 4f                	js     802e26 <ipc_call+0xa8>
+  802dd7:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802ddb:	74 10                	je     802ded <ipc_call+0x6f>
+  802ddd:	a1 10 50 80 00       	mov    0x805010,%eax
+  802de2:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802de8:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802deb:	89 02                	mov    %eax,(%edx)
+  802ded:	a1 10 50 80 00       	mov    0x805010,%eax
+  802df2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802df8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dfb:	5b                   	pop    %ebx
+  802dfc:	5e                   	pop    %esi
+  802dfd:	5f                   	pop    %edi
+  802dfe:	5d                   	pop    %ebp
+  802dff:	c3                   	ret
+  802e00:	ff 75 14             	push   0x14(%ebp)
+  802e03:	ff 75 10             	push   0x10(%ebp)
+  802e06:	ff 75 0c             	push   0xc(%ebp)
+  802e09:	ff 75 08             	push   0x8(%ebp)
+  802e0c:	e8 13 ff ff ff       	call   802d24 <ipc_send>
+  802e11:	83 c4 0c             	add    $0xc,%esp
+  802e14:	ff 75 1c             	push   0x1c(%ebp)
+  802e17:	ff 75 18             	push   0x18(%ebp)
+  802e1a:	6a 00                	push   $0x0
+  802e1c:	e8 a5 fe ff ff       	call   802cc6 <ipc_recv>
+  802e21:	83 c4 10             	add    $0x10,%esp
+  802e24:	eb d2                	jmp    802df8 <ipc_call+0x7a>
+  802e26:	50                   	push   %eax
+  802e27:	68 79 36 80 00       	push   $0x803679
+  802e2c:	6a 6d                	push   $0x6d
+  802e2e:	68 6f 36 80 00       	push   $0x80366f
+  802e33:	e8 44 f3 ff ff       	call   80217c <_panic>
+
+00802e38 <ipc_reply_recv>:
+  802e38:	55                   	push   %ebp
+  802e39:	89 e5                	mov    %esp,%ebp
+  802e3b:	57                   	push   %edi
+  802e3c:	56                   	push   %esi
+  802e3d:	53                   	push   %ebx
+  802e3e:	83 ec 0c             	sub    $0xc,%esp
+  802e41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e44:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e47:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e4a:	85 db                	test   %ebx,%ebx
+  802e4c:	0f 84 ac 00 00 00    	je     802efe <ipc_reply_recv+0xc6>
+  802e52:	85 f6                	test   %esi,%esi
+  802e54:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e59:	0f 45 c6             	cmovne %esi,%eax
+  802e5c:	83 ec 0c             	sub    $0xc,%esp
+  802e5f:	50                   	push   %eax
+  802e60:	ff 75 14             	push   0x14(%ebp)
+  802e63:	53                   	push   %ebx
+  802e64:	ff 75 0c             	push   0xc(%ebp)
+  802e67:	ff 75 08             	push   0x8(%ebp)
+  802e6a:	e8 e9 d6 ff ff       	call   800558 <sys_ipc_reply_recv>
+  802e6f:	83 c4 20             	add    $0x20,%esp
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	78 3a                	js     802eb0 <ipc_reply_recv+0x78>
+  802e76:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e7a:	74 10                	je     802e8c <ipc_reply_recv+0x54>
+  802e7c:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e81:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e87:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e8a:	89 02                	mov    %eax,(%edx)
+  802e8c:	85 ff                	test   %edi,%edi
+  802e8e:	74 0d                	je     802e9d <ipc_reply_recv+0x65>
+  802e90:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e95:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e9b:	89 07                	mov    %eax,(%edi)
+  802e9d:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ea2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eab:	5b                   	pop    %ebx
+  802eac:	5e                   	pop    %esi
+  802ead:	5f                   	pop    %edi
+  802eae:	5d                   	pop    %ebp
+  802eaf:	c3                   	ret
+  802eb0:	ff 75 14             	push   0x14(%ebp)
+  802eb3:	53                   	push   %ebx
+  802eb4:	ff 75 0c             	push   0xc(%ebp)
+  802eb7:	ff 75 08             	push   0x8(%ebp)
+  802eba:	e8 4b d5 ff ff       	call   80040a <sys_ipc_try_send>
+  802ebf:	89 c2                	mov    %eax,%edx
+  802ec1:	c1 ea 1f             	shr    $0x1f,%edx
+  802ec4:	83 c4 10             	add    $0x10,%esp
+  802ec7:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802eca:	0f 95 c1             	setne  %cl
+  802ecd:	84 d1                	test   %dl,%cl
+  802ecf:	74 05                	je     802ed6 <ipc_reply_recv+0x9e>
+  802ed1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ed4:	75 12                	jne    802ee8 <ipc_reply_recv+0xb0>
+  802ed6:	83 ec 04             	sub    $0x4,%esp
+  802ed9:	57                   	push   %edi
+  802eda:	56                   	push   %esi
+  802edb:	ff 75 18             	push   0x18(%ebp)
+  802ede:	e8 e3 fd ff ff       	call   802cc6 <ipc_recv>
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	eb c0                	jmp    802ea8 <ipc_reply_recv+0x70>
+  802ee8:	83 ec 04             	sub    $0x4,%esp
+  802eeb:	50                   	push   %eax
+  802eec:	ff 75 08             	push   0x8(%ebp)
+  802eef:	68 4c 36 80 00       	push   $0x80364c
+  802ef4:	e8 5e f3 ff ff       	call   802257 <cprintf>
+  802ef9:	83 c4 10             	add    $0x10,%esp
+  802efc:	eb d8                	jmp    802ed6 <ipc_reply_recv+0x9e>
+  802efe:	85 f6                	test   %esi,%esi
+  802f00:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f05:	0f 45 c6             	cmovne %esi,%eax
+  802f08:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f0d:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f14:	e9 43 ff ff ff       	jmp    802e5c <ipc_reply_recv+0x24>
+
+00802f19 <ipc_find_env>:
+  802f19:	55                   	push   %ebp
+  802f1a:	89 e5                	mov    %esp,%ebp
+  802f1c:	83 ec 14             	sub    $0x14,%esp
+  802f1f:	ff 75 08             	push   0x8(%ebp)
+  802f22:	e8 81 d4 ff ff       	call   8003a8 <sys_env_service>
+  802f27:	85 c0                	test   %eax,%eax
+  802f29:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f2e:	0f 48 c2             	cmovs  %edx,%eax
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+
+00802f33 <pageref>:
+  802f33:	55                   	push   %ebp
+  802f34:	89 e5                	mov    %esp,%ebp
+  802f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f39:	89 c2                	mov    %eax,%edx
+  802f3b:	c1 ea 16             	shr    $0x16,%edx
+  802f3e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4a:	f6 c1 01             	test   $0x1,%cl
+  802f4d:	74 22                	je     802f71 <pageref+0x3e>
+  802f4f:	c1 e8 0c             	shr    $0xc,%eax
+  802f52:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f59:	a8 01                	test   $0x1,%al
+  802f5b:	74 14                	je     802f71 <pageref+0x3e>
+  802f5d:	c1 e8 0c             	shr    $0xc,%eax
+  802f60:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f63:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f6a:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f6e:	0f b7 d2             	movzwl %dx,%edx
+  802f71:	89 d0                	mov    %edx,%eax
+  802f73:	5d                   	pop    %ebp
+  802f74:	c3                   	ret
+
+00802f75 <__udivmoddi4>:
+  802f75:	55                   	push   %ebp
+  802f76:	57                   	push   %edi
+  802f77:	56                   	push   %esi
+  802f78:	53                   	push   %ebx
+  802f79:	83 ec 24             	sub    $0x24,%esp
+  802f7c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f80:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f84:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f88:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f8c:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f90:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f94:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f98:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f9c:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802faa:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802faf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fb6:	00 
+  802fb7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fbe:	00 
+  802fbf:	89 fb                	mov    %edi,%ebx
+  802fc1:	eb 08                	jmp    802fcb <__udivmoddi4+0x56>
+  802fc3:	83 e9 01             	sub    $0x1,%ecx
+  802fc6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fc9:	74 68                	je     803033 <__udivmoddi4+0xbe>
+  802fcb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fcf:	01 c0                	add    %eax,%eax
+  802fd1:	89 c6                	mov    %eax,%esi
+  802fd3:	89 d7                	mov    %edx,%edi
+  802fd5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fd9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fdd:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fe0:	d3 ea                	shr    %cl,%edx
+  802fe2:	f6 c1 20             	test   $0x20,%cl
+  802fe5:	74 04                	je     802feb <__udivmoddi4+0x76>
+  802fe7:	89 d0                	mov    %edx,%eax
+  802fe9:	31 d2                	xor    %edx,%edx
+  802feb:	83 e0 01             	and    $0x1,%eax
+  802fee:	89 04 24             	mov    %eax,(%esp)
+  802ff1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ff8:	00 
+  802ff9:	8b 04 24             	mov    (%esp),%eax
+  802ffc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803000:	09 f0                	or     %esi,%eax
+  803002:	09 fa                	or     %edi,%edx
+  803004:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803008:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80300c:	39 f0                	cmp    %esi,%eax
+  80300e:	89 d5                	mov    %edx,%ebp
+  803010:	19 fd                	sbb    %edi,%ebp
+  803012:	72 af                	jb     802fc3 <__udivmoddi4+0x4e>
+  803014:	29 f0                	sub    %esi,%eax
+  803016:	19 fa                	sbb    %edi,%edx
+  803018:	89 cf                	mov    %ecx,%edi
+  80301a:	c1 ef 05             	shr    $0x5,%edi
+  80301d:	83 e7 01             	and    $0x1,%edi
+  803020:	89 fe                	mov    %edi,%esi
+  803022:	83 f6 01             	xor    $0x1,%esi
+  803025:	d3 e6                	shl    %cl,%esi
+  803027:	d3 e7                	shl    %cl,%edi
+  803029:	09 74 24 18          	or     %esi,0x18(%esp)
+  80302d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803031:	eb 90                	jmp    802fc3 <__udivmoddi4+0x4e>
+  803033:	85 db                	test   %ebx,%ebx
+  803035:	74 05                	je     80303c <__udivmoddi4+0xc7>
+  803037:	89 03                	mov    %eax,(%ebx)
+  803039:	89 53 04             	mov    %edx,0x4(%ebx)
+  80303c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803040:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803044:	83 c4 24             	add    $0x24,%esp
+  803047:	5b                   	pop    %ebx
+  803048:	5e                   	pop    %esi
+  803049:	5f                   	pop    %edi
+  80304a:	5d                   	pop    %ebp
+  80304b:	c3                   	ret
+
+0080304c <__udivdi3>:
+  80304c:	83 ec 08             	sub    $0x8,%esp
+  80304f:	6a 00                	push   $0x0
+  803051:	ff 74 24 1c          	push   0x1c(%esp)
+  803055:	ff 74 24 1c          	push   0x1c(%esp)
+  803059:	ff 74 24 1c          	push   0x1c(%esp)
+  80305d:	ff 74 24 1c          	push   0x1c(%esp)
+  803061:	e8 0f ff ff ff       	call   802f75 <__udivmoddi4>
+  803066:	83 c4 1c             	add    $0x1c,%esp
+  803069:	c3                   	ret
+
+0080306a <__umoddi3>:
+  80306a:	83 ec 18             	sub    $0x18,%esp
+  80306d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803071:	50                   	push   %eax
+  803072:	ff 74 24 2c          	push   0x2c(%esp)
+  803076:	ff 74 24 2c          	push   0x2c(%esp)
+  80307a:	ff 74 24 2c          	push   0x2c(%esp)
+  80307e:	ff 74 24 2c          	push   0x2c(%esp)
+  803082:	e8 ee fe ff ff       	call   802f75 <__udivmoddi4>
+  803087:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80308b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80308f:	83 c4 2c             	add    $0x2c,%esp
+  803092:	c3                   	ret
+
+00803093 <__divdi3>:
+  803093:	53                   	push   %ebx
+  803094:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803098:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80309c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8030a0:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030a4:	85 d2                	test   %edx,%edx
+  8030a6:	78 12                	js     8030ba <__divdi3+0x27>
+  8030a8:	85 db                	test   %ebx,%ebx
+  8030aa:	78 2e                	js     8030da <__divdi3+0x47>
+  8030ac:	53                   	push   %ebx
+  8030ad:	51                   	push   %ecx
+  8030ae:	52                   	push   %edx
+  8030af:	50                   	push   %eax
+  8030b0:	e8 97 ff ff ff       	call   80304c <__udivdi3>
+  8030b5:	83 c4 10             	add    $0x10,%esp
+  8030b8:	eb 1e                	jmp    8030d8 <__divdi3+0x45>
+  8030ba:	f7 d8                	neg    %eax
+  8030bc:	83 d2 00             	adc    $0x0,%edx
+  8030bf:	f7 da                	neg    %edx
+  8030c1:	85 db                	test   %ebx,%ebx
+  8030c3:	78 2a                	js     8030ef <__divdi3+0x5c>
+  8030c5:	53                   	push   %ebx
+  8030c6:	51                   	push   %ecx
+  8030c7:	52                   	push   %edx
+  8030c8:	50                   	push   %eax
+  8030c9:	e8 7e ff ff ff       	call   80304c <__udivdi3>
+  8030ce:	83 c4 10             	add    $0x10,%esp
+  8030d1:	f7 d8                	neg    %eax
+  8030d3:	83 d2 00             	adc    $0x0,%edx
+  8030d6:	f7 da                	neg    %edx
+  8030d8:	5b                   	pop    %ebx
+  8030d9:	c3                   	ret
+  8030da:	f7 d9                	neg    %ecx
+  8030dc:	83 d3 00             	adc    $0x0,%ebx
+  8030df:	f7 db                	neg    %ebx
+  8030e1:	53                   	push   %ebx
+  8030e2:	51                   	push   %ecx
+  8030e3:	52                   	push   %edx
+  8030e4:	50                   	push   %eax
+  8030e5:	e8 62 ff ff ff       	call   80304c <__udivdi3>
+  8030ea:	83 c4 10             	add    $0x10,%esp
+  8030ed:	eb e2                	jmp    8030d1 <__divdi3+0x3e>
+  8030ef:	f7 d9                	neg    %ecx
+  8030f1:	83 d3 00             	adc    $0x0,%ebx
+  8030f4:	f7 db                	neg    %ebx
+  8030f6:	53                   	push   %ebx
+  8030f7:	51                   	push   %ecx
+  8030f8:	52                   	push   %edx
+  8030f9:	50                   	push   %eax
+  8030fa:	e8 4d ff ff ff       	call   80304c <__udivdi3>
+  8030ff:	83 c4 10             	add    $0x10,%esp
+  803102:	eb d4                	jmp    8030d8 <__divdi3+0x45>
+
+00803104 <__moddi3>:
+  803104:	55                   	push   %ebp
+  803105:	57                   	push   %edi
+  803106:	56                   	push   %esi
+  803107:	53                   	push   %ebx
+  803108:	83 ec 0c             	sub    $0xc,%esp
+  80310b:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80310f:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803113:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803117:	89 e9                	mov    %ebp,%ecx
+  803119:	f7 d9                	neg    %ecx
+  80311b:	89 d0                	mov    %edx,%eax
+  80311d:	83 d0 00             	adc    $0x0,%eax
+  803120:	f7 d8                	neg    %eax
+  803122:	0f 49 e9             	cmovns %ecx,%ebp
+  803125:	0f 49 d0             	cmovns %eax,%edx
+  803128:	52                   	push   %edx
+  803129:	55                   	push   %ebp
+  80312a:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80312e:	f7 da                	neg    %edx
+  803130:	89 d8                	mov    %ebx,%eax
+  803132:	83 d0 00             	adc    $0x0,%eax
+  803135:	f7 d8                	neg    %eax
+  803137:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80313c:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803140:	0f 48 c3             	cmovs  %ebx,%eax
+  803143:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803147:	ff 74 24 0c          	push   0xc(%esp)
+  80314b:	ff 74 24 0c          	push   0xc(%esp)
+  80314f:	e8 16 ff ff ff       	call   80306a <__umoddi3>
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	85 db                	test   %ebx,%ebx
+  803159:	78 08                	js     803163 <__moddi3+0x5f>
+  80315b:	83 c4 0c             	add    $0xc,%esp
+  80315e:	5b                   	pop    %ebx
+  80315f:	5e                   	pop    %esi
+  803160:	5f                   	pop    %edi
+  803161:	5d                   	pop    %ebp
+  803162:	c3                   	ret
+  803163:	f7 d8                	neg    %eax
+  803165:	83 d2 00             	adc    $0x0,%edx
+  803168:	f7 da                	neg    %edx
+  80316a:	eb ef                	jmp    80315b <__moddi3+0x57>
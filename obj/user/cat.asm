@@ -0,0 +1,5230 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 04 01 00 00       	call   800135 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 20 50 80 00       	push   $0x805020
+  800048:	56                   	push   %esi
+  800049:	e8 d9 18 00 00       	call   801927 <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 20 50 80 00       	push   $0x805020
+  800060:	6a 01                	push   $0x1
+  800062:	e8 9b 19 00 00       	call   801a02 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 80 33 80 00       	push   $0x803380
+  80007a:	6a 0d                	push   $0xd
+  80007c:	68 9b 33 80 00       	push   $0x80339b
+  800081:	e8 28 01 00 00       	call   8001ae <_panic>
+  800086:	78 07                	js     80008f <cat+0x5c>
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 a6 33 80 00       	push   $0x8033a6
+  80009b:	6a 0f                	push   $0xf
+  80009d:	68 9b 33 80 00       	push   $0x80339b
+  8000a2:	e8 07 01 00 00       	call   8001ae <_panic>
+
+008000a7 <umain>:
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8000b3:	c7 05 00 40 80 00 bb 	movl   $0x8033bb,0x804000
+  8000ba:	33 80 00 
+  8000bd:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c1:	74 0d                	je     8000d0 <umain+0x29>
+  8000c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8000c8:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000cc:	7f 38                	jg     800106 <umain+0x5f>
+  8000ce:	eb 12                	jmp    8000e2 <umain+0x3b>
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	68 bf 33 80 00       	push   $0x8033bf
+  8000d8:	6a 00                	push   $0x0
+  8000da:	e8 54 ff ff ff       	call   800033 <cat>
+  8000df:	83 c4 10             	add    $0x10,%esp
+  8000e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e5:	5b                   	pop    %ebx
+  8000e6:	5e                   	pop    %esi
+  8000e7:	5f                   	pop    %edi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+  8000ea:	83 ec 04             	sub    $0x4,%esp
+  8000ed:	50                   	push   %eax
+  8000ee:	ff 34 b7             	push   (%edi,%esi,4)
+  8000f1:	68 c7 33 80 00       	push   $0x8033c7
+  8000f6:	e8 5a 22 00 00       	call   802355 <printf>
+  8000fb:	83 c4 10             	add    $0x10,%esp
+  8000fe:	83 c6 01             	add    $0x1,%esi
+  800101:	39 75 08             	cmp    %esi,0x8(%ebp)
+  800104:	74 dc                	je     8000e2 <umain+0x3b>
+  800106:	83 ec 08             	sub    $0x8,%esp
+  800109:	6a 00                	push   $0x0
+  80010b:	ff 34 b7             	push   (%edi,%esi,4)
+  80010e:	e8 d1 1f 00 00       	call   8020e4 <open>
+  800113:	89 c3                	mov    %eax,%ebx
+  800115:	83 c4 10             	add    $0x10,%esp
+  800118:	85 c0                	test   %eax,%eax
+  80011a:	78 ce                	js     8000ea <umain+0x43>
+  80011c:	83 ec 08             	sub    $0x8,%esp
+  80011f:	ff 34 b7             	push   (%edi,%esi,4)
+  800122:	50                   	push   %eax
+  800123:	e8 0b ff ff ff       	call   800033 <cat>
+  800128:	89 1c 24             	mov    %ebx,(%esp)
+  80012b:	e8 bb 16 00 00       	call   8017eb <close>
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	eb c9                	jmp    8000fe <umain+0x57>
+
+00800135 <libmain>:
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	56                   	push   %esi
+  800139:	53                   	push   %ebx
+  80013a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800140:	e8 31 0c 00 00       	call   800d76 <sys_getenvid>
+  800145:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80014a:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800150:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800155:	a3 20 70 80 00       	mov    %eax,0x807020
+  80015a:	85 db                	test   %ebx,%ebx
+  80015c:	7e 07                	jle    800165 <libmain+0x30>
+  80015e:	8b 06                	mov    (%esi),%eax
+  800160:	a3 00 40 80 00       	mov    %eax,0x804000
+  800165:	83 ec 08             	sub    $0x8,%esp
+  800168:	56                   	push   %esi
+  800169:	53                   	push   %ebx
+  80016a:	e8 38 ff ff ff       	call   8000a7 <umain>
+  80016f:	e8 0a 00 00 00       	call   80017e <exit>
+  800174:	83 c4 10             	add    $0x10,%esp
+  800177:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80017a:	5b                   	pop    %ebx
+  80017b:	5e                   	pop    %esi
+  80017c:	5d                   	pop    %ebp
+  80017d:	c3                   	ret
+
+0080017e <exit>:
+  80017e:	55                   	push   %ebp
+  80017f:	89 e5                	mov    %esp,%ebp
+  800181:	83 ec 08             	sub    $0x8,%esp
+  800184:	a1 20 70 80 00       	mov    0x807020,%eax
+  800189:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80018f:	85 c0                	test   %eax,%eax
+  800191:	75 14                	jne    8001a7 <exit+0x29>
+  800193:	e8 80 16 00 00       	call   801818 <close_all>
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	6a 00                	push   $0x0
+  80019d:	e8 93 0b 00 00       	call   800d35 <sys_env_destroy>
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	c9                   	leave
+  8001a6:	c3                   	ret
+  8001a7:	e8 f6 12 00 00       	call   8014a2 <sys_lease_complete>
+  8001ac:	eb e5                	jmp    800193 <exit+0x15>
+
+008001ae <_panic>:
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	56                   	push   %esi
+  8001b2:	53                   	push   %ebx
+  8001b3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8001b6:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001bc:	e8 b5 0b 00 00       	call   800d76 <sys_getenvid>
+  8001c1:	83 ec 0c             	sub    $0xc,%esp
+  8001c4:	ff 75 0c             	push   0xc(%ebp)
+  8001c7:	ff 75 08             	push   0x8(%ebp)
+  8001ca:	56                   	push   %esi
+  8001cb:	50                   	push   %eax
+  8001cc:	68 e4 33 80 00       	push   $0x8033e4
+  8001d1:	e8 b3 00 00 00       	call   800289 <cprintf>
+  8001d6:	83 c4 18             	add    $0x18,%esp
+  8001d9:	53                   	push   %ebx
+  8001da:	ff 75 10             	push   0x10(%ebp)
+  8001dd:	e8 56 00 00 00       	call   800238 <vcprintf>
+  8001e2:	c7 04 24 2e 38 80 00 	movl   $0x80382e,(%esp)
+  8001e9:	e8 9b 00 00 00       	call   800289 <cprintf>
+  8001ee:	83 c4 10             	add    $0x10,%esp
+  8001f1:	cc                   	int3
+  8001f2:	eb fd                	jmp    8001f1 <_panic+0x43>
+
+008001f4 <putch>:
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	53                   	push   %ebx
+  8001f8:	83 ec 04             	sub    $0x4,%esp
+  8001fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001fe:	8b 13                	mov    (%ebx),%edx
+  800200:	8d 42 01             	lea    0x1(%edx),%eax
+  800203:	89 03                	mov    %eax,(%ebx)
+  800205:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800208:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80020c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800211:	74 09                	je     80021c <putch+0x28>
+  800213:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800217:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+  80021c:	83 ec 08             	sub    $0x8,%esp
+  80021f:	68 ff 00 00 00       	push   $0xff
+  800224:	8d 43 08             	lea    0x8(%ebx),%eax
+  800227:	50                   	push   %eax
+  800228:	e8 cb 0a 00 00       	call   800cf8 <sys_cputs>
+  80022d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	eb db                	jmp    800213 <putch+0x1f>
+
+00800238 <vcprintf>:
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800241:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800248:	00 00 00 
+  80024b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800252:	00 00 00 
+  800255:	ff 75 0c             	push   0xc(%ebp)
+  800258:	ff 75 08             	push   0x8(%ebp)
+  80025b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800261:	50                   	push   %eax
+  800262:	68 f4 01 80 00       	push   $0x8001f4
+  800267:	e8 1c 01 00 00       	call   800388 <vprintfmt>
+  80026c:	83 c4 08             	add    $0x8,%esp
+  80026f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800275:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80027b:	50                   	push   %eax
+  80027c:	e8 77 0a 00 00       	call   800cf8 <sys_cputs>
+  800281:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+00800289 <cprintf>:
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	83 ec 10             	sub    $0x10,%esp
+  80028f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800292:	50                   	push   %eax
+  800293:	ff 75 08             	push   0x8(%ebp)
+  800296:	e8 9d ff ff ff       	call   800238 <vcprintf>
+  80029b:	c9                   	leave
+  80029c:	c3                   	ret
+
+0080029d <printnum>:
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	57                   	push   %edi
+  8002a1:	56                   	push   %esi
+  8002a2:	53                   	push   %ebx
+  8002a3:	83 ec 1c             	sub    $0x1c,%esp
+  8002a6:	89 c3                	mov    %eax,%ebx
+  8002a8:	89 d6                	mov    %edx,%esi
+  8002aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002b0:	89 d1                	mov    %edx,%ecx
+  8002b2:	89 c2                	mov    %eax,%edx
+  8002b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ba:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002c0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002c7:	39 c2                	cmp    %eax,%edx
+  8002c9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002cc:	73 4b                	jae    800319 <printnum+0x7c>
+  8002ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002d1:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8002d4:	85 ff                	test   %edi,%edi
+  8002d6:	7e 11                	jle    8002e9 <printnum+0x4c>
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+  8002db:	56                   	push   %esi
+  8002dc:	ff 75 18             	push   0x18(%ebp)
+  8002df:	ff d3                	call   *%ebx
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	83 ef 01             	sub    $0x1,%edi
+  8002e7:	75 ef                	jne    8002d8 <printnum+0x3b>
+  8002e9:	83 ec 08             	sub    $0x8,%esp
+  8002ec:	56                   	push   %esi
+  8002ed:	83 ec 04             	sub    $0x4,%esp
+  8002f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f3:	ff 75 e0             	push   -0x20(%ebp)
+  8002f6:	ff 75 dc             	push   -0x24(%ebp)
+  8002f9:	ff 75 d8             	push   -0x28(%ebp)
+  8002fc:	e8 64 2f 00 00       	call   803265 <__umoddi3>
+  800301:	83 c4 14             	add    $0x14,%esp
+  800304:	0f be 80 07 34 80 00 	movsbl 0x803407(%eax),%eax
+  80030b:	50                   	push   %eax
+  80030c:	ff d3                	call   *%ebx
+  80030e:	83 c4 10             	add    $0x10,%esp
+  800311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800314:	5b                   	pop    %ebx
+  800315:	5e                   	pop    %esi
+  800316:	5f                   	pop    %edi
+  800317:	5d                   	pop    %ebp
+  800318:	c3                   	ret
+  800319:	83 ec 0c             	sub    $0xc,%esp
+  80031c:	ff 75 18             	push   0x18(%ebp)
+  80031f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800322:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800325:	52                   	push   %edx
+  800326:	50                   	push   %eax
+  800327:	83 ec 08             	sub    $0x8,%esp
+  80032a:	ff 75 e4             	push   -0x1c(%ebp)
+  80032d:	ff 75 e0             	push   -0x20(%ebp)
+  800330:	ff 75 dc             	push   -0x24(%ebp)
+  800333:	ff 75 d8             	push   -0x28(%ebp)
+  800336:	e8 0c 2f 00 00       	call   803247 <__udivdi3>
+  80033b:	83 c4 18             	add    $0x18,%esp
+  80033e:	52                   	push   %edx
+  80033f:	50                   	push   %eax
+  800340:	89 f2                	mov    %esi,%edx
+  800342:	89 d8                	mov    %ebx,%eax
+  800344:	e8 54 ff ff ff       	call   80029d <printnum>
+  800349:	83 c4 20             	add    $0x20,%esp
+  80034c:	eb 9b                	jmp    8002e9 <printnum+0x4c>
+
+0080034e <sprintputch>:
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800354:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800358:	8b 10                	mov    (%eax),%edx
+  80035a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80035d:	73 0a                	jae    800369 <sprintputch+0x1b>
+  80035f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800362:	89 08                	mov    %ecx,(%eax)
+  800364:	8b 45 08             	mov    0x8(%ebp),%eax
+  800367:	88 02                	mov    %al,(%edx)
+  800369:	5d                   	pop    %ebp
+  80036a:	c3                   	ret
+
+0080036b <printfmt>:
+  80036b:	55                   	push   %ebp
+  80036c:	89 e5                	mov    %esp,%ebp
+  80036e:	83 ec 08             	sub    $0x8,%esp
+  800371:	8d 45 14             	lea    0x14(%ebp),%eax
+  800374:	50                   	push   %eax
+  800375:	ff 75 10             	push   0x10(%ebp)
+  800378:	ff 75 0c             	push   0xc(%ebp)
+  80037b:	ff 75 08             	push   0x8(%ebp)
+  80037e:	e8 05 00 00 00       	call   800388 <vprintfmt>
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	c9                   	leave
+  800387:	c3                   	ret
+
+00800388 <vprintfmt>:
+  800388:	55                   	push   %ebp
+  800389:	89 e5                	mov    %esp,%ebp
+  80038b:	57                   	push   %edi
+  80038c:	56                   	push   %esi
+  80038d:	53                   	push   %ebx
+  80038e:	83 ec 2c             	sub    $0x2c,%esp
+  800391:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800394:	89 df                	mov    %ebx,%edi
+  800396:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800399:	8b 45 10             	mov    0x10(%ebp),%eax
+  80039c:	8d 70 01             	lea    0x1(%eax),%esi
+  80039f:	0f b6 00             	movzbl (%eax),%eax
+  8003a2:	83 f8 25             	cmp    $0x25,%eax
+  8003a5:	74 1e                	je     8003c5 <vprintfmt+0x3d>
+  8003a7:	85 c0                	test   %eax,%eax
+  8003a9:	0f 84 15 05 00 00    	je     8008c4 <vprintfmt+0x53c>
+  8003af:	83 ec 08             	sub    $0x8,%esp
+  8003b2:	53                   	push   %ebx
+  8003b3:	50                   	push   %eax
+  8003b4:	ff d7                	call   *%edi
+  8003b6:	83 c6 01             	add    $0x1,%esi
+  8003b9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003bd:	83 c4 10             	add    $0x10,%esp
+  8003c0:	83 f8 25             	cmp    $0x25,%eax
+  8003c3:	75 e2                	jne    8003a7 <vprintfmt+0x1f>
+  8003c5:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8003c9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8003d0:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003d7:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8003de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003e3:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8003e6:	8d 56 01             	lea    0x1(%esi),%edx
+  8003e9:	0f b6 0e             	movzbl (%esi),%ecx
+  8003ec:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003ef:	3c 55                	cmp    $0x55,%al
+  8003f1:	0f 87 3b 04 00 00    	ja     800832 <vprintfmt+0x4aa>
+  8003f7:	0f b6 c0             	movzbl %al,%eax
+  8003fa:	ff 24 85 40 35 80 00 	jmp    *0x803540(,%eax,4)
+  800401:	89 75 10             	mov    %esi,0x10(%ebp)
+  800404:	eb 93                	jmp    800399 <vprintfmt+0x11>
+  800406:	89 d6                	mov    %edx,%esi
+  800408:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80040c:	eb d8                	jmp    8003e6 <vprintfmt+0x5e>
+  80040e:	89 d6                	mov    %edx,%esi
+  800410:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800414:	eb d0                	jmp    8003e6 <vprintfmt+0x5e>
+  800416:	0f b6 c9             	movzbl %cl,%ecx
+  800419:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80041c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80041f:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800423:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800426:	83 f9 09             	cmp    $0x9,%ecx
+  800429:	77 6f                	ja     80049a <vprintfmt+0x112>
+  80042b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80042e:	83 c2 01             	add    $0x1,%edx
+  800431:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800434:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800438:	0f be 02             	movsbl (%edx),%eax
+  80043b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80043e:	83 fe 09             	cmp    $0x9,%esi
+  800441:	76 eb                	jbe    80042e <vprintfmt+0xa6>
+  800443:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800446:	89 d6                	mov    %edx,%esi
+  800448:	eb 13                	jmp    80045d <vprintfmt+0xd5>
+  80044a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044d:	8b 00                	mov    (%eax),%eax
+  80044f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800452:	8b 45 14             	mov    0x14(%ebp),%eax
+  800455:	8d 40 04             	lea    0x4(%eax),%eax
+  800458:	89 45 14             	mov    %eax,0x14(%ebp)
+  80045b:	89 d6                	mov    %edx,%esi
+  80045d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800461:	79 83                	jns    8003e6 <vprintfmt+0x5e>
+  800463:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800466:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800469:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800470:	e9 71 ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+  800475:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800478:	85 c9                	test   %ecx,%ecx
+  80047a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047f:	0f 49 c1             	cmovns %ecx,%eax
+  800482:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800485:	89 d6                	mov    %edx,%esi
+  800487:	e9 5a ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+  80048c:	89 d6                	mov    %edx,%esi
+  80048e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800495:	e9 4c ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+  80049a:	89 d6                	mov    %edx,%esi
+  80049c:	eb bf                	jmp    80045d <vprintfmt+0xd5>
+  80049e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8004a2:	89 d6                	mov    %edx,%esi
+  8004a4:	e9 3d ff ff ff       	jmp    8003e6 <vprintfmt+0x5e>
+  8004a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004af:	8d 70 04             	lea    0x4(%eax),%esi
+  8004b2:	83 ec 08             	sub    $0x8,%esp
+  8004b5:	53                   	push   %ebx
+  8004b6:	ff 30                	push   (%eax)
+  8004b8:	ff d7                	call   *%edi
+  8004ba:	83 c4 10             	add    $0x10,%esp
+  8004bd:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004c0:	e9 d4 fe ff ff       	jmp    800399 <vprintfmt+0x11>
+  8004c5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cb:	8d 70 04             	lea    0x4(%eax),%esi
+  8004ce:	8b 10                	mov    (%eax),%edx
+  8004d0:	89 d0                	mov    %edx,%eax
+  8004d2:	f7 d8                	neg    %eax
+  8004d4:	0f 48 c2             	cmovs  %edx,%eax
+  8004d7:	83 f8 12             	cmp    $0x12,%eax
+  8004da:	7f 23                	jg     8004ff <vprintfmt+0x177>
+  8004dc:	8b 14 85 a0 36 80 00 	mov    0x8036a0(,%eax,4),%edx
+  8004e3:	85 d2                	test   %edx,%edx
+  8004e5:	74 18                	je     8004ff <vprintfmt+0x177>
+  8004e7:	52                   	push   %edx
+  8004e8:	68 fb 37 80 00       	push   $0x8037fb
+  8004ed:	53                   	push   %ebx
+  8004ee:	57                   	push   %edi
+  8004ef:	e8 77 fe ff ff       	call   80036b <printfmt>
+  8004f4:	83 c4 10             	add    $0x10,%esp
+  8004f7:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004fa:	e9 9a fe ff ff       	jmp    800399 <vprintfmt+0x11>
+  8004ff:	50                   	push   %eax
+  800500:	68 1f 34 80 00       	push   $0x80341f
+  800505:	53                   	push   %ebx
+  800506:	57                   	push   %edi
+  800507:	e8 5f fe ff ff       	call   80036b <printfmt>
+  80050c:	83 c4 10             	add    $0x10,%esp
+  80050f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800512:	e9 82 fe ff ff       	jmp    800399 <vprintfmt+0x11>
+  800517:	89 55 10             	mov    %edx,0x10(%ebp)
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	83 c0 04             	add    $0x4,%eax
+  800520:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8b 00                	mov    (%eax),%eax
+  800528:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80052b:	85 c0                	test   %eax,%eax
+  80052d:	0f 84 61 03 00 00    	je     800894 <vprintfmt+0x50c>
+  800533:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800537:	7e 06                	jle    80053f <vprintfmt+0x1b7>
+  800539:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80053d:	75 29                	jne    800568 <vprintfmt+0x1e0>
+  80053f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800542:	8d 70 01             	lea    0x1(%eax),%esi
+  800545:	0f b6 00             	movzbl (%eax),%eax
+  800548:	0f be d0             	movsbl %al,%edx
+  80054b:	85 d2                	test   %edx,%edx
+  80054d:	0f 84 bb 00 00 00    	je     80060e <vprintfmt+0x286>
+  800553:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800556:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800559:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80055c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80055f:	eb 7a                	jmp    8005db <vprintfmt+0x253>
+  800561:	c7 45 d0 18 34 80 00 	movl   $0x803418,-0x30(%ebp)
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	ff 75 d4             	push   -0x2c(%ebp)
+  80056e:	ff 75 d0             	push   -0x30(%ebp)
+  800571:	e8 e0 03 00 00       	call   800956 <strnlen>
+  800576:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800579:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80057c:	83 c4 10             	add    $0x10,%esp
+  80057f:	85 d2                	test   %edx,%edx
+  800581:	0f 8e d6 02 00 00    	jle    80085d <vprintfmt+0x4d5>
+  800587:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	53                   	push   %ebx
+  80058f:	56                   	push   %esi
+  800590:	ff d7                	call   *%edi
+  800592:	83 c4 10             	add    $0x10,%esp
+  800595:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800599:	75 f0                	jne    80058b <vprintfmt+0x203>
+  80059b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80059e:	8d 70 01             	lea    0x1(%eax),%esi
+  8005a1:	0f b6 00             	movzbl (%eax),%eax
+  8005a4:	0f be d0             	movsbl %al,%edx
+  8005a7:	85 d2                	test   %edx,%edx
+  8005a9:	0f 84 da 02 00 00    	je     800889 <vprintfmt+0x501>
+  8005af:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005b2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005b5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005b8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005bb:	eb 1e                	jmp    8005db <vprintfmt+0x253>
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	ff 75 0c             	push   0xc(%ebp)
+  8005c3:	52                   	push   %edx
+  8005c4:	ff 55 08             	call   *0x8(%ebp)
+  8005c7:	83 c4 10             	add    $0x10,%esp
+  8005ca:	83 eb 01             	sub    $0x1,%ebx
+  8005cd:	83 c6 01             	add    $0x1,%esi
+  8005d0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d4:	0f be d0             	movsbl %al,%edx
+  8005d7:	85 d2                	test   %edx,%edx
+  8005d9:	74 2a                	je     800605 <vprintfmt+0x27d>
+  8005db:	85 ff                	test   %edi,%edi
+  8005dd:	78 05                	js     8005e4 <vprintfmt+0x25c>
+  8005df:	83 ef 01             	sub    $0x1,%edi
+  8005e2:	78 59                	js     80063d <vprintfmt+0x2b5>
+  8005e4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e8:	74 d3                	je     8005bd <vprintfmt+0x235>
+  8005ea:	0f be c0             	movsbl %al,%eax
+  8005ed:	83 e8 20             	sub    $0x20,%eax
+  8005f0:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f3:	76 c8                	jbe    8005bd <vprintfmt+0x235>
+  8005f5:	83 ec 08             	sub    $0x8,%esp
+  8005f8:	ff 75 0c             	push   0xc(%ebp)
+  8005fb:	6a 3f                	push   $0x3f
+  8005fd:	ff 55 08             	call   *0x8(%ebp)
+  800600:	83 c4 10             	add    $0x10,%esp
+  800603:	eb c5                	jmp    8005ca <vprintfmt+0x242>
+  800605:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800608:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80060b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80060e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800611:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800615:	7e 1b                	jle    800632 <vprintfmt+0x2aa>
+  800617:	83 ec 08             	sub    $0x8,%esp
+  80061a:	53                   	push   %ebx
+  80061b:	6a 20                	push   $0x20
+  80061d:	ff d7                	call   *%edi
+  80061f:	83 c4 10             	add    $0x10,%esp
+  800622:	83 ee 01             	sub    $0x1,%esi
+  800625:	75 f0                	jne    800617 <vprintfmt+0x28f>
+  800627:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80062a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062d:	e9 67 fd ff ff       	jmp    800399 <vprintfmt+0x11>
+  800632:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+  800638:	e9 5c fd ff ff       	jmp    800399 <vprintfmt+0x11>
+  80063d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800640:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800643:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800646:	eb c6                	jmp    80060e <vprintfmt+0x286>
+  800648:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80064b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80064e:	83 f9 01             	cmp    $0x1,%ecx
+  800651:	7f 1f                	jg     800672 <vprintfmt+0x2ea>
+  800653:	85 c9                	test   %ecx,%ecx
+  800655:	74 67                	je     8006be <vprintfmt+0x336>
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 30                	mov    (%eax),%esi
+  80065c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80065f:	89 f0                	mov    %esi,%eax
+  800661:	c1 f8 1f             	sar    $0x1f,%eax
+  800664:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800670:	eb 17                	jmp    800689 <vprintfmt+0x301>
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 50 04             	mov    0x4(%eax),%edx
+  800678:	8b 00                	mov    (%eax),%eax
+  80067a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 40 08             	lea    0x8(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+  800689:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80068c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80068f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800694:	85 c9                	test   %ecx,%ecx
+  800696:	0f 89 12 01 00 00    	jns    8007ae <vprintfmt+0x426>
+  80069c:	83 ec 08             	sub    $0x8,%esp
+  80069f:	53                   	push   %ebx
+  8006a0:	6a 2d                	push   $0x2d
+  8006a2:	ff d7                	call   *%edi
+  8006a4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006aa:	f7 da                	neg    %edx
+  8006ac:	83 d1 00             	adc    $0x0,%ecx
+  8006af:	f7 d9                	neg    %ecx
+  8006b1:	83 c4 10             	add    $0x10,%esp
+  8006b4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006b9:	e9 f0 00 00 00       	jmp    8007ae <vprintfmt+0x426>
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8b 30                	mov    (%eax),%esi
+  8006c3:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006c6:	89 f0                	mov    %esi,%eax
+  8006c8:	c1 f8 1f             	sar    $0x1f,%eax
+  8006cb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d7:	eb b0                	jmp    800689 <vprintfmt+0x301>
+  8006d9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006dc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006df:	83 f9 01             	cmp    $0x1,%ecx
+  8006e2:	7f 1e                	jg     800702 <vprintfmt+0x37a>
+  8006e4:	85 c9                	test   %ecx,%ecx
+  8006e6:	74 32                	je     80071a <vprintfmt+0x392>
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 10                	mov    (%eax),%edx
+  8006ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006fd:	e9 ac 00 00 00       	jmp    8007ae <vprintfmt+0x426>
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070a:	8d 40 08             	lea    0x8(%eax),%eax
+  80070d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800710:	be 0a 00 00 00       	mov    $0xa,%esi
+  800715:	e9 94 00 00 00       	jmp    8007ae <vprintfmt+0x426>
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80072f:	eb 7d                	jmp    8007ae <vprintfmt+0x426>
+  800731:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800734:	89 55 10             	mov    %edx,0x10(%ebp)
+  800737:	83 f9 01             	cmp    $0x1,%ecx
+  80073a:	7f 1b                	jg     800757 <vprintfmt+0x3cf>
+  80073c:	85 c9                	test   %ecx,%ecx
+  80073e:	74 2c                	je     80076c <vprintfmt+0x3e4>
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 10                	mov    (%eax),%edx
+  800745:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800750:	be 08 00 00 00       	mov    $0x8,%esi
+  800755:	eb 57                	jmp    8007ae <vprintfmt+0x426>
+  800757:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075a:	8b 10                	mov    (%eax),%edx
+  80075c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80075f:	8d 40 08             	lea    0x8(%eax),%eax
+  800762:	89 45 14             	mov    %eax,0x14(%ebp)
+  800765:	be 08 00 00 00       	mov    $0x8,%esi
+  80076a:	eb 42                	jmp    8007ae <vprintfmt+0x426>
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8b 10                	mov    (%eax),%edx
+  800771:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800776:	8d 40 04             	lea    0x4(%eax),%eax
+  800779:	89 45 14             	mov    %eax,0x14(%ebp)
+  80077c:	be 08 00 00 00       	mov    $0x8,%esi
+  800781:	eb 2b                	jmp    8007ae <vprintfmt+0x426>
+  800783:	89 55 10             	mov    %edx,0x10(%ebp)
+  800786:	83 ec 08             	sub    $0x8,%esp
+  800789:	53                   	push   %ebx
+  80078a:	6a 30                	push   $0x30
+  80078c:	ff d7                	call   *%edi
+  80078e:	83 c4 08             	add    $0x8,%esp
+  800791:	53                   	push   %ebx
+  800792:	6a 78                	push   $0x78
+  800794:	ff d7                	call   *%edi
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a0:	83 c4 10             	add    $0x10,%esp
+  8007a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a9:	be 10 00 00 00       	mov    $0x10,%esi
+  8007ae:	83 ec 0c             	sub    $0xc,%esp
+  8007b1:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b9:	56                   	push   %esi
+  8007ba:	51                   	push   %ecx
+  8007bb:	52                   	push   %edx
+  8007bc:	89 da                	mov    %ebx,%edx
+  8007be:	89 f8                	mov    %edi,%eax
+  8007c0:	e8 d8 fa ff ff       	call   80029d <printnum>
+  8007c5:	83 c4 20             	add    $0x20,%esp
+  8007c8:	e9 cc fb ff ff       	jmp    800399 <vprintfmt+0x11>
+  8007cd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007d0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d3:	83 f9 01             	cmp    $0x1,%ecx
+  8007d6:	7f 1b                	jg     8007f3 <vprintfmt+0x46b>
+  8007d8:	85 c9                	test   %ecx,%ecx
+  8007da:	74 2c                	je     800808 <vprintfmt+0x480>
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 10                	mov    (%eax),%edx
+  8007e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ec:	be 10 00 00 00       	mov    $0x10,%esi
+  8007f1:	eb bb                	jmp    8007ae <vprintfmt+0x426>
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8b 10                	mov    (%eax),%edx
+  8007f8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fb:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800801:	be 10 00 00 00       	mov    $0x10,%esi
+  800806:	eb a6                	jmp    8007ae <vprintfmt+0x426>
+  800808:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080b:	8b 10                	mov    (%eax),%edx
+  80080d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800812:	8d 40 04             	lea    0x4(%eax),%eax
+  800815:	89 45 14             	mov    %eax,0x14(%ebp)
+  800818:	be 10 00 00 00       	mov    $0x10,%esi
+  80081d:	eb 8f                	jmp    8007ae <vprintfmt+0x426>
+  80081f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800822:	83 ec 08             	sub    $0x8,%esp
+  800825:	53                   	push   %ebx
+  800826:	6a 25                	push   $0x25
+  800828:	ff d7                	call   *%edi
+  80082a:	83 c4 10             	add    $0x10,%esp
+  80082d:	e9 67 fb ff ff       	jmp    800399 <vprintfmt+0x11>
+  800832:	83 ec 08             	sub    $0x8,%esp
+  800835:	53                   	push   %ebx
+  800836:	6a 25                	push   $0x25
+  800838:	ff d7                	call   *%edi
+  80083a:	83 c4 10             	add    $0x10,%esp
+  80083d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800841:	0f 84 ba fb ff ff    	je     800401 <vprintfmt+0x79>
+  800847:	89 75 10             	mov    %esi,0x10(%ebp)
+  80084a:	89 f0                	mov    %esi,%eax
+  80084c:	83 e8 01             	sub    $0x1,%eax
+  80084f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800853:	75 f7                	jne    80084c <vprintfmt+0x4c4>
+  800855:	89 45 10             	mov    %eax,0x10(%ebp)
+  800858:	e9 3c fb ff ff       	jmp    800399 <vprintfmt+0x11>
+  80085d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800860:	8d 70 01             	lea    0x1(%eax),%esi
+  800863:	0f b6 00             	movzbl (%eax),%eax
+  800866:	0f be d0             	movsbl %al,%edx
+  800869:	85 d2                	test   %edx,%edx
+  80086b:	74 11                	je     80087e <vprintfmt+0x4f6>
+  80086d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800870:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800873:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800876:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800879:	e9 5d fd ff ff       	jmp    8005db <vprintfmt+0x253>
+  80087e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800881:	89 45 14             	mov    %eax,0x14(%ebp)
+  800884:	e9 10 fb ff ff       	jmp    800399 <vprintfmt+0x11>
+  800889:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088f:	e9 05 fb ff ff       	jmp    800399 <vprintfmt+0x11>
+  800894:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800898:	7e 0a                	jle    8008a4 <vprintfmt+0x51c>
+  80089a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80089e:	0f 85 bd fc ff ff    	jne    800561 <vprintfmt+0x1d9>
+  8008a4:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008a9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008ae:	be 19 34 80 00       	mov    $0x803419,%esi
+  8008b3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008b6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008b9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008bc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008bf:	e9 17 fd ff ff       	jmp    8005db <vprintfmt+0x253>
+  8008c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c7:	5b                   	pop    %ebx
+  8008c8:	5e                   	pop    %esi
+  8008c9:	5f                   	pop    %edi
+  8008ca:	5d                   	pop    %ebp
+  8008cb:	c3                   	ret
+
+008008cc <vsnprintf>:
+  8008cc:	55                   	push   %ebp
+  8008cd:	89 e5                	mov    %esp,%ebp
+  8008cf:	83 ec 18             	sub    $0x18,%esp
+  8008d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008db:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008df:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008e2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8008e9:	85 c0                	test   %eax,%eax
+  8008eb:	74 26                	je     800913 <vsnprintf+0x47>
+  8008ed:	85 d2                	test   %edx,%edx
+  8008ef:	7e 22                	jle    800913 <vsnprintf+0x47>
+  8008f1:	ff 75 14             	push   0x14(%ebp)
+  8008f4:	ff 75 10             	push   0x10(%ebp)
+  8008f7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008fa:	50                   	push   %eax
+  8008fb:	68 4e 03 80 00       	push   $0x80034e
+  800900:	e8 83 fa ff ff       	call   800388 <vprintfmt>
+  800905:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800908:	c6 00 00             	movb   $0x0,(%eax)
+  80090b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80090e:	83 c4 10             	add    $0x10,%esp
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+  800913:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800918:	eb f7                	jmp    800911 <vsnprintf+0x45>
+
+0080091a <snprintf>:
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	83 ec 08             	sub    $0x8,%esp
+  800920:	8d 45 14             	lea    0x14(%ebp),%eax
+  800923:	50                   	push   %eax
+  800924:	ff 75 10             	push   0x10(%ebp)
+  800927:	ff 75 0c             	push   0xc(%ebp)
+  80092a:	ff 75 08             	push   0x8(%ebp)
+  80092d:	e8 9a ff ff ff       	call   8008cc <vsnprintf>
+  800932:	c9                   	leave
+  800933:	c3                   	ret
+
+00800934 <strlen>:
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	8b 55 08             	mov    0x8(%ebp),%edx
+  80093a:	80 3a 00             	cmpb   $0x0,(%edx)
+  80093d:	74 10                	je     80094f <strlen+0x1b>
+  80093f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800944:	83 c0 01             	add    $0x1,%eax
+  800947:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80094b:	75 f7                	jne    800944 <strlen+0x10>
+  80094d:	5d                   	pop    %ebp
+  80094e:	c3                   	ret
+  80094f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800954:	eb f7                	jmp    80094d <strlen+0x19>
+
+00800956 <strnlen>:
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095f:	85 d2                	test   %edx,%edx
+  800961:	74 16                	je     800979 <strnlen+0x23>
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+  800968:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80096c:	74 09                	je     800977 <strnlen+0x21>
+  80096e:	83 c0 01             	add    $0x1,%eax
+  800971:	39 d0                	cmp    %edx,%eax
+  800973:	75 f3                	jne    800968 <strnlen+0x12>
+  800975:	89 d0                	mov    %edx,%eax
+  800977:	5d                   	pop    %ebp
+  800978:	c3                   	ret
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097e:	eb f7                	jmp    800977 <strnlen+0x21>
+
+00800980 <strcpy>:
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	53                   	push   %ebx
+  800984:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800987:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80098a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800993:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800996:	83 c0 01             	add    $0x1,%eax
+  800999:	84 d2                	test   %dl,%dl
+  80099b:	75 f2                	jne    80098f <strcpy+0xf>
+  80099d:	89 c8                	mov    %ecx,%eax
+  80099f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a2:	c9                   	leave
+  8009a3:	c3                   	ret
+
+008009a4 <strcat>:
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	53                   	push   %ebx
+  8009a8:	83 ec 10             	sub    $0x10,%esp
+  8009ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009ae:	53                   	push   %ebx
+  8009af:	e8 80 ff ff ff       	call   800934 <strlen>
+  8009b4:	83 c4 08             	add    $0x8,%esp
+  8009b7:	ff 75 0c             	push   0xc(%ebp)
+  8009ba:	01 d8                	add    %ebx,%eax
+  8009bc:	50                   	push   %eax
+  8009bd:	e8 be ff ff ff       	call   800980 <strcpy>
+  8009c2:	89 d8                	mov    %ebx,%eax
+  8009c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c7:	c9                   	leave
+  8009c8:	c3                   	ret
+
+008009c9 <strncpy>:
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	56                   	push   %esi
+  8009cd:	53                   	push   %ebx
+  8009ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009d7:	85 db                	test   %ebx,%ebx
+  8009d9:	74 17                	je     8009f2 <strncpy+0x29>
+  8009db:	01 f3                	add    %esi,%ebx
+  8009dd:	89 f0                	mov    %esi,%eax
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	0f b6 0a             	movzbl (%edx),%ecx
+  8009e5:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009e8:	80 f9 01             	cmp    $0x1,%cl
+  8009eb:	83 da ff             	sbb    $0xffffffff,%edx
+  8009ee:	39 c3                	cmp    %eax,%ebx
+  8009f0:	75 ed                	jne    8009df <strncpy+0x16>
+  8009f2:	89 f0                	mov    %esi,%eax
+  8009f4:	5b                   	pop    %ebx
+  8009f5:	5e                   	pop    %esi
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <strlcpy>:
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	56                   	push   %esi
+  8009fc:	53                   	push   %ebx
+  8009fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a06:	89 f0                	mov    %esi,%eax
+  800a08:	85 db                	test   %ebx,%ebx
+  800a0a:	74 1e                	je     800a2a <strlcpy+0x32>
+  800a0c:	83 eb 01             	sub    $0x1,%ebx
+  800a0f:	74 16                	je     800a27 <strlcpy+0x2f>
+  800a11:	01 f3                	add    %esi,%ebx
+  800a13:	0f b6 0a             	movzbl (%edx),%ecx
+  800a16:	84 c9                	test   %cl,%cl
+  800a18:	74 0d                	je     800a27 <strlcpy+0x2f>
+  800a1a:	83 c2 01             	add    $0x1,%edx
+  800a1d:	83 c0 01             	add    $0x1,%eax
+  800a20:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a23:	39 d8                	cmp    %ebx,%eax
+  800a25:	75 ec                	jne    800a13 <strlcpy+0x1b>
+  800a27:	c6 00 00             	movb   $0x0,(%eax)
+  800a2a:	29 f0                	sub    %esi,%eax
+  800a2c:	5b                   	pop    %ebx
+  800a2d:	5e                   	pop    %esi
+  800a2e:	5d                   	pop    %ebp
+  800a2f:	c3                   	ret
+
+00800a30 <strcmp>:
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a39:	0f b6 01             	movzbl (%ecx),%eax
+  800a3c:	84 c0                	test   %al,%al
+  800a3e:	74 11                	je     800a51 <strcmp+0x21>
+  800a40:	38 02                	cmp    %al,(%edx)
+  800a42:	75 0d                	jne    800a51 <strcmp+0x21>
+  800a44:	83 c1 01             	add    $0x1,%ecx
+  800a47:	83 c2 01             	add    $0x1,%edx
+  800a4a:	0f b6 01             	movzbl (%ecx),%eax
+  800a4d:	84 c0                	test   %al,%al
+  800a4f:	75 ef                	jne    800a40 <strcmp+0x10>
+  800a51:	0f b6 c0             	movzbl %al,%eax
+  800a54:	0f b6 12             	movzbl (%edx),%edx
+  800a57:	29 d0                	sub    %edx,%eax
+  800a59:	5d                   	pop    %ebp
+  800a5a:	c3                   	ret
+
+00800a5b <strncmp>:
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	53                   	push   %ebx
+  800a5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a65:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6d:	85 d2                	test   %edx,%edx
+  800a6f:	74 2e                	je     800a9f <strncmp+0x44>
+  800a71:	0f b6 01             	movzbl (%ecx),%eax
+  800a74:	84 c0                	test   %al,%al
+  800a76:	74 16                	je     800a8e <strncmp+0x33>
+  800a78:	3a 03                	cmp    (%ebx),%al
+  800a7a:	75 12                	jne    800a8e <strncmp+0x33>
+  800a7c:	83 c1 01             	add    $0x1,%ecx
+  800a7f:	83 c3 01             	add    $0x1,%ebx
+  800a82:	83 ea 01             	sub    $0x1,%edx
+  800a85:	75 ea                	jne    800a71 <strncmp+0x16>
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8c:	eb 11                	jmp    800a9f <strncmp+0x44>
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	85 d2                	test   %edx,%edx
+  800a95:	74 08                	je     800a9f <strncmp+0x44>
+  800a97:	0f b6 01             	movzbl (%ecx),%eax
+  800a9a:	0f b6 13             	movzbl (%ebx),%edx
+  800a9d:	29 d0                	sub    %edx,%eax
+  800a9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa2:	c9                   	leave
+  800aa3:	c3                   	ret
+
+00800aa4 <strchr>:
+  800aa4:	55                   	push   %ebp
+  800aa5:	89 e5                	mov    %esp,%ebp
+  800aa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800aae:	0f b6 10             	movzbl (%eax),%edx
+  800ab1:	84 d2                	test   %dl,%dl
+  800ab3:	74 15                	je     800aca <strchr+0x26>
+  800ab5:	38 d1                	cmp    %dl,%cl
+  800ab7:	74 0f                	je     800ac8 <strchr+0x24>
+  800ab9:	83 c0 01             	add    $0x1,%eax
+  800abc:	0f b6 10             	movzbl (%eax),%edx
+  800abf:	84 d2                	test   %dl,%dl
+  800ac1:	75 f2                	jne    800ab5 <strchr+0x11>
+  800ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac8:	5d                   	pop    %ebp
+  800ac9:	c3                   	ret
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acf:	eb f7                	jmp    800ac8 <strchr+0x24>
+
+00800ad1 <strfind>:
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	53                   	push   %ebx
+  800ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800adb:	0f b6 18             	movzbl (%eax),%ebx
+  800ade:	38 d3                	cmp    %dl,%bl
+  800ae0:	74 14                	je     800af6 <strfind+0x25>
+  800ae2:	89 d1                	mov    %edx,%ecx
+  800ae4:	84 db                	test   %bl,%bl
+  800ae6:	74 0e                	je     800af6 <strfind+0x25>
+  800ae8:	83 c0 01             	add    $0x1,%eax
+  800aeb:	0f b6 10             	movzbl (%eax),%edx
+  800aee:	38 ca                	cmp    %cl,%dl
+  800af0:	74 04                	je     800af6 <strfind+0x25>
+  800af2:	84 d2                	test   %dl,%dl
+  800af4:	75 f2                	jne    800ae8 <strfind+0x17>
+  800af6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af9:	c9                   	leave
+  800afa:	c3                   	ret
+
+00800afb <memset>:
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	57                   	push   %edi
+  800aff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b02:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b05:	85 c9                	test   %ecx,%ecx
+  800b07:	74 20                	je     800b29 <memset+0x2e>
+  800b09:	89 f8                	mov    %edi,%eax
+  800b0b:	09 c8                	or     %ecx,%eax
+  800b0d:	a8 03                	test   $0x3,%al
+  800b0f:	75 12                	jne    800b23 <memset+0x28>
+  800b11:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b15:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800b1b:	c1 e9 02             	shr    $0x2,%ecx
+  800b1e:	fc                   	cld
+  800b1f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b21:	eb 06                	jmp    800b29 <memset+0x2e>
+  800b23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b26:	fc                   	cld
+  800b27:	f3 aa                	rep stos %al,%es:(%edi)
+  800b29:	89 f8                	mov    %edi,%eax
+  800b2b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b2e:	c9                   	leave
+  800b2f:	c3                   	ret
+
+00800b30 <memmove>:
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	57                   	push   %edi
+  800b34:	56                   	push   %esi
+  800b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b38:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b3b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b3e:	39 c6                	cmp    %eax,%esi
+  800b40:	73 32                	jae    800b74 <memmove+0x44>
+  800b42:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b45:	39 d0                	cmp    %edx,%eax
+  800b47:	73 2b                	jae    800b74 <memmove+0x44>
+  800b49:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800b4c:	89 d6                	mov    %edx,%esi
+  800b4e:	09 fe                	or     %edi,%esi
+  800b50:	09 ce                	or     %ecx,%esi
+  800b52:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b58:	75 0e                	jne    800b68 <memmove+0x38>
+  800b5a:	83 ef 04             	sub    $0x4,%edi
+  800b5d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b60:	c1 e9 02             	shr    $0x2,%ecx
+  800b63:	fd                   	std
+  800b64:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b66:	eb 09                	jmp    800b71 <memmove+0x41>
+  800b68:	83 ef 01             	sub    $0x1,%edi
+  800b6b:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b6e:	fd                   	std
+  800b6f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b71:	fc                   	cld
+  800b72:	eb 1a                	jmp    800b8e <memmove+0x5e>
+  800b74:	89 f2                	mov    %esi,%edx
+  800b76:	09 c2                	or     %eax,%edx
+  800b78:	09 ca                	or     %ecx,%edx
+  800b7a:	f6 c2 03             	test   $0x3,%dl
+  800b7d:	75 0a                	jne    800b89 <memmove+0x59>
+  800b7f:	c1 e9 02             	shr    $0x2,%ecx
+  800b82:	89 c7                	mov    %eax,%edi
+  800b84:	fc                   	cld
+  800b85:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b87:	eb 05                	jmp    800b8e <memmove+0x5e>
+  800b89:	89 c7                	mov    %eax,%edi
+  800b8b:	fc                   	cld
+  800b8c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b8e:	5e                   	pop    %esi
+  800b8f:	5f                   	pop    %edi
+  800b90:	5d                   	pop    %ebp
+  800b91:	c3                   	ret
+
+00800b92 <memcpy>:
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	83 ec 0c             	sub    $0xc,%esp
+  800b98:	ff 75 10             	push   0x10(%ebp)
+  800b9b:	ff 75 0c             	push   0xc(%ebp)
+  800b9e:	ff 75 08             	push   0x8(%ebp)
+  800ba1:	e8 8a ff ff ff       	call   800b30 <memmove>
+  800ba6:	c9                   	leave
+  800ba7:	c3                   	ret
+
+00800ba8 <memcmp>:
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+  800bad:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bb3:	8b 75 10             	mov    0x10(%ebp),%esi
+  800bb6:	85 f6                	test   %esi,%esi
+  800bb8:	74 29                	je     800be3 <memcmp+0x3b>
+  800bba:	01 c6                	add    %eax,%esi
+  800bbc:	0f b6 08             	movzbl (%eax),%ecx
+  800bbf:	0f b6 1a             	movzbl (%edx),%ebx
+  800bc2:	38 d9                	cmp    %bl,%cl
+  800bc4:	75 11                	jne    800bd7 <memcmp+0x2f>
+  800bc6:	83 c0 01             	add    $0x1,%eax
+  800bc9:	83 c2 01             	add    $0x1,%edx
+  800bcc:	39 c6                	cmp    %eax,%esi
+  800bce:	75 ec                	jne    800bbc <memcmp+0x14>
+  800bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd5:	eb 08                	jmp    800bdf <memcmp+0x37>
+  800bd7:	0f b6 c1             	movzbl %cl,%eax
+  800bda:	0f b6 db             	movzbl %bl,%ebx
+  800bdd:	29 d8                	sub    %ebx,%eax
+  800bdf:	5b                   	pop    %ebx
+  800be0:	5e                   	pop    %esi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be8:	eb f5                	jmp    800bdf <memcmp+0x37>
+
+00800bea <memfind>:
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf3:	89 c2                	mov    %eax,%edx
+  800bf5:	03 55 10             	add    0x10(%ebp),%edx
+  800bf8:	39 d0                	cmp    %edx,%eax
+  800bfa:	73 0d                	jae    800c09 <memfind+0x1f>
+  800bfc:	38 08                	cmp    %cl,(%eax)
+  800bfe:	74 0d                	je     800c0d <memfind+0x23>
+  800c00:	83 c0 01             	add    $0x1,%eax
+  800c03:	39 c2                	cmp    %eax,%edx
+  800c05:	75 f5                	jne    800bfc <memfind+0x12>
+  800c07:	eb 06                	jmp    800c0f <memfind+0x25>
+  800c09:	89 c2                	mov    %eax,%edx
+  800c0b:	eb 02                	jmp    800c0f <memfind+0x25>
+  800c0d:	89 c2                	mov    %eax,%edx
+  800c0f:	89 d0                	mov    %edx,%eax
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+
+00800c13 <strtol>:
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	57                   	push   %edi
+  800c17:	56                   	push   %esi
+  800c18:	53                   	push   %ebx
+  800c19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c1f:	0f b6 02             	movzbl (%edx),%eax
+  800c22:	3c 20                	cmp    $0x20,%al
+  800c24:	74 04                	je     800c2a <strtol+0x17>
+  800c26:	3c 09                	cmp    $0x9,%al
+  800c28:	75 0e                	jne    800c38 <strtol+0x25>
+  800c2a:	83 c2 01             	add    $0x1,%edx
+  800c2d:	0f b6 02             	movzbl (%edx),%eax
+  800c30:	3c 20                	cmp    $0x20,%al
+  800c32:	74 f6                	je     800c2a <strtol+0x17>
+  800c34:	3c 09                	cmp    $0x9,%al
+  800c36:	74 f2                	je     800c2a <strtol+0x17>
+  800c38:	3c 2b                	cmp    $0x2b,%al
+  800c3a:	74 2a                	je     800c66 <strtol+0x53>
+  800c3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c41:	3c 2d                	cmp    $0x2d,%al
+  800c43:	74 2b                	je     800c70 <strtol+0x5d>
+  800c45:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c4b:	75 0f                	jne    800c5c <strtol+0x49>
+  800c4d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c50:	74 28                	je     800c7a <strtol+0x67>
+  800c52:	85 db                	test   %ebx,%ebx
+  800c54:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c59:	0f 44 d8             	cmove  %eax,%ebx
+  800c5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c61:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c64:	eb 46                	jmp    800cac <strtol+0x99>
+  800c66:	83 c2 01             	add    $0x1,%edx
+  800c69:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6e:	eb d5                	jmp    800c45 <strtol+0x32>
+  800c70:	83 c2 01             	add    $0x1,%edx
+  800c73:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c78:	eb cb                	jmp    800c45 <strtol+0x32>
+  800c7a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c7e:	74 0e                	je     800c8e <strtol+0x7b>
+  800c80:	85 db                	test   %ebx,%ebx
+  800c82:	75 d8                	jne    800c5c <strtol+0x49>
+  800c84:	83 c2 01             	add    $0x1,%edx
+  800c87:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c8c:	eb ce                	jmp    800c5c <strtol+0x49>
+  800c8e:	83 c2 02             	add    $0x2,%edx
+  800c91:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c96:	eb c4                	jmp    800c5c <strtol+0x49>
+  800c98:	0f be c0             	movsbl %al,%eax
+  800c9b:	83 e8 30             	sub    $0x30,%eax
+  800c9e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ca1:	7d 3a                	jge    800cdd <strtol+0xca>
+  800ca3:	83 c2 01             	add    $0x1,%edx
+  800ca6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800caa:	01 c1                	add    %eax,%ecx
+  800cac:	0f b6 02             	movzbl (%edx),%eax
+  800caf:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cb2:	89 f3                	mov    %esi,%ebx
+  800cb4:	80 fb 09             	cmp    $0x9,%bl
+  800cb7:	76 df                	jbe    800c98 <strtol+0x85>
+  800cb9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cbc:	89 f3                	mov    %esi,%ebx
+  800cbe:	80 fb 19             	cmp    $0x19,%bl
+  800cc1:	77 08                	ja     800ccb <strtol+0xb8>
+  800cc3:	0f be c0             	movsbl %al,%eax
+  800cc6:	83 e8 57             	sub    $0x57,%eax
+  800cc9:	eb d3                	jmp    800c9e <strtol+0x8b>
+  800ccb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cce:	89 f3                	mov    %esi,%ebx
+  800cd0:	80 fb 19             	cmp    $0x19,%bl
+  800cd3:	77 08                	ja     800cdd <strtol+0xca>
+  800cd5:	0f be c0             	movsbl %al,%eax
+  800cd8:	83 e8 37             	sub    $0x37,%eax
+  800cdb:	eb c1                	jmp    800c9e <strtol+0x8b>
+  800cdd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ce1:	74 05                	je     800ce8 <strtol+0xd5>
+  800ce3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce6:	89 10                	mov    %edx,(%eax)
+  800ce8:	89 c8                	mov    %ecx,%eax
+  800cea:	f7 d8                	neg    %eax
+  800cec:	85 ff                	test   %edi,%edi
+  800cee:	0f 45 c8             	cmovne %eax,%ecx
+  800cf1:	89 c8                	mov    %ecx,%eax
+  800cf3:	5b                   	pop    %ebx
+  800cf4:	5e                   	pop    %esi
+  800cf5:	5f                   	pop    %edi
+  800cf6:	5d                   	pop    %ebp
+  800cf7:	c3                   	ret
+
+00800cf8 <sys_cputs>:
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	57                   	push   %edi
+  800cfc:	56                   	push   %esi
+  800cfd:	53                   	push   %ebx
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d09:	89 c3                	mov    %eax,%ebx
+  800d0b:	89 c7                	mov    %eax,%edi
+  800d0d:	89 c6                	mov    %eax,%esi
+  800d0f:	cd 30                	int    $0x30
+  800d11:	5b                   	pop    %ebx
+  800d12:	5e                   	pop    %esi
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+
+00800d16 <sys_cgetc>:
+  800d16:	55                   	push   %ebp
+  800d17:	89 e5                	mov    %esp,%ebp
+  800d19:	57                   	push   %edi
+  800d1a:	56                   	push   %esi
+  800d1b:	53                   	push   %ebx
+  800d1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d21:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d26:	89 d1                	mov    %edx,%ecx
+  800d28:	89 d3                	mov    %edx,%ebx
+  800d2a:	89 d7                	mov    %edx,%edi
+  800d2c:	89 d6                	mov    %edx,%esi
+  800d2e:	cd 30                	int    $0x30
+  800d30:	5b                   	pop    %ebx
+  800d31:	5e                   	pop    %esi
+  800d32:	5f                   	pop    %edi
+  800d33:	5d                   	pop    %ebp
+  800d34:	c3                   	ret
+
+00800d35 <sys_env_destroy>:
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	57                   	push   %edi
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	83 ec 0c             	sub    $0xc,%esp
+  800d3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d46:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d4b:	89 cb                	mov    %ecx,%ebx
+  800d4d:	89 cf                	mov    %ecx,%edi
+  800d4f:	89 ce                	mov    %ecx,%esi
+  800d51:	cd 30                	int    $0x30
+  800d53:	85 c0                	test   %eax,%eax
+  800d55:	7f 08                	jg     800d5f <sys_env_destroy+0x2a>
+  800d57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+  800d5f:	83 ec 0c             	sub    $0xc,%esp
+  800d62:	50                   	push   %eax
+  800d63:	6a 03                	push   $0x3
+  800d65:	68 0b 37 80 00       	push   $0x80370b
+  800d6a:	6a 24                	push   $0x24
+  800d6c:	68 28 37 80 00       	push   $0x803728
+  800d71:	e8 38 f4 ff ff       	call   8001ae <_panic>
+
+00800d76 <sys_getenvid>:
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	57                   	push   %edi
+  800d7a:	56                   	push   %esi
+  800d7b:	53                   	push   %ebx
+  800d7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d81:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d86:	89 d1                	mov    %edx,%ecx
+  800d88:	89 d3                	mov    %edx,%ebx
+  800d8a:	89 d7                	mov    %edx,%edi
+  800d8c:	89 d6                	mov    %edx,%esi
+  800d8e:	cd 30                	int    $0x30
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+
+00800d95 <sys_yield>:
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	57                   	push   %edi
+  800d99:	56                   	push   %esi
+  800d9a:	53                   	push   %ebx
+  800d9b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800da2:	74 26                	je     800dca <sys_yield+0x35>
+  800da4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dae:	89 d1                	mov    %edx,%ecx
+  800db0:	89 d3                	mov    %edx,%ebx
+  800db2:	89 d7                	mov    %edx,%edi
+  800db4:	6a 00                	push   $0x0
+  800db6:	55                   	push   %ebp
+  800db7:	89 e5                	mov    %esp,%ebp
+  800db9:	8d 35 c1 0d 80 00    	lea    0x800dc1,%esi
+  800dbf:	0f 34                	sysenter
+  800dc1:	5d                   	pop    %ebp
+  800dc2:	83 c4 04             	add    $0x4,%esp
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd4:	89 d1                	mov    %edx,%ecx
+  800dd6:	89 d3                	mov    %edx,%ebx
+  800dd8:	89 d7                	mov    %edx,%edi
+  800dda:	89 d6                	mov    %edx,%esi
+  800ddc:	cd 30                	int    $0x30
+  800dde:	eb e5                	jmp    800dc5 <sys_yield+0x30>
+
+00800de0 <sys_page_alloc>:
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+  800de6:	83 ec 0c             	sub    $0xc,%esp
+  800de9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfc:	89 f7                	mov    %esi,%edi
+  800dfe:	cd 30                	int    $0x30
+  800e00:	85 c0                	test   %eax,%eax
+  800e02:	7f 08                	jg     800e0c <sys_page_alloc+0x2c>
+  800e04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e07:	5b                   	pop    %ebx
+  800e08:	5e                   	pop    %esi
+  800e09:	5f                   	pop    %edi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+  800e0f:	50                   	push   %eax
+  800e10:	6a 04                	push   $0x4
+  800e12:	68 0b 37 80 00       	push   $0x80370b
+  800e17:	6a 24                	push   $0x24
+  800e19:	68 28 37 80 00       	push   $0x803728
+  800e1e:	e8 8b f3 ff ff       	call   8001ae <_panic>
+
+00800e23 <sys_page_map>:
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	57                   	push   %edi
+  800e27:	56                   	push   %esi
+  800e28:	53                   	push   %ebx
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e33:	74 33                	je     800e68 <sys_page_map+0x45>
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e43:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e46:	ff 75 18             	push   0x18(%ebp)
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	8d 35 54 0e 80 00    	lea    0x800e54,%esi
+  800e52:	0f 34                	sysenter
+  800e54:	5d                   	pop    %ebp
+  800e55:	83 c4 04             	add    $0x4,%esp
+  800e58:	89 c2                	mov    %eax,%edx
+  800e5a:	85 c0                	test   %eax,%eax
+  800e5c:	7f 3d                	jg     800e9b <sys_page_map+0x78>
+  800e5e:	89 d0                	mov    %edx,%eax
+  800e60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e63:	5b                   	pop    %ebx
+  800e64:	5e                   	pop    %esi
+  800e65:	5f                   	pop    %edi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+  800e68:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e76:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e79:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e7c:	cd 30                	int    $0x30
+  800e7e:	89 c2                	mov    %eax,%edx
+  800e80:	85 c0                	test   %eax,%eax
+  800e82:	7e da                	jle    800e5e <sys_page_map+0x3b>
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+  800e87:	50                   	push   %eax
+  800e88:	6a 05                	push   $0x5
+  800e8a:	68 0b 37 80 00       	push   $0x80370b
+  800e8f:	6a 24                	push   $0x24
+  800e91:	68 28 37 80 00       	push   $0x803728
+  800e96:	e8 13 f3 ff ff       	call   8001ae <_panic>
+  800e9b:	83 ec 0c             	sub    $0xc,%esp
+  800e9e:	50                   	push   %eax
+  800e9f:	6a 05                	push   $0x5
+  800ea1:	68 0b 37 80 00       	push   $0x80370b
+  800ea6:	6a 48                	push   $0x48
+  800ea8:	68 28 37 80 00       	push   $0x803728
+  800ead:	e8 fc f2 ff ff       	call   8001ae <_panic>
+
+00800eb2 <sys_page_unmap>:
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+  800eb8:	83 ec 0c             	sub    $0xc,%esp
+  800ebb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ecb:	89 df                	mov    %ebx,%edi
+  800ecd:	89 de                	mov    %ebx,%esi
+  800ecf:	cd 30                	int    $0x30
+  800ed1:	85 c0                	test   %eax,%eax
+  800ed3:	7f 08                	jg     800edd <sys_page_unmap+0x2b>
+  800ed5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed8:	5b                   	pop    %ebx
+  800ed9:	5e                   	pop    %esi
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+  800edd:	83 ec 0c             	sub    $0xc,%esp
+  800ee0:	50                   	push   %eax
+  800ee1:	6a 06                	push   $0x6
+  800ee3:	68 0b 37 80 00       	push   $0x80370b
+  800ee8:	6a 24                	push   $0x24
+  800eea:	68 28 37 80 00       	push   $0x803728
+  800eef:	e8 ba f2 ff ff       	call   8001ae <_panic>
+
+00800ef4 <sys_fork>:
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+  800efa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eff:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f04:	89 d1                	mov    %edx,%ecx
+  800f06:	89 d3                	mov    %edx,%ebx
+  800f08:	89 d7                	mov    %edx,%edi
+  800f0a:	89 d6                	mov    %edx,%esi
+  800f0c:	cd 30                	int    $0x30
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <sys_env_set_status>:
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+  800f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f2c:	89 df                	mov    %ebx,%edi
+  800f2e:	89 de                	mov    %ebx,%esi
+  800f30:	cd 30                	int    $0x30
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7f 08                	jg     800f3e <sys_env_set_status+0x2b>
+  800f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  800f41:	50                   	push   %eax
+  800f42:	6a 08                	push   $0x8
+  800f44:	68 0b 37 80 00       	push   $0x80370b
+  800f49:	6a 24                	push   $0x24
+  800f4b:	68 28 37 80 00       	push   $0x803728
+  800f50:	e8 59 f2 ff ff       	call   8001ae <_panic>
+
+00800f55 <sys_env_set_trapframe>:
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  800f5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f69:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f6e:	89 df                	mov    %ebx,%edi
+  800f70:	89 de                	mov    %ebx,%esi
+  800f72:	cd 30                	int    $0x30
+  800f74:	85 c0                	test   %eax,%eax
+  800f76:	7f 08                	jg     800f80 <sys_env_set_trapframe+0x2b>
+  800f78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7b:	5b                   	pop    %ebx
+  800f7c:	5e                   	pop    %esi
+  800f7d:	5f                   	pop    %edi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+  800f80:	83 ec 0c             	sub    $0xc,%esp
+  800f83:	50                   	push   %eax
+  800f84:	6a 09                	push   $0x9
+  800f86:	68 0b 37 80 00       	push   $0x80370b
+  800f8b:	6a 24                	push   $0x24
+  800f8d:	68 28 37 80 00       	push   $0x803728
+  800f92:	e8 17 f2 ff ff       	call   8001ae <_panic>
+
+00800f97 <sys_env_set_cow>:
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	56                   	push   %esi
+  800f9c:	53                   	push   %ebx
+  800f9d:	83 ec 0c             	sub    $0xc,%esp
+  800fa0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fab:	b8 20 00 00 00       	mov    $0x20,%eax
+  800fb0:	89 df                	mov    %ebx,%edi
+  800fb2:	89 de                	mov    %ebx,%esi
+  800fb4:	cd 30                	int    $0x30
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	7f 08                	jg     800fc2 <sys_env_set_cow+0x2b>
+  800fba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbd:	5b                   	pop    %ebx
+  800fbe:	5e                   	pop    %esi
+  800fbf:	5f                   	pop    %edi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+  800fc5:	50                   	push   %eax
+  800fc6:	6a 20                	push   $0x20
+  800fc8:	68 0b 37 80 00       	push   $0x80370b
+  800fcd:	6a 24                	push   $0x24
+  800fcf:	68 28 37 80 00       	push   $0x803728
+  800fd4:	e8 d5 f1 ff ff       	call   8001ae <_panic>
+
+00800fd9 <sys_env_service>:
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	57                   	push   %edi
+  800fdd:	56                   	push   %esi
+  800fde:	53                   	push   %ebx
+  800fdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe7:	b8 21 00 00 00       	mov    $0x21,%eax
+  800fec:	89 cb                	mov    %ecx,%ebx
+  800fee:	89 cf                	mov    %ecx,%edi
+  800ff0:	89 ce                	mov    %ecx,%esi
+  800ff2:	cd 30                	int    $0x30
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <sys_env_set_pgfault_upcall>:
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_env_set_pgfault_upcall+0x2b>
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 0a                	push   $0xa
+  80102a:	68 0b 37 80 00       	push   $0x80370b
+  80102f:	6a 24                	push   $0x24
+  801031:	68 28 37 80 00       	push   $0x803728
+  801036:	e8 73 f1 ff ff       	call   8001ae <_panic>
+
+0080103b <sys_ipc_try_send>:
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801048:	74 27                	je     801071 <sys_ipc_try_send+0x36>
+  80104a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801050:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801055:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801058:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80105b:	6a 00                	push   $0x0
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	8d 35 68 10 80 00    	lea    0x801068,%esi
+  801066:	0f 34                	sysenter
+  801068:	5d                   	pop    %ebp
+  801069:	83 c4 04             	add    $0x4,%esp
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5f                   	pop    %edi
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+  801071:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801076:	be 00 00 00 00       	mov    $0x0,%esi
+  80107b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801081:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801084:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801087:	cd 30                	int    $0x30
+  801089:	eb e1                	jmp    80106c <sys_ipc_try_send+0x31>
+
+0080108b <sys_ipc_recv>:
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	57                   	push   %edi
+  80108f:	56                   	push   %esi
+  801090:	53                   	push   %ebx
+  801091:	83 ec 0c             	sub    $0xc,%esp
+  801094:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80109b:	74 32                	je     8010cf <sys_ipc_recv+0x44>
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010aa:	89 cb                	mov    %ecx,%ebx
+  8010ac:	89 cf                	mov    %ecx,%edi
+  8010ae:	6a 00                	push   $0x0
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	8d 35 bb 10 80 00    	lea    0x8010bb,%esi
+  8010b9:	0f 34                	sysenter
+  8010bb:	5d                   	pop    %ebp
+  8010bc:	83 c4 04             	add    $0x4,%esp
+  8010bf:	89 c2                	mov    %eax,%edx
+  8010c1:	85 c0                	test   %eax,%eax
+  8010c3:	7f 3c                	jg     801101 <sys_ipc_recv+0x76>
+  8010c5:	89 d0                	mov    %edx,%eax
+  8010c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5e                   	pop    %esi
+  8010cc:	5f                   	pop    %edi
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	c3                   	ret
+  8010cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dc:	89 cb                	mov    %ecx,%ebx
+  8010de:	89 cf                	mov    %ecx,%edi
+  8010e0:	89 ce                	mov    %ecx,%esi
+  8010e2:	cd 30                	int    $0x30
+  8010e4:	89 c2                	mov    %eax,%edx
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	7e db                	jle    8010c5 <sys_ipc_recv+0x3a>
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+  8010ed:	50                   	push   %eax
+  8010ee:	6a 0d                	push   $0xd
+  8010f0:	68 0b 37 80 00       	push   $0x80370b
+  8010f5:	6a 24                	push   $0x24
+  8010f7:	68 28 37 80 00       	push   $0x803728
+  8010fc:	e8 ad f0 ff ff       	call   8001ae <_panic>
+  801101:	83 ec 0c             	sub    $0xc,%esp
+  801104:	50                   	push   %eax
+  801105:	6a 0d                	push   $0xd
+  801107:	68 0b 37 80 00       	push   $0x80370b
+  80110c:	6a 48                	push   $0x48
+  80110e:	68 28 37 80 00       	push   $0x803728
+  801113:	e8 96 f0 ff ff       	call   8001ae <_panic>
+
+00801118 <sys_ipc_send>:
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  80111e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801125:	74 27                	je     80114e <sys_ipc_send+0x36>
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801132:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801135:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801138:	6a 00                	push   $0x0
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	8d 35 45 11 80 00    	lea    0x801145,%esi
+  801143:	0f 34                	sysenter
+  801145:	5d                   	pop    %ebp
+  801146:	83 c4 04             	add    $0x4,%esp
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5f                   	pop    %edi
+  80114c:	5d                   	pop    %ebp
+  80114d:	c3                   	ret
+  80114e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801153:	be 00 00 00 00       	mov    $0x0,%esi
+  801158:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801161:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801164:	cd 30                	int    $0x30
+  801166:	eb e1                	jmp    801149 <sys_ipc_send+0x31>
+
+00801168 <sys_ipc_call>:
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	57                   	push   %edi
+  80116c:	56                   	push   %esi
+  80116d:	53                   	push   %ebx
+  80116e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801171:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801174:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801179:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801182:	cd 30                	int    $0x30
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_ipc_reply_recv>:
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801192:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801195:	b8 10 00 00 00       	mov    $0x10,%eax
+  80119a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a3:	cd 30                	int    $0x30
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+
+008011aa <sys_time_msec>:
+  8011aa:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	75 06                	jne    8011b9 <sys_time_msec+0xf>
+  8011b3:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8011b8:	c3                   	ret
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+  8011bf:	83 ec 0c             	sub    $0xc,%esp
+  8011c2:	0f 31                	rdtsc
+  8011c4:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8011ca:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8011d0:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8011d6:	29 c8                	sub    %ecx,%eax
+  8011d8:	19 da                	sbb    %ebx,%edx
+  8011da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011df:	57                   	push   %edi
+  8011e0:	56                   	push   %esi
+  8011e1:	52                   	push   %edx
+  8011e2:	50                   	push   %eax
+  8011e3:	e8 5f 20 00 00       	call   803247 <__udivdi3>
+  8011e8:	83 c4 10             	add    $0x10,%esp
+  8011eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ee:	5b                   	pop    %ebx
+  8011ef:	5e                   	pop    %esi
+  8011f0:	5f                   	pop    %edi
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+
+008011f3 <sys_env_swap>:
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	57                   	push   %edi
+  8011f7:	56                   	push   %esi
+  8011f8:	53                   	push   %ebx
+  8011f9:	83 ec 0c             	sub    $0xc,%esp
+  8011fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801201:	8b 55 08             	mov    0x8(%ebp),%edx
+  801204:	b8 12 00 00 00       	mov    $0x12,%eax
+  801209:	89 cb                	mov    %ecx,%ebx
+  80120b:	89 cf                	mov    %ecx,%edi
+  80120d:	89 ce                	mov    %ecx,%esi
+  80120f:	cd 30                	int    $0x30
+  801211:	85 c0                	test   %eax,%eax
+  801213:	7f 08                	jg     80121d <sys_env_swap+0x2a>
+  801215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801218:	5b                   	pop    %ebx
+  801219:	5e                   	pop    %esi
+  80121a:	5f                   	pop    %edi
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+  80121d:	83 ec 0c             	sub    $0xc,%esp
+  801220:	50                   	push   %eax
+  801221:	6a 12                	push   $0x12
+  801223:	68 0b 37 80 00       	push   $0x80370b
+  801228:	6a 24                	push   $0x24
+  80122a:	68 28 37 80 00       	push   $0x803728
+  80122f:	e8 7a ef ff ff       	call   8001ae <_panic>
+
+00801234 <sys_net_try_send>:
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	57                   	push   %edi
+  801238:	56                   	push   %esi
+  801239:	53                   	push   %ebx
+  80123a:	83 ec 0c             	sub    $0xc,%esp
+  80123d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801242:	8b 55 08             	mov    0x8(%ebp),%edx
+  801245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801248:	b8 13 00 00 00       	mov    $0x13,%eax
+  80124d:	89 df                	mov    %ebx,%edi
+  80124f:	89 de                	mov    %ebx,%esi
+  801251:	cd 30                	int    $0x30
+  801253:	85 c0                	test   %eax,%eax
+  801255:	7f 08                	jg     80125f <sys_net_try_send+0x2b>
+  801257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125a:	5b                   	pop    %ebx
+  80125b:	5e                   	pop    %esi
+  80125c:	5f                   	pop    %edi
+  80125d:	5d                   	pop    %ebp
+  80125e:	c3                   	ret
+  80125f:	83 ec 0c             	sub    $0xc,%esp
+  801262:	50                   	push   %eax
+  801263:	6a 13                	push   $0x13
+  801265:	68 0b 37 80 00       	push   $0x80370b
+  80126a:	6a 24                	push   $0x24
+  80126c:	68 28 37 80 00       	push   $0x803728
+  801271:	e8 38 ef ff ff       	call   8001ae <_panic>
+
+00801276 <sys_net_try_receive>:
+  801276:	55                   	push   %ebp
+  801277:	89 e5                	mov    %esp,%ebp
+  801279:	57                   	push   %edi
+  80127a:	56                   	push   %esi
+  80127b:	53                   	push   %ebx
+  80127c:	83 ec 0c             	sub    $0xc,%esp
+  80127f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801284:	8b 55 08             	mov    0x8(%ebp),%edx
+  801287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80128f:	89 df                	mov    %ebx,%edi
+  801291:	89 de                	mov    %ebx,%esi
+  801293:	cd 30                	int    $0x30
+  801295:	85 c0                	test   %eax,%eax
+  801297:	7f 08                	jg     8012a1 <sys_net_try_receive+0x2b>
+  801299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129c:	5b                   	pop    %ebx
+  80129d:	5e                   	pop    %esi
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	50                   	push   %eax
+  8012a5:	6a 14                	push   $0x14
+  8012a7:	68 0b 37 80 00       	push   $0x80370b
+  8012ac:	6a 24                	push   $0x24
+  8012ae:	68 28 37 80 00       	push   $0x803728
+  8012b3:	e8 f6 ee ff ff       	call   8001ae <_panic>
+
+008012b8 <sys_net_recv_page>:
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	57                   	push   %edi
+  8012bc:	56                   	push   %esi
+  8012bd:	53                   	push   %ebx
+  8012be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c6:	b8 27 00 00 00       	mov    $0x27,%eax
+  8012cb:	89 cb                	mov    %ecx,%ebx
+  8012cd:	89 cf                	mov    %ecx,%edi
+  8012cf:	89 ce                	mov    %ecx,%esi
+  8012d1:	cd 30                	int    $0x30
+  8012d3:	5b                   	pop    %ebx
+  8012d4:	5e                   	pop    %esi
+  8012d5:	5f                   	pop    %edi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	c3                   	ret
+
+008012d8 <sys_net_wait>:
+  8012d8:	55                   	push   %ebp
+  8012d9:	89 e5                	mov    %esp,%ebp
+  8012db:	57                   	push   %edi
+  8012dc:	56                   	push   %esi
+  8012dd:	53                   	push   %ebx
+  8012de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e3:	b8 26 00 00 00       	mov    $0x26,%eax
+  8012e8:	89 d1                	mov    %edx,%ecx
+  8012ea:	89 d3                	mov    %edx,%ebx
+  8012ec:	89 d7                	mov    %edx,%edi
+  8012ee:	89 d6                	mov    %edx,%esi
+  8012f0:	cd 30                	int    $0x30
+  8012f2:	5b                   	pop    %ebx
+  8012f3:	5e                   	pop    %esi
+  8012f4:	5f                   	pop    %edi
+  8012f5:	5d                   	pop    %ebp
+  8012f6:	c3                   	ret
+
+008012f7 <sys_get_mac>:
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	57                   	push   %edi
+  8012fb:	56                   	push   %esi
+  8012fc:	53                   	push   %ebx
+  8012fd:	83 ec 0c             	sub    $0xc,%esp
+  801300:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801305:	8b 55 08             	mov    0x8(%ebp),%edx
+  801308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801310:	89 df                	mov    %ebx,%edi
+  801312:	89 de                	mov    %ebx,%esi
+  801314:	cd 30                	int    $0x30
+  801316:	85 c0                	test   %eax,%eax
+  801318:	7f 08                	jg     801322 <sys_get_mac+0x2b>
+  80131a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131d:	5b                   	pop    %ebx
+  80131e:	5e                   	pop    %esi
+  80131f:	5f                   	pop    %edi
+  801320:	5d                   	pop    %ebp
+  801321:	c3                   	ret
+  801322:	83 ec 0c             	sub    $0xc,%esp
+  801325:	50                   	push   %eax
+  801326:	6a 15                	push   $0x15
+  801328:	68 0b 37 80 00       	push   $0x80370b
+  80132d:	6a 24                	push   $0x24
+  80132f:	68 28 37 80 00       	push   $0x803728
+  801334:	e8 75 ee ff ff       	call   8001ae <_panic>
+
+00801339 <sys_env_lease>:
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	57                   	push   %edi
+  80133d:	56                   	push   %esi
+  80133e:	53                   	push   %ebx
+  80133f:	83 ec 0c             	sub    $0xc,%esp
+  801342:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801347:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801352:	89 df                	mov    %ebx,%edi
+  801354:	89 de                	mov    %ebx,%esi
+  801356:	cd 30                	int    $0x30
+  801358:	85 c0                	test   %eax,%eax
+  80135a:	7f 08                	jg     801364 <sys_env_lease+0x2b>
+  80135c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135f:	5b                   	pop    %ebx
+  801360:	5e                   	pop    %esi
+  801361:	5f                   	pop    %edi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+  801364:	83 ec 0c             	sub    $0xc,%esp
+  801367:	50                   	push   %eax
+  801368:	6a 16                	push   $0x16
+  80136a:	68 0b 37 80 00       	push   $0x80370b
+  80136f:	6a 24                	push   $0x24
+  801371:	68 28 37 80 00       	push   $0x803728
+  801376:	e8 33 ee ff ff       	call   8001ae <_panic>
+
+0080137b <sys_copy_mem>:
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	57                   	push   %edi
+  80137f:	56                   	push   %esi
+  801380:	53                   	push   %ebx
+  801381:	83 ec 0c             	sub    $0xc,%esp
+  801384:	8b 55 08             	mov    0x8(%ebp),%edx
+  801387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80138f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801392:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801395:	8b 75 18             	mov    0x18(%ebp),%esi
+  801398:	cd 30                	int    $0x30
+  80139a:	85 c0                	test   %eax,%eax
+  80139c:	7f 08                	jg     8013a6 <sys_copy_mem+0x2b>
+  80139e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a1:	5b                   	pop    %ebx
+  8013a2:	5e                   	pop    %esi
+  8013a3:	5f                   	pop    %edi
+  8013a4:	5d                   	pop    %ebp
+  8013a5:	c3                   	ret
+  8013a6:	83 ec 0c             	sub    $0xc,%esp
+  8013a9:	50                   	push   %eax
+  8013aa:	6a 17                	push   $0x17
+  8013ac:	68 0b 37 80 00       	push   $0x80370b
+  8013b1:	6a 24                	push   $0x24
+  8013b3:	68 28 37 80 00       	push   $0x803728
+  8013b8:	e8 f1 ed ff ff       	call   8001ae <_panic>
+
+008013bd <sys_get_perms>:
+  8013bd:	55                   	push   %ebp
+  8013be:	89 e5                	mov    %esp,%ebp
+  8013c0:	57                   	push   %edi
+  8013c1:	56                   	push   %esi
+  8013c2:	53                   	push   %ebx
+  8013c3:	83 ec 0c             	sub    $0xc,%esp
+  8013c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d9:	89 f7                	mov    %esi,%edi
+  8013db:	cd 30                	int    $0x30
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	7f 08                	jg     8013e9 <sys_get_perms+0x2c>
+  8013e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e4:	5b                   	pop    %ebx
+  8013e5:	5e                   	pop    %esi
+  8013e6:	5f                   	pop    %edi
+  8013e7:	5d                   	pop    %ebp
+  8013e8:	c3                   	ret
+  8013e9:	83 ec 0c             	sub    $0xc,%esp
+  8013ec:	50                   	push   %eax
+  8013ed:	6a 18                	push   $0x18
+  8013ef:	68 0b 37 80 00       	push   $0x80370b
+  8013f4:	6a 24                	push   $0x24
+  8013f6:	68 28 37 80 00       	push   $0x803728
+  8013fb:	e8 ae ed ff ff       	call   8001ae <_panic>
+
+00801400 <sys_env_unsuspend>:
+  801400:	55                   	push   %ebp
+  801401:	89 e5                	mov    %esp,%ebp
+  801403:	57                   	push   %edi
+  801404:	56                   	push   %esi
+  801405:	53                   	push   %ebx
+  801406:	83 ec 0c             	sub    $0xc,%esp
+  801409:	be 00 00 00 00       	mov    $0x0,%esi
+  80140e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801411:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801414:	b8 19 00 00 00       	mov    $0x19,%eax
+  801419:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80141c:	89 f7                	mov    %esi,%edi
+  80141e:	cd 30                	int    $0x30
+  801420:	85 c0                	test   %eax,%eax
+  801422:	7f 08                	jg     80142c <sys_env_unsuspend+0x2c>
+  801424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801427:	5b                   	pop    %ebx
+  801428:	5e                   	pop    %esi
+  801429:	5f                   	pop    %edi
+  80142a:	5d                   	pop    %ebp
+  80142b:	c3                   	ret
+  80142c:	83 ec 0c             	sub    $0xc,%esp
+  80142f:	50                   	push   %eax
+  801430:	6a 19                	push   $0x19
+  801432:	68 0b 37 80 00       	push   $0x80370b
+  801437:	6a 24                	push   $0x24
+  801439:	68 28 37 80 00       	push   $0x803728
+  80143e:	e8 6b ed ff ff       	call   8001ae <_panic>
+
+00801443 <sys_migrate>:
+  801443:	55                   	push   %ebp
+  801444:	89 e5                	mov    %esp,%ebp
+  801446:	57                   	push   %edi
+  801447:	56                   	push   %esi
+  801448:	53                   	push   %ebx
+  801449:	83 ec 0c             	sub    $0xc,%esp
+  80144c:	ba 00 a0 80 00       	mov    $0x80a000,%edx
+  801451:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801457:	76 11                	jbe    80146a <sys_migrate+0x27>
+  801459:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80145e:	0f b6 08             	movzbl (%eax),%ecx
+  801461:	05 00 10 00 00       	add    $0x1000,%eax
+  801466:	39 d0                	cmp    %edx,%eax
+  801468:	72 f4                	jb     80145e <sys_migrate+0x1b>
+  80146a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801472:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801477:	89 cb                	mov    %ecx,%ebx
+  801479:	89 cf                	mov    %ecx,%edi
+  80147b:	89 ce                	mov    %ecx,%esi
+  80147d:	cd 30                	int    $0x30
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	7f 08                	jg     80148b <sys_migrate+0x48>
+  801483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801486:	5b                   	pop    %ebx
+  801487:	5e                   	pop    %esi
+  801488:	5f                   	pop    %edi
+  801489:	5d                   	pop    %ebp
+  80148a:	c3                   	ret
+  80148b:	83 ec 0c             	sub    $0xc,%esp
+  80148e:	50                   	push   %eax
+  80148f:	6a 1a                	push   $0x1a
+  801491:	68 0b 37 80 00       	push   $0x80370b
+  801496:	6a 24                	push   $0x24
+  801498:	68 28 37 80 00       	push   $0x803728
+  80149d:	e8 0c ed ff ff       	call   8001ae <_panic>
+
+008014a2 <sys_lease_complete>:
+  8014a2:	55                   	push   %ebp
+  8014a3:	89 e5                	mov    %esp,%ebp
+  8014a5:	57                   	push   %edi
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	83 ec 0c             	sub    $0xc,%esp
+  8014ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014b5:	89 d1                	mov    %edx,%ecx
+  8014b7:	89 d3                	mov    %edx,%ebx
+  8014b9:	89 d7                	mov    %edx,%edi
+  8014bb:	89 d6                	mov    %edx,%esi
+  8014bd:	cd 30                	int    $0x30
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	7f 08                	jg     8014cb <sys_lease_complete+0x29>
+  8014c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c6:	5b                   	pop    %ebx
+  8014c7:	5e                   	pop    %esi
+  8014c8:	5f                   	pop    %edi
+  8014c9:	5d                   	pop    %ebp
+  8014ca:	c3                   	ret
+  8014cb:	83 ec 0c             	sub    $0xc,%esp
+  8014ce:	50                   	push   %eax
+  8014cf:	6a 1b                	push   $0x1b
+  8014d1:	68 0b 37 80 00       	push   $0x80370b
+  8014d6:	6a 24                	push   $0x24
+  8014d8:	68 28 37 80 00       	push   $0x803728
+  8014dd:	e8 cc ec ff ff       	call   8001ae <_panic>
+
+008014e2 <sys_env_set_thisenv>:
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	57                   	push   %edi
+  8014e6:	56                   	push   %esi
+  8014e7:	53                   	push   %ebx
+  8014e8:	83 ec 0c             	sub    $0xc,%esp
+  8014eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014fb:	89 df                	mov    %ebx,%edi
+  8014fd:	89 de                	mov    %ebx,%esi
+  8014ff:	cd 30                	int    $0x30
+  801501:	85 c0                	test   %eax,%eax
+  801503:	7f 08                	jg     80150d <sys_env_set_thisenv+0x2b>
+  801505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801508:	5b                   	pop    %ebx
+  801509:	5e                   	pop    %esi
+  80150a:	5f                   	pop    %edi
+  80150b:	5d                   	pop    %ebp
+  80150c:	c3                   	ret
+  80150d:	83 ec 0c             	sub    $0xc,%esp
+  801510:	50                   	push   %eax
+  801511:	6a 1c                	push   $0x1c
+  801513:	68 0b 37 80 00       	push   $0x80370b
+  801518:	6a 24                	push   $0x24
+  80151a:	68 28 37 80 00       	push   $0x803728
+  80151f:	e8 8a ec ff ff       	call   8001ae <_panic>
+
+00801524 <sys_env_set_sched>:
+  801524:	55                   	push   %ebp
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	57                   	push   %edi
+  801528:	56                   	push   %esi
+  801529:	53                   	push   %ebx
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	be 00 00 00 00       	mov    $0x0,%esi
+  801532:	8b 55 08             	mov    0x8(%ebp),%edx
+  801535:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801538:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80153d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801540:	89 f7                	mov    %esi,%edi
+  801542:	cd 30                	int    $0x30
+  801544:	85 c0                	test   %eax,%eax
+  801546:	7f 08                	jg     801550 <sys_env_set_sched+0x2c>
+  801548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154b:	5b                   	pop    %ebx
+  80154c:	5e                   	pop    %esi
+  80154d:	5f                   	pop    %edi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+  801550:	83 ec 0c             	sub    $0xc,%esp
+  801553:	50                   	push   %eax
+  801554:	6a 1d                	push   $0x1d
+  801556:	68 0b 37 80 00       	push   $0x80370b
+  80155b:	6a 24                	push   $0x24
+  80155d:	68 28 37 80 00       	push   $0x803728
+  801562:	e8 47 ec ff ff       	call   8001ae <_panic>
+
+00801567 <sys_batch>:
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	57                   	push   %edi
+  80156b:	56                   	push   %esi
+  80156c:	53                   	push   %ebx
+  80156d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801572:	8b 55 08             	mov    0x8(%ebp),%edx
+  801575:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801578:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80157d:	89 df                	mov    %ebx,%edi
+  80157f:	89 de                	mov    %ebx,%esi
+  801581:	cd 30                	int    $0x30
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+
+00801588 <sys_env_stats>:
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	57                   	push   %edi
+  80158c:	56                   	push   %esi
+  80158d:	53                   	push   %ebx
+  80158e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801593:	8b 55 08             	mov    0x8(%ebp),%edx
+  801596:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801599:	b8 23 00 00 00       	mov    $0x23,%eax
+  80159e:	89 df                	mov    %ebx,%edi
+  8015a0:	89 de                	mov    %ebx,%esi
+  8015a2:	cd 30                	int    $0x30
+  8015a4:	5b                   	pop    %ebx
+  8015a5:	5e                   	pop    %esi
+  8015a6:	5f                   	pop    %edi
+  8015a7:	5d                   	pop    %ebp
+  8015a8:	c3                   	ret
+
+008015a9 <sys_trace>:
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	57                   	push   %edi
+  8015ad:	56                   	push   %esi
+  8015ae:	53                   	push   %ebx
+  8015af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b7:	b8 24 00 00 00       	mov    $0x24,%eax
+  8015bc:	89 cb                	mov    %ecx,%ebx
+  8015be:	89 cf                	mov    %ecx,%edi
+  8015c0:	89 ce                	mov    %ecx,%esi
+  8015c2:	cd 30                	int    $0x30
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+
+008015c9 <sys_env_set_pager>:
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	57                   	push   %edi
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+  8015cf:	83 ec 0c             	sub    $0xc,%esp
+  8015d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015dd:	b8 25 00 00 00       	mov    $0x25,%eax
+  8015e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e5:	89 f7                	mov    %esi,%edi
+  8015e7:	cd 30                	int    $0x30
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	7f 08                	jg     8015f5 <sys_env_set_pager+0x2c>
+  8015ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f0:	5b                   	pop    %ebx
+  8015f1:	5e                   	pop    %esi
+  8015f2:	5f                   	pop    %edi
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+  8015f5:	83 ec 0c             	sub    $0xc,%esp
+  8015f8:	50                   	push   %eax
+  8015f9:	6a 25                	push   $0x25
+  8015fb:	68 0b 37 80 00       	push   $0x80370b
+  801600:	6a 24                	push   $0x24
+  801602:	68 28 37 80 00       	push   $0x803728
+  801607:	e8 a2 eb ff ff       	call   8001ae <_panic>
+
+0080160c <sys_pager_retire>:
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	57                   	push   %edi
+  801610:	56                   	push   %esi
+  801611:	53                   	push   %ebx
+  801612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801617:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161a:	b8 28 00 00 00       	mov    $0x28,%eax
+  80161f:	89 cb                	mov    %ecx,%ebx
+  801621:	89 cf                	mov    %ecx,%edi
+  801623:	89 ce                	mov    %ecx,%esi
+  801625:	cd 30                	int    $0x30
+  801627:	5b                   	pop    %ebx
+  801628:	5e                   	pop    %esi
+  801629:	5f                   	pop    %edi
+  80162a:	5d                   	pop    %ebp
+  80162b:	c3                   	ret
+
+0080162c <sys_prof>:
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	57                   	push   %edi
+  801630:	56                   	push   %esi
+  801631:	53                   	push   %ebx
+  801632:	be 00 00 00 00       	mov    $0x0,%esi
+  801637:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163d:	b8 22 00 00 00       	mov    $0x22,%eax
+  801642:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801645:	89 f7                	mov    %esi,%edi
+  801647:	cd 30                	int    $0x30
+  801649:	5b                   	pop    %ebx
+  80164a:	5e                   	pop    %esi
+  80164b:	5f                   	pop    %edi
+  80164c:	5d                   	pop    %ebp
+  80164d:	c3                   	ret
+
+0080164e <fd2num>:
+  80164e:	55                   	push   %ebp
+  80164f:	89 e5                	mov    %esp,%ebp
+  801651:	8b 45 08             	mov    0x8(%ebp),%eax
+  801654:	05 00 00 00 30       	add    $0x30000000,%eax
+  801659:	c1 e8 0c             	shr    $0xc,%eax
+  80165c:	5d                   	pop    %ebp
+  80165d:	c3                   	ret
+
+0080165e <fd2data>:
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	8b 45 08             	mov    0x8(%ebp),%eax
+  801664:	05 00 00 00 30       	add    $0x30000000,%eax
+  801669:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80166e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801673:	5d                   	pop    %ebp
+  801674:	c3                   	ret
+
+00801675 <fd_alloc>:
+  801675:	55                   	push   %ebp
+  801676:	89 e5                	mov    %esp,%ebp
+  801678:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80167d:	89 c2                	mov    %eax,%edx
+  80167f:	c1 ea 16             	shr    $0x16,%edx
+  801682:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801689:	f6 c2 01             	test   $0x1,%dl
+  80168c:	74 29                	je     8016b7 <fd_alloc+0x42>
+  80168e:	89 c2                	mov    %eax,%edx
+  801690:	c1 ea 0c             	shr    $0xc,%edx
+  801693:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80169a:	f6 c2 01             	test   $0x1,%dl
+  80169d:	74 18                	je     8016b7 <fd_alloc+0x42>
+  80169f:	05 00 10 00 00       	add    $0x1000,%eax
+  8016a4:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8016a9:	75 d2                	jne    80167d <fd_alloc+0x8>
+  8016ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016b5:	eb 05                	jmp    8016bc <fd_alloc+0x47>
+  8016b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bf:	89 02                	mov    %eax,(%edx)
+  8016c1:	89 c8                	mov    %ecx,%eax
+  8016c3:	5d                   	pop    %ebp
+  8016c4:	c3                   	ret
+
+008016c5 <fd_lookup>:
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016cb:	83 f8 1f             	cmp    $0x1f,%eax
+  8016ce:	77 30                	ja     801700 <fd_lookup+0x3b>
+  8016d0:	c1 e0 0c             	shl    $0xc,%eax
+  8016d3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8016d8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016de:	f6 c2 01             	test   $0x1,%dl
+  8016e1:	74 24                	je     801707 <fd_lookup+0x42>
+  8016e3:	89 c2                	mov    %eax,%edx
+  8016e5:	c1 ea 0c             	shr    $0xc,%edx
+  8016e8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016ef:	f6 c2 01             	test   $0x1,%dl
+  8016f2:	74 1a                	je     80170e <fd_lookup+0x49>
+  8016f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016f7:	89 02                	mov    %eax,(%edx)
+  8016f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fe:	5d                   	pop    %ebp
+  8016ff:	c3                   	ret
+  801700:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801705:	eb f7                	jmp    8016fe <fd_lookup+0x39>
+  801707:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80170c:	eb f0                	jmp    8016fe <fd_lookup+0x39>
+  80170e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801713:	eb e9                	jmp    8016fe <fd_lookup+0x39>
+
+00801715 <dev_lookup>:
+  801715:	55                   	push   %ebp
+  801716:	89 e5                	mov    %esp,%ebp
+  801718:	53                   	push   %ebx
+  801719:	83 ec 04             	sub    $0x4,%esp
+  80171c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801724:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801729:	39 13                	cmp    %edx,(%ebx)
+  80172b:	74 37                	je     801764 <dev_lookup+0x4f>
+  80172d:	83 c0 01             	add    $0x1,%eax
+  801730:	8b 1c 85 b4 37 80 00 	mov    0x8037b4(,%eax,4),%ebx
+  801737:	85 db                	test   %ebx,%ebx
+  801739:	75 ee                	jne    801729 <dev_lookup+0x14>
+  80173b:	a1 20 70 80 00       	mov    0x807020,%eax
+  801740:	8b 40 48             	mov    0x48(%eax),%eax
+  801743:	83 ec 04             	sub    $0x4,%esp
+  801746:	52                   	push   %edx
+  801747:	50                   	push   %eax
+  801748:	68 38 37 80 00       	push   $0x803738
+  80174d:	e8 37 eb ff ff       	call   800289 <cprintf>
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80175a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80175d:	89 1a                	mov    %ebx,(%edx)
+  80175f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801762:	c9                   	leave
+  801763:	c3                   	ret
+  801764:	b8 00 00 00 00       	mov    $0x0,%eax
+  801769:	eb ef                	jmp    80175a <dev_lookup+0x45>
+
+0080176b <fd_close>:
+  80176b:	55                   	push   %ebp
+  80176c:	89 e5                	mov    %esp,%ebp
+  80176e:	57                   	push   %edi
+  80176f:	56                   	push   %esi
+  801770:	53                   	push   %ebx
+  801771:	83 ec 24             	sub    $0x24,%esp
+  801774:	8b 75 08             	mov    0x8(%ebp),%esi
+  801777:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80177a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80177d:	50                   	push   %eax
+  80177e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801784:	c1 e8 0c             	shr    $0xc,%eax
+  801787:	50                   	push   %eax
+  801788:	e8 38 ff ff ff       	call   8016c5 <fd_lookup>
+  80178d:	89 c3                	mov    %eax,%ebx
+  80178f:	83 c4 10             	add    $0x10,%esp
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 05                	js     80179b <fd_close+0x30>
+  801796:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801799:	74 0f                	je     8017aa <fd_close+0x3f>
+  80179b:	85 ff                	test   %edi,%edi
+  80179d:	0f 44 df             	cmove  %edi,%ebx
+  8017a0:	89 d8                	mov    %ebx,%eax
+  8017a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a5:	5b                   	pop    %ebx
+  8017a6:	5e                   	pop    %esi
+  8017a7:	5f                   	pop    %edi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+  8017aa:	83 ec 08             	sub    $0x8,%esp
+  8017ad:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017b0:	50                   	push   %eax
+  8017b1:	ff 36                	push   (%esi)
+  8017b3:	e8 5d ff ff ff       	call   801715 <dev_lookup>
+  8017b8:	89 c3                	mov    %eax,%ebx
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	78 1a                	js     8017db <fd_close+0x70>
+  8017c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017c4:	8b 40 10             	mov    0x10(%eax),%eax
+  8017c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	74 0b                	je     8017db <fd_close+0x70>
+  8017d0:	83 ec 0c             	sub    $0xc,%esp
+  8017d3:	56                   	push   %esi
+  8017d4:	ff d0                	call   *%eax
+  8017d6:	89 c3                	mov    %eax,%ebx
+  8017d8:	83 c4 10             	add    $0x10,%esp
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	56                   	push   %esi
+  8017df:	6a 00                	push   $0x0
+  8017e1:	e8 cc f6 ff ff       	call   800eb2 <sys_page_unmap>
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	eb b5                	jmp    8017a0 <fd_close+0x35>
+
+008017eb <close>:
+  8017eb:	55                   	push   %ebp
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	83 ec 20             	sub    $0x20,%esp
+  8017f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f4:	50                   	push   %eax
+  8017f5:	ff 75 08             	push   0x8(%ebp)
+  8017f8:	e8 c8 fe ff ff       	call   8016c5 <fd_lookup>
+  8017fd:	83 c4 10             	add    $0x10,%esp
+  801800:	85 c0                	test   %eax,%eax
+  801802:	79 02                	jns    801806 <close+0x1b>
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+  801806:	83 ec 08             	sub    $0x8,%esp
+  801809:	6a 01                	push   $0x1
+  80180b:	ff 75 f4             	push   -0xc(%ebp)
+  80180e:	e8 58 ff ff ff       	call   80176b <fd_close>
+  801813:	83 c4 10             	add    $0x10,%esp
+  801816:	eb ec                	jmp    801804 <close+0x19>
+
+00801818 <close_all>:
+  801818:	55                   	push   %ebp
+  801819:	89 e5                	mov    %esp,%ebp
+  80181b:	53                   	push   %ebx
+  80181c:	83 ec 04             	sub    $0x4,%esp
+  80181f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801824:	83 ec 0c             	sub    $0xc,%esp
+  801827:	53                   	push   %ebx
+  801828:	e8 be ff ff ff       	call   8017eb <close>
+  80182d:	83 c3 01             	add    $0x1,%ebx
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	83 fb 20             	cmp    $0x20,%ebx
+  801836:	75 ec                	jne    801824 <close_all+0xc>
+  801838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80183b:	c9                   	leave
+  80183c:	c3                   	ret
+
+0080183d <dup>:
+  80183d:	55                   	push   %ebp
+  80183e:	89 e5                	mov    %esp,%ebp
+  801840:	57                   	push   %edi
+  801841:	56                   	push   %esi
+  801842:	53                   	push   %ebx
+  801843:	83 ec 34             	sub    $0x34,%esp
+  801846:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801849:	50                   	push   %eax
+  80184a:	ff 75 08             	push   0x8(%ebp)
+  80184d:	e8 73 fe ff ff       	call   8016c5 <fd_lookup>
+  801852:	89 c3                	mov    %eax,%ebx
+  801854:	83 c4 10             	add    $0x10,%esp
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 7f                	js     8018da <dup+0x9d>
+  80185b:	83 ec 0c             	sub    $0xc,%esp
+  80185e:	ff 75 0c             	push   0xc(%ebp)
+  801861:	e8 85 ff ff ff       	call   8017eb <close>
+  801866:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801869:	c1 e6 0c             	shl    $0xc,%esi
+  80186c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801872:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801875:	89 3c 24             	mov    %edi,(%esp)
+  801878:	e8 e1 fd ff ff       	call   80165e <fd2data>
+  80187d:	89 c3                	mov    %eax,%ebx
+  80187f:	89 34 24             	mov    %esi,(%esp)
+  801882:	e8 d7 fd ff ff       	call   80165e <fd2data>
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80188d:	89 d8                	mov    %ebx,%eax
+  80188f:	c1 e8 16             	shr    $0x16,%eax
+  801892:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801899:	a8 01                	test   $0x1,%al
+  80189b:	74 11                	je     8018ae <dup+0x71>
+  80189d:	89 d8                	mov    %ebx,%eax
+  80189f:	c1 e8 0c             	shr    $0xc,%eax
+  8018a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018a9:	f6 c2 01             	test   $0x1,%dl
+  8018ac:	75 36                	jne    8018e4 <dup+0xa7>
+  8018ae:	89 f8                	mov    %edi,%eax
+  8018b0:	c1 e8 0c             	shr    $0xc,%eax
+  8018b3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ba:	83 ec 0c             	sub    $0xc,%esp
+  8018bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018c2:	50                   	push   %eax
+  8018c3:	56                   	push   %esi
+  8018c4:	6a 00                	push   $0x0
+  8018c6:	57                   	push   %edi
+  8018c7:	6a 00                	push   $0x0
+  8018c9:	e8 55 f5 ff ff       	call   800e23 <sys_page_map>
+  8018ce:	89 c3                	mov    %eax,%ebx
+  8018d0:	83 c4 20             	add    $0x20,%esp
+  8018d3:	85 c0                	test   %eax,%eax
+  8018d5:	78 33                	js     80190a <dup+0xcd>
+  8018d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018da:	89 d8                	mov    %ebx,%eax
+  8018dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018df:	5b                   	pop    %ebx
+  8018e0:	5e                   	pop    %esi
+  8018e1:	5f                   	pop    %edi
+  8018e2:	5d                   	pop    %ebp
+  8018e3:	c3                   	ret
+  8018e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018eb:	83 ec 0c             	sub    $0xc,%esp
+  8018ee:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018f3:	50                   	push   %eax
+  8018f4:	ff 75 d4             	push   -0x2c(%ebp)
+  8018f7:	6a 00                	push   $0x0
+  8018f9:	53                   	push   %ebx
+  8018fa:	6a 00                	push   $0x0
+  8018fc:	e8 22 f5 ff ff       	call   800e23 <sys_page_map>
+  801901:	89 c3                	mov    %eax,%ebx
+  801903:	83 c4 20             	add    $0x20,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	79 a4                	jns    8018ae <dup+0x71>
+  80190a:	83 ec 08             	sub    $0x8,%esp
+  80190d:	56                   	push   %esi
+  80190e:	6a 00                	push   $0x0
+  801910:	e8 9d f5 ff ff       	call   800eb2 <sys_page_unmap>
+  801915:	83 c4 08             	add    $0x8,%esp
+  801918:	ff 75 d4             	push   -0x2c(%ebp)
+  80191b:	6a 00                	push   $0x0
+  80191d:	e8 90 f5 ff ff       	call   800eb2 <sys_page_unmap>
+  801922:	83 c4 10             	add    $0x10,%esp
+  801925:	eb b3                	jmp    8018da <dup+0x9d>
+
+00801927 <read>:
+  801927:	55                   	push   %ebp
+  801928:	89 e5                	mov    %esp,%ebp
+  80192a:	56                   	push   %esi
+  80192b:	53                   	push   %ebx
+  80192c:	83 ec 18             	sub    $0x18,%esp
+  80192f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801932:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801935:	50                   	push   %eax
+  801936:	56                   	push   %esi
+  801937:	e8 89 fd ff ff       	call   8016c5 <fd_lookup>
+  80193c:	83 c4 10             	add    $0x10,%esp
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	78 3c                	js     80197f <read+0x58>
+  801943:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801946:	83 ec 08             	sub    $0x8,%esp
+  801949:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80194c:	50                   	push   %eax
+  80194d:	ff 33                	push   (%ebx)
+  80194f:	e8 c1 fd ff ff       	call   801715 <dev_lookup>
+  801954:	83 c4 10             	add    $0x10,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	78 24                	js     80197f <read+0x58>
+  80195b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80195e:	83 e0 03             	and    $0x3,%eax
+  801961:	83 f8 01             	cmp    $0x1,%eax
+  801964:	74 20                	je     801986 <read+0x5f>
+  801966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801969:	8b 40 08             	mov    0x8(%eax),%eax
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	74 37                	je     8019a7 <read+0x80>
+  801970:	83 ec 04             	sub    $0x4,%esp
+  801973:	ff 75 10             	push   0x10(%ebp)
+  801976:	ff 75 0c             	push   0xc(%ebp)
+  801979:	53                   	push   %ebx
+  80197a:	ff d0                	call   *%eax
+  80197c:	83 c4 10             	add    $0x10,%esp
+  80197f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801982:	5b                   	pop    %ebx
+  801983:	5e                   	pop    %esi
+  801984:	5d                   	pop    %ebp
+  801985:	c3                   	ret
+  801986:	a1 20 70 80 00       	mov    0x807020,%eax
+  80198b:	8b 40 48             	mov    0x48(%eax),%eax
+  80198e:	83 ec 04             	sub    $0x4,%esp
+  801991:	56                   	push   %esi
+  801992:	50                   	push   %eax
+  801993:	68 79 37 80 00       	push   $0x803779
+  801998:	e8 ec e8 ff ff       	call   800289 <cprintf>
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a5:	eb d8                	jmp    80197f <read+0x58>
+  8019a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019ac:	eb d1                	jmp    80197f <read+0x58>
+
+008019ae <readn>:
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+  8019b1:	57                   	push   %edi
+  8019b2:	56                   	push   %esi
+  8019b3:	53                   	push   %ebx
+  8019b4:	83 ec 0c             	sub    $0xc,%esp
+  8019b7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8019ba:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019bd:	85 f6                	test   %esi,%esi
+  8019bf:	74 30                	je     8019f1 <readn+0x43>
+  8019c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cb:	83 ec 04             	sub    $0x4,%esp
+  8019ce:	89 f2                	mov    %esi,%edx
+  8019d0:	29 c2                	sub    %eax,%edx
+  8019d2:	52                   	push   %edx
+  8019d3:	01 f8                	add    %edi,%eax
+  8019d5:	50                   	push   %eax
+  8019d6:	ff 75 08             	push   0x8(%ebp)
+  8019d9:	e8 49 ff ff ff       	call   801927 <read>
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	85 c0                	test   %eax,%eax
+  8019e3:	78 15                	js     8019fa <readn+0x4c>
+  8019e5:	74 11                	je     8019f8 <readn+0x4a>
+  8019e7:	01 c3                	add    %eax,%ebx
+  8019e9:	89 d8                	mov    %ebx,%eax
+  8019eb:	39 f3                	cmp    %esi,%ebx
+  8019ed:	72 dc                	jb     8019cb <readn+0x1d>
+  8019ef:	eb 09                	jmp    8019fa <readn+0x4c>
+  8019f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f6:	eb 02                	jmp    8019fa <readn+0x4c>
+  8019f8:	89 d8                	mov    %ebx,%eax
+  8019fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019fd:	5b                   	pop    %ebx
+  8019fe:	5e                   	pop    %esi
+  8019ff:	5f                   	pop    %edi
+  801a00:	5d                   	pop    %ebp
+  801a01:	c3                   	ret
+
+00801a02 <write>:
+  801a02:	55                   	push   %ebp
+  801a03:	89 e5                	mov    %esp,%ebp
+  801a05:	56                   	push   %esi
+  801a06:	53                   	push   %ebx
+  801a07:	83 ec 18             	sub    $0x18,%esp
+  801a0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a10:	50                   	push   %eax
+  801a11:	53                   	push   %ebx
+  801a12:	e8 ae fc ff ff       	call   8016c5 <fd_lookup>
+  801a17:	83 c4 10             	add    $0x10,%esp
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	78 37                	js     801a55 <write+0x53>
+  801a1e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a21:	83 ec 08             	sub    $0x8,%esp
+  801a24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a27:	50                   	push   %eax
+  801a28:	ff 36                	push   (%esi)
+  801a2a:	e8 e6 fc ff ff       	call   801715 <dev_lookup>
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	78 1f                	js     801a55 <write+0x53>
+  801a36:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a3a:	74 20                	je     801a5c <write+0x5a>
+  801a3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	74 37                	je     801a7d <write+0x7b>
+  801a46:	83 ec 04             	sub    $0x4,%esp
+  801a49:	ff 75 10             	push   0x10(%ebp)
+  801a4c:	ff 75 0c             	push   0xc(%ebp)
+  801a4f:	56                   	push   %esi
+  801a50:	ff d0                	call   *%eax
+  801a52:	83 c4 10             	add    $0x10,%esp
+  801a55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a58:	5b                   	pop    %ebx
+  801a59:	5e                   	pop    %esi
+  801a5a:	5d                   	pop    %ebp
+  801a5b:	c3                   	ret
+  801a5c:	a1 20 70 80 00       	mov    0x807020,%eax
+  801a61:	8b 40 48             	mov    0x48(%eax),%eax
+  801a64:	83 ec 04             	sub    $0x4,%esp
+  801a67:	53                   	push   %ebx
+  801a68:	50                   	push   %eax
+  801a69:	68 95 37 80 00       	push   $0x803795
+  801a6e:	e8 16 e8 ff ff       	call   800289 <cprintf>
+  801a73:	83 c4 10             	add    $0x10,%esp
+  801a76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7b:	eb d8                	jmp    801a55 <write+0x53>
+  801a7d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a82:	eb d1                	jmp    801a55 <write+0x53>
+
+00801a84 <seek>:
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	83 ec 20             	sub    $0x20,%esp
+  801a8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a8d:	50                   	push   %eax
+  801a8e:	ff 75 08             	push   0x8(%ebp)
+  801a91:	e8 2f fc ff ff       	call   8016c5 <fd_lookup>
+  801a96:	83 c4 10             	add    $0x10,%esp
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	78 0e                	js     801aab <seek+0x27>
+  801a9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa3:	89 50 04             	mov    %edx,0x4(%eax)
+  801aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aab:	c9                   	leave
+  801aac:	c3                   	ret
+
+00801aad <ftruncate>:
+  801aad:	55                   	push   %ebp
+  801aae:	89 e5                	mov    %esp,%ebp
+  801ab0:	56                   	push   %esi
+  801ab1:	53                   	push   %ebx
+  801ab2:	83 ec 18             	sub    $0x18,%esp
+  801ab5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ab8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abb:	50                   	push   %eax
+  801abc:	53                   	push   %ebx
+  801abd:	e8 03 fc ff ff       	call   8016c5 <fd_lookup>
+  801ac2:	83 c4 10             	add    $0x10,%esp
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	78 34                	js     801afd <ftruncate+0x50>
+  801ac9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801acc:	83 ec 08             	sub    $0x8,%esp
+  801acf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad2:	50                   	push   %eax
+  801ad3:	ff 36                	push   (%esi)
+  801ad5:	e8 3b fc ff ff       	call   801715 <dev_lookup>
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 1c                	js     801afd <ftruncate+0x50>
+  801ae1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ae5:	74 1d                	je     801b04 <ftruncate+0x57>
+  801ae7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aea:	8b 40 18             	mov    0x18(%eax),%eax
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	74 34                	je     801b25 <ftruncate+0x78>
+  801af1:	83 ec 08             	sub    $0x8,%esp
+  801af4:	ff 75 0c             	push   0xc(%ebp)
+  801af7:	56                   	push   %esi
+  801af8:	ff d0                	call   *%eax
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b00:	5b                   	pop    %ebx
+  801b01:	5e                   	pop    %esi
+  801b02:	5d                   	pop    %ebp
+  801b03:	c3                   	ret
+  801b04:	a1 20 70 80 00       	mov    0x807020,%eax
+  801b09:	8b 40 48             	mov    0x48(%eax),%eax
+  801b0c:	83 ec 04             	sub    $0x4,%esp
+  801b0f:	53                   	push   %ebx
+  801b10:	50                   	push   %eax
+  801b11:	68 58 37 80 00       	push   $0x803758
+  801b16:	e8 6e e7 ff ff       	call   800289 <cprintf>
+  801b1b:	83 c4 10             	add    $0x10,%esp
+  801b1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b23:	eb d8                	jmp    801afd <ftruncate+0x50>
+  801b25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b2a:	eb d1                	jmp    801afd <ftruncate+0x50>
+
+00801b2c <fstat>:
+  801b2c:	55                   	push   %ebp
+  801b2d:	89 e5                	mov    %esp,%ebp
+  801b2f:	56                   	push   %esi
+  801b30:	53                   	push   %ebx
+  801b31:	83 ec 18             	sub    $0x18,%esp
+  801b34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b37:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b3a:	50                   	push   %eax
+  801b3b:	ff 75 08             	push   0x8(%ebp)
+  801b3e:	e8 82 fb ff ff       	call   8016c5 <fd_lookup>
+  801b43:	83 c4 10             	add    $0x10,%esp
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	78 49                	js     801b93 <fstat+0x67>
+  801b4a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b4d:	83 ec 08             	sub    $0x8,%esp
+  801b50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b53:	50                   	push   %eax
+  801b54:	ff 36                	push   (%esi)
+  801b56:	e8 ba fb ff ff       	call   801715 <dev_lookup>
+  801b5b:	83 c4 10             	add    $0x10,%esp
+  801b5e:	85 c0                	test   %eax,%eax
+  801b60:	78 31                	js     801b93 <fstat+0x67>
+  801b62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b65:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b69:	74 2f                	je     801b9a <fstat+0x6e>
+  801b6b:	c6 03 00             	movb   $0x0,(%ebx)
+  801b6e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b75:	00 00 00 
+  801b78:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b7f:	00 00 00 
+  801b82:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801b88:	83 ec 08             	sub    $0x8,%esp
+  801b8b:	53                   	push   %ebx
+  801b8c:	56                   	push   %esi
+  801b8d:	ff 50 14             	call   *0x14(%eax)
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b96:	5b                   	pop    %ebx
+  801b97:	5e                   	pop    %esi
+  801b98:	5d                   	pop    %ebp
+  801b99:	c3                   	ret
+  801b9a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b9f:	eb f2                	jmp    801b93 <fstat+0x67>
+
+00801ba1 <stat>:
+  801ba1:	55                   	push   %ebp
+  801ba2:	89 e5                	mov    %esp,%ebp
+  801ba4:	56                   	push   %esi
+  801ba5:	53                   	push   %ebx
+  801ba6:	83 ec 08             	sub    $0x8,%esp
+  801ba9:	6a 00                	push   $0x0
+  801bab:	ff 75 08             	push   0x8(%ebp)
+  801bae:	e8 31 05 00 00       	call   8020e4 <open>
+  801bb3:	89 c3                	mov    %eax,%ebx
+  801bb5:	83 c4 10             	add    $0x10,%esp
+  801bb8:	85 c0                	test   %eax,%eax
+  801bba:	78 1b                	js     801bd7 <stat+0x36>
+  801bbc:	83 ec 08             	sub    $0x8,%esp
+  801bbf:	ff 75 0c             	push   0xc(%ebp)
+  801bc2:	50                   	push   %eax
+  801bc3:	e8 64 ff ff ff       	call   801b2c <fstat>
+  801bc8:	89 c6                	mov    %eax,%esi
+  801bca:	89 1c 24             	mov    %ebx,(%esp)
+  801bcd:	e8 19 fc ff ff       	call   8017eb <close>
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	89 f3                	mov    %esi,%ebx
+  801bd7:	89 d8                	mov    %ebx,%eax
+  801bd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bdc:	5b                   	pop    %ebx
+  801bdd:	5e                   	pop    %esi
+  801bde:	5d                   	pop    %ebp
+  801bdf:	c3                   	ret
+
+00801be0 <fsipc>:
+  801be0:	55                   	push   %ebp
+  801be1:	89 e5                	mov    %esp,%ebp
+  801be3:	56                   	push   %esi
+  801be4:	53                   	push   %ebx
+  801be5:	89 c3                	mov    %eax,%ebx
+  801be7:	89 d6                	mov    %edx,%esi
+  801be9:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801bf0:	74 20                	je     801c12 <fsipc+0x32>
+  801bf2:	83 ec 08             	sub    $0x8,%esp
+  801bf5:	6a 00                	push   $0x0
+  801bf7:	56                   	push   %esi
+  801bf8:	6a 07                	push   $0x7
+  801bfa:	68 00 80 80 00       	push   $0x808000
+  801bff:	53                   	push   %ebx
+  801c00:	ff 35 08 50 80 00    	push   0x805008
+  801c06:	e8 6e 13 00 00       	call   802f79 <ipc_call>
+  801c0b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c0e:	5b                   	pop    %ebx
+  801c0f:	5e                   	pop    %esi
+  801c10:	5d                   	pop    %ebp
+  801c11:	c3                   	ret
+  801c12:	83 ec 0c             	sub    $0xc,%esp
+  801c15:	6a 02                	push   $0x2
+  801c17:	e8 f8 14 00 00       	call   803114 <ipc_find_env>
+  801c1c:	a3 08 50 80 00       	mov    %eax,0x805008
+  801c21:	83 c4 10             	add    $0x10,%esp
+  801c24:	eb cc                	jmp    801bf2 <fsipc+0x12>
+
+00801c26 <devfile_trunc>:
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	83 ec 08             	sub    $0x8,%esp
+  801c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c32:	a3 00 80 80 00       	mov    %eax,0x808000
+  801c37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3a:	a3 04 80 80 00       	mov    %eax,0x808004
+  801c3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c44:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c49:	e8 92 ff ff ff       	call   801be0 <fsipc>
+  801c4e:	c9                   	leave
+  801c4f:	c3                   	ret
+
+00801c50 <devfile_flush>:
+  801c50:	55                   	push   %ebp
+  801c51:	89 e5                	mov    %esp,%ebp
+  801c53:	83 ec 08             	sub    $0x8,%esp
+  801c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c59:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c5c:	a3 00 80 80 00       	mov    %eax,0x808000
+  801c61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c66:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c6b:	e8 70 ff ff ff       	call   801be0 <fsipc>
+  801c70:	c9                   	leave
+  801c71:	c3                   	ret
+
+00801c72 <devfile_stat>:
+  801c72:	55                   	push   %ebp
+  801c73:	89 e5                	mov    %esp,%ebp
+  801c75:	53                   	push   %ebx
+  801c76:	83 ec 04             	sub    $0x4,%esp
+  801c79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c82:	a3 00 80 80 00       	mov    %eax,0x808000
+  801c87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c91:	e8 4a ff ff ff       	call   801be0 <fsipc>
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	78 2c                	js     801cc6 <devfile_stat+0x54>
+  801c9a:	83 ec 08             	sub    $0x8,%esp
+  801c9d:	68 00 80 80 00       	push   $0x808000
+  801ca2:	53                   	push   %ebx
+  801ca3:	e8 d8 ec ff ff       	call   800980 <strcpy>
+  801ca8:	a1 80 80 80 00       	mov    0x808080,%eax
+  801cad:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801cb3:	a1 84 80 80 00       	mov    0x808084,%eax
+  801cb8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+00801ccb <fsring_rw>:
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	57                   	push   %edi
+  801ccf:	56                   	push   %esi
+  801cd0:	53                   	push   %ebx
+  801cd1:	83 ec 2c             	sub    $0x2c,%esp
+  801cd4:	89 c7                	mov    %eax,%edi
+  801cd6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cd9:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801cdc:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801ce1:	a8 01                	test   $0x1,%al
+  801ce3:	74 0d                	je     801cf2 <fsring_rw+0x27>
+  801ce5:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801cea:	a8 01                	test   $0x1,%al
+  801cec:	0f 85 d5 00 00 00    	jne    801dc7 <fsring_rw+0xfc>
+  801cf2:	a1 20 70 80 00       	mov    0x807020,%eax
+  801cf7:	8b 40 48             	mov    0x48(%eax),%eax
+  801cfa:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801d00:	0f 84 fc 00 00 00    	je     801e02 <fsring_rw+0x137>
+  801d06:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801d0d:	0f 84 02 01 00 00    	je     801e15 <fsring_rw+0x14a>
+  801d13:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d18:	83 ec 04             	sub    $0x4,%esp
+  801d1b:	68 07 02 00 00       	push   $0x207
+  801d20:	53                   	push   %ebx
+  801d21:	6a 00                	push   $0x0
+  801d23:	e8 b8 f0 ff ff       	call   800de0 <sys_page_alloc>
+  801d28:	83 c4 10             	add    $0x10,%esp
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	0f 88 f9 00 00 00    	js     801e2c <fsring_rw+0x161>
+  801d33:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d39:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d3f:	75 d7                	jne    801d18 <fsring_rw+0x4d>
+  801d41:	6a 0e                	push   $0xe
+  801d43:	6a 0d                	push   $0xd
+  801d45:	ff 35 08 50 80 00    	push   0x805008
+  801d4b:	68 00 00 f0 cf       	push   $0xcff00000
+  801d50:	e8 d8 0d 00 00       	call   802b2d <ipcring_init>
+  801d55:	83 c4 08             	add    $0x8,%esp
+  801d58:	6a 00                	push   $0x0
+  801d5a:	6a 00                	push   $0x0
+  801d5c:	68 07 02 00 00       	push   $0x207
+  801d61:	68 00 00 f0 cf       	push   $0xcff00000
+  801d66:	6a 0b                	push   $0xb
+  801d68:	ff 35 08 50 80 00    	push   0x805008
+  801d6e:	e8 06 12 00 00       	call   802f79 <ipc_call>
+  801d73:	89 c6                	mov    %eax,%esi
+  801d75:	83 c4 20             	add    $0x20,%esp
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	0f 88 ac 00 00 00    	js     801e2c <fsring_rw+0x161>
+  801d80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d85:	89 d9                	mov    %ebx,%ecx
+  801d87:	83 c3 01             	add    $0x1,%ebx
+  801d8a:	89 da                	mov    %ebx,%edx
+  801d8c:	c1 e2 0c             	shl    $0xc,%edx
+  801d8f:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801d95:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801d9b:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801da1:	83 ec 08             	sub    $0x8,%esp
+  801da4:	6a 00                	push   $0x0
+  801da6:	6a 00                	push   $0x0
+  801da8:	68 07 02 00 00       	push   $0x207
+  801dad:	50                   	push   %eax
+  801dae:	6a 0c                	push   $0xc
+  801db0:	ff 35 08 50 80 00    	push   0x805008
+  801db6:	e8 be 11 00 00       	call   802f79 <ipc_call>
+  801dbb:	83 c4 20             	add    $0x20,%esp
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 6a                	js     801e2c <fsring_rw+0x161>
+  801dc2:	83 fb 08             	cmp    $0x8,%ebx
+  801dc5:	75 be                	jne    801d85 <fsring_rw+0xba>
+  801dc7:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801dcb:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801dd0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801dd5:	0f 45 c2             	cmovne %edx,%eax
+  801dd8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801ddb:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801de2:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801de9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801df0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df5:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfa:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801dfd:	e9 4b 01 00 00       	jmp    801f4d <fsring_rw+0x282>
+  801e02:	e8 a3 f3 ff ff       	call   8011aa <sys_time_msec>
+  801e07:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801e0d:	0f 89 f3 fe ff ff    	jns    801d06 <fsring_rw+0x3b>
+  801e13:	eb 54                	jmp    801e69 <fsring_rw+0x19e>
+  801e15:	83 ec 0c             	sub    $0xc,%esp
+  801e18:	6a 02                	push   $0x2
+  801e1a:	e8 f5 12 00 00       	call   803114 <ipc_find_env>
+  801e1f:	a3 08 50 80 00       	mov    %eax,0x805008
+  801e24:	83 c4 10             	add    $0x10,%esp
+  801e27:	e9 e7 fe ff ff       	jmp    801d13 <fsring_rw+0x48>
+  801e2c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e31:	83 ec 08             	sub    $0x8,%esp
+  801e34:	53                   	push   %ebx
+  801e35:	6a 00                	push   $0x0
+  801e37:	e8 76 f0 ff ff       	call   800eb2 <sys_page_unmap>
+  801e3c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e4b:	75 e4                	jne    801e31 <fsring_rw+0x166>
+  801e4d:	e8 58 f3 ff ff       	call   8011aa <sys_time_msec>
+  801e52:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801e57:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e5c:	a1 20 70 80 00       	mov    0x807020,%eax
+  801e61:	8b 40 48             	mov    0x48(%eax),%eax
+  801e64:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e69:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801e70:	e9 7a 01 00 00       	jmp    801fef <fsring_rw+0x324>
+  801e75:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e78:	89 10                	mov    %edx,(%eax)
+  801e7a:	89 58 04             	mov    %ebx,0x4(%eax)
+  801e7d:	89 f2                	mov    %esi,%edx
+  801e7f:	03 57 04             	add    0x4(%edi),%edx
+  801e82:	89 50 08             	mov    %edx,0x8(%eax)
+  801e85:	83 ec 04             	sub    $0x4,%esp
+  801e88:	53                   	push   %ebx
+  801e89:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801e8c:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801e8f:	52                   	push   %edx
+  801e90:	83 c0 0c             	add    $0xc,%eax
+  801e93:	50                   	push   %eax
+  801e94:	e8 97 ec ff ff       	call   800b30 <memmove>
+  801e99:	83 c4 10             	add    $0x10,%esp
+  801e9c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e9f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ea2:	89 08                	mov    %ecx,(%eax)
+  801ea4:	83 ec 0c             	sub    $0xc,%esp
+  801ea7:	68 00 00 f0 cf       	push   $0xcff00000
+  801eac:	e8 da 0c 00 00       	call   802b8b <ipcring_req_push>
+  801eb1:	01 de                	add    %ebx,%esi
+  801eb3:	83 c4 10             	add    $0x10,%esp
+  801eb6:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801eb9:	73 4c                	jae    801f07 <fsring_rw+0x23c>
+  801ebb:	83 ec 0c             	sub    $0xc,%esp
+  801ebe:	68 00 00 f0 cf       	push   $0xcff00000
+  801ec3:	e8 9d 0c 00 00       	call   802b65 <ipcring_req_slot>
+  801ec8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ecb:	83 c4 10             	add    $0x10,%esp
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	74 35                	je     801f07 <fsring_rw+0x23c>
+  801ed2:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801ed7:	83 e0 07             	and    $0x7,%eax
+  801eda:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801edf:	c1 e0 0c             	shl    $0xc,%eax
+  801ee2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ee5:	29 f3                	sub    %esi,%ebx
+  801ee7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801eea:	39 cb                	cmp    %ecx,%ebx
+  801eec:	0f 47 d9             	cmova  %ecx,%ebx
+  801eef:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801ef3:	75 80                	jne    801e75 <fsring_rw+0x1aa>
+  801ef5:	8b 57 0c             	mov    0xc(%edi),%edx
+  801ef8:	89 10                	mov    %edx,(%eax)
+  801efa:	89 58 04             	mov    %ebx,0x4(%eax)
+  801efd:	89 f2                	mov    %esi,%edx
+  801eff:	03 57 04             	add    0x4(%edi),%edx
+  801f02:	89 50 08             	mov    %edx,0x8(%eax)
+  801f05:	eb 95                	jmp    801e9c <fsring_rw+0x1d1>
+  801f07:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f0c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f0f:	83 ec 0c             	sub    $0xc,%esp
+  801f12:	68 00 00 f0 cf       	push   $0xcff00000
+  801f17:	e8 a8 0c 00 00       	call   802bc4 <ipcring_rsp_wait>
+  801f1c:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f1f:	83 c4 10             	add    $0x10,%esp
+  801f22:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f26:	75 45                	jne    801f6d <fsring_rw+0x2a2>
+  801f28:	85 db                	test   %ebx,%ebx
+  801f2a:	79 41                	jns    801f6d <fsring_rw+0x2a2>
+  801f2c:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801f2f:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801f36:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+  801f40:	68 00 00 f0 cf       	push   $0xcff00000
+  801f45:	e8 e0 0c 00 00       	call   802c2a <ipcring_rsp_pop>
+  801f4a:	83 c4 10             	add    $0x10,%esp
+  801f4d:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801f53:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f58:	39 c2                	cmp    %eax,%edx
+  801f5a:	74 75                	je     801fd1 <fsring_rw+0x306>
+  801f5c:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f60:	75 a5                	jne    801f07 <fsring_rw+0x23c>
+  801f62:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f65:	0f 82 50 ff ff ff    	jb     801ebb <fsring_rw+0x1f0>
+  801f6b:	eb 9a                	jmp    801f07 <fsring_rw+0x23c>
+  801f6d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f71:	75 ca                	jne    801f3d <fsring_rw+0x272>
+  801f73:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f77:	74 31                	je     801faa <fsring_rw+0x2df>
+  801f79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f7f:	29 c8                	sub    %ecx,%eax
+  801f81:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801f84:	39 d0                	cmp    %edx,%eax
+  801f86:	0f 47 c2             	cmova  %edx,%eax
+  801f89:	39 d8                	cmp    %ebx,%eax
+  801f8b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f90:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801f94:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801f97:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9c:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801fa0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801fa3:	01 d9                	add    %ebx,%ecx
+  801fa5:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801fa8:	eb 93                	jmp    801f3d <fsring_rw+0x272>
+  801faa:	83 ec 04             	sub    $0x4,%esp
+  801fad:	53                   	push   %ebx
+  801fae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fb1:	83 e0 07             	and    $0x7,%eax
+  801fb4:	c1 e0 0c             	shl    $0xc,%eax
+  801fb7:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801fbd:	50                   	push   %eax
+  801fbe:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801fc1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fc4:	01 c8                	add    %ecx,%eax
+  801fc6:	50                   	push   %eax
+  801fc7:	e8 64 eb ff ff       	call   800b30 <memmove>
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	eb a8                	jmp    801f79 <fsring_rw+0x2ae>
+  801fd1:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801fd5:	75 09                	jne    801fe0 <fsring_rw+0x315>
+  801fd7:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801fda:	0f 82 db fe ff ff    	jb     801ebb <fsring_rw+0x1f0>
+  801fe0:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801fe3:	01 57 04             	add    %edx,0x4(%edi)
+  801fe6:	85 d2                	test   %edx,%edx
+  801fe8:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801fec:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801fef:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801ff2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff5:	5b                   	pop    %ebx
+  801ff6:	5e                   	pop    %esi
+  801ff7:	5f                   	pop    %edi
+  801ff8:	5d                   	pop    %ebp
+  801ff9:	c3                   	ret
+
+00801ffa <devfile_write>:
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	57                   	push   %edi
+  801ffe:	56                   	push   %esi
+  801fff:	53                   	push   %ebx
+  802000:	83 ec 0c             	sub    $0xc,%esp
+  802003:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802006:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802009:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80200c:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802012:	76 1a                	jbe    80202e <devfile_write+0x34>
+  802014:	83 ec 0c             	sub    $0xc,%esp
+  802017:	53                   	push   %ebx
+  802018:	89 f1                	mov    %esi,%ecx
+  80201a:	ba 06 00 00 00       	mov    $0x6,%edx
+  80201f:	89 f8                	mov    %edi,%eax
+  802021:	e8 a5 fc ff ff       	call   801ccb <fsring_rw>
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80202c:	75 39                	jne    802067 <devfile_write+0x6d>
+  80202e:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802033:	39 c3                	cmp    %eax,%ebx
+  802035:	0f 47 d8             	cmova  %eax,%ebx
+  802038:	8b 47 0c             	mov    0xc(%edi),%eax
+  80203b:	a3 00 80 80 00       	mov    %eax,0x808000
+  802040:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802046:	83 ec 04             	sub    $0x4,%esp
+  802049:	53                   	push   %ebx
+  80204a:	56                   	push   %esi
+  80204b:	68 08 80 80 00       	push   $0x808008
+  802050:	e8 db ea ff ff       	call   800b30 <memmove>
+  802055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80205f:	e8 7c fb ff ff       	call   801be0 <fsipc>
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206a:	5b                   	pop    %ebx
+  80206b:	5e                   	pop    %esi
+  80206c:	5f                   	pop    %edi
+  80206d:	5d                   	pop    %ebp
+  80206e:	c3                   	ret
+
+0080206f <devfile_read>:
+  80206f:	55                   	push   %ebp
+  802070:	89 e5                	mov    %esp,%ebp
+  802072:	57                   	push   %edi
+  802073:	56                   	push   %esi
+  802074:	53                   	push   %ebx
+  802075:	83 ec 0c             	sub    $0xc,%esp
+  802078:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80207b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80207e:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802084:	76 1d                	jbe    8020a3 <devfile_read+0x34>
+  802086:	83 ec 0c             	sub    $0xc,%esp
+  802089:	56                   	push   %esi
+  80208a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80208d:	ba 05 00 00 00       	mov    $0x5,%edx
+  802092:	89 f8                	mov    %edi,%eax
+  802094:	e8 32 fc ff ff       	call   801ccb <fsring_rw>
+  802099:	89 c3                	mov    %eax,%ebx
+  80209b:	83 c4 10             	add    $0x10,%esp
+  80209e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020a1:	75 37                	jne    8020da <devfile_read+0x6b>
+  8020a3:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020a6:	a3 00 80 80 00       	mov    %eax,0x808000
+  8020ab:	89 35 04 80 80 00    	mov    %esi,0x808004
+  8020b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020bb:	e8 20 fb ff ff       	call   801be0 <fsipc>
+  8020c0:	89 c3                	mov    %eax,%ebx
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	78 14                	js     8020da <devfile_read+0x6b>
+  8020c6:	83 ec 04             	sub    $0x4,%esp
+  8020c9:	50                   	push   %eax
+  8020ca:	68 00 80 80 00       	push   $0x808000
+  8020cf:	ff 75 0c             	push   0xc(%ebp)
+  8020d2:	e8 59 ea ff ff       	call   800b30 <memmove>
+  8020d7:	83 c4 10             	add    $0x10,%esp
+  8020da:	89 d8                	mov    %ebx,%eax
+  8020dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020df:	5b                   	pop    %ebx
+  8020e0:	5e                   	pop    %esi
+  8020e1:	5f                   	pop    %edi
+  8020e2:	5d                   	pop    %ebp
+  8020e3:	c3                   	ret
+
+008020e4 <open>:
+  8020e4:	55                   	push   %ebp
+  8020e5:	89 e5                	mov    %esp,%ebp
+  8020e7:	56                   	push   %esi
+  8020e8:	53                   	push   %ebx
+  8020e9:	83 ec 1c             	sub    $0x1c,%esp
+  8020ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020ef:	56                   	push   %esi
+  8020f0:	e8 3f e8 ff ff       	call   800934 <strlen>
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020fd:	7f 6c                	jg     80216b <open+0x87>
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802105:	50                   	push   %eax
+  802106:	e8 6a f5 ff ff       	call   801675 <fd_alloc>
+  80210b:	89 c3                	mov    %eax,%ebx
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 3c                	js     802150 <open+0x6c>
+  802114:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802117:	a3 00 84 80 00       	mov    %eax,0x808400
+  80211c:	83 ec 08             	sub    $0x8,%esp
+  80211f:	56                   	push   %esi
+  802120:	68 00 80 80 00       	push   $0x808000
+  802125:	e8 56 e8 ff ff       	call   800980 <strcpy>
+  80212a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80212d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802132:	e8 a9 fa ff ff       	call   801be0 <fsipc>
+  802137:	89 c3                	mov    %eax,%ebx
+  802139:	83 c4 10             	add    $0x10,%esp
+  80213c:	85 c0                	test   %eax,%eax
+  80213e:	78 19                	js     802159 <open+0x75>
+  802140:	83 ec 0c             	sub    $0xc,%esp
+  802143:	ff 75 f4             	push   -0xc(%ebp)
+  802146:	e8 03 f5 ff ff       	call   80164e <fd2num>
+  80214b:	89 c3                	mov    %eax,%ebx
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	89 d8                	mov    %ebx,%eax
+  802152:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802155:	5b                   	pop    %ebx
+  802156:	5e                   	pop    %esi
+  802157:	5d                   	pop    %ebp
+  802158:	c3                   	ret
+  802159:	83 ec 08             	sub    $0x8,%esp
+  80215c:	6a 00                	push   $0x0
+  80215e:	ff 75 f4             	push   -0xc(%ebp)
+  802161:	e8 05 f6 ff ff       	call   80176b <fd_close>
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	eb e5                	jmp    802150 <open+0x6c>
+  80216b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802170:	eb de                	jmp    802150 <open+0x6c>
+
+00802172 <file_image>:
+  802172:	55                   	push   %ebp
+  802173:	89 e5                	mov    %esp,%ebp
+  802175:	53                   	push   %ebx
+  802176:	83 ec 1c             	sub    $0x1c,%esp
+  802179:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80217c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217f:	50                   	push   %eax
+  802180:	ff 75 08             	push   0x8(%ebp)
+  802183:	e8 3d f5 ff ff       	call   8016c5 <fd_lookup>
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 58                	js     8021e7 <file_image+0x75>
+  80218f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802192:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802198:	39 08                	cmp    %ecx,(%eax)
+  80219a:	75 50                	jne    8021ec <file_image+0x7a>
+  80219c:	83 fb 04             	cmp    $0x4,%ebx
+  80219f:	77 52                	ja     8021f3 <file_image+0x81>
+  8021a1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021a4:	a3 00 80 80 00       	mov    %eax,0x808000
+  8021a9:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  8021af:	83 ec 04             	sub    $0x4,%esp
+  8021b2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8021b5:	c1 e0 02             	shl    $0x2,%eax
+  8021b8:	50                   	push   %eax
+  8021b9:	ff 75 0c             	push   0xc(%ebp)
+  8021bc:	68 08 80 80 00       	push   $0x808008
+  8021c1:	e8 6a e9 ff ff       	call   800b30 <memmove>
+  8021c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8021d0:	e8 0b fa ff ff       	call   801be0 <fsipc>
+  8021d5:	83 c4 10             	add    $0x10,%esp
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	78 0b                	js     8021e7 <file_image+0x75>
+  8021dc:	8b 55 14             	mov    0x14(%ebp),%edx
+  8021df:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8021e5:	89 0a                	mov    %ecx,(%edx)
+  8021e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ea:	c9                   	leave
+  8021eb:	c3                   	ret
+  8021ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021f1:	eb f4                	jmp    8021e7 <file_image+0x75>
+  8021f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f8:	eb ed                	jmp    8021e7 <file_image+0x75>
+
+008021fa <remove>:
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	53                   	push   %ebx
+  8021fe:	83 ec 10             	sub    $0x10,%esp
+  802201:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802204:	53                   	push   %ebx
+  802205:	e8 2a e7 ff ff       	call   800934 <strlen>
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802212:	7f 25                	jg     802239 <remove+0x3f>
+  802214:	83 ec 08             	sub    $0x8,%esp
+  802217:	53                   	push   %ebx
+  802218:	68 00 80 80 00       	push   $0x808000
+  80221d:	e8 5e e7 ff ff       	call   800980 <strcpy>
+  802222:	ba 00 00 00 00       	mov    $0x0,%edx
+  802227:	b8 09 00 00 00       	mov    $0x9,%eax
+  80222c:	e8 af f9 ff ff       	call   801be0 <fsipc>
+  802231:	83 c4 10             	add    $0x10,%esp
+  802234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802237:	c9                   	leave
+  802238:	c3                   	ret
+  802239:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80223e:	eb f4                	jmp    802234 <remove+0x3a>
+
+00802240 <sync>:
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	83 ec 08             	sub    $0x8,%esp
+  802246:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802250:	e8 8b f9 ff ff       	call   801be0 <fsipc>
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+
+00802257 <writebuf>:
+  802257:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80225b:	7f 01                	jg     80225e <writebuf+0x7>
+  80225d:	c3                   	ret
+  80225e:	55                   	push   %ebp
+  80225f:	89 e5                	mov    %esp,%ebp
+  802261:	53                   	push   %ebx
+  802262:	83 ec 08             	sub    $0x8,%esp
+  802265:	89 c3                	mov    %eax,%ebx
+  802267:	ff 70 04             	push   0x4(%eax)
+  80226a:	8d 40 10             	lea    0x10(%eax),%eax
+  80226d:	50                   	push   %eax
+  80226e:	ff 33                	push   (%ebx)
+  802270:	e8 8d f7 ff ff       	call   801a02 <write>
+  802275:	83 c4 10             	add    $0x10,%esp
+  802278:	85 c0                	test   %eax,%eax
+  80227a:	7e 03                	jle    80227f <writebuf+0x28>
+  80227c:	01 43 08             	add    %eax,0x8(%ebx)
+  80227f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802282:	74 0d                	je     802291 <writebuf+0x3a>
+  802284:	85 c0                	test   %eax,%eax
+  802286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228b:	0f 4f c2             	cmovg  %edx,%eax
+  80228e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802294:	c9                   	leave
+  802295:	c3                   	ret
+
+00802296 <putch>:
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	53                   	push   %ebx
+  80229a:	83 ec 04             	sub    $0x4,%esp
+  80229d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022a0:	8b 53 04             	mov    0x4(%ebx),%edx
+  8022a3:	8d 42 01             	lea    0x1(%edx),%eax
+  8022a6:	89 43 04             	mov    %eax,0x4(%ebx)
+  8022a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022ac:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  8022b0:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8022b5:	74 05                	je     8022bc <putch+0x26>
+  8022b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ba:	c9                   	leave
+  8022bb:	c3                   	ret
+  8022bc:	89 d8                	mov    %ebx,%eax
+  8022be:	e8 94 ff ff ff       	call   802257 <writebuf>
+  8022c3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  8022ca:	eb eb                	jmp    8022b7 <putch+0x21>
+
+008022cc <vfprintf>:
+  8022cc:	55                   	push   %ebp
+  8022cd:	89 e5                	mov    %esp,%ebp
+  8022cf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8022d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d8:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  8022de:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8022e5:	00 00 00 
+  8022e8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8022ef:	00 00 00 
+  8022f2:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8022f9:	00 00 00 
+  8022fc:	ff 75 10             	push   0x10(%ebp)
+  8022ff:	ff 75 0c             	push   0xc(%ebp)
+  802302:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802308:	50                   	push   %eax
+  802309:	68 96 22 80 00       	push   $0x802296
+  80230e:	e8 75 e0 ff ff       	call   800388 <vprintfmt>
+  802313:	83 c4 10             	add    $0x10,%esp
+  802316:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80231d:	7f 12                	jg     802331 <vfprintf+0x65>
+  80231f:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802325:	85 c0                	test   %eax,%eax
+  802327:	75 06                	jne    80232f <vfprintf+0x63>
+  802329:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80232f:	c9                   	leave
+  802330:	c3                   	ret
+  802331:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802337:	e8 1b ff ff ff       	call   802257 <writebuf>
+  80233c:	eb e1                	jmp    80231f <vfprintf+0x53>
+
+0080233e <fprintf>:
+  80233e:	55                   	push   %ebp
+  80233f:	89 e5                	mov    %esp,%ebp
+  802341:	83 ec 0c             	sub    $0xc,%esp
+  802344:	8d 45 10             	lea    0x10(%ebp),%eax
+  802347:	50                   	push   %eax
+  802348:	ff 75 0c             	push   0xc(%ebp)
+  80234b:	ff 75 08             	push   0x8(%ebp)
+  80234e:	e8 79 ff ff ff       	call   8022cc <vfprintf>
+  802353:	c9                   	leave
+  802354:	c3                   	ret
+
+00802355 <printf>:
+  802355:	55                   	push   %ebp
+  802356:	89 e5                	mov    %esp,%ebp
+  802358:	83 ec 0c             	sub    $0xc,%esp
+  80235b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80235e:	50                   	push   %eax
+  80235f:	ff 75 08             	push   0x8(%ebp)
+  802362:	6a 01                	push   $0x1
+  802364:	e8 63 ff ff ff       	call   8022cc <vfprintf>
+  802369:	c9                   	leave
+  80236a:	c3                   	ret
+
+0080236b <devsock_stat>:
+  80236b:	55                   	push   %ebp
+  80236c:	89 e5                	mov    %esp,%ebp
+  80236e:	83 ec 10             	sub    $0x10,%esp
+  802371:	68 c8 37 80 00       	push   $0x8037c8
+  802376:	ff 75 0c             	push   0xc(%ebp)
+  802379:	e8 02 e6 ff ff       	call   800980 <strcpy>
+  80237e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802383:	c9                   	leave
+  802384:	c3                   	ret
+
+00802385 <devsock_close>:
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	53                   	push   %ebx
+  802389:	83 ec 10             	sub    $0x10,%esp
+  80238c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80238f:	53                   	push   %ebx
+  802390:	e8 99 0d 00 00       	call   80312e <pageref>
+  802395:	89 c2                	mov    %eax,%edx
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239f:	83 fa 01             	cmp    $0x1,%edx
+  8023a2:	74 05                	je     8023a9 <devsock_close+0x24>
+  8023a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a7:	c9                   	leave
+  8023a8:	c3                   	ret
+  8023a9:	83 ec 0c             	sub    $0xc,%esp
+  8023ac:	ff 73 0c             	push   0xc(%ebx)
+  8023af:	e8 aa 02 00 00       	call   80265e <nsipc_close>
+  8023b4:	83 c4 10             	add    $0x10,%esp
+  8023b7:	eb eb                	jmp    8023a4 <devsock_close+0x1f>
+
+008023b9 <devsock_write>:
+  8023b9:	55                   	push   %ebp
+  8023ba:	89 e5                	mov    %esp,%ebp
+  8023bc:	83 ec 08             	sub    $0x8,%esp
+  8023bf:	6a 00                	push   $0x0
+  8023c1:	ff 75 10             	push   0x10(%ebp)
+  8023c4:	ff 75 0c             	push   0xc(%ebp)
+  8023c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ca:	ff 70 0c             	push   0xc(%eax)
+  8023cd:	e8 6c 03 00 00       	call   80273e <nsipc_send>
+  8023d2:	c9                   	leave
+  8023d3:	c3                   	ret
+
+008023d4 <devsock_read>:
+  8023d4:	55                   	push   %ebp
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	83 ec 08             	sub    $0x8,%esp
+  8023da:	6a 00                	push   $0x0
+  8023dc:	ff 75 10             	push   0x10(%ebp)
+  8023df:	ff 75 0c             	push   0xc(%ebp)
+  8023e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e5:	ff 70 0c             	push   0xc(%eax)
+  8023e8:	e8 e2 02 00 00       	call   8026cf <nsipc_recv>
+  8023ed:	c9                   	leave
+  8023ee:	c3                   	ret
+
+008023ef <fd2sockid>:
+  8023ef:	55                   	push   %ebp
+  8023f0:	89 e5                	mov    %esp,%ebp
+  8023f2:	83 ec 20             	sub    $0x20,%esp
+  8023f5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023f8:	52                   	push   %edx
+  8023f9:	50                   	push   %eax
+  8023fa:	e8 c6 f2 ff ff       	call   8016c5 <fd_lookup>
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	85 c0                	test   %eax,%eax
+  802404:	78 10                	js     802416 <fd2sockid+0x27>
+  802406:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802409:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80240f:	39 08                	cmp    %ecx,(%eax)
+  802411:	75 05                	jne    802418 <fd2sockid+0x29>
+  802413:	8b 40 0c             	mov    0xc(%eax),%eax
+  802416:	c9                   	leave
+  802417:	c3                   	ret
+  802418:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80241d:	eb f7                	jmp    802416 <fd2sockid+0x27>
+
+0080241f <alloc_sockfd>:
+  80241f:	55                   	push   %ebp
+  802420:	89 e5                	mov    %esp,%ebp
+  802422:	56                   	push   %esi
+  802423:	53                   	push   %ebx
+  802424:	83 ec 1c             	sub    $0x1c,%esp
+  802427:	89 c6                	mov    %eax,%esi
+  802429:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80242c:	50                   	push   %eax
+  80242d:	e8 43 f2 ff ff       	call   801675 <fd_alloc>
+  802432:	89 c3                	mov    %eax,%ebx
+  802434:	83 c4 10             	add    $0x10,%esp
+  802437:	85 c0                	test   %eax,%eax
+  802439:	78 43                	js     80247e <alloc_sockfd+0x5f>
+  80243b:	83 ec 04             	sub    $0x4,%esp
+  80243e:	68 07 04 00 00       	push   $0x407
+  802443:	ff 75 f4             	push   -0xc(%ebp)
+  802446:	6a 00                	push   $0x0
+  802448:	e8 93 e9 ff ff       	call   800de0 <sys_page_alloc>
+  80244d:	89 c3                	mov    %eax,%ebx
+  80244f:	83 c4 10             	add    $0x10,%esp
+  802452:	85 c0                	test   %eax,%eax
+  802454:	78 28                	js     80247e <alloc_sockfd+0x5f>
+  802456:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802459:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80245f:	89 10                	mov    %edx,(%eax)
+  802461:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802464:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80246b:	89 70 0c             	mov    %esi,0xc(%eax)
+  80246e:	83 ec 0c             	sub    $0xc,%esp
+  802471:	50                   	push   %eax
+  802472:	e8 d7 f1 ff ff       	call   80164e <fd2num>
+  802477:	89 c3                	mov    %eax,%ebx
+  802479:	83 c4 10             	add    $0x10,%esp
+  80247c:	eb 0c                	jmp    80248a <alloc_sockfd+0x6b>
+  80247e:	83 ec 0c             	sub    $0xc,%esp
+  802481:	56                   	push   %esi
+  802482:	e8 d7 01 00 00       	call   80265e <nsipc_close>
+  802487:	83 c4 10             	add    $0x10,%esp
+  80248a:	89 d8                	mov    %ebx,%eax
+  80248c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80248f:	5b                   	pop    %ebx
+  802490:	5e                   	pop    %esi
+  802491:	5d                   	pop    %ebp
+  802492:	c3                   	ret
+
+00802493 <accept>:
+  802493:	55                   	push   %ebp
+  802494:	89 e5                	mov    %esp,%ebp
+  802496:	83 ec 08             	sub    $0x8,%esp
+  802499:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249c:	e8 4e ff ff ff       	call   8023ef <fd2sockid>
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	78 1b                	js     8024c0 <accept+0x2d>
+  8024a5:	83 ec 04             	sub    $0x4,%esp
+  8024a8:	ff 75 10             	push   0x10(%ebp)
+  8024ab:	ff 75 0c             	push   0xc(%ebp)
+  8024ae:	50                   	push   %eax
+  8024af:	e8 07 01 00 00       	call   8025bb <nsipc_accept>
+  8024b4:	83 c4 10             	add    $0x10,%esp
+  8024b7:	85 c0                	test   %eax,%eax
+  8024b9:	78 05                	js     8024c0 <accept+0x2d>
+  8024bb:	e8 5f ff ff ff       	call   80241f <alloc_sockfd>
+  8024c0:	c9                   	leave
+  8024c1:	c3                   	ret
+
+008024c2 <bind>:
+  8024c2:	55                   	push   %ebp
+  8024c3:	89 e5                	mov    %esp,%ebp
+  8024c5:	83 ec 08             	sub    $0x8,%esp
+  8024c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024cb:	e8 1f ff ff ff       	call   8023ef <fd2sockid>
+  8024d0:	85 c0                	test   %eax,%eax
+  8024d2:	78 12                	js     8024e6 <bind+0x24>
+  8024d4:	83 ec 04             	sub    $0x4,%esp
+  8024d7:	ff 75 10             	push   0x10(%ebp)
+  8024da:	ff 75 0c             	push   0xc(%ebp)
+  8024dd:	50                   	push   %eax
+  8024de:	e8 24 01 00 00       	call   802607 <nsipc_bind>
+  8024e3:	83 c4 10             	add    $0x10,%esp
+  8024e6:	c9                   	leave
+  8024e7:	c3                   	ret
+
+008024e8 <shutdown>:
+  8024e8:	55                   	push   %ebp
+  8024e9:	89 e5                	mov    %esp,%ebp
+  8024eb:	83 ec 08             	sub    $0x8,%esp
+  8024ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f1:	e8 f9 fe ff ff       	call   8023ef <fd2sockid>
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	78 0f                	js     802509 <shutdown+0x21>
+  8024fa:	83 ec 08             	sub    $0x8,%esp
+  8024fd:	ff 75 0c             	push   0xc(%ebp)
+  802500:	50                   	push   %eax
+  802501:	e8 36 01 00 00       	call   80263c <nsipc_shutdown>
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+
+0080250b <connect>:
+  80250b:	55                   	push   %ebp
+  80250c:	89 e5                	mov    %esp,%ebp
+  80250e:	83 ec 08             	sub    $0x8,%esp
+  802511:	8b 45 08             	mov    0x8(%ebp),%eax
+  802514:	e8 d6 fe ff ff       	call   8023ef <fd2sockid>
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	78 12                	js     80252f <connect+0x24>
+  80251d:	83 ec 04             	sub    $0x4,%esp
+  802520:	ff 75 10             	push   0x10(%ebp)
+  802523:	ff 75 0c             	push   0xc(%ebp)
+  802526:	50                   	push   %eax
+  802527:	e8 4c 01 00 00       	call   802678 <nsipc_connect>
+  80252c:	83 c4 10             	add    $0x10,%esp
+  80252f:	c9                   	leave
+  802530:	c3                   	ret
+
+00802531 <listen>:
+  802531:	55                   	push   %ebp
+  802532:	89 e5                	mov    %esp,%ebp
+  802534:	83 ec 08             	sub    $0x8,%esp
+  802537:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253a:	e8 b0 fe ff ff       	call   8023ef <fd2sockid>
+  80253f:	85 c0                	test   %eax,%eax
+  802541:	78 0f                	js     802552 <listen+0x21>
+  802543:	83 ec 08             	sub    $0x8,%esp
+  802546:	ff 75 0c             	push   0xc(%ebp)
+  802549:	50                   	push   %eax
+  80254a:	e8 5e 01 00 00       	call   8026ad <nsipc_listen>
+  80254f:	83 c4 10             	add    $0x10,%esp
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+
+00802554 <socket>:
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	83 ec 0c             	sub    $0xc,%esp
+  80255a:	ff 75 10             	push   0x10(%ebp)
+  80255d:	ff 75 0c             	push   0xc(%ebp)
+  802560:	ff 75 08             	push   0x8(%ebp)
+  802563:	e8 34 02 00 00       	call   80279c <nsipc_socket>
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	85 c0                	test   %eax,%eax
+  80256d:	78 05                	js     802574 <socket+0x20>
+  80256f:	e8 ab fe ff ff       	call   80241f <alloc_sockfd>
+  802574:	c9                   	leave
+  802575:	c3                   	ret
+
+00802576 <nsipc>:
+  802576:	55                   	push   %ebp
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	53                   	push   %ebx
+  80257a:	83 ec 04             	sub    $0x4,%esp
+  80257d:	89 c3                	mov    %eax,%ebx
+  80257f:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802586:	74 1f                	je     8025a7 <nsipc+0x31>
+  802588:	83 ec 08             	sub    $0x8,%esp
+  80258b:	6a 00                	push   $0x0
+  80258d:	6a 00                	push   $0x0
+  80258f:	6a 07                	push   $0x7
+  802591:	68 00 90 80 00       	push   $0x809000
+  802596:	53                   	push   %ebx
+  802597:	ff 35 0c 50 80 00    	push   0x80500c
+  80259d:	e8 d7 09 00 00       	call   802f79 <ipc_call>
+  8025a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a5:	c9                   	leave
+  8025a6:	c3                   	ret
+  8025a7:	83 ec 0c             	sub    $0xc,%esp
+  8025aa:	6a 03                	push   $0x3
+  8025ac:	e8 63 0b 00 00       	call   803114 <ipc_find_env>
+  8025b1:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	eb cd                	jmp    802588 <nsipc+0x12>
+
+008025bb <nsipc_accept>:
+  8025bb:	55                   	push   %ebp
+  8025bc:	89 e5                	mov    %esp,%ebp
+  8025be:	53                   	push   %ebx
+  8025bf:	83 ec 04             	sub    $0x4,%esp
+  8025c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c5:	a3 00 90 80 00       	mov    %eax,0x809000
+  8025ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025cf:	e8 a2 ff ff ff       	call   802576 <nsipc>
+  8025d4:	89 c3                	mov    %eax,%ebx
+  8025d6:	85 c0                	test   %eax,%eax
+  8025d8:	79 07                	jns    8025e1 <nsipc_accept+0x26>
+  8025da:	89 d8                	mov    %ebx,%eax
+  8025dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025df:	c9                   	leave
+  8025e0:	c3                   	ret
+  8025e1:	83 ec 04             	sub    $0x4,%esp
+  8025e4:	ff 35 10 90 80 00    	push   0x809010
+  8025ea:	68 00 90 80 00       	push   $0x809000
+  8025ef:	ff 75 0c             	push   0xc(%ebp)
+  8025f2:	e8 39 e5 ff ff       	call   800b30 <memmove>
+  8025f7:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  8025fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  802600:	89 10                	mov    %edx,(%eax)
+  802602:	83 c4 10             	add    $0x10,%esp
+  802605:	eb d3                	jmp    8025da <nsipc_accept+0x1f>
+
+00802607 <nsipc_bind>:
+  802607:	55                   	push   %ebp
+  802608:	89 e5                	mov    %esp,%ebp
+  80260a:	53                   	push   %ebx
+  80260b:	83 ec 08             	sub    $0x8,%esp
+  80260e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802611:	8b 45 08             	mov    0x8(%ebp),%eax
+  802614:	a3 00 90 80 00       	mov    %eax,0x809000
+  802619:	53                   	push   %ebx
+  80261a:	ff 75 0c             	push   0xc(%ebp)
+  80261d:	68 04 90 80 00       	push   $0x809004
+  802622:	e8 09 e5 ff ff       	call   800b30 <memmove>
+  802627:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+  80262d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802632:	e8 3f ff ff ff       	call   802576 <nsipc>
+  802637:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+0080263c <nsipc_shutdown>:
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	83 ec 08             	sub    $0x8,%esp
+  802642:	8b 45 08             	mov    0x8(%ebp),%eax
+  802645:	a3 00 90 80 00       	mov    %eax,0x809000
+  80264a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80264d:	a3 04 90 80 00       	mov    %eax,0x809004
+  802652:	b8 03 00 00 00       	mov    $0x3,%eax
+  802657:	e8 1a ff ff ff       	call   802576 <nsipc>
+  80265c:	c9                   	leave
+  80265d:	c3                   	ret
+
+0080265e <nsipc_close>:
+  80265e:	55                   	push   %ebp
+  80265f:	89 e5                	mov    %esp,%ebp
+  802661:	83 ec 08             	sub    $0x8,%esp
+  802664:	8b 45 08             	mov    0x8(%ebp),%eax
+  802667:	a3 00 90 80 00       	mov    %eax,0x809000
+  80266c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802671:	e8 00 ff ff ff       	call   802576 <nsipc>
+  802676:	c9                   	leave
+  802677:	c3                   	ret
+
+00802678 <nsipc_connect>:
+  802678:	55                   	push   %ebp
+  802679:	89 e5                	mov    %esp,%ebp
+  80267b:	53                   	push   %ebx
+  80267c:	83 ec 08             	sub    $0x8,%esp
+  80267f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802682:	8b 45 08             	mov    0x8(%ebp),%eax
+  802685:	a3 00 90 80 00       	mov    %eax,0x809000
+  80268a:	53                   	push   %ebx
+  80268b:	ff 75 0c             	push   0xc(%ebp)
+  80268e:	68 04 90 80 00       	push   $0x809004
+  802693:	e8 98 e4 ff ff       	call   800b30 <memmove>
+  802698:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+  80269e:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026a3:	e8 ce fe ff ff       	call   802576 <nsipc>
+  8026a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ab:	c9                   	leave
+  8026ac:	c3                   	ret
+
+008026ad <nsipc_listen>:
+  8026ad:	55                   	push   %ebp
+  8026ae:	89 e5                	mov    %esp,%ebp
+  8026b0:	83 ec 08             	sub    $0x8,%esp
+  8026b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b6:	a3 00 90 80 00       	mov    %eax,0x809000
+  8026bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026be:	a3 04 90 80 00       	mov    %eax,0x809004
+  8026c3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8026c8:	e8 a9 fe ff ff       	call   802576 <nsipc>
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+
+008026cf <nsipc_recv>:
+  8026cf:	55                   	push   %ebp
+  8026d0:	89 e5                	mov    %esp,%ebp
+  8026d2:	56                   	push   %esi
+  8026d3:	53                   	push   %ebx
+  8026d4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8026d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026da:	a3 00 90 80 00       	mov    %eax,0x809000
+  8026df:	89 35 04 90 80 00    	mov    %esi,0x809004
+  8026e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026e8:	a3 08 90 80 00       	mov    %eax,0x809008
+  8026ed:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026f2:	e8 7f fe ff ff       	call   802576 <nsipc>
+  8026f7:	89 c3                	mov    %eax,%ebx
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	78 22                	js     80271f <nsipc_recv+0x50>
+  8026fd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802702:	39 c6                	cmp    %eax,%esi
+  802704:	0f 4e c6             	cmovle %esi,%eax
+  802707:	39 c3                	cmp    %eax,%ebx
+  802709:	7f 1d                	jg     802728 <nsipc_recv+0x59>
+  80270b:	83 ec 04             	sub    $0x4,%esp
+  80270e:	53                   	push   %ebx
+  80270f:	68 00 90 80 00       	push   $0x809000
+  802714:	ff 75 0c             	push   0xc(%ebp)
+  802717:	e8 14 e4 ff ff       	call   800b30 <memmove>
+  80271c:	83 c4 10             	add    $0x10,%esp
+  80271f:	89 d8                	mov    %ebx,%eax
+  802721:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802724:	5b                   	pop    %ebx
+  802725:	5e                   	pop    %esi
+  802726:	5d                   	pop    %ebp
+  802727:	c3                   	ret
+  802728:	68 d4 37 80 00       	push   $0x8037d4
+  80272d:	68 e9 37 80 00       	push   $0x8037e9
+  802732:	6a 60                	push   $0x60
+  802734:	68 fe 37 80 00       	push   $0x8037fe
+  802739:	e8 70 da ff ff       	call   8001ae <_panic>
+
+0080273e <nsipc_send>:
+  80273e:	55                   	push   %ebp
+  80273f:	89 e5                	mov    %esp,%ebp
+  802741:	53                   	push   %ebx
+  802742:	83 ec 04             	sub    $0x4,%esp
+  802745:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802748:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274b:	a3 00 90 80 00       	mov    %eax,0x809000
+  802750:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802756:	7f 2e                	jg     802786 <nsipc_send+0x48>
+  802758:	83 ec 04             	sub    $0x4,%esp
+  80275b:	53                   	push   %ebx
+  80275c:	ff 75 0c             	push   0xc(%ebp)
+  80275f:	68 0c 90 80 00       	push   $0x80900c
+  802764:	e8 c7 e3 ff ff       	call   800b30 <memmove>
+  802769:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  80276f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802772:	a3 08 90 80 00       	mov    %eax,0x809008
+  802777:	b8 08 00 00 00       	mov    $0x8,%eax
+  80277c:	e8 f5 fd ff ff       	call   802576 <nsipc>
+  802781:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802784:	c9                   	leave
+  802785:	c3                   	ret
+  802786:	68 0a 38 80 00       	push   $0x80380a
+  80278b:	68 e9 37 80 00       	push   $0x8037e9
+  802790:	6a 6b                	push   $0x6b
+  802792:	68 fe 37 80 00       	push   $0x8037fe
+  802797:	e8 12 da ff ff       	call   8001ae <_panic>
+
+0080279c <nsipc_socket>:
+  80279c:	55                   	push   %ebp
+  80279d:	89 e5                	mov    %esp,%ebp
+  80279f:	83 ec 08             	sub    $0x8,%esp
+  8027a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a5:	a3 00 90 80 00       	mov    %eax,0x809000
+  8027aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027ad:	a3 04 90 80 00       	mov    %eax,0x809004
+  8027b2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027b5:	a3 08 90 80 00       	mov    %eax,0x809008
+  8027ba:	b8 09 00 00 00       	mov    $0x9,%eax
+  8027bf:	e8 b2 fd ff ff       	call   802576 <nsipc>
+  8027c4:	c9                   	leave
+  8027c5:	c3                   	ret
+
+008027c6 <devpipe_stat>:
+  8027c6:	55                   	push   %ebp
+  8027c7:	89 e5                	mov    %esp,%ebp
+  8027c9:	56                   	push   %esi
+  8027ca:	53                   	push   %ebx
+  8027cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027ce:	83 ec 0c             	sub    $0xc,%esp
+  8027d1:	ff 75 08             	push   0x8(%ebp)
+  8027d4:	e8 85 ee ff ff       	call   80165e <fd2data>
+  8027d9:	89 c6                	mov    %eax,%esi
+  8027db:	83 c4 08             	add    $0x8,%esp
+  8027de:	68 16 38 80 00       	push   $0x803816
+  8027e3:	53                   	push   %ebx
+  8027e4:	e8 97 e1 ff ff       	call   800980 <strcpy>
+  8027e9:	8b 46 04             	mov    0x4(%esi),%eax
+  8027ec:	2b 06                	sub    (%esi),%eax
+  8027ee:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8027f4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8027fb:	00 00 00 
+  8027fe:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802805:	40 80 00 
+  802808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802810:	5b                   	pop    %ebx
+  802811:	5e                   	pop    %esi
+  802812:	5d                   	pop    %ebp
+  802813:	c3                   	ret
+
+00802814 <devpipe_close>:
+  802814:	55                   	push   %ebp
+  802815:	89 e5                	mov    %esp,%ebp
+  802817:	53                   	push   %ebx
+  802818:	83 ec 0c             	sub    $0xc,%esp
+  80281b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80281e:	53                   	push   %ebx
+  80281f:	6a 00                	push   $0x0
+  802821:	e8 8c e6 ff ff       	call   800eb2 <sys_page_unmap>
+  802826:	89 1c 24             	mov    %ebx,(%esp)
+  802829:	e8 30 ee ff ff       	call   80165e <fd2data>
+  80282e:	83 c4 08             	add    $0x8,%esp
+  802831:	50                   	push   %eax
+  802832:	6a 00                	push   $0x0
+  802834:	e8 79 e6 ff ff       	call   800eb2 <sys_page_unmap>
+  802839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80283c:	c9                   	leave
+  80283d:	c3                   	ret
+
+0080283e <_pipeisclosed>:
+  80283e:	55                   	push   %ebp
+  80283f:	89 e5                	mov    %esp,%ebp
+  802841:	57                   	push   %edi
+  802842:	56                   	push   %esi
+  802843:	53                   	push   %ebx
+  802844:	83 ec 1c             	sub    $0x1c,%esp
+  802847:	89 c7                	mov    %eax,%edi
+  802849:	89 d6                	mov    %edx,%esi
+  80284b:	a1 20 70 80 00       	mov    0x807020,%eax
+  802850:	8b 58 58             	mov    0x58(%eax),%ebx
+  802853:	83 ec 0c             	sub    $0xc,%esp
+  802856:	57                   	push   %edi
+  802857:	e8 d2 08 00 00       	call   80312e <pageref>
+  80285c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80285f:	89 34 24             	mov    %esi,(%esp)
+  802862:	e8 c7 08 00 00       	call   80312e <pageref>
+  802867:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  80286d:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802870:	83 c4 10             	add    $0x10,%esp
+  802873:	39 cb                	cmp    %ecx,%ebx
+  802875:	74 1b                	je     802892 <_pipeisclosed+0x54>
+  802877:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80287a:	75 cf                	jne    80284b <_pipeisclosed+0xd>
+  80287c:	8b 42 58             	mov    0x58(%edx),%eax
+  80287f:	6a 01                	push   $0x1
+  802881:	50                   	push   %eax
+  802882:	53                   	push   %ebx
+  802883:	68 1d 38 80 00       	push   $0x80381d
+  802888:	e8 fc d9 ff ff       	call   800289 <cprintf>
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	eb b9                	jmp    80284b <_pipeisclosed+0xd>
+  802892:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802895:	0f 94 c0             	sete   %al
+  802898:	0f b6 c0             	movzbl %al,%eax
+  80289b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80289e:	5b                   	pop    %ebx
+  80289f:	5e                   	pop    %esi
+  8028a0:	5f                   	pop    %edi
+  8028a1:	5d                   	pop    %ebp
+  8028a2:	c3                   	ret
+
+008028a3 <devpipe_write>:
+  8028a3:	55                   	push   %ebp
+  8028a4:	89 e5                	mov    %esp,%ebp
+  8028a6:	57                   	push   %edi
+  8028a7:	56                   	push   %esi
+  8028a8:	53                   	push   %ebx
+  8028a9:	83 ec 28             	sub    $0x28,%esp
+  8028ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028af:	56                   	push   %esi
+  8028b0:	e8 a9 ed ff ff       	call   80165e <fd2data>
+  8028b5:	89 c3                	mov    %eax,%ebx
+  8028b7:	83 c4 10             	add    $0x10,%esp
+  8028ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028bf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028c3:	74 5c                	je     802921 <devpipe_write+0x7e>
+  8028c5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028c8:	8b 0b                	mov    (%ebx),%ecx
+  8028ca:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028cd:	39 d0                	cmp    %edx,%eax
+  8028cf:	72 1e                	jb     8028ef <devpipe_write+0x4c>
+  8028d1:	89 da                	mov    %ebx,%edx
+  8028d3:	89 f0                	mov    %esi,%eax
+  8028d5:	e8 64 ff ff ff       	call   80283e <_pipeisclosed>
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	75 48                	jne    802926 <devpipe_write+0x83>
+  8028de:	e8 b2 e4 ff ff       	call   800d95 <sys_yield>
+  8028e3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028e6:	8b 0b                	mov    (%ebx),%ecx
+  8028e8:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028eb:	39 d0                	cmp    %edx,%eax
+  8028ed:	73 e2                	jae    8028d1 <devpipe_write+0x2e>
+  8028ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028f2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8028f6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8028f9:	89 c2                	mov    %eax,%edx
+  8028fb:	c1 fa 1f             	sar    $0x1f,%edx
+  8028fe:	89 d1                	mov    %edx,%ecx
+  802900:	c1 e9 1b             	shr    $0x1b,%ecx
+  802903:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802906:	83 e2 1f             	and    $0x1f,%edx
+  802909:	29 ca                	sub    %ecx,%edx
+  80290b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80290f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802913:	83 c0 01             	add    $0x1,%eax
+  802916:	89 43 04             	mov    %eax,0x4(%ebx)
+  802919:	83 c7 01             	add    $0x1,%edi
+  80291c:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80291f:	75 a4                	jne    8028c5 <devpipe_write+0x22>
+  802921:	8b 45 10             	mov    0x10(%ebp),%eax
+  802924:	eb 05                	jmp    80292b <devpipe_write+0x88>
+  802926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292e:	5b                   	pop    %ebx
+  80292f:	5e                   	pop    %esi
+  802930:	5f                   	pop    %edi
+  802931:	5d                   	pop    %ebp
+  802932:	c3                   	ret
+
+00802933 <devpipe_read>:
+  802933:	55                   	push   %ebp
+  802934:	89 e5                	mov    %esp,%ebp
+  802936:	57                   	push   %edi
+  802937:	56                   	push   %esi
+  802938:	53                   	push   %ebx
+  802939:	83 ec 18             	sub    $0x18,%esp
+  80293c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80293f:	56                   	push   %esi
+  802940:	e8 19 ed ff ff       	call   80165e <fd2data>
+  802945:	89 c3                	mov    %eax,%ebx
+  802947:	83 c4 10             	add    $0x10,%esp
+  80294a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80294f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802953:	74 45                	je     80299a <devpipe_read+0x67>
+  802955:	8b 03                	mov    (%ebx),%eax
+  802957:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80295a:	75 1d                	jne    802979 <devpipe_read+0x46>
+  80295c:	85 ff                	test   %edi,%edi
+  80295e:	75 3f                	jne    80299f <devpipe_read+0x6c>
+  802960:	89 da                	mov    %ebx,%edx
+  802962:	89 f0                	mov    %esi,%eax
+  802964:	e8 d5 fe ff ff       	call   80283e <_pipeisclosed>
+  802969:	85 c0                	test   %eax,%eax
+  80296b:	75 3c                	jne    8029a9 <devpipe_read+0x76>
+  80296d:	e8 23 e4 ff ff       	call   800d95 <sys_yield>
+  802972:	8b 03                	mov    (%ebx),%eax
+  802974:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802977:	74 e7                	je     802960 <devpipe_read+0x2d>
+  802979:	99                   	cltd
+  80297a:	c1 ea 1b             	shr    $0x1b,%edx
+  80297d:	01 d0                	add    %edx,%eax
+  80297f:	83 e0 1f             	and    $0x1f,%eax
+  802982:	29 d0                	sub    %edx,%eax
+  802984:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802989:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80298c:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80298f:	83 03 01             	addl   $0x1,(%ebx)
+  802992:	83 c7 01             	add    $0x1,%edi
+  802995:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802998:	75 bb                	jne    802955 <devpipe_read+0x22>
+  80299a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80299d:	eb 02                	jmp    8029a1 <devpipe_read+0x6e>
+  80299f:	89 f8                	mov    %edi,%eax
+  8029a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a4:	5b                   	pop    %ebx
+  8029a5:	5e                   	pop    %esi
+  8029a6:	5f                   	pop    %edi
+  8029a7:	5d                   	pop    %ebp
+  8029a8:	c3                   	ret
+  8029a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ae:	eb f1                	jmp    8029a1 <devpipe_read+0x6e>
+
+008029b0 <pipe>:
+  8029b0:	55                   	push   %ebp
+  8029b1:	89 e5                	mov    %esp,%ebp
+  8029b3:	56                   	push   %esi
+  8029b4:	53                   	push   %ebx
+  8029b5:	83 ec 1c             	sub    $0x1c,%esp
+  8029b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029bb:	50                   	push   %eax
+  8029bc:	e8 b4 ec ff ff       	call   801675 <fd_alloc>
+  8029c1:	89 c3                	mov    %eax,%ebx
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	85 c0                	test   %eax,%eax
+  8029c8:	0f 88 23 01 00 00    	js     802af1 <pipe+0x141>
+  8029ce:	83 ec 04             	sub    $0x4,%esp
+  8029d1:	68 07 04 00 00       	push   $0x407
+  8029d6:	ff 75 f4             	push   -0xc(%ebp)
+  8029d9:	6a 00                	push   $0x0
+  8029db:	e8 00 e4 ff ff       	call   800de0 <sys_page_alloc>
+  8029e0:	89 c3                	mov    %eax,%ebx
+  8029e2:	83 c4 10             	add    $0x10,%esp
+  8029e5:	85 c0                	test   %eax,%eax
+  8029e7:	0f 88 04 01 00 00    	js     802af1 <pipe+0x141>
+  8029ed:	83 ec 0c             	sub    $0xc,%esp
+  8029f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8029f3:	50                   	push   %eax
+  8029f4:	e8 7c ec ff ff       	call   801675 <fd_alloc>
+  8029f9:	89 c3                	mov    %eax,%ebx
+  8029fb:	83 c4 10             	add    $0x10,%esp
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	0f 88 db 00 00 00    	js     802ae1 <pipe+0x131>
+  802a06:	83 ec 04             	sub    $0x4,%esp
+  802a09:	68 07 04 00 00       	push   $0x407
+  802a0e:	ff 75 f0             	push   -0x10(%ebp)
+  802a11:	6a 00                	push   $0x0
+  802a13:	e8 c8 e3 ff ff       	call   800de0 <sys_page_alloc>
+  802a18:	89 c3                	mov    %eax,%ebx
+  802a1a:	83 c4 10             	add    $0x10,%esp
+  802a1d:	85 c0                	test   %eax,%eax
+  802a1f:	0f 88 bc 00 00 00    	js     802ae1 <pipe+0x131>
+  802a25:	83 ec 0c             	sub    $0xc,%esp
+  802a28:	ff 75 f4             	push   -0xc(%ebp)
+  802a2b:	e8 2e ec ff ff       	call   80165e <fd2data>
+  802a30:	89 c6                	mov    %eax,%esi
+  802a32:	83 c4 0c             	add    $0xc,%esp
+  802a35:	68 07 04 00 00       	push   $0x407
+  802a3a:	50                   	push   %eax
+  802a3b:	6a 00                	push   $0x0
+  802a3d:	e8 9e e3 ff ff       	call   800de0 <sys_page_alloc>
+  802a42:	89 c3                	mov    %eax,%ebx
+  802a44:	83 c4 10             	add    $0x10,%esp
+  802a47:	85 c0                	test   %eax,%eax
+  802a49:	0f 88 82 00 00 00    	js     802ad1 <pipe+0x121>
+  802a4f:	83 ec 0c             	sub    $0xc,%esp
+  802a52:	ff 75 f0             	push   -0x10(%ebp)
+  802a55:	e8 04 ec ff ff       	call   80165e <fd2data>
+  802a5a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a61:	50                   	push   %eax
+  802a62:	6a 00                	push   $0x0
+  802a64:	56                   	push   %esi
+  802a65:	6a 00                	push   $0x0
+  802a67:	e8 b7 e3 ff ff       	call   800e23 <sys_page_map>
+  802a6c:	89 c3                	mov    %eax,%ebx
+  802a6e:	83 c4 20             	add    $0x20,%esp
+  802a71:	85 c0                	test   %eax,%eax
+  802a73:	78 4e                	js     802ac3 <pipe+0x113>
+  802a75:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802a7a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a7d:	89 02                	mov    %eax,(%edx)
+  802a7f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a82:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802a89:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a8c:	89 02                	mov    %eax,(%edx)
+  802a8e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802a91:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802a98:	83 ec 0c             	sub    $0xc,%esp
+  802a9b:	ff 75 f4             	push   -0xc(%ebp)
+  802a9e:	e8 ab eb ff ff       	call   80164e <fd2num>
+  802aa3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802aa6:	89 01                	mov    %eax,(%ecx)
+  802aa8:	83 c4 04             	add    $0x4,%esp
+  802aab:	ff 75 f0             	push   -0x10(%ebp)
+  802aae:	e8 9b eb ff ff       	call   80164e <fd2num>
+  802ab3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ab6:	89 41 04             	mov    %eax,0x4(%ecx)
+  802ab9:	83 c4 10             	add    $0x10,%esp
+  802abc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac1:	eb 2e                	jmp    802af1 <pipe+0x141>
+  802ac3:	83 ec 08             	sub    $0x8,%esp
+  802ac6:	56                   	push   %esi
+  802ac7:	6a 00                	push   $0x0
+  802ac9:	e8 e4 e3 ff ff       	call   800eb2 <sys_page_unmap>
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	83 ec 08             	sub    $0x8,%esp
+  802ad4:	ff 75 f0             	push   -0x10(%ebp)
+  802ad7:	6a 00                	push   $0x0
+  802ad9:	e8 d4 e3 ff ff       	call   800eb2 <sys_page_unmap>
+  802ade:	83 c4 10             	add    $0x10,%esp
+  802ae1:	83 ec 08             	sub    $0x8,%esp
+  802ae4:	ff 75 f4             	push   -0xc(%ebp)
+  802ae7:	6a 00                	push   $0x0
+  802ae9:	e8 c4 e3 ff ff       	call   800eb2 <sys_page_unmap>
+  802aee:	83 c4 10             	add    $0x10,%esp
+  802af1:	89 d8                	mov    %ebx,%eax
+  802af3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802af6:	5b                   	pop    %ebx
+  802af7:	5e                   	pop    %esi
+  802af8:	5d                   	pop    %ebp
+  802af9:	c3                   	ret
+
+00802afa <pipeisclosed>:
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	83 ec 20             	sub    $0x20,%esp
+  802b00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b03:	50                   	push   %eax
+  802b04:	ff 75 08             	push   0x8(%ebp)
+  802b07:	e8 b9 eb ff ff       	call   8016c5 <fd_lookup>
+  802b0c:	83 c4 10             	add    $0x10,%esp
+  802b0f:	85 c0                	test   %eax,%eax
+  802b11:	78 18                	js     802b2b <pipeisclosed+0x31>
+  802b13:	83 ec 0c             	sub    $0xc,%esp
+  802b16:	ff 75 f4             	push   -0xc(%ebp)
+  802b19:	e8 40 eb ff ff       	call   80165e <fd2data>
+  802b1e:	89 c2                	mov    %eax,%edx
+  802b20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b23:	e8 16 fd ff ff       	call   80283e <_pipeisclosed>
+  802b28:	83 c4 10             	add    $0x10,%esp
+  802b2b:	c9                   	leave
+  802b2c:	c3                   	ret
+
+00802b2d <ipcring_init>:
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	53                   	push   %ebx
+  802b31:	83 ec 08             	sub    $0x8,%esp
+  802b34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b37:	6a 60                	push   $0x60
+  802b39:	6a 00                	push   $0x0
+  802b3b:	53                   	push   %ebx
+  802b3c:	e8 ba df ff ff       	call   800afb <memset>
+  802b41:	a1 20 70 80 00       	mov    0x807020,%eax
+  802b46:	8b 40 48             	mov    0x48(%eax),%eax
+  802b49:	89 03                	mov    %eax,(%ebx)
+  802b4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b4e:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b51:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b54:	89 43 08             	mov    %eax,0x8(%ebx)
+  802b57:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b5a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b5d:	83 c4 10             	add    $0x10,%esp
+  802b60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+
+00802b65 <ipcring_req_slot>:
+  802b65:	55                   	push   %ebp
+  802b66:	89 e5                	mov    %esp,%ebp
+  802b68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6b:	8b 50 10             	mov    0x10(%eax),%edx
+  802b6e:	8b 48 18             	mov    0x18(%eax),%ecx
+  802b71:	29 ca                	sub    %ecx,%edx
+  802b73:	83 fa 07             	cmp    $0x7,%edx
+  802b76:	77 0c                	ja     802b84 <ipcring_req_slot+0x1f>
+  802b78:	8b 50 10             	mov    0x10(%eax),%edx
+  802b7b:	83 e2 07             	and    $0x7,%edx
+  802b7e:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802b82:	5d                   	pop    %ebp
+  802b83:	c3                   	ret
+  802b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b89:	eb f7                	jmp    802b82 <ipcring_req_slot+0x1d>
+
+00802b8b <ipcring_req_push>:
+  802b8b:	55                   	push   %ebp
+  802b8c:	89 e5                	mov    %esp,%ebp
+  802b8e:	83 ec 08             	sub    $0x8,%esp
+  802b91:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b94:	8b 42 10             	mov    0x10(%edx),%eax
+  802b97:	83 c0 01             	add    $0x1,%eax
+  802b9a:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba3:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802ba7:	85 c0                	test   %eax,%eax
+  802ba9:	75 02                	jne    802bad <ipcring_req_push+0x22>
+  802bab:	c9                   	leave
+  802bac:	c3                   	ret
+  802bad:	6a 00                	push   $0x0
+  802baf:	68 00 00 80 ee       	push   $0xee800000
+  802bb4:	ff 72 08             	push   0x8(%edx)
+  802bb7:	ff 72 04             	push   0x4(%edx)
+  802bba:	e8 59 e5 ff ff       	call   801118 <sys_ipc_send>
+  802bbf:	83 c4 10             	add    $0x10,%esp
+  802bc2:	eb e7                	jmp    802bab <ipcring_req_push+0x20>
+
+00802bc4 <ipcring_rsp_wait>:
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	53                   	push   %ebx
+  802bc8:	83 ec 04             	sub    $0x4,%esp
+  802bcb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bce:	8b 53 18             	mov    0x18(%ebx),%edx
+  802bd1:	8b 43 10             	mov    0x10(%ebx),%eax
+  802bd4:	39 c2                	cmp    %eax,%edx
+  802bd6:	74 3c                	je     802c14 <ipcring_rsp_wait+0x50>
+  802bd8:	8b 53 14             	mov    0x14(%ebx),%edx
+  802bdb:	8b 43 18             	mov    0x18(%ebx),%eax
+  802bde:	39 c2                	cmp    %eax,%edx
+  802be0:	75 23                	jne    802c05 <ipcring_rsp_wait+0x41>
+  802be2:	83 ec 08             	sub    $0x8,%esp
+  802be5:	6a 00                	push   $0x0
+  802be7:	6a 00                	push   $0x0
+  802be9:	6a 00                	push   $0x0
+  802beb:	6a 00                	push   $0x0
+  802bed:	ff 73 0c             	push   0xc(%ebx)
+  802bf0:	ff 73 04             	push   0x4(%ebx)
+  802bf3:	e8 81 03 00 00       	call   802f79 <ipc_call>
+  802bf8:	8b 53 14             	mov    0x14(%ebx),%edx
+  802bfb:	8b 43 18             	mov    0x18(%ebx),%eax
+  802bfe:	83 c4 20             	add    $0x20,%esp
+  802c01:	39 c2                	cmp    %eax,%edx
+  802c03:	74 dd                	je     802be2 <ipcring_rsp_wait+0x1e>
+  802c05:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c08:	83 e0 07             	and    $0x7,%eax
+  802c0b:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802c0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c12:	c9                   	leave
+  802c13:	c3                   	ret
+  802c14:	68 38 38 80 00       	push   $0x803838
+  802c19:	68 e9 37 80 00       	push   $0x8037e9
+  802c1e:	6a 3b                	push   $0x3b
+  802c20:	68 59 38 80 00       	push   $0x803859
+  802c25:	e8 84 d5 ff ff       	call   8001ae <_panic>
+
+00802c2a <ipcring_rsp_pop>:
+  802c2a:	55                   	push   %ebp
+  802c2b:	89 e5                	mov    %esp,%ebp
+  802c2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c30:	8b 42 18             	mov    0x18(%edx),%eax
+  802c33:	83 c0 01             	add    $0x1,%eax
+  802c36:	89 42 18             	mov    %eax,0x18(%edx)
+  802c39:	5d                   	pop    %ebp
+  802c3a:	c3                   	ret
+
+00802c3b <ipcring_server_init>:
+  802c3b:	55                   	push   %ebp
+  802c3c:	89 e5                	mov    %esp,%ebp
+  802c3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c44:	89 10                	mov    %edx,(%eax)
+  802c46:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c49:	89 50 04             	mov    %edx,0x4(%eax)
+  802c4c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802c53:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802c5a:	5d                   	pop    %ebp
+  802c5b:	c3                   	ret
+
+00802c5c <ipcring_req_avail>:
+  802c5c:	55                   	push   %ebp
+  802c5d:	89 e5                	mov    %esp,%ebp
+  802c5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c62:	8b 02                	mov    (%edx),%eax
+  802c64:	8b 40 10             	mov    0x10(%eax),%eax
+  802c67:	2b 42 08             	sub    0x8(%edx),%eax
+  802c6a:	ba 08 00 00 00       	mov    $0x8,%edx
+  802c6f:	39 d0                	cmp    %edx,%eax
+  802c71:	0f 47 c2             	cmova  %edx,%eax
+  802c74:	5d                   	pop    %ebp
+  802c75:	c3                   	ret
+
+00802c76 <ipcring_req_peek>:
+  802c76:	55                   	push   %ebp
+  802c77:	89 e5                	mov    %esp,%ebp
+  802c79:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c7c:	8b 42 08             	mov    0x8(%edx),%eax
+  802c7f:	83 e0 07             	and    $0x7,%eax
+  802c82:	8b 12                	mov    (%edx),%edx
+  802c84:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802c88:	5d                   	pop    %ebp
+  802c89:	c3                   	ret
+
+00802c8a <ipcring_rsp_push>:
+  802c8a:	55                   	push   %ebp
+  802c8b:	89 e5                	mov    %esp,%ebp
+  802c8d:	83 ec 08             	sub    $0x8,%esp
+  802c90:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c93:	8b 41 08             	mov    0x8(%ecx),%eax
+  802c96:	83 c0 01             	add    $0x1,%eax
+  802c99:	89 41 08             	mov    %eax,0x8(%ecx)
+  802c9c:	8b 11                	mov    (%ecx),%edx
+  802c9e:	83 c2 14             	add    $0x14,%edx
+  802ca1:	f0 87 02             	lock xchg %eax,(%edx)
+  802ca4:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802ca8:	75 02                	jne    802cac <ipcring_rsp_push+0x22>
+  802caa:	c9                   	leave
+  802cab:	c3                   	ret
+  802cac:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802cb3:	6a 00                	push   $0x0
+  802cb5:	68 00 00 80 ee       	push   $0xee800000
+  802cba:	6a 00                	push   $0x0
+  802cbc:	ff 71 04             	push   0x4(%ecx)
+  802cbf:	e8 77 e3 ff ff       	call   80103b <sys_ipc_try_send>
+  802cc4:	83 c4 10             	add    $0x10,%esp
+  802cc7:	eb e1                	jmp    802caa <ipcring_rsp_push+0x20>
+
+00802cc9 <ipcring_client_wait>:
+  802cc9:	55                   	push   %ebp
+  802cca:	89 e5                	mov    %esp,%ebp
+  802ccc:	83 ec 08             	sub    $0x8,%esp
+  802ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd2:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802cd9:	8b 10                	mov    (%eax),%edx
+  802cdb:	8b 52 18             	mov    0x18(%edx),%edx
+  802cde:	3b 50 08             	cmp    0x8(%eax),%edx
+  802ce1:	75 02                	jne    802ce5 <ipcring_client_wait+0x1c>
+  802ce3:	c9                   	leave
+  802ce4:	c3                   	ret
+  802ce5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802cec:	6a 00                	push   $0x0
+  802cee:	68 00 00 80 ee       	push   $0xee800000
+  802cf3:	6a 00                	push   $0x0
+  802cf5:	ff 70 04             	push   0x4(%eax)
+  802cf8:	e8 3e e3 ff ff       	call   80103b <sys_ipc_try_send>
+  802cfd:	83 c4 10             	add    $0x10,%esp
+  802d00:	eb e1                	jmp    802ce3 <ipcring_client_wait+0x1a>
+
+00802d02 <ipcring_server_sleep>:
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	53                   	push   %ebx
+  802d06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d09:	8b 01                	mov    (%ecx),%eax
+  802d0b:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802d0e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d13:	f0 87 02             	lock xchg %eax,(%edx)
+  802d16:	8b 11                	mov    (%ecx),%edx
+  802d18:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802d1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d20:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802d23:	74 0e                	je     802d33 <ipcring_server_sleep+0x31>
+  802d25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2a:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d36:	c9                   	leave
+  802d37:	c3                   	ret
+
+00802d38 <devcons_close>:
+  802d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3d:	c3                   	ret
+
+00802d3e <devcons_stat>:
+  802d3e:	55                   	push   %ebp
+  802d3f:	89 e5                	mov    %esp,%ebp
+  802d41:	83 ec 10             	sub    $0x10,%esp
+  802d44:	68 67 38 80 00       	push   $0x803867
+  802d49:	ff 75 0c             	push   0xc(%ebp)
+  802d4c:	e8 2f dc ff ff       	call   800980 <strcpy>
+  802d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d56:	c9                   	leave
+  802d57:	c3                   	ret
+
+00802d58 <devcons_write>:
+  802d58:	55                   	push   %ebp
+  802d59:	89 e5                	mov    %esp,%ebp
+  802d5b:	57                   	push   %edi
+  802d5c:	56                   	push   %esi
+  802d5d:	53                   	push   %ebx
+  802d5e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802d64:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802d67:	85 ff                	test   %edi,%edi
+  802d69:	74 51                	je     802dbc <devcons_write+0x64>
+  802d6b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d75:	89 fb                	mov    %edi,%ebx
+  802d77:	29 c3                	sub    %eax,%ebx
+  802d79:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802d7e:	39 d3                	cmp    %edx,%ebx
+  802d80:	0f 47 da             	cmova  %edx,%ebx
+  802d83:	83 ec 04             	sub    $0x4,%esp
+  802d86:	53                   	push   %ebx
+  802d87:	03 45 0c             	add    0xc(%ebp),%eax
+  802d8a:	50                   	push   %eax
+  802d8b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d91:	50                   	push   %eax
+  802d92:	e8 99 dd ff ff       	call   800b30 <memmove>
+  802d97:	83 c4 08             	add    $0x8,%esp
+  802d9a:	53                   	push   %ebx
+  802d9b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802da1:	50                   	push   %eax
+  802da2:	e8 51 df ff ff       	call   800cf8 <sys_cputs>
+  802da7:	01 de                	add    %ebx,%esi
+  802da9:	89 f0                	mov    %esi,%eax
+  802dab:	83 c4 10             	add    $0x10,%esp
+  802dae:	39 fe                	cmp    %edi,%esi
+  802db0:	72 c3                	jb     802d75 <devcons_write+0x1d>
+  802db2:	89 f0                	mov    %esi,%eax
+  802db4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db7:	5b                   	pop    %ebx
+  802db8:	5e                   	pop    %esi
+  802db9:	5f                   	pop    %edi
+  802dba:	5d                   	pop    %ebp
+  802dbb:	c3                   	ret
+  802dbc:	be 00 00 00 00       	mov    $0x0,%esi
+  802dc1:	eb ef                	jmp    802db2 <devcons_write+0x5a>
+
+00802dc3 <devcons_read>:
+  802dc3:	55                   	push   %ebp
+  802dc4:	89 e5                	mov    %esp,%ebp
+  802dc6:	83 ec 08             	sub    $0x8,%esp
+  802dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dd2:	75 07                	jne    802ddb <devcons_read+0x18>
+  802dd4:	eb 1f                	jmp    802df5 <devcons_read+0x32>
+  802dd6:	e8 ba df ff ff       	call   800d95 <sys_yield>
+  802ddb:	e8 36 df ff ff       	call   800d16 <sys_cgetc>
+  802de0:	85 c0                	test   %eax,%eax
+  802de2:	74 f2                	je     802dd6 <devcons_read+0x13>
+  802de4:	78 0f                	js     802df5 <devcons_read+0x32>
+  802de6:	83 f8 04             	cmp    $0x4,%eax
+  802de9:	74 0c                	je     802df7 <devcons_read+0x34>
+  802deb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802dee:	88 02                	mov    %al,(%edx)
+  802df0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802df5:	c9                   	leave
+  802df6:	c3                   	ret
+  802df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfc:	eb f7                	jmp    802df5 <devcons_read+0x32>
+
+00802dfe <cputchar>:
+  802dfe:	55                   	push   %ebp
+  802dff:	89 e5                	mov    %esp,%ebp
+  802e01:	83 ec 20             	sub    $0x20,%esp
+  802e04:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e07:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802e0a:	6a 01                	push   $0x1
+  802e0c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e0f:	50                   	push   %eax
+  802e10:	e8 e3 de ff ff       	call   800cf8 <sys_cputs>
+  802e15:	83 c4 10             	add    $0x10,%esp
+  802e18:	c9                   	leave
+  802e19:	c3                   	ret
+
+00802e1a <getchar>:
+  802e1a:	55                   	push   %ebp
+  802e1b:	89 e5                	mov    %esp,%ebp
+  802e1d:	83 ec 1c             	sub    $0x1c,%esp
+  802e20:	6a 01                	push   $0x1
+  802e22:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e25:	50                   	push   %eax
+  802e26:	6a 00                	push   $0x0
+  802e28:	e8 fa ea ff ff       	call   801927 <read>
+  802e2d:	83 c4 10             	add    $0x10,%esp
+  802e30:	85 c0                	test   %eax,%eax
+  802e32:	78 06                	js     802e3a <getchar+0x20>
+  802e34:	74 06                	je     802e3c <getchar+0x22>
+  802e36:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802e3a:	c9                   	leave
+  802e3b:	c3                   	ret
+  802e3c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802e41:	eb f7                	jmp    802e3a <getchar+0x20>
+
+00802e43 <iscons>:
+  802e43:	55                   	push   %ebp
+  802e44:	89 e5                	mov    %esp,%ebp
+  802e46:	83 ec 20             	sub    $0x20,%esp
+  802e49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e4c:	50                   	push   %eax
+  802e4d:	ff 75 08             	push   0x8(%ebp)
+  802e50:	e8 70 e8 ff ff       	call   8016c5 <fd_lookup>
+  802e55:	83 c4 10             	add    $0x10,%esp
+  802e58:	85 c0                	test   %eax,%eax
+  802e5a:	78 11                	js     802e6d <iscons+0x2a>
+  802e5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e5f:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802e65:	39 10                	cmp    %edx,(%eax)
+  802e67:	0f 94 c0             	sete   %al
+  802e6a:	0f b6 c0             	movzbl %al,%eax
+  802e6d:	c9                   	leave
+  802e6e:	c3                   	ret
+
+00802e6f <opencons>:
+  802e6f:	55                   	push   %ebp
+  802e70:	89 e5                	mov    %esp,%ebp
+  802e72:	83 ec 24             	sub    $0x24,%esp
+  802e75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e78:	50                   	push   %eax
+  802e79:	e8 f7 e7 ff ff       	call   801675 <fd_alloc>
+  802e7e:	83 c4 10             	add    $0x10,%esp
+  802e81:	85 c0                	test   %eax,%eax
+  802e83:	78 3a                	js     802ebf <opencons+0x50>
+  802e85:	83 ec 04             	sub    $0x4,%esp
+  802e88:	68 07 04 00 00       	push   $0x407
+  802e8d:	ff 75 f4             	push   -0xc(%ebp)
+  802e90:	6a 00                	push   $0x0
+  802e92:	e8 49 df ff ff       	call   800de0 <sys_page_alloc>
+  802e97:	83 c4 10             	add    $0x10,%esp
+  802e9a:	85 c0                	test   %eax,%eax
+  802e9c:	78 21                	js     802ebf <opencons+0x50>
+  802e9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ea1:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802ea7:	89 10                	mov    %edx,(%eax)
+  802ea9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eac:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802eb3:	83 ec 0c             	sub    $0xc,%esp
+  802eb6:	50                   	push   %eax
+  802eb7:	e8 92 e7 ff ff       	call   80164e <fd2num>
+  802ebc:	83 c4 10             	add    $0x10,%esp
+  802ebf:	c9                   	leave
+  802ec0:	c3                   	ret
+
+00802ec1 <ipc_recv>:
+  802ec1:	55                   	push   %ebp
+  802ec2:	89 e5                	mov    %esp,%ebp
+  802ec4:	56                   	push   %esi
+  802ec5:	53                   	push   %ebx
+  802ec6:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ec9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ecc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ecf:	85 c0                	test   %eax,%eax
+  802ed1:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802ed6:	0f 44 c2             	cmove  %edx,%eax
+  802ed9:	83 ec 0c             	sub    $0xc,%esp
+  802edc:	50                   	push   %eax
+  802edd:	e8 a9 e1 ff ff       	call   80108b <sys_ipc_recv>
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	78 2a                	js     802f13 <ipc_recv+0x52>
+  802ee9:	a1 20 70 80 00       	mov    0x807020,%eax
+  802eee:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802ef4:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802efa:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f00:	85 f6                	test   %esi,%esi
+  802f02:	74 02                	je     802f06 <ipc_recv+0x45>
+  802f04:	89 0e                	mov    %ecx,(%esi)
+  802f06:	85 db                	test   %ebx,%ebx
+  802f08:	74 02                	je     802f0c <ipc_recv+0x4b>
+  802f0a:	89 13                	mov    %edx,(%ebx)
+  802f0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f0f:	5b                   	pop    %ebx
+  802f10:	5e                   	pop    %esi
+  802f11:	5d                   	pop    %ebp
+  802f12:	c3                   	ret
+  802f13:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f1d:	eb e1                	jmp    802f00 <ipc_recv+0x3f>
+
+00802f1f <ipc_send>:
+  802f1f:	55                   	push   %ebp
+  802f20:	89 e5                	mov    %esp,%ebp
+  802f22:	57                   	push   %edi
+  802f23:	56                   	push   %esi
+  802f24:	53                   	push   %ebx
+  802f25:	83 ec 0c             	sub    $0xc,%esp
+  802f28:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f2e:	8b 75 14             	mov    0x14(%ebp),%esi
+  802f31:	85 db                	test   %ebx,%ebx
+  802f33:	74 1e                	je     802f53 <ipc_send+0x34>
+  802f35:	56                   	push   %esi
+  802f36:	53                   	push   %ebx
+  802f37:	57                   	push   %edi
+  802f38:	ff 75 08             	push   0x8(%ebp)
+  802f3b:	e8 d8 e1 ff ff       	call   801118 <sys_ipc_send>
+  802f40:	83 c4 10             	add    $0x10,%esp
+  802f43:	85 c0                	test   %eax,%eax
+  802f45:	74 2a                	je     802f71 <ipc_send+0x52>
+  802f47:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f4a:	75 13                	jne    802f5f <ipc_send+0x40>
+  802f4c:	e8 44 de ff ff       	call   800d95 <sys_yield>
+  802f51:	eb e2                	jmp    802f35 <ipc_send+0x16>
+  802f53:	be 00 00 00 00       	mov    $0x0,%esi
+  802f58:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f5d:	eb d6                	jmp    802f35 <ipc_send+0x16>
+  802f5f:	50                   	push   %eax
+  802f60:	68 74 38 80 00       	push   $0x803874
+  802f65:	6a 4f                	push   $0x4f
+  802f67:	68 b7 38 80 00       	push   $0x8038b7
+  802f6c:	e8 3d d2 ff ff       	call   8001ae <_panic>
+  802f71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f74:	5b                   	pop    %ebx
+  802f75:	5e                   	pop    %esi
+  802f76:	5f                   	pop    %edi
+  802f77:	5d                   	pop    %ebp
+  802f78:	c3                   	ret
+
+00802f79 <ipc_call>:
+  802f79:	55                   	push   %ebp
+  802f7a:	89 e5                	mov    %esp,%ebp
+  802f7c:	57                   	push   %edi
+  802f7d:	56                   	push   %esi
+  802f7e:	53                   	push   %ebx
+  802f7f:	83 ec 0c             	sub    $0xc,%esp
+  802f82:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f86:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802f8b:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802f8f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f93:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802f98:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802f9c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fa0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa5:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802fa9:	eb 05                	jmp    802fb0 <ipc_call+0x37>
+  802fab:	e8 e5 dd ff ff       	call   800d95 <sys_yield>
+  802fb0:	83 ec 0c             	sub    $0xc,%esp
+  802fb3:	56                   	push   %esi
+  802fb4:	53                   	push   %ebx
+  802fb5:	57                   	push   %edi
+  802fb6:	ff 75 0c             	push   0xc(%ebp)
+  802fb9:	ff 75 08             	push   0x8(%ebp)
+  802fbc:	e8 a7 e1 ff ff       	call   801168 <sys_ipc_call>
+  802fc1:	83 c4 20             	add    $0x20,%esp
+  802fc4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802fc7:	74 e2                	je     802fab <ipc_call+0x32>
+  802fc9:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802fcc:	74 2d                	je     802ffb <ipc_call+0x82>
+  802fce:	85 c0                	test   %eax,%eax
+  802fd0:	78 4f                	js     803021 <ipc_call+0xa8>
+  802fd2:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802fd6:	74 10                	je     802fe8 <ipc_call+0x6f>
+  802fd8:	a1 20 70 80 00       	mov    0x807020,%eax
+  802fdd:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802fe3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802fe6:	89 02                	mov    %eax,(%edx)
+  802fe8:	a1 20 70 80 00       	mov    0x807020,%eax
+  802fed:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ff3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff6:	5b                   	pop    %ebx
+  802ff7:	5e                   	pop    %esi
+  802ff8:	5f                   	pop    %edi
+  802ff9:	5d                   	pop    %ebp
+  802ffa:	c3                   	ret
+  802ffb:	ff 75 14             	push   0x14(%ebp)
+  802ffe:	ff 75 10             	push   0x10(%ebp)
+  803001:	ff 75 0c             	push   0xc(%ebp)
+  803004:	ff 75 08             	push   0x8(%ebp)
+  803007:	e8 13 ff ff ff       	call   802f1f <ipc_send>
+  80300c:	83 c4 0c             	add    $0xc,%esp
+  80300f:	ff 75 1c             	push   0x1c(%ebp)
+  803012:	ff 75 18             	push   0x18(%ebp)
+  803015:	6a 00                	push   $0x0
+  803017:	e8 a5 fe ff ff       	call   802ec1 <ipc_recv>
+  80301c:	83 c4 10             	add    $0x10,%esp
+  80301f:	eb d2                	jmp    802ff3 <ipc_call+0x7a>
+  803021:	50                   	push   %eax
+  803022:	68 c1 38 80 00       	push   $0x8038c1
+  803027:	6a 6d                	push   $0x6d
+  803029:	68 b7 38 80 00       	push   $0x8038b7
+  80302e:	e8 7b d1 ff ff       	call   8001ae <_panic>
+
+00803033 <ipc_reply_recv>:
+  803033:	55                   	push   %ebp
+  803034:	89 e5                	mov    %esp,%ebp
+  803036:	57                   	push   %edi
+  803037:	56                   	push   %esi
+  803038:	53                   	push   %ebx
+  803039:	83 ec 0c             	sub    $0xc,%esp
+  80303c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80303f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803042:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803045:	85 db                	test   %ebx,%ebx
+  803047:	0f 84 ac 00 00 00    	je     8030f9 <ipc_reply_recv+0xc6>
+  80304d:	85 f6                	test   %esi,%esi
+  80304f:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803054:	0f 45 c6             	cmovne %esi,%eax
+  803057:	83 ec 0c             	sub    $0xc,%esp
+  80305a:	50                   	push   %eax
+  80305b:	ff 75 14             	push   0x14(%ebp)
+  80305e:	53                   	push   %ebx
+  80305f:	ff 75 0c             	push   0xc(%ebp)
+  803062:	ff 75 08             	push   0x8(%ebp)
+  803065:	e8 1f e1 ff ff       	call   801189 <sys_ipc_reply_recv>
+  80306a:	83 c4 20             	add    $0x20,%esp
+  80306d:	85 c0                	test   %eax,%eax
+  80306f:	78 3a                	js     8030ab <ipc_reply_recv+0x78>
+  803071:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803075:	74 10                	je     803087 <ipc_reply_recv+0x54>
+  803077:	a1 20 70 80 00       	mov    0x807020,%eax
+  80307c:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803082:	8b 55 18             	mov    0x18(%ebp),%edx
+  803085:	89 02                	mov    %eax,(%edx)
+  803087:	85 ff                	test   %edi,%edi
+  803089:	74 0d                	je     803098 <ipc_reply_recv+0x65>
+  80308b:	a1 20 70 80 00       	mov    0x807020,%eax
+  803090:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803096:	89 07                	mov    %eax,(%edi)
+  803098:	a1 20 70 80 00       	mov    0x807020,%eax
+  80309d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8030a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030a6:	5b                   	pop    %ebx
+  8030a7:	5e                   	pop    %esi
+  8030a8:	5f                   	pop    %edi
+  8030a9:	5d                   	pop    %ebp
+  8030aa:	c3                   	ret
+  8030ab:	ff 75 14             	push   0x14(%ebp)
+  8030ae:	53                   	push   %ebx
+  8030af:	ff 75 0c             	push   0xc(%ebp)
+  8030b2:	ff 75 08             	push   0x8(%ebp)
+  8030b5:	e8 81 df ff ff       	call   80103b <sys_ipc_try_send>
+  8030ba:	89 c2                	mov    %eax,%edx
+  8030bc:	c1 ea 1f             	shr    $0x1f,%edx
+  8030bf:	83 c4 10             	add    $0x10,%esp
+  8030c2:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8030c5:	0f 95 c1             	setne  %cl
+  8030c8:	84 d1                	test   %dl,%cl
+  8030ca:	74 05                	je     8030d1 <ipc_reply_recv+0x9e>
+  8030cc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8030cf:	75 12                	jne    8030e3 <ipc_reply_recv+0xb0>
+  8030d1:	83 ec 04             	sub    $0x4,%esp
+  8030d4:	57                   	push   %edi
+  8030d5:	56                   	push   %esi
+  8030d6:	ff 75 18             	push   0x18(%ebp)
+  8030d9:	e8 e3 fd ff ff       	call   802ec1 <ipc_recv>
+  8030de:	83 c4 10             	add    $0x10,%esp
+  8030e1:	eb c0                	jmp    8030a3 <ipc_reply_recv+0x70>
+  8030e3:	83 ec 04             	sub    $0x4,%esp
+  8030e6:	50                   	push   %eax
+  8030e7:	ff 75 08             	push   0x8(%ebp)
+  8030ea:	68 94 38 80 00       	push   $0x803894
+  8030ef:	e8 95 d1 ff ff       	call   800289 <cprintf>
+  8030f4:	83 c4 10             	add    $0x10,%esp
+  8030f7:	eb d8                	jmp    8030d1 <ipc_reply_recv+0x9e>
+  8030f9:	85 f6                	test   %esi,%esi
+  8030fb:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803100:	0f 45 c6             	cmovne %esi,%eax
+  803103:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803108:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80310f:	e9 43 ff ff ff       	jmp    803057 <ipc_reply_recv+0x24>
+
+00803114 <ipc_find_env>:
+  803114:	55                   	push   %ebp
+  803115:	89 e5                	mov    %esp,%ebp
+  803117:	83 ec 14             	sub    $0x14,%esp
+  80311a:	ff 75 08             	push   0x8(%ebp)
+  80311d:	e8 b7 de ff ff       	call   800fd9 <sys_env_service>
+  803122:	85 c0                	test   %eax,%eax
+  803124:	ba 00 00 00 00       	mov    $0x0,%edx
+  803129:	0f 48 c2             	cmovs  %edx,%eax
+  80312c:	c9                   	leave
+  80312d:	c3                   	ret
+
+0080312e <pageref>:
+  80312e:	55                   	push   %ebp
+  80312f:	89 e5                	mov    %esp,%ebp
+  803131:	8b 45 08             	mov    0x8(%ebp),%eax
+  803134:	89 c2                	mov    %eax,%edx
+  803136:	c1 ea 16             	shr    $0x16,%edx
+  803139:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803140:	ba 00 00 00 00       	mov    $0x0,%edx
+  803145:	f6 c1 01             	test   $0x1,%cl
+  803148:	74 22                	je     80316c <pageref+0x3e>
+  80314a:	c1 e8 0c             	shr    $0xc,%eax
+  80314d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803154:	a8 01                	test   $0x1,%al
+  803156:	74 14                	je     80316c <pageref+0x3e>
+  803158:	c1 e8 0c             	shr    $0xc,%eax
+  80315b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80315e:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803165:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803169:	0f b7 d2             	movzwl %dx,%edx
+  80316c:	89 d0                	mov    %edx,%eax
+  80316e:	5d                   	pop    %ebp
+  80316f:	c3                   	ret
+
+00803170 <__udivmoddi4>:
+  803170:	55                   	push   %ebp
+  803171:	57                   	push   %edi
+  803172:	56                   	push   %esi
+  803173:	53                   	push   %ebx
+  803174:	83 ec 24             	sub    $0x24,%esp
+  803177:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80317b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80317f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803183:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803187:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80318b:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80318f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803193:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803197:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80319b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031a5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8031aa:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8031b1:	00 
+  8031b2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8031b9:	00 
+  8031ba:	89 fb                	mov    %edi,%ebx
+  8031bc:	eb 08                	jmp    8031c6 <__udivmoddi4+0x56>
+  8031be:	83 e9 01             	sub    $0x1,%ecx
+  8031c1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8031c4:	74 68                	je     80322e <__udivmoddi4+0xbe>
+  8031c6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8031ca:	01 c0                	add    %eax,%eax
+  8031cc:	89 c6                	mov    %eax,%esi
+  8031ce:	89 d7                	mov    %edx,%edi
+  8031d0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8031d4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8031d8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8031db:	d3 ea                	shr    %cl,%edx
+  8031dd:	f6 c1 20             	test   $0x20,%cl
+  8031e0:	74 04                	je     8031e6 <__udivmoddi4+0x76>
+  8031e2:	89 d0                	mov    %edx,%eax
+  8031e4:	31 d2                	xor    %edx,%edx
+  8031e6:	83 e0 01             	and    $0x1,%eax
+  8031e9:	89 04 24             	mov    %eax,(%esp)
+  8031ec:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8031f3:	00 
+  8031f4:	8b 04 24             	mov    (%esp),%eax
+  8031f7:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8031fb:	09 f0                	or     %esi,%eax
+  8031fd:	09 fa                	or     %edi,%edx
+  8031ff:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803203:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803207:	39 f0                	cmp    %esi,%eax
+  803209:	89 d5                	mov    %edx,%ebp
+  80320b:	19 fd                	sbb    %edi,%ebp
+  80320d:	72 af                	jb     8031be <__udivmoddi4+0x4e>
+  80320f:	29 f0                	sub    %esi,%eax
+  803211:	19 fa                	sbb    %edi,%edx
+  803213:	89 cf                	mov    %ecx,%edi
+  803215:	c1 ef 05             	shr    $0x5,%edi
+  803218:	83 e7 01             	and    $0x1,%edi
+  80321b:	89 fe                	mov    %edi,%esi
+  80321d:	83 f6 01             	xor    $0x1,%esi
+  803220:	d3 e6                	shl    %cl,%esi
+  803222:	d3 e7                	shl    %cl,%edi
+  803224:	09 74 24 18          	or     %esi,0x18(%esp)
+  803228:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80322c:	eb 90                	jmp    8031be <__udivmoddi4+0x4e>
+  80322e:	85 db                	test   %ebx,%ebx
+  803230:	74 05                	je     803237 <__udivmoddi4+0xc7>
+  803232:	89 03                	mov    %eax,(%ebx)
+  803234:	89 53 04             	mov    %edx,0x4(%ebx)
+  803237:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80323b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80323f:	83 c4 24             	add    $0x24,%esp
+  803242:	5b                   	pop    %ebx
+  803243:	5e                   	pop    %esi
+  803244:	5f                   	pop    %edi
+  803245:	5d                   	pop    %ebp
+  803246:	c3                   	ret
+
+00803247 <__udivdi3>:
+  803247:	83 ec 08             	sub    $0x8,%esp
+  80324a:	6a 00                	push   $0x0
+  80324c:	ff 74 24 1c          	push   0x1c(%esp)
+  803250:	ff 74 24 1c          	push   0x1c(%esp)
+  803254:	ff 74 24 1c          	push   0x1c(%esp)
+  803258:	ff 74 24 1c          	push   0x1c(%esp)
+  80325c:	e8 0f ff ff ff       	call   803170 <__udivmoddi4>
+  803261:	83 c4 1c             	add    $0x1c,%esp
+  803264:	c3                   	ret
+
+00803265 <__umoddi3>:
+  803265:	83 ec 18             	sub    $0x18,%esp
+  803268:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80326c:	50                   	push   %eax
+  80326d:	ff 74 24 2c          	push   0x2c(%esp)
+  803271:	ff 74 24 2c          	push   0x2c(%esp)
+  803275:	ff 74 24 2c          	push   0x2c(%esp)
+  803279:	ff 74 24 2c          	push   0x2c(%esp)
+  80327d:	e8 ee fe ff ff       	call   803170 <__udivmoddi4>
+  803282:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803286:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80328a:	83 c4 2c             	add    $0x2c,%esp
+  80328d:	c3                   	ret
+
+0080328e <__divdi3>:
+  80328e:	53                   	push   %ebx
+  80328f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803293:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803297:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80329b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80329f:	85 d2                	test   %edx,%edx
+  8032a1:	78 12                	js     8032b5 <__divdi3+0x27>
+  8032a3:	85 db                	test   %ebx,%ebx
+  8032a5:	78 2e                	js     8032d5 <__divdi3+0x47>
+  8032a7:	53                   	push   %ebx
+  8032a8:	51                   	push   %ecx
+  8032a9:	52                   	push   %edx
+  8032aa:	50                   	push   %eax
+  8032ab:	e8 97 ff ff ff       	call   803247 <__udivdi3>
+  8032b0:	83 c4 10             	add    $0x10,%esp
+  8032b3:	eb 1e                	jmp    8032d3 <__divdi3+0x45>
+  8032b5:	f7 d8                	neg    %eax
+  8032b7:	83 d2 00             	adc    $0x0,%edx
+  8032ba:	f7 da                	neg    %edx
+  8032bc:	85 db                	test   %ebx,%ebx
+  8032be:	78 2a                	js     8032ea <__divdi3+0x5c>
+  8032c0:	53                   	push   %ebx
+  8032c1:	51                   	push   %ecx
+  8032c2:	52                   	push   %edx
+  8032c3:	50                   	push   %eax
+  8032c4:	e8 7e ff ff ff       	call   803247 <__udivdi3>
+  8032c9:	83 c4 10             	add    $0x10,%esp
+  8032cc:	f7 d8                	neg    %eax
+  8032ce:	83 d2 00             	adc    $0x0,%edx
+  8032d1:	f7 da                	neg    %edx
+  8032d3:	5b                   	pop    %ebx
+  8032d4:	c3                   	ret
+  8032d5:	f7 d9                	neg    %ecx
+  8032d7:	83 d3 00             	adc    $0x0,%ebx
+  8032da:	f7 db                	neg    %ebx
+  8032dc:	53                   	push   %ebx
+  8032dd:	51                   	push   %ecx
+  8032de:	52                   	push   %edx
+  8032df:	50                   	push   %eax
+  8032e0:	e8 62 ff ff ff       	call   803247 <__udivdi3>
+  8032e5:	83 c4 10             	add    $0x10,%esp
+  8032e8:	eb e2                	jmp    8032cc <__divdi3+0x3e>
+  8032ea:	f7 d9                	neg    %ecx
+  8032ec:	83 d3 00             	adc    $0x0,%ebx
+  8032ef:	f7 db                	neg    %ebx
+  8032f1:	53                   	push   %ebx
+  8032f2:	51                   	push   %ecx
+  8032f3:	52                   	push   %edx
+  8032f4:	50                   	push   %eax
+  8032f5:	e8 4d ff ff ff       	call   803247 <__udivdi3>
+  8032fa:	83 c4 10             	add    $0x10,%esp
+  8032fd:	eb d4                	jmp    8032d3 <__divdi3+0x45>
+
+008032ff <__moddi3>:
+  8032ff:	55                   	push   %ebp
+  803300:	57                   	push   %edi
+  803301:	56                   	push   %esi
+  803302:	53                   	push   %ebx
+  803303:	83 ec 0c             	sub    $0xc,%esp
+  803306:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80330a:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80330e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803312:	89 e9                	mov    %ebp,%ecx
+  803314:	f7 d9                	neg    %ecx
+  803316:	89 d0                	mov    %edx,%eax
+  803318:	83 d0 00             	adc    $0x0,%eax
+  80331b:	f7 d8                	neg    %eax
+  80331d:	0f 49 e9             	cmovns %ecx,%ebp
+  803320:	0f 49 d0             	cmovns %eax,%edx
+  803323:	52                   	push   %edx
+  803324:	55                   	push   %ebp
+  803325:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803329:	f7 da                	neg    %edx
+  80332b:	89 d8                	mov    %ebx,%eax
+  80332d:	83 d0 00             	adc    $0x0,%eax
+  803330:	f7 d8                	neg    %eax
+  803332:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803337:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80333b:	0f 48 c3             	cmovs  %ebx,%eax
+  80333e:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803342:	ff 74 24 0c          	push   0xc(%esp)
+  803346:	ff 74 24 0c          	push   0xc(%esp)
+  80334a:	e8 16 ff ff ff       	call   803265 <__umoddi3>
+  80334f:	83 c4 10             	add    $0x10,%esp
+  803352:	85 db                	test   %ebx,%ebx
+  803354:	78 08                	js     80335e <__moddi3+0x5f>
+  803356:	83 c4 0c             	add    $0xc,%esp
+  803359:	5b                   	pop    %ebx
+  80335a:	5e                   	pop    %esi
+  80335b:	5f                   	pop    %edi
+  80335c:	5d                   	pop    %ebp
+  80335d:	c3                   	ret
+  80335e:	f7 d8                	neg    %eax
+  803360:	83 d2 00             	adc    $0x0,%edx
+  803363:	f7 da                	neg    %edx
+  803365:	eb ef                	jmp    803356 <__moddi3+0x57>
@@ -0,0 +1,5042 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	c7 05 10 50 80 00 00 	movl   $0x0,0x805010
+  800040:	00 00 00 
+  800043:	6a 00                	push   $0x0
+  800045:	68 80 31 80 00       	push   $0x803180
+  80004a:	e8 13 01 00 00       	call   800162 <cprintf>
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80005f:	e8 eb 0b 00 00       	call   800c4f <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 14 50 80 00       	mov    %eax,0x805014
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 40 80 00       	mov    %eax,0x804000
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	a1 14 50 80 00       	mov    0x805014,%eax
+  8000a8:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 14                	jne    8000c6 <exit+0x29>
+  8000b2:	e8 3a 16 00 00       	call   8016f1 <close_all>
+  8000b7:	83 ec 0c             	sub    $0xc,%esp
+  8000ba:	6a 00                	push   $0x0
+  8000bc:	e8 4d 0b 00 00       	call   800c0e <sys_env_destroy>
+  8000c1:	83 c4 10             	add    $0x10,%esp
+  8000c4:	c9                   	leave
+  8000c5:	c3                   	ret
+  8000c6:	e8 b0 12 00 00       	call   80137b <sys_lease_complete>
+  8000cb:	eb e5                	jmp    8000b2 <exit+0x15>
+
+008000cd <putch>:
+  8000cd:	55                   	push   %ebp
+  8000ce:	89 e5                	mov    %esp,%ebp
+  8000d0:	53                   	push   %ebx
+  8000d1:	83 ec 04             	sub    $0x4,%esp
+  8000d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000d7:	8b 13                	mov    (%ebx),%edx
+  8000d9:	8d 42 01             	lea    0x1(%edx),%eax
+  8000dc:	89 03                	mov    %eax,(%ebx)
+  8000de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000e1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8000e5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000ea:	74 09                	je     8000f5 <putch+0x28>
+  8000ec:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8000f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f3:	c9                   	leave
+  8000f4:	c3                   	ret
+  8000f5:	83 ec 08             	sub    $0x8,%esp
+  8000f8:	68 ff 00 00 00       	push   $0xff
+  8000fd:	8d 43 08             	lea    0x8(%ebx),%eax
+  800100:	50                   	push   %eax
+  800101:	e8 cb 0a 00 00       	call   800bd1 <sys_cputs>
+  800106:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80010c:	83 c4 10             	add    $0x10,%esp
+  80010f:	eb db                	jmp    8000ec <putch+0x1f>
+
+00800111 <vcprintf>:
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80011a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800121:	00 00 00 
+  800124:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80012b:	00 00 00 
+  80012e:	ff 75 0c             	push   0xc(%ebp)
+  800131:	ff 75 08             	push   0x8(%ebp)
+  800134:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80013a:	50                   	push   %eax
+  80013b:	68 cd 00 80 00       	push   $0x8000cd
+  800140:	e8 1c 01 00 00       	call   800261 <vprintfmt>
+  800145:	83 c4 08             	add    $0x8,%esp
+  800148:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80014e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800154:	50                   	push   %eax
+  800155:	e8 77 0a 00 00       	call   800bd1 <sys_cputs>
+  80015a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800160:	c9                   	leave
+  800161:	c3                   	ret
+
+00800162 <cprintf>:
+  800162:	55                   	push   %ebp
+  800163:	89 e5                	mov    %esp,%ebp
+  800165:	83 ec 10             	sub    $0x10,%esp
+  800168:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80016b:	50                   	push   %eax
+  80016c:	ff 75 08             	push   0x8(%ebp)
+  80016f:	e8 9d ff ff ff       	call   800111 <vcprintf>
+  800174:	c9                   	leave
+  800175:	c3                   	ret
+
+00800176 <printnum>:
+  800176:	55                   	push   %ebp
+  800177:	89 e5                	mov    %esp,%ebp
+  800179:	57                   	push   %edi
+  80017a:	56                   	push   %esi
+  80017b:	53                   	push   %ebx
+  80017c:	83 ec 1c             	sub    $0x1c,%esp
+  80017f:	89 c3                	mov    %eax,%ebx
+  800181:	89 d6                	mov    %edx,%esi
+  800183:	8b 45 08             	mov    0x8(%ebp),%eax
+  800186:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800189:	89 d1                	mov    %edx,%ecx
+  80018b:	89 c2                	mov    %eax,%edx
+  80018d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800190:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800193:	8b 45 10             	mov    0x10(%ebp),%eax
+  800196:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800199:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001a0:	39 c2                	cmp    %eax,%edx
+  8001a2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001a5:	73 4b                	jae    8001f2 <printnum+0x7c>
+  8001a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8001aa:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8001ad:	85 ff                	test   %edi,%edi
+  8001af:	7e 11                	jle    8001c2 <printnum+0x4c>
+  8001b1:	83 ec 08             	sub    $0x8,%esp
+  8001b4:	56                   	push   %esi
+  8001b5:	ff 75 18             	push   0x18(%ebp)
+  8001b8:	ff d3                	call   *%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	83 ef 01             	sub    $0x1,%edi
+  8001c0:	75 ef                	jne    8001b1 <printnum+0x3b>
+  8001c2:	83 ec 08             	sub    $0x8,%esp
+  8001c5:	56                   	push   %esi
+  8001c6:	83 ec 04             	sub    $0x4,%esp
+  8001c9:	ff 75 e4             	push   -0x1c(%ebp)
+  8001cc:	ff 75 e0             	push   -0x20(%ebp)
+  8001cf:	ff 75 dc             	push   -0x24(%ebp)
+  8001d2:	ff 75 d8             	push   -0x28(%ebp)
+  8001d5:	e8 96 2e 00 00       	call   803070 <__umoddi3>
+  8001da:	83 c4 14             	add    $0x14,%esp
+  8001dd:	0f be 80 98 31 80 00 	movsbl 0x803198(%eax),%eax
+  8001e4:	50                   	push   %eax
+  8001e5:	ff d3                	call   *%ebx
+  8001e7:	83 c4 10             	add    $0x10,%esp
+  8001ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ed:	5b                   	pop    %ebx
+  8001ee:	5e                   	pop    %esi
+  8001ef:	5f                   	pop    %edi
+  8001f0:	5d                   	pop    %ebp
+  8001f1:	c3                   	ret
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	ff 75 18             	push   0x18(%ebp)
+  8001f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001fb:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8001fe:	52                   	push   %edx
+  8001ff:	50                   	push   %eax
+  800200:	83 ec 08             	sub    $0x8,%esp
+  800203:	ff 75 e4             	push   -0x1c(%ebp)
+  800206:	ff 75 e0             	push   -0x20(%ebp)
+  800209:	ff 75 dc             	push   -0x24(%ebp)
+  80020c:	ff 75 d8             	push   -0x28(%ebp)
+  80020f:	e8 3e 2e 00 00       	call   803052 <__udivdi3>
+  800214:	83 c4 18             	add    $0x18,%esp
+  800217:	52                   	push   %edx
+  800218:	50                   	push   %eax
+  800219:	89 f2                	mov    %esi,%edx
+  80021b:	89 d8                	mov    %ebx,%eax
+  80021d:	e8 54 ff ff ff       	call   800176 <printnum>
+  800222:	83 c4 20             	add    $0x20,%esp
+  800225:	eb 9b                	jmp    8001c2 <printnum+0x4c>
+
+00800227 <sprintputch>:
+  800227:	55                   	push   %ebp
+  800228:	89 e5                	mov    %esp,%ebp
+  80022a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80022d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800231:	8b 10                	mov    (%eax),%edx
+  800233:	3b 50 04             	cmp    0x4(%eax),%edx
+  800236:	73 0a                	jae    800242 <sprintputch+0x1b>
+  800238:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80023b:	89 08                	mov    %ecx,(%eax)
+  80023d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800240:	88 02                	mov    %al,(%edx)
+  800242:	5d                   	pop    %ebp
+  800243:	c3                   	ret
+
+00800244 <printfmt>:
+  800244:	55                   	push   %ebp
+  800245:	89 e5                	mov    %esp,%ebp
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	ff 75 10             	push   0x10(%ebp)
+  800251:	ff 75 0c             	push   0xc(%ebp)
+  800254:	ff 75 08             	push   0x8(%ebp)
+  800257:	e8 05 00 00 00       	call   800261 <vprintfmt>
+  80025c:	83 c4 10             	add    $0x10,%esp
+  80025f:	c9                   	leave
+  800260:	c3                   	ret
+
+00800261 <vprintfmt>:
+  800261:	55                   	push   %ebp
+  800262:	89 e5                	mov    %esp,%ebp
+  800264:	57                   	push   %edi
+  800265:	56                   	push   %esi
+  800266:	53                   	push   %ebx
+  800267:	83 ec 2c             	sub    $0x2c,%esp
+  80026a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80026d:	89 df                	mov    %ebx,%edi
+  80026f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800272:	8b 45 10             	mov    0x10(%ebp),%eax
+  800275:	8d 70 01             	lea    0x1(%eax),%esi
+  800278:	0f b6 00             	movzbl (%eax),%eax
+  80027b:	83 f8 25             	cmp    $0x25,%eax
+  80027e:	74 1e                	je     80029e <vprintfmt+0x3d>
+  800280:	85 c0                	test   %eax,%eax
+  800282:	0f 84 15 05 00 00    	je     80079d <vprintfmt+0x53c>
+  800288:	83 ec 08             	sub    $0x8,%esp
+  80028b:	53                   	push   %ebx
+  80028c:	50                   	push   %eax
+  80028d:	ff d7                	call   *%edi
+  80028f:	83 c6 01             	add    $0x1,%esi
+  800292:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800296:	83 c4 10             	add    $0x10,%esp
+  800299:	83 f8 25             	cmp    $0x25,%eax
+  80029c:	75 e2                	jne    800280 <vprintfmt+0x1f>
+  80029e:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8002a2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002a9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8002b0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8002b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002bc:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8002bf:	8d 56 01             	lea    0x1(%esi),%edx
+  8002c2:	0f b6 0e             	movzbl (%esi),%ecx
+  8002c5:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8002c8:	3c 55                	cmp    $0x55,%al
+  8002ca:	0f 87 3b 04 00 00    	ja     80070b <vprintfmt+0x4aa>
+  8002d0:	0f b6 c0             	movzbl %al,%eax
+  8002d3:	ff 24 85 e0 32 80 00 	jmp    *0x8032e0(,%eax,4)
+  8002da:	89 75 10             	mov    %esi,0x10(%ebp)
+  8002dd:	eb 93                	jmp    800272 <vprintfmt+0x11>
+  8002df:	89 d6                	mov    %edx,%esi
+  8002e1:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8002e5:	eb d8                	jmp    8002bf <vprintfmt+0x5e>
+  8002e7:	89 d6                	mov    %edx,%esi
+  8002e9:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8002ed:	eb d0                	jmp    8002bf <vprintfmt+0x5e>
+  8002ef:	0f b6 c9             	movzbl %cl,%ecx
+  8002f2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8002f5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8002f8:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8002fc:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8002ff:	83 f9 09             	cmp    $0x9,%ecx
+  800302:	77 6f                	ja     800373 <vprintfmt+0x112>
+  800304:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800307:	83 c2 01             	add    $0x1,%edx
+  80030a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80030d:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800311:	0f be 02             	movsbl (%edx),%eax
+  800314:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800317:	83 fe 09             	cmp    $0x9,%esi
+  80031a:	76 eb                	jbe    800307 <vprintfmt+0xa6>
+  80031c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80031f:	89 d6                	mov    %edx,%esi
+  800321:	eb 13                	jmp    800336 <vprintfmt+0xd5>
+  800323:	8b 45 14             	mov    0x14(%ebp),%eax
+  800326:	8b 00                	mov    (%eax),%eax
+  800328:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80032b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80032e:	8d 40 04             	lea    0x4(%eax),%eax
+  800331:	89 45 14             	mov    %eax,0x14(%ebp)
+  800334:	89 d6                	mov    %edx,%esi
+  800336:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80033a:	79 83                	jns    8002bf <vprintfmt+0x5e>
+  80033c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80033f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800342:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800349:	e9 71 ff ff ff       	jmp    8002bf <vprintfmt+0x5e>
+  80034e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800351:	85 c9                	test   %ecx,%ecx
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	0f 49 c1             	cmovns %ecx,%eax
+  80035b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80035e:	89 d6                	mov    %edx,%esi
+  800360:	e9 5a ff ff ff       	jmp    8002bf <vprintfmt+0x5e>
+  800365:	89 d6                	mov    %edx,%esi
+  800367:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80036e:	e9 4c ff ff ff       	jmp    8002bf <vprintfmt+0x5e>
+  800373:	89 d6                	mov    %edx,%esi
+  800375:	eb bf                	jmp    800336 <vprintfmt+0xd5>
+  800377:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80037b:	89 d6                	mov    %edx,%esi
+  80037d:	e9 3d ff ff ff       	jmp    8002bf <vprintfmt+0x5e>
+  800382:	89 55 10             	mov    %edx,0x10(%ebp)
+  800385:	8b 45 14             	mov    0x14(%ebp),%eax
+  800388:	8d 70 04             	lea    0x4(%eax),%esi
+  80038b:	83 ec 08             	sub    $0x8,%esp
+  80038e:	53                   	push   %ebx
+  80038f:	ff 30                	push   (%eax)
+  800391:	ff d7                	call   *%edi
+  800393:	83 c4 10             	add    $0x10,%esp
+  800396:	89 75 14             	mov    %esi,0x14(%ebp)
+  800399:	e9 d4 fe ff ff       	jmp    800272 <vprintfmt+0x11>
+  80039e:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a4:	8d 70 04             	lea    0x4(%eax),%esi
+  8003a7:	8b 10                	mov    (%eax),%edx
+  8003a9:	89 d0                	mov    %edx,%eax
+  8003ab:	f7 d8                	neg    %eax
+  8003ad:	0f 48 c2             	cmovs  %edx,%eax
+  8003b0:	83 f8 12             	cmp    $0x12,%eax
+  8003b3:	7f 23                	jg     8003d8 <vprintfmt+0x177>
+  8003b5:	8b 14 85 40 34 80 00 	mov    0x803440(,%eax,4),%edx
+  8003bc:	85 d2                	test   %edx,%edx
+  8003be:	74 18                	je     8003d8 <vprintfmt+0x177>
+  8003c0:	52                   	push   %edx
+  8003c1:	68 9b 35 80 00       	push   $0x80359b
+  8003c6:	53                   	push   %ebx
+  8003c7:	57                   	push   %edi
+  8003c8:	e8 77 fe ff ff       	call   800244 <printfmt>
+  8003cd:	83 c4 10             	add    $0x10,%esp
+  8003d0:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003d3:	e9 9a fe ff ff       	jmp    800272 <vprintfmt+0x11>
+  8003d8:	50                   	push   %eax
+  8003d9:	68 b0 31 80 00       	push   $0x8031b0
+  8003de:	53                   	push   %ebx
+  8003df:	57                   	push   %edi
+  8003e0:	e8 5f fe ff ff       	call   800244 <printfmt>
+  8003e5:	83 c4 10             	add    $0x10,%esp
+  8003e8:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003eb:	e9 82 fe ff ff       	jmp    800272 <vprintfmt+0x11>
+  8003f0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f6:	83 c0 04             	add    $0x4,%eax
+  8003f9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8003fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ff:	8b 00                	mov    (%eax),%eax
+  800401:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800404:	85 c0                	test   %eax,%eax
+  800406:	0f 84 61 03 00 00    	je     80076d <vprintfmt+0x50c>
+  80040c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800410:	7e 06                	jle    800418 <vprintfmt+0x1b7>
+  800412:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800416:	75 29                	jne    800441 <vprintfmt+0x1e0>
+  800418:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80041b:	8d 70 01             	lea    0x1(%eax),%esi
+  80041e:	0f b6 00             	movzbl (%eax),%eax
+  800421:	0f be d0             	movsbl %al,%edx
+  800424:	85 d2                	test   %edx,%edx
+  800426:	0f 84 bb 00 00 00    	je     8004e7 <vprintfmt+0x286>
+  80042c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80042f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800432:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800435:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800438:	eb 7a                	jmp    8004b4 <vprintfmt+0x253>
+  80043a:	c7 45 d0 a9 31 80 00 	movl   $0x8031a9,-0x30(%ebp)
+  800441:	83 ec 08             	sub    $0x8,%esp
+  800444:	ff 75 d4             	push   -0x2c(%ebp)
+  800447:	ff 75 d0             	push   -0x30(%ebp)
+  80044a:	e8 e0 03 00 00       	call   80082f <strnlen>
+  80044f:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800452:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800455:	83 c4 10             	add    $0x10,%esp
+  800458:	85 d2                	test   %edx,%edx
+  80045a:	0f 8e d6 02 00 00    	jle    800736 <vprintfmt+0x4d5>
+  800460:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800464:	83 ec 08             	sub    $0x8,%esp
+  800467:	53                   	push   %ebx
+  800468:	56                   	push   %esi
+  800469:	ff d7                	call   *%edi
+  80046b:	83 c4 10             	add    $0x10,%esp
+  80046e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800472:	75 f0                	jne    800464 <vprintfmt+0x203>
+  800474:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800477:	8d 70 01             	lea    0x1(%eax),%esi
+  80047a:	0f b6 00             	movzbl (%eax),%eax
+  80047d:	0f be d0             	movsbl %al,%edx
+  800480:	85 d2                	test   %edx,%edx
+  800482:	0f 84 da 02 00 00    	je     800762 <vprintfmt+0x501>
+  800488:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80048b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80048e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800491:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800494:	eb 1e                	jmp    8004b4 <vprintfmt+0x253>
+  800496:	83 ec 08             	sub    $0x8,%esp
+  800499:	ff 75 0c             	push   0xc(%ebp)
+  80049c:	52                   	push   %edx
+  80049d:	ff 55 08             	call   *0x8(%ebp)
+  8004a0:	83 c4 10             	add    $0x10,%esp
+  8004a3:	83 eb 01             	sub    $0x1,%ebx
+  8004a6:	83 c6 01             	add    $0x1,%esi
+  8004a9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004ad:	0f be d0             	movsbl %al,%edx
+  8004b0:	85 d2                	test   %edx,%edx
+  8004b2:	74 2a                	je     8004de <vprintfmt+0x27d>
+  8004b4:	85 ff                	test   %edi,%edi
+  8004b6:	78 05                	js     8004bd <vprintfmt+0x25c>
+  8004b8:	83 ef 01             	sub    $0x1,%edi
+  8004bb:	78 59                	js     800516 <vprintfmt+0x2b5>
+  8004bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c1:	74 d3                	je     800496 <vprintfmt+0x235>
+  8004c3:	0f be c0             	movsbl %al,%eax
+  8004c6:	83 e8 20             	sub    $0x20,%eax
+  8004c9:	83 f8 5e             	cmp    $0x5e,%eax
+  8004cc:	76 c8                	jbe    800496 <vprintfmt+0x235>
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+  8004d1:	ff 75 0c             	push   0xc(%ebp)
+  8004d4:	6a 3f                	push   $0x3f
+  8004d6:	ff 55 08             	call   *0x8(%ebp)
+  8004d9:	83 c4 10             	add    $0x10,%esp
+  8004dc:	eb c5                	jmp    8004a3 <vprintfmt+0x242>
+  8004de:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8004e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8004e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004e7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8004ea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004ee:	7e 1b                	jle    80050b <vprintfmt+0x2aa>
+  8004f0:	83 ec 08             	sub    $0x8,%esp
+  8004f3:	53                   	push   %ebx
+  8004f4:	6a 20                	push   $0x20
+  8004f6:	ff d7                	call   *%edi
+  8004f8:	83 c4 10             	add    $0x10,%esp
+  8004fb:	83 ee 01             	sub    $0x1,%esi
+  8004fe:	75 f0                	jne    8004f0 <vprintfmt+0x28f>
+  800500:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800503:	89 45 14             	mov    %eax,0x14(%ebp)
+  800506:	e9 67 fd ff ff       	jmp    800272 <vprintfmt+0x11>
+  80050b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80050e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800511:	e9 5c fd ff ff       	jmp    800272 <vprintfmt+0x11>
+  800516:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800519:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80051c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80051f:	eb c6                	jmp    8004e7 <vprintfmt+0x286>
+  800521:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800524:	89 55 10             	mov    %edx,0x10(%ebp)
+  800527:	83 f9 01             	cmp    $0x1,%ecx
+  80052a:	7f 1f                	jg     80054b <vprintfmt+0x2ea>
+  80052c:	85 c9                	test   %ecx,%ecx
+  80052e:	74 67                	je     800597 <vprintfmt+0x336>
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8b 30                	mov    (%eax),%esi
+  800535:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800538:	89 f0                	mov    %esi,%eax
+  80053a:	c1 f8 1f             	sar    $0x1f,%eax
+  80053d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800540:	8b 45 14             	mov    0x14(%ebp),%eax
+  800543:	8d 40 04             	lea    0x4(%eax),%eax
+  800546:	89 45 14             	mov    %eax,0x14(%ebp)
+  800549:	eb 17                	jmp    800562 <vprintfmt+0x301>
+  80054b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054e:	8b 50 04             	mov    0x4(%eax),%edx
+  800551:	8b 00                	mov    (%eax),%eax
+  800553:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800556:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800559:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055c:	8d 40 08             	lea    0x8(%eax),%eax
+  80055f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800562:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800565:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800568:	be 0a 00 00 00       	mov    $0xa,%esi
+  80056d:	85 c9                	test   %ecx,%ecx
+  80056f:	0f 89 12 01 00 00    	jns    800687 <vprintfmt+0x426>
+  800575:	83 ec 08             	sub    $0x8,%esp
+  800578:	53                   	push   %ebx
+  800579:	6a 2d                	push   $0x2d
+  80057b:	ff d7                	call   *%edi
+  80057d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800580:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800583:	f7 da                	neg    %edx
+  800585:	83 d1 00             	adc    $0x0,%ecx
+  800588:	f7 d9                	neg    %ecx
+  80058a:	83 c4 10             	add    $0x10,%esp
+  80058d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800592:	e9 f0 00 00 00       	jmp    800687 <vprintfmt+0x426>
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8b 30                	mov    (%eax),%esi
+  80059c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80059f:	89 f0                	mov    %esi,%eax
+  8005a1:	c1 f8 1f             	sar    $0x1f,%eax
+  8005a4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b0:	eb b0                	jmp    800562 <vprintfmt+0x301>
+  8005b2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005b5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005b8:	83 f9 01             	cmp    $0x1,%ecx
+  8005bb:	7f 1e                	jg     8005db <vprintfmt+0x37a>
+  8005bd:	85 c9                	test   %ecx,%ecx
+  8005bf:	74 32                	je     8005f3 <vprintfmt+0x392>
+  8005c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c4:	8b 10                	mov    (%eax),%edx
+  8005c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005d6:	e9 ac 00 00 00       	jmp    800687 <vprintfmt+0x426>
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8b 10                	mov    (%eax),%edx
+  8005e0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005ee:	e9 94 00 00 00       	jmp    800687 <vprintfmt+0x426>
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8b 10                	mov    (%eax),%edx
+  8005f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800600:	89 45 14             	mov    %eax,0x14(%ebp)
+  800603:	be 0a 00 00 00       	mov    $0xa,%esi
+  800608:	eb 7d                	jmp    800687 <vprintfmt+0x426>
+  80060a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80060d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800610:	83 f9 01             	cmp    $0x1,%ecx
+  800613:	7f 1b                	jg     800630 <vprintfmt+0x3cf>
+  800615:	85 c9                	test   %ecx,%ecx
+  800617:	74 2c                	je     800645 <vprintfmt+0x3e4>
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8b 10                	mov    (%eax),%edx
+  80061e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800623:	8d 40 04             	lea    0x4(%eax),%eax
+  800626:	89 45 14             	mov    %eax,0x14(%ebp)
+  800629:	be 08 00 00 00       	mov    $0x8,%esi
+  80062e:	eb 57                	jmp    800687 <vprintfmt+0x426>
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8b 10                	mov    (%eax),%edx
+  800635:	8b 48 04             	mov    0x4(%eax),%ecx
+  800638:	8d 40 08             	lea    0x8(%eax),%eax
+  80063b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063e:	be 08 00 00 00       	mov    $0x8,%esi
+  800643:	eb 42                	jmp    800687 <vprintfmt+0x426>
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8b 10                	mov    (%eax),%edx
+  80064a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	be 08 00 00 00       	mov    $0x8,%esi
+  80065a:	eb 2b                	jmp    800687 <vprintfmt+0x426>
+  80065c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	53                   	push   %ebx
+  800663:	6a 30                	push   $0x30
+  800665:	ff d7                	call   *%edi
+  800667:	83 c4 08             	add    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	6a 78                	push   $0x78
+  80066d:	ff d7                	call   *%edi
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800679:	83 c4 10             	add    $0x10,%esp
+  80067c:	8d 40 04             	lea    0x4(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800682:	be 10 00 00 00       	mov    $0x10,%esi
+  800687:	83 ec 0c             	sub    $0xc,%esp
+  80068a:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80068e:	50                   	push   %eax
+  80068f:	ff 75 e4             	push   -0x1c(%ebp)
+  800692:	56                   	push   %esi
+  800693:	51                   	push   %ecx
+  800694:	52                   	push   %edx
+  800695:	89 da                	mov    %ebx,%edx
+  800697:	89 f8                	mov    %edi,%eax
+  800699:	e8 d8 fa ff ff       	call   800176 <printnum>
+  80069e:	83 c4 20             	add    $0x20,%esp
+  8006a1:	e9 cc fb ff ff       	jmp    800272 <vprintfmt+0x11>
+  8006a6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ac:	83 f9 01             	cmp    $0x1,%ecx
+  8006af:	7f 1b                	jg     8006cc <vprintfmt+0x46b>
+  8006b1:	85 c9                	test   %ecx,%ecx
+  8006b3:	74 2c                	je     8006e1 <vprintfmt+0x480>
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8b 10                	mov    (%eax),%edx
+  8006ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c5:	be 10 00 00 00       	mov    $0x10,%esi
+  8006ca:	eb bb                	jmp    800687 <vprintfmt+0x426>
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 10                	mov    (%eax),%edx
+  8006d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006da:	be 10 00 00 00       	mov    $0x10,%esi
+  8006df:	eb a6                	jmp    800687 <vprintfmt+0x426>
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 10                	mov    (%eax),%edx
+  8006e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f1:	be 10 00 00 00       	mov    $0x10,%esi
+  8006f6:	eb 8f                	jmp    800687 <vprintfmt+0x426>
+  8006f8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006fb:	83 ec 08             	sub    $0x8,%esp
+  8006fe:	53                   	push   %ebx
+  8006ff:	6a 25                	push   $0x25
+  800701:	ff d7                	call   *%edi
+  800703:	83 c4 10             	add    $0x10,%esp
+  800706:	e9 67 fb ff ff       	jmp    800272 <vprintfmt+0x11>
+  80070b:	83 ec 08             	sub    $0x8,%esp
+  80070e:	53                   	push   %ebx
+  80070f:	6a 25                	push   $0x25
+  800711:	ff d7                	call   *%edi
+  800713:	83 c4 10             	add    $0x10,%esp
+  800716:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80071a:	0f 84 ba fb ff ff    	je     8002da <vprintfmt+0x79>
+  800720:	89 75 10             	mov    %esi,0x10(%ebp)
+  800723:	89 f0                	mov    %esi,%eax
+  800725:	83 e8 01             	sub    $0x1,%eax
+  800728:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80072c:	75 f7                	jne    800725 <vprintfmt+0x4c4>
+  80072e:	89 45 10             	mov    %eax,0x10(%ebp)
+  800731:	e9 3c fb ff ff       	jmp    800272 <vprintfmt+0x11>
+  800736:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800739:	8d 70 01             	lea    0x1(%eax),%esi
+  80073c:	0f b6 00             	movzbl (%eax),%eax
+  80073f:	0f be d0             	movsbl %al,%edx
+  800742:	85 d2                	test   %edx,%edx
+  800744:	74 11                	je     800757 <vprintfmt+0x4f6>
+  800746:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800749:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80074c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80074f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800752:	e9 5d fd ff ff       	jmp    8004b4 <vprintfmt+0x253>
+  800757:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80075a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075d:	e9 10 fb ff ff       	jmp    800272 <vprintfmt+0x11>
+  800762:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800765:	89 45 14             	mov    %eax,0x14(%ebp)
+  800768:	e9 05 fb ff ff       	jmp    800272 <vprintfmt+0x11>
+  80076d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800771:	7e 0a                	jle    80077d <vprintfmt+0x51c>
+  800773:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800777:	0f 85 bd fc ff ff    	jne    80043a <vprintfmt+0x1d9>
+  80077d:	ba 28 00 00 00       	mov    $0x28,%edx
+  800782:	b8 28 00 00 00       	mov    $0x28,%eax
+  800787:	be aa 31 80 00       	mov    $0x8031aa,%esi
+  80078c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80078f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800792:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800795:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800798:	e9 17 fd ff ff       	jmp    8004b4 <vprintfmt+0x253>
+  80079d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a0:	5b                   	pop    %ebx
+  8007a1:	5e                   	pop    %esi
+  8007a2:	5f                   	pop    %edi
+  8007a3:	5d                   	pop    %ebp
+  8007a4:	c3                   	ret
+
+008007a5 <vsnprintf>:
+  8007a5:	55                   	push   %ebp
+  8007a6:	89 e5                	mov    %esp,%ebp
+  8007a8:	83 ec 18             	sub    $0x18,%esp
+  8007ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007b4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007b8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007bb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8007c2:	85 c0                	test   %eax,%eax
+  8007c4:	74 26                	je     8007ec <vsnprintf+0x47>
+  8007c6:	85 d2                	test   %edx,%edx
+  8007c8:	7e 22                	jle    8007ec <vsnprintf+0x47>
+  8007ca:	ff 75 14             	push   0x14(%ebp)
+  8007cd:	ff 75 10             	push   0x10(%ebp)
+  8007d0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007d3:	50                   	push   %eax
+  8007d4:	68 27 02 80 00       	push   $0x800227
+  8007d9:	e8 83 fa ff ff       	call   800261 <vprintfmt>
+  8007de:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007e1:	c6 00 00             	movb   $0x0,(%eax)
+  8007e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007e7:	83 c4 10             	add    $0x10,%esp
+  8007ea:	c9                   	leave
+  8007eb:	c3                   	ret
+  8007ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f1:	eb f7                	jmp    8007ea <vsnprintf+0x45>
+
+008007f3 <snprintf>:
+  8007f3:	55                   	push   %ebp
+  8007f4:	89 e5                	mov    %esp,%ebp
+  8007f6:	83 ec 08             	sub    $0x8,%esp
+  8007f9:	8d 45 14             	lea    0x14(%ebp),%eax
+  8007fc:	50                   	push   %eax
+  8007fd:	ff 75 10             	push   0x10(%ebp)
+  800800:	ff 75 0c             	push   0xc(%ebp)
+  800803:	ff 75 08             	push   0x8(%ebp)
+  800806:	e8 9a ff ff ff       	call   8007a5 <vsnprintf>
+  80080b:	c9                   	leave
+  80080c:	c3                   	ret
+
+0080080d <strlen>:
+  80080d:	55                   	push   %ebp
+  80080e:	89 e5                	mov    %esp,%ebp
+  800810:	8b 55 08             	mov    0x8(%ebp),%edx
+  800813:	80 3a 00             	cmpb   $0x0,(%edx)
+  800816:	74 10                	je     800828 <strlen+0x1b>
+  800818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081d:	83 c0 01             	add    $0x1,%eax
+  800820:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800824:	75 f7                	jne    80081d <strlen+0x10>
+  800826:	5d                   	pop    %ebp
+  800827:	c3                   	ret
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	eb f7                	jmp    800826 <strlen+0x19>
+
+0080082f <strnlen>:
+  80082f:	55                   	push   %ebp
+  800830:	89 e5                	mov    %esp,%ebp
+  800832:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800835:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800838:	85 d2                	test   %edx,%edx
+  80083a:	74 16                	je     800852 <strnlen+0x23>
+  80083c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800841:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800845:	74 09                	je     800850 <strnlen+0x21>
+  800847:	83 c0 01             	add    $0x1,%eax
+  80084a:	39 d0                	cmp    %edx,%eax
+  80084c:	75 f3                	jne    800841 <strnlen+0x12>
+  80084e:	89 d0                	mov    %edx,%eax
+  800850:	5d                   	pop    %ebp
+  800851:	c3                   	ret
+  800852:	b8 00 00 00 00       	mov    $0x0,%eax
+  800857:	eb f7                	jmp    800850 <strnlen+0x21>
+
+00800859 <strcpy>:
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	53                   	push   %ebx
+  80085d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800860:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800863:	b8 00 00 00 00       	mov    $0x0,%eax
+  800868:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80086c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80086f:	83 c0 01             	add    $0x1,%eax
+  800872:	84 d2                	test   %dl,%dl
+  800874:	75 f2                	jne    800868 <strcpy+0xf>
+  800876:	89 c8                	mov    %ecx,%eax
+  800878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087b:	c9                   	leave
+  80087c:	c3                   	ret
+
+0080087d <strcat>:
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	53                   	push   %ebx
+  800881:	83 ec 10             	sub    $0x10,%esp
+  800884:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800887:	53                   	push   %ebx
+  800888:	e8 80 ff ff ff       	call   80080d <strlen>
+  80088d:	83 c4 08             	add    $0x8,%esp
+  800890:	ff 75 0c             	push   0xc(%ebp)
+  800893:	01 d8                	add    %ebx,%eax
+  800895:	50                   	push   %eax
+  800896:	e8 be ff ff ff       	call   800859 <strcpy>
+  80089b:	89 d8                	mov    %ebx,%eax
+  80089d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a0:	c9                   	leave
+  8008a1:	c3                   	ret
+
+008008a2 <strncpy>:
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	56                   	push   %esi
+  8008a6:	53                   	push   %ebx
+  8008a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008b0:	85 db                	test   %ebx,%ebx
+  8008b2:	74 17                	je     8008cb <strncpy+0x29>
+  8008b4:	01 f3                	add    %esi,%ebx
+  8008b6:	89 f0                	mov    %esi,%eax
+  8008b8:	83 c0 01             	add    $0x1,%eax
+  8008bb:	0f b6 0a             	movzbl (%edx),%ecx
+  8008be:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008c1:	80 f9 01             	cmp    $0x1,%cl
+  8008c4:	83 da ff             	sbb    $0xffffffff,%edx
+  8008c7:	39 c3                	cmp    %eax,%ebx
+  8008c9:	75 ed                	jne    8008b8 <strncpy+0x16>
+  8008cb:	89 f0                	mov    %esi,%eax
+  8008cd:	5b                   	pop    %ebx
+  8008ce:	5e                   	pop    %esi
+  8008cf:	5d                   	pop    %ebp
+  8008d0:	c3                   	ret
+
+008008d1 <strlcpy>:
+  8008d1:	55                   	push   %ebp
+  8008d2:	89 e5                	mov    %esp,%ebp
+  8008d4:	56                   	push   %esi
+  8008d5:	53                   	push   %ebx
+  8008d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008df:	89 f0                	mov    %esi,%eax
+  8008e1:	85 db                	test   %ebx,%ebx
+  8008e3:	74 1e                	je     800903 <strlcpy+0x32>
+  8008e5:	83 eb 01             	sub    $0x1,%ebx
+  8008e8:	74 16                	je     800900 <strlcpy+0x2f>
+  8008ea:	01 f3                	add    %esi,%ebx
+  8008ec:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ef:	84 c9                	test   %cl,%cl
+  8008f1:	74 0d                	je     800900 <strlcpy+0x2f>
+  8008f3:	83 c2 01             	add    $0x1,%edx
+  8008f6:	83 c0 01             	add    $0x1,%eax
+  8008f9:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008fc:	39 d8                	cmp    %ebx,%eax
+  8008fe:	75 ec                	jne    8008ec <strlcpy+0x1b>
+  800900:	c6 00 00             	movb   $0x0,(%eax)
+  800903:	29 f0                	sub    %esi,%eax
+  800905:	5b                   	pop    %ebx
+  800906:	5e                   	pop    %esi
+  800907:	5d                   	pop    %ebp
+  800908:	c3                   	ret
+
+00800909 <strcmp>:
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800912:	0f b6 01             	movzbl (%ecx),%eax
+  800915:	84 c0                	test   %al,%al
+  800917:	74 11                	je     80092a <strcmp+0x21>
+  800919:	38 02                	cmp    %al,(%edx)
+  80091b:	75 0d                	jne    80092a <strcmp+0x21>
+  80091d:	83 c1 01             	add    $0x1,%ecx
+  800920:	83 c2 01             	add    $0x1,%edx
+  800923:	0f b6 01             	movzbl (%ecx),%eax
+  800926:	84 c0                	test   %al,%al
+  800928:	75 ef                	jne    800919 <strcmp+0x10>
+  80092a:	0f b6 c0             	movzbl %al,%eax
+  80092d:	0f b6 12             	movzbl (%edx),%edx
+  800930:	29 d0                	sub    %edx,%eax
+  800932:	5d                   	pop    %ebp
+  800933:	c3                   	ret
+
+00800934 <strncmp>:
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	53                   	push   %ebx
+  800938:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80093e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800941:	b8 00 00 00 00       	mov    $0x0,%eax
+  800946:	85 d2                	test   %edx,%edx
+  800948:	74 2e                	je     800978 <strncmp+0x44>
+  80094a:	0f b6 01             	movzbl (%ecx),%eax
+  80094d:	84 c0                	test   %al,%al
+  80094f:	74 16                	je     800967 <strncmp+0x33>
+  800951:	3a 03                	cmp    (%ebx),%al
+  800953:	75 12                	jne    800967 <strncmp+0x33>
+  800955:	83 c1 01             	add    $0x1,%ecx
+  800958:	83 c3 01             	add    $0x1,%ebx
+  80095b:	83 ea 01             	sub    $0x1,%edx
+  80095e:	75 ea                	jne    80094a <strncmp+0x16>
+  800960:	b8 00 00 00 00       	mov    $0x0,%eax
+  800965:	eb 11                	jmp    800978 <strncmp+0x44>
+  800967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096c:	85 d2                	test   %edx,%edx
+  80096e:	74 08                	je     800978 <strncmp+0x44>
+  800970:	0f b6 01             	movzbl (%ecx),%eax
+  800973:	0f b6 13             	movzbl (%ebx),%edx
+  800976:	29 d0                	sub    %edx,%eax
+  800978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+0080097d <strchr>:
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	8b 45 08             	mov    0x8(%ebp),%eax
+  800983:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800987:	0f b6 10             	movzbl (%eax),%edx
+  80098a:	84 d2                	test   %dl,%dl
+  80098c:	74 15                	je     8009a3 <strchr+0x26>
+  80098e:	38 d1                	cmp    %dl,%cl
+  800990:	74 0f                	je     8009a1 <strchr+0x24>
+  800992:	83 c0 01             	add    $0x1,%eax
+  800995:	0f b6 10             	movzbl (%eax),%edx
+  800998:	84 d2                	test   %dl,%dl
+  80099a:	75 f2                	jne    80098e <strchr+0x11>
+  80099c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a1:	5d                   	pop    %ebp
+  8009a2:	c3                   	ret
+  8009a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a8:	eb f7                	jmp    8009a1 <strchr+0x24>
+
+008009aa <strfind>:
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	53                   	push   %ebx
+  8009ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009b4:	0f b6 18             	movzbl (%eax),%ebx
+  8009b7:	38 d3                	cmp    %dl,%bl
+  8009b9:	74 14                	je     8009cf <strfind+0x25>
+  8009bb:	89 d1                	mov    %edx,%ecx
+  8009bd:	84 db                	test   %bl,%bl
+  8009bf:	74 0e                	je     8009cf <strfind+0x25>
+  8009c1:	83 c0 01             	add    $0x1,%eax
+  8009c4:	0f b6 10             	movzbl (%eax),%edx
+  8009c7:	38 ca                	cmp    %cl,%dl
+  8009c9:	74 04                	je     8009cf <strfind+0x25>
+  8009cb:	84 d2                	test   %dl,%dl
+  8009cd:	75 f2                	jne    8009c1 <strfind+0x17>
+  8009cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d2:	c9                   	leave
+  8009d3:	c3                   	ret
+
+008009d4 <memset>:
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	57                   	push   %edi
+  8009d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009db:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8009de:	85 c9                	test   %ecx,%ecx
+  8009e0:	74 20                	je     800a02 <memset+0x2e>
+  8009e2:	89 f8                	mov    %edi,%eax
+  8009e4:	09 c8                	or     %ecx,%eax
+  8009e6:	a8 03                	test   $0x3,%al
+  8009e8:	75 12                	jne    8009fc <memset+0x28>
+  8009ea:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009ee:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  8009f4:	c1 e9 02             	shr    $0x2,%ecx
+  8009f7:	fc                   	cld
+  8009f8:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009fa:	eb 06                	jmp    800a02 <memset+0x2e>
+  8009fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009ff:	fc                   	cld
+  800a00:	f3 aa                	rep stos %al,%es:(%edi)
+  800a02:	89 f8                	mov    %edi,%eax
+  800a04:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a07:	c9                   	leave
+  800a08:	c3                   	ret
+
+00800a09 <memmove>:
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	57                   	push   %edi
+  800a0d:	56                   	push   %esi
+  800a0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a11:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a14:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a17:	39 c6                	cmp    %eax,%esi
+  800a19:	73 32                	jae    800a4d <memmove+0x44>
+  800a1b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a1e:	39 d0                	cmp    %edx,%eax
+  800a20:	73 2b                	jae    800a4d <memmove+0x44>
+  800a22:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a25:	89 d6                	mov    %edx,%esi
+  800a27:	09 fe                	or     %edi,%esi
+  800a29:	09 ce                	or     %ecx,%esi
+  800a2b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a31:	75 0e                	jne    800a41 <memmove+0x38>
+  800a33:	83 ef 04             	sub    $0x4,%edi
+  800a36:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a39:	c1 e9 02             	shr    $0x2,%ecx
+  800a3c:	fd                   	std
+  800a3d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a3f:	eb 09                	jmp    800a4a <memmove+0x41>
+  800a41:	83 ef 01             	sub    $0x1,%edi
+  800a44:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800a47:	fd                   	std
+  800a48:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a4a:	fc                   	cld
+  800a4b:	eb 1a                	jmp    800a67 <memmove+0x5e>
+  800a4d:	89 f2                	mov    %esi,%edx
+  800a4f:	09 c2                	or     %eax,%edx
+  800a51:	09 ca                	or     %ecx,%edx
+  800a53:	f6 c2 03             	test   $0x3,%dl
+  800a56:	75 0a                	jne    800a62 <memmove+0x59>
+  800a58:	c1 e9 02             	shr    $0x2,%ecx
+  800a5b:	89 c7                	mov    %eax,%edi
+  800a5d:	fc                   	cld
+  800a5e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a60:	eb 05                	jmp    800a67 <memmove+0x5e>
+  800a62:	89 c7                	mov    %eax,%edi
+  800a64:	fc                   	cld
+  800a65:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a67:	5e                   	pop    %esi
+  800a68:	5f                   	pop    %edi
+  800a69:	5d                   	pop    %ebp
+  800a6a:	c3                   	ret
+
+00800a6b <memcpy>:
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	83 ec 0c             	sub    $0xc,%esp
+  800a71:	ff 75 10             	push   0x10(%ebp)
+  800a74:	ff 75 0c             	push   0xc(%ebp)
+  800a77:	ff 75 08             	push   0x8(%ebp)
+  800a7a:	e8 8a ff ff ff       	call   800a09 <memmove>
+  800a7f:	c9                   	leave
+  800a80:	c3                   	ret
+
+00800a81 <memcmp>:
+  800a81:	55                   	push   %ebp
+  800a82:	89 e5                	mov    %esp,%ebp
+  800a84:	56                   	push   %esi
+  800a85:	53                   	push   %ebx
+  800a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a8c:	8b 75 10             	mov    0x10(%ebp),%esi
+  800a8f:	85 f6                	test   %esi,%esi
+  800a91:	74 29                	je     800abc <memcmp+0x3b>
+  800a93:	01 c6                	add    %eax,%esi
+  800a95:	0f b6 08             	movzbl (%eax),%ecx
+  800a98:	0f b6 1a             	movzbl (%edx),%ebx
+  800a9b:	38 d9                	cmp    %bl,%cl
+  800a9d:	75 11                	jne    800ab0 <memcmp+0x2f>
+  800a9f:	83 c0 01             	add    $0x1,%eax
+  800aa2:	83 c2 01             	add    $0x1,%edx
+  800aa5:	39 c6                	cmp    %eax,%esi
+  800aa7:	75 ec                	jne    800a95 <memcmp+0x14>
+  800aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aae:	eb 08                	jmp    800ab8 <memcmp+0x37>
+  800ab0:	0f b6 c1             	movzbl %cl,%eax
+  800ab3:	0f b6 db             	movzbl %bl,%ebx
+  800ab6:	29 d8                	sub    %ebx,%eax
+  800ab8:	5b                   	pop    %ebx
+  800ab9:	5e                   	pop    %esi
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+  800abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac1:	eb f5                	jmp    800ab8 <memcmp+0x37>
+
+00800ac3 <memfind>:
+  800ac3:	55                   	push   %ebp
+  800ac4:	89 e5                	mov    %esp,%ebp
+  800ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800acc:	89 c2                	mov    %eax,%edx
+  800ace:	03 55 10             	add    0x10(%ebp),%edx
+  800ad1:	39 d0                	cmp    %edx,%eax
+  800ad3:	73 0d                	jae    800ae2 <memfind+0x1f>
+  800ad5:	38 08                	cmp    %cl,(%eax)
+  800ad7:	74 0d                	je     800ae6 <memfind+0x23>
+  800ad9:	83 c0 01             	add    $0x1,%eax
+  800adc:	39 c2                	cmp    %eax,%edx
+  800ade:	75 f5                	jne    800ad5 <memfind+0x12>
+  800ae0:	eb 06                	jmp    800ae8 <memfind+0x25>
+  800ae2:	89 c2                	mov    %eax,%edx
+  800ae4:	eb 02                	jmp    800ae8 <memfind+0x25>
+  800ae6:	89 c2                	mov    %eax,%edx
+  800ae8:	89 d0                	mov    %edx,%eax
+  800aea:	5d                   	pop    %ebp
+  800aeb:	c3                   	ret
+
+00800aec <strtol>:
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	57                   	push   %edi
+  800af0:	56                   	push   %esi
+  800af1:	53                   	push   %ebx
+  800af2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800af8:	0f b6 02             	movzbl (%edx),%eax
+  800afb:	3c 20                	cmp    $0x20,%al
+  800afd:	74 04                	je     800b03 <strtol+0x17>
+  800aff:	3c 09                	cmp    $0x9,%al
+  800b01:	75 0e                	jne    800b11 <strtol+0x25>
+  800b03:	83 c2 01             	add    $0x1,%edx
+  800b06:	0f b6 02             	movzbl (%edx),%eax
+  800b09:	3c 20                	cmp    $0x20,%al
+  800b0b:	74 f6                	je     800b03 <strtol+0x17>
+  800b0d:	3c 09                	cmp    $0x9,%al
+  800b0f:	74 f2                	je     800b03 <strtol+0x17>
+  800b11:	3c 2b                	cmp    $0x2b,%al
+  800b13:	74 2a                	je     800b3f <strtol+0x53>
+  800b15:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b1a:	3c 2d                	cmp    $0x2d,%al
+  800b1c:	74 2b                	je     800b49 <strtol+0x5d>
+  800b1e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b24:	75 0f                	jne    800b35 <strtol+0x49>
+  800b26:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b29:	74 28                	je     800b53 <strtol+0x67>
+  800b2b:	85 db                	test   %ebx,%ebx
+  800b2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b32:	0f 44 d8             	cmove  %eax,%ebx
+  800b35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b3d:	eb 46                	jmp    800b85 <strtol+0x99>
+  800b3f:	83 c2 01             	add    $0x1,%edx
+  800b42:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b47:	eb d5                	jmp    800b1e <strtol+0x32>
+  800b49:	83 c2 01             	add    $0x1,%edx
+  800b4c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b51:	eb cb                	jmp    800b1e <strtol+0x32>
+  800b53:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b57:	74 0e                	je     800b67 <strtol+0x7b>
+  800b59:	85 db                	test   %ebx,%ebx
+  800b5b:	75 d8                	jne    800b35 <strtol+0x49>
+  800b5d:	83 c2 01             	add    $0x1,%edx
+  800b60:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b65:	eb ce                	jmp    800b35 <strtol+0x49>
+  800b67:	83 c2 02             	add    $0x2,%edx
+  800b6a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b6f:	eb c4                	jmp    800b35 <strtol+0x49>
+  800b71:	0f be c0             	movsbl %al,%eax
+  800b74:	83 e8 30             	sub    $0x30,%eax
+  800b77:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b7a:	7d 3a                	jge    800bb6 <strtol+0xca>
+  800b7c:	83 c2 01             	add    $0x1,%edx
+  800b7f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b83:	01 c1                	add    %eax,%ecx
+  800b85:	0f b6 02             	movzbl (%edx),%eax
+  800b88:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b8b:	89 f3                	mov    %esi,%ebx
+  800b8d:	80 fb 09             	cmp    $0x9,%bl
+  800b90:	76 df                	jbe    800b71 <strtol+0x85>
+  800b92:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b95:	89 f3                	mov    %esi,%ebx
+  800b97:	80 fb 19             	cmp    $0x19,%bl
+  800b9a:	77 08                	ja     800ba4 <strtol+0xb8>
+  800b9c:	0f be c0             	movsbl %al,%eax
+  800b9f:	83 e8 57             	sub    $0x57,%eax
+  800ba2:	eb d3                	jmp    800b77 <strtol+0x8b>
+  800ba4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ba7:	89 f3                	mov    %esi,%ebx
+  800ba9:	80 fb 19             	cmp    $0x19,%bl
+  800bac:	77 08                	ja     800bb6 <strtol+0xca>
+  800bae:	0f be c0             	movsbl %al,%eax
+  800bb1:	83 e8 37             	sub    $0x37,%eax
+  800bb4:	eb c1                	jmp    800b77 <strtol+0x8b>
+  800bb6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bba:	74 05                	je     800bc1 <strtol+0xd5>
+  800bbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bbf:	89 10                	mov    %edx,(%eax)
+  800bc1:	89 c8                	mov    %ecx,%eax
+  800bc3:	f7 d8                	neg    %eax
+  800bc5:	85 ff                	test   %edi,%edi
+  800bc7:	0f 45 c8             	cmovne %eax,%ecx
+  800bca:	89 c8                	mov    %ecx,%eax
+  800bcc:	5b                   	pop    %ebx
+  800bcd:	5e                   	pop    %esi
+  800bce:	5f                   	pop    %edi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+
+00800bd1 <sys_cputs>:
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	57                   	push   %edi
+  800bd5:	56                   	push   %esi
+  800bd6:	53                   	push   %ebx
+  800bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be2:	89 c3                	mov    %eax,%ebx
+  800be4:	89 c7                	mov    %eax,%edi
+  800be6:	89 c6                	mov    %eax,%esi
+  800be8:	cd 30                	int    $0x30
+  800bea:	5b                   	pop    %ebx
+  800beb:	5e                   	pop    %esi
+  800bec:	5f                   	pop    %edi
+  800bed:	5d                   	pop    %ebp
+  800bee:	c3                   	ret
+
+00800bef <sys_cgetc>:
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	57                   	push   %edi
+  800bf3:	56                   	push   %esi
+  800bf4:	53                   	push   %ebx
+  800bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfa:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bff:	89 d1                	mov    %edx,%ecx
+  800c01:	89 d3                	mov    %edx,%ebx
+  800c03:	89 d7                	mov    %edx,%edi
+  800c05:	89 d6                	mov    %edx,%esi
+  800c07:	cd 30                	int    $0x30
+  800c09:	5b                   	pop    %ebx
+  800c0a:	5e                   	pop    %esi
+  800c0b:	5f                   	pop    %edi
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	c3                   	ret
+
+00800c0e <sys_env_destroy>:
+  800c0e:	55                   	push   %ebp
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	57                   	push   %edi
+  800c12:	56                   	push   %esi
+  800c13:	53                   	push   %ebx
+  800c14:	83 ec 0c             	sub    $0xc,%esp
+  800c17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c24:	89 cb                	mov    %ecx,%ebx
+  800c26:	89 cf                	mov    %ecx,%edi
+  800c28:	89 ce                	mov    %ecx,%esi
+  800c2a:	cd 30                	int    $0x30
+  800c2c:	85 c0                	test   %eax,%eax
+  800c2e:	7f 08                	jg     800c38 <sys_env_destroy+0x2a>
+  800c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c33:	5b                   	pop    %ebx
+  800c34:	5e                   	pop    %esi
+  800c35:	5f                   	pop    %edi
+  800c36:	5d                   	pop    %ebp
+  800c37:	c3                   	ret
+  800c38:	83 ec 0c             	sub    $0xc,%esp
+  800c3b:	50                   	push   %eax
+  800c3c:	6a 03                	push   $0x3
+  800c3e:	68 ab 34 80 00       	push   $0x8034ab
+  800c43:	6a 24                	push   $0x24
+  800c45:	68 c8 34 80 00       	push   $0x8034c8
+  800c4a:	e8 37 20 00 00       	call   802c86 <_panic>
+
+00800c4f <sys_getenvid>:
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	57                   	push   %edi
+  800c53:	56                   	push   %esi
+  800c54:	53                   	push   %ebx
+  800c55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c5f:	89 d1                	mov    %edx,%ecx
+  800c61:	89 d3                	mov    %edx,%ebx
+  800c63:	89 d7                	mov    %edx,%edi
+  800c65:	89 d6                	mov    %edx,%esi
+  800c67:	cd 30                	int    $0x30
+  800c69:	5b                   	pop    %ebx
+  800c6a:	5e                   	pop    %esi
+  800c6b:	5f                   	pop    %edi
+  800c6c:	5d                   	pop    %ebp
+  800c6d:	c3                   	ret
+
+00800c6e <sys_yield>:
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	57                   	push   %edi
+  800c72:	56                   	push   %esi
+  800c73:	53                   	push   %ebx
+  800c74:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800c7b:	74 26                	je     800ca3 <sys_yield+0x35>
+  800c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c82:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c87:	89 d1                	mov    %edx,%ecx
+  800c89:	89 d3                	mov    %edx,%ebx
+  800c8b:	89 d7                	mov    %edx,%edi
+  800c8d:	6a 00                	push   $0x0
+  800c8f:	55                   	push   %ebp
+  800c90:	89 e5                	mov    %esp,%ebp
+  800c92:	8d 35 9a 0c 80 00    	lea    0x800c9a,%esi
+  800c98:	0f 34                	sysenter
+  800c9a:	5d                   	pop    %ebp
+  800c9b:	83 c4 04             	add    $0x4,%esp
+  800c9e:	5b                   	pop    %ebx
+  800c9f:	5e                   	pop    %esi
+  800ca0:	5f                   	pop    %edi
+  800ca1:	5d                   	pop    %ebp
+  800ca2:	c3                   	ret
+  800ca3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cad:	89 d1                	mov    %edx,%ecx
+  800caf:	89 d3                	mov    %edx,%ebx
+  800cb1:	89 d7                	mov    %edx,%edi
+  800cb3:	89 d6                	mov    %edx,%esi
+  800cb5:	cd 30                	int    $0x30
+  800cb7:	eb e5                	jmp    800c9e <sys_yield+0x30>
+
+00800cb9 <sys_page_alloc>:
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	57                   	push   %edi
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	83 ec 0c             	sub    $0xc,%esp
+  800cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccd:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd5:	89 f7                	mov    %esi,%edi
+  800cd7:	cd 30                	int    $0x30
+  800cd9:	85 c0                	test   %eax,%eax
+  800cdb:	7f 08                	jg     800ce5 <sys_page_alloc+0x2c>
+  800cdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce0:	5b                   	pop    %ebx
+  800ce1:	5e                   	pop    %esi
+  800ce2:	5f                   	pop    %edi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+  800ce5:	83 ec 0c             	sub    $0xc,%esp
+  800ce8:	50                   	push   %eax
+  800ce9:	6a 04                	push   $0x4
+  800ceb:	68 ab 34 80 00       	push   $0x8034ab
+  800cf0:	6a 24                	push   $0x24
+  800cf2:	68 c8 34 80 00       	push   $0x8034c8
+  800cf7:	e8 8a 1f 00 00       	call   802c86 <_panic>
+
+00800cfc <sys_page_map>:
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	57                   	push   %edi
+  800d00:	56                   	push   %esi
+  800d01:	53                   	push   %ebx
+  800d02:	83 ec 0c             	sub    $0xc,%esp
+  800d05:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d0c:	74 33                	je     800d41 <sys_page_map+0x45>
+  800d0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d14:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d1f:	ff 75 18             	push   0x18(%ebp)
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	8d 35 2d 0d 80 00    	lea    0x800d2d,%esi
+  800d2b:	0f 34                	sysenter
+  800d2d:	5d                   	pop    %ebp
+  800d2e:	83 c4 04             	add    $0x4,%esp
+  800d31:	89 c2                	mov    %eax,%edx
+  800d33:	85 c0                	test   %eax,%eax
+  800d35:	7f 3d                	jg     800d74 <sys_page_map+0x78>
+  800d37:	89 d0                	mov    %edx,%eax
+  800d39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5f                   	pop    %edi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+  800d41:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d52:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d55:	cd 30                	int    $0x30
+  800d57:	89 c2                	mov    %eax,%edx
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	7e da                	jle    800d37 <sys_page_map+0x3b>
+  800d5d:	83 ec 0c             	sub    $0xc,%esp
+  800d60:	50                   	push   %eax
+  800d61:	6a 05                	push   $0x5
+  800d63:	68 ab 34 80 00       	push   $0x8034ab
+  800d68:	6a 24                	push   $0x24
+  800d6a:	68 c8 34 80 00       	push   $0x8034c8
+  800d6f:	e8 12 1f 00 00       	call   802c86 <_panic>
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+  800d77:	50                   	push   %eax
+  800d78:	6a 05                	push   $0x5
+  800d7a:	68 ab 34 80 00       	push   $0x8034ab
+  800d7f:	6a 48                	push   $0x48
+  800d81:	68 c8 34 80 00       	push   $0x8034c8
+  800d86:	e8 fb 1e 00 00       	call   802c86 <_panic>
+
+00800d8b <sys_page_unmap>:
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	57                   	push   %edi
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+  800d94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800da4:	89 df                	mov    %ebx,%edi
+  800da6:	89 de                	mov    %ebx,%esi
+  800da8:	cd 30                	int    $0x30
+  800daa:	85 c0                	test   %eax,%eax
+  800dac:	7f 08                	jg     800db6 <sys_page_unmap+0x2b>
+  800dae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+  800db9:	50                   	push   %eax
+  800dba:	6a 06                	push   $0x6
+  800dbc:	68 ab 34 80 00       	push   $0x8034ab
+  800dc1:	6a 24                	push   $0x24
+  800dc3:	68 c8 34 80 00       	push   $0x8034c8
+  800dc8:	e8 b9 1e 00 00       	call   802c86 <_panic>
+
+00800dcd <sys_fork>:
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+  800dd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800ddd:	89 d1                	mov    %edx,%ecx
+  800ddf:	89 d3                	mov    %edx,%ebx
+  800de1:	89 d7                	mov    %edx,%edi
+  800de3:	89 d6                	mov    %edx,%esi
+  800de5:	cd 30                	int    $0x30
+  800de7:	5b                   	pop    %ebx
+  800de8:	5e                   	pop    %esi
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <sys_env_set_status>:
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  800df2:	83 ec 0c             	sub    $0xc,%esp
+  800df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e00:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e05:	89 df                	mov    %ebx,%edi
+  800e07:	89 de                	mov    %ebx,%esi
+  800e09:	cd 30                	int    $0x30
+  800e0b:	85 c0                	test   %eax,%eax
+  800e0d:	7f 08                	jg     800e17 <sys_env_set_status+0x2b>
+  800e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+  800e17:	83 ec 0c             	sub    $0xc,%esp
+  800e1a:	50                   	push   %eax
+  800e1b:	6a 08                	push   $0x8
+  800e1d:	68 ab 34 80 00       	push   $0x8034ab
+  800e22:	6a 24                	push   $0x24
+  800e24:	68 c8 34 80 00       	push   $0x8034c8
+  800e29:	e8 58 1e 00 00       	call   802c86 <_panic>
+
+00800e2e <sys_env_set_trapframe>:
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+  800e37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e42:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e47:	89 df                	mov    %ebx,%edi
+  800e49:	89 de                	mov    %ebx,%esi
+  800e4b:	cd 30                	int    $0x30
+  800e4d:	85 c0                	test   %eax,%eax
+  800e4f:	7f 08                	jg     800e59 <sys_env_set_trapframe+0x2b>
+  800e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 09                	push   $0x9
+  800e5f:	68 ab 34 80 00       	push   $0x8034ab
+  800e64:	6a 24                	push   $0x24
+  800e66:	68 c8 34 80 00       	push   $0x8034c8
+  800e6b:	e8 16 1e 00 00       	call   802c86 <_panic>
+
+00800e70 <sys_env_set_cow>:
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+  800e76:	83 ec 0c             	sub    $0xc,%esp
+  800e79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e84:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e89:	89 df                	mov    %ebx,%edi
+  800e8b:	89 de                	mov    %ebx,%esi
+  800e8d:	cd 30                	int    $0x30
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	7f 08                	jg     800e9b <sys_env_set_cow+0x2b>
+  800e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+  800e9b:	83 ec 0c             	sub    $0xc,%esp
+  800e9e:	50                   	push   %eax
+  800e9f:	6a 20                	push   $0x20
+  800ea1:	68 ab 34 80 00       	push   $0x8034ab
+  800ea6:	6a 24                	push   $0x24
+  800ea8:	68 c8 34 80 00       	push   $0x8034c8
+  800ead:	e8 d4 1d 00 00       	call   802c86 <_panic>
+
+00800eb2 <sys_env_service>:
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+  800eb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ebd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec0:	b8 21 00 00 00       	mov    $0x21,%eax
+  800ec5:	89 cb                	mov    %ecx,%ebx
+  800ec7:	89 cf                	mov    %ecx,%edi
+  800ec9:	89 ce                	mov    %ecx,%esi
+  800ecb:	cd 30                	int    $0x30
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+
+00800ed2 <sys_env_set_pgfault_upcall>:
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	57                   	push   %edi
+  800ed6:	56                   	push   %esi
+  800ed7:	53                   	push   %ebx
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eeb:	89 df                	mov    %ebx,%edi
+  800eed:	89 de                	mov    %ebx,%esi
+  800eef:	cd 30                	int    $0x30
+  800ef1:	85 c0                	test   %eax,%eax
+  800ef3:	7f 08                	jg     800efd <sys_env_set_pgfault_upcall+0x2b>
+  800ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	50                   	push   %eax
+  800f01:	6a 0a                	push   $0xa
+  800f03:	68 ab 34 80 00       	push   $0x8034ab
+  800f08:	6a 24                	push   $0x24
+  800f0a:	68 c8 34 80 00       	push   $0x8034c8
+  800f0f:	e8 72 1d 00 00       	call   802c86 <_panic>
+
+00800f14 <sys_ipc_try_send>:
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	56                   	push   %esi
+  800f19:	53                   	push   %ebx
+  800f1a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f21:	74 27                	je     800f4a <sys_ipc_try_send+0x36>
+  800f23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f29:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f34:	6a 00                	push   $0x0
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	8d 35 41 0f 80 00    	lea    0x800f41,%esi
+  800f3f:	0f 34                	sysenter
+  800f41:	5d                   	pop    %ebp
+  800f42:	83 c4 04             	add    $0x4,%esp
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+  800f4a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f60:	cd 30                	int    $0x30
+  800f62:	eb e1                	jmp    800f45 <sys_ipc_try_send+0x31>
+
+00800f64 <sys_ipc_recv>:
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+  800f6a:	83 ec 0c             	sub    $0xc,%esp
+  800f6d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f74:	74 32                	je     800fa8 <sys_ipc_recv+0x44>
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f83:	89 cb                	mov    %ecx,%ebx
+  800f85:	89 cf                	mov    %ecx,%edi
+  800f87:	6a 00                	push   $0x0
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	8d 35 94 0f 80 00    	lea    0x800f94,%esi
+  800f92:	0f 34                	sysenter
+  800f94:	5d                   	pop    %ebp
+  800f95:	83 c4 04             	add    $0x4,%esp
+  800f98:	89 c2                	mov    %eax,%edx
+  800f9a:	85 c0                	test   %eax,%eax
+  800f9c:	7f 3c                	jg     800fda <sys_ipc_recv+0x76>
+  800f9e:	89 d0                	mov    %edx,%eax
+  800fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+  800fa8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fad:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	89 cb                	mov    %ecx,%ebx
+  800fb7:	89 cf                	mov    %ecx,%edi
+  800fb9:	89 ce                	mov    %ecx,%esi
+  800fbb:	cd 30                	int    $0x30
+  800fbd:	89 c2                	mov    %eax,%edx
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	7e db                	jle    800f9e <sys_ipc_recv+0x3a>
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+  800fc6:	50                   	push   %eax
+  800fc7:	6a 0d                	push   $0xd
+  800fc9:	68 ab 34 80 00       	push   $0x8034ab
+  800fce:	6a 24                	push   $0x24
+  800fd0:	68 c8 34 80 00       	push   $0x8034c8
+  800fd5:	e8 ac 1c 00 00       	call   802c86 <_panic>
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	50                   	push   %eax
+  800fde:	6a 0d                	push   $0xd
+  800fe0:	68 ab 34 80 00       	push   $0x8034ab
+  800fe5:	6a 48                	push   $0x48
+  800fe7:	68 c8 34 80 00       	push   $0x8034c8
+  800fec:	e8 95 1c 00 00       	call   802c86 <_panic>
+
+00800ff1 <sys_ipc_send>:
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+  800ff7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ffe:	74 27                	je     801027 <sys_ipc_send+0x36>
+  801000:	8b 55 08             	mov    0x8(%ebp),%edx
+  801003:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801006:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80100b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801011:	6a 00                	push   $0x0
+  801013:	55                   	push   %ebp
+  801014:	89 e5                	mov    %esp,%ebp
+  801016:	8d 35 1e 10 80 00    	lea    0x80101e,%esi
+  80101c:	0f 34                	sysenter
+  80101e:	5d                   	pop    %ebp
+  80101f:	83 c4 04             	add    $0x4,%esp
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+  801027:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80102c:	be 00 00 00 00       	mov    $0x0,%esi
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+  801034:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801037:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103d:	cd 30                	int    $0x30
+  80103f:	eb e1                	jmp    801022 <sys_ipc_send+0x31>
+
+00801041 <sys_ipc_call>:
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	57                   	push   %edi
+  801045:	56                   	push   %esi
+  801046:	53                   	push   %ebx
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801052:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801055:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801058:	8b 75 18             	mov    0x18(%ebp),%esi
+  80105b:	cd 30                	int    $0x30
+  80105d:	5b                   	pop    %ebx
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+
+00801062 <sys_ipc_reply_recv>:
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801073:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801076:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801079:	8b 75 18             	mov    0x18(%ebp),%esi
+  80107c:	cd 30                	int    $0x30
+  80107e:	5b                   	pop    %ebx
+  80107f:	5e                   	pop    %esi
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+
+00801083 <sys_time_msec>:
+  801083:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	75 06                	jne    801092 <sys_time_msec+0xf>
+  80108c:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801091:	c3                   	ret
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	57                   	push   %edi
+  801096:	56                   	push   %esi
+  801097:	53                   	push   %ebx
+  801098:	83 ec 0c             	sub    $0xc,%esp
+  80109b:	0f 31                	rdtsc
+  80109d:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8010a3:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8010a9:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8010af:	29 c8                	sub    %ecx,%eax
+  8010b1:	19 da                	sbb    %ebx,%edx
+  8010b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	52                   	push   %edx
+  8010bb:	50                   	push   %eax
+  8010bc:	e8 91 1f 00 00       	call   803052 <__udivdi3>
+  8010c1:	83 c4 10             	add    $0x10,%esp
+  8010c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+
+008010cc <sys_env_swap>:
+  8010cc:	55                   	push   %ebp
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	57                   	push   %edi
+  8010d0:	56                   	push   %esi
+  8010d1:	53                   	push   %ebx
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+  8010d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dd:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010e2:	89 cb                	mov    %ecx,%ebx
+  8010e4:	89 cf                	mov    %ecx,%edi
+  8010e6:	89 ce                	mov    %ecx,%esi
+  8010e8:	cd 30                	int    $0x30
+  8010ea:	85 c0                	test   %eax,%eax
+  8010ec:	7f 08                	jg     8010f6 <sys_env_swap+0x2a>
+  8010ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f1:	5b                   	pop    %ebx
+  8010f2:	5e                   	pop    %esi
+  8010f3:	5f                   	pop    %edi
+  8010f4:	5d                   	pop    %ebp
+  8010f5:	c3                   	ret
+  8010f6:	83 ec 0c             	sub    $0xc,%esp
+  8010f9:	50                   	push   %eax
+  8010fa:	6a 12                	push   $0x12
+  8010fc:	68 ab 34 80 00       	push   $0x8034ab
+  801101:	6a 24                	push   $0x24
+  801103:	68 c8 34 80 00       	push   $0x8034c8
+  801108:	e8 79 1b 00 00       	call   802c86 <_panic>
+
+0080110d <sys_net_try_send>:
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	57                   	push   %edi
+  801111:	56                   	push   %esi
+  801112:	53                   	push   %ebx
+  801113:	83 ec 0c             	sub    $0xc,%esp
+  801116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801121:	b8 13 00 00 00       	mov    $0x13,%eax
+  801126:	89 df                	mov    %ebx,%edi
+  801128:	89 de                	mov    %ebx,%esi
+  80112a:	cd 30                	int    $0x30
+  80112c:	85 c0                	test   %eax,%eax
+  80112e:	7f 08                	jg     801138 <sys_net_try_send+0x2b>
+  801130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+  801138:	83 ec 0c             	sub    $0xc,%esp
+  80113b:	50                   	push   %eax
+  80113c:	6a 13                	push   $0x13
+  80113e:	68 ab 34 80 00       	push   $0x8034ab
+  801143:	6a 24                	push   $0x24
+  801145:	68 c8 34 80 00       	push   $0x8034c8
+  80114a:	e8 37 1b 00 00       	call   802c86 <_panic>
+
+0080114f <sys_net_try_receive>:
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	57                   	push   %edi
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+  801155:	83 ec 0c             	sub    $0xc,%esp
+  801158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	b8 14 00 00 00       	mov    $0x14,%eax
+  801168:	89 df                	mov    %ebx,%edi
+  80116a:	89 de                	mov    %ebx,%esi
+  80116c:	cd 30                	int    $0x30
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 08                	jg     80117a <sys_net_try_receive+0x2b>
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	50                   	push   %eax
+  80117e:	6a 14                	push   $0x14
+  801180:	68 ab 34 80 00       	push   $0x8034ab
+  801185:	6a 24                	push   $0x24
+  801187:	68 c8 34 80 00       	push   $0x8034c8
+  80118c:	e8 f5 1a 00 00       	call   802c86 <_panic>
+
+00801191 <sys_net_recv_page>:
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+  801197:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119f:	b8 27 00 00 00       	mov    $0x27,%eax
+  8011a4:	89 cb                	mov    %ecx,%ebx
+  8011a6:	89 cf                	mov    %ecx,%edi
+  8011a8:	89 ce                	mov    %ecx,%esi
+  8011aa:	cd 30                	int    $0x30
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5e                   	pop    %esi
+  8011ae:	5f                   	pop    %edi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+
+008011b1 <sys_net_wait>:
+  8011b1:	55                   	push   %ebp
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	57                   	push   %edi
+  8011b5:	56                   	push   %esi
+  8011b6:	53                   	push   %ebx
+  8011b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bc:	b8 26 00 00 00       	mov    $0x26,%eax
+  8011c1:	89 d1                	mov    %edx,%ecx
+  8011c3:	89 d3                	mov    %edx,%ebx
+  8011c5:	89 d7                	mov    %edx,%edi
+  8011c7:	89 d6                	mov    %edx,%esi
+  8011c9:	cd 30                	int    $0x30
+  8011cb:	5b                   	pop    %ebx
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5f                   	pop    %edi
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	c3                   	ret
+
+008011d0 <sys_get_mac>:
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+  8011d6:	83 ec 0c             	sub    $0xc,%esp
+  8011d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011e9:	89 df                	mov    %ebx,%edi
+  8011eb:	89 de                	mov    %ebx,%esi
+  8011ed:	cd 30                	int    $0x30
+  8011ef:	85 c0                	test   %eax,%eax
+  8011f1:	7f 08                	jg     8011fb <sys_get_mac+0x2b>
+  8011f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+  8011fb:	83 ec 0c             	sub    $0xc,%esp
+  8011fe:	50                   	push   %eax
+  8011ff:	6a 15                	push   $0x15
+  801201:	68 ab 34 80 00       	push   $0x8034ab
+  801206:	6a 24                	push   $0x24
+  801208:	68 c8 34 80 00       	push   $0x8034c8
+  80120d:	e8 74 1a 00 00       	call   802c86 <_panic>
+
+00801212 <sys_env_lease>:
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	57                   	push   %edi
+  801216:	56                   	push   %esi
+  801217:	53                   	push   %ebx
+  801218:	83 ec 0c             	sub    $0xc,%esp
+  80121b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801220:	8b 55 08             	mov    0x8(%ebp),%edx
+  801223:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801226:	b8 16 00 00 00       	mov    $0x16,%eax
+  80122b:	89 df                	mov    %ebx,%edi
+  80122d:	89 de                	mov    %ebx,%esi
+  80122f:	cd 30                	int    $0x30
+  801231:	85 c0                	test   %eax,%eax
+  801233:	7f 08                	jg     80123d <sys_env_lease+0x2b>
+  801235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801238:	5b                   	pop    %ebx
+  801239:	5e                   	pop    %esi
+  80123a:	5f                   	pop    %edi
+  80123b:	5d                   	pop    %ebp
+  80123c:	c3                   	ret
+  80123d:	83 ec 0c             	sub    $0xc,%esp
+  801240:	50                   	push   %eax
+  801241:	6a 16                	push   $0x16
+  801243:	68 ab 34 80 00       	push   $0x8034ab
+  801248:	6a 24                	push   $0x24
+  80124a:	68 c8 34 80 00       	push   $0x8034c8
+  80124f:	e8 32 1a 00 00       	call   802c86 <_panic>
+
+00801254 <sys_copy_mem>:
+  801254:	55                   	push   %ebp
+  801255:	89 e5                	mov    %esp,%ebp
+  801257:	57                   	push   %edi
+  801258:	56                   	push   %esi
+  801259:	53                   	push   %ebx
+  80125a:	83 ec 0c             	sub    $0xc,%esp
+  80125d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801260:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801263:	b8 17 00 00 00       	mov    $0x17,%eax
+  801268:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80126e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801271:	cd 30                	int    $0x30
+  801273:	85 c0                	test   %eax,%eax
+  801275:	7f 08                	jg     80127f <sys_copy_mem+0x2b>
+  801277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127a:	5b                   	pop    %ebx
+  80127b:	5e                   	pop    %esi
+  80127c:	5f                   	pop    %edi
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+  80127f:	83 ec 0c             	sub    $0xc,%esp
+  801282:	50                   	push   %eax
+  801283:	6a 17                	push   $0x17
+  801285:	68 ab 34 80 00       	push   $0x8034ab
+  80128a:	6a 24                	push   $0x24
+  80128c:	68 c8 34 80 00       	push   $0x8034c8
+  801291:	e8 f0 19 00 00       	call   802c86 <_panic>
+
+00801296 <sys_get_perms>:
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	57                   	push   %edi
+  80129a:	56                   	push   %esi
+  80129b:	53                   	push   %ebx
+  80129c:	83 ec 0c             	sub    $0xc,%esp
+  80129f:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012aa:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b2:	89 f7                	mov    %esi,%edi
+  8012b4:	cd 30                	int    $0x30
+  8012b6:	85 c0                	test   %eax,%eax
+  8012b8:	7f 08                	jg     8012c2 <sys_get_perms+0x2c>
+  8012ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bd:	5b                   	pop    %ebx
+  8012be:	5e                   	pop    %esi
+  8012bf:	5f                   	pop    %edi
+  8012c0:	5d                   	pop    %ebp
+  8012c1:	c3                   	ret
+  8012c2:	83 ec 0c             	sub    $0xc,%esp
+  8012c5:	50                   	push   %eax
+  8012c6:	6a 18                	push   $0x18
+  8012c8:	68 ab 34 80 00       	push   $0x8034ab
+  8012cd:	6a 24                	push   $0x24
+  8012cf:	68 c8 34 80 00       	push   $0x8034c8
+  8012d4:	e8 ad 19 00 00       	call   802c86 <_panic>
+
+008012d9 <sys_env_unsuspend>:
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	57                   	push   %edi
+  8012dd:	56                   	push   %esi
+  8012de:	53                   	push   %ebx
+  8012df:	83 ec 0c             	sub    $0xc,%esp
+  8012e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ed:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f5:	89 f7                	mov    %esi,%edi
+  8012f7:	cd 30                	int    $0x30
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	7f 08                	jg     801305 <sys_env_unsuspend+0x2c>
+  8012fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801300:	5b                   	pop    %ebx
+  801301:	5e                   	pop    %esi
+  801302:	5f                   	pop    %edi
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+  801305:	83 ec 0c             	sub    $0xc,%esp
+  801308:	50                   	push   %eax
+  801309:	6a 19                	push   $0x19
+  80130b:	68 ab 34 80 00       	push   $0x8034ab
+  801310:	6a 24                	push   $0x24
+  801312:	68 c8 34 80 00       	push   $0x8034c8
+  801317:	e8 6a 19 00 00       	call   802c86 <_panic>
+
+0080131c <sys_migrate>:
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	57                   	push   %edi
+  801320:	56                   	push   %esi
+  801321:	53                   	push   %ebx
+  801322:	83 ec 0c             	sub    $0xc,%esp
+  801325:	ba 00 80 80 00       	mov    $0x808000,%edx
+  80132a:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801330:	76 11                	jbe    801343 <sys_migrate+0x27>
+  801332:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801337:	0f b6 08             	movzbl (%eax),%ecx
+  80133a:	05 00 10 00 00       	add    $0x1000,%eax
+  80133f:	39 d0                	cmp    %edx,%eax
+  801341:	72 f4                	jb     801337 <sys_migrate+0x1b>
+  801343:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801350:	89 cb                	mov    %ecx,%ebx
+  801352:	89 cf                	mov    %ecx,%edi
+  801354:	89 ce                	mov    %ecx,%esi
+  801356:	cd 30                	int    $0x30
+  801358:	85 c0                	test   %eax,%eax
+  80135a:	7f 08                	jg     801364 <sys_migrate+0x48>
+  80135c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135f:	5b                   	pop    %ebx
+  801360:	5e                   	pop    %esi
+  801361:	5f                   	pop    %edi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+  801364:	83 ec 0c             	sub    $0xc,%esp
+  801367:	50                   	push   %eax
+  801368:	6a 1a                	push   $0x1a
+  80136a:	68 ab 34 80 00       	push   $0x8034ab
+  80136f:	6a 24                	push   $0x24
+  801371:	68 c8 34 80 00       	push   $0x8034c8
+  801376:	e8 0b 19 00 00       	call   802c86 <_panic>
+
+0080137b <sys_lease_complete>:
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	57                   	push   %edi
+  80137f:	56                   	push   %esi
+  801380:	53                   	push   %ebx
+  801381:	83 ec 0c             	sub    $0xc,%esp
+  801384:	ba 00 00 00 00       	mov    $0x0,%edx
+  801389:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80138e:	89 d1                	mov    %edx,%ecx
+  801390:	89 d3                	mov    %edx,%ebx
+  801392:	89 d7                	mov    %edx,%edi
+  801394:	89 d6                	mov    %edx,%esi
+  801396:	cd 30                	int    $0x30
+  801398:	85 c0                	test   %eax,%eax
+  80139a:	7f 08                	jg     8013a4 <sys_lease_complete+0x29>
+  80139c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139f:	5b                   	pop    %ebx
+  8013a0:	5e                   	pop    %esi
+  8013a1:	5f                   	pop    %edi
+  8013a2:	5d                   	pop    %ebp
+  8013a3:	c3                   	ret
+  8013a4:	83 ec 0c             	sub    $0xc,%esp
+  8013a7:	50                   	push   %eax
+  8013a8:	6a 1b                	push   $0x1b
+  8013aa:	68 ab 34 80 00       	push   $0x8034ab
+  8013af:	6a 24                	push   $0x24
+  8013b1:	68 c8 34 80 00       	push   $0x8034c8
+  8013b6:	e8 cb 18 00 00       	call   802c86 <_panic>
+
+008013bb <sys_env_set_thisenv>:
+  8013bb:	55                   	push   %ebp
+  8013bc:	89 e5                	mov    %esp,%ebp
+  8013be:	57                   	push   %edi
+  8013bf:	56                   	push   %esi
+  8013c0:	53                   	push   %ebx
+  8013c1:	83 ec 0c             	sub    $0xc,%esp
+  8013c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cf:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013d4:	89 df                	mov    %ebx,%edi
+  8013d6:	89 de                	mov    %ebx,%esi
+  8013d8:	cd 30                	int    $0x30
+  8013da:	85 c0                	test   %eax,%eax
+  8013dc:	7f 08                	jg     8013e6 <sys_env_set_thisenv+0x2b>
+  8013de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e1:	5b                   	pop    %ebx
+  8013e2:	5e                   	pop    %esi
+  8013e3:	5f                   	pop    %edi
+  8013e4:	5d                   	pop    %ebp
+  8013e5:	c3                   	ret
+  8013e6:	83 ec 0c             	sub    $0xc,%esp
+  8013e9:	50                   	push   %eax
+  8013ea:	6a 1c                	push   $0x1c
+  8013ec:	68 ab 34 80 00       	push   $0x8034ab
+  8013f1:	6a 24                	push   $0x24
+  8013f3:	68 c8 34 80 00       	push   $0x8034c8
+  8013f8:	e8 89 18 00 00       	call   802c86 <_panic>
+
+008013fd <sys_env_set_sched>:
+  8013fd:	55                   	push   %ebp
+  8013fe:	89 e5                	mov    %esp,%ebp
+  801400:	57                   	push   %edi
+  801401:	56                   	push   %esi
+  801402:	53                   	push   %ebx
+  801403:	83 ec 0c             	sub    $0xc,%esp
+  801406:	be 00 00 00 00       	mov    $0x0,%esi
+  80140b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801411:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801416:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801419:	89 f7                	mov    %esi,%edi
+  80141b:	cd 30                	int    $0x30
+  80141d:	85 c0                	test   %eax,%eax
+  80141f:	7f 08                	jg     801429 <sys_env_set_sched+0x2c>
+  801421:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801424:	5b                   	pop    %ebx
+  801425:	5e                   	pop    %esi
+  801426:	5f                   	pop    %edi
+  801427:	5d                   	pop    %ebp
+  801428:	c3                   	ret
+  801429:	83 ec 0c             	sub    $0xc,%esp
+  80142c:	50                   	push   %eax
+  80142d:	6a 1d                	push   $0x1d
+  80142f:	68 ab 34 80 00       	push   $0x8034ab
+  801434:	6a 24                	push   $0x24
+  801436:	68 c8 34 80 00       	push   $0x8034c8
+  80143b:	e8 46 18 00 00       	call   802c86 <_panic>
+
+00801440 <sys_batch>:
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	57                   	push   %edi
+  801444:	56                   	push   %esi
+  801445:	53                   	push   %ebx
+  801446:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801451:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801456:	89 df                	mov    %ebx,%edi
+  801458:	89 de                	mov    %ebx,%esi
+  80145a:	cd 30                	int    $0x30
+  80145c:	5b                   	pop    %ebx
+  80145d:	5e                   	pop    %esi
+  80145e:	5f                   	pop    %edi
+  80145f:	5d                   	pop    %ebp
+  801460:	c3                   	ret
+
+00801461 <sys_env_stats>:
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	57                   	push   %edi
+  801465:	56                   	push   %esi
+  801466:	53                   	push   %ebx
+  801467:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801472:	b8 23 00 00 00       	mov    $0x23,%eax
+  801477:	89 df                	mov    %ebx,%edi
+  801479:	89 de                	mov    %ebx,%esi
+  80147b:	cd 30                	int    $0x30
+  80147d:	5b                   	pop    %ebx
+  80147e:	5e                   	pop    %esi
+  80147f:	5f                   	pop    %edi
+  801480:	5d                   	pop    %ebp
+  801481:	c3                   	ret
+
+00801482 <sys_trace>:
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	57                   	push   %edi
+  801486:	56                   	push   %esi
+  801487:	53                   	push   %ebx
+  801488:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801490:	b8 24 00 00 00       	mov    $0x24,%eax
+  801495:	89 cb                	mov    %ecx,%ebx
+  801497:	89 cf                	mov    %ecx,%edi
+  801499:	89 ce                	mov    %ecx,%esi
+  80149b:	cd 30                	int    $0x30
+  80149d:	5b                   	pop    %ebx
+  80149e:	5e                   	pop    %esi
+  80149f:	5f                   	pop    %edi
+  8014a0:	5d                   	pop    %ebp
+  8014a1:	c3                   	ret
+
+008014a2 <sys_env_set_pager>:
+  8014a2:	55                   	push   %ebp
+  8014a3:	89 e5                	mov    %esp,%ebp
+  8014a5:	57                   	push   %edi
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	83 ec 0c             	sub    $0xc,%esp
+  8014ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b6:	b8 25 00 00 00       	mov    $0x25,%eax
+  8014bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014be:	89 f7                	mov    %esi,%edi
+  8014c0:	cd 30                	int    $0x30
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	7f 08                	jg     8014ce <sys_env_set_pager+0x2c>
+  8014c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c9:	5b                   	pop    %ebx
+  8014ca:	5e                   	pop    %esi
+  8014cb:	5f                   	pop    %edi
+  8014cc:	5d                   	pop    %ebp
+  8014cd:	c3                   	ret
+  8014ce:	83 ec 0c             	sub    $0xc,%esp
+  8014d1:	50                   	push   %eax
+  8014d2:	6a 25                	push   $0x25
+  8014d4:	68 ab 34 80 00       	push   $0x8034ab
+  8014d9:	6a 24                	push   $0x24
+  8014db:	68 c8 34 80 00       	push   $0x8034c8
+  8014e0:	e8 a1 17 00 00       	call   802c86 <_panic>
+
+008014e5 <sys_pager_retire>:
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	57                   	push   %edi
+  8014e9:	56                   	push   %esi
+  8014ea:	53                   	push   %ebx
+  8014eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8014f8:	89 cb                	mov    %ecx,%ebx
+  8014fa:	89 cf                	mov    %ecx,%edi
+  8014fc:	89 ce                	mov    %ecx,%esi
+  8014fe:	cd 30                	int    $0x30
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5f                   	pop    %edi
+  801503:	5d                   	pop    %ebp
+  801504:	c3                   	ret
+
+00801505 <sys_prof>:
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	57                   	push   %edi
+  801509:	56                   	push   %esi
+  80150a:	53                   	push   %ebx
+  80150b:	be 00 00 00 00       	mov    $0x0,%esi
+  801510:	8b 55 08             	mov    0x8(%ebp),%edx
+  801513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801516:	b8 22 00 00 00       	mov    $0x22,%eax
+  80151b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151e:	89 f7                	mov    %esi,%edi
+  801520:	cd 30                	int    $0x30
+  801522:	5b                   	pop    %ebx
+  801523:	5e                   	pop    %esi
+  801524:	5f                   	pop    %edi
+  801525:	5d                   	pop    %ebp
+  801526:	c3                   	ret
+
+00801527 <fd2num>:
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80152d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801532:	c1 e8 0c             	shr    $0xc,%eax
+  801535:	5d                   	pop    %ebp
+  801536:	c3                   	ret
+
+00801537 <fd2data>:
+  801537:	55                   	push   %ebp
+  801538:	89 e5                	mov    %esp,%ebp
+  80153a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80153d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801542:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801547:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  80154c:	5d                   	pop    %ebp
+  80154d:	c3                   	ret
+
+0080154e <fd_alloc>:
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801556:	89 c2                	mov    %eax,%edx
+  801558:	c1 ea 16             	shr    $0x16,%edx
+  80155b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801562:	f6 c2 01             	test   $0x1,%dl
+  801565:	74 29                	je     801590 <fd_alloc+0x42>
+  801567:	89 c2                	mov    %eax,%edx
+  801569:	c1 ea 0c             	shr    $0xc,%edx
+  80156c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801573:	f6 c2 01             	test   $0x1,%dl
+  801576:	74 18                	je     801590 <fd_alloc+0x42>
+  801578:	05 00 10 00 00       	add    $0x1000,%eax
+  80157d:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801582:	75 d2                	jne    801556 <fd_alloc+0x8>
+  801584:	b8 00 00 00 00       	mov    $0x0,%eax
+  801589:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80158e:	eb 05                	jmp    801595 <fd_alloc+0x47>
+  801590:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801595:	8b 55 08             	mov    0x8(%ebp),%edx
+  801598:	89 02                	mov    %eax,(%edx)
+  80159a:	89 c8                	mov    %ecx,%eax
+  80159c:	5d                   	pop    %ebp
+  80159d:	c3                   	ret
+
+0080159e <fd_lookup>:
+  80159e:	55                   	push   %ebp
+  80159f:	89 e5                	mov    %esp,%ebp
+  8015a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a4:	83 f8 1f             	cmp    $0x1f,%eax
+  8015a7:	77 30                	ja     8015d9 <fd_lookup+0x3b>
+  8015a9:	c1 e0 0c             	shl    $0xc,%eax
+  8015ac:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8015b1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015b7:	f6 c2 01             	test   $0x1,%dl
+  8015ba:	74 24                	je     8015e0 <fd_lookup+0x42>
+  8015bc:	89 c2                	mov    %eax,%edx
+  8015be:	c1 ea 0c             	shr    $0xc,%edx
+  8015c1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015c8:	f6 c2 01             	test   $0x1,%dl
+  8015cb:	74 1a                	je     8015e7 <fd_lookup+0x49>
+  8015cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d0:	89 02                	mov    %eax,(%edx)
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+  8015d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015de:	eb f7                	jmp    8015d7 <fd_lookup+0x39>
+  8015e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e5:	eb f0                	jmp    8015d7 <fd_lookup+0x39>
+  8015e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ec:	eb e9                	jmp    8015d7 <fd_lookup+0x39>
+
+008015ee <dev_lookup>:
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	53                   	push   %ebx
+  8015f2:	83 ec 04             	sub    $0x4,%esp
+  8015f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fd:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801602:	39 13                	cmp    %edx,(%ebx)
+  801604:	74 37                	je     80163d <dev_lookup+0x4f>
+  801606:	83 c0 01             	add    $0x1,%eax
+  801609:	8b 1c 85 54 35 80 00 	mov    0x803554(,%eax,4),%ebx
+  801610:	85 db                	test   %ebx,%ebx
+  801612:	75 ee                	jne    801602 <dev_lookup+0x14>
+  801614:	a1 14 50 80 00       	mov    0x805014,%eax
+  801619:	8b 40 48             	mov    0x48(%eax),%eax
+  80161c:	83 ec 04             	sub    $0x4,%esp
+  80161f:	52                   	push   %edx
+  801620:	50                   	push   %eax
+  801621:	68 d8 34 80 00       	push   $0x8034d8
+  801626:	e8 37 eb ff ff       	call   800162 <cprintf>
+  80162b:	83 c4 10             	add    $0x10,%esp
+  80162e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801633:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801636:	89 1a                	mov    %ebx,(%edx)
+  801638:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80163b:	c9                   	leave
+  80163c:	c3                   	ret
+  80163d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801642:	eb ef                	jmp    801633 <dev_lookup+0x45>
+
+00801644 <fd_close>:
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	57                   	push   %edi
+  801648:	56                   	push   %esi
+  801649:	53                   	push   %ebx
+  80164a:	83 ec 24             	sub    $0x24,%esp
+  80164d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801650:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801653:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801656:	50                   	push   %eax
+  801657:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80165d:	c1 e8 0c             	shr    $0xc,%eax
+  801660:	50                   	push   %eax
+  801661:	e8 38 ff ff ff       	call   80159e <fd_lookup>
+  801666:	89 c3                	mov    %eax,%ebx
+  801668:	83 c4 10             	add    $0x10,%esp
+  80166b:	85 c0                	test   %eax,%eax
+  80166d:	78 05                	js     801674 <fd_close+0x30>
+  80166f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801672:	74 0f                	je     801683 <fd_close+0x3f>
+  801674:	85 ff                	test   %edi,%edi
+  801676:	0f 44 df             	cmove  %edi,%ebx
+  801679:	89 d8                	mov    %ebx,%eax
+  80167b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167e:	5b                   	pop    %ebx
+  80167f:	5e                   	pop    %esi
+  801680:	5f                   	pop    %edi
+  801681:	5d                   	pop    %ebp
+  801682:	c3                   	ret
+  801683:	83 ec 08             	sub    $0x8,%esp
+  801686:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801689:	50                   	push   %eax
+  80168a:	ff 36                	push   (%esi)
+  80168c:	e8 5d ff ff ff       	call   8015ee <dev_lookup>
+  801691:	89 c3                	mov    %eax,%ebx
+  801693:	83 c4 10             	add    $0x10,%esp
+  801696:	85 c0                	test   %eax,%eax
+  801698:	78 1a                	js     8016b4 <fd_close+0x70>
+  80169a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80169d:	8b 40 10             	mov    0x10(%eax),%eax
+  8016a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a5:	85 c0                	test   %eax,%eax
+  8016a7:	74 0b                	je     8016b4 <fd_close+0x70>
+  8016a9:	83 ec 0c             	sub    $0xc,%esp
+  8016ac:	56                   	push   %esi
+  8016ad:	ff d0                	call   *%eax
+  8016af:	89 c3                	mov    %eax,%ebx
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	83 ec 08             	sub    $0x8,%esp
+  8016b7:	56                   	push   %esi
+  8016b8:	6a 00                	push   $0x0
+  8016ba:	e8 cc f6 ff ff       	call   800d8b <sys_page_unmap>
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	eb b5                	jmp    801679 <fd_close+0x35>
+
+008016c4 <close>:
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	83 ec 20             	sub    $0x20,%esp
+  8016ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cd:	50                   	push   %eax
+  8016ce:	ff 75 08             	push   0x8(%ebp)
+  8016d1:	e8 c8 fe ff ff       	call   80159e <fd_lookup>
+  8016d6:	83 c4 10             	add    $0x10,%esp
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	79 02                	jns    8016df <close+0x1b>
+  8016dd:	c9                   	leave
+  8016de:	c3                   	ret
+  8016df:	83 ec 08             	sub    $0x8,%esp
+  8016e2:	6a 01                	push   $0x1
+  8016e4:	ff 75 f4             	push   -0xc(%ebp)
+  8016e7:	e8 58 ff ff ff       	call   801644 <fd_close>
+  8016ec:	83 c4 10             	add    $0x10,%esp
+  8016ef:	eb ec                	jmp    8016dd <close+0x19>
+
+008016f1 <close_all>:
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	53                   	push   %ebx
+  8016f5:	83 ec 04             	sub    $0x4,%esp
+  8016f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fd:	83 ec 0c             	sub    $0xc,%esp
+  801700:	53                   	push   %ebx
+  801701:	e8 be ff ff ff       	call   8016c4 <close>
+  801706:	83 c3 01             	add    $0x1,%ebx
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	83 fb 20             	cmp    $0x20,%ebx
+  80170f:	75 ec                	jne    8016fd <close_all+0xc>
+  801711:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801714:	c9                   	leave
+  801715:	c3                   	ret
+
+00801716 <dup>:
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	57                   	push   %edi
+  80171a:	56                   	push   %esi
+  80171b:	53                   	push   %ebx
+  80171c:	83 ec 34             	sub    $0x34,%esp
+  80171f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801722:	50                   	push   %eax
+  801723:	ff 75 08             	push   0x8(%ebp)
+  801726:	e8 73 fe ff ff       	call   80159e <fd_lookup>
+  80172b:	89 c3                	mov    %eax,%ebx
+  80172d:	83 c4 10             	add    $0x10,%esp
+  801730:	85 c0                	test   %eax,%eax
+  801732:	78 7f                	js     8017b3 <dup+0x9d>
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	ff 75 0c             	push   0xc(%ebp)
+  80173a:	e8 85 ff ff ff       	call   8016c4 <close>
+  80173f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801742:	c1 e6 0c             	shl    $0xc,%esi
+  801745:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80174b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80174e:	89 3c 24             	mov    %edi,(%esp)
+  801751:	e8 e1 fd ff ff       	call   801537 <fd2data>
+  801756:	89 c3                	mov    %eax,%ebx
+  801758:	89 34 24             	mov    %esi,(%esp)
+  80175b:	e8 d7 fd ff ff       	call   801537 <fd2data>
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801766:	89 d8                	mov    %ebx,%eax
+  801768:	c1 e8 16             	shr    $0x16,%eax
+  80176b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801772:	a8 01                	test   $0x1,%al
+  801774:	74 11                	je     801787 <dup+0x71>
+  801776:	89 d8                	mov    %ebx,%eax
+  801778:	c1 e8 0c             	shr    $0xc,%eax
+  80177b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801782:	f6 c2 01             	test   $0x1,%dl
+  801785:	75 36                	jne    8017bd <dup+0xa7>
+  801787:	89 f8                	mov    %edi,%eax
+  801789:	c1 e8 0c             	shr    $0xc,%eax
+  80178c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801793:	83 ec 0c             	sub    $0xc,%esp
+  801796:	25 07 0e 00 00       	and    $0xe07,%eax
+  80179b:	50                   	push   %eax
+  80179c:	56                   	push   %esi
+  80179d:	6a 00                	push   $0x0
+  80179f:	57                   	push   %edi
+  8017a0:	6a 00                	push   $0x0
+  8017a2:	e8 55 f5 ff ff       	call   800cfc <sys_page_map>
+  8017a7:	89 c3                	mov    %eax,%ebx
+  8017a9:	83 c4 20             	add    $0x20,%esp
+  8017ac:	85 c0                	test   %eax,%eax
+  8017ae:	78 33                	js     8017e3 <dup+0xcd>
+  8017b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8017b3:	89 d8                	mov    %ebx,%eax
+  8017b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b8:	5b                   	pop    %ebx
+  8017b9:	5e                   	pop    %esi
+  8017ba:	5f                   	pop    %edi
+  8017bb:	5d                   	pop    %ebp
+  8017bc:	c3                   	ret
+  8017bd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017c4:	83 ec 0c             	sub    $0xc,%esp
+  8017c7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017cc:	50                   	push   %eax
+  8017cd:	ff 75 d4             	push   -0x2c(%ebp)
+  8017d0:	6a 00                	push   $0x0
+  8017d2:	53                   	push   %ebx
+  8017d3:	6a 00                	push   $0x0
+  8017d5:	e8 22 f5 ff ff       	call   800cfc <sys_page_map>
+  8017da:	89 c3                	mov    %eax,%ebx
+  8017dc:	83 c4 20             	add    $0x20,%esp
+  8017df:	85 c0                	test   %eax,%eax
+  8017e1:	79 a4                	jns    801787 <dup+0x71>
+  8017e3:	83 ec 08             	sub    $0x8,%esp
+  8017e6:	56                   	push   %esi
+  8017e7:	6a 00                	push   $0x0
+  8017e9:	e8 9d f5 ff ff       	call   800d8b <sys_page_unmap>
+  8017ee:	83 c4 08             	add    $0x8,%esp
+  8017f1:	ff 75 d4             	push   -0x2c(%ebp)
+  8017f4:	6a 00                	push   $0x0
+  8017f6:	e8 90 f5 ff ff       	call   800d8b <sys_page_unmap>
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	eb b3                	jmp    8017b3 <dup+0x9d>
+
+00801800 <read>:
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+  801805:	83 ec 18             	sub    $0x18,%esp
+  801808:	8b 75 08             	mov    0x8(%ebp),%esi
+  80180b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80180e:	50                   	push   %eax
+  80180f:	56                   	push   %esi
+  801810:	e8 89 fd ff ff       	call   80159e <fd_lookup>
+  801815:	83 c4 10             	add    $0x10,%esp
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	78 3c                	js     801858 <read+0x58>
+  80181c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80181f:	83 ec 08             	sub    $0x8,%esp
+  801822:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801825:	50                   	push   %eax
+  801826:	ff 33                	push   (%ebx)
+  801828:	e8 c1 fd ff ff       	call   8015ee <dev_lookup>
+  80182d:	83 c4 10             	add    $0x10,%esp
+  801830:	85 c0                	test   %eax,%eax
+  801832:	78 24                	js     801858 <read+0x58>
+  801834:	8b 43 08             	mov    0x8(%ebx),%eax
+  801837:	83 e0 03             	and    $0x3,%eax
+  80183a:	83 f8 01             	cmp    $0x1,%eax
+  80183d:	74 20                	je     80185f <read+0x5f>
+  80183f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801842:	8b 40 08             	mov    0x8(%eax),%eax
+  801845:	85 c0                	test   %eax,%eax
+  801847:	74 37                	je     801880 <read+0x80>
+  801849:	83 ec 04             	sub    $0x4,%esp
+  80184c:	ff 75 10             	push   0x10(%ebp)
+  80184f:	ff 75 0c             	push   0xc(%ebp)
+  801852:	53                   	push   %ebx
+  801853:	ff d0                	call   *%eax
+  801855:	83 c4 10             	add    $0x10,%esp
+  801858:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80185b:	5b                   	pop    %ebx
+  80185c:	5e                   	pop    %esi
+  80185d:	5d                   	pop    %ebp
+  80185e:	c3                   	ret
+  80185f:	a1 14 50 80 00       	mov    0x805014,%eax
+  801864:	8b 40 48             	mov    0x48(%eax),%eax
+  801867:	83 ec 04             	sub    $0x4,%esp
+  80186a:	56                   	push   %esi
+  80186b:	50                   	push   %eax
+  80186c:	68 19 35 80 00       	push   $0x803519
+  801871:	e8 ec e8 ff ff       	call   800162 <cprintf>
+  801876:	83 c4 10             	add    $0x10,%esp
+  801879:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80187e:	eb d8                	jmp    801858 <read+0x58>
+  801880:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801885:	eb d1                	jmp    801858 <read+0x58>
+
+00801887 <readn>:
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	57                   	push   %edi
+  80188b:	56                   	push   %esi
+  80188c:	53                   	push   %ebx
+  80188d:	83 ec 0c             	sub    $0xc,%esp
+  801890:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801893:	8b 75 10             	mov    0x10(%ebp),%esi
+  801896:	85 f6                	test   %esi,%esi
+  801898:	74 30                	je     8018ca <readn+0x43>
+  80189a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a4:	83 ec 04             	sub    $0x4,%esp
+  8018a7:	89 f2                	mov    %esi,%edx
+  8018a9:	29 c2                	sub    %eax,%edx
+  8018ab:	52                   	push   %edx
+  8018ac:	01 f8                	add    %edi,%eax
+  8018ae:	50                   	push   %eax
+  8018af:	ff 75 08             	push   0x8(%ebp)
+  8018b2:	e8 49 ff ff ff       	call   801800 <read>
+  8018b7:	83 c4 10             	add    $0x10,%esp
+  8018ba:	85 c0                	test   %eax,%eax
+  8018bc:	78 15                	js     8018d3 <readn+0x4c>
+  8018be:	74 11                	je     8018d1 <readn+0x4a>
+  8018c0:	01 c3                	add    %eax,%ebx
+  8018c2:	89 d8                	mov    %ebx,%eax
+  8018c4:	39 f3                	cmp    %esi,%ebx
+  8018c6:	72 dc                	jb     8018a4 <readn+0x1d>
+  8018c8:	eb 09                	jmp    8018d3 <readn+0x4c>
+  8018ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cf:	eb 02                	jmp    8018d3 <readn+0x4c>
+  8018d1:	89 d8                	mov    %ebx,%eax
+  8018d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d6:	5b                   	pop    %ebx
+  8018d7:	5e                   	pop    %esi
+  8018d8:	5f                   	pop    %edi
+  8018d9:	5d                   	pop    %ebp
+  8018da:	c3                   	ret
+
+008018db <write>:
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	56                   	push   %esi
+  8018df:	53                   	push   %ebx
+  8018e0:	83 ec 18             	sub    $0x18,%esp
+  8018e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e9:	50                   	push   %eax
+  8018ea:	53                   	push   %ebx
+  8018eb:	e8 ae fc ff ff       	call   80159e <fd_lookup>
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	78 37                	js     80192e <write+0x53>
+  8018f7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018fa:	83 ec 08             	sub    $0x8,%esp
+  8018fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801900:	50                   	push   %eax
+  801901:	ff 36                	push   (%esi)
+  801903:	e8 e6 fc ff ff       	call   8015ee <dev_lookup>
+  801908:	83 c4 10             	add    $0x10,%esp
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	78 1f                	js     80192e <write+0x53>
+  80190f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801913:	74 20                	je     801935 <write+0x5a>
+  801915:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801918:	8b 40 0c             	mov    0xc(%eax),%eax
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	74 37                	je     801956 <write+0x7b>
+  80191f:	83 ec 04             	sub    $0x4,%esp
+  801922:	ff 75 10             	push   0x10(%ebp)
+  801925:	ff 75 0c             	push   0xc(%ebp)
+  801928:	56                   	push   %esi
+  801929:	ff d0                	call   *%eax
+  80192b:	83 c4 10             	add    $0x10,%esp
+  80192e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801931:	5b                   	pop    %ebx
+  801932:	5e                   	pop    %esi
+  801933:	5d                   	pop    %ebp
+  801934:	c3                   	ret
+  801935:	a1 14 50 80 00       	mov    0x805014,%eax
+  80193a:	8b 40 48             	mov    0x48(%eax),%eax
+  80193d:	83 ec 04             	sub    $0x4,%esp
+  801940:	53                   	push   %ebx
+  801941:	50                   	push   %eax
+  801942:	68 35 35 80 00       	push   $0x803535
+  801947:	e8 16 e8 ff ff       	call   800162 <cprintf>
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801954:	eb d8                	jmp    80192e <write+0x53>
+  801956:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80195b:	eb d1                	jmp    80192e <write+0x53>
+
+0080195d <seek>:
+  80195d:	55                   	push   %ebp
+  80195e:	89 e5                	mov    %esp,%ebp
+  801960:	83 ec 20             	sub    $0x20,%esp
+  801963:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801966:	50                   	push   %eax
+  801967:	ff 75 08             	push   0x8(%ebp)
+  80196a:	e8 2f fc ff ff       	call   80159e <fd_lookup>
+  80196f:	83 c4 10             	add    $0x10,%esp
+  801972:	85 c0                	test   %eax,%eax
+  801974:	78 0e                	js     801984 <seek+0x27>
+  801976:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80197c:	89 50 04             	mov    %edx,0x4(%eax)
+  80197f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801984:	c9                   	leave
+  801985:	c3                   	ret
+
+00801986 <ftruncate>:
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	56                   	push   %esi
+  80198a:	53                   	push   %ebx
+  80198b:	83 ec 18             	sub    $0x18,%esp
+  80198e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801991:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801994:	50                   	push   %eax
+  801995:	53                   	push   %ebx
+  801996:	e8 03 fc ff ff       	call   80159e <fd_lookup>
+  80199b:	83 c4 10             	add    $0x10,%esp
+  80199e:	85 c0                	test   %eax,%eax
+  8019a0:	78 34                	js     8019d6 <ftruncate+0x50>
+  8019a2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019a5:	83 ec 08             	sub    $0x8,%esp
+  8019a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ab:	50                   	push   %eax
+  8019ac:	ff 36                	push   (%esi)
+  8019ae:	e8 3b fc ff ff       	call   8015ee <dev_lookup>
+  8019b3:	83 c4 10             	add    $0x10,%esp
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	78 1c                	js     8019d6 <ftruncate+0x50>
+  8019ba:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019be:	74 1d                	je     8019dd <ftruncate+0x57>
+  8019c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c3:	8b 40 18             	mov    0x18(%eax),%eax
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	74 34                	je     8019fe <ftruncate+0x78>
+  8019ca:	83 ec 08             	sub    $0x8,%esp
+  8019cd:	ff 75 0c             	push   0xc(%ebp)
+  8019d0:	56                   	push   %esi
+  8019d1:	ff d0                	call   *%eax
+  8019d3:	83 c4 10             	add    $0x10,%esp
+  8019d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d9:	5b                   	pop    %ebx
+  8019da:	5e                   	pop    %esi
+  8019db:	5d                   	pop    %ebp
+  8019dc:	c3                   	ret
+  8019dd:	a1 14 50 80 00       	mov    0x805014,%eax
+  8019e2:	8b 40 48             	mov    0x48(%eax),%eax
+  8019e5:	83 ec 04             	sub    $0x4,%esp
+  8019e8:	53                   	push   %ebx
+  8019e9:	50                   	push   %eax
+  8019ea:	68 f8 34 80 00       	push   $0x8034f8
+  8019ef:	e8 6e e7 ff ff       	call   800162 <cprintf>
+  8019f4:	83 c4 10             	add    $0x10,%esp
+  8019f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019fc:	eb d8                	jmp    8019d6 <ftruncate+0x50>
+  8019fe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a03:	eb d1                	jmp    8019d6 <ftruncate+0x50>
+
+00801a05 <fstat>:
+  801a05:	55                   	push   %ebp
+  801a06:	89 e5                	mov    %esp,%ebp
+  801a08:	56                   	push   %esi
+  801a09:	53                   	push   %ebx
+  801a0a:	83 ec 18             	sub    $0x18,%esp
+  801a0d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a10:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a13:	50                   	push   %eax
+  801a14:	ff 75 08             	push   0x8(%ebp)
+  801a17:	e8 82 fb ff ff       	call   80159e <fd_lookup>
+  801a1c:	83 c4 10             	add    $0x10,%esp
+  801a1f:	85 c0                	test   %eax,%eax
+  801a21:	78 49                	js     801a6c <fstat+0x67>
+  801a23:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a26:	83 ec 08             	sub    $0x8,%esp
+  801a29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a2c:	50                   	push   %eax
+  801a2d:	ff 36                	push   (%esi)
+  801a2f:	e8 ba fb ff ff       	call   8015ee <dev_lookup>
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 31                	js     801a6c <fstat+0x67>
+  801a3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a42:	74 2f                	je     801a73 <fstat+0x6e>
+  801a44:	c6 03 00             	movb   $0x0,(%ebx)
+  801a47:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a4e:	00 00 00 
+  801a51:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a58:	00 00 00 
+  801a5b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801a61:	83 ec 08             	sub    $0x8,%esp
+  801a64:	53                   	push   %ebx
+  801a65:	56                   	push   %esi
+  801a66:	ff 50 14             	call   *0x14(%eax)
+  801a69:	83 c4 10             	add    $0x10,%esp
+  801a6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6f:	5b                   	pop    %ebx
+  801a70:	5e                   	pop    %esi
+  801a71:	5d                   	pop    %ebp
+  801a72:	c3                   	ret
+  801a73:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a78:	eb f2                	jmp    801a6c <fstat+0x67>
+
+00801a7a <stat>:
+  801a7a:	55                   	push   %ebp
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	56                   	push   %esi
+  801a7e:	53                   	push   %ebx
+  801a7f:	83 ec 08             	sub    $0x8,%esp
+  801a82:	6a 00                	push   $0x0
+  801a84:	ff 75 08             	push   0x8(%ebp)
+  801a87:	e8 31 05 00 00       	call   801fbd <open>
+  801a8c:	89 c3                	mov    %eax,%ebx
+  801a8e:	83 c4 10             	add    $0x10,%esp
+  801a91:	85 c0                	test   %eax,%eax
+  801a93:	78 1b                	js     801ab0 <stat+0x36>
+  801a95:	83 ec 08             	sub    $0x8,%esp
+  801a98:	ff 75 0c             	push   0xc(%ebp)
+  801a9b:	50                   	push   %eax
+  801a9c:	e8 64 ff ff ff       	call   801a05 <fstat>
+  801aa1:	89 c6                	mov    %eax,%esi
+  801aa3:	89 1c 24             	mov    %ebx,(%esp)
+  801aa6:	e8 19 fc ff ff       	call   8016c4 <close>
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	89 f3                	mov    %esi,%ebx
+  801ab0:	89 d8                	mov    %ebx,%eax
+  801ab2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab5:	5b                   	pop    %ebx
+  801ab6:	5e                   	pop    %esi
+  801ab7:	5d                   	pop    %ebp
+  801ab8:	c3                   	ret
+
+00801ab9 <fsipc>:
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	56                   	push   %esi
+  801abd:	53                   	push   %ebx
+  801abe:	89 c3                	mov    %eax,%ebx
+  801ac0:	89 d6                	mov    %edx,%esi
+  801ac2:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801ac9:	74 20                	je     801aeb <fsipc+0x32>
+  801acb:	83 ec 08             	sub    $0x8,%esp
+  801ace:	6a 00                	push   $0x0
+  801ad0:	56                   	push   %esi
+  801ad1:	6a 07                	push   $0x7
+  801ad3:	68 00 60 80 00       	push   $0x806000
+  801ad8:	53                   	push   %ebx
+  801ad9:	ff 35 08 50 80 00    	push   0x805008
+  801adf:	e8 a0 12 00 00       	call   802d84 <ipc_call>
+  801ae4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae7:	5b                   	pop    %ebx
+  801ae8:	5e                   	pop    %esi
+  801ae9:	5d                   	pop    %ebp
+  801aea:	c3                   	ret
+  801aeb:	83 ec 0c             	sub    $0xc,%esp
+  801aee:	6a 02                	push   $0x2
+  801af0:	e8 2a 14 00 00       	call   802f1f <ipc_find_env>
+  801af5:	a3 08 50 80 00       	mov    %eax,0x805008
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	eb cc                	jmp    801acb <fsipc+0x12>
+
+00801aff <devfile_trunc>:
+  801aff:	55                   	push   %ebp
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	83 ec 08             	sub    $0x8,%esp
+  801b05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b08:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b0b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b13:	a3 04 60 80 00       	mov    %eax,0x806004
+  801b18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b22:	e8 92 ff ff ff       	call   801ab9 <fsipc>
+  801b27:	c9                   	leave
+  801b28:	c3                   	ret
+
+00801b29 <devfile_flush>:
+  801b29:	55                   	push   %ebp
+  801b2a:	89 e5                	mov    %esp,%ebp
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+  801b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b32:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b35:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b44:	e8 70 ff ff ff       	call   801ab9 <fsipc>
+  801b49:	c9                   	leave
+  801b4a:	c3                   	ret
+
+00801b4b <devfile_stat>:
+  801b4b:	55                   	push   %ebp
+  801b4c:	89 e5                	mov    %esp,%ebp
+  801b4e:	53                   	push   %ebx
+  801b4f:	83 ec 04             	sub    $0x4,%esp
+  801b52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b5b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b65:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b6a:	e8 4a ff ff ff       	call   801ab9 <fsipc>
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 2c                	js     801b9f <devfile_stat+0x54>
+  801b73:	83 ec 08             	sub    $0x8,%esp
+  801b76:	68 00 60 80 00       	push   $0x806000
+  801b7b:	53                   	push   %ebx
+  801b7c:	e8 d8 ec ff ff       	call   800859 <strcpy>
+  801b81:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b86:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801b8c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b91:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801b97:	83 c4 10             	add    $0x10,%esp
+  801b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba2:	c9                   	leave
+  801ba3:	c3                   	ret
+
+00801ba4 <fsring_rw>:
+  801ba4:	55                   	push   %ebp
+  801ba5:	89 e5                	mov    %esp,%ebp
+  801ba7:	57                   	push   %edi
+  801ba8:	56                   	push   %esi
+  801ba9:	53                   	push   %ebx
+  801baa:	83 ec 2c             	sub    $0x2c,%esp
+  801bad:	89 c7                	mov    %eax,%edi
+  801baf:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bb2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801bb5:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801bba:	a8 01                	test   $0x1,%al
+  801bbc:	74 0d                	je     801bcb <fsring_rw+0x27>
+  801bbe:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801bc3:	a8 01                	test   $0x1,%al
+  801bc5:	0f 85 d5 00 00 00    	jne    801ca0 <fsring_rw+0xfc>
+  801bcb:	a1 14 50 80 00       	mov    0x805014,%eax
+  801bd0:	8b 40 48             	mov    0x48(%eax),%eax
+  801bd3:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801bd9:	0f 84 fc 00 00 00    	je     801cdb <fsring_rw+0x137>
+  801bdf:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801be6:	0f 84 02 01 00 00    	je     801cee <fsring_rw+0x14a>
+  801bec:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801bf1:	83 ec 04             	sub    $0x4,%esp
+  801bf4:	68 07 02 00 00       	push   $0x207
+  801bf9:	53                   	push   %ebx
+  801bfa:	6a 00                	push   $0x0
+  801bfc:	e8 b8 f0 ff ff       	call   800cb9 <sys_page_alloc>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	0f 88 f9 00 00 00    	js     801d05 <fsring_rw+0x161>
+  801c0c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c12:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801c18:	75 d7                	jne    801bf1 <fsring_rw+0x4d>
+  801c1a:	6a 0e                	push   $0xe
+  801c1c:	6a 0d                	push   $0xd
+  801c1e:	ff 35 08 50 80 00    	push   0x805008
+  801c24:	68 00 00 f0 cf       	push   $0xcff00000
+  801c29:	e8 c4 0c 00 00       	call   8028f2 <ipcring_init>
+  801c2e:	83 c4 08             	add    $0x8,%esp
+  801c31:	6a 00                	push   $0x0
+  801c33:	6a 00                	push   $0x0
+  801c35:	68 07 02 00 00       	push   $0x207
+  801c3a:	68 00 00 f0 cf       	push   $0xcff00000
+  801c3f:	6a 0b                	push   $0xb
+  801c41:	ff 35 08 50 80 00    	push   0x805008
+  801c47:	e8 38 11 00 00       	call   802d84 <ipc_call>
+  801c4c:	89 c6                	mov    %eax,%esi
+  801c4e:	83 c4 20             	add    $0x20,%esp
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	0f 88 ac 00 00 00    	js     801d05 <fsring_rw+0x161>
+  801c59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5e:	89 d9                	mov    %ebx,%ecx
+  801c60:	83 c3 01             	add    $0x1,%ebx
+  801c63:	89 da                	mov    %ebx,%edx
+  801c65:	c1 e2 0c             	shl    $0xc,%edx
+  801c68:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801c6e:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801c74:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801c7a:	83 ec 08             	sub    $0x8,%esp
+  801c7d:	6a 00                	push   $0x0
+  801c7f:	6a 00                	push   $0x0
+  801c81:	68 07 02 00 00       	push   $0x207
+  801c86:	50                   	push   %eax
+  801c87:	6a 0c                	push   $0xc
+  801c89:	ff 35 08 50 80 00    	push   0x805008
+  801c8f:	e8 f0 10 00 00       	call   802d84 <ipc_call>
+  801c94:	83 c4 20             	add    $0x20,%esp
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	78 6a                	js     801d05 <fsring_rw+0x161>
+  801c9b:	83 fb 08             	cmp    $0x8,%ebx
+  801c9e:	75 be                	jne    801c5e <fsring_rw+0xba>
+  801ca0:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801ca4:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801ca9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801cae:	0f 45 c2             	cmovne %edx,%eax
+  801cb1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801cb4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801cbb:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801cc2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cce:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd3:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801cd6:	e9 4b 01 00 00       	jmp    801e26 <fsring_rw+0x282>
+  801cdb:	e8 a3 f3 ff ff       	call   801083 <sys_time_msec>
+  801ce0:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801ce6:	0f 89 f3 fe ff ff    	jns    801bdf <fsring_rw+0x3b>
+  801cec:	eb 54                	jmp    801d42 <fsring_rw+0x19e>
+  801cee:	83 ec 0c             	sub    $0xc,%esp
+  801cf1:	6a 02                	push   $0x2
+  801cf3:	e8 27 12 00 00       	call   802f1f <ipc_find_env>
+  801cf8:	a3 08 50 80 00       	mov    %eax,0x805008
+  801cfd:	83 c4 10             	add    $0x10,%esp
+  801d00:	e9 e7 fe ff ff       	jmp    801bec <fsring_rw+0x48>
+  801d05:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d0a:	83 ec 08             	sub    $0x8,%esp
+  801d0d:	53                   	push   %ebx
+  801d0e:	6a 00                	push   $0x0
+  801d10:	e8 76 f0 ff ff       	call   800d8b <sys_page_unmap>
+  801d15:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d24:	75 e4                	jne    801d0a <fsring_rw+0x166>
+  801d26:	e8 58 f3 ff ff       	call   801083 <sys_time_msec>
+  801d2b:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801d30:	a3 00 50 80 00       	mov    %eax,0x805000
+  801d35:	a1 14 50 80 00       	mov    0x805014,%eax
+  801d3a:	8b 40 48             	mov    0x48(%eax),%eax
+  801d3d:	a3 04 50 80 00       	mov    %eax,0x805004
+  801d42:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801d49:	e9 7a 01 00 00       	jmp    801ec8 <fsring_rw+0x324>
+  801d4e:	8b 57 0c             	mov    0xc(%edi),%edx
+  801d51:	89 10                	mov    %edx,(%eax)
+  801d53:	89 58 04             	mov    %ebx,0x4(%eax)
+  801d56:	89 f2                	mov    %esi,%edx
+  801d58:	03 57 04             	add    0x4(%edi),%edx
+  801d5b:	89 50 08             	mov    %edx,0x8(%eax)
+  801d5e:	83 ec 04             	sub    $0x4,%esp
+  801d61:	53                   	push   %ebx
+  801d62:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801d65:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801d68:	52                   	push   %edx
+  801d69:	83 c0 0c             	add    $0xc,%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	e8 97 ec ff ff       	call   800a09 <memmove>
+  801d72:	83 c4 10             	add    $0x10,%esp
+  801d75:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d78:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d7b:	89 08                	mov    %ecx,(%eax)
+  801d7d:	83 ec 0c             	sub    $0xc,%esp
+  801d80:	68 00 00 f0 cf       	push   $0xcff00000
+  801d85:	e8 c6 0b 00 00       	call   802950 <ipcring_req_push>
+  801d8a:	01 de                	add    %ebx,%esi
+  801d8c:	83 c4 10             	add    $0x10,%esp
+  801d8f:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801d92:	73 4c                	jae    801de0 <fsring_rw+0x23c>
+  801d94:	83 ec 0c             	sub    $0xc,%esp
+  801d97:	68 00 00 f0 cf       	push   $0xcff00000
+  801d9c:	e8 89 0b 00 00       	call   80292a <ipcring_req_slot>
+  801da1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801da4:	83 c4 10             	add    $0x10,%esp
+  801da7:	85 c0                	test   %eax,%eax
+  801da9:	74 35                	je     801de0 <fsring_rw+0x23c>
+  801dab:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801db0:	83 e0 07             	and    $0x7,%eax
+  801db3:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801db8:	c1 e0 0c             	shl    $0xc,%eax
+  801dbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dbe:	29 f3                	sub    %esi,%ebx
+  801dc0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801dc3:	39 cb                	cmp    %ecx,%ebx
+  801dc5:	0f 47 d9             	cmova  %ecx,%ebx
+  801dc8:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801dcc:	75 80                	jne    801d4e <fsring_rw+0x1aa>
+  801dce:	8b 57 0c             	mov    0xc(%edi),%edx
+  801dd1:	89 10                	mov    %edx,(%eax)
+  801dd3:	89 58 04             	mov    %ebx,0x4(%eax)
+  801dd6:	89 f2                	mov    %esi,%edx
+  801dd8:	03 57 04             	add    0x4(%edi),%edx
+  801ddb:	89 50 08             	mov    %edx,0x8(%eax)
+  801dde:	eb 95                	jmp    801d75 <fsring_rw+0x1d1>
+  801de0:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801de5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801de8:	83 ec 0c             	sub    $0xc,%esp
+  801deb:	68 00 00 f0 cf       	push   $0xcff00000
+  801df0:	e8 94 0b 00 00       	call   802989 <ipcring_rsp_wait>
+  801df5:	8b 58 04             	mov    0x4(%eax),%ebx
+  801df8:	83 c4 10             	add    $0x10,%esp
+  801dfb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801dff:	75 45                	jne    801e46 <fsring_rw+0x2a2>
+  801e01:	85 db                	test   %ebx,%ebx
+  801e03:	79 41                	jns    801e46 <fsring_rw+0x2a2>
+  801e05:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801e08:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801e0f:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801e16:	83 ec 0c             	sub    $0xc,%esp
+  801e19:	68 00 00 f0 cf       	push   $0xcff00000
+  801e1e:	e8 cc 0b 00 00       	call   8029ef <ipcring_rsp_pop>
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801e2c:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801e31:	39 c2                	cmp    %eax,%edx
+  801e33:	74 75                	je     801eaa <fsring_rw+0x306>
+  801e35:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801e39:	75 a5                	jne    801de0 <fsring_rw+0x23c>
+  801e3b:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801e3e:	0f 82 50 ff ff ff    	jb     801d94 <fsring_rw+0x1f0>
+  801e44:	eb 9a                	jmp    801de0 <fsring_rw+0x23c>
+  801e46:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e4a:	75 ca                	jne    801e16 <fsring_rw+0x272>
+  801e4c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e50:	74 31                	je     801e83 <fsring_rw+0x2df>
+  801e52:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e55:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801e58:	29 c8                	sub    %ecx,%eax
+  801e5a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801e5d:	39 d0                	cmp    %edx,%eax
+  801e5f:	0f 47 c2             	cmova  %edx,%eax
+  801e62:	39 d8                	cmp    %ebx,%eax
+  801e64:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e69:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801e6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801e70:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e75:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801e79:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e7c:	01 d9                	add    %ebx,%ecx
+  801e7e:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801e81:	eb 93                	jmp    801e16 <fsring_rw+0x272>
+  801e83:	83 ec 04             	sub    $0x4,%esp
+  801e86:	53                   	push   %ebx
+  801e87:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e8a:	83 e0 07             	and    $0x7,%eax
+  801e8d:	c1 e0 0c             	shl    $0xc,%eax
+  801e90:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801e96:	50                   	push   %eax
+  801e97:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801e9a:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801e9d:	01 c8                	add    %ecx,%eax
+  801e9f:	50                   	push   %eax
+  801ea0:	e8 64 eb ff ff       	call   800a09 <memmove>
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	eb a8                	jmp    801e52 <fsring_rw+0x2ae>
+  801eaa:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801eae:	75 09                	jne    801eb9 <fsring_rw+0x315>
+  801eb0:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801eb3:	0f 82 db fe ff ff    	jb     801d94 <fsring_rw+0x1f0>
+  801eb9:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801ebc:	01 57 04             	add    %edx,0x4(%edi)
+  801ebf:	85 d2                	test   %edx,%edx
+  801ec1:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801ec5:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801ec8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801ecb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ece:	5b                   	pop    %ebx
+  801ecf:	5e                   	pop    %esi
+  801ed0:	5f                   	pop    %edi
+  801ed1:	5d                   	pop    %ebp
+  801ed2:	c3                   	ret
+
+00801ed3 <devfile_write>:
+  801ed3:	55                   	push   %ebp
+  801ed4:	89 e5                	mov    %esp,%ebp
+  801ed6:	57                   	push   %edi
+  801ed7:	56                   	push   %esi
+  801ed8:	53                   	push   %ebx
+  801ed9:	83 ec 0c             	sub    $0xc,%esp
+  801edc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801edf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ee2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ee5:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801eeb:	76 1a                	jbe    801f07 <devfile_write+0x34>
+  801eed:	83 ec 0c             	sub    $0xc,%esp
+  801ef0:	53                   	push   %ebx
+  801ef1:	89 f1                	mov    %esi,%ecx
+  801ef3:	ba 06 00 00 00       	mov    $0x6,%edx
+  801ef8:	89 f8                	mov    %edi,%eax
+  801efa:	e8 a5 fc ff ff       	call   801ba4 <fsring_rw>
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801f05:	75 39                	jne    801f40 <devfile_write+0x6d>
+  801f07:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801f0c:	39 c3                	cmp    %eax,%ebx
+  801f0e:	0f 47 d8             	cmova  %eax,%ebx
+  801f11:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f14:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f19:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801f1f:	83 ec 04             	sub    $0x4,%esp
+  801f22:	53                   	push   %ebx
+  801f23:	56                   	push   %esi
+  801f24:	68 08 60 80 00       	push   $0x806008
+  801f29:	e8 db ea ff ff       	call   800a09 <memmove>
+  801f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f33:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f38:	e8 7c fb ff ff       	call   801ab9 <fsipc>
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f43:	5b                   	pop    %ebx
+  801f44:	5e                   	pop    %esi
+  801f45:	5f                   	pop    %edi
+  801f46:	5d                   	pop    %ebp
+  801f47:	c3                   	ret
+
+00801f48 <devfile_read>:
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	57                   	push   %edi
+  801f4c:	56                   	push   %esi
+  801f4d:	53                   	push   %ebx
+  801f4e:	83 ec 0c             	sub    $0xc,%esp
+  801f51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f54:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f57:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  801f5d:	76 1d                	jbe    801f7c <devfile_read+0x34>
+  801f5f:	83 ec 0c             	sub    $0xc,%esp
+  801f62:	56                   	push   %esi
+  801f63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f66:	ba 05 00 00 00       	mov    $0x5,%edx
+  801f6b:	89 f8                	mov    %edi,%eax
+  801f6d:	e8 32 fc ff ff       	call   801ba4 <fsring_rw>
+  801f72:	89 c3                	mov    %eax,%ebx
+  801f74:	83 c4 10             	add    $0x10,%esp
+  801f77:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801f7a:	75 37                	jne    801fb3 <devfile_read+0x6b>
+  801f7c:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f7f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f84:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801f8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f94:	e8 20 fb ff ff       	call   801ab9 <fsipc>
+  801f99:	89 c3                	mov    %eax,%ebx
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	78 14                	js     801fb3 <devfile_read+0x6b>
+  801f9f:	83 ec 04             	sub    $0x4,%esp
+  801fa2:	50                   	push   %eax
+  801fa3:	68 00 60 80 00       	push   $0x806000
+  801fa8:	ff 75 0c             	push   0xc(%ebp)
+  801fab:	e8 59 ea ff ff       	call   800a09 <memmove>
+  801fb0:	83 c4 10             	add    $0x10,%esp
+  801fb3:	89 d8                	mov    %ebx,%eax
+  801fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb8:	5b                   	pop    %ebx
+  801fb9:	5e                   	pop    %esi
+  801fba:	5f                   	pop    %edi
+  801fbb:	5d                   	pop    %ebp
+  801fbc:	c3                   	ret
+
+00801fbd <open>:
+  801fbd:	55                   	push   %ebp
+  801fbe:	89 e5                	mov    %esp,%ebp
+  801fc0:	56                   	push   %esi
+  801fc1:	53                   	push   %ebx
+  801fc2:	83 ec 1c             	sub    $0x1c,%esp
+  801fc5:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc8:	56                   	push   %esi
+  801fc9:	e8 3f e8 ff ff       	call   80080d <strlen>
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fd6:	7f 6c                	jg     802044 <open+0x87>
+  801fd8:	83 ec 0c             	sub    $0xc,%esp
+  801fdb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fde:	50                   	push   %eax
+  801fdf:	e8 6a f5 ff ff       	call   80154e <fd_alloc>
+  801fe4:	89 c3                	mov    %eax,%ebx
+  801fe6:	83 c4 10             	add    $0x10,%esp
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 3c                	js     802029 <open+0x6c>
+  801fed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff0:	a3 00 64 80 00       	mov    %eax,0x806400
+  801ff5:	83 ec 08             	sub    $0x8,%esp
+  801ff8:	56                   	push   %esi
+  801ff9:	68 00 60 80 00       	push   $0x806000
+  801ffe:	e8 56 e8 ff ff       	call   800859 <strcpy>
+  802003:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802006:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200b:	e8 a9 fa ff ff       	call   801ab9 <fsipc>
+  802010:	89 c3                	mov    %eax,%ebx
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 19                	js     802032 <open+0x75>
+  802019:	83 ec 0c             	sub    $0xc,%esp
+  80201c:	ff 75 f4             	push   -0xc(%ebp)
+  80201f:	e8 03 f5 ff ff       	call   801527 <fd2num>
+  802024:	89 c3                	mov    %eax,%ebx
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	89 d8                	mov    %ebx,%eax
+  80202b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202e:	5b                   	pop    %ebx
+  80202f:	5e                   	pop    %esi
+  802030:	5d                   	pop    %ebp
+  802031:	c3                   	ret
+  802032:	83 ec 08             	sub    $0x8,%esp
+  802035:	6a 00                	push   $0x0
+  802037:	ff 75 f4             	push   -0xc(%ebp)
+  80203a:	e8 05 f6 ff ff       	call   801644 <fd_close>
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	eb e5                	jmp    802029 <open+0x6c>
+  802044:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802049:	eb de                	jmp    802029 <open+0x6c>
+
+0080204b <file_image>:
+  80204b:	55                   	push   %ebp
+  80204c:	89 e5                	mov    %esp,%ebp
+  80204e:	53                   	push   %ebx
+  80204f:	83 ec 1c             	sub    $0x1c,%esp
+  802052:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802055:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802058:	50                   	push   %eax
+  802059:	ff 75 08             	push   0x8(%ebp)
+  80205c:	e8 3d f5 ff ff       	call   80159e <fd_lookup>
+  802061:	83 c4 10             	add    $0x10,%esp
+  802064:	85 c0                	test   %eax,%eax
+  802066:	78 58                	js     8020c0 <file_image+0x75>
+  802068:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80206b:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802071:	39 08                	cmp    %ecx,(%eax)
+  802073:	75 50                	jne    8020c5 <file_image+0x7a>
+  802075:	83 fb 04             	cmp    $0x4,%ebx
+  802078:	77 52                	ja     8020cc <file_image+0x81>
+  80207a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80207d:	a3 00 60 80 00       	mov    %eax,0x806000
+  802082:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802088:	83 ec 04             	sub    $0x4,%esp
+  80208b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80208e:	c1 e0 02             	shl    $0x2,%eax
+  802091:	50                   	push   %eax
+  802092:	ff 75 0c             	push   0xc(%ebp)
+  802095:	68 08 60 80 00       	push   $0x806008
+  80209a:	e8 6a e9 ff ff       	call   800a09 <memmove>
+  80209f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020a9:	e8 0b fa ff ff       	call   801ab9 <fsipc>
+  8020ae:	83 c4 10             	add    $0x10,%esp
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 0b                	js     8020c0 <file_image+0x75>
+  8020b5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8020b8:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8020be:	89 0a                	mov    %ecx,(%edx)
+  8020c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c3:	c9                   	leave
+  8020c4:	c3                   	ret
+  8020c5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ca:	eb f4                	jmp    8020c0 <file_image+0x75>
+  8020cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020d1:	eb ed                	jmp    8020c0 <file_image+0x75>
+
+008020d3 <remove>:
+  8020d3:	55                   	push   %ebp
+  8020d4:	89 e5                	mov    %esp,%ebp
+  8020d6:	53                   	push   %ebx
+  8020d7:	83 ec 10             	sub    $0x10,%esp
+  8020da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020dd:	53                   	push   %ebx
+  8020de:	e8 2a e7 ff ff       	call   80080d <strlen>
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020eb:	7f 25                	jg     802112 <remove+0x3f>
+  8020ed:	83 ec 08             	sub    $0x8,%esp
+  8020f0:	53                   	push   %ebx
+  8020f1:	68 00 60 80 00       	push   $0x806000
+  8020f6:	e8 5e e7 ff ff       	call   800859 <strcpy>
+  8020fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802100:	b8 09 00 00 00       	mov    $0x9,%eax
+  802105:	e8 af f9 ff ff       	call   801ab9 <fsipc>
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+  802112:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802117:	eb f4                	jmp    80210d <remove+0x3a>
+
+00802119 <sync>:
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+  80211c:	83 ec 08             	sub    $0x8,%esp
+  80211f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802124:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802129:	e8 8b f9 ff ff       	call   801ab9 <fsipc>
+  80212e:	c9                   	leave
+  80212f:	c3                   	ret
+
+00802130 <devsock_stat>:
+  802130:	55                   	push   %ebp
+  802131:	89 e5                	mov    %esp,%ebp
+  802133:	83 ec 10             	sub    $0x10,%esp
+  802136:	68 68 35 80 00       	push   $0x803568
+  80213b:	ff 75 0c             	push   0xc(%ebp)
+  80213e:	e8 16 e7 ff ff       	call   800859 <strcpy>
+  802143:	b8 00 00 00 00       	mov    $0x0,%eax
+  802148:	c9                   	leave
+  802149:	c3                   	ret
+
+0080214a <devsock_close>:
+  80214a:	55                   	push   %ebp
+  80214b:	89 e5                	mov    %esp,%ebp
+  80214d:	53                   	push   %ebx
+  80214e:	83 ec 10             	sub    $0x10,%esp
+  802151:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802154:	53                   	push   %ebx
+  802155:	e8 df 0d 00 00       	call   802f39 <pageref>
+  80215a:	89 c2                	mov    %eax,%edx
+  80215c:	83 c4 10             	add    $0x10,%esp
+  80215f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802164:	83 fa 01             	cmp    $0x1,%edx
+  802167:	74 05                	je     80216e <devsock_close+0x24>
+  802169:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80216c:	c9                   	leave
+  80216d:	c3                   	ret
+  80216e:	83 ec 0c             	sub    $0xc,%esp
+  802171:	ff 73 0c             	push   0xc(%ebx)
+  802174:	e8 aa 02 00 00       	call   802423 <nsipc_close>
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	eb eb                	jmp    802169 <devsock_close+0x1f>
+
+0080217e <devsock_write>:
+  80217e:	55                   	push   %ebp
+  80217f:	89 e5                	mov    %esp,%ebp
+  802181:	83 ec 08             	sub    $0x8,%esp
+  802184:	6a 00                	push   $0x0
+  802186:	ff 75 10             	push   0x10(%ebp)
+  802189:	ff 75 0c             	push   0xc(%ebp)
+  80218c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218f:	ff 70 0c             	push   0xc(%eax)
+  802192:	e8 6c 03 00 00       	call   802503 <nsipc_send>
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+
+00802199 <devsock_read>:
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	83 ec 08             	sub    $0x8,%esp
+  80219f:	6a 00                	push   $0x0
+  8021a1:	ff 75 10             	push   0x10(%ebp)
+  8021a4:	ff 75 0c             	push   0xc(%ebp)
+  8021a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021aa:	ff 70 0c             	push   0xc(%eax)
+  8021ad:	e8 e2 02 00 00       	call   802494 <nsipc_recv>
+  8021b2:	c9                   	leave
+  8021b3:	c3                   	ret
+
+008021b4 <fd2sockid>:
+  8021b4:	55                   	push   %ebp
+  8021b5:	89 e5                	mov    %esp,%ebp
+  8021b7:	83 ec 20             	sub    $0x20,%esp
+  8021ba:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021bd:	52                   	push   %edx
+  8021be:	50                   	push   %eax
+  8021bf:	e8 da f3 ff ff       	call   80159e <fd_lookup>
+  8021c4:	83 c4 10             	add    $0x10,%esp
+  8021c7:	85 c0                	test   %eax,%eax
+  8021c9:	78 10                	js     8021db <fd2sockid+0x27>
+  8021cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ce:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8021d4:	39 08                	cmp    %ecx,(%eax)
+  8021d6:	75 05                	jne    8021dd <fd2sockid+0x29>
+  8021d8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021db:	c9                   	leave
+  8021dc:	c3                   	ret
+  8021dd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021e2:	eb f7                	jmp    8021db <fd2sockid+0x27>
+
+008021e4 <alloc_sockfd>:
+  8021e4:	55                   	push   %ebp
+  8021e5:	89 e5                	mov    %esp,%ebp
+  8021e7:	56                   	push   %esi
+  8021e8:	53                   	push   %ebx
+  8021e9:	83 ec 1c             	sub    $0x1c,%esp
+  8021ec:	89 c6                	mov    %eax,%esi
+  8021ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f1:	50                   	push   %eax
+  8021f2:	e8 57 f3 ff ff       	call   80154e <fd_alloc>
+  8021f7:	89 c3                	mov    %eax,%ebx
+  8021f9:	83 c4 10             	add    $0x10,%esp
+  8021fc:	85 c0                	test   %eax,%eax
+  8021fe:	78 43                	js     802243 <alloc_sockfd+0x5f>
+  802200:	83 ec 04             	sub    $0x4,%esp
+  802203:	68 07 04 00 00       	push   $0x407
+  802208:	ff 75 f4             	push   -0xc(%ebp)
+  80220b:	6a 00                	push   $0x0
+  80220d:	e8 a7 ea ff ff       	call   800cb9 <sys_page_alloc>
+  802212:	89 c3                	mov    %eax,%ebx
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	85 c0                	test   %eax,%eax
+  802219:	78 28                	js     802243 <alloc_sockfd+0x5f>
+  80221b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80221e:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802224:	89 10                	mov    %edx,(%eax)
+  802226:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802229:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802230:	89 70 0c             	mov    %esi,0xc(%eax)
+  802233:	83 ec 0c             	sub    $0xc,%esp
+  802236:	50                   	push   %eax
+  802237:	e8 eb f2 ff ff       	call   801527 <fd2num>
+  80223c:	89 c3                	mov    %eax,%ebx
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	eb 0c                	jmp    80224f <alloc_sockfd+0x6b>
+  802243:	83 ec 0c             	sub    $0xc,%esp
+  802246:	56                   	push   %esi
+  802247:	e8 d7 01 00 00       	call   802423 <nsipc_close>
+  80224c:	83 c4 10             	add    $0x10,%esp
+  80224f:	89 d8                	mov    %ebx,%eax
+  802251:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802254:	5b                   	pop    %ebx
+  802255:	5e                   	pop    %esi
+  802256:	5d                   	pop    %ebp
+  802257:	c3                   	ret
+
+00802258 <accept>:
+  802258:	55                   	push   %ebp
+  802259:	89 e5                	mov    %esp,%ebp
+  80225b:	83 ec 08             	sub    $0x8,%esp
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	e8 4e ff ff ff       	call   8021b4 <fd2sockid>
+  802266:	85 c0                	test   %eax,%eax
+  802268:	78 1b                	js     802285 <accept+0x2d>
+  80226a:	83 ec 04             	sub    $0x4,%esp
+  80226d:	ff 75 10             	push   0x10(%ebp)
+  802270:	ff 75 0c             	push   0xc(%ebp)
+  802273:	50                   	push   %eax
+  802274:	e8 07 01 00 00       	call   802380 <nsipc_accept>
+  802279:	83 c4 10             	add    $0x10,%esp
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 05                	js     802285 <accept+0x2d>
+  802280:	e8 5f ff ff ff       	call   8021e4 <alloc_sockfd>
+  802285:	c9                   	leave
+  802286:	c3                   	ret
+
+00802287 <bind>:
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	83 ec 08             	sub    $0x8,%esp
+  80228d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802290:	e8 1f ff ff ff       	call   8021b4 <fd2sockid>
+  802295:	85 c0                	test   %eax,%eax
+  802297:	78 12                	js     8022ab <bind+0x24>
+  802299:	83 ec 04             	sub    $0x4,%esp
+  80229c:	ff 75 10             	push   0x10(%ebp)
+  80229f:	ff 75 0c             	push   0xc(%ebp)
+  8022a2:	50                   	push   %eax
+  8022a3:	e8 24 01 00 00       	call   8023cc <nsipc_bind>
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	c9                   	leave
+  8022ac:	c3                   	ret
+
+008022ad <shutdown>:
+  8022ad:	55                   	push   %ebp
+  8022ae:	89 e5                	mov    %esp,%ebp
+  8022b0:	83 ec 08             	sub    $0x8,%esp
+  8022b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b6:	e8 f9 fe ff ff       	call   8021b4 <fd2sockid>
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	78 0f                	js     8022ce <shutdown+0x21>
+  8022bf:	83 ec 08             	sub    $0x8,%esp
+  8022c2:	ff 75 0c             	push   0xc(%ebp)
+  8022c5:	50                   	push   %eax
+  8022c6:	e8 36 01 00 00       	call   802401 <nsipc_shutdown>
+  8022cb:	83 c4 10             	add    $0x10,%esp
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+008022d0 <connect>:
+  8022d0:	55                   	push   %ebp
+  8022d1:	89 e5                	mov    %esp,%ebp
+  8022d3:	83 ec 08             	sub    $0x8,%esp
+  8022d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d9:	e8 d6 fe ff ff       	call   8021b4 <fd2sockid>
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	78 12                	js     8022f4 <connect+0x24>
+  8022e2:	83 ec 04             	sub    $0x4,%esp
+  8022e5:	ff 75 10             	push   0x10(%ebp)
+  8022e8:	ff 75 0c             	push   0xc(%ebp)
+  8022eb:	50                   	push   %eax
+  8022ec:	e8 4c 01 00 00       	call   80243d <nsipc_connect>
+  8022f1:	83 c4 10             	add    $0x10,%esp
+  8022f4:	c9                   	leave
+  8022f5:	c3                   	ret
+
+008022f6 <listen>:
+  8022f6:	55                   	push   %ebp
+  8022f7:	89 e5                	mov    %esp,%ebp
+  8022f9:	83 ec 08             	sub    $0x8,%esp
+  8022fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ff:	e8 b0 fe ff ff       	call   8021b4 <fd2sockid>
+  802304:	85 c0                	test   %eax,%eax
+  802306:	78 0f                	js     802317 <listen+0x21>
+  802308:	83 ec 08             	sub    $0x8,%esp
+  80230b:	ff 75 0c             	push   0xc(%ebp)
+  80230e:	50                   	push   %eax
+  80230f:	e8 5e 01 00 00       	call   802472 <nsipc_listen>
+  802314:	83 c4 10             	add    $0x10,%esp
+  802317:	c9                   	leave
+  802318:	c3                   	ret
+
+00802319 <socket>:
+  802319:	55                   	push   %ebp
+  80231a:	89 e5                	mov    %esp,%ebp
+  80231c:	83 ec 0c             	sub    $0xc,%esp
+  80231f:	ff 75 10             	push   0x10(%ebp)
+  802322:	ff 75 0c             	push   0xc(%ebp)
+  802325:	ff 75 08             	push   0x8(%ebp)
+  802328:	e8 34 02 00 00       	call   802561 <nsipc_socket>
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	85 c0                	test   %eax,%eax
+  802332:	78 05                	js     802339 <socket+0x20>
+  802334:	e8 ab fe ff ff       	call   8021e4 <alloc_sockfd>
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+
+0080233b <nsipc>:
+  80233b:	55                   	push   %ebp
+  80233c:	89 e5                	mov    %esp,%ebp
+  80233e:	53                   	push   %ebx
+  80233f:	83 ec 04             	sub    $0x4,%esp
+  802342:	89 c3                	mov    %eax,%ebx
+  802344:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80234b:	74 1f                	je     80236c <nsipc+0x31>
+  80234d:	83 ec 08             	sub    $0x8,%esp
+  802350:	6a 00                	push   $0x0
+  802352:	6a 00                	push   $0x0
+  802354:	6a 07                	push   $0x7
+  802356:	68 00 70 80 00       	push   $0x807000
+  80235b:	53                   	push   %ebx
+  80235c:	ff 35 0c 50 80 00    	push   0x80500c
+  802362:	e8 1d 0a 00 00       	call   802d84 <ipc_call>
+  802367:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80236a:	c9                   	leave
+  80236b:	c3                   	ret
+  80236c:	83 ec 0c             	sub    $0xc,%esp
+  80236f:	6a 03                	push   $0x3
+  802371:	e8 a9 0b 00 00       	call   802f1f <ipc_find_env>
+  802376:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80237b:	83 c4 10             	add    $0x10,%esp
+  80237e:	eb cd                	jmp    80234d <nsipc+0x12>
+
+00802380 <nsipc_accept>:
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	53                   	push   %ebx
+  802384:	83 ec 04             	sub    $0x4,%esp
+  802387:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80238f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802394:	e8 a2 ff ff ff       	call   80233b <nsipc>
+  802399:	89 c3                	mov    %eax,%ebx
+  80239b:	85 c0                	test   %eax,%eax
+  80239d:	79 07                	jns    8023a6 <nsipc_accept+0x26>
+  80239f:	89 d8                	mov    %ebx,%eax
+  8023a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a4:	c9                   	leave
+  8023a5:	c3                   	ret
+  8023a6:	83 ec 04             	sub    $0x4,%esp
+  8023a9:	ff 35 10 70 80 00    	push   0x807010
+  8023af:	68 00 70 80 00       	push   $0x807000
+  8023b4:	ff 75 0c             	push   0xc(%ebp)
+  8023b7:	e8 4d e6 ff ff       	call   800a09 <memmove>
+  8023bc:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8023c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023c5:	89 10                	mov    %edx,(%eax)
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	eb d3                	jmp    80239f <nsipc_accept+0x1f>
+
+008023cc <nsipc_bind>:
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	53                   	push   %ebx
+  8023d0:	83 ec 08             	sub    $0x8,%esp
+  8023d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8023de:	53                   	push   %ebx
+  8023df:	ff 75 0c             	push   0xc(%ebp)
+  8023e2:	68 04 70 80 00       	push   $0x807004
+  8023e7:	e8 1d e6 ff ff       	call   800a09 <memmove>
+  8023ec:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8023f2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023f7:	e8 3f ff ff ff       	call   80233b <nsipc>
+  8023fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ff:	c9                   	leave
+  802400:	c3                   	ret
+
+00802401 <nsipc_shutdown>:
+  802401:	55                   	push   %ebp
+  802402:	89 e5                	mov    %esp,%ebp
+  802404:	83 ec 08             	sub    $0x8,%esp
+  802407:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80240f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802412:	a3 04 70 80 00       	mov    %eax,0x807004
+  802417:	b8 03 00 00 00       	mov    $0x3,%eax
+  80241c:	e8 1a ff ff ff       	call   80233b <nsipc>
+  802421:	c9                   	leave
+  802422:	c3                   	ret
+
+00802423 <nsipc_close>:
+  802423:	55                   	push   %ebp
+  802424:	89 e5                	mov    %esp,%ebp
+  802426:	83 ec 08             	sub    $0x8,%esp
+  802429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802431:	b8 04 00 00 00       	mov    $0x4,%eax
+  802436:	e8 00 ff ff ff       	call   80233b <nsipc>
+  80243b:	c9                   	leave
+  80243c:	c3                   	ret
+
+0080243d <nsipc_connect>:
+  80243d:	55                   	push   %ebp
+  80243e:	89 e5                	mov    %esp,%ebp
+  802440:	53                   	push   %ebx
+  802441:	83 ec 08             	sub    $0x8,%esp
+  802444:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802447:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80244f:	53                   	push   %ebx
+  802450:	ff 75 0c             	push   0xc(%ebp)
+  802453:	68 04 70 80 00       	push   $0x807004
+  802458:	e8 ac e5 ff ff       	call   800a09 <memmove>
+  80245d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802463:	b8 05 00 00 00       	mov    $0x5,%eax
+  802468:	e8 ce fe ff ff       	call   80233b <nsipc>
+  80246d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802470:	c9                   	leave
+  802471:	c3                   	ret
+
+00802472 <nsipc_listen>:
+  802472:	55                   	push   %ebp
+  802473:	89 e5                	mov    %esp,%ebp
+  802475:	83 ec 08             	sub    $0x8,%esp
+  802478:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802480:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802483:	a3 04 70 80 00       	mov    %eax,0x807004
+  802488:	b8 06 00 00 00       	mov    $0x6,%eax
+  80248d:	e8 a9 fe ff ff       	call   80233b <nsipc>
+  802492:	c9                   	leave
+  802493:	c3                   	ret
+
+00802494 <nsipc_recv>:
+  802494:	55                   	push   %ebp
+  802495:	89 e5                	mov    %esp,%ebp
+  802497:	56                   	push   %esi
+  802498:	53                   	push   %ebx
+  802499:	8b 75 10             	mov    0x10(%ebp),%esi
+  80249c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249f:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024a4:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8024aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ad:	a3 08 70 80 00       	mov    %eax,0x807008
+  8024b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024b7:	e8 7f fe ff ff       	call   80233b <nsipc>
+  8024bc:	89 c3                	mov    %eax,%ebx
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	78 22                	js     8024e4 <nsipc_recv+0x50>
+  8024c2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8024c7:	39 c6                	cmp    %eax,%esi
+  8024c9:	0f 4e c6             	cmovle %esi,%eax
+  8024cc:	39 c3                	cmp    %eax,%ebx
+  8024ce:	7f 1d                	jg     8024ed <nsipc_recv+0x59>
+  8024d0:	83 ec 04             	sub    $0x4,%esp
+  8024d3:	53                   	push   %ebx
+  8024d4:	68 00 70 80 00       	push   $0x807000
+  8024d9:	ff 75 0c             	push   0xc(%ebp)
+  8024dc:	e8 28 e5 ff ff       	call   800a09 <memmove>
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	89 d8                	mov    %ebx,%eax
+  8024e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e9:	5b                   	pop    %ebx
+  8024ea:	5e                   	pop    %esi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+  8024ed:	68 74 35 80 00       	push   $0x803574
+  8024f2:	68 89 35 80 00       	push   $0x803589
+  8024f7:	6a 60                	push   $0x60
+  8024f9:	68 9e 35 80 00       	push   $0x80359e
+  8024fe:	e8 83 07 00 00       	call   802c86 <_panic>
+
+00802503 <nsipc_send>:
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	53                   	push   %ebx
+  802507:	83 ec 04             	sub    $0x4,%esp
+  80250a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80250d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802510:	a3 00 70 80 00       	mov    %eax,0x807000
+  802515:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80251b:	7f 2e                	jg     80254b <nsipc_send+0x48>
+  80251d:	83 ec 04             	sub    $0x4,%esp
+  802520:	53                   	push   %ebx
+  802521:	ff 75 0c             	push   0xc(%ebp)
+  802524:	68 0c 70 80 00       	push   $0x80700c
+  802529:	e8 db e4 ff ff       	call   800a09 <memmove>
+  80252e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802534:	8b 45 14             	mov    0x14(%ebp),%eax
+  802537:	a3 08 70 80 00       	mov    %eax,0x807008
+  80253c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802541:	e8 f5 fd ff ff       	call   80233b <nsipc>
+  802546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802549:	c9                   	leave
+  80254a:	c3                   	ret
+  80254b:	68 aa 35 80 00       	push   $0x8035aa
+  802550:	68 89 35 80 00       	push   $0x803589
+  802555:	6a 6b                	push   $0x6b
+  802557:	68 9e 35 80 00       	push   $0x80359e
+  80255c:	e8 25 07 00 00       	call   802c86 <_panic>
+
+00802561 <nsipc_socket>:
+  802561:	55                   	push   %ebp
+  802562:	89 e5                	mov    %esp,%ebp
+  802564:	83 ec 08             	sub    $0x8,%esp
+  802567:	8b 45 08             	mov    0x8(%ebp),%eax
+  80256a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80256f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802572:	a3 04 70 80 00       	mov    %eax,0x807004
+  802577:	8b 45 10             	mov    0x10(%ebp),%eax
+  80257a:	a3 08 70 80 00       	mov    %eax,0x807008
+  80257f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802584:	e8 b2 fd ff ff       	call   80233b <nsipc>
+  802589:	c9                   	leave
+  80258a:	c3                   	ret
+
+0080258b <devpipe_stat>:
+  80258b:	55                   	push   %ebp
+  80258c:	89 e5                	mov    %esp,%ebp
+  80258e:	56                   	push   %esi
+  80258f:	53                   	push   %ebx
+  802590:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802593:	83 ec 0c             	sub    $0xc,%esp
+  802596:	ff 75 08             	push   0x8(%ebp)
+  802599:	e8 99 ef ff ff       	call   801537 <fd2data>
+  80259e:	89 c6                	mov    %eax,%esi
+  8025a0:	83 c4 08             	add    $0x8,%esp
+  8025a3:	68 b6 35 80 00       	push   $0x8035b6
+  8025a8:	53                   	push   %ebx
+  8025a9:	e8 ab e2 ff ff       	call   800859 <strcpy>
+  8025ae:	8b 46 04             	mov    0x4(%esi),%eax
+  8025b1:	2b 06                	sub    (%esi),%eax
+  8025b3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8025b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025c0:	00 00 00 
+  8025c3:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8025ca:	40 80 00 
+  8025cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d5:	5b                   	pop    %ebx
+  8025d6:	5e                   	pop    %esi
+  8025d7:	5d                   	pop    %ebp
+  8025d8:	c3                   	ret
+
+008025d9 <devpipe_close>:
+  8025d9:	55                   	push   %ebp
+  8025da:	89 e5                	mov    %esp,%ebp
+  8025dc:	53                   	push   %ebx
+  8025dd:	83 ec 0c             	sub    $0xc,%esp
+  8025e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025e3:	53                   	push   %ebx
+  8025e4:	6a 00                	push   $0x0
+  8025e6:	e8 a0 e7 ff ff       	call   800d8b <sys_page_unmap>
+  8025eb:	89 1c 24             	mov    %ebx,(%esp)
+  8025ee:	e8 44 ef ff ff       	call   801537 <fd2data>
+  8025f3:	83 c4 08             	add    $0x8,%esp
+  8025f6:	50                   	push   %eax
+  8025f7:	6a 00                	push   $0x0
+  8025f9:	e8 8d e7 ff ff       	call   800d8b <sys_page_unmap>
+  8025fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802601:	c9                   	leave
+  802602:	c3                   	ret
+
+00802603 <_pipeisclosed>:
+  802603:	55                   	push   %ebp
+  802604:	89 e5                	mov    %esp,%ebp
+  802606:	57                   	push   %edi
+  802607:	56                   	push   %esi
+  802608:	53                   	push   %ebx
+  802609:	83 ec 1c             	sub    $0x1c,%esp
+  80260c:	89 c7                	mov    %eax,%edi
+  80260e:	89 d6                	mov    %edx,%esi
+  802610:	a1 14 50 80 00       	mov    0x805014,%eax
+  802615:	8b 58 58             	mov    0x58(%eax),%ebx
+  802618:	83 ec 0c             	sub    $0xc,%esp
+  80261b:	57                   	push   %edi
+  80261c:	e8 18 09 00 00       	call   802f39 <pageref>
+  802621:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802624:	89 34 24             	mov    %esi,(%esp)
+  802627:	e8 0d 09 00 00       	call   802f39 <pageref>
+  80262c:	8b 15 14 50 80 00    	mov    0x805014,%edx
+  802632:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802635:	83 c4 10             	add    $0x10,%esp
+  802638:	39 cb                	cmp    %ecx,%ebx
+  80263a:	74 1b                	je     802657 <_pipeisclosed+0x54>
+  80263c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80263f:	75 cf                	jne    802610 <_pipeisclosed+0xd>
+  802641:	8b 42 58             	mov    0x58(%edx),%eax
+  802644:	6a 01                	push   $0x1
+  802646:	50                   	push   %eax
+  802647:	53                   	push   %ebx
+  802648:	68 bd 35 80 00       	push   $0x8035bd
+  80264d:	e8 10 db ff ff       	call   800162 <cprintf>
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	eb b9                	jmp    802610 <_pipeisclosed+0xd>
+  802657:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80265a:	0f 94 c0             	sete   %al
+  80265d:	0f b6 c0             	movzbl %al,%eax
+  802660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802663:	5b                   	pop    %ebx
+  802664:	5e                   	pop    %esi
+  802665:	5f                   	pop    %edi
+  802666:	5d                   	pop    %ebp
+  802667:	c3                   	ret
+
+00802668 <devpipe_write>:
+  802668:	55                   	push   %ebp
+  802669:	89 e5                	mov    %esp,%ebp
+  80266b:	57                   	push   %edi
+  80266c:	56                   	push   %esi
+  80266d:	53                   	push   %ebx
+  80266e:	83 ec 28             	sub    $0x28,%esp
+  802671:	8b 75 08             	mov    0x8(%ebp),%esi
+  802674:	56                   	push   %esi
+  802675:	e8 bd ee ff ff       	call   801537 <fd2data>
+  80267a:	89 c3                	mov    %eax,%ebx
+  80267c:	83 c4 10             	add    $0x10,%esp
+  80267f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802684:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802688:	74 5c                	je     8026e6 <devpipe_write+0x7e>
+  80268a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80268d:	8b 0b                	mov    (%ebx),%ecx
+  80268f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802692:	39 d0                	cmp    %edx,%eax
+  802694:	72 1e                	jb     8026b4 <devpipe_write+0x4c>
+  802696:	89 da                	mov    %ebx,%edx
+  802698:	89 f0                	mov    %esi,%eax
+  80269a:	e8 64 ff ff ff       	call   802603 <_pipeisclosed>
+  80269f:	85 c0                	test   %eax,%eax
+  8026a1:	75 48                	jne    8026eb <devpipe_write+0x83>
+  8026a3:	e8 c6 e5 ff ff       	call   800c6e <sys_yield>
+  8026a8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026ab:	8b 0b                	mov    (%ebx),%ecx
+  8026ad:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026b0:	39 d0                	cmp    %edx,%eax
+  8026b2:	73 e2                	jae    802696 <devpipe_write+0x2e>
+  8026b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8026bb:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8026be:	89 c2                	mov    %eax,%edx
+  8026c0:	c1 fa 1f             	sar    $0x1f,%edx
+  8026c3:	89 d1                	mov    %edx,%ecx
+  8026c5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026c8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026cb:	83 e2 1f             	and    $0x1f,%edx
+  8026ce:	29 ca                	sub    %ecx,%edx
+  8026d0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026d4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8026d8:	83 c0 01             	add    $0x1,%eax
+  8026db:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026de:	83 c7 01             	add    $0x1,%edi
+  8026e1:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8026e4:	75 a4                	jne    80268a <devpipe_write+0x22>
+  8026e6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026e9:	eb 05                	jmp    8026f0 <devpipe_write+0x88>
+  8026eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f3:	5b                   	pop    %ebx
+  8026f4:	5e                   	pop    %esi
+  8026f5:	5f                   	pop    %edi
+  8026f6:	5d                   	pop    %ebp
+  8026f7:	c3                   	ret
+
+008026f8 <devpipe_read>:
+  8026f8:	55                   	push   %ebp
+  8026f9:	89 e5                	mov    %esp,%ebp
+  8026fb:	57                   	push   %edi
+  8026fc:	56                   	push   %esi
+  8026fd:	53                   	push   %ebx
+  8026fe:	83 ec 18             	sub    $0x18,%esp
+  802701:	8b 75 08             	mov    0x8(%ebp),%esi
+  802704:	56                   	push   %esi
+  802705:	e8 2d ee ff ff       	call   801537 <fd2data>
+  80270a:	89 c3                	mov    %eax,%ebx
+  80270c:	83 c4 10             	add    $0x10,%esp
+  80270f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802714:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802718:	74 45                	je     80275f <devpipe_read+0x67>
+  80271a:	8b 03                	mov    (%ebx),%eax
+  80271c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80271f:	75 1d                	jne    80273e <devpipe_read+0x46>
+  802721:	85 ff                	test   %edi,%edi
+  802723:	75 3f                	jne    802764 <devpipe_read+0x6c>
+  802725:	89 da                	mov    %ebx,%edx
+  802727:	89 f0                	mov    %esi,%eax
+  802729:	e8 d5 fe ff ff       	call   802603 <_pipeisclosed>
+  80272e:	85 c0                	test   %eax,%eax
+  802730:	75 3c                	jne    80276e <devpipe_read+0x76>
+  802732:	e8 37 e5 ff ff       	call   800c6e <sys_yield>
+  802737:	8b 03                	mov    (%ebx),%eax
+  802739:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80273c:	74 e7                	je     802725 <devpipe_read+0x2d>
+  80273e:	99                   	cltd
+  80273f:	c1 ea 1b             	shr    $0x1b,%edx
+  802742:	01 d0                	add    %edx,%eax
+  802744:	83 e0 1f             	and    $0x1f,%eax
+  802747:	29 d0                	sub    %edx,%eax
+  802749:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80274e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802751:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802754:	83 03 01             	addl   $0x1,(%ebx)
+  802757:	83 c7 01             	add    $0x1,%edi
+  80275a:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80275d:	75 bb                	jne    80271a <devpipe_read+0x22>
+  80275f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802762:	eb 02                	jmp    802766 <devpipe_read+0x6e>
+  802764:	89 f8                	mov    %edi,%eax
+  802766:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802769:	5b                   	pop    %ebx
+  80276a:	5e                   	pop    %esi
+  80276b:	5f                   	pop    %edi
+  80276c:	5d                   	pop    %ebp
+  80276d:	c3                   	ret
+  80276e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802773:	eb f1                	jmp    802766 <devpipe_read+0x6e>
+
+00802775 <pipe>:
+  802775:	55                   	push   %ebp
+  802776:	89 e5                	mov    %esp,%ebp
+  802778:	56                   	push   %esi
+  802779:	53                   	push   %ebx
+  80277a:	83 ec 1c             	sub    $0x1c,%esp
+  80277d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802780:	50                   	push   %eax
+  802781:	e8 c8 ed ff ff       	call   80154e <fd_alloc>
+  802786:	89 c3                	mov    %eax,%ebx
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	85 c0                	test   %eax,%eax
+  80278d:	0f 88 23 01 00 00    	js     8028b6 <pipe+0x141>
+  802793:	83 ec 04             	sub    $0x4,%esp
+  802796:	68 07 04 00 00       	push   $0x407
+  80279b:	ff 75 f4             	push   -0xc(%ebp)
+  80279e:	6a 00                	push   $0x0
+  8027a0:	e8 14 e5 ff ff       	call   800cb9 <sys_page_alloc>
+  8027a5:	89 c3                	mov    %eax,%ebx
+  8027a7:	83 c4 10             	add    $0x10,%esp
+  8027aa:	85 c0                	test   %eax,%eax
+  8027ac:	0f 88 04 01 00 00    	js     8028b6 <pipe+0x141>
+  8027b2:	83 ec 0c             	sub    $0xc,%esp
+  8027b5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027b8:	50                   	push   %eax
+  8027b9:	e8 90 ed ff ff       	call   80154e <fd_alloc>
+  8027be:	89 c3                	mov    %eax,%ebx
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	0f 88 db 00 00 00    	js     8028a6 <pipe+0x131>
+  8027cb:	83 ec 04             	sub    $0x4,%esp
+  8027ce:	68 07 04 00 00       	push   $0x407
+  8027d3:	ff 75 f0             	push   -0x10(%ebp)
+  8027d6:	6a 00                	push   $0x0
+  8027d8:	e8 dc e4 ff ff       	call   800cb9 <sys_page_alloc>
+  8027dd:	89 c3                	mov    %eax,%ebx
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	0f 88 bc 00 00 00    	js     8028a6 <pipe+0x131>
+  8027ea:	83 ec 0c             	sub    $0xc,%esp
+  8027ed:	ff 75 f4             	push   -0xc(%ebp)
+  8027f0:	e8 42 ed ff ff       	call   801537 <fd2data>
+  8027f5:	89 c6                	mov    %eax,%esi
+  8027f7:	83 c4 0c             	add    $0xc,%esp
+  8027fa:	68 07 04 00 00       	push   $0x407
+  8027ff:	50                   	push   %eax
+  802800:	6a 00                	push   $0x0
+  802802:	e8 b2 e4 ff ff       	call   800cb9 <sys_page_alloc>
+  802807:	89 c3                	mov    %eax,%ebx
+  802809:	83 c4 10             	add    $0x10,%esp
+  80280c:	85 c0                	test   %eax,%eax
+  80280e:	0f 88 82 00 00 00    	js     802896 <pipe+0x121>
+  802814:	83 ec 0c             	sub    $0xc,%esp
+  802817:	ff 75 f0             	push   -0x10(%ebp)
+  80281a:	e8 18 ed ff ff       	call   801537 <fd2data>
+  80281f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802826:	50                   	push   %eax
+  802827:	6a 00                	push   $0x0
+  802829:	56                   	push   %esi
+  80282a:	6a 00                	push   $0x0
+  80282c:	e8 cb e4 ff ff       	call   800cfc <sys_page_map>
+  802831:	89 c3                	mov    %eax,%ebx
+  802833:	83 c4 20             	add    $0x20,%esp
+  802836:	85 c0                	test   %eax,%eax
+  802838:	78 4e                	js     802888 <pipe+0x113>
+  80283a:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80283f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802842:	89 02                	mov    %eax,(%edx)
+  802844:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802847:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80284e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802851:	89 02                	mov    %eax,(%edx)
+  802853:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802856:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80285d:	83 ec 0c             	sub    $0xc,%esp
+  802860:	ff 75 f4             	push   -0xc(%ebp)
+  802863:	e8 bf ec ff ff       	call   801527 <fd2num>
+  802868:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80286b:	89 01                	mov    %eax,(%ecx)
+  80286d:	83 c4 04             	add    $0x4,%esp
+  802870:	ff 75 f0             	push   -0x10(%ebp)
+  802873:	e8 af ec ff ff       	call   801527 <fd2num>
+  802878:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80287b:	89 41 04             	mov    %eax,0x4(%ecx)
+  80287e:	83 c4 10             	add    $0x10,%esp
+  802881:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802886:	eb 2e                	jmp    8028b6 <pipe+0x141>
+  802888:	83 ec 08             	sub    $0x8,%esp
+  80288b:	56                   	push   %esi
+  80288c:	6a 00                	push   $0x0
+  80288e:	e8 f8 e4 ff ff       	call   800d8b <sys_page_unmap>
+  802893:	83 c4 10             	add    $0x10,%esp
+  802896:	83 ec 08             	sub    $0x8,%esp
+  802899:	ff 75 f0             	push   -0x10(%ebp)
+  80289c:	6a 00                	push   $0x0
+  80289e:	e8 e8 e4 ff ff       	call   800d8b <sys_page_unmap>
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  8028a6:	83 ec 08             	sub    $0x8,%esp
+  8028a9:	ff 75 f4             	push   -0xc(%ebp)
+  8028ac:	6a 00                	push   $0x0
+  8028ae:	e8 d8 e4 ff ff       	call   800d8b <sys_page_unmap>
+  8028b3:	83 c4 10             	add    $0x10,%esp
+  8028b6:	89 d8                	mov    %ebx,%eax
+  8028b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028bb:	5b                   	pop    %ebx
+  8028bc:	5e                   	pop    %esi
+  8028bd:	5d                   	pop    %ebp
+  8028be:	c3                   	ret
+
+008028bf <pipeisclosed>:
+  8028bf:	55                   	push   %ebp
+  8028c0:	89 e5                	mov    %esp,%ebp
+  8028c2:	83 ec 20             	sub    $0x20,%esp
+  8028c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028c8:	50                   	push   %eax
+  8028c9:	ff 75 08             	push   0x8(%ebp)
+  8028cc:	e8 cd ec ff ff       	call   80159e <fd_lookup>
+  8028d1:	83 c4 10             	add    $0x10,%esp
+  8028d4:	85 c0                	test   %eax,%eax
+  8028d6:	78 18                	js     8028f0 <pipeisclosed+0x31>
+  8028d8:	83 ec 0c             	sub    $0xc,%esp
+  8028db:	ff 75 f4             	push   -0xc(%ebp)
+  8028de:	e8 54 ec ff ff       	call   801537 <fd2data>
+  8028e3:	89 c2                	mov    %eax,%edx
+  8028e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028e8:	e8 16 fd ff ff       	call   802603 <_pipeisclosed>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+  8028f0:	c9                   	leave
+  8028f1:	c3                   	ret
+
+008028f2 <ipcring_init>:
+  8028f2:	55                   	push   %ebp
+  8028f3:	89 e5                	mov    %esp,%ebp
+  8028f5:	53                   	push   %ebx
+  8028f6:	83 ec 08             	sub    $0x8,%esp
+  8028f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028fc:	6a 60                	push   $0x60
+  8028fe:	6a 00                	push   $0x0
+  802900:	53                   	push   %ebx
+  802901:	e8 ce e0 ff ff       	call   8009d4 <memset>
+  802906:	a1 14 50 80 00       	mov    0x805014,%eax
+  80290b:	8b 40 48             	mov    0x48(%eax),%eax
+  80290e:	89 03                	mov    %eax,(%ebx)
+  802910:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802913:	89 43 04             	mov    %eax,0x4(%ebx)
+  802916:	8b 45 10             	mov    0x10(%ebp),%eax
+  802919:	89 43 08             	mov    %eax,0x8(%ebx)
+  80291c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80291f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802922:	83 c4 10             	add    $0x10,%esp
+  802925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802928:	c9                   	leave
+  802929:	c3                   	ret
+
+0080292a <ipcring_req_slot>:
+  80292a:	55                   	push   %ebp
+  80292b:	89 e5                	mov    %esp,%ebp
+  80292d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802930:	8b 50 10             	mov    0x10(%eax),%edx
+  802933:	8b 48 18             	mov    0x18(%eax),%ecx
+  802936:	29 ca                	sub    %ecx,%edx
+  802938:	83 fa 07             	cmp    $0x7,%edx
+  80293b:	77 0c                	ja     802949 <ipcring_req_slot+0x1f>
+  80293d:	8b 50 10             	mov    0x10(%eax),%edx
+  802940:	83 e2 07             	and    $0x7,%edx
+  802943:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802947:	5d                   	pop    %ebp
+  802948:	c3                   	ret
+  802949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294e:	eb f7                	jmp    802947 <ipcring_req_slot+0x1d>
+
+00802950 <ipcring_req_push>:
+  802950:	55                   	push   %ebp
+  802951:	89 e5                	mov    %esp,%ebp
+  802953:	83 ec 08             	sub    $0x8,%esp
+  802956:	8b 55 08             	mov    0x8(%ebp),%edx
+  802959:	8b 42 10             	mov    0x10(%edx),%eax
+  80295c:	83 c0 01             	add    $0x1,%eax
+  80295f:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802963:	b8 00 00 00 00       	mov    $0x0,%eax
+  802968:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	75 02                	jne    802972 <ipcring_req_push+0x22>
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+  802972:	6a 00                	push   $0x0
+  802974:	68 00 00 80 ee       	push   $0xee800000
+  802979:	ff 72 08             	push   0x8(%edx)
+  80297c:	ff 72 04             	push   0x4(%edx)
+  80297f:	e8 6d e6 ff ff       	call   800ff1 <sys_ipc_send>
+  802984:	83 c4 10             	add    $0x10,%esp
+  802987:	eb e7                	jmp    802970 <ipcring_req_push+0x20>
+
+00802989 <ipcring_rsp_wait>:
+  802989:	55                   	push   %ebp
+  80298a:	89 e5                	mov    %esp,%ebp
+  80298c:	53                   	push   %ebx
+  80298d:	83 ec 04             	sub    $0x4,%esp
+  802990:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802993:	8b 53 18             	mov    0x18(%ebx),%edx
+  802996:	8b 43 10             	mov    0x10(%ebx),%eax
+  802999:	39 c2                	cmp    %eax,%edx
+  80299b:	74 3c                	je     8029d9 <ipcring_rsp_wait+0x50>
+  80299d:	8b 53 14             	mov    0x14(%ebx),%edx
+  8029a0:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029a3:	39 c2                	cmp    %eax,%edx
+  8029a5:	75 23                	jne    8029ca <ipcring_rsp_wait+0x41>
+  8029a7:	83 ec 08             	sub    $0x8,%esp
+  8029aa:	6a 00                	push   $0x0
+  8029ac:	6a 00                	push   $0x0
+  8029ae:	6a 00                	push   $0x0
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	ff 73 0c             	push   0xc(%ebx)
+  8029b5:	ff 73 04             	push   0x4(%ebx)
+  8029b8:	e8 c7 03 00 00       	call   802d84 <ipc_call>
+  8029bd:	8b 53 14             	mov    0x14(%ebx),%edx
+  8029c0:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029c3:	83 c4 20             	add    $0x20,%esp
+  8029c6:	39 c2                	cmp    %eax,%edx
+  8029c8:	74 dd                	je     8029a7 <ipcring_rsp_wait+0x1e>
+  8029ca:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029cd:	83 e0 07             	and    $0x7,%eax
+  8029d0:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8029d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029d7:	c9                   	leave
+  8029d8:	c3                   	ret
+  8029d9:	68 d8 35 80 00       	push   $0x8035d8
+  8029de:	68 89 35 80 00       	push   $0x803589
+  8029e3:	6a 3b                	push   $0x3b
+  8029e5:	68 f9 35 80 00       	push   $0x8035f9
+  8029ea:	e8 97 02 00 00       	call   802c86 <_panic>
+
+008029ef <ipcring_rsp_pop>:
+  8029ef:	55                   	push   %ebp
+  8029f0:	89 e5                	mov    %esp,%ebp
+  8029f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029f5:	8b 42 18             	mov    0x18(%edx),%eax
+  8029f8:	83 c0 01             	add    $0x1,%eax
+  8029fb:	89 42 18             	mov    %eax,0x18(%edx)
+  8029fe:	5d                   	pop    %ebp
+  8029ff:	c3                   	ret
+
+00802a00 <ipcring_server_init>:
+  802a00:	55                   	push   %ebp
+  802a01:	89 e5                	mov    %esp,%ebp
+  802a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a09:	89 10                	mov    %edx,(%eax)
+  802a0b:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a0e:	89 50 04             	mov    %edx,0x4(%eax)
+  802a11:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802a18:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802a1f:	5d                   	pop    %ebp
+  802a20:	c3                   	ret
+
+00802a21 <ipcring_req_avail>:
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a27:	8b 02                	mov    (%edx),%eax
+  802a29:	8b 40 10             	mov    0x10(%eax),%eax
+  802a2c:	2b 42 08             	sub    0x8(%edx),%eax
+  802a2f:	ba 08 00 00 00       	mov    $0x8,%edx
+  802a34:	39 d0                	cmp    %edx,%eax
+  802a36:	0f 47 c2             	cmova  %edx,%eax
+  802a39:	5d                   	pop    %ebp
+  802a3a:	c3                   	ret
+
+00802a3b <ipcring_req_peek>:
+  802a3b:	55                   	push   %ebp
+  802a3c:	89 e5                	mov    %esp,%ebp
+  802a3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a41:	8b 42 08             	mov    0x8(%edx),%eax
+  802a44:	83 e0 07             	and    $0x7,%eax
+  802a47:	8b 12                	mov    (%edx),%edx
+  802a49:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802a4d:	5d                   	pop    %ebp
+  802a4e:	c3                   	ret
+
+00802a4f <ipcring_rsp_push>:
+  802a4f:	55                   	push   %ebp
+  802a50:	89 e5                	mov    %esp,%ebp
+  802a52:	83 ec 08             	sub    $0x8,%esp
+  802a55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a58:	8b 41 08             	mov    0x8(%ecx),%eax
+  802a5b:	83 c0 01             	add    $0x1,%eax
+  802a5e:	89 41 08             	mov    %eax,0x8(%ecx)
+  802a61:	8b 11                	mov    (%ecx),%edx
+  802a63:	83 c2 14             	add    $0x14,%edx
+  802a66:	f0 87 02             	lock xchg %eax,(%edx)
+  802a69:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802a6d:	75 02                	jne    802a71 <ipcring_rsp_push+0x22>
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+  802a71:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802a78:	6a 00                	push   $0x0
+  802a7a:	68 00 00 80 ee       	push   $0xee800000
+  802a7f:	6a 00                	push   $0x0
+  802a81:	ff 71 04             	push   0x4(%ecx)
+  802a84:	e8 8b e4 ff ff       	call   800f14 <sys_ipc_try_send>
+  802a89:	83 c4 10             	add    $0x10,%esp
+  802a8c:	eb e1                	jmp    802a6f <ipcring_rsp_push+0x20>
+
+00802a8e <ipcring_client_wait>:
+  802a8e:	55                   	push   %ebp
+  802a8f:	89 e5                	mov    %esp,%ebp
+  802a91:	83 ec 08             	sub    $0x8,%esp
+  802a94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a97:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802a9e:	8b 10                	mov    (%eax),%edx
+  802aa0:	8b 52 18             	mov    0x18(%edx),%edx
+  802aa3:	3b 50 08             	cmp    0x8(%eax),%edx
+  802aa6:	75 02                	jne    802aaa <ipcring_client_wait+0x1c>
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+  802aaa:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802ab1:	6a 00                	push   $0x0
+  802ab3:	68 00 00 80 ee       	push   $0xee800000
+  802ab8:	6a 00                	push   $0x0
+  802aba:	ff 70 04             	push   0x4(%eax)
+  802abd:	e8 52 e4 ff ff       	call   800f14 <sys_ipc_try_send>
+  802ac2:	83 c4 10             	add    $0x10,%esp
+  802ac5:	eb e1                	jmp    802aa8 <ipcring_client_wait+0x1a>
+
+00802ac7 <ipcring_server_sleep>:
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	53                   	push   %ebx
+  802acb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ace:	8b 01                	mov    (%ecx),%eax
+  802ad0:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802ad3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ad8:	f0 87 02             	lock xchg %eax,(%edx)
+  802adb:	8b 11                	mov    (%ecx),%edx
+  802add:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802ae0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ae5:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802ae8:	74 0e                	je     802af8 <ipcring_server_sleep+0x31>
+  802aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aef:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802af3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afb:	c9                   	leave
+  802afc:	c3                   	ret
+
+00802afd <devcons_close>:
+  802afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b02:	c3                   	ret
+
+00802b03 <devcons_stat>:
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	83 ec 10             	sub    $0x10,%esp
+  802b09:	68 07 36 80 00       	push   $0x803607
+  802b0e:	ff 75 0c             	push   0xc(%ebp)
+  802b11:	e8 43 dd ff ff       	call   800859 <strcpy>
+  802b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <devcons_write>:
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	57                   	push   %edi
+  802b21:	56                   	push   %esi
+  802b22:	53                   	push   %ebx
+  802b23:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802b29:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802b2c:	85 ff                	test   %edi,%edi
+  802b2e:	74 51                	je     802b81 <devcons_write+0x64>
+  802b30:	be 00 00 00 00       	mov    $0x0,%esi
+  802b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3a:	89 fb                	mov    %edi,%ebx
+  802b3c:	29 c3                	sub    %eax,%ebx
+  802b3e:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802b43:	39 d3                	cmp    %edx,%ebx
+  802b45:	0f 47 da             	cmova  %edx,%ebx
+  802b48:	83 ec 04             	sub    $0x4,%esp
+  802b4b:	53                   	push   %ebx
+  802b4c:	03 45 0c             	add    0xc(%ebp),%eax
+  802b4f:	50                   	push   %eax
+  802b50:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802b56:	50                   	push   %eax
+  802b57:	e8 ad de ff ff       	call   800a09 <memmove>
+  802b5c:	83 c4 08             	add    $0x8,%esp
+  802b5f:	53                   	push   %ebx
+  802b60:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802b66:	50                   	push   %eax
+  802b67:	e8 65 e0 ff ff       	call   800bd1 <sys_cputs>
+  802b6c:	01 de                	add    %ebx,%esi
+  802b6e:	89 f0                	mov    %esi,%eax
+  802b70:	83 c4 10             	add    $0x10,%esp
+  802b73:	39 fe                	cmp    %edi,%esi
+  802b75:	72 c3                	jb     802b3a <devcons_write+0x1d>
+  802b77:	89 f0                	mov    %esi,%eax
+  802b79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7c:	5b                   	pop    %ebx
+  802b7d:	5e                   	pop    %esi
+  802b7e:	5f                   	pop    %edi
+  802b7f:	5d                   	pop    %ebp
+  802b80:	c3                   	ret
+  802b81:	be 00 00 00 00       	mov    $0x0,%esi
+  802b86:	eb ef                	jmp    802b77 <devcons_write+0x5a>
+
+00802b88 <devcons_read>:
+  802b88:	55                   	push   %ebp
+  802b89:	89 e5                	mov    %esp,%ebp
+  802b8b:	83 ec 08             	sub    $0x8,%esp
+  802b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b93:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b97:	75 07                	jne    802ba0 <devcons_read+0x18>
+  802b99:	eb 1f                	jmp    802bba <devcons_read+0x32>
+  802b9b:	e8 ce e0 ff ff       	call   800c6e <sys_yield>
+  802ba0:	e8 4a e0 ff ff       	call   800bef <sys_cgetc>
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	74 f2                	je     802b9b <devcons_read+0x13>
+  802ba9:	78 0f                	js     802bba <devcons_read+0x32>
+  802bab:	83 f8 04             	cmp    $0x4,%eax
+  802bae:	74 0c                	je     802bbc <devcons_read+0x34>
+  802bb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bb3:	88 02                	mov    %al,(%edx)
+  802bb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bba:	c9                   	leave
+  802bbb:	c3                   	ret
+  802bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc1:	eb f7                	jmp    802bba <devcons_read+0x32>
+
+00802bc3 <cputchar>:
+  802bc3:	55                   	push   %ebp
+  802bc4:	89 e5                	mov    %esp,%ebp
+  802bc6:	83 ec 20             	sub    $0x20,%esp
+  802bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcc:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802bcf:	6a 01                	push   $0x1
+  802bd1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bd4:	50                   	push   %eax
+  802bd5:	e8 f7 df ff ff       	call   800bd1 <sys_cputs>
+  802bda:	83 c4 10             	add    $0x10,%esp
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+
+00802bdf <getchar>:
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	83 ec 1c             	sub    $0x1c,%esp
+  802be5:	6a 01                	push   $0x1
+  802be7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bea:	50                   	push   %eax
+  802beb:	6a 00                	push   $0x0
+  802bed:	e8 0e ec ff ff       	call   801800 <read>
+  802bf2:	83 c4 10             	add    $0x10,%esp
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	78 06                	js     802bff <getchar+0x20>
+  802bf9:	74 06                	je     802c01 <getchar+0x22>
+  802bfb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802bff:	c9                   	leave
+  802c00:	c3                   	ret
+  802c01:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c06:	eb f7                	jmp    802bff <getchar+0x20>
+
+00802c08 <iscons>:
+  802c08:	55                   	push   %ebp
+  802c09:	89 e5                	mov    %esp,%ebp
+  802c0b:	83 ec 20             	sub    $0x20,%esp
+  802c0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c11:	50                   	push   %eax
+  802c12:	ff 75 08             	push   0x8(%ebp)
+  802c15:	e8 84 e9 ff ff       	call   80159e <fd_lookup>
+  802c1a:	83 c4 10             	add    $0x10,%esp
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	78 11                	js     802c32 <iscons+0x2a>
+  802c21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c24:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c2a:	39 10                	cmp    %edx,(%eax)
+  802c2c:	0f 94 c0             	sete   %al
+  802c2f:	0f b6 c0             	movzbl %al,%eax
+  802c32:	c9                   	leave
+  802c33:	c3                   	ret
+
+00802c34 <opencons>:
+  802c34:	55                   	push   %ebp
+  802c35:	89 e5                	mov    %esp,%ebp
+  802c37:	83 ec 24             	sub    $0x24,%esp
+  802c3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c3d:	50                   	push   %eax
+  802c3e:	e8 0b e9 ff ff       	call   80154e <fd_alloc>
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	85 c0                	test   %eax,%eax
+  802c48:	78 3a                	js     802c84 <opencons+0x50>
+  802c4a:	83 ec 04             	sub    $0x4,%esp
+  802c4d:	68 07 04 00 00       	push   $0x407
+  802c52:	ff 75 f4             	push   -0xc(%ebp)
+  802c55:	6a 00                	push   $0x0
+  802c57:	e8 5d e0 ff ff       	call   800cb9 <sys_page_alloc>
+  802c5c:	83 c4 10             	add    $0x10,%esp
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	78 21                	js     802c84 <opencons+0x50>
+  802c63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c66:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c6c:	89 10                	mov    %edx,(%eax)
+  802c6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c71:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c78:	83 ec 0c             	sub    $0xc,%esp
+  802c7b:	50                   	push   %eax
+  802c7c:	e8 a6 e8 ff ff       	call   801527 <fd2num>
+  802c81:	83 c4 10             	add    $0x10,%esp
+  802c84:	c9                   	leave
+  802c85:	c3                   	ret
+
+00802c86 <_panic>:
+  802c86:	55                   	push   %ebp
+  802c87:	89 e5                	mov    %esp,%ebp
+  802c89:	56                   	push   %esi
+  802c8a:	53                   	push   %ebx
+  802c8b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802c8e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802c94:	e8 b6 df ff ff       	call   800c4f <sys_getenvid>
+  802c99:	83 ec 0c             	sub    $0xc,%esp
+  802c9c:	ff 75 0c             	push   0xc(%ebp)
+  802c9f:	ff 75 08             	push   0x8(%ebp)
+  802ca2:	56                   	push   %esi
+  802ca3:	50                   	push   %eax
+  802ca4:	68 14 36 80 00       	push   $0x803614
+  802ca9:	e8 b4 d4 ff ff       	call   800162 <cprintf>
+  802cae:	83 c4 18             	add    $0x18,%esp
+  802cb1:	53                   	push   %ebx
+  802cb2:	ff 75 10             	push   0x10(%ebp)
+  802cb5:	e8 57 d4 ff ff       	call   800111 <vcprintf>
+  802cba:	c7 04 24 8c 31 80 00 	movl   $0x80318c,(%esp)
+  802cc1:	e8 9c d4 ff ff       	call   800162 <cprintf>
+  802cc6:	83 c4 10             	add    $0x10,%esp
+  802cc9:	cc                   	int3
+  802cca:	eb fd                	jmp    802cc9 <_panic+0x43>
+
+00802ccc <ipc_recv>:
+  802ccc:	55                   	push   %ebp
+  802ccd:	89 e5                	mov    %esp,%ebp
+  802ccf:	56                   	push   %esi
+  802cd0:	53                   	push   %ebx
+  802cd1:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cda:	85 c0                	test   %eax,%eax
+  802cdc:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802ce1:	0f 44 c2             	cmove  %edx,%eax
+  802ce4:	83 ec 0c             	sub    $0xc,%esp
+  802ce7:	50                   	push   %eax
+  802ce8:	e8 77 e2 ff ff       	call   800f64 <sys_ipc_recv>
+  802ced:	83 c4 10             	add    $0x10,%esp
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	78 2a                	js     802d1e <ipc_recv+0x52>
+  802cf4:	a1 14 50 80 00       	mov    0x805014,%eax
+  802cf9:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802cff:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802d05:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d0b:	85 f6                	test   %esi,%esi
+  802d0d:	74 02                	je     802d11 <ipc_recv+0x45>
+  802d0f:	89 0e                	mov    %ecx,(%esi)
+  802d11:	85 db                	test   %ebx,%ebx
+  802d13:	74 02                	je     802d17 <ipc_recv+0x4b>
+  802d15:	89 13                	mov    %edx,(%ebx)
+  802d17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d1a:	5b                   	pop    %ebx
+  802d1b:	5e                   	pop    %esi
+  802d1c:	5d                   	pop    %ebp
+  802d1d:	c3                   	ret
+  802d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d28:	eb e1                	jmp    802d0b <ipc_recv+0x3f>
+
+00802d2a <ipc_send>:
+  802d2a:	55                   	push   %ebp
+  802d2b:	89 e5                	mov    %esp,%ebp
+  802d2d:	57                   	push   %edi
+  802d2e:	56                   	push   %esi
+  802d2f:	53                   	push   %ebx
+  802d30:	83 ec 0c             	sub    $0xc,%esp
+  802d33:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d39:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d3c:	85 db                	test   %ebx,%ebx
+  802d3e:	74 1e                	je     802d5e <ipc_send+0x34>
+  802d40:	56                   	push   %esi
+  802d41:	53                   	push   %ebx
+  802d42:	57                   	push   %edi
+  802d43:	ff 75 08             	push   0x8(%ebp)
+  802d46:	e8 a6 e2 ff ff       	call   800ff1 <sys_ipc_send>
+  802d4b:	83 c4 10             	add    $0x10,%esp
+  802d4e:	85 c0                	test   %eax,%eax
+  802d50:	74 2a                	je     802d7c <ipc_send+0x52>
+  802d52:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d55:	75 13                	jne    802d6a <ipc_send+0x40>
+  802d57:	e8 12 df ff ff       	call   800c6e <sys_yield>
+  802d5c:	eb e2                	jmp    802d40 <ipc_send+0x16>
+  802d5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d63:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d68:	eb d6                	jmp    802d40 <ipc_send+0x16>
+  802d6a:	50                   	push   %eax
+  802d6b:	68 38 36 80 00       	push   $0x803638
+  802d70:	6a 4f                	push   $0x4f
+  802d72:	68 7b 36 80 00       	push   $0x80367b
+  802d77:	e8 0a ff ff ff       	call   802c86 <_panic>
+  802d7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d7f:	5b                   	pop    %ebx
+  802d80:	5e                   	pop    %esi
+  802d81:	5f                   	pop    %edi
+  802d82:	5d                   	pop    %ebp
+  802d83:	c3                   	ret
+
+00802d84 <ipc_call>:
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+  802d87:	57                   	push   %edi
+  802d88:	56                   	push   %esi
+  802d89:	53                   	push   %ebx
+  802d8a:	83 ec 0c             	sub    $0xc,%esp
+  802d8d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d91:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d96:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d9a:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d9e:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802da3:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802da7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802db0:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802db4:	eb 05                	jmp    802dbb <ipc_call+0x37>
+  802db6:	e8 b3 de ff ff       	call   800c6e <sys_yield>
+  802dbb:	83 ec 0c             	sub    $0xc,%esp
+  802dbe:	56                   	push   %esi
+  802dbf:	53                   	push   %ebx
+  802dc0:	57                   	push   %edi
+  802dc1:	ff 75 0c             	push   0xc(%ebp)
+  802dc4:	ff 75 08             	push   0x8(%ebp)
+  802dc7:	e8 75 e2 ff ff       	call   801041 <sys_ipc_call>
+  802dcc:	83 c4 20             	add    $0x20,%esp
+  802dcf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dd2:	74 e2                	je     802db6 <ipc_call+0x32>
+  802dd4:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802dd7:	74 2d                	je     802e06 <ipc_call+0x82>
+  802dd9:	85 c0                	test   %eax,%eax
+  802ddb:	78 4f                	js     802e2c <ipc_call+0xa8>
+  802ddd:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802de1:	74 10                	je     802df3 <ipc_call+0x6f>
+  802de3:	a1 14 50 80 00       	mov    0x805014,%eax
+  802de8:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802dee:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802df1:	89 02                	mov    %eax,(%edx)
+  802df3:	a1 14 50 80 00       	mov    0x805014,%eax
+  802df8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802dfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e01:	5b                   	pop    %ebx
+  802e02:	5e                   	pop    %esi
+  802e03:	5f                   	pop    %edi
+  802e04:	5d                   	pop    %ebp
+  802e05:	c3                   	ret
+  802e06:	ff 75 14             	push   0x14(%ebp)
+  802e09:	ff 75 10             	push   0x10(%ebp)
+  802e0c:	ff 75 0c             	push   0xc(%ebp)
+  802e0f:	ff 75 08             	push   0x8(%ebp)
+  802e12:	e8 13 ff ff ff       	call   802d2a <ipc_send>
+  802e17:	83 c4 0c             	add    $0xc,%esp
+  802e1a:	ff 75 1c             	push   0x1c(%ebp)
+  802e1d:	ff 75 18             	push   0x18(%ebp)
+  802e20:	6a 00                	push   $0x0
+  802e22:	e8 a5 fe ff ff       	call   802ccc <ipc_recv>
+  802e27:	83 c4 10             	add    $0x10,%esp
+  802e2a:	eb d2                	jmp    802dfe <ipc_call+0x7a>
+  802e2c:	50                   	push   %eax
+  802e2d:	68 85 36 80 00       	push   $0x803685
+  802e32:	6a 6d                	push   $0x6d
+  802e34:	68 7b 36 80 00       	push   $0x80367b
+  802e39:	e8 48 fe ff ff       	call   802c86 <_panic>
+
+00802e3e <ipc_reply_recv>:
+  802e3e:	55                   	push   %ebp
+  802e3f:	89 e5                	mov    %esp,%ebp
+  802e41:	57                   	push   %edi
+  802e42:	56                   	push   %esi
+  802e43:	53                   	push   %ebx
+  802e44:	83 ec 0c             	sub    $0xc,%esp
+  802e47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e4a:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e4d:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e50:	85 db                	test   %ebx,%ebx
+  802e52:	0f 84 ac 00 00 00    	je     802f04 <ipc_reply_recv+0xc6>
+  802e58:	85 f6                	test   %esi,%esi
+  802e5a:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e5f:	0f 45 c6             	cmovne %esi,%eax
+  802e62:	83 ec 0c             	sub    $0xc,%esp
+  802e65:	50                   	push   %eax
+  802e66:	ff 75 14             	push   0x14(%ebp)
+  802e69:	53                   	push   %ebx
+  802e6a:	ff 75 0c             	push   0xc(%ebp)
+  802e6d:	ff 75 08             	push   0x8(%ebp)
+  802e70:	e8 ed e1 ff ff       	call   801062 <sys_ipc_reply_recv>
+  802e75:	83 c4 20             	add    $0x20,%esp
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	78 3a                	js     802eb6 <ipc_reply_recv+0x78>
+  802e7c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e80:	74 10                	je     802e92 <ipc_reply_recv+0x54>
+  802e82:	a1 14 50 80 00       	mov    0x805014,%eax
+  802e87:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e8d:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e90:	89 02                	mov    %eax,(%edx)
+  802e92:	85 ff                	test   %edi,%edi
+  802e94:	74 0d                	je     802ea3 <ipc_reply_recv+0x65>
+  802e96:	a1 14 50 80 00       	mov    0x805014,%eax
+  802e9b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802ea1:	89 07                	mov    %eax,(%edi)
+  802ea3:	a1 14 50 80 00       	mov    0x805014,%eax
+  802ea8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eb1:	5b                   	pop    %ebx
+  802eb2:	5e                   	pop    %esi
+  802eb3:	5f                   	pop    %edi
+  802eb4:	5d                   	pop    %ebp
+  802eb5:	c3                   	ret
+  802eb6:	ff 75 14             	push   0x14(%ebp)
+  802eb9:	53                   	push   %ebx
+  802eba:	ff 75 0c             	push   0xc(%ebp)
+  802ebd:	ff 75 08             	push   0x8(%ebp)
+  802ec0:	e8 4f e0 ff ff       	call   800f14 <sys_ipc_try_send>
+  802ec5:	89 c2                	mov    %eax,%edx
+  802ec7:	c1 ea 1f             	shr    $0x1f,%edx
+  802eca:	83 c4 10             	add    $0x10,%esp
+  802ecd:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802ed0:	0f 95 c1             	setne  %cl
+  802ed3:	84 d1                	test   %dl,%cl
+  802ed5:	74 05                	je     802edc <ipc_reply_recv+0x9e>
+  802ed7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802eda:	75 12                	jne    802eee <ipc_reply_recv+0xb0>
+  802edc:	83 ec 04             	sub    $0x4,%esp
+  802edf:	57                   	push   %edi
+  802ee0:	56                   	push   %esi
+  802ee1:	ff 75 18             	push   0x18(%ebp)
+  802ee4:	e8 e3 fd ff ff       	call   802ccc <ipc_recv>
+  802ee9:	83 c4 10             	add    $0x10,%esp
+  802eec:	eb c0                	jmp    802eae <ipc_reply_recv+0x70>
+  802eee:	83 ec 04             	sub    $0x4,%esp
+  802ef1:	50                   	push   %eax
+  802ef2:	ff 75 08             	push   0x8(%ebp)
+  802ef5:	68 58 36 80 00       	push   $0x803658
+  802efa:	e8 63 d2 ff ff       	call   800162 <cprintf>
+  802eff:	83 c4 10             	add    $0x10,%esp
+  802f02:	eb d8                	jmp    802edc <ipc_reply_recv+0x9e>
+  802f04:	85 f6                	test   %esi,%esi
+  802f06:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f0b:	0f 45 c6             	cmovne %esi,%eax
+  802f0e:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f13:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f1a:	e9 43 ff ff ff       	jmp    802e62 <ipc_reply_recv+0x24>
+
+00802f1f <ipc_find_env>:
+  802f1f:	55                   	push   %ebp
+  802f20:	89 e5                	mov    %esp,%ebp
+  802f22:	83 ec 14             	sub    $0x14,%esp
+  802f25:	ff 75 08             	push   0x8(%ebp)
+  802f28:	e8 85 df ff ff       	call   800eb2 <sys_env_service>
+  802f2d:	85 c0                	test   %eax,%eax
+  802f2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f34:	0f 48 c2             	cmovs  %edx,%eax
+  802f37:	c9                   	leave
+  802f38:	c3                   	ret
+
+00802f39 <pageref>:
+  802f39:	55                   	push   %ebp
+  802f3a:	89 e5                	mov    %esp,%ebp
+  802f3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f3f:	89 c2                	mov    %eax,%edx
+  802f41:	c1 ea 16             	shr    $0x16,%edx
+  802f44:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f50:	f6 c1 01             	test   $0x1,%cl
+  802f53:	74 22                	je     802f77 <pageref+0x3e>
+  802f55:	c1 e8 0c             	shr    $0xc,%eax
+  802f58:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f5f:	a8 01                	test   $0x1,%al
+  802f61:	74 14                	je     802f77 <pageref+0x3e>
+  802f63:	c1 e8 0c             	shr    $0xc,%eax
+  802f66:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f69:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f70:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f74:	0f b7 d2             	movzwl %dx,%edx
+  802f77:	89 d0                	mov    %edx,%eax
+  802f79:	5d                   	pop    %ebp
+  802f7a:	c3                   	ret
+
+00802f7b <__udivmoddi4>:
+  802f7b:	55                   	push   %ebp
+  802f7c:	57                   	push   %edi
+  802f7d:	56                   	push   %esi
+  802f7e:	53                   	push   %ebx
+  802f7f:	83 ec 24             	sub    $0x24,%esp
+  802f82:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f86:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f8a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f8e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f92:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f96:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f9a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f9e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802fa2:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fb5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fbc:	00 
+  802fbd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fc4:	00 
+  802fc5:	89 fb                	mov    %edi,%ebx
+  802fc7:	eb 08                	jmp    802fd1 <__udivmoddi4+0x56>
+  802fc9:	83 e9 01             	sub    $0x1,%ecx
+  802fcc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fcf:	74 68                	je     803039 <__udivmoddi4+0xbe>
+  802fd1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fd5:	01 c0                	add    %eax,%eax
+  802fd7:	89 c6                	mov    %eax,%esi
+  802fd9:	89 d7                	mov    %edx,%edi
+  802fdb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fdf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fe3:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fe6:	d3 ea                	shr    %cl,%edx
+  802fe8:	f6 c1 20             	test   $0x20,%cl
+  802feb:	74 04                	je     802ff1 <__udivmoddi4+0x76>
+  802fed:	89 d0                	mov    %edx,%eax
+  802fef:	31 d2                	xor    %edx,%edx
+  802ff1:	83 e0 01             	and    $0x1,%eax
+  802ff4:	89 04 24             	mov    %eax,(%esp)
+  802ff7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ffe:	00 
+  802fff:	8b 04 24             	mov    (%esp),%eax
+  803002:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803006:	09 f0                	or     %esi,%eax
+  803008:	09 fa                	or     %edi,%edx
+  80300a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80300e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803012:	39 f0                	cmp    %esi,%eax
+  803014:	89 d5                	mov    %edx,%ebp
+  803016:	19 fd                	sbb    %edi,%ebp
+  803018:	72 af                	jb     802fc9 <__udivmoddi4+0x4e>
+  80301a:	29 f0                	sub    %esi,%eax
+  80301c:	19 fa                	sbb    %edi,%edx
+  80301e:	89 cf                	mov    %ecx,%edi
+  803020:	c1 ef 05             	shr    $0x5,%edi
+  803023:	83 e7 01             	and    $0x1,%edi
+  803026:	89 fe                	mov    %edi,%esi
+  803028:	83 f6 01             	xor    $0x1,%esi
+  80302b:	d3 e6                	shl    %cl,%esi
+  80302d:	d3 e7                	shl    %cl,%edi
+  80302f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803033:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803037:	eb 90                	jmp    802fc9 <__udivmoddi4+0x4e>
+  803039:	85 db                	test   %ebx,%ebx
+  80303b:	74 05                	je     803042 <__udivmoddi4+0xc7>
+  80303d:	89 03                	mov    %eax,(%ebx)
+  80303f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803042:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803046:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80304a:	83 c4 24             	add    $0x24,%esp
+  80304d:	5b                   	pop    %ebx
+  80304e:	5e                   	pop    %esi
+  80304f:	5f                   	pop    %edi
+  803050:	5d                   	pop    %ebp
+  803051:	c3                   	ret
+
+00803052 <__udivdi3>:
+  803052:	83 ec 08             	sub    $0x8,%esp
+  803055:	6a 00                	push   $0x0
+  803057:	ff 74 24 1c          	push   0x1c(%esp)
+  80305b:	ff 74 24 1c          	push   0x1c(%esp)
+  80305f:	ff 74 24 1c          	push   0x1c(%esp)
+  803063:	ff 74 24 1c          	push   0x1c(%esp)
+  803067:	e8 0f ff ff ff       	call   802f7b <__udivmoddi4>
+  80306c:	83 c4 1c             	add    $0x1c,%esp
+  80306f:	c3                   	ret
+
+00803070 <__umoddi3>:
+  803070:	83 ec 18             	sub    $0x18,%esp
+  803073:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803077:	50                   	push   %eax
+  803078:	ff 74 24 2c          	push   0x2c(%esp)
+  80307c:	ff 74 24 2c          	push   0x2c(%esp)
+  803080:	ff 74 24 2c          	push   0x2c(%esp)
+  803084:	ff 74 24 2c          	push   0x2c(%esp)
+  803088:	e8 ee fe ff ff       	call   802f7b <__udivmoddi4>
+  80308d:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803091:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803095:	83 c4 2c             	add    $0x2c,%esp
+  803098:	c3                   	ret
+
+00803099 <__divdi3>:
+  803099:	53                   	push   %ebx
+  80309a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80309e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030a2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8030a6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030aa:	85 d2                	test   %edx,%edx
+  8030ac:	78 12                	js     8030c0 <__divdi3+0x27>
+  8030ae:	85 db                	test   %ebx,%ebx
+  8030b0:	78 2e                	js     8030e0 <__divdi3+0x47>
+  8030b2:	53                   	push   %ebx
+  8030b3:	51                   	push   %ecx
+  8030b4:	52                   	push   %edx
+  8030b5:	50                   	push   %eax
+  8030b6:	e8 97 ff ff ff       	call   803052 <__udivdi3>
+  8030bb:	83 c4 10             	add    $0x10,%esp
+  8030be:	eb 1e                	jmp    8030de <__divdi3+0x45>
+  8030c0:	f7 d8                	neg    %eax
+  8030c2:	83 d2 00             	adc    $0x0,%edx
+  8030c5:	f7 da                	neg    %edx
+  8030c7:	85 db                	test   %ebx,%ebx
+  8030c9:	78 2a                	js     8030f5 <__divdi3+0x5c>
+  8030cb:	53                   	push   %ebx
+  8030cc:	51                   	push   %ecx
+  8030cd:	52                   	push   %edx
+  8030ce:	50                   	push   %eax
+  8030cf:	e8 7e ff ff ff       	call   803052 <__udivdi3>
+  8030d4:	83 c4 10             	add    $0x10,%esp
+  8030d7:	f7 d8                	neg    %eax
+  8030d9:	83 d2 00             	adc    $0x0,%edx
+  8030dc:	f7 da                	neg    %edx
+  8030de:	5b                   	pop    %ebx
+  8030df:	c3                   	ret
+  8030e0:	f7 d9                	neg    %ecx
+  8030e2:	83 d3 00             	adc    $0x0,%ebx
+  8030e5:	f7 db                	neg    %ebx
+  8030e7:	53                   	push   %ebx
+  8030e8:	51                   	push   %ecx
+  8030e9:	52                   	push   %edx
+  8030ea:	50                   	push   %eax
+  8030eb:	e8 62 ff ff ff       	call   803052 <__udivdi3>
+  8030f0:	83 c4 10             	add    $0x10,%esp
+  8030f3:	eb e2                	jmp    8030d7 <__divdi3+0x3e>
+  8030f5:	f7 d9                	neg    %ecx
+  8030f7:	83 d3 00             	adc    $0x0,%ebx
+  8030fa:	f7 db                	neg    %ebx
+  8030fc:	53                   	push   %ebx
+  8030fd:	51                   	push   %ecx
+  8030fe:	52                   	push   %edx
+  8030ff:	50                   	push   %eax
+  803100:	e8 4d ff ff ff       	call   803052 <__udivdi3>
+  803105:	83 c4 10             	add    $0x10,%esp
+  803108:	eb d4                	jmp    8030de <__divdi3+0x45>
+
+0080310a <__moddi3>:
+  80310a:	55                   	push   %ebp
+  80310b:	57                   	push   %edi
+  80310c:	56                   	push   %esi
+  80310d:	53                   	push   %ebx
+  80310e:	83 ec 0c             	sub    $0xc,%esp
+  803111:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803115:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803119:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80311d:	89 e9                	mov    %ebp,%ecx
+  80311f:	f7 d9                	neg    %ecx
+  803121:	89 d0                	mov    %edx,%eax
+  803123:	83 d0 00             	adc    $0x0,%eax
+  803126:	f7 d8                	neg    %eax
+  803128:	0f 49 e9             	cmovns %ecx,%ebp
+  80312b:	0f 49 d0             	cmovns %eax,%edx
+  80312e:	52                   	push   %edx
+  80312f:	55                   	push   %ebp
+  803130:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803134:	f7 da                	neg    %edx
+  803136:	89 d8                	mov    %ebx,%eax
+  803138:	83 d0 00             	adc    $0x0,%eax
+  80313b:	f7 d8                	neg    %eax
+  80313d:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803142:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803146:	0f 48 c3             	cmovs  %ebx,%eax
+  803149:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80314d:	ff 74 24 0c          	push   0xc(%esp)
+  803151:	ff 74 24 0c          	push   0xc(%esp)
+  803155:	e8 16 ff ff ff       	call   803070 <__umoddi3>
+  80315a:	83 c4 10             	add    $0x10,%esp
+  80315d:	85 db                	test   %ebx,%ebx
+  80315f:	78 08                	js     803169 <__moddi3+0x5f>
+  803161:	83 c4 0c             	add    $0xc,%esp
+  803164:	5b                   	pop    %ebx
+  803165:	5e                   	pop    %esi
+  803166:	5f                   	pop    %edi
+  803167:	5d                   	pop    %ebp
+  803168:	c3                   	ret
+  803169:	f7 d8                	neg    %eax
+  80316b:	83 d2 00             	adc    $0x0,%edx
+  80316e:	f7 da                	neg    %edx
+  803170:	eb ef                	jmp    803161 <__moddi3+0x57>
@@ -0,0 +1,6286 @@
+
+obj/user/djosclient.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 83 0a 00 00       	call   800ab4 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <pg_handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 08             	sub    $0x8,%esp
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+  80003f:	6a 07                	push   $0x7
+  800041:	89 d8                	mov    %ebx,%eax
+  800043:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800048:	50                   	push   %eax
+  800049:	6a 00                	push   $0x0
+  80004b:	e8 0f 17 00 00       	call   80175f <sys_page_alloc>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 05                	js     80005c <pg_handler+0x29>
+  800057:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80005a:	c9                   	leave
+  80005b:	c3                   	ret
+  80005c:	83 ec 0c             	sub    $0xc,%esp
+  80005f:	50                   	push   %eax
+  800060:	53                   	push   %ebx
+  800061:	68 a0 3f 80 00       	push   $0x803fa0
+  800066:	6a 25                	push   $0x25
+  800068:	68 be 42 80 00       	push   $0x8042be
+  80006d:	e8 bb 0a 00 00       	call   800b2d <_panic>
+
+00800072 <put_lease>:
+  800072:	b8 00 00 00 00       	mov    $0x0,%eax
+  800077:	83 3c c5 20 60 80 00 	cmpl   $0x0,0x806020(,%eax,8)
+  80007e:	00 
+  80007f:	74 0e                	je     80008f <put_lease+0x1d>
+  800081:	83 c0 01             	add    $0x1,%eax
+  800084:	83 f8 05             	cmp    $0x5,%eax
+  800087:	75 ee                	jne    800077 <put_lease+0x5>
+  800089:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  80008e:	c3                   	ret
+  80008f:	55                   	push   %ebp
+  800090:	89 e5                	mov    %esp,%ebp
+  800092:	8b 55 08             	mov    0x8(%ebp),%edx
+  800095:	89 14 c5 20 60 80 00 	mov    %edx,0x806020(,%eax,8)
+  80009c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80009f:	89 14 c5 24 60 80 00 	mov    %edx,0x806024(,%eax,8)
+  8000a6:	5d                   	pop    %ebp
+  8000a7:	c3                   	ret
+
+008000a8 <delete_lease>:
+  8000a8:	55                   	push   %ebp
+  8000a9:	89 e5                	mov    %esp,%ebp
+  8000ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b3:	39 14 c5 20 60 80 00 	cmp    %edx,0x806020(,%eax,8)
+  8000ba:	74 0f                	je     8000cb <delete_lease+0x23>
+  8000bc:	83 c0 01             	add    $0x1,%eax
+  8000bf:	83 f8 05             	cmp    $0x5,%eax
+  8000c2:	75 ef                	jne    8000b3 <delete_lease+0xb>
+  8000c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8000c9:	5d                   	pop    %ebp
+  8000ca:	c3                   	ret
+  8000cb:	c7 04 c5 20 60 80 00 	movl   $0x0,0x806020(,%eax,8)
+  8000d2:	00 00 00 00 
+  8000d6:	c7 04 c5 24 60 80 00 	movl   $0x0,0x806024(,%eax,8)
+  8000dd:	00 00 00 00 
+  8000e1:	eb e6                	jmp    8000c9 <delete_lease+0x21>
+
+008000e3 <find_lease>:
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ee:	39 14 c5 20 60 80 00 	cmp    %edx,0x806020(,%eax,8)
+  8000f5:	74 0d                	je     800104 <find_lease+0x21>
+  8000f7:	83 c0 01             	add    $0x1,%eax
+  8000fa:	83 f8 05             	cmp    $0x5,%eax
+  8000fd:	75 ef                	jne    8000ee <find_lease+0xb>
+  8000ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800104:	5d                   	pop    %ebp
+  800105:	c3                   	ret
+
+00800106 <check_lease_complete>:
+  800106:	55                   	push   %ebp
+  800107:	89 e5                	mov    %esp,%ebp
+  800109:	83 ec 14             	sub    $0x14,%esp
+  80010c:	68 cc 3f 80 00       	push   $0x803fcc
+  800111:	e8 f2 0a 00 00       	call   800c08 <cprintf>
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011e:	eb 08                	jmp    800128 <check_lease_complete+0x22>
+  800120:	83 c2 01             	add    $0x1,%edx
+  800123:	83 fa 05             	cmp    $0x5,%edx
+  800126:	74 3b                	je     800163 <check_lease_complete+0x5d>
+  800128:	8b 04 d5 20 60 80 00 	mov    0x806020(,%edx,8),%eax
+  80012f:	85 c0                	test   %eax,%eax
+  800131:	74 ed                	je     800120 <check_lease_complete+0x1a>
+  800133:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800138:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80013e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800143:	8b 40 54             	mov    0x54(%eax),%eax
+  800146:	83 f8 05             	cmp    $0x5,%eax
+  800149:	74 d5                	je     800120 <check_lease_complete+0x1a>
+  80014b:	c7 04 d5 20 60 80 00 	movl   $0x0,0x806020(,%edx,8)
+  800152:	00 00 00 00 
+  800156:	c7 04 d5 24 60 80 00 	movl   $0x0,0x806024(,%edx,8)
+  80015d:	00 00 00 00 
+  800161:	eb bd                	jmp    800120 <check_lease_complete+0x1a>
+  800163:	c9                   	leave
+  800164:	c3                   	ret
+
+00800165 <connect_serv>:
+  800165:	55                   	push   %ebp
+  800166:	89 e5                	mov    %esp,%ebp
+  800168:	57                   	push   %edi
+  800169:	56                   	push   %esi
+  80016a:	53                   	push   %ebx
+  80016b:	83 ec 20             	sub    $0x20,%esp
+  80016e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800171:	6a 06                	push   $0x6
+  800173:	6a 01                	push   $0x1
+  800175:	6a 02                	push   $0x2
+  800177:	e8 53 2f 00 00       	call   8030cf <socket>
+  80017c:	89 c3                	mov    %eax,%ebx
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	85 c0                	test   %eax,%eax
+  800183:	78 5d                	js     8001e2 <connect_serv+0x7d>
+  800185:	83 ec 04             	sub    $0x4,%esp
+  800188:	6a 10                	push   $0x10
+  80018a:	6a 00                	push   $0x0
+  80018c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+  80018f:	56                   	push   %esi
+  800190:	e8 e5 12 00 00       	call   80147a <memset>
+  800195:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+  800199:	89 3c 24             	mov    %edi,(%esp)
+  80019c:	e8 ab 39 00 00       	call   803b4c <htonl>
+  8001a1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001a4:	0f b7 45 0c          	movzwl 0xc(%ebp),%eax
+  8001a8:	89 04 24             	mov    %eax,(%esp)
+  8001ab:	e8 82 39 00 00       	call   803b32 <htons>
+  8001b0:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+  8001b4:	83 c4 0c             	add    $0xc,%esp
+  8001b7:	ff 75 0c             	push   0xc(%ebp)
+  8001ba:	57                   	push   %edi
+  8001bb:	68 f0 3f 80 00       	push   $0x803ff0
+  8001c0:	e8 43 0a 00 00       	call   800c08 <cprintf>
+  8001c5:	83 c4 0c             	add    $0xc,%esp
+  8001c8:	6a 10                	push   $0x10
+  8001ca:	56                   	push   %esi
+  8001cb:	53                   	push   %ebx
+  8001cc:	e8 b5 2e 00 00       	call   803086 <connect>
+  8001d1:	83 c4 10             	add    $0x10,%esp
+  8001d4:	85 c0                	test   %eax,%eax
+  8001d6:	78 26                	js     8001fe <connect_serv+0x99>
+  8001d8:	89 d8                	mov    %ebx,%eax
+  8001da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001dd:	5b                   	pop    %ebx
+  8001de:	5e                   	pop    %esi
+  8001df:	5f                   	pop    %edi
+  8001e0:	5d                   	pop    %ebp
+  8001e1:	c3                   	ret
+  8001e2:	83 ec 08             	sub    $0x8,%esp
+  8001e5:	68 d0 42 80 00       	push   $0x8042d0
+  8001ea:	68 d8 42 80 00       	push   $0x8042d8
+  8001ef:	e8 14 0a 00 00       	call   800c08 <cprintf>
+  8001f4:	e8 04 09 00 00       	call   800afd <exit>
+  8001f9:	83 c4 10             	add    $0x10,%esp
+  8001fc:	eb 87                	jmp    800185 <connect_serv+0x20>
+  8001fe:	83 ec 0c             	sub    $0xc,%esp
+  800201:	68 dc 42 80 00       	push   $0x8042dc
+  800206:	e8 fd 09 00 00       	call   800c08 <cprintf>
+  80020b:	89 1c 24             	mov    %ebx,(%esp)
+  80020e:	e8 67 22 00 00       	call   80247a <close>
+  800213:	83 c4 10             	add    $0x10,%esp
+  800216:	bb 36 ff ff ff       	mov    $0xffffff36,%ebx
+  80021b:	eb bb                	jmp    8001d8 <connect_serv+0x73>
+
+0080021d <issue_request>:
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	56                   	push   %esi
+  800221:	53                   	push   %ebx
+  800222:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800225:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800228:	83 ec 04             	sub    $0x4,%esp
+  80022b:	ff 76 01             	push   0x1(%esi)
+  80022e:	0f be 06             	movsbl (%esi),%eax
+  800231:	50                   	push   %eax
+  800232:	68 fa 42 80 00       	push   $0x8042fa
+  800237:	e8 cc 09 00 00       	call   800c08 <cprintf>
+  80023c:	83 c4 0c             	add    $0xc,%esp
+  80023f:	53                   	push   %ebx
+  800240:	56                   	push   %esi
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	e8 48 24 00 00       	call   802691 <write>
+  800249:	83 c4 10             	add    $0x10,%esp
+  80024c:	39 d8                	cmp    %ebx,%eax
+  80024e:	75 09                	jne    800259 <issue_request+0x3c>
+  800250:	89 d8                	mov    %ebx,%eax
+  800252:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800255:	5b                   	pop    %ebx
+  800256:	5e                   	pop    %esi
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+  800259:	83 ec 0c             	sub    $0xc,%esp
+  80025c:	68 14 40 80 00       	push   $0x804014
+  800261:	e8 a2 09 00 00       	call   800c08 <cprintf>
+  800266:	83 c4 10             	add    $0x10,%esp
+  800269:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  80026e:	eb e0                	jmp    800250 <issue_request+0x33>
+
+00800270 <send_buff>:
+  800270:	55                   	push   %ebp
+  800271:	89 e5                	mov    %esp,%ebp
+  800273:	57                   	push   %edi
+  800274:	56                   	push   %esi
+  800275:	53                   	push   %ebx
+  800276:	81 ec 04 06 00 00    	sub    $0x604,%esp
+  80027c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80027f:	68 df 67 00 00       	push   $0x67df
+  800284:	68 1f 00 bb 12       	push   $0x12bb001f
+  800289:	e8 d7 fe ff ff       	call   800165 <connect_serv>
+  80028e:	83 c4 10             	add    $0x10,%esp
+  800291:	85 c0                	test   %eax,%eax
+  800293:	0f 88 ad 00 00 00    	js     800346 <send_buff+0xd6>
+  800299:	89 c3                	mov    %eax,%ebx
+  80029b:	be 05 00 00 00       	mov    $0x5,%esi
+  8002a0:	83 ec 04             	sub    $0x4,%esp
+  8002a3:	57                   	push   %edi
+  8002a4:	ff 75 08             	push   0x8(%ebp)
+  8002a7:	53                   	push   %ebx
+  8002a8:	e8 70 ff ff ff       	call   80021d <issue_request>
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	85 c0                	test   %eax,%eax
+  8002b2:	79 25                	jns    8002d9 <send_buff+0x69>
+  8002b4:	83 ec 0c             	sub    $0xc,%esp
+  8002b7:	53                   	push   %ebx
+  8002b8:	e8 bd 21 00 00       	call   80247a <close>
+  8002bd:	83 c4 08             	add    $0x8,%esp
+  8002c0:	68 df 67 00 00       	push   $0x67df
+  8002c5:	68 1f 00 bb 12       	push   $0x12bb001f
+  8002ca:	e8 96 fe ff ff       	call   800165 <connect_serv>
+  8002cf:	89 c3                	mov    %eax,%ebx
+  8002d1:	83 c4 10             	add    $0x10,%esp
+  8002d4:	83 ee 01             	sub    $0x1,%esi
+  8002d7:	75 c7                	jne    8002a0 <send_buff+0x30>
+  8002d9:	83 ec 0c             	sub    $0xc,%esp
+  8002dc:	68 38 40 80 00       	push   $0x804038
+  8002e1:	e8 22 09 00 00       	call   800c08 <cprintf>
+  8002e6:	83 c4 0c             	add    $0xc,%esp
+  8002e9:	68 ee 05 00 00       	push   $0x5ee
+  8002ee:	8d 85 fa f9 ff ff    	lea    -0x606(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	53                   	push   %ebx
+  8002f6:	e8 bb 22 00 00       	call   8025b6 <read>
+  8002fb:	83 c4 10             	add    $0x10,%esp
+  8002fe:	85 c0                	test   %eax,%eax
+  800300:	78 2d                	js     80032f <send_buff+0xbf>
+  800302:	83 ec 0c             	sub    $0xc,%esp
+  800305:	53                   	push   %ebx
+  800306:	e8 6f 21 00 00       	call   80247a <close>
+  80030b:	83 c4 08             	add    $0x8,%esp
+  80030e:	ff b5 fa f9 ff ff    	push   -0x606(%ebp)
+  800314:	68 22 43 80 00       	push   $0x804322
+  800319:	e8 ea 08 00 00       	call   800c08 <cprintf>
+  80031e:	8b 85 fa f9 ff ff    	mov    -0x606(%ebp),%eax
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+  80032f:	83 ec 04             	sub    $0x4,%esp
+  800332:	68 13 43 80 00       	push   $0x804313
+  800337:	68 b2 00 00 00       	push   $0xb2
+  80033c:	68 be 42 80 00       	push   $0x8042be
+  800341:	e8 e7 07 00 00       	call   800b2d <_panic>
+  800346:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  80034b:	eb da                	jmp    800327 <send_buff+0xb7>
+
+0080034d <send_lease_req>:
+  80034d:	55                   	push   %ebp
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	53                   	push   %ebx
+  800351:	81 ec c8 01 00 00    	sub    $0x1c8,%esp
+  800357:	68 b5 01 00 00       	push   $0x1b5
+  80035c:	6a 00                	push   $0x0
+  80035e:	8d 9d 43 fe ff ff    	lea    -0x1bd(%ebp),%ebx
+  800364:	53                   	push   %ebx
+  800365:	e8 10 11 00 00       	call   80147a <memset>
+  80036a:	c6 85 43 fe ff ff 01 	movb   $0x1,-0x1bd(%ebp)
+  800371:	8b 45 08             	mov    0x8(%ebp),%eax
+  800374:	89 85 44 fe ff ff    	mov    %eax,-0x1bc(%ebp)
+  80037a:	83 c4 0c             	add    $0xc,%esp
+  80037d:	68 ac 01 00 00       	push   $0x1ac
+  800382:	ff 75 10             	push   0x10(%ebp)
+  800385:	8d 85 48 fe ff ff    	lea    -0x1b8(%ebp),%eax
+  80038b:	50                   	push   %eax
+  80038c:	e8 1e 11 00 00       	call   8014af <memmove>
+  800391:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800394:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800397:	c7 85 14 ff ff ff 16 	movl   $0x12bb0016,-0xec(%ebp)
+  80039e:	00 bb 12 
+  8003a1:	66 c7 85 18 ff ff ff 	movw   $0x62c1,-0xe8(%ebp)
+  8003a8:	c1 62 
+  8003aa:	c7 04 24 16 00 bb 12 	movl   $0x12bb0016,(%esp)
+  8003b1:	ff b5 9c fe ff ff    	push   -0x164(%ebp)
+  8003b7:	ff b5 94 fe ff ff    	push   -0x16c(%ebp)
+  8003bd:	ff b5 90 fe ff ff    	push   -0x170(%ebp)
+  8003c3:	68 60 40 80 00       	push   $0x804060
+  8003c8:	e8 3b 08 00 00       	call   800c08 <cprintf>
+  8003cd:	83 c4 18             	add    $0x18,%esp
+  8003d0:	68 b5 01 00 00       	push   $0x1b5
+  8003d5:	53                   	push   %ebx
+  8003d6:	e8 95 fe ff ff       	call   800270 <send_buff>
+  8003db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003de:	c9                   	leave
+  8003df:	c3                   	ret
+
+008003e0 <send_page_req>:
+  8003e0:	55                   	push   %ebp
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	57                   	push   %edi
+  8003e4:	56                   	push   %esi
+  8003e5:	53                   	push   %ebx
+  8003e6:	81 ec 1c 04 00 00    	sub    $0x41c,%esp
+  8003ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8003f2:	c6 85 da fb ff ff 00 	movb   $0x0,-0x426(%ebp)
+  8003f9:	89 bd db fb ff ff    	mov    %edi,-0x425(%ebp)
+  8003ff:	89 b5 df fb ff ff    	mov    %esi,-0x421(%ebp)
+  800405:	8b 45 10             	mov    0x10(%ebp),%eax
+  800408:	89 85 e3 fb ff ff    	mov    %eax,-0x41d(%ebp)
+  80040e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800413:	88 9d e7 fb ff ff    	mov    %bl,-0x419(%ebp)
+  800419:	53                   	push   %ebx
+  80041a:	56                   	push   %esi
+  80041b:	57                   	push   %edi
+  80041c:	68 bc 40 80 00       	push   $0x8040bc
+  800421:	e8 e2 07 00 00       	call   800c08 <cprintf>
+  800426:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80042d:	ff 75 10             	push   0x10(%ebp)
+  800430:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  800436:	50                   	push   %eax
+  800437:	89 d8                	mov    %ebx,%eax
+  800439:	c1 e0 0a             	shl    $0xa,%eax
+  80043c:	01 f0                	add    %esi,%eax
+  80043e:	50                   	push   %eax
+  80043f:	57                   	push   %edi
+  800440:	e8 b5 18 00 00       	call   801cfa <sys_copy_mem>
+  800445:	83 c4 20             	add    $0x20,%esp
+  800448:	85 c0                	test   %eax,%eax
+  80044a:	78 28                	js     800474 <send_page_req+0x94>
+  80044c:	83 ec 08             	sub    $0x8,%esp
+  80044f:	68 0e 04 00 00       	push   $0x40e
+  800454:	8d 85 da fb ff ff    	lea    -0x426(%ebp),%eax
+  80045a:	50                   	push   %eax
+  80045b:	e8 10 fe ff ff       	call   800270 <send_buff>
+  800460:	83 c4 10             	add    $0x10,%esp
+  800463:	85 c0                	test   %eax,%eax
+  800465:	78 0d                	js     800474 <send_page_req+0x94>
+  800467:	83 c3 01             	add    $0x1,%ebx
+  80046a:	83 fb 04             	cmp    $0x4,%ebx
+  80046d:	75 a4                	jne    800413 <send_page_req+0x33>
+  80046f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800474:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800477:	5b                   	pop    %ebx
+  800478:	5e                   	pop    %esi
+  800479:	5f                   	pop    %edi
+  80047a:	5d                   	pop    %ebp
+  80047b:	c3                   	ret
+
+0080047c <send_pages>:
+  80047c:	55                   	push   %ebp
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	57                   	push   %edi
+  800480:	56                   	push   %esi
+  800481:	53                   	push   %ebx
+  800482:	83 ec 1c             	sub    $0x1c,%esp
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	bb 00 00 80 00       	mov    $0x800000,%ebx
+  80048d:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800490:	eb 0e                	jmp    8004a0 <send_pages+0x24>
+  800492:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800498:	81 fb 00 00 80 ee    	cmp    $0xee800000,%ebx
+  80049e:	74 2e                	je     8004ce <send_pages+0x52>
+  8004a0:	83 ec 04             	sub    $0x4,%esp
+  8004a3:	57                   	push   %edi
+  8004a4:	53                   	push   %ebx
+  8004a5:	56                   	push   %esi
+  8004a6:	e8 91 18 00 00       	call   801d3c <sys_get_perms>
+  8004ab:	83 c4 10             	add    $0x10,%esp
+  8004ae:	85 c0                	test   %eax,%eax
+  8004b0:	78 e0                	js     800492 <send_pages+0x16>
+  8004b2:	83 ec 04             	sub    $0x4,%esp
+  8004b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8004b8:	53                   	push   %ebx
+  8004b9:	56                   	push   %esi
+  8004ba:	e8 21 ff ff ff       	call   8003e0 <send_page_req>
+  8004bf:	83 c4 10             	add    $0x10,%esp
+  8004c2:	85 c0                	test   %eax,%eax
+  8004c4:	79 cc                	jns    800492 <send_pages+0x16>
+  8004c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c9:	5b                   	pop    %ebx
+  8004ca:	5e                   	pop    %esi
+  8004cb:	5f                   	pop    %edi
+  8004cc:	5d                   	pop    %ebp
+  8004cd:	c3                   	ret
+  8004ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d3:	eb f1                	jmp    8004c6 <send_pages+0x4a>
+
+008004d5 <send_done_request>:
+  8004d5:	55                   	push   %ebp
+  8004d6:	89 e5                	mov    %esp,%ebp
+  8004d8:	83 ec 18             	sub    $0x18,%esp
+  8004db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004de:	89 d1                	mov    %edx,%ecx
+  8004e0:	83 e1 fb             	and    $0xfffffffb,%ecx
+  8004e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8004e8:	80 f9 02             	cmp    $0x2,%cl
+  8004eb:	75 1a                	jne    800507 <send_done_request+0x32>
+  8004ed:	88 55 f3             	mov    %dl,-0xd(%ebp)
+  8004f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  8004f6:	83 ec 08             	sub    $0x8,%esp
+  8004f9:	6a 05                	push   $0x5
+  8004fb:	8d 45 f3             	lea    -0xd(%ebp),%eax
+  8004fe:	50                   	push   %eax
+  8004ff:	e8 6c fd ff ff       	call   800270 <send_buff>
+  800504:	83 c4 10             	add    $0x10,%esp
+  800507:	c9                   	leave
+  800508:	c3                   	ret
+
+00800509 <send_abort_request>:
+  800509:	55                   	push   %ebp
+  80050a:	89 e5                	mov    %esp,%ebp
+  80050c:	83 ec 20             	sub    $0x20,%esp
+  80050f:	c6 45 f3 03          	movb   $0x3,-0xd(%ebp)
+  800513:	8b 45 08             	mov    0x8(%ebp),%eax
+  800516:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800519:	6a 05                	push   $0x5
+  80051b:	8d 45 f3             	lea    -0xd(%ebp),%eax
+  80051e:	50                   	push   %eax
+  80051f:	e8 4c fd ff ff       	call   800270 <send_buff>
+  800524:	c9                   	leave
+  800525:	c3                   	ret
+
+00800526 <send_env>:
+  800526:	55                   	push   %ebp
+  800527:	89 e5                	mov    %esp,%ebp
+  800529:	57                   	push   %edi
+  80052a:	56                   	push   %esi
+  80052b:	53                   	push   %ebx
+  80052c:	83 ec 0c             	sub    $0xc,%esp
+  80052f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800532:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800535:	be 00 00 00 00       	mov    $0x0,%esi
+  80053a:	eb 13                	jmp    80054f <send_env+0x29>
+  80053c:	83 ec 0c             	sub    $0xc,%esp
+  80053f:	ff 73 48             	push   0x48(%ebx)
+  800542:	e8 c2 ff ff ff       	call   800509 <send_abort_request>
+  800547:	83 c4 10             	add    $0x10,%esp
+  80054a:	83 fe 06             	cmp    $0x6,%esi
+  80054d:	74 66                	je     8005b5 <send_env+0x8f>
+  80054f:	83 c6 01             	add    $0x1,%esi
+  800552:	83 ec 04             	sub    $0x4,%esp
+  800555:	53                   	push   %ebx
+  800556:	57                   	push   %edi
+  800557:	ff 73 48             	push   0x48(%ebx)
+  80055a:	e8 ee fd ff ff       	call   80034d <send_lease_req>
+  80055f:	8d 90 ca 00 00 00    	lea    0xca(%eax),%edx
+  800565:	83 c4 10             	add    $0x10,%esp
+  800568:	83 fa 01             	cmp    $0x1,%edx
+  80056b:	76 dd                	jbe    80054a <send_env+0x24>
+  80056d:	85 c0                	test   %eax,%eax
+  80056f:	78 cb                	js     80053c <send_env+0x16>
+  800571:	83 ec 0c             	sub    $0xc,%esp
+  800574:	ff 73 48             	push   0x48(%ebx)
+  800577:	e8 00 ff ff ff       	call   80047c <send_pages>
+  80057c:	83 c4 10             	add    $0x10,%esp
+  80057f:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800582:	74 3e                	je     8005c2 <send_env+0x9c>
+  800584:	3d 36 ff ff ff       	cmp    $0xffffff36,%eax
+  800589:	74 bf                	je     80054a <send_env+0x24>
+  80058b:	85 c0                	test   %eax,%eax
+  80058d:	78 ad                	js     80053c <send_env+0x16>
+  80058f:	83 ec 08             	sub    $0x8,%esp
+  800592:	6a 02                	push   $0x2
+  800594:	ff 73 48             	push   0x48(%ebx)
+  800597:	e8 39 ff ff ff       	call   8004d5 <send_done_request>
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	85 c0                	test   %eax,%eax
+  8005a1:	78 99                	js     80053c <send_env+0x16>
+  8005a3:	83 fe 06             	cmp    $0x6,%esi
+  8005a6:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  8005ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b0:	0f 4e c2             	cmovle %edx,%eax
+  8005b3:	eb 05                	jmp    8005ba <send_env+0x94>
+  8005b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005bd:	5b                   	pop    %ebx
+  8005be:	5e                   	pop    %esi
+  8005bf:	5f                   	pop    %edi
+  8005c0:	5d                   	pop    %ebp
+  8005c1:	c3                   	ret
+  8005c2:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  8005c7:	eb f1                	jmp    8005ba <send_env+0x94>
+
+008005c9 <try_send_lease>:
+  8005c9:	55                   	push   %ebp
+  8005ca:	89 e5                	mov    %esp,%ebp
+  8005cc:	53                   	push   %ebx
+  8005cd:	81 ec bc 01 00 00    	sub    $0x1bc,%esp
+  8005d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005d6:	53                   	push   %ebx
+  8005d7:	68 f0 40 80 00       	push   $0x8040f0
+  8005dc:	e8 27 06 00 00       	call   800c08 <cprintf>
+  8005e1:	83 c4 0c             	add    $0xc,%esp
+  8005e4:	68 ac 01 00 00       	push   $0x1ac
+  8005e9:	89 d8                	mov    %ebx,%eax
+  8005eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005f0:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8005f6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005fb:	50                   	push   %eax
+  8005fc:	8d 85 4c fe ff ff    	lea    -0x1b4(%ebp),%eax
+  800602:	50                   	push   %eax
+  800603:	e8 a7 0e 00 00       	call   8014af <memmove>
+  800608:	83 c4 10             	add    $0x10,%esp
+  80060b:	39 9d 94 fe ff ff    	cmp    %ebx,-0x16c(%ebp)
+  800611:	75 44                	jne    800657 <try_send_lease+0x8e>
+  800613:	83 bd a0 fe ff ff 06 	cmpl   $0x6,-0x160(%ebp)
+  80061a:	74 4d                	je     800669 <try_send_lease+0xa0>
+  80061c:	83 ec 08             	sub    $0x8,%esp
+  80061f:	53                   	push   %ebx
+  800620:	68 18 41 80 00       	push   $0x804118
+  800625:	e8 de 05 00 00       	call   800c08 <cprintf>
+  80062a:	83 c4 10             	add    $0x10,%esp
+  80062d:	83 ec 0c             	sub    $0xc,%esp
+  800630:	68 44 41 80 00       	push   $0x804144
+  800635:	e8 ce 05 00 00       	call   800c08 <cprintf>
+  80063a:	83 c4 0c             	add    $0xc,%esp
+  80063d:	6a fd                	push   $0xfffffffd
+  80063f:	6a 02                	push   $0x2
+  800641:	53                   	push   %ebx
+  800642:	e8 38 17 00 00       	call   801d7f <sys_env_unsuspend>
+  800647:	89 1c 24             	mov    %ebx,(%esp)
+  80064a:	e8 59 fa ff ff       	call   8000a8 <delete_lease>
+  80064f:	83 c4 10             	add    $0x10,%esp
+  800652:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800655:	c9                   	leave
+  800656:	c3                   	ret
+  800657:	83 ec 0c             	sub    $0xc,%esp
+  80065a:	68 30 43 80 00       	push   $0x804330
+  80065f:	e8 a4 05 00 00       	call   800c08 <cprintf>
+  800664:	83 c4 10             	add    $0x10,%esp
+  800667:	eb e9                	jmp    800652 <try_send_lease+0x89>
+  800669:	c7 85 68 fe ff ff 00 	movl   $0x0,-0x198(%ebp)
+  800670:	00 00 00 
+  800673:	c7 85 18 ff ff ff 16 	movl   $0x12bb0016,-0xe8(%ebp)
+  80067a:	00 bb 12 
+  80067d:	66 c7 85 1c ff ff ff 	movw   $0x7,-0xe4(%ebp)
+  800684:	07 00 
+  800686:	83 ec 08             	sub    $0x8,%esp
+  800689:	68 1f 00 bb 12       	push   $0x12bb001f
+  80068e:	53                   	push   %ebx
+  80068f:	e8 de f9 ff ff       	call   800072 <put_lease>
+  800694:	83 c4 10             	add    $0x10,%esp
+  800697:	85 c0                	test   %eax,%eax
+  800699:	78 92                	js     80062d <try_send_lease+0x64>
+  80069b:	83 ec 08             	sub    $0x8,%esp
+  80069e:	ff 75 0c             	push   0xc(%ebp)
+  8006a1:	8d 85 4c fe ff ff    	lea    -0x1b4(%ebp),%eax
+  8006a7:	50                   	push   %eax
+  8006a8:	e8 79 fe ff ff       	call   800526 <send_env>
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	85 c0                	test   %eax,%eax
+  8006b2:	0f 88 75 ff ff ff    	js     80062d <try_send_lease+0x64>
+  8006b8:	83 ec 04             	sub    $0x4,%esp
+  8006bb:	6a 00                	push   $0x0
+  8006bd:	6a 05                	push   $0x5
+  8006bf:	53                   	push   %ebx
+  8006c0:	e8 ba 16 00 00       	call   801d7f <sys_env_unsuspend>
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	eb 88                	jmp    800652 <try_send_lease+0x89>
+
+008006ca <try_send_lease_completed>:
+  8006ca:	55                   	push   %ebp
+  8006cb:	89 e5                	mov    %esp,%ebp
+  8006cd:	57                   	push   %edi
+  8006ce:	56                   	push   %esi
+  8006cf:	53                   	push   %ebx
+  8006d0:	81 ec d0 01 00 00    	sub    $0x1d0,%esp
+  8006d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d9:	68 ac 01 00 00       	push   $0x1ac
+  8006de:	89 f0                	mov    %esi,%eax
+  8006e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8006e5:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8006eb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8006f0:	50                   	push   %eax
+  8006f1:	8d 85 3c fe ff ff    	lea    -0x1c4(%ebp),%eax
+  8006f7:	50                   	push   %eax
+  8006f8:	e8 b2 0d 00 00       	call   8014af <memmove>
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	39 b5 84 fe ff ff    	cmp    %esi,-0x17c(%ebp)
+  800706:	75 3f                	jne    800747 <try_send_lease_completed+0x7d>
+  800708:	83 bd 90 fe ff ff 06 	cmpl   $0x6,-0x170(%ebp)
+  80070f:	74 48                	je     800759 <try_send_lease_completed+0x8f>
+  800711:	83 ec 08             	sub    $0x8,%esp
+  800714:	56                   	push   %esi
+  800715:	68 6c 41 80 00       	push   $0x80416c
+  80071a:	e8 e9 04 00 00       	call   800c08 <cprintf>
+  80071f:	83 c4 10             	add    $0x10,%esp
+  800722:	83 ec 0c             	sub    $0xc,%esp
+  800725:	68 c8 41 80 00       	push   $0x8041c8
+  80072a:	e8 d9 04 00 00       	call   800c08 <cprintf>
+  80072f:	83 c4 0c             	add    $0xc,%esp
+  800732:	6a fd                	push   $0xfffffffd
+  800734:	6a 02                	push   $0x2
+  800736:	56                   	push   %esi
+  800737:	e8 43 16 00 00       	call   801d7f <sys_env_unsuspend>
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800742:	5b                   	pop    %ebx
+  800743:	5e                   	pop    %esi
+  800744:	5f                   	pop    %edi
+  800745:	5d                   	pop    %ebp
+  800746:	c3                   	ret
+  800747:	83 ec 0c             	sub    $0xc,%esp
+  80074a:	68 42 43 80 00       	push   $0x804342
+  80074f:	e8 b4 04 00 00       	call   800c08 <cprintf>
+  800754:	83 c4 10             	add    $0x10,%esp
+  800757:	eb e6                	jmp    80073f <try_send_lease_completed+0x75>
+  800759:	83 ec 04             	sub    $0x4,%esp
+  80075c:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+  800762:	56                   	push   %esi
+  800763:	68 a0 41 80 00       	push   $0x8041a0
+  800768:	e8 9b 04 00 00       	call   800c08 <cprintf>
+  80076d:	83 c4 10             	add    $0x10,%esp
+  800770:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800775:	8d bd 37 fe ff ff    	lea    -0x1c9(%ebp),%edi
+  80077b:	c6 85 37 fe ff ff 04 	movb   $0x4,-0x1c9(%ebp)
+  800782:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+  800788:	89 85 38 fe ff ff    	mov    %eax,-0x1c8(%ebp)
+  80078e:	83 ec 08             	sub    $0x8,%esp
+  800791:	6a 05                	push   $0x5
+  800793:	57                   	push   %edi
+  800794:	e8 d7 fa ff ff       	call   800270 <send_buff>
+  800799:	83 c4 10             	add    $0x10,%esp
+  80079c:	85 c0                	test   %eax,%eax
+  80079e:	74 14                	je     8007b4 <try_send_lease_completed+0xea>
+  8007a0:	3d 38 ff ff ff       	cmp    $0xffffff38,%eax
+  8007a5:	74 0d                	je     8007b4 <try_send_lease_completed+0xea>
+  8007a7:	83 c3 01             	add    $0x1,%ebx
+  8007aa:	83 fb 06             	cmp    $0x6,%ebx
+  8007ad:	75 cc                	jne    80077b <try_send_lease_completed+0xb1>
+  8007af:	e9 6e ff ff ff       	jmp    800722 <try_send_lease_completed+0x58>
+  8007b4:	85 c0                	test   %eax,%eax
+  8007b6:	0f 88 66 ff ff ff    	js     800722 <try_send_lease_completed+0x58>
+  8007bc:	83 fb 05             	cmp    $0x5,%ebx
+  8007bf:	0f 8f 5d ff ff ff    	jg     800722 <try_send_lease_completed+0x58>
+  8007c5:	83 ec 04             	sub    $0x4,%esp
+  8007c8:	6a 00                	push   $0x0
+  8007ca:	6a 02                	push   $0x2
+  8007cc:	56                   	push   %esi
+  8007cd:	e8 ad 15 00 00       	call   801d7f <sys_env_unsuspend>
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	e9 65 ff ff ff       	jmp    80073f <try_send_lease_completed+0x75>
+
+008007da <send_ipc_start>:
+  8007da:	55                   	push   %ebp
+  8007db:	89 e5                	mov    %esp,%ebp
+  8007dd:	56                   	push   %esi
+  8007de:	53                   	push   %ebx
+  8007df:	83 ec 24             	sub    $0x24,%esp
+  8007e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007e5:	6a 19                	push   $0x19
+  8007e7:	6a 00                	push   $0x0
+  8007e9:	8d 75 df             	lea    -0x21(%ebp),%esi
+  8007ec:	56                   	push   %esi
+  8007ed:	e8 88 0c 00 00       	call   80147a <memset>
+  8007f2:	c6 45 df 05          	movb   $0x5,-0x21(%ebp)
+  8007f6:	83 c4 0c             	add    $0xc,%esp
+  8007f9:	6a 18                	push   $0x18
+  8007fb:	53                   	push   %ebx
+  8007fc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007ff:	50                   	push   %eax
+  800800:	e8 aa 0c 00 00       	call   8014af <memmove>
+  800805:	83 c4 08             	add    $0x8,%esp
+  800808:	ff 73 14             	push   0x14(%ebx)
+  80080b:	ff 73 08             	push   0x8(%ebx)
+  80080e:	ff 33                	push   (%ebx)
+  800810:	ff 73 04             	push   0x4(%ebx)
+  800813:	68 53 43 80 00       	push   $0x804353
+  800818:	68 f8 41 80 00       	push   $0x8041f8
+  80081d:	e8 e6 03 00 00       	call   800c08 <cprintf>
+  800822:	83 c4 18             	add    $0x18,%esp
+  800825:	6a 19                	push   $0x19
+  800827:	56                   	push   %esi
+  800828:	e8 43 fa ff ff       	call   800270 <send_buff>
+  80082d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800830:	5b                   	pop    %ebx
+  800831:	5e                   	pop    %esi
+  800832:	5d                   	pop    %ebp
+  800833:	c3                   	ret
+
+00800834 <send_ipc_req>:
+  800834:	55                   	push   %ebp
+  800835:	89 e5                	mov    %esp,%ebp
+  800837:	56                   	push   %esi
+  800838:	53                   	push   %ebx
+  800839:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80083c:	be 00 00 00 00       	mov    $0x0,%esi
+  800841:	83 ec 0c             	sub    $0xc,%esp
+  800844:	53                   	push   %ebx
+  800845:	e8 90 ff ff ff       	call   8007da <send_ipc_start>
+  80084a:	83 c4 10             	add    $0x10,%esp
+  80084d:	3d 38 ff ff ff       	cmp    $0xffffff38,%eax
+  800852:	74 34                	je     800888 <send_ipc_req+0x54>
+  800854:	3d 39 ff ff ff       	cmp    $0xffffff39,%eax
+  800859:	7d 1a                	jge    800875 <send_ipc_req+0x41>
+  80085b:	3d 35 ff ff ff       	cmp    $0xffffff35,%eax
+  800860:	74 2d                	je     80088f <send_ipc_req+0x5b>
+  800862:	3d 36 ff ff ff       	cmp    $0xffffff36,%eax
+  800867:	75 10                	jne    800879 <send_ipc_req+0x45>
+  800869:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80086e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800871:	5b                   	pop    %ebx
+  800872:	5e                   	pop    %esi
+  800873:	5d                   	pop    %ebp
+  800874:	c3                   	ret
+  800875:	85 c0                	test   %eax,%eax
+  800877:	74 f5                	je     80086e <send_ipc_req+0x3a>
+  800879:	83 c6 01             	add    $0x1,%esi
+  80087c:	83 fe 06             	cmp    $0x6,%esi
+  80087f:	75 c0                	jne    800841 <send_ipc_req+0xd>
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+  800886:	eb e6                	jmp    80086e <send_ipc_req+0x3a>
+  800888:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80088d:	eb df                	jmp    80086e <send_ipc_req+0x3a>
+  80088f:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+  800894:	eb d8                	jmp    80086e <send_ipc_req+0x3a>
+
+00800896 <try_send_ipc>:
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	56                   	push   %esi
+  80089a:	53                   	push   %ebx
+  80089b:	81 ec 74 03 00 00    	sub    $0x374,%esp
+  8008a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a7:	89 9d 8c fc ff ff    	mov    %ebx,-0x374(%ebp)
+  8008ad:	8b 02                	mov    (%edx),%eax
+  8008af:	89 85 88 fc ff ff    	mov    %eax,-0x378(%ebp)
+  8008b5:	8b 4a 04             	mov    0x4(%edx),%ecx
+  8008b8:	89 8d 90 fc ff ff    	mov    %ecx,-0x370(%ebp)
+  8008be:	c7 85 94 fc ff ff 00 	movl   $0x0,-0x36c(%ebp)
+  8008c5:	00 00 00 
+  8008c8:	8b 52 08             	mov    0x8(%edx),%edx
+  8008cb:	89 95 98 fc ff ff    	mov    %edx,-0x368(%ebp)
+  8008d1:	c7 85 9c fc ff ff 00 	movl   $0x0,-0x364(%ebp)
+  8008d8:	00 00 00 
+  8008db:	68 ac 01 00 00       	push   $0x1ac
+  8008e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8008e5:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8008eb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8008f0:	50                   	push   %eax
+  8008f1:	8d 85 4c fe ff ff    	lea    -0x1b4(%ebp),%eax
+  8008f7:	50                   	push   %eax
+  8008f8:	e8 b2 0b 00 00       	call   8014af <memmove>
+  8008fd:	83 c4 0c             	add    $0xc,%esp
+  800900:	68 ac 01 00 00       	push   $0x1ac
+  800905:	89 d8                	mov    %ebx,%eax
+  800907:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80090c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800912:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800917:	50                   	push   %eax
+  800918:	8d 85 a0 fc ff ff    	lea    -0x360(%ebp),%eax
+  80091e:	50                   	push   %eax
+  80091f:	e8 8b 0b 00 00       	call   8014af <memmove>
+  800924:	83 c4 10             	add    $0x10,%esp
+  800927:	83 bd 74 fd ff ff 00 	cmpl   $0x0,-0x28c(%ebp)
+  80092e:	74 5c                	je     80098c <try_send_ipc+0xf6>
+  800930:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  800936:	89 85 8c fc ff ff    	mov    %eax,-0x374(%ebp)
+  80093c:	c7 85 9c fc ff ff 01 	movl   $0x1,-0x364(%ebp)
+  800943:	00 00 00 
+  800946:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  80094c:	83 ec 08             	sub    $0x8,%esp
+  80094f:	50                   	push   %eax
+  800950:	8d 85 88 fc ff ff    	lea    -0x378(%ebp),%eax
+  800956:	50                   	push   %eax
+  800957:	e8 d8 fe ff ff       	call   800834 <send_ipc_req>
+  80095c:	89 c6                	mov    %eax,%esi
+  80095e:	83 c4 10             	add    $0x10,%esp
+  800961:	85 c0                	test   %eax,%eax
+  800963:	0f 89 8f 00 00 00    	jns    8009f8 <try_send_ipc+0x162>
+  800969:	83 ec 0c             	sub    $0xc,%esp
+  80096c:	68 74 42 80 00       	push   $0x804274
+  800971:	e8 92 02 00 00       	call   800c08 <cprintf>
+  800976:	83 c4 0c             	add    $0xc,%esp
+  800979:	56                   	push   %esi
+  80097a:	6a 02                	push   $0x2
+  80097c:	53                   	push   %ebx
+  80097d:	e8 fd 13 00 00       	call   801d7f <sys_env_unsuspend>
+  800982:	83 c4 10             	add    $0x10,%esp
+  800985:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800988:	5b                   	pop    %ebx
+  800989:	5e                   	pop    %esi
+  80098a:	5d                   	pop    %ebp
+  80098b:	c3                   	ret
+  80098c:	8b 95 94 fe ff ff    	mov    -0x16c(%ebp),%edx
+  800992:	8b 85 88 fc ff ff    	mov    -0x378(%ebp),%eax
+  800998:	39 c2                	cmp    %eax,%edx
+  80099a:	75 20                	jne    8009bc <try_send_ipc+0x126>
+  80099c:	83 bd a0 fe ff ff 05 	cmpl   $0x5,-0x160(%ebp)
+  8009a3:	75 2e                	jne    8009d3 <try_send_ipc+0x13d>
+  8009a5:	83 ec 0c             	sub    $0xc,%esp
+  8009a8:	50                   	push   %eax
+  8009a9:	e8 35 f7 ff ff       	call   8000e3 <find_lease>
+  8009ae:	83 c4 10             	add    $0x10,%esp
+  8009b1:	85 c0                	test   %eax,%eax
+  8009b3:	78 39                	js     8009ee <try_send_ipc+0x158>
+  8009b5:	a1 2c 60 80 00       	mov    0x80602c,%eax
+  8009ba:	eb 90                	jmp    80094c <try_send_ipc+0xb6>
+  8009bc:	83 ec 0c             	sub    $0xc,%esp
+  8009bf:	68 30 43 80 00       	push   $0x804330
+  8009c4:	e8 3f 02 00 00       	call   800c08 <cprintf>
+  8009c9:	83 c4 10             	add    $0x10,%esp
+  8009cc:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+  8009d1:	eb 96                	jmp    800969 <try_send_ipc+0xd3>
+  8009d3:	83 ec 08             	sub    $0x8,%esp
+  8009d6:	52                   	push   %edx
+  8009d7:	68 34 42 80 00       	push   $0x804234
+  8009dc:	e8 27 02 00 00       	call   800c08 <cprintf>
+  8009e1:	83 c4 10             	add    $0x10,%esp
+  8009e4:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+  8009e9:	e9 7b ff ff ff       	jmp    800969 <try_send_ipc+0xd3>
+  8009ee:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+  8009f3:	e9 71 ff ff ff       	jmp    800969 <try_send_ipc+0xd3>
+  8009f8:	83 ec 04             	sub    $0x4,%esp
+  8009fb:	6a 00                	push   $0x0
+  8009fd:	6a 02                	push   $0x2
+  8009ff:	53                   	push   %ebx
+  800a00:	e8 7a 13 00 00       	call   801d7f <sys_env_unsuspend>
+  800a05:	83 c4 10             	add    $0x10,%esp
+  800a08:	e9 78 ff ff ff       	jmp    800985 <try_send_ipc+0xef>
+
+00800a0d <process_request>:
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	83 ec 1c             	sub    $0x1c,%esp
+  800a13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a16:	50                   	push   %eax
+  800a17:	68 00 10 40 00       	push   $0x401000
+  800a1c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a1f:	50                   	push   %eax
+  800a20:	e8 4b 16 00 00       	call   802070 <ipc_recv>
+  800a25:	83 c4 10             	add    $0x10,%esp
+  800a28:	83 f8 01             	cmp    $0x1,%eax
+  800a2b:	74 24                	je     800a51 <process_request+0x44>
+  800a2d:	83 f8 02             	cmp    $0x2,%eax
+  800a30:	74 32                	je     800a64 <process_request+0x57>
+  800a32:	85 c0                	test   %eax,%eax
+  800a34:	74 02                	je     800a38 <process_request+0x2b>
+  800a36:	c9                   	leave
+  800a37:	c3                   	ret
+  800a38:	83 ec 08             	sub    $0x8,%esp
+  800a3b:	ff 35 04 10 40 00    	push   0x401004
+  800a41:	ff 35 00 10 40 00    	push   0x401000
+  800a47:	e8 7d fb ff ff       	call   8005c9 <try_send_lease>
+  800a4c:	83 c4 10             	add    $0x10,%esp
+  800a4f:	eb e5                	jmp    800a36 <process_request+0x29>
+  800a51:	83 ec 0c             	sub    $0xc,%esp
+  800a54:	ff 35 00 10 40 00    	push   0x401000
+  800a5a:	e8 6b fc ff ff       	call   8006ca <try_send_lease_completed>
+  800a5f:	83 c4 10             	add    $0x10,%esp
+  800a62:	eb d2                	jmp    800a36 <process_request+0x29>
+  800a64:	83 ec 04             	sub    $0x4,%esp
+  800a67:	ff 75 f4             	push   -0xc(%ebp)
+  800a6a:	68 00 10 40 00       	push   $0x401000
+  800a6f:	ff 75 f0             	push   -0x10(%ebp)
+  800a72:	e8 1f fe ff ff       	call   800896 <try_send_ipc>
+  800a77:	83 c4 10             	add    $0x10,%esp
+  800a7a:	eb ba                	jmp    800a36 <process_request+0x29>
+
+00800a7c <umain>:
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	83 ec 14             	sub    $0x14,%esp
+  800a82:	68 33 00 80 00       	push   $0x800033
+  800a87:	e8 41 15 00 00       	call   801fcd <set_pgfault_handler>
+  800a8c:	83 c4 10             	add    $0x10,%esp
+  800a8f:	e8 72 f6 ff ff       	call   800106 <check_lease_complete>
+  800a94:	a1 48 60 80 00       	mov    0x806048,%eax
+  800a99:	8b 40 48             	mov    0x48(%eax),%eax
+  800a9c:	83 ec 08             	sub    $0x8,%esp
+  800a9f:	50                   	push   %eax
+  800aa0:	68 98 42 80 00       	push   $0x804298
+  800aa5:	e8 5e 01 00 00       	call   800c08 <cprintf>
+  800aaa:	e8 5e ff ff ff       	call   800a0d <process_request>
+  800aaf:	83 c4 10             	add    $0x10,%esp
+  800ab2:	eb db                	jmp    800a8f <umain+0x13>
+
+00800ab4 <libmain>:
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	56                   	push   %esi
+  800ab8:	53                   	push   %ebx
+  800ab9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800abc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800abf:	e8 31 0c 00 00       	call   8016f5 <sys_getenvid>
+  800ac4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800ac9:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800acf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800ad4:	a3 48 60 80 00       	mov    %eax,0x806048
+  800ad9:	85 db                	test   %ebx,%ebx
+  800adb:	7e 07                	jle    800ae4 <libmain+0x30>
+  800add:	8b 06                	mov    (%esi),%eax
+  800adf:	a3 00 50 80 00       	mov    %eax,0x805000
+  800ae4:	83 ec 08             	sub    $0x8,%esp
+  800ae7:	56                   	push   %esi
+  800ae8:	53                   	push   %ebx
+  800ae9:	e8 8e ff ff ff       	call   800a7c <umain>
+  800aee:	e8 0a 00 00 00       	call   800afd <exit>
+  800af3:	83 c4 10             	add    $0x10,%esp
+  800af6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800af9:	5b                   	pop    %ebx
+  800afa:	5e                   	pop    %esi
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <exit>:
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	83 ec 08             	sub    $0x8,%esp
+  800b03:	a1 48 60 80 00       	mov    0x806048,%eax
+  800b08:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800b0e:	85 c0                	test   %eax,%eax
+  800b10:	75 14                	jne    800b26 <exit+0x29>
+  800b12:	e8 90 19 00 00       	call   8024a7 <close_all>
+  800b17:	83 ec 0c             	sub    $0xc,%esp
+  800b1a:	6a 00                	push   $0x0
+  800b1c:	e8 93 0b 00 00       	call   8016b4 <sys_env_destroy>
+  800b21:	83 c4 10             	add    $0x10,%esp
+  800b24:	c9                   	leave
+  800b25:	c3                   	ret
+  800b26:	e8 f6 12 00 00       	call   801e21 <sys_lease_complete>
+  800b2b:	eb e5                	jmp    800b12 <exit+0x15>
+
+00800b2d <_panic>:
+  800b2d:	55                   	push   %ebp
+  800b2e:	89 e5                	mov    %esp,%ebp
+  800b30:	56                   	push   %esi
+  800b31:	53                   	push   %ebx
+  800b32:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800b35:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800b3b:	e8 b5 0b 00 00       	call   8016f5 <sys_getenvid>
+  800b40:	83 ec 0c             	sub    $0xc,%esp
+  800b43:	ff 75 0c             	push   0xc(%ebp)
+  800b46:	ff 75 08             	push   0x8(%ebp)
+  800b49:	56                   	push   %esi
+  800b4a:	50                   	push   %eax
+  800b4b:	68 70 43 80 00       	push   $0x804370
+  800b50:	e8 b3 00 00 00       	call   800c08 <cprintf>
+  800b55:	83 c4 18             	add    $0x18,%esp
+  800b58:	53                   	push   %ebx
+  800b59:	ff 75 10             	push   0x10(%ebp)
+  800b5c:	e8 56 00 00 00       	call   800bb7 <vcprintf>
+  800b61:	c7 04 24 f8 42 80 00 	movl   $0x8042f8,(%esp)
+  800b68:	e8 9b 00 00 00       	call   800c08 <cprintf>
+  800b6d:	83 c4 10             	add    $0x10,%esp
+  800b70:	cc                   	int3
+  800b71:	eb fd                	jmp    800b70 <_panic+0x43>
+
+00800b73 <putch>:
+  800b73:	55                   	push   %ebp
+  800b74:	89 e5                	mov    %esp,%ebp
+  800b76:	53                   	push   %ebx
+  800b77:	83 ec 04             	sub    $0x4,%esp
+  800b7a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b7d:	8b 13                	mov    (%ebx),%edx
+  800b7f:	8d 42 01             	lea    0x1(%edx),%eax
+  800b82:	89 03                	mov    %eax,(%ebx)
+  800b84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b87:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800b8b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800b90:	74 09                	je     800b9b <putch+0x28>
+  800b92:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800b96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b99:	c9                   	leave
+  800b9a:	c3                   	ret
+  800b9b:	83 ec 08             	sub    $0x8,%esp
+  800b9e:	68 ff 00 00 00       	push   $0xff
+  800ba3:	8d 43 08             	lea    0x8(%ebx),%eax
+  800ba6:	50                   	push   %eax
+  800ba7:	e8 cb 0a 00 00       	call   801677 <sys_cputs>
+  800bac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800bb2:	83 c4 10             	add    $0x10,%esp
+  800bb5:	eb db                	jmp    800b92 <putch+0x1f>
+
+00800bb7 <vcprintf>:
+  800bb7:	55                   	push   %ebp
+  800bb8:	89 e5                	mov    %esp,%ebp
+  800bba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800bc0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800bc7:	00 00 00 
+  800bca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800bd1:	00 00 00 
+  800bd4:	ff 75 0c             	push   0xc(%ebp)
+  800bd7:	ff 75 08             	push   0x8(%ebp)
+  800bda:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800be0:	50                   	push   %eax
+  800be1:	68 73 0b 80 00       	push   $0x800b73
+  800be6:	e8 1c 01 00 00       	call   800d07 <vprintfmt>
+  800beb:	83 c4 08             	add    $0x8,%esp
+  800bee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800bf4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800bfa:	50                   	push   %eax
+  800bfb:	e8 77 0a 00 00       	call   801677 <sys_cputs>
+  800c00:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c06:	c9                   	leave
+  800c07:	c3                   	ret
+
+00800c08 <cprintf>:
+  800c08:	55                   	push   %ebp
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	83 ec 10             	sub    $0x10,%esp
+  800c0e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800c11:	50                   	push   %eax
+  800c12:	ff 75 08             	push   0x8(%ebp)
+  800c15:	e8 9d ff ff ff       	call   800bb7 <vcprintf>
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+
+00800c1c <printnum>:
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	56                   	push   %esi
+  800c21:	53                   	push   %ebx
+  800c22:	83 ec 1c             	sub    $0x1c,%esp
+  800c25:	89 c3                	mov    %eax,%ebx
+  800c27:	89 d6                	mov    %edx,%esi
+  800c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c2f:	89 d1                	mov    %edx,%ecx
+  800c31:	89 c2                	mov    %eax,%edx
+  800c33:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800c36:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c39:	8b 45 10             	mov    0x10(%ebp),%eax
+  800c3c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c3f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800c46:	39 c2                	cmp    %eax,%edx
+  800c48:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800c4b:	73 4b                	jae    800c98 <printnum+0x7c>
+  800c4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c50:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800c53:	85 ff                	test   %edi,%edi
+  800c55:	7e 11                	jle    800c68 <printnum+0x4c>
+  800c57:	83 ec 08             	sub    $0x8,%esp
+  800c5a:	56                   	push   %esi
+  800c5b:	ff 75 18             	push   0x18(%ebp)
+  800c5e:	ff d3                	call   *%ebx
+  800c60:	83 c4 10             	add    $0x10,%esp
+  800c63:	83 ef 01             	sub    $0x1,%edi
+  800c66:	75 ef                	jne    800c57 <printnum+0x3b>
+  800c68:	83 ec 08             	sub    $0x8,%esp
+  800c6b:	56                   	push   %esi
+  800c6c:	83 ec 04             	sub    $0x4,%esp
+  800c6f:	ff 75 e4             	push   -0x1c(%ebp)
+  800c72:	ff 75 e0             	push   -0x20(%ebp)
+  800c75:	ff 75 dc             	push   -0x24(%ebp)
+  800c78:	ff 75 d8             	push   -0x28(%ebp)
+  800c7b:	e8 18 32 00 00       	call   803e98 <__umoddi3>
+  800c80:	83 c4 14             	add    $0x14,%esp
+  800c83:	0f be 80 93 43 80 00 	movsbl 0x804393(%eax),%eax
+  800c8a:	50                   	push   %eax
+  800c8b:	ff d3                	call   *%ebx
+  800c8d:	83 c4 10             	add    $0x10,%esp
+  800c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5f                   	pop    %edi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+  800c98:	83 ec 0c             	sub    $0xc,%esp
+  800c9b:	ff 75 18             	push   0x18(%ebp)
+  800c9e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ca1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800ca4:	52                   	push   %edx
+  800ca5:	50                   	push   %eax
+  800ca6:	83 ec 08             	sub    $0x8,%esp
+  800ca9:	ff 75 e4             	push   -0x1c(%ebp)
+  800cac:	ff 75 e0             	push   -0x20(%ebp)
+  800caf:	ff 75 dc             	push   -0x24(%ebp)
+  800cb2:	ff 75 d8             	push   -0x28(%ebp)
+  800cb5:	e8 c0 31 00 00       	call   803e7a <__udivdi3>
+  800cba:	83 c4 18             	add    $0x18,%esp
+  800cbd:	52                   	push   %edx
+  800cbe:	50                   	push   %eax
+  800cbf:	89 f2                	mov    %esi,%edx
+  800cc1:	89 d8                	mov    %ebx,%eax
+  800cc3:	e8 54 ff ff ff       	call   800c1c <printnum>
+  800cc8:	83 c4 20             	add    $0x20,%esp
+  800ccb:	eb 9b                	jmp    800c68 <printnum+0x4c>
+
+00800ccd <sprintputch>:
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cd3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800cd7:	8b 10                	mov    (%eax),%edx
+  800cd9:	3b 50 04             	cmp    0x4(%eax),%edx
+  800cdc:	73 0a                	jae    800ce8 <sprintputch+0x1b>
+  800cde:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800ce1:	89 08                	mov    %ecx,(%eax)
+  800ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce6:	88 02                	mov    %al,(%edx)
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <printfmt>:
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	83 ec 08             	sub    $0x8,%esp
+  800cf0:	8d 45 14             	lea    0x14(%ebp),%eax
+  800cf3:	50                   	push   %eax
+  800cf4:	ff 75 10             	push   0x10(%ebp)
+  800cf7:	ff 75 0c             	push   0xc(%ebp)
+  800cfa:	ff 75 08             	push   0x8(%ebp)
+  800cfd:	e8 05 00 00 00       	call   800d07 <vprintfmt>
+  800d02:	83 c4 10             	add    $0x10,%esp
+  800d05:	c9                   	leave
+  800d06:	c3                   	ret
+
+00800d07 <vprintfmt>:
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	57                   	push   %edi
+  800d0b:	56                   	push   %esi
+  800d0c:	53                   	push   %ebx
+  800d0d:	83 ec 2c             	sub    $0x2c,%esp
+  800d10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d13:	89 df                	mov    %ebx,%edi
+  800d15:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d18:	8b 45 10             	mov    0x10(%ebp),%eax
+  800d1b:	8d 70 01             	lea    0x1(%eax),%esi
+  800d1e:	0f b6 00             	movzbl (%eax),%eax
+  800d21:	83 f8 25             	cmp    $0x25,%eax
+  800d24:	74 1e                	je     800d44 <vprintfmt+0x3d>
+  800d26:	85 c0                	test   %eax,%eax
+  800d28:	0f 84 15 05 00 00    	je     801243 <vprintfmt+0x53c>
+  800d2e:	83 ec 08             	sub    $0x8,%esp
+  800d31:	53                   	push   %ebx
+  800d32:	50                   	push   %eax
+  800d33:	ff d7                	call   *%edi
+  800d35:	83 c6 01             	add    $0x1,%esi
+  800d38:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800d3c:	83 c4 10             	add    $0x10,%esp
+  800d3f:	83 f8 25             	cmp    $0x25,%eax
+  800d42:	75 e2                	jne    800d26 <vprintfmt+0x1f>
+  800d44:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800d48:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800d4f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800d56:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800d5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d62:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800d65:	8d 56 01             	lea    0x1(%esi),%edx
+  800d68:	0f b6 0e             	movzbl (%esi),%ecx
+  800d6b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800d6e:	3c 55                	cmp    $0x55,%al
+  800d70:	0f 87 3b 04 00 00    	ja     8011b1 <vprintfmt+0x4aa>
+  800d76:	0f b6 c0             	movzbl %al,%eax
+  800d79:	ff 24 85 e0 44 80 00 	jmp    *0x8044e0(,%eax,4)
+  800d80:	89 75 10             	mov    %esi,0x10(%ebp)
+  800d83:	eb 93                	jmp    800d18 <vprintfmt+0x11>
+  800d85:	89 d6                	mov    %edx,%esi
+  800d87:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800d8b:	eb d8                	jmp    800d65 <vprintfmt+0x5e>
+  800d8d:	89 d6                	mov    %edx,%esi
+  800d8f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800d93:	eb d0                	jmp    800d65 <vprintfmt+0x5e>
+  800d95:	0f b6 c9             	movzbl %cl,%ecx
+  800d98:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800d9b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800d9e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800da2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800da5:	83 f9 09             	cmp    $0x9,%ecx
+  800da8:	77 6f                	ja     800e19 <vprintfmt+0x112>
+  800daa:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800dad:	83 c2 01             	add    $0x1,%edx
+  800db0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800db3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800db7:	0f be 02             	movsbl (%edx),%eax
+  800dba:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dbd:	83 fe 09             	cmp    $0x9,%esi
+  800dc0:	76 eb                	jbe    800dad <vprintfmt+0xa6>
+  800dc2:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800dc5:	89 d6                	mov    %edx,%esi
+  800dc7:	eb 13                	jmp    800ddc <vprintfmt+0xd5>
+  800dc9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dcc:	8b 00                	mov    (%eax),%eax
+  800dce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800dd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd4:	8d 40 04             	lea    0x4(%eax),%eax
+  800dd7:	89 45 14             	mov    %eax,0x14(%ebp)
+  800dda:	89 d6                	mov    %edx,%esi
+  800ddc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800de0:	79 83                	jns    800d65 <vprintfmt+0x5e>
+  800de2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800de5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800de8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800def:	e9 71 ff ff ff       	jmp    800d65 <vprintfmt+0x5e>
+  800df4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800df7:	85 c9                	test   %ecx,%ecx
+  800df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfe:	0f 49 c1             	cmovns %ecx,%eax
+  800e01:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e04:	89 d6                	mov    %edx,%esi
+  800e06:	e9 5a ff ff ff       	jmp    800d65 <vprintfmt+0x5e>
+  800e0b:	89 d6                	mov    %edx,%esi
+  800e0d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800e14:	e9 4c ff ff ff       	jmp    800d65 <vprintfmt+0x5e>
+  800e19:	89 d6                	mov    %edx,%esi
+  800e1b:	eb bf                	jmp    800ddc <vprintfmt+0xd5>
+  800e1d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800e21:	89 d6                	mov    %edx,%esi
+  800e23:	e9 3d ff ff ff       	jmp    800d65 <vprintfmt+0x5e>
+  800e28:	89 55 10             	mov    %edx,0x10(%ebp)
+  800e2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e2e:	8d 70 04             	lea    0x4(%eax),%esi
+  800e31:	83 ec 08             	sub    $0x8,%esp
+  800e34:	53                   	push   %ebx
+  800e35:	ff 30                	push   (%eax)
+  800e37:	ff d7                	call   *%edi
+  800e39:	83 c4 10             	add    $0x10,%esp
+  800e3c:	89 75 14             	mov    %esi,0x14(%ebp)
+  800e3f:	e9 d4 fe ff ff       	jmp    800d18 <vprintfmt+0x11>
+  800e44:	89 55 10             	mov    %edx,0x10(%ebp)
+  800e47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e4a:	8d 70 04             	lea    0x4(%eax),%esi
+  800e4d:	8b 10                	mov    (%eax),%edx
+  800e4f:	89 d0                	mov    %edx,%eax
+  800e51:	f7 d8                	neg    %eax
+  800e53:	0f 48 c2             	cmovs  %edx,%eax
+  800e56:	83 f8 12             	cmp    $0x12,%eax
+  800e59:	7f 23                	jg     800e7e <vprintfmt+0x177>
+  800e5b:	8b 14 85 40 46 80 00 	mov    0x804640(,%eax,4),%edx
+  800e62:	85 d2                	test   %edx,%edx
+  800e64:	74 18                	je     800e7e <vprintfmt+0x177>
+  800e66:	52                   	push   %edx
+  800e67:	68 7f 48 80 00       	push   $0x80487f
+  800e6c:	53                   	push   %ebx
+  800e6d:	57                   	push   %edi
+  800e6e:	e8 77 fe ff ff       	call   800cea <printfmt>
+  800e73:	83 c4 10             	add    $0x10,%esp
+  800e76:	89 75 14             	mov    %esi,0x14(%ebp)
+  800e79:	e9 9a fe ff ff       	jmp    800d18 <vprintfmt+0x11>
+  800e7e:	50                   	push   %eax
+  800e7f:	68 ab 43 80 00       	push   $0x8043ab
+  800e84:	53                   	push   %ebx
+  800e85:	57                   	push   %edi
+  800e86:	e8 5f fe ff ff       	call   800cea <printfmt>
+  800e8b:	83 c4 10             	add    $0x10,%esp
+  800e8e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800e91:	e9 82 fe ff ff       	jmp    800d18 <vprintfmt+0x11>
+  800e96:	89 55 10             	mov    %edx,0x10(%ebp)
+  800e99:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9c:	83 c0 04             	add    $0x4,%eax
+  800e9f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800ea2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea5:	8b 00                	mov    (%eax),%eax
+  800ea7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800eaa:	85 c0                	test   %eax,%eax
+  800eac:	0f 84 61 03 00 00    	je     801213 <vprintfmt+0x50c>
+  800eb2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800eb6:	7e 06                	jle    800ebe <vprintfmt+0x1b7>
+  800eb8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800ebc:	75 29                	jne    800ee7 <vprintfmt+0x1e0>
+  800ebe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ec1:	8d 70 01             	lea    0x1(%eax),%esi
+  800ec4:	0f b6 00             	movzbl (%eax),%eax
+  800ec7:	0f be d0             	movsbl %al,%edx
+  800eca:	85 d2                	test   %edx,%edx
+  800ecc:	0f 84 bb 00 00 00    	je     800f8d <vprintfmt+0x286>
+  800ed2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ed5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ed8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800edb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ede:	eb 7a                	jmp    800f5a <vprintfmt+0x253>
+  800ee0:	c7 45 d0 a4 43 80 00 	movl   $0x8043a4,-0x30(%ebp)
+  800ee7:	83 ec 08             	sub    $0x8,%esp
+  800eea:	ff 75 d4             	push   -0x2c(%ebp)
+  800eed:	ff 75 d0             	push   -0x30(%ebp)
+  800ef0:	e8 e0 03 00 00       	call   8012d5 <strnlen>
+  800ef5:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800ef8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800efb:	83 c4 10             	add    $0x10,%esp
+  800efe:	85 d2                	test   %edx,%edx
+  800f00:	0f 8e d6 02 00 00    	jle    8011dc <vprintfmt+0x4d5>
+  800f06:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800f0a:	83 ec 08             	sub    $0x8,%esp
+  800f0d:	53                   	push   %ebx
+  800f0e:	56                   	push   %esi
+  800f0f:	ff d7                	call   *%edi
+  800f11:	83 c4 10             	add    $0x10,%esp
+  800f14:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800f18:	75 f0                	jne    800f0a <vprintfmt+0x203>
+  800f1a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800f1d:	8d 70 01             	lea    0x1(%eax),%esi
+  800f20:	0f b6 00             	movzbl (%eax),%eax
+  800f23:	0f be d0             	movsbl %al,%edx
+  800f26:	85 d2                	test   %edx,%edx
+  800f28:	0f 84 da 02 00 00    	je     801208 <vprintfmt+0x501>
+  800f2e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800f31:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800f34:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800f37:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800f3a:	eb 1e                	jmp    800f5a <vprintfmt+0x253>
+  800f3c:	83 ec 08             	sub    $0x8,%esp
+  800f3f:	ff 75 0c             	push   0xc(%ebp)
+  800f42:	52                   	push   %edx
+  800f43:	ff 55 08             	call   *0x8(%ebp)
+  800f46:	83 c4 10             	add    $0x10,%esp
+  800f49:	83 eb 01             	sub    $0x1,%ebx
+  800f4c:	83 c6 01             	add    $0x1,%esi
+  800f4f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800f53:	0f be d0             	movsbl %al,%edx
+  800f56:	85 d2                	test   %edx,%edx
+  800f58:	74 2a                	je     800f84 <vprintfmt+0x27d>
+  800f5a:	85 ff                	test   %edi,%edi
+  800f5c:	78 05                	js     800f63 <vprintfmt+0x25c>
+  800f5e:	83 ef 01             	sub    $0x1,%edi
+  800f61:	78 59                	js     800fbc <vprintfmt+0x2b5>
+  800f63:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800f67:	74 d3                	je     800f3c <vprintfmt+0x235>
+  800f69:	0f be c0             	movsbl %al,%eax
+  800f6c:	83 e8 20             	sub    $0x20,%eax
+  800f6f:	83 f8 5e             	cmp    $0x5e,%eax
+  800f72:	76 c8                	jbe    800f3c <vprintfmt+0x235>
+  800f74:	83 ec 08             	sub    $0x8,%esp
+  800f77:	ff 75 0c             	push   0xc(%ebp)
+  800f7a:	6a 3f                	push   $0x3f
+  800f7c:	ff 55 08             	call   *0x8(%ebp)
+  800f7f:	83 c4 10             	add    $0x10,%esp
+  800f82:	eb c5                	jmp    800f49 <vprintfmt+0x242>
+  800f84:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800f87:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f8a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f8d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800f90:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800f94:	7e 1b                	jle    800fb1 <vprintfmt+0x2aa>
+  800f96:	83 ec 08             	sub    $0x8,%esp
+  800f99:	53                   	push   %ebx
+  800f9a:	6a 20                	push   $0x20
+  800f9c:	ff d7                	call   *%edi
+  800f9e:	83 c4 10             	add    $0x10,%esp
+  800fa1:	83 ee 01             	sub    $0x1,%esi
+  800fa4:	75 f0                	jne    800f96 <vprintfmt+0x28f>
+  800fa6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fa9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fac:	e9 67 fd ff ff       	jmp    800d18 <vprintfmt+0x11>
+  800fb1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800fb4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fb7:	e9 5c fd ff ff       	jmp    800d18 <vprintfmt+0x11>
+  800fbc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800fbf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fc2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fc5:	eb c6                	jmp    800f8d <vprintfmt+0x286>
+  800fc7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800fca:	89 55 10             	mov    %edx,0x10(%ebp)
+  800fcd:	83 f9 01             	cmp    $0x1,%ecx
+  800fd0:	7f 1f                	jg     800ff1 <vprintfmt+0x2ea>
+  800fd2:	85 c9                	test   %ecx,%ecx
+  800fd4:	74 67                	je     80103d <vprintfmt+0x336>
+  800fd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fd9:	8b 30                	mov    (%eax),%esi
+  800fdb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800fde:	89 f0                	mov    %esi,%eax
+  800fe0:	c1 f8 1f             	sar    $0x1f,%eax
+  800fe3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800fe6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fe9:	8d 40 04             	lea    0x4(%eax),%eax
+  800fec:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fef:	eb 17                	jmp    801008 <vprintfmt+0x301>
+  800ff1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ff4:	8b 50 04             	mov    0x4(%eax),%edx
+  800ff7:	8b 00                	mov    (%eax),%eax
+  800ff9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ffc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800fff:	8b 45 14             	mov    0x14(%ebp),%eax
+  801002:	8d 40 08             	lea    0x8(%eax),%eax
+  801005:	89 45 14             	mov    %eax,0x14(%ebp)
+  801008:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80100b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80100e:	be 0a 00 00 00       	mov    $0xa,%esi
+  801013:	85 c9                	test   %ecx,%ecx
+  801015:	0f 89 12 01 00 00    	jns    80112d <vprintfmt+0x426>
+  80101b:	83 ec 08             	sub    $0x8,%esp
+  80101e:	53                   	push   %ebx
+  80101f:	6a 2d                	push   $0x2d
+  801021:	ff d7                	call   *%edi
+  801023:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801026:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801029:	f7 da                	neg    %edx
+  80102b:	83 d1 00             	adc    $0x0,%ecx
+  80102e:	f7 d9                	neg    %ecx
+  801030:	83 c4 10             	add    $0x10,%esp
+  801033:	be 0a 00 00 00       	mov    $0xa,%esi
+  801038:	e9 f0 00 00 00       	jmp    80112d <vprintfmt+0x426>
+  80103d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801040:	8b 30                	mov    (%eax),%esi
+  801042:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801045:	89 f0                	mov    %esi,%eax
+  801047:	c1 f8 1f             	sar    $0x1f,%eax
+  80104a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80104d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801050:	8d 40 04             	lea    0x4(%eax),%eax
+  801053:	89 45 14             	mov    %eax,0x14(%ebp)
+  801056:	eb b0                	jmp    801008 <vprintfmt+0x301>
+  801058:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80105b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80105e:	83 f9 01             	cmp    $0x1,%ecx
+  801061:	7f 1e                	jg     801081 <vprintfmt+0x37a>
+  801063:	85 c9                	test   %ecx,%ecx
+  801065:	74 32                	je     801099 <vprintfmt+0x392>
+  801067:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106a:	8b 10                	mov    (%eax),%edx
+  80106c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801071:	8d 40 04             	lea    0x4(%eax),%eax
+  801074:	89 45 14             	mov    %eax,0x14(%ebp)
+  801077:	be 0a 00 00 00       	mov    $0xa,%esi
+  80107c:	e9 ac 00 00 00       	jmp    80112d <vprintfmt+0x426>
+  801081:	8b 45 14             	mov    0x14(%ebp),%eax
+  801084:	8b 10                	mov    (%eax),%edx
+  801086:	8b 48 04             	mov    0x4(%eax),%ecx
+  801089:	8d 40 08             	lea    0x8(%eax),%eax
+  80108c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80108f:	be 0a 00 00 00       	mov    $0xa,%esi
+  801094:	e9 94 00 00 00       	jmp    80112d <vprintfmt+0x426>
+  801099:	8b 45 14             	mov    0x14(%ebp),%eax
+  80109c:	8b 10                	mov    (%eax),%edx
+  80109e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8010a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010a9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8010ae:	eb 7d                	jmp    80112d <vprintfmt+0x426>
+  8010b0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8010b3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8010b6:	83 f9 01             	cmp    $0x1,%ecx
+  8010b9:	7f 1b                	jg     8010d6 <vprintfmt+0x3cf>
+  8010bb:	85 c9                	test   %ecx,%ecx
+  8010bd:	74 2c                	je     8010eb <vprintfmt+0x3e4>
+  8010bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010c2:	8b 10                	mov    (%eax),%edx
+  8010c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8010cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010cf:	be 08 00 00 00       	mov    $0x8,%esi
+  8010d4:	eb 57                	jmp    80112d <vprintfmt+0x426>
+  8010d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010d9:	8b 10                	mov    (%eax),%edx
+  8010db:	8b 48 04             	mov    0x4(%eax),%ecx
+  8010de:	8d 40 08             	lea    0x8(%eax),%eax
+  8010e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010e4:	be 08 00 00 00       	mov    $0x8,%esi
+  8010e9:	eb 42                	jmp    80112d <vprintfmt+0x426>
+  8010eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ee:	8b 10                	mov    (%eax),%edx
+  8010f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8010f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010fb:	be 08 00 00 00       	mov    $0x8,%esi
+  801100:	eb 2b                	jmp    80112d <vprintfmt+0x426>
+  801102:	89 55 10             	mov    %edx,0x10(%ebp)
+  801105:	83 ec 08             	sub    $0x8,%esp
+  801108:	53                   	push   %ebx
+  801109:	6a 30                	push   $0x30
+  80110b:	ff d7                	call   *%edi
+  80110d:	83 c4 08             	add    $0x8,%esp
+  801110:	53                   	push   %ebx
+  801111:	6a 78                	push   $0x78
+  801113:	ff d7                	call   *%edi
+  801115:	8b 45 14             	mov    0x14(%ebp),%eax
+  801118:	8b 10                	mov    (%eax),%edx
+  80111a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111f:	83 c4 10             	add    $0x10,%esp
+  801122:	8d 40 04             	lea    0x4(%eax),%eax
+  801125:	89 45 14             	mov    %eax,0x14(%ebp)
+  801128:	be 10 00 00 00       	mov    $0x10,%esi
+  80112d:	83 ec 0c             	sub    $0xc,%esp
+  801130:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  801134:	50                   	push   %eax
+  801135:	ff 75 e4             	push   -0x1c(%ebp)
+  801138:	56                   	push   %esi
+  801139:	51                   	push   %ecx
+  80113a:	52                   	push   %edx
+  80113b:	89 da                	mov    %ebx,%edx
+  80113d:	89 f8                	mov    %edi,%eax
+  80113f:	e8 d8 fa ff ff       	call   800c1c <printnum>
+  801144:	83 c4 20             	add    $0x20,%esp
+  801147:	e9 cc fb ff ff       	jmp    800d18 <vprintfmt+0x11>
+  80114c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80114f:	89 55 10             	mov    %edx,0x10(%ebp)
+  801152:	83 f9 01             	cmp    $0x1,%ecx
+  801155:	7f 1b                	jg     801172 <vprintfmt+0x46b>
+  801157:	85 c9                	test   %ecx,%ecx
+  801159:	74 2c                	je     801187 <vprintfmt+0x480>
+  80115b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80115e:	8b 10                	mov    (%eax),%edx
+  801160:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801165:	8d 40 04             	lea    0x4(%eax),%eax
+  801168:	89 45 14             	mov    %eax,0x14(%ebp)
+  80116b:	be 10 00 00 00       	mov    $0x10,%esi
+  801170:	eb bb                	jmp    80112d <vprintfmt+0x426>
+  801172:	8b 45 14             	mov    0x14(%ebp),%eax
+  801175:	8b 10                	mov    (%eax),%edx
+  801177:	8b 48 04             	mov    0x4(%eax),%ecx
+  80117a:	8d 40 08             	lea    0x8(%eax),%eax
+  80117d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801180:	be 10 00 00 00       	mov    $0x10,%esi
+  801185:	eb a6                	jmp    80112d <vprintfmt+0x426>
+  801187:	8b 45 14             	mov    0x14(%ebp),%eax
+  80118a:	8b 10                	mov    (%eax),%edx
+  80118c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801191:	8d 40 04             	lea    0x4(%eax),%eax
+  801194:	89 45 14             	mov    %eax,0x14(%ebp)
+  801197:	be 10 00 00 00       	mov    $0x10,%esi
+  80119c:	eb 8f                	jmp    80112d <vprintfmt+0x426>
+  80119e:	89 55 10             	mov    %edx,0x10(%ebp)
+  8011a1:	83 ec 08             	sub    $0x8,%esp
+  8011a4:	53                   	push   %ebx
+  8011a5:	6a 25                	push   $0x25
+  8011a7:	ff d7                	call   *%edi
+  8011a9:	83 c4 10             	add    $0x10,%esp
+  8011ac:	e9 67 fb ff ff       	jmp    800d18 <vprintfmt+0x11>
+  8011b1:	83 ec 08             	sub    $0x8,%esp
+  8011b4:	53                   	push   %ebx
+  8011b5:	6a 25                	push   $0x25
+  8011b7:	ff d7                	call   *%edi
+  8011b9:	83 c4 10             	add    $0x10,%esp
+  8011bc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8011c0:	0f 84 ba fb ff ff    	je     800d80 <vprintfmt+0x79>
+  8011c6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8011c9:	89 f0                	mov    %esi,%eax
+  8011cb:	83 e8 01             	sub    $0x1,%eax
+  8011ce:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8011d2:	75 f7                	jne    8011cb <vprintfmt+0x4c4>
+  8011d4:	89 45 10             	mov    %eax,0x10(%ebp)
+  8011d7:	e9 3c fb ff ff       	jmp    800d18 <vprintfmt+0x11>
+  8011dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8011df:	8d 70 01             	lea    0x1(%eax),%esi
+  8011e2:	0f b6 00             	movzbl (%eax),%eax
+  8011e5:	0f be d0             	movsbl %al,%edx
+  8011e8:	85 d2                	test   %edx,%edx
+  8011ea:	74 11                	je     8011fd <vprintfmt+0x4f6>
+  8011ec:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8011ef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8011f2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8011f5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8011f8:	e9 5d fd ff ff       	jmp    800f5a <vprintfmt+0x253>
+  8011fd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801200:	89 45 14             	mov    %eax,0x14(%ebp)
+  801203:	e9 10 fb ff ff       	jmp    800d18 <vprintfmt+0x11>
+  801208:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80120b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80120e:	e9 05 fb ff ff       	jmp    800d18 <vprintfmt+0x11>
+  801213:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801217:	7e 0a                	jle    801223 <vprintfmt+0x51c>
+  801219:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80121d:	0f 85 bd fc ff ff    	jne    800ee0 <vprintfmt+0x1d9>
+  801223:	ba 28 00 00 00       	mov    $0x28,%edx
+  801228:	b8 28 00 00 00       	mov    $0x28,%eax
+  80122d:	be a5 43 80 00       	mov    $0x8043a5,%esi
+  801232:	89 7d 08             	mov    %edi,0x8(%ebp)
+  801235:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801238:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80123b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80123e:	e9 17 fd ff ff       	jmp    800f5a <vprintfmt+0x253>
+  801243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+
+0080124b <vsnprintf>:
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	83 ec 18             	sub    $0x18,%esp
+  801251:	8b 45 08             	mov    0x8(%ebp),%eax
+  801254:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801257:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80125a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80125e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	74 26                	je     801292 <vsnprintf+0x47>
+  80126c:	85 d2                	test   %edx,%edx
+  80126e:	7e 22                	jle    801292 <vsnprintf+0x47>
+  801270:	ff 75 14             	push   0x14(%ebp)
+  801273:	ff 75 10             	push   0x10(%ebp)
+  801276:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801279:	50                   	push   %eax
+  80127a:	68 cd 0c 80 00       	push   $0x800ccd
+  80127f:	e8 83 fa ff ff       	call   800d07 <vprintfmt>
+  801284:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801287:	c6 00 00             	movb   $0x0,(%eax)
+  80128a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80128d:	83 c4 10             	add    $0x10,%esp
+  801290:	c9                   	leave
+  801291:	c3                   	ret
+  801292:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801297:	eb f7                	jmp    801290 <vsnprintf+0x45>
+
+00801299 <snprintf>:
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	83 ec 08             	sub    $0x8,%esp
+  80129f:	8d 45 14             	lea    0x14(%ebp),%eax
+  8012a2:	50                   	push   %eax
+  8012a3:	ff 75 10             	push   0x10(%ebp)
+  8012a6:	ff 75 0c             	push   0xc(%ebp)
+  8012a9:	ff 75 08             	push   0x8(%ebp)
+  8012ac:	e8 9a ff ff ff       	call   80124b <vsnprintf>
+  8012b1:	c9                   	leave
+  8012b2:	c3                   	ret
+
+008012b3 <strlen>:
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b9:	80 3a 00             	cmpb   $0x0,(%edx)
+  8012bc:	74 10                	je     8012ce <strlen+0x1b>
+  8012be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c3:	83 c0 01             	add    $0x1,%eax
+  8012c6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8012ca:	75 f7                	jne    8012c3 <strlen+0x10>
+  8012cc:	5d                   	pop    %ebp
+  8012cd:	c3                   	ret
+  8012ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d3:	eb f7                	jmp    8012cc <strlen+0x19>
+
+008012d5 <strnlen>:
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012de:	85 d2                	test   %edx,%edx
+  8012e0:	74 16                	je     8012f8 <strnlen+0x23>
+  8012e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8012eb:	74 09                	je     8012f6 <strnlen+0x21>
+  8012ed:	83 c0 01             	add    $0x1,%eax
+  8012f0:	39 d0                	cmp    %edx,%eax
+  8012f2:	75 f3                	jne    8012e7 <strnlen+0x12>
+  8012f4:	89 d0                	mov    %edx,%eax
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+  8012f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fd:	eb f7                	jmp    8012f6 <strnlen+0x21>
+
+008012ff <strcpy>:
+  8012ff:	55                   	push   %ebp
+  801300:	89 e5                	mov    %esp,%ebp
+  801302:	53                   	push   %ebx
+  801303:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801306:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801309:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801312:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801315:	83 c0 01             	add    $0x1,%eax
+  801318:	84 d2                	test   %dl,%dl
+  80131a:	75 f2                	jne    80130e <strcpy+0xf>
+  80131c:	89 c8                	mov    %ecx,%eax
+  80131e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801321:	c9                   	leave
+  801322:	c3                   	ret
+
+00801323 <strcat>:
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	53                   	push   %ebx
+  801327:	83 ec 10             	sub    $0x10,%esp
+  80132a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80132d:	53                   	push   %ebx
+  80132e:	e8 80 ff ff ff       	call   8012b3 <strlen>
+  801333:	83 c4 08             	add    $0x8,%esp
+  801336:	ff 75 0c             	push   0xc(%ebp)
+  801339:	01 d8                	add    %ebx,%eax
+  80133b:	50                   	push   %eax
+  80133c:	e8 be ff ff ff       	call   8012ff <strcpy>
+  801341:	89 d8                	mov    %ebx,%eax
+  801343:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801346:	c9                   	leave
+  801347:	c3                   	ret
+
+00801348 <strncpy>:
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	56                   	push   %esi
+  80134c:	53                   	push   %ebx
+  80134d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801350:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801353:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801356:	85 db                	test   %ebx,%ebx
+  801358:	74 17                	je     801371 <strncpy+0x29>
+  80135a:	01 f3                	add    %esi,%ebx
+  80135c:	89 f0                	mov    %esi,%eax
+  80135e:	83 c0 01             	add    $0x1,%eax
+  801361:	0f b6 0a             	movzbl (%edx),%ecx
+  801364:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801367:	80 f9 01             	cmp    $0x1,%cl
+  80136a:	83 da ff             	sbb    $0xffffffff,%edx
+  80136d:	39 c3                	cmp    %eax,%ebx
+  80136f:	75 ed                	jne    80135e <strncpy+0x16>
+  801371:	89 f0                	mov    %esi,%eax
+  801373:	5b                   	pop    %ebx
+  801374:	5e                   	pop    %esi
+  801375:	5d                   	pop    %ebp
+  801376:	c3                   	ret
+
+00801377 <strlcpy>:
+  801377:	55                   	push   %ebp
+  801378:	89 e5                	mov    %esp,%ebp
+  80137a:	56                   	push   %esi
+  80137b:	53                   	push   %ebx
+  80137c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80137f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801382:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801385:	89 f0                	mov    %esi,%eax
+  801387:	85 db                	test   %ebx,%ebx
+  801389:	74 1e                	je     8013a9 <strlcpy+0x32>
+  80138b:	83 eb 01             	sub    $0x1,%ebx
+  80138e:	74 16                	je     8013a6 <strlcpy+0x2f>
+  801390:	01 f3                	add    %esi,%ebx
+  801392:	0f b6 0a             	movzbl (%edx),%ecx
+  801395:	84 c9                	test   %cl,%cl
+  801397:	74 0d                	je     8013a6 <strlcpy+0x2f>
+  801399:	83 c2 01             	add    $0x1,%edx
+  80139c:	83 c0 01             	add    $0x1,%eax
+  80139f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8013a2:	39 d8                	cmp    %ebx,%eax
+  8013a4:	75 ec                	jne    801392 <strlcpy+0x1b>
+  8013a6:	c6 00 00             	movb   $0x0,(%eax)
+  8013a9:	29 f0                	sub    %esi,%eax
+  8013ab:	5b                   	pop    %ebx
+  8013ac:	5e                   	pop    %esi
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+
+008013af <strcmp>:
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b8:	0f b6 01             	movzbl (%ecx),%eax
+  8013bb:	84 c0                	test   %al,%al
+  8013bd:	74 11                	je     8013d0 <strcmp+0x21>
+  8013bf:	38 02                	cmp    %al,(%edx)
+  8013c1:	75 0d                	jne    8013d0 <strcmp+0x21>
+  8013c3:	83 c1 01             	add    $0x1,%ecx
+  8013c6:	83 c2 01             	add    $0x1,%edx
+  8013c9:	0f b6 01             	movzbl (%ecx),%eax
+  8013cc:	84 c0                	test   %al,%al
+  8013ce:	75 ef                	jne    8013bf <strcmp+0x10>
+  8013d0:	0f b6 c0             	movzbl %al,%eax
+  8013d3:	0f b6 12             	movzbl (%edx),%edx
+  8013d6:	29 d0                	sub    %edx,%eax
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	c3                   	ret
+
+008013da <strncmp>:
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	53                   	push   %ebx
+  8013de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8013e4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8013e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ec:	85 d2                	test   %edx,%edx
+  8013ee:	74 2e                	je     80141e <strncmp+0x44>
+  8013f0:	0f b6 01             	movzbl (%ecx),%eax
+  8013f3:	84 c0                	test   %al,%al
+  8013f5:	74 16                	je     80140d <strncmp+0x33>
+  8013f7:	3a 03                	cmp    (%ebx),%al
+  8013f9:	75 12                	jne    80140d <strncmp+0x33>
+  8013fb:	83 c1 01             	add    $0x1,%ecx
+  8013fe:	83 c3 01             	add    $0x1,%ebx
+  801401:	83 ea 01             	sub    $0x1,%edx
+  801404:	75 ea                	jne    8013f0 <strncmp+0x16>
+  801406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140b:	eb 11                	jmp    80141e <strncmp+0x44>
+  80140d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801412:	85 d2                	test   %edx,%edx
+  801414:	74 08                	je     80141e <strncmp+0x44>
+  801416:	0f b6 01             	movzbl (%ecx),%eax
+  801419:	0f b6 13             	movzbl (%ebx),%edx
+  80141c:	29 d0                	sub    %edx,%eax
+  80141e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801421:	c9                   	leave
+  801422:	c3                   	ret
+
+00801423 <strchr>:
+  801423:	55                   	push   %ebp
+  801424:	89 e5                	mov    %esp,%ebp
+  801426:	8b 45 08             	mov    0x8(%ebp),%eax
+  801429:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  80142d:	0f b6 10             	movzbl (%eax),%edx
+  801430:	84 d2                	test   %dl,%dl
+  801432:	74 15                	je     801449 <strchr+0x26>
+  801434:	38 d1                	cmp    %dl,%cl
+  801436:	74 0f                	je     801447 <strchr+0x24>
+  801438:	83 c0 01             	add    $0x1,%eax
+  80143b:	0f b6 10             	movzbl (%eax),%edx
+  80143e:	84 d2                	test   %dl,%dl
+  801440:	75 f2                	jne    801434 <strchr+0x11>
+  801442:	b8 00 00 00 00       	mov    $0x0,%eax
+  801447:	5d                   	pop    %ebp
+  801448:	c3                   	ret
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144e:	eb f7                	jmp    801447 <strchr+0x24>
+
+00801450 <strfind>:
+  801450:	55                   	push   %ebp
+  801451:	89 e5                	mov    %esp,%ebp
+  801453:	53                   	push   %ebx
+  801454:	8b 45 08             	mov    0x8(%ebp),%eax
+  801457:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80145a:	0f b6 18             	movzbl (%eax),%ebx
+  80145d:	38 d3                	cmp    %dl,%bl
+  80145f:	74 14                	je     801475 <strfind+0x25>
+  801461:	89 d1                	mov    %edx,%ecx
+  801463:	84 db                	test   %bl,%bl
+  801465:	74 0e                	je     801475 <strfind+0x25>
+  801467:	83 c0 01             	add    $0x1,%eax
+  80146a:	0f b6 10             	movzbl (%eax),%edx
+  80146d:	38 ca                	cmp    %cl,%dl
+  80146f:	74 04                	je     801475 <strfind+0x25>
+  801471:	84 d2                	test   %dl,%dl
+  801473:	75 f2                	jne    801467 <strfind+0x17>
+  801475:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801478:	c9                   	leave
+  801479:	c3                   	ret
+
+0080147a <memset>:
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801481:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801484:	85 c9                	test   %ecx,%ecx
+  801486:	74 20                	je     8014a8 <memset+0x2e>
+  801488:	89 f8                	mov    %edi,%eax
+  80148a:	09 c8                	or     %ecx,%eax
+  80148c:	a8 03                	test   $0x3,%al
+  80148e:	75 12                	jne    8014a2 <memset+0x28>
+  801490:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801494:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  80149a:	c1 e9 02             	shr    $0x2,%ecx
+  80149d:	fc                   	cld
+  80149e:	f3 ab                	rep stos %eax,%es:(%edi)
+  8014a0:	eb 06                	jmp    8014a8 <memset+0x2e>
+  8014a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014a5:	fc                   	cld
+  8014a6:	f3 aa                	rep stos %al,%es:(%edi)
+  8014a8:	89 f8                	mov    %edi,%eax
+  8014aa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8014ad:	c9                   	leave
+  8014ae:	c3                   	ret
+
+008014af <memmove>:
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	57                   	push   %edi
+  8014b3:	56                   	push   %esi
+  8014b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014ba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8014bd:	39 c6                	cmp    %eax,%esi
+  8014bf:	73 32                	jae    8014f3 <memmove+0x44>
+  8014c1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8014c4:	39 d0                	cmp    %edx,%eax
+  8014c6:	73 2b                	jae    8014f3 <memmove+0x44>
+  8014c8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  8014cb:	89 d6                	mov    %edx,%esi
+  8014cd:	09 fe                	or     %edi,%esi
+  8014cf:	09 ce                	or     %ecx,%esi
+  8014d1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8014d7:	75 0e                	jne    8014e7 <memmove+0x38>
+  8014d9:	83 ef 04             	sub    $0x4,%edi
+  8014dc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8014df:	c1 e9 02             	shr    $0x2,%ecx
+  8014e2:	fd                   	std
+  8014e3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8014e5:	eb 09                	jmp    8014f0 <memmove+0x41>
+  8014e7:	83 ef 01             	sub    $0x1,%edi
+  8014ea:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8014ed:	fd                   	std
+  8014ee:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8014f0:	fc                   	cld
+  8014f1:	eb 1a                	jmp    80150d <memmove+0x5e>
+  8014f3:	89 f2                	mov    %esi,%edx
+  8014f5:	09 c2                	or     %eax,%edx
+  8014f7:	09 ca                	or     %ecx,%edx
+  8014f9:	f6 c2 03             	test   $0x3,%dl
+  8014fc:	75 0a                	jne    801508 <memmove+0x59>
+  8014fe:	c1 e9 02             	shr    $0x2,%ecx
+  801501:	89 c7                	mov    %eax,%edi
+  801503:	fc                   	cld
+  801504:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801506:	eb 05                	jmp    80150d <memmove+0x5e>
+  801508:	89 c7                	mov    %eax,%edi
+  80150a:	fc                   	cld
+  80150b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80150d:	5e                   	pop    %esi
+  80150e:	5f                   	pop    %edi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+
+00801511 <memcpy>:
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	83 ec 0c             	sub    $0xc,%esp
+  801517:	ff 75 10             	push   0x10(%ebp)
+  80151a:	ff 75 0c             	push   0xc(%ebp)
+  80151d:	ff 75 08             	push   0x8(%ebp)
+  801520:	e8 8a ff ff ff       	call   8014af <memmove>
+  801525:	c9                   	leave
+  801526:	c3                   	ret
+
+00801527 <memcmp>:
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	56                   	push   %esi
+  80152b:	53                   	push   %ebx
+  80152c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80152f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801532:	8b 75 10             	mov    0x10(%ebp),%esi
+  801535:	85 f6                	test   %esi,%esi
+  801537:	74 29                	je     801562 <memcmp+0x3b>
+  801539:	01 c6                	add    %eax,%esi
+  80153b:	0f b6 08             	movzbl (%eax),%ecx
+  80153e:	0f b6 1a             	movzbl (%edx),%ebx
+  801541:	38 d9                	cmp    %bl,%cl
+  801543:	75 11                	jne    801556 <memcmp+0x2f>
+  801545:	83 c0 01             	add    $0x1,%eax
+  801548:	83 c2 01             	add    $0x1,%edx
+  80154b:	39 c6                	cmp    %eax,%esi
+  80154d:	75 ec                	jne    80153b <memcmp+0x14>
+  80154f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801554:	eb 08                	jmp    80155e <memcmp+0x37>
+  801556:	0f b6 c1             	movzbl %cl,%eax
+  801559:	0f b6 db             	movzbl %bl,%ebx
+  80155c:	29 d8                	sub    %ebx,%eax
+  80155e:	5b                   	pop    %ebx
+  80155f:	5e                   	pop    %esi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+  801562:	b8 00 00 00 00       	mov    $0x0,%eax
+  801567:	eb f5                	jmp    80155e <memcmp+0x37>
+
+00801569 <memfind>:
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80156f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801572:	89 c2                	mov    %eax,%edx
+  801574:	03 55 10             	add    0x10(%ebp),%edx
+  801577:	39 d0                	cmp    %edx,%eax
+  801579:	73 0d                	jae    801588 <memfind+0x1f>
+  80157b:	38 08                	cmp    %cl,(%eax)
+  80157d:	74 0d                	je     80158c <memfind+0x23>
+  80157f:	83 c0 01             	add    $0x1,%eax
+  801582:	39 c2                	cmp    %eax,%edx
+  801584:	75 f5                	jne    80157b <memfind+0x12>
+  801586:	eb 06                	jmp    80158e <memfind+0x25>
+  801588:	89 c2                	mov    %eax,%edx
+  80158a:	eb 02                	jmp    80158e <memfind+0x25>
+  80158c:	89 c2                	mov    %eax,%edx
+  80158e:	89 d0                	mov    %edx,%eax
+  801590:	5d                   	pop    %ebp
+  801591:	c3                   	ret
+
+00801592 <strtol>:
+  801592:	55                   	push   %ebp
+  801593:	89 e5                	mov    %esp,%ebp
+  801595:	57                   	push   %edi
+  801596:	56                   	push   %esi
+  801597:	53                   	push   %ebx
+  801598:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80159e:	0f b6 02             	movzbl (%edx),%eax
+  8015a1:	3c 20                	cmp    $0x20,%al
+  8015a3:	74 04                	je     8015a9 <strtol+0x17>
+  8015a5:	3c 09                	cmp    $0x9,%al
+  8015a7:	75 0e                	jne    8015b7 <strtol+0x25>
+  8015a9:	83 c2 01             	add    $0x1,%edx
+  8015ac:	0f b6 02             	movzbl (%edx),%eax
+  8015af:	3c 20                	cmp    $0x20,%al
+  8015b1:	74 f6                	je     8015a9 <strtol+0x17>
+  8015b3:	3c 09                	cmp    $0x9,%al
+  8015b5:	74 f2                	je     8015a9 <strtol+0x17>
+  8015b7:	3c 2b                	cmp    $0x2b,%al
+  8015b9:	74 2a                	je     8015e5 <strtol+0x53>
+  8015bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c0:	3c 2d                	cmp    $0x2d,%al
+  8015c2:	74 2b                	je     8015ef <strtol+0x5d>
+  8015c4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8015ca:	75 0f                	jne    8015db <strtol+0x49>
+  8015cc:	80 3a 30             	cmpb   $0x30,(%edx)
+  8015cf:	74 28                	je     8015f9 <strtol+0x67>
+  8015d1:	85 db                	test   %ebx,%ebx
+  8015d3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015d8:	0f 44 d8             	cmove  %eax,%ebx
+  8015db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8015e3:	eb 46                	jmp    80162b <strtol+0x99>
+  8015e5:	83 c2 01             	add    $0x1,%edx
+  8015e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ed:	eb d5                	jmp    8015c4 <strtol+0x32>
+  8015ef:	83 c2 01             	add    $0x1,%edx
+  8015f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8015f7:	eb cb                	jmp    8015c4 <strtol+0x32>
+  8015f9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8015fd:	74 0e                	je     80160d <strtol+0x7b>
+  8015ff:	85 db                	test   %ebx,%ebx
+  801601:	75 d8                	jne    8015db <strtol+0x49>
+  801603:	83 c2 01             	add    $0x1,%edx
+  801606:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80160b:	eb ce                	jmp    8015db <strtol+0x49>
+  80160d:	83 c2 02             	add    $0x2,%edx
+  801610:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801615:	eb c4                	jmp    8015db <strtol+0x49>
+  801617:	0f be c0             	movsbl %al,%eax
+  80161a:	83 e8 30             	sub    $0x30,%eax
+  80161d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801620:	7d 3a                	jge    80165c <strtol+0xca>
+  801622:	83 c2 01             	add    $0x1,%edx
+  801625:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801629:	01 c1                	add    %eax,%ecx
+  80162b:	0f b6 02             	movzbl (%edx),%eax
+  80162e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801631:	89 f3                	mov    %esi,%ebx
+  801633:	80 fb 09             	cmp    $0x9,%bl
+  801636:	76 df                	jbe    801617 <strtol+0x85>
+  801638:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80163b:	89 f3                	mov    %esi,%ebx
+  80163d:	80 fb 19             	cmp    $0x19,%bl
+  801640:	77 08                	ja     80164a <strtol+0xb8>
+  801642:	0f be c0             	movsbl %al,%eax
+  801645:	83 e8 57             	sub    $0x57,%eax
+  801648:	eb d3                	jmp    80161d <strtol+0x8b>
+  80164a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80164d:	89 f3                	mov    %esi,%ebx
+  80164f:	80 fb 19             	cmp    $0x19,%bl
+  801652:	77 08                	ja     80165c <strtol+0xca>
+  801654:	0f be c0             	movsbl %al,%eax
+  801657:	83 e8 37             	sub    $0x37,%eax
+  80165a:	eb c1                	jmp    80161d <strtol+0x8b>
+  80165c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801660:	74 05                	je     801667 <strtol+0xd5>
+  801662:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801665:	89 10                	mov    %edx,(%eax)
+  801667:	89 c8                	mov    %ecx,%eax
+  801669:	f7 d8                	neg    %eax
+  80166b:	85 ff                	test   %edi,%edi
+  80166d:	0f 45 c8             	cmovne %eax,%ecx
+  801670:	89 c8                	mov    %ecx,%eax
+  801672:	5b                   	pop    %ebx
+  801673:	5e                   	pop    %esi
+  801674:	5f                   	pop    %edi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+
+00801677 <sys_cputs>:
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	57                   	push   %edi
+  80167b:	56                   	push   %esi
+  80167c:	53                   	push   %ebx
+  80167d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801682:	8b 55 08             	mov    0x8(%ebp),%edx
+  801685:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801688:	89 c3                	mov    %eax,%ebx
+  80168a:	89 c7                	mov    %eax,%edi
+  80168c:	89 c6                	mov    %eax,%esi
+  80168e:	cd 30                	int    $0x30
+  801690:	5b                   	pop    %ebx
+  801691:	5e                   	pop    %esi
+  801692:	5f                   	pop    %edi
+  801693:	5d                   	pop    %ebp
+  801694:	c3                   	ret
+
+00801695 <sys_cgetc>:
+  801695:	55                   	push   %ebp
+  801696:	89 e5                	mov    %esp,%ebp
+  801698:	57                   	push   %edi
+  801699:	56                   	push   %esi
+  80169a:	53                   	push   %ebx
+  80169b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8016a5:	89 d1                	mov    %edx,%ecx
+  8016a7:	89 d3                	mov    %edx,%ebx
+  8016a9:	89 d7                	mov    %edx,%edi
+  8016ab:	89 d6                	mov    %edx,%esi
+  8016ad:	cd 30                	int    $0x30
+  8016af:	5b                   	pop    %ebx
+  8016b0:	5e                   	pop    %esi
+  8016b1:	5f                   	pop    %edi
+  8016b2:	5d                   	pop    %ebp
+  8016b3:	c3                   	ret
+
+008016b4 <sys_env_destroy>:
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	57                   	push   %edi
+  8016b8:	56                   	push   %esi
+  8016b9:	53                   	push   %ebx
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8016ca:	89 cb                	mov    %ecx,%ebx
+  8016cc:	89 cf                	mov    %ecx,%edi
+  8016ce:	89 ce                	mov    %ecx,%esi
+  8016d0:	cd 30                	int    $0x30
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	7f 08                	jg     8016de <sys_env_destroy+0x2a>
+  8016d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d9:	5b                   	pop    %ebx
+  8016da:	5e                   	pop    %esi
+  8016db:	5f                   	pop    %edi
+  8016dc:	5d                   	pop    %ebp
+  8016dd:	c3                   	ret
+  8016de:	83 ec 0c             	sub    $0xc,%esp
+  8016e1:	50                   	push   %eax
+  8016e2:	6a 03                	push   $0x3
+  8016e4:	68 ab 46 80 00       	push   $0x8046ab
+  8016e9:	6a 24                	push   $0x24
+  8016eb:	68 c8 46 80 00       	push   $0x8046c8
+  8016f0:	e8 38 f4 ff ff       	call   800b2d <_panic>
+
+008016f5 <sys_getenvid>:
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	57                   	push   %edi
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+  8016fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801700:	b8 02 00 00 00       	mov    $0x2,%eax
+  801705:	89 d1                	mov    %edx,%ecx
+  801707:	89 d3                	mov    %edx,%ebx
+  801709:	89 d7                	mov    %edx,%edi
+  80170b:	89 d6                	mov    %edx,%esi
+  80170d:	cd 30                	int    $0x30
+  80170f:	5b                   	pop    %ebx
+  801710:	5e                   	pop    %esi
+  801711:	5f                   	pop    %edi
+  801712:	5d                   	pop    %ebp
+  801713:	c3                   	ret
+
+00801714 <sys_yield>:
+  801714:	55                   	push   %ebp
+  801715:	89 e5                	mov    %esp,%ebp
+  801717:	57                   	push   %edi
+  801718:	56                   	push   %esi
+  801719:	53                   	push   %ebx
+  80171a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801721:	74 26                	je     801749 <sys_yield+0x35>
+  801723:	ba 00 00 00 00       	mov    $0x0,%edx
+  801728:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80172d:	89 d1                	mov    %edx,%ecx
+  80172f:	89 d3                	mov    %edx,%ebx
+  801731:	89 d7                	mov    %edx,%edi
+  801733:	6a 00                	push   $0x0
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	8d 35 40 17 80 00    	lea    0x801740,%esi
+  80173e:	0f 34                	sysenter
+  801740:	5d                   	pop    %ebp
+  801741:	83 c4 04             	add    $0x4,%esp
+  801744:	5b                   	pop    %ebx
+  801745:	5e                   	pop    %esi
+  801746:	5f                   	pop    %edi
+  801747:	5d                   	pop    %ebp
+  801748:	c3                   	ret
+  801749:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801753:	89 d1                	mov    %edx,%ecx
+  801755:	89 d3                	mov    %edx,%ebx
+  801757:	89 d7                	mov    %edx,%edi
+  801759:	89 d6                	mov    %edx,%esi
+  80175b:	cd 30                	int    $0x30
+  80175d:	eb e5                	jmp    801744 <sys_yield+0x30>
+
+0080175f <sys_page_alloc>:
+  80175f:	55                   	push   %ebp
+  801760:	89 e5                	mov    %esp,%ebp
+  801762:	57                   	push   %edi
+  801763:	56                   	push   %esi
+  801764:	53                   	push   %ebx
+  801765:	83 ec 0c             	sub    $0xc,%esp
+  801768:	be 00 00 00 00       	mov    $0x0,%esi
+  80176d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801770:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801773:	b8 04 00 00 00       	mov    $0x4,%eax
+  801778:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80177b:	89 f7                	mov    %esi,%edi
+  80177d:	cd 30                	int    $0x30
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	7f 08                	jg     80178b <sys_page_alloc+0x2c>
+  801783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5f                   	pop    %edi
+  801789:	5d                   	pop    %ebp
+  80178a:	c3                   	ret
+  80178b:	83 ec 0c             	sub    $0xc,%esp
+  80178e:	50                   	push   %eax
+  80178f:	6a 04                	push   $0x4
+  801791:	68 ab 46 80 00       	push   $0x8046ab
+  801796:	6a 24                	push   $0x24
+  801798:	68 c8 46 80 00       	push   $0x8046c8
+  80179d:	e8 8b f3 ff ff       	call   800b2d <_panic>
+
+008017a2 <sys_page_map>:
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	57                   	push   %edi
+  8017a6:	56                   	push   %esi
+  8017a7:	53                   	push   %ebx
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+  8017ab:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8017b2:	74 33                	je     8017e7 <sys_page_map+0x45>
+  8017b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017c5:	ff 75 18             	push   0x18(%ebp)
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	8d 35 d3 17 80 00    	lea    0x8017d3,%esi
+  8017d1:	0f 34                	sysenter
+  8017d3:	5d                   	pop    %ebp
+  8017d4:	83 c4 04             	add    $0x4,%esp
+  8017d7:	89 c2                	mov    %eax,%edx
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	7f 3d                	jg     80181a <sys_page_map+0x78>
+  8017dd:	89 d0                	mov    %edx,%eax
+  8017df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e2:	5b                   	pop    %ebx
+  8017e3:	5e                   	pop    %esi
+  8017e4:	5f                   	pop    %edi
+  8017e5:	5d                   	pop    %ebp
+  8017e6:	c3                   	ret
+  8017e7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017f8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8017fb:	cd 30                	int    $0x30
+  8017fd:	89 c2                	mov    %eax,%edx
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	7e da                	jle    8017dd <sys_page_map+0x3b>
+  801803:	83 ec 0c             	sub    $0xc,%esp
+  801806:	50                   	push   %eax
+  801807:	6a 05                	push   $0x5
+  801809:	68 ab 46 80 00       	push   $0x8046ab
+  80180e:	6a 24                	push   $0x24
+  801810:	68 c8 46 80 00       	push   $0x8046c8
+  801815:	e8 13 f3 ff ff       	call   800b2d <_panic>
+  80181a:	83 ec 0c             	sub    $0xc,%esp
+  80181d:	50                   	push   %eax
+  80181e:	6a 05                	push   $0x5
+  801820:	68 ab 46 80 00       	push   $0x8046ab
+  801825:	6a 48                	push   $0x48
+  801827:	68 c8 46 80 00       	push   $0x8046c8
+  80182c:	e8 fc f2 ff ff       	call   800b2d <_panic>
+
+00801831 <sys_page_unmap>:
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	57                   	push   %edi
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+  801837:	83 ec 0c             	sub    $0xc,%esp
+  80183a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801842:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801845:	b8 06 00 00 00       	mov    $0x6,%eax
+  80184a:	89 df                	mov    %ebx,%edi
+  80184c:	89 de                	mov    %ebx,%esi
+  80184e:	cd 30                	int    $0x30
+  801850:	85 c0                	test   %eax,%eax
+  801852:	7f 08                	jg     80185c <sys_page_unmap+0x2b>
+  801854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801857:	5b                   	pop    %ebx
+  801858:	5e                   	pop    %esi
+  801859:	5f                   	pop    %edi
+  80185a:	5d                   	pop    %ebp
+  80185b:	c3                   	ret
+  80185c:	83 ec 0c             	sub    $0xc,%esp
+  80185f:	50                   	push   %eax
+  801860:	6a 06                	push   $0x6
+  801862:	68 ab 46 80 00       	push   $0x8046ab
+  801867:	6a 24                	push   $0x24
+  801869:	68 c8 46 80 00       	push   $0x8046c8
+  80186e:	e8 ba f2 ff ff       	call   800b2d <_panic>
+
+00801873 <sys_fork>:
+  801873:	55                   	push   %ebp
+  801874:	89 e5                	mov    %esp,%ebp
+  801876:	57                   	push   %edi
+  801877:	56                   	push   %esi
+  801878:	53                   	push   %ebx
+  801879:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801883:	89 d1                	mov    %edx,%ecx
+  801885:	89 d3                	mov    %edx,%ebx
+  801887:	89 d7                	mov    %edx,%edi
+  801889:	89 d6                	mov    %edx,%esi
+  80188b:	cd 30                	int    $0x30
+  80188d:	5b                   	pop    %ebx
+  80188e:	5e                   	pop    %esi
+  80188f:	5f                   	pop    %edi
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+
+00801892 <sys_env_set_status>:
+  801892:	55                   	push   %ebp
+  801893:	89 e5                	mov    %esp,%ebp
+  801895:	57                   	push   %edi
+  801896:	56                   	push   %esi
+  801897:	53                   	push   %ebx
+  801898:	83 ec 0c             	sub    $0xc,%esp
+  80189b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018ab:	89 df                	mov    %ebx,%edi
+  8018ad:	89 de                	mov    %ebx,%esi
+  8018af:	cd 30                	int    $0x30
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	7f 08                	jg     8018bd <sys_env_set_status+0x2b>
+  8018b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b8:	5b                   	pop    %ebx
+  8018b9:	5e                   	pop    %esi
+  8018ba:	5f                   	pop    %edi
+  8018bb:	5d                   	pop    %ebp
+  8018bc:	c3                   	ret
+  8018bd:	83 ec 0c             	sub    $0xc,%esp
+  8018c0:	50                   	push   %eax
+  8018c1:	6a 08                	push   $0x8
+  8018c3:	68 ab 46 80 00       	push   $0x8046ab
+  8018c8:	6a 24                	push   $0x24
+  8018ca:	68 c8 46 80 00       	push   $0x8046c8
+  8018cf:	e8 59 f2 ff ff       	call   800b2d <_panic>
+
+008018d4 <sys_env_set_trapframe>:
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	57                   	push   %edi
+  8018d8:	56                   	push   %esi
+  8018d9:	53                   	push   %ebx
+  8018da:	83 ec 0c             	sub    $0xc,%esp
+  8018dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8018ed:	89 df                	mov    %ebx,%edi
+  8018ef:	89 de                	mov    %ebx,%esi
+  8018f1:	cd 30                	int    $0x30
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	7f 08                	jg     8018ff <sys_env_set_trapframe+0x2b>
+  8018f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fa:	5b                   	pop    %ebx
+  8018fb:	5e                   	pop    %esi
+  8018fc:	5f                   	pop    %edi
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+  8018ff:	83 ec 0c             	sub    $0xc,%esp
+  801902:	50                   	push   %eax
+  801903:	6a 09                	push   $0x9
+  801905:	68 ab 46 80 00       	push   $0x8046ab
+  80190a:	6a 24                	push   $0x24
+  80190c:	68 c8 46 80 00       	push   $0x8046c8
+  801911:	e8 17 f2 ff ff       	call   800b2d <_panic>
+
+00801916 <sys_env_set_cow>:
+  801916:	55                   	push   %ebp
+  801917:	89 e5                	mov    %esp,%ebp
+  801919:	57                   	push   %edi
+  80191a:	56                   	push   %esi
+  80191b:	53                   	push   %ebx
+  80191c:	83 ec 0c             	sub    $0xc,%esp
+  80191f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801924:	8b 55 08             	mov    0x8(%ebp),%edx
+  801927:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80192a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80192f:	89 df                	mov    %ebx,%edi
+  801931:	89 de                	mov    %ebx,%esi
+  801933:	cd 30                	int    $0x30
+  801935:	85 c0                	test   %eax,%eax
+  801937:	7f 08                	jg     801941 <sys_env_set_cow+0x2b>
+  801939:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193c:	5b                   	pop    %ebx
+  80193d:	5e                   	pop    %esi
+  80193e:	5f                   	pop    %edi
+  80193f:	5d                   	pop    %ebp
+  801940:	c3                   	ret
+  801941:	83 ec 0c             	sub    $0xc,%esp
+  801944:	50                   	push   %eax
+  801945:	6a 20                	push   $0x20
+  801947:	68 ab 46 80 00       	push   $0x8046ab
+  80194c:	6a 24                	push   $0x24
+  80194e:	68 c8 46 80 00       	push   $0x8046c8
+  801953:	e8 d5 f1 ff ff       	call   800b2d <_panic>
+
+00801958 <sys_env_service>:
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	57                   	push   %edi
+  80195c:	56                   	push   %esi
+  80195d:	53                   	push   %ebx
+  80195e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801963:	8b 55 08             	mov    0x8(%ebp),%edx
+  801966:	b8 21 00 00 00       	mov    $0x21,%eax
+  80196b:	89 cb                	mov    %ecx,%ebx
+  80196d:	89 cf                	mov    %ecx,%edi
+  80196f:	89 ce                	mov    %ecx,%esi
+  801971:	cd 30                	int    $0x30
+  801973:	5b                   	pop    %ebx
+  801974:	5e                   	pop    %esi
+  801975:	5f                   	pop    %edi
+  801976:	5d                   	pop    %ebp
+  801977:	c3                   	ret
+
+00801978 <sys_env_set_pgfault_upcall>:
+  801978:	55                   	push   %ebp
+  801979:	89 e5                	mov    %esp,%ebp
+  80197b:	57                   	push   %edi
+  80197c:	56                   	push   %esi
+  80197d:	53                   	push   %ebx
+  80197e:	83 ec 0c             	sub    $0xc,%esp
+  801981:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801986:	8b 55 08             	mov    0x8(%ebp),%edx
+  801989:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801991:	89 df                	mov    %ebx,%edi
+  801993:	89 de                	mov    %ebx,%esi
+  801995:	cd 30                	int    $0x30
+  801997:	85 c0                	test   %eax,%eax
+  801999:	7f 08                	jg     8019a3 <sys_env_set_pgfault_upcall+0x2b>
+  80199b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199e:	5b                   	pop    %ebx
+  80199f:	5e                   	pop    %esi
+  8019a0:	5f                   	pop    %edi
+  8019a1:	5d                   	pop    %ebp
+  8019a2:	c3                   	ret
+  8019a3:	83 ec 0c             	sub    $0xc,%esp
+  8019a6:	50                   	push   %eax
+  8019a7:	6a 0a                	push   $0xa
+  8019a9:	68 ab 46 80 00       	push   $0x8046ab
+  8019ae:	6a 24                	push   $0x24
+  8019b0:	68 c8 46 80 00       	push   $0x8046c8
+  8019b5:	e8 73 f1 ff ff       	call   800b2d <_panic>
+
+008019ba <sys_ipc_try_send>:
+  8019ba:	55                   	push   %ebp
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	57                   	push   %edi
+  8019be:	56                   	push   %esi
+  8019bf:	53                   	push   %ebx
+  8019c0:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8019c7:	74 27                	je     8019f0 <sys_ipc_try_send+0x36>
+  8019c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019cf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019da:	6a 00                	push   $0x0
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	8d 35 e7 19 80 00    	lea    0x8019e7,%esi
+  8019e5:	0f 34                	sysenter
+  8019e7:	5d                   	pop    %ebp
+  8019e8:	83 c4 04             	add    $0x4,%esp
+  8019eb:	5b                   	pop    %ebx
+  8019ec:	5e                   	pop    %esi
+  8019ed:	5f                   	pop    %edi
+  8019ee:	5d                   	pop    %ebp
+  8019ef:	c3                   	ret
+  8019f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a03:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a06:	cd 30                	int    $0x30
+  801a08:	eb e1                	jmp    8019eb <sys_ipc_try_send+0x31>
+
+00801a0a <sys_ipc_recv>:
+  801a0a:	55                   	push   %ebp
+  801a0b:	89 e5                	mov    %esp,%ebp
+  801a0d:	57                   	push   %edi
+  801a0e:	56                   	push   %esi
+  801a0f:	53                   	push   %ebx
+  801a10:	83 ec 0c             	sub    $0xc,%esp
+  801a13:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801a1a:	74 32                	je     801a4e <sys_ipc_recv+0x44>
+  801a1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a24:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a29:	89 cb                	mov    %ecx,%ebx
+  801a2b:	89 cf                	mov    %ecx,%edi
+  801a2d:	6a 00                	push   $0x0
+  801a2f:	55                   	push   %ebp
+  801a30:	89 e5                	mov    %esp,%ebp
+  801a32:	8d 35 3a 1a 80 00    	lea    0x801a3a,%esi
+  801a38:	0f 34                	sysenter
+  801a3a:	5d                   	pop    %ebp
+  801a3b:	83 c4 04             	add    $0x4,%esp
+  801a3e:	89 c2                	mov    %eax,%edx
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	7f 3c                	jg     801a80 <sys_ipc_recv+0x76>
+  801a44:	89 d0                	mov    %edx,%eax
+  801a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a49:	5b                   	pop    %ebx
+  801a4a:	5e                   	pop    %esi
+  801a4b:	5f                   	pop    %edi
+  801a4c:	5d                   	pop    %ebp
+  801a4d:	c3                   	ret
+  801a4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a53:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a58:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a5b:	89 cb                	mov    %ecx,%ebx
+  801a5d:	89 cf                	mov    %ecx,%edi
+  801a5f:	89 ce                	mov    %ecx,%esi
+  801a61:	cd 30                	int    $0x30
+  801a63:	89 c2                	mov    %eax,%edx
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	7e db                	jle    801a44 <sys_ipc_recv+0x3a>
+  801a69:	83 ec 0c             	sub    $0xc,%esp
+  801a6c:	50                   	push   %eax
+  801a6d:	6a 0d                	push   $0xd
+  801a6f:	68 ab 46 80 00       	push   $0x8046ab
+  801a74:	6a 24                	push   $0x24
+  801a76:	68 c8 46 80 00       	push   $0x8046c8
+  801a7b:	e8 ad f0 ff ff       	call   800b2d <_panic>
+  801a80:	83 ec 0c             	sub    $0xc,%esp
+  801a83:	50                   	push   %eax
+  801a84:	6a 0d                	push   $0xd
+  801a86:	68 ab 46 80 00       	push   $0x8046ab
+  801a8b:	6a 48                	push   $0x48
+  801a8d:	68 c8 46 80 00       	push   $0x8046c8
+  801a92:	e8 96 f0 ff ff       	call   800b2d <_panic>
+
+00801a97 <sys_ipc_send>:
+  801a97:	55                   	push   %ebp
+  801a98:	89 e5                	mov    %esp,%ebp
+  801a9a:	57                   	push   %edi
+  801a9b:	56                   	push   %esi
+  801a9c:	53                   	push   %ebx
+  801a9d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801aa4:	74 27                	je     801acd <sys_ipc_send+0x36>
+  801aa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ab1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ab4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ab7:	6a 00                	push   $0x0
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	8d 35 c4 1a 80 00    	lea    0x801ac4,%esi
+  801ac2:	0f 34                	sysenter
+  801ac4:	5d                   	pop    %ebp
+  801ac5:	83 c4 04             	add    $0x4,%esp
+  801ac8:	5b                   	pop    %ebx
+  801ac9:	5e                   	pop    %esi
+  801aca:	5f                   	pop    %edi
+  801acb:	5d                   	pop    %ebp
+  801acc:	c3                   	ret
+  801acd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ad2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ada:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801add:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ae0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ae3:	cd 30                	int    $0x30
+  801ae5:	eb e1                	jmp    801ac8 <sys_ipc_send+0x31>
+
+00801ae7 <sys_ipc_call>:
+  801ae7:	55                   	push   %ebp
+  801ae8:	89 e5                	mov    %esp,%ebp
+  801aea:	57                   	push   %edi
+  801aeb:	56                   	push   %esi
+  801aec:	53                   	push   %ebx
+  801aed:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801af3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801af8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801afb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801afe:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b01:	cd 30                	int    $0x30
+  801b03:	5b                   	pop    %ebx
+  801b04:	5e                   	pop    %esi
+  801b05:	5f                   	pop    %edi
+  801b06:	5d                   	pop    %ebp
+  801b07:	c3                   	ret
+
+00801b08 <sys_ipc_reply_recv>:
+  801b08:	55                   	push   %ebp
+  801b09:	89 e5                	mov    %esp,%ebp
+  801b0b:	57                   	push   %edi
+  801b0c:	56                   	push   %esi
+  801b0d:	53                   	push   %ebx
+  801b0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b14:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b1c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b1f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b22:	cd 30                	int    $0x30
+  801b24:	5b                   	pop    %ebx
+  801b25:	5e                   	pop    %esi
+  801b26:	5f                   	pop    %edi
+  801b27:	5d                   	pop    %ebp
+  801b28:	c3                   	ret
+
+00801b29 <sys_time_msec>:
+  801b29:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801b2e:	85 c0                	test   %eax,%eax
+  801b30:	75 06                	jne    801b38 <sys_time_msec+0xf>
+  801b32:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801b37:	c3                   	ret
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	57                   	push   %edi
+  801b3c:	56                   	push   %esi
+  801b3d:	53                   	push   %ebx
+  801b3e:	83 ec 0c             	sub    $0xc,%esp
+  801b41:	0f 31                	rdtsc
+  801b43:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801b49:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801b4f:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801b55:	29 c8                	sub    %ecx,%eax
+  801b57:	19 da                	sbb    %ebx,%edx
+  801b59:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5e:	57                   	push   %edi
+  801b5f:	56                   	push   %esi
+  801b60:	52                   	push   %edx
+  801b61:	50                   	push   %eax
+  801b62:	e8 13 23 00 00       	call   803e7a <__udivdi3>
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b6d:	5b                   	pop    %ebx
+  801b6e:	5e                   	pop    %esi
+  801b6f:	5f                   	pop    %edi
+  801b70:	5d                   	pop    %ebp
+  801b71:	c3                   	ret
+
+00801b72 <sys_env_swap>:
+  801b72:	55                   	push   %ebp
+  801b73:	89 e5                	mov    %esp,%ebp
+  801b75:	57                   	push   %edi
+  801b76:	56                   	push   %esi
+  801b77:	53                   	push   %ebx
+  801b78:	83 ec 0c             	sub    $0xc,%esp
+  801b7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b83:	b8 12 00 00 00       	mov    $0x12,%eax
+  801b88:	89 cb                	mov    %ecx,%ebx
+  801b8a:	89 cf                	mov    %ecx,%edi
+  801b8c:	89 ce                	mov    %ecx,%esi
+  801b8e:	cd 30                	int    $0x30
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	7f 08                	jg     801b9c <sys_env_swap+0x2a>
+  801b94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b97:	5b                   	pop    %ebx
+  801b98:	5e                   	pop    %esi
+  801b99:	5f                   	pop    %edi
+  801b9a:	5d                   	pop    %ebp
+  801b9b:	c3                   	ret
+  801b9c:	83 ec 0c             	sub    $0xc,%esp
+  801b9f:	50                   	push   %eax
+  801ba0:	6a 12                	push   $0x12
+  801ba2:	68 ab 46 80 00       	push   $0x8046ab
+  801ba7:	6a 24                	push   $0x24
+  801ba9:	68 c8 46 80 00       	push   $0x8046c8
+  801bae:	e8 7a ef ff ff       	call   800b2d <_panic>
+
+00801bb3 <sys_net_try_send>:
+  801bb3:	55                   	push   %ebp
+  801bb4:	89 e5                	mov    %esp,%ebp
+  801bb6:	57                   	push   %edi
+  801bb7:	56                   	push   %esi
+  801bb8:	53                   	push   %ebx
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc7:	b8 13 00 00 00       	mov    $0x13,%eax
+  801bcc:	89 df                	mov    %ebx,%edi
+  801bce:	89 de                	mov    %ebx,%esi
+  801bd0:	cd 30                	int    $0x30
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	7f 08                	jg     801bde <sys_net_try_send+0x2b>
+  801bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd9:	5b                   	pop    %ebx
+  801bda:	5e                   	pop    %esi
+  801bdb:	5f                   	pop    %edi
+  801bdc:	5d                   	pop    %ebp
+  801bdd:	c3                   	ret
+  801bde:	83 ec 0c             	sub    $0xc,%esp
+  801be1:	50                   	push   %eax
+  801be2:	6a 13                	push   $0x13
+  801be4:	68 ab 46 80 00       	push   $0x8046ab
+  801be9:	6a 24                	push   $0x24
+  801beb:	68 c8 46 80 00       	push   $0x8046c8
+  801bf0:	e8 38 ef ff ff       	call   800b2d <_panic>
+
+00801bf5 <sys_net_try_receive>:
+  801bf5:	55                   	push   %ebp
+  801bf6:	89 e5                	mov    %esp,%ebp
+  801bf8:	57                   	push   %edi
+  801bf9:	56                   	push   %esi
+  801bfa:	53                   	push   %ebx
+  801bfb:	83 ec 0c             	sub    $0xc,%esp
+  801bfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c09:	b8 14 00 00 00       	mov    $0x14,%eax
+  801c0e:	89 df                	mov    %ebx,%edi
+  801c10:	89 de                	mov    %ebx,%esi
+  801c12:	cd 30                	int    $0x30
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	7f 08                	jg     801c20 <sys_net_try_receive+0x2b>
+  801c18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1b:	5b                   	pop    %ebx
+  801c1c:	5e                   	pop    %esi
+  801c1d:	5f                   	pop    %edi
+  801c1e:	5d                   	pop    %ebp
+  801c1f:	c3                   	ret
+  801c20:	83 ec 0c             	sub    $0xc,%esp
+  801c23:	50                   	push   %eax
+  801c24:	6a 14                	push   $0x14
+  801c26:	68 ab 46 80 00       	push   $0x8046ab
+  801c2b:	6a 24                	push   $0x24
+  801c2d:	68 c8 46 80 00       	push   $0x8046c8
+  801c32:	e8 f6 ee ff ff       	call   800b2d <_panic>
+
+00801c37 <sys_net_recv_page>:
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	57                   	push   %edi
+  801c3b:	56                   	push   %esi
+  801c3c:	53                   	push   %ebx
+  801c3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c42:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c45:	b8 27 00 00 00       	mov    $0x27,%eax
+  801c4a:	89 cb                	mov    %ecx,%ebx
+  801c4c:	89 cf                	mov    %ecx,%edi
+  801c4e:	89 ce                	mov    %ecx,%esi
+  801c50:	cd 30                	int    $0x30
+  801c52:	5b                   	pop    %ebx
+  801c53:	5e                   	pop    %esi
+  801c54:	5f                   	pop    %edi
+  801c55:	5d                   	pop    %ebp
+  801c56:	c3                   	ret
+
+00801c57 <sys_net_wait>:
+  801c57:	55                   	push   %ebp
+  801c58:	89 e5                	mov    %esp,%ebp
+  801c5a:	57                   	push   %edi
+  801c5b:	56                   	push   %esi
+  801c5c:	53                   	push   %ebx
+  801c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c62:	b8 26 00 00 00       	mov    $0x26,%eax
+  801c67:	89 d1                	mov    %edx,%ecx
+  801c69:	89 d3                	mov    %edx,%ebx
+  801c6b:	89 d7                	mov    %edx,%edi
+  801c6d:	89 d6                	mov    %edx,%esi
+  801c6f:	cd 30                	int    $0x30
+  801c71:	5b                   	pop    %ebx
+  801c72:	5e                   	pop    %esi
+  801c73:	5f                   	pop    %edi
+  801c74:	5d                   	pop    %ebp
+  801c75:	c3                   	ret
+
+00801c76 <sys_get_mac>:
+  801c76:	55                   	push   %ebp
+  801c77:	89 e5                	mov    %esp,%ebp
+  801c79:	57                   	push   %edi
+  801c7a:	56                   	push   %esi
+  801c7b:	53                   	push   %ebx
+  801c7c:	83 ec 0c             	sub    $0xc,%esp
+  801c7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c84:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c8a:	b8 15 00 00 00       	mov    $0x15,%eax
+  801c8f:	89 df                	mov    %ebx,%edi
+  801c91:	89 de                	mov    %ebx,%esi
+  801c93:	cd 30                	int    $0x30
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	7f 08                	jg     801ca1 <sys_get_mac+0x2b>
+  801c99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c9c:	5b                   	pop    %ebx
+  801c9d:	5e                   	pop    %esi
+  801c9e:	5f                   	pop    %edi
+  801c9f:	5d                   	pop    %ebp
+  801ca0:	c3                   	ret
+  801ca1:	83 ec 0c             	sub    $0xc,%esp
+  801ca4:	50                   	push   %eax
+  801ca5:	6a 15                	push   $0x15
+  801ca7:	68 ab 46 80 00       	push   $0x8046ab
+  801cac:	6a 24                	push   $0x24
+  801cae:	68 c8 46 80 00       	push   $0x8046c8
+  801cb3:	e8 75 ee ff ff       	call   800b2d <_panic>
+
+00801cb8 <sys_env_lease>:
+  801cb8:	55                   	push   %ebp
+  801cb9:	89 e5                	mov    %esp,%ebp
+  801cbb:	57                   	push   %edi
+  801cbc:	56                   	push   %esi
+  801cbd:	53                   	push   %ebx
+  801cbe:	83 ec 0c             	sub    $0xc,%esp
+  801cc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ccc:	b8 16 00 00 00       	mov    $0x16,%eax
+  801cd1:	89 df                	mov    %ebx,%edi
+  801cd3:	89 de                	mov    %ebx,%esi
+  801cd5:	cd 30                	int    $0x30
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	7f 08                	jg     801ce3 <sys_env_lease+0x2b>
+  801cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cde:	5b                   	pop    %ebx
+  801cdf:	5e                   	pop    %esi
+  801ce0:	5f                   	pop    %edi
+  801ce1:	5d                   	pop    %ebp
+  801ce2:	c3                   	ret
+  801ce3:	83 ec 0c             	sub    $0xc,%esp
+  801ce6:	50                   	push   %eax
+  801ce7:	6a 16                	push   $0x16
+  801ce9:	68 ab 46 80 00       	push   $0x8046ab
+  801cee:	6a 24                	push   $0x24
+  801cf0:	68 c8 46 80 00       	push   $0x8046c8
+  801cf5:	e8 33 ee ff ff       	call   800b2d <_panic>
+
+00801cfa <sys_copy_mem>:
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	57                   	push   %edi
+  801cfe:	56                   	push   %esi
+  801cff:	53                   	push   %ebx
+  801d00:	83 ec 0c             	sub    $0xc,%esp
+  801d03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d09:	b8 17 00 00 00       	mov    $0x17,%eax
+  801d0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d11:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d14:	8b 75 18             	mov    0x18(%ebp),%esi
+  801d17:	cd 30                	int    $0x30
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	7f 08                	jg     801d25 <sys_copy_mem+0x2b>
+  801d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d20:	5b                   	pop    %ebx
+  801d21:	5e                   	pop    %esi
+  801d22:	5f                   	pop    %edi
+  801d23:	5d                   	pop    %ebp
+  801d24:	c3                   	ret
+  801d25:	83 ec 0c             	sub    $0xc,%esp
+  801d28:	50                   	push   %eax
+  801d29:	6a 17                	push   $0x17
+  801d2b:	68 ab 46 80 00       	push   $0x8046ab
+  801d30:	6a 24                	push   $0x24
+  801d32:	68 c8 46 80 00       	push   $0x8046c8
+  801d37:	e8 f1 ed ff ff       	call   800b2d <_panic>
+
+00801d3c <sys_get_perms>:
+  801d3c:	55                   	push   %ebp
+  801d3d:	89 e5                	mov    %esp,%ebp
+  801d3f:	57                   	push   %edi
+  801d40:	56                   	push   %esi
+  801d41:	53                   	push   %ebx
+  801d42:	83 ec 0c             	sub    $0xc,%esp
+  801d45:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d50:	b8 18 00 00 00       	mov    $0x18,%eax
+  801d55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d58:	89 f7                	mov    %esi,%edi
+  801d5a:	cd 30                	int    $0x30
+  801d5c:	85 c0                	test   %eax,%eax
+  801d5e:	7f 08                	jg     801d68 <sys_get_perms+0x2c>
+  801d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d63:	5b                   	pop    %ebx
+  801d64:	5e                   	pop    %esi
+  801d65:	5f                   	pop    %edi
+  801d66:	5d                   	pop    %ebp
+  801d67:	c3                   	ret
+  801d68:	83 ec 0c             	sub    $0xc,%esp
+  801d6b:	50                   	push   %eax
+  801d6c:	6a 18                	push   $0x18
+  801d6e:	68 ab 46 80 00       	push   $0x8046ab
+  801d73:	6a 24                	push   $0x24
+  801d75:	68 c8 46 80 00       	push   $0x8046c8
+  801d7a:	e8 ae ed ff ff       	call   800b2d <_panic>
+
+00801d7f <sys_env_unsuspend>:
+  801d7f:	55                   	push   %ebp
+  801d80:	89 e5                	mov    %esp,%ebp
+  801d82:	57                   	push   %edi
+  801d83:	56                   	push   %esi
+  801d84:	53                   	push   %ebx
+  801d85:	83 ec 0c             	sub    $0xc,%esp
+  801d88:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d93:	b8 19 00 00 00       	mov    $0x19,%eax
+  801d98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d9b:	89 f7                	mov    %esi,%edi
+  801d9d:	cd 30                	int    $0x30
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	7f 08                	jg     801dab <sys_env_unsuspend+0x2c>
+  801da3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da6:	5b                   	pop    %ebx
+  801da7:	5e                   	pop    %esi
+  801da8:	5f                   	pop    %edi
+  801da9:	5d                   	pop    %ebp
+  801daa:	c3                   	ret
+  801dab:	83 ec 0c             	sub    $0xc,%esp
+  801dae:	50                   	push   %eax
+  801daf:	6a 19                	push   $0x19
+  801db1:	68 ab 46 80 00       	push   $0x8046ab
+  801db6:	6a 24                	push   $0x24
+  801db8:	68 c8 46 80 00       	push   $0x8046c8
+  801dbd:	e8 6b ed ff ff       	call   800b2d <_panic>
+
+00801dc2 <sys_migrate>:
+  801dc2:	55                   	push   %ebp
+  801dc3:	89 e5                	mov    %esp,%ebp
+  801dc5:	57                   	push   %edi
+  801dc6:	56                   	push   %esi
+  801dc7:	53                   	push   %ebx
+  801dc8:	83 ec 0c             	sub    $0xc,%esp
+  801dcb:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801dd0:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801dd6:	76 11                	jbe    801de9 <sys_migrate+0x27>
+  801dd8:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801ddd:	0f b6 08             	movzbl (%eax),%ecx
+  801de0:	05 00 10 00 00       	add    $0x1000,%eax
+  801de5:	39 d0                	cmp    %edx,%eax
+  801de7:	72 f4                	jb     801ddd <sys_migrate+0x1b>
+  801de9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dee:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801df6:	89 cb                	mov    %ecx,%ebx
+  801df8:	89 cf                	mov    %ecx,%edi
+  801dfa:	89 ce                	mov    %ecx,%esi
+  801dfc:	cd 30                	int    $0x30
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	7f 08                	jg     801e0a <sys_migrate+0x48>
+  801e02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e05:	5b                   	pop    %ebx
+  801e06:	5e                   	pop    %esi
+  801e07:	5f                   	pop    %edi
+  801e08:	5d                   	pop    %ebp
+  801e09:	c3                   	ret
+  801e0a:	83 ec 0c             	sub    $0xc,%esp
+  801e0d:	50                   	push   %eax
+  801e0e:	6a 1a                	push   $0x1a
+  801e10:	68 ab 46 80 00       	push   $0x8046ab
+  801e15:	6a 24                	push   $0x24
+  801e17:	68 c8 46 80 00       	push   $0x8046c8
+  801e1c:	e8 0c ed ff ff       	call   800b2d <_panic>
+
+00801e21 <sys_lease_complete>:
+  801e21:	55                   	push   %ebp
+  801e22:	89 e5                	mov    %esp,%ebp
+  801e24:	57                   	push   %edi
+  801e25:	56                   	push   %esi
+  801e26:	53                   	push   %ebx
+  801e27:	83 ec 0c             	sub    $0xc,%esp
+  801e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801e34:	89 d1                	mov    %edx,%ecx
+  801e36:	89 d3                	mov    %edx,%ebx
+  801e38:	89 d7                	mov    %edx,%edi
+  801e3a:	89 d6                	mov    %edx,%esi
+  801e3c:	cd 30                	int    $0x30
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	7f 08                	jg     801e4a <sys_lease_complete+0x29>
+  801e42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e45:	5b                   	pop    %ebx
+  801e46:	5e                   	pop    %esi
+  801e47:	5f                   	pop    %edi
+  801e48:	5d                   	pop    %ebp
+  801e49:	c3                   	ret
+  801e4a:	83 ec 0c             	sub    $0xc,%esp
+  801e4d:	50                   	push   %eax
+  801e4e:	6a 1b                	push   $0x1b
+  801e50:	68 ab 46 80 00       	push   $0x8046ab
+  801e55:	6a 24                	push   $0x24
+  801e57:	68 c8 46 80 00       	push   $0x8046c8
+  801e5c:	e8 cc ec ff ff       	call   800b2d <_panic>
+
+00801e61 <sys_env_set_thisenv>:
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	57                   	push   %edi
+  801e65:	56                   	push   %esi
+  801e66:	53                   	push   %ebx
+  801e67:	83 ec 0c             	sub    $0xc,%esp
+  801e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e75:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801e7a:	89 df                	mov    %ebx,%edi
+  801e7c:	89 de                	mov    %ebx,%esi
+  801e7e:	cd 30                	int    $0x30
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	7f 08                	jg     801e8c <sys_env_set_thisenv+0x2b>
+  801e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5f                   	pop    %edi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+  801e8c:	83 ec 0c             	sub    $0xc,%esp
+  801e8f:	50                   	push   %eax
+  801e90:	6a 1c                	push   $0x1c
+  801e92:	68 ab 46 80 00       	push   $0x8046ab
+  801e97:	6a 24                	push   $0x24
+  801e99:	68 c8 46 80 00       	push   $0x8046c8
+  801e9e:	e8 8a ec ff ff       	call   800b2d <_panic>
+
+00801ea3 <sys_env_set_sched>:
+  801ea3:	55                   	push   %ebp
+  801ea4:	89 e5                	mov    %esp,%ebp
+  801ea6:	57                   	push   %edi
+  801ea7:	56                   	push   %esi
+  801ea8:	53                   	push   %ebx
+  801ea9:	83 ec 0c             	sub    $0xc,%esp
+  801eac:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801ebc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ebf:	89 f7                	mov    %esi,%edi
+  801ec1:	cd 30                	int    $0x30
+  801ec3:	85 c0                	test   %eax,%eax
+  801ec5:	7f 08                	jg     801ecf <sys_env_set_sched+0x2c>
+  801ec7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eca:	5b                   	pop    %ebx
+  801ecb:	5e                   	pop    %esi
+  801ecc:	5f                   	pop    %edi
+  801ecd:	5d                   	pop    %ebp
+  801ece:	c3                   	ret
+  801ecf:	83 ec 0c             	sub    $0xc,%esp
+  801ed2:	50                   	push   %eax
+  801ed3:	6a 1d                	push   $0x1d
+  801ed5:	68 ab 46 80 00       	push   $0x8046ab
+  801eda:	6a 24                	push   $0x24
+  801edc:	68 c8 46 80 00       	push   $0x8046c8
+  801ee1:	e8 47 ec ff ff       	call   800b2d <_panic>
+
+00801ee6 <sys_batch>:
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	57                   	push   %edi
+  801eea:	56                   	push   %esi
+  801eeb:	53                   	push   %ebx
+  801eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ef7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801efc:	89 df                	mov    %ebx,%edi
+  801efe:	89 de                	mov    %ebx,%esi
+  801f00:	cd 30                	int    $0x30
+  801f02:	5b                   	pop    %ebx
+  801f03:	5e                   	pop    %esi
+  801f04:	5f                   	pop    %edi
+  801f05:	5d                   	pop    %ebp
+  801f06:	c3                   	ret
+
+00801f07 <sys_env_stats>:
+  801f07:	55                   	push   %ebp
+  801f08:	89 e5                	mov    %esp,%ebp
+  801f0a:	57                   	push   %edi
+  801f0b:	56                   	push   %esi
+  801f0c:	53                   	push   %ebx
+  801f0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f18:	b8 23 00 00 00       	mov    $0x23,%eax
+  801f1d:	89 df                	mov    %ebx,%edi
+  801f1f:	89 de                	mov    %ebx,%esi
+  801f21:	cd 30                	int    $0x30
+  801f23:	5b                   	pop    %ebx
+  801f24:	5e                   	pop    %esi
+  801f25:	5f                   	pop    %edi
+  801f26:	5d                   	pop    %ebp
+  801f27:	c3                   	ret
+
+00801f28 <sys_trace>:
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	57                   	push   %edi
+  801f2c:	56                   	push   %esi
+  801f2d:	53                   	push   %ebx
+  801f2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f36:	b8 24 00 00 00       	mov    $0x24,%eax
+  801f3b:	89 cb                	mov    %ecx,%ebx
+  801f3d:	89 cf                	mov    %ecx,%edi
+  801f3f:	89 ce                	mov    %ecx,%esi
+  801f41:	cd 30                	int    $0x30
+  801f43:	5b                   	pop    %ebx
+  801f44:	5e                   	pop    %esi
+  801f45:	5f                   	pop    %edi
+  801f46:	5d                   	pop    %ebp
+  801f47:	c3                   	ret
+
+00801f48 <sys_env_set_pager>:
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	57                   	push   %edi
+  801f4c:	56                   	push   %esi
+  801f4d:	53                   	push   %ebx
+  801f4e:	83 ec 0c             	sub    $0xc,%esp
+  801f51:	be 00 00 00 00       	mov    $0x0,%esi
+  801f56:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f5c:	b8 25 00 00 00       	mov    $0x25,%eax
+  801f61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f64:	89 f7                	mov    %esi,%edi
+  801f66:	cd 30                	int    $0x30
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	7f 08                	jg     801f74 <sys_env_set_pager+0x2c>
+  801f6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f6f:	5b                   	pop    %ebx
+  801f70:	5e                   	pop    %esi
+  801f71:	5f                   	pop    %edi
+  801f72:	5d                   	pop    %ebp
+  801f73:	c3                   	ret
+  801f74:	83 ec 0c             	sub    $0xc,%esp
+  801f77:	50                   	push   %eax
+  801f78:	6a 25                	push   $0x25
+  801f7a:	68 ab 46 80 00       	push   $0x8046ab
+  801f7f:	6a 24                	push   $0x24
+  801f81:	68 c8 46 80 00       	push   $0x8046c8
+  801f86:	e8 a2 eb ff ff       	call   800b2d <_panic>
+
+00801f8b <sys_pager_retire>:
+  801f8b:	55                   	push   %ebp
+  801f8c:	89 e5                	mov    %esp,%ebp
+  801f8e:	57                   	push   %edi
+  801f8f:	56                   	push   %esi
+  801f90:	53                   	push   %ebx
+  801f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f99:	b8 28 00 00 00       	mov    $0x28,%eax
+  801f9e:	89 cb                	mov    %ecx,%ebx
+  801fa0:	89 cf                	mov    %ecx,%edi
+  801fa2:	89 ce                	mov    %ecx,%esi
+  801fa4:	cd 30                	int    $0x30
+  801fa6:	5b                   	pop    %ebx
+  801fa7:	5e                   	pop    %esi
+  801fa8:	5f                   	pop    %edi
+  801fa9:	5d                   	pop    %ebp
+  801faa:	c3                   	ret
+
+00801fab <sys_prof>:
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	57                   	push   %edi
+  801faf:	56                   	push   %esi
+  801fb0:	53                   	push   %ebx
+  801fb1:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fbc:	b8 22 00 00 00       	mov    $0x22,%eax
+  801fc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fc4:	89 f7                	mov    %esi,%edi
+  801fc6:	cd 30                	int    $0x30
+  801fc8:	5b                   	pop    %ebx
+  801fc9:	5e                   	pop    %esi
+  801fca:	5f                   	pop    %edi
+  801fcb:	5d                   	pop    %ebp
+  801fcc:	c3                   	ret
+
+00801fcd <set_pgfault_handler>:
+  801fcd:	55                   	push   %ebp
+  801fce:	89 e5                	mov    %esp,%ebp
+  801fd0:	53                   	push   %ebx
+  801fd1:	83 ec 04             	sub    $0x4,%esp
+  801fd4:	83 3d 4c 60 80 00 00 	cmpl   $0x0,0x80604c
+  801fdb:	74 0d                	je     801fea <set_pgfault_handler+0x1d>
+  801fdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe0:	a3 4c 60 80 00       	mov    %eax,0x80604c
+  801fe5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe8:	c9                   	leave
+  801fe9:	c3                   	ret
+  801fea:	e8 06 f7 ff ff       	call   8016f5 <sys_getenvid>
+  801fef:	89 c3                	mov    %eax,%ebx
+  801ff1:	83 ec 04             	sub    $0x4,%esp
+  801ff4:	6a 07                	push   $0x7
+  801ff6:	68 00 f0 7f ee       	push   $0xee7ff000
+  801ffb:	50                   	push   %eax
+  801ffc:	e8 5e f7 ff ff       	call   80175f <sys_page_alloc>
+  802001:	83 c4 10             	add    $0x10,%esp
+  802004:	85 c0                	test   %eax,%eax
+  802006:	78 29                	js     802031 <set_pgfault_handler+0x64>
+  802008:	83 ec 08             	sub    $0x8,%esp
+  80200b:	68 45 20 80 00       	push   $0x802045
+  802010:	53                   	push   %ebx
+  802011:	e8 62 f9 ff ff       	call   801978 <sys_env_set_pgfault_upcall>
+  802016:	83 c4 10             	add    $0x10,%esp
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	79 c0                	jns    801fdd <set_pgfault_handler+0x10>
+  80201d:	83 ec 04             	sub    $0x4,%esp
+  802020:	68 10 47 80 00       	push   $0x804710
+  802025:	6a 27                	push   $0x27
+  802027:	68 42 47 80 00       	push   $0x804742
+  80202c:	e8 fc ea ff ff       	call   800b2d <_panic>
+  802031:	83 ec 04             	sub    $0x4,%esp
+  802034:	68 d8 46 80 00       	push   $0x8046d8
+  802039:	6a 23                	push   $0x23
+  80203b:	68 42 47 80 00       	push   $0x804742
+  802040:	e8 e8 ea ff ff       	call   800b2d <_panic>
+
+00802045 <_pgfault_upcall>:
+  802045:	54                   	push   %esp
+  802046:	a1 4c 60 80 00       	mov    0x80604c,%eax
+  80204b:	ff d0                	call   *%eax
+  80204d:	83 c4 04             	add    $0x4,%esp
+  802050:	89 e3                	mov    %esp,%ebx
+  802052:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802056:	8b 54 24 30          	mov    0x30(%esp),%edx
+  80205a:	89 d4                	mov    %edx,%esp
+  80205c:	51                   	push   %ecx
+  80205d:	89 dc                	mov    %ebx,%esp
+  80205f:	83 ea 04             	sub    $0x4,%edx
+  802062:	89 54 24 30          	mov    %edx,0x30(%esp)
+  802066:	83 c4 08             	add    $0x8,%esp
+  802069:	61                   	popa
+  80206a:	83 c4 04             	add    $0x4,%esp
+  80206d:	9d                   	popf
+  80206e:	5c                   	pop    %esp
+  80206f:	c3                   	ret
+
+00802070 <ipc_recv>:
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	56                   	push   %esi
+  802074:	53                   	push   %ebx
+  802075:	8b 75 08             	mov    0x8(%ebp),%esi
+  802078:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80207b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802085:	0f 44 c2             	cmove  %edx,%eax
+  802088:	83 ec 0c             	sub    $0xc,%esp
+  80208b:	50                   	push   %eax
+  80208c:	e8 79 f9 ff ff       	call   801a0a <sys_ipc_recv>
+  802091:	83 c4 10             	add    $0x10,%esp
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 2a                	js     8020c2 <ipc_recv+0x52>
+  802098:	a1 48 60 80 00       	mov    0x806048,%eax
+  80209d:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8020a3:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8020a9:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8020af:	85 f6                	test   %esi,%esi
+  8020b1:	74 02                	je     8020b5 <ipc_recv+0x45>
+  8020b3:	89 0e                	mov    %ecx,(%esi)
+  8020b5:	85 db                	test   %ebx,%ebx
+  8020b7:	74 02                	je     8020bb <ipc_recv+0x4b>
+  8020b9:	89 13                	mov    %edx,(%ebx)
+  8020bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020be:	5b                   	pop    %ebx
+  8020bf:	5e                   	pop    %esi
+  8020c0:	5d                   	pop    %ebp
+  8020c1:	c3                   	ret
+  8020c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020cc:	eb e1                	jmp    8020af <ipc_recv+0x3f>
+
+008020ce <ipc_send>:
+  8020ce:	55                   	push   %ebp
+  8020cf:	89 e5                	mov    %esp,%ebp
+  8020d1:	57                   	push   %edi
+  8020d2:	56                   	push   %esi
+  8020d3:	53                   	push   %ebx
+  8020d4:	83 ec 0c             	sub    $0xc,%esp
+  8020d7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020dd:	8b 75 14             	mov    0x14(%ebp),%esi
+  8020e0:	85 db                	test   %ebx,%ebx
+  8020e2:	74 1e                	je     802102 <ipc_send+0x34>
+  8020e4:	56                   	push   %esi
+  8020e5:	53                   	push   %ebx
+  8020e6:	57                   	push   %edi
+  8020e7:	ff 75 08             	push   0x8(%ebp)
+  8020ea:	e8 a8 f9 ff ff       	call   801a97 <sys_ipc_send>
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	74 2a                	je     802120 <ipc_send+0x52>
+  8020f6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8020f9:	75 13                	jne    80210e <ipc_send+0x40>
+  8020fb:	e8 14 f6 ff ff       	call   801714 <sys_yield>
+  802100:	eb e2                	jmp    8020e4 <ipc_send+0x16>
+  802102:	be 00 00 00 00       	mov    $0x0,%esi
+  802107:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80210c:	eb d6                	jmp    8020e4 <ipc_send+0x16>
+  80210e:	50                   	push   %eax
+  80210f:	68 50 47 80 00       	push   $0x804750
+  802114:	6a 4f                	push   $0x4f
+  802116:	68 93 47 80 00       	push   $0x804793
+  80211b:	e8 0d ea ff ff       	call   800b2d <_panic>
+  802120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802123:	5b                   	pop    %ebx
+  802124:	5e                   	pop    %esi
+  802125:	5f                   	pop    %edi
+  802126:	5d                   	pop    %ebp
+  802127:	c3                   	ret
+
+00802128 <ipc_call>:
+  802128:	55                   	push   %ebp
+  802129:	89 e5                	mov    %esp,%ebp
+  80212b:	57                   	push   %edi
+  80212c:	56                   	push   %esi
+  80212d:	53                   	push   %ebx
+  80212e:	83 ec 0c             	sub    $0xc,%esp
+  802131:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802135:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  80213a:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  80213e:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802142:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802147:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80214b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80214f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802154:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802158:	eb 05                	jmp    80215f <ipc_call+0x37>
+  80215a:	e8 b5 f5 ff ff       	call   801714 <sys_yield>
+  80215f:	83 ec 0c             	sub    $0xc,%esp
+  802162:	56                   	push   %esi
+  802163:	53                   	push   %ebx
+  802164:	57                   	push   %edi
+  802165:	ff 75 0c             	push   0xc(%ebp)
+  802168:	ff 75 08             	push   0x8(%ebp)
+  80216b:	e8 77 f9 ff ff       	call   801ae7 <sys_ipc_call>
+  802170:	83 c4 20             	add    $0x20,%esp
+  802173:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802176:	74 e2                	je     80215a <ipc_call+0x32>
+  802178:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80217b:	74 2d                	je     8021aa <ipc_call+0x82>
+  80217d:	85 c0                	test   %eax,%eax
+  80217f:	78 4f                	js     8021d0 <ipc_call+0xa8>
+  802181:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802185:	74 10                	je     802197 <ipc_call+0x6f>
+  802187:	a1 48 60 80 00       	mov    0x806048,%eax
+  80218c:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802192:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802195:	89 02                	mov    %eax,(%edx)
+  802197:	a1 48 60 80 00       	mov    0x806048,%eax
+  80219c:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8021a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a5:	5b                   	pop    %ebx
+  8021a6:	5e                   	pop    %esi
+  8021a7:	5f                   	pop    %edi
+  8021a8:	5d                   	pop    %ebp
+  8021a9:	c3                   	ret
+  8021aa:	ff 75 14             	push   0x14(%ebp)
+  8021ad:	ff 75 10             	push   0x10(%ebp)
+  8021b0:	ff 75 0c             	push   0xc(%ebp)
+  8021b3:	ff 75 08             	push   0x8(%ebp)
+  8021b6:	e8 13 ff ff ff       	call   8020ce <ipc_send>
+  8021bb:	83 c4 0c             	add    $0xc,%esp
+  8021be:	ff 75 1c             	push   0x1c(%ebp)
+  8021c1:	ff 75 18             	push   0x18(%ebp)
+  8021c4:	6a 00                	push   $0x0
+  8021c6:	e8 a5 fe ff ff       	call   802070 <ipc_recv>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	eb d2                	jmp    8021a2 <ipc_call+0x7a>
+  8021d0:	50                   	push   %eax
+  8021d1:	68 9d 47 80 00       	push   $0x80479d
+  8021d6:	6a 6d                	push   $0x6d
+  8021d8:	68 93 47 80 00       	push   $0x804793
+  8021dd:	e8 4b e9 ff ff       	call   800b2d <_panic>
+
+008021e2 <ipc_reply_recv>:
+  8021e2:	55                   	push   %ebp
+  8021e3:	89 e5                	mov    %esp,%ebp
+  8021e5:	57                   	push   %edi
+  8021e6:	56                   	push   %esi
+  8021e7:	53                   	push   %ebx
+  8021e8:	83 ec 0c             	sub    $0xc,%esp
+  8021eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021ee:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8021f1:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8021f4:	85 db                	test   %ebx,%ebx
+  8021f6:	0f 84 ac 00 00 00    	je     8022a8 <ipc_reply_recv+0xc6>
+  8021fc:	85 f6                	test   %esi,%esi
+  8021fe:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802203:	0f 45 c6             	cmovne %esi,%eax
+  802206:	83 ec 0c             	sub    $0xc,%esp
+  802209:	50                   	push   %eax
+  80220a:	ff 75 14             	push   0x14(%ebp)
+  80220d:	53                   	push   %ebx
+  80220e:	ff 75 0c             	push   0xc(%ebp)
+  802211:	ff 75 08             	push   0x8(%ebp)
+  802214:	e8 ef f8 ff ff       	call   801b08 <sys_ipc_reply_recv>
+  802219:	83 c4 20             	add    $0x20,%esp
+  80221c:	85 c0                	test   %eax,%eax
+  80221e:	78 3a                	js     80225a <ipc_reply_recv+0x78>
+  802220:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802224:	74 10                	je     802236 <ipc_reply_recv+0x54>
+  802226:	a1 48 60 80 00       	mov    0x806048,%eax
+  80222b:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802231:	8b 55 18             	mov    0x18(%ebp),%edx
+  802234:	89 02                	mov    %eax,(%edx)
+  802236:	85 ff                	test   %edi,%edi
+  802238:	74 0d                	je     802247 <ipc_reply_recv+0x65>
+  80223a:	a1 48 60 80 00       	mov    0x806048,%eax
+  80223f:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802245:	89 07                	mov    %eax,(%edi)
+  802247:	a1 48 60 80 00       	mov    0x806048,%eax
+  80224c:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802255:	5b                   	pop    %ebx
+  802256:	5e                   	pop    %esi
+  802257:	5f                   	pop    %edi
+  802258:	5d                   	pop    %ebp
+  802259:	c3                   	ret
+  80225a:	ff 75 14             	push   0x14(%ebp)
+  80225d:	53                   	push   %ebx
+  80225e:	ff 75 0c             	push   0xc(%ebp)
+  802261:	ff 75 08             	push   0x8(%ebp)
+  802264:	e8 51 f7 ff ff       	call   8019ba <sys_ipc_try_send>
+  802269:	89 c2                	mov    %eax,%edx
+  80226b:	c1 ea 1f             	shr    $0x1f,%edx
+  80226e:	83 c4 10             	add    $0x10,%esp
+  802271:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802274:	0f 95 c1             	setne  %cl
+  802277:	84 d1                	test   %dl,%cl
+  802279:	74 05                	je     802280 <ipc_reply_recv+0x9e>
+  80227b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80227e:	75 12                	jne    802292 <ipc_reply_recv+0xb0>
+  802280:	83 ec 04             	sub    $0x4,%esp
+  802283:	57                   	push   %edi
+  802284:	56                   	push   %esi
+  802285:	ff 75 18             	push   0x18(%ebp)
+  802288:	e8 e3 fd ff ff       	call   802070 <ipc_recv>
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	eb c0                	jmp    802252 <ipc_reply_recv+0x70>
+  802292:	83 ec 04             	sub    $0x4,%esp
+  802295:	50                   	push   %eax
+  802296:	ff 75 08             	push   0x8(%ebp)
+  802299:	68 70 47 80 00       	push   $0x804770
+  80229e:	e8 65 e9 ff ff       	call   800c08 <cprintf>
+  8022a3:	83 c4 10             	add    $0x10,%esp
+  8022a6:	eb d8                	jmp    802280 <ipc_reply_recv+0x9e>
+  8022a8:	85 f6                	test   %esi,%esi
+  8022aa:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8022af:	0f 45 c6             	cmovne %esi,%eax
+  8022b2:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8022b7:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8022be:	e9 43 ff ff ff       	jmp    802206 <ipc_reply_recv+0x24>
+
+008022c3 <ipc_find_env>:
+  8022c3:	55                   	push   %ebp
+  8022c4:	89 e5                	mov    %esp,%ebp
+  8022c6:	83 ec 14             	sub    $0x14,%esp
+  8022c9:	ff 75 08             	push   0x8(%ebp)
+  8022cc:	e8 87 f6 ff ff       	call   801958 <sys_env_service>
+  8022d1:	85 c0                	test   %eax,%eax
+  8022d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d8:	0f 48 c2             	cmovs  %edx,%eax
+  8022db:	c9                   	leave
+  8022dc:	c3                   	ret
+
+008022dd <fd2num>:
+  8022dd:	55                   	push   %ebp
+  8022de:	89 e5                	mov    %esp,%ebp
+  8022e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8022e8:	c1 e8 0c             	shr    $0xc,%eax
+  8022eb:	5d                   	pop    %ebp
+  8022ec:	c3                   	ret
+
+008022ed <fd2data>:
+  8022ed:	55                   	push   %ebp
+  8022ee:	89 e5                	mov    %esp,%ebp
+  8022f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8022f8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8022fd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  802302:	5d                   	pop    %ebp
+  802303:	c3                   	ret
+
+00802304 <fd_alloc>:
+  802304:	55                   	push   %ebp
+  802305:	89 e5                	mov    %esp,%ebp
+  802307:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80230c:	89 c2                	mov    %eax,%edx
+  80230e:	c1 ea 16             	shr    $0x16,%edx
+  802311:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802318:	f6 c2 01             	test   $0x1,%dl
+  80231b:	74 29                	je     802346 <fd_alloc+0x42>
+  80231d:	89 c2                	mov    %eax,%edx
+  80231f:	c1 ea 0c             	shr    $0xc,%edx
+  802322:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802329:	f6 c2 01             	test   $0x1,%dl
+  80232c:	74 18                	je     802346 <fd_alloc+0x42>
+  80232e:	05 00 10 00 00       	add    $0x1000,%eax
+  802333:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  802338:	75 d2                	jne    80230c <fd_alloc+0x8>
+  80233a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802344:	eb 05                	jmp    80234b <fd_alloc+0x47>
+  802346:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80234b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80234e:	89 02                	mov    %eax,(%edx)
+  802350:	89 c8                	mov    %ecx,%eax
+  802352:	5d                   	pop    %ebp
+  802353:	c3                   	ret
+
+00802354 <fd_lookup>:
+  802354:	55                   	push   %ebp
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235a:	83 f8 1f             	cmp    $0x1f,%eax
+  80235d:	77 30                	ja     80238f <fd_lookup+0x3b>
+  80235f:	c1 e0 0c             	shl    $0xc,%eax
+  802362:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  802367:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80236d:	f6 c2 01             	test   $0x1,%dl
+  802370:	74 24                	je     802396 <fd_lookup+0x42>
+  802372:	89 c2                	mov    %eax,%edx
+  802374:	c1 ea 0c             	shr    $0xc,%edx
+  802377:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80237e:	f6 c2 01             	test   $0x1,%dl
+  802381:	74 1a                	je     80239d <fd_lookup+0x49>
+  802383:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802386:	89 02                	mov    %eax,(%edx)
+  802388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238d:	5d                   	pop    %ebp
+  80238e:	c3                   	ret
+  80238f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802394:	eb f7                	jmp    80238d <fd_lookup+0x39>
+  802396:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80239b:	eb f0                	jmp    80238d <fd_lookup+0x39>
+  80239d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023a2:	eb e9                	jmp    80238d <fd_lookup+0x39>
+
+008023a4 <dev_lookup>:
+  8023a4:	55                   	push   %ebp
+  8023a5:	89 e5                	mov    %esp,%ebp
+  8023a7:	53                   	push   %ebx
+  8023a8:	83 ec 04             	sub    $0x4,%esp
+  8023ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b3:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  8023b8:	39 13                	cmp    %edx,(%ebx)
+  8023ba:	74 37                	je     8023f3 <dev_lookup+0x4f>
+  8023bc:	83 c0 01             	add    $0x1,%eax
+  8023bf:	8b 1c 85 38 48 80 00 	mov    0x804838(,%eax,4),%ebx
+  8023c6:	85 db                	test   %ebx,%ebx
+  8023c8:	75 ee                	jne    8023b8 <dev_lookup+0x14>
+  8023ca:	a1 48 60 80 00       	mov    0x806048,%eax
+  8023cf:	8b 40 48             	mov    0x48(%eax),%eax
+  8023d2:	83 ec 04             	sub    $0x4,%esp
+  8023d5:	52                   	push   %edx
+  8023d6:	50                   	push   %eax
+  8023d7:	68 bc 47 80 00       	push   $0x8047bc
+  8023dc:	e8 27 e8 ff ff       	call   800c08 <cprintf>
+  8023e1:	83 c4 10             	add    $0x10,%esp
+  8023e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023ec:	89 1a                	mov    %ebx,(%edx)
+  8023ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f1:	c9                   	leave
+  8023f2:	c3                   	ret
+  8023f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f8:	eb ef                	jmp    8023e9 <dev_lookup+0x45>
+
+008023fa <fd_close>:
+  8023fa:	55                   	push   %ebp
+  8023fb:	89 e5                	mov    %esp,%ebp
+  8023fd:	57                   	push   %edi
+  8023fe:	56                   	push   %esi
+  8023ff:	53                   	push   %ebx
+  802400:	83 ec 24             	sub    $0x24,%esp
+  802403:	8b 75 08             	mov    0x8(%ebp),%esi
+  802406:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802409:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80240c:	50                   	push   %eax
+  80240d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802413:	c1 e8 0c             	shr    $0xc,%eax
+  802416:	50                   	push   %eax
+  802417:	e8 38 ff ff ff       	call   802354 <fd_lookup>
+  80241c:	89 c3                	mov    %eax,%ebx
+  80241e:	83 c4 10             	add    $0x10,%esp
+  802421:	85 c0                	test   %eax,%eax
+  802423:	78 05                	js     80242a <fd_close+0x30>
+  802425:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802428:	74 0f                	je     802439 <fd_close+0x3f>
+  80242a:	85 ff                	test   %edi,%edi
+  80242c:	0f 44 df             	cmove  %edi,%ebx
+  80242f:	89 d8                	mov    %ebx,%eax
+  802431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802434:	5b                   	pop    %ebx
+  802435:	5e                   	pop    %esi
+  802436:	5f                   	pop    %edi
+  802437:	5d                   	pop    %ebp
+  802438:	c3                   	ret
+  802439:	83 ec 08             	sub    $0x8,%esp
+  80243c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80243f:	50                   	push   %eax
+  802440:	ff 36                	push   (%esi)
+  802442:	e8 5d ff ff ff       	call   8023a4 <dev_lookup>
+  802447:	89 c3                	mov    %eax,%ebx
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	85 c0                	test   %eax,%eax
+  80244e:	78 1a                	js     80246a <fd_close+0x70>
+  802450:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802453:	8b 40 10             	mov    0x10(%eax),%eax
+  802456:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	74 0b                	je     80246a <fd_close+0x70>
+  80245f:	83 ec 0c             	sub    $0xc,%esp
+  802462:	56                   	push   %esi
+  802463:	ff d0                	call   *%eax
+  802465:	89 c3                	mov    %eax,%ebx
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	83 ec 08             	sub    $0x8,%esp
+  80246d:	56                   	push   %esi
+  80246e:	6a 00                	push   $0x0
+  802470:	e8 bc f3 ff ff       	call   801831 <sys_page_unmap>
+  802475:	83 c4 10             	add    $0x10,%esp
+  802478:	eb b5                	jmp    80242f <fd_close+0x35>
+
+0080247a <close>:
+  80247a:	55                   	push   %ebp
+  80247b:	89 e5                	mov    %esp,%ebp
+  80247d:	83 ec 20             	sub    $0x20,%esp
+  802480:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802483:	50                   	push   %eax
+  802484:	ff 75 08             	push   0x8(%ebp)
+  802487:	e8 c8 fe ff ff       	call   802354 <fd_lookup>
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	85 c0                	test   %eax,%eax
+  802491:	79 02                	jns    802495 <close+0x1b>
+  802493:	c9                   	leave
+  802494:	c3                   	ret
+  802495:	83 ec 08             	sub    $0x8,%esp
+  802498:	6a 01                	push   $0x1
+  80249a:	ff 75 f4             	push   -0xc(%ebp)
+  80249d:	e8 58 ff ff ff       	call   8023fa <fd_close>
+  8024a2:	83 c4 10             	add    $0x10,%esp
+  8024a5:	eb ec                	jmp    802493 <close+0x19>
+
+008024a7 <close_all>:
+  8024a7:	55                   	push   %ebp
+  8024a8:	89 e5                	mov    %esp,%ebp
+  8024aa:	53                   	push   %ebx
+  8024ab:	83 ec 04             	sub    $0x4,%esp
+  8024ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b3:	83 ec 0c             	sub    $0xc,%esp
+  8024b6:	53                   	push   %ebx
+  8024b7:	e8 be ff ff ff       	call   80247a <close>
+  8024bc:	83 c3 01             	add    $0x1,%ebx
+  8024bf:	83 c4 10             	add    $0x10,%esp
+  8024c2:	83 fb 20             	cmp    $0x20,%ebx
+  8024c5:	75 ec                	jne    8024b3 <close_all+0xc>
+  8024c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ca:	c9                   	leave
+  8024cb:	c3                   	ret
+
+008024cc <dup>:
+  8024cc:	55                   	push   %ebp
+  8024cd:	89 e5                	mov    %esp,%ebp
+  8024cf:	57                   	push   %edi
+  8024d0:	56                   	push   %esi
+  8024d1:	53                   	push   %ebx
+  8024d2:	83 ec 34             	sub    $0x34,%esp
+  8024d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024d8:	50                   	push   %eax
+  8024d9:	ff 75 08             	push   0x8(%ebp)
+  8024dc:	e8 73 fe ff ff       	call   802354 <fd_lookup>
+  8024e1:	89 c3                	mov    %eax,%ebx
+  8024e3:	83 c4 10             	add    $0x10,%esp
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	78 7f                	js     802569 <dup+0x9d>
+  8024ea:	83 ec 0c             	sub    $0xc,%esp
+  8024ed:	ff 75 0c             	push   0xc(%ebp)
+  8024f0:	e8 85 ff ff ff       	call   80247a <close>
+  8024f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8024f8:	c1 e6 0c             	shl    $0xc,%esi
+  8024fb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  802501:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802504:	89 3c 24             	mov    %edi,(%esp)
+  802507:	e8 e1 fd ff ff       	call   8022ed <fd2data>
+  80250c:	89 c3                	mov    %eax,%ebx
+  80250e:	89 34 24             	mov    %esi,(%esp)
+  802511:	e8 d7 fd ff ff       	call   8022ed <fd2data>
+  802516:	83 c4 10             	add    $0x10,%esp
+  802519:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80251c:	89 d8                	mov    %ebx,%eax
+  80251e:	c1 e8 16             	shr    $0x16,%eax
+  802521:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802528:	a8 01                	test   $0x1,%al
+  80252a:	74 11                	je     80253d <dup+0x71>
+  80252c:	89 d8                	mov    %ebx,%eax
+  80252e:	c1 e8 0c             	shr    $0xc,%eax
+  802531:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802538:	f6 c2 01             	test   $0x1,%dl
+  80253b:	75 36                	jne    802573 <dup+0xa7>
+  80253d:	89 f8                	mov    %edi,%eax
+  80253f:	c1 e8 0c             	shr    $0xc,%eax
+  802542:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802549:	83 ec 0c             	sub    $0xc,%esp
+  80254c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802551:	50                   	push   %eax
+  802552:	56                   	push   %esi
+  802553:	6a 00                	push   $0x0
+  802555:	57                   	push   %edi
+  802556:	6a 00                	push   $0x0
+  802558:	e8 45 f2 ff ff       	call   8017a2 <sys_page_map>
+  80255d:	89 c3                	mov    %eax,%ebx
+  80255f:	83 c4 20             	add    $0x20,%esp
+  802562:	85 c0                	test   %eax,%eax
+  802564:	78 33                	js     802599 <dup+0xcd>
+  802566:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802569:	89 d8                	mov    %ebx,%eax
+  80256b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256e:	5b                   	pop    %ebx
+  80256f:	5e                   	pop    %esi
+  802570:	5f                   	pop    %edi
+  802571:	5d                   	pop    %ebp
+  802572:	c3                   	ret
+  802573:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80257a:	83 ec 0c             	sub    $0xc,%esp
+  80257d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802582:	50                   	push   %eax
+  802583:	ff 75 d4             	push   -0x2c(%ebp)
+  802586:	6a 00                	push   $0x0
+  802588:	53                   	push   %ebx
+  802589:	6a 00                	push   $0x0
+  80258b:	e8 12 f2 ff ff       	call   8017a2 <sys_page_map>
+  802590:	89 c3                	mov    %eax,%ebx
+  802592:	83 c4 20             	add    $0x20,%esp
+  802595:	85 c0                	test   %eax,%eax
+  802597:	79 a4                	jns    80253d <dup+0x71>
+  802599:	83 ec 08             	sub    $0x8,%esp
+  80259c:	56                   	push   %esi
+  80259d:	6a 00                	push   $0x0
+  80259f:	e8 8d f2 ff ff       	call   801831 <sys_page_unmap>
+  8025a4:	83 c4 08             	add    $0x8,%esp
+  8025a7:	ff 75 d4             	push   -0x2c(%ebp)
+  8025aa:	6a 00                	push   $0x0
+  8025ac:	e8 80 f2 ff ff       	call   801831 <sys_page_unmap>
+  8025b1:	83 c4 10             	add    $0x10,%esp
+  8025b4:	eb b3                	jmp    802569 <dup+0x9d>
+
+008025b6 <read>:
+  8025b6:	55                   	push   %ebp
+  8025b7:	89 e5                	mov    %esp,%ebp
+  8025b9:	56                   	push   %esi
+  8025ba:	53                   	push   %ebx
+  8025bb:	83 ec 18             	sub    $0x18,%esp
+  8025be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025c4:	50                   	push   %eax
+  8025c5:	56                   	push   %esi
+  8025c6:	e8 89 fd ff ff       	call   802354 <fd_lookup>
+  8025cb:	83 c4 10             	add    $0x10,%esp
+  8025ce:	85 c0                	test   %eax,%eax
+  8025d0:	78 3c                	js     80260e <read+0x58>
+  8025d2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8025d5:	83 ec 08             	sub    $0x8,%esp
+  8025d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025db:	50                   	push   %eax
+  8025dc:	ff 33                	push   (%ebx)
+  8025de:	e8 c1 fd ff ff       	call   8023a4 <dev_lookup>
+  8025e3:	83 c4 10             	add    $0x10,%esp
+  8025e6:	85 c0                	test   %eax,%eax
+  8025e8:	78 24                	js     80260e <read+0x58>
+  8025ea:	8b 43 08             	mov    0x8(%ebx),%eax
+  8025ed:	83 e0 03             	and    $0x3,%eax
+  8025f0:	83 f8 01             	cmp    $0x1,%eax
+  8025f3:	74 20                	je     802615 <read+0x5f>
+  8025f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025f8:	8b 40 08             	mov    0x8(%eax),%eax
+  8025fb:	85 c0                	test   %eax,%eax
+  8025fd:	74 37                	je     802636 <read+0x80>
+  8025ff:	83 ec 04             	sub    $0x4,%esp
+  802602:	ff 75 10             	push   0x10(%ebp)
+  802605:	ff 75 0c             	push   0xc(%ebp)
+  802608:	53                   	push   %ebx
+  802609:	ff d0                	call   *%eax
+  80260b:	83 c4 10             	add    $0x10,%esp
+  80260e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802611:	5b                   	pop    %ebx
+  802612:	5e                   	pop    %esi
+  802613:	5d                   	pop    %ebp
+  802614:	c3                   	ret
+  802615:	a1 48 60 80 00       	mov    0x806048,%eax
+  80261a:	8b 40 48             	mov    0x48(%eax),%eax
+  80261d:	83 ec 04             	sub    $0x4,%esp
+  802620:	56                   	push   %esi
+  802621:	50                   	push   %eax
+  802622:	68 fd 47 80 00       	push   $0x8047fd
+  802627:	e8 dc e5 ff ff       	call   800c08 <cprintf>
+  80262c:	83 c4 10             	add    $0x10,%esp
+  80262f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802634:	eb d8                	jmp    80260e <read+0x58>
+  802636:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80263b:	eb d1                	jmp    80260e <read+0x58>
+
+0080263d <readn>:
+  80263d:	55                   	push   %ebp
+  80263e:	89 e5                	mov    %esp,%ebp
+  802640:	57                   	push   %edi
+  802641:	56                   	push   %esi
+  802642:	53                   	push   %ebx
+  802643:	83 ec 0c             	sub    $0xc,%esp
+  802646:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802649:	8b 75 10             	mov    0x10(%ebp),%esi
+  80264c:	85 f6                	test   %esi,%esi
+  80264e:	74 30                	je     802680 <readn+0x43>
+  802650:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265a:	83 ec 04             	sub    $0x4,%esp
+  80265d:	89 f2                	mov    %esi,%edx
+  80265f:	29 c2                	sub    %eax,%edx
+  802661:	52                   	push   %edx
+  802662:	01 f8                	add    %edi,%eax
+  802664:	50                   	push   %eax
+  802665:	ff 75 08             	push   0x8(%ebp)
+  802668:	e8 49 ff ff ff       	call   8025b6 <read>
+  80266d:	83 c4 10             	add    $0x10,%esp
+  802670:	85 c0                	test   %eax,%eax
+  802672:	78 15                	js     802689 <readn+0x4c>
+  802674:	74 11                	je     802687 <readn+0x4a>
+  802676:	01 c3                	add    %eax,%ebx
+  802678:	89 d8                	mov    %ebx,%eax
+  80267a:	39 f3                	cmp    %esi,%ebx
+  80267c:	72 dc                	jb     80265a <readn+0x1d>
+  80267e:	eb 09                	jmp    802689 <readn+0x4c>
+  802680:	b8 00 00 00 00       	mov    $0x0,%eax
+  802685:	eb 02                	jmp    802689 <readn+0x4c>
+  802687:	89 d8                	mov    %ebx,%eax
+  802689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80268c:	5b                   	pop    %ebx
+  80268d:	5e                   	pop    %esi
+  80268e:	5f                   	pop    %edi
+  80268f:	5d                   	pop    %ebp
+  802690:	c3                   	ret
+
+00802691 <write>:
+  802691:	55                   	push   %ebp
+  802692:	89 e5                	mov    %esp,%ebp
+  802694:	56                   	push   %esi
+  802695:	53                   	push   %ebx
+  802696:	83 ec 18             	sub    $0x18,%esp
+  802699:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80269c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80269f:	50                   	push   %eax
+  8026a0:	53                   	push   %ebx
+  8026a1:	e8 ae fc ff ff       	call   802354 <fd_lookup>
+  8026a6:	83 c4 10             	add    $0x10,%esp
+  8026a9:	85 c0                	test   %eax,%eax
+  8026ab:	78 37                	js     8026e4 <write+0x53>
+  8026ad:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026b0:	83 ec 08             	sub    $0x8,%esp
+  8026b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b6:	50                   	push   %eax
+  8026b7:	ff 36                	push   (%esi)
+  8026b9:	e8 e6 fc ff ff       	call   8023a4 <dev_lookup>
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	78 1f                	js     8026e4 <write+0x53>
+  8026c5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8026c9:	74 20                	je     8026eb <write+0x5a>
+  8026cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ce:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026d1:	85 c0                	test   %eax,%eax
+  8026d3:	74 37                	je     80270c <write+0x7b>
+  8026d5:	83 ec 04             	sub    $0x4,%esp
+  8026d8:	ff 75 10             	push   0x10(%ebp)
+  8026db:	ff 75 0c             	push   0xc(%ebp)
+  8026de:	56                   	push   %esi
+  8026df:	ff d0                	call   *%eax
+  8026e1:	83 c4 10             	add    $0x10,%esp
+  8026e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e7:	5b                   	pop    %ebx
+  8026e8:	5e                   	pop    %esi
+  8026e9:	5d                   	pop    %ebp
+  8026ea:	c3                   	ret
+  8026eb:	a1 48 60 80 00       	mov    0x806048,%eax
+  8026f0:	8b 40 48             	mov    0x48(%eax),%eax
+  8026f3:	83 ec 04             	sub    $0x4,%esp
+  8026f6:	53                   	push   %ebx
+  8026f7:	50                   	push   %eax
+  8026f8:	68 19 48 80 00       	push   $0x804819
+  8026fd:	e8 06 e5 ff ff       	call   800c08 <cprintf>
+  802702:	83 c4 10             	add    $0x10,%esp
+  802705:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80270a:	eb d8                	jmp    8026e4 <write+0x53>
+  80270c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802711:	eb d1                	jmp    8026e4 <write+0x53>
+
+00802713 <seek>:
+  802713:	55                   	push   %ebp
+  802714:	89 e5                	mov    %esp,%ebp
+  802716:	83 ec 20             	sub    $0x20,%esp
+  802719:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80271c:	50                   	push   %eax
+  80271d:	ff 75 08             	push   0x8(%ebp)
+  802720:	e8 2f fc ff ff       	call   802354 <fd_lookup>
+  802725:	83 c4 10             	add    $0x10,%esp
+  802728:	85 c0                	test   %eax,%eax
+  80272a:	78 0e                	js     80273a <seek+0x27>
+  80272c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80272f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802732:	89 50 04             	mov    %edx,0x4(%eax)
+  802735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273a:	c9                   	leave
+  80273b:	c3                   	ret
+
+0080273c <ftruncate>:
+  80273c:	55                   	push   %ebp
+  80273d:	89 e5                	mov    %esp,%ebp
+  80273f:	56                   	push   %esi
+  802740:	53                   	push   %ebx
+  802741:	83 ec 18             	sub    $0x18,%esp
+  802744:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802747:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80274a:	50                   	push   %eax
+  80274b:	53                   	push   %ebx
+  80274c:	e8 03 fc ff ff       	call   802354 <fd_lookup>
+  802751:	83 c4 10             	add    $0x10,%esp
+  802754:	85 c0                	test   %eax,%eax
+  802756:	78 34                	js     80278c <ftruncate+0x50>
+  802758:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80275b:	83 ec 08             	sub    $0x8,%esp
+  80275e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802761:	50                   	push   %eax
+  802762:	ff 36                	push   (%esi)
+  802764:	e8 3b fc ff ff       	call   8023a4 <dev_lookup>
+  802769:	83 c4 10             	add    $0x10,%esp
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	78 1c                	js     80278c <ftruncate+0x50>
+  802770:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802774:	74 1d                	je     802793 <ftruncate+0x57>
+  802776:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802779:	8b 40 18             	mov    0x18(%eax),%eax
+  80277c:	85 c0                	test   %eax,%eax
+  80277e:	74 34                	je     8027b4 <ftruncate+0x78>
+  802780:	83 ec 08             	sub    $0x8,%esp
+  802783:	ff 75 0c             	push   0xc(%ebp)
+  802786:	56                   	push   %esi
+  802787:	ff d0                	call   *%eax
+  802789:	83 c4 10             	add    $0x10,%esp
+  80278c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80278f:	5b                   	pop    %ebx
+  802790:	5e                   	pop    %esi
+  802791:	5d                   	pop    %ebp
+  802792:	c3                   	ret
+  802793:	a1 48 60 80 00       	mov    0x806048,%eax
+  802798:	8b 40 48             	mov    0x48(%eax),%eax
+  80279b:	83 ec 04             	sub    $0x4,%esp
+  80279e:	53                   	push   %ebx
+  80279f:	50                   	push   %eax
+  8027a0:	68 dc 47 80 00       	push   $0x8047dc
+  8027a5:	e8 5e e4 ff ff       	call   800c08 <cprintf>
+  8027aa:	83 c4 10             	add    $0x10,%esp
+  8027ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027b2:	eb d8                	jmp    80278c <ftruncate+0x50>
+  8027b4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027b9:	eb d1                	jmp    80278c <ftruncate+0x50>
+
+008027bb <fstat>:
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	56                   	push   %esi
+  8027bf:	53                   	push   %ebx
+  8027c0:	83 ec 18             	sub    $0x18,%esp
+  8027c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027c9:	50                   	push   %eax
+  8027ca:	ff 75 08             	push   0x8(%ebp)
+  8027cd:	e8 82 fb ff ff       	call   802354 <fd_lookup>
+  8027d2:	83 c4 10             	add    $0x10,%esp
+  8027d5:	85 c0                	test   %eax,%eax
+  8027d7:	78 49                	js     802822 <fstat+0x67>
+  8027d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8027dc:	83 ec 08             	sub    $0x8,%esp
+  8027df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027e2:	50                   	push   %eax
+  8027e3:	ff 36                	push   (%esi)
+  8027e5:	e8 ba fb ff ff       	call   8023a4 <dev_lookup>
+  8027ea:	83 c4 10             	add    $0x10,%esp
+  8027ed:	85 c0                	test   %eax,%eax
+  8027ef:	78 31                	js     802822 <fstat+0x67>
+  8027f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027f4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8027f8:	74 2f                	je     802829 <fstat+0x6e>
+  8027fa:	c6 03 00             	movb   $0x0,(%ebx)
+  8027fd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802804:	00 00 00 
+  802807:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80280e:	00 00 00 
+  802811:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802817:	83 ec 08             	sub    $0x8,%esp
+  80281a:	53                   	push   %ebx
+  80281b:	56                   	push   %esi
+  80281c:	ff 50 14             	call   *0x14(%eax)
+  80281f:	83 c4 10             	add    $0x10,%esp
+  802822:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802825:	5b                   	pop    %ebx
+  802826:	5e                   	pop    %esi
+  802827:	5d                   	pop    %ebp
+  802828:	c3                   	ret
+  802829:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80282e:	eb f2                	jmp    802822 <fstat+0x67>
+
+00802830 <stat>:
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	56                   	push   %esi
+  802834:	53                   	push   %ebx
+  802835:	83 ec 08             	sub    $0x8,%esp
+  802838:	6a 00                	push   $0x0
+  80283a:	ff 75 08             	push   0x8(%ebp)
+  80283d:	e8 31 05 00 00       	call   802d73 <open>
+  802842:	89 c3                	mov    %eax,%ebx
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	85 c0                	test   %eax,%eax
+  802849:	78 1b                	js     802866 <stat+0x36>
+  80284b:	83 ec 08             	sub    $0x8,%esp
+  80284e:	ff 75 0c             	push   0xc(%ebp)
+  802851:	50                   	push   %eax
+  802852:	e8 64 ff ff ff       	call   8027bb <fstat>
+  802857:	89 c6                	mov    %eax,%esi
+  802859:	89 1c 24             	mov    %ebx,(%esp)
+  80285c:	e8 19 fc ff ff       	call   80247a <close>
+  802861:	83 c4 10             	add    $0x10,%esp
+  802864:	89 f3                	mov    %esi,%ebx
+  802866:	89 d8                	mov    %ebx,%eax
+  802868:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80286b:	5b                   	pop    %ebx
+  80286c:	5e                   	pop    %esi
+  80286d:	5d                   	pop    %ebp
+  80286e:	c3                   	ret
+
+0080286f <fsipc>:
+  80286f:	55                   	push   %ebp
+  802870:	89 e5                	mov    %esp,%ebp
+  802872:	56                   	push   %esi
+  802873:	53                   	push   %ebx
+  802874:	89 c3                	mov    %eax,%ebx
+  802876:	89 d6                	mov    %edx,%esi
+  802878:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80287f:	74 20                	je     8028a1 <fsipc+0x32>
+  802881:	83 ec 08             	sub    $0x8,%esp
+  802884:	6a 00                	push   $0x0
+  802886:	56                   	push   %esi
+  802887:	6a 07                	push   $0x7
+  802889:	68 00 70 80 00       	push   $0x807000
+  80288e:	53                   	push   %ebx
+  80288f:	ff 35 08 60 80 00    	push   0x806008
+  802895:	e8 8e f8 ff ff       	call   802128 <ipc_call>
+  80289a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80289d:	5b                   	pop    %ebx
+  80289e:	5e                   	pop    %esi
+  80289f:	5d                   	pop    %ebp
+  8028a0:	c3                   	ret
+  8028a1:	83 ec 0c             	sub    $0xc,%esp
+  8028a4:	6a 02                	push   $0x2
+  8028a6:	e8 18 fa ff ff       	call   8022c3 <ipc_find_env>
+  8028ab:	a3 08 60 80 00       	mov    %eax,0x806008
+  8028b0:	83 c4 10             	add    $0x10,%esp
+  8028b3:	eb cc                	jmp    802881 <fsipc+0x12>
+
+008028b5 <devfile_trunc>:
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	83 ec 08             	sub    $0x8,%esp
+  8028bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028c1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8028c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028c9:	a3 04 70 80 00       	mov    %eax,0x807004
+  8028ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028d8:	e8 92 ff ff ff       	call   80286f <fsipc>
+  8028dd:	c9                   	leave
+  8028de:	c3                   	ret
+
+008028df <devfile_flush>:
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	83 ec 08             	sub    $0x8,%esp
+  8028e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028eb:	a3 00 70 80 00       	mov    %eax,0x807000
+  8028f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028fa:	e8 70 ff ff ff       	call   80286f <fsipc>
+  8028ff:	c9                   	leave
+  802900:	c3                   	ret
+
+00802901 <devfile_stat>:
+  802901:	55                   	push   %ebp
+  802902:	89 e5                	mov    %esp,%ebp
+  802904:	53                   	push   %ebx
+  802905:	83 ec 04             	sub    $0x4,%esp
+  802908:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80290b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802911:	a3 00 70 80 00       	mov    %eax,0x807000
+  802916:	ba 00 00 00 00       	mov    $0x0,%edx
+  80291b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802920:	e8 4a ff ff ff       	call   80286f <fsipc>
+  802925:	85 c0                	test   %eax,%eax
+  802927:	78 2c                	js     802955 <devfile_stat+0x54>
+  802929:	83 ec 08             	sub    $0x8,%esp
+  80292c:	68 00 70 80 00       	push   $0x807000
+  802931:	53                   	push   %ebx
+  802932:	e8 c8 e9 ff ff       	call   8012ff <strcpy>
+  802937:	a1 80 70 80 00       	mov    0x807080,%eax
+  80293c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802942:	a1 84 70 80 00       	mov    0x807084,%eax
+  802947:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	b8 00 00 00 00       	mov    $0x0,%eax
+  802955:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802958:	c9                   	leave
+  802959:	c3                   	ret
+
+0080295a <fsring_rw>:
+  80295a:	55                   	push   %ebp
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	57                   	push   %edi
+  80295e:	56                   	push   %esi
+  80295f:	53                   	push   %ebx
+  802960:	83 ec 2c             	sub    $0x2c,%esp
+  802963:	89 c7                	mov    %eax,%edi
+  802965:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802968:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80296b:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802970:	a8 01                	test   $0x1,%al
+  802972:	74 0d                	je     802981 <fsring_rw+0x27>
+  802974:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802979:	a8 01                	test   $0x1,%al
+  80297b:	0f 85 d5 00 00 00    	jne    802a56 <fsring_rw+0xfc>
+  802981:	a1 48 60 80 00       	mov    0x806048,%eax
+  802986:	8b 40 48             	mov    0x48(%eax),%eax
+  802989:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  80298f:	0f 84 fc 00 00 00    	je     802a91 <fsring_rw+0x137>
+  802995:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80299c:	0f 84 02 01 00 00    	je     802aa4 <fsring_rw+0x14a>
+  8029a2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8029a7:	83 ec 04             	sub    $0x4,%esp
+  8029aa:	68 07 02 00 00       	push   $0x207
+  8029af:	53                   	push   %ebx
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	e8 a8 ed ff ff       	call   80175f <sys_page_alloc>
+  8029b7:	83 c4 10             	add    $0x10,%esp
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	0f 88 f9 00 00 00    	js     802abb <fsring_rw+0x161>
+  8029c2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8029c8:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8029ce:	75 d7                	jne    8029a7 <fsring_rw+0x4d>
+  8029d0:	6a 0e                	push   $0xe
+  8029d2:	6a 0d                	push   $0xd
+  8029d4:	ff 35 08 60 80 00    	push   0x806008
+  8029da:	68 00 00 f0 cf       	push   $0xcff00000
+  8029df:	e8 c4 0c 00 00       	call   8036a8 <ipcring_init>
+  8029e4:	83 c4 08             	add    $0x8,%esp
+  8029e7:	6a 00                	push   $0x0
+  8029e9:	6a 00                	push   $0x0
+  8029eb:	68 07 02 00 00       	push   $0x207
+  8029f0:	68 00 00 f0 cf       	push   $0xcff00000
+  8029f5:	6a 0b                	push   $0xb
+  8029f7:	ff 35 08 60 80 00    	push   0x806008
+  8029fd:	e8 26 f7 ff ff       	call   802128 <ipc_call>
+  802a02:	89 c6                	mov    %eax,%esi
+  802a04:	83 c4 20             	add    $0x20,%esp
+  802a07:	85 c0                	test   %eax,%eax
+  802a09:	0f 88 ac 00 00 00    	js     802abb <fsring_rw+0x161>
+  802a0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a14:	89 d9                	mov    %ebx,%ecx
+  802a16:	83 c3 01             	add    $0x1,%ebx
+  802a19:	89 da                	mov    %ebx,%edx
+  802a1b:	c1 e2 0c             	shl    $0xc,%edx
+  802a1e:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802a24:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802a2a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802a30:	83 ec 08             	sub    $0x8,%esp
+  802a33:	6a 00                	push   $0x0
+  802a35:	6a 00                	push   $0x0
+  802a37:	68 07 02 00 00       	push   $0x207
+  802a3c:	50                   	push   %eax
+  802a3d:	6a 0c                	push   $0xc
+  802a3f:	ff 35 08 60 80 00    	push   0x806008
+  802a45:	e8 de f6 ff ff       	call   802128 <ipc_call>
+  802a4a:	83 c4 20             	add    $0x20,%esp
+  802a4d:	85 c0                	test   %eax,%eax
+  802a4f:	78 6a                	js     802abb <fsring_rw+0x161>
+  802a51:	83 fb 08             	cmp    $0x8,%ebx
+  802a54:	75 be                	jne    802a14 <fsring_rw+0xba>
+  802a56:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802a5a:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802a5f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a64:	0f 45 c2             	cmovne %edx,%eax
+  802a67:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802a6a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802a71:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802a78:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a84:	be 00 00 00 00       	mov    $0x0,%esi
+  802a89:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802a8c:	e9 4b 01 00 00       	jmp    802bdc <fsring_rw+0x282>
+  802a91:	e8 93 f0 ff ff       	call   801b29 <sys_time_msec>
+  802a96:	3b 05 00 60 80 00    	cmp    0x806000,%eax
+  802a9c:	0f 89 f3 fe ff ff    	jns    802995 <fsring_rw+0x3b>
+  802aa2:	eb 54                	jmp    802af8 <fsring_rw+0x19e>
+  802aa4:	83 ec 0c             	sub    $0xc,%esp
+  802aa7:	6a 02                	push   $0x2
+  802aa9:	e8 15 f8 ff ff       	call   8022c3 <ipc_find_env>
+  802aae:	a3 08 60 80 00       	mov    %eax,0x806008
+  802ab3:	83 c4 10             	add    $0x10,%esp
+  802ab6:	e9 e7 fe ff ff       	jmp    8029a2 <fsring_rw+0x48>
+  802abb:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802ac0:	83 ec 08             	sub    $0x8,%esp
+  802ac3:	53                   	push   %ebx
+  802ac4:	6a 00                	push   $0x0
+  802ac6:	e8 66 ed ff ff       	call   801831 <sys_page_unmap>
+  802acb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ad1:	83 c4 10             	add    $0x10,%esp
+  802ad4:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802ada:	75 e4                	jne    802ac0 <fsring_rw+0x166>
+  802adc:	e8 48 f0 ff ff       	call   801b29 <sys_time_msec>
+  802ae1:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802ae6:	a3 00 60 80 00       	mov    %eax,0x806000
+  802aeb:	a1 48 60 80 00       	mov    0x806048,%eax
+  802af0:	8b 40 48             	mov    0x48(%eax),%eax
+  802af3:	a3 04 60 80 00       	mov    %eax,0x806004
+  802af8:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802aff:	e9 7a 01 00 00       	jmp    802c7e <fsring_rw+0x324>
+  802b04:	8b 57 0c             	mov    0xc(%edi),%edx
+  802b07:	89 10                	mov    %edx,(%eax)
+  802b09:	89 58 04             	mov    %ebx,0x4(%eax)
+  802b0c:	89 f2                	mov    %esi,%edx
+  802b0e:	03 57 04             	add    0x4(%edi),%edx
+  802b11:	89 50 08             	mov    %edx,0x8(%eax)
+  802b14:	83 ec 04             	sub    $0x4,%esp
+  802b17:	53                   	push   %ebx
+  802b18:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802b1b:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802b1e:	52                   	push   %edx
+  802b1f:	83 c0 0c             	add    $0xc,%eax
+  802b22:	50                   	push   %eax
+  802b23:	e8 87 e9 ff ff       	call   8014af <memmove>
+  802b28:	83 c4 10             	add    $0x10,%esp
+  802b2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b2e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b31:	89 08                	mov    %ecx,(%eax)
+  802b33:	83 ec 0c             	sub    $0xc,%esp
+  802b36:	68 00 00 f0 cf       	push   $0xcff00000
+  802b3b:	e8 c6 0b 00 00       	call   803706 <ipcring_req_push>
+  802b40:	01 de                	add    %ebx,%esi
+  802b42:	83 c4 10             	add    $0x10,%esp
+  802b45:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802b48:	73 4c                	jae    802b96 <fsring_rw+0x23c>
+  802b4a:	83 ec 0c             	sub    $0xc,%esp
+  802b4d:	68 00 00 f0 cf       	push   $0xcff00000
+  802b52:	e8 89 0b 00 00       	call   8036e0 <ipcring_req_slot>
+  802b57:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	85 c0                	test   %eax,%eax
+  802b5f:	74 35                	je     802b96 <fsring_rw+0x23c>
+  802b61:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802b66:	83 e0 07             	and    $0x7,%eax
+  802b69:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802b6e:	c1 e0 0c             	shl    $0xc,%eax
+  802b71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b74:	29 f3                	sub    %esi,%ebx
+  802b76:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802b79:	39 cb                	cmp    %ecx,%ebx
+  802b7b:	0f 47 d9             	cmova  %ecx,%ebx
+  802b7e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802b82:	75 80                	jne    802b04 <fsring_rw+0x1aa>
+  802b84:	8b 57 0c             	mov    0xc(%edi),%edx
+  802b87:	89 10                	mov    %edx,(%eax)
+  802b89:	89 58 04             	mov    %ebx,0x4(%eax)
+  802b8c:	89 f2                	mov    %esi,%edx
+  802b8e:	03 57 04             	add    0x4(%edi),%edx
+  802b91:	89 50 08             	mov    %edx,0x8(%eax)
+  802b94:	eb 95                	jmp    802b2b <fsring_rw+0x1d1>
+  802b96:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802b9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b9e:	83 ec 0c             	sub    $0xc,%esp
+  802ba1:	68 00 00 f0 cf       	push   $0xcff00000
+  802ba6:	e8 94 0b 00 00       	call   80373f <ipcring_rsp_wait>
+  802bab:	8b 58 04             	mov    0x4(%eax),%ebx
+  802bae:	83 c4 10             	add    $0x10,%esp
+  802bb1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802bb5:	75 45                	jne    802bfc <fsring_rw+0x2a2>
+  802bb7:	85 db                	test   %ebx,%ebx
+  802bb9:	79 41                	jns    802bfc <fsring_rw+0x2a2>
+  802bbb:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802bbe:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802bc5:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802bcc:	83 ec 0c             	sub    $0xc,%esp
+  802bcf:	68 00 00 f0 cf       	push   $0xcff00000
+  802bd4:	e8 cc 0b 00 00       	call   8037a5 <ipcring_rsp_pop>
+  802bd9:	83 c4 10             	add    $0x10,%esp
+  802bdc:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802be2:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802be7:	39 c2                	cmp    %eax,%edx
+  802be9:	74 75                	je     802c60 <fsring_rw+0x306>
+  802beb:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802bef:	75 a5                	jne    802b96 <fsring_rw+0x23c>
+  802bf1:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802bf4:	0f 82 50 ff ff ff    	jb     802b4a <fsring_rw+0x1f0>
+  802bfa:	eb 9a                	jmp    802b96 <fsring_rw+0x23c>
+  802bfc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802c00:	75 ca                	jne    802bcc <fsring_rw+0x272>
+  802c02:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802c06:	74 31                	je     802c39 <fsring_rw+0x2df>
+  802c08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802c0e:	29 c8                	sub    %ecx,%eax
+  802c10:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802c13:	39 d0                	cmp    %edx,%eax
+  802c15:	0f 47 c2             	cmova  %edx,%eax
+  802c18:	39 d8                	cmp    %ebx,%eax
+  802c1a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c1f:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802c23:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802c26:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c2b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802c2f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802c32:	01 d9                	add    %ebx,%ecx
+  802c34:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802c37:	eb 93                	jmp    802bcc <fsring_rw+0x272>
+  802c39:	83 ec 04             	sub    $0x4,%esp
+  802c3c:	53                   	push   %ebx
+  802c3d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c40:	83 e0 07             	and    $0x7,%eax
+  802c43:	c1 e0 0c             	shl    $0xc,%eax
+  802c46:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802c4c:	50                   	push   %eax
+  802c4d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c50:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802c53:	01 c8                	add    %ecx,%eax
+  802c55:	50                   	push   %eax
+  802c56:	e8 54 e8 ff ff       	call   8014af <memmove>
+  802c5b:	83 c4 10             	add    $0x10,%esp
+  802c5e:	eb a8                	jmp    802c08 <fsring_rw+0x2ae>
+  802c60:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802c64:	75 09                	jne    802c6f <fsring_rw+0x315>
+  802c66:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802c69:	0f 82 db fe ff ff    	jb     802b4a <fsring_rw+0x1f0>
+  802c6f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802c72:	01 57 04             	add    %edx,0x4(%edi)
+  802c75:	85 d2                	test   %edx,%edx
+  802c77:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802c7b:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802c7e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802c81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c84:	5b                   	pop    %ebx
+  802c85:	5e                   	pop    %esi
+  802c86:	5f                   	pop    %edi
+  802c87:	5d                   	pop    %ebp
+  802c88:	c3                   	ret
+
+00802c89 <devfile_write>:
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	57                   	push   %edi
+  802c8d:	56                   	push   %esi
+  802c8e:	53                   	push   %ebx
+  802c8f:	83 ec 0c             	sub    $0xc,%esp
+  802c92:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c9b:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802ca1:	76 1a                	jbe    802cbd <devfile_write+0x34>
+  802ca3:	83 ec 0c             	sub    $0xc,%esp
+  802ca6:	53                   	push   %ebx
+  802ca7:	89 f1                	mov    %esi,%ecx
+  802ca9:	ba 06 00 00 00       	mov    $0x6,%edx
+  802cae:	89 f8                	mov    %edi,%eax
+  802cb0:	e8 a5 fc ff ff       	call   80295a <fsring_rw>
+  802cb5:	83 c4 10             	add    $0x10,%esp
+  802cb8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802cbb:	75 39                	jne    802cf6 <devfile_write+0x6d>
+  802cbd:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802cc2:	39 c3                	cmp    %eax,%ebx
+  802cc4:	0f 47 d8             	cmova  %eax,%ebx
+  802cc7:	8b 47 0c             	mov    0xc(%edi),%eax
+  802cca:	a3 00 70 80 00       	mov    %eax,0x807000
+  802ccf:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802cd5:	83 ec 04             	sub    $0x4,%esp
+  802cd8:	53                   	push   %ebx
+  802cd9:	56                   	push   %esi
+  802cda:	68 08 70 80 00       	push   $0x807008
+  802cdf:	e8 cb e7 ff ff       	call   8014af <memmove>
+  802ce4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce9:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cee:	e8 7c fb ff ff       	call   80286f <fsipc>
+  802cf3:	83 c4 10             	add    $0x10,%esp
+  802cf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cf9:	5b                   	pop    %ebx
+  802cfa:	5e                   	pop    %esi
+  802cfb:	5f                   	pop    %edi
+  802cfc:	5d                   	pop    %ebp
+  802cfd:	c3                   	ret
+
+00802cfe <devfile_read>:
+  802cfe:	55                   	push   %ebp
+  802cff:	89 e5                	mov    %esp,%ebp
+  802d01:	57                   	push   %edi
+  802d02:	56                   	push   %esi
+  802d03:	53                   	push   %ebx
+  802d04:	83 ec 0c             	sub    $0xc,%esp
+  802d07:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d0a:	8b 75 10             	mov    0x10(%ebp),%esi
+  802d0d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802d13:	76 1d                	jbe    802d32 <devfile_read+0x34>
+  802d15:	83 ec 0c             	sub    $0xc,%esp
+  802d18:	56                   	push   %esi
+  802d19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d1c:	ba 05 00 00 00       	mov    $0x5,%edx
+  802d21:	89 f8                	mov    %edi,%eax
+  802d23:	e8 32 fc ff ff       	call   80295a <fsring_rw>
+  802d28:	89 c3                	mov    %eax,%ebx
+  802d2a:	83 c4 10             	add    $0x10,%esp
+  802d2d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802d30:	75 37                	jne    802d69 <devfile_read+0x6b>
+  802d32:	8b 47 0c             	mov    0xc(%edi),%eax
+  802d35:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d3a:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802d40:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d45:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d4a:	e8 20 fb ff ff       	call   80286f <fsipc>
+  802d4f:	89 c3                	mov    %eax,%ebx
+  802d51:	85 c0                	test   %eax,%eax
+  802d53:	78 14                	js     802d69 <devfile_read+0x6b>
+  802d55:	83 ec 04             	sub    $0x4,%esp
+  802d58:	50                   	push   %eax
+  802d59:	68 00 70 80 00       	push   $0x807000
+  802d5e:	ff 75 0c             	push   0xc(%ebp)
+  802d61:	e8 49 e7 ff ff       	call   8014af <memmove>
+  802d66:	83 c4 10             	add    $0x10,%esp
+  802d69:	89 d8                	mov    %ebx,%eax
+  802d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d6e:	5b                   	pop    %ebx
+  802d6f:	5e                   	pop    %esi
+  802d70:	5f                   	pop    %edi
+  802d71:	5d                   	pop    %ebp
+  802d72:	c3                   	ret
+
+00802d73 <open>:
+  802d73:	55                   	push   %ebp
+  802d74:	89 e5                	mov    %esp,%ebp
+  802d76:	56                   	push   %esi
+  802d77:	53                   	push   %ebx
+  802d78:	83 ec 1c             	sub    $0x1c,%esp
+  802d7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d7e:	56                   	push   %esi
+  802d7f:	e8 2f e5 ff ff       	call   8012b3 <strlen>
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d8c:	7f 6c                	jg     802dfa <open+0x87>
+  802d8e:	83 ec 0c             	sub    $0xc,%esp
+  802d91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d94:	50                   	push   %eax
+  802d95:	e8 6a f5 ff ff       	call   802304 <fd_alloc>
+  802d9a:	89 c3                	mov    %eax,%ebx
+  802d9c:	83 c4 10             	add    $0x10,%esp
+  802d9f:	85 c0                	test   %eax,%eax
+  802da1:	78 3c                	js     802ddf <open+0x6c>
+  802da3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da6:	a3 00 74 80 00       	mov    %eax,0x807400
+  802dab:	83 ec 08             	sub    $0x8,%esp
+  802dae:	56                   	push   %esi
+  802daf:	68 00 70 80 00       	push   $0x807000
+  802db4:	e8 46 e5 ff ff       	call   8012ff <strcpy>
+  802db9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802dbc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dc1:	e8 a9 fa ff ff       	call   80286f <fsipc>
+  802dc6:	89 c3                	mov    %eax,%ebx
+  802dc8:	83 c4 10             	add    $0x10,%esp
+  802dcb:	85 c0                	test   %eax,%eax
+  802dcd:	78 19                	js     802de8 <open+0x75>
+  802dcf:	83 ec 0c             	sub    $0xc,%esp
+  802dd2:	ff 75 f4             	push   -0xc(%ebp)
+  802dd5:	e8 03 f5 ff ff       	call   8022dd <fd2num>
+  802dda:	89 c3                	mov    %eax,%ebx
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	89 d8                	mov    %ebx,%eax
+  802de1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802de4:	5b                   	pop    %ebx
+  802de5:	5e                   	pop    %esi
+  802de6:	5d                   	pop    %ebp
+  802de7:	c3                   	ret
+  802de8:	83 ec 08             	sub    $0x8,%esp
+  802deb:	6a 00                	push   $0x0
+  802ded:	ff 75 f4             	push   -0xc(%ebp)
+  802df0:	e8 05 f6 ff ff       	call   8023fa <fd_close>
+  802df5:	83 c4 10             	add    $0x10,%esp
+  802df8:	eb e5                	jmp    802ddf <open+0x6c>
+  802dfa:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802dff:	eb de                	jmp    802ddf <open+0x6c>
+
+00802e01 <file_image>:
+  802e01:	55                   	push   %ebp
+  802e02:	89 e5                	mov    %esp,%ebp
+  802e04:	53                   	push   %ebx
+  802e05:	83 ec 1c             	sub    $0x1c,%esp
+  802e08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e0e:	50                   	push   %eax
+  802e0f:	ff 75 08             	push   0x8(%ebp)
+  802e12:	e8 3d f5 ff ff       	call   802354 <fd_lookup>
+  802e17:	83 c4 10             	add    $0x10,%esp
+  802e1a:	85 c0                	test   %eax,%eax
+  802e1c:	78 58                	js     802e76 <file_image+0x75>
+  802e1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e21:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802e27:	39 08                	cmp    %ecx,(%eax)
+  802e29:	75 50                	jne    802e7b <file_image+0x7a>
+  802e2b:	83 fb 04             	cmp    $0x4,%ebx
+  802e2e:	77 52                	ja     802e82 <file_image+0x81>
+  802e30:	8b 40 0c             	mov    0xc(%eax),%eax
+  802e33:	a3 00 70 80 00       	mov    %eax,0x807000
+  802e38:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802e3e:	83 ec 04             	sub    $0x4,%esp
+  802e41:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802e44:	c1 e0 02             	shl    $0x2,%eax
+  802e47:	50                   	push   %eax
+  802e48:	ff 75 0c             	push   0xc(%ebp)
+  802e4b:	68 08 70 80 00       	push   $0x807008
+  802e50:	e8 5a e6 ff ff       	call   8014af <memmove>
+  802e55:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e5a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802e5f:	e8 0b fa ff ff       	call   80286f <fsipc>
+  802e64:	83 c4 10             	add    $0x10,%esp
+  802e67:	85 c0                	test   %eax,%eax
+  802e69:	78 0b                	js     802e76 <file_image+0x75>
+  802e6b:	8b 55 14             	mov    0x14(%ebp),%edx
+  802e6e:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802e74:	89 0a                	mov    %ecx,(%edx)
+  802e76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e79:	c9                   	leave
+  802e7a:	c3                   	ret
+  802e7b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e80:	eb f4                	jmp    802e76 <file_image+0x75>
+  802e82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e87:	eb ed                	jmp    802e76 <file_image+0x75>
+
+00802e89 <remove>:
+  802e89:	55                   	push   %ebp
+  802e8a:	89 e5                	mov    %esp,%ebp
+  802e8c:	53                   	push   %ebx
+  802e8d:	83 ec 10             	sub    $0x10,%esp
+  802e90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802e93:	53                   	push   %ebx
+  802e94:	e8 1a e4 ff ff       	call   8012b3 <strlen>
+  802e99:	83 c4 10             	add    $0x10,%esp
+  802e9c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ea1:	7f 25                	jg     802ec8 <remove+0x3f>
+  802ea3:	83 ec 08             	sub    $0x8,%esp
+  802ea6:	53                   	push   %ebx
+  802ea7:	68 00 70 80 00       	push   $0x807000
+  802eac:	e8 4e e4 ff ff       	call   8012ff <strcpy>
+  802eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb6:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ebb:	e8 af f9 ff ff       	call   80286f <fsipc>
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ec6:	c9                   	leave
+  802ec7:	c3                   	ret
+  802ec8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802ecd:	eb f4                	jmp    802ec3 <remove+0x3a>
+
+00802ecf <sync>:
+  802ecf:	55                   	push   %ebp
+  802ed0:	89 e5                	mov    %esp,%ebp
+  802ed2:	83 ec 08             	sub    $0x8,%esp
+  802ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eda:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802edf:	e8 8b f9 ff ff       	call   80286f <fsipc>
+  802ee4:	c9                   	leave
+  802ee5:	c3                   	ret
+
+00802ee6 <devsock_stat>:
+  802ee6:	55                   	push   %ebp
+  802ee7:	89 e5                	mov    %esp,%ebp
+  802ee9:	83 ec 10             	sub    $0x10,%esp
+  802eec:	68 4c 48 80 00       	push   $0x80484c
+  802ef1:	ff 75 0c             	push   0xc(%ebp)
+  802ef4:	e8 06 e4 ff ff       	call   8012ff <strcpy>
+  802ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802efe:	c9                   	leave
+  802eff:	c3                   	ret
+
+00802f00 <devsock_close>:
+  802f00:	55                   	push   %ebp
+  802f01:	89 e5                	mov    %esp,%ebp
+  802f03:	53                   	push   %ebx
+  802f04:	83 ec 10             	sub    $0x10,%esp
+  802f07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f0a:	53                   	push   %ebx
+  802f0b:	e8 2c 0b 00 00       	call   803a3c <pageref>
+  802f10:	89 c2                	mov    %eax,%edx
+  802f12:	83 c4 10             	add    $0x10,%esp
+  802f15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1a:	83 fa 01             	cmp    $0x1,%edx
+  802f1d:	74 05                	je     802f24 <devsock_close+0x24>
+  802f1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f22:	c9                   	leave
+  802f23:	c3                   	ret
+  802f24:	83 ec 0c             	sub    $0xc,%esp
+  802f27:	ff 73 0c             	push   0xc(%ebx)
+  802f2a:	e8 aa 02 00 00       	call   8031d9 <nsipc_close>
+  802f2f:	83 c4 10             	add    $0x10,%esp
+  802f32:	eb eb                	jmp    802f1f <devsock_close+0x1f>
+
+00802f34 <devsock_write>:
+  802f34:	55                   	push   %ebp
+  802f35:	89 e5                	mov    %esp,%ebp
+  802f37:	83 ec 08             	sub    $0x8,%esp
+  802f3a:	6a 00                	push   $0x0
+  802f3c:	ff 75 10             	push   0x10(%ebp)
+  802f3f:	ff 75 0c             	push   0xc(%ebp)
+  802f42:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f45:	ff 70 0c             	push   0xc(%eax)
+  802f48:	e8 6c 03 00 00       	call   8032b9 <nsipc_send>
+  802f4d:	c9                   	leave
+  802f4e:	c3                   	ret
+
+00802f4f <devsock_read>:
+  802f4f:	55                   	push   %ebp
+  802f50:	89 e5                	mov    %esp,%ebp
+  802f52:	83 ec 08             	sub    $0x8,%esp
+  802f55:	6a 00                	push   $0x0
+  802f57:	ff 75 10             	push   0x10(%ebp)
+  802f5a:	ff 75 0c             	push   0xc(%ebp)
+  802f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f60:	ff 70 0c             	push   0xc(%eax)
+  802f63:	e8 e2 02 00 00       	call   80324a <nsipc_recv>
+  802f68:	c9                   	leave
+  802f69:	c3                   	ret
+
+00802f6a <fd2sockid>:
+  802f6a:	55                   	push   %ebp
+  802f6b:	89 e5                	mov    %esp,%ebp
+  802f6d:	83 ec 20             	sub    $0x20,%esp
+  802f70:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f73:	52                   	push   %edx
+  802f74:	50                   	push   %eax
+  802f75:	e8 da f3 ff ff       	call   802354 <fd_lookup>
+  802f7a:	83 c4 10             	add    $0x10,%esp
+  802f7d:	85 c0                	test   %eax,%eax
+  802f7f:	78 10                	js     802f91 <fd2sockid+0x27>
+  802f81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f84:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802f8a:	39 08                	cmp    %ecx,(%eax)
+  802f8c:	75 05                	jne    802f93 <fd2sockid+0x29>
+  802f8e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802f91:	c9                   	leave
+  802f92:	c3                   	ret
+  802f93:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f98:	eb f7                	jmp    802f91 <fd2sockid+0x27>
+
+00802f9a <alloc_sockfd>:
+  802f9a:	55                   	push   %ebp
+  802f9b:	89 e5                	mov    %esp,%ebp
+  802f9d:	56                   	push   %esi
+  802f9e:	53                   	push   %ebx
+  802f9f:	83 ec 1c             	sub    $0x1c,%esp
+  802fa2:	89 c6                	mov    %eax,%esi
+  802fa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fa7:	50                   	push   %eax
+  802fa8:	e8 57 f3 ff ff       	call   802304 <fd_alloc>
+  802fad:	89 c3                	mov    %eax,%ebx
+  802faf:	83 c4 10             	add    $0x10,%esp
+  802fb2:	85 c0                	test   %eax,%eax
+  802fb4:	78 43                	js     802ff9 <alloc_sockfd+0x5f>
+  802fb6:	83 ec 04             	sub    $0x4,%esp
+  802fb9:	68 07 04 00 00       	push   $0x407
+  802fbe:	ff 75 f4             	push   -0xc(%ebp)
+  802fc1:	6a 00                	push   $0x0
+  802fc3:	e8 97 e7 ff ff       	call   80175f <sys_page_alloc>
+  802fc8:	89 c3                	mov    %eax,%ebx
+  802fca:	83 c4 10             	add    $0x10,%esp
+  802fcd:	85 c0                	test   %eax,%eax
+  802fcf:	78 28                	js     802ff9 <alloc_sockfd+0x5f>
+  802fd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fd4:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802fda:	89 10                	mov    %edx,(%eax)
+  802fdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fdf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802fe6:	89 70 0c             	mov    %esi,0xc(%eax)
+  802fe9:	83 ec 0c             	sub    $0xc,%esp
+  802fec:	50                   	push   %eax
+  802fed:	e8 eb f2 ff ff       	call   8022dd <fd2num>
+  802ff2:	89 c3                	mov    %eax,%ebx
+  802ff4:	83 c4 10             	add    $0x10,%esp
+  802ff7:	eb 0c                	jmp    803005 <alloc_sockfd+0x6b>
+  802ff9:	83 ec 0c             	sub    $0xc,%esp
+  802ffc:	56                   	push   %esi
+  802ffd:	e8 d7 01 00 00       	call   8031d9 <nsipc_close>
+  803002:	83 c4 10             	add    $0x10,%esp
+  803005:	89 d8                	mov    %ebx,%eax
+  803007:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80300a:	5b                   	pop    %ebx
+  80300b:	5e                   	pop    %esi
+  80300c:	5d                   	pop    %ebp
+  80300d:	c3                   	ret
+
+0080300e <accept>:
+  80300e:	55                   	push   %ebp
+  80300f:	89 e5                	mov    %esp,%ebp
+  803011:	83 ec 08             	sub    $0x8,%esp
+  803014:	8b 45 08             	mov    0x8(%ebp),%eax
+  803017:	e8 4e ff ff ff       	call   802f6a <fd2sockid>
+  80301c:	85 c0                	test   %eax,%eax
+  80301e:	78 1b                	js     80303b <accept+0x2d>
+  803020:	83 ec 04             	sub    $0x4,%esp
+  803023:	ff 75 10             	push   0x10(%ebp)
+  803026:	ff 75 0c             	push   0xc(%ebp)
+  803029:	50                   	push   %eax
+  80302a:	e8 07 01 00 00       	call   803136 <nsipc_accept>
+  80302f:	83 c4 10             	add    $0x10,%esp
+  803032:	85 c0                	test   %eax,%eax
+  803034:	78 05                	js     80303b <accept+0x2d>
+  803036:	e8 5f ff ff ff       	call   802f9a <alloc_sockfd>
+  80303b:	c9                   	leave
+  80303c:	c3                   	ret
+
+0080303d <bind>:
+  80303d:	55                   	push   %ebp
+  80303e:	89 e5                	mov    %esp,%ebp
+  803040:	83 ec 08             	sub    $0x8,%esp
+  803043:	8b 45 08             	mov    0x8(%ebp),%eax
+  803046:	e8 1f ff ff ff       	call   802f6a <fd2sockid>
+  80304b:	85 c0                	test   %eax,%eax
+  80304d:	78 12                	js     803061 <bind+0x24>
+  80304f:	83 ec 04             	sub    $0x4,%esp
+  803052:	ff 75 10             	push   0x10(%ebp)
+  803055:	ff 75 0c             	push   0xc(%ebp)
+  803058:	50                   	push   %eax
+  803059:	e8 24 01 00 00       	call   803182 <nsipc_bind>
+  80305e:	83 c4 10             	add    $0x10,%esp
+  803061:	c9                   	leave
+  803062:	c3                   	ret
+
+00803063 <shutdown>:
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	83 ec 08             	sub    $0x8,%esp
+  803069:	8b 45 08             	mov    0x8(%ebp),%eax
+  80306c:	e8 f9 fe ff ff       	call   802f6a <fd2sockid>
+  803071:	85 c0                	test   %eax,%eax
+  803073:	78 0f                	js     803084 <shutdown+0x21>
+  803075:	83 ec 08             	sub    $0x8,%esp
+  803078:	ff 75 0c             	push   0xc(%ebp)
+  80307b:	50                   	push   %eax
+  80307c:	e8 36 01 00 00       	call   8031b7 <nsipc_shutdown>
+  803081:	83 c4 10             	add    $0x10,%esp
+  803084:	c9                   	leave
+  803085:	c3                   	ret
+
+00803086 <connect>:
+  803086:	55                   	push   %ebp
+  803087:	89 e5                	mov    %esp,%ebp
+  803089:	83 ec 08             	sub    $0x8,%esp
+  80308c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308f:	e8 d6 fe ff ff       	call   802f6a <fd2sockid>
+  803094:	85 c0                	test   %eax,%eax
+  803096:	78 12                	js     8030aa <connect+0x24>
+  803098:	83 ec 04             	sub    $0x4,%esp
+  80309b:	ff 75 10             	push   0x10(%ebp)
+  80309e:	ff 75 0c             	push   0xc(%ebp)
+  8030a1:	50                   	push   %eax
+  8030a2:	e8 4c 01 00 00       	call   8031f3 <nsipc_connect>
+  8030a7:	83 c4 10             	add    $0x10,%esp
+  8030aa:	c9                   	leave
+  8030ab:	c3                   	ret
+
+008030ac <listen>:
+  8030ac:	55                   	push   %ebp
+  8030ad:	89 e5                	mov    %esp,%ebp
+  8030af:	83 ec 08             	sub    $0x8,%esp
+  8030b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b5:	e8 b0 fe ff ff       	call   802f6a <fd2sockid>
+  8030ba:	85 c0                	test   %eax,%eax
+  8030bc:	78 0f                	js     8030cd <listen+0x21>
+  8030be:	83 ec 08             	sub    $0x8,%esp
+  8030c1:	ff 75 0c             	push   0xc(%ebp)
+  8030c4:	50                   	push   %eax
+  8030c5:	e8 5e 01 00 00       	call   803228 <nsipc_listen>
+  8030ca:	83 c4 10             	add    $0x10,%esp
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+
+008030cf <socket>:
+  8030cf:	55                   	push   %ebp
+  8030d0:	89 e5                	mov    %esp,%ebp
+  8030d2:	83 ec 0c             	sub    $0xc,%esp
+  8030d5:	ff 75 10             	push   0x10(%ebp)
+  8030d8:	ff 75 0c             	push   0xc(%ebp)
+  8030db:	ff 75 08             	push   0x8(%ebp)
+  8030de:	e8 34 02 00 00       	call   803317 <nsipc_socket>
+  8030e3:	83 c4 10             	add    $0x10,%esp
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	78 05                	js     8030ef <socket+0x20>
+  8030ea:	e8 ab fe ff ff       	call   802f9a <alloc_sockfd>
+  8030ef:	c9                   	leave
+  8030f0:	c3                   	ret
+
+008030f1 <nsipc>:
+  8030f1:	55                   	push   %ebp
+  8030f2:	89 e5                	mov    %esp,%ebp
+  8030f4:	53                   	push   %ebx
+  8030f5:	83 ec 04             	sub    $0x4,%esp
+  8030f8:	89 c3                	mov    %eax,%ebx
+  8030fa:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  803101:	74 1f                	je     803122 <nsipc+0x31>
+  803103:	83 ec 08             	sub    $0x8,%esp
+  803106:	6a 00                	push   $0x0
+  803108:	6a 00                	push   $0x0
+  80310a:	6a 07                	push   $0x7
+  80310c:	68 00 80 80 00       	push   $0x808000
+  803111:	53                   	push   %ebx
+  803112:	ff 35 0c 60 80 00    	push   0x80600c
+  803118:	e8 0b f0 ff ff       	call   802128 <ipc_call>
+  80311d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803120:	c9                   	leave
+  803121:	c3                   	ret
+  803122:	83 ec 0c             	sub    $0xc,%esp
+  803125:	6a 03                	push   $0x3
+  803127:	e8 97 f1 ff ff       	call   8022c3 <ipc_find_env>
+  80312c:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  803131:	83 c4 10             	add    $0x10,%esp
+  803134:	eb cd                	jmp    803103 <nsipc+0x12>
+
+00803136 <nsipc_accept>:
+  803136:	55                   	push   %ebp
+  803137:	89 e5                	mov    %esp,%ebp
+  803139:	53                   	push   %ebx
+  80313a:	83 ec 04             	sub    $0x4,%esp
+  80313d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803140:	a3 00 80 80 00       	mov    %eax,0x808000
+  803145:	b8 01 00 00 00       	mov    $0x1,%eax
+  80314a:	e8 a2 ff ff ff       	call   8030f1 <nsipc>
+  80314f:	89 c3                	mov    %eax,%ebx
+  803151:	85 c0                	test   %eax,%eax
+  803153:	79 07                	jns    80315c <nsipc_accept+0x26>
+  803155:	89 d8                	mov    %ebx,%eax
+  803157:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80315a:	c9                   	leave
+  80315b:	c3                   	ret
+  80315c:	83 ec 04             	sub    $0x4,%esp
+  80315f:	ff 35 10 80 80 00    	push   0x808010
+  803165:	68 00 80 80 00       	push   $0x808000
+  80316a:	ff 75 0c             	push   0xc(%ebp)
+  80316d:	e8 3d e3 ff ff       	call   8014af <memmove>
+  803172:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803178:	8b 45 10             	mov    0x10(%ebp),%eax
+  80317b:	89 10                	mov    %edx,(%eax)
+  80317d:	83 c4 10             	add    $0x10,%esp
+  803180:	eb d3                	jmp    803155 <nsipc_accept+0x1f>
+
+00803182 <nsipc_bind>:
+  803182:	55                   	push   %ebp
+  803183:	89 e5                	mov    %esp,%ebp
+  803185:	53                   	push   %ebx
+  803186:	83 ec 08             	sub    $0x8,%esp
+  803189:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80318c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318f:	a3 00 80 80 00       	mov    %eax,0x808000
+  803194:	53                   	push   %ebx
+  803195:	ff 75 0c             	push   0xc(%ebp)
+  803198:	68 04 80 80 00       	push   $0x808004
+  80319d:	e8 0d e3 ff ff       	call   8014af <memmove>
+  8031a2:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  8031a8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8031ad:	e8 3f ff ff ff       	call   8030f1 <nsipc>
+  8031b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031b5:	c9                   	leave
+  8031b6:	c3                   	ret
+
+008031b7 <nsipc_shutdown>:
+  8031b7:	55                   	push   %ebp
+  8031b8:	89 e5                	mov    %esp,%ebp
+  8031ba:	83 ec 08             	sub    $0x8,%esp
+  8031bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031c0:	a3 00 80 80 00       	mov    %eax,0x808000
+  8031c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031c8:	a3 04 80 80 00       	mov    %eax,0x808004
+  8031cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8031d2:	e8 1a ff ff ff       	call   8030f1 <nsipc>
+  8031d7:	c9                   	leave
+  8031d8:	c3                   	ret
+
+008031d9 <nsipc_close>:
+  8031d9:	55                   	push   %ebp
+  8031da:	89 e5                	mov    %esp,%ebp
+  8031dc:	83 ec 08             	sub    $0x8,%esp
+  8031df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031e2:	a3 00 80 80 00       	mov    %eax,0x808000
+  8031e7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8031ec:	e8 00 ff ff ff       	call   8030f1 <nsipc>
+  8031f1:	c9                   	leave
+  8031f2:	c3                   	ret
+
+008031f3 <nsipc_connect>:
+  8031f3:	55                   	push   %ebp
+  8031f4:	89 e5                	mov    %esp,%ebp
+  8031f6:	53                   	push   %ebx
+  8031f7:	83 ec 08             	sub    $0x8,%esp
+  8031fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803200:	a3 00 80 80 00       	mov    %eax,0x808000
+  803205:	53                   	push   %ebx
+  803206:	ff 75 0c             	push   0xc(%ebp)
+  803209:	68 04 80 80 00       	push   $0x808004
+  80320e:	e8 9c e2 ff ff       	call   8014af <memmove>
+  803213:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  803219:	b8 05 00 00 00       	mov    $0x5,%eax
+  80321e:	e8 ce fe ff ff       	call   8030f1 <nsipc>
+  803223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803226:	c9                   	leave
+  803227:	c3                   	ret
+
+00803228 <nsipc_listen>:
+  803228:	55                   	push   %ebp
+  803229:	89 e5                	mov    %esp,%ebp
+  80322b:	83 ec 08             	sub    $0x8,%esp
+  80322e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803231:	a3 00 80 80 00       	mov    %eax,0x808000
+  803236:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803239:	a3 04 80 80 00       	mov    %eax,0x808004
+  80323e:	b8 06 00 00 00       	mov    $0x6,%eax
+  803243:	e8 a9 fe ff ff       	call   8030f1 <nsipc>
+  803248:	c9                   	leave
+  803249:	c3                   	ret
+
+0080324a <nsipc_recv>:
+  80324a:	55                   	push   %ebp
+  80324b:	89 e5                	mov    %esp,%ebp
+  80324d:	56                   	push   %esi
+  80324e:	53                   	push   %ebx
+  80324f:	8b 75 10             	mov    0x10(%ebp),%esi
+  803252:	8b 45 08             	mov    0x8(%ebp),%eax
+  803255:	a3 00 80 80 00       	mov    %eax,0x808000
+  80325a:	89 35 04 80 80 00    	mov    %esi,0x808004
+  803260:	8b 45 14             	mov    0x14(%ebp),%eax
+  803263:	a3 08 80 80 00       	mov    %eax,0x808008
+  803268:	b8 07 00 00 00       	mov    $0x7,%eax
+  80326d:	e8 7f fe ff ff       	call   8030f1 <nsipc>
+  803272:	89 c3                	mov    %eax,%ebx
+  803274:	85 c0                	test   %eax,%eax
+  803276:	78 22                	js     80329a <nsipc_recv+0x50>
+  803278:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80327d:	39 c6                	cmp    %eax,%esi
+  80327f:	0f 4e c6             	cmovle %esi,%eax
+  803282:	39 c3                	cmp    %eax,%ebx
+  803284:	7f 1d                	jg     8032a3 <nsipc_recv+0x59>
+  803286:	83 ec 04             	sub    $0x4,%esp
+  803289:	53                   	push   %ebx
+  80328a:	68 00 80 80 00       	push   $0x808000
+  80328f:	ff 75 0c             	push   0xc(%ebp)
+  803292:	e8 18 e2 ff ff       	call   8014af <memmove>
+  803297:	83 c4 10             	add    $0x10,%esp
+  80329a:	89 d8                	mov    %ebx,%eax
+  80329c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80329f:	5b                   	pop    %ebx
+  8032a0:	5e                   	pop    %esi
+  8032a1:	5d                   	pop    %ebp
+  8032a2:	c3                   	ret
+  8032a3:	68 58 48 80 00       	push   $0x804858
+  8032a8:	68 6d 48 80 00       	push   $0x80486d
+  8032ad:	6a 60                	push   $0x60
+  8032af:	68 82 48 80 00       	push   $0x804882
+  8032b4:	e8 74 d8 ff ff       	call   800b2d <_panic>
+
+008032b9 <nsipc_send>:
+  8032b9:	55                   	push   %ebp
+  8032ba:	89 e5                	mov    %esp,%ebp
+  8032bc:	53                   	push   %ebx
+  8032bd:	83 ec 04             	sub    $0x4,%esp
+  8032c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8032c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c6:	a3 00 80 80 00       	mov    %eax,0x808000
+  8032cb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8032d1:	7f 2e                	jg     803301 <nsipc_send+0x48>
+  8032d3:	83 ec 04             	sub    $0x4,%esp
+  8032d6:	53                   	push   %ebx
+  8032d7:	ff 75 0c             	push   0xc(%ebp)
+  8032da:	68 0c 80 80 00       	push   $0x80800c
+  8032df:	e8 cb e1 ff ff       	call   8014af <memmove>
+  8032e4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  8032ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032ed:	a3 08 80 80 00       	mov    %eax,0x808008
+  8032f2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8032f7:	e8 f5 fd ff ff       	call   8030f1 <nsipc>
+  8032fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032ff:	c9                   	leave
+  803300:	c3                   	ret
+  803301:	68 8e 48 80 00       	push   $0x80488e
+  803306:	68 6d 48 80 00       	push   $0x80486d
+  80330b:	6a 6b                	push   $0x6b
+  80330d:	68 82 48 80 00       	push   $0x804882
+  803312:	e8 16 d8 ff ff       	call   800b2d <_panic>
+
+00803317 <nsipc_socket>:
+  803317:	55                   	push   %ebp
+  803318:	89 e5                	mov    %esp,%ebp
+  80331a:	83 ec 08             	sub    $0x8,%esp
+  80331d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803320:	a3 00 80 80 00       	mov    %eax,0x808000
+  803325:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803328:	a3 04 80 80 00       	mov    %eax,0x808004
+  80332d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803330:	a3 08 80 80 00       	mov    %eax,0x808008
+  803335:	b8 09 00 00 00       	mov    $0x9,%eax
+  80333a:	e8 b2 fd ff ff       	call   8030f1 <nsipc>
+  80333f:	c9                   	leave
+  803340:	c3                   	ret
+
+00803341 <devpipe_stat>:
+  803341:	55                   	push   %ebp
+  803342:	89 e5                	mov    %esp,%ebp
+  803344:	56                   	push   %esi
+  803345:	53                   	push   %ebx
+  803346:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803349:	83 ec 0c             	sub    $0xc,%esp
+  80334c:	ff 75 08             	push   0x8(%ebp)
+  80334f:	e8 99 ef ff ff       	call   8022ed <fd2data>
+  803354:	89 c6                	mov    %eax,%esi
+  803356:	83 c4 08             	add    $0x8,%esp
+  803359:	68 9a 48 80 00       	push   $0x80489a
+  80335e:	53                   	push   %ebx
+  80335f:	e8 9b df ff ff       	call   8012ff <strcpy>
+  803364:	8b 46 04             	mov    0x4(%esi),%eax
+  803367:	2b 06                	sub    (%esi),%eax
+  803369:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80336f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803376:	00 00 00 
+  803379:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  803380:	50 80 00 
+  803383:	b8 00 00 00 00       	mov    $0x0,%eax
+  803388:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80338b:	5b                   	pop    %ebx
+  80338c:	5e                   	pop    %esi
+  80338d:	5d                   	pop    %ebp
+  80338e:	c3                   	ret
+
+0080338f <devpipe_close>:
+  80338f:	55                   	push   %ebp
+  803390:	89 e5                	mov    %esp,%ebp
+  803392:	53                   	push   %ebx
+  803393:	83 ec 0c             	sub    $0xc,%esp
+  803396:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803399:	53                   	push   %ebx
+  80339a:	6a 00                	push   $0x0
+  80339c:	e8 90 e4 ff ff       	call   801831 <sys_page_unmap>
+  8033a1:	89 1c 24             	mov    %ebx,(%esp)
+  8033a4:	e8 44 ef ff ff       	call   8022ed <fd2data>
+  8033a9:	83 c4 08             	add    $0x8,%esp
+  8033ac:	50                   	push   %eax
+  8033ad:	6a 00                	push   $0x0
+  8033af:	e8 7d e4 ff ff       	call   801831 <sys_page_unmap>
+  8033b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033b7:	c9                   	leave
+  8033b8:	c3                   	ret
+
+008033b9 <_pipeisclosed>:
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	57                   	push   %edi
+  8033bd:	56                   	push   %esi
+  8033be:	53                   	push   %ebx
+  8033bf:	83 ec 1c             	sub    $0x1c,%esp
+  8033c2:	89 c7                	mov    %eax,%edi
+  8033c4:	89 d6                	mov    %edx,%esi
+  8033c6:	a1 48 60 80 00       	mov    0x806048,%eax
+  8033cb:	8b 58 58             	mov    0x58(%eax),%ebx
+  8033ce:	83 ec 0c             	sub    $0xc,%esp
+  8033d1:	57                   	push   %edi
+  8033d2:	e8 65 06 00 00       	call   803a3c <pageref>
+  8033d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033da:	89 34 24             	mov    %esi,(%esp)
+  8033dd:	e8 5a 06 00 00       	call   803a3c <pageref>
+  8033e2:	8b 15 48 60 80 00    	mov    0x806048,%edx
+  8033e8:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8033eb:	83 c4 10             	add    $0x10,%esp
+  8033ee:	39 cb                	cmp    %ecx,%ebx
+  8033f0:	74 1b                	je     80340d <_pipeisclosed+0x54>
+  8033f2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8033f5:	75 cf                	jne    8033c6 <_pipeisclosed+0xd>
+  8033f7:	8b 42 58             	mov    0x58(%edx),%eax
+  8033fa:	6a 01                	push   $0x1
+  8033fc:	50                   	push   %eax
+  8033fd:	53                   	push   %ebx
+  8033fe:	68 a1 48 80 00       	push   $0x8048a1
+  803403:	e8 00 d8 ff ff       	call   800c08 <cprintf>
+  803408:	83 c4 10             	add    $0x10,%esp
+  80340b:	eb b9                	jmp    8033c6 <_pipeisclosed+0xd>
+  80340d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803410:	0f 94 c0             	sete   %al
+  803413:	0f b6 c0             	movzbl %al,%eax
+  803416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803419:	5b                   	pop    %ebx
+  80341a:	5e                   	pop    %esi
+  80341b:	5f                   	pop    %edi
+  80341c:	5d                   	pop    %ebp
+  80341d:	c3                   	ret
+
+0080341e <devpipe_write>:
+  80341e:	55                   	push   %ebp
+  80341f:	89 e5                	mov    %esp,%ebp
+  803421:	57                   	push   %edi
+  803422:	56                   	push   %esi
+  803423:	53                   	push   %ebx
+  803424:	83 ec 28             	sub    $0x28,%esp
+  803427:	8b 75 08             	mov    0x8(%ebp),%esi
+  80342a:	56                   	push   %esi
+  80342b:	e8 bd ee ff ff       	call   8022ed <fd2data>
+  803430:	89 c3                	mov    %eax,%ebx
+  803432:	83 c4 10             	add    $0x10,%esp
+  803435:	bf 00 00 00 00       	mov    $0x0,%edi
+  80343a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80343e:	74 5c                	je     80349c <devpipe_write+0x7e>
+  803440:	8b 43 04             	mov    0x4(%ebx),%eax
+  803443:	8b 0b                	mov    (%ebx),%ecx
+  803445:	8d 51 20             	lea    0x20(%ecx),%edx
+  803448:	39 d0                	cmp    %edx,%eax
+  80344a:	72 1e                	jb     80346a <devpipe_write+0x4c>
+  80344c:	89 da                	mov    %ebx,%edx
+  80344e:	89 f0                	mov    %esi,%eax
+  803450:	e8 64 ff ff ff       	call   8033b9 <_pipeisclosed>
+  803455:	85 c0                	test   %eax,%eax
+  803457:	75 48                	jne    8034a1 <devpipe_write+0x83>
+  803459:	e8 b6 e2 ff ff       	call   801714 <sys_yield>
+  80345e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803461:	8b 0b                	mov    (%ebx),%ecx
+  803463:	8d 51 20             	lea    0x20(%ecx),%edx
+  803466:	39 d0                	cmp    %edx,%eax
+  803468:	73 e2                	jae    80344c <devpipe_write+0x2e>
+  80346a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80346d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803471:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803474:	89 c2                	mov    %eax,%edx
+  803476:	c1 fa 1f             	sar    $0x1f,%edx
+  803479:	89 d1                	mov    %edx,%ecx
+  80347b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80347e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803481:	83 e2 1f             	and    $0x1f,%edx
+  803484:	29 ca                	sub    %ecx,%edx
+  803486:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80348a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80348e:	83 c0 01             	add    $0x1,%eax
+  803491:	89 43 04             	mov    %eax,0x4(%ebx)
+  803494:	83 c7 01             	add    $0x1,%edi
+  803497:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80349a:	75 a4                	jne    803440 <devpipe_write+0x22>
+  80349c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80349f:	eb 05                	jmp    8034a6 <devpipe_write+0x88>
+  8034a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a9:	5b                   	pop    %ebx
+  8034aa:	5e                   	pop    %esi
+  8034ab:	5f                   	pop    %edi
+  8034ac:	5d                   	pop    %ebp
+  8034ad:	c3                   	ret
+
+008034ae <devpipe_read>:
+  8034ae:	55                   	push   %ebp
+  8034af:	89 e5                	mov    %esp,%ebp
+  8034b1:	57                   	push   %edi
+  8034b2:	56                   	push   %esi
+  8034b3:	53                   	push   %ebx
+  8034b4:	83 ec 18             	sub    $0x18,%esp
+  8034b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034ba:	56                   	push   %esi
+  8034bb:	e8 2d ee ff ff       	call   8022ed <fd2data>
+  8034c0:	89 c3                	mov    %eax,%ebx
+  8034c2:	83 c4 10             	add    $0x10,%esp
+  8034c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ca:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034ce:	74 45                	je     803515 <devpipe_read+0x67>
+  8034d0:	8b 03                	mov    (%ebx),%eax
+  8034d2:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8034d5:	75 1d                	jne    8034f4 <devpipe_read+0x46>
+  8034d7:	85 ff                	test   %edi,%edi
+  8034d9:	75 3f                	jne    80351a <devpipe_read+0x6c>
+  8034db:	89 da                	mov    %ebx,%edx
+  8034dd:	89 f0                	mov    %esi,%eax
+  8034df:	e8 d5 fe ff ff       	call   8033b9 <_pipeisclosed>
+  8034e4:	85 c0                	test   %eax,%eax
+  8034e6:	75 3c                	jne    803524 <devpipe_read+0x76>
+  8034e8:	e8 27 e2 ff ff       	call   801714 <sys_yield>
+  8034ed:	8b 03                	mov    (%ebx),%eax
+  8034ef:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8034f2:	74 e7                	je     8034db <devpipe_read+0x2d>
+  8034f4:	99                   	cltd
+  8034f5:	c1 ea 1b             	shr    $0x1b,%edx
+  8034f8:	01 d0                	add    %edx,%eax
+  8034fa:	83 e0 1f             	and    $0x1f,%eax
+  8034fd:	29 d0                	sub    %edx,%eax
+  8034ff:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803504:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803507:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80350a:	83 03 01             	addl   $0x1,(%ebx)
+  80350d:	83 c7 01             	add    $0x1,%edi
+  803510:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803513:	75 bb                	jne    8034d0 <devpipe_read+0x22>
+  803515:	8b 45 10             	mov    0x10(%ebp),%eax
+  803518:	eb 02                	jmp    80351c <devpipe_read+0x6e>
+  80351a:	89 f8                	mov    %edi,%eax
+  80351c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80351f:	5b                   	pop    %ebx
+  803520:	5e                   	pop    %esi
+  803521:	5f                   	pop    %edi
+  803522:	5d                   	pop    %ebp
+  803523:	c3                   	ret
+  803524:	b8 00 00 00 00       	mov    $0x0,%eax
+  803529:	eb f1                	jmp    80351c <devpipe_read+0x6e>
+
+0080352b <pipe>:
+  80352b:	55                   	push   %ebp
+  80352c:	89 e5                	mov    %esp,%ebp
+  80352e:	56                   	push   %esi
+  80352f:	53                   	push   %ebx
+  803530:	83 ec 1c             	sub    $0x1c,%esp
+  803533:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803536:	50                   	push   %eax
+  803537:	e8 c8 ed ff ff       	call   802304 <fd_alloc>
+  80353c:	89 c3                	mov    %eax,%ebx
+  80353e:	83 c4 10             	add    $0x10,%esp
+  803541:	85 c0                	test   %eax,%eax
+  803543:	0f 88 23 01 00 00    	js     80366c <pipe+0x141>
+  803549:	83 ec 04             	sub    $0x4,%esp
+  80354c:	68 07 04 00 00       	push   $0x407
+  803551:	ff 75 f4             	push   -0xc(%ebp)
+  803554:	6a 00                	push   $0x0
+  803556:	e8 04 e2 ff ff       	call   80175f <sys_page_alloc>
+  80355b:	89 c3                	mov    %eax,%ebx
+  80355d:	83 c4 10             	add    $0x10,%esp
+  803560:	85 c0                	test   %eax,%eax
+  803562:	0f 88 04 01 00 00    	js     80366c <pipe+0x141>
+  803568:	83 ec 0c             	sub    $0xc,%esp
+  80356b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80356e:	50                   	push   %eax
+  80356f:	e8 90 ed ff ff       	call   802304 <fd_alloc>
+  803574:	89 c3                	mov    %eax,%ebx
+  803576:	83 c4 10             	add    $0x10,%esp
+  803579:	85 c0                	test   %eax,%eax
+  80357b:	0f 88 db 00 00 00    	js     80365c <pipe+0x131>
+  803581:	83 ec 04             	sub    $0x4,%esp
+  803584:	68 07 04 00 00       	push   $0x407
+  803589:	ff 75 f0             	push   -0x10(%ebp)
+  80358c:	6a 00                	push   $0x0
+  80358e:	e8 cc e1 ff ff       	call   80175f <sys_page_alloc>
+  803593:	89 c3                	mov    %eax,%ebx
+  803595:	83 c4 10             	add    $0x10,%esp
+  803598:	85 c0                	test   %eax,%eax
+  80359a:	0f 88 bc 00 00 00    	js     80365c <pipe+0x131>
+  8035a0:	83 ec 0c             	sub    $0xc,%esp
+  8035a3:	ff 75 f4             	push   -0xc(%ebp)
+  8035a6:	e8 42 ed ff ff       	call   8022ed <fd2data>
+  8035ab:	89 c6                	mov    %eax,%esi
+  8035ad:	83 c4 0c             	add    $0xc,%esp
+  8035b0:	68 07 04 00 00       	push   $0x407
+  8035b5:	50                   	push   %eax
+  8035b6:	6a 00                	push   $0x0
+  8035b8:	e8 a2 e1 ff ff       	call   80175f <sys_page_alloc>
+  8035bd:	89 c3                	mov    %eax,%ebx
+  8035bf:	83 c4 10             	add    $0x10,%esp
+  8035c2:	85 c0                	test   %eax,%eax
+  8035c4:	0f 88 82 00 00 00    	js     80364c <pipe+0x121>
+  8035ca:	83 ec 0c             	sub    $0xc,%esp
+  8035cd:	ff 75 f0             	push   -0x10(%ebp)
+  8035d0:	e8 18 ed ff ff       	call   8022ed <fd2data>
+  8035d5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8035dc:	50                   	push   %eax
+  8035dd:	6a 00                	push   $0x0
+  8035df:	56                   	push   %esi
+  8035e0:	6a 00                	push   $0x0
+  8035e2:	e8 bb e1 ff ff       	call   8017a2 <sys_page_map>
+  8035e7:	89 c3                	mov    %eax,%ebx
+  8035e9:	83 c4 20             	add    $0x20,%esp
+  8035ec:	85 c0                	test   %eax,%eax
+  8035ee:	78 4e                	js     80363e <pipe+0x113>
+  8035f0:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  8035f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035f8:	89 02                	mov    %eax,(%edx)
+  8035fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8035fd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803604:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803607:	89 02                	mov    %eax,(%edx)
+  803609:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80360c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803613:	83 ec 0c             	sub    $0xc,%esp
+  803616:	ff 75 f4             	push   -0xc(%ebp)
+  803619:	e8 bf ec ff ff       	call   8022dd <fd2num>
+  80361e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803621:	89 01                	mov    %eax,(%ecx)
+  803623:	83 c4 04             	add    $0x4,%esp
+  803626:	ff 75 f0             	push   -0x10(%ebp)
+  803629:	e8 af ec ff ff       	call   8022dd <fd2num>
+  80362e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803631:	89 41 04             	mov    %eax,0x4(%ecx)
+  803634:	83 c4 10             	add    $0x10,%esp
+  803637:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80363c:	eb 2e                	jmp    80366c <pipe+0x141>
+  80363e:	83 ec 08             	sub    $0x8,%esp
+  803641:	56                   	push   %esi
+  803642:	6a 00                	push   $0x0
+  803644:	e8 e8 e1 ff ff       	call   801831 <sys_page_unmap>
+  803649:	83 c4 10             	add    $0x10,%esp
+  80364c:	83 ec 08             	sub    $0x8,%esp
+  80364f:	ff 75 f0             	push   -0x10(%ebp)
+  803652:	6a 00                	push   $0x0
+  803654:	e8 d8 e1 ff ff       	call   801831 <sys_page_unmap>
+  803659:	83 c4 10             	add    $0x10,%esp
+  80365c:	83 ec 08             	sub    $0x8,%esp
+  80365f:	ff 75 f4             	push   -0xc(%ebp)
+  803662:	6a 00                	push   $0x0
+  803664:	e8 c8 e1 ff ff       	call   801831 <sys_page_unmap>
+  803669:	83 c4 10             	add    $0x10,%esp
+  80366c:	89 d8                	mov    %ebx,%eax
+  80366e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803671:	5b                   	pop    %ebx
+  803672:	5e                   	pop    %esi
+  803673:	5d                   	pop    %ebp
+  803674:	c3                   	ret
+
+00803675 <pipeisclosed>:
+  803675:	55                   	push   %ebp
+  803676:	89 e5                	mov    %esp,%ebp
+  803678:	83 ec 20             	sub    $0x20,%esp
+  80367b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80367e:	50                   	push   %eax
+  80367f:	ff 75 08             	push   0x8(%ebp)
+  803682:	e8 cd ec ff ff       	call   802354 <fd_lookup>
+  803687:	83 c4 10             	add    $0x10,%esp
+  80368a:	85 c0                	test   %eax,%eax
+  80368c:	78 18                	js     8036a6 <pipeisclosed+0x31>
+  80368e:	83 ec 0c             	sub    $0xc,%esp
+  803691:	ff 75 f4             	push   -0xc(%ebp)
+  803694:	e8 54 ec ff ff       	call   8022ed <fd2data>
+  803699:	89 c2                	mov    %eax,%edx
+  80369b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80369e:	e8 16 fd ff ff       	call   8033b9 <_pipeisclosed>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	c9                   	leave
+  8036a7:	c3                   	ret
+
+008036a8 <ipcring_init>:
+  8036a8:	55                   	push   %ebp
+  8036a9:	89 e5                	mov    %esp,%ebp
+  8036ab:	53                   	push   %ebx
+  8036ac:	83 ec 08             	sub    $0x8,%esp
+  8036af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8036b2:	6a 60                	push   $0x60
+  8036b4:	6a 00                	push   $0x0
+  8036b6:	53                   	push   %ebx
+  8036b7:	e8 be dd ff ff       	call   80147a <memset>
+  8036bc:	a1 48 60 80 00       	mov    0x806048,%eax
+  8036c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8036c4:	89 03                	mov    %eax,(%ebx)
+  8036c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036c9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8036cc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036cf:	89 43 08             	mov    %eax,0x8(%ebx)
+  8036d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036d5:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8036d8:	83 c4 10             	add    $0x10,%esp
+  8036db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036de:	c9                   	leave
+  8036df:	c3                   	ret
+
+008036e0 <ipcring_req_slot>:
+  8036e0:	55                   	push   %ebp
+  8036e1:	89 e5                	mov    %esp,%ebp
+  8036e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036e6:	8b 50 10             	mov    0x10(%eax),%edx
+  8036e9:	8b 48 18             	mov    0x18(%eax),%ecx
+  8036ec:	29 ca                	sub    %ecx,%edx
+  8036ee:	83 fa 07             	cmp    $0x7,%edx
+  8036f1:	77 0c                	ja     8036ff <ipcring_req_slot+0x1f>
+  8036f3:	8b 50 10             	mov    0x10(%eax),%edx
+  8036f6:	83 e2 07             	and    $0x7,%edx
+  8036f9:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  8036fd:	5d                   	pop    %ebp
+  8036fe:	c3                   	ret
+  8036ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803704:	eb f7                	jmp    8036fd <ipcring_req_slot+0x1d>
+
+00803706 <ipcring_req_push>:
+  803706:	55                   	push   %ebp
+  803707:	89 e5                	mov    %esp,%ebp
+  803709:	83 ec 08             	sub    $0x8,%esp
+  80370c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80370f:	8b 42 10             	mov    0x10(%edx),%eax
+  803712:	83 c0 01             	add    $0x1,%eax
+  803715:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371e:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803722:	85 c0                	test   %eax,%eax
+  803724:	75 02                	jne    803728 <ipcring_req_push+0x22>
+  803726:	c9                   	leave
+  803727:	c3                   	ret
+  803728:	6a 00                	push   $0x0
+  80372a:	68 00 00 80 ee       	push   $0xee800000
+  80372f:	ff 72 08             	push   0x8(%edx)
+  803732:	ff 72 04             	push   0x4(%edx)
+  803735:	e8 5d e3 ff ff       	call   801a97 <sys_ipc_send>
+  80373a:	83 c4 10             	add    $0x10,%esp
+  80373d:	eb e7                	jmp    803726 <ipcring_req_push+0x20>
+
+0080373f <ipcring_rsp_wait>:
+  80373f:	55                   	push   %ebp
+  803740:	89 e5                	mov    %esp,%ebp
+  803742:	53                   	push   %ebx
+  803743:	83 ec 04             	sub    $0x4,%esp
+  803746:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803749:	8b 53 18             	mov    0x18(%ebx),%edx
+  80374c:	8b 43 10             	mov    0x10(%ebx),%eax
+  80374f:	39 c2                	cmp    %eax,%edx
+  803751:	74 3c                	je     80378f <ipcring_rsp_wait+0x50>
+  803753:	8b 53 14             	mov    0x14(%ebx),%edx
+  803756:	8b 43 18             	mov    0x18(%ebx),%eax
+  803759:	39 c2                	cmp    %eax,%edx
+  80375b:	75 23                	jne    803780 <ipcring_rsp_wait+0x41>
+  80375d:	83 ec 08             	sub    $0x8,%esp
+  803760:	6a 00                	push   $0x0
+  803762:	6a 00                	push   $0x0
+  803764:	6a 00                	push   $0x0
+  803766:	6a 00                	push   $0x0
+  803768:	ff 73 0c             	push   0xc(%ebx)
+  80376b:	ff 73 04             	push   0x4(%ebx)
+  80376e:	e8 b5 e9 ff ff       	call   802128 <ipc_call>
+  803773:	8b 53 14             	mov    0x14(%ebx),%edx
+  803776:	8b 43 18             	mov    0x18(%ebx),%eax
+  803779:	83 c4 20             	add    $0x20,%esp
+  80377c:	39 c2                	cmp    %eax,%edx
+  80377e:	74 dd                	je     80375d <ipcring_rsp_wait+0x1e>
+  803780:	8b 43 18             	mov    0x18(%ebx),%eax
+  803783:	83 e0 07             	and    $0x7,%eax
+  803786:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  80378a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80378d:	c9                   	leave
+  80378e:	c3                   	ret
+  80378f:	68 bc 48 80 00       	push   $0x8048bc
+  803794:	68 6d 48 80 00       	push   $0x80486d
+  803799:	6a 3b                	push   $0x3b
+  80379b:	68 dd 48 80 00       	push   $0x8048dd
+  8037a0:	e8 88 d3 ff ff       	call   800b2d <_panic>
+
+008037a5 <ipcring_rsp_pop>:
+  8037a5:	55                   	push   %ebp
+  8037a6:	89 e5                	mov    %esp,%ebp
+  8037a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8037ab:	8b 42 18             	mov    0x18(%edx),%eax
+  8037ae:	83 c0 01             	add    $0x1,%eax
+  8037b1:	89 42 18             	mov    %eax,0x18(%edx)
+  8037b4:	5d                   	pop    %ebp
+  8037b5:	c3                   	ret
+
+008037b6 <ipcring_server_init>:
+  8037b6:	55                   	push   %ebp
+  8037b7:	89 e5                	mov    %esp,%ebp
+  8037b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037bf:	89 10                	mov    %edx,(%eax)
+  8037c1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8037c4:	89 50 04             	mov    %edx,0x4(%eax)
+  8037c7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  8037ce:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8037d5:	5d                   	pop    %ebp
+  8037d6:	c3                   	ret
+
+008037d7 <ipcring_req_avail>:
+  8037d7:	55                   	push   %ebp
+  8037d8:	89 e5                	mov    %esp,%ebp
+  8037da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8037dd:	8b 02                	mov    (%edx),%eax
+  8037df:	8b 40 10             	mov    0x10(%eax),%eax
+  8037e2:	2b 42 08             	sub    0x8(%edx),%eax
+  8037e5:	ba 08 00 00 00       	mov    $0x8,%edx
+  8037ea:	39 d0                	cmp    %edx,%eax
+  8037ec:	0f 47 c2             	cmova  %edx,%eax
+  8037ef:	5d                   	pop    %ebp
+  8037f0:	c3                   	ret
+
+008037f1 <ipcring_req_peek>:
+  8037f1:	55                   	push   %ebp
+  8037f2:	89 e5                	mov    %esp,%ebp
+  8037f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8037f7:	8b 42 08             	mov    0x8(%edx),%eax
+  8037fa:	83 e0 07             	and    $0x7,%eax
+  8037fd:	8b 12                	mov    (%edx),%edx
+  8037ff:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803803:	5d                   	pop    %ebp
+  803804:	c3                   	ret
+
+00803805 <ipcring_rsp_push>:
+  803805:	55                   	push   %ebp
+  803806:	89 e5                	mov    %esp,%ebp
+  803808:	83 ec 08             	sub    $0x8,%esp
+  80380b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80380e:	8b 41 08             	mov    0x8(%ecx),%eax
+  803811:	83 c0 01             	add    $0x1,%eax
+  803814:	89 41 08             	mov    %eax,0x8(%ecx)
+  803817:	8b 11                	mov    (%ecx),%edx
+  803819:	83 c2 14             	add    $0x14,%edx
+  80381c:	f0 87 02             	lock xchg %eax,(%edx)
+  80381f:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803823:	75 02                	jne    803827 <ipcring_rsp_push+0x22>
+  803825:	c9                   	leave
+  803826:	c3                   	ret
+  803827:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80382e:	6a 00                	push   $0x0
+  803830:	68 00 00 80 ee       	push   $0xee800000
+  803835:	6a 00                	push   $0x0
+  803837:	ff 71 04             	push   0x4(%ecx)
+  80383a:	e8 7b e1 ff ff       	call   8019ba <sys_ipc_try_send>
+  80383f:	83 c4 10             	add    $0x10,%esp
+  803842:	eb e1                	jmp    803825 <ipcring_rsp_push+0x20>
+
+00803844 <ipcring_client_wait>:
+  803844:	55                   	push   %ebp
+  803845:	89 e5                	mov    %esp,%ebp
+  803847:	83 ec 08             	sub    $0x8,%esp
+  80384a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80384d:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803854:	8b 10                	mov    (%eax),%edx
+  803856:	8b 52 18             	mov    0x18(%edx),%edx
+  803859:	3b 50 08             	cmp    0x8(%eax),%edx
+  80385c:	75 02                	jne    803860 <ipcring_client_wait+0x1c>
+  80385e:	c9                   	leave
+  80385f:	c3                   	ret
+  803860:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803867:	6a 00                	push   $0x0
+  803869:	68 00 00 80 ee       	push   $0xee800000
+  80386e:	6a 00                	push   $0x0
+  803870:	ff 70 04             	push   0x4(%eax)
+  803873:	e8 42 e1 ff ff       	call   8019ba <sys_ipc_try_send>
+  803878:	83 c4 10             	add    $0x10,%esp
+  80387b:	eb e1                	jmp    80385e <ipcring_client_wait+0x1a>
+
+0080387d <ipcring_server_sleep>:
+  80387d:	55                   	push   %ebp
+  80387e:	89 e5                	mov    %esp,%ebp
+  803880:	53                   	push   %ebx
+  803881:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803884:	8b 01                	mov    (%ecx),%eax
+  803886:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803889:	b8 01 00 00 00       	mov    $0x1,%eax
+  80388e:	f0 87 02             	lock xchg %eax,(%edx)
+  803891:	8b 11                	mov    (%ecx),%edx
+  803893:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803896:	b8 01 00 00 00       	mov    $0x1,%eax
+  80389b:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80389e:	74 0e                	je     8038ae <ipcring_server_sleep+0x31>
+  8038a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a5:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8038a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038b1:	c9                   	leave
+  8038b2:	c3                   	ret
+
+008038b3 <devcons_close>:
+  8038b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b8:	c3                   	ret
+
+008038b9 <devcons_stat>:
+  8038b9:	55                   	push   %ebp
+  8038ba:	89 e5                	mov    %esp,%ebp
+  8038bc:	83 ec 10             	sub    $0x10,%esp
+  8038bf:	68 eb 48 80 00       	push   $0x8048eb
+  8038c4:	ff 75 0c             	push   0xc(%ebp)
+  8038c7:	e8 33 da ff ff       	call   8012ff <strcpy>
+  8038cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d1:	c9                   	leave
+  8038d2:	c3                   	ret
+
+008038d3 <devcons_write>:
+  8038d3:	55                   	push   %ebp
+  8038d4:	89 e5                	mov    %esp,%ebp
+  8038d6:	57                   	push   %edi
+  8038d7:	56                   	push   %esi
+  8038d8:	53                   	push   %ebx
+  8038d9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8038df:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8038e2:	85 ff                	test   %edi,%edi
+  8038e4:	74 51                	je     803937 <devcons_write+0x64>
+  8038e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8038eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f0:	89 fb                	mov    %edi,%ebx
+  8038f2:	29 c3                	sub    %eax,%ebx
+  8038f4:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8038f9:	39 d3                	cmp    %edx,%ebx
+  8038fb:	0f 47 da             	cmova  %edx,%ebx
+  8038fe:	83 ec 04             	sub    $0x4,%esp
+  803901:	53                   	push   %ebx
+  803902:	03 45 0c             	add    0xc(%ebp),%eax
+  803905:	50                   	push   %eax
+  803906:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80390c:	50                   	push   %eax
+  80390d:	e8 9d db ff ff       	call   8014af <memmove>
+  803912:	83 c4 08             	add    $0x8,%esp
+  803915:	53                   	push   %ebx
+  803916:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80391c:	50                   	push   %eax
+  80391d:	e8 55 dd ff ff       	call   801677 <sys_cputs>
+  803922:	01 de                	add    %ebx,%esi
+  803924:	89 f0                	mov    %esi,%eax
+  803926:	83 c4 10             	add    $0x10,%esp
+  803929:	39 fe                	cmp    %edi,%esi
+  80392b:	72 c3                	jb     8038f0 <devcons_write+0x1d>
+  80392d:	89 f0                	mov    %esi,%eax
+  80392f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803932:	5b                   	pop    %ebx
+  803933:	5e                   	pop    %esi
+  803934:	5f                   	pop    %edi
+  803935:	5d                   	pop    %ebp
+  803936:	c3                   	ret
+  803937:	be 00 00 00 00       	mov    $0x0,%esi
+  80393c:	eb ef                	jmp    80392d <devcons_write+0x5a>
+
+0080393e <devcons_read>:
+  80393e:	55                   	push   %ebp
+  80393f:	89 e5                	mov    %esp,%ebp
+  803941:	83 ec 08             	sub    $0x8,%esp
+  803944:	b8 00 00 00 00       	mov    $0x0,%eax
+  803949:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80394d:	75 07                	jne    803956 <devcons_read+0x18>
+  80394f:	eb 1f                	jmp    803970 <devcons_read+0x32>
+  803951:	e8 be dd ff ff       	call   801714 <sys_yield>
+  803956:	e8 3a dd ff ff       	call   801695 <sys_cgetc>
+  80395b:	85 c0                	test   %eax,%eax
+  80395d:	74 f2                	je     803951 <devcons_read+0x13>
+  80395f:	78 0f                	js     803970 <devcons_read+0x32>
+  803961:	83 f8 04             	cmp    $0x4,%eax
+  803964:	74 0c                	je     803972 <devcons_read+0x34>
+  803966:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803969:	88 02                	mov    %al,(%edx)
+  80396b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803970:	c9                   	leave
+  803971:	c3                   	ret
+  803972:	b8 00 00 00 00       	mov    $0x0,%eax
+  803977:	eb f7                	jmp    803970 <devcons_read+0x32>
+
+00803979 <cputchar>:
+  803979:	55                   	push   %ebp
+  80397a:	89 e5                	mov    %esp,%ebp
+  80397c:	83 ec 20             	sub    $0x20,%esp
+  80397f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803982:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803985:	6a 01                	push   $0x1
+  803987:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80398a:	50                   	push   %eax
+  80398b:	e8 e7 dc ff ff       	call   801677 <sys_cputs>
+  803990:	83 c4 10             	add    $0x10,%esp
+  803993:	c9                   	leave
+  803994:	c3                   	ret
+
+00803995 <getchar>:
+  803995:	55                   	push   %ebp
+  803996:	89 e5                	mov    %esp,%ebp
+  803998:	83 ec 1c             	sub    $0x1c,%esp
+  80399b:	6a 01                	push   $0x1
+  80399d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8039a0:	50                   	push   %eax
+  8039a1:	6a 00                	push   $0x0
+  8039a3:	e8 0e ec ff ff       	call   8025b6 <read>
+  8039a8:	83 c4 10             	add    $0x10,%esp
+  8039ab:	85 c0                	test   %eax,%eax
+  8039ad:	78 06                	js     8039b5 <getchar+0x20>
+  8039af:	74 06                	je     8039b7 <getchar+0x22>
+  8039b1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8039b5:	c9                   	leave
+  8039b6:	c3                   	ret
+  8039b7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8039bc:	eb f7                	jmp    8039b5 <getchar+0x20>
+
+008039be <iscons>:
+  8039be:	55                   	push   %ebp
+  8039bf:	89 e5                	mov    %esp,%ebp
+  8039c1:	83 ec 20             	sub    $0x20,%esp
+  8039c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039c7:	50                   	push   %eax
+  8039c8:	ff 75 08             	push   0x8(%ebp)
+  8039cb:	e8 84 e9 ff ff       	call   802354 <fd_lookup>
+  8039d0:	83 c4 10             	add    $0x10,%esp
+  8039d3:	85 c0                	test   %eax,%eax
+  8039d5:	78 11                	js     8039e8 <iscons+0x2a>
+  8039d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039da:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  8039e0:	39 10                	cmp    %edx,(%eax)
+  8039e2:	0f 94 c0             	sete   %al
+  8039e5:	0f b6 c0             	movzbl %al,%eax
+  8039e8:	c9                   	leave
+  8039e9:	c3                   	ret
+
+008039ea <opencons>:
+  8039ea:	55                   	push   %ebp
+  8039eb:	89 e5                	mov    %esp,%ebp
+  8039ed:	83 ec 24             	sub    $0x24,%esp
+  8039f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039f3:	50                   	push   %eax
+  8039f4:	e8 0b e9 ff ff       	call   802304 <fd_alloc>
+  8039f9:	83 c4 10             	add    $0x10,%esp
+  8039fc:	85 c0                	test   %eax,%eax
+  8039fe:	78 3a                	js     803a3a <opencons+0x50>
+  803a00:	83 ec 04             	sub    $0x4,%esp
+  803a03:	68 07 04 00 00       	push   $0x407
+  803a08:	ff 75 f4             	push   -0xc(%ebp)
+  803a0b:	6a 00                	push   $0x0
+  803a0d:	e8 4d dd ff ff       	call   80175f <sys_page_alloc>
+  803a12:	83 c4 10             	add    $0x10,%esp
+  803a15:	85 c0                	test   %eax,%eax
+  803a17:	78 21                	js     803a3a <opencons+0x50>
+  803a19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a1c:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803a22:	89 10                	mov    %edx,(%eax)
+  803a24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a27:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803a2e:	83 ec 0c             	sub    $0xc,%esp
+  803a31:	50                   	push   %eax
+  803a32:	e8 a6 e8 ff ff       	call   8022dd <fd2num>
+  803a37:	83 c4 10             	add    $0x10,%esp
+  803a3a:	c9                   	leave
+  803a3b:	c3                   	ret
+
+00803a3c <pageref>:
+  803a3c:	55                   	push   %ebp
+  803a3d:	89 e5                	mov    %esp,%ebp
+  803a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a42:	89 c2                	mov    %eax,%edx
+  803a44:	c1 ea 16             	shr    $0x16,%edx
+  803a47:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a53:	f6 c1 01             	test   $0x1,%cl
+  803a56:	74 22                	je     803a7a <pageref+0x3e>
+  803a58:	c1 e8 0c             	shr    $0xc,%eax
+  803a5b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a62:	a8 01                	test   $0x1,%al
+  803a64:	74 14                	je     803a7a <pageref+0x3e>
+  803a66:	c1 e8 0c             	shr    $0xc,%eax
+  803a69:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803a6c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803a73:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803a77:	0f b7 d2             	movzwl %dx,%edx
+  803a7a:	89 d0                	mov    %edx,%eax
+  803a7c:	5d                   	pop    %ebp
+  803a7d:	c3                   	ret
+
+00803a7e <inet_ntoa>:
+  803a7e:	55                   	push   %ebp
+  803a7f:	89 e5                	mov    %esp,%ebp
+  803a81:	57                   	push   %edi
+  803a82:	56                   	push   %esi
+  803a83:	53                   	push   %ebx
+  803a84:	83 ec 1c             	sub    $0x1c,%esp
+  803a87:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a8a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  803a8d:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  803a90:	bf 10 60 80 00       	mov    $0x806010,%edi
+  803a95:	0f b6 16             	movzbl (%esi),%edx
+  803a98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a9d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803aa0:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  803aa3:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803aa8:	f6 e2                	mul    %dl
+  803aaa:	66 c1 e8 0b          	shr    $0xb,%ax
+  803aae:	89 c7                	mov    %eax,%edi
+  803ab0:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803ab3:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803ab6:	01 db                	add    %ebx,%ebx
+  803ab8:	89 d0                	mov    %edx,%eax
+  803aba:	29 d8                	sub    %ebx,%eax
+  803abc:	89 d6                	mov    %edx,%esi
+  803abe:	89 fa                	mov    %edi,%edx
+  803ac0:	89 cb                	mov    %ecx,%ebx
+  803ac2:	83 c1 01             	add    $0x1,%ecx
+  803ac5:	0f b6 fb             	movzbl %bl,%edi
+  803ac8:	83 c0 30             	add    $0x30,%eax
+  803acb:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+  803acf:	89 f0                	mov    %esi,%eax
+  803ad1:	3c 09                	cmp    $0x9,%al
+  803ad3:	77 ce                	ja     803aa3 <inet_ntoa+0x25>
+  803ad5:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803ad8:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803adb:	88 16                	mov    %dl,(%esi)
+  803add:	84 c9                	test   %cl,%cl
+  803adf:	74 4d                	je     803b2e <inet_ntoa+0xb0>
+  803ae1:	0f b6 db             	movzbl %bl,%ebx
+  803ae4:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803ae7:	01 d8                	add    %ebx,%eax
+  803ae9:	89 f9                	mov    %edi,%ecx
+  803aeb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803aee:	83 c1 01             	add    $0x1,%ecx
+  803af1:	0f b6 10             	movzbl (%eax),%edx
+  803af4:	88 51 ff             	mov    %dl,-0x1(%ecx)
+  803af7:	89 c2                	mov    %eax,%edx
+  803af9:	83 e8 01             	sub    $0x1,%eax
+  803afc:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803aff:	39 da                	cmp    %ebx,%edx
+  803b01:	75 eb                	jne    803aee <inet_ntoa+0x70>
+  803b03:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803b06:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  803b0a:	8d 78 01             	lea    0x1(%eax),%edi
+  803b0d:	c6 00 2e             	movb   $0x2e,(%eax)
+  803b10:	83 c6 01             	add    $0x1,%esi
+  803b13:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803b16:	39 ce                	cmp    %ecx,%esi
+  803b18:	0f 85 77 ff ff ff    	jne    803a95 <inet_ntoa+0x17>
+  803b1e:	c6 00 00             	movb   $0x0,(%eax)
+  803b21:	b8 10 60 80 00       	mov    $0x806010,%eax
+  803b26:	83 c4 1c             	add    $0x1c,%esp
+  803b29:	5b                   	pop    %ebx
+  803b2a:	5e                   	pop    %esi
+  803b2b:	5f                   	pop    %edi
+  803b2c:	5d                   	pop    %ebp
+  803b2d:	c3                   	ret
+  803b2e:	89 f8                	mov    %edi,%eax
+  803b30:	eb d8                	jmp    803b0a <inet_ntoa+0x8c>
+
+00803b32 <htons>:
+  803b32:	55                   	push   %ebp
+  803b33:	89 e5                	mov    %esp,%ebp
+  803b35:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803b39:	66 c1 c0 08          	rol    $0x8,%ax
+  803b3d:	5d                   	pop    %ebp
+  803b3e:	c3                   	ret
+
+00803b3f <ntohs>:
+  803b3f:	55                   	push   %ebp
+  803b40:	89 e5                	mov    %esp,%ebp
+  803b42:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803b46:	66 c1 c0 08          	rol    $0x8,%ax
+  803b4a:	5d                   	pop    %ebp
+  803b4b:	c3                   	ret
+
+00803b4c <htonl>:
+  803b4c:	55                   	push   %ebp
+  803b4d:	89 e5                	mov    %esp,%ebp
+  803b4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803b52:	89 d0                	mov    %edx,%eax
+  803b54:	c1 e0 18             	shl    $0x18,%eax
+  803b57:	89 d1                	mov    %edx,%ecx
+  803b59:	c1 e9 18             	shr    $0x18,%ecx
+  803b5c:	09 c8                	or     %ecx,%eax
+  803b5e:	89 d1                	mov    %edx,%ecx
+  803b60:	c1 e1 08             	shl    $0x8,%ecx
+  803b63:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+  803b69:	09 c8                	or     %ecx,%eax
+  803b6b:	c1 ea 08             	shr    $0x8,%edx
+  803b6e:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803b74:	09 d0                	or     %edx,%eax
+  803b76:	5d                   	pop    %ebp
+  803b77:	c3                   	ret
+
+00803b78 <inet_aton>:
+  803b78:	55                   	push   %ebp
+  803b79:	89 e5                	mov    %esp,%ebp
+  803b7b:	57                   	push   %edi
+  803b7c:	56                   	push   %esi
+  803b7d:	53                   	push   %ebx
+  803b7e:	83 ec 2c             	sub    $0x2c,%esp
+  803b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  803b84:	0f b6 0a             	movzbl (%edx),%ecx
+  803b87:	0f be c1             	movsbl %cl,%eax
+  803b8a:	83 e9 30             	sub    $0x30,%ecx
+  803b8d:	80 f9 09             	cmp    $0x9,%cl
+  803b90:	0f 87 b6 01 00 00    	ja     803d4c <inet_aton+0x1d4>
+  803b96:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  803b99:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803b9c:	e9 aa 00 00 00       	jmp    803c4b <inet_aton+0xd3>
+  803ba1:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  803ba5:	89 c1                	mov    %eax,%ecx
+  803ba7:	83 e1 df             	and    $0xffffffdf,%ecx
+  803baa:	80 f9 58             	cmp    $0x58,%cl
+  803bad:	74 10                	je     803bbf <inet_aton+0x47>
+  803baf:	83 c2 01             	add    $0x1,%edx
+  803bb2:	0f be c0             	movsbl %al,%eax
+  803bb5:	bf 08 00 00 00       	mov    $0x8,%edi
+  803bba:	e9 9a 00 00 00       	jmp    803c59 <inet_aton+0xe1>
+  803bbf:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803bc3:	8d 52 02             	lea    0x2(%edx),%edx
+  803bc6:	bf 10 00 00 00       	mov    $0x10,%edi
+  803bcb:	e9 89 00 00 00       	jmp    803c59 <inet_aton+0xe1>
+  803bd0:	0f af d7             	imul   %edi,%edx
+  803bd3:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  803bd7:	0f be 01             	movsbl (%ecx),%eax
+  803bda:	83 c1 01             	add    $0x1,%ecx
+  803bdd:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803be0:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803be3:	80 fb 09             	cmp    $0x9,%bl
+  803be6:	76 e8                	jbe    803bd0 <inet_aton+0x58>
+  803be8:	83 ff 10             	cmp    $0x10,%edi
+  803beb:	75 2e                	jne    803c1b <inet_aton+0xa3>
+  803bed:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803bf1:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803bf4:	83 e3 df             	and    $0xffffffdf,%ebx
+  803bf7:	83 eb 41             	sub    $0x41,%ebx
+  803bfa:	80 fb 05             	cmp    $0x5,%bl
+  803bfd:	77 1c                	ja     803c1b <inet_aton+0xa3>
+  803bff:	c1 e2 04             	shl    $0x4,%edx
+  803c02:	83 c0 0a             	add    $0xa,%eax
+  803c05:	89 f3                	mov    %esi,%ebx
+  803c07:	80 fb 1a             	cmp    $0x1a,%bl
+  803c0a:	19 db                	sbb    %ebx,%ebx
+  803c0c:	83 e3 20             	and    $0x20,%ebx
+  803c0f:	83 c3 41             	add    $0x41,%ebx
+  803c12:	29 d8                	sub    %ebx,%eax
+  803c14:	09 c2                	or     %eax,%edx
+  803c16:	0f be 01             	movsbl (%ecx),%eax
+  803c19:	eb bf                	jmp    803bda <inet_aton+0x62>
+  803c1b:	83 f8 2e             	cmp    $0x2e,%eax
+  803c1e:	75 46                	jne    803c66 <inet_aton+0xee>
+  803c20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803c23:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803c26:	39 f0                	cmp    %esi,%eax
+  803c28:	0f 84 25 01 00 00    	je     803d53 <inet_aton+0x1db>
+  803c2e:	83 c0 04             	add    $0x4,%eax
+  803c31:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803c34:	89 50 fc             	mov    %edx,-0x4(%eax)
+  803c37:	89 ca                	mov    %ecx,%edx
+  803c39:	0f b6 09             	movzbl (%ecx),%ecx
+  803c3c:	0f be c1             	movsbl %cl,%eax
+  803c3f:	83 e9 30             	sub    $0x30,%ecx
+  803c42:	80 f9 09             	cmp    $0x9,%cl
+  803c45:	0f 87 17 01 00 00    	ja     803d62 <inet_aton+0x1ea>
+  803c4b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803c50:	83 f8 30             	cmp    $0x30,%eax
+  803c53:	0f 84 48 ff ff ff    	je     803ba1 <inet_aton+0x29>
+  803c59:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803c5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c61:	e9 77 ff ff ff       	jmp    803bdd <inet_aton+0x65>
+  803c66:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803c6a:	89 d6                	mov    %edx,%esi
+  803c6c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	74 2e                	je     803ca1 <inet_aton+0x129>
+  803c73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c78:	89 fa                	mov    %edi,%edx
+  803c7a:	80 fa 1f             	cmp    $0x1f,%dl
+  803c7d:	0f 86 d5 00 00 00    	jbe    803d58 <inet_aton+0x1e0>
+  803c83:	84 c0                	test   %al,%al
+  803c85:	0f 88 cd 00 00 00    	js     803d58 <inet_aton+0x1e0>
+  803c8b:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803c8e:	83 f9 04             	cmp    $0x4,%ecx
+  803c91:	76 0e                	jbe    803ca1 <inet_aton+0x129>
+  803c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c98:	83 f8 20             	cmp    $0x20,%eax
+  803c9b:	0f 85 b7 00 00 00    	jne    803d58 <inet_aton+0x1e0>
+  803ca1:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803ca4:	89 d8                	mov    %ebx,%eax
+  803ca6:	29 c8                	sub    %ecx,%eax
+  803ca8:	c1 f8 02             	sar    $0x2,%eax
+  803cab:	8d 48 01             	lea    0x1(%eax),%ecx
+  803cae:	83 f8 02             	cmp    $0x2,%eax
+  803cb1:	74 7a                	je     803d2d <inet_aton+0x1b5>
+  803cb3:	83 f9 03             	cmp    $0x3,%ecx
+  803cb6:	7f 49                	jg     803d01 <inet_aton+0x189>
+  803cb8:	85 c9                	test   %ecx,%ecx
+  803cba:	0f 84 98 00 00 00    	je     803d58 <inet_aton+0x1e0>
+  803cc0:	83 f9 02             	cmp    $0x2,%ecx
+  803cc3:	75 19                	jne    803cde <inet_aton+0x166>
+  803cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cca:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803cd0:	0f 87 82 00 00 00    	ja     803d58 <inet_aton+0x1e0>
+  803cd6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803cd9:	c1 e0 18             	shl    $0x18,%eax
+  803cdc:	09 c6                	or     %eax,%esi
+  803cde:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ce3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803ce7:	74 6f                	je     803d58 <inet_aton+0x1e0>
+  803ce9:	83 ec 0c             	sub    $0xc,%esp
+  803cec:	56                   	push   %esi
+  803ced:	e8 5a fe ff ff       	call   803b4c <htonl>
+  803cf2:	83 c4 10             	add    $0x10,%esp
+  803cf5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803cf8:	89 06                	mov    %eax,(%esi)
+  803cfa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803cff:	eb 57                	jmp    803d58 <inet_aton+0x1e0>
+  803d01:	83 f9 04             	cmp    $0x4,%ecx
+  803d04:	75 d8                	jne    803cde <inet_aton+0x166>
+  803d06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d0b:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803d11:	77 45                	ja     803d58 <inet_aton+0x1e0>
+  803d13:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803d16:	c1 e0 18             	shl    $0x18,%eax
+  803d19:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803d1c:	c1 e1 10             	shl    $0x10,%ecx
+  803d1f:	09 c8                	or     %ecx,%eax
+  803d21:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803d24:	c1 e1 08             	shl    $0x8,%ecx
+  803d27:	09 c8                	or     %ecx,%eax
+  803d29:	09 c6                	or     %eax,%esi
+  803d2b:	eb b1                	jmp    803cde <inet_aton+0x166>
+  803d2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d32:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803d38:	77 1e                	ja     803d58 <inet_aton+0x1e0>
+  803d3a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803d3d:	c1 e0 18             	shl    $0x18,%eax
+  803d40:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803d43:	c1 e1 10             	shl    $0x10,%ecx
+  803d46:	09 c8                	or     %ecx,%eax
+  803d48:	09 c6                	or     %eax,%esi
+  803d4a:	eb 92                	jmp    803cde <inet_aton+0x166>
+  803d4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d51:	eb 05                	jmp    803d58 <inet_aton+0x1e0>
+  803d53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d58:	89 c8                	mov    %ecx,%eax
+  803d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d5d:	5b                   	pop    %ebx
+  803d5e:	5e                   	pop    %esi
+  803d5f:	5f                   	pop    %edi
+  803d60:	5d                   	pop    %ebp
+  803d61:	c3                   	ret
+  803d62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d67:	eb ef                	jmp    803d58 <inet_aton+0x1e0>
+
+00803d69 <inet_addr>:
+  803d69:	55                   	push   %ebp
+  803d6a:	89 e5                	mov    %esp,%ebp
+  803d6c:	83 ec 20             	sub    $0x20,%esp
+  803d6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d72:	50                   	push   %eax
+  803d73:	ff 75 08             	push   0x8(%ebp)
+  803d76:	e8 fd fd ff ff       	call   803b78 <inet_aton>
+  803d7b:	89 c2                	mov    %eax,%edx
+  803d7d:	83 c4 10             	add    $0x10,%esp
+  803d80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803d85:	85 d2                	test   %edx,%edx
+  803d87:	75 02                	jne    803d8b <inet_addr+0x22>
+  803d89:	c9                   	leave
+  803d8a:	c3                   	ret
+  803d8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d8e:	eb f9                	jmp    803d89 <inet_addr+0x20>
+
+00803d90 <ntohl>:
+  803d90:	55                   	push   %ebp
+  803d91:	89 e5                	mov    %esp,%ebp
+  803d93:	83 ec 14             	sub    $0x14,%esp
+  803d96:	ff 75 08             	push   0x8(%ebp)
+  803d99:	e8 ae fd ff ff       	call   803b4c <htonl>
+  803d9e:	83 c4 10             	add    $0x10,%esp
+  803da1:	c9                   	leave
+  803da2:	c3                   	ret
+
+00803da3 <__udivmoddi4>:
+  803da3:	55                   	push   %ebp
+  803da4:	57                   	push   %edi
+  803da5:	56                   	push   %esi
+  803da6:	53                   	push   %ebx
+  803da7:	83 ec 24             	sub    $0x24,%esp
+  803daa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803dae:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803db2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803db6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803dba:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803dbe:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803dc2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803dc6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803dca:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803ddd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803de4:	00 
+  803de5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803dec:	00 
+  803ded:	89 fb                	mov    %edi,%ebx
+  803def:	eb 08                	jmp    803df9 <__udivmoddi4+0x56>
+  803df1:	83 e9 01             	sub    $0x1,%ecx
+  803df4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803df7:	74 68                	je     803e61 <__udivmoddi4+0xbe>
+  803df9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803dfd:	01 c0                	add    %eax,%eax
+  803dff:	89 c6                	mov    %eax,%esi
+  803e01:	89 d7                	mov    %edx,%edi
+  803e03:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803e07:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803e0b:	0f ad d0             	shrd   %cl,%edx,%eax
+  803e0e:	d3 ea                	shr    %cl,%edx
+  803e10:	f6 c1 20             	test   $0x20,%cl
+  803e13:	74 04                	je     803e19 <__udivmoddi4+0x76>
+  803e15:	89 d0                	mov    %edx,%eax
+  803e17:	31 d2                	xor    %edx,%edx
+  803e19:	83 e0 01             	and    $0x1,%eax
+  803e1c:	89 04 24             	mov    %eax,(%esp)
+  803e1f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803e26:	00 
+  803e27:	8b 04 24             	mov    (%esp),%eax
+  803e2a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803e2e:	09 f0                	or     %esi,%eax
+  803e30:	09 fa                	or     %edi,%edx
+  803e32:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803e36:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803e3a:	39 f0                	cmp    %esi,%eax
+  803e3c:	89 d5                	mov    %edx,%ebp
+  803e3e:	19 fd                	sbb    %edi,%ebp
+  803e40:	72 af                	jb     803df1 <__udivmoddi4+0x4e>
+  803e42:	29 f0                	sub    %esi,%eax
+  803e44:	19 fa                	sbb    %edi,%edx
+  803e46:	89 cf                	mov    %ecx,%edi
+  803e48:	c1 ef 05             	shr    $0x5,%edi
+  803e4b:	83 e7 01             	and    $0x1,%edi
+  803e4e:	89 fe                	mov    %edi,%esi
+  803e50:	83 f6 01             	xor    $0x1,%esi
+  803e53:	d3 e6                	shl    %cl,%esi
+  803e55:	d3 e7                	shl    %cl,%edi
+  803e57:	09 74 24 18          	or     %esi,0x18(%esp)
+  803e5b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803e5f:	eb 90                	jmp    803df1 <__udivmoddi4+0x4e>
+  803e61:	85 db                	test   %ebx,%ebx
+  803e63:	74 05                	je     803e6a <__udivmoddi4+0xc7>
+  803e65:	89 03                	mov    %eax,(%ebx)
+  803e67:	89 53 04             	mov    %edx,0x4(%ebx)
+  803e6a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e6e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e72:	83 c4 24             	add    $0x24,%esp
+  803e75:	5b                   	pop    %ebx
+  803e76:	5e                   	pop    %esi
+  803e77:	5f                   	pop    %edi
+  803e78:	5d                   	pop    %ebp
+  803e79:	c3                   	ret
+
+00803e7a <__udivdi3>:
+  803e7a:	83 ec 08             	sub    $0x8,%esp
+  803e7d:	6a 00                	push   $0x0
+  803e7f:	ff 74 24 1c          	push   0x1c(%esp)
+  803e83:	ff 74 24 1c          	push   0x1c(%esp)
+  803e87:	ff 74 24 1c          	push   0x1c(%esp)
+  803e8b:	ff 74 24 1c          	push   0x1c(%esp)
+  803e8f:	e8 0f ff ff ff       	call   803da3 <__udivmoddi4>
+  803e94:	83 c4 1c             	add    $0x1c,%esp
+  803e97:	c3                   	ret
+
+00803e98 <__umoddi3>:
+  803e98:	83 ec 18             	sub    $0x18,%esp
+  803e9b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803e9f:	50                   	push   %eax
+  803ea0:	ff 74 24 2c          	push   0x2c(%esp)
+  803ea4:	ff 74 24 2c          	push   0x2c(%esp)
+  803ea8:	ff 74 24 2c          	push   0x2c(%esp)
+  803eac:	ff 74 24 2c          	push   0x2c(%esp)
+  803eb0:	e8 ee fe ff ff       	call   803da3 <__udivmoddi4>
+  803eb5:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803eb9:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803ebd:	83 c4 2c             	add    $0x2c,%esp
+  803ec0:	c3                   	ret
+
+00803ec1 <__divdi3>:
+  803ec1:	53                   	push   %ebx
+  803ec2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ec6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803eca:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ece:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803ed2:	85 d2                	test   %edx,%edx
+  803ed4:	78 12                	js     803ee8 <__divdi3+0x27>
+  803ed6:	85 db                	test   %ebx,%ebx
+  803ed8:	78 2e                	js     803f08 <__divdi3+0x47>
+  803eda:	53                   	push   %ebx
+  803edb:	51                   	push   %ecx
+  803edc:	52                   	push   %edx
+  803edd:	50                   	push   %eax
+  803ede:	e8 97 ff ff ff       	call   803e7a <__udivdi3>
+  803ee3:	83 c4 10             	add    $0x10,%esp
+  803ee6:	eb 1e                	jmp    803f06 <__divdi3+0x45>
+  803ee8:	f7 d8                	neg    %eax
+  803eea:	83 d2 00             	adc    $0x0,%edx
+  803eed:	f7 da                	neg    %edx
+  803eef:	85 db                	test   %ebx,%ebx
+  803ef1:	78 2a                	js     803f1d <__divdi3+0x5c>
+  803ef3:	53                   	push   %ebx
+  803ef4:	51                   	push   %ecx
+  803ef5:	52                   	push   %edx
+  803ef6:	50                   	push   %eax
+  803ef7:	e8 7e ff ff ff       	call   803e7a <__udivdi3>
+  803efc:	83 c4 10             	add    $0x10,%esp
+  803eff:	f7 d8                	neg    %eax
+  803f01:	83 d2 00             	adc    $0x0,%edx
+  803f04:	f7 da                	neg    %edx
+  803f06:	5b                   	pop    %ebx
+  803f07:	c3                   	ret
+  803f08:	f7 d9                	neg    %ecx
+  803f0a:	83 d3 00             	adc    $0x0,%ebx
+  803f0d:	f7 db                	neg    %ebx
+  803f0f:	53                   	push   %ebx
+  803f10:	51                   	push   %ecx
+  803f11:	52                   	push   %edx
+  803f12:	50                   	push   %eax
+  803f13:	e8 62 ff ff ff       	call   803e7a <__udivdi3>
+  803f18:	83 c4 10             	add    $0x10,%esp
+  803f1b:	eb e2                	jmp    803eff <__divdi3+0x3e>
+  803f1d:	f7 d9                	neg    %ecx
+  803f1f:	83 d3 00             	adc    $0x0,%ebx
+  803f22:	f7 db                	neg    %ebx
+  803f24:	53                   	push   %ebx
+  803f25:	51                   	push   %ecx
+  803f26:	52                   	push   %edx
+  803f27:	50                   	push   %eax
+  803f28:	e8 4d ff ff ff       	call   803e7a <__udivdi3>
+  803f2d:	83 c4 10             	add    $0x10,%esp
+  803f30:	eb d4                	jmp    803f06 <__divdi3+0x45>
+
+00803f32 <__moddi3>:
+  803f32:	55                   	push   %ebp
+  803f33:	57                   	push   %edi
+  803f34:	56                   	push   %esi
+  803f35:	53                   	push   %ebx
+  803f36:	83 ec 0c             	sub    $0xc,%esp
+  803f39:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803f3d:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803f41:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803f45:	89 e9                	mov    %ebp,%ecx
+  803f47:	f7 d9                	neg    %ecx
+  803f49:	89 d0                	mov    %edx,%eax
+  803f4b:	83 d0 00             	adc    $0x0,%eax
+  803f4e:	f7 d8                	neg    %eax
+  803f50:	0f 49 e9             	cmovns %ecx,%ebp
+  803f53:	0f 49 d0             	cmovns %eax,%edx
+  803f56:	52                   	push   %edx
+  803f57:	55                   	push   %ebp
+  803f58:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803f5c:	f7 da                	neg    %edx
+  803f5e:	89 d8                	mov    %ebx,%eax
+  803f60:	83 d0 00             	adc    $0x0,%eax
+  803f63:	f7 d8                	neg    %eax
+  803f65:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803f6a:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803f6e:	0f 48 c3             	cmovs  %ebx,%eax
+  803f71:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803f75:	ff 74 24 0c          	push   0xc(%esp)
+  803f79:	ff 74 24 0c          	push   0xc(%esp)
+  803f7d:	e8 16 ff ff ff       	call   803e98 <__umoddi3>
+  803f82:	83 c4 10             	add    $0x10,%esp
+  803f85:	85 db                	test   %ebx,%ebx
+  803f87:	78 08                	js     803f91 <__moddi3+0x5f>
+  803f89:	83 c4 0c             	add    $0xc,%esp
+  803f8c:	5b                   	pop    %ebx
+  803f8d:	5e                   	pop    %esi
+  803f8e:	5f                   	pop    %edi
+  803f8f:	5d                   	pop    %ebp
+  803f90:	c3                   	ret
+  803f91:	f7 d8                	neg    %eax
+  803f93:	83 d2 00             	adc    $0x0,%edx
+  803f96:	f7 da                	neg    %edx
+  803f98:	eb ef                	jmp    803f89 <__moddi3+0x57>
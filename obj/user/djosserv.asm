@@ -0,0 +1,6190 @@
+
+obj/user/djosserv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 3c 09 00 00       	call   80096d <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	50                   	push   %eax
+  80003a:	68 60 3e 80 00       	push   $0x803e60
+  80003f:	e8 7d 0a 00 00       	call   800ac1 <cprintf>
+  800044:	e8 6d 09 00 00       	call   8009b6 <exit>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <pg_handler>:
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	53                   	push   %ebx
+  800052:	83 ec 08             	sub    $0x8,%esp
+  800055:	8b 45 08             	mov    0x8(%ebp),%eax
+  800058:	8b 18                	mov    (%eax),%ebx
+  80005a:	6a 07                	push   $0x7
+  80005c:	89 d8                	mov    %ebx,%eax
+  80005e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800063:	50                   	push   %eax
+  800064:	6a 00                	push   $0x0
+  800066:	e8 ad 15 00 00       	call   801618 <sys_page_alloc>
+  80006b:	83 c4 10             	add    $0x10,%esp
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	78 05                	js     800077 <pg_handler+0x29>
+  800072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800075:	c9                   	leave
+  800076:	c3                   	ret
+  800077:	83 ec 0c             	sub    $0xc,%esp
+  80007a:	50                   	push   %eax
+  80007b:	53                   	push   %ebx
+  80007c:	68 e0 3f 80 00       	push   $0x803fe0
+  800081:	68 e2 01 00 00       	push   $0x1e2
+  800086:	68 64 3e 80 00       	push   $0x803e64
+  80008b:	e8 56 09 00 00       	call   8009e6 <_panic>
+
+00800090 <find_lease>:
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800096:	ba 20 60 80 00       	mov    $0x806020,%edx
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	39 0a                	cmp    %ecx,(%edx)
+  8000a2:	74 10                	je     8000b4 <find_lease+0x24>
+  8000a4:	83 c0 01             	add    $0x1,%eax
+  8000a7:	83 c2 14             	add    $0x14,%edx
+  8000aa:	83 f8 05             	cmp    $0x5,%eax
+  8000ad:	75 f1                	jne    8000a0 <find_lease+0x10>
+  8000af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8000b4:	5d                   	pop    %ebp
+  8000b5:	c3                   	ret
+
+008000b6 <destroy_lease_id>:
+  8000b6:	55                   	push   %ebp
+  8000b7:	89 e5                	mov    %esp,%ebp
+  8000b9:	57                   	push   %edi
+  8000ba:	56                   	push   %esi
+  8000bb:	53                   	push   %ebx
+  8000bc:	83 ec 0c             	sub    $0xc,%esp
+  8000bf:	83 7d 08 ff          	cmpl   $0xffffffff,0x8(%ebp)
+  8000c3:	74 55                	je     80011a <destroy_lease_id+0x64>
+  8000c5:	83 ec 0c             	sub    $0xc,%esp
+  8000c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000cb:	8d 1c 85 00 00 00 00 	lea    0x0(,%eax,4),%ebx
+  8000d2:	89 df                	mov    %ebx,%edi
+  8000d4:	01 c7                	add    %eax,%edi
+  8000d6:	c1 e7 02             	shl    $0x2,%edi
+  8000d9:	ff b7 24 60 80 00    	push   0x806024(%edi)
+  8000df:	e8 89 14 00 00       	call   80156d <sys_env_destroy>
+  8000e4:	c7 87 20 60 80 00 00 	movl   $0x0,0x806020(%edi)
+  8000eb:	00 00 00 
+  8000ee:	c7 87 24 60 80 00 00 	movl   $0x0,0x806024(%edi)
+  8000f5:	00 00 00 
+  8000f8:	c6 87 28 60 80 00 00 	movb   $0x0,0x806028(%edi)
+  8000ff:	c7 87 2c 60 80 00 00 	movl   $0x0,0x80602c(%edi)
+  800106:	00 00 00 
+  800109:	03 5d 08             	add    0x8(%ebp),%ebx
+  80010c:	c7 04 9d 30 60 80 00 	movl   $0x0,0x806030(,%ebx,4)
+  800113:	00 00 00 00 
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011d:	5b                   	pop    %ebx
+  80011e:	5e                   	pop    %esi
+  80011f:	5f                   	pop    %edi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+
+00800122 <destroy_lease>:
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	83 ec 14             	sub    $0x14,%esp
+  800128:	ff 75 08             	push   0x8(%ebp)
+  80012b:	e8 60 ff ff ff       	call   800090 <find_lease>
+  800130:	89 04 24             	mov    %eax,(%esp)
+  800133:	e8 7e ff ff ff       	call   8000b6 <destroy_lease_id>
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	c9                   	leave
+  80013c:	c3                   	ret
+
+0080013d <gc_lease_map>:
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	57                   	push   %edi
+  800141:	56                   	push   %esi
+  800142:	53                   	push   %ebx
+  800143:	83 ec 18             	sub    $0x18,%esp
+  800146:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800149:	68 74 3e 80 00       	push   $0x803e74
+  80014e:	e8 6e 09 00 00       	call   800ac1 <cprintf>
+  800153:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	be 00 00 00 00       	mov    $0x0,%esi
+  800160:	eb 0b                	jmp    80016d <gc_lease_map+0x30>
+  800162:	83 c6 01             	add    $0x1,%esi
+  800165:	83 c3 14             	add    $0x14,%ebx
+  800168:	83 fe 05             	cmp    $0x5,%esi
+  80016b:	74 35                	je     8001a2 <gc_lease_map+0x65>
+  80016d:	8b 03                	mov    (%ebx),%eax
+  80016f:	85 c0                	test   %eax,%eax
+  800171:	74 ef                	je     800162 <gc_lease_map+0x25>
+  800173:	89 fa                	mov    %edi,%edx
+  800175:	2b 53 0c             	sub    0xc(%ebx),%edx
+  800178:	81 fa e0 93 04 00    	cmp    $0x493e0,%edx
+  80017e:	7e e2                	jle    800162 <gc_lease_map+0x25>
+  800180:	80 7b 08 01          	cmpb   $0x1,0x8(%ebx)
+  800184:	75 dc                	jne    800162 <gc_lease_map+0x25>
+  800186:	83 ec 04             	sub    $0x4,%esp
+  800189:	50                   	push   %eax
+  80018a:	56                   	push   %esi
+  80018b:	68 92 3e 80 00       	push   $0x803e92
+  800190:	e8 2c 09 00 00       	call   800ac1 <cprintf>
+  800195:	89 34 24             	mov    %esi,(%esp)
+  800198:	e8 19 ff ff ff       	call   8000b6 <destroy_lease_id>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb c0                	jmp    800162 <gc_lease_map+0x25>
+  8001a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a5:	5b                   	pop    %ebx
+  8001a6:	5e                   	pop    %esi
+  8001a7:	5f                   	pop    %edi
+  8001a8:	5d                   	pop    %ebp
+  8001a9:	c3                   	ret
+
+008001aa <check_lease_complete>:
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	56                   	push   %esi
+  8001ae:	53                   	push   %ebx
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	68 0c 40 80 00       	push   $0x80400c
+  8001b7:	e8 05 09 00 00       	call   800ac1 <cprintf>
+  8001bc:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  8001c1:	83 c4 10             	add    $0x10,%esp
+  8001c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c9:	eb 25                	jmp    8001f0 <check_lease_complete+0x46>
+  8001cb:	83 ec 04             	sub    $0x4,%esp
+  8001ce:	50                   	push   %eax
+  8001cf:	56                   	push   %esi
+  8001d0:	68 b0 3e 80 00       	push   $0x803eb0
+  8001d5:	e8 e7 08 00 00       	call   800ac1 <cprintf>
+  8001da:	89 34 24             	mov    %esi,(%esp)
+  8001dd:	e8 d4 fe ff ff       	call   8000b6 <destroy_lease_id>
+  8001e2:	83 c4 10             	add    $0x10,%esp
+  8001e5:	83 c6 01             	add    $0x1,%esi
+  8001e8:	83 c3 14             	add    $0x14,%ebx
+  8001eb:	83 fe 05             	cmp    $0x5,%esi
+  8001ee:	74 41                	je     800231 <check_lease_complete+0x87>
+  8001f0:	8b 03                	mov    (%ebx),%eax
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	74 ef                	je     8001e5 <check_lease_complete+0x3b>
+  8001f6:	80 7b 08 02          	cmpb   $0x2,0x8(%ebx)
+  8001fa:	75 e9                	jne    8001e5 <check_lease_complete+0x3b>
+  8001fc:	8b 53 04             	mov    0x4(%ebx),%edx
+  8001ff:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800205:	69 ca ac 01 00 00    	imul   $0x1ac,%edx,%ecx
+  80020b:	81 c1 00 00 c0 ee    	add    $0xeec00000,%ecx
+  800211:	8b 89 d4 00 00 00    	mov    0xd4(%ecx),%ecx
+  800217:	83 f9 01             	cmp    $0x1,%ecx
+  80021a:	75 af                	jne    8001cb <check_lease_complete+0x21>
+  80021c:	69 d2 ac 01 00 00    	imul   $0x1ac,%edx,%edx
+  800222:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800228:	8b 52 54             	mov    0x54(%edx),%edx
+  80022b:	85 d2                	test   %edx,%edx
+  80022d:	75 b6                	jne    8001e5 <check_lease_complete+0x3b>
+  80022f:	eb 9a                	jmp    8001cb <check_lease_complete+0x21>
+  800231:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800234:	5b                   	pop    %ebx
+  800235:	5e                   	pop    %esi
+  800236:	5d                   	pop    %ebp
+  800237:	c3                   	ret
+
+00800238 <process_start_lease>:
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	57                   	push   %edi
+  80023c:	56                   	push   %esi
+  80023d:	53                   	push   %ebx
+  80023e:	81 ec cc 01 00 00    	sub    $0x1cc,%esp
+  800244:	b8 20 60 80 00       	mov    $0x806020,%eax
+  800249:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80024e:	80 78 08 00          	cmpb   $0x0,0x8(%eax)
+  800252:	74 1a                	je     80026e <process_start_lease+0x36>
+  800254:	83 c3 01             	add    $0x1,%ebx
+  800257:	83 c0 14             	add    $0x14,%eax
+  80025a:	83 fb 05             	cmp    $0x5,%ebx
+  80025d:	75 ef                	jne    80024e <process_start_lease+0x16>
+  80025f:	c7 85 34 fe ff ff 37 	movl   $0xffffff37,-0x1cc(%ebp)
+  800266:	ff ff ff 
+  800269:	e9 11 01 00 00       	jmp    80037f <process_start_lease+0x147>
+  80026e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  800271:	83 3c 85 24 60 80 00 	cmpl   $0x0,0x806024(,%eax,4)
+  800278:	00 
+  800279:	75 0a                	jne    800285 <process_start_lease+0x4d>
+  80027b:	83 3c 85 20 60 80 00 	cmpl   $0x0,0x806020(,%eax,4)
+  800282:	00 
+  800283:	74 0a                	je     80028f <process_start_lease+0x57>
+  800285:	b8 ce 3e 80 00       	mov    $0x803ece,%eax
+  80028a:	e8 a4 fd ff ff       	call   800033 <die>
+  80028f:	83 fb ff             	cmp    $0xffffffff,%ebx
+  800292:	0f 84 f5 00 00 00    	je     80038d <process_start_lease+0x155>
+  800298:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029b:	8b 00                	mov    (%eax),%eax
+  80029d:	89 85 34 fe ff ff    	mov    %eax,-0x1cc(%ebp)
+  8002a3:	8d bd 3c fe ff ff    	lea    -0x1c4(%ebp),%edi
+  8002a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ac:	8d 70 04             	lea    0x4(%eax),%esi
+  8002af:	b9 6b 00 00 00       	mov    $0x6b,%ecx
+  8002b4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8002b6:	8b 90 b0 01 00 00    	mov    0x1b0(%eax),%edx
+  8002bc:	89 95 30 fe ff ff    	mov    %edx,-0x1d0(%ebp)
+  8002c2:	83 ec 0c             	sub    $0xc,%esp
+  8002c5:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+  8002cb:	ff b5 90 fe ff ff    	push   -0x170(%ebp)
+  8002d1:	ff b5 88 fe ff ff    	push   -0x178(%ebp)
+  8002d7:	ff b5 84 fe ff ff    	push   -0x17c(%ebp)
+  8002dd:	68 30 40 80 00       	push   $0x804030
+  8002e2:	e8 da 07 00 00       	call   800ac1 <cprintf>
+  8002e7:	83 c4 20             	add    $0x20,%esp
+  8002ea:	83 bd 90 fe ff ff 06 	cmpl   $0x6,-0x170(%ebp)
+  8002f1:	0f 85 a2 00 00 00    	jne    800399 <process_start_lease+0x161>
+  8002f7:	8b 85 34 fe ff ff    	mov    -0x1cc(%ebp),%eax
+  8002fd:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+  800303:	83 ec 08             	sub    $0x8,%esp
+  800306:	8d 85 38 fe ff ff    	lea    -0x1c8(%ebp),%eax
+  80030c:	50                   	push   %eax
+  80030d:	8d 85 3c fe ff ff    	lea    -0x1c4(%ebp),%eax
+  800313:	50                   	push   %eax
+  800314:	e8 58 18 00 00       	call   801b71 <sys_env_lease>
+  800319:	89 85 34 fe ff ff    	mov    %eax,-0x1cc(%ebp)
+  80031f:	83 c4 10             	add    $0x10,%esp
+  800322:	85 c0                	test   %eax,%eax
+  800324:	75 7f                	jne    8003a5 <process_start_lease+0x16d>
+  800326:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80032d:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  800330:	c1 e0 02             	shl    $0x2,%eax
+  800333:	8d b0 20 60 80 00    	lea    0x806020(%eax),%esi
+  800339:	8b 95 84 fe ff ff    	mov    -0x17c(%ebp),%edx
+  80033f:	89 90 20 60 80 00    	mov    %edx,0x806020(%eax)
+  800345:	8b 85 38 fe ff ff    	mov    -0x1c8(%ebp),%eax
+  80034b:	89 46 04             	mov    %eax,0x4(%esi)
+  80034e:	c6 46 08 01          	movb   $0x1,0x8(%esi)
+  800352:	e8 8b 16 00 00       	call   8019e2 <sys_time_msec>
+  800357:	89 46 0c             	mov    %eax,0xc(%esi)
+  80035a:	8b 95 30 fe ff ff    	mov    -0x1d0(%ebp),%edx
+  800360:	89 56 10             	mov    %edx,0x10(%esi)
+  800363:	83 ec 04             	sub    $0x4,%esp
+  800366:	ff 76 04             	push   0x4(%esi)
+  800369:	01 df                	add    %ebx,%edi
+  80036b:	ff 34 bd 20 60 80 00 	push   0x806020(,%edi,4)
+  800372:	68 88 40 80 00       	push   $0x804088
+  800377:	e8 45 07 00 00       	call   800ac1 <cprintf>
+  80037c:	83 c4 10             	add    $0x10,%esp
+  80037f:	8b 85 34 fe ff ff    	mov    -0x1cc(%ebp),%eax
+  800385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800388:	5b                   	pop    %ebx
+  800389:	5e                   	pop    %esi
+  80038a:	5f                   	pop    %edi
+  80038b:	5d                   	pop    %ebp
+  80038c:	c3                   	ret
+  80038d:	c7 85 34 fe ff ff 37 	movl   $0xffffff37,-0x1cc(%ebp)
+  800394:	ff ff ff 
+  800397:	eb e6                	jmp    80037f <process_start_lease+0x147>
+  800399:	c7 85 34 fe ff ff 38 	movl   $0xffffff38,-0x1cc(%ebp)
+  8003a0:	ff ff ff 
+  8003a3:	eb da                	jmp    80037f <process_start_lease+0x147>
+  8003a5:	c7 85 34 fe ff ff 37 	movl   $0xffffff37,-0x1cc(%ebp)
+  8003ac:	ff ff ff 
+  8003af:	eb ce                	jmp    80037f <process_start_lease+0x147>
+
+008003b1 <process_page_req>:
+  8003b1:	55                   	push   %ebp
+  8003b2:	89 e5                	mov    %esp,%ebp
+  8003b4:	57                   	push   %edi
+  8003b5:	56                   	push   %esi
+  8003b6:	53                   	push   %ebx
+  8003b7:	83 ec 28             	sub    $0x28,%esp
+  8003ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003bd:	8b 06                	mov    (%esi),%eax
+  8003bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c2:	50                   	push   %eax
+  8003c3:	e8 c8 fc ff ff       	call   800090 <find_lease>
+  8003c8:	83 c4 10             	add    $0x10,%esp
+  8003cb:	85 c0                	test   %eax,%eax
+  8003cd:	0f 88 ab 00 00 00    	js     80047e <process_page_req+0xcd>
+  8003d3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003d6:	8b 04 85 24 60 80 00 	mov    0x806024(,%eax,4),%eax
+  8003dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e0:	8b 7e 04             	mov    0x4(%esi),%edi
+  8003e3:	8b 46 08             	mov    0x8(%esi),%eax
+  8003e6:	89 c2                	mov    %eax,%edx
+  8003e8:	80 e6 f7             	and    $0xf7,%dh
+  8003eb:	83 ca 02             	or     $0x2,%edx
+  8003ee:	f6 c4 08             	test   $0x8,%ah
+  8003f1:	0f 45 c2             	cmovne %edx,%eax
+  8003f4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8003f7:	0f be 5e 0c          	movsbl 0xc(%esi),%ebx
+  8003fb:	83 c6 0d             	add    $0xd,%esi
+  8003fe:	83 ec 0c             	sub    $0xc,%esp
+  800401:	53                   	push   %ebx
+  800402:	50                   	push   %eax
+  800403:	57                   	push   %edi
+  800404:	ff 75 e4             	push   -0x1c(%ebp)
+  800407:	68 b0 40 80 00       	push   $0x8040b0
+  80040c:	e8 b0 06 00 00       	call   800ac1 <cprintf>
+  800411:	83 c4 20             	add    $0x20,%esp
+  800414:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800417:	85 c9                	test   %ecx,%ecx
+  800419:	74 6a                	je     800485 <process_page_req+0xd4>
+  80041b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  800421:	75 69                	jne    80048c <process_page_req+0xdb>
+  800423:	83 fb 03             	cmp    $0x3,%ebx
+  800426:	7f 64                	jg     80048c <process_page_req+0xdb>
+  800428:	85 db                	test   %ebx,%ebx
+  80042a:	75 14                	jne    800440 <process_page_req+0x8f>
+  80042c:	83 ec 04             	sub    $0x4,%esp
+  80042f:	ff 75 dc             	push   -0x24(%ebp)
+  800432:	57                   	push   %edi
+  800433:	51                   	push   %ecx
+  800434:	e8 df 11 00 00       	call   801618 <sys_page_alloc>
+  800439:	83 c4 10             	add    $0x10,%esp
+  80043c:	85 c0                	test   %eax,%eax
+  80043e:	78 27                	js     800467 <process_page_req+0xb6>
+  800440:	83 ec 0c             	sub    $0xc,%esp
+  800443:	6a 01                	push   $0x1
+  800445:	ff 75 dc             	push   -0x24(%ebp)
+  800448:	56                   	push   %esi
+  800449:	c1 e3 0a             	shl    $0xa,%ebx
+  80044c:	01 fb                	add    %edi,%ebx
+  80044e:	53                   	push   %ebx
+  80044f:	ff 75 e0             	push   -0x20(%ebp)
+  800452:	e8 5c 17 00 00       	call   801bb3 <sys_copy_mem>
+  800457:	83 c4 20             	add    $0x20,%esp
+  80045a:	c1 f8 1f             	sar    $0x1f,%eax
+  80045d:	24 36                	and    $0x36,%al
+  80045f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800462:	5b                   	pop    %ebx
+  800463:	5e                   	pop    %esi
+  800464:	5f                   	pop    %edi
+  800465:	5d                   	pop    %ebp
+  800466:	c3                   	ret
+  800467:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80046a:	74 27                	je     800493 <process_page_req+0xe2>
+  80046c:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80046f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  800474:	ba 36 ff ff ff       	mov    $0xffffff36,%edx
+  800479:	0f 44 c2             	cmove  %edx,%eax
+  80047c:	eb e1                	jmp    80045f <process_page_req+0xae>
+  80047e:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  800483:	eb da                	jmp    80045f <process_page_req+0xae>
+  800485:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  80048a:	eb d3                	jmp    80045f <process_page_req+0xae>
+  80048c:	b8 38 ff ff ff       	mov    $0xffffff38,%eax
+  800491:	eb cc                	jmp    80045f <process_page_req+0xae>
+  800493:	b8 38 ff ff ff       	mov    $0xffffff38,%eax
+  800498:	eb c5                	jmp    80045f <process_page_req+0xae>
+
+0080049a <process_done_lease>:
+  80049a:	55                   	push   %ebp
+  80049b:	89 e5                	mov    %esp,%ebp
+  80049d:	56                   	push   %esi
+  80049e:	53                   	push   %ebx
+  80049f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004a2:	8b 18                	mov    (%eax),%ebx
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	68 f4 40 80 00       	push   $0x8040f4
+  8004ad:	e8 0f 06 00 00       	call   800ac1 <cprintf>
+  8004b2:	89 1c 24             	mov    %ebx,(%esp)
+  8004b5:	e8 d6 fb ff ff       	call   800090 <find_lease>
+  8004ba:	83 c4 10             	add    $0x10,%esp
+  8004bd:	85 c0                	test   %eax,%eax
+  8004bf:	78 53                	js     800514 <process_done_lease+0x7a>
+  8004c1:	89 c3                	mov    %eax,%ebx
+  8004c3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004c6:	8b 04 85 24 60 80 00 	mov    0x806024(,%eax,4),%eax
+  8004cd:	85 c0                	test   %eax,%eax
+  8004cf:	74 4a                	je     80051b <process_done_lease+0x81>
+  8004d1:	8d 34 9d 00 00 00 00 	lea    0x0(,%ebx,4),%esi
+  8004d8:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+  8004db:	8d 14 95 20 60 80 00 	lea    0x806020(,%edx,4),%edx
+  8004e2:	c6 42 08 02          	movb   $0x2,0x8(%edx)
+  8004e6:	83 ec 08             	sub    $0x8,%esp
+  8004e9:	ff 72 10             	push   0x10(%edx)
+  8004ec:	50                   	push   %eax
+  8004ed:	e8 28 18 00 00       	call   801d1a <sys_env_set_thisenv>
+  8004f2:	83 c4 08             	add    $0x8,%esp
+  8004f5:	6a 02                	push   $0x2
+  8004f7:	01 de                	add    %ebx,%esi
+  8004f9:	ff 34 b5 24 60 80 00 	push   0x806024(,%esi,4)
+  800500:	e8 46 12 00 00       	call   80174b <sys_env_set_status>
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	c1 f8 1f             	sar    $0x1f,%eax
+  80050b:	24 36                	and    $0x36,%al
+  80050d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800510:	5b                   	pop    %ebx
+  800511:	5e                   	pop    %esi
+  800512:	5d                   	pop    %ebp
+  800513:	c3                   	ret
+  800514:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  800519:	eb f2                	jmp    80050d <process_done_lease+0x73>
+  80051b:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  800520:	eb eb                	jmp    80050d <process_done_lease+0x73>
+
+00800522 <process_abort_lease>:
+  800522:	55                   	push   %ebp
+  800523:	89 e5                	mov    %esp,%ebp
+  800525:	53                   	push   %ebx
+  800526:	83 ec 0c             	sub    $0xc,%esp
+  800529:	8b 45 08             	mov    0x8(%ebp),%eax
+  80052c:	8b 18                	mov    (%eax),%ebx
+  80052e:	53                   	push   %ebx
+  80052f:	68 1c 41 80 00       	push   $0x80411c
+  800534:	e8 88 05 00 00       	call   800ac1 <cprintf>
+  800539:	89 1c 24             	mov    %ebx,(%esp)
+  80053c:	e8 e1 fb ff ff       	call   800122 <destroy_lease>
+  800541:	89 1c 24             	mov    %ebx,(%esp)
+  800544:	e8 47 fb ff ff       	call   800090 <find_lease>
+  800549:	83 c4 10             	add    $0x10,%esp
+  80054c:	85 c0                	test   %eax,%eax
+  80054e:	79 0a                	jns    80055a <process_abort_lease+0x38>
+  800550:	b8 00 00 00 00       	mov    $0x0,%eax
+  800555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800558:	c9                   	leave
+  800559:	c3                   	ret
+  80055a:	83 ec 0c             	sub    $0xc,%esp
+  80055d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800560:	ff 34 85 24 60 80 00 	push   0x806024(,%eax,4)
+  800567:	e8 01 10 00 00       	call   80156d <sys_env_destroy>
+  80056c:	83 c4 10             	add    $0x10,%esp
+  80056f:	eb df                	jmp    800550 <process_abort_lease+0x2e>
+
+00800571 <process_ipc_start>:
+  800571:	55                   	push   %ebp
+  800572:	89 e5                	mov    %esp,%ebp
+  800574:	57                   	push   %edi
+  800575:	56                   	push   %esi
+  800576:	53                   	push   %ebx
+  800577:	83 ec 1c             	sub    $0x1c,%esp
+  80057a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80057d:	8b 08                	mov    (%eax),%ecx
+  80057f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800582:	8b 50 04             	mov    0x4(%eax),%edx
+  800585:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800588:	8b 78 08             	mov    0x8(%eax),%edi
+  80058b:	8b 58 0c             	mov    0xc(%eax),%ebx
+  80058e:	8b 50 10             	mov    0x10(%eax),%edx
+  800591:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  800594:	8b 70 14             	mov    0x14(%eax),%esi
+  800597:	85 f6                	test   %esi,%esi
+  800599:	75 6a                	jne    800605 <process_ipc_start+0x94>
+  80059b:	83 ec 0c             	sub    $0xc,%esp
+  80059e:	51                   	push   %ecx
+  80059f:	e8 ec fa ff ff       	call   800090 <find_lease>
+  8005a4:	83 c4 10             	add    $0x10,%esp
+  8005a7:	85 c0                	test   %eax,%eax
+  8005a9:	78 5f                	js     80060a <process_ipc_start+0x99>
+  8005ab:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005ae:	8b 04 85 24 60 80 00 	mov    0x806024(,%eax,4),%eax
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  8005b8:	56                   	push   %esi
+  8005b9:	57                   	push   %edi
+  8005ba:	89 c6                	mov    %eax,%esi
+  8005bc:	50                   	push   %eax
+  8005bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8005c0:	ff 75 dc             	push   -0x24(%ebp)
+  8005c3:	68 44 41 80 00       	push   $0x804144
+  8005c8:	e8 f4 04 00 00       	call   800ac1 <cprintf>
+  8005cd:	83 c4 20             	add    $0x20,%esp
+  8005d0:	85 db                	test   %ebx,%ebx
+  8005d2:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8005d7:	0f 44 d8             	cmove  %eax,%ebx
+  8005da:	ff 75 e0             	push   -0x20(%ebp)
+  8005dd:	53                   	push   %ebx
+  8005de:	57                   	push   %edi
+  8005df:	56                   	push   %esi
+  8005e0:	e8 8e 12 00 00       	call   801873 <sys_ipc_try_send>
+  8005e5:	83 c4 10             	add    $0x10,%esp
+  8005e8:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8005eb:	74 24                	je     800611 <process_ipc_start+0xa0>
+  8005ed:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8005f0:	74 26                	je     800618 <process_ipc_start+0xa7>
+  8005f2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8005f5:	ba 35 ff ff ff       	mov    $0xffffff35,%edx
+  8005fa:	0f 44 c2             	cmove  %edx,%eax
+  8005fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800600:	5b                   	pop    %ebx
+  800601:	5e                   	pop    %esi
+  800602:	5f                   	pop    %edi
+  800603:	5d                   	pop    %ebp
+  800604:	c3                   	ret
+  800605:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800608:	eb ab                	jmp    8005b5 <process_ipc_start+0x44>
+  80060a:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  80060f:	eb ec                	jmp    8005fd <process_ipc_start+0x8c>
+  800611:	b8 38 ff ff ff       	mov    $0xffffff38,%eax
+  800616:	eb e5                	jmp    8005fd <process_ipc_start+0x8c>
+  800618:	b8 36 ff ff ff       	mov    $0xffffff36,%eax
+  80061d:	eb de                	jmp    8005fd <process_ipc_start+0x8c>
+
+0080061f <process_completed_lease>:
+  80061f:	55                   	push   %ebp
+  800620:	89 e5                	mov    %esp,%ebp
+  800622:	53                   	push   %ebx
+  800623:	83 ec 0c             	sub    $0xc,%esp
+  800626:	8b 45 08             	mov    0x8(%ebp),%eax
+  800629:	8b 18                	mov    (%eax),%ebx
+  80062b:	53                   	push   %ebx
+  80062c:	68 9c 41 80 00       	push   $0x80419c
+  800631:	e8 8b 04 00 00       	call   800ac1 <cprintf>
+  800636:	83 c4 08             	add    $0x8,%esp
+  800639:	53                   	push   %ebx
+  80063a:	68 e9 3e 80 00       	push   $0x803ee9
+  80063f:	e8 7d 04 00 00       	call   800ac1 <cprintf>
+  800644:	89 d8                	mov    %ebx,%eax
+  800646:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80064b:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800651:	83 c4 10             	add    $0x10,%esp
+  800654:	8b 90 54 00 c0 ee    	mov    -0x113fffac(%eax),%edx
+  80065a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065f:	83 fa 05             	cmp    $0x5,%edx
+  800662:	74 05                	je     800669 <process_completed_lease+0x4a>
+  800664:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800667:	c9                   	leave
+  800668:	c3                   	ret
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	53                   	push   %ebx
+  80066d:	e8 fb 0e 00 00       	call   80156d <sys_env_destroy>
+  800672:	83 c4 10             	add    $0x10,%esp
+  800675:	c1 f8 1f             	sar    $0x1f,%eax
+  800678:	24 38                	and    $0x38,%al
+  80067a:	eb e8                	jmp    800664 <process_completed_lease+0x45>
+
+0080067c <process_request>:
+  80067c:	55                   	push   %ebp
+  80067d:	89 e5                	mov    %esp,%ebp
+  80067f:	56                   	push   %esi
+  800680:	53                   	push   %ebx
+  800681:	8b 45 08             	mov    0x8(%ebp),%eax
+  800684:	85 c0                	test   %eax,%eax
+  800686:	0f 84 82 00 00 00    	je     80070e <process_request+0x92>
+  80068c:	0f b6 18             	movzbl (%eax),%ebx
+  80068f:	8d 70 01             	lea    0x1(%eax),%esi
+  800692:	83 ec 08             	sub    $0x8,%esp
+  800695:	0f be c3             	movsbl %bl,%eax
+  800698:	50                   	push   %eax
+  800699:	68 02 3f 80 00       	push   $0x803f02
+  80069e:	e8 1e 04 00 00       	call   800ac1 <cprintf>
+  8006a3:	83 c4 10             	add    $0x10,%esp
+  8006a6:	80 fb 05             	cmp    $0x5,%bl
+  8006a9:	77 6a                	ja     800715 <process_request+0x99>
+  8006ab:	0f b6 db             	movzbl %bl,%ebx
+  8006ae:	ff 24 9d a8 42 80 00 	jmp    *0x8042a8(,%ebx,4)
+  8006b5:	83 ec 0c             	sub    $0xc,%esp
+  8006b8:	56                   	push   %esi
+  8006b9:	e8 f3 fc ff ff       	call   8003b1 <process_page_req>
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006c4:	5b                   	pop    %ebx
+  8006c5:	5e                   	pop    %esi
+  8006c6:	5d                   	pop    %ebp
+  8006c7:	c3                   	ret
+  8006c8:	83 ec 0c             	sub    $0xc,%esp
+  8006cb:	56                   	push   %esi
+  8006cc:	e8 67 fb ff ff       	call   800238 <process_start_lease>
+  8006d1:	83 c4 10             	add    $0x10,%esp
+  8006d4:	eb eb                	jmp    8006c1 <process_request+0x45>
+  8006d6:	83 ec 0c             	sub    $0xc,%esp
+  8006d9:	56                   	push   %esi
+  8006da:	e8 bb fd ff ff       	call   80049a <process_done_lease>
+  8006df:	83 c4 10             	add    $0x10,%esp
+  8006e2:	eb dd                	jmp    8006c1 <process_request+0x45>
+  8006e4:	83 ec 0c             	sub    $0xc,%esp
+  8006e7:	56                   	push   %esi
+  8006e8:	e8 35 fe ff ff       	call   800522 <process_abort_lease>
+  8006ed:	83 c4 10             	add    $0x10,%esp
+  8006f0:	eb cf                	jmp    8006c1 <process_request+0x45>
+  8006f2:	83 ec 0c             	sub    $0xc,%esp
+  8006f5:	56                   	push   %esi
+  8006f6:	e8 76 fe ff ff       	call   800571 <process_ipc_start>
+  8006fb:	83 c4 10             	add    $0x10,%esp
+  8006fe:	eb c1                	jmp    8006c1 <process_request+0x45>
+  800700:	83 ec 0c             	sub    $0xc,%esp
+  800703:	56                   	push   %esi
+  800704:	e8 16 ff ff ff       	call   80061f <process_completed_lease>
+  800709:	83 c4 10             	add    $0x10,%esp
+  80070c:	eb b3                	jmp    8006c1 <process_request+0x45>
+  80070e:	b8 38 ff ff ff       	mov    $0xffffff38,%eax
+  800713:	eb ac                	jmp    8006c1 <process_request+0x45>
+  800715:	b8 38 ff ff ff       	mov    $0xffffff38,%eax
+  80071a:	eb a5                	jmp    8006c1 <process_request+0x45>
+
+0080071c <issue_reply>:
+  80071c:	55                   	push   %ebp
+  80071d:	89 e5                	mov    %esp,%ebp
+  80071f:	56                   	push   %esi
+  800720:	53                   	push   %ebx
+  800721:	83 ec 14             	sub    $0x14,%esp
+  800724:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800727:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80072a:	53                   	push   %ebx
+  80072b:	56                   	push   %esi
+  80072c:	68 1f 3f 80 00       	push   $0x803f1f
+  800731:	e8 8b 03 00 00       	call   800ac1 <cprintf>
+  800736:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800739:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  80073c:	83 c4 0c             	add    $0xc,%esp
+  80073f:	6a 08                	push   $0x8
+  800741:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800744:	50                   	push   %eax
+  800745:	ff 75 08             	push   0x8(%ebp)
+  800748:	e8 90 1b 00 00       	call   8022dd <write>
+  80074d:	83 c4 10             	add    $0x10,%esp
+  800750:	83 f8 08             	cmp    $0x8,%eax
+  800753:	75 07                	jne    80075c <issue_reply+0x40>
+  800755:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800758:	5b                   	pop    %ebx
+  800759:	5e                   	pop    %esi
+  80075a:	5d                   	pop    %ebp
+  80075b:	c3                   	ret
+  80075c:	83 ec 0c             	sub    $0xc,%esp
+  80075f:	68 c8 41 80 00       	push   $0x8041c8
+  800764:	e8 58 03 00 00       	call   800ac1 <cprintf>
+  800769:	83 c4 10             	add    $0x10,%esp
+  80076c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800771:	eb e2                	jmp    800755 <issue_reply+0x39>
+
+00800773 <handle_client>:
+  800773:	55                   	push   %ebp
+  800774:	89 e5                	mov    %esp,%ebp
+  800776:	56                   	push   %esi
+  800777:	53                   	push   %ebx
+  800778:	81 ec f4 05 00 00    	sub    $0x5f4,%esp
+  80077e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800781:	68 ee 05 00 00       	push   $0x5ee
+  800786:	6a 00                	push   $0x0
+  800788:	8d b5 0a fa ff ff    	lea    -0x5f6(%ebp),%esi
+  80078e:	56                   	push   %esi
+  80078f:	e8 9f 0b 00 00       	call   801333 <memset>
+  800794:	83 c4 0c             	add    $0xc,%esp
+  800797:	68 ee 05 00 00       	push   $0x5ee
+  80079c:	56                   	push   %esi
+  80079d:	53                   	push   %ebx
+  80079e:	e8 5f 1a 00 00       	call   802202 <read>
+  8007a3:	83 c4 10             	add    $0x10,%esp
+  8007a6:	85 c0                	test   %eax,%eax
+  8007a8:	78 31                	js     8007db <handle_client+0x68>
+  8007aa:	83 ec 0c             	sub    $0xc,%esp
+  8007ad:	8d 85 0a fa ff ff    	lea    -0x5f6(%ebp),%eax
+  8007b3:	50                   	push   %eax
+  8007b4:	e8 c3 fe ff ff       	call   80067c <process_request>
+  8007b9:	83 c4 0c             	add    $0xc,%esp
+  8007bc:	ff b5 0b fa ff ff    	push   -0x5f5(%ebp)
+  8007c2:	50                   	push   %eax
+  8007c3:	53                   	push   %ebx
+  8007c4:	e8 53 ff ff ff       	call   80071c <issue_reply>
+  8007c9:	89 1c 24             	mov    %ebx,(%esp)
+  8007cc:	e8 f5 18 00 00       	call   8020c6 <close>
+  8007d1:	83 c4 10             	add    $0x10,%esp
+  8007d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8007d7:	5b                   	pop    %ebx
+  8007d8:	5e                   	pop    %esi
+  8007d9:	5d                   	pop    %ebp
+  8007da:	c3                   	ret
+  8007db:	b8 ec 41 80 00       	mov    $0x8041ec,%eax
+  8007e0:	e8 4e f8 ff ff       	call   800033 <die>
+  8007e5:	eb c3                	jmp    8007aa <handle_client+0x37>
+
+008007e7 <umain>:
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	57                   	push   %edi
+  8007eb:	56                   	push   %esi
+  8007ec:	53                   	push   %ebx
+  8007ed:	83 ec 48             	sub    $0x48,%esp
+  8007f0:	c7 05 00 50 80 00 39 	movl   $0x803f39,0x805000
+  8007f7:	3f 80 00 
+  8007fa:	68 4e 00 80 00       	push   $0x80004e
+  8007ff:	e8 82 16 00 00       	call   801e86 <set_pgfault_handler>
+  800804:	83 c4 0c             	add    $0xc,%esp
+  800807:	6a 04                	push   $0x4
+  800809:	6a 00                	push   $0x0
+  80080b:	68 20 60 80 00       	push   $0x806020
+  800810:	e8 53 0b 00 00       	call   801368 <memmove>
+  800815:	e8 c8 11 00 00       	call   8019e2 <sys_time_msec>
+  80081a:	89 c6                	mov    %eax,%esi
+  80081c:	83 c4 0c             	add    $0xc,%esp
+  80081f:	6a 06                	push   $0x6
+  800821:	6a 01                	push   $0x1
+  800823:	6a 02                	push   $0x2
+  800825:	e8 f1 24 00 00       	call   802d1b <socket>
+  80082a:	89 c7                	mov    %eax,%edi
+  80082c:	83 c4 10             	add    $0x10,%esp
+  80082f:	85 c0                	test   %eax,%eax
+  800831:	0f 88 98 00 00 00    	js     8008cf <umain+0xe8>
+  800837:	a1 84 60 80 00       	mov    0x806084,%eax
+  80083c:	8b 40 48             	mov    0x48(%eax),%eax
+  80083f:	83 ec 08             	sub    $0x8,%esp
+  800842:	50                   	push   %eax
+  800843:	68 5a 3f 80 00       	push   $0x803f5a
+  800848:	e8 74 02 00 00       	call   800ac1 <cprintf>
+  80084d:	c7 04 24 72 3f 80 00 	movl   $0x803f72,(%esp)
+  800854:	e8 68 02 00 00       	call   800ac1 <cprintf>
+  800859:	83 c4 0c             	add    $0xc,%esp
+  80085c:	6a 10                	push   $0x10
+  80085e:	6a 00                	push   $0x0
+  800860:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800863:	53                   	push   %ebx
+  800864:	e8 ca 0a 00 00       	call   801333 <memset>
+  800869:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+  80086d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800874:	e8 8c 31 00 00       	call   803a05 <htonl>
+  800879:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80087c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  800883:	e8 63 31 00 00       	call   8039eb <htons>
+  800888:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+  80088c:	c7 04 24 8e 3f 80 00 	movl   $0x803f8e,(%esp)
+  800893:	e8 29 02 00 00       	call   800ac1 <cprintf>
+  800898:	83 c4 0c             	add    $0xc,%esp
+  80089b:	6a 10                	push   $0x10
+  80089d:	53                   	push   %ebx
+  80089e:	57                   	push   %edi
+  80089f:	e8 e5 23 00 00       	call   802c89 <bind>
+  8008a4:	83 c4 10             	add    $0x10,%esp
+  8008a7:	85 c0                	test   %eax,%eax
+  8008a9:	78 33                	js     8008de <umain+0xf7>
+  8008ab:	83 ec 08             	sub    $0x8,%esp
+  8008ae:	6a 05                	push   $0x5
+  8008b0:	57                   	push   %edi
+  8008b1:	e8 42 24 00 00       	call   802cf8 <listen>
+  8008b6:	83 c4 10             	add    $0x10,%esp
+  8008b9:	85 c0                	test   %eax,%eax
+  8008bb:	78 2d                	js     8008ea <umain+0x103>
+  8008bd:	83 ec 0c             	sub    $0xc,%esp
+  8008c0:	68 ab 3f 80 00       	push   $0x803fab
+  8008c5:	e8 f7 01 00 00       	call   800ac1 <cprintf>
+  8008ca:	83 c4 10             	add    $0x10,%esp
+  8008cd:	eb 59                	jmp    800928 <umain+0x141>
+  8008cf:	b8 42 3f 80 00       	mov    $0x803f42,%eax
+  8008d4:	e8 5a f7 ff ff       	call   800033 <die>
+  8008d9:	e9 59 ff ff ff       	jmp    800837 <umain+0x50>
+  8008de:	b8 1c 42 80 00       	mov    $0x80421c,%eax
+  8008e3:	e8 4b f7 ff ff       	call   800033 <die>
+  8008e8:	eb c1                	jmp    8008ab <umain+0xc4>
+  8008ea:	b8 40 42 80 00       	mov    $0x804240,%eax
+  8008ef:	e8 3f f7 ff ff       	call   800033 <die>
+  8008f4:	eb c7                	jmp    8008bd <umain+0xd6>
+  8008f6:	83 ec 0c             	sub    $0xc,%esp
+  8008f9:	53                   	push   %ebx
+  8008fa:	e8 3e f8 ff ff       	call   80013d <gc_lease_map>
+  8008ff:	83 c4 10             	add    $0x10,%esp
+  800902:	89 de                	mov    %ebx,%esi
+  800904:	eb 32                	jmp    800938 <umain+0x151>
+  800906:	b8 64 42 80 00       	mov    $0x804264,%eax
+  80090b:	e8 23 f7 ff ff       	call   800033 <die>
+  800910:	83 ec 0c             	sub    $0xc,%esp
+  800913:	68 88 42 80 00       	push   $0x804288
+  800918:	e8 a4 01 00 00       	call   800ac1 <cprintf>
+  80091d:	89 1c 24             	mov    %ebx,(%esp)
+  800920:	e8 4e fe ff ff       	call   800773 <handle_client>
+  800925:	83 c4 10             	add    $0x10,%esp
+  800928:	e8 b5 10 00 00       	call   8019e2 <sys_time_msec>
+  80092d:	89 c3                	mov    %eax,%ebx
+  80092f:	29 f0                	sub    %esi,%eax
+  800931:	3d e0 93 04 00       	cmp    $0x493e0,%eax
+  800936:	7f be                	jg     8008f6 <umain+0x10f>
+  800938:	e8 6d f8 ff ff       	call   8001aa <check_lease_complete>
+  80093d:	83 ec 0c             	sub    $0xc,%esp
+  800940:	68 c7 3f 80 00       	push   $0x803fc7
+  800945:	e8 77 01 00 00       	call   800ac1 <cprintf>
+  80094a:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+  800951:	83 c4 0c             	add    $0xc,%esp
+  800954:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  800957:	50                   	push   %eax
+  800958:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80095b:	50                   	push   %eax
+  80095c:	57                   	push   %edi
+  80095d:	e8 f8 22 00 00       	call   802c5a <accept>
+  800962:	89 c3                	mov    %eax,%ebx
+  800964:	83 c4 10             	add    $0x10,%esp
+  800967:	85 c0                	test   %eax,%eax
+  800969:	78 9b                	js     800906 <umain+0x11f>
+  80096b:	eb a3                	jmp    800910 <umain+0x129>
+
+0080096d <libmain>:
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	56                   	push   %esi
+  800971:	53                   	push   %ebx
+  800972:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800975:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800978:	e8 31 0c 00 00       	call   8015ae <sys_getenvid>
+  80097d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800982:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800988:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80098d:	a3 84 60 80 00       	mov    %eax,0x806084
+  800992:	85 db                	test   %ebx,%ebx
+  800994:	7e 07                	jle    80099d <libmain+0x30>
+  800996:	8b 06                	mov    (%esi),%eax
+  800998:	a3 00 50 80 00       	mov    %eax,0x805000
+  80099d:	83 ec 08             	sub    $0x8,%esp
+  8009a0:	56                   	push   %esi
+  8009a1:	53                   	push   %ebx
+  8009a2:	e8 40 fe ff ff       	call   8007e7 <umain>
+  8009a7:	e8 0a 00 00 00       	call   8009b6 <exit>
+  8009ac:	83 c4 10             	add    $0x10,%esp
+  8009af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009b2:	5b                   	pop    %ebx
+  8009b3:	5e                   	pop    %esi
+  8009b4:	5d                   	pop    %ebp
+  8009b5:	c3                   	ret
+
+008009b6 <exit>:
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	83 ec 08             	sub    $0x8,%esp
+  8009bc:	a1 84 60 80 00       	mov    0x806084,%eax
+  8009c1:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8009c7:	85 c0                	test   %eax,%eax
+  8009c9:	75 14                	jne    8009df <exit+0x29>
+  8009cb:	e8 23 17 00 00       	call   8020f3 <close_all>
+  8009d0:	83 ec 0c             	sub    $0xc,%esp
+  8009d3:	6a 00                	push   $0x0
+  8009d5:	e8 93 0b 00 00       	call   80156d <sys_env_destroy>
+  8009da:	83 c4 10             	add    $0x10,%esp
+  8009dd:	c9                   	leave
+  8009de:	c3                   	ret
+  8009df:	e8 f6 12 00 00       	call   801cda <sys_lease_complete>
+  8009e4:	eb e5                	jmp    8009cb <exit+0x15>
+
+008009e6 <_panic>:
+  8009e6:	55                   	push   %ebp
+  8009e7:	89 e5                	mov    %esp,%ebp
+  8009e9:	56                   	push   %esi
+  8009ea:	53                   	push   %ebx
+  8009eb:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8009ee:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8009f4:	e8 b5 0b 00 00       	call   8015ae <sys_getenvid>
+  8009f9:	83 ec 0c             	sub    $0xc,%esp
+  8009fc:	ff 75 0c             	push   0xc(%ebp)
+  8009ff:	ff 75 08             	push   0x8(%ebp)
+  800a02:	56                   	push   %esi
+  800a03:	50                   	push   %eax
+  800a04:	68 cc 42 80 00       	push   $0x8042cc
+  800a09:	e8 b3 00 00 00       	call   800ac1 <cprintf>
+  800a0e:	83 c4 18             	add    $0x18,%esp
+  800a11:	53                   	push   %ebx
+  800a12:	ff 75 10             	push   0x10(%ebp)
+  800a15:	e8 56 00 00 00       	call   800a70 <vcprintf>
+  800a1a:	c7 04 24 00 3f 80 00 	movl   $0x803f00,(%esp)
+  800a21:	e8 9b 00 00 00       	call   800ac1 <cprintf>
+  800a26:	83 c4 10             	add    $0x10,%esp
+  800a29:	cc                   	int3
+  800a2a:	eb fd                	jmp    800a29 <_panic+0x43>
+
+00800a2c <putch>:
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	53                   	push   %ebx
+  800a30:	83 ec 04             	sub    $0x4,%esp
+  800a33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a36:	8b 13                	mov    (%ebx),%edx
+  800a38:	8d 42 01             	lea    0x1(%edx),%eax
+  800a3b:	89 03                	mov    %eax,(%ebx)
+  800a3d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a40:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800a44:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800a49:	74 09                	je     800a54 <putch+0x28>
+  800a4b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800a4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+  800a54:	83 ec 08             	sub    $0x8,%esp
+  800a57:	68 ff 00 00 00       	push   $0xff
+  800a5c:	8d 43 08             	lea    0x8(%ebx),%eax
+  800a5f:	50                   	push   %eax
+  800a60:	e8 cb 0a 00 00       	call   801530 <sys_cputs>
+  800a65:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800a6b:	83 c4 10             	add    $0x10,%esp
+  800a6e:	eb db                	jmp    800a4b <putch+0x1f>
+
+00800a70 <vcprintf>:
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800a79:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800a80:	00 00 00 
+  800a83:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800a8a:	00 00 00 
+  800a8d:	ff 75 0c             	push   0xc(%ebp)
+  800a90:	ff 75 08             	push   0x8(%ebp)
+  800a93:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800a99:	50                   	push   %eax
+  800a9a:	68 2c 0a 80 00       	push   $0x800a2c
+  800a9f:	e8 1c 01 00 00       	call   800bc0 <vprintfmt>
+  800aa4:	83 c4 08             	add    $0x8,%esp
+  800aa7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800aad:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800ab3:	50                   	push   %eax
+  800ab4:	e8 77 0a 00 00       	call   801530 <sys_cputs>
+  800ab9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800abf:	c9                   	leave
+  800ac0:	c3                   	ret
+
+00800ac1 <cprintf>:
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	83 ec 10             	sub    $0x10,%esp
+  800ac7:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800aca:	50                   	push   %eax
+  800acb:	ff 75 08             	push   0x8(%ebp)
+  800ace:	e8 9d ff ff ff       	call   800a70 <vcprintf>
+  800ad3:	c9                   	leave
+  800ad4:	c3                   	ret
+
+00800ad5 <printnum>:
+  800ad5:	55                   	push   %ebp
+  800ad6:	89 e5                	mov    %esp,%ebp
+  800ad8:	57                   	push   %edi
+  800ad9:	56                   	push   %esi
+  800ada:	53                   	push   %ebx
+  800adb:	83 ec 1c             	sub    $0x1c,%esp
+  800ade:	89 c3                	mov    %eax,%ebx
+  800ae0:	89 d6                	mov    %edx,%esi
+  800ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae8:	89 d1                	mov    %edx,%ecx
+  800aea:	89 c2                	mov    %eax,%edx
+  800aec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800aef:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800af2:	8b 45 10             	mov    0x10(%ebp),%eax
+  800af5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800af8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800aff:	39 c2                	cmp    %eax,%edx
+  800b01:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800b04:	73 4b                	jae    800b51 <printnum+0x7c>
+  800b06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b09:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800b0c:	85 ff                	test   %edi,%edi
+  800b0e:	7e 11                	jle    800b21 <printnum+0x4c>
+  800b10:	83 ec 08             	sub    $0x8,%esp
+  800b13:	56                   	push   %esi
+  800b14:	ff 75 18             	push   0x18(%ebp)
+  800b17:	ff d3                	call   *%ebx
+  800b19:	83 c4 10             	add    $0x10,%esp
+  800b1c:	83 ef 01             	sub    $0x1,%edi
+  800b1f:	75 ef                	jne    800b10 <printnum+0x3b>
+  800b21:	83 ec 08             	sub    $0x8,%esp
+  800b24:	56                   	push   %esi
+  800b25:	83 ec 04             	sub    $0x4,%esp
+  800b28:	ff 75 e4             	push   -0x1c(%ebp)
+  800b2b:	ff 75 e0             	push   -0x20(%ebp)
+  800b2e:	ff 75 dc             	push   -0x24(%ebp)
+  800b31:	ff 75 d8             	push   -0x28(%ebp)
+  800b34:	e8 18 32 00 00       	call   803d51 <__umoddi3>
+  800b39:	83 c4 14             	add    $0x14,%esp
+  800b3c:	0f be 80 ef 42 80 00 	movsbl 0x8042ef(%eax),%eax
+  800b43:	50                   	push   %eax
+  800b44:	ff d3                	call   *%ebx
+  800b46:	83 c4 10             	add    $0x10,%esp
+  800b49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b4c:	5b                   	pop    %ebx
+  800b4d:	5e                   	pop    %esi
+  800b4e:	5f                   	pop    %edi
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+  800b51:	83 ec 0c             	sub    $0xc,%esp
+  800b54:	ff 75 18             	push   0x18(%ebp)
+  800b57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800b5a:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800b5d:	52                   	push   %edx
+  800b5e:	50                   	push   %eax
+  800b5f:	83 ec 08             	sub    $0x8,%esp
+  800b62:	ff 75 e4             	push   -0x1c(%ebp)
+  800b65:	ff 75 e0             	push   -0x20(%ebp)
+  800b68:	ff 75 dc             	push   -0x24(%ebp)
+  800b6b:	ff 75 d8             	push   -0x28(%ebp)
+  800b6e:	e8 c0 31 00 00       	call   803d33 <__udivdi3>
+  800b73:	83 c4 18             	add    $0x18,%esp
+  800b76:	52                   	push   %edx
+  800b77:	50                   	push   %eax
+  800b78:	89 f2                	mov    %esi,%edx
+  800b7a:	89 d8                	mov    %ebx,%eax
+  800b7c:	e8 54 ff ff ff       	call   800ad5 <printnum>
+  800b81:	83 c4 20             	add    $0x20,%esp
+  800b84:	eb 9b                	jmp    800b21 <printnum+0x4c>
+
+00800b86 <sprintputch>:
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b8c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800b90:	8b 10                	mov    (%eax),%edx
+  800b92:	3b 50 04             	cmp    0x4(%eax),%edx
+  800b95:	73 0a                	jae    800ba1 <sprintputch+0x1b>
+  800b97:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800b9a:	89 08                	mov    %ecx,(%eax)
+  800b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9f:	88 02                	mov    %al,(%edx)
+  800ba1:	5d                   	pop    %ebp
+  800ba2:	c3                   	ret
+
+00800ba3 <printfmt>:
+  800ba3:	55                   	push   %ebp
+  800ba4:	89 e5                	mov    %esp,%ebp
+  800ba6:	83 ec 08             	sub    $0x8,%esp
+  800ba9:	8d 45 14             	lea    0x14(%ebp),%eax
+  800bac:	50                   	push   %eax
+  800bad:	ff 75 10             	push   0x10(%ebp)
+  800bb0:	ff 75 0c             	push   0xc(%ebp)
+  800bb3:	ff 75 08             	push   0x8(%ebp)
+  800bb6:	e8 05 00 00 00       	call   800bc0 <vprintfmt>
+  800bbb:	83 c4 10             	add    $0x10,%esp
+  800bbe:	c9                   	leave
+  800bbf:	c3                   	ret
+
+00800bc0 <vprintfmt>:
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	57                   	push   %edi
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  800bc6:	83 ec 2c             	sub    $0x2c,%esp
+  800bc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bcc:	89 df                	mov    %ebx,%edi
+  800bce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bd1:	8b 45 10             	mov    0x10(%ebp),%eax
+  800bd4:	8d 70 01             	lea    0x1(%eax),%esi
+  800bd7:	0f b6 00             	movzbl (%eax),%eax
+  800bda:	83 f8 25             	cmp    $0x25,%eax
+  800bdd:	74 1e                	je     800bfd <vprintfmt+0x3d>
+  800bdf:	85 c0                	test   %eax,%eax
+  800be1:	0f 84 15 05 00 00    	je     8010fc <vprintfmt+0x53c>
+  800be7:	83 ec 08             	sub    $0x8,%esp
+  800bea:	53                   	push   %ebx
+  800beb:	50                   	push   %eax
+  800bec:	ff d7                	call   *%edi
+  800bee:	83 c6 01             	add    $0x1,%esi
+  800bf1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800bf5:	83 c4 10             	add    $0x10,%esp
+  800bf8:	83 f8 25             	cmp    $0x25,%eax
+  800bfb:	75 e2                	jne    800bdf <vprintfmt+0x1f>
+  800bfd:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800c01:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800c08:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800c0f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800c16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c1b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800c1e:	8d 56 01             	lea    0x1(%esi),%edx
+  800c21:	0f b6 0e             	movzbl (%esi),%ecx
+  800c24:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800c27:	3c 55                	cmp    $0x55,%al
+  800c29:	0f 87 3b 04 00 00    	ja     80106a <vprintfmt+0x4aa>
+  800c2f:	0f b6 c0             	movzbl %al,%eax
+  800c32:	ff 24 85 40 44 80 00 	jmp    *0x804440(,%eax,4)
+  800c39:	89 75 10             	mov    %esi,0x10(%ebp)
+  800c3c:	eb 93                	jmp    800bd1 <vprintfmt+0x11>
+  800c3e:	89 d6                	mov    %edx,%esi
+  800c40:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800c44:	eb d8                	jmp    800c1e <vprintfmt+0x5e>
+  800c46:	89 d6                	mov    %edx,%esi
+  800c48:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800c4c:	eb d0                	jmp    800c1e <vprintfmt+0x5e>
+  800c4e:	0f b6 c9             	movzbl %cl,%ecx
+  800c51:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800c54:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c57:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800c5b:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800c5e:	83 f9 09             	cmp    $0x9,%ecx
+  800c61:	77 6f                	ja     800cd2 <vprintfmt+0x112>
+  800c63:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800c66:	83 c2 01             	add    $0x1,%edx
+  800c69:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800c6c:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800c70:	0f be 02             	movsbl (%edx),%eax
+  800c73:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c76:	83 fe 09             	cmp    $0x9,%esi
+  800c79:	76 eb                	jbe    800c66 <vprintfmt+0xa6>
+  800c7b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800c7e:	89 d6                	mov    %edx,%esi
+  800c80:	eb 13                	jmp    800c95 <vprintfmt+0xd5>
+  800c82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c85:	8b 00                	mov    (%eax),%eax
+  800c87:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c8d:	8d 40 04             	lea    0x4(%eax),%eax
+  800c90:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c93:	89 d6                	mov    %edx,%esi
+  800c95:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c99:	79 83                	jns    800c1e <vprintfmt+0x5e>
+  800c9b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800c9e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ca1:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800ca8:	e9 71 ff ff ff       	jmp    800c1e <vprintfmt+0x5e>
+  800cad:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800cb0:	85 c9                	test   %ecx,%ecx
+  800cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb7:	0f 49 c1             	cmovns %ecx,%eax
+  800cba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800cbd:	89 d6                	mov    %edx,%esi
+  800cbf:	e9 5a ff ff ff       	jmp    800c1e <vprintfmt+0x5e>
+  800cc4:	89 d6                	mov    %edx,%esi
+  800cc6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800ccd:	e9 4c ff ff ff       	jmp    800c1e <vprintfmt+0x5e>
+  800cd2:	89 d6                	mov    %edx,%esi
+  800cd4:	eb bf                	jmp    800c95 <vprintfmt+0xd5>
+  800cd6:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800cda:	89 d6                	mov    %edx,%esi
+  800cdc:	e9 3d ff ff ff       	jmp    800c1e <vprintfmt+0x5e>
+  800ce1:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ce4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce7:	8d 70 04             	lea    0x4(%eax),%esi
+  800cea:	83 ec 08             	sub    $0x8,%esp
+  800ced:	53                   	push   %ebx
+  800cee:	ff 30                	push   (%eax)
+  800cf0:	ff d7                	call   *%edi
+  800cf2:	83 c4 10             	add    $0x10,%esp
+  800cf5:	89 75 14             	mov    %esi,0x14(%ebp)
+  800cf8:	e9 d4 fe ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  800cfd:	89 55 10             	mov    %edx,0x10(%ebp)
+  800d00:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d03:	8d 70 04             	lea    0x4(%eax),%esi
+  800d06:	8b 10                	mov    (%eax),%edx
+  800d08:	89 d0                	mov    %edx,%eax
+  800d0a:	f7 d8                	neg    %eax
+  800d0c:	0f 48 c2             	cmovs  %edx,%eax
+  800d0f:	83 f8 12             	cmp    $0x12,%eax
+  800d12:	7f 23                	jg     800d37 <vprintfmt+0x177>
+  800d14:	8b 14 85 a0 45 80 00 	mov    0x8045a0(,%eax,4),%edx
+  800d1b:	85 d2                	test   %edx,%edx
+  800d1d:	74 18                	je     800d37 <vprintfmt+0x177>
+  800d1f:	52                   	push   %edx
+  800d20:	68 73 47 80 00       	push   $0x804773
+  800d25:	53                   	push   %ebx
+  800d26:	57                   	push   %edi
+  800d27:	e8 77 fe ff ff       	call   800ba3 <printfmt>
+  800d2c:	83 c4 10             	add    $0x10,%esp
+  800d2f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800d32:	e9 9a fe ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  800d37:	50                   	push   %eax
+  800d38:	68 07 43 80 00       	push   $0x804307
+  800d3d:	53                   	push   %ebx
+  800d3e:	57                   	push   %edi
+  800d3f:	e8 5f fe ff ff       	call   800ba3 <printfmt>
+  800d44:	83 c4 10             	add    $0x10,%esp
+  800d47:	89 75 14             	mov    %esi,0x14(%ebp)
+  800d4a:	e9 82 fe ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  800d4f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800d52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d55:	83 c0 04             	add    $0x4,%eax
+  800d58:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800d5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d5e:	8b 00                	mov    (%eax),%eax
+  800d60:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	0f 84 61 03 00 00    	je     8010cc <vprintfmt+0x50c>
+  800d6b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800d6f:	7e 06                	jle    800d77 <vprintfmt+0x1b7>
+  800d71:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800d75:	75 29                	jne    800da0 <vprintfmt+0x1e0>
+  800d77:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d7a:	8d 70 01             	lea    0x1(%eax),%esi
+  800d7d:	0f b6 00             	movzbl (%eax),%eax
+  800d80:	0f be d0             	movsbl %al,%edx
+  800d83:	85 d2                	test   %edx,%edx
+  800d85:	0f 84 bb 00 00 00    	je     800e46 <vprintfmt+0x286>
+  800d8b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d8e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d91:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d94:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d97:	eb 7a                	jmp    800e13 <vprintfmt+0x253>
+  800d99:	c7 45 d0 00 43 80 00 	movl   $0x804300,-0x30(%ebp)
+  800da0:	83 ec 08             	sub    $0x8,%esp
+  800da3:	ff 75 d4             	push   -0x2c(%ebp)
+  800da6:	ff 75 d0             	push   -0x30(%ebp)
+  800da9:	e8 e0 03 00 00       	call   80118e <strnlen>
+  800dae:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800db1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800db4:	83 c4 10             	add    $0x10,%esp
+  800db7:	85 d2                	test   %edx,%edx
+  800db9:	0f 8e d6 02 00 00    	jle    801095 <vprintfmt+0x4d5>
+  800dbf:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800dc3:	83 ec 08             	sub    $0x8,%esp
+  800dc6:	53                   	push   %ebx
+  800dc7:	56                   	push   %esi
+  800dc8:	ff d7                	call   *%edi
+  800dca:	83 c4 10             	add    $0x10,%esp
+  800dcd:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800dd1:	75 f0                	jne    800dc3 <vprintfmt+0x203>
+  800dd3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800dd6:	8d 70 01             	lea    0x1(%eax),%esi
+  800dd9:	0f b6 00             	movzbl (%eax),%eax
+  800ddc:	0f be d0             	movsbl %al,%edx
+  800ddf:	85 d2                	test   %edx,%edx
+  800de1:	0f 84 da 02 00 00    	je     8010c1 <vprintfmt+0x501>
+  800de7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800dea:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ded:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800df0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800df3:	eb 1e                	jmp    800e13 <vprintfmt+0x253>
+  800df5:	83 ec 08             	sub    $0x8,%esp
+  800df8:	ff 75 0c             	push   0xc(%ebp)
+  800dfb:	52                   	push   %edx
+  800dfc:	ff 55 08             	call   *0x8(%ebp)
+  800dff:	83 c4 10             	add    $0x10,%esp
+  800e02:	83 eb 01             	sub    $0x1,%ebx
+  800e05:	83 c6 01             	add    $0x1,%esi
+  800e08:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800e0c:	0f be d0             	movsbl %al,%edx
+  800e0f:	85 d2                	test   %edx,%edx
+  800e11:	74 2a                	je     800e3d <vprintfmt+0x27d>
+  800e13:	85 ff                	test   %edi,%edi
+  800e15:	78 05                	js     800e1c <vprintfmt+0x25c>
+  800e17:	83 ef 01             	sub    $0x1,%edi
+  800e1a:	78 59                	js     800e75 <vprintfmt+0x2b5>
+  800e1c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e20:	74 d3                	je     800df5 <vprintfmt+0x235>
+  800e22:	0f be c0             	movsbl %al,%eax
+  800e25:	83 e8 20             	sub    $0x20,%eax
+  800e28:	83 f8 5e             	cmp    $0x5e,%eax
+  800e2b:	76 c8                	jbe    800df5 <vprintfmt+0x235>
+  800e2d:	83 ec 08             	sub    $0x8,%esp
+  800e30:	ff 75 0c             	push   0xc(%ebp)
+  800e33:	6a 3f                	push   $0x3f
+  800e35:	ff 55 08             	call   *0x8(%ebp)
+  800e38:	83 c4 10             	add    $0x10,%esp
+  800e3b:	eb c5                	jmp    800e02 <vprintfmt+0x242>
+  800e3d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800e40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e43:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e46:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800e49:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800e4d:	7e 1b                	jle    800e6a <vprintfmt+0x2aa>
+  800e4f:	83 ec 08             	sub    $0x8,%esp
+  800e52:	53                   	push   %ebx
+  800e53:	6a 20                	push   $0x20
+  800e55:	ff d7                	call   *%edi
+  800e57:	83 c4 10             	add    $0x10,%esp
+  800e5a:	83 ee 01             	sub    $0x1,%esi
+  800e5d:	75 f0                	jne    800e4f <vprintfmt+0x28f>
+  800e5f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e62:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e65:	e9 67 fd ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  800e6a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e6d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e70:	e9 5c fd ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  800e75:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800e78:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e7e:	eb c6                	jmp    800e46 <vprintfmt+0x286>
+  800e80:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800e83:	89 55 10             	mov    %edx,0x10(%ebp)
+  800e86:	83 f9 01             	cmp    $0x1,%ecx
+  800e89:	7f 1f                	jg     800eaa <vprintfmt+0x2ea>
+  800e8b:	85 c9                	test   %ecx,%ecx
+  800e8d:	74 67                	je     800ef6 <vprintfmt+0x336>
+  800e8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e92:	8b 30                	mov    (%eax),%esi
+  800e94:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800e97:	89 f0                	mov    %esi,%eax
+  800e99:	c1 f8 1f             	sar    $0x1f,%eax
+  800e9c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800e9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ea5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ea8:	eb 17                	jmp    800ec1 <vprintfmt+0x301>
+  800eaa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ead:	8b 50 04             	mov    0x4(%eax),%edx
+  800eb0:	8b 00                	mov    (%eax),%eax
+  800eb2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800eb5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800eb8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ebb:	8d 40 08             	lea    0x8(%eax),%eax
+  800ebe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ec1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ec4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ec7:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ecc:	85 c9                	test   %ecx,%ecx
+  800ece:	0f 89 12 01 00 00    	jns    800fe6 <vprintfmt+0x426>
+  800ed4:	83 ec 08             	sub    $0x8,%esp
+  800ed7:	53                   	push   %ebx
+  800ed8:	6a 2d                	push   $0x2d
+  800eda:	ff d7                	call   *%edi
+  800edc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800edf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ee2:	f7 da                	neg    %edx
+  800ee4:	83 d1 00             	adc    $0x0,%ecx
+  800ee7:	f7 d9                	neg    %ecx
+  800ee9:	83 c4 10             	add    $0x10,%esp
+  800eec:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ef1:	e9 f0 00 00 00       	jmp    800fe6 <vprintfmt+0x426>
+  800ef6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef9:	8b 30                	mov    (%eax),%esi
+  800efb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800efe:	89 f0                	mov    %esi,%eax
+  800f00:	c1 f8 1f             	sar    $0x1f,%eax
+  800f03:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800f06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f09:	8d 40 04             	lea    0x4(%eax),%eax
+  800f0c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f0f:	eb b0                	jmp    800ec1 <vprintfmt+0x301>
+  800f11:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800f14:	89 55 10             	mov    %edx,0x10(%ebp)
+  800f17:	83 f9 01             	cmp    $0x1,%ecx
+  800f1a:	7f 1e                	jg     800f3a <vprintfmt+0x37a>
+  800f1c:	85 c9                	test   %ecx,%ecx
+  800f1e:	74 32                	je     800f52 <vprintfmt+0x392>
+  800f20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f23:	8b 10                	mov    (%eax),%edx
+  800f25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2a:	8d 40 04             	lea    0x4(%eax),%eax
+  800f2d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f30:	be 0a 00 00 00       	mov    $0xa,%esi
+  800f35:	e9 ac 00 00 00       	jmp    800fe6 <vprintfmt+0x426>
+  800f3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f3d:	8b 10                	mov    (%eax),%edx
+  800f3f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f42:	8d 40 08             	lea    0x8(%eax),%eax
+  800f45:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f48:	be 0a 00 00 00       	mov    $0xa,%esi
+  800f4d:	e9 94 00 00 00       	jmp    800fe6 <vprintfmt+0x426>
+  800f52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f55:	8b 10                	mov    (%eax),%edx
+  800f57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f5c:	8d 40 04             	lea    0x4(%eax),%eax
+  800f5f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f62:	be 0a 00 00 00       	mov    $0xa,%esi
+  800f67:	eb 7d                	jmp    800fe6 <vprintfmt+0x426>
+  800f69:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800f6c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800f6f:	83 f9 01             	cmp    $0x1,%ecx
+  800f72:	7f 1b                	jg     800f8f <vprintfmt+0x3cf>
+  800f74:	85 c9                	test   %ecx,%ecx
+  800f76:	74 2c                	je     800fa4 <vprintfmt+0x3e4>
+  800f78:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f7b:	8b 10                	mov    (%eax),%edx
+  800f7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f82:	8d 40 04             	lea    0x4(%eax),%eax
+  800f85:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f88:	be 08 00 00 00       	mov    $0x8,%esi
+  800f8d:	eb 57                	jmp    800fe6 <vprintfmt+0x426>
+  800f8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f92:	8b 10                	mov    (%eax),%edx
+  800f94:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f97:	8d 40 08             	lea    0x8(%eax),%eax
+  800f9a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f9d:	be 08 00 00 00       	mov    $0x8,%esi
+  800fa2:	eb 42                	jmp    800fe6 <vprintfmt+0x426>
+  800fa4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fa7:	8b 10                	mov    (%eax),%edx
+  800fa9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fae:	8d 40 04             	lea    0x4(%eax),%eax
+  800fb1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fb4:	be 08 00 00 00       	mov    $0x8,%esi
+  800fb9:	eb 2b                	jmp    800fe6 <vprintfmt+0x426>
+  800fbb:	89 55 10             	mov    %edx,0x10(%ebp)
+  800fbe:	83 ec 08             	sub    $0x8,%esp
+  800fc1:	53                   	push   %ebx
+  800fc2:	6a 30                	push   $0x30
+  800fc4:	ff d7                	call   *%edi
+  800fc6:	83 c4 08             	add    $0x8,%esp
+  800fc9:	53                   	push   %ebx
+  800fca:	6a 78                	push   $0x78
+  800fcc:	ff d7                	call   *%edi
+  800fce:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fd1:	8b 10                	mov    (%eax),%edx
+  800fd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd8:	83 c4 10             	add    $0x10,%esp
+  800fdb:	8d 40 04             	lea    0x4(%eax),%eax
+  800fde:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fe1:	be 10 00 00 00       	mov    $0x10,%esi
+  800fe6:	83 ec 0c             	sub    $0xc,%esp
+  800fe9:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800fed:	50                   	push   %eax
+  800fee:	ff 75 e4             	push   -0x1c(%ebp)
+  800ff1:	56                   	push   %esi
+  800ff2:	51                   	push   %ecx
+  800ff3:	52                   	push   %edx
+  800ff4:	89 da                	mov    %ebx,%edx
+  800ff6:	89 f8                	mov    %edi,%eax
+  800ff8:	e8 d8 fa ff ff       	call   800ad5 <printnum>
+  800ffd:	83 c4 20             	add    $0x20,%esp
+  801000:	e9 cc fb ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  801005:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801008:	89 55 10             	mov    %edx,0x10(%ebp)
+  80100b:	83 f9 01             	cmp    $0x1,%ecx
+  80100e:	7f 1b                	jg     80102b <vprintfmt+0x46b>
+  801010:	85 c9                	test   %ecx,%ecx
+  801012:	74 2c                	je     801040 <vprintfmt+0x480>
+  801014:	8b 45 14             	mov    0x14(%ebp),%eax
+  801017:	8b 10                	mov    (%eax),%edx
+  801019:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101e:	8d 40 04             	lea    0x4(%eax),%eax
+  801021:	89 45 14             	mov    %eax,0x14(%ebp)
+  801024:	be 10 00 00 00       	mov    $0x10,%esi
+  801029:	eb bb                	jmp    800fe6 <vprintfmt+0x426>
+  80102b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80102e:	8b 10                	mov    (%eax),%edx
+  801030:	8b 48 04             	mov    0x4(%eax),%ecx
+  801033:	8d 40 08             	lea    0x8(%eax),%eax
+  801036:	89 45 14             	mov    %eax,0x14(%ebp)
+  801039:	be 10 00 00 00       	mov    $0x10,%esi
+  80103e:	eb a6                	jmp    800fe6 <vprintfmt+0x426>
+  801040:	8b 45 14             	mov    0x14(%ebp),%eax
+  801043:	8b 10                	mov    (%eax),%edx
+  801045:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104a:	8d 40 04             	lea    0x4(%eax),%eax
+  80104d:	89 45 14             	mov    %eax,0x14(%ebp)
+  801050:	be 10 00 00 00       	mov    $0x10,%esi
+  801055:	eb 8f                	jmp    800fe6 <vprintfmt+0x426>
+  801057:	89 55 10             	mov    %edx,0x10(%ebp)
+  80105a:	83 ec 08             	sub    $0x8,%esp
+  80105d:	53                   	push   %ebx
+  80105e:	6a 25                	push   $0x25
+  801060:	ff d7                	call   *%edi
+  801062:	83 c4 10             	add    $0x10,%esp
+  801065:	e9 67 fb ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  80106a:	83 ec 08             	sub    $0x8,%esp
+  80106d:	53                   	push   %ebx
+  80106e:	6a 25                	push   $0x25
+  801070:	ff d7                	call   *%edi
+  801072:	83 c4 10             	add    $0x10,%esp
+  801075:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  801079:	0f 84 ba fb ff ff    	je     800c39 <vprintfmt+0x79>
+  80107f:	89 75 10             	mov    %esi,0x10(%ebp)
+  801082:	89 f0                	mov    %esi,%eax
+  801084:	83 e8 01             	sub    $0x1,%eax
+  801087:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80108b:	75 f7                	jne    801084 <vprintfmt+0x4c4>
+  80108d:	89 45 10             	mov    %eax,0x10(%ebp)
+  801090:	e9 3c fb ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  801095:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801098:	8d 70 01             	lea    0x1(%eax),%esi
+  80109b:	0f b6 00             	movzbl (%eax),%eax
+  80109e:	0f be d0             	movsbl %al,%edx
+  8010a1:	85 d2                	test   %edx,%edx
+  8010a3:	74 11                	je     8010b6 <vprintfmt+0x4f6>
+  8010a5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8010a8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8010ab:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8010ae:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8010b1:	e9 5d fd ff ff       	jmp    800e13 <vprintfmt+0x253>
+  8010b6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8010b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010bc:	e9 10 fb ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  8010c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8010c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010c7:	e9 05 fb ff ff       	jmp    800bd1 <vprintfmt+0x11>
+  8010cc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8010d0:	7e 0a                	jle    8010dc <vprintfmt+0x51c>
+  8010d2:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8010d6:	0f 85 bd fc ff ff    	jne    800d99 <vprintfmt+0x1d9>
+  8010dc:	ba 28 00 00 00       	mov    $0x28,%edx
+  8010e1:	b8 28 00 00 00       	mov    $0x28,%eax
+  8010e6:	be 01 43 80 00       	mov    $0x804301,%esi
+  8010eb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8010ee:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8010f1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8010f4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8010f7:	e9 17 fd ff ff       	jmp    800e13 <vprintfmt+0x253>
+  8010fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+
+00801104 <vsnprintf>:
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	83 ec 18             	sub    $0x18,%esp
+  80110a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80110d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801110:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801113:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801117:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80111a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  801121:	85 c0                	test   %eax,%eax
+  801123:	74 26                	je     80114b <vsnprintf+0x47>
+  801125:	85 d2                	test   %edx,%edx
+  801127:	7e 22                	jle    80114b <vsnprintf+0x47>
+  801129:	ff 75 14             	push   0x14(%ebp)
+  80112c:	ff 75 10             	push   0x10(%ebp)
+  80112f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801132:	50                   	push   %eax
+  801133:	68 86 0b 80 00       	push   $0x800b86
+  801138:	e8 83 fa ff ff       	call   800bc0 <vprintfmt>
+  80113d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801140:	c6 00 00             	movb   $0x0,(%eax)
+  801143:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801146:	83 c4 10             	add    $0x10,%esp
+  801149:	c9                   	leave
+  80114a:	c3                   	ret
+  80114b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801150:	eb f7                	jmp    801149 <vsnprintf+0x45>
+
+00801152 <snprintf>:
+  801152:	55                   	push   %ebp
+  801153:	89 e5                	mov    %esp,%ebp
+  801155:	83 ec 08             	sub    $0x8,%esp
+  801158:	8d 45 14             	lea    0x14(%ebp),%eax
+  80115b:	50                   	push   %eax
+  80115c:	ff 75 10             	push   0x10(%ebp)
+  80115f:	ff 75 0c             	push   0xc(%ebp)
+  801162:	ff 75 08             	push   0x8(%ebp)
+  801165:	e8 9a ff ff ff       	call   801104 <vsnprintf>
+  80116a:	c9                   	leave
+  80116b:	c3                   	ret
+
+0080116c <strlen>:
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801172:	80 3a 00             	cmpb   $0x0,(%edx)
+  801175:	74 10                	je     801187 <strlen+0x1b>
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117c:	83 c0 01             	add    $0x1,%eax
+  80117f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801183:	75 f7                	jne    80117c <strlen+0x10>
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+  801187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118c:	eb f7                	jmp    801185 <strlen+0x19>
+
+0080118e <strnlen>:
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801194:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801197:	85 d2                	test   %edx,%edx
+  801199:	74 16                	je     8011b1 <strnlen+0x23>
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8011a4:	74 09                	je     8011af <strnlen+0x21>
+  8011a6:	83 c0 01             	add    $0x1,%eax
+  8011a9:	39 d0                	cmp    %edx,%eax
+  8011ab:	75 f3                	jne    8011a0 <strnlen+0x12>
+  8011ad:	89 d0                	mov    %edx,%eax
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+  8011b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b6:	eb f7                	jmp    8011af <strnlen+0x21>
+
+008011b8 <strcpy>:
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	53                   	push   %ebx
+  8011bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8011bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8011c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8011cb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8011ce:	83 c0 01             	add    $0x1,%eax
+  8011d1:	84 d2                	test   %dl,%dl
+  8011d3:	75 f2                	jne    8011c7 <strcpy+0xf>
+  8011d5:	89 c8                	mov    %ecx,%eax
+  8011d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011da:	c9                   	leave
+  8011db:	c3                   	ret
+
+008011dc <strcat>:
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	53                   	push   %ebx
+  8011e0:	83 ec 10             	sub    $0x10,%esp
+  8011e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8011e6:	53                   	push   %ebx
+  8011e7:	e8 80 ff ff ff       	call   80116c <strlen>
+  8011ec:	83 c4 08             	add    $0x8,%esp
+  8011ef:	ff 75 0c             	push   0xc(%ebp)
+  8011f2:	01 d8                	add    %ebx,%eax
+  8011f4:	50                   	push   %eax
+  8011f5:	e8 be ff ff ff       	call   8011b8 <strcpy>
+  8011fa:	89 d8                	mov    %ebx,%eax
+  8011fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ff:	c9                   	leave
+  801200:	c3                   	ret
+
+00801201 <strncpy>:
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+  801206:	8b 75 08             	mov    0x8(%ebp),%esi
+  801209:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80120c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120f:	85 db                	test   %ebx,%ebx
+  801211:	74 17                	je     80122a <strncpy+0x29>
+  801213:	01 f3                	add    %esi,%ebx
+  801215:	89 f0                	mov    %esi,%eax
+  801217:	83 c0 01             	add    $0x1,%eax
+  80121a:	0f b6 0a             	movzbl (%edx),%ecx
+  80121d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801220:	80 f9 01             	cmp    $0x1,%cl
+  801223:	83 da ff             	sbb    $0xffffffff,%edx
+  801226:	39 c3                	cmp    %eax,%ebx
+  801228:	75 ed                	jne    801217 <strncpy+0x16>
+  80122a:	89 f0                	mov    %esi,%eax
+  80122c:	5b                   	pop    %ebx
+  80122d:	5e                   	pop    %esi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+
+00801230 <strlcpy>:
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	56                   	push   %esi
+  801234:	53                   	push   %ebx
+  801235:	8b 75 08             	mov    0x8(%ebp),%esi
+  801238:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80123b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123e:	89 f0                	mov    %esi,%eax
+  801240:	85 db                	test   %ebx,%ebx
+  801242:	74 1e                	je     801262 <strlcpy+0x32>
+  801244:	83 eb 01             	sub    $0x1,%ebx
+  801247:	74 16                	je     80125f <strlcpy+0x2f>
+  801249:	01 f3                	add    %esi,%ebx
+  80124b:	0f b6 0a             	movzbl (%edx),%ecx
+  80124e:	84 c9                	test   %cl,%cl
+  801250:	74 0d                	je     80125f <strlcpy+0x2f>
+  801252:	83 c2 01             	add    $0x1,%edx
+  801255:	83 c0 01             	add    $0x1,%eax
+  801258:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80125b:	39 d8                	cmp    %ebx,%eax
+  80125d:	75 ec                	jne    80124b <strlcpy+0x1b>
+  80125f:	c6 00 00             	movb   $0x0,(%eax)
+  801262:	29 f0                	sub    %esi,%eax
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5d                   	pop    %ebp
+  801267:	c3                   	ret
+
+00801268 <strcmp>:
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80126e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801271:	0f b6 01             	movzbl (%ecx),%eax
+  801274:	84 c0                	test   %al,%al
+  801276:	74 11                	je     801289 <strcmp+0x21>
+  801278:	38 02                	cmp    %al,(%edx)
+  80127a:	75 0d                	jne    801289 <strcmp+0x21>
+  80127c:	83 c1 01             	add    $0x1,%ecx
+  80127f:	83 c2 01             	add    $0x1,%edx
+  801282:	0f b6 01             	movzbl (%ecx),%eax
+  801285:	84 c0                	test   %al,%al
+  801287:	75 ef                	jne    801278 <strcmp+0x10>
+  801289:	0f b6 c0             	movzbl %al,%eax
+  80128c:	0f b6 12             	movzbl (%edx),%edx
+  80128f:	29 d0                	sub    %edx,%eax
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+
+00801293 <strncmp>:
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+  801296:	53                   	push   %ebx
+  801297:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80129a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80129d:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a5:	85 d2                	test   %edx,%edx
+  8012a7:	74 2e                	je     8012d7 <strncmp+0x44>
+  8012a9:	0f b6 01             	movzbl (%ecx),%eax
+  8012ac:	84 c0                	test   %al,%al
+  8012ae:	74 16                	je     8012c6 <strncmp+0x33>
+  8012b0:	3a 03                	cmp    (%ebx),%al
+  8012b2:	75 12                	jne    8012c6 <strncmp+0x33>
+  8012b4:	83 c1 01             	add    $0x1,%ecx
+  8012b7:	83 c3 01             	add    $0x1,%ebx
+  8012ba:	83 ea 01             	sub    $0x1,%edx
+  8012bd:	75 ea                	jne    8012a9 <strncmp+0x16>
+  8012bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c4:	eb 11                	jmp    8012d7 <strncmp+0x44>
+  8012c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cb:	85 d2                	test   %edx,%edx
+  8012cd:	74 08                	je     8012d7 <strncmp+0x44>
+  8012cf:	0f b6 01             	movzbl (%ecx),%eax
+  8012d2:	0f b6 13             	movzbl (%ebx),%edx
+  8012d5:	29 d0                	sub    %edx,%eax
+  8012d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012da:	c9                   	leave
+  8012db:	c3                   	ret
+
+008012dc <strchr>:
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8012e6:	0f b6 10             	movzbl (%eax),%edx
+  8012e9:	84 d2                	test   %dl,%dl
+  8012eb:	74 15                	je     801302 <strchr+0x26>
+  8012ed:	38 d1                	cmp    %dl,%cl
+  8012ef:	74 0f                	je     801300 <strchr+0x24>
+  8012f1:	83 c0 01             	add    $0x1,%eax
+  8012f4:	0f b6 10             	movzbl (%eax),%edx
+  8012f7:	84 d2                	test   %dl,%dl
+  8012f9:	75 f2                	jne    8012ed <strchr+0x11>
+  8012fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+  801302:	b8 00 00 00 00       	mov    $0x0,%eax
+  801307:	eb f7                	jmp    801300 <strchr+0x24>
+
+00801309 <strfind>:
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	53                   	push   %ebx
+  80130d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801310:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801313:	0f b6 18             	movzbl (%eax),%ebx
+  801316:	38 d3                	cmp    %dl,%bl
+  801318:	74 14                	je     80132e <strfind+0x25>
+  80131a:	89 d1                	mov    %edx,%ecx
+  80131c:	84 db                	test   %bl,%bl
+  80131e:	74 0e                	je     80132e <strfind+0x25>
+  801320:	83 c0 01             	add    $0x1,%eax
+  801323:	0f b6 10             	movzbl (%eax),%edx
+  801326:	38 ca                	cmp    %cl,%dl
+  801328:	74 04                	je     80132e <strfind+0x25>
+  80132a:	84 d2                	test   %dl,%dl
+  80132c:	75 f2                	jne    801320 <strfind+0x17>
+  80132e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801331:	c9                   	leave
+  801332:	c3                   	ret
+
+00801333 <memset>:
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	57                   	push   %edi
+  801337:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80133a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80133d:	85 c9                	test   %ecx,%ecx
+  80133f:	74 20                	je     801361 <memset+0x2e>
+  801341:	89 f8                	mov    %edi,%eax
+  801343:	09 c8                	or     %ecx,%eax
+  801345:	a8 03                	test   $0x3,%al
+  801347:	75 12                	jne    80135b <memset+0x28>
+  801349:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80134d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  801353:	c1 e9 02             	shr    $0x2,%ecx
+  801356:	fc                   	cld
+  801357:	f3 ab                	rep stos %eax,%es:(%edi)
+  801359:	eb 06                	jmp    801361 <memset+0x2e>
+  80135b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80135e:	fc                   	cld
+  80135f:	f3 aa                	rep stos %al,%es:(%edi)
+  801361:	89 f8                	mov    %edi,%eax
+  801363:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801366:	c9                   	leave
+  801367:	c3                   	ret
+
+00801368 <memmove>:
+  801368:	55                   	push   %ebp
+  801369:	89 e5                	mov    %esp,%ebp
+  80136b:	57                   	push   %edi
+  80136c:	56                   	push   %esi
+  80136d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801370:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801373:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801376:	39 c6                	cmp    %eax,%esi
+  801378:	73 32                	jae    8013ac <memmove+0x44>
+  80137a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80137d:	39 d0                	cmp    %edx,%eax
+  80137f:	73 2b                	jae    8013ac <memmove+0x44>
+  801381:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  801384:	89 d6                	mov    %edx,%esi
+  801386:	09 fe                	or     %edi,%esi
+  801388:	09 ce                	or     %ecx,%esi
+  80138a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801390:	75 0e                	jne    8013a0 <memmove+0x38>
+  801392:	83 ef 04             	sub    $0x4,%edi
+  801395:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801398:	c1 e9 02             	shr    $0x2,%ecx
+  80139b:	fd                   	std
+  80139c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80139e:	eb 09                	jmp    8013a9 <memmove+0x41>
+  8013a0:	83 ef 01             	sub    $0x1,%edi
+  8013a3:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8013a6:	fd                   	std
+  8013a7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8013a9:	fc                   	cld
+  8013aa:	eb 1a                	jmp    8013c6 <memmove+0x5e>
+  8013ac:	89 f2                	mov    %esi,%edx
+  8013ae:	09 c2                	or     %eax,%edx
+  8013b0:	09 ca                	or     %ecx,%edx
+  8013b2:	f6 c2 03             	test   $0x3,%dl
+  8013b5:	75 0a                	jne    8013c1 <memmove+0x59>
+  8013b7:	c1 e9 02             	shr    $0x2,%ecx
+  8013ba:	89 c7                	mov    %eax,%edi
+  8013bc:	fc                   	cld
+  8013bd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013bf:	eb 05                	jmp    8013c6 <memmove+0x5e>
+  8013c1:	89 c7                	mov    %eax,%edi
+  8013c3:	fc                   	cld
+  8013c4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8013c6:	5e                   	pop    %esi
+  8013c7:	5f                   	pop    %edi
+  8013c8:	5d                   	pop    %ebp
+  8013c9:	c3                   	ret
+
+008013ca <memcpy>:
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	83 ec 0c             	sub    $0xc,%esp
+  8013d0:	ff 75 10             	push   0x10(%ebp)
+  8013d3:	ff 75 0c             	push   0xc(%ebp)
+  8013d6:	ff 75 08             	push   0x8(%ebp)
+  8013d9:	e8 8a ff ff ff       	call   801368 <memmove>
+  8013de:	c9                   	leave
+  8013df:	c3                   	ret
+
+008013e0 <memcmp>:
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	56                   	push   %esi
+  8013e4:	53                   	push   %ebx
+  8013e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013eb:	8b 75 10             	mov    0x10(%ebp),%esi
+  8013ee:	85 f6                	test   %esi,%esi
+  8013f0:	74 29                	je     80141b <memcmp+0x3b>
+  8013f2:	01 c6                	add    %eax,%esi
+  8013f4:	0f b6 08             	movzbl (%eax),%ecx
+  8013f7:	0f b6 1a             	movzbl (%edx),%ebx
+  8013fa:	38 d9                	cmp    %bl,%cl
+  8013fc:	75 11                	jne    80140f <memcmp+0x2f>
+  8013fe:	83 c0 01             	add    $0x1,%eax
+  801401:	83 c2 01             	add    $0x1,%edx
+  801404:	39 c6                	cmp    %eax,%esi
+  801406:	75 ec                	jne    8013f4 <memcmp+0x14>
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140d:	eb 08                	jmp    801417 <memcmp+0x37>
+  80140f:	0f b6 c1             	movzbl %cl,%eax
+  801412:	0f b6 db             	movzbl %bl,%ebx
+  801415:	29 d8                	sub    %ebx,%eax
+  801417:	5b                   	pop    %ebx
+  801418:	5e                   	pop    %esi
+  801419:	5d                   	pop    %ebp
+  80141a:	c3                   	ret
+  80141b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801420:	eb f5                	jmp    801417 <memcmp+0x37>
+
+00801422 <memfind>:
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	8b 45 08             	mov    0x8(%ebp),%eax
+  801428:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142b:	89 c2                	mov    %eax,%edx
+  80142d:	03 55 10             	add    0x10(%ebp),%edx
+  801430:	39 d0                	cmp    %edx,%eax
+  801432:	73 0d                	jae    801441 <memfind+0x1f>
+  801434:	38 08                	cmp    %cl,(%eax)
+  801436:	74 0d                	je     801445 <memfind+0x23>
+  801438:	83 c0 01             	add    $0x1,%eax
+  80143b:	39 c2                	cmp    %eax,%edx
+  80143d:	75 f5                	jne    801434 <memfind+0x12>
+  80143f:	eb 06                	jmp    801447 <memfind+0x25>
+  801441:	89 c2                	mov    %eax,%edx
+  801443:	eb 02                	jmp    801447 <memfind+0x25>
+  801445:	89 c2                	mov    %eax,%edx
+  801447:	89 d0                	mov    %edx,%eax
+  801449:	5d                   	pop    %ebp
+  80144a:	c3                   	ret
+
+0080144b <strtol>:
+  80144b:	55                   	push   %ebp
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	57                   	push   %edi
+  80144f:	56                   	push   %esi
+  801450:	53                   	push   %ebx
+  801451:	8b 55 08             	mov    0x8(%ebp),%edx
+  801454:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801457:	0f b6 02             	movzbl (%edx),%eax
+  80145a:	3c 20                	cmp    $0x20,%al
+  80145c:	74 04                	je     801462 <strtol+0x17>
+  80145e:	3c 09                	cmp    $0x9,%al
+  801460:	75 0e                	jne    801470 <strtol+0x25>
+  801462:	83 c2 01             	add    $0x1,%edx
+  801465:	0f b6 02             	movzbl (%edx),%eax
+  801468:	3c 20                	cmp    $0x20,%al
+  80146a:	74 f6                	je     801462 <strtol+0x17>
+  80146c:	3c 09                	cmp    $0x9,%al
+  80146e:	74 f2                	je     801462 <strtol+0x17>
+  801470:	3c 2b                	cmp    $0x2b,%al
+  801472:	74 2a                	je     80149e <strtol+0x53>
+  801474:	bf 00 00 00 00       	mov    $0x0,%edi
+  801479:	3c 2d                	cmp    $0x2d,%al
+  80147b:	74 2b                	je     8014a8 <strtol+0x5d>
+  80147d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801483:	75 0f                	jne    801494 <strtol+0x49>
+  801485:	80 3a 30             	cmpb   $0x30,(%edx)
+  801488:	74 28                	je     8014b2 <strtol+0x67>
+  80148a:	85 db                	test   %ebx,%ebx
+  80148c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801491:	0f 44 d8             	cmove  %eax,%ebx
+  801494:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801499:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80149c:	eb 46                	jmp    8014e4 <strtol+0x99>
+  80149e:	83 c2 01             	add    $0x1,%edx
+  8014a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a6:	eb d5                	jmp    80147d <strtol+0x32>
+  8014a8:	83 c2 01             	add    $0x1,%edx
+  8014ab:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014b0:	eb cb                	jmp    80147d <strtol+0x32>
+  8014b2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8014b6:	74 0e                	je     8014c6 <strtol+0x7b>
+  8014b8:	85 db                	test   %ebx,%ebx
+  8014ba:	75 d8                	jne    801494 <strtol+0x49>
+  8014bc:	83 c2 01             	add    $0x1,%edx
+  8014bf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8014c4:	eb ce                	jmp    801494 <strtol+0x49>
+  8014c6:	83 c2 02             	add    $0x2,%edx
+  8014c9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8014ce:	eb c4                	jmp    801494 <strtol+0x49>
+  8014d0:	0f be c0             	movsbl %al,%eax
+  8014d3:	83 e8 30             	sub    $0x30,%eax
+  8014d6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8014d9:	7d 3a                	jge    801515 <strtol+0xca>
+  8014db:	83 c2 01             	add    $0x1,%edx
+  8014de:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8014e2:	01 c1                	add    %eax,%ecx
+  8014e4:	0f b6 02             	movzbl (%edx),%eax
+  8014e7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8014ea:	89 f3                	mov    %esi,%ebx
+  8014ec:	80 fb 09             	cmp    $0x9,%bl
+  8014ef:	76 df                	jbe    8014d0 <strtol+0x85>
+  8014f1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8014f4:	89 f3                	mov    %esi,%ebx
+  8014f6:	80 fb 19             	cmp    $0x19,%bl
+  8014f9:	77 08                	ja     801503 <strtol+0xb8>
+  8014fb:	0f be c0             	movsbl %al,%eax
+  8014fe:	83 e8 57             	sub    $0x57,%eax
+  801501:	eb d3                	jmp    8014d6 <strtol+0x8b>
+  801503:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801506:	89 f3                	mov    %esi,%ebx
+  801508:	80 fb 19             	cmp    $0x19,%bl
+  80150b:	77 08                	ja     801515 <strtol+0xca>
+  80150d:	0f be c0             	movsbl %al,%eax
+  801510:	83 e8 37             	sub    $0x37,%eax
+  801513:	eb c1                	jmp    8014d6 <strtol+0x8b>
+  801515:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801519:	74 05                	je     801520 <strtol+0xd5>
+  80151b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80151e:	89 10                	mov    %edx,(%eax)
+  801520:	89 c8                	mov    %ecx,%eax
+  801522:	f7 d8                	neg    %eax
+  801524:	85 ff                	test   %edi,%edi
+  801526:	0f 45 c8             	cmovne %eax,%ecx
+  801529:	89 c8                	mov    %ecx,%eax
+  80152b:	5b                   	pop    %ebx
+  80152c:	5e                   	pop    %esi
+  80152d:	5f                   	pop    %edi
+  80152e:	5d                   	pop    %ebp
+  80152f:	c3                   	ret
+
+00801530 <sys_cputs>:
+  801530:	55                   	push   %ebp
+  801531:	89 e5                	mov    %esp,%ebp
+  801533:	57                   	push   %edi
+  801534:	56                   	push   %esi
+  801535:	53                   	push   %ebx
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801541:	89 c3                	mov    %eax,%ebx
+  801543:	89 c7                	mov    %eax,%edi
+  801545:	89 c6                	mov    %eax,%esi
+  801547:	cd 30                	int    $0x30
+  801549:	5b                   	pop    %ebx
+  80154a:	5e                   	pop    %esi
+  80154b:	5f                   	pop    %edi
+  80154c:	5d                   	pop    %ebp
+  80154d:	c3                   	ret
+
+0080154e <sys_cgetc>:
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	57                   	push   %edi
+  801552:	56                   	push   %esi
+  801553:	53                   	push   %ebx
+  801554:	ba 00 00 00 00       	mov    $0x0,%edx
+  801559:	b8 01 00 00 00       	mov    $0x1,%eax
+  80155e:	89 d1                	mov    %edx,%ecx
+  801560:	89 d3                	mov    %edx,%ebx
+  801562:	89 d7                	mov    %edx,%edi
+  801564:	89 d6                	mov    %edx,%esi
+  801566:	cd 30                	int    $0x30
+  801568:	5b                   	pop    %ebx
+  801569:	5e                   	pop    %esi
+  80156a:	5f                   	pop    %edi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+
+0080156d <sys_env_destroy>:
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	57                   	push   %edi
+  801571:	56                   	push   %esi
+  801572:	53                   	push   %ebx
+  801573:	83 ec 0c             	sub    $0xc,%esp
+  801576:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801583:	89 cb                	mov    %ecx,%ebx
+  801585:	89 cf                	mov    %ecx,%edi
+  801587:	89 ce                	mov    %ecx,%esi
+  801589:	cd 30                	int    $0x30
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	7f 08                	jg     801597 <sys_env_destroy+0x2a>
+  80158f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801592:	5b                   	pop    %ebx
+  801593:	5e                   	pop    %esi
+  801594:	5f                   	pop    %edi
+  801595:	5d                   	pop    %ebp
+  801596:	c3                   	ret
+  801597:	83 ec 0c             	sub    $0xc,%esp
+  80159a:	50                   	push   %eax
+  80159b:	6a 03                	push   $0x3
+  80159d:	68 0b 46 80 00       	push   $0x80460b
+  8015a2:	6a 24                	push   $0x24
+  8015a4:	68 28 46 80 00       	push   $0x804628
+  8015a9:	e8 38 f4 ff ff       	call   8009e6 <_panic>
+
+008015ae <sys_getenvid>:
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	57                   	push   %edi
+  8015b2:	56                   	push   %esi
+  8015b3:	53                   	push   %ebx
+  8015b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015be:	89 d1                	mov    %edx,%ecx
+  8015c0:	89 d3                	mov    %edx,%ebx
+  8015c2:	89 d7                	mov    %edx,%edi
+  8015c4:	89 d6                	mov    %edx,%esi
+  8015c6:	cd 30                	int    $0x30
+  8015c8:	5b                   	pop    %ebx
+  8015c9:	5e                   	pop    %esi
+  8015ca:	5f                   	pop    %edi
+  8015cb:	5d                   	pop    %ebp
+  8015cc:	c3                   	ret
+
+008015cd <sys_yield>:
+  8015cd:	55                   	push   %ebp
+  8015ce:	89 e5                	mov    %esp,%ebp
+  8015d0:	57                   	push   %edi
+  8015d1:	56                   	push   %esi
+  8015d2:	53                   	push   %ebx
+  8015d3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8015da:	74 26                	je     801602 <sys_yield+0x35>
+  8015dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015e6:	89 d1                	mov    %edx,%ecx
+  8015e8:	89 d3                	mov    %edx,%ebx
+  8015ea:	89 d7                	mov    %edx,%edi
+  8015ec:	6a 00                	push   $0x0
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	8d 35 f9 15 80 00    	lea    0x8015f9,%esi
+  8015f7:	0f 34                	sysenter
+  8015f9:	5d                   	pop    %ebp
+  8015fa:	83 c4 04             	add    $0x4,%esp
+  8015fd:	5b                   	pop    %ebx
+  8015fe:	5e                   	pop    %esi
+  8015ff:	5f                   	pop    %edi
+  801600:	5d                   	pop    %ebp
+  801601:	c3                   	ret
+  801602:	ba 00 00 00 00       	mov    $0x0,%edx
+  801607:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80160c:	89 d1                	mov    %edx,%ecx
+  80160e:	89 d3                	mov    %edx,%ebx
+  801610:	89 d7                	mov    %edx,%edi
+  801612:	89 d6                	mov    %edx,%esi
+  801614:	cd 30                	int    $0x30
+  801616:	eb e5                	jmp    8015fd <sys_yield+0x30>
+
+00801618 <sys_page_alloc>:
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	57                   	push   %edi
+  80161c:	56                   	push   %esi
+  80161d:	53                   	push   %ebx
+  80161e:	83 ec 0c             	sub    $0xc,%esp
+  801621:	be 00 00 00 00       	mov    $0x0,%esi
+  801626:	8b 55 08             	mov    0x8(%ebp),%edx
+  801629:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801631:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801634:	89 f7                	mov    %esi,%edi
+  801636:	cd 30                	int    $0x30
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	7f 08                	jg     801644 <sys_page_alloc+0x2c>
+  80163c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163f:	5b                   	pop    %ebx
+  801640:	5e                   	pop    %esi
+  801641:	5f                   	pop    %edi
+  801642:	5d                   	pop    %ebp
+  801643:	c3                   	ret
+  801644:	83 ec 0c             	sub    $0xc,%esp
+  801647:	50                   	push   %eax
+  801648:	6a 04                	push   $0x4
+  80164a:	68 0b 46 80 00       	push   $0x80460b
+  80164f:	6a 24                	push   $0x24
+  801651:	68 28 46 80 00       	push   $0x804628
+  801656:	e8 8b f3 ff ff       	call   8009e6 <_panic>
+
+0080165b <sys_page_map>:
+  80165b:	55                   	push   %ebp
+  80165c:	89 e5                	mov    %esp,%ebp
+  80165e:	57                   	push   %edi
+  80165f:	56                   	push   %esi
+  801660:	53                   	push   %ebx
+  801661:	83 ec 0c             	sub    $0xc,%esp
+  801664:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80166b:	74 33                	je     8016a0 <sys_page_map+0x45>
+  80166d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801670:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801673:	b8 05 00 00 00       	mov    $0x5,%eax
+  801678:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80167b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80167e:	ff 75 18             	push   0x18(%ebp)
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	8d 35 8c 16 80 00    	lea    0x80168c,%esi
+  80168a:	0f 34                	sysenter
+  80168c:	5d                   	pop    %ebp
+  80168d:	83 c4 04             	add    $0x4,%esp
+  801690:	89 c2                	mov    %eax,%edx
+  801692:	85 c0                	test   %eax,%eax
+  801694:	7f 3d                	jg     8016d3 <sys_page_map+0x78>
+  801696:	89 d0                	mov    %edx,%eax
+  801698:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169b:	5b                   	pop    %ebx
+  80169c:	5e                   	pop    %esi
+  80169d:	5f                   	pop    %edi
+  80169e:	5d                   	pop    %ebp
+  80169f:	c3                   	ret
+  8016a0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016b1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016b4:	cd 30                	int    $0x30
+  8016b6:	89 c2                	mov    %eax,%edx
+  8016b8:	85 c0                	test   %eax,%eax
+  8016ba:	7e da                	jle    801696 <sys_page_map+0x3b>
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+  8016bf:	50                   	push   %eax
+  8016c0:	6a 05                	push   $0x5
+  8016c2:	68 0b 46 80 00       	push   $0x80460b
+  8016c7:	6a 24                	push   $0x24
+  8016c9:	68 28 46 80 00       	push   $0x804628
+  8016ce:	e8 13 f3 ff ff       	call   8009e6 <_panic>
+  8016d3:	83 ec 0c             	sub    $0xc,%esp
+  8016d6:	50                   	push   %eax
+  8016d7:	6a 05                	push   $0x5
+  8016d9:	68 0b 46 80 00       	push   $0x80460b
+  8016de:	6a 48                	push   $0x48
+  8016e0:	68 28 46 80 00       	push   $0x804628
+  8016e5:	e8 fc f2 ff ff       	call   8009e6 <_panic>
+
+008016ea <sys_page_unmap>:
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	57                   	push   %edi
+  8016ee:	56                   	push   %esi
+  8016ef:	53                   	push   %ebx
+  8016f0:	83 ec 0c             	sub    $0xc,%esp
+  8016f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fe:	b8 06 00 00 00       	mov    $0x6,%eax
+  801703:	89 df                	mov    %ebx,%edi
+  801705:	89 de                	mov    %ebx,%esi
+  801707:	cd 30                	int    $0x30
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	7f 08                	jg     801715 <sys_page_unmap+0x2b>
+  80170d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801710:	5b                   	pop    %ebx
+  801711:	5e                   	pop    %esi
+  801712:	5f                   	pop    %edi
+  801713:	5d                   	pop    %ebp
+  801714:	c3                   	ret
+  801715:	83 ec 0c             	sub    $0xc,%esp
+  801718:	50                   	push   %eax
+  801719:	6a 06                	push   $0x6
+  80171b:	68 0b 46 80 00       	push   $0x80460b
+  801720:	6a 24                	push   $0x24
+  801722:	68 28 46 80 00       	push   $0x804628
+  801727:	e8 ba f2 ff ff       	call   8009e6 <_panic>
+
+0080172c <sys_fork>:
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	57                   	push   %edi
+  801730:	56                   	push   %esi
+  801731:	53                   	push   %ebx
+  801732:	ba 00 00 00 00       	mov    $0x0,%edx
+  801737:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80173c:	89 d1                	mov    %edx,%ecx
+  80173e:	89 d3                	mov    %edx,%ebx
+  801740:	89 d7                	mov    %edx,%edi
+  801742:	89 d6                	mov    %edx,%esi
+  801744:	cd 30                	int    $0x30
+  801746:	5b                   	pop    %ebx
+  801747:	5e                   	pop    %esi
+  801748:	5f                   	pop    %edi
+  801749:	5d                   	pop    %ebp
+  80174a:	c3                   	ret
+
+0080174b <sys_env_set_status>:
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	57                   	push   %edi
+  80174f:	56                   	push   %esi
+  801750:	53                   	push   %ebx
+  801751:	83 ec 0c             	sub    $0xc,%esp
+  801754:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801759:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801764:	89 df                	mov    %ebx,%edi
+  801766:	89 de                	mov    %ebx,%esi
+  801768:	cd 30                	int    $0x30
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	7f 08                	jg     801776 <sys_env_set_status+0x2b>
+  80176e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801771:	5b                   	pop    %ebx
+  801772:	5e                   	pop    %esi
+  801773:	5f                   	pop    %edi
+  801774:	5d                   	pop    %ebp
+  801775:	c3                   	ret
+  801776:	83 ec 0c             	sub    $0xc,%esp
+  801779:	50                   	push   %eax
+  80177a:	6a 08                	push   $0x8
+  80177c:	68 0b 46 80 00       	push   $0x80460b
+  801781:	6a 24                	push   $0x24
+  801783:	68 28 46 80 00       	push   $0x804628
+  801788:	e8 59 f2 ff ff       	call   8009e6 <_panic>
+
+0080178d <sys_env_set_trapframe>:
+  80178d:	55                   	push   %ebp
+  80178e:	89 e5                	mov    %esp,%ebp
+  801790:	57                   	push   %edi
+  801791:	56                   	push   %esi
+  801792:	53                   	push   %ebx
+  801793:	83 ec 0c             	sub    $0xc,%esp
+  801796:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017a6:	89 df                	mov    %ebx,%edi
+  8017a8:	89 de                	mov    %ebx,%esi
+  8017aa:	cd 30                	int    $0x30
+  8017ac:	85 c0                	test   %eax,%eax
+  8017ae:	7f 08                	jg     8017b8 <sys_env_set_trapframe+0x2b>
+  8017b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b3:	5b                   	pop    %ebx
+  8017b4:	5e                   	pop    %esi
+  8017b5:	5f                   	pop    %edi
+  8017b6:	5d                   	pop    %ebp
+  8017b7:	c3                   	ret
+  8017b8:	83 ec 0c             	sub    $0xc,%esp
+  8017bb:	50                   	push   %eax
+  8017bc:	6a 09                	push   $0x9
+  8017be:	68 0b 46 80 00       	push   $0x80460b
+  8017c3:	6a 24                	push   $0x24
+  8017c5:	68 28 46 80 00       	push   $0x804628
+  8017ca:	e8 17 f2 ff ff       	call   8009e6 <_panic>
+
+008017cf <sys_env_set_cow>:
+  8017cf:	55                   	push   %ebp
+  8017d0:	89 e5                	mov    %esp,%ebp
+  8017d2:	57                   	push   %edi
+  8017d3:	56                   	push   %esi
+  8017d4:	53                   	push   %ebx
+  8017d5:	83 ec 0c             	sub    $0xc,%esp
+  8017d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8017e8:	89 df                	mov    %ebx,%edi
+  8017ea:	89 de                	mov    %ebx,%esi
+  8017ec:	cd 30                	int    $0x30
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	7f 08                	jg     8017fa <sys_env_set_cow+0x2b>
+  8017f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f5:	5b                   	pop    %ebx
+  8017f6:	5e                   	pop    %esi
+  8017f7:	5f                   	pop    %edi
+  8017f8:	5d                   	pop    %ebp
+  8017f9:	c3                   	ret
+  8017fa:	83 ec 0c             	sub    $0xc,%esp
+  8017fd:	50                   	push   %eax
+  8017fe:	6a 20                	push   $0x20
+  801800:	68 0b 46 80 00       	push   $0x80460b
+  801805:	6a 24                	push   $0x24
+  801807:	68 28 46 80 00       	push   $0x804628
+  80180c:	e8 d5 f1 ff ff       	call   8009e6 <_panic>
+
+00801811 <sys_env_service>:
+  801811:	55                   	push   %ebp
+  801812:	89 e5                	mov    %esp,%ebp
+  801814:	57                   	push   %edi
+  801815:	56                   	push   %esi
+  801816:	53                   	push   %ebx
+  801817:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80181c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181f:	b8 21 00 00 00       	mov    $0x21,%eax
+  801824:	89 cb                	mov    %ecx,%ebx
+  801826:	89 cf                	mov    %ecx,%edi
+  801828:	89 ce                	mov    %ecx,%esi
+  80182a:	cd 30                	int    $0x30
+  80182c:	5b                   	pop    %ebx
+  80182d:	5e                   	pop    %esi
+  80182e:	5f                   	pop    %edi
+  80182f:	5d                   	pop    %ebp
+  801830:	c3                   	ret
+
+00801831 <sys_env_set_pgfault_upcall>:
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	57                   	push   %edi
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+  801837:	83 ec 0c             	sub    $0xc,%esp
+  80183a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801842:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801845:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80184a:	89 df                	mov    %ebx,%edi
+  80184c:	89 de                	mov    %ebx,%esi
+  80184e:	cd 30                	int    $0x30
+  801850:	85 c0                	test   %eax,%eax
+  801852:	7f 08                	jg     80185c <sys_env_set_pgfault_upcall+0x2b>
+  801854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801857:	5b                   	pop    %ebx
+  801858:	5e                   	pop    %esi
+  801859:	5f                   	pop    %edi
+  80185a:	5d                   	pop    %ebp
+  80185b:	c3                   	ret
+  80185c:	83 ec 0c             	sub    $0xc,%esp
+  80185f:	50                   	push   %eax
+  801860:	6a 0a                	push   $0xa
+  801862:	68 0b 46 80 00       	push   $0x80460b
+  801867:	6a 24                	push   $0x24
+  801869:	68 28 46 80 00       	push   $0x804628
+  80186e:	e8 73 f1 ff ff       	call   8009e6 <_panic>
+
+00801873 <sys_ipc_try_send>:
+  801873:	55                   	push   %ebp
+  801874:	89 e5                	mov    %esp,%ebp
+  801876:	57                   	push   %edi
+  801877:	56                   	push   %esi
+  801878:	53                   	push   %ebx
+  801879:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801880:	74 27                	je     8018a9 <sys_ipc_try_send+0x36>
+  801882:	8b 55 08             	mov    0x8(%ebp),%edx
+  801885:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801888:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80188d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801890:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801893:	6a 00                	push   $0x0
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	8d 35 a0 18 80 00    	lea    0x8018a0,%esi
+  80189e:	0f 34                	sysenter
+  8018a0:	5d                   	pop    %ebp
+  8018a1:	83 c4 04             	add    $0x4,%esp
+  8018a4:	5b                   	pop    %ebx
+  8018a5:	5e                   	pop    %esi
+  8018a6:	5f                   	pop    %edi
+  8018a7:	5d                   	pop    %ebp
+  8018a8:	c3                   	ret
+  8018a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018bf:	cd 30                	int    $0x30
+  8018c1:	eb e1                	jmp    8018a4 <sys_ipc_try_send+0x31>
+
+008018c3 <sys_ipc_recv>:
+  8018c3:	55                   	push   %ebp
+  8018c4:	89 e5                	mov    %esp,%ebp
+  8018c6:	57                   	push   %edi
+  8018c7:	56                   	push   %esi
+  8018c8:	53                   	push   %ebx
+  8018c9:	83 ec 0c             	sub    $0xc,%esp
+  8018cc:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8018d3:	74 32                	je     801907 <sys_ipc_recv+0x44>
+  8018d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018dd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018e2:	89 cb                	mov    %ecx,%ebx
+  8018e4:	89 cf                	mov    %ecx,%edi
+  8018e6:	6a 00                	push   $0x0
+  8018e8:	55                   	push   %ebp
+  8018e9:	89 e5                	mov    %esp,%ebp
+  8018eb:	8d 35 f3 18 80 00    	lea    0x8018f3,%esi
+  8018f1:	0f 34                	sysenter
+  8018f3:	5d                   	pop    %ebp
+  8018f4:	83 c4 04             	add    $0x4,%esp
+  8018f7:	89 c2                	mov    %eax,%edx
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	7f 3c                	jg     801939 <sys_ipc_recv+0x76>
+  8018fd:	89 d0                	mov    %edx,%eax
+  8018ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801902:	5b                   	pop    %ebx
+  801903:	5e                   	pop    %esi
+  801904:	5f                   	pop    %edi
+  801905:	5d                   	pop    %ebp
+  801906:	c3                   	ret
+  801907:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80190c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801911:	8b 55 08             	mov    0x8(%ebp),%edx
+  801914:	89 cb                	mov    %ecx,%ebx
+  801916:	89 cf                	mov    %ecx,%edi
+  801918:	89 ce                	mov    %ecx,%esi
+  80191a:	cd 30                	int    $0x30
+  80191c:	89 c2                	mov    %eax,%edx
+  80191e:	85 c0                	test   %eax,%eax
+  801920:	7e db                	jle    8018fd <sys_ipc_recv+0x3a>
+  801922:	83 ec 0c             	sub    $0xc,%esp
+  801925:	50                   	push   %eax
+  801926:	6a 0d                	push   $0xd
+  801928:	68 0b 46 80 00       	push   $0x80460b
+  80192d:	6a 24                	push   $0x24
+  80192f:	68 28 46 80 00       	push   $0x804628
+  801934:	e8 ad f0 ff ff       	call   8009e6 <_panic>
+  801939:	83 ec 0c             	sub    $0xc,%esp
+  80193c:	50                   	push   %eax
+  80193d:	6a 0d                	push   $0xd
+  80193f:	68 0b 46 80 00       	push   $0x80460b
+  801944:	6a 48                	push   $0x48
+  801946:	68 28 46 80 00       	push   $0x804628
+  80194b:	e8 96 f0 ff ff       	call   8009e6 <_panic>
+
+00801950 <sys_ipc_send>:
+  801950:	55                   	push   %ebp
+  801951:	89 e5                	mov    %esp,%ebp
+  801953:	57                   	push   %edi
+  801954:	56                   	push   %esi
+  801955:	53                   	push   %ebx
+  801956:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80195d:	74 27                	je     801986 <sys_ipc_send+0x36>
+  80195f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801962:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801965:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80196a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80196d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801970:	6a 00                	push   $0x0
+  801972:	55                   	push   %ebp
+  801973:	89 e5                	mov    %esp,%ebp
+  801975:	8d 35 7d 19 80 00    	lea    0x80197d,%esi
+  80197b:	0f 34                	sysenter
+  80197d:	5d                   	pop    %ebp
+  80197e:	83 c4 04             	add    $0x4,%esp
+  801981:	5b                   	pop    %ebx
+  801982:	5e                   	pop    %esi
+  801983:	5f                   	pop    %edi
+  801984:	5d                   	pop    %ebp
+  801985:	c3                   	ret
+  801986:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80198b:	be 00 00 00 00       	mov    $0x0,%esi
+  801990:	8b 55 08             	mov    0x8(%ebp),%edx
+  801993:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801996:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801999:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80199c:	cd 30                	int    $0x30
+  80199e:	eb e1                	jmp    801981 <sys_ipc_send+0x31>
+
+008019a0 <sys_ipc_call>:
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	57                   	push   %edi
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+  8019a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8019b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019b7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019ba:	cd 30                	int    $0x30
+  8019bc:	5b                   	pop    %ebx
+  8019bd:	5e                   	pop    %esi
+  8019be:	5f                   	pop    %edi
+  8019bf:	5d                   	pop    %ebp
+  8019c0:	c3                   	ret
+
+008019c1 <sys_ipc_reply_recv>:
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	57                   	push   %edi
+  8019c5:	56                   	push   %esi
+  8019c6:	53                   	push   %ebx
+  8019c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019cd:	b8 10 00 00 00       	mov    $0x10,%eax
+  8019d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019d5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019d8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8019db:	cd 30                	int    $0x30
+  8019dd:	5b                   	pop    %ebx
+  8019de:	5e                   	pop    %esi
+  8019df:	5f                   	pop    %edi
+  8019e0:	5d                   	pop    %ebp
+  8019e1:	c3                   	ret
+
+008019e2 <sys_time_msec>:
+  8019e2:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8019e7:	85 c0                	test   %eax,%eax
+  8019e9:	75 06                	jne    8019f1 <sys_time_msec+0xf>
+  8019eb:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8019f0:	c3                   	ret
+  8019f1:	55                   	push   %ebp
+  8019f2:	89 e5                	mov    %esp,%ebp
+  8019f4:	57                   	push   %edi
+  8019f5:	56                   	push   %esi
+  8019f6:	53                   	push   %ebx
+  8019f7:	83 ec 0c             	sub    $0xc,%esp
+  8019fa:	0f 31                	rdtsc
+  8019fc:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801a02:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801a08:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801a0e:	29 c8                	sub    %ecx,%eax
+  801a10:	19 da                	sbb    %ebx,%edx
+  801a12:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a17:	57                   	push   %edi
+  801a18:	56                   	push   %esi
+  801a19:	52                   	push   %edx
+  801a1a:	50                   	push   %eax
+  801a1b:	e8 13 23 00 00       	call   803d33 <__udivdi3>
+  801a20:	83 c4 10             	add    $0x10,%esp
+  801a23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a26:	5b                   	pop    %ebx
+  801a27:	5e                   	pop    %esi
+  801a28:	5f                   	pop    %edi
+  801a29:	5d                   	pop    %ebp
+  801a2a:	c3                   	ret
+
+00801a2b <sys_env_swap>:
+  801a2b:	55                   	push   %ebp
+  801a2c:	89 e5                	mov    %esp,%ebp
+  801a2e:	57                   	push   %edi
+  801a2f:	56                   	push   %esi
+  801a30:	53                   	push   %ebx
+  801a31:	83 ec 0c             	sub    $0xc,%esp
+  801a34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801a41:	89 cb                	mov    %ecx,%ebx
+  801a43:	89 cf                	mov    %ecx,%edi
+  801a45:	89 ce                	mov    %ecx,%esi
+  801a47:	cd 30                	int    $0x30
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	7f 08                	jg     801a55 <sys_env_swap+0x2a>
+  801a4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a50:	5b                   	pop    %ebx
+  801a51:	5e                   	pop    %esi
+  801a52:	5f                   	pop    %edi
+  801a53:	5d                   	pop    %ebp
+  801a54:	c3                   	ret
+  801a55:	83 ec 0c             	sub    $0xc,%esp
+  801a58:	50                   	push   %eax
+  801a59:	6a 12                	push   $0x12
+  801a5b:	68 0b 46 80 00       	push   $0x80460b
+  801a60:	6a 24                	push   $0x24
+  801a62:	68 28 46 80 00       	push   $0x804628
+  801a67:	e8 7a ef ff ff       	call   8009e6 <_panic>
+
+00801a6c <sys_net_try_send>:
+  801a6c:	55                   	push   %ebp
+  801a6d:	89 e5                	mov    %esp,%ebp
+  801a6f:	57                   	push   %edi
+  801a70:	56                   	push   %esi
+  801a71:	53                   	push   %ebx
+  801a72:	83 ec 0c             	sub    $0xc,%esp
+  801a75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a80:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a85:	89 df                	mov    %ebx,%edi
+  801a87:	89 de                	mov    %ebx,%esi
+  801a89:	cd 30                	int    $0x30
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	7f 08                	jg     801a97 <sys_net_try_send+0x2b>
+  801a8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a92:	5b                   	pop    %ebx
+  801a93:	5e                   	pop    %esi
+  801a94:	5f                   	pop    %edi
+  801a95:	5d                   	pop    %ebp
+  801a96:	c3                   	ret
+  801a97:	83 ec 0c             	sub    $0xc,%esp
+  801a9a:	50                   	push   %eax
+  801a9b:	6a 13                	push   $0x13
+  801a9d:	68 0b 46 80 00       	push   $0x80460b
+  801aa2:	6a 24                	push   $0x24
+  801aa4:	68 28 46 80 00       	push   $0x804628
+  801aa9:	e8 38 ef ff ff       	call   8009e6 <_panic>
+
+00801aae <sys_net_try_receive>:
+  801aae:	55                   	push   %ebp
+  801aaf:	89 e5                	mov    %esp,%ebp
+  801ab1:	57                   	push   %edi
+  801ab2:	56                   	push   %esi
+  801ab3:	53                   	push   %ebx
+  801ab4:	83 ec 0c             	sub    $0xc,%esp
+  801ab7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801abc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801abf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ac2:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ac7:	89 df                	mov    %ebx,%edi
+  801ac9:	89 de                	mov    %ebx,%esi
+  801acb:	cd 30                	int    $0x30
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	7f 08                	jg     801ad9 <sys_net_try_receive+0x2b>
+  801ad1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad4:	5b                   	pop    %ebx
+  801ad5:	5e                   	pop    %esi
+  801ad6:	5f                   	pop    %edi
+  801ad7:	5d                   	pop    %ebp
+  801ad8:	c3                   	ret
+  801ad9:	83 ec 0c             	sub    $0xc,%esp
+  801adc:	50                   	push   %eax
+  801add:	6a 14                	push   $0x14
+  801adf:	68 0b 46 80 00       	push   $0x80460b
+  801ae4:	6a 24                	push   $0x24
+  801ae6:	68 28 46 80 00       	push   $0x804628
+  801aeb:	e8 f6 ee ff ff       	call   8009e6 <_panic>
+
+00801af0 <sys_net_recv_page>:
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	57                   	push   %edi
+  801af4:	56                   	push   %esi
+  801af5:	53                   	push   %ebx
+  801af6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801afb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afe:	b8 27 00 00 00       	mov    $0x27,%eax
+  801b03:	89 cb                	mov    %ecx,%ebx
+  801b05:	89 cf                	mov    %ecx,%edi
+  801b07:	89 ce                	mov    %ecx,%esi
+  801b09:	cd 30                	int    $0x30
+  801b0b:	5b                   	pop    %ebx
+  801b0c:	5e                   	pop    %esi
+  801b0d:	5f                   	pop    %edi
+  801b0e:	5d                   	pop    %ebp
+  801b0f:	c3                   	ret
+
+00801b10 <sys_net_wait>:
+  801b10:	55                   	push   %ebp
+  801b11:	89 e5                	mov    %esp,%ebp
+  801b13:	57                   	push   %edi
+  801b14:	56                   	push   %esi
+  801b15:	53                   	push   %ebx
+  801b16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1b:	b8 26 00 00 00       	mov    $0x26,%eax
+  801b20:	89 d1                	mov    %edx,%ecx
+  801b22:	89 d3                	mov    %edx,%ebx
+  801b24:	89 d7                	mov    %edx,%edi
+  801b26:	89 d6                	mov    %edx,%esi
+  801b28:	cd 30                	int    $0x30
+  801b2a:	5b                   	pop    %ebx
+  801b2b:	5e                   	pop    %esi
+  801b2c:	5f                   	pop    %edi
+  801b2d:	5d                   	pop    %ebp
+  801b2e:	c3                   	ret
+
+00801b2f <sys_get_mac>:
+  801b2f:	55                   	push   %ebp
+  801b30:	89 e5                	mov    %esp,%ebp
+  801b32:	57                   	push   %edi
+  801b33:	56                   	push   %esi
+  801b34:	53                   	push   %ebx
+  801b35:	83 ec 0c             	sub    $0xc,%esp
+  801b38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b43:	b8 15 00 00 00       	mov    $0x15,%eax
+  801b48:	89 df                	mov    %ebx,%edi
+  801b4a:	89 de                	mov    %ebx,%esi
+  801b4c:	cd 30                	int    $0x30
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	7f 08                	jg     801b5a <sys_get_mac+0x2b>
+  801b52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5f                   	pop    %edi
+  801b58:	5d                   	pop    %ebp
+  801b59:	c3                   	ret
+  801b5a:	83 ec 0c             	sub    $0xc,%esp
+  801b5d:	50                   	push   %eax
+  801b5e:	6a 15                	push   $0x15
+  801b60:	68 0b 46 80 00       	push   $0x80460b
+  801b65:	6a 24                	push   $0x24
+  801b67:	68 28 46 80 00       	push   $0x804628
+  801b6c:	e8 75 ee ff ff       	call   8009e6 <_panic>
+
+00801b71 <sys_env_lease>:
+  801b71:	55                   	push   %ebp
+  801b72:	89 e5                	mov    %esp,%ebp
+  801b74:	57                   	push   %edi
+  801b75:	56                   	push   %esi
+  801b76:	53                   	push   %ebx
+  801b77:	83 ec 0c             	sub    $0xc,%esp
+  801b7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b85:	b8 16 00 00 00       	mov    $0x16,%eax
+  801b8a:	89 df                	mov    %ebx,%edi
+  801b8c:	89 de                	mov    %ebx,%esi
+  801b8e:	cd 30                	int    $0x30
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	7f 08                	jg     801b9c <sys_env_lease+0x2b>
+  801b94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b97:	5b                   	pop    %ebx
+  801b98:	5e                   	pop    %esi
+  801b99:	5f                   	pop    %edi
+  801b9a:	5d                   	pop    %ebp
+  801b9b:	c3                   	ret
+  801b9c:	83 ec 0c             	sub    $0xc,%esp
+  801b9f:	50                   	push   %eax
+  801ba0:	6a 16                	push   $0x16
+  801ba2:	68 0b 46 80 00       	push   $0x80460b
+  801ba7:	6a 24                	push   $0x24
+  801ba9:	68 28 46 80 00       	push   $0x804628
+  801bae:	e8 33 ee ff ff       	call   8009e6 <_panic>
+
+00801bb3 <sys_copy_mem>:
+  801bb3:	55                   	push   %ebp
+  801bb4:	89 e5                	mov    %esp,%ebp
+  801bb6:	57                   	push   %edi
+  801bb7:	56                   	push   %esi
+  801bb8:	53                   	push   %ebx
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc2:	b8 17 00 00 00       	mov    $0x17,%eax
+  801bc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801bcd:	8b 75 18             	mov    0x18(%ebp),%esi
+  801bd0:	cd 30                	int    $0x30
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	7f 08                	jg     801bde <sys_copy_mem+0x2b>
+  801bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd9:	5b                   	pop    %ebx
+  801bda:	5e                   	pop    %esi
+  801bdb:	5f                   	pop    %edi
+  801bdc:	5d                   	pop    %ebp
+  801bdd:	c3                   	ret
+  801bde:	83 ec 0c             	sub    $0xc,%esp
+  801be1:	50                   	push   %eax
+  801be2:	6a 17                	push   $0x17
+  801be4:	68 0b 46 80 00       	push   $0x80460b
+  801be9:	6a 24                	push   $0x24
+  801beb:	68 28 46 80 00       	push   $0x804628
+  801bf0:	e8 f1 ed ff ff       	call   8009e6 <_panic>
+
+00801bf5 <sys_get_perms>:
+  801bf5:	55                   	push   %ebp
+  801bf6:	89 e5                	mov    %esp,%ebp
+  801bf8:	57                   	push   %edi
+  801bf9:	56                   	push   %esi
+  801bfa:	53                   	push   %ebx
+  801bfb:	83 ec 0c             	sub    $0xc,%esp
+  801bfe:	be 00 00 00 00       	mov    $0x0,%esi
+  801c03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c09:	b8 18 00 00 00       	mov    $0x18,%eax
+  801c0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c11:	89 f7                	mov    %esi,%edi
+  801c13:	cd 30                	int    $0x30
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	7f 08                	jg     801c21 <sys_get_perms+0x2c>
+  801c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1c:	5b                   	pop    %ebx
+  801c1d:	5e                   	pop    %esi
+  801c1e:	5f                   	pop    %edi
+  801c1f:	5d                   	pop    %ebp
+  801c20:	c3                   	ret
+  801c21:	83 ec 0c             	sub    $0xc,%esp
+  801c24:	50                   	push   %eax
+  801c25:	6a 18                	push   $0x18
+  801c27:	68 0b 46 80 00       	push   $0x80460b
+  801c2c:	6a 24                	push   $0x24
+  801c2e:	68 28 46 80 00       	push   $0x804628
+  801c33:	e8 ae ed ff ff       	call   8009e6 <_panic>
+
+00801c38 <sys_env_unsuspend>:
+  801c38:	55                   	push   %ebp
+  801c39:	89 e5                	mov    %esp,%ebp
+  801c3b:	57                   	push   %edi
+  801c3c:	56                   	push   %esi
+  801c3d:	53                   	push   %ebx
+  801c3e:	83 ec 0c             	sub    $0xc,%esp
+  801c41:	be 00 00 00 00       	mov    $0x0,%esi
+  801c46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c4c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801c51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c54:	89 f7                	mov    %esi,%edi
+  801c56:	cd 30                	int    $0x30
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	7f 08                	jg     801c64 <sys_env_unsuspend+0x2c>
+  801c5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5f:	5b                   	pop    %ebx
+  801c60:	5e                   	pop    %esi
+  801c61:	5f                   	pop    %edi
+  801c62:	5d                   	pop    %ebp
+  801c63:	c3                   	ret
+  801c64:	83 ec 0c             	sub    $0xc,%esp
+  801c67:	50                   	push   %eax
+  801c68:	6a 19                	push   $0x19
+  801c6a:	68 0b 46 80 00       	push   $0x80460b
+  801c6f:	6a 24                	push   $0x24
+  801c71:	68 28 46 80 00       	push   $0x804628
+  801c76:	e8 6b ed ff ff       	call   8009e6 <_panic>
+
+00801c7b <sys_migrate>:
+  801c7b:	55                   	push   %ebp
+  801c7c:	89 e5                	mov    %esp,%ebp
+  801c7e:	57                   	push   %edi
+  801c7f:	56                   	push   %esi
+  801c80:	53                   	push   %ebx
+  801c81:	83 ec 0c             	sub    $0xc,%esp
+  801c84:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801c89:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801c8f:	76 11                	jbe    801ca2 <sys_migrate+0x27>
+  801c91:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801c96:	0f b6 08             	movzbl (%eax),%ecx
+  801c99:	05 00 10 00 00       	add    $0x1000,%eax
+  801c9e:	39 d0                	cmp    %edx,%eax
+  801ca0:	72 f4                	jb     801c96 <sys_migrate+0x1b>
+  801ca2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ca7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801caa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801caf:	89 cb                	mov    %ecx,%ebx
+  801cb1:	89 cf                	mov    %ecx,%edi
+  801cb3:	89 ce                	mov    %ecx,%esi
+  801cb5:	cd 30                	int    $0x30
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	7f 08                	jg     801cc3 <sys_migrate+0x48>
+  801cbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbe:	5b                   	pop    %ebx
+  801cbf:	5e                   	pop    %esi
+  801cc0:	5f                   	pop    %edi
+  801cc1:	5d                   	pop    %ebp
+  801cc2:	c3                   	ret
+  801cc3:	83 ec 0c             	sub    $0xc,%esp
+  801cc6:	50                   	push   %eax
+  801cc7:	6a 1a                	push   $0x1a
+  801cc9:	68 0b 46 80 00       	push   $0x80460b
+  801cce:	6a 24                	push   $0x24
+  801cd0:	68 28 46 80 00       	push   $0x804628
+  801cd5:	e8 0c ed ff ff       	call   8009e6 <_panic>
+
+00801cda <sys_lease_complete>:
+  801cda:	55                   	push   %ebp
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	57                   	push   %edi
+  801cde:	56                   	push   %esi
+  801cdf:	53                   	push   %ebx
+  801ce0:	83 ec 0c             	sub    $0xc,%esp
+  801ce3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801ced:	89 d1                	mov    %edx,%ecx
+  801cef:	89 d3                	mov    %edx,%ebx
+  801cf1:	89 d7                	mov    %edx,%edi
+  801cf3:	89 d6                	mov    %edx,%esi
+  801cf5:	cd 30                	int    $0x30
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	7f 08                	jg     801d03 <sys_lease_complete+0x29>
+  801cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cfe:	5b                   	pop    %ebx
+  801cff:	5e                   	pop    %esi
+  801d00:	5f                   	pop    %edi
+  801d01:	5d                   	pop    %ebp
+  801d02:	c3                   	ret
+  801d03:	83 ec 0c             	sub    $0xc,%esp
+  801d06:	50                   	push   %eax
+  801d07:	6a 1b                	push   $0x1b
+  801d09:	68 0b 46 80 00       	push   $0x80460b
+  801d0e:	6a 24                	push   $0x24
+  801d10:	68 28 46 80 00       	push   $0x804628
+  801d15:	e8 cc ec ff ff       	call   8009e6 <_panic>
+
+00801d1a <sys_env_set_thisenv>:
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	57                   	push   %edi
+  801d1e:	56                   	push   %esi
+  801d1f:	53                   	push   %ebx
+  801d20:	83 ec 0c             	sub    $0xc,%esp
+  801d23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d28:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d2e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801d33:	89 df                	mov    %ebx,%edi
+  801d35:	89 de                	mov    %ebx,%esi
+  801d37:	cd 30                	int    $0x30
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	7f 08                	jg     801d45 <sys_env_set_thisenv+0x2b>
+  801d3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d40:	5b                   	pop    %ebx
+  801d41:	5e                   	pop    %esi
+  801d42:	5f                   	pop    %edi
+  801d43:	5d                   	pop    %ebp
+  801d44:	c3                   	ret
+  801d45:	83 ec 0c             	sub    $0xc,%esp
+  801d48:	50                   	push   %eax
+  801d49:	6a 1c                	push   $0x1c
+  801d4b:	68 0b 46 80 00       	push   $0x80460b
+  801d50:	6a 24                	push   $0x24
+  801d52:	68 28 46 80 00       	push   $0x804628
+  801d57:	e8 8a ec ff ff       	call   8009e6 <_panic>
+
+00801d5c <sys_env_set_sched>:
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	57                   	push   %edi
+  801d60:	56                   	push   %esi
+  801d61:	53                   	push   %ebx
+  801d62:	83 ec 0c             	sub    $0xc,%esp
+  801d65:	be 00 00 00 00       	mov    $0x0,%esi
+  801d6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d70:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801d75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d78:	89 f7                	mov    %esi,%edi
+  801d7a:	cd 30                	int    $0x30
+  801d7c:	85 c0                	test   %eax,%eax
+  801d7e:	7f 08                	jg     801d88 <sys_env_set_sched+0x2c>
+  801d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d83:	5b                   	pop    %ebx
+  801d84:	5e                   	pop    %esi
+  801d85:	5f                   	pop    %edi
+  801d86:	5d                   	pop    %ebp
+  801d87:	c3                   	ret
+  801d88:	83 ec 0c             	sub    $0xc,%esp
+  801d8b:	50                   	push   %eax
+  801d8c:	6a 1d                	push   $0x1d
+  801d8e:	68 0b 46 80 00       	push   $0x80460b
+  801d93:	6a 24                	push   $0x24
+  801d95:	68 28 46 80 00       	push   $0x804628
+  801d9a:	e8 47 ec ff ff       	call   8009e6 <_panic>
+
+00801d9f <sys_batch>:
+  801d9f:	55                   	push   %ebp
+  801da0:	89 e5                	mov    %esp,%ebp
+  801da2:	57                   	push   %edi
+  801da3:	56                   	push   %esi
+  801da4:	53                   	push   %ebx
+  801da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801db0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801db5:	89 df                	mov    %ebx,%edi
+  801db7:	89 de                	mov    %ebx,%esi
+  801db9:	cd 30                	int    $0x30
+  801dbb:	5b                   	pop    %ebx
+  801dbc:	5e                   	pop    %esi
+  801dbd:	5f                   	pop    %edi
+  801dbe:	5d                   	pop    %ebp
+  801dbf:	c3                   	ret
+
+00801dc0 <sys_env_stats>:
+  801dc0:	55                   	push   %ebp
+  801dc1:	89 e5                	mov    %esp,%ebp
+  801dc3:	57                   	push   %edi
+  801dc4:	56                   	push   %esi
+  801dc5:	53                   	push   %ebx
+  801dc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dd1:	b8 23 00 00 00       	mov    $0x23,%eax
+  801dd6:	89 df                	mov    %ebx,%edi
+  801dd8:	89 de                	mov    %ebx,%esi
+  801dda:	cd 30                	int    $0x30
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5f                   	pop    %edi
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+
+00801de1 <sys_trace>:
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	57                   	push   %edi
+  801de5:	56                   	push   %esi
+  801de6:	53                   	push   %ebx
+  801de7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dec:	8b 55 08             	mov    0x8(%ebp),%edx
+  801def:	b8 24 00 00 00       	mov    $0x24,%eax
+  801df4:	89 cb                	mov    %ecx,%ebx
+  801df6:	89 cf                	mov    %ecx,%edi
+  801df8:	89 ce                	mov    %ecx,%esi
+  801dfa:	cd 30                	int    $0x30
+  801dfc:	5b                   	pop    %ebx
+  801dfd:	5e                   	pop    %esi
+  801dfe:	5f                   	pop    %edi
+  801dff:	5d                   	pop    %ebp
+  801e00:	c3                   	ret
+
+00801e01 <sys_env_set_pager>:
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	57                   	push   %edi
+  801e05:	56                   	push   %esi
+  801e06:	53                   	push   %ebx
+  801e07:	83 ec 0c             	sub    $0xc,%esp
+  801e0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e15:	b8 25 00 00 00       	mov    $0x25,%eax
+  801e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e1d:	89 f7                	mov    %esi,%edi
+  801e1f:	cd 30                	int    $0x30
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	7f 08                	jg     801e2d <sys_env_set_pager+0x2c>
+  801e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e28:	5b                   	pop    %ebx
+  801e29:	5e                   	pop    %esi
+  801e2a:	5f                   	pop    %edi
+  801e2b:	5d                   	pop    %ebp
+  801e2c:	c3                   	ret
+  801e2d:	83 ec 0c             	sub    $0xc,%esp
+  801e30:	50                   	push   %eax
+  801e31:	6a 25                	push   $0x25
+  801e33:	68 0b 46 80 00       	push   $0x80460b
+  801e38:	6a 24                	push   $0x24
+  801e3a:	68 28 46 80 00       	push   $0x804628
+  801e3f:	e8 a2 eb ff ff       	call   8009e6 <_panic>
+
+00801e44 <sys_pager_retire>:
+  801e44:	55                   	push   %ebp
+  801e45:	89 e5                	mov    %esp,%ebp
+  801e47:	57                   	push   %edi
+  801e48:	56                   	push   %esi
+  801e49:	53                   	push   %ebx
+  801e4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e52:	b8 28 00 00 00       	mov    $0x28,%eax
+  801e57:	89 cb                	mov    %ecx,%ebx
+  801e59:	89 cf                	mov    %ecx,%edi
+  801e5b:	89 ce                	mov    %ecx,%esi
+  801e5d:	cd 30                	int    $0x30
+  801e5f:	5b                   	pop    %ebx
+  801e60:	5e                   	pop    %esi
+  801e61:	5f                   	pop    %edi
+  801e62:	5d                   	pop    %ebp
+  801e63:	c3                   	ret
+
+00801e64 <sys_prof>:
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	57                   	push   %edi
+  801e68:	56                   	push   %esi
+  801e69:	53                   	push   %ebx
+  801e6a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e75:	b8 22 00 00 00       	mov    $0x22,%eax
+  801e7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e7d:	89 f7                	mov    %esi,%edi
+  801e7f:	cd 30                	int    $0x30
+  801e81:	5b                   	pop    %ebx
+  801e82:	5e                   	pop    %esi
+  801e83:	5f                   	pop    %edi
+  801e84:	5d                   	pop    %ebp
+  801e85:	c3                   	ret
+
+00801e86 <set_pgfault_handler>:
+  801e86:	55                   	push   %ebp
+  801e87:	89 e5                	mov    %esp,%ebp
+  801e89:	53                   	push   %ebx
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	83 3d 88 60 80 00 00 	cmpl   $0x0,0x806088
+  801e94:	74 0d                	je     801ea3 <set_pgfault_handler+0x1d>
+  801e96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e99:	a3 88 60 80 00       	mov    %eax,0x806088
+  801e9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea1:	c9                   	leave
+  801ea2:	c3                   	ret
+  801ea3:	e8 06 f7 ff ff       	call   8015ae <sys_getenvid>
+  801ea8:	89 c3                	mov    %eax,%ebx
+  801eaa:	83 ec 04             	sub    $0x4,%esp
+  801ead:	6a 07                	push   $0x7
+  801eaf:	68 00 f0 7f ee       	push   $0xee7ff000
+  801eb4:	50                   	push   %eax
+  801eb5:	e8 5e f7 ff ff       	call   801618 <sys_page_alloc>
+  801eba:	83 c4 10             	add    $0x10,%esp
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 29                	js     801eea <set_pgfault_handler+0x64>
+  801ec1:	83 ec 08             	sub    $0x8,%esp
+  801ec4:	68 fe 1e 80 00       	push   $0x801efe
+  801ec9:	53                   	push   %ebx
+  801eca:	e8 62 f9 ff ff       	call   801831 <sys_env_set_pgfault_upcall>
+  801ecf:	83 c4 10             	add    $0x10,%esp
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	79 c0                	jns    801e96 <set_pgfault_handler+0x10>
+  801ed6:	83 ec 04             	sub    $0x4,%esp
+  801ed9:	68 70 46 80 00       	push   $0x804670
+  801ede:	6a 27                	push   $0x27
+  801ee0:	68 a2 46 80 00       	push   $0x8046a2
+  801ee5:	e8 fc ea ff ff       	call   8009e6 <_panic>
+  801eea:	83 ec 04             	sub    $0x4,%esp
+  801eed:	68 38 46 80 00       	push   $0x804638
+  801ef2:	6a 23                	push   $0x23
+  801ef4:	68 a2 46 80 00       	push   $0x8046a2
+  801ef9:	e8 e8 ea ff ff       	call   8009e6 <_panic>
+
+00801efe <_pgfault_upcall>:
+  801efe:	54                   	push   %esp
+  801eff:	a1 88 60 80 00       	mov    0x806088,%eax
+  801f04:	ff d0                	call   *%eax
+  801f06:	83 c4 04             	add    $0x4,%esp
+  801f09:	89 e3                	mov    %esp,%ebx
+  801f0b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  801f0f:	8b 54 24 30          	mov    0x30(%esp),%edx
+  801f13:	89 d4                	mov    %edx,%esp
+  801f15:	51                   	push   %ecx
+  801f16:	89 dc                	mov    %ebx,%esp
+  801f18:	83 ea 04             	sub    $0x4,%edx
+  801f1b:	89 54 24 30          	mov    %edx,0x30(%esp)
+  801f1f:	83 c4 08             	add    $0x8,%esp
+  801f22:	61                   	popa
+  801f23:	83 c4 04             	add    $0x4,%esp
+  801f26:	9d                   	popf
+  801f27:	5c                   	pop    %esp
+  801f28:	c3                   	ret
+
+00801f29 <fd2num>:
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f34:	c1 e8 0c             	shr    $0xc,%eax
+  801f37:	5d                   	pop    %ebp
+  801f38:	c3                   	ret
+
+00801f39 <fd2data>:
+  801f39:	55                   	push   %ebp
+  801f3a:	89 e5                	mov    %esp,%ebp
+  801f3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f44:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f49:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801f4e:	5d                   	pop    %ebp
+  801f4f:	c3                   	ret
+
+00801f50 <fd_alloc>:
+  801f50:	55                   	push   %ebp
+  801f51:	89 e5                	mov    %esp,%ebp
+  801f53:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801f58:	89 c2                	mov    %eax,%edx
+  801f5a:	c1 ea 16             	shr    $0x16,%edx
+  801f5d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f64:	f6 c2 01             	test   $0x1,%dl
+  801f67:	74 29                	je     801f92 <fd_alloc+0x42>
+  801f69:	89 c2                	mov    %eax,%edx
+  801f6b:	c1 ea 0c             	shr    $0xc,%edx
+  801f6e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f75:	f6 c2 01             	test   $0x1,%dl
+  801f78:	74 18                	je     801f92 <fd_alloc+0x42>
+  801f7a:	05 00 10 00 00       	add    $0x1000,%eax
+  801f7f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801f84:	75 d2                	jne    801f58 <fd_alloc+0x8>
+  801f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f90:	eb 05                	jmp    801f97 <fd_alloc+0x47>
+  801f92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f9a:	89 02                	mov    %eax,(%edx)
+  801f9c:	89 c8                	mov    %ecx,%eax
+  801f9e:	5d                   	pop    %ebp
+  801f9f:	c3                   	ret
+
+00801fa0 <fd_lookup>:
+  801fa0:	55                   	push   %ebp
+  801fa1:	89 e5                	mov    %esp,%ebp
+  801fa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa6:	83 f8 1f             	cmp    $0x1f,%eax
+  801fa9:	77 30                	ja     801fdb <fd_lookup+0x3b>
+  801fab:	c1 e0 0c             	shl    $0xc,%eax
+  801fae:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801fb3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801fb9:	f6 c2 01             	test   $0x1,%dl
+  801fbc:	74 24                	je     801fe2 <fd_lookup+0x42>
+  801fbe:	89 c2                	mov    %eax,%edx
+  801fc0:	c1 ea 0c             	shr    $0xc,%edx
+  801fc3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fca:	f6 c2 01             	test   $0x1,%dl
+  801fcd:	74 1a                	je     801fe9 <fd_lookup+0x49>
+  801fcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fd2:	89 02                	mov    %eax,(%edx)
+  801fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd9:	5d                   	pop    %ebp
+  801fda:	c3                   	ret
+  801fdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe0:	eb f7                	jmp    801fd9 <fd_lookup+0x39>
+  801fe2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe7:	eb f0                	jmp    801fd9 <fd_lookup+0x39>
+  801fe9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fee:	eb e9                	jmp    801fd9 <fd_lookup+0x39>
+
+00801ff0 <dev_lookup>:
+  801ff0:	55                   	push   %ebp
+  801ff1:	89 e5                	mov    %esp,%ebp
+  801ff3:	53                   	push   %ebx
+  801ff4:	83 ec 04             	sub    $0x4,%esp
+  801ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fff:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  802004:	39 13                	cmp    %edx,(%ebx)
+  802006:	74 37                	je     80203f <dev_lookup+0x4f>
+  802008:	83 c0 01             	add    $0x1,%eax
+  80200b:	8b 1c 85 2c 47 80 00 	mov    0x80472c(,%eax,4),%ebx
+  802012:	85 db                	test   %ebx,%ebx
+  802014:	75 ee                	jne    802004 <dev_lookup+0x14>
+  802016:	a1 84 60 80 00       	mov    0x806084,%eax
+  80201b:	8b 40 48             	mov    0x48(%eax),%eax
+  80201e:	83 ec 04             	sub    $0x4,%esp
+  802021:	52                   	push   %edx
+  802022:	50                   	push   %eax
+  802023:	68 b0 46 80 00       	push   $0x8046b0
+  802028:	e8 94 ea ff ff       	call   800ac1 <cprintf>
+  80202d:	83 c4 10             	add    $0x10,%esp
+  802030:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802035:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802038:	89 1a                	mov    %ebx,(%edx)
+  80203a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80203d:	c9                   	leave
+  80203e:	c3                   	ret
+  80203f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802044:	eb ef                	jmp    802035 <dev_lookup+0x45>
+
+00802046 <fd_close>:
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	57                   	push   %edi
+  80204a:	56                   	push   %esi
+  80204b:	53                   	push   %ebx
+  80204c:	83 ec 24             	sub    $0x24,%esp
+  80204f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802052:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802055:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802058:	50                   	push   %eax
+  802059:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80205f:	c1 e8 0c             	shr    $0xc,%eax
+  802062:	50                   	push   %eax
+  802063:	e8 38 ff ff ff       	call   801fa0 <fd_lookup>
+  802068:	89 c3                	mov    %eax,%ebx
+  80206a:	83 c4 10             	add    $0x10,%esp
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	78 05                	js     802076 <fd_close+0x30>
+  802071:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802074:	74 0f                	je     802085 <fd_close+0x3f>
+  802076:	85 ff                	test   %edi,%edi
+  802078:	0f 44 df             	cmove  %edi,%ebx
+  80207b:	89 d8                	mov    %ebx,%eax
+  80207d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802080:	5b                   	pop    %ebx
+  802081:	5e                   	pop    %esi
+  802082:	5f                   	pop    %edi
+  802083:	5d                   	pop    %ebp
+  802084:	c3                   	ret
+  802085:	83 ec 08             	sub    $0x8,%esp
+  802088:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80208b:	50                   	push   %eax
+  80208c:	ff 36                	push   (%esi)
+  80208e:	e8 5d ff ff ff       	call   801ff0 <dev_lookup>
+  802093:	89 c3                	mov    %eax,%ebx
+  802095:	83 c4 10             	add    $0x10,%esp
+  802098:	85 c0                	test   %eax,%eax
+  80209a:	78 1a                	js     8020b6 <fd_close+0x70>
+  80209c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80209f:	8b 40 10             	mov    0x10(%eax),%eax
+  8020a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	74 0b                	je     8020b6 <fd_close+0x70>
+  8020ab:	83 ec 0c             	sub    $0xc,%esp
+  8020ae:	56                   	push   %esi
+  8020af:	ff d0                	call   *%eax
+  8020b1:	89 c3                	mov    %eax,%ebx
+  8020b3:	83 c4 10             	add    $0x10,%esp
+  8020b6:	83 ec 08             	sub    $0x8,%esp
+  8020b9:	56                   	push   %esi
+  8020ba:	6a 00                	push   $0x0
+  8020bc:	e8 29 f6 ff ff       	call   8016ea <sys_page_unmap>
+  8020c1:	83 c4 10             	add    $0x10,%esp
+  8020c4:	eb b5                	jmp    80207b <fd_close+0x35>
+
+008020c6 <close>:
+  8020c6:	55                   	push   %ebp
+  8020c7:	89 e5                	mov    %esp,%ebp
+  8020c9:	83 ec 20             	sub    $0x20,%esp
+  8020cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020cf:	50                   	push   %eax
+  8020d0:	ff 75 08             	push   0x8(%ebp)
+  8020d3:	e8 c8 fe ff ff       	call   801fa0 <fd_lookup>
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	79 02                	jns    8020e1 <close+0x1b>
+  8020df:	c9                   	leave
+  8020e0:	c3                   	ret
+  8020e1:	83 ec 08             	sub    $0x8,%esp
+  8020e4:	6a 01                	push   $0x1
+  8020e6:	ff 75 f4             	push   -0xc(%ebp)
+  8020e9:	e8 58 ff ff ff       	call   802046 <fd_close>
+  8020ee:	83 c4 10             	add    $0x10,%esp
+  8020f1:	eb ec                	jmp    8020df <close+0x19>
+
+008020f3 <close_all>:
+  8020f3:	55                   	push   %ebp
+  8020f4:	89 e5                	mov    %esp,%ebp
+  8020f6:	53                   	push   %ebx
+  8020f7:	83 ec 04             	sub    $0x4,%esp
+  8020fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	53                   	push   %ebx
+  802103:	e8 be ff ff ff       	call   8020c6 <close>
+  802108:	83 c3 01             	add    $0x1,%ebx
+  80210b:	83 c4 10             	add    $0x10,%esp
+  80210e:	83 fb 20             	cmp    $0x20,%ebx
+  802111:	75 ec                	jne    8020ff <close_all+0xc>
+  802113:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802116:	c9                   	leave
+  802117:	c3                   	ret
+
+00802118 <dup>:
+  802118:	55                   	push   %ebp
+  802119:	89 e5                	mov    %esp,%ebp
+  80211b:	57                   	push   %edi
+  80211c:	56                   	push   %esi
+  80211d:	53                   	push   %ebx
+  80211e:	83 ec 34             	sub    $0x34,%esp
+  802121:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802124:	50                   	push   %eax
+  802125:	ff 75 08             	push   0x8(%ebp)
+  802128:	e8 73 fe ff ff       	call   801fa0 <fd_lookup>
+  80212d:	89 c3                	mov    %eax,%ebx
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	85 c0                	test   %eax,%eax
+  802134:	78 7f                	js     8021b5 <dup+0x9d>
+  802136:	83 ec 0c             	sub    $0xc,%esp
+  802139:	ff 75 0c             	push   0xc(%ebp)
+  80213c:	e8 85 ff ff ff       	call   8020c6 <close>
+  802141:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802144:	c1 e6 0c             	shl    $0xc,%esi
+  802147:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80214d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802150:	89 3c 24             	mov    %edi,(%esp)
+  802153:	e8 e1 fd ff ff       	call   801f39 <fd2data>
+  802158:	89 c3                	mov    %eax,%ebx
+  80215a:	89 34 24             	mov    %esi,(%esp)
+  80215d:	e8 d7 fd ff ff       	call   801f39 <fd2data>
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802168:	89 d8                	mov    %ebx,%eax
+  80216a:	c1 e8 16             	shr    $0x16,%eax
+  80216d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802174:	a8 01                	test   $0x1,%al
+  802176:	74 11                	je     802189 <dup+0x71>
+  802178:	89 d8                	mov    %ebx,%eax
+  80217a:	c1 e8 0c             	shr    $0xc,%eax
+  80217d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802184:	f6 c2 01             	test   $0x1,%dl
+  802187:	75 36                	jne    8021bf <dup+0xa7>
+  802189:	89 f8                	mov    %edi,%eax
+  80218b:	c1 e8 0c             	shr    $0xc,%eax
+  80218e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802195:	83 ec 0c             	sub    $0xc,%esp
+  802198:	25 07 0e 00 00       	and    $0xe07,%eax
+  80219d:	50                   	push   %eax
+  80219e:	56                   	push   %esi
+  80219f:	6a 00                	push   $0x0
+  8021a1:	57                   	push   %edi
+  8021a2:	6a 00                	push   $0x0
+  8021a4:	e8 b2 f4 ff ff       	call   80165b <sys_page_map>
+  8021a9:	89 c3                	mov    %eax,%ebx
+  8021ab:	83 c4 20             	add    $0x20,%esp
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	78 33                	js     8021e5 <dup+0xcd>
+  8021b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021b5:	89 d8                	mov    %ebx,%eax
+  8021b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ba:	5b                   	pop    %ebx
+  8021bb:	5e                   	pop    %esi
+  8021bc:	5f                   	pop    %edi
+  8021bd:	5d                   	pop    %ebp
+  8021be:	c3                   	ret
+  8021bf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021c6:	83 ec 0c             	sub    $0xc,%esp
+  8021c9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021ce:	50                   	push   %eax
+  8021cf:	ff 75 d4             	push   -0x2c(%ebp)
+  8021d2:	6a 00                	push   $0x0
+  8021d4:	53                   	push   %ebx
+  8021d5:	6a 00                	push   $0x0
+  8021d7:	e8 7f f4 ff ff       	call   80165b <sys_page_map>
+  8021dc:	89 c3                	mov    %eax,%ebx
+  8021de:	83 c4 20             	add    $0x20,%esp
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	79 a4                	jns    802189 <dup+0x71>
+  8021e5:	83 ec 08             	sub    $0x8,%esp
+  8021e8:	56                   	push   %esi
+  8021e9:	6a 00                	push   $0x0
+  8021eb:	e8 fa f4 ff ff       	call   8016ea <sys_page_unmap>
+  8021f0:	83 c4 08             	add    $0x8,%esp
+  8021f3:	ff 75 d4             	push   -0x2c(%ebp)
+  8021f6:	6a 00                	push   $0x0
+  8021f8:	e8 ed f4 ff ff       	call   8016ea <sys_page_unmap>
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	eb b3                	jmp    8021b5 <dup+0x9d>
+
+00802202 <read>:
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	56                   	push   %esi
+  802206:	53                   	push   %ebx
+  802207:	83 ec 18             	sub    $0x18,%esp
+  80220a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80220d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802210:	50                   	push   %eax
+  802211:	56                   	push   %esi
+  802212:	e8 89 fd ff ff       	call   801fa0 <fd_lookup>
+  802217:	83 c4 10             	add    $0x10,%esp
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	78 3c                	js     80225a <read+0x58>
+  80221e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802221:	83 ec 08             	sub    $0x8,%esp
+  802224:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802227:	50                   	push   %eax
+  802228:	ff 33                	push   (%ebx)
+  80222a:	e8 c1 fd ff ff       	call   801ff0 <dev_lookup>
+  80222f:	83 c4 10             	add    $0x10,%esp
+  802232:	85 c0                	test   %eax,%eax
+  802234:	78 24                	js     80225a <read+0x58>
+  802236:	8b 43 08             	mov    0x8(%ebx),%eax
+  802239:	83 e0 03             	and    $0x3,%eax
+  80223c:	83 f8 01             	cmp    $0x1,%eax
+  80223f:	74 20                	je     802261 <read+0x5f>
+  802241:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802244:	8b 40 08             	mov    0x8(%eax),%eax
+  802247:	85 c0                	test   %eax,%eax
+  802249:	74 37                	je     802282 <read+0x80>
+  80224b:	83 ec 04             	sub    $0x4,%esp
+  80224e:	ff 75 10             	push   0x10(%ebp)
+  802251:	ff 75 0c             	push   0xc(%ebp)
+  802254:	53                   	push   %ebx
+  802255:	ff d0                	call   *%eax
+  802257:	83 c4 10             	add    $0x10,%esp
+  80225a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80225d:	5b                   	pop    %ebx
+  80225e:	5e                   	pop    %esi
+  80225f:	5d                   	pop    %ebp
+  802260:	c3                   	ret
+  802261:	a1 84 60 80 00       	mov    0x806084,%eax
+  802266:	8b 40 48             	mov    0x48(%eax),%eax
+  802269:	83 ec 04             	sub    $0x4,%esp
+  80226c:	56                   	push   %esi
+  80226d:	50                   	push   %eax
+  80226e:	68 f1 46 80 00       	push   $0x8046f1
+  802273:	e8 49 e8 ff ff       	call   800ac1 <cprintf>
+  802278:	83 c4 10             	add    $0x10,%esp
+  80227b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802280:	eb d8                	jmp    80225a <read+0x58>
+  802282:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802287:	eb d1                	jmp    80225a <read+0x58>
+
+00802289 <readn>:
+  802289:	55                   	push   %ebp
+  80228a:	89 e5                	mov    %esp,%ebp
+  80228c:	57                   	push   %edi
+  80228d:	56                   	push   %esi
+  80228e:	53                   	push   %ebx
+  80228f:	83 ec 0c             	sub    $0xc,%esp
+  802292:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802295:	8b 75 10             	mov    0x10(%ebp),%esi
+  802298:	85 f6                	test   %esi,%esi
+  80229a:	74 30                	je     8022cc <readn+0x43>
+  80229c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a6:	83 ec 04             	sub    $0x4,%esp
+  8022a9:	89 f2                	mov    %esi,%edx
+  8022ab:	29 c2                	sub    %eax,%edx
+  8022ad:	52                   	push   %edx
+  8022ae:	01 f8                	add    %edi,%eax
+  8022b0:	50                   	push   %eax
+  8022b1:	ff 75 08             	push   0x8(%ebp)
+  8022b4:	e8 49 ff ff ff       	call   802202 <read>
+  8022b9:	83 c4 10             	add    $0x10,%esp
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	78 15                	js     8022d5 <readn+0x4c>
+  8022c0:	74 11                	je     8022d3 <readn+0x4a>
+  8022c2:	01 c3                	add    %eax,%ebx
+  8022c4:	89 d8                	mov    %ebx,%eax
+  8022c6:	39 f3                	cmp    %esi,%ebx
+  8022c8:	72 dc                	jb     8022a6 <readn+0x1d>
+  8022ca:	eb 09                	jmp    8022d5 <readn+0x4c>
+  8022cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d1:	eb 02                	jmp    8022d5 <readn+0x4c>
+  8022d3:	89 d8                	mov    %ebx,%eax
+  8022d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d8:	5b                   	pop    %ebx
+  8022d9:	5e                   	pop    %esi
+  8022da:	5f                   	pop    %edi
+  8022db:	5d                   	pop    %ebp
+  8022dc:	c3                   	ret
+
+008022dd <write>:
+  8022dd:	55                   	push   %ebp
+  8022de:	89 e5                	mov    %esp,%ebp
+  8022e0:	56                   	push   %esi
+  8022e1:	53                   	push   %ebx
+  8022e2:	83 ec 18             	sub    $0x18,%esp
+  8022e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022e8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022eb:	50                   	push   %eax
+  8022ec:	53                   	push   %ebx
+  8022ed:	e8 ae fc ff ff       	call   801fa0 <fd_lookup>
+  8022f2:	83 c4 10             	add    $0x10,%esp
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	78 37                	js     802330 <write+0x53>
+  8022f9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022fc:	83 ec 08             	sub    $0x8,%esp
+  8022ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802302:	50                   	push   %eax
+  802303:	ff 36                	push   (%esi)
+  802305:	e8 e6 fc ff ff       	call   801ff0 <dev_lookup>
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	85 c0                	test   %eax,%eax
+  80230f:	78 1f                	js     802330 <write+0x53>
+  802311:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802315:	74 20                	je     802337 <write+0x5a>
+  802317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80231a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	74 37                	je     802358 <write+0x7b>
+  802321:	83 ec 04             	sub    $0x4,%esp
+  802324:	ff 75 10             	push   0x10(%ebp)
+  802327:	ff 75 0c             	push   0xc(%ebp)
+  80232a:	56                   	push   %esi
+  80232b:	ff d0                	call   *%eax
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802333:	5b                   	pop    %ebx
+  802334:	5e                   	pop    %esi
+  802335:	5d                   	pop    %ebp
+  802336:	c3                   	ret
+  802337:	a1 84 60 80 00       	mov    0x806084,%eax
+  80233c:	8b 40 48             	mov    0x48(%eax),%eax
+  80233f:	83 ec 04             	sub    $0x4,%esp
+  802342:	53                   	push   %ebx
+  802343:	50                   	push   %eax
+  802344:	68 0d 47 80 00       	push   $0x80470d
+  802349:	e8 73 e7 ff ff       	call   800ac1 <cprintf>
+  80234e:	83 c4 10             	add    $0x10,%esp
+  802351:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802356:	eb d8                	jmp    802330 <write+0x53>
+  802358:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80235d:	eb d1                	jmp    802330 <write+0x53>
+
+0080235f <seek>:
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	83 ec 20             	sub    $0x20,%esp
+  802365:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802368:	50                   	push   %eax
+  802369:	ff 75 08             	push   0x8(%ebp)
+  80236c:	e8 2f fc ff ff       	call   801fa0 <fd_lookup>
+  802371:	83 c4 10             	add    $0x10,%esp
+  802374:	85 c0                	test   %eax,%eax
+  802376:	78 0e                	js     802386 <seek+0x27>
+  802378:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80237b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80237e:	89 50 04             	mov    %edx,0x4(%eax)
+  802381:	b8 00 00 00 00       	mov    $0x0,%eax
+  802386:	c9                   	leave
+  802387:	c3                   	ret
+
+00802388 <ftruncate>:
+  802388:	55                   	push   %ebp
+  802389:	89 e5                	mov    %esp,%ebp
+  80238b:	56                   	push   %esi
+  80238c:	53                   	push   %ebx
+  80238d:	83 ec 18             	sub    $0x18,%esp
+  802390:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802393:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802396:	50                   	push   %eax
+  802397:	53                   	push   %ebx
+  802398:	e8 03 fc ff ff       	call   801fa0 <fd_lookup>
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	85 c0                	test   %eax,%eax
+  8023a2:	78 34                	js     8023d8 <ftruncate+0x50>
+  8023a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023a7:	83 ec 08             	sub    $0x8,%esp
+  8023aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ad:	50                   	push   %eax
+  8023ae:	ff 36                	push   (%esi)
+  8023b0:	e8 3b fc ff ff       	call   801ff0 <dev_lookup>
+  8023b5:	83 c4 10             	add    $0x10,%esp
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	78 1c                	js     8023d8 <ftruncate+0x50>
+  8023bc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8023c0:	74 1d                	je     8023df <ftruncate+0x57>
+  8023c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c5:	8b 40 18             	mov    0x18(%eax),%eax
+  8023c8:	85 c0                	test   %eax,%eax
+  8023ca:	74 34                	je     802400 <ftruncate+0x78>
+  8023cc:	83 ec 08             	sub    $0x8,%esp
+  8023cf:	ff 75 0c             	push   0xc(%ebp)
+  8023d2:	56                   	push   %esi
+  8023d3:	ff d0                	call   *%eax
+  8023d5:	83 c4 10             	add    $0x10,%esp
+  8023d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023db:	5b                   	pop    %ebx
+  8023dc:	5e                   	pop    %esi
+  8023dd:	5d                   	pop    %ebp
+  8023de:	c3                   	ret
+  8023df:	a1 84 60 80 00       	mov    0x806084,%eax
+  8023e4:	8b 40 48             	mov    0x48(%eax),%eax
+  8023e7:	83 ec 04             	sub    $0x4,%esp
+  8023ea:	53                   	push   %ebx
+  8023eb:	50                   	push   %eax
+  8023ec:	68 d0 46 80 00       	push   $0x8046d0
+  8023f1:	e8 cb e6 ff ff       	call   800ac1 <cprintf>
+  8023f6:	83 c4 10             	add    $0x10,%esp
+  8023f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023fe:	eb d8                	jmp    8023d8 <ftruncate+0x50>
+  802400:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802405:	eb d1                	jmp    8023d8 <ftruncate+0x50>
+
+00802407 <fstat>:
+  802407:	55                   	push   %ebp
+  802408:	89 e5                	mov    %esp,%ebp
+  80240a:	56                   	push   %esi
+  80240b:	53                   	push   %ebx
+  80240c:	83 ec 18             	sub    $0x18,%esp
+  80240f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802412:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802415:	50                   	push   %eax
+  802416:	ff 75 08             	push   0x8(%ebp)
+  802419:	e8 82 fb ff ff       	call   801fa0 <fd_lookup>
+  80241e:	83 c4 10             	add    $0x10,%esp
+  802421:	85 c0                	test   %eax,%eax
+  802423:	78 49                	js     80246e <fstat+0x67>
+  802425:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802428:	83 ec 08             	sub    $0x8,%esp
+  80242b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80242e:	50                   	push   %eax
+  80242f:	ff 36                	push   (%esi)
+  802431:	e8 ba fb ff ff       	call   801ff0 <dev_lookup>
+  802436:	83 c4 10             	add    $0x10,%esp
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 31                	js     80246e <fstat+0x67>
+  80243d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802440:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802444:	74 2f                	je     802475 <fstat+0x6e>
+  802446:	c6 03 00             	movb   $0x0,(%ebx)
+  802449:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802450:	00 00 00 
+  802453:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80245a:	00 00 00 
+  80245d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802463:	83 ec 08             	sub    $0x8,%esp
+  802466:	53                   	push   %ebx
+  802467:	56                   	push   %esi
+  802468:	ff 50 14             	call   *0x14(%eax)
+  80246b:	83 c4 10             	add    $0x10,%esp
+  80246e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802471:	5b                   	pop    %ebx
+  802472:	5e                   	pop    %esi
+  802473:	5d                   	pop    %ebp
+  802474:	c3                   	ret
+  802475:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80247a:	eb f2                	jmp    80246e <fstat+0x67>
+
+0080247c <stat>:
+  80247c:	55                   	push   %ebp
+  80247d:	89 e5                	mov    %esp,%ebp
+  80247f:	56                   	push   %esi
+  802480:	53                   	push   %ebx
+  802481:	83 ec 08             	sub    $0x8,%esp
+  802484:	6a 00                	push   $0x0
+  802486:	ff 75 08             	push   0x8(%ebp)
+  802489:	e8 31 05 00 00       	call   8029bf <open>
+  80248e:	89 c3                	mov    %eax,%ebx
+  802490:	83 c4 10             	add    $0x10,%esp
+  802493:	85 c0                	test   %eax,%eax
+  802495:	78 1b                	js     8024b2 <stat+0x36>
+  802497:	83 ec 08             	sub    $0x8,%esp
+  80249a:	ff 75 0c             	push   0xc(%ebp)
+  80249d:	50                   	push   %eax
+  80249e:	e8 64 ff ff ff       	call   802407 <fstat>
+  8024a3:	89 c6                	mov    %eax,%esi
+  8024a5:	89 1c 24             	mov    %ebx,(%esp)
+  8024a8:	e8 19 fc ff ff       	call   8020c6 <close>
+  8024ad:	83 c4 10             	add    $0x10,%esp
+  8024b0:	89 f3                	mov    %esi,%ebx
+  8024b2:	89 d8                	mov    %ebx,%eax
+  8024b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024b7:	5b                   	pop    %ebx
+  8024b8:	5e                   	pop    %esi
+  8024b9:	5d                   	pop    %ebp
+  8024ba:	c3                   	ret
+
+008024bb <fsipc>:
+  8024bb:	55                   	push   %ebp
+  8024bc:	89 e5                	mov    %esp,%ebp
+  8024be:	56                   	push   %esi
+  8024bf:	53                   	push   %ebx
+  8024c0:	89 c3                	mov    %eax,%ebx
+  8024c2:	89 d6                	mov    %edx,%esi
+  8024c4:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8024cb:	74 20                	je     8024ed <fsipc+0x32>
+  8024cd:	83 ec 08             	sub    $0x8,%esp
+  8024d0:	6a 00                	push   $0x0
+  8024d2:	56                   	push   %esi
+  8024d3:	6a 07                	push   $0x7
+  8024d5:	68 00 70 80 00       	push   $0x807000
+  8024da:	53                   	push   %ebx
+  8024db:	ff 35 08 60 80 00    	push   0x806008
+  8024e1:	e8 5a 12 00 00       	call   803740 <ipc_call>
+  8024e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e9:	5b                   	pop    %ebx
+  8024ea:	5e                   	pop    %esi
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+  8024ed:	83 ec 0c             	sub    $0xc,%esp
+  8024f0:	6a 02                	push   $0x2
+  8024f2:	e8 e4 13 00 00       	call   8038db <ipc_find_env>
+  8024f7:	a3 08 60 80 00       	mov    %eax,0x806008
+  8024fc:	83 c4 10             	add    $0x10,%esp
+  8024ff:	eb cc                	jmp    8024cd <fsipc+0x12>
+
+00802501 <devfile_trunc>:
+  802501:	55                   	push   %ebp
+  802502:	89 e5                	mov    %esp,%ebp
+  802504:	83 ec 08             	sub    $0x8,%esp
+  802507:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80250d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802512:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802515:	a3 04 70 80 00       	mov    %eax,0x807004
+  80251a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802524:	e8 92 ff ff ff       	call   8024bb <fsipc>
+  802529:	c9                   	leave
+  80252a:	c3                   	ret
+
+0080252b <devfile_flush>:
+  80252b:	55                   	push   %ebp
+  80252c:	89 e5                	mov    %esp,%ebp
+  80252e:	83 ec 08             	sub    $0x8,%esp
+  802531:	8b 45 08             	mov    0x8(%ebp),%eax
+  802534:	8b 40 0c             	mov    0xc(%eax),%eax
+  802537:	a3 00 70 80 00       	mov    %eax,0x807000
+  80253c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802541:	b8 08 00 00 00       	mov    $0x8,%eax
+  802546:	e8 70 ff ff ff       	call   8024bb <fsipc>
+  80254b:	c9                   	leave
+  80254c:	c3                   	ret
+
+0080254d <devfile_stat>:
+  80254d:	55                   	push   %ebp
+  80254e:	89 e5                	mov    %esp,%ebp
+  802550:	53                   	push   %ebx
+  802551:	83 ec 04             	sub    $0x4,%esp
+  802554:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802557:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80255d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802562:	ba 00 00 00 00       	mov    $0x0,%edx
+  802567:	b8 07 00 00 00       	mov    $0x7,%eax
+  80256c:	e8 4a ff ff ff       	call   8024bb <fsipc>
+  802571:	85 c0                	test   %eax,%eax
+  802573:	78 2c                	js     8025a1 <devfile_stat+0x54>
+  802575:	83 ec 08             	sub    $0x8,%esp
+  802578:	68 00 70 80 00       	push   $0x807000
+  80257d:	53                   	push   %ebx
+  80257e:	e8 35 ec ff ff       	call   8011b8 <strcpy>
+  802583:	a1 80 70 80 00       	mov    0x807080,%eax
+  802588:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80258e:	a1 84 70 80 00       	mov    0x807084,%eax
+  802593:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a4:	c9                   	leave
+  8025a5:	c3                   	ret
+
+008025a6 <fsring_rw>:
+  8025a6:	55                   	push   %ebp
+  8025a7:	89 e5                	mov    %esp,%ebp
+  8025a9:	57                   	push   %edi
+  8025aa:	56                   	push   %esi
+  8025ab:	53                   	push   %ebx
+  8025ac:	83 ec 2c             	sub    $0x2c,%esp
+  8025af:	89 c7                	mov    %eax,%edi
+  8025b1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8025b4:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8025b7:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8025bc:	a8 01                	test   $0x1,%al
+  8025be:	74 0d                	je     8025cd <fsring_rw+0x27>
+  8025c0:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8025c5:	a8 01                	test   $0x1,%al
+  8025c7:	0f 85 d5 00 00 00    	jne    8026a2 <fsring_rw+0xfc>
+  8025cd:	a1 84 60 80 00       	mov    0x806084,%eax
+  8025d2:	8b 40 48             	mov    0x48(%eax),%eax
+  8025d5:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  8025db:	0f 84 fc 00 00 00    	je     8026dd <fsring_rw+0x137>
+  8025e1:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8025e8:	0f 84 02 01 00 00    	je     8026f0 <fsring_rw+0x14a>
+  8025ee:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8025f3:	83 ec 04             	sub    $0x4,%esp
+  8025f6:	68 07 02 00 00       	push   $0x207
+  8025fb:	53                   	push   %ebx
+  8025fc:	6a 00                	push   $0x0
+  8025fe:	e8 15 f0 ff ff       	call   801618 <sys_page_alloc>
+  802603:	83 c4 10             	add    $0x10,%esp
+  802606:	85 c0                	test   %eax,%eax
+  802608:	0f 88 f9 00 00 00    	js     802707 <fsring_rw+0x161>
+  80260e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802614:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80261a:	75 d7                	jne    8025f3 <fsring_rw+0x4d>
+  80261c:	6a 0e                	push   $0xe
+  80261e:	6a 0d                	push   $0xd
+  802620:	ff 35 08 60 80 00    	push   0x806008
+  802626:	68 00 00 f0 cf       	push   $0xcff00000
+  80262b:	e8 c4 0c 00 00       	call   8032f4 <ipcring_init>
+  802630:	83 c4 08             	add    $0x8,%esp
+  802633:	6a 00                	push   $0x0
+  802635:	6a 00                	push   $0x0
+  802637:	68 07 02 00 00       	push   $0x207
+  80263c:	68 00 00 f0 cf       	push   $0xcff00000
+  802641:	6a 0b                	push   $0xb
+  802643:	ff 35 08 60 80 00    	push   0x806008
+  802649:	e8 f2 10 00 00       	call   803740 <ipc_call>
+  80264e:	89 c6                	mov    %eax,%esi
+  802650:	83 c4 20             	add    $0x20,%esp
+  802653:	85 c0                	test   %eax,%eax
+  802655:	0f 88 ac 00 00 00    	js     802707 <fsring_rw+0x161>
+  80265b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802660:	89 d9                	mov    %ebx,%ecx
+  802662:	83 c3 01             	add    $0x1,%ebx
+  802665:	89 da                	mov    %ebx,%edx
+  802667:	c1 e2 0c             	shl    $0xc,%edx
+  80266a:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802670:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802676:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80267c:	83 ec 08             	sub    $0x8,%esp
+  80267f:	6a 00                	push   $0x0
+  802681:	6a 00                	push   $0x0
+  802683:	68 07 02 00 00       	push   $0x207
+  802688:	50                   	push   %eax
+  802689:	6a 0c                	push   $0xc
+  80268b:	ff 35 08 60 80 00    	push   0x806008
+  802691:	e8 aa 10 00 00       	call   803740 <ipc_call>
+  802696:	83 c4 20             	add    $0x20,%esp
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	78 6a                	js     802707 <fsring_rw+0x161>
+  80269d:	83 fb 08             	cmp    $0x8,%ebx
+  8026a0:	75 be                	jne    802660 <fsring_rw+0xba>
+  8026a2:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8026a6:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8026ab:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026b0:	0f 45 c2             	cmovne %edx,%eax
+  8026b3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8026b6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8026bd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8026c4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8026cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d5:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8026d8:	e9 4b 01 00 00       	jmp    802828 <fsring_rw+0x282>
+  8026dd:	e8 00 f3 ff ff       	call   8019e2 <sys_time_msec>
+  8026e2:	3b 05 00 60 80 00    	cmp    0x806000,%eax
+  8026e8:	0f 89 f3 fe ff ff    	jns    8025e1 <fsring_rw+0x3b>
+  8026ee:	eb 54                	jmp    802744 <fsring_rw+0x19e>
+  8026f0:	83 ec 0c             	sub    $0xc,%esp
+  8026f3:	6a 02                	push   $0x2
+  8026f5:	e8 e1 11 00 00       	call   8038db <ipc_find_env>
+  8026fa:	a3 08 60 80 00       	mov    %eax,0x806008
+  8026ff:	83 c4 10             	add    $0x10,%esp
+  802702:	e9 e7 fe ff ff       	jmp    8025ee <fsring_rw+0x48>
+  802707:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80270c:	83 ec 08             	sub    $0x8,%esp
+  80270f:	53                   	push   %ebx
+  802710:	6a 00                	push   $0x0
+  802712:	e8 d3 ef ff ff       	call   8016ea <sys_page_unmap>
+  802717:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80271d:	83 c4 10             	add    $0x10,%esp
+  802720:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802726:	75 e4                	jne    80270c <fsring_rw+0x166>
+  802728:	e8 b5 f2 ff ff       	call   8019e2 <sys_time_msec>
+  80272d:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802732:	a3 00 60 80 00       	mov    %eax,0x806000
+  802737:	a1 84 60 80 00       	mov    0x806084,%eax
+  80273c:	8b 40 48             	mov    0x48(%eax),%eax
+  80273f:	a3 04 60 80 00       	mov    %eax,0x806004
+  802744:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80274b:	e9 7a 01 00 00       	jmp    8028ca <fsring_rw+0x324>
+  802750:	8b 57 0c             	mov    0xc(%edi),%edx
+  802753:	89 10                	mov    %edx,(%eax)
+  802755:	89 58 04             	mov    %ebx,0x4(%eax)
+  802758:	89 f2                	mov    %esi,%edx
+  80275a:	03 57 04             	add    0x4(%edi),%edx
+  80275d:	89 50 08             	mov    %edx,0x8(%eax)
+  802760:	83 ec 04             	sub    $0x4,%esp
+  802763:	53                   	push   %ebx
+  802764:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802767:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80276a:	52                   	push   %edx
+  80276b:	83 c0 0c             	add    $0xc,%eax
+  80276e:	50                   	push   %eax
+  80276f:	e8 f4 eb ff ff       	call   801368 <memmove>
+  802774:	83 c4 10             	add    $0x10,%esp
+  802777:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80277a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80277d:	89 08                	mov    %ecx,(%eax)
+  80277f:	83 ec 0c             	sub    $0xc,%esp
+  802782:	68 00 00 f0 cf       	push   $0xcff00000
+  802787:	e8 c6 0b 00 00       	call   803352 <ipcring_req_push>
+  80278c:	01 de                	add    %ebx,%esi
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802794:	73 4c                	jae    8027e2 <fsring_rw+0x23c>
+  802796:	83 ec 0c             	sub    $0xc,%esp
+  802799:	68 00 00 f0 cf       	push   $0xcff00000
+  80279e:	e8 89 0b 00 00       	call   80332c <ipcring_req_slot>
+  8027a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	74 35                	je     8027e2 <fsring_rw+0x23c>
+  8027ad:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8027b2:	83 e0 07             	and    $0x7,%eax
+  8027b5:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8027ba:	c1 e0 0c             	shl    $0xc,%eax
+  8027bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027c0:	29 f3                	sub    %esi,%ebx
+  8027c2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8027c5:	39 cb                	cmp    %ecx,%ebx
+  8027c7:	0f 47 d9             	cmova  %ecx,%ebx
+  8027ca:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8027ce:	75 80                	jne    802750 <fsring_rw+0x1aa>
+  8027d0:	8b 57 0c             	mov    0xc(%edi),%edx
+  8027d3:	89 10                	mov    %edx,(%eax)
+  8027d5:	89 58 04             	mov    %ebx,0x4(%eax)
+  8027d8:	89 f2                	mov    %esi,%edx
+  8027da:	03 57 04             	add    0x4(%edi),%edx
+  8027dd:	89 50 08             	mov    %edx,0x8(%eax)
+  8027e0:	eb 95                	jmp    802777 <fsring_rw+0x1d1>
+  8027e2:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8027e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027ea:	83 ec 0c             	sub    $0xc,%esp
+  8027ed:	68 00 00 f0 cf       	push   $0xcff00000
+  8027f2:	e8 94 0b 00 00       	call   80338b <ipcring_rsp_wait>
+  8027f7:	8b 58 04             	mov    0x4(%eax),%ebx
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802801:	75 45                	jne    802848 <fsring_rw+0x2a2>
+  802803:	85 db                	test   %ebx,%ebx
+  802805:	79 41                	jns    802848 <fsring_rw+0x2a2>
+  802807:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80280a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802811:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802818:	83 ec 0c             	sub    $0xc,%esp
+  80281b:	68 00 00 f0 cf       	push   $0xcff00000
+  802820:	e8 cc 0b 00 00       	call   8033f1 <ipcring_rsp_pop>
+  802825:	83 c4 10             	add    $0x10,%esp
+  802828:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80282e:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802833:	39 c2                	cmp    %eax,%edx
+  802835:	74 75                	je     8028ac <fsring_rw+0x306>
+  802837:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80283b:	75 a5                	jne    8027e2 <fsring_rw+0x23c>
+  80283d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802840:	0f 82 50 ff ff ff    	jb     802796 <fsring_rw+0x1f0>
+  802846:	eb 9a                	jmp    8027e2 <fsring_rw+0x23c>
+  802848:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80284c:	75 ca                	jne    802818 <fsring_rw+0x272>
+  80284e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802852:	74 31                	je     802885 <fsring_rw+0x2df>
+  802854:	8b 45 08             	mov    0x8(%ebp),%eax
+  802857:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80285a:	29 c8                	sub    %ecx,%eax
+  80285c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80285f:	39 d0                	cmp    %edx,%eax
+  802861:	0f 47 c2             	cmova  %edx,%eax
+  802864:	39 d8                	cmp    %ebx,%eax
+  802866:	ba 01 00 00 00       	mov    $0x1,%edx
+  80286b:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80286f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802872:	b8 01 00 00 00       	mov    $0x1,%eax
+  802877:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80287b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80287e:	01 d9                	add    %ebx,%ecx
+  802880:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802883:	eb 93                	jmp    802818 <fsring_rw+0x272>
+  802885:	83 ec 04             	sub    $0x4,%esp
+  802888:	53                   	push   %ebx
+  802889:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80288c:	83 e0 07             	and    $0x7,%eax
+  80288f:	c1 e0 0c             	shl    $0xc,%eax
+  802892:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802898:	50                   	push   %eax
+  802899:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80289c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80289f:	01 c8                	add    %ecx,%eax
+  8028a1:	50                   	push   %eax
+  8028a2:	e8 c1 ea ff ff       	call   801368 <memmove>
+  8028a7:	83 c4 10             	add    $0x10,%esp
+  8028aa:	eb a8                	jmp    802854 <fsring_rw+0x2ae>
+  8028ac:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8028b0:	75 09                	jne    8028bb <fsring_rw+0x315>
+  8028b2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8028b5:	0f 82 db fe ff ff    	jb     802796 <fsring_rw+0x1f0>
+  8028bb:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8028be:	01 57 04             	add    %edx,0x4(%edi)
+  8028c1:	85 d2                	test   %edx,%edx
+  8028c3:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8028c7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8028ca:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8028cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028d0:	5b                   	pop    %ebx
+  8028d1:	5e                   	pop    %esi
+  8028d2:	5f                   	pop    %edi
+  8028d3:	5d                   	pop    %ebp
+  8028d4:	c3                   	ret
+
+008028d5 <devfile_write>:
+  8028d5:	55                   	push   %ebp
+  8028d6:	89 e5                	mov    %esp,%ebp
+  8028d8:	57                   	push   %edi
+  8028d9:	56                   	push   %esi
+  8028da:	53                   	push   %ebx
+  8028db:	83 ec 0c             	sub    $0xc,%esp
+  8028de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028e7:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8028ed:	76 1a                	jbe    802909 <devfile_write+0x34>
+  8028ef:	83 ec 0c             	sub    $0xc,%esp
+  8028f2:	53                   	push   %ebx
+  8028f3:	89 f1                	mov    %esi,%ecx
+  8028f5:	ba 06 00 00 00       	mov    $0x6,%edx
+  8028fa:	89 f8                	mov    %edi,%eax
+  8028fc:	e8 a5 fc ff ff       	call   8025a6 <fsring_rw>
+  802901:	83 c4 10             	add    $0x10,%esp
+  802904:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802907:	75 39                	jne    802942 <devfile_write+0x6d>
+  802909:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80290e:	39 c3                	cmp    %eax,%ebx
+  802910:	0f 47 d8             	cmova  %eax,%ebx
+  802913:	8b 47 0c             	mov    0xc(%edi),%eax
+  802916:	a3 00 70 80 00       	mov    %eax,0x807000
+  80291b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802921:	83 ec 04             	sub    $0x4,%esp
+  802924:	53                   	push   %ebx
+  802925:	56                   	push   %esi
+  802926:	68 08 70 80 00       	push   $0x807008
+  80292b:	e8 38 ea ff ff       	call   801368 <memmove>
+  802930:	ba 00 00 00 00       	mov    $0x0,%edx
+  802935:	b8 04 00 00 00       	mov    $0x4,%eax
+  80293a:	e8 7c fb ff ff       	call   8024bb <fsipc>
+  80293f:	83 c4 10             	add    $0x10,%esp
+  802942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802945:	5b                   	pop    %ebx
+  802946:	5e                   	pop    %esi
+  802947:	5f                   	pop    %edi
+  802948:	5d                   	pop    %ebp
+  802949:	c3                   	ret
+
+0080294a <devfile_read>:
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	57                   	push   %edi
+  80294e:	56                   	push   %esi
+  80294f:	53                   	push   %ebx
+  802950:	83 ec 0c             	sub    $0xc,%esp
+  802953:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802956:	8b 75 10             	mov    0x10(%ebp),%esi
+  802959:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80295f:	76 1d                	jbe    80297e <devfile_read+0x34>
+  802961:	83 ec 0c             	sub    $0xc,%esp
+  802964:	56                   	push   %esi
+  802965:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802968:	ba 05 00 00 00       	mov    $0x5,%edx
+  80296d:	89 f8                	mov    %edi,%eax
+  80296f:	e8 32 fc ff ff       	call   8025a6 <fsring_rw>
+  802974:	89 c3                	mov    %eax,%ebx
+  802976:	83 c4 10             	add    $0x10,%esp
+  802979:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80297c:	75 37                	jne    8029b5 <devfile_read+0x6b>
+  80297e:	8b 47 0c             	mov    0xc(%edi),%eax
+  802981:	a3 00 70 80 00       	mov    %eax,0x807000
+  802986:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80298c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802991:	b8 03 00 00 00       	mov    $0x3,%eax
+  802996:	e8 20 fb ff ff       	call   8024bb <fsipc>
+  80299b:	89 c3                	mov    %eax,%ebx
+  80299d:	85 c0                	test   %eax,%eax
+  80299f:	78 14                	js     8029b5 <devfile_read+0x6b>
+  8029a1:	83 ec 04             	sub    $0x4,%esp
+  8029a4:	50                   	push   %eax
+  8029a5:	68 00 70 80 00       	push   $0x807000
+  8029aa:	ff 75 0c             	push   0xc(%ebp)
+  8029ad:	e8 b6 e9 ff ff       	call   801368 <memmove>
+  8029b2:	83 c4 10             	add    $0x10,%esp
+  8029b5:	89 d8                	mov    %ebx,%eax
+  8029b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029ba:	5b                   	pop    %ebx
+  8029bb:	5e                   	pop    %esi
+  8029bc:	5f                   	pop    %edi
+  8029bd:	5d                   	pop    %ebp
+  8029be:	c3                   	ret
+
+008029bf <open>:
+  8029bf:	55                   	push   %ebp
+  8029c0:	89 e5                	mov    %esp,%ebp
+  8029c2:	56                   	push   %esi
+  8029c3:	53                   	push   %ebx
+  8029c4:	83 ec 1c             	sub    $0x1c,%esp
+  8029c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029ca:	56                   	push   %esi
+  8029cb:	e8 9c e7 ff ff       	call   80116c <strlen>
+  8029d0:	83 c4 10             	add    $0x10,%esp
+  8029d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029d8:	7f 6c                	jg     802a46 <open+0x87>
+  8029da:	83 ec 0c             	sub    $0xc,%esp
+  8029dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029e0:	50                   	push   %eax
+  8029e1:	e8 6a f5 ff ff       	call   801f50 <fd_alloc>
+  8029e6:	89 c3                	mov    %eax,%ebx
+  8029e8:	83 c4 10             	add    $0x10,%esp
+  8029eb:	85 c0                	test   %eax,%eax
+  8029ed:	78 3c                	js     802a2b <open+0x6c>
+  8029ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029f2:	a3 00 74 80 00       	mov    %eax,0x807400
+  8029f7:	83 ec 08             	sub    $0x8,%esp
+  8029fa:	56                   	push   %esi
+  8029fb:	68 00 70 80 00       	push   $0x807000
+  802a00:	e8 b3 e7 ff ff       	call   8011b8 <strcpy>
+  802a05:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a08:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a0d:	e8 a9 fa ff ff       	call   8024bb <fsipc>
+  802a12:	89 c3                	mov    %eax,%ebx
+  802a14:	83 c4 10             	add    $0x10,%esp
+  802a17:	85 c0                	test   %eax,%eax
+  802a19:	78 19                	js     802a34 <open+0x75>
+  802a1b:	83 ec 0c             	sub    $0xc,%esp
+  802a1e:	ff 75 f4             	push   -0xc(%ebp)
+  802a21:	e8 03 f5 ff ff       	call   801f29 <fd2num>
+  802a26:	89 c3                	mov    %eax,%ebx
+  802a28:	83 c4 10             	add    $0x10,%esp
+  802a2b:	89 d8                	mov    %ebx,%eax
+  802a2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a30:	5b                   	pop    %ebx
+  802a31:	5e                   	pop    %esi
+  802a32:	5d                   	pop    %ebp
+  802a33:	c3                   	ret
+  802a34:	83 ec 08             	sub    $0x8,%esp
+  802a37:	6a 00                	push   $0x0
+  802a39:	ff 75 f4             	push   -0xc(%ebp)
+  802a3c:	e8 05 f6 ff ff       	call   802046 <fd_close>
+  802a41:	83 c4 10             	add    $0x10,%esp
+  802a44:	eb e5                	jmp    802a2b <open+0x6c>
+  802a46:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a4b:	eb de                	jmp    802a2b <open+0x6c>
+
+00802a4d <file_image>:
+  802a4d:	55                   	push   %ebp
+  802a4e:	89 e5                	mov    %esp,%ebp
+  802a50:	53                   	push   %ebx
+  802a51:	83 ec 1c             	sub    $0x1c,%esp
+  802a54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a5a:	50                   	push   %eax
+  802a5b:	ff 75 08             	push   0x8(%ebp)
+  802a5e:	e8 3d f5 ff ff       	call   801fa0 <fd_lookup>
+  802a63:	83 c4 10             	add    $0x10,%esp
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	78 58                	js     802ac2 <file_image+0x75>
+  802a6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a6d:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802a73:	39 08                	cmp    %ecx,(%eax)
+  802a75:	75 50                	jne    802ac7 <file_image+0x7a>
+  802a77:	83 fb 04             	cmp    $0x4,%ebx
+  802a7a:	77 52                	ja     802ace <file_image+0x81>
+  802a7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a7f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a84:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802a8a:	83 ec 04             	sub    $0x4,%esp
+  802a8d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802a90:	c1 e0 02             	shl    $0x2,%eax
+  802a93:	50                   	push   %eax
+  802a94:	ff 75 0c             	push   0xc(%ebp)
+  802a97:	68 08 70 80 00       	push   $0x807008
+  802a9c:	e8 c7 e8 ff ff       	call   801368 <memmove>
+  802aa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802aab:	e8 0b fa ff ff       	call   8024bb <fsipc>
+  802ab0:	83 c4 10             	add    $0x10,%esp
+  802ab3:	85 c0                	test   %eax,%eax
+  802ab5:	78 0b                	js     802ac2 <file_image+0x75>
+  802ab7:	8b 55 14             	mov    0x14(%ebp),%edx
+  802aba:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802ac0:	89 0a                	mov    %ecx,(%edx)
+  802ac2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac5:	c9                   	leave
+  802ac6:	c3                   	ret
+  802ac7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802acc:	eb f4                	jmp    802ac2 <file_image+0x75>
+  802ace:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad3:	eb ed                	jmp    802ac2 <file_image+0x75>
+
+00802ad5 <remove>:
+  802ad5:	55                   	push   %ebp
+  802ad6:	89 e5                	mov    %esp,%ebp
+  802ad8:	53                   	push   %ebx
+  802ad9:	83 ec 10             	sub    $0x10,%esp
+  802adc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802adf:	53                   	push   %ebx
+  802ae0:	e8 87 e6 ff ff       	call   80116c <strlen>
+  802ae5:	83 c4 10             	add    $0x10,%esp
+  802ae8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802aed:	7f 25                	jg     802b14 <remove+0x3f>
+  802aef:	83 ec 08             	sub    $0x8,%esp
+  802af2:	53                   	push   %ebx
+  802af3:	68 00 70 80 00       	push   $0x807000
+  802af8:	e8 bb e6 ff ff       	call   8011b8 <strcpy>
+  802afd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b02:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b07:	e8 af f9 ff ff       	call   8024bb <fsipc>
+  802b0c:	83 c4 10             	add    $0x10,%esp
+  802b0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b12:	c9                   	leave
+  802b13:	c3                   	ret
+  802b14:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b19:	eb f4                	jmp    802b0f <remove+0x3a>
+
+00802b1b <sync>:
+  802b1b:	55                   	push   %ebp
+  802b1c:	89 e5                	mov    %esp,%ebp
+  802b1e:	83 ec 08             	sub    $0x8,%esp
+  802b21:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b26:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b2b:	e8 8b f9 ff ff       	call   8024bb <fsipc>
+  802b30:	c9                   	leave
+  802b31:	c3                   	ret
+
+00802b32 <devsock_stat>:
+  802b32:	55                   	push   %ebp
+  802b33:	89 e5                	mov    %esp,%ebp
+  802b35:	83 ec 10             	sub    $0x10,%esp
+  802b38:	68 40 47 80 00       	push   $0x804740
+  802b3d:	ff 75 0c             	push   0xc(%ebp)
+  802b40:	e8 73 e6 ff ff       	call   8011b8 <strcpy>
+  802b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4a:	c9                   	leave
+  802b4b:	c3                   	ret
+
+00802b4c <devsock_close>:
+  802b4c:	55                   	push   %ebp
+  802b4d:	89 e5                	mov    %esp,%ebp
+  802b4f:	53                   	push   %ebx
+  802b50:	83 ec 10             	sub    $0x10,%esp
+  802b53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b56:	53                   	push   %ebx
+  802b57:	e8 99 0d 00 00       	call   8038f5 <pageref>
+  802b5c:	89 c2                	mov    %eax,%edx
+  802b5e:	83 c4 10             	add    $0x10,%esp
+  802b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b66:	83 fa 01             	cmp    $0x1,%edx
+  802b69:	74 05                	je     802b70 <devsock_close+0x24>
+  802b6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+  802b70:	83 ec 0c             	sub    $0xc,%esp
+  802b73:	ff 73 0c             	push   0xc(%ebx)
+  802b76:	e8 aa 02 00 00       	call   802e25 <nsipc_close>
+  802b7b:	83 c4 10             	add    $0x10,%esp
+  802b7e:	eb eb                	jmp    802b6b <devsock_close+0x1f>
+
+00802b80 <devsock_write>:
+  802b80:	55                   	push   %ebp
+  802b81:	89 e5                	mov    %esp,%ebp
+  802b83:	83 ec 08             	sub    $0x8,%esp
+  802b86:	6a 00                	push   $0x0
+  802b88:	ff 75 10             	push   0x10(%ebp)
+  802b8b:	ff 75 0c             	push   0xc(%ebp)
+  802b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b91:	ff 70 0c             	push   0xc(%eax)
+  802b94:	e8 6c 03 00 00       	call   802f05 <nsipc_send>
+  802b99:	c9                   	leave
+  802b9a:	c3                   	ret
+
+00802b9b <devsock_read>:
+  802b9b:	55                   	push   %ebp
+  802b9c:	89 e5                	mov    %esp,%ebp
+  802b9e:	83 ec 08             	sub    $0x8,%esp
+  802ba1:	6a 00                	push   $0x0
+  802ba3:	ff 75 10             	push   0x10(%ebp)
+  802ba6:	ff 75 0c             	push   0xc(%ebp)
+  802ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bac:	ff 70 0c             	push   0xc(%eax)
+  802baf:	e8 e2 02 00 00       	call   802e96 <nsipc_recv>
+  802bb4:	c9                   	leave
+  802bb5:	c3                   	ret
+
+00802bb6 <fd2sockid>:
+  802bb6:	55                   	push   %ebp
+  802bb7:	89 e5                	mov    %esp,%ebp
+  802bb9:	83 ec 20             	sub    $0x20,%esp
+  802bbc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bbf:	52                   	push   %edx
+  802bc0:	50                   	push   %eax
+  802bc1:	e8 da f3 ff ff       	call   801fa0 <fd_lookup>
+  802bc6:	83 c4 10             	add    $0x10,%esp
+  802bc9:	85 c0                	test   %eax,%eax
+  802bcb:	78 10                	js     802bdd <fd2sockid+0x27>
+  802bcd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bd0:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802bd6:	39 08                	cmp    %ecx,(%eax)
+  802bd8:	75 05                	jne    802bdf <fd2sockid+0x29>
+  802bda:	8b 40 0c             	mov    0xc(%eax),%eax
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+  802bdf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802be4:	eb f7                	jmp    802bdd <fd2sockid+0x27>
+
+00802be6 <alloc_sockfd>:
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	56                   	push   %esi
+  802bea:	53                   	push   %ebx
+  802beb:	83 ec 1c             	sub    $0x1c,%esp
+  802bee:	89 c6                	mov    %eax,%esi
+  802bf0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bf3:	50                   	push   %eax
+  802bf4:	e8 57 f3 ff ff       	call   801f50 <fd_alloc>
+  802bf9:	89 c3                	mov    %eax,%ebx
+  802bfb:	83 c4 10             	add    $0x10,%esp
+  802bfe:	85 c0                	test   %eax,%eax
+  802c00:	78 43                	js     802c45 <alloc_sockfd+0x5f>
+  802c02:	83 ec 04             	sub    $0x4,%esp
+  802c05:	68 07 04 00 00       	push   $0x407
+  802c0a:	ff 75 f4             	push   -0xc(%ebp)
+  802c0d:	6a 00                	push   $0x0
+  802c0f:	e8 04 ea ff ff       	call   801618 <sys_page_alloc>
+  802c14:	89 c3                	mov    %eax,%ebx
+  802c16:	83 c4 10             	add    $0x10,%esp
+  802c19:	85 c0                	test   %eax,%eax
+  802c1b:	78 28                	js     802c45 <alloc_sockfd+0x5f>
+  802c1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c20:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802c26:	89 10                	mov    %edx,(%eax)
+  802c28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c2b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c32:	89 70 0c             	mov    %esi,0xc(%eax)
+  802c35:	83 ec 0c             	sub    $0xc,%esp
+  802c38:	50                   	push   %eax
+  802c39:	e8 eb f2 ff ff       	call   801f29 <fd2num>
+  802c3e:	89 c3                	mov    %eax,%ebx
+  802c40:	83 c4 10             	add    $0x10,%esp
+  802c43:	eb 0c                	jmp    802c51 <alloc_sockfd+0x6b>
+  802c45:	83 ec 0c             	sub    $0xc,%esp
+  802c48:	56                   	push   %esi
+  802c49:	e8 d7 01 00 00       	call   802e25 <nsipc_close>
+  802c4e:	83 c4 10             	add    $0x10,%esp
+  802c51:	89 d8                	mov    %ebx,%eax
+  802c53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c56:	5b                   	pop    %ebx
+  802c57:	5e                   	pop    %esi
+  802c58:	5d                   	pop    %ebp
+  802c59:	c3                   	ret
+
+00802c5a <accept>:
+  802c5a:	55                   	push   %ebp
+  802c5b:	89 e5                	mov    %esp,%ebp
+  802c5d:	83 ec 08             	sub    $0x8,%esp
+  802c60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c63:	e8 4e ff ff ff       	call   802bb6 <fd2sockid>
+  802c68:	85 c0                	test   %eax,%eax
+  802c6a:	78 1b                	js     802c87 <accept+0x2d>
+  802c6c:	83 ec 04             	sub    $0x4,%esp
+  802c6f:	ff 75 10             	push   0x10(%ebp)
+  802c72:	ff 75 0c             	push   0xc(%ebp)
+  802c75:	50                   	push   %eax
+  802c76:	e8 07 01 00 00       	call   802d82 <nsipc_accept>
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	78 05                	js     802c87 <accept+0x2d>
+  802c82:	e8 5f ff ff ff       	call   802be6 <alloc_sockfd>
+  802c87:	c9                   	leave
+  802c88:	c3                   	ret
+
+00802c89 <bind>:
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	83 ec 08             	sub    $0x8,%esp
+  802c8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c92:	e8 1f ff ff ff       	call   802bb6 <fd2sockid>
+  802c97:	85 c0                	test   %eax,%eax
+  802c99:	78 12                	js     802cad <bind+0x24>
+  802c9b:	83 ec 04             	sub    $0x4,%esp
+  802c9e:	ff 75 10             	push   0x10(%ebp)
+  802ca1:	ff 75 0c             	push   0xc(%ebp)
+  802ca4:	50                   	push   %eax
+  802ca5:	e8 24 01 00 00       	call   802dce <nsipc_bind>
+  802caa:	83 c4 10             	add    $0x10,%esp
+  802cad:	c9                   	leave
+  802cae:	c3                   	ret
+
+00802caf <shutdown>:
+  802caf:	55                   	push   %ebp
+  802cb0:	89 e5                	mov    %esp,%ebp
+  802cb2:	83 ec 08             	sub    $0x8,%esp
+  802cb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb8:	e8 f9 fe ff ff       	call   802bb6 <fd2sockid>
+  802cbd:	85 c0                	test   %eax,%eax
+  802cbf:	78 0f                	js     802cd0 <shutdown+0x21>
+  802cc1:	83 ec 08             	sub    $0x8,%esp
+  802cc4:	ff 75 0c             	push   0xc(%ebp)
+  802cc7:	50                   	push   %eax
+  802cc8:	e8 36 01 00 00       	call   802e03 <nsipc_shutdown>
+  802ccd:	83 c4 10             	add    $0x10,%esp
+  802cd0:	c9                   	leave
+  802cd1:	c3                   	ret
+
+00802cd2 <connect>:
+  802cd2:	55                   	push   %ebp
+  802cd3:	89 e5                	mov    %esp,%ebp
+  802cd5:	83 ec 08             	sub    $0x8,%esp
+  802cd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cdb:	e8 d6 fe ff ff       	call   802bb6 <fd2sockid>
+  802ce0:	85 c0                	test   %eax,%eax
+  802ce2:	78 12                	js     802cf6 <connect+0x24>
+  802ce4:	83 ec 04             	sub    $0x4,%esp
+  802ce7:	ff 75 10             	push   0x10(%ebp)
+  802cea:	ff 75 0c             	push   0xc(%ebp)
+  802ced:	50                   	push   %eax
+  802cee:	e8 4c 01 00 00       	call   802e3f <nsipc_connect>
+  802cf3:	83 c4 10             	add    $0x10,%esp
+  802cf6:	c9                   	leave
+  802cf7:	c3                   	ret
+
+00802cf8 <listen>:
+  802cf8:	55                   	push   %ebp
+  802cf9:	89 e5                	mov    %esp,%ebp
+  802cfb:	83 ec 08             	sub    $0x8,%esp
+  802cfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d01:	e8 b0 fe ff ff       	call   802bb6 <fd2sockid>
+  802d06:	85 c0                	test   %eax,%eax
+  802d08:	78 0f                	js     802d19 <listen+0x21>
+  802d0a:	83 ec 08             	sub    $0x8,%esp
+  802d0d:	ff 75 0c             	push   0xc(%ebp)
+  802d10:	50                   	push   %eax
+  802d11:	e8 5e 01 00 00       	call   802e74 <nsipc_listen>
+  802d16:	83 c4 10             	add    $0x10,%esp
+  802d19:	c9                   	leave
+  802d1a:	c3                   	ret
+
+00802d1b <socket>:
+  802d1b:	55                   	push   %ebp
+  802d1c:	89 e5                	mov    %esp,%ebp
+  802d1e:	83 ec 0c             	sub    $0xc,%esp
+  802d21:	ff 75 10             	push   0x10(%ebp)
+  802d24:	ff 75 0c             	push   0xc(%ebp)
+  802d27:	ff 75 08             	push   0x8(%ebp)
+  802d2a:	e8 34 02 00 00       	call   802f63 <nsipc_socket>
+  802d2f:	83 c4 10             	add    $0x10,%esp
+  802d32:	85 c0                	test   %eax,%eax
+  802d34:	78 05                	js     802d3b <socket+0x20>
+  802d36:	e8 ab fe ff ff       	call   802be6 <alloc_sockfd>
+  802d3b:	c9                   	leave
+  802d3c:	c3                   	ret
+
+00802d3d <nsipc>:
+  802d3d:	55                   	push   %ebp
+  802d3e:	89 e5                	mov    %esp,%ebp
+  802d40:	53                   	push   %ebx
+  802d41:	83 ec 04             	sub    $0x4,%esp
+  802d44:	89 c3                	mov    %eax,%ebx
+  802d46:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802d4d:	74 1f                	je     802d6e <nsipc+0x31>
+  802d4f:	83 ec 08             	sub    $0x8,%esp
+  802d52:	6a 00                	push   $0x0
+  802d54:	6a 00                	push   $0x0
+  802d56:	6a 07                	push   $0x7
+  802d58:	68 00 80 80 00       	push   $0x808000
+  802d5d:	53                   	push   %ebx
+  802d5e:	ff 35 0c 60 80 00    	push   0x80600c
+  802d64:	e8 d7 09 00 00       	call   803740 <ipc_call>
+  802d69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d6c:	c9                   	leave
+  802d6d:	c3                   	ret
+  802d6e:	83 ec 0c             	sub    $0xc,%esp
+  802d71:	6a 03                	push   $0x3
+  802d73:	e8 63 0b 00 00       	call   8038db <ipc_find_env>
+  802d78:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802d7d:	83 c4 10             	add    $0x10,%esp
+  802d80:	eb cd                	jmp    802d4f <nsipc+0x12>
+
+00802d82 <nsipc_accept>:
+  802d82:	55                   	push   %ebp
+  802d83:	89 e5                	mov    %esp,%ebp
+  802d85:	53                   	push   %ebx
+  802d86:	83 ec 04             	sub    $0x4,%esp
+  802d89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8c:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d91:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d96:	e8 a2 ff ff ff       	call   802d3d <nsipc>
+  802d9b:	89 c3                	mov    %eax,%ebx
+  802d9d:	85 c0                	test   %eax,%eax
+  802d9f:	79 07                	jns    802da8 <nsipc_accept+0x26>
+  802da1:	89 d8                	mov    %ebx,%eax
+  802da3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802da6:	c9                   	leave
+  802da7:	c3                   	ret
+  802da8:	83 ec 04             	sub    $0x4,%esp
+  802dab:	ff 35 10 80 80 00    	push   0x808010
+  802db1:	68 00 80 80 00       	push   $0x808000
+  802db6:	ff 75 0c             	push   0xc(%ebp)
+  802db9:	e8 aa e5 ff ff       	call   801368 <memmove>
+  802dbe:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802dc4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dc7:	89 10                	mov    %edx,(%eax)
+  802dc9:	83 c4 10             	add    $0x10,%esp
+  802dcc:	eb d3                	jmp    802da1 <nsipc_accept+0x1f>
+
+00802dce <nsipc_bind>:
+  802dce:	55                   	push   %ebp
+  802dcf:	89 e5                	mov    %esp,%ebp
+  802dd1:	53                   	push   %ebx
+  802dd2:	83 ec 08             	sub    $0x8,%esp
+  802dd5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ddb:	a3 00 80 80 00       	mov    %eax,0x808000
+  802de0:	53                   	push   %ebx
+  802de1:	ff 75 0c             	push   0xc(%ebp)
+  802de4:	68 04 80 80 00       	push   $0x808004
+  802de9:	e8 7a e5 ff ff       	call   801368 <memmove>
+  802dee:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802df4:	b8 02 00 00 00       	mov    $0x2,%eax
+  802df9:	e8 3f ff ff ff       	call   802d3d <nsipc>
+  802dfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e01:	c9                   	leave
+  802e02:	c3                   	ret
+
+00802e03 <nsipc_shutdown>:
+  802e03:	55                   	push   %ebp
+  802e04:	89 e5                	mov    %esp,%ebp
+  802e06:	83 ec 08             	sub    $0x8,%esp
+  802e09:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e0c:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e14:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e19:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e1e:	e8 1a ff ff ff       	call   802d3d <nsipc>
+  802e23:	c9                   	leave
+  802e24:	c3                   	ret
+
+00802e25 <nsipc_close>:
+  802e25:	55                   	push   %ebp
+  802e26:	89 e5                	mov    %esp,%ebp
+  802e28:	83 ec 08             	sub    $0x8,%esp
+  802e2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2e:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e33:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e38:	e8 00 ff ff ff       	call   802d3d <nsipc>
+  802e3d:	c9                   	leave
+  802e3e:	c3                   	ret
+
+00802e3f <nsipc_connect>:
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	53                   	push   %ebx
+  802e43:	83 ec 08             	sub    $0x8,%esp
+  802e46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e4c:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e51:	53                   	push   %ebx
+  802e52:	ff 75 0c             	push   0xc(%ebp)
+  802e55:	68 04 80 80 00       	push   $0x808004
+  802e5a:	e8 09 e5 ff ff       	call   801368 <memmove>
+  802e5f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802e65:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e6a:	e8 ce fe ff ff       	call   802d3d <nsipc>
+  802e6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e72:	c9                   	leave
+  802e73:	c3                   	ret
+
+00802e74 <nsipc_listen>:
+  802e74:	55                   	push   %ebp
+  802e75:	89 e5                	mov    %esp,%ebp
+  802e77:	83 ec 08             	sub    $0x8,%esp
+  802e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e7d:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e85:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e8a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e8f:	e8 a9 fe ff ff       	call   802d3d <nsipc>
+  802e94:	c9                   	leave
+  802e95:	c3                   	ret
+
+00802e96 <nsipc_recv>:
+  802e96:	55                   	push   %ebp
+  802e97:	89 e5                	mov    %esp,%ebp
+  802e99:	56                   	push   %esi
+  802e9a:	53                   	push   %ebx
+  802e9b:	8b 75 10             	mov    0x10(%ebp),%esi
+  802e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea1:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ea6:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802eac:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eaf:	a3 08 80 80 00       	mov    %eax,0x808008
+  802eb4:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eb9:	e8 7f fe ff ff       	call   802d3d <nsipc>
+  802ebe:	89 c3                	mov    %eax,%ebx
+  802ec0:	85 c0                	test   %eax,%eax
+  802ec2:	78 22                	js     802ee6 <nsipc_recv+0x50>
+  802ec4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ec9:	39 c6                	cmp    %eax,%esi
+  802ecb:	0f 4e c6             	cmovle %esi,%eax
+  802ece:	39 c3                	cmp    %eax,%ebx
+  802ed0:	7f 1d                	jg     802eef <nsipc_recv+0x59>
+  802ed2:	83 ec 04             	sub    $0x4,%esp
+  802ed5:	53                   	push   %ebx
+  802ed6:	68 00 80 80 00       	push   $0x808000
+  802edb:	ff 75 0c             	push   0xc(%ebp)
+  802ede:	e8 85 e4 ff ff       	call   801368 <memmove>
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	89 d8                	mov    %ebx,%eax
+  802ee8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eeb:	5b                   	pop    %ebx
+  802eec:	5e                   	pop    %esi
+  802eed:	5d                   	pop    %ebp
+  802eee:	c3                   	ret
+  802eef:	68 4c 47 80 00       	push   $0x80474c
+  802ef4:	68 61 47 80 00       	push   $0x804761
+  802ef9:	6a 60                	push   $0x60
+  802efb:	68 76 47 80 00       	push   $0x804776
+  802f00:	e8 e1 da ff ff       	call   8009e6 <_panic>
+
+00802f05 <nsipc_send>:
+  802f05:	55                   	push   %ebp
+  802f06:	89 e5                	mov    %esp,%ebp
+  802f08:	53                   	push   %ebx
+  802f09:	83 ec 04             	sub    $0x4,%esp
+  802f0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f12:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f17:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f1d:	7f 2e                	jg     802f4d <nsipc_send+0x48>
+  802f1f:	83 ec 04             	sub    $0x4,%esp
+  802f22:	53                   	push   %ebx
+  802f23:	ff 75 0c             	push   0xc(%ebp)
+  802f26:	68 0c 80 80 00       	push   $0x80800c
+  802f2b:	e8 38 e4 ff ff       	call   801368 <memmove>
+  802f30:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802f36:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f39:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f3e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f43:	e8 f5 fd ff ff       	call   802d3d <nsipc>
+  802f48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f4b:	c9                   	leave
+  802f4c:	c3                   	ret
+  802f4d:	68 82 47 80 00       	push   $0x804782
+  802f52:	68 61 47 80 00       	push   $0x804761
+  802f57:	6a 6b                	push   $0x6b
+  802f59:	68 76 47 80 00       	push   $0x804776
+  802f5e:	e8 83 da ff ff       	call   8009e6 <_panic>
+
+00802f63 <nsipc_socket>:
+  802f63:	55                   	push   %ebp
+  802f64:	89 e5                	mov    %esp,%ebp
+  802f66:	83 ec 08             	sub    $0x8,%esp
+  802f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f6c:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f74:	a3 04 80 80 00       	mov    %eax,0x808004
+  802f79:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f7c:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f81:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f86:	e8 b2 fd ff ff       	call   802d3d <nsipc>
+  802f8b:	c9                   	leave
+  802f8c:	c3                   	ret
+
+00802f8d <devpipe_stat>:
+  802f8d:	55                   	push   %ebp
+  802f8e:	89 e5                	mov    %esp,%ebp
+  802f90:	56                   	push   %esi
+  802f91:	53                   	push   %ebx
+  802f92:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802f95:	83 ec 0c             	sub    $0xc,%esp
+  802f98:	ff 75 08             	push   0x8(%ebp)
+  802f9b:	e8 99 ef ff ff       	call   801f39 <fd2data>
+  802fa0:	89 c6                	mov    %eax,%esi
+  802fa2:	83 c4 08             	add    $0x8,%esp
+  802fa5:	68 8e 47 80 00       	push   $0x80478e
+  802faa:	53                   	push   %ebx
+  802fab:	e8 08 e2 ff ff       	call   8011b8 <strcpy>
+  802fb0:	8b 46 04             	mov    0x4(%esi),%eax
+  802fb3:	2b 06                	sub    (%esi),%eax
+  802fb5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802fbb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fc2:	00 00 00 
+  802fc5:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802fcc:	50 80 00 
+  802fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fd7:	5b                   	pop    %ebx
+  802fd8:	5e                   	pop    %esi
+  802fd9:	5d                   	pop    %ebp
+  802fda:	c3                   	ret
+
+00802fdb <devpipe_close>:
+  802fdb:	55                   	push   %ebp
+  802fdc:	89 e5                	mov    %esp,%ebp
+  802fde:	53                   	push   %ebx
+  802fdf:	83 ec 0c             	sub    $0xc,%esp
+  802fe2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fe5:	53                   	push   %ebx
+  802fe6:	6a 00                	push   $0x0
+  802fe8:	e8 fd e6 ff ff       	call   8016ea <sys_page_unmap>
+  802fed:	89 1c 24             	mov    %ebx,(%esp)
+  802ff0:	e8 44 ef ff ff       	call   801f39 <fd2data>
+  802ff5:	83 c4 08             	add    $0x8,%esp
+  802ff8:	50                   	push   %eax
+  802ff9:	6a 00                	push   $0x0
+  802ffb:	e8 ea e6 ff ff       	call   8016ea <sys_page_unmap>
+  803000:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803003:	c9                   	leave
+  803004:	c3                   	ret
+
+00803005 <_pipeisclosed>:
+  803005:	55                   	push   %ebp
+  803006:	89 e5                	mov    %esp,%ebp
+  803008:	57                   	push   %edi
+  803009:	56                   	push   %esi
+  80300a:	53                   	push   %ebx
+  80300b:	83 ec 1c             	sub    $0x1c,%esp
+  80300e:	89 c7                	mov    %eax,%edi
+  803010:	89 d6                	mov    %edx,%esi
+  803012:	a1 84 60 80 00       	mov    0x806084,%eax
+  803017:	8b 58 58             	mov    0x58(%eax),%ebx
+  80301a:	83 ec 0c             	sub    $0xc,%esp
+  80301d:	57                   	push   %edi
+  80301e:	e8 d2 08 00 00       	call   8038f5 <pageref>
+  803023:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803026:	89 34 24             	mov    %esi,(%esp)
+  803029:	e8 c7 08 00 00       	call   8038f5 <pageref>
+  80302e:	8b 15 84 60 80 00    	mov    0x806084,%edx
+  803034:	8b 4a 58             	mov    0x58(%edx),%ecx
+  803037:	83 c4 10             	add    $0x10,%esp
+  80303a:	39 cb                	cmp    %ecx,%ebx
+  80303c:	74 1b                	je     803059 <_pipeisclosed+0x54>
+  80303e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803041:	75 cf                	jne    803012 <_pipeisclosed+0xd>
+  803043:	8b 42 58             	mov    0x58(%edx),%eax
+  803046:	6a 01                	push   $0x1
+  803048:	50                   	push   %eax
+  803049:	53                   	push   %ebx
+  80304a:	68 95 47 80 00       	push   $0x804795
+  80304f:	e8 6d da ff ff       	call   800ac1 <cprintf>
+  803054:	83 c4 10             	add    $0x10,%esp
+  803057:	eb b9                	jmp    803012 <_pipeisclosed+0xd>
+  803059:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80305c:	0f 94 c0             	sete   %al
+  80305f:	0f b6 c0             	movzbl %al,%eax
+  803062:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803065:	5b                   	pop    %ebx
+  803066:	5e                   	pop    %esi
+  803067:	5f                   	pop    %edi
+  803068:	5d                   	pop    %ebp
+  803069:	c3                   	ret
+
+0080306a <devpipe_write>:
+  80306a:	55                   	push   %ebp
+  80306b:	89 e5                	mov    %esp,%ebp
+  80306d:	57                   	push   %edi
+  80306e:	56                   	push   %esi
+  80306f:	53                   	push   %ebx
+  803070:	83 ec 28             	sub    $0x28,%esp
+  803073:	8b 75 08             	mov    0x8(%ebp),%esi
+  803076:	56                   	push   %esi
+  803077:	e8 bd ee ff ff       	call   801f39 <fd2data>
+  80307c:	89 c3                	mov    %eax,%ebx
+  80307e:	83 c4 10             	add    $0x10,%esp
+  803081:	bf 00 00 00 00       	mov    $0x0,%edi
+  803086:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80308a:	74 5c                	je     8030e8 <devpipe_write+0x7e>
+  80308c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80308f:	8b 0b                	mov    (%ebx),%ecx
+  803091:	8d 51 20             	lea    0x20(%ecx),%edx
+  803094:	39 d0                	cmp    %edx,%eax
+  803096:	72 1e                	jb     8030b6 <devpipe_write+0x4c>
+  803098:	89 da                	mov    %ebx,%edx
+  80309a:	89 f0                	mov    %esi,%eax
+  80309c:	e8 64 ff ff ff       	call   803005 <_pipeisclosed>
+  8030a1:	85 c0                	test   %eax,%eax
+  8030a3:	75 48                	jne    8030ed <devpipe_write+0x83>
+  8030a5:	e8 23 e5 ff ff       	call   8015cd <sys_yield>
+  8030aa:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030ad:	8b 0b                	mov    (%ebx),%ecx
+  8030af:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030b2:	39 d0                	cmp    %edx,%eax
+  8030b4:	73 e2                	jae    803098 <devpipe_write+0x2e>
+  8030b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030b9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030bd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030c0:	89 c2                	mov    %eax,%edx
+  8030c2:	c1 fa 1f             	sar    $0x1f,%edx
+  8030c5:	89 d1                	mov    %edx,%ecx
+  8030c7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030ca:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030cd:	83 e2 1f             	and    $0x1f,%edx
+  8030d0:	29 ca                	sub    %ecx,%edx
+  8030d2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030d6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8030da:	83 c0 01             	add    $0x1,%eax
+  8030dd:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030e0:	83 c7 01             	add    $0x1,%edi
+  8030e3:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8030e6:	75 a4                	jne    80308c <devpipe_write+0x22>
+  8030e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030eb:	eb 05                	jmp    8030f2 <devpipe_write+0x88>
+  8030ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f5:	5b                   	pop    %ebx
+  8030f6:	5e                   	pop    %esi
+  8030f7:	5f                   	pop    %edi
+  8030f8:	5d                   	pop    %ebp
+  8030f9:	c3                   	ret
+
+008030fa <devpipe_read>:
+  8030fa:	55                   	push   %ebp
+  8030fb:	89 e5                	mov    %esp,%ebp
+  8030fd:	57                   	push   %edi
+  8030fe:	56                   	push   %esi
+  8030ff:	53                   	push   %ebx
+  803100:	83 ec 18             	sub    $0x18,%esp
+  803103:	8b 75 08             	mov    0x8(%ebp),%esi
+  803106:	56                   	push   %esi
+  803107:	e8 2d ee ff ff       	call   801f39 <fd2data>
+  80310c:	89 c3                	mov    %eax,%ebx
+  80310e:	83 c4 10             	add    $0x10,%esp
+  803111:	bf 00 00 00 00       	mov    $0x0,%edi
+  803116:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80311a:	74 45                	je     803161 <devpipe_read+0x67>
+  80311c:	8b 03                	mov    (%ebx),%eax
+  80311e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803121:	75 1d                	jne    803140 <devpipe_read+0x46>
+  803123:	85 ff                	test   %edi,%edi
+  803125:	75 3f                	jne    803166 <devpipe_read+0x6c>
+  803127:	89 da                	mov    %ebx,%edx
+  803129:	89 f0                	mov    %esi,%eax
+  80312b:	e8 d5 fe ff ff       	call   803005 <_pipeisclosed>
+  803130:	85 c0                	test   %eax,%eax
+  803132:	75 3c                	jne    803170 <devpipe_read+0x76>
+  803134:	e8 94 e4 ff ff       	call   8015cd <sys_yield>
+  803139:	8b 03                	mov    (%ebx),%eax
+  80313b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80313e:	74 e7                	je     803127 <devpipe_read+0x2d>
+  803140:	99                   	cltd
+  803141:	c1 ea 1b             	shr    $0x1b,%edx
+  803144:	01 d0                	add    %edx,%eax
+  803146:	83 e0 1f             	and    $0x1f,%eax
+  803149:	29 d0                	sub    %edx,%eax
+  80314b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803150:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803153:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  803156:	83 03 01             	addl   $0x1,(%ebx)
+  803159:	83 c7 01             	add    $0x1,%edi
+  80315c:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80315f:	75 bb                	jne    80311c <devpipe_read+0x22>
+  803161:	8b 45 10             	mov    0x10(%ebp),%eax
+  803164:	eb 02                	jmp    803168 <devpipe_read+0x6e>
+  803166:	89 f8                	mov    %edi,%eax
+  803168:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80316b:	5b                   	pop    %ebx
+  80316c:	5e                   	pop    %esi
+  80316d:	5f                   	pop    %edi
+  80316e:	5d                   	pop    %ebp
+  80316f:	c3                   	ret
+  803170:	b8 00 00 00 00       	mov    $0x0,%eax
+  803175:	eb f1                	jmp    803168 <devpipe_read+0x6e>
+
+00803177 <pipe>:
+  803177:	55                   	push   %ebp
+  803178:	89 e5                	mov    %esp,%ebp
+  80317a:	56                   	push   %esi
+  80317b:	53                   	push   %ebx
+  80317c:	83 ec 1c             	sub    $0x1c,%esp
+  80317f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803182:	50                   	push   %eax
+  803183:	e8 c8 ed ff ff       	call   801f50 <fd_alloc>
+  803188:	89 c3                	mov    %eax,%ebx
+  80318a:	83 c4 10             	add    $0x10,%esp
+  80318d:	85 c0                	test   %eax,%eax
+  80318f:	0f 88 23 01 00 00    	js     8032b8 <pipe+0x141>
+  803195:	83 ec 04             	sub    $0x4,%esp
+  803198:	68 07 04 00 00       	push   $0x407
+  80319d:	ff 75 f4             	push   -0xc(%ebp)
+  8031a0:	6a 00                	push   $0x0
+  8031a2:	e8 71 e4 ff ff       	call   801618 <sys_page_alloc>
+  8031a7:	89 c3                	mov    %eax,%ebx
+  8031a9:	83 c4 10             	add    $0x10,%esp
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	0f 88 04 01 00 00    	js     8032b8 <pipe+0x141>
+  8031b4:	83 ec 0c             	sub    $0xc,%esp
+  8031b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031ba:	50                   	push   %eax
+  8031bb:	e8 90 ed ff ff       	call   801f50 <fd_alloc>
+  8031c0:	89 c3                	mov    %eax,%ebx
+  8031c2:	83 c4 10             	add    $0x10,%esp
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	0f 88 db 00 00 00    	js     8032a8 <pipe+0x131>
+  8031cd:	83 ec 04             	sub    $0x4,%esp
+  8031d0:	68 07 04 00 00       	push   $0x407
+  8031d5:	ff 75 f0             	push   -0x10(%ebp)
+  8031d8:	6a 00                	push   $0x0
+  8031da:	e8 39 e4 ff ff       	call   801618 <sys_page_alloc>
+  8031df:	89 c3                	mov    %eax,%ebx
+  8031e1:	83 c4 10             	add    $0x10,%esp
+  8031e4:	85 c0                	test   %eax,%eax
+  8031e6:	0f 88 bc 00 00 00    	js     8032a8 <pipe+0x131>
+  8031ec:	83 ec 0c             	sub    $0xc,%esp
+  8031ef:	ff 75 f4             	push   -0xc(%ebp)
+  8031f2:	e8 42 ed ff ff       	call   801f39 <fd2data>
+  8031f7:	89 c6                	mov    %eax,%esi
+  8031f9:	83 c4 0c             	add    $0xc,%esp
+  8031fc:	68 07 04 00 00       	push   $0x407
+  803201:	50                   	push   %eax
+  803202:	6a 00                	push   $0x0
+  803204:	e8 0f e4 ff ff       	call   801618 <sys_page_alloc>
+  803209:	89 c3                	mov    %eax,%ebx
+  80320b:	83 c4 10             	add    $0x10,%esp
+  80320e:	85 c0                	test   %eax,%eax
+  803210:	0f 88 82 00 00 00    	js     803298 <pipe+0x121>
+  803216:	83 ec 0c             	sub    $0xc,%esp
+  803219:	ff 75 f0             	push   -0x10(%ebp)
+  80321c:	e8 18 ed ff ff       	call   801f39 <fd2data>
+  803221:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803228:	50                   	push   %eax
+  803229:	6a 00                	push   $0x0
+  80322b:	56                   	push   %esi
+  80322c:	6a 00                	push   $0x0
+  80322e:	e8 28 e4 ff ff       	call   80165b <sys_page_map>
+  803233:	89 c3                	mov    %eax,%ebx
+  803235:	83 c4 20             	add    $0x20,%esp
+  803238:	85 c0                	test   %eax,%eax
+  80323a:	78 4e                	js     80328a <pipe+0x113>
+  80323c:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  803241:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803244:	89 02                	mov    %eax,(%edx)
+  803246:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803249:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803250:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803253:	89 02                	mov    %eax,(%edx)
+  803255:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803258:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80325f:	83 ec 0c             	sub    $0xc,%esp
+  803262:	ff 75 f4             	push   -0xc(%ebp)
+  803265:	e8 bf ec ff ff       	call   801f29 <fd2num>
+  80326a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80326d:	89 01                	mov    %eax,(%ecx)
+  80326f:	83 c4 04             	add    $0x4,%esp
+  803272:	ff 75 f0             	push   -0x10(%ebp)
+  803275:	e8 af ec ff ff       	call   801f29 <fd2num>
+  80327a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80327d:	89 41 04             	mov    %eax,0x4(%ecx)
+  803280:	83 c4 10             	add    $0x10,%esp
+  803283:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803288:	eb 2e                	jmp    8032b8 <pipe+0x141>
+  80328a:	83 ec 08             	sub    $0x8,%esp
+  80328d:	56                   	push   %esi
+  80328e:	6a 00                	push   $0x0
+  803290:	e8 55 e4 ff ff       	call   8016ea <sys_page_unmap>
+  803295:	83 c4 10             	add    $0x10,%esp
+  803298:	83 ec 08             	sub    $0x8,%esp
+  80329b:	ff 75 f0             	push   -0x10(%ebp)
+  80329e:	6a 00                	push   $0x0
+  8032a0:	e8 45 e4 ff ff       	call   8016ea <sys_page_unmap>
+  8032a5:	83 c4 10             	add    $0x10,%esp
+  8032a8:	83 ec 08             	sub    $0x8,%esp
+  8032ab:	ff 75 f4             	push   -0xc(%ebp)
+  8032ae:	6a 00                	push   $0x0
+  8032b0:	e8 35 e4 ff ff       	call   8016ea <sys_page_unmap>
+  8032b5:	83 c4 10             	add    $0x10,%esp
+  8032b8:	89 d8                	mov    %ebx,%eax
+  8032ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032bd:	5b                   	pop    %ebx
+  8032be:	5e                   	pop    %esi
+  8032bf:	5d                   	pop    %ebp
+  8032c0:	c3                   	ret
+
+008032c1 <pipeisclosed>:
+  8032c1:	55                   	push   %ebp
+  8032c2:	89 e5                	mov    %esp,%ebp
+  8032c4:	83 ec 20             	sub    $0x20,%esp
+  8032c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032ca:	50                   	push   %eax
+  8032cb:	ff 75 08             	push   0x8(%ebp)
+  8032ce:	e8 cd ec ff ff       	call   801fa0 <fd_lookup>
+  8032d3:	83 c4 10             	add    $0x10,%esp
+  8032d6:	85 c0                	test   %eax,%eax
+  8032d8:	78 18                	js     8032f2 <pipeisclosed+0x31>
+  8032da:	83 ec 0c             	sub    $0xc,%esp
+  8032dd:	ff 75 f4             	push   -0xc(%ebp)
+  8032e0:	e8 54 ec ff ff       	call   801f39 <fd2data>
+  8032e5:	89 c2                	mov    %eax,%edx
+  8032e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032ea:	e8 16 fd ff ff       	call   803005 <_pipeisclosed>
+  8032ef:	83 c4 10             	add    $0x10,%esp
+  8032f2:	c9                   	leave
+  8032f3:	c3                   	ret
+
+008032f4 <ipcring_init>:
+  8032f4:	55                   	push   %ebp
+  8032f5:	89 e5                	mov    %esp,%ebp
+  8032f7:	53                   	push   %ebx
+  8032f8:	83 ec 08             	sub    $0x8,%esp
+  8032fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8032fe:	6a 60                	push   $0x60
+  803300:	6a 00                	push   $0x0
+  803302:	53                   	push   %ebx
+  803303:	e8 2b e0 ff ff       	call   801333 <memset>
+  803308:	a1 84 60 80 00       	mov    0x806084,%eax
+  80330d:	8b 40 48             	mov    0x48(%eax),%eax
+  803310:	89 03                	mov    %eax,(%ebx)
+  803312:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803315:	89 43 04             	mov    %eax,0x4(%ebx)
+  803318:	8b 45 10             	mov    0x10(%ebp),%eax
+  80331b:	89 43 08             	mov    %eax,0x8(%ebx)
+  80331e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803321:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803324:	83 c4 10             	add    $0x10,%esp
+  803327:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80332a:	c9                   	leave
+  80332b:	c3                   	ret
+
+0080332c <ipcring_req_slot>:
+  80332c:	55                   	push   %ebp
+  80332d:	89 e5                	mov    %esp,%ebp
+  80332f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803332:	8b 50 10             	mov    0x10(%eax),%edx
+  803335:	8b 48 18             	mov    0x18(%eax),%ecx
+  803338:	29 ca                	sub    %ecx,%edx
+  80333a:	83 fa 07             	cmp    $0x7,%edx
+  80333d:	77 0c                	ja     80334b <ipcring_req_slot+0x1f>
+  80333f:	8b 50 10             	mov    0x10(%eax),%edx
+  803342:	83 e2 07             	and    $0x7,%edx
+  803345:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803349:	5d                   	pop    %ebp
+  80334a:	c3                   	ret
+  80334b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803350:	eb f7                	jmp    803349 <ipcring_req_slot+0x1d>
+
+00803352 <ipcring_req_push>:
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	83 ec 08             	sub    $0x8,%esp
+  803358:	8b 55 08             	mov    0x8(%ebp),%edx
+  80335b:	8b 42 10             	mov    0x10(%edx),%eax
+  80335e:	83 c0 01             	add    $0x1,%eax
+  803361:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336a:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80336e:	85 c0                	test   %eax,%eax
+  803370:	75 02                	jne    803374 <ipcring_req_push+0x22>
+  803372:	c9                   	leave
+  803373:	c3                   	ret
+  803374:	6a 00                	push   $0x0
+  803376:	68 00 00 80 ee       	push   $0xee800000
+  80337b:	ff 72 08             	push   0x8(%edx)
+  80337e:	ff 72 04             	push   0x4(%edx)
+  803381:	e8 ca e5 ff ff       	call   801950 <sys_ipc_send>
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	eb e7                	jmp    803372 <ipcring_req_push+0x20>
+
+0080338b <ipcring_rsp_wait>:
+  80338b:	55                   	push   %ebp
+  80338c:	89 e5                	mov    %esp,%ebp
+  80338e:	53                   	push   %ebx
+  80338f:	83 ec 04             	sub    $0x4,%esp
+  803392:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803395:	8b 53 18             	mov    0x18(%ebx),%edx
+  803398:	8b 43 10             	mov    0x10(%ebx),%eax
+  80339b:	39 c2                	cmp    %eax,%edx
+  80339d:	74 3c                	je     8033db <ipcring_rsp_wait+0x50>
+  80339f:	8b 53 14             	mov    0x14(%ebx),%edx
+  8033a2:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033a5:	39 c2                	cmp    %eax,%edx
+  8033a7:	75 23                	jne    8033cc <ipcring_rsp_wait+0x41>
+  8033a9:	83 ec 08             	sub    $0x8,%esp
+  8033ac:	6a 00                	push   $0x0
+  8033ae:	6a 00                	push   $0x0
+  8033b0:	6a 00                	push   $0x0
+  8033b2:	6a 00                	push   $0x0
+  8033b4:	ff 73 0c             	push   0xc(%ebx)
+  8033b7:	ff 73 04             	push   0x4(%ebx)
+  8033ba:	e8 81 03 00 00       	call   803740 <ipc_call>
+  8033bf:	8b 53 14             	mov    0x14(%ebx),%edx
+  8033c2:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033c5:	83 c4 20             	add    $0x20,%esp
+  8033c8:	39 c2                	cmp    %eax,%edx
+  8033ca:	74 dd                	je     8033a9 <ipcring_rsp_wait+0x1e>
+  8033cc:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033cf:	83 e0 07             	and    $0x7,%eax
+  8033d2:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8033d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+  8033db:	68 b0 47 80 00       	push   $0x8047b0
+  8033e0:	68 61 47 80 00       	push   $0x804761
+  8033e5:	6a 3b                	push   $0x3b
+  8033e7:	68 d1 47 80 00       	push   $0x8047d1
+  8033ec:	e8 f5 d5 ff ff       	call   8009e6 <_panic>
+
+008033f1 <ipcring_rsp_pop>:
+  8033f1:	55                   	push   %ebp
+  8033f2:	89 e5                	mov    %esp,%ebp
+  8033f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033f7:	8b 42 18             	mov    0x18(%edx),%eax
+  8033fa:	83 c0 01             	add    $0x1,%eax
+  8033fd:	89 42 18             	mov    %eax,0x18(%edx)
+  803400:	5d                   	pop    %ebp
+  803401:	c3                   	ret
+
+00803402 <ipcring_server_init>:
+  803402:	55                   	push   %ebp
+  803403:	89 e5                	mov    %esp,%ebp
+  803405:	8b 45 08             	mov    0x8(%ebp),%eax
+  803408:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80340b:	89 10                	mov    %edx,(%eax)
+  80340d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803410:	89 50 04             	mov    %edx,0x4(%eax)
+  803413:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80341a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803421:	5d                   	pop    %ebp
+  803422:	c3                   	ret
+
+00803423 <ipcring_req_avail>:
+  803423:	55                   	push   %ebp
+  803424:	89 e5                	mov    %esp,%ebp
+  803426:	8b 55 08             	mov    0x8(%ebp),%edx
+  803429:	8b 02                	mov    (%edx),%eax
+  80342b:	8b 40 10             	mov    0x10(%eax),%eax
+  80342e:	2b 42 08             	sub    0x8(%edx),%eax
+  803431:	ba 08 00 00 00       	mov    $0x8,%edx
+  803436:	39 d0                	cmp    %edx,%eax
+  803438:	0f 47 c2             	cmova  %edx,%eax
+  80343b:	5d                   	pop    %ebp
+  80343c:	c3                   	ret
+
+0080343d <ipcring_req_peek>:
+  80343d:	55                   	push   %ebp
+  80343e:	89 e5                	mov    %esp,%ebp
+  803440:	8b 55 08             	mov    0x8(%ebp),%edx
+  803443:	8b 42 08             	mov    0x8(%edx),%eax
+  803446:	83 e0 07             	and    $0x7,%eax
+  803449:	8b 12                	mov    (%edx),%edx
+  80344b:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80344f:	5d                   	pop    %ebp
+  803450:	c3                   	ret
+
+00803451 <ipcring_rsp_push>:
+  803451:	55                   	push   %ebp
+  803452:	89 e5                	mov    %esp,%ebp
+  803454:	83 ec 08             	sub    $0x8,%esp
+  803457:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80345a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80345d:	83 c0 01             	add    $0x1,%eax
+  803460:	89 41 08             	mov    %eax,0x8(%ecx)
+  803463:	8b 11                	mov    (%ecx),%edx
+  803465:	83 c2 14             	add    $0x14,%edx
+  803468:	f0 87 02             	lock xchg %eax,(%edx)
+  80346b:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80346f:	75 02                	jne    803473 <ipcring_rsp_push+0x22>
+  803471:	c9                   	leave
+  803472:	c3                   	ret
+  803473:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80347a:	6a 00                	push   $0x0
+  80347c:	68 00 00 80 ee       	push   $0xee800000
+  803481:	6a 00                	push   $0x0
+  803483:	ff 71 04             	push   0x4(%ecx)
+  803486:	e8 e8 e3 ff ff       	call   801873 <sys_ipc_try_send>
+  80348b:	83 c4 10             	add    $0x10,%esp
+  80348e:	eb e1                	jmp    803471 <ipcring_rsp_push+0x20>
+
+00803490 <ipcring_client_wait>:
+  803490:	55                   	push   %ebp
+  803491:	89 e5                	mov    %esp,%ebp
+  803493:	83 ec 08             	sub    $0x8,%esp
+  803496:	8b 45 08             	mov    0x8(%ebp),%eax
+  803499:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8034a0:	8b 10                	mov    (%eax),%edx
+  8034a2:	8b 52 18             	mov    0x18(%edx),%edx
+  8034a5:	3b 50 08             	cmp    0x8(%eax),%edx
+  8034a8:	75 02                	jne    8034ac <ipcring_client_wait+0x1c>
+  8034aa:	c9                   	leave
+  8034ab:	c3                   	ret
+  8034ac:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8034b3:	6a 00                	push   $0x0
+  8034b5:	68 00 00 80 ee       	push   $0xee800000
+  8034ba:	6a 00                	push   $0x0
+  8034bc:	ff 70 04             	push   0x4(%eax)
+  8034bf:	e8 af e3 ff ff       	call   801873 <sys_ipc_try_send>
+  8034c4:	83 c4 10             	add    $0x10,%esp
+  8034c7:	eb e1                	jmp    8034aa <ipcring_client_wait+0x1a>
+
+008034c9 <ipcring_server_sleep>:
+  8034c9:	55                   	push   %ebp
+  8034ca:	89 e5                	mov    %esp,%ebp
+  8034cc:	53                   	push   %ebx
+  8034cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034d0:	8b 01                	mov    (%ecx),%eax
+  8034d2:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8034d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034da:	f0 87 02             	lock xchg %eax,(%edx)
+  8034dd:	8b 11                	mov    (%ecx),%edx
+  8034df:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8034e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034e7:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8034ea:	74 0e                	je     8034fa <ipcring_server_sleep+0x31>
+  8034ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f1:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8034f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034fd:	c9                   	leave
+  8034fe:	c3                   	ret
+
+008034ff <devcons_close>:
+  8034ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803504:	c3                   	ret
+
+00803505 <devcons_stat>:
+  803505:	55                   	push   %ebp
+  803506:	89 e5                	mov    %esp,%ebp
+  803508:	83 ec 10             	sub    $0x10,%esp
+  80350b:	68 df 47 80 00       	push   $0x8047df
+  803510:	ff 75 0c             	push   0xc(%ebp)
+  803513:	e8 a0 dc ff ff       	call   8011b8 <strcpy>
+  803518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351d:	c9                   	leave
+  80351e:	c3                   	ret
+
+0080351f <devcons_write>:
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	57                   	push   %edi
+  803523:	56                   	push   %esi
+  803524:	53                   	push   %ebx
+  803525:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80352b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80352e:	85 ff                	test   %edi,%edi
+  803530:	74 51                	je     803583 <devcons_write+0x64>
+  803532:	be 00 00 00 00       	mov    $0x0,%esi
+  803537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353c:	89 fb                	mov    %edi,%ebx
+  80353e:	29 c3                	sub    %eax,%ebx
+  803540:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803545:	39 d3                	cmp    %edx,%ebx
+  803547:	0f 47 da             	cmova  %edx,%ebx
+  80354a:	83 ec 04             	sub    $0x4,%esp
+  80354d:	53                   	push   %ebx
+  80354e:	03 45 0c             	add    0xc(%ebp),%eax
+  803551:	50                   	push   %eax
+  803552:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803558:	50                   	push   %eax
+  803559:	e8 0a de ff ff       	call   801368 <memmove>
+  80355e:	83 c4 08             	add    $0x8,%esp
+  803561:	53                   	push   %ebx
+  803562:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803568:	50                   	push   %eax
+  803569:	e8 c2 df ff ff       	call   801530 <sys_cputs>
+  80356e:	01 de                	add    %ebx,%esi
+  803570:	89 f0                	mov    %esi,%eax
+  803572:	83 c4 10             	add    $0x10,%esp
+  803575:	39 fe                	cmp    %edi,%esi
+  803577:	72 c3                	jb     80353c <devcons_write+0x1d>
+  803579:	89 f0                	mov    %esi,%eax
+  80357b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80357e:	5b                   	pop    %ebx
+  80357f:	5e                   	pop    %esi
+  803580:	5f                   	pop    %edi
+  803581:	5d                   	pop    %ebp
+  803582:	c3                   	ret
+  803583:	be 00 00 00 00       	mov    $0x0,%esi
+  803588:	eb ef                	jmp    803579 <devcons_write+0x5a>
+
+0080358a <devcons_read>:
+  80358a:	55                   	push   %ebp
+  80358b:	89 e5                	mov    %esp,%ebp
+  80358d:	83 ec 08             	sub    $0x8,%esp
+  803590:	b8 00 00 00 00       	mov    $0x0,%eax
+  803595:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803599:	75 07                	jne    8035a2 <devcons_read+0x18>
+  80359b:	eb 1f                	jmp    8035bc <devcons_read+0x32>
+  80359d:	e8 2b e0 ff ff       	call   8015cd <sys_yield>
+  8035a2:	e8 a7 df ff ff       	call   80154e <sys_cgetc>
+  8035a7:	85 c0                	test   %eax,%eax
+  8035a9:	74 f2                	je     80359d <devcons_read+0x13>
+  8035ab:	78 0f                	js     8035bc <devcons_read+0x32>
+  8035ad:	83 f8 04             	cmp    $0x4,%eax
+  8035b0:	74 0c                	je     8035be <devcons_read+0x34>
+  8035b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035b5:	88 02                	mov    %al,(%edx)
+  8035b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035bc:	c9                   	leave
+  8035bd:	c3                   	ret
+  8035be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c3:	eb f7                	jmp    8035bc <devcons_read+0x32>
+
+008035c5 <cputchar>:
+  8035c5:	55                   	push   %ebp
+  8035c6:	89 e5                	mov    %esp,%ebp
+  8035c8:	83 ec 20             	sub    $0x20,%esp
+  8035cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ce:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8035d1:	6a 01                	push   $0x1
+  8035d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035d6:	50                   	push   %eax
+  8035d7:	e8 54 df ff ff       	call   801530 <sys_cputs>
+  8035dc:	83 c4 10             	add    $0x10,%esp
+  8035df:	c9                   	leave
+  8035e0:	c3                   	ret
+
+008035e1 <getchar>:
+  8035e1:	55                   	push   %ebp
+  8035e2:	89 e5                	mov    %esp,%ebp
+  8035e4:	83 ec 1c             	sub    $0x1c,%esp
+  8035e7:	6a 01                	push   $0x1
+  8035e9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035ec:	50                   	push   %eax
+  8035ed:	6a 00                	push   $0x0
+  8035ef:	e8 0e ec ff ff       	call   802202 <read>
+  8035f4:	83 c4 10             	add    $0x10,%esp
+  8035f7:	85 c0                	test   %eax,%eax
+  8035f9:	78 06                	js     803601 <getchar+0x20>
+  8035fb:	74 06                	je     803603 <getchar+0x22>
+  8035fd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803601:	c9                   	leave
+  803602:	c3                   	ret
+  803603:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803608:	eb f7                	jmp    803601 <getchar+0x20>
+
+0080360a <iscons>:
+  80360a:	55                   	push   %ebp
+  80360b:	89 e5                	mov    %esp,%ebp
+  80360d:	83 ec 20             	sub    $0x20,%esp
+  803610:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803613:	50                   	push   %eax
+  803614:	ff 75 08             	push   0x8(%ebp)
+  803617:	e8 84 e9 ff ff       	call   801fa0 <fd_lookup>
+  80361c:	83 c4 10             	add    $0x10,%esp
+  80361f:	85 c0                	test   %eax,%eax
+  803621:	78 11                	js     803634 <iscons+0x2a>
+  803623:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803626:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  80362c:	39 10                	cmp    %edx,(%eax)
+  80362e:	0f 94 c0             	sete   %al
+  803631:	0f b6 c0             	movzbl %al,%eax
+  803634:	c9                   	leave
+  803635:	c3                   	ret
+
+00803636 <opencons>:
+  803636:	55                   	push   %ebp
+  803637:	89 e5                	mov    %esp,%ebp
+  803639:	83 ec 24             	sub    $0x24,%esp
+  80363c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80363f:	50                   	push   %eax
+  803640:	e8 0b e9 ff ff       	call   801f50 <fd_alloc>
+  803645:	83 c4 10             	add    $0x10,%esp
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	78 3a                	js     803686 <opencons+0x50>
+  80364c:	83 ec 04             	sub    $0x4,%esp
+  80364f:	68 07 04 00 00       	push   $0x407
+  803654:	ff 75 f4             	push   -0xc(%ebp)
+  803657:	6a 00                	push   $0x0
+  803659:	e8 ba df ff ff       	call   801618 <sys_page_alloc>
+  80365e:	83 c4 10             	add    $0x10,%esp
+  803661:	85 c0                	test   %eax,%eax
+  803663:	78 21                	js     803686 <opencons+0x50>
+  803665:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803668:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  80366e:	89 10                	mov    %edx,(%eax)
+  803670:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803673:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80367a:	83 ec 0c             	sub    $0xc,%esp
+  80367d:	50                   	push   %eax
+  80367e:	e8 a6 e8 ff ff       	call   801f29 <fd2num>
+  803683:	83 c4 10             	add    $0x10,%esp
+  803686:	c9                   	leave
+  803687:	c3                   	ret
+
+00803688 <ipc_recv>:
+  803688:	55                   	push   %ebp
+  803689:	89 e5                	mov    %esp,%ebp
+  80368b:	56                   	push   %esi
+  80368c:	53                   	push   %ebx
+  80368d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803690:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803693:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803696:	85 c0                	test   %eax,%eax
+  803698:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  80369d:	0f 44 c2             	cmove  %edx,%eax
+  8036a0:	83 ec 0c             	sub    $0xc,%esp
+  8036a3:	50                   	push   %eax
+  8036a4:	e8 1a e2 ff ff       	call   8018c3 <sys_ipc_recv>
+  8036a9:	83 c4 10             	add    $0x10,%esp
+  8036ac:	85 c0                	test   %eax,%eax
+  8036ae:	78 2a                	js     8036da <ipc_recv+0x52>
+  8036b0:	a1 84 60 80 00       	mov    0x806084,%eax
+  8036b5:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8036bb:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8036c1:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8036c7:	85 f6                	test   %esi,%esi
+  8036c9:	74 02                	je     8036cd <ipc_recv+0x45>
+  8036cb:	89 0e                	mov    %ecx,(%esi)
+  8036cd:	85 db                	test   %ebx,%ebx
+  8036cf:	74 02                	je     8036d3 <ipc_recv+0x4b>
+  8036d1:	89 13                	mov    %edx,(%ebx)
+  8036d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036d6:	5b                   	pop    %ebx
+  8036d7:	5e                   	pop    %esi
+  8036d8:	5d                   	pop    %ebp
+  8036d9:	c3                   	ret
+  8036da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036e4:	eb e1                	jmp    8036c7 <ipc_recv+0x3f>
+
+008036e6 <ipc_send>:
+  8036e6:	55                   	push   %ebp
+  8036e7:	89 e5                	mov    %esp,%ebp
+  8036e9:	57                   	push   %edi
+  8036ea:	56                   	push   %esi
+  8036eb:	53                   	push   %ebx
+  8036ec:	83 ec 0c             	sub    $0xc,%esp
+  8036ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8036f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8036f5:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036f8:	85 db                	test   %ebx,%ebx
+  8036fa:	74 1e                	je     80371a <ipc_send+0x34>
+  8036fc:	56                   	push   %esi
+  8036fd:	53                   	push   %ebx
+  8036fe:	57                   	push   %edi
+  8036ff:	ff 75 08             	push   0x8(%ebp)
+  803702:	e8 49 e2 ff ff       	call   801950 <sys_ipc_send>
+  803707:	83 c4 10             	add    $0x10,%esp
+  80370a:	85 c0                	test   %eax,%eax
+  80370c:	74 2a                	je     803738 <ipc_send+0x52>
+  80370e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803711:	75 13                	jne    803726 <ipc_send+0x40>
+  803713:	e8 b5 de ff ff       	call   8015cd <sys_yield>
+  803718:	eb e2                	jmp    8036fc <ipc_send+0x16>
+  80371a:	be 00 00 00 00       	mov    $0x0,%esi
+  80371f:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803724:	eb d6                	jmp    8036fc <ipc_send+0x16>
+  803726:	50                   	push   %eax
+  803727:	68 ec 47 80 00       	push   $0x8047ec
+  80372c:	6a 4f                	push   $0x4f
+  80372e:	68 2f 48 80 00       	push   $0x80482f
+  803733:	e8 ae d2 ff ff       	call   8009e6 <_panic>
+  803738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80373b:	5b                   	pop    %ebx
+  80373c:	5e                   	pop    %esi
+  80373d:	5f                   	pop    %edi
+  80373e:	5d                   	pop    %ebp
+  80373f:	c3                   	ret
+
+00803740 <ipc_call>:
+  803740:	55                   	push   %ebp
+  803741:	89 e5                	mov    %esp,%ebp
+  803743:	57                   	push   %edi
+  803744:	56                   	push   %esi
+  803745:	53                   	push   %ebx
+  803746:	83 ec 0c             	sub    $0xc,%esp
+  803749:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80374d:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803752:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803756:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80375a:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  80375f:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803763:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803767:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80376c:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803770:	eb 05                	jmp    803777 <ipc_call+0x37>
+  803772:	e8 56 de ff ff       	call   8015cd <sys_yield>
+  803777:	83 ec 0c             	sub    $0xc,%esp
+  80377a:	56                   	push   %esi
+  80377b:	53                   	push   %ebx
+  80377c:	57                   	push   %edi
+  80377d:	ff 75 0c             	push   0xc(%ebp)
+  803780:	ff 75 08             	push   0x8(%ebp)
+  803783:	e8 18 e2 ff ff       	call   8019a0 <sys_ipc_call>
+  803788:	83 c4 20             	add    $0x20,%esp
+  80378b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80378e:	74 e2                	je     803772 <ipc_call+0x32>
+  803790:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803793:	74 2d                	je     8037c2 <ipc_call+0x82>
+  803795:	85 c0                	test   %eax,%eax
+  803797:	78 4f                	js     8037e8 <ipc_call+0xa8>
+  803799:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80379d:	74 10                	je     8037af <ipc_call+0x6f>
+  80379f:	a1 84 60 80 00       	mov    0x806084,%eax
+  8037a4:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8037aa:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8037ad:	89 02                	mov    %eax,(%edx)
+  8037af:	a1 84 60 80 00       	mov    0x806084,%eax
+  8037b4:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8037ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037bd:	5b                   	pop    %ebx
+  8037be:	5e                   	pop    %esi
+  8037bf:	5f                   	pop    %edi
+  8037c0:	5d                   	pop    %ebp
+  8037c1:	c3                   	ret
+  8037c2:	ff 75 14             	push   0x14(%ebp)
+  8037c5:	ff 75 10             	push   0x10(%ebp)
+  8037c8:	ff 75 0c             	push   0xc(%ebp)
+  8037cb:	ff 75 08             	push   0x8(%ebp)
+  8037ce:	e8 13 ff ff ff       	call   8036e6 <ipc_send>
+  8037d3:	83 c4 0c             	add    $0xc,%esp
+  8037d6:	ff 75 1c             	push   0x1c(%ebp)
+  8037d9:	ff 75 18             	push   0x18(%ebp)
+  8037dc:	6a 00                	push   $0x0
+  8037de:	e8 a5 fe ff ff       	call   803688 <ipc_recv>
+  8037e3:	83 c4 10             	add    $0x10,%esp
+  8037e6:	eb d2                	jmp    8037ba <ipc_call+0x7a>
+  8037e8:	50                   	push   %eax
+  8037e9:	68 39 48 80 00       	push   $0x804839
+  8037ee:	6a 6d                	push   $0x6d
+  8037f0:	68 2f 48 80 00       	push   $0x80482f
+  8037f5:	e8 ec d1 ff ff       	call   8009e6 <_panic>
+
+008037fa <ipc_reply_recv>:
+  8037fa:	55                   	push   %ebp
+  8037fb:	89 e5                	mov    %esp,%ebp
+  8037fd:	57                   	push   %edi
+  8037fe:	56                   	push   %esi
+  8037ff:	53                   	push   %ebx
+  803800:	83 ec 0c             	sub    $0xc,%esp
+  803803:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803806:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803809:	8b 7d 20             	mov    0x20(%ebp),%edi
+  80380c:	85 db                	test   %ebx,%ebx
+  80380e:	0f 84 ac 00 00 00    	je     8038c0 <ipc_reply_recv+0xc6>
+  803814:	85 f6                	test   %esi,%esi
+  803816:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80381b:	0f 45 c6             	cmovne %esi,%eax
+  80381e:	83 ec 0c             	sub    $0xc,%esp
+  803821:	50                   	push   %eax
+  803822:	ff 75 14             	push   0x14(%ebp)
+  803825:	53                   	push   %ebx
+  803826:	ff 75 0c             	push   0xc(%ebp)
+  803829:	ff 75 08             	push   0x8(%ebp)
+  80382c:	e8 90 e1 ff ff       	call   8019c1 <sys_ipc_reply_recv>
+  803831:	83 c4 20             	add    $0x20,%esp
+  803834:	85 c0                	test   %eax,%eax
+  803836:	78 3a                	js     803872 <ipc_reply_recv+0x78>
+  803838:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80383c:	74 10                	je     80384e <ipc_reply_recv+0x54>
+  80383e:	a1 84 60 80 00       	mov    0x806084,%eax
+  803843:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803849:	8b 55 18             	mov    0x18(%ebp),%edx
+  80384c:	89 02                	mov    %eax,(%edx)
+  80384e:	85 ff                	test   %edi,%edi
+  803850:	74 0d                	je     80385f <ipc_reply_recv+0x65>
+  803852:	a1 84 60 80 00       	mov    0x806084,%eax
+  803857:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80385d:	89 07                	mov    %eax,(%edi)
+  80385f:	a1 84 60 80 00       	mov    0x806084,%eax
+  803864:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80386a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80386d:	5b                   	pop    %ebx
+  80386e:	5e                   	pop    %esi
+  80386f:	5f                   	pop    %edi
+  803870:	5d                   	pop    %ebp
+  803871:	c3                   	ret
+  803872:	ff 75 14             	push   0x14(%ebp)
+  803875:	53                   	push   %ebx
+  803876:	ff 75 0c             	push   0xc(%ebp)
+  803879:	ff 75 08             	push   0x8(%ebp)
+  80387c:	e8 f2 df ff ff       	call   801873 <sys_ipc_try_send>
+  803881:	89 c2                	mov    %eax,%edx
+  803883:	c1 ea 1f             	shr    $0x1f,%edx
+  803886:	83 c4 10             	add    $0x10,%esp
+  803889:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80388c:	0f 95 c1             	setne  %cl
+  80388f:	84 d1                	test   %dl,%cl
+  803891:	74 05                	je     803898 <ipc_reply_recv+0x9e>
+  803893:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803896:	75 12                	jne    8038aa <ipc_reply_recv+0xb0>
+  803898:	83 ec 04             	sub    $0x4,%esp
+  80389b:	57                   	push   %edi
+  80389c:	56                   	push   %esi
+  80389d:	ff 75 18             	push   0x18(%ebp)
+  8038a0:	e8 e3 fd ff ff       	call   803688 <ipc_recv>
+  8038a5:	83 c4 10             	add    $0x10,%esp
+  8038a8:	eb c0                	jmp    80386a <ipc_reply_recv+0x70>
+  8038aa:	83 ec 04             	sub    $0x4,%esp
+  8038ad:	50                   	push   %eax
+  8038ae:	ff 75 08             	push   0x8(%ebp)
+  8038b1:	68 0c 48 80 00       	push   $0x80480c
+  8038b6:	e8 06 d2 ff ff       	call   800ac1 <cprintf>
+  8038bb:	83 c4 10             	add    $0x10,%esp
+  8038be:	eb d8                	jmp    803898 <ipc_reply_recv+0x9e>
+  8038c0:	85 f6                	test   %esi,%esi
+  8038c2:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8038c7:	0f 45 c6             	cmovne %esi,%eax
+  8038ca:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8038cf:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8038d6:	e9 43 ff ff ff       	jmp    80381e <ipc_reply_recv+0x24>
+
+008038db <ipc_find_env>:
+  8038db:	55                   	push   %ebp
+  8038dc:	89 e5                	mov    %esp,%ebp
+  8038de:	83 ec 14             	sub    $0x14,%esp
+  8038e1:	ff 75 08             	push   0x8(%ebp)
+  8038e4:	e8 28 df ff ff       	call   801811 <sys_env_service>
+  8038e9:	85 c0                	test   %eax,%eax
+  8038eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038f0:	0f 48 c2             	cmovs  %edx,%eax
+  8038f3:	c9                   	leave
+  8038f4:	c3                   	ret
+
+008038f5 <pageref>:
+  8038f5:	55                   	push   %ebp
+  8038f6:	89 e5                	mov    %esp,%ebp
+  8038f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038fb:	89 c2                	mov    %eax,%edx
+  8038fd:	c1 ea 16             	shr    $0x16,%edx
+  803900:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803907:	ba 00 00 00 00       	mov    $0x0,%edx
+  80390c:	f6 c1 01             	test   $0x1,%cl
+  80390f:	74 22                	je     803933 <pageref+0x3e>
+  803911:	c1 e8 0c             	shr    $0xc,%eax
+  803914:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80391b:	a8 01                	test   $0x1,%al
+  80391d:	74 14                	je     803933 <pageref+0x3e>
+  80391f:	c1 e8 0c             	shr    $0xc,%eax
+  803922:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803925:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80392c:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803930:	0f b7 d2             	movzwl %dx,%edx
+  803933:	89 d0                	mov    %edx,%eax
+  803935:	5d                   	pop    %ebp
+  803936:	c3                   	ret
+
+00803937 <inet_ntoa>:
+  803937:	55                   	push   %ebp
+  803938:	89 e5                	mov    %esp,%ebp
+  80393a:	57                   	push   %edi
+  80393b:	56                   	push   %esi
+  80393c:	53                   	push   %ebx
+  80393d:	83 ec 1c             	sub    $0x1c,%esp
+  803940:	8b 45 08             	mov    0x8(%ebp),%eax
+  803943:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  803946:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  803949:	bf 10 60 80 00       	mov    $0x806010,%edi
+  80394e:	0f b6 16             	movzbl (%esi),%edx
+  803951:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803956:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803959:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80395c:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803961:	f6 e2                	mul    %dl
+  803963:	66 c1 e8 0b          	shr    $0xb,%ax
+  803967:	89 c7                	mov    %eax,%edi
+  803969:	88 45 e0             	mov    %al,-0x20(%ebp)
+  80396c:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  80396f:	01 db                	add    %ebx,%ebx
+  803971:	89 d0                	mov    %edx,%eax
+  803973:	29 d8                	sub    %ebx,%eax
+  803975:	89 d6                	mov    %edx,%esi
+  803977:	89 fa                	mov    %edi,%edx
+  803979:	89 cb                	mov    %ecx,%ebx
+  80397b:	83 c1 01             	add    $0x1,%ecx
+  80397e:	0f b6 fb             	movzbl %bl,%edi
+  803981:	83 c0 30             	add    $0x30,%eax
+  803984:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+  803988:	89 f0                	mov    %esi,%eax
+  80398a:	3c 09                	cmp    $0x9,%al
+  80398c:	77 ce                	ja     80395c <inet_ntoa+0x25>
+  80398e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803991:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803994:	88 16                	mov    %dl,(%esi)
+  803996:	84 c9                	test   %cl,%cl
+  803998:	74 4d                	je     8039e7 <inet_ntoa+0xb0>
+  80399a:	0f b6 db             	movzbl %bl,%ebx
+  80399d:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  8039a0:	01 d8                	add    %ebx,%eax
+  8039a2:	89 f9                	mov    %edi,%ecx
+  8039a4:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8039a7:	83 c1 01             	add    $0x1,%ecx
+  8039aa:	0f b6 10             	movzbl (%eax),%edx
+  8039ad:	88 51 ff             	mov    %dl,-0x1(%ecx)
+  8039b0:	89 c2                	mov    %eax,%edx
+  8039b2:	83 e8 01             	sub    $0x1,%eax
+  8039b5:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  8039b8:	39 da                	cmp    %ebx,%edx
+  8039ba:	75 eb                	jne    8039a7 <inet_ntoa+0x70>
+  8039bc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8039bf:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  8039c3:	8d 78 01             	lea    0x1(%eax),%edi
+  8039c6:	c6 00 2e             	movb   $0x2e,(%eax)
+  8039c9:	83 c6 01             	add    $0x1,%esi
+  8039cc:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8039cf:	39 ce                	cmp    %ecx,%esi
+  8039d1:	0f 85 77 ff ff ff    	jne    80394e <inet_ntoa+0x17>
+  8039d7:	c6 00 00             	movb   $0x0,(%eax)
+  8039da:	b8 10 60 80 00       	mov    $0x806010,%eax
+  8039df:	83 c4 1c             	add    $0x1c,%esp
+  8039e2:	5b                   	pop    %ebx
+  8039e3:	5e                   	pop    %esi
+  8039e4:	5f                   	pop    %edi
+  8039e5:	5d                   	pop    %ebp
+  8039e6:	c3                   	ret
+  8039e7:	89 f8                	mov    %edi,%eax
+  8039e9:	eb d8                	jmp    8039c3 <inet_ntoa+0x8c>
+
+008039eb <htons>:
+  8039eb:	55                   	push   %ebp
+  8039ec:	89 e5                	mov    %esp,%ebp
+  8039ee:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8039f2:	66 c1 c0 08          	rol    $0x8,%ax
+  8039f6:	5d                   	pop    %ebp
+  8039f7:	c3                   	ret
+
+008039f8 <ntohs>:
+  8039f8:	55                   	push   %ebp
+  8039f9:	89 e5                	mov    %esp,%ebp
+  8039fb:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8039ff:	66 c1 c0 08          	rol    $0x8,%ax
+  803a03:	5d                   	pop    %ebp
+  803a04:	c3                   	ret
+
+00803a05 <htonl>:
+  803a05:	55                   	push   %ebp
+  803a06:	89 e5                	mov    %esp,%ebp
+  803a08:	8b 55 08             	mov    0x8(%ebp),%edx
+  803a0b:	89 d0                	mov    %edx,%eax
+  803a0d:	c1 e0 18             	shl    $0x18,%eax
+  803a10:	89 d1                	mov    %edx,%ecx
+  803a12:	c1 e9 18             	shr    $0x18,%ecx
+  803a15:	09 c8                	or     %ecx,%eax
+  803a17:	89 d1                	mov    %edx,%ecx
+  803a19:	c1 e1 08             	shl    $0x8,%ecx
+  803a1c:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+  803a22:	09 c8                	or     %ecx,%eax
+  803a24:	c1 ea 08             	shr    $0x8,%edx
+  803a27:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803a2d:	09 d0                	or     %edx,%eax
+  803a2f:	5d                   	pop    %ebp
+  803a30:	c3                   	ret
+
+00803a31 <inet_aton>:
+  803a31:	55                   	push   %ebp
+  803a32:	89 e5                	mov    %esp,%ebp
+  803a34:	57                   	push   %edi
+  803a35:	56                   	push   %esi
+  803a36:	53                   	push   %ebx
+  803a37:	83 ec 2c             	sub    $0x2c,%esp
+  803a3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  803a3d:	0f b6 0a             	movzbl (%edx),%ecx
+  803a40:	0f be c1             	movsbl %cl,%eax
+  803a43:	83 e9 30             	sub    $0x30,%ecx
+  803a46:	80 f9 09             	cmp    $0x9,%cl
+  803a49:	0f 87 b6 01 00 00    	ja     803c05 <inet_aton+0x1d4>
+  803a4f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  803a52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803a55:	e9 aa 00 00 00       	jmp    803b04 <inet_aton+0xd3>
+  803a5a:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  803a5e:	89 c1                	mov    %eax,%ecx
+  803a60:	83 e1 df             	and    $0xffffffdf,%ecx
+  803a63:	80 f9 58             	cmp    $0x58,%cl
+  803a66:	74 10                	je     803a78 <inet_aton+0x47>
+  803a68:	83 c2 01             	add    $0x1,%edx
+  803a6b:	0f be c0             	movsbl %al,%eax
+  803a6e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a73:	e9 9a 00 00 00       	jmp    803b12 <inet_aton+0xe1>
+  803a78:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803a7c:	8d 52 02             	lea    0x2(%edx),%edx
+  803a7f:	bf 10 00 00 00       	mov    $0x10,%edi
+  803a84:	e9 89 00 00 00       	jmp    803b12 <inet_aton+0xe1>
+  803a89:	0f af d7             	imul   %edi,%edx
+  803a8c:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  803a90:	0f be 01             	movsbl (%ecx),%eax
+  803a93:	83 c1 01             	add    $0x1,%ecx
+  803a96:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803a99:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803a9c:	80 fb 09             	cmp    $0x9,%bl
+  803a9f:	76 e8                	jbe    803a89 <inet_aton+0x58>
+  803aa1:	83 ff 10             	cmp    $0x10,%edi
+  803aa4:	75 2e                	jne    803ad4 <inet_aton+0xa3>
+  803aa6:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803aaa:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803aad:	83 e3 df             	and    $0xffffffdf,%ebx
+  803ab0:	83 eb 41             	sub    $0x41,%ebx
+  803ab3:	80 fb 05             	cmp    $0x5,%bl
+  803ab6:	77 1c                	ja     803ad4 <inet_aton+0xa3>
+  803ab8:	c1 e2 04             	shl    $0x4,%edx
+  803abb:	83 c0 0a             	add    $0xa,%eax
+  803abe:	89 f3                	mov    %esi,%ebx
+  803ac0:	80 fb 1a             	cmp    $0x1a,%bl
+  803ac3:	19 db                	sbb    %ebx,%ebx
+  803ac5:	83 e3 20             	and    $0x20,%ebx
+  803ac8:	83 c3 41             	add    $0x41,%ebx
+  803acb:	29 d8                	sub    %ebx,%eax
+  803acd:	09 c2                	or     %eax,%edx
+  803acf:	0f be 01             	movsbl (%ecx),%eax
+  803ad2:	eb bf                	jmp    803a93 <inet_aton+0x62>
+  803ad4:	83 f8 2e             	cmp    $0x2e,%eax
+  803ad7:	75 46                	jne    803b1f <inet_aton+0xee>
+  803ad9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803adc:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803adf:	39 f0                	cmp    %esi,%eax
+  803ae1:	0f 84 25 01 00 00    	je     803c0c <inet_aton+0x1db>
+  803ae7:	83 c0 04             	add    $0x4,%eax
+  803aea:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803aed:	89 50 fc             	mov    %edx,-0x4(%eax)
+  803af0:	89 ca                	mov    %ecx,%edx
+  803af2:	0f b6 09             	movzbl (%ecx),%ecx
+  803af5:	0f be c1             	movsbl %cl,%eax
+  803af8:	83 e9 30             	sub    $0x30,%ecx
+  803afb:	80 f9 09             	cmp    $0x9,%cl
+  803afe:	0f 87 17 01 00 00    	ja     803c1b <inet_aton+0x1ea>
+  803b04:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b09:	83 f8 30             	cmp    $0x30,%eax
+  803b0c:	0f 84 48 ff ff ff    	je     803a5a <inet_aton+0x29>
+  803b12:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803b15:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b1a:	e9 77 ff ff ff       	jmp    803a96 <inet_aton+0x65>
+  803b1f:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803b23:	89 d6                	mov    %edx,%esi
+  803b25:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803b28:	85 c0                	test   %eax,%eax
+  803b2a:	74 2e                	je     803b5a <inet_aton+0x129>
+  803b2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b31:	89 fa                	mov    %edi,%edx
+  803b33:	80 fa 1f             	cmp    $0x1f,%dl
+  803b36:	0f 86 d5 00 00 00    	jbe    803c11 <inet_aton+0x1e0>
+  803b3c:	84 c0                	test   %al,%al
+  803b3e:	0f 88 cd 00 00 00    	js     803c11 <inet_aton+0x1e0>
+  803b44:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803b47:	83 f9 04             	cmp    $0x4,%ecx
+  803b4a:	76 0e                	jbe    803b5a <inet_aton+0x129>
+  803b4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b51:	83 f8 20             	cmp    $0x20,%eax
+  803b54:	0f 85 b7 00 00 00    	jne    803c11 <inet_aton+0x1e0>
+  803b5a:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803b5d:	89 d8                	mov    %ebx,%eax
+  803b5f:	29 c8                	sub    %ecx,%eax
+  803b61:	c1 f8 02             	sar    $0x2,%eax
+  803b64:	8d 48 01             	lea    0x1(%eax),%ecx
+  803b67:	83 f8 02             	cmp    $0x2,%eax
+  803b6a:	74 7a                	je     803be6 <inet_aton+0x1b5>
+  803b6c:	83 f9 03             	cmp    $0x3,%ecx
+  803b6f:	7f 49                	jg     803bba <inet_aton+0x189>
+  803b71:	85 c9                	test   %ecx,%ecx
+  803b73:	0f 84 98 00 00 00    	je     803c11 <inet_aton+0x1e0>
+  803b79:	83 f9 02             	cmp    $0x2,%ecx
+  803b7c:	75 19                	jne    803b97 <inet_aton+0x166>
+  803b7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b83:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803b89:	0f 87 82 00 00 00    	ja     803c11 <inet_aton+0x1e0>
+  803b8f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803b92:	c1 e0 18             	shl    $0x18,%eax
+  803b95:	09 c6                	or     %eax,%esi
+  803b97:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803ba0:	74 6f                	je     803c11 <inet_aton+0x1e0>
+  803ba2:	83 ec 0c             	sub    $0xc,%esp
+  803ba5:	56                   	push   %esi
+  803ba6:	e8 5a fe ff ff       	call   803a05 <htonl>
+  803bab:	83 c4 10             	add    $0x10,%esp
+  803bae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803bb1:	89 06                	mov    %eax,(%esi)
+  803bb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803bb8:	eb 57                	jmp    803c11 <inet_aton+0x1e0>
+  803bba:	83 f9 04             	cmp    $0x4,%ecx
+  803bbd:	75 d8                	jne    803b97 <inet_aton+0x166>
+  803bbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bc4:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803bca:	77 45                	ja     803c11 <inet_aton+0x1e0>
+  803bcc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803bcf:	c1 e0 18             	shl    $0x18,%eax
+  803bd2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803bd5:	c1 e1 10             	shl    $0x10,%ecx
+  803bd8:	09 c8                	or     %ecx,%eax
+  803bda:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803bdd:	c1 e1 08             	shl    $0x8,%ecx
+  803be0:	09 c8                	or     %ecx,%eax
+  803be2:	09 c6                	or     %eax,%esi
+  803be4:	eb b1                	jmp    803b97 <inet_aton+0x166>
+  803be6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803beb:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803bf1:	77 1e                	ja     803c11 <inet_aton+0x1e0>
+  803bf3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803bf6:	c1 e0 18             	shl    $0x18,%eax
+  803bf9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803bfc:	c1 e1 10             	shl    $0x10,%ecx
+  803bff:	09 c8                	or     %ecx,%eax
+  803c01:	09 c6                	or     %eax,%esi
+  803c03:	eb 92                	jmp    803b97 <inet_aton+0x166>
+  803c05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c0a:	eb 05                	jmp    803c11 <inet_aton+0x1e0>
+  803c0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c11:	89 c8                	mov    %ecx,%eax
+  803c13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c16:	5b                   	pop    %ebx
+  803c17:	5e                   	pop    %esi
+  803c18:	5f                   	pop    %edi
+  803c19:	5d                   	pop    %ebp
+  803c1a:	c3                   	ret
+  803c1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c20:	eb ef                	jmp    803c11 <inet_aton+0x1e0>
+
+00803c22 <inet_addr>:
+  803c22:	55                   	push   %ebp
+  803c23:	89 e5                	mov    %esp,%ebp
+  803c25:	83 ec 20             	sub    $0x20,%esp
+  803c28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c2b:	50                   	push   %eax
+  803c2c:	ff 75 08             	push   0x8(%ebp)
+  803c2f:	e8 fd fd ff ff       	call   803a31 <inet_aton>
+  803c34:	89 c2                	mov    %eax,%edx
+  803c36:	83 c4 10             	add    $0x10,%esp
+  803c39:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803c3e:	85 d2                	test   %edx,%edx
+  803c40:	75 02                	jne    803c44 <inet_addr+0x22>
+  803c42:	c9                   	leave
+  803c43:	c3                   	ret
+  803c44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c47:	eb f9                	jmp    803c42 <inet_addr+0x20>
+
+00803c49 <ntohl>:
+  803c49:	55                   	push   %ebp
+  803c4a:	89 e5                	mov    %esp,%ebp
+  803c4c:	83 ec 14             	sub    $0x14,%esp
+  803c4f:	ff 75 08             	push   0x8(%ebp)
+  803c52:	e8 ae fd ff ff       	call   803a05 <htonl>
+  803c57:	83 c4 10             	add    $0x10,%esp
+  803c5a:	c9                   	leave
+  803c5b:	c3                   	ret
+
+00803c5c <__udivmoddi4>:
+  803c5c:	55                   	push   %ebp
+  803c5d:	57                   	push   %edi
+  803c5e:	56                   	push   %esi
+  803c5f:	53                   	push   %ebx
+  803c60:	83 ec 24             	sub    $0x24,%esp
+  803c63:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803c67:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803c6b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c6f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c73:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803c77:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803c7b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803c7f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803c83:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c91:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803c96:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803c9d:	00 
+  803c9e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ca5:	00 
+  803ca6:	89 fb                	mov    %edi,%ebx
+  803ca8:	eb 08                	jmp    803cb2 <__udivmoddi4+0x56>
+  803caa:	83 e9 01             	sub    $0x1,%ecx
+  803cad:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803cb0:	74 68                	je     803d1a <__udivmoddi4+0xbe>
+  803cb2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803cb6:	01 c0                	add    %eax,%eax
+  803cb8:	89 c6                	mov    %eax,%esi
+  803cba:	89 d7                	mov    %edx,%edi
+  803cbc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803cc0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803cc4:	0f ad d0             	shrd   %cl,%edx,%eax
+  803cc7:	d3 ea                	shr    %cl,%edx
+  803cc9:	f6 c1 20             	test   $0x20,%cl
+  803ccc:	74 04                	je     803cd2 <__udivmoddi4+0x76>
+  803cce:	89 d0                	mov    %edx,%eax
+  803cd0:	31 d2                	xor    %edx,%edx
+  803cd2:	83 e0 01             	and    $0x1,%eax
+  803cd5:	89 04 24             	mov    %eax,(%esp)
+  803cd8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803cdf:	00 
+  803ce0:	8b 04 24             	mov    (%esp),%eax
+  803ce3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803ce7:	09 f0                	or     %esi,%eax
+  803ce9:	09 fa                	or     %edi,%edx
+  803ceb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803cef:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803cf3:	39 f0                	cmp    %esi,%eax
+  803cf5:	89 d5                	mov    %edx,%ebp
+  803cf7:	19 fd                	sbb    %edi,%ebp
+  803cf9:	72 af                	jb     803caa <__udivmoddi4+0x4e>
+  803cfb:	29 f0                	sub    %esi,%eax
+  803cfd:	19 fa                	sbb    %edi,%edx
+  803cff:	89 cf                	mov    %ecx,%edi
+  803d01:	c1 ef 05             	shr    $0x5,%edi
+  803d04:	83 e7 01             	and    $0x1,%edi
+  803d07:	89 fe                	mov    %edi,%esi
+  803d09:	83 f6 01             	xor    $0x1,%esi
+  803d0c:	d3 e6                	shl    %cl,%esi
+  803d0e:	d3 e7                	shl    %cl,%edi
+  803d10:	09 74 24 18          	or     %esi,0x18(%esp)
+  803d14:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803d18:	eb 90                	jmp    803caa <__udivmoddi4+0x4e>
+  803d1a:	85 db                	test   %ebx,%ebx
+  803d1c:	74 05                	je     803d23 <__udivmoddi4+0xc7>
+  803d1e:	89 03                	mov    %eax,(%ebx)
+  803d20:	89 53 04             	mov    %edx,0x4(%ebx)
+  803d23:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803d27:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803d2b:	83 c4 24             	add    $0x24,%esp
+  803d2e:	5b                   	pop    %ebx
+  803d2f:	5e                   	pop    %esi
+  803d30:	5f                   	pop    %edi
+  803d31:	5d                   	pop    %ebp
+  803d32:	c3                   	ret
+
+00803d33 <__udivdi3>:
+  803d33:	83 ec 08             	sub    $0x8,%esp
+  803d36:	6a 00                	push   $0x0
+  803d38:	ff 74 24 1c          	push   0x1c(%esp)
+  803d3c:	ff 74 24 1c          	push   0x1c(%esp)
+  803d40:	ff 74 24 1c          	push   0x1c(%esp)
+  803d44:	ff 74 24 1c          	push   0x1c(%esp)
+  803d48:	e8 0f ff ff ff       	call   803c5c <__udivmoddi4>
+  803d4d:	83 c4 1c             	add    $0x1c,%esp
+  803d50:	c3                   	ret
+
+00803d51 <__umoddi3>:
+  803d51:	83 ec 18             	sub    $0x18,%esp
+  803d54:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803d58:	50                   	push   %eax
+  803d59:	ff 74 24 2c          	push   0x2c(%esp)
+  803d5d:	ff 74 24 2c          	push   0x2c(%esp)
+  803d61:	ff 74 24 2c          	push   0x2c(%esp)
+  803d65:	ff 74 24 2c          	push   0x2c(%esp)
+  803d69:	e8 ee fe ff ff       	call   803c5c <__udivmoddi4>
+  803d6e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803d72:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803d76:	83 c4 2c             	add    $0x2c,%esp
+  803d79:	c3                   	ret
+
+00803d7a <__divdi3>:
+  803d7a:	53                   	push   %ebx
+  803d7b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803d7f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803d83:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803d87:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803d8b:	85 d2                	test   %edx,%edx
+  803d8d:	78 12                	js     803da1 <__divdi3+0x27>
+  803d8f:	85 db                	test   %ebx,%ebx
+  803d91:	78 2e                	js     803dc1 <__divdi3+0x47>
+  803d93:	53                   	push   %ebx
+  803d94:	51                   	push   %ecx
+  803d95:	52                   	push   %edx
+  803d96:	50                   	push   %eax
+  803d97:	e8 97 ff ff ff       	call   803d33 <__udivdi3>
+  803d9c:	83 c4 10             	add    $0x10,%esp
+  803d9f:	eb 1e                	jmp    803dbf <__divdi3+0x45>
+  803da1:	f7 d8                	neg    %eax
+  803da3:	83 d2 00             	adc    $0x0,%edx
+  803da6:	f7 da                	neg    %edx
+  803da8:	85 db                	test   %ebx,%ebx
+  803daa:	78 2a                	js     803dd6 <__divdi3+0x5c>
+  803dac:	53                   	push   %ebx
+  803dad:	51                   	push   %ecx
+  803dae:	52                   	push   %edx
+  803daf:	50                   	push   %eax
+  803db0:	e8 7e ff ff ff       	call   803d33 <__udivdi3>
+  803db5:	83 c4 10             	add    $0x10,%esp
+  803db8:	f7 d8                	neg    %eax
+  803dba:	83 d2 00             	adc    $0x0,%edx
+  803dbd:	f7 da                	neg    %edx
+  803dbf:	5b                   	pop    %ebx
+  803dc0:	c3                   	ret
+  803dc1:	f7 d9                	neg    %ecx
+  803dc3:	83 d3 00             	adc    $0x0,%ebx
+  803dc6:	f7 db                	neg    %ebx
+  803dc8:	53                   	push   %ebx
+  803dc9:	51                   	push   %ecx
+  803dca:	52                   	push   %edx
+  803dcb:	50                   	push   %eax
+  803dcc:	e8 62 ff ff ff       	call   803d33 <__udivdi3>
+  803dd1:	83 c4 10             	add    $0x10,%esp
+  803dd4:	eb e2                	jmp    803db8 <__divdi3+0x3e>
+  803dd6:	f7 d9                	neg    %ecx
+  803dd8:	83 d3 00             	adc    $0x0,%ebx
+  803ddb:	f7 db                	neg    %ebx
+  803ddd:	53                   	push   %ebx
+  803dde:	51                   	push   %ecx
+  803ddf:	52                   	push   %edx
+  803de0:	50                   	push   %eax
+  803de1:	e8 4d ff ff ff       	call   803d33 <__udivdi3>
+  803de6:	83 c4 10             	add    $0x10,%esp
+  803de9:	eb d4                	jmp    803dbf <__divdi3+0x45>
+
+00803deb <__moddi3>:
+  803deb:	55                   	push   %ebp
+  803dec:	57                   	push   %edi
+  803ded:	56                   	push   %esi
+  803dee:	53                   	push   %ebx
+  803def:	83 ec 0c             	sub    $0xc,%esp
+  803df2:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803df6:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803dfa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803dfe:	89 e9                	mov    %ebp,%ecx
+  803e00:	f7 d9                	neg    %ecx
+  803e02:	89 d0                	mov    %edx,%eax
+  803e04:	83 d0 00             	adc    $0x0,%eax
+  803e07:	f7 d8                	neg    %eax
+  803e09:	0f 49 e9             	cmovns %ecx,%ebp
+  803e0c:	0f 49 d0             	cmovns %eax,%edx
+  803e0f:	52                   	push   %edx
+  803e10:	55                   	push   %ebp
+  803e11:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803e15:	f7 da                	neg    %edx
+  803e17:	89 d8                	mov    %ebx,%eax
+  803e19:	83 d0 00             	adc    $0x0,%eax
+  803e1c:	f7 d8                	neg    %eax
+  803e1e:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803e23:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803e27:	0f 48 c3             	cmovs  %ebx,%eax
+  803e2a:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803e2e:	ff 74 24 0c          	push   0xc(%esp)
+  803e32:	ff 74 24 0c          	push   0xc(%esp)
+  803e36:	e8 16 ff ff ff       	call   803d51 <__umoddi3>
+  803e3b:	83 c4 10             	add    $0x10,%esp
+  803e3e:	85 db                	test   %ebx,%ebx
+  803e40:	78 08                	js     803e4a <__moddi3+0x5f>
+  803e42:	83 c4 0c             	add    $0xc,%esp
+  803e45:	5b                   	pop    %ebx
+  803e46:	5e                   	pop    %esi
+  803e47:	5f                   	pop    %edi
+  803e48:	5d                   	pop    %ebp
+  803e49:	c3                   	ret
+  803e4a:	f7 d8                	neg    %eax
+  803e4c:	83 d2 00             	adc    $0x0,%edx
+  803e4f:	f7 da                	neg    %edx
+  803e51:	eb ef                	jmp    803e42 <__moddi3+0x57>
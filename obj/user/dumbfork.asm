@@ -0,0 +1,5183 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b0 01 00 00       	call   8001e1 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 42 0e 00 00       	call   800e8c <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 6b 0e 00 00       	call   800ecf <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 5e 0b 00 00       	call   800bdc <memmove>
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 d1 0e 00 00       	call   800f5e <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+  80009b:	50                   	push   %eax
+  80009c:	68 00 33 80 00       	push   $0x803300
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 13 33 80 00       	push   $0x803313
+  8000a8:	e8 ad 01 00 00       	call   80025a <_panic>
+  8000ad:	50                   	push   %eax
+  8000ae:	68 23 33 80 00       	push   $0x803323
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 13 33 80 00       	push   $0x803313
+  8000ba:	e8 9b 01 00 00       	call   80025a <_panic>
+  8000bf:	50                   	push   %eax
+  8000c0:	68 34 33 80 00       	push   $0x803334
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 13 33 80 00       	push   $0x803313
+  8000cc:	e8 89 01 00 00       	call   80025a <_panic>
+
+008000d1 <dumbfork>:
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 66                	js     80014b <dumbfork+0x7a>
+  8000e5:	74 76                	je     80015d <dumbfork+0x8c>
+  8000e7:	c7 45 f4 00 00 80 00 	movl   $0x800000,-0xc(%ebp)
+  8000ee:	b8 00 80 80 00       	mov    $0x808000,%eax
+  8000f3:	3d 00 00 80 00       	cmp    $0x800000,%eax
+  8000f8:	76 26                	jbe    800120 <dumbfork+0x4f>
+  8000fa:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ff:	83 ec 08             	sub    $0x8,%esp
+  800102:	52                   	push   %edx
+  800103:	53                   	push   %ebx
+  800104:	e8 2a ff ff ff       	call   800033 <duppage>
+  800109:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80010c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800112:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800115:	83 c4 10             	add    $0x10,%esp
+  800118:	81 fa 00 80 80 00    	cmp    $0x808000,%edx
+  80011e:	72 df                	jb     8000ff <dumbfork+0x2e>
+  800120:	83 ec 08             	sub    $0x8,%esp
+  800123:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800126:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80012b:	50                   	push   %eax
+  80012c:	53                   	push   %ebx
+  80012d:	e8 01 ff ff ff       	call   800033 <duppage>
+  800132:	83 c4 08             	add    $0x8,%esp
+  800135:	6a 02                	push   $0x2
+  800137:	53                   	push   %ebx
+  800138:	e8 82 0e 00 00       	call   800fbf <sys_env_set_status>
+  80013d:	83 c4 10             	add    $0x10,%esp
+  800140:	85 c0                	test   %eax,%eax
+  800142:	78 35                	js     800179 <dumbfork+0xa8>
+  800144:	89 d8                	mov    %ebx,%eax
+  800146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+  80014b:	50                   	push   %eax
+  80014c:	68 47 33 80 00       	push   $0x803347
+  800151:	6a 37                	push   $0x37
+  800153:	68 13 33 80 00       	push   $0x803313
+  800158:	e8 fd 00 00 00       	call   80025a <_panic>
+  80015d:	e8 c0 0c 00 00       	call   800e22 <sys_getenvid>
+  800162:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800167:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80016d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800172:	a3 10 50 80 00       	mov    %eax,0x805010
+  800177:	eb cb                	jmp    800144 <dumbfork+0x73>
+  800179:	50                   	push   %eax
+  80017a:	68 57 33 80 00       	push   $0x803357
+  80017f:	6a 4c                	push   $0x4c
+  800181:	68 13 33 80 00       	push   $0x803313
+  800186:	e8 cf 00 00 00       	call   80025a <_panic>
+
+0080018b <umain>:
+  80018b:	55                   	push   %ebp
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	57                   	push   %edi
+  80018f:	56                   	push   %esi
+  800190:	53                   	push   %ebx
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	e8 38 ff ff ff       	call   8000d1 <dumbfork>
+  800199:	89 c6                	mov    %eax,%esi
+  80019b:	85 c0                	test   %eax,%eax
+  80019d:	bf 6e 33 80 00       	mov    $0x80336e,%edi
+  8001a2:	b8 75 33 80 00       	mov    $0x803375,%eax
+  8001a7:	0f 44 f8             	cmove  %eax,%edi
+  8001aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001af:	eb 1f                	jmp    8001d0 <umain+0x45>
+  8001b1:	83 fb 13             	cmp    $0x13,%ebx
+  8001b4:	7f 23                	jg     8001d9 <umain+0x4e>
+  8001b6:	83 ec 04             	sub    $0x4,%esp
+  8001b9:	57                   	push   %edi
+  8001ba:	53                   	push   %ebx
+  8001bb:	68 7b 33 80 00       	push   $0x80337b
+  8001c0:	e8 70 01 00 00       	call   800335 <cprintf>
+  8001c5:	e8 77 0c 00 00       	call   800e41 <sys_yield>
+  8001ca:	83 c3 01             	add    $0x1,%ebx
+  8001cd:	83 c4 10             	add    $0x10,%esp
+  8001d0:	85 f6                	test   %esi,%esi
+  8001d2:	74 dd                	je     8001b1 <umain+0x26>
+  8001d4:	83 fb 09             	cmp    $0x9,%ebx
+  8001d7:	7e dd                	jle    8001b6 <umain+0x2b>
+  8001d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001dc:	5b                   	pop    %ebx
+  8001dd:	5e                   	pop    %esi
+  8001de:	5f                   	pop    %edi
+  8001df:	5d                   	pop    %ebp
+  8001e0:	c3                   	ret
+
+008001e1 <libmain>:
+  8001e1:	55                   	push   %ebp
+  8001e2:	89 e5                	mov    %esp,%ebp
+  8001e4:	56                   	push   %esi
+  8001e5:	53                   	push   %ebx
+  8001e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001ec:	e8 31 0c 00 00       	call   800e22 <sys_getenvid>
+  8001f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f6:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8001fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800201:	a3 10 50 80 00       	mov    %eax,0x805010
+  800206:	85 db                	test   %ebx,%ebx
+  800208:	7e 07                	jle    800211 <libmain+0x30>
+  80020a:	8b 06                	mov    (%esi),%eax
+  80020c:	a3 00 40 80 00       	mov    %eax,0x804000
+  800211:	83 ec 08             	sub    $0x8,%esp
+  800214:	56                   	push   %esi
+  800215:	53                   	push   %ebx
+  800216:	e8 70 ff ff ff       	call   80018b <umain>
+  80021b:	e8 0a 00 00 00       	call   80022a <exit>
+  800220:	83 c4 10             	add    $0x10,%esp
+  800223:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800226:	5b                   	pop    %ebx
+  800227:	5e                   	pop    %esi
+  800228:	5d                   	pop    %ebp
+  800229:	c3                   	ret
+
+0080022a <exit>:
+  80022a:	55                   	push   %ebp
+  80022b:	89 e5                	mov    %esp,%ebp
+  80022d:	83 ec 08             	sub    $0x8,%esp
+  800230:	a1 10 50 80 00       	mov    0x805010,%eax
+  800235:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80023b:	85 c0                	test   %eax,%eax
+  80023d:	75 14                	jne    800253 <exit+0x29>
+  80023f:	e8 80 16 00 00       	call   8018c4 <close_all>
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	6a 00                	push   $0x0
+  800249:	e8 93 0b 00 00       	call   800de1 <sys_env_destroy>
+  80024e:	83 c4 10             	add    $0x10,%esp
+  800251:	c9                   	leave
+  800252:	c3                   	ret
+  800253:	e8 f6 12 00 00       	call   80154e <sys_lease_complete>
+  800258:	eb e5                	jmp    80023f <exit+0x15>
+
+0080025a <_panic>:
+  80025a:	55                   	push   %ebp
+  80025b:	89 e5                	mov    %esp,%ebp
+  80025d:	56                   	push   %esi
+  80025e:	53                   	push   %ebx
+  80025f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800262:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800268:	e8 b5 0b 00 00       	call   800e22 <sys_getenvid>
+  80026d:	83 ec 0c             	sub    $0xc,%esp
+  800270:	ff 75 0c             	push   0xc(%ebp)
+  800273:	ff 75 08             	push   0x8(%ebp)
+  800276:	56                   	push   %esi
+  800277:	50                   	push   %eax
+  800278:	68 98 33 80 00       	push   $0x803398
+  80027d:	e8 b3 00 00 00       	call   800335 <cprintf>
+  800282:	83 c4 18             	add    $0x18,%esp
+  800285:	53                   	push   %ebx
+  800286:	ff 75 10             	push   0x10(%ebp)
+  800289:	e8 56 00 00 00       	call   8002e4 <vcprintf>
+  80028e:	c7 04 24 8b 33 80 00 	movl   $0x80338b,(%esp)
+  800295:	e8 9b 00 00 00       	call   800335 <cprintf>
+  80029a:	83 c4 10             	add    $0x10,%esp
+  80029d:	cc                   	int3
+  80029e:	eb fd                	jmp    80029d <_panic+0x43>
+
+008002a0 <putch>:
+  8002a0:	55                   	push   %ebp
+  8002a1:	89 e5                	mov    %esp,%ebp
+  8002a3:	53                   	push   %ebx
+  8002a4:	83 ec 04             	sub    $0x4,%esp
+  8002a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002aa:	8b 13                	mov    (%ebx),%edx
+  8002ac:	8d 42 01             	lea    0x1(%edx),%eax
+  8002af:	89 03                	mov    %eax,(%ebx)
+  8002b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002b4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8002b8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002bd:	74 09                	je     8002c8 <putch+0x28>
+  8002bf:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8002c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002c6:	c9                   	leave
+  8002c7:	c3                   	ret
+  8002c8:	83 ec 08             	sub    $0x8,%esp
+  8002cb:	68 ff 00 00 00       	push   $0xff
+  8002d0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002d3:	50                   	push   %eax
+  8002d4:	e8 cb 0a 00 00       	call   800da4 <sys_cputs>
+  8002d9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002df:	83 c4 10             	add    $0x10,%esp
+  8002e2:	eb db                	jmp    8002bf <putch+0x1f>
+
+008002e4 <vcprintf>:
+  8002e4:	55                   	push   %ebp
+  8002e5:	89 e5                	mov    %esp,%ebp
+  8002e7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002ed:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002f4:	00 00 00 
+  8002f7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002fe:	00 00 00 
+  800301:	ff 75 0c             	push   0xc(%ebp)
+  800304:	ff 75 08             	push   0x8(%ebp)
+  800307:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80030d:	50                   	push   %eax
+  80030e:	68 a0 02 80 00       	push   $0x8002a0
+  800313:	e8 1c 01 00 00       	call   800434 <vprintfmt>
+  800318:	83 c4 08             	add    $0x8,%esp
+  80031b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800321:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800327:	50                   	push   %eax
+  800328:	e8 77 0a 00 00       	call   800da4 <sys_cputs>
+  80032d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+
+00800335 <cprintf>:
+  800335:	55                   	push   %ebp
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	83 ec 10             	sub    $0x10,%esp
+  80033b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80033e:	50                   	push   %eax
+  80033f:	ff 75 08             	push   0x8(%ebp)
+  800342:	e8 9d ff ff ff       	call   8002e4 <vcprintf>
+  800347:	c9                   	leave
+  800348:	c3                   	ret
+
+00800349 <printnum>:
+  800349:	55                   	push   %ebp
+  80034a:	89 e5                	mov    %esp,%ebp
+  80034c:	57                   	push   %edi
+  80034d:	56                   	push   %esi
+  80034e:	53                   	push   %ebx
+  80034f:	83 ec 1c             	sub    $0x1c,%esp
+  800352:	89 c3                	mov    %eax,%ebx
+  800354:	89 d6                	mov    %edx,%esi
+  800356:	8b 45 08             	mov    0x8(%ebp),%eax
+  800359:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80035c:	89 d1                	mov    %edx,%ecx
+  80035e:	89 c2                	mov    %eax,%edx
+  800360:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800363:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800366:	8b 45 10             	mov    0x10(%ebp),%eax
+  800369:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800373:	39 c2                	cmp    %eax,%edx
+  800375:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800378:	73 4b                	jae    8003c5 <printnum+0x7c>
+  80037a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800380:	85 ff                	test   %edi,%edi
+  800382:	7e 11                	jle    800395 <printnum+0x4c>
+  800384:	83 ec 08             	sub    $0x8,%esp
+  800387:	56                   	push   %esi
+  800388:	ff 75 18             	push   0x18(%ebp)
+  80038b:	ff d3                	call   *%ebx
+  80038d:	83 c4 10             	add    $0x10,%esp
+  800390:	83 ef 01             	sub    $0x1,%edi
+  800393:	75 ef                	jne    800384 <printnum+0x3b>
+  800395:	83 ec 08             	sub    $0x8,%esp
+  800398:	56                   	push   %esi
+  800399:	83 ec 04             	sub    $0x4,%esp
+  80039c:	ff 75 e4             	push   -0x1c(%ebp)
+  80039f:	ff 75 e0             	push   -0x20(%ebp)
+  8003a2:	ff 75 dc             	push   -0x24(%ebp)
+  8003a5:	ff 75 d8             	push   -0x28(%ebp)
+  8003a8:	e8 50 2e 00 00       	call   8031fd <__umoddi3>
+  8003ad:	83 c4 14             	add    $0x14,%esp
+  8003b0:	0f be 80 bb 33 80 00 	movsbl 0x8033bb(%eax),%eax
+  8003b7:	50                   	push   %eax
+  8003b8:	ff d3                	call   *%ebx
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+  8003c5:	83 ec 0c             	sub    $0xc,%esp
+  8003c8:	ff 75 18             	push   0x18(%ebp)
+  8003cb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003ce:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003d1:	52                   	push   %edx
+  8003d2:	50                   	push   %eax
+  8003d3:	83 ec 08             	sub    $0x8,%esp
+  8003d6:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d9:	ff 75 e0             	push   -0x20(%ebp)
+  8003dc:	ff 75 dc             	push   -0x24(%ebp)
+  8003df:	ff 75 d8             	push   -0x28(%ebp)
+  8003e2:	e8 f8 2d 00 00       	call   8031df <__udivdi3>
+  8003e7:	83 c4 18             	add    $0x18,%esp
+  8003ea:	52                   	push   %edx
+  8003eb:	50                   	push   %eax
+  8003ec:	89 f2                	mov    %esi,%edx
+  8003ee:	89 d8                	mov    %ebx,%eax
+  8003f0:	e8 54 ff ff ff       	call   800349 <printnum>
+  8003f5:	83 c4 20             	add    $0x20,%esp
+  8003f8:	eb 9b                	jmp    800395 <printnum+0x4c>
+
+008003fa <sprintputch>:
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800400:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800404:	8b 10                	mov    (%eax),%edx
+  800406:	3b 50 04             	cmp    0x4(%eax),%edx
+  800409:	73 0a                	jae    800415 <sprintputch+0x1b>
+  80040b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80040e:	89 08                	mov    %ecx,(%eax)
+  800410:	8b 45 08             	mov    0x8(%ebp),%eax
+  800413:	88 02                	mov    %al,(%edx)
+  800415:	5d                   	pop    %ebp
+  800416:	c3                   	ret
+
+00800417 <printfmt>:
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	83 ec 08             	sub    $0x8,%esp
+  80041d:	8d 45 14             	lea    0x14(%ebp),%eax
+  800420:	50                   	push   %eax
+  800421:	ff 75 10             	push   0x10(%ebp)
+  800424:	ff 75 0c             	push   0xc(%ebp)
+  800427:	ff 75 08             	push   0x8(%ebp)
+  80042a:	e8 05 00 00 00       	call   800434 <vprintfmt>
+  80042f:	83 c4 10             	add    $0x10,%esp
+  800432:	c9                   	leave
+  800433:	c3                   	ret
+
+00800434 <vprintfmt>:
+  800434:	55                   	push   %ebp
+  800435:	89 e5                	mov    %esp,%ebp
+  800437:	57                   	push   %edi
+  800438:	56                   	push   %esi
+  800439:	53                   	push   %ebx
+  80043a:	83 ec 2c             	sub    $0x2c,%esp
+  80043d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800440:	89 df                	mov    %ebx,%edi
+  800442:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800445:	8b 45 10             	mov    0x10(%ebp),%eax
+  800448:	8d 70 01             	lea    0x1(%eax),%esi
+  80044b:	0f b6 00             	movzbl (%eax),%eax
+  80044e:	83 f8 25             	cmp    $0x25,%eax
+  800451:	74 1e                	je     800471 <vprintfmt+0x3d>
+  800453:	85 c0                	test   %eax,%eax
+  800455:	0f 84 15 05 00 00    	je     800970 <vprintfmt+0x53c>
+  80045b:	83 ec 08             	sub    $0x8,%esp
+  80045e:	53                   	push   %ebx
+  80045f:	50                   	push   %eax
+  800460:	ff d7                	call   *%edi
+  800462:	83 c6 01             	add    $0x1,%esi
+  800465:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800469:	83 c4 10             	add    $0x10,%esp
+  80046c:	83 f8 25             	cmp    $0x25,%eax
+  80046f:	75 e2                	jne    800453 <vprintfmt+0x1f>
+  800471:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800475:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80047c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800483:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80048a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800492:	8d 56 01             	lea    0x1(%esi),%edx
+  800495:	0f b6 0e             	movzbl (%esi),%ecx
+  800498:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80049b:	3c 55                	cmp    $0x55,%al
+  80049d:	0f 87 3b 04 00 00    	ja     8008de <vprintfmt+0x4aa>
+  8004a3:	0f b6 c0             	movzbl %al,%eax
+  8004a6:	ff 24 85 00 35 80 00 	jmp    *0x803500(,%eax,4)
+  8004ad:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004b0:	eb 93                	jmp    800445 <vprintfmt+0x11>
+  8004b2:	89 d6                	mov    %edx,%esi
+  8004b4:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004b8:	eb d8                	jmp    800492 <vprintfmt+0x5e>
+  8004ba:	89 d6                	mov    %edx,%esi
+  8004bc:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004c0:	eb d0                	jmp    800492 <vprintfmt+0x5e>
+  8004c2:	0f b6 c9             	movzbl %cl,%ecx
+  8004c5:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004c8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004cb:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8004cf:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004d2:	83 f9 09             	cmp    $0x9,%ecx
+  8004d5:	77 6f                	ja     800546 <vprintfmt+0x112>
+  8004d7:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8004da:	83 c2 01             	add    $0x1,%edx
+  8004dd:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004e0:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8004e4:	0f be 02             	movsbl (%edx),%eax
+  8004e7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004ea:	83 fe 09             	cmp    $0x9,%esi
+  8004ed:	76 eb                	jbe    8004da <vprintfmt+0xa6>
+  8004ef:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8004f2:	89 d6                	mov    %edx,%esi
+  8004f4:	eb 13                	jmp    800509 <vprintfmt+0xd5>
+  8004f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f9:	8b 00                	mov    (%eax),%eax
+  8004fb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800501:	8d 40 04             	lea    0x4(%eax),%eax
+  800504:	89 45 14             	mov    %eax,0x14(%ebp)
+  800507:	89 d6                	mov    %edx,%esi
+  800509:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80050d:	79 83                	jns    800492 <vprintfmt+0x5e>
+  80050f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800512:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800515:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80051c:	e9 71 ff ff ff       	jmp    800492 <vprintfmt+0x5e>
+  800521:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800524:	85 c9                	test   %ecx,%ecx
+  800526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052b:	0f 49 c1             	cmovns %ecx,%eax
+  80052e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800531:	89 d6                	mov    %edx,%esi
+  800533:	e9 5a ff ff ff       	jmp    800492 <vprintfmt+0x5e>
+  800538:	89 d6                	mov    %edx,%esi
+  80053a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800541:	e9 4c ff ff ff       	jmp    800492 <vprintfmt+0x5e>
+  800546:	89 d6                	mov    %edx,%esi
+  800548:	eb bf                	jmp    800509 <vprintfmt+0xd5>
+  80054a:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80054e:	89 d6                	mov    %edx,%esi
+  800550:	e9 3d ff ff ff       	jmp    800492 <vprintfmt+0x5e>
+  800555:	89 55 10             	mov    %edx,0x10(%ebp)
+  800558:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055b:	8d 70 04             	lea    0x4(%eax),%esi
+  80055e:	83 ec 08             	sub    $0x8,%esp
+  800561:	53                   	push   %ebx
+  800562:	ff 30                	push   (%eax)
+  800564:	ff d7                	call   *%edi
+  800566:	83 c4 10             	add    $0x10,%esp
+  800569:	89 75 14             	mov    %esi,0x14(%ebp)
+  80056c:	e9 d4 fe ff ff       	jmp    800445 <vprintfmt+0x11>
+  800571:	89 55 10             	mov    %edx,0x10(%ebp)
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8d 70 04             	lea    0x4(%eax),%esi
+  80057a:	8b 10                	mov    (%eax),%edx
+  80057c:	89 d0                	mov    %edx,%eax
+  80057e:	f7 d8                	neg    %eax
+  800580:	0f 48 c2             	cmovs  %edx,%eax
+  800583:	83 f8 12             	cmp    $0x12,%eax
+  800586:	7f 23                	jg     8005ab <vprintfmt+0x177>
+  800588:	8b 14 85 60 36 80 00 	mov    0x803660(,%eax,4),%edx
+  80058f:	85 d2                	test   %edx,%edx
+  800591:	74 18                	je     8005ab <vprintfmt+0x177>
+  800593:	52                   	push   %edx
+  800594:	68 bb 37 80 00       	push   $0x8037bb
+  800599:	53                   	push   %ebx
+  80059a:	57                   	push   %edi
+  80059b:	e8 77 fe ff ff       	call   800417 <printfmt>
+  8005a0:	83 c4 10             	add    $0x10,%esp
+  8005a3:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005a6:	e9 9a fe ff ff       	jmp    800445 <vprintfmt+0x11>
+  8005ab:	50                   	push   %eax
+  8005ac:	68 d3 33 80 00       	push   $0x8033d3
+  8005b1:	53                   	push   %ebx
+  8005b2:	57                   	push   %edi
+  8005b3:	e8 5f fe ff ff       	call   800417 <printfmt>
+  8005b8:	83 c4 10             	add    $0x10,%esp
+  8005bb:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005be:	e9 82 fe ff ff       	jmp    800445 <vprintfmt+0x11>
+  8005c3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	83 c0 04             	add    $0x4,%eax
+  8005cc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8b 00                	mov    (%eax),%eax
+  8005d4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005d7:	85 c0                	test   %eax,%eax
+  8005d9:	0f 84 61 03 00 00    	je     800940 <vprintfmt+0x50c>
+  8005df:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005e3:	7e 06                	jle    8005eb <vprintfmt+0x1b7>
+  8005e5:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005e9:	75 29                	jne    800614 <vprintfmt+0x1e0>
+  8005eb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ee:	8d 70 01             	lea    0x1(%eax),%esi
+  8005f1:	0f b6 00             	movzbl (%eax),%eax
+  8005f4:	0f be d0             	movsbl %al,%edx
+  8005f7:	85 d2                	test   %edx,%edx
+  8005f9:	0f 84 bb 00 00 00    	je     8006ba <vprintfmt+0x286>
+  8005ff:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800602:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800605:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800608:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80060b:	eb 7a                	jmp    800687 <vprintfmt+0x253>
+  80060d:	c7 45 d0 cc 33 80 00 	movl   $0x8033cc,-0x30(%ebp)
+  800614:	83 ec 08             	sub    $0x8,%esp
+  800617:	ff 75 d4             	push   -0x2c(%ebp)
+  80061a:	ff 75 d0             	push   -0x30(%ebp)
+  80061d:	e8 e0 03 00 00       	call   800a02 <strnlen>
+  800622:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800625:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800628:	83 c4 10             	add    $0x10,%esp
+  80062b:	85 d2                	test   %edx,%edx
+  80062d:	0f 8e d6 02 00 00    	jle    800909 <vprintfmt+0x4d5>
+  800633:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800637:	83 ec 08             	sub    $0x8,%esp
+  80063a:	53                   	push   %ebx
+  80063b:	56                   	push   %esi
+  80063c:	ff d7                	call   *%edi
+  80063e:	83 c4 10             	add    $0x10,%esp
+  800641:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800645:	75 f0                	jne    800637 <vprintfmt+0x203>
+  800647:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80064a:	8d 70 01             	lea    0x1(%eax),%esi
+  80064d:	0f b6 00             	movzbl (%eax),%eax
+  800650:	0f be d0             	movsbl %al,%edx
+  800653:	85 d2                	test   %edx,%edx
+  800655:	0f 84 da 02 00 00    	je     800935 <vprintfmt+0x501>
+  80065b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80065e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800661:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800664:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800667:	eb 1e                	jmp    800687 <vprintfmt+0x253>
+  800669:	83 ec 08             	sub    $0x8,%esp
+  80066c:	ff 75 0c             	push   0xc(%ebp)
+  80066f:	52                   	push   %edx
+  800670:	ff 55 08             	call   *0x8(%ebp)
+  800673:	83 c4 10             	add    $0x10,%esp
+  800676:	83 eb 01             	sub    $0x1,%ebx
+  800679:	83 c6 01             	add    $0x1,%esi
+  80067c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800680:	0f be d0             	movsbl %al,%edx
+  800683:	85 d2                	test   %edx,%edx
+  800685:	74 2a                	je     8006b1 <vprintfmt+0x27d>
+  800687:	85 ff                	test   %edi,%edi
+  800689:	78 05                	js     800690 <vprintfmt+0x25c>
+  80068b:	83 ef 01             	sub    $0x1,%edi
+  80068e:	78 59                	js     8006e9 <vprintfmt+0x2b5>
+  800690:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800694:	74 d3                	je     800669 <vprintfmt+0x235>
+  800696:	0f be c0             	movsbl %al,%eax
+  800699:	83 e8 20             	sub    $0x20,%eax
+  80069c:	83 f8 5e             	cmp    $0x5e,%eax
+  80069f:	76 c8                	jbe    800669 <vprintfmt+0x235>
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	ff 75 0c             	push   0xc(%ebp)
+  8006a7:	6a 3f                	push   $0x3f
+  8006a9:	ff 55 08             	call   *0x8(%ebp)
+  8006ac:	83 c4 10             	add    $0x10,%esp
+  8006af:	eb c5                	jmp    800676 <vprintfmt+0x242>
+  8006b1:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006ba:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006bd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006c1:	7e 1b                	jle    8006de <vprintfmt+0x2aa>
+  8006c3:	83 ec 08             	sub    $0x8,%esp
+  8006c6:	53                   	push   %ebx
+  8006c7:	6a 20                	push   $0x20
+  8006c9:	ff d7                	call   *%edi
+  8006cb:	83 c4 10             	add    $0x10,%esp
+  8006ce:	83 ee 01             	sub    $0x1,%esi
+  8006d1:	75 f0                	jne    8006c3 <vprintfmt+0x28f>
+  8006d3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d9:	e9 67 fd ff ff       	jmp    800445 <vprintfmt+0x11>
+  8006de:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e4:	e9 5c fd ff ff       	jmp    800445 <vprintfmt+0x11>
+  8006e9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006f2:	eb c6                	jmp    8006ba <vprintfmt+0x286>
+  8006f4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006f7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006fa:	83 f9 01             	cmp    $0x1,%ecx
+  8006fd:	7f 1f                	jg     80071e <vprintfmt+0x2ea>
+  8006ff:	85 c9                	test   %ecx,%ecx
+  800701:	74 67                	je     80076a <vprintfmt+0x336>
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 30                	mov    (%eax),%esi
+  800708:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80070b:	89 f0                	mov    %esi,%eax
+  80070d:	c1 f8 1f             	sar    $0x1f,%eax
+  800710:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8d 40 04             	lea    0x4(%eax),%eax
+  800719:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071c:	eb 17                	jmp    800735 <vprintfmt+0x301>
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	8b 50 04             	mov    0x4(%eax),%edx
+  800724:	8b 00                	mov    (%eax),%eax
+  800726:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800729:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80072c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072f:	8d 40 08             	lea    0x8(%eax),%eax
+  800732:	89 45 14             	mov    %eax,0x14(%ebp)
+  800735:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800738:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80073b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800740:	85 c9                	test   %ecx,%ecx
+  800742:	0f 89 12 01 00 00    	jns    80085a <vprintfmt+0x426>
+  800748:	83 ec 08             	sub    $0x8,%esp
+  80074b:	53                   	push   %ebx
+  80074c:	6a 2d                	push   $0x2d
+  80074e:	ff d7                	call   *%edi
+  800750:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800753:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800756:	f7 da                	neg    %edx
+  800758:	83 d1 00             	adc    $0x0,%ecx
+  80075b:	f7 d9                	neg    %ecx
+  80075d:	83 c4 10             	add    $0x10,%esp
+  800760:	be 0a 00 00 00       	mov    $0xa,%esi
+  800765:	e9 f0 00 00 00       	jmp    80085a <vprintfmt+0x426>
+  80076a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076d:	8b 30                	mov    (%eax),%esi
+  80076f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800772:	89 f0                	mov    %esi,%eax
+  800774:	c1 f8 1f             	sar    $0x1f,%eax
+  800777:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8d 40 04             	lea    0x4(%eax),%eax
+  800780:	89 45 14             	mov    %eax,0x14(%ebp)
+  800783:	eb b0                	jmp    800735 <vprintfmt+0x301>
+  800785:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800788:	89 55 10             	mov    %edx,0x10(%ebp)
+  80078b:	83 f9 01             	cmp    $0x1,%ecx
+  80078e:	7f 1e                	jg     8007ae <vprintfmt+0x37a>
+  800790:	85 c9                	test   %ecx,%ecx
+  800792:	74 32                	je     8007c6 <vprintfmt+0x392>
+  800794:	8b 45 14             	mov    0x14(%ebp),%eax
+  800797:	8b 10                	mov    (%eax),%edx
+  800799:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079e:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007a9:	e9 ac 00 00 00       	jmp    80085a <vprintfmt+0x426>
+  8007ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b1:	8b 10                	mov    (%eax),%edx
+  8007b3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007b6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bc:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007c1:	e9 94 00 00 00       	jmp    80085a <vprintfmt+0x426>
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8b 10                	mov    (%eax),%edx
+  8007cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007db:	eb 7d                	jmp    80085a <vprintfmt+0x426>
+  8007dd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007e0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e3:	83 f9 01             	cmp    $0x1,%ecx
+  8007e6:	7f 1b                	jg     800803 <vprintfmt+0x3cf>
+  8007e8:	85 c9                	test   %ecx,%ecx
+  8007ea:	74 2c                	je     800818 <vprintfmt+0x3e4>
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8b 10                	mov    (%eax),%edx
+  8007f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fc:	be 08 00 00 00       	mov    $0x8,%esi
+  800801:	eb 57                	jmp    80085a <vprintfmt+0x426>
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8b 10                	mov    (%eax),%edx
+  800808:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080b:	8d 40 08             	lea    0x8(%eax),%eax
+  80080e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800811:	be 08 00 00 00       	mov    $0x8,%esi
+  800816:	eb 42                	jmp    80085a <vprintfmt+0x426>
+  800818:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081b:	8b 10                	mov    (%eax),%edx
+  80081d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800822:	8d 40 04             	lea    0x4(%eax),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+  800828:	be 08 00 00 00       	mov    $0x8,%esi
+  80082d:	eb 2b                	jmp    80085a <vprintfmt+0x426>
+  80082f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800832:	83 ec 08             	sub    $0x8,%esp
+  800835:	53                   	push   %ebx
+  800836:	6a 30                	push   $0x30
+  800838:	ff d7                	call   *%edi
+  80083a:	83 c4 08             	add    $0x8,%esp
+  80083d:	53                   	push   %ebx
+  80083e:	6a 78                	push   $0x78
+  800840:	ff d7                	call   *%edi
+  800842:	8b 45 14             	mov    0x14(%ebp),%eax
+  800845:	8b 10                	mov    (%eax),%edx
+  800847:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084c:	83 c4 10             	add    $0x10,%esp
+  80084f:	8d 40 04             	lea    0x4(%eax),%eax
+  800852:	89 45 14             	mov    %eax,0x14(%ebp)
+  800855:	be 10 00 00 00       	mov    $0x10,%esi
+  80085a:	83 ec 0c             	sub    $0xc,%esp
+  80085d:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800861:	50                   	push   %eax
+  800862:	ff 75 e4             	push   -0x1c(%ebp)
+  800865:	56                   	push   %esi
+  800866:	51                   	push   %ecx
+  800867:	52                   	push   %edx
+  800868:	89 da                	mov    %ebx,%edx
+  80086a:	89 f8                	mov    %edi,%eax
+  80086c:	e8 d8 fa ff ff       	call   800349 <printnum>
+  800871:	83 c4 20             	add    $0x20,%esp
+  800874:	e9 cc fb ff ff       	jmp    800445 <vprintfmt+0x11>
+  800879:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80087c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80087f:	83 f9 01             	cmp    $0x1,%ecx
+  800882:	7f 1b                	jg     80089f <vprintfmt+0x46b>
+  800884:	85 c9                	test   %ecx,%ecx
+  800886:	74 2c                	je     8008b4 <vprintfmt+0x480>
+  800888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088b:	8b 10                	mov    (%eax),%edx
+  80088d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800892:	8d 40 04             	lea    0x4(%eax),%eax
+  800895:	89 45 14             	mov    %eax,0x14(%ebp)
+  800898:	be 10 00 00 00       	mov    $0x10,%esi
+  80089d:	eb bb                	jmp    80085a <vprintfmt+0x426>
+  80089f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a2:	8b 10                	mov    (%eax),%edx
+  8008a4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8008aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ad:	be 10 00 00 00       	mov    $0x10,%esi
+  8008b2:	eb a6                	jmp    80085a <vprintfmt+0x426>
+  8008b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b7:	8b 10                	mov    (%eax),%edx
+  8008b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008be:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c4:	be 10 00 00 00       	mov    $0x10,%esi
+  8008c9:	eb 8f                	jmp    80085a <vprintfmt+0x426>
+  8008cb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008ce:	83 ec 08             	sub    $0x8,%esp
+  8008d1:	53                   	push   %ebx
+  8008d2:	6a 25                	push   $0x25
+  8008d4:	ff d7                	call   *%edi
+  8008d6:	83 c4 10             	add    $0x10,%esp
+  8008d9:	e9 67 fb ff ff       	jmp    800445 <vprintfmt+0x11>
+  8008de:	83 ec 08             	sub    $0x8,%esp
+  8008e1:	53                   	push   %ebx
+  8008e2:	6a 25                	push   $0x25
+  8008e4:	ff d7                	call   *%edi
+  8008e6:	83 c4 10             	add    $0x10,%esp
+  8008e9:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008ed:	0f 84 ba fb ff ff    	je     8004ad <vprintfmt+0x79>
+  8008f3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008f6:	89 f0                	mov    %esi,%eax
+  8008f8:	83 e8 01             	sub    $0x1,%eax
+  8008fb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008ff:	75 f7                	jne    8008f8 <vprintfmt+0x4c4>
+  800901:	89 45 10             	mov    %eax,0x10(%ebp)
+  800904:	e9 3c fb ff ff       	jmp    800445 <vprintfmt+0x11>
+  800909:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80090c:	8d 70 01             	lea    0x1(%eax),%esi
+  80090f:	0f b6 00             	movzbl (%eax),%eax
+  800912:	0f be d0             	movsbl %al,%edx
+  800915:	85 d2                	test   %edx,%edx
+  800917:	74 11                	je     80092a <vprintfmt+0x4f6>
+  800919:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80091c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80091f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800922:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800925:	e9 5d fd ff ff       	jmp    800687 <vprintfmt+0x253>
+  80092a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80092d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800930:	e9 10 fb ff ff       	jmp    800445 <vprintfmt+0x11>
+  800935:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800938:	89 45 14             	mov    %eax,0x14(%ebp)
+  80093b:	e9 05 fb ff ff       	jmp    800445 <vprintfmt+0x11>
+  800940:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800944:	7e 0a                	jle    800950 <vprintfmt+0x51c>
+  800946:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80094a:	0f 85 bd fc ff ff    	jne    80060d <vprintfmt+0x1d9>
+  800950:	ba 28 00 00 00       	mov    $0x28,%edx
+  800955:	b8 28 00 00 00       	mov    $0x28,%eax
+  80095a:	be cd 33 80 00       	mov    $0x8033cd,%esi
+  80095f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800962:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800965:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800968:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80096b:	e9 17 fd ff ff       	jmp    800687 <vprintfmt+0x253>
+  800970:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800973:	5b                   	pop    %ebx
+  800974:	5e                   	pop    %esi
+  800975:	5f                   	pop    %edi
+  800976:	5d                   	pop    %ebp
+  800977:	c3                   	ret
+
+00800978 <vsnprintf>:
+  800978:	55                   	push   %ebp
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	83 ec 18             	sub    $0x18,%esp
+  80097e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800981:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800984:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800987:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80098b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80098e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800995:	85 c0                	test   %eax,%eax
+  800997:	74 26                	je     8009bf <vsnprintf+0x47>
+  800999:	85 d2                	test   %edx,%edx
+  80099b:	7e 22                	jle    8009bf <vsnprintf+0x47>
+  80099d:	ff 75 14             	push   0x14(%ebp)
+  8009a0:	ff 75 10             	push   0x10(%ebp)
+  8009a3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009a6:	50                   	push   %eax
+  8009a7:	68 fa 03 80 00       	push   $0x8003fa
+  8009ac:	e8 83 fa ff ff       	call   800434 <vprintfmt>
+  8009b1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009b4:	c6 00 00             	movb   $0x0,(%eax)
+  8009b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ba:	83 c4 10             	add    $0x10,%esp
+  8009bd:	c9                   	leave
+  8009be:	c3                   	ret
+  8009bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009c4:	eb f7                	jmp    8009bd <vsnprintf+0x45>
+
+008009c6 <snprintf>:
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	83 ec 08             	sub    $0x8,%esp
+  8009cc:	8d 45 14             	lea    0x14(%ebp),%eax
+  8009cf:	50                   	push   %eax
+  8009d0:	ff 75 10             	push   0x10(%ebp)
+  8009d3:	ff 75 0c             	push   0xc(%ebp)
+  8009d6:	ff 75 08             	push   0x8(%ebp)
+  8009d9:	e8 9a ff ff ff       	call   800978 <vsnprintf>
+  8009de:	c9                   	leave
+  8009df:	c3                   	ret
+
+008009e0 <strlen>:
+  8009e0:	55                   	push   %ebp
+  8009e1:	89 e5                	mov    %esp,%ebp
+  8009e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e6:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009e9:	74 10                	je     8009fb <strlen+0x1b>
+  8009eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f0:	83 c0 01             	add    $0x1,%eax
+  8009f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009f7:	75 f7                	jne    8009f0 <strlen+0x10>
+  8009f9:	5d                   	pop    %ebp
+  8009fa:	c3                   	ret
+  8009fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a00:	eb f7                	jmp    8009f9 <strlen+0x19>
+
+00800a02 <strnlen>:
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a0b:	85 d2                	test   %edx,%edx
+  800a0d:	74 16                	je     800a25 <strnlen+0x23>
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a14:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a18:	74 09                	je     800a23 <strnlen+0x21>
+  800a1a:	83 c0 01             	add    $0x1,%eax
+  800a1d:	39 d0                	cmp    %edx,%eax
+  800a1f:	75 f3                	jne    800a14 <strnlen+0x12>
+  800a21:	89 d0                	mov    %edx,%eax
+  800a23:	5d                   	pop    %ebp
+  800a24:	c3                   	ret
+  800a25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2a:	eb f7                	jmp    800a23 <strnlen+0x21>
+
+00800a2c <strcpy>:
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	53                   	push   %ebx
+  800a30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a3f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a42:	83 c0 01             	add    $0x1,%eax
+  800a45:	84 d2                	test   %dl,%dl
+  800a47:	75 f2                	jne    800a3b <strcpy+0xf>
+  800a49:	89 c8                	mov    %ecx,%eax
+  800a4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+
+00800a50 <strcat>:
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	53                   	push   %ebx
+  800a54:	83 ec 10             	sub    $0x10,%esp
+  800a57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a5a:	53                   	push   %ebx
+  800a5b:	e8 80 ff ff ff       	call   8009e0 <strlen>
+  800a60:	83 c4 08             	add    $0x8,%esp
+  800a63:	ff 75 0c             	push   0xc(%ebp)
+  800a66:	01 d8                	add    %ebx,%eax
+  800a68:	50                   	push   %eax
+  800a69:	e8 be ff ff ff       	call   800a2c <strcpy>
+  800a6e:	89 d8                	mov    %ebx,%eax
+  800a70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a73:	c9                   	leave
+  800a74:	c3                   	ret
+
+00800a75 <strncpy>:
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	56                   	push   %esi
+  800a79:	53                   	push   %ebx
+  800a7a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a83:	85 db                	test   %ebx,%ebx
+  800a85:	74 17                	je     800a9e <strncpy+0x29>
+  800a87:	01 f3                	add    %esi,%ebx
+  800a89:	89 f0                	mov    %esi,%eax
+  800a8b:	83 c0 01             	add    $0x1,%eax
+  800a8e:	0f b6 0a             	movzbl (%edx),%ecx
+  800a91:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a94:	80 f9 01             	cmp    $0x1,%cl
+  800a97:	83 da ff             	sbb    $0xffffffff,%edx
+  800a9a:	39 c3                	cmp    %eax,%ebx
+  800a9c:	75 ed                	jne    800a8b <strncpy+0x16>
+  800a9e:	89 f0                	mov    %esi,%eax
+  800aa0:	5b                   	pop    %ebx
+  800aa1:	5e                   	pop    %esi
+  800aa2:	5d                   	pop    %ebp
+  800aa3:	c3                   	ret
+
+00800aa4 <strlcpy>:
+  800aa4:	55                   	push   %ebp
+  800aa5:	89 e5                	mov    %esp,%ebp
+  800aa7:	56                   	push   %esi
+  800aa8:	53                   	push   %ebx
+  800aa9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aaf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ab2:	89 f0                	mov    %esi,%eax
+  800ab4:	85 db                	test   %ebx,%ebx
+  800ab6:	74 1e                	je     800ad6 <strlcpy+0x32>
+  800ab8:	83 eb 01             	sub    $0x1,%ebx
+  800abb:	74 16                	je     800ad3 <strlcpy+0x2f>
+  800abd:	01 f3                	add    %esi,%ebx
+  800abf:	0f b6 0a             	movzbl (%edx),%ecx
+  800ac2:	84 c9                	test   %cl,%cl
+  800ac4:	74 0d                	je     800ad3 <strlcpy+0x2f>
+  800ac6:	83 c2 01             	add    $0x1,%edx
+  800ac9:	83 c0 01             	add    $0x1,%eax
+  800acc:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800acf:	39 d8                	cmp    %ebx,%eax
+  800ad1:	75 ec                	jne    800abf <strlcpy+0x1b>
+  800ad3:	c6 00 00             	movb   $0x0,(%eax)
+  800ad6:	29 f0                	sub    %esi,%eax
+  800ad8:	5b                   	pop    %ebx
+  800ad9:	5e                   	pop    %esi
+  800ada:	5d                   	pop    %ebp
+  800adb:	c3                   	ret
+
+00800adc <strcmp>:
+  800adc:	55                   	push   %ebp
+  800add:	89 e5                	mov    %esp,%ebp
+  800adf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae5:	0f b6 01             	movzbl (%ecx),%eax
+  800ae8:	84 c0                	test   %al,%al
+  800aea:	74 11                	je     800afd <strcmp+0x21>
+  800aec:	38 02                	cmp    %al,(%edx)
+  800aee:	75 0d                	jne    800afd <strcmp+0x21>
+  800af0:	83 c1 01             	add    $0x1,%ecx
+  800af3:	83 c2 01             	add    $0x1,%edx
+  800af6:	0f b6 01             	movzbl (%ecx),%eax
+  800af9:	84 c0                	test   %al,%al
+  800afb:	75 ef                	jne    800aec <strcmp+0x10>
+  800afd:	0f b6 c0             	movzbl %al,%eax
+  800b00:	0f b6 12             	movzbl (%edx),%edx
+  800b03:	29 d0                	sub    %edx,%eax
+  800b05:	5d                   	pop    %ebp
+  800b06:	c3                   	ret
+
+00800b07 <strncmp>:
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	53                   	push   %ebx
+  800b0b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b0e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b11:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b19:	85 d2                	test   %edx,%edx
+  800b1b:	74 2e                	je     800b4b <strncmp+0x44>
+  800b1d:	0f b6 01             	movzbl (%ecx),%eax
+  800b20:	84 c0                	test   %al,%al
+  800b22:	74 16                	je     800b3a <strncmp+0x33>
+  800b24:	3a 03                	cmp    (%ebx),%al
+  800b26:	75 12                	jne    800b3a <strncmp+0x33>
+  800b28:	83 c1 01             	add    $0x1,%ecx
+  800b2b:	83 c3 01             	add    $0x1,%ebx
+  800b2e:	83 ea 01             	sub    $0x1,%edx
+  800b31:	75 ea                	jne    800b1d <strncmp+0x16>
+  800b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b38:	eb 11                	jmp    800b4b <strncmp+0x44>
+  800b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3f:	85 d2                	test   %edx,%edx
+  800b41:	74 08                	je     800b4b <strncmp+0x44>
+  800b43:	0f b6 01             	movzbl (%ecx),%eax
+  800b46:	0f b6 13             	movzbl (%ebx),%edx
+  800b49:	29 d0                	sub    %edx,%eax
+  800b4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b4e:	c9                   	leave
+  800b4f:	c3                   	ret
+
+00800b50 <strchr>:
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b5a:	0f b6 10             	movzbl (%eax),%edx
+  800b5d:	84 d2                	test   %dl,%dl
+  800b5f:	74 15                	je     800b76 <strchr+0x26>
+  800b61:	38 d1                	cmp    %dl,%cl
+  800b63:	74 0f                	je     800b74 <strchr+0x24>
+  800b65:	83 c0 01             	add    $0x1,%eax
+  800b68:	0f b6 10             	movzbl (%eax),%edx
+  800b6b:	84 d2                	test   %dl,%dl
+  800b6d:	75 f2                	jne    800b61 <strchr+0x11>
+  800b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b74:	5d                   	pop    %ebp
+  800b75:	c3                   	ret
+  800b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7b:	eb f7                	jmp    800b74 <strchr+0x24>
+
+00800b7d <strfind>:
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	53                   	push   %ebx
+  800b81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b84:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b87:	0f b6 18             	movzbl (%eax),%ebx
+  800b8a:	38 d3                	cmp    %dl,%bl
+  800b8c:	74 14                	je     800ba2 <strfind+0x25>
+  800b8e:	89 d1                	mov    %edx,%ecx
+  800b90:	84 db                	test   %bl,%bl
+  800b92:	74 0e                	je     800ba2 <strfind+0x25>
+  800b94:	83 c0 01             	add    $0x1,%eax
+  800b97:	0f b6 10             	movzbl (%eax),%edx
+  800b9a:	38 ca                	cmp    %cl,%dl
+  800b9c:	74 04                	je     800ba2 <strfind+0x25>
+  800b9e:	84 d2                	test   %dl,%dl
+  800ba0:	75 f2                	jne    800b94 <strfind+0x17>
+  800ba2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba5:	c9                   	leave
+  800ba6:	c3                   	ret
+
+00800ba7 <memset>:
+  800ba7:	55                   	push   %ebp
+  800ba8:	89 e5                	mov    %esp,%ebp
+  800baa:	57                   	push   %edi
+  800bab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800bb1:	85 c9                	test   %ecx,%ecx
+  800bb3:	74 20                	je     800bd5 <memset+0x2e>
+  800bb5:	89 f8                	mov    %edi,%eax
+  800bb7:	09 c8                	or     %ecx,%eax
+  800bb9:	a8 03                	test   $0x3,%al
+  800bbb:	75 12                	jne    800bcf <memset+0x28>
+  800bbd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bc1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800bc7:	c1 e9 02             	shr    $0x2,%ecx
+  800bca:	fc                   	cld
+  800bcb:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bcd:	eb 06                	jmp    800bd5 <memset+0x2e>
+  800bcf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bd2:	fc                   	cld
+  800bd3:	f3 aa                	rep stos %al,%es:(%edi)
+  800bd5:	89 f8                	mov    %edi,%eax
+  800bd7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bda:	c9                   	leave
+  800bdb:	c3                   	ret
+
+00800bdc <memmove>:
+  800bdc:	55                   	push   %ebp
+  800bdd:	89 e5                	mov    %esp,%ebp
+  800bdf:	57                   	push   %edi
+  800be0:	56                   	push   %esi
+  800be1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800be7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800bea:	39 c6                	cmp    %eax,%esi
+  800bec:	73 32                	jae    800c20 <memmove+0x44>
+  800bee:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bf1:	39 d0                	cmp    %edx,%eax
+  800bf3:	73 2b                	jae    800c20 <memmove+0x44>
+  800bf5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800bf8:	89 d6                	mov    %edx,%esi
+  800bfa:	09 fe                	or     %edi,%esi
+  800bfc:	09 ce                	or     %ecx,%esi
+  800bfe:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c04:	75 0e                	jne    800c14 <memmove+0x38>
+  800c06:	83 ef 04             	sub    $0x4,%edi
+  800c09:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c0c:	c1 e9 02             	shr    $0x2,%ecx
+  800c0f:	fd                   	std
+  800c10:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c12:	eb 09                	jmp    800c1d <memmove+0x41>
+  800c14:	83 ef 01             	sub    $0x1,%edi
+  800c17:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800c1a:	fd                   	std
+  800c1b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c1d:	fc                   	cld
+  800c1e:	eb 1a                	jmp    800c3a <memmove+0x5e>
+  800c20:	89 f2                	mov    %esi,%edx
+  800c22:	09 c2                	or     %eax,%edx
+  800c24:	09 ca                	or     %ecx,%edx
+  800c26:	f6 c2 03             	test   $0x3,%dl
+  800c29:	75 0a                	jne    800c35 <memmove+0x59>
+  800c2b:	c1 e9 02             	shr    $0x2,%ecx
+  800c2e:	89 c7                	mov    %eax,%edi
+  800c30:	fc                   	cld
+  800c31:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c33:	eb 05                	jmp    800c3a <memmove+0x5e>
+  800c35:	89 c7                	mov    %eax,%edi
+  800c37:	fc                   	cld
+  800c38:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c3a:	5e                   	pop    %esi
+  800c3b:	5f                   	pop    %edi
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	c3                   	ret
+
+00800c3e <memcpy>:
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	83 ec 0c             	sub    $0xc,%esp
+  800c44:	ff 75 10             	push   0x10(%ebp)
+  800c47:	ff 75 0c             	push   0xc(%ebp)
+  800c4a:	ff 75 08             	push   0x8(%ebp)
+  800c4d:	e8 8a ff ff ff       	call   800bdc <memmove>
+  800c52:	c9                   	leave
+  800c53:	c3                   	ret
+
+00800c54 <memcmp>:
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	56                   	push   %esi
+  800c58:	53                   	push   %ebx
+  800c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c5f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c62:	85 f6                	test   %esi,%esi
+  800c64:	74 29                	je     800c8f <memcmp+0x3b>
+  800c66:	01 c6                	add    %eax,%esi
+  800c68:	0f b6 08             	movzbl (%eax),%ecx
+  800c6b:	0f b6 1a             	movzbl (%edx),%ebx
+  800c6e:	38 d9                	cmp    %bl,%cl
+  800c70:	75 11                	jne    800c83 <memcmp+0x2f>
+  800c72:	83 c0 01             	add    $0x1,%eax
+  800c75:	83 c2 01             	add    $0x1,%edx
+  800c78:	39 c6                	cmp    %eax,%esi
+  800c7a:	75 ec                	jne    800c68 <memcmp+0x14>
+  800c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c81:	eb 08                	jmp    800c8b <memcmp+0x37>
+  800c83:	0f b6 c1             	movzbl %cl,%eax
+  800c86:	0f b6 db             	movzbl %bl,%ebx
+  800c89:	29 d8                	sub    %ebx,%eax
+  800c8b:	5b                   	pop    %ebx
+  800c8c:	5e                   	pop    %esi
+  800c8d:	5d                   	pop    %ebp
+  800c8e:	c3                   	ret
+  800c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c94:	eb f5                	jmp    800c8b <memcmp+0x37>
+
+00800c96 <memfind>:
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9f:	89 c2                	mov    %eax,%edx
+  800ca1:	03 55 10             	add    0x10(%ebp),%edx
+  800ca4:	39 d0                	cmp    %edx,%eax
+  800ca6:	73 0d                	jae    800cb5 <memfind+0x1f>
+  800ca8:	38 08                	cmp    %cl,(%eax)
+  800caa:	74 0d                	je     800cb9 <memfind+0x23>
+  800cac:	83 c0 01             	add    $0x1,%eax
+  800caf:	39 c2                	cmp    %eax,%edx
+  800cb1:	75 f5                	jne    800ca8 <memfind+0x12>
+  800cb3:	eb 06                	jmp    800cbb <memfind+0x25>
+  800cb5:	89 c2                	mov    %eax,%edx
+  800cb7:	eb 02                	jmp    800cbb <memfind+0x25>
+  800cb9:	89 c2                	mov    %eax,%edx
+  800cbb:	89 d0                	mov    %edx,%eax
+  800cbd:	5d                   	pop    %ebp
+  800cbe:	c3                   	ret
+
+00800cbf <strtol>:
+  800cbf:	55                   	push   %ebp
+  800cc0:	89 e5                	mov    %esp,%ebp
+  800cc2:	57                   	push   %edi
+  800cc3:	56                   	push   %esi
+  800cc4:	53                   	push   %ebx
+  800cc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ccb:	0f b6 02             	movzbl (%edx),%eax
+  800cce:	3c 20                	cmp    $0x20,%al
+  800cd0:	74 04                	je     800cd6 <strtol+0x17>
+  800cd2:	3c 09                	cmp    $0x9,%al
+  800cd4:	75 0e                	jne    800ce4 <strtol+0x25>
+  800cd6:	83 c2 01             	add    $0x1,%edx
+  800cd9:	0f b6 02             	movzbl (%edx),%eax
+  800cdc:	3c 20                	cmp    $0x20,%al
+  800cde:	74 f6                	je     800cd6 <strtol+0x17>
+  800ce0:	3c 09                	cmp    $0x9,%al
+  800ce2:	74 f2                	je     800cd6 <strtol+0x17>
+  800ce4:	3c 2b                	cmp    $0x2b,%al
+  800ce6:	74 2a                	je     800d12 <strtol+0x53>
+  800ce8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ced:	3c 2d                	cmp    $0x2d,%al
+  800cef:	74 2b                	je     800d1c <strtol+0x5d>
+  800cf1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cf7:	75 0f                	jne    800d08 <strtol+0x49>
+  800cf9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cfc:	74 28                	je     800d26 <strtol+0x67>
+  800cfe:	85 db                	test   %ebx,%ebx
+  800d00:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d05:	0f 44 d8             	cmove  %eax,%ebx
+  800d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d10:	eb 46                	jmp    800d58 <strtol+0x99>
+  800d12:	83 c2 01             	add    $0x1,%edx
+  800d15:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1a:	eb d5                	jmp    800cf1 <strtol+0x32>
+  800d1c:	83 c2 01             	add    $0x1,%edx
+  800d1f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d24:	eb cb                	jmp    800cf1 <strtol+0x32>
+  800d26:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d2a:	74 0e                	je     800d3a <strtol+0x7b>
+  800d2c:	85 db                	test   %ebx,%ebx
+  800d2e:	75 d8                	jne    800d08 <strtol+0x49>
+  800d30:	83 c2 01             	add    $0x1,%edx
+  800d33:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d38:	eb ce                	jmp    800d08 <strtol+0x49>
+  800d3a:	83 c2 02             	add    $0x2,%edx
+  800d3d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d42:	eb c4                	jmp    800d08 <strtol+0x49>
+  800d44:	0f be c0             	movsbl %al,%eax
+  800d47:	83 e8 30             	sub    $0x30,%eax
+  800d4a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d4d:	7d 3a                	jge    800d89 <strtol+0xca>
+  800d4f:	83 c2 01             	add    $0x1,%edx
+  800d52:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d56:	01 c1                	add    %eax,%ecx
+  800d58:	0f b6 02             	movzbl (%edx),%eax
+  800d5b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d5e:	89 f3                	mov    %esi,%ebx
+  800d60:	80 fb 09             	cmp    $0x9,%bl
+  800d63:	76 df                	jbe    800d44 <strtol+0x85>
+  800d65:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d68:	89 f3                	mov    %esi,%ebx
+  800d6a:	80 fb 19             	cmp    $0x19,%bl
+  800d6d:	77 08                	ja     800d77 <strtol+0xb8>
+  800d6f:	0f be c0             	movsbl %al,%eax
+  800d72:	83 e8 57             	sub    $0x57,%eax
+  800d75:	eb d3                	jmp    800d4a <strtol+0x8b>
+  800d77:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d7a:	89 f3                	mov    %esi,%ebx
+  800d7c:	80 fb 19             	cmp    $0x19,%bl
+  800d7f:	77 08                	ja     800d89 <strtol+0xca>
+  800d81:	0f be c0             	movsbl %al,%eax
+  800d84:	83 e8 37             	sub    $0x37,%eax
+  800d87:	eb c1                	jmp    800d4a <strtol+0x8b>
+  800d89:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d8d:	74 05                	je     800d94 <strtol+0xd5>
+  800d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d92:	89 10                	mov    %edx,(%eax)
+  800d94:	89 c8                	mov    %ecx,%eax
+  800d96:	f7 d8                	neg    %eax
+  800d98:	85 ff                	test   %edi,%edi
+  800d9a:	0f 45 c8             	cmovne %eax,%ecx
+  800d9d:	89 c8                	mov    %ecx,%eax
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+
+00800da4 <sys_cputs>:
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+  800daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800daf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db5:	89 c3                	mov    %eax,%ebx
+  800db7:	89 c7                	mov    %eax,%edi
+  800db9:	89 c6                	mov    %eax,%esi
+  800dbb:	cd 30                	int    $0x30
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+
+00800dc2 <sys_cgetc>:
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	57                   	push   %edi
+  800dc6:	56                   	push   %esi
+  800dc7:	53                   	push   %ebx
+  800dc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd2:	89 d1                	mov    %edx,%ecx
+  800dd4:	89 d3                	mov    %edx,%ebx
+  800dd6:	89 d7                	mov    %edx,%edi
+  800dd8:	89 d6                	mov    %edx,%esi
+  800dda:	cd 30                	int    $0x30
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5f                   	pop    %edi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <sys_env_destroy>:
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	57                   	push   %edi
+  800de5:	56                   	push   %esi
+  800de6:	53                   	push   %ebx
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800def:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df7:	89 cb                	mov    %ecx,%ebx
+  800df9:	89 cf                	mov    %ecx,%edi
+  800dfb:	89 ce                	mov    %ecx,%esi
+  800dfd:	cd 30                	int    $0x30
+  800dff:	85 c0                	test   %eax,%eax
+  800e01:	7f 08                	jg     800e0b <sys_env_destroy+0x2a>
+  800e03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e06:	5b                   	pop    %ebx
+  800e07:	5e                   	pop    %esi
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+  800e0b:	83 ec 0c             	sub    $0xc,%esp
+  800e0e:	50                   	push   %eax
+  800e0f:	6a 03                	push   $0x3
+  800e11:	68 cb 36 80 00       	push   $0x8036cb
+  800e16:	6a 24                	push   $0x24
+  800e18:	68 e8 36 80 00       	push   $0x8036e8
+  800e1d:	e8 38 f4 ff ff       	call   80025a <_panic>
+
+00800e22 <sys_getenvid>:
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	57                   	push   %edi
+  800e26:	56                   	push   %esi
+  800e27:	53                   	push   %ebx
+  800e28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e32:	89 d1                	mov    %edx,%ecx
+  800e34:	89 d3                	mov    %edx,%ebx
+  800e36:	89 d7                	mov    %edx,%edi
+  800e38:	89 d6                	mov    %edx,%esi
+  800e3a:	cd 30                	int    $0x30
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5f                   	pop    %edi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+
+00800e41 <sys_yield>:
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	57                   	push   %edi
+  800e45:	56                   	push   %esi
+  800e46:	53                   	push   %ebx
+  800e47:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e4e:	74 26                	je     800e76 <sys_yield+0x35>
+  800e50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e55:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e5a:	89 d1                	mov    %edx,%ecx
+  800e5c:	89 d3                	mov    %edx,%ebx
+  800e5e:	89 d7                	mov    %edx,%edi
+  800e60:	6a 00                	push   $0x0
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	8d 35 6d 0e 80 00    	lea    0x800e6d,%esi
+  800e6b:	0f 34                	sysenter
+  800e6d:	5d                   	pop    %ebp
+  800e6e:	83 c4 04             	add    $0x4,%esp
+  800e71:	5b                   	pop    %ebx
+  800e72:	5e                   	pop    %esi
+  800e73:	5f                   	pop    %edi
+  800e74:	5d                   	pop    %ebp
+  800e75:	c3                   	ret
+  800e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e80:	89 d1                	mov    %edx,%ecx
+  800e82:	89 d3                	mov    %edx,%ebx
+  800e84:	89 d7                	mov    %edx,%edi
+  800e86:	89 d6                	mov    %edx,%esi
+  800e88:	cd 30                	int    $0x30
+  800e8a:	eb e5                	jmp    800e71 <sys_yield+0x30>
+
+00800e8c <sys_page_alloc>:
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	56                   	push   %esi
+  800e91:	53                   	push   %ebx
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+  800e95:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ea5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea8:	89 f7                	mov    %esi,%edi
+  800eaa:	cd 30                	int    $0x30
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	7f 08                	jg     800eb8 <sys_page_alloc+0x2c>
+  800eb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+  800eb8:	83 ec 0c             	sub    $0xc,%esp
+  800ebb:	50                   	push   %eax
+  800ebc:	6a 04                	push   $0x4
+  800ebe:	68 cb 36 80 00       	push   $0x8036cb
+  800ec3:	6a 24                	push   $0x24
+  800ec5:	68 e8 36 80 00       	push   $0x8036e8
+  800eca:	e8 8b f3 ff ff       	call   80025a <_panic>
+
+00800ecf <sys_page_map>:
+  800ecf:	55                   	push   %ebp
+  800ed0:	89 e5                	mov    %esp,%ebp
+  800ed2:	57                   	push   %edi
+  800ed3:	56                   	push   %esi
+  800ed4:	53                   	push   %ebx
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+  800ed8:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800edf:	74 33                	je     800f14 <sys_page_map+0x45>
+  800ee1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef2:	ff 75 18             	push   0x18(%ebp)
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	8d 35 00 0f 80 00    	lea    0x800f00,%esi
+  800efe:	0f 34                	sysenter
+  800f00:	5d                   	pop    %ebp
+  800f01:	83 c4 04             	add    $0x4,%esp
+  800f04:	89 c2                	mov    %eax,%edx
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	7f 3d                	jg     800f47 <sys_page_map+0x78>
+  800f0a:	89 d0                	mov    %edx,%eax
+  800f0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5f                   	pop    %edi
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+  800f14:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f22:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f25:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f28:	cd 30                	int    $0x30
+  800f2a:	89 c2                	mov    %eax,%edx
+  800f2c:	85 c0                	test   %eax,%eax
+  800f2e:	7e da                	jle    800f0a <sys_page_map+0x3b>
+  800f30:	83 ec 0c             	sub    $0xc,%esp
+  800f33:	50                   	push   %eax
+  800f34:	6a 05                	push   $0x5
+  800f36:	68 cb 36 80 00       	push   $0x8036cb
+  800f3b:	6a 24                	push   $0x24
+  800f3d:	68 e8 36 80 00       	push   $0x8036e8
+  800f42:	e8 13 f3 ff ff       	call   80025a <_panic>
+  800f47:	83 ec 0c             	sub    $0xc,%esp
+  800f4a:	50                   	push   %eax
+  800f4b:	6a 05                	push   $0x5
+  800f4d:	68 cb 36 80 00       	push   $0x8036cb
+  800f52:	6a 48                	push   $0x48
+  800f54:	68 e8 36 80 00       	push   $0x8036e8
+  800f59:	e8 fc f2 ff ff       	call   80025a <_panic>
+
+00800f5e <sys_page_unmap>:
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f77:	89 df                	mov    %ebx,%edi
+  800f79:	89 de                	mov    %ebx,%esi
+  800f7b:	cd 30                	int    $0x30
+  800f7d:	85 c0                	test   %eax,%eax
+  800f7f:	7f 08                	jg     800f89 <sys_page_unmap+0x2b>
+  800f81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 06                	push   $0x6
+  800f8f:	68 cb 36 80 00       	push   $0x8036cb
+  800f94:	6a 24                	push   $0x24
+  800f96:	68 e8 36 80 00       	push   $0x8036e8
+  800f9b:	e8 ba f2 ff ff       	call   80025a <_panic>
+
+00800fa0 <sys_fork>:
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  800fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fb0:	89 d1                	mov    %edx,%ecx
+  800fb2:	89 d3                	mov    %edx,%ebx
+  800fb4:	89 d7                	mov    %edx,%edi
+  800fb6:	89 d6                	mov    %edx,%esi
+  800fb8:	cd 30                	int    $0x30
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+
+00800fbf <sys_env_set_status>:
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+  800fc5:	83 ec 0c             	sub    $0xc,%esp
+  800fc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd3:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fd8:	89 df                	mov    %ebx,%edi
+  800fda:	89 de                	mov    %ebx,%esi
+  800fdc:	cd 30                	int    $0x30
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	7f 08                	jg     800fea <sys_env_set_status+0x2b>
+  800fe2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe5:	5b                   	pop    %ebx
+  800fe6:	5e                   	pop    %esi
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+  800fea:	83 ec 0c             	sub    $0xc,%esp
+  800fed:	50                   	push   %eax
+  800fee:	6a 08                	push   $0x8
+  800ff0:	68 cb 36 80 00       	push   $0x8036cb
+  800ff5:	6a 24                	push   $0x24
+  800ff7:	68 e8 36 80 00       	push   $0x8036e8
+  800ffc:	e8 59 f2 ff ff       	call   80025a <_panic>
+
+00801001 <sys_env_set_trapframe>:
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	56                   	push   %esi
+  801006:	53                   	push   %ebx
+  801007:	83 ec 0c             	sub    $0xc,%esp
+  80100a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801012:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801015:	b8 09 00 00 00       	mov    $0x9,%eax
+  80101a:	89 df                	mov    %ebx,%edi
+  80101c:	89 de                	mov    %ebx,%esi
+  80101e:	cd 30                	int    $0x30
+  801020:	85 c0                	test   %eax,%eax
+  801022:	7f 08                	jg     80102c <sys_env_set_trapframe+0x2b>
+  801024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801027:	5b                   	pop    %ebx
+  801028:	5e                   	pop    %esi
+  801029:	5f                   	pop    %edi
+  80102a:	5d                   	pop    %ebp
+  80102b:	c3                   	ret
+  80102c:	83 ec 0c             	sub    $0xc,%esp
+  80102f:	50                   	push   %eax
+  801030:	6a 09                	push   $0x9
+  801032:	68 cb 36 80 00       	push   $0x8036cb
+  801037:	6a 24                	push   $0x24
+  801039:	68 e8 36 80 00       	push   $0x8036e8
+  80103e:	e8 17 f2 ff ff       	call   80025a <_panic>
+
+00801043 <sys_env_set_cow>:
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801051:	8b 55 08             	mov    0x8(%ebp),%edx
+  801054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801057:	b8 20 00 00 00       	mov    $0x20,%eax
+  80105c:	89 df                	mov    %ebx,%edi
+  80105e:	89 de                	mov    %ebx,%esi
+  801060:	cd 30                	int    $0x30
+  801062:	85 c0                	test   %eax,%eax
+  801064:	7f 08                	jg     80106e <sys_env_set_cow+0x2b>
+  801066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5f                   	pop    %edi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+  80106e:	83 ec 0c             	sub    $0xc,%esp
+  801071:	50                   	push   %eax
+  801072:	6a 20                	push   $0x20
+  801074:	68 cb 36 80 00       	push   $0x8036cb
+  801079:	6a 24                	push   $0x24
+  80107b:	68 e8 36 80 00       	push   $0x8036e8
+  801080:	e8 d5 f1 ff ff       	call   80025a <_panic>
+
+00801085 <sys_env_service>:
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	57                   	push   %edi
+  801089:	56                   	push   %esi
+  80108a:	53                   	push   %ebx
+  80108b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801090:	8b 55 08             	mov    0x8(%ebp),%edx
+  801093:	b8 21 00 00 00       	mov    $0x21,%eax
+  801098:	89 cb                	mov    %ecx,%ebx
+  80109a:	89 cf                	mov    %ecx,%edi
+  80109c:	89 ce                	mov    %ecx,%esi
+  80109e:	cd 30                	int    $0x30
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+
+008010a5 <sys_env_set_pgfault_upcall>:
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+  8010ab:	83 ec 0c             	sub    $0xc,%esp
+  8010ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010be:	89 df                	mov    %ebx,%edi
+  8010c0:	89 de                	mov    %ebx,%esi
+  8010c2:	cd 30                	int    $0x30
+  8010c4:	85 c0                	test   %eax,%eax
+  8010c6:	7f 08                	jg     8010d0 <sys_env_set_pgfault_upcall+0x2b>
+  8010c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+  8010d0:	83 ec 0c             	sub    $0xc,%esp
+  8010d3:	50                   	push   %eax
+  8010d4:	6a 0a                	push   $0xa
+  8010d6:	68 cb 36 80 00       	push   $0x8036cb
+  8010db:	6a 24                	push   $0x24
+  8010dd:	68 e8 36 80 00       	push   $0x8036e8
+  8010e2:	e8 73 f1 ff ff       	call   80025a <_panic>
+
+008010e7 <sys_ipc_try_send>:
+  8010e7:	55                   	push   %ebp
+  8010e8:	89 e5                	mov    %esp,%ebp
+  8010ea:	57                   	push   %edi
+  8010eb:	56                   	push   %esi
+  8010ec:	53                   	push   %ebx
+  8010ed:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010f4:	74 27                	je     80111d <sys_ipc_try_send+0x36>
+  8010f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801101:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801104:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801107:	6a 00                	push   $0x0
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	8d 35 14 11 80 00    	lea    0x801114,%esi
+  801112:	0f 34                	sysenter
+  801114:	5d                   	pop    %ebp
+  801115:	83 c4 04             	add    $0x4,%esp
+  801118:	5b                   	pop    %ebx
+  801119:	5e                   	pop    %esi
+  80111a:	5f                   	pop    %edi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+  80111d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801122:	be 00 00 00 00       	mov    $0x0,%esi
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801130:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801133:	cd 30                	int    $0x30
+  801135:	eb e1                	jmp    801118 <sys_ipc_try_send+0x31>
+
+00801137 <sys_ipc_recv>:
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	56                   	push   %esi
+  80113c:	53                   	push   %ebx
+  80113d:	83 ec 0c             	sub    $0xc,%esp
+  801140:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801147:	74 32                	je     80117b <sys_ipc_recv+0x44>
+  801149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801151:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801156:	89 cb                	mov    %ecx,%ebx
+  801158:	89 cf                	mov    %ecx,%edi
+  80115a:	6a 00                	push   $0x0
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	8d 35 67 11 80 00    	lea    0x801167,%esi
+  801165:	0f 34                	sysenter
+  801167:	5d                   	pop    %ebp
+  801168:	83 c4 04             	add    $0x4,%esp
+  80116b:	89 c2                	mov    %eax,%edx
+  80116d:	85 c0                	test   %eax,%eax
+  80116f:	7f 3c                	jg     8011ad <sys_ipc_recv+0x76>
+  801171:	89 d0                	mov    %edx,%eax
+  801173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+  80117b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801180:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	89 cb                	mov    %ecx,%ebx
+  80118a:	89 cf                	mov    %ecx,%edi
+  80118c:	89 ce                	mov    %ecx,%esi
+  80118e:	cd 30                	int    $0x30
+  801190:	89 c2                	mov    %eax,%edx
+  801192:	85 c0                	test   %eax,%eax
+  801194:	7e db                	jle    801171 <sys_ipc_recv+0x3a>
+  801196:	83 ec 0c             	sub    $0xc,%esp
+  801199:	50                   	push   %eax
+  80119a:	6a 0d                	push   $0xd
+  80119c:	68 cb 36 80 00       	push   $0x8036cb
+  8011a1:	6a 24                	push   $0x24
+  8011a3:	68 e8 36 80 00       	push   $0x8036e8
+  8011a8:	e8 ad f0 ff ff       	call   80025a <_panic>
+  8011ad:	83 ec 0c             	sub    $0xc,%esp
+  8011b0:	50                   	push   %eax
+  8011b1:	6a 0d                	push   $0xd
+  8011b3:	68 cb 36 80 00       	push   $0x8036cb
+  8011b8:	6a 48                	push   $0x48
+  8011ba:	68 e8 36 80 00       	push   $0x8036e8
+  8011bf:	e8 96 f0 ff ff       	call   80025a <_panic>
+
+008011c4 <sys_ipc_send>:
+  8011c4:	55                   	push   %ebp
+  8011c5:	89 e5                	mov    %esp,%ebp
+  8011c7:	57                   	push   %edi
+  8011c8:	56                   	push   %esi
+  8011c9:	53                   	push   %ebx
+  8011ca:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011d1:	74 27                	je     8011fa <sys_ipc_send+0x36>
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e4:	6a 00                	push   $0x0
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	8d 35 f1 11 80 00    	lea    0x8011f1,%esi
+  8011ef:	0f 34                	sysenter
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	83 c4 04             	add    $0x4,%esp
+  8011f5:	5b                   	pop    %ebx
+  8011f6:	5e                   	pop    %esi
+  8011f7:	5f                   	pop    %edi
+  8011f8:	5d                   	pop    %ebp
+  8011f9:	c3                   	ret
+  8011fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801204:	8b 55 08             	mov    0x8(%ebp),%edx
+  801207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801210:	cd 30                	int    $0x30
+  801212:	eb e1                	jmp    8011f5 <sys_ipc_send+0x31>
+
+00801214 <sys_ipc_call>:
+  801214:	55                   	push   %ebp
+  801215:	89 e5                	mov    %esp,%ebp
+  801217:	57                   	push   %edi
+  801218:	56                   	push   %esi
+  801219:	53                   	push   %ebx
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801220:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801225:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801228:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80122e:	cd 30                	int    $0x30
+  801230:	5b                   	pop    %ebx
+  801231:	5e                   	pop    %esi
+  801232:	5f                   	pop    %edi
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+
+00801235 <sys_ipc_reply_recv>:
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+  80123b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801241:	b8 10 00 00 00       	mov    $0x10,%eax
+  801246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801249:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80124f:	cd 30                	int    $0x30
+  801251:	5b                   	pop    %ebx
+  801252:	5e                   	pop    %esi
+  801253:	5f                   	pop    %edi
+  801254:	5d                   	pop    %ebp
+  801255:	c3                   	ret
+
+00801256 <sys_time_msec>:
+  801256:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	75 06                	jne    801265 <sys_time_msec+0xf>
+  80125f:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801264:	c3                   	ret
+  801265:	55                   	push   %ebp
+  801266:	89 e5                	mov    %esp,%ebp
+  801268:	57                   	push   %edi
+  801269:	56                   	push   %esi
+  80126a:	53                   	push   %ebx
+  80126b:	83 ec 0c             	sub    $0xc,%esp
+  80126e:	0f 31                	rdtsc
+  801270:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801276:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80127c:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801282:	29 c8                	sub    %ecx,%eax
+  801284:	19 da                	sbb    %ebx,%edx
+  801286:	bf 00 00 00 00       	mov    $0x0,%edi
+  80128b:	57                   	push   %edi
+  80128c:	56                   	push   %esi
+  80128d:	52                   	push   %edx
+  80128e:	50                   	push   %eax
+  80128f:	e8 4b 1f 00 00       	call   8031df <__udivdi3>
+  801294:	83 c4 10             	add    $0x10,%esp
+  801297:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+
+0080129f <sys_env_swap>:
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	57                   	push   %edi
+  8012a3:	56                   	push   %esi
+  8012a4:	53                   	push   %ebx
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+  8012a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012b5:	89 cb                	mov    %ecx,%ebx
+  8012b7:	89 cf                	mov    %ecx,%edi
+  8012b9:	89 ce                	mov    %ecx,%esi
+  8012bb:	cd 30                	int    $0x30
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	7f 08                	jg     8012c9 <sys_env_swap+0x2a>
+  8012c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c4:	5b                   	pop    %ebx
+  8012c5:	5e                   	pop    %esi
+  8012c6:	5f                   	pop    %edi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	c3                   	ret
+  8012c9:	83 ec 0c             	sub    $0xc,%esp
+  8012cc:	50                   	push   %eax
+  8012cd:	6a 12                	push   $0x12
+  8012cf:	68 cb 36 80 00       	push   $0x8036cb
+  8012d4:	6a 24                	push   $0x24
+  8012d6:	68 e8 36 80 00       	push   $0x8036e8
+  8012db:	e8 7a ef ff ff       	call   80025a <_panic>
+
+008012e0 <sys_net_try_send>:
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	57                   	push   %edi
+  8012e4:	56                   	push   %esi
+  8012e5:	53                   	push   %ebx
+  8012e6:	83 ec 0c             	sub    $0xc,%esp
+  8012e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012f9:	89 df                	mov    %ebx,%edi
+  8012fb:	89 de                	mov    %ebx,%esi
+  8012fd:	cd 30                	int    $0x30
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	7f 08                	jg     80130b <sys_net_try_send+0x2b>
+  801303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+  80130e:	50                   	push   %eax
+  80130f:	6a 13                	push   $0x13
+  801311:	68 cb 36 80 00       	push   $0x8036cb
+  801316:	6a 24                	push   $0x24
+  801318:	68 e8 36 80 00       	push   $0x8036e8
+  80131d:	e8 38 ef ff ff       	call   80025a <_panic>
+
+00801322 <sys_net_try_receive>:
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	57                   	push   %edi
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+  801328:	83 ec 0c             	sub    $0xc,%esp
+  80132b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801330:	8b 55 08             	mov    0x8(%ebp),%edx
+  801333:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801336:	b8 14 00 00 00       	mov    $0x14,%eax
+  80133b:	89 df                	mov    %ebx,%edi
+  80133d:	89 de                	mov    %ebx,%esi
+  80133f:	cd 30                	int    $0x30
+  801341:	85 c0                	test   %eax,%eax
+  801343:	7f 08                	jg     80134d <sys_net_try_receive+0x2b>
+  801345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5f                   	pop    %edi
+  80134b:	5d                   	pop    %ebp
+  80134c:	c3                   	ret
+  80134d:	83 ec 0c             	sub    $0xc,%esp
+  801350:	50                   	push   %eax
+  801351:	6a 14                	push   $0x14
+  801353:	68 cb 36 80 00       	push   $0x8036cb
+  801358:	6a 24                	push   $0x24
+  80135a:	68 e8 36 80 00       	push   $0x8036e8
+  80135f:	e8 f6 ee ff ff       	call   80025a <_panic>
+
+00801364 <sys_net_recv_page>:
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	57                   	push   %edi
+  801368:	56                   	push   %esi
+  801369:	53                   	push   %ebx
+  80136a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80136f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801372:	b8 27 00 00 00       	mov    $0x27,%eax
+  801377:	89 cb                	mov    %ecx,%ebx
+  801379:	89 cf                	mov    %ecx,%edi
+  80137b:	89 ce                	mov    %ecx,%esi
+  80137d:	cd 30                	int    $0x30
+  80137f:	5b                   	pop    %ebx
+  801380:	5e                   	pop    %esi
+  801381:	5f                   	pop    %edi
+  801382:	5d                   	pop    %ebp
+  801383:	c3                   	ret
+
+00801384 <sys_net_wait>:
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	57                   	push   %edi
+  801388:	56                   	push   %esi
+  801389:	53                   	push   %ebx
+  80138a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138f:	b8 26 00 00 00       	mov    $0x26,%eax
+  801394:	89 d1                	mov    %edx,%ecx
+  801396:	89 d3                	mov    %edx,%ebx
+  801398:	89 d7                	mov    %edx,%edi
+  80139a:	89 d6                	mov    %edx,%esi
+  80139c:	cd 30                	int    $0x30
+  80139e:	5b                   	pop    %ebx
+  80139f:	5e                   	pop    %esi
+  8013a0:	5f                   	pop    %edi
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+
+008013a3 <sys_get_mac>:
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	57                   	push   %edi
+  8013a7:	56                   	push   %esi
+  8013a8:	53                   	push   %ebx
+  8013a9:	83 ec 0c             	sub    $0xc,%esp
+  8013ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013bc:	89 df                	mov    %ebx,%edi
+  8013be:	89 de                	mov    %ebx,%esi
+  8013c0:	cd 30                	int    $0x30
+  8013c2:	85 c0                	test   %eax,%eax
+  8013c4:	7f 08                	jg     8013ce <sys_get_mac+0x2b>
+  8013c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c9:	5b                   	pop    %ebx
+  8013ca:	5e                   	pop    %esi
+  8013cb:	5f                   	pop    %edi
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+  8013ce:	83 ec 0c             	sub    $0xc,%esp
+  8013d1:	50                   	push   %eax
+  8013d2:	6a 15                	push   $0x15
+  8013d4:	68 cb 36 80 00       	push   $0x8036cb
+  8013d9:	6a 24                	push   $0x24
+  8013db:	68 e8 36 80 00       	push   $0x8036e8
+  8013e0:	e8 75 ee ff ff       	call   80025a <_panic>
+
+008013e5 <sys_env_lease>:
+  8013e5:	55                   	push   %ebp
+  8013e6:	89 e5                	mov    %esp,%ebp
+  8013e8:	57                   	push   %edi
+  8013e9:	56                   	push   %esi
+  8013ea:	53                   	push   %ebx
+  8013eb:	83 ec 0c             	sub    $0xc,%esp
+  8013ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013fe:	89 df                	mov    %ebx,%edi
+  801400:	89 de                	mov    %ebx,%esi
+  801402:	cd 30                	int    $0x30
+  801404:	85 c0                	test   %eax,%eax
+  801406:	7f 08                	jg     801410 <sys_env_lease+0x2b>
+  801408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140b:	5b                   	pop    %ebx
+  80140c:	5e                   	pop    %esi
+  80140d:	5f                   	pop    %edi
+  80140e:	5d                   	pop    %ebp
+  80140f:	c3                   	ret
+  801410:	83 ec 0c             	sub    $0xc,%esp
+  801413:	50                   	push   %eax
+  801414:	6a 16                	push   $0x16
+  801416:	68 cb 36 80 00       	push   $0x8036cb
+  80141b:	6a 24                	push   $0x24
+  80141d:	68 e8 36 80 00       	push   $0x8036e8
+  801422:	e8 33 ee ff ff       	call   80025a <_panic>
+
+00801427 <sys_copy_mem>:
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	57                   	push   %edi
+  80142b:	56                   	push   %esi
+  80142c:	53                   	push   %ebx
+  80142d:	83 ec 0c             	sub    $0xc,%esp
+  801430:	8b 55 08             	mov    0x8(%ebp),%edx
+  801433:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801436:	b8 17 00 00 00       	mov    $0x17,%eax
+  80143b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801441:	8b 75 18             	mov    0x18(%ebp),%esi
+  801444:	cd 30                	int    $0x30
+  801446:	85 c0                	test   %eax,%eax
+  801448:	7f 08                	jg     801452 <sys_copy_mem+0x2b>
+  80144a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144d:	5b                   	pop    %ebx
+  80144e:	5e                   	pop    %esi
+  80144f:	5f                   	pop    %edi
+  801450:	5d                   	pop    %ebp
+  801451:	c3                   	ret
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	50                   	push   %eax
+  801456:	6a 17                	push   $0x17
+  801458:	68 cb 36 80 00       	push   $0x8036cb
+  80145d:	6a 24                	push   $0x24
+  80145f:	68 e8 36 80 00       	push   $0x8036e8
+  801464:	e8 f1 ed ff ff       	call   80025a <_panic>
+
+00801469 <sys_get_perms>:
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	57                   	push   %edi
+  80146d:	56                   	push   %esi
+  80146e:	53                   	push   %ebx
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	be 00 00 00 00       	mov    $0x0,%esi
+  801477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801482:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801485:	89 f7                	mov    %esi,%edi
+  801487:	cd 30                	int    $0x30
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	7f 08                	jg     801495 <sys_get_perms+0x2c>
+  80148d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801490:	5b                   	pop    %ebx
+  801491:	5e                   	pop    %esi
+  801492:	5f                   	pop    %edi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+  801495:	83 ec 0c             	sub    $0xc,%esp
+  801498:	50                   	push   %eax
+  801499:	6a 18                	push   $0x18
+  80149b:	68 cb 36 80 00       	push   $0x8036cb
+  8014a0:	6a 24                	push   $0x24
+  8014a2:	68 e8 36 80 00       	push   $0x8036e8
+  8014a7:	e8 ae ed ff ff       	call   80025a <_panic>
+
+008014ac <sys_env_unsuspend>:
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	57                   	push   %edi
+  8014b0:	56                   	push   %esi
+  8014b1:	53                   	push   %ebx
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c0:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c8:	89 f7                	mov    %esi,%edi
+  8014ca:	cd 30                	int    $0x30
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	7f 08                	jg     8014d8 <sys_env_unsuspend+0x2c>
+  8014d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d3:	5b                   	pop    %ebx
+  8014d4:	5e                   	pop    %esi
+  8014d5:	5f                   	pop    %edi
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+  8014d8:	83 ec 0c             	sub    $0xc,%esp
+  8014db:	50                   	push   %eax
+  8014dc:	6a 19                	push   $0x19
+  8014de:	68 cb 36 80 00       	push   $0x8036cb
+  8014e3:	6a 24                	push   $0x24
+  8014e5:	68 e8 36 80 00       	push   $0x8036e8
+  8014ea:	e8 6b ed ff ff       	call   80025a <_panic>
+
+008014ef <sys_migrate>:
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	57                   	push   %edi
+  8014f3:	56                   	push   %esi
+  8014f4:	53                   	push   %ebx
+  8014f5:	83 ec 0c             	sub    $0xc,%esp
+  8014f8:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8014fd:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801503:	76 11                	jbe    801516 <sys_migrate+0x27>
+  801505:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80150a:	0f b6 08             	movzbl (%eax),%ecx
+  80150d:	05 00 10 00 00       	add    $0x1000,%eax
+  801512:	39 d0                	cmp    %edx,%eax
+  801514:	72 f4                	jb     80150a <sys_migrate+0x1b>
+  801516:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801523:	89 cb                	mov    %ecx,%ebx
+  801525:	89 cf                	mov    %ecx,%edi
+  801527:	89 ce                	mov    %ecx,%esi
+  801529:	cd 30                	int    $0x30
+  80152b:	85 c0                	test   %eax,%eax
+  80152d:	7f 08                	jg     801537 <sys_migrate+0x48>
+  80152f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801532:	5b                   	pop    %ebx
+  801533:	5e                   	pop    %esi
+  801534:	5f                   	pop    %edi
+  801535:	5d                   	pop    %ebp
+  801536:	c3                   	ret
+  801537:	83 ec 0c             	sub    $0xc,%esp
+  80153a:	50                   	push   %eax
+  80153b:	6a 1a                	push   $0x1a
+  80153d:	68 cb 36 80 00       	push   $0x8036cb
+  801542:	6a 24                	push   $0x24
+  801544:	68 e8 36 80 00       	push   $0x8036e8
+  801549:	e8 0c ed ff ff       	call   80025a <_panic>
+
+0080154e <sys_lease_complete>:
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	57                   	push   %edi
+  801552:	56                   	push   %esi
+  801553:	53                   	push   %ebx
+  801554:	83 ec 0c             	sub    $0xc,%esp
+  801557:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801561:	89 d1                	mov    %edx,%ecx
+  801563:	89 d3                	mov    %edx,%ebx
+  801565:	89 d7                	mov    %edx,%edi
+  801567:	89 d6                	mov    %edx,%esi
+  801569:	cd 30                	int    $0x30
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	7f 08                	jg     801577 <sys_lease_complete+0x29>
+  80156f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801572:	5b                   	pop    %ebx
+  801573:	5e                   	pop    %esi
+  801574:	5f                   	pop    %edi
+  801575:	5d                   	pop    %ebp
+  801576:	c3                   	ret
+  801577:	83 ec 0c             	sub    $0xc,%esp
+  80157a:	50                   	push   %eax
+  80157b:	6a 1b                	push   $0x1b
+  80157d:	68 cb 36 80 00       	push   $0x8036cb
+  801582:	6a 24                	push   $0x24
+  801584:	68 e8 36 80 00       	push   $0x8036e8
+  801589:	e8 cc ec ff ff       	call   80025a <_panic>
+
+0080158e <sys_env_set_thisenv>:
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	56                   	push   %esi
+  801593:	53                   	push   %ebx
+  801594:	83 ec 0c             	sub    $0xc,%esp
+  801597:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015a7:	89 df                	mov    %ebx,%edi
+  8015a9:	89 de                	mov    %ebx,%esi
+  8015ab:	cd 30                	int    $0x30
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	7f 08                	jg     8015b9 <sys_env_set_thisenv+0x2b>
+  8015b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b4:	5b                   	pop    %ebx
+  8015b5:	5e                   	pop    %esi
+  8015b6:	5f                   	pop    %edi
+  8015b7:	5d                   	pop    %ebp
+  8015b8:	c3                   	ret
+  8015b9:	83 ec 0c             	sub    $0xc,%esp
+  8015bc:	50                   	push   %eax
+  8015bd:	6a 1c                	push   $0x1c
+  8015bf:	68 cb 36 80 00       	push   $0x8036cb
+  8015c4:	6a 24                	push   $0x24
+  8015c6:	68 e8 36 80 00       	push   $0x8036e8
+  8015cb:	e8 8a ec ff ff       	call   80025a <_panic>
+
+008015d0 <sys_env_set_sched>:
+  8015d0:	55                   	push   %ebp
+  8015d1:	89 e5                	mov    %esp,%ebp
+  8015d3:	57                   	push   %edi
+  8015d4:	56                   	push   %esi
+  8015d5:	53                   	push   %ebx
+  8015d6:	83 ec 0c             	sub    $0xc,%esp
+  8015d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ec:	89 f7                	mov    %esi,%edi
+  8015ee:	cd 30                	int    $0x30
+  8015f0:	85 c0                	test   %eax,%eax
+  8015f2:	7f 08                	jg     8015fc <sys_env_set_sched+0x2c>
+  8015f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f7:	5b                   	pop    %ebx
+  8015f8:	5e                   	pop    %esi
+  8015f9:	5f                   	pop    %edi
+  8015fa:	5d                   	pop    %ebp
+  8015fb:	c3                   	ret
+  8015fc:	83 ec 0c             	sub    $0xc,%esp
+  8015ff:	50                   	push   %eax
+  801600:	6a 1d                	push   $0x1d
+  801602:	68 cb 36 80 00       	push   $0x8036cb
+  801607:	6a 24                	push   $0x24
+  801609:	68 e8 36 80 00       	push   $0x8036e8
+  80160e:	e8 47 ec ff ff       	call   80025a <_panic>
+
+00801613 <sys_batch>:
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	57                   	push   %edi
+  801617:	56                   	push   %esi
+  801618:	53                   	push   %ebx
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801621:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801624:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801629:	89 df                	mov    %ebx,%edi
+  80162b:	89 de                	mov    %ebx,%esi
+  80162d:	cd 30                	int    $0x30
+  80162f:	5b                   	pop    %ebx
+  801630:	5e                   	pop    %esi
+  801631:	5f                   	pop    %edi
+  801632:	5d                   	pop    %ebp
+  801633:	c3                   	ret
+
+00801634 <sys_env_stats>:
+  801634:	55                   	push   %ebp
+  801635:	89 e5                	mov    %esp,%ebp
+  801637:	57                   	push   %edi
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801642:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801645:	b8 23 00 00 00       	mov    $0x23,%eax
+  80164a:	89 df                	mov    %ebx,%edi
+  80164c:	89 de                	mov    %ebx,%esi
+  80164e:	cd 30                	int    $0x30
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5f                   	pop    %edi
+  801653:	5d                   	pop    %ebp
+  801654:	c3                   	ret
+
+00801655 <sys_trace>:
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	57                   	push   %edi
+  801659:	56                   	push   %esi
+  80165a:	53                   	push   %ebx
+  80165b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801660:	8b 55 08             	mov    0x8(%ebp),%edx
+  801663:	b8 24 00 00 00       	mov    $0x24,%eax
+  801668:	89 cb                	mov    %ecx,%ebx
+  80166a:	89 cf                	mov    %ecx,%edi
+  80166c:	89 ce                	mov    %ecx,%esi
+  80166e:	cd 30                	int    $0x30
+  801670:	5b                   	pop    %ebx
+  801671:	5e                   	pop    %esi
+  801672:	5f                   	pop    %edi
+  801673:	5d                   	pop    %ebp
+  801674:	c3                   	ret
+
+00801675 <sys_env_set_pager>:
+  801675:	55                   	push   %ebp
+  801676:	89 e5                	mov    %esp,%ebp
+  801678:	57                   	push   %edi
+  801679:	56                   	push   %esi
+  80167a:	53                   	push   %ebx
+  80167b:	83 ec 0c             	sub    $0xc,%esp
+  80167e:	be 00 00 00 00       	mov    $0x0,%esi
+  801683:	8b 55 08             	mov    0x8(%ebp),%edx
+  801686:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801689:	b8 25 00 00 00       	mov    $0x25,%eax
+  80168e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801691:	89 f7                	mov    %esi,%edi
+  801693:	cd 30                	int    $0x30
+  801695:	85 c0                	test   %eax,%eax
+  801697:	7f 08                	jg     8016a1 <sys_env_set_pager+0x2c>
+  801699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169c:	5b                   	pop    %ebx
+  80169d:	5e                   	pop    %esi
+  80169e:	5f                   	pop    %edi
+  80169f:	5d                   	pop    %ebp
+  8016a0:	c3                   	ret
+  8016a1:	83 ec 0c             	sub    $0xc,%esp
+  8016a4:	50                   	push   %eax
+  8016a5:	6a 25                	push   $0x25
+  8016a7:	68 cb 36 80 00       	push   $0x8036cb
+  8016ac:	6a 24                	push   $0x24
+  8016ae:	68 e8 36 80 00       	push   $0x8036e8
+  8016b3:	e8 a2 eb ff ff       	call   80025a <_panic>
+
+008016b8 <sys_pager_retire>:
+  8016b8:	55                   	push   %ebp
+  8016b9:	89 e5                	mov    %esp,%ebp
+  8016bb:	57                   	push   %edi
+  8016bc:	56                   	push   %esi
+  8016bd:	53                   	push   %ebx
+  8016be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c6:	b8 28 00 00 00       	mov    $0x28,%eax
+  8016cb:	89 cb                	mov    %ecx,%ebx
+  8016cd:	89 cf                	mov    %ecx,%edi
+  8016cf:	89 ce                	mov    %ecx,%esi
+  8016d1:	cd 30                	int    $0x30
+  8016d3:	5b                   	pop    %ebx
+  8016d4:	5e                   	pop    %esi
+  8016d5:	5f                   	pop    %edi
+  8016d6:	5d                   	pop    %ebp
+  8016d7:	c3                   	ret
+
+008016d8 <sys_prof>:
+  8016d8:	55                   	push   %ebp
+  8016d9:	89 e5                	mov    %esp,%ebp
+  8016db:	57                   	push   %edi
+  8016dc:	56                   	push   %esi
+  8016dd:	53                   	push   %ebx
+  8016de:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e9:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f1:	89 f7                	mov    %esi,%edi
+  8016f3:	cd 30                	int    $0x30
+  8016f5:	5b                   	pop    %ebx
+  8016f6:	5e                   	pop    %esi
+  8016f7:	5f                   	pop    %edi
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+
+008016fa <fd2num>:
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801700:	05 00 00 00 30       	add    $0x30000000,%eax
+  801705:	c1 e8 0c             	shr    $0xc,%eax
+  801708:	5d                   	pop    %ebp
+  801709:	c3                   	ret
+
+0080170a <fd2data>:
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801710:	05 00 00 00 30       	add    $0x30000000,%eax
+  801715:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80171a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  80171f:	5d                   	pop    %ebp
+  801720:	c3                   	ret
+
+00801721 <fd_alloc>:
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801729:	89 c2                	mov    %eax,%edx
+  80172b:	c1 ea 16             	shr    $0x16,%edx
+  80172e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801735:	f6 c2 01             	test   $0x1,%dl
+  801738:	74 29                	je     801763 <fd_alloc+0x42>
+  80173a:	89 c2                	mov    %eax,%edx
+  80173c:	c1 ea 0c             	shr    $0xc,%edx
+  80173f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801746:	f6 c2 01             	test   $0x1,%dl
+  801749:	74 18                	je     801763 <fd_alloc+0x42>
+  80174b:	05 00 10 00 00       	add    $0x1000,%eax
+  801750:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801755:	75 d2                	jne    801729 <fd_alloc+0x8>
+  801757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801761:	eb 05                	jmp    801768 <fd_alloc+0x47>
+  801763:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801768:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176b:	89 02                	mov    %eax,(%edx)
+  80176d:	89 c8                	mov    %ecx,%eax
+  80176f:	5d                   	pop    %ebp
+  801770:	c3                   	ret
+
+00801771 <fd_lookup>:
+  801771:	55                   	push   %ebp
+  801772:	89 e5                	mov    %esp,%ebp
+  801774:	8b 45 08             	mov    0x8(%ebp),%eax
+  801777:	83 f8 1f             	cmp    $0x1f,%eax
+  80177a:	77 30                	ja     8017ac <fd_lookup+0x3b>
+  80177c:	c1 e0 0c             	shl    $0xc,%eax
+  80177f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801784:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80178a:	f6 c2 01             	test   $0x1,%dl
+  80178d:	74 24                	je     8017b3 <fd_lookup+0x42>
+  80178f:	89 c2                	mov    %eax,%edx
+  801791:	c1 ea 0c             	shr    $0xc,%edx
+  801794:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80179b:	f6 c2 01             	test   $0x1,%dl
+  80179e:	74 1a                	je     8017ba <fd_lookup+0x49>
+  8017a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017a3:	89 02                	mov    %eax,(%edx)
+  8017a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017aa:	5d                   	pop    %ebp
+  8017ab:	c3                   	ret
+  8017ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b1:	eb f7                	jmp    8017aa <fd_lookup+0x39>
+  8017b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b8:	eb f0                	jmp    8017aa <fd_lookup+0x39>
+  8017ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017bf:	eb e9                	jmp    8017aa <fd_lookup+0x39>
+
+008017c1 <dev_lookup>:
+  8017c1:	55                   	push   %ebp
+  8017c2:	89 e5                	mov    %esp,%ebp
+  8017c4:	53                   	push   %ebx
+  8017c5:	83 ec 04             	sub    $0x4,%esp
+  8017c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d0:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8017d5:	39 13                	cmp    %edx,(%ebx)
+  8017d7:	74 37                	je     801810 <dev_lookup+0x4f>
+  8017d9:	83 c0 01             	add    $0x1,%eax
+  8017dc:	8b 1c 85 74 37 80 00 	mov    0x803774(,%eax,4),%ebx
+  8017e3:	85 db                	test   %ebx,%ebx
+  8017e5:	75 ee                	jne    8017d5 <dev_lookup+0x14>
+  8017e7:	a1 10 50 80 00       	mov    0x805010,%eax
+  8017ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8017ef:	83 ec 04             	sub    $0x4,%esp
+  8017f2:	52                   	push   %edx
+  8017f3:	50                   	push   %eax
+  8017f4:	68 f8 36 80 00       	push   $0x8036f8
+  8017f9:	e8 37 eb ff ff       	call   800335 <cprintf>
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801806:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801809:	89 1a                	mov    %ebx,(%edx)
+  80180b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80180e:	c9                   	leave
+  80180f:	c3                   	ret
+  801810:	b8 00 00 00 00       	mov    $0x0,%eax
+  801815:	eb ef                	jmp    801806 <dev_lookup+0x45>
+
+00801817 <fd_close>:
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	57                   	push   %edi
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+  80181d:	83 ec 24             	sub    $0x24,%esp
+  801820:	8b 75 08             	mov    0x8(%ebp),%esi
+  801823:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801826:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801829:	50                   	push   %eax
+  80182a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801830:	c1 e8 0c             	shr    $0xc,%eax
+  801833:	50                   	push   %eax
+  801834:	e8 38 ff ff ff       	call   801771 <fd_lookup>
+  801839:	89 c3                	mov    %eax,%ebx
+  80183b:	83 c4 10             	add    $0x10,%esp
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	78 05                	js     801847 <fd_close+0x30>
+  801842:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801845:	74 0f                	je     801856 <fd_close+0x3f>
+  801847:	85 ff                	test   %edi,%edi
+  801849:	0f 44 df             	cmove  %edi,%ebx
+  80184c:	89 d8                	mov    %ebx,%eax
+  80184e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801851:	5b                   	pop    %ebx
+  801852:	5e                   	pop    %esi
+  801853:	5f                   	pop    %edi
+  801854:	5d                   	pop    %ebp
+  801855:	c3                   	ret
+  801856:	83 ec 08             	sub    $0x8,%esp
+  801859:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80185c:	50                   	push   %eax
+  80185d:	ff 36                	push   (%esi)
+  80185f:	e8 5d ff ff ff       	call   8017c1 <dev_lookup>
+  801864:	89 c3                	mov    %eax,%ebx
+  801866:	83 c4 10             	add    $0x10,%esp
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	78 1a                	js     801887 <fd_close+0x70>
+  80186d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801870:	8b 40 10             	mov    0x10(%eax),%eax
+  801873:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	74 0b                	je     801887 <fd_close+0x70>
+  80187c:	83 ec 0c             	sub    $0xc,%esp
+  80187f:	56                   	push   %esi
+  801880:	ff d0                	call   *%eax
+  801882:	89 c3                	mov    %eax,%ebx
+  801884:	83 c4 10             	add    $0x10,%esp
+  801887:	83 ec 08             	sub    $0x8,%esp
+  80188a:	56                   	push   %esi
+  80188b:	6a 00                	push   $0x0
+  80188d:	e8 cc f6 ff ff       	call   800f5e <sys_page_unmap>
+  801892:	83 c4 10             	add    $0x10,%esp
+  801895:	eb b5                	jmp    80184c <fd_close+0x35>
+
+00801897 <close>:
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	83 ec 20             	sub    $0x20,%esp
+  80189d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a0:	50                   	push   %eax
+  8018a1:	ff 75 08             	push   0x8(%ebp)
+  8018a4:	e8 c8 fe ff ff       	call   801771 <fd_lookup>
+  8018a9:	83 c4 10             	add    $0x10,%esp
+  8018ac:	85 c0                	test   %eax,%eax
+  8018ae:	79 02                	jns    8018b2 <close+0x1b>
+  8018b0:	c9                   	leave
+  8018b1:	c3                   	ret
+  8018b2:	83 ec 08             	sub    $0x8,%esp
+  8018b5:	6a 01                	push   $0x1
+  8018b7:	ff 75 f4             	push   -0xc(%ebp)
+  8018ba:	e8 58 ff ff ff       	call   801817 <fd_close>
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	eb ec                	jmp    8018b0 <close+0x19>
+
+008018c4 <close_all>:
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	53                   	push   %ebx
+  8018c8:	83 ec 04             	sub    $0x4,%esp
+  8018cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d0:	83 ec 0c             	sub    $0xc,%esp
+  8018d3:	53                   	push   %ebx
+  8018d4:	e8 be ff ff ff       	call   801897 <close>
+  8018d9:	83 c3 01             	add    $0x1,%ebx
+  8018dc:	83 c4 10             	add    $0x10,%esp
+  8018df:	83 fb 20             	cmp    $0x20,%ebx
+  8018e2:	75 ec                	jne    8018d0 <close_all+0xc>
+  8018e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e7:	c9                   	leave
+  8018e8:	c3                   	ret
+
+008018e9 <dup>:
+  8018e9:	55                   	push   %ebp
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	57                   	push   %edi
+  8018ed:	56                   	push   %esi
+  8018ee:	53                   	push   %ebx
+  8018ef:	83 ec 34             	sub    $0x34,%esp
+  8018f2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018f5:	50                   	push   %eax
+  8018f6:	ff 75 08             	push   0x8(%ebp)
+  8018f9:	e8 73 fe ff ff       	call   801771 <fd_lookup>
+  8018fe:	89 c3                	mov    %eax,%ebx
+  801900:	83 c4 10             	add    $0x10,%esp
+  801903:	85 c0                	test   %eax,%eax
+  801905:	78 7f                	js     801986 <dup+0x9d>
+  801907:	83 ec 0c             	sub    $0xc,%esp
+  80190a:	ff 75 0c             	push   0xc(%ebp)
+  80190d:	e8 85 ff ff ff       	call   801897 <close>
+  801912:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801915:	c1 e6 0c             	shl    $0xc,%esi
+  801918:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80191e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801921:	89 3c 24             	mov    %edi,(%esp)
+  801924:	e8 e1 fd ff ff       	call   80170a <fd2data>
+  801929:	89 c3                	mov    %eax,%ebx
+  80192b:	89 34 24             	mov    %esi,(%esp)
+  80192e:	e8 d7 fd ff ff       	call   80170a <fd2data>
+  801933:	83 c4 10             	add    $0x10,%esp
+  801936:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801939:	89 d8                	mov    %ebx,%eax
+  80193b:	c1 e8 16             	shr    $0x16,%eax
+  80193e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801945:	a8 01                	test   $0x1,%al
+  801947:	74 11                	je     80195a <dup+0x71>
+  801949:	89 d8                	mov    %ebx,%eax
+  80194b:	c1 e8 0c             	shr    $0xc,%eax
+  80194e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801955:	f6 c2 01             	test   $0x1,%dl
+  801958:	75 36                	jne    801990 <dup+0xa7>
+  80195a:	89 f8                	mov    %edi,%eax
+  80195c:	c1 e8 0c             	shr    $0xc,%eax
+  80195f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801966:	83 ec 0c             	sub    $0xc,%esp
+  801969:	25 07 0e 00 00       	and    $0xe07,%eax
+  80196e:	50                   	push   %eax
+  80196f:	56                   	push   %esi
+  801970:	6a 00                	push   $0x0
+  801972:	57                   	push   %edi
+  801973:	6a 00                	push   $0x0
+  801975:	e8 55 f5 ff ff       	call   800ecf <sys_page_map>
+  80197a:	89 c3                	mov    %eax,%ebx
+  80197c:	83 c4 20             	add    $0x20,%esp
+  80197f:	85 c0                	test   %eax,%eax
+  801981:	78 33                	js     8019b6 <dup+0xcd>
+  801983:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801986:	89 d8                	mov    %ebx,%eax
+  801988:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198b:	5b                   	pop    %ebx
+  80198c:	5e                   	pop    %esi
+  80198d:	5f                   	pop    %edi
+  80198e:	5d                   	pop    %ebp
+  80198f:	c3                   	ret
+  801990:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801997:	83 ec 0c             	sub    $0xc,%esp
+  80199a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80199f:	50                   	push   %eax
+  8019a0:	ff 75 d4             	push   -0x2c(%ebp)
+  8019a3:	6a 00                	push   $0x0
+  8019a5:	53                   	push   %ebx
+  8019a6:	6a 00                	push   $0x0
+  8019a8:	e8 22 f5 ff ff       	call   800ecf <sys_page_map>
+  8019ad:	89 c3                	mov    %eax,%ebx
+  8019af:	83 c4 20             	add    $0x20,%esp
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	79 a4                	jns    80195a <dup+0x71>
+  8019b6:	83 ec 08             	sub    $0x8,%esp
+  8019b9:	56                   	push   %esi
+  8019ba:	6a 00                	push   $0x0
+  8019bc:	e8 9d f5 ff ff       	call   800f5e <sys_page_unmap>
+  8019c1:	83 c4 08             	add    $0x8,%esp
+  8019c4:	ff 75 d4             	push   -0x2c(%ebp)
+  8019c7:	6a 00                	push   $0x0
+  8019c9:	e8 90 f5 ff ff       	call   800f5e <sys_page_unmap>
+  8019ce:	83 c4 10             	add    $0x10,%esp
+  8019d1:	eb b3                	jmp    801986 <dup+0x9d>
+
+008019d3 <read>:
+  8019d3:	55                   	push   %ebp
+  8019d4:	89 e5                	mov    %esp,%ebp
+  8019d6:	56                   	push   %esi
+  8019d7:	53                   	push   %ebx
+  8019d8:	83 ec 18             	sub    $0x18,%esp
+  8019db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019e1:	50                   	push   %eax
+  8019e2:	56                   	push   %esi
+  8019e3:	e8 89 fd ff ff       	call   801771 <fd_lookup>
+  8019e8:	83 c4 10             	add    $0x10,%esp
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	78 3c                	js     801a2b <read+0x58>
+  8019ef:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019f2:	83 ec 08             	sub    $0x8,%esp
+  8019f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f8:	50                   	push   %eax
+  8019f9:	ff 33                	push   (%ebx)
+  8019fb:	e8 c1 fd ff ff       	call   8017c1 <dev_lookup>
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	85 c0                	test   %eax,%eax
+  801a05:	78 24                	js     801a2b <read+0x58>
+  801a07:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a0a:	83 e0 03             	and    $0x3,%eax
+  801a0d:	83 f8 01             	cmp    $0x1,%eax
+  801a10:	74 20                	je     801a32 <read+0x5f>
+  801a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a15:	8b 40 08             	mov    0x8(%eax),%eax
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	74 37                	je     801a53 <read+0x80>
+  801a1c:	83 ec 04             	sub    $0x4,%esp
+  801a1f:	ff 75 10             	push   0x10(%ebp)
+  801a22:	ff 75 0c             	push   0xc(%ebp)
+  801a25:	53                   	push   %ebx
+  801a26:	ff d0                	call   *%eax
+  801a28:	83 c4 10             	add    $0x10,%esp
+  801a2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a2e:	5b                   	pop    %ebx
+  801a2f:	5e                   	pop    %esi
+  801a30:	5d                   	pop    %ebp
+  801a31:	c3                   	ret
+  801a32:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a37:	8b 40 48             	mov    0x48(%eax),%eax
+  801a3a:	83 ec 04             	sub    $0x4,%esp
+  801a3d:	56                   	push   %esi
+  801a3e:	50                   	push   %eax
+  801a3f:	68 39 37 80 00       	push   $0x803739
+  801a44:	e8 ec e8 ff ff       	call   800335 <cprintf>
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a51:	eb d8                	jmp    801a2b <read+0x58>
+  801a53:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a58:	eb d1                	jmp    801a2b <read+0x58>
+
+00801a5a <readn>:
+  801a5a:	55                   	push   %ebp
+  801a5b:	89 e5                	mov    %esp,%ebp
+  801a5d:	57                   	push   %edi
+  801a5e:	56                   	push   %esi
+  801a5f:	53                   	push   %ebx
+  801a60:	83 ec 0c             	sub    $0xc,%esp
+  801a63:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a66:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a69:	85 f6                	test   %esi,%esi
+  801a6b:	74 30                	je     801a9d <readn+0x43>
+  801a6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a77:	83 ec 04             	sub    $0x4,%esp
+  801a7a:	89 f2                	mov    %esi,%edx
+  801a7c:	29 c2                	sub    %eax,%edx
+  801a7e:	52                   	push   %edx
+  801a7f:	01 f8                	add    %edi,%eax
+  801a81:	50                   	push   %eax
+  801a82:	ff 75 08             	push   0x8(%ebp)
+  801a85:	e8 49 ff ff ff       	call   8019d3 <read>
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 15                	js     801aa6 <readn+0x4c>
+  801a91:	74 11                	je     801aa4 <readn+0x4a>
+  801a93:	01 c3                	add    %eax,%ebx
+  801a95:	89 d8                	mov    %ebx,%eax
+  801a97:	39 f3                	cmp    %esi,%ebx
+  801a99:	72 dc                	jb     801a77 <readn+0x1d>
+  801a9b:	eb 09                	jmp    801aa6 <readn+0x4c>
+  801a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa2:	eb 02                	jmp    801aa6 <readn+0x4c>
+  801aa4:	89 d8                	mov    %ebx,%eax
+  801aa6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa9:	5b                   	pop    %ebx
+  801aaa:	5e                   	pop    %esi
+  801aab:	5f                   	pop    %edi
+  801aac:	5d                   	pop    %ebp
+  801aad:	c3                   	ret
+
+00801aae <write>:
+  801aae:	55                   	push   %ebp
+  801aaf:	89 e5                	mov    %esp,%ebp
+  801ab1:	56                   	push   %esi
+  801ab2:	53                   	push   %ebx
+  801ab3:	83 ec 18             	sub    $0x18,%esp
+  801ab6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ab9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abc:	50                   	push   %eax
+  801abd:	53                   	push   %ebx
+  801abe:	e8 ae fc ff ff       	call   801771 <fd_lookup>
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	78 37                	js     801b01 <write+0x53>
+  801aca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801acd:	83 ec 08             	sub    $0x8,%esp
+  801ad0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad3:	50                   	push   %eax
+  801ad4:	ff 36                	push   (%esi)
+  801ad6:	e8 e6 fc ff ff       	call   8017c1 <dev_lookup>
+  801adb:	83 c4 10             	add    $0x10,%esp
+  801ade:	85 c0                	test   %eax,%eax
+  801ae0:	78 1f                	js     801b01 <write+0x53>
+  801ae2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ae6:	74 20                	je     801b08 <write+0x5a>
+  801ae8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aeb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	74 37                	je     801b29 <write+0x7b>
+  801af2:	83 ec 04             	sub    $0x4,%esp
+  801af5:	ff 75 10             	push   0x10(%ebp)
+  801af8:	ff 75 0c             	push   0xc(%ebp)
+  801afb:	56                   	push   %esi
+  801afc:	ff d0                	call   *%eax
+  801afe:	83 c4 10             	add    $0x10,%esp
+  801b01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b04:	5b                   	pop    %ebx
+  801b05:	5e                   	pop    %esi
+  801b06:	5d                   	pop    %ebp
+  801b07:	c3                   	ret
+  801b08:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b0d:	8b 40 48             	mov    0x48(%eax),%eax
+  801b10:	83 ec 04             	sub    $0x4,%esp
+  801b13:	53                   	push   %ebx
+  801b14:	50                   	push   %eax
+  801b15:	68 55 37 80 00       	push   $0x803755
+  801b1a:	e8 16 e8 ff ff       	call   800335 <cprintf>
+  801b1f:	83 c4 10             	add    $0x10,%esp
+  801b22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b27:	eb d8                	jmp    801b01 <write+0x53>
+  801b29:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b2e:	eb d1                	jmp    801b01 <write+0x53>
+
+00801b30 <seek>:
+  801b30:	55                   	push   %ebp
+  801b31:	89 e5                	mov    %esp,%ebp
+  801b33:	83 ec 20             	sub    $0x20,%esp
+  801b36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b39:	50                   	push   %eax
+  801b3a:	ff 75 08             	push   0x8(%ebp)
+  801b3d:	e8 2f fc ff ff       	call   801771 <fd_lookup>
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	78 0e                	js     801b57 <seek+0x27>
+  801b49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b4f:	89 50 04             	mov    %edx,0x4(%eax)
+  801b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b57:	c9                   	leave
+  801b58:	c3                   	ret
+
+00801b59 <ftruncate>:
+  801b59:	55                   	push   %ebp
+  801b5a:	89 e5                	mov    %esp,%ebp
+  801b5c:	56                   	push   %esi
+  801b5d:	53                   	push   %ebx
+  801b5e:	83 ec 18             	sub    $0x18,%esp
+  801b61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b67:	50                   	push   %eax
+  801b68:	53                   	push   %ebx
+  801b69:	e8 03 fc ff ff       	call   801771 <fd_lookup>
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	78 34                	js     801ba9 <ftruncate+0x50>
+  801b75:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b78:	83 ec 08             	sub    $0x8,%esp
+  801b7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b7e:	50                   	push   %eax
+  801b7f:	ff 36                	push   (%esi)
+  801b81:	e8 3b fc ff ff       	call   8017c1 <dev_lookup>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 1c                	js     801ba9 <ftruncate+0x50>
+  801b8d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b91:	74 1d                	je     801bb0 <ftruncate+0x57>
+  801b93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b96:	8b 40 18             	mov    0x18(%eax),%eax
+  801b99:	85 c0                	test   %eax,%eax
+  801b9b:	74 34                	je     801bd1 <ftruncate+0x78>
+  801b9d:	83 ec 08             	sub    $0x8,%esp
+  801ba0:	ff 75 0c             	push   0xc(%ebp)
+  801ba3:	56                   	push   %esi
+  801ba4:	ff d0                	call   *%eax
+  801ba6:	83 c4 10             	add    $0x10,%esp
+  801ba9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bac:	5b                   	pop    %ebx
+  801bad:	5e                   	pop    %esi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+  801bb0:	a1 10 50 80 00       	mov    0x805010,%eax
+  801bb5:	8b 40 48             	mov    0x48(%eax),%eax
+  801bb8:	83 ec 04             	sub    $0x4,%esp
+  801bbb:	53                   	push   %ebx
+  801bbc:	50                   	push   %eax
+  801bbd:	68 18 37 80 00       	push   $0x803718
+  801bc2:	e8 6e e7 ff ff       	call   800335 <cprintf>
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bcf:	eb d8                	jmp    801ba9 <ftruncate+0x50>
+  801bd1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd6:	eb d1                	jmp    801ba9 <ftruncate+0x50>
+
+00801bd8 <fstat>:
+  801bd8:	55                   	push   %ebp
+  801bd9:	89 e5                	mov    %esp,%ebp
+  801bdb:	56                   	push   %esi
+  801bdc:	53                   	push   %ebx
+  801bdd:	83 ec 18             	sub    $0x18,%esp
+  801be0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801be3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801be6:	50                   	push   %eax
+  801be7:	ff 75 08             	push   0x8(%ebp)
+  801bea:	e8 82 fb ff ff       	call   801771 <fd_lookup>
+  801bef:	83 c4 10             	add    $0x10,%esp
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 49                	js     801c3f <fstat+0x67>
+  801bf6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bf9:	83 ec 08             	sub    $0x8,%esp
+  801bfc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bff:	50                   	push   %eax
+  801c00:	ff 36                	push   (%esi)
+  801c02:	e8 ba fb ff ff       	call   8017c1 <dev_lookup>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 31                	js     801c3f <fstat+0x67>
+  801c0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c11:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c15:	74 2f                	je     801c46 <fstat+0x6e>
+  801c17:	c6 03 00             	movb   $0x0,(%ebx)
+  801c1a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c21:	00 00 00 
+  801c24:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c2b:	00 00 00 
+  801c2e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801c34:	83 ec 08             	sub    $0x8,%esp
+  801c37:	53                   	push   %ebx
+  801c38:	56                   	push   %esi
+  801c39:	ff 50 14             	call   *0x14(%eax)
+  801c3c:	83 c4 10             	add    $0x10,%esp
+  801c3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c42:	5b                   	pop    %ebx
+  801c43:	5e                   	pop    %esi
+  801c44:	5d                   	pop    %ebp
+  801c45:	c3                   	ret
+  801c46:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c4b:	eb f2                	jmp    801c3f <fstat+0x67>
+
+00801c4d <stat>:
+  801c4d:	55                   	push   %ebp
+  801c4e:	89 e5                	mov    %esp,%ebp
+  801c50:	56                   	push   %esi
+  801c51:	53                   	push   %ebx
+  801c52:	83 ec 08             	sub    $0x8,%esp
+  801c55:	6a 00                	push   $0x0
+  801c57:	ff 75 08             	push   0x8(%ebp)
+  801c5a:	e8 31 05 00 00       	call   802190 <open>
+  801c5f:	89 c3                	mov    %eax,%ebx
+  801c61:	83 c4 10             	add    $0x10,%esp
+  801c64:	85 c0                	test   %eax,%eax
+  801c66:	78 1b                	js     801c83 <stat+0x36>
+  801c68:	83 ec 08             	sub    $0x8,%esp
+  801c6b:	ff 75 0c             	push   0xc(%ebp)
+  801c6e:	50                   	push   %eax
+  801c6f:	e8 64 ff ff ff       	call   801bd8 <fstat>
+  801c74:	89 c6                	mov    %eax,%esi
+  801c76:	89 1c 24             	mov    %ebx,(%esp)
+  801c79:	e8 19 fc ff ff       	call   801897 <close>
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	89 f3                	mov    %esi,%ebx
+  801c83:	89 d8                	mov    %ebx,%eax
+  801c85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c88:	5b                   	pop    %ebx
+  801c89:	5e                   	pop    %esi
+  801c8a:	5d                   	pop    %ebp
+  801c8b:	c3                   	ret
+
+00801c8c <fsipc>:
+  801c8c:	55                   	push   %ebp
+  801c8d:	89 e5                	mov    %esp,%ebp
+  801c8f:	56                   	push   %esi
+  801c90:	53                   	push   %ebx
+  801c91:	89 c3                	mov    %eax,%ebx
+  801c93:	89 d6                	mov    %edx,%esi
+  801c95:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c9c:	74 20                	je     801cbe <fsipc+0x32>
+  801c9e:	83 ec 08             	sub    $0x8,%esp
+  801ca1:	6a 00                	push   $0x0
+  801ca3:	56                   	push   %esi
+  801ca4:	6a 07                	push   $0x7
+  801ca6:	68 00 60 80 00       	push   $0x806000
+  801cab:	53                   	push   %ebx
+  801cac:	ff 35 08 50 80 00    	push   0x805008
+  801cb2:	e8 5a 12 00 00       	call   802f11 <ipc_call>
+  801cb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cba:	5b                   	pop    %ebx
+  801cbb:	5e                   	pop    %esi
+  801cbc:	5d                   	pop    %ebp
+  801cbd:	c3                   	ret
+  801cbe:	83 ec 0c             	sub    $0xc,%esp
+  801cc1:	6a 02                	push   $0x2
+  801cc3:	e8 e4 13 00 00       	call   8030ac <ipc_find_env>
+  801cc8:	a3 08 50 80 00       	mov    %eax,0x805008
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  801cd0:	eb cc                	jmp    801c9e <fsipc+0x12>
+
+00801cd2 <devfile_trunc>:
+  801cd2:	55                   	push   %ebp
+  801cd3:	89 e5                	mov    %esp,%ebp
+  801cd5:	83 ec 08             	sub    $0x8,%esp
+  801cd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cdb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cde:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ce3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ce6:	a3 04 60 80 00       	mov    %eax,0x806004
+  801ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf0:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cf5:	e8 92 ff ff ff       	call   801c8c <fsipc>
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+
+00801cfc <devfile_flush>:
+  801cfc:	55                   	push   %ebp
+  801cfd:	89 e5                	mov    %esp,%ebp
+  801cff:	83 ec 08             	sub    $0x8,%esp
+  801d02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d05:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d08:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d12:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d17:	e8 70 ff ff ff       	call   801c8c <fsipc>
+  801d1c:	c9                   	leave
+  801d1d:	c3                   	ret
+
+00801d1e <devfile_stat>:
+  801d1e:	55                   	push   %ebp
+  801d1f:	89 e5                	mov    %esp,%ebp
+  801d21:	53                   	push   %ebx
+  801d22:	83 ec 04             	sub    $0x4,%esp
+  801d25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d2e:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d38:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d3d:	e8 4a ff ff ff       	call   801c8c <fsipc>
+  801d42:	85 c0                	test   %eax,%eax
+  801d44:	78 2c                	js     801d72 <devfile_stat+0x54>
+  801d46:	83 ec 08             	sub    $0x8,%esp
+  801d49:	68 00 60 80 00       	push   $0x806000
+  801d4e:	53                   	push   %ebx
+  801d4f:	e8 d8 ec ff ff       	call   800a2c <strcpy>
+  801d54:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d59:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801d5f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d64:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d75:	c9                   	leave
+  801d76:	c3                   	ret
+
+00801d77 <fsring_rw>:
+  801d77:	55                   	push   %ebp
+  801d78:	89 e5                	mov    %esp,%ebp
+  801d7a:	57                   	push   %edi
+  801d7b:	56                   	push   %esi
+  801d7c:	53                   	push   %ebx
+  801d7d:	83 ec 2c             	sub    $0x2c,%esp
+  801d80:	89 c7                	mov    %eax,%edi
+  801d82:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d85:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801d88:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d8d:	a8 01                	test   $0x1,%al
+  801d8f:	74 0d                	je     801d9e <fsring_rw+0x27>
+  801d91:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d96:	a8 01                	test   $0x1,%al
+  801d98:	0f 85 d5 00 00 00    	jne    801e73 <fsring_rw+0xfc>
+  801d9e:	a1 10 50 80 00       	mov    0x805010,%eax
+  801da3:	8b 40 48             	mov    0x48(%eax),%eax
+  801da6:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801dac:	0f 84 fc 00 00 00    	je     801eae <fsring_rw+0x137>
+  801db2:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801db9:	0f 84 02 01 00 00    	je     801ec1 <fsring_rw+0x14a>
+  801dbf:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dc4:	83 ec 04             	sub    $0x4,%esp
+  801dc7:	68 07 02 00 00       	push   $0x207
+  801dcc:	53                   	push   %ebx
+  801dcd:	6a 00                	push   $0x0
+  801dcf:	e8 b8 f0 ff ff       	call   800e8c <sys_page_alloc>
+  801dd4:	83 c4 10             	add    $0x10,%esp
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	0f 88 f9 00 00 00    	js     801ed8 <fsring_rw+0x161>
+  801ddf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801de5:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801deb:	75 d7                	jne    801dc4 <fsring_rw+0x4d>
+  801ded:	6a 0e                	push   $0xe
+  801def:	6a 0d                	push   $0xd
+  801df1:	ff 35 08 50 80 00    	push   0x805008
+  801df7:	68 00 00 f0 cf       	push   $0xcff00000
+  801dfc:	e8 c4 0c 00 00       	call   802ac5 <ipcring_init>
+  801e01:	83 c4 08             	add    $0x8,%esp
+  801e04:	6a 00                	push   $0x0
+  801e06:	6a 00                	push   $0x0
+  801e08:	68 07 02 00 00       	push   $0x207
+  801e0d:	68 00 00 f0 cf       	push   $0xcff00000
+  801e12:	6a 0b                	push   $0xb
+  801e14:	ff 35 08 50 80 00    	push   0x805008
+  801e1a:	e8 f2 10 00 00       	call   802f11 <ipc_call>
+  801e1f:	89 c6                	mov    %eax,%esi
+  801e21:	83 c4 20             	add    $0x20,%esp
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	0f 88 ac 00 00 00    	js     801ed8 <fsring_rw+0x161>
+  801e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e31:	89 d9                	mov    %ebx,%ecx
+  801e33:	83 c3 01             	add    $0x1,%ebx
+  801e36:	89 da                	mov    %ebx,%edx
+  801e38:	c1 e2 0c             	shl    $0xc,%edx
+  801e3b:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801e41:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801e47:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801e4d:	83 ec 08             	sub    $0x8,%esp
+  801e50:	6a 00                	push   $0x0
+  801e52:	6a 00                	push   $0x0
+  801e54:	68 07 02 00 00       	push   $0x207
+  801e59:	50                   	push   %eax
+  801e5a:	6a 0c                	push   $0xc
+  801e5c:	ff 35 08 50 80 00    	push   0x805008
+  801e62:	e8 aa 10 00 00       	call   802f11 <ipc_call>
+  801e67:	83 c4 20             	add    $0x20,%esp
+  801e6a:	85 c0                	test   %eax,%eax
+  801e6c:	78 6a                	js     801ed8 <fsring_rw+0x161>
+  801e6e:	83 fb 08             	cmp    $0x8,%ebx
+  801e71:	75 be                	jne    801e31 <fsring_rw+0xba>
+  801e73:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e77:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801e7c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801e81:	0f 45 c2             	cmovne %edx,%eax
+  801e84:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e87:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e8e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e95:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ea6:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801ea9:	e9 4b 01 00 00       	jmp    801ff9 <fsring_rw+0x282>
+  801eae:	e8 a3 f3 ff ff       	call   801256 <sys_time_msec>
+  801eb3:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801eb9:	0f 89 f3 fe ff ff    	jns    801db2 <fsring_rw+0x3b>
+  801ebf:	eb 54                	jmp    801f15 <fsring_rw+0x19e>
+  801ec1:	83 ec 0c             	sub    $0xc,%esp
+  801ec4:	6a 02                	push   $0x2
+  801ec6:	e8 e1 11 00 00       	call   8030ac <ipc_find_env>
+  801ecb:	a3 08 50 80 00       	mov    %eax,0x805008
+  801ed0:	83 c4 10             	add    $0x10,%esp
+  801ed3:	e9 e7 fe ff ff       	jmp    801dbf <fsring_rw+0x48>
+  801ed8:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801edd:	83 ec 08             	sub    $0x8,%esp
+  801ee0:	53                   	push   %ebx
+  801ee1:	6a 00                	push   $0x0
+  801ee3:	e8 76 f0 ff ff       	call   800f5e <sys_page_unmap>
+  801ee8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801eee:	83 c4 10             	add    $0x10,%esp
+  801ef1:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ef7:	75 e4                	jne    801edd <fsring_rw+0x166>
+  801ef9:	e8 58 f3 ff ff       	call   801256 <sys_time_msec>
+  801efe:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801f03:	a3 00 50 80 00       	mov    %eax,0x805000
+  801f08:	a1 10 50 80 00       	mov    0x805010,%eax
+  801f0d:	8b 40 48             	mov    0x48(%eax),%eax
+  801f10:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f15:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801f1c:	e9 7a 01 00 00       	jmp    80209b <fsring_rw+0x324>
+  801f21:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f24:	89 10                	mov    %edx,(%eax)
+  801f26:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f29:	89 f2                	mov    %esi,%edx
+  801f2b:	03 57 04             	add    0x4(%edi),%edx
+  801f2e:	89 50 08             	mov    %edx,0x8(%eax)
+  801f31:	83 ec 04             	sub    $0x4,%esp
+  801f34:	53                   	push   %ebx
+  801f35:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801f38:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801f3b:	52                   	push   %edx
+  801f3c:	83 c0 0c             	add    $0xc,%eax
+  801f3f:	50                   	push   %eax
+  801f40:	e8 97 ec ff ff       	call   800bdc <memmove>
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f4b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f4e:	89 08                	mov    %ecx,(%eax)
+  801f50:	83 ec 0c             	sub    $0xc,%esp
+  801f53:	68 00 00 f0 cf       	push   $0xcff00000
+  801f58:	e8 c6 0b 00 00       	call   802b23 <ipcring_req_push>
+  801f5d:	01 de                	add    %ebx,%esi
+  801f5f:	83 c4 10             	add    $0x10,%esp
+  801f62:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f65:	73 4c                	jae    801fb3 <fsring_rw+0x23c>
+  801f67:	83 ec 0c             	sub    $0xc,%esp
+  801f6a:	68 00 00 f0 cf       	push   $0xcff00000
+  801f6f:	e8 89 0b 00 00       	call   802afd <ipcring_req_slot>
+  801f74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f77:	83 c4 10             	add    $0x10,%esp
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	74 35                	je     801fb3 <fsring_rw+0x23c>
+  801f7e:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f83:	83 e0 07             	and    $0x7,%eax
+  801f86:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f8b:	c1 e0 0c             	shl    $0xc,%eax
+  801f8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f91:	29 f3                	sub    %esi,%ebx
+  801f93:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f96:	39 cb                	cmp    %ecx,%ebx
+  801f98:	0f 47 d9             	cmova  %ecx,%ebx
+  801f9b:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f9f:	75 80                	jne    801f21 <fsring_rw+0x1aa>
+  801fa1:	8b 57 0c             	mov    0xc(%edi),%edx
+  801fa4:	89 10                	mov    %edx,(%eax)
+  801fa6:	89 58 04             	mov    %ebx,0x4(%eax)
+  801fa9:	89 f2                	mov    %esi,%edx
+  801fab:	03 57 04             	add    0x4(%edi),%edx
+  801fae:	89 50 08             	mov    %edx,0x8(%eax)
+  801fb1:	eb 95                	jmp    801f48 <fsring_rw+0x1d1>
+  801fb3:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801fb8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fbb:	83 ec 0c             	sub    $0xc,%esp
+  801fbe:	68 00 00 f0 cf       	push   $0xcff00000
+  801fc3:	e8 94 0b 00 00       	call   802b5c <ipcring_rsp_wait>
+  801fc8:	8b 58 04             	mov    0x4(%eax),%ebx
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801fd2:	75 45                	jne    802019 <fsring_rw+0x2a2>
+  801fd4:	85 db                	test   %ebx,%ebx
+  801fd6:	79 41                	jns    802019 <fsring_rw+0x2a2>
+  801fd8:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801fdb:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801fe2:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801fe9:	83 ec 0c             	sub    $0xc,%esp
+  801fec:	68 00 00 f0 cf       	push   $0xcff00000
+  801ff1:	e8 cc 0b 00 00       	call   802bc2 <ipcring_rsp_pop>
+  801ff6:	83 c4 10             	add    $0x10,%esp
+  801ff9:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801fff:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802004:	39 c2                	cmp    %eax,%edx
+  802006:	74 75                	je     80207d <fsring_rw+0x306>
+  802008:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80200c:	75 a5                	jne    801fb3 <fsring_rw+0x23c>
+  80200e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802011:	0f 82 50 ff ff ff    	jb     801f67 <fsring_rw+0x1f0>
+  802017:	eb 9a                	jmp    801fb3 <fsring_rw+0x23c>
+  802019:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80201d:	75 ca                	jne    801fe9 <fsring_rw+0x272>
+  80201f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802023:	74 31                	je     802056 <fsring_rw+0x2df>
+  802025:	8b 45 08             	mov    0x8(%ebp),%eax
+  802028:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80202b:	29 c8                	sub    %ecx,%eax
+  80202d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802030:	39 d0                	cmp    %edx,%eax
+  802032:	0f 47 c2             	cmova  %edx,%eax
+  802035:	39 d8                	cmp    %ebx,%eax
+  802037:	ba 01 00 00 00       	mov    $0x1,%edx
+  80203c:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802040:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802043:	b8 01 00 00 00       	mov    $0x1,%eax
+  802048:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80204c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80204f:	01 d9                	add    %ebx,%ecx
+  802051:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802054:	eb 93                	jmp    801fe9 <fsring_rw+0x272>
+  802056:	83 ec 04             	sub    $0x4,%esp
+  802059:	53                   	push   %ebx
+  80205a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80205d:	83 e0 07             	and    $0x7,%eax
+  802060:	c1 e0 0c             	shl    $0xc,%eax
+  802063:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802069:	50                   	push   %eax
+  80206a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80206d:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802070:	01 c8                	add    %ecx,%eax
+  802072:	50                   	push   %eax
+  802073:	e8 64 eb ff ff       	call   800bdc <memmove>
+  802078:	83 c4 10             	add    $0x10,%esp
+  80207b:	eb a8                	jmp    802025 <fsring_rw+0x2ae>
+  80207d:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802081:	75 09                	jne    80208c <fsring_rw+0x315>
+  802083:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802086:	0f 82 db fe ff ff    	jb     801f67 <fsring_rw+0x1f0>
+  80208c:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80208f:	01 57 04             	add    %edx,0x4(%edi)
+  802092:	85 d2                	test   %edx,%edx
+  802094:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802098:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80209b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80209e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a1:	5b                   	pop    %ebx
+  8020a2:	5e                   	pop    %esi
+  8020a3:	5f                   	pop    %edi
+  8020a4:	5d                   	pop    %ebp
+  8020a5:	c3                   	ret
+
+008020a6 <devfile_write>:
+  8020a6:	55                   	push   %ebp
+  8020a7:	89 e5                	mov    %esp,%ebp
+  8020a9:	57                   	push   %edi
+  8020aa:	56                   	push   %esi
+  8020ab:	53                   	push   %ebx
+  8020ac:	83 ec 0c             	sub    $0xc,%esp
+  8020af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020b8:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8020be:	76 1a                	jbe    8020da <devfile_write+0x34>
+  8020c0:	83 ec 0c             	sub    $0xc,%esp
+  8020c3:	53                   	push   %ebx
+  8020c4:	89 f1                	mov    %esi,%ecx
+  8020c6:	ba 06 00 00 00       	mov    $0x6,%edx
+  8020cb:	89 f8                	mov    %edi,%eax
+  8020cd:	e8 a5 fc ff ff       	call   801d77 <fsring_rw>
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020d8:	75 39                	jne    802113 <devfile_write+0x6d>
+  8020da:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8020df:	39 c3                	cmp    %eax,%ebx
+  8020e1:	0f 47 d8             	cmova  %eax,%ebx
+  8020e4:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020e7:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020ec:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8020f2:	83 ec 04             	sub    $0x4,%esp
+  8020f5:	53                   	push   %ebx
+  8020f6:	56                   	push   %esi
+  8020f7:	68 08 60 80 00       	push   $0x806008
+  8020fc:	e8 db ea ff ff       	call   800bdc <memmove>
+  802101:	ba 00 00 00 00       	mov    $0x0,%edx
+  802106:	b8 04 00 00 00       	mov    $0x4,%eax
+  80210b:	e8 7c fb ff ff       	call   801c8c <fsipc>
+  802110:	83 c4 10             	add    $0x10,%esp
+  802113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802116:	5b                   	pop    %ebx
+  802117:	5e                   	pop    %esi
+  802118:	5f                   	pop    %edi
+  802119:	5d                   	pop    %ebp
+  80211a:	c3                   	ret
+
+0080211b <devfile_read>:
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	57                   	push   %edi
+  80211f:	56                   	push   %esi
+  802120:	53                   	push   %ebx
+  802121:	83 ec 0c             	sub    $0xc,%esp
+  802124:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802127:	8b 75 10             	mov    0x10(%ebp),%esi
+  80212a:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802130:	76 1d                	jbe    80214f <devfile_read+0x34>
+  802132:	83 ec 0c             	sub    $0xc,%esp
+  802135:	56                   	push   %esi
+  802136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802139:	ba 05 00 00 00       	mov    $0x5,%edx
+  80213e:	89 f8                	mov    %edi,%eax
+  802140:	e8 32 fc ff ff       	call   801d77 <fsring_rw>
+  802145:	89 c3                	mov    %eax,%ebx
+  802147:	83 c4 10             	add    $0x10,%esp
+  80214a:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80214d:	75 37                	jne    802186 <devfile_read+0x6b>
+  80214f:	8b 47 0c             	mov    0xc(%edi),%eax
+  802152:	a3 00 60 80 00       	mov    %eax,0x806000
+  802157:	89 35 04 60 80 00    	mov    %esi,0x806004
+  80215d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802162:	b8 03 00 00 00       	mov    $0x3,%eax
+  802167:	e8 20 fb ff ff       	call   801c8c <fsipc>
+  80216c:	89 c3                	mov    %eax,%ebx
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	78 14                	js     802186 <devfile_read+0x6b>
+  802172:	83 ec 04             	sub    $0x4,%esp
+  802175:	50                   	push   %eax
+  802176:	68 00 60 80 00       	push   $0x806000
+  80217b:	ff 75 0c             	push   0xc(%ebp)
+  80217e:	e8 59 ea ff ff       	call   800bdc <memmove>
+  802183:	83 c4 10             	add    $0x10,%esp
+  802186:	89 d8                	mov    %ebx,%eax
+  802188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218b:	5b                   	pop    %ebx
+  80218c:	5e                   	pop    %esi
+  80218d:	5f                   	pop    %edi
+  80218e:	5d                   	pop    %ebp
+  80218f:	c3                   	ret
+
+00802190 <open>:
+  802190:	55                   	push   %ebp
+  802191:	89 e5                	mov    %esp,%ebp
+  802193:	56                   	push   %esi
+  802194:	53                   	push   %ebx
+  802195:	83 ec 1c             	sub    $0x1c,%esp
+  802198:	8b 75 08             	mov    0x8(%ebp),%esi
+  80219b:	56                   	push   %esi
+  80219c:	e8 3f e8 ff ff       	call   8009e0 <strlen>
+  8021a1:	83 c4 10             	add    $0x10,%esp
+  8021a4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021a9:	7f 6c                	jg     802217 <open+0x87>
+  8021ab:	83 ec 0c             	sub    $0xc,%esp
+  8021ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b1:	50                   	push   %eax
+  8021b2:	e8 6a f5 ff ff       	call   801721 <fd_alloc>
+  8021b7:	89 c3                	mov    %eax,%ebx
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	78 3c                	js     8021fc <open+0x6c>
+  8021c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c3:	a3 00 64 80 00       	mov    %eax,0x806400
+  8021c8:	83 ec 08             	sub    $0x8,%esp
+  8021cb:	56                   	push   %esi
+  8021cc:	68 00 60 80 00       	push   $0x806000
+  8021d1:	e8 56 e8 ff ff       	call   800a2c <strcpy>
+  8021d6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021de:	e8 a9 fa ff ff       	call   801c8c <fsipc>
+  8021e3:	89 c3                	mov    %eax,%ebx
+  8021e5:	83 c4 10             	add    $0x10,%esp
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	78 19                	js     802205 <open+0x75>
+  8021ec:	83 ec 0c             	sub    $0xc,%esp
+  8021ef:	ff 75 f4             	push   -0xc(%ebp)
+  8021f2:	e8 03 f5 ff ff       	call   8016fa <fd2num>
+  8021f7:	89 c3                	mov    %eax,%ebx
+  8021f9:	83 c4 10             	add    $0x10,%esp
+  8021fc:	89 d8                	mov    %ebx,%eax
+  8021fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802201:	5b                   	pop    %ebx
+  802202:	5e                   	pop    %esi
+  802203:	5d                   	pop    %ebp
+  802204:	c3                   	ret
+  802205:	83 ec 08             	sub    $0x8,%esp
+  802208:	6a 00                	push   $0x0
+  80220a:	ff 75 f4             	push   -0xc(%ebp)
+  80220d:	e8 05 f6 ff ff       	call   801817 <fd_close>
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	eb e5                	jmp    8021fc <open+0x6c>
+  802217:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80221c:	eb de                	jmp    8021fc <open+0x6c>
+
+0080221e <file_image>:
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	53                   	push   %ebx
+  802222:	83 ec 1c             	sub    $0x1c,%esp
+  802225:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802228:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222b:	50                   	push   %eax
+  80222c:	ff 75 08             	push   0x8(%ebp)
+  80222f:	e8 3d f5 ff ff       	call   801771 <fd_lookup>
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	85 c0                	test   %eax,%eax
+  802239:	78 58                	js     802293 <file_image+0x75>
+  80223b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80223e:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802244:	39 08                	cmp    %ecx,(%eax)
+  802246:	75 50                	jne    802298 <file_image+0x7a>
+  802248:	83 fb 04             	cmp    $0x4,%ebx
+  80224b:	77 52                	ja     80229f <file_image+0x81>
+  80224d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802250:	a3 00 60 80 00       	mov    %eax,0x806000
+  802255:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80225b:	83 ec 04             	sub    $0x4,%esp
+  80225e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802261:	c1 e0 02             	shl    $0x2,%eax
+  802264:	50                   	push   %eax
+  802265:	ff 75 0c             	push   0xc(%ebp)
+  802268:	68 08 60 80 00       	push   $0x806008
+  80226d:	e8 6a e9 ff ff       	call   800bdc <memmove>
+  802272:	ba 00 00 00 00       	mov    $0x0,%edx
+  802277:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80227c:	e8 0b fa ff ff       	call   801c8c <fsipc>
+  802281:	83 c4 10             	add    $0x10,%esp
+  802284:	85 c0                	test   %eax,%eax
+  802286:	78 0b                	js     802293 <file_image+0x75>
+  802288:	8b 55 14             	mov    0x14(%ebp),%edx
+  80228b:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802291:	89 0a                	mov    %ecx,(%edx)
+  802293:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802296:	c9                   	leave
+  802297:	c3                   	ret
+  802298:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80229d:	eb f4                	jmp    802293 <file_image+0x75>
+  80229f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a4:	eb ed                	jmp    802293 <file_image+0x75>
+
+008022a6 <remove>:
+  8022a6:	55                   	push   %ebp
+  8022a7:	89 e5                	mov    %esp,%ebp
+  8022a9:	53                   	push   %ebx
+  8022aa:	83 ec 10             	sub    $0x10,%esp
+  8022ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022b0:	53                   	push   %ebx
+  8022b1:	e8 2a e7 ff ff       	call   8009e0 <strlen>
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022be:	7f 25                	jg     8022e5 <remove+0x3f>
+  8022c0:	83 ec 08             	sub    $0x8,%esp
+  8022c3:	53                   	push   %ebx
+  8022c4:	68 00 60 80 00       	push   $0x806000
+  8022c9:	e8 5e e7 ff ff       	call   800a2c <strcpy>
+  8022ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022d8:	e8 af f9 ff ff       	call   801c8c <fsipc>
+  8022dd:	83 c4 10             	add    $0x10,%esp
+  8022e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e3:	c9                   	leave
+  8022e4:	c3                   	ret
+  8022e5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022ea:	eb f4                	jmp    8022e0 <remove+0x3a>
+
+008022ec <sync>:
+  8022ec:	55                   	push   %ebp
+  8022ed:	89 e5                	mov    %esp,%ebp
+  8022ef:	83 ec 08             	sub    $0x8,%esp
+  8022f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022fc:	e8 8b f9 ff ff       	call   801c8c <fsipc>
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+
+00802303 <devsock_stat>:
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	83 ec 10             	sub    $0x10,%esp
+  802309:	68 88 37 80 00       	push   $0x803788
+  80230e:	ff 75 0c             	push   0xc(%ebp)
+  802311:	e8 16 e7 ff ff       	call   800a2c <strcpy>
+  802316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231b:	c9                   	leave
+  80231c:	c3                   	ret
+
+0080231d <devsock_close>:
+  80231d:	55                   	push   %ebp
+  80231e:	89 e5                	mov    %esp,%ebp
+  802320:	53                   	push   %ebx
+  802321:	83 ec 10             	sub    $0x10,%esp
+  802324:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802327:	53                   	push   %ebx
+  802328:	e8 99 0d 00 00       	call   8030c6 <pageref>
+  80232d:	89 c2                	mov    %eax,%edx
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	b8 00 00 00 00       	mov    $0x0,%eax
+  802337:	83 fa 01             	cmp    $0x1,%edx
+  80233a:	74 05                	je     802341 <devsock_close+0x24>
+  80233c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+  802341:	83 ec 0c             	sub    $0xc,%esp
+  802344:	ff 73 0c             	push   0xc(%ebx)
+  802347:	e8 aa 02 00 00       	call   8025f6 <nsipc_close>
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	eb eb                	jmp    80233c <devsock_close+0x1f>
+
+00802351 <devsock_write>:
+  802351:	55                   	push   %ebp
+  802352:	89 e5                	mov    %esp,%ebp
+  802354:	83 ec 08             	sub    $0x8,%esp
+  802357:	6a 00                	push   $0x0
+  802359:	ff 75 10             	push   0x10(%ebp)
+  80235c:	ff 75 0c             	push   0xc(%ebp)
+  80235f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802362:	ff 70 0c             	push   0xc(%eax)
+  802365:	e8 6c 03 00 00       	call   8026d6 <nsipc_send>
+  80236a:	c9                   	leave
+  80236b:	c3                   	ret
+
+0080236c <devsock_read>:
+  80236c:	55                   	push   %ebp
+  80236d:	89 e5                	mov    %esp,%ebp
+  80236f:	83 ec 08             	sub    $0x8,%esp
+  802372:	6a 00                	push   $0x0
+  802374:	ff 75 10             	push   0x10(%ebp)
+  802377:	ff 75 0c             	push   0xc(%ebp)
+  80237a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237d:	ff 70 0c             	push   0xc(%eax)
+  802380:	e8 e2 02 00 00       	call   802667 <nsipc_recv>
+  802385:	c9                   	leave
+  802386:	c3                   	ret
+
+00802387 <fd2sockid>:
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	83 ec 20             	sub    $0x20,%esp
+  80238d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802390:	52                   	push   %edx
+  802391:	50                   	push   %eax
+  802392:	e8 da f3 ff ff       	call   801771 <fd_lookup>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 10                	js     8023ae <fd2sockid+0x27>
+  80239e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a1:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8023a7:	39 08                	cmp    %ecx,(%eax)
+  8023a9:	75 05                	jne    8023b0 <fd2sockid+0x29>
+  8023ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+  8023b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023b5:	eb f7                	jmp    8023ae <fd2sockid+0x27>
+
+008023b7 <alloc_sockfd>:
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	56                   	push   %esi
+  8023bb:	53                   	push   %ebx
+  8023bc:	83 ec 1c             	sub    $0x1c,%esp
+  8023bf:	89 c6                	mov    %eax,%esi
+  8023c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023c4:	50                   	push   %eax
+  8023c5:	e8 57 f3 ff ff       	call   801721 <fd_alloc>
+  8023ca:	89 c3                	mov    %eax,%ebx
+  8023cc:	83 c4 10             	add    $0x10,%esp
+  8023cf:	85 c0                	test   %eax,%eax
+  8023d1:	78 43                	js     802416 <alloc_sockfd+0x5f>
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	68 07 04 00 00       	push   $0x407
+  8023db:	ff 75 f4             	push   -0xc(%ebp)
+  8023de:	6a 00                	push   $0x0
+  8023e0:	e8 a7 ea ff ff       	call   800e8c <sys_page_alloc>
+  8023e5:	89 c3                	mov    %eax,%ebx
+  8023e7:	83 c4 10             	add    $0x10,%esp
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	78 28                	js     802416 <alloc_sockfd+0x5f>
+  8023ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f1:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8023f7:	89 10                	mov    %edx,(%eax)
+  8023f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023fc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802403:	89 70 0c             	mov    %esi,0xc(%eax)
+  802406:	83 ec 0c             	sub    $0xc,%esp
+  802409:	50                   	push   %eax
+  80240a:	e8 eb f2 ff ff       	call   8016fa <fd2num>
+  80240f:	89 c3                	mov    %eax,%ebx
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	eb 0c                	jmp    802422 <alloc_sockfd+0x6b>
+  802416:	83 ec 0c             	sub    $0xc,%esp
+  802419:	56                   	push   %esi
+  80241a:	e8 d7 01 00 00       	call   8025f6 <nsipc_close>
+  80241f:	83 c4 10             	add    $0x10,%esp
+  802422:	89 d8                	mov    %ebx,%eax
+  802424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802427:	5b                   	pop    %ebx
+  802428:	5e                   	pop    %esi
+  802429:	5d                   	pop    %ebp
+  80242a:	c3                   	ret
+
+0080242b <accept>:
+  80242b:	55                   	push   %ebp
+  80242c:	89 e5                	mov    %esp,%ebp
+  80242e:	83 ec 08             	sub    $0x8,%esp
+  802431:	8b 45 08             	mov    0x8(%ebp),%eax
+  802434:	e8 4e ff ff ff       	call   802387 <fd2sockid>
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 1b                	js     802458 <accept+0x2d>
+  80243d:	83 ec 04             	sub    $0x4,%esp
+  802440:	ff 75 10             	push   0x10(%ebp)
+  802443:	ff 75 0c             	push   0xc(%ebp)
+  802446:	50                   	push   %eax
+  802447:	e8 07 01 00 00       	call   802553 <nsipc_accept>
+  80244c:	83 c4 10             	add    $0x10,%esp
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 05                	js     802458 <accept+0x2d>
+  802453:	e8 5f ff ff ff       	call   8023b7 <alloc_sockfd>
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+
+0080245a <bind>:
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	83 ec 08             	sub    $0x8,%esp
+  802460:	8b 45 08             	mov    0x8(%ebp),%eax
+  802463:	e8 1f ff ff ff       	call   802387 <fd2sockid>
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	78 12                	js     80247e <bind+0x24>
+  80246c:	83 ec 04             	sub    $0x4,%esp
+  80246f:	ff 75 10             	push   0x10(%ebp)
+  802472:	ff 75 0c             	push   0xc(%ebp)
+  802475:	50                   	push   %eax
+  802476:	e8 24 01 00 00       	call   80259f <nsipc_bind>
+  80247b:	83 c4 10             	add    $0x10,%esp
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+
+00802480 <shutdown>:
+  802480:	55                   	push   %ebp
+  802481:	89 e5                	mov    %esp,%ebp
+  802483:	83 ec 08             	sub    $0x8,%esp
+  802486:	8b 45 08             	mov    0x8(%ebp),%eax
+  802489:	e8 f9 fe ff ff       	call   802387 <fd2sockid>
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	78 0f                	js     8024a1 <shutdown+0x21>
+  802492:	83 ec 08             	sub    $0x8,%esp
+  802495:	ff 75 0c             	push   0xc(%ebp)
+  802498:	50                   	push   %eax
+  802499:	e8 36 01 00 00       	call   8025d4 <nsipc_shutdown>
+  80249e:	83 c4 10             	add    $0x10,%esp
+  8024a1:	c9                   	leave
+  8024a2:	c3                   	ret
+
+008024a3 <connect>:
+  8024a3:	55                   	push   %ebp
+  8024a4:	89 e5                	mov    %esp,%ebp
+  8024a6:	83 ec 08             	sub    $0x8,%esp
+  8024a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ac:	e8 d6 fe ff ff       	call   802387 <fd2sockid>
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	78 12                	js     8024c7 <connect+0x24>
+  8024b5:	83 ec 04             	sub    $0x4,%esp
+  8024b8:	ff 75 10             	push   0x10(%ebp)
+  8024bb:	ff 75 0c             	push   0xc(%ebp)
+  8024be:	50                   	push   %eax
+  8024bf:	e8 4c 01 00 00       	call   802610 <nsipc_connect>
+  8024c4:	83 c4 10             	add    $0x10,%esp
+  8024c7:	c9                   	leave
+  8024c8:	c3                   	ret
+
+008024c9 <listen>:
+  8024c9:	55                   	push   %ebp
+  8024ca:	89 e5                	mov    %esp,%ebp
+  8024cc:	83 ec 08             	sub    $0x8,%esp
+  8024cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d2:	e8 b0 fe ff ff       	call   802387 <fd2sockid>
+  8024d7:	85 c0                	test   %eax,%eax
+  8024d9:	78 0f                	js     8024ea <listen+0x21>
+  8024db:	83 ec 08             	sub    $0x8,%esp
+  8024de:	ff 75 0c             	push   0xc(%ebp)
+  8024e1:	50                   	push   %eax
+  8024e2:	e8 5e 01 00 00       	call   802645 <nsipc_listen>
+  8024e7:	83 c4 10             	add    $0x10,%esp
+  8024ea:	c9                   	leave
+  8024eb:	c3                   	ret
+
+008024ec <socket>:
+  8024ec:	55                   	push   %ebp
+  8024ed:	89 e5                	mov    %esp,%ebp
+  8024ef:	83 ec 0c             	sub    $0xc,%esp
+  8024f2:	ff 75 10             	push   0x10(%ebp)
+  8024f5:	ff 75 0c             	push   0xc(%ebp)
+  8024f8:	ff 75 08             	push   0x8(%ebp)
+  8024fb:	e8 34 02 00 00       	call   802734 <nsipc_socket>
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	85 c0                	test   %eax,%eax
+  802505:	78 05                	js     80250c <socket+0x20>
+  802507:	e8 ab fe ff ff       	call   8023b7 <alloc_sockfd>
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+
+0080250e <nsipc>:
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	53                   	push   %ebx
+  802512:	83 ec 04             	sub    $0x4,%esp
+  802515:	89 c3                	mov    %eax,%ebx
+  802517:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80251e:	74 1f                	je     80253f <nsipc+0x31>
+  802520:	83 ec 08             	sub    $0x8,%esp
+  802523:	6a 00                	push   $0x0
+  802525:	6a 00                	push   $0x0
+  802527:	6a 07                	push   $0x7
+  802529:	68 00 70 80 00       	push   $0x807000
+  80252e:	53                   	push   %ebx
+  80252f:	ff 35 0c 50 80 00    	push   0x80500c
+  802535:	e8 d7 09 00 00       	call   802f11 <ipc_call>
+  80253a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80253d:	c9                   	leave
+  80253e:	c3                   	ret
+  80253f:	83 ec 0c             	sub    $0xc,%esp
+  802542:	6a 03                	push   $0x3
+  802544:	e8 63 0b 00 00       	call   8030ac <ipc_find_env>
+  802549:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80254e:	83 c4 10             	add    $0x10,%esp
+  802551:	eb cd                	jmp    802520 <nsipc+0x12>
+
+00802553 <nsipc_accept>:
+  802553:	55                   	push   %ebp
+  802554:	89 e5                	mov    %esp,%ebp
+  802556:	53                   	push   %ebx
+  802557:	83 ec 04             	sub    $0x4,%esp
+  80255a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802562:	b8 01 00 00 00       	mov    $0x1,%eax
+  802567:	e8 a2 ff ff ff       	call   80250e <nsipc>
+  80256c:	89 c3                	mov    %eax,%ebx
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	79 07                	jns    802579 <nsipc_accept+0x26>
+  802572:	89 d8                	mov    %ebx,%eax
+  802574:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+  802579:	83 ec 04             	sub    $0x4,%esp
+  80257c:	ff 35 10 70 80 00    	push   0x807010
+  802582:	68 00 70 80 00       	push   $0x807000
+  802587:	ff 75 0c             	push   0xc(%ebp)
+  80258a:	e8 4d e6 ff ff       	call   800bdc <memmove>
+  80258f:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802595:	8b 45 10             	mov    0x10(%ebp),%eax
+  802598:	89 10                	mov    %edx,(%eax)
+  80259a:	83 c4 10             	add    $0x10,%esp
+  80259d:	eb d3                	jmp    802572 <nsipc_accept+0x1f>
+
+0080259f <nsipc_bind>:
+  80259f:	55                   	push   %ebp
+  8025a0:	89 e5                	mov    %esp,%ebp
+  8025a2:	53                   	push   %ebx
+  8025a3:	83 ec 08             	sub    $0x8,%esp
+  8025a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ac:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025b1:	53                   	push   %ebx
+  8025b2:	ff 75 0c             	push   0xc(%ebp)
+  8025b5:	68 04 70 80 00       	push   $0x807004
+  8025ba:	e8 1d e6 ff ff       	call   800bdc <memmove>
+  8025bf:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8025c5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025ca:	e8 3f ff ff ff       	call   80250e <nsipc>
+  8025cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025d2:	c9                   	leave
+  8025d3:	c3                   	ret
+
+008025d4 <nsipc_shutdown>:
+  8025d4:	55                   	push   %ebp
+  8025d5:	89 e5                	mov    %esp,%ebp
+  8025d7:	83 ec 08             	sub    $0x8,%esp
+  8025da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025dd:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e5:	a3 04 70 80 00       	mov    %eax,0x807004
+  8025ea:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025ef:	e8 1a ff ff ff       	call   80250e <nsipc>
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+
+008025f6 <nsipc_close>:
+  8025f6:	55                   	push   %ebp
+  8025f7:	89 e5                	mov    %esp,%ebp
+  8025f9:	83 ec 08             	sub    $0x8,%esp
+  8025fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ff:	a3 00 70 80 00       	mov    %eax,0x807000
+  802604:	b8 04 00 00 00       	mov    $0x4,%eax
+  802609:	e8 00 ff ff ff       	call   80250e <nsipc>
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+
+00802610 <nsipc_connect>:
+  802610:	55                   	push   %ebp
+  802611:	89 e5                	mov    %esp,%ebp
+  802613:	53                   	push   %ebx
+  802614:	83 ec 08             	sub    $0x8,%esp
+  802617:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80261a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802622:	53                   	push   %ebx
+  802623:	ff 75 0c             	push   0xc(%ebp)
+  802626:	68 04 70 80 00       	push   $0x807004
+  80262b:	e8 ac e5 ff ff       	call   800bdc <memmove>
+  802630:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802636:	b8 05 00 00 00       	mov    $0x5,%eax
+  80263b:	e8 ce fe ff ff       	call   80250e <nsipc>
+  802640:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802643:	c9                   	leave
+  802644:	c3                   	ret
+
+00802645 <nsipc_listen>:
+  802645:	55                   	push   %ebp
+  802646:	89 e5                	mov    %esp,%ebp
+  802648:	83 ec 08             	sub    $0x8,%esp
+  80264b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802653:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802656:	a3 04 70 80 00       	mov    %eax,0x807004
+  80265b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802660:	e8 a9 fe ff ff       	call   80250e <nsipc>
+  802665:	c9                   	leave
+  802666:	c3                   	ret
+
+00802667 <nsipc_recv>:
+  802667:	55                   	push   %ebp
+  802668:	89 e5                	mov    %esp,%ebp
+  80266a:	56                   	push   %esi
+  80266b:	53                   	push   %ebx
+  80266c:	8b 75 10             	mov    0x10(%ebp),%esi
+  80266f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802672:	a3 00 70 80 00       	mov    %eax,0x807000
+  802677:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80267d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802680:	a3 08 70 80 00       	mov    %eax,0x807008
+  802685:	b8 07 00 00 00       	mov    $0x7,%eax
+  80268a:	e8 7f fe ff ff       	call   80250e <nsipc>
+  80268f:	89 c3                	mov    %eax,%ebx
+  802691:	85 c0                	test   %eax,%eax
+  802693:	78 22                	js     8026b7 <nsipc_recv+0x50>
+  802695:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80269a:	39 c6                	cmp    %eax,%esi
+  80269c:	0f 4e c6             	cmovle %esi,%eax
+  80269f:	39 c3                	cmp    %eax,%ebx
+  8026a1:	7f 1d                	jg     8026c0 <nsipc_recv+0x59>
+  8026a3:	83 ec 04             	sub    $0x4,%esp
+  8026a6:	53                   	push   %ebx
+  8026a7:	68 00 70 80 00       	push   $0x807000
+  8026ac:	ff 75 0c             	push   0xc(%ebp)
+  8026af:	e8 28 e5 ff ff       	call   800bdc <memmove>
+  8026b4:	83 c4 10             	add    $0x10,%esp
+  8026b7:	89 d8                	mov    %ebx,%eax
+  8026b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026bc:	5b                   	pop    %ebx
+  8026bd:	5e                   	pop    %esi
+  8026be:	5d                   	pop    %ebp
+  8026bf:	c3                   	ret
+  8026c0:	68 94 37 80 00       	push   $0x803794
+  8026c5:	68 a9 37 80 00       	push   $0x8037a9
+  8026ca:	6a 60                	push   $0x60
+  8026cc:	68 be 37 80 00       	push   $0x8037be
+  8026d1:	e8 84 db ff ff       	call   80025a <_panic>
+
+008026d6 <nsipc_send>:
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	53                   	push   %ebx
+  8026da:	83 ec 04             	sub    $0x4,%esp
+  8026dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e3:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026e8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8026ee:	7f 2e                	jg     80271e <nsipc_send+0x48>
+  8026f0:	83 ec 04             	sub    $0x4,%esp
+  8026f3:	53                   	push   %ebx
+  8026f4:	ff 75 0c             	push   0xc(%ebp)
+  8026f7:	68 0c 70 80 00       	push   $0x80700c
+  8026fc:	e8 db e4 ff ff       	call   800bdc <memmove>
+  802701:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80270a:	a3 08 70 80 00       	mov    %eax,0x807008
+  80270f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802714:	e8 f5 fd ff ff       	call   80250e <nsipc>
+  802719:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80271c:	c9                   	leave
+  80271d:	c3                   	ret
+  80271e:	68 ca 37 80 00       	push   $0x8037ca
+  802723:	68 a9 37 80 00       	push   $0x8037a9
+  802728:	6a 6b                	push   $0x6b
+  80272a:	68 be 37 80 00       	push   $0x8037be
+  80272f:	e8 26 db ff ff       	call   80025a <_panic>
+
+00802734 <nsipc_socket>:
+  802734:	55                   	push   %ebp
+  802735:	89 e5                	mov    %esp,%ebp
+  802737:	83 ec 08             	sub    $0x8,%esp
+  80273a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802742:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802745:	a3 04 70 80 00       	mov    %eax,0x807004
+  80274a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80274d:	a3 08 70 80 00       	mov    %eax,0x807008
+  802752:	b8 09 00 00 00       	mov    $0x9,%eax
+  802757:	e8 b2 fd ff ff       	call   80250e <nsipc>
+  80275c:	c9                   	leave
+  80275d:	c3                   	ret
+
+0080275e <devpipe_stat>:
+  80275e:	55                   	push   %ebp
+  80275f:	89 e5                	mov    %esp,%ebp
+  802761:	56                   	push   %esi
+  802762:	53                   	push   %ebx
+  802763:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802766:	83 ec 0c             	sub    $0xc,%esp
+  802769:	ff 75 08             	push   0x8(%ebp)
+  80276c:	e8 99 ef ff ff       	call   80170a <fd2data>
+  802771:	89 c6                	mov    %eax,%esi
+  802773:	83 c4 08             	add    $0x8,%esp
+  802776:	68 d6 37 80 00       	push   $0x8037d6
+  80277b:	53                   	push   %ebx
+  80277c:	e8 ab e2 ff ff       	call   800a2c <strcpy>
+  802781:	8b 46 04             	mov    0x4(%esi),%eax
+  802784:	2b 06                	sub    (%esi),%eax
+  802786:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80278c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802793:	00 00 00 
+  802796:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80279d:	40 80 00 
+  8027a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a8:	5b                   	pop    %ebx
+  8027a9:	5e                   	pop    %esi
+  8027aa:	5d                   	pop    %ebp
+  8027ab:	c3                   	ret
+
+008027ac <devpipe_close>:
+  8027ac:	55                   	push   %ebp
+  8027ad:	89 e5                	mov    %esp,%ebp
+  8027af:	53                   	push   %ebx
+  8027b0:	83 ec 0c             	sub    $0xc,%esp
+  8027b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027b6:	53                   	push   %ebx
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	e8 a0 e7 ff ff       	call   800f5e <sys_page_unmap>
+  8027be:	89 1c 24             	mov    %ebx,(%esp)
+  8027c1:	e8 44 ef ff ff       	call   80170a <fd2data>
+  8027c6:	83 c4 08             	add    $0x8,%esp
+  8027c9:	50                   	push   %eax
+  8027ca:	6a 00                	push   $0x0
+  8027cc:	e8 8d e7 ff ff       	call   800f5e <sys_page_unmap>
+  8027d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+
+008027d6 <_pipeisclosed>:
+  8027d6:	55                   	push   %ebp
+  8027d7:	89 e5                	mov    %esp,%ebp
+  8027d9:	57                   	push   %edi
+  8027da:	56                   	push   %esi
+  8027db:	53                   	push   %ebx
+  8027dc:	83 ec 1c             	sub    $0x1c,%esp
+  8027df:	89 c7                	mov    %eax,%edi
+  8027e1:	89 d6                	mov    %edx,%esi
+  8027e3:	a1 10 50 80 00       	mov    0x805010,%eax
+  8027e8:	8b 58 58             	mov    0x58(%eax),%ebx
+  8027eb:	83 ec 0c             	sub    $0xc,%esp
+  8027ee:	57                   	push   %edi
+  8027ef:	e8 d2 08 00 00       	call   8030c6 <pageref>
+  8027f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027f7:	89 34 24             	mov    %esi,(%esp)
+  8027fa:	e8 c7 08 00 00       	call   8030c6 <pageref>
+  8027ff:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  802805:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	39 cb                	cmp    %ecx,%ebx
+  80280d:	74 1b                	je     80282a <_pipeisclosed+0x54>
+  80280f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802812:	75 cf                	jne    8027e3 <_pipeisclosed+0xd>
+  802814:	8b 42 58             	mov    0x58(%edx),%eax
+  802817:	6a 01                	push   $0x1
+  802819:	50                   	push   %eax
+  80281a:	53                   	push   %ebx
+  80281b:	68 dd 37 80 00       	push   $0x8037dd
+  802820:	e8 10 db ff ff       	call   800335 <cprintf>
+  802825:	83 c4 10             	add    $0x10,%esp
+  802828:	eb b9                	jmp    8027e3 <_pipeisclosed+0xd>
+  80282a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80282d:	0f 94 c0             	sete   %al
+  802830:	0f b6 c0             	movzbl %al,%eax
+  802833:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802836:	5b                   	pop    %ebx
+  802837:	5e                   	pop    %esi
+  802838:	5f                   	pop    %edi
+  802839:	5d                   	pop    %ebp
+  80283a:	c3                   	ret
+
+0080283b <devpipe_write>:
+  80283b:	55                   	push   %ebp
+  80283c:	89 e5                	mov    %esp,%ebp
+  80283e:	57                   	push   %edi
+  80283f:	56                   	push   %esi
+  802840:	53                   	push   %ebx
+  802841:	83 ec 28             	sub    $0x28,%esp
+  802844:	8b 75 08             	mov    0x8(%ebp),%esi
+  802847:	56                   	push   %esi
+  802848:	e8 bd ee ff ff       	call   80170a <fd2data>
+  80284d:	89 c3                	mov    %eax,%ebx
+  80284f:	83 c4 10             	add    $0x10,%esp
+  802852:	bf 00 00 00 00       	mov    $0x0,%edi
+  802857:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80285b:	74 5c                	je     8028b9 <devpipe_write+0x7e>
+  80285d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802860:	8b 0b                	mov    (%ebx),%ecx
+  802862:	8d 51 20             	lea    0x20(%ecx),%edx
+  802865:	39 d0                	cmp    %edx,%eax
+  802867:	72 1e                	jb     802887 <devpipe_write+0x4c>
+  802869:	89 da                	mov    %ebx,%edx
+  80286b:	89 f0                	mov    %esi,%eax
+  80286d:	e8 64 ff ff ff       	call   8027d6 <_pipeisclosed>
+  802872:	85 c0                	test   %eax,%eax
+  802874:	75 48                	jne    8028be <devpipe_write+0x83>
+  802876:	e8 c6 e5 ff ff       	call   800e41 <sys_yield>
+  80287b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80287e:	8b 0b                	mov    (%ebx),%ecx
+  802880:	8d 51 20             	lea    0x20(%ecx),%edx
+  802883:	39 d0                	cmp    %edx,%eax
+  802885:	73 e2                	jae    802869 <devpipe_write+0x2e>
+  802887:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80288a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80288e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802891:	89 c2                	mov    %eax,%edx
+  802893:	c1 fa 1f             	sar    $0x1f,%edx
+  802896:	89 d1                	mov    %edx,%ecx
+  802898:	c1 e9 1b             	shr    $0x1b,%ecx
+  80289b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80289e:	83 e2 1f             	and    $0x1f,%edx
+  8028a1:	29 ca                	sub    %ecx,%edx
+  8028a3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8028a7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8028ab:	83 c0 01             	add    $0x1,%eax
+  8028ae:	89 43 04             	mov    %eax,0x4(%ebx)
+  8028b1:	83 c7 01             	add    $0x1,%edi
+  8028b4:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8028b7:	75 a4                	jne    80285d <devpipe_write+0x22>
+  8028b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028bc:	eb 05                	jmp    8028c3 <devpipe_write+0x88>
+  8028be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c6:	5b                   	pop    %ebx
+  8028c7:	5e                   	pop    %esi
+  8028c8:	5f                   	pop    %edi
+  8028c9:	5d                   	pop    %ebp
+  8028ca:	c3                   	ret
+
+008028cb <devpipe_read>:
+  8028cb:	55                   	push   %ebp
+  8028cc:	89 e5                	mov    %esp,%ebp
+  8028ce:	57                   	push   %edi
+  8028cf:	56                   	push   %esi
+  8028d0:	53                   	push   %ebx
+  8028d1:	83 ec 18             	sub    $0x18,%esp
+  8028d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028d7:	56                   	push   %esi
+  8028d8:	e8 2d ee ff ff       	call   80170a <fd2data>
+  8028dd:	89 c3                	mov    %eax,%ebx
+  8028df:	83 c4 10             	add    $0x10,%esp
+  8028e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028eb:	74 45                	je     802932 <devpipe_read+0x67>
+  8028ed:	8b 03                	mov    (%ebx),%eax
+  8028ef:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028f2:	75 1d                	jne    802911 <devpipe_read+0x46>
+  8028f4:	85 ff                	test   %edi,%edi
+  8028f6:	75 3f                	jne    802937 <devpipe_read+0x6c>
+  8028f8:	89 da                	mov    %ebx,%edx
+  8028fa:	89 f0                	mov    %esi,%eax
+  8028fc:	e8 d5 fe ff ff       	call   8027d6 <_pipeisclosed>
+  802901:	85 c0                	test   %eax,%eax
+  802903:	75 3c                	jne    802941 <devpipe_read+0x76>
+  802905:	e8 37 e5 ff ff       	call   800e41 <sys_yield>
+  80290a:	8b 03                	mov    (%ebx),%eax
+  80290c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80290f:	74 e7                	je     8028f8 <devpipe_read+0x2d>
+  802911:	99                   	cltd
+  802912:	c1 ea 1b             	shr    $0x1b,%edx
+  802915:	01 d0                	add    %edx,%eax
+  802917:	83 e0 1f             	and    $0x1f,%eax
+  80291a:	29 d0                	sub    %edx,%eax
+  80291c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802921:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802924:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802927:	83 03 01             	addl   $0x1,(%ebx)
+  80292a:	83 c7 01             	add    $0x1,%edi
+  80292d:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802930:	75 bb                	jne    8028ed <devpipe_read+0x22>
+  802932:	8b 45 10             	mov    0x10(%ebp),%eax
+  802935:	eb 02                	jmp    802939 <devpipe_read+0x6e>
+  802937:	89 f8                	mov    %edi,%eax
+  802939:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80293c:	5b                   	pop    %ebx
+  80293d:	5e                   	pop    %esi
+  80293e:	5f                   	pop    %edi
+  80293f:	5d                   	pop    %ebp
+  802940:	c3                   	ret
+  802941:	b8 00 00 00 00       	mov    $0x0,%eax
+  802946:	eb f1                	jmp    802939 <devpipe_read+0x6e>
+
+00802948 <pipe>:
+  802948:	55                   	push   %ebp
+  802949:	89 e5                	mov    %esp,%ebp
+  80294b:	56                   	push   %esi
+  80294c:	53                   	push   %ebx
+  80294d:	83 ec 1c             	sub    $0x1c,%esp
+  802950:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802953:	50                   	push   %eax
+  802954:	e8 c8 ed ff ff       	call   801721 <fd_alloc>
+  802959:	89 c3                	mov    %eax,%ebx
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	0f 88 23 01 00 00    	js     802a89 <pipe+0x141>
+  802966:	83 ec 04             	sub    $0x4,%esp
+  802969:	68 07 04 00 00       	push   $0x407
+  80296e:	ff 75 f4             	push   -0xc(%ebp)
+  802971:	6a 00                	push   $0x0
+  802973:	e8 14 e5 ff ff       	call   800e8c <sys_page_alloc>
+  802978:	89 c3                	mov    %eax,%ebx
+  80297a:	83 c4 10             	add    $0x10,%esp
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	0f 88 04 01 00 00    	js     802a89 <pipe+0x141>
+  802985:	83 ec 0c             	sub    $0xc,%esp
+  802988:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80298b:	50                   	push   %eax
+  80298c:	e8 90 ed ff ff       	call   801721 <fd_alloc>
+  802991:	89 c3                	mov    %eax,%ebx
+  802993:	83 c4 10             	add    $0x10,%esp
+  802996:	85 c0                	test   %eax,%eax
+  802998:	0f 88 db 00 00 00    	js     802a79 <pipe+0x131>
+  80299e:	83 ec 04             	sub    $0x4,%esp
+  8029a1:	68 07 04 00 00       	push   $0x407
+  8029a6:	ff 75 f0             	push   -0x10(%ebp)
+  8029a9:	6a 00                	push   $0x0
+  8029ab:	e8 dc e4 ff ff       	call   800e8c <sys_page_alloc>
+  8029b0:	89 c3                	mov    %eax,%ebx
+  8029b2:	83 c4 10             	add    $0x10,%esp
+  8029b5:	85 c0                	test   %eax,%eax
+  8029b7:	0f 88 bc 00 00 00    	js     802a79 <pipe+0x131>
+  8029bd:	83 ec 0c             	sub    $0xc,%esp
+  8029c0:	ff 75 f4             	push   -0xc(%ebp)
+  8029c3:	e8 42 ed ff ff       	call   80170a <fd2data>
+  8029c8:	89 c6                	mov    %eax,%esi
+  8029ca:	83 c4 0c             	add    $0xc,%esp
+  8029cd:	68 07 04 00 00       	push   $0x407
+  8029d2:	50                   	push   %eax
+  8029d3:	6a 00                	push   $0x0
+  8029d5:	e8 b2 e4 ff ff       	call   800e8c <sys_page_alloc>
+  8029da:	89 c3                	mov    %eax,%ebx
+  8029dc:	83 c4 10             	add    $0x10,%esp
+  8029df:	85 c0                	test   %eax,%eax
+  8029e1:	0f 88 82 00 00 00    	js     802a69 <pipe+0x121>
+  8029e7:	83 ec 0c             	sub    $0xc,%esp
+  8029ea:	ff 75 f0             	push   -0x10(%ebp)
+  8029ed:	e8 18 ed ff ff       	call   80170a <fd2data>
+  8029f2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029f9:	50                   	push   %eax
+  8029fa:	6a 00                	push   $0x0
+  8029fc:	56                   	push   %esi
+  8029fd:	6a 00                	push   $0x0
+  8029ff:	e8 cb e4 ff ff       	call   800ecf <sys_page_map>
+  802a04:	89 c3                	mov    %eax,%ebx
+  802a06:	83 c4 20             	add    $0x20,%esp
+  802a09:	85 c0                	test   %eax,%eax
+  802a0b:	78 4e                	js     802a5b <pipe+0x113>
+  802a0d:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802a12:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a15:	89 02                	mov    %eax,(%edx)
+  802a17:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a1a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802a21:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a24:	89 02                	mov    %eax,(%edx)
+  802a26:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802a29:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802a30:	83 ec 0c             	sub    $0xc,%esp
+  802a33:	ff 75 f4             	push   -0xc(%ebp)
+  802a36:	e8 bf ec ff ff       	call   8016fa <fd2num>
+  802a3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a3e:	89 01                	mov    %eax,(%ecx)
+  802a40:	83 c4 04             	add    $0x4,%esp
+  802a43:	ff 75 f0             	push   -0x10(%ebp)
+  802a46:	e8 af ec ff ff       	call   8016fa <fd2num>
+  802a4b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a4e:	89 41 04             	mov    %eax,0x4(%ecx)
+  802a51:	83 c4 10             	add    $0x10,%esp
+  802a54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a59:	eb 2e                	jmp    802a89 <pipe+0x141>
+  802a5b:	83 ec 08             	sub    $0x8,%esp
+  802a5e:	56                   	push   %esi
+  802a5f:	6a 00                	push   $0x0
+  802a61:	e8 f8 e4 ff ff       	call   800f5e <sys_page_unmap>
+  802a66:	83 c4 10             	add    $0x10,%esp
+  802a69:	83 ec 08             	sub    $0x8,%esp
+  802a6c:	ff 75 f0             	push   -0x10(%ebp)
+  802a6f:	6a 00                	push   $0x0
+  802a71:	e8 e8 e4 ff ff       	call   800f5e <sys_page_unmap>
+  802a76:	83 c4 10             	add    $0x10,%esp
+  802a79:	83 ec 08             	sub    $0x8,%esp
+  802a7c:	ff 75 f4             	push   -0xc(%ebp)
+  802a7f:	6a 00                	push   $0x0
+  802a81:	e8 d8 e4 ff ff       	call   800f5e <sys_page_unmap>
+  802a86:	83 c4 10             	add    $0x10,%esp
+  802a89:	89 d8                	mov    %ebx,%eax
+  802a8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a8e:	5b                   	pop    %ebx
+  802a8f:	5e                   	pop    %esi
+  802a90:	5d                   	pop    %ebp
+  802a91:	c3                   	ret
+
+00802a92 <pipeisclosed>:
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	83 ec 20             	sub    $0x20,%esp
+  802a98:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a9b:	50                   	push   %eax
+  802a9c:	ff 75 08             	push   0x8(%ebp)
+  802a9f:	e8 cd ec ff ff       	call   801771 <fd_lookup>
+  802aa4:	83 c4 10             	add    $0x10,%esp
+  802aa7:	85 c0                	test   %eax,%eax
+  802aa9:	78 18                	js     802ac3 <pipeisclosed+0x31>
+  802aab:	83 ec 0c             	sub    $0xc,%esp
+  802aae:	ff 75 f4             	push   -0xc(%ebp)
+  802ab1:	e8 54 ec ff ff       	call   80170a <fd2data>
+  802ab6:	89 c2                	mov    %eax,%edx
+  802ab8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802abb:	e8 16 fd ff ff       	call   8027d6 <_pipeisclosed>
+  802ac0:	83 c4 10             	add    $0x10,%esp
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <ipcring_init>:
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	53                   	push   %ebx
+  802ac9:	83 ec 08             	sub    $0x8,%esp
+  802acc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802acf:	6a 60                	push   $0x60
+  802ad1:	6a 00                	push   $0x0
+  802ad3:	53                   	push   %ebx
+  802ad4:	e8 ce e0 ff ff       	call   800ba7 <memset>
+  802ad9:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ade:	8b 40 48             	mov    0x48(%eax),%eax
+  802ae1:	89 03                	mov    %eax,(%ebx)
+  802ae3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae6:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ae9:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aec:	89 43 08             	mov    %eax,0x8(%ebx)
+  802aef:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802af5:	83 c4 10             	add    $0x10,%esp
+  802af8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afb:	c9                   	leave
+  802afc:	c3                   	ret
+
+00802afd <ipcring_req_slot>:
+  802afd:	55                   	push   %ebp
+  802afe:	89 e5                	mov    %esp,%ebp
+  802b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b03:	8b 50 10             	mov    0x10(%eax),%edx
+  802b06:	8b 48 18             	mov    0x18(%eax),%ecx
+  802b09:	29 ca                	sub    %ecx,%edx
+  802b0b:	83 fa 07             	cmp    $0x7,%edx
+  802b0e:	77 0c                	ja     802b1c <ipcring_req_slot+0x1f>
+  802b10:	8b 50 10             	mov    0x10(%eax),%edx
+  802b13:	83 e2 07             	and    $0x7,%edx
+  802b16:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802b1a:	5d                   	pop    %ebp
+  802b1b:	c3                   	ret
+  802b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b21:	eb f7                	jmp    802b1a <ipcring_req_slot+0x1d>
+
+00802b23 <ipcring_req_push>:
+  802b23:	55                   	push   %ebp
+  802b24:	89 e5                	mov    %esp,%ebp
+  802b26:	83 ec 08             	sub    $0x8,%esp
+  802b29:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b2c:	8b 42 10             	mov    0x10(%edx),%eax
+  802b2f:	83 c0 01             	add    $0x1,%eax
+  802b32:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802b36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3b:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802b3f:	85 c0                	test   %eax,%eax
+  802b41:	75 02                	jne    802b45 <ipcring_req_push+0x22>
+  802b43:	c9                   	leave
+  802b44:	c3                   	ret
+  802b45:	6a 00                	push   $0x0
+  802b47:	68 00 00 80 ee       	push   $0xee800000
+  802b4c:	ff 72 08             	push   0x8(%edx)
+  802b4f:	ff 72 04             	push   0x4(%edx)
+  802b52:	e8 6d e6 ff ff       	call   8011c4 <sys_ipc_send>
+  802b57:	83 c4 10             	add    $0x10,%esp
+  802b5a:	eb e7                	jmp    802b43 <ipcring_req_push+0x20>
+
+00802b5c <ipcring_rsp_wait>:
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	53                   	push   %ebx
+  802b60:	83 ec 04             	sub    $0x4,%esp
+  802b63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b66:	8b 53 18             	mov    0x18(%ebx),%edx
+  802b69:	8b 43 10             	mov    0x10(%ebx),%eax
+  802b6c:	39 c2                	cmp    %eax,%edx
+  802b6e:	74 3c                	je     802bac <ipcring_rsp_wait+0x50>
+  802b70:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b73:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b76:	39 c2                	cmp    %eax,%edx
+  802b78:	75 23                	jne    802b9d <ipcring_rsp_wait+0x41>
+  802b7a:	83 ec 08             	sub    $0x8,%esp
+  802b7d:	6a 00                	push   $0x0
+  802b7f:	6a 00                	push   $0x0
+  802b81:	6a 00                	push   $0x0
+  802b83:	6a 00                	push   $0x0
+  802b85:	ff 73 0c             	push   0xc(%ebx)
+  802b88:	ff 73 04             	push   0x4(%ebx)
+  802b8b:	e8 81 03 00 00       	call   802f11 <ipc_call>
+  802b90:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b93:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b96:	83 c4 20             	add    $0x20,%esp
+  802b99:	39 c2                	cmp    %eax,%edx
+  802b9b:	74 dd                	je     802b7a <ipcring_rsp_wait+0x1e>
+  802b9d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ba0:	83 e0 07             	and    $0x7,%eax
+  802ba3:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802ba7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802baa:	c9                   	leave
+  802bab:	c3                   	ret
+  802bac:	68 f8 37 80 00       	push   $0x8037f8
+  802bb1:	68 a9 37 80 00       	push   $0x8037a9
+  802bb6:	6a 3b                	push   $0x3b
+  802bb8:	68 19 38 80 00       	push   $0x803819
+  802bbd:	e8 98 d6 ff ff       	call   80025a <_panic>
+
+00802bc2 <ipcring_rsp_pop>:
+  802bc2:	55                   	push   %ebp
+  802bc3:	89 e5                	mov    %esp,%ebp
+  802bc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bc8:	8b 42 18             	mov    0x18(%edx),%eax
+  802bcb:	83 c0 01             	add    $0x1,%eax
+  802bce:	89 42 18             	mov    %eax,0x18(%edx)
+  802bd1:	5d                   	pop    %ebp
+  802bd2:	c3                   	ret
+
+00802bd3 <ipcring_server_init>:
+  802bd3:	55                   	push   %ebp
+  802bd4:	89 e5                	mov    %esp,%ebp
+  802bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bdc:	89 10                	mov    %edx,(%eax)
+  802bde:	8b 55 10             	mov    0x10(%ebp),%edx
+  802be1:	89 50 04             	mov    %edx,0x4(%eax)
+  802be4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802beb:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802bf2:	5d                   	pop    %ebp
+  802bf3:	c3                   	ret
+
+00802bf4 <ipcring_req_avail>:
+  802bf4:	55                   	push   %ebp
+  802bf5:	89 e5                	mov    %esp,%ebp
+  802bf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bfa:	8b 02                	mov    (%edx),%eax
+  802bfc:	8b 40 10             	mov    0x10(%eax),%eax
+  802bff:	2b 42 08             	sub    0x8(%edx),%eax
+  802c02:	ba 08 00 00 00       	mov    $0x8,%edx
+  802c07:	39 d0                	cmp    %edx,%eax
+  802c09:	0f 47 c2             	cmova  %edx,%eax
+  802c0c:	5d                   	pop    %ebp
+  802c0d:	c3                   	ret
+
+00802c0e <ipcring_req_peek>:
+  802c0e:	55                   	push   %ebp
+  802c0f:	89 e5                	mov    %esp,%ebp
+  802c11:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c14:	8b 42 08             	mov    0x8(%edx),%eax
+  802c17:	83 e0 07             	and    $0x7,%eax
+  802c1a:	8b 12                	mov    (%edx),%edx
+  802c1c:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802c20:	5d                   	pop    %ebp
+  802c21:	c3                   	ret
+
+00802c22 <ipcring_rsp_push>:
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	83 ec 08             	sub    $0x8,%esp
+  802c28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c2b:	8b 41 08             	mov    0x8(%ecx),%eax
+  802c2e:	83 c0 01             	add    $0x1,%eax
+  802c31:	89 41 08             	mov    %eax,0x8(%ecx)
+  802c34:	8b 11                	mov    (%ecx),%edx
+  802c36:	83 c2 14             	add    $0x14,%edx
+  802c39:	f0 87 02             	lock xchg %eax,(%edx)
+  802c3c:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802c40:	75 02                	jne    802c44 <ipcring_rsp_push+0x22>
+  802c42:	c9                   	leave
+  802c43:	c3                   	ret
+  802c44:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802c4b:	6a 00                	push   $0x0
+  802c4d:	68 00 00 80 ee       	push   $0xee800000
+  802c52:	6a 00                	push   $0x0
+  802c54:	ff 71 04             	push   0x4(%ecx)
+  802c57:	e8 8b e4 ff ff       	call   8010e7 <sys_ipc_try_send>
+  802c5c:	83 c4 10             	add    $0x10,%esp
+  802c5f:	eb e1                	jmp    802c42 <ipcring_rsp_push+0x20>
+
+00802c61 <ipcring_client_wait>:
+  802c61:	55                   	push   %ebp
+  802c62:	89 e5                	mov    %esp,%ebp
+  802c64:	83 ec 08             	sub    $0x8,%esp
+  802c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6a:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802c71:	8b 10                	mov    (%eax),%edx
+  802c73:	8b 52 18             	mov    0x18(%edx),%edx
+  802c76:	3b 50 08             	cmp    0x8(%eax),%edx
+  802c79:	75 02                	jne    802c7d <ipcring_client_wait+0x1c>
+  802c7b:	c9                   	leave
+  802c7c:	c3                   	ret
+  802c7d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802c84:	6a 00                	push   $0x0
+  802c86:	68 00 00 80 ee       	push   $0xee800000
+  802c8b:	6a 00                	push   $0x0
+  802c8d:	ff 70 04             	push   0x4(%eax)
+  802c90:	e8 52 e4 ff ff       	call   8010e7 <sys_ipc_try_send>
+  802c95:	83 c4 10             	add    $0x10,%esp
+  802c98:	eb e1                	jmp    802c7b <ipcring_client_wait+0x1a>
+
+00802c9a <ipcring_server_sleep>:
+  802c9a:	55                   	push   %ebp
+  802c9b:	89 e5                	mov    %esp,%ebp
+  802c9d:	53                   	push   %ebx
+  802c9e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ca1:	8b 01                	mov    (%ecx),%eax
+  802ca3:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802ca6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cab:	f0 87 02             	lock xchg %eax,(%edx)
+  802cae:	8b 11                	mov    (%ecx),%edx
+  802cb0:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802cb3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cb8:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802cbb:	74 0e                	je     802ccb <ipcring_server_sleep+0x31>
+  802cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc2:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ccb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cce:	c9                   	leave
+  802ccf:	c3                   	ret
+
+00802cd0 <devcons_close>:
+  802cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd5:	c3                   	ret
+
+00802cd6 <devcons_stat>:
+  802cd6:	55                   	push   %ebp
+  802cd7:	89 e5                	mov    %esp,%ebp
+  802cd9:	83 ec 10             	sub    $0x10,%esp
+  802cdc:	68 27 38 80 00       	push   $0x803827
+  802ce1:	ff 75 0c             	push   0xc(%ebp)
+  802ce4:	e8 43 dd ff ff       	call   800a2c <strcpy>
+  802ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cee:	c9                   	leave
+  802cef:	c3                   	ret
+
+00802cf0 <devcons_write>:
+  802cf0:	55                   	push   %ebp
+  802cf1:	89 e5                	mov    %esp,%ebp
+  802cf3:	57                   	push   %edi
+  802cf4:	56                   	push   %esi
+  802cf5:	53                   	push   %ebx
+  802cf6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802cfc:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802cff:	85 ff                	test   %edi,%edi
+  802d01:	74 51                	je     802d54 <devcons_write+0x64>
+  802d03:	be 00 00 00 00       	mov    $0x0,%esi
+  802d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0d:	89 fb                	mov    %edi,%ebx
+  802d0f:	29 c3                	sub    %eax,%ebx
+  802d11:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802d16:	39 d3                	cmp    %edx,%ebx
+  802d18:	0f 47 da             	cmova  %edx,%ebx
+  802d1b:	83 ec 04             	sub    $0x4,%esp
+  802d1e:	53                   	push   %ebx
+  802d1f:	03 45 0c             	add    0xc(%ebp),%eax
+  802d22:	50                   	push   %eax
+  802d23:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d29:	50                   	push   %eax
+  802d2a:	e8 ad de ff ff       	call   800bdc <memmove>
+  802d2f:	83 c4 08             	add    $0x8,%esp
+  802d32:	53                   	push   %ebx
+  802d33:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d39:	50                   	push   %eax
+  802d3a:	e8 65 e0 ff ff       	call   800da4 <sys_cputs>
+  802d3f:	01 de                	add    %ebx,%esi
+  802d41:	89 f0                	mov    %esi,%eax
+  802d43:	83 c4 10             	add    $0x10,%esp
+  802d46:	39 fe                	cmp    %edi,%esi
+  802d48:	72 c3                	jb     802d0d <devcons_write+0x1d>
+  802d4a:	89 f0                	mov    %esi,%eax
+  802d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4f:	5b                   	pop    %ebx
+  802d50:	5e                   	pop    %esi
+  802d51:	5f                   	pop    %edi
+  802d52:	5d                   	pop    %ebp
+  802d53:	c3                   	ret
+  802d54:	be 00 00 00 00       	mov    $0x0,%esi
+  802d59:	eb ef                	jmp    802d4a <devcons_write+0x5a>
+
+00802d5b <devcons_read>:
+  802d5b:	55                   	push   %ebp
+  802d5c:	89 e5                	mov    %esp,%ebp
+  802d5e:	83 ec 08             	sub    $0x8,%esp
+  802d61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d66:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d6a:	75 07                	jne    802d73 <devcons_read+0x18>
+  802d6c:	eb 1f                	jmp    802d8d <devcons_read+0x32>
+  802d6e:	e8 ce e0 ff ff       	call   800e41 <sys_yield>
+  802d73:	e8 4a e0 ff ff       	call   800dc2 <sys_cgetc>
+  802d78:	85 c0                	test   %eax,%eax
+  802d7a:	74 f2                	je     802d6e <devcons_read+0x13>
+  802d7c:	78 0f                	js     802d8d <devcons_read+0x32>
+  802d7e:	83 f8 04             	cmp    $0x4,%eax
+  802d81:	74 0c                	je     802d8f <devcons_read+0x34>
+  802d83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d86:	88 02                	mov    %al,(%edx)
+  802d88:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d8d:	c9                   	leave
+  802d8e:	c3                   	ret
+  802d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d94:	eb f7                	jmp    802d8d <devcons_read+0x32>
+
+00802d96 <cputchar>:
+  802d96:	55                   	push   %ebp
+  802d97:	89 e5                	mov    %esp,%ebp
+  802d99:	83 ec 20             	sub    $0x20,%esp
+  802d9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9f:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802da2:	6a 01                	push   $0x1
+  802da4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802da7:	50                   	push   %eax
+  802da8:	e8 f7 df ff ff       	call   800da4 <sys_cputs>
+  802dad:	83 c4 10             	add    $0x10,%esp
+  802db0:	c9                   	leave
+  802db1:	c3                   	ret
+
+00802db2 <getchar>:
+  802db2:	55                   	push   %ebp
+  802db3:	89 e5                	mov    %esp,%ebp
+  802db5:	83 ec 1c             	sub    $0x1c,%esp
+  802db8:	6a 01                	push   $0x1
+  802dba:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802dbd:	50                   	push   %eax
+  802dbe:	6a 00                	push   $0x0
+  802dc0:	e8 0e ec ff ff       	call   8019d3 <read>
+  802dc5:	83 c4 10             	add    $0x10,%esp
+  802dc8:	85 c0                	test   %eax,%eax
+  802dca:	78 06                	js     802dd2 <getchar+0x20>
+  802dcc:	74 06                	je     802dd4 <getchar+0x22>
+  802dce:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802dd2:	c9                   	leave
+  802dd3:	c3                   	ret
+  802dd4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802dd9:	eb f7                	jmp    802dd2 <getchar+0x20>
+
+00802ddb <iscons>:
+  802ddb:	55                   	push   %ebp
+  802ddc:	89 e5                	mov    %esp,%ebp
+  802dde:	83 ec 20             	sub    $0x20,%esp
+  802de1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802de4:	50                   	push   %eax
+  802de5:	ff 75 08             	push   0x8(%ebp)
+  802de8:	e8 84 e9 ff ff       	call   801771 <fd_lookup>
+  802ded:	83 c4 10             	add    $0x10,%esp
+  802df0:	85 c0                	test   %eax,%eax
+  802df2:	78 11                	js     802e05 <iscons+0x2a>
+  802df4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802df7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802dfd:	39 10                	cmp    %edx,(%eax)
+  802dff:	0f 94 c0             	sete   %al
+  802e02:	0f b6 c0             	movzbl %al,%eax
+  802e05:	c9                   	leave
+  802e06:	c3                   	ret
+
+00802e07 <opencons>:
+  802e07:	55                   	push   %ebp
+  802e08:	89 e5                	mov    %esp,%ebp
+  802e0a:	83 ec 24             	sub    $0x24,%esp
+  802e0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e10:	50                   	push   %eax
+  802e11:	e8 0b e9 ff ff       	call   801721 <fd_alloc>
+  802e16:	83 c4 10             	add    $0x10,%esp
+  802e19:	85 c0                	test   %eax,%eax
+  802e1b:	78 3a                	js     802e57 <opencons+0x50>
+  802e1d:	83 ec 04             	sub    $0x4,%esp
+  802e20:	68 07 04 00 00       	push   $0x407
+  802e25:	ff 75 f4             	push   -0xc(%ebp)
+  802e28:	6a 00                	push   $0x0
+  802e2a:	e8 5d e0 ff ff       	call   800e8c <sys_page_alloc>
+  802e2f:	83 c4 10             	add    $0x10,%esp
+  802e32:	85 c0                	test   %eax,%eax
+  802e34:	78 21                	js     802e57 <opencons+0x50>
+  802e36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e39:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802e3f:	89 10                	mov    %edx,(%eax)
+  802e41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e44:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802e4b:	83 ec 0c             	sub    $0xc,%esp
+  802e4e:	50                   	push   %eax
+  802e4f:	e8 a6 e8 ff ff       	call   8016fa <fd2num>
+  802e54:	83 c4 10             	add    $0x10,%esp
+  802e57:	c9                   	leave
+  802e58:	c3                   	ret
+
+00802e59 <ipc_recv>:
+  802e59:	55                   	push   %ebp
+  802e5a:	89 e5                	mov    %esp,%ebp
+  802e5c:	56                   	push   %esi
+  802e5d:	53                   	push   %ebx
+  802e5e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e61:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e67:	85 c0                	test   %eax,%eax
+  802e69:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802e6e:	0f 44 c2             	cmove  %edx,%eax
+  802e71:	83 ec 0c             	sub    $0xc,%esp
+  802e74:	50                   	push   %eax
+  802e75:	e8 bd e2 ff ff       	call   801137 <sys_ipc_recv>
+  802e7a:	83 c4 10             	add    $0x10,%esp
+  802e7d:	85 c0                	test   %eax,%eax
+  802e7f:	78 2a                	js     802eab <ipc_recv+0x52>
+  802e81:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e86:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802e8c:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802e92:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e98:	85 f6                	test   %esi,%esi
+  802e9a:	74 02                	je     802e9e <ipc_recv+0x45>
+  802e9c:	89 0e                	mov    %ecx,(%esi)
+  802e9e:	85 db                	test   %ebx,%ebx
+  802ea0:	74 02                	je     802ea4 <ipc_recv+0x4b>
+  802ea2:	89 13                	mov    %edx,(%ebx)
+  802ea4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ea7:	5b                   	pop    %ebx
+  802ea8:	5e                   	pop    %esi
+  802ea9:	5d                   	pop    %ebp
+  802eaa:	c3                   	ret
+  802eab:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eb5:	eb e1                	jmp    802e98 <ipc_recv+0x3f>
+
+00802eb7 <ipc_send>:
+  802eb7:	55                   	push   %ebp
+  802eb8:	89 e5                	mov    %esp,%ebp
+  802eba:	57                   	push   %edi
+  802ebb:	56                   	push   %esi
+  802ebc:	53                   	push   %ebx
+  802ebd:	83 ec 0c             	sub    $0xc,%esp
+  802ec0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802ec3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ec6:	8b 75 14             	mov    0x14(%ebp),%esi
+  802ec9:	85 db                	test   %ebx,%ebx
+  802ecb:	74 1e                	je     802eeb <ipc_send+0x34>
+  802ecd:	56                   	push   %esi
+  802ece:	53                   	push   %ebx
+  802ecf:	57                   	push   %edi
+  802ed0:	ff 75 08             	push   0x8(%ebp)
+  802ed3:	e8 ec e2 ff ff       	call   8011c4 <sys_ipc_send>
+  802ed8:	83 c4 10             	add    $0x10,%esp
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	74 2a                	je     802f09 <ipc_send+0x52>
+  802edf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ee2:	75 13                	jne    802ef7 <ipc_send+0x40>
+  802ee4:	e8 58 df ff ff       	call   800e41 <sys_yield>
+  802ee9:	eb e2                	jmp    802ecd <ipc_send+0x16>
+  802eeb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef0:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802ef5:	eb d6                	jmp    802ecd <ipc_send+0x16>
+  802ef7:	50                   	push   %eax
+  802ef8:	68 34 38 80 00       	push   $0x803834
+  802efd:	6a 4f                	push   $0x4f
+  802eff:	68 77 38 80 00       	push   $0x803877
+  802f04:	e8 51 d3 ff ff       	call   80025a <_panic>
+  802f09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f0c:	5b                   	pop    %ebx
+  802f0d:	5e                   	pop    %esi
+  802f0e:	5f                   	pop    %edi
+  802f0f:	5d                   	pop    %ebp
+  802f10:	c3                   	ret
+
+00802f11 <ipc_call>:
+  802f11:	55                   	push   %ebp
+  802f12:	89 e5                	mov    %esp,%ebp
+  802f14:	57                   	push   %edi
+  802f15:	56                   	push   %esi
+  802f16:	53                   	push   %ebx
+  802f17:	83 ec 0c             	sub    $0xc,%esp
+  802f1a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f1e:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802f23:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802f27:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f2b:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802f30:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802f34:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f3d:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802f41:	eb 05                	jmp    802f48 <ipc_call+0x37>
+  802f43:	e8 f9 de ff ff       	call   800e41 <sys_yield>
+  802f48:	83 ec 0c             	sub    $0xc,%esp
+  802f4b:	56                   	push   %esi
+  802f4c:	53                   	push   %ebx
+  802f4d:	57                   	push   %edi
+  802f4e:	ff 75 0c             	push   0xc(%ebp)
+  802f51:	ff 75 08             	push   0x8(%ebp)
+  802f54:	e8 bb e2 ff ff       	call   801214 <sys_ipc_call>
+  802f59:	83 c4 20             	add    $0x20,%esp
+  802f5c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f5f:	74 e2                	je     802f43 <ipc_call+0x32>
+  802f61:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802f64:	74 2d                	je     802f93 <ipc_call+0x82>
+  802f66:	85 c0                	test   %eax,%eax
+  802f68:	78 4f                	js     802fb9 <ipc_call+0xa8>
+  802f6a:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802f6e:	74 10                	je     802f80 <ipc_call+0x6f>
+  802f70:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f75:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f7b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802f7e:	89 02                	mov    %eax,(%edx)
+  802f80:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f85:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f8e:	5b                   	pop    %ebx
+  802f8f:	5e                   	pop    %esi
+  802f90:	5f                   	pop    %edi
+  802f91:	5d                   	pop    %ebp
+  802f92:	c3                   	ret
+  802f93:	ff 75 14             	push   0x14(%ebp)
+  802f96:	ff 75 10             	push   0x10(%ebp)
+  802f99:	ff 75 0c             	push   0xc(%ebp)
+  802f9c:	ff 75 08             	push   0x8(%ebp)
+  802f9f:	e8 13 ff ff ff       	call   802eb7 <ipc_send>
+  802fa4:	83 c4 0c             	add    $0xc,%esp
+  802fa7:	ff 75 1c             	push   0x1c(%ebp)
+  802faa:	ff 75 18             	push   0x18(%ebp)
+  802fad:	6a 00                	push   $0x0
+  802faf:	e8 a5 fe ff ff       	call   802e59 <ipc_recv>
+  802fb4:	83 c4 10             	add    $0x10,%esp
+  802fb7:	eb d2                	jmp    802f8b <ipc_call+0x7a>
+  802fb9:	50                   	push   %eax
+  802fba:	68 81 38 80 00       	push   $0x803881
+  802fbf:	6a 6d                	push   $0x6d
+  802fc1:	68 77 38 80 00       	push   $0x803877
+  802fc6:	e8 8f d2 ff ff       	call   80025a <_panic>
+
+00802fcb <ipc_reply_recv>:
+  802fcb:	55                   	push   %ebp
+  802fcc:	89 e5                	mov    %esp,%ebp
+  802fce:	57                   	push   %edi
+  802fcf:	56                   	push   %esi
+  802fd0:	53                   	push   %ebx
+  802fd1:	83 ec 0c             	sub    $0xc,%esp
+  802fd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fd7:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802fda:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802fdd:	85 db                	test   %ebx,%ebx
+  802fdf:	0f 84 ac 00 00 00    	je     803091 <ipc_reply_recv+0xc6>
+  802fe5:	85 f6                	test   %esi,%esi
+  802fe7:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802fec:	0f 45 c6             	cmovne %esi,%eax
+  802fef:	83 ec 0c             	sub    $0xc,%esp
+  802ff2:	50                   	push   %eax
+  802ff3:	ff 75 14             	push   0x14(%ebp)
+  802ff6:	53                   	push   %ebx
+  802ff7:	ff 75 0c             	push   0xc(%ebp)
+  802ffa:	ff 75 08             	push   0x8(%ebp)
+  802ffd:	e8 33 e2 ff ff       	call   801235 <sys_ipc_reply_recv>
+  803002:	83 c4 20             	add    $0x20,%esp
+  803005:	85 c0                	test   %eax,%eax
+  803007:	78 3a                	js     803043 <ipc_reply_recv+0x78>
+  803009:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80300d:	74 10                	je     80301f <ipc_reply_recv+0x54>
+  80300f:	a1 10 50 80 00       	mov    0x805010,%eax
+  803014:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  80301a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80301d:	89 02                	mov    %eax,(%edx)
+  80301f:	85 ff                	test   %edi,%edi
+  803021:	74 0d                	je     803030 <ipc_reply_recv+0x65>
+  803023:	a1 10 50 80 00       	mov    0x805010,%eax
+  803028:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80302e:	89 07                	mov    %eax,(%edi)
+  803030:	a1 10 50 80 00       	mov    0x805010,%eax
+  803035:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80303b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80303e:	5b                   	pop    %ebx
+  80303f:	5e                   	pop    %esi
+  803040:	5f                   	pop    %edi
+  803041:	5d                   	pop    %ebp
+  803042:	c3                   	ret
+  803043:	ff 75 14             	push   0x14(%ebp)
+  803046:	53                   	push   %ebx
+  803047:	ff 75 0c             	push   0xc(%ebp)
+  80304a:	ff 75 08             	push   0x8(%ebp)
+  80304d:	e8 95 e0 ff ff       	call   8010e7 <sys_ipc_try_send>
+  803052:	89 c2                	mov    %eax,%edx
+  803054:	c1 ea 1f             	shr    $0x1f,%edx
+  803057:	83 c4 10             	add    $0x10,%esp
+  80305a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80305d:	0f 95 c1             	setne  %cl
+  803060:	84 d1                	test   %dl,%cl
+  803062:	74 05                	je     803069 <ipc_reply_recv+0x9e>
+  803064:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803067:	75 12                	jne    80307b <ipc_reply_recv+0xb0>
+  803069:	83 ec 04             	sub    $0x4,%esp
+  80306c:	57                   	push   %edi
+  80306d:	56                   	push   %esi
+  80306e:	ff 75 18             	push   0x18(%ebp)
+  803071:	e8 e3 fd ff ff       	call   802e59 <ipc_recv>
+  803076:	83 c4 10             	add    $0x10,%esp
+  803079:	eb c0                	jmp    80303b <ipc_reply_recv+0x70>
+  80307b:	83 ec 04             	sub    $0x4,%esp
+  80307e:	50                   	push   %eax
+  80307f:	ff 75 08             	push   0x8(%ebp)
+  803082:	68 54 38 80 00       	push   $0x803854
+  803087:	e8 a9 d2 ff ff       	call   800335 <cprintf>
+  80308c:	83 c4 10             	add    $0x10,%esp
+  80308f:	eb d8                	jmp    803069 <ipc_reply_recv+0x9e>
+  803091:	85 f6                	test   %esi,%esi
+  803093:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803098:	0f 45 c6             	cmovne %esi,%eax
+  80309b:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8030a0:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8030a7:	e9 43 ff ff ff       	jmp    802fef <ipc_reply_recv+0x24>
+
+008030ac <ipc_find_env>:
+  8030ac:	55                   	push   %ebp
+  8030ad:	89 e5                	mov    %esp,%ebp
+  8030af:	83 ec 14             	sub    $0x14,%esp
+  8030b2:	ff 75 08             	push   0x8(%ebp)
+  8030b5:	e8 cb df ff ff       	call   801085 <sys_env_service>
+  8030ba:	85 c0                	test   %eax,%eax
+  8030bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c1:	0f 48 c2             	cmovs  %edx,%eax
+  8030c4:	c9                   	leave
+  8030c5:	c3                   	ret
+
+008030c6 <pageref>:
+  8030c6:	55                   	push   %ebp
+  8030c7:	89 e5                	mov    %esp,%ebp
+  8030c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030cc:	89 c2                	mov    %eax,%edx
+  8030ce:	c1 ea 16             	shr    $0x16,%edx
+  8030d1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8030d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030dd:	f6 c1 01             	test   $0x1,%cl
+  8030e0:	74 22                	je     803104 <pageref+0x3e>
+  8030e2:	c1 e8 0c             	shr    $0xc,%eax
+  8030e5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030ec:	a8 01                	test   $0x1,%al
+  8030ee:	74 14                	je     803104 <pageref+0x3e>
+  8030f0:	c1 e8 0c             	shr    $0xc,%eax
+  8030f3:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8030f6:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8030fd:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803101:	0f b7 d2             	movzwl %dx,%edx
+  803104:	89 d0                	mov    %edx,%eax
+  803106:	5d                   	pop    %ebp
+  803107:	c3                   	ret
+
+00803108 <__udivmoddi4>:
+  803108:	55                   	push   %ebp
+  803109:	57                   	push   %edi
+  80310a:	56                   	push   %esi
+  80310b:	53                   	push   %ebx
+  80310c:	83 ec 24             	sub    $0x24,%esp
+  80310f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803113:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803117:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80311b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80311f:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803123:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803127:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80312b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80312f:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803133:	b8 00 00 00 00       	mov    $0x0,%eax
+  803138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803142:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803149:	00 
+  80314a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803151:	00 
+  803152:	89 fb                	mov    %edi,%ebx
+  803154:	eb 08                	jmp    80315e <__udivmoddi4+0x56>
+  803156:	83 e9 01             	sub    $0x1,%ecx
+  803159:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80315c:	74 68                	je     8031c6 <__udivmoddi4+0xbe>
+  80315e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803162:	01 c0                	add    %eax,%eax
+  803164:	89 c6                	mov    %eax,%esi
+  803166:	89 d7                	mov    %edx,%edi
+  803168:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80316c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803170:	0f ad d0             	shrd   %cl,%edx,%eax
+  803173:	d3 ea                	shr    %cl,%edx
+  803175:	f6 c1 20             	test   $0x20,%cl
+  803178:	74 04                	je     80317e <__udivmoddi4+0x76>
+  80317a:	89 d0                	mov    %edx,%eax
+  80317c:	31 d2                	xor    %edx,%edx
+  80317e:	83 e0 01             	and    $0x1,%eax
+  803181:	89 04 24             	mov    %eax,(%esp)
+  803184:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80318b:	00 
+  80318c:	8b 04 24             	mov    (%esp),%eax
+  80318f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803193:	09 f0                	or     %esi,%eax
+  803195:	09 fa                	or     %edi,%edx
+  803197:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80319b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80319f:	39 f0                	cmp    %esi,%eax
+  8031a1:	89 d5                	mov    %edx,%ebp
+  8031a3:	19 fd                	sbb    %edi,%ebp
+  8031a5:	72 af                	jb     803156 <__udivmoddi4+0x4e>
+  8031a7:	29 f0                	sub    %esi,%eax
+  8031a9:	19 fa                	sbb    %edi,%edx
+  8031ab:	89 cf                	mov    %ecx,%edi
+  8031ad:	c1 ef 05             	shr    $0x5,%edi
+  8031b0:	83 e7 01             	and    $0x1,%edi
+  8031b3:	89 fe                	mov    %edi,%esi
+  8031b5:	83 f6 01             	xor    $0x1,%esi
+  8031b8:	d3 e6                	shl    %cl,%esi
+  8031ba:	d3 e7                	shl    %cl,%edi
+  8031bc:	09 74 24 18          	or     %esi,0x18(%esp)
+  8031c0:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8031c4:	eb 90                	jmp    803156 <__udivmoddi4+0x4e>
+  8031c6:	85 db                	test   %ebx,%ebx
+  8031c8:	74 05                	je     8031cf <__udivmoddi4+0xc7>
+  8031ca:	89 03                	mov    %eax,(%ebx)
+  8031cc:	89 53 04             	mov    %edx,0x4(%ebx)
+  8031cf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8031d3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8031d7:	83 c4 24             	add    $0x24,%esp
+  8031da:	5b                   	pop    %ebx
+  8031db:	5e                   	pop    %esi
+  8031dc:	5f                   	pop    %edi
+  8031dd:	5d                   	pop    %ebp
+  8031de:	c3                   	ret
+
+008031df <__udivdi3>:
+  8031df:	83 ec 08             	sub    $0x8,%esp
+  8031e2:	6a 00                	push   $0x0
+  8031e4:	ff 74 24 1c          	push   0x1c(%esp)
+  8031e8:	ff 74 24 1c          	push   0x1c(%esp)
+  8031ec:	ff 74 24 1c          	push   0x1c(%esp)
+  8031f0:	ff 74 24 1c          	push   0x1c(%esp)
+  8031f4:	e8 0f ff ff ff       	call   803108 <__udivmoddi4>
+  8031f9:	83 c4 1c             	add    $0x1c,%esp
+  8031fc:	c3                   	ret
+
+008031fd <__umoddi3>:
+  8031fd:	83 ec 18             	sub    $0x18,%esp
+  803200:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803204:	50                   	push   %eax
+  803205:	ff 74 24 2c          	push   0x2c(%esp)
+  803209:	ff 74 24 2c          	push   0x2c(%esp)
+  80320d:	ff 74 24 2c          	push   0x2c(%esp)
+  803211:	ff 74 24 2c          	push   0x2c(%esp)
+  803215:	e8 ee fe ff ff       	call   803108 <__udivmoddi4>
+  80321a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80321e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803222:	83 c4 2c             	add    $0x2c,%esp
+  803225:	c3                   	ret
+
+00803226 <__divdi3>:
+  803226:	53                   	push   %ebx
+  803227:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80322b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80322f:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803233:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803237:	85 d2                	test   %edx,%edx
+  803239:	78 12                	js     80324d <__divdi3+0x27>
+  80323b:	85 db                	test   %ebx,%ebx
+  80323d:	78 2e                	js     80326d <__divdi3+0x47>
+  80323f:	53                   	push   %ebx
+  803240:	51                   	push   %ecx
+  803241:	52                   	push   %edx
+  803242:	50                   	push   %eax
+  803243:	e8 97 ff ff ff       	call   8031df <__udivdi3>
+  803248:	83 c4 10             	add    $0x10,%esp
+  80324b:	eb 1e                	jmp    80326b <__divdi3+0x45>
+  80324d:	f7 d8                	neg    %eax
+  80324f:	83 d2 00             	adc    $0x0,%edx
+  803252:	f7 da                	neg    %edx
+  803254:	85 db                	test   %ebx,%ebx
+  803256:	78 2a                	js     803282 <__divdi3+0x5c>
+  803258:	53                   	push   %ebx
+  803259:	51                   	push   %ecx
+  80325a:	52                   	push   %edx
+  80325b:	50                   	push   %eax
+  80325c:	e8 7e ff ff ff       	call   8031df <__udivdi3>
+  803261:	83 c4 10             	add    $0x10,%esp
+  803264:	f7 d8                	neg    %eax
+  803266:	83 d2 00             	adc    $0x0,%edx
+  803269:	f7 da                	neg    %edx
+  80326b:	5b                   	pop    %ebx
+  80326c:	c3                   	ret
+  80326d:	f7 d9                	neg    %ecx
+  80326f:	83 d3 00             	adc    $0x0,%ebx
+  803272:	f7 db                	neg    %ebx
+  803274:	53                   	push   %ebx
+  803275:	51                   	push   %ecx
+  803276:	52                   	push   %edx
+  803277:	50                   	push   %eax
+  803278:	e8 62 ff ff ff       	call   8031df <__udivdi3>
+  80327d:	83 c4 10             	add    $0x10,%esp
+  803280:	eb e2                	jmp    803264 <__divdi3+0x3e>
+  803282:	f7 d9                	neg    %ecx
+  803284:	83 d3 00             	adc    $0x0,%ebx
+  803287:	f7 db                	neg    %ebx
+  803289:	53                   	push   %ebx
+  80328a:	51                   	push   %ecx
+  80328b:	52                   	push   %edx
+  80328c:	50                   	push   %eax
+  80328d:	e8 4d ff ff ff       	call   8031df <__udivdi3>
+  803292:	83 c4 10             	add    $0x10,%esp
+  803295:	eb d4                	jmp    80326b <__divdi3+0x45>
+
+00803297 <__moddi3>:
+  803297:	55                   	push   %ebp
+  803298:	57                   	push   %edi
+  803299:	56                   	push   %esi
+  80329a:	53                   	push   %ebx
+  80329b:	83 ec 0c             	sub    $0xc,%esp
+  80329e:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8032a2:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8032a6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8032aa:	89 e9                	mov    %ebp,%ecx
+  8032ac:	f7 d9                	neg    %ecx
+  8032ae:	89 d0                	mov    %edx,%eax
+  8032b0:	83 d0 00             	adc    $0x0,%eax
+  8032b3:	f7 d8                	neg    %eax
+  8032b5:	0f 49 e9             	cmovns %ecx,%ebp
+  8032b8:	0f 49 d0             	cmovns %eax,%edx
+  8032bb:	52                   	push   %edx
+  8032bc:	55                   	push   %ebp
+  8032bd:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8032c1:	f7 da                	neg    %edx
+  8032c3:	89 d8                	mov    %ebx,%eax
+  8032c5:	83 d0 00             	adc    $0x0,%eax
+  8032c8:	f7 d8                	neg    %eax
+  8032ca:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8032cf:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8032d3:	0f 48 c3             	cmovs  %ebx,%eax
+  8032d6:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8032da:	ff 74 24 0c          	push   0xc(%esp)
+  8032de:	ff 74 24 0c          	push   0xc(%esp)
+  8032e2:	e8 16 ff ff ff       	call   8031fd <__umoddi3>
+  8032e7:	83 c4 10             	add    $0x10,%esp
+  8032ea:	85 db                	test   %ebx,%ebx
+  8032ec:	78 08                	js     8032f6 <__moddi3+0x5f>
+  8032ee:	83 c4 0c             	add    $0xc,%esp
+  8032f1:	5b                   	pop    %ebx
+  8032f2:	5e                   	pop    %esi
+  8032f3:	5f                   	pop    %edi
+  8032f4:	5d                   	pop    %ebp
+  8032f5:	c3                   	ret
+  8032f6:	f7 d8                	neg    %eax
+  8032f8:	83 d2 00             	adc    $0x0,%edx
+  8032fb:	f7 da                	neg    %edx
+  8032fd:	eb ef                	jmp    8032ee <__moddi3+0x57>
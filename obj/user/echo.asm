@@ -0,0 +1,5092 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800042:	83 ff 01             	cmp    $0x1,%edi
+  800045:	7f 16                	jg     80005d <umain+0x2a>
+  800047:	83 ec 04             	sub    $0x4,%esp
+  80004a:	6a 01                	push   $0x1
+  80004c:	68 52 33 80 00       	push   $0x803352
+  800051:	6a 01                	push   $0x1
+  800053:	e8 d3 11 00 00       	call   80122b <write>
+  800058:	83 c4 10             	add    $0x10,%esp
+  80005b:	eb 7f                	jmp    8000dc <umain+0xa9>
+  80005d:	83 ec 08             	sub    $0x8,%esp
+  800060:	68 20 32 80 00       	push   $0x803220
+  800065:	ff 76 04             	push   0x4(%esi)
+  800068:	e8 ec 01 00 00       	call   800259 <strcmp>
+  80006d:	83 c4 10             	add    $0x10,%esp
+  800070:	85 c0                	test   %eax,%eax
+  800072:	75 55                	jne    8000c9 <umain+0x96>
+  800074:	83 ef 01             	sub    $0x1,%edi
+  800077:	83 c6 04             	add    $0x4,%esi
+  80007a:	83 ff 01             	cmp    $0x1,%edi
+  80007d:	7e 5d                	jle    8000dc <umain+0xa9>
+  80007f:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800086:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80008b:	83 ec 0c             	sub    $0xc,%esp
+  80008e:	ff 34 9e             	push   (%esi,%ebx,4)
+  800091:	e8 c7 00 00 00       	call   80015d <strlen>
+  800096:	83 c4 0c             	add    $0xc,%esp
+  800099:	50                   	push   %eax
+  80009a:	ff 34 9e             	push   (%esi,%ebx,4)
+  80009d:	6a 01                	push   $0x1
+  80009f:	e8 87 11 00 00       	call   80122b <write>
+  8000a4:	83 c3 01             	add    $0x1,%ebx
+  8000a7:	83 c4 10             	add    $0x10,%esp
+  8000aa:	39 fb                	cmp    %edi,%ebx
+  8000ac:	7d 24                	jge    8000d2 <umain+0x9f>
+  8000ae:	83 fb 01             	cmp    $0x1,%ebx
+  8000b1:	7e d8                	jle    80008b <umain+0x58>
+  8000b3:	83 ec 04             	sub    $0x4,%esp
+  8000b6:	6a 01                	push   $0x1
+  8000b8:	68 23 32 80 00       	push   $0x803223
+  8000bd:	6a 01                	push   $0x1
+  8000bf:	e8 67 11 00 00       	call   80122b <write>
+  8000c4:	83 c4 10             	add    $0x10,%esp
+  8000c7:	eb c2                	jmp    80008b <umain+0x58>
+  8000c9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8000d0:	eb b4                	jmp    800086 <umain+0x53>
+  8000d2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000d6:	0f 84 6b ff ff ff    	je     800047 <umain+0x14>
+  8000dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5f                   	pop    %edi
+  8000e2:	5d                   	pop    %ebp
+  8000e3:	c3                   	ret
+
+008000e4 <libmain>:
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ef:	e8 ab 04 00 00       	call   80059f <sys_getenvid>
+  8000f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f9:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800104:	a3 10 50 80 00       	mov    %eax,0x805010
+  800109:	85 db                	test   %ebx,%ebx
+  80010b:	7e 07                	jle    800114 <libmain+0x30>
+  80010d:	8b 06                	mov    (%esi),%eax
+  80010f:	a3 00 40 80 00       	mov    %eax,0x804000
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	e8 15 ff ff ff       	call   800033 <umain>
+  80011e:	e8 0a 00 00 00       	call   80012d <exit>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5d                   	pop    %ebp
+  80012c:	c3                   	ret
+
+0080012d <exit>:
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	a1 10 50 80 00       	mov    0x805010,%eax
+  800138:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80013e:	85 c0                	test   %eax,%eax
+  800140:	75 14                	jne    800156 <exit+0x29>
+  800142:	e8 fa 0e 00 00       	call   801041 <close_all>
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	6a 00                	push   $0x0
+  80014c:	e8 0d 04 00 00       	call   80055e <sys_env_destroy>
+  800151:	83 c4 10             	add    $0x10,%esp
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+  800156:	e8 70 0b 00 00       	call   800ccb <sys_lease_complete>
+  80015b:	eb e5                	jmp    800142 <exit+0x15>
+
+0080015d <strlen>:
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	8b 55 08             	mov    0x8(%ebp),%edx
+  800163:	80 3a 00             	cmpb   $0x0,(%edx)
+  800166:	74 10                	je     800178 <strlen+0x1b>
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	83 c0 01             	add    $0x1,%eax
+  800170:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800174:	75 f7                	jne    80016d <strlen+0x10>
+  800176:	5d                   	pop    %ebp
+  800177:	c3                   	ret
+  800178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017d:	eb f7                	jmp    800176 <strlen+0x19>
+
+0080017f <strnlen>:
+  80017f:	55                   	push   %ebp
+  800180:	89 e5                	mov    %esp,%ebp
+  800182:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	85 d2                	test   %edx,%edx
+  80018a:	74 16                	je     8001a2 <strnlen+0x23>
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800195:	74 09                	je     8001a0 <strnlen+0x21>
+  800197:	83 c0 01             	add    $0x1,%eax
+  80019a:	39 d0                	cmp    %edx,%eax
+  80019c:	75 f3                	jne    800191 <strnlen+0x12>
+  80019e:	89 d0                	mov    %edx,%eax
+  8001a0:	5d                   	pop    %ebp
+  8001a1:	c3                   	ret
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	eb f7                	jmp    8001a0 <strnlen+0x21>
+
+008001a9 <strcpy>:
+  8001a9:	55                   	push   %ebp
+  8001aa:	89 e5                	mov    %esp,%ebp
+  8001ac:	53                   	push   %ebx
+  8001ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8001bc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8001bf:	83 c0 01             	add    $0x1,%eax
+  8001c2:	84 d2                	test   %dl,%dl
+  8001c4:	75 f2                	jne    8001b8 <strcpy+0xf>
+  8001c6:	89 c8                	mov    %ecx,%eax
+  8001c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001cb:	c9                   	leave
+  8001cc:	c3                   	ret
+
+008001cd <strcat>:
+  8001cd:	55                   	push   %ebp
+  8001ce:	89 e5                	mov    %esp,%ebp
+  8001d0:	53                   	push   %ebx
+  8001d1:	83 ec 10             	sub    $0x10,%esp
+  8001d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d7:	53                   	push   %ebx
+  8001d8:	e8 80 ff ff ff       	call   80015d <strlen>
+  8001dd:	83 c4 08             	add    $0x8,%esp
+  8001e0:	ff 75 0c             	push   0xc(%ebp)
+  8001e3:	01 d8                	add    %ebx,%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 be ff ff ff       	call   8001a9 <strcpy>
+  8001eb:	89 d8                	mov    %ebx,%eax
+  8001ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+
+008001f2 <strncpy>:
+  8001f2:	55                   	push   %ebp
+  8001f3:	89 e5                	mov    %esp,%ebp
+  8001f5:	56                   	push   %esi
+  8001f6:	53                   	push   %ebx
+  8001f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800200:	85 db                	test   %ebx,%ebx
+  800202:	74 17                	je     80021b <strncpy+0x29>
+  800204:	01 f3                	add    %esi,%ebx
+  800206:	89 f0                	mov    %esi,%eax
+  800208:	83 c0 01             	add    $0x1,%eax
+  80020b:	0f b6 0a             	movzbl (%edx),%ecx
+  80020e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800211:	80 f9 01             	cmp    $0x1,%cl
+  800214:	83 da ff             	sbb    $0xffffffff,%edx
+  800217:	39 c3                	cmp    %eax,%ebx
+  800219:	75 ed                	jne    800208 <strncpy+0x16>
+  80021b:	89 f0                	mov    %esi,%eax
+  80021d:	5b                   	pop    %ebx
+  80021e:	5e                   	pop    %esi
+  80021f:	5d                   	pop    %ebp
+  800220:	c3                   	ret
+
+00800221 <strlcpy>:
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	56                   	push   %esi
+  800225:	53                   	push   %ebx
+  800226:	8b 75 08             	mov    0x8(%ebp),%esi
+  800229:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80022c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80022f:	89 f0                	mov    %esi,%eax
+  800231:	85 db                	test   %ebx,%ebx
+  800233:	74 1e                	je     800253 <strlcpy+0x32>
+  800235:	83 eb 01             	sub    $0x1,%ebx
+  800238:	74 16                	je     800250 <strlcpy+0x2f>
+  80023a:	01 f3                	add    %esi,%ebx
+  80023c:	0f b6 0a             	movzbl (%edx),%ecx
+  80023f:	84 c9                	test   %cl,%cl
+  800241:	74 0d                	je     800250 <strlcpy+0x2f>
+  800243:	83 c2 01             	add    $0x1,%edx
+  800246:	83 c0 01             	add    $0x1,%eax
+  800249:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80024c:	39 d8                	cmp    %ebx,%eax
+  80024e:	75 ec                	jne    80023c <strlcpy+0x1b>
+  800250:	c6 00 00             	movb   $0x0,(%eax)
+  800253:	29 f0                	sub    %esi,%eax
+  800255:	5b                   	pop    %ebx
+  800256:	5e                   	pop    %esi
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+
+00800259 <strcmp>:
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80025f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800262:	0f b6 01             	movzbl (%ecx),%eax
+  800265:	84 c0                	test   %al,%al
+  800267:	74 11                	je     80027a <strcmp+0x21>
+  800269:	38 02                	cmp    %al,(%edx)
+  80026b:	75 0d                	jne    80027a <strcmp+0x21>
+  80026d:	83 c1 01             	add    $0x1,%ecx
+  800270:	83 c2 01             	add    $0x1,%edx
+  800273:	0f b6 01             	movzbl (%ecx),%eax
+  800276:	84 c0                	test   %al,%al
+  800278:	75 ef                	jne    800269 <strcmp+0x10>
+  80027a:	0f b6 c0             	movzbl %al,%eax
+  80027d:	0f b6 12             	movzbl (%edx),%edx
+  800280:	29 d0                	sub    %edx,%eax
+  800282:	5d                   	pop    %ebp
+  800283:	c3                   	ret
+
+00800284 <strncmp>:
+  800284:	55                   	push   %ebp
+  800285:	89 e5                	mov    %esp,%ebp
+  800287:	53                   	push   %ebx
+  800288:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80028e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	85 d2                	test   %edx,%edx
+  800298:	74 2e                	je     8002c8 <strncmp+0x44>
+  80029a:	0f b6 01             	movzbl (%ecx),%eax
+  80029d:	84 c0                	test   %al,%al
+  80029f:	74 16                	je     8002b7 <strncmp+0x33>
+  8002a1:	3a 03                	cmp    (%ebx),%al
+  8002a3:	75 12                	jne    8002b7 <strncmp+0x33>
+  8002a5:	83 c1 01             	add    $0x1,%ecx
+  8002a8:	83 c3 01             	add    $0x1,%ebx
+  8002ab:	83 ea 01             	sub    $0x1,%edx
+  8002ae:	75 ea                	jne    80029a <strncmp+0x16>
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	eb 11                	jmp    8002c8 <strncmp+0x44>
+  8002b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bc:	85 d2                	test   %edx,%edx
+  8002be:	74 08                	je     8002c8 <strncmp+0x44>
+  8002c0:	0f b6 01             	movzbl (%ecx),%eax
+  8002c3:	0f b6 13             	movzbl (%ebx),%edx
+  8002c6:	29 d0                	sub    %edx,%eax
+  8002c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+
+008002cd <strchr>:
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8002d7:	0f b6 10             	movzbl (%eax),%edx
+  8002da:	84 d2                	test   %dl,%dl
+  8002dc:	74 15                	je     8002f3 <strchr+0x26>
+  8002de:	38 d1                	cmp    %dl,%cl
+  8002e0:	74 0f                	je     8002f1 <strchr+0x24>
+  8002e2:	83 c0 01             	add    $0x1,%eax
+  8002e5:	0f b6 10             	movzbl (%eax),%edx
+  8002e8:	84 d2                	test   %dl,%dl
+  8002ea:	75 f2                	jne    8002de <strchr+0x11>
+  8002ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f1:	5d                   	pop    %ebp
+  8002f2:	c3                   	ret
+  8002f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f8:	eb f7                	jmp    8002f1 <strchr+0x24>
+
+008002fa <strfind>:
+  8002fa:	55                   	push   %ebp
+  8002fb:	89 e5                	mov    %esp,%ebp
+  8002fd:	53                   	push   %ebx
+  8002fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800301:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800304:	0f b6 18             	movzbl (%eax),%ebx
+  800307:	38 d3                	cmp    %dl,%bl
+  800309:	74 14                	je     80031f <strfind+0x25>
+  80030b:	89 d1                	mov    %edx,%ecx
+  80030d:	84 db                	test   %bl,%bl
+  80030f:	74 0e                	je     80031f <strfind+0x25>
+  800311:	83 c0 01             	add    $0x1,%eax
+  800314:	0f b6 10             	movzbl (%eax),%edx
+  800317:	38 ca                	cmp    %cl,%dl
+  800319:	74 04                	je     80031f <strfind+0x25>
+  80031b:	84 d2                	test   %dl,%dl
+  80031d:	75 f2                	jne    800311 <strfind+0x17>
+  80031f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+
+00800324 <memset>:
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	57                   	push   %edi
+  800328:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80032b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80032e:	85 c9                	test   %ecx,%ecx
+  800330:	74 20                	je     800352 <memset+0x2e>
+  800332:	89 f8                	mov    %edi,%eax
+  800334:	09 c8                	or     %ecx,%eax
+  800336:	a8 03                	test   $0x3,%al
+  800338:	75 12                	jne    80034c <memset+0x28>
+  80033a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80033e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800344:	c1 e9 02             	shr    $0x2,%ecx
+  800347:	fc                   	cld
+  800348:	f3 ab                	rep stos %eax,%es:(%edi)
+  80034a:	eb 06                	jmp    800352 <memset+0x2e>
+  80034c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80034f:	fc                   	cld
+  800350:	f3 aa                	rep stos %al,%es:(%edi)
+  800352:	89 f8                	mov    %edi,%eax
+  800354:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800357:	c9                   	leave
+  800358:	c3                   	ret
+
+00800359 <memmove>:
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	57                   	push   %edi
+  80035d:	56                   	push   %esi
+  80035e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800361:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800364:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800367:	39 c6                	cmp    %eax,%esi
+  800369:	73 32                	jae    80039d <memmove+0x44>
+  80036b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80036e:	39 d0                	cmp    %edx,%eax
+  800370:	73 2b                	jae    80039d <memmove+0x44>
+  800372:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800375:	89 d6                	mov    %edx,%esi
+  800377:	09 fe                	or     %edi,%esi
+  800379:	09 ce                	or     %ecx,%esi
+  80037b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800381:	75 0e                	jne    800391 <memmove+0x38>
+  800383:	83 ef 04             	sub    $0x4,%edi
+  800386:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800389:	c1 e9 02             	shr    $0x2,%ecx
+  80038c:	fd                   	std
+  80038d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80038f:	eb 09                	jmp    80039a <memmove+0x41>
+  800391:	83 ef 01             	sub    $0x1,%edi
+  800394:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800397:	fd                   	std
+  800398:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80039a:	fc                   	cld
+  80039b:	eb 1a                	jmp    8003b7 <memmove+0x5e>
+  80039d:	89 f2                	mov    %esi,%edx
+  80039f:	09 c2                	or     %eax,%edx
+  8003a1:	09 ca                	or     %ecx,%edx
+  8003a3:	f6 c2 03             	test   $0x3,%dl
+  8003a6:	75 0a                	jne    8003b2 <memmove+0x59>
+  8003a8:	c1 e9 02             	shr    $0x2,%ecx
+  8003ab:	89 c7                	mov    %eax,%edi
+  8003ad:	fc                   	cld
+  8003ae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8003b0:	eb 05                	jmp    8003b7 <memmove+0x5e>
+  8003b2:	89 c7                	mov    %eax,%edi
+  8003b4:	fc                   	cld
+  8003b5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8003b7:	5e                   	pop    %esi
+  8003b8:	5f                   	pop    %edi
+  8003b9:	5d                   	pop    %ebp
+  8003ba:	c3                   	ret
+
+008003bb <memcpy>:
+  8003bb:	55                   	push   %ebp
+  8003bc:	89 e5                	mov    %esp,%ebp
+  8003be:	83 ec 0c             	sub    $0xc,%esp
+  8003c1:	ff 75 10             	push   0x10(%ebp)
+  8003c4:	ff 75 0c             	push   0xc(%ebp)
+  8003c7:	ff 75 08             	push   0x8(%ebp)
+  8003ca:	e8 8a ff ff ff       	call   800359 <memmove>
+  8003cf:	c9                   	leave
+  8003d0:	c3                   	ret
+
+008003d1 <memcmp>:
+  8003d1:	55                   	push   %ebp
+  8003d2:	89 e5                	mov    %esp,%ebp
+  8003d4:	56                   	push   %esi
+  8003d5:	53                   	push   %ebx
+  8003d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003dc:	8b 75 10             	mov    0x10(%ebp),%esi
+  8003df:	85 f6                	test   %esi,%esi
+  8003e1:	74 29                	je     80040c <memcmp+0x3b>
+  8003e3:	01 c6                	add    %eax,%esi
+  8003e5:	0f b6 08             	movzbl (%eax),%ecx
+  8003e8:	0f b6 1a             	movzbl (%edx),%ebx
+  8003eb:	38 d9                	cmp    %bl,%cl
+  8003ed:	75 11                	jne    800400 <memcmp+0x2f>
+  8003ef:	83 c0 01             	add    $0x1,%eax
+  8003f2:	83 c2 01             	add    $0x1,%edx
+  8003f5:	39 c6                	cmp    %eax,%esi
+  8003f7:	75 ec                	jne    8003e5 <memcmp+0x14>
+  8003f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fe:	eb 08                	jmp    800408 <memcmp+0x37>
+  800400:	0f b6 c1             	movzbl %cl,%eax
+  800403:	0f b6 db             	movzbl %bl,%ebx
+  800406:	29 d8                	sub    %ebx,%eax
+  800408:	5b                   	pop    %ebx
+  800409:	5e                   	pop    %esi
+  80040a:	5d                   	pop    %ebp
+  80040b:	c3                   	ret
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	eb f5                	jmp    800408 <memcmp+0x37>
+
+00800413 <memfind>:
+  800413:	55                   	push   %ebp
+  800414:	89 e5                	mov    %esp,%ebp
+  800416:	8b 45 08             	mov    0x8(%ebp),%eax
+  800419:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041c:	89 c2                	mov    %eax,%edx
+  80041e:	03 55 10             	add    0x10(%ebp),%edx
+  800421:	39 d0                	cmp    %edx,%eax
+  800423:	73 0d                	jae    800432 <memfind+0x1f>
+  800425:	38 08                	cmp    %cl,(%eax)
+  800427:	74 0d                	je     800436 <memfind+0x23>
+  800429:	83 c0 01             	add    $0x1,%eax
+  80042c:	39 c2                	cmp    %eax,%edx
+  80042e:	75 f5                	jne    800425 <memfind+0x12>
+  800430:	eb 06                	jmp    800438 <memfind+0x25>
+  800432:	89 c2                	mov    %eax,%edx
+  800434:	eb 02                	jmp    800438 <memfind+0x25>
+  800436:	89 c2                	mov    %eax,%edx
+  800438:	89 d0                	mov    %edx,%eax
+  80043a:	5d                   	pop    %ebp
+  80043b:	c3                   	ret
+
+0080043c <strtol>:
+  80043c:	55                   	push   %ebp
+  80043d:	89 e5                	mov    %esp,%ebp
+  80043f:	57                   	push   %edi
+  800440:	56                   	push   %esi
+  800441:	53                   	push   %ebx
+  800442:	8b 55 08             	mov    0x8(%ebp),%edx
+  800445:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800448:	0f b6 02             	movzbl (%edx),%eax
+  80044b:	3c 20                	cmp    $0x20,%al
+  80044d:	74 04                	je     800453 <strtol+0x17>
+  80044f:	3c 09                	cmp    $0x9,%al
+  800451:	75 0e                	jne    800461 <strtol+0x25>
+  800453:	83 c2 01             	add    $0x1,%edx
+  800456:	0f b6 02             	movzbl (%edx),%eax
+  800459:	3c 20                	cmp    $0x20,%al
+  80045b:	74 f6                	je     800453 <strtol+0x17>
+  80045d:	3c 09                	cmp    $0x9,%al
+  80045f:	74 f2                	je     800453 <strtol+0x17>
+  800461:	3c 2b                	cmp    $0x2b,%al
+  800463:	74 2a                	je     80048f <strtol+0x53>
+  800465:	bf 00 00 00 00       	mov    $0x0,%edi
+  80046a:	3c 2d                	cmp    $0x2d,%al
+  80046c:	74 2b                	je     800499 <strtol+0x5d>
+  80046e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800474:	75 0f                	jne    800485 <strtol+0x49>
+  800476:	80 3a 30             	cmpb   $0x30,(%edx)
+  800479:	74 28                	je     8004a3 <strtol+0x67>
+  80047b:	85 db                	test   %ebx,%ebx
+  80047d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800482:	0f 44 d8             	cmove  %eax,%ebx
+  800485:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80048d:	eb 46                	jmp    8004d5 <strtol+0x99>
+  80048f:	83 c2 01             	add    $0x1,%edx
+  800492:	bf 00 00 00 00       	mov    $0x0,%edi
+  800497:	eb d5                	jmp    80046e <strtol+0x32>
+  800499:	83 c2 01             	add    $0x1,%edx
+  80049c:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004a1:	eb cb                	jmp    80046e <strtol+0x32>
+  8004a3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8004a7:	74 0e                	je     8004b7 <strtol+0x7b>
+  8004a9:	85 db                	test   %ebx,%ebx
+  8004ab:	75 d8                	jne    800485 <strtol+0x49>
+  8004ad:	83 c2 01             	add    $0x1,%edx
+  8004b0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8004b5:	eb ce                	jmp    800485 <strtol+0x49>
+  8004b7:	83 c2 02             	add    $0x2,%edx
+  8004ba:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8004bf:	eb c4                	jmp    800485 <strtol+0x49>
+  8004c1:	0f be c0             	movsbl %al,%eax
+  8004c4:	83 e8 30             	sub    $0x30,%eax
+  8004c7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8004ca:	7d 3a                	jge    800506 <strtol+0xca>
+  8004cc:	83 c2 01             	add    $0x1,%edx
+  8004cf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8004d3:	01 c1                	add    %eax,%ecx
+  8004d5:	0f b6 02             	movzbl (%edx),%eax
+  8004d8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004db:	89 f3                	mov    %esi,%ebx
+  8004dd:	80 fb 09             	cmp    $0x9,%bl
+  8004e0:	76 df                	jbe    8004c1 <strtol+0x85>
+  8004e2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8004e5:	89 f3                	mov    %esi,%ebx
+  8004e7:	80 fb 19             	cmp    $0x19,%bl
+  8004ea:	77 08                	ja     8004f4 <strtol+0xb8>
+  8004ec:	0f be c0             	movsbl %al,%eax
+  8004ef:	83 e8 57             	sub    $0x57,%eax
+  8004f2:	eb d3                	jmp    8004c7 <strtol+0x8b>
+  8004f4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8004f7:	89 f3                	mov    %esi,%ebx
+  8004f9:	80 fb 19             	cmp    $0x19,%bl
+  8004fc:	77 08                	ja     800506 <strtol+0xca>
+  8004fe:	0f be c0             	movsbl %al,%eax
+  800501:	83 e8 37             	sub    $0x37,%eax
+  800504:	eb c1                	jmp    8004c7 <strtol+0x8b>
+  800506:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80050a:	74 05                	je     800511 <strtol+0xd5>
+  80050c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80050f:	89 10                	mov    %edx,(%eax)
+  800511:	89 c8                	mov    %ecx,%eax
+  800513:	f7 d8                	neg    %eax
+  800515:	85 ff                	test   %edi,%edi
+  800517:	0f 45 c8             	cmovne %eax,%ecx
+  80051a:	89 c8                	mov    %ecx,%eax
+  80051c:	5b                   	pop    %ebx
+  80051d:	5e                   	pop    %esi
+  80051e:	5f                   	pop    %edi
+  80051f:	5d                   	pop    %ebp
+  800520:	c3                   	ret
+
+00800521 <sys_cputs>:
+  800521:	55                   	push   %ebp
+  800522:	89 e5                	mov    %esp,%ebp
+  800524:	57                   	push   %edi
+  800525:	56                   	push   %esi
+  800526:	53                   	push   %ebx
+  800527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800532:	89 c3                	mov    %eax,%ebx
+  800534:	89 c7                	mov    %eax,%edi
+  800536:	89 c6                	mov    %eax,%esi
+  800538:	cd 30                	int    $0x30
+  80053a:	5b                   	pop    %ebx
+  80053b:	5e                   	pop    %esi
+  80053c:	5f                   	pop    %edi
+  80053d:	5d                   	pop    %ebp
+  80053e:	c3                   	ret
+
+0080053f <sys_cgetc>:
+  80053f:	55                   	push   %ebp
+  800540:	89 e5                	mov    %esp,%ebp
+  800542:	57                   	push   %edi
+  800543:	56                   	push   %esi
+  800544:	53                   	push   %ebx
+  800545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80054f:	89 d1                	mov    %edx,%ecx
+  800551:	89 d3                	mov    %edx,%ebx
+  800553:	89 d7                	mov    %edx,%edi
+  800555:	89 d6                	mov    %edx,%esi
+  800557:	cd 30                	int    $0x30
+  800559:	5b                   	pop    %ebx
+  80055a:	5e                   	pop    %esi
+  80055b:	5f                   	pop    %edi
+  80055c:	5d                   	pop    %ebp
+  80055d:	c3                   	ret
+
+0080055e <sys_env_destroy>:
+  80055e:	55                   	push   %ebp
+  80055f:	89 e5                	mov    %esp,%ebp
+  800561:	57                   	push   %edi
+  800562:	56                   	push   %esi
+  800563:	53                   	push   %ebx
+  800564:	83 ec 0c             	sub    $0xc,%esp
+  800567:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80056f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800574:	89 cb                	mov    %ecx,%ebx
+  800576:	89 cf                	mov    %ecx,%edi
+  800578:	89 ce                	mov    %ecx,%esi
+  80057a:	cd 30                	int    $0x30
+  80057c:	85 c0                	test   %eax,%eax
+  80057e:	7f 08                	jg     800588 <sys_env_destroy+0x2a>
+  800580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800583:	5b                   	pop    %ebx
+  800584:	5e                   	pop    %esi
+  800585:	5f                   	pop    %edi
+  800586:	5d                   	pop    %ebp
+  800587:	c3                   	ret
+  800588:	83 ec 0c             	sub    $0xc,%esp
+  80058b:	50                   	push   %eax
+  80058c:	6a 03                	push   $0x3
+  80058e:	68 2f 32 80 00       	push   $0x80322f
+  800593:	6a 24                	push   $0x24
+  800595:	68 4c 32 80 00       	push   $0x80324c
+  80059a:	e8 37 20 00 00       	call   8025d6 <_panic>
+
+0080059f <sys_getenvid>:
+  80059f:	55                   	push   %ebp
+  8005a0:	89 e5                	mov    %esp,%ebp
+  8005a2:	57                   	push   %edi
+  8005a3:	56                   	push   %esi
+  8005a4:	53                   	push   %ebx
+  8005a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005aa:	b8 02 00 00 00       	mov    $0x2,%eax
+  8005af:	89 d1                	mov    %edx,%ecx
+  8005b1:	89 d3                	mov    %edx,%ebx
+  8005b3:	89 d7                	mov    %edx,%edi
+  8005b5:	89 d6                	mov    %edx,%esi
+  8005b7:	cd 30                	int    $0x30
+  8005b9:	5b                   	pop    %ebx
+  8005ba:	5e                   	pop    %esi
+  8005bb:	5f                   	pop    %edi
+  8005bc:	5d                   	pop    %ebp
+  8005bd:	c3                   	ret
+
+008005be <sys_yield>:
+  8005be:	55                   	push   %ebp
+  8005bf:	89 e5                	mov    %esp,%ebp
+  8005c1:	57                   	push   %edi
+  8005c2:	56                   	push   %esi
+  8005c3:	53                   	push   %ebx
+  8005c4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8005cb:	74 26                	je     8005f3 <sys_yield+0x35>
+  8005cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8005d7:	89 d1                	mov    %edx,%ecx
+  8005d9:	89 d3                	mov    %edx,%ebx
+  8005db:	89 d7                	mov    %edx,%edi
+  8005dd:	6a 00                	push   $0x0
+  8005df:	55                   	push   %ebp
+  8005e0:	89 e5                	mov    %esp,%ebp
+  8005e2:	8d 35 ea 05 80 00    	lea    0x8005ea,%esi
+  8005e8:	0f 34                	sysenter
+  8005ea:	5d                   	pop    %ebp
+  8005eb:	83 c4 04             	add    $0x4,%esp
+  8005ee:	5b                   	pop    %ebx
+  8005ef:	5e                   	pop    %esi
+  8005f0:	5f                   	pop    %edi
+  8005f1:	5d                   	pop    %ebp
+  8005f2:	c3                   	ret
+  8005f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8005fd:	89 d1                	mov    %edx,%ecx
+  8005ff:	89 d3                	mov    %edx,%ebx
+  800601:	89 d7                	mov    %edx,%edi
+  800603:	89 d6                	mov    %edx,%esi
+  800605:	cd 30                	int    $0x30
+  800607:	eb e5                	jmp    8005ee <sys_yield+0x30>
+
+00800609 <sys_page_alloc>:
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+  80060c:	57                   	push   %edi
+  80060d:	56                   	push   %esi
+  80060e:	53                   	push   %ebx
+  80060f:	83 ec 0c             	sub    $0xc,%esp
+  800612:	be 00 00 00 00       	mov    $0x0,%esi
+  800617:	8b 55 08             	mov    0x8(%ebp),%edx
+  80061a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80061d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800622:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800625:	89 f7                	mov    %esi,%edi
+  800627:	cd 30                	int    $0x30
+  800629:	85 c0                	test   %eax,%eax
+  80062b:	7f 08                	jg     800635 <sys_page_alloc+0x2c>
+  80062d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800630:	5b                   	pop    %ebx
+  800631:	5e                   	pop    %esi
+  800632:	5f                   	pop    %edi
+  800633:	5d                   	pop    %ebp
+  800634:	c3                   	ret
+  800635:	83 ec 0c             	sub    $0xc,%esp
+  800638:	50                   	push   %eax
+  800639:	6a 04                	push   $0x4
+  80063b:	68 2f 32 80 00       	push   $0x80322f
+  800640:	6a 24                	push   $0x24
+  800642:	68 4c 32 80 00       	push   $0x80324c
+  800647:	e8 8a 1f 00 00       	call   8025d6 <_panic>
+
+0080064c <sys_page_map>:
+  80064c:	55                   	push   %ebp
+  80064d:	89 e5                	mov    %esp,%ebp
+  80064f:	57                   	push   %edi
+  800650:	56                   	push   %esi
+  800651:	53                   	push   %ebx
+  800652:	83 ec 0c             	sub    $0xc,%esp
+  800655:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80065c:	74 33                	je     800691 <sys_page_map+0x45>
+  80065e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800661:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800664:	b8 05 00 00 00       	mov    $0x5,%eax
+  800669:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80066c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80066f:	ff 75 18             	push   0x18(%ebp)
+  800672:	55                   	push   %ebp
+  800673:	89 e5                	mov    %esp,%ebp
+  800675:	8d 35 7d 06 80 00    	lea    0x80067d,%esi
+  80067b:	0f 34                	sysenter
+  80067d:	5d                   	pop    %ebp
+  80067e:	83 c4 04             	add    $0x4,%esp
+  800681:	89 c2                	mov    %eax,%edx
+  800683:	85 c0                	test   %eax,%eax
+  800685:	7f 3d                	jg     8006c4 <sys_page_map+0x78>
+  800687:	89 d0                	mov    %edx,%eax
+  800689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80068c:	5b                   	pop    %ebx
+  80068d:	5e                   	pop    %esi
+  80068e:	5f                   	pop    %edi
+  80068f:	5d                   	pop    %ebp
+  800690:	c3                   	ret
+  800691:	b8 05 00 00 00       	mov    $0x5,%eax
+  800696:	8b 55 08             	mov    0x8(%ebp),%edx
+  800699:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80069c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80069f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006a2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8006a5:	cd 30                	int    $0x30
+  8006a7:	89 c2                	mov    %eax,%edx
+  8006a9:	85 c0                	test   %eax,%eax
+  8006ab:	7e da                	jle    800687 <sys_page_map+0x3b>
+  8006ad:	83 ec 0c             	sub    $0xc,%esp
+  8006b0:	50                   	push   %eax
+  8006b1:	6a 05                	push   $0x5
+  8006b3:	68 2f 32 80 00       	push   $0x80322f
+  8006b8:	6a 24                	push   $0x24
+  8006ba:	68 4c 32 80 00       	push   $0x80324c
+  8006bf:	e8 12 1f 00 00       	call   8025d6 <_panic>
+  8006c4:	83 ec 0c             	sub    $0xc,%esp
+  8006c7:	50                   	push   %eax
+  8006c8:	6a 05                	push   $0x5
+  8006ca:	68 2f 32 80 00       	push   $0x80322f
+  8006cf:	6a 48                	push   $0x48
+  8006d1:	68 4c 32 80 00       	push   $0x80324c
+  8006d6:	e8 fb 1e 00 00       	call   8025d6 <_panic>
+
+008006db <sys_page_unmap>:
+  8006db:	55                   	push   %ebp
+  8006dc:	89 e5                	mov    %esp,%ebp
+  8006de:	57                   	push   %edi
+  8006df:	56                   	push   %esi
+  8006e0:	53                   	push   %ebx
+  8006e1:	83 ec 0c             	sub    $0xc,%esp
+  8006e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006ef:	b8 06 00 00 00       	mov    $0x6,%eax
+  8006f4:	89 df                	mov    %ebx,%edi
+  8006f6:	89 de                	mov    %ebx,%esi
+  8006f8:	cd 30                	int    $0x30
+  8006fa:	85 c0                	test   %eax,%eax
+  8006fc:	7f 08                	jg     800706 <sys_page_unmap+0x2b>
+  8006fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800701:	5b                   	pop    %ebx
+  800702:	5e                   	pop    %esi
+  800703:	5f                   	pop    %edi
+  800704:	5d                   	pop    %ebp
+  800705:	c3                   	ret
+  800706:	83 ec 0c             	sub    $0xc,%esp
+  800709:	50                   	push   %eax
+  80070a:	6a 06                	push   $0x6
+  80070c:	68 2f 32 80 00       	push   $0x80322f
+  800711:	6a 24                	push   $0x24
+  800713:	68 4c 32 80 00       	push   $0x80324c
+  800718:	e8 b9 1e 00 00       	call   8025d6 <_panic>
+
+0080071d <sys_fork>:
+  80071d:	55                   	push   %ebp
+  80071e:	89 e5                	mov    %esp,%ebp
+  800720:	57                   	push   %edi
+  800721:	56                   	push   %esi
+  800722:	53                   	push   %ebx
+  800723:	ba 00 00 00 00       	mov    $0x0,%edx
+  800728:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80072d:	89 d1                	mov    %edx,%ecx
+  80072f:	89 d3                	mov    %edx,%ebx
+  800731:	89 d7                	mov    %edx,%edi
+  800733:	89 d6                	mov    %edx,%esi
+  800735:	cd 30                	int    $0x30
+  800737:	5b                   	pop    %ebx
+  800738:	5e                   	pop    %esi
+  800739:	5f                   	pop    %edi
+  80073a:	5d                   	pop    %ebp
+  80073b:	c3                   	ret
+
+0080073c <sys_env_set_status>:
+  80073c:	55                   	push   %ebp
+  80073d:	89 e5                	mov    %esp,%ebp
+  80073f:	57                   	push   %edi
+  800740:	56                   	push   %esi
+  800741:	53                   	push   %ebx
+  800742:	83 ec 0c             	sub    $0xc,%esp
+  800745:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80074a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800750:	b8 08 00 00 00       	mov    $0x8,%eax
+  800755:	89 df                	mov    %ebx,%edi
+  800757:	89 de                	mov    %ebx,%esi
+  800759:	cd 30                	int    $0x30
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	7f 08                	jg     800767 <sys_env_set_status+0x2b>
+  80075f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800762:	5b                   	pop    %ebx
+  800763:	5e                   	pop    %esi
+  800764:	5f                   	pop    %edi
+  800765:	5d                   	pop    %ebp
+  800766:	c3                   	ret
+  800767:	83 ec 0c             	sub    $0xc,%esp
+  80076a:	50                   	push   %eax
+  80076b:	6a 08                	push   $0x8
+  80076d:	68 2f 32 80 00       	push   $0x80322f
+  800772:	6a 24                	push   $0x24
+  800774:	68 4c 32 80 00       	push   $0x80324c
+  800779:	e8 58 1e 00 00       	call   8025d6 <_panic>
+
+0080077e <sys_env_set_trapframe>:
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	57                   	push   %edi
+  800782:	56                   	push   %esi
+  800783:	53                   	push   %ebx
+  800784:	83 ec 0c             	sub    $0xc,%esp
+  800787:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80078c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80078f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800792:	b8 09 00 00 00       	mov    $0x9,%eax
+  800797:	89 df                	mov    %ebx,%edi
+  800799:	89 de                	mov    %ebx,%esi
+  80079b:	cd 30                	int    $0x30
+  80079d:	85 c0                	test   %eax,%eax
+  80079f:	7f 08                	jg     8007a9 <sys_env_set_trapframe+0x2b>
+  8007a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a4:	5b                   	pop    %ebx
+  8007a5:	5e                   	pop    %esi
+  8007a6:	5f                   	pop    %edi
+  8007a7:	5d                   	pop    %ebp
+  8007a8:	c3                   	ret
+  8007a9:	83 ec 0c             	sub    $0xc,%esp
+  8007ac:	50                   	push   %eax
+  8007ad:	6a 09                	push   $0x9
+  8007af:	68 2f 32 80 00       	push   $0x80322f
+  8007b4:	6a 24                	push   $0x24
+  8007b6:	68 4c 32 80 00       	push   $0x80324c
+  8007bb:	e8 16 1e 00 00       	call   8025d6 <_panic>
+
+008007c0 <sys_env_set_cow>:
+  8007c0:	55                   	push   %ebp
+  8007c1:	89 e5                	mov    %esp,%ebp
+  8007c3:	57                   	push   %edi
+  8007c4:	56                   	push   %esi
+  8007c5:	53                   	push   %ebx
+  8007c6:	83 ec 0c             	sub    $0xc,%esp
+  8007c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8007d9:	89 df                	mov    %ebx,%edi
+  8007db:	89 de                	mov    %ebx,%esi
+  8007dd:	cd 30                	int    $0x30
+  8007df:	85 c0                	test   %eax,%eax
+  8007e1:	7f 08                	jg     8007eb <sys_env_set_cow+0x2b>
+  8007e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e6:	5b                   	pop    %ebx
+  8007e7:	5e                   	pop    %esi
+  8007e8:	5f                   	pop    %edi
+  8007e9:	5d                   	pop    %ebp
+  8007ea:	c3                   	ret
+  8007eb:	83 ec 0c             	sub    $0xc,%esp
+  8007ee:	50                   	push   %eax
+  8007ef:	6a 20                	push   $0x20
+  8007f1:	68 2f 32 80 00       	push   $0x80322f
+  8007f6:	6a 24                	push   $0x24
+  8007f8:	68 4c 32 80 00       	push   $0x80324c
+  8007fd:	e8 d4 1d 00 00       	call   8025d6 <_panic>
+
+00800802 <sys_env_service>:
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	57                   	push   %edi
+  800806:	56                   	push   %esi
+  800807:	53                   	push   %ebx
+  800808:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800810:	b8 21 00 00 00       	mov    $0x21,%eax
+  800815:	89 cb                	mov    %ecx,%ebx
+  800817:	89 cf                	mov    %ecx,%edi
+  800819:	89 ce                	mov    %ecx,%esi
+  80081b:	cd 30                	int    $0x30
+  80081d:	5b                   	pop    %ebx
+  80081e:	5e                   	pop    %esi
+  80081f:	5f                   	pop    %edi
+  800820:	5d                   	pop    %ebp
+  800821:	c3                   	ret
+
+00800822 <sys_env_set_pgfault_upcall>:
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	57                   	push   %edi
+  800826:	56                   	push   %esi
+  800827:	53                   	push   %ebx
+  800828:	83 ec 0c             	sub    $0xc,%esp
+  80082b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800830:	8b 55 08             	mov    0x8(%ebp),%edx
+  800833:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800836:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80083b:	89 df                	mov    %ebx,%edi
+  80083d:	89 de                	mov    %ebx,%esi
+  80083f:	cd 30                	int    $0x30
+  800841:	85 c0                	test   %eax,%eax
+  800843:	7f 08                	jg     80084d <sys_env_set_pgfault_upcall+0x2b>
+  800845:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800848:	5b                   	pop    %ebx
+  800849:	5e                   	pop    %esi
+  80084a:	5f                   	pop    %edi
+  80084b:	5d                   	pop    %ebp
+  80084c:	c3                   	ret
+  80084d:	83 ec 0c             	sub    $0xc,%esp
+  800850:	50                   	push   %eax
+  800851:	6a 0a                	push   $0xa
+  800853:	68 2f 32 80 00       	push   $0x80322f
+  800858:	6a 24                	push   $0x24
+  80085a:	68 4c 32 80 00       	push   $0x80324c
+  80085f:	e8 72 1d 00 00       	call   8025d6 <_panic>
+
+00800864 <sys_ipc_try_send>:
+  800864:	55                   	push   %ebp
+  800865:	89 e5                	mov    %esp,%ebp
+  800867:	57                   	push   %edi
+  800868:	56                   	push   %esi
+  800869:	53                   	push   %ebx
+  80086a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800871:	74 27                	je     80089a <sys_ipc_try_send+0x36>
+  800873:	8b 55 08             	mov    0x8(%ebp),%edx
+  800876:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800879:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80087e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800881:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800884:	6a 00                	push   $0x0
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	8d 35 91 08 80 00    	lea    0x800891,%esi
+  80088f:	0f 34                	sysenter
+  800891:	5d                   	pop    %ebp
+  800892:	83 c4 04             	add    $0x4,%esp
+  800895:	5b                   	pop    %ebx
+  800896:	5e                   	pop    %esi
+  800897:	5f                   	pop    %edi
+  800898:	5d                   	pop    %ebp
+  800899:	c3                   	ret
+  80089a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80089f:	be 00 00 00 00       	mov    $0x0,%esi
+  8008a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8008b0:	cd 30                	int    $0x30
+  8008b2:	eb e1                	jmp    800895 <sys_ipc_try_send+0x31>
+
+008008b4 <sys_ipc_recv>:
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	57                   	push   %edi
+  8008b8:	56                   	push   %esi
+  8008b9:	53                   	push   %ebx
+  8008ba:	83 ec 0c             	sub    $0xc,%esp
+  8008bd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8008c4:	74 32                	je     8008f8 <sys_ipc_recv+0x44>
+  8008c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8008d3:	89 cb                	mov    %ecx,%ebx
+  8008d5:	89 cf                	mov    %ecx,%edi
+  8008d7:	6a 00                	push   $0x0
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	8d 35 e4 08 80 00    	lea    0x8008e4,%esi
+  8008e2:	0f 34                	sysenter
+  8008e4:	5d                   	pop    %ebp
+  8008e5:	83 c4 04             	add    $0x4,%esp
+  8008e8:	89 c2                	mov    %eax,%edx
+  8008ea:	85 c0                	test   %eax,%eax
+  8008ec:	7f 3c                	jg     80092a <sys_ipc_recv+0x76>
+  8008ee:	89 d0                	mov    %edx,%eax
+  8008f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008f3:	5b                   	pop    %ebx
+  8008f4:	5e                   	pop    %esi
+  8008f5:	5f                   	pop    %edi
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+  8008f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800902:	8b 55 08             	mov    0x8(%ebp),%edx
+  800905:	89 cb                	mov    %ecx,%ebx
+  800907:	89 cf                	mov    %ecx,%edi
+  800909:	89 ce                	mov    %ecx,%esi
+  80090b:	cd 30                	int    $0x30
+  80090d:	89 c2                	mov    %eax,%edx
+  80090f:	85 c0                	test   %eax,%eax
+  800911:	7e db                	jle    8008ee <sys_ipc_recv+0x3a>
+  800913:	83 ec 0c             	sub    $0xc,%esp
+  800916:	50                   	push   %eax
+  800917:	6a 0d                	push   $0xd
+  800919:	68 2f 32 80 00       	push   $0x80322f
+  80091e:	6a 24                	push   $0x24
+  800920:	68 4c 32 80 00       	push   $0x80324c
+  800925:	e8 ac 1c 00 00       	call   8025d6 <_panic>
+  80092a:	83 ec 0c             	sub    $0xc,%esp
+  80092d:	50                   	push   %eax
+  80092e:	6a 0d                	push   $0xd
+  800930:	68 2f 32 80 00       	push   $0x80322f
+  800935:	6a 48                	push   $0x48
+  800937:	68 4c 32 80 00       	push   $0x80324c
+  80093c:	e8 95 1c 00 00       	call   8025d6 <_panic>
+
+00800941 <sys_ipc_send>:
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	57                   	push   %edi
+  800945:	56                   	push   %esi
+  800946:	53                   	push   %ebx
+  800947:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80094e:	74 27                	je     800977 <sys_ipc_send+0x36>
+  800950:	8b 55 08             	mov    0x8(%ebp),%edx
+  800953:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800956:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80095b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80095e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800961:	6a 00                	push   $0x0
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	8d 35 6e 09 80 00    	lea    0x80096e,%esi
+  80096c:	0f 34                	sysenter
+  80096e:	5d                   	pop    %ebp
+  80096f:	83 c4 04             	add    $0x4,%esp
+  800972:	5b                   	pop    %ebx
+  800973:	5e                   	pop    %esi
+  800974:	5f                   	pop    %edi
+  800975:	5d                   	pop    %ebp
+  800976:	c3                   	ret
+  800977:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80097c:	be 00 00 00 00       	mov    $0x0,%esi
+  800981:	8b 55 08             	mov    0x8(%ebp),%edx
+  800984:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800987:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80098a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80098d:	cd 30                	int    $0x30
+  80098f:	eb e1                	jmp    800972 <sys_ipc_send+0x31>
+
+00800991 <sys_ipc_call>:
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	57                   	push   %edi
+  800995:	56                   	push   %esi
+  800996:	53                   	push   %ebx
+  800997:	8b 55 08             	mov    0x8(%ebp),%edx
+  80099a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80099d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8009a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8009a8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8009ab:	cd 30                	int    $0x30
+  8009ad:	5b                   	pop    %ebx
+  8009ae:	5e                   	pop    %esi
+  8009af:	5f                   	pop    %edi
+  8009b0:	5d                   	pop    %ebp
+  8009b1:	c3                   	ret
+
+008009b2 <sys_ipc_reply_recv>:
+  8009b2:	55                   	push   %ebp
+  8009b3:	89 e5                	mov    %esp,%ebp
+  8009b5:	57                   	push   %edi
+  8009b6:	56                   	push   %esi
+  8009b7:	53                   	push   %ebx
+  8009b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009be:	b8 10 00 00 00       	mov    $0x10,%eax
+  8009c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8009c9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8009cc:	cd 30                	int    $0x30
+  8009ce:	5b                   	pop    %ebx
+  8009cf:	5e                   	pop    %esi
+  8009d0:	5f                   	pop    %edi
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+
+008009d3 <sys_time_msec>:
+  8009d3:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8009d8:	85 c0                	test   %eax,%eax
+  8009da:	75 06                	jne    8009e2 <sys_time_msec+0xf>
+  8009dc:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8009e1:	c3                   	ret
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	57                   	push   %edi
+  8009e6:	56                   	push   %esi
+  8009e7:	53                   	push   %ebx
+  8009e8:	83 ec 0c             	sub    $0xc,%esp
+  8009eb:	0f 31                	rdtsc
+  8009ed:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8009f3:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8009f9:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8009ff:	29 c8                	sub    %ecx,%eax
+  800a01:	19 da                	sbb    %ebx,%edx
+  800a03:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a08:	57                   	push   %edi
+  800a09:	56                   	push   %esi
+  800a0a:	52                   	push   %edx
+  800a0b:	50                   	push   %eax
+  800a0c:	e8 d1 26 00 00       	call   8030e2 <__udivdi3>
+  800a11:	83 c4 10             	add    $0x10,%esp
+  800a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a17:	5b                   	pop    %ebx
+  800a18:	5e                   	pop    %esi
+  800a19:	5f                   	pop    %edi
+  800a1a:	5d                   	pop    %ebp
+  800a1b:	c3                   	ret
+
+00800a1c <sys_env_swap>:
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	57                   	push   %edi
+  800a20:	56                   	push   %esi
+  800a21:	53                   	push   %ebx
+  800a22:	83 ec 0c             	sub    $0xc,%esp
+  800a25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a2d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800a32:	89 cb                	mov    %ecx,%ebx
+  800a34:	89 cf                	mov    %ecx,%edi
+  800a36:	89 ce                	mov    %ecx,%esi
+  800a38:	cd 30                	int    $0x30
+  800a3a:	85 c0                	test   %eax,%eax
+  800a3c:	7f 08                	jg     800a46 <sys_env_swap+0x2a>
+  800a3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a41:	5b                   	pop    %ebx
+  800a42:	5e                   	pop    %esi
+  800a43:	5f                   	pop    %edi
+  800a44:	5d                   	pop    %ebp
+  800a45:	c3                   	ret
+  800a46:	83 ec 0c             	sub    $0xc,%esp
+  800a49:	50                   	push   %eax
+  800a4a:	6a 12                	push   $0x12
+  800a4c:	68 2f 32 80 00       	push   $0x80322f
+  800a51:	6a 24                	push   $0x24
+  800a53:	68 4c 32 80 00       	push   $0x80324c
+  800a58:	e8 79 1b 00 00       	call   8025d6 <_panic>
+
+00800a5d <sys_net_try_send>:
+  800a5d:	55                   	push   %ebp
+  800a5e:	89 e5                	mov    %esp,%ebp
+  800a60:	57                   	push   %edi
+  800a61:	56                   	push   %esi
+  800a62:	53                   	push   %ebx
+  800a63:	83 ec 0c             	sub    $0xc,%esp
+  800a66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a71:	b8 13 00 00 00       	mov    $0x13,%eax
+  800a76:	89 df                	mov    %ebx,%edi
+  800a78:	89 de                	mov    %ebx,%esi
+  800a7a:	cd 30                	int    $0x30
+  800a7c:	85 c0                	test   %eax,%eax
+  800a7e:	7f 08                	jg     800a88 <sys_net_try_send+0x2b>
+  800a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a83:	5b                   	pop    %ebx
+  800a84:	5e                   	pop    %esi
+  800a85:	5f                   	pop    %edi
+  800a86:	5d                   	pop    %ebp
+  800a87:	c3                   	ret
+  800a88:	83 ec 0c             	sub    $0xc,%esp
+  800a8b:	50                   	push   %eax
+  800a8c:	6a 13                	push   $0x13
+  800a8e:	68 2f 32 80 00       	push   $0x80322f
+  800a93:	6a 24                	push   $0x24
+  800a95:	68 4c 32 80 00       	push   $0x80324c
+  800a9a:	e8 37 1b 00 00       	call   8025d6 <_panic>
+
+00800a9f <sys_net_try_receive>:
+  800a9f:	55                   	push   %ebp
+  800aa0:	89 e5                	mov    %esp,%ebp
+  800aa2:	57                   	push   %edi
+  800aa3:	56                   	push   %esi
+  800aa4:	53                   	push   %ebx
+  800aa5:	83 ec 0c             	sub    $0xc,%esp
+  800aa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ab3:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ab8:	89 df                	mov    %ebx,%edi
+  800aba:	89 de                	mov    %ebx,%esi
+  800abc:	cd 30                	int    $0x30
+  800abe:	85 c0                	test   %eax,%eax
+  800ac0:	7f 08                	jg     800aca <sys_net_try_receive+0x2b>
+  800ac2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ac5:	5b                   	pop    %ebx
+  800ac6:	5e                   	pop    %esi
+  800ac7:	5f                   	pop    %edi
+  800ac8:	5d                   	pop    %ebp
+  800ac9:	c3                   	ret
+  800aca:	83 ec 0c             	sub    $0xc,%esp
+  800acd:	50                   	push   %eax
+  800ace:	6a 14                	push   $0x14
+  800ad0:	68 2f 32 80 00       	push   $0x80322f
+  800ad5:	6a 24                	push   $0x24
+  800ad7:	68 4c 32 80 00       	push   $0x80324c
+  800adc:	e8 f5 1a 00 00       	call   8025d6 <_panic>
+
+00800ae1 <sys_net_recv_page>:
+  800ae1:	55                   	push   %ebp
+  800ae2:	89 e5                	mov    %esp,%ebp
+  800ae4:	57                   	push   %edi
+  800ae5:	56                   	push   %esi
+  800ae6:	53                   	push   %ebx
+  800ae7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aef:	b8 27 00 00 00       	mov    $0x27,%eax
+  800af4:	89 cb                	mov    %ecx,%ebx
+  800af6:	89 cf                	mov    %ecx,%edi
+  800af8:	89 ce                	mov    %ecx,%esi
+  800afa:	cd 30                	int    $0x30
+  800afc:	5b                   	pop    %ebx
+  800afd:	5e                   	pop    %esi
+  800afe:	5f                   	pop    %edi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+
+00800b01 <sys_net_wait>:
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	57                   	push   %edi
+  800b05:	56                   	push   %esi
+  800b06:	53                   	push   %ebx
+  800b07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0c:	b8 26 00 00 00       	mov    $0x26,%eax
+  800b11:	89 d1                	mov    %edx,%ecx
+  800b13:	89 d3                	mov    %edx,%ebx
+  800b15:	89 d7                	mov    %edx,%edi
+  800b17:	89 d6                	mov    %edx,%esi
+  800b19:	cd 30                	int    $0x30
+  800b1b:	5b                   	pop    %ebx
+  800b1c:	5e                   	pop    %esi
+  800b1d:	5f                   	pop    %edi
+  800b1e:	5d                   	pop    %ebp
+  800b1f:	c3                   	ret
+
+00800b20 <sys_get_mac>:
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	57                   	push   %edi
+  800b24:	56                   	push   %esi
+  800b25:	53                   	push   %ebx
+  800b26:	83 ec 0c             	sub    $0xc,%esp
+  800b29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b34:	b8 15 00 00 00       	mov    $0x15,%eax
+  800b39:	89 df                	mov    %ebx,%edi
+  800b3b:	89 de                	mov    %ebx,%esi
+  800b3d:	cd 30                	int    $0x30
+  800b3f:	85 c0                	test   %eax,%eax
+  800b41:	7f 08                	jg     800b4b <sys_get_mac+0x2b>
+  800b43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b46:	5b                   	pop    %ebx
+  800b47:	5e                   	pop    %esi
+  800b48:	5f                   	pop    %edi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+  800b4b:	83 ec 0c             	sub    $0xc,%esp
+  800b4e:	50                   	push   %eax
+  800b4f:	6a 15                	push   $0x15
+  800b51:	68 2f 32 80 00       	push   $0x80322f
+  800b56:	6a 24                	push   $0x24
+  800b58:	68 4c 32 80 00       	push   $0x80324c
+  800b5d:	e8 74 1a 00 00       	call   8025d6 <_panic>
+
+00800b62 <sys_env_lease>:
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	57                   	push   %edi
+  800b66:	56                   	push   %esi
+  800b67:	53                   	push   %ebx
+  800b68:	83 ec 0c             	sub    $0xc,%esp
+  800b6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b76:	b8 16 00 00 00       	mov    $0x16,%eax
+  800b7b:	89 df                	mov    %ebx,%edi
+  800b7d:	89 de                	mov    %ebx,%esi
+  800b7f:	cd 30                	int    $0x30
+  800b81:	85 c0                	test   %eax,%eax
+  800b83:	7f 08                	jg     800b8d <sys_env_lease+0x2b>
+  800b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b88:	5b                   	pop    %ebx
+  800b89:	5e                   	pop    %esi
+  800b8a:	5f                   	pop    %edi
+  800b8b:	5d                   	pop    %ebp
+  800b8c:	c3                   	ret
+  800b8d:	83 ec 0c             	sub    $0xc,%esp
+  800b90:	50                   	push   %eax
+  800b91:	6a 16                	push   $0x16
+  800b93:	68 2f 32 80 00       	push   $0x80322f
+  800b98:	6a 24                	push   $0x24
+  800b9a:	68 4c 32 80 00       	push   $0x80324c
+  800b9f:	e8 32 1a 00 00       	call   8025d6 <_panic>
+
+00800ba4 <sys_copy_mem>:
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	57                   	push   %edi
+  800ba8:	56                   	push   %esi
+  800ba9:	53                   	push   %ebx
+  800baa:	83 ec 0c             	sub    $0xc,%esp
+  800bad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb3:	b8 17 00 00 00       	mov    $0x17,%eax
+  800bb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bbb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bbe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bc1:	cd 30                	int    $0x30
+  800bc3:	85 c0                	test   %eax,%eax
+  800bc5:	7f 08                	jg     800bcf <sys_copy_mem+0x2b>
+  800bc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bca:	5b                   	pop    %ebx
+  800bcb:	5e                   	pop    %esi
+  800bcc:	5f                   	pop    %edi
+  800bcd:	5d                   	pop    %ebp
+  800bce:	c3                   	ret
+  800bcf:	83 ec 0c             	sub    $0xc,%esp
+  800bd2:	50                   	push   %eax
+  800bd3:	6a 17                	push   $0x17
+  800bd5:	68 2f 32 80 00       	push   $0x80322f
+  800bda:	6a 24                	push   $0x24
+  800bdc:	68 4c 32 80 00       	push   $0x80324c
+  800be1:	e8 f0 19 00 00       	call   8025d6 <_panic>
+
+00800be6 <sys_get_perms>:
+  800be6:	55                   	push   %ebp
+  800be7:	89 e5                	mov    %esp,%ebp
+  800be9:	57                   	push   %edi
+  800bea:	56                   	push   %esi
+  800beb:	53                   	push   %ebx
+  800bec:	83 ec 0c             	sub    $0xc,%esp
+  800bef:	be 00 00 00 00       	mov    $0x0,%esi
+  800bf4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfa:	b8 18 00 00 00       	mov    $0x18,%eax
+  800bff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c02:	89 f7                	mov    %esi,%edi
+  800c04:	cd 30                	int    $0x30
+  800c06:	85 c0                	test   %eax,%eax
+  800c08:	7f 08                	jg     800c12 <sys_get_perms+0x2c>
+  800c0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c0d:	5b                   	pop    %ebx
+  800c0e:	5e                   	pop    %esi
+  800c0f:	5f                   	pop    %edi
+  800c10:	5d                   	pop    %ebp
+  800c11:	c3                   	ret
+  800c12:	83 ec 0c             	sub    $0xc,%esp
+  800c15:	50                   	push   %eax
+  800c16:	6a 18                	push   $0x18
+  800c18:	68 2f 32 80 00       	push   $0x80322f
+  800c1d:	6a 24                	push   $0x24
+  800c1f:	68 4c 32 80 00       	push   $0x80324c
+  800c24:	e8 ad 19 00 00       	call   8025d6 <_panic>
+
+00800c29 <sys_env_unsuspend>:
+  800c29:	55                   	push   %ebp
+  800c2a:	89 e5                	mov    %esp,%ebp
+  800c2c:	57                   	push   %edi
+  800c2d:	56                   	push   %esi
+  800c2e:	53                   	push   %ebx
+  800c2f:	83 ec 0c             	sub    $0xc,%esp
+  800c32:	be 00 00 00 00       	mov    $0x0,%esi
+  800c37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3d:	b8 19 00 00 00       	mov    $0x19,%eax
+  800c42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c45:	89 f7                	mov    %esi,%edi
+  800c47:	cd 30                	int    $0x30
+  800c49:	85 c0                	test   %eax,%eax
+  800c4b:	7f 08                	jg     800c55 <sys_env_unsuspend+0x2c>
+  800c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c50:	5b                   	pop    %ebx
+  800c51:	5e                   	pop    %esi
+  800c52:	5f                   	pop    %edi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+  800c55:	83 ec 0c             	sub    $0xc,%esp
+  800c58:	50                   	push   %eax
+  800c59:	6a 19                	push   $0x19
+  800c5b:	68 2f 32 80 00       	push   $0x80322f
+  800c60:	6a 24                	push   $0x24
+  800c62:	68 4c 32 80 00       	push   $0x80324c
+  800c67:	e8 6a 19 00 00       	call   8025d6 <_panic>
+
+00800c6c <sys_migrate>:
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	57                   	push   %edi
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+  800c75:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800c7a:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  800c80:	76 11                	jbe    800c93 <sys_migrate+0x27>
+  800c82:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800c87:	0f b6 08             	movzbl (%eax),%ecx
+  800c8a:	05 00 10 00 00       	add    $0x1000,%eax
+  800c8f:	39 d0                	cmp    %edx,%eax
+  800c91:	72 f4                	jb     800c87 <sys_migrate+0x1b>
+  800c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800ca0:	89 cb                	mov    %ecx,%ebx
+  800ca2:	89 cf                	mov    %ecx,%edi
+  800ca4:	89 ce                	mov    %ecx,%esi
+  800ca6:	cd 30                	int    $0x30
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	7f 08                	jg     800cb4 <sys_migrate+0x48>
+  800cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5f                   	pop    %edi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+  800cb4:	83 ec 0c             	sub    $0xc,%esp
+  800cb7:	50                   	push   %eax
+  800cb8:	6a 1a                	push   $0x1a
+  800cba:	68 2f 32 80 00       	push   $0x80322f
+  800cbf:	6a 24                	push   $0x24
+  800cc1:	68 4c 32 80 00       	push   $0x80324c
+  800cc6:	e8 0b 19 00 00       	call   8025d6 <_panic>
+
+00800ccb <sys_lease_complete>:
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  800cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800cde:	89 d1                	mov    %edx,%ecx
+  800ce0:	89 d3                	mov    %edx,%ebx
+  800ce2:	89 d7                	mov    %edx,%edi
+  800ce4:	89 d6                	mov    %edx,%esi
+  800ce6:	cd 30                	int    $0x30
+  800ce8:	85 c0                	test   %eax,%eax
+  800cea:	7f 08                	jg     800cf4 <sys_lease_complete+0x29>
+  800cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+  800cf4:	83 ec 0c             	sub    $0xc,%esp
+  800cf7:	50                   	push   %eax
+  800cf8:	6a 1b                	push   $0x1b
+  800cfa:	68 2f 32 80 00       	push   $0x80322f
+  800cff:	6a 24                	push   $0x24
+  800d01:	68 4c 32 80 00       	push   $0x80324c
+  800d06:	e8 cb 18 00 00       	call   8025d6 <_panic>
+
+00800d0b <sys_env_set_thisenv>:
+  800d0b:	55                   	push   %ebp
+  800d0c:	89 e5                	mov    %esp,%ebp
+  800d0e:	57                   	push   %edi
+  800d0f:	56                   	push   %esi
+  800d10:	53                   	push   %ebx
+  800d11:	83 ec 0c             	sub    $0xc,%esp
+  800d14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800d24:	89 df                	mov    %ebx,%edi
+  800d26:	89 de                	mov    %ebx,%esi
+  800d28:	cd 30                	int    $0x30
+  800d2a:	85 c0                	test   %eax,%eax
+  800d2c:	7f 08                	jg     800d36 <sys_env_set_thisenv+0x2b>
+  800d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+  800d39:	50                   	push   %eax
+  800d3a:	6a 1c                	push   $0x1c
+  800d3c:	68 2f 32 80 00       	push   $0x80322f
+  800d41:	6a 24                	push   $0x24
+  800d43:	68 4c 32 80 00       	push   $0x80324c
+  800d48:	e8 89 18 00 00       	call   8025d6 <_panic>
+
+00800d4d <sys_env_set_sched>:
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+  800d56:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d61:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d69:	89 f7                	mov    %esi,%edi
+  800d6b:	cd 30                	int    $0x30
+  800d6d:	85 c0                	test   %eax,%eax
+  800d6f:	7f 08                	jg     800d79 <sys_env_set_sched+0x2c>
+  800d71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d74:	5b                   	pop    %ebx
+  800d75:	5e                   	pop    %esi
+  800d76:	5f                   	pop    %edi
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+  800d79:	83 ec 0c             	sub    $0xc,%esp
+  800d7c:	50                   	push   %eax
+  800d7d:	6a 1d                	push   $0x1d
+  800d7f:	68 2f 32 80 00       	push   $0x80322f
+  800d84:	6a 24                	push   $0x24
+  800d86:	68 4c 32 80 00       	push   $0x80324c
+  800d8b:	e8 46 18 00 00       	call   8025d6 <_panic>
+
+00800d90 <sys_batch>:
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  800d96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800da6:	89 df                	mov    %ebx,%edi
+  800da8:	89 de                	mov    %ebx,%esi
+  800daa:	cd 30                	int    $0x30
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+
+00800db1 <sys_env_stats>:
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+  800db7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc2:	b8 23 00 00 00       	mov    $0x23,%eax
+  800dc7:	89 df                	mov    %ebx,%edi
+  800dc9:	89 de                	mov    %ebx,%esi
+  800dcb:	cd 30                	int    $0x30
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5e                   	pop    %esi
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+
+00800dd2 <sys_trace>:
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  800dd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de0:	b8 24 00 00 00       	mov    $0x24,%eax
+  800de5:	89 cb                	mov    %ecx,%ebx
+  800de7:	89 cf                	mov    %ecx,%edi
+  800de9:	89 ce                	mov    %ecx,%esi
+  800deb:	cd 30                	int    $0x30
+  800ded:	5b                   	pop    %ebx
+  800dee:	5e                   	pop    %esi
+  800def:	5f                   	pop    %edi
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+
+00800df2 <sys_env_set_pager>:
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+  800dfb:	be 00 00 00 00       	mov    $0x0,%esi
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 25 00 00 00       	mov    $0x25,%eax
+  800e0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0e:	89 f7                	mov    %esi,%edi
+  800e10:	cd 30                	int    $0x30
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 08                	jg     800e1e <sys_env_set_pager+0x2c>
+  800e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 25                	push   $0x25
+  800e24:	68 2f 32 80 00       	push   $0x80322f
+  800e29:	6a 24                	push   $0x24
+  800e2b:	68 4c 32 80 00       	push   $0x80324c
+  800e30:	e8 a1 17 00 00       	call   8025d6 <_panic>
+
+00800e35 <sys_pager_retire>:
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+  800e3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	b8 28 00 00 00       	mov    $0x28,%eax
+  800e48:	89 cb                	mov    %ecx,%ebx
+  800e4a:	89 cf                	mov    %ecx,%edi
+  800e4c:	89 ce                	mov    %ecx,%esi
+  800e4e:	cd 30                	int    $0x30
+  800e50:	5b                   	pop    %ebx
+  800e51:	5e                   	pop    %esi
+  800e52:	5f                   	pop    %edi
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+
+00800e55 <sys_prof>:
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	b8 22 00 00 00       	mov    $0x22,%eax
+  800e6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6e:	89 f7                	mov    %esi,%edi
+  800e70:	cd 30                	int    $0x30
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5f                   	pop    %edi
+  800e75:	5d                   	pop    %ebp
+  800e76:	c3                   	ret
+
+00800e77 <fd2num>:
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e7d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e82:	c1 e8 0c             	shr    $0xc,%eax
+  800e85:	5d                   	pop    %ebp
+  800e86:	c3                   	ret
+
+00800e87 <fd2data>:
+  800e87:	55                   	push   %ebp
+  800e88:	89 e5                	mov    %esp,%ebp
+  800e8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e8d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800e92:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e97:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+
+00800e9e <fd_alloc>:
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800ea6:	89 c2                	mov    %eax,%edx
+  800ea8:	c1 ea 16             	shr    $0x16,%edx
+  800eab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800eb2:	f6 c2 01             	test   $0x1,%dl
+  800eb5:	74 29                	je     800ee0 <fd_alloc+0x42>
+  800eb7:	89 c2                	mov    %eax,%edx
+  800eb9:	c1 ea 0c             	shr    $0xc,%edx
+  800ebc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800ec3:	f6 c2 01             	test   $0x1,%dl
+  800ec6:	74 18                	je     800ee0 <fd_alloc+0x42>
+  800ec8:	05 00 10 00 00       	add    $0x1000,%eax
+  800ecd:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800ed2:	75 d2                	jne    800ea6 <fd_alloc+0x8>
+  800ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800ede:	eb 05                	jmp    800ee5 <fd_alloc+0x47>
+  800ee0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee8:	89 02                	mov    %eax,(%edx)
+  800eea:	89 c8                	mov    %ecx,%eax
+  800eec:	5d                   	pop    %ebp
+  800eed:	c3                   	ret
+
+00800eee <fd_lookup>:
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef4:	83 f8 1f             	cmp    $0x1f,%eax
+  800ef7:	77 30                	ja     800f29 <fd_lookup+0x3b>
+  800ef9:	c1 e0 0c             	shl    $0xc,%eax
+  800efc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800f01:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800f07:	f6 c2 01             	test   $0x1,%dl
+  800f0a:	74 24                	je     800f30 <fd_lookup+0x42>
+  800f0c:	89 c2                	mov    %eax,%edx
+  800f0e:	c1 ea 0c             	shr    $0xc,%edx
+  800f11:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800f18:	f6 c2 01             	test   $0x1,%dl
+  800f1b:	74 1a                	je     800f37 <fd_lookup+0x49>
+  800f1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f20:	89 02                	mov    %eax,(%edx)
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+  800f29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f2e:	eb f7                	jmp    800f27 <fd_lookup+0x39>
+  800f30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f35:	eb f0                	jmp    800f27 <fd_lookup+0x39>
+  800f37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f3c:	eb e9                	jmp    800f27 <fd_lookup+0x39>
+
+00800f3e <dev_lookup>:
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	53                   	push   %ebx
+  800f42:	83 ec 04             	sub    $0x4,%esp
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4d:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800f52:	39 13                	cmp    %edx,(%ebx)
+  800f54:	74 37                	je     800f8d <dev_lookup+0x4f>
+  800f56:	83 c0 01             	add    $0x1,%eax
+  800f59:	8b 1c 85 d8 32 80 00 	mov    0x8032d8(,%eax,4),%ebx
+  800f60:	85 db                	test   %ebx,%ebx
+  800f62:	75 ee                	jne    800f52 <dev_lookup+0x14>
+  800f64:	a1 10 50 80 00       	mov    0x805010,%eax
+  800f69:	8b 40 48             	mov    0x48(%eax),%eax
+  800f6c:	83 ec 04             	sub    $0x4,%esp
+  800f6f:	52                   	push   %edx
+  800f70:	50                   	push   %eax
+  800f71:	68 5c 32 80 00       	push   $0x80325c
+  800f76:	e8 36 17 00 00       	call   8026b1 <cprintf>
+  800f7b:	83 c4 10             	add    $0x10,%esp
+  800f7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f86:	89 1a                	mov    %ebx,(%edx)
+  800f88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f8b:	c9                   	leave
+  800f8c:	c3                   	ret
+  800f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f92:	eb ef                	jmp    800f83 <dev_lookup+0x45>
+
+00800f94 <fd_close>:
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	57                   	push   %edi
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+  800f9a:	83 ec 24             	sub    $0x24,%esp
+  800f9d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fa0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800fa3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800fa6:	50                   	push   %eax
+  800fa7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800fad:	c1 e8 0c             	shr    $0xc,%eax
+  800fb0:	50                   	push   %eax
+  800fb1:	e8 38 ff ff ff       	call   800eee <fd_lookup>
+  800fb6:	89 c3                	mov    %eax,%ebx
+  800fb8:	83 c4 10             	add    $0x10,%esp
+  800fbb:	85 c0                	test   %eax,%eax
+  800fbd:	78 05                	js     800fc4 <fd_close+0x30>
+  800fbf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800fc2:	74 0f                	je     800fd3 <fd_close+0x3f>
+  800fc4:	85 ff                	test   %edi,%edi
+  800fc6:	0f 44 df             	cmove  %edi,%ebx
+  800fc9:	89 d8                	mov    %ebx,%eax
+  800fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+  800fd3:	83 ec 08             	sub    $0x8,%esp
+  800fd6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800fd9:	50                   	push   %eax
+  800fda:	ff 36                	push   (%esi)
+  800fdc:	e8 5d ff ff ff       	call   800f3e <dev_lookup>
+  800fe1:	89 c3                	mov    %eax,%ebx
+  800fe3:	83 c4 10             	add    $0x10,%esp
+  800fe6:	85 c0                	test   %eax,%eax
+  800fe8:	78 1a                	js     801004 <fd_close+0x70>
+  800fea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fed:	8b 40 10             	mov    0x10(%eax),%eax
+  800ff0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff5:	85 c0                	test   %eax,%eax
+  800ff7:	74 0b                	je     801004 <fd_close+0x70>
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+  800ffc:	56                   	push   %esi
+  800ffd:	ff d0                	call   *%eax
+  800fff:	89 c3                	mov    %eax,%ebx
+  801001:	83 c4 10             	add    $0x10,%esp
+  801004:	83 ec 08             	sub    $0x8,%esp
+  801007:	56                   	push   %esi
+  801008:	6a 00                	push   $0x0
+  80100a:	e8 cc f6 ff ff       	call   8006db <sys_page_unmap>
+  80100f:	83 c4 10             	add    $0x10,%esp
+  801012:	eb b5                	jmp    800fc9 <fd_close+0x35>
+
+00801014 <close>:
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	83 ec 20             	sub    $0x20,%esp
+  80101a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80101d:	50                   	push   %eax
+  80101e:	ff 75 08             	push   0x8(%ebp)
+  801021:	e8 c8 fe ff ff       	call   800eee <fd_lookup>
+  801026:	83 c4 10             	add    $0x10,%esp
+  801029:	85 c0                	test   %eax,%eax
+  80102b:	79 02                	jns    80102f <close+0x1b>
+  80102d:	c9                   	leave
+  80102e:	c3                   	ret
+  80102f:	83 ec 08             	sub    $0x8,%esp
+  801032:	6a 01                	push   $0x1
+  801034:	ff 75 f4             	push   -0xc(%ebp)
+  801037:	e8 58 ff ff ff       	call   800f94 <fd_close>
+  80103c:	83 c4 10             	add    $0x10,%esp
+  80103f:	eb ec                	jmp    80102d <close+0x19>
+
+00801041 <close_all>:
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	53                   	push   %ebx
+  801045:	83 ec 04             	sub    $0x4,%esp
+  801048:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104d:	83 ec 0c             	sub    $0xc,%esp
+  801050:	53                   	push   %ebx
+  801051:	e8 be ff ff ff       	call   801014 <close>
+  801056:	83 c3 01             	add    $0x1,%ebx
+  801059:	83 c4 10             	add    $0x10,%esp
+  80105c:	83 fb 20             	cmp    $0x20,%ebx
+  80105f:	75 ec                	jne    80104d <close_all+0xc>
+  801061:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801064:	c9                   	leave
+  801065:	c3                   	ret
+
+00801066 <dup>:
+  801066:	55                   	push   %ebp
+  801067:	89 e5                	mov    %esp,%ebp
+  801069:	57                   	push   %edi
+  80106a:	56                   	push   %esi
+  80106b:	53                   	push   %ebx
+  80106c:	83 ec 34             	sub    $0x34,%esp
+  80106f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801072:	50                   	push   %eax
+  801073:	ff 75 08             	push   0x8(%ebp)
+  801076:	e8 73 fe ff ff       	call   800eee <fd_lookup>
+  80107b:	89 c3                	mov    %eax,%ebx
+  80107d:	83 c4 10             	add    $0x10,%esp
+  801080:	85 c0                	test   %eax,%eax
+  801082:	78 7f                	js     801103 <dup+0x9d>
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  801087:	ff 75 0c             	push   0xc(%ebp)
+  80108a:	e8 85 ff ff ff       	call   801014 <close>
+  80108f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801092:	c1 e6 0c             	shl    $0xc,%esi
+  801095:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80109b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80109e:	89 3c 24             	mov    %edi,(%esp)
+  8010a1:	e8 e1 fd ff ff       	call   800e87 <fd2data>
+  8010a6:	89 c3                	mov    %eax,%ebx
+  8010a8:	89 34 24             	mov    %esi,(%esp)
+  8010ab:	e8 d7 fd ff ff       	call   800e87 <fd2data>
+  8010b0:	83 c4 10             	add    $0x10,%esp
+  8010b3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8010b6:	89 d8                	mov    %ebx,%eax
+  8010b8:	c1 e8 16             	shr    $0x16,%eax
+  8010bb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010c2:	a8 01                	test   $0x1,%al
+  8010c4:	74 11                	je     8010d7 <dup+0x71>
+  8010c6:	89 d8                	mov    %ebx,%eax
+  8010c8:	c1 e8 0c             	shr    $0xc,%eax
+  8010cb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8010d2:	f6 c2 01             	test   $0x1,%dl
+  8010d5:	75 36                	jne    80110d <dup+0xa7>
+  8010d7:	89 f8                	mov    %edi,%eax
+  8010d9:	c1 e8 0c             	shr    $0xc,%eax
+  8010dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010e3:	83 ec 0c             	sub    $0xc,%esp
+  8010e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010eb:	50                   	push   %eax
+  8010ec:	56                   	push   %esi
+  8010ed:	6a 00                	push   $0x0
+  8010ef:	57                   	push   %edi
+  8010f0:	6a 00                	push   $0x0
+  8010f2:	e8 55 f5 ff ff       	call   80064c <sys_page_map>
+  8010f7:	89 c3                	mov    %eax,%ebx
+  8010f9:	83 c4 20             	add    $0x20,%esp
+  8010fc:	85 c0                	test   %eax,%eax
+  8010fe:	78 33                	js     801133 <dup+0xcd>
+  801100:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801103:	89 d8                	mov    %ebx,%eax
+  801105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+  80110d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	25 07 0e 00 00       	and    $0xe07,%eax
+  80111c:	50                   	push   %eax
+  80111d:	ff 75 d4             	push   -0x2c(%ebp)
+  801120:	6a 00                	push   $0x0
+  801122:	53                   	push   %ebx
+  801123:	6a 00                	push   $0x0
+  801125:	e8 22 f5 ff ff       	call   80064c <sys_page_map>
+  80112a:	89 c3                	mov    %eax,%ebx
+  80112c:	83 c4 20             	add    $0x20,%esp
+  80112f:	85 c0                	test   %eax,%eax
+  801131:	79 a4                	jns    8010d7 <dup+0x71>
+  801133:	83 ec 08             	sub    $0x8,%esp
+  801136:	56                   	push   %esi
+  801137:	6a 00                	push   $0x0
+  801139:	e8 9d f5 ff ff       	call   8006db <sys_page_unmap>
+  80113e:	83 c4 08             	add    $0x8,%esp
+  801141:	ff 75 d4             	push   -0x2c(%ebp)
+  801144:	6a 00                	push   $0x0
+  801146:	e8 90 f5 ff ff       	call   8006db <sys_page_unmap>
+  80114b:	83 c4 10             	add    $0x10,%esp
+  80114e:	eb b3                	jmp    801103 <dup+0x9d>
+
+00801150 <read>:
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+  801155:	83 ec 18             	sub    $0x18,%esp
+  801158:	8b 75 08             	mov    0x8(%ebp),%esi
+  80115b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80115e:	50                   	push   %eax
+  80115f:	56                   	push   %esi
+  801160:	e8 89 fd ff ff       	call   800eee <fd_lookup>
+  801165:	83 c4 10             	add    $0x10,%esp
+  801168:	85 c0                	test   %eax,%eax
+  80116a:	78 3c                	js     8011a8 <read+0x58>
+  80116c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80116f:	83 ec 08             	sub    $0x8,%esp
+  801172:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801175:	50                   	push   %eax
+  801176:	ff 33                	push   (%ebx)
+  801178:	e8 c1 fd ff ff       	call   800f3e <dev_lookup>
+  80117d:	83 c4 10             	add    $0x10,%esp
+  801180:	85 c0                	test   %eax,%eax
+  801182:	78 24                	js     8011a8 <read+0x58>
+  801184:	8b 43 08             	mov    0x8(%ebx),%eax
+  801187:	83 e0 03             	and    $0x3,%eax
+  80118a:	83 f8 01             	cmp    $0x1,%eax
+  80118d:	74 20                	je     8011af <read+0x5f>
+  80118f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801192:	8b 40 08             	mov    0x8(%eax),%eax
+  801195:	85 c0                	test   %eax,%eax
+  801197:	74 37                	je     8011d0 <read+0x80>
+  801199:	83 ec 04             	sub    $0x4,%esp
+  80119c:	ff 75 10             	push   0x10(%ebp)
+  80119f:	ff 75 0c             	push   0xc(%ebp)
+  8011a2:	53                   	push   %ebx
+  8011a3:	ff d0                	call   *%eax
+  8011a5:	83 c4 10             	add    $0x10,%esp
+  8011a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+  8011af:	a1 10 50 80 00       	mov    0x805010,%eax
+  8011b4:	8b 40 48             	mov    0x48(%eax),%eax
+  8011b7:	83 ec 04             	sub    $0x4,%esp
+  8011ba:	56                   	push   %esi
+  8011bb:	50                   	push   %eax
+  8011bc:	68 9d 32 80 00       	push   $0x80329d
+  8011c1:	e8 eb 14 00 00       	call   8026b1 <cprintf>
+  8011c6:	83 c4 10             	add    $0x10,%esp
+  8011c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ce:	eb d8                	jmp    8011a8 <read+0x58>
+  8011d0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8011d5:	eb d1                	jmp    8011a8 <read+0x58>
+
+008011d7 <readn>:
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	57                   	push   %edi
+  8011db:	56                   	push   %esi
+  8011dc:	53                   	push   %ebx
+  8011dd:	83 ec 0c             	sub    $0xc,%esp
+  8011e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8011e3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8011e6:	85 f6                	test   %esi,%esi
+  8011e8:	74 30                	je     80121a <readn+0x43>
+  8011ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f4:	83 ec 04             	sub    $0x4,%esp
+  8011f7:	89 f2                	mov    %esi,%edx
+  8011f9:	29 c2                	sub    %eax,%edx
+  8011fb:	52                   	push   %edx
+  8011fc:	01 f8                	add    %edi,%eax
+  8011fe:	50                   	push   %eax
+  8011ff:	ff 75 08             	push   0x8(%ebp)
+  801202:	e8 49 ff ff ff       	call   801150 <read>
+  801207:	83 c4 10             	add    $0x10,%esp
+  80120a:	85 c0                	test   %eax,%eax
+  80120c:	78 15                	js     801223 <readn+0x4c>
+  80120e:	74 11                	je     801221 <readn+0x4a>
+  801210:	01 c3                	add    %eax,%ebx
+  801212:	89 d8                	mov    %ebx,%eax
+  801214:	39 f3                	cmp    %esi,%ebx
+  801216:	72 dc                	jb     8011f4 <readn+0x1d>
+  801218:	eb 09                	jmp    801223 <readn+0x4c>
+  80121a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121f:	eb 02                	jmp    801223 <readn+0x4c>
+  801221:	89 d8                	mov    %ebx,%eax
+  801223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801226:	5b                   	pop    %ebx
+  801227:	5e                   	pop    %esi
+  801228:	5f                   	pop    %edi
+  801229:	5d                   	pop    %ebp
+  80122a:	c3                   	ret
+
+0080122b <write>:
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	56                   	push   %esi
+  80122f:	53                   	push   %ebx
+  801230:	83 ec 18             	sub    $0x18,%esp
+  801233:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801236:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801239:	50                   	push   %eax
+  80123a:	53                   	push   %ebx
+  80123b:	e8 ae fc ff ff       	call   800eee <fd_lookup>
+  801240:	83 c4 10             	add    $0x10,%esp
+  801243:	85 c0                	test   %eax,%eax
+  801245:	78 37                	js     80127e <write+0x53>
+  801247:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80124a:	83 ec 08             	sub    $0x8,%esp
+  80124d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801250:	50                   	push   %eax
+  801251:	ff 36                	push   (%esi)
+  801253:	e8 e6 fc ff ff       	call   800f3e <dev_lookup>
+  801258:	83 c4 10             	add    $0x10,%esp
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	78 1f                	js     80127e <write+0x53>
+  80125f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801263:	74 20                	je     801285 <write+0x5a>
+  801265:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801268:	8b 40 0c             	mov    0xc(%eax),%eax
+  80126b:	85 c0                	test   %eax,%eax
+  80126d:	74 37                	je     8012a6 <write+0x7b>
+  80126f:	83 ec 04             	sub    $0x4,%esp
+  801272:	ff 75 10             	push   0x10(%ebp)
+  801275:	ff 75 0c             	push   0xc(%ebp)
+  801278:	56                   	push   %esi
+  801279:	ff d0                	call   *%eax
+  80127b:	83 c4 10             	add    $0x10,%esp
+  80127e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801281:	5b                   	pop    %ebx
+  801282:	5e                   	pop    %esi
+  801283:	5d                   	pop    %ebp
+  801284:	c3                   	ret
+  801285:	a1 10 50 80 00       	mov    0x805010,%eax
+  80128a:	8b 40 48             	mov    0x48(%eax),%eax
+  80128d:	83 ec 04             	sub    $0x4,%esp
+  801290:	53                   	push   %ebx
+  801291:	50                   	push   %eax
+  801292:	68 b9 32 80 00       	push   $0x8032b9
+  801297:	e8 15 14 00 00       	call   8026b1 <cprintf>
+  80129c:	83 c4 10             	add    $0x10,%esp
+  80129f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a4:	eb d8                	jmp    80127e <write+0x53>
+  8012a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012ab:	eb d1                	jmp    80127e <write+0x53>
+
+008012ad <seek>:
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	83 ec 20             	sub    $0x20,%esp
+  8012b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012b6:	50                   	push   %eax
+  8012b7:	ff 75 08             	push   0x8(%ebp)
+  8012ba:	e8 2f fc ff ff       	call   800eee <fd_lookup>
+  8012bf:	83 c4 10             	add    $0x10,%esp
+  8012c2:	85 c0                	test   %eax,%eax
+  8012c4:	78 0e                	js     8012d4 <seek+0x27>
+  8012c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012cc:	89 50 04             	mov    %edx,0x4(%eax)
+  8012cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+
+008012d6 <ftruncate>:
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	56                   	push   %esi
+  8012da:	53                   	push   %ebx
+  8012db:	83 ec 18             	sub    $0x18,%esp
+  8012de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012e4:	50                   	push   %eax
+  8012e5:	53                   	push   %ebx
+  8012e6:	e8 03 fc ff ff       	call   800eee <fd_lookup>
+  8012eb:	83 c4 10             	add    $0x10,%esp
+  8012ee:	85 c0                	test   %eax,%eax
+  8012f0:	78 34                	js     801326 <ftruncate+0x50>
+  8012f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012f5:	83 ec 08             	sub    $0x8,%esp
+  8012f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012fb:	50                   	push   %eax
+  8012fc:	ff 36                	push   (%esi)
+  8012fe:	e8 3b fc ff ff       	call   800f3e <dev_lookup>
+  801303:	83 c4 10             	add    $0x10,%esp
+  801306:	85 c0                	test   %eax,%eax
+  801308:	78 1c                	js     801326 <ftruncate+0x50>
+  80130a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80130e:	74 1d                	je     80132d <ftruncate+0x57>
+  801310:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801313:	8b 40 18             	mov    0x18(%eax),%eax
+  801316:	85 c0                	test   %eax,%eax
+  801318:	74 34                	je     80134e <ftruncate+0x78>
+  80131a:	83 ec 08             	sub    $0x8,%esp
+  80131d:	ff 75 0c             	push   0xc(%ebp)
+  801320:	56                   	push   %esi
+  801321:	ff d0                	call   *%eax
+  801323:	83 c4 10             	add    $0x10,%esp
+  801326:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5d                   	pop    %ebp
+  80132c:	c3                   	ret
+  80132d:	a1 10 50 80 00       	mov    0x805010,%eax
+  801332:	8b 40 48             	mov    0x48(%eax),%eax
+  801335:	83 ec 04             	sub    $0x4,%esp
+  801338:	53                   	push   %ebx
+  801339:	50                   	push   %eax
+  80133a:	68 7c 32 80 00       	push   $0x80327c
+  80133f:	e8 6d 13 00 00       	call   8026b1 <cprintf>
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134c:	eb d8                	jmp    801326 <ftruncate+0x50>
+  80134e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801353:	eb d1                	jmp    801326 <ftruncate+0x50>
+
+00801355 <fstat>:
+  801355:	55                   	push   %ebp
+  801356:	89 e5                	mov    %esp,%ebp
+  801358:	56                   	push   %esi
+  801359:	53                   	push   %ebx
+  80135a:	83 ec 18             	sub    $0x18,%esp
+  80135d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801360:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801363:	50                   	push   %eax
+  801364:	ff 75 08             	push   0x8(%ebp)
+  801367:	e8 82 fb ff ff       	call   800eee <fd_lookup>
+  80136c:	83 c4 10             	add    $0x10,%esp
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	78 49                	js     8013bc <fstat+0x67>
+  801373:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801376:	83 ec 08             	sub    $0x8,%esp
+  801379:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80137c:	50                   	push   %eax
+  80137d:	ff 36                	push   (%esi)
+  80137f:	e8 ba fb ff ff       	call   800f3e <dev_lookup>
+  801384:	83 c4 10             	add    $0x10,%esp
+  801387:	85 c0                	test   %eax,%eax
+  801389:	78 31                	js     8013bc <fstat+0x67>
+  80138b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80138e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801392:	74 2f                	je     8013c3 <fstat+0x6e>
+  801394:	c6 03 00             	movb   $0x0,(%ebx)
+  801397:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80139e:	00 00 00 
+  8013a1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8013a8:	00 00 00 
+  8013ab:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8013b1:	83 ec 08             	sub    $0x8,%esp
+  8013b4:	53                   	push   %ebx
+  8013b5:	56                   	push   %esi
+  8013b6:	ff 50 14             	call   *0x14(%eax)
+  8013b9:	83 c4 10             	add    $0x10,%esp
+  8013bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013bf:	5b                   	pop    %ebx
+  8013c0:	5e                   	pop    %esi
+  8013c1:	5d                   	pop    %ebp
+  8013c2:	c3                   	ret
+  8013c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013c8:	eb f2                	jmp    8013bc <fstat+0x67>
+
+008013ca <stat>:
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+  8013cf:	83 ec 08             	sub    $0x8,%esp
+  8013d2:	6a 00                	push   $0x0
+  8013d4:	ff 75 08             	push   0x8(%ebp)
+  8013d7:	e8 31 05 00 00       	call   80190d <open>
+  8013dc:	89 c3                	mov    %eax,%ebx
+  8013de:	83 c4 10             	add    $0x10,%esp
+  8013e1:	85 c0                	test   %eax,%eax
+  8013e3:	78 1b                	js     801400 <stat+0x36>
+  8013e5:	83 ec 08             	sub    $0x8,%esp
+  8013e8:	ff 75 0c             	push   0xc(%ebp)
+  8013eb:	50                   	push   %eax
+  8013ec:	e8 64 ff ff ff       	call   801355 <fstat>
+  8013f1:	89 c6                	mov    %eax,%esi
+  8013f3:	89 1c 24             	mov    %ebx,(%esp)
+  8013f6:	e8 19 fc ff ff       	call   801014 <close>
+  8013fb:	83 c4 10             	add    $0x10,%esp
+  8013fe:	89 f3                	mov    %esi,%ebx
+  801400:	89 d8                	mov    %ebx,%eax
+  801402:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801405:	5b                   	pop    %ebx
+  801406:	5e                   	pop    %esi
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+
+00801409 <fsipc>:
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	56                   	push   %esi
+  80140d:	53                   	push   %ebx
+  80140e:	89 c3                	mov    %eax,%ebx
+  801410:	89 d6                	mov    %edx,%esi
+  801412:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801419:	74 20                	je     80143b <fsipc+0x32>
+  80141b:	83 ec 08             	sub    $0x8,%esp
+  80141e:	6a 00                	push   $0x0
+  801420:	56                   	push   %esi
+  801421:	6a 07                	push   $0x7
+  801423:	68 00 60 80 00       	push   $0x806000
+  801428:	53                   	push   %ebx
+  801429:	ff 35 08 50 80 00    	push   0x805008
+  80142f:	e8 e0 19 00 00       	call   802e14 <ipc_call>
+  801434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+  80143b:	83 ec 0c             	sub    $0xc,%esp
+  80143e:	6a 02                	push   $0x2
+  801440:	e8 6a 1b 00 00       	call   802faf <ipc_find_env>
+  801445:	a3 08 50 80 00       	mov    %eax,0x805008
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	eb cc                	jmp    80141b <fsipc+0x12>
+
+0080144f <devfile_trunc>:
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	83 ec 08             	sub    $0x8,%esp
+  801455:	8b 45 08             	mov    0x8(%ebp),%eax
+  801458:	8b 40 0c             	mov    0xc(%eax),%eax
+  80145b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801460:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801463:	a3 04 60 80 00       	mov    %eax,0x806004
+  801468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801472:	e8 92 ff ff ff       	call   801409 <fsipc>
+  801477:	c9                   	leave
+  801478:	c3                   	ret
+
+00801479 <devfile_flush>:
+  801479:	55                   	push   %ebp
+  80147a:	89 e5                	mov    %esp,%ebp
+  80147c:	83 ec 08             	sub    $0x8,%esp
+  80147f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801482:	8b 40 0c             	mov    0xc(%eax),%eax
+  801485:	a3 00 60 80 00       	mov    %eax,0x806000
+  80148a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801494:	e8 70 ff ff ff       	call   801409 <fsipc>
+  801499:	c9                   	leave
+  80149a:	c3                   	ret
+
+0080149b <devfile_stat>:
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	53                   	push   %ebx
+  80149f:	83 ec 04             	sub    $0x4,%esp
+  8014a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8014a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014ab:	a3 00 60 80 00       	mov    %eax,0x806000
+  8014b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014ba:	e8 4a ff ff ff       	call   801409 <fsipc>
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	78 2c                	js     8014ef <devfile_stat+0x54>
+  8014c3:	83 ec 08             	sub    $0x8,%esp
+  8014c6:	68 00 60 80 00       	push   $0x806000
+  8014cb:	53                   	push   %ebx
+  8014cc:	e8 d8 ec ff ff       	call   8001a9 <strcpy>
+  8014d1:	a1 80 60 80 00       	mov    0x806080,%eax
+  8014d6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8014dc:	a1 84 60 80 00       	mov    0x806084,%eax
+  8014e1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8014e7:	83 c4 10             	add    $0x10,%esp
+  8014ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f2:	c9                   	leave
+  8014f3:	c3                   	ret
+
+008014f4 <fsring_rw>:
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	57                   	push   %edi
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+  8014fa:	83 ec 2c             	sub    $0x2c,%esp
+  8014fd:	89 c7                	mov    %eax,%edi
+  8014ff:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801502:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801505:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80150a:	a8 01                	test   $0x1,%al
+  80150c:	74 0d                	je     80151b <fsring_rw+0x27>
+  80150e:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801513:	a8 01                	test   $0x1,%al
+  801515:	0f 85 d5 00 00 00    	jne    8015f0 <fsring_rw+0xfc>
+  80151b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801520:	8b 40 48             	mov    0x48(%eax),%eax
+  801523:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801529:	0f 84 fc 00 00 00    	je     80162b <fsring_rw+0x137>
+  80152f:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801536:	0f 84 02 01 00 00    	je     80163e <fsring_rw+0x14a>
+  80153c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801541:	83 ec 04             	sub    $0x4,%esp
+  801544:	68 07 02 00 00       	push   $0x207
+  801549:	53                   	push   %ebx
+  80154a:	6a 00                	push   $0x0
+  80154c:	e8 b8 f0 ff ff       	call   800609 <sys_page_alloc>
+  801551:	83 c4 10             	add    $0x10,%esp
+  801554:	85 c0                	test   %eax,%eax
+  801556:	0f 88 f9 00 00 00    	js     801655 <fsring_rw+0x161>
+  80155c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801562:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801568:	75 d7                	jne    801541 <fsring_rw+0x4d>
+  80156a:	6a 0e                	push   $0xe
+  80156c:	6a 0d                	push   $0xd
+  80156e:	ff 35 08 50 80 00    	push   0x805008
+  801574:	68 00 00 f0 cf       	push   $0xcff00000
+  801579:	e8 c4 0c 00 00       	call   802242 <ipcring_init>
+  80157e:	83 c4 08             	add    $0x8,%esp
+  801581:	6a 00                	push   $0x0
+  801583:	6a 00                	push   $0x0
+  801585:	68 07 02 00 00       	push   $0x207
+  80158a:	68 00 00 f0 cf       	push   $0xcff00000
+  80158f:	6a 0b                	push   $0xb
+  801591:	ff 35 08 50 80 00    	push   0x805008
+  801597:	e8 78 18 00 00       	call   802e14 <ipc_call>
+  80159c:	89 c6                	mov    %eax,%esi
+  80159e:	83 c4 20             	add    $0x20,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	0f 88 ac 00 00 00    	js     801655 <fsring_rw+0x161>
+  8015a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ae:	89 d9                	mov    %ebx,%ecx
+  8015b0:	83 c3 01             	add    $0x1,%ebx
+  8015b3:	89 da                	mov    %ebx,%edx
+  8015b5:	c1 e2 0c             	shl    $0xc,%edx
+  8015b8:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8015be:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8015c4:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8015ca:	83 ec 08             	sub    $0x8,%esp
+  8015cd:	6a 00                	push   $0x0
+  8015cf:	6a 00                	push   $0x0
+  8015d1:	68 07 02 00 00       	push   $0x207
+  8015d6:	50                   	push   %eax
+  8015d7:	6a 0c                	push   $0xc
+  8015d9:	ff 35 08 50 80 00    	push   0x805008
+  8015df:	e8 30 18 00 00       	call   802e14 <ipc_call>
+  8015e4:	83 c4 20             	add    $0x20,%esp
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	78 6a                	js     801655 <fsring_rw+0x161>
+  8015eb:	83 fb 08             	cmp    $0x8,%ebx
+  8015ee:	75 be                	jne    8015ae <fsring_rw+0xba>
+  8015f0:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8015f4:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8015f9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8015fe:	0f 45 c2             	cmovne %edx,%eax
+  801601:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801604:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80160b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801612:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801619:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161e:	be 00 00 00 00       	mov    $0x0,%esi
+  801623:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801626:	e9 4b 01 00 00       	jmp    801776 <fsring_rw+0x282>
+  80162b:	e8 a3 f3 ff ff       	call   8009d3 <sys_time_msec>
+  801630:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801636:	0f 89 f3 fe ff ff    	jns    80152f <fsring_rw+0x3b>
+  80163c:	eb 54                	jmp    801692 <fsring_rw+0x19e>
+  80163e:	83 ec 0c             	sub    $0xc,%esp
+  801641:	6a 02                	push   $0x2
+  801643:	e8 67 19 00 00       	call   802faf <ipc_find_env>
+  801648:	a3 08 50 80 00       	mov    %eax,0x805008
+  80164d:	83 c4 10             	add    $0x10,%esp
+  801650:	e9 e7 fe ff ff       	jmp    80153c <fsring_rw+0x48>
+  801655:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80165a:	83 ec 08             	sub    $0x8,%esp
+  80165d:	53                   	push   %ebx
+  80165e:	6a 00                	push   $0x0
+  801660:	e8 76 f0 ff ff       	call   8006db <sys_page_unmap>
+  801665:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80166b:	83 c4 10             	add    $0x10,%esp
+  80166e:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801674:	75 e4                	jne    80165a <fsring_rw+0x166>
+  801676:	e8 58 f3 ff ff       	call   8009d3 <sys_time_msec>
+  80167b:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801680:	a3 00 50 80 00       	mov    %eax,0x805000
+  801685:	a1 10 50 80 00       	mov    0x805010,%eax
+  80168a:	8b 40 48             	mov    0x48(%eax),%eax
+  80168d:	a3 04 50 80 00       	mov    %eax,0x805004
+  801692:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801699:	e9 7a 01 00 00       	jmp    801818 <fsring_rw+0x324>
+  80169e:	8b 57 0c             	mov    0xc(%edi),%edx
+  8016a1:	89 10                	mov    %edx,(%eax)
+  8016a3:	89 58 04             	mov    %ebx,0x4(%eax)
+  8016a6:	89 f2                	mov    %esi,%edx
+  8016a8:	03 57 04             	add    0x4(%edi),%edx
+  8016ab:	89 50 08             	mov    %edx,0x8(%eax)
+  8016ae:	83 ec 04             	sub    $0x4,%esp
+  8016b1:	53                   	push   %ebx
+  8016b2:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8016b5:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8016b8:	52                   	push   %edx
+  8016b9:	83 c0 0c             	add    $0xc,%eax
+  8016bc:	50                   	push   %eax
+  8016bd:	e8 97 ec ff ff       	call   800359 <memmove>
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016c8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016cb:	89 08                	mov    %ecx,(%eax)
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	68 00 00 f0 cf       	push   $0xcff00000
+  8016d5:	e8 c6 0b 00 00       	call   8022a0 <ipcring_req_push>
+  8016da:	01 de                	add    %ebx,%esi
+  8016dc:	83 c4 10             	add    $0x10,%esp
+  8016df:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8016e2:	73 4c                	jae    801730 <fsring_rw+0x23c>
+  8016e4:	83 ec 0c             	sub    $0xc,%esp
+  8016e7:	68 00 00 f0 cf       	push   $0xcff00000
+  8016ec:	e8 89 0b 00 00       	call   80227a <ipcring_req_slot>
+  8016f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8016f4:	83 c4 10             	add    $0x10,%esp
+  8016f7:	85 c0                	test   %eax,%eax
+  8016f9:	74 35                	je     801730 <fsring_rw+0x23c>
+  8016fb:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801700:	83 e0 07             	and    $0x7,%eax
+  801703:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801708:	c1 e0 0c             	shl    $0xc,%eax
+  80170b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80170e:	29 f3                	sub    %esi,%ebx
+  801710:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801713:	39 cb                	cmp    %ecx,%ebx
+  801715:	0f 47 d9             	cmova  %ecx,%ebx
+  801718:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80171c:	75 80                	jne    80169e <fsring_rw+0x1aa>
+  80171e:	8b 57 0c             	mov    0xc(%edi),%edx
+  801721:	89 10                	mov    %edx,(%eax)
+  801723:	89 58 04             	mov    %ebx,0x4(%eax)
+  801726:	89 f2                	mov    %esi,%edx
+  801728:	03 57 04             	add    0x4(%edi),%edx
+  80172b:	89 50 08             	mov    %edx,0x8(%eax)
+  80172e:	eb 95                	jmp    8016c5 <fsring_rw+0x1d1>
+  801730:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801735:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801738:	83 ec 0c             	sub    $0xc,%esp
+  80173b:	68 00 00 f0 cf       	push   $0xcff00000
+  801740:	e8 94 0b 00 00       	call   8022d9 <ipcring_rsp_wait>
+  801745:	8b 58 04             	mov    0x4(%eax),%ebx
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80174f:	75 45                	jne    801796 <fsring_rw+0x2a2>
+  801751:	85 db                	test   %ebx,%ebx
+  801753:	79 41                	jns    801796 <fsring_rw+0x2a2>
+  801755:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801758:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80175f:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801766:	83 ec 0c             	sub    $0xc,%esp
+  801769:	68 00 00 f0 cf       	push   $0xcff00000
+  80176e:	e8 cc 0b 00 00       	call   80233f <ipcring_rsp_pop>
+  801773:	83 c4 10             	add    $0x10,%esp
+  801776:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80177c:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801781:	39 c2                	cmp    %eax,%edx
+  801783:	74 75                	je     8017fa <fsring_rw+0x306>
+  801785:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801789:	75 a5                	jne    801730 <fsring_rw+0x23c>
+  80178b:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80178e:	0f 82 50 ff ff ff    	jb     8016e4 <fsring_rw+0x1f0>
+  801794:	eb 9a                	jmp    801730 <fsring_rw+0x23c>
+  801796:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80179a:	75 ca                	jne    801766 <fsring_rw+0x272>
+  80179c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8017a0:	74 31                	je     8017d3 <fsring_rw+0x2df>
+  8017a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a5:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8017a8:	29 c8                	sub    %ecx,%eax
+  8017aa:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8017ad:	39 d0                	cmp    %edx,%eax
+  8017af:	0f 47 c2             	cmova  %edx,%eax
+  8017b2:	39 d8                	cmp    %ebx,%eax
+  8017b4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8017b9:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8017bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8017c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017c5:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8017c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8017cc:	01 d9                	add    %ebx,%ecx
+  8017ce:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8017d1:	eb 93                	jmp    801766 <fsring_rw+0x272>
+  8017d3:	83 ec 04             	sub    $0x4,%esp
+  8017d6:	53                   	push   %ebx
+  8017d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017da:	83 e0 07             	and    $0x7,%eax
+  8017dd:	c1 e0 0c             	shl    $0xc,%eax
+  8017e0:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8017e6:	50                   	push   %eax
+  8017e7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8017ea:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8017ed:	01 c8                	add    %ecx,%eax
+  8017ef:	50                   	push   %eax
+  8017f0:	e8 64 eb ff ff       	call   800359 <memmove>
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	eb a8                	jmp    8017a2 <fsring_rw+0x2ae>
+  8017fa:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8017fe:	75 09                	jne    801809 <fsring_rw+0x315>
+  801800:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801803:	0f 82 db fe ff ff    	jb     8016e4 <fsring_rw+0x1f0>
+  801809:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80180c:	01 57 04             	add    %edx,0x4(%edi)
+  80180f:	85 d2                	test   %edx,%edx
+  801811:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801815:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801818:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80181b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80181e:	5b                   	pop    %ebx
+  80181f:	5e                   	pop    %esi
+  801820:	5f                   	pop    %edi
+  801821:	5d                   	pop    %ebp
+  801822:	c3                   	ret
+
+00801823 <devfile_write>:
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	57                   	push   %edi
+  801827:	56                   	push   %esi
+  801828:	53                   	push   %ebx
+  801829:	83 ec 0c             	sub    $0xc,%esp
+  80182c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80182f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801832:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801835:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80183b:	76 1a                	jbe    801857 <devfile_write+0x34>
+  80183d:	83 ec 0c             	sub    $0xc,%esp
+  801840:	53                   	push   %ebx
+  801841:	89 f1                	mov    %esi,%ecx
+  801843:	ba 06 00 00 00       	mov    $0x6,%edx
+  801848:	89 f8                	mov    %edi,%eax
+  80184a:	e8 a5 fc ff ff       	call   8014f4 <fsring_rw>
+  80184f:	83 c4 10             	add    $0x10,%esp
+  801852:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801855:	75 39                	jne    801890 <devfile_write+0x6d>
+  801857:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80185c:	39 c3                	cmp    %eax,%ebx
+  80185e:	0f 47 d8             	cmova  %eax,%ebx
+  801861:	8b 47 0c             	mov    0xc(%edi),%eax
+  801864:	a3 00 60 80 00       	mov    %eax,0x806000
+  801869:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80186f:	83 ec 04             	sub    $0x4,%esp
+  801872:	53                   	push   %ebx
+  801873:	56                   	push   %esi
+  801874:	68 08 60 80 00       	push   $0x806008
+  801879:	e8 db ea ff ff       	call   800359 <memmove>
+  80187e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801883:	b8 04 00 00 00       	mov    $0x4,%eax
+  801888:	e8 7c fb ff ff       	call   801409 <fsipc>
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801893:	5b                   	pop    %ebx
+  801894:	5e                   	pop    %esi
+  801895:	5f                   	pop    %edi
+  801896:	5d                   	pop    %ebp
+  801897:	c3                   	ret
+
+00801898 <devfile_read>:
+  801898:	55                   	push   %ebp
+  801899:	89 e5                	mov    %esp,%ebp
+  80189b:	57                   	push   %edi
+  80189c:	56                   	push   %esi
+  80189d:	53                   	push   %ebx
+  80189e:	83 ec 0c             	sub    $0xc,%esp
+  8018a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018a4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8018a7:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8018ad:	76 1d                	jbe    8018cc <devfile_read+0x34>
+  8018af:	83 ec 0c             	sub    $0xc,%esp
+  8018b2:	56                   	push   %esi
+  8018b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b6:	ba 05 00 00 00       	mov    $0x5,%edx
+  8018bb:	89 f8                	mov    %edi,%eax
+  8018bd:	e8 32 fc ff ff       	call   8014f4 <fsring_rw>
+  8018c2:	89 c3                	mov    %eax,%ebx
+  8018c4:	83 c4 10             	add    $0x10,%esp
+  8018c7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8018ca:	75 37                	jne    801903 <devfile_read+0x6b>
+  8018cc:	8b 47 0c             	mov    0xc(%edi),%eax
+  8018cf:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018d4:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8018da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018df:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018e4:	e8 20 fb ff ff       	call   801409 <fsipc>
+  8018e9:	89 c3                	mov    %eax,%ebx
+  8018eb:	85 c0                	test   %eax,%eax
+  8018ed:	78 14                	js     801903 <devfile_read+0x6b>
+  8018ef:	83 ec 04             	sub    $0x4,%esp
+  8018f2:	50                   	push   %eax
+  8018f3:	68 00 60 80 00       	push   $0x806000
+  8018f8:	ff 75 0c             	push   0xc(%ebp)
+  8018fb:	e8 59 ea ff ff       	call   800359 <memmove>
+  801900:	83 c4 10             	add    $0x10,%esp
+  801903:	89 d8                	mov    %ebx,%eax
+  801905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801908:	5b                   	pop    %ebx
+  801909:	5e                   	pop    %esi
+  80190a:	5f                   	pop    %edi
+  80190b:	5d                   	pop    %ebp
+  80190c:	c3                   	ret
+
+0080190d <open>:
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	56                   	push   %esi
+  801911:	53                   	push   %ebx
+  801912:	83 ec 1c             	sub    $0x1c,%esp
+  801915:	8b 75 08             	mov    0x8(%ebp),%esi
+  801918:	56                   	push   %esi
+  801919:	e8 3f e8 ff ff       	call   80015d <strlen>
+  80191e:	83 c4 10             	add    $0x10,%esp
+  801921:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801926:	7f 6c                	jg     801994 <open+0x87>
+  801928:	83 ec 0c             	sub    $0xc,%esp
+  80192b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80192e:	50                   	push   %eax
+  80192f:	e8 6a f5 ff ff       	call   800e9e <fd_alloc>
+  801934:	89 c3                	mov    %eax,%ebx
+  801936:	83 c4 10             	add    $0x10,%esp
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	78 3c                	js     801979 <open+0x6c>
+  80193d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801940:	a3 00 64 80 00       	mov    %eax,0x806400
+  801945:	83 ec 08             	sub    $0x8,%esp
+  801948:	56                   	push   %esi
+  801949:	68 00 60 80 00       	push   $0x806000
+  80194e:	e8 56 e8 ff ff       	call   8001a9 <strcpy>
+  801953:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801956:	b8 01 00 00 00       	mov    $0x1,%eax
+  80195b:	e8 a9 fa ff ff       	call   801409 <fsipc>
+  801960:	89 c3                	mov    %eax,%ebx
+  801962:	83 c4 10             	add    $0x10,%esp
+  801965:	85 c0                	test   %eax,%eax
+  801967:	78 19                	js     801982 <open+0x75>
+  801969:	83 ec 0c             	sub    $0xc,%esp
+  80196c:	ff 75 f4             	push   -0xc(%ebp)
+  80196f:	e8 03 f5 ff ff       	call   800e77 <fd2num>
+  801974:	89 c3                	mov    %eax,%ebx
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	89 d8                	mov    %ebx,%eax
+  80197b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197e:	5b                   	pop    %ebx
+  80197f:	5e                   	pop    %esi
+  801980:	5d                   	pop    %ebp
+  801981:	c3                   	ret
+  801982:	83 ec 08             	sub    $0x8,%esp
+  801985:	6a 00                	push   $0x0
+  801987:	ff 75 f4             	push   -0xc(%ebp)
+  80198a:	e8 05 f6 ff ff       	call   800f94 <fd_close>
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	eb e5                	jmp    801979 <open+0x6c>
+  801994:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801999:	eb de                	jmp    801979 <open+0x6c>
+
+0080199b <file_image>:
+  80199b:	55                   	push   %ebp
+  80199c:	89 e5                	mov    %esp,%ebp
+  80199e:	53                   	push   %ebx
+  80199f:	83 ec 1c             	sub    $0x1c,%esp
+  8019a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a8:	50                   	push   %eax
+  8019a9:	ff 75 08             	push   0x8(%ebp)
+  8019ac:	e8 3d f5 ff ff       	call   800eee <fd_lookup>
+  8019b1:	83 c4 10             	add    $0x10,%esp
+  8019b4:	85 c0                	test   %eax,%eax
+  8019b6:	78 58                	js     801a10 <file_image+0x75>
+  8019b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019bb:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8019c1:	39 08                	cmp    %ecx,(%eax)
+  8019c3:	75 50                	jne    801a15 <file_image+0x7a>
+  8019c5:	83 fb 04             	cmp    $0x4,%ebx
+  8019c8:	77 52                	ja     801a1c <file_image+0x81>
+  8019ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019cd:	a3 00 60 80 00       	mov    %eax,0x806000
+  8019d2:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8019d8:	83 ec 04             	sub    $0x4,%esp
+  8019db:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8019de:	c1 e0 02             	shl    $0x2,%eax
+  8019e1:	50                   	push   %eax
+  8019e2:	ff 75 0c             	push   0xc(%ebp)
+  8019e5:	68 08 60 80 00       	push   $0x806008
+  8019ea:	e8 6a e9 ff ff       	call   800359 <memmove>
+  8019ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8019f9:	e8 0b fa ff ff       	call   801409 <fsipc>
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 0b                	js     801a10 <file_image+0x75>
+  801a05:	8b 55 14             	mov    0x14(%ebp),%edx
+  801a08:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  801a0e:	89 0a                	mov    %ecx,(%edx)
+  801a10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a13:	c9                   	leave
+  801a14:	c3                   	ret
+  801a15:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a1a:	eb f4                	jmp    801a10 <file_image+0x75>
+  801a1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a21:	eb ed                	jmp    801a10 <file_image+0x75>
+
+00801a23 <remove>:
+  801a23:	55                   	push   %ebp
+  801a24:	89 e5                	mov    %esp,%ebp
+  801a26:	53                   	push   %ebx
+  801a27:	83 ec 10             	sub    $0x10,%esp
+  801a2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a2d:	53                   	push   %ebx
+  801a2e:	e8 2a e7 ff ff       	call   80015d <strlen>
+  801a33:	83 c4 10             	add    $0x10,%esp
+  801a36:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a3b:	7f 25                	jg     801a62 <remove+0x3f>
+  801a3d:	83 ec 08             	sub    $0x8,%esp
+  801a40:	53                   	push   %ebx
+  801a41:	68 00 60 80 00       	push   $0x806000
+  801a46:	e8 5e e7 ff ff       	call   8001a9 <strcpy>
+  801a4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a50:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a55:	e8 af f9 ff ff       	call   801409 <fsipc>
+  801a5a:	83 c4 10             	add    $0x10,%esp
+  801a5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a60:	c9                   	leave
+  801a61:	c3                   	ret
+  801a62:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801a67:	eb f4                	jmp    801a5d <remove+0x3a>
+
+00801a69 <sync>:
+  801a69:	55                   	push   %ebp
+  801a6a:	89 e5                	mov    %esp,%ebp
+  801a6c:	83 ec 08             	sub    $0x8,%esp
+  801a6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a74:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a79:	e8 8b f9 ff ff       	call   801409 <fsipc>
+  801a7e:	c9                   	leave
+  801a7f:	c3                   	ret
+
+00801a80 <devsock_stat>:
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	83 ec 10             	sub    $0x10,%esp
+  801a86:	68 ec 32 80 00       	push   $0x8032ec
+  801a8b:	ff 75 0c             	push   0xc(%ebp)
+  801a8e:	e8 16 e7 ff ff       	call   8001a9 <strcpy>
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a98:	c9                   	leave
+  801a99:	c3                   	ret
+
+00801a9a <devsock_close>:
+  801a9a:	55                   	push   %ebp
+  801a9b:	89 e5                	mov    %esp,%ebp
+  801a9d:	53                   	push   %ebx
+  801a9e:	83 ec 10             	sub    $0x10,%esp
+  801aa1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801aa4:	53                   	push   %ebx
+  801aa5:	e8 1f 15 00 00       	call   802fc9 <pageref>
+  801aaa:	89 c2                	mov    %eax,%edx
+  801aac:	83 c4 10             	add    $0x10,%esp
+  801aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab4:	83 fa 01             	cmp    $0x1,%edx
+  801ab7:	74 05                	je     801abe <devsock_close+0x24>
+  801ab9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801abc:	c9                   	leave
+  801abd:	c3                   	ret
+  801abe:	83 ec 0c             	sub    $0xc,%esp
+  801ac1:	ff 73 0c             	push   0xc(%ebx)
+  801ac4:	e8 aa 02 00 00       	call   801d73 <nsipc_close>
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	eb eb                	jmp    801ab9 <devsock_close+0x1f>
+
+00801ace <devsock_write>:
+  801ace:	55                   	push   %ebp
+  801acf:	89 e5                	mov    %esp,%ebp
+  801ad1:	83 ec 08             	sub    $0x8,%esp
+  801ad4:	6a 00                	push   $0x0
+  801ad6:	ff 75 10             	push   0x10(%ebp)
+  801ad9:	ff 75 0c             	push   0xc(%ebp)
+  801adc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adf:	ff 70 0c             	push   0xc(%eax)
+  801ae2:	e8 6c 03 00 00       	call   801e53 <nsipc_send>
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+00801ae9 <devsock_read>:
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	83 ec 08             	sub    $0x8,%esp
+  801aef:	6a 00                	push   $0x0
+  801af1:	ff 75 10             	push   0x10(%ebp)
+  801af4:	ff 75 0c             	push   0xc(%ebp)
+  801af7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afa:	ff 70 0c             	push   0xc(%eax)
+  801afd:	e8 e2 02 00 00       	call   801de4 <nsipc_recv>
+  801b02:	c9                   	leave
+  801b03:	c3                   	ret
+
+00801b04 <fd2sockid>:
+  801b04:	55                   	push   %ebp
+  801b05:	89 e5                	mov    %esp,%ebp
+  801b07:	83 ec 20             	sub    $0x20,%esp
+  801b0a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b0d:	52                   	push   %edx
+  801b0e:	50                   	push   %eax
+  801b0f:	e8 da f3 ff ff       	call   800eee <fd_lookup>
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	85 c0                	test   %eax,%eax
+  801b19:	78 10                	js     801b2b <fd2sockid+0x27>
+  801b1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b1e:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801b24:	39 08                	cmp    %ecx,(%eax)
+  801b26:	75 05                	jne    801b2d <fd2sockid+0x29>
+  801b28:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2b:	c9                   	leave
+  801b2c:	c3                   	ret
+  801b2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b32:	eb f7                	jmp    801b2b <fd2sockid+0x27>
+
+00801b34 <alloc_sockfd>:
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	56                   	push   %esi
+  801b38:	53                   	push   %ebx
+  801b39:	83 ec 1c             	sub    $0x1c,%esp
+  801b3c:	89 c6                	mov    %eax,%esi
+  801b3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b41:	50                   	push   %eax
+  801b42:	e8 57 f3 ff ff       	call   800e9e <fd_alloc>
+  801b47:	89 c3                	mov    %eax,%ebx
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 43                	js     801b93 <alloc_sockfd+0x5f>
+  801b50:	83 ec 04             	sub    $0x4,%esp
+  801b53:	68 07 04 00 00       	push   $0x407
+  801b58:	ff 75 f4             	push   -0xc(%ebp)
+  801b5b:	6a 00                	push   $0x0
+  801b5d:	e8 a7 ea ff ff       	call   800609 <sys_page_alloc>
+  801b62:	89 c3                	mov    %eax,%ebx
+  801b64:	83 c4 10             	add    $0x10,%esp
+  801b67:	85 c0                	test   %eax,%eax
+  801b69:	78 28                	js     801b93 <alloc_sockfd+0x5f>
+  801b6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6e:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801b74:	89 10                	mov    %edx,(%eax)
+  801b76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b79:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801b80:	89 70 0c             	mov    %esi,0xc(%eax)
+  801b83:	83 ec 0c             	sub    $0xc,%esp
+  801b86:	50                   	push   %eax
+  801b87:	e8 eb f2 ff ff       	call   800e77 <fd2num>
+  801b8c:	89 c3                	mov    %eax,%ebx
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	eb 0c                	jmp    801b9f <alloc_sockfd+0x6b>
+  801b93:	83 ec 0c             	sub    $0xc,%esp
+  801b96:	56                   	push   %esi
+  801b97:	e8 d7 01 00 00       	call   801d73 <nsipc_close>
+  801b9c:	83 c4 10             	add    $0x10,%esp
+  801b9f:	89 d8                	mov    %ebx,%eax
+  801ba1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba4:	5b                   	pop    %ebx
+  801ba5:	5e                   	pop    %esi
+  801ba6:	5d                   	pop    %ebp
+  801ba7:	c3                   	ret
+
+00801ba8 <accept>:
+  801ba8:	55                   	push   %ebp
+  801ba9:	89 e5                	mov    %esp,%ebp
+  801bab:	83 ec 08             	sub    $0x8,%esp
+  801bae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb1:	e8 4e ff ff ff       	call   801b04 <fd2sockid>
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	78 1b                	js     801bd5 <accept+0x2d>
+  801bba:	83 ec 04             	sub    $0x4,%esp
+  801bbd:	ff 75 10             	push   0x10(%ebp)
+  801bc0:	ff 75 0c             	push   0xc(%ebp)
+  801bc3:	50                   	push   %eax
+  801bc4:	e8 07 01 00 00       	call   801cd0 <nsipc_accept>
+  801bc9:	83 c4 10             	add    $0x10,%esp
+  801bcc:	85 c0                	test   %eax,%eax
+  801bce:	78 05                	js     801bd5 <accept+0x2d>
+  801bd0:	e8 5f ff ff ff       	call   801b34 <alloc_sockfd>
+  801bd5:	c9                   	leave
+  801bd6:	c3                   	ret
+
+00801bd7 <bind>:
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	83 ec 08             	sub    $0x8,%esp
+  801bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be0:	e8 1f ff ff ff       	call   801b04 <fd2sockid>
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	78 12                	js     801bfb <bind+0x24>
+  801be9:	83 ec 04             	sub    $0x4,%esp
+  801bec:	ff 75 10             	push   0x10(%ebp)
+  801bef:	ff 75 0c             	push   0xc(%ebp)
+  801bf2:	50                   	push   %eax
+  801bf3:	e8 24 01 00 00       	call   801d1c <nsipc_bind>
+  801bf8:	83 c4 10             	add    $0x10,%esp
+  801bfb:	c9                   	leave
+  801bfc:	c3                   	ret
+
+00801bfd <shutdown>:
+  801bfd:	55                   	push   %ebp
+  801bfe:	89 e5                	mov    %esp,%ebp
+  801c00:	83 ec 08             	sub    $0x8,%esp
+  801c03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c06:	e8 f9 fe ff ff       	call   801b04 <fd2sockid>
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	78 0f                	js     801c1e <shutdown+0x21>
+  801c0f:	83 ec 08             	sub    $0x8,%esp
+  801c12:	ff 75 0c             	push   0xc(%ebp)
+  801c15:	50                   	push   %eax
+  801c16:	e8 36 01 00 00       	call   801d51 <nsipc_shutdown>
+  801c1b:	83 c4 10             	add    $0x10,%esp
+  801c1e:	c9                   	leave
+  801c1f:	c3                   	ret
+
+00801c20 <connect>:
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	83 ec 08             	sub    $0x8,%esp
+  801c26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c29:	e8 d6 fe ff ff       	call   801b04 <fd2sockid>
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	78 12                	js     801c44 <connect+0x24>
+  801c32:	83 ec 04             	sub    $0x4,%esp
+  801c35:	ff 75 10             	push   0x10(%ebp)
+  801c38:	ff 75 0c             	push   0xc(%ebp)
+  801c3b:	50                   	push   %eax
+  801c3c:	e8 4c 01 00 00       	call   801d8d <nsipc_connect>
+  801c41:	83 c4 10             	add    $0x10,%esp
+  801c44:	c9                   	leave
+  801c45:	c3                   	ret
+
+00801c46 <listen>:
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	83 ec 08             	sub    $0x8,%esp
+  801c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4f:	e8 b0 fe ff ff       	call   801b04 <fd2sockid>
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	78 0f                	js     801c67 <listen+0x21>
+  801c58:	83 ec 08             	sub    $0x8,%esp
+  801c5b:	ff 75 0c             	push   0xc(%ebp)
+  801c5e:	50                   	push   %eax
+  801c5f:	e8 5e 01 00 00       	call   801dc2 <nsipc_listen>
+  801c64:	83 c4 10             	add    $0x10,%esp
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+00801c69 <socket>:
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	83 ec 0c             	sub    $0xc,%esp
+  801c6f:	ff 75 10             	push   0x10(%ebp)
+  801c72:	ff 75 0c             	push   0xc(%ebp)
+  801c75:	ff 75 08             	push   0x8(%ebp)
+  801c78:	e8 34 02 00 00       	call   801eb1 <nsipc_socket>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	78 05                	js     801c89 <socket+0x20>
+  801c84:	e8 ab fe ff ff       	call   801b34 <alloc_sockfd>
+  801c89:	c9                   	leave
+  801c8a:	c3                   	ret
+
+00801c8b <nsipc>:
+  801c8b:	55                   	push   %ebp
+  801c8c:	89 e5                	mov    %esp,%ebp
+  801c8e:	53                   	push   %ebx
+  801c8f:	83 ec 04             	sub    $0x4,%esp
+  801c92:	89 c3                	mov    %eax,%ebx
+  801c94:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801c9b:	74 1f                	je     801cbc <nsipc+0x31>
+  801c9d:	83 ec 08             	sub    $0x8,%esp
+  801ca0:	6a 00                	push   $0x0
+  801ca2:	6a 00                	push   $0x0
+  801ca4:	6a 07                	push   $0x7
+  801ca6:	68 00 70 80 00       	push   $0x807000
+  801cab:	53                   	push   %ebx
+  801cac:	ff 35 0c 50 80 00    	push   0x80500c
+  801cb2:	e8 5d 11 00 00       	call   802e14 <ipc_call>
+  801cb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cba:	c9                   	leave
+  801cbb:	c3                   	ret
+  801cbc:	83 ec 0c             	sub    $0xc,%esp
+  801cbf:	6a 03                	push   $0x3
+  801cc1:	e8 e9 12 00 00       	call   802faf <ipc_find_env>
+  801cc6:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801ccb:	83 c4 10             	add    $0x10,%esp
+  801cce:	eb cd                	jmp    801c9d <nsipc+0x12>
+
+00801cd0 <nsipc_accept>:
+  801cd0:	55                   	push   %ebp
+  801cd1:	89 e5                	mov    %esp,%ebp
+  801cd3:	53                   	push   %ebx
+  801cd4:	83 ec 04             	sub    $0x4,%esp
+  801cd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cda:	a3 00 70 80 00       	mov    %eax,0x807000
+  801cdf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ce4:	e8 a2 ff ff ff       	call   801c8b <nsipc>
+  801ce9:	89 c3                	mov    %eax,%ebx
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	79 07                	jns    801cf6 <nsipc_accept+0x26>
+  801cef:	89 d8                	mov    %ebx,%eax
+  801cf1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf4:	c9                   	leave
+  801cf5:	c3                   	ret
+  801cf6:	83 ec 04             	sub    $0x4,%esp
+  801cf9:	ff 35 10 70 80 00    	push   0x807010
+  801cff:	68 00 70 80 00       	push   $0x807000
+  801d04:	ff 75 0c             	push   0xc(%ebp)
+  801d07:	e8 4d e6 ff ff       	call   800359 <memmove>
+  801d0c:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d12:	8b 45 10             	mov    0x10(%ebp),%eax
+  801d15:	89 10                	mov    %edx,(%eax)
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	eb d3                	jmp    801cef <nsipc_accept+0x1f>
+
+00801d1c <nsipc_bind>:
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	53                   	push   %ebx
+  801d20:	83 ec 08             	sub    $0x8,%esp
+  801d23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d29:	a3 00 70 80 00       	mov    %eax,0x807000
+  801d2e:	53                   	push   %ebx
+  801d2f:	ff 75 0c             	push   0xc(%ebp)
+  801d32:	68 04 70 80 00       	push   $0x807004
+  801d37:	e8 1d e6 ff ff       	call   800359 <memmove>
+  801d3c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801d42:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d47:	e8 3f ff ff ff       	call   801c8b <nsipc>
+  801d4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4f:	c9                   	leave
+  801d50:	c3                   	ret
+
+00801d51 <nsipc_shutdown>:
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	83 ec 08             	sub    $0x8,%esp
+  801d57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5a:	a3 00 70 80 00       	mov    %eax,0x807000
+  801d5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d62:	a3 04 70 80 00       	mov    %eax,0x807004
+  801d67:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d6c:	e8 1a ff ff ff       	call   801c8b <nsipc>
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+
+00801d73 <nsipc_close>:
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	83 ec 08             	sub    $0x8,%esp
+  801d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801d81:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d86:	e8 00 ff ff ff       	call   801c8b <nsipc>
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+00801d8d <nsipc_connect>:
+  801d8d:	55                   	push   %ebp
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 08             	sub    $0x8,%esp
+  801d94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d97:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9a:	a3 00 70 80 00       	mov    %eax,0x807000
+  801d9f:	53                   	push   %ebx
+  801da0:	ff 75 0c             	push   0xc(%ebp)
+  801da3:	68 04 70 80 00       	push   $0x807004
+  801da8:	e8 ac e5 ff ff       	call   800359 <memmove>
+  801dad:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801db3:	b8 05 00 00 00       	mov    $0x5,%eax
+  801db8:	e8 ce fe ff ff       	call   801c8b <nsipc>
+  801dbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc0:	c9                   	leave
+  801dc1:	c3                   	ret
+
+00801dc2 <nsipc_listen>:
+  801dc2:	55                   	push   %ebp
+  801dc3:	89 e5                	mov    %esp,%ebp
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+  801dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcb:	a3 00 70 80 00       	mov    %eax,0x807000
+  801dd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dd3:	a3 04 70 80 00       	mov    %eax,0x807004
+  801dd8:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ddd:	e8 a9 fe ff ff       	call   801c8b <nsipc>
+  801de2:	c9                   	leave
+  801de3:	c3                   	ret
+
+00801de4 <nsipc_recv>:
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	56                   	push   %esi
+  801de8:	53                   	push   %ebx
+  801de9:	8b 75 10             	mov    0x10(%ebp),%esi
+  801dec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801def:	a3 00 70 80 00       	mov    %eax,0x807000
+  801df4:	89 35 04 70 80 00    	mov    %esi,0x807004
+  801dfa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dfd:	a3 08 70 80 00       	mov    %eax,0x807008
+  801e02:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e07:	e8 7f fe ff ff       	call   801c8b <nsipc>
+  801e0c:	89 c3                	mov    %eax,%ebx
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 22                	js     801e34 <nsipc_recv+0x50>
+  801e12:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801e17:	39 c6                	cmp    %eax,%esi
+  801e19:	0f 4e c6             	cmovle %esi,%eax
+  801e1c:	39 c3                	cmp    %eax,%ebx
+  801e1e:	7f 1d                	jg     801e3d <nsipc_recv+0x59>
+  801e20:	83 ec 04             	sub    $0x4,%esp
+  801e23:	53                   	push   %ebx
+  801e24:	68 00 70 80 00       	push   $0x807000
+  801e29:	ff 75 0c             	push   0xc(%ebp)
+  801e2c:	e8 28 e5 ff ff       	call   800359 <memmove>
+  801e31:	83 c4 10             	add    $0x10,%esp
+  801e34:	89 d8                	mov    %ebx,%eax
+  801e36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e39:	5b                   	pop    %ebx
+  801e3a:	5e                   	pop    %esi
+  801e3b:	5d                   	pop    %ebp
+  801e3c:	c3                   	ret
+  801e3d:	68 f8 32 80 00       	push   $0x8032f8
+  801e42:	68 0d 33 80 00       	push   $0x80330d
+  801e47:	6a 60                	push   $0x60
+  801e49:	68 22 33 80 00       	push   $0x803322
+  801e4e:	e8 83 07 00 00       	call   8025d6 <_panic>
+
+00801e53 <nsipc_send>:
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	53                   	push   %ebx
+  801e57:	83 ec 04             	sub    $0x4,%esp
+  801e5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e60:	a3 00 70 80 00       	mov    %eax,0x807000
+  801e65:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801e6b:	7f 2e                	jg     801e9b <nsipc_send+0x48>
+  801e6d:	83 ec 04             	sub    $0x4,%esp
+  801e70:	53                   	push   %ebx
+  801e71:	ff 75 0c             	push   0xc(%ebp)
+  801e74:	68 0c 70 80 00       	push   $0x80700c
+  801e79:	e8 db e4 ff ff       	call   800359 <memmove>
+  801e7e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801e84:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e87:	a3 08 70 80 00       	mov    %eax,0x807008
+  801e8c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e91:	e8 f5 fd ff ff       	call   801c8b <nsipc>
+  801e96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e99:	c9                   	leave
+  801e9a:	c3                   	ret
+  801e9b:	68 2e 33 80 00       	push   $0x80332e
+  801ea0:	68 0d 33 80 00       	push   $0x80330d
+  801ea5:	6a 6b                	push   $0x6b
+  801ea7:	68 22 33 80 00       	push   $0x803322
+  801eac:	e8 25 07 00 00       	call   8025d6 <_panic>
+
+00801eb1 <nsipc_socket>:
+  801eb1:	55                   	push   %ebp
+  801eb2:	89 e5                	mov    %esp,%ebp
+  801eb4:	83 ec 08             	sub    $0x8,%esp
+  801eb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eba:	a3 00 70 80 00       	mov    %eax,0x807000
+  801ebf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ec2:	a3 04 70 80 00       	mov    %eax,0x807004
+  801ec7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801eca:	a3 08 70 80 00       	mov    %eax,0x807008
+  801ecf:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ed4:	e8 b2 fd ff ff       	call   801c8b <nsipc>
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+
+00801edb <devpipe_stat>:
+  801edb:	55                   	push   %ebp
+  801edc:	89 e5                	mov    %esp,%ebp
+  801ede:	56                   	push   %esi
+  801edf:	53                   	push   %ebx
+  801ee0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801ee3:	83 ec 0c             	sub    $0xc,%esp
+  801ee6:	ff 75 08             	push   0x8(%ebp)
+  801ee9:	e8 99 ef ff ff       	call   800e87 <fd2data>
+  801eee:	89 c6                	mov    %eax,%esi
+  801ef0:	83 c4 08             	add    $0x8,%esp
+  801ef3:	68 3a 33 80 00       	push   $0x80333a
+  801ef8:	53                   	push   %ebx
+  801ef9:	e8 ab e2 ff ff       	call   8001a9 <strcpy>
+  801efe:	8b 46 04             	mov    0x4(%esi),%eax
+  801f01:	2b 06                	sub    (%esi),%eax
+  801f03:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801f09:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f10:	00 00 00 
+  801f13:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801f1a:	40 80 00 
+  801f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f25:	5b                   	pop    %ebx
+  801f26:	5e                   	pop    %esi
+  801f27:	5d                   	pop    %ebp
+  801f28:	c3                   	ret
+
+00801f29 <devpipe_close>:
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	53                   	push   %ebx
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f33:	53                   	push   %ebx
+  801f34:	6a 00                	push   $0x0
+  801f36:	e8 a0 e7 ff ff       	call   8006db <sys_page_unmap>
+  801f3b:	89 1c 24             	mov    %ebx,(%esp)
+  801f3e:	e8 44 ef ff ff       	call   800e87 <fd2data>
+  801f43:	83 c4 08             	add    $0x8,%esp
+  801f46:	50                   	push   %eax
+  801f47:	6a 00                	push   $0x0
+  801f49:	e8 8d e7 ff ff       	call   8006db <sys_page_unmap>
+  801f4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+
+00801f53 <_pipeisclosed>:
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	57                   	push   %edi
+  801f57:	56                   	push   %esi
+  801f58:	53                   	push   %ebx
+  801f59:	83 ec 1c             	sub    $0x1c,%esp
+  801f5c:	89 c7                	mov    %eax,%edi
+  801f5e:	89 d6                	mov    %edx,%esi
+  801f60:	a1 10 50 80 00       	mov    0x805010,%eax
+  801f65:	8b 58 58             	mov    0x58(%eax),%ebx
+  801f68:	83 ec 0c             	sub    $0xc,%esp
+  801f6b:	57                   	push   %edi
+  801f6c:	e8 58 10 00 00       	call   802fc9 <pageref>
+  801f71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f74:	89 34 24             	mov    %esi,(%esp)
+  801f77:	e8 4d 10 00 00       	call   802fc9 <pageref>
+  801f7c:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801f82:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801f85:	83 c4 10             	add    $0x10,%esp
+  801f88:	39 cb                	cmp    %ecx,%ebx
+  801f8a:	74 1b                	je     801fa7 <_pipeisclosed+0x54>
+  801f8c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801f8f:	75 cf                	jne    801f60 <_pipeisclosed+0xd>
+  801f91:	8b 42 58             	mov    0x58(%edx),%eax
+  801f94:	6a 01                	push   $0x1
+  801f96:	50                   	push   %eax
+  801f97:	53                   	push   %ebx
+  801f98:	68 41 33 80 00       	push   $0x803341
+  801f9d:	e8 0f 07 00 00       	call   8026b1 <cprintf>
+  801fa2:	83 c4 10             	add    $0x10,%esp
+  801fa5:	eb b9                	jmp    801f60 <_pipeisclosed+0xd>
+  801fa7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801faa:	0f 94 c0             	sete   %al
+  801fad:	0f b6 c0             	movzbl %al,%eax
+  801fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb3:	5b                   	pop    %ebx
+  801fb4:	5e                   	pop    %esi
+  801fb5:	5f                   	pop    %edi
+  801fb6:	5d                   	pop    %ebp
+  801fb7:	c3                   	ret
+
+00801fb8 <devpipe_write>:
+  801fb8:	55                   	push   %ebp
+  801fb9:	89 e5                	mov    %esp,%ebp
+  801fbb:	57                   	push   %edi
+  801fbc:	56                   	push   %esi
+  801fbd:	53                   	push   %ebx
+  801fbe:	83 ec 28             	sub    $0x28,%esp
+  801fc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc4:	56                   	push   %esi
+  801fc5:	e8 bd ee ff ff       	call   800e87 <fd2data>
+  801fca:	89 c3                	mov    %eax,%ebx
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801fd8:	74 5c                	je     802036 <devpipe_write+0x7e>
+  801fda:	8b 43 04             	mov    0x4(%ebx),%eax
+  801fdd:	8b 0b                	mov    (%ebx),%ecx
+  801fdf:	8d 51 20             	lea    0x20(%ecx),%edx
+  801fe2:	39 d0                	cmp    %edx,%eax
+  801fe4:	72 1e                	jb     802004 <devpipe_write+0x4c>
+  801fe6:	89 da                	mov    %ebx,%edx
+  801fe8:	89 f0                	mov    %esi,%eax
+  801fea:	e8 64 ff ff ff       	call   801f53 <_pipeisclosed>
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	75 48                	jne    80203b <devpipe_write+0x83>
+  801ff3:	e8 c6 e5 ff ff       	call   8005be <sys_yield>
+  801ff8:	8b 43 04             	mov    0x4(%ebx),%eax
+  801ffb:	8b 0b                	mov    (%ebx),%ecx
+  801ffd:	8d 51 20             	lea    0x20(%ecx),%edx
+  802000:	39 d0                	cmp    %edx,%eax
+  802002:	73 e2                	jae    801fe6 <devpipe_write+0x2e>
+  802004:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802007:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80200b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80200e:	89 c2                	mov    %eax,%edx
+  802010:	c1 fa 1f             	sar    $0x1f,%edx
+  802013:	89 d1                	mov    %edx,%ecx
+  802015:	c1 e9 1b             	shr    $0x1b,%ecx
+  802018:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80201b:	83 e2 1f             	and    $0x1f,%edx
+  80201e:	29 ca                	sub    %ecx,%edx
+  802020:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802024:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802028:	83 c0 01             	add    $0x1,%eax
+  80202b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80202e:	83 c7 01             	add    $0x1,%edi
+  802031:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802034:	75 a4                	jne    801fda <devpipe_write+0x22>
+  802036:	8b 45 10             	mov    0x10(%ebp),%eax
+  802039:	eb 05                	jmp    802040 <devpipe_write+0x88>
+  80203b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802043:	5b                   	pop    %ebx
+  802044:	5e                   	pop    %esi
+  802045:	5f                   	pop    %edi
+  802046:	5d                   	pop    %ebp
+  802047:	c3                   	ret
+
+00802048 <devpipe_read>:
+  802048:	55                   	push   %ebp
+  802049:	89 e5                	mov    %esp,%ebp
+  80204b:	57                   	push   %edi
+  80204c:	56                   	push   %esi
+  80204d:	53                   	push   %ebx
+  80204e:	83 ec 18             	sub    $0x18,%esp
+  802051:	8b 75 08             	mov    0x8(%ebp),%esi
+  802054:	56                   	push   %esi
+  802055:	e8 2d ee ff ff       	call   800e87 <fd2data>
+  80205a:	89 c3                	mov    %eax,%ebx
+  80205c:	83 c4 10             	add    $0x10,%esp
+  80205f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802064:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802068:	74 45                	je     8020af <devpipe_read+0x67>
+  80206a:	8b 03                	mov    (%ebx),%eax
+  80206c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80206f:	75 1d                	jne    80208e <devpipe_read+0x46>
+  802071:	85 ff                	test   %edi,%edi
+  802073:	75 3f                	jne    8020b4 <devpipe_read+0x6c>
+  802075:	89 da                	mov    %ebx,%edx
+  802077:	89 f0                	mov    %esi,%eax
+  802079:	e8 d5 fe ff ff       	call   801f53 <_pipeisclosed>
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	75 3c                	jne    8020be <devpipe_read+0x76>
+  802082:	e8 37 e5 ff ff       	call   8005be <sys_yield>
+  802087:	8b 03                	mov    (%ebx),%eax
+  802089:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80208c:	74 e7                	je     802075 <devpipe_read+0x2d>
+  80208e:	99                   	cltd
+  80208f:	c1 ea 1b             	shr    $0x1b,%edx
+  802092:	01 d0                	add    %edx,%eax
+  802094:	83 e0 1f             	and    $0x1f,%eax
+  802097:	29 d0                	sub    %edx,%eax
+  802099:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80209e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020a1:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8020a4:	83 03 01             	addl   $0x1,(%ebx)
+  8020a7:	83 c7 01             	add    $0x1,%edi
+  8020aa:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8020ad:	75 bb                	jne    80206a <devpipe_read+0x22>
+  8020af:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020b2:	eb 02                	jmp    8020b6 <devpipe_read+0x6e>
+  8020b4:	89 f8                	mov    %edi,%eax
+  8020b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b9:	5b                   	pop    %ebx
+  8020ba:	5e                   	pop    %esi
+  8020bb:	5f                   	pop    %edi
+  8020bc:	5d                   	pop    %ebp
+  8020bd:	c3                   	ret
+  8020be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c3:	eb f1                	jmp    8020b6 <devpipe_read+0x6e>
+
+008020c5 <pipe>:
+  8020c5:	55                   	push   %ebp
+  8020c6:	89 e5                	mov    %esp,%ebp
+  8020c8:	56                   	push   %esi
+  8020c9:	53                   	push   %ebx
+  8020ca:	83 ec 1c             	sub    $0x1c,%esp
+  8020cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020d0:	50                   	push   %eax
+  8020d1:	e8 c8 ed ff ff       	call   800e9e <fd_alloc>
+  8020d6:	89 c3                	mov    %eax,%ebx
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	0f 88 23 01 00 00    	js     802206 <pipe+0x141>
+  8020e3:	83 ec 04             	sub    $0x4,%esp
+  8020e6:	68 07 04 00 00       	push   $0x407
+  8020eb:	ff 75 f4             	push   -0xc(%ebp)
+  8020ee:	6a 00                	push   $0x0
+  8020f0:	e8 14 e5 ff ff       	call   800609 <sys_page_alloc>
+  8020f5:	89 c3                	mov    %eax,%ebx
+  8020f7:	83 c4 10             	add    $0x10,%esp
+  8020fa:	85 c0                	test   %eax,%eax
+  8020fc:	0f 88 04 01 00 00    	js     802206 <pipe+0x141>
+  802102:	83 ec 0c             	sub    $0xc,%esp
+  802105:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802108:	50                   	push   %eax
+  802109:	e8 90 ed ff ff       	call   800e9e <fd_alloc>
+  80210e:	89 c3                	mov    %eax,%ebx
+  802110:	83 c4 10             	add    $0x10,%esp
+  802113:	85 c0                	test   %eax,%eax
+  802115:	0f 88 db 00 00 00    	js     8021f6 <pipe+0x131>
+  80211b:	83 ec 04             	sub    $0x4,%esp
+  80211e:	68 07 04 00 00       	push   $0x407
+  802123:	ff 75 f0             	push   -0x10(%ebp)
+  802126:	6a 00                	push   $0x0
+  802128:	e8 dc e4 ff ff       	call   800609 <sys_page_alloc>
+  80212d:	89 c3                	mov    %eax,%ebx
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	85 c0                	test   %eax,%eax
+  802134:	0f 88 bc 00 00 00    	js     8021f6 <pipe+0x131>
+  80213a:	83 ec 0c             	sub    $0xc,%esp
+  80213d:	ff 75 f4             	push   -0xc(%ebp)
+  802140:	e8 42 ed ff ff       	call   800e87 <fd2data>
+  802145:	89 c6                	mov    %eax,%esi
+  802147:	83 c4 0c             	add    $0xc,%esp
+  80214a:	68 07 04 00 00       	push   $0x407
+  80214f:	50                   	push   %eax
+  802150:	6a 00                	push   $0x0
+  802152:	e8 b2 e4 ff ff       	call   800609 <sys_page_alloc>
+  802157:	89 c3                	mov    %eax,%ebx
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	0f 88 82 00 00 00    	js     8021e6 <pipe+0x121>
+  802164:	83 ec 0c             	sub    $0xc,%esp
+  802167:	ff 75 f0             	push   -0x10(%ebp)
+  80216a:	e8 18 ed ff ff       	call   800e87 <fd2data>
+  80216f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802176:	50                   	push   %eax
+  802177:	6a 00                	push   $0x0
+  802179:	56                   	push   %esi
+  80217a:	6a 00                	push   $0x0
+  80217c:	e8 cb e4 ff ff       	call   80064c <sys_page_map>
+  802181:	89 c3                	mov    %eax,%ebx
+  802183:	83 c4 20             	add    $0x20,%esp
+  802186:	85 c0                	test   %eax,%eax
+  802188:	78 4e                	js     8021d8 <pipe+0x113>
+  80218a:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80218f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802192:	89 02                	mov    %eax,(%edx)
+  802194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802197:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80219e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8021a1:	89 02                	mov    %eax,(%edx)
+  8021a3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8021a6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8021ad:	83 ec 0c             	sub    $0xc,%esp
+  8021b0:	ff 75 f4             	push   -0xc(%ebp)
+  8021b3:	e8 bf ec ff ff       	call   800e77 <fd2num>
+  8021b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021bb:	89 01                	mov    %eax,(%ecx)
+  8021bd:	83 c4 04             	add    $0x4,%esp
+  8021c0:	ff 75 f0             	push   -0x10(%ebp)
+  8021c3:	e8 af ec ff ff       	call   800e77 <fd2num>
+  8021c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021cb:	89 41 04             	mov    %eax,0x4(%ecx)
+  8021ce:	83 c4 10             	add    $0x10,%esp
+  8021d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021d6:	eb 2e                	jmp    802206 <pipe+0x141>
+  8021d8:	83 ec 08             	sub    $0x8,%esp
+  8021db:	56                   	push   %esi
+  8021dc:	6a 00                	push   $0x0
+  8021de:	e8 f8 e4 ff ff       	call   8006db <sys_page_unmap>
+  8021e3:	83 c4 10             	add    $0x10,%esp
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  8021e9:	ff 75 f0             	push   -0x10(%ebp)
+  8021ec:	6a 00                	push   $0x0
+  8021ee:	e8 e8 e4 ff ff       	call   8006db <sys_page_unmap>
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	83 ec 08             	sub    $0x8,%esp
+  8021f9:	ff 75 f4             	push   -0xc(%ebp)
+  8021fc:	6a 00                	push   $0x0
+  8021fe:	e8 d8 e4 ff ff       	call   8006db <sys_page_unmap>
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	89 d8                	mov    %ebx,%eax
+  802208:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80220b:	5b                   	pop    %ebx
+  80220c:	5e                   	pop    %esi
+  80220d:	5d                   	pop    %ebp
+  80220e:	c3                   	ret
+
+0080220f <pipeisclosed>:
+  80220f:	55                   	push   %ebp
+  802210:	89 e5                	mov    %esp,%ebp
+  802212:	83 ec 20             	sub    $0x20,%esp
+  802215:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802218:	50                   	push   %eax
+  802219:	ff 75 08             	push   0x8(%ebp)
+  80221c:	e8 cd ec ff ff       	call   800eee <fd_lookup>
+  802221:	83 c4 10             	add    $0x10,%esp
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 18                	js     802240 <pipeisclosed+0x31>
+  802228:	83 ec 0c             	sub    $0xc,%esp
+  80222b:	ff 75 f4             	push   -0xc(%ebp)
+  80222e:	e8 54 ec ff ff       	call   800e87 <fd2data>
+  802233:	89 c2                	mov    %eax,%edx
+  802235:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802238:	e8 16 fd ff ff       	call   801f53 <_pipeisclosed>
+  80223d:	83 c4 10             	add    $0x10,%esp
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+
+00802242 <ipcring_init>:
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	53                   	push   %ebx
+  802246:	83 ec 08             	sub    $0x8,%esp
+  802249:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80224c:	6a 60                	push   $0x60
+  80224e:	6a 00                	push   $0x0
+  802250:	53                   	push   %ebx
+  802251:	e8 ce e0 ff ff       	call   800324 <memset>
+  802256:	a1 10 50 80 00       	mov    0x805010,%eax
+  80225b:	8b 40 48             	mov    0x48(%eax),%eax
+  80225e:	89 03                	mov    %eax,(%ebx)
+  802260:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802263:	89 43 04             	mov    %eax,0x4(%ebx)
+  802266:	8b 45 10             	mov    0x10(%ebp),%eax
+  802269:	89 43 08             	mov    %eax,0x8(%ebx)
+  80226c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80226f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802272:	83 c4 10             	add    $0x10,%esp
+  802275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802278:	c9                   	leave
+  802279:	c3                   	ret
+
+0080227a <ipcring_req_slot>:
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802280:	8b 50 10             	mov    0x10(%eax),%edx
+  802283:	8b 48 18             	mov    0x18(%eax),%ecx
+  802286:	29 ca                	sub    %ecx,%edx
+  802288:	83 fa 07             	cmp    $0x7,%edx
+  80228b:	77 0c                	ja     802299 <ipcring_req_slot+0x1f>
+  80228d:	8b 50 10             	mov    0x10(%eax),%edx
+  802290:	83 e2 07             	and    $0x7,%edx
+  802293:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802297:	5d                   	pop    %ebp
+  802298:	c3                   	ret
+  802299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229e:	eb f7                	jmp    802297 <ipcring_req_slot+0x1d>
+
+008022a0 <ipcring_req_push>:
+  8022a0:	55                   	push   %ebp
+  8022a1:	89 e5                	mov    %esp,%ebp
+  8022a3:	83 ec 08             	sub    $0x8,%esp
+  8022a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022a9:	8b 42 10             	mov    0x10(%edx),%eax
+  8022ac:	83 c0 01             	add    $0x1,%eax
+  8022af:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8022b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b8:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	75 02                	jne    8022c2 <ipcring_req_push+0x22>
+  8022c0:	c9                   	leave
+  8022c1:	c3                   	ret
+  8022c2:	6a 00                	push   $0x0
+  8022c4:	68 00 00 80 ee       	push   $0xee800000
+  8022c9:	ff 72 08             	push   0x8(%edx)
+  8022cc:	ff 72 04             	push   0x4(%edx)
+  8022cf:	e8 6d e6 ff ff       	call   800941 <sys_ipc_send>
+  8022d4:	83 c4 10             	add    $0x10,%esp
+  8022d7:	eb e7                	jmp    8022c0 <ipcring_req_push+0x20>
+
+008022d9 <ipcring_rsp_wait>:
+  8022d9:	55                   	push   %ebp
+  8022da:	89 e5                	mov    %esp,%ebp
+  8022dc:	53                   	push   %ebx
+  8022dd:	83 ec 04             	sub    $0x4,%esp
+  8022e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022e3:	8b 53 18             	mov    0x18(%ebx),%edx
+  8022e6:	8b 43 10             	mov    0x10(%ebx),%eax
+  8022e9:	39 c2                	cmp    %eax,%edx
+  8022eb:	74 3c                	je     802329 <ipcring_rsp_wait+0x50>
+  8022ed:	8b 53 14             	mov    0x14(%ebx),%edx
+  8022f0:	8b 43 18             	mov    0x18(%ebx),%eax
+  8022f3:	39 c2                	cmp    %eax,%edx
+  8022f5:	75 23                	jne    80231a <ipcring_rsp_wait+0x41>
+  8022f7:	83 ec 08             	sub    $0x8,%esp
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	6a 00                	push   $0x0
+  8022fe:	6a 00                	push   $0x0
+  802300:	6a 00                	push   $0x0
+  802302:	ff 73 0c             	push   0xc(%ebx)
+  802305:	ff 73 04             	push   0x4(%ebx)
+  802308:	e8 07 0b 00 00       	call   802e14 <ipc_call>
+  80230d:	8b 53 14             	mov    0x14(%ebx),%edx
+  802310:	8b 43 18             	mov    0x18(%ebx),%eax
+  802313:	83 c4 20             	add    $0x20,%esp
+  802316:	39 c2                	cmp    %eax,%edx
+  802318:	74 dd                	je     8022f7 <ipcring_rsp_wait+0x1e>
+  80231a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80231d:	83 e0 07             	and    $0x7,%eax
+  802320:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802324:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802327:	c9                   	leave
+  802328:	c3                   	ret
+  802329:	68 5c 33 80 00       	push   $0x80335c
+  80232e:	68 0d 33 80 00       	push   $0x80330d
+  802333:	6a 3b                	push   $0x3b
+  802335:	68 7d 33 80 00       	push   $0x80337d
+  80233a:	e8 97 02 00 00       	call   8025d6 <_panic>
+
+0080233f <ipcring_rsp_pop>:
+  80233f:	55                   	push   %ebp
+  802340:	89 e5                	mov    %esp,%ebp
+  802342:	8b 55 08             	mov    0x8(%ebp),%edx
+  802345:	8b 42 18             	mov    0x18(%edx),%eax
+  802348:	83 c0 01             	add    $0x1,%eax
+  80234b:	89 42 18             	mov    %eax,0x18(%edx)
+  80234e:	5d                   	pop    %ebp
+  80234f:	c3                   	ret
+
+00802350 <ipcring_server_init>:
+  802350:	55                   	push   %ebp
+  802351:	89 e5                	mov    %esp,%ebp
+  802353:	8b 45 08             	mov    0x8(%ebp),%eax
+  802356:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802359:	89 10                	mov    %edx,(%eax)
+  80235b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80235e:	89 50 04             	mov    %edx,0x4(%eax)
+  802361:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802368:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+
+00802371 <ipcring_req_avail>:
+  802371:	55                   	push   %ebp
+  802372:	89 e5                	mov    %esp,%ebp
+  802374:	8b 55 08             	mov    0x8(%ebp),%edx
+  802377:	8b 02                	mov    (%edx),%eax
+  802379:	8b 40 10             	mov    0x10(%eax),%eax
+  80237c:	2b 42 08             	sub    0x8(%edx),%eax
+  80237f:	ba 08 00 00 00       	mov    $0x8,%edx
+  802384:	39 d0                	cmp    %edx,%eax
+  802386:	0f 47 c2             	cmova  %edx,%eax
+  802389:	5d                   	pop    %ebp
+  80238a:	c3                   	ret
+
+0080238b <ipcring_req_peek>:
+  80238b:	55                   	push   %ebp
+  80238c:	89 e5                	mov    %esp,%ebp
+  80238e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802391:	8b 42 08             	mov    0x8(%edx),%eax
+  802394:	83 e0 07             	and    $0x7,%eax
+  802397:	8b 12                	mov    (%edx),%edx
+  802399:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80239d:	5d                   	pop    %ebp
+  80239e:	c3                   	ret
+
+0080239f <ipcring_rsp_push>:
+  80239f:	55                   	push   %ebp
+  8023a0:	89 e5                	mov    %esp,%ebp
+  8023a2:	83 ec 08             	sub    $0x8,%esp
+  8023a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023a8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8023ab:	83 c0 01             	add    $0x1,%eax
+  8023ae:	89 41 08             	mov    %eax,0x8(%ecx)
+  8023b1:	8b 11                	mov    (%ecx),%edx
+  8023b3:	83 c2 14             	add    $0x14,%edx
+  8023b6:	f0 87 02             	lock xchg %eax,(%edx)
+  8023b9:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8023bd:	75 02                	jne    8023c1 <ipcring_rsp_push+0x22>
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+  8023c1:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8023c8:	6a 00                	push   $0x0
+  8023ca:	68 00 00 80 ee       	push   $0xee800000
+  8023cf:	6a 00                	push   $0x0
+  8023d1:	ff 71 04             	push   0x4(%ecx)
+  8023d4:	e8 8b e4 ff ff       	call   800864 <sys_ipc_try_send>
+  8023d9:	83 c4 10             	add    $0x10,%esp
+  8023dc:	eb e1                	jmp    8023bf <ipcring_rsp_push+0x20>
+
+008023de <ipcring_client_wait>:
+  8023de:	55                   	push   %ebp
+  8023df:	89 e5                	mov    %esp,%ebp
+  8023e1:	83 ec 08             	sub    $0x8,%esp
+  8023e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e7:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8023ee:	8b 10                	mov    (%eax),%edx
+  8023f0:	8b 52 18             	mov    0x18(%edx),%edx
+  8023f3:	3b 50 08             	cmp    0x8(%eax),%edx
+  8023f6:	75 02                	jne    8023fa <ipcring_client_wait+0x1c>
+  8023f8:	c9                   	leave
+  8023f9:	c3                   	ret
+  8023fa:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802401:	6a 00                	push   $0x0
+  802403:	68 00 00 80 ee       	push   $0xee800000
+  802408:	6a 00                	push   $0x0
+  80240a:	ff 70 04             	push   0x4(%eax)
+  80240d:	e8 52 e4 ff ff       	call   800864 <sys_ipc_try_send>
+  802412:	83 c4 10             	add    $0x10,%esp
+  802415:	eb e1                	jmp    8023f8 <ipcring_client_wait+0x1a>
+
+00802417 <ipcring_server_sleep>:
+  802417:	55                   	push   %ebp
+  802418:	89 e5                	mov    %esp,%ebp
+  80241a:	53                   	push   %ebx
+  80241b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80241e:	8b 01                	mov    (%ecx),%eax
+  802420:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802423:	b8 01 00 00 00       	mov    $0x1,%eax
+  802428:	f0 87 02             	lock xchg %eax,(%edx)
+  80242b:	8b 11                	mov    (%ecx),%edx
+  80242d:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802430:	b8 01 00 00 00       	mov    $0x1,%eax
+  802435:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802438:	74 0e                	je     802448 <ipcring_server_sleep+0x31>
+  80243a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243f:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802443:	b8 00 00 00 00       	mov    $0x0,%eax
+  802448:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80244b:	c9                   	leave
+  80244c:	c3                   	ret
+
+0080244d <devcons_close>:
+  80244d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802452:	c3                   	ret
+
+00802453 <devcons_stat>:
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	83 ec 10             	sub    $0x10,%esp
+  802459:	68 8b 33 80 00       	push   $0x80338b
+  80245e:	ff 75 0c             	push   0xc(%ebp)
+  802461:	e8 43 dd ff ff       	call   8001a9 <strcpy>
+  802466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246b:	c9                   	leave
+  80246c:	c3                   	ret
+
+0080246d <devcons_write>:
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	57                   	push   %edi
+  802471:	56                   	push   %esi
+  802472:	53                   	push   %ebx
+  802473:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802479:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80247c:	85 ff                	test   %edi,%edi
+  80247e:	74 51                	je     8024d1 <devcons_write+0x64>
+  802480:	be 00 00 00 00       	mov    $0x0,%esi
+  802485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80248a:	89 fb                	mov    %edi,%ebx
+  80248c:	29 c3                	sub    %eax,%ebx
+  80248e:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802493:	39 d3                	cmp    %edx,%ebx
+  802495:	0f 47 da             	cmova  %edx,%ebx
+  802498:	83 ec 04             	sub    $0x4,%esp
+  80249b:	53                   	push   %ebx
+  80249c:	03 45 0c             	add    0xc(%ebp),%eax
+  80249f:	50                   	push   %eax
+  8024a0:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8024a6:	50                   	push   %eax
+  8024a7:	e8 ad de ff ff       	call   800359 <memmove>
+  8024ac:	83 c4 08             	add    $0x8,%esp
+  8024af:	53                   	push   %ebx
+  8024b0:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8024b6:	50                   	push   %eax
+  8024b7:	e8 65 e0 ff ff       	call   800521 <sys_cputs>
+  8024bc:	01 de                	add    %ebx,%esi
+  8024be:	89 f0                	mov    %esi,%eax
+  8024c0:	83 c4 10             	add    $0x10,%esp
+  8024c3:	39 fe                	cmp    %edi,%esi
+  8024c5:	72 c3                	jb     80248a <devcons_write+0x1d>
+  8024c7:	89 f0                	mov    %esi,%eax
+  8024c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024cc:	5b                   	pop    %ebx
+  8024cd:	5e                   	pop    %esi
+  8024ce:	5f                   	pop    %edi
+  8024cf:	5d                   	pop    %ebp
+  8024d0:	c3                   	ret
+  8024d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d6:	eb ef                	jmp    8024c7 <devcons_write+0x5a>
+
+008024d8 <devcons_read>:
+  8024d8:	55                   	push   %ebp
+  8024d9:	89 e5                	mov    %esp,%ebp
+  8024db:	83 ec 08             	sub    $0x8,%esp
+  8024de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8024e7:	75 07                	jne    8024f0 <devcons_read+0x18>
+  8024e9:	eb 1f                	jmp    80250a <devcons_read+0x32>
+  8024eb:	e8 ce e0 ff ff       	call   8005be <sys_yield>
+  8024f0:	e8 4a e0 ff ff       	call   80053f <sys_cgetc>
+  8024f5:	85 c0                	test   %eax,%eax
+  8024f7:	74 f2                	je     8024eb <devcons_read+0x13>
+  8024f9:	78 0f                	js     80250a <devcons_read+0x32>
+  8024fb:	83 f8 04             	cmp    $0x4,%eax
+  8024fe:	74 0c                	je     80250c <devcons_read+0x34>
+  802500:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802503:	88 02                	mov    %al,(%edx)
+  802505:	b8 01 00 00 00       	mov    $0x1,%eax
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+  80250c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802511:	eb f7                	jmp    80250a <devcons_read+0x32>
+
+00802513 <cputchar>:
+  802513:	55                   	push   %ebp
+  802514:	89 e5                	mov    %esp,%ebp
+  802516:	83 ec 20             	sub    $0x20,%esp
+  802519:	8b 45 08             	mov    0x8(%ebp),%eax
+  80251c:	88 45 f7             	mov    %al,-0x9(%ebp)
+  80251f:	6a 01                	push   $0x1
+  802521:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802524:	50                   	push   %eax
+  802525:	e8 f7 df ff ff       	call   800521 <sys_cputs>
+  80252a:	83 c4 10             	add    $0x10,%esp
+  80252d:	c9                   	leave
+  80252e:	c3                   	ret
+
+0080252f <getchar>:
+  80252f:	55                   	push   %ebp
+  802530:	89 e5                	mov    %esp,%ebp
+  802532:	83 ec 1c             	sub    $0x1c,%esp
+  802535:	6a 01                	push   $0x1
+  802537:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80253a:	50                   	push   %eax
+  80253b:	6a 00                	push   $0x0
+  80253d:	e8 0e ec ff ff       	call   801150 <read>
+  802542:	83 c4 10             	add    $0x10,%esp
+  802545:	85 c0                	test   %eax,%eax
+  802547:	78 06                	js     80254f <getchar+0x20>
+  802549:	74 06                	je     802551 <getchar+0x22>
+  80254b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  80254f:	c9                   	leave
+  802550:	c3                   	ret
+  802551:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802556:	eb f7                	jmp    80254f <getchar+0x20>
+
+00802558 <iscons>:
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	83 ec 20             	sub    $0x20,%esp
+  80255e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802561:	50                   	push   %eax
+  802562:	ff 75 08             	push   0x8(%ebp)
+  802565:	e8 84 e9 ff ff       	call   800eee <fd_lookup>
+  80256a:	83 c4 10             	add    $0x10,%esp
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 11                	js     802582 <iscons+0x2a>
+  802571:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802574:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80257a:	39 10                	cmp    %edx,(%eax)
+  80257c:	0f 94 c0             	sete   %al
+  80257f:	0f b6 c0             	movzbl %al,%eax
+  802582:	c9                   	leave
+  802583:	c3                   	ret
+
+00802584 <opencons>:
+  802584:	55                   	push   %ebp
+  802585:	89 e5                	mov    %esp,%ebp
+  802587:	83 ec 24             	sub    $0x24,%esp
+  80258a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80258d:	50                   	push   %eax
+  80258e:	e8 0b e9 ff ff       	call   800e9e <fd_alloc>
+  802593:	83 c4 10             	add    $0x10,%esp
+  802596:	85 c0                	test   %eax,%eax
+  802598:	78 3a                	js     8025d4 <opencons+0x50>
+  80259a:	83 ec 04             	sub    $0x4,%esp
+  80259d:	68 07 04 00 00       	push   $0x407
+  8025a2:	ff 75 f4             	push   -0xc(%ebp)
+  8025a5:	6a 00                	push   $0x0
+  8025a7:	e8 5d e0 ff ff       	call   800609 <sys_page_alloc>
+  8025ac:	83 c4 10             	add    $0x10,%esp
+  8025af:	85 c0                	test   %eax,%eax
+  8025b1:	78 21                	js     8025d4 <opencons+0x50>
+  8025b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b6:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8025bc:	89 10                	mov    %edx,(%eax)
+  8025be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8025c8:	83 ec 0c             	sub    $0xc,%esp
+  8025cb:	50                   	push   %eax
+  8025cc:	e8 a6 e8 ff ff       	call   800e77 <fd2num>
+  8025d1:	83 c4 10             	add    $0x10,%esp
+  8025d4:	c9                   	leave
+  8025d5:	c3                   	ret
+
+008025d6 <_panic>:
+  8025d6:	55                   	push   %ebp
+  8025d7:	89 e5                	mov    %esp,%ebp
+  8025d9:	56                   	push   %esi
+  8025da:	53                   	push   %ebx
+  8025db:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8025de:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8025e4:	e8 b6 df ff ff       	call   80059f <sys_getenvid>
+  8025e9:	83 ec 0c             	sub    $0xc,%esp
+  8025ec:	ff 75 0c             	push   0xc(%ebp)
+  8025ef:	ff 75 08             	push   0x8(%ebp)
+  8025f2:	56                   	push   %esi
+  8025f3:	50                   	push   %eax
+  8025f4:	68 98 33 80 00       	push   $0x803398
+  8025f9:	e8 b3 00 00 00       	call   8026b1 <cprintf>
+  8025fe:	83 c4 18             	add    $0x18,%esp
+  802601:	53                   	push   %ebx
+  802602:	ff 75 10             	push   0x10(%ebp)
+  802605:	e8 56 00 00 00       	call   802660 <vcprintf>
+  80260a:	c7 04 24 52 33 80 00 	movl   $0x803352,(%esp)
+  802611:	e8 9b 00 00 00       	call   8026b1 <cprintf>
+  802616:	83 c4 10             	add    $0x10,%esp
+  802619:	cc                   	int3
+  80261a:	eb fd                	jmp    802619 <_panic+0x43>
+
+0080261c <putch>:
+  80261c:	55                   	push   %ebp
+  80261d:	89 e5                	mov    %esp,%ebp
+  80261f:	53                   	push   %ebx
+  802620:	83 ec 04             	sub    $0x4,%esp
+  802623:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802626:	8b 13                	mov    (%ebx),%edx
+  802628:	8d 42 01             	lea    0x1(%edx),%eax
+  80262b:	89 03                	mov    %eax,(%ebx)
+  80262d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802630:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802634:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802639:	74 09                	je     802644 <putch+0x28>
+  80263b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80263f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+  802644:	83 ec 08             	sub    $0x8,%esp
+  802647:	68 ff 00 00 00       	push   $0xff
+  80264c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80264f:	50                   	push   %eax
+  802650:	e8 cc de ff ff       	call   800521 <sys_cputs>
+  802655:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80265b:	83 c4 10             	add    $0x10,%esp
+  80265e:	eb db                	jmp    80263b <putch+0x1f>
+
+00802660 <vcprintf>:
+  802660:	55                   	push   %ebp
+  802661:	89 e5                	mov    %esp,%ebp
+  802663:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802669:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802670:	00 00 00 
+  802673:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80267a:	00 00 00 
+  80267d:	ff 75 0c             	push   0xc(%ebp)
+  802680:	ff 75 08             	push   0x8(%ebp)
+  802683:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802689:	50                   	push   %eax
+  80268a:	68 1c 26 80 00       	push   $0x80261c
+  80268f:	e8 1c 01 00 00       	call   8027b0 <vprintfmt>
+  802694:	83 c4 08             	add    $0x8,%esp
+  802697:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80269d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8026a3:	50                   	push   %eax
+  8026a4:	e8 78 de ff ff       	call   800521 <sys_cputs>
+  8026a9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8026af:	c9                   	leave
+  8026b0:	c3                   	ret
+
+008026b1 <cprintf>:
+  8026b1:	55                   	push   %ebp
+  8026b2:	89 e5                	mov    %esp,%ebp
+  8026b4:	83 ec 10             	sub    $0x10,%esp
+  8026b7:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8026ba:	50                   	push   %eax
+  8026bb:	ff 75 08             	push   0x8(%ebp)
+  8026be:	e8 9d ff ff ff       	call   802660 <vcprintf>
+  8026c3:	c9                   	leave
+  8026c4:	c3                   	ret
+
+008026c5 <printnum>:
+  8026c5:	55                   	push   %ebp
+  8026c6:	89 e5                	mov    %esp,%ebp
+  8026c8:	57                   	push   %edi
+  8026c9:	56                   	push   %esi
+  8026ca:	53                   	push   %ebx
+  8026cb:	83 ec 1c             	sub    $0x1c,%esp
+  8026ce:	89 c3                	mov    %eax,%ebx
+  8026d0:	89 d6                	mov    %edx,%esi
+  8026d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026d8:	89 d1                	mov    %edx,%ecx
+  8026da:	89 c2                	mov    %eax,%edx
+  8026dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8026df:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8026e2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8026e8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8026ef:	39 c2                	cmp    %eax,%edx
+  8026f1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8026f4:	73 4b                	jae    802741 <printnum+0x7c>
+  8026f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026f9:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8026fc:	85 ff                	test   %edi,%edi
+  8026fe:	7e 11                	jle    802711 <printnum+0x4c>
+  802700:	83 ec 08             	sub    $0x8,%esp
+  802703:	56                   	push   %esi
+  802704:	ff 75 18             	push   0x18(%ebp)
+  802707:	ff d3                	call   *%ebx
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	83 ef 01             	sub    $0x1,%edi
+  80270f:	75 ef                	jne    802700 <printnum+0x3b>
+  802711:	83 ec 08             	sub    $0x8,%esp
+  802714:	56                   	push   %esi
+  802715:	83 ec 04             	sub    $0x4,%esp
+  802718:	ff 75 e4             	push   -0x1c(%ebp)
+  80271b:	ff 75 e0             	push   -0x20(%ebp)
+  80271e:	ff 75 dc             	push   -0x24(%ebp)
+  802721:	ff 75 d8             	push   -0x28(%ebp)
+  802724:	e8 d7 09 00 00       	call   803100 <__umoddi3>
+  802729:	83 c4 14             	add    $0x14,%esp
+  80272c:	0f be 80 bb 33 80 00 	movsbl 0x8033bb(%eax),%eax
+  802733:	50                   	push   %eax
+  802734:	ff d3                	call   *%ebx
+  802736:	83 c4 10             	add    $0x10,%esp
+  802739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80273c:	5b                   	pop    %ebx
+  80273d:	5e                   	pop    %esi
+  80273e:	5f                   	pop    %edi
+  80273f:	5d                   	pop    %ebp
+  802740:	c3                   	ret
+  802741:	83 ec 0c             	sub    $0xc,%esp
+  802744:	ff 75 18             	push   0x18(%ebp)
+  802747:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80274a:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80274d:	52                   	push   %edx
+  80274e:	50                   	push   %eax
+  80274f:	83 ec 08             	sub    $0x8,%esp
+  802752:	ff 75 e4             	push   -0x1c(%ebp)
+  802755:	ff 75 e0             	push   -0x20(%ebp)
+  802758:	ff 75 dc             	push   -0x24(%ebp)
+  80275b:	ff 75 d8             	push   -0x28(%ebp)
+  80275e:	e8 7f 09 00 00       	call   8030e2 <__udivdi3>
+  802763:	83 c4 18             	add    $0x18,%esp
+  802766:	52                   	push   %edx
+  802767:	50                   	push   %eax
+  802768:	89 f2                	mov    %esi,%edx
+  80276a:	89 d8                	mov    %ebx,%eax
+  80276c:	e8 54 ff ff ff       	call   8026c5 <printnum>
+  802771:	83 c4 20             	add    $0x20,%esp
+  802774:	eb 9b                	jmp    802711 <printnum+0x4c>
+
+00802776 <sprintputch>:
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80277c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802780:	8b 10                	mov    (%eax),%edx
+  802782:	3b 50 04             	cmp    0x4(%eax),%edx
+  802785:	73 0a                	jae    802791 <sprintputch+0x1b>
+  802787:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80278a:	89 08                	mov    %ecx,(%eax)
+  80278c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278f:	88 02                	mov    %al,(%edx)
+  802791:	5d                   	pop    %ebp
+  802792:	c3                   	ret
+
+00802793 <printfmt>:
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	83 ec 08             	sub    $0x8,%esp
+  802799:	8d 45 14             	lea    0x14(%ebp),%eax
+  80279c:	50                   	push   %eax
+  80279d:	ff 75 10             	push   0x10(%ebp)
+  8027a0:	ff 75 0c             	push   0xc(%ebp)
+  8027a3:	ff 75 08             	push   0x8(%ebp)
+  8027a6:	e8 05 00 00 00       	call   8027b0 <vprintfmt>
+  8027ab:	83 c4 10             	add    $0x10,%esp
+  8027ae:	c9                   	leave
+  8027af:	c3                   	ret
+
+008027b0 <vprintfmt>:
+  8027b0:	55                   	push   %ebp
+  8027b1:	89 e5                	mov    %esp,%ebp
+  8027b3:	57                   	push   %edi
+  8027b4:	56                   	push   %esi
+  8027b5:	53                   	push   %ebx
+  8027b6:	83 ec 2c             	sub    $0x2c,%esp
+  8027b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027bc:	89 df                	mov    %ebx,%edi
+  8027be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027c1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027c4:	8d 70 01             	lea    0x1(%eax),%esi
+  8027c7:	0f b6 00             	movzbl (%eax),%eax
+  8027ca:	83 f8 25             	cmp    $0x25,%eax
+  8027cd:	74 1e                	je     8027ed <vprintfmt+0x3d>
+  8027cf:	85 c0                	test   %eax,%eax
+  8027d1:	0f 84 15 05 00 00    	je     802cec <vprintfmt+0x53c>
+  8027d7:	83 ec 08             	sub    $0x8,%esp
+  8027da:	53                   	push   %ebx
+  8027db:	50                   	push   %eax
+  8027dc:	ff d7                	call   *%edi
+  8027de:	83 c6 01             	add    $0x1,%esi
+  8027e1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	83 f8 25             	cmp    $0x25,%eax
+  8027eb:	75 e2                	jne    8027cf <vprintfmt+0x1f>
+  8027ed:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8027f1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8027f8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8027ff:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802806:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80280b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80280e:	8d 56 01             	lea    0x1(%esi),%edx
+  802811:	0f b6 0e             	movzbl (%esi),%ecx
+  802814:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802817:	3c 55                	cmp    $0x55,%al
+  802819:	0f 87 3b 04 00 00    	ja     802c5a <vprintfmt+0x4aa>
+  80281f:	0f b6 c0             	movzbl %al,%eax
+  802822:	ff 24 85 00 35 80 00 	jmp    *0x803500(,%eax,4)
+  802829:	89 75 10             	mov    %esi,0x10(%ebp)
+  80282c:	eb 93                	jmp    8027c1 <vprintfmt+0x11>
+  80282e:	89 d6                	mov    %edx,%esi
+  802830:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802834:	eb d8                	jmp    80280e <vprintfmt+0x5e>
+  802836:	89 d6                	mov    %edx,%esi
+  802838:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80283c:	eb d0                	jmp    80280e <vprintfmt+0x5e>
+  80283e:	0f b6 c9             	movzbl %cl,%ecx
+  802841:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802844:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802847:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80284b:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80284e:	83 f9 09             	cmp    $0x9,%ecx
+  802851:	77 6f                	ja     8028c2 <vprintfmt+0x112>
+  802853:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  802856:	83 c2 01             	add    $0x1,%edx
+  802859:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80285c:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  802860:	0f be 02             	movsbl (%edx),%eax
+  802863:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802866:	83 fe 09             	cmp    $0x9,%esi
+  802869:	76 eb                	jbe    802856 <vprintfmt+0xa6>
+  80286b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80286e:	89 d6                	mov    %edx,%esi
+  802870:	eb 13                	jmp    802885 <vprintfmt+0xd5>
+  802872:	8b 45 14             	mov    0x14(%ebp),%eax
+  802875:	8b 00                	mov    (%eax),%eax
+  802877:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80287a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80287d:	8d 40 04             	lea    0x4(%eax),%eax
+  802880:	89 45 14             	mov    %eax,0x14(%ebp)
+  802883:	89 d6                	mov    %edx,%esi
+  802885:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802889:	79 83                	jns    80280e <vprintfmt+0x5e>
+  80288b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80288e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802891:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802898:	e9 71 ff ff ff       	jmp    80280e <vprintfmt+0x5e>
+  80289d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8028a0:	85 c9                	test   %ecx,%ecx
+  8028a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a7:	0f 49 c1             	cmovns %ecx,%eax
+  8028aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028ad:	89 d6                	mov    %edx,%esi
+  8028af:	e9 5a ff ff ff       	jmp    80280e <vprintfmt+0x5e>
+  8028b4:	89 d6                	mov    %edx,%esi
+  8028b6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8028bd:	e9 4c ff ff ff       	jmp    80280e <vprintfmt+0x5e>
+  8028c2:	89 d6                	mov    %edx,%esi
+  8028c4:	eb bf                	jmp    802885 <vprintfmt+0xd5>
+  8028c6:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8028ca:	89 d6                	mov    %edx,%esi
+  8028cc:	e9 3d ff ff ff       	jmp    80280e <vprintfmt+0x5e>
+  8028d1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8028d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028d7:	8d 70 04             	lea    0x4(%eax),%esi
+  8028da:	83 ec 08             	sub    $0x8,%esp
+  8028dd:	53                   	push   %ebx
+  8028de:	ff 30                	push   (%eax)
+  8028e0:	ff d7                	call   *%edi
+  8028e2:	83 c4 10             	add    $0x10,%esp
+  8028e5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8028e8:	e9 d4 fe ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  8028ed:	89 55 10             	mov    %edx,0x10(%ebp)
+  8028f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028f3:	8d 70 04             	lea    0x4(%eax),%esi
+  8028f6:	8b 10                	mov    (%eax),%edx
+  8028f8:	89 d0                	mov    %edx,%eax
+  8028fa:	f7 d8                	neg    %eax
+  8028fc:	0f 48 c2             	cmovs  %edx,%eax
+  8028ff:	83 f8 12             	cmp    $0x12,%eax
+  802902:	7f 23                	jg     802927 <vprintfmt+0x177>
+  802904:	8b 14 85 60 36 80 00 	mov    0x803660(,%eax,4),%edx
+  80290b:	85 d2                	test   %edx,%edx
+  80290d:	74 18                	je     802927 <vprintfmt+0x177>
+  80290f:	52                   	push   %edx
+  802910:	68 1f 33 80 00       	push   $0x80331f
+  802915:	53                   	push   %ebx
+  802916:	57                   	push   %edi
+  802917:	e8 77 fe ff ff       	call   802793 <printfmt>
+  80291c:	83 c4 10             	add    $0x10,%esp
+  80291f:	89 75 14             	mov    %esi,0x14(%ebp)
+  802922:	e9 9a fe ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802927:	50                   	push   %eax
+  802928:	68 d3 33 80 00       	push   $0x8033d3
+  80292d:	53                   	push   %ebx
+  80292e:	57                   	push   %edi
+  80292f:	e8 5f fe ff ff       	call   802793 <printfmt>
+  802934:	83 c4 10             	add    $0x10,%esp
+  802937:	89 75 14             	mov    %esi,0x14(%ebp)
+  80293a:	e9 82 fe ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  80293f:	89 55 10             	mov    %edx,0x10(%ebp)
+  802942:	8b 45 14             	mov    0x14(%ebp),%eax
+  802945:	83 c0 04             	add    $0x4,%eax
+  802948:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80294b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80294e:	8b 00                	mov    (%eax),%eax
+  802950:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802953:	85 c0                	test   %eax,%eax
+  802955:	0f 84 61 03 00 00    	je     802cbc <vprintfmt+0x50c>
+  80295b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80295f:	7e 06                	jle    802967 <vprintfmt+0x1b7>
+  802961:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802965:	75 29                	jne    802990 <vprintfmt+0x1e0>
+  802967:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80296a:	8d 70 01             	lea    0x1(%eax),%esi
+  80296d:	0f b6 00             	movzbl (%eax),%eax
+  802970:	0f be d0             	movsbl %al,%edx
+  802973:	85 d2                	test   %edx,%edx
+  802975:	0f 84 bb 00 00 00    	je     802a36 <vprintfmt+0x286>
+  80297b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80297e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802981:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802984:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802987:	eb 7a                	jmp    802a03 <vprintfmt+0x253>
+  802989:	c7 45 d0 cc 33 80 00 	movl   $0x8033cc,-0x30(%ebp)
+  802990:	83 ec 08             	sub    $0x8,%esp
+  802993:	ff 75 d4             	push   -0x2c(%ebp)
+  802996:	ff 75 d0             	push   -0x30(%ebp)
+  802999:	e8 e1 d7 ff ff       	call   80017f <strnlen>
+  80299e:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8029a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8029a4:	83 c4 10             	add    $0x10,%esp
+  8029a7:	85 d2                	test   %edx,%edx
+  8029a9:	0f 8e d6 02 00 00    	jle    802c85 <vprintfmt+0x4d5>
+  8029af:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8029b3:	83 ec 08             	sub    $0x8,%esp
+  8029b6:	53                   	push   %ebx
+  8029b7:	56                   	push   %esi
+  8029b8:	ff d7                	call   *%edi
+  8029ba:	83 c4 10             	add    $0x10,%esp
+  8029bd:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8029c1:	75 f0                	jne    8029b3 <vprintfmt+0x203>
+  8029c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8029c6:	8d 70 01             	lea    0x1(%eax),%esi
+  8029c9:	0f b6 00             	movzbl (%eax),%eax
+  8029cc:	0f be d0             	movsbl %al,%edx
+  8029cf:	85 d2                	test   %edx,%edx
+  8029d1:	0f 84 da 02 00 00    	je     802cb1 <vprintfmt+0x501>
+  8029d7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8029da:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8029dd:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8029e0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8029e3:	eb 1e                	jmp    802a03 <vprintfmt+0x253>
+  8029e5:	83 ec 08             	sub    $0x8,%esp
+  8029e8:	ff 75 0c             	push   0xc(%ebp)
+  8029eb:	52                   	push   %edx
+  8029ec:	ff 55 08             	call   *0x8(%ebp)
+  8029ef:	83 c4 10             	add    $0x10,%esp
+  8029f2:	83 eb 01             	sub    $0x1,%ebx
+  8029f5:	83 c6 01             	add    $0x1,%esi
+  8029f8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8029fc:	0f be d0             	movsbl %al,%edx
+  8029ff:	85 d2                	test   %edx,%edx
+  802a01:	74 2a                	je     802a2d <vprintfmt+0x27d>
+  802a03:	85 ff                	test   %edi,%edi
+  802a05:	78 05                	js     802a0c <vprintfmt+0x25c>
+  802a07:	83 ef 01             	sub    $0x1,%edi
+  802a0a:	78 59                	js     802a65 <vprintfmt+0x2b5>
+  802a0c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802a10:	74 d3                	je     8029e5 <vprintfmt+0x235>
+  802a12:	0f be c0             	movsbl %al,%eax
+  802a15:	83 e8 20             	sub    $0x20,%eax
+  802a18:	83 f8 5e             	cmp    $0x5e,%eax
+  802a1b:	76 c8                	jbe    8029e5 <vprintfmt+0x235>
+  802a1d:	83 ec 08             	sub    $0x8,%esp
+  802a20:	ff 75 0c             	push   0xc(%ebp)
+  802a23:	6a 3f                	push   $0x3f
+  802a25:	ff 55 08             	call   *0x8(%ebp)
+  802a28:	83 c4 10             	add    $0x10,%esp
+  802a2b:	eb c5                	jmp    8029f2 <vprintfmt+0x242>
+  802a2d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802a30:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a36:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802a39:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802a3d:	7e 1b                	jle    802a5a <vprintfmt+0x2aa>
+  802a3f:	83 ec 08             	sub    $0x8,%esp
+  802a42:	53                   	push   %ebx
+  802a43:	6a 20                	push   $0x20
+  802a45:	ff d7                	call   *%edi
+  802a47:	83 c4 10             	add    $0x10,%esp
+  802a4a:	83 ee 01             	sub    $0x1,%esi
+  802a4d:	75 f0                	jne    802a3f <vprintfmt+0x28f>
+  802a4f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802a52:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a55:	e9 67 fd ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802a5a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802a5d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a60:	e9 5c fd ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802a65:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802a68:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a6e:	eb c6                	jmp    802a36 <vprintfmt+0x286>
+  802a70:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802a73:	89 55 10             	mov    %edx,0x10(%ebp)
+  802a76:	83 f9 01             	cmp    $0x1,%ecx
+  802a79:	7f 1f                	jg     802a9a <vprintfmt+0x2ea>
+  802a7b:	85 c9                	test   %ecx,%ecx
+  802a7d:	74 67                	je     802ae6 <vprintfmt+0x336>
+  802a7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a82:	8b 30                	mov    (%eax),%esi
+  802a84:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802a87:	89 f0                	mov    %esi,%eax
+  802a89:	c1 f8 1f             	sar    $0x1f,%eax
+  802a8c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802a8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a92:	8d 40 04             	lea    0x4(%eax),%eax
+  802a95:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a98:	eb 17                	jmp    802ab1 <vprintfmt+0x301>
+  802a9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a9d:	8b 50 04             	mov    0x4(%eax),%edx
+  802aa0:	8b 00                	mov    (%eax),%eax
+  802aa2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802aa5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802aa8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aab:	8d 40 08             	lea    0x8(%eax),%eax
+  802aae:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ab1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ab4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ab7:	be 0a 00 00 00       	mov    $0xa,%esi
+  802abc:	85 c9                	test   %ecx,%ecx
+  802abe:	0f 89 12 01 00 00    	jns    802bd6 <vprintfmt+0x426>
+  802ac4:	83 ec 08             	sub    $0x8,%esp
+  802ac7:	53                   	push   %ebx
+  802ac8:	6a 2d                	push   $0x2d
+  802aca:	ff d7                	call   *%edi
+  802acc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802acf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ad2:	f7 da                	neg    %edx
+  802ad4:	83 d1 00             	adc    $0x0,%ecx
+  802ad7:	f7 d9                	neg    %ecx
+  802ad9:	83 c4 10             	add    $0x10,%esp
+  802adc:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ae1:	e9 f0 00 00 00       	jmp    802bd6 <vprintfmt+0x426>
+  802ae6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ae9:	8b 30                	mov    (%eax),%esi
+  802aeb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802aee:	89 f0                	mov    %esi,%eax
+  802af0:	c1 f8 1f             	sar    $0x1f,%eax
+  802af3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802af6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af9:	8d 40 04             	lea    0x4(%eax),%eax
+  802afc:	89 45 14             	mov    %eax,0x14(%ebp)
+  802aff:	eb b0                	jmp    802ab1 <vprintfmt+0x301>
+  802b01:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802b04:	89 55 10             	mov    %edx,0x10(%ebp)
+  802b07:	83 f9 01             	cmp    $0x1,%ecx
+  802b0a:	7f 1e                	jg     802b2a <vprintfmt+0x37a>
+  802b0c:	85 c9                	test   %ecx,%ecx
+  802b0e:	74 32                	je     802b42 <vprintfmt+0x392>
+  802b10:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b13:	8b 10                	mov    (%eax),%edx
+  802b15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b1a:	8d 40 04             	lea    0x4(%eax),%eax
+  802b1d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802b20:	be 0a 00 00 00       	mov    $0xa,%esi
+  802b25:	e9 ac 00 00 00       	jmp    802bd6 <vprintfmt+0x426>
+  802b2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b2d:	8b 10                	mov    (%eax),%edx
+  802b2f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b32:	8d 40 08             	lea    0x8(%eax),%eax
+  802b35:	89 45 14             	mov    %eax,0x14(%ebp)
+  802b38:	be 0a 00 00 00       	mov    $0xa,%esi
+  802b3d:	e9 94 00 00 00       	jmp    802bd6 <vprintfmt+0x426>
+  802b42:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b45:	8b 10                	mov    (%eax),%edx
+  802b47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b4c:	8d 40 04             	lea    0x4(%eax),%eax
+  802b4f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802b52:	be 0a 00 00 00       	mov    $0xa,%esi
+  802b57:	eb 7d                	jmp    802bd6 <vprintfmt+0x426>
+  802b59:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802b5c:	89 55 10             	mov    %edx,0x10(%ebp)
+  802b5f:	83 f9 01             	cmp    $0x1,%ecx
+  802b62:	7f 1b                	jg     802b7f <vprintfmt+0x3cf>
+  802b64:	85 c9                	test   %ecx,%ecx
+  802b66:	74 2c                	je     802b94 <vprintfmt+0x3e4>
+  802b68:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b6b:	8b 10                	mov    (%eax),%edx
+  802b6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b72:	8d 40 04             	lea    0x4(%eax),%eax
+  802b75:	89 45 14             	mov    %eax,0x14(%ebp)
+  802b78:	be 08 00 00 00       	mov    $0x8,%esi
+  802b7d:	eb 57                	jmp    802bd6 <vprintfmt+0x426>
+  802b7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b82:	8b 10                	mov    (%eax),%edx
+  802b84:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b87:	8d 40 08             	lea    0x8(%eax),%eax
+  802b8a:	89 45 14             	mov    %eax,0x14(%ebp)
+  802b8d:	be 08 00 00 00       	mov    $0x8,%esi
+  802b92:	eb 42                	jmp    802bd6 <vprintfmt+0x426>
+  802b94:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b97:	8b 10                	mov    (%eax),%edx
+  802b99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b9e:	8d 40 04             	lea    0x4(%eax),%eax
+  802ba1:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ba4:	be 08 00 00 00       	mov    $0x8,%esi
+  802ba9:	eb 2b                	jmp    802bd6 <vprintfmt+0x426>
+  802bab:	89 55 10             	mov    %edx,0x10(%ebp)
+  802bae:	83 ec 08             	sub    $0x8,%esp
+  802bb1:	53                   	push   %ebx
+  802bb2:	6a 30                	push   $0x30
+  802bb4:	ff d7                	call   *%edi
+  802bb6:	83 c4 08             	add    $0x8,%esp
+  802bb9:	53                   	push   %ebx
+  802bba:	6a 78                	push   $0x78
+  802bbc:	ff d7                	call   *%edi
+  802bbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bc1:	8b 10                	mov    (%eax),%edx
+  802bc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bc8:	83 c4 10             	add    $0x10,%esp
+  802bcb:	8d 40 04             	lea    0x4(%eax),%eax
+  802bce:	89 45 14             	mov    %eax,0x14(%ebp)
+  802bd1:	be 10 00 00 00       	mov    $0x10,%esi
+  802bd6:	83 ec 0c             	sub    $0xc,%esp
+  802bd9:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802bdd:	50                   	push   %eax
+  802bde:	ff 75 e4             	push   -0x1c(%ebp)
+  802be1:	56                   	push   %esi
+  802be2:	51                   	push   %ecx
+  802be3:	52                   	push   %edx
+  802be4:	89 da                	mov    %ebx,%edx
+  802be6:	89 f8                	mov    %edi,%eax
+  802be8:	e8 d8 fa ff ff       	call   8026c5 <printnum>
+  802bed:	83 c4 20             	add    $0x20,%esp
+  802bf0:	e9 cc fb ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802bf5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802bf8:	89 55 10             	mov    %edx,0x10(%ebp)
+  802bfb:	83 f9 01             	cmp    $0x1,%ecx
+  802bfe:	7f 1b                	jg     802c1b <vprintfmt+0x46b>
+  802c00:	85 c9                	test   %ecx,%ecx
+  802c02:	74 2c                	je     802c30 <vprintfmt+0x480>
+  802c04:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c07:	8b 10                	mov    (%eax),%edx
+  802c09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c0e:	8d 40 04             	lea    0x4(%eax),%eax
+  802c11:	89 45 14             	mov    %eax,0x14(%ebp)
+  802c14:	be 10 00 00 00       	mov    $0x10,%esi
+  802c19:	eb bb                	jmp    802bd6 <vprintfmt+0x426>
+  802c1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c1e:	8b 10                	mov    (%eax),%edx
+  802c20:	8b 48 04             	mov    0x4(%eax),%ecx
+  802c23:	8d 40 08             	lea    0x8(%eax),%eax
+  802c26:	89 45 14             	mov    %eax,0x14(%ebp)
+  802c29:	be 10 00 00 00       	mov    $0x10,%esi
+  802c2e:	eb a6                	jmp    802bd6 <vprintfmt+0x426>
+  802c30:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c33:	8b 10                	mov    (%eax),%edx
+  802c35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c3a:	8d 40 04             	lea    0x4(%eax),%eax
+  802c3d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802c40:	be 10 00 00 00       	mov    $0x10,%esi
+  802c45:	eb 8f                	jmp    802bd6 <vprintfmt+0x426>
+  802c47:	89 55 10             	mov    %edx,0x10(%ebp)
+  802c4a:	83 ec 08             	sub    $0x8,%esp
+  802c4d:	53                   	push   %ebx
+  802c4e:	6a 25                	push   $0x25
+  802c50:	ff d7                	call   *%edi
+  802c52:	83 c4 10             	add    $0x10,%esp
+  802c55:	e9 67 fb ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802c5a:	83 ec 08             	sub    $0x8,%esp
+  802c5d:	53                   	push   %ebx
+  802c5e:	6a 25                	push   $0x25
+  802c60:	ff d7                	call   *%edi
+  802c62:	83 c4 10             	add    $0x10,%esp
+  802c65:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  802c69:	0f 84 ba fb ff ff    	je     802829 <vprintfmt+0x79>
+  802c6f:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c72:	89 f0                	mov    %esi,%eax
+  802c74:	83 e8 01             	sub    $0x1,%eax
+  802c77:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802c7b:	75 f7                	jne    802c74 <vprintfmt+0x4c4>
+  802c7d:	89 45 10             	mov    %eax,0x10(%ebp)
+  802c80:	e9 3c fb ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802c85:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802c88:	8d 70 01             	lea    0x1(%eax),%esi
+  802c8b:	0f b6 00             	movzbl (%eax),%eax
+  802c8e:	0f be d0             	movsbl %al,%edx
+  802c91:	85 d2                	test   %edx,%edx
+  802c93:	74 11                	je     802ca6 <vprintfmt+0x4f6>
+  802c95:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802c98:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802c9b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802c9e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ca1:	e9 5d fd ff ff       	jmp    802a03 <vprintfmt+0x253>
+  802ca6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802ca9:	89 45 14             	mov    %eax,0x14(%ebp)
+  802cac:	e9 10 fb ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802cb1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802cb4:	89 45 14             	mov    %eax,0x14(%ebp)
+  802cb7:	e9 05 fb ff ff       	jmp    8027c1 <vprintfmt+0x11>
+  802cbc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802cc0:	7e 0a                	jle    802ccc <vprintfmt+0x51c>
+  802cc2:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802cc6:	0f 85 bd fc ff ff    	jne    802989 <vprintfmt+0x1d9>
+  802ccc:	ba 28 00 00 00       	mov    $0x28,%edx
+  802cd1:	b8 28 00 00 00       	mov    $0x28,%eax
+  802cd6:	be cd 33 80 00       	mov    $0x8033cd,%esi
+  802cdb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802cde:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802ce1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802ce4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ce7:	e9 17 fd ff ff       	jmp    802a03 <vprintfmt+0x253>
+  802cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cef:	5b                   	pop    %ebx
+  802cf0:	5e                   	pop    %esi
+  802cf1:	5f                   	pop    %edi
+  802cf2:	5d                   	pop    %ebp
+  802cf3:	c3                   	ret
+
+00802cf4 <vsnprintf>:
+  802cf4:	55                   	push   %ebp
+  802cf5:	89 e5                	mov    %esp,%ebp
+  802cf7:	83 ec 18             	sub    $0x18,%esp
+  802cfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d00:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802d03:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802d07:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802d0a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  802d11:	85 c0                	test   %eax,%eax
+  802d13:	74 26                	je     802d3b <vsnprintf+0x47>
+  802d15:	85 d2                	test   %edx,%edx
+  802d17:	7e 22                	jle    802d3b <vsnprintf+0x47>
+  802d19:	ff 75 14             	push   0x14(%ebp)
+  802d1c:	ff 75 10             	push   0x10(%ebp)
+  802d1f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802d22:	50                   	push   %eax
+  802d23:	68 76 27 80 00       	push   $0x802776
+  802d28:	e8 83 fa ff ff       	call   8027b0 <vprintfmt>
+  802d2d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802d30:	c6 00 00             	movb   $0x0,(%eax)
+  802d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d36:	83 c4 10             	add    $0x10,%esp
+  802d39:	c9                   	leave
+  802d3a:	c3                   	ret
+  802d3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d40:	eb f7                	jmp    802d39 <vsnprintf+0x45>
+
+00802d42 <snprintf>:
+  802d42:	55                   	push   %ebp
+  802d43:	89 e5                	mov    %esp,%ebp
+  802d45:	83 ec 08             	sub    $0x8,%esp
+  802d48:	8d 45 14             	lea    0x14(%ebp),%eax
+  802d4b:	50                   	push   %eax
+  802d4c:	ff 75 10             	push   0x10(%ebp)
+  802d4f:	ff 75 0c             	push   0xc(%ebp)
+  802d52:	ff 75 08             	push   0x8(%ebp)
+  802d55:	e8 9a ff ff ff       	call   802cf4 <vsnprintf>
+  802d5a:	c9                   	leave
+  802d5b:	c3                   	ret
+
+00802d5c <ipc_recv>:
+  802d5c:	55                   	push   %ebp
+  802d5d:	89 e5                	mov    %esp,%ebp
+  802d5f:	56                   	push   %esi
+  802d60:	53                   	push   %ebx
+  802d61:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d6a:	85 c0                	test   %eax,%eax
+  802d6c:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802d71:	0f 44 c2             	cmove  %edx,%eax
+  802d74:	83 ec 0c             	sub    $0xc,%esp
+  802d77:	50                   	push   %eax
+  802d78:	e8 37 db ff ff       	call   8008b4 <sys_ipc_recv>
+  802d7d:	83 c4 10             	add    $0x10,%esp
+  802d80:	85 c0                	test   %eax,%eax
+  802d82:	78 2a                	js     802dae <ipc_recv+0x52>
+  802d84:	a1 10 50 80 00       	mov    0x805010,%eax
+  802d89:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802d8f:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802d95:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d9b:	85 f6                	test   %esi,%esi
+  802d9d:	74 02                	je     802da1 <ipc_recv+0x45>
+  802d9f:	89 0e                	mov    %ecx,(%esi)
+  802da1:	85 db                	test   %ebx,%ebx
+  802da3:	74 02                	je     802da7 <ipc_recv+0x4b>
+  802da5:	89 13                	mov    %edx,(%ebx)
+  802da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802daa:	5b                   	pop    %ebx
+  802dab:	5e                   	pop    %esi
+  802dac:	5d                   	pop    %ebp
+  802dad:	c3                   	ret
+  802dae:	ba 00 00 00 00       	mov    $0x0,%edx
+  802db3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802db8:	eb e1                	jmp    802d9b <ipc_recv+0x3f>
+
+00802dba <ipc_send>:
+  802dba:	55                   	push   %ebp
+  802dbb:	89 e5                	mov    %esp,%ebp
+  802dbd:	57                   	push   %edi
+  802dbe:	56                   	push   %esi
+  802dbf:	53                   	push   %ebx
+  802dc0:	83 ec 0c             	sub    $0xc,%esp
+  802dc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802dc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dc9:	8b 75 14             	mov    0x14(%ebp),%esi
+  802dcc:	85 db                	test   %ebx,%ebx
+  802dce:	74 1e                	je     802dee <ipc_send+0x34>
+  802dd0:	56                   	push   %esi
+  802dd1:	53                   	push   %ebx
+  802dd2:	57                   	push   %edi
+  802dd3:	ff 75 08             	push   0x8(%ebp)
+  802dd6:	e8 66 db ff ff       	call   800941 <sys_ipc_send>
+  802ddb:	83 c4 10             	add    $0x10,%esp
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	74 2a                	je     802e0c <ipc_send+0x52>
+  802de2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802de5:	75 13                	jne    802dfa <ipc_send+0x40>
+  802de7:	e8 d2 d7 ff ff       	call   8005be <sys_yield>
+  802dec:	eb e2                	jmp    802dd0 <ipc_send+0x16>
+  802dee:	be 00 00 00 00       	mov    $0x0,%esi
+  802df3:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802df8:	eb d6                	jmp    802dd0 <ipc_send+0x16>
+  802dfa:	50                   	push   %eax
+  802dfb:	68 cc 36 80 00       	push   $0x8036cc
+  802e00:	6a 4f                	push   $0x4f
+  802e02:	68 0f 37 80 00       	push   $0x80370f
+  802e07:	e8 ca f7 ff ff       	call   8025d6 <_panic>
+  802e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e0f:	5b                   	pop    %ebx
+  802e10:	5e                   	pop    %esi
+  802e11:	5f                   	pop    %edi
+  802e12:	5d                   	pop    %ebp
+  802e13:	c3                   	ret
+
+00802e14 <ipc_call>:
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	57                   	push   %edi
+  802e18:	56                   	push   %esi
+  802e19:	53                   	push   %ebx
+  802e1a:	83 ec 0c             	sub    $0xc,%esp
+  802e1d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e21:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802e26:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802e2a:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e2e:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802e33:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802e37:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e40:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802e44:	eb 05                	jmp    802e4b <ipc_call+0x37>
+  802e46:	e8 73 d7 ff ff       	call   8005be <sys_yield>
+  802e4b:	83 ec 0c             	sub    $0xc,%esp
+  802e4e:	56                   	push   %esi
+  802e4f:	53                   	push   %ebx
+  802e50:	57                   	push   %edi
+  802e51:	ff 75 0c             	push   0xc(%ebp)
+  802e54:	ff 75 08             	push   0x8(%ebp)
+  802e57:	e8 35 db ff ff       	call   800991 <sys_ipc_call>
+  802e5c:	83 c4 20             	add    $0x20,%esp
+  802e5f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e62:	74 e2                	je     802e46 <ipc_call+0x32>
+  802e64:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802e67:	74 2d                	je     802e96 <ipc_call+0x82>
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	78 4f                	js     802ebc <ipc_call+0xa8>
+  802e6d:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802e71:	74 10                	je     802e83 <ipc_call+0x6f>
+  802e73:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e78:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e7e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802e81:	89 02                	mov    %eax,(%edx)
+  802e83:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e88:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e91:	5b                   	pop    %ebx
+  802e92:	5e                   	pop    %esi
+  802e93:	5f                   	pop    %edi
+  802e94:	5d                   	pop    %ebp
+  802e95:	c3                   	ret
+  802e96:	ff 75 14             	push   0x14(%ebp)
+  802e99:	ff 75 10             	push   0x10(%ebp)
+  802e9c:	ff 75 0c             	push   0xc(%ebp)
+  802e9f:	ff 75 08             	push   0x8(%ebp)
+  802ea2:	e8 13 ff ff ff       	call   802dba <ipc_send>
+  802ea7:	83 c4 0c             	add    $0xc,%esp
+  802eaa:	ff 75 1c             	push   0x1c(%ebp)
+  802ead:	ff 75 18             	push   0x18(%ebp)
+  802eb0:	6a 00                	push   $0x0
+  802eb2:	e8 a5 fe ff ff       	call   802d5c <ipc_recv>
+  802eb7:	83 c4 10             	add    $0x10,%esp
+  802eba:	eb d2                	jmp    802e8e <ipc_call+0x7a>
+  802ebc:	50                   	push   %eax
+  802ebd:	68 19 37 80 00       	push   $0x803719
+  802ec2:	6a 6d                	push   $0x6d
+  802ec4:	68 0f 37 80 00       	push   $0x80370f
+  802ec9:	e8 08 f7 ff ff       	call   8025d6 <_panic>
+
+00802ece <ipc_reply_recv>:
+  802ece:	55                   	push   %ebp
+  802ecf:	89 e5                	mov    %esp,%ebp
+  802ed1:	57                   	push   %edi
+  802ed2:	56                   	push   %esi
+  802ed3:	53                   	push   %ebx
+  802ed4:	83 ec 0c             	sub    $0xc,%esp
+  802ed7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802eda:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802edd:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802ee0:	85 db                	test   %ebx,%ebx
+  802ee2:	0f 84 ac 00 00 00    	je     802f94 <ipc_reply_recv+0xc6>
+  802ee8:	85 f6                	test   %esi,%esi
+  802eea:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802eef:	0f 45 c6             	cmovne %esi,%eax
+  802ef2:	83 ec 0c             	sub    $0xc,%esp
+  802ef5:	50                   	push   %eax
+  802ef6:	ff 75 14             	push   0x14(%ebp)
+  802ef9:	53                   	push   %ebx
+  802efa:	ff 75 0c             	push   0xc(%ebp)
+  802efd:	ff 75 08             	push   0x8(%ebp)
+  802f00:	e8 ad da ff ff       	call   8009b2 <sys_ipc_reply_recv>
+  802f05:	83 c4 20             	add    $0x20,%esp
+  802f08:	85 c0                	test   %eax,%eax
+  802f0a:	78 3a                	js     802f46 <ipc_reply_recv+0x78>
+  802f0c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f10:	74 10                	je     802f22 <ipc_reply_recv+0x54>
+  802f12:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f17:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802f1d:	8b 55 18             	mov    0x18(%ebp),%edx
+  802f20:	89 02                	mov    %eax,(%edx)
+  802f22:	85 ff                	test   %edi,%edi
+  802f24:	74 0d                	je     802f33 <ipc_reply_recv+0x65>
+  802f26:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f2b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f31:	89 07                	mov    %eax,(%edi)
+  802f33:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f38:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f41:	5b                   	pop    %ebx
+  802f42:	5e                   	pop    %esi
+  802f43:	5f                   	pop    %edi
+  802f44:	5d                   	pop    %ebp
+  802f45:	c3                   	ret
+  802f46:	ff 75 14             	push   0x14(%ebp)
+  802f49:	53                   	push   %ebx
+  802f4a:	ff 75 0c             	push   0xc(%ebp)
+  802f4d:	ff 75 08             	push   0x8(%ebp)
+  802f50:	e8 0f d9 ff ff       	call   800864 <sys_ipc_try_send>
+  802f55:	89 c2                	mov    %eax,%edx
+  802f57:	c1 ea 1f             	shr    $0x1f,%edx
+  802f5a:	83 c4 10             	add    $0x10,%esp
+  802f5d:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802f60:	0f 95 c1             	setne  %cl
+  802f63:	84 d1                	test   %dl,%cl
+  802f65:	74 05                	je     802f6c <ipc_reply_recv+0x9e>
+  802f67:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f6a:	75 12                	jne    802f7e <ipc_reply_recv+0xb0>
+  802f6c:	83 ec 04             	sub    $0x4,%esp
+  802f6f:	57                   	push   %edi
+  802f70:	56                   	push   %esi
+  802f71:	ff 75 18             	push   0x18(%ebp)
+  802f74:	e8 e3 fd ff ff       	call   802d5c <ipc_recv>
+  802f79:	83 c4 10             	add    $0x10,%esp
+  802f7c:	eb c0                	jmp    802f3e <ipc_reply_recv+0x70>
+  802f7e:	83 ec 04             	sub    $0x4,%esp
+  802f81:	50                   	push   %eax
+  802f82:	ff 75 08             	push   0x8(%ebp)
+  802f85:	68 ec 36 80 00       	push   $0x8036ec
+  802f8a:	e8 22 f7 ff ff       	call   8026b1 <cprintf>
+  802f8f:	83 c4 10             	add    $0x10,%esp
+  802f92:	eb d8                	jmp    802f6c <ipc_reply_recv+0x9e>
+  802f94:	85 f6                	test   %esi,%esi
+  802f96:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f9b:	0f 45 c6             	cmovne %esi,%eax
+  802f9e:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802fa3:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802faa:	e9 43 ff ff ff       	jmp    802ef2 <ipc_reply_recv+0x24>
+
+00802faf <ipc_find_env>:
+  802faf:	55                   	push   %ebp
+  802fb0:	89 e5                	mov    %esp,%ebp
+  802fb2:	83 ec 14             	sub    $0x14,%esp
+  802fb5:	ff 75 08             	push   0x8(%ebp)
+  802fb8:	e8 45 d8 ff ff       	call   800802 <sys_env_service>
+  802fbd:	85 c0                	test   %eax,%eax
+  802fbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc4:	0f 48 c2             	cmovs  %edx,%eax
+  802fc7:	c9                   	leave
+  802fc8:	c3                   	ret
+
+00802fc9 <pageref>:
+  802fc9:	55                   	push   %ebp
+  802fca:	89 e5                	mov    %esp,%ebp
+  802fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fcf:	89 c2                	mov    %eax,%edx
+  802fd1:	c1 ea 16             	shr    $0x16,%edx
+  802fd4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe0:	f6 c1 01             	test   $0x1,%cl
+  802fe3:	74 22                	je     803007 <pageref+0x3e>
+  802fe5:	c1 e8 0c             	shr    $0xc,%eax
+  802fe8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fef:	a8 01                	test   $0x1,%al
+  802ff1:	74 14                	je     803007 <pageref+0x3e>
+  802ff3:	c1 e8 0c             	shr    $0xc,%eax
+  802ff6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802ff9:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803000:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803004:	0f b7 d2             	movzwl %dx,%edx
+  803007:	89 d0                	mov    %edx,%eax
+  803009:	5d                   	pop    %ebp
+  80300a:	c3                   	ret
+
+0080300b <__udivmoddi4>:
+  80300b:	55                   	push   %ebp
+  80300c:	57                   	push   %edi
+  80300d:	56                   	push   %esi
+  80300e:	53                   	push   %ebx
+  80300f:	83 ec 24             	sub    $0x24,%esp
+  803012:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803016:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80301a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80301e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803022:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803026:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80302a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80302e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803032:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803040:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803045:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80304c:	00 
+  80304d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803054:	00 
+  803055:	89 fb                	mov    %edi,%ebx
+  803057:	eb 08                	jmp    803061 <__udivmoddi4+0x56>
+  803059:	83 e9 01             	sub    $0x1,%ecx
+  80305c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80305f:	74 68                	je     8030c9 <__udivmoddi4+0xbe>
+  803061:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803065:	01 c0                	add    %eax,%eax
+  803067:	89 c6                	mov    %eax,%esi
+  803069:	89 d7                	mov    %edx,%edi
+  80306b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80306f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803073:	0f ad d0             	shrd   %cl,%edx,%eax
+  803076:	d3 ea                	shr    %cl,%edx
+  803078:	f6 c1 20             	test   $0x20,%cl
+  80307b:	74 04                	je     803081 <__udivmoddi4+0x76>
+  80307d:	89 d0                	mov    %edx,%eax
+  80307f:	31 d2                	xor    %edx,%edx
+  803081:	83 e0 01             	and    $0x1,%eax
+  803084:	89 04 24             	mov    %eax,(%esp)
+  803087:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80308e:	00 
+  80308f:	8b 04 24             	mov    (%esp),%eax
+  803092:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803096:	09 f0                	or     %esi,%eax
+  803098:	09 fa                	or     %edi,%edx
+  80309a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80309e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8030a2:	39 f0                	cmp    %esi,%eax
+  8030a4:	89 d5                	mov    %edx,%ebp
+  8030a6:	19 fd                	sbb    %edi,%ebp
+  8030a8:	72 af                	jb     803059 <__udivmoddi4+0x4e>
+  8030aa:	29 f0                	sub    %esi,%eax
+  8030ac:	19 fa                	sbb    %edi,%edx
+  8030ae:	89 cf                	mov    %ecx,%edi
+  8030b0:	c1 ef 05             	shr    $0x5,%edi
+  8030b3:	83 e7 01             	and    $0x1,%edi
+  8030b6:	89 fe                	mov    %edi,%esi
+  8030b8:	83 f6 01             	xor    $0x1,%esi
+  8030bb:	d3 e6                	shl    %cl,%esi
+  8030bd:	d3 e7                	shl    %cl,%edi
+  8030bf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8030c3:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8030c7:	eb 90                	jmp    803059 <__udivmoddi4+0x4e>
+  8030c9:	85 db                	test   %ebx,%ebx
+  8030cb:	74 05                	je     8030d2 <__udivmoddi4+0xc7>
+  8030cd:	89 03                	mov    %eax,(%ebx)
+  8030cf:	89 53 04             	mov    %edx,0x4(%ebx)
+  8030d2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8030d6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8030da:	83 c4 24             	add    $0x24,%esp
+  8030dd:	5b                   	pop    %ebx
+  8030de:	5e                   	pop    %esi
+  8030df:	5f                   	pop    %edi
+  8030e0:	5d                   	pop    %ebp
+  8030e1:	c3                   	ret
+
+008030e2 <__udivdi3>:
+  8030e2:	83 ec 08             	sub    $0x8,%esp
+  8030e5:	6a 00                	push   $0x0
+  8030e7:	ff 74 24 1c          	push   0x1c(%esp)
+  8030eb:	ff 74 24 1c          	push   0x1c(%esp)
+  8030ef:	ff 74 24 1c          	push   0x1c(%esp)
+  8030f3:	ff 74 24 1c          	push   0x1c(%esp)
+  8030f7:	e8 0f ff ff ff       	call   80300b <__udivmoddi4>
+  8030fc:	83 c4 1c             	add    $0x1c,%esp
+  8030ff:	c3                   	ret
+
+00803100 <__umoddi3>:
+  803100:	83 ec 18             	sub    $0x18,%esp
+  803103:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803107:	50                   	push   %eax
+  803108:	ff 74 24 2c          	push   0x2c(%esp)
+  80310c:	ff 74 24 2c          	push   0x2c(%esp)
+  803110:	ff 74 24 2c          	push   0x2c(%esp)
+  803114:	ff 74 24 2c          	push   0x2c(%esp)
+  803118:	e8 ee fe ff ff       	call   80300b <__udivmoddi4>
+  80311d:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803121:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803125:	83 c4 2c             	add    $0x2c,%esp
+  803128:	c3                   	ret
+
+00803129 <__divdi3>:
+  803129:	53                   	push   %ebx
+  80312a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80312e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803132:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803136:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80313a:	85 d2                	test   %edx,%edx
+  80313c:	78 12                	js     803150 <__divdi3+0x27>
+  80313e:	85 db                	test   %ebx,%ebx
+  803140:	78 2e                	js     803170 <__divdi3+0x47>
+  803142:	53                   	push   %ebx
+  803143:	51                   	push   %ecx
+  803144:	52                   	push   %edx
+  803145:	50                   	push   %eax
+  803146:	e8 97 ff ff ff       	call   8030e2 <__udivdi3>
+  80314b:	83 c4 10             	add    $0x10,%esp
+  80314e:	eb 1e                	jmp    80316e <__divdi3+0x45>
+  803150:	f7 d8                	neg    %eax
+  803152:	83 d2 00             	adc    $0x0,%edx
+  803155:	f7 da                	neg    %edx
+  803157:	85 db                	test   %ebx,%ebx
+  803159:	78 2a                	js     803185 <__divdi3+0x5c>
+  80315b:	53                   	push   %ebx
+  80315c:	51                   	push   %ecx
+  80315d:	52                   	push   %edx
+  80315e:	50                   	push   %eax
+  80315f:	e8 7e ff ff ff       	call   8030e2 <__udivdi3>
+  803164:	83 c4 10             	add    $0x10,%esp
+  803167:	f7 d8                	neg    %eax
+  803169:	83 d2 00             	adc    $0x0,%edx
+  80316c:	f7 da                	neg    %edx
+  80316e:	5b                   	pop    %ebx
+  80316f:	c3                   	ret
+  803170:	f7 d9                	neg    %ecx
+  803172:	83 d3 00             	adc    $0x0,%ebx
+  803175:	f7 db                	neg    %ebx
+  803177:	53                   	push   %ebx
+  803178:	51                   	push   %ecx
+  803179:	52                   	push   %edx
+  80317a:	50                   	push   %eax
+  80317b:	e8 62 ff ff ff       	call   8030e2 <__udivdi3>
+  803180:	83 c4 10             	add    $0x10,%esp
+  803183:	eb e2                	jmp    803167 <__divdi3+0x3e>
+  803185:	f7 d9                	neg    %ecx
+  803187:	83 d3 00             	adc    $0x0,%ebx
+  80318a:	f7 db                	neg    %ebx
+  80318c:	53                   	push   %ebx
+  80318d:	51                   	push   %ecx
+  80318e:	52                   	push   %edx
+  80318f:	50                   	push   %eax
+  803190:	e8 4d ff ff ff       	call   8030e2 <__udivdi3>
+  803195:	83 c4 10             	add    $0x10,%esp
+  803198:	eb d4                	jmp    80316e <__divdi3+0x45>
+
+0080319a <__moddi3>:
+  80319a:	55                   	push   %ebp
+  80319b:	57                   	push   %edi
+  80319c:	56                   	push   %esi
+  80319d:	53                   	push   %ebx
+  80319e:	83 ec 0c             	sub    $0xc,%esp
+  8031a1:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8031a5:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8031a9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031ad:	89 e9                	mov    %ebp,%ecx
+  8031af:	f7 d9                	neg    %ecx
+  8031b1:	89 d0                	mov    %edx,%eax
+  8031b3:	83 d0 00             	adc    $0x0,%eax
+  8031b6:	f7 d8                	neg    %eax
+  8031b8:	0f 49 e9             	cmovns %ecx,%ebp
+  8031bb:	0f 49 d0             	cmovns %eax,%edx
+  8031be:	52                   	push   %edx
+  8031bf:	55                   	push   %ebp
+  8031c0:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8031c4:	f7 da                	neg    %edx
+  8031c6:	89 d8                	mov    %ebx,%eax
+  8031c8:	83 d0 00             	adc    $0x0,%eax
+  8031cb:	f7 d8                	neg    %eax
+  8031cd:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8031d2:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8031d6:	0f 48 c3             	cmovs  %ebx,%eax
+  8031d9:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8031dd:	ff 74 24 0c          	push   0xc(%esp)
+  8031e1:	ff 74 24 0c          	push   0xc(%esp)
+  8031e5:	e8 16 ff ff ff       	call   803100 <__umoddi3>
+  8031ea:	83 c4 10             	add    $0x10,%esp
+  8031ed:	85 db                	test   %ebx,%ebx
+  8031ef:	78 08                	js     8031f9 <__moddi3+0x5f>
+  8031f1:	83 c4 0c             	add    $0xc,%esp
+  8031f4:	5b                   	pop    %ebx
+  8031f5:	5e                   	pop    %esi
+  8031f6:	5f                   	pop    %edi
+  8031f7:	5d                   	pop    %ebp
+  8031f8:	c3                   	ret
+  8031f9:	f7 d8                	neg    %eax
+  8031fb:	83 d2 00             	adc    $0x0,%edx
+  8031fe:	f7 da                	neg    %edx
+  803200:	eb ef                	jmp    8031f1 <__moddi3+0x57>
@@ -0,0 +1,5482 @@
+
+obj/user/echosrv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 c0 01 00 00       	call   8001f1 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	50                   	push   %eax
+  80003a:	68 90 36 80 00       	push   $0x803690
+  80003f:	e8 bb 02 00 00       	call   8002ff <cprintf>
+  800044:	e8 f1 01 00 00       	call   80023a <exit>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <handle_client>:
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 30             	sub    $0x30,%esp
+  800057:	8b 75 08             	mov    0x8(%ebp),%esi
+  80005a:	6a 20                	push   $0x20
+  80005c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	56                   	push   %esi
+  800061:	e8 37 19 00 00       	call   80199d <read>
+  800066:	83 c4 10             	add    $0x10,%esp
+  800069:	85 c0                	test   %eax,%eax
+  80006b:	78 09                	js     800076 <handle_client+0x28>
+  80006d:	89 c3                	mov    %eax,%ebx
+  80006f:	7e 50                	jle    8000c1 <handle_client+0x73>
+  800071:	8d 7d c8             	lea    -0x38(%ebp),%edi
+  800074:	eb 23                	jmp    800099 <handle_client+0x4b>
+  800076:	b8 94 36 80 00       	mov    $0x803694,%eax
+  80007b:	e8 b3 ff ff ff       	call   800033 <die>
+  800080:	eb 3f                	jmp    8000c1 <handle_client+0x73>
+  800082:	83 ec 04             	sub    $0x4,%esp
+  800085:	6a 20                	push   $0x20
+  800087:	57                   	push   %edi
+  800088:	56                   	push   %esi
+  800089:	e8 0f 19 00 00       	call   80199d <read>
+  80008e:	89 c3                	mov    %eax,%ebx
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	85 c0                	test   %eax,%eax
+  800095:	78 20                	js     8000b7 <handle_client+0x69>
+  800097:	7e 28                	jle    8000c1 <handle_client+0x73>
+  800099:	83 ec 04             	sub    $0x4,%esp
+  80009c:	53                   	push   %ebx
+  80009d:	57                   	push   %edi
+  80009e:	56                   	push   %esi
+  80009f:	e8 d4 19 00 00       	call   801a78 <write>
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	39 d8                	cmp    %ebx,%eax
+  8000a9:	74 d7                	je     800082 <handle_client+0x34>
+  8000ab:	b8 c0 36 80 00       	mov    $0x8036c0,%eax
+  8000b0:	e8 7e ff ff ff       	call   800033 <die>
+  8000b5:	eb cb                	jmp    800082 <handle_client+0x34>
+  8000b7:	b8 e0 36 80 00       	mov    $0x8036e0,%eax
+  8000bc:	e8 72 ff ff ff       	call   800033 <die>
+  8000c1:	83 ec 0c             	sub    $0xc,%esp
+  8000c4:	56                   	push   %esi
+  8000c5:	e8 97 17 00 00       	call   801861 <close>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+  8000cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5f                   	pop    %edi
+  8000d3:	5d                   	pop    %ebp
+  8000d4:	c3                   	ret
+
+008000d5 <umain>:
+  8000d5:	55                   	push   %ebp
+  8000d6:	89 e5                	mov    %esp,%ebp
+  8000d8:	57                   	push   %edi
+  8000d9:	56                   	push   %esi
+  8000da:	53                   	push   %ebx
+  8000db:	83 ec 40             	sub    $0x40,%esp
+  8000de:	6a 06                	push   $0x6
+  8000e0:	6a 01                	push   $0x1
+  8000e2:	6a 02                	push   $0x2
+  8000e4:	e8 cd 23 00 00       	call   8024b6 <socket>
+  8000e9:	89 c6                	mov    %eax,%esi
+  8000eb:	83 c4 10             	add    $0x10,%esp
+  8000ee:	85 c0                	test   %eax,%eax
+  8000f0:	0f 88 86 00 00 00    	js     80017c <umain+0xa7>
+  8000f6:	83 ec 0c             	sub    $0xc,%esp
+  8000f9:	68 58 36 80 00       	push   $0x803658
+  8000fe:	e8 fc 01 00 00       	call   8002ff <cprintf>
+  800103:	83 c4 0c             	add    $0xc,%esp
+  800106:	6a 10                	push   $0x10
+  800108:	6a 00                	push   $0x0
+  80010a:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80010d:	53                   	push   %ebx
+  80010e:	e8 5e 0a 00 00       	call   800b71 <memset>
+  800113:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+  800117:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80011e:	e8 c3 30 00 00       	call   8031e6 <htonl>
+  800123:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800126:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80012d:	e8 9a 30 00 00       	call   8031cc <htons>
+  800132:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+  800136:	c7 04 24 67 36 80 00 	movl   $0x803667,(%esp)
+  80013d:	e8 bd 01 00 00       	call   8002ff <cprintf>
+  800142:	83 c4 0c             	add    $0xc,%esp
+  800145:	6a 10                	push   $0x10
+  800147:	53                   	push   %ebx
+  800148:	56                   	push   %esi
+  800149:	e8 d6 22 00 00       	call   802424 <bind>
+  80014e:	83 c4 10             	add    $0x10,%esp
+  800151:	85 c0                	test   %eax,%eax
+  800153:	78 36                	js     80018b <umain+0xb6>
+  800155:	83 ec 08             	sub    $0x8,%esp
+  800158:	6a 05                	push   $0x5
+  80015a:	56                   	push   %esi
+  80015b:	e8 33 23 00 00       	call   802493 <listen>
+  800160:	83 c4 10             	add    $0x10,%esp
+  800163:	85 c0                	test   %eax,%eax
+  800165:	78 30                	js     800197 <umain+0xc2>
+  800167:	83 ec 0c             	sub    $0xc,%esp
+  80016a:	68 77 36 80 00       	push   $0x803677
+  80016f:	e8 8b 01 00 00       	call   8002ff <cprintf>
+  800174:	83 c4 10             	add    $0x10,%esp
+  800177:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  80017a:	eb 55                	jmp    8001d1 <umain+0xfc>
+  80017c:	b8 40 36 80 00       	mov    $0x803640,%eax
+  800181:	e8 ad fe ff ff       	call   800033 <die>
+  800186:	e9 6b ff ff ff       	jmp    8000f6 <umain+0x21>
+  80018b:	b8 10 37 80 00       	mov    $0x803710,%eax
+  800190:	e8 9e fe ff ff       	call   800033 <die>
+  800195:	eb be                	jmp    800155 <umain+0x80>
+  800197:	b8 34 37 80 00       	mov    $0x803734,%eax
+  80019c:	e8 92 fe ff ff       	call   800033 <die>
+  8001a1:	eb c4                	jmp    800167 <umain+0x92>
+  8001a3:	b8 58 37 80 00       	mov    $0x803758,%eax
+  8001a8:	e8 86 fe ff ff       	call   800033 <die>
+  8001ad:	83 ec 0c             	sub    $0xc,%esp
+  8001b0:	ff 75 cc             	push   -0x34(%ebp)
+  8001b3:	e8 60 2f 00 00       	call   803118 <inet_ntoa>
+  8001b8:	83 c4 08             	add    $0x8,%esp
+  8001bb:	50                   	push   %eax
+  8001bc:	68 7e 36 80 00       	push   $0x80367e
+  8001c1:	e8 39 01 00 00       	call   8002ff <cprintf>
+  8001c6:	89 1c 24             	mov    %ebx,(%esp)
+  8001c9:	e8 80 fe ff ff       	call   80004e <handle_client>
+  8001ce:	83 c4 10             	add    $0x10,%esp
+  8001d1:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+  8001d8:	83 ec 04             	sub    $0x4,%esp
+  8001db:	57                   	push   %edi
+  8001dc:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8001df:	50                   	push   %eax
+  8001e0:	56                   	push   %esi
+  8001e1:	e8 0f 22 00 00       	call   8023f5 <accept>
+  8001e6:	89 c3                	mov    %eax,%ebx
+  8001e8:	83 c4 10             	add    $0x10,%esp
+  8001eb:	85 c0                	test   %eax,%eax
+  8001ed:	78 b4                	js     8001a3 <umain+0xce>
+  8001ef:	eb bc                	jmp    8001ad <umain+0xd8>
+
+008001f1 <libmain>:
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	56                   	push   %esi
+  8001f5:	53                   	push   %ebx
+  8001f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001fc:	e8 eb 0b 00 00       	call   800dec <sys_getenvid>
+  800201:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800206:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80020c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800211:	a3 20 50 80 00       	mov    %eax,0x805020
+  800216:	85 db                	test   %ebx,%ebx
+  800218:	7e 07                	jle    800221 <libmain+0x30>
+  80021a:	8b 06                	mov    (%esi),%eax
+  80021c:	a3 00 40 80 00       	mov    %eax,0x804000
+  800221:	83 ec 08             	sub    $0x8,%esp
+  800224:	56                   	push   %esi
+  800225:	53                   	push   %ebx
+  800226:	e8 aa fe ff ff       	call   8000d5 <umain>
+  80022b:	e8 0a 00 00 00       	call   80023a <exit>
+  800230:	83 c4 10             	add    $0x10,%esp
+  800233:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800236:	5b                   	pop    %ebx
+  800237:	5e                   	pop    %esi
+  800238:	5d                   	pop    %ebp
+  800239:	c3                   	ret
+
+0080023a <exit>:
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	83 ec 08             	sub    $0x8,%esp
+  800240:	a1 20 50 80 00       	mov    0x805020,%eax
+  800245:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80024b:	85 c0                	test   %eax,%eax
+  80024d:	75 14                	jne    800263 <exit+0x29>
+  80024f:	e8 3a 16 00 00       	call   80188e <close_all>
+  800254:	83 ec 0c             	sub    $0xc,%esp
+  800257:	6a 00                	push   $0x0
+  800259:	e8 4d 0b 00 00       	call   800dab <sys_env_destroy>
+  80025e:	83 c4 10             	add    $0x10,%esp
+  800261:	c9                   	leave
+  800262:	c3                   	ret
+  800263:	e8 b0 12 00 00       	call   801518 <sys_lease_complete>
+  800268:	eb e5                	jmp    80024f <exit+0x15>
+
+0080026a <putch>:
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	53                   	push   %ebx
+  80026e:	83 ec 04             	sub    $0x4,%esp
+  800271:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800274:	8b 13                	mov    (%ebx),%edx
+  800276:	8d 42 01             	lea    0x1(%edx),%eax
+  800279:	89 03                	mov    %eax,(%ebx)
+  80027b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80027e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800282:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800287:	74 09                	je     800292 <putch+0x28>
+  800289:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80028d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800290:	c9                   	leave
+  800291:	c3                   	ret
+  800292:	83 ec 08             	sub    $0x8,%esp
+  800295:	68 ff 00 00 00       	push   $0xff
+  80029a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80029d:	50                   	push   %eax
+  80029e:	e8 cb 0a 00 00       	call   800d6e <sys_cputs>
+  8002a3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002a9:	83 c4 10             	add    $0x10,%esp
+  8002ac:	eb db                	jmp    800289 <putch+0x1f>
+
+008002ae <vcprintf>:
+  8002ae:	55                   	push   %ebp
+  8002af:	89 e5                	mov    %esp,%ebp
+  8002b1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002b7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002be:	00 00 00 
+  8002c1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002c8:	00 00 00 
+  8002cb:	ff 75 0c             	push   0xc(%ebp)
+  8002ce:	ff 75 08             	push   0x8(%ebp)
+  8002d1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002d7:	50                   	push   %eax
+  8002d8:	68 6a 02 80 00       	push   $0x80026a
+  8002dd:	e8 1c 01 00 00       	call   8003fe <vprintfmt>
+  8002e2:	83 c4 08             	add    $0x8,%esp
+  8002e5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002eb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002f1:	50                   	push   %eax
+  8002f2:	e8 77 0a 00 00       	call   800d6e <sys_cputs>
+  8002f7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002fd:	c9                   	leave
+  8002fe:	c3                   	ret
+
+008002ff <cprintf>:
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	83 ec 10             	sub    $0x10,%esp
+  800305:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800308:	50                   	push   %eax
+  800309:	ff 75 08             	push   0x8(%ebp)
+  80030c:	e8 9d ff ff ff       	call   8002ae <vcprintf>
+  800311:	c9                   	leave
+  800312:	c3                   	ret
+
+00800313 <printnum>:
+  800313:	55                   	push   %ebp
+  800314:	89 e5                	mov    %esp,%ebp
+  800316:	57                   	push   %edi
+  800317:	56                   	push   %esi
+  800318:	53                   	push   %ebx
+  800319:	83 ec 1c             	sub    $0x1c,%esp
+  80031c:	89 c3                	mov    %eax,%ebx
+  80031e:	89 d6                	mov    %edx,%esi
+  800320:	8b 45 08             	mov    0x8(%ebp),%eax
+  800323:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800326:	89 d1                	mov    %edx,%ecx
+  800328:	89 c2                	mov    %eax,%edx
+  80032a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80032d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800330:	8b 45 10             	mov    0x10(%ebp),%eax
+  800333:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800336:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80033d:	39 c2                	cmp    %eax,%edx
+  80033f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800342:	73 4b                	jae    80038f <printnum+0x7c>
+  800344:	8b 45 14             	mov    0x14(%ebp),%eax
+  800347:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80034a:	85 ff                	test   %edi,%edi
+  80034c:	7e 11                	jle    80035f <printnum+0x4c>
+  80034e:	83 ec 08             	sub    $0x8,%esp
+  800351:	56                   	push   %esi
+  800352:	ff 75 18             	push   0x18(%ebp)
+  800355:	ff d3                	call   *%ebx
+  800357:	83 c4 10             	add    $0x10,%esp
+  80035a:	83 ef 01             	sub    $0x1,%edi
+  80035d:	75 ef                	jne    80034e <printnum+0x3b>
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	56                   	push   %esi
+  800363:	83 ec 04             	sub    $0x4,%esp
+  800366:	ff 75 e4             	push   -0x1c(%ebp)
+  800369:	ff 75 e0             	push   -0x20(%ebp)
+  80036c:	ff 75 dc             	push   -0x24(%ebp)
+  80036f:	ff 75 d8             	push   -0x28(%ebp)
+  800372:	e8 bb 31 00 00       	call   803532 <__umoddi3>
+  800377:	83 c4 14             	add    $0x14,%esp
+  80037a:	0f be 80 85 37 80 00 	movsbl 0x803785(%eax),%eax
+  800381:	50                   	push   %eax
+  800382:	ff d3                	call   *%ebx
+  800384:	83 c4 10             	add    $0x10,%esp
+  800387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038a:	5b                   	pop    %ebx
+  80038b:	5e                   	pop    %esi
+  80038c:	5f                   	pop    %edi
+  80038d:	5d                   	pop    %ebp
+  80038e:	c3                   	ret
+  80038f:	83 ec 0c             	sub    $0xc,%esp
+  800392:	ff 75 18             	push   0x18(%ebp)
+  800395:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800398:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80039b:	52                   	push   %edx
+  80039c:	50                   	push   %eax
+  80039d:	83 ec 08             	sub    $0x8,%esp
+  8003a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a3:	ff 75 e0             	push   -0x20(%ebp)
+  8003a6:	ff 75 dc             	push   -0x24(%ebp)
+  8003a9:	ff 75 d8             	push   -0x28(%ebp)
+  8003ac:	e8 63 31 00 00       	call   803514 <__udivdi3>
+  8003b1:	83 c4 18             	add    $0x18,%esp
+  8003b4:	52                   	push   %edx
+  8003b5:	50                   	push   %eax
+  8003b6:	89 f2                	mov    %esi,%edx
+  8003b8:	89 d8                	mov    %ebx,%eax
+  8003ba:	e8 54 ff ff ff       	call   800313 <printnum>
+  8003bf:	83 c4 20             	add    $0x20,%esp
+  8003c2:	eb 9b                	jmp    80035f <printnum+0x4c>
+
+008003c4 <sprintputch>:
+  8003c4:	55                   	push   %ebp
+  8003c5:	89 e5                	mov    %esp,%ebp
+  8003c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003ca:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8003ce:	8b 10                	mov    (%eax),%edx
+  8003d0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d3:	73 0a                	jae    8003df <sprintputch+0x1b>
+  8003d5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d8:	89 08                	mov    %ecx,(%eax)
+  8003da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003dd:	88 02                	mov    %al,(%edx)
+  8003df:	5d                   	pop    %ebp
+  8003e0:	c3                   	ret
+
+008003e1 <printfmt>:
+  8003e1:	55                   	push   %ebp
+  8003e2:	89 e5                	mov    %esp,%ebp
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	8d 45 14             	lea    0x14(%ebp),%eax
+  8003ea:	50                   	push   %eax
+  8003eb:	ff 75 10             	push   0x10(%ebp)
+  8003ee:	ff 75 0c             	push   0xc(%ebp)
+  8003f1:	ff 75 08             	push   0x8(%ebp)
+  8003f4:	e8 05 00 00 00       	call   8003fe <vprintfmt>
+  8003f9:	83 c4 10             	add    $0x10,%esp
+  8003fc:	c9                   	leave
+  8003fd:	c3                   	ret
+
+008003fe <vprintfmt>:
+  8003fe:	55                   	push   %ebp
+  8003ff:	89 e5                	mov    %esp,%ebp
+  800401:	57                   	push   %edi
+  800402:	56                   	push   %esi
+  800403:	53                   	push   %ebx
+  800404:	83 ec 2c             	sub    $0x2c,%esp
+  800407:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80040a:	89 df                	mov    %ebx,%edi
+  80040c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800412:	8d 70 01             	lea    0x1(%eax),%esi
+  800415:	0f b6 00             	movzbl (%eax),%eax
+  800418:	83 f8 25             	cmp    $0x25,%eax
+  80041b:	74 1e                	je     80043b <vprintfmt+0x3d>
+  80041d:	85 c0                	test   %eax,%eax
+  80041f:	0f 84 15 05 00 00    	je     80093a <vprintfmt+0x53c>
+  800425:	83 ec 08             	sub    $0x8,%esp
+  800428:	53                   	push   %ebx
+  800429:	50                   	push   %eax
+  80042a:	ff d7                	call   *%edi
+  80042c:	83 c6 01             	add    $0x1,%esi
+  80042f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800433:	83 c4 10             	add    $0x10,%esp
+  800436:	83 f8 25             	cmp    $0x25,%eax
+  800439:	75 e2                	jne    80041d <vprintfmt+0x1f>
+  80043b:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80043f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800446:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80044d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800454:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800459:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80045c:	8d 56 01             	lea    0x1(%esi),%edx
+  80045f:	0f b6 0e             	movzbl (%esi),%ecx
+  800462:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800465:	3c 55                	cmp    $0x55,%al
+  800467:	0f 87 3b 04 00 00    	ja     8008a8 <vprintfmt+0x4aa>
+  80046d:	0f b6 c0             	movzbl %al,%eax
+  800470:	ff 24 85 c0 38 80 00 	jmp    *0x8038c0(,%eax,4)
+  800477:	89 75 10             	mov    %esi,0x10(%ebp)
+  80047a:	eb 93                	jmp    80040f <vprintfmt+0x11>
+  80047c:	89 d6                	mov    %edx,%esi
+  80047e:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800482:	eb d8                	jmp    80045c <vprintfmt+0x5e>
+  800484:	89 d6                	mov    %edx,%esi
+  800486:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80048a:	eb d0                	jmp    80045c <vprintfmt+0x5e>
+  80048c:	0f b6 c9             	movzbl %cl,%ecx
+  80048f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800492:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800495:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800499:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80049c:	83 f9 09             	cmp    $0x9,%ecx
+  80049f:	77 6f                	ja     800510 <vprintfmt+0x112>
+  8004a1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8004a4:	83 c2 01             	add    $0x1,%edx
+  8004a7:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004aa:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8004ae:	0f be 02             	movsbl (%edx),%eax
+  8004b1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004b4:	83 fe 09             	cmp    $0x9,%esi
+  8004b7:	76 eb                	jbe    8004a4 <vprintfmt+0xa6>
+  8004b9:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8004bc:	89 d6                	mov    %edx,%esi
+  8004be:	eb 13                	jmp    8004d3 <vprintfmt+0xd5>
+  8004c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c3:	8b 00                	mov    (%eax),%eax
+  8004c5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8004ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d1:	89 d6                	mov    %edx,%esi
+  8004d3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004d7:	79 83                	jns    80045c <vprintfmt+0x5e>
+  8004d9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004df:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004e6:	e9 71 ff ff ff       	jmp    80045c <vprintfmt+0x5e>
+  8004eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ee:	85 c9                	test   %ecx,%ecx
+  8004f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f5:	0f 49 c1             	cmovns %ecx,%eax
+  8004f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004fb:	89 d6                	mov    %edx,%esi
+  8004fd:	e9 5a ff ff ff       	jmp    80045c <vprintfmt+0x5e>
+  800502:	89 d6                	mov    %edx,%esi
+  800504:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80050b:	e9 4c ff ff ff       	jmp    80045c <vprintfmt+0x5e>
+  800510:	89 d6                	mov    %edx,%esi
+  800512:	eb bf                	jmp    8004d3 <vprintfmt+0xd5>
+  800514:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800518:	89 d6                	mov    %edx,%esi
+  80051a:	e9 3d ff ff ff       	jmp    80045c <vprintfmt+0x5e>
+  80051f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800522:	8b 45 14             	mov    0x14(%ebp),%eax
+  800525:	8d 70 04             	lea    0x4(%eax),%esi
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	53                   	push   %ebx
+  80052c:	ff 30                	push   (%eax)
+  80052e:	ff d7                	call   *%edi
+  800530:	83 c4 10             	add    $0x10,%esp
+  800533:	89 75 14             	mov    %esi,0x14(%ebp)
+  800536:	e9 d4 fe ff ff       	jmp    80040f <vprintfmt+0x11>
+  80053b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8d 70 04             	lea    0x4(%eax),%esi
+  800544:	8b 10                	mov    (%eax),%edx
+  800546:	89 d0                	mov    %edx,%eax
+  800548:	f7 d8                	neg    %eax
+  80054a:	0f 48 c2             	cmovs  %edx,%eax
+  80054d:	83 f8 12             	cmp    $0x12,%eax
+  800550:	7f 23                	jg     800575 <vprintfmt+0x177>
+  800552:	8b 14 85 20 3a 80 00 	mov    0x803a20(,%eax,4),%edx
+  800559:	85 d2                	test   %edx,%edx
+  80055b:	74 18                	je     800575 <vprintfmt+0x177>
+  80055d:	52                   	push   %edx
+  80055e:	68 7b 3b 80 00       	push   $0x803b7b
+  800563:	53                   	push   %ebx
+  800564:	57                   	push   %edi
+  800565:	e8 77 fe ff ff       	call   8003e1 <printfmt>
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	89 75 14             	mov    %esi,0x14(%ebp)
+  800570:	e9 9a fe ff ff       	jmp    80040f <vprintfmt+0x11>
+  800575:	50                   	push   %eax
+  800576:	68 9d 37 80 00       	push   $0x80379d
+  80057b:	53                   	push   %ebx
+  80057c:	57                   	push   %edi
+  80057d:	e8 5f fe ff ff       	call   8003e1 <printfmt>
+  800582:	83 c4 10             	add    $0x10,%esp
+  800585:	89 75 14             	mov    %esi,0x14(%ebp)
+  800588:	e9 82 fe ff ff       	jmp    80040f <vprintfmt+0x11>
+  80058d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800590:	8b 45 14             	mov    0x14(%ebp),%eax
+  800593:	83 c0 04             	add    $0x4,%eax
+  800596:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8b 00                	mov    (%eax),%eax
+  80059e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005a1:	85 c0                	test   %eax,%eax
+  8005a3:	0f 84 61 03 00 00    	je     80090a <vprintfmt+0x50c>
+  8005a9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005ad:	7e 06                	jle    8005b5 <vprintfmt+0x1b7>
+  8005af:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005b3:	75 29                	jne    8005de <vprintfmt+0x1e0>
+  8005b5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005b8:	8d 70 01             	lea    0x1(%eax),%esi
+  8005bb:	0f b6 00             	movzbl (%eax),%eax
+  8005be:	0f be d0             	movsbl %al,%edx
+  8005c1:	85 d2                	test   %edx,%edx
+  8005c3:	0f 84 bb 00 00 00    	je     800684 <vprintfmt+0x286>
+  8005c9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005cc:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005cf:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005d2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005d5:	eb 7a                	jmp    800651 <vprintfmt+0x253>
+  8005d7:	c7 45 d0 96 37 80 00 	movl   $0x803796,-0x30(%ebp)
+  8005de:	83 ec 08             	sub    $0x8,%esp
+  8005e1:	ff 75 d4             	push   -0x2c(%ebp)
+  8005e4:	ff 75 d0             	push   -0x30(%ebp)
+  8005e7:	e8 e0 03 00 00       	call   8009cc <strnlen>
+  8005ec:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005f2:	83 c4 10             	add    $0x10,%esp
+  8005f5:	85 d2                	test   %edx,%edx
+  8005f7:	0f 8e d6 02 00 00    	jle    8008d3 <vprintfmt+0x4d5>
+  8005fd:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800601:	83 ec 08             	sub    $0x8,%esp
+  800604:	53                   	push   %ebx
+  800605:	56                   	push   %esi
+  800606:	ff d7                	call   *%edi
+  800608:	83 c4 10             	add    $0x10,%esp
+  80060b:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80060f:	75 f0                	jne    800601 <vprintfmt+0x203>
+  800611:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800614:	8d 70 01             	lea    0x1(%eax),%esi
+  800617:	0f b6 00             	movzbl (%eax),%eax
+  80061a:	0f be d0             	movsbl %al,%edx
+  80061d:	85 d2                	test   %edx,%edx
+  80061f:	0f 84 da 02 00 00    	je     8008ff <vprintfmt+0x501>
+  800625:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800628:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80062b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80062e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800631:	eb 1e                	jmp    800651 <vprintfmt+0x253>
+  800633:	83 ec 08             	sub    $0x8,%esp
+  800636:	ff 75 0c             	push   0xc(%ebp)
+  800639:	52                   	push   %edx
+  80063a:	ff 55 08             	call   *0x8(%ebp)
+  80063d:	83 c4 10             	add    $0x10,%esp
+  800640:	83 eb 01             	sub    $0x1,%ebx
+  800643:	83 c6 01             	add    $0x1,%esi
+  800646:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80064a:	0f be d0             	movsbl %al,%edx
+  80064d:	85 d2                	test   %edx,%edx
+  80064f:	74 2a                	je     80067b <vprintfmt+0x27d>
+  800651:	85 ff                	test   %edi,%edi
+  800653:	78 05                	js     80065a <vprintfmt+0x25c>
+  800655:	83 ef 01             	sub    $0x1,%edi
+  800658:	78 59                	js     8006b3 <vprintfmt+0x2b5>
+  80065a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80065e:	74 d3                	je     800633 <vprintfmt+0x235>
+  800660:	0f be c0             	movsbl %al,%eax
+  800663:	83 e8 20             	sub    $0x20,%eax
+  800666:	83 f8 5e             	cmp    $0x5e,%eax
+  800669:	76 c8                	jbe    800633 <vprintfmt+0x235>
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	ff 75 0c             	push   0xc(%ebp)
+  800671:	6a 3f                	push   $0x3f
+  800673:	ff 55 08             	call   *0x8(%ebp)
+  800676:	83 c4 10             	add    $0x10,%esp
+  800679:	eb c5                	jmp    800640 <vprintfmt+0x242>
+  80067b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80067e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800681:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800684:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800687:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80068b:	7e 1b                	jle    8006a8 <vprintfmt+0x2aa>
+  80068d:	83 ec 08             	sub    $0x8,%esp
+  800690:	53                   	push   %ebx
+  800691:	6a 20                	push   $0x20
+  800693:	ff d7                	call   *%edi
+  800695:	83 c4 10             	add    $0x10,%esp
+  800698:	83 ee 01             	sub    $0x1,%esi
+  80069b:	75 f0                	jne    80068d <vprintfmt+0x28f>
+  80069d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a3:	e9 67 fd ff ff       	jmp    80040f <vprintfmt+0x11>
+  8006a8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ae:	e9 5c fd ff ff       	jmp    80040f <vprintfmt+0x11>
+  8006b3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006bc:	eb c6                	jmp    800684 <vprintfmt+0x286>
+  8006be:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006c1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006c4:	83 f9 01             	cmp    $0x1,%ecx
+  8006c7:	7f 1f                	jg     8006e8 <vprintfmt+0x2ea>
+  8006c9:	85 c9                	test   %ecx,%ecx
+  8006cb:	74 67                	je     800734 <vprintfmt+0x336>
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 30                	mov    (%eax),%esi
+  8006d2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006d5:	89 f0                	mov    %esi,%eax
+  8006d7:	c1 f8 1f             	sar    $0x1f,%eax
+  8006da:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e6:	eb 17                	jmp    8006ff <vprintfmt+0x301>
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 50 04             	mov    0x4(%eax),%edx
+  8006ee:	8b 00                	mov    (%eax),%eax
+  8006f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ff:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800702:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800705:	be 0a 00 00 00       	mov    $0xa,%esi
+  80070a:	85 c9                	test   %ecx,%ecx
+  80070c:	0f 89 12 01 00 00    	jns    800824 <vprintfmt+0x426>
+  800712:	83 ec 08             	sub    $0x8,%esp
+  800715:	53                   	push   %ebx
+  800716:	6a 2d                	push   $0x2d
+  800718:	ff d7                	call   *%edi
+  80071a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80071d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800720:	f7 da                	neg    %edx
+  800722:	83 d1 00             	adc    $0x0,%ecx
+  800725:	f7 d9                	neg    %ecx
+  800727:	83 c4 10             	add    $0x10,%esp
+  80072a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80072f:	e9 f0 00 00 00       	jmp    800824 <vprintfmt+0x426>
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 30                	mov    (%eax),%esi
+  800739:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80073c:	89 f0                	mov    %esi,%eax
+  80073e:	c1 f8 1f             	sar    $0x1f,%eax
+  800741:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8d 40 04             	lea    0x4(%eax),%eax
+  80074a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074d:	eb b0                	jmp    8006ff <vprintfmt+0x301>
+  80074f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800752:	89 55 10             	mov    %edx,0x10(%ebp)
+  800755:	83 f9 01             	cmp    $0x1,%ecx
+  800758:	7f 1e                	jg     800778 <vprintfmt+0x37a>
+  80075a:	85 c9                	test   %ecx,%ecx
+  80075c:	74 32                	je     800790 <vprintfmt+0x392>
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8b 10                	mov    (%eax),%edx
+  800763:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800768:	8d 40 04             	lea    0x4(%eax),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800773:	e9 ac 00 00 00       	jmp    800824 <vprintfmt+0x426>
+  800778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077b:	8b 10                	mov    (%eax),%edx
+  80077d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800780:	8d 40 08             	lea    0x8(%eax),%eax
+  800783:	89 45 14             	mov    %eax,0x14(%ebp)
+  800786:	be 0a 00 00 00       	mov    $0xa,%esi
+  80078b:	e9 94 00 00 00       	jmp    800824 <vprintfmt+0x426>
+  800790:	8b 45 14             	mov    0x14(%ebp),%eax
+  800793:	8b 10                	mov    (%eax),%edx
+  800795:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079a:	8d 40 04             	lea    0x4(%eax),%eax
+  80079d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a0:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007a5:	eb 7d                	jmp    800824 <vprintfmt+0x426>
+  8007a7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007aa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007ad:	83 f9 01             	cmp    $0x1,%ecx
+  8007b0:	7f 1b                	jg     8007cd <vprintfmt+0x3cf>
+  8007b2:	85 c9                	test   %ecx,%ecx
+  8007b4:	74 2c                	je     8007e2 <vprintfmt+0x3e4>
+  8007b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b9:	8b 10                	mov    (%eax),%edx
+  8007bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c6:	be 08 00 00 00       	mov    $0x8,%esi
+  8007cb:	eb 57                	jmp    800824 <vprintfmt+0x426>
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 10                	mov    (%eax),%edx
+  8007d2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007db:	be 08 00 00 00       	mov    $0x8,%esi
+  8007e0:	eb 42                	jmp    800824 <vprintfmt+0x426>
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f2:	be 08 00 00 00       	mov    $0x8,%esi
+  8007f7:	eb 2b                	jmp    800824 <vprintfmt+0x426>
+  8007f9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007fc:	83 ec 08             	sub    $0x8,%esp
+  8007ff:	53                   	push   %ebx
+  800800:	6a 30                	push   $0x30
+  800802:	ff d7                	call   *%edi
+  800804:	83 c4 08             	add    $0x8,%esp
+  800807:	53                   	push   %ebx
+  800808:	6a 78                	push   $0x78
+  80080a:	ff d7                	call   *%edi
+  80080c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080f:	8b 10                	mov    (%eax),%edx
+  800811:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800816:	83 c4 10             	add    $0x10,%esp
+  800819:	8d 40 04             	lea    0x4(%eax),%eax
+  80081c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081f:	be 10 00 00 00       	mov    $0x10,%esi
+  800824:	83 ec 0c             	sub    $0xc,%esp
+  800827:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80082b:	50                   	push   %eax
+  80082c:	ff 75 e4             	push   -0x1c(%ebp)
+  80082f:	56                   	push   %esi
+  800830:	51                   	push   %ecx
+  800831:	52                   	push   %edx
+  800832:	89 da                	mov    %ebx,%edx
+  800834:	89 f8                	mov    %edi,%eax
+  800836:	e8 d8 fa ff ff       	call   800313 <printnum>
+  80083b:	83 c4 20             	add    $0x20,%esp
+  80083e:	e9 cc fb ff ff       	jmp    80040f <vprintfmt+0x11>
+  800843:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800846:	89 55 10             	mov    %edx,0x10(%ebp)
+  800849:	83 f9 01             	cmp    $0x1,%ecx
+  80084c:	7f 1b                	jg     800869 <vprintfmt+0x46b>
+  80084e:	85 c9                	test   %ecx,%ecx
+  800850:	74 2c                	je     80087e <vprintfmt+0x480>
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	8b 10                	mov    (%eax),%edx
+  800857:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085c:	8d 40 04             	lea    0x4(%eax),%eax
+  80085f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800862:	be 10 00 00 00       	mov    $0x10,%esi
+  800867:	eb bb                	jmp    800824 <vprintfmt+0x426>
+  800869:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086c:	8b 10                	mov    (%eax),%edx
+  80086e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800871:	8d 40 08             	lea    0x8(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+  800877:	be 10 00 00 00       	mov    $0x10,%esi
+  80087c:	eb a6                	jmp    800824 <vprintfmt+0x426>
+  80087e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800881:	8b 10                	mov    (%eax),%edx
+  800883:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800888:	8d 40 04             	lea    0x4(%eax),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088e:	be 10 00 00 00       	mov    $0x10,%esi
+  800893:	eb 8f                	jmp    800824 <vprintfmt+0x426>
+  800895:	89 55 10             	mov    %edx,0x10(%ebp)
+  800898:	83 ec 08             	sub    $0x8,%esp
+  80089b:	53                   	push   %ebx
+  80089c:	6a 25                	push   $0x25
+  80089e:	ff d7                	call   *%edi
+  8008a0:	83 c4 10             	add    $0x10,%esp
+  8008a3:	e9 67 fb ff ff       	jmp    80040f <vprintfmt+0x11>
+  8008a8:	83 ec 08             	sub    $0x8,%esp
+  8008ab:	53                   	push   %ebx
+  8008ac:	6a 25                	push   $0x25
+  8008ae:	ff d7                	call   *%edi
+  8008b0:	83 c4 10             	add    $0x10,%esp
+  8008b3:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008b7:	0f 84 ba fb ff ff    	je     800477 <vprintfmt+0x79>
+  8008bd:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008c0:	89 f0                	mov    %esi,%eax
+  8008c2:	83 e8 01             	sub    $0x1,%eax
+  8008c5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008c9:	75 f7                	jne    8008c2 <vprintfmt+0x4c4>
+  8008cb:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008ce:	e9 3c fb ff ff       	jmp    80040f <vprintfmt+0x11>
+  8008d3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008d6:	8d 70 01             	lea    0x1(%eax),%esi
+  8008d9:	0f b6 00             	movzbl (%eax),%eax
+  8008dc:	0f be d0             	movsbl %al,%edx
+  8008df:	85 d2                	test   %edx,%edx
+  8008e1:	74 11                	je     8008f4 <vprintfmt+0x4f6>
+  8008e3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008e6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008e9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008ec:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008ef:	e9 5d fd ff ff       	jmp    800651 <vprintfmt+0x253>
+  8008f4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008f7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008fa:	e9 10 fb ff ff       	jmp    80040f <vprintfmt+0x11>
+  8008ff:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800902:	89 45 14             	mov    %eax,0x14(%ebp)
+  800905:	e9 05 fb ff ff       	jmp    80040f <vprintfmt+0x11>
+  80090a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80090e:	7e 0a                	jle    80091a <vprintfmt+0x51c>
+  800910:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800914:	0f 85 bd fc ff ff    	jne    8005d7 <vprintfmt+0x1d9>
+  80091a:	ba 28 00 00 00       	mov    $0x28,%edx
+  80091f:	b8 28 00 00 00       	mov    $0x28,%eax
+  800924:	be 97 37 80 00       	mov    $0x803797,%esi
+  800929:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80092c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80092f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800932:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800935:	e9 17 fd ff ff       	jmp    800651 <vprintfmt+0x253>
+  80093a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80093d:	5b                   	pop    %ebx
+  80093e:	5e                   	pop    %esi
+  80093f:	5f                   	pop    %edi
+  800940:	5d                   	pop    %ebp
+  800941:	c3                   	ret
+
+00800942 <vsnprintf>:
+  800942:	55                   	push   %ebp
+  800943:	89 e5                	mov    %esp,%ebp
+  800945:	83 ec 18             	sub    $0x18,%esp
+  800948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80094e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800951:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800955:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800958:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80095f:	85 c0                	test   %eax,%eax
+  800961:	74 26                	je     800989 <vsnprintf+0x47>
+  800963:	85 d2                	test   %edx,%edx
+  800965:	7e 22                	jle    800989 <vsnprintf+0x47>
+  800967:	ff 75 14             	push   0x14(%ebp)
+  80096a:	ff 75 10             	push   0x10(%ebp)
+  80096d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800970:	50                   	push   %eax
+  800971:	68 c4 03 80 00       	push   $0x8003c4
+  800976:	e8 83 fa ff ff       	call   8003fe <vprintfmt>
+  80097b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80097e:	c6 00 00             	movb   $0x0,(%eax)
+  800981:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800984:	83 c4 10             	add    $0x10,%esp
+  800987:	c9                   	leave
+  800988:	c3                   	ret
+  800989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80098e:	eb f7                	jmp    800987 <vsnprintf+0x45>
+
+00800990 <snprintf>:
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	83 ec 08             	sub    $0x8,%esp
+  800996:	8d 45 14             	lea    0x14(%ebp),%eax
+  800999:	50                   	push   %eax
+  80099a:	ff 75 10             	push   0x10(%ebp)
+  80099d:	ff 75 0c             	push   0xc(%ebp)
+  8009a0:	ff 75 08             	push   0x8(%ebp)
+  8009a3:	e8 9a ff ff ff       	call   800942 <vsnprintf>
+  8009a8:	c9                   	leave
+  8009a9:	c3                   	ret
+
+008009aa <strlen>:
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009b0:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009b3:	74 10                	je     8009c5 <strlen+0x1b>
+  8009b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ba:	83 c0 01             	add    $0x1,%eax
+  8009bd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009c1:	75 f7                	jne    8009ba <strlen+0x10>
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+  8009c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ca:	eb f7                	jmp    8009c3 <strlen+0x19>
+
+008009cc <strnlen>:
+  8009cc:	55                   	push   %ebp
+  8009cd:	89 e5                	mov    %esp,%ebp
+  8009cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d5:	85 d2                	test   %edx,%edx
+  8009d7:	74 16                	je     8009ef <strnlen+0x23>
+  8009d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009de:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009e2:	74 09                	je     8009ed <strnlen+0x21>
+  8009e4:	83 c0 01             	add    $0x1,%eax
+  8009e7:	39 d0                	cmp    %edx,%eax
+  8009e9:	75 f3                	jne    8009de <strnlen+0x12>
+  8009eb:	89 d0                	mov    %edx,%eax
+  8009ed:	5d                   	pop    %ebp
+  8009ee:	c3                   	ret
+  8009ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f4:	eb f7                	jmp    8009ed <strnlen+0x21>
+
+008009f6 <strcpy>:
+  8009f6:	55                   	push   %ebp
+  8009f7:	89 e5                	mov    %esp,%ebp
+  8009f9:	53                   	push   %ebx
+  8009fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a05:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a09:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a0c:	83 c0 01             	add    $0x1,%eax
+  800a0f:	84 d2                	test   %dl,%dl
+  800a11:	75 f2                	jne    800a05 <strcpy+0xf>
+  800a13:	89 c8                	mov    %ecx,%eax
+  800a15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+
+00800a1a <strcat>:
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	53                   	push   %ebx
+  800a1e:	83 ec 10             	sub    $0x10,%esp
+  800a21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a24:	53                   	push   %ebx
+  800a25:	e8 80 ff ff ff       	call   8009aa <strlen>
+  800a2a:	83 c4 08             	add    $0x8,%esp
+  800a2d:	ff 75 0c             	push   0xc(%ebp)
+  800a30:	01 d8                	add    %ebx,%eax
+  800a32:	50                   	push   %eax
+  800a33:	e8 be ff ff ff       	call   8009f6 <strcpy>
+  800a38:	89 d8                	mov    %ebx,%eax
+  800a3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3d:	c9                   	leave
+  800a3e:	c3                   	ret
+
+00800a3f <strncpy>:
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	56                   	push   %esi
+  800a43:	53                   	push   %ebx
+  800a44:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a4d:	85 db                	test   %ebx,%ebx
+  800a4f:	74 17                	je     800a68 <strncpy+0x29>
+  800a51:	01 f3                	add    %esi,%ebx
+  800a53:	89 f0                	mov    %esi,%eax
+  800a55:	83 c0 01             	add    $0x1,%eax
+  800a58:	0f b6 0a             	movzbl (%edx),%ecx
+  800a5b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a5e:	80 f9 01             	cmp    $0x1,%cl
+  800a61:	83 da ff             	sbb    $0xffffffff,%edx
+  800a64:	39 c3                	cmp    %eax,%ebx
+  800a66:	75 ed                	jne    800a55 <strncpy+0x16>
+  800a68:	89 f0                	mov    %esi,%eax
+  800a6a:	5b                   	pop    %ebx
+  800a6b:	5e                   	pop    %esi
+  800a6c:	5d                   	pop    %ebp
+  800a6d:	c3                   	ret
+
+00800a6e <strlcpy>:
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	56                   	push   %esi
+  800a72:	53                   	push   %ebx
+  800a73:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a7c:	89 f0                	mov    %esi,%eax
+  800a7e:	85 db                	test   %ebx,%ebx
+  800a80:	74 1e                	je     800aa0 <strlcpy+0x32>
+  800a82:	83 eb 01             	sub    $0x1,%ebx
+  800a85:	74 16                	je     800a9d <strlcpy+0x2f>
+  800a87:	01 f3                	add    %esi,%ebx
+  800a89:	0f b6 0a             	movzbl (%edx),%ecx
+  800a8c:	84 c9                	test   %cl,%cl
+  800a8e:	74 0d                	je     800a9d <strlcpy+0x2f>
+  800a90:	83 c2 01             	add    $0x1,%edx
+  800a93:	83 c0 01             	add    $0x1,%eax
+  800a96:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a99:	39 d8                	cmp    %ebx,%eax
+  800a9b:	75 ec                	jne    800a89 <strlcpy+0x1b>
+  800a9d:	c6 00 00             	movb   $0x0,(%eax)
+  800aa0:	29 f0                	sub    %esi,%eax
+  800aa2:	5b                   	pop    %ebx
+  800aa3:	5e                   	pop    %esi
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+
+00800aa6 <strcmp>:
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aaf:	0f b6 01             	movzbl (%ecx),%eax
+  800ab2:	84 c0                	test   %al,%al
+  800ab4:	74 11                	je     800ac7 <strcmp+0x21>
+  800ab6:	38 02                	cmp    %al,(%edx)
+  800ab8:	75 0d                	jne    800ac7 <strcmp+0x21>
+  800aba:	83 c1 01             	add    $0x1,%ecx
+  800abd:	83 c2 01             	add    $0x1,%edx
+  800ac0:	0f b6 01             	movzbl (%ecx),%eax
+  800ac3:	84 c0                	test   %al,%al
+  800ac5:	75 ef                	jne    800ab6 <strcmp+0x10>
+  800ac7:	0f b6 c0             	movzbl %al,%eax
+  800aca:	0f b6 12             	movzbl (%edx),%edx
+  800acd:	29 d0                	sub    %edx,%eax
+  800acf:	5d                   	pop    %ebp
+  800ad0:	c3                   	ret
+
+00800ad1 <strncmp>:
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	53                   	push   %ebx
+  800ad5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ad8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800adb:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ade:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae3:	85 d2                	test   %edx,%edx
+  800ae5:	74 2e                	je     800b15 <strncmp+0x44>
+  800ae7:	0f b6 01             	movzbl (%ecx),%eax
+  800aea:	84 c0                	test   %al,%al
+  800aec:	74 16                	je     800b04 <strncmp+0x33>
+  800aee:	3a 03                	cmp    (%ebx),%al
+  800af0:	75 12                	jne    800b04 <strncmp+0x33>
+  800af2:	83 c1 01             	add    $0x1,%ecx
+  800af5:	83 c3 01             	add    $0x1,%ebx
+  800af8:	83 ea 01             	sub    $0x1,%edx
+  800afb:	75 ea                	jne    800ae7 <strncmp+0x16>
+  800afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b02:	eb 11                	jmp    800b15 <strncmp+0x44>
+  800b04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b09:	85 d2                	test   %edx,%edx
+  800b0b:	74 08                	je     800b15 <strncmp+0x44>
+  800b0d:	0f b6 01             	movzbl (%ecx),%eax
+  800b10:	0f b6 13             	movzbl (%ebx),%edx
+  800b13:	29 d0                	sub    %edx,%eax
+  800b15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b18:	c9                   	leave
+  800b19:	c3                   	ret
+
+00800b1a <strchr>:
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b20:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b24:	0f b6 10             	movzbl (%eax),%edx
+  800b27:	84 d2                	test   %dl,%dl
+  800b29:	74 15                	je     800b40 <strchr+0x26>
+  800b2b:	38 d1                	cmp    %dl,%cl
+  800b2d:	74 0f                	je     800b3e <strchr+0x24>
+  800b2f:	83 c0 01             	add    $0x1,%eax
+  800b32:	0f b6 10             	movzbl (%eax),%edx
+  800b35:	84 d2                	test   %dl,%dl
+  800b37:	75 f2                	jne    800b2b <strchr+0x11>
+  800b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+  800b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b45:	eb f7                	jmp    800b3e <strchr+0x24>
+
+00800b47 <strfind>:
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	53                   	push   %ebx
+  800b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b51:	0f b6 18             	movzbl (%eax),%ebx
+  800b54:	38 d3                	cmp    %dl,%bl
+  800b56:	74 14                	je     800b6c <strfind+0x25>
+  800b58:	89 d1                	mov    %edx,%ecx
+  800b5a:	84 db                	test   %bl,%bl
+  800b5c:	74 0e                	je     800b6c <strfind+0x25>
+  800b5e:	83 c0 01             	add    $0x1,%eax
+  800b61:	0f b6 10             	movzbl (%eax),%edx
+  800b64:	38 ca                	cmp    %cl,%dl
+  800b66:	74 04                	je     800b6c <strfind+0x25>
+  800b68:	84 d2                	test   %dl,%dl
+  800b6a:	75 f2                	jne    800b5e <strfind+0x17>
+  800b6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b6f:	c9                   	leave
+  800b70:	c3                   	ret
+
+00800b71 <memset>:
+  800b71:	55                   	push   %ebp
+  800b72:	89 e5                	mov    %esp,%ebp
+  800b74:	57                   	push   %edi
+  800b75:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b78:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b7b:	85 c9                	test   %ecx,%ecx
+  800b7d:	74 20                	je     800b9f <memset+0x2e>
+  800b7f:	89 f8                	mov    %edi,%eax
+  800b81:	09 c8                	or     %ecx,%eax
+  800b83:	a8 03                	test   $0x3,%al
+  800b85:	75 12                	jne    800b99 <memset+0x28>
+  800b87:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b8b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800b91:	c1 e9 02             	shr    $0x2,%ecx
+  800b94:	fc                   	cld
+  800b95:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b97:	eb 06                	jmp    800b9f <memset+0x2e>
+  800b99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b9c:	fc                   	cld
+  800b9d:	f3 aa                	rep stos %al,%es:(%edi)
+  800b9f:	89 f8                	mov    %edi,%eax
+  800ba1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ba4:	c9                   	leave
+  800ba5:	c3                   	ret
+
+00800ba6 <memmove>:
+  800ba6:	55                   	push   %ebp
+  800ba7:	89 e5                	mov    %esp,%ebp
+  800ba9:	57                   	push   %edi
+  800baa:	56                   	push   %esi
+  800bab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bb1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800bb4:	39 c6                	cmp    %eax,%esi
+  800bb6:	73 32                	jae    800bea <memmove+0x44>
+  800bb8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bbb:	39 d0                	cmp    %edx,%eax
+  800bbd:	73 2b                	jae    800bea <memmove+0x44>
+  800bbf:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800bc2:	89 d6                	mov    %edx,%esi
+  800bc4:	09 fe                	or     %edi,%esi
+  800bc6:	09 ce                	or     %ecx,%esi
+  800bc8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bce:	75 0e                	jne    800bde <memmove+0x38>
+  800bd0:	83 ef 04             	sub    $0x4,%edi
+  800bd3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bd6:	c1 e9 02             	shr    $0x2,%ecx
+  800bd9:	fd                   	std
+  800bda:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bdc:	eb 09                	jmp    800be7 <memmove+0x41>
+  800bde:	83 ef 01             	sub    $0x1,%edi
+  800be1:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800be4:	fd                   	std
+  800be5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800be7:	fc                   	cld
+  800be8:	eb 1a                	jmp    800c04 <memmove+0x5e>
+  800bea:	89 f2                	mov    %esi,%edx
+  800bec:	09 c2                	or     %eax,%edx
+  800bee:	09 ca                	or     %ecx,%edx
+  800bf0:	f6 c2 03             	test   $0x3,%dl
+  800bf3:	75 0a                	jne    800bff <memmove+0x59>
+  800bf5:	c1 e9 02             	shr    $0x2,%ecx
+  800bf8:	89 c7                	mov    %eax,%edi
+  800bfa:	fc                   	cld
+  800bfb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bfd:	eb 05                	jmp    800c04 <memmove+0x5e>
+  800bff:	89 c7                	mov    %eax,%edi
+  800c01:	fc                   	cld
+  800c02:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c04:	5e                   	pop    %esi
+  800c05:	5f                   	pop    %edi
+  800c06:	5d                   	pop    %ebp
+  800c07:	c3                   	ret
+
+00800c08 <memcpy>:
+  800c08:	55                   	push   %ebp
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	83 ec 0c             	sub    $0xc,%esp
+  800c0e:	ff 75 10             	push   0x10(%ebp)
+  800c11:	ff 75 0c             	push   0xc(%ebp)
+  800c14:	ff 75 08             	push   0x8(%ebp)
+  800c17:	e8 8a ff ff ff       	call   800ba6 <memmove>
+  800c1c:	c9                   	leave
+  800c1d:	c3                   	ret
+
+00800c1e <memcmp>:
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	56                   	push   %esi
+  800c22:	53                   	push   %ebx
+  800c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c29:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c2c:	85 f6                	test   %esi,%esi
+  800c2e:	74 29                	je     800c59 <memcmp+0x3b>
+  800c30:	01 c6                	add    %eax,%esi
+  800c32:	0f b6 08             	movzbl (%eax),%ecx
+  800c35:	0f b6 1a             	movzbl (%edx),%ebx
+  800c38:	38 d9                	cmp    %bl,%cl
+  800c3a:	75 11                	jne    800c4d <memcmp+0x2f>
+  800c3c:	83 c0 01             	add    $0x1,%eax
+  800c3f:	83 c2 01             	add    $0x1,%edx
+  800c42:	39 c6                	cmp    %eax,%esi
+  800c44:	75 ec                	jne    800c32 <memcmp+0x14>
+  800c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4b:	eb 08                	jmp    800c55 <memcmp+0x37>
+  800c4d:	0f b6 c1             	movzbl %cl,%eax
+  800c50:	0f b6 db             	movzbl %bl,%ebx
+  800c53:	29 d8                	sub    %ebx,%eax
+  800c55:	5b                   	pop    %ebx
+  800c56:	5e                   	pop    %esi
+  800c57:	5d                   	pop    %ebp
+  800c58:	c3                   	ret
+  800c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5e:	eb f5                	jmp    800c55 <memcmp+0x37>
+
+00800c60 <memfind>:
+  800c60:	55                   	push   %ebp
+  800c61:	89 e5                	mov    %esp,%ebp
+  800c63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c69:	89 c2                	mov    %eax,%edx
+  800c6b:	03 55 10             	add    0x10(%ebp),%edx
+  800c6e:	39 d0                	cmp    %edx,%eax
+  800c70:	73 0d                	jae    800c7f <memfind+0x1f>
+  800c72:	38 08                	cmp    %cl,(%eax)
+  800c74:	74 0d                	je     800c83 <memfind+0x23>
+  800c76:	83 c0 01             	add    $0x1,%eax
+  800c79:	39 c2                	cmp    %eax,%edx
+  800c7b:	75 f5                	jne    800c72 <memfind+0x12>
+  800c7d:	eb 06                	jmp    800c85 <memfind+0x25>
+  800c7f:	89 c2                	mov    %eax,%edx
+  800c81:	eb 02                	jmp    800c85 <memfind+0x25>
+  800c83:	89 c2                	mov    %eax,%edx
+  800c85:	89 d0                	mov    %edx,%eax
+  800c87:	5d                   	pop    %ebp
+  800c88:	c3                   	ret
+
+00800c89 <strtol>:
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	57                   	push   %edi
+  800c8d:	56                   	push   %esi
+  800c8e:	53                   	push   %ebx
+  800c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c95:	0f b6 02             	movzbl (%edx),%eax
+  800c98:	3c 20                	cmp    $0x20,%al
+  800c9a:	74 04                	je     800ca0 <strtol+0x17>
+  800c9c:	3c 09                	cmp    $0x9,%al
+  800c9e:	75 0e                	jne    800cae <strtol+0x25>
+  800ca0:	83 c2 01             	add    $0x1,%edx
+  800ca3:	0f b6 02             	movzbl (%edx),%eax
+  800ca6:	3c 20                	cmp    $0x20,%al
+  800ca8:	74 f6                	je     800ca0 <strtol+0x17>
+  800caa:	3c 09                	cmp    $0x9,%al
+  800cac:	74 f2                	je     800ca0 <strtol+0x17>
+  800cae:	3c 2b                	cmp    $0x2b,%al
+  800cb0:	74 2a                	je     800cdc <strtol+0x53>
+  800cb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cb7:	3c 2d                	cmp    $0x2d,%al
+  800cb9:	74 2b                	je     800ce6 <strtol+0x5d>
+  800cbb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cc1:	75 0f                	jne    800cd2 <strtol+0x49>
+  800cc3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cc6:	74 28                	je     800cf0 <strtol+0x67>
+  800cc8:	85 db                	test   %ebx,%ebx
+  800cca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ccf:	0f 44 d8             	cmove  %eax,%ebx
+  800cd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cda:	eb 46                	jmp    800d22 <strtol+0x99>
+  800cdc:	83 c2 01             	add    $0x1,%edx
+  800cdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ce4:	eb d5                	jmp    800cbb <strtol+0x32>
+  800ce6:	83 c2 01             	add    $0x1,%edx
+  800ce9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cee:	eb cb                	jmp    800cbb <strtol+0x32>
+  800cf0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cf4:	74 0e                	je     800d04 <strtol+0x7b>
+  800cf6:	85 db                	test   %ebx,%ebx
+  800cf8:	75 d8                	jne    800cd2 <strtol+0x49>
+  800cfa:	83 c2 01             	add    $0x1,%edx
+  800cfd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d02:	eb ce                	jmp    800cd2 <strtol+0x49>
+  800d04:	83 c2 02             	add    $0x2,%edx
+  800d07:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d0c:	eb c4                	jmp    800cd2 <strtol+0x49>
+  800d0e:	0f be c0             	movsbl %al,%eax
+  800d11:	83 e8 30             	sub    $0x30,%eax
+  800d14:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d17:	7d 3a                	jge    800d53 <strtol+0xca>
+  800d19:	83 c2 01             	add    $0x1,%edx
+  800d1c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d20:	01 c1                	add    %eax,%ecx
+  800d22:	0f b6 02             	movzbl (%edx),%eax
+  800d25:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d28:	89 f3                	mov    %esi,%ebx
+  800d2a:	80 fb 09             	cmp    $0x9,%bl
+  800d2d:	76 df                	jbe    800d0e <strtol+0x85>
+  800d2f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d32:	89 f3                	mov    %esi,%ebx
+  800d34:	80 fb 19             	cmp    $0x19,%bl
+  800d37:	77 08                	ja     800d41 <strtol+0xb8>
+  800d39:	0f be c0             	movsbl %al,%eax
+  800d3c:	83 e8 57             	sub    $0x57,%eax
+  800d3f:	eb d3                	jmp    800d14 <strtol+0x8b>
+  800d41:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d44:	89 f3                	mov    %esi,%ebx
+  800d46:	80 fb 19             	cmp    $0x19,%bl
+  800d49:	77 08                	ja     800d53 <strtol+0xca>
+  800d4b:	0f be c0             	movsbl %al,%eax
+  800d4e:	83 e8 37             	sub    $0x37,%eax
+  800d51:	eb c1                	jmp    800d14 <strtol+0x8b>
+  800d53:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d57:	74 05                	je     800d5e <strtol+0xd5>
+  800d59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d5c:	89 10                	mov    %edx,(%eax)
+  800d5e:	89 c8                	mov    %ecx,%eax
+  800d60:	f7 d8                	neg    %eax
+  800d62:	85 ff                	test   %edi,%edi
+  800d64:	0f 45 c8             	cmovne %eax,%ecx
+  800d67:	89 c8                	mov    %ecx,%eax
+  800d69:	5b                   	pop    %ebx
+  800d6a:	5e                   	pop    %esi
+  800d6b:	5f                   	pop    %edi
+  800d6c:	5d                   	pop    %ebp
+  800d6d:	c3                   	ret
+
+00800d6e <sys_cputs>:
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+  800d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7f:	89 c3                	mov    %eax,%ebx
+  800d81:	89 c7                	mov    %eax,%edi
+  800d83:	89 c6                	mov    %eax,%esi
+  800d85:	cd 30                	int    $0x30
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+
+00800d8c <sys_cgetc>:
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	57                   	push   %edi
+  800d90:	56                   	push   %esi
+  800d91:	53                   	push   %ebx
+  800d92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d97:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d9c:	89 d1                	mov    %edx,%ecx
+  800d9e:	89 d3                	mov    %edx,%ebx
+  800da0:	89 d7                	mov    %edx,%edi
+  800da2:	89 d6                	mov    %edx,%esi
+  800da4:	cd 30                	int    $0x30
+  800da6:	5b                   	pop    %ebx
+  800da7:	5e                   	pop    %esi
+  800da8:	5f                   	pop    %edi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+
+00800dab <sys_env_destroy>:
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+  800db4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dc1:	89 cb                	mov    %ecx,%ebx
+  800dc3:	89 cf                	mov    %ecx,%edi
+  800dc5:	89 ce                	mov    %ecx,%esi
+  800dc7:	cd 30                	int    $0x30
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	7f 08                	jg     800dd5 <sys_env_destroy+0x2a>
+  800dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+  800dd5:	83 ec 0c             	sub    $0xc,%esp
+  800dd8:	50                   	push   %eax
+  800dd9:	6a 03                	push   $0x3
+  800ddb:	68 8b 3a 80 00       	push   $0x803a8b
+  800de0:	6a 24                	push   $0x24
+  800de2:	68 a8 3a 80 00       	push   $0x803aa8
+  800de7:	e8 37 20 00 00       	call   802e23 <_panic>
+
+00800dec <sys_getenvid>:
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  800df2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dfc:	89 d1                	mov    %edx,%ecx
+  800dfe:	89 d3                	mov    %edx,%ebx
+  800e00:	89 d7                	mov    %edx,%edi
+  800e02:	89 d6                	mov    %edx,%esi
+  800e04:	cd 30                	int    $0x30
+  800e06:	5b                   	pop    %ebx
+  800e07:	5e                   	pop    %esi
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+
+00800e0b <sys_yield>:
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	57                   	push   %edi
+  800e0f:	56                   	push   %esi
+  800e10:	53                   	push   %ebx
+  800e11:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e18:	74 26                	je     800e40 <sys_yield+0x35>
+  800e1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e24:	89 d1                	mov    %edx,%ecx
+  800e26:	89 d3                	mov    %edx,%ebx
+  800e28:	89 d7                	mov    %edx,%edi
+  800e2a:	6a 00                	push   $0x0
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	8d 35 37 0e 80 00    	lea    0x800e37,%esi
+  800e35:	0f 34                	sysenter
+  800e37:	5d                   	pop    %ebp
+  800e38:	83 c4 04             	add    $0x4,%esp
+  800e3b:	5b                   	pop    %ebx
+  800e3c:	5e                   	pop    %esi
+  800e3d:	5f                   	pop    %edi
+  800e3e:	5d                   	pop    %ebp
+  800e3f:	c3                   	ret
+  800e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e45:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e4a:	89 d1                	mov    %edx,%ecx
+  800e4c:	89 d3                	mov    %edx,%ebx
+  800e4e:	89 d7                	mov    %edx,%edi
+  800e50:	89 d6                	mov    %edx,%esi
+  800e52:	cd 30                	int    $0x30
+  800e54:	eb e5                	jmp    800e3b <sys_yield+0x30>
+
+00800e56 <sys_page_alloc>:
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	57                   	push   %edi
+  800e5a:	56                   	push   %esi
+  800e5b:	53                   	push   %ebx
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e72:	89 f7                	mov    %esi,%edi
+  800e74:	cd 30                	int    $0x30
+  800e76:	85 c0                	test   %eax,%eax
+  800e78:	7f 08                	jg     800e82 <sys_page_alloc+0x2c>
+  800e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+  800e85:	50                   	push   %eax
+  800e86:	6a 04                	push   $0x4
+  800e88:	68 8b 3a 80 00       	push   $0x803a8b
+  800e8d:	6a 24                	push   $0x24
+  800e8f:	68 a8 3a 80 00       	push   $0x803aa8
+  800e94:	e8 8a 1f 00 00       	call   802e23 <_panic>
+
+00800e99 <sys_page_map>:
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	57                   	push   %edi
+  800e9d:	56                   	push   %esi
+  800e9e:	53                   	push   %ebx
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ea9:	74 33                	je     800ede <sys_page_map+0x45>
+  800eab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eb6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ebc:	ff 75 18             	push   0x18(%ebp)
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	8d 35 ca 0e 80 00    	lea    0x800eca,%esi
+  800ec8:	0f 34                	sysenter
+  800eca:	5d                   	pop    %ebp
+  800ecb:	83 c4 04             	add    $0x4,%esp
+  800ece:	89 c2                	mov    %eax,%edx
+  800ed0:	85 c0                	test   %eax,%eax
+  800ed2:	7f 3d                	jg     800f11 <sys_page_map+0x78>
+  800ed4:	89 d0                	mov    %edx,%eax
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+  800ede:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eef:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ef2:	cd 30                	int    $0x30
+  800ef4:	89 c2                	mov    %eax,%edx
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	7e da                	jle    800ed4 <sys_page_map+0x3b>
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	50                   	push   %eax
+  800efe:	6a 05                	push   $0x5
+  800f00:	68 8b 3a 80 00       	push   $0x803a8b
+  800f05:	6a 24                	push   $0x24
+  800f07:	68 a8 3a 80 00       	push   $0x803aa8
+  800f0c:	e8 12 1f 00 00       	call   802e23 <_panic>
+  800f11:	83 ec 0c             	sub    $0xc,%esp
+  800f14:	50                   	push   %eax
+  800f15:	6a 05                	push   $0x5
+  800f17:	68 8b 3a 80 00       	push   $0x803a8b
+  800f1c:	6a 48                	push   $0x48
+  800f1e:	68 a8 3a 80 00       	push   $0x803aa8
+  800f23:	e8 fb 1e 00 00       	call   802e23 <_panic>
+
+00800f28 <sys_page_unmap>:
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	56                   	push   %esi
+  800f2d:	53                   	push   %ebx
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  800f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f41:	89 df                	mov    %ebx,%edi
+  800f43:	89 de                	mov    %ebx,%esi
+  800f45:	cd 30                	int    $0x30
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 08                	jg     800f53 <sys_page_unmap+0x2b>
+  800f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+  800f53:	83 ec 0c             	sub    $0xc,%esp
+  800f56:	50                   	push   %eax
+  800f57:	6a 06                	push   $0x6
+  800f59:	68 8b 3a 80 00       	push   $0x803a8b
+  800f5e:	6a 24                	push   $0x24
+  800f60:	68 a8 3a 80 00       	push   $0x803aa8
+  800f65:	e8 b9 1e 00 00       	call   802e23 <_panic>
+
+00800f6a <sys_fork>:
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+  800f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f75:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f7a:	89 d1                	mov    %edx,%ecx
+  800f7c:	89 d3                	mov    %edx,%ebx
+  800f7e:	89 d7                	mov    %edx,%edi
+  800f80:	89 d6                	mov    %edx,%esi
+  800f82:	cd 30                	int    $0x30
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+
+00800f89 <sys_env_set_status>:
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	57                   	push   %edi
+  800f8d:	56                   	push   %esi
+  800f8e:	53                   	push   %ebx
+  800f8f:	83 ec 0c             	sub    $0xc,%esp
+  800f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fa2:	89 df                	mov    %ebx,%edi
+  800fa4:	89 de                	mov    %ebx,%esi
+  800fa6:	cd 30                	int    $0x30
+  800fa8:	85 c0                	test   %eax,%eax
+  800faa:	7f 08                	jg     800fb4 <sys_env_set_status+0x2b>
+  800fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	50                   	push   %eax
+  800fb8:	6a 08                	push   $0x8
+  800fba:	68 8b 3a 80 00       	push   $0x803a8b
+  800fbf:	6a 24                	push   $0x24
+  800fc1:	68 a8 3a 80 00       	push   $0x803aa8
+  800fc6:	e8 58 1e 00 00       	call   802e23 <_panic>
+
+00800fcb <sys_env_set_trapframe>:
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	89 de                	mov    %ebx,%esi
+  800fe8:	cd 30                	int    $0x30
+  800fea:	85 c0                	test   %eax,%eax
+  800fec:	7f 08                	jg     800ff6 <sys_env_set_trapframe+0x2b>
+  800fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+  800ff6:	83 ec 0c             	sub    $0xc,%esp
+  800ff9:	50                   	push   %eax
+  800ffa:	6a 09                	push   $0x9
+  800ffc:	68 8b 3a 80 00       	push   $0x803a8b
+  801001:	6a 24                	push   $0x24
+  801003:	68 a8 3a 80 00       	push   $0x803aa8
+  801008:	e8 16 1e 00 00       	call   802e23 <_panic>
+
+0080100d <sys_env_set_cow>:
+  80100d:	55                   	push   %ebp
+  80100e:	89 e5                	mov    %esp,%ebp
+  801010:	57                   	push   %edi
+  801011:	56                   	push   %esi
+  801012:	53                   	push   %ebx
+  801013:	83 ec 0c             	sub    $0xc,%esp
+  801016:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801021:	b8 20 00 00 00       	mov    $0x20,%eax
+  801026:	89 df                	mov    %ebx,%edi
+  801028:	89 de                	mov    %ebx,%esi
+  80102a:	cd 30                	int    $0x30
+  80102c:	85 c0                	test   %eax,%eax
+  80102e:	7f 08                	jg     801038 <sys_env_set_cow+0x2b>
+  801030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	50                   	push   %eax
+  80103c:	6a 20                	push   $0x20
+  80103e:	68 8b 3a 80 00       	push   $0x803a8b
+  801043:	6a 24                	push   $0x24
+  801045:	68 a8 3a 80 00       	push   $0x803aa8
+  80104a:	e8 d4 1d 00 00       	call   802e23 <_panic>
+
+0080104f <sys_env_service>:
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+  801055:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80105a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105d:	b8 21 00 00 00       	mov    $0x21,%eax
+  801062:	89 cb                	mov    %ecx,%ebx
+  801064:	89 cf                	mov    %ecx,%edi
+  801066:	89 ce                	mov    %ecx,%esi
+  801068:	cd 30                	int    $0x30
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+
+0080106f <sys_env_set_pgfault_upcall>:
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 0c             	sub    $0xc,%esp
+  801078:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801080:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801083:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801088:	89 df                	mov    %ebx,%edi
+  80108a:	89 de                	mov    %ebx,%esi
+  80108c:	cd 30                	int    $0x30
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	7f 08                	jg     80109a <sys_env_set_pgfault_upcall+0x2b>
+  801092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801095:	5b                   	pop    %ebx
+  801096:	5e                   	pop    %esi
+  801097:	5f                   	pop    %edi
+  801098:	5d                   	pop    %ebp
+  801099:	c3                   	ret
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+  80109d:	50                   	push   %eax
+  80109e:	6a 0a                	push   $0xa
+  8010a0:	68 8b 3a 80 00       	push   $0x803a8b
+  8010a5:	6a 24                	push   $0x24
+  8010a7:	68 a8 3a 80 00       	push   $0x803aa8
+  8010ac:	e8 72 1d 00 00       	call   802e23 <_panic>
+
+008010b1 <sys_ipc_try_send>:
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010be:	74 27                	je     8010e7 <sys_ipc_try_send+0x36>
+  8010c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010d1:	6a 00                	push   $0x0
+  8010d3:	55                   	push   %ebp
+  8010d4:	89 e5                	mov    %esp,%ebp
+  8010d6:	8d 35 de 10 80 00    	lea    0x8010de,%esi
+  8010dc:	0f 34                	sysenter
+  8010de:	5d                   	pop    %ebp
+  8010df:	83 c4 04             	add    $0x4,%esp
+  8010e2:	5b                   	pop    %ebx
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5f                   	pop    %edi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+  8010e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fd:	cd 30                	int    $0x30
+  8010ff:	eb e1                	jmp    8010e2 <sys_ipc_try_send+0x31>
+
+00801101 <sys_ipc_recv>:
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801111:	74 32                	je     801145 <sys_ipc_recv+0x44>
+  801113:	8b 55 08             	mov    0x8(%ebp),%edx
+  801116:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801120:	89 cb                	mov    %ecx,%ebx
+  801122:	89 cf                	mov    %ecx,%edi
+  801124:	6a 00                	push   $0x0
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	8d 35 31 11 80 00    	lea    0x801131,%esi
+  80112f:	0f 34                	sysenter
+  801131:	5d                   	pop    %ebp
+  801132:	83 c4 04             	add    $0x4,%esp
+  801135:	89 c2                	mov    %eax,%edx
+  801137:	85 c0                	test   %eax,%eax
+  801139:	7f 3c                	jg     801177 <sys_ipc_recv+0x76>
+  80113b:	89 d0                	mov    %edx,%eax
+  80113d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+  801145:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80114a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80114f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801152:	89 cb                	mov    %ecx,%ebx
+  801154:	89 cf                	mov    %ecx,%edi
+  801156:	89 ce                	mov    %ecx,%esi
+  801158:	cd 30                	int    $0x30
+  80115a:	89 c2                	mov    %eax,%edx
+  80115c:	85 c0                	test   %eax,%eax
+  80115e:	7e db                	jle    80113b <sys_ipc_recv+0x3a>
+  801160:	83 ec 0c             	sub    $0xc,%esp
+  801163:	50                   	push   %eax
+  801164:	6a 0d                	push   $0xd
+  801166:	68 8b 3a 80 00       	push   $0x803a8b
+  80116b:	6a 24                	push   $0x24
+  80116d:	68 a8 3a 80 00       	push   $0x803aa8
+  801172:	e8 ac 1c 00 00       	call   802e23 <_panic>
+  801177:	83 ec 0c             	sub    $0xc,%esp
+  80117a:	50                   	push   %eax
+  80117b:	6a 0d                	push   $0xd
+  80117d:	68 8b 3a 80 00       	push   $0x803a8b
+  801182:	6a 48                	push   $0x48
+  801184:	68 a8 3a 80 00       	push   $0x803aa8
+  801189:	e8 95 1c 00 00       	call   802e23 <_panic>
+
+0080118e <sys_ipc_send>:
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+  801194:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80119b:	74 27                	je     8011c4 <sys_ipc_send+0x36>
+  80119d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ae:	6a 00                	push   $0x0
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	8d 35 bb 11 80 00    	lea    0x8011bb,%esi
+  8011b9:	0f 34                	sysenter
+  8011bb:	5d                   	pop    %ebp
+  8011bc:	83 c4 04             	add    $0x4,%esp
+  8011bf:	5b                   	pop    %ebx
+  8011c0:	5e                   	pop    %esi
+  8011c1:	5f                   	pop    %edi
+  8011c2:	5d                   	pop    %ebp
+  8011c3:	c3                   	ret
+  8011c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011da:	cd 30                	int    $0x30
+  8011dc:	eb e1                	jmp    8011bf <sys_ipc_send+0x31>
+
+008011de <sys_ipc_call>:
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011f8:	cd 30                	int    $0x30
+  8011fa:	5b                   	pop    %ebx
+  8011fb:	5e                   	pop    %esi
+  8011fc:	5f                   	pop    %edi
+  8011fd:	5d                   	pop    %ebp
+  8011fe:	c3                   	ret
+
+008011ff <sys_ipc_reply_recv>:
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	57                   	push   %edi
+  801203:	56                   	push   %esi
+  801204:	53                   	push   %ebx
+  801205:	8b 55 08             	mov    0x8(%ebp),%edx
+  801208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801210:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801213:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801216:	8b 75 18             	mov    0x18(%ebp),%esi
+  801219:	cd 30                	int    $0x30
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+
+00801220 <sys_time_msec>:
+  801220:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801225:	85 c0                	test   %eax,%eax
+  801227:	75 06                	jne    80122f <sys_time_msec+0xf>
+  801229:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80122e:	c3                   	ret
+  80122f:	55                   	push   %ebp
+  801230:	89 e5                	mov    %esp,%ebp
+  801232:	57                   	push   %edi
+  801233:	56                   	push   %esi
+  801234:	53                   	push   %ebx
+  801235:	83 ec 0c             	sub    $0xc,%esp
+  801238:	0f 31                	rdtsc
+  80123a:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801240:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801246:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80124c:	29 c8                	sub    %ecx,%eax
+  80124e:	19 da                	sbb    %ebx,%edx
+  801250:	bf 00 00 00 00       	mov    $0x0,%edi
+  801255:	57                   	push   %edi
+  801256:	56                   	push   %esi
+  801257:	52                   	push   %edx
+  801258:	50                   	push   %eax
+  801259:	e8 b6 22 00 00       	call   803514 <__udivdi3>
+  80125e:	83 c4 10             	add    $0x10,%esp
+  801261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+
+00801269 <sys_env_swap>:
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  80126c:	57                   	push   %edi
+  80126d:	56                   	push   %esi
+  80126e:	53                   	push   %ebx
+  80126f:	83 ec 0c             	sub    $0xc,%esp
+  801272:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80127f:	89 cb                	mov    %ecx,%ebx
+  801281:	89 cf                	mov    %ecx,%edi
+  801283:	89 ce                	mov    %ecx,%esi
+  801285:	cd 30                	int    $0x30
+  801287:	85 c0                	test   %eax,%eax
+  801289:	7f 08                	jg     801293 <sys_env_swap+0x2a>
+  80128b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128e:	5b                   	pop    %ebx
+  80128f:	5e                   	pop    %esi
+  801290:	5f                   	pop    %edi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+  801293:	83 ec 0c             	sub    $0xc,%esp
+  801296:	50                   	push   %eax
+  801297:	6a 12                	push   $0x12
+  801299:	68 8b 3a 80 00       	push   $0x803a8b
+  80129e:	6a 24                	push   $0x24
+  8012a0:	68 a8 3a 80 00       	push   $0x803aa8
+  8012a5:	e8 79 1b 00 00       	call   802e23 <_panic>
+
+008012aa <sys_net_try_send>:
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	57                   	push   %edi
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 0c             	sub    $0xc,%esp
+  8012b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012be:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012c3:	89 df                	mov    %ebx,%edi
+  8012c5:	89 de                	mov    %ebx,%esi
+  8012c7:	cd 30                	int    $0x30
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	7f 08                	jg     8012d5 <sys_net_try_send+0x2b>
+  8012cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d0:	5b                   	pop    %ebx
+  8012d1:	5e                   	pop    %esi
+  8012d2:	5f                   	pop    %edi
+  8012d3:	5d                   	pop    %ebp
+  8012d4:	c3                   	ret
+  8012d5:	83 ec 0c             	sub    $0xc,%esp
+  8012d8:	50                   	push   %eax
+  8012d9:	6a 13                	push   $0x13
+  8012db:	68 8b 3a 80 00       	push   $0x803a8b
+  8012e0:	6a 24                	push   $0x24
+  8012e2:	68 a8 3a 80 00       	push   $0x803aa8
+  8012e7:	e8 37 1b 00 00       	call   802e23 <_panic>
+
+008012ec <sys_net_try_receive>:
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	57                   	push   %edi
+  8012f0:	56                   	push   %esi
+  8012f1:	53                   	push   %ebx
+  8012f2:	83 ec 0c             	sub    $0xc,%esp
+  8012f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801300:	b8 14 00 00 00       	mov    $0x14,%eax
+  801305:	89 df                	mov    %ebx,%edi
+  801307:	89 de                	mov    %ebx,%esi
+  801309:	cd 30                	int    $0x30
+  80130b:	85 c0                	test   %eax,%eax
+  80130d:	7f 08                	jg     801317 <sys_net_try_receive+0x2b>
+  80130f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801312:	5b                   	pop    %ebx
+  801313:	5e                   	pop    %esi
+  801314:	5f                   	pop    %edi
+  801315:	5d                   	pop    %ebp
+  801316:	c3                   	ret
+  801317:	83 ec 0c             	sub    $0xc,%esp
+  80131a:	50                   	push   %eax
+  80131b:	6a 14                	push   $0x14
+  80131d:	68 8b 3a 80 00       	push   $0x803a8b
+  801322:	6a 24                	push   $0x24
+  801324:	68 a8 3a 80 00       	push   $0x803aa8
+  801329:	e8 f5 1a 00 00       	call   802e23 <_panic>
+
+0080132e <sys_net_recv_page>:
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	57                   	push   %edi
+  801332:	56                   	push   %esi
+  801333:	53                   	push   %ebx
+  801334:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801339:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133c:	b8 27 00 00 00       	mov    $0x27,%eax
+  801341:	89 cb                	mov    %ecx,%ebx
+  801343:	89 cf                	mov    %ecx,%edi
+  801345:	89 ce                	mov    %ecx,%esi
+  801347:	cd 30                	int    $0x30
+  801349:	5b                   	pop    %ebx
+  80134a:	5e                   	pop    %esi
+  80134b:	5f                   	pop    %edi
+  80134c:	5d                   	pop    %ebp
+  80134d:	c3                   	ret
+
+0080134e <sys_net_wait>:
+  80134e:	55                   	push   %ebp
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	57                   	push   %edi
+  801352:	56                   	push   %esi
+  801353:	53                   	push   %ebx
+  801354:	ba 00 00 00 00       	mov    $0x0,%edx
+  801359:	b8 26 00 00 00       	mov    $0x26,%eax
+  80135e:	89 d1                	mov    %edx,%ecx
+  801360:	89 d3                	mov    %edx,%ebx
+  801362:	89 d7                	mov    %edx,%edi
+  801364:	89 d6                	mov    %edx,%esi
+  801366:	cd 30                	int    $0x30
+  801368:	5b                   	pop    %ebx
+  801369:	5e                   	pop    %esi
+  80136a:	5f                   	pop    %edi
+  80136b:	5d                   	pop    %ebp
+  80136c:	c3                   	ret
+
+0080136d <sys_get_mac>:
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	57                   	push   %edi
+  801371:	56                   	push   %esi
+  801372:	53                   	push   %ebx
+  801373:	83 ec 0c             	sub    $0xc,%esp
+  801376:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801381:	b8 15 00 00 00       	mov    $0x15,%eax
+  801386:	89 df                	mov    %ebx,%edi
+  801388:	89 de                	mov    %ebx,%esi
+  80138a:	cd 30                	int    $0x30
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	7f 08                	jg     801398 <sys_get_mac+0x2b>
+  801390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801393:	5b                   	pop    %ebx
+  801394:	5e                   	pop    %esi
+  801395:	5f                   	pop    %edi
+  801396:	5d                   	pop    %ebp
+  801397:	c3                   	ret
+  801398:	83 ec 0c             	sub    $0xc,%esp
+  80139b:	50                   	push   %eax
+  80139c:	6a 15                	push   $0x15
+  80139e:	68 8b 3a 80 00       	push   $0x803a8b
+  8013a3:	6a 24                	push   $0x24
+  8013a5:	68 a8 3a 80 00       	push   $0x803aa8
+  8013aa:	e8 74 1a 00 00       	call   802e23 <_panic>
+
+008013af <sys_env_lease>:
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	57                   	push   %edi
+  8013b3:	56                   	push   %esi
+  8013b4:	53                   	push   %ebx
+  8013b5:	83 ec 0c             	sub    $0xc,%esp
+  8013b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013c8:	89 df                	mov    %ebx,%edi
+  8013ca:	89 de                	mov    %ebx,%esi
+  8013cc:	cd 30                	int    $0x30
+  8013ce:	85 c0                	test   %eax,%eax
+  8013d0:	7f 08                	jg     8013da <sys_env_lease+0x2b>
+  8013d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d5:	5b                   	pop    %ebx
+  8013d6:	5e                   	pop    %esi
+  8013d7:	5f                   	pop    %edi
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	c3                   	ret
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	50                   	push   %eax
+  8013de:	6a 16                	push   $0x16
+  8013e0:	68 8b 3a 80 00       	push   $0x803a8b
+  8013e5:	6a 24                	push   $0x24
+  8013e7:	68 a8 3a 80 00       	push   $0x803aa8
+  8013ec:	e8 32 1a 00 00       	call   802e23 <_panic>
+
+008013f1 <sys_copy_mem>:
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	57                   	push   %edi
+  8013f5:	56                   	push   %esi
+  8013f6:	53                   	push   %ebx
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+  8013fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801400:	b8 17 00 00 00       	mov    $0x17,%eax
+  801405:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801408:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80140b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80140e:	cd 30                	int    $0x30
+  801410:	85 c0                	test   %eax,%eax
+  801412:	7f 08                	jg     80141c <sys_copy_mem+0x2b>
+  801414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801417:	5b                   	pop    %ebx
+  801418:	5e                   	pop    %esi
+  801419:	5f                   	pop    %edi
+  80141a:	5d                   	pop    %ebp
+  80141b:	c3                   	ret
+  80141c:	83 ec 0c             	sub    $0xc,%esp
+  80141f:	50                   	push   %eax
+  801420:	6a 17                	push   $0x17
+  801422:	68 8b 3a 80 00       	push   $0x803a8b
+  801427:	6a 24                	push   $0x24
+  801429:	68 a8 3a 80 00       	push   $0x803aa8
+  80142e:	e8 f0 19 00 00       	call   802e23 <_panic>
+
+00801433 <sys_get_perms>:
+  801433:	55                   	push   %ebp
+  801434:	89 e5                	mov    %esp,%ebp
+  801436:	57                   	push   %edi
+  801437:	56                   	push   %esi
+  801438:	53                   	push   %ebx
+  801439:	83 ec 0c             	sub    $0xc,%esp
+  80143c:	be 00 00 00 00       	mov    $0x0,%esi
+  801441:	8b 55 08             	mov    0x8(%ebp),%edx
+  801444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801447:	b8 18 00 00 00       	mov    $0x18,%eax
+  80144c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80144f:	89 f7                	mov    %esi,%edi
+  801451:	cd 30                	int    $0x30
+  801453:	85 c0                	test   %eax,%eax
+  801455:	7f 08                	jg     80145f <sys_get_perms+0x2c>
+  801457:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145a:	5b                   	pop    %ebx
+  80145b:	5e                   	pop    %esi
+  80145c:	5f                   	pop    %edi
+  80145d:	5d                   	pop    %ebp
+  80145e:	c3                   	ret
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	50                   	push   %eax
+  801463:	6a 18                	push   $0x18
+  801465:	68 8b 3a 80 00       	push   $0x803a8b
+  80146a:	6a 24                	push   $0x24
+  80146c:	68 a8 3a 80 00       	push   $0x803aa8
+  801471:	e8 ad 19 00 00       	call   802e23 <_panic>
+
+00801476 <sys_env_unsuspend>:
+  801476:	55                   	push   %ebp
+  801477:	89 e5                	mov    %esp,%ebp
+  801479:	57                   	push   %edi
+  80147a:	56                   	push   %esi
+  80147b:	53                   	push   %ebx
+  80147c:	83 ec 0c             	sub    $0xc,%esp
+  80147f:	be 00 00 00 00       	mov    $0x0,%esi
+  801484:	8b 55 08             	mov    0x8(%ebp),%edx
+  801487:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80148f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801492:	89 f7                	mov    %esi,%edi
+  801494:	cd 30                	int    $0x30
+  801496:	85 c0                	test   %eax,%eax
+  801498:	7f 08                	jg     8014a2 <sys_env_unsuspend+0x2c>
+  80149a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149d:	5b                   	pop    %ebx
+  80149e:	5e                   	pop    %esi
+  80149f:	5f                   	pop    %edi
+  8014a0:	5d                   	pop    %ebp
+  8014a1:	c3                   	ret
+  8014a2:	83 ec 0c             	sub    $0xc,%esp
+  8014a5:	50                   	push   %eax
+  8014a6:	6a 19                	push   $0x19
+  8014a8:	68 8b 3a 80 00       	push   $0x803a8b
+  8014ad:	6a 24                	push   $0x24
+  8014af:	68 a8 3a 80 00       	push   $0x803aa8
+  8014b4:	e8 6a 19 00 00       	call   802e23 <_panic>
+
+008014b9 <sys_migrate>:
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	57                   	push   %edi
+  8014bd:	56                   	push   %esi
+  8014be:	53                   	push   %ebx
+  8014bf:	83 ec 0c             	sub    $0xc,%esp
+  8014c2:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8014c7:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8014cd:	76 11                	jbe    8014e0 <sys_migrate+0x27>
+  8014cf:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8014d4:	0f b6 08             	movzbl (%eax),%ecx
+  8014d7:	05 00 10 00 00       	add    $0x1000,%eax
+  8014dc:	39 d0                	cmp    %edx,%eax
+  8014de:	72 f4                	jb     8014d4 <sys_migrate+0x1b>
+  8014e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014ed:	89 cb                	mov    %ecx,%ebx
+  8014ef:	89 cf                	mov    %ecx,%edi
+  8014f1:	89 ce                	mov    %ecx,%esi
+  8014f3:	cd 30                	int    $0x30
+  8014f5:	85 c0                	test   %eax,%eax
+  8014f7:	7f 08                	jg     801501 <sys_migrate+0x48>
+  8014f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fc:	5b                   	pop    %ebx
+  8014fd:	5e                   	pop    %esi
+  8014fe:	5f                   	pop    %edi
+  8014ff:	5d                   	pop    %ebp
+  801500:	c3                   	ret
+  801501:	83 ec 0c             	sub    $0xc,%esp
+  801504:	50                   	push   %eax
+  801505:	6a 1a                	push   $0x1a
+  801507:	68 8b 3a 80 00       	push   $0x803a8b
+  80150c:	6a 24                	push   $0x24
+  80150e:	68 a8 3a 80 00       	push   $0x803aa8
+  801513:	e8 0b 19 00 00       	call   802e23 <_panic>
+
+00801518 <sys_lease_complete>:
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	57                   	push   %edi
+  80151c:	56                   	push   %esi
+  80151d:	53                   	push   %ebx
+  80151e:	83 ec 0c             	sub    $0xc,%esp
+  801521:	ba 00 00 00 00       	mov    $0x0,%edx
+  801526:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80152b:	89 d1                	mov    %edx,%ecx
+  80152d:	89 d3                	mov    %edx,%ebx
+  80152f:	89 d7                	mov    %edx,%edi
+  801531:	89 d6                	mov    %edx,%esi
+  801533:	cd 30                	int    $0x30
+  801535:	85 c0                	test   %eax,%eax
+  801537:	7f 08                	jg     801541 <sys_lease_complete+0x29>
+  801539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153c:	5b                   	pop    %ebx
+  80153d:	5e                   	pop    %esi
+  80153e:	5f                   	pop    %edi
+  80153f:	5d                   	pop    %ebp
+  801540:	c3                   	ret
+  801541:	83 ec 0c             	sub    $0xc,%esp
+  801544:	50                   	push   %eax
+  801545:	6a 1b                	push   $0x1b
+  801547:	68 8b 3a 80 00       	push   $0x803a8b
+  80154c:	6a 24                	push   $0x24
+  80154e:	68 a8 3a 80 00       	push   $0x803aa8
+  801553:	e8 cb 18 00 00       	call   802e23 <_panic>
+
+00801558 <sys_env_set_thisenv>:
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	57                   	push   %edi
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+  80155e:	83 ec 0c             	sub    $0xc,%esp
+  801561:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801566:	8b 55 08             	mov    0x8(%ebp),%edx
+  801569:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801571:	89 df                	mov    %ebx,%edi
+  801573:	89 de                	mov    %ebx,%esi
+  801575:	cd 30                	int    $0x30
+  801577:	85 c0                	test   %eax,%eax
+  801579:	7f 08                	jg     801583 <sys_env_set_thisenv+0x2b>
+  80157b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80157e:	5b                   	pop    %ebx
+  80157f:	5e                   	pop    %esi
+  801580:	5f                   	pop    %edi
+  801581:	5d                   	pop    %ebp
+  801582:	c3                   	ret
+  801583:	83 ec 0c             	sub    $0xc,%esp
+  801586:	50                   	push   %eax
+  801587:	6a 1c                	push   $0x1c
+  801589:	68 8b 3a 80 00       	push   $0x803a8b
+  80158e:	6a 24                	push   $0x24
+  801590:	68 a8 3a 80 00       	push   $0x803aa8
+  801595:	e8 89 18 00 00       	call   802e23 <_panic>
+
+0080159a <sys_env_set_sched>:
+  80159a:	55                   	push   %ebp
+  80159b:	89 e5                	mov    %esp,%ebp
+  80159d:	57                   	push   %edi
+  80159e:	56                   	push   %esi
+  80159f:	53                   	push   %ebx
+  8015a0:	83 ec 0c             	sub    $0xc,%esp
+  8015a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ae:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015b6:	89 f7                	mov    %esi,%edi
+  8015b8:	cd 30                	int    $0x30
+  8015ba:	85 c0                	test   %eax,%eax
+  8015bc:	7f 08                	jg     8015c6 <sys_env_set_sched+0x2c>
+  8015be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c1:	5b                   	pop    %ebx
+  8015c2:	5e                   	pop    %esi
+  8015c3:	5f                   	pop    %edi
+  8015c4:	5d                   	pop    %ebp
+  8015c5:	c3                   	ret
+  8015c6:	83 ec 0c             	sub    $0xc,%esp
+  8015c9:	50                   	push   %eax
+  8015ca:	6a 1d                	push   $0x1d
+  8015cc:	68 8b 3a 80 00       	push   $0x803a8b
+  8015d1:	6a 24                	push   $0x24
+  8015d3:	68 a8 3a 80 00       	push   $0x803aa8
+  8015d8:	e8 46 18 00 00       	call   802e23 <_panic>
+
+008015dd <sys_batch>:
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	57                   	push   %edi
+  8015e1:	56                   	push   %esi
+  8015e2:	53                   	push   %ebx
+  8015e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ee:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8015f3:	89 df                	mov    %ebx,%edi
+  8015f5:	89 de                	mov    %ebx,%esi
+  8015f7:	cd 30                	int    $0x30
+  8015f9:	5b                   	pop    %ebx
+  8015fa:	5e                   	pop    %esi
+  8015fb:	5f                   	pop    %edi
+  8015fc:	5d                   	pop    %ebp
+  8015fd:	c3                   	ret
+
+008015fe <sys_env_stats>:
+  8015fe:	55                   	push   %ebp
+  8015ff:	89 e5                	mov    %esp,%ebp
+  801601:	57                   	push   %edi
+  801602:	56                   	push   %esi
+  801603:	53                   	push   %ebx
+  801604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801609:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160f:	b8 23 00 00 00       	mov    $0x23,%eax
+  801614:	89 df                	mov    %ebx,%edi
+  801616:	89 de                	mov    %ebx,%esi
+  801618:	cd 30                	int    $0x30
+  80161a:	5b                   	pop    %ebx
+  80161b:	5e                   	pop    %esi
+  80161c:	5f                   	pop    %edi
+  80161d:	5d                   	pop    %ebp
+  80161e:	c3                   	ret
+
+0080161f <sys_trace>:
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	57                   	push   %edi
+  801623:	56                   	push   %esi
+  801624:	53                   	push   %ebx
+  801625:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80162a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162d:	b8 24 00 00 00       	mov    $0x24,%eax
+  801632:	89 cb                	mov    %ecx,%ebx
+  801634:	89 cf                	mov    %ecx,%edi
+  801636:	89 ce                	mov    %ecx,%esi
+  801638:	cd 30                	int    $0x30
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5f                   	pop    %edi
+  80163d:	5d                   	pop    %ebp
+  80163e:	c3                   	ret
+
+0080163f <sys_env_set_pager>:
+  80163f:	55                   	push   %ebp
+  801640:	89 e5                	mov    %esp,%ebp
+  801642:	57                   	push   %edi
+  801643:	56                   	push   %esi
+  801644:	53                   	push   %ebx
+  801645:	83 ec 0c             	sub    $0xc,%esp
+  801648:	be 00 00 00 00       	mov    $0x0,%esi
+  80164d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801650:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801653:	b8 25 00 00 00       	mov    $0x25,%eax
+  801658:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80165b:	89 f7                	mov    %esi,%edi
+  80165d:	cd 30                	int    $0x30
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	7f 08                	jg     80166b <sys_env_set_pager+0x2c>
+  801663:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801666:	5b                   	pop    %ebx
+  801667:	5e                   	pop    %esi
+  801668:	5f                   	pop    %edi
+  801669:	5d                   	pop    %ebp
+  80166a:	c3                   	ret
+  80166b:	83 ec 0c             	sub    $0xc,%esp
+  80166e:	50                   	push   %eax
+  80166f:	6a 25                	push   $0x25
+  801671:	68 8b 3a 80 00       	push   $0x803a8b
+  801676:	6a 24                	push   $0x24
+  801678:	68 a8 3a 80 00       	push   $0x803aa8
+  80167d:	e8 a1 17 00 00       	call   802e23 <_panic>
+
+00801682 <sys_pager_retire>:
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	57                   	push   %edi
+  801686:	56                   	push   %esi
+  801687:	53                   	push   %ebx
+  801688:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80168d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801690:	b8 28 00 00 00       	mov    $0x28,%eax
+  801695:	89 cb                	mov    %ecx,%ebx
+  801697:	89 cf                	mov    %ecx,%edi
+  801699:	89 ce                	mov    %ecx,%esi
+  80169b:	cd 30                	int    $0x30
+  80169d:	5b                   	pop    %ebx
+  80169e:	5e                   	pop    %esi
+  80169f:	5f                   	pop    %edi
+  8016a0:	5d                   	pop    %ebp
+  8016a1:	c3                   	ret
+
+008016a2 <sys_prof>:
+  8016a2:	55                   	push   %ebp
+  8016a3:	89 e5                	mov    %esp,%ebp
+  8016a5:	57                   	push   %edi
+  8016a6:	56                   	push   %esi
+  8016a7:	53                   	push   %ebx
+  8016a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b3:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016bb:	89 f7                	mov    %esi,%edi
+  8016bd:	cd 30                	int    $0x30
+  8016bf:	5b                   	pop    %ebx
+  8016c0:	5e                   	pop    %esi
+  8016c1:	5f                   	pop    %edi
+  8016c2:	5d                   	pop    %ebp
+  8016c3:	c3                   	ret
+
+008016c4 <fd2num>:
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ca:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016cf:	c1 e8 0c             	shr    $0xc,%eax
+  8016d2:	5d                   	pop    %ebp
+  8016d3:	c3                   	ret
+
+008016d4 <fd2data>:
+  8016d4:	55                   	push   %ebp
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016da:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016df:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016e4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8016e9:	5d                   	pop    %ebp
+  8016ea:	c3                   	ret
+
+008016eb <fd_alloc>:
+  8016eb:	55                   	push   %ebp
+  8016ec:	89 e5                	mov    %esp,%ebp
+  8016ee:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016f3:	89 c2                	mov    %eax,%edx
+  8016f5:	c1 ea 16             	shr    $0x16,%edx
+  8016f8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016ff:	f6 c2 01             	test   $0x1,%dl
+  801702:	74 29                	je     80172d <fd_alloc+0x42>
+  801704:	89 c2                	mov    %eax,%edx
+  801706:	c1 ea 0c             	shr    $0xc,%edx
+  801709:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801710:	f6 c2 01             	test   $0x1,%dl
+  801713:	74 18                	je     80172d <fd_alloc+0x42>
+  801715:	05 00 10 00 00       	add    $0x1000,%eax
+  80171a:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80171f:	75 d2                	jne    8016f3 <fd_alloc+0x8>
+  801721:	b8 00 00 00 00       	mov    $0x0,%eax
+  801726:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80172b:	eb 05                	jmp    801732 <fd_alloc+0x47>
+  80172d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801732:	8b 55 08             	mov    0x8(%ebp),%edx
+  801735:	89 02                	mov    %eax,(%edx)
+  801737:	89 c8                	mov    %ecx,%eax
+  801739:	5d                   	pop    %ebp
+  80173a:	c3                   	ret
+
+0080173b <fd_lookup>:
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801741:	83 f8 1f             	cmp    $0x1f,%eax
+  801744:	77 30                	ja     801776 <fd_lookup+0x3b>
+  801746:	c1 e0 0c             	shl    $0xc,%eax
+  801749:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  80174e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801754:	f6 c2 01             	test   $0x1,%dl
+  801757:	74 24                	je     80177d <fd_lookup+0x42>
+  801759:	89 c2                	mov    %eax,%edx
+  80175b:	c1 ea 0c             	shr    $0xc,%edx
+  80175e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801765:	f6 c2 01             	test   $0x1,%dl
+  801768:	74 1a                	je     801784 <fd_lookup+0x49>
+  80176a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80176d:	89 02                	mov    %eax,(%edx)
+  80176f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801774:	5d                   	pop    %ebp
+  801775:	c3                   	ret
+  801776:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80177b:	eb f7                	jmp    801774 <fd_lookup+0x39>
+  80177d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801782:	eb f0                	jmp    801774 <fd_lookup+0x39>
+  801784:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801789:	eb e9                	jmp    801774 <fd_lookup+0x39>
+
+0080178b <dev_lookup>:
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	53                   	push   %ebx
+  80178f:	83 ec 04             	sub    $0x4,%esp
+  801792:	8b 55 08             	mov    0x8(%ebp),%edx
+  801795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179a:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  80179f:	39 13                	cmp    %edx,(%ebx)
+  8017a1:	74 37                	je     8017da <dev_lookup+0x4f>
+  8017a3:	83 c0 01             	add    $0x1,%eax
+  8017a6:	8b 1c 85 34 3b 80 00 	mov    0x803b34(,%eax,4),%ebx
+  8017ad:	85 db                	test   %ebx,%ebx
+  8017af:	75 ee                	jne    80179f <dev_lookup+0x14>
+  8017b1:	a1 20 50 80 00       	mov    0x805020,%eax
+  8017b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8017b9:	83 ec 04             	sub    $0x4,%esp
+  8017bc:	52                   	push   %edx
+  8017bd:	50                   	push   %eax
+  8017be:	68 b8 3a 80 00       	push   $0x803ab8
+  8017c3:	e8 37 eb ff ff       	call   8002ff <cprintf>
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017d3:	89 1a                	mov    %ebx,(%edx)
+  8017d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017d8:	c9                   	leave
+  8017d9:	c3                   	ret
+  8017da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017df:	eb ef                	jmp    8017d0 <dev_lookup+0x45>
+
+008017e1 <fd_close>:
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	57                   	push   %edi
+  8017e5:	56                   	push   %esi
+  8017e6:	53                   	push   %ebx
+  8017e7:	83 ec 24             	sub    $0x24,%esp
+  8017ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017ed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8017f0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017f3:	50                   	push   %eax
+  8017f4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017fa:	c1 e8 0c             	shr    $0xc,%eax
+  8017fd:	50                   	push   %eax
+  8017fe:	e8 38 ff ff ff       	call   80173b <fd_lookup>
+  801803:	89 c3                	mov    %eax,%ebx
+  801805:	83 c4 10             	add    $0x10,%esp
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	78 05                	js     801811 <fd_close+0x30>
+  80180c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80180f:	74 0f                	je     801820 <fd_close+0x3f>
+  801811:	85 ff                	test   %edi,%edi
+  801813:	0f 44 df             	cmove  %edi,%ebx
+  801816:	89 d8                	mov    %ebx,%eax
+  801818:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80181b:	5b                   	pop    %ebx
+  80181c:	5e                   	pop    %esi
+  80181d:	5f                   	pop    %edi
+  80181e:	5d                   	pop    %ebp
+  80181f:	c3                   	ret
+  801820:	83 ec 08             	sub    $0x8,%esp
+  801823:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801826:	50                   	push   %eax
+  801827:	ff 36                	push   (%esi)
+  801829:	e8 5d ff ff ff       	call   80178b <dev_lookup>
+  80182e:	89 c3                	mov    %eax,%ebx
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	85 c0                	test   %eax,%eax
+  801835:	78 1a                	js     801851 <fd_close+0x70>
+  801837:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80183a:	8b 40 10             	mov    0x10(%eax),%eax
+  80183d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801842:	85 c0                	test   %eax,%eax
+  801844:	74 0b                	je     801851 <fd_close+0x70>
+  801846:	83 ec 0c             	sub    $0xc,%esp
+  801849:	56                   	push   %esi
+  80184a:	ff d0                	call   *%eax
+  80184c:	89 c3                	mov    %eax,%ebx
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	83 ec 08             	sub    $0x8,%esp
+  801854:	56                   	push   %esi
+  801855:	6a 00                	push   $0x0
+  801857:	e8 cc f6 ff ff       	call   800f28 <sys_page_unmap>
+  80185c:	83 c4 10             	add    $0x10,%esp
+  80185f:	eb b5                	jmp    801816 <fd_close+0x35>
+
+00801861 <close>:
+  801861:	55                   	push   %ebp
+  801862:	89 e5                	mov    %esp,%ebp
+  801864:	83 ec 20             	sub    $0x20,%esp
+  801867:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80186a:	50                   	push   %eax
+  80186b:	ff 75 08             	push   0x8(%ebp)
+  80186e:	e8 c8 fe ff ff       	call   80173b <fd_lookup>
+  801873:	83 c4 10             	add    $0x10,%esp
+  801876:	85 c0                	test   %eax,%eax
+  801878:	79 02                	jns    80187c <close+0x1b>
+  80187a:	c9                   	leave
+  80187b:	c3                   	ret
+  80187c:	83 ec 08             	sub    $0x8,%esp
+  80187f:	6a 01                	push   $0x1
+  801881:	ff 75 f4             	push   -0xc(%ebp)
+  801884:	e8 58 ff ff ff       	call   8017e1 <fd_close>
+  801889:	83 c4 10             	add    $0x10,%esp
+  80188c:	eb ec                	jmp    80187a <close+0x19>
+
+0080188e <close_all>:
+  80188e:	55                   	push   %ebp
+  80188f:	89 e5                	mov    %esp,%ebp
+  801891:	53                   	push   %ebx
+  801892:	83 ec 04             	sub    $0x4,%esp
+  801895:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189a:	83 ec 0c             	sub    $0xc,%esp
+  80189d:	53                   	push   %ebx
+  80189e:	e8 be ff ff ff       	call   801861 <close>
+  8018a3:	83 c3 01             	add    $0x1,%ebx
+  8018a6:	83 c4 10             	add    $0x10,%esp
+  8018a9:	83 fb 20             	cmp    $0x20,%ebx
+  8018ac:	75 ec                	jne    80189a <close_all+0xc>
+  8018ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b1:	c9                   	leave
+  8018b2:	c3                   	ret
+
+008018b3 <dup>:
+  8018b3:	55                   	push   %ebp
+  8018b4:	89 e5                	mov    %esp,%ebp
+  8018b6:	57                   	push   %edi
+  8018b7:	56                   	push   %esi
+  8018b8:	53                   	push   %ebx
+  8018b9:	83 ec 34             	sub    $0x34,%esp
+  8018bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018bf:	50                   	push   %eax
+  8018c0:	ff 75 08             	push   0x8(%ebp)
+  8018c3:	e8 73 fe ff ff       	call   80173b <fd_lookup>
+  8018c8:	89 c3                	mov    %eax,%ebx
+  8018ca:	83 c4 10             	add    $0x10,%esp
+  8018cd:	85 c0                	test   %eax,%eax
+  8018cf:	78 7f                	js     801950 <dup+0x9d>
+  8018d1:	83 ec 0c             	sub    $0xc,%esp
+  8018d4:	ff 75 0c             	push   0xc(%ebp)
+  8018d7:	e8 85 ff ff ff       	call   801861 <close>
+  8018dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018df:	c1 e6 0c             	shl    $0xc,%esi
+  8018e2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8018e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018eb:	89 3c 24             	mov    %edi,(%esp)
+  8018ee:	e8 e1 fd ff ff       	call   8016d4 <fd2data>
+  8018f3:	89 c3                	mov    %eax,%ebx
+  8018f5:	89 34 24             	mov    %esi,(%esp)
+  8018f8:	e8 d7 fd ff ff       	call   8016d4 <fd2data>
+  8018fd:	83 c4 10             	add    $0x10,%esp
+  801900:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801903:	89 d8                	mov    %ebx,%eax
+  801905:	c1 e8 16             	shr    $0x16,%eax
+  801908:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80190f:	a8 01                	test   $0x1,%al
+  801911:	74 11                	je     801924 <dup+0x71>
+  801913:	89 d8                	mov    %ebx,%eax
+  801915:	c1 e8 0c             	shr    $0xc,%eax
+  801918:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80191f:	f6 c2 01             	test   $0x1,%dl
+  801922:	75 36                	jne    80195a <dup+0xa7>
+  801924:	89 f8                	mov    %edi,%eax
+  801926:	c1 e8 0c             	shr    $0xc,%eax
+  801929:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801930:	83 ec 0c             	sub    $0xc,%esp
+  801933:	25 07 0e 00 00       	and    $0xe07,%eax
+  801938:	50                   	push   %eax
+  801939:	56                   	push   %esi
+  80193a:	6a 00                	push   $0x0
+  80193c:	57                   	push   %edi
+  80193d:	6a 00                	push   $0x0
+  80193f:	e8 55 f5 ff ff       	call   800e99 <sys_page_map>
+  801944:	89 c3                	mov    %eax,%ebx
+  801946:	83 c4 20             	add    $0x20,%esp
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	78 33                	js     801980 <dup+0xcd>
+  80194d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801950:	89 d8                	mov    %ebx,%eax
+  801952:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801955:	5b                   	pop    %ebx
+  801956:	5e                   	pop    %esi
+  801957:	5f                   	pop    %edi
+  801958:	5d                   	pop    %ebp
+  801959:	c3                   	ret
+  80195a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801961:	83 ec 0c             	sub    $0xc,%esp
+  801964:	25 07 0e 00 00       	and    $0xe07,%eax
+  801969:	50                   	push   %eax
+  80196a:	ff 75 d4             	push   -0x2c(%ebp)
+  80196d:	6a 00                	push   $0x0
+  80196f:	53                   	push   %ebx
+  801970:	6a 00                	push   $0x0
+  801972:	e8 22 f5 ff ff       	call   800e99 <sys_page_map>
+  801977:	89 c3                	mov    %eax,%ebx
+  801979:	83 c4 20             	add    $0x20,%esp
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	79 a4                	jns    801924 <dup+0x71>
+  801980:	83 ec 08             	sub    $0x8,%esp
+  801983:	56                   	push   %esi
+  801984:	6a 00                	push   $0x0
+  801986:	e8 9d f5 ff ff       	call   800f28 <sys_page_unmap>
+  80198b:	83 c4 08             	add    $0x8,%esp
+  80198e:	ff 75 d4             	push   -0x2c(%ebp)
+  801991:	6a 00                	push   $0x0
+  801993:	e8 90 f5 ff ff       	call   800f28 <sys_page_unmap>
+  801998:	83 c4 10             	add    $0x10,%esp
+  80199b:	eb b3                	jmp    801950 <dup+0x9d>
+
+0080199d <read>:
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	56                   	push   %esi
+  8019a1:	53                   	push   %ebx
+  8019a2:	83 ec 18             	sub    $0x18,%esp
+  8019a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019ab:	50                   	push   %eax
+  8019ac:	56                   	push   %esi
+  8019ad:	e8 89 fd ff ff       	call   80173b <fd_lookup>
+  8019b2:	83 c4 10             	add    $0x10,%esp
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	78 3c                	js     8019f5 <read+0x58>
+  8019b9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019bc:	83 ec 08             	sub    $0x8,%esp
+  8019bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c2:	50                   	push   %eax
+  8019c3:	ff 33                	push   (%ebx)
+  8019c5:	e8 c1 fd ff ff       	call   80178b <dev_lookup>
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 24                	js     8019f5 <read+0x58>
+  8019d1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019d4:	83 e0 03             	and    $0x3,%eax
+  8019d7:	83 f8 01             	cmp    $0x1,%eax
+  8019da:	74 20                	je     8019fc <read+0x5f>
+  8019dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019df:	8b 40 08             	mov    0x8(%eax),%eax
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	74 37                	je     801a1d <read+0x80>
+  8019e6:	83 ec 04             	sub    $0x4,%esp
+  8019e9:	ff 75 10             	push   0x10(%ebp)
+  8019ec:	ff 75 0c             	push   0xc(%ebp)
+  8019ef:	53                   	push   %ebx
+  8019f0:	ff d0                	call   *%eax
+  8019f2:	83 c4 10             	add    $0x10,%esp
+  8019f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f8:	5b                   	pop    %ebx
+  8019f9:	5e                   	pop    %esi
+  8019fa:	5d                   	pop    %ebp
+  8019fb:	c3                   	ret
+  8019fc:	a1 20 50 80 00       	mov    0x805020,%eax
+  801a01:	8b 40 48             	mov    0x48(%eax),%eax
+  801a04:	83 ec 04             	sub    $0x4,%esp
+  801a07:	56                   	push   %esi
+  801a08:	50                   	push   %eax
+  801a09:	68 f9 3a 80 00       	push   $0x803af9
+  801a0e:	e8 ec e8 ff ff       	call   8002ff <cprintf>
+  801a13:	83 c4 10             	add    $0x10,%esp
+  801a16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a1b:	eb d8                	jmp    8019f5 <read+0x58>
+  801a1d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a22:	eb d1                	jmp    8019f5 <read+0x58>
+
+00801a24 <readn>:
+  801a24:	55                   	push   %ebp
+  801a25:	89 e5                	mov    %esp,%ebp
+  801a27:	57                   	push   %edi
+  801a28:	56                   	push   %esi
+  801a29:	53                   	push   %ebx
+  801a2a:	83 ec 0c             	sub    $0xc,%esp
+  801a2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a30:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a33:	85 f6                	test   %esi,%esi
+  801a35:	74 30                	je     801a67 <readn+0x43>
+  801a37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a41:	83 ec 04             	sub    $0x4,%esp
+  801a44:	89 f2                	mov    %esi,%edx
+  801a46:	29 c2                	sub    %eax,%edx
+  801a48:	52                   	push   %edx
+  801a49:	01 f8                	add    %edi,%eax
+  801a4b:	50                   	push   %eax
+  801a4c:	ff 75 08             	push   0x8(%ebp)
+  801a4f:	e8 49 ff ff ff       	call   80199d <read>
+  801a54:	83 c4 10             	add    $0x10,%esp
+  801a57:	85 c0                	test   %eax,%eax
+  801a59:	78 15                	js     801a70 <readn+0x4c>
+  801a5b:	74 11                	je     801a6e <readn+0x4a>
+  801a5d:	01 c3                	add    %eax,%ebx
+  801a5f:	89 d8                	mov    %ebx,%eax
+  801a61:	39 f3                	cmp    %esi,%ebx
+  801a63:	72 dc                	jb     801a41 <readn+0x1d>
+  801a65:	eb 09                	jmp    801a70 <readn+0x4c>
+  801a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6c:	eb 02                	jmp    801a70 <readn+0x4c>
+  801a6e:	89 d8                	mov    %ebx,%eax
+  801a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a73:	5b                   	pop    %ebx
+  801a74:	5e                   	pop    %esi
+  801a75:	5f                   	pop    %edi
+  801a76:	5d                   	pop    %ebp
+  801a77:	c3                   	ret
+
+00801a78 <write>:
+  801a78:	55                   	push   %ebp
+  801a79:	89 e5                	mov    %esp,%ebp
+  801a7b:	56                   	push   %esi
+  801a7c:	53                   	push   %ebx
+  801a7d:	83 ec 18             	sub    $0x18,%esp
+  801a80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a86:	50                   	push   %eax
+  801a87:	53                   	push   %ebx
+  801a88:	e8 ae fc ff ff       	call   80173b <fd_lookup>
+  801a8d:	83 c4 10             	add    $0x10,%esp
+  801a90:	85 c0                	test   %eax,%eax
+  801a92:	78 37                	js     801acb <write+0x53>
+  801a94:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a97:	83 ec 08             	sub    $0x8,%esp
+  801a9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a9d:	50                   	push   %eax
+  801a9e:	ff 36                	push   (%esi)
+  801aa0:	e8 e6 fc ff ff       	call   80178b <dev_lookup>
+  801aa5:	83 c4 10             	add    $0x10,%esp
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	78 1f                	js     801acb <write+0x53>
+  801aac:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ab0:	74 20                	je     801ad2 <write+0x5a>
+  801ab2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ab5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	74 37                	je     801af3 <write+0x7b>
+  801abc:	83 ec 04             	sub    $0x4,%esp
+  801abf:	ff 75 10             	push   0x10(%ebp)
+  801ac2:	ff 75 0c             	push   0xc(%ebp)
+  801ac5:	56                   	push   %esi
+  801ac6:	ff d0                	call   *%eax
+  801ac8:	83 c4 10             	add    $0x10,%esp
+  801acb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ace:	5b                   	pop    %ebx
+  801acf:	5e                   	pop    %esi
+  801ad0:	5d                   	pop    %ebp
+  801ad1:	c3                   	ret
+  801ad2:	a1 20 50 80 00       	mov    0x805020,%eax
+  801ad7:	8b 40 48             	mov    0x48(%eax),%eax
+  801ada:	83 ec 04             	sub    $0x4,%esp
+  801add:	53                   	push   %ebx
+  801ade:	50                   	push   %eax
+  801adf:	68 15 3b 80 00       	push   $0x803b15
+  801ae4:	e8 16 e8 ff ff       	call   8002ff <cprintf>
+  801ae9:	83 c4 10             	add    $0x10,%esp
+  801aec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af1:	eb d8                	jmp    801acb <write+0x53>
+  801af3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801af8:	eb d1                	jmp    801acb <write+0x53>
+
+00801afa <seek>:
+  801afa:	55                   	push   %ebp
+  801afb:	89 e5                	mov    %esp,%ebp
+  801afd:	83 ec 20             	sub    $0x20,%esp
+  801b00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b03:	50                   	push   %eax
+  801b04:	ff 75 08             	push   0x8(%ebp)
+  801b07:	e8 2f fc ff ff       	call   80173b <fd_lookup>
+  801b0c:	83 c4 10             	add    $0x10,%esp
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	78 0e                	js     801b21 <seek+0x27>
+  801b13:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b19:	89 50 04             	mov    %edx,0x4(%eax)
+  801b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b21:	c9                   	leave
+  801b22:	c3                   	ret
+
+00801b23 <ftruncate>:
+  801b23:	55                   	push   %ebp
+  801b24:	89 e5                	mov    %esp,%ebp
+  801b26:	56                   	push   %esi
+  801b27:	53                   	push   %ebx
+  801b28:	83 ec 18             	sub    $0x18,%esp
+  801b2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b2e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b31:	50                   	push   %eax
+  801b32:	53                   	push   %ebx
+  801b33:	e8 03 fc ff ff       	call   80173b <fd_lookup>
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	85 c0                	test   %eax,%eax
+  801b3d:	78 34                	js     801b73 <ftruncate+0x50>
+  801b3f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b42:	83 ec 08             	sub    $0x8,%esp
+  801b45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b48:	50                   	push   %eax
+  801b49:	ff 36                	push   (%esi)
+  801b4b:	e8 3b fc ff ff       	call   80178b <dev_lookup>
+  801b50:	83 c4 10             	add    $0x10,%esp
+  801b53:	85 c0                	test   %eax,%eax
+  801b55:	78 1c                	js     801b73 <ftruncate+0x50>
+  801b57:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b5b:	74 1d                	je     801b7a <ftruncate+0x57>
+  801b5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b60:	8b 40 18             	mov    0x18(%eax),%eax
+  801b63:	85 c0                	test   %eax,%eax
+  801b65:	74 34                	je     801b9b <ftruncate+0x78>
+  801b67:	83 ec 08             	sub    $0x8,%esp
+  801b6a:	ff 75 0c             	push   0xc(%ebp)
+  801b6d:	56                   	push   %esi
+  801b6e:	ff d0                	call   *%eax
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b76:	5b                   	pop    %ebx
+  801b77:	5e                   	pop    %esi
+  801b78:	5d                   	pop    %ebp
+  801b79:	c3                   	ret
+  801b7a:	a1 20 50 80 00       	mov    0x805020,%eax
+  801b7f:	8b 40 48             	mov    0x48(%eax),%eax
+  801b82:	83 ec 04             	sub    $0x4,%esp
+  801b85:	53                   	push   %ebx
+  801b86:	50                   	push   %eax
+  801b87:	68 d8 3a 80 00       	push   $0x803ad8
+  801b8c:	e8 6e e7 ff ff       	call   8002ff <cprintf>
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b99:	eb d8                	jmp    801b73 <ftruncate+0x50>
+  801b9b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ba0:	eb d1                	jmp    801b73 <ftruncate+0x50>
+
+00801ba2 <fstat>:
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	56                   	push   %esi
+  801ba6:	53                   	push   %ebx
+  801ba7:	83 ec 18             	sub    $0x18,%esp
+  801baa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bb0:	50                   	push   %eax
+  801bb1:	ff 75 08             	push   0x8(%ebp)
+  801bb4:	e8 82 fb ff ff       	call   80173b <fd_lookup>
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 49                	js     801c09 <fstat+0x67>
+  801bc0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bc3:	83 ec 08             	sub    $0x8,%esp
+  801bc6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bc9:	50                   	push   %eax
+  801bca:	ff 36                	push   (%esi)
+  801bcc:	e8 ba fb ff ff       	call   80178b <dev_lookup>
+  801bd1:	83 c4 10             	add    $0x10,%esp
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	78 31                	js     801c09 <fstat+0x67>
+  801bd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bdb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bdf:	74 2f                	je     801c10 <fstat+0x6e>
+  801be1:	c6 03 00             	movb   $0x0,(%ebx)
+  801be4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801beb:	00 00 00 
+  801bee:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bf5:	00 00 00 
+  801bf8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801bfe:	83 ec 08             	sub    $0x8,%esp
+  801c01:	53                   	push   %ebx
+  801c02:	56                   	push   %esi
+  801c03:	ff 50 14             	call   *0x14(%eax)
+  801c06:	83 c4 10             	add    $0x10,%esp
+  801c09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c0c:	5b                   	pop    %ebx
+  801c0d:	5e                   	pop    %esi
+  801c0e:	5d                   	pop    %ebp
+  801c0f:	c3                   	ret
+  801c10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c15:	eb f2                	jmp    801c09 <fstat+0x67>
+
+00801c17 <stat>:
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	56                   	push   %esi
+  801c1b:	53                   	push   %ebx
+  801c1c:	83 ec 08             	sub    $0x8,%esp
+  801c1f:	6a 00                	push   $0x0
+  801c21:	ff 75 08             	push   0x8(%ebp)
+  801c24:	e8 31 05 00 00       	call   80215a <open>
+  801c29:	89 c3                	mov    %eax,%ebx
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	78 1b                	js     801c4d <stat+0x36>
+  801c32:	83 ec 08             	sub    $0x8,%esp
+  801c35:	ff 75 0c             	push   0xc(%ebp)
+  801c38:	50                   	push   %eax
+  801c39:	e8 64 ff ff ff       	call   801ba2 <fstat>
+  801c3e:	89 c6                	mov    %eax,%esi
+  801c40:	89 1c 24             	mov    %ebx,(%esp)
+  801c43:	e8 19 fc ff ff       	call   801861 <close>
+  801c48:	83 c4 10             	add    $0x10,%esp
+  801c4b:	89 f3                	mov    %esi,%ebx
+  801c4d:	89 d8                	mov    %ebx,%eax
+  801c4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c52:	5b                   	pop    %ebx
+  801c53:	5e                   	pop    %esi
+  801c54:	5d                   	pop    %ebp
+  801c55:	c3                   	ret
+
+00801c56 <fsipc>:
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	56                   	push   %esi
+  801c5a:	53                   	push   %ebx
+  801c5b:	89 c3                	mov    %eax,%ebx
+  801c5d:	89 d6                	mov    %edx,%esi
+  801c5f:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c66:	74 20                	je     801c88 <fsipc+0x32>
+  801c68:	83 ec 08             	sub    $0x8,%esp
+  801c6b:	6a 00                	push   $0x0
+  801c6d:	56                   	push   %esi
+  801c6e:	6a 07                	push   $0x7
+  801c70:	68 00 60 80 00       	push   $0x806000
+  801c75:	53                   	push   %ebx
+  801c76:	ff 35 08 50 80 00    	push   0x805008
+  801c7c:	e8 a0 12 00 00       	call   802f21 <ipc_call>
+  801c81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c84:	5b                   	pop    %ebx
+  801c85:	5e                   	pop    %esi
+  801c86:	5d                   	pop    %ebp
+  801c87:	c3                   	ret
+  801c88:	83 ec 0c             	sub    $0xc,%esp
+  801c8b:	6a 02                	push   $0x2
+  801c8d:	e8 2a 14 00 00       	call   8030bc <ipc_find_env>
+  801c92:	a3 08 50 80 00       	mov    %eax,0x805008
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	eb cc                	jmp    801c68 <fsipc+0x12>
+
+00801c9c <devfile_trunc>:
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ca8:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cb0:	a3 04 60 80 00       	mov    %eax,0x806004
+  801cb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cba:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cbf:	e8 92 ff ff ff       	call   801c56 <fsipc>
+  801cc4:	c9                   	leave
+  801cc5:	c3                   	ret
+
+00801cc6 <devfile_flush>:
+  801cc6:	55                   	push   %ebp
+  801cc7:	89 e5                	mov    %esp,%ebp
+  801cc9:	83 ec 08             	sub    $0x8,%esp
+  801ccc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ccf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cd2:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdc:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ce1:	e8 70 ff ff ff       	call   801c56 <fsipc>
+  801ce6:	c9                   	leave
+  801ce7:	c3                   	ret
+
+00801ce8 <devfile_stat>:
+  801ce8:	55                   	push   %ebp
+  801ce9:	89 e5                	mov    %esp,%ebp
+  801ceb:	53                   	push   %ebx
+  801cec:	83 ec 04             	sub    $0x4,%esp
+  801cef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cf5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cf8:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d02:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d07:	e8 4a ff ff ff       	call   801c56 <fsipc>
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 2c                	js     801d3c <devfile_stat+0x54>
+  801d10:	83 ec 08             	sub    $0x8,%esp
+  801d13:	68 00 60 80 00       	push   $0x806000
+  801d18:	53                   	push   %ebx
+  801d19:	e8 d8 ec ff ff       	call   8009f6 <strcpy>
+  801d1e:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d23:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801d29:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d2e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d3f:	c9                   	leave
+  801d40:	c3                   	ret
+
+00801d41 <fsring_rw>:
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	57                   	push   %edi
+  801d45:	56                   	push   %esi
+  801d46:	53                   	push   %ebx
+  801d47:	83 ec 2c             	sub    $0x2c,%esp
+  801d4a:	89 c7                	mov    %eax,%edi
+  801d4c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d4f:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801d52:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d57:	a8 01                	test   $0x1,%al
+  801d59:	74 0d                	je     801d68 <fsring_rw+0x27>
+  801d5b:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d60:	a8 01                	test   $0x1,%al
+  801d62:	0f 85 d5 00 00 00    	jne    801e3d <fsring_rw+0xfc>
+  801d68:	a1 20 50 80 00       	mov    0x805020,%eax
+  801d6d:	8b 40 48             	mov    0x48(%eax),%eax
+  801d70:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801d76:	0f 84 fc 00 00 00    	je     801e78 <fsring_rw+0x137>
+  801d7c:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801d83:	0f 84 02 01 00 00    	je     801e8b <fsring_rw+0x14a>
+  801d89:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d8e:	83 ec 04             	sub    $0x4,%esp
+  801d91:	68 07 02 00 00       	push   $0x207
+  801d96:	53                   	push   %ebx
+  801d97:	6a 00                	push   $0x0
+  801d99:	e8 b8 f0 ff ff       	call   800e56 <sys_page_alloc>
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	0f 88 f9 00 00 00    	js     801ea2 <fsring_rw+0x161>
+  801da9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801daf:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801db5:	75 d7                	jne    801d8e <fsring_rw+0x4d>
+  801db7:	6a 0e                	push   $0xe
+  801db9:	6a 0d                	push   $0xd
+  801dbb:	ff 35 08 50 80 00    	push   0x805008
+  801dc1:	68 00 00 f0 cf       	push   $0xcff00000
+  801dc6:	e8 c4 0c 00 00       	call   802a8f <ipcring_init>
+  801dcb:	83 c4 08             	add    $0x8,%esp
+  801dce:	6a 00                	push   $0x0
+  801dd0:	6a 00                	push   $0x0
+  801dd2:	68 07 02 00 00       	push   $0x207
+  801dd7:	68 00 00 f0 cf       	push   $0xcff00000
+  801ddc:	6a 0b                	push   $0xb
+  801dde:	ff 35 08 50 80 00    	push   0x805008
+  801de4:	e8 38 11 00 00       	call   802f21 <ipc_call>
+  801de9:	89 c6                	mov    %eax,%esi
+  801deb:	83 c4 20             	add    $0x20,%esp
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	0f 88 ac 00 00 00    	js     801ea2 <fsring_rw+0x161>
+  801df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dfb:	89 d9                	mov    %ebx,%ecx
+  801dfd:	83 c3 01             	add    $0x1,%ebx
+  801e00:	89 da                	mov    %ebx,%edx
+  801e02:	c1 e2 0c             	shl    $0xc,%edx
+  801e05:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801e0b:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801e11:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801e17:	83 ec 08             	sub    $0x8,%esp
+  801e1a:	6a 00                	push   $0x0
+  801e1c:	6a 00                	push   $0x0
+  801e1e:	68 07 02 00 00       	push   $0x207
+  801e23:	50                   	push   %eax
+  801e24:	6a 0c                	push   $0xc
+  801e26:	ff 35 08 50 80 00    	push   0x805008
+  801e2c:	e8 f0 10 00 00       	call   802f21 <ipc_call>
+  801e31:	83 c4 20             	add    $0x20,%esp
+  801e34:	85 c0                	test   %eax,%eax
+  801e36:	78 6a                	js     801ea2 <fsring_rw+0x161>
+  801e38:	83 fb 08             	cmp    $0x8,%ebx
+  801e3b:	75 be                	jne    801dfb <fsring_rw+0xba>
+  801e3d:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e41:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801e46:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801e4b:	0f 45 c2             	cmovne %edx,%eax
+  801e4e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e51:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e58:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e5f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e70:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801e73:	e9 4b 01 00 00       	jmp    801fc3 <fsring_rw+0x282>
+  801e78:	e8 a3 f3 ff ff       	call   801220 <sys_time_msec>
+  801e7d:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801e83:	0f 89 f3 fe ff ff    	jns    801d7c <fsring_rw+0x3b>
+  801e89:	eb 54                	jmp    801edf <fsring_rw+0x19e>
+  801e8b:	83 ec 0c             	sub    $0xc,%esp
+  801e8e:	6a 02                	push   $0x2
+  801e90:	e8 27 12 00 00       	call   8030bc <ipc_find_env>
+  801e95:	a3 08 50 80 00       	mov    %eax,0x805008
+  801e9a:	83 c4 10             	add    $0x10,%esp
+  801e9d:	e9 e7 fe ff ff       	jmp    801d89 <fsring_rw+0x48>
+  801ea2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ea7:	83 ec 08             	sub    $0x8,%esp
+  801eaa:	53                   	push   %ebx
+  801eab:	6a 00                	push   $0x0
+  801ead:	e8 76 f0 ff ff       	call   800f28 <sys_page_unmap>
+  801eb2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801eb8:	83 c4 10             	add    $0x10,%esp
+  801ebb:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ec1:	75 e4                	jne    801ea7 <fsring_rw+0x166>
+  801ec3:	e8 58 f3 ff ff       	call   801220 <sys_time_msec>
+  801ec8:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801ecd:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ed2:	a1 20 50 80 00       	mov    0x805020,%eax
+  801ed7:	8b 40 48             	mov    0x48(%eax),%eax
+  801eda:	a3 04 50 80 00       	mov    %eax,0x805004
+  801edf:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801ee6:	e9 7a 01 00 00       	jmp    802065 <fsring_rw+0x324>
+  801eeb:	8b 57 0c             	mov    0xc(%edi),%edx
+  801eee:	89 10                	mov    %edx,(%eax)
+  801ef0:	89 58 04             	mov    %ebx,0x4(%eax)
+  801ef3:	89 f2                	mov    %esi,%edx
+  801ef5:	03 57 04             	add    0x4(%edi),%edx
+  801ef8:	89 50 08             	mov    %edx,0x8(%eax)
+  801efb:	83 ec 04             	sub    $0x4,%esp
+  801efe:	53                   	push   %ebx
+  801eff:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801f02:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801f05:	52                   	push   %edx
+  801f06:	83 c0 0c             	add    $0xc,%eax
+  801f09:	50                   	push   %eax
+  801f0a:	e8 97 ec ff ff       	call   800ba6 <memmove>
+  801f0f:	83 c4 10             	add    $0x10,%esp
+  801f12:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f15:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f18:	89 08                	mov    %ecx,(%eax)
+  801f1a:	83 ec 0c             	sub    $0xc,%esp
+  801f1d:	68 00 00 f0 cf       	push   $0xcff00000
+  801f22:	e8 c6 0b 00 00       	call   802aed <ipcring_req_push>
+  801f27:	01 de                	add    %ebx,%esi
+  801f29:	83 c4 10             	add    $0x10,%esp
+  801f2c:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f2f:	73 4c                	jae    801f7d <fsring_rw+0x23c>
+  801f31:	83 ec 0c             	sub    $0xc,%esp
+  801f34:	68 00 00 f0 cf       	push   $0xcff00000
+  801f39:	e8 89 0b 00 00       	call   802ac7 <ipcring_req_slot>
+  801f3e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f41:	83 c4 10             	add    $0x10,%esp
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	74 35                	je     801f7d <fsring_rw+0x23c>
+  801f48:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f4d:	83 e0 07             	and    $0x7,%eax
+  801f50:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f55:	c1 e0 0c             	shl    $0xc,%eax
+  801f58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f5b:	29 f3                	sub    %esi,%ebx
+  801f5d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f60:	39 cb                	cmp    %ecx,%ebx
+  801f62:	0f 47 d9             	cmova  %ecx,%ebx
+  801f65:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f69:	75 80                	jne    801eeb <fsring_rw+0x1aa>
+  801f6b:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f6e:	89 10                	mov    %edx,(%eax)
+  801f70:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f73:	89 f2                	mov    %esi,%edx
+  801f75:	03 57 04             	add    0x4(%edi),%edx
+  801f78:	89 50 08             	mov    %edx,0x8(%eax)
+  801f7b:	eb 95                	jmp    801f12 <fsring_rw+0x1d1>
+  801f7d:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f85:	83 ec 0c             	sub    $0xc,%esp
+  801f88:	68 00 00 f0 cf       	push   $0xcff00000
+  801f8d:	e8 94 0b 00 00       	call   802b26 <ipcring_rsp_wait>
+  801f92:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f9c:	75 45                	jne    801fe3 <fsring_rw+0x2a2>
+  801f9e:	85 db                	test   %ebx,%ebx
+  801fa0:	79 41                	jns    801fe3 <fsring_rw+0x2a2>
+  801fa2:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801fa5:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801fac:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801fb3:	83 ec 0c             	sub    $0xc,%esp
+  801fb6:	68 00 00 f0 cf       	push   $0xcff00000
+  801fbb:	e8 cc 0b 00 00       	call   802b8c <ipcring_rsp_pop>
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801fc9:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801fce:	39 c2                	cmp    %eax,%edx
+  801fd0:	74 75                	je     802047 <fsring_rw+0x306>
+  801fd2:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801fd6:	75 a5                	jne    801f7d <fsring_rw+0x23c>
+  801fd8:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801fdb:	0f 82 50 ff ff ff    	jb     801f31 <fsring_rw+0x1f0>
+  801fe1:	eb 9a                	jmp    801f7d <fsring_rw+0x23c>
+  801fe3:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801fe7:	75 ca                	jne    801fb3 <fsring_rw+0x272>
+  801fe9:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801fed:	74 31                	je     802020 <fsring_rw+0x2df>
+  801fef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff2:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801ff5:	29 c8                	sub    %ecx,%eax
+  801ff7:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801ffa:	39 d0                	cmp    %edx,%eax
+  801ffc:	0f 47 c2             	cmova  %edx,%eax
+  801fff:	39 d8                	cmp    %ebx,%eax
+  802001:	ba 01 00 00 00       	mov    $0x1,%edx
+  802006:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80200a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80200d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802012:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802016:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802019:	01 d9                	add    %ebx,%ecx
+  80201b:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80201e:	eb 93                	jmp    801fb3 <fsring_rw+0x272>
+  802020:	83 ec 04             	sub    $0x4,%esp
+  802023:	53                   	push   %ebx
+  802024:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802027:	83 e0 07             	and    $0x7,%eax
+  80202a:	c1 e0 0c             	shl    $0xc,%eax
+  80202d:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802033:	50                   	push   %eax
+  802034:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802037:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80203a:	01 c8                	add    %ecx,%eax
+  80203c:	50                   	push   %eax
+  80203d:	e8 64 eb ff ff       	call   800ba6 <memmove>
+  802042:	83 c4 10             	add    $0x10,%esp
+  802045:	eb a8                	jmp    801fef <fsring_rw+0x2ae>
+  802047:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80204b:	75 09                	jne    802056 <fsring_rw+0x315>
+  80204d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802050:	0f 82 db fe ff ff    	jb     801f31 <fsring_rw+0x1f0>
+  802056:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802059:	01 57 04             	add    %edx,0x4(%edi)
+  80205c:	85 d2                	test   %edx,%edx
+  80205e:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802062:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802065:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206b:	5b                   	pop    %ebx
+  80206c:	5e                   	pop    %esi
+  80206d:	5f                   	pop    %edi
+  80206e:	5d                   	pop    %ebp
+  80206f:	c3                   	ret
+
+00802070 <devfile_write>:
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	57                   	push   %edi
+  802074:	56                   	push   %esi
+  802075:	53                   	push   %ebx
+  802076:	83 ec 0c             	sub    $0xc,%esp
+  802079:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80207c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80207f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802082:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802088:	76 1a                	jbe    8020a4 <devfile_write+0x34>
+  80208a:	83 ec 0c             	sub    $0xc,%esp
+  80208d:	53                   	push   %ebx
+  80208e:	89 f1                	mov    %esi,%ecx
+  802090:	ba 06 00 00 00       	mov    $0x6,%edx
+  802095:	89 f8                	mov    %edi,%eax
+  802097:	e8 a5 fc ff ff       	call   801d41 <fsring_rw>
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020a2:	75 39                	jne    8020dd <devfile_write+0x6d>
+  8020a4:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8020a9:	39 c3                	cmp    %eax,%ebx
+  8020ab:	0f 47 d8             	cmova  %eax,%ebx
+  8020ae:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020b1:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020b6:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8020bc:	83 ec 04             	sub    $0x4,%esp
+  8020bf:	53                   	push   %ebx
+  8020c0:	56                   	push   %esi
+  8020c1:	68 08 60 80 00       	push   $0x806008
+  8020c6:	e8 db ea ff ff       	call   800ba6 <memmove>
+  8020cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020d5:	e8 7c fb ff ff       	call   801c56 <fsipc>
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e0:	5b                   	pop    %ebx
+  8020e1:	5e                   	pop    %esi
+  8020e2:	5f                   	pop    %edi
+  8020e3:	5d                   	pop    %ebp
+  8020e4:	c3                   	ret
+
+008020e5 <devfile_read>:
+  8020e5:	55                   	push   %ebp
+  8020e6:	89 e5                	mov    %esp,%ebp
+  8020e8:	57                   	push   %edi
+  8020e9:	56                   	push   %esi
+  8020ea:	53                   	push   %ebx
+  8020eb:	83 ec 0c             	sub    $0xc,%esp
+  8020ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020f1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020f4:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8020fa:	76 1d                	jbe    802119 <devfile_read+0x34>
+  8020fc:	83 ec 0c             	sub    $0xc,%esp
+  8020ff:	56                   	push   %esi
+  802100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802103:	ba 05 00 00 00       	mov    $0x5,%edx
+  802108:	89 f8                	mov    %edi,%eax
+  80210a:	e8 32 fc ff ff       	call   801d41 <fsring_rw>
+  80210f:	89 c3                	mov    %eax,%ebx
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802117:	75 37                	jne    802150 <devfile_read+0x6b>
+  802119:	8b 47 0c             	mov    0xc(%edi),%eax
+  80211c:	a3 00 60 80 00       	mov    %eax,0x806000
+  802121:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802127:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802131:	e8 20 fb ff ff       	call   801c56 <fsipc>
+  802136:	89 c3                	mov    %eax,%ebx
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	78 14                	js     802150 <devfile_read+0x6b>
+  80213c:	83 ec 04             	sub    $0x4,%esp
+  80213f:	50                   	push   %eax
+  802140:	68 00 60 80 00       	push   $0x806000
+  802145:	ff 75 0c             	push   0xc(%ebp)
+  802148:	e8 59 ea ff ff       	call   800ba6 <memmove>
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	89 d8                	mov    %ebx,%eax
+  802152:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802155:	5b                   	pop    %ebx
+  802156:	5e                   	pop    %esi
+  802157:	5f                   	pop    %edi
+  802158:	5d                   	pop    %ebp
+  802159:	c3                   	ret
+
+0080215a <open>:
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	56                   	push   %esi
+  80215e:	53                   	push   %ebx
+  80215f:	83 ec 1c             	sub    $0x1c,%esp
+  802162:	8b 75 08             	mov    0x8(%ebp),%esi
+  802165:	56                   	push   %esi
+  802166:	e8 3f e8 ff ff       	call   8009aa <strlen>
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802173:	7f 6c                	jg     8021e1 <open+0x87>
+  802175:	83 ec 0c             	sub    $0xc,%esp
+  802178:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217b:	50                   	push   %eax
+  80217c:	e8 6a f5 ff ff       	call   8016eb <fd_alloc>
+  802181:	89 c3                	mov    %eax,%ebx
+  802183:	83 c4 10             	add    $0x10,%esp
+  802186:	85 c0                	test   %eax,%eax
+  802188:	78 3c                	js     8021c6 <open+0x6c>
+  80218a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80218d:	a3 00 64 80 00       	mov    %eax,0x806400
+  802192:	83 ec 08             	sub    $0x8,%esp
+  802195:	56                   	push   %esi
+  802196:	68 00 60 80 00       	push   $0x806000
+  80219b:	e8 56 e8 ff ff       	call   8009f6 <strcpy>
+  8021a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021a8:	e8 a9 fa ff ff       	call   801c56 <fsipc>
+  8021ad:	89 c3                	mov    %eax,%ebx
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	85 c0                	test   %eax,%eax
+  8021b4:	78 19                	js     8021cf <open+0x75>
+  8021b6:	83 ec 0c             	sub    $0xc,%esp
+  8021b9:	ff 75 f4             	push   -0xc(%ebp)
+  8021bc:	e8 03 f5 ff ff       	call   8016c4 <fd2num>
+  8021c1:	89 c3                	mov    %eax,%ebx
+  8021c3:	83 c4 10             	add    $0x10,%esp
+  8021c6:	89 d8                	mov    %ebx,%eax
+  8021c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021cb:	5b                   	pop    %ebx
+  8021cc:	5e                   	pop    %esi
+  8021cd:	5d                   	pop    %ebp
+  8021ce:	c3                   	ret
+  8021cf:	83 ec 08             	sub    $0x8,%esp
+  8021d2:	6a 00                	push   $0x0
+  8021d4:	ff 75 f4             	push   -0xc(%ebp)
+  8021d7:	e8 05 f6 ff ff       	call   8017e1 <fd_close>
+  8021dc:	83 c4 10             	add    $0x10,%esp
+  8021df:	eb e5                	jmp    8021c6 <open+0x6c>
+  8021e1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021e6:	eb de                	jmp    8021c6 <open+0x6c>
+
+008021e8 <file_image>:
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+  8021eb:	53                   	push   %ebx
+  8021ec:	83 ec 1c             	sub    $0x1c,%esp
+  8021ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	ff 75 08             	push   0x8(%ebp)
+  8021f9:	e8 3d f5 ff ff       	call   80173b <fd_lookup>
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 58                	js     80225d <file_image+0x75>
+  802205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802208:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80220e:	39 08                	cmp    %ecx,(%eax)
+  802210:	75 50                	jne    802262 <file_image+0x7a>
+  802212:	83 fb 04             	cmp    $0x4,%ebx
+  802215:	77 52                	ja     802269 <file_image+0x81>
+  802217:	8b 40 0c             	mov    0xc(%eax),%eax
+  80221a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80221f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802225:	83 ec 04             	sub    $0x4,%esp
+  802228:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80222b:	c1 e0 02             	shl    $0x2,%eax
+  80222e:	50                   	push   %eax
+  80222f:	ff 75 0c             	push   0xc(%ebp)
+  802232:	68 08 60 80 00       	push   $0x806008
+  802237:	e8 6a e9 ff ff       	call   800ba6 <memmove>
+  80223c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802241:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802246:	e8 0b fa ff ff       	call   801c56 <fsipc>
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	85 c0                	test   %eax,%eax
+  802250:	78 0b                	js     80225d <file_image+0x75>
+  802252:	8b 55 14             	mov    0x14(%ebp),%edx
+  802255:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80225b:	89 0a                	mov    %ecx,(%edx)
+  80225d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802260:	c9                   	leave
+  802261:	c3                   	ret
+  802262:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802267:	eb f4                	jmp    80225d <file_image+0x75>
+  802269:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80226e:	eb ed                	jmp    80225d <file_image+0x75>
+
+00802270 <remove>:
+  802270:	55                   	push   %ebp
+  802271:	89 e5                	mov    %esp,%ebp
+  802273:	53                   	push   %ebx
+  802274:	83 ec 10             	sub    $0x10,%esp
+  802277:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80227a:	53                   	push   %ebx
+  80227b:	e8 2a e7 ff ff       	call   8009aa <strlen>
+  802280:	83 c4 10             	add    $0x10,%esp
+  802283:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802288:	7f 25                	jg     8022af <remove+0x3f>
+  80228a:	83 ec 08             	sub    $0x8,%esp
+  80228d:	53                   	push   %ebx
+  80228e:	68 00 60 80 00       	push   $0x806000
+  802293:	e8 5e e7 ff ff       	call   8009f6 <strcpy>
+  802298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80229d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022a2:	e8 af f9 ff ff       	call   801c56 <fsipc>
+  8022a7:	83 c4 10             	add    $0x10,%esp
+  8022aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+  8022af:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022b4:	eb f4                	jmp    8022aa <remove+0x3a>
+
+008022b6 <sync>:
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	83 ec 08             	sub    $0x8,%esp
+  8022bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022c6:	e8 8b f9 ff ff       	call   801c56 <fsipc>
+  8022cb:	c9                   	leave
+  8022cc:	c3                   	ret
+
+008022cd <devsock_stat>:
+  8022cd:	55                   	push   %ebp
+  8022ce:	89 e5                	mov    %esp,%ebp
+  8022d0:	83 ec 10             	sub    $0x10,%esp
+  8022d3:	68 48 3b 80 00       	push   $0x803b48
+  8022d8:	ff 75 0c             	push   0xc(%ebp)
+  8022db:	e8 16 e7 ff ff       	call   8009f6 <strcpy>
+  8022e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+
+008022e7 <devsock_close>:
+  8022e7:	55                   	push   %ebp
+  8022e8:	89 e5                	mov    %esp,%ebp
+  8022ea:	53                   	push   %ebx
+  8022eb:	83 ec 10             	sub    $0x10,%esp
+  8022ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022f1:	53                   	push   %ebx
+  8022f2:	e8 df 0d 00 00       	call   8030d6 <pageref>
+  8022f7:	89 c2                	mov    %eax,%edx
+  8022f9:	83 c4 10             	add    $0x10,%esp
+  8022fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802301:	83 fa 01             	cmp    $0x1,%edx
+  802304:	74 05                	je     80230b <devsock_close+0x24>
+  802306:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802309:	c9                   	leave
+  80230a:	c3                   	ret
+  80230b:	83 ec 0c             	sub    $0xc,%esp
+  80230e:	ff 73 0c             	push   0xc(%ebx)
+  802311:	e8 aa 02 00 00       	call   8025c0 <nsipc_close>
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	eb eb                	jmp    802306 <devsock_close+0x1f>
+
+0080231b <devsock_write>:
+  80231b:	55                   	push   %ebp
+  80231c:	89 e5                	mov    %esp,%ebp
+  80231e:	83 ec 08             	sub    $0x8,%esp
+  802321:	6a 00                	push   $0x0
+  802323:	ff 75 10             	push   0x10(%ebp)
+  802326:	ff 75 0c             	push   0xc(%ebp)
+  802329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232c:	ff 70 0c             	push   0xc(%eax)
+  80232f:	e8 6c 03 00 00       	call   8026a0 <nsipc_send>
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+00802336 <devsock_read>:
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	83 ec 08             	sub    $0x8,%esp
+  80233c:	6a 00                	push   $0x0
+  80233e:	ff 75 10             	push   0x10(%ebp)
+  802341:	ff 75 0c             	push   0xc(%ebp)
+  802344:	8b 45 08             	mov    0x8(%ebp),%eax
+  802347:	ff 70 0c             	push   0xc(%eax)
+  80234a:	e8 e2 02 00 00       	call   802631 <nsipc_recv>
+  80234f:	c9                   	leave
+  802350:	c3                   	ret
+
+00802351 <fd2sockid>:
+  802351:	55                   	push   %ebp
+  802352:	89 e5                	mov    %esp,%ebp
+  802354:	83 ec 20             	sub    $0x20,%esp
+  802357:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80235a:	52                   	push   %edx
+  80235b:	50                   	push   %eax
+  80235c:	e8 da f3 ff ff       	call   80173b <fd_lookup>
+  802361:	83 c4 10             	add    $0x10,%esp
+  802364:	85 c0                	test   %eax,%eax
+  802366:	78 10                	js     802378 <fd2sockid+0x27>
+  802368:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802371:	39 08                	cmp    %ecx,(%eax)
+  802373:	75 05                	jne    80237a <fd2sockid+0x29>
+  802375:	8b 40 0c             	mov    0xc(%eax),%eax
+  802378:	c9                   	leave
+  802379:	c3                   	ret
+  80237a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80237f:	eb f7                	jmp    802378 <fd2sockid+0x27>
+
+00802381 <alloc_sockfd>:
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+  802384:	56                   	push   %esi
+  802385:	53                   	push   %ebx
+  802386:	83 ec 1c             	sub    $0x1c,%esp
+  802389:	89 c6                	mov    %eax,%esi
+  80238b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80238e:	50                   	push   %eax
+  80238f:	e8 57 f3 ff ff       	call   8016eb <fd_alloc>
+  802394:	89 c3                	mov    %eax,%ebx
+  802396:	83 c4 10             	add    $0x10,%esp
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	78 43                	js     8023e0 <alloc_sockfd+0x5f>
+  80239d:	83 ec 04             	sub    $0x4,%esp
+  8023a0:	68 07 04 00 00       	push   $0x407
+  8023a5:	ff 75 f4             	push   -0xc(%ebp)
+  8023a8:	6a 00                	push   $0x0
+  8023aa:	e8 a7 ea ff ff       	call   800e56 <sys_page_alloc>
+  8023af:	89 c3                	mov    %eax,%ebx
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	78 28                	js     8023e0 <alloc_sockfd+0x5f>
+  8023b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023bb:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8023c1:	89 10                	mov    %edx,(%eax)
+  8023c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8023cd:	89 70 0c             	mov    %esi,0xc(%eax)
+  8023d0:	83 ec 0c             	sub    $0xc,%esp
+  8023d3:	50                   	push   %eax
+  8023d4:	e8 eb f2 ff ff       	call   8016c4 <fd2num>
+  8023d9:	89 c3                	mov    %eax,%ebx
+  8023db:	83 c4 10             	add    $0x10,%esp
+  8023de:	eb 0c                	jmp    8023ec <alloc_sockfd+0x6b>
+  8023e0:	83 ec 0c             	sub    $0xc,%esp
+  8023e3:	56                   	push   %esi
+  8023e4:	e8 d7 01 00 00       	call   8025c0 <nsipc_close>
+  8023e9:	83 c4 10             	add    $0x10,%esp
+  8023ec:	89 d8                	mov    %ebx,%eax
+  8023ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023f1:	5b                   	pop    %ebx
+  8023f2:	5e                   	pop    %esi
+  8023f3:	5d                   	pop    %ebp
+  8023f4:	c3                   	ret
+
+008023f5 <accept>:
+  8023f5:	55                   	push   %ebp
+  8023f6:	89 e5                	mov    %esp,%ebp
+  8023f8:	83 ec 08             	sub    $0x8,%esp
+  8023fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fe:	e8 4e ff ff ff       	call   802351 <fd2sockid>
+  802403:	85 c0                	test   %eax,%eax
+  802405:	78 1b                	js     802422 <accept+0x2d>
+  802407:	83 ec 04             	sub    $0x4,%esp
+  80240a:	ff 75 10             	push   0x10(%ebp)
+  80240d:	ff 75 0c             	push   0xc(%ebp)
+  802410:	50                   	push   %eax
+  802411:	e8 07 01 00 00       	call   80251d <nsipc_accept>
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	85 c0                	test   %eax,%eax
+  80241b:	78 05                	js     802422 <accept+0x2d>
+  80241d:	e8 5f ff ff ff       	call   802381 <alloc_sockfd>
+  802422:	c9                   	leave
+  802423:	c3                   	ret
+
+00802424 <bind>:
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	83 ec 08             	sub    $0x8,%esp
+  80242a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242d:	e8 1f ff ff ff       	call   802351 <fd2sockid>
+  802432:	85 c0                	test   %eax,%eax
+  802434:	78 12                	js     802448 <bind+0x24>
+  802436:	83 ec 04             	sub    $0x4,%esp
+  802439:	ff 75 10             	push   0x10(%ebp)
+  80243c:	ff 75 0c             	push   0xc(%ebp)
+  80243f:	50                   	push   %eax
+  802440:	e8 24 01 00 00       	call   802569 <nsipc_bind>
+  802445:	83 c4 10             	add    $0x10,%esp
+  802448:	c9                   	leave
+  802449:	c3                   	ret
+
+0080244a <shutdown>:
+  80244a:	55                   	push   %ebp
+  80244b:	89 e5                	mov    %esp,%ebp
+  80244d:	83 ec 08             	sub    $0x8,%esp
+  802450:	8b 45 08             	mov    0x8(%ebp),%eax
+  802453:	e8 f9 fe ff ff       	call   802351 <fd2sockid>
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	78 0f                	js     80246b <shutdown+0x21>
+  80245c:	83 ec 08             	sub    $0x8,%esp
+  80245f:	ff 75 0c             	push   0xc(%ebp)
+  802462:	50                   	push   %eax
+  802463:	e8 36 01 00 00       	call   80259e <nsipc_shutdown>
+  802468:	83 c4 10             	add    $0x10,%esp
+  80246b:	c9                   	leave
+  80246c:	c3                   	ret
+
+0080246d <connect>:
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	83 ec 08             	sub    $0x8,%esp
+  802473:	8b 45 08             	mov    0x8(%ebp),%eax
+  802476:	e8 d6 fe ff ff       	call   802351 <fd2sockid>
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 12                	js     802491 <connect+0x24>
+  80247f:	83 ec 04             	sub    $0x4,%esp
+  802482:	ff 75 10             	push   0x10(%ebp)
+  802485:	ff 75 0c             	push   0xc(%ebp)
+  802488:	50                   	push   %eax
+  802489:	e8 4c 01 00 00       	call   8025da <nsipc_connect>
+  80248e:	83 c4 10             	add    $0x10,%esp
+  802491:	c9                   	leave
+  802492:	c3                   	ret
+
+00802493 <listen>:
+  802493:	55                   	push   %ebp
+  802494:	89 e5                	mov    %esp,%ebp
+  802496:	83 ec 08             	sub    $0x8,%esp
+  802499:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249c:	e8 b0 fe ff ff       	call   802351 <fd2sockid>
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	78 0f                	js     8024b4 <listen+0x21>
+  8024a5:	83 ec 08             	sub    $0x8,%esp
+  8024a8:	ff 75 0c             	push   0xc(%ebp)
+  8024ab:	50                   	push   %eax
+  8024ac:	e8 5e 01 00 00       	call   80260f <nsipc_listen>
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	c9                   	leave
+  8024b5:	c3                   	ret
+
+008024b6 <socket>:
+  8024b6:	55                   	push   %ebp
+  8024b7:	89 e5                	mov    %esp,%ebp
+  8024b9:	83 ec 0c             	sub    $0xc,%esp
+  8024bc:	ff 75 10             	push   0x10(%ebp)
+  8024bf:	ff 75 0c             	push   0xc(%ebp)
+  8024c2:	ff 75 08             	push   0x8(%ebp)
+  8024c5:	e8 34 02 00 00       	call   8026fe <nsipc_socket>
+  8024ca:	83 c4 10             	add    $0x10,%esp
+  8024cd:	85 c0                	test   %eax,%eax
+  8024cf:	78 05                	js     8024d6 <socket+0x20>
+  8024d1:	e8 ab fe ff ff       	call   802381 <alloc_sockfd>
+  8024d6:	c9                   	leave
+  8024d7:	c3                   	ret
+
+008024d8 <nsipc>:
+  8024d8:	55                   	push   %ebp
+  8024d9:	89 e5                	mov    %esp,%ebp
+  8024db:	53                   	push   %ebx
+  8024dc:	83 ec 04             	sub    $0x4,%esp
+  8024df:	89 c3                	mov    %eax,%ebx
+  8024e1:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8024e8:	74 1f                	je     802509 <nsipc+0x31>
+  8024ea:	83 ec 08             	sub    $0x8,%esp
+  8024ed:	6a 00                	push   $0x0
+  8024ef:	6a 00                	push   $0x0
+  8024f1:	6a 07                	push   $0x7
+  8024f3:	68 00 70 80 00       	push   $0x807000
+  8024f8:	53                   	push   %ebx
+  8024f9:	ff 35 0c 50 80 00    	push   0x80500c
+  8024ff:	e8 1d 0a 00 00       	call   802f21 <ipc_call>
+  802504:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802507:	c9                   	leave
+  802508:	c3                   	ret
+  802509:	83 ec 0c             	sub    $0xc,%esp
+  80250c:	6a 03                	push   $0x3
+  80250e:	e8 a9 0b 00 00       	call   8030bc <ipc_find_env>
+  802513:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	eb cd                	jmp    8024ea <nsipc+0x12>
+
+0080251d <nsipc_accept>:
+  80251d:	55                   	push   %ebp
+  80251e:	89 e5                	mov    %esp,%ebp
+  802520:	53                   	push   %ebx
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	8b 45 08             	mov    0x8(%ebp),%eax
+  802527:	a3 00 70 80 00       	mov    %eax,0x807000
+  80252c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802531:	e8 a2 ff ff ff       	call   8024d8 <nsipc>
+  802536:	89 c3                	mov    %eax,%ebx
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	79 07                	jns    802543 <nsipc_accept+0x26>
+  80253c:	89 d8                	mov    %ebx,%eax
+  80253e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802541:	c9                   	leave
+  802542:	c3                   	ret
+  802543:	83 ec 04             	sub    $0x4,%esp
+  802546:	ff 35 10 70 80 00    	push   0x807010
+  80254c:	68 00 70 80 00       	push   $0x807000
+  802551:	ff 75 0c             	push   0xc(%ebp)
+  802554:	e8 4d e6 ff ff       	call   800ba6 <memmove>
+  802559:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80255f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802562:	89 10                	mov    %edx,(%eax)
+  802564:	83 c4 10             	add    $0x10,%esp
+  802567:	eb d3                	jmp    80253c <nsipc_accept+0x1f>
+
+00802569 <nsipc_bind>:
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	53                   	push   %ebx
+  80256d:	83 ec 08             	sub    $0x8,%esp
+  802570:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802573:	8b 45 08             	mov    0x8(%ebp),%eax
+  802576:	a3 00 70 80 00       	mov    %eax,0x807000
+  80257b:	53                   	push   %ebx
+  80257c:	ff 75 0c             	push   0xc(%ebp)
+  80257f:	68 04 70 80 00       	push   $0x807004
+  802584:	e8 1d e6 ff ff       	call   800ba6 <memmove>
+  802589:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80258f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802594:	e8 3f ff ff ff       	call   8024d8 <nsipc>
+  802599:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+0080259e <nsipc_shutdown>:
+  80259e:	55                   	push   %ebp
+  80259f:	89 e5                	mov    %esp,%ebp
+  8025a1:	83 ec 08             	sub    $0x8,%esp
+  8025a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a7:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025af:	a3 04 70 80 00       	mov    %eax,0x807004
+  8025b4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025b9:	e8 1a ff ff ff       	call   8024d8 <nsipc>
+  8025be:	c9                   	leave
+  8025bf:	c3                   	ret
+
+008025c0 <nsipc_close>:
+  8025c0:	55                   	push   %ebp
+  8025c1:	89 e5                	mov    %esp,%ebp
+  8025c3:	83 ec 08             	sub    $0x8,%esp
+  8025c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025ce:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025d3:	e8 00 ff ff ff       	call   8024d8 <nsipc>
+  8025d8:	c9                   	leave
+  8025d9:	c3                   	ret
+
+008025da <nsipc_connect>:
+  8025da:	55                   	push   %ebp
+  8025db:	89 e5                	mov    %esp,%ebp
+  8025dd:	53                   	push   %ebx
+  8025de:	83 ec 08             	sub    $0x8,%esp
+  8025e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e7:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025ec:	53                   	push   %ebx
+  8025ed:	ff 75 0c             	push   0xc(%ebp)
+  8025f0:	68 04 70 80 00       	push   $0x807004
+  8025f5:	e8 ac e5 ff ff       	call   800ba6 <memmove>
+  8025fa:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802600:	b8 05 00 00 00       	mov    $0x5,%eax
+  802605:	e8 ce fe ff ff       	call   8024d8 <nsipc>
+  80260a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80260d:	c9                   	leave
+  80260e:	c3                   	ret
+
+0080260f <nsipc_listen>:
+  80260f:	55                   	push   %ebp
+  802610:	89 e5                	mov    %esp,%ebp
+  802612:	83 ec 08             	sub    $0x8,%esp
+  802615:	8b 45 08             	mov    0x8(%ebp),%eax
+  802618:	a3 00 70 80 00       	mov    %eax,0x807000
+  80261d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802620:	a3 04 70 80 00       	mov    %eax,0x807004
+  802625:	b8 06 00 00 00       	mov    $0x6,%eax
+  80262a:	e8 a9 fe ff ff       	call   8024d8 <nsipc>
+  80262f:	c9                   	leave
+  802630:	c3                   	ret
+
+00802631 <nsipc_recv>:
+  802631:	55                   	push   %ebp
+  802632:	89 e5                	mov    %esp,%ebp
+  802634:	56                   	push   %esi
+  802635:	53                   	push   %ebx
+  802636:	8b 75 10             	mov    0x10(%ebp),%esi
+  802639:	8b 45 08             	mov    0x8(%ebp),%eax
+  80263c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802641:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264a:	a3 08 70 80 00       	mov    %eax,0x807008
+  80264f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802654:	e8 7f fe ff ff       	call   8024d8 <nsipc>
+  802659:	89 c3                	mov    %eax,%ebx
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	78 22                	js     802681 <nsipc_recv+0x50>
+  80265f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802664:	39 c6                	cmp    %eax,%esi
+  802666:	0f 4e c6             	cmovle %esi,%eax
+  802669:	39 c3                	cmp    %eax,%ebx
+  80266b:	7f 1d                	jg     80268a <nsipc_recv+0x59>
+  80266d:	83 ec 04             	sub    $0x4,%esp
+  802670:	53                   	push   %ebx
+  802671:	68 00 70 80 00       	push   $0x807000
+  802676:	ff 75 0c             	push   0xc(%ebp)
+  802679:	e8 28 e5 ff ff       	call   800ba6 <memmove>
+  80267e:	83 c4 10             	add    $0x10,%esp
+  802681:	89 d8                	mov    %ebx,%eax
+  802683:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802686:	5b                   	pop    %ebx
+  802687:	5e                   	pop    %esi
+  802688:	5d                   	pop    %ebp
+  802689:	c3                   	ret
+  80268a:	68 54 3b 80 00       	push   $0x803b54
+  80268f:	68 69 3b 80 00       	push   $0x803b69
+  802694:	6a 60                	push   $0x60
+  802696:	68 7e 3b 80 00       	push   $0x803b7e
+  80269b:	e8 83 07 00 00       	call   802e23 <_panic>
+
+008026a0 <nsipc_send>:
+  8026a0:	55                   	push   %ebp
+  8026a1:	89 e5                	mov    %esp,%ebp
+  8026a3:	53                   	push   %ebx
+  8026a4:	83 ec 04             	sub    $0x4,%esp
+  8026a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ad:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026b2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8026b8:	7f 2e                	jg     8026e8 <nsipc_send+0x48>
+  8026ba:	83 ec 04             	sub    $0x4,%esp
+  8026bd:	53                   	push   %ebx
+  8026be:	ff 75 0c             	push   0xc(%ebp)
+  8026c1:	68 0c 70 80 00       	push   $0x80700c
+  8026c6:	e8 db e4 ff ff       	call   800ba6 <memmove>
+  8026cb:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8026d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026d4:	a3 08 70 80 00       	mov    %eax,0x807008
+  8026d9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026de:	e8 f5 fd ff ff       	call   8024d8 <nsipc>
+  8026e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e6:	c9                   	leave
+  8026e7:	c3                   	ret
+  8026e8:	68 8a 3b 80 00       	push   $0x803b8a
+  8026ed:	68 69 3b 80 00       	push   $0x803b69
+  8026f2:	6a 6b                	push   $0x6b
+  8026f4:	68 7e 3b 80 00       	push   $0x803b7e
+  8026f9:	e8 25 07 00 00       	call   802e23 <_panic>
+
+008026fe <nsipc_socket>:
+  8026fe:	55                   	push   %ebp
+  8026ff:	89 e5                	mov    %esp,%ebp
+  802701:	83 ec 08             	sub    $0x8,%esp
+  802704:	8b 45 08             	mov    0x8(%ebp),%eax
+  802707:	a3 00 70 80 00       	mov    %eax,0x807000
+  80270c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80270f:	a3 04 70 80 00       	mov    %eax,0x807004
+  802714:	8b 45 10             	mov    0x10(%ebp),%eax
+  802717:	a3 08 70 80 00       	mov    %eax,0x807008
+  80271c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802721:	e8 b2 fd ff ff       	call   8024d8 <nsipc>
+  802726:	c9                   	leave
+  802727:	c3                   	ret
+
+00802728 <devpipe_stat>:
+  802728:	55                   	push   %ebp
+  802729:	89 e5                	mov    %esp,%ebp
+  80272b:	56                   	push   %esi
+  80272c:	53                   	push   %ebx
+  80272d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802730:	83 ec 0c             	sub    $0xc,%esp
+  802733:	ff 75 08             	push   0x8(%ebp)
+  802736:	e8 99 ef ff ff       	call   8016d4 <fd2data>
+  80273b:	89 c6                	mov    %eax,%esi
+  80273d:	83 c4 08             	add    $0x8,%esp
+  802740:	68 96 3b 80 00       	push   $0x803b96
+  802745:	53                   	push   %ebx
+  802746:	e8 ab e2 ff ff       	call   8009f6 <strcpy>
+  80274b:	8b 46 04             	mov    0x4(%esi),%eax
+  80274e:	2b 06                	sub    (%esi),%eax
+  802750:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802756:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80275d:	00 00 00 
+  802760:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802767:	40 80 00 
+  80276a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802772:	5b                   	pop    %ebx
+  802773:	5e                   	pop    %esi
+  802774:	5d                   	pop    %ebp
+  802775:	c3                   	ret
+
+00802776 <devpipe_close>:
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	53                   	push   %ebx
+  80277a:	83 ec 0c             	sub    $0xc,%esp
+  80277d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802780:	53                   	push   %ebx
+  802781:	6a 00                	push   $0x0
+  802783:	e8 a0 e7 ff ff       	call   800f28 <sys_page_unmap>
+  802788:	89 1c 24             	mov    %ebx,(%esp)
+  80278b:	e8 44 ef ff ff       	call   8016d4 <fd2data>
+  802790:	83 c4 08             	add    $0x8,%esp
+  802793:	50                   	push   %eax
+  802794:	6a 00                	push   $0x0
+  802796:	e8 8d e7 ff ff       	call   800f28 <sys_page_unmap>
+  80279b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80279e:	c9                   	leave
+  80279f:	c3                   	ret
+
+008027a0 <_pipeisclosed>:
+  8027a0:	55                   	push   %ebp
+  8027a1:	89 e5                	mov    %esp,%ebp
+  8027a3:	57                   	push   %edi
+  8027a4:	56                   	push   %esi
+  8027a5:	53                   	push   %ebx
+  8027a6:	83 ec 1c             	sub    $0x1c,%esp
+  8027a9:	89 c7                	mov    %eax,%edi
+  8027ab:	89 d6                	mov    %edx,%esi
+  8027ad:	a1 20 50 80 00       	mov    0x805020,%eax
+  8027b2:	8b 58 58             	mov    0x58(%eax),%ebx
+  8027b5:	83 ec 0c             	sub    $0xc,%esp
+  8027b8:	57                   	push   %edi
+  8027b9:	e8 18 09 00 00       	call   8030d6 <pageref>
+  8027be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027c1:	89 34 24             	mov    %esi,(%esp)
+  8027c4:	e8 0d 09 00 00       	call   8030d6 <pageref>
+  8027c9:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8027cf:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8027d2:	83 c4 10             	add    $0x10,%esp
+  8027d5:	39 cb                	cmp    %ecx,%ebx
+  8027d7:	74 1b                	je     8027f4 <_pipeisclosed+0x54>
+  8027d9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027dc:	75 cf                	jne    8027ad <_pipeisclosed+0xd>
+  8027de:	8b 42 58             	mov    0x58(%edx),%eax
+  8027e1:	6a 01                	push   $0x1
+  8027e3:	50                   	push   %eax
+  8027e4:	53                   	push   %ebx
+  8027e5:	68 9d 3b 80 00       	push   $0x803b9d
+  8027ea:	e8 10 db ff ff       	call   8002ff <cprintf>
+  8027ef:	83 c4 10             	add    $0x10,%esp
+  8027f2:	eb b9                	jmp    8027ad <_pipeisclosed+0xd>
+  8027f4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027f7:	0f 94 c0             	sete   %al
+  8027fa:	0f b6 c0             	movzbl %al,%eax
+  8027fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802800:	5b                   	pop    %ebx
+  802801:	5e                   	pop    %esi
+  802802:	5f                   	pop    %edi
+  802803:	5d                   	pop    %ebp
+  802804:	c3                   	ret
+
+00802805 <devpipe_write>:
+  802805:	55                   	push   %ebp
+  802806:	89 e5                	mov    %esp,%ebp
+  802808:	57                   	push   %edi
+  802809:	56                   	push   %esi
+  80280a:	53                   	push   %ebx
+  80280b:	83 ec 28             	sub    $0x28,%esp
+  80280e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802811:	56                   	push   %esi
+  802812:	e8 bd ee ff ff       	call   8016d4 <fd2data>
+  802817:	89 c3                	mov    %eax,%ebx
+  802819:	83 c4 10             	add    $0x10,%esp
+  80281c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802821:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802825:	74 5c                	je     802883 <devpipe_write+0x7e>
+  802827:	8b 43 04             	mov    0x4(%ebx),%eax
+  80282a:	8b 0b                	mov    (%ebx),%ecx
+  80282c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80282f:	39 d0                	cmp    %edx,%eax
+  802831:	72 1e                	jb     802851 <devpipe_write+0x4c>
+  802833:	89 da                	mov    %ebx,%edx
+  802835:	89 f0                	mov    %esi,%eax
+  802837:	e8 64 ff ff ff       	call   8027a0 <_pipeisclosed>
+  80283c:	85 c0                	test   %eax,%eax
+  80283e:	75 48                	jne    802888 <devpipe_write+0x83>
+  802840:	e8 c6 e5 ff ff       	call   800e0b <sys_yield>
+  802845:	8b 43 04             	mov    0x4(%ebx),%eax
+  802848:	8b 0b                	mov    (%ebx),%ecx
+  80284a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80284d:	39 d0                	cmp    %edx,%eax
+  80284f:	73 e2                	jae    802833 <devpipe_write+0x2e>
+  802851:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802854:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802858:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80285b:	89 c2                	mov    %eax,%edx
+  80285d:	c1 fa 1f             	sar    $0x1f,%edx
+  802860:	89 d1                	mov    %edx,%ecx
+  802862:	c1 e9 1b             	shr    $0x1b,%ecx
+  802865:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802868:	83 e2 1f             	and    $0x1f,%edx
+  80286b:	29 ca                	sub    %ecx,%edx
+  80286d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802871:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802875:	83 c0 01             	add    $0x1,%eax
+  802878:	89 43 04             	mov    %eax,0x4(%ebx)
+  80287b:	83 c7 01             	add    $0x1,%edi
+  80287e:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802881:	75 a4                	jne    802827 <devpipe_write+0x22>
+  802883:	8b 45 10             	mov    0x10(%ebp),%eax
+  802886:	eb 05                	jmp    80288d <devpipe_write+0x88>
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802890:	5b                   	pop    %ebx
+  802891:	5e                   	pop    %esi
+  802892:	5f                   	pop    %edi
+  802893:	5d                   	pop    %ebp
+  802894:	c3                   	ret
+
+00802895 <devpipe_read>:
+  802895:	55                   	push   %ebp
+  802896:	89 e5                	mov    %esp,%ebp
+  802898:	57                   	push   %edi
+  802899:	56                   	push   %esi
+  80289a:	53                   	push   %ebx
+  80289b:	83 ec 18             	sub    $0x18,%esp
+  80289e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028a1:	56                   	push   %esi
+  8028a2:	e8 2d ee ff ff       	call   8016d4 <fd2data>
+  8028a7:	89 c3                	mov    %eax,%ebx
+  8028a9:	83 c4 10             	add    $0x10,%esp
+  8028ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028b1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028b5:	74 45                	je     8028fc <devpipe_read+0x67>
+  8028b7:	8b 03                	mov    (%ebx),%eax
+  8028b9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028bc:	75 1d                	jne    8028db <devpipe_read+0x46>
+  8028be:	85 ff                	test   %edi,%edi
+  8028c0:	75 3f                	jne    802901 <devpipe_read+0x6c>
+  8028c2:	89 da                	mov    %ebx,%edx
+  8028c4:	89 f0                	mov    %esi,%eax
+  8028c6:	e8 d5 fe ff ff       	call   8027a0 <_pipeisclosed>
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	75 3c                	jne    80290b <devpipe_read+0x76>
+  8028cf:	e8 37 e5 ff ff       	call   800e0b <sys_yield>
+  8028d4:	8b 03                	mov    (%ebx),%eax
+  8028d6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028d9:	74 e7                	je     8028c2 <devpipe_read+0x2d>
+  8028db:	99                   	cltd
+  8028dc:	c1 ea 1b             	shr    $0x1b,%edx
+  8028df:	01 d0                	add    %edx,%eax
+  8028e1:	83 e0 1f             	and    $0x1f,%eax
+  8028e4:	29 d0                	sub    %edx,%eax
+  8028e6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028ee:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8028f1:	83 03 01             	addl   $0x1,(%ebx)
+  8028f4:	83 c7 01             	add    $0x1,%edi
+  8028f7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8028fa:	75 bb                	jne    8028b7 <devpipe_read+0x22>
+  8028fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028ff:	eb 02                	jmp    802903 <devpipe_read+0x6e>
+  802901:	89 f8                	mov    %edi,%eax
+  802903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802906:	5b                   	pop    %ebx
+  802907:	5e                   	pop    %esi
+  802908:	5f                   	pop    %edi
+  802909:	5d                   	pop    %ebp
+  80290a:	c3                   	ret
+  80290b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802910:	eb f1                	jmp    802903 <devpipe_read+0x6e>
+
+00802912 <pipe>:
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	56                   	push   %esi
+  802916:	53                   	push   %ebx
+  802917:	83 ec 1c             	sub    $0x1c,%esp
+  80291a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80291d:	50                   	push   %eax
+  80291e:	e8 c8 ed ff ff       	call   8016eb <fd_alloc>
+  802923:	89 c3                	mov    %eax,%ebx
+  802925:	83 c4 10             	add    $0x10,%esp
+  802928:	85 c0                	test   %eax,%eax
+  80292a:	0f 88 23 01 00 00    	js     802a53 <pipe+0x141>
+  802930:	83 ec 04             	sub    $0x4,%esp
+  802933:	68 07 04 00 00       	push   $0x407
+  802938:	ff 75 f4             	push   -0xc(%ebp)
+  80293b:	6a 00                	push   $0x0
+  80293d:	e8 14 e5 ff ff       	call   800e56 <sys_page_alloc>
+  802942:	89 c3                	mov    %eax,%ebx
+  802944:	83 c4 10             	add    $0x10,%esp
+  802947:	85 c0                	test   %eax,%eax
+  802949:	0f 88 04 01 00 00    	js     802a53 <pipe+0x141>
+  80294f:	83 ec 0c             	sub    $0xc,%esp
+  802952:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802955:	50                   	push   %eax
+  802956:	e8 90 ed ff ff       	call   8016eb <fd_alloc>
+  80295b:	89 c3                	mov    %eax,%ebx
+  80295d:	83 c4 10             	add    $0x10,%esp
+  802960:	85 c0                	test   %eax,%eax
+  802962:	0f 88 db 00 00 00    	js     802a43 <pipe+0x131>
+  802968:	83 ec 04             	sub    $0x4,%esp
+  80296b:	68 07 04 00 00       	push   $0x407
+  802970:	ff 75 f0             	push   -0x10(%ebp)
+  802973:	6a 00                	push   $0x0
+  802975:	e8 dc e4 ff ff       	call   800e56 <sys_page_alloc>
+  80297a:	89 c3                	mov    %eax,%ebx
+  80297c:	83 c4 10             	add    $0x10,%esp
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	0f 88 bc 00 00 00    	js     802a43 <pipe+0x131>
+  802987:	83 ec 0c             	sub    $0xc,%esp
+  80298a:	ff 75 f4             	push   -0xc(%ebp)
+  80298d:	e8 42 ed ff ff       	call   8016d4 <fd2data>
+  802992:	89 c6                	mov    %eax,%esi
+  802994:	83 c4 0c             	add    $0xc,%esp
+  802997:	68 07 04 00 00       	push   $0x407
+  80299c:	50                   	push   %eax
+  80299d:	6a 00                	push   $0x0
+  80299f:	e8 b2 e4 ff ff       	call   800e56 <sys_page_alloc>
+  8029a4:	89 c3                	mov    %eax,%ebx
+  8029a6:	83 c4 10             	add    $0x10,%esp
+  8029a9:	85 c0                	test   %eax,%eax
+  8029ab:	0f 88 82 00 00 00    	js     802a33 <pipe+0x121>
+  8029b1:	83 ec 0c             	sub    $0xc,%esp
+  8029b4:	ff 75 f0             	push   -0x10(%ebp)
+  8029b7:	e8 18 ed ff ff       	call   8016d4 <fd2data>
+  8029bc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029c3:	50                   	push   %eax
+  8029c4:	6a 00                	push   $0x0
+  8029c6:	56                   	push   %esi
+  8029c7:	6a 00                	push   $0x0
+  8029c9:	e8 cb e4 ff ff       	call   800e99 <sys_page_map>
+  8029ce:	89 c3                	mov    %eax,%ebx
+  8029d0:	83 c4 20             	add    $0x20,%esp
+  8029d3:	85 c0                	test   %eax,%eax
+  8029d5:	78 4e                	js     802a25 <pipe+0x113>
+  8029d7:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8029dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029df:	89 02                	mov    %eax,(%edx)
+  8029e1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029e4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8029eb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029ee:	89 02                	mov    %eax,(%edx)
+  8029f0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029f3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8029fa:	83 ec 0c             	sub    $0xc,%esp
+  8029fd:	ff 75 f4             	push   -0xc(%ebp)
+  802a00:	e8 bf ec ff ff       	call   8016c4 <fd2num>
+  802a05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a08:	89 01                	mov    %eax,(%ecx)
+  802a0a:	83 c4 04             	add    $0x4,%esp
+  802a0d:	ff 75 f0             	push   -0x10(%ebp)
+  802a10:	e8 af ec ff ff       	call   8016c4 <fd2num>
+  802a15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a18:	89 41 04             	mov    %eax,0x4(%ecx)
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a23:	eb 2e                	jmp    802a53 <pipe+0x141>
+  802a25:	83 ec 08             	sub    $0x8,%esp
+  802a28:	56                   	push   %esi
+  802a29:	6a 00                	push   $0x0
+  802a2b:	e8 f8 e4 ff ff       	call   800f28 <sys_page_unmap>
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	83 ec 08             	sub    $0x8,%esp
+  802a36:	ff 75 f0             	push   -0x10(%ebp)
+  802a39:	6a 00                	push   $0x0
+  802a3b:	e8 e8 e4 ff ff       	call   800f28 <sys_page_unmap>
+  802a40:	83 c4 10             	add    $0x10,%esp
+  802a43:	83 ec 08             	sub    $0x8,%esp
+  802a46:	ff 75 f4             	push   -0xc(%ebp)
+  802a49:	6a 00                	push   $0x0
+  802a4b:	e8 d8 e4 ff ff       	call   800f28 <sys_page_unmap>
+  802a50:	83 c4 10             	add    $0x10,%esp
+  802a53:	89 d8                	mov    %ebx,%eax
+  802a55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a58:	5b                   	pop    %ebx
+  802a59:	5e                   	pop    %esi
+  802a5a:	5d                   	pop    %ebp
+  802a5b:	c3                   	ret
+
+00802a5c <pipeisclosed>:
+  802a5c:	55                   	push   %ebp
+  802a5d:	89 e5                	mov    %esp,%ebp
+  802a5f:	83 ec 20             	sub    $0x20,%esp
+  802a62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a65:	50                   	push   %eax
+  802a66:	ff 75 08             	push   0x8(%ebp)
+  802a69:	e8 cd ec ff ff       	call   80173b <fd_lookup>
+  802a6e:	83 c4 10             	add    $0x10,%esp
+  802a71:	85 c0                	test   %eax,%eax
+  802a73:	78 18                	js     802a8d <pipeisclosed+0x31>
+  802a75:	83 ec 0c             	sub    $0xc,%esp
+  802a78:	ff 75 f4             	push   -0xc(%ebp)
+  802a7b:	e8 54 ec ff ff       	call   8016d4 <fd2data>
+  802a80:	89 c2                	mov    %eax,%edx
+  802a82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a85:	e8 16 fd ff ff       	call   8027a0 <_pipeisclosed>
+  802a8a:	83 c4 10             	add    $0x10,%esp
+  802a8d:	c9                   	leave
+  802a8e:	c3                   	ret
+
+00802a8f <ipcring_init>:
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	53                   	push   %ebx
+  802a93:	83 ec 08             	sub    $0x8,%esp
+  802a96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a99:	6a 60                	push   $0x60
+  802a9b:	6a 00                	push   $0x0
+  802a9d:	53                   	push   %ebx
+  802a9e:	e8 ce e0 ff ff       	call   800b71 <memset>
+  802aa3:	a1 20 50 80 00       	mov    0x805020,%eax
+  802aa8:	8b 40 48             	mov    0x48(%eax),%eax
+  802aab:	89 03                	mov    %eax,(%ebx)
+  802aad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ab0:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ab3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ab6:	89 43 08             	mov    %eax,0x8(%ebx)
+  802ab9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802abc:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802abf:	83 c4 10             	add    $0x10,%esp
+  802ac2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac5:	c9                   	leave
+  802ac6:	c3                   	ret
+
+00802ac7 <ipcring_req_slot>:
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acd:	8b 50 10             	mov    0x10(%eax),%edx
+  802ad0:	8b 48 18             	mov    0x18(%eax),%ecx
+  802ad3:	29 ca                	sub    %ecx,%edx
+  802ad5:	83 fa 07             	cmp    $0x7,%edx
+  802ad8:	77 0c                	ja     802ae6 <ipcring_req_slot+0x1f>
+  802ada:	8b 50 10             	mov    0x10(%eax),%edx
+  802add:	83 e2 07             	and    $0x7,%edx
+  802ae0:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802ae4:	5d                   	pop    %ebp
+  802ae5:	c3                   	ret
+  802ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aeb:	eb f7                	jmp    802ae4 <ipcring_req_slot+0x1d>
+
+00802aed <ipcring_req_push>:
+  802aed:	55                   	push   %ebp
+  802aee:	89 e5                	mov    %esp,%ebp
+  802af0:	83 ec 08             	sub    $0x8,%esp
+  802af3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802af6:	8b 42 10             	mov    0x10(%edx),%eax
+  802af9:	83 c0 01             	add    $0x1,%eax
+  802afc:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b05:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802b09:	85 c0                	test   %eax,%eax
+  802b0b:	75 02                	jne    802b0f <ipcring_req_push+0x22>
+  802b0d:	c9                   	leave
+  802b0e:	c3                   	ret
+  802b0f:	6a 00                	push   $0x0
+  802b11:	68 00 00 80 ee       	push   $0xee800000
+  802b16:	ff 72 08             	push   0x8(%edx)
+  802b19:	ff 72 04             	push   0x4(%edx)
+  802b1c:	e8 6d e6 ff ff       	call   80118e <sys_ipc_send>
+  802b21:	83 c4 10             	add    $0x10,%esp
+  802b24:	eb e7                	jmp    802b0d <ipcring_req_push+0x20>
+
+00802b26 <ipcring_rsp_wait>:
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	53                   	push   %ebx
+  802b2a:	83 ec 04             	sub    $0x4,%esp
+  802b2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b30:	8b 53 18             	mov    0x18(%ebx),%edx
+  802b33:	8b 43 10             	mov    0x10(%ebx),%eax
+  802b36:	39 c2                	cmp    %eax,%edx
+  802b38:	74 3c                	je     802b76 <ipcring_rsp_wait+0x50>
+  802b3a:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b3d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b40:	39 c2                	cmp    %eax,%edx
+  802b42:	75 23                	jne    802b67 <ipcring_rsp_wait+0x41>
+  802b44:	83 ec 08             	sub    $0x8,%esp
+  802b47:	6a 00                	push   $0x0
+  802b49:	6a 00                	push   $0x0
+  802b4b:	6a 00                	push   $0x0
+  802b4d:	6a 00                	push   $0x0
+  802b4f:	ff 73 0c             	push   0xc(%ebx)
+  802b52:	ff 73 04             	push   0x4(%ebx)
+  802b55:	e8 c7 03 00 00       	call   802f21 <ipc_call>
+  802b5a:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b5d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b60:	83 c4 20             	add    $0x20,%esp
+  802b63:	39 c2                	cmp    %eax,%edx
+  802b65:	74 dd                	je     802b44 <ipcring_rsp_wait+0x1e>
+  802b67:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b6a:	83 e0 07             	and    $0x7,%eax
+  802b6d:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802b71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b74:	c9                   	leave
+  802b75:	c3                   	ret
+  802b76:	68 b8 3b 80 00       	push   $0x803bb8
+  802b7b:	68 69 3b 80 00       	push   $0x803b69
+  802b80:	6a 3b                	push   $0x3b
+  802b82:	68 d9 3b 80 00       	push   $0x803bd9
+  802b87:	e8 97 02 00 00       	call   802e23 <_panic>
+
+00802b8c <ipcring_rsp_pop>:
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b92:	8b 42 18             	mov    0x18(%edx),%eax
+  802b95:	83 c0 01             	add    $0x1,%eax
+  802b98:	89 42 18             	mov    %eax,0x18(%edx)
+  802b9b:	5d                   	pop    %ebp
+  802b9c:	c3                   	ret
+
+00802b9d <ipcring_server_init>:
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ba6:	89 10                	mov    %edx,(%eax)
+  802ba8:	8b 55 10             	mov    0x10(%ebp),%edx
+  802bab:	89 50 04             	mov    %edx,0x4(%eax)
+  802bae:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802bb5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+
+00802bbe <ipcring_req_avail>:
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bc4:	8b 02                	mov    (%edx),%eax
+  802bc6:	8b 40 10             	mov    0x10(%eax),%eax
+  802bc9:	2b 42 08             	sub    0x8(%edx),%eax
+  802bcc:	ba 08 00 00 00       	mov    $0x8,%edx
+  802bd1:	39 d0                	cmp    %edx,%eax
+  802bd3:	0f 47 c2             	cmova  %edx,%eax
+  802bd6:	5d                   	pop    %ebp
+  802bd7:	c3                   	ret
+
+00802bd8 <ipcring_req_peek>:
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bde:	8b 42 08             	mov    0x8(%edx),%eax
+  802be1:	83 e0 07             	and    $0x7,%eax
+  802be4:	8b 12                	mov    (%edx),%edx
+  802be6:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802bea:	5d                   	pop    %ebp
+  802beb:	c3                   	ret
+
+00802bec <ipcring_rsp_push>:
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	83 ec 08             	sub    $0x8,%esp
+  802bf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bf5:	8b 41 08             	mov    0x8(%ecx),%eax
+  802bf8:	83 c0 01             	add    $0x1,%eax
+  802bfb:	89 41 08             	mov    %eax,0x8(%ecx)
+  802bfe:	8b 11                	mov    (%ecx),%edx
+  802c00:	83 c2 14             	add    $0x14,%edx
+  802c03:	f0 87 02             	lock xchg %eax,(%edx)
+  802c06:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802c0a:	75 02                	jne    802c0e <ipcring_rsp_push+0x22>
+  802c0c:	c9                   	leave
+  802c0d:	c3                   	ret
+  802c0e:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802c15:	6a 00                	push   $0x0
+  802c17:	68 00 00 80 ee       	push   $0xee800000
+  802c1c:	6a 00                	push   $0x0
+  802c1e:	ff 71 04             	push   0x4(%ecx)
+  802c21:	e8 8b e4 ff ff       	call   8010b1 <sys_ipc_try_send>
+  802c26:	83 c4 10             	add    $0x10,%esp
+  802c29:	eb e1                	jmp    802c0c <ipcring_rsp_push+0x20>
+
+00802c2b <ipcring_client_wait>:
+  802c2b:	55                   	push   %ebp
+  802c2c:	89 e5                	mov    %esp,%ebp
+  802c2e:	83 ec 08             	sub    $0x8,%esp
+  802c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c34:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802c3b:	8b 10                	mov    (%eax),%edx
+  802c3d:	8b 52 18             	mov    0x18(%edx),%edx
+  802c40:	3b 50 08             	cmp    0x8(%eax),%edx
+  802c43:	75 02                	jne    802c47 <ipcring_client_wait+0x1c>
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+  802c47:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802c4e:	6a 00                	push   $0x0
+  802c50:	68 00 00 80 ee       	push   $0xee800000
+  802c55:	6a 00                	push   $0x0
+  802c57:	ff 70 04             	push   0x4(%eax)
+  802c5a:	e8 52 e4 ff ff       	call   8010b1 <sys_ipc_try_send>
+  802c5f:	83 c4 10             	add    $0x10,%esp
+  802c62:	eb e1                	jmp    802c45 <ipcring_client_wait+0x1a>
+
+00802c64 <ipcring_server_sleep>:
+  802c64:	55                   	push   %ebp
+  802c65:	89 e5                	mov    %esp,%ebp
+  802c67:	53                   	push   %ebx
+  802c68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c6b:	8b 01                	mov    (%ecx),%eax
+  802c6d:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802c70:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c75:	f0 87 02             	lock xchg %eax,(%edx)
+  802c78:	8b 11                	mov    (%ecx),%edx
+  802c7a:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802c7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c82:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802c85:	74 0e                	je     802c95 <ipcring_server_sleep+0x31>
+  802c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8c:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+
+00802c9a <devcons_close>:
+  802c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c9f:	c3                   	ret
+
+00802ca0 <devcons_stat>:
+  802ca0:	55                   	push   %ebp
+  802ca1:	89 e5                	mov    %esp,%ebp
+  802ca3:	83 ec 10             	sub    $0x10,%esp
+  802ca6:	68 e7 3b 80 00       	push   $0x803be7
+  802cab:	ff 75 0c             	push   0xc(%ebp)
+  802cae:	e8 43 dd ff ff       	call   8009f6 <strcpy>
+  802cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb8:	c9                   	leave
+  802cb9:	c3                   	ret
+
+00802cba <devcons_write>:
+  802cba:	55                   	push   %ebp
+  802cbb:	89 e5                	mov    %esp,%ebp
+  802cbd:	57                   	push   %edi
+  802cbe:	56                   	push   %esi
+  802cbf:	53                   	push   %ebx
+  802cc0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802cc6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802cc9:	85 ff                	test   %edi,%edi
+  802ccb:	74 51                	je     802d1e <devcons_write+0x64>
+  802ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd7:	89 fb                	mov    %edi,%ebx
+  802cd9:	29 c3                	sub    %eax,%ebx
+  802cdb:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802ce0:	39 d3                	cmp    %edx,%ebx
+  802ce2:	0f 47 da             	cmova  %edx,%ebx
+  802ce5:	83 ec 04             	sub    $0x4,%esp
+  802ce8:	53                   	push   %ebx
+  802ce9:	03 45 0c             	add    0xc(%ebp),%eax
+  802cec:	50                   	push   %eax
+  802ced:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802cf3:	50                   	push   %eax
+  802cf4:	e8 ad de ff ff       	call   800ba6 <memmove>
+  802cf9:	83 c4 08             	add    $0x8,%esp
+  802cfc:	53                   	push   %ebx
+  802cfd:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d03:	50                   	push   %eax
+  802d04:	e8 65 e0 ff ff       	call   800d6e <sys_cputs>
+  802d09:	01 de                	add    %ebx,%esi
+  802d0b:	89 f0                	mov    %esi,%eax
+  802d0d:	83 c4 10             	add    $0x10,%esp
+  802d10:	39 fe                	cmp    %edi,%esi
+  802d12:	72 c3                	jb     802cd7 <devcons_write+0x1d>
+  802d14:	89 f0                	mov    %esi,%eax
+  802d16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d19:	5b                   	pop    %ebx
+  802d1a:	5e                   	pop    %esi
+  802d1b:	5f                   	pop    %edi
+  802d1c:	5d                   	pop    %ebp
+  802d1d:	c3                   	ret
+  802d1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d23:	eb ef                	jmp    802d14 <devcons_write+0x5a>
+
+00802d25 <devcons_read>:
+  802d25:	55                   	push   %ebp
+  802d26:	89 e5                	mov    %esp,%ebp
+  802d28:	83 ec 08             	sub    $0x8,%esp
+  802d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d30:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d34:	75 07                	jne    802d3d <devcons_read+0x18>
+  802d36:	eb 1f                	jmp    802d57 <devcons_read+0x32>
+  802d38:	e8 ce e0 ff ff       	call   800e0b <sys_yield>
+  802d3d:	e8 4a e0 ff ff       	call   800d8c <sys_cgetc>
+  802d42:	85 c0                	test   %eax,%eax
+  802d44:	74 f2                	je     802d38 <devcons_read+0x13>
+  802d46:	78 0f                	js     802d57 <devcons_read+0x32>
+  802d48:	83 f8 04             	cmp    $0x4,%eax
+  802d4b:	74 0c                	je     802d59 <devcons_read+0x34>
+  802d4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d50:	88 02                	mov    %al,(%edx)
+  802d52:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d57:	c9                   	leave
+  802d58:	c3                   	ret
+  802d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5e:	eb f7                	jmp    802d57 <devcons_read+0x32>
+
+00802d60 <cputchar>:
+  802d60:	55                   	push   %ebp
+  802d61:	89 e5                	mov    %esp,%ebp
+  802d63:	83 ec 20             	sub    $0x20,%esp
+  802d66:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d69:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802d6c:	6a 01                	push   $0x1
+  802d6e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d71:	50                   	push   %eax
+  802d72:	e8 f7 df ff ff       	call   800d6e <sys_cputs>
+  802d77:	83 c4 10             	add    $0x10,%esp
+  802d7a:	c9                   	leave
+  802d7b:	c3                   	ret
+
+00802d7c <getchar>:
+  802d7c:	55                   	push   %ebp
+  802d7d:	89 e5                	mov    %esp,%ebp
+  802d7f:	83 ec 1c             	sub    $0x1c,%esp
+  802d82:	6a 01                	push   $0x1
+  802d84:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d87:	50                   	push   %eax
+  802d88:	6a 00                	push   $0x0
+  802d8a:	e8 0e ec ff ff       	call   80199d <read>
+  802d8f:	83 c4 10             	add    $0x10,%esp
+  802d92:	85 c0                	test   %eax,%eax
+  802d94:	78 06                	js     802d9c <getchar+0x20>
+  802d96:	74 06                	je     802d9e <getchar+0x22>
+  802d98:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802d9c:	c9                   	leave
+  802d9d:	c3                   	ret
+  802d9e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802da3:	eb f7                	jmp    802d9c <getchar+0x20>
+
+00802da5 <iscons>:
+  802da5:	55                   	push   %ebp
+  802da6:	89 e5                	mov    %esp,%ebp
+  802da8:	83 ec 20             	sub    $0x20,%esp
+  802dab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dae:	50                   	push   %eax
+  802daf:	ff 75 08             	push   0x8(%ebp)
+  802db2:	e8 84 e9 ff ff       	call   80173b <fd_lookup>
+  802db7:	83 c4 10             	add    $0x10,%esp
+  802dba:	85 c0                	test   %eax,%eax
+  802dbc:	78 11                	js     802dcf <iscons+0x2a>
+  802dbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dc1:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802dc7:	39 10                	cmp    %edx,(%eax)
+  802dc9:	0f 94 c0             	sete   %al
+  802dcc:	0f b6 c0             	movzbl %al,%eax
+  802dcf:	c9                   	leave
+  802dd0:	c3                   	ret
+
+00802dd1 <opencons>:
+  802dd1:	55                   	push   %ebp
+  802dd2:	89 e5                	mov    %esp,%ebp
+  802dd4:	83 ec 24             	sub    $0x24,%esp
+  802dd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dda:	50                   	push   %eax
+  802ddb:	e8 0b e9 ff ff       	call   8016eb <fd_alloc>
+  802de0:	83 c4 10             	add    $0x10,%esp
+  802de3:	85 c0                	test   %eax,%eax
+  802de5:	78 3a                	js     802e21 <opencons+0x50>
+  802de7:	83 ec 04             	sub    $0x4,%esp
+  802dea:	68 07 04 00 00       	push   $0x407
+  802def:	ff 75 f4             	push   -0xc(%ebp)
+  802df2:	6a 00                	push   $0x0
+  802df4:	e8 5d e0 ff ff       	call   800e56 <sys_page_alloc>
+  802df9:	83 c4 10             	add    $0x10,%esp
+  802dfc:	85 c0                	test   %eax,%eax
+  802dfe:	78 21                	js     802e21 <opencons+0x50>
+  802e00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e03:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802e09:	89 10                	mov    %edx,(%eax)
+  802e0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e0e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802e15:	83 ec 0c             	sub    $0xc,%esp
+  802e18:	50                   	push   %eax
+  802e19:	e8 a6 e8 ff ff       	call   8016c4 <fd2num>
+  802e1e:	83 c4 10             	add    $0x10,%esp
+  802e21:	c9                   	leave
+  802e22:	c3                   	ret
+
+00802e23 <_panic>:
+  802e23:	55                   	push   %ebp
+  802e24:	89 e5                	mov    %esp,%ebp
+  802e26:	56                   	push   %esi
+  802e27:	53                   	push   %ebx
+  802e28:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802e2b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802e31:	e8 b6 df ff ff       	call   800dec <sys_getenvid>
+  802e36:	83 ec 0c             	sub    $0xc,%esp
+  802e39:	ff 75 0c             	push   0xc(%ebp)
+  802e3c:	ff 75 08             	push   0x8(%ebp)
+  802e3f:	56                   	push   %esi
+  802e40:	50                   	push   %eax
+  802e41:	68 f4 3b 80 00       	push   $0x803bf4
+  802e46:	e8 b4 d4 ff ff       	call   8002ff <cprintf>
+  802e4b:	83 c4 18             	add    $0x18,%esp
+  802e4e:	53                   	push   %ebx
+  802e4f:	ff 75 10             	push   0x10(%ebp)
+  802e52:	e8 57 d4 ff ff       	call   8002ae <vcprintf>
+  802e57:	c7 04 24 ae 3b 80 00 	movl   $0x803bae,(%esp)
+  802e5e:	e8 9c d4 ff ff       	call   8002ff <cprintf>
+  802e63:	83 c4 10             	add    $0x10,%esp
+  802e66:	cc                   	int3
+  802e67:	eb fd                	jmp    802e66 <_panic+0x43>
+
+00802e69 <ipc_recv>:
+  802e69:	55                   	push   %ebp
+  802e6a:	89 e5                	mov    %esp,%ebp
+  802e6c:	56                   	push   %esi
+  802e6d:	53                   	push   %ebx
+  802e6e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e77:	85 c0                	test   %eax,%eax
+  802e79:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802e7e:	0f 44 c2             	cmove  %edx,%eax
+  802e81:	83 ec 0c             	sub    $0xc,%esp
+  802e84:	50                   	push   %eax
+  802e85:	e8 77 e2 ff ff       	call   801101 <sys_ipc_recv>
+  802e8a:	83 c4 10             	add    $0x10,%esp
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	78 2a                	js     802ebb <ipc_recv+0x52>
+  802e91:	a1 20 50 80 00       	mov    0x805020,%eax
+  802e96:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802e9c:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802ea2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ea8:	85 f6                	test   %esi,%esi
+  802eaa:	74 02                	je     802eae <ipc_recv+0x45>
+  802eac:	89 0e                	mov    %ecx,(%esi)
+  802eae:	85 db                	test   %ebx,%ebx
+  802eb0:	74 02                	je     802eb4 <ipc_recv+0x4b>
+  802eb2:	89 13                	mov    %edx,(%ebx)
+  802eb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eb7:	5b                   	pop    %ebx
+  802eb8:	5e                   	pop    %esi
+  802eb9:	5d                   	pop    %ebp
+  802eba:	c3                   	ret
+  802ebb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ec0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ec5:	eb e1                	jmp    802ea8 <ipc_recv+0x3f>
+
+00802ec7 <ipc_send>:
+  802ec7:	55                   	push   %ebp
+  802ec8:	89 e5                	mov    %esp,%ebp
+  802eca:	57                   	push   %edi
+  802ecb:	56                   	push   %esi
+  802ecc:	53                   	push   %ebx
+  802ecd:	83 ec 0c             	sub    $0xc,%esp
+  802ed0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802ed3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ed6:	8b 75 14             	mov    0x14(%ebp),%esi
+  802ed9:	85 db                	test   %ebx,%ebx
+  802edb:	74 1e                	je     802efb <ipc_send+0x34>
+  802edd:	56                   	push   %esi
+  802ede:	53                   	push   %ebx
+  802edf:	57                   	push   %edi
+  802ee0:	ff 75 08             	push   0x8(%ebp)
+  802ee3:	e8 a6 e2 ff ff       	call   80118e <sys_ipc_send>
+  802ee8:	83 c4 10             	add    $0x10,%esp
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	74 2a                	je     802f19 <ipc_send+0x52>
+  802eef:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ef2:	75 13                	jne    802f07 <ipc_send+0x40>
+  802ef4:	e8 12 df ff ff       	call   800e0b <sys_yield>
+  802ef9:	eb e2                	jmp    802edd <ipc_send+0x16>
+  802efb:	be 00 00 00 00       	mov    $0x0,%esi
+  802f00:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f05:	eb d6                	jmp    802edd <ipc_send+0x16>
+  802f07:	50                   	push   %eax
+  802f08:	68 18 3c 80 00       	push   $0x803c18
+  802f0d:	6a 4f                	push   $0x4f
+  802f0f:	68 5b 3c 80 00       	push   $0x803c5b
+  802f14:	e8 0a ff ff ff       	call   802e23 <_panic>
+  802f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f1c:	5b                   	pop    %ebx
+  802f1d:	5e                   	pop    %esi
+  802f1e:	5f                   	pop    %edi
+  802f1f:	5d                   	pop    %ebp
+  802f20:	c3                   	ret
+
+00802f21 <ipc_call>:
+  802f21:	55                   	push   %ebp
+  802f22:	89 e5                	mov    %esp,%ebp
+  802f24:	57                   	push   %edi
+  802f25:	56                   	push   %esi
+  802f26:	53                   	push   %ebx
+  802f27:	83 ec 0c             	sub    $0xc,%esp
+  802f2a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f2e:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802f33:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802f37:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f3b:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802f40:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802f44:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f4d:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802f51:	eb 05                	jmp    802f58 <ipc_call+0x37>
+  802f53:	e8 b3 de ff ff       	call   800e0b <sys_yield>
+  802f58:	83 ec 0c             	sub    $0xc,%esp
+  802f5b:	56                   	push   %esi
+  802f5c:	53                   	push   %ebx
+  802f5d:	57                   	push   %edi
+  802f5e:	ff 75 0c             	push   0xc(%ebp)
+  802f61:	ff 75 08             	push   0x8(%ebp)
+  802f64:	e8 75 e2 ff ff       	call   8011de <sys_ipc_call>
+  802f69:	83 c4 20             	add    $0x20,%esp
+  802f6c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f6f:	74 e2                	je     802f53 <ipc_call+0x32>
+  802f71:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802f74:	74 2d                	je     802fa3 <ipc_call+0x82>
+  802f76:	85 c0                	test   %eax,%eax
+  802f78:	78 4f                	js     802fc9 <ipc_call+0xa8>
+  802f7a:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802f7e:	74 10                	je     802f90 <ipc_call+0x6f>
+  802f80:	a1 20 50 80 00       	mov    0x805020,%eax
+  802f85:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f8b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802f8e:	89 02                	mov    %eax,(%edx)
+  802f90:	a1 20 50 80 00       	mov    0x805020,%eax
+  802f95:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9e:	5b                   	pop    %ebx
+  802f9f:	5e                   	pop    %esi
+  802fa0:	5f                   	pop    %edi
+  802fa1:	5d                   	pop    %ebp
+  802fa2:	c3                   	ret
+  802fa3:	ff 75 14             	push   0x14(%ebp)
+  802fa6:	ff 75 10             	push   0x10(%ebp)
+  802fa9:	ff 75 0c             	push   0xc(%ebp)
+  802fac:	ff 75 08             	push   0x8(%ebp)
+  802faf:	e8 13 ff ff ff       	call   802ec7 <ipc_send>
+  802fb4:	83 c4 0c             	add    $0xc,%esp
+  802fb7:	ff 75 1c             	push   0x1c(%ebp)
+  802fba:	ff 75 18             	push   0x18(%ebp)
+  802fbd:	6a 00                	push   $0x0
+  802fbf:	e8 a5 fe ff ff       	call   802e69 <ipc_recv>
+  802fc4:	83 c4 10             	add    $0x10,%esp
+  802fc7:	eb d2                	jmp    802f9b <ipc_call+0x7a>
+  802fc9:	50                   	push   %eax
+  802fca:	68 65 3c 80 00       	push   $0x803c65
+  802fcf:	6a 6d                	push   $0x6d
+  802fd1:	68 5b 3c 80 00       	push   $0x803c5b
+  802fd6:	e8 48 fe ff ff       	call   802e23 <_panic>
+
+00802fdb <ipc_reply_recv>:
+  802fdb:	55                   	push   %ebp
+  802fdc:	89 e5                	mov    %esp,%ebp
+  802fde:	57                   	push   %edi
+  802fdf:	56                   	push   %esi
+  802fe0:	53                   	push   %ebx
+  802fe1:	83 ec 0c             	sub    $0xc,%esp
+  802fe4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fe7:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802fea:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802fed:	85 db                	test   %ebx,%ebx
+  802fef:	0f 84 ac 00 00 00    	je     8030a1 <ipc_reply_recv+0xc6>
+  802ff5:	85 f6                	test   %esi,%esi
+  802ff7:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802ffc:	0f 45 c6             	cmovne %esi,%eax
+  802fff:	83 ec 0c             	sub    $0xc,%esp
+  803002:	50                   	push   %eax
+  803003:	ff 75 14             	push   0x14(%ebp)
+  803006:	53                   	push   %ebx
+  803007:	ff 75 0c             	push   0xc(%ebp)
+  80300a:	ff 75 08             	push   0x8(%ebp)
+  80300d:	e8 ed e1 ff ff       	call   8011ff <sys_ipc_reply_recv>
+  803012:	83 c4 20             	add    $0x20,%esp
+  803015:	85 c0                	test   %eax,%eax
+  803017:	78 3a                	js     803053 <ipc_reply_recv+0x78>
+  803019:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80301d:	74 10                	je     80302f <ipc_reply_recv+0x54>
+  80301f:	a1 20 50 80 00       	mov    0x805020,%eax
+  803024:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  80302a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80302d:	89 02                	mov    %eax,(%edx)
+  80302f:	85 ff                	test   %edi,%edi
+  803031:	74 0d                	je     803040 <ipc_reply_recv+0x65>
+  803033:	a1 20 50 80 00       	mov    0x805020,%eax
+  803038:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80303e:	89 07                	mov    %eax,(%edi)
+  803040:	a1 20 50 80 00       	mov    0x805020,%eax
+  803045:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80304b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80304e:	5b                   	pop    %ebx
+  80304f:	5e                   	pop    %esi
+  803050:	5f                   	pop    %edi
+  803051:	5d                   	pop    %ebp
+  803052:	c3                   	ret
+  803053:	ff 75 14             	push   0x14(%ebp)
+  803056:	53                   	push   %ebx
+  803057:	ff 75 0c             	push   0xc(%ebp)
+  80305a:	ff 75 08             	push   0x8(%ebp)
+  80305d:	e8 4f e0 ff ff       	call   8010b1 <sys_ipc_try_send>
+  803062:	89 c2                	mov    %eax,%edx
+  803064:	c1 ea 1f             	shr    $0x1f,%edx
+  803067:	83 c4 10             	add    $0x10,%esp
+  80306a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80306d:	0f 95 c1             	setne  %cl
+  803070:	84 d1                	test   %dl,%cl
+  803072:	74 05                	je     803079 <ipc_reply_recv+0x9e>
+  803074:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803077:	75 12                	jne    80308b <ipc_reply_recv+0xb0>
+  803079:	83 ec 04             	sub    $0x4,%esp
+  80307c:	57                   	push   %edi
+  80307d:	56                   	push   %esi
+  80307e:	ff 75 18             	push   0x18(%ebp)
+  803081:	e8 e3 fd ff ff       	call   802e69 <ipc_recv>
+  803086:	83 c4 10             	add    $0x10,%esp
+  803089:	eb c0                	jmp    80304b <ipc_reply_recv+0x70>
+  80308b:	83 ec 04             	sub    $0x4,%esp
+  80308e:	50                   	push   %eax
+  80308f:	ff 75 08             	push   0x8(%ebp)
+  803092:	68 38 3c 80 00       	push   $0x803c38
+  803097:	e8 63 d2 ff ff       	call   8002ff <cprintf>
+  80309c:	83 c4 10             	add    $0x10,%esp
+  80309f:	eb d8                	jmp    803079 <ipc_reply_recv+0x9e>
+  8030a1:	85 f6                	test   %esi,%esi
+  8030a3:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8030a8:	0f 45 c6             	cmovne %esi,%eax
+  8030ab:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8030b0:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8030b7:	e9 43 ff ff ff       	jmp    802fff <ipc_reply_recv+0x24>
+
+008030bc <ipc_find_env>:
+  8030bc:	55                   	push   %ebp
+  8030bd:	89 e5                	mov    %esp,%ebp
+  8030bf:	83 ec 14             	sub    $0x14,%esp
+  8030c2:	ff 75 08             	push   0x8(%ebp)
+  8030c5:	e8 85 df ff ff       	call   80104f <sys_env_service>
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d1:	0f 48 c2             	cmovs  %edx,%eax
+  8030d4:	c9                   	leave
+  8030d5:	c3                   	ret
+
+008030d6 <pageref>:
+  8030d6:	55                   	push   %ebp
+  8030d7:	89 e5                	mov    %esp,%ebp
+  8030d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030dc:	89 c2                	mov    %eax,%edx
+  8030de:	c1 ea 16             	shr    $0x16,%edx
+  8030e1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8030e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030ed:	f6 c1 01             	test   $0x1,%cl
+  8030f0:	74 22                	je     803114 <pageref+0x3e>
+  8030f2:	c1 e8 0c             	shr    $0xc,%eax
+  8030f5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030fc:	a8 01                	test   $0x1,%al
+  8030fe:	74 14                	je     803114 <pageref+0x3e>
+  803100:	c1 e8 0c             	shr    $0xc,%eax
+  803103:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803106:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80310d:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803111:	0f b7 d2             	movzwl %dx,%edx
+  803114:	89 d0                	mov    %edx,%eax
+  803116:	5d                   	pop    %ebp
+  803117:	c3                   	ret
+
+00803118 <inet_ntoa>:
+  803118:	55                   	push   %ebp
+  803119:	89 e5                	mov    %esp,%ebp
+  80311b:	57                   	push   %edi
+  80311c:	56                   	push   %esi
+  80311d:	53                   	push   %ebx
+  80311e:	83 ec 1c             	sub    $0x1c,%esp
+  803121:	8b 45 08             	mov    0x8(%ebp),%eax
+  803124:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  803127:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  80312a:	bf 10 50 80 00       	mov    $0x805010,%edi
+  80312f:	0f b6 16             	movzbl (%esi),%edx
+  803132:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803137:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80313a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80313d:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803142:	f6 e2                	mul    %dl
+  803144:	66 c1 e8 0b          	shr    $0xb,%ax
+  803148:	89 c7                	mov    %eax,%edi
+  80314a:	88 45 e0             	mov    %al,-0x20(%ebp)
+  80314d:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803150:	01 db                	add    %ebx,%ebx
+  803152:	89 d0                	mov    %edx,%eax
+  803154:	29 d8                	sub    %ebx,%eax
+  803156:	89 d6                	mov    %edx,%esi
+  803158:	89 fa                	mov    %edi,%edx
+  80315a:	89 cb                	mov    %ecx,%ebx
+  80315c:	83 c1 01             	add    $0x1,%ecx
+  80315f:	0f b6 fb             	movzbl %bl,%edi
+  803162:	83 c0 30             	add    $0x30,%eax
+  803165:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+  803169:	89 f0                	mov    %esi,%eax
+  80316b:	3c 09                	cmp    $0x9,%al
+  80316d:	77 ce                	ja     80313d <inet_ntoa+0x25>
+  80316f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803172:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803175:	88 16                	mov    %dl,(%esi)
+  803177:	84 c9                	test   %cl,%cl
+  803179:	74 4d                	je     8031c8 <inet_ntoa+0xb0>
+  80317b:	0f b6 db             	movzbl %bl,%ebx
+  80317e:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803181:	01 d8                	add    %ebx,%eax
+  803183:	89 f9                	mov    %edi,%ecx
+  803185:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803188:	83 c1 01             	add    $0x1,%ecx
+  80318b:	0f b6 10             	movzbl (%eax),%edx
+  80318e:	88 51 ff             	mov    %dl,-0x1(%ecx)
+  803191:	89 c2                	mov    %eax,%edx
+  803193:	83 e8 01             	sub    $0x1,%eax
+  803196:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803199:	39 da                	cmp    %ebx,%edx
+  80319b:	75 eb                	jne    803188 <inet_ntoa+0x70>
+  80319d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8031a0:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  8031a4:	8d 78 01             	lea    0x1(%eax),%edi
+  8031a7:	c6 00 2e             	movb   $0x2e,(%eax)
+  8031aa:	83 c6 01             	add    $0x1,%esi
+  8031ad:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8031b0:	39 ce                	cmp    %ecx,%esi
+  8031b2:	0f 85 77 ff ff ff    	jne    80312f <inet_ntoa+0x17>
+  8031b8:	c6 00 00             	movb   $0x0,(%eax)
+  8031bb:	b8 10 50 80 00       	mov    $0x805010,%eax
+  8031c0:	83 c4 1c             	add    $0x1c,%esp
+  8031c3:	5b                   	pop    %ebx
+  8031c4:	5e                   	pop    %esi
+  8031c5:	5f                   	pop    %edi
+  8031c6:	5d                   	pop    %ebp
+  8031c7:	c3                   	ret
+  8031c8:	89 f8                	mov    %edi,%eax
+  8031ca:	eb d8                	jmp    8031a4 <inet_ntoa+0x8c>
+
+008031cc <htons>:
+  8031cc:	55                   	push   %ebp
+  8031cd:	89 e5                	mov    %esp,%ebp
+  8031cf:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8031d3:	66 c1 c0 08          	rol    $0x8,%ax
+  8031d7:	5d                   	pop    %ebp
+  8031d8:	c3                   	ret
+
+008031d9 <ntohs>:
+  8031d9:	55                   	push   %ebp
+  8031da:	89 e5                	mov    %esp,%ebp
+  8031dc:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8031e0:	66 c1 c0 08          	rol    $0x8,%ax
+  8031e4:	5d                   	pop    %ebp
+  8031e5:	c3                   	ret
+
+008031e6 <htonl>:
+  8031e6:	55                   	push   %ebp
+  8031e7:	89 e5                	mov    %esp,%ebp
+  8031e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031ec:	89 d0                	mov    %edx,%eax
+  8031ee:	c1 e0 18             	shl    $0x18,%eax
+  8031f1:	89 d1                	mov    %edx,%ecx
+  8031f3:	c1 e9 18             	shr    $0x18,%ecx
+  8031f6:	09 c8                	or     %ecx,%eax
+  8031f8:	89 d1                	mov    %edx,%ecx
+  8031fa:	c1 e1 08             	shl    $0x8,%ecx
+  8031fd:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+  803203:	09 c8                	or     %ecx,%eax
+  803205:	c1 ea 08             	shr    $0x8,%edx
+  803208:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  80320e:	09 d0                	or     %edx,%eax
+  803210:	5d                   	pop    %ebp
+  803211:	c3                   	ret
+
+00803212 <inet_aton>:
+  803212:	55                   	push   %ebp
+  803213:	89 e5                	mov    %esp,%ebp
+  803215:	57                   	push   %edi
+  803216:	56                   	push   %esi
+  803217:	53                   	push   %ebx
+  803218:	83 ec 2c             	sub    $0x2c,%esp
+  80321b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80321e:	0f b6 0a             	movzbl (%edx),%ecx
+  803221:	0f be c1             	movsbl %cl,%eax
+  803224:	83 e9 30             	sub    $0x30,%ecx
+  803227:	80 f9 09             	cmp    $0x9,%cl
+  80322a:	0f 87 b6 01 00 00    	ja     8033e6 <inet_aton+0x1d4>
+  803230:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  803233:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803236:	e9 aa 00 00 00       	jmp    8032e5 <inet_aton+0xd3>
+  80323b:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  80323f:	89 c1                	mov    %eax,%ecx
+  803241:	83 e1 df             	and    $0xffffffdf,%ecx
+  803244:	80 f9 58             	cmp    $0x58,%cl
+  803247:	74 10                	je     803259 <inet_aton+0x47>
+  803249:	83 c2 01             	add    $0x1,%edx
+  80324c:	0f be c0             	movsbl %al,%eax
+  80324f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803254:	e9 9a 00 00 00       	jmp    8032f3 <inet_aton+0xe1>
+  803259:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  80325d:	8d 52 02             	lea    0x2(%edx),%edx
+  803260:	bf 10 00 00 00       	mov    $0x10,%edi
+  803265:	e9 89 00 00 00       	jmp    8032f3 <inet_aton+0xe1>
+  80326a:	0f af d7             	imul   %edi,%edx
+  80326d:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  803271:	0f be 01             	movsbl (%ecx),%eax
+  803274:	83 c1 01             	add    $0x1,%ecx
+  803277:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80327a:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  80327d:	80 fb 09             	cmp    $0x9,%bl
+  803280:	76 e8                	jbe    80326a <inet_aton+0x58>
+  803282:	83 ff 10             	cmp    $0x10,%edi
+  803285:	75 2e                	jne    8032b5 <inet_aton+0xa3>
+  803287:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80328b:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80328e:	83 e3 df             	and    $0xffffffdf,%ebx
+  803291:	83 eb 41             	sub    $0x41,%ebx
+  803294:	80 fb 05             	cmp    $0x5,%bl
+  803297:	77 1c                	ja     8032b5 <inet_aton+0xa3>
+  803299:	c1 e2 04             	shl    $0x4,%edx
+  80329c:	83 c0 0a             	add    $0xa,%eax
+  80329f:	89 f3                	mov    %esi,%ebx
+  8032a1:	80 fb 1a             	cmp    $0x1a,%bl
+  8032a4:	19 db                	sbb    %ebx,%ebx
+  8032a6:	83 e3 20             	and    $0x20,%ebx
+  8032a9:	83 c3 41             	add    $0x41,%ebx
+  8032ac:	29 d8                	sub    %ebx,%eax
+  8032ae:	09 c2                	or     %eax,%edx
+  8032b0:	0f be 01             	movsbl (%ecx),%eax
+  8032b3:	eb bf                	jmp    803274 <inet_aton+0x62>
+  8032b5:	83 f8 2e             	cmp    $0x2e,%eax
+  8032b8:	75 46                	jne    803300 <inet_aton+0xee>
+  8032ba:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8032bd:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8032c0:	39 f0                	cmp    %esi,%eax
+  8032c2:	0f 84 25 01 00 00    	je     8033ed <inet_aton+0x1db>
+  8032c8:	83 c0 04             	add    $0x4,%eax
+  8032cb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8032ce:	89 50 fc             	mov    %edx,-0x4(%eax)
+  8032d1:	89 ca                	mov    %ecx,%edx
+  8032d3:	0f b6 09             	movzbl (%ecx),%ecx
+  8032d6:	0f be c1             	movsbl %cl,%eax
+  8032d9:	83 e9 30             	sub    $0x30,%ecx
+  8032dc:	80 f9 09             	cmp    $0x9,%cl
+  8032df:	0f 87 17 01 00 00    	ja     8033fc <inet_aton+0x1ea>
+  8032e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8032ea:	83 f8 30             	cmp    $0x30,%eax
+  8032ed:	0f 84 48 ff ff ff    	je     80323b <inet_aton+0x29>
+  8032f3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8032f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032fb:	e9 77 ff ff ff       	jmp    803277 <inet_aton+0x65>
+  803300:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803304:	89 d6                	mov    %edx,%esi
+  803306:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803309:	85 c0                	test   %eax,%eax
+  80330b:	74 2e                	je     80333b <inet_aton+0x129>
+  80330d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803312:	89 fa                	mov    %edi,%edx
+  803314:	80 fa 1f             	cmp    $0x1f,%dl
+  803317:	0f 86 d5 00 00 00    	jbe    8033f2 <inet_aton+0x1e0>
+  80331d:	84 c0                	test   %al,%al
+  80331f:	0f 88 cd 00 00 00    	js     8033f2 <inet_aton+0x1e0>
+  803325:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803328:	83 f9 04             	cmp    $0x4,%ecx
+  80332b:	76 0e                	jbe    80333b <inet_aton+0x129>
+  80332d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803332:	83 f8 20             	cmp    $0x20,%eax
+  803335:	0f 85 b7 00 00 00    	jne    8033f2 <inet_aton+0x1e0>
+  80333b:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  80333e:	89 d8                	mov    %ebx,%eax
+  803340:	29 c8                	sub    %ecx,%eax
+  803342:	c1 f8 02             	sar    $0x2,%eax
+  803345:	8d 48 01             	lea    0x1(%eax),%ecx
+  803348:	83 f8 02             	cmp    $0x2,%eax
+  80334b:	74 7a                	je     8033c7 <inet_aton+0x1b5>
+  80334d:	83 f9 03             	cmp    $0x3,%ecx
+  803350:	7f 49                	jg     80339b <inet_aton+0x189>
+  803352:	85 c9                	test   %ecx,%ecx
+  803354:	0f 84 98 00 00 00    	je     8033f2 <inet_aton+0x1e0>
+  80335a:	83 f9 02             	cmp    $0x2,%ecx
+  80335d:	75 19                	jne    803378 <inet_aton+0x166>
+  80335f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803364:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80336a:	0f 87 82 00 00 00    	ja     8033f2 <inet_aton+0x1e0>
+  803370:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803373:	c1 e0 18             	shl    $0x18,%eax
+  803376:	09 c6                	or     %eax,%esi
+  803378:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80337d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803381:	74 6f                	je     8033f2 <inet_aton+0x1e0>
+  803383:	83 ec 0c             	sub    $0xc,%esp
+  803386:	56                   	push   %esi
+  803387:	e8 5a fe ff ff       	call   8031e6 <htonl>
+  80338c:	83 c4 10             	add    $0x10,%esp
+  80338f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803392:	89 06                	mov    %eax,(%esi)
+  803394:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803399:	eb 57                	jmp    8033f2 <inet_aton+0x1e0>
+  80339b:	83 f9 04             	cmp    $0x4,%ecx
+  80339e:	75 d8                	jne    803378 <inet_aton+0x166>
+  8033a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033a5:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  8033ab:	77 45                	ja     8033f2 <inet_aton+0x1e0>
+  8033ad:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8033b0:	c1 e0 18             	shl    $0x18,%eax
+  8033b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8033b6:	c1 e1 10             	shl    $0x10,%ecx
+  8033b9:	09 c8                	or     %ecx,%eax
+  8033bb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8033be:	c1 e1 08             	shl    $0x8,%ecx
+  8033c1:	09 c8                	or     %ecx,%eax
+  8033c3:	09 c6                	or     %eax,%esi
+  8033c5:	eb b1                	jmp    803378 <inet_aton+0x166>
+  8033c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033cc:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8033d2:	77 1e                	ja     8033f2 <inet_aton+0x1e0>
+  8033d4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8033d7:	c1 e0 18             	shl    $0x18,%eax
+  8033da:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8033dd:	c1 e1 10             	shl    $0x10,%ecx
+  8033e0:	09 c8                	or     %ecx,%eax
+  8033e2:	09 c6                	or     %eax,%esi
+  8033e4:	eb 92                	jmp    803378 <inet_aton+0x166>
+  8033e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033eb:	eb 05                	jmp    8033f2 <inet_aton+0x1e0>
+  8033ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033f2:	89 c8                	mov    %ecx,%eax
+  8033f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f7:	5b                   	pop    %ebx
+  8033f8:	5e                   	pop    %esi
+  8033f9:	5f                   	pop    %edi
+  8033fa:	5d                   	pop    %ebp
+  8033fb:	c3                   	ret
+  8033fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803401:	eb ef                	jmp    8033f2 <inet_aton+0x1e0>
+
+00803403 <inet_addr>:
+  803403:	55                   	push   %ebp
+  803404:	89 e5                	mov    %esp,%ebp
+  803406:	83 ec 20             	sub    $0x20,%esp
+  803409:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80340c:	50                   	push   %eax
+  80340d:	ff 75 08             	push   0x8(%ebp)
+  803410:	e8 fd fd ff ff       	call   803212 <inet_aton>
+  803415:	89 c2                	mov    %eax,%edx
+  803417:	83 c4 10             	add    $0x10,%esp
+  80341a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80341f:	85 d2                	test   %edx,%edx
+  803421:	75 02                	jne    803425 <inet_addr+0x22>
+  803423:	c9                   	leave
+  803424:	c3                   	ret
+  803425:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803428:	eb f9                	jmp    803423 <inet_addr+0x20>
+
+0080342a <ntohl>:
+  80342a:	55                   	push   %ebp
+  80342b:	89 e5                	mov    %esp,%ebp
+  80342d:	83 ec 14             	sub    $0x14,%esp
+  803430:	ff 75 08             	push   0x8(%ebp)
+  803433:	e8 ae fd ff ff       	call   8031e6 <htonl>
+  803438:	83 c4 10             	add    $0x10,%esp
+  80343b:	c9                   	leave
+  80343c:	c3                   	ret
+
+0080343d <__udivmoddi4>:
+  80343d:	55                   	push   %ebp
+  80343e:	57                   	push   %edi
+  80343f:	56                   	push   %esi
+  803440:	53                   	push   %ebx
+  803441:	83 ec 24             	sub    $0x24,%esp
+  803444:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803448:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80344c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803450:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803454:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803458:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80345c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803460:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803464:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803472:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803477:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80347e:	00 
+  80347f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803486:	00 
+  803487:	89 fb                	mov    %edi,%ebx
+  803489:	eb 08                	jmp    803493 <__udivmoddi4+0x56>
+  80348b:	83 e9 01             	sub    $0x1,%ecx
+  80348e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803491:	74 68                	je     8034fb <__udivmoddi4+0xbe>
+  803493:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803497:	01 c0                	add    %eax,%eax
+  803499:	89 c6                	mov    %eax,%esi
+  80349b:	89 d7                	mov    %edx,%edi
+  80349d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8034a1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8034a5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8034a8:	d3 ea                	shr    %cl,%edx
+  8034aa:	f6 c1 20             	test   $0x20,%cl
+  8034ad:	74 04                	je     8034b3 <__udivmoddi4+0x76>
+  8034af:	89 d0                	mov    %edx,%eax
+  8034b1:	31 d2                	xor    %edx,%edx
+  8034b3:	83 e0 01             	and    $0x1,%eax
+  8034b6:	89 04 24             	mov    %eax,(%esp)
+  8034b9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8034c0:	00 
+  8034c1:	8b 04 24             	mov    (%esp),%eax
+  8034c4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8034c8:	09 f0                	or     %esi,%eax
+  8034ca:	09 fa                	or     %edi,%edx
+  8034cc:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8034d0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8034d4:	39 f0                	cmp    %esi,%eax
+  8034d6:	89 d5                	mov    %edx,%ebp
+  8034d8:	19 fd                	sbb    %edi,%ebp
+  8034da:	72 af                	jb     80348b <__udivmoddi4+0x4e>
+  8034dc:	29 f0                	sub    %esi,%eax
+  8034de:	19 fa                	sbb    %edi,%edx
+  8034e0:	89 cf                	mov    %ecx,%edi
+  8034e2:	c1 ef 05             	shr    $0x5,%edi
+  8034e5:	83 e7 01             	and    $0x1,%edi
+  8034e8:	89 fe                	mov    %edi,%esi
+  8034ea:	83 f6 01             	xor    $0x1,%esi
+  8034ed:	d3 e6                	shl    %cl,%esi
+  8034ef:	d3 e7                	shl    %cl,%edi
+  8034f1:	09 74 24 18          	or     %esi,0x18(%esp)
+  8034f5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8034f9:	eb 90                	jmp    80348b <__udivmoddi4+0x4e>
+  8034fb:	85 db                	test   %ebx,%ebx
+  8034fd:	74 05                	je     803504 <__udivmoddi4+0xc7>
+  8034ff:	89 03                	mov    %eax,(%ebx)
+  803501:	89 53 04             	mov    %edx,0x4(%ebx)
+  803504:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803508:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80350c:	83 c4 24             	add    $0x24,%esp
+  80350f:	5b                   	pop    %ebx
+  803510:	5e                   	pop    %esi
+  803511:	5f                   	pop    %edi
+  803512:	5d                   	pop    %ebp
+  803513:	c3                   	ret
+
+00803514 <__udivdi3>:
+  803514:	83 ec 08             	sub    $0x8,%esp
+  803517:	6a 00                	push   $0x0
+  803519:	ff 74 24 1c          	push   0x1c(%esp)
+  80351d:	ff 74 24 1c          	push   0x1c(%esp)
+  803521:	ff 74 24 1c          	push   0x1c(%esp)
+  803525:	ff 74 24 1c          	push   0x1c(%esp)
+  803529:	e8 0f ff ff ff       	call   80343d <__udivmoddi4>
+  80352e:	83 c4 1c             	add    $0x1c,%esp
+  803531:	c3                   	ret
+
+00803532 <__umoddi3>:
+  803532:	83 ec 18             	sub    $0x18,%esp
+  803535:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803539:	50                   	push   %eax
+  80353a:	ff 74 24 2c          	push   0x2c(%esp)
+  80353e:	ff 74 24 2c          	push   0x2c(%esp)
+  803542:	ff 74 24 2c          	push   0x2c(%esp)
+  803546:	ff 74 24 2c          	push   0x2c(%esp)
+  80354a:	e8 ee fe ff ff       	call   80343d <__udivmoddi4>
+  80354f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803553:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803557:	83 c4 2c             	add    $0x2c,%esp
+  80355a:	c3                   	ret
+
+0080355b <__divdi3>:
+  80355b:	53                   	push   %ebx
+  80355c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803560:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803564:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803568:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80356c:	85 d2                	test   %edx,%edx
+  80356e:	78 12                	js     803582 <__divdi3+0x27>
+  803570:	85 db                	test   %ebx,%ebx
+  803572:	78 2e                	js     8035a2 <__divdi3+0x47>
+  803574:	53                   	push   %ebx
+  803575:	51                   	push   %ecx
+  803576:	52                   	push   %edx
+  803577:	50                   	push   %eax
+  803578:	e8 97 ff ff ff       	call   803514 <__udivdi3>
+  80357d:	83 c4 10             	add    $0x10,%esp
+  803580:	eb 1e                	jmp    8035a0 <__divdi3+0x45>
+  803582:	f7 d8                	neg    %eax
+  803584:	83 d2 00             	adc    $0x0,%edx
+  803587:	f7 da                	neg    %edx
+  803589:	85 db                	test   %ebx,%ebx
+  80358b:	78 2a                	js     8035b7 <__divdi3+0x5c>
+  80358d:	53                   	push   %ebx
+  80358e:	51                   	push   %ecx
+  80358f:	52                   	push   %edx
+  803590:	50                   	push   %eax
+  803591:	e8 7e ff ff ff       	call   803514 <__udivdi3>
+  803596:	83 c4 10             	add    $0x10,%esp
+  803599:	f7 d8                	neg    %eax
+  80359b:	83 d2 00             	adc    $0x0,%edx
+  80359e:	f7 da                	neg    %edx
+  8035a0:	5b                   	pop    %ebx
+  8035a1:	c3                   	ret
+  8035a2:	f7 d9                	neg    %ecx
+  8035a4:	83 d3 00             	adc    $0x0,%ebx
+  8035a7:	f7 db                	neg    %ebx
+  8035a9:	53                   	push   %ebx
+  8035aa:	51                   	push   %ecx
+  8035ab:	52                   	push   %edx
+  8035ac:	50                   	push   %eax
+  8035ad:	e8 62 ff ff ff       	call   803514 <__udivdi3>
+  8035b2:	83 c4 10             	add    $0x10,%esp
+  8035b5:	eb e2                	jmp    803599 <__divdi3+0x3e>
+  8035b7:	f7 d9                	neg    %ecx
+  8035b9:	83 d3 00             	adc    $0x0,%ebx
+  8035bc:	f7 db                	neg    %ebx
+  8035be:	53                   	push   %ebx
+  8035bf:	51                   	push   %ecx
+  8035c0:	52                   	push   %edx
+  8035c1:	50                   	push   %eax
+  8035c2:	e8 4d ff ff ff       	call   803514 <__udivdi3>
+  8035c7:	83 c4 10             	add    $0x10,%esp
+  8035ca:	eb d4                	jmp    8035a0 <__divdi3+0x45>
+
+008035cc <__moddi3>:
+  8035cc:	55                   	push   %ebp
+  8035cd:	57                   	push   %edi
+  8035ce:	56                   	push   %esi
+  8035cf:	53                   	push   %ebx
+  8035d0:	83 ec 0c             	sub    $0xc,%esp
+  8035d3:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8035d7:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8035db:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8035df:	89 e9                	mov    %ebp,%ecx
+  8035e1:	f7 d9                	neg    %ecx
+  8035e3:	89 d0                	mov    %edx,%eax
+  8035e5:	83 d0 00             	adc    $0x0,%eax
+  8035e8:	f7 d8                	neg    %eax
+  8035ea:	0f 49 e9             	cmovns %ecx,%ebp
+  8035ed:	0f 49 d0             	cmovns %eax,%edx
+  8035f0:	52                   	push   %edx
+  8035f1:	55                   	push   %ebp
+  8035f2:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8035f6:	f7 da                	neg    %edx
+  8035f8:	89 d8                	mov    %ebx,%eax
+  8035fa:	83 d0 00             	adc    $0x0,%eax
+  8035fd:	f7 d8                	neg    %eax
+  8035ff:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803604:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803608:	0f 48 c3             	cmovs  %ebx,%eax
+  80360b:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80360f:	ff 74 24 0c          	push   0xc(%esp)
+  803613:	ff 74 24 0c          	push   0xc(%esp)
+  803617:	e8 16 ff ff ff       	call   803532 <__umoddi3>
+  80361c:	83 c4 10             	add    $0x10,%esp
+  80361f:	85 db                	test   %ebx,%ebx
+  803621:	78 08                	js     80362b <__moddi3+0x5f>
+  803623:	83 c4 0c             	add    $0xc,%esp
+  803626:	5b                   	pop    %ebx
+  803627:	5e                   	pop    %esi
+  803628:	5f                   	pop    %edi
+  803629:	5d                   	pop    %ebp
+  80362a:	c3                   	ret
+  80362b:	f7 d8                	neg    %eax
+  80362d:	83 d2 00             	adc    $0x0,%edx
+  803630:	f7 da                	neg    %edx
+  803632:	eb ef                	jmp    803623 <__moddi3+0x57>
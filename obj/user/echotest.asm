@@ -0,0 +1,5457 @@
+
+obj/user/echotest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 ac 01 00 00       	call   8001dd <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	50                   	push   %eax
+  80003a:	68 20 36 80 00       	push   $0x803620
+  80003f:	e8 a7 02 00 00       	call   8002eb <cprintf>
+  800044:	e8 dd 01 00 00       	call   800226 <exit>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <umain>:
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 58             	sub    $0x58,%esp
+  800057:	68 24 36 80 00       	push   $0x803624
+  80005c:	e8 8a 02 00 00       	call   8002eb <cprintf>
+  800061:	c7 04 24 34 36 80 00 	movl   $0x803634,(%esp)
+  800068:	e8 82 33 00 00       	call   8033ef <inet_addr>
+  80006d:	83 c4 0c             	add    $0xc,%esp
+  800070:	50                   	push   %eax
+  800071:	68 34 36 80 00       	push   $0x803634
+  800076:	68 3e 36 80 00       	push   $0x80363e
+  80007b:	e8 6b 02 00 00       	call   8002eb <cprintf>
+  800080:	83 c4 0c             	add    $0xc,%esp
+  800083:	6a 06                	push   $0x6
+  800085:	6a 01                	push   $0x1
+  800087:	6a 02                	push   $0x2
+  800089:	e8 14 24 00 00       	call   8024a2 <socket>
+  80008e:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	0f 88 ba 00 00 00    	js     800156 <umain+0x108>
+  80009c:	83 ec 0c             	sub    $0xc,%esp
+  80009f:	68 6b 36 80 00       	push   $0x80366b
+  8000a4:	e8 42 02 00 00       	call   8002eb <cprintf>
+  8000a9:	83 c4 0c             	add    $0xc,%esp
+  8000ac:	6a 10                	push   $0x10
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 a4 0a 00 00       	call   800b5d <memset>
+  8000b9:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+  8000bd:	c7 04 24 34 36 80 00 	movl   $0x803634,(%esp)
+  8000c4:	e8 26 33 00 00       	call   8033ef <inet_addr>
+  8000c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8000cc:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+  8000d3:	e8 e0 30 00 00       	call   8031b8 <htons>
+  8000d8:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+  8000dc:	c7 04 24 7a 36 80 00 	movl   $0x80367a,(%esp)
+  8000e3:	e8 03 02 00 00       	call   8002eb <cprintf>
+  8000e8:	83 c4 0c             	add    $0xc,%esp
+  8000eb:	6a 10                	push   $0x10
+  8000ed:	53                   	push   %ebx
+  8000ee:	ff 75 b4             	push   -0x4c(%ebp)
+  8000f1:	e8 63 23 00 00       	call   802459 <connect>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	78 68                	js     800165 <umain+0x117>
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	68 b5 36 80 00       	push   $0x8036b5
+  800105:	e8 e1 01 00 00       	call   8002eb <cprintf>
+  80010a:	83 c4 04             	add    $0x4,%esp
+  80010d:	ff 35 00 40 80 00    	push   0x804000
+  800113:	e8 7e 08 00 00       	call   800996 <strlen>
+  800118:	89 c6                	mov    %eax,%esi
+  80011a:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  80011d:	83 c4 0c             	add    $0xc,%esp
+  800120:	50                   	push   %eax
+  800121:	ff 35 00 40 80 00    	push   0x804000
+  800127:	ff 75 b4             	push   -0x4c(%ebp)
+  80012a:	e8 35 19 00 00       	call   801a64 <write>
+  80012f:	83 c4 10             	add    $0x10,%esp
+  800132:	39 c6                	cmp    %eax,%esi
+  800134:	75 3b                	jne    800171 <umain+0x123>
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	68 ca 36 80 00       	push   $0x8036ca
+  80013e:	e8 a8 01 00 00       	call   8002eb <cprintf>
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	83 7d b0 00          	cmpl   $0x0,-0x50(%ebp)
+  80014a:	74 6e                	je     8001ba <umain+0x16c>
+  80014c:	be 00 00 00 00       	mov    $0x0,%esi
+  800151:	8d 7d b8             	lea    -0x48(%ebp),%edi
+  800154:	eb 41                	jmp    800197 <umain+0x149>
+  800156:	b8 53 36 80 00       	mov    $0x803653,%eax
+  80015b:	e8 d3 fe ff ff       	call   800033 <die>
+  800160:	e9 37 ff ff ff       	jmp    80009c <umain+0x4e>
+  800165:	b8 97 36 80 00       	mov    $0x803697,%eax
+  80016a:	e8 c4 fe ff ff       	call   800033 <die>
+  80016f:	eb 8c                	jmp    8000fd <umain+0xaf>
+  800171:	b8 e4 36 80 00       	mov    $0x8036e4,%eax
+  800176:	e8 b8 fe ff ff       	call   800033 <die>
+  80017b:	eb b9                	jmp    800136 <umain+0xe8>
+  80017d:	01 de                	add    %ebx,%esi
+  80017f:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+  800184:	83 ec 0c             	sub    $0xc,%esp
+  800187:	57                   	push   %edi
+  800188:	e8 5e 01 00 00       	call   8002eb <cprintf>
+  80018d:	83 c4 10             	add    $0x10,%esp
+  800190:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  800193:	39 c6                	cmp    %eax,%esi
+  800195:	73 23                	jae    8001ba <umain+0x16c>
+  800197:	83 ec 04             	sub    $0x4,%esp
+  80019a:	6a 1f                	push   $0x1f
+  80019c:	57                   	push   %edi
+  80019d:	ff 75 b4             	push   -0x4c(%ebp)
+  8001a0:	e8 e4 17 00 00       	call   801989 <read>
+  8001a5:	89 c3                	mov    %eax,%ebx
+  8001a7:	83 c4 10             	add    $0x10,%esp
+  8001aa:	85 c0                	test   %eax,%eax
+  8001ac:	7f cf                	jg     80017d <umain+0x12f>
+  8001ae:	b8 08 37 80 00       	mov    $0x803708,%eax
+  8001b3:	e8 7b fe ff ff       	call   800033 <die>
+  8001b8:	eb c3                	jmp    80017d <umain+0x12f>
+  8001ba:	83 ec 0c             	sub    $0xc,%esp
+  8001bd:	68 d4 36 80 00       	push   $0x8036d4
+  8001c2:	e8 24 01 00 00       	call   8002eb <cprintf>
+  8001c7:	83 c4 04             	add    $0x4,%esp
+  8001ca:	ff 75 b4             	push   -0x4c(%ebp)
+  8001cd:	e8 7b 16 00 00       	call   80184d <close>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+  8001d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d8:	5b                   	pop    %ebx
+  8001d9:	5e                   	pop    %esi
+  8001da:	5f                   	pop    %edi
+  8001db:	5d                   	pop    %ebp
+  8001dc:	c3                   	ret
+
+008001dd <libmain>:
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	56                   	push   %esi
+  8001e1:	53                   	push   %ebx
+  8001e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001e8:	e8 eb 0b 00 00       	call   800dd8 <sys_getenvid>
+  8001ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f2:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8001f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001fd:	a3 20 50 80 00       	mov    %eax,0x805020
+  800202:	85 db                	test   %ebx,%ebx
+  800204:	7e 07                	jle    80020d <libmain+0x30>
+  800206:	8b 06                	mov    (%esi),%eax
+  800208:	a3 04 40 80 00       	mov    %eax,0x804004
+  80020d:	83 ec 08             	sub    $0x8,%esp
+  800210:	56                   	push   %esi
+  800211:	53                   	push   %ebx
+  800212:	e8 37 fe ff ff       	call   80004e <umain>
+  800217:	e8 0a 00 00 00       	call   800226 <exit>
+  80021c:	83 c4 10             	add    $0x10,%esp
+  80021f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800222:	5b                   	pop    %ebx
+  800223:	5e                   	pop    %esi
+  800224:	5d                   	pop    %ebp
+  800225:	c3                   	ret
+
+00800226 <exit>:
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	83 ec 08             	sub    $0x8,%esp
+  80022c:	a1 20 50 80 00       	mov    0x805020,%eax
+  800231:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800237:	85 c0                	test   %eax,%eax
+  800239:	75 14                	jne    80024f <exit+0x29>
+  80023b:	e8 3a 16 00 00       	call   80187a <close_all>
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	6a 00                	push   $0x0
+  800245:	e8 4d 0b 00 00       	call   800d97 <sys_env_destroy>
+  80024a:	83 c4 10             	add    $0x10,%esp
+  80024d:	c9                   	leave
+  80024e:	c3                   	ret
+  80024f:	e8 b0 12 00 00       	call   801504 <sys_lease_complete>
+  800254:	eb e5                	jmp    80023b <exit+0x15>
+
+00800256 <putch>:
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	53                   	push   %ebx
+  80025a:	83 ec 04             	sub    $0x4,%esp
+  80025d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800260:	8b 13                	mov    (%ebx),%edx
+  800262:	8d 42 01             	lea    0x1(%edx),%eax
+  800265:	89 03                	mov    %eax,(%ebx)
+  800267:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80026a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80026e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800273:	74 09                	je     80027e <putch+0x28>
+  800275:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800279:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80027c:	c9                   	leave
+  80027d:	c3                   	ret
+  80027e:	83 ec 08             	sub    $0x8,%esp
+  800281:	68 ff 00 00 00       	push   $0xff
+  800286:	8d 43 08             	lea    0x8(%ebx),%eax
+  800289:	50                   	push   %eax
+  80028a:	e8 cb 0a 00 00       	call   800d5a <sys_cputs>
+  80028f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800295:	83 c4 10             	add    $0x10,%esp
+  800298:	eb db                	jmp    800275 <putch+0x1f>
+
+0080029a <vcprintf>:
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002a3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002aa:	00 00 00 
+  8002ad:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002b4:	00 00 00 
+  8002b7:	ff 75 0c             	push   0xc(%ebp)
+  8002ba:	ff 75 08             	push   0x8(%ebp)
+  8002bd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002c3:	50                   	push   %eax
+  8002c4:	68 56 02 80 00       	push   $0x800256
+  8002c9:	e8 1c 01 00 00       	call   8003ea <vprintfmt>
+  8002ce:	83 c4 08             	add    $0x8,%esp
+  8002d1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002d7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002dd:	50                   	push   %eax
+  8002de:	e8 77 0a 00 00       	call   800d5a <sys_cputs>
+  8002e3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002e9:	c9                   	leave
+  8002ea:	c3                   	ret
+
+008002eb <cprintf>:
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	83 ec 10             	sub    $0x10,%esp
+  8002f1:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	ff 75 08             	push   0x8(%ebp)
+  8002f8:	e8 9d ff ff ff       	call   80029a <vcprintf>
+  8002fd:	c9                   	leave
+  8002fe:	c3                   	ret
+
+008002ff <printnum>:
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	57                   	push   %edi
+  800303:	56                   	push   %esi
+  800304:	53                   	push   %ebx
+  800305:	83 ec 1c             	sub    $0x1c,%esp
+  800308:	89 c3                	mov    %eax,%ebx
+  80030a:	89 d6                	mov    %edx,%esi
+  80030c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800312:	89 d1                	mov    %edx,%ecx
+  800314:	89 c2                	mov    %eax,%edx
+  800316:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800319:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80031c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80031f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800322:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800329:	39 c2                	cmp    %eax,%edx
+  80032b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80032e:	73 4b                	jae    80037b <printnum+0x7c>
+  800330:	8b 45 14             	mov    0x14(%ebp),%eax
+  800333:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800336:	85 ff                	test   %edi,%edi
+  800338:	7e 11                	jle    80034b <printnum+0x4c>
+  80033a:	83 ec 08             	sub    $0x8,%esp
+  80033d:	56                   	push   %esi
+  80033e:	ff 75 18             	push   0x18(%ebp)
+  800341:	ff d3                	call   *%ebx
+  800343:	83 c4 10             	add    $0x10,%esp
+  800346:	83 ef 01             	sub    $0x1,%edi
+  800349:	75 ef                	jne    80033a <printnum+0x3b>
+  80034b:	83 ec 08             	sub    $0x8,%esp
+  80034e:	56                   	push   %esi
+  80034f:	83 ec 04             	sub    $0x4,%esp
+  800352:	ff 75 e4             	push   -0x1c(%ebp)
+  800355:	ff 75 e0             	push   -0x20(%ebp)
+  800358:	ff 75 dc             	push   -0x24(%ebp)
+  80035b:	ff 75 d8             	push   -0x28(%ebp)
+  80035e:	e8 bb 31 00 00       	call   80351e <__umoddi3>
+  800363:	83 c4 14             	add    $0x14,%esp
+  800366:	0f be 80 36 37 80 00 	movsbl 0x803736(%eax),%eax
+  80036d:	50                   	push   %eax
+  80036e:	ff d3                	call   *%ebx
+  800370:	83 c4 10             	add    $0x10,%esp
+  800373:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800376:	5b                   	pop    %ebx
+  800377:	5e                   	pop    %esi
+  800378:	5f                   	pop    %edi
+  800379:	5d                   	pop    %ebp
+  80037a:	c3                   	ret
+  80037b:	83 ec 0c             	sub    $0xc,%esp
+  80037e:	ff 75 18             	push   0x18(%ebp)
+  800381:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800384:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800387:	52                   	push   %edx
+  800388:	50                   	push   %eax
+  800389:	83 ec 08             	sub    $0x8,%esp
+  80038c:	ff 75 e4             	push   -0x1c(%ebp)
+  80038f:	ff 75 e0             	push   -0x20(%ebp)
+  800392:	ff 75 dc             	push   -0x24(%ebp)
+  800395:	ff 75 d8             	push   -0x28(%ebp)
+  800398:	e8 63 31 00 00       	call   803500 <__udivdi3>
+  80039d:	83 c4 18             	add    $0x18,%esp
+  8003a0:	52                   	push   %edx
+  8003a1:	50                   	push   %eax
+  8003a2:	89 f2                	mov    %esi,%edx
+  8003a4:	89 d8                	mov    %ebx,%eax
+  8003a6:	e8 54 ff ff ff       	call   8002ff <printnum>
+  8003ab:	83 c4 20             	add    $0x20,%esp
+  8003ae:	eb 9b                	jmp    80034b <printnum+0x4c>
+
+008003b0 <sprintputch>:
+  8003b0:	55                   	push   %ebp
+  8003b1:	89 e5                	mov    %esp,%ebp
+  8003b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8003ba:	8b 10                	mov    (%eax),%edx
+  8003bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003bf:	73 0a                	jae    8003cb <sprintputch+0x1b>
+  8003c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003c4:	89 08                	mov    %ecx,(%eax)
+  8003c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003c9:	88 02                	mov    %al,(%edx)
+  8003cb:	5d                   	pop    %ebp
+  8003cc:	c3                   	ret
+
+008003cd <printfmt>:
+  8003cd:	55                   	push   %ebp
+  8003ce:	89 e5                	mov    %esp,%ebp
+  8003d0:	83 ec 08             	sub    $0x8,%esp
+  8003d3:	8d 45 14             	lea    0x14(%ebp),%eax
+  8003d6:	50                   	push   %eax
+  8003d7:	ff 75 10             	push   0x10(%ebp)
+  8003da:	ff 75 0c             	push   0xc(%ebp)
+  8003dd:	ff 75 08             	push   0x8(%ebp)
+  8003e0:	e8 05 00 00 00       	call   8003ea <vprintfmt>
+  8003e5:	83 c4 10             	add    $0x10,%esp
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+
+008003ea <vprintfmt>:
+  8003ea:	55                   	push   %ebp
+  8003eb:	89 e5                	mov    %esp,%ebp
+  8003ed:	57                   	push   %edi
+  8003ee:	56                   	push   %esi
+  8003ef:	53                   	push   %ebx
+  8003f0:	83 ec 2c             	sub    $0x2c,%esp
+  8003f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003f6:	89 df                	mov    %ebx,%edi
+  8003f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003fe:	8d 70 01             	lea    0x1(%eax),%esi
+  800401:	0f b6 00             	movzbl (%eax),%eax
+  800404:	83 f8 25             	cmp    $0x25,%eax
+  800407:	74 1e                	je     800427 <vprintfmt+0x3d>
+  800409:	85 c0                	test   %eax,%eax
+  80040b:	0f 84 15 05 00 00    	je     800926 <vprintfmt+0x53c>
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	53                   	push   %ebx
+  800415:	50                   	push   %eax
+  800416:	ff d7                	call   *%edi
+  800418:	83 c6 01             	add    $0x1,%esi
+  80041b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80041f:	83 c4 10             	add    $0x10,%esp
+  800422:	83 f8 25             	cmp    $0x25,%eax
+  800425:	75 e2                	jne    800409 <vprintfmt+0x1f>
+  800427:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80042b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800432:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800439:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800440:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800445:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800448:	8d 56 01             	lea    0x1(%esi),%edx
+  80044b:	0f b6 0e             	movzbl (%esi),%ecx
+  80044e:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800451:	3c 55                	cmp    $0x55,%al
+  800453:	0f 87 3b 04 00 00    	ja     800894 <vprintfmt+0x4aa>
+  800459:	0f b6 c0             	movzbl %al,%eax
+  80045c:	ff 24 85 80 38 80 00 	jmp    *0x803880(,%eax,4)
+  800463:	89 75 10             	mov    %esi,0x10(%ebp)
+  800466:	eb 93                	jmp    8003fb <vprintfmt+0x11>
+  800468:	89 d6                	mov    %edx,%esi
+  80046a:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80046e:	eb d8                	jmp    800448 <vprintfmt+0x5e>
+  800470:	89 d6                	mov    %edx,%esi
+  800472:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800476:	eb d0                	jmp    800448 <vprintfmt+0x5e>
+  800478:	0f b6 c9             	movzbl %cl,%ecx
+  80047b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80047e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800481:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800485:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800488:	83 f9 09             	cmp    $0x9,%ecx
+  80048b:	77 6f                	ja     8004fc <vprintfmt+0x112>
+  80048d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800490:	83 c2 01             	add    $0x1,%edx
+  800493:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800496:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80049a:	0f be 02             	movsbl (%edx),%eax
+  80049d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004a0:	83 fe 09             	cmp    $0x9,%esi
+  8004a3:	76 eb                	jbe    800490 <vprintfmt+0xa6>
+  8004a5:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8004a8:	89 d6                	mov    %edx,%esi
+  8004aa:	eb 13                	jmp    8004bf <vprintfmt+0xd5>
+  8004ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004af:	8b 00                	mov    (%eax),%eax
+  8004b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004bd:	89 d6                	mov    %edx,%esi
+  8004bf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004c3:	79 83                	jns    800448 <vprintfmt+0x5e>
+  8004c5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004cb:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004d2:	e9 71 ff ff ff       	jmp    800448 <vprintfmt+0x5e>
+  8004d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004da:	85 c9                	test   %ecx,%ecx
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	0f 49 c1             	cmovns %ecx,%eax
+  8004e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e7:	89 d6                	mov    %edx,%esi
+  8004e9:	e9 5a ff ff ff       	jmp    800448 <vprintfmt+0x5e>
+  8004ee:	89 d6                	mov    %edx,%esi
+  8004f0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8004f7:	e9 4c ff ff ff       	jmp    800448 <vprintfmt+0x5e>
+  8004fc:	89 d6                	mov    %edx,%esi
+  8004fe:	eb bf                	jmp    8004bf <vprintfmt+0xd5>
+  800500:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800504:	89 d6                	mov    %edx,%esi
+  800506:	e9 3d ff ff ff       	jmp    800448 <vprintfmt+0x5e>
+  80050b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80050e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800511:	8d 70 04             	lea    0x4(%eax),%esi
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	53                   	push   %ebx
+  800518:	ff 30                	push   (%eax)
+  80051a:	ff d7                	call   *%edi
+  80051c:	83 c4 10             	add    $0x10,%esp
+  80051f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800522:	e9 d4 fe ff ff       	jmp    8003fb <vprintfmt+0x11>
+  800527:	89 55 10             	mov    %edx,0x10(%ebp)
+  80052a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052d:	8d 70 04             	lea    0x4(%eax),%esi
+  800530:	8b 10                	mov    (%eax),%edx
+  800532:	89 d0                	mov    %edx,%eax
+  800534:	f7 d8                	neg    %eax
+  800536:	0f 48 c2             	cmovs  %edx,%eax
+  800539:	83 f8 12             	cmp    $0x12,%eax
+  80053c:	7f 23                	jg     800561 <vprintfmt+0x177>
+  80053e:	8b 14 85 e0 39 80 00 	mov    0x8039e0(,%eax,4),%edx
+  800545:	85 d2                	test   %edx,%edx
+  800547:	74 18                	je     800561 <vprintfmt+0x177>
+  800549:	52                   	push   %edx
+  80054a:	68 3b 3b 80 00       	push   $0x803b3b
+  80054f:	53                   	push   %ebx
+  800550:	57                   	push   %edi
+  800551:	e8 77 fe ff ff       	call   8003cd <printfmt>
+  800556:	83 c4 10             	add    $0x10,%esp
+  800559:	89 75 14             	mov    %esi,0x14(%ebp)
+  80055c:	e9 9a fe ff ff       	jmp    8003fb <vprintfmt+0x11>
+  800561:	50                   	push   %eax
+  800562:	68 4e 37 80 00       	push   $0x80374e
+  800567:	53                   	push   %ebx
+  800568:	57                   	push   %edi
+  800569:	e8 5f fe ff ff       	call   8003cd <printfmt>
+  80056e:	83 c4 10             	add    $0x10,%esp
+  800571:	89 75 14             	mov    %esi,0x14(%ebp)
+  800574:	e9 82 fe ff ff       	jmp    8003fb <vprintfmt+0x11>
+  800579:	89 55 10             	mov    %edx,0x10(%ebp)
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	83 c0 04             	add    $0x4,%eax
+  800582:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 00                	mov    (%eax),%eax
+  80058a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80058d:	85 c0                	test   %eax,%eax
+  80058f:	0f 84 61 03 00 00    	je     8008f6 <vprintfmt+0x50c>
+  800595:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800599:	7e 06                	jle    8005a1 <vprintfmt+0x1b7>
+  80059b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80059f:	75 29                	jne    8005ca <vprintfmt+0x1e0>
+  8005a1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005a4:	8d 70 01             	lea    0x1(%eax),%esi
+  8005a7:	0f b6 00             	movzbl (%eax),%eax
+  8005aa:	0f be d0             	movsbl %al,%edx
+  8005ad:	85 d2                	test   %edx,%edx
+  8005af:	0f 84 bb 00 00 00    	je     800670 <vprintfmt+0x286>
+  8005b5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005b8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005bb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005be:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005c1:	eb 7a                	jmp    80063d <vprintfmt+0x253>
+  8005c3:	c7 45 d0 47 37 80 00 	movl   $0x803747,-0x30(%ebp)
+  8005ca:	83 ec 08             	sub    $0x8,%esp
+  8005cd:	ff 75 d4             	push   -0x2c(%ebp)
+  8005d0:	ff 75 d0             	push   -0x30(%ebp)
+  8005d3:	e8 e0 03 00 00       	call   8009b8 <strnlen>
+  8005d8:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005db:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	85 d2                	test   %edx,%edx
+  8005e3:	0f 8e d6 02 00 00    	jle    8008bf <vprintfmt+0x4d5>
+  8005e9:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8005ed:	83 ec 08             	sub    $0x8,%esp
+  8005f0:	53                   	push   %ebx
+  8005f1:	56                   	push   %esi
+  8005f2:	ff d7                	call   *%edi
+  8005f4:	83 c4 10             	add    $0x10,%esp
+  8005f7:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8005fb:	75 f0                	jne    8005ed <vprintfmt+0x203>
+  8005fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800600:	8d 70 01             	lea    0x1(%eax),%esi
+  800603:	0f b6 00             	movzbl (%eax),%eax
+  800606:	0f be d0             	movsbl %al,%edx
+  800609:	85 d2                	test   %edx,%edx
+  80060b:	0f 84 da 02 00 00    	je     8008eb <vprintfmt+0x501>
+  800611:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800614:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800617:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80061a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80061d:	eb 1e                	jmp    80063d <vprintfmt+0x253>
+  80061f:	83 ec 08             	sub    $0x8,%esp
+  800622:	ff 75 0c             	push   0xc(%ebp)
+  800625:	52                   	push   %edx
+  800626:	ff 55 08             	call   *0x8(%ebp)
+  800629:	83 c4 10             	add    $0x10,%esp
+  80062c:	83 eb 01             	sub    $0x1,%ebx
+  80062f:	83 c6 01             	add    $0x1,%esi
+  800632:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800636:	0f be d0             	movsbl %al,%edx
+  800639:	85 d2                	test   %edx,%edx
+  80063b:	74 2a                	je     800667 <vprintfmt+0x27d>
+  80063d:	85 ff                	test   %edi,%edi
+  80063f:	78 05                	js     800646 <vprintfmt+0x25c>
+  800641:	83 ef 01             	sub    $0x1,%edi
+  800644:	78 59                	js     80069f <vprintfmt+0x2b5>
+  800646:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80064a:	74 d3                	je     80061f <vprintfmt+0x235>
+  80064c:	0f be c0             	movsbl %al,%eax
+  80064f:	83 e8 20             	sub    $0x20,%eax
+  800652:	83 f8 5e             	cmp    $0x5e,%eax
+  800655:	76 c8                	jbe    80061f <vprintfmt+0x235>
+  800657:	83 ec 08             	sub    $0x8,%esp
+  80065a:	ff 75 0c             	push   0xc(%ebp)
+  80065d:	6a 3f                	push   $0x3f
+  80065f:	ff 55 08             	call   *0x8(%ebp)
+  800662:	83 c4 10             	add    $0x10,%esp
+  800665:	eb c5                	jmp    80062c <vprintfmt+0x242>
+  800667:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80066a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80066d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800670:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800673:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800677:	7e 1b                	jle    800694 <vprintfmt+0x2aa>
+  800679:	83 ec 08             	sub    $0x8,%esp
+  80067c:	53                   	push   %ebx
+  80067d:	6a 20                	push   $0x20
+  80067f:	ff d7                	call   *%edi
+  800681:	83 c4 10             	add    $0x10,%esp
+  800684:	83 ee 01             	sub    $0x1,%esi
+  800687:	75 f0                	jne    800679 <vprintfmt+0x28f>
+  800689:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068f:	e9 67 fd ff ff       	jmp    8003fb <vprintfmt+0x11>
+  800694:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800697:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069a:	e9 5c fd ff ff       	jmp    8003fb <vprintfmt+0x11>
+  80069f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006a8:	eb c6                	jmp    800670 <vprintfmt+0x286>
+  8006aa:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006ad:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006b0:	83 f9 01             	cmp    $0x1,%ecx
+  8006b3:	7f 1f                	jg     8006d4 <vprintfmt+0x2ea>
+  8006b5:	85 c9                	test   %ecx,%ecx
+  8006b7:	74 67                	je     800720 <vprintfmt+0x336>
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8b 30                	mov    (%eax),%esi
+  8006be:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006c1:	89 f0                	mov    %esi,%eax
+  8006c3:	c1 f8 1f             	sar    $0x1f,%eax
+  8006c6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d2:	eb 17                	jmp    8006eb <vprintfmt+0x301>
+  8006d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d7:	8b 50 04             	mov    0x4(%eax),%edx
+  8006da:	8b 00                	mov    (%eax),%eax
+  8006dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006eb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ee:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006f1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006f6:	85 c9                	test   %ecx,%ecx
+  8006f8:	0f 89 12 01 00 00    	jns    800810 <vprintfmt+0x426>
+  8006fe:	83 ec 08             	sub    $0x8,%esp
+  800701:	53                   	push   %ebx
+  800702:	6a 2d                	push   $0x2d
+  800704:	ff d7                	call   *%edi
+  800706:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800709:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80070c:	f7 da                	neg    %edx
+  80070e:	83 d1 00             	adc    $0x0,%ecx
+  800711:	f7 d9                	neg    %ecx
+  800713:	83 c4 10             	add    $0x10,%esp
+  800716:	be 0a 00 00 00       	mov    $0xa,%esi
+  80071b:	e9 f0 00 00 00       	jmp    800810 <vprintfmt+0x426>
+  800720:	8b 45 14             	mov    0x14(%ebp),%eax
+  800723:	8b 30                	mov    (%eax),%esi
+  800725:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800728:	89 f0                	mov    %esi,%eax
+  80072a:	c1 f8 1f             	sar    $0x1f,%eax
+  80072d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800730:	8b 45 14             	mov    0x14(%ebp),%eax
+  800733:	8d 40 04             	lea    0x4(%eax),%eax
+  800736:	89 45 14             	mov    %eax,0x14(%ebp)
+  800739:	eb b0                	jmp    8006eb <vprintfmt+0x301>
+  80073b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80073e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800741:	83 f9 01             	cmp    $0x1,%ecx
+  800744:	7f 1e                	jg     800764 <vprintfmt+0x37a>
+  800746:	85 c9                	test   %ecx,%ecx
+  800748:	74 32                	je     80077c <vprintfmt+0x392>
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8b 10                	mov    (%eax),%edx
+  80074f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800754:	8d 40 04             	lea    0x4(%eax),%eax
+  800757:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80075f:	e9 ac 00 00 00       	jmp    800810 <vprintfmt+0x426>
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 10                	mov    (%eax),%edx
+  800769:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076c:	8d 40 08             	lea    0x8(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800772:	be 0a 00 00 00       	mov    $0xa,%esi
+  800777:	e9 94 00 00 00       	jmp    800810 <vprintfmt+0x426>
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 10                	mov    (%eax),%edx
+  800781:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800786:	8d 40 04             	lea    0x4(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800791:	eb 7d                	jmp    800810 <vprintfmt+0x426>
+  800793:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800796:	89 55 10             	mov    %edx,0x10(%ebp)
+  800799:	83 f9 01             	cmp    $0x1,%ecx
+  80079c:	7f 1b                	jg     8007b9 <vprintfmt+0x3cf>
+  80079e:	85 c9                	test   %ecx,%ecx
+  8007a0:	74 2c                	je     8007ce <vprintfmt+0x3e4>
+  8007a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a5:	8b 10                	mov    (%eax),%edx
+  8007a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8007af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b2:	be 08 00 00 00       	mov    $0x8,%esi
+  8007b7:	eb 57                	jmp    800810 <vprintfmt+0x426>
+  8007b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bc:	8b 10                	mov    (%eax),%edx
+  8007be:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c7:	be 08 00 00 00       	mov    $0x8,%esi
+  8007cc:	eb 42                	jmp    800810 <vprintfmt+0x426>
+  8007ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d1:	8b 10                	mov    (%eax),%edx
+  8007d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007de:	be 08 00 00 00       	mov    $0x8,%esi
+  8007e3:	eb 2b                	jmp    800810 <vprintfmt+0x426>
+  8007e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e8:	83 ec 08             	sub    $0x8,%esp
+  8007eb:	53                   	push   %ebx
+  8007ec:	6a 30                	push   $0x30
+  8007ee:	ff d7                	call   *%edi
+  8007f0:	83 c4 08             	add    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	6a 78                	push   $0x78
+  8007f6:	ff d7                	call   *%edi
+  8007f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fb:	8b 10                	mov    (%eax),%edx
+  8007fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800802:	83 c4 10             	add    $0x10,%esp
+  800805:	8d 40 04             	lea    0x4(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080b:	be 10 00 00 00       	mov    $0x10,%esi
+  800810:	83 ec 0c             	sub    $0xc,%esp
+  800813:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800817:	50                   	push   %eax
+  800818:	ff 75 e4             	push   -0x1c(%ebp)
+  80081b:	56                   	push   %esi
+  80081c:	51                   	push   %ecx
+  80081d:	52                   	push   %edx
+  80081e:	89 da                	mov    %ebx,%edx
+  800820:	89 f8                	mov    %edi,%eax
+  800822:	e8 d8 fa ff ff       	call   8002ff <printnum>
+  800827:	83 c4 20             	add    $0x20,%esp
+  80082a:	e9 cc fb ff ff       	jmp    8003fb <vprintfmt+0x11>
+  80082f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800832:	89 55 10             	mov    %edx,0x10(%ebp)
+  800835:	83 f9 01             	cmp    $0x1,%ecx
+  800838:	7f 1b                	jg     800855 <vprintfmt+0x46b>
+  80083a:	85 c9                	test   %ecx,%ecx
+  80083c:	74 2c                	je     80086a <vprintfmt+0x480>
+  80083e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800841:	8b 10                	mov    (%eax),%edx
+  800843:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800848:	8d 40 04             	lea    0x4(%eax),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084e:	be 10 00 00 00       	mov    $0x10,%esi
+  800853:	eb bb                	jmp    800810 <vprintfmt+0x426>
+  800855:	8b 45 14             	mov    0x14(%ebp),%eax
+  800858:	8b 10                	mov    (%eax),%edx
+  80085a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80085d:	8d 40 08             	lea    0x8(%eax),%eax
+  800860:	89 45 14             	mov    %eax,0x14(%ebp)
+  800863:	be 10 00 00 00       	mov    $0x10,%esi
+  800868:	eb a6                	jmp    800810 <vprintfmt+0x426>
+  80086a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086d:	8b 10                	mov    (%eax),%edx
+  80086f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800874:	8d 40 04             	lea    0x4(%eax),%eax
+  800877:	89 45 14             	mov    %eax,0x14(%ebp)
+  80087a:	be 10 00 00 00       	mov    $0x10,%esi
+  80087f:	eb 8f                	jmp    800810 <vprintfmt+0x426>
+  800881:	89 55 10             	mov    %edx,0x10(%ebp)
+  800884:	83 ec 08             	sub    $0x8,%esp
+  800887:	53                   	push   %ebx
+  800888:	6a 25                	push   $0x25
+  80088a:	ff d7                	call   *%edi
+  80088c:	83 c4 10             	add    $0x10,%esp
+  80088f:	e9 67 fb ff ff       	jmp    8003fb <vprintfmt+0x11>
+  800894:	83 ec 08             	sub    $0x8,%esp
+  800897:	53                   	push   %ebx
+  800898:	6a 25                	push   $0x25
+  80089a:	ff d7                	call   *%edi
+  80089c:	83 c4 10             	add    $0x10,%esp
+  80089f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008a3:	0f 84 ba fb ff ff    	je     800463 <vprintfmt+0x79>
+  8008a9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008ac:	89 f0                	mov    %esi,%eax
+  8008ae:	83 e8 01             	sub    $0x1,%eax
+  8008b1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008b5:	75 f7                	jne    8008ae <vprintfmt+0x4c4>
+  8008b7:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008ba:	e9 3c fb ff ff       	jmp    8003fb <vprintfmt+0x11>
+  8008bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008c2:	8d 70 01             	lea    0x1(%eax),%esi
+  8008c5:	0f b6 00             	movzbl (%eax),%eax
+  8008c8:	0f be d0             	movsbl %al,%edx
+  8008cb:	85 d2                	test   %edx,%edx
+  8008cd:	74 11                	je     8008e0 <vprintfmt+0x4f6>
+  8008cf:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008d2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008d5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008d8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008db:	e9 5d fd ff ff       	jmp    80063d <vprintfmt+0x253>
+  8008e0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e6:	e9 10 fb ff ff       	jmp    8003fb <vprintfmt+0x11>
+  8008eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f1:	e9 05 fb ff ff       	jmp    8003fb <vprintfmt+0x11>
+  8008f6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008fa:	7e 0a                	jle    800906 <vprintfmt+0x51c>
+  8008fc:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800900:	0f 85 bd fc ff ff    	jne    8005c3 <vprintfmt+0x1d9>
+  800906:	ba 28 00 00 00       	mov    $0x28,%edx
+  80090b:	b8 28 00 00 00       	mov    $0x28,%eax
+  800910:	be 48 37 80 00       	mov    $0x803748,%esi
+  800915:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800918:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80091b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80091e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800921:	e9 17 fd ff ff       	jmp    80063d <vprintfmt+0x253>
+  800926:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800929:	5b                   	pop    %ebx
+  80092a:	5e                   	pop    %esi
+  80092b:	5f                   	pop    %edi
+  80092c:	5d                   	pop    %ebp
+  80092d:	c3                   	ret
+
+0080092e <vsnprintf>:
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	83 ec 18             	sub    $0x18,%esp
+  800934:	8b 45 08             	mov    0x8(%ebp),%eax
+  800937:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80093a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80093d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800941:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800944:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80094b:	85 c0                	test   %eax,%eax
+  80094d:	74 26                	je     800975 <vsnprintf+0x47>
+  80094f:	85 d2                	test   %edx,%edx
+  800951:	7e 22                	jle    800975 <vsnprintf+0x47>
+  800953:	ff 75 14             	push   0x14(%ebp)
+  800956:	ff 75 10             	push   0x10(%ebp)
+  800959:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80095c:	50                   	push   %eax
+  80095d:	68 b0 03 80 00       	push   $0x8003b0
+  800962:	e8 83 fa ff ff       	call   8003ea <vprintfmt>
+  800967:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80096a:	c6 00 00             	movb   $0x0,(%eax)
+  80096d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800970:	83 c4 10             	add    $0x10,%esp
+  800973:	c9                   	leave
+  800974:	c3                   	ret
+  800975:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80097a:	eb f7                	jmp    800973 <vsnprintf+0x45>
+
+0080097c <snprintf>:
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	83 ec 08             	sub    $0x8,%esp
+  800982:	8d 45 14             	lea    0x14(%ebp),%eax
+  800985:	50                   	push   %eax
+  800986:	ff 75 10             	push   0x10(%ebp)
+  800989:	ff 75 0c             	push   0xc(%ebp)
+  80098c:	ff 75 08             	push   0x8(%ebp)
+  80098f:	e8 9a ff ff ff       	call   80092e <vsnprintf>
+  800994:	c9                   	leave
+  800995:	c3                   	ret
+
+00800996 <strlen>:
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	8b 55 08             	mov    0x8(%ebp),%edx
+  80099c:	80 3a 00             	cmpb   $0x0,(%edx)
+  80099f:	74 10                	je     8009b1 <strlen+0x1b>
+  8009a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a6:	83 c0 01             	add    $0x1,%eax
+  8009a9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009ad:	75 f7                	jne    8009a6 <strlen+0x10>
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+  8009b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b6:	eb f7                	jmp    8009af <strlen+0x19>
+
+008009b8 <strnlen>:
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c1:	85 d2                	test   %edx,%edx
+  8009c3:	74 16                	je     8009db <strnlen+0x23>
+  8009c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ca:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009ce:	74 09                	je     8009d9 <strnlen+0x21>
+  8009d0:	83 c0 01             	add    $0x1,%eax
+  8009d3:	39 d0                	cmp    %edx,%eax
+  8009d5:	75 f3                	jne    8009ca <strnlen+0x12>
+  8009d7:	89 d0                	mov    %edx,%eax
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+  8009db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e0:	eb f7                	jmp    8009d9 <strnlen+0x21>
+
+008009e2 <strcpy>:
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	53                   	push   %ebx
+  8009e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009f5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009f8:	83 c0 01             	add    $0x1,%eax
+  8009fb:	84 d2                	test   %dl,%dl
+  8009fd:	75 f2                	jne    8009f1 <strcpy+0xf>
+  8009ff:	89 c8                	mov    %ecx,%eax
+  800a01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a04:	c9                   	leave
+  800a05:	c3                   	ret
+
+00800a06 <strcat>:
+  800a06:	55                   	push   %ebp
+  800a07:	89 e5                	mov    %esp,%ebp
+  800a09:	53                   	push   %ebx
+  800a0a:	83 ec 10             	sub    $0x10,%esp
+  800a0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a10:	53                   	push   %ebx
+  800a11:	e8 80 ff ff ff       	call   800996 <strlen>
+  800a16:	83 c4 08             	add    $0x8,%esp
+  800a19:	ff 75 0c             	push   0xc(%ebp)
+  800a1c:	01 d8                	add    %ebx,%eax
+  800a1e:	50                   	push   %eax
+  800a1f:	e8 be ff ff ff       	call   8009e2 <strcpy>
+  800a24:	89 d8                	mov    %ebx,%eax
+  800a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+
+00800a2b <strncpy>:
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	56                   	push   %esi
+  800a2f:	53                   	push   %ebx
+  800a30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a39:	85 db                	test   %ebx,%ebx
+  800a3b:	74 17                	je     800a54 <strncpy+0x29>
+  800a3d:	01 f3                	add    %esi,%ebx
+  800a3f:	89 f0                	mov    %esi,%eax
+  800a41:	83 c0 01             	add    $0x1,%eax
+  800a44:	0f b6 0a             	movzbl (%edx),%ecx
+  800a47:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a4a:	80 f9 01             	cmp    $0x1,%cl
+  800a4d:	83 da ff             	sbb    $0xffffffff,%edx
+  800a50:	39 c3                	cmp    %eax,%ebx
+  800a52:	75 ed                	jne    800a41 <strncpy+0x16>
+  800a54:	89 f0                	mov    %esi,%eax
+  800a56:	5b                   	pop    %ebx
+  800a57:	5e                   	pop    %esi
+  800a58:	5d                   	pop    %ebp
+  800a59:	c3                   	ret
+
+00800a5a <strlcpy>:
+  800a5a:	55                   	push   %ebp
+  800a5b:	89 e5                	mov    %esp,%ebp
+  800a5d:	56                   	push   %esi
+  800a5e:	53                   	push   %ebx
+  800a5f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a68:	89 f0                	mov    %esi,%eax
+  800a6a:	85 db                	test   %ebx,%ebx
+  800a6c:	74 1e                	je     800a8c <strlcpy+0x32>
+  800a6e:	83 eb 01             	sub    $0x1,%ebx
+  800a71:	74 16                	je     800a89 <strlcpy+0x2f>
+  800a73:	01 f3                	add    %esi,%ebx
+  800a75:	0f b6 0a             	movzbl (%edx),%ecx
+  800a78:	84 c9                	test   %cl,%cl
+  800a7a:	74 0d                	je     800a89 <strlcpy+0x2f>
+  800a7c:	83 c2 01             	add    $0x1,%edx
+  800a7f:	83 c0 01             	add    $0x1,%eax
+  800a82:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a85:	39 d8                	cmp    %ebx,%eax
+  800a87:	75 ec                	jne    800a75 <strlcpy+0x1b>
+  800a89:	c6 00 00             	movb   $0x0,(%eax)
+  800a8c:	29 f0                	sub    %esi,%eax
+  800a8e:	5b                   	pop    %ebx
+  800a8f:	5e                   	pop    %esi
+  800a90:	5d                   	pop    %ebp
+  800a91:	c3                   	ret
+
+00800a92 <strcmp>:
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a9b:	0f b6 01             	movzbl (%ecx),%eax
+  800a9e:	84 c0                	test   %al,%al
+  800aa0:	74 11                	je     800ab3 <strcmp+0x21>
+  800aa2:	38 02                	cmp    %al,(%edx)
+  800aa4:	75 0d                	jne    800ab3 <strcmp+0x21>
+  800aa6:	83 c1 01             	add    $0x1,%ecx
+  800aa9:	83 c2 01             	add    $0x1,%edx
+  800aac:	0f b6 01             	movzbl (%ecx),%eax
+  800aaf:	84 c0                	test   %al,%al
+  800ab1:	75 ef                	jne    800aa2 <strcmp+0x10>
+  800ab3:	0f b6 c0             	movzbl %al,%eax
+  800ab6:	0f b6 12             	movzbl (%edx),%edx
+  800ab9:	29 d0                	sub    %edx,%eax
+  800abb:	5d                   	pop    %ebp
+  800abc:	c3                   	ret
+
+00800abd <strncmp>:
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	53                   	push   %ebx
+  800ac1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ac7:	8b 55 10             	mov    0x10(%ebp),%edx
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acf:	85 d2                	test   %edx,%edx
+  800ad1:	74 2e                	je     800b01 <strncmp+0x44>
+  800ad3:	0f b6 01             	movzbl (%ecx),%eax
+  800ad6:	84 c0                	test   %al,%al
+  800ad8:	74 16                	je     800af0 <strncmp+0x33>
+  800ada:	3a 03                	cmp    (%ebx),%al
+  800adc:	75 12                	jne    800af0 <strncmp+0x33>
+  800ade:	83 c1 01             	add    $0x1,%ecx
+  800ae1:	83 c3 01             	add    $0x1,%ebx
+  800ae4:	83 ea 01             	sub    $0x1,%edx
+  800ae7:	75 ea                	jne    800ad3 <strncmp+0x16>
+  800ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aee:	eb 11                	jmp    800b01 <strncmp+0x44>
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af5:	85 d2                	test   %edx,%edx
+  800af7:	74 08                	je     800b01 <strncmp+0x44>
+  800af9:	0f b6 01             	movzbl (%ecx),%eax
+  800afc:	0f b6 13             	movzbl (%ebx),%edx
+  800aff:	29 d0                	sub    %edx,%eax
+  800b01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b04:	c9                   	leave
+  800b05:	c3                   	ret
+
+00800b06 <strchr>:
+  800b06:	55                   	push   %ebp
+  800b07:	89 e5                	mov    %esp,%ebp
+  800b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b10:	0f b6 10             	movzbl (%eax),%edx
+  800b13:	84 d2                	test   %dl,%dl
+  800b15:	74 15                	je     800b2c <strchr+0x26>
+  800b17:	38 d1                	cmp    %dl,%cl
+  800b19:	74 0f                	je     800b2a <strchr+0x24>
+  800b1b:	83 c0 01             	add    $0x1,%eax
+  800b1e:	0f b6 10             	movzbl (%eax),%edx
+  800b21:	84 d2                	test   %dl,%dl
+  800b23:	75 f2                	jne    800b17 <strchr+0x11>
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2a:	5d                   	pop    %ebp
+  800b2b:	c3                   	ret
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b31:	eb f7                	jmp    800b2a <strchr+0x24>
+
+00800b33 <strfind>:
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	53                   	push   %ebx
+  800b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b3d:	0f b6 18             	movzbl (%eax),%ebx
+  800b40:	38 d3                	cmp    %dl,%bl
+  800b42:	74 14                	je     800b58 <strfind+0x25>
+  800b44:	89 d1                	mov    %edx,%ecx
+  800b46:	84 db                	test   %bl,%bl
+  800b48:	74 0e                	je     800b58 <strfind+0x25>
+  800b4a:	83 c0 01             	add    $0x1,%eax
+  800b4d:	0f b6 10             	movzbl (%eax),%edx
+  800b50:	38 ca                	cmp    %cl,%dl
+  800b52:	74 04                	je     800b58 <strfind+0x25>
+  800b54:	84 d2                	test   %dl,%dl
+  800b56:	75 f2                	jne    800b4a <strfind+0x17>
+  800b58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b5b:	c9                   	leave
+  800b5c:	c3                   	ret
+
+00800b5d <memset>:
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	57                   	push   %edi
+  800b61:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b64:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b67:	85 c9                	test   %ecx,%ecx
+  800b69:	74 20                	je     800b8b <memset+0x2e>
+  800b6b:	89 f8                	mov    %edi,%eax
+  800b6d:	09 c8                	or     %ecx,%eax
+  800b6f:	a8 03                	test   $0x3,%al
+  800b71:	75 12                	jne    800b85 <memset+0x28>
+  800b73:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b77:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800b7d:	c1 e9 02             	shr    $0x2,%ecx
+  800b80:	fc                   	cld
+  800b81:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b83:	eb 06                	jmp    800b8b <memset+0x2e>
+  800b85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b88:	fc                   	cld
+  800b89:	f3 aa                	rep stos %al,%es:(%edi)
+  800b8b:	89 f8                	mov    %edi,%eax
+  800b8d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b90:	c9                   	leave
+  800b91:	c3                   	ret
+
+00800b92 <memmove>:
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	57                   	push   %edi
+  800b96:	56                   	push   %esi
+  800b97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b9d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ba0:	39 c6                	cmp    %eax,%esi
+  800ba2:	73 32                	jae    800bd6 <memmove+0x44>
+  800ba4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ba7:	39 d0                	cmp    %edx,%eax
+  800ba9:	73 2b                	jae    800bd6 <memmove+0x44>
+  800bab:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800bae:	89 d6                	mov    %edx,%esi
+  800bb0:	09 fe                	or     %edi,%esi
+  800bb2:	09 ce                	or     %ecx,%esi
+  800bb4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bba:	75 0e                	jne    800bca <memmove+0x38>
+  800bbc:	83 ef 04             	sub    $0x4,%edi
+  800bbf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bc2:	c1 e9 02             	shr    $0x2,%ecx
+  800bc5:	fd                   	std
+  800bc6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bc8:	eb 09                	jmp    800bd3 <memmove+0x41>
+  800bca:	83 ef 01             	sub    $0x1,%edi
+  800bcd:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800bd0:	fd                   	std
+  800bd1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800bd3:	fc                   	cld
+  800bd4:	eb 1a                	jmp    800bf0 <memmove+0x5e>
+  800bd6:	89 f2                	mov    %esi,%edx
+  800bd8:	09 c2                	or     %eax,%edx
+  800bda:	09 ca                	or     %ecx,%edx
+  800bdc:	f6 c2 03             	test   $0x3,%dl
+  800bdf:	75 0a                	jne    800beb <memmove+0x59>
+  800be1:	c1 e9 02             	shr    $0x2,%ecx
+  800be4:	89 c7                	mov    %eax,%edi
+  800be6:	fc                   	cld
+  800be7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800be9:	eb 05                	jmp    800bf0 <memmove+0x5e>
+  800beb:	89 c7                	mov    %eax,%edi
+  800bed:	fc                   	cld
+  800bee:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800bf0:	5e                   	pop    %esi
+  800bf1:	5f                   	pop    %edi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+
+00800bf4 <memcpy>:
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	83 ec 0c             	sub    $0xc,%esp
+  800bfa:	ff 75 10             	push   0x10(%ebp)
+  800bfd:	ff 75 0c             	push   0xc(%ebp)
+  800c00:	ff 75 08             	push   0x8(%ebp)
+  800c03:	e8 8a ff ff ff       	call   800b92 <memmove>
+  800c08:	c9                   	leave
+  800c09:	c3                   	ret
+
+00800c0a <memcmp>:
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	56                   	push   %esi
+  800c0e:	53                   	push   %ebx
+  800c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c15:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c18:	85 f6                	test   %esi,%esi
+  800c1a:	74 29                	je     800c45 <memcmp+0x3b>
+  800c1c:	01 c6                	add    %eax,%esi
+  800c1e:	0f b6 08             	movzbl (%eax),%ecx
+  800c21:	0f b6 1a             	movzbl (%edx),%ebx
+  800c24:	38 d9                	cmp    %bl,%cl
+  800c26:	75 11                	jne    800c39 <memcmp+0x2f>
+  800c28:	83 c0 01             	add    $0x1,%eax
+  800c2b:	83 c2 01             	add    $0x1,%edx
+  800c2e:	39 c6                	cmp    %eax,%esi
+  800c30:	75 ec                	jne    800c1e <memcmp+0x14>
+  800c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c37:	eb 08                	jmp    800c41 <memcmp+0x37>
+  800c39:	0f b6 c1             	movzbl %cl,%eax
+  800c3c:	0f b6 db             	movzbl %bl,%ebx
+  800c3f:	29 d8                	sub    %ebx,%eax
+  800c41:	5b                   	pop    %ebx
+  800c42:	5e                   	pop    %esi
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+  800c45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4a:	eb f5                	jmp    800c41 <memcmp+0x37>
+
+00800c4c <memfind>:
+  800c4c:	55                   	push   %ebp
+  800c4d:	89 e5                	mov    %esp,%ebp
+  800c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c55:	89 c2                	mov    %eax,%edx
+  800c57:	03 55 10             	add    0x10(%ebp),%edx
+  800c5a:	39 d0                	cmp    %edx,%eax
+  800c5c:	73 0d                	jae    800c6b <memfind+0x1f>
+  800c5e:	38 08                	cmp    %cl,(%eax)
+  800c60:	74 0d                	je     800c6f <memfind+0x23>
+  800c62:	83 c0 01             	add    $0x1,%eax
+  800c65:	39 c2                	cmp    %eax,%edx
+  800c67:	75 f5                	jne    800c5e <memfind+0x12>
+  800c69:	eb 06                	jmp    800c71 <memfind+0x25>
+  800c6b:	89 c2                	mov    %eax,%edx
+  800c6d:	eb 02                	jmp    800c71 <memfind+0x25>
+  800c6f:	89 c2                	mov    %eax,%edx
+  800c71:	89 d0                	mov    %edx,%eax
+  800c73:	5d                   	pop    %ebp
+  800c74:	c3                   	ret
+
+00800c75 <strtol>:
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	57                   	push   %edi
+  800c79:	56                   	push   %esi
+  800c7a:	53                   	push   %ebx
+  800c7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c81:	0f b6 02             	movzbl (%edx),%eax
+  800c84:	3c 20                	cmp    $0x20,%al
+  800c86:	74 04                	je     800c8c <strtol+0x17>
+  800c88:	3c 09                	cmp    $0x9,%al
+  800c8a:	75 0e                	jne    800c9a <strtol+0x25>
+  800c8c:	83 c2 01             	add    $0x1,%edx
+  800c8f:	0f b6 02             	movzbl (%edx),%eax
+  800c92:	3c 20                	cmp    $0x20,%al
+  800c94:	74 f6                	je     800c8c <strtol+0x17>
+  800c96:	3c 09                	cmp    $0x9,%al
+  800c98:	74 f2                	je     800c8c <strtol+0x17>
+  800c9a:	3c 2b                	cmp    $0x2b,%al
+  800c9c:	74 2a                	je     800cc8 <strtol+0x53>
+  800c9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca3:	3c 2d                	cmp    $0x2d,%al
+  800ca5:	74 2b                	je     800cd2 <strtol+0x5d>
+  800ca7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cad:	75 0f                	jne    800cbe <strtol+0x49>
+  800caf:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cb2:	74 28                	je     800cdc <strtol+0x67>
+  800cb4:	85 db                	test   %ebx,%ebx
+  800cb6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cbb:	0f 44 d8             	cmove  %eax,%ebx
+  800cbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cc6:	eb 46                	jmp    800d0e <strtol+0x99>
+  800cc8:	83 c2 01             	add    $0x1,%edx
+  800ccb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cd0:	eb d5                	jmp    800ca7 <strtol+0x32>
+  800cd2:	83 c2 01             	add    $0x1,%edx
+  800cd5:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cda:	eb cb                	jmp    800ca7 <strtol+0x32>
+  800cdc:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ce0:	74 0e                	je     800cf0 <strtol+0x7b>
+  800ce2:	85 db                	test   %ebx,%ebx
+  800ce4:	75 d8                	jne    800cbe <strtol+0x49>
+  800ce6:	83 c2 01             	add    $0x1,%edx
+  800ce9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cee:	eb ce                	jmp    800cbe <strtol+0x49>
+  800cf0:	83 c2 02             	add    $0x2,%edx
+  800cf3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cf8:	eb c4                	jmp    800cbe <strtol+0x49>
+  800cfa:	0f be c0             	movsbl %al,%eax
+  800cfd:	83 e8 30             	sub    $0x30,%eax
+  800d00:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d03:	7d 3a                	jge    800d3f <strtol+0xca>
+  800d05:	83 c2 01             	add    $0x1,%edx
+  800d08:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d0c:	01 c1                	add    %eax,%ecx
+  800d0e:	0f b6 02             	movzbl (%edx),%eax
+  800d11:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d14:	89 f3                	mov    %esi,%ebx
+  800d16:	80 fb 09             	cmp    $0x9,%bl
+  800d19:	76 df                	jbe    800cfa <strtol+0x85>
+  800d1b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d1e:	89 f3                	mov    %esi,%ebx
+  800d20:	80 fb 19             	cmp    $0x19,%bl
+  800d23:	77 08                	ja     800d2d <strtol+0xb8>
+  800d25:	0f be c0             	movsbl %al,%eax
+  800d28:	83 e8 57             	sub    $0x57,%eax
+  800d2b:	eb d3                	jmp    800d00 <strtol+0x8b>
+  800d2d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d30:	89 f3                	mov    %esi,%ebx
+  800d32:	80 fb 19             	cmp    $0x19,%bl
+  800d35:	77 08                	ja     800d3f <strtol+0xca>
+  800d37:	0f be c0             	movsbl %al,%eax
+  800d3a:	83 e8 37             	sub    $0x37,%eax
+  800d3d:	eb c1                	jmp    800d00 <strtol+0x8b>
+  800d3f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d43:	74 05                	je     800d4a <strtol+0xd5>
+  800d45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d48:	89 10                	mov    %edx,(%eax)
+  800d4a:	89 c8                	mov    %ecx,%eax
+  800d4c:	f7 d8                	neg    %eax
+  800d4e:	85 ff                	test   %edi,%edi
+  800d50:	0f 45 c8             	cmovne %eax,%ecx
+  800d53:	89 c8                	mov    %ecx,%eax
+  800d55:	5b                   	pop    %ebx
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+
+00800d5a <sys_cputs>:
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	57                   	push   %edi
+  800d5e:	56                   	push   %esi
+  800d5f:	53                   	push   %ebx
+  800d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6b:	89 c3                	mov    %eax,%ebx
+  800d6d:	89 c7                	mov    %eax,%edi
+  800d6f:	89 c6                	mov    %eax,%esi
+  800d71:	cd 30                	int    $0x30
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+
+00800d78 <sys_cgetc>:
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	57                   	push   %edi
+  800d7c:	56                   	push   %esi
+  800d7d:	53                   	push   %ebx
+  800d7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d88:	89 d1                	mov    %edx,%ecx
+  800d8a:	89 d3                	mov    %edx,%ebx
+  800d8c:	89 d7                	mov    %edx,%edi
+  800d8e:	89 d6                	mov    %edx,%esi
+  800d90:	cd 30                	int    $0x30
+  800d92:	5b                   	pop    %ebx
+  800d93:	5e                   	pop    %esi
+  800d94:	5f                   	pop    %edi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+
+00800d97 <sys_env_destroy>:
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	57                   	push   %edi
+  800d9b:	56                   	push   %esi
+  800d9c:	53                   	push   %ebx
+  800d9d:	83 ec 0c             	sub    $0xc,%esp
+  800da0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dad:	89 cb                	mov    %ecx,%ebx
+  800daf:	89 cf                	mov    %ecx,%edi
+  800db1:	89 ce                	mov    %ecx,%esi
+  800db3:	cd 30                	int    $0x30
+  800db5:	85 c0                	test   %eax,%eax
+  800db7:	7f 08                	jg     800dc1 <sys_env_destroy+0x2a>
+  800db9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbc:	5b                   	pop    %ebx
+  800dbd:	5e                   	pop    %esi
+  800dbe:	5f                   	pop    %edi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+  800dc4:	50                   	push   %eax
+  800dc5:	6a 03                	push   $0x3
+  800dc7:	68 4b 3a 80 00       	push   $0x803a4b
+  800dcc:	6a 24                	push   $0x24
+  800dce:	68 68 3a 80 00       	push   $0x803a68
+  800dd3:	e8 37 20 00 00       	call   802e0f <_panic>
+
+00800dd8 <sys_getenvid>:
+  800dd8:	55                   	push   %ebp
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	57                   	push   %edi
+  800ddc:	56                   	push   %esi
+  800ddd:	53                   	push   %ebx
+  800dde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800de8:	89 d1                	mov    %edx,%ecx
+  800dea:	89 d3                	mov    %edx,%ebx
+  800dec:	89 d7                	mov    %edx,%edi
+  800dee:	89 d6                	mov    %edx,%esi
+  800df0:	cd 30                	int    $0x30
+  800df2:	5b                   	pop    %ebx
+  800df3:	5e                   	pop    %esi
+  800df4:	5f                   	pop    %edi
+  800df5:	5d                   	pop    %ebp
+  800df6:	c3                   	ret
+
+00800df7 <sys_yield>:
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	57                   	push   %edi
+  800dfb:	56                   	push   %esi
+  800dfc:	53                   	push   %ebx
+  800dfd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e04:	74 26                	je     800e2c <sys_yield+0x35>
+  800e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e10:	89 d1                	mov    %edx,%ecx
+  800e12:	89 d3                	mov    %edx,%ebx
+  800e14:	89 d7                	mov    %edx,%edi
+  800e16:	6a 00                	push   $0x0
+  800e18:	55                   	push   %ebp
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	8d 35 23 0e 80 00    	lea    0x800e23,%esi
+  800e21:	0f 34                	sysenter
+  800e23:	5d                   	pop    %ebp
+  800e24:	83 c4 04             	add    $0x4,%esp
+  800e27:	5b                   	pop    %ebx
+  800e28:	5e                   	pop    %esi
+  800e29:	5f                   	pop    %edi
+  800e2a:	5d                   	pop    %ebp
+  800e2b:	c3                   	ret
+  800e2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e31:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e36:	89 d1                	mov    %edx,%ecx
+  800e38:	89 d3                	mov    %edx,%ebx
+  800e3a:	89 d7                	mov    %edx,%edi
+  800e3c:	89 d6                	mov    %edx,%esi
+  800e3e:	cd 30                	int    $0x30
+  800e40:	eb e5                	jmp    800e27 <sys_yield+0x30>
+
+00800e42 <sys_page_alloc>:
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  800e48:	83 ec 0c             	sub    $0xc,%esp
+  800e4b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e56:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5e:	89 f7                	mov    %esi,%edi
+  800e60:	cd 30                	int    $0x30
+  800e62:	85 c0                	test   %eax,%eax
+  800e64:	7f 08                	jg     800e6e <sys_page_alloc+0x2c>
+  800e66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e69:	5b                   	pop    %ebx
+  800e6a:	5e                   	pop    %esi
+  800e6b:	5f                   	pop    %edi
+  800e6c:	5d                   	pop    %ebp
+  800e6d:	c3                   	ret
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+  800e71:	50                   	push   %eax
+  800e72:	6a 04                	push   $0x4
+  800e74:	68 4b 3a 80 00       	push   $0x803a4b
+  800e79:	6a 24                	push   $0x24
+  800e7b:	68 68 3a 80 00       	push   $0x803a68
+  800e80:	e8 8a 1f 00 00       	call   802e0f <_panic>
+
+00800e85 <sys_page_map>:
+  800e85:	55                   	push   %ebp
+  800e86:	89 e5                	mov    %esp,%ebp
+  800e88:	57                   	push   %edi
+  800e89:	56                   	push   %esi
+  800e8a:	53                   	push   %ebx
+  800e8b:	83 ec 0c             	sub    $0xc,%esp
+  800e8e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e95:	74 33                	je     800eca <sys_page_map+0x45>
+  800e97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ea2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea8:	ff 75 18             	push   0x18(%ebp)
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	8d 35 b6 0e 80 00    	lea    0x800eb6,%esi
+  800eb4:	0f 34                	sysenter
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	83 c4 04             	add    $0x4,%esp
+  800eba:	89 c2                	mov    %eax,%edx
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	7f 3d                	jg     800efd <sys_page_map+0x78>
+  800ec0:	89 d0                	mov    %edx,%eax
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+  800eca:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800edb:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ede:	cd 30                	int    $0x30
+  800ee0:	89 c2                	mov    %eax,%edx
+  800ee2:	85 c0                	test   %eax,%eax
+  800ee4:	7e da                	jle    800ec0 <sys_page_map+0x3b>
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+  800ee9:	50                   	push   %eax
+  800eea:	6a 05                	push   $0x5
+  800eec:	68 4b 3a 80 00       	push   $0x803a4b
+  800ef1:	6a 24                	push   $0x24
+  800ef3:	68 68 3a 80 00       	push   $0x803a68
+  800ef8:	e8 12 1f 00 00       	call   802e0f <_panic>
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	50                   	push   %eax
+  800f01:	6a 05                	push   $0x5
+  800f03:	68 4b 3a 80 00       	push   $0x803a4b
+  800f08:	6a 48                	push   $0x48
+  800f0a:	68 68 3a 80 00       	push   $0x803a68
+  800f0f:	e8 fb 1e 00 00       	call   802e0f <_panic>
+
+00800f14 <sys_page_unmap>:
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	56                   	push   %esi
+  800f19:	53                   	push   %ebx
+  800f1a:	83 ec 0c             	sub    $0xc,%esp
+  800f1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f28:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f2d:	89 df                	mov    %ebx,%edi
+  800f2f:	89 de                	mov    %ebx,%esi
+  800f31:	cd 30                	int    $0x30
+  800f33:	85 c0                	test   %eax,%eax
+  800f35:	7f 08                	jg     800f3f <sys_page_unmap+0x2b>
+  800f37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  800f42:	50                   	push   %eax
+  800f43:	6a 06                	push   $0x6
+  800f45:	68 4b 3a 80 00       	push   $0x803a4b
+  800f4a:	6a 24                	push   $0x24
+  800f4c:	68 68 3a 80 00       	push   $0x803a68
+  800f51:	e8 b9 1e 00 00       	call   802e0f <_panic>
+
+00800f56 <sys_fork>:
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+  800f5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f61:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f66:	89 d1                	mov    %edx,%ecx
+  800f68:	89 d3                	mov    %edx,%ebx
+  800f6a:	89 d7                	mov    %edx,%edi
+  800f6c:	89 d6                	mov    %edx,%esi
+  800f6e:	cd 30                	int    $0x30
+  800f70:	5b                   	pop    %ebx
+  800f71:	5e                   	pop    %esi
+  800f72:	5f                   	pop    %edi
+  800f73:	5d                   	pop    %ebp
+  800f74:	c3                   	ret
+
+00800f75 <sys_env_set_status>:
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	57                   	push   %edi
+  800f79:	56                   	push   %esi
+  800f7a:	53                   	push   %ebx
+  800f7b:	83 ec 0c             	sub    $0xc,%esp
+  800f7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f89:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f8e:	89 df                	mov    %ebx,%edi
+  800f90:	89 de                	mov    %ebx,%esi
+  800f92:	cd 30                	int    $0x30
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 08                	jg     800fa0 <sys_env_set_status+0x2b>
+  800f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	6a 08                	push   $0x8
+  800fa6:	68 4b 3a 80 00       	push   $0x803a4b
+  800fab:	6a 24                	push   $0x24
+  800fad:	68 68 3a 80 00       	push   $0x803a68
+  800fb2:	e8 58 1e 00 00       	call   802e0f <_panic>
+
+00800fb7 <sys_env_set_trapframe>:
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+  800fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fd0:	89 df                	mov    %ebx,%edi
+  800fd2:	89 de                	mov    %ebx,%esi
+  800fd4:	cd 30                	int    $0x30
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	7f 08                	jg     800fe2 <sys_env_set_trapframe+0x2b>
+  800fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5f                   	pop    %edi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+  800fe2:	83 ec 0c             	sub    $0xc,%esp
+  800fe5:	50                   	push   %eax
+  800fe6:	6a 09                	push   $0x9
+  800fe8:	68 4b 3a 80 00       	push   $0x803a4b
+  800fed:	6a 24                	push   $0x24
+  800fef:	68 68 3a 80 00       	push   $0x803a68
+  800ff4:	e8 16 1e 00 00       	call   802e0f <_panic>
+
+00800ff9 <sys_env_set_cow>:
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 08                	jg     801024 <sys_env_set_cow+0x2b>
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 20                	push   $0x20
+  80102a:	68 4b 3a 80 00       	push   $0x803a4b
+  80102f:	6a 24                	push   $0x24
+  801031:	68 68 3a 80 00       	push   $0x803a68
+  801036:	e8 d4 1d 00 00       	call   802e0f <_panic>
+
+0080103b <sys_env_service>:
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801046:	8b 55 08             	mov    0x8(%ebp),%edx
+  801049:	b8 21 00 00 00       	mov    $0x21,%eax
+  80104e:	89 cb                	mov    %ecx,%ebx
+  801050:	89 cf                	mov    %ecx,%edi
+  801052:	89 ce                	mov    %ecx,%esi
+  801054:	cd 30                	int    $0x30
+  801056:	5b                   	pop    %ebx
+  801057:	5e                   	pop    %esi
+  801058:	5f                   	pop    %edi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+
+0080105b <sys_env_set_pgfault_upcall>:
+  80105b:	55                   	push   %ebp
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	57                   	push   %edi
+  80105f:	56                   	push   %esi
+  801060:	53                   	push   %ebx
+  801061:	83 ec 0c             	sub    $0xc,%esp
+  801064:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801074:	89 df                	mov    %ebx,%edi
+  801076:	89 de                	mov    %ebx,%esi
+  801078:	cd 30                	int    $0x30
+  80107a:	85 c0                	test   %eax,%eax
+  80107c:	7f 08                	jg     801086 <sys_env_set_pgfault_upcall+0x2b>
+  80107e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801081:	5b                   	pop    %ebx
+  801082:	5e                   	pop    %esi
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+  801086:	83 ec 0c             	sub    $0xc,%esp
+  801089:	50                   	push   %eax
+  80108a:	6a 0a                	push   $0xa
+  80108c:	68 4b 3a 80 00       	push   $0x803a4b
+  801091:	6a 24                	push   $0x24
+  801093:	68 68 3a 80 00       	push   $0x803a68
+  801098:	e8 72 1d 00 00       	call   802e0f <_panic>
+
+0080109d <sys_ipc_try_send>:
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	57                   	push   %edi
+  8010a1:	56                   	push   %esi
+  8010a2:	53                   	push   %ebx
+  8010a3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010aa:	74 27                	je     8010d3 <sys_ipc_try_send+0x36>
+  8010ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010bd:	6a 00                	push   $0x0
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	8d 35 ca 10 80 00    	lea    0x8010ca,%esi
+  8010c8:	0f 34                	sysenter
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	83 c4 04             	add    $0x4,%esp
+  8010ce:	5b                   	pop    %ebx
+  8010cf:	5e                   	pop    %esi
+  8010d0:	5f                   	pop    %edi
+  8010d1:	5d                   	pop    %ebp
+  8010d2:	c3                   	ret
+  8010d3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e9:	cd 30                	int    $0x30
+  8010eb:	eb e1                	jmp    8010ce <sys_ipc_try_send+0x31>
+
+008010ed <sys_ipc_recv>:
+  8010ed:	55                   	push   %ebp
+  8010ee:	89 e5                	mov    %esp,%ebp
+  8010f0:	57                   	push   %edi
+  8010f1:	56                   	push   %esi
+  8010f2:	53                   	push   %ebx
+  8010f3:	83 ec 0c             	sub    $0xc,%esp
+  8010f6:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010fd:	74 32                	je     801131 <sys_ipc_recv+0x44>
+  8010ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801102:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801107:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80110c:	89 cb                	mov    %ecx,%ebx
+  80110e:	89 cf                	mov    %ecx,%edi
+  801110:	6a 00                	push   $0x0
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	8d 35 1d 11 80 00    	lea    0x80111d,%esi
+  80111b:	0f 34                	sysenter
+  80111d:	5d                   	pop    %ebp
+  80111e:	83 c4 04             	add    $0x4,%esp
+  801121:	89 c2                	mov    %eax,%edx
+  801123:	85 c0                	test   %eax,%eax
+  801125:	7f 3c                	jg     801163 <sys_ipc_recv+0x76>
+  801127:	89 d0                	mov    %edx,%eax
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+  801131:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801136:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80113b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113e:	89 cb                	mov    %ecx,%ebx
+  801140:	89 cf                	mov    %ecx,%edi
+  801142:	89 ce                	mov    %ecx,%esi
+  801144:	cd 30                	int    $0x30
+  801146:	89 c2                	mov    %eax,%edx
+  801148:	85 c0                	test   %eax,%eax
+  80114a:	7e db                	jle    801127 <sys_ipc_recv+0x3a>
+  80114c:	83 ec 0c             	sub    $0xc,%esp
+  80114f:	50                   	push   %eax
+  801150:	6a 0d                	push   $0xd
+  801152:	68 4b 3a 80 00       	push   $0x803a4b
+  801157:	6a 24                	push   $0x24
+  801159:	68 68 3a 80 00       	push   $0x803a68
+  80115e:	e8 ac 1c 00 00       	call   802e0f <_panic>
+  801163:	83 ec 0c             	sub    $0xc,%esp
+  801166:	50                   	push   %eax
+  801167:	6a 0d                	push   $0xd
+  801169:	68 4b 3a 80 00       	push   $0x803a4b
+  80116e:	6a 48                	push   $0x48
+  801170:	68 68 3a 80 00       	push   $0x803a68
+  801175:	e8 95 1c 00 00       	call   802e0f <_panic>
+
+0080117a <sys_ipc_send>:
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801187:	74 27                	je     8011b0 <sys_ipc_send+0x36>
+  801189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801194:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801197:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119a:	6a 00                	push   $0x0
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	8d 35 a7 11 80 00    	lea    0x8011a7,%esi
+  8011a5:	0f 34                	sysenter
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	83 c4 04             	add    $0x4,%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+  8011b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c6:	cd 30                	int    $0x30
+  8011c8:	eb e1                	jmp    8011ab <sys_ipc_send+0x31>
+
+008011ca <sys_ipc_call>:
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011e4:	cd 30                	int    $0x30
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+
+008011eb <sys_ipc_reply_recv>:
+  8011eb:	55                   	push   %ebp
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	57                   	push   %edi
+  8011ef:	56                   	push   %esi
+  8011f0:	53                   	push   %ebx
+  8011f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801202:	8b 75 18             	mov    0x18(%ebp),%esi
+  801205:	cd 30                	int    $0x30
+  801207:	5b                   	pop    %ebx
+  801208:	5e                   	pop    %esi
+  801209:	5f                   	pop    %edi
+  80120a:	5d                   	pop    %ebp
+  80120b:	c3                   	ret
+
+0080120c <sys_time_msec>:
+  80120c:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801211:	85 c0                	test   %eax,%eax
+  801213:	75 06                	jne    80121b <sys_time_msec+0xf>
+  801215:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80121a:	c3                   	ret
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	56                   	push   %esi
+  801220:	53                   	push   %ebx
+  801221:	83 ec 0c             	sub    $0xc,%esp
+  801224:	0f 31                	rdtsc
+  801226:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80122c:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801232:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801238:	29 c8                	sub    %ecx,%eax
+  80123a:	19 da                	sbb    %ebx,%edx
+  80123c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801241:	57                   	push   %edi
+  801242:	56                   	push   %esi
+  801243:	52                   	push   %edx
+  801244:	50                   	push   %eax
+  801245:	e8 b6 22 00 00       	call   803500 <__udivdi3>
+  80124a:	83 c4 10             	add    $0x10,%esp
+  80124d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801250:	5b                   	pop    %ebx
+  801251:	5e                   	pop    %esi
+  801252:	5f                   	pop    %edi
+  801253:	5d                   	pop    %ebp
+  801254:	c3                   	ret
+
+00801255 <sys_env_swap>:
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	57                   	push   %edi
+  801259:	56                   	push   %esi
+  80125a:	53                   	push   %ebx
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+  80125e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	b8 12 00 00 00       	mov    $0x12,%eax
+  80126b:	89 cb                	mov    %ecx,%ebx
+  80126d:	89 cf                	mov    %ecx,%edi
+  80126f:	89 ce                	mov    %ecx,%esi
+  801271:	cd 30                	int    $0x30
+  801273:	85 c0                	test   %eax,%eax
+  801275:	7f 08                	jg     80127f <sys_env_swap+0x2a>
+  801277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127a:	5b                   	pop    %ebx
+  80127b:	5e                   	pop    %esi
+  80127c:	5f                   	pop    %edi
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+  80127f:	83 ec 0c             	sub    $0xc,%esp
+  801282:	50                   	push   %eax
+  801283:	6a 12                	push   $0x12
+  801285:	68 4b 3a 80 00       	push   $0x803a4b
+  80128a:	6a 24                	push   $0x24
+  80128c:	68 68 3a 80 00       	push   $0x803a68
+  801291:	e8 79 1b 00 00       	call   802e0f <_panic>
+
+00801296 <sys_net_try_send>:
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	57                   	push   %edi
+  80129a:	56                   	push   %esi
+  80129b:	53                   	push   %ebx
+  80129c:	83 ec 0c             	sub    $0xc,%esp
+  80129f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012aa:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012af:	89 df                	mov    %ebx,%edi
+  8012b1:	89 de                	mov    %ebx,%esi
+  8012b3:	cd 30                	int    $0x30
+  8012b5:	85 c0                	test   %eax,%eax
+  8012b7:	7f 08                	jg     8012c1 <sys_net_try_send+0x2b>
+  8012b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bc:	5b                   	pop    %ebx
+  8012bd:	5e                   	pop    %esi
+  8012be:	5f                   	pop    %edi
+  8012bf:	5d                   	pop    %ebp
+  8012c0:	c3                   	ret
+  8012c1:	83 ec 0c             	sub    $0xc,%esp
+  8012c4:	50                   	push   %eax
+  8012c5:	6a 13                	push   $0x13
+  8012c7:	68 4b 3a 80 00       	push   $0x803a4b
+  8012cc:	6a 24                	push   $0x24
+  8012ce:	68 68 3a 80 00       	push   $0x803a68
+  8012d3:	e8 37 1b 00 00       	call   802e0f <_panic>
+
+008012d8 <sys_net_try_receive>:
+  8012d8:	55                   	push   %ebp
+  8012d9:	89 e5                	mov    %esp,%ebp
+  8012db:	57                   	push   %edi
+  8012dc:	56                   	push   %esi
+  8012dd:	53                   	push   %ebx
+  8012de:	83 ec 0c             	sub    $0xc,%esp
+  8012e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ec:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012f1:	89 df                	mov    %ebx,%edi
+  8012f3:	89 de                	mov    %ebx,%esi
+  8012f5:	cd 30                	int    $0x30
+  8012f7:	85 c0                	test   %eax,%eax
+  8012f9:	7f 08                	jg     801303 <sys_net_try_receive+0x2b>
+  8012fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fe:	5b                   	pop    %ebx
+  8012ff:	5e                   	pop    %esi
+  801300:	5f                   	pop    %edi
+  801301:	5d                   	pop    %ebp
+  801302:	c3                   	ret
+  801303:	83 ec 0c             	sub    $0xc,%esp
+  801306:	50                   	push   %eax
+  801307:	6a 14                	push   $0x14
+  801309:	68 4b 3a 80 00       	push   $0x803a4b
+  80130e:	6a 24                	push   $0x24
+  801310:	68 68 3a 80 00       	push   $0x803a68
+  801315:	e8 f5 1a 00 00       	call   802e0f <_panic>
+
+0080131a <sys_net_recv_page>:
+  80131a:	55                   	push   %ebp
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	57                   	push   %edi
+  80131e:	56                   	push   %esi
+  80131f:	53                   	push   %ebx
+  801320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801325:	8b 55 08             	mov    0x8(%ebp),%edx
+  801328:	b8 27 00 00 00       	mov    $0x27,%eax
+  80132d:	89 cb                	mov    %ecx,%ebx
+  80132f:	89 cf                	mov    %ecx,%edi
+  801331:	89 ce                	mov    %ecx,%esi
+  801333:	cd 30                	int    $0x30
+  801335:	5b                   	pop    %ebx
+  801336:	5e                   	pop    %esi
+  801337:	5f                   	pop    %edi
+  801338:	5d                   	pop    %ebp
+  801339:	c3                   	ret
+
+0080133a <sys_net_wait>:
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	ba 00 00 00 00       	mov    $0x0,%edx
+  801345:	b8 26 00 00 00       	mov    $0x26,%eax
+  80134a:	89 d1                	mov    %edx,%ecx
+  80134c:	89 d3                	mov    %edx,%ebx
+  80134e:	89 d7                	mov    %edx,%edi
+  801350:	89 d6                	mov    %edx,%esi
+  801352:	cd 30                	int    $0x30
+  801354:	5b                   	pop    %ebx
+  801355:	5e                   	pop    %esi
+  801356:	5f                   	pop    %edi
+  801357:	5d                   	pop    %ebp
+  801358:	c3                   	ret
+
+00801359 <sys_get_mac>:
+  801359:	55                   	push   %ebp
+  80135a:	89 e5                	mov    %esp,%ebp
+  80135c:	57                   	push   %edi
+  80135d:	56                   	push   %esi
+  80135e:	53                   	push   %ebx
+  80135f:	83 ec 0c             	sub    $0xc,%esp
+  801362:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801367:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801372:	89 df                	mov    %ebx,%edi
+  801374:	89 de                	mov    %ebx,%esi
+  801376:	cd 30                	int    $0x30
+  801378:	85 c0                	test   %eax,%eax
+  80137a:	7f 08                	jg     801384 <sys_get_mac+0x2b>
+  80137c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137f:	5b                   	pop    %ebx
+  801380:	5e                   	pop    %esi
+  801381:	5f                   	pop    %edi
+  801382:	5d                   	pop    %ebp
+  801383:	c3                   	ret
+  801384:	83 ec 0c             	sub    $0xc,%esp
+  801387:	50                   	push   %eax
+  801388:	6a 15                	push   $0x15
+  80138a:	68 4b 3a 80 00       	push   $0x803a4b
+  80138f:	6a 24                	push   $0x24
+  801391:	68 68 3a 80 00       	push   $0x803a68
+  801396:	e8 74 1a 00 00       	call   802e0f <_panic>
+
+0080139b <sys_env_lease>:
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  80139e:	57                   	push   %edi
+  80139f:	56                   	push   %esi
+  8013a0:	53                   	push   %ebx
+  8013a1:	83 ec 0c             	sub    $0xc,%esp
+  8013a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013af:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013b4:	89 df                	mov    %ebx,%edi
+  8013b6:	89 de                	mov    %ebx,%esi
+  8013b8:	cd 30                	int    $0x30
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	7f 08                	jg     8013c6 <sys_env_lease+0x2b>
+  8013be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c1:	5b                   	pop    %ebx
+  8013c2:	5e                   	pop    %esi
+  8013c3:	5f                   	pop    %edi
+  8013c4:	5d                   	pop    %ebp
+  8013c5:	c3                   	ret
+  8013c6:	83 ec 0c             	sub    $0xc,%esp
+  8013c9:	50                   	push   %eax
+  8013ca:	6a 16                	push   $0x16
+  8013cc:	68 4b 3a 80 00       	push   $0x803a4b
+  8013d1:	6a 24                	push   $0x24
+  8013d3:	68 68 3a 80 00       	push   $0x803a68
+  8013d8:	e8 32 1a 00 00       	call   802e0f <_panic>
+
+008013dd <sys_copy_mem>:
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	57                   	push   %edi
+  8013e1:	56                   	push   %esi
+  8013e2:	53                   	push   %ebx
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ec:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013fa:	cd 30                	int    $0x30
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	7f 08                	jg     801408 <sys_copy_mem+0x2b>
+  801400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801403:	5b                   	pop    %ebx
+  801404:	5e                   	pop    %esi
+  801405:	5f                   	pop    %edi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	50                   	push   %eax
+  80140c:	6a 17                	push   $0x17
+  80140e:	68 4b 3a 80 00       	push   $0x803a4b
+  801413:	6a 24                	push   $0x24
+  801415:	68 68 3a 80 00       	push   $0x803a68
+  80141a:	e8 f0 19 00 00       	call   802e0f <_panic>
+
+0080141f <sys_get_perms>:
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	57                   	push   %edi
+  801423:	56                   	push   %esi
+  801424:	53                   	push   %ebx
+  801425:	83 ec 0c             	sub    $0xc,%esp
+  801428:	be 00 00 00 00       	mov    $0x0,%esi
+  80142d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801433:	b8 18 00 00 00       	mov    $0x18,%eax
+  801438:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143b:	89 f7                	mov    %esi,%edi
+  80143d:	cd 30                	int    $0x30
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	7f 08                	jg     80144b <sys_get_perms+0x2c>
+  801443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801446:	5b                   	pop    %ebx
+  801447:	5e                   	pop    %esi
+  801448:	5f                   	pop    %edi
+  801449:	5d                   	pop    %ebp
+  80144a:	c3                   	ret
+  80144b:	83 ec 0c             	sub    $0xc,%esp
+  80144e:	50                   	push   %eax
+  80144f:	6a 18                	push   $0x18
+  801451:	68 4b 3a 80 00       	push   $0x803a4b
+  801456:	6a 24                	push   $0x24
+  801458:	68 68 3a 80 00       	push   $0x803a68
+  80145d:	e8 ad 19 00 00       	call   802e0f <_panic>
+
+00801462 <sys_env_unsuspend>:
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	57                   	push   %edi
+  801466:	56                   	push   %esi
+  801467:	53                   	push   %ebx
+  801468:	83 ec 0c             	sub    $0xc,%esp
+  80146b:	be 00 00 00 00       	mov    $0x0,%esi
+  801470:	8b 55 08             	mov    0x8(%ebp),%edx
+  801473:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801476:	b8 19 00 00 00       	mov    $0x19,%eax
+  80147b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147e:	89 f7                	mov    %esi,%edi
+  801480:	cd 30                	int    $0x30
+  801482:	85 c0                	test   %eax,%eax
+  801484:	7f 08                	jg     80148e <sys_env_unsuspend+0x2c>
+  801486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801489:	5b                   	pop    %ebx
+  80148a:	5e                   	pop    %esi
+  80148b:	5f                   	pop    %edi
+  80148c:	5d                   	pop    %ebp
+  80148d:	c3                   	ret
+  80148e:	83 ec 0c             	sub    $0xc,%esp
+  801491:	50                   	push   %eax
+  801492:	6a 19                	push   $0x19
+  801494:	68 4b 3a 80 00       	push   $0x803a4b
+  801499:	6a 24                	push   $0x24
+  80149b:	68 68 3a 80 00       	push   $0x803a68
+  8014a0:	e8 6a 19 00 00       	call   802e0f <_panic>
+
+008014a5 <sys_migrate>:
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+  8014ab:	83 ec 0c             	sub    $0xc,%esp
+  8014ae:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8014b3:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8014b9:	76 11                	jbe    8014cc <sys_migrate+0x27>
+  8014bb:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8014c0:	0f b6 08             	movzbl (%eax),%ecx
+  8014c3:	05 00 10 00 00       	add    $0x1000,%eax
+  8014c8:	39 d0                	cmp    %edx,%eax
+  8014ca:	72 f4                	jb     8014c0 <sys_migrate+0x1b>
+  8014cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014d9:	89 cb                	mov    %ecx,%ebx
+  8014db:	89 cf                	mov    %ecx,%edi
+  8014dd:	89 ce                	mov    %ecx,%esi
+  8014df:	cd 30                	int    $0x30
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	7f 08                	jg     8014ed <sys_migrate+0x48>
+  8014e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+  8014ed:	83 ec 0c             	sub    $0xc,%esp
+  8014f0:	50                   	push   %eax
+  8014f1:	6a 1a                	push   $0x1a
+  8014f3:	68 4b 3a 80 00       	push   $0x803a4b
+  8014f8:	6a 24                	push   $0x24
+  8014fa:	68 68 3a 80 00       	push   $0x803a68
+  8014ff:	e8 0b 19 00 00       	call   802e0f <_panic>
+
+00801504 <sys_lease_complete>:
+  801504:	55                   	push   %ebp
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	57                   	push   %edi
+  801508:	56                   	push   %esi
+  801509:	53                   	push   %ebx
+  80150a:	83 ec 0c             	sub    $0xc,%esp
+  80150d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801512:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801517:	89 d1                	mov    %edx,%ecx
+  801519:	89 d3                	mov    %edx,%ebx
+  80151b:	89 d7                	mov    %edx,%edi
+  80151d:	89 d6                	mov    %edx,%esi
+  80151f:	cd 30                	int    $0x30
+  801521:	85 c0                	test   %eax,%eax
+  801523:	7f 08                	jg     80152d <sys_lease_complete+0x29>
+  801525:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801528:	5b                   	pop    %ebx
+  801529:	5e                   	pop    %esi
+  80152a:	5f                   	pop    %edi
+  80152b:	5d                   	pop    %ebp
+  80152c:	c3                   	ret
+  80152d:	83 ec 0c             	sub    $0xc,%esp
+  801530:	50                   	push   %eax
+  801531:	6a 1b                	push   $0x1b
+  801533:	68 4b 3a 80 00       	push   $0x803a4b
+  801538:	6a 24                	push   $0x24
+  80153a:	68 68 3a 80 00       	push   $0x803a68
+  80153f:	e8 cb 18 00 00       	call   802e0f <_panic>
+
+00801544 <sys_env_set_thisenv>:
+  801544:	55                   	push   %ebp
+  801545:	89 e5                	mov    %esp,%ebp
+  801547:	57                   	push   %edi
+  801548:	56                   	push   %esi
+  801549:	53                   	push   %ebx
+  80154a:	83 ec 0c             	sub    $0xc,%esp
+  80154d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801552:	8b 55 08             	mov    0x8(%ebp),%edx
+  801555:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801558:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80155d:	89 df                	mov    %ebx,%edi
+  80155f:	89 de                	mov    %ebx,%esi
+  801561:	cd 30                	int    $0x30
+  801563:	85 c0                	test   %eax,%eax
+  801565:	7f 08                	jg     80156f <sys_env_set_thisenv+0x2b>
+  801567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156a:	5b                   	pop    %ebx
+  80156b:	5e                   	pop    %esi
+  80156c:	5f                   	pop    %edi
+  80156d:	5d                   	pop    %ebp
+  80156e:	c3                   	ret
+  80156f:	83 ec 0c             	sub    $0xc,%esp
+  801572:	50                   	push   %eax
+  801573:	6a 1c                	push   $0x1c
+  801575:	68 4b 3a 80 00       	push   $0x803a4b
+  80157a:	6a 24                	push   $0x24
+  80157c:	68 68 3a 80 00       	push   $0x803a68
+  801581:	e8 89 18 00 00       	call   802e0f <_panic>
+
+00801586 <sys_env_set_sched>:
+  801586:	55                   	push   %ebp
+  801587:	89 e5                	mov    %esp,%ebp
+  801589:	57                   	push   %edi
+  80158a:	56                   	push   %esi
+  80158b:	53                   	push   %ebx
+  80158c:	83 ec 0c             	sub    $0xc,%esp
+  80158f:	be 00 00 00 00       	mov    $0x0,%esi
+  801594:	8b 55 08             	mov    0x8(%ebp),%edx
+  801597:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80159f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a2:	89 f7                	mov    %esi,%edi
+  8015a4:	cd 30                	int    $0x30
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	7f 08                	jg     8015b2 <sys_env_set_sched+0x2c>
+  8015aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ad:	5b                   	pop    %ebx
+  8015ae:	5e                   	pop    %esi
+  8015af:	5f                   	pop    %edi
+  8015b0:	5d                   	pop    %ebp
+  8015b1:	c3                   	ret
+  8015b2:	83 ec 0c             	sub    $0xc,%esp
+  8015b5:	50                   	push   %eax
+  8015b6:	6a 1d                	push   $0x1d
+  8015b8:	68 4b 3a 80 00       	push   $0x803a4b
+  8015bd:	6a 24                	push   $0x24
+  8015bf:	68 68 3a 80 00       	push   $0x803a68
+  8015c4:	e8 46 18 00 00       	call   802e0f <_panic>
+
+008015c9 <sys_batch>:
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	57                   	push   %edi
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+  8015cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015da:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8015df:	89 df                	mov    %ebx,%edi
+  8015e1:	89 de                	mov    %ebx,%esi
+  8015e3:	cd 30                	int    $0x30
+  8015e5:	5b                   	pop    %ebx
+  8015e6:	5e                   	pop    %esi
+  8015e7:	5f                   	pop    %edi
+  8015e8:	5d                   	pop    %ebp
+  8015e9:	c3                   	ret
+
+008015ea <sys_env_stats>:
+  8015ea:	55                   	push   %ebp
+  8015eb:	89 e5                	mov    %esp,%ebp
+  8015ed:	57                   	push   %edi
+  8015ee:	56                   	push   %esi
+  8015ef:	53                   	push   %ebx
+  8015f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fb:	b8 23 00 00 00       	mov    $0x23,%eax
+  801600:	89 df                	mov    %ebx,%edi
+  801602:	89 de                	mov    %ebx,%esi
+  801604:	cd 30                	int    $0x30
+  801606:	5b                   	pop    %ebx
+  801607:	5e                   	pop    %esi
+  801608:	5f                   	pop    %edi
+  801609:	5d                   	pop    %ebp
+  80160a:	c3                   	ret
+
+0080160b <sys_trace>:
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	57                   	push   %edi
+  80160f:	56                   	push   %esi
+  801610:	53                   	push   %ebx
+  801611:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801616:	8b 55 08             	mov    0x8(%ebp),%edx
+  801619:	b8 24 00 00 00       	mov    $0x24,%eax
+  80161e:	89 cb                	mov    %ecx,%ebx
+  801620:	89 cf                	mov    %ecx,%edi
+  801622:	89 ce                	mov    %ecx,%esi
+  801624:	cd 30                	int    $0x30
+  801626:	5b                   	pop    %ebx
+  801627:	5e                   	pop    %esi
+  801628:	5f                   	pop    %edi
+  801629:	5d                   	pop    %ebp
+  80162a:	c3                   	ret
+
+0080162b <sys_env_set_pager>:
+  80162b:	55                   	push   %ebp
+  80162c:	89 e5                	mov    %esp,%ebp
+  80162e:	57                   	push   %edi
+  80162f:	56                   	push   %esi
+  801630:	53                   	push   %ebx
+  801631:	83 ec 0c             	sub    $0xc,%esp
+  801634:	be 00 00 00 00       	mov    $0x0,%esi
+  801639:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163f:	b8 25 00 00 00       	mov    $0x25,%eax
+  801644:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801647:	89 f7                	mov    %esi,%edi
+  801649:	cd 30                	int    $0x30
+  80164b:	85 c0                	test   %eax,%eax
+  80164d:	7f 08                	jg     801657 <sys_env_set_pager+0x2c>
+  80164f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801652:	5b                   	pop    %ebx
+  801653:	5e                   	pop    %esi
+  801654:	5f                   	pop    %edi
+  801655:	5d                   	pop    %ebp
+  801656:	c3                   	ret
+  801657:	83 ec 0c             	sub    $0xc,%esp
+  80165a:	50                   	push   %eax
+  80165b:	6a 25                	push   $0x25
+  80165d:	68 4b 3a 80 00       	push   $0x803a4b
+  801662:	6a 24                	push   $0x24
+  801664:	68 68 3a 80 00       	push   $0x803a68
+  801669:	e8 a1 17 00 00       	call   802e0f <_panic>
+
+0080166e <sys_pager_retire>:
+  80166e:	55                   	push   %ebp
+  80166f:	89 e5                	mov    %esp,%ebp
+  801671:	57                   	push   %edi
+  801672:	56                   	push   %esi
+  801673:	53                   	push   %ebx
+  801674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801679:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167c:	b8 28 00 00 00       	mov    $0x28,%eax
+  801681:	89 cb                	mov    %ecx,%ebx
+  801683:	89 cf                	mov    %ecx,%edi
+  801685:	89 ce                	mov    %ecx,%esi
+  801687:	cd 30                	int    $0x30
+  801689:	5b                   	pop    %ebx
+  80168a:	5e                   	pop    %esi
+  80168b:	5f                   	pop    %edi
+  80168c:	5d                   	pop    %ebp
+  80168d:	c3                   	ret
+
+0080168e <sys_prof>:
+  80168e:	55                   	push   %ebp
+  80168f:	89 e5                	mov    %esp,%ebp
+  801691:	57                   	push   %edi
+  801692:	56                   	push   %esi
+  801693:	53                   	push   %ebx
+  801694:	be 00 00 00 00       	mov    $0x0,%esi
+  801699:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169f:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a7:	89 f7                	mov    %esi,%edi
+  8016a9:	cd 30                	int    $0x30
+  8016ab:	5b                   	pop    %ebx
+  8016ac:	5e                   	pop    %esi
+  8016ad:	5f                   	pop    %edi
+  8016ae:	5d                   	pop    %ebp
+  8016af:	c3                   	ret
+
+008016b0 <fd2num>:
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+  8016b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016b6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016bb:	c1 e8 0c             	shr    $0xc,%eax
+  8016be:	5d                   	pop    %ebp
+  8016bf:	c3                   	ret
+
+008016c0 <fd2data>:
+  8016c0:	55                   	push   %ebp
+  8016c1:	89 e5                	mov    %esp,%ebp
+  8016c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016cb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016d0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8016d5:	5d                   	pop    %ebp
+  8016d6:	c3                   	ret
+
+008016d7 <fd_alloc>:
+  8016d7:	55                   	push   %ebp
+  8016d8:	89 e5                	mov    %esp,%ebp
+  8016da:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016df:	89 c2                	mov    %eax,%edx
+  8016e1:	c1 ea 16             	shr    $0x16,%edx
+  8016e4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016eb:	f6 c2 01             	test   $0x1,%dl
+  8016ee:	74 29                	je     801719 <fd_alloc+0x42>
+  8016f0:	89 c2                	mov    %eax,%edx
+  8016f2:	c1 ea 0c             	shr    $0xc,%edx
+  8016f5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016fc:	f6 c2 01             	test   $0x1,%dl
+  8016ff:	74 18                	je     801719 <fd_alloc+0x42>
+  801701:	05 00 10 00 00       	add    $0x1000,%eax
+  801706:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80170b:	75 d2                	jne    8016df <fd_alloc+0x8>
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801712:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801717:	eb 05                	jmp    80171e <fd_alloc+0x47>
+  801719:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80171e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801721:	89 02                	mov    %eax,(%edx)
+  801723:	89 c8                	mov    %ecx,%eax
+  801725:	5d                   	pop    %ebp
+  801726:	c3                   	ret
+
+00801727 <fd_lookup>:
+  801727:	55                   	push   %ebp
+  801728:	89 e5                	mov    %esp,%ebp
+  80172a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80172d:	83 f8 1f             	cmp    $0x1f,%eax
+  801730:	77 30                	ja     801762 <fd_lookup+0x3b>
+  801732:	c1 e0 0c             	shl    $0xc,%eax
+  801735:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  80173a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801740:	f6 c2 01             	test   $0x1,%dl
+  801743:	74 24                	je     801769 <fd_lookup+0x42>
+  801745:	89 c2                	mov    %eax,%edx
+  801747:	c1 ea 0c             	shr    $0xc,%edx
+  80174a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801751:	f6 c2 01             	test   $0x1,%dl
+  801754:	74 1a                	je     801770 <fd_lookup+0x49>
+  801756:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801759:	89 02                	mov    %eax,(%edx)
+  80175b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801760:	5d                   	pop    %ebp
+  801761:	c3                   	ret
+  801762:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801767:	eb f7                	jmp    801760 <fd_lookup+0x39>
+  801769:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80176e:	eb f0                	jmp    801760 <fd_lookup+0x39>
+  801770:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801775:	eb e9                	jmp    801760 <fd_lookup+0x39>
+
+00801777 <dev_lookup>:
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	53                   	push   %ebx
+  80177b:	83 ec 04             	sub    $0x4,%esp
+  80177e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801781:	b8 00 00 00 00       	mov    $0x0,%eax
+  801786:	bb 08 40 80 00       	mov    $0x804008,%ebx
+  80178b:	39 13                	cmp    %edx,(%ebx)
+  80178d:	74 37                	je     8017c6 <dev_lookup+0x4f>
+  80178f:	83 c0 01             	add    $0x1,%eax
+  801792:	8b 1c 85 f4 3a 80 00 	mov    0x803af4(,%eax,4),%ebx
+  801799:	85 db                	test   %ebx,%ebx
+  80179b:	75 ee                	jne    80178b <dev_lookup+0x14>
+  80179d:	a1 20 50 80 00       	mov    0x805020,%eax
+  8017a2:	8b 40 48             	mov    0x48(%eax),%eax
+  8017a5:	83 ec 04             	sub    $0x4,%esp
+  8017a8:	52                   	push   %edx
+  8017a9:	50                   	push   %eax
+  8017aa:	68 78 3a 80 00       	push   $0x803a78
+  8017af:	e8 37 eb ff ff       	call   8002eb <cprintf>
+  8017b4:	83 c4 10             	add    $0x10,%esp
+  8017b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017bf:	89 1a                	mov    %ebx,(%edx)
+  8017c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017c4:	c9                   	leave
+  8017c5:	c3                   	ret
+  8017c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cb:	eb ef                	jmp    8017bc <dev_lookup+0x45>
+
+008017cd <fd_close>:
+  8017cd:	55                   	push   %ebp
+  8017ce:	89 e5                	mov    %esp,%ebp
+  8017d0:	57                   	push   %edi
+  8017d1:	56                   	push   %esi
+  8017d2:	53                   	push   %ebx
+  8017d3:	83 ec 24             	sub    $0x24,%esp
+  8017d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017d9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8017dc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017df:	50                   	push   %eax
+  8017e0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017e6:	c1 e8 0c             	shr    $0xc,%eax
+  8017e9:	50                   	push   %eax
+  8017ea:	e8 38 ff ff ff       	call   801727 <fd_lookup>
+  8017ef:	89 c3                	mov    %eax,%ebx
+  8017f1:	83 c4 10             	add    $0x10,%esp
+  8017f4:	85 c0                	test   %eax,%eax
+  8017f6:	78 05                	js     8017fd <fd_close+0x30>
+  8017f8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017fb:	74 0f                	je     80180c <fd_close+0x3f>
+  8017fd:	85 ff                	test   %edi,%edi
+  8017ff:	0f 44 df             	cmove  %edi,%ebx
+  801802:	89 d8                	mov    %ebx,%eax
+  801804:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801807:	5b                   	pop    %ebx
+  801808:	5e                   	pop    %esi
+  801809:	5f                   	pop    %edi
+  80180a:	5d                   	pop    %ebp
+  80180b:	c3                   	ret
+  80180c:	83 ec 08             	sub    $0x8,%esp
+  80180f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801812:	50                   	push   %eax
+  801813:	ff 36                	push   (%esi)
+  801815:	e8 5d ff ff ff       	call   801777 <dev_lookup>
+  80181a:	89 c3                	mov    %eax,%ebx
+  80181c:	83 c4 10             	add    $0x10,%esp
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	78 1a                	js     80183d <fd_close+0x70>
+  801823:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801826:	8b 40 10             	mov    0x10(%eax),%eax
+  801829:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	74 0b                	je     80183d <fd_close+0x70>
+  801832:	83 ec 0c             	sub    $0xc,%esp
+  801835:	56                   	push   %esi
+  801836:	ff d0                	call   *%eax
+  801838:	89 c3                	mov    %eax,%ebx
+  80183a:	83 c4 10             	add    $0x10,%esp
+  80183d:	83 ec 08             	sub    $0x8,%esp
+  801840:	56                   	push   %esi
+  801841:	6a 00                	push   $0x0
+  801843:	e8 cc f6 ff ff       	call   800f14 <sys_page_unmap>
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	eb b5                	jmp    801802 <fd_close+0x35>
+
+0080184d <close>:
+  80184d:	55                   	push   %ebp
+  80184e:	89 e5                	mov    %esp,%ebp
+  801850:	83 ec 20             	sub    $0x20,%esp
+  801853:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801856:	50                   	push   %eax
+  801857:	ff 75 08             	push   0x8(%ebp)
+  80185a:	e8 c8 fe ff ff       	call   801727 <fd_lookup>
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	85 c0                	test   %eax,%eax
+  801864:	79 02                	jns    801868 <close+0x1b>
+  801866:	c9                   	leave
+  801867:	c3                   	ret
+  801868:	83 ec 08             	sub    $0x8,%esp
+  80186b:	6a 01                	push   $0x1
+  80186d:	ff 75 f4             	push   -0xc(%ebp)
+  801870:	e8 58 ff ff ff       	call   8017cd <fd_close>
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	eb ec                	jmp    801866 <close+0x19>
+
+0080187a <close_all>:
+  80187a:	55                   	push   %ebp
+  80187b:	89 e5                	mov    %esp,%ebp
+  80187d:	53                   	push   %ebx
+  80187e:	83 ec 04             	sub    $0x4,%esp
+  801881:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801886:	83 ec 0c             	sub    $0xc,%esp
+  801889:	53                   	push   %ebx
+  80188a:	e8 be ff ff ff       	call   80184d <close>
+  80188f:	83 c3 01             	add    $0x1,%ebx
+  801892:	83 c4 10             	add    $0x10,%esp
+  801895:	83 fb 20             	cmp    $0x20,%ebx
+  801898:	75 ec                	jne    801886 <close_all+0xc>
+  80189a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80189d:	c9                   	leave
+  80189e:	c3                   	ret
+
+0080189f <dup>:
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	57                   	push   %edi
+  8018a3:	56                   	push   %esi
+  8018a4:	53                   	push   %ebx
+  8018a5:	83 ec 34             	sub    $0x34,%esp
+  8018a8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018ab:	50                   	push   %eax
+  8018ac:	ff 75 08             	push   0x8(%ebp)
+  8018af:	e8 73 fe ff ff       	call   801727 <fd_lookup>
+  8018b4:	89 c3                	mov    %eax,%ebx
+  8018b6:	83 c4 10             	add    $0x10,%esp
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 7f                	js     80193c <dup+0x9d>
+  8018bd:	83 ec 0c             	sub    $0xc,%esp
+  8018c0:	ff 75 0c             	push   0xc(%ebp)
+  8018c3:	e8 85 ff ff ff       	call   80184d <close>
+  8018c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018cb:	c1 e6 0c             	shl    $0xc,%esi
+  8018ce:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8018d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018d7:	89 3c 24             	mov    %edi,(%esp)
+  8018da:	e8 e1 fd ff ff       	call   8016c0 <fd2data>
+  8018df:	89 c3                	mov    %eax,%ebx
+  8018e1:	89 34 24             	mov    %esi,(%esp)
+  8018e4:	e8 d7 fd ff ff       	call   8016c0 <fd2data>
+  8018e9:	83 c4 10             	add    $0x10,%esp
+  8018ec:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8018ef:	89 d8                	mov    %ebx,%eax
+  8018f1:	c1 e8 16             	shr    $0x16,%eax
+  8018f4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018fb:	a8 01                	test   $0x1,%al
+  8018fd:	74 11                	je     801910 <dup+0x71>
+  8018ff:	89 d8                	mov    %ebx,%eax
+  801901:	c1 e8 0c             	shr    $0xc,%eax
+  801904:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80190b:	f6 c2 01             	test   $0x1,%dl
+  80190e:	75 36                	jne    801946 <dup+0xa7>
+  801910:	89 f8                	mov    %edi,%eax
+  801912:	c1 e8 0c             	shr    $0xc,%eax
+  801915:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80191c:	83 ec 0c             	sub    $0xc,%esp
+  80191f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801924:	50                   	push   %eax
+  801925:	56                   	push   %esi
+  801926:	6a 00                	push   $0x0
+  801928:	57                   	push   %edi
+  801929:	6a 00                	push   $0x0
+  80192b:	e8 55 f5 ff ff       	call   800e85 <sys_page_map>
+  801930:	89 c3                	mov    %eax,%ebx
+  801932:	83 c4 20             	add    $0x20,%esp
+  801935:	85 c0                	test   %eax,%eax
+  801937:	78 33                	js     80196c <dup+0xcd>
+  801939:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80193c:	89 d8                	mov    %ebx,%eax
+  80193e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801941:	5b                   	pop    %ebx
+  801942:	5e                   	pop    %esi
+  801943:	5f                   	pop    %edi
+  801944:	5d                   	pop    %ebp
+  801945:	c3                   	ret
+  801946:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80194d:	83 ec 0c             	sub    $0xc,%esp
+  801950:	25 07 0e 00 00       	and    $0xe07,%eax
+  801955:	50                   	push   %eax
+  801956:	ff 75 d4             	push   -0x2c(%ebp)
+  801959:	6a 00                	push   $0x0
+  80195b:	53                   	push   %ebx
+  80195c:	6a 00                	push   $0x0
+  80195e:	e8 22 f5 ff ff       	call   800e85 <sys_page_map>
+  801963:	89 c3                	mov    %eax,%ebx
+  801965:	83 c4 20             	add    $0x20,%esp
+  801968:	85 c0                	test   %eax,%eax
+  80196a:	79 a4                	jns    801910 <dup+0x71>
+  80196c:	83 ec 08             	sub    $0x8,%esp
+  80196f:	56                   	push   %esi
+  801970:	6a 00                	push   $0x0
+  801972:	e8 9d f5 ff ff       	call   800f14 <sys_page_unmap>
+  801977:	83 c4 08             	add    $0x8,%esp
+  80197a:	ff 75 d4             	push   -0x2c(%ebp)
+  80197d:	6a 00                	push   $0x0
+  80197f:	e8 90 f5 ff ff       	call   800f14 <sys_page_unmap>
+  801984:	83 c4 10             	add    $0x10,%esp
+  801987:	eb b3                	jmp    80193c <dup+0x9d>
+
+00801989 <read>:
+  801989:	55                   	push   %ebp
+  80198a:	89 e5                	mov    %esp,%ebp
+  80198c:	56                   	push   %esi
+  80198d:	53                   	push   %ebx
+  80198e:	83 ec 18             	sub    $0x18,%esp
+  801991:	8b 75 08             	mov    0x8(%ebp),%esi
+  801994:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801997:	50                   	push   %eax
+  801998:	56                   	push   %esi
+  801999:	e8 89 fd ff ff       	call   801727 <fd_lookup>
+  80199e:	83 c4 10             	add    $0x10,%esp
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	78 3c                	js     8019e1 <read+0x58>
+  8019a5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019a8:	83 ec 08             	sub    $0x8,%esp
+  8019ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ae:	50                   	push   %eax
+  8019af:	ff 33                	push   (%ebx)
+  8019b1:	e8 c1 fd ff ff       	call   801777 <dev_lookup>
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	78 24                	js     8019e1 <read+0x58>
+  8019bd:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019c0:	83 e0 03             	and    $0x3,%eax
+  8019c3:	83 f8 01             	cmp    $0x1,%eax
+  8019c6:	74 20                	je     8019e8 <read+0x5f>
+  8019c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019cb:	8b 40 08             	mov    0x8(%eax),%eax
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	74 37                	je     801a09 <read+0x80>
+  8019d2:	83 ec 04             	sub    $0x4,%esp
+  8019d5:	ff 75 10             	push   0x10(%ebp)
+  8019d8:	ff 75 0c             	push   0xc(%ebp)
+  8019db:	53                   	push   %ebx
+  8019dc:	ff d0                	call   *%eax
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e4:	5b                   	pop    %ebx
+  8019e5:	5e                   	pop    %esi
+  8019e6:	5d                   	pop    %ebp
+  8019e7:	c3                   	ret
+  8019e8:	a1 20 50 80 00       	mov    0x805020,%eax
+  8019ed:	8b 40 48             	mov    0x48(%eax),%eax
+  8019f0:	83 ec 04             	sub    $0x4,%esp
+  8019f3:	56                   	push   %esi
+  8019f4:	50                   	push   %eax
+  8019f5:	68 b9 3a 80 00       	push   $0x803ab9
+  8019fa:	e8 ec e8 ff ff       	call   8002eb <cprintf>
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a07:	eb d8                	jmp    8019e1 <read+0x58>
+  801a09:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a0e:	eb d1                	jmp    8019e1 <read+0x58>
+
+00801a10 <readn>:
+  801a10:	55                   	push   %ebp
+  801a11:	89 e5                	mov    %esp,%ebp
+  801a13:	57                   	push   %edi
+  801a14:	56                   	push   %esi
+  801a15:	53                   	push   %ebx
+  801a16:	83 ec 0c             	sub    $0xc,%esp
+  801a19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a1c:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a1f:	85 f6                	test   %esi,%esi
+  801a21:	74 30                	je     801a53 <readn+0x43>
+  801a23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2d:	83 ec 04             	sub    $0x4,%esp
+  801a30:	89 f2                	mov    %esi,%edx
+  801a32:	29 c2                	sub    %eax,%edx
+  801a34:	52                   	push   %edx
+  801a35:	01 f8                	add    %edi,%eax
+  801a37:	50                   	push   %eax
+  801a38:	ff 75 08             	push   0x8(%ebp)
+  801a3b:	e8 49 ff ff ff       	call   801989 <read>
+  801a40:	83 c4 10             	add    $0x10,%esp
+  801a43:	85 c0                	test   %eax,%eax
+  801a45:	78 15                	js     801a5c <readn+0x4c>
+  801a47:	74 11                	je     801a5a <readn+0x4a>
+  801a49:	01 c3                	add    %eax,%ebx
+  801a4b:	89 d8                	mov    %ebx,%eax
+  801a4d:	39 f3                	cmp    %esi,%ebx
+  801a4f:	72 dc                	jb     801a2d <readn+0x1d>
+  801a51:	eb 09                	jmp    801a5c <readn+0x4c>
+  801a53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a58:	eb 02                	jmp    801a5c <readn+0x4c>
+  801a5a:	89 d8                	mov    %ebx,%eax
+  801a5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5f:	5b                   	pop    %ebx
+  801a60:	5e                   	pop    %esi
+  801a61:	5f                   	pop    %edi
+  801a62:	5d                   	pop    %ebp
+  801a63:	c3                   	ret
+
+00801a64 <write>:
+  801a64:	55                   	push   %ebp
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	56                   	push   %esi
+  801a68:	53                   	push   %ebx
+  801a69:	83 ec 18             	sub    $0x18,%esp
+  801a6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a72:	50                   	push   %eax
+  801a73:	53                   	push   %ebx
+  801a74:	e8 ae fc ff ff       	call   801727 <fd_lookup>
+  801a79:	83 c4 10             	add    $0x10,%esp
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 37                	js     801ab7 <write+0x53>
+  801a80:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a83:	83 ec 08             	sub    $0x8,%esp
+  801a86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a89:	50                   	push   %eax
+  801a8a:	ff 36                	push   (%esi)
+  801a8c:	e8 e6 fc ff ff       	call   801777 <dev_lookup>
+  801a91:	83 c4 10             	add    $0x10,%esp
+  801a94:	85 c0                	test   %eax,%eax
+  801a96:	78 1f                	js     801ab7 <write+0x53>
+  801a98:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a9c:	74 20                	je     801abe <write+0x5a>
+  801a9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	74 37                	je     801adf <write+0x7b>
+  801aa8:	83 ec 04             	sub    $0x4,%esp
+  801aab:	ff 75 10             	push   0x10(%ebp)
+  801aae:	ff 75 0c             	push   0xc(%ebp)
+  801ab1:	56                   	push   %esi
+  801ab2:	ff d0                	call   *%eax
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aba:	5b                   	pop    %ebx
+  801abb:	5e                   	pop    %esi
+  801abc:	5d                   	pop    %ebp
+  801abd:	c3                   	ret
+  801abe:	a1 20 50 80 00       	mov    0x805020,%eax
+  801ac3:	8b 40 48             	mov    0x48(%eax),%eax
+  801ac6:	83 ec 04             	sub    $0x4,%esp
+  801ac9:	53                   	push   %ebx
+  801aca:	50                   	push   %eax
+  801acb:	68 d5 3a 80 00       	push   $0x803ad5
+  801ad0:	e8 16 e8 ff ff       	call   8002eb <cprintf>
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801add:	eb d8                	jmp    801ab7 <write+0x53>
+  801adf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae4:	eb d1                	jmp    801ab7 <write+0x53>
+
+00801ae6 <seek>:
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	83 ec 20             	sub    $0x20,%esp
+  801aec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aef:	50                   	push   %eax
+  801af0:	ff 75 08             	push   0x8(%ebp)
+  801af3:	e8 2f fc ff ff       	call   801727 <fd_lookup>
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 0e                	js     801b0d <seek+0x27>
+  801aff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b05:	89 50 04             	mov    %edx,0x4(%eax)
+  801b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0d:	c9                   	leave
+  801b0e:	c3                   	ret
+
+00801b0f <ftruncate>:
+  801b0f:	55                   	push   %ebp
+  801b10:	89 e5                	mov    %esp,%ebp
+  801b12:	56                   	push   %esi
+  801b13:	53                   	push   %ebx
+  801b14:	83 ec 18             	sub    $0x18,%esp
+  801b17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b1d:	50                   	push   %eax
+  801b1e:	53                   	push   %ebx
+  801b1f:	e8 03 fc ff ff       	call   801727 <fd_lookup>
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	85 c0                	test   %eax,%eax
+  801b29:	78 34                	js     801b5f <ftruncate+0x50>
+  801b2b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b2e:	83 ec 08             	sub    $0x8,%esp
+  801b31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b34:	50                   	push   %eax
+  801b35:	ff 36                	push   (%esi)
+  801b37:	e8 3b fc ff ff       	call   801777 <dev_lookup>
+  801b3c:	83 c4 10             	add    $0x10,%esp
+  801b3f:	85 c0                	test   %eax,%eax
+  801b41:	78 1c                	js     801b5f <ftruncate+0x50>
+  801b43:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b47:	74 1d                	je     801b66 <ftruncate+0x57>
+  801b49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b4c:	8b 40 18             	mov    0x18(%eax),%eax
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	74 34                	je     801b87 <ftruncate+0x78>
+  801b53:	83 ec 08             	sub    $0x8,%esp
+  801b56:	ff 75 0c             	push   0xc(%ebp)
+  801b59:	56                   	push   %esi
+  801b5a:	ff d0                	call   *%eax
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b62:	5b                   	pop    %ebx
+  801b63:	5e                   	pop    %esi
+  801b64:	5d                   	pop    %ebp
+  801b65:	c3                   	ret
+  801b66:	a1 20 50 80 00       	mov    0x805020,%eax
+  801b6b:	8b 40 48             	mov    0x48(%eax),%eax
+  801b6e:	83 ec 04             	sub    $0x4,%esp
+  801b71:	53                   	push   %ebx
+  801b72:	50                   	push   %eax
+  801b73:	68 98 3a 80 00       	push   $0x803a98
+  801b78:	e8 6e e7 ff ff       	call   8002eb <cprintf>
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b85:	eb d8                	jmp    801b5f <ftruncate+0x50>
+  801b87:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b8c:	eb d1                	jmp    801b5f <ftruncate+0x50>
+
+00801b8e <fstat>:
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+  801b91:	56                   	push   %esi
+  801b92:	53                   	push   %ebx
+  801b93:	83 ec 18             	sub    $0x18,%esp
+  801b96:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b9c:	50                   	push   %eax
+  801b9d:	ff 75 08             	push   0x8(%ebp)
+  801ba0:	e8 82 fb ff ff       	call   801727 <fd_lookup>
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 49                	js     801bf5 <fstat+0x67>
+  801bac:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801baf:	83 ec 08             	sub    $0x8,%esp
+  801bb2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb5:	50                   	push   %eax
+  801bb6:	ff 36                	push   (%esi)
+  801bb8:	e8 ba fb ff ff       	call   801777 <dev_lookup>
+  801bbd:	83 c4 10             	add    $0x10,%esp
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 31                	js     801bf5 <fstat+0x67>
+  801bc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bcb:	74 2f                	je     801bfc <fstat+0x6e>
+  801bcd:	c6 03 00             	movb   $0x0,(%ebx)
+  801bd0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bd7:	00 00 00 
+  801bda:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801be1:	00 00 00 
+  801be4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801bea:	83 ec 08             	sub    $0x8,%esp
+  801bed:	53                   	push   %ebx
+  801bee:	56                   	push   %esi
+  801bef:	ff 50 14             	call   *0x14(%eax)
+  801bf2:	83 c4 10             	add    $0x10,%esp
+  801bf5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf8:	5b                   	pop    %ebx
+  801bf9:	5e                   	pop    %esi
+  801bfa:	5d                   	pop    %ebp
+  801bfb:	c3                   	ret
+  801bfc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c01:	eb f2                	jmp    801bf5 <fstat+0x67>
+
+00801c03 <stat>:
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	56                   	push   %esi
+  801c07:	53                   	push   %ebx
+  801c08:	83 ec 08             	sub    $0x8,%esp
+  801c0b:	6a 00                	push   $0x0
+  801c0d:	ff 75 08             	push   0x8(%ebp)
+  801c10:	e8 31 05 00 00       	call   802146 <open>
+  801c15:	89 c3                	mov    %eax,%ebx
+  801c17:	83 c4 10             	add    $0x10,%esp
+  801c1a:	85 c0                	test   %eax,%eax
+  801c1c:	78 1b                	js     801c39 <stat+0x36>
+  801c1e:	83 ec 08             	sub    $0x8,%esp
+  801c21:	ff 75 0c             	push   0xc(%ebp)
+  801c24:	50                   	push   %eax
+  801c25:	e8 64 ff ff ff       	call   801b8e <fstat>
+  801c2a:	89 c6                	mov    %eax,%esi
+  801c2c:	89 1c 24             	mov    %ebx,(%esp)
+  801c2f:	e8 19 fc ff ff       	call   80184d <close>
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	89 f3                	mov    %esi,%ebx
+  801c39:	89 d8                	mov    %ebx,%eax
+  801c3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3e:	5b                   	pop    %ebx
+  801c3f:	5e                   	pop    %esi
+  801c40:	5d                   	pop    %ebp
+  801c41:	c3                   	ret
+
+00801c42 <fsipc>:
+  801c42:	55                   	push   %ebp
+  801c43:	89 e5                	mov    %esp,%ebp
+  801c45:	56                   	push   %esi
+  801c46:	53                   	push   %ebx
+  801c47:	89 c3                	mov    %eax,%ebx
+  801c49:	89 d6                	mov    %edx,%esi
+  801c4b:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c52:	74 20                	je     801c74 <fsipc+0x32>
+  801c54:	83 ec 08             	sub    $0x8,%esp
+  801c57:	6a 00                	push   $0x0
+  801c59:	56                   	push   %esi
+  801c5a:	6a 07                	push   $0x7
+  801c5c:	68 00 60 80 00       	push   $0x806000
+  801c61:	53                   	push   %ebx
+  801c62:	ff 35 08 50 80 00    	push   0x805008
+  801c68:	e8 a0 12 00 00       	call   802f0d <ipc_call>
+  801c6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c70:	5b                   	pop    %ebx
+  801c71:	5e                   	pop    %esi
+  801c72:	5d                   	pop    %ebp
+  801c73:	c3                   	ret
+  801c74:	83 ec 0c             	sub    $0xc,%esp
+  801c77:	6a 02                	push   $0x2
+  801c79:	e8 2a 14 00 00       	call   8030a8 <ipc_find_env>
+  801c7e:	a3 08 50 80 00       	mov    %eax,0x805008
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	eb cc                	jmp    801c54 <fsipc+0x12>
+
+00801c88 <devfile_trunc>:
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c91:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c94:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c9c:	a3 04 60 80 00       	mov    %eax,0x806004
+  801ca1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca6:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cab:	e8 92 ff ff ff       	call   801c42 <fsipc>
+  801cb0:	c9                   	leave
+  801cb1:	c3                   	ret
+
+00801cb2 <devfile_flush>:
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	83 ec 08             	sub    $0x8,%esp
+  801cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cbe:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc8:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ccd:	e8 70 ff ff ff       	call   801c42 <fsipc>
+  801cd2:	c9                   	leave
+  801cd3:	c3                   	ret
+
+00801cd4 <devfile_stat>:
+  801cd4:	55                   	push   %ebp
+  801cd5:	89 e5                	mov    %esp,%ebp
+  801cd7:	53                   	push   %ebx
+  801cd8:	83 ec 04             	sub    $0x4,%esp
+  801cdb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ce4:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cee:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cf3:	e8 4a ff ff ff       	call   801c42 <fsipc>
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	78 2c                	js     801d28 <devfile_stat+0x54>
+  801cfc:	83 ec 08             	sub    $0x8,%esp
+  801cff:	68 00 60 80 00       	push   $0x806000
+  801d04:	53                   	push   %ebx
+  801d05:	e8 d8 ec ff ff       	call   8009e2 <strcpy>
+  801d0a:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d0f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801d15:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d1a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801d20:	83 c4 10             	add    $0x10,%esp
+  801d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d2b:	c9                   	leave
+  801d2c:	c3                   	ret
+
+00801d2d <fsring_rw>:
+  801d2d:	55                   	push   %ebp
+  801d2e:	89 e5                	mov    %esp,%ebp
+  801d30:	57                   	push   %edi
+  801d31:	56                   	push   %esi
+  801d32:	53                   	push   %ebx
+  801d33:	83 ec 2c             	sub    $0x2c,%esp
+  801d36:	89 c7                	mov    %eax,%edi
+  801d38:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d3b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801d3e:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d43:	a8 01                	test   $0x1,%al
+  801d45:	74 0d                	je     801d54 <fsring_rw+0x27>
+  801d47:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d4c:	a8 01                	test   $0x1,%al
+  801d4e:	0f 85 d5 00 00 00    	jne    801e29 <fsring_rw+0xfc>
+  801d54:	a1 20 50 80 00       	mov    0x805020,%eax
+  801d59:	8b 40 48             	mov    0x48(%eax),%eax
+  801d5c:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801d62:	0f 84 fc 00 00 00    	je     801e64 <fsring_rw+0x137>
+  801d68:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801d6f:	0f 84 02 01 00 00    	je     801e77 <fsring_rw+0x14a>
+  801d75:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d7a:	83 ec 04             	sub    $0x4,%esp
+  801d7d:	68 07 02 00 00       	push   $0x207
+  801d82:	53                   	push   %ebx
+  801d83:	6a 00                	push   $0x0
+  801d85:	e8 b8 f0 ff ff       	call   800e42 <sys_page_alloc>
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	0f 88 f9 00 00 00    	js     801e8e <fsring_rw+0x161>
+  801d95:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d9b:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801da1:	75 d7                	jne    801d7a <fsring_rw+0x4d>
+  801da3:	6a 0e                	push   $0xe
+  801da5:	6a 0d                	push   $0xd
+  801da7:	ff 35 08 50 80 00    	push   0x805008
+  801dad:	68 00 00 f0 cf       	push   $0xcff00000
+  801db2:	e8 c4 0c 00 00       	call   802a7b <ipcring_init>
+  801db7:	83 c4 08             	add    $0x8,%esp
+  801dba:	6a 00                	push   $0x0
+  801dbc:	6a 00                	push   $0x0
+  801dbe:	68 07 02 00 00       	push   $0x207
+  801dc3:	68 00 00 f0 cf       	push   $0xcff00000
+  801dc8:	6a 0b                	push   $0xb
+  801dca:	ff 35 08 50 80 00    	push   0x805008
+  801dd0:	e8 38 11 00 00       	call   802f0d <ipc_call>
+  801dd5:	89 c6                	mov    %eax,%esi
+  801dd7:	83 c4 20             	add    $0x20,%esp
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	0f 88 ac 00 00 00    	js     801e8e <fsring_rw+0x161>
+  801de2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801de7:	89 d9                	mov    %ebx,%ecx
+  801de9:	83 c3 01             	add    $0x1,%ebx
+  801dec:	89 da                	mov    %ebx,%edx
+  801dee:	c1 e2 0c             	shl    $0xc,%edx
+  801df1:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801df7:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801dfd:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801e03:	83 ec 08             	sub    $0x8,%esp
+  801e06:	6a 00                	push   $0x0
+  801e08:	6a 00                	push   $0x0
+  801e0a:	68 07 02 00 00       	push   $0x207
+  801e0f:	50                   	push   %eax
+  801e10:	6a 0c                	push   $0xc
+  801e12:	ff 35 08 50 80 00    	push   0x805008
+  801e18:	e8 f0 10 00 00       	call   802f0d <ipc_call>
+  801e1d:	83 c4 20             	add    $0x20,%esp
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	78 6a                	js     801e8e <fsring_rw+0x161>
+  801e24:	83 fb 08             	cmp    $0x8,%ebx
+  801e27:	75 be                	jne    801de7 <fsring_rw+0xba>
+  801e29:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e2d:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801e32:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801e37:	0f 45 c2             	cmovne %edx,%eax
+  801e3a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e3d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e44:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e4b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e57:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5c:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801e5f:	e9 4b 01 00 00       	jmp    801faf <fsring_rw+0x282>
+  801e64:	e8 a3 f3 ff ff       	call   80120c <sys_time_msec>
+  801e69:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801e6f:	0f 89 f3 fe ff ff    	jns    801d68 <fsring_rw+0x3b>
+  801e75:	eb 54                	jmp    801ecb <fsring_rw+0x19e>
+  801e77:	83 ec 0c             	sub    $0xc,%esp
+  801e7a:	6a 02                	push   $0x2
+  801e7c:	e8 27 12 00 00       	call   8030a8 <ipc_find_env>
+  801e81:	a3 08 50 80 00       	mov    %eax,0x805008
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	e9 e7 fe ff ff       	jmp    801d75 <fsring_rw+0x48>
+  801e8e:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e93:	83 ec 08             	sub    $0x8,%esp
+  801e96:	53                   	push   %ebx
+  801e97:	6a 00                	push   $0x0
+  801e99:	e8 76 f0 ff ff       	call   800f14 <sys_page_unmap>
+  801e9e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ea4:	83 c4 10             	add    $0x10,%esp
+  801ea7:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ead:	75 e4                	jne    801e93 <fsring_rw+0x166>
+  801eaf:	e8 58 f3 ff ff       	call   80120c <sys_time_msec>
+  801eb4:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801eb9:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ebe:	a1 20 50 80 00       	mov    0x805020,%eax
+  801ec3:	8b 40 48             	mov    0x48(%eax),%eax
+  801ec6:	a3 04 50 80 00       	mov    %eax,0x805004
+  801ecb:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801ed2:	e9 7a 01 00 00       	jmp    802051 <fsring_rw+0x324>
+  801ed7:	8b 57 0c             	mov    0xc(%edi),%edx
+  801eda:	89 10                	mov    %edx,(%eax)
+  801edc:	89 58 04             	mov    %ebx,0x4(%eax)
+  801edf:	89 f2                	mov    %esi,%edx
+  801ee1:	03 57 04             	add    0x4(%edi),%edx
+  801ee4:	89 50 08             	mov    %edx,0x8(%eax)
+  801ee7:	83 ec 04             	sub    $0x4,%esp
+  801eea:	53                   	push   %ebx
+  801eeb:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801eee:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801ef1:	52                   	push   %edx
+  801ef2:	83 c0 0c             	add    $0xc,%eax
+  801ef5:	50                   	push   %eax
+  801ef6:	e8 97 ec ff ff       	call   800b92 <memmove>
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f01:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f04:	89 08                	mov    %ecx,(%eax)
+  801f06:	83 ec 0c             	sub    $0xc,%esp
+  801f09:	68 00 00 f0 cf       	push   $0xcff00000
+  801f0e:	e8 c6 0b 00 00       	call   802ad9 <ipcring_req_push>
+  801f13:	01 de                	add    %ebx,%esi
+  801f15:	83 c4 10             	add    $0x10,%esp
+  801f18:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f1b:	73 4c                	jae    801f69 <fsring_rw+0x23c>
+  801f1d:	83 ec 0c             	sub    $0xc,%esp
+  801f20:	68 00 00 f0 cf       	push   $0xcff00000
+  801f25:	e8 89 0b 00 00       	call   802ab3 <ipcring_req_slot>
+  801f2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	74 35                	je     801f69 <fsring_rw+0x23c>
+  801f34:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f39:	83 e0 07             	and    $0x7,%eax
+  801f3c:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f41:	c1 e0 0c             	shl    $0xc,%eax
+  801f44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f47:	29 f3                	sub    %esi,%ebx
+  801f49:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f4c:	39 cb                	cmp    %ecx,%ebx
+  801f4e:	0f 47 d9             	cmova  %ecx,%ebx
+  801f51:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f55:	75 80                	jne    801ed7 <fsring_rw+0x1aa>
+  801f57:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f5a:	89 10                	mov    %edx,(%eax)
+  801f5c:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f5f:	89 f2                	mov    %esi,%edx
+  801f61:	03 57 04             	add    0x4(%edi),%edx
+  801f64:	89 50 08             	mov    %edx,0x8(%eax)
+  801f67:	eb 95                	jmp    801efe <fsring_rw+0x1d1>
+  801f69:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f71:	83 ec 0c             	sub    $0xc,%esp
+  801f74:	68 00 00 f0 cf       	push   $0xcff00000
+  801f79:	e8 94 0b 00 00       	call   802b12 <ipcring_rsp_wait>
+  801f7e:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f81:	83 c4 10             	add    $0x10,%esp
+  801f84:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f88:	75 45                	jne    801fcf <fsring_rw+0x2a2>
+  801f8a:	85 db                	test   %ebx,%ebx
+  801f8c:	79 41                	jns    801fcf <fsring_rw+0x2a2>
+  801f8e:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801f91:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801f98:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801f9f:	83 ec 0c             	sub    $0xc,%esp
+  801fa2:	68 00 00 f0 cf       	push   $0xcff00000
+  801fa7:	e8 cc 0b 00 00       	call   802b78 <ipcring_rsp_pop>
+  801fac:	83 c4 10             	add    $0x10,%esp
+  801faf:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801fb5:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801fba:	39 c2                	cmp    %eax,%edx
+  801fbc:	74 75                	je     802033 <fsring_rw+0x306>
+  801fbe:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801fc2:	75 a5                	jne    801f69 <fsring_rw+0x23c>
+  801fc4:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801fc7:	0f 82 50 ff ff ff    	jb     801f1d <fsring_rw+0x1f0>
+  801fcd:	eb 9a                	jmp    801f69 <fsring_rw+0x23c>
+  801fcf:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801fd3:	75 ca                	jne    801f9f <fsring_rw+0x272>
+  801fd5:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801fd9:	74 31                	je     80200c <fsring_rw+0x2df>
+  801fdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fde:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fe1:	29 c8                	sub    %ecx,%eax
+  801fe3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801fe6:	39 d0                	cmp    %edx,%eax
+  801fe8:	0f 47 c2             	cmova  %edx,%eax
+  801feb:	39 d8                	cmp    %ebx,%eax
+  801fed:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ff2:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801ff6:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801ff9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ffe:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802002:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802005:	01 d9                	add    %ebx,%ecx
+  802007:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80200a:	eb 93                	jmp    801f9f <fsring_rw+0x272>
+  80200c:	83 ec 04             	sub    $0x4,%esp
+  80200f:	53                   	push   %ebx
+  802010:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802013:	83 e0 07             	and    $0x7,%eax
+  802016:	c1 e0 0c             	shl    $0xc,%eax
+  802019:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80201f:	50                   	push   %eax
+  802020:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802023:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802026:	01 c8                	add    %ecx,%eax
+  802028:	50                   	push   %eax
+  802029:	e8 64 eb ff ff       	call   800b92 <memmove>
+  80202e:	83 c4 10             	add    $0x10,%esp
+  802031:	eb a8                	jmp    801fdb <fsring_rw+0x2ae>
+  802033:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802037:	75 09                	jne    802042 <fsring_rw+0x315>
+  802039:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80203c:	0f 82 db fe ff ff    	jb     801f1d <fsring_rw+0x1f0>
+  802042:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802045:	01 57 04             	add    %edx,0x4(%edi)
+  802048:	85 d2                	test   %edx,%edx
+  80204a:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80204e:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802051:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802057:	5b                   	pop    %ebx
+  802058:	5e                   	pop    %esi
+  802059:	5f                   	pop    %edi
+  80205a:	5d                   	pop    %ebp
+  80205b:	c3                   	ret
+
+0080205c <devfile_write>:
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	57                   	push   %edi
+  802060:	56                   	push   %esi
+  802061:	53                   	push   %ebx
+  802062:	83 ec 0c             	sub    $0xc,%esp
+  802065:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802068:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80206b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80206e:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802074:	76 1a                	jbe    802090 <devfile_write+0x34>
+  802076:	83 ec 0c             	sub    $0xc,%esp
+  802079:	53                   	push   %ebx
+  80207a:	89 f1                	mov    %esi,%ecx
+  80207c:	ba 06 00 00 00       	mov    $0x6,%edx
+  802081:	89 f8                	mov    %edi,%eax
+  802083:	e8 a5 fc ff ff       	call   801d2d <fsring_rw>
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80208e:	75 39                	jne    8020c9 <devfile_write+0x6d>
+  802090:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802095:	39 c3                	cmp    %eax,%ebx
+  802097:	0f 47 d8             	cmova  %eax,%ebx
+  80209a:	8b 47 0c             	mov    0xc(%edi),%eax
+  80209d:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020a2:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8020a8:	83 ec 04             	sub    $0x4,%esp
+  8020ab:	53                   	push   %ebx
+  8020ac:	56                   	push   %esi
+  8020ad:	68 08 60 80 00       	push   $0x806008
+  8020b2:	e8 db ea ff ff       	call   800b92 <memmove>
+  8020b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020bc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020c1:	e8 7c fb ff ff       	call   801c42 <fsipc>
+  8020c6:	83 c4 10             	add    $0x10,%esp
+  8020c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020cc:	5b                   	pop    %ebx
+  8020cd:	5e                   	pop    %esi
+  8020ce:	5f                   	pop    %edi
+  8020cf:	5d                   	pop    %ebp
+  8020d0:	c3                   	ret
+
+008020d1 <devfile_read>:
+  8020d1:	55                   	push   %ebp
+  8020d2:	89 e5                	mov    %esp,%ebp
+  8020d4:	57                   	push   %edi
+  8020d5:	56                   	push   %esi
+  8020d6:	53                   	push   %ebx
+  8020d7:	83 ec 0c             	sub    $0xc,%esp
+  8020da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020dd:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020e0:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8020e6:	76 1d                	jbe    802105 <devfile_read+0x34>
+  8020e8:	83 ec 0c             	sub    $0xc,%esp
+  8020eb:	56                   	push   %esi
+  8020ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020ef:	ba 05 00 00 00       	mov    $0x5,%edx
+  8020f4:	89 f8                	mov    %edi,%eax
+  8020f6:	e8 32 fc ff ff       	call   801d2d <fsring_rw>
+  8020fb:	89 c3                	mov    %eax,%ebx
+  8020fd:	83 c4 10             	add    $0x10,%esp
+  802100:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802103:	75 37                	jne    80213c <devfile_read+0x6b>
+  802105:	8b 47 0c             	mov    0xc(%edi),%eax
+  802108:	a3 00 60 80 00       	mov    %eax,0x806000
+  80210d:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802113:	ba 00 00 00 00       	mov    $0x0,%edx
+  802118:	b8 03 00 00 00       	mov    $0x3,%eax
+  80211d:	e8 20 fb ff ff       	call   801c42 <fsipc>
+  802122:	89 c3                	mov    %eax,%ebx
+  802124:	85 c0                	test   %eax,%eax
+  802126:	78 14                	js     80213c <devfile_read+0x6b>
+  802128:	83 ec 04             	sub    $0x4,%esp
+  80212b:	50                   	push   %eax
+  80212c:	68 00 60 80 00       	push   $0x806000
+  802131:	ff 75 0c             	push   0xc(%ebp)
+  802134:	e8 59 ea ff ff       	call   800b92 <memmove>
+  802139:	83 c4 10             	add    $0x10,%esp
+  80213c:	89 d8                	mov    %ebx,%eax
+  80213e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802141:	5b                   	pop    %ebx
+  802142:	5e                   	pop    %esi
+  802143:	5f                   	pop    %edi
+  802144:	5d                   	pop    %ebp
+  802145:	c3                   	ret
+
+00802146 <open>:
+  802146:	55                   	push   %ebp
+  802147:	89 e5                	mov    %esp,%ebp
+  802149:	56                   	push   %esi
+  80214a:	53                   	push   %ebx
+  80214b:	83 ec 1c             	sub    $0x1c,%esp
+  80214e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802151:	56                   	push   %esi
+  802152:	e8 3f e8 ff ff       	call   800996 <strlen>
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80215f:	7f 6c                	jg     8021cd <open+0x87>
+  802161:	83 ec 0c             	sub    $0xc,%esp
+  802164:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802167:	50                   	push   %eax
+  802168:	e8 6a f5 ff ff       	call   8016d7 <fd_alloc>
+  80216d:	89 c3                	mov    %eax,%ebx
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 3c                	js     8021b2 <open+0x6c>
+  802176:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802179:	a3 00 64 80 00       	mov    %eax,0x806400
+  80217e:	83 ec 08             	sub    $0x8,%esp
+  802181:	56                   	push   %esi
+  802182:	68 00 60 80 00       	push   $0x806000
+  802187:	e8 56 e8 ff ff       	call   8009e2 <strcpy>
+  80218c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80218f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802194:	e8 a9 fa ff ff       	call   801c42 <fsipc>
+  802199:	89 c3                	mov    %eax,%ebx
+  80219b:	83 c4 10             	add    $0x10,%esp
+  80219e:	85 c0                	test   %eax,%eax
+  8021a0:	78 19                	js     8021bb <open+0x75>
+  8021a2:	83 ec 0c             	sub    $0xc,%esp
+  8021a5:	ff 75 f4             	push   -0xc(%ebp)
+  8021a8:	e8 03 f5 ff ff       	call   8016b0 <fd2num>
+  8021ad:	89 c3                	mov    %eax,%ebx
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	89 d8                	mov    %ebx,%eax
+  8021b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b7:	5b                   	pop    %ebx
+  8021b8:	5e                   	pop    %esi
+  8021b9:	5d                   	pop    %ebp
+  8021ba:	c3                   	ret
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	6a 00                	push   $0x0
+  8021c0:	ff 75 f4             	push   -0xc(%ebp)
+  8021c3:	e8 05 f6 ff ff       	call   8017cd <fd_close>
+  8021c8:	83 c4 10             	add    $0x10,%esp
+  8021cb:	eb e5                	jmp    8021b2 <open+0x6c>
+  8021cd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021d2:	eb de                	jmp    8021b2 <open+0x6c>
+
+008021d4 <file_image>:
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	53                   	push   %ebx
+  8021d8:	83 ec 1c             	sub    $0x1c,%esp
+  8021db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	ff 75 08             	push   0x8(%ebp)
+  8021e5:	e8 3d f5 ff ff       	call   801727 <fd_lookup>
+  8021ea:	83 c4 10             	add    $0x10,%esp
+  8021ed:	85 c0                	test   %eax,%eax
+  8021ef:	78 58                	js     802249 <file_image+0x75>
+  8021f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f4:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  8021fa:	39 08                	cmp    %ecx,(%eax)
+  8021fc:	75 50                	jne    80224e <file_image+0x7a>
+  8021fe:	83 fb 04             	cmp    $0x4,%ebx
+  802201:	77 52                	ja     802255 <file_image+0x81>
+  802203:	8b 40 0c             	mov    0xc(%eax),%eax
+  802206:	a3 00 60 80 00       	mov    %eax,0x806000
+  80220b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802211:	83 ec 04             	sub    $0x4,%esp
+  802214:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802217:	c1 e0 02             	shl    $0x2,%eax
+  80221a:	50                   	push   %eax
+  80221b:	ff 75 0c             	push   0xc(%ebp)
+  80221e:	68 08 60 80 00       	push   $0x806008
+  802223:	e8 6a e9 ff ff       	call   800b92 <memmove>
+  802228:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802232:	e8 0b fa ff ff       	call   801c42 <fsipc>
+  802237:	83 c4 10             	add    $0x10,%esp
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	78 0b                	js     802249 <file_image+0x75>
+  80223e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802241:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802247:	89 0a                	mov    %ecx,(%edx)
+  802249:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80224c:	c9                   	leave
+  80224d:	c3                   	ret
+  80224e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802253:	eb f4                	jmp    802249 <file_image+0x75>
+  802255:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80225a:	eb ed                	jmp    802249 <file_image+0x75>
+
+0080225c <remove>:
+  80225c:	55                   	push   %ebp
+  80225d:	89 e5                	mov    %esp,%ebp
+  80225f:	53                   	push   %ebx
+  802260:	83 ec 10             	sub    $0x10,%esp
+  802263:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802266:	53                   	push   %ebx
+  802267:	e8 2a e7 ff ff       	call   800996 <strlen>
+  80226c:	83 c4 10             	add    $0x10,%esp
+  80226f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802274:	7f 25                	jg     80229b <remove+0x3f>
+  802276:	83 ec 08             	sub    $0x8,%esp
+  802279:	53                   	push   %ebx
+  80227a:	68 00 60 80 00       	push   $0x806000
+  80227f:	e8 5e e7 ff ff       	call   8009e2 <strcpy>
+  802284:	ba 00 00 00 00       	mov    $0x0,%edx
+  802289:	b8 09 00 00 00       	mov    $0x9,%eax
+  80228e:	e8 af f9 ff ff       	call   801c42 <fsipc>
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802299:	c9                   	leave
+  80229a:	c3                   	ret
+  80229b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022a0:	eb f4                	jmp    802296 <remove+0x3a>
+
+008022a2 <sync>:
+  8022a2:	55                   	push   %ebp
+  8022a3:	89 e5                	mov    %esp,%ebp
+  8022a5:	83 ec 08             	sub    $0x8,%esp
+  8022a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022b2:	e8 8b f9 ff ff       	call   801c42 <fsipc>
+  8022b7:	c9                   	leave
+  8022b8:	c3                   	ret
+
+008022b9 <devsock_stat>:
+  8022b9:	55                   	push   %ebp
+  8022ba:	89 e5                	mov    %esp,%ebp
+  8022bc:	83 ec 10             	sub    $0x10,%esp
+  8022bf:	68 08 3b 80 00       	push   $0x803b08
+  8022c4:	ff 75 0c             	push   0xc(%ebp)
+  8022c7:	e8 16 e7 ff ff       	call   8009e2 <strcpy>
+  8022cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d1:	c9                   	leave
+  8022d2:	c3                   	ret
+
+008022d3 <devsock_close>:
+  8022d3:	55                   	push   %ebp
+  8022d4:	89 e5                	mov    %esp,%ebp
+  8022d6:	53                   	push   %ebx
+  8022d7:	83 ec 10             	sub    $0x10,%esp
+  8022da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022dd:	53                   	push   %ebx
+  8022de:	e8 df 0d 00 00       	call   8030c2 <pageref>
+  8022e3:	89 c2                	mov    %eax,%edx
+  8022e5:	83 c4 10             	add    $0x10,%esp
+  8022e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ed:	83 fa 01             	cmp    $0x1,%edx
+  8022f0:	74 05                	je     8022f7 <devsock_close+0x24>
+  8022f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022f5:	c9                   	leave
+  8022f6:	c3                   	ret
+  8022f7:	83 ec 0c             	sub    $0xc,%esp
+  8022fa:	ff 73 0c             	push   0xc(%ebx)
+  8022fd:	e8 aa 02 00 00       	call   8025ac <nsipc_close>
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	eb eb                	jmp    8022f2 <devsock_close+0x1f>
+
+00802307 <devsock_write>:
+  802307:	55                   	push   %ebp
+  802308:	89 e5                	mov    %esp,%ebp
+  80230a:	83 ec 08             	sub    $0x8,%esp
+  80230d:	6a 00                	push   $0x0
+  80230f:	ff 75 10             	push   0x10(%ebp)
+  802312:	ff 75 0c             	push   0xc(%ebp)
+  802315:	8b 45 08             	mov    0x8(%ebp),%eax
+  802318:	ff 70 0c             	push   0xc(%eax)
+  80231b:	e8 6c 03 00 00       	call   80268c <nsipc_send>
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+
+00802322 <devsock_read>:
+  802322:	55                   	push   %ebp
+  802323:	89 e5                	mov    %esp,%ebp
+  802325:	83 ec 08             	sub    $0x8,%esp
+  802328:	6a 00                	push   $0x0
+  80232a:	ff 75 10             	push   0x10(%ebp)
+  80232d:	ff 75 0c             	push   0xc(%ebp)
+  802330:	8b 45 08             	mov    0x8(%ebp),%eax
+  802333:	ff 70 0c             	push   0xc(%eax)
+  802336:	e8 e2 02 00 00       	call   80261d <nsipc_recv>
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+0080233d <fd2sockid>:
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	83 ec 20             	sub    $0x20,%esp
+  802343:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802346:	52                   	push   %edx
+  802347:	50                   	push   %eax
+  802348:	e8 da f3 ff ff       	call   801727 <fd_lookup>
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	85 c0                	test   %eax,%eax
+  802352:	78 10                	js     802364 <fd2sockid+0x27>
+  802354:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802357:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  80235d:	39 08                	cmp    %ecx,(%eax)
+  80235f:	75 05                	jne    802366 <fd2sockid+0x29>
+  802361:	8b 40 0c             	mov    0xc(%eax),%eax
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+  802366:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80236b:	eb f7                	jmp    802364 <fd2sockid+0x27>
+
+0080236d <alloc_sockfd>:
+  80236d:	55                   	push   %ebp
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	56                   	push   %esi
+  802371:	53                   	push   %ebx
+  802372:	83 ec 1c             	sub    $0x1c,%esp
+  802375:	89 c6                	mov    %eax,%esi
+  802377:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80237a:	50                   	push   %eax
+  80237b:	e8 57 f3 ff ff       	call   8016d7 <fd_alloc>
+  802380:	89 c3                	mov    %eax,%ebx
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 43                	js     8023cc <alloc_sockfd+0x5f>
+  802389:	83 ec 04             	sub    $0x4,%esp
+  80238c:	68 07 04 00 00       	push   $0x407
+  802391:	ff 75 f4             	push   -0xc(%ebp)
+  802394:	6a 00                	push   $0x0
+  802396:	e8 a7 ea ff ff       	call   800e42 <sys_page_alloc>
+  80239b:	89 c3                	mov    %eax,%ebx
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	85 c0                	test   %eax,%eax
+  8023a2:	78 28                	js     8023cc <alloc_sockfd+0x5f>
+  8023a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a7:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  8023ad:	89 10                	mov    %edx,(%eax)
+  8023af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8023b9:	89 70 0c             	mov    %esi,0xc(%eax)
+  8023bc:	83 ec 0c             	sub    $0xc,%esp
+  8023bf:	50                   	push   %eax
+  8023c0:	e8 eb f2 ff ff       	call   8016b0 <fd2num>
+  8023c5:	89 c3                	mov    %eax,%ebx
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	eb 0c                	jmp    8023d8 <alloc_sockfd+0x6b>
+  8023cc:	83 ec 0c             	sub    $0xc,%esp
+  8023cf:	56                   	push   %esi
+  8023d0:	e8 d7 01 00 00       	call   8025ac <nsipc_close>
+  8023d5:	83 c4 10             	add    $0x10,%esp
+  8023d8:	89 d8                	mov    %ebx,%eax
+  8023da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023dd:	5b                   	pop    %ebx
+  8023de:	5e                   	pop    %esi
+  8023df:	5d                   	pop    %ebp
+  8023e0:	c3                   	ret
+
+008023e1 <accept>:
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	83 ec 08             	sub    $0x8,%esp
+  8023e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ea:	e8 4e ff ff ff       	call   80233d <fd2sockid>
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 1b                	js     80240e <accept+0x2d>
+  8023f3:	83 ec 04             	sub    $0x4,%esp
+  8023f6:	ff 75 10             	push   0x10(%ebp)
+  8023f9:	ff 75 0c             	push   0xc(%ebp)
+  8023fc:	50                   	push   %eax
+  8023fd:	e8 07 01 00 00       	call   802509 <nsipc_accept>
+  802402:	83 c4 10             	add    $0x10,%esp
+  802405:	85 c0                	test   %eax,%eax
+  802407:	78 05                	js     80240e <accept+0x2d>
+  802409:	e8 5f ff ff ff       	call   80236d <alloc_sockfd>
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+00802410 <bind>:
+  802410:	55                   	push   %ebp
+  802411:	89 e5                	mov    %esp,%ebp
+  802413:	83 ec 08             	sub    $0x8,%esp
+  802416:	8b 45 08             	mov    0x8(%ebp),%eax
+  802419:	e8 1f ff ff ff       	call   80233d <fd2sockid>
+  80241e:	85 c0                	test   %eax,%eax
+  802420:	78 12                	js     802434 <bind+0x24>
+  802422:	83 ec 04             	sub    $0x4,%esp
+  802425:	ff 75 10             	push   0x10(%ebp)
+  802428:	ff 75 0c             	push   0xc(%ebp)
+  80242b:	50                   	push   %eax
+  80242c:	e8 24 01 00 00       	call   802555 <nsipc_bind>
+  802431:	83 c4 10             	add    $0x10,%esp
+  802434:	c9                   	leave
+  802435:	c3                   	ret
+
+00802436 <shutdown>:
+  802436:	55                   	push   %ebp
+  802437:	89 e5                	mov    %esp,%ebp
+  802439:	83 ec 08             	sub    $0x8,%esp
+  80243c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243f:	e8 f9 fe ff ff       	call   80233d <fd2sockid>
+  802444:	85 c0                	test   %eax,%eax
+  802446:	78 0f                	js     802457 <shutdown+0x21>
+  802448:	83 ec 08             	sub    $0x8,%esp
+  80244b:	ff 75 0c             	push   0xc(%ebp)
+  80244e:	50                   	push   %eax
+  80244f:	e8 36 01 00 00       	call   80258a <nsipc_shutdown>
+  802454:	83 c4 10             	add    $0x10,%esp
+  802457:	c9                   	leave
+  802458:	c3                   	ret
+
+00802459 <connect>:
+  802459:	55                   	push   %ebp
+  80245a:	89 e5                	mov    %esp,%ebp
+  80245c:	83 ec 08             	sub    $0x8,%esp
+  80245f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802462:	e8 d6 fe ff ff       	call   80233d <fd2sockid>
+  802467:	85 c0                	test   %eax,%eax
+  802469:	78 12                	js     80247d <connect+0x24>
+  80246b:	83 ec 04             	sub    $0x4,%esp
+  80246e:	ff 75 10             	push   0x10(%ebp)
+  802471:	ff 75 0c             	push   0xc(%ebp)
+  802474:	50                   	push   %eax
+  802475:	e8 4c 01 00 00       	call   8025c6 <nsipc_connect>
+  80247a:	83 c4 10             	add    $0x10,%esp
+  80247d:	c9                   	leave
+  80247e:	c3                   	ret
+
+0080247f <listen>:
+  80247f:	55                   	push   %ebp
+  802480:	89 e5                	mov    %esp,%ebp
+  802482:	83 ec 08             	sub    $0x8,%esp
+  802485:	8b 45 08             	mov    0x8(%ebp),%eax
+  802488:	e8 b0 fe ff ff       	call   80233d <fd2sockid>
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	78 0f                	js     8024a0 <listen+0x21>
+  802491:	83 ec 08             	sub    $0x8,%esp
+  802494:	ff 75 0c             	push   0xc(%ebp)
+  802497:	50                   	push   %eax
+  802498:	e8 5e 01 00 00       	call   8025fb <nsipc_listen>
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	c9                   	leave
+  8024a1:	c3                   	ret
+
+008024a2 <socket>:
+  8024a2:	55                   	push   %ebp
+  8024a3:	89 e5                	mov    %esp,%ebp
+  8024a5:	83 ec 0c             	sub    $0xc,%esp
+  8024a8:	ff 75 10             	push   0x10(%ebp)
+  8024ab:	ff 75 0c             	push   0xc(%ebp)
+  8024ae:	ff 75 08             	push   0x8(%ebp)
+  8024b1:	e8 34 02 00 00       	call   8026ea <nsipc_socket>
+  8024b6:	83 c4 10             	add    $0x10,%esp
+  8024b9:	85 c0                	test   %eax,%eax
+  8024bb:	78 05                	js     8024c2 <socket+0x20>
+  8024bd:	e8 ab fe ff ff       	call   80236d <alloc_sockfd>
+  8024c2:	c9                   	leave
+  8024c3:	c3                   	ret
+
+008024c4 <nsipc>:
+  8024c4:	55                   	push   %ebp
+  8024c5:	89 e5                	mov    %esp,%ebp
+  8024c7:	53                   	push   %ebx
+  8024c8:	83 ec 04             	sub    $0x4,%esp
+  8024cb:	89 c3                	mov    %eax,%ebx
+  8024cd:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8024d4:	74 1f                	je     8024f5 <nsipc+0x31>
+  8024d6:	83 ec 08             	sub    $0x8,%esp
+  8024d9:	6a 00                	push   $0x0
+  8024db:	6a 00                	push   $0x0
+  8024dd:	6a 07                	push   $0x7
+  8024df:	68 00 70 80 00       	push   $0x807000
+  8024e4:	53                   	push   %ebx
+  8024e5:	ff 35 0c 50 80 00    	push   0x80500c
+  8024eb:	e8 1d 0a 00 00       	call   802f0d <ipc_call>
+  8024f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f3:	c9                   	leave
+  8024f4:	c3                   	ret
+  8024f5:	83 ec 0c             	sub    $0xc,%esp
+  8024f8:	6a 03                	push   $0x3
+  8024fa:	e8 a9 0b 00 00       	call   8030a8 <ipc_find_env>
+  8024ff:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	eb cd                	jmp    8024d6 <nsipc+0x12>
+
+00802509 <nsipc_accept>:
+  802509:	55                   	push   %ebp
+  80250a:	89 e5                	mov    %esp,%ebp
+  80250c:	53                   	push   %ebx
+  80250d:	83 ec 04             	sub    $0x4,%esp
+  802510:	8b 45 08             	mov    0x8(%ebp),%eax
+  802513:	a3 00 70 80 00       	mov    %eax,0x807000
+  802518:	b8 01 00 00 00       	mov    $0x1,%eax
+  80251d:	e8 a2 ff ff ff       	call   8024c4 <nsipc>
+  802522:	89 c3                	mov    %eax,%ebx
+  802524:	85 c0                	test   %eax,%eax
+  802526:	79 07                	jns    80252f <nsipc_accept+0x26>
+  802528:	89 d8                	mov    %ebx,%eax
+  80252a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80252d:	c9                   	leave
+  80252e:	c3                   	ret
+  80252f:	83 ec 04             	sub    $0x4,%esp
+  802532:	ff 35 10 70 80 00    	push   0x807010
+  802538:	68 00 70 80 00       	push   $0x807000
+  80253d:	ff 75 0c             	push   0xc(%ebp)
+  802540:	e8 4d e6 ff ff       	call   800b92 <memmove>
+  802545:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80254b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80254e:	89 10                	mov    %edx,(%eax)
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	eb d3                	jmp    802528 <nsipc_accept+0x1f>
+
+00802555 <nsipc_bind>:
+  802555:	55                   	push   %ebp
+  802556:	89 e5                	mov    %esp,%ebp
+  802558:	53                   	push   %ebx
+  802559:	83 ec 08             	sub    $0x8,%esp
+  80255c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80255f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802562:	a3 00 70 80 00       	mov    %eax,0x807000
+  802567:	53                   	push   %ebx
+  802568:	ff 75 0c             	push   0xc(%ebp)
+  80256b:	68 04 70 80 00       	push   $0x807004
+  802570:	e8 1d e6 ff ff       	call   800b92 <memmove>
+  802575:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80257b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802580:	e8 3f ff ff ff       	call   8024c4 <nsipc>
+  802585:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802588:	c9                   	leave
+  802589:	c3                   	ret
+
+0080258a <nsipc_shutdown>:
+  80258a:	55                   	push   %ebp
+  80258b:	89 e5                	mov    %esp,%ebp
+  80258d:	83 ec 08             	sub    $0x8,%esp
+  802590:	8b 45 08             	mov    0x8(%ebp),%eax
+  802593:	a3 00 70 80 00       	mov    %eax,0x807000
+  802598:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259b:	a3 04 70 80 00       	mov    %eax,0x807004
+  8025a0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025a5:	e8 1a ff ff ff       	call   8024c4 <nsipc>
+  8025aa:	c9                   	leave
+  8025ab:	c3                   	ret
+
+008025ac <nsipc_close>:
+  8025ac:	55                   	push   %ebp
+  8025ad:	89 e5                	mov    %esp,%ebp
+  8025af:	83 ec 08             	sub    $0x8,%esp
+  8025b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b5:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025ba:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025bf:	e8 00 ff ff ff       	call   8024c4 <nsipc>
+  8025c4:	c9                   	leave
+  8025c5:	c3                   	ret
+
+008025c6 <nsipc_connect>:
+  8025c6:	55                   	push   %ebp
+  8025c7:	89 e5                	mov    %esp,%ebp
+  8025c9:	53                   	push   %ebx
+  8025ca:	83 ec 08             	sub    $0x8,%esp
+  8025cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d3:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025d8:	53                   	push   %ebx
+  8025d9:	ff 75 0c             	push   0xc(%ebp)
+  8025dc:	68 04 70 80 00       	push   $0x807004
+  8025e1:	e8 ac e5 ff ff       	call   800b92 <memmove>
+  8025e6:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8025ec:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025f1:	e8 ce fe ff ff       	call   8024c4 <nsipc>
+  8025f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+
+008025fb <nsipc_listen>:
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	83 ec 08             	sub    $0x8,%esp
+  802601:	8b 45 08             	mov    0x8(%ebp),%eax
+  802604:	a3 00 70 80 00       	mov    %eax,0x807000
+  802609:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80260c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802611:	b8 06 00 00 00       	mov    $0x6,%eax
+  802616:	e8 a9 fe ff ff       	call   8024c4 <nsipc>
+  80261b:	c9                   	leave
+  80261c:	c3                   	ret
+
+0080261d <nsipc_recv>:
+  80261d:	55                   	push   %ebp
+  80261e:	89 e5                	mov    %esp,%ebp
+  802620:	56                   	push   %esi
+  802621:	53                   	push   %ebx
+  802622:	8b 75 10             	mov    0x10(%ebp),%esi
+  802625:	8b 45 08             	mov    0x8(%ebp),%eax
+  802628:	a3 00 70 80 00       	mov    %eax,0x807000
+  80262d:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802633:	8b 45 14             	mov    0x14(%ebp),%eax
+  802636:	a3 08 70 80 00       	mov    %eax,0x807008
+  80263b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802640:	e8 7f fe ff ff       	call   8024c4 <nsipc>
+  802645:	89 c3                	mov    %eax,%ebx
+  802647:	85 c0                	test   %eax,%eax
+  802649:	78 22                	js     80266d <nsipc_recv+0x50>
+  80264b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802650:	39 c6                	cmp    %eax,%esi
+  802652:	0f 4e c6             	cmovle %esi,%eax
+  802655:	39 c3                	cmp    %eax,%ebx
+  802657:	7f 1d                	jg     802676 <nsipc_recv+0x59>
+  802659:	83 ec 04             	sub    $0x4,%esp
+  80265c:	53                   	push   %ebx
+  80265d:	68 00 70 80 00       	push   $0x807000
+  802662:	ff 75 0c             	push   0xc(%ebp)
+  802665:	e8 28 e5 ff ff       	call   800b92 <memmove>
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	89 d8                	mov    %ebx,%eax
+  80266f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802672:	5b                   	pop    %ebx
+  802673:	5e                   	pop    %esi
+  802674:	5d                   	pop    %ebp
+  802675:	c3                   	ret
+  802676:	68 14 3b 80 00       	push   $0x803b14
+  80267b:	68 29 3b 80 00       	push   $0x803b29
+  802680:	6a 60                	push   $0x60
+  802682:	68 3e 3b 80 00       	push   $0x803b3e
+  802687:	e8 83 07 00 00       	call   802e0f <_panic>
+
+0080268c <nsipc_send>:
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	53                   	push   %ebx
+  802690:	83 ec 04             	sub    $0x4,%esp
+  802693:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802696:	8b 45 08             	mov    0x8(%ebp),%eax
+  802699:	a3 00 70 80 00       	mov    %eax,0x807000
+  80269e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8026a4:	7f 2e                	jg     8026d4 <nsipc_send+0x48>
+  8026a6:	83 ec 04             	sub    $0x4,%esp
+  8026a9:	53                   	push   %ebx
+  8026aa:	ff 75 0c             	push   0xc(%ebp)
+  8026ad:	68 0c 70 80 00       	push   $0x80700c
+  8026b2:	e8 db e4 ff ff       	call   800b92 <memmove>
+  8026b7:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8026bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026c0:	a3 08 70 80 00       	mov    %eax,0x807008
+  8026c5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026ca:	e8 f5 fd ff ff       	call   8024c4 <nsipc>
+  8026cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d2:	c9                   	leave
+  8026d3:	c3                   	ret
+  8026d4:	68 4a 3b 80 00       	push   $0x803b4a
+  8026d9:	68 29 3b 80 00       	push   $0x803b29
+  8026de:	6a 6b                	push   $0x6b
+  8026e0:	68 3e 3b 80 00       	push   $0x803b3e
+  8026e5:	e8 25 07 00 00       	call   802e0f <_panic>
+
+008026ea <nsipc_socket>:
+  8026ea:	55                   	push   %ebp
+  8026eb:	89 e5                	mov    %esp,%ebp
+  8026ed:	83 ec 08             	sub    $0x8,%esp
+  8026f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f3:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026fb:	a3 04 70 80 00       	mov    %eax,0x807004
+  802700:	8b 45 10             	mov    0x10(%ebp),%eax
+  802703:	a3 08 70 80 00       	mov    %eax,0x807008
+  802708:	b8 09 00 00 00       	mov    $0x9,%eax
+  80270d:	e8 b2 fd ff ff       	call   8024c4 <nsipc>
+  802712:	c9                   	leave
+  802713:	c3                   	ret
+
+00802714 <devpipe_stat>:
+  802714:	55                   	push   %ebp
+  802715:	89 e5                	mov    %esp,%ebp
+  802717:	56                   	push   %esi
+  802718:	53                   	push   %ebx
+  802719:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80271c:	83 ec 0c             	sub    $0xc,%esp
+  80271f:	ff 75 08             	push   0x8(%ebp)
+  802722:	e8 99 ef ff ff       	call   8016c0 <fd2data>
+  802727:	89 c6                	mov    %eax,%esi
+  802729:	83 c4 08             	add    $0x8,%esp
+  80272c:	68 56 3b 80 00       	push   $0x803b56
+  802731:	53                   	push   %ebx
+  802732:	e8 ab e2 ff ff       	call   8009e2 <strcpy>
+  802737:	8b 46 04             	mov    0x4(%esi),%eax
+  80273a:	2b 06                	sub    (%esi),%eax
+  80273c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802742:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802749:	00 00 00 
+  80274c:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802753:	40 80 00 
+  802756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80275b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80275e:	5b                   	pop    %ebx
+  80275f:	5e                   	pop    %esi
+  802760:	5d                   	pop    %ebp
+  802761:	c3                   	ret
+
+00802762 <devpipe_close>:
+  802762:	55                   	push   %ebp
+  802763:	89 e5                	mov    %esp,%ebp
+  802765:	53                   	push   %ebx
+  802766:	83 ec 0c             	sub    $0xc,%esp
+  802769:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80276c:	53                   	push   %ebx
+  80276d:	6a 00                	push   $0x0
+  80276f:	e8 a0 e7 ff ff       	call   800f14 <sys_page_unmap>
+  802774:	89 1c 24             	mov    %ebx,(%esp)
+  802777:	e8 44 ef ff ff       	call   8016c0 <fd2data>
+  80277c:	83 c4 08             	add    $0x8,%esp
+  80277f:	50                   	push   %eax
+  802780:	6a 00                	push   $0x0
+  802782:	e8 8d e7 ff ff       	call   800f14 <sys_page_unmap>
+  802787:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80278a:	c9                   	leave
+  80278b:	c3                   	ret
+
+0080278c <_pipeisclosed>:
+  80278c:	55                   	push   %ebp
+  80278d:	89 e5                	mov    %esp,%ebp
+  80278f:	57                   	push   %edi
+  802790:	56                   	push   %esi
+  802791:	53                   	push   %ebx
+  802792:	83 ec 1c             	sub    $0x1c,%esp
+  802795:	89 c7                	mov    %eax,%edi
+  802797:	89 d6                	mov    %edx,%esi
+  802799:	a1 20 50 80 00       	mov    0x805020,%eax
+  80279e:	8b 58 58             	mov    0x58(%eax),%ebx
+  8027a1:	83 ec 0c             	sub    $0xc,%esp
+  8027a4:	57                   	push   %edi
+  8027a5:	e8 18 09 00 00       	call   8030c2 <pageref>
+  8027aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027ad:	89 34 24             	mov    %esi,(%esp)
+  8027b0:	e8 0d 09 00 00       	call   8030c2 <pageref>
+  8027b5:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8027bb:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8027be:	83 c4 10             	add    $0x10,%esp
+  8027c1:	39 cb                	cmp    %ecx,%ebx
+  8027c3:	74 1b                	je     8027e0 <_pipeisclosed+0x54>
+  8027c5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027c8:	75 cf                	jne    802799 <_pipeisclosed+0xd>
+  8027ca:	8b 42 58             	mov    0x58(%edx),%eax
+  8027cd:	6a 01                	push   $0x1
+  8027cf:	50                   	push   %eax
+  8027d0:	53                   	push   %ebx
+  8027d1:	68 5d 3b 80 00       	push   $0x803b5d
+  8027d6:	e8 10 db ff ff       	call   8002eb <cprintf>
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	eb b9                	jmp    802799 <_pipeisclosed+0xd>
+  8027e0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027e3:	0f 94 c0             	sete   %al
+  8027e6:	0f b6 c0             	movzbl %al,%eax
+  8027e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ec:	5b                   	pop    %ebx
+  8027ed:	5e                   	pop    %esi
+  8027ee:	5f                   	pop    %edi
+  8027ef:	5d                   	pop    %ebp
+  8027f0:	c3                   	ret
+
+008027f1 <devpipe_write>:
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	57                   	push   %edi
+  8027f5:	56                   	push   %esi
+  8027f6:	53                   	push   %ebx
+  8027f7:	83 ec 28             	sub    $0x28,%esp
+  8027fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027fd:	56                   	push   %esi
+  8027fe:	e8 bd ee ff ff       	call   8016c0 <fd2data>
+  802803:	89 c3                	mov    %eax,%ebx
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	bf 00 00 00 00       	mov    $0x0,%edi
+  80280d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802811:	74 5c                	je     80286f <devpipe_write+0x7e>
+  802813:	8b 43 04             	mov    0x4(%ebx),%eax
+  802816:	8b 0b                	mov    (%ebx),%ecx
+  802818:	8d 51 20             	lea    0x20(%ecx),%edx
+  80281b:	39 d0                	cmp    %edx,%eax
+  80281d:	72 1e                	jb     80283d <devpipe_write+0x4c>
+  80281f:	89 da                	mov    %ebx,%edx
+  802821:	89 f0                	mov    %esi,%eax
+  802823:	e8 64 ff ff ff       	call   80278c <_pipeisclosed>
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	75 48                	jne    802874 <devpipe_write+0x83>
+  80282c:	e8 c6 e5 ff ff       	call   800df7 <sys_yield>
+  802831:	8b 43 04             	mov    0x4(%ebx),%eax
+  802834:	8b 0b                	mov    (%ebx),%ecx
+  802836:	8d 51 20             	lea    0x20(%ecx),%edx
+  802839:	39 d0                	cmp    %edx,%eax
+  80283b:	73 e2                	jae    80281f <devpipe_write+0x2e>
+  80283d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802840:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802844:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802847:	89 c2                	mov    %eax,%edx
+  802849:	c1 fa 1f             	sar    $0x1f,%edx
+  80284c:	89 d1                	mov    %edx,%ecx
+  80284e:	c1 e9 1b             	shr    $0x1b,%ecx
+  802851:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802854:	83 e2 1f             	and    $0x1f,%edx
+  802857:	29 ca                	sub    %ecx,%edx
+  802859:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80285d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802861:	83 c0 01             	add    $0x1,%eax
+  802864:	89 43 04             	mov    %eax,0x4(%ebx)
+  802867:	83 c7 01             	add    $0x1,%edi
+  80286a:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80286d:	75 a4                	jne    802813 <devpipe_write+0x22>
+  80286f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802872:	eb 05                	jmp    802879 <devpipe_write+0x88>
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+  802879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80287c:	5b                   	pop    %ebx
+  80287d:	5e                   	pop    %esi
+  80287e:	5f                   	pop    %edi
+  80287f:	5d                   	pop    %ebp
+  802880:	c3                   	ret
+
+00802881 <devpipe_read>:
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	57                   	push   %edi
+  802885:	56                   	push   %esi
+  802886:	53                   	push   %ebx
+  802887:	83 ec 18             	sub    $0x18,%esp
+  80288a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80288d:	56                   	push   %esi
+  80288e:	e8 2d ee ff ff       	call   8016c0 <fd2data>
+  802893:	89 c3                	mov    %eax,%ebx
+  802895:	83 c4 10             	add    $0x10,%esp
+  802898:	bf 00 00 00 00       	mov    $0x0,%edi
+  80289d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028a1:	74 45                	je     8028e8 <devpipe_read+0x67>
+  8028a3:	8b 03                	mov    (%ebx),%eax
+  8028a5:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028a8:	75 1d                	jne    8028c7 <devpipe_read+0x46>
+  8028aa:	85 ff                	test   %edi,%edi
+  8028ac:	75 3f                	jne    8028ed <devpipe_read+0x6c>
+  8028ae:	89 da                	mov    %ebx,%edx
+  8028b0:	89 f0                	mov    %esi,%eax
+  8028b2:	e8 d5 fe ff ff       	call   80278c <_pipeisclosed>
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	75 3c                	jne    8028f7 <devpipe_read+0x76>
+  8028bb:	e8 37 e5 ff ff       	call   800df7 <sys_yield>
+  8028c0:	8b 03                	mov    (%ebx),%eax
+  8028c2:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028c5:	74 e7                	je     8028ae <devpipe_read+0x2d>
+  8028c7:	99                   	cltd
+  8028c8:	c1 ea 1b             	shr    $0x1b,%edx
+  8028cb:	01 d0                	add    %edx,%eax
+  8028cd:	83 e0 1f             	and    $0x1f,%eax
+  8028d0:	29 d0                	sub    %edx,%eax
+  8028d2:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028da:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8028dd:	83 03 01             	addl   $0x1,(%ebx)
+  8028e0:	83 c7 01             	add    $0x1,%edi
+  8028e3:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8028e6:	75 bb                	jne    8028a3 <devpipe_read+0x22>
+  8028e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028eb:	eb 02                	jmp    8028ef <devpipe_read+0x6e>
+  8028ed:	89 f8                	mov    %edi,%eax
+  8028ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f2:	5b                   	pop    %ebx
+  8028f3:	5e                   	pop    %esi
+  8028f4:	5f                   	pop    %edi
+  8028f5:	5d                   	pop    %ebp
+  8028f6:	c3                   	ret
+  8028f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fc:	eb f1                	jmp    8028ef <devpipe_read+0x6e>
+
+008028fe <pipe>:
+  8028fe:	55                   	push   %ebp
+  8028ff:	89 e5                	mov    %esp,%ebp
+  802901:	56                   	push   %esi
+  802902:	53                   	push   %ebx
+  802903:	83 ec 1c             	sub    $0x1c,%esp
+  802906:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802909:	50                   	push   %eax
+  80290a:	e8 c8 ed ff ff       	call   8016d7 <fd_alloc>
+  80290f:	89 c3                	mov    %eax,%ebx
+  802911:	83 c4 10             	add    $0x10,%esp
+  802914:	85 c0                	test   %eax,%eax
+  802916:	0f 88 23 01 00 00    	js     802a3f <pipe+0x141>
+  80291c:	83 ec 04             	sub    $0x4,%esp
+  80291f:	68 07 04 00 00       	push   $0x407
+  802924:	ff 75 f4             	push   -0xc(%ebp)
+  802927:	6a 00                	push   $0x0
+  802929:	e8 14 e5 ff ff       	call   800e42 <sys_page_alloc>
+  80292e:	89 c3                	mov    %eax,%ebx
+  802930:	83 c4 10             	add    $0x10,%esp
+  802933:	85 c0                	test   %eax,%eax
+  802935:	0f 88 04 01 00 00    	js     802a3f <pipe+0x141>
+  80293b:	83 ec 0c             	sub    $0xc,%esp
+  80293e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802941:	50                   	push   %eax
+  802942:	e8 90 ed ff ff       	call   8016d7 <fd_alloc>
+  802947:	89 c3                	mov    %eax,%ebx
+  802949:	83 c4 10             	add    $0x10,%esp
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	0f 88 db 00 00 00    	js     802a2f <pipe+0x131>
+  802954:	83 ec 04             	sub    $0x4,%esp
+  802957:	68 07 04 00 00       	push   $0x407
+  80295c:	ff 75 f0             	push   -0x10(%ebp)
+  80295f:	6a 00                	push   $0x0
+  802961:	e8 dc e4 ff ff       	call   800e42 <sys_page_alloc>
+  802966:	89 c3                	mov    %eax,%ebx
+  802968:	83 c4 10             	add    $0x10,%esp
+  80296b:	85 c0                	test   %eax,%eax
+  80296d:	0f 88 bc 00 00 00    	js     802a2f <pipe+0x131>
+  802973:	83 ec 0c             	sub    $0xc,%esp
+  802976:	ff 75 f4             	push   -0xc(%ebp)
+  802979:	e8 42 ed ff ff       	call   8016c0 <fd2data>
+  80297e:	89 c6                	mov    %eax,%esi
+  802980:	83 c4 0c             	add    $0xc,%esp
+  802983:	68 07 04 00 00       	push   $0x407
+  802988:	50                   	push   %eax
+  802989:	6a 00                	push   $0x0
+  80298b:	e8 b2 e4 ff ff       	call   800e42 <sys_page_alloc>
+  802990:	89 c3                	mov    %eax,%ebx
+  802992:	83 c4 10             	add    $0x10,%esp
+  802995:	85 c0                	test   %eax,%eax
+  802997:	0f 88 82 00 00 00    	js     802a1f <pipe+0x121>
+  80299d:	83 ec 0c             	sub    $0xc,%esp
+  8029a0:	ff 75 f0             	push   -0x10(%ebp)
+  8029a3:	e8 18 ed ff ff       	call   8016c0 <fd2data>
+  8029a8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029af:	50                   	push   %eax
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	56                   	push   %esi
+  8029b3:	6a 00                	push   $0x0
+  8029b5:	e8 cb e4 ff ff       	call   800e85 <sys_page_map>
+  8029ba:	89 c3                	mov    %eax,%ebx
+  8029bc:	83 c4 20             	add    $0x20,%esp
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	78 4e                	js     802a11 <pipe+0x113>
+  8029c3:	a1 40 40 80 00       	mov    0x804040,%eax
+  8029c8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029cb:	89 02                	mov    %eax,(%edx)
+  8029cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029d0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8029d7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029da:	89 02                	mov    %eax,(%edx)
+  8029dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029df:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8029e6:	83 ec 0c             	sub    $0xc,%esp
+  8029e9:	ff 75 f4             	push   -0xc(%ebp)
+  8029ec:	e8 bf ec ff ff       	call   8016b0 <fd2num>
+  8029f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029f4:	89 01                	mov    %eax,(%ecx)
+  8029f6:	83 c4 04             	add    $0x4,%esp
+  8029f9:	ff 75 f0             	push   -0x10(%ebp)
+  8029fc:	e8 af ec ff ff       	call   8016b0 <fd2num>
+  802a01:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a04:	89 41 04             	mov    %eax,0x4(%ecx)
+  802a07:	83 c4 10             	add    $0x10,%esp
+  802a0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a0f:	eb 2e                	jmp    802a3f <pipe+0x141>
+  802a11:	83 ec 08             	sub    $0x8,%esp
+  802a14:	56                   	push   %esi
+  802a15:	6a 00                	push   $0x0
+  802a17:	e8 f8 e4 ff ff       	call   800f14 <sys_page_unmap>
+  802a1c:	83 c4 10             	add    $0x10,%esp
+  802a1f:	83 ec 08             	sub    $0x8,%esp
+  802a22:	ff 75 f0             	push   -0x10(%ebp)
+  802a25:	6a 00                	push   $0x0
+  802a27:	e8 e8 e4 ff ff       	call   800f14 <sys_page_unmap>
+  802a2c:	83 c4 10             	add    $0x10,%esp
+  802a2f:	83 ec 08             	sub    $0x8,%esp
+  802a32:	ff 75 f4             	push   -0xc(%ebp)
+  802a35:	6a 00                	push   $0x0
+  802a37:	e8 d8 e4 ff ff       	call   800f14 <sys_page_unmap>
+  802a3c:	83 c4 10             	add    $0x10,%esp
+  802a3f:	89 d8                	mov    %ebx,%eax
+  802a41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a44:	5b                   	pop    %ebx
+  802a45:	5e                   	pop    %esi
+  802a46:	5d                   	pop    %ebp
+  802a47:	c3                   	ret
+
+00802a48 <pipeisclosed>:
+  802a48:	55                   	push   %ebp
+  802a49:	89 e5                	mov    %esp,%ebp
+  802a4b:	83 ec 20             	sub    $0x20,%esp
+  802a4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a51:	50                   	push   %eax
+  802a52:	ff 75 08             	push   0x8(%ebp)
+  802a55:	e8 cd ec ff ff       	call   801727 <fd_lookup>
+  802a5a:	83 c4 10             	add    $0x10,%esp
+  802a5d:	85 c0                	test   %eax,%eax
+  802a5f:	78 18                	js     802a79 <pipeisclosed+0x31>
+  802a61:	83 ec 0c             	sub    $0xc,%esp
+  802a64:	ff 75 f4             	push   -0xc(%ebp)
+  802a67:	e8 54 ec ff ff       	call   8016c0 <fd2data>
+  802a6c:	89 c2                	mov    %eax,%edx
+  802a6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a71:	e8 16 fd ff ff       	call   80278c <_pipeisclosed>
+  802a76:	83 c4 10             	add    $0x10,%esp
+  802a79:	c9                   	leave
+  802a7a:	c3                   	ret
+
+00802a7b <ipcring_init>:
+  802a7b:	55                   	push   %ebp
+  802a7c:	89 e5                	mov    %esp,%ebp
+  802a7e:	53                   	push   %ebx
+  802a7f:	83 ec 08             	sub    $0x8,%esp
+  802a82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a85:	6a 60                	push   $0x60
+  802a87:	6a 00                	push   $0x0
+  802a89:	53                   	push   %ebx
+  802a8a:	e8 ce e0 ff ff       	call   800b5d <memset>
+  802a8f:	a1 20 50 80 00       	mov    0x805020,%eax
+  802a94:	8b 40 48             	mov    0x48(%eax),%eax
+  802a97:	89 03                	mov    %eax,(%ebx)
+  802a99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a9c:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a9f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aa2:	89 43 08             	mov    %eax,0x8(%ebx)
+  802aa5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aa8:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802aab:	83 c4 10             	add    $0x10,%esp
+  802aae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab1:	c9                   	leave
+  802ab2:	c3                   	ret
+
+00802ab3 <ipcring_req_slot>:
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab9:	8b 50 10             	mov    0x10(%eax),%edx
+  802abc:	8b 48 18             	mov    0x18(%eax),%ecx
+  802abf:	29 ca                	sub    %ecx,%edx
+  802ac1:	83 fa 07             	cmp    $0x7,%edx
+  802ac4:	77 0c                	ja     802ad2 <ipcring_req_slot+0x1f>
+  802ac6:	8b 50 10             	mov    0x10(%eax),%edx
+  802ac9:	83 e2 07             	and    $0x7,%edx
+  802acc:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802ad0:	5d                   	pop    %ebp
+  802ad1:	c3                   	ret
+  802ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad7:	eb f7                	jmp    802ad0 <ipcring_req_slot+0x1d>
+
+00802ad9 <ipcring_req_push>:
+  802ad9:	55                   	push   %ebp
+  802ada:	89 e5                	mov    %esp,%ebp
+  802adc:	83 ec 08             	sub    $0x8,%esp
+  802adf:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ae2:	8b 42 10             	mov    0x10(%edx),%eax
+  802ae5:	83 c0 01             	add    $0x1,%eax
+  802ae8:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af1:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	75 02                	jne    802afb <ipcring_req_push+0x22>
+  802af9:	c9                   	leave
+  802afa:	c3                   	ret
+  802afb:	6a 00                	push   $0x0
+  802afd:	68 00 00 80 ee       	push   $0xee800000
+  802b02:	ff 72 08             	push   0x8(%edx)
+  802b05:	ff 72 04             	push   0x4(%edx)
+  802b08:	e8 6d e6 ff ff       	call   80117a <sys_ipc_send>
+  802b0d:	83 c4 10             	add    $0x10,%esp
+  802b10:	eb e7                	jmp    802af9 <ipcring_req_push+0x20>
+
+00802b12 <ipcring_rsp_wait>:
+  802b12:	55                   	push   %ebp
+  802b13:	89 e5                	mov    %esp,%ebp
+  802b15:	53                   	push   %ebx
+  802b16:	83 ec 04             	sub    $0x4,%esp
+  802b19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b1c:	8b 53 18             	mov    0x18(%ebx),%edx
+  802b1f:	8b 43 10             	mov    0x10(%ebx),%eax
+  802b22:	39 c2                	cmp    %eax,%edx
+  802b24:	74 3c                	je     802b62 <ipcring_rsp_wait+0x50>
+  802b26:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b29:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b2c:	39 c2                	cmp    %eax,%edx
+  802b2e:	75 23                	jne    802b53 <ipcring_rsp_wait+0x41>
+  802b30:	83 ec 08             	sub    $0x8,%esp
+  802b33:	6a 00                	push   $0x0
+  802b35:	6a 00                	push   $0x0
+  802b37:	6a 00                	push   $0x0
+  802b39:	6a 00                	push   $0x0
+  802b3b:	ff 73 0c             	push   0xc(%ebx)
+  802b3e:	ff 73 04             	push   0x4(%ebx)
+  802b41:	e8 c7 03 00 00       	call   802f0d <ipc_call>
+  802b46:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b49:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b4c:	83 c4 20             	add    $0x20,%esp
+  802b4f:	39 c2                	cmp    %eax,%edx
+  802b51:	74 dd                	je     802b30 <ipcring_rsp_wait+0x1e>
+  802b53:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b56:	83 e0 07             	and    $0x7,%eax
+  802b59:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802b5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b60:	c9                   	leave
+  802b61:	c3                   	ret
+  802b62:	68 78 3b 80 00       	push   $0x803b78
+  802b67:	68 29 3b 80 00       	push   $0x803b29
+  802b6c:	6a 3b                	push   $0x3b
+  802b6e:	68 99 3b 80 00       	push   $0x803b99
+  802b73:	e8 97 02 00 00       	call   802e0f <_panic>
+
+00802b78 <ipcring_rsp_pop>:
+  802b78:	55                   	push   %ebp
+  802b79:	89 e5                	mov    %esp,%ebp
+  802b7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b7e:	8b 42 18             	mov    0x18(%edx),%eax
+  802b81:	83 c0 01             	add    $0x1,%eax
+  802b84:	89 42 18             	mov    %eax,0x18(%edx)
+  802b87:	5d                   	pop    %ebp
+  802b88:	c3                   	ret
+
+00802b89 <ipcring_server_init>:
+  802b89:	55                   	push   %ebp
+  802b8a:	89 e5                	mov    %esp,%ebp
+  802b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b92:	89 10                	mov    %edx,(%eax)
+  802b94:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b97:	89 50 04             	mov    %edx,0x4(%eax)
+  802b9a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802ba1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802ba8:	5d                   	pop    %ebp
+  802ba9:	c3                   	ret
+
+00802baa <ipcring_req_avail>:
+  802baa:	55                   	push   %ebp
+  802bab:	89 e5                	mov    %esp,%ebp
+  802bad:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bb0:	8b 02                	mov    (%edx),%eax
+  802bb2:	8b 40 10             	mov    0x10(%eax),%eax
+  802bb5:	2b 42 08             	sub    0x8(%edx),%eax
+  802bb8:	ba 08 00 00 00       	mov    $0x8,%edx
+  802bbd:	39 d0                	cmp    %edx,%eax
+  802bbf:	0f 47 c2             	cmova  %edx,%eax
+  802bc2:	5d                   	pop    %ebp
+  802bc3:	c3                   	ret
+
+00802bc4 <ipcring_req_peek>:
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bca:	8b 42 08             	mov    0x8(%edx),%eax
+  802bcd:	83 e0 07             	and    $0x7,%eax
+  802bd0:	8b 12                	mov    (%edx),%edx
+  802bd2:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802bd6:	5d                   	pop    %ebp
+  802bd7:	c3                   	ret
+
+00802bd8 <ipcring_rsp_push>:
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	83 ec 08             	sub    $0x8,%esp
+  802bde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802be1:	8b 41 08             	mov    0x8(%ecx),%eax
+  802be4:	83 c0 01             	add    $0x1,%eax
+  802be7:	89 41 08             	mov    %eax,0x8(%ecx)
+  802bea:	8b 11                	mov    (%ecx),%edx
+  802bec:	83 c2 14             	add    $0x14,%edx
+  802bef:	f0 87 02             	lock xchg %eax,(%edx)
+  802bf2:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802bf6:	75 02                	jne    802bfa <ipcring_rsp_push+0x22>
+  802bf8:	c9                   	leave
+  802bf9:	c3                   	ret
+  802bfa:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802c01:	6a 00                	push   $0x0
+  802c03:	68 00 00 80 ee       	push   $0xee800000
+  802c08:	6a 00                	push   $0x0
+  802c0a:	ff 71 04             	push   0x4(%ecx)
+  802c0d:	e8 8b e4 ff ff       	call   80109d <sys_ipc_try_send>
+  802c12:	83 c4 10             	add    $0x10,%esp
+  802c15:	eb e1                	jmp    802bf8 <ipcring_rsp_push+0x20>
+
+00802c17 <ipcring_client_wait>:
+  802c17:	55                   	push   %ebp
+  802c18:	89 e5                	mov    %esp,%ebp
+  802c1a:	83 ec 08             	sub    $0x8,%esp
+  802c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c20:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802c27:	8b 10                	mov    (%eax),%edx
+  802c29:	8b 52 18             	mov    0x18(%edx),%edx
+  802c2c:	3b 50 08             	cmp    0x8(%eax),%edx
+  802c2f:	75 02                	jne    802c33 <ipcring_client_wait+0x1c>
+  802c31:	c9                   	leave
+  802c32:	c3                   	ret
+  802c33:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802c3a:	6a 00                	push   $0x0
+  802c3c:	68 00 00 80 ee       	push   $0xee800000
+  802c41:	6a 00                	push   $0x0
+  802c43:	ff 70 04             	push   0x4(%eax)
+  802c46:	e8 52 e4 ff ff       	call   80109d <sys_ipc_try_send>
+  802c4b:	83 c4 10             	add    $0x10,%esp
+  802c4e:	eb e1                	jmp    802c31 <ipcring_client_wait+0x1a>
+
+00802c50 <ipcring_server_sleep>:
+  802c50:	55                   	push   %ebp
+  802c51:	89 e5                	mov    %esp,%ebp
+  802c53:	53                   	push   %ebx
+  802c54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c57:	8b 01                	mov    (%ecx),%eax
+  802c59:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802c5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c61:	f0 87 02             	lock xchg %eax,(%edx)
+  802c64:	8b 11                	mov    (%ecx),%edx
+  802c66:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802c69:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c6e:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802c71:	74 0e                	je     802c81 <ipcring_server_sleep+0x31>
+  802c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c78:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c84:	c9                   	leave
+  802c85:	c3                   	ret
+
+00802c86 <devcons_close>:
+  802c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8b:	c3                   	ret
+
+00802c8c <devcons_stat>:
+  802c8c:	55                   	push   %ebp
+  802c8d:	89 e5                	mov    %esp,%ebp
+  802c8f:	83 ec 10             	sub    $0x10,%esp
+  802c92:	68 a7 3b 80 00       	push   $0x803ba7
+  802c97:	ff 75 0c             	push   0xc(%ebp)
+  802c9a:	e8 43 dd ff ff       	call   8009e2 <strcpy>
+  802c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+
+00802ca6 <devcons_write>:
+  802ca6:	55                   	push   %ebp
+  802ca7:	89 e5                	mov    %esp,%ebp
+  802ca9:	57                   	push   %edi
+  802caa:	56                   	push   %esi
+  802cab:	53                   	push   %ebx
+  802cac:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802cb2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802cb5:	85 ff                	test   %edi,%edi
+  802cb7:	74 51                	je     802d0a <devcons_write+0x64>
+  802cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc3:	89 fb                	mov    %edi,%ebx
+  802cc5:	29 c3                	sub    %eax,%ebx
+  802cc7:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802ccc:	39 d3                	cmp    %edx,%ebx
+  802cce:	0f 47 da             	cmova  %edx,%ebx
+  802cd1:	83 ec 04             	sub    $0x4,%esp
+  802cd4:	53                   	push   %ebx
+  802cd5:	03 45 0c             	add    0xc(%ebp),%eax
+  802cd8:	50                   	push   %eax
+  802cd9:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802cdf:	50                   	push   %eax
+  802ce0:	e8 ad de ff ff       	call   800b92 <memmove>
+  802ce5:	83 c4 08             	add    $0x8,%esp
+  802ce8:	53                   	push   %ebx
+  802ce9:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802cef:	50                   	push   %eax
+  802cf0:	e8 65 e0 ff ff       	call   800d5a <sys_cputs>
+  802cf5:	01 de                	add    %ebx,%esi
+  802cf7:	89 f0                	mov    %esi,%eax
+  802cf9:	83 c4 10             	add    $0x10,%esp
+  802cfc:	39 fe                	cmp    %edi,%esi
+  802cfe:	72 c3                	jb     802cc3 <devcons_write+0x1d>
+  802d00:	89 f0                	mov    %esi,%eax
+  802d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d05:	5b                   	pop    %ebx
+  802d06:	5e                   	pop    %esi
+  802d07:	5f                   	pop    %edi
+  802d08:	5d                   	pop    %ebp
+  802d09:	c3                   	ret
+  802d0a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d0f:	eb ef                	jmp    802d00 <devcons_write+0x5a>
+
+00802d11 <devcons_read>:
+  802d11:	55                   	push   %ebp
+  802d12:	89 e5                	mov    %esp,%ebp
+  802d14:	83 ec 08             	sub    $0x8,%esp
+  802d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d20:	75 07                	jne    802d29 <devcons_read+0x18>
+  802d22:	eb 1f                	jmp    802d43 <devcons_read+0x32>
+  802d24:	e8 ce e0 ff ff       	call   800df7 <sys_yield>
+  802d29:	e8 4a e0 ff ff       	call   800d78 <sys_cgetc>
+  802d2e:	85 c0                	test   %eax,%eax
+  802d30:	74 f2                	je     802d24 <devcons_read+0x13>
+  802d32:	78 0f                	js     802d43 <devcons_read+0x32>
+  802d34:	83 f8 04             	cmp    $0x4,%eax
+  802d37:	74 0c                	je     802d45 <devcons_read+0x34>
+  802d39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d3c:	88 02                	mov    %al,(%edx)
+  802d3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d43:	c9                   	leave
+  802d44:	c3                   	ret
+  802d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4a:	eb f7                	jmp    802d43 <devcons_read+0x32>
+
+00802d4c <cputchar>:
+  802d4c:	55                   	push   %ebp
+  802d4d:	89 e5                	mov    %esp,%ebp
+  802d4f:	83 ec 20             	sub    $0x20,%esp
+  802d52:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d55:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802d58:	6a 01                	push   $0x1
+  802d5a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d5d:	50                   	push   %eax
+  802d5e:	e8 f7 df ff ff       	call   800d5a <sys_cputs>
+  802d63:	83 c4 10             	add    $0x10,%esp
+  802d66:	c9                   	leave
+  802d67:	c3                   	ret
+
+00802d68 <getchar>:
+  802d68:	55                   	push   %ebp
+  802d69:	89 e5                	mov    %esp,%ebp
+  802d6b:	83 ec 1c             	sub    $0x1c,%esp
+  802d6e:	6a 01                	push   $0x1
+  802d70:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d73:	50                   	push   %eax
+  802d74:	6a 00                	push   $0x0
+  802d76:	e8 0e ec ff ff       	call   801989 <read>
+  802d7b:	83 c4 10             	add    $0x10,%esp
+  802d7e:	85 c0                	test   %eax,%eax
+  802d80:	78 06                	js     802d88 <getchar+0x20>
+  802d82:	74 06                	je     802d8a <getchar+0x22>
+  802d84:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802d88:	c9                   	leave
+  802d89:	c3                   	ret
+  802d8a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802d8f:	eb f7                	jmp    802d88 <getchar+0x20>
+
+00802d91 <iscons>:
+  802d91:	55                   	push   %ebp
+  802d92:	89 e5                	mov    %esp,%ebp
+  802d94:	83 ec 20             	sub    $0x20,%esp
+  802d97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d9a:	50                   	push   %eax
+  802d9b:	ff 75 08             	push   0x8(%ebp)
+  802d9e:	e8 84 e9 ff ff       	call   801727 <fd_lookup>
+  802da3:	83 c4 10             	add    $0x10,%esp
+  802da6:	85 c0                	test   %eax,%eax
+  802da8:	78 11                	js     802dbb <iscons+0x2a>
+  802daa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dad:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802db3:	39 10                	cmp    %edx,(%eax)
+  802db5:	0f 94 c0             	sete   %al
+  802db8:	0f b6 c0             	movzbl %al,%eax
+  802dbb:	c9                   	leave
+  802dbc:	c3                   	ret
+
+00802dbd <opencons>:
+  802dbd:	55                   	push   %ebp
+  802dbe:	89 e5                	mov    %esp,%ebp
+  802dc0:	83 ec 24             	sub    $0x24,%esp
+  802dc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dc6:	50                   	push   %eax
+  802dc7:	e8 0b e9 ff ff       	call   8016d7 <fd_alloc>
+  802dcc:	83 c4 10             	add    $0x10,%esp
+  802dcf:	85 c0                	test   %eax,%eax
+  802dd1:	78 3a                	js     802e0d <opencons+0x50>
+  802dd3:	83 ec 04             	sub    $0x4,%esp
+  802dd6:	68 07 04 00 00       	push   $0x407
+  802ddb:	ff 75 f4             	push   -0xc(%ebp)
+  802dde:	6a 00                	push   $0x0
+  802de0:	e8 5d e0 ff ff       	call   800e42 <sys_page_alloc>
+  802de5:	83 c4 10             	add    $0x10,%esp
+  802de8:	85 c0                	test   %eax,%eax
+  802dea:	78 21                	js     802e0d <opencons+0x50>
+  802dec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802def:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802df5:	89 10                	mov    %edx,(%eax)
+  802df7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dfa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802e01:	83 ec 0c             	sub    $0xc,%esp
+  802e04:	50                   	push   %eax
+  802e05:	e8 a6 e8 ff ff       	call   8016b0 <fd2num>
+  802e0a:	83 c4 10             	add    $0x10,%esp
+  802e0d:	c9                   	leave
+  802e0e:	c3                   	ret
+
+00802e0f <_panic>:
+  802e0f:	55                   	push   %ebp
+  802e10:	89 e5                	mov    %esp,%ebp
+  802e12:	56                   	push   %esi
+  802e13:	53                   	push   %ebx
+  802e14:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802e17:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  802e1d:	e8 b6 df ff ff       	call   800dd8 <sys_getenvid>
+  802e22:	83 ec 0c             	sub    $0xc,%esp
+  802e25:	ff 75 0c             	push   0xc(%ebp)
+  802e28:	ff 75 08             	push   0x8(%ebp)
+  802e2b:	56                   	push   %esi
+  802e2c:	50                   	push   %eax
+  802e2d:	68 b4 3b 80 00       	push   $0x803bb4
+  802e32:	e8 b4 d4 ff ff       	call   8002eb <cprintf>
+  802e37:	83 c4 18             	add    $0x18,%esp
+  802e3a:	53                   	push   %ebx
+  802e3b:	ff 75 10             	push   0x10(%ebp)
+  802e3e:	e8 57 d4 ff ff       	call   80029a <vcprintf>
+  802e43:	c7 04 24 d4 36 80 00 	movl   $0x8036d4,(%esp)
+  802e4a:	e8 9c d4 ff ff       	call   8002eb <cprintf>
+  802e4f:	83 c4 10             	add    $0x10,%esp
+  802e52:	cc                   	int3
+  802e53:	eb fd                	jmp    802e52 <_panic+0x43>
+
+00802e55 <ipc_recv>:
+  802e55:	55                   	push   %ebp
+  802e56:	89 e5                	mov    %esp,%ebp
+  802e58:	56                   	push   %esi
+  802e59:	53                   	push   %ebx
+  802e5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e63:	85 c0                	test   %eax,%eax
+  802e65:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802e6a:	0f 44 c2             	cmove  %edx,%eax
+  802e6d:	83 ec 0c             	sub    $0xc,%esp
+  802e70:	50                   	push   %eax
+  802e71:	e8 77 e2 ff ff       	call   8010ed <sys_ipc_recv>
+  802e76:	83 c4 10             	add    $0x10,%esp
+  802e79:	85 c0                	test   %eax,%eax
+  802e7b:	78 2a                	js     802ea7 <ipc_recv+0x52>
+  802e7d:	a1 20 50 80 00       	mov    0x805020,%eax
+  802e82:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802e88:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802e8e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e94:	85 f6                	test   %esi,%esi
+  802e96:	74 02                	je     802e9a <ipc_recv+0x45>
+  802e98:	89 0e                	mov    %ecx,(%esi)
+  802e9a:	85 db                	test   %ebx,%ebx
+  802e9c:	74 02                	je     802ea0 <ipc_recv+0x4b>
+  802e9e:	89 13                	mov    %edx,(%ebx)
+  802ea0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ea3:	5b                   	pop    %ebx
+  802ea4:	5e                   	pop    %esi
+  802ea5:	5d                   	pop    %ebp
+  802ea6:	c3                   	ret
+  802ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eb1:	eb e1                	jmp    802e94 <ipc_recv+0x3f>
+
+00802eb3 <ipc_send>:
+  802eb3:	55                   	push   %ebp
+  802eb4:	89 e5                	mov    %esp,%ebp
+  802eb6:	57                   	push   %edi
+  802eb7:	56                   	push   %esi
+  802eb8:	53                   	push   %ebx
+  802eb9:	83 ec 0c             	sub    $0xc,%esp
+  802ebc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ec2:	8b 75 14             	mov    0x14(%ebp),%esi
+  802ec5:	85 db                	test   %ebx,%ebx
+  802ec7:	74 1e                	je     802ee7 <ipc_send+0x34>
+  802ec9:	56                   	push   %esi
+  802eca:	53                   	push   %ebx
+  802ecb:	57                   	push   %edi
+  802ecc:	ff 75 08             	push   0x8(%ebp)
+  802ecf:	e8 a6 e2 ff ff       	call   80117a <sys_ipc_send>
+  802ed4:	83 c4 10             	add    $0x10,%esp
+  802ed7:	85 c0                	test   %eax,%eax
+  802ed9:	74 2a                	je     802f05 <ipc_send+0x52>
+  802edb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ede:	75 13                	jne    802ef3 <ipc_send+0x40>
+  802ee0:	e8 12 df ff ff       	call   800df7 <sys_yield>
+  802ee5:	eb e2                	jmp    802ec9 <ipc_send+0x16>
+  802ee7:	be 00 00 00 00       	mov    $0x0,%esi
+  802eec:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802ef1:	eb d6                	jmp    802ec9 <ipc_send+0x16>
+  802ef3:	50                   	push   %eax
+  802ef4:	68 d8 3b 80 00       	push   $0x803bd8
+  802ef9:	6a 4f                	push   $0x4f
+  802efb:	68 1b 3c 80 00       	push   $0x803c1b
+  802f00:	e8 0a ff ff ff       	call   802e0f <_panic>
+  802f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f08:	5b                   	pop    %ebx
+  802f09:	5e                   	pop    %esi
+  802f0a:	5f                   	pop    %edi
+  802f0b:	5d                   	pop    %ebp
+  802f0c:	c3                   	ret
+
+00802f0d <ipc_call>:
+  802f0d:	55                   	push   %ebp
+  802f0e:	89 e5                	mov    %esp,%ebp
+  802f10:	57                   	push   %edi
+  802f11:	56                   	push   %esi
+  802f12:	53                   	push   %ebx
+  802f13:	83 ec 0c             	sub    $0xc,%esp
+  802f16:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f1a:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802f1f:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802f23:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f27:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802f2c:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802f30:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f39:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802f3d:	eb 05                	jmp    802f44 <ipc_call+0x37>
+  802f3f:	e8 b3 de ff ff       	call   800df7 <sys_yield>
+  802f44:	83 ec 0c             	sub    $0xc,%esp
+  802f47:	56                   	push   %esi
+  802f48:	53                   	push   %ebx
+  802f49:	57                   	push   %edi
+  802f4a:	ff 75 0c             	push   0xc(%ebp)
+  802f4d:	ff 75 08             	push   0x8(%ebp)
+  802f50:	e8 75 e2 ff ff       	call   8011ca <sys_ipc_call>
+  802f55:	83 c4 20             	add    $0x20,%esp
+  802f58:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f5b:	74 e2                	je     802f3f <ipc_call+0x32>
+  802f5d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802f60:	74 2d                	je     802f8f <ipc_call+0x82>
+  802f62:	85 c0                	test   %eax,%eax
+  802f64:	78 4f                	js     802fb5 <ipc_call+0xa8>
+  802f66:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802f6a:	74 10                	je     802f7c <ipc_call+0x6f>
+  802f6c:	a1 20 50 80 00       	mov    0x805020,%eax
+  802f71:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f77:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802f7a:	89 02                	mov    %eax,(%edx)
+  802f7c:	a1 20 50 80 00       	mov    0x805020,%eax
+  802f81:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f8a:	5b                   	pop    %ebx
+  802f8b:	5e                   	pop    %esi
+  802f8c:	5f                   	pop    %edi
+  802f8d:	5d                   	pop    %ebp
+  802f8e:	c3                   	ret
+  802f8f:	ff 75 14             	push   0x14(%ebp)
+  802f92:	ff 75 10             	push   0x10(%ebp)
+  802f95:	ff 75 0c             	push   0xc(%ebp)
+  802f98:	ff 75 08             	push   0x8(%ebp)
+  802f9b:	e8 13 ff ff ff       	call   802eb3 <ipc_send>
+  802fa0:	83 c4 0c             	add    $0xc,%esp
+  802fa3:	ff 75 1c             	push   0x1c(%ebp)
+  802fa6:	ff 75 18             	push   0x18(%ebp)
+  802fa9:	6a 00                	push   $0x0
+  802fab:	e8 a5 fe ff ff       	call   802e55 <ipc_recv>
+  802fb0:	83 c4 10             	add    $0x10,%esp
+  802fb3:	eb d2                	jmp    802f87 <ipc_call+0x7a>
+  802fb5:	50                   	push   %eax
+  802fb6:	68 25 3c 80 00       	push   $0x803c25
+  802fbb:	6a 6d                	push   $0x6d
+  802fbd:	68 1b 3c 80 00       	push   $0x803c1b
+  802fc2:	e8 48 fe ff ff       	call   802e0f <_panic>
+
+00802fc7 <ipc_reply_recv>:
+  802fc7:	55                   	push   %ebp
+  802fc8:	89 e5                	mov    %esp,%ebp
+  802fca:	57                   	push   %edi
+  802fcb:	56                   	push   %esi
+  802fcc:	53                   	push   %ebx
+  802fcd:	83 ec 0c             	sub    $0xc,%esp
+  802fd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fd3:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802fd6:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802fd9:	85 db                	test   %ebx,%ebx
+  802fdb:	0f 84 ac 00 00 00    	je     80308d <ipc_reply_recv+0xc6>
+  802fe1:	85 f6                	test   %esi,%esi
+  802fe3:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802fe8:	0f 45 c6             	cmovne %esi,%eax
+  802feb:	83 ec 0c             	sub    $0xc,%esp
+  802fee:	50                   	push   %eax
+  802fef:	ff 75 14             	push   0x14(%ebp)
+  802ff2:	53                   	push   %ebx
+  802ff3:	ff 75 0c             	push   0xc(%ebp)
+  802ff6:	ff 75 08             	push   0x8(%ebp)
+  802ff9:	e8 ed e1 ff ff       	call   8011eb <sys_ipc_reply_recv>
+  802ffe:	83 c4 20             	add    $0x20,%esp
+  803001:	85 c0                	test   %eax,%eax
+  803003:	78 3a                	js     80303f <ipc_reply_recv+0x78>
+  803005:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803009:	74 10                	je     80301b <ipc_reply_recv+0x54>
+  80300b:	a1 20 50 80 00       	mov    0x805020,%eax
+  803010:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803016:	8b 55 18             	mov    0x18(%ebp),%edx
+  803019:	89 02                	mov    %eax,(%edx)
+  80301b:	85 ff                	test   %edi,%edi
+  80301d:	74 0d                	je     80302c <ipc_reply_recv+0x65>
+  80301f:	a1 20 50 80 00       	mov    0x805020,%eax
+  803024:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80302a:	89 07                	mov    %eax,(%edi)
+  80302c:	a1 20 50 80 00       	mov    0x805020,%eax
+  803031:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803037:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80303a:	5b                   	pop    %ebx
+  80303b:	5e                   	pop    %esi
+  80303c:	5f                   	pop    %edi
+  80303d:	5d                   	pop    %ebp
+  80303e:	c3                   	ret
+  80303f:	ff 75 14             	push   0x14(%ebp)
+  803042:	53                   	push   %ebx
+  803043:	ff 75 0c             	push   0xc(%ebp)
+  803046:	ff 75 08             	push   0x8(%ebp)
+  803049:	e8 4f e0 ff ff       	call   80109d <sys_ipc_try_send>
+  80304e:	89 c2                	mov    %eax,%edx
+  803050:	c1 ea 1f             	shr    $0x1f,%edx
+  803053:	83 c4 10             	add    $0x10,%esp
+  803056:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803059:	0f 95 c1             	setne  %cl
+  80305c:	84 d1                	test   %dl,%cl
+  80305e:	74 05                	je     803065 <ipc_reply_recv+0x9e>
+  803060:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803063:	75 12                	jne    803077 <ipc_reply_recv+0xb0>
+  803065:	83 ec 04             	sub    $0x4,%esp
+  803068:	57                   	push   %edi
+  803069:	56                   	push   %esi
+  80306a:	ff 75 18             	push   0x18(%ebp)
+  80306d:	e8 e3 fd ff ff       	call   802e55 <ipc_recv>
+  803072:	83 c4 10             	add    $0x10,%esp
+  803075:	eb c0                	jmp    803037 <ipc_reply_recv+0x70>
+  803077:	83 ec 04             	sub    $0x4,%esp
+  80307a:	50                   	push   %eax
+  80307b:	ff 75 08             	push   0x8(%ebp)
+  80307e:	68 f8 3b 80 00       	push   $0x803bf8
+  803083:	e8 63 d2 ff ff       	call   8002eb <cprintf>
+  803088:	83 c4 10             	add    $0x10,%esp
+  80308b:	eb d8                	jmp    803065 <ipc_reply_recv+0x9e>
+  80308d:	85 f6                	test   %esi,%esi
+  80308f:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803094:	0f 45 c6             	cmovne %esi,%eax
+  803097:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80309c:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8030a3:	e9 43 ff ff ff       	jmp    802feb <ipc_reply_recv+0x24>
+
+008030a8 <ipc_find_env>:
+  8030a8:	55                   	push   %ebp
+  8030a9:	89 e5                	mov    %esp,%ebp
+  8030ab:	83 ec 14             	sub    $0x14,%esp
+  8030ae:	ff 75 08             	push   0x8(%ebp)
+  8030b1:	e8 85 df ff ff       	call   80103b <sys_env_service>
+  8030b6:	85 c0                	test   %eax,%eax
+  8030b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030bd:	0f 48 c2             	cmovs  %edx,%eax
+  8030c0:	c9                   	leave
+  8030c1:	c3                   	ret
+
+008030c2 <pageref>:
+  8030c2:	55                   	push   %ebp
+  8030c3:	89 e5                	mov    %esp,%ebp
+  8030c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c8:	89 c2                	mov    %eax,%edx
+  8030ca:	c1 ea 16             	shr    $0x16,%edx
+  8030cd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8030d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d9:	f6 c1 01             	test   $0x1,%cl
+  8030dc:	74 22                	je     803100 <pageref+0x3e>
+  8030de:	c1 e8 0c             	shr    $0xc,%eax
+  8030e1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030e8:	a8 01                	test   $0x1,%al
+  8030ea:	74 14                	je     803100 <pageref+0x3e>
+  8030ec:	c1 e8 0c             	shr    $0xc,%eax
+  8030ef:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8030f2:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8030f9:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8030fd:	0f b7 d2             	movzwl %dx,%edx
+  803100:	89 d0                	mov    %edx,%eax
+  803102:	5d                   	pop    %ebp
+  803103:	c3                   	ret
+
+00803104 <inet_ntoa>:
+  803104:	55                   	push   %ebp
+  803105:	89 e5                	mov    %esp,%ebp
+  803107:	57                   	push   %edi
+  803108:	56                   	push   %esi
+  803109:	53                   	push   %ebx
+  80310a:	83 ec 1c             	sub    $0x1c,%esp
+  80310d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803110:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  803113:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  803116:	bf 10 50 80 00       	mov    $0x805010,%edi
+  80311b:	0f b6 16             	movzbl (%esi),%edx
+  80311e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803123:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803126:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  803129:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  80312e:	f6 e2                	mul    %dl
+  803130:	66 c1 e8 0b          	shr    $0xb,%ax
+  803134:	89 c7                	mov    %eax,%edi
+  803136:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803139:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  80313c:	01 db                	add    %ebx,%ebx
+  80313e:	89 d0                	mov    %edx,%eax
+  803140:	29 d8                	sub    %ebx,%eax
+  803142:	89 d6                	mov    %edx,%esi
+  803144:	89 fa                	mov    %edi,%edx
+  803146:	89 cb                	mov    %ecx,%ebx
+  803148:	83 c1 01             	add    $0x1,%ecx
+  80314b:	0f b6 fb             	movzbl %bl,%edi
+  80314e:	83 c0 30             	add    $0x30,%eax
+  803151:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+  803155:	89 f0                	mov    %esi,%eax
+  803157:	3c 09                	cmp    $0x9,%al
+  803159:	77 ce                	ja     803129 <inet_ntoa+0x25>
+  80315b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80315e:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803161:	88 16                	mov    %dl,(%esi)
+  803163:	84 c9                	test   %cl,%cl
+  803165:	74 4d                	je     8031b4 <inet_ntoa+0xb0>
+  803167:	0f b6 db             	movzbl %bl,%ebx
+  80316a:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  80316d:	01 d8                	add    %ebx,%eax
+  80316f:	89 f9                	mov    %edi,%ecx
+  803171:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803174:	83 c1 01             	add    $0x1,%ecx
+  803177:	0f b6 10             	movzbl (%eax),%edx
+  80317a:	88 51 ff             	mov    %dl,-0x1(%ecx)
+  80317d:	89 c2                	mov    %eax,%edx
+  80317f:	83 e8 01             	sub    $0x1,%eax
+  803182:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803185:	39 da                	cmp    %ebx,%edx
+  803187:	75 eb                	jne    803174 <inet_ntoa+0x70>
+  803189:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80318c:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  803190:	8d 78 01             	lea    0x1(%eax),%edi
+  803193:	c6 00 2e             	movb   $0x2e,(%eax)
+  803196:	83 c6 01             	add    $0x1,%esi
+  803199:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  80319c:	39 ce                	cmp    %ecx,%esi
+  80319e:	0f 85 77 ff ff ff    	jne    80311b <inet_ntoa+0x17>
+  8031a4:	c6 00 00             	movb   $0x0,(%eax)
+  8031a7:	b8 10 50 80 00       	mov    $0x805010,%eax
+  8031ac:	83 c4 1c             	add    $0x1c,%esp
+  8031af:	5b                   	pop    %ebx
+  8031b0:	5e                   	pop    %esi
+  8031b1:	5f                   	pop    %edi
+  8031b2:	5d                   	pop    %ebp
+  8031b3:	c3                   	ret
+  8031b4:	89 f8                	mov    %edi,%eax
+  8031b6:	eb d8                	jmp    803190 <inet_ntoa+0x8c>
+
+008031b8 <htons>:
+  8031b8:	55                   	push   %ebp
+  8031b9:	89 e5                	mov    %esp,%ebp
+  8031bb:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8031bf:	66 c1 c0 08          	rol    $0x8,%ax
+  8031c3:	5d                   	pop    %ebp
+  8031c4:	c3                   	ret
+
+008031c5 <ntohs>:
+  8031c5:	55                   	push   %ebp
+  8031c6:	89 e5                	mov    %esp,%ebp
+  8031c8:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8031cc:	66 c1 c0 08          	rol    $0x8,%ax
+  8031d0:	5d                   	pop    %ebp
+  8031d1:	c3                   	ret
+
+008031d2 <htonl>:
+  8031d2:	55                   	push   %ebp
+  8031d3:	89 e5                	mov    %esp,%ebp
+  8031d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031d8:	89 d0                	mov    %edx,%eax
+  8031da:	c1 e0 18             	shl    $0x18,%eax
+  8031dd:	89 d1                	mov    %edx,%ecx
+  8031df:	c1 e9 18             	shr    $0x18,%ecx
+  8031e2:	09 c8                	or     %ecx,%eax
+  8031e4:	89 d1                	mov    %edx,%ecx
+  8031e6:	c1 e1 08             	shl    $0x8,%ecx
+  8031e9:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+  8031ef:	09 c8                	or     %ecx,%eax
+  8031f1:	c1 ea 08             	shr    $0x8,%edx
+  8031f4:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8031fa:	09 d0                	or     %edx,%eax
+  8031fc:	5d                   	pop    %ebp
+  8031fd:	c3                   	ret
+
+008031fe <inet_aton>:
+  8031fe:	55                   	push   %ebp
+  8031ff:	89 e5                	mov    %esp,%ebp
+  803201:	57                   	push   %edi
+  803202:	56                   	push   %esi
+  803203:	53                   	push   %ebx
+  803204:	83 ec 2c             	sub    $0x2c,%esp
+  803207:	8b 55 08             	mov    0x8(%ebp),%edx
+  80320a:	0f b6 0a             	movzbl (%edx),%ecx
+  80320d:	0f be c1             	movsbl %cl,%eax
+  803210:	83 e9 30             	sub    $0x30,%ecx
+  803213:	80 f9 09             	cmp    $0x9,%cl
+  803216:	0f 87 b6 01 00 00    	ja     8033d2 <inet_aton+0x1d4>
+  80321c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80321f:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803222:	e9 aa 00 00 00       	jmp    8032d1 <inet_aton+0xd3>
+  803227:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  80322b:	89 c1                	mov    %eax,%ecx
+  80322d:	83 e1 df             	and    $0xffffffdf,%ecx
+  803230:	80 f9 58             	cmp    $0x58,%cl
+  803233:	74 10                	je     803245 <inet_aton+0x47>
+  803235:	83 c2 01             	add    $0x1,%edx
+  803238:	0f be c0             	movsbl %al,%eax
+  80323b:	bf 08 00 00 00       	mov    $0x8,%edi
+  803240:	e9 9a 00 00 00       	jmp    8032df <inet_aton+0xe1>
+  803245:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803249:	8d 52 02             	lea    0x2(%edx),%edx
+  80324c:	bf 10 00 00 00       	mov    $0x10,%edi
+  803251:	e9 89 00 00 00       	jmp    8032df <inet_aton+0xe1>
+  803256:	0f af d7             	imul   %edi,%edx
+  803259:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  80325d:	0f be 01             	movsbl (%ecx),%eax
+  803260:	83 c1 01             	add    $0x1,%ecx
+  803263:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803266:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803269:	80 fb 09             	cmp    $0x9,%bl
+  80326c:	76 e8                	jbe    803256 <inet_aton+0x58>
+  80326e:	83 ff 10             	cmp    $0x10,%edi
+  803271:	75 2e                	jne    8032a1 <inet_aton+0xa3>
+  803273:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803277:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80327a:	83 e3 df             	and    $0xffffffdf,%ebx
+  80327d:	83 eb 41             	sub    $0x41,%ebx
+  803280:	80 fb 05             	cmp    $0x5,%bl
+  803283:	77 1c                	ja     8032a1 <inet_aton+0xa3>
+  803285:	c1 e2 04             	shl    $0x4,%edx
+  803288:	83 c0 0a             	add    $0xa,%eax
+  80328b:	89 f3                	mov    %esi,%ebx
+  80328d:	80 fb 1a             	cmp    $0x1a,%bl
+  803290:	19 db                	sbb    %ebx,%ebx
+  803292:	83 e3 20             	and    $0x20,%ebx
+  803295:	83 c3 41             	add    $0x41,%ebx
+  803298:	29 d8                	sub    %ebx,%eax
+  80329a:	09 c2                	or     %eax,%edx
+  80329c:	0f be 01             	movsbl (%ecx),%eax
+  80329f:	eb bf                	jmp    803260 <inet_aton+0x62>
+  8032a1:	83 f8 2e             	cmp    $0x2e,%eax
+  8032a4:	75 46                	jne    8032ec <inet_aton+0xee>
+  8032a6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8032a9:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8032ac:	39 f0                	cmp    %esi,%eax
+  8032ae:	0f 84 25 01 00 00    	je     8033d9 <inet_aton+0x1db>
+  8032b4:	83 c0 04             	add    $0x4,%eax
+  8032b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8032ba:	89 50 fc             	mov    %edx,-0x4(%eax)
+  8032bd:	89 ca                	mov    %ecx,%edx
+  8032bf:	0f b6 09             	movzbl (%ecx),%ecx
+  8032c2:	0f be c1             	movsbl %cl,%eax
+  8032c5:	83 e9 30             	sub    $0x30,%ecx
+  8032c8:	80 f9 09             	cmp    $0x9,%cl
+  8032cb:	0f 87 17 01 00 00    	ja     8033e8 <inet_aton+0x1ea>
+  8032d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8032d6:	83 f8 30             	cmp    $0x30,%eax
+  8032d9:	0f 84 48 ff ff ff    	je     803227 <inet_aton+0x29>
+  8032df:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8032e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e7:	e9 77 ff ff ff       	jmp    803263 <inet_aton+0x65>
+  8032ec:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8032f0:	89 d6                	mov    %edx,%esi
+  8032f2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	74 2e                	je     803327 <inet_aton+0x129>
+  8032f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032fe:	89 fa                	mov    %edi,%edx
+  803300:	80 fa 1f             	cmp    $0x1f,%dl
+  803303:	0f 86 d5 00 00 00    	jbe    8033de <inet_aton+0x1e0>
+  803309:	84 c0                	test   %al,%al
+  80330b:	0f 88 cd 00 00 00    	js     8033de <inet_aton+0x1e0>
+  803311:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803314:	83 f9 04             	cmp    $0x4,%ecx
+  803317:	76 0e                	jbe    803327 <inet_aton+0x129>
+  803319:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80331e:	83 f8 20             	cmp    $0x20,%eax
+  803321:	0f 85 b7 00 00 00    	jne    8033de <inet_aton+0x1e0>
+  803327:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  80332a:	89 d8                	mov    %ebx,%eax
+  80332c:	29 c8                	sub    %ecx,%eax
+  80332e:	c1 f8 02             	sar    $0x2,%eax
+  803331:	8d 48 01             	lea    0x1(%eax),%ecx
+  803334:	83 f8 02             	cmp    $0x2,%eax
+  803337:	74 7a                	je     8033b3 <inet_aton+0x1b5>
+  803339:	83 f9 03             	cmp    $0x3,%ecx
+  80333c:	7f 49                	jg     803387 <inet_aton+0x189>
+  80333e:	85 c9                	test   %ecx,%ecx
+  803340:	0f 84 98 00 00 00    	je     8033de <inet_aton+0x1e0>
+  803346:	83 f9 02             	cmp    $0x2,%ecx
+  803349:	75 19                	jne    803364 <inet_aton+0x166>
+  80334b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803350:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803356:	0f 87 82 00 00 00    	ja     8033de <inet_aton+0x1e0>
+  80335c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80335f:	c1 e0 18             	shl    $0x18,%eax
+  803362:	09 c6                	or     %eax,%esi
+  803364:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803369:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80336d:	74 6f                	je     8033de <inet_aton+0x1e0>
+  80336f:	83 ec 0c             	sub    $0xc,%esp
+  803372:	56                   	push   %esi
+  803373:	e8 5a fe ff ff       	call   8031d2 <htonl>
+  803378:	83 c4 10             	add    $0x10,%esp
+  80337b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80337e:	89 06                	mov    %eax,(%esi)
+  803380:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803385:	eb 57                	jmp    8033de <inet_aton+0x1e0>
+  803387:	83 f9 04             	cmp    $0x4,%ecx
+  80338a:	75 d8                	jne    803364 <inet_aton+0x166>
+  80338c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803391:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803397:	77 45                	ja     8033de <inet_aton+0x1e0>
+  803399:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80339c:	c1 e0 18             	shl    $0x18,%eax
+  80339f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8033a2:	c1 e1 10             	shl    $0x10,%ecx
+  8033a5:	09 c8                	or     %ecx,%eax
+  8033a7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8033aa:	c1 e1 08             	shl    $0x8,%ecx
+  8033ad:	09 c8                	or     %ecx,%eax
+  8033af:	09 c6                	or     %eax,%esi
+  8033b1:	eb b1                	jmp    803364 <inet_aton+0x166>
+  8033b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033b8:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8033be:	77 1e                	ja     8033de <inet_aton+0x1e0>
+  8033c0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8033c3:	c1 e0 18             	shl    $0x18,%eax
+  8033c6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8033c9:	c1 e1 10             	shl    $0x10,%ecx
+  8033cc:	09 c8                	or     %ecx,%eax
+  8033ce:	09 c6                	or     %eax,%esi
+  8033d0:	eb 92                	jmp    803364 <inet_aton+0x166>
+  8033d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033d7:	eb 05                	jmp    8033de <inet_aton+0x1e0>
+  8033d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033de:	89 c8                	mov    %ecx,%eax
+  8033e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e3:	5b                   	pop    %ebx
+  8033e4:	5e                   	pop    %esi
+  8033e5:	5f                   	pop    %edi
+  8033e6:	5d                   	pop    %ebp
+  8033e7:	c3                   	ret
+  8033e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033ed:	eb ef                	jmp    8033de <inet_aton+0x1e0>
+
+008033ef <inet_addr>:
+  8033ef:	55                   	push   %ebp
+  8033f0:	89 e5                	mov    %esp,%ebp
+  8033f2:	83 ec 20             	sub    $0x20,%esp
+  8033f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033f8:	50                   	push   %eax
+  8033f9:	ff 75 08             	push   0x8(%ebp)
+  8033fc:	e8 fd fd ff ff       	call   8031fe <inet_aton>
+  803401:	89 c2                	mov    %eax,%edx
+  803403:	83 c4 10             	add    $0x10,%esp
+  803406:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80340b:	85 d2                	test   %edx,%edx
+  80340d:	75 02                	jne    803411 <inet_addr+0x22>
+  80340f:	c9                   	leave
+  803410:	c3                   	ret
+  803411:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803414:	eb f9                	jmp    80340f <inet_addr+0x20>
+
+00803416 <ntohl>:
+  803416:	55                   	push   %ebp
+  803417:	89 e5                	mov    %esp,%ebp
+  803419:	83 ec 14             	sub    $0x14,%esp
+  80341c:	ff 75 08             	push   0x8(%ebp)
+  80341f:	e8 ae fd ff ff       	call   8031d2 <htonl>
+  803424:	83 c4 10             	add    $0x10,%esp
+  803427:	c9                   	leave
+  803428:	c3                   	ret
+
+00803429 <__udivmoddi4>:
+  803429:	55                   	push   %ebp
+  80342a:	57                   	push   %edi
+  80342b:	56                   	push   %esi
+  80342c:	53                   	push   %ebx
+  80342d:	83 ec 24             	sub    $0x24,%esp
+  803430:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803434:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803438:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80343c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803440:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803444:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803448:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80344c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803450:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803454:	b8 00 00 00 00       	mov    $0x0,%eax
+  803459:	ba 00 00 00 00       	mov    $0x0,%edx
+  80345e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803463:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80346a:	00 
+  80346b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803472:	00 
+  803473:	89 fb                	mov    %edi,%ebx
+  803475:	eb 08                	jmp    80347f <__udivmoddi4+0x56>
+  803477:	83 e9 01             	sub    $0x1,%ecx
+  80347a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80347d:	74 68                	je     8034e7 <__udivmoddi4+0xbe>
+  80347f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803483:	01 c0                	add    %eax,%eax
+  803485:	89 c6                	mov    %eax,%esi
+  803487:	89 d7                	mov    %edx,%edi
+  803489:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80348d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803491:	0f ad d0             	shrd   %cl,%edx,%eax
+  803494:	d3 ea                	shr    %cl,%edx
+  803496:	f6 c1 20             	test   $0x20,%cl
+  803499:	74 04                	je     80349f <__udivmoddi4+0x76>
+  80349b:	89 d0                	mov    %edx,%eax
+  80349d:	31 d2                	xor    %edx,%edx
+  80349f:	83 e0 01             	and    $0x1,%eax
+  8034a2:	89 04 24             	mov    %eax,(%esp)
+  8034a5:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8034ac:	00 
+  8034ad:	8b 04 24             	mov    (%esp),%eax
+  8034b0:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8034b4:	09 f0                	or     %esi,%eax
+  8034b6:	09 fa                	or     %edi,%edx
+  8034b8:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8034bc:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8034c0:	39 f0                	cmp    %esi,%eax
+  8034c2:	89 d5                	mov    %edx,%ebp
+  8034c4:	19 fd                	sbb    %edi,%ebp
+  8034c6:	72 af                	jb     803477 <__udivmoddi4+0x4e>
+  8034c8:	29 f0                	sub    %esi,%eax
+  8034ca:	19 fa                	sbb    %edi,%edx
+  8034cc:	89 cf                	mov    %ecx,%edi
+  8034ce:	c1 ef 05             	shr    $0x5,%edi
+  8034d1:	83 e7 01             	and    $0x1,%edi
+  8034d4:	89 fe                	mov    %edi,%esi
+  8034d6:	83 f6 01             	xor    $0x1,%esi
+  8034d9:	d3 e6                	shl    %cl,%esi
+  8034db:	d3 e7                	shl    %cl,%edi
+  8034dd:	09 74 24 18          	or     %esi,0x18(%esp)
+  8034e1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8034e5:	eb 90                	jmp    803477 <__udivmoddi4+0x4e>
+  8034e7:	85 db                	test   %ebx,%ebx
+  8034e9:	74 05                	je     8034f0 <__udivmoddi4+0xc7>
+  8034eb:	89 03                	mov    %eax,(%ebx)
+  8034ed:	89 53 04             	mov    %edx,0x4(%ebx)
+  8034f0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8034f4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8034f8:	83 c4 24             	add    $0x24,%esp
+  8034fb:	5b                   	pop    %ebx
+  8034fc:	5e                   	pop    %esi
+  8034fd:	5f                   	pop    %edi
+  8034fe:	5d                   	pop    %ebp
+  8034ff:	c3                   	ret
+
+00803500 <__udivdi3>:
+  803500:	83 ec 08             	sub    $0x8,%esp
+  803503:	6a 00                	push   $0x0
+  803505:	ff 74 24 1c          	push   0x1c(%esp)
+  803509:	ff 74 24 1c          	push   0x1c(%esp)
+  80350d:	ff 74 24 1c          	push   0x1c(%esp)
+  803511:	ff 74 24 1c          	push   0x1c(%esp)
+  803515:	e8 0f ff ff ff       	call   803429 <__udivmoddi4>
+  80351a:	83 c4 1c             	add    $0x1c,%esp
+  80351d:	c3                   	ret
+
+0080351e <__umoddi3>:
+  80351e:	83 ec 18             	sub    $0x18,%esp
+  803521:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803525:	50                   	push   %eax
+  803526:	ff 74 24 2c          	push   0x2c(%esp)
+  80352a:	ff 74 24 2c          	push   0x2c(%esp)
+  80352e:	ff 74 24 2c          	push   0x2c(%esp)
+  803532:	ff 74 24 2c          	push   0x2c(%esp)
+  803536:	e8 ee fe ff ff       	call   803429 <__udivmoddi4>
+  80353b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80353f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803543:	83 c4 2c             	add    $0x2c,%esp
+  803546:	c3                   	ret
+
+00803547 <__divdi3>:
+  803547:	53                   	push   %ebx
+  803548:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80354c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803550:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803554:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803558:	85 d2                	test   %edx,%edx
+  80355a:	78 12                	js     80356e <__divdi3+0x27>
+  80355c:	85 db                	test   %ebx,%ebx
+  80355e:	78 2e                	js     80358e <__divdi3+0x47>
+  803560:	53                   	push   %ebx
+  803561:	51                   	push   %ecx
+  803562:	52                   	push   %edx
+  803563:	50                   	push   %eax
+  803564:	e8 97 ff ff ff       	call   803500 <__udivdi3>
+  803569:	83 c4 10             	add    $0x10,%esp
+  80356c:	eb 1e                	jmp    80358c <__divdi3+0x45>
+  80356e:	f7 d8                	neg    %eax
+  803570:	83 d2 00             	adc    $0x0,%edx
+  803573:	f7 da                	neg    %edx
+  803575:	85 db                	test   %ebx,%ebx
+  803577:	78 2a                	js     8035a3 <__divdi3+0x5c>
+  803579:	53                   	push   %ebx
+  80357a:	51                   	push   %ecx
+  80357b:	52                   	push   %edx
+  80357c:	50                   	push   %eax
+  80357d:	e8 7e ff ff ff       	call   803500 <__udivdi3>
+  803582:	83 c4 10             	add    $0x10,%esp
+  803585:	f7 d8                	neg    %eax
+  803587:	83 d2 00             	adc    $0x0,%edx
+  80358a:	f7 da                	neg    %edx
+  80358c:	5b                   	pop    %ebx
+  80358d:	c3                   	ret
+  80358e:	f7 d9                	neg    %ecx
+  803590:	83 d3 00             	adc    $0x0,%ebx
+  803593:	f7 db                	neg    %ebx
+  803595:	53                   	push   %ebx
+  803596:	51                   	push   %ecx
+  803597:	52                   	push   %edx
+  803598:	50                   	push   %eax
+  803599:	e8 62 ff ff ff       	call   803500 <__udivdi3>
+  80359e:	83 c4 10             	add    $0x10,%esp
+  8035a1:	eb e2                	jmp    803585 <__divdi3+0x3e>
+  8035a3:	f7 d9                	neg    %ecx
+  8035a5:	83 d3 00             	adc    $0x0,%ebx
+  8035a8:	f7 db                	neg    %ebx
+  8035aa:	53                   	push   %ebx
+  8035ab:	51                   	push   %ecx
+  8035ac:	52                   	push   %edx
+  8035ad:	50                   	push   %eax
+  8035ae:	e8 4d ff ff ff       	call   803500 <__udivdi3>
+  8035b3:	83 c4 10             	add    $0x10,%esp
+  8035b6:	eb d4                	jmp    80358c <__divdi3+0x45>
+
+008035b8 <__moddi3>:
+  8035b8:	55                   	push   %ebp
+  8035b9:	57                   	push   %edi
+  8035ba:	56                   	push   %esi
+  8035bb:	53                   	push   %ebx
+  8035bc:	83 ec 0c             	sub    $0xc,%esp
+  8035bf:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8035c3:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8035c7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8035cb:	89 e9                	mov    %ebp,%ecx
+  8035cd:	f7 d9                	neg    %ecx
+  8035cf:	89 d0                	mov    %edx,%eax
+  8035d1:	83 d0 00             	adc    $0x0,%eax
+  8035d4:	f7 d8                	neg    %eax
+  8035d6:	0f 49 e9             	cmovns %ecx,%ebp
+  8035d9:	0f 49 d0             	cmovns %eax,%edx
+  8035dc:	52                   	push   %edx
+  8035dd:	55                   	push   %ebp
+  8035de:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8035e2:	f7 da                	neg    %edx
+  8035e4:	89 d8                	mov    %ebx,%eax
+  8035e6:	83 d0 00             	adc    $0x0,%eax
+  8035e9:	f7 d8                	neg    %eax
+  8035eb:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8035f0:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8035f4:	0f 48 c3             	cmovs  %ebx,%eax
+  8035f7:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8035fb:	ff 74 24 0c          	push   0xc(%esp)
+  8035ff:	ff 74 24 0c          	push   0xc(%esp)
+  803603:	e8 16 ff ff ff       	call   80351e <__umoddi3>
+  803608:	83 c4 10             	add    $0x10,%esp
+  80360b:	85 db                	test   %ebx,%ebx
+  80360d:	78 08                	js     803617 <__moddi3+0x5f>
+  80360f:	83 c4 0c             	add    $0xc,%esp
+  803612:	5b                   	pop    %ebx
+  803613:	5e                   	pop    %esi
+  803614:	5f                   	pop    %edi
+  803615:	5d                   	pop    %ebp
+  803616:	c3                   	ret
+  803617:	f7 d8                	neg    %eax
+  803619:	83 d2 00             	adc    $0x0,%edx
+  80361c:	f7 da                	neg    %edx
+  80361e:	eb ef                	jmp    80360f <__moddi3+0x57>
@@ -0,0 +1,5040 @@
+
+obj/user/evilhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	6a 64                	push   $0x64
+  80003b:	68 0c 00 10 f0       	push   $0xf010000c
+  800040:	e8 7e 00 00 00       	call   8000c3 <sys_cputs>
+  800045:	83 c4 10             	add    $0x10,%esp
+  800048:	c9                   	leave
+  800049:	c3                   	ret
+
+0080004a <libmain>:
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800055:	e8 e7 00 00 00       	call   800141 <sys_getenvid>
+  80005a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005f:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800065:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006a:	a3 10 50 80 00       	mov    %eax,0x805010
+  80006f:	85 db                	test   %ebx,%ebx
+  800071:	7e 07                	jle    80007a <libmain+0x30>
+  800073:	8b 06                	mov    (%esi),%eax
+  800075:	a3 00 40 80 00       	mov    %eax,0x804000
+  80007a:	83 ec 08             	sub    $0x8,%esp
+  80007d:	56                   	push   %esi
+  80007e:	53                   	push   %ebx
+  80007f:	e8 af ff ff ff       	call   800033 <umain>
+  800084:	e8 0a 00 00 00       	call   800093 <exit>
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008f:	5b                   	pop    %ebx
+  800090:	5e                   	pop    %esi
+  800091:	5d                   	pop    %ebp
+  800092:	c3                   	ret
+
+00800093 <exit>:
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 08             	sub    $0x8,%esp
+  800099:	a1 10 50 80 00       	mov    0x805010,%eax
+  80009e:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000a4:	85 c0                	test   %eax,%eax
+  8000a6:	75 14                	jne    8000bc <exit+0x29>
+  8000a8:	e8 36 0b 00 00       	call   800be3 <close_all>
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	6a 00                	push   $0x0
+  8000b2:	e8 49 00 00 00       	call   800100 <sys_env_destroy>
+  8000b7:	83 c4 10             	add    $0x10,%esp
+  8000ba:	c9                   	leave
+  8000bb:	c3                   	ret
+  8000bc:	e8 ac 07 00 00       	call   80086d <sys_lease_complete>
+  8000c1:	eb e5                	jmp    8000a8 <exit+0x15>
+
+008000c3 <sys_cputs>:
+  8000c3:	55                   	push   %ebp
+  8000c4:	89 e5                	mov    %esp,%ebp
+  8000c6:	57                   	push   %edi
+  8000c7:	56                   	push   %esi
+  8000c8:	53                   	push   %ebx
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d4:	89 c3                	mov    %eax,%ebx
+  8000d6:	89 c7                	mov    %eax,%edi
+  8000d8:	89 c6                	mov    %eax,%esi
+  8000da:	cd 30                	int    $0x30
+  8000dc:	5b                   	pop    %ebx
+  8000dd:	5e                   	pop    %esi
+  8000de:	5f                   	pop    %edi
+  8000df:	5d                   	pop    %ebp
+  8000e0:	c3                   	ret
+
+008000e1 <sys_cgetc>:
+  8000e1:	55                   	push   %ebp
+  8000e2:	89 e5                	mov    %esp,%ebp
+  8000e4:	57                   	push   %edi
+  8000e5:	56                   	push   %esi
+  8000e6:	53                   	push   %ebx
+  8000e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000f1:	89 d1                	mov    %edx,%ecx
+  8000f3:	89 d3                	mov    %edx,%ebx
+  8000f5:	89 d7                	mov    %edx,%edi
+  8000f7:	89 d6                	mov    %edx,%esi
+  8000f9:	cd 30                	int    $0x30
+  8000fb:	5b                   	pop    %ebx
+  8000fc:	5e                   	pop    %esi
+  8000fd:	5f                   	pop    %edi
+  8000fe:	5d                   	pop    %ebp
+  8000ff:	c3                   	ret
+
+00800100 <sys_env_destroy>:
+  800100:	55                   	push   %ebp
+  800101:	89 e5                	mov    %esp,%ebp
+  800103:	57                   	push   %edi
+  800104:	56                   	push   %esi
+  800105:	53                   	push   %ebx
+  800106:	83 ec 0c             	sub    $0xc,%esp
+  800109:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800111:	b8 03 00 00 00       	mov    $0x3,%eax
+  800116:	89 cb                	mov    %ecx,%ebx
+  800118:	89 cf                	mov    %ecx,%edi
+  80011a:	89 ce                	mov    %ecx,%esi
+  80011c:	cd 30                	int    $0x30
+  80011e:	85 c0                	test   %eax,%eax
+  800120:	7f 08                	jg     80012a <sys_env_destroy+0x2a>
+  800122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800125:	5b                   	pop    %ebx
+  800126:	5e                   	pop    %esi
+  800127:	5f                   	pop    %edi
+  800128:	5d                   	pop    %ebp
+  800129:	c3                   	ret
+  80012a:	83 ec 0c             	sub    $0xc,%esp
+  80012d:	50                   	push   %eax
+  80012e:	6a 03                	push   $0x3
+  800130:	68 8a 31 80 00       	push   $0x80318a
+  800135:	6a 24                	push   $0x24
+  800137:	68 a7 31 80 00       	push   $0x8031a7
+  80013c:	e8 37 20 00 00       	call   802178 <_panic>
+
+00800141 <sys_getenvid>:
+  800141:	55                   	push   %ebp
+  800142:	89 e5                	mov    %esp,%ebp
+  800144:	57                   	push   %edi
+  800145:	56                   	push   %esi
+  800146:	53                   	push   %ebx
+  800147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800151:	89 d1                	mov    %edx,%ecx
+  800153:	89 d3                	mov    %edx,%ebx
+  800155:	89 d7                	mov    %edx,%edi
+  800157:	89 d6                	mov    %edx,%esi
+  800159:	cd 30                	int    $0x30
+  80015b:	5b                   	pop    %ebx
+  80015c:	5e                   	pop    %esi
+  80015d:	5f                   	pop    %edi
+  80015e:	5d                   	pop    %ebp
+  80015f:	c3                   	ret
+
+00800160 <sys_yield>:
+  800160:	55                   	push   %ebp
+  800161:	89 e5                	mov    %esp,%ebp
+  800163:	57                   	push   %edi
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  800166:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80016d:	74 26                	je     800195 <sys_yield+0x35>
+  80016f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800174:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800179:	89 d1                	mov    %edx,%ecx
+  80017b:	89 d3                	mov    %edx,%ebx
+  80017d:	89 d7                	mov    %edx,%edi
+  80017f:	6a 00                	push   $0x0
+  800181:	55                   	push   %ebp
+  800182:	89 e5                	mov    %esp,%ebp
+  800184:	8d 35 8c 01 80 00    	lea    0x80018c,%esi
+  80018a:	0f 34                	sysenter
+  80018c:	5d                   	pop    %ebp
+  80018d:	83 c4 04             	add    $0x4,%esp
+  800190:	5b                   	pop    %ebx
+  800191:	5e                   	pop    %esi
+  800192:	5f                   	pop    %edi
+  800193:	5d                   	pop    %ebp
+  800194:	c3                   	ret
+  800195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80019f:	89 d1                	mov    %edx,%ecx
+  8001a1:	89 d3                	mov    %edx,%ebx
+  8001a3:	89 d7                	mov    %edx,%edi
+  8001a5:	89 d6                	mov    %edx,%esi
+  8001a7:	cd 30                	int    $0x30
+  8001a9:	eb e5                	jmp    800190 <sys_yield+0x30>
+
+008001ab <sys_page_alloc>:
+  8001ab:	55                   	push   %ebp
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	57                   	push   %edi
+  8001af:	56                   	push   %esi
+  8001b0:	53                   	push   %ebx
+  8001b1:	83 ec 0c             	sub    $0xc,%esp
+  8001b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001bf:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c7:	89 f7                	mov    %esi,%edi
+  8001c9:	cd 30                	int    $0x30
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	7f 08                	jg     8001d7 <sys_page_alloc+0x2c>
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+  8001d7:	83 ec 0c             	sub    $0xc,%esp
+  8001da:	50                   	push   %eax
+  8001db:	6a 04                	push   $0x4
+  8001dd:	68 8a 31 80 00       	push   $0x80318a
+  8001e2:	6a 24                	push   $0x24
+  8001e4:	68 a7 31 80 00       	push   $0x8031a7
+  8001e9:	e8 8a 1f 00 00       	call   802178 <_panic>
+
+008001ee <sys_page_map>:
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	57                   	push   %edi
+  8001f2:	56                   	push   %esi
+  8001f3:	53                   	push   %ebx
+  8001f4:	83 ec 0c             	sub    $0xc,%esp
+  8001f7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8001fe:	74 33                	je     800233 <sys_page_map+0x45>
+  800200:	8b 55 08             	mov    0x8(%ebp),%edx
+  800203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800206:	b8 05 00 00 00       	mov    $0x5,%eax
+  80020b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80020e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800211:	ff 75 18             	push   0x18(%ebp)
+  800214:	55                   	push   %ebp
+  800215:	89 e5                	mov    %esp,%ebp
+  800217:	8d 35 1f 02 80 00    	lea    0x80021f,%esi
+  80021d:	0f 34                	sysenter
+  80021f:	5d                   	pop    %ebp
+  800220:	83 c4 04             	add    $0x4,%esp
+  800223:	89 c2                	mov    %eax,%edx
+  800225:	85 c0                	test   %eax,%eax
+  800227:	7f 3d                	jg     800266 <sys_page_map+0x78>
+  800229:	89 d0                	mov    %edx,%eax
+  80022b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80022e:	5b                   	pop    %ebx
+  80022f:	5e                   	pop    %esi
+  800230:	5f                   	pop    %edi
+  800231:	5d                   	pop    %ebp
+  800232:	c3                   	ret
+  800233:	b8 05 00 00 00       	mov    $0x5,%eax
+  800238:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800241:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800244:	8b 75 18             	mov    0x18(%ebp),%esi
+  800247:	cd 30                	int    $0x30
+  800249:	89 c2                	mov    %eax,%edx
+  80024b:	85 c0                	test   %eax,%eax
+  80024d:	7e da                	jle    800229 <sys_page_map+0x3b>
+  80024f:	83 ec 0c             	sub    $0xc,%esp
+  800252:	50                   	push   %eax
+  800253:	6a 05                	push   $0x5
+  800255:	68 8a 31 80 00       	push   $0x80318a
+  80025a:	6a 24                	push   $0x24
+  80025c:	68 a7 31 80 00       	push   $0x8031a7
+  800261:	e8 12 1f 00 00       	call   802178 <_panic>
+  800266:	83 ec 0c             	sub    $0xc,%esp
+  800269:	50                   	push   %eax
+  80026a:	6a 05                	push   $0x5
+  80026c:	68 8a 31 80 00       	push   $0x80318a
+  800271:	6a 48                	push   $0x48
+  800273:	68 a7 31 80 00       	push   $0x8031a7
+  800278:	e8 fb 1e 00 00       	call   802178 <_panic>
+
+0080027d <sys_page_unmap>:
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	57                   	push   %edi
+  800281:	56                   	push   %esi
+  800282:	53                   	push   %ebx
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80028b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800291:	b8 06 00 00 00       	mov    $0x6,%eax
+  800296:	89 df                	mov    %ebx,%edi
+  800298:	89 de                	mov    %ebx,%esi
+  80029a:	cd 30                	int    $0x30
+  80029c:	85 c0                	test   %eax,%eax
+  80029e:	7f 08                	jg     8002a8 <sys_page_unmap+0x2b>
+  8002a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a3:	5b                   	pop    %ebx
+  8002a4:	5e                   	pop    %esi
+  8002a5:	5f                   	pop    %edi
+  8002a6:	5d                   	pop    %ebp
+  8002a7:	c3                   	ret
+  8002a8:	83 ec 0c             	sub    $0xc,%esp
+  8002ab:	50                   	push   %eax
+  8002ac:	6a 06                	push   $0x6
+  8002ae:	68 8a 31 80 00       	push   $0x80318a
+  8002b3:	6a 24                	push   $0x24
+  8002b5:	68 a7 31 80 00       	push   $0x8031a7
+  8002ba:	e8 b9 1e 00 00       	call   802178 <_panic>
+
+008002bf <sys_fork>:
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	57                   	push   %edi
+  8002c3:	56                   	push   %esi
+  8002c4:	53                   	push   %ebx
+  8002c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ca:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002cf:	89 d1                	mov    %edx,%ecx
+  8002d1:	89 d3                	mov    %edx,%ebx
+  8002d3:	89 d7                	mov    %edx,%edi
+  8002d5:	89 d6                	mov    %edx,%esi
+  8002d7:	cd 30                	int    $0x30
+  8002d9:	5b                   	pop    %ebx
+  8002da:	5e                   	pop    %esi
+  8002db:	5f                   	pop    %edi
+  8002dc:	5d                   	pop    %ebp
+  8002dd:	c3                   	ret
+
+008002de <sys_env_set_status>:
+  8002de:	55                   	push   %ebp
+  8002df:	89 e5                	mov    %esp,%ebp
+  8002e1:	57                   	push   %edi
+  8002e2:	56                   	push   %esi
+  8002e3:	53                   	push   %ebx
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002f7:	89 df                	mov    %ebx,%edi
+  8002f9:	89 de                	mov    %ebx,%esi
+  8002fb:	cd 30                	int    $0x30
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	7f 08                	jg     800309 <sys_env_set_status+0x2b>
+  800301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800304:	5b                   	pop    %ebx
+  800305:	5e                   	pop    %esi
+  800306:	5f                   	pop    %edi
+  800307:	5d                   	pop    %ebp
+  800308:	c3                   	ret
+  800309:	83 ec 0c             	sub    $0xc,%esp
+  80030c:	50                   	push   %eax
+  80030d:	6a 08                	push   $0x8
+  80030f:	68 8a 31 80 00       	push   $0x80318a
+  800314:	6a 24                	push   $0x24
+  800316:	68 a7 31 80 00       	push   $0x8031a7
+  80031b:	e8 58 1e 00 00       	call   802178 <_panic>
+
+00800320 <sys_env_set_trapframe>:
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	57                   	push   %edi
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80032e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800331:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800334:	b8 09 00 00 00       	mov    $0x9,%eax
+  800339:	89 df                	mov    %ebx,%edi
+  80033b:	89 de                	mov    %ebx,%esi
+  80033d:	cd 30                	int    $0x30
+  80033f:	85 c0                	test   %eax,%eax
+  800341:	7f 08                	jg     80034b <sys_env_set_trapframe+0x2b>
+  800343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800346:	5b                   	pop    %ebx
+  800347:	5e                   	pop    %esi
+  800348:	5f                   	pop    %edi
+  800349:	5d                   	pop    %ebp
+  80034a:	c3                   	ret
+  80034b:	83 ec 0c             	sub    $0xc,%esp
+  80034e:	50                   	push   %eax
+  80034f:	6a 09                	push   $0x9
+  800351:	68 8a 31 80 00       	push   $0x80318a
+  800356:	6a 24                	push   $0x24
+  800358:	68 a7 31 80 00       	push   $0x8031a7
+  80035d:	e8 16 1e 00 00       	call   802178 <_panic>
+
+00800362 <sys_env_set_cow>:
+  800362:	55                   	push   %ebp
+  800363:	89 e5                	mov    %esp,%ebp
+  800365:	57                   	push   %edi
+  800366:	56                   	push   %esi
+  800367:	53                   	push   %ebx
+  800368:	83 ec 0c             	sub    $0xc,%esp
+  80036b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800370:	8b 55 08             	mov    0x8(%ebp),%edx
+  800373:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800376:	b8 20 00 00 00       	mov    $0x20,%eax
+  80037b:	89 df                	mov    %ebx,%edi
+  80037d:	89 de                	mov    %ebx,%esi
+  80037f:	cd 30                	int    $0x30
+  800381:	85 c0                	test   %eax,%eax
+  800383:	7f 08                	jg     80038d <sys_env_set_cow+0x2b>
+  800385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800388:	5b                   	pop    %ebx
+  800389:	5e                   	pop    %esi
+  80038a:	5f                   	pop    %edi
+  80038b:	5d                   	pop    %ebp
+  80038c:	c3                   	ret
+  80038d:	83 ec 0c             	sub    $0xc,%esp
+  800390:	50                   	push   %eax
+  800391:	6a 20                	push   $0x20
+  800393:	68 8a 31 80 00       	push   $0x80318a
+  800398:	6a 24                	push   $0x24
+  80039a:	68 a7 31 80 00       	push   $0x8031a7
+  80039f:	e8 d4 1d 00 00       	call   802178 <_panic>
+
+008003a4 <sys_env_service>:
+  8003a4:	55                   	push   %ebp
+  8003a5:	89 e5                	mov    %esp,%ebp
+  8003a7:	57                   	push   %edi
+  8003a8:	56                   	push   %esi
+  8003a9:	53                   	push   %ebx
+  8003aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b2:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003b7:	89 cb                	mov    %ecx,%ebx
+  8003b9:	89 cf                	mov    %ecx,%edi
+  8003bb:	89 ce                	mov    %ecx,%esi
+  8003bd:	cd 30                	int    $0x30
+  8003bf:	5b                   	pop    %ebx
+  8003c0:	5e                   	pop    %esi
+  8003c1:	5f                   	pop    %edi
+  8003c2:	5d                   	pop    %ebp
+  8003c3:	c3                   	ret
+
+008003c4 <sys_env_set_pgfault_upcall>:
+  8003c4:	55                   	push   %ebp
+  8003c5:	89 e5                	mov    %esp,%ebp
+  8003c7:	57                   	push   %edi
+  8003c8:	56                   	push   %esi
+  8003c9:	53                   	push   %ebx
+  8003ca:	83 ec 0c             	sub    $0xc,%esp
+  8003cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003dd:	89 df                	mov    %ebx,%edi
+  8003df:	89 de                	mov    %ebx,%esi
+  8003e1:	cd 30                	int    $0x30
+  8003e3:	85 c0                	test   %eax,%eax
+  8003e5:	7f 08                	jg     8003ef <sys_env_set_pgfault_upcall+0x2b>
+  8003e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ea:	5b                   	pop    %ebx
+  8003eb:	5e                   	pop    %esi
+  8003ec:	5f                   	pop    %edi
+  8003ed:	5d                   	pop    %ebp
+  8003ee:	c3                   	ret
+  8003ef:	83 ec 0c             	sub    $0xc,%esp
+  8003f2:	50                   	push   %eax
+  8003f3:	6a 0a                	push   $0xa
+  8003f5:	68 8a 31 80 00       	push   $0x80318a
+  8003fa:	6a 24                	push   $0x24
+  8003fc:	68 a7 31 80 00       	push   $0x8031a7
+  800401:	e8 72 1d 00 00       	call   802178 <_panic>
+
+00800406 <sys_ipc_try_send>:
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	57                   	push   %edi
+  80040a:	56                   	push   %esi
+  80040b:	53                   	push   %ebx
+  80040c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800413:	74 27                	je     80043c <sys_ipc_try_send+0x36>
+  800415:	8b 55 08             	mov    0x8(%ebp),%edx
+  800418:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800420:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800423:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800426:	6a 00                	push   $0x0
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	8d 35 33 04 80 00    	lea    0x800433,%esi
+  800431:	0f 34                	sysenter
+  800433:	5d                   	pop    %ebp
+  800434:	83 c4 04             	add    $0x4,%esp
+  800437:	5b                   	pop    %ebx
+  800438:	5e                   	pop    %esi
+  800439:	5f                   	pop    %edi
+  80043a:	5d                   	pop    %ebp
+  80043b:	c3                   	ret
+  80043c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800441:	be 00 00 00 00       	mov    $0x0,%esi
+  800446:	8b 55 08             	mov    0x8(%ebp),%edx
+  800449:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80044c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80044f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800452:	cd 30                	int    $0x30
+  800454:	eb e1                	jmp    800437 <sys_ipc_try_send+0x31>
+
+00800456 <sys_ipc_recv>:
+  800456:	55                   	push   %ebp
+  800457:	89 e5                	mov    %esp,%ebp
+  800459:	57                   	push   %edi
+  80045a:	56                   	push   %esi
+  80045b:	53                   	push   %ebx
+  80045c:	83 ec 0c             	sub    $0xc,%esp
+  80045f:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800466:	74 32                	je     80049a <sys_ipc_recv+0x44>
+  800468:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800470:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800475:	89 cb                	mov    %ecx,%ebx
+  800477:	89 cf                	mov    %ecx,%edi
+  800479:	6a 00                	push   $0x0
+  80047b:	55                   	push   %ebp
+  80047c:	89 e5                	mov    %esp,%ebp
+  80047e:	8d 35 86 04 80 00    	lea    0x800486,%esi
+  800484:	0f 34                	sysenter
+  800486:	5d                   	pop    %ebp
+  800487:	83 c4 04             	add    $0x4,%esp
+  80048a:	89 c2                	mov    %eax,%edx
+  80048c:	85 c0                	test   %eax,%eax
+  80048e:	7f 3c                	jg     8004cc <sys_ipc_recv+0x76>
+  800490:	89 d0                	mov    %edx,%eax
+  800492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800495:	5b                   	pop    %ebx
+  800496:	5e                   	pop    %esi
+  800497:	5f                   	pop    %edi
+  800498:	5d                   	pop    %ebp
+  800499:	c3                   	ret
+  80049a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80049f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a7:	89 cb                	mov    %ecx,%ebx
+  8004a9:	89 cf                	mov    %ecx,%edi
+  8004ab:	89 ce                	mov    %ecx,%esi
+  8004ad:	cd 30                	int    $0x30
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	7e db                	jle    800490 <sys_ipc_recv+0x3a>
+  8004b5:	83 ec 0c             	sub    $0xc,%esp
+  8004b8:	50                   	push   %eax
+  8004b9:	6a 0d                	push   $0xd
+  8004bb:	68 8a 31 80 00       	push   $0x80318a
+  8004c0:	6a 24                	push   $0x24
+  8004c2:	68 a7 31 80 00       	push   $0x8031a7
+  8004c7:	e8 ac 1c 00 00       	call   802178 <_panic>
+  8004cc:	83 ec 0c             	sub    $0xc,%esp
+  8004cf:	50                   	push   %eax
+  8004d0:	6a 0d                	push   $0xd
+  8004d2:	68 8a 31 80 00       	push   $0x80318a
+  8004d7:	6a 48                	push   $0x48
+  8004d9:	68 a7 31 80 00       	push   $0x8031a7
+  8004de:	e8 95 1c 00 00       	call   802178 <_panic>
+
+008004e3 <sys_ipc_send>:
+  8004e3:	55                   	push   %ebp
+  8004e4:	89 e5                	mov    %esp,%ebp
+  8004e6:	57                   	push   %edi
+  8004e7:	56                   	push   %esi
+  8004e8:	53                   	push   %ebx
+  8004e9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004f0:	74 27                	je     800519 <sys_ipc_send+0x36>
+  8004f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800500:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800503:	6a 00                	push   $0x0
+  800505:	55                   	push   %ebp
+  800506:	89 e5                	mov    %esp,%ebp
+  800508:	8d 35 10 05 80 00    	lea    0x800510,%esi
+  80050e:	0f 34                	sysenter
+  800510:	5d                   	pop    %ebp
+  800511:	83 c4 04             	add    $0x4,%esp
+  800514:	5b                   	pop    %ebx
+  800515:	5e                   	pop    %esi
+  800516:	5f                   	pop    %edi
+  800517:	5d                   	pop    %ebp
+  800518:	c3                   	ret
+  800519:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80051e:	be 00 00 00 00       	mov    $0x0,%esi
+  800523:	8b 55 08             	mov    0x8(%ebp),%edx
+  800526:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800529:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80052c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80052f:	cd 30                	int    $0x30
+  800531:	eb e1                	jmp    800514 <sys_ipc_send+0x31>
+
+00800533 <sys_ipc_call>:
+  800533:	55                   	push   %ebp
+  800534:	89 e5                	mov    %esp,%ebp
+  800536:	57                   	push   %edi
+  800537:	56                   	push   %esi
+  800538:	53                   	push   %ebx
+  800539:	8b 55 08             	mov    0x8(%ebp),%edx
+  80053c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800544:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800547:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80054a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80054d:	cd 30                	int    $0x30
+  80054f:	5b                   	pop    %ebx
+  800550:	5e                   	pop    %esi
+  800551:	5f                   	pop    %edi
+  800552:	5d                   	pop    %ebp
+  800553:	c3                   	ret
+
+00800554 <sys_ipc_reply_recv>:
+  800554:	55                   	push   %ebp
+  800555:	89 e5                	mov    %esp,%ebp
+  800557:	57                   	push   %edi
+  800558:	56                   	push   %esi
+  800559:	53                   	push   %ebx
+  80055a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800560:	b8 10 00 00 00       	mov    $0x10,%eax
+  800565:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800568:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80056b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80056e:	cd 30                	int    $0x30
+  800570:	5b                   	pop    %ebx
+  800571:	5e                   	pop    %esi
+  800572:	5f                   	pop    %edi
+  800573:	5d                   	pop    %ebp
+  800574:	c3                   	ret
+
+00800575 <sys_time_msec>:
+  800575:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80057a:	85 c0                	test   %eax,%eax
+  80057c:	75 06                	jne    800584 <sys_time_msec+0xf>
+  80057e:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  800583:	c3                   	ret
+  800584:	55                   	push   %ebp
+  800585:	89 e5                	mov    %esp,%ebp
+  800587:	57                   	push   %edi
+  800588:	56                   	push   %esi
+  800589:	53                   	push   %ebx
+  80058a:	83 ec 0c             	sub    $0xc,%esp
+  80058d:	0f 31                	rdtsc
+  80058f:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800595:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80059b:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8005a1:	29 c8                	sub    %ecx,%eax
+  8005a3:	19 da                	sbb    %ebx,%edx
+  8005a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005aa:	57                   	push   %edi
+  8005ab:	56                   	push   %esi
+  8005ac:	52                   	push   %edx
+  8005ad:	50                   	push   %eax
+  8005ae:	e8 95 2a 00 00       	call   803048 <__udivdi3>
+  8005b3:	83 c4 10             	add    $0x10,%esp
+  8005b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b9:	5b                   	pop    %ebx
+  8005ba:	5e                   	pop    %esi
+  8005bb:	5f                   	pop    %edi
+  8005bc:	5d                   	pop    %ebp
+  8005bd:	c3                   	ret
+
+008005be <sys_env_swap>:
+  8005be:	55                   	push   %ebp
+  8005bf:	89 e5                	mov    %esp,%ebp
+  8005c1:	57                   	push   %edi
+  8005c2:	56                   	push   %esi
+  8005c3:	53                   	push   %ebx
+  8005c4:	83 ec 0c             	sub    $0xc,%esp
+  8005c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005cf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005d4:	89 cb                	mov    %ecx,%ebx
+  8005d6:	89 cf                	mov    %ecx,%edi
+  8005d8:	89 ce                	mov    %ecx,%esi
+  8005da:	cd 30                	int    $0x30
+  8005dc:	85 c0                	test   %eax,%eax
+  8005de:	7f 08                	jg     8005e8 <sys_env_swap+0x2a>
+  8005e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e3:	5b                   	pop    %ebx
+  8005e4:	5e                   	pop    %esi
+  8005e5:	5f                   	pop    %edi
+  8005e6:	5d                   	pop    %ebp
+  8005e7:	c3                   	ret
+  8005e8:	83 ec 0c             	sub    $0xc,%esp
+  8005eb:	50                   	push   %eax
+  8005ec:	6a 12                	push   $0x12
+  8005ee:	68 8a 31 80 00       	push   $0x80318a
+  8005f3:	6a 24                	push   $0x24
+  8005f5:	68 a7 31 80 00       	push   $0x8031a7
+  8005fa:	e8 79 1b 00 00       	call   802178 <_panic>
+
+008005ff <sys_net_try_send>:
+  8005ff:	55                   	push   %ebp
+  800600:	89 e5                	mov    %esp,%ebp
+  800602:	57                   	push   %edi
+  800603:	56                   	push   %esi
+  800604:	53                   	push   %ebx
+  800605:	83 ec 0c             	sub    $0xc,%esp
+  800608:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800610:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800613:	b8 13 00 00 00       	mov    $0x13,%eax
+  800618:	89 df                	mov    %ebx,%edi
+  80061a:	89 de                	mov    %ebx,%esi
+  80061c:	cd 30                	int    $0x30
+  80061e:	85 c0                	test   %eax,%eax
+  800620:	7f 08                	jg     80062a <sys_net_try_send+0x2b>
+  800622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800625:	5b                   	pop    %ebx
+  800626:	5e                   	pop    %esi
+  800627:	5f                   	pop    %edi
+  800628:	5d                   	pop    %ebp
+  800629:	c3                   	ret
+  80062a:	83 ec 0c             	sub    $0xc,%esp
+  80062d:	50                   	push   %eax
+  80062e:	6a 13                	push   $0x13
+  800630:	68 8a 31 80 00       	push   $0x80318a
+  800635:	6a 24                	push   $0x24
+  800637:	68 a7 31 80 00       	push   $0x8031a7
+  80063c:	e8 37 1b 00 00       	call   802178 <_panic>
+
+00800641 <sys_net_try_receive>:
+  800641:	55                   	push   %ebp
+  800642:	89 e5                	mov    %esp,%ebp
+  800644:	57                   	push   %edi
+  800645:	56                   	push   %esi
+  800646:	53                   	push   %ebx
+  800647:	83 ec 0c             	sub    $0xc,%esp
+  80064a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80064f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800652:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800655:	b8 14 00 00 00       	mov    $0x14,%eax
+  80065a:	89 df                	mov    %ebx,%edi
+  80065c:	89 de                	mov    %ebx,%esi
+  80065e:	cd 30                	int    $0x30
+  800660:	85 c0                	test   %eax,%eax
+  800662:	7f 08                	jg     80066c <sys_net_try_receive+0x2b>
+  800664:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800667:	5b                   	pop    %ebx
+  800668:	5e                   	pop    %esi
+  800669:	5f                   	pop    %edi
+  80066a:	5d                   	pop    %ebp
+  80066b:	c3                   	ret
+  80066c:	83 ec 0c             	sub    $0xc,%esp
+  80066f:	50                   	push   %eax
+  800670:	6a 14                	push   $0x14
+  800672:	68 8a 31 80 00       	push   $0x80318a
+  800677:	6a 24                	push   $0x24
+  800679:	68 a7 31 80 00       	push   $0x8031a7
+  80067e:	e8 f5 1a 00 00       	call   802178 <_panic>
+
+00800683 <sys_net_recv_page>:
+  800683:	55                   	push   %ebp
+  800684:	89 e5                	mov    %esp,%ebp
+  800686:	57                   	push   %edi
+  800687:	56                   	push   %esi
+  800688:	53                   	push   %ebx
+  800689:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800691:	b8 27 00 00 00       	mov    $0x27,%eax
+  800696:	89 cb                	mov    %ecx,%ebx
+  800698:	89 cf                	mov    %ecx,%edi
+  80069a:	89 ce                	mov    %ecx,%esi
+  80069c:	cd 30                	int    $0x30
+  80069e:	5b                   	pop    %ebx
+  80069f:	5e                   	pop    %esi
+  8006a0:	5f                   	pop    %edi
+  8006a1:	5d                   	pop    %ebp
+  8006a2:	c3                   	ret
+
+008006a3 <sys_net_wait>:
+  8006a3:	55                   	push   %ebp
+  8006a4:	89 e5                	mov    %esp,%ebp
+  8006a6:	57                   	push   %edi
+  8006a7:	56                   	push   %esi
+  8006a8:	53                   	push   %ebx
+  8006a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ae:	b8 26 00 00 00       	mov    $0x26,%eax
+  8006b3:	89 d1                	mov    %edx,%ecx
+  8006b5:	89 d3                	mov    %edx,%ebx
+  8006b7:	89 d7                	mov    %edx,%edi
+  8006b9:	89 d6                	mov    %edx,%esi
+  8006bb:	cd 30                	int    $0x30
+  8006bd:	5b                   	pop    %ebx
+  8006be:	5e                   	pop    %esi
+  8006bf:	5f                   	pop    %edi
+  8006c0:	5d                   	pop    %ebp
+  8006c1:	c3                   	ret
+
+008006c2 <sys_get_mac>:
+  8006c2:	55                   	push   %ebp
+  8006c3:	89 e5                	mov    %esp,%ebp
+  8006c5:	57                   	push   %edi
+  8006c6:	56                   	push   %esi
+  8006c7:	53                   	push   %ebx
+  8006c8:	83 ec 0c             	sub    $0xc,%esp
+  8006cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006d6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006db:	89 df                	mov    %ebx,%edi
+  8006dd:	89 de                	mov    %ebx,%esi
+  8006df:	cd 30                	int    $0x30
+  8006e1:	85 c0                	test   %eax,%eax
+  8006e3:	7f 08                	jg     8006ed <sys_get_mac+0x2b>
+  8006e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006e8:	5b                   	pop    %ebx
+  8006e9:	5e                   	pop    %esi
+  8006ea:	5f                   	pop    %edi
+  8006eb:	5d                   	pop    %ebp
+  8006ec:	c3                   	ret
+  8006ed:	83 ec 0c             	sub    $0xc,%esp
+  8006f0:	50                   	push   %eax
+  8006f1:	6a 15                	push   $0x15
+  8006f3:	68 8a 31 80 00       	push   $0x80318a
+  8006f8:	6a 24                	push   $0x24
+  8006fa:	68 a7 31 80 00       	push   $0x8031a7
+  8006ff:	e8 74 1a 00 00       	call   802178 <_panic>
+
+00800704 <sys_env_lease>:
+  800704:	55                   	push   %ebp
+  800705:	89 e5                	mov    %esp,%ebp
+  800707:	57                   	push   %edi
+  800708:	56                   	push   %esi
+  800709:	53                   	push   %ebx
+  80070a:	83 ec 0c             	sub    $0xc,%esp
+  80070d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800712:	8b 55 08             	mov    0x8(%ebp),%edx
+  800715:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800718:	b8 16 00 00 00       	mov    $0x16,%eax
+  80071d:	89 df                	mov    %ebx,%edi
+  80071f:	89 de                	mov    %ebx,%esi
+  800721:	cd 30                	int    $0x30
+  800723:	85 c0                	test   %eax,%eax
+  800725:	7f 08                	jg     80072f <sys_env_lease+0x2b>
+  800727:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80072a:	5b                   	pop    %ebx
+  80072b:	5e                   	pop    %esi
+  80072c:	5f                   	pop    %edi
+  80072d:	5d                   	pop    %ebp
+  80072e:	c3                   	ret
+  80072f:	83 ec 0c             	sub    $0xc,%esp
+  800732:	50                   	push   %eax
+  800733:	6a 16                	push   $0x16
+  800735:	68 8a 31 80 00       	push   $0x80318a
+  80073a:	6a 24                	push   $0x24
+  80073c:	68 a7 31 80 00       	push   $0x8031a7
+  800741:	e8 32 1a 00 00       	call   802178 <_panic>
+
+00800746 <sys_copy_mem>:
+  800746:	55                   	push   %ebp
+  800747:	89 e5                	mov    %esp,%ebp
+  800749:	57                   	push   %edi
+  80074a:	56                   	push   %esi
+  80074b:	53                   	push   %ebx
+  80074c:	83 ec 0c             	sub    $0xc,%esp
+  80074f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800752:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800755:	b8 17 00 00 00       	mov    $0x17,%eax
+  80075a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80075d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800760:	8b 75 18             	mov    0x18(%ebp),%esi
+  800763:	cd 30                	int    $0x30
+  800765:	85 c0                	test   %eax,%eax
+  800767:	7f 08                	jg     800771 <sys_copy_mem+0x2b>
+  800769:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80076c:	5b                   	pop    %ebx
+  80076d:	5e                   	pop    %esi
+  80076e:	5f                   	pop    %edi
+  80076f:	5d                   	pop    %ebp
+  800770:	c3                   	ret
+  800771:	83 ec 0c             	sub    $0xc,%esp
+  800774:	50                   	push   %eax
+  800775:	6a 17                	push   $0x17
+  800777:	68 8a 31 80 00       	push   $0x80318a
+  80077c:	6a 24                	push   $0x24
+  80077e:	68 a7 31 80 00       	push   $0x8031a7
+  800783:	e8 f0 19 00 00       	call   802178 <_panic>
+
+00800788 <sys_get_perms>:
+  800788:	55                   	push   %ebp
+  800789:	89 e5                	mov    %esp,%ebp
+  80078b:	57                   	push   %edi
+  80078c:	56                   	push   %esi
+  80078d:	53                   	push   %ebx
+  80078e:	83 ec 0c             	sub    $0xc,%esp
+  800791:	be 00 00 00 00       	mov    $0x0,%esi
+  800796:	8b 55 08             	mov    0x8(%ebp),%edx
+  800799:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80079c:	b8 18 00 00 00       	mov    $0x18,%eax
+  8007a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007a4:	89 f7                	mov    %esi,%edi
+  8007a6:	cd 30                	int    $0x30
+  8007a8:	85 c0                	test   %eax,%eax
+  8007aa:	7f 08                	jg     8007b4 <sys_get_perms+0x2c>
+  8007ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007af:	5b                   	pop    %ebx
+  8007b0:	5e                   	pop    %esi
+  8007b1:	5f                   	pop    %edi
+  8007b2:	5d                   	pop    %ebp
+  8007b3:	c3                   	ret
+  8007b4:	83 ec 0c             	sub    $0xc,%esp
+  8007b7:	50                   	push   %eax
+  8007b8:	6a 18                	push   $0x18
+  8007ba:	68 8a 31 80 00       	push   $0x80318a
+  8007bf:	6a 24                	push   $0x24
+  8007c1:	68 a7 31 80 00       	push   $0x8031a7
+  8007c6:	e8 ad 19 00 00       	call   802178 <_panic>
+
+008007cb <sys_env_unsuspend>:
+  8007cb:	55                   	push   %ebp
+  8007cc:	89 e5                	mov    %esp,%ebp
+  8007ce:	57                   	push   %edi
+  8007cf:	56                   	push   %esi
+  8007d0:	53                   	push   %ebx
+  8007d1:	83 ec 0c             	sub    $0xc,%esp
+  8007d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007df:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007e7:	89 f7                	mov    %esi,%edi
+  8007e9:	cd 30                	int    $0x30
+  8007eb:	85 c0                	test   %eax,%eax
+  8007ed:	7f 08                	jg     8007f7 <sys_env_unsuspend+0x2c>
+  8007ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007f2:	5b                   	pop    %ebx
+  8007f3:	5e                   	pop    %esi
+  8007f4:	5f                   	pop    %edi
+  8007f5:	5d                   	pop    %ebp
+  8007f6:	c3                   	ret
+  8007f7:	83 ec 0c             	sub    $0xc,%esp
+  8007fa:	50                   	push   %eax
+  8007fb:	6a 19                	push   $0x19
+  8007fd:	68 8a 31 80 00       	push   $0x80318a
+  800802:	6a 24                	push   $0x24
+  800804:	68 a7 31 80 00       	push   $0x8031a7
+  800809:	e8 6a 19 00 00       	call   802178 <_panic>
+
+0080080e <sys_migrate>:
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	57                   	push   %edi
+  800812:	56                   	push   %esi
+  800813:	53                   	push   %ebx
+  800814:	83 ec 0c             	sub    $0xc,%esp
+  800817:	ba 00 80 80 00       	mov    $0x808000,%edx
+  80081c:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  800822:	76 11                	jbe    800835 <sys_migrate+0x27>
+  800824:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800829:	0f b6 08             	movzbl (%eax),%ecx
+  80082c:	05 00 10 00 00       	add    $0x1000,%eax
+  800831:	39 d0                	cmp    %edx,%eax
+  800833:	72 f4                	jb     800829 <sys_migrate+0x1b>
+  800835:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80083d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800842:	89 cb                	mov    %ecx,%ebx
+  800844:	89 cf                	mov    %ecx,%edi
+  800846:	89 ce                	mov    %ecx,%esi
+  800848:	cd 30                	int    $0x30
+  80084a:	85 c0                	test   %eax,%eax
+  80084c:	7f 08                	jg     800856 <sys_migrate+0x48>
+  80084e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800851:	5b                   	pop    %ebx
+  800852:	5e                   	pop    %esi
+  800853:	5f                   	pop    %edi
+  800854:	5d                   	pop    %ebp
+  800855:	c3                   	ret
+  800856:	83 ec 0c             	sub    $0xc,%esp
+  800859:	50                   	push   %eax
+  80085a:	6a 1a                	push   $0x1a
+  80085c:	68 8a 31 80 00       	push   $0x80318a
+  800861:	6a 24                	push   $0x24
+  800863:	68 a7 31 80 00       	push   $0x8031a7
+  800868:	e8 0b 19 00 00       	call   802178 <_panic>
+
+0080086d <sys_lease_complete>:
+  80086d:	55                   	push   %ebp
+  80086e:	89 e5                	mov    %esp,%ebp
+  800870:	57                   	push   %edi
+  800871:	56                   	push   %esi
+  800872:	53                   	push   %ebx
+  800873:	83 ec 0c             	sub    $0xc,%esp
+  800876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80087b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800880:	89 d1                	mov    %edx,%ecx
+  800882:	89 d3                	mov    %edx,%ebx
+  800884:	89 d7                	mov    %edx,%edi
+  800886:	89 d6                	mov    %edx,%esi
+  800888:	cd 30                	int    $0x30
+  80088a:	85 c0                	test   %eax,%eax
+  80088c:	7f 08                	jg     800896 <sys_lease_complete+0x29>
+  80088e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800891:	5b                   	pop    %ebx
+  800892:	5e                   	pop    %esi
+  800893:	5f                   	pop    %edi
+  800894:	5d                   	pop    %ebp
+  800895:	c3                   	ret
+  800896:	83 ec 0c             	sub    $0xc,%esp
+  800899:	50                   	push   %eax
+  80089a:	6a 1b                	push   $0x1b
+  80089c:	68 8a 31 80 00       	push   $0x80318a
+  8008a1:	6a 24                	push   $0x24
+  8008a3:	68 a7 31 80 00       	push   $0x8031a7
+  8008a8:	e8 cb 18 00 00       	call   802178 <_panic>
+
+008008ad <sys_env_set_thisenv>:
+  8008ad:	55                   	push   %ebp
+  8008ae:	89 e5                	mov    %esp,%ebp
+  8008b0:	57                   	push   %edi
+  8008b1:	56                   	push   %esi
+  8008b2:	53                   	push   %ebx
+  8008b3:	83 ec 0c             	sub    $0xc,%esp
+  8008b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008c6:	89 df                	mov    %ebx,%edi
+  8008c8:	89 de                	mov    %ebx,%esi
+  8008ca:	cd 30                	int    $0x30
+  8008cc:	85 c0                	test   %eax,%eax
+  8008ce:	7f 08                	jg     8008d8 <sys_env_set_thisenv+0x2b>
+  8008d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d3:	5b                   	pop    %ebx
+  8008d4:	5e                   	pop    %esi
+  8008d5:	5f                   	pop    %edi
+  8008d6:	5d                   	pop    %ebp
+  8008d7:	c3                   	ret
+  8008d8:	83 ec 0c             	sub    $0xc,%esp
+  8008db:	50                   	push   %eax
+  8008dc:	6a 1c                	push   $0x1c
+  8008de:	68 8a 31 80 00       	push   $0x80318a
+  8008e3:	6a 24                	push   $0x24
+  8008e5:	68 a7 31 80 00       	push   $0x8031a7
+  8008ea:	e8 89 18 00 00       	call   802178 <_panic>
+
+008008ef <sys_env_set_sched>:
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	57                   	push   %edi
+  8008f3:	56                   	push   %esi
+  8008f4:	53                   	push   %ebx
+  8008f5:	83 ec 0c             	sub    $0xc,%esp
+  8008f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8008fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800900:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800903:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800908:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80090b:	89 f7                	mov    %esi,%edi
+  80090d:	cd 30                	int    $0x30
+  80090f:	85 c0                	test   %eax,%eax
+  800911:	7f 08                	jg     80091b <sys_env_set_sched+0x2c>
+  800913:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800916:	5b                   	pop    %ebx
+  800917:	5e                   	pop    %esi
+  800918:	5f                   	pop    %edi
+  800919:	5d                   	pop    %ebp
+  80091a:	c3                   	ret
+  80091b:	83 ec 0c             	sub    $0xc,%esp
+  80091e:	50                   	push   %eax
+  80091f:	6a 1d                	push   $0x1d
+  800921:	68 8a 31 80 00       	push   $0x80318a
+  800926:	6a 24                	push   $0x24
+  800928:	68 a7 31 80 00       	push   $0x8031a7
+  80092d:	e8 46 18 00 00       	call   802178 <_panic>
+
+00800932 <sys_batch>:
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	57                   	push   %edi
+  800936:	56                   	push   %esi
+  800937:	53                   	push   %ebx
+  800938:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80093d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800940:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800943:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800948:	89 df                	mov    %ebx,%edi
+  80094a:	89 de                	mov    %ebx,%esi
+  80094c:	cd 30                	int    $0x30
+  80094e:	5b                   	pop    %ebx
+  80094f:	5e                   	pop    %esi
+  800950:	5f                   	pop    %edi
+  800951:	5d                   	pop    %ebp
+  800952:	c3                   	ret
+
+00800953 <sys_env_stats>:
+  800953:	55                   	push   %ebp
+  800954:	89 e5                	mov    %esp,%ebp
+  800956:	57                   	push   %edi
+  800957:	56                   	push   %esi
+  800958:	53                   	push   %ebx
+  800959:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80095e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800961:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800964:	b8 23 00 00 00       	mov    $0x23,%eax
+  800969:	89 df                	mov    %ebx,%edi
+  80096b:	89 de                	mov    %ebx,%esi
+  80096d:	cd 30                	int    $0x30
+  80096f:	5b                   	pop    %ebx
+  800970:	5e                   	pop    %esi
+  800971:	5f                   	pop    %edi
+  800972:	5d                   	pop    %ebp
+  800973:	c3                   	ret
+
+00800974 <sys_trace>:
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	57                   	push   %edi
+  800978:	56                   	push   %esi
+  800979:	53                   	push   %ebx
+  80097a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800982:	b8 24 00 00 00       	mov    $0x24,%eax
+  800987:	89 cb                	mov    %ecx,%ebx
+  800989:	89 cf                	mov    %ecx,%edi
+  80098b:	89 ce                	mov    %ecx,%esi
+  80098d:	cd 30                	int    $0x30
+  80098f:	5b                   	pop    %ebx
+  800990:	5e                   	pop    %esi
+  800991:	5f                   	pop    %edi
+  800992:	5d                   	pop    %ebp
+  800993:	c3                   	ret
+
+00800994 <sys_env_set_pager>:
+  800994:	55                   	push   %ebp
+  800995:	89 e5                	mov    %esp,%ebp
+  800997:	57                   	push   %edi
+  800998:	56                   	push   %esi
+  800999:	53                   	push   %ebx
+  80099a:	83 ec 0c             	sub    $0xc,%esp
+  80099d:	be 00 00 00 00       	mov    $0x0,%esi
+  8009a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a8:	b8 25 00 00 00       	mov    $0x25,%eax
+  8009ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009b0:	89 f7                	mov    %esi,%edi
+  8009b2:	cd 30                	int    $0x30
+  8009b4:	85 c0                	test   %eax,%eax
+  8009b6:	7f 08                	jg     8009c0 <sys_env_set_pager+0x2c>
+  8009b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bb:	5b                   	pop    %ebx
+  8009bc:	5e                   	pop    %esi
+  8009bd:	5f                   	pop    %edi
+  8009be:	5d                   	pop    %ebp
+  8009bf:	c3                   	ret
+  8009c0:	83 ec 0c             	sub    $0xc,%esp
+  8009c3:	50                   	push   %eax
+  8009c4:	6a 25                	push   $0x25
+  8009c6:	68 8a 31 80 00       	push   $0x80318a
+  8009cb:	6a 24                	push   $0x24
+  8009cd:	68 a7 31 80 00       	push   $0x8031a7
+  8009d2:	e8 a1 17 00 00       	call   802178 <_panic>
+
+008009d7 <sys_pager_retire>:
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	57                   	push   %edi
+  8009db:	56                   	push   %esi
+  8009dc:	53                   	push   %ebx
+  8009dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009ea:	89 cb                	mov    %ecx,%ebx
+  8009ec:	89 cf                	mov    %ecx,%edi
+  8009ee:	89 ce                	mov    %ecx,%esi
+  8009f0:	cd 30                	int    $0x30
+  8009f2:	5b                   	pop    %ebx
+  8009f3:	5e                   	pop    %esi
+  8009f4:	5f                   	pop    %edi
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <sys_prof>:
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	57                   	push   %edi
+  8009fb:	56                   	push   %esi
+  8009fc:	53                   	push   %ebx
+  8009fd:	be 00 00 00 00       	mov    $0x0,%esi
+  800a02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a08:	b8 22 00 00 00       	mov    $0x22,%eax
+  800a0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a10:	89 f7                	mov    %esi,%edi
+  800a12:	cd 30                	int    $0x30
+  800a14:	5b                   	pop    %ebx
+  800a15:	5e                   	pop    %esi
+  800a16:	5f                   	pop    %edi
+  800a17:	5d                   	pop    %ebp
+  800a18:	c3                   	ret
+
+00800a19 <fd2num>:
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a24:	c1 e8 0c             	shr    $0xc,%eax
+  800a27:	5d                   	pop    %ebp
+  800a28:	c3                   	ret
+
+00800a29 <fd2data>:
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a34:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a39:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a3e:	5d                   	pop    %ebp
+  800a3f:	c3                   	ret
+
+00800a40 <fd_alloc>:
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a48:	89 c2                	mov    %eax,%edx
+  800a4a:	c1 ea 16             	shr    $0x16,%edx
+  800a4d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a54:	f6 c2 01             	test   $0x1,%dl
+  800a57:	74 29                	je     800a82 <fd_alloc+0x42>
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	c1 ea 0c             	shr    $0xc,%edx
+  800a5e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a65:	f6 c2 01             	test   $0x1,%dl
+  800a68:	74 18                	je     800a82 <fd_alloc+0x42>
+  800a6a:	05 00 10 00 00       	add    $0x1000,%eax
+  800a6f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a74:	75 d2                	jne    800a48 <fd_alloc+0x8>
+  800a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a80:	eb 05                	jmp    800a87 <fd_alloc+0x47>
+  800a82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a8a:	89 02                	mov    %eax,(%edx)
+  800a8c:	89 c8                	mov    %ecx,%eax
+  800a8e:	5d                   	pop    %ebp
+  800a8f:	c3                   	ret
+
+00800a90 <fd_lookup>:
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a96:	83 f8 1f             	cmp    $0x1f,%eax
+  800a99:	77 30                	ja     800acb <fd_lookup+0x3b>
+  800a9b:	c1 e0 0c             	shl    $0xc,%eax
+  800a9e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800aa3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800aa9:	f6 c2 01             	test   $0x1,%dl
+  800aac:	74 24                	je     800ad2 <fd_lookup+0x42>
+  800aae:	89 c2                	mov    %eax,%edx
+  800ab0:	c1 ea 0c             	shr    $0xc,%edx
+  800ab3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800aba:	f6 c2 01             	test   $0x1,%dl
+  800abd:	74 1a                	je     800ad9 <fd_lookup+0x49>
+  800abf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac2:	89 02                	mov    %eax,(%edx)
+  800ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac9:	5d                   	pop    %ebp
+  800aca:	c3                   	ret
+  800acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad0:	eb f7                	jmp    800ac9 <fd_lookup+0x39>
+  800ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad7:	eb f0                	jmp    800ac9 <fd_lookup+0x39>
+  800ad9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ade:	eb e9                	jmp    800ac9 <fd_lookup+0x39>
+
+00800ae0 <dev_lookup>:
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	53                   	push   %ebx
+  800ae4:	83 ec 04             	sub    $0x4,%esp
+  800ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aef:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800af4:	39 13                	cmp    %edx,(%ebx)
+  800af6:	74 37                	je     800b2f <dev_lookup+0x4f>
+  800af8:	83 c0 01             	add    $0x1,%eax
+  800afb:	8b 1c 85 34 32 80 00 	mov    0x803234(,%eax,4),%ebx
+  800b02:	85 db                	test   %ebx,%ebx
+  800b04:	75 ee                	jne    800af4 <dev_lookup+0x14>
+  800b06:	a1 10 50 80 00       	mov    0x805010,%eax
+  800b0b:	8b 40 48             	mov    0x48(%eax),%eax
+  800b0e:	83 ec 04             	sub    $0x4,%esp
+  800b11:	52                   	push   %edx
+  800b12:	50                   	push   %eax
+  800b13:	68 b8 31 80 00       	push   $0x8031b8
+  800b18:	e8 36 17 00 00       	call   802253 <cprintf>
+  800b1d:	83 c4 10             	add    $0x10,%esp
+  800b20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b28:	89 1a                	mov    %ebx,(%edx)
+  800b2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b2d:	c9                   	leave
+  800b2e:	c3                   	ret
+  800b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b34:	eb ef                	jmp    800b25 <dev_lookup+0x45>
+
+00800b36 <fd_close>:
+  800b36:	55                   	push   %ebp
+  800b37:	89 e5                	mov    %esp,%ebp
+  800b39:	57                   	push   %edi
+  800b3a:	56                   	push   %esi
+  800b3b:	53                   	push   %ebx
+  800b3c:	83 ec 24             	sub    $0x24,%esp
+  800b3f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b42:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b45:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b48:	50                   	push   %eax
+  800b49:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b4f:	c1 e8 0c             	shr    $0xc,%eax
+  800b52:	50                   	push   %eax
+  800b53:	e8 38 ff ff ff       	call   800a90 <fd_lookup>
+  800b58:	89 c3                	mov    %eax,%ebx
+  800b5a:	83 c4 10             	add    $0x10,%esp
+  800b5d:	85 c0                	test   %eax,%eax
+  800b5f:	78 05                	js     800b66 <fd_close+0x30>
+  800b61:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b64:	74 0f                	je     800b75 <fd_close+0x3f>
+  800b66:	85 ff                	test   %edi,%edi
+  800b68:	0f 44 df             	cmove  %edi,%ebx
+  800b6b:	89 d8                	mov    %ebx,%eax
+  800b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b70:	5b                   	pop    %ebx
+  800b71:	5e                   	pop    %esi
+  800b72:	5f                   	pop    %edi
+  800b73:	5d                   	pop    %ebp
+  800b74:	c3                   	ret
+  800b75:	83 ec 08             	sub    $0x8,%esp
+  800b78:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b7b:	50                   	push   %eax
+  800b7c:	ff 36                	push   (%esi)
+  800b7e:	e8 5d ff ff ff       	call   800ae0 <dev_lookup>
+  800b83:	89 c3                	mov    %eax,%ebx
+  800b85:	83 c4 10             	add    $0x10,%esp
+  800b88:	85 c0                	test   %eax,%eax
+  800b8a:	78 1a                	js     800ba6 <fd_close+0x70>
+  800b8c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b8f:	8b 40 10             	mov    0x10(%eax),%eax
+  800b92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b97:	85 c0                	test   %eax,%eax
+  800b99:	74 0b                	je     800ba6 <fd_close+0x70>
+  800b9b:	83 ec 0c             	sub    $0xc,%esp
+  800b9e:	56                   	push   %esi
+  800b9f:	ff d0                	call   *%eax
+  800ba1:	89 c3                	mov    %eax,%ebx
+  800ba3:	83 c4 10             	add    $0x10,%esp
+  800ba6:	83 ec 08             	sub    $0x8,%esp
+  800ba9:	56                   	push   %esi
+  800baa:	6a 00                	push   $0x0
+  800bac:	e8 cc f6 ff ff       	call   80027d <sys_page_unmap>
+  800bb1:	83 c4 10             	add    $0x10,%esp
+  800bb4:	eb b5                	jmp    800b6b <fd_close+0x35>
+
+00800bb6 <close>:
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	83 ec 20             	sub    $0x20,%esp
+  800bbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bbf:	50                   	push   %eax
+  800bc0:	ff 75 08             	push   0x8(%ebp)
+  800bc3:	e8 c8 fe ff ff       	call   800a90 <fd_lookup>
+  800bc8:	83 c4 10             	add    $0x10,%esp
+  800bcb:	85 c0                	test   %eax,%eax
+  800bcd:	79 02                	jns    800bd1 <close+0x1b>
+  800bcf:	c9                   	leave
+  800bd0:	c3                   	ret
+  800bd1:	83 ec 08             	sub    $0x8,%esp
+  800bd4:	6a 01                	push   $0x1
+  800bd6:	ff 75 f4             	push   -0xc(%ebp)
+  800bd9:	e8 58 ff ff ff       	call   800b36 <fd_close>
+  800bde:	83 c4 10             	add    $0x10,%esp
+  800be1:	eb ec                	jmp    800bcf <close+0x19>
+
+00800be3 <close_all>:
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	53                   	push   %ebx
+  800be7:	83 ec 04             	sub    $0x4,%esp
+  800bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bef:	83 ec 0c             	sub    $0xc,%esp
+  800bf2:	53                   	push   %ebx
+  800bf3:	e8 be ff ff ff       	call   800bb6 <close>
+  800bf8:	83 c3 01             	add    $0x1,%ebx
+  800bfb:	83 c4 10             	add    $0x10,%esp
+  800bfe:	83 fb 20             	cmp    $0x20,%ebx
+  800c01:	75 ec                	jne    800bef <close_all+0xc>
+  800c03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c06:	c9                   	leave
+  800c07:	c3                   	ret
+
+00800c08 <dup>:
+  800c08:	55                   	push   %ebp
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	57                   	push   %edi
+  800c0c:	56                   	push   %esi
+  800c0d:	53                   	push   %ebx
+  800c0e:	83 ec 34             	sub    $0x34,%esp
+  800c11:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c14:	50                   	push   %eax
+  800c15:	ff 75 08             	push   0x8(%ebp)
+  800c18:	e8 73 fe ff ff       	call   800a90 <fd_lookup>
+  800c1d:	89 c3                	mov    %eax,%ebx
+  800c1f:	83 c4 10             	add    $0x10,%esp
+  800c22:	85 c0                	test   %eax,%eax
+  800c24:	78 7f                	js     800ca5 <dup+0x9d>
+  800c26:	83 ec 0c             	sub    $0xc,%esp
+  800c29:	ff 75 0c             	push   0xc(%ebp)
+  800c2c:	e8 85 ff ff ff       	call   800bb6 <close>
+  800c31:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c34:	c1 e6 0c             	shl    $0xc,%esi
+  800c37:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c3d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c40:	89 3c 24             	mov    %edi,(%esp)
+  800c43:	e8 e1 fd ff ff       	call   800a29 <fd2data>
+  800c48:	89 c3                	mov    %eax,%ebx
+  800c4a:	89 34 24             	mov    %esi,(%esp)
+  800c4d:	e8 d7 fd ff ff       	call   800a29 <fd2data>
+  800c52:	83 c4 10             	add    $0x10,%esp
+  800c55:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c58:	89 d8                	mov    %ebx,%eax
+  800c5a:	c1 e8 16             	shr    $0x16,%eax
+  800c5d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c64:	a8 01                	test   $0x1,%al
+  800c66:	74 11                	je     800c79 <dup+0x71>
+  800c68:	89 d8                	mov    %ebx,%eax
+  800c6a:	c1 e8 0c             	shr    $0xc,%eax
+  800c6d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c74:	f6 c2 01             	test   $0x1,%dl
+  800c77:	75 36                	jne    800caf <dup+0xa7>
+  800c79:	89 f8                	mov    %edi,%eax
+  800c7b:	c1 e8 0c             	shr    $0xc,%eax
+  800c7e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c85:	83 ec 0c             	sub    $0xc,%esp
+  800c88:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c8d:	50                   	push   %eax
+  800c8e:	56                   	push   %esi
+  800c8f:	6a 00                	push   $0x0
+  800c91:	57                   	push   %edi
+  800c92:	6a 00                	push   $0x0
+  800c94:	e8 55 f5 ff ff       	call   8001ee <sys_page_map>
+  800c99:	89 c3                	mov    %eax,%ebx
+  800c9b:	83 c4 20             	add    $0x20,%esp
+  800c9e:	85 c0                	test   %eax,%eax
+  800ca0:	78 33                	js     800cd5 <dup+0xcd>
+  800ca2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ca5:	89 d8                	mov    %ebx,%eax
+  800ca7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800caa:	5b                   	pop    %ebx
+  800cab:	5e                   	pop    %esi
+  800cac:	5f                   	pop    %edi
+  800cad:	5d                   	pop    %ebp
+  800cae:	c3                   	ret
+  800caf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800cb6:	83 ec 0c             	sub    $0xc,%esp
+  800cb9:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cbe:	50                   	push   %eax
+  800cbf:	ff 75 d4             	push   -0x2c(%ebp)
+  800cc2:	6a 00                	push   $0x0
+  800cc4:	53                   	push   %ebx
+  800cc5:	6a 00                	push   $0x0
+  800cc7:	e8 22 f5 ff ff       	call   8001ee <sys_page_map>
+  800ccc:	89 c3                	mov    %eax,%ebx
+  800cce:	83 c4 20             	add    $0x20,%esp
+  800cd1:	85 c0                	test   %eax,%eax
+  800cd3:	79 a4                	jns    800c79 <dup+0x71>
+  800cd5:	83 ec 08             	sub    $0x8,%esp
+  800cd8:	56                   	push   %esi
+  800cd9:	6a 00                	push   $0x0
+  800cdb:	e8 9d f5 ff ff       	call   80027d <sys_page_unmap>
+  800ce0:	83 c4 08             	add    $0x8,%esp
+  800ce3:	ff 75 d4             	push   -0x2c(%ebp)
+  800ce6:	6a 00                	push   $0x0
+  800ce8:	e8 90 f5 ff ff       	call   80027d <sys_page_unmap>
+  800ced:	83 c4 10             	add    $0x10,%esp
+  800cf0:	eb b3                	jmp    800ca5 <dup+0x9d>
+
+00800cf2 <read>:
+  800cf2:	55                   	push   %ebp
+  800cf3:	89 e5                	mov    %esp,%ebp
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+  800cf7:	83 ec 18             	sub    $0x18,%esp
+  800cfa:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cfd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d00:	50                   	push   %eax
+  800d01:	56                   	push   %esi
+  800d02:	e8 89 fd ff ff       	call   800a90 <fd_lookup>
+  800d07:	83 c4 10             	add    $0x10,%esp
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	78 3c                	js     800d4a <read+0x58>
+  800d0e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d11:	83 ec 08             	sub    $0x8,%esp
+  800d14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d17:	50                   	push   %eax
+  800d18:	ff 33                	push   (%ebx)
+  800d1a:	e8 c1 fd ff ff       	call   800ae0 <dev_lookup>
+  800d1f:	83 c4 10             	add    $0x10,%esp
+  800d22:	85 c0                	test   %eax,%eax
+  800d24:	78 24                	js     800d4a <read+0x58>
+  800d26:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d29:	83 e0 03             	and    $0x3,%eax
+  800d2c:	83 f8 01             	cmp    $0x1,%eax
+  800d2f:	74 20                	je     800d51 <read+0x5f>
+  800d31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d34:	8b 40 08             	mov    0x8(%eax),%eax
+  800d37:	85 c0                	test   %eax,%eax
+  800d39:	74 37                	je     800d72 <read+0x80>
+  800d3b:	83 ec 04             	sub    $0x4,%esp
+  800d3e:	ff 75 10             	push   0x10(%ebp)
+  800d41:	ff 75 0c             	push   0xc(%ebp)
+  800d44:	53                   	push   %ebx
+  800d45:	ff d0                	call   *%eax
+  800d47:	83 c4 10             	add    $0x10,%esp
+  800d4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+  800d51:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d56:	8b 40 48             	mov    0x48(%eax),%eax
+  800d59:	83 ec 04             	sub    $0x4,%esp
+  800d5c:	56                   	push   %esi
+  800d5d:	50                   	push   %eax
+  800d5e:	68 f9 31 80 00       	push   $0x8031f9
+  800d63:	e8 eb 14 00 00       	call   802253 <cprintf>
+  800d68:	83 c4 10             	add    $0x10,%esp
+  800d6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d70:	eb d8                	jmp    800d4a <read+0x58>
+  800d72:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d77:	eb d1                	jmp    800d4a <read+0x58>
+
+00800d79 <readn>:
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	57                   	push   %edi
+  800d7d:	56                   	push   %esi
+  800d7e:	53                   	push   %ebx
+  800d7f:	83 ec 0c             	sub    $0xc,%esp
+  800d82:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d85:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d88:	85 f6                	test   %esi,%esi
+  800d8a:	74 30                	je     800dbc <readn+0x43>
+  800d8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d96:	83 ec 04             	sub    $0x4,%esp
+  800d99:	89 f2                	mov    %esi,%edx
+  800d9b:	29 c2                	sub    %eax,%edx
+  800d9d:	52                   	push   %edx
+  800d9e:	01 f8                	add    %edi,%eax
+  800da0:	50                   	push   %eax
+  800da1:	ff 75 08             	push   0x8(%ebp)
+  800da4:	e8 49 ff ff ff       	call   800cf2 <read>
+  800da9:	83 c4 10             	add    $0x10,%esp
+  800dac:	85 c0                	test   %eax,%eax
+  800dae:	78 15                	js     800dc5 <readn+0x4c>
+  800db0:	74 11                	je     800dc3 <readn+0x4a>
+  800db2:	01 c3                	add    %eax,%ebx
+  800db4:	89 d8                	mov    %ebx,%eax
+  800db6:	39 f3                	cmp    %esi,%ebx
+  800db8:	72 dc                	jb     800d96 <readn+0x1d>
+  800dba:	eb 09                	jmp    800dc5 <readn+0x4c>
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	eb 02                	jmp    800dc5 <readn+0x4c>
+  800dc3:	89 d8                	mov    %ebx,%eax
+  800dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc8:	5b                   	pop    %ebx
+  800dc9:	5e                   	pop    %esi
+  800dca:	5f                   	pop    %edi
+  800dcb:	5d                   	pop    %ebp
+  800dcc:	c3                   	ret
+
+00800dcd <write>:
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	56                   	push   %esi
+  800dd1:	53                   	push   %ebx
+  800dd2:	83 ec 18             	sub    $0x18,%esp
+  800dd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dd8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ddb:	50                   	push   %eax
+  800ddc:	53                   	push   %ebx
+  800ddd:	e8 ae fc ff ff       	call   800a90 <fd_lookup>
+  800de2:	83 c4 10             	add    $0x10,%esp
+  800de5:	85 c0                	test   %eax,%eax
+  800de7:	78 37                	js     800e20 <write+0x53>
+  800de9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800dec:	83 ec 08             	sub    $0x8,%esp
+  800def:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800df2:	50                   	push   %eax
+  800df3:	ff 36                	push   (%esi)
+  800df5:	e8 e6 fc ff ff       	call   800ae0 <dev_lookup>
+  800dfa:	83 c4 10             	add    $0x10,%esp
+  800dfd:	85 c0                	test   %eax,%eax
+  800dff:	78 1f                	js     800e20 <write+0x53>
+  800e01:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e05:	74 20                	je     800e27 <write+0x5a>
+  800e07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e0a:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e0d:	85 c0                	test   %eax,%eax
+  800e0f:	74 37                	je     800e48 <write+0x7b>
+  800e11:	83 ec 04             	sub    $0x4,%esp
+  800e14:	ff 75 10             	push   0x10(%ebp)
+  800e17:	ff 75 0c             	push   0xc(%ebp)
+  800e1a:	56                   	push   %esi
+  800e1b:	ff d0                	call   *%eax
+  800e1d:	83 c4 10             	add    $0x10,%esp
+  800e20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e23:	5b                   	pop    %ebx
+  800e24:	5e                   	pop    %esi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+  800e27:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e2c:	8b 40 48             	mov    0x48(%eax),%eax
+  800e2f:	83 ec 04             	sub    $0x4,%esp
+  800e32:	53                   	push   %ebx
+  800e33:	50                   	push   %eax
+  800e34:	68 15 32 80 00       	push   $0x803215
+  800e39:	e8 15 14 00 00       	call   802253 <cprintf>
+  800e3e:	83 c4 10             	add    $0x10,%esp
+  800e41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e46:	eb d8                	jmp    800e20 <write+0x53>
+  800e48:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e4d:	eb d1                	jmp    800e20 <write+0x53>
+
+00800e4f <seek>:
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	83 ec 20             	sub    $0x20,%esp
+  800e55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e58:	50                   	push   %eax
+  800e59:	ff 75 08             	push   0x8(%ebp)
+  800e5c:	e8 2f fc ff ff       	call   800a90 <fd_lookup>
+  800e61:	83 c4 10             	add    $0x10,%esp
+  800e64:	85 c0                	test   %eax,%eax
+  800e66:	78 0e                	js     800e76 <seek+0x27>
+  800e68:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e6e:	89 50 04             	mov    %edx,0x4(%eax)
+  800e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+
+00800e78 <ftruncate>:
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+  800e7d:	83 ec 18             	sub    $0x18,%esp
+  800e80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e86:	50                   	push   %eax
+  800e87:	53                   	push   %ebx
+  800e88:	e8 03 fc ff ff       	call   800a90 <fd_lookup>
+  800e8d:	83 c4 10             	add    $0x10,%esp
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	78 34                	js     800ec8 <ftruncate+0x50>
+  800e94:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e97:	83 ec 08             	sub    $0x8,%esp
+  800e9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e9d:	50                   	push   %eax
+  800e9e:	ff 36                	push   (%esi)
+  800ea0:	e8 3b fc ff ff       	call   800ae0 <dev_lookup>
+  800ea5:	83 c4 10             	add    $0x10,%esp
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	78 1c                	js     800ec8 <ftruncate+0x50>
+  800eac:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800eb0:	74 1d                	je     800ecf <ftruncate+0x57>
+  800eb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb5:	8b 40 18             	mov    0x18(%eax),%eax
+  800eb8:	85 c0                	test   %eax,%eax
+  800eba:	74 34                	je     800ef0 <ftruncate+0x78>
+  800ebc:	83 ec 08             	sub    $0x8,%esp
+  800ebf:	ff 75 0c             	push   0xc(%ebp)
+  800ec2:	56                   	push   %esi
+  800ec3:	ff d0                	call   *%eax
+  800ec5:	83 c4 10             	add    $0x10,%esp
+  800ec8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ecb:	5b                   	pop    %ebx
+  800ecc:	5e                   	pop    %esi
+  800ecd:	5d                   	pop    %ebp
+  800ece:	c3                   	ret
+  800ecf:	a1 10 50 80 00       	mov    0x805010,%eax
+  800ed4:	8b 40 48             	mov    0x48(%eax),%eax
+  800ed7:	83 ec 04             	sub    $0x4,%esp
+  800eda:	53                   	push   %ebx
+  800edb:	50                   	push   %eax
+  800edc:	68 d8 31 80 00       	push   $0x8031d8
+  800ee1:	e8 6d 13 00 00       	call   802253 <cprintf>
+  800ee6:	83 c4 10             	add    $0x10,%esp
+  800ee9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eee:	eb d8                	jmp    800ec8 <ftruncate+0x50>
+  800ef0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ef5:	eb d1                	jmp    800ec8 <ftruncate+0x50>
+
+00800ef7 <fstat>:
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	56                   	push   %esi
+  800efb:	53                   	push   %ebx
+  800efc:	83 ec 18             	sub    $0x18,%esp
+  800eff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f02:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f05:	50                   	push   %eax
+  800f06:	ff 75 08             	push   0x8(%ebp)
+  800f09:	e8 82 fb ff ff       	call   800a90 <fd_lookup>
+  800f0e:	83 c4 10             	add    $0x10,%esp
+  800f11:	85 c0                	test   %eax,%eax
+  800f13:	78 49                	js     800f5e <fstat+0x67>
+  800f15:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f18:	83 ec 08             	sub    $0x8,%esp
+  800f1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f1e:	50                   	push   %eax
+  800f1f:	ff 36                	push   (%esi)
+  800f21:	e8 ba fb ff ff       	call   800ae0 <dev_lookup>
+  800f26:	83 c4 10             	add    $0x10,%esp
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	78 31                	js     800f5e <fstat+0x67>
+  800f2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f30:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f34:	74 2f                	je     800f65 <fstat+0x6e>
+  800f36:	c6 03 00             	movb   $0x0,(%ebx)
+  800f39:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f40:	00 00 00 
+  800f43:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f4a:	00 00 00 
+  800f4d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f53:	83 ec 08             	sub    $0x8,%esp
+  800f56:	53                   	push   %ebx
+  800f57:	56                   	push   %esi
+  800f58:	ff 50 14             	call   *0x14(%eax)
+  800f5b:	83 c4 10             	add    $0x10,%esp
+  800f5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f61:	5b                   	pop    %ebx
+  800f62:	5e                   	pop    %esi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+  800f65:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f6a:	eb f2                	jmp    800f5e <fstat+0x67>
+
+00800f6c <stat>:
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+  800f71:	83 ec 08             	sub    $0x8,%esp
+  800f74:	6a 00                	push   $0x0
+  800f76:	ff 75 08             	push   0x8(%ebp)
+  800f79:	e8 31 05 00 00       	call   8014af <open>
+  800f7e:	89 c3                	mov    %eax,%ebx
+  800f80:	83 c4 10             	add    $0x10,%esp
+  800f83:	85 c0                	test   %eax,%eax
+  800f85:	78 1b                	js     800fa2 <stat+0x36>
+  800f87:	83 ec 08             	sub    $0x8,%esp
+  800f8a:	ff 75 0c             	push   0xc(%ebp)
+  800f8d:	50                   	push   %eax
+  800f8e:	e8 64 ff ff ff       	call   800ef7 <fstat>
+  800f93:	89 c6                	mov    %eax,%esi
+  800f95:	89 1c 24             	mov    %ebx,(%esp)
+  800f98:	e8 19 fc ff ff       	call   800bb6 <close>
+  800f9d:	83 c4 10             	add    $0x10,%esp
+  800fa0:	89 f3                	mov    %esi,%ebx
+  800fa2:	89 d8                	mov    %ebx,%eax
+  800fa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fa7:	5b                   	pop    %ebx
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+
+00800fab <fsipc>:
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	56                   	push   %esi
+  800faf:	53                   	push   %ebx
+  800fb0:	89 c3                	mov    %eax,%ebx
+  800fb2:	89 d6                	mov    %edx,%esi
+  800fb4:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800fbb:	74 20                	je     800fdd <fsipc+0x32>
+  800fbd:	83 ec 08             	sub    $0x8,%esp
+  800fc0:	6a 00                	push   $0x0
+  800fc2:	56                   	push   %esi
+  800fc3:	6a 07                	push   $0x7
+  800fc5:	68 00 60 80 00       	push   $0x806000
+  800fca:	53                   	push   %ebx
+  800fcb:	ff 35 08 50 80 00    	push   0x805008
+  800fd1:	e8 a4 1d 00 00       	call   802d7a <ipc_call>
+  800fd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+  800fdd:	83 ec 0c             	sub    $0xc,%esp
+  800fe0:	6a 02                	push   $0x2
+  800fe2:	e8 2e 1f 00 00       	call   802f15 <ipc_find_env>
+  800fe7:	a3 08 50 80 00       	mov    %eax,0x805008
+  800fec:	83 c4 10             	add    $0x10,%esp
+  800fef:	eb cc                	jmp    800fbd <fsipc+0x12>
+
+00800ff1 <devfile_trunc>:
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	83 ec 08             	sub    $0x8,%esp
+  800ff7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ffa:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ffd:	a3 00 60 80 00       	mov    %eax,0x806000
+  801002:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801005:	a3 04 60 80 00       	mov    %eax,0x806004
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801014:	e8 92 ff ff ff       	call   800fab <fsipc>
+  801019:	c9                   	leave
+  80101a:	c3                   	ret
+
+0080101b <devfile_flush>:
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	83 ec 08             	sub    $0x8,%esp
+  801021:	8b 45 08             	mov    0x8(%ebp),%eax
+  801024:	8b 40 0c             	mov    0xc(%eax),%eax
+  801027:	a3 00 60 80 00       	mov    %eax,0x806000
+  80102c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801031:	b8 08 00 00 00       	mov    $0x8,%eax
+  801036:	e8 70 ff ff ff       	call   800fab <fsipc>
+  80103b:	c9                   	leave
+  80103c:	c3                   	ret
+
+0080103d <devfile_stat>:
+  80103d:	55                   	push   %ebp
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	53                   	push   %ebx
+  801041:	83 ec 04             	sub    $0x4,%esp
+  801044:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801047:	8b 45 08             	mov    0x8(%ebp),%eax
+  80104a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80104d:	a3 00 60 80 00       	mov    %eax,0x806000
+  801052:	ba 00 00 00 00       	mov    $0x0,%edx
+  801057:	b8 07 00 00 00       	mov    $0x7,%eax
+  80105c:	e8 4a ff ff ff       	call   800fab <fsipc>
+  801061:	85 c0                	test   %eax,%eax
+  801063:	78 2c                	js     801091 <devfile_stat+0x54>
+  801065:	83 ec 08             	sub    $0x8,%esp
+  801068:	68 00 60 80 00       	push   $0x806000
+  80106d:	53                   	push   %ebx
+  80106e:	e8 d7 18 00 00       	call   80294a <strcpy>
+  801073:	a1 80 60 80 00       	mov    0x806080,%eax
+  801078:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80107e:	a1 84 60 80 00       	mov    0x806084,%eax
+  801083:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801089:	83 c4 10             	add    $0x10,%esp
+  80108c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801094:	c9                   	leave
+  801095:	c3                   	ret
+
+00801096 <fsring_rw>:
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	57                   	push   %edi
+  80109a:	56                   	push   %esi
+  80109b:	53                   	push   %ebx
+  80109c:	83 ec 2c             	sub    $0x2c,%esp
+  80109f:	89 c7                	mov    %eax,%edi
+  8010a1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8010a4:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8010a7:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8010ac:	a8 01                	test   $0x1,%al
+  8010ae:	74 0d                	je     8010bd <fsring_rw+0x27>
+  8010b0:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010b5:	a8 01                	test   $0x1,%al
+  8010b7:	0f 85 d5 00 00 00    	jne    801192 <fsring_rw+0xfc>
+  8010bd:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8010c5:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010cb:	0f 84 fc 00 00 00    	je     8011cd <fsring_rw+0x137>
+  8010d1:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010d8:	0f 84 02 01 00 00    	je     8011e0 <fsring_rw+0x14a>
+  8010de:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010e3:	83 ec 04             	sub    $0x4,%esp
+  8010e6:	68 07 02 00 00       	push   $0x207
+  8010eb:	53                   	push   %ebx
+  8010ec:	6a 00                	push   $0x0
+  8010ee:	e8 b8 f0 ff ff       	call   8001ab <sys_page_alloc>
+  8010f3:	83 c4 10             	add    $0x10,%esp
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	0f 88 f9 00 00 00    	js     8011f7 <fsring_rw+0x161>
+  8010fe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801104:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80110a:	75 d7                	jne    8010e3 <fsring_rw+0x4d>
+  80110c:	6a 0e                	push   $0xe
+  80110e:	6a 0d                	push   $0xd
+  801110:	ff 35 08 50 80 00    	push   0x805008
+  801116:	68 00 00 f0 cf       	push   $0xcff00000
+  80111b:	e8 c4 0c 00 00       	call   801de4 <ipcring_init>
+  801120:	83 c4 08             	add    $0x8,%esp
+  801123:	6a 00                	push   $0x0
+  801125:	6a 00                	push   $0x0
+  801127:	68 07 02 00 00       	push   $0x207
+  80112c:	68 00 00 f0 cf       	push   $0xcff00000
+  801131:	6a 0b                	push   $0xb
+  801133:	ff 35 08 50 80 00    	push   0x805008
+  801139:	e8 3c 1c 00 00       	call   802d7a <ipc_call>
+  80113e:	89 c6                	mov    %eax,%esi
+  801140:	83 c4 20             	add    $0x20,%esp
+  801143:	85 c0                	test   %eax,%eax
+  801145:	0f 88 ac 00 00 00    	js     8011f7 <fsring_rw+0x161>
+  80114b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801150:	89 d9                	mov    %ebx,%ecx
+  801152:	83 c3 01             	add    $0x1,%ebx
+  801155:	89 da                	mov    %ebx,%edx
+  801157:	c1 e2 0c             	shl    $0xc,%edx
+  80115a:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801160:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801166:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80116c:	83 ec 08             	sub    $0x8,%esp
+  80116f:	6a 00                	push   $0x0
+  801171:	6a 00                	push   $0x0
+  801173:	68 07 02 00 00       	push   $0x207
+  801178:	50                   	push   %eax
+  801179:	6a 0c                	push   $0xc
+  80117b:	ff 35 08 50 80 00    	push   0x805008
+  801181:	e8 f4 1b 00 00       	call   802d7a <ipc_call>
+  801186:	83 c4 20             	add    $0x20,%esp
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	78 6a                	js     8011f7 <fsring_rw+0x161>
+  80118d:	83 fb 08             	cmp    $0x8,%ebx
+  801190:	75 be                	jne    801150 <fsring_rw+0xba>
+  801192:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801196:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80119b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8011a0:	0f 45 c2             	cmovne %edx,%eax
+  8011a3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011a6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8011ad:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c5:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011c8:	e9 4b 01 00 00       	jmp    801318 <fsring_rw+0x282>
+  8011cd:	e8 a3 f3 ff ff       	call   800575 <sys_time_msec>
+  8011d2:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011d8:	0f 89 f3 fe ff ff    	jns    8010d1 <fsring_rw+0x3b>
+  8011de:	eb 54                	jmp    801234 <fsring_rw+0x19e>
+  8011e0:	83 ec 0c             	sub    $0xc,%esp
+  8011e3:	6a 02                	push   $0x2
+  8011e5:	e8 2b 1d 00 00       	call   802f15 <ipc_find_env>
+  8011ea:	a3 08 50 80 00       	mov    %eax,0x805008
+  8011ef:	83 c4 10             	add    $0x10,%esp
+  8011f2:	e9 e7 fe ff ff       	jmp    8010de <fsring_rw+0x48>
+  8011f7:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8011fc:	83 ec 08             	sub    $0x8,%esp
+  8011ff:	53                   	push   %ebx
+  801200:	6a 00                	push   $0x0
+  801202:	e8 76 f0 ff ff       	call   80027d <sys_page_unmap>
+  801207:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80120d:	83 c4 10             	add    $0x10,%esp
+  801210:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801216:	75 e4                	jne    8011fc <fsring_rw+0x166>
+  801218:	e8 58 f3 ff ff       	call   800575 <sys_time_msec>
+  80121d:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801222:	a3 00 50 80 00       	mov    %eax,0x805000
+  801227:	a1 10 50 80 00       	mov    0x805010,%eax
+  80122c:	8b 40 48             	mov    0x48(%eax),%eax
+  80122f:	a3 04 50 80 00       	mov    %eax,0x805004
+  801234:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80123b:	e9 7a 01 00 00       	jmp    8013ba <fsring_rw+0x324>
+  801240:	8b 57 0c             	mov    0xc(%edi),%edx
+  801243:	89 10                	mov    %edx,(%eax)
+  801245:	89 58 04             	mov    %ebx,0x4(%eax)
+  801248:	89 f2                	mov    %esi,%edx
+  80124a:	03 57 04             	add    0x4(%edi),%edx
+  80124d:	89 50 08             	mov    %edx,0x8(%eax)
+  801250:	83 ec 04             	sub    $0x4,%esp
+  801253:	53                   	push   %ebx
+  801254:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801257:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80125a:	52                   	push   %edx
+  80125b:	83 c0 0c             	add    $0xc,%eax
+  80125e:	50                   	push   %eax
+  80125f:	e8 96 18 00 00       	call   802afa <memmove>
+  801264:	83 c4 10             	add    $0x10,%esp
+  801267:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80126a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80126d:	89 08                	mov    %ecx,(%eax)
+  80126f:	83 ec 0c             	sub    $0xc,%esp
+  801272:	68 00 00 f0 cf       	push   $0xcff00000
+  801277:	e8 c6 0b 00 00       	call   801e42 <ipcring_req_push>
+  80127c:	01 de                	add    %ebx,%esi
+  80127e:	83 c4 10             	add    $0x10,%esp
+  801281:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801284:	73 4c                	jae    8012d2 <fsring_rw+0x23c>
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	68 00 00 f0 cf       	push   $0xcff00000
+  80128e:	e8 89 0b 00 00       	call   801e1c <ipcring_req_slot>
+  801293:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801296:	83 c4 10             	add    $0x10,%esp
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	74 35                	je     8012d2 <fsring_rw+0x23c>
+  80129d:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8012a2:	83 e0 07             	and    $0x7,%eax
+  8012a5:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8012aa:	c1 e0 0c             	shl    $0xc,%eax
+  8012ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012b0:	29 f3                	sub    %esi,%ebx
+  8012b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012b5:	39 cb                	cmp    %ecx,%ebx
+  8012b7:	0f 47 d9             	cmova  %ecx,%ebx
+  8012ba:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012be:	75 80                	jne    801240 <fsring_rw+0x1aa>
+  8012c0:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012c3:	89 10                	mov    %edx,(%eax)
+  8012c5:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012c8:	89 f2                	mov    %esi,%edx
+  8012ca:	03 57 04             	add    0x4(%edi),%edx
+  8012cd:	89 50 08             	mov    %edx,0x8(%eax)
+  8012d0:	eb 95                	jmp    801267 <fsring_rw+0x1d1>
+  8012d2:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012da:	83 ec 0c             	sub    $0xc,%esp
+  8012dd:	68 00 00 f0 cf       	push   $0xcff00000
+  8012e2:	e8 94 0b 00 00       	call   801e7b <ipcring_rsp_wait>
+  8012e7:	8b 58 04             	mov    0x4(%eax),%ebx
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8012f1:	75 45                	jne    801338 <fsring_rw+0x2a2>
+  8012f3:	85 db                	test   %ebx,%ebx
+  8012f5:	79 41                	jns    801338 <fsring_rw+0x2a2>
+  8012f7:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8012fa:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801301:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801308:	83 ec 0c             	sub    $0xc,%esp
+  80130b:	68 00 00 f0 cf       	push   $0xcff00000
+  801310:	e8 cc 0b 00 00       	call   801ee1 <ipcring_rsp_pop>
+  801315:	83 c4 10             	add    $0x10,%esp
+  801318:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80131e:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801323:	39 c2                	cmp    %eax,%edx
+  801325:	74 75                	je     80139c <fsring_rw+0x306>
+  801327:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80132b:	75 a5                	jne    8012d2 <fsring_rw+0x23c>
+  80132d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801330:	0f 82 50 ff ff ff    	jb     801286 <fsring_rw+0x1f0>
+  801336:	eb 9a                	jmp    8012d2 <fsring_rw+0x23c>
+  801338:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80133c:	75 ca                	jne    801308 <fsring_rw+0x272>
+  80133e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801342:	74 31                	je     801375 <fsring_rw+0x2df>
+  801344:	8b 45 08             	mov    0x8(%ebp),%eax
+  801347:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80134a:	29 c8                	sub    %ecx,%eax
+  80134c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80134f:	39 d0                	cmp    %edx,%eax
+  801351:	0f 47 c2             	cmova  %edx,%eax
+  801354:	39 d8                	cmp    %ebx,%eax
+  801356:	ba 01 00 00 00       	mov    $0x1,%edx
+  80135b:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80135f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801362:	b8 01 00 00 00       	mov    $0x1,%eax
+  801367:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80136b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80136e:	01 d9                	add    %ebx,%ecx
+  801370:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801373:	eb 93                	jmp    801308 <fsring_rw+0x272>
+  801375:	83 ec 04             	sub    $0x4,%esp
+  801378:	53                   	push   %ebx
+  801379:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80137c:	83 e0 07             	and    $0x7,%eax
+  80137f:	c1 e0 0c             	shl    $0xc,%eax
+  801382:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801388:	50                   	push   %eax
+  801389:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80138c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80138f:	01 c8                	add    %ecx,%eax
+  801391:	50                   	push   %eax
+  801392:	e8 63 17 00 00       	call   802afa <memmove>
+  801397:	83 c4 10             	add    $0x10,%esp
+  80139a:	eb a8                	jmp    801344 <fsring_rw+0x2ae>
+  80139c:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8013a0:	75 09                	jne    8013ab <fsring_rw+0x315>
+  8013a2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8013a5:	0f 82 db fe ff ff    	jb     801286 <fsring_rw+0x1f0>
+  8013ab:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8013ae:	01 57 04             	add    %edx,0x4(%edi)
+  8013b1:	85 d2                	test   %edx,%edx
+  8013b3:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013b7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013ba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c0:	5b                   	pop    %ebx
+  8013c1:	5e                   	pop    %esi
+  8013c2:	5f                   	pop    %edi
+  8013c3:	5d                   	pop    %ebp
+  8013c4:	c3                   	ret
+
+008013c5 <devfile_write>:
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	57                   	push   %edi
+  8013c9:	56                   	push   %esi
+  8013ca:	53                   	push   %ebx
+  8013cb:	83 ec 0c             	sub    $0xc,%esp
+  8013ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d7:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013dd:	76 1a                	jbe    8013f9 <devfile_write+0x34>
+  8013df:	83 ec 0c             	sub    $0xc,%esp
+  8013e2:	53                   	push   %ebx
+  8013e3:	89 f1                	mov    %esi,%ecx
+  8013e5:	ba 06 00 00 00       	mov    $0x6,%edx
+  8013ea:	89 f8                	mov    %edi,%eax
+  8013ec:	e8 a5 fc ff ff       	call   801096 <fsring_rw>
+  8013f1:	83 c4 10             	add    $0x10,%esp
+  8013f4:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013f7:	75 39                	jne    801432 <devfile_write+0x6d>
+  8013f9:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8013fe:	39 c3                	cmp    %eax,%ebx
+  801400:	0f 47 d8             	cmova  %eax,%ebx
+  801403:	8b 47 0c             	mov    0xc(%edi),%eax
+  801406:	a3 00 60 80 00       	mov    %eax,0x806000
+  80140b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801411:	83 ec 04             	sub    $0x4,%esp
+  801414:	53                   	push   %ebx
+  801415:	56                   	push   %esi
+  801416:	68 08 60 80 00       	push   $0x806008
+  80141b:	e8 da 16 00 00       	call   802afa <memmove>
+  801420:	ba 00 00 00 00       	mov    $0x0,%edx
+  801425:	b8 04 00 00 00       	mov    $0x4,%eax
+  80142a:	e8 7c fb ff ff       	call   800fab <fsipc>
+  80142f:	83 c4 10             	add    $0x10,%esp
+  801432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801435:	5b                   	pop    %ebx
+  801436:	5e                   	pop    %esi
+  801437:	5f                   	pop    %edi
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+
+0080143a <devfile_read>:
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	57                   	push   %edi
+  80143e:	56                   	push   %esi
+  80143f:	53                   	push   %ebx
+  801440:	83 ec 0c             	sub    $0xc,%esp
+  801443:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801446:	8b 75 10             	mov    0x10(%ebp),%esi
+  801449:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80144f:	76 1d                	jbe    80146e <devfile_read+0x34>
+  801451:	83 ec 0c             	sub    $0xc,%esp
+  801454:	56                   	push   %esi
+  801455:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801458:	ba 05 00 00 00       	mov    $0x5,%edx
+  80145d:	89 f8                	mov    %edi,%eax
+  80145f:	e8 32 fc ff ff       	call   801096 <fsring_rw>
+  801464:	89 c3                	mov    %eax,%ebx
+  801466:	83 c4 10             	add    $0x10,%esp
+  801469:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80146c:	75 37                	jne    8014a5 <devfile_read+0x6b>
+  80146e:	8b 47 0c             	mov    0xc(%edi),%eax
+  801471:	a3 00 60 80 00       	mov    %eax,0x806000
+  801476:	89 35 04 60 80 00    	mov    %esi,0x806004
+  80147c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801481:	b8 03 00 00 00       	mov    $0x3,%eax
+  801486:	e8 20 fb ff ff       	call   800fab <fsipc>
+  80148b:	89 c3                	mov    %eax,%ebx
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	78 14                	js     8014a5 <devfile_read+0x6b>
+  801491:	83 ec 04             	sub    $0x4,%esp
+  801494:	50                   	push   %eax
+  801495:	68 00 60 80 00       	push   $0x806000
+  80149a:	ff 75 0c             	push   0xc(%ebp)
+  80149d:	e8 58 16 00 00       	call   802afa <memmove>
+  8014a2:	83 c4 10             	add    $0x10,%esp
+  8014a5:	89 d8                	mov    %ebx,%eax
+  8014a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+
+008014af <open>:
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+  8014b4:	83 ec 1c             	sub    $0x1c,%esp
+  8014b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ba:	56                   	push   %esi
+  8014bb:	e8 3e 14 00 00       	call   8028fe <strlen>
+  8014c0:	83 c4 10             	add    $0x10,%esp
+  8014c3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014c8:	7f 6c                	jg     801536 <open+0x87>
+  8014ca:	83 ec 0c             	sub    $0xc,%esp
+  8014cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d0:	50                   	push   %eax
+  8014d1:	e8 6a f5 ff ff       	call   800a40 <fd_alloc>
+  8014d6:	89 c3                	mov    %eax,%ebx
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	78 3c                	js     80151b <open+0x6c>
+  8014df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014e2:	a3 00 64 80 00       	mov    %eax,0x806400
+  8014e7:	83 ec 08             	sub    $0x8,%esp
+  8014ea:	56                   	push   %esi
+  8014eb:	68 00 60 80 00       	push   $0x806000
+  8014f0:	e8 55 14 00 00       	call   80294a <strcpy>
+  8014f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014fd:	e8 a9 fa ff ff       	call   800fab <fsipc>
+  801502:	89 c3                	mov    %eax,%ebx
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	85 c0                	test   %eax,%eax
+  801509:	78 19                	js     801524 <open+0x75>
+  80150b:	83 ec 0c             	sub    $0xc,%esp
+  80150e:	ff 75 f4             	push   -0xc(%ebp)
+  801511:	e8 03 f5 ff ff       	call   800a19 <fd2num>
+  801516:	89 c3                	mov    %eax,%ebx
+  801518:	83 c4 10             	add    $0x10,%esp
+  80151b:	89 d8                	mov    %ebx,%eax
+  80151d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801520:	5b                   	pop    %ebx
+  801521:	5e                   	pop    %esi
+  801522:	5d                   	pop    %ebp
+  801523:	c3                   	ret
+  801524:	83 ec 08             	sub    $0x8,%esp
+  801527:	6a 00                	push   $0x0
+  801529:	ff 75 f4             	push   -0xc(%ebp)
+  80152c:	e8 05 f6 ff ff       	call   800b36 <fd_close>
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	eb e5                	jmp    80151b <open+0x6c>
+  801536:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80153b:	eb de                	jmp    80151b <open+0x6c>
+
+0080153d <file_image>:
+  80153d:	55                   	push   %ebp
+  80153e:	89 e5                	mov    %esp,%ebp
+  801540:	53                   	push   %ebx
+  801541:	83 ec 1c             	sub    $0x1c,%esp
+  801544:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801547:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154a:	50                   	push   %eax
+  80154b:	ff 75 08             	push   0x8(%ebp)
+  80154e:	e8 3d f5 ff ff       	call   800a90 <fd_lookup>
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	85 c0                	test   %eax,%eax
+  801558:	78 58                	js     8015b2 <file_image+0x75>
+  80155a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80155d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801563:	39 08                	cmp    %ecx,(%eax)
+  801565:	75 50                	jne    8015b7 <file_image+0x7a>
+  801567:	83 fb 04             	cmp    $0x4,%ebx
+  80156a:	77 52                	ja     8015be <file_image+0x81>
+  80156c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80156f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801574:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80157a:	83 ec 04             	sub    $0x4,%esp
+  80157d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  801580:	c1 e0 02             	shl    $0x2,%eax
+  801583:	50                   	push   %eax
+  801584:	ff 75 0c             	push   0xc(%ebp)
+  801587:	68 08 60 80 00       	push   $0x806008
+  80158c:	e8 69 15 00 00       	call   802afa <memmove>
+  801591:	ba 00 00 00 00       	mov    $0x0,%edx
+  801596:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80159b:	e8 0b fa ff ff       	call   800fab <fsipc>
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	78 0b                	js     8015b2 <file_image+0x75>
+  8015a7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8015aa:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8015b0:	89 0a                	mov    %ecx,(%edx)
+  8015b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+  8015b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015bc:	eb f4                	jmp    8015b2 <file_image+0x75>
+  8015be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c3:	eb ed                	jmp    8015b2 <file_image+0x75>
+
+008015c5 <remove>:
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	53                   	push   %ebx
+  8015c9:	83 ec 10             	sub    $0x10,%esp
+  8015cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015cf:	53                   	push   %ebx
+  8015d0:	e8 29 13 00 00       	call   8028fe <strlen>
+  8015d5:	83 c4 10             	add    $0x10,%esp
+  8015d8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015dd:	7f 25                	jg     801604 <remove+0x3f>
+  8015df:	83 ec 08             	sub    $0x8,%esp
+  8015e2:	53                   	push   %ebx
+  8015e3:	68 00 60 80 00       	push   $0x806000
+  8015e8:	e8 5d 13 00 00       	call   80294a <strcpy>
+  8015ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015f7:	e8 af f9 ff ff       	call   800fab <fsipc>
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801602:	c9                   	leave
+  801603:	c3                   	ret
+  801604:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801609:	eb f4                	jmp    8015ff <remove+0x3a>
+
+0080160b <sync>:
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	83 ec 08             	sub    $0x8,%esp
+  801611:	ba 00 00 00 00       	mov    $0x0,%edx
+  801616:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80161b:	e8 8b f9 ff ff       	call   800fab <fsipc>
+  801620:	c9                   	leave
+  801621:	c3                   	ret
+
+00801622 <devsock_stat>:
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	83 ec 10             	sub    $0x10,%esp
+  801628:	68 48 32 80 00       	push   $0x803248
+  80162d:	ff 75 0c             	push   0xc(%ebp)
+  801630:	e8 15 13 00 00       	call   80294a <strcpy>
+  801635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+
+0080163c <devsock_close>:
+  80163c:	55                   	push   %ebp
+  80163d:	89 e5                	mov    %esp,%ebp
+  80163f:	53                   	push   %ebx
+  801640:	83 ec 10             	sub    $0x10,%esp
+  801643:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801646:	53                   	push   %ebx
+  801647:	e8 e3 18 00 00       	call   802f2f <pageref>
+  80164c:	89 c2                	mov    %eax,%edx
+  80164e:	83 c4 10             	add    $0x10,%esp
+  801651:	b8 00 00 00 00       	mov    $0x0,%eax
+  801656:	83 fa 01             	cmp    $0x1,%edx
+  801659:	74 05                	je     801660 <devsock_close+0x24>
+  80165b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80165e:	c9                   	leave
+  80165f:	c3                   	ret
+  801660:	83 ec 0c             	sub    $0xc,%esp
+  801663:	ff 73 0c             	push   0xc(%ebx)
+  801666:	e8 aa 02 00 00       	call   801915 <nsipc_close>
+  80166b:	83 c4 10             	add    $0x10,%esp
+  80166e:	eb eb                	jmp    80165b <devsock_close+0x1f>
+
+00801670 <devsock_write>:
+  801670:	55                   	push   %ebp
+  801671:	89 e5                	mov    %esp,%ebp
+  801673:	83 ec 08             	sub    $0x8,%esp
+  801676:	6a 00                	push   $0x0
+  801678:	ff 75 10             	push   0x10(%ebp)
+  80167b:	ff 75 0c             	push   0xc(%ebp)
+  80167e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801681:	ff 70 0c             	push   0xc(%eax)
+  801684:	e8 6c 03 00 00       	call   8019f5 <nsipc_send>
+  801689:	c9                   	leave
+  80168a:	c3                   	ret
+
+0080168b <devsock_read>:
+  80168b:	55                   	push   %ebp
+  80168c:	89 e5                	mov    %esp,%ebp
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	6a 00                	push   $0x0
+  801693:	ff 75 10             	push   0x10(%ebp)
+  801696:	ff 75 0c             	push   0xc(%ebp)
+  801699:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169c:	ff 70 0c             	push   0xc(%eax)
+  80169f:	e8 e2 02 00 00       	call   801986 <nsipc_recv>
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+008016a6 <fd2sockid>:
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	83 ec 20             	sub    $0x20,%esp
+  8016ac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016af:	52                   	push   %edx
+  8016b0:	50                   	push   %eax
+  8016b1:	e8 da f3 ff ff       	call   800a90 <fd_lookup>
+  8016b6:	83 c4 10             	add    $0x10,%esp
+  8016b9:	85 c0                	test   %eax,%eax
+  8016bb:	78 10                	js     8016cd <fd2sockid+0x27>
+  8016bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c0:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016c6:	39 08                	cmp    %ecx,(%eax)
+  8016c8:	75 05                	jne    8016cf <fd2sockid+0x29>
+  8016ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+  8016cf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d4:	eb f7                	jmp    8016cd <fd2sockid+0x27>
+
+008016d6 <alloc_sockfd>:
+  8016d6:	55                   	push   %ebp
+  8016d7:	89 e5                	mov    %esp,%ebp
+  8016d9:	56                   	push   %esi
+  8016da:	53                   	push   %ebx
+  8016db:	83 ec 1c             	sub    $0x1c,%esp
+  8016de:	89 c6                	mov    %eax,%esi
+  8016e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e3:	50                   	push   %eax
+  8016e4:	e8 57 f3 ff ff       	call   800a40 <fd_alloc>
+  8016e9:	89 c3                	mov    %eax,%ebx
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	78 43                	js     801735 <alloc_sockfd+0x5f>
+  8016f2:	83 ec 04             	sub    $0x4,%esp
+  8016f5:	68 07 04 00 00       	push   $0x407
+  8016fa:	ff 75 f4             	push   -0xc(%ebp)
+  8016fd:	6a 00                	push   $0x0
+  8016ff:	e8 a7 ea ff ff       	call   8001ab <sys_page_alloc>
+  801704:	89 c3                	mov    %eax,%ebx
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	78 28                	js     801735 <alloc_sockfd+0x5f>
+  80170d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801710:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801716:	89 10                	mov    %edx,(%eax)
+  801718:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80171b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801722:	89 70 0c             	mov    %esi,0xc(%eax)
+  801725:	83 ec 0c             	sub    $0xc,%esp
+  801728:	50                   	push   %eax
+  801729:	e8 eb f2 ff ff       	call   800a19 <fd2num>
+  80172e:	89 c3                	mov    %eax,%ebx
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	eb 0c                	jmp    801741 <alloc_sockfd+0x6b>
+  801735:	83 ec 0c             	sub    $0xc,%esp
+  801738:	56                   	push   %esi
+  801739:	e8 d7 01 00 00       	call   801915 <nsipc_close>
+  80173e:	83 c4 10             	add    $0x10,%esp
+  801741:	89 d8                	mov    %ebx,%eax
+  801743:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801746:	5b                   	pop    %ebx
+  801747:	5e                   	pop    %esi
+  801748:	5d                   	pop    %ebp
+  801749:	c3                   	ret
+
+0080174a <accept>:
+  80174a:	55                   	push   %ebp
+  80174b:	89 e5                	mov    %esp,%ebp
+  80174d:	83 ec 08             	sub    $0x8,%esp
+  801750:	8b 45 08             	mov    0x8(%ebp),%eax
+  801753:	e8 4e ff ff ff       	call   8016a6 <fd2sockid>
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	78 1b                	js     801777 <accept+0x2d>
+  80175c:	83 ec 04             	sub    $0x4,%esp
+  80175f:	ff 75 10             	push   0x10(%ebp)
+  801762:	ff 75 0c             	push   0xc(%ebp)
+  801765:	50                   	push   %eax
+  801766:	e8 07 01 00 00       	call   801872 <nsipc_accept>
+  80176b:	83 c4 10             	add    $0x10,%esp
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	78 05                	js     801777 <accept+0x2d>
+  801772:	e8 5f ff ff ff       	call   8016d6 <alloc_sockfd>
+  801777:	c9                   	leave
+  801778:	c3                   	ret
+
+00801779 <bind>:
+  801779:	55                   	push   %ebp
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	83 ec 08             	sub    $0x8,%esp
+  80177f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801782:	e8 1f ff ff ff       	call   8016a6 <fd2sockid>
+  801787:	85 c0                	test   %eax,%eax
+  801789:	78 12                	js     80179d <bind+0x24>
+  80178b:	83 ec 04             	sub    $0x4,%esp
+  80178e:	ff 75 10             	push   0x10(%ebp)
+  801791:	ff 75 0c             	push   0xc(%ebp)
+  801794:	50                   	push   %eax
+  801795:	e8 24 01 00 00       	call   8018be <nsipc_bind>
+  80179a:	83 c4 10             	add    $0x10,%esp
+  80179d:	c9                   	leave
+  80179e:	c3                   	ret
+
+0080179f <shutdown>:
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+  8017a2:	83 ec 08             	sub    $0x8,%esp
+  8017a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a8:	e8 f9 fe ff ff       	call   8016a6 <fd2sockid>
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	78 0f                	js     8017c0 <shutdown+0x21>
+  8017b1:	83 ec 08             	sub    $0x8,%esp
+  8017b4:	ff 75 0c             	push   0xc(%ebp)
+  8017b7:	50                   	push   %eax
+  8017b8:	e8 36 01 00 00       	call   8018f3 <nsipc_shutdown>
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	c9                   	leave
+  8017c1:	c3                   	ret
+
+008017c2 <connect>:
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017cb:	e8 d6 fe ff ff       	call   8016a6 <fd2sockid>
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	78 12                	js     8017e6 <connect+0x24>
+  8017d4:	83 ec 04             	sub    $0x4,%esp
+  8017d7:	ff 75 10             	push   0x10(%ebp)
+  8017da:	ff 75 0c             	push   0xc(%ebp)
+  8017dd:	50                   	push   %eax
+  8017de:	e8 4c 01 00 00       	call   80192f <nsipc_connect>
+  8017e3:	83 c4 10             	add    $0x10,%esp
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+
+008017e8 <listen>:
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	83 ec 08             	sub    $0x8,%esp
+  8017ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f1:	e8 b0 fe ff ff       	call   8016a6 <fd2sockid>
+  8017f6:	85 c0                	test   %eax,%eax
+  8017f8:	78 0f                	js     801809 <listen+0x21>
+  8017fa:	83 ec 08             	sub    $0x8,%esp
+  8017fd:	ff 75 0c             	push   0xc(%ebp)
+  801800:	50                   	push   %eax
+  801801:	e8 5e 01 00 00       	call   801964 <nsipc_listen>
+  801806:	83 c4 10             	add    $0x10,%esp
+  801809:	c9                   	leave
+  80180a:	c3                   	ret
+
+0080180b <socket>:
+  80180b:	55                   	push   %ebp
+  80180c:	89 e5                	mov    %esp,%ebp
+  80180e:	83 ec 0c             	sub    $0xc,%esp
+  801811:	ff 75 10             	push   0x10(%ebp)
+  801814:	ff 75 0c             	push   0xc(%ebp)
+  801817:	ff 75 08             	push   0x8(%ebp)
+  80181a:	e8 34 02 00 00       	call   801a53 <nsipc_socket>
+  80181f:	83 c4 10             	add    $0x10,%esp
+  801822:	85 c0                	test   %eax,%eax
+  801824:	78 05                	js     80182b <socket+0x20>
+  801826:	e8 ab fe ff ff       	call   8016d6 <alloc_sockfd>
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+
+0080182d <nsipc>:
+  80182d:	55                   	push   %ebp
+  80182e:	89 e5                	mov    %esp,%ebp
+  801830:	53                   	push   %ebx
+  801831:	83 ec 04             	sub    $0x4,%esp
+  801834:	89 c3                	mov    %eax,%ebx
+  801836:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80183d:	74 1f                	je     80185e <nsipc+0x31>
+  80183f:	83 ec 08             	sub    $0x8,%esp
+  801842:	6a 00                	push   $0x0
+  801844:	6a 00                	push   $0x0
+  801846:	6a 07                	push   $0x7
+  801848:	68 00 70 80 00       	push   $0x807000
+  80184d:	53                   	push   %ebx
+  80184e:	ff 35 0c 50 80 00    	push   0x80500c
+  801854:	e8 21 15 00 00       	call   802d7a <ipc_call>
+  801859:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80185c:	c9                   	leave
+  80185d:	c3                   	ret
+  80185e:	83 ec 0c             	sub    $0xc,%esp
+  801861:	6a 03                	push   $0x3
+  801863:	e8 ad 16 00 00       	call   802f15 <ipc_find_env>
+  801868:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80186d:	83 c4 10             	add    $0x10,%esp
+  801870:	eb cd                	jmp    80183f <nsipc+0x12>
+
+00801872 <nsipc_accept>:
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	53                   	push   %ebx
+  801876:	83 ec 04             	sub    $0x4,%esp
+  801879:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801881:	b8 01 00 00 00       	mov    $0x1,%eax
+  801886:	e8 a2 ff ff ff       	call   80182d <nsipc>
+  80188b:	89 c3                	mov    %eax,%ebx
+  80188d:	85 c0                	test   %eax,%eax
+  80188f:	79 07                	jns    801898 <nsipc_accept+0x26>
+  801891:	89 d8                	mov    %ebx,%eax
+  801893:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801896:	c9                   	leave
+  801897:	c3                   	ret
+  801898:	83 ec 04             	sub    $0x4,%esp
+  80189b:	ff 35 10 70 80 00    	push   0x807010
+  8018a1:	68 00 70 80 00       	push   $0x807000
+  8018a6:	ff 75 0c             	push   0xc(%ebp)
+  8018a9:	e8 4c 12 00 00       	call   802afa <memmove>
+  8018ae:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018b4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018b7:	89 10                	mov    %edx,(%eax)
+  8018b9:	83 c4 10             	add    $0x10,%esp
+  8018bc:	eb d3                	jmp    801891 <nsipc_accept+0x1f>
+
+008018be <nsipc_bind>:
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	53                   	push   %ebx
+  8018c2:	83 ec 08             	sub    $0x8,%esp
+  8018c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cb:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018d0:	53                   	push   %ebx
+  8018d1:	ff 75 0c             	push   0xc(%ebp)
+  8018d4:	68 04 70 80 00       	push   $0x807004
+  8018d9:	e8 1c 12 00 00       	call   802afa <memmove>
+  8018de:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018e4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018e9:	e8 3f ff ff ff       	call   80182d <nsipc>
+  8018ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018f1:	c9                   	leave
+  8018f2:	c3                   	ret
+
+008018f3 <nsipc_shutdown>:
+  8018f3:	55                   	push   %ebp
+  8018f4:	89 e5                	mov    %esp,%ebp
+  8018f6:	83 ec 08             	sub    $0x8,%esp
+  8018f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fc:	a3 00 70 80 00       	mov    %eax,0x807000
+  801901:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801904:	a3 04 70 80 00       	mov    %eax,0x807004
+  801909:	b8 03 00 00 00       	mov    $0x3,%eax
+  80190e:	e8 1a ff ff ff       	call   80182d <nsipc>
+  801913:	c9                   	leave
+  801914:	c3                   	ret
+
+00801915 <nsipc_close>:
+  801915:	55                   	push   %ebp
+  801916:	89 e5                	mov    %esp,%ebp
+  801918:	83 ec 08             	sub    $0x8,%esp
+  80191b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191e:	a3 00 70 80 00       	mov    %eax,0x807000
+  801923:	b8 04 00 00 00       	mov    $0x4,%eax
+  801928:	e8 00 ff ff ff       	call   80182d <nsipc>
+  80192d:	c9                   	leave
+  80192e:	c3                   	ret
+
+0080192f <nsipc_connect>:
+  80192f:	55                   	push   %ebp
+  801930:	89 e5                	mov    %esp,%ebp
+  801932:	53                   	push   %ebx
+  801933:	83 ec 08             	sub    $0x8,%esp
+  801936:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801941:	53                   	push   %ebx
+  801942:	ff 75 0c             	push   0xc(%ebp)
+  801945:	68 04 70 80 00       	push   $0x807004
+  80194a:	e8 ab 11 00 00       	call   802afa <memmove>
+  80194f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801955:	b8 05 00 00 00       	mov    $0x5,%eax
+  80195a:	e8 ce fe ff ff       	call   80182d <nsipc>
+  80195f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801962:	c9                   	leave
+  801963:	c3                   	ret
+
+00801964 <nsipc_listen>:
+  801964:	55                   	push   %ebp
+  801965:	89 e5                	mov    %esp,%ebp
+  801967:	83 ec 08             	sub    $0x8,%esp
+  80196a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80196d:	a3 00 70 80 00       	mov    %eax,0x807000
+  801972:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801975:	a3 04 70 80 00       	mov    %eax,0x807004
+  80197a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80197f:	e8 a9 fe ff ff       	call   80182d <nsipc>
+  801984:	c9                   	leave
+  801985:	c3                   	ret
+
+00801986 <nsipc_recv>:
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	56                   	push   %esi
+  80198a:	53                   	push   %ebx
+  80198b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80198e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801991:	a3 00 70 80 00       	mov    %eax,0x807000
+  801996:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80199c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80199f:	a3 08 70 80 00       	mov    %eax,0x807008
+  8019a4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019a9:	e8 7f fe ff ff       	call   80182d <nsipc>
+  8019ae:	89 c3                	mov    %eax,%ebx
+  8019b0:	85 c0                	test   %eax,%eax
+  8019b2:	78 22                	js     8019d6 <nsipc_recv+0x50>
+  8019b4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019b9:	39 c6                	cmp    %eax,%esi
+  8019bb:	0f 4e c6             	cmovle %esi,%eax
+  8019be:	39 c3                	cmp    %eax,%ebx
+  8019c0:	7f 1d                	jg     8019df <nsipc_recv+0x59>
+  8019c2:	83 ec 04             	sub    $0x4,%esp
+  8019c5:	53                   	push   %ebx
+  8019c6:	68 00 70 80 00       	push   $0x807000
+  8019cb:	ff 75 0c             	push   0xc(%ebp)
+  8019ce:	e8 27 11 00 00       	call   802afa <memmove>
+  8019d3:	83 c4 10             	add    $0x10,%esp
+  8019d6:	89 d8                	mov    %ebx,%eax
+  8019d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019db:	5b                   	pop    %ebx
+  8019dc:	5e                   	pop    %esi
+  8019dd:	5d                   	pop    %ebp
+  8019de:	c3                   	ret
+  8019df:	68 54 32 80 00       	push   $0x803254
+  8019e4:	68 69 32 80 00       	push   $0x803269
+  8019e9:	6a 60                	push   $0x60
+  8019eb:	68 7e 32 80 00       	push   $0x80327e
+  8019f0:	e8 83 07 00 00       	call   802178 <_panic>
+
+008019f5 <nsipc_send>:
+  8019f5:	55                   	push   %ebp
+  8019f6:	89 e5                	mov    %esp,%ebp
+  8019f8:	53                   	push   %ebx
+  8019f9:	83 ec 04             	sub    $0x4,%esp
+  8019fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a02:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a07:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a0d:	7f 2e                	jg     801a3d <nsipc_send+0x48>
+  801a0f:	83 ec 04             	sub    $0x4,%esp
+  801a12:	53                   	push   %ebx
+  801a13:	ff 75 0c             	push   0xc(%ebp)
+  801a16:	68 0c 70 80 00       	push   $0x80700c
+  801a1b:	e8 da 10 00 00       	call   802afa <memmove>
+  801a20:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a26:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a29:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a2e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a33:	e8 f5 fd ff ff       	call   80182d <nsipc>
+  801a38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3b:	c9                   	leave
+  801a3c:	c3                   	ret
+  801a3d:	68 8a 32 80 00       	push   $0x80328a
+  801a42:	68 69 32 80 00       	push   $0x803269
+  801a47:	6a 6b                	push   $0x6b
+  801a49:	68 7e 32 80 00       	push   $0x80327e
+  801a4e:	e8 25 07 00 00       	call   802178 <_panic>
+
+00801a53 <nsipc_socket>:
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	83 ec 08             	sub    $0x8,%esp
+  801a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a5c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a61:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a64:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a69:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a6c:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a71:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a76:	e8 b2 fd ff ff       	call   80182d <nsipc>
+  801a7b:	c9                   	leave
+  801a7c:	c3                   	ret
+
+00801a7d <devpipe_stat>:
+  801a7d:	55                   	push   %ebp
+  801a7e:	89 e5                	mov    %esp,%ebp
+  801a80:	56                   	push   %esi
+  801a81:	53                   	push   %ebx
+  801a82:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a85:	83 ec 0c             	sub    $0xc,%esp
+  801a88:	ff 75 08             	push   0x8(%ebp)
+  801a8b:	e8 99 ef ff ff       	call   800a29 <fd2data>
+  801a90:	89 c6                	mov    %eax,%esi
+  801a92:	83 c4 08             	add    $0x8,%esp
+  801a95:	68 96 32 80 00       	push   $0x803296
+  801a9a:	53                   	push   %ebx
+  801a9b:	e8 aa 0e 00 00       	call   80294a <strcpy>
+  801aa0:	8b 46 04             	mov    0x4(%esi),%eax
+  801aa3:	2b 06                	sub    (%esi),%eax
+  801aa5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801aab:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ab2:	00 00 00 
+  801ab5:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801abc:	40 80 00 
+  801abf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac7:	5b                   	pop    %ebx
+  801ac8:	5e                   	pop    %esi
+  801ac9:	5d                   	pop    %ebp
+  801aca:	c3                   	ret
+
+00801acb <devpipe_close>:
+  801acb:	55                   	push   %ebp
+  801acc:	89 e5                	mov    %esp,%ebp
+  801ace:	53                   	push   %ebx
+  801acf:	83 ec 0c             	sub    $0xc,%esp
+  801ad2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ad5:	53                   	push   %ebx
+  801ad6:	6a 00                	push   $0x0
+  801ad8:	e8 a0 e7 ff ff       	call   80027d <sys_page_unmap>
+  801add:	89 1c 24             	mov    %ebx,(%esp)
+  801ae0:	e8 44 ef ff ff       	call   800a29 <fd2data>
+  801ae5:	83 c4 08             	add    $0x8,%esp
+  801ae8:	50                   	push   %eax
+  801ae9:	6a 00                	push   $0x0
+  801aeb:	e8 8d e7 ff ff       	call   80027d <sys_page_unmap>
+  801af0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af3:	c9                   	leave
+  801af4:	c3                   	ret
+
+00801af5 <_pipeisclosed>:
+  801af5:	55                   	push   %ebp
+  801af6:	89 e5                	mov    %esp,%ebp
+  801af8:	57                   	push   %edi
+  801af9:	56                   	push   %esi
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 1c             	sub    $0x1c,%esp
+  801afe:	89 c7                	mov    %eax,%edi
+  801b00:	89 d6                	mov    %edx,%esi
+  801b02:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b07:	8b 58 58             	mov    0x58(%eax),%ebx
+  801b0a:	83 ec 0c             	sub    $0xc,%esp
+  801b0d:	57                   	push   %edi
+  801b0e:	e8 1c 14 00 00       	call   802f2f <pageref>
+  801b13:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b16:	89 34 24             	mov    %esi,(%esp)
+  801b19:	e8 11 14 00 00       	call   802f2f <pageref>
+  801b1e:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b24:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	39 cb                	cmp    %ecx,%ebx
+  801b2c:	74 1b                	je     801b49 <_pipeisclosed+0x54>
+  801b2e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b31:	75 cf                	jne    801b02 <_pipeisclosed+0xd>
+  801b33:	8b 42 58             	mov    0x58(%edx),%eax
+  801b36:	6a 01                	push   $0x1
+  801b38:	50                   	push   %eax
+  801b39:	53                   	push   %ebx
+  801b3a:	68 9d 32 80 00       	push   $0x80329d
+  801b3f:	e8 0f 07 00 00       	call   802253 <cprintf>
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	eb b9                	jmp    801b02 <_pipeisclosed+0xd>
+  801b49:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b4c:	0f 94 c0             	sete   %al
+  801b4f:	0f b6 c0             	movzbl %al,%eax
+  801b52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5f                   	pop    %edi
+  801b58:	5d                   	pop    %ebp
+  801b59:	c3                   	ret
+
+00801b5a <devpipe_write>:
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	57                   	push   %edi
+  801b5e:	56                   	push   %esi
+  801b5f:	53                   	push   %ebx
+  801b60:	83 ec 28             	sub    $0x28,%esp
+  801b63:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b66:	56                   	push   %esi
+  801b67:	e8 bd ee ff ff       	call   800a29 <fd2data>
+  801b6c:	89 c3                	mov    %eax,%ebx
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b76:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b7a:	74 5c                	je     801bd8 <devpipe_write+0x7e>
+  801b7c:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b7f:	8b 0b                	mov    (%ebx),%ecx
+  801b81:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b84:	39 d0                	cmp    %edx,%eax
+  801b86:	72 1e                	jb     801ba6 <devpipe_write+0x4c>
+  801b88:	89 da                	mov    %ebx,%edx
+  801b8a:	89 f0                	mov    %esi,%eax
+  801b8c:	e8 64 ff ff ff       	call   801af5 <_pipeisclosed>
+  801b91:	85 c0                	test   %eax,%eax
+  801b93:	75 48                	jne    801bdd <devpipe_write+0x83>
+  801b95:	e8 c6 e5 ff ff       	call   800160 <sys_yield>
+  801b9a:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b9d:	8b 0b                	mov    (%ebx),%ecx
+  801b9f:	8d 51 20             	lea    0x20(%ecx),%edx
+  801ba2:	39 d0                	cmp    %edx,%eax
+  801ba4:	73 e2                	jae    801b88 <devpipe_write+0x2e>
+  801ba6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ba9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801bad:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801bb0:	89 c2                	mov    %eax,%edx
+  801bb2:	c1 fa 1f             	sar    $0x1f,%edx
+  801bb5:	89 d1                	mov    %edx,%ecx
+  801bb7:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bba:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bbd:	83 e2 1f             	and    $0x1f,%edx
+  801bc0:	29 ca                	sub    %ecx,%edx
+  801bc2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bc6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bca:	83 c0 01             	add    $0x1,%eax
+  801bcd:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bd0:	83 c7 01             	add    $0x1,%edi
+  801bd3:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bd6:	75 a4                	jne    801b7c <devpipe_write+0x22>
+  801bd8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bdb:	eb 05                	jmp    801be2 <devpipe_write+0x88>
+  801bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be5:	5b                   	pop    %ebx
+  801be6:	5e                   	pop    %esi
+  801be7:	5f                   	pop    %edi
+  801be8:	5d                   	pop    %ebp
+  801be9:	c3                   	ret
+
+00801bea <devpipe_read>:
+  801bea:	55                   	push   %ebp
+  801beb:	89 e5                	mov    %esp,%ebp
+  801bed:	57                   	push   %edi
+  801bee:	56                   	push   %esi
+  801bef:	53                   	push   %ebx
+  801bf0:	83 ec 18             	sub    $0x18,%esp
+  801bf3:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bf6:	56                   	push   %esi
+  801bf7:	e8 2d ee ff ff       	call   800a29 <fd2data>
+  801bfc:	89 c3                	mov    %eax,%ebx
+  801bfe:	83 c4 10             	add    $0x10,%esp
+  801c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c06:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c0a:	74 45                	je     801c51 <devpipe_read+0x67>
+  801c0c:	8b 03                	mov    (%ebx),%eax
+  801c0e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c11:	75 1d                	jne    801c30 <devpipe_read+0x46>
+  801c13:	85 ff                	test   %edi,%edi
+  801c15:	75 3f                	jne    801c56 <devpipe_read+0x6c>
+  801c17:	89 da                	mov    %ebx,%edx
+  801c19:	89 f0                	mov    %esi,%eax
+  801c1b:	e8 d5 fe ff ff       	call   801af5 <_pipeisclosed>
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	75 3c                	jne    801c60 <devpipe_read+0x76>
+  801c24:	e8 37 e5 ff ff       	call   800160 <sys_yield>
+  801c29:	8b 03                	mov    (%ebx),%eax
+  801c2b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c2e:	74 e7                	je     801c17 <devpipe_read+0x2d>
+  801c30:	99                   	cltd
+  801c31:	c1 ea 1b             	shr    $0x1b,%edx
+  801c34:	01 d0                	add    %edx,%eax
+  801c36:	83 e0 1f             	and    $0x1f,%eax
+  801c39:	29 d0                	sub    %edx,%eax
+  801c3b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c43:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c46:	83 03 01             	addl   $0x1,(%ebx)
+  801c49:	83 c7 01             	add    $0x1,%edi
+  801c4c:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c4f:	75 bb                	jne    801c0c <devpipe_read+0x22>
+  801c51:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c54:	eb 02                	jmp    801c58 <devpipe_read+0x6e>
+  801c56:	89 f8                	mov    %edi,%eax
+  801c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5b:	5b                   	pop    %ebx
+  801c5c:	5e                   	pop    %esi
+  801c5d:	5f                   	pop    %edi
+  801c5e:	5d                   	pop    %ebp
+  801c5f:	c3                   	ret
+  801c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c65:	eb f1                	jmp    801c58 <devpipe_read+0x6e>
+
+00801c67 <pipe>:
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	56                   	push   %esi
+  801c6b:	53                   	push   %ebx
+  801c6c:	83 ec 1c             	sub    $0x1c,%esp
+  801c6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c72:	50                   	push   %eax
+  801c73:	e8 c8 ed ff ff       	call   800a40 <fd_alloc>
+  801c78:	89 c3                	mov    %eax,%ebx
+  801c7a:	83 c4 10             	add    $0x10,%esp
+  801c7d:	85 c0                	test   %eax,%eax
+  801c7f:	0f 88 23 01 00 00    	js     801da8 <pipe+0x141>
+  801c85:	83 ec 04             	sub    $0x4,%esp
+  801c88:	68 07 04 00 00       	push   $0x407
+  801c8d:	ff 75 f4             	push   -0xc(%ebp)
+  801c90:	6a 00                	push   $0x0
+  801c92:	e8 14 e5 ff ff       	call   8001ab <sys_page_alloc>
+  801c97:	89 c3                	mov    %eax,%ebx
+  801c99:	83 c4 10             	add    $0x10,%esp
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	0f 88 04 01 00 00    	js     801da8 <pipe+0x141>
+  801ca4:	83 ec 0c             	sub    $0xc,%esp
+  801ca7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801caa:	50                   	push   %eax
+  801cab:	e8 90 ed ff ff       	call   800a40 <fd_alloc>
+  801cb0:	89 c3                	mov    %eax,%ebx
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	85 c0                	test   %eax,%eax
+  801cb7:	0f 88 db 00 00 00    	js     801d98 <pipe+0x131>
+  801cbd:	83 ec 04             	sub    $0x4,%esp
+  801cc0:	68 07 04 00 00       	push   $0x407
+  801cc5:	ff 75 f0             	push   -0x10(%ebp)
+  801cc8:	6a 00                	push   $0x0
+  801cca:	e8 dc e4 ff ff       	call   8001ab <sys_page_alloc>
+  801ccf:	89 c3                	mov    %eax,%ebx
+  801cd1:	83 c4 10             	add    $0x10,%esp
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	0f 88 bc 00 00 00    	js     801d98 <pipe+0x131>
+  801cdc:	83 ec 0c             	sub    $0xc,%esp
+  801cdf:	ff 75 f4             	push   -0xc(%ebp)
+  801ce2:	e8 42 ed ff ff       	call   800a29 <fd2data>
+  801ce7:	89 c6                	mov    %eax,%esi
+  801ce9:	83 c4 0c             	add    $0xc,%esp
+  801cec:	68 07 04 00 00       	push   $0x407
+  801cf1:	50                   	push   %eax
+  801cf2:	6a 00                	push   $0x0
+  801cf4:	e8 b2 e4 ff ff       	call   8001ab <sys_page_alloc>
+  801cf9:	89 c3                	mov    %eax,%ebx
+  801cfb:	83 c4 10             	add    $0x10,%esp
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	0f 88 82 00 00 00    	js     801d88 <pipe+0x121>
+  801d06:	83 ec 0c             	sub    $0xc,%esp
+  801d09:	ff 75 f0             	push   -0x10(%ebp)
+  801d0c:	e8 18 ed ff ff       	call   800a29 <fd2data>
+  801d11:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d18:	50                   	push   %eax
+  801d19:	6a 00                	push   $0x0
+  801d1b:	56                   	push   %esi
+  801d1c:	6a 00                	push   $0x0
+  801d1e:	e8 cb e4 ff ff       	call   8001ee <sys_page_map>
+  801d23:	89 c3                	mov    %eax,%ebx
+  801d25:	83 c4 20             	add    $0x20,%esp
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	78 4e                	js     801d7a <pipe+0x113>
+  801d2c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d31:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d34:	89 02                	mov    %eax,(%edx)
+  801d36:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d39:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d40:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d43:	89 02                	mov    %eax,(%edx)
+  801d45:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d48:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d4f:	83 ec 0c             	sub    $0xc,%esp
+  801d52:	ff 75 f4             	push   -0xc(%ebp)
+  801d55:	e8 bf ec ff ff       	call   800a19 <fd2num>
+  801d5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d5d:	89 01                	mov    %eax,(%ecx)
+  801d5f:	83 c4 04             	add    $0x4,%esp
+  801d62:	ff 75 f0             	push   -0x10(%ebp)
+  801d65:	e8 af ec ff ff       	call   800a19 <fd2num>
+  801d6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d6d:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d78:	eb 2e                	jmp    801da8 <pipe+0x141>
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+  801d7d:	56                   	push   %esi
+  801d7e:	6a 00                	push   $0x0
+  801d80:	e8 f8 e4 ff ff       	call   80027d <sys_page_unmap>
+  801d85:	83 c4 10             	add    $0x10,%esp
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	ff 75 f0             	push   -0x10(%ebp)
+  801d8e:	6a 00                	push   $0x0
+  801d90:	e8 e8 e4 ff ff       	call   80027d <sys_page_unmap>
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	83 ec 08             	sub    $0x8,%esp
+  801d9b:	ff 75 f4             	push   -0xc(%ebp)
+  801d9e:	6a 00                	push   $0x0
+  801da0:	e8 d8 e4 ff ff       	call   80027d <sys_page_unmap>
+  801da5:	83 c4 10             	add    $0x10,%esp
+  801da8:	89 d8                	mov    %ebx,%eax
+  801daa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dad:	5b                   	pop    %ebx
+  801dae:	5e                   	pop    %esi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+
+00801db1 <pipeisclosed>:
+  801db1:	55                   	push   %ebp
+  801db2:	89 e5                	mov    %esp,%ebp
+  801db4:	83 ec 20             	sub    $0x20,%esp
+  801db7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dba:	50                   	push   %eax
+  801dbb:	ff 75 08             	push   0x8(%ebp)
+  801dbe:	e8 cd ec ff ff       	call   800a90 <fd_lookup>
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	78 18                	js     801de2 <pipeisclosed+0x31>
+  801dca:	83 ec 0c             	sub    $0xc,%esp
+  801dcd:	ff 75 f4             	push   -0xc(%ebp)
+  801dd0:	e8 54 ec ff ff       	call   800a29 <fd2data>
+  801dd5:	89 c2                	mov    %eax,%edx
+  801dd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dda:	e8 16 fd ff ff       	call   801af5 <_pipeisclosed>
+  801ddf:	83 c4 10             	add    $0x10,%esp
+  801de2:	c9                   	leave
+  801de3:	c3                   	ret
+
+00801de4 <ipcring_init>:
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	53                   	push   %ebx
+  801de8:	83 ec 08             	sub    $0x8,%esp
+  801deb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dee:	6a 60                	push   $0x60
+  801df0:	6a 00                	push   $0x0
+  801df2:	53                   	push   %ebx
+  801df3:	e8 cd 0c 00 00       	call   802ac5 <memset>
+  801df8:	a1 10 50 80 00       	mov    0x805010,%eax
+  801dfd:	8b 40 48             	mov    0x48(%eax),%eax
+  801e00:	89 03                	mov    %eax,(%ebx)
+  801e02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e05:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e08:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e0b:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e0e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e11:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e14:	83 c4 10             	add    $0x10,%esp
+  801e17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1a:	c9                   	leave
+  801e1b:	c3                   	ret
+
+00801e1c <ipcring_req_slot>:
+  801e1c:	55                   	push   %ebp
+  801e1d:	89 e5                	mov    %esp,%ebp
+  801e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e22:	8b 50 10             	mov    0x10(%eax),%edx
+  801e25:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e28:	29 ca                	sub    %ecx,%edx
+  801e2a:	83 fa 07             	cmp    $0x7,%edx
+  801e2d:	77 0c                	ja     801e3b <ipcring_req_slot+0x1f>
+  801e2f:	8b 50 10             	mov    0x10(%eax),%edx
+  801e32:	83 e2 07             	and    $0x7,%edx
+  801e35:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e39:	5d                   	pop    %ebp
+  801e3a:	c3                   	ret
+  801e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e40:	eb f7                	jmp    801e39 <ipcring_req_slot+0x1d>
+
+00801e42 <ipcring_req_push>:
+  801e42:	55                   	push   %ebp
+  801e43:	89 e5                	mov    %esp,%ebp
+  801e45:	83 ec 08             	sub    $0x8,%esp
+  801e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e4b:	8b 42 10             	mov    0x10(%edx),%eax
+  801e4e:	83 c0 01             	add    $0x1,%eax
+  801e51:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5a:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	75 02                	jne    801e64 <ipcring_req_push+0x22>
+  801e62:	c9                   	leave
+  801e63:	c3                   	ret
+  801e64:	6a 00                	push   $0x0
+  801e66:	68 00 00 80 ee       	push   $0xee800000
+  801e6b:	ff 72 08             	push   0x8(%edx)
+  801e6e:	ff 72 04             	push   0x4(%edx)
+  801e71:	e8 6d e6 ff ff       	call   8004e3 <sys_ipc_send>
+  801e76:	83 c4 10             	add    $0x10,%esp
+  801e79:	eb e7                	jmp    801e62 <ipcring_req_push+0x20>
+
+00801e7b <ipcring_rsp_wait>:
+  801e7b:	55                   	push   %ebp
+  801e7c:	89 e5                	mov    %esp,%ebp
+  801e7e:	53                   	push   %ebx
+  801e7f:	83 ec 04             	sub    $0x4,%esp
+  801e82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e85:	8b 53 18             	mov    0x18(%ebx),%edx
+  801e88:	8b 43 10             	mov    0x10(%ebx),%eax
+  801e8b:	39 c2                	cmp    %eax,%edx
+  801e8d:	74 3c                	je     801ecb <ipcring_rsp_wait+0x50>
+  801e8f:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e92:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e95:	39 c2                	cmp    %eax,%edx
+  801e97:	75 23                	jne    801ebc <ipcring_rsp_wait+0x41>
+  801e99:	83 ec 08             	sub    $0x8,%esp
+  801e9c:	6a 00                	push   $0x0
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	6a 00                	push   $0x0
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	ff 73 0c             	push   0xc(%ebx)
+  801ea7:	ff 73 04             	push   0x4(%ebx)
+  801eaa:	e8 cb 0e 00 00       	call   802d7a <ipc_call>
+  801eaf:	8b 53 14             	mov    0x14(%ebx),%edx
+  801eb2:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eb5:	83 c4 20             	add    $0x20,%esp
+  801eb8:	39 c2                	cmp    %eax,%edx
+  801eba:	74 dd                	je     801e99 <ipcring_rsp_wait+0x1e>
+  801ebc:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ebf:	83 e0 07             	and    $0x7,%eax
+  801ec2:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801ec6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec9:	c9                   	leave
+  801eca:	c3                   	ret
+  801ecb:	68 b8 32 80 00       	push   $0x8032b8
+  801ed0:	68 69 32 80 00       	push   $0x803269
+  801ed5:	6a 3b                	push   $0x3b
+  801ed7:	68 d9 32 80 00       	push   $0x8032d9
+  801edc:	e8 97 02 00 00       	call   802178 <_panic>
+
+00801ee1 <ipcring_rsp_pop>:
+  801ee1:	55                   	push   %ebp
+  801ee2:	89 e5                	mov    %esp,%ebp
+  801ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee7:	8b 42 18             	mov    0x18(%edx),%eax
+  801eea:	83 c0 01             	add    $0x1,%eax
+  801eed:	89 42 18             	mov    %eax,0x18(%edx)
+  801ef0:	5d                   	pop    %ebp
+  801ef1:	c3                   	ret
+
+00801ef2 <ipcring_server_init>:
+  801ef2:	55                   	push   %ebp
+  801ef3:	89 e5                	mov    %esp,%ebp
+  801ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801efb:	89 10                	mov    %edx,(%eax)
+  801efd:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f00:	89 50 04             	mov    %edx,0x4(%eax)
+  801f03:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801f0a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f11:	5d                   	pop    %ebp
+  801f12:	c3                   	ret
+
+00801f13 <ipcring_req_avail>:
+  801f13:	55                   	push   %ebp
+  801f14:	89 e5                	mov    %esp,%ebp
+  801f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f19:	8b 02                	mov    (%edx),%eax
+  801f1b:	8b 40 10             	mov    0x10(%eax),%eax
+  801f1e:	2b 42 08             	sub    0x8(%edx),%eax
+  801f21:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f26:	39 d0                	cmp    %edx,%eax
+  801f28:	0f 47 c2             	cmova  %edx,%eax
+  801f2b:	5d                   	pop    %ebp
+  801f2c:	c3                   	ret
+
+00801f2d <ipcring_req_peek>:
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f33:	8b 42 08             	mov    0x8(%edx),%eax
+  801f36:	83 e0 07             	and    $0x7,%eax
+  801f39:	8b 12                	mov    (%edx),%edx
+  801f3b:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f3f:	5d                   	pop    %ebp
+  801f40:	c3                   	ret
+
+00801f41 <ipcring_rsp_push>:
+  801f41:	55                   	push   %ebp
+  801f42:	89 e5                	mov    %esp,%ebp
+  801f44:	83 ec 08             	sub    $0x8,%esp
+  801f47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f4a:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f4d:	83 c0 01             	add    $0x1,%eax
+  801f50:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f53:	8b 11                	mov    (%ecx),%edx
+  801f55:	83 c2 14             	add    $0x14,%edx
+  801f58:	f0 87 02             	lock xchg %eax,(%edx)
+  801f5b:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f5f:	75 02                	jne    801f63 <ipcring_rsp_push+0x22>
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+  801f63:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f6a:	6a 00                	push   $0x0
+  801f6c:	68 00 00 80 ee       	push   $0xee800000
+  801f71:	6a 00                	push   $0x0
+  801f73:	ff 71 04             	push   0x4(%ecx)
+  801f76:	e8 8b e4 ff ff       	call   800406 <sys_ipc_try_send>
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	eb e1                	jmp    801f61 <ipcring_rsp_push+0x20>
+
+00801f80 <ipcring_client_wait>:
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	83 ec 08             	sub    $0x8,%esp
+  801f86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f89:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801f90:	8b 10                	mov    (%eax),%edx
+  801f92:	8b 52 18             	mov    0x18(%edx),%edx
+  801f95:	3b 50 08             	cmp    0x8(%eax),%edx
+  801f98:	75 02                	jne    801f9c <ipcring_client_wait+0x1c>
+  801f9a:	c9                   	leave
+  801f9b:	c3                   	ret
+  801f9c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801fa3:	6a 00                	push   $0x0
+  801fa5:	68 00 00 80 ee       	push   $0xee800000
+  801faa:	6a 00                	push   $0x0
+  801fac:	ff 70 04             	push   0x4(%eax)
+  801faf:	e8 52 e4 ff ff       	call   800406 <sys_ipc_try_send>
+  801fb4:	83 c4 10             	add    $0x10,%esp
+  801fb7:	eb e1                	jmp    801f9a <ipcring_client_wait+0x1a>
+
+00801fb9 <ipcring_server_sleep>:
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	53                   	push   %ebx
+  801fbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fc0:	8b 01                	mov    (%ecx),%eax
+  801fc2:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fc5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fca:	f0 87 02             	lock xchg %eax,(%edx)
+  801fcd:	8b 11                	mov    (%ecx),%edx
+  801fcf:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fd2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fd7:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801fda:	74 0e                	je     801fea <ipcring_server_sleep+0x31>
+  801fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe1:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801fe5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+
+00801fef <devcons_close>:
+  801fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff4:	c3                   	ret
+
+00801ff5 <devcons_stat>:
+  801ff5:	55                   	push   %ebp
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	83 ec 10             	sub    $0x10,%esp
+  801ffb:	68 e7 32 80 00       	push   $0x8032e7
+  802000:	ff 75 0c             	push   0xc(%ebp)
+  802003:	e8 42 09 00 00       	call   80294a <strcpy>
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200d:	c9                   	leave
+  80200e:	c3                   	ret
+
+0080200f <devcons_write>:
+  80200f:	55                   	push   %ebp
+  802010:	89 e5                	mov    %esp,%ebp
+  802012:	57                   	push   %edi
+  802013:	56                   	push   %esi
+  802014:	53                   	push   %ebx
+  802015:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80201b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80201e:	85 ff                	test   %edi,%edi
+  802020:	74 51                	je     802073 <devcons_write+0x64>
+  802022:	be 00 00 00 00       	mov    $0x0,%esi
+  802027:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202c:	89 fb                	mov    %edi,%ebx
+  80202e:	29 c3                	sub    %eax,%ebx
+  802030:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802035:	39 d3                	cmp    %edx,%ebx
+  802037:	0f 47 da             	cmova  %edx,%ebx
+  80203a:	83 ec 04             	sub    $0x4,%esp
+  80203d:	53                   	push   %ebx
+  80203e:	03 45 0c             	add    0xc(%ebp),%eax
+  802041:	50                   	push   %eax
+  802042:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802048:	50                   	push   %eax
+  802049:	e8 ac 0a 00 00       	call   802afa <memmove>
+  80204e:	83 c4 08             	add    $0x8,%esp
+  802051:	53                   	push   %ebx
+  802052:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802058:	50                   	push   %eax
+  802059:	e8 65 e0 ff ff       	call   8000c3 <sys_cputs>
+  80205e:	01 de                	add    %ebx,%esi
+  802060:	89 f0                	mov    %esi,%eax
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	39 fe                	cmp    %edi,%esi
+  802067:	72 c3                	jb     80202c <devcons_write+0x1d>
+  802069:	89 f0                	mov    %esi,%eax
+  80206b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206e:	5b                   	pop    %ebx
+  80206f:	5e                   	pop    %esi
+  802070:	5f                   	pop    %edi
+  802071:	5d                   	pop    %ebp
+  802072:	c3                   	ret
+  802073:	be 00 00 00 00       	mov    $0x0,%esi
+  802078:	eb ef                	jmp    802069 <devcons_write+0x5a>
+
+0080207a <devcons_read>:
+  80207a:	55                   	push   %ebp
+  80207b:	89 e5                	mov    %esp,%ebp
+  80207d:	83 ec 08             	sub    $0x8,%esp
+  802080:	b8 00 00 00 00       	mov    $0x0,%eax
+  802085:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802089:	75 07                	jne    802092 <devcons_read+0x18>
+  80208b:	eb 1f                	jmp    8020ac <devcons_read+0x32>
+  80208d:	e8 ce e0 ff ff       	call   800160 <sys_yield>
+  802092:	e8 4a e0 ff ff       	call   8000e1 <sys_cgetc>
+  802097:	85 c0                	test   %eax,%eax
+  802099:	74 f2                	je     80208d <devcons_read+0x13>
+  80209b:	78 0f                	js     8020ac <devcons_read+0x32>
+  80209d:	83 f8 04             	cmp    $0x4,%eax
+  8020a0:	74 0c                	je     8020ae <devcons_read+0x34>
+  8020a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020a5:	88 02                	mov    %al,(%edx)
+  8020a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020ac:	c9                   	leave
+  8020ad:	c3                   	ret
+  8020ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b3:	eb f7                	jmp    8020ac <devcons_read+0x32>
+
+008020b5 <cputchar>:
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	83 ec 20             	sub    $0x20,%esp
+  8020bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020be:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020c1:	6a 01                	push   $0x1
+  8020c3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020c6:	50                   	push   %eax
+  8020c7:	e8 f7 df ff ff       	call   8000c3 <sys_cputs>
+  8020cc:	83 c4 10             	add    $0x10,%esp
+  8020cf:	c9                   	leave
+  8020d0:	c3                   	ret
+
+008020d1 <getchar>:
+  8020d1:	55                   	push   %ebp
+  8020d2:	89 e5                	mov    %esp,%ebp
+  8020d4:	83 ec 1c             	sub    $0x1c,%esp
+  8020d7:	6a 01                	push   $0x1
+  8020d9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020dc:	50                   	push   %eax
+  8020dd:	6a 00                	push   $0x0
+  8020df:	e8 0e ec ff ff       	call   800cf2 <read>
+  8020e4:	83 c4 10             	add    $0x10,%esp
+  8020e7:	85 c0                	test   %eax,%eax
+  8020e9:	78 06                	js     8020f1 <getchar+0x20>
+  8020eb:	74 06                	je     8020f3 <getchar+0x22>
+  8020ed:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8020f1:	c9                   	leave
+  8020f2:	c3                   	ret
+  8020f3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020f8:	eb f7                	jmp    8020f1 <getchar+0x20>
+
+008020fa <iscons>:
+  8020fa:	55                   	push   %ebp
+  8020fb:	89 e5                	mov    %esp,%ebp
+  8020fd:	83 ec 20             	sub    $0x20,%esp
+  802100:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802103:	50                   	push   %eax
+  802104:	ff 75 08             	push   0x8(%ebp)
+  802107:	e8 84 e9 ff ff       	call   800a90 <fd_lookup>
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	85 c0                	test   %eax,%eax
+  802111:	78 11                	js     802124 <iscons+0x2a>
+  802113:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802116:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80211c:	39 10                	cmp    %edx,(%eax)
+  80211e:	0f 94 c0             	sete   %al
+  802121:	0f b6 c0             	movzbl %al,%eax
+  802124:	c9                   	leave
+  802125:	c3                   	ret
+
+00802126 <opencons>:
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	83 ec 24             	sub    $0x24,%esp
+  80212c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212f:	50                   	push   %eax
+  802130:	e8 0b e9 ff ff       	call   800a40 <fd_alloc>
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	78 3a                	js     802176 <opencons+0x50>
+  80213c:	83 ec 04             	sub    $0x4,%esp
+  80213f:	68 07 04 00 00       	push   $0x407
+  802144:	ff 75 f4             	push   -0xc(%ebp)
+  802147:	6a 00                	push   $0x0
+  802149:	e8 5d e0 ff ff       	call   8001ab <sys_page_alloc>
+  80214e:	83 c4 10             	add    $0x10,%esp
+  802151:	85 c0                	test   %eax,%eax
+  802153:	78 21                	js     802176 <opencons+0x50>
+  802155:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802158:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80215e:	89 10                	mov    %edx,(%eax)
+  802160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802163:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80216a:	83 ec 0c             	sub    $0xc,%esp
+  80216d:	50                   	push   %eax
+  80216e:	e8 a6 e8 ff ff       	call   800a19 <fd2num>
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	c9                   	leave
+  802177:	c3                   	ret
+
+00802178 <_panic>:
+  802178:	55                   	push   %ebp
+  802179:	89 e5                	mov    %esp,%ebp
+  80217b:	56                   	push   %esi
+  80217c:	53                   	push   %ebx
+  80217d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802180:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802186:	e8 b6 df ff ff       	call   800141 <sys_getenvid>
+  80218b:	83 ec 0c             	sub    $0xc,%esp
+  80218e:	ff 75 0c             	push   0xc(%ebp)
+  802191:	ff 75 08             	push   0x8(%ebp)
+  802194:	56                   	push   %esi
+  802195:	50                   	push   %eax
+  802196:	68 f4 32 80 00       	push   $0x8032f4
+  80219b:	e8 b3 00 00 00       	call   802253 <cprintf>
+  8021a0:	83 c4 18             	add    $0x18,%esp
+  8021a3:	53                   	push   %ebx
+  8021a4:	ff 75 10             	push   0x10(%ebp)
+  8021a7:	e8 56 00 00 00       	call   802202 <vcprintf>
+  8021ac:	c7 04 24 ae 32 80 00 	movl   $0x8032ae,(%esp)
+  8021b3:	e8 9b 00 00 00       	call   802253 <cprintf>
+  8021b8:	83 c4 10             	add    $0x10,%esp
+  8021bb:	cc                   	int3
+  8021bc:	eb fd                	jmp    8021bb <_panic+0x43>
+
+008021be <putch>:
+  8021be:	55                   	push   %ebp
+  8021bf:	89 e5                	mov    %esp,%ebp
+  8021c1:	53                   	push   %ebx
+  8021c2:	83 ec 04             	sub    $0x4,%esp
+  8021c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021c8:	8b 13                	mov    (%ebx),%edx
+  8021ca:	8d 42 01             	lea    0x1(%edx),%eax
+  8021cd:	89 03                	mov    %eax,(%ebx)
+  8021cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021d2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021d6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021db:	74 09                	je     8021e6 <putch+0x28>
+  8021dd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e4:	c9                   	leave
+  8021e5:	c3                   	ret
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  8021e9:	68 ff 00 00 00       	push   $0xff
+  8021ee:	8d 43 08             	lea    0x8(%ebx),%eax
+  8021f1:	50                   	push   %eax
+  8021f2:	e8 cc de ff ff       	call   8000c3 <sys_cputs>
+  8021f7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	eb db                	jmp    8021dd <putch+0x1f>
+
+00802202 <vcprintf>:
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80220b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802212:	00 00 00 
+  802215:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80221c:	00 00 00 
+  80221f:	ff 75 0c             	push   0xc(%ebp)
+  802222:	ff 75 08             	push   0x8(%ebp)
+  802225:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80222b:	50                   	push   %eax
+  80222c:	68 be 21 80 00       	push   $0x8021be
+  802231:	e8 1c 01 00 00       	call   802352 <vprintfmt>
+  802236:	83 c4 08             	add    $0x8,%esp
+  802239:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80223f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802245:	50                   	push   %eax
+  802246:	e8 78 de ff ff       	call   8000c3 <sys_cputs>
+  80224b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+
+00802253 <cprintf>:
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	83 ec 10             	sub    $0x10,%esp
+  802259:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80225c:	50                   	push   %eax
+  80225d:	ff 75 08             	push   0x8(%ebp)
+  802260:	e8 9d ff ff ff       	call   802202 <vcprintf>
+  802265:	c9                   	leave
+  802266:	c3                   	ret
+
+00802267 <printnum>:
+  802267:	55                   	push   %ebp
+  802268:	89 e5                	mov    %esp,%ebp
+  80226a:	57                   	push   %edi
+  80226b:	56                   	push   %esi
+  80226c:	53                   	push   %ebx
+  80226d:	83 ec 1c             	sub    $0x1c,%esp
+  802270:	89 c3                	mov    %eax,%ebx
+  802272:	89 d6                	mov    %edx,%esi
+  802274:	8b 45 08             	mov    0x8(%ebp),%eax
+  802277:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80227a:	89 d1                	mov    %edx,%ecx
+  80227c:	89 c2                	mov    %eax,%edx
+  80227e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802281:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802284:	8b 45 10             	mov    0x10(%ebp),%eax
+  802287:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80228a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802291:	39 c2                	cmp    %eax,%edx
+  802293:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802296:	73 4b                	jae    8022e3 <printnum+0x7c>
+  802298:	8b 45 14             	mov    0x14(%ebp),%eax
+  80229b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80229e:	85 ff                	test   %edi,%edi
+  8022a0:	7e 11                	jle    8022b3 <printnum+0x4c>
+  8022a2:	83 ec 08             	sub    $0x8,%esp
+  8022a5:	56                   	push   %esi
+  8022a6:	ff 75 18             	push   0x18(%ebp)
+  8022a9:	ff d3                	call   *%ebx
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	83 ef 01             	sub    $0x1,%edi
+  8022b1:	75 ef                	jne    8022a2 <printnum+0x3b>
+  8022b3:	83 ec 08             	sub    $0x8,%esp
+  8022b6:	56                   	push   %esi
+  8022b7:	83 ec 04             	sub    $0x4,%esp
+  8022ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8022bd:	ff 75 e0             	push   -0x20(%ebp)
+  8022c0:	ff 75 dc             	push   -0x24(%ebp)
+  8022c3:	ff 75 d8             	push   -0x28(%ebp)
+  8022c6:	e8 9b 0d 00 00       	call   803066 <__umoddi3>
+  8022cb:	83 c4 14             	add    $0x14,%esp
+  8022ce:	0f be 80 17 33 80 00 	movsbl 0x803317(%eax),%eax
+  8022d5:	50                   	push   %eax
+  8022d6:	ff d3                	call   *%ebx
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022de:	5b                   	pop    %ebx
+  8022df:	5e                   	pop    %esi
+  8022e0:	5f                   	pop    %edi
+  8022e1:	5d                   	pop    %ebp
+  8022e2:	c3                   	ret
+  8022e3:	83 ec 0c             	sub    $0xc,%esp
+  8022e6:	ff 75 18             	push   0x18(%ebp)
+  8022e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022ec:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8022ef:	52                   	push   %edx
+  8022f0:	50                   	push   %eax
+  8022f1:	83 ec 08             	sub    $0x8,%esp
+  8022f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8022f7:	ff 75 e0             	push   -0x20(%ebp)
+  8022fa:	ff 75 dc             	push   -0x24(%ebp)
+  8022fd:	ff 75 d8             	push   -0x28(%ebp)
+  802300:	e8 43 0d 00 00       	call   803048 <__udivdi3>
+  802305:	83 c4 18             	add    $0x18,%esp
+  802308:	52                   	push   %edx
+  802309:	50                   	push   %eax
+  80230a:	89 f2                	mov    %esi,%edx
+  80230c:	89 d8                	mov    %ebx,%eax
+  80230e:	e8 54 ff ff ff       	call   802267 <printnum>
+  802313:	83 c4 20             	add    $0x20,%esp
+  802316:	eb 9b                	jmp    8022b3 <printnum+0x4c>
+
+00802318 <sprintputch>:
+  802318:	55                   	push   %ebp
+  802319:	89 e5                	mov    %esp,%ebp
+  80231b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802322:	8b 10                	mov    (%eax),%edx
+  802324:	3b 50 04             	cmp    0x4(%eax),%edx
+  802327:	73 0a                	jae    802333 <sprintputch+0x1b>
+  802329:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80232c:	89 08                	mov    %ecx,(%eax)
+  80232e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802331:	88 02                	mov    %al,(%edx)
+  802333:	5d                   	pop    %ebp
+  802334:	c3                   	ret
+
+00802335 <printfmt>:
+  802335:	55                   	push   %ebp
+  802336:	89 e5                	mov    %esp,%ebp
+  802338:	83 ec 08             	sub    $0x8,%esp
+  80233b:	8d 45 14             	lea    0x14(%ebp),%eax
+  80233e:	50                   	push   %eax
+  80233f:	ff 75 10             	push   0x10(%ebp)
+  802342:	ff 75 0c             	push   0xc(%ebp)
+  802345:	ff 75 08             	push   0x8(%ebp)
+  802348:	e8 05 00 00 00       	call   802352 <vprintfmt>
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	c9                   	leave
+  802351:	c3                   	ret
+
+00802352 <vprintfmt>:
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	57                   	push   %edi
+  802356:	56                   	push   %esi
+  802357:	53                   	push   %ebx
+  802358:	83 ec 2c             	sub    $0x2c,%esp
+  80235b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80235e:	89 df                	mov    %ebx,%edi
+  802360:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802363:	8b 45 10             	mov    0x10(%ebp),%eax
+  802366:	8d 70 01             	lea    0x1(%eax),%esi
+  802369:	0f b6 00             	movzbl (%eax),%eax
+  80236c:	83 f8 25             	cmp    $0x25,%eax
+  80236f:	74 1e                	je     80238f <vprintfmt+0x3d>
+  802371:	85 c0                	test   %eax,%eax
+  802373:	0f 84 15 05 00 00    	je     80288e <vprintfmt+0x53c>
+  802379:	83 ec 08             	sub    $0x8,%esp
+  80237c:	53                   	push   %ebx
+  80237d:	50                   	push   %eax
+  80237e:	ff d7                	call   *%edi
+  802380:	83 c6 01             	add    $0x1,%esi
+  802383:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802387:	83 c4 10             	add    $0x10,%esp
+  80238a:	83 f8 25             	cmp    $0x25,%eax
+  80238d:	75 e2                	jne    802371 <vprintfmt+0x1f>
+  80238f:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  802393:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80239a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8023a1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8023a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ad:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8023b0:	8d 56 01             	lea    0x1(%esi),%edx
+  8023b3:	0f b6 0e             	movzbl (%esi),%ecx
+  8023b6:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023b9:	3c 55                	cmp    $0x55,%al
+  8023bb:	0f 87 3b 04 00 00    	ja     8027fc <vprintfmt+0x4aa>
+  8023c1:	0f b6 c0             	movzbl %al,%eax
+  8023c4:	ff 24 85 60 34 80 00 	jmp    *0x803460(,%eax,4)
+  8023cb:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023ce:	eb 93                	jmp    802363 <vprintfmt+0x11>
+  8023d0:	89 d6                	mov    %edx,%esi
+  8023d2:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023d6:	eb d8                	jmp    8023b0 <vprintfmt+0x5e>
+  8023d8:	89 d6                	mov    %edx,%esi
+  8023da:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023de:	eb d0                	jmp    8023b0 <vprintfmt+0x5e>
+  8023e0:	0f b6 c9             	movzbl %cl,%ecx
+  8023e3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8023e6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023e9:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8023ed:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8023f0:	83 f9 09             	cmp    $0x9,%ecx
+  8023f3:	77 6f                	ja     802464 <vprintfmt+0x112>
+  8023f5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8023f8:	83 c2 01             	add    $0x1,%edx
+  8023fb:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8023fe:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  802402:	0f be 02             	movsbl (%edx),%eax
+  802405:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802408:	83 fe 09             	cmp    $0x9,%esi
+  80240b:	76 eb                	jbe    8023f8 <vprintfmt+0xa6>
+  80240d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802410:	89 d6                	mov    %edx,%esi
+  802412:	eb 13                	jmp    802427 <vprintfmt+0xd5>
+  802414:	8b 45 14             	mov    0x14(%ebp),%eax
+  802417:	8b 00                	mov    (%eax),%eax
+  802419:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80241c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80241f:	8d 40 04             	lea    0x4(%eax),%eax
+  802422:	89 45 14             	mov    %eax,0x14(%ebp)
+  802425:	89 d6                	mov    %edx,%esi
+  802427:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80242b:	79 83                	jns    8023b0 <vprintfmt+0x5e>
+  80242d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802430:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802433:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80243a:	e9 71 ff ff ff       	jmp    8023b0 <vprintfmt+0x5e>
+  80243f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802442:	85 c9                	test   %ecx,%ecx
+  802444:	b8 00 00 00 00       	mov    $0x0,%eax
+  802449:	0f 49 c1             	cmovns %ecx,%eax
+  80244c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80244f:	89 d6                	mov    %edx,%esi
+  802451:	e9 5a ff ff ff       	jmp    8023b0 <vprintfmt+0x5e>
+  802456:	89 d6                	mov    %edx,%esi
+  802458:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80245f:	e9 4c ff ff ff       	jmp    8023b0 <vprintfmt+0x5e>
+  802464:	89 d6                	mov    %edx,%esi
+  802466:	eb bf                	jmp    802427 <vprintfmt+0xd5>
+  802468:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80246c:	89 d6                	mov    %edx,%esi
+  80246e:	e9 3d ff ff ff       	jmp    8023b0 <vprintfmt+0x5e>
+  802473:	89 55 10             	mov    %edx,0x10(%ebp)
+  802476:	8b 45 14             	mov    0x14(%ebp),%eax
+  802479:	8d 70 04             	lea    0x4(%eax),%esi
+  80247c:	83 ec 08             	sub    $0x8,%esp
+  80247f:	53                   	push   %ebx
+  802480:	ff 30                	push   (%eax)
+  802482:	ff d7                	call   *%edi
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	89 75 14             	mov    %esi,0x14(%ebp)
+  80248a:	e9 d4 fe ff ff       	jmp    802363 <vprintfmt+0x11>
+  80248f:	89 55 10             	mov    %edx,0x10(%ebp)
+  802492:	8b 45 14             	mov    0x14(%ebp),%eax
+  802495:	8d 70 04             	lea    0x4(%eax),%esi
+  802498:	8b 10                	mov    (%eax),%edx
+  80249a:	89 d0                	mov    %edx,%eax
+  80249c:	f7 d8                	neg    %eax
+  80249e:	0f 48 c2             	cmovs  %edx,%eax
+  8024a1:	83 f8 12             	cmp    $0x12,%eax
+  8024a4:	7f 23                	jg     8024c9 <vprintfmt+0x177>
+  8024a6:	8b 14 85 c0 35 80 00 	mov    0x8035c0(,%eax,4),%edx
+  8024ad:	85 d2                	test   %edx,%edx
+  8024af:	74 18                	je     8024c9 <vprintfmt+0x177>
+  8024b1:	52                   	push   %edx
+  8024b2:	68 7b 32 80 00       	push   $0x80327b
+  8024b7:	53                   	push   %ebx
+  8024b8:	57                   	push   %edi
+  8024b9:	e8 77 fe ff ff       	call   802335 <printfmt>
+  8024be:	83 c4 10             	add    $0x10,%esp
+  8024c1:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024c4:	e9 9a fe ff ff       	jmp    802363 <vprintfmt+0x11>
+  8024c9:	50                   	push   %eax
+  8024ca:	68 2f 33 80 00       	push   $0x80332f
+  8024cf:	53                   	push   %ebx
+  8024d0:	57                   	push   %edi
+  8024d1:	e8 5f fe ff ff       	call   802335 <printfmt>
+  8024d6:	83 c4 10             	add    $0x10,%esp
+  8024d9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024dc:	e9 82 fe ff ff       	jmp    802363 <vprintfmt+0x11>
+  8024e1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e7:	83 c0 04             	add    $0x4,%eax
+  8024ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8024ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024f0:	8b 00                	mov    (%eax),%eax
+  8024f2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024f5:	85 c0                	test   %eax,%eax
+  8024f7:	0f 84 61 03 00 00    	je     80285e <vprintfmt+0x50c>
+  8024fd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802501:	7e 06                	jle    802509 <vprintfmt+0x1b7>
+  802503:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802507:	75 29                	jne    802532 <vprintfmt+0x1e0>
+  802509:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80250c:	8d 70 01             	lea    0x1(%eax),%esi
+  80250f:	0f b6 00             	movzbl (%eax),%eax
+  802512:	0f be d0             	movsbl %al,%edx
+  802515:	85 d2                	test   %edx,%edx
+  802517:	0f 84 bb 00 00 00    	je     8025d8 <vprintfmt+0x286>
+  80251d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802520:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802523:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802526:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802529:	eb 7a                	jmp    8025a5 <vprintfmt+0x253>
+  80252b:	c7 45 d0 28 33 80 00 	movl   $0x803328,-0x30(%ebp)
+  802532:	83 ec 08             	sub    $0x8,%esp
+  802535:	ff 75 d4             	push   -0x2c(%ebp)
+  802538:	ff 75 d0             	push   -0x30(%ebp)
+  80253b:	e8 e0 03 00 00       	call   802920 <strnlen>
+  802540:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802543:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802546:	83 c4 10             	add    $0x10,%esp
+  802549:	85 d2                	test   %edx,%edx
+  80254b:	0f 8e d6 02 00 00    	jle    802827 <vprintfmt+0x4d5>
+  802551:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802555:	83 ec 08             	sub    $0x8,%esp
+  802558:	53                   	push   %ebx
+  802559:	56                   	push   %esi
+  80255a:	ff d7                	call   *%edi
+  80255c:	83 c4 10             	add    $0x10,%esp
+  80255f:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802563:	75 f0                	jne    802555 <vprintfmt+0x203>
+  802565:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802568:	8d 70 01             	lea    0x1(%eax),%esi
+  80256b:	0f b6 00             	movzbl (%eax),%eax
+  80256e:	0f be d0             	movsbl %al,%edx
+  802571:	85 d2                	test   %edx,%edx
+  802573:	0f 84 da 02 00 00    	je     802853 <vprintfmt+0x501>
+  802579:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80257c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80257f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802582:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802585:	eb 1e                	jmp    8025a5 <vprintfmt+0x253>
+  802587:	83 ec 08             	sub    $0x8,%esp
+  80258a:	ff 75 0c             	push   0xc(%ebp)
+  80258d:	52                   	push   %edx
+  80258e:	ff 55 08             	call   *0x8(%ebp)
+  802591:	83 c4 10             	add    $0x10,%esp
+  802594:	83 eb 01             	sub    $0x1,%ebx
+  802597:	83 c6 01             	add    $0x1,%esi
+  80259a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80259e:	0f be d0             	movsbl %al,%edx
+  8025a1:	85 d2                	test   %edx,%edx
+  8025a3:	74 2a                	je     8025cf <vprintfmt+0x27d>
+  8025a5:	85 ff                	test   %edi,%edi
+  8025a7:	78 05                	js     8025ae <vprintfmt+0x25c>
+  8025a9:	83 ef 01             	sub    $0x1,%edi
+  8025ac:	78 59                	js     802607 <vprintfmt+0x2b5>
+  8025ae:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8025b2:	74 d3                	je     802587 <vprintfmt+0x235>
+  8025b4:	0f be c0             	movsbl %al,%eax
+  8025b7:	83 e8 20             	sub    $0x20,%eax
+  8025ba:	83 f8 5e             	cmp    $0x5e,%eax
+  8025bd:	76 c8                	jbe    802587 <vprintfmt+0x235>
+  8025bf:	83 ec 08             	sub    $0x8,%esp
+  8025c2:	ff 75 0c             	push   0xc(%ebp)
+  8025c5:	6a 3f                	push   $0x3f
+  8025c7:	ff 55 08             	call   *0x8(%ebp)
+  8025ca:	83 c4 10             	add    $0x10,%esp
+  8025cd:	eb c5                	jmp    802594 <vprintfmt+0x242>
+  8025cf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025d8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025db:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025df:	7e 1b                	jle    8025fc <vprintfmt+0x2aa>
+  8025e1:	83 ec 08             	sub    $0x8,%esp
+  8025e4:	53                   	push   %ebx
+  8025e5:	6a 20                	push   $0x20
+  8025e7:	ff d7                	call   *%edi
+  8025e9:	83 c4 10             	add    $0x10,%esp
+  8025ec:	83 ee 01             	sub    $0x1,%esi
+  8025ef:	75 f0                	jne    8025e1 <vprintfmt+0x28f>
+  8025f1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025f7:	e9 67 fd ff ff       	jmp    802363 <vprintfmt+0x11>
+  8025fc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  802602:	e9 5c fd ff ff       	jmp    802363 <vprintfmt+0x11>
+  802607:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80260a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80260d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802610:	eb c6                	jmp    8025d8 <vprintfmt+0x286>
+  802612:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802615:	89 55 10             	mov    %edx,0x10(%ebp)
+  802618:	83 f9 01             	cmp    $0x1,%ecx
+  80261b:	7f 1f                	jg     80263c <vprintfmt+0x2ea>
+  80261d:	85 c9                	test   %ecx,%ecx
+  80261f:	74 67                	je     802688 <vprintfmt+0x336>
+  802621:	8b 45 14             	mov    0x14(%ebp),%eax
+  802624:	8b 30                	mov    (%eax),%esi
+  802626:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802629:	89 f0                	mov    %esi,%eax
+  80262b:	c1 f8 1f             	sar    $0x1f,%eax
+  80262e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802631:	8b 45 14             	mov    0x14(%ebp),%eax
+  802634:	8d 40 04             	lea    0x4(%eax),%eax
+  802637:	89 45 14             	mov    %eax,0x14(%ebp)
+  80263a:	eb 17                	jmp    802653 <vprintfmt+0x301>
+  80263c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80263f:	8b 50 04             	mov    0x4(%eax),%edx
+  802642:	8b 00                	mov    (%eax),%eax
+  802644:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802647:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80264a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264d:	8d 40 08             	lea    0x8(%eax),%eax
+  802650:	89 45 14             	mov    %eax,0x14(%ebp)
+  802653:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802656:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802659:	be 0a 00 00 00       	mov    $0xa,%esi
+  80265e:	85 c9                	test   %ecx,%ecx
+  802660:	0f 89 12 01 00 00    	jns    802778 <vprintfmt+0x426>
+  802666:	83 ec 08             	sub    $0x8,%esp
+  802669:	53                   	push   %ebx
+  80266a:	6a 2d                	push   $0x2d
+  80266c:	ff d7                	call   *%edi
+  80266e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802671:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802674:	f7 da                	neg    %edx
+  802676:	83 d1 00             	adc    $0x0,%ecx
+  802679:	f7 d9                	neg    %ecx
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	be 0a 00 00 00       	mov    $0xa,%esi
+  802683:	e9 f0 00 00 00       	jmp    802778 <vprintfmt+0x426>
+  802688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80268b:	8b 30                	mov    (%eax),%esi
+  80268d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802690:	89 f0                	mov    %esi,%eax
+  802692:	c1 f8 1f             	sar    $0x1f,%eax
+  802695:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80269b:	8d 40 04             	lea    0x4(%eax),%eax
+  80269e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026a1:	eb b0                	jmp    802653 <vprintfmt+0x301>
+  8026a3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026a6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026a9:	83 f9 01             	cmp    $0x1,%ecx
+  8026ac:	7f 1e                	jg     8026cc <vprintfmt+0x37a>
+  8026ae:	85 c9                	test   %ecx,%ecx
+  8026b0:	74 32                	je     8026e4 <vprintfmt+0x392>
+  8026b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026b5:	8b 10                	mov    (%eax),%edx
+  8026b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8026bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026c2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026c7:	e9 ac 00 00 00       	jmp    802778 <vprintfmt+0x426>
+  8026cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026cf:	8b 10                	mov    (%eax),%edx
+  8026d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8026d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026da:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026df:	e9 94 00 00 00       	jmp    802778 <vprintfmt+0x426>
+  8026e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026e7:	8b 10                	mov    (%eax),%edx
+  8026e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8026f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026f4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026f9:	eb 7d                	jmp    802778 <vprintfmt+0x426>
+  8026fb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026fe:	89 55 10             	mov    %edx,0x10(%ebp)
+  802701:	83 f9 01             	cmp    $0x1,%ecx
+  802704:	7f 1b                	jg     802721 <vprintfmt+0x3cf>
+  802706:	85 c9                	test   %ecx,%ecx
+  802708:	74 2c                	je     802736 <vprintfmt+0x3e4>
+  80270a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80270d:	8b 10                	mov    (%eax),%edx
+  80270f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802714:	8d 40 04             	lea    0x4(%eax),%eax
+  802717:	89 45 14             	mov    %eax,0x14(%ebp)
+  80271a:	be 08 00 00 00       	mov    $0x8,%esi
+  80271f:	eb 57                	jmp    802778 <vprintfmt+0x426>
+  802721:	8b 45 14             	mov    0x14(%ebp),%eax
+  802724:	8b 10                	mov    (%eax),%edx
+  802726:	8b 48 04             	mov    0x4(%eax),%ecx
+  802729:	8d 40 08             	lea    0x8(%eax),%eax
+  80272c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80272f:	be 08 00 00 00       	mov    $0x8,%esi
+  802734:	eb 42                	jmp    802778 <vprintfmt+0x426>
+  802736:	8b 45 14             	mov    0x14(%ebp),%eax
+  802739:	8b 10                	mov    (%eax),%edx
+  80273b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802740:	8d 40 04             	lea    0x4(%eax),%eax
+  802743:	89 45 14             	mov    %eax,0x14(%ebp)
+  802746:	be 08 00 00 00       	mov    $0x8,%esi
+  80274b:	eb 2b                	jmp    802778 <vprintfmt+0x426>
+  80274d:	89 55 10             	mov    %edx,0x10(%ebp)
+  802750:	83 ec 08             	sub    $0x8,%esp
+  802753:	53                   	push   %ebx
+  802754:	6a 30                	push   $0x30
+  802756:	ff d7                	call   *%edi
+  802758:	83 c4 08             	add    $0x8,%esp
+  80275b:	53                   	push   %ebx
+  80275c:	6a 78                	push   $0x78
+  80275e:	ff d7                	call   *%edi
+  802760:	8b 45 14             	mov    0x14(%ebp),%eax
+  802763:	8b 10                	mov    (%eax),%edx
+  802765:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80276a:	83 c4 10             	add    $0x10,%esp
+  80276d:	8d 40 04             	lea    0x4(%eax),%eax
+  802770:	89 45 14             	mov    %eax,0x14(%ebp)
+  802773:	be 10 00 00 00       	mov    $0x10,%esi
+  802778:	83 ec 0c             	sub    $0xc,%esp
+  80277b:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80277f:	50                   	push   %eax
+  802780:	ff 75 e4             	push   -0x1c(%ebp)
+  802783:	56                   	push   %esi
+  802784:	51                   	push   %ecx
+  802785:	52                   	push   %edx
+  802786:	89 da                	mov    %ebx,%edx
+  802788:	89 f8                	mov    %edi,%eax
+  80278a:	e8 d8 fa ff ff       	call   802267 <printnum>
+  80278f:	83 c4 20             	add    $0x20,%esp
+  802792:	e9 cc fb ff ff       	jmp    802363 <vprintfmt+0x11>
+  802797:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80279a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80279d:	83 f9 01             	cmp    $0x1,%ecx
+  8027a0:	7f 1b                	jg     8027bd <vprintfmt+0x46b>
+  8027a2:	85 c9                	test   %ecx,%ecx
+  8027a4:	74 2c                	je     8027d2 <vprintfmt+0x480>
+  8027a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027a9:	8b 10                	mov    (%eax),%edx
+  8027ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8027b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027b6:	be 10 00 00 00       	mov    $0x10,%esi
+  8027bb:	eb bb                	jmp    802778 <vprintfmt+0x426>
+  8027bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c0:	8b 10                	mov    (%eax),%edx
+  8027c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8027c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027cb:	be 10 00 00 00       	mov    $0x10,%esi
+  8027d0:	eb a6                	jmp    802778 <vprintfmt+0x426>
+  8027d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027d5:	8b 10                	mov    (%eax),%edx
+  8027d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8027df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027e2:	be 10 00 00 00       	mov    $0x10,%esi
+  8027e7:	eb 8f                	jmp    802778 <vprintfmt+0x426>
+  8027e9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027ec:	83 ec 08             	sub    $0x8,%esp
+  8027ef:	53                   	push   %ebx
+  8027f0:	6a 25                	push   $0x25
+  8027f2:	ff d7                	call   *%edi
+  8027f4:	83 c4 10             	add    $0x10,%esp
+  8027f7:	e9 67 fb ff ff       	jmp    802363 <vprintfmt+0x11>
+  8027fc:	83 ec 08             	sub    $0x8,%esp
+  8027ff:	53                   	push   %ebx
+  802800:	6a 25                	push   $0x25
+  802802:	ff d7                	call   *%edi
+  802804:	83 c4 10             	add    $0x10,%esp
+  802807:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80280b:	0f 84 ba fb ff ff    	je     8023cb <vprintfmt+0x79>
+  802811:	89 75 10             	mov    %esi,0x10(%ebp)
+  802814:	89 f0                	mov    %esi,%eax
+  802816:	83 e8 01             	sub    $0x1,%eax
+  802819:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80281d:	75 f7                	jne    802816 <vprintfmt+0x4c4>
+  80281f:	89 45 10             	mov    %eax,0x10(%ebp)
+  802822:	e9 3c fb ff ff       	jmp    802363 <vprintfmt+0x11>
+  802827:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80282a:	8d 70 01             	lea    0x1(%eax),%esi
+  80282d:	0f b6 00             	movzbl (%eax),%eax
+  802830:	0f be d0             	movsbl %al,%edx
+  802833:	85 d2                	test   %edx,%edx
+  802835:	74 11                	je     802848 <vprintfmt+0x4f6>
+  802837:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80283a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80283d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802840:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802843:	e9 5d fd ff ff       	jmp    8025a5 <vprintfmt+0x253>
+  802848:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80284b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80284e:	e9 10 fb ff ff       	jmp    802363 <vprintfmt+0x11>
+  802853:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802856:	89 45 14             	mov    %eax,0x14(%ebp)
+  802859:	e9 05 fb ff ff       	jmp    802363 <vprintfmt+0x11>
+  80285e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802862:	7e 0a                	jle    80286e <vprintfmt+0x51c>
+  802864:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802868:	0f 85 bd fc ff ff    	jne    80252b <vprintfmt+0x1d9>
+  80286e:	ba 28 00 00 00       	mov    $0x28,%edx
+  802873:	b8 28 00 00 00       	mov    $0x28,%eax
+  802878:	be 29 33 80 00       	mov    $0x803329,%esi
+  80287d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802880:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802883:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802886:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802889:	e9 17 fd ff ff       	jmp    8025a5 <vprintfmt+0x253>
+  80288e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802891:	5b                   	pop    %ebx
+  802892:	5e                   	pop    %esi
+  802893:	5f                   	pop    %edi
+  802894:	5d                   	pop    %ebp
+  802895:	c3                   	ret
+
+00802896 <vsnprintf>:
+  802896:	55                   	push   %ebp
+  802897:	89 e5                	mov    %esp,%ebp
+  802899:	83 ec 18             	sub    $0x18,%esp
+  80289c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8028a5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8028a9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8028ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8028b3:	85 c0                	test   %eax,%eax
+  8028b5:	74 26                	je     8028dd <vsnprintf+0x47>
+  8028b7:	85 d2                	test   %edx,%edx
+  8028b9:	7e 22                	jle    8028dd <vsnprintf+0x47>
+  8028bb:	ff 75 14             	push   0x14(%ebp)
+  8028be:	ff 75 10             	push   0x10(%ebp)
+  8028c1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028c4:	50                   	push   %eax
+  8028c5:	68 18 23 80 00       	push   $0x802318
+  8028ca:	e8 83 fa ff ff       	call   802352 <vprintfmt>
+  8028cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028d2:	c6 00 00             	movb   $0x0,(%eax)
+  8028d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028d8:	83 c4 10             	add    $0x10,%esp
+  8028db:	c9                   	leave
+  8028dc:	c3                   	ret
+  8028dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028e2:	eb f7                	jmp    8028db <vsnprintf+0x45>
+
+008028e4 <snprintf>:
+  8028e4:	55                   	push   %ebp
+  8028e5:	89 e5                	mov    %esp,%ebp
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+  8028ea:	8d 45 14             	lea    0x14(%ebp),%eax
+  8028ed:	50                   	push   %eax
+  8028ee:	ff 75 10             	push   0x10(%ebp)
+  8028f1:	ff 75 0c             	push   0xc(%ebp)
+  8028f4:	ff 75 08             	push   0x8(%ebp)
+  8028f7:	e8 9a ff ff ff       	call   802896 <vsnprintf>
+  8028fc:	c9                   	leave
+  8028fd:	c3                   	ret
+
+008028fe <strlen>:
+  8028fe:	55                   	push   %ebp
+  8028ff:	89 e5                	mov    %esp,%ebp
+  802901:	8b 55 08             	mov    0x8(%ebp),%edx
+  802904:	80 3a 00             	cmpb   $0x0,(%edx)
+  802907:	74 10                	je     802919 <strlen+0x1b>
+  802909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290e:	83 c0 01             	add    $0x1,%eax
+  802911:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802915:	75 f7                	jne    80290e <strlen+0x10>
+  802917:	5d                   	pop    %ebp
+  802918:	c3                   	ret
+  802919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291e:	eb f7                	jmp    802917 <strlen+0x19>
+
+00802920 <strnlen>:
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802926:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802929:	85 d2                	test   %edx,%edx
+  80292b:	74 16                	je     802943 <strnlen+0x23>
+  80292d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802932:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802936:	74 09                	je     802941 <strnlen+0x21>
+  802938:	83 c0 01             	add    $0x1,%eax
+  80293b:	39 d0                	cmp    %edx,%eax
+  80293d:	75 f3                	jne    802932 <strnlen+0x12>
+  80293f:	89 d0                	mov    %edx,%eax
+  802941:	5d                   	pop    %ebp
+  802942:	c3                   	ret
+  802943:	b8 00 00 00 00       	mov    $0x0,%eax
+  802948:	eb f7                	jmp    802941 <strnlen+0x21>
+
+0080294a <strcpy>:
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	53                   	push   %ebx
+  80294e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802951:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802954:	b8 00 00 00 00       	mov    $0x0,%eax
+  802959:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80295d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802960:	83 c0 01             	add    $0x1,%eax
+  802963:	84 d2                	test   %dl,%dl
+  802965:	75 f2                	jne    802959 <strcpy+0xf>
+  802967:	89 c8                	mov    %ecx,%eax
+  802969:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80296c:	c9                   	leave
+  80296d:	c3                   	ret
+
+0080296e <strcat>:
+  80296e:	55                   	push   %ebp
+  80296f:	89 e5                	mov    %esp,%ebp
+  802971:	53                   	push   %ebx
+  802972:	83 ec 10             	sub    $0x10,%esp
+  802975:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802978:	53                   	push   %ebx
+  802979:	e8 80 ff ff ff       	call   8028fe <strlen>
+  80297e:	83 c4 08             	add    $0x8,%esp
+  802981:	ff 75 0c             	push   0xc(%ebp)
+  802984:	01 d8                	add    %ebx,%eax
+  802986:	50                   	push   %eax
+  802987:	e8 be ff ff ff       	call   80294a <strcpy>
+  80298c:	89 d8                	mov    %ebx,%eax
+  80298e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+
+00802993 <strncpy>:
+  802993:	55                   	push   %ebp
+  802994:	89 e5                	mov    %esp,%ebp
+  802996:	56                   	push   %esi
+  802997:	53                   	push   %ebx
+  802998:	8b 75 08             	mov    0x8(%ebp),%esi
+  80299b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80299e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029a1:	85 db                	test   %ebx,%ebx
+  8029a3:	74 17                	je     8029bc <strncpy+0x29>
+  8029a5:	01 f3                	add    %esi,%ebx
+  8029a7:	89 f0                	mov    %esi,%eax
+  8029a9:	83 c0 01             	add    $0x1,%eax
+  8029ac:	0f b6 0a             	movzbl (%edx),%ecx
+  8029af:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029b2:	80 f9 01             	cmp    $0x1,%cl
+  8029b5:	83 da ff             	sbb    $0xffffffff,%edx
+  8029b8:	39 c3                	cmp    %eax,%ebx
+  8029ba:	75 ed                	jne    8029a9 <strncpy+0x16>
+  8029bc:	89 f0                	mov    %esi,%eax
+  8029be:	5b                   	pop    %ebx
+  8029bf:	5e                   	pop    %esi
+  8029c0:	5d                   	pop    %ebp
+  8029c1:	c3                   	ret
+
+008029c2 <strlcpy>:
+  8029c2:	55                   	push   %ebp
+  8029c3:	89 e5                	mov    %esp,%ebp
+  8029c5:	56                   	push   %esi
+  8029c6:	53                   	push   %ebx
+  8029c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029d0:	89 f0                	mov    %esi,%eax
+  8029d2:	85 db                	test   %ebx,%ebx
+  8029d4:	74 1e                	je     8029f4 <strlcpy+0x32>
+  8029d6:	83 eb 01             	sub    $0x1,%ebx
+  8029d9:	74 16                	je     8029f1 <strlcpy+0x2f>
+  8029db:	01 f3                	add    %esi,%ebx
+  8029dd:	0f b6 0a             	movzbl (%edx),%ecx
+  8029e0:	84 c9                	test   %cl,%cl
+  8029e2:	74 0d                	je     8029f1 <strlcpy+0x2f>
+  8029e4:	83 c2 01             	add    $0x1,%edx
+  8029e7:	83 c0 01             	add    $0x1,%eax
+  8029ea:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029ed:	39 d8                	cmp    %ebx,%eax
+  8029ef:	75 ec                	jne    8029dd <strlcpy+0x1b>
+  8029f1:	c6 00 00             	movb   $0x0,(%eax)
+  8029f4:	29 f0                	sub    %esi,%eax
+  8029f6:	5b                   	pop    %ebx
+  8029f7:	5e                   	pop    %esi
+  8029f8:	5d                   	pop    %ebp
+  8029f9:	c3                   	ret
+
+008029fa <strcmp>:
+  8029fa:	55                   	push   %ebp
+  8029fb:	89 e5                	mov    %esp,%ebp
+  8029fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a03:	0f b6 01             	movzbl (%ecx),%eax
+  802a06:	84 c0                	test   %al,%al
+  802a08:	74 11                	je     802a1b <strcmp+0x21>
+  802a0a:	38 02                	cmp    %al,(%edx)
+  802a0c:	75 0d                	jne    802a1b <strcmp+0x21>
+  802a0e:	83 c1 01             	add    $0x1,%ecx
+  802a11:	83 c2 01             	add    $0x1,%edx
+  802a14:	0f b6 01             	movzbl (%ecx),%eax
+  802a17:	84 c0                	test   %al,%al
+  802a19:	75 ef                	jne    802a0a <strcmp+0x10>
+  802a1b:	0f b6 c0             	movzbl %al,%eax
+  802a1e:	0f b6 12             	movzbl (%edx),%edx
+  802a21:	29 d0                	sub    %edx,%eax
+  802a23:	5d                   	pop    %ebp
+  802a24:	c3                   	ret
+
+00802a25 <strncmp>:
+  802a25:	55                   	push   %ebp
+  802a26:	89 e5                	mov    %esp,%ebp
+  802a28:	53                   	push   %ebx
+  802a29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a2f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a37:	85 d2                	test   %edx,%edx
+  802a39:	74 2e                	je     802a69 <strncmp+0x44>
+  802a3b:	0f b6 01             	movzbl (%ecx),%eax
+  802a3e:	84 c0                	test   %al,%al
+  802a40:	74 16                	je     802a58 <strncmp+0x33>
+  802a42:	3a 03                	cmp    (%ebx),%al
+  802a44:	75 12                	jne    802a58 <strncmp+0x33>
+  802a46:	83 c1 01             	add    $0x1,%ecx
+  802a49:	83 c3 01             	add    $0x1,%ebx
+  802a4c:	83 ea 01             	sub    $0x1,%edx
+  802a4f:	75 ea                	jne    802a3b <strncmp+0x16>
+  802a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a56:	eb 11                	jmp    802a69 <strncmp+0x44>
+  802a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5d:	85 d2                	test   %edx,%edx
+  802a5f:	74 08                	je     802a69 <strncmp+0x44>
+  802a61:	0f b6 01             	movzbl (%ecx),%eax
+  802a64:	0f b6 13             	movzbl (%ebx),%edx
+  802a67:	29 d0                	sub    %edx,%eax
+  802a69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a6c:	c9                   	leave
+  802a6d:	c3                   	ret
+
+00802a6e <strchr>:
+  802a6e:	55                   	push   %ebp
+  802a6f:	89 e5                	mov    %esp,%ebp
+  802a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a74:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a78:	0f b6 10             	movzbl (%eax),%edx
+  802a7b:	84 d2                	test   %dl,%dl
+  802a7d:	74 15                	je     802a94 <strchr+0x26>
+  802a7f:	38 d1                	cmp    %dl,%cl
+  802a81:	74 0f                	je     802a92 <strchr+0x24>
+  802a83:	83 c0 01             	add    $0x1,%eax
+  802a86:	0f b6 10             	movzbl (%eax),%edx
+  802a89:	84 d2                	test   %dl,%dl
+  802a8b:	75 f2                	jne    802a7f <strchr+0x11>
+  802a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a92:	5d                   	pop    %ebp
+  802a93:	c3                   	ret
+  802a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a99:	eb f7                	jmp    802a92 <strchr+0x24>
+
+00802a9b <strfind>:
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	53                   	push   %ebx
+  802a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aa5:	0f b6 18             	movzbl (%eax),%ebx
+  802aa8:	38 d3                	cmp    %dl,%bl
+  802aaa:	74 14                	je     802ac0 <strfind+0x25>
+  802aac:	89 d1                	mov    %edx,%ecx
+  802aae:	84 db                	test   %bl,%bl
+  802ab0:	74 0e                	je     802ac0 <strfind+0x25>
+  802ab2:	83 c0 01             	add    $0x1,%eax
+  802ab5:	0f b6 10             	movzbl (%eax),%edx
+  802ab8:	38 ca                	cmp    %cl,%dl
+  802aba:	74 04                	je     802ac0 <strfind+0x25>
+  802abc:	84 d2                	test   %dl,%dl
+  802abe:	75 f2                	jne    802ab2 <strfind+0x17>
+  802ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <memset>:
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	57                   	push   %edi
+  802ac9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802acc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802acf:	85 c9                	test   %ecx,%ecx
+  802ad1:	74 20                	je     802af3 <memset+0x2e>
+  802ad3:	89 f8                	mov    %edi,%eax
+  802ad5:	09 c8                	or     %ecx,%eax
+  802ad7:	a8 03                	test   $0x3,%al
+  802ad9:	75 12                	jne    802aed <memset+0x28>
+  802adb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802adf:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802ae5:	c1 e9 02             	shr    $0x2,%ecx
+  802ae8:	fc                   	cld
+  802ae9:	f3 ab                	rep stos %eax,%es:(%edi)
+  802aeb:	eb 06                	jmp    802af3 <memset+0x2e>
+  802aed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af0:	fc                   	cld
+  802af1:	f3 aa                	rep stos %al,%es:(%edi)
+  802af3:	89 f8                	mov    %edi,%eax
+  802af5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <memmove>:
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	57                   	push   %edi
+  802afe:	56                   	push   %esi
+  802aff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b02:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b05:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802b08:	39 c6                	cmp    %eax,%esi
+  802b0a:	73 32                	jae    802b3e <memmove+0x44>
+  802b0c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802b0f:	39 d0                	cmp    %edx,%eax
+  802b11:	73 2b                	jae    802b3e <memmove+0x44>
+  802b13:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b16:	89 d6                	mov    %edx,%esi
+  802b18:	09 fe                	or     %edi,%esi
+  802b1a:	09 ce                	or     %ecx,%esi
+  802b1c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b22:	75 0e                	jne    802b32 <memmove+0x38>
+  802b24:	83 ef 04             	sub    $0x4,%edi
+  802b27:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b2a:	c1 e9 02             	shr    $0x2,%ecx
+  802b2d:	fd                   	std
+  802b2e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b30:	eb 09                	jmp    802b3b <memmove+0x41>
+  802b32:	83 ef 01             	sub    $0x1,%edi
+  802b35:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b38:	fd                   	std
+  802b39:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b3b:	fc                   	cld
+  802b3c:	eb 1a                	jmp    802b58 <memmove+0x5e>
+  802b3e:	89 f2                	mov    %esi,%edx
+  802b40:	09 c2                	or     %eax,%edx
+  802b42:	09 ca                	or     %ecx,%edx
+  802b44:	f6 c2 03             	test   $0x3,%dl
+  802b47:	75 0a                	jne    802b53 <memmove+0x59>
+  802b49:	c1 e9 02             	shr    $0x2,%ecx
+  802b4c:	89 c7                	mov    %eax,%edi
+  802b4e:	fc                   	cld
+  802b4f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b51:	eb 05                	jmp    802b58 <memmove+0x5e>
+  802b53:	89 c7                	mov    %eax,%edi
+  802b55:	fc                   	cld
+  802b56:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b58:	5e                   	pop    %esi
+  802b59:	5f                   	pop    %edi
+  802b5a:	5d                   	pop    %ebp
+  802b5b:	c3                   	ret
+
+00802b5c <memcpy>:
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	83 ec 0c             	sub    $0xc,%esp
+  802b62:	ff 75 10             	push   0x10(%ebp)
+  802b65:	ff 75 0c             	push   0xc(%ebp)
+  802b68:	ff 75 08             	push   0x8(%ebp)
+  802b6b:	e8 8a ff ff ff       	call   802afa <memmove>
+  802b70:	c9                   	leave
+  802b71:	c3                   	ret
+
+00802b72 <memcmp>:
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	56                   	push   %esi
+  802b76:	53                   	push   %ebx
+  802b77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b7d:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b80:	85 f6                	test   %esi,%esi
+  802b82:	74 29                	je     802bad <memcmp+0x3b>
+  802b84:	01 c6                	add    %eax,%esi
+  802b86:	0f b6 08             	movzbl (%eax),%ecx
+  802b89:	0f b6 1a             	movzbl (%edx),%ebx
+  802b8c:	38 d9                	cmp    %bl,%cl
+  802b8e:	75 11                	jne    802ba1 <memcmp+0x2f>
+  802b90:	83 c0 01             	add    $0x1,%eax
+  802b93:	83 c2 01             	add    $0x1,%edx
+  802b96:	39 c6                	cmp    %eax,%esi
+  802b98:	75 ec                	jne    802b86 <memcmp+0x14>
+  802b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9f:	eb 08                	jmp    802ba9 <memcmp+0x37>
+  802ba1:	0f b6 c1             	movzbl %cl,%eax
+  802ba4:	0f b6 db             	movzbl %bl,%ebx
+  802ba7:	29 d8                	sub    %ebx,%eax
+  802ba9:	5b                   	pop    %ebx
+  802baa:	5e                   	pop    %esi
+  802bab:	5d                   	pop    %ebp
+  802bac:	c3                   	ret
+  802bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb2:	eb f5                	jmp    802ba9 <memcmp+0x37>
+
+00802bb4 <memfind>:
+  802bb4:	55                   	push   %ebp
+  802bb5:	89 e5                	mov    %esp,%ebp
+  802bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bbd:	89 c2                	mov    %eax,%edx
+  802bbf:	03 55 10             	add    0x10(%ebp),%edx
+  802bc2:	39 d0                	cmp    %edx,%eax
+  802bc4:	73 0d                	jae    802bd3 <memfind+0x1f>
+  802bc6:	38 08                	cmp    %cl,(%eax)
+  802bc8:	74 0d                	je     802bd7 <memfind+0x23>
+  802bca:	83 c0 01             	add    $0x1,%eax
+  802bcd:	39 c2                	cmp    %eax,%edx
+  802bcf:	75 f5                	jne    802bc6 <memfind+0x12>
+  802bd1:	eb 06                	jmp    802bd9 <memfind+0x25>
+  802bd3:	89 c2                	mov    %eax,%edx
+  802bd5:	eb 02                	jmp    802bd9 <memfind+0x25>
+  802bd7:	89 c2                	mov    %eax,%edx
+  802bd9:	89 d0                	mov    %edx,%eax
+  802bdb:	5d                   	pop    %ebp
+  802bdc:	c3                   	ret
+
+00802bdd <strtol>:
+  802bdd:	55                   	push   %ebp
+  802bde:	89 e5                	mov    %esp,%ebp
+  802be0:	57                   	push   %edi
+  802be1:	56                   	push   %esi
+  802be2:	53                   	push   %ebx
+  802be3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802be6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802be9:	0f b6 02             	movzbl (%edx),%eax
+  802bec:	3c 20                	cmp    $0x20,%al
+  802bee:	74 04                	je     802bf4 <strtol+0x17>
+  802bf0:	3c 09                	cmp    $0x9,%al
+  802bf2:	75 0e                	jne    802c02 <strtol+0x25>
+  802bf4:	83 c2 01             	add    $0x1,%edx
+  802bf7:	0f b6 02             	movzbl (%edx),%eax
+  802bfa:	3c 20                	cmp    $0x20,%al
+  802bfc:	74 f6                	je     802bf4 <strtol+0x17>
+  802bfe:	3c 09                	cmp    $0x9,%al
+  802c00:	74 f2                	je     802bf4 <strtol+0x17>
+  802c02:	3c 2b                	cmp    $0x2b,%al
+  802c04:	74 2a                	je     802c30 <strtol+0x53>
+  802c06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0b:	3c 2d                	cmp    $0x2d,%al
+  802c0d:	74 2b                	je     802c3a <strtol+0x5d>
+  802c0f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c15:	75 0f                	jne    802c26 <strtol+0x49>
+  802c17:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c1a:	74 28                	je     802c44 <strtol+0x67>
+  802c1c:	85 db                	test   %ebx,%ebx
+  802c1e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c23:	0f 44 d8             	cmove  %eax,%ebx
+  802c26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c2b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c2e:	eb 46                	jmp    802c76 <strtol+0x99>
+  802c30:	83 c2 01             	add    $0x1,%edx
+  802c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c38:	eb d5                	jmp    802c0f <strtol+0x32>
+  802c3a:	83 c2 01             	add    $0x1,%edx
+  802c3d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c42:	eb cb                	jmp    802c0f <strtol+0x32>
+  802c44:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c48:	74 0e                	je     802c58 <strtol+0x7b>
+  802c4a:	85 db                	test   %ebx,%ebx
+  802c4c:	75 d8                	jne    802c26 <strtol+0x49>
+  802c4e:	83 c2 01             	add    $0x1,%edx
+  802c51:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c56:	eb ce                	jmp    802c26 <strtol+0x49>
+  802c58:	83 c2 02             	add    $0x2,%edx
+  802c5b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c60:	eb c4                	jmp    802c26 <strtol+0x49>
+  802c62:	0f be c0             	movsbl %al,%eax
+  802c65:	83 e8 30             	sub    $0x30,%eax
+  802c68:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c6b:	7d 3a                	jge    802ca7 <strtol+0xca>
+  802c6d:	83 c2 01             	add    $0x1,%edx
+  802c70:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c74:	01 c1                	add    %eax,%ecx
+  802c76:	0f b6 02             	movzbl (%edx),%eax
+  802c79:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c7c:	89 f3                	mov    %esi,%ebx
+  802c7e:	80 fb 09             	cmp    $0x9,%bl
+  802c81:	76 df                	jbe    802c62 <strtol+0x85>
+  802c83:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802c86:	89 f3                	mov    %esi,%ebx
+  802c88:	80 fb 19             	cmp    $0x19,%bl
+  802c8b:	77 08                	ja     802c95 <strtol+0xb8>
+  802c8d:	0f be c0             	movsbl %al,%eax
+  802c90:	83 e8 57             	sub    $0x57,%eax
+  802c93:	eb d3                	jmp    802c68 <strtol+0x8b>
+  802c95:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802c98:	89 f3                	mov    %esi,%ebx
+  802c9a:	80 fb 19             	cmp    $0x19,%bl
+  802c9d:	77 08                	ja     802ca7 <strtol+0xca>
+  802c9f:	0f be c0             	movsbl %al,%eax
+  802ca2:	83 e8 37             	sub    $0x37,%eax
+  802ca5:	eb c1                	jmp    802c68 <strtol+0x8b>
+  802ca7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802cab:	74 05                	je     802cb2 <strtol+0xd5>
+  802cad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb0:	89 10                	mov    %edx,(%eax)
+  802cb2:	89 c8                	mov    %ecx,%eax
+  802cb4:	f7 d8                	neg    %eax
+  802cb6:	85 ff                	test   %edi,%edi
+  802cb8:	0f 45 c8             	cmovne %eax,%ecx
+  802cbb:	89 c8                	mov    %ecx,%eax
+  802cbd:	5b                   	pop    %ebx
+  802cbe:	5e                   	pop    %esi
+  802cbf:	5f                   	pop    %edi
+  802cc0:	5d                   	pop    %ebp
+  802cc1:	c3                   	ret
+
+00802cc2 <ipc_recv>:
+  802cc2:	55                   	push   %ebp
+  802cc3:	89 e5                	mov    %esp,%ebp
+  802cc5:	56                   	push   %esi
+  802cc6:	53                   	push   %ebx
+  802cc7:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ccd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cd0:	85 c0                	test   %eax,%eax
+  802cd2:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cd7:	0f 44 c2             	cmove  %edx,%eax
+  802cda:	83 ec 0c             	sub    $0xc,%esp
+  802cdd:	50                   	push   %eax
+  802cde:	e8 73 d7 ff ff       	call   800456 <sys_ipc_recv>
+  802ce3:	83 c4 10             	add    $0x10,%esp
+  802ce6:	85 c0                	test   %eax,%eax
+  802ce8:	78 2a                	js     802d14 <ipc_recv+0x52>
+  802cea:	a1 10 50 80 00       	mov    0x805010,%eax
+  802cef:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802cf5:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802cfb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d01:	85 f6                	test   %esi,%esi
+  802d03:	74 02                	je     802d07 <ipc_recv+0x45>
+  802d05:	89 0e                	mov    %ecx,(%esi)
+  802d07:	85 db                	test   %ebx,%ebx
+  802d09:	74 02                	je     802d0d <ipc_recv+0x4b>
+  802d0b:	89 13                	mov    %edx,(%ebx)
+  802d0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d10:	5b                   	pop    %ebx
+  802d11:	5e                   	pop    %esi
+  802d12:	5d                   	pop    %ebp
+  802d13:	c3                   	ret
+  802d14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d1e:	eb e1                	jmp    802d01 <ipc_recv+0x3f>
+
+00802d20 <ipc_send>:
+  802d20:	55                   	push   %ebp
+  802d21:	89 e5                	mov    %esp,%ebp
+  802d23:	57                   	push   %edi
+  802d24:	56                   	push   %esi
+  802d25:	53                   	push   %ebx
+  802d26:	83 ec 0c             	sub    $0xc,%esp
+  802d29:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d2f:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d32:	85 db                	test   %ebx,%ebx
+  802d34:	74 1e                	je     802d54 <ipc_send+0x34>
+  802d36:	56                   	push   %esi
+  802d37:	53                   	push   %ebx
+  802d38:	57                   	push   %edi
+  802d39:	ff 75 08             	push   0x8(%ebp)
+  802d3c:	e8 a2 d7 ff ff       	call   8004e3 <sys_ipc_send>
+  802d41:	83 c4 10             	add    $0x10,%esp
+  802d44:	85 c0                	test   %eax,%eax
+  802d46:	74 2a                	je     802d72 <ipc_send+0x52>
+  802d48:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d4b:	75 13                	jne    802d60 <ipc_send+0x40>
+  802d4d:	e8 0e d4 ff ff       	call   800160 <sys_yield>
+  802d52:	eb e2                	jmp    802d36 <ipc_send+0x16>
+  802d54:	be 00 00 00 00       	mov    $0x0,%esi
+  802d59:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d5e:	eb d6                	jmp    802d36 <ipc_send+0x16>
+  802d60:	50                   	push   %eax
+  802d61:	68 2c 36 80 00       	push   $0x80362c
+  802d66:	6a 4f                	push   $0x4f
+  802d68:	68 6f 36 80 00       	push   $0x80366f
+  802d6d:	e8 06 f4 ff ff       	call   802178 <_panic>
+  802d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d75:	5b                   	pop    %ebx
+  802d76:	5e                   	pop    %esi
+  802d77:	5f                   	pop    %edi
+  802d78:	5d                   	pop    %ebp
+  802d79:	c3                   	ret
+
+00802d7a <ipc_call>:
+  802d7a:	55                   	push   %ebp
+  802d7b:	89 e5                	mov    %esp,%ebp
+  802d7d:	57                   	push   %edi
+  802d7e:	56                   	push   %esi
+  802d7f:	53                   	push   %ebx
+  802d80:	83 ec 0c             	sub    $0xc,%esp
+  802d83:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d87:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d8c:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d90:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d94:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d99:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802d9d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da6:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802daa:	eb 05                	jmp    802db1 <ipc_call+0x37>
+  802dac:	e8 af d3 ff ff       	call   800160 <sys_yield>
+  802db1:	83 ec 0c             	sub    $0xc,%esp
+  802db4:	56                   	push   %esi
+  802db5:	53                   	push   %ebx
+  802db6:	57                   	push   %edi
+  802db7:	ff 75 0c             	push   0xc(%ebp)
+  802dba:	ff 75 08             	push   0x8(%ebp)
+  802dbd:	e8 71 d7 ff ff       	call   800533 <sys_ipc_call>
+  802dc2:	83 c4 20             	add    $0x20,%esp
+  802dc5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dc8:	74 e2                	je     802dac <ipc_call+0x32>
+  802dca:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802dcd:	74 2d                	je     802dfc <ipc_call+0x82>
+  802dcf:	85 c0                	test   %eax,%eax
+  802dd1:	78 4f                	js     802e22 <ipc_call+0xa8>
+  802dd3:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802dd7:	74 10                	je     802de9 <ipc_call+0x6f>
+  802dd9:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dde:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802de4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802de7:	89 02                	mov    %eax,(%edx)
+  802de9:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dee:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df7:	5b                   	pop    %ebx
+  802df8:	5e                   	pop    %esi
+  802df9:	5f                   	pop    %edi
+  802dfa:	5d                   	pop    %ebp
+  802dfb:	c3                   	ret
+  802dfc:	ff 75 14             	push   0x14(%ebp)
+  802dff:	ff 75 10             	push   0x10(%ebp)
+  802e02:	ff 75 0c             	push   0xc(%ebp)
+  802e05:	ff 75 08             	push   0x8(%ebp)
+  802e08:	e8 13 ff ff ff       	call   802d20 <ipc_send>
+  802e0d:	83 c4 0c             	add    $0xc,%esp
+  802e10:	ff 75 1c             	push   0x1c(%ebp)
+  802e13:	ff 75 18             	push   0x18(%ebp)
+  802e16:	6a 00                	push   $0x0
+  802e18:	e8 a5 fe ff ff       	call   802cc2 <ipc_recv>
+  802e1d:	83 c4 10             	add    $0x10,%esp
+  802e20:	eb d2                	jmp    802df4 <ipc_call+0x7a>
+  802e22:	50                   	push   %eax
+  802e23:	68 79 36 80 00       	push   $0x803679
+  802e28:	6a 6d                	push   $0x6d
+  802e2a:	68 6f 36 80 00       	push   $0x80366f
+  802e2f:	e8 44 f3 ff ff       	call   802178 <_panic>
+
+00802e34 <ipc_reply_recv>:
+  802e34:	55                   	push   %ebp
+  802e35:	89 e5                	mov    %esp,%ebp
+  802e37:	57                   	push   %edi
+  802e38:	56                   	push   %esi
+  802e39:	53                   	push   %ebx
+  802e3a:	83 ec 0c             	sub    $0xc,%esp
+  802e3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e40:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e43:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e46:	85 db                	test   %ebx,%ebx
+  802e48:	0f 84 ac 00 00 00    	je     802efa <ipc_reply_recv+0xc6>
+  802e4e:	85 f6                	test   %esi,%esi
+  802e50:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e55:	0f 45 c6             	cmovne %esi,%eax
+  802e58:	83 ec 0c             	sub    $0xc,%esp
+  802e5b:	50                   	push   %eax
+  802e5c:	ff 75 14             	push   0x14(%ebp)
+  802e5f:	53                   	push   %ebx
+  802e60:	ff 75 0c             	push   0xc(%ebp)
+  802e63:	ff 75 08             	push   0x8(%ebp)
+  802e66:	e8 e9 d6 ff ff       	call   800554 <sys_ipc_reply_recv>
+  802e6b:	83 c4 20             	add    $0x20,%esp
+  802e6e:	85 c0                	test   %eax,%eax
+  802e70:	78 3a                	js     802eac <ipc_reply_recv+0x78>
+  802e72:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e76:	74 10                	je     802e88 <ipc_reply_recv+0x54>
+  802e78:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e7d:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e83:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e86:	89 02                	mov    %eax,(%edx)
+  802e88:	85 ff                	test   %edi,%edi
+  802e8a:	74 0d                	je     802e99 <ipc_reply_recv+0x65>
+  802e8c:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e91:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e97:	89 07                	mov    %eax,(%edi)
+  802e99:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e9e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ea4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea7:	5b                   	pop    %ebx
+  802ea8:	5e                   	pop    %esi
+  802ea9:	5f                   	pop    %edi
+  802eaa:	5d                   	pop    %ebp
+  802eab:	c3                   	ret
+  802eac:	ff 75 14             	push   0x14(%ebp)
+  802eaf:	53                   	push   %ebx
+  802eb0:	ff 75 0c             	push   0xc(%ebp)
+  802eb3:	ff 75 08             	push   0x8(%ebp)
+  802eb6:	e8 4b d5 ff ff       	call   800406 <sys_ipc_try_send>
+  802ebb:	89 c2                	mov    %eax,%edx
+  802ebd:	c1 ea 1f             	shr    $0x1f,%edx
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802ec6:	0f 95 c1             	setne  %cl
+  802ec9:	84 d1                	test   %dl,%cl
+  802ecb:	74 05                	je     802ed2 <ipc_reply_recv+0x9e>
+  802ecd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ed0:	75 12                	jne    802ee4 <ipc_reply_recv+0xb0>
+  802ed2:	83 ec 04             	sub    $0x4,%esp
+  802ed5:	57                   	push   %edi
+  802ed6:	56                   	push   %esi
+  802ed7:	ff 75 18             	push   0x18(%ebp)
+  802eda:	e8 e3 fd ff ff       	call   802cc2 <ipc_recv>
+  802edf:	83 c4 10             	add    $0x10,%esp
+  802ee2:	eb c0                	jmp    802ea4 <ipc_reply_recv+0x70>
+  802ee4:	83 ec 04             	sub    $0x4,%esp
+  802ee7:	50                   	push   %eax
+  802ee8:	ff 75 08             	push   0x8(%ebp)
+  802eeb:	68 4c 36 80 00       	push   $0x80364c
+  802ef0:	e8 5e f3 ff ff       	call   802253 <cprintf>
+  802ef5:	83 c4 10             	add    $0x10,%esp
+  802ef8:	eb d8                	jmp    802ed2 <ipc_reply_recv+0x9e>
+  802efa:	85 f6                	test   %esi,%esi
+  802efc:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f01:	0f 45 c6             	cmovne %esi,%eax
+  802f04:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f09:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f10:	e9 43 ff ff ff       	jmp    802e58 <ipc_reply_recv+0x24>
+
+00802f15 <ipc_find_env>:
+  802f15:	55                   	push   %ebp
+  802f16:	89 e5                	mov    %esp,%ebp
+  802f18:	83 ec 14             	sub    $0x14,%esp
+  802f1b:	ff 75 08             	push   0x8(%ebp)
+  802f1e:	e8 81 d4 ff ff       	call   8003a4 <sys_env_service>
+  802f23:	85 c0                	test   %eax,%eax
+  802f25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f2a:	0f 48 c2             	cmovs  %edx,%eax
+  802f2d:	c9                   	leave
+  802f2e:	c3                   	ret
+
+00802f2f <pageref>:
+  802f2f:	55                   	push   %ebp
+  802f30:	89 e5                	mov    %esp,%ebp
+  802f32:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f35:	89 c2                	mov    %eax,%edx
+  802f37:	c1 ea 16             	shr    $0x16,%edx
+  802f3a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f46:	f6 c1 01             	test   $0x1,%cl
+  802f49:	74 22                	je     802f6d <pageref+0x3e>
+  802f4b:	c1 e8 0c             	shr    $0xc,%eax
+  802f4e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f55:	a8 01                	test   $0x1,%al
+  802f57:	74 14                	je     802f6d <pageref+0x3e>
+  802f59:	c1 e8 0c             	shr    $0xc,%eax
+  802f5c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f5f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f66:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f6a:	0f b7 d2             	movzwl %dx,%edx
+  802f6d:	89 d0                	mov    %edx,%eax
+  802f6f:	5d                   	pop    %ebp
+  802f70:	c3                   	ret
+
+00802f71 <__udivmoddi4>:
+  802f71:	55                   	push   %ebp
+  802f72:	57                   	push   %edi
+  802f73:	56                   	push   %esi
+  802f74:	53                   	push   %ebx
+  802f75:	83 ec 24             	sub    $0x24,%esp
+  802f78:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f7c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f80:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f84:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f88:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f8c:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f90:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f94:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f98:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fa6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fab:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fb2:	00 
+  802fb3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fba:	00 
+  802fbb:	89 fb                	mov    %edi,%ebx
+  802fbd:	eb 08                	jmp    802fc7 <__udivmoddi4+0x56>
+  802fbf:	83 e9 01             	sub    $0x1,%ecx
+  802fc2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fc5:	74 68                	je     80302f <__udivmoddi4+0xbe>
+  802fc7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fcb:	01 c0                	add    %eax,%eax
+  802fcd:	89 c6                	mov    %eax,%esi
+  802fcf:	89 d7                	mov    %edx,%edi
+  802fd1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fd5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fd9:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fdc:	d3 ea                	shr    %cl,%edx
+  802fde:	f6 c1 20             	test   $0x20,%cl
+  802fe1:	74 04                	je     802fe7 <__udivmoddi4+0x76>
+  802fe3:	89 d0                	mov    %edx,%eax
+  802fe5:	31 d2                	xor    %edx,%edx
+  802fe7:	83 e0 01             	and    $0x1,%eax
+  802fea:	89 04 24             	mov    %eax,(%esp)
+  802fed:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ff4:	00 
+  802ff5:	8b 04 24             	mov    (%esp),%eax
+  802ff8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ffc:	09 f0                	or     %esi,%eax
+  802ffe:	09 fa                	or     %edi,%edx
+  803000:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803004:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803008:	39 f0                	cmp    %esi,%eax
+  80300a:	89 d5                	mov    %edx,%ebp
+  80300c:	19 fd                	sbb    %edi,%ebp
+  80300e:	72 af                	jb     802fbf <__udivmoddi4+0x4e>
+  803010:	29 f0                	sub    %esi,%eax
+  803012:	19 fa                	sbb    %edi,%edx
+  803014:	89 cf                	mov    %ecx,%edi
+  803016:	c1 ef 05             	shr    $0x5,%edi
+  803019:	83 e7 01             	and    $0x1,%edi
+  80301c:	89 fe                	mov    %edi,%esi
+  80301e:	83 f6 01             	xor    $0x1,%esi
+  803021:	d3 e6                	shl    %cl,%esi
+  803023:	d3 e7                	shl    %cl,%edi
+  803025:	09 74 24 18          	or     %esi,0x18(%esp)
+  803029:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80302d:	eb 90                	jmp    802fbf <__udivmoddi4+0x4e>
+  80302f:	85 db                	test   %ebx,%ebx
+  803031:	74 05                	je     803038 <__udivmoddi4+0xc7>
+  803033:	89 03                	mov    %eax,(%ebx)
+  803035:	89 53 04             	mov    %edx,0x4(%ebx)
+  803038:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80303c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803040:	83 c4 24             	add    $0x24,%esp
+  803043:	5b                   	pop    %ebx
+  803044:	5e                   	pop    %esi
+  803045:	5f                   	pop    %edi
+  803046:	5d                   	pop    %ebp
+  803047:	c3                   	ret
+
+00803048 <__udivdi3>:
+  803048:	83 ec 08             	sub    $0x8,%esp
+  80304b:	6a 00                	push   $0x0
+  80304d:	ff 74 24 1c          	push   0x1c(%esp)
+  803051:	ff 74 24 1c          	push   0x1c(%esp)
+  803055:	ff 74 24 1c          	push   0x1c(%esp)
+  803059:	ff 74 24 1c          	push   0x1c(%esp)
+  80305d:	e8 0f ff ff ff       	call   802f71 <__udivmoddi4>
+  803062:	83 c4 1c             	add    $0x1c,%esp
+  803065:	c3                   	ret
+
+00803066 <__umoddi3>:
+  803066:	83 ec 18             	sub    $0x18,%esp
+  803069:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80306d:	50                   	push   %eax
+  80306e:	ff 74 24 2c          	push   0x2c(%esp)
+  803072:	ff 74 24 2c          	push   0x2c(%esp)
+  803076:	ff 74 24 2c          	push   0x2c(%esp)
+  80307a:	ff 74 24 2c          	push   0x2c(%esp)
+  80307e:	e8 ee fe ff ff       	call   802f71 <__udivmoddi4>
+  803083:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803087:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80308b:	83 c4 2c             	add    $0x2c,%esp
+  80308e:	c3                   	ret
+
+0080308f <__divdi3>:
+  80308f:	53                   	push   %ebx
+  803090:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803094:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803098:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80309c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030a0:	85 d2                	test   %edx,%edx
+  8030a2:	78 12                	js     8030b6 <__divdi3+0x27>
+  8030a4:	85 db                	test   %ebx,%ebx
+  8030a6:	78 2e                	js     8030d6 <__divdi3+0x47>
+  8030a8:	53                   	push   %ebx
+  8030a9:	51                   	push   %ecx
+  8030aa:	52                   	push   %edx
+  8030ab:	50                   	push   %eax
+  8030ac:	e8 97 ff ff ff       	call   803048 <__udivdi3>
+  8030b1:	83 c4 10             	add    $0x10,%esp
+  8030b4:	eb 1e                	jmp    8030d4 <__divdi3+0x45>
+  8030b6:	f7 d8                	neg    %eax
+  8030b8:	83 d2 00             	adc    $0x0,%edx
+  8030bb:	f7 da                	neg    %edx
+  8030bd:	85 db                	test   %ebx,%ebx
+  8030bf:	78 2a                	js     8030eb <__divdi3+0x5c>
+  8030c1:	53                   	push   %ebx
+  8030c2:	51                   	push   %ecx
+  8030c3:	52                   	push   %edx
+  8030c4:	50                   	push   %eax
+  8030c5:	e8 7e ff ff ff       	call   803048 <__udivdi3>
+  8030ca:	83 c4 10             	add    $0x10,%esp
+  8030cd:	f7 d8                	neg    %eax
+  8030cf:	83 d2 00             	adc    $0x0,%edx
+  8030d2:	f7 da                	neg    %edx
+  8030d4:	5b                   	pop    %ebx
+  8030d5:	c3                   	ret
+  8030d6:	f7 d9                	neg    %ecx
+  8030d8:	83 d3 00             	adc    $0x0,%ebx
+  8030db:	f7 db                	neg    %ebx
+  8030dd:	53                   	push   %ebx
+  8030de:	51                   	push   %ecx
+  8030df:	52                   	push   %edx
+  8030e0:	50                   	push   %eax
+  8030e1:	e8 62 ff ff ff       	call   803048 <__udivdi3>
+  8030e6:	83 c4 10             	add    $0x10,%esp
+  8030e9:	eb e2                	jmp    8030cd <__divdi3+0x3e>
+  8030eb:	f7 d9                	neg    %ecx
+  8030ed:	83 d3 00             	adc    $0x0,%ebx
+  8030f0:	f7 db                	neg    %ebx
+  8030f2:	53                   	push   %ebx
+  8030f3:	51                   	push   %ecx
+  8030f4:	52                   	push   %edx
+  8030f5:	50                   	push   %eax
+  8030f6:	e8 4d ff ff ff       	call   803048 <__udivdi3>
+  8030fb:	83 c4 10             	add    $0x10,%esp
+  8030fe:	eb d4                	jmp    8030d4 <__divdi3+0x45>
+
+00803100 <__moddi3>:
+  803100:	55                   	push   %ebp
+  803101:	57                   	push   %edi
+  803102:	56                   	push   %esi
+  803103:	53                   	push   %ebx
+  803104:	83 ec 0c             	sub    $0xc,%esp
+  803107:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80310b:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80310f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803113:	89 e9                	mov    %ebp,%ecx
+  803115:	f7 d9                	neg    %ecx
+  803117:	89 d0                	mov    %edx,%eax
+  803119:	83 d0 00             	adc    $0x0,%eax
+  80311c:	f7 d8                	neg    %eax
+  80311e:	0f 49 e9             	cmovns %ecx,%ebp
+  803121:	0f 49 d0             	cmovns %eax,%edx
+  803124:	52                   	push   %edx
+  803125:	55                   	push   %ebp
+  803126:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80312a:	f7 da                	neg    %edx
+  80312c:	89 d8                	mov    %ebx,%eax
+  80312e:	83 d0 00             	adc    $0x0,%eax
+  803131:	f7 d8                	neg    %eax
+  803133:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803138:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80313c:	0f 48 c3             	cmovs  %ebx,%eax
+  80313f:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803143:	ff 74 24 0c          	push   0xc(%esp)
+  803147:	ff 74 24 0c          	push   0xc(%esp)
+  80314b:	e8 16 ff ff ff       	call   803066 <__umoddi3>
+  803150:	83 c4 10             	add    $0x10,%esp
+  803153:	85 db                	test   %ebx,%ebx
+  803155:	78 08                	js     80315f <__moddi3+0x5f>
+  803157:	83 c4 0c             	add    $0xc,%esp
+  80315a:	5b                   	pop    %ebx
+  80315b:	5e                   	pop    %esi
+  80315c:	5f                   	pop    %edi
+  80315d:	5d                   	pop    %ebp
+  80315e:	c3                   	ret
+  80315f:	f7 d8                	neg    %eax
+  803161:	83 d2 00             	adc    $0x0,%edx
+  803164:	f7 da                	neg    %edx
+  803166:	eb ef                	jmp    803157 <__moddi3+0x57>
@@ -0,0 +1,5069 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	e8 5c 0c 00 00       	call   800c9c <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+  800042:	81 3d 10 50 80 00 ac 	cmpl   $0xeec001ac,0x805010
+  800049:	01 c0 ee 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+  80004e:	a1 f4 01 c0 ee       	mov    0xeec001f4,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 d1 31 80 00       	push   $0x8031d1
+  80005d:	e8 4d 01 00 00       	call   8001af <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	a1 f4 01 c0 ee       	mov    0xeec001f4,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 5c 15 00 00       	call   8015d2 <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 e9 14 00 00       	call   801574 <ipc_recv>
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 c0 31 80 00       	push   $0x8031c0
+  800097:	e8 13 01 00 00       	call   8001af <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ac:	e8 eb 0b 00 00       	call   800c9c <sys_getenvid>
+  8000b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b6:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c1:	a3 10 50 80 00       	mov    %eax,0x805010
+  8000c6:	85 db                	test   %ebx,%ebx
+  8000c8:	7e 07                	jle    8000d1 <libmain+0x30>
+  8000ca:	8b 06                	mov    (%esi),%eax
+  8000cc:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+  8000d6:	e8 58 ff ff ff       	call   800033 <umain>
+  8000db:	e8 0a 00 00 00       	call   8000ea <exit>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <exit>:
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	83 ec 08             	sub    $0x8,%esp
+  8000f0:	a1 10 50 80 00       	mov    0x805010,%eax
+  8000f5:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000fb:	85 c0                	test   %eax,%eax
+  8000fd:	75 14                	jne    800113 <exit+0x29>
+  8000ff:	e8 a7 18 00 00       	call   8019ab <close_all>
+  800104:	83 ec 0c             	sub    $0xc,%esp
+  800107:	6a 00                	push   $0x0
+  800109:	e8 4d 0b 00 00       	call   800c5b <sys_env_destroy>
+  80010e:	83 c4 10             	add    $0x10,%esp
+  800111:	c9                   	leave
+  800112:	c3                   	ret
+  800113:	e8 b0 12 00 00       	call   8013c8 <sys_lease_complete>
+  800118:	eb e5                	jmp    8000ff <exit+0x15>
+
+0080011a <putch>:
+  80011a:	55                   	push   %ebp
+  80011b:	89 e5                	mov    %esp,%ebp
+  80011d:	53                   	push   %ebx
+  80011e:	83 ec 04             	sub    $0x4,%esp
+  800121:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800124:	8b 13                	mov    (%ebx),%edx
+  800126:	8d 42 01             	lea    0x1(%edx),%eax
+  800129:	89 03                	mov    %eax,(%ebx)
+  80012b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80012e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800132:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800137:	74 09                	je     800142 <putch+0x28>
+  800139:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80013d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800140:	c9                   	leave
+  800141:	c3                   	ret
+  800142:	83 ec 08             	sub    $0x8,%esp
+  800145:	68 ff 00 00 00       	push   $0xff
+  80014a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80014d:	50                   	push   %eax
+  80014e:	e8 cb 0a 00 00       	call   800c1e <sys_cputs>
+  800153:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	eb db                	jmp    800139 <putch+0x1f>
+
+0080015e <vcprintf>:
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800167:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80016e:	00 00 00 
+  800171:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800178:	00 00 00 
+  80017b:	ff 75 0c             	push   0xc(%ebp)
+  80017e:	ff 75 08             	push   0x8(%ebp)
+  800181:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800187:	50                   	push   %eax
+  800188:	68 1a 01 80 00       	push   $0x80011a
+  80018d:	e8 1c 01 00 00       	call   8002ae <vprintfmt>
+  800192:	83 c4 08             	add    $0x8,%esp
+  800195:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80019b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001a1:	50                   	push   %eax
+  8001a2:	e8 77 0a 00 00       	call   800c1e <sys_cputs>
+  8001a7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ad:	c9                   	leave
+  8001ae:	c3                   	ret
+
+008001af <cprintf>:
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	83 ec 10             	sub    $0x10,%esp
+  8001b5:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001b8:	50                   	push   %eax
+  8001b9:	ff 75 08             	push   0x8(%ebp)
+  8001bc:	e8 9d ff ff ff       	call   80015e <vcprintf>
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+
+008001c3 <printnum>:
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	57                   	push   %edi
+  8001c7:	56                   	push   %esi
+  8001c8:	53                   	push   %ebx
+  8001c9:	83 ec 1c             	sub    $0x1c,%esp
+  8001cc:	89 c3                	mov    %eax,%ebx
+  8001ce:	89 d6                	mov    %edx,%esi
+  8001d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d6:	89 d1                	mov    %edx,%ecx
+  8001d8:	89 c2                	mov    %eax,%edx
+  8001da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001dd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001ed:	39 c2                	cmp    %eax,%edx
+  8001ef:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f2:	73 4b                	jae    80023f <printnum+0x7c>
+  8001f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8001f7:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8001fa:	85 ff                	test   %edi,%edi
+  8001fc:	7e 11                	jle    80020f <printnum+0x4c>
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	56                   	push   %esi
+  800202:	ff 75 18             	push   0x18(%ebp)
+  800205:	ff d3                	call   *%ebx
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	83 ef 01             	sub    $0x1,%edi
+  80020d:	75 ef                	jne    8001fe <printnum+0x3b>
+  80020f:	83 ec 08             	sub    $0x8,%esp
+  800212:	56                   	push   %esi
+  800213:	83 ec 04             	sub    $0x4,%esp
+  800216:	ff 75 e4             	push   -0x1c(%ebp)
+  800219:	ff 75 e0             	push   -0x20(%ebp)
+  80021c:	ff 75 dc             	push   -0x24(%ebp)
+  80021f:	ff 75 d8             	push   -0x28(%ebp)
+  800222:	e8 96 2e 00 00       	call   8030bd <__umoddi3>
+  800227:	83 c4 14             	add    $0x14,%esp
+  80022a:	0f be 80 f2 31 80 00 	movsbl 0x8031f2(%eax),%eax
+  800231:	50                   	push   %eax
+  800232:	ff d3                	call   *%ebx
+  800234:	83 c4 10             	add    $0x10,%esp
+  800237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023a:	5b                   	pop    %ebx
+  80023b:	5e                   	pop    %esi
+  80023c:	5f                   	pop    %edi
+  80023d:	5d                   	pop    %ebp
+  80023e:	c3                   	ret
+  80023f:	83 ec 0c             	sub    $0xc,%esp
+  800242:	ff 75 18             	push   0x18(%ebp)
+  800245:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800248:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80024b:	52                   	push   %edx
+  80024c:	50                   	push   %eax
+  80024d:	83 ec 08             	sub    $0x8,%esp
+  800250:	ff 75 e4             	push   -0x1c(%ebp)
+  800253:	ff 75 e0             	push   -0x20(%ebp)
+  800256:	ff 75 dc             	push   -0x24(%ebp)
+  800259:	ff 75 d8             	push   -0x28(%ebp)
+  80025c:	e8 3e 2e 00 00       	call   80309f <__udivdi3>
+  800261:	83 c4 18             	add    $0x18,%esp
+  800264:	52                   	push   %edx
+  800265:	50                   	push   %eax
+  800266:	89 f2                	mov    %esi,%edx
+  800268:	89 d8                	mov    %ebx,%eax
+  80026a:	e8 54 ff ff ff       	call   8001c3 <printnum>
+  80026f:	83 c4 20             	add    $0x20,%esp
+  800272:	eb 9b                	jmp    80020f <printnum+0x4c>
+
+00800274 <sprintputch>:
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80027a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80027e:	8b 10                	mov    (%eax),%edx
+  800280:	3b 50 04             	cmp    0x4(%eax),%edx
+  800283:	73 0a                	jae    80028f <sprintputch+0x1b>
+  800285:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800288:	89 08                	mov    %ecx,(%eax)
+  80028a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028d:	88 02                	mov    %al,(%edx)
+  80028f:	5d                   	pop    %ebp
+  800290:	c3                   	ret
+
+00800291 <printfmt>:
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	83 ec 08             	sub    $0x8,%esp
+  800297:	8d 45 14             	lea    0x14(%ebp),%eax
+  80029a:	50                   	push   %eax
+  80029b:	ff 75 10             	push   0x10(%ebp)
+  80029e:	ff 75 0c             	push   0xc(%ebp)
+  8002a1:	ff 75 08             	push   0x8(%ebp)
+  8002a4:	e8 05 00 00 00       	call   8002ae <vprintfmt>
+  8002a9:	83 c4 10             	add    $0x10,%esp
+  8002ac:	c9                   	leave
+  8002ad:	c3                   	ret
+
+008002ae <vprintfmt>:
+  8002ae:	55                   	push   %ebp
+  8002af:	89 e5                	mov    %esp,%ebp
+  8002b1:	57                   	push   %edi
+  8002b2:	56                   	push   %esi
+  8002b3:	53                   	push   %ebx
+  8002b4:	83 ec 2c             	sub    $0x2c,%esp
+  8002b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002ba:	89 df                	mov    %ebx,%edi
+  8002bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002bf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002c2:	8d 70 01             	lea    0x1(%eax),%esi
+  8002c5:	0f b6 00             	movzbl (%eax),%eax
+  8002c8:	83 f8 25             	cmp    $0x25,%eax
+  8002cb:	74 1e                	je     8002eb <vprintfmt+0x3d>
+  8002cd:	85 c0                	test   %eax,%eax
+  8002cf:	0f 84 15 05 00 00    	je     8007ea <vprintfmt+0x53c>
+  8002d5:	83 ec 08             	sub    $0x8,%esp
+  8002d8:	53                   	push   %ebx
+  8002d9:	50                   	push   %eax
+  8002da:	ff d7                	call   *%edi
+  8002dc:	83 c6 01             	add    $0x1,%esi
+  8002df:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002e3:	83 c4 10             	add    $0x10,%esp
+  8002e6:	83 f8 25             	cmp    $0x25,%eax
+  8002e9:	75 e2                	jne    8002cd <vprintfmt+0x1f>
+  8002eb:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8002ef:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002f6:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8002fd:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800304:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800309:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80030c:	8d 56 01             	lea    0x1(%esi),%edx
+  80030f:	0f b6 0e             	movzbl (%esi),%ecx
+  800312:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800315:	3c 55                	cmp    $0x55,%al
+  800317:	0f 87 3b 04 00 00    	ja     800758 <vprintfmt+0x4aa>
+  80031d:	0f b6 c0             	movzbl %al,%eax
+  800320:	ff 24 85 40 33 80 00 	jmp    *0x803340(,%eax,4)
+  800327:	89 75 10             	mov    %esi,0x10(%ebp)
+  80032a:	eb 93                	jmp    8002bf <vprintfmt+0x11>
+  80032c:	89 d6                	mov    %edx,%esi
+  80032e:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800332:	eb d8                	jmp    80030c <vprintfmt+0x5e>
+  800334:	89 d6                	mov    %edx,%esi
+  800336:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80033a:	eb d0                	jmp    80030c <vprintfmt+0x5e>
+  80033c:	0f b6 c9             	movzbl %cl,%ecx
+  80033f:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800342:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800345:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800349:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80034c:	83 f9 09             	cmp    $0x9,%ecx
+  80034f:	77 6f                	ja     8003c0 <vprintfmt+0x112>
+  800351:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800354:	83 c2 01             	add    $0x1,%edx
+  800357:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80035a:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80035e:	0f be 02             	movsbl (%edx),%eax
+  800361:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800364:	83 fe 09             	cmp    $0x9,%esi
+  800367:	76 eb                	jbe    800354 <vprintfmt+0xa6>
+  800369:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80036c:	89 d6                	mov    %edx,%esi
+  80036e:	eb 13                	jmp    800383 <vprintfmt+0xd5>
+  800370:	8b 45 14             	mov    0x14(%ebp),%eax
+  800373:	8b 00                	mov    (%eax),%eax
+  800375:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800378:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037b:	8d 40 04             	lea    0x4(%eax),%eax
+  80037e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800381:	89 d6                	mov    %edx,%esi
+  800383:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800387:	79 83                	jns    80030c <vprintfmt+0x5e>
+  800389:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80038c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80038f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800396:	e9 71 ff ff ff       	jmp    80030c <vprintfmt+0x5e>
+  80039b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80039e:	85 c9                	test   %ecx,%ecx
+  8003a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a5:	0f 49 c1             	cmovns %ecx,%eax
+  8003a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ab:	89 d6                	mov    %edx,%esi
+  8003ad:	e9 5a ff ff ff       	jmp    80030c <vprintfmt+0x5e>
+  8003b2:	89 d6                	mov    %edx,%esi
+  8003b4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003bb:	e9 4c ff ff ff       	jmp    80030c <vprintfmt+0x5e>
+  8003c0:	89 d6                	mov    %edx,%esi
+  8003c2:	eb bf                	jmp    800383 <vprintfmt+0xd5>
+  8003c4:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8003c8:	89 d6                	mov    %edx,%esi
+  8003ca:	e9 3d ff ff ff       	jmp    80030c <vprintfmt+0x5e>
+  8003cf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8d 70 04             	lea    0x4(%eax),%esi
+  8003d8:	83 ec 08             	sub    $0x8,%esp
+  8003db:	53                   	push   %ebx
+  8003dc:	ff 30                	push   (%eax)
+  8003de:	ff d7                	call   *%edi
+  8003e0:	83 c4 10             	add    $0x10,%esp
+  8003e3:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003e6:	e9 d4 fe ff ff       	jmp    8002bf <vprintfmt+0x11>
+  8003eb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f1:	8d 70 04             	lea    0x4(%eax),%esi
+  8003f4:	8b 10                	mov    (%eax),%edx
+  8003f6:	89 d0                	mov    %edx,%eax
+  8003f8:	f7 d8                	neg    %eax
+  8003fa:	0f 48 c2             	cmovs  %edx,%eax
+  8003fd:	83 f8 12             	cmp    $0x12,%eax
+  800400:	7f 23                	jg     800425 <vprintfmt+0x177>
+  800402:	8b 14 85 a0 34 80 00 	mov    0x8034a0(,%eax,4),%edx
+  800409:	85 d2                	test   %edx,%edx
+  80040b:	74 18                	je     800425 <vprintfmt+0x177>
+  80040d:	52                   	push   %edx
+  80040e:	68 67 36 80 00       	push   $0x803667
+  800413:	53                   	push   %ebx
+  800414:	57                   	push   %edi
+  800415:	e8 77 fe ff ff       	call   800291 <printfmt>
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	89 75 14             	mov    %esi,0x14(%ebp)
+  800420:	e9 9a fe ff ff       	jmp    8002bf <vprintfmt+0x11>
+  800425:	50                   	push   %eax
+  800426:	68 0a 32 80 00       	push   $0x80320a
+  80042b:	53                   	push   %ebx
+  80042c:	57                   	push   %edi
+  80042d:	e8 5f fe ff ff       	call   800291 <printfmt>
+  800432:	83 c4 10             	add    $0x10,%esp
+  800435:	89 75 14             	mov    %esi,0x14(%ebp)
+  800438:	e9 82 fe ff ff       	jmp    8002bf <vprintfmt+0x11>
+  80043d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800440:	8b 45 14             	mov    0x14(%ebp),%eax
+  800443:	83 c0 04             	add    $0x4,%eax
+  800446:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800449:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044c:	8b 00                	mov    (%eax),%eax
+  80044e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800451:	85 c0                	test   %eax,%eax
+  800453:	0f 84 61 03 00 00    	je     8007ba <vprintfmt+0x50c>
+  800459:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80045d:	7e 06                	jle    800465 <vprintfmt+0x1b7>
+  80045f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800463:	75 29                	jne    80048e <vprintfmt+0x1e0>
+  800465:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800468:	8d 70 01             	lea    0x1(%eax),%esi
+  80046b:	0f b6 00             	movzbl (%eax),%eax
+  80046e:	0f be d0             	movsbl %al,%edx
+  800471:	85 d2                	test   %edx,%edx
+  800473:	0f 84 bb 00 00 00    	je     800534 <vprintfmt+0x286>
+  800479:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80047c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80047f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800482:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800485:	eb 7a                	jmp    800501 <vprintfmt+0x253>
+  800487:	c7 45 d0 03 32 80 00 	movl   $0x803203,-0x30(%ebp)
+  80048e:	83 ec 08             	sub    $0x8,%esp
+  800491:	ff 75 d4             	push   -0x2c(%ebp)
+  800494:	ff 75 d0             	push   -0x30(%ebp)
+  800497:	e8 e0 03 00 00       	call   80087c <strnlen>
+  80049c:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80049f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	85 d2                	test   %edx,%edx
+  8004a7:	0f 8e d6 02 00 00    	jle    800783 <vprintfmt+0x4d5>
+  8004ad:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004b1:	83 ec 08             	sub    $0x8,%esp
+  8004b4:	53                   	push   %ebx
+  8004b5:	56                   	push   %esi
+  8004b6:	ff d7                	call   *%edi
+  8004b8:	83 c4 10             	add    $0x10,%esp
+  8004bb:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004bf:	75 f0                	jne    8004b1 <vprintfmt+0x203>
+  8004c1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c4:	8d 70 01             	lea    0x1(%eax),%esi
+  8004c7:	0f b6 00             	movzbl (%eax),%eax
+  8004ca:	0f be d0             	movsbl %al,%edx
+  8004cd:	85 d2                	test   %edx,%edx
+  8004cf:	0f 84 da 02 00 00    	je     8007af <vprintfmt+0x501>
+  8004d5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004d8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004db:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004de:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004e1:	eb 1e                	jmp    800501 <vprintfmt+0x253>
+  8004e3:	83 ec 08             	sub    $0x8,%esp
+  8004e6:	ff 75 0c             	push   0xc(%ebp)
+  8004e9:	52                   	push   %edx
+  8004ea:	ff 55 08             	call   *0x8(%ebp)
+  8004ed:	83 c4 10             	add    $0x10,%esp
+  8004f0:	83 eb 01             	sub    $0x1,%ebx
+  8004f3:	83 c6 01             	add    $0x1,%esi
+  8004f6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004fa:	0f be d0             	movsbl %al,%edx
+  8004fd:	85 d2                	test   %edx,%edx
+  8004ff:	74 2a                	je     80052b <vprintfmt+0x27d>
+  800501:	85 ff                	test   %edi,%edi
+  800503:	78 05                	js     80050a <vprintfmt+0x25c>
+  800505:	83 ef 01             	sub    $0x1,%edi
+  800508:	78 59                	js     800563 <vprintfmt+0x2b5>
+  80050a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050e:	74 d3                	je     8004e3 <vprintfmt+0x235>
+  800510:	0f be c0             	movsbl %al,%eax
+  800513:	83 e8 20             	sub    $0x20,%eax
+  800516:	83 f8 5e             	cmp    $0x5e,%eax
+  800519:	76 c8                	jbe    8004e3 <vprintfmt+0x235>
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	ff 75 0c             	push   0xc(%ebp)
+  800521:	6a 3f                	push   $0x3f
+  800523:	ff 55 08             	call   *0x8(%ebp)
+  800526:	83 c4 10             	add    $0x10,%esp
+  800529:	eb c5                	jmp    8004f0 <vprintfmt+0x242>
+  80052b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80052e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800531:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800534:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800537:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80053b:	7e 1b                	jle    800558 <vprintfmt+0x2aa>
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	53                   	push   %ebx
+  800541:	6a 20                	push   $0x20
+  800543:	ff d7                	call   *%edi
+  800545:	83 c4 10             	add    $0x10,%esp
+  800548:	83 ee 01             	sub    $0x1,%esi
+  80054b:	75 f0                	jne    80053d <vprintfmt+0x28f>
+  80054d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800550:	89 45 14             	mov    %eax,0x14(%ebp)
+  800553:	e9 67 fd ff ff       	jmp    8002bf <vprintfmt+0x11>
+  800558:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055e:	e9 5c fd ff ff       	jmp    8002bf <vprintfmt+0x11>
+  800563:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800566:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80056c:	eb c6                	jmp    800534 <vprintfmt+0x286>
+  80056e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800571:	89 55 10             	mov    %edx,0x10(%ebp)
+  800574:	83 f9 01             	cmp    $0x1,%ecx
+  800577:	7f 1f                	jg     800598 <vprintfmt+0x2ea>
+  800579:	85 c9                	test   %ecx,%ecx
+  80057b:	74 67                	je     8005e4 <vprintfmt+0x336>
+  80057d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800580:	8b 30                	mov    (%eax),%esi
+  800582:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800585:	89 f0                	mov    %esi,%eax
+  800587:	c1 f8 1f             	sar    $0x1f,%eax
+  80058a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80058d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800590:	8d 40 04             	lea    0x4(%eax),%eax
+  800593:	89 45 14             	mov    %eax,0x14(%ebp)
+  800596:	eb 17                	jmp    8005af <vprintfmt+0x301>
+  800598:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059b:	8b 50 04             	mov    0x4(%eax),%edx
+  80059e:	8b 00                	mov    (%eax),%eax
+  8005a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005af:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005ba:	85 c9                	test   %ecx,%ecx
+  8005bc:	0f 89 12 01 00 00    	jns    8006d4 <vprintfmt+0x426>
+  8005c2:	83 ec 08             	sub    $0x8,%esp
+  8005c5:	53                   	push   %ebx
+  8005c6:	6a 2d                	push   $0x2d
+  8005c8:	ff d7                	call   *%edi
+  8005ca:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d0:	f7 da                	neg    %edx
+  8005d2:	83 d1 00             	adc    $0x0,%ecx
+  8005d5:	f7 d9                	neg    %ecx
+  8005d7:	83 c4 10             	add    $0x10,%esp
+  8005da:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005df:	e9 f0 00 00 00       	jmp    8006d4 <vprintfmt+0x426>
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 30                	mov    (%eax),%esi
+  8005e9:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005ec:	89 f0                	mov    %esi,%eax
+  8005ee:	c1 f8 1f             	sar    $0x1f,%eax
+  8005f1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fd:	eb b0                	jmp    8005af <vprintfmt+0x301>
+  8005ff:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800602:	89 55 10             	mov    %edx,0x10(%ebp)
+  800605:	83 f9 01             	cmp    $0x1,%ecx
+  800608:	7f 1e                	jg     800628 <vprintfmt+0x37a>
+  80060a:	85 c9                	test   %ecx,%ecx
+  80060c:	74 32                	je     800640 <vprintfmt+0x392>
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8b 10                	mov    (%eax),%edx
+  800613:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800618:	8d 40 04             	lea    0x4(%eax),%eax
+  80061b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800623:	e9 ac 00 00 00       	jmp    8006d4 <vprintfmt+0x426>
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 10                	mov    (%eax),%edx
+  80062d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800630:	8d 40 08             	lea    0x8(%eax),%eax
+  800633:	89 45 14             	mov    %eax,0x14(%ebp)
+  800636:	be 0a 00 00 00       	mov    $0xa,%esi
+  80063b:	e9 94 00 00 00       	jmp    8006d4 <vprintfmt+0x426>
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064a:	8d 40 04             	lea    0x4(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800650:	be 0a 00 00 00       	mov    $0xa,%esi
+  800655:	eb 7d                	jmp    8006d4 <vprintfmt+0x426>
+  800657:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80065a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80065d:	83 f9 01             	cmp    $0x1,%ecx
+  800660:	7f 1b                	jg     80067d <vprintfmt+0x3cf>
+  800662:	85 c9                	test   %ecx,%ecx
+  800664:	74 2c                	je     800692 <vprintfmt+0x3e4>
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8b 10                	mov    (%eax),%edx
+  80066b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800670:	8d 40 04             	lea    0x4(%eax),%eax
+  800673:	89 45 14             	mov    %eax,0x14(%ebp)
+  800676:	be 08 00 00 00       	mov    $0x8,%esi
+  80067b:	eb 57                	jmp    8006d4 <vprintfmt+0x426>
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8b 10                	mov    (%eax),%edx
+  800682:	8b 48 04             	mov    0x4(%eax),%ecx
+  800685:	8d 40 08             	lea    0x8(%eax),%eax
+  800688:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068b:	be 08 00 00 00       	mov    $0x8,%esi
+  800690:	eb 42                	jmp    8006d4 <vprintfmt+0x426>
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a2:	be 08 00 00 00       	mov    $0x8,%esi
+  8006a7:	eb 2b                	jmp    8006d4 <vprintfmt+0x426>
+  8006a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ac:	83 ec 08             	sub    $0x8,%esp
+  8006af:	53                   	push   %ebx
+  8006b0:	6a 30                	push   $0x30
+  8006b2:	ff d7                	call   *%edi
+  8006b4:	83 c4 08             	add    $0x8,%esp
+  8006b7:	53                   	push   %ebx
+  8006b8:	6a 78                	push   $0x78
+  8006ba:	ff d7                	call   *%edi
+  8006bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bf:	8b 10                	mov    (%eax),%edx
+  8006c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c6:	83 c4 10             	add    $0x10,%esp
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cf:	be 10 00 00 00       	mov    $0x10,%esi
+  8006d4:	83 ec 0c             	sub    $0xc,%esp
+  8006d7:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006db:	50                   	push   %eax
+  8006dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8006df:	56                   	push   %esi
+  8006e0:	51                   	push   %ecx
+  8006e1:	52                   	push   %edx
+  8006e2:	89 da                	mov    %ebx,%edx
+  8006e4:	89 f8                	mov    %edi,%eax
+  8006e6:	e8 d8 fa ff ff       	call   8001c3 <printnum>
+  8006eb:	83 c4 20             	add    $0x20,%esp
+  8006ee:	e9 cc fb ff ff       	jmp    8002bf <vprintfmt+0x11>
+  8006f3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006f6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f9:	83 f9 01             	cmp    $0x1,%ecx
+  8006fc:	7f 1b                	jg     800719 <vprintfmt+0x46b>
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	74 2c                	je     80072e <vprintfmt+0x480>
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800712:	be 10 00 00 00       	mov    $0x10,%esi
+  800717:	eb bb                	jmp    8006d4 <vprintfmt+0x426>
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800721:	8d 40 08             	lea    0x8(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+  800727:	be 10 00 00 00       	mov    $0x10,%esi
+  80072c:	eb a6                	jmp    8006d4 <vprintfmt+0x426>
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073e:	be 10 00 00 00       	mov    $0x10,%esi
+  800743:	eb 8f                	jmp    8006d4 <vprintfmt+0x426>
+  800745:	89 55 10             	mov    %edx,0x10(%ebp)
+  800748:	83 ec 08             	sub    $0x8,%esp
+  80074b:	53                   	push   %ebx
+  80074c:	6a 25                	push   $0x25
+  80074e:	ff d7                	call   *%edi
+  800750:	83 c4 10             	add    $0x10,%esp
+  800753:	e9 67 fb ff ff       	jmp    8002bf <vprintfmt+0x11>
+  800758:	83 ec 08             	sub    $0x8,%esp
+  80075b:	53                   	push   %ebx
+  80075c:	6a 25                	push   $0x25
+  80075e:	ff d7                	call   *%edi
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800767:	0f 84 ba fb ff ff    	je     800327 <vprintfmt+0x79>
+  80076d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800770:	89 f0                	mov    %esi,%eax
+  800772:	83 e8 01             	sub    $0x1,%eax
+  800775:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800779:	75 f7                	jne    800772 <vprintfmt+0x4c4>
+  80077b:	89 45 10             	mov    %eax,0x10(%ebp)
+  80077e:	e9 3c fb ff ff       	jmp    8002bf <vprintfmt+0x11>
+  800783:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800786:	8d 70 01             	lea    0x1(%eax),%esi
+  800789:	0f b6 00             	movzbl (%eax),%eax
+  80078c:	0f be d0             	movsbl %al,%edx
+  80078f:	85 d2                	test   %edx,%edx
+  800791:	74 11                	je     8007a4 <vprintfmt+0x4f6>
+  800793:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800796:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800799:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80079c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80079f:	e9 5d fd ff ff       	jmp    800501 <vprintfmt+0x253>
+  8007a4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007aa:	e9 10 fb ff ff       	jmp    8002bf <vprintfmt+0x11>
+  8007af:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b5:	e9 05 fb ff ff       	jmp    8002bf <vprintfmt+0x11>
+  8007ba:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007be:	7e 0a                	jle    8007ca <vprintfmt+0x51c>
+  8007c0:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007c4:	0f 85 bd fc ff ff    	jne    800487 <vprintfmt+0x1d9>
+  8007ca:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007cf:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007d4:	be 04 32 80 00       	mov    $0x803204,%esi
+  8007d9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007dc:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007df:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007e2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007e5:	e9 17 fd ff ff       	jmp    800501 <vprintfmt+0x253>
+  8007ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ed:	5b                   	pop    %ebx
+  8007ee:	5e                   	pop    %esi
+  8007ef:	5f                   	pop    %edi
+  8007f0:	5d                   	pop    %ebp
+  8007f1:	c3                   	ret
+
+008007f2 <vsnprintf>:
+  8007f2:	55                   	push   %ebp
+  8007f3:	89 e5                	mov    %esp,%ebp
+  8007f5:	83 ec 18             	sub    $0x18,%esp
+  8007f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007fe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800801:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800805:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800808:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80080f:	85 c0                	test   %eax,%eax
+  800811:	74 26                	je     800839 <vsnprintf+0x47>
+  800813:	85 d2                	test   %edx,%edx
+  800815:	7e 22                	jle    800839 <vsnprintf+0x47>
+  800817:	ff 75 14             	push   0x14(%ebp)
+  80081a:	ff 75 10             	push   0x10(%ebp)
+  80081d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800820:	50                   	push   %eax
+  800821:	68 74 02 80 00       	push   $0x800274
+  800826:	e8 83 fa ff ff       	call   8002ae <vprintfmt>
+  80082b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80082e:	c6 00 00             	movb   $0x0,(%eax)
+  800831:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	c9                   	leave
+  800838:	c3                   	ret
+  800839:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80083e:	eb f7                	jmp    800837 <vsnprintf+0x45>
+
+00800840 <snprintf>:
+  800840:	55                   	push   %ebp
+  800841:	89 e5                	mov    %esp,%ebp
+  800843:	83 ec 08             	sub    $0x8,%esp
+  800846:	8d 45 14             	lea    0x14(%ebp),%eax
+  800849:	50                   	push   %eax
+  80084a:	ff 75 10             	push   0x10(%ebp)
+  80084d:	ff 75 0c             	push   0xc(%ebp)
+  800850:	ff 75 08             	push   0x8(%ebp)
+  800853:	e8 9a ff ff ff       	call   8007f2 <vsnprintf>
+  800858:	c9                   	leave
+  800859:	c3                   	ret
+
+0080085a <strlen>:
+  80085a:	55                   	push   %ebp
+  80085b:	89 e5                	mov    %esp,%ebp
+  80085d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800860:	80 3a 00             	cmpb   $0x0,(%edx)
+  800863:	74 10                	je     800875 <strlen+0x1b>
+  800865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086a:	83 c0 01             	add    $0x1,%eax
+  80086d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800871:	75 f7                	jne    80086a <strlen+0x10>
+  800873:	5d                   	pop    %ebp
+  800874:	c3                   	ret
+  800875:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087a:	eb f7                	jmp    800873 <strlen+0x19>
+
+0080087c <strnlen>:
+  80087c:	55                   	push   %ebp
+  80087d:	89 e5                	mov    %esp,%ebp
+  80087f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800882:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800885:	85 d2                	test   %edx,%edx
+  800887:	74 16                	je     80089f <strnlen+0x23>
+  800889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800892:	74 09                	je     80089d <strnlen+0x21>
+  800894:	83 c0 01             	add    $0x1,%eax
+  800897:	39 d0                	cmp    %edx,%eax
+  800899:	75 f3                	jne    80088e <strnlen+0x12>
+  80089b:	89 d0                	mov    %edx,%eax
+  80089d:	5d                   	pop    %ebp
+  80089e:	c3                   	ret
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a4:	eb f7                	jmp    80089d <strnlen+0x21>
+
+008008a6 <strcpy>:
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	53                   	push   %ebx
+  8008aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008b9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008bc:	83 c0 01             	add    $0x1,%eax
+  8008bf:	84 d2                	test   %dl,%dl
+  8008c1:	75 f2                	jne    8008b5 <strcpy+0xf>
+  8008c3:	89 c8                	mov    %ecx,%eax
+  8008c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c8:	c9                   	leave
+  8008c9:	c3                   	ret
+
+008008ca <strcat>:
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	53                   	push   %ebx
+  8008ce:	83 ec 10             	sub    $0x10,%esp
+  8008d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008d4:	53                   	push   %ebx
+  8008d5:	e8 80 ff ff ff       	call   80085a <strlen>
+  8008da:	83 c4 08             	add    $0x8,%esp
+  8008dd:	ff 75 0c             	push   0xc(%ebp)
+  8008e0:	01 d8                	add    %ebx,%eax
+  8008e2:	50                   	push   %eax
+  8008e3:	e8 be ff ff ff       	call   8008a6 <strcpy>
+  8008e8:	89 d8                	mov    %ebx,%eax
+  8008ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ed:	c9                   	leave
+  8008ee:	c3                   	ret
+
+008008ef <strncpy>:
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	56                   	push   %esi
+  8008f3:	53                   	push   %ebx
+  8008f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008fd:	85 db                	test   %ebx,%ebx
+  8008ff:	74 17                	je     800918 <strncpy+0x29>
+  800901:	01 f3                	add    %esi,%ebx
+  800903:	89 f0                	mov    %esi,%eax
+  800905:	83 c0 01             	add    $0x1,%eax
+  800908:	0f b6 0a             	movzbl (%edx),%ecx
+  80090b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80090e:	80 f9 01             	cmp    $0x1,%cl
+  800911:	83 da ff             	sbb    $0xffffffff,%edx
+  800914:	39 c3                	cmp    %eax,%ebx
+  800916:	75 ed                	jne    800905 <strncpy+0x16>
+  800918:	89 f0                	mov    %esi,%eax
+  80091a:	5b                   	pop    %ebx
+  80091b:	5e                   	pop    %esi
+  80091c:	5d                   	pop    %ebp
+  80091d:	c3                   	ret
+
+0080091e <strlcpy>:
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	56                   	push   %esi
+  800922:	53                   	push   %ebx
+  800923:	8b 75 08             	mov    0x8(%ebp),%esi
+  800926:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800929:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80092c:	89 f0                	mov    %esi,%eax
+  80092e:	85 db                	test   %ebx,%ebx
+  800930:	74 1e                	je     800950 <strlcpy+0x32>
+  800932:	83 eb 01             	sub    $0x1,%ebx
+  800935:	74 16                	je     80094d <strlcpy+0x2f>
+  800937:	01 f3                	add    %esi,%ebx
+  800939:	0f b6 0a             	movzbl (%edx),%ecx
+  80093c:	84 c9                	test   %cl,%cl
+  80093e:	74 0d                	je     80094d <strlcpy+0x2f>
+  800940:	83 c2 01             	add    $0x1,%edx
+  800943:	83 c0 01             	add    $0x1,%eax
+  800946:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800949:	39 d8                	cmp    %ebx,%eax
+  80094b:	75 ec                	jne    800939 <strlcpy+0x1b>
+  80094d:	c6 00 00             	movb   $0x0,(%eax)
+  800950:	29 f0                	sub    %esi,%eax
+  800952:	5b                   	pop    %ebx
+  800953:	5e                   	pop    %esi
+  800954:	5d                   	pop    %ebp
+  800955:	c3                   	ret
+
+00800956 <strcmp>:
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095f:	0f b6 01             	movzbl (%ecx),%eax
+  800962:	84 c0                	test   %al,%al
+  800964:	74 11                	je     800977 <strcmp+0x21>
+  800966:	38 02                	cmp    %al,(%edx)
+  800968:	75 0d                	jne    800977 <strcmp+0x21>
+  80096a:	83 c1 01             	add    $0x1,%ecx
+  80096d:	83 c2 01             	add    $0x1,%edx
+  800970:	0f b6 01             	movzbl (%ecx),%eax
+  800973:	84 c0                	test   %al,%al
+  800975:	75 ef                	jne    800966 <strcmp+0x10>
+  800977:	0f b6 c0             	movzbl %al,%eax
+  80097a:	0f b6 12             	movzbl (%edx),%edx
+  80097d:	29 d0                	sub    %edx,%eax
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+
+00800981 <strncmp>:
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	53                   	push   %ebx
+  800985:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800988:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80098b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80098e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800993:	85 d2                	test   %edx,%edx
+  800995:	74 2e                	je     8009c5 <strncmp+0x44>
+  800997:	0f b6 01             	movzbl (%ecx),%eax
+  80099a:	84 c0                	test   %al,%al
+  80099c:	74 16                	je     8009b4 <strncmp+0x33>
+  80099e:	3a 03                	cmp    (%ebx),%al
+  8009a0:	75 12                	jne    8009b4 <strncmp+0x33>
+  8009a2:	83 c1 01             	add    $0x1,%ecx
+  8009a5:	83 c3 01             	add    $0x1,%ebx
+  8009a8:	83 ea 01             	sub    $0x1,%edx
+  8009ab:	75 ea                	jne    800997 <strncmp+0x16>
+  8009ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b2:	eb 11                	jmp    8009c5 <strncmp+0x44>
+  8009b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b9:	85 d2                	test   %edx,%edx
+  8009bb:	74 08                	je     8009c5 <strncmp+0x44>
+  8009bd:	0f b6 01             	movzbl (%ecx),%eax
+  8009c0:	0f b6 13             	movzbl (%ebx),%edx
+  8009c3:	29 d0                	sub    %edx,%eax
+  8009c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c8:	c9                   	leave
+  8009c9:	c3                   	ret
+
+008009ca <strchr>:
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009d4:	0f b6 10             	movzbl (%eax),%edx
+  8009d7:	84 d2                	test   %dl,%dl
+  8009d9:	74 15                	je     8009f0 <strchr+0x26>
+  8009db:	38 d1                	cmp    %dl,%cl
+  8009dd:	74 0f                	je     8009ee <strchr+0x24>
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	0f b6 10             	movzbl (%eax),%edx
+  8009e5:	84 d2                	test   %dl,%dl
+  8009e7:	75 f2                	jne    8009db <strchr+0x11>
+  8009e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+  8009f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f5:	eb f7                	jmp    8009ee <strchr+0x24>
+
+008009f7 <strfind>:
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	53                   	push   %ebx
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a01:	0f b6 18             	movzbl (%eax),%ebx
+  800a04:	38 d3                	cmp    %dl,%bl
+  800a06:	74 14                	je     800a1c <strfind+0x25>
+  800a08:	89 d1                	mov    %edx,%ecx
+  800a0a:	84 db                	test   %bl,%bl
+  800a0c:	74 0e                	je     800a1c <strfind+0x25>
+  800a0e:	83 c0 01             	add    $0x1,%eax
+  800a11:	0f b6 10             	movzbl (%eax),%edx
+  800a14:	38 ca                	cmp    %cl,%dl
+  800a16:	74 04                	je     800a1c <strfind+0x25>
+  800a18:	84 d2                	test   %dl,%dl
+  800a1a:	75 f2                	jne    800a0e <strfind+0x17>
+  800a1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a1f:	c9                   	leave
+  800a20:	c3                   	ret
+
+00800a21 <memset>:
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	57                   	push   %edi
+  800a25:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a28:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a2b:	85 c9                	test   %ecx,%ecx
+  800a2d:	74 20                	je     800a4f <memset+0x2e>
+  800a2f:	89 f8                	mov    %edi,%eax
+  800a31:	09 c8                	or     %ecx,%eax
+  800a33:	a8 03                	test   $0x3,%al
+  800a35:	75 12                	jne    800a49 <memset+0x28>
+  800a37:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a3b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a41:	c1 e9 02             	shr    $0x2,%ecx
+  800a44:	fc                   	cld
+  800a45:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a47:	eb 06                	jmp    800a4f <memset+0x2e>
+  800a49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a4c:	fc                   	cld
+  800a4d:	f3 aa                	rep stos %al,%es:(%edi)
+  800a4f:	89 f8                	mov    %edi,%eax
+  800a51:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a54:	c9                   	leave
+  800a55:	c3                   	ret
+
+00800a56 <memmove>:
+  800a56:	55                   	push   %ebp
+  800a57:	89 e5                	mov    %esp,%ebp
+  800a59:	57                   	push   %edi
+  800a5a:	56                   	push   %esi
+  800a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a61:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a64:	39 c6                	cmp    %eax,%esi
+  800a66:	73 32                	jae    800a9a <memmove+0x44>
+  800a68:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a6b:	39 d0                	cmp    %edx,%eax
+  800a6d:	73 2b                	jae    800a9a <memmove+0x44>
+  800a6f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a72:	89 d6                	mov    %edx,%esi
+  800a74:	09 fe                	or     %edi,%esi
+  800a76:	09 ce                	or     %ecx,%esi
+  800a78:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a7e:	75 0e                	jne    800a8e <memmove+0x38>
+  800a80:	83 ef 04             	sub    $0x4,%edi
+  800a83:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a86:	c1 e9 02             	shr    $0x2,%ecx
+  800a89:	fd                   	std
+  800a8a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8c:	eb 09                	jmp    800a97 <memmove+0x41>
+  800a8e:	83 ef 01             	sub    $0x1,%edi
+  800a91:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800a94:	fd                   	std
+  800a95:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a97:	fc                   	cld
+  800a98:	eb 1a                	jmp    800ab4 <memmove+0x5e>
+  800a9a:	89 f2                	mov    %esi,%edx
+  800a9c:	09 c2                	or     %eax,%edx
+  800a9e:	09 ca                	or     %ecx,%edx
+  800aa0:	f6 c2 03             	test   $0x3,%dl
+  800aa3:	75 0a                	jne    800aaf <memmove+0x59>
+  800aa5:	c1 e9 02             	shr    $0x2,%ecx
+  800aa8:	89 c7                	mov    %eax,%edi
+  800aaa:	fc                   	cld
+  800aab:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aad:	eb 05                	jmp    800ab4 <memmove+0x5e>
+  800aaf:	89 c7                	mov    %eax,%edi
+  800ab1:	fc                   	cld
+  800ab2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ab4:	5e                   	pop    %esi
+  800ab5:	5f                   	pop    %edi
+  800ab6:	5d                   	pop    %ebp
+  800ab7:	c3                   	ret
+
+00800ab8 <memcpy>:
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	83 ec 0c             	sub    $0xc,%esp
+  800abe:	ff 75 10             	push   0x10(%ebp)
+  800ac1:	ff 75 0c             	push   0xc(%ebp)
+  800ac4:	ff 75 08             	push   0x8(%ebp)
+  800ac7:	e8 8a ff ff ff       	call   800a56 <memmove>
+  800acc:	c9                   	leave
+  800acd:	c3                   	ret
+
+00800ace <memcmp>:
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	56                   	push   %esi
+  800ad2:	53                   	push   %ebx
+  800ad3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad9:	8b 75 10             	mov    0x10(%ebp),%esi
+  800adc:	85 f6                	test   %esi,%esi
+  800ade:	74 29                	je     800b09 <memcmp+0x3b>
+  800ae0:	01 c6                	add    %eax,%esi
+  800ae2:	0f b6 08             	movzbl (%eax),%ecx
+  800ae5:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae8:	38 d9                	cmp    %bl,%cl
+  800aea:	75 11                	jne    800afd <memcmp+0x2f>
+  800aec:	83 c0 01             	add    $0x1,%eax
+  800aef:	83 c2 01             	add    $0x1,%edx
+  800af2:	39 c6                	cmp    %eax,%esi
+  800af4:	75 ec                	jne    800ae2 <memcmp+0x14>
+  800af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afb:	eb 08                	jmp    800b05 <memcmp+0x37>
+  800afd:	0f b6 c1             	movzbl %cl,%eax
+  800b00:	0f b6 db             	movzbl %bl,%ebx
+  800b03:	29 d8                	sub    %ebx,%eax
+  800b05:	5b                   	pop    %ebx
+  800b06:	5e                   	pop    %esi
+  800b07:	5d                   	pop    %ebp
+  800b08:	c3                   	ret
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	eb f5                	jmp    800b05 <memcmp+0x37>
+
+00800b10 <memfind>:
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b19:	89 c2                	mov    %eax,%edx
+  800b1b:	03 55 10             	add    0x10(%ebp),%edx
+  800b1e:	39 d0                	cmp    %edx,%eax
+  800b20:	73 0d                	jae    800b2f <memfind+0x1f>
+  800b22:	38 08                	cmp    %cl,(%eax)
+  800b24:	74 0d                	je     800b33 <memfind+0x23>
+  800b26:	83 c0 01             	add    $0x1,%eax
+  800b29:	39 c2                	cmp    %eax,%edx
+  800b2b:	75 f5                	jne    800b22 <memfind+0x12>
+  800b2d:	eb 06                	jmp    800b35 <memfind+0x25>
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	eb 02                	jmp    800b35 <memfind+0x25>
+  800b33:	89 c2                	mov    %eax,%edx
+  800b35:	89 d0                	mov    %edx,%eax
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+
+00800b39 <strtol>:
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	57                   	push   %edi
+  800b3d:	56                   	push   %esi
+  800b3e:	53                   	push   %ebx
+  800b3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b45:	0f b6 02             	movzbl (%edx),%eax
+  800b48:	3c 20                	cmp    $0x20,%al
+  800b4a:	74 04                	je     800b50 <strtol+0x17>
+  800b4c:	3c 09                	cmp    $0x9,%al
+  800b4e:	75 0e                	jne    800b5e <strtol+0x25>
+  800b50:	83 c2 01             	add    $0x1,%edx
+  800b53:	0f b6 02             	movzbl (%edx),%eax
+  800b56:	3c 20                	cmp    $0x20,%al
+  800b58:	74 f6                	je     800b50 <strtol+0x17>
+  800b5a:	3c 09                	cmp    $0x9,%al
+  800b5c:	74 f2                	je     800b50 <strtol+0x17>
+  800b5e:	3c 2b                	cmp    $0x2b,%al
+  800b60:	74 2a                	je     800b8c <strtol+0x53>
+  800b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b67:	3c 2d                	cmp    $0x2d,%al
+  800b69:	74 2b                	je     800b96 <strtol+0x5d>
+  800b6b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b71:	75 0f                	jne    800b82 <strtol+0x49>
+  800b73:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b76:	74 28                	je     800ba0 <strtol+0x67>
+  800b78:	85 db                	test   %ebx,%ebx
+  800b7a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b7f:	0f 44 d8             	cmove  %eax,%ebx
+  800b82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b87:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b8a:	eb 46                	jmp    800bd2 <strtol+0x99>
+  800b8c:	83 c2 01             	add    $0x1,%edx
+  800b8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b94:	eb d5                	jmp    800b6b <strtol+0x32>
+  800b96:	83 c2 01             	add    $0x1,%edx
+  800b99:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b9e:	eb cb                	jmp    800b6b <strtol+0x32>
+  800ba0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ba4:	74 0e                	je     800bb4 <strtol+0x7b>
+  800ba6:	85 db                	test   %ebx,%ebx
+  800ba8:	75 d8                	jne    800b82 <strtol+0x49>
+  800baa:	83 c2 01             	add    $0x1,%edx
+  800bad:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bb2:	eb ce                	jmp    800b82 <strtol+0x49>
+  800bb4:	83 c2 02             	add    $0x2,%edx
+  800bb7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bbc:	eb c4                	jmp    800b82 <strtol+0x49>
+  800bbe:	0f be c0             	movsbl %al,%eax
+  800bc1:	83 e8 30             	sub    $0x30,%eax
+  800bc4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc7:	7d 3a                	jge    800c03 <strtol+0xca>
+  800bc9:	83 c2 01             	add    $0x1,%edx
+  800bcc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd0:	01 c1                	add    %eax,%ecx
+  800bd2:	0f b6 02             	movzbl (%edx),%eax
+  800bd5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd8:	89 f3                	mov    %esi,%ebx
+  800bda:	80 fb 09             	cmp    $0x9,%bl
+  800bdd:	76 df                	jbe    800bbe <strtol+0x85>
+  800bdf:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800be2:	89 f3                	mov    %esi,%ebx
+  800be4:	80 fb 19             	cmp    $0x19,%bl
+  800be7:	77 08                	ja     800bf1 <strtol+0xb8>
+  800be9:	0f be c0             	movsbl %al,%eax
+  800bec:	83 e8 57             	sub    $0x57,%eax
+  800bef:	eb d3                	jmp    800bc4 <strtol+0x8b>
+  800bf1:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bf4:	89 f3                	mov    %esi,%ebx
+  800bf6:	80 fb 19             	cmp    $0x19,%bl
+  800bf9:	77 08                	ja     800c03 <strtol+0xca>
+  800bfb:	0f be c0             	movsbl %al,%eax
+  800bfe:	83 e8 37             	sub    $0x37,%eax
+  800c01:	eb c1                	jmp    800bc4 <strtol+0x8b>
+  800c03:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c07:	74 05                	je     800c0e <strtol+0xd5>
+  800c09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c0c:	89 10                	mov    %edx,(%eax)
+  800c0e:	89 c8                	mov    %ecx,%eax
+  800c10:	f7 d8                	neg    %eax
+  800c12:	85 ff                	test   %edi,%edi
+  800c14:	0f 45 c8             	cmovne %eax,%ecx
+  800c17:	89 c8                	mov    %ecx,%eax
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5f                   	pop    %edi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	c3                   	ret
+
+00800c1e <sys_cputs>:
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	57                   	push   %edi
+  800c22:	56                   	push   %esi
+  800c23:	53                   	push   %ebx
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2f:	89 c3                	mov    %eax,%ebx
+  800c31:	89 c7                	mov    %eax,%edi
+  800c33:	89 c6                	mov    %eax,%esi
+  800c35:	cd 30                	int    $0x30
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+
+00800c3c <sys_cgetc>:
+  800c3c:	55                   	push   %ebp
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	57                   	push   %edi
+  800c40:	56                   	push   %esi
+  800c41:	53                   	push   %ebx
+  800c42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c47:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c4c:	89 d1                	mov    %edx,%ecx
+  800c4e:	89 d3                	mov    %edx,%ebx
+  800c50:	89 d7                	mov    %edx,%edi
+  800c52:	89 d6                	mov    %edx,%esi
+  800c54:	cd 30                	int    $0x30
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+
+00800c5b <sys_env_destroy>:
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	57                   	push   %edi
+  800c5f:	56                   	push   %esi
+  800c60:	53                   	push   %ebx
+  800c61:	83 ec 0c             	sub    $0xc,%esp
+  800c64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c71:	89 cb                	mov    %ecx,%ebx
+  800c73:	89 cf                	mov    %ecx,%edi
+  800c75:	89 ce                	mov    %ecx,%esi
+  800c77:	cd 30                	int    $0x30
+  800c79:	85 c0                	test   %eax,%eax
+  800c7b:	7f 08                	jg     800c85 <sys_env_destroy+0x2a>
+  800c7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c80:	5b                   	pop    %ebx
+  800c81:	5e                   	pop    %esi
+  800c82:	5f                   	pop    %edi
+  800c83:	5d                   	pop    %ebp
+  800c84:	c3                   	ret
+  800c85:	83 ec 0c             	sub    $0xc,%esp
+  800c88:	50                   	push   %eax
+  800c89:	6a 03                	push   $0x3
+  800c8b:	68 0b 35 80 00       	push   $0x80350b
+  800c90:	6a 24                	push   $0x24
+  800c92:	68 28 35 80 00       	push   $0x803528
+  800c97:	e8 a4 22 00 00       	call   802f40 <_panic>
+
+00800c9c <sys_getenvid>:
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	57                   	push   %edi
+  800ca0:	56                   	push   %esi
+  800ca1:	53                   	push   %ebx
+  800ca2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cac:	89 d1                	mov    %edx,%ecx
+  800cae:	89 d3                	mov    %edx,%ebx
+  800cb0:	89 d7                	mov    %edx,%edi
+  800cb2:	89 d6                	mov    %edx,%esi
+  800cb4:	cd 30                	int    $0x30
+  800cb6:	5b                   	pop    %ebx
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+
+00800cbb <sys_yield>:
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	57                   	push   %edi
+  800cbf:	56                   	push   %esi
+  800cc0:	53                   	push   %ebx
+  800cc1:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800cc8:	74 26                	je     800cf0 <sys_yield+0x35>
+  800cca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cd4:	89 d1                	mov    %edx,%ecx
+  800cd6:	89 d3                	mov    %edx,%ebx
+  800cd8:	89 d7                	mov    %edx,%edi
+  800cda:	6a 00                	push   $0x0
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	8d 35 e7 0c 80 00    	lea    0x800ce7,%esi
+  800ce5:	0f 34                	sysenter
+  800ce7:	5d                   	pop    %ebp
+  800ce8:	83 c4 04             	add    $0x4,%esp
+  800ceb:	5b                   	pop    %ebx
+  800cec:	5e                   	pop    %esi
+  800ced:	5f                   	pop    %edi
+  800cee:	5d                   	pop    %ebp
+  800cef:	c3                   	ret
+  800cf0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cfa:	89 d1                	mov    %edx,%ecx
+  800cfc:	89 d3                	mov    %edx,%ebx
+  800cfe:	89 d7                	mov    %edx,%edi
+  800d00:	89 d6                	mov    %edx,%esi
+  800d02:	cd 30                	int    $0x30
+  800d04:	eb e5                	jmp    800ceb <sys_yield+0x30>
+
+00800d06 <sys_page_alloc>:
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	57                   	push   %edi
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+  800d0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d22:	89 f7                	mov    %esi,%edi
+  800d24:	cd 30                	int    $0x30
+  800d26:	85 c0                	test   %eax,%eax
+  800d28:	7f 08                	jg     800d32 <sys_page_alloc+0x2c>
+  800d2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+  800d35:	50                   	push   %eax
+  800d36:	6a 04                	push   $0x4
+  800d38:	68 0b 35 80 00       	push   $0x80350b
+  800d3d:	6a 24                	push   $0x24
+  800d3f:	68 28 35 80 00       	push   $0x803528
+  800d44:	e8 f7 21 00 00       	call   802f40 <_panic>
+
+00800d49 <sys_page_map>:
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	57                   	push   %edi
+  800d4d:	56                   	push   %esi
+  800d4e:	53                   	push   %ebx
+  800d4f:	83 ec 0c             	sub    $0xc,%esp
+  800d52:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d59:	74 33                	je     800d8e <sys_page_map+0x45>
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d61:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d69:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d6c:	ff 75 18             	push   0x18(%ebp)
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	8d 35 7a 0d 80 00    	lea    0x800d7a,%esi
+  800d78:	0f 34                	sysenter
+  800d7a:	5d                   	pop    %ebp
+  800d7b:	83 c4 04             	add    $0x4,%esp
+  800d7e:	89 c2                	mov    %eax,%edx
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	7f 3d                	jg     800dc1 <sys_page_map+0x78>
+  800d84:	89 d0                	mov    %edx,%eax
+  800d86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d89:	5b                   	pop    %ebx
+  800d8a:	5e                   	pop    %esi
+  800d8b:	5f                   	pop    %edi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+  800d8e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d9f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800da2:	cd 30                	int    $0x30
+  800da4:	89 c2                	mov    %eax,%edx
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	7e da                	jle    800d84 <sys_page_map+0x3b>
+  800daa:	83 ec 0c             	sub    $0xc,%esp
+  800dad:	50                   	push   %eax
+  800dae:	6a 05                	push   $0x5
+  800db0:	68 0b 35 80 00       	push   $0x80350b
+  800db5:	6a 24                	push   $0x24
+  800db7:	68 28 35 80 00       	push   $0x803528
+  800dbc:	e8 7f 21 00 00       	call   802f40 <_panic>
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+  800dc4:	50                   	push   %eax
+  800dc5:	6a 05                	push   $0x5
+  800dc7:	68 0b 35 80 00       	push   $0x80350b
+  800dcc:	6a 48                	push   $0x48
+  800dce:	68 28 35 80 00       	push   $0x803528
+  800dd3:	e8 68 21 00 00       	call   802f40 <_panic>
+
+00800dd8 <sys_page_unmap>:
+  800dd8:	55                   	push   %ebp
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	57                   	push   %edi
+  800ddc:	56                   	push   %esi
+  800ddd:	53                   	push   %ebx
+  800dde:	83 ec 0c             	sub    $0xc,%esp
+  800de1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dec:	b8 06 00 00 00       	mov    $0x6,%eax
+  800df1:	89 df                	mov    %ebx,%edi
+  800df3:	89 de                	mov    %ebx,%esi
+  800df5:	cd 30                	int    $0x30
+  800df7:	85 c0                	test   %eax,%eax
+  800df9:	7f 08                	jg     800e03 <sys_page_unmap+0x2b>
+  800dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+  800e03:	83 ec 0c             	sub    $0xc,%esp
+  800e06:	50                   	push   %eax
+  800e07:	6a 06                	push   $0x6
+  800e09:	68 0b 35 80 00       	push   $0x80350b
+  800e0e:	6a 24                	push   $0x24
+  800e10:	68 28 35 80 00       	push   $0x803528
+  800e15:	e8 26 21 00 00       	call   802f40 <_panic>
+
+00800e1a <sys_fork>:
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	53                   	push   %ebx
+  800e20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e25:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e2a:	89 d1                	mov    %edx,%ecx
+  800e2c:	89 d3                	mov    %edx,%ebx
+  800e2e:	89 d7                	mov    %edx,%edi
+  800e30:	89 d6                	mov    %edx,%esi
+  800e32:	cd 30                	int    $0x30
+  800e34:	5b                   	pop    %ebx
+  800e35:	5e                   	pop    %esi
+  800e36:	5f                   	pop    %edi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+
+00800e39 <sys_env_set_status>:
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	57                   	push   %edi
+  800e3d:	56                   	push   %esi
+  800e3e:	53                   	push   %ebx
+  800e3f:	83 ec 0c             	sub    $0xc,%esp
+  800e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e52:	89 df                	mov    %ebx,%edi
+  800e54:	89 de                	mov    %ebx,%esi
+  800e56:	cd 30                	int    $0x30
+  800e58:	85 c0                	test   %eax,%eax
+  800e5a:	7f 08                	jg     800e64 <sys_env_set_status+0x2b>
+  800e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5f:	5b                   	pop    %ebx
+  800e60:	5e                   	pop    %esi
+  800e61:	5f                   	pop    %edi
+  800e62:	5d                   	pop    %ebp
+  800e63:	c3                   	ret
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+  800e67:	50                   	push   %eax
+  800e68:	6a 08                	push   $0x8
+  800e6a:	68 0b 35 80 00       	push   $0x80350b
+  800e6f:	6a 24                	push   $0x24
+  800e71:	68 28 35 80 00       	push   $0x803528
+  800e76:	e8 c5 20 00 00       	call   802f40 <_panic>
+
+00800e7b <sys_env_set_trapframe>:
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	57                   	push   %edi
+  800e7f:	56                   	push   %esi
+  800e80:	53                   	push   %ebx
+  800e81:	83 ec 0c             	sub    $0xc,%esp
+  800e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e94:	89 df                	mov    %ebx,%edi
+  800e96:	89 de                	mov    %ebx,%esi
+  800e98:	cd 30                	int    $0x30
+  800e9a:	85 c0                	test   %eax,%eax
+  800e9c:	7f 08                	jg     800ea6 <sys_env_set_trapframe+0x2b>
+  800e9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+  800ea9:	50                   	push   %eax
+  800eaa:	6a 09                	push   $0x9
+  800eac:	68 0b 35 80 00       	push   $0x80350b
+  800eb1:	6a 24                	push   $0x24
+  800eb3:	68 28 35 80 00       	push   $0x803528
+  800eb8:	e8 83 20 00 00       	call   802f40 <_panic>
+
+00800ebd <sys_env_set_cow>:
+  800ebd:	55                   	push   %ebp
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	57                   	push   %edi
+  800ec1:	56                   	push   %esi
+  800ec2:	53                   	push   %ebx
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed1:	b8 20 00 00 00       	mov    $0x20,%eax
+  800ed6:	89 df                	mov    %ebx,%edi
+  800ed8:	89 de                	mov    %ebx,%esi
+  800eda:	cd 30                	int    $0x30
+  800edc:	85 c0                	test   %eax,%eax
+  800ede:	7f 08                	jg     800ee8 <sys_env_set_cow+0x2b>
+  800ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+  800eeb:	50                   	push   %eax
+  800eec:	6a 20                	push   $0x20
+  800eee:	68 0b 35 80 00       	push   $0x80350b
+  800ef3:	6a 24                	push   $0x24
+  800ef5:	68 28 35 80 00       	push   $0x803528
+  800efa:	e8 41 20 00 00       	call   802f40 <_panic>
+
+00800eff <sys_env_service>:
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	57                   	push   %edi
+  800f03:	56                   	push   %esi
+  800f04:	53                   	push   %ebx
+  800f05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0d:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f12:	89 cb                	mov    %ecx,%ebx
+  800f14:	89 cf                	mov    %ecx,%edi
+  800f16:	89 ce                	mov    %ecx,%esi
+  800f18:	cd 30                	int    $0x30
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5f                   	pop    %edi
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+
+00800f1f <sys_env_set_pgfault_upcall>:
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f38:	89 df                	mov    %ebx,%edi
+  800f3a:	89 de                	mov    %ebx,%esi
+  800f3c:	cd 30                	int    $0x30
+  800f3e:	85 c0                	test   %eax,%eax
+  800f40:	7f 08                	jg     800f4a <sys_env_set_pgfault_upcall+0x2b>
+  800f42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  800f4d:	50                   	push   %eax
+  800f4e:	6a 0a                	push   $0xa
+  800f50:	68 0b 35 80 00       	push   $0x80350b
+  800f55:	6a 24                	push   $0x24
+  800f57:	68 28 35 80 00       	push   $0x803528
+  800f5c:	e8 df 1f 00 00       	call   802f40 <_panic>
+
+00800f61 <sys_ipc_try_send>:
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f6e:	74 27                	je     800f97 <sys_ipc_try_send+0x36>
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f76:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f81:	6a 00                	push   $0x0
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+  800f8e:	5d                   	pop    %ebp
+  800f8f:	83 c4 04             	add    $0x4,%esp
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+  800f97:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f9c:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800faa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fad:	cd 30                	int    $0x30
+  800faf:	eb e1                	jmp    800f92 <sys_ipc_try_send+0x31>
+
+00800fb1 <sys_ipc_recv>:
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	57                   	push   %edi
+  800fb5:	56                   	push   %esi
+  800fb6:	53                   	push   %ebx
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+  800fba:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fc1:	74 32                	je     800ff5 <sys_ipc_recv+0x44>
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fcb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fd0:	89 cb                	mov    %ecx,%ebx
+  800fd2:	89 cf                	mov    %ecx,%edi
+  800fd4:	6a 00                	push   $0x0
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	8d 35 e1 0f 80 00    	lea    0x800fe1,%esi
+  800fdf:	0f 34                	sysenter
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	83 c4 04             	add    $0x4,%esp
+  800fe5:	89 c2                	mov    %eax,%edx
+  800fe7:	85 c0                	test   %eax,%eax
+  800fe9:	7f 3c                	jg     801027 <sys_ipc_recv+0x76>
+  800feb:	89 d0                	mov    %edx,%eax
+  800fed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+  800ff5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ffa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	89 cb                	mov    %ecx,%ebx
+  801004:	89 cf                	mov    %ecx,%edi
+  801006:	89 ce                	mov    %ecx,%esi
+  801008:	cd 30                	int    $0x30
+  80100a:	89 c2                	mov    %eax,%edx
+  80100c:	85 c0                	test   %eax,%eax
+  80100e:	7e db                	jle    800feb <sys_ipc_recv+0x3a>
+  801010:	83 ec 0c             	sub    $0xc,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 0d                	push   $0xd
+  801016:	68 0b 35 80 00       	push   $0x80350b
+  80101b:	6a 24                	push   $0x24
+  80101d:	68 28 35 80 00       	push   $0x803528
+  801022:	e8 19 1f 00 00       	call   802f40 <_panic>
+  801027:	83 ec 0c             	sub    $0xc,%esp
+  80102a:	50                   	push   %eax
+  80102b:	6a 0d                	push   $0xd
+  80102d:	68 0b 35 80 00       	push   $0x80350b
+  801032:	6a 48                	push   $0x48
+  801034:	68 28 35 80 00       	push   $0x803528
+  801039:	e8 02 1f 00 00       	call   802f40 <_panic>
+
+0080103e <sys_ipc_send>:
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	57                   	push   %edi
+  801042:	56                   	push   %esi
+  801043:	53                   	push   %ebx
+  801044:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80104b:	74 27                	je     801074 <sys_ipc_send+0x36>
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801053:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801058:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80105e:	6a 00                	push   $0x0
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	8d 35 6b 10 80 00    	lea    0x80106b,%esi
+  801069:	0f 34                	sysenter
+  80106b:	5d                   	pop    %ebp
+  80106c:	83 c4 04             	add    $0x4,%esp
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5f                   	pop    %edi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+  801074:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801079:	be 00 00 00 00       	mov    $0x0,%esi
+  80107e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801081:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801084:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801087:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80108a:	cd 30                	int    $0x30
+  80108c:	eb e1                	jmp    80106f <sys_ipc_send+0x31>
+
+0080108e <sys_ipc_call>:
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80109f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a8:	cd 30                	int    $0x30
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+
+008010af <sys_ipc_reply_recv>:
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	57                   	push   %edi
+  8010b3:	56                   	push   %esi
+  8010b4:	53                   	push   %ebx
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bb:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010c9:	cd 30                	int    $0x30
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+
+008010d0 <sys_time_msec>:
+  8010d0:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8010d5:	85 c0                	test   %eax,%eax
+  8010d7:	75 06                	jne    8010df <sys_time_msec+0xf>
+  8010d9:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8010de:	c3                   	ret
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	0f 31                	rdtsc
+  8010ea:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8010f0:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8010f6:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8010fc:	29 c8                	sub    %ecx,%eax
+  8010fe:	19 da                	sbb    %ebx,%edx
+  801100:	bf 00 00 00 00       	mov    $0x0,%edi
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	52                   	push   %edx
+  801108:	50                   	push   %eax
+  801109:	e8 91 1f 00 00       	call   80309f <__udivdi3>
+  80110e:	83 c4 10             	add    $0x10,%esp
+  801111:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801114:	5b                   	pop    %ebx
+  801115:	5e                   	pop    %esi
+  801116:	5f                   	pop    %edi
+  801117:	5d                   	pop    %ebp
+  801118:	c3                   	ret
+
+00801119 <sys_env_swap>:
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	57                   	push   %edi
+  80111d:	56                   	push   %esi
+  80111e:	53                   	push   %ebx
+  80111f:	83 ec 0c             	sub    $0xc,%esp
+  801122:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80112f:	89 cb                	mov    %ecx,%ebx
+  801131:	89 cf                	mov    %ecx,%edi
+  801133:	89 ce                	mov    %ecx,%esi
+  801135:	cd 30                	int    $0x30
+  801137:	85 c0                	test   %eax,%eax
+  801139:	7f 08                	jg     801143 <sys_env_swap+0x2a>
+  80113b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113e:	5b                   	pop    %ebx
+  80113f:	5e                   	pop    %esi
+  801140:	5f                   	pop    %edi
+  801141:	5d                   	pop    %ebp
+  801142:	c3                   	ret
+  801143:	83 ec 0c             	sub    $0xc,%esp
+  801146:	50                   	push   %eax
+  801147:	6a 12                	push   $0x12
+  801149:	68 0b 35 80 00       	push   $0x80350b
+  80114e:	6a 24                	push   $0x24
+  801150:	68 28 35 80 00       	push   $0x803528
+  801155:	e8 e6 1d 00 00       	call   802f40 <_panic>
+
+0080115a <sys_net_try_send>:
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	57                   	push   %edi
+  80115e:	56                   	push   %esi
+  80115f:	53                   	push   %ebx
+  801160:	83 ec 0c             	sub    $0xc,%esp
+  801163:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801168:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801173:	89 df                	mov    %ebx,%edi
+  801175:	89 de                	mov    %ebx,%esi
+  801177:	cd 30                	int    $0x30
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	7f 08                	jg     801185 <sys_net_try_send+0x2b>
+  80117d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5f                   	pop    %edi
+  801183:	5d                   	pop    %ebp
+  801184:	c3                   	ret
+  801185:	83 ec 0c             	sub    $0xc,%esp
+  801188:	50                   	push   %eax
+  801189:	6a 13                	push   $0x13
+  80118b:	68 0b 35 80 00       	push   $0x80350b
+  801190:	6a 24                	push   $0x24
+  801192:	68 28 35 80 00       	push   $0x803528
+  801197:	e8 a4 1d 00 00       	call   802f40 <_panic>
+
+0080119c <sys_net_try_receive>:
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	57                   	push   %edi
+  8011a0:	56                   	push   %esi
+  8011a1:	53                   	push   %ebx
+  8011a2:	83 ec 0c             	sub    $0xc,%esp
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011b5:	89 df                	mov    %ebx,%edi
+  8011b7:	89 de                	mov    %ebx,%esi
+  8011b9:	cd 30                	int    $0x30
+  8011bb:	85 c0                	test   %eax,%eax
+  8011bd:	7f 08                	jg     8011c7 <sys_net_try_receive+0x2b>
+  8011bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c2:	5b                   	pop    %ebx
+  8011c3:	5e                   	pop    %esi
+  8011c4:	5f                   	pop    %edi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	c3                   	ret
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  8011ca:	50                   	push   %eax
+  8011cb:	6a 14                	push   $0x14
+  8011cd:	68 0b 35 80 00       	push   $0x80350b
+  8011d2:	6a 24                	push   $0x24
+  8011d4:	68 28 35 80 00       	push   $0x803528
+  8011d9:	e8 62 1d 00 00       	call   802f40 <_panic>
+
+008011de <sys_net_recv_page>:
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+  8011e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	b8 27 00 00 00       	mov    $0x27,%eax
+  8011f1:	89 cb                	mov    %ecx,%ebx
+  8011f3:	89 cf                	mov    %ecx,%edi
+  8011f5:	89 ce                	mov    %ecx,%esi
+  8011f7:	cd 30                	int    $0x30
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+
+008011fe <sys_net_wait>:
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+  801204:	ba 00 00 00 00       	mov    $0x0,%edx
+  801209:	b8 26 00 00 00       	mov    $0x26,%eax
+  80120e:	89 d1                	mov    %edx,%ecx
+  801210:	89 d3                	mov    %edx,%ebx
+  801212:	89 d7                	mov    %edx,%edi
+  801214:	89 d6                	mov    %edx,%esi
+  801216:	cd 30                	int    $0x30
+  801218:	5b                   	pop    %ebx
+  801219:	5e                   	pop    %esi
+  80121a:	5f                   	pop    %edi
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+
+0080121d <sys_get_mac>:
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+  801223:	83 ec 0c             	sub    $0xc,%esp
+  801226:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801231:	b8 15 00 00 00       	mov    $0x15,%eax
+  801236:	89 df                	mov    %ebx,%edi
+  801238:	89 de                	mov    %ebx,%esi
+  80123a:	cd 30                	int    $0x30
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	7f 08                	jg     801248 <sys_get_mac+0x2b>
+  801240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	50                   	push   %eax
+  80124c:	6a 15                	push   $0x15
+  80124e:	68 0b 35 80 00       	push   $0x80350b
+  801253:	6a 24                	push   $0x24
+  801255:	68 28 35 80 00       	push   $0x803528
+  80125a:	e8 e1 1c 00 00       	call   802f40 <_panic>
+
+0080125f <sys_env_lease>:
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	57                   	push   %edi
+  801263:	56                   	push   %esi
+  801264:	53                   	push   %ebx
+  801265:	83 ec 0c             	sub    $0xc,%esp
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801273:	b8 16 00 00 00       	mov    $0x16,%eax
+  801278:	89 df                	mov    %ebx,%edi
+  80127a:	89 de                	mov    %ebx,%esi
+  80127c:	cd 30                	int    $0x30
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	7f 08                	jg     80128a <sys_env_lease+0x2b>
+  801282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+  80128d:	50                   	push   %eax
+  80128e:	6a 16                	push   $0x16
+  801290:	68 0b 35 80 00       	push   $0x80350b
+  801295:	6a 24                	push   $0x24
+  801297:	68 28 35 80 00       	push   $0x803528
+  80129c:	e8 9f 1c 00 00       	call   802f40 <_panic>
+
+008012a1 <sys_copy_mem>:
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	57                   	push   %edi
+  8012a5:	56                   	push   %esi
+  8012a6:	53                   	push   %ebx
+  8012a7:	83 ec 0c             	sub    $0xc,%esp
+  8012aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012bb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012be:	cd 30                	int    $0x30
+  8012c0:	85 c0                	test   %eax,%eax
+  8012c2:	7f 08                	jg     8012cc <sys_copy_mem+0x2b>
+  8012c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c7:	5b                   	pop    %ebx
+  8012c8:	5e                   	pop    %esi
+  8012c9:	5f                   	pop    %edi
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	c3                   	ret
+  8012cc:	83 ec 0c             	sub    $0xc,%esp
+  8012cf:	50                   	push   %eax
+  8012d0:	6a 17                	push   $0x17
+  8012d2:	68 0b 35 80 00       	push   $0x80350b
+  8012d7:	6a 24                	push   $0x24
+  8012d9:	68 28 35 80 00       	push   $0x803528
+  8012de:	e8 5d 1c 00 00       	call   802f40 <_panic>
+
+008012e3 <sys_get_perms>:
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	57                   	push   %edi
+  8012e7:	56                   	push   %esi
+  8012e8:	53                   	push   %ebx
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+  8012ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f7:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ff:	89 f7                	mov    %esi,%edi
+  801301:	cd 30                	int    $0x30
+  801303:	85 c0                	test   %eax,%eax
+  801305:	7f 08                	jg     80130f <sys_get_perms+0x2c>
+  801307:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80130a:	5b                   	pop    %ebx
+  80130b:	5e                   	pop    %esi
+  80130c:	5f                   	pop    %edi
+  80130d:	5d                   	pop    %ebp
+  80130e:	c3                   	ret
+  80130f:	83 ec 0c             	sub    $0xc,%esp
+  801312:	50                   	push   %eax
+  801313:	6a 18                	push   $0x18
+  801315:	68 0b 35 80 00       	push   $0x80350b
+  80131a:	6a 24                	push   $0x24
+  80131c:	68 28 35 80 00       	push   $0x803528
+  801321:	e8 1a 1c 00 00       	call   802f40 <_panic>
+
+00801326 <sys_env_unsuspend>:
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	57                   	push   %edi
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+  80132c:	83 ec 0c             	sub    $0xc,%esp
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+  801334:	8b 55 08             	mov    0x8(%ebp),%edx
+  801337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80133f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801342:	89 f7                	mov    %esi,%edi
+  801344:	cd 30                	int    $0x30
+  801346:	85 c0                	test   %eax,%eax
+  801348:	7f 08                	jg     801352 <sys_env_unsuspend+0x2c>
+  80134a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5f                   	pop    %edi
+  801350:	5d                   	pop    %ebp
+  801351:	c3                   	ret
+  801352:	83 ec 0c             	sub    $0xc,%esp
+  801355:	50                   	push   %eax
+  801356:	6a 19                	push   $0x19
+  801358:	68 0b 35 80 00       	push   $0x80350b
+  80135d:	6a 24                	push   $0x24
+  80135f:	68 28 35 80 00       	push   $0x803528
+  801364:	e8 d7 1b 00 00       	call   802f40 <_panic>
+
+00801369 <sys_migrate>:
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	57                   	push   %edi
+  80136d:	56                   	push   %esi
+  80136e:	53                   	push   %ebx
+  80136f:	83 ec 0c             	sub    $0xc,%esp
+  801372:	ba 00 80 80 00       	mov    $0x808000,%edx
+  801377:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80137d:	76 11                	jbe    801390 <sys_migrate+0x27>
+  80137f:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801384:	0f b6 08             	movzbl (%eax),%ecx
+  801387:	05 00 10 00 00       	add    $0x1000,%eax
+  80138c:	39 d0                	cmp    %edx,%eax
+  80138e:	72 f4                	jb     801384 <sys_migrate+0x1b>
+  801390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80139d:	89 cb                	mov    %ecx,%ebx
+  80139f:	89 cf                	mov    %ecx,%edi
+  8013a1:	89 ce                	mov    %ecx,%esi
+  8013a3:	cd 30                	int    $0x30
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	7f 08                	jg     8013b1 <sys_migrate+0x48>
+  8013a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ac:	5b                   	pop    %ebx
+  8013ad:	5e                   	pop    %esi
+  8013ae:	5f                   	pop    %edi
+  8013af:	5d                   	pop    %ebp
+  8013b0:	c3                   	ret
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+  8013b4:	50                   	push   %eax
+  8013b5:	6a 1a                	push   $0x1a
+  8013b7:	68 0b 35 80 00       	push   $0x80350b
+  8013bc:	6a 24                	push   $0x24
+  8013be:	68 28 35 80 00       	push   $0x803528
+  8013c3:	e8 78 1b 00 00       	call   802f40 <_panic>
+
+008013c8 <sys_lease_complete>:
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	57                   	push   %edi
+  8013cc:	56                   	push   %esi
+  8013cd:	53                   	push   %ebx
+  8013ce:	83 ec 0c             	sub    $0xc,%esp
+  8013d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013db:	89 d1                	mov    %edx,%ecx
+  8013dd:	89 d3                	mov    %edx,%ebx
+  8013df:	89 d7                	mov    %edx,%edi
+  8013e1:	89 d6                	mov    %edx,%esi
+  8013e3:	cd 30                	int    $0x30
+  8013e5:	85 c0                	test   %eax,%eax
+  8013e7:	7f 08                	jg     8013f1 <sys_lease_complete+0x29>
+  8013e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ec:	5b                   	pop    %ebx
+  8013ed:	5e                   	pop    %esi
+  8013ee:	5f                   	pop    %edi
+  8013ef:	5d                   	pop    %ebp
+  8013f0:	c3                   	ret
+  8013f1:	83 ec 0c             	sub    $0xc,%esp
+  8013f4:	50                   	push   %eax
+  8013f5:	6a 1b                	push   $0x1b
+  8013f7:	68 0b 35 80 00       	push   $0x80350b
+  8013fc:	6a 24                	push   $0x24
+  8013fe:	68 28 35 80 00       	push   $0x803528
+  801403:	e8 38 1b 00 00       	call   802f40 <_panic>
+
+00801408 <sys_env_set_thisenv>:
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	57                   	push   %edi
+  80140c:	56                   	push   %esi
+  80140d:	53                   	push   %ebx
+  80140e:	83 ec 0c             	sub    $0xc,%esp
+  801411:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801416:	8b 55 08             	mov    0x8(%ebp),%edx
+  801419:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801421:	89 df                	mov    %ebx,%edi
+  801423:	89 de                	mov    %ebx,%esi
+  801425:	cd 30                	int    $0x30
+  801427:	85 c0                	test   %eax,%eax
+  801429:	7f 08                	jg     801433 <sys_env_set_thisenv+0x2b>
+  80142b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142e:	5b                   	pop    %ebx
+  80142f:	5e                   	pop    %esi
+  801430:	5f                   	pop    %edi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+  801433:	83 ec 0c             	sub    $0xc,%esp
+  801436:	50                   	push   %eax
+  801437:	6a 1c                	push   $0x1c
+  801439:	68 0b 35 80 00       	push   $0x80350b
+  80143e:	6a 24                	push   $0x24
+  801440:	68 28 35 80 00       	push   $0x803528
+  801445:	e8 f6 1a 00 00       	call   802f40 <_panic>
+
+0080144a <sys_env_set_sched>:
+  80144a:	55                   	push   %ebp
+  80144b:	89 e5                	mov    %esp,%ebp
+  80144d:	57                   	push   %edi
+  80144e:	56                   	push   %esi
+  80144f:	53                   	push   %ebx
+  801450:	83 ec 0c             	sub    $0xc,%esp
+  801453:	be 00 00 00 00       	mov    $0x0,%esi
+  801458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801463:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801466:	89 f7                	mov    %esi,%edi
+  801468:	cd 30                	int    $0x30
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	7f 08                	jg     801476 <sys_env_set_sched+0x2c>
+  80146e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801471:	5b                   	pop    %ebx
+  801472:	5e                   	pop    %esi
+  801473:	5f                   	pop    %edi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+  801476:	83 ec 0c             	sub    $0xc,%esp
+  801479:	50                   	push   %eax
+  80147a:	6a 1d                	push   $0x1d
+  80147c:	68 0b 35 80 00       	push   $0x80350b
+  801481:	6a 24                	push   $0x24
+  801483:	68 28 35 80 00       	push   $0x803528
+  801488:	e8 b3 1a 00 00       	call   802f40 <_panic>
+
+0080148d <sys_batch>:
+  80148d:	55                   	push   %ebp
+  80148e:	89 e5                	mov    %esp,%ebp
+  801490:	57                   	push   %edi
+  801491:	56                   	push   %esi
+  801492:	53                   	push   %ebx
+  801493:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801498:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014a3:	89 df                	mov    %ebx,%edi
+  8014a5:	89 de                	mov    %ebx,%esi
+  8014a7:	cd 30                	int    $0x30
+  8014a9:	5b                   	pop    %ebx
+  8014aa:	5e                   	pop    %esi
+  8014ab:	5f                   	pop    %edi
+  8014ac:	5d                   	pop    %ebp
+  8014ad:	c3                   	ret
+
+008014ae <sys_env_stats>:
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	57                   	push   %edi
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+  8014b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bf:	b8 23 00 00 00       	mov    $0x23,%eax
+  8014c4:	89 df                	mov    %ebx,%edi
+  8014c6:	89 de                	mov    %ebx,%esi
+  8014c8:	cd 30                	int    $0x30
+  8014ca:	5b                   	pop    %ebx
+  8014cb:	5e                   	pop    %esi
+  8014cc:	5f                   	pop    %edi
+  8014cd:	5d                   	pop    %ebp
+  8014ce:	c3                   	ret
+
+008014cf <sys_trace>:
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	57                   	push   %edi
+  8014d3:	56                   	push   %esi
+  8014d4:	53                   	push   %ebx
+  8014d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014dd:	b8 24 00 00 00       	mov    $0x24,%eax
+  8014e2:	89 cb                	mov    %ecx,%ebx
+  8014e4:	89 cf                	mov    %ecx,%edi
+  8014e6:	89 ce                	mov    %ecx,%esi
+  8014e8:	cd 30                	int    $0x30
+  8014ea:	5b                   	pop    %ebx
+  8014eb:	5e                   	pop    %esi
+  8014ec:	5f                   	pop    %edi
+  8014ed:	5d                   	pop    %ebp
+  8014ee:	c3                   	ret
+
+008014ef <sys_env_set_pager>:
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	57                   	push   %edi
+  8014f3:	56                   	push   %esi
+  8014f4:	53                   	push   %ebx
+  8014f5:	83 ec 0c             	sub    $0xc,%esp
+  8014f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801500:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801503:	b8 25 00 00 00       	mov    $0x25,%eax
+  801508:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150b:	89 f7                	mov    %esi,%edi
+  80150d:	cd 30                	int    $0x30
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	7f 08                	jg     80151b <sys_env_set_pager+0x2c>
+  801513:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801516:	5b                   	pop    %ebx
+  801517:	5e                   	pop    %esi
+  801518:	5f                   	pop    %edi
+  801519:	5d                   	pop    %ebp
+  80151a:	c3                   	ret
+  80151b:	83 ec 0c             	sub    $0xc,%esp
+  80151e:	50                   	push   %eax
+  80151f:	6a 25                	push   $0x25
+  801521:	68 0b 35 80 00       	push   $0x80350b
+  801526:	6a 24                	push   $0x24
+  801528:	68 28 35 80 00       	push   $0x803528
+  80152d:	e8 0e 1a 00 00       	call   802f40 <_panic>
+
+00801532 <sys_pager_retire>:
+  801532:	55                   	push   %ebp
+  801533:	89 e5                	mov    %esp,%ebp
+  801535:	57                   	push   %edi
+  801536:	56                   	push   %esi
+  801537:	53                   	push   %ebx
+  801538:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801540:	b8 28 00 00 00       	mov    $0x28,%eax
+  801545:	89 cb                	mov    %ecx,%ebx
+  801547:	89 cf                	mov    %ecx,%edi
+  801549:	89 ce                	mov    %ecx,%esi
+  80154b:	cd 30                	int    $0x30
+  80154d:	5b                   	pop    %ebx
+  80154e:	5e                   	pop    %esi
+  80154f:	5f                   	pop    %edi
+  801550:	5d                   	pop    %ebp
+  801551:	c3                   	ret
+
+00801552 <sys_prof>:
+  801552:	55                   	push   %ebp
+  801553:	89 e5                	mov    %esp,%ebp
+  801555:	57                   	push   %edi
+  801556:	56                   	push   %esi
+  801557:	53                   	push   %ebx
+  801558:	be 00 00 00 00       	mov    $0x0,%esi
+  80155d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801560:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801563:	b8 22 00 00 00       	mov    $0x22,%eax
+  801568:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156b:	89 f7                	mov    %esi,%edi
+  80156d:	cd 30                	int    $0x30
+  80156f:	5b                   	pop    %ebx
+  801570:	5e                   	pop    %esi
+  801571:	5f                   	pop    %edi
+  801572:	5d                   	pop    %ebp
+  801573:	c3                   	ret
+
+00801574 <ipc_recv>:
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	56                   	push   %esi
+  801578:	53                   	push   %ebx
+  801579:	8b 75 08             	mov    0x8(%ebp),%esi
+  80157c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80157f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801582:	85 c0                	test   %eax,%eax
+  801584:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801589:	0f 44 c2             	cmove  %edx,%eax
+  80158c:	83 ec 0c             	sub    $0xc,%esp
+  80158f:	50                   	push   %eax
+  801590:	e8 1c fa ff ff       	call   800fb1 <sys_ipc_recv>
+  801595:	83 c4 10             	add    $0x10,%esp
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	78 2a                	js     8015c6 <ipc_recv+0x52>
+  80159c:	a1 10 50 80 00       	mov    0x805010,%eax
+  8015a1:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8015a7:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8015ad:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8015b3:	85 f6                	test   %esi,%esi
+  8015b5:	74 02                	je     8015b9 <ipc_recv+0x45>
+  8015b7:	89 0e                	mov    %ecx,(%esi)
+  8015b9:	85 db                	test   %ebx,%ebx
+  8015bb:	74 02                	je     8015bf <ipc_recv+0x4b>
+  8015bd:	89 13                	mov    %edx,(%ebx)
+  8015bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5d                   	pop    %ebp
+  8015c5:	c3                   	ret
+  8015c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d0:	eb e1                	jmp    8015b3 <ipc_recv+0x3f>
+
+008015d2 <ipc_send>:
+  8015d2:	55                   	push   %ebp
+  8015d3:	89 e5                	mov    %esp,%ebp
+  8015d5:	57                   	push   %edi
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+  8015db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8015de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e1:	8b 75 14             	mov    0x14(%ebp),%esi
+  8015e4:	85 db                	test   %ebx,%ebx
+  8015e6:	74 1e                	je     801606 <ipc_send+0x34>
+  8015e8:	56                   	push   %esi
+  8015e9:	53                   	push   %ebx
+  8015ea:	57                   	push   %edi
+  8015eb:	ff 75 08             	push   0x8(%ebp)
+  8015ee:	e8 4b fa ff ff       	call   80103e <sys_ipc_send>
+  8015f3:	83 c4 10             	add    $0x10,%esp
+  8015f6:	85 c0                	test   %eax,%eax
+  8015f8:	74 2a                	je     801624 <ipc_send+0x52>
+  8015fa:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8015fd:	75 13                	jne    801612 <ipc_send+0x40>
+  8015ff:	e8 b7 f6 ff ff       	call   800cbb <sys_yield>
+  801604:	eb e2                	jmp    8015e8 <ipc_send+0x16>
+  801606:	be 00 00 00 00       	mov    $0x0,%esi
+  80160b:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801610:	eb d6                	jmp    8015e8 <ipc_send+0x16>
+  801612:	50                   	push   %eax
+  801613:	68 38 35 80 00       	push   $0x803538
+  801618:	6a 4f                	push   $0x4f
+  80161a:	68 7b 35 80 00       	push   $0x80357b
+  80161f:	e8 1c 19 00 00       	call   802f40 <_panic>
+  801624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801627:	5b                   	pop    %ebx
+  801628:	5e                   	pop    %esi
+  801629:	5f                   	pop    %edi
+  80162a:	5d                   	pop    %ebp
+  80162b:	c3                   	ret
+
+0080162c <ipc_call>:
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	57                   	push   %edi
+  801630:	56                   	push   %esi
+  801631:	53                   	push   %ebx
+  801632:	83 ec 0c             	sub    $0xc,%esp
+  801635:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801639:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  80163e:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801642:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801646:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  80164b:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80164f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801653:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801658:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  80165c:	eb 05                	jmp    801663 <ipc_call+0x37>
+  80165e:	e8 58 f6 ff ff       	call   800cbb <sys_yield>
+  801663:	83 ec 0c             	sub    $0xc,%esp
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	57                   	push   %edi
+  801669:	ff 75 0c             	push   0xc(%ebp)
+  80166c:	ff 75 08             	push   0x8(%ebp)
+  80166f:	e8 1a fa ff ff       	call   80108e <sys_ipc_call>
+  801674:	83 c4 20             	add    $0x20,%esp
+  801677:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80167a:	74 e2                	je     80165e <ipc_call+0x32>
+  80167c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80167f:	74 2d                	je     8016ae <ipc_call+0x82>
+  801681:	85 c0                	test   %eax,%eax
+  801683:	78 4f                	js     8016d4 <ipc_call+0xa8>
+  801685:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801689:	74 10                	je     80169b <ipc_call+0x6f>
+  80168b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801690:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801696:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801699:	89 02                	mov    %eax,(%edx)
+  80169b:	a1 10 50 80 00       	mov    0x805010,%eax
+  8016a0:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8016a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a9:	5b                   	pop    %ebx
+  8016aa:	5e                   	pop    %esi
+  8016ab:	5f                   	pop    %edi
+  8016ac:	5d                   	pop    %ebp
+  8016ad:	c3                   	ret
+  8016ae:	ff 75 14             	push   0x14(%ebp)
+  8016b1:	ff 75 10             	push   0x10(%ebp)
+  8016b4:	ff 75 0c             	push   0xc(%ebp)
+  8016b7:	ff 75 08             	push   0x8(%ebp)
+  8016ba:	e8 13 ff ff ff       	call   8015d2 <ipc_send>
+  8016bf:	83 c4 0c             	add    $0xc,%esp
+  8016c2:	ff 75 1c             	push   0x1c(%ebp)
+  8016c5:	ff 75 18             	push   0x18(%ebp)
+  8016c8:	6a 00                	push   $0x0
+  8016ca:	e8 a5 fe ff ff       	call   801574 <ipc_recv>
+  8016cf:	83 c4 10             	add    $0x10,%esp
+  8016d2:	eb d2                	jmp    8016a6 <ipc_call+0x7a>
+  8016d4:	50                   	push   %eax
+  8016d5:	68 85 35 80 00       	push   $0x803585
+  8016da:	6a 6d                	push   $0x6d
+  8016dc:	68 7b 35 80 00       	push   $0x80357b
+  8016e1:	e8 5a 18 00 00       	call   802f40 <_panic>
+
+008016e6 <ipc_reply_recv>:
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	57                   	push   %edi
+  8016ea:	56                   	push   %esi
+  8016eb:	53                   	push   %ebx
+  8016ec:	83 ec 0c             	sub    $0xc,%esp
+  8016ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f2:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8016f5:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8016f8:	85 db                	test   %ebx,%ebx
+  8016fa:	0f 84 ac 00 00 00    	je     8017ac <ipc_reply_recv+0xc6>
+  801700:	85 f6                	test   %esi,%esi
+  801702:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801707:	0f 45 c6             	cmovne %esi,%eax
+  80170a:	83 ec 0c             	sub    $0xc,%esp
+  80170d:	50                   	push   %eax
+  80170e:	ff 75 14             	push   0x14(%ebp)
+  801711:	53                   	push   %ebx
+  801712:	ff 75 0c             	push   0xc(%ebp)
+  801715:	ff 75 08             	push   0x8(%ebp)
+  801718:	e8 92 f9 ff ff       	call   8010af <sys_ipc_reply_recv>
+  80171d:	83 c4 20             	add    $0x20,%esp
+  801720:	85 c0                	test   %eax,%eax
+  801722:	78 3a                	js     80175e <ipc_reply_recv+0x78>
+  801724:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801728:	74 10                	je     80173a <ipc_reply_recv+0x54>
+  80172a:	a1 10 50 80 00       	mov    0x805010,%eax
+  80172f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801735:	8b 55 18             	mov    0x18(%ebp),%edx
+  801738:	89 02                	mov    %eax,(%edx)
+  80173a:	85 ff                	test   %edi,%edi
+  80173c:	74 0d                	je     80174b <ipc_reply_recv+0x65>
+  80173e:	a1 10 50 80 00       	mov    0x805010,%eax
+  801743:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801749:	89 07                	mov    %eax,(%edi)
+  80174b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801750:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801756:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801759:	5b                   	pop    %ebx
+  80175a:	5e                   	pop    %esi
+  80175b:	5f                   	pop    %edi
+  80175c:	5d                   	pop    %ebp
+  80175d:	c3                   	ret
+  80175e:	ff 75 14             	push   0x14(%ebp)
+  801761:	53                   	push   %ebx
+  801762:	ff 75 0c             	push   0xc(%ebp)
+  801765:	ff 75 08             	push   0x8(%ebp)
+  801768:	e8 f4 f7 ff ff       	call   800f61 <sys_ipc_try_send>
+  80176d:	89 c2                	mov    %eax,%edx
+  80176f:	c1 ea 1f             	shr    $0x1f,%edx
+  801772:	83 c4 10             	add    $0x10,%esp
+  801775:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801778:	0f 95 c1             	setne  %cl
+  80177b:	84 d1                	test   %dl,%cl
+  80177d:	74 05                	je     801784 <ipc_reply_recv+0x9e>
+  80177f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801782:	75 12                	jne    801796 <ipc_reply_recv+0xb0>
+  801784:	83 ec 04             	sub    $0x4,%esp
+  801787:	57                   	push   %edi
+  801788:	56                   	push   %esi
+  801789:	ff 75 18             	push   0x18(%ebp)
+  80178c:	e8 e3 fd ff ff       	call   801574 <ipc_recv>
+  801791:	83 c4 10             	add    $0x10,%esp
+  801794:	eb c0                	jmp    801756 <ipc_reply_recv+0x70>
+  801796:	83 ec 04             	sub    $0x4,%esp
+  801799:	50                   	push   %eax
+  80179a:	ff 75 08             	push   0x8(%ebp)
+  80179d:	68 58 35 80 00       	push   $0x803558
+  8017a2:	e8 08 ea ff ff       	call   8001af <cprintf>
+  8017a7:	83 c4 10             	add    $0x10,%esp
+  8017aa:	eb d8                	jmp    801784 <ipc_reply_recv+0x9e>
+  8017ac:	85 f6                	test   %esi,%esi
+  8017ae:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8017b3:	0f 45 c6             	cmovne %esi,%eax
+  8017b6:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8017bb:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8017c2:	e9 43 ff ff ff       	jmp    80170a <ipc_reply_recv+0x24>
+
+008017c7 <ipc_find_env>:
+  8017c7:	55                   	push   %ebp
+  8017c8:	89 e5                	mov    %esp,%ebp
+  8017ca:	83 ec 14             	sub    $0x14,%esp
+  8017cd:	ff 75 08             	push   0x8(%ebp)
+  8017d0:	e8 2a f7 ff ff       	call   800eff <sys_env_service>
+  8017d5:	85 c0                	test   %eax,%eax
+  8017d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017dc:	0f 48 c2             	cmovs  %edx,%eax
+  8017df:	c9                   	leave
+  8017e0:	c3                   	ret
+
+008017e1 <fd2num>:
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017ec:	c1 e8 0c             	shr    $0xc,%eax
+  8017ef:	5d                   	pop    %ebp
+  8017f0:	c3                   	ret
+
+008017f1 <fd2data>:
+  8017f1:	55                   	push   %ebp
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017fc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801801:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801806:	5d                   	pop    %ebp
+  801807:	c3                   	ret
+
+00801808 <fd_alloc>:
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801810:	89 c2                	mov    %eax,%edx
+  801812:	c1 ea 16             	shr    $0x16,%edx
+  801815:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80181c:	f6 c2 01             	test   $0x1,%dl
+  80181f:	74 29                	je     80184a <fd_alloc+0x42>
+  801821:	89 c2                	mov    %eax,%edx
+  801823:	c1 ea 0c             	shr    $0xc,%edx
+  801826:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80182d:	f6 c2 01             	test   $0x1,%dl
+  801830:	74 18                	je     80184a <fd_alloc+0x42>
+  801832:	05 00 10 00 00       	add    $0x1000,%eax
+  801837:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80183c:	75 d2                	jne    801810 <fd_alloc+0x8>
+  80183e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801843:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801848:	eb 05                	jmp    80184f <fd_alloc+0x47>
+  80184a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80184f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801852:	89 02                	mov    %eax,(%edx)
+  801854:	89 c8                	mov    %ecx,%eax
+  801856:	5d                   	pop    %ebp
+  801857:	c3                   	ret
+
+00801858 <fd_lookup>:
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185e:	83 f8 1f             	cmp    $0x1f,%eax
+  801861:	77 30                	ja     801893 <fd_lookup+0x3b>
+  801863:	c1 e0 0c             	shl    $0xc,%eax
+  801866:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  80186b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801871:	f6 c2 01             	test   $0x1,%dl
+  801874:	74 24                	je     80189a <fd_lookup+0x42>
+  801876:	89 c2                	mov    %eax,%edx
+  801878:	c1 ea 0c             	shr    $0xc,%edx
+  80187b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801882:	f6 c2 01             	test   $0x1,%dl
+  801885:	74 1a                	je     8018a1 <fd_lookup+0x49>
+  801887:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80188a:	89 02                	mov    %eax,(%edx)
+  80188c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801891:	5d                   	pop    %ebp
+  801892:	c3                   	ret
+  801893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801898:	eb f7                	jmp    801891 <fd_lookup+0x39>
+  80189a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189f:	eb f0                	jmp    801891 <fd_lookup+0x39>
+  8018a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a6:	eb e9                	jmp    801891 <fd_lookup+0x39>
+
+008018a8 <dev_lookup>:
+  8018a8:	55                   	push   %ebp
+  8018a9:	89 e5                	mov    %esp,%ebp
+  8018ab:	53                   	push   %ebx
+  8018ac:	83 ec 04             	sub    $0x4,%esp
+  8018af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b7:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8018bc:	39 13                	cmp    %edx,(%ebx)
+  8018be:	74 37                	je     8018f7 <dev_lookup+0x4f>
+  8018c0:	83 c0 01             	add    $0x1,%eax
+  8018c3:	8b 1c 85 20 36 80 00 	mov    0x803620(,%eax,4),%ebx
+  8018ca:	85 db                	test   %ebx,%ebx
+  8018cc:	75 ee                	jne    8018bc <dev_lookup+0x14>
+  8018ce:	a1 10 50 80 00       	mov    0x805010,%eax
+  8018d3:	8b 40 48             	mov    0x48(%eax),%eax
+  8018d6:	83 ec 04             	sub    $0x4,%esp
+  8018d9:	52                   	push   %edx
+  8018da:	50                   	push   %eax
+  8018db:	68 a4 35 80 00       	push   $0x8035a4
+  8018e0:	e8 ca e8 ff ff       	call   8001af <cprintf>
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018f0:	89 1a                	mov    %ebx,(%edx)
+  8018f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+  8018f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fc:	eb ef                	jmp    8018ed <dev_lookup+0x45>
+
+008018fe <fd_close>:
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	57                   	push   %edi
+  801902:	56                   	push   %esi
+  801903:	53                   	push   %ebx
+  801904:	83 ec 24             	sub    $0x24,%esp
+  801907:	8b 75 08             	mov    0x8(%ebp),%esi
+  80190a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80190d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801910:	50                   	push   %eax
+  801911:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801917:	c1 e8 0c             	shr    $0xc,%eax
+  80191a:	50                   	push   %eax
+  80191b:	e8 38 ff ff ff       	call   801858 <fd_lookup>
+  801920:	89 c3                	mov    %eax,%ebx
+  801922:	83 c4 10             	add    $0x10,%esp
+  801925:	85 c0                	test   %eax,%eax
+  801927:	78 05                	js     80192e <fd_close+0x30>
+  801929:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80192c:	74 0f                	je     80193d <fd_close+0x3f>
+  80192e:	85 ff                	test   %edi,%edi
+  801930:	0f 44 df             	cmove  %edi,%ebx
+  801933:	89 d8                	mov    %ebx,%eax
+  801935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801938:	5b                   	pop    %ebx
+  801939:	5e                   	pop    %esi
+  80193a:	5f                   	pop    %edi
+  80193b:	5d                   	pop    %ebp
+  80193c:	c3                   	ret
+  80193d:	83 ec 08             	sub    $0x8,%esp
+  801940:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801943:	50                   	push   %eax
+  801944:	ff 36                	push   (%esi)
+  801946:	e8 5d ff ff ff       	call   8018a8 <dev_lookup>
+  80194b:	89 c3                	mov    %eax,%ebx
+  80194d:	83 c4 10             	add    $0x10,%esp
+  801950:	85 c0                	test   %eax,%eax
+  801952:	78 1a                	js     80196e <fd_close+0x70>
+  801954:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801957:	8b 40 10             	mov    0x10(%eax),%eax
+  80195a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80195f:	85 c0                	test   %eax,%eax
+  801961:	74 0b                	je     80196e <fd_close+0x70>
+  801963:	83 ec 0c             	sub    $0xc,%esp
+  801966:	56                   	push   %esi
+  801967:	ff d0                	call   *%eax
+  801969:	89 c3                	mov    %eax,%ebx
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	83 ec 08             	sub    $0x8,%esp
+  801971:	56                   	push   %esi
+  801972:	6a 00                	push   $0x0
+  801974:	e8 5f f4 ff ff       	call   800dd8 <sys_page_unmap>
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	eb b5                	jmp    801933 <fd_close+0x35>
+
+0080197e <close>:
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	83 ec 20             	sub    $0x20,%esp
+  801984:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801987:	50                   	push   %eax
+  801988:	ff 75 08             	push   0x8(%ebp)
+  80198b:	e8 c8 fe ff ff       	call   801858 <fd_lookup>
+  801990:	83 c4 10             	add    $0x10,%esp
+  801993:	85 c0                	test   %eax,%eax
+  801995:	79 02                	jns    801999 <close+0x1b>
+  801997:	c9                   	leave
+  801998:	c3                   	ret
+  801999:	83 ec 08             	sub    $0x8,%esp
+  80199c:	6a 01                	push   $0x1
+  80199e:	ff 75 f4             	push   -0xc(%ebp)
+  8019a1:	e8 58 ff ff ff       	call   8018fe <fd_close>
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	eb ec                	jmp    801997 <close+0x19>
+
+008019ab <close_all>:
+  8019ab:	55                   	push   %ebp
+  8019ac:	89 e5                	mov    %esp,%ebp
+  8019ae:	53                   	push   %ebx
+  8019af:	83 ec 04             	sub    $0x4,%esp
+  8019b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b7:	83 ec 0c             	sub    $0xc,%esp
+  8019ba:	53                   	push   %ebx
+  8019bb:	e8 be ff ff ff       	call   80197e <close>
+  8019c0:	83 c3 01             	add    $0x1,%ebx
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	83 fb 20             	cmp    $0x20,%ebx
+  8019c9:	75 ec                	jne    8019b7 <close_all+0xc>
+  8019cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+
+008019d0 <dup>:
+  8019d0:	55                   	push   %ebp
+  8019d1:	89 e5                	mov    %esp,%ebp
+  8019d3:	57                   	push   %edi
+  8019d4:	56                   	push   %esi
+  8019d5:	53                   	push   %ebx
+  8019d6:	83 ec 34             	sub    $0x34,%esp
+  8019d9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019dc:	50                   	push   %eax
+  8019dd:	ff 75 08             	push   0x8(%ebp)
+  8019e0:	e8 73 fe ff ff       	call   801858 <fd_lookup>
+  8019e5:	89 c3                	mov    %eax,%ebx
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	78 7f                	js     801a6d <dup+0x9d>
+  8019ee:	83 ec 0c             	sub    $0xc,%esp
+  8019f1:	ff 75 0c             	push   0xc(%ebp)
+  8019f4:	e8 85 ff ff ff       	call   80197e <close>
+  8019f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019fc:	c1 e6 0c             	shl    $0xc,%esi
+  8019ff:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801a05:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a08:	89 3c 24             	mov    %edi,(%esp)
+  801a0b:	e8 e1 fd ff ff       	call   8017f1 <fd2data>
+  801a10:	89 c3                	mov    %eax,%ebx
+  801a12:	89 34 24             	mov    %esi,(%esp)
+  801a15:	e8 d7 fd ff ff       	call   8017f1 <fd2data>
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a20:	89 d8                	mov    %ebx,%eax
+  801a22:	c1 e8 16             	shr    $0x16,%eax
+  801a25:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a2c:	a8 01                	test   $0x1,%al
+  801a2e:	74 11                	je     801a41 <dup+0x71>
+  801a30:	89 d8                	mov    %ebx,%eax
+  801a32:	c1 e8 0c             	shr    $0xc,%eax
+  801a35:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a3c:	f6 c2 01             	test   $0x1,%dl
+  801a3f:	75 36                	jne    801a77 <dup+0xa7>
+  801a41:	89 f8                	mov    %edi,%eax
+  801a43:	c1 e8 0c             	shr    $0xc,%eax
+  801a46:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a4d:	83 ec 0c             	sub    $0xc,%esp
+  801a50:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a55:	50                   	push   %eax
+  801a56:	56                   	push   %esi
+  801a57:	6a 00                	push   $0x0
+  801a59:	57                   	push   %edi
+  801a5a:	6a 00                	push   $0x0
+  801a5c:	e8 e8 f2 ff ff       	call   800d49 <sys_page_map>
+  801a61:	89 c3                	mov    %eax,%ebx
+  801a63:	83 c4 20             	add    $0x20,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 33                	js     801a9d <dup+0xcd>
+  801a6a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a6d:	89 d8                	mov    %ebx,%eax
+  801a6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a72:	5b                   	pop    %ebx
+  801a73:	5e                   	pop    %esi
+  801a74:	5f                   	pop    %edi
+  801a75:	5d                   	pop    %ebp
+  801a76:	c3                   	ret
+  801a77:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a7e:	83 ec 0c             	sub    $0xc,%esp
+  801a81:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a86:	50                   	push   %eax
+  801a87:	ff 75 d4             	push   -0x2c(%ebp)
+  801a8a:	6a 00                	push   $0x0
+  801a8c:	53                   	push   %ebx
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	e8 b5 f2 ff ff       	call   800d49 <sys_page_map>
+  801a94:	89 c3                	mov    %eax,%ebx
+  801a96:	83 c4 20             	add    $0x20,%esp
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	79 a4                	jns    801a41 <dup+0x71>
+  801a9d:	83 ec 08             	sub    $0x8,%esp
+  801aa0:	56                   	push   %esi
+  801aa1:	6a 00                	push   $0x0
+  801aa3:	e8 30 f3 ff ff       	call   800dd8 <sys_page_unmap>
+  801aa8:	83 c4 08             	add    $0x8,%esp
+  801aab:	ff 75 d4             	push   -0x2c(%ebp)
+  801aae:	6a 00                	push   $0x0
+  801ab0:	e8 23 f3 ff ff       	call   800dd8 <sys_page_unmap>
+  801ab5:	83 c4 10             	add    $0x10,%esp
+  801ab8:	eb b3                	jmp    801a6d <dup+0x9d>
+
+00801aba <read>:
+  801aba:	55                   	push   %ebp
+  801abb:	89 e5                	mov    %esp,%ebp
+  801abd:	56                   	push   %esi
+  801abe:	53                   	push   %ebx
+  801abf:	83 ec 18             	sub    $0x18,%esp
+  801ac2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ac8:	50                   	push   %eax
+  801ac9:	56                   	push   %esi
+  801aca:	e8 89 fd ff ff       	call   801858 <fd_lookup>
+  801acf:	83 c4 10             	add    $0x10,%esp
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	78 3c                	js     801b12 <read+0x58>
+  801ad6:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ad9:	83 ec 08             	sub    $0x8,%esp
+  801adc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801adf:	50                   	push   %eax
+  801ae0:	ff 33                	push   (%ebx)
+  801ae2:	e8 c1 fd ff ff       	call   8018a8 <dev_lookup>
+  801ae7:	83 c4 10             	add    $0x10,%esp
+  801aea:	85 c0                	test   %eax,%eax
+  801aec:	78 24                	js     801b12 <read+0x58>
+  801aee:	8b 43 08             	mov    0x8(%ebx),%eax
+  801af1:	83 e0 03             	and    $0x3,%eax
+  801af4:	83 f8 01             	cmp    $0x1,%eax
+  801af7:	74 20                	je     801b19 <read+0x5f>
+  801af9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801afc:	8b 40 08             	mov    0x8(%eax),%eax
+  801aff:	85 c0                	test   %eax,%eax
+  801b01:	74 37                	je     801b3a <read+0x80>
+  801b03:	83 ec 04             	sub    $0x4,%esp
+  801b06:	ff 75 10             	push   0x10(%ebp)
+  801b09:	ff 75 0c             	push   0xc(%ebp)
+  801b0c:	53                   	push   %ebx
+  801b0d:	ff d0                	call   *%eax
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b15:	5b                   	pop    %ebx
+  801b16:	5e                   	pop    %esi
+  801b17:	5d                   	pop    %ebp
+  801b18:	c3                   	ret
+  801b19:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b1e:	8b 40 48             	mov    0x48(%eax),%eax
+  801b21:	83 ec 04             	sub    $0x4,%esp
+  801b24:	56                   	push   %esi
+  801b25:	50                   	push   %eax
+  801b26:	68 e5 35 80 00       	push   $0x8035e5
+  801b2b:	e8 7f e6 ff ff       	call   8001af <cprintf>
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b38:	eb d8                	jmp    801b12 <read+0x58>
+  801b3a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b3f:	eb d1                	jmp    801b12 <read+0x58>
+
+00801b41 <readn>:
+  801b41:	55                   	push   %ebp
+  801b42:	89 e5                	mov    %esp,%ebp
+  801b44:	57                   	push   %edi
+  801b45:	56                   	push   %esi
+  801b46:	53                   	push   %ebx
+  801b47:	83 ec 0c             	sub    $0xc,%esp
+  801b4a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b4d:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b50:	85 f6                	test   %esi,%esi
+  801b52:	74 30                	je     801b84 <readn+0x43>
+  801b54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5e:	83 ec 04             	sub    $0x4,%esp
+  801b61:	89 f2                	mov    %esi,%edx
+  801b63:	29 c2                	sub    %eax,%edx
+  801b65:	52                   	push   %edx
+  801b66:	01 f8                	add    %edi,%eax
+  801b68:	50                   	push   %eax
+  801b69:	ff 75 08             	push   0x8(%ebp)
+  801b6c:	e8 49 ff ff ff       	call   801aba <read>
+  801b71:	83 c4 10             	add    $0x10,%esp
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	78 15                	js     801b8d <readn+0x4c>
+  801b78:	74 11                	je     801b8b <readn+0x4a>
+  801b7a:	01 c3                	add    %eax,%ebx
+  801b7c:	89 d8                	mov    %ebx,%eax
+  801b7e:	39 f3                	cmp    %esi,%ebx
+  801b80:	72 dc                	jb     801b5e <readn+0x1d>
+  801b82:	eb 09                	jmp    801b8d <readn+0x4c>
+  801b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b89:	eb 02                	jmp    801b8d <readn+0x4c>
+  801b8b:	89 d8                	mov    %ebx,%eax
+  801b8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b90:	5b                   	pop    %ebx
+  801b91:	5e                   	pop    %esi
+  801b92:	5f                   	pop    %edi
+  801b93:	5d                   	pop    %ebp
+  801b94:	c3                   	ret
+
+00801b95 <write>:
+  801b95:	55                   	push   %ebp
+  801b96:	89 e5                	mov    %esp,%ebp
+  801b98:	56                   	push   %esi
+  801b99:	53                   	push   %ebx
+  801b9a:	83 ec 18             	sub    $0x18,%esp
+  801b9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ba0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ba3:	50                   	push   %eax
+  801ba4:	53                   	push   %ebx
+  801ba5:	e8 ae fc ff ff       	call   801858 <fd_lookup>
+  801baa:	83 c4 10             	add    $0x10,%esp
+  801bad:	85 c0                	test   %eax,%eax
+  801baf:	78 37                	js     801be8 <write+0x53>
+  801bb1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bb4:	83 ec 08             	sub    $0x8,%esp
+  801bb7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bba:	50                   	push   %eax
+  801bbb:	ff 36                	push   (%esi)
+  801bbd:	e8 e6 fc ff ff       	call   8018a8 <dev_lookup>
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	85 c0                	test   %eax,%eax
+  801bc7:	78 1f                	js     801be8 <write+0x53>
+  801bc9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bcd:	74 20                	je     801bef <write+0x5a>
+  801bcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	74 37                	je     801c10 <write+0x7b>
+  801bd9:	83 ec 04             	sub    $0x4,%esp
+  801bdc:	ff 75 10             	push   0x10(%ebp)
+  801bdf:	ff 75 0c             	push   0xc(%ebp)
+  801be2:	56                   	push   %esi
+  801be3:	ff d0                	call   *%eax
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801beb:	5b                   	pop    %ebx
+  801bec:	5e                   	pop    %esi
+  801bed:	5d                   	pop    %ebp
+  801bee:	c3                   	ret
+  801bef:	a1 10 50 80 00       	mov    0x805010,%eax
+  801bf4:	8b 40 48             	mov    0x48(%eax),%eax
+  801bf7:	83 ec 04             	sub    $0x4,%esp
+  801bfa:	53                   	push   %ebx
+  801bfb:	50                   	push   %eax
+  801bfc:	68 01 36 80 00       	push   $0x803601
+  801c01:	e8 a9 e5 ff ff       	call   8001af <cprintf>
+  801c06:	83 c4 10             	add    $0x10,%esp
+  801c09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c0e:	eb d8                	jmp    801be8 <write+0x53>
+  801c10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c15:	eb d1                	jmp    801be8 <write+0x53>
+
+00801c17 <seek>:
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	83 ec 20             	sub    $0x20,%esp
+  801c1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c20:	50                   	push   %eax
+  801c21:	ff 75 08             	push   0x8(%ebp)
+  801c24:	e8 2f fc ff ff       	call   801858 <fd_lookup>
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	85 c0                	test   %eax,%eax
+  801c2e:	78 0e                	js     801c3e <seek+0x27>
+  801c30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c36:	89 50 04             	mov    %edx,0x4(%eax)
+  801c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3e:	c9                   	leave
+  801c3f:	c3                   	ret
+
+00801c40 <ftruncate>:
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	56                   	push   %esi
+  801c44:	53                   	push   %ebx
+  801c45:	83 ec 18             	sub    $0x18,%esp
+  801c48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c4b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c4e:	50                   	push   %eax
+  801c4f:	53                   	push   %ebx
+  801c50:	e8 03 fc ff ff       	call   801858 <fd_lookup>
+  801c55:	83 c4 10             	add    $0x10,%esp
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	78 34                	js     801c90 <ftruncate+0x50>
+  801c5c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c5f:	83 ec 08             	sub    $0x8,%esp
+  801c62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c65:	50                   	push   %eax
+  801c66:	ff 36                	push   (%esi)
+  801c68:	e8 3b fc ff ff       	call   8018a8 <dev_lookup>
+  801c6d:	83 c4 10             	add    $0x10,%esp
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	78 1c                	js     801c90 <ftruncate+0x50>
+  801c74:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c78:	74 1d                	je     801c97 <ftruncate+0x57>
+  801c7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7d:	8b 40 18             	mov    0x18(%eax),%eax
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	74 34                	je     801cb8 <ftruncate+0x78>
+  801c84:	83 ec 08             	sub    $0x8,%esp
+  801c87:	ff 75 0c             	push   0xc(%ebp)
+  801c8a:	56                   	push   %esi
+  801c8b:	ff d0                	call   *%eax
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c93:	5b                   	pop    %ebx
+  801c94:	5e                   	pop    %esi
+  801c95:	5d                   	pop    %ebp
+  801c96:	c3                   	ret
+  801c97:	a1 10 50 80 00       	mov    0x805010,%eax
+  801c9c:	8b 40 48             	mov    0x48(%eax),%eax
+  801c9f:	83 ec 04             	sub    $0x4,%esp
+  801ca2:	53                   	push   %ebx
+  801ca3:	50                   	push   %eax
+  801ca4:	68 c4 35 80 00       	push   $0x8035c4
+  801ca9:	e8 01 e5 ff ff       	call   8001af <cprintf>
+  801cae:	83 c4 10             	add    $0x10,%esp
+  801cb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cb6:	eb d8                	jmp    801c90 <ftruncate+0x50>
+  801cb8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cbd:	eb d1                	jmp    801c90 <ftruncate+0x50>
+
+00801cbf <fstat>:
+  801cbf:	55                   	push   %ebp
+  801cc0:	89 e5                	mov    %esp,%ebp
+  801cc2:	56                   	push   %esi
+  801cc3:	53                   	push   %ebx
+  801cc4:	83 ec 18             	sub    $0x18,%esp
+  801cc7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ccd:	50                   	push   %eax
+  801cce:	ff 75 08             	push   0x8(%ebp)
+  801cd1:	e8 82 fb ff ff       	call   801858 <fd_lookup>
+  801cd6:	83 c4 10             	add    $0x10,%esp
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	78 49                	js     801d26 <fstat+0x67>
+  801cdd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ce0:	83 ec 08             	sub    $0x8,%esp
+  801ce3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce6:	50                   	push   %eax
+  801ce7:	ff 36                	push   (%esi)
+  801ce9:	e8 ba fb ff ff       	call   8018a8 <dev_lookup>
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 31                	js     801d26 <fstat+0x67>
+  801cf5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801cfc:	74 2f                	je     801d2d <fstat+0x6e>
+  801cfe:	c6 03 00             	movb   $0x0,(%ebx)
+  801d01:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d08:	00 00 00 
+  801d0b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d12:	00 00 00 
+  801d15:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801d1b:	83 ec 08             	sub    $0x8,%esp
+  801d1e:	53                   	push   %ebx
+  801d1f:	56                   	push   %esi
+  801d20:	ff 50 14             	call   *0x14(%eax)
+  801d23:	83 c4 10             	add    $0x10,%esp
+  801d26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d29:	5b                   	pop    %ebx
+  801d2a:	5e                   	pop    %esi
+  801d2b:	5d                   	pop    %ebp
+  801d2c:	c3                   	ret
+  801d2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d32:	eb f2                	jmp    801d26 <fstat+0x67>
+
+00801d34 <stat>:
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	56                   	push   %esi
+  801d38:	53                   	push   %ebx
+  801d39:	83 ec 08             	sub    $0x8,%esp
+  801d3c:	6a 00                	push   $0x0
+  801d3e:	ff 75 08             	push   0x8(%ebp)
+  801d41:	e8 31 05 00 00       	call   802277 <open>
+  801d46:	89 c3                	mov    %eax,%ebx
+  801d48:	83 c4 10             	add    $0x10,%esp
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 1b                	js     801d6a <stat+0x36>
+  801d4f:	83 ec 08             	sub    $0x8,%esp
+  801d52:	ff 75 0c             	push   0xc(%ebp)
+  801d55:	50                   	push   %eax
+  801d56:	e8 64 ff ff ff       	call   801cbf <fstat>
+  801d5b:	89 c6                	mov    %eax,%esi
+  801d5d:	89 1c 24             	mov    %ebx,(%esp)
+  801d60:	e8 19 fc ff ff       	call   80197e <close>
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	89 f3                	mov    %esi,%ebx
+  801d6a:	89 d8                	mov    %ebx,%eax
+  801d6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d6f:	5b                   	pop    %ebx
+  801d70:	5e                   	pop    %esi
+  801d71:	5d                   	pop    %ebp
+  801d72:	c3                   	ret
+
+00801d73 <fsipc>:
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	56                   	push   %esi
+  801d77:	53                   	push   %ebx
+  801d78:	89 c3                	mov    %eax,%ebx
+  801d7a:	89 d6                	mov    %edx,%esi
+  801d7c:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801d83:	74 20                	je     801da5 <fsipc+0x32>
+  801d85:	83 ec 08             	sub    $0x8,%esp
+  801d88:	6a 00                	push   $0x0
+  801d8a:	56                   	push   %esi
+  801d8b:	6a 07                	push   $0x7
+  801d8d:	68 00 60 80 00       	push   $0x806000
+  801d92:	53                   	push   %ebx
+  801d93:	ff 35 08 50 80 00    	push   0x805008
+  801d99:	e8 8e f8 ff ff       	call   80162c <ipc_call>
+  801d9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da1:	5b                   	pop    %ebx
+  801da2:	5e                   	pop    %esi
+  801da3:	5d                   	pop    %ebp
+  801da4:	c3                   	ret
+  801da5:	83 ec 0c             	sub    $0xc,%esp
+  801da8:	6a 02                	push   $0x2
+  801daa:	e8 18 fa ff ff       	call   8017c7 <ipc_find_env>
+  801daf:	a3 08 50 80 00       	mov    %eax,0x805008
+  801db4:	83 c4 10             	add    $0x10,%esp
+  801db7:	eb cc                	jmp    801d85 <fsipc+0x12>
+
+00801db9 <devfile_trunc>:
+  801db9:	55                   	push   %ebp
+  801dba:	89 e5                	mov    %esp,%ebp
+  801dbc:	83 ec 08             	sub    $0x8,%esp
+  801dbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dc5:	a3 00 60 80 00       	mov    %eax,0x806000
+  801dca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dcd:	a3 04 60 80 00       	mov    %eax,0x806004
+  801dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ddc:	e8 92 ff ff ff       	call   801d73 <fsipc>
+  801de1:	c9                   	leave
+  801de2:	c3                   	ret
+
+00801de3 <devfile_flush>:
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	83 ec 08             	sub    $0x8,%esp
+  801de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dec:	8b 40 0c             	mov    0xc(%eax),%eax
+  801def:	a3 00 60 80 00       	mov    %eax,0x806000
+  801df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df9:	b8 08 00 00 00       	mov    $0x8,%eax
+  801dfe:	e8 70 ff ff ff       	call   801d73 <fsipc>
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+
+00801e05 <devfile_stat>:
+  801e05:	55                   	push   %ebp
+  801e06:	89 e5                	mov    %esp,%ebp
+  801e08:	53                   	push   %ebx
+  801e09:	83 ec 04             	sub    $0x4,%esp
+  801e0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e12:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e15:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e1f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e24:	e8 4a ff ff ff       	call   801d73 <fsipc>
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	78 2c                	js     801e59 <devfile_stat+0x54>
+  801e2d:	83 ec 08             	sub    $0x8,%esp
+  801e30:	68 00 60 80 00       	push   $0x806000
+  801e35:	53                   	push   %ebx
+  801e36:	e8 6b ea ff ff       	call   8008a6 <strcpy>
+  801e3b:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e40:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801e46:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e4b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5c:	c9                   	leave
+  801e5d:	c3                   	ret
+
+00801e5e <fsring_rw>:
+  801e5e:	55                   	push   %ebp
+  801e5f:	89 e5                	mov    %esp,%ebp
+  801e61:	57                   	push   %edi
+  801e62:	56                   	push   %esi
+  801e63:	53                   	push   %ebx
+  801e64:	83 ec 2c             	sub    $0x2c,%esp
+  801e67:	89 c7                	mov    %eax,%edi
+  801e69:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e6c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801e6f:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801e74:	a8 01                	test   $0x1,%al
+  801e76:	74 0d                	je     801e85 <fsring_rw+0x27>
+  801e78:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801e7d:	a8 01                	test   $0x1,%al
+  801e7f:	0f 85 d5 00 00 00    	jne    801f5a <fsring_rw+0xfc>
+  801e85:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e8a:	8b 40 48             	mov    0x48(%eax),%eax
+  801e8d:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801e93:	0f 84 fc 00 00 00    	je     801f95 <fsring_rw+0x137>
+  801e99:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801ea0:	0f 84 02 01 00 00    	je     801fa8 <fsring_rw+0x14a>
+  801ea6:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801eab:	83 ec 04             	sub    $0x4,%esp
+  801eae:	68 07 02 00 00       	push   $0x207
+  801eb3:	53                   	push   %ebx
+  801eb4:	6a 00                	push   $0x0
+  801eb6:	e8 4b ee ff ff       	call   800d06 <sys_page_alloc>
+  801ebb:	83 c4 10             	add    $0x10,%esp
+  801ebe:	85 c0                	test   %eax,%eax
+  801ec0:	0f 88 f9 00 00 00    	js     801fbf <fsring_rw+0x161>
+  801ec6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ecc:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ed2:	75 d7                	jne    801eab <fsring_rw+0x4d>
+  801ed4:	6a 0e                	push   $0xe
+  801ed6:	6a 0d                	push   $0xd
+  801ed8:	ff 35 08 50 80 00    	push   0x805008
+  801ede:	68 00 00 f0 cf       	push   $0xcff00000
+  801ee3:	e8 c4 0c 00 00       	call   802bac <ipcring_init>
+  801ee8:	83 c4 08             	add    $0x8,%esp
+  801eeb:	6a 00                	push   $0x0
+  801eed:	6a 00                	push   $0x0
+  801eef:	68 07 02 00 00       	push   $0x207
+  801ef4:	68 00 00 f0 cf       	push   $0xcff00000
+  801ef9:	6a 0b                	push   $0xb
+  801efb:	ff 35 08 50 80 00    	push   0x805008
+  801f01:	e8 26 f7 ff ff       	call   80162c <ipc_call>
+  801f06:	89 c6                	mov    %eax,%esi
+  801f08:	83 c4 20             	add    $0x20,%esp
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	0f 88 ac 00 00 00    	js     801fbf <fsring_rw+0x161>
+  801f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f18:	89 d9                	mov    %ebx,%ecx
+  801f1a:	83 c3 01             	add    $0x1,%ebx
+  801f1d:	89 da                	mov    %ebx,%edx
+  801f1f:	c1 e2 0c             	shl    $0xc,%edx
+  801f22:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801f28:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801f2e:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801f34:	83 ec 08             	sub    $0x8,%esp
+  801f37:	6a 00                	push   $0x0
+  801f39:	6a 00                	push   $0x0
+  801f3b:	68 07 02 00 00       	push   $0x207
+  801f40:	50                   	push   %eax
+  801f41:	6a 0c                	push   $0xc
+  801f43:	ff 35 08 50 80 00    	push   0x805008
+  801f49:	e8 de f6 ff ff       	call   80162c <ipc_call>
+  801f4e:	83 c4 20             	add    $0x20,%esp
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	78 6a                	js     801fbf <fsring_rw+0x161>
+  801f55:	83 fb 08             	cmp    $0x8,%ebx
+  801f58:	75 be                	jne    801f18 <fsring_rw+0xba>
+  801f5a:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f5e:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801f63:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801f68:	0f 45 c2             	cmovne %edx,%eax
+  801f6b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801f6e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801f75:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801f7c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f88:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8d:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801f90:	e9 4b 01 00 00       	jmp    8020e0 <fsring_rw+0x282>
+  801f95:	e8 36 f1 ff ff       	call   8010d0 <sys_time_msec>
+  801f9a:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801fa0:	0f 89 f3 fe ff ff    	jns    801e99 <fsring_rw+0x3b>
+  801fa6:	eb 54                	jmp    801ffc <fsring_rw+0x19e>
+  801fa8:	83 ec 0c             	sub    $0xc,%esp
+  801fab:	6a 02                	push   $0x2
+  801fad:	e8 15 f8 ff ff       	call   8017c7 <ipc_find_env>
+  801fb2:	a3 08 50 80 00       	mov    %eax,0x805008
+  801fb7:	83 c4 10             	add    $0x10,%esp
+  801fba:	e9 e7 fe ff ff       	jmp    801ea6 <fsring_rw+0x48>
+  801fbf:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801fc4:	83 ec 08             	sub    $0x8,%esp
+  801fc7:	53                   	push   %ebx
+  801fc8:	6a 00                	push   $0x0
+  801fca:	e8 09 ee ff ff       	call   800dd8 <sys_page_unmap>
+  801fcf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fd5:	83 c4 10             	add    $0x10,%esp
+  801fd8:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801fde:	75 e4                	jne    801fc4 <fsring_rw+0x166>
+  801fe0:	e8 eb f0 ff ff       	call   8010d0 <sys_time_msec>
+  801fe5:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801fea:	a3 00 50 80 00       	mov    %eax,0x805000
+  801fef:	a1 10 50 80 00       	mov    0x805010,%eax
+  801ff4:	8b 40 48             	mov    0x48(%eax),%eax
+  801ff7:	a3 04 50 80 00       	mov    %eax,0x805004
+  801ffc:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802003:	e9 7a 01 00 00       	jmp    802182 <fsring_rw+0x324>
+  802008:	8b 57 0c             	mov    0xc(%edi),%edx
+  80200b:	89 10                	mov    %edx,(%eax)
+  80200d:	89 58 04             	mov    %ebx,0x4(%eax)
+  802010:	89 f2                	mov    %esi,%edx
+  802012:	03 57 04             	add    0x4(%edi),%edx
+  802015:	89 50 08             	mov    %edx,0x8(%eax)
+  802018:	83 ec 04             	sub    $0x4,%esp
+  80201b:	53                   	push   %ebx
+  80201c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80201f:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802022:	52                   	push   %edx
+  802023:	83 c0 0c             	add    $0xc,%eax
+  802026:	50                   	push   %eax
+  802027:	e8 2a ea ff ff       	call   800a56 <memmove>
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802032:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802035:	89 08                	mov    %ecx,(%eax)
+  802037:	83 ec 0c             	sub    $0xc,%esp
+  80203a:	68 00 00 f0 cf       	push   $0xcff00000
+  80203f:	e8 c6 0b 00 00       	call   802c0a <ipcring_req_push>
+  802044:	01 de                	add    %ebx,%esi
+  802046:	83 c4 10             	add    $0x10,%esp
+  802049:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80204c:	73 4c                	jae    80209a <fsring_rw+0x23c>
+  80204e:	83 ec 0c             	sub    $0xc,%esp
+  802051:	68 00 00 f0 cf       	push   $0xcff00000
+  802056:	e8 89 0b 00 00       	call   802be4 <ipcring_req_slot>
+  80205b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80205e:	83 c4 10             	add    $0x10,%esp
+  802061:	85 c0                	test   %eax,%eax
+  802063:	74 35                	je     80209a <fsring_rw+0x23c>
+  802065:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80206a:	83 e0 07             	and    $0x7,%eax
+  80206d:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802072:	c1 e0 0c             	shl    $0xc,%eax
+  802075:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802078:	29 f3                	sub    %esi,%ebx
+  80207a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80207d:	39 cb                	cmp    %ecx,%ebx
+  80207f:	0f 47 d9             	cmova  %ecx,%ebx
+  802082:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802086:	75 80                	jne    802008 <fsring_rw+0x1aa>
+  802088:	8b 57 0c             	mov    0xc(%edi),%edx
+  80208b:	89 10                	mov    %edx,(%eax)
+  80208d:	89 58 04             	mov    %ebx,0x4(%eax)
+  802090:	89 f2                	mov    %esi,%edx
+  802092:	03 57 04             	add    0x4(%edi),%edx
+  802095:	89 50 08             	mov    %edx,0x8(%eax)
+  802098:	eb 95                	jmp    80202f <fsring_rw+0x1d1>
+  80209a:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80209f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020a2:	83 ec 0c             	sub    $0xc,%esp
+  8020a5:	68 00 00 f0 cf       	push   $0xcff00000
+  8020aa:	e8 94 0b 00 00       	call   802c43 <ipcring_rsp_wait>
+  8020af:	8b 58 04             	mov    0x4(%eax),%ebx
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8020b9:	75 45                	jne    802100 <fsring_rw+0x2a2>
+  8020bb:	85 db                	test   %ebx,%ebx
+  8020bd:	79 41                	jns    802100 <fsring_rw+0x2a2>
+  8020bf:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8020c2:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8020c9:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8020d0:	83 ec 0c             	sub    $0xc,%esp
+  8020d3:	68 00 00 f0 cf       	push   $0xcff00000
+  8020d8:	e8 cc 0b 00 00       	call   802ca9 <ipcring_rsp_pop>
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8020e6:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8020eb:	39 c2                	cmp    %eax,%edx
+  8020ed:	74 75                	je     802164 <fsring_rw+0x306>
+  8020ef:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8020f3:	75 a5                	jne    80209a <fsring_rw+0x23c>
+  8020f5:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8020f8:	0f 82 50 ff ff ff    	jb     80204e <fsring_rw+0x1f0>
+  8020fe:	eb 9a                	jmp    80209a <fsring_rw+0x23c>
+  802100:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802104:	75 ca                	jne    8020d0 <fsring_rw+0x272>
+  802106:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80210a:	74 31                	je     80213d <fsring_rw+0x2df>
+  80210c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802112:	29 c8                	sub    %ecx,%eax
+  802114:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802117:	39 d0                	cmp    %edx,%eax
+  802119:	0f 47 c2             	cmova  %edx,%eax
+  80211c:	39 d8                	cmp    %ebx,%eax
+  80211e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802123:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802127:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80212a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80212f:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802133:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802136:	01 d9                	add    %ebx,%ecx
+  802138:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80213b:	eb 93                	jmp    8020d0 <fsring_rw+0x272>
+  80213d:	83 ec 04             	sub    $0x4,%esp
+  802140:	53                   	push   %ebx
+  802141:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802144:	83 e0 07             	and    $0x7,%eax
+  802147:	c1 e0 0c             	shl    $0xc,%eax
+  80214a:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802150:	50                   	push   %eax
+  802151:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802154:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802157:	01 c8                	add    %ecx,%eax
+  802159:	50                   	push   %eax
+  80215a:	e8 f7 e8 ff ff       	call   800a56 <memmove>
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	eb a8                	jmp    80210c <fsring_rw+0x2ae>
+  802164:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802168:	75 09                	jne    802173 <fsring_rw+0x315>
+  80216a:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80216d:	0f 82 db fe ff ff    	jb     80204e <fsring_rw+0x1f0>
+  802173:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802176:	01 57 04             	add    %edx,0x4(%edi)
+  802179:	85 d2                	test   %edx,%edx
+  80217b:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80217f:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802182:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802188:	5b                   	pop    %ebx
+  802189:	5e                   	pop    %esi
+  80218a:	5f                   	pop    %edi
+  80218b:	5d                   	pop    %ebp
+  80218c:	c3                   	ret
+
+0080218d <devfile_write>:
+  80218d:	55                   	push   %ebp
+  80218e:	89 e5                	mov    %esp,%ebp
+  802190:	57                   	push   %edi
+  802191:	56                   	push   %esi
+  802192:	53                   	push   %ebx
+  802193:	83 ec 0c             	sub    $0xc,%esp
+  802196:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802199:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80219c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80219f:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8021a5:	76 1a                	jbe    8021c1 <devfile_write+0x34>
+  8021a7:	83 ec 0c             	sub    $0xc,%esp
+  8021aa:	53                   	push   %ebx
+  8021ab:	89 f1                	mov    %esi,%ecx
+  8021ad:	ba 06 00 00 00       	mov    $0x6,%edx
+  8021b2:	89 f8                	mov    %edi,%eax
+  8021b4:	e8 a5 fc ff ff       	call   801e5e <fsring_rw>
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8021bf:	75 39                	jne    8021fa <devfile_write+0x6d>
+  8021c1:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8021c6:	39 c3                	cmp    %eax,%ebx
+  8021c8:	0f 47 d8             	cmova  %eax,%ebx
+  8021cb:	8b 47 0c             	mov    0xc(%edi),%eax
+  8021ce:	a3 00 60 80 00       	mov    %eax,0x806000
+  8021d3:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8021d9:	83 ec 04             	sub    $0x4,%esp
+  8021dc:	53                   	push   %ebx
+  8021dd:	56                   	push   %esi
+  8021de:	68 08 60 80 00       	push   $0x806008
+  8021e3:	e8 6e e8 ff ff       	call   800a56 <memmove>
+  8021e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ed:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021f2:	e8 7c fb ff ff       	call   801d73 <fsipc>
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5f                   	pop    %edi
+  802200:	5d                   	pop    %ebp
+  802201:	c3                   	ret
+
+00802202 <devfile_read>:
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	57                   	push   %edi
+  802206:	56                   	push   %esi
+  802207:	53                   	push   %ebx
+  802208:	83 ec 0c             	sub    $0xc,%esp
+  80220b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80220e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802211:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802217:	76 1d                	jbe    802236 <devfile_read+0x34>
+  802219:	83 ec 0c             	sub    $0xc,%esp
+  80221c:	56                   	push   %esi
+  80221d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802220:	ba 05 00 00 00       	mov    $0x5,%edx
+  802225:	89 f8                	mov    %edi,%eax
+  802227:	e8 32 fc ff ff       	call   801e5e <fsring_rw>
+  80222c:	89 c3                	mov    %eax,%ebx
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802234:	75 37                	jne    80226d <devfile_read+0x6b>
+  802236:	8b 47 0c             	mov    0xc(%edi),%eax
+  802239:	a3 00 60 80 00       	mov    %eax,0x806000
+  80223e:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802244:	ba 00 00 00 00       	mov    $0x0,%edx
+  802249:	b8 03 00 00 00       	mov    $0x3,%eax
+  80224e:	e8 20 fb ff ff       	call   801d73 <fsipc>
+  802253:	89 c3                	mov    %eax,%ebx
+  802255:	85 c0                	test   %eax,%eax
+  802257:	78 14                	js     80226d <devfile_read+0x6b>
+  802259:	83 ec 04             	sub    $0x4,%esp
+  80225c:	50                   	push   %eax
+  80225d:	68 00 60 80 00       	push   $0x806000
+  802262:	ff 75 0c             	push   0xc(%ebp)
+  802265:	e8 ec e7 ff ff       	call   800a56 <memmove>
+  80226a:	83 c4 10             	add    $0x10,%esp
+  80226d:	89 d8                	mov    %ebx,%eax
+  80226f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802272:	5b                   	pop    %ebx
+  802273:	5e                   	pop    %esi
+  802274:	5f                   	pop    %edi
+  802275:	5d                   	pop    %ebp
+  802276:	c3                   	ret
+
+00802277 <open>:
+  802277:	55                   	push   %ebp
+  802278:	89 e5                	mov    %esp,%ebp
+  80227a:	56                   	push   %esi
+  80227b:	53                   	push   %ebx
+  80227c:	83 ec 1c             	sub    $0x1c,%esp
+  80227f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802282:	56                   	push   %esi
+  802283:	e8 d2 e5 ff ff       	call   80085a <strlen>
+  802288:	83 c4 10             	add    $0x10,%esp
+  80228b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802290:	7f 6c                	jg     8022fe <open+0x87>
+  802292:	83 ec 0c             	sub    $0xc,%esp
+  802295:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802298:	50                   	push   %eax
+  802299:	e8 6a f5 ff ff       	call   801808 <fd_alloc>
+  80229e:	89 c3                	mov    %eax,%ebx
+  8022a0:	83 c4 10             	add    $0x10,%esp
+  8022a3:	85 c0                	test   %eax,%eax
+  8022a5:	78 3c                	js     8022e3 <open+0x6c>
+  8022a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022aa:	a3 00 64 80 00       	mov    %eax,0x806400
+  8022af:	83 ec 08             	sub    $0x8,%esp
+  8022b2:	56                   	push   %esi
+  8022b3:	68 00 60 80 00       	push   $0x806000
+  8022b8:	e8 e9 e5 ff ff       	call   8008a6 <strcpy>
+  8022bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c5:	e8 a9 fa ff ff       	call   801d73 <fsipc>
+  8022ca:	89 c3                	mov    %eax,%ebx
+  8022cc:	83 c4 10             	add    $0x10,%esp
+  8022cf:	85 c0                	test   %eax,%eax
+  8022d1:	78 19                	js     8022ec <open+0x75>
+  8022d3:	83 ec 0c             	sub    $0xc,%esp
+  8022d6:	ff 75 f4             	push   -0xc(%ebp)
+  8022d9:	e8 03 f5 ff ff       	call   8017e1 <fd2num>
+  8022de:	89 c3                	mov    %eax,%ebx
+  8022e0:	83 c4 10             	add    $0x10,%esp
+  8022e3:	89 d8                	mov    %ebx,%eax
+  8022e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e8:	5b                   	pop    %ebx
+  8022e9:	5e                   	pop    %esi
+  8022ea:	5d                   	pop    %ebp
+  8022eb:	c3                   	ret
+  8022ec:	83 ec 08             	sub    $0x8,%esp
+  8022ef:	6a 00                	push   $0x0
+  8022f1:	ff 75 f4             	push   -0xc(%ebp)
+  8022f4:	e8 05 f6 ff ff       	call   8018fe <fd_close>
+  8022f9:	83 c4 10             	add    $0x10,%esp
+  8022fc:	eb e5                	jmp    8022e3 <open+0x6c>
+  8022fe:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802303:	eb de                	jmp    8022e3 <open+0x6c>
+
+00802305 <file_image>:
+  802305:	55                   	push   %ebp
+  802306:	89 e5                	mov    %esp,%ebp
+  802308:	53                   	push   %ebx
+  802309:	83 ec 1c             	sub    $0x1c,%esp
+  80230c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80230f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802312:	50                   	push   %eax
+  802313:	ff 75 08             	push   0x8(%ebp)
+  802316:	e8 3d f5 ff ff       	call   801858 <fd_lookup>
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	78 58                	js     80237a <file_image+0x75>
+  802322:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802325:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80232b:	39 08                	cmp    %ecx,(%eax)
+  80232d:	75 50                	jne    80237f <file_image+0x7a>
+  80232f:	83 fb 04             	cmp    $0x4,%ebx
+  802332:	77 52                	ja     802386 <file_image+0x81>
+  802334:	8b 40 0c             	mov    0xc(%eax),%eax
+  802337:	a3 00 60 80 00       	mov    %eax,0x806000
+  80233c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802342:	83 ec 04             	sub    $0x4,%esp
+  802345:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802348:	c1 e0 02             	shl    $0x2,%eax
+  80234b:	50                   	push   %eax
+  80234c:	ff 75 0c             	push   0xc(%ebp)
+  80234f:	68 08 60 80 00       	push   $0x806008
+  802354:	e8 fd e6 ff ff       	call   800a56 <memmove>
+  802359:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802363:	e8 0b fa ff ff       	call   801d73 <fsipc>
+  802368:	83 c4 10             	add    $0x10,%esp
+  80236b:	85 c0                	test   %eax,%eax
+  80236d:	78 0b                	js     80237a <file_image+0x75>
+  80236f:	8b 55 14             	mov    0x14(%ebp),%edx
+  802372:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802378:	89 0a                	mov    %ecx,(%edx)
+  80237a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80237d:	c9                   	leave
+  80237e:	c3                   	ret
+  80237f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802384:	eb f4                	jmp    80237a <file_image+0x75>
+  802386:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238b:	eb ed                	jmp    80237a <file_image+0x75>
+
+0080238d <remove>:
+  80238d:	55                   	push   %ebp
+  80238e:	89 e5                	mov    %esp,%ebp
+  802390:	53                   	push   %ebx
+  802391:	83 ec 10             	sub    $0x10,%esp
+  802394:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802397:	53                   	push   %ebx
+  802398:	e8 bd e4 ff ff       	call   80085a <strlen>
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023a5:	7f 25                	jg     8023cc <remove+0x3f>
+  8023a7:	83 ec 08             	sub    $0x8,%esp
+  8023aa:	53                   	push   %ebx
+  8023ab:	68 00 60 80 00       	push   $0x806000
+  8023b0:	e8 f1 e4 ff ff       	call   8008a6 <strcpy>
+  8023b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ba:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023bf:	e8 af f9 ff ff       	call   801d73 <fsipc>
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ca:	c9                   	leave
+  8023cb:	c3                   	ret
+  8023cc:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8023d1:	eb f4                	jmp    8023c7 <remove+0x3a>
+
+008023d3 <sync>:
+  8023d3:	55                   	push   %ebp
+  8023d4:	89 e5                	mov    %esp,%ebp
+  8023d6:	83 ec 08             	sub    $0x8,%esp
+  8023d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023e3:	e8 8b f9 ff ff       	call   801d73 <fsipc>
+  8023e8:	c9                   	leave
+  8023e9:	c3                   	ret
+
+008023ea <devsock_stat>:
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	83 ec 10             	sub    $0x10,%esp
+  8023f0:	68 34 36 80 00       	push   $0x803634
+  8023f5:	ff 75 0c             	push   0xc(%ebp)
+  8023f8:	e8 a9 e4 ff ff       	call   8008a6 <strcpy>
+  8023fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802402:	c9                   	leave
+  802403:	c3                   	ret
+
+00802404 <devsock_close>:
+  802404:	55                   	push   %ebp
+  802405:	89 e5                	mov    %esp,%ebp
+  802407:	53                   	push   %ebx
+  802408:	83 ec 10             	sub    $0x10,%esp
+  80240b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80240e:	53                   	push   %ebx
+  80240f:	e8 72 0b 00 00       	call   802f86 <pageref>
+  802414:	89 c2                	mov    %eax,%edx
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241e:	83 fa 01             	cmp    $0x1,%edx
+  802421:	74 05                	je     802428 <devsock_close+0x24>
+  802423:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802426:	c9                   	leave
+  802427:	c3                   	ret
+  802428:	83 ec 0c             	sub    $0xc,%esp
+  80242b:	ff 73 0c             	push   0xc(%ebx)
+  80242e:	e8 aa 02 00 00       	call   8026dd <nsipc_close>
+  802433:	83 c4 10             	add    $0x10,%esp
+  802436:	eb eb                	jmp    802423 <devsock_close+0x1f>
+
+00802438 <devsock_write>:
+  802438:	55                   	push   %ebp
+  802439:	89 e5                	mov    %esp,%ebp
+  80243b:	83 ec 08             	sub    $0x8,%esp
+  80243e:	6a 00                	push   $0x0
+  802440:	ff 75 10             	push   0x10(%ebp)
+  802443:	ff 75 0c             	push   0xc(%ebp)
+  802446:	8b 45 08             	mov    0x8(%ebp),%eax
+  802449:	ff 70 0c             	push   0xc(%eax)
+  80244c:	e8 6c 03 00 00       	call   8027bd <nsipc_send>
+  802451:	c9                   	leave
+  802452:	c3                   	ret
+
+00802453 <devsock_read>:
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	83 ec 08             	sub    $0x8,%esp
+  802459:	6a 00                	push   $0x0
+  80245b:	ff 75 10             	push   0x10(%ebp)
+  80245e:	ff 75 0c             	push   0xc(%ebp)
+  802461:	8b 45 08             	mov    0x8(%ebp),%eax
+  802464:	ff 70 0c             	push   0xc(%eax)
+  802467:	e8 e2 02 00 00       	call   80274e <nsipc_recv>
+  80246c:	c9                   	leave
+  80246d:	c3                   	ret
+
+0080246e <fd2sockid>:
+  80246e:	55                   	push   %ebp
+  80246f:	89 e5                	mov    %esp,%ebp
+  802471:	83 ec 20             	sub    $0x20,%esp
+  802474:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802477:	52                   	push   %edx
+  802478:	50                   	push   %eax
+  802479:	e8 da f3 ff ff       	call   801858 <fd_lookup>
+  80247e:	83 c4 10             	add    $0x10,%esp
+  802481:	85 c0                	test   %eax,%eax
+  802483:	78 10                	js     802495 <fd2sockid+0x27>
+  802485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802488:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80248e:	39 08                	cmp    %ecx,(%eax)
+  802490:	75 05                	jne    802497 <fd2sockid+0x29>
+  802492:	8b 40 0c             	mov    0xc(%eax),%eax
+  802495:	c9                   	leave
+  802496:	c3                   	ret
+  802497:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80249c:	eb f7                	jmp    802495 <fd2sockid+0x27>
+
+0080249e <alloc_sockfd>:
+  80249e:	55                   	push   %ebp
+  80249f:	89 e5                	mov    %esp,%ebp
+  8024a1:	56                   	push   %esi
+  8024a2:	53                   	push   %ebx
+  8024a3:	83 ec 1c             	sub    $0x1c,%esp
+  8024a6:	89 c6                	mov    %eax,%esi
+  8024a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ab:	50                   	push   %eax
+  8024ac:	e8 57 f3 ff ff       	call   801808 <fd_alloc>
+  8024b1:	89 c3                	mov    %eax,%ebx
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	85 c0                	test   %eax,%eax
+  8024b8:	78 43                	js     8024fd <alloc_sockfd+0x5f>
+  8024ba:	83 ec 04             	sub    $0x4,%esp
+  8024bd:	68 07 04 00 00       	push   $0x407
+  8024c2:	ff 75 f4             	push   -0xc(%ebp)
+  8024c5:	6a 00                	push   $0x0
+  8024c7:	e8 3a e8 ff ff       	call   800d06 <sys_page_alloc>
+  8024cc:	89 c3                	mov    %eax,%ebx
+  8024ce:	83 c4 10             	add    $0x10,%esp
+  8024d1:	85 c0                	test   %eax,%eax
+  8024d3:	78 28                	js     8024fd <alloc_sockfd+0x5f>
+  8024d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8024de:	89 10                	mov    %edx,(%eax)
+  8024e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8024ea:	89 70 0c             	mov    %esi,0xc(%eax)
+  8024ed:	83 ec 0c             	sub    $0xc,%esp
+  8024f0:	50                   	push   %eax
+  8024f1:	e8 eb f2 ff ff       	call   8017e1 <fd2num>
+  8024f6:	89 c3                	mov    %eax,%ebx
+  8024f8:	83 c4 10             	add    $0x10,%esp
+  8024fb:	eb 0c                	jmp    802509 <alloc_sockfd+0x6b>
+  8024fd:	83 ec 0c             	sub    $0xc,%esp
+  802500:	56                   	push   %esi
+  802501:	e8 d7 01 00 00       	call   8026dd <nsipc_close>
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	89 d8                	mov    %ebx,%eax
+  80250b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80250e:	5b                   	pop    %ebx
+  80250f:	5e                   	pop    %esi
+  802510:	5d                   	pop    %ebp
+  802511:	c3                   	ret
+
+00802512 <accept>:
+  802512:	55                   	push   %ebp
+  802513:	89 e5                	mov    %esp,%ebp
+  802515:	83 ec 08             	sub    $0x8,%esp
+  802518:	8b 45 08             	mov    0x8(%ebp),%eax
+  80251b:	e8 4e ff ff ff       	call   80246e <fd2sockid>
+  802520:	85 c0                	test   %eax,%eax
+  802522:	78 1b                	js     80253f <accept+0x2d>
+  802524:	83 ec 04             	sub    $0x4,%esp
+  802527:	ff 75 10             	push   0x10(%ebp)
+  80252a:	ff 75 0c             	push   0xc(%ebp)
+  80252d:	50                   	push   %eax
+  80252e:	e8 07 01 00 00       	call   80263a <nsipc_accept>
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	85 c0                	test   %eax,%eax
+  802538:	78 05                	js     80253f <accept+0x2d>
+  80253a:	e8 5f ff ff ff       	call   80249e <alloc_sockfd>
+  80253f:	c9                   	leave
+  802540:	c3                   	ret
+
+00802541 <bind>:
+  802541:	55                   	push   %ebp
+  802542:	89 e5                	mov    %esp,%ebp
+  802544:	83 ec 08             	sub    $0x8,%esp
+  802547:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254a:	e8 1f ff ff ff       	call   80246e <fd2sockid>
+  80254f:	85 c0                	test   %eax,%eax
+  802551:	78 12                	js     802565 <bind+0x24>
+  802553:	83 ec 04             	sub    $0x4,%esp
+  802556:	ff 75 10             	push   0x10(%ebp)
+  802559:	ff 75 0c             	push   0xc(%ebp)
+  80255c:	50                   	push   %eax
+  80255d:	e8 24 01 00 00       	call   802686 <nsipc_bind>
+  802562:	83 c4 10             	add    $0x10,%esp
+  802565:	c9                   	leave
+  802566:	c3                   	ret
+
+00802567 <shutdown>:
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	83 ec 08             	sub    $0x8,%esp
+  80256d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802570:	e8 f9 fe ff ff       	call   80246e <fd2sockid>
+  802575:	85 c0                	test   %eax,%eax
+  802577:	78 0f                	js     802588 <shutdown+0x21>
+  802579:	83 ec 08             	sub    $0x8,%esp
+  80257c:	ff 75 0c             	push   0xc(%ebp)
+  80257f:	50                   	push   %eax
+  802580:	e8 36 01 00 00       	call   8026bb <nsipc_shutdown>
+  802585:	83 c4 10             	add    $0x10,%esp
+  802588:	c9                   	leave
+  802589:	c3                   	ret
+
+0080258a <connect>:
+  80258a:	55                   	push   %ebp
+  80258b:	89 e5                	mov    %esp,%ebp
+  80258d:	83 ec 08             	sub    $0x8,%esp
+  802590:	8b 45 08             	mov    0x8(%ebp),%eax
+  802593:	e8 d6 fe ff ff       	call   80246e <fd2sockid>
+  802598:	85 c0                	test   %eax,%eax
+  80259a:	78 12                	js     8025ae <connect+0x24>
+  80259c:	83 ec 04             	sub    $0x4,%esp
+  80259f:	ff 75 10             	push   0x10(%ebp)
+  8025a2:	ff 75 0c             	push   0xc(%ebp)
+  8025a5:	50                   	push   %eax
+  8025a6:	e8 4c 01 00 00       	call   8026f7 <nsipc_connect>
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	c9                   	leave
+  8025af:	c3                   	ret
+
+008025b0 <listen>:
+  8025b0:	55                   	push   %ebp
+  8025b1:	89 e5                	mov    %esp,%ebp
+  8025b3:	83 ec 08             	sub    $0x8,%esp
+  8025b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b9:	e8 b0 fe ff ff       	call   80246e <fd2sockid>
+  8025be:	85 c0                	test   %eax,%eax
+  8025c0:	78 0f                	js     8025d1 <listen+0x21>
+  8025c2:	83 ec 08             	sub    $0x8,%esp
+  8025c5:	ff 75 0c             	push   0xc(%ebp)
+  8025c8:	50                   	push   %eax
+  8025c9:	e8 5e 01 00 00       	call   80272c <nsipc_listen>
+  8025ce:	83 c4 10             	add    $0x10,%esp
+  8025d1:	c9                   	leave
+  8025d2:	c3                   	ret
+
+008025d3 <socket>:
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	83 ec 0c             	sub    $0xc,%esp
+  8025d9:	ff 75 10             	push   0x10(%ebp)
+  8025dc:	ff 75 0c             	push   0xc(%ebp)
+  8025df:	ff 75 08             	push   0x8(%ebp)
+  8025e2:	e8 34 02 00 00       	call   80281b <nsipc_socket>
+  8025e7:	83 c4 10             	add    $0x10,%esp
+  8025ea:	85 c0                	test   %eax,%eax
+  8025ec:	78 05                	js     8025f3 <socket+0x20>
+  8025ee:	e8 ab fe ff ff       	call   80249e <alloc_sockfd>
+  8025f3:	c9                   	leave
+  8025f4:	c3                   	ret
+
+008025f5 <nsipc>:
+  8025f5:	55                   	push   %ebp
+  8025f6:	89 e5                	mov    %esp,%ebp
+  8025f8:	53                   	push   %ebx
+  8025f9:	83 ec 04             	sub    $0x4,%esp
+  8025fc:	89 c3                	mov    %eax,%ebx
+  8025fe:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802605:	74 1f                	je     802626 <nsipc+0x31>
+  802607:	83 ec 08             	sub    $0x8,%esp
+  80260a:	6a 00                	push   $0x0
+  80260c:	6a 00                	push   $0x0
+  80260e:	6a 07                	push   $0x7
+  802610:	68 00 70 80 00       	push   $0x807000
+  802615:	53                   	push   %ebx
+  802616:	ff 35 0c 50 80 00    	push   0x80500c
+  80261c:	e8 0b f0 ff ff       	call   80162c <ipc_call>
+  802621:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802624:	c9                   	leave
+  802625:	c3                   	ret
+  802626:	83 ec 0c             	sub    $0xc,%esp
+  802629:	6a 03                	push   $0x3
+  80262b:	e8 97 f1 ff ff       	call   8017c7 <ipc_find_env>
+  802630:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802635:	83 c4 10             	add    $0x10,%esp
+  802638:	eb cd                	jmp    802607 <nsipc+0x12>
+
+0080263a <nsipc_accept>:
+  80263a:	55                   	push   %ebp
+  80263b:	89 e5                	mov    %esp,%ebp
+  80263d:	53                   	push   %ebx
+  80263e:	83 ec 04             	sub    $0x4,%esp
+  802641:	8b 45 08             	mov    0x8(%ebp),%eax
+  802644:	a3 00 70 80 00       	mov    %eax,0x807000
+  802649:	b8 01 00 00 00       	mov    $0x1,%eax
+  80264e:	e8 a2 ff ff ff       	call   8025f5 <nsipc>
+  802653:	89 c3                	mov    %eax,%ebx
+  802655:	85 c0                	test   %eax,%eax
+  802657:	79 07                	jns    802660 <nsipc_accept+0x26>
+  802659:	89 d8                	mov    %ebx,%eax
+  80265b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265e:	c9                   	leave
+  80265f:	c3                   	ret
+  802660:	83 ec 04             	sub    $0x4,%esp
+  802663:	ff 35 10 70 80 00    	push   0x807010
+  802669:	68 00 70 80 00       	push   $0x807000
+  80266e:	ff 75 0c             	push   0xc(%ebp)
+  802671:	e8 e0 e3 ff ff       	call   800a56 <memmove>
+  802676:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80267c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80267f:	89 10                	mov    %edx,(%eax)
+  802681:	83 c4 10             	add    $0x10,%esp
+  802684:	eb d3                	jmp    802659 <nsipc_accept+0x1f>
+
+00802686 <nsipc_bind>:
+  802686:	55                   	push   %ebp
+  802687:	89 e5                	mov    %esp,%ebp
+  802689:	53                   	push   %ebx
+  80268a:	83 ec 08             	sub    $0x8,%esp
+  80268d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802690:	8b 45 08             	mov    0x8(%ebp),%eax
+  802693:	a3 00 70 80 00       	mov    %eax,0x807000
+  802698:	53                   	push   %ebx
+  802699:	ff 75 0c             	push   0xc(%ebp)
+  80269c:	68 04 70 80 00       	push   $0x807004
+  8026a1:	e8 b0 e3 ff ff       	call   800a56 <memmove>
+  8026a6:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8026ac:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026b1:	e8 3f ff ff ff       	call   8025f5 <nsipc>
+  8026b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b9:	c9                   	leave
+  8026ba:	c3                   	ret
+
+008026bb <nsipc_shutdown>:
+  8026bb:	55                   	push   %ebp
+  8026bc:	89 e5                	mov    %esp,%ebp
+  8026be:	83 ec 08             	sub    $0x8,%esp
+  8026c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c4:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026cc:	a3 04 70 80 00       	mov    %eax,0x807004
+  8026d1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026d6:	e8 1a ff ff ff       	call   8025f5 <nsipc>
+  8026db:	c9                   	leave
+  8026dc:	c3                   	ret
+
+008026dd <nsipc_close>:
+  8026dd:	55                   	push   %ebp
+  8026de:	89 e5                	mov    %esp,%ebp
+  8026e0:	83 ec 08             	sub    $0x8,%esp
+  8026e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026eb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026f0:	e8 00 ff ff ff       	call   8025f5 <nsipc>
+  8026f5:	c9                   	leave
+  8026f6:	c3                   	ret
+
+008026f7 <nsipc_connect>:
+  8026f7:	55                   	push   %ebp
+  8026f8:	89 e5                	mov    %esp,%ebp
+  8026fa:	53                   	push   %ebx
+  8026fb:	83 ec 08             	sub    $0x8,%esp
+  8026fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802701:	8b 45 08             	mov    0x8(%ebp),%eax
+  802704:	a3 00 70 80 00       	mov    %eax,0x807000
+  802709:	53                   	push   %ebx
+  80270a:	ff 75 0c             	push   0xc(%ebp)
+  80270d:	68 04 70 80 00       	push   $0x807004
+  802712:	e8 3f e3 ff ff       	call   800a56 <memmove>
+  802717:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80271d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802722:	e8 ce fe ff ff       	call   8025f5 <nsipc>
+  802727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272a:	c9                   	leave
+  80272b:	c3                   	ret
+
+0080272c <nsipc_listen>:
+  80272c:	55                   	push   %ebp
+  80272d:	89 e5                	mov    %esp,%ebp
+  80272f:	83 ec 08             	sub    $0x8,%esp
+  802732:	8b 45 08             	mov    0x8(%ebp),%eax
+  802735:	a3 00 70 80 00       	mov    %eax,0x807000
+  80273a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80273d:	a3 04 70 80 00       	mov    %eax,0x807004
+  802742:	b8 06 00 00 00       	mov    $0x6,%eax
+  802747:	e8 a9 fe ff ff       	call   8025f5 <nsipc>
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+0080274e <nsipc_recv>:
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	56                   	push   %esi
+  802752:	53                   	push   %ebx
+  802753:	8b 75 10             	mov    0x10(%ebp),%esi
+  802756:	8b 45 08             	mov    0x8(%ebp),%eax
+  802759:	a3 00 70 80 00       	mov    %eax,0x807000
+  80275e:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802764:	8b 45 14             	mov    0x14(%ebp),%eax
+  802767:	a3 08 70 80 00       	mov    %eax,0x807008
+  80276c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802771:	e8 7f fe ff ff       	call   8025f5 <nsipc>
+  802776:	89 c3                	mov    %eax,%ebx
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	78 22                	js     80279e <nsipc_recv+0x50>
+  80277c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802781:	39 c6                	cmp    %eax,%esi
+  802783:	0f 4e c6             	cmovle %esi,%eax
+  802786:	39 c3                	cmp    %eax,%ebx
+  802788:	7f 1d                	jg     8027a7 <nsipc_recv+0x59>
+  80278a:	83 ec 04             	sub    $0x4,%esp
+  80278d:	53                   	push   %ebx
+  80278e:	68 00 70 80 00       	push   $0x807000
+  802793:	ff 75 0c             	push   0xc(%ebp)
+  802796:	e8 bb e2 ff ff       	call   800a56 <memmove>
+  80279b:	83 c4 10             	add    $0x10,%esp
+  80279e:	89 d8                	mov    %ebx,%eax
+  8027a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a3:	5b                   	pop    %ebx
+  8027a4:	5e                   	pop    %esi
+  8027a5:	5d                   	pop    %ebp
+  8027a6:	c3                   	ret
+  8027a7:	68 40 36 80 00       	push   $0x803640
+  8027ac:	68 55 36 80 00       	push   $0x803655
+  8027b1:	6a 60                	push   $0x60
+  8027b3:	68 6a 36 80 00       	push   $0x80366a
+  8027b8:	e8 83 07 00 00       	call   802f40 <_panic>
+
+008027bd <nsipc_send>:
+  8027bd:	55                   	push   %ebp
+  8027be:	89 e5                	mov    %esp,%ebp
+  8027c0:	53                   	push   %ebx
+  8027c1:	83 ec 04             	sub    $0x4,%esp
+  8027c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ca:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027cf:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8027d5:	7f 2e                	jg     802805 <nsipc_send+0x48>
+  8027d7:	83 ec 04             	sub    $0x4,%esp
+  8027da:	53                   	push   %ebx
+  8027db:	ff 75 0c             	push   0xc(%ebp)
+  8027de:	68 0c 70 80 00       	push   $0x80700c
+  8027e3:	e8 6e e2 ff ff       	call   800a56 <memmove>
+  8027e8:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8027ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027f1:	a3 08 70 80 00       	mov    %eax,0x807008
+  8027f6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027fb:	e8 f5 fd ff ff       	call   8025f5 <nsipc>
+  802800:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802803:	c9                   	leave
+  802804:	c3                   	ret
+  802805:	68 76 36 80 00       	push   $0x803676
+  80280a:	68 55 36 80 00       	push   $0x803655
+  80280f:	6a 6b                	push   $0x6b
+  802811:	68 6a 36 80 00       	push   $0x80366a
+  802816:	e8 25 07 00 00       	call   802f40 <_panic>
+
+0080281b <nsipc_socket>:
+  80281b:	55                   	push   %ebp
+  80281c:	89 e5                	mov    %esp,%ebp
+  80281e:	83 ec 08             	sub    $0x8,%esp
+  802821:	8b 45 08             	mov    0x8(%ebp),%eax
+  802824:	a3 00 70 80 00       	mov    %eax,0x807000
+  802829:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80282c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802831:	8b 45 10             	mov    0x10(%ebp),%eax
+  802834:	a3 08 70 80 00       	mov    %eax,0x807008
+  802839:	b8 09 00 00 00       	mov    $0x9,%eax
+  80283e:	e8 b2 fd ff ff       	call   8025f5 <nsipc>
+  802843:	c9                   	leave
+  802844:	c3                   	ret
+
+00802845 <devpipe_stat>:
+  802845:	55                   	push   %ebp
+  802846:	89 e5                	mov    %esp,%ebp
+  802848:	56                   	push   %esi
+  802849:	53                   	push   %ebx
+  80284a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80284d:	83 ec 0c             	sub    $0xc,%esp
+  802850:	ff 75 08             	push   0x8(%ebp)
+  802853:	e8 99 ef ff ff       	call   8017f1 <fd2data>
+  802858:	89 c6                	mov    %eax,%esi
+  80285a:	83 c4 08             	add    $0x8,%esp
+  80285d:	68 82 36 80 00       	push   $0x803682
+  802862:	53                   	push   %ebx
+  802863:	e8 3e e0 ff ff       	call   8008a6 <strcpy>
+  802868:	8b 46 04             	mov    0x4(%esi),%eax
+  80286b:	2b 06                	sub    (%esi),%eax
+  80286d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802873:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80287a:	00 00 00 
+  80287d:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802884:	40 80 00 
+  802887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80288f:	5b                   	pop    %ebx
+  802890:	5e                   	pop    %esi
+  802891:	5d                   	pop    %ebp
+  802892:	c3                   	ret
+
+00802893 <devpipe_close>:
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	53                   	push   %ebx
+  802897:	83 ec 0c             	sub    $0xc,%esp
+  80289a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80289d:	53                   	push   %ebx
+  80289e:	6a 00                	push   $0x0
+  8028a0:	e8 33 e5 ff ff       	call   800dd8 <sys_page_unmap>
+  8028a5:	89 1c 24             	mov    %ebx,(%esp)
+  8028a8:	e8 44 ef ff ff       	call   8017f1 <fd2data>
+  8028ad:	83 c4 08             	add    $0x8,%esp
+  8028b0:	50                   	push   %eax
+  8028b1:	6a 00                	push   $0x0
+  8028b3:	e8 20 e5 ff ff       	call   800dd8 <sys_page_unmap>
+  8028b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028bb:	c9                   	leave
+  8028bc:	c3                   	ret
+
+008028bd <_pipeisclosed>:
+  8028bd:	55                   	push   %ebp
+  8028be:	89 e5                	mov    %esp,%ebp
+  8028c0:	57                   	push   %edi
+  8028c1:	56                   	push   %esi
+  8028c2:	53                   	push   %ebx
+  8028c3:	83 ec 1c             	sub    $0x1c,%esp
+  8028c6:	89 c7                	mov    %eax,%edi
+  8028c8:	89 d6                	mov    %edx,%esi
+  8028ca:	a1 10 50 80 00       	mov    0x805010,%eax
+  8028cf:	8b 58 58             	mov    0x58(%eax),%ebx
+  8028d2:	83 ec 0c             	sub    $0xc,%esp
+  8028d5:	57                   	push   %edi
+  8028d6:	e8 ab 06 00 00       	call   802f86 <pageref>
+  8028db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028de:	89 34 24             	mov    %esi,(%esp)
+  8028e1:	e8 a0 06 00 00       	call   802f86 <pageref>
+  8028e6:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  8028ec:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8028ef:	83 c4 10             	add    $0x10,%esp
+  8028f2:	39 cb                	cmp    %ecx,%ebx
+  8028f4:	74 1b                	je     802911 <_pipeisclosed+0x54>
+  8028f6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8028f9:	75 cf                	jne    8028ca <_pipeisclosed+0xd>
+  8028fb:	8b 42 58             	mov    0x58(%edx),%eax
+  8028fe:	6a 01                	push   $0x1
+  802900:	50                   	push   %eax
+  802901:	53                   	push   %ebx
+  802902:	68 89 36 80 00       	push   $0x803689
+  802907:	e8 a3 d8 ff ff       	call   8001af <cprintf>
+  80290c:	83 c4 10             	add    $0x10,%esp
+  80290f:	eb b9                	jmp    8028ca <_pipeisclosed+0xd>
+  802911:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802914:	0f 94 c0             	sete   %al
+  802917:	0f b6 c0             	movzbl %al,%eax
+  80291a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80291d:	5b                   	pop    %ebx
+  80291e:	5e                   	pop    %esi
+  80291f:	5f                   	pop    %edi
+  802920:	5d                   	pop    %ebp
+  802921:	c3                   	ret
+
+00802922 <devpipe_write>:
+  802922:	55                   	push   %ebp
+  802923:	89 e5                	mov    %esp,%ebp
+  802925:	57                   	push   %edi
+  802926:	56                   	push   %esi
+  802927:	53                   	push   %ebx
+  802928:	83 ec 28             	sub    $0x28,%esp
+  80292b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80292e:	56                   	push   %esi
+  80292f:	e8 bd ee ff ff       	call   8017f1 <fd2data>
+  802934:	89 c3                	mov    %eax,%ebx
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802942:	74 5c                	je     8029a0 <devpipe_write+0x7e>
+  802944:	8b 43 04             	mov    0x4(%ebx),%eax
+  802947:	8b 0b                	mov    (%ebx),%ecx
+  802949:	8d 51 20             	lea    0x20(%ecx),%edx
+  80294c:	39 d0                	cmp    %edx,%eax
+  80294e:	72 1e                	jb     80296e <devpipe_write+0x4c>
+  802950:	89 da                	mov    %ebx,%edx
+  802952:	89 f0                	mov    %esi,%eax
+  802954:	e8 64 ff ff ff       	call   8028bd <_pipeisclosed>
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	75 48                	jne    8029a5 <devpipe_write+0x83>
+  80295d:	e8 59 e3 ff ff       	call   800cbb <sys_yield>
+  802962:	8b 43 04             	mov    0x4(%ebx),%eax
+  802965:	8b 0b                	mov    (%ebx),%ecx
+  802967:	8d 51 20             	lea    0x20(%ecx),%edx
+  80296a:	39 d0                	cmp    %edx,%eax
+  80296c:	73 e2                	jae    802950 <devpipe_write+0x2e>
+  80296e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802971:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802975:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802978:	89 c2                	mov    %eax,%edx
+  80297a:	c1 fa 1f             	sar    $0x1f,%edx
+  80297d:	89 d1                	mov    %edx,%ecx
+  80297f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802982:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802985:	83 e2 1f             	and    $0x1f,%edx
+  802988:	29 ca                	sub    %ecx,%edx
+  80298a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80298e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802992:	83 c0 01             	add    $0x1,%eax
+  802995:	89 43 04             	mov    %eax,0x4(%ebx)
+  802998:	83 c7 01             	add    $0x1,%edi
+  80299b:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80299e:	75 a4                	jne    802944 <devpipe_write+0x22>
+  8029a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029a3:	eb 05                	jmp    8029aa <devpipe_write+0x88>
+  8029a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029ad:	5b                   	pop    %ebx
+  8029ae:	5e                   	pop    %esi
+  8029af:	5f                   	pop    %edi
+  8029b0:	5d                   	pop    %ebp
+  8029b1:	c3                   	ret
+
+008029b2 <devpipe_read>:
+  8029b2:	55                   	push   %ebp
+  8029b3:	89 e5                	mov    %esp,%ebp
+  8029b5:	57                   	push   %edi
+  8029b6:	56                   	push   %esi
+  8029b7:	53                   	push   %ebx
+  8029b8:	83 ec 18             	sub    $0x18,%esp
+  8029bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029be:	56                   	push   %esi
+  8029bf:	e8 2d ee ff ff       	call   8017f1 <fd2data>
+  8029c4:	89 c3                	mov    %eax,%ebx
+  8029c6:	83 c4 10             	add    $0x10,%esp
+  8029c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029d2:	74 45                	je     802a19 <devpipe_read+0x67>
+  8029d4:	8b 03                	mov    (%ebx),%eax
+  8029d6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029d9:	75 1d                	jne    8029f8 <devpipe_read+0x46>
+  8029db:	85 ff                	test   %edi,%edi
+  8029dd:	75 3f                	jne    802a1e <devpipe_read+0x6c>
+  8029df:	89 da                	mov    %ebx,%edx
+  8029e1:	89 f0                	mov    %esi,%eax
+  8029e3:	e8 d5 fe ff ff       	call   8028bd <_pipeisclosed>
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	75 3c                	jne    802a28 <devpipe_read+0x76>
+  8029ec:	e8 ca e2 ff ff       	call   800cbb <sys_yield>
+  8029f1:	8b 03                	mov    (%ebx),%eax
+  8029f3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029f6:	74 e7                	je     8029df <devpipe_read+0x2d>
+  8029f8:	99                   	cltd
+  8029f9:	c1 ea 1b             	shr    $0x1b,%edx
+  8029fc:	01 d0                	add    %edx,%eax
+  8029fe:	83 e0 1f             	and    $0x1f,%eax
+  802a01:	29 d0                	sub    %edx,%eax
+  802a03:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a0b:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802a0e:	83 03 01             	addl   $0x1,(%ebx)
+  802a11:	83 c7 01             	add    $0x1,%edi
+  802a14:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802a17:	75 bb                	jne    8029d4 <devpipe_read+0x22>
+  802a19:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a1c:	eb 02                	jmp    802a20 <devpipe_read+0x6e>
+  802a1e:	89 f8                	mov    %edi,%eax
+  802a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a23:	5b                   	pop    %ebx
+  802a24:	5e                   	pop    %esi
+  802a25:	5f                   	pop    %edi
+  802a26:	5d                   	pop    %ebp
+  802a27:	c3                   	ret
+  802a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2d:	eb f1                	jmp    802a20 <devpipe_read+0x6e>
+
+00802a2f <pipe>:
+  802a2f:	55                   	push   %ebp
+  802a30:	89 e5                	mov    %esp,%ebp
+  802a32:	56                   	push   %esi
+  802a33:	53                   	push   %ebx
+  802a34:	83 ec 1c             	sub    $0x1c,%esp
+  802a37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a3a:	50                   	push   %eax
+  802a3b:	e8 c8 ed ff ff       	call   801808 <fd_alloc>
+  802a40:	89 c3                	mov    %eax,%ebx
+  802a42:	83 c4 10             	add    $0x10,%esp
+  802a45:	85 c0                	test   %eax,%eax
+  802a47:	0f 88 23 01 00 00    	js     802b70 <pipe+0x141>
+  802a4d:	83 ec 04             	sub    $0x4,%esp
+  802a50:	68 07 04 00 00       	push   $0x407
+  802a55:	ff 75 f4             	push   -0xc(%ebp)
+  802a58:	6a 00                	push   $0x0
+  802a5a:	e8 a7 e2 ff ff       	call   800d06 <sys_page_alloc>
+  802a5f:	89 c3                	mov    %eax,%ebx
+  802a61:	83 c4 10             	add    $0x10,%esp
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	0f 88 04 01 00 00    	js     802b70 <pipe+0x141>
+  802a6c:	83 ec 0c             	sub    $0xc,%esp
+  802a6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a72:	50                   	push   %eax
+  802a73:	e8 90 ed ff ff       	call   801808 <fd_alloc>
+  802a78:	89 c3                	mov    %eax,%ebx
+  802a7a:	83 c4 10             	add    $0x10,%esp
+  802a7d:	85 c0                	test   %eax,%eax
+  802a7f:	0f 88 db 00 00 00    	js     802b60 <pipe+0x131>
+  802a85:	83 ec 04             	sub    $0x4,%esp
+  802a88:	68 07 04 00 00       	push   $0x407
+  802a8d:	ff 75 f0             	push   -0x10(%ebp)
+  802a90:	6a 00                	push   $0x0
+  802a92:	e8 6f e2 ff ff       	call   800d06 <sys_page_alloc>
+  802a97:	89 c3                	mov    %eax,%ebx
+  802a99:	83 c4 10             	add    $0x10,%esp
+  802a9c:	85 c0                	test   %eax,%eax
+  802a9e:	0f 88 bc 00 00 00    	js     802b60 <pipe+0x131>
+  802aa4:	83 ec 0c             	sub    $0xc,%esp
+  802aa7:	ff 75 f4             	push   -0xc(%ebp)
+  802aaa:	e8 42 ed ff ff       	call   8017f1 <fd2data>
+  802aaf:	89 c6                	mov    %eax,%esi
+  802ab1:	83 c4 0c             	add    $0xc,%esp
+  802ab4:	68 07 04 00 00       	push   $0x407
+  802ab9:	50                   	push   %eax
+  802aba:	6a 00                	push   $0x0
+  802abc:	e8 45 e2 ff ff       	call   800d06 <sys_page_alloc>
+  802ac1:	89 c3                	mov    %eax,%ebx
+  802ac3:	83 c4 10             	add    $0x10,%esp
+  802ac6:	85 c0                	test   %eax,%eax
+  802ac8:	0f 88 82 00 00 00    	js     802b50 <pipe+0x121>
+  802ace:	83 ec 0c             	sub    $0xc,%esp
+  802ad1:	ff 75 f0             	push   -0x10(%ebp)
+  802ad4:	e8 18 ed ff ff       	call   8017f1 <fd2data>
+  802ad9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ae0:	50                   	push   %eax
+  802ae1:	6a 00                	push   $0x0
+  802ae3:	56                   	push   %esi
+  802ae4:	6a 00                	push   $0x0
+  802ae6:	e8 5e e2 ff ff       	call   800d49 <sys_page_map>
+  802aeb:	89 c3                	mov    %eax,%ebx
+  802aed:	83 c4 20             	add    $0x20,%esp
+  802af0:	85 c0                	test   %eax,%eax
+  802af2:	78 4e                	js     802b42 <pipe+0x113>
+  802af4:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802af9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802afc:	89 02                	mov    %eax,(%edx)
+  802afe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b01:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802b08:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b0b:	89 02                	mov    %eax,(%edx)
+  802b0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b10:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802b17:	83 ec 0c             	sub    $0xc,%esp
+  802b1a:	ff 75 f4             	push   -0xc(%ebp)
+  802b1d:	e8 bf ec ff ff       	call   8017e1 <fd2num>
+  802b22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b25:	89 01                	mov    %eax,(%ecx)
+  802b27:	83 c4 04             	add    $0x4,%esp
+  802b2a:	ff 75 f0             	push   -0x10(%ebp)
+  802b2d:	e8 af ec ff ff       	call   8017e1 <fd2num>
+  802b32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b35:	89 41 04             	mov    %eax,0x4(%ecx)
+  802b38:	83 c4 10             	add    $0x10,%esp
+  802b3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b40:	eb 2e                	jmp    802b70 <pipe+0x141>
+  802b42:	83 ec 08             	sub    $0x8,%esp
+  802b45:	56                   	push   %esi
+  802b46:	6a 00                	push   $0x0
+  802b48:	e8 8b e2 ff ff       	call   800dd8 <sys_page_unmap>
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	83 ec 08             	sub    $0x8,%esp
+  802b53:	ff 75 f0             	push   -0x10(%ebp)
+  802b56:	6a 00                	push   $0x0
+  802b58:	e8 7b e2 ff ff       	call   800dd8 <sys_page_unmap>
+  802b5d:	83 c4 10             	add    $0x10,%esp
+  802b60:	83 ec 08             	sub    $0x8,%esp
+  802b63:	ff 75 f4             	push   -0xc(%ebp)
+  802b66:	6a 00                	push   $0x0
+  802b68:	e8 6b e2 ff ff       	call   800dd8 <sys_page_unmap>
+  802b6d:	83 c4 10             	add    $0x10,%esp
+  802b70:	89 d8                	mov    %ebx,%eax
+  802b72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b75:	5b                   	pop    %ebx
+  802b76:	5e                   	pop    %esi
+  802b77:	5d                   	pop    %ebp
+  802b78:	c3                   	ret
+
+00802b79 <pipeisclosed>:
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	83 ec 20             	sub    $0x20,%esp
+  802b7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b82:	50                   	push   %eax
+  802b83:	ff 75 08             	push   0x8(%ebp)
+  802b86:	e8 cd ec ff ff       	call   801858 <fd_lookup>
+  802b8b:	83 c4 10             	add    $0x10,%esp
+  802b8e:	85 c0                	test   %eax,%eax
+  802b90:	78 18                	js     802baa <pipeisclosed+0x31>
+  802b92:	83 ec 0c             	sub    $0xc,%esp
+  802b95:	ff 75 f4             	push   -0xc(%ebp)
+  802b98:	e8 54 ec ff ff       	call   8017f1 <fd2data>
+  802b9d:	89 c2                	mov    %eax,%edx
+  802b9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba2:	e8 16 fd ff ff       	call   8028bd <_pipeisclosed>
+  802ba7:	83 c4 10             	add    $0x10,%esp
+  802baa:	c9                   	leave
+  802bab:	c3                   	ret
+
+00802bac <ipcring_init>:
+  802bac:	55                   	push   %ebp
+  802bad:	89 e5                	mov    %esp,%ebp
+  802baf:	53                   	push   %ebx
+  802bb0:	83 ec 08             	sub    $0x8,%esp
+  802bb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bb6:	6a 60                	push   $0x60
+  802bb8:	6a 00                	push   $0x0
+  802bba:	53                   	push   %ebx
+  802bbb:	e8 61 de ff ff       	call   800a21 <memset>
+  802bc0:	a1 10 50 80 00       	mov    0x805010,%eax
+  802bc5:	8b 40 48             	mov    0x48(%eax),%eax
+  802bc8:	89 03                	mov    %eax,(%ebx)
+  802bca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bcd:	89 43 04             	mov    %eax,0x4(%ebx)
+  802bd0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd3:	89 43 08             	mov    %eax,0x8(%ebx)
+  802bd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bd9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802bdc:	83 c4 10             	add    $0x10,%esp
+  802bdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802be2:	c9                   	leave
+  802be3:	c3                   	ret
+
+00802be4 <ipcring_req_slot>:
+  802be4:	55                   	push   %ebp
+  802be5:	89 e5                	mov    %esp,%ebp
+  802be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bea:	8b 50 10             	mov    0x10(%eax),%edx
+  802bed:	8b 48 18             	mov    0x18(%eax),%ecx
+  802bf0:	29 ca                	sub    %ecx,%edx
+  802bf2:	83 fa 07             	cmp    $0x7,%edx
+  802bf5:	77 0c                	ja     802c03 <ipcring_req_slot+0x1f>
+  802bf7:	8b 50 10             	mov    0x10(%eax),%edx
+  802bfa:	83 e2 07             	and    $0x7,%edx
+  802bfd:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802c01:	5d                   	pop    %ebp
+  802c02:	c3                   	ret
+  802c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c08:	eb f7                	jmp    802c01 <ipcring_req_slot+0x1d>
+
+00802c0a <ipcring_req_push>:
+  802c0a:	55                   	push   %ebp
+  802c0b:	89 e5                	mov    %esp,%ebp
+  802c0d:	83 ec 08             	sub    $0x8,%esp
+  802c10:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c13:	8b 42 10             	mov    0x10(%edx),%eax
+  802c16:	83 c0 01             	add    $0x1,%eax
+  802c19:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c22:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802c26:	85 c0                	test   %eax,%eax
+  802c28:	75 02                	jne    802c2c <ipcring_req_push+0x22>
+  802c2a:	c9                   	leave
+  802c2b:	c3                   	ret
+  802c2c:	6a 00                	push   $0x0
+  802c2e:	68 00 00 80 ee       	push   $0xee800000
+  802c33:	ff 72 08             	push   0x8(%edx)
+  802c36:	ff 72 04             	push   0x4(%edx)
+  802c39:	e8 00 e4 ff ff       	call   80103e <sys_ipc_send>
+  802c3e:	83 c4 10             	add    $0x10,%esp
+  802c41:	eb e7                	jmp    802c2a <ipcring_req_push+0x20>
+
+00802c43 <ipcring_rsp_wait>:
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	53                   	push   %ebx
+  802c47:	83 ec 04             	sub    $0x4,%esp
+  802c4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c4d:	8b 53 18             	mov    0x18(%ebx),%edx
+  802c50:	8b 43 10             	mov    0x10(%ebx),%eax
+  802c53:	39 c2                	cmp    %eax,%edx
+  802c55:	74 3c                	je     802c93 <ipcring_rsp_wait+0x50>
+  802c57:	8b 53 14             	mov    0x14(%ebx),%edx
+  802c5a:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c5d:	39 c2                	cmp    %eax,%edx
+  802c5f:	75 23                	jne    802c84 <ipcring_rsp_wait+0x41>
+  802c61:	83 ec 08             	sub    $0x8,%esp
+  802c64:	6a 00                	push   $0x0
+  802c66:	6a 00                	push   $0x0
+  802c68:	6a 00                	push   $0x0
+  802c6a:	6a 00                	push   $0x0
+  802c6c:	ff 73 0c             	push   0xc(%ebx)
+  802c6f:	ff 73 04             	push   0x4(%ebx)
+  802c72:	e8 b5 e9 ff ff       	call   80162c <ipc_call>
+  802c77:	8b 53 14             	mov    0x14(%ebx),%edx
+  802c7a:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c7d:	83 c4 20             	add    $0x20,%esp
+  802c80:	39 c2                	cmp    %eax,%edx
+  802c82:	74 dd                	je     802c61 <ipcring_rsp_wait+0x1e>
+  802c84:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c87:	83 e0 07             	and    $0x7,%eax
+  802c8a:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802c8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c91:	c9                   	leave
+  802c92:	c3                   	ret
+  802c93:	68 a4 36 80 00       	push   $0x8036a4
+  802c98:	68 55 36 80 00       	push   $0x803655
+  802c9d:	6a 3b                	push   $0x3b
+  802c9f:	68 c5 36 80 00       	push   $0x8036c5
+  802ca4:	e8 97 02 00 00       	call   802f40 <_panic>
+
+00802ca9 <ipcring_rsp_pop>:
+  802ca9:	55                   	push   %ebp
+  802caa:	89 e5                	mov    %esp,%ebp
+  802cac:	8b 55 08             	mov    0x8(%ebp),%edx
+  802caf:	8b 42 18             	mov    0x18(%edx),%eax
+  802cb2:	83 c0 01             	add    $0x1,%eax
+  802cb5:	89 42 18             	mov    %eax,0x18(%edx)
+  802cb8:	5d                   	pop    %ebp
+  802cb9:	c3                   	ret
+
+00802cba <ipcring_server_init>:
+  802cba:	55                   	push   %ebp
+  802cbb:	89 e5                	mov    %esp,%ebp
+  802cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802cc3:	89 10                	mov    %edx,(%eax)
+  802cc5:	8b 55 10             	mov    0x10(%ebp),%edx
+  802cc8:	89 50 04             	mov    %edx,0x4(%eax)
+  802ccb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802cd2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802cd9:	5d                   	pop    %ebp
+  802cda:	c3                   	ret
+
+00802cdb <ipcring_req_avail>:
+  802cdb:	55                   	push   %ebp
+  802cdc:	89 e5                	mov    %esp,%ebp
+  802cde:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ce1:	8b 02                	mov    (%edx),%eax
+  802ce3:	8b 40 10             	mov    0x10(%eax),%eax
+  802ce6:	2b 42 08             	sub    0x8(%edx),%eax
+  802ce9:	ba 08 00 00 00       	mov    $0x8,%edx
+  802cee:	39 d0                	cmp    %edx,%eax
+  802cf0:	0f 47 c2             	cmova  %edx,%eax
+  802cf3:	5d                   	pop    %ebp
+  802cf4:	c3                   	ret
+
+00802cf5 <ipcring_req_peek>:
+  802cf5:	55                   	push   %ebp
+  802cf6:	89 e5                	mov    %esp,%ebp
+  802cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cfb:	8b 42 08             	mov    0x8(%edx),%eax
+  802cfe:	83 e0 07             	and    $0x7,%eax
+  802d01:	8b 12                	mov    (%edx),%edx
+  802d03:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802d07:	5d                   	pop    %ebp
+  802d08:	c3                   	ret
+
+00802d09 <ipcring_rsp_push>:
+  802d09:	55                   	push   %ebp
+  802d0a:	89 e5                	mov    %esp,%ebp
+  802d0c:	83 ec 08             	sub    $0x8,%esp
+  802d0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d12:	8b 41 08             	mov    0x8(%ecx),%eax
+  802d15:	83 c0 01             	add    $0x1,%eax
+  802d18:	89 41 08             	mov    %eax,0x8(%ecx)
+  802d1b:	8b 11                	mov    (%ecx),%edx
+  802d1d:	83 c2 14             	add    $0x14,%edx
+  802d20:	f0 87 02             	lock xchg %eax,(%edx)
+  802d23:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802d27:	75 02                	jne    802d2b <ipcring_rsp_push+0x22>
+  802d29:	c9                   	leave
+  802d2a:	c3                   	ret
+  802d2b:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802d32:	6a 00                	push   $0x0
+  802d34:	68 00 00 80 ee       	push   $0xee800000
+  802d39:	6a 00                	push   $0x0
+  802d3b:	ff 71 04             	push   0x4(%ecx)
+  802d3e:	e8 1e e2 ff ff       	call   800f61 <sys_ipc_try_send>
+  802d43:	83 c4 10             	add    $0x10,%esp
+  802d46:	eb e1                	jmp    802d29 <ipcring_rsp_push+0x20>
+
+00802d48 <ipcring_client_wait>:
+  802d48:	55                   	push   %ebp
+  802d49:	89 e5                	mov    %esp,%ebp
+  802d4b:	83 ec 08             	sub    $0x8,%esp
+  802d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d51:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802d58:	8b 10                	mov    (%eax),%edx
+  802d5a:	8b 52 18             	mov    0x18(%edx),%edx
+  802d5d:	3b 50 08             	cmp    0x8(%eax),%edx
+  802d60:	75 02                	jne    802d64 <ipcring_client_wait+0x1c>
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+  802d64:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802d6b:	6a 00                	push   $0x0
+  802d6d:	68 00 00 80 ee       	push   $0xee800000
+  802d72:	6a 00                	push   $0x0
+  802d74:	ff 70 04             	push   0x4(%eax)
+  802d77:	e8 e5 e1 ff ff       	call   800f61 <sys_ipc_try_send>
+  802d7c:	83 c4 10             	add    $0x10,%esp
+  802d7f:	eb e1                	jmp    802d62 <ipcring_client_wait+0x1a>
+
+00802d81 <ipcring_server_sleep>:
+  802d81:	55                   	push   %ebp
+  802d82:	89 e5                	mov    %esp,%ebp
+  802d84:	53                   	push   %ebx
+  802d85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d88:	8b 01                	mov    (%ecx),%eax
+  802d8a:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802d8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d92:	f0 87 02             	lock xchg %eax,(%edx)
+  802d95:	8b 11                	mov    (%ecx),%edx
+  802d97:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802d9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d9f:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802da2:	74 0e                	je     802db2 <ipcring_server_sleep+0x31>
+  802da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da9:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802db5:	c9                   	leave
+  802db6:	c3                   	ret
+
+00802db7 <devcons_close>:
+  802db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbc:	c3                   	ret
+
+00802dbd <devcons_stat>:
+  802dbd:	55                   	push   %ebp
+  802dbe:	89 e5                	mov    %esp,%ebp
+  802dc0:	83 ec 10             	sub    $0x10,%esp
+  802dc3:	68 d3 36 80 00       	push   $0x8036d3
+  802dc8:	ff 75 0c             	push   0xc(%ebp)
+  802dcb:	e8 d6 da ff ff       	call   8008a6 <strcpy>
+  802dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd5:	c9                   	leave
+  802dd6:	c3                   	ret
+
+00802dd7 <devcons_write>:
+  802dd7:	55                   	push   %ebp
+  802dd8:	89 e5                	mov    %esp,%ebp
+  802dda:	57                   	push   %edi
+  802ddb:	56                   	push   %esi
+  802ddc:	53                   	push   %ebx
+  802ddd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802de3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802de6:	85 ff                	test   %edi,%edi
+  802de8:	74 51                	je     802e3b <devcons_write+0x64>
+  802dea:	be 00 00 00 00       	mov    $0x0,%esi
+  802def:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df4:	89 fb                	mov    %edi,%ebx
+  802df6:	29 c3                	sub    %eax,%ebx
+  802df8:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802dfd:	39 d3                	cmp    %edx,%ebx
+  802dff:	0f 47 da             	cmova  %edx,%ebx
+  802e02:	83 ec 04             	sub    $0x4,%esp
+  802e05:	53                   	push   %ebx
+  802e06:	03 45 0c             	add    0xc(%ebp),%eax
+  802e09:	50                   	push   %eax
+  802e0a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802e10:	50                   	push   %eax
+  802e11:	e8 40 dc ff ff       	call   800a56 <memmove>
+  802e16:	83 c4 08             	add    $0x8,%esp
+  802e19:	53                   	push   %ebx
+  802e1a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802e20:	50                   	push   %eax
+  802e21:	e8 f8 dd ff ff       	call   800c1e <sys_cputs>
+  802e26:	01 de                	add    %ebx,%esi
+  802e28:	89 f0                	mov    %esi,%eax
+  802e2a:	83 c4 10             	add    $0x10,%esp
+  802e2d:	39 fe                	cmp    %edi,%esi
+  802e2f:	72 c3                	jb     802df4 <devcons_write+0x1d>
+  802e31:	89 f0                	mov    %esi,%eax
+  802e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e36:	5b                   	pop    %ebx
+  802e37:	5e                   	pop    %esi
+  802e38:	5f                   	pop    %edi
+  802e39:	5d                   	pop    %ebp
+  802e3a:	c3                   	ret
+  802e3b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e40:	eb ef                	jmp    802e31 <devcons_write+0x5a>
+
+00802e42 <devcons_read>:
+  802e42:	55                   	push   %ebp
+  802e43:	89 e5                	mov    %esp,%ebp
+  802e45:	83 ec 08             	sub    $0x8,%esp
+  802e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e4d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e51:	75 07                	jne    802e5a <devcons_read+0x18>
+  802e53:	eb 1f                	jmp    802e74 <devcons_read+0x32>
+  802e55:	e8 61 de ff ff       	call   800cbb <sys_yield>
+  802e5a:	e8 dd dd ff ff       	call   800c3c <sys_cgetc>
+  802e5f:	85 c0                	test   %eax,%eax
+  802e61:	74 f2                	je     802e55 <devcons_read+0x13>
+  802e63:	78 0f                	js     802e74 <devcons_read+0x32>
+  802e65:	83 f8 04             	cmp    $0x4,%eax
+  802e68:	74 0c                	je     802e76 <devcons_read+0x34>
+  802e6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e6d:	88 02                	mov    %al,(%edx)
+  802e6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e74:	c9                   	leave
+  802e75:	c3                   	ret
+  802e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e7b:	eb f7                	jmp    802e74 <devcons_read+0x32>
+
+00802e7d <cputchar>:
+  802e7d:	55                   	push   %ebp
+  802e7e:	89 e5                	mov    %esp,%ebp
+  802e80:	83 ec 20             	sub    $0x20,%esp
+  802e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e86:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802e89:	6a 01                	push   $0x1
+  802e8b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e8e:	50                   	push   %eax
+  802e8f:	e8 8a dd ff ff       	call   800c1e <sys_cputs>
+  802e94:	83 c4 10             	add    $0x10,%esp
+  802e97:	c9                   	leave
+  802e98:	c3                   	ret
+
+00802e99 <getchar>:
+  802e99:	55                   	push   %ebp
+  802e9a:	89 e5                	mov    %esp,%ebp
+  802e9c:	83 ec 1c             	sub    $0x1c,%esp
+  802e9f:	6a 01                	push   $0x1
+  802ea1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ea4:	50                   	push   %eax
+  802ea5:	6a 00                	push   $0x0
+  802ea7:	e8 0e ec ff ff       	call   801aba <read>
+  802eac:	83 c4 10             	add    $0x10,%esp
+  802eaf:	85 c0                	test   %eax,%eax
+  802eb1:	78 06                	js     802eb9 <getchar+0x20>
+  802eb3:	74 06                	je     802ebb <getchar+0x22>
+  802eb5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802eb9:	c9                   	leave
+  802eba:	c3                   	ret
+  802ebb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802ec0:	eb f7                	jmp    802eb9 <getchar+0x20>
+
+00802ec2 <iscons>:
+  802ec2:	55                   	push   %ebp
+  802ec3:	89 e5                	mov    %esp,%ebp
+  802ec5:	83 ec 20             	sub    $0x20,%esp
+  802ec8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ecb:	50                   	push   %eax
+  802ecc:	ff 75 08             	push   0x8(%ebp)
+  802ecf:	e8 84 e9 ff ff       	call   801858 <fd_lookup>
+  802ed4:	83 c4 10             	add    $0x10,%esp
+  802ed7:	85 c0                	test   %eax,%eax
+  802ed9:	78 11                	js     802eec <iscons+0x2a>
+  802edb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ede:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802ee4:	39 10                	cmp    %edx,(%eax)
+  802ee6:	0f 94 c0             	sete   %al
+  802ee9:	0f b6 c0             	movzbl %al,%eax
+  802eec:	c9                   	leave
+  802eed:	c3                   	ret
+
+00802eee <opencons>:
+  802eee:	55                   	push   %ebp
+  802eef:	89 e5                	mov    %esp,%ebp
+  802ef1:	83 ec 24             	sub    $0x24,%esp
+  802ef4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ef7:	50                   	push   %eax
+  802ef8:	e8 0b e9 ff ff       	call   801808 <fd_alloc>
+  802efd:	83 c4 10             	add    $0x10,%esp
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	78 3a                	js     802f3e <opencons+0x50>
+  802f04:	83 ec 04             	sub    $0x4,%esp
+  802f07:	68 07 04 00 00       	push   $0x407
+  802f0c:	ff 75 f4             	push   -0xc(%ebp)
+  802f0f:	6a 00                	push   $0x0
+  802f11:	e8 f0 dd ff ff       	call   800d06 <sys_page_alloc>
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	85 c0                	test   %eax,%eax
+  802f1b:	78 21                	js     802f3e <opencons+0x50>
+  802f1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f20:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802f26:	89 10                	mov    %edx,(%eax)
+  802f28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f2b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802f32:	83 ec 0c             	sub    $0xc,%esp
+  802f35:	50                   	push   %eax
+  802f36:	e8 a6 e8 ff ff       	call   8017e1 <fd2num>
+  802f3b:	83 c4 10             	add    $0x10,%esp
+  802f3e:	c9                   	leave
+  802f3f:	c3                   	ret
+
+00802f40 <_panic>:
+  802f40:	55                   	push   %ebp
+  802f41:	89 e5                	mov    %esp,%ebp
+  802f43:	56                   	push   %esi
+  802f44:	53                   	push   %ebx
+  802f45:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802f48:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802f4e:	e8 49 dd ff ff       	call   800c9c <sys_getenvid>
+  802f53:	83 ec 0c             	sub    $0xc,%esp
+  802f56:	ff 75 0c             	push   0xc(%ebp)
+  802f59:	ff 75 08             	push   0x8(%ebp)
+  802f5c:	56                   	push   %esi
+  802f5d:	50                   	push   %eax
+  802f5e:	68 e0 36 80 00       	push   $0x8036e0
+  802f63:	e8 47 d2 ff ff       	call   8001af <cprintf>
+  802f68:	83 c4 18             	add    $0x18,%esp
+  802f6b:	53                   	push   %ebx
+  802f6c:	ff 75 10             	push   0x10(%ebp)
+  802f6f:	e8 ea d1 ff ff       	call   80015e <vcprintf>
+  802f74:	c7 04 24 9a 36 80 00 	movl   $0x80369a,(%esp)
+  802f7b:	e8 2f d2 ff ff       	call   8001af <cprintf>
+  802f80:	83 c4 10             	add    $0x10,%esp
+  802f83:	cc                   	int3
+  802f84:	eb fd                	jmp    802f83 <_panic+0x43>
+
+00802f86 <pageref>:
+  802f86:	55                   	push   %ebp
+  802f87:	89 e5                	mov    %esp,%ebp
+  802f89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f8c:	89 c2                	mov    %eax,%edx
+  802f8e:	c1 ea 16             	shr    $0x16,%edx
+  802f91:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9d:	f6 c1 01             	test   $0x1,%cl
+  802fa0:	74 22                	je     802fc4 <pageref+0x3e>
+  802fa2:	c1 e8 0c             	shr    $0xc,%eax
+  802fa5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fac:	a8 01                	test   $0x1,%al
+  802fae:	74 14                	je     802fc4 <pageref+0x3e>
+  802fb0:	c1 e8 0c             	shr    $0xc,%eax
+  802fb3:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802fb6:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802fbd:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802fc1:	0f b7 d2             	movzwl %dx,%edx
+  802fc4:	89 d0                	mov    %edx,%eax
+  802fc6:	5d                   	pop    %ebp
+  802fc7:	c3                   	ret
+
+00802fc8 <__udivmoddi4>:
+  802fc8:	55                   	push   %ebp
+  802fc9:	57                   	push   %edi
+  802fca:	56                   	push   %esi
+  802fcb:	53                   	push   %ebx
+  802fcc:	83 ec 24             	sub    $0x24,%esp
+  802fcf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802fd3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802fd7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802fdb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802fdf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802fe3:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802fe7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802feb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802fef:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ffd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803002:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803009:	00 
+  80300a:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803011:	00 
+  803012:	89 fb                	mov    %edi,%ebx
+  803014:	eb 08                	jmp    80301e <__udivmoddi4+0x56>
+  803016:	83 e9 01             	sub    $0x1,%ecx
+  803019:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80301c:	74 68                	je     803086 <__udivmoddi4+0xbe>
+  80301e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803022:	01 c0                	add    %eax,%eax
+  803024:	89 c6                	mov    %eax,%esi
+  803026:	89 d7                	mov    %edx,%edi
+  803028:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80302c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803030:	0f ad d0             	shrd   %cl,%edx,%eax
+  803033:	d3 ea                	shr    %cl,%edx
+  803035:	f6 c1 20             	test   $0x20,%cl
+  803038:	74 04                	je     80303e <__udivmoddi4+0x76>
+  80303a:	89 d0                	mov    %edx,%eax
+  80303c:	31 d2                	xor    %edx,%edx
+  80303e:	83 e0 01             	and    $0x1,%eax
+  803041:	89 04 24             	mov    %eax,(%esp)
+  803044:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80304b:	00 
+  80304c:	8b 04 24             	mov    (%esp),%eax
+  80304f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803053:	09 f0                	or     %esi,%eax
+  803055:	09 fa                	or     %edi,%edx
+  803057:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80305b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80305f:	39 f0                	cmp    %esi,%eax
+  803061:	89 d5                	mov    %edx,%ebp
+  803063:	19 fd                	sbb    %edi,%ebp
+  803065:	72 af                	jb     803016 <__udivmoddi4+0x4e>
+  803067:	29 f0                	sub    %esi,%eax
+  803069:	19 fa                	sbb    %edi,%edx
+  80306b:	89 cf                	mov    %ecx,%edi
+  80306d:	c1 ef 05             	shr    $0x5,%edi
+  803070:	83 e7 01             	and    $0x1,%edi
+  803073:	89 fe                	mov    %edi,%esi
+  803075:	83 f6 01             	xor    $0x1,%esi
+  803078:	d3 e6                	shl    %cl,%esi
+  80307a:	d3 e7                	shl    %cl,%edi
+  80307c:	09 74 24 18          	or     %esi,0x18(%esp)
+  803080:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803084:	eb 90                	jmp    803016 <__udivmoddi4+0x4e>
+  803086:	85 db                	test   %ebx,%ebx
+  803088:	74 05                	je     80308f <__udivmoddi4+0xc7>
+  80308a:	89 03                	mov    %eax,(%ebx)
+  80308c:	89 53 04             	mov    %edx,0x4(%ebx)
+  80308f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803093:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803097:	83 c4 24             	add    $0x24,%esp
+  80309a:	5b                   	pop    %ebx
+  80309b:	5e                   	pop    %esi
+  80309c:	5f                   	pop    %edi
+  80309d:	5d                   	pop    %ebp
+  80309e:	c3                   	ret
+
+0080309f <__udivdi3>:
+  80309f:	83 ec 08             	sub    $0x8,%esp
+  8030a2:	6a 00                	push   $0x0
+  8030a4:	ff 74 24 1c          	push   0x1c(%esp)
+  8030a8:	ff 74 24 1c          	push   0x1c(%esp)
+  8030ac:	ff 74 24 1c          	push   0x1c(%esp)
+  8030b0:	ff 74 24 1c          	push   0x1c(%esp)
+  8030b4:	e8 0f ff ff ff       	call   802fc8 <__udivmoddi4>
+  8030b9:	83 c4 1c             	add    $0x1c,%esp
+  8030bc:	c3                   	ret
+
+008030bd <__umoddi3>:
+  8030bd:	83 ec 18             	sub    $0x18,%esp
+  8030c0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030c4:	50                   	push   %eax
+  8030c5:	ff 74 24 2c          	push   0x2c(%esp)
+  8030c9:	ff 74 24 2c          	push   0x2c(%esp)
+  8030cd:	ff 74 24 2c          	push   0x2c(%esp)
+  8030d1:	ff 74 24 2c          	push   0x2c(%esp)
+  8030d5:	e8 ee fe ff ff       	call   802fc8 <__udivmoddi4>
+  8030da:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8030de:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8030e2:	83 c4 2c             	add    $0x2c,%esp
+  8030e5:	c3                   	ret
+
+008030e6 <__divdi3>:
+  8030e6:	53                   	push   %ebx
+  8030e7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030eb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030ef:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8030f3:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030f7:	85 d2                	test   %edx,%edx
+  8030f9:	78 12                	js     80310d <__divdi3+0x27>
+  8030fb:	85 db                	test   %ebx,%ebx
+  8030fd:	78 2e                	js     80312d <__divdi3+0x47>
+  8030ff:	53                   	push   %ebx
+  803100:	51                   	push   %ecx
+  803101:	52                   	push   %edx
+  803102:	50                   	push   %eax
+  803103:	e8 97 ff ff ff       	call   80309f <__udivdi3>
+  803108:	83 c4 10             	add    $0x10,%esp
+  80310b:	eb 1e                	jmp    80312b <__divdi3+0x45>
+  80310d:	f7 d8                	neg    %eax
+  80310f:	83 d2 00             	adc    $0x0,%edx
+  803112:	f7 da                	neg    %edx
+  803114:	85 db                	test   %ebx,%ebx
+  803116:	78 2a                	js     803142 <__divdi3+0x5c>
+  803118:	53                   	push   %ebx
+  803119:	51                   	push   %ecx
+  80311a:	52                   	push   %edx
+  80311b:	50                   	push   %eax
+  80311c:	e8 7e ff ff ff       	call   80309f <__udivdi3>
+  803121:	83 c4 10             	add    $0x10,%esp
+  803124:	f7 d8                	neg    %eax
+  803126:	83 d2 00             	adc    $0x0,%edx
+  803129:	f7 da                	neg    %edx
+  80312b:	5b                   	pop    %ebx
+  80312c:	c3                   	ret
+  80312d:	f7 d9                	neg    %ecx
+  80312f:	83 d3 00             	adc    $0x0,%ebx
+  803132:	f7 db                	neg    %ebx
+  803134:	53                   	push   %ebx
+  803135:	51                   	push   %ecx
+  803136:	52                   	push   %edx
+  803137:	50                   	push   %eax
+  803138:	e8 62 ff ff ff       	call   80309f <__udivdi3>
+  80313d:	83 c4 10             	add    $0x10,%esp
+  803140:	eb e2                	jmp    803124 <__divdi3+0x3e>
+  803142:	f7 d9                	neg    %ecx
+  803144:	83 d3 00             	adc    $0x0,%ebx
+  803147:	f7 db                	neg    %ebx
+  803149:	53                   	push   %ebx
+  80314a:	51                   	push   %ecx
+  80314b:	52                   	push   %edx
+  80314c:	50                   	push   %eax
+  80314d:	e8 4d ff ff ff       	call   80309f <__udivdi3>
+  803152:	83 c4 10             	add    $0x10,%esp
+  803155:	eb d4                	jmp    80312b <__divdi3+0x45>
+
+00803157 <__moddi3>:
+  803157:	55                   	push   %ebp
+  803158:	57                   	push   %edi
+  803159:	56                   	push   %esi
+  80315a:	53                   	push   %ebx
+  80315b:	83 ec 0c             	sub    $0xc,%esp
+  80315e:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803162:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803166:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80316a:	89 e9                	mov    %ebp,%ecx
+  80316c:	f7 d9                	neg    %ecx
+  80316e:	89 d0                	mov    %edx,%eax
+  803170:	83 d0 00             	adc    $0x0,%eax
+  803173:	f7 d8                	neg    %eax
+  803175:	0f 49 e9             	cmovns %ecx,%ebp
+  803178:	0f 49 d0             	cmovns %eax,%edx
+  80317b:	52                   	push   %edx
+  80317c:	55                   	push   %ebp
+  80317d:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803181:	f7 da                	neg    %edx
+  803183:	89 d8                	mov    %ebx,%eax
+  803185:	83 d0 00             	adc    $0x0,%eax
+  803188:	f7 d8                	neg    %eax
+  80318a:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80318f:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803193:	0f 48 c3             	cmovs  %ebx,%eax
+  803196:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80319a:	ff 74 24 0c          	push   0xc(%esp)
+  80319e:	ff 74 24 0c          	push   0xc(%esp)
+  8031a2:	e8 16 ff ff ff       	call   8030bd <__umoddi3>
+  8031a7:	83 c4 10             	add    $0x10,%esp
+  8031aa:	85 db                	test   %ebx,%ebx
+  8031ac:	78 08                	js     8031b6 <__moddi3+0x5f>
+  8031ae:	83 c4 0c             	add    $0xc,%esp
+  8031b1:	5b                   	pop    %ebx
+  8031b2:	5e                   	pop    %esi
+  8031b3:	5f                   	pop    %edi
+  8031b4:	5d                   	pop    %ebp
+  8031b5:	c3                   	ret
+  8031b6:	f7 d8                	neg    %eax
+  8031b8:	83 d2 00             	adc    $0x0,%edx
+  8031bb:	f7 da                	neg    %edx
+  8031bd:	eb ef                	jmp    8031ae <__moddi3+0x57>
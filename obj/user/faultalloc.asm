@@ -0,0 +1,5144 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+  80003f:	53                   	push   %ebx
+  800040:	68 a0 32 80 00       	push   $0x8032a0
+  800045:	e8 d4 01 00 00       	call   80021e <cprintf>
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 17 0d 00 00       	call   800d75 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+  800065:	53                   	push   %ebx
+  800066:	68 ec 32 80 00       	push   $0x8032ec
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 3c 08 00 00       	call   8008af <snprintf>
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 c0 32 80 00       	push   $0x8032c0
+  800085:	6a 0e                	push   $0xe
+  800087:	68 aa 32 80 00       	push   $0x8032aa
+  80008c:	e8 b2 00 00 00       	call   800143 <_panic>
+
+00800091 <umain>:
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 42 15 00 00       	call   8015e3 <set_pgfault_handler>
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 bc 32 80 00       	push   $0x8032bc
+  8000ae:	e8 6b 01 00 00       	call   80021e <cprintf>
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 bc 32 80 00       	push   $0x8032bc
+  8000c0:	e8 59 01 00 00       	call   80021e <cprintf>
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000d5:	e8 31 0c 00 00       	call   800d0b <sys_getenvid>
+  8000da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000df:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ea:	a3 10 50 80 00       	mov    %eax,0x805010
+  8000ef:	85 db                	test   %ebx,%ebx
+  8000f1:	7e 07                	jle    8000fa <libmain+0x30>
+  8000f3:	8b 06                	mov    (%esi),%eax
+  8000f5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	e8 8d ff ff ff       	call   800091 <umain>
+  800104:	e8 0a 00 00 00       	call   800113 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5d                   	pop    %ebp
+  800112:	c3                   	ret
+
+00800113 <exit>:
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	83 ec 08             	sub    $0x8,%esp
+  800119:	a1 10 50 80 00       	mov    0x805010,%eax
+  80011e:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800124:	85 c0                	test   %eax,%eax
+  800126:	75 14                	jne    80013c <exit+0x29>
+  800128:	e8 23 17 00 00       	call   801850 <close_all>
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	6a 00                	push   $0x0
+  800132:	e8 93 0b 00 00       	call   800cca <sys_env_destroy>
+  800137:	83 c4 10             	add    $0x10,%esp
+  80013a:	c9                   	leave
+  80013b:	c3                   	ret
+  80013c:	e8 f6 12 00 00       	call   801437 <sys_lease_complete>
+  800141:	eb e5                	jmp    800128 <exit+0x15>
+
+00800143 <_panic>:
+  800143:	55                   	push   %ebp
+  800144:	89 e5                	mov    %esp,%ebp
+  800146:	56                   	push   %esi
+  800147:	53                   	push   %ebx
+  800148:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80014b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800151:	e8 b5 0b 00 00       	call   800d0b <sys_getenvid>
+  800156:	83 ec 0c             	sub    $0xc,%esp
+  800159:	ff 75 0c             	push   0xc(%ebp)
+  80015c:	ff 75 08             	push   0x8(%ebp)
+  80015f:	56                   	push   %esi
+  800160:	50                   	push   %eax
+  800161:	68 18 33 80 00       	push   $0x803318
+  800166:	e8 b3 00 00 00       	call   80021e <cprintf>
+  80016b:	83 c4 18             	add    $0x18,%esp
+  80016e:	53                   	push   %ebx
+  80016f:	ff 75 10             	push   0x10(%ebp)
+  800172:	e8 56 00 00 00       	call   8001cd <vcprintf>
+  800177:	c7 04 24 e6 37 80 00 	movl   $0x8037e6,(%esp)
+  80017e:	e8 9b 00 00 00       	call   80021e <cprintf>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	cc                   	int3
+  800187:	eb fd                	jmp    800186 <_panic+0x43>
+
+00800189 <putch>:
+  800189:	55                   	push   %ebp
+  80018a:	89 e5                	mov    %esp,%ebp
+  80018c:	53                   	push   %ebx
+  80018d:	83 ec 04             	sub    $0x4,%esp
+  800190:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800193:	8b 13                	mov    (%ebx),%edx
+  800195:	8d 42 01             	lea    0x1(%edx),%eax
+  800198:	89 03                	mov    %eax,(%ebx)
+  80019a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80019d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001a1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a6:	74 09                	je     8001b1 <putch+0x28>
+  8001a8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001af:	c9                   	leave
+  8001b0:	c3                   	ret
+  8001b1:	83 ec 08             	sub    $0x8,%esp
+  8001b4:	68 ff 00 00 00       	push   $0xff
+  8001b9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001bc:	50                   	push   %eax
+  8001bd:	e8 cb 0a 00 00       	call   800c8d <sys_cputs>
+  8001c2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c8:	83 c4 10             	add    $0x10,%esp
+  8001cb:	eb db                	jmp    8001a8 <putch+0x1f>
+
+008001cd <vcprintf>:
+  8001cd:	55                   	push   %ebp
+  8001ce:	89 e5                	mov    %esp,%ebp
+  8001d0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001d6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001dd:	00 00 00 
+  8001e0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e7:	00 00 00 
+  8001ea:	ff 75 0c             	push   0xc(%ebp)
+  8001ed:	ff 75 08             	push   0x8(%ebp)
+  8001f0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f6:	50                   	push   %eax
+  8001f7:	68 89 01 80 00       	push   $0x800189
+  8001fc:	e8 1c 01 00 00       	call   80031d <vprintfmt>
+  800201:	83 c4 08             	add    $0x8,%esp
+  800204:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80020a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800210:	50                   	push   %eax
+  800211:	e8 77 0a 00 00       	call   800c8d <sys_cputs>
+  800216:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80021c:	c9                   	leave
+  80021d:	c3                   	ret
+
+0080021e <cprintf>:
+  80021e:	55                   	push   %ebp
+  80021f:	89 e5                	mov    %esp,%ebp
+  800221:	83 ec 10             	sub    $0x10,%esp
+  800224:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800227:	50                   	push   %eax
+  800228:	ff 75 08             	push   0x8(%ebp)
+  80022b:	e8 9d ff ff ff       	call   8001cd <vcprintf>
+  800230:	c9                   	leave
+  800231:	c3                   	ret
+
+00800232 <printnum>:
+  800232:	55                   	push   %ebp
+  800233:	89 e5                	mov    %esp,%ebp
+  800235:	57                   	push   %edi
+  800236:	56                   	push   %esi
+  800237:	53                   	push   %ebx
+  800238:	83 ec 1c             	sub    $0x1c,%esp
+  80023b:	89 c3                	mov    %eax,%ebx
+  80023d:	89 d6                	mov    %edx,%esi
+  80023f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800242:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800245:	89 d1                	mov    %edx,%ecx
+  800247:	89 c2                	mov    %eax,%edx
+  800249:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80024c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80024f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800252:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800255:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80025c:	39 c2                	cmp    %eax,%edx
+  80025e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800261:	73 4b                	jae    8002ae <printnum+0x7c>
+  800263:	8b 45 14             	mov    0x14(%ebp),%eax
+  800266:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800269:	85 ff                	test   %edi,%edi
+  80026b:	7e 11                	jle    80027e <printnum+0x4c>
+  80026d:	83 ec 08             	sub    $0x8,%esp
+  800270:	56                   	push   %esi
+  800271:	ff 75 18             	push   0x18(%ebp)
+  800274:	ff d3                	call   *%ebx
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	83 ef 01             	sub    $0x1,%edi
+  80027c:	75 ef                	jne    80026d <printnum+0x3b>
+  80027e:	83 ec 08             	sub    $0x8,%esp
+  800281:	56                   	push   %esi
+  800282:	83 ec 04             	sub    $0x4,%esp
+  800285:	ff 75 e4             	push   -0x1c(%ebp)
+  800288:	ff 75 e0             	push   -0x20(%ebp)
+  80028b:	ff 75 dc             	push   -0x24(%ebp)
+  80028e:	ff 75 d8             	push   -0x28(%ebp)
+  800291:	e8 f3 2e 00 00       	call   803189 <__umoddi3>
+  800296:	83 c4 14             	add    $0x14,%esp
+  800299:	0f be 80 3b 33 80 00 	movsbl 0x80333b(%eax),%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	ff d3                	call   *%ebx
+  8002a3:	83 c4 10             	add    $0x10,%esp
+  8002a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a9:	5b                   	pop    %ebx
+  8002aa:	5e                   	pop    %esi
+  8002ab:	5f                   	pop    %edi
+  8002ac:	5d                   	pop    %ebp
+  8002ad:	c3                   	ret
+  8002ae:	83 ec 0c             	sub    $0xc,%esp
+  8002b1:	ff 75 18             	push   0x18(%ebp)
+  8002b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002b7:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002ba:	52                   	push   %edx
+  8002bb:	50                   	push   %eax
+  8002bc:	83 ec 08             	sub    $0x8,%esp
+  8002bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c2:	ff 75 e0             	push   -0x20(%ebp)
+  8002c5:	ff 75 dc             	push   -0x24(%ebp)
+  8002c8:	ff 75 d8             	push   -0x28(%ebp)
+  8002cb:	e8 9b 2e 00 00       	call   80316b <__udivdi3>
+  8002d0:	83 c4 18             	add    $0x18,%esp
+  8002d3:	52                   	push   %edx
+  8002d4:	50                   	push   %eax
+  8002d5:	89 f2                	mov    %esi,%edx
+  8002d7:	89 d8                	mov    %ebx,%eax
+  8002d9:	e8 54 ff ff ff       	call   800232 <printnum>
+  8002de:	83 c4 20             	add    $0x20,%esp
+  8002e1:	eb 9b                	jmp    80027e <printnum+0x4c>
+
+008002e3 <sprintputch>:
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002e9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002ed:	8b 10                	mov    (%eax),%edx
+  8002ef:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f2:	73 0a                	jae    8002fe <sprintputch+0x1b>
+  8002f4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f7:	89 08                	mov    %ecx,(%eax)
+  8002f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fc:	88 02                	mov    %al,(%edx)
+  8002fe:	5d                   	pop    %ebp
+  8002ff:	c3                   	ret
+
+00800300 <printfmt>:
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	83 ec 08             	sub    $0x8,%esp
+  800306:	8d 45 14             	lea    0x14(%ebp),%eax
+  800309:	50                   	push   %eax
+  80030a:	ff 75 10             	push   0x10(%ebp)
+  80030d:	ff 75 0c             	push   0xc(%ebp)
+  800310:	ff 75 08             	push   0x8(%ebp)
+  800313:	e8 05 00 00 00       	call   80031d <vprintfmt>
+  800318:	83 c4 10             	add    $0x10,%esp
+  80031b:	c9                   	leave
+  80031c:	c3                   	ret
+
+0080031d <vprintfmt>:
+  80031d:	55                   	push   %ebp
+  80031e:	89 e5                	mov    %esp,%ebp
+  800320:	57                   	push   %edi
+  800321:	56                   	push   %esi
+  800322:	53                   	push   %ebx
+  800323:	83 ec 2c             	sub    $0x2c,%esp
+  800326:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800329:	89 df                	mov    %ebx,%edi
+  80032b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800331:	8d 70 01             	lea    0x1(%eax),%esi
+  800334:	0f b6 00             	movzbl (%eax),%eax
+  800337:	83 f8 25             	cmp    $0x25,%eax
+  80033a:	74 1e                	je     80035a <vprintfmt+0x3d>
+  80033c:	85 c0                	test   %eax,%eax
+  80033e:	0f 84 15 05 00 00    	je     800859 <vprintfmt+0x53c>
+  800344:	83 ec 08             	sub    $0x8,%esp
+  800347:	53                   	push   %ebx
+  800348:	50                   	push   %eax
+  800349:	ff d7                	call   *%edi
+  80034b:	83 c6 01             	add    $0x1,%esi
+  80034e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800352:	83 c4 10             	add    $0x10,%esp
+  800355:	83 f8 25             	cmp    $0x25,%eax
+  800358:	75 e2                	jne    80033c <vprintfmt+0x1f>
+  80035a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80035e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800365:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80036c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800373:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800378:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80037b:	8d 56 01             	lea    0x1(%esi),%edx
+  80037e:	0f b6 0e             	movzbl (%esi),%ecx
+  800381:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800384:	3c 55                	cmp    $0x55,%al
+  800386:	0f 87 3b 04 00 00    	ja     8007c7 <vprintfmt+0x4aa>
+  80038c:	0f b6 c0             	movzbl %al,%eax
+  80038f:	ff 24 85 80 34 80 00 	jmp    *0x803480(,%eax,4)
+  800396:	89 75 10             	mov    %esi,0x10(%ebp)
+  800399:	eb 93                	jmp    80032e <vprintfmt+0x11>
+  80039b:	89 d6                	mov    %edx,%esi
+  80039d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003a1:	eb d8                	jmp    80037b <vprintfmt+0x5e>
+  8003a3:	89 d6                	mov    %edx,%esi
+  8003a5:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003a9:	eb d0                	jmp    80037b <vprintfmt+0x5e>
+  8003ab:	0f b6 c9             	movzbl %cl,%ecx
+  8003ae:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003b4:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003b8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003bb:	83 f9 09             	cmp    $0x9,%ecx
+  8003be:	77 6f                	ja     80042f <vprintfmt+0x112>
+  8003c0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003c3:	83 c2 01             	add    $0x1,%edx
+  8003c6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003c9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003cd:	0f be 02             	movsbl (%edx),%eax
+  8003d0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003d3:	83 fe 09             	cmp    $0x9,%esi
+  8003d6:	76 eb                	jbe    8003c3 <vprintfmt+0xa6>
+  8003d8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8003db:	89 d6                	mov    %edx,%esi
+  8003dd:	eb 13                	jmp    8003f2 <vprintfmt+0xd5>
+  8003df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e2:	8b 00                	mov    (%eax),%eax
+  8003e4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003f0:	89 d6                	mov    %edx,%esi
+  8003f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003f6:	79 83                	jns    80037b <vprintfmt+0x5e>
+  8003f8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003fe:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800405:	e9 71 ff ff ff       	jmp    80037b <vprintfmt+0x5e>
+  80040a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040d:	85 c9                	test   %ecx,%ecx
+  80040f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800414:	0f 49 c1             	cmovns %ecx,%eax
+  800417:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80041a:	89 d6                	mov    %edx,%esi
+  80041c:	e9 5a ff ff ff       	jmp    80037b <vprintfmt+0x5e>
+  800421:	89 d6                	mov    %edx,%esi
+  800423:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80042a:	e9 4c ff ff ff       	jmp    80037b <vprintfmt+0x5e>
+  80042f:	89 d6                	mov    %edx,%esi
+  800431:	eb bf                	jmp    8003f2 <vprintfmt+0xd5>
+  800433:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800437:	89 d6                	mov    %edx,%esi
+  800439:	e9 3d ff ff ff       	jmp    80037b <vprintfmt+0x5e>
+  80043e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800441:	8b 45 14             	mov    0x14(%ebp),%eax
+  800444:	8d 70 04             	lea    0x4(%eax),%esi
+  800447:	83 ec 08             	sub    $0x8,%esp
+  80044a:	53                   	push   %ebx
+  80044b:	ff 30                	push   (%eax)
+  80044d:	ff d7                	call   *%edi
+  80044f:	83 c4 10             	add    $0x10,%esp
+  800452:	89 75 14             	mov    %esi,0x14(%ebp)
+  800455:	e9 d4 fe ff ff       	jmp    80032e <vprintfmt+0x11>
+  80045a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80045d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800460:	8d 70 04             	lea    0x4(%eax),%esi
+  800463:	8b 10                	mov    (%eax),%edx
+  800465:	89 d0                	mov    %edx,%eax
+  800467:	f7 d8                	neg    %eax
+  800469:	0f 48 c2             	cmovs  %edx,%eax
+  80046c:	83 f8 12             	cmp    $0x12,%eax
+  80046f:	7f 23                	jg     800494 <vprintfmt+0x177>
+  800471:	8b 14 85 e0 35 80 00 	mov    0x8035e0(,%eax,4),%edx
+  800478:	85 d2                	test   %edx,%edx
+  80047a:	74 18                	je     800494 <vprintfmt+0x177>
+  80047c:	52                   	push   %edx
+  80047d:	68 b3 37 80 00       	push   $0x8037b3
+  800482:	53                   	push   %ebx
+  800483:	57                   	push   %edi
+  800484:	e8 77 fe ff ff       	call   800300 <printfmt>
+  800489:	83 c4 10             	add    $0x10,%esp
+  80048c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80048f:	e9 9a fe ff ff       	jmp    80032e <vprintfmt+0x11>
+  800494:	50                   	push   %eax
+  800495:	68 53 33 80 00       	push   $0x803353
+  80049a:	53                   	push   %ebx
+  80049b:	57                   	push   %edi
+  80049c:	e8 5f fe ff ff       	call   800300 <printfmt>
+  8004a1:	83 c4 10             	add    $0x10,%esp
+  8004a4:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004a7:	e9 82 fe ff ff       	jmp    80032e <vprintfmt+0x11>
+  8004ac:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b2:	83 c0 04             	add    $0x4,%eax
+  8004b5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bb:	8b 00                	mov    (%eax),%eax
+  8004bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c0:	85 c0                	test   %eax,%eax
+  8004c2:	0f 84 61 03 00 00    	je     800829 <vprintfmt+0x50c>
+  8004c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004cc:	7e 06                	jle    8004d4 <vprintfmt+0x1b7>
+  8004ce:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004d2:	75 29                	jne    8004fd <vprintfmt+0x1e0>
+  8004d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004d7:	8d 70 01             	lea    0x1(%eax),%esi
+  8004da:	0f b6 00             	movzbl (%eax),%eax
+  8004dd:	0f be d0             	movsbl %al,%edx
+  8004e0:	85 d2                	test   %edx,%edx
+  8004e2:	0f 84 bb 00 00 00    	je     8005a3 <vprintfmt+0x286>
+  8004e8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004eb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004ee:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004f1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004f4:	eb 7a                	jmp    800570 <vprintfmt+0x253>
+  8004f6:	c7 45 d0 4c 33 80 00 	movl   $0x80334c,-0x30(%ebp)
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	ff 75 d4             	push   -0x2c(%ebp)
+  800503:	ff 75 d0             	push   -0x30(%ebp)
+  800506:	e8 e0 03 00 00       	call   8008eb <strnlen>
+  80050b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80050e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800511:	83 c4 10             	add    $0x10,%esp
+  800514:	85 d2                	test   %edx,%edx
+  800516:	0f 8e d6 02 00 00    	jle    8007f2 <vprintfmt+0x4d5>
+  80051c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	56                   	push   %esi
+  800525:	ff d7                	call   *%edi
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80052e:	75 f0                	jne    800520 <vprintfmt+0x203>
+  800530:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800533:	8d 70 01             	lea    0x1(%eax),%esi
+  800536:	0f b6 00             	movzbl (%eax),%eax
+  800539:	0f be d0             	movsbl %al,%edx
+  80053c:	85 d2                	test   %edx,%edx
+  80053e:	0f 84 da 02 00 00    	je     80081e <vprintfmt+0x501>
+  800544:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800547:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80054a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80054d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800550:	eb 1e                	jmp    800570 <vprintfmt+0x253>
+  800552:	83 ec 08             	sub    $0x8,%esp
+  800555:	ff 75 0c             	push   0xc(%ebp)
+  800558:	52                   	push   %edx
+  800559:	ff 55 08             	call   *0x8(%ebp)
+  80055c:	83 c4 10             	add    $0x10,%esp
+  80055f:	83 eb 01             	sub    $0x1,%ebx
+  800562:	83 c6 01             	add    $0x1,%esi
+  800565:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800569:	0f be d0             	movsbl %al,%edx
+  80056c:	85 d2                	test   %edx,%edx
+  80056e:	74 2a                	je     80059a <vprintfmt+0x27d>
+  800570:	85 ff                	test   %edi,%edi
+  800572:	78 05                	js     800579 <vprintfmt+0x25c>
+  800574:	83 ef 01             	sub    $0x1,%edi
+  800577:	78 59                	js     8005d2 <vprintfmt+0x2b5>
+  800579:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057d:	74 d3                	je     800552 <vprintfmt+0x235>
+  80057f:	0f be c0             	movsbl %al,%eax
+  800582:	83 e8 20             	sub    $0x20,%eax
+  800585:	83 f8 5e             	cmp    $0x5e,%eax
+  800588:	76 c8                	jbe    800552 <vprintfmt+0x235>
+  80058a:	83 ec 08             	sub    $0x8,%esp
+  80058d:	ff 75 0c             	push   0xc(%ebp)
+  800590:	6a 3f                	push   $0x3f
+  800592:	ff 55 08             	call   *0x8(%ebp)
+  800595:	83 c4 10             	add    $0x10,%esp
+  800598:	eb c5                	jmp    80055f <vprintfmt+0x242>
+  80059a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80059d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005a3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005a6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005aa:	7e 1b                	jle    8005c7 <vprintfmt+0x2aa>
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	53                   	push   %ebx
+  8005b0:	6a 20                	push   $0x20
+  8005b2:	ff d7                	call   *%edi
+  8005b4:	83 c4 10             	add    $0x10,%esp
+  8005b7:	83 ee 01             	sub    $0x1,%esi
+  8005ba:	75 f0                	jne    8005ac <vprintfmt+0x28f>
+  8005bc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c2:	e9 67 fd ff ff       	jmp    80032e <vprintfmt+0x11>
+  8005c7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005ca:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cd:	e9 5c fd ff ff       	jmp    80032e <vprintfmt+0x11>
+  8005d2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005db:	eb c6                	jmp    8005a3 <vprintfmt+0x286>
+  8005dd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005e0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e3:	83 f9 01             	cmp    $0x1,%ecx
+  8005e6:	7f 1f                	jg     800607 <vprintfmt+0x2ea>
+  8005e8:	85 c9                	test   %ecx,%ecx
+  8005ea:	74 67                	je     800653 <vprintfmt+0x336>
+  8005ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ef:	8b 30                	mov    (%eax),%esi
+  8005f1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005f4:	89 f0                	mov    %esi,%eax
+  8005f6:	c1 f8 1f             	sar    $0x1f,%eax
+  8005f9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+  800605:	eb 17                	jmp    80061e <vprintfmt+0x301>
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 50 04             	mov    0x4(%eax),%edx
+  80060d:	8b 00                	mov    (%eax),%eax
+  80060f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800612:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8d 40 08             	lea    0x8(%eax),%eax
+  80061b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800621:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800624:	be 0a 00 00 00       	mov    $0xa,%esi
+  800629:	85 c9                	test   %ecx,%ecx
+  80062b:	0f 89 12 01 00 00    	jns    800743 <vprintfmt+0x426>
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	53                   	push   %ebx
+  800635:	6a 2d                	push   $0x2d
+  800637:	ff d7                	call   *%edi
+  800639:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80063f:	f7 da                	neg    %edx
+  800641:	83 d1 00             	adc    $0x0,%ecx
+  800644:	f7 d9                	neg    %ecx
+  800646:	83 c4 10             	add    $0x10,%esp
+  800649:	be 0a 00 00 00       	mov    $0xa,%esi
+  80064e:	e9 f0 00 00 00       	jmp    800743 <vprintfmt+0x426>
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 30                	mov    (%eax),%esi
+  800658:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80065b:	89 f0                	mov    %esi,%eax
+  80065d:	c1 f8 1f             	sar    $0x1f,%eax
+  800660:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800663:	8b 45 14             	mov    0x14(%ebp),%eax
+  800666:	8d 40 04             	lea    0x4(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066c:	eb b0                	jmp    80061e <vprintfmt+0x301>
+  80066e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800671:	89 55 10             	mov    %edx,0x10(%ebp)
+  800674:	83 f9 01             	cmp    $0x1,%ecx
+  800677:	7f 1e                	jg     800697 <vprintfmt+0x37a>
+  800679:	85 c9                	test   %ecx,%ecx
+  80067b:	74 32                	je     8006af <vprintfmt+0x392>
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8b 10                	mov    (%eax),%edx
+  800682:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800687:	8d 40 04             	lea    0x4(%eax),%eax
+  80068a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800692:	e9 ac 00 00 00       	jmp    800743 <vprintfmt+0x426>
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 10                	mov    (%eax),%edx
+  80069c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80069f:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006aa:	e9 94 00 00 00       	jmp    800743 <vprintfmt+0x426>
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8b 10                	mov    (%eax),%edx
+  8006b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bf:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006c4:	eb 7d                	jmp    800743 <vprintfmt+0x426>
+  8006c6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006c9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006cc:	83 f9 01             	cmp    $0x1,%ecx
+  8006cf:	7f 1b                	jg     8006ec <vprintfmt+0x3cf>
+  8006d1:	85 c9                	test   %ecx,%ecx
+  8006d3:	74 2c                	je     800701 <vprintfmt+0x3e4>
+  8006d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d8:	8b 10                	mov    (%eax),%edx
+  8006da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006df:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e5:	be 08 00 00 00       	mov    $0x8,%esi
+  8006ea:	eb 57                	jmp    800743 <vprintfmt+0x426>
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8b 10                	mov    (%eax),%edx
+  8006f1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fa:	be 08 00 00 00       	mov    $0x8,%esi
+  8006ff:	eb 42                	jmp    800743 <vprintfmt+0x426>
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 10                	mov    (%eax),%edx
+  800706:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070b:	8d 40 04             	lea    0x4(%eax),%eax
+  80070e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800711:	be 08 00 00 00       	mov    $0x8,%esi
+  800716:	eb 2b                	jmp    800743 <vprintfmt+0x426>
+  800718:	89 55 10             	mov    %edx,0x10(%ebp)
+  80071b:	83 ec 08             	sub    $0x8,%esp
+  80071e:	53                   	push   %ebx
+  80071f:	6a 30                	push   $0x30
+  800721:	ff d7                	call   *%edi
+  800723:	83 c4 08             	add    $0x8,%esp
+  800726:	53                   	push   %ebx
+  800727:	6a 78                	push   $0x78
+  800729:	ff d7                	call   *%edi
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 10                	mov    (%eax),%edx
+  800730:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073e:	be 10 00 00 00       	mov    $0x10,%esi
+  800743:	83 ec 0c             	sub    $0xc,%esp
+  800746:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80074a:	50                   	push   %eax
+  80074b:	ff 75 e4             	push   -0x1c(%ebp)
+  80074e:	56                   	push   %esi
+  80074f:	51                   	push   %ecx
+  800750:	52                   	push   %edx
+  800751:	89 da                	mov    %ebx,%edx
+  800753:	89 f8                	mov    %edi,%eax
+  800755:	e8 d8 fa ff ff       	call   800232 <printnum>
+  80075a:	83 c4 20             	add    $0x20,%esp
+  80075d:	e9 cc fb ff ff       	jmp    80032e <vprintfmt+0x11>
+  800762:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800765:	89 55 10             	mov    %edx,0x10(%ebp)
+  800768:	83 f9 01             	cmp    $0x1,%ecx
+  80076b:	7f 1b                	jg     800788 <vprintfmt+0x46b>
+  80076d:	85 c9                	test   %ecx,%ecx
+  80076f:	74 2c                	je     80079d <vprintfmt+0x480>
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 10                	mov    (%eax),%edx
+  800776:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077b:	8d 40 04             	lea    0x4(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800781:	be 10 00 00 00       	mov    $0x10,%esi
+  800786:	eb bb                	jmp    800743 <vprintfmt+0x426>
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8b 10                	mov    (%eax),%edx
+  80078d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800790:	8d 40 08             	lea    0x8(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+  800796:	be 10 00 00 00       	mov    $0x10,%esi
+  80079b:	eb a6                	jmp    800743 <vprintfmt+0x426>
+  80079d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a0:	8b 10                	mov    (%eax),%edx
+  8007a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ad:	be 10 00 00 00       	mov    $0x10,%esi
+  8007b2:	eb 8f                	jmp    800743 <vprintfmt+0x426>
+  8007b4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007b7:	83 ec 08             	sub    $0x8,%esp
+  8007ba:	53                   	push   %ebx
+  8007bb:	6a 25                	push   $0x25
+  8007bd:	ff d7                	call   *%edi
+  8007bf:	83 c4 10             	add    $0x10,%esp
+  8007c2:	e9 67 fb ff ff       	jmp    80032e <vprintfmt+0x11>
+  8007c7:	83 ec 08             	sub    $0x8,%esp
+  8007ca:	53                   	push   %ebx
+  8007cb:	6a 25                	push   $0x25
+  8007cd:	ff d7                	call   *%edi
+  8007cf:	83 c4 10             	add    $0x10,%esp
+  8007d2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007d6:	0f 84 ba fb ff ff    	je     800396 <vprintfmt+0x79>
+  8007dc:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007df:	89 f0                	mov    %esi,%eax
+  8007e1:	83 e8 01             	sub    $0x1,%eax
+  8007e4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007e8:	75 f7                	jne    8007e1 <vprintfmt+0x4c4>
+  8007ea:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007ed:	e9 3c fb ff ff       	jmp    80032e <vprintfmt+0x11>
+  8007f2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007f5:	8d 70 01             	lea    0x1(%eax),%esi
+  8007f8:	0f b6 00             	movzbl (%eax),%eax
+  8007fb:	0f be d0             	movsbl %al,%edx
+  8007fe:	85 d2                	test   %edx,%edx
+  800800:	74 11                	je     800813 <vprintfmt+0x4f6>
+  800802:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800805:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800808:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80080b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80080e:	e9 5d fd ff ff       	jmp    800570 <vprintfmt+0x253>
+  800813:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800816:	89 45 14             	mov    %eax,0x14(%ebp)
+  800819:	e9 10 fb ff ff       	jmp    80032e <vprintfmt+0x11>
+  80081e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800821:	89 45 14             	mov    %eax,0x14(%ebp)
+  800824:	e9 05 fb ff ff       	jmp    80032e <vprintfmt+0x11>
+  800829:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80082d:	7e 0a                	jle    800839 <vprintfmt+0x51c>
+  80082f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800833:	0f 85 bd fc ff ff    	jne    8004f6 <vprintfmt+0x1d9>
+  800839:	ba 28 00 00 00       	mov    $0x28,%edx
+  80083e:	b8 28 00 00 00       	mov    $0x28,%eax
+  800843:	be 4d 33 80 00       	mov    $0x80334d,%esi
+  800848:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80084b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80084e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800851:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800854:	e9 17 fd ff ff       	jmp    800570 <vprintfmt+0x253>
+  800859:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085c:	5b                   	pop    %ebx
+  80085d:	5e                   	pop    %esi
+  80085e:	5f                   	pop    %edi
+  80085f:	5d                   	pop    %ebp
+  800860:	c3                   	ret
+
+00800861 <vsnprintf>:
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	83 ec 18             	sub    $0x18,%esp
+  800867:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80086d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800870:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800874:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800877:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80087e:	85 c0                	test   %eax,%eax
+  800880:	74 26                	je     8008a8 <vsnprintf+0x47>
+  800882:	85 d2                	test   %edx,%edx
+  800884:	7e 22                	jle    8008a8 <vsnprintf+0x47>
+  800886:	ff 75 14             	push   0x14(%ebp)
+  800889:	ff 75 10             	push   0x10(%ebp)
+  80088c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80088f:	50                   	push   %eax
+  800890:	68 e3 02 80 00       	push   $0x8002e3
+  800895:	e8 83 fa ff ff       	call   80031d <vprintfmt>
+  80089a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80089d:	c6 00 00             	movb   $0x0,(%eax)
+  8008a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a3:	83 c4 10             	add    $0x10,%esp
+  8008a6:	c9                   	leave
+  8008a7:	c3                   	ret
+  8008a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008ad:	eb f7                	jmp    8008a6 <vsnprintf+0x45>
+
+008008af <snprintf>:
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	83 ec 08             	sub    $0x8,%esp
+  8008b5:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008b8:	50                   	push   %eax
+  8008b9:	ff 75 10             	push   0x10(%ebp)
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	ff 75 08             	push   0x8(%ebp)
+  8008c2:	e8 9a ff ff ff       	call   800861 <vsnprintf>
+  8008c7:	c9                   	leave
+  8008c8:	c3                   	ret
+
+008008c9 <strlen>:
+  8008c9:	55                   	push   %ebp
+  8008ca:	89 e5                	mov    %esp,%ebp
+  8008cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008cf:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008d2:	74 10                	je     8008e4 <strlen+0x1b>
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	83 c0 01             	add    $0x1,%eax
+  8008dc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008e0:	75 f7                	jne    8008d9 <strlen+0x10>
+  8008e2:	5d                   	pop    %ebp
+  8008e3:	c3                   	ret
+  8008e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e9:	eb f7                	jmp    8008e2 <strlen+0x19>
+
+008008eb <strnlen>:
+  8008eb:	55                   	push   %ebp
+  8008ec:	89 e5                	mov    %esp,%ebp
+  8008ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f4:	85 d2                	test   %edx,%edx
+  8008f6:	74 16                	je     80090e <strnlen+0x23>
+  8008f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800901:	74 09                	je     80090c <strnlen+0x21>
+  800903:	83 c0 01             	add    $0x1,%eax
+  800906:	39 d0                	cmp    %edx,%eax
+  800908:	75 f3                	jne    8008fd <strnlen+0x12>
+  80090a:	89 d0                	mov    %edx,%eax
+  80090c:	5d                   	pop    %ebp
+  80090d:	c3                   	ret
+  80090e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800913:	eb f7                	jmp    80090c <strnlen+0x21>
+
+00800915 <strcpy>:
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	53                   	push   %ebx
+  800919:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80091f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800924:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800928:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80092b:	83 c0 01             	add    $0x1,%eax
+  80092e:	84 d2                	test   %dl,%dl
+  800930:	75 f2                	jne    800924 <strcpy+0xf>
+  800932:	89 c8                	mov    %ecx,%eax
+  800934:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800937:	c9                   	leave
+  800938:	c3                   	ret
+
+00800939 <strcat>:
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	53                   	push   %ebx
+  80093d:	83 ec 10             	sub    $0x10,%esp
+  800940:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800943:	53                   	push   %ebx
+  800944:	e8 80 ff ff ff       	call   8008c9 <strlen>
+  800949:	83 c4 08             	add    $0x8,%esp
+  80094c:	ff 75 0c             	push   0xc(%ebp)
+  80094f:	01 d8                	add    %ebx,%eax
+  800951:	50                   	push   %eax
+  800952:	e8 be ff ff ff       	call   800915 <strcpy>
+  800957:	89 d8                	mov    %ebx,%eax
+  800959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095c:	c9                   	leave
+  80095d:	c3                   	ret
+
+0080095e <strncpy>:
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	56                   	push   %esi
+  800962:	53                   	push   %ebx
+  800963:	8b 75 08             	mov    0x8(%ebp),%esi
+  800966:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800969:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80096c:	85 db                	test   %ebx,%ebx
+  80096e:	74 17                	je     800987 <strncpy+0x29>
+  800970:	01 f3                	add    %esi,%ebx
+  800972:	89 f0                	mov    %esi,%eax
+  800974:	83 c0 01             	add    $0x1,%eax
+  800977:	0f b6 0a             	movzbl (%edx),%ecx
+  80097a:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80097d:	80 f9 01             	cmp    $0x1,%cl
+  800980:	83 da ff             	sbb    $0xffffffff,%edx
+  800983:	39 c3                	cmp    %eax,%ebx
+  800985:	75 ed                	jne    800974 <strncpy+0x16>
+  800987:	89 f0                	mov    %esi,%eax
+  800989:	5b                   	pop    %ebx
+  80098a:	5e                   	pop    %esi
+  80098b:	5d                   	pop    %ebp
+  80098c:	c3                   	ret
+
+0080098d <strlcpy>:
+  80098d:	55                   	push   %ebp
+  80098e:	89 e5                	mov    %esp,%ebp
+  800990:	56                   	push   %esi
+  800991:	53                   	push   %ebx
+  800992:	8b 75 08             	mov    0x8(%ebp),%esi
+  800995:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800998:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80099b:	89 f0                	mov    %esi,%eax
+  80099d:	85 db                	test   %ebx,%ebx
+  80099f:	74 1e                	je     8009bf <strlcpy+0x32>
+  8009a1:	83 eb 01             	sub    $0x1,%ebx
+  8009a4:	74 16                	je     8009bc <strlcpy+0x2f>
+  8009a6:	01 f3                	add    %esi,%ebx
+  8009a8:	0f b6 0a             	movzbl (%edx),%ecx
+  8009ab:	84 c9                	test   %cl,%cl
+  8009ad:	74 0d                	je     8009bc <strlcpy+0x2f>
+  8009af:	83 c2 01             	add    $0x1,%edx
+  8009b2:	83 c0 01             	add    $0x1,%eax
+  8009b5:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009b8:	39 d8                	cmp    %ebx,%eax
+  8009ba:	75 ec                	jne    8009a8 <strlcpy+0x1b>
+  8009bc:	c6 00 00             	movb   $0x0,(%eax)
+  8009bf:	29 f0                	sub    %esi,%eax
+  8009c1:	5b                   	pop    %ebx
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+
+008009c5 <strcmp>:
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ce:	0f b6 01             	movzbl (%ecx),%eax
+  8009d1:	84 c0                	test   %al,%al
+  8009d3:	74 11                	je     8009e6 <strcmp+0x21>
+  8009d5:	38 02                	cmp    %al,(%edx)
+  8009d7:	75 0d                	jne    8009e6 <strcmp+0x21>
+  8009d9:	83 c1 01             	add    $0x1,%ecx
+  8009dc:	83 c2 01             	add    $0x1,%edx
+  8009df:	0f b6 01             	movzbl (%ecx),%eax
+  8009e2:	84 c0                	test   %al,%al
+  8009e4:	75 ef                	jne    8009d5 <strcmp+0x10>
+  8009e6:	0f b6 c0             	movzbl %al,%eax
+  8009e9:	0f b6 12             	movzbl (%edx),%edx
+  8009ec:	29 d0                	sub    %edx,%eax
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+
+008009f0 <strncmp>:
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	53                   	push   %ebx
+  8009f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009fa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	85 d2                	test   %edx,%edx
+  800a04:	74 2e                	je     800a34 <strncmp+0x44>
+  800a06:	0f b6 01             	movzbl (%ecx),%eax
+  800a09:	84 c0                	test   %al,%al
+  800a0b:	74 16                	je     800a23 <strncmp+0x33>
+  800a0d:	3a 03                	cmp    (%ebx),%al
+  800a0f:	75 12                	jne    800a23 <strncmp+0x33>
+  800a11:	83 c1 01             	add    $0x1,%ecx
+  800a14:	83 c3 01             	add    $0x1,%ebx
+  800a17:	83 ea 01             	sub    $0x1,%edx
+  800a1a:	75 ea                	jne    800a06 <strncmp+0x16>
+  800a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a21:	eb 11                	jmp    800a34 <strncmp+0x44>
+  800a23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a28:	85 d2                	test   %edx,%edx
+  800a2a:	74 08                	je     800a34 <strncmp+0x44>
+  800a2c:	0f b6 01             	movzbl (%ecx),%eax
+  800a2f:	0f b6 13             	movzbl (%ebx),%edx
+  800a32:	29 d0                	sub    %edx,%eax
+  800a34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a37:	c9                   	leave
+  800a38:	c3                   	ret
+
+00800a39 <strchr>:
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a43:	0f b6 10             	movzbl (%eax),%edx
+  800a46:	84 d2                	test   %dl,%dl
+  800a48:	74 15                	je     800a5f <strchr+0x26>
+  800a4a:	38 d1                	cmp    %dl,%cl
+  800a4c:	74 0f                	je     800a5d <strchr+0x24>
+  800a4e:	83 c0 01             	add    $0x1,%eax
+  800a51:	0f b6 10             	movzbl (%eax),%edx
+  800a54:	84 d2                	test   %dl,%dl
+  800a56:	75 f2                	jne    800a4a <strchr+0x11>
+  800a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5d:	5d                   	pop    %ebp
+  800a5e:	c3                   	ret
+  800a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a64:	eb f7                	jmp    800a5d <strchr+0x24>
+
+00800a66 <strfind>:
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	53                   	push   %ebx
+  800a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a70:	0f b6 18             	movzbl (%eax),%ebx
+  800a73:	38 d3                	cmp    %dl,%bl
+  800a75:	74 14                	je     800a8b <strfind+0x25>
+  800a77:	89 d1                	mov    %edx,%ecx
+  800a79:	84 db                	test   %bl,%bl
+  800a7b:	74 0e                	je     800a8b <strfind+0x25>
+  800a7d:	83 c0 01             	add    $0x1,%eax
+  800a80:	0f b6 10             	movzbl (%eax),%edx
+  800a83:	38 ca                	cmp    %cl,%dl
+  800a85:	74 04                	je     800a8b <strfind+0x25>
+  800a87:	84 d2                	test   %dl,%dl
+  800a89:	75 f2                	jne    800a7d <strfind+0x17>
+  800a8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8e:	c9                   	leave
+  800a8f:	c3                   	ret
+
+00800a90 <memset>:
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	57                   	push   %edi
+  800a94:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a9a:	85 c9                	test   %ecx,%ecx
+  800a9c:	74 20                	je     800abe <memset+0x2e>
+  800a9e:	89 f8                	mov    %edi,%eax
+  800aa0:	09 c8                	or     %ecx,%eax
+  800aa2:	a8 03                	test   $0x3,%al
+  800aa4:	75 12                	jne    800ab8 <memset+0x28>
+  800aa6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aaa:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ab0:	c1 e9 02             	shr    $0x2,%ecx
+  800ab3:	fc                   	cld
+  800ab4:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ab6:	eb 06                	jmp    800abe <memset+0x2e>
+  800ab8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800abb:	fc                   	cld
+  800abc:	f3 aa                	rep stos %al,%es:(%edi)
+  800abe:	89 f8                	mov    %edi,%eax
+  800ac0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ac3:	c9                   	leave
+  800ac4:	c3                   	ret
+
+00800ac5 <memmove>:
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	57                   	push   %edi
+  800ac9:	56                   	push   %esi
+  800aca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ad0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ad3:	39 c6                	cmp    %eax,%esi
+  800ad5:	73 32                	jae    800b09 <memmove+0x44>
+  800ad7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ada:	39 d0                	cmp    %edx,%eax
+  800adc:	73 2b                	jae    800b09 <memmove+0x44>
+  800ade:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800ae1:	89 d6                	mov    %edx,%esi
+  800ae3:	09 fe                	or     %edi,%esi
+  800ae5:	09 ce                	or     %ecx,%esi
+  800ae7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aed:	75 0e                	jne    800afd <memmove+0x38>
+  800aef:	83 ef 04             	sub    $0x4,%edi
+  800af2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800af5:	c1 e9 02             	shr    $0x2,%ecx
+  800af8:	fd                   	std
+  800af9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800afb:	eb 09                	jmp    800b06 <memmove+0x41>
+  800afd:	83 ef 01             	sub    $0x1,%edi
+  800b00:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b03:	fd                   	std
+  800b04:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b06:	fc                   	cld
+  800b07:	eb 1a                	jmp    800b23 <memmove+0x5e>
+  800b09:	89 f2                	mov    %esi,%edx
+  800b0b:	09 c2                	or     %eax,%edx
+  800b0d:	09 ca                	or     %ecx,%edx
+  800b0f:	f6 c2 03             	test   $0x3,%dl
+  800b12:	75 0a                	jne    800b1e <memmove+0x59>
+  800b14:	c1 e9 02             	shr    $0x2,%ecx
+  800b17:	89 c7                	mov    %eax,%edi
+  800b19:	fc                   	cld
+  800b1a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b1c:	eb 05                	jmp    800b23 <memmove+0x5e>
+  800b1e:	89 c7                	mov    %eax,%edi
+  800b20:	fc                   	cld
+  800b21:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b23:	5e                   	pop    %esi
+  800b24:	5f                   	pop    %edi
+  800b25:	5d                   	pop    %ebp
+  800b26:	c3                   	ret
+
+00800b27 <memcpy>:
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	83 ec 0c             	sub    $0xc,%esp
+  800b2d:	ff 75 10             	push   0x10(%ebp)
+  800b30:	ff 75 0c             	push   0xc(%ebp)
+  800b33:	ff 75 08             	push   0x8(%ebp)
+  800b36:	e8 8a ff ff ff       	call   800ac5 <memmove>
+  800b3b:	c9                   	leave
+  800b3c:	c3                   	ret
+
+00800b3d <memcmp>:
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	56                   	push   %esi
+  800b41:	53                   	push   %ebx
+  800b42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b48:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b4b:	85 f6                	test   %esi,%esi
+  800b4d:	74 29                	je     800b78 <memcmp+0x3b>
+  800b4f:	01 c6                	add    %eax,%esi
+  800b51:	0f b6 08             	movzbl (%eax),%ecx
+  800b54:	0f b6 1a             	movzbl (%edx),%ebx
+  800b57:	38 d9                	cmp    %bl,%cl
+  800b59:	75 11                	jne    800b6c <memcmp+0x2f>
+  800b5b:	83 c0 01             	add    $0x1,%eax
+  800b5e:	83 c2 01             	add    $0x1,%edx
+  800b61:	39 c6                	cmp    %eax,%esi
+  800b63:	75 ec                	jne    800b51 <memcmp+0x14>
+  800b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6a:	eb 08                	jmp    800b74 <memcmp+0x37>
+  800b6c:	0f b6 c1             	movzbl %cl,%eax
+  800b6f:	0f b6 db             	movzbl %bl,%ebx
+  800b72:	29 d8                	sub    %ebx,%eax
+  800b74:	5b                   	pop    %ebx
+  800b75:	5e                   	pop    %esi
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+  800b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7d:	eb f5                	jmp    800b74 <memcmp+0x37>
+
+00800b7f <memfind>:
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b88:	89 c2                	mov    %eax,%edx
+  800b8a:	03 55 10             	add    0x10(%ebp),%edx
+  800b8d:	39 d0                	cmp    %edx,%eax
+  800b8f:	73 0d                	jae    800b9e <memfind+0x1f>
+  800b91:	38 08                	cmp    %cl,(%eax)
+  800b93:	74 0d                	je     800ba2 <memfind+0x23>
+  800b95:	83 c0 01             	add    $0x1,%eax
+  800b98:	39 c2                	cmp    %eax,%edx
+  800b9a:	75 f5                	jne    800b91 <memfind+0x12>
+  800b9c:	eb 06                	jmp    800ba4 <memfind+0x25>
+  800b9e:	89 c2                	mov    %eax,%edx
+  800ba0:	eb 02                	jmp    800ba4 <memfind+0x25>
+  800ba2:	89 c2                	mov    %eax,%edx
+  800ba4:	89 d0                	mov    %edx,%eax
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	c3                   	ret
+
+00800ba8 <strtol>:
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	57                   	push   %edi
+  800bac:	56                   	push   %esi
+  800bad:	53                   	push   %ebx
+  800bae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb4:	0f b6 02             	movzbl (%edx),%eax
+  800bb7:	3c 20                	cmp    $0x20,%al
+  800bb9:	74 04                	je     800bbf <strtol+0x17>
+  800bbb:	3c 09                	cmp    $0x9,%al
+  800bbd:	75 0e                	jne    800bcd <strtol+0x25>
+  800bbf:	83 c2 01             	add    $0x1,%edx
+  800bc2:	0f b6 02             	movzbl (%edx),%eax
+  800bc5:	3c 20                	cmp    $0x20,%al
+  800bc7:	74 f6                	je     800bbf <strtol+0x17>
+  800bc9:	3c 09                	cmp    $0x9,%al
+  800bcb:	74 f2                	je     800bbf <strtol+0x17>
+  800bcd:	3c 2b                	cmp    $0x2b,%al
+  800bcf:	74 2a                	je     800bfb <strtol+0x53>
+  800bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd6:	3c 2d                	cmp    $0x2d,%al
+  800bd8:	74 2b                	je     800c05 <strtol+0x5d>
+  800bda:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800be0:	75 0f                	jne    800bf1 <strtol+0x49>
+  800be2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be5:	74 28                	je     800c0f <strtol+0x67>
+  800be7:	85 db                	test   %ebx,%ebx
+  800be9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bee:	0f 44 d8             	cmove  %eax,%ebx
+  800bf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bf9:	eb 46                	jmp    800c41 <strtol+0x99>
+  800bfb:	83 c2 01             	add    $0x1,%edx
+  800bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c03:	eb d5                	jmp    800bda <strtol+0x32>
+  800c05:	83 c2 01             	add    $0x1,%edx
+  800c08:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c0d:	eb cb                	jmp    800bda <strtol+0x32>
+  800c0f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c13:	74 0e                	je     800c23 <strtol+0x7b>
+  800c15:	85 db                	test   %ebx,%ebx
+  800c17:	75 d8                	jne    800bf1 <strtol+0x49>
+  800c19:	83 c2 01             	add    $0x1,%edx
+  800c1c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c21:	eb ce                	jmp    800bf1 <strtol+0x49>
+  800c23:	83 c2 02             	add    $0x2,%edx
+  800c26:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c2b:	eb c4                	jmp    800bf1 <strtol+0x49>
+  800c2d:	0f be c0             	movsbl %al,%eax
+  800c30:	83 e8 30             	sub    $0x30,%eax
+  800c33:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c36:	7d 3a                	jge    800c72 <strtol+0xca>
+  800c38:	83 c2 01             	add    $0x1,%edx
+  800c3b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c3f:	01 c1                	add    %eax,%ecx
+  800c41:	0f b6 02             	movzbl (%edx),%eax
+  800c44:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c47:	89 f3                	mov    %esi,%ebx
+  800c49:	80 fb 09             	cmp    $0x9,%bl
+  800c4c:	76 df                	jbe    800c2d <strtol+0x85>
+  800c4e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c51:	89 f3                	mov    %esi,%ebx
+  800c53:	80 fb 19             	cmp    $0x19,%bl
+  800c56:	77 08                	ja     800c60 <strtol+0xb8>
+  800c58:	0f be c0             	movsbl %al,%eax
+  800c5b:	83 e8 57             	sub    $0x57,%eax
+  800c5e:	eb d3                	jmp    800c33 <strtol+0x8b>
+  800c60:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c63:	89 f3                	mov    %esi,%ebx
+  800c65:	80 fb 19             	cmp    $0x19,%bl
+  800c68:	77 08                	ja     800c72 <strtol+0xca>
+  800c6a:	0f be c0             	movsbl %al,%eax
+  800c6d:	83 e8 37             	sub    $0x37,%eax
+  800c70:	eb c1                	jmp    800c33 <strtol+0x8b>
+  800c72:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c76:	74 05                	je     800c7d <strtol+0xd5>
+  800c78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7b:	89 10                	mov    %edx,(%eax)
+  800c7d:	89 c8                	mov    %ecx,%eax
+  800c7f:	f7 d8                	neg    %eax
+  800c81:	85 ff                	test   %edi,%edi
+  800c83:	0f 45 c8             	cmovne %eax,%ecx
+  800c86:	89 c8                	mov    %ecx,%eax
+  800c88:	5b                   	pop    %ebx
+  800c89:	5e                   	pop    %esi
+  800c8a:	5f                   	pop    %edi
+  800c8b:	5d                   	pop    %ebp
+  800c8c:	c3                   	ret
+
+00800c8d <sys_cputs>:
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	57                   	push   %edi
+  800c91:	56                   	push   %esi
+  800c92:	53                   	push   %ebx
+  800c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9e:	89 c3                	mov    %eax,%ebx
+  800ca0:	89 c7                	mov    %eax,%edi
+  800ca2:	89 c6                	mov    %eax,%esi
+  800ca4:	cd 30                	int    $0x30
+  800ca6:	5b                   	pop    %ebx
+  800ca7:	5e                   	pop    %esi
+  800ca8:	5f                   	pop    %edi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+
+00800cab <sys_cgetc>:
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	57                   	push   %edi
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+  800cb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbb:	89 d1                	mov    %edx,%ecx
+  800cbd:	89 d3                	mov    %edx,%ebx
+  800cbf:	89 d7                	mov    %edx,%edi
+  800cc1:	89 d6                	mov    %edx,%esi
+  800cc3:	cd 30                	int    $0x30
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+
+00800cca <sys_env_destroy>:
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  800cd0:	83 ec 0c             	sub    $0xc,%esp
+  800cd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce0:	89 cb                	mov    %ecx,%ebx
+  800ce2:	89 cf                	mov    %ecx,%edi
+  800ce4:	89 ce                	mov    %ecx,%esi
+  800ce6:	cd 30                	int    $0x30
+  800ce8:	85 c0                	test   %eax,%eax
+  800cea:	7f 08                	jg     800cf4 <sys_env_destroy+0x2a>
+  800cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+  800cf4:	83 ec 0c             	sub    $0xc,%esp
+  800cf7:	50                   	push   %eax
+  800cf8:	6a 03                	push   $0x3
+  800cfa:	68 4b 36 80 00       	push   $0x80364b
+  800cff:	6a 24                	push   $0x24
+  800d01:	68 68 36 80 00       	push   $0x803668
+  800d06:	e8 38 f4 ff ff       	call   800143 <_panic>
+
+00800d0b <sys_getenvid>:
+  800d0b:	55                   	push   %ebp
+  800d0c:	89 e5                	mov    %esp,%ebp
+  800d0e:	57                   	push   %edi
+  800d0f:	56                   	push   %esi
+  800d10:	53                   	push   %ebx
+  800d11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d16:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d1b:	89 d1                	mov    %edx,%ecx
+  800d1d:	89 d3                	mov    %edx,%ebx
+  800d1f:	89 d7                	mov    %edx,%edi
+  800d21:	89 d6                	mov    %edx,%esi
+  800d23:	cd 30                	int    $0x30
+  800d25:	5b                   	pop    %ebx
+  800d26:	5e                   	pop    %esi
+  800d27:	5f                   	pop    %edi
+  800d28:	5d                   	pop    %ebp
+  800d29:	c3                   	ret
+
+00800d2a <sys_yield>:
+  800d2a:	55                   	push   %ebp
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	57                   	push   %edi
+  800d2e:	56                   	push   %esi
+  800d2f:	53                   	push   %ebx
+  800d30:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d37:	74 26                	je     800d5f <sys_yield+0x35>
+  800d39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d43:	89 d1                	mov    %edx,%ecx
+  800d45:	89 d3                	mov    %edx,%ebx
+  800d47:	89 d7                	mov    %edx,%edi
+  800d49:	6a 00                	push   $0x0
+  800d4b:	55                   	push   %ebp
+  800d4c:	89 e5                	mov    %esp,%ebp
+  800d4e:	8d 35 56 0d 80 00    	lea    0x800d56,%esi
+  800d54:	0f 34                	sysenter
+  800d56:	5d                   	pop    %ebp
+  800d57:	83 c4 04             	add    $0x4,%esp
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+  800d5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d64:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d69:	89 d1                	mov    %edx,%ecx
+  800d6b:	89 d3                	mov    %edx,%ebx
+  800d6d:	89 d7                	mov    %edx,%edi
+  800d6f:	89 d6                	mov    %edx,%esi
+  800d71:	cd 30                	int    $0x30
+  800d73:	eb e5                	jmp    800d5a <sys_yield+0x30>
+
+00800d75 <sys_page_alloc>:
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+  800d7b:	83 ec 0c             	sub    $0xc,%esp
+  800d7e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d89:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d91:	89 f7                	mov    %esi,%edi
+  800d93:	cd 30                	int    $0x30
+  800d95:	85 c0                	test   %eax,%eax
+  800d97:	7f 08                	jg     800da1 <sys_page_alloc+0x2c>
+  800d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9c:	5b                   	pop    %ebx
+  800d9d:	5e                   	pop    %esi
+  800d9e:	5f                   	pop    %edi
+  800d9f:	5d                   	pop    %ebp
+  800da0:	c3                   	ret
+  800da1:	83 ec 0c             	sub    $0xc,%esp
+  800da4:	50                   	push   %eax
+  800da5:	6a 04                	push   $0x4
+  800da7:	68 4b 36 80 00       	push   $0x80364b
+  800dac:	6a 24                	push   $0x24
+  800dae:	68 68 36 80 00       	push   $0x803668
+  800db3:	e8 8b f3 ff ff       	call   800143 <_panic>
+
+00800db8 <sys_page_map>:
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  800dc1:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800dc8:	74 33                	je     800dfd <sys_page_map+0x45>
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddb:	ff 75 18             	push   0x18(%ebp)
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	8d 35 e9 0d 80 00    	lea    0x800de9,%esi
+  800de7:	0f 34                	sysenter
+  800de9:	5d                   	pop    %ebp
+  800dea:	83 c4 04             	add    $0x4,%esp
+  800ded:	89 c2                	mov    %eax,%edx
+  800def:	85 c0                	test   %eax,%eax
+  800df1:	7f 3d                	jg     800e30 <sys_page_map+0x78>
+  800df3:	89 d0                	mov    %edx,%eax
+  800df5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df8:	5b                   	pop    %ebx
+  800df9:	5e                   	pop    %esi
+  800dfa:	5f                   	pop    %edi
+  800dfb:	5d                   	pop    %ebp
+  800dfc:	c3                   	ret
+  800dfd:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e0e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e11:	cd 30                	int    $0x30
+  800e13:	89 c2                	mov    %eax,%edx
+  800e15:	85 c0                	test   %eax,%eax
+  800e17:	7e da                	jle    800df3 <sys_page_map+0x3b>
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  800e1c:	50                   	push   %eax
+  800e1d:	6a 05                	push   $0x5
+  800e1f:	68 4b 36 80 00       	push   $0x80364b
+  800e24:	6a 24                	push   $0x24
+  800e26:	68 68 36 80 00       	push   $0x803668
+  800e2b:	e8 13 f3 ff ff       	call   800143 <_panic>
+  800e30:	83 ec 0c             	sub    $0xc,%esp
+  800e33:	50                   	push   %eax
+  800e34:	6a 05                	push   $0x5
+  800e36:	68 4b 36 80 00       	push   $0x80364b
+  800e3b:	6a 48                	push   $0x48
+  800e3d:	68 68 36 80 00       	push   $0x803668
+  800e42:	e8 fc f2 ff ff       	call   800143 <_panic>
+
+00800e47 <sys_page_unmap>:
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	56                   	push   %esi
+  800e4c:	53                   	push   %ebx
+  800e4d:	83 ec 0c             	sub    $0xc,%esp
+  800e50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e60:	89 df                	mov    %ebx,%edi
+  800e62:	89 de                	mov    %ebx,%esi
+  800e64:	cd 30                	int    $0x30
+  800e66:	85 c0                	test   %eax,%eax
+  800e68:	7f 08                	jg     800e72 <sys_page_unmap+0x2b>
+  800e6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6d:	5b                   	pop    %ebx
+  800e6e:	5e                   	pop    %esi
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+  800e72:	83 ec 0c             	sub    $0xc,%esp
+  800e75:	50                   	push   %eax
+  800e76:	6a 06                	push   $0x6
+  800e78:	68 4b 36 80 00       	push   $0x80364b
+  800e7d:	6a 24                	push   $0x24
+  800e7f:	68 68 36 80 00       	push   $0x803668
+  800e84:	e8 ba f2 ff ff       	call   800143 <_panic>
+
+00800e89 <sys_fork>:
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+  800e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e94:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e99:	89 d1                	mov    %edx,%ecx
+  800e9b:	89 d3                	mov    %edx,%ebx
+  800e9d:	89 d7                	mov    %edx,%edi
+  800e9f:	89 d6                	mov    %edx,%esi
+  800ea1:	cd 30                	int    $0x30
+  800ea3:	5b                   	pop    %ebx
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+
+00800ea8 <sys_env_set_status>:
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	57                   	push   %edi
+  800eac:	56                   	push   %esi
+  800ead:	53                   	push   %ebx
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec1:	89 df                	mov    %ebx,%edi
+  800ec3:	89 de                	mov    %ebx,%esi
+  800ec5:	cd 30                	int    $0x30
+  800ec7:	85 c0                	test   %eax,%eax
+  800ec9:	7f 08                	jg     800ed3 <sys_env_set_status+0x2b>
+  800ecb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ece:	5b                   	pop    %ebx
+  800ecf:	5e                   	pop    %esi
+  800ed0:	5f                   	pop    %edi
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	c3                   	ret
+  800ed3:	83 ec 0c             	sub    $0xc,%esp
+  800ed6:	50                   	push   %eax
+  800ed7:	6a 08                	push   $0x8
+  800ed9:	68 4b 36 80 00       	push   $0x80364b
+  800ede:	6a 24                	push   $0x24
+  800ee0:	68 68 36 80 00       	push   $0x803668
+  800ee5:	e8 59 f2 ff ff       	call   800143 <_panic>
+
+00800eea <sys_env_set_trapframe>:
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	57                   	push   %edi
+  800eee:	56                   	push   %esi
+  800eef:	53                   	push   %ebx
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efe:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f03:	89 df                	mov    %ebx,%edi
+  800f05:	89 de                	mov    %ebx,%esi
+  800f07:	cd 30                	int    $0x30
+  800f09:	85 c0                	test   %eax,%eax
+  800f0b:	7f 08                	jg     800f15 <sys_env_set_trapframe+0x2b>
+  800f0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+  800f18:	50                   	push   %eax
+  800f19:	6a 09                	push   $0x9
+  800f1b:	68 4b 36 80 00       	push   $0x80364b
+  800f20:	6a 24                	push   $0x24
+  800f22:	68 68 36 80 00       	push   $0x803668
+  800f27:	e8 17 f2 ff ff       	call   800143 <_panic>
+
+00800f2c <sys_env_set_cow>:
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	57                   	push   %edi
+  800f30:	56                   	push   %esi
+  800f31:	53                   	push   %ebx
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f40:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f45:	89 df                	mov    %ebx,%edi
+  800f47:	89 de                	mov    %ebx,%esi
+  800f49:	cd 30                	int    $0x30
+  800f4b:	85 c0                	test   %eax,%eax
+  800f4d:	7f 08                	jg     800f57 <sys_env_set_cow+0x2b>
+  800f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f52:	5b                   	pop    %ebx
+  800f53:	5e                   	pop    %esi
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+  800f57:	83 ec 0c             	sub    $0xc,%esp
+  800f5a:	50                   	push   %eax
+  800f5b:	6a 20                	push   $0x20
+  800f5d:	68 4b 36 80 00       	push   $0x80364b
+  800f62:	6a 24                	push   $0x24
+  800f64:	68 68 36 80 00       	push   $0x803668
+  800f69:	e8 d5 f1 ff ff       	call   800143 <_panic>
+
+00800f6e <sys_env_service>:
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+  800f74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7c:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f81:	89 cb                	mov    %ecx,%ebx
+  800f83:	89 cf                	mov    %ecx,%edi
+  800f85:	89 ce                	mov    %ecx,%esi
+  800f87:	cd 30                	int    $0x30
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5e                   	pop    %esi
+  800f8b:	5f                   	pop    %edi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	c3                   	ret
+
+00800f8e <sys_env_set_pgfault_upcall>:
+  800f8e:	55                   	push   %ebp
+  800f8f:	89 e5                	mov    %esp,%ebp
+  800f91:	57                   	push   %edi
+  800f92:	56                   	push   %esi
+  800f93:	53                   	push   %ebx
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa7:	89 df                	mov    %ebx,%edi
+  800fa9:	89 de                	mov    %ebx,%esi
+  800fab:	cd 30                	int    $0x30
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 08                	jg     800fb9 <sys_env_set_pgfault_upcall+0x2b>
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	50                   	push   %eax
+  800fbd:	6a 0a                	push   $0xa
+  800fbf:	68 4b 36 80 00       	push   $0x80364b
+  800fc4:	6a 24                	push   $0x24
+  800fc6:	68 68 36 80 00       	push   $0x803668
+  800fcb:	e8 73 f1 ff ff       	call   800143 <_panic>
+
+00800fd0 <sys_ipc_try_send>:
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fdd:	74 27                	je     801006 <sys_ipc_try_send+0x36>
+  800fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fed:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff0:	6a 00                	push   $0x0
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	8d 35 fd 0f 80 00    	lea    0x800ffd,%esi
+  800ffb:	0f 34                	sysenter
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	83 c4 04             	add    $0x4,%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+  801006:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80100b:	be 00 00 00 00       	mov    $0x0,%esi
+  801010:	8b 55 08             	mov    0x8(%ebp),%edx
+  801013:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801016:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801019:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101c:	cd 30                	int    $0x30
+  80101e:	eb e1                	jmp    801001 <sys_ipc_try_send+0x31>
+
+00801020 <sys_ipc_recv>:
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+  801026:	83 ec 0c             	sub    $0xc,%esp
+  801029:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801030:	74 32                	je     801064 <sys_ipc_recv+0x44>
+  801032:	8b 55 08             	mov    0x8(%ebp),%edx
+  801035:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80103a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80103f:	89 cb                	mov    %ecx,%ebx
+  801041:	89 cf                	mov    %ecx,%edi
+  801043:	6a 00                	push   $0x0
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	8d 35 50 10 80 00    	lea    0x801050,%esi
+  80104e:	0f 34                	sysenter
+  801050:	5d                   	pop    %ebp
+  801051:	83 c4 04             	add    $0x4,%esp
+  801054:	89 c2                	mov    %eax,%edx
+  801056:	85 c0                	test   %eax,%eax
+  801058:	7f 3c                	jg     801096 <sys_ipc_recv+0x76>
+  80105a:	89 d0                	mov    %edx,%eax
+  80105c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105f:	5b                   	pop    %ebx
+  801060:	5e                   	pop    %esi
+  801061:	5f                   	pop    %edi
+  801062:	5d                   	pop    %ebp
+  801063:	c3                   	ret
+  801064:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801069:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80106e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801071:	89 cb                	mov    %ecx,%ebx
+  801073:	89 cf                	mov    %ecx,%edi
+  801075:	89 ce                	mov    %ecx,%esi
+  801077:	cd 30                	int    $0x30
+  801079:	89 c2                	mov    %eax,%edx
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	7e db                	jle    80105a <sys_ipc_recv+0x3a>
+  80107f:	83 ec 0c             	sub    $0xc,%esp
+  801082:	50                   	push   %eax
+  801083:	6a 0d                	push   $0xd
+  801085:	68 4b 36 80 00       	push   $0x80364b
+  80108a:	6a 24                	push   $0x24
+  80108c:	68 68 36 80 00       	push   $0x803668
+  801091:	e8 ad f0 ff ff       	call   800143 <_panic>
+  801096:	83 ec 0c             	sub    $0xc,%esp
+  801099:	50                   	push   %eax
+  80109a:	6a 0d                	push   $0xd
+  80109c:	68 4b 36 80 00       	push   $0x80364b
+  8010a1:	6a 48                	push   $0x48
+  8010a3:	68 68 36 80 00       	push   $0x803668
+  8010a8:	e8 96 f0 ff ff       	call   800143 <_panic>
+
+008010ad <sys_ipc_send>:
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+  8010b3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010ba:	74 27                	je     8010e3 <sys_ipc_send+0x36>
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cd:	6a 00                	push   $0x0
+  8010cf:	55                   	push   %ebp
+  8010d0:	89 e5                	mov    %esp,%ebp
+  8010d2:	8d 35 da 10 80 00    	lea    0x8010da,%esi
+  8010d8:	0f 34                	sysenter
+  8010da:	5d                   	pop    %ebp
+  8010db:	83 c4 04             	add    $0x4,%esp
+  8010de:	5b                   	pop    %ebx
+  8010df:	5e                   	pop    %esi
+  8010e0:	5f                   	pop    %edi
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+  8010e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f9:	cd 30                	int    $0x30
+  8010fb:	eb e1                	jmp    8010de <sys_ipc_send+0x31>
+
+008010fd <sys_ipc_call>:
+  8010fd:	55                   	push   %ebp
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	57                   	push   %edi
+  801101:	56                   	push   %esi
+  801102:	53                   	push   %ebx
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801109:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80110e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801111:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801114:	8b 75 18             	mov    0x18(%ebp),%esi
+  801117:	cd 30                	int    $0x30
+  801119:	5b                   	pop    %ebx
+  80111a:	5e                   	pop    %esi
+  80111b:	5f                   	pop    %edi
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+
+0080111e <sys_ipc_reply_recv>:
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+  801121:	57                   	push   %edi
+  801122:	56                   	push   %esi
+  801123:	53                   	push   %ebx
+  801124:	8b 55 08             	mov    0x8(%ebp),%edx
+  801127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80112f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801132:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801135:	8b 75 18             	mov    0x18(%ebp),%esi
+  801138:	cd 30                	int    $0x30
+  80113a:	5b                   	pop    %ebx
+  80113b:	5e                   	pop    %esi
+  80113c:	5f                   	pop    %edi
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+
+0080113f <sys_time_msec>:
+  80113f:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801144:	85 c0                	test   %eax,%eax
+  801146:	75 06                	jne    80114e <sys_time_msec+0xf>
+  801148:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80114d:	c3                   	ret
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	57                   	push   %edi
+  801152:	56                   	push   %esi
+  801153:	53                   	push   %ebx
+  801154:	83 ec 0c             	sub    $0xc,%esp
+  801157:	0f 31                	rdtsc
+  801159:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80115f:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801165:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80116b:	29 c8                	sub    %ecx,%eax
+  80116d:	19 da                	sbb    %ebx,%edx
+  80116f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801174:	57                   	push   %edi
+  801175:	56                   	push   %esi
+  801176:	52                   	push   %edx
+  801177:	50                   	push   %eax
+  801178:	e8 ee 1f 00 00       	call   80316b <__udivdi3>
+  80117d:	83 c4 10             	add    $0x10,%esp
+  801180:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801183:	5b                   	pop    %ebx
+  801184:	5e                   	pop    %esi
+  801185:	5f                   	pop    %edi
+  801186:	5d                   	pop    %ebp
+  801187:	c3                   	ret
+
+00801188 <sys_env_swap>:
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+  801191:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801196:	8b 55 08             	mov    0x8(%ebp),%edx
+  801199:	b8 12 00 00 00       	mov    $0x12,%eax
+  80119e:	89 cb                	mov    %ecx,%ebx
+  8011a0:	89 cf                	mov    %ecx,%edi
+  8011a2:	89 ce                	mov    %ecx,%esi
+  8011a4:	cd 30                	int    $0x30
+  8011a6:	85 c0                	test   %eax,%eax
+  8011a8:	7f 08                	jg     8011b2 <sys_env_swap+0x2a>
+  8011aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+  8011b2:	83 ec 0c             	sub    $0xc,%esp
+  8011b5:	50                   	push   %eax
+  8011b6:	6a 12                	push   $0x12
+  8011b8:	68 4b 36 80 00       	push   $0x80364b
+  8011bd:	6a 24                	push   $0x24
+  8011bf:	68 68 36 80 00       	push   $0x803668
+  8011c4:	e8 7a ef ff ff       	call   800143 <_panic>
+
+008011c9 <sys_net_try_send>:
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	57                   	push   %edi
+  8011cd:	56                   	push   %esi
+  8011ce:	53                   	push   %ebx
+  8011cf:	83 ec 0c             	sub    $0xc,%esp
+  8011d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011e2:	89 df                	mov    %ebx,%edi
+  8011e4:	89 de                	mov    %ebx,%esi
+  8011e6:	cd 30                	int    $0x30
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	7f 08                	jg     8011f4 <sys_net_try_send+0x2b>
+  8011ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ef:	5b                   	pop    %ebx
+  8011f0:	5e                   	pop    %esi
+  8011f1:	5f                   	pop    %edi
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+  8011f4:	83 ec 0c             	sub    $0xc,%esp
+  8011f7:	50                   	push   %eax
+  8011f8:	6a 13                	push   $0x13
+  8011fa:	68 4b 36 80 00       	push   $0x80364b
+  8011ff:	6a 24                	push   $0x24
+  801201:	68 68 36 80 00       	push   $0x803668
+  801206:	e8 38 ef ff ff       	call   800143 <_panic>
+
+0080120b <sys_net_try_receive>:
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+  801211:	83 ec 0c             	sub    $0xc,%esp
+  801214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801224:	89 df                	mov    %ebx,%edi
+  801226:	89 de                	mov    %ebx,%esi
+  801228:	cd 30                	int    $0x30
+  80122a:	85 c0                	test   %eax,%eax
+  80122c:	7f 08                	jg     801236 <sys_net_try_receive+0x2b>
+  80122e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801231:	5b                   	pop    %ebx
+  801232:	5e                   	pop    %esi
+  801233:	5f                   	pop    %edi
+  801234:	5d                   	pop    %ebp
+  801235:	c3                   	ret
+  801236:	83 ec 0c             	sub    $0xc,%esp
+  801239:	50                   	push   %eax
+  80123a:	6a 14                	push   $0x14
+  80123c:	68 4b 36 80 00       	push   $0x80364b
+  801241:	6a 24                	push   $0x24
+  801243:	68 68 36 80 00       	push   $0x803668
+  801248:	e8 f6 ee ff ff       	call   800143 <_panic>
+
+0080124d <sys_net_recv_page>:
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	57                   	push   %edi
+  801251:	56                   	push   %esi
+  801252:	53                   	push   %ebx
+  801253:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801258:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125b:	b8 27 00 00 00       	mov    $0x27,%eax
+  801260:	89 cb                	mov    %ecx,%ebx
+  801262:	89 cf                	mov    %ecx,%edi
+  801264:	89 ce                	mov    %ecx,%esi
+  801266:	cd 30                	int    $0x30
+  801268:	5b                   	pop    %ebx
+  801269:	5e                   	pop    %esi
+  80126a:	5f                   	pop    %edi
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+
+0080126d <sys_net_wait>:
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+  801273:	ba 00 00 00 00       	mov    $0x0,%edx
+  801278:	b8 26 00 00 00       	mov    $0x26,%eax
+  80127d:	89 d1                	mov    %edx,%ecx
+  80127f:	89 d3                	mov    %edx,%ebx
+  801281:	89 d7                	mov    %edx,%edi
+  801283:	89 d6                	mov    %edx,%esi
+  801285:	cd 30                	int    $0x30
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+
+0080128c <sys_get_mac>:
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	57                   	push   %edi
+  801290:	56                   	push   %esi
+  801291:	53                   	push   %ebx
+  801292:	83 ec 0c             	sub    $0xc,%esp
+  801295:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012a5:	89 df                	mov    %ebx,%edi
+  8012a7:	89 de                	mov    %ebx,%esi
+  8012a9:	cd 30                	int    $0x30
+  8012ab:	85 c0                	test   %eax,%eax
+  8012ad:	7f 08                	jg     8012b7 <sys_get_mac+0x2b>
+  8012af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b2:	5b                   	pop    %ebx
+  8012b3:	5e                   	pop    %esi
+  8012b4:	5f                   	pop    %edi
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+  8012b7:	83 ec 0c             	sub    $0xc,%esp
+  8012ba:	50                   	push   %eax
+  8012bb:	6a 15                	push   $0x15
+  8012bd:	68 4b 36 80 00       	push   $0x80364b
+  8012c2:	6a 24                	push   $0x24
+  8012c4:	68 68 36 80 00       	push   $0x803668
+  8012c9:	e8 75 ee ff ff       	call   800143 <_panic>
+
+008012ce <sys_env_lease>:
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+  8012d4:	83 ec 0c             	sub    $0xc,%esp
+  8012d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012e7:	89 df                	mov    %ebx,%edi
+  8012e9:	89 de                	mov    %ebx,%esi
+  8012eb:	cd 30                	int    $0x30
+  8012ed:	85 c0                	test   %eax,%eax
+  8012ef:	7f 08                	jg     8012f9 <sys_env_lease+0x2b>
+  8012f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f4:	5b                   	pop    %ebx
+  8012f5:	5e                   	pop    %esi
+  8012f6:	5f                   	pop    %edi
+  8012f7:	5d                   	pop    %ebp
+  8012f8:	c3                   	ret
+  8012f9:	83 ec 0c             	sub    $0xc,%esp
+  8012fc:	50                   	push   %eax
+  8012fd:	6a 16                	push   $0x16
+  8012ff:	68 4b 36 80 00       	push   $0x80364b
+  801304:	6a 24                	push   $0x24
+  801306:	68 68 36 80 00       	push   $0x803668
+  80130b:	e8 33 ee ff ff       	call   800143 <_panic>
+
+00801310 <sys_copy_mem>:
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	57                   	push   %edi
+  801314:	56                   	push   %esi
+  801315:	53                   	push   %ebx
+  801316:	83 ec 0c             	sub    $0xc,%esp
+  801319:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801324:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801327:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80132a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80132d:	cd 30                	int    $0x30
+  80132f:	85 c0                	test   %eax,%eax
+  801331:	7f 08                	jg     80133b <sys_copy_mem+0x2b>
+  801333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801336:	5b                   	pop    %ebx
+  801337:	5e                   	pop    %esi
+  801338:	5f                   	pop    %edi
+  801339:	5d                   	pop    %ebp
+  80133a:	c3                   	ret
+  80133b:	83 ec 0c             	sub    $0xc,%esp
+  80133e:	50                   	push   %eax
+  80133f:	6a 17                	push   $0x17
+  801341:	68 4b 36 80 00       	push   $0x80364b
+  801346:	6a 24                	push   $0x24
+  801348:	68 68 36 80 00       	push   $0x803668
+  80134d:	e8 f1 ed ff ff       	call   800143 <_panic>
+
+00801352 <sys_get_perms>:
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	57                   	push   %edi
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+  801358:	83 ec 0c             	sub    $0xc,%esp
+  80135b:	be 00 00 00 00       	mov    $0x0,%esi
+  801360:	8b 55 08             	mov    0x8(%ebp),%edx
+  801363:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801366:	b8 18 00 00 00       	mov    $0x18,%eax
+  80136b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136e:	89 f7                	mov    %esi,%edi
+  801370:	cd 30                	int    $0x30
+  801372:	85 c0                	test   %eax,%eax
+  801374:	7f 08                	jg     80137e <sys_get_perms+0x2c>
+  801376:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801379:	5b                   	pop    %ebx
+  80137a:	5e                   	pop    %esi
+  80137b:	5f                   	pop    %edi
+  80137c:	5d                   	pop    %ebp
+  80137d:	c3                   	ret
+  80137e:	83 ec 0c             	sub    $0xc,%esp
+  801381:	50                   	push   %eax
+  801382:	6a 18                	push   $0x18
+  801384:	68 4b 36 80 00       	push   $0x80364b
+  801389:	6a 24                	push   $0x24
+  80138b:	68 68 36 80 00       	push   $0x803668
+  801390:	e8 ae ed ff ff       	call   800143 <_panic>
+
+00801395 <sys_env_unsuspend>:
+  801395:	55                   	push   %ebp
+  801396:	89 e5                	mov    %esp,%ebp
+  801398:	57                   	push   %edi
+  801399:	56                   	push   %esi
+  80139a:	53                   	push   %ebx
+  80139b:	83 ec 0c             	sub    $0xc,%esp
+  80139e:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b1:	89 f7                	mov    %esi,%edi
+  8013b3:	cd 30                	int    $0x30
+  8013b5:	85 c0                	test   %eax,%eax
+  8013b7:	7f 08                	jg     8013c1 <sys_env_unsuspend+0x2c>
+  8013b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5f                   	pop    %edi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+  8013c1:	83 ec 0c             	sub    $0xc,%esp
+  8013c4:	50                   	push   %eax
+  8013c5:	6a 19                	push   $0x19
+  8013c7:	68 4b 36 80 00       	push   $0x80364b
+  8013cc:	6a 24                	push   $0x24
+  8013ce:	68 68 36 80 00       	push   $0x803668
+  8013d3:	e8 6b ed ff ff       	call   800143 <_panic>
+
+008013d8 <sys_migrate>:
+  8013d8:	55                   	push   %ebp
+  8013d9:	89 e5                	mov    %esp,%ebp
+  8013db:	57                   	push   %edi
+  8013dc:	56                   	push   %esi
+  8013dd:	53                   	push   %ebx
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+  8013e1:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8013e6:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8013ec:	76 11                	jbe    8013ff <sys_migrate+0x27>
+  8013ee:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8013f3:	0f b6 08             	movzbl (%eax),%ecx
+  8013f6:	05 00 10 00 00       	add    $0x1000,%eax
+  8013fb:	39 d0                	cmp    %edx,%eax
+  8013fd:	72 f4                	jb     8013f3 <sys_migrate+0x1b>
+  8013ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801404:	8b 55 08             	mov    0x8(%ebp),%edx
+  801407:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80140c:	89 cb                	mov    %ecx,%ebx
+  80140e:	89 cf                	mov    %ecx,%edi
+  801410:	89 ce                	mov    %ecx,%esi
+  801412:	cd 30                	int    $0x30
+  801414:	85 c0                	test   %eax,%eax
+  801416:	7f 08                	jg     801420 <sys_migrate+0x48>
+  801418:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141b:	5b                   	pop    %ebx
+  80141c:	5e                   	pop    %esi
+  80141d:	5f                   	pop    %edi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+  801420:	83 ec 0c             	sub    $0xc,%esp
+  801423:	50                   	push   %eax
+  801424:	6a 1a                	push   $0x1a
+  801426:	68 4b 36 80 00       	push   $0x80364b
+  80142b:	6a 24                	push   $0x24
+  80142d:	68 68 36 80 00       	push   $0x803668
+  801432:	e8 0c ed ff ff       	call   800143 <_panic>
+
+00801437 <sys_lease_complete>:
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+  80143d:	83 ec 0c             	sub    $0xc,%esp
+  801440:	ba 00 00 00 00       	mov    $0x0,%edx
+  801445:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80144a:	89 d1                	mov    %edx,%ecx
+  80144c:	89 d3                	mov    %edx,%ebx
+  80144e:	89 d7                	mov    %edx,%edi
+  801450:	89 d6                	mov    %edx,%esi
+  801452:	cd 30                	int    $0x30
+  801454:	85 c0                	test   %eax,%eax
+  801456:	7f 08                	jg     801460 <sys_lease_complete+0x29>
+  801458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145b:	5b                   	pop    %ebx
+  80145c:	5e                   	pop    %esi
+  80145d:	5f                   	pop    %edi
+  80145e:	5d                   	pop    %ebp
+  80145f:	c3                   	ret
+  801460:	83 ec 0c             	sub    $0xc,%esp
+  801463:	50                   	push   %eax
+  801464:	6a 1b                	push   $0x1b
+  801466:	68 4b 36 80 00       	push   $0x80364b
+  80146b:	6a 24                	push   $0x24
+  80146d:	68 68 36 80 00       	push   $0x803668
+  801472:	e8 cc ec ff ff       	call   800143 <_panic>
+
+00801477 <sys_env_set_thisenv>:
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	57                   	push   %edi
+  80147b:	56                   	push   %esi
+  80147c:	53                   	push   %ebx
+  80147d:	83 ec 0c             	sub    $0xc,%esp
+  801480:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801485:	8b 55 08             	mov    0x8(%ebp),%edx
+  801488:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801490:	89 df                	mov    %ebx,%edi
+  801492:	89 de                	mov    %ebx,%esi
+  801494:	cd 30                	int    $0x30
+  801496:	85 c0                	test   %eax,%eax
+  801498:	7f 08                	jg     8014a2 <sys_env_set_thisenv+0x2b>
+  80149a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149d:	5b                   	pop    %ebx
+  80149e:	5e                   	pop    %esi
+  80149f:	5f                   	pop    %edi
+  8014a0:	5d                   	pop    %ebp
+  8014a1:	c3                   	ret
+  8014a2:	83 ec 0c             	sub    $0xc,%esp
+  8014a5:	50                   	push   %eax
+  8014a6:	6a 1c                	push   $0x1c
+  8014a8:	68 4b 36 80 00       	push   $0x80364b
+  8014ad:	6a 24                	push   $0x24
+  8014af:	68 68 36 80 00       	push   $0x803668
+  8014b4:	e8 8a ec ff ff       	call   800143 <_panic>
+
+008014b9 <sys_env_set_sched>:
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	57                   	push   %edi
+  8014bd:	56                   	push   %esi
+  8014be:	53                   	push   %ebx
+  8014bf:	83 ec 0c             	sub    $0xc,%esp
+  8014c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d5:	89 f7                	mov    %esi,%edi
+  8014d7:	cd 30                	int    $0x30
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	7f 08                	jg     8014e5 <sys_env_set_sched+0x2c>
+  8014dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e0:	5b                   	pop    %ebx
+  8014e1:	5e                   	pop    %esi
+  8014e2:	5f                   	pop    %edi
+  8014e3:	5d                   	pop    %ebp
+  8014e4:	c3                   	ret
+  8014e5:	83 ec 0c             	sub    $0xc,%esp
+  8014e8:	50                   	push   %eax
+  8014e9:	6a 1d                	push   $0x1d
+  8014eb:	68 4b 36 80 00       	push   $0x80364b
+  8014f0:	6a 24                	push   $0x24
+  8014f2:	68 68 36 80 00       	push   $0x803668
+  8014f7:	e8 47 ec ff ff       	call   800143 <_panic>
+
+008014fc <sys_batch>:
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	57                   	push   %edi
+  801500:	56                   	push   %esi
+  801501:	53                   	push   %ebx
+  801502:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801507:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801512:	89 df                	mov    %ebx,%edi
+  801514:	89 de                	mov    %ebx,%esi
+  801516:	cd 30                	int    $0x30
+  801518:	5b                   	pop    %ebx
+  801519:	5e                   	pop    %esi
+  80151a:	5f                   	pop    %edi
+  80151b:	5d                   	pop    %ebp
+  80151c:	c3                   	ret
+
+0080151d <sys_env_stats>:
+  80151d:	55                   	push   %ebp
+  80151e:	89 e5                	mov    %esp,%ebp
+  801520:	57                   	push   %edi
+  801521:	56                   	push   %esi
+  801522:	53                   	push   %ebx
+  801523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801528:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152e:	b8 23 00 00 00       	mov    $0x23,%eax
+  801533:	89 df                	mov    %ebx,%edi
+  801535:	89 de                	mov    %ebx,%esi
+  801537:	cd 30                	int    $0x30
+  801539:	5b                   	pop    %ebx
+  80153a:	5e                   	pop    %esi
+  80153b:	5f                   	pop    %edi
+  80153c:	5d                   	pop    %ebp
+  80153d:	c3                   	ret
+
+0080153e <sys_trace>:
+  80153e:	55                   	push   %ebp
+  80153f:	89 e5                	mov    %esp,%ebp
+  801541:	57                   	push   %edi
+  801542:	56                   	push   %esi
+  801543:	53                   	push   %ebx
+  801544:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154c:	b8 24 00 00 00       	mov    $0x24,%eax
+  801551:	89 cb                	mov    %ecx,%ebx
+  801553:	89 cf                	mov    %ecx,%edi
+  801555:	89 ce                	mov    %ecx,%esi
+  801557:	cd 30                	int    $0x30
+  801559:	5b                   	pop    %ebx
+  80155a:	5e                   	pop    %esi
+  80155b:	5f                   	pop    %edi
+  80155c:	5d                   	pop    %ebp
+  80155d:	c3                   	ret
+
+0080155e <sys_env_set_pager>:
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	57                   	push   %edi
+  801562:	56                   	push   %esi
+  801563:	53                   	push   %ebx
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+  80156c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801572:	b8 25 00 00 00       	mov    $0x25,%eax
+  801577:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157a:	89 f7                	mov    %esi,%edi
+  80157c:	cd 30                	int    $0x30
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	7f 08                	jg     80158a <sys_env_set_pager+0x2c>
+  801582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5f                   	pop    %edi
+  801588:	5d                   	pop    %ebp
+  801589:	c3                   	ret
+  80158a:	83 ec 0c             	sub    $0xc,%esp
+  80158d:	50                   	push   %eax
+  80158e:	6a 25                	push   $0x25
+  801590:	68 4b 36 80 00       	push   $0x80364b
+  801595:	6a 24                	push   $0x24
+  801597:	68 68 36 80 00       	push   $0x803668
+  80159c:	e8 a2 eb ff ff       	call   800143 <_panic>
+
+008015a1 <sys_pager_retire>:
+  8015a1:	55                   	push   %ebp
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	57                   	push   %edi
+  8015a5:	56                   	push   %esi
+  8015a6:	53                   	push   %ebx
+  8015a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015af:	b8 28 00 00 00       	mov    $0x28,%eax
+  8015b4:	89 cb                	mov    %ecx,%ebx
+  8015b6:	89 cf                	mov    %ecx,%edi
+  8015b8:	89 ce                	mov    %ecx,%esi
+  8015ba:	cd 30                	int    $0x30
+  8015bc:	5b                   	pop    %ebx
+  8015bd:	5e                   	pop    %esi
+  8015be:	5f                   	pop    %edi
+  8015bf:	5d                   	pop    %ebp
+  8015c0:	c3                   	ret
+
+008015c1 <sys_prof>:
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	57                   	push   %edi
+  8015c5:	56                   	push   %esi
+  8015c6:	53                   	push   %ebx
+  8015c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d2:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015da:	89 f7                	mov    %esi,%edi
+  8015dc:	cd 30                	int    $0x30
+  8015de:	5b                   	pop    %ebx
+  8015df:	5e                   	pop    %esi
+  8015e0:	5f                   	pop    %edi
+  8015e1:	5d                   	pop    %ebp
+  8015e2:	c3                   	ret
+
+008015e3 <set_pgfault_handler>:
+  8015e3:	55                   	push   %ebp
+  8015e4:	89 e5                	mov    %esp,%ebp
+  8015e6:	53                   	push   %ebx
+  8015e7:	83 ec 04             	sub    $0x4,%esp
+  8015ea:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  8015f1:	74 0d                	je     801600 <set_pgfault_handler+0x1d>
+  8015f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f6:	a3 14 50 80 00       	mov    %eax,0x805014
+  8015fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015fe:	c9                   	leave
+  8015ff:	c3                   	ret
+  801600:	e8 06 f7 ff ff       	call   800d0b <sys_getenvid>
+  801605:	89 c3                	mov    %eax,%ebx
+  801607:	83 ec 04             	sub    $0x4,%esp
+  80160a:	6a 07                	push   $0x7
+  80160c:	68 00 f0 7f ee       	push   $0xee7ff000
+  801611:	50                   	push   %eax
+  801612:	e8 5e f7 ff ff       	call   800d75 <sys_page_alloc>
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	78 29                	js     801647 <set_pgfault_handler+0x64>
+  80161e:	83 ec 08             	sub    $0x8,%esp
+  801621:	68 5b 16 80 00       	push   $0x80165b
+  801626:	53                   	push   %ebx
+  801627:	e8 62 f9 ff ff       	call   800f8e <sys_env_set_pgfault_upcall>
+  80162c:	83 c4 10             	add    $0x10,%esp
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	79 c0                	jns    8015f3 <set_pgfault_handler+0x10>
+  801633:	83 ec 04             	sub    $0x4,%esp
+  801636:	68 b0 36 80 00       	push   $0x8036b0
+  80163b:	6a 27                	push   $0x27
+  80163d:	68 e2 36 80 00       	push   $0x8036e2
+  801642:	e8 fc ea ff ff       	call   800143 <_panic>
+  801647:	83 ec 04             	sub    $0x4,%esp
+  80164a:	68 78 36 80 00       	push   $0x803678
+  80164f:	6a 23                	push   $0x23
+  801651:	68 e2 36 80 00       	push   $0x8036e2
+  801656:	e8 e8 ea ff ff       	call   800143 <_panic>
+
+0080165b <_pgfault_upcall>:
+  80165b:	54                   	push   %esp
+  80165c:	a1 14 50 80 00       	mov    0x805014,%eax
+  801661:	ff d0                	call   *%eax
+  801663:	83 c4 04             	add    $0x4,%esp
+  801666:	89 e3                	mov    %esp,%ebx
+  801668:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80166c:	8b 54 24 30          	mov    0x30(%esp),%edx
+  801670:	89 d4                	mov    %edx,%esp
+  801672:	51                   	push   %ecx
+  801673:	89 dc                	mov    %ebx,%esp
+  801675:	83 ea 04             	sub    $0x4,%edx
+  801678:	89 54 24 30          	mov    %edx,0x30(%esp)
+  80167c:	83 c4 08             	add    $0x8,%esp
+  80167f:	61                   	popa
+  801680:	83 c4 04             	add    $0x4,%esp
+  801683:	9d                   	popf
+  801684:	5c                   	pop    %esp
+  801685:	c3                   	ret
+
+00801686 <fd2num>:
+  801686:	55                   	push   %ebp
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80168c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801691:	c1 e8 0c             	shr    $0xc,%eax
+  801694:	5d                   	pop    %ebp
+  801695:	c3                   	ret
+
+00801696 <fd2data>:
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169c:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016a1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016a6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+
+008016ad <fd_alloc>:
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016b5:	89 c2                	mov    %eax,%edx
+  8016b7:	c1 ea 16             	shr    $0x16,%edx
+  8016ba:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016c1:	f6 c2 01             	test   $0x1,%dl
+  8016c4:	74 29                	je     8016ef <fd_alloc+0x42>
+  8016c6:	89 c2                	mov    %eax,%edx
+  8016c8:	c1 ea 0c             	shr    $0xc,%edx
+  8016cb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016d2:	f6 c2 01             	test   $0x1,%dl
+  8016d5:	74 18                	je     8016ef <fd_alloc+0x42>
+  8016d7:	05 00 10 00 00       	add    $0x1000,%eax
+  8016dc:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8016e1:	75 d2                	jne    8016b5 <fd_alloc+0x8>
+  8016e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016ed:	eb 05                	jmp    8016f4 <fd_alloc+0x47>
+  8016ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f7:	89 02                	mov    %eax,(%edx)
+  8016f9:	89 c8                	mov    %ecx,%eax
+  8016fb:	5d                   	pop    %ebp
+  8016fc:	c3                   	ret
+
+008016fd <fd_lookup>:
+  8016fd:	55                   	push   %ebp
+  8016fe:	89 e5                	mov    %esp,%ebp
+  801700:	8b 45 08             	mov    0x8(%ebp),%eax
+  801703:	83 f8 1f             	cmp    $0x1f,%eax
+  801706:	77 30                	ja     801738 <fd_lookup+0x3b>
+  801708:	c1 e0 0c             	shl    $0xc,%eax
+  80170b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801710:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801716:	f6 c2 01             	test   $0x1,%dl
+  801719:	74 24                	je     80173f <fd_lookup+0x42>
+  80171b:	89 c2                	mov    %eax,%edx
+  80171d:	c1 ea 0c             	shr    $0xc,%edx
+  801720:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801727:	f6 c2 01             	test   $0x1,%dl
+  80172a:	74 1a                	je     801746 <fd_lookup+0x49>
+  80172c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80172f:	89 02                	mov    %eax,(%edx)
+  801731:	b8 00 00 00 00       	mov    $0x0,%eax
+  801736:	5d                   	pop    %ebp
+  801737:	c3                   	ret
+  801738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173d:	eb f7                	jmp    801736 <fd_lookup+0x39>
+  80173f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801744:	eb f0                	jmp    801736 <fd_lookup+0x39>
+  801746:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80174b:	eb e9                	jmp    801736 <fd_lookup+0x39>
+
+0080174d <dev_lookup>:
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	53                   	push   %ebx
+  801751:	83 ec 04             	sub    $0x4,%esp
+  801754:	8b 55 08             	mov    0x8(%ebp),%edx
+  801757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175c:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801761:	39 13                	cmp    %edx,(%ebx)
+  801763:	74 37                	je     80179c <dev_lookup+0x4f>
+  801765:	83 c0 01             	add    $0x1,%eax
+  801768:	8b 1c 85 6c 37 80 00 	mov    0x80376c(,%eax,4),%ebx
+  80176f:	85 db                	test   %ebx,%ebx
+  801771:	75 ee                	jne    801761 <dev_lookup+0x14>
+  801773:	a1 10 50 80 00       	mov    0x805010,%eax
+  801778:	8b 40 48             	mov    0x48(%eax),%eax
+  80177b:	83 ec 04             	sub    $0x4,%esp
+  80177e:	52                   	push   %edx
+  80177f:	50                   	push   %eax
+  801780:	68 f0 36 80 00       	push   $0x8036f0
+  801785:	e8 94 ea ff ff       	call   80021e <cprintf>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801792:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801795:	89 1a                	mov    %ebx,(%edx)
+  801797:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+  80179c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a1:	eb ef                	jmp    801792 <dev_lookup+0x45>
+
+008017a3 <fd_close>:
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	57                   	push   %edi
+  8017a7:	56                   	push   %esi
+  8017a8:	53                   	push   %ebx
+  8017a9:	83 ec 24             	sub    $0x24,%esp
+  8017ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017af:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8017b2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017b5:	50                   	push   %eax
+  8017b6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017bc:	c1 e8 0c             	shr    $0xc,%eax
+  8017bf:	50                   	push   %eax
+  8017c0:	e8 38 ff ff ff       	call   8016fd <fd_lookup>
+  8017c5:	89 c3                	mov    %eax,%ebx
+  8017c7:	83 c4 10             	add    $0x10,%esp
+  8017ca:	85 c0                	test   %eax,%eax
+  8017cc:	78 05                	js     8017d3 <fd_close+0x30>
+  8017ce:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017d1:	74 0f                	je     8017e2 <fd_close+0x3f>
+  8017d3:	85 ff                	test   %edi,%edi
+  8017d5:	0f 44 df             	cmove  %edi,%ebx
+  8017d8:	89 d8                	mov    %ebx,%eax
+  8017da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017dd:	5b                   	pop    %ebx
+  8017de:	5e                   	pop    %esi
+  8017df:	5f                   	pop    %edi
+  8017e0:	5d                   	pop    %ebp
+  8017e1:	c3                   	ret
+  8017e2:	83 ec 08             	sub    $0x8,%esp
+  8017e5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017e8:	50                   	push   %eax
+  8017e9:	ff 36                	push   (%esi)
+  8017eb:	e8 5d ff ff ff       	call   80174d <dev_lookup>
+  8017f0:	89 c3                	mov    %eax,%ebx
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 1a                	js     801813 <fd_close+0x70>
+  8017f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017fc:	8b 40 10             	mov    0x10(%eax),%eax
+  8017ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801804:	85 c0                	test   %eax,%eax
+  801806:	74 0b                	je     801813 <fd_close+0x70>
+  801808:	83 ec 0c             	sub    $0xc,%esp
+  80180b:	56                   	push   %esi
+  80180c:	ff d0                	call   *%eax
+  80180e:	89 c3                	mov    %eax,%ebx
+  801810:	83 c4 10             	add    $0x10,%esp
+  801813:	83 ec 08             	sub    $0x8,%esp
+  801816:	56                   	push   %esi
+  801817:	6a 00                	push   $0x0
+  801819:	e8 29 f6 ff ff       	call   800e47 <sys_page_unmap>
+  80181e:	83 c4 10             	add    $0x10,%esp
+  801821:	eb b5                	jmp    8017d8 <fd_close+0x35>
+
+00801823 <close>:
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	83 ec 20             	sub    $0x20,%esp
+  801829:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80182c:	50                   	push   %eax
+  80182d:	ff 75 08             	push   0x8(%ebp)
+  801830:	e8 c8 fe ff ff       	call   8016fd <fd_lookup>
+  801835:	83 c4 10             	add    $0x10,%esp
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	79 02                	jns    80183e <close+0x1b>
+  80183c:	c9                   	leave
+  80183d:	c3                   	ret
+  80183e:	83 ec 08             	sub    $0x8,%esp
+  801841:	6a 01                	push   $0x1
+  801843:	ff 75 f4             	push   -0xc(%ebp)
+  801846:	e8 58 ff ff ff       	call   8017a3 <fd_close>
+  80184b:	83 c4 10             	add    $0x10,%esp
+  80184e:	eb ec                	jmp    80183c <close+0x19>
+
+00801850 <close_all>:
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	53                   	push   %ebx
+  801854:	83 ec 04             	sub    $0x4,%esp
+  801857:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185c:	83 ec 0c             	sub    $0xc,%esp
+  80185f:	53                   	push   %ebx
+  801860:	e8 be ff ff ff       	call   801823 <close>
+  801865:	83 c3 01             	add    $0x1,%ebx
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	83 fb 20             	cmp    $0x20,%ebx
+  80186e:	75 ec                	jne    80185c <close_all+0xc>
+  801870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801873:	c9                   	leave
+  801874:	c3                   	ret
+
+00801875 <dup>:
+  801875:	55                   	push   %ebp
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	57                   	push   %edi
+  801879:	56                   	push   %esi
+  80187a:	53                   	push   %ebx
+  80187b:	83 ec 34             	sub    $0x34,%esp
+  80187e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801881:	50                   	push   %eax
+  801882:	ff 75 08             	push   0x8(%ebp)
+  801885:	e8 73 fe ff ff       	call   8016fd <fd_lookup>
+  80188a:	89 c3                	mov    %eax,%ebx
+  80188c:	83 c4 10             	add    $0x10,%esp
+  80188f:	85 c0                	test   %eax,%eax
+  801891:	78 7f                	js     801912 <dup+0x9d>
+  801893:	83 ec 0c             	sub    $0xc,%esp
+  801896:	ff 75 0c             	push   0xc(%ebp)
+  801899:	e8 85 ff ff ff       	call   801823 <close>
+  80189e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018a1:	c1 e6 0c             	shl    $0xc,%esi
+  8018a4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8018aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018ad:	89 3c 24             	mov    %edi,(%esp)
+  8018b0:	e8 e1 fd ff ff       	call   801696 <fd2data>
+  8018b5:	89 c3                	mov    %eax,%ebx
+  8018b7:	89 34 24             	mov    %esi,(%esp)
+  8018ba:	e8 d7 fd ff ff       	call   801696 <fd2data>
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8018c5:	89 d8                	mov    %ebx,%eax
+  8018c7:	c1 e8 16             	shr    $0x16,%eax
+  8018ca:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018d1:	a8 01                	test   $0x1,%al
+  8018d3:	74 11                	je     8018e6 <dup+0x71>
+  8018d5:	89 d8                	mov    %ebx,%eax
+  8018d7:	c1 e8 0c             	shr    $0xc,%eax
+  8018da:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018e1:	f6 c2 01             	test   $0x1,%dl
+  8018e4:	75 36                	jne    80191c <dup+0xa7>
+  8018e6:	89 f8                	mov    %edi,%eax
+  8018e8:	c1 e8 0c             	shr    $0xc,%eax
+  8018eb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018f2:	83 ec 0c             	sub    $0xc,%esp
+  8018f5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018fa:	50                   	push   %eax
+  8018fb:	56                   	push   %esi
+  8018fc:	6a 00                	push   $0x0
+  8018fe:	57                   	push   %edi
+  8018ff:	6a 00                	push   $0x0
+  801901:	e8 b2 f4 ff ff       	call   800db8 <sys_page_map>
+  801906:	89 c3                	mov    %eax,%ebx
+  801908:	83 c4 20             	add    $0x20,%esp
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	78 33                	js     801942 <dup+0xcd>
+  80190f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801912:	89 d8                	mov    %ebx,%eax
+  801914:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801917:	5b                   	pop    %ebx
+  801918:	5e                   	pop    %esi
+  801919:	5f                   	pop    %edi
+  80191a:	5d                   	pop    %ebp
+  80191b:	c3                   	ret
+  80191c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801923:	83 ec 0c             	sub    $0xc,%esp
+  801926:	25 07 0e 00 00       	and    $0xe07,%eax
+  80192b:	50                   	push   %eax
+  80192c:	ff 75 d4             	push   -0x2c(%ebp)
+  80192f:	6a 00                	push   $0x0
+  801931:	53                   	push   %ebx
+  801932:	6a 00                	push   $0x0
+  801934:	e8 7f f4 ff ff       	call   800db8 <sys_page_map>
+  801939:	89 c3                	mov    %eax,%ebx
+  80193b:	83 c4 20             	add    $0x20,%esp
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	79 a4                	jns    8018e6 <dup+0x71>
+  801942:	83 ec 08             	sub    $0x8,%esp
+  801945:	56                   	push   %esi
+  801946:	6a 00                	push   $0x0
+  801948:	e8 fa f4 ff ff       	call   800e47 <sys_page_unmap>
+  80194d:	83 c4 08             	add    $0x8,%esp
+  801950:	ff 75 d4             	push   -0x2c(%ebp)
+  801953:	6a 00                	push   $0x0
+  801955:	e8 ed f4 ff ff       	call   800e47 <sys_page_unmap>
+  80195a:	83 c4 10             	add    $0x10,%esp
+  80195d:	eb b3                	jmp    801912 <dup+0x9d>
+
+0080195f <read>:
+  80195f:	55                   	push   %ebp
+  801960:	89 e5                	mov    %esp,%ebp
+  801962:	56                   	push   %esi
+  801963:	53                   	push   %ebx
+  801964:	83 ec 18             	sub    $0x18,%esp
+  801967:	8b 75 08             	mov    0x8(%ebp),%esi
+  80196a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80196d:	50                   	push   %eax
+  80196e:	56                   	push   %esi
+  80196f:	e8 89 fd ff ff       	call   8016fd <fd_lookup>
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	85 c0                	test   %eax,%eax
+  801979:	78 3c                	js     8019b7 <read+0x58>
+  80197b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80197e:	83 ec 08             	sub    $0x8,%esp
+  801981:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801984:	50                   	push   %eax
+  801985:	ff 33                	push   (%ebx)
+  801987:	e8 c1 fd ff ff       	call   80174d <dev_lookup>
+  80198c:	83 c4 10             	add    $0x10,%esp
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	78 24                	js     8019b7 <read+0x58>
+  801993:	8b 43 08             	mov    0x8(%ebx),%eax
+  801996:	83 e0 03             	and    $0x3,%eax
+  801999:	83 f8 01             	cmp    $0x1,%eax
+  80199c:	74 20                	je     8019be <read+0x5f>
+  80199e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a1:	8b 40 08             	mov    0x8(%eax),%eax
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	74 37                	je     8019df <read+0x80>
+  8019a8:	83 ec 04             	sub    $0x4,%esp
+  8019ab:	ff 75 10             	push   0x10(%ebp)
+  8019ae:	ff 75 0c             	push   0xc(%ebp)
+  8019b1:	53                   	push   %ebx
+  8019b2:	ff d0                	call   *%eax
+  8019b4:	83 c4 10             	add    $0x10,%esp
+  8019b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ba:	5b                   	pop    %ebx
+  8019bb:	5e                   	pop    %esi
+  8019bc:	5d                   	pop    %ebp
+  8019bd:	c3                   	ret
+  8019be:	a1 10 50 80 00       	mov    0x805010,%eax
+  8019c3:	8b 40 48             	mov    0x48(%eax),%eax
+  8019c6:	83 ec 04             	sub    $0x4,%esp
+  8019c9:	56                   	push   %esi
+  8019ca:	50                   	push   %eax
+  8019cb:	68 31 37 80 00       	push   $0x803731
+  8019d0:	e8 49 e8 ff ff       	call   80021e <cprintf>
+  8019d5:	83 c4 10             	add    $0x10,%esp
+  8019d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019dd:	eb d8                	jmp    8019b7 <read+0x58>
+  8019df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019e4:	eb d1                	jmp    8019b7 <read+0x58>
+
+008019e6 <readn>:
+  8019e6:	55                   	push   %ebp
+  8019e7:	89 e5                	mov    %esp,%ebp
+  8019e9:	57                   	push   %edi
+  8019ea:	56                   	push   %esi
+  8019eb:	53                   	push   %ebx
+  8019ec:	83 ec 0c             	sub    $0xc,%esp
+  8019ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8019f2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019f5:	85 f6                	test   %esi,%esi
+  8019f7:	74 30                	je     801a29 <readn+0x43>
+  8019f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a03:	83 ec 04             	sub    $0x4,%esp
+  801a06:	89 f2                	mov    %esi,%edx
+  801a08:	29 c2                	sub    %eax,%edx
+  801a0a:	52                   	push   %edx
+  801a0b:	01 f8                	add    %edi,%eax
+  801a0d:	50                   	push   %eax
+  801a0e:	ff 75 08             	push   0x8(%ebp)
+  801a11:	e8 49 ff ff ff       	call   80195f <read>
+  801a16:	83 c4 10             	add    $0x10,%esp
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 15                	js     801a32 <readn+0x4c>
+  801a1d:	74 11                	je     801a30 <readn+0x4a>
+  801a1f:	01 c3                	add    %eax,%ebx
+  801a21:	89 d8                	mov    %ebx,%eax
+  801a23:	39 f3                	cmp    %esi,%ebx
+  801a25:	72 dc                	jb     801a03 <readn+0x1d>
+  801a27:	eb 09                	jmp    801a32 <readn+0x4c>
+  801a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2e:	eb 02                	jmp    801a32 <readn+0x4c>
+  801a30:	89 d8                	mov    %ebx,%eax
+  801a32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a35:	5b                   	pop    %ebx
+  801a36:	5e                   	pop    %esi
+  801a37:	5f                   	pop    %edi
+  801a38:	5d                   	pop    %ebp
+  801a39:	c3                   	ret
+
+00801a3a <write>:
+  801a3a:	55                   	push   %ebp
+  801a3b:	89 e5                	mov    %esp,%ebp
+  801a3d:	56                   	push   %esi
+  801a3e:	53                   	push   %ebx
+  801a3f:	83 ec 18             	sub    $0x18,%esp
+  801a42:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a45:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a48:	50                   	push   %eax
+  801a49:	53                   	push   %ebx
+  801a4a:	e8 ae fc ff ff       	call   8016fd <fd_lookup>
+  801a4f:	83 c4 10             	add    $0x10,%esp
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	78 37                	js     801a8d <write+0x53>
+  801a56:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a59:	83 ec 08             	sub    $0x8,%esp
+  801a5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5f:	50                   	push   %eax
+  801a60:	ff 36                	push   (%esi)
+  801a62:	e8 e6 fc ff ff       	call   80174d <dev_lookup>
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 1f                	js     801a8d <write+0x53>
+  801a6e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a72:	74 20                	je     801a94 <write+0x5a>
+  801a74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a77:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	74 37                	je     801ab5 <write+0x7b>
+  801a7e:	83 ec 04             	sub    $0x4,%esp
+  801a81:	ff 75 10             	push   0x10(%ebp)
+  801a84:	ff 75 0c             	push   0xc(%ebp)
+  801a87:	56                   	push   %esi
+  801a88:	ff d0                	call   *%eax
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a90:	5b                   	pop    %ebx
+  801a91:	5e                   	pop    %esi
+  801a92:	5d                   	pop    %ebp
+  801a93:	c3                   	ret
+  801a94:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a99:	8b 40 48             	mov    0x48(%eax),%eax
+  801a9c:	83 ec 04             	sub    $0x4,%esp
+  801a9f:	53                   	push   %ebx
+  801aa0:	50                   	push   %eax
+  801aa1:	68 4d 37 80 00       	push   $0x80374d
+  801aa6:	e8 73 e7 ff ff       	call   80021e <cprintf>
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ab3:	eb d8                	jmp    801a8d <write+0x53>
+  801ab5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aba:	eb d1                	jmp    801a8d <write+0x53>
+
+00801abc <seek>:
+  801abc:	55                   	push   %ebp
+  801abd:	89 e5                	mov    %esp,%ebp
+  801abf:	83 ec 20             	sub    $0x20,%esp
+  801ac2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac5:	50                   	push   %eax
+  801ac6:	ff 75 08             	push   0x8(%ebp)
+  801ac9:	e8 2f fc ff ff       	call   8016fd <fd_lookup>
+  801ace:	83 c4 10             	add    $0x10,%esp
+  801ad1:	85 c0                	test   %eax,%eax
+  801ad3:	78 0e                	js     801ae3 <seek+0x27>
+  801ad5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ad8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801adb:	89 50 04             	mov    %edx,0x4(%eax)
+  801ade:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+
+00801ae5 <ftruncate>:
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	56                   	push   %esi
+  801ae9:	53                   	push   %ebx
+  801aea:	83 ec 18             	sub    $0x18,%esp
+  801aed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801af0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801af3:	50                   	push   %eax
+  801af4:	53                   	push   %ebx
+  801af5:	e8 03 fc ff ff       	call   8016fd <fd_lookup>
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	78 34                	js     801b35 <ftruncate+0x50>
+  801b01:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b04:	83 ec 08             	sub    $0x8,%esp
+  801b07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b0a:	50                   	push   %eax
+  801b0b:	ff 36                	push   (%esi)
+  801b0d:	e8 3b fc ff ff       	call   80174d <dev_lookup>
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	78 1c                	js     801b35 <ftruncate+0x50>
+  801b19:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b1d:	74 1d                	je     801b3c <ftruncate+0x57>
+  801b1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b22:	8b 40 18             	mov    0x18(%eax),%eax
+  801b25:	85 c0                	test   %eax,%eax
+  801b27:	74 34                	je     801b5d <ftruncate+0x78>
+  801b29:	83 ec 08             	sub    $0x8,%esp
+  801b2c:	ff 75 0c             	push   0xc(%ebp)
+  801b2f:	56                   	push   %esi
+  801b30:	ff d0                	call   *%eax
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b38:	5b                   	pop    %ebx
+  801b39:	5e                   	pop    %esi
+  801b3a:	5d                   	pop    %ebp
+  801b3b:	c3                   	ret
+  801b3c:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b41:	8b 40 48             	mov    0x48(%eax),%eax
+  801b44:	83 ec 04             	sub    $0x4,%esp
+  801b47:	53                   	push   %ebx
+  801b48:	50                   	push   %eax
+  801b49:	68 10 37 80 00       	push   $0x803710
+  801b4e:	e8 cb e6 ff ff       	call   80021e <cprintf>
+  801b53:	83 c4 10             	add    $0x10,%esp
+  801b56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b5b:	eb d8                	jmp    801b35 <ftruncate+0x50>
+  801b5d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b62:	eb d1                	jmp    801b35 <ftruncate+0x50>
+
+00801b64 <fstat>:
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	56                   	push   %esi
+  801b68:	53                   	push   %ebx
+  801b69:	83 ec 18             	sub    $0x18,%esp
+  801b6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b72:	50                   	push   %eax
+  801b73:	ff 75 08             	push   0x8(%ebp)
+  801b76:	e8 82 fb ff ff       	call   8016fd <fd_lookup>
+  801b7b:	83 c4 10             	add    $0x10,%esp
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	78 49                	js     801bcb <fstat+0x67>
+  801b82:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b85:	83 ec 08             	sub    $0x8,%esp
+  801b88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8b:	50                   	push   %eax
+  801b8c:	ff 36                	push   (%esi)
+  801b8e:	e8 ba fb ff ff       	call   80174d <dev_lookup>
+  801b93:	83 c4 10             	add    $0x10,%esp
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	78 31                	js     801bcb <fstat+0x67>
+  801b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ba1:	74 2f                	je     801bd2 <fstat+0x6e>
+  801ba3:	c6 03 00             	movb   $0x0,(%ebx)
+  801ba6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bad:	00 00 00 
+  801bb0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bb7:	00 00 00 
+  801bba:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801bc0:	83 ec 08             	sub    $0x8,%esp
+  801bc3:	53                   	push   %ebx
+  801bc4:	56                   	push   %esi
+  801bc5:	ff 50 14             	call   *0x14(%eax)
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bce:	5b                   	pop    %ebx
+  801bcf:	5e                   	pop    %esi
+  801bd0:	5d                   	pop    %ebp
+  801bd1:	c3                   	ret
+  801bd2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd7:	eb f2                	jmp    801bcb <fstat+0x67>
+
+00801bd9 <stat>:
+  801bd9:	55                   	push   %ebp
+  801bda:	89 e5                	mov    %esp,%ebp
+  801bdc:	56                   	push   %esi
+  801bdd:	53                   	push   %ebx
+  801bde:	83 ec 08             	sub    $0x8,%esp
+  801be1:	6a 00                	push   $0x0
+  801be3:	ff 75 08             	push   0x8(%ebp)
+  801be6:	e8 31 05 00 00       	call   80211c <open>
+  801beb:	89 c3                	mov    %eax,%ebx
+  801bed:	83 c4 10             	add    $0x10,%esp
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	78 1b                	js     801c0f <stat+0x36>
+  801bf4:	83 ec 08             	sub    $0x8,%esp
+  801bf7:	ff 75 0c             	push   0xc(%ebp)
+  801bfa:	50                   	push   %eax
+  801bfb:	e8 64 ff ff ff       	call   801b64 <fstat>
+  801c00:	89 c6                	mov    %eax,%esi
+  801c02:	89 1c 24             	mov    %ebx,(%esp)
+  801c05:	e8 19 fc ff ff       	call   801823 <close>
+  801c0a:	83 c4 10             	add    $0x10,%esp
+  801c0d:	89 f3                	mov    %esi,%ebx
+  801c0f:	89 d8                	mov    %ebx,%eax
+  801c11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c14:	5b                   	pop    %ebx
+  801c15:	5e                   	pop    %esi
+  801c16:	5d                   	pop    %ebp
+  801c17:	c3                   	ret
+
+00801c18 <fsipc>:
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	56                   	push   %esi
+  801c1c:	53                   	push   %ebx
+  801c1d:	89 c3                	mov    %eax,%ebx
+  801c1f:	89 d6                	mov    %edx,%esi
+  801c21:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c28:	74 20                	je     801c4a <fsipc+0x32>
+  801c2a:	83 ec 08             	sub    $0x8,%esp
+  801c2d:	6a 00                	push   $0x0
+  801c2f:	56                   	push   %esi
+  801c30:	6a 07                	push   $0x7
+  801c32:	68 00 60 80 00       	push   $0x806000
+  801c37:	53                   	push   %ebx
+  801c38:	ff 35 08 50 80 00    	push   0x805008
+  801c3e:	e8 5a 12 00 00       	call   802e9d <ipc_call>
+  801c43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c46:	5b                   	pop    %ebx
+  801c47:	5e                   	pop    %esi
+  801c48:	5d                   	pop    %ebp
+  801c49:	c3                   	ret
+  801c4a:	83 ec 0c             	sub    $0xc,%esp
+  801c4d:	6a 02                	push   $0x2
+  801c4f:	e8 e4 13 00 00       	call   803038 <ipc_find_env>
+  801c54:	a3 08 50 80 00       	mov    %eax,0x805008
+  801c59:	83 c4 10             	add    $0x10,%esp
+  801c5c:	eb cc                	jmp    801c2a <fsipc+0x12>
+
+00801c5e <devfile_trunc>:
+  801c5e:	55                   	push   %ebp
+  801c5f:	89 e5                	mov    %esp,%ebp
+  801c61:	83 ec 08             	sub    $0x8,%esp
+  801c64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c67:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c6a:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c72:	a3 04 60 80 00       	mov    %eax,0x806004
+  801c77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c81:	e8 92 ff ff ff       	call   801c18 <fsipc>
+  801c86:	c9                   	leave
+  801c87:	c3                   	ret
+
+00801c88 <devfile_flush>:
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c91:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c94:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ca3:	e8 70 ff ff ff       	call   801c18 <fsipc>
+  801ca8:	c9                   	leave
+  801ca9:	c3                   	ret
+
+00801caa <devfile_stat>:
+  801caa:	55                   	push   %ebp
+  801cab:	89 e5                	mov    %esp,%ebp
+  801cad:	53                   	push   %ebx
+  801cae:	83 ec 04             	sub    $0x4,%esp
+  801cb1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cba:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc4:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cc9:	e8 4a ff ff ff       	call   801c18 <fsipc>
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	78 2c                	js     801cfe <devfile_stat+0x54>
+  801cd2:	83 ec 08             	sub    $0x8,%esp
+  801cd5:	68 00 60 80 00       	push   $0x806000
+  801cda:	53                   	push   %ebx
+  801cdb:	e8 35 ec ff ff       	call   800915 <strcpy>
+  801ce0:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ce5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801ceb:	a1 84 60 80 00       	mov    0x806084,%eax
+  801cf0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801cf6:	83 c4 10             	add    $0x10,%esp
+  801cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d01:	c9                   	leave
+  801d02:	c3                   	ret
+
+00801d03 <fsring_rw>:
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	57                   	push   %edi
+  801d07:	56                   	push   %esi
+  801d08:	53                   	push   %ebx
+  801d09:	83 ec 2c             	sub    $0x2c,%esp
+  801d0c:	89 c7                	mov    %eax,%edi
+  801d0e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d11:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801d14:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d19:	a8 01                	test   $0x1,%al
+  801d1b:	74 0d                	je     801d2a <fsring_rw+0x27>
+  801d1d:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d22:	a8 01                	test   $0x1,%al
+  801d24:	0f 85 d5 00 00 00    	jne    801dff <fsring_rw+0xfc>
+  801d2a:	a1 10 50 80 00       	mov    0x805010,%eax
+  801d2f:	8b 40 48             	mov    0x48(%eax),%eax
+  801d32:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801d38:	0f 84 fc 00 00 00    	je     801e3a <fsring_rw+0x137>
+  801d3e:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801d45:	0f 84 02 01 00 00    	je     801e4d <fsring_rw+0x14a>
+  801d4b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d50:	83 ec 04             	sub    $0x4,%esp
+  801d53:	68 07 02 00 00       	push   $0x207
+  801d58:	53                   	push   %ebx
+  801d59:	6a 00                	push   $0x0
+  801d5b:	e8 15 f0 ff ff       	call   800d75 <sys_page_alloc>
+  801d60:	83 c4 10             	add    $0x10,%esp
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	0f 88 f9 00 00 00    	js     801e64 <fsring_rw+0x161>
+  801d6b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d71:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d77:	75 d7                	jne    801d50 <fsring_rw+0x4d>
+  801d79:	6a 0e                	push   $0xe
+  801d7b:	6a 0d                	push   $0xd
+  801d7d:	ff 35 08 50 80 00    	push   0x805008
+  801d83:	68 00 00 f0 cf       	push   $0xcff00000
+  801d88:	e8 c4 0c 00 00       	call   802a51 <ipcring_init>
+  801d8d:	83 c4 08             	add    $0x8,%esp
+  801d90:	6a 00                	push   $0x0
+  801d92:	6a 00                	push   $0x0
+  801d94:	68 07 02 00 00       	push   $0x207
+  801d99:	68 00 00 f0 cf       	push   $0xcff00000
+  801d9e:	6a 0b                	push   $0xb
+  801da0:	ff 35 08 50 80 00    	push   0x805008
+  801da6:	e8 f2 10 00 00       	call   802e9d <ipc_call>
+  801dab:	89 c6                	mov    %eax,%esi
+  801dad:	83 c4 20             	add    $0x20,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	0f 88 ac 00 00 00    	js     801e64 <fsring_rw+0x161>
+  801db8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dbd:	89 d9                	mov    %ebx,%ecx
+  801dbf:	83 c3 01             	add    $0x1,%ebx
+  801dc2:	89 da                	mov    %ebx,%edx
+  801dc4:	c1 e2 0c             	shl    $0xc,%edx
+  801dc7:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801dcd:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801dd3:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801dd9:	83 ec 08             	sub    $0x8,%esp
+  801ddc:	6a 00                	push   $0x0
+  801dde:	6a 00                	push   $0x0
+  801de0:	68 07 02 00 00       	push   $0x207
+  801de5:	50                   	push   %eax
+  801de6:	6a 0c                	push   $0xc
+  801de8:	ff 35 08 50 80 00    	push   0x805008
+  801dee:	e8 aa 10 00 00       	call   802e9d <ipc_call>
+  801df3:	83 c4 20             	add    $0x20,%esp
+  801df6:	85 c0                	test   %eax,%eax
+  801df8:	78 6a                	js     801e64 <fsring_rw+0x161>
+  801dfa:	83 fb 08             	cmp    $0x8,%ebx
+  801dfd:	75 be                	jne    801dbd <fsring_rw+0xba>
+  801dff:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e03:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801e08:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801e0d:	0f 45 c2             	cmovne %edx,%eax
+  801e10:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e13:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e1a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e21:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e32:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801e35:	e9 4b 01 00 00       	jmp    801f85 <fsring_rw+0x282>
+  801e3a:	e8 00 f3 ff ff       	call   80113f <sys_time_msec>
+  801e3f:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801e45:	0f 89 f3 fe ff ff    	jns    801d3e <fsring_rw+0x3b>
+  801e4b:	eb 54                	jmp    801ea1 <fsring_rw+0x19e>
+  801e4d:	83 ec 0c             	sub    $0xc,%esp
+  801e50:	6a 02                	push   $0x2
+  801e52:	e8 e1 11 00 00       	call   803038 <ipc_find_env>
+  801e57:	a3 08 50 80 00       	mov    %eax,0x805008
+  801e5c:	83 c4 10             	add    $0x10,%esp
+  801e5f:	e9 e7 fe ff ff       	jmp    801d4b <fsring_rw+0x48>
+  801e64:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e69:	83 ec 08             	sub    $0x8,%esp
+  801e6c:	53                   	push   %ebx
+  801e6d:	6a 00                	push   $0x0
+  801e6f:	e8 d3 ef ff ff       	call   800e47 <sys_page_unmap>
+  801e74:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e7a:	83 c4 10             	add    $0x10,%esp
+  801e7d:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e83:	75 e4                	jne    801e69 <fsring_rw+0x166>
+  801e85:	e8 b5 f2 ff ff       	call   80113f <sys_time_msec>
+  801e8a:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801e8f:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e94:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e99:	8b 40 48             	mov    0x48(%eax),%eax
+  801e9c:	a3 04 50 80 00       	mov    %eax,0x805004
+  801ea1:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801ea8:	e9 7a 01 00 00       	jmp    802027 <fsring_rw+0x324>
+  801ead:	8b 57 0c             	mov    0xc(%edi),%edx
+  801eb0:	89 10                	mov    %edx,(%eax)
+  801eb2:	89 58 04             	mov    %ebx,0x4(%eax)
+  801eb5:	89 f2                	mov    %esi,%edx
+  801eb7:	03 57 04             	add    0x4(%edi),%edx
+  801eba:	89 50 08             	mov    %edx,0x8(%eax)
+  801ebd:	83 ec 04             	sub    $0x4,%esp
+  801ec0:	53                   	push   %ebx
+  801ec1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801ec4:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801ec7:	52                   	push   %edx
+  801ec8:	83 c0 0c             	add    $0xc,%eax
+  801ecb:	50                   	push   %eax
+  801ecc:	e8 f4 eb ff ff       	call   800ac5 <memmove>
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ed7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801eda:	89 08                	mov    %ecx,(%eax)
+  801edc:	83 ec 0c             	sub    $0xc,%esp
+  801edf:	68 00 00 f0 cf       	push   $0xcff00000
+  801ee4:	e8 c6 0b 00 00       	call   802aaf <ipcring_req_push>
+  801ee9:	01 de                	add    %ebx,%esi
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801ef1:	73 4c                	jae    801f3f <fsring_rw+0x23c>
+  801ef3:	83 ec 0c             	sub    $0xc,%esp
+  801ef6:	68 00 00 f0 cf       	push   $0xcff00000
+  801efb:	e8 89 0b 00 00       	call   802a89 <ipcring_req_slot>
+  801f00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f03:	83 c4 10             	add    $0x10,%esp
+  801f06:	85 c0                	test   %eax,%eax
+  801f08:	74 35                	je     801f3f <fsring_rw+0x23c>
+  801f0a:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f0f:	83 e0 07             	and    $0x7,%eax
+  801f12:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f17:	c1 e0 0c             	shl    $0xc,%eax
+  801f1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f1d:	29 f3                	sub    %esi,%ebx
+  801f1f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f22:	39 cb                	cmp    %ecx,%ebx
+  801f24:	0f 47 d9             	cmova  %ecx,%ebx
+  801f27:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f2b:	75 80                	jne    801ead <fsring_rw+0x1aa>
+  801f2d:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f30:	89 10                	mov    %edx,(%eax)
+  801f32:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f35:	89 f2                	mov    %esi,%edx
+  801f37:	03 57 04             	add    0x4(%edi),%edx
+  801f3a:	89 50 08             	mov    %edx,0x8(%eax)
+  801f3d:	eb 95                	jmp    801ed4 <fsring_rw+0x1d1>
+  801f3f:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f47:	83 ec 0c             	sub    $0xc,%esp
+  801f4a:	68 00 00 f0 cf       	push   $0xcff00000
+  801f4f:	e8 94 0b 00 00       	call   802ae8 <ipcring_rsp_wait>
+  801f54:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f5e:	75 45                	jne    801fa5 <fsring_rw+0x2a2>
+  801f60:	85 db                	test   %ebx,%ebx
+  801f62:	79 41                	jns    801fa5 <fsring_rw+0x2a2>
+  801f64:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801f67:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801f6e:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801f75:	83 ec 0c             	sub    $0xc,%esp
+  801f78:	68 00 00 f0 cf       	push   $0xcff00000
+  801f7d:	e8 cc 0b 00 00       	call   802b4e <ipcring_rsp_pop>
+  801f82:	83 c4 10             	add    $0x10,%esp
+  801f85:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801f8b:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f90:	39 c2                	cmp    %eax,%edx
+  801f92:	74 75                	je     802009 <fsring_rw+0x306>
+  801f94:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f98:	75 a5                	jne    801f3f <fsring_rw+0x23c>
+  801f9a:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f9d:	0f 82 50 ff ff ff    	jb     801ef3 <fsring_rw+0x1f0>
+  801fa3:	eb 9a                	jmp    801f3f <fsring_rw+0x23c>
+  801fa5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801fa9:	75 ca                	jne    801f75 <fsring_rw+0x272>
+  801fab:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801faf:	74 31                	je     801fe2 <fsring_rw+0x2df>
+  801fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb4:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fb7:	29 c8                	sub    %ecx,%eax
+  801fb9:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801fbc:	39 d0                	cmp    %edx,%eax
+  801fbe:	0f 47 c2             	cmova  %edx,%eax
+  801fc1:	39 d8                	cmp    %ebx,%eax
+  801fc3:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fc8:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801fcc:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801fcf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fd4:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801fd8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801fdb:	01 d9                	add    %ebx,%ecx
+  801fdd:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801fe0:	eb 93                	jmp    801f75 <fsring_rw+0x272>
+  801fe2:	83 ec 04             	sub    $0x4,%esp
+  801fe5:	53                   	push   %ebx
+  801fe6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fe9:	83 e0 07             	and    $0x7,%eax
+  801fec:	c1 e0 0c             	shl    $0xc,%eax
+  801fef:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801ff9:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801ffc:	01 c8                	add    %ecx,%eax
+  801ffe:	50                   	push   %eax
+  801fff:	e8 c1 ea ff ff       	call   800ac5 <memmove>
+  802004:	83 c4 10             	add    $0x10,%esp
+  802007:	eb a8                	jmp    801fb1 <fsring_rw+0x2ae>
+  802009:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80200d:	75 09                	jne    802018 <fsring_rw+0x315>
+  80200f:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802012:	0f 82 db fe ff ff    	jb     801ef3 <fsring_rw+0x1f0>
+  802018:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80201b:	01 57 04             	add    %edx,0x4(%edi)
+  80201e:	85 d2                	test   %edx,%edx
+  802020:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802024:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802027:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80202a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80202d:	5b                   	pop    %ebx
+  80202e:	5e                   	pop    %esi
+  80202f:	5f                   	pop    %edi
+  802030:	5d                   	pop    %ebp
+  802031:	c3                   	ret
+
+00802032 <devfile_write>:
+  802032:	55                   	push   %ebp
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	57                   	push   %edi
+  802036:	56                   	push   %esi
+  802037:	53                   	push   %ebx
+  802038:	83 ec 0c             	sub    $0xc,%esp
+  80203b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80203e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802041:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802044:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80204a:	76 1a                	jbe    802066 <devfile_write+0x34>
+  80204c:	83 ec 0c             	sub    $0xc,%esp
+  80204f:	53                   	push   %ebx
+  802050:	89 f1                	mov    %esi,%ecx
+  802052:	ba 06 00 00 00       	mov    $0x6,%edx
+  802057:	89 f8                	mov    %edi,%eax
+  802059:	e8 a5 fc ff ff       	call   801d03 <fsring_rw>
+  80205e:	83 c4 10             	add    $0x10,%esp
+  802061:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802064:	75 39                	jne    80209f <devfile_write+0x6d>
+  802066:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80206b:	39 c3                	cmp    %eax,%ebx
+  80206d:	0f 47 d8             	cmova  %eax,%ebx
+  802070:	8b 47 0c             	mov    0xc(%edi),%eax
+  802073:	a3 00 60 80 00       	mov    %eax,0x806000
+  802078:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80207e:	83 ec 04             	sub    $0x4,%esp
+  802081:	53                   	push   %ebx
+  802082:	56                   	push   %esi
+  802083:	68 08 60 80 00       	push   $0x806008
+  802088:	e8 38 ea ff ff       	call   800ac5 <memmove>
+  80208d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802092:	b8 04 00 00 00       	mov    $0x4,%eax
+  802097:	e8 7c fb ff ff       	call   801c18 <fsipc>
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a2:	5b                   	pop    %ebx
+  8020a3:	5e                   	pop    %esi
+  8020a4:	5f                   	pop    %edi
+  8020a5:	5d                   	pop    %ebp
+  8020a6:	c3                   	ret
+
+008020a7 <devfile_read>:
+  8020a7:	55                   	push   %ebp
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	57                   	push   %edi
+  8020ab:	56                   	push   %esi
+  8020ac:	53                   	push   %ebx
+  8020ad:	83 ec 0c             	sub    $0xc,%esp
+  8020b0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020b3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020b6:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8020bc:	76 1d                	jbe    8020db <devfile_read+0x34>
+  8020be:	83 ec 0c             	sub    $0xc,%esp
+  8020c1:	56                   	push   %esi
+  8020c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020c5:	ba 05 00 00 00       	mov    $0x5,%edx
+  8020ca:	89 f8                	mov    %edi,%eax
+  8020cc:	e8 32 fc ff ff       	call   801d03 <fsring_rw>
+  8020d1:	89 c3                	mov    %eax,%ebx
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020d9:	75 37                	jne    802112 <devfile_read+0x6b>
+  8020db:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020de:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020e3:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8020e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ee:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020f3:	e8 20 fb ff ff       	call   801c18 <fsipc>
+  8020f8:	89 c3                	mov    %eax,%ebx
+  8020fa:	85 c0                	test   %eax,%eax
+  8020fc:	78 14                	js     802112 <devfile_read+0x6b>
+  8020fe:	83 ec 04             	sub    $0x4,%esp
+  802101:	50                   	push   %eax
+  802102:	68 00 60 80 00       	push   $0x806000
+  802107:	ff 75 0c             	push   0xc(%ebp)
+  80210a:	e8 b6 e9 ff ff       	call   800ac5 <memmove>
+  80210f:	83 c4 10             	add    $0x10,%esp
+  802112:	89 d8                	mov    %ebx,%eax
+  802114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802117:	5b                   	pop    %ebx
+  802118:	5e                   	pop    %esi
+  802119:	5f                   	pop    %edi
+  80211a:	5d                   	pop    %ebp
+  80211b:	c3                   	ret
+
+0080211c <open>:
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	56                   	push   %esi
+  802120:	53                   	push   %ebx
+  802121:	83 ec 1c             	sub    $0x1c,%esp
+  802124:	8b 75 08             	mov    0x8(%ebp),%esi
+  802127:	56                   	push   %esi
+  802128:	e8 9c e7 ff ff       	call   8008c9 <strlen>
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802135:	7f 6c                	jg     8021a3 <open+0x87>
+  802137:	83 ec 0c             	sub    $0xc,%esp
+  80213a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80213d:	50                   	push   %eax
+  80213e:	e8 6a f5 ff ff       	call   8016ad <fd_alloc>
+  802143:	89 c3                	mov    %eax,%ebx
+  802145:	83 c4 10             	add    $0x10,%esp
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	78 3c                	js     802188 <open+0x6c>
+  80214c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80214f:	a3 00 64 80 00       	mov    %eax,0x806400
+  802154:	83 ec 08             	sub    $0x8,%esp
+  802157:	56                   	push   %esi
+  802158:	68 00 60 80 00       	push   $0x806000
+  80215d:	e8 b3 e7 ff ff       	call   800915 <strcpy>
+  802162:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802165:	b8 01 00 00 00       	mov    $0x1,%eax
+  80216a:	e8 a9 fa ff ff       	call   801c18 <fsipc>
+  80216f:	89 c3                	mov    %eax,%ebx
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	85 c0                	test   %eax,%eax
+  802176:	78 19                	js     802191 <open+0x75>
+  802178:	83 ec 0c             	sub    $0xc,%esp
+  80217b:	ff 75 f4             	push   -0xc(%ebp)
+  80217e:	e8 03 f5 ff ff       	call   801686 <fd2num>
+  802183:	89 c3                	mov    %eax,%ebx
+  802185:	83 c4 10             	add    $0x10,%esp
+  802188:	89 d8                	mov    %ebx,%eax
+  80218a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218d:	5b                   	pop    %ebx
+  80218e:	5e                   	pop    %esi
+  80218f:	5d                   	pop    %ebp
+  802190:	c3                   	ret
+  802191:	83 ec 08             	sub    $0x8,%esp
+  802194:	6a 00                	push   $0x0
+  802196:	ff 75 f4             	push   -0xc(%ebp)
+  802199:	e8 05 f6 ff ff       	call   8017a3 <fd_close>
+  80219e:	83 c4 10             	add    $0x10,%esp
+  8021a1:	eb e5                	jmp    802188 <open+0x6c>
+  8021a3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021a8:	eb de                	jmp    802188 <open+0x6c>
+
+008021aa <file_image>:
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	53                   	push   %ebx
+  8021ae:	83 ec 1c             	sub    $0x1c,%esp
+  8021b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b7:	50                   	push   %eax
+  8021b8:	ff 75 08             	push   0x8(%ebp)
+  8021bb:	e8 3d f5 ff ff       	call   8016fd <fd_lookup>
+  8021c0:	83 c4 10             	add    $0x10,%esp
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 58                	js     80221f <file_image+0x75>
+  8021c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ca:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021d0:	39 08                	cmp    %ecx,(%eax)
+  8021d2:	75 50                	jne    802224 <file_image+0x7a>
+  8021d4:	83 fb 04             	cmp    $0x4,%ebx
+  8021d7:	77 52                	ja     80222b <file_image+0x81>
+  8021d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021dc:	a3 00 60 80 00       	mov    %eax,0x806000
+  8021e1:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8021e7:	83 ec 04             	sub    $0x4,%esp
+  8021ea:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8021ed:	c1 e0 02             	shl    $0x2,%eax
+  8021f0:	50                   	push   %eax
+  8021f1:	ff 75 0c             	push   0xc(%ebp)
+  8021f4:	68 08 60 80 00       	push   $0x806008
+  8021f9:	e8 c7 e8 ff ff       	call   800ac5 <memmove>
+  8021fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802203:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802208:	e8 0b fa ff ff       	call   801c18 <fsipc>
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	85 c0                	test   %eax,%eax
+  802212:	78 0b                	js     80221f <file_image+0x75>
+  802214:	8b 55 14             	mov    0x14(%ebp),%edx
+  802217:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80221d:	89 0a                	mov    %ecx,(%edx)
+  80221f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802222:	c9                   	leave
+  802223:	c3                   	ret
+  802224:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802229:	eb f4                	jmp    80221f <file_image+0x75>
+  80222b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802230:	eb ed                	jmp    80221f <file_image+0x75>
+
+00802232 <remove>:
+  802232:	55                   	push   %ebp
+  802233:	89 e5                	mov    %esp,%ebp
+  802235:	53                   	push   %ebx
+  802236:	83 ec 10             	sub    $0x10,%esp
+  802239:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80223c:	53                   	push   %ebx
+  80223d:	e8 87 e6 ff ff       	call   8008c9 <strlen>
+  802242:	83 c4 10             	add    $0x10,%esp
+  802245:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80224a:	7f 25                	jg     802271 <remove+0x3f>
+  80224c:	83 ec 08             	sub    $0x8,%esp
+  80224f:	53                   	push   %ebx
+  802250:	68 00 60 80 00       	push   $0x806000
+  802255:	e8 bb e6 ff ff       	call   800915 <strcpy>
+  80225a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802264:	e8 af f9 ff ff       	call   801c18 <fsipc>
+  802269:	83 c4 10             	add    $0x10,%esp
+  80226c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80226f:	c9                   	leave
+  802270:	c3                   	ret
+  802271:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802276:	eb f4                	jmp    80226c <remove+0x3a>
+
+00802278 <sync>:
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	83 ec 08             	sub    $0x8,%esp
+  80227e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802283:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802288:	e8 8b f9 ff ff       	call   801c18 <fsipc>
+  80228d:	c9                   	leave
+  80228e:	c3                   	ret
+
+0080228f <devsock_stat>:
+  80228f:	55                   	push   %ebp
+  802290:	89 e5                	mov    %esp,%ebp
+  802292:	83 ec 10             	sub    $0x10,%esp
+  802295:	68 80 37 80 00       	push   $0x803780
+  80229a:	ff 75 0c             	push   0xc(%ebp)
+  80229d:	e8 73 e6 ff ff       	call   800915 <strcpy>
+  8022a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a7:	c9                   	leave
+  8022a8:	c3                   	ret
+
+008022a9 <devsock_close>:
+  8022a9:	55                   	push   %ebp
+  8022aa:	89 e5                	mov    %esp,%ebp
+  8022ac:	53                   	push   %ebx
+  8022ad:	83 ec 10             	sub    $0x10,%esp
+  8022b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022b3:	53                   	push   %ebx
+  8022b4:	e8 99 0d 00 00       	call   803052 <pageref>
+  8022b9:	89 c2                	mov    %eax,%edx
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c3:	83 fa 01             	cmp    $0x1,%edx
+  8022c6:	74 05                	je     8022cd <devsock_close+0x24>
+  8022c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022cb:	c9                   	leave
+  8022cc:	c3                   	ret
+  8022cd:	83 ec 0c             	sub    $0xc,%esp
+  8022d0:	ff 73 0c             	push   0xc(%ebx)
+  8022d3:	e8 aa 02 00 00       	call   802582 <nsipc_close>
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	eb eb                	jmp    8022c8 <devsock_close+0x1f>
+
+008022dd <devsock_write>:
+  8022dd:	55                   	push   %ebp
+  8022de:	89 e5                	mov    %esp,%ebp
+  8022e0:	83 ec 08             	sub    $0x8,%esp
+  8022e3:	6a 00                	push   $0x0
+  8022e5:	ff 75 10             	push   0x10(%ebp)
+  8022e8:	ff 75 0c             	push   0xc(%ebp)
+  8022eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ee:	ff 70 0c             	push   0xc(%eax)
+  8022f1:	e8 6c 03 00 00       	call   802662 <nsipc_send>
+  8022f6:	c9                   	leave
+  8022f7:	c3                   	ret
+
+008022f8 <devsock_read>:
+  8022f8:	55                   	push   %ebp
+  8022f9:	89 e5                	mov    %esp,%ebp
+  8022fb:	83 ec 08             	sub    $0x8,%esp
+  8022fe:	6a 00                	push   $0x0
+  802300:	ff 75 10             	push   0x10(%ebp)
+  802303:	ff 75 0c             	push   0xc(%ebp)
+  802306:	8b 45 08             	mov    0x8(%ebp),%eax
+  802309:	ff 70 0c             	push   0xc(%eax)
+  80230c:	e8 e2 02 00 00       	call   8025f3 <nsipc_recv>
+  802311:	c9                   	leave
+  802312:	c3                   	ret
+
+00802313 <fd2sockid>:
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	83 ec 20             	sub    $0x20,%esp
+  802319:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80231c:	52                   	push   %edx
+  80231d:	50                   	push   %eax
+  80231e:	e8 da f3 ff ff       	call   8016fd <fd_lookup>
+  802323:	83 c4 10             	add    $0x10,%esp
+  802326:	85 c0                	test   %eax,%eax
+  802328:	78 10                	js     80233a <fd2sockid+0x27>
+  80232a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80232d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802333:	39 08                	cmp    %ecx,(%eax)
+  802335:	75 05                	jne    80233c <fd2sockid+0x29>
+  802337:	8b 40 0c             	mov    0xc(%eax),%eax
+  80233a:	c9                   	leave
+  80233b:	c3                   	ret
+  80233c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802341:	eb f7                	jmp    80233a <fd2sockid+0x27>
+
+00802343 <alloc_sockfd>:
+  802343:	55                   	push   %ebp
+  802344:	89 e5                	mov    %esp,%ebp
+  802346:	56                   	push   %esi
+  802347:	53                   	push   %ebx
+  802348:	83 ec 1c             	sub    $0x1c,%esp
+  80234b:	89 c6                	mov    %eax,%esi
+  80234d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802350:	50                   	push   %eax
+  802351:	e8 57 f3 ff ff       	call   8016ad <fd_alloc>
+  802356:	89 c3                	mov    %eax,%ebx
+  802358:	83 c4 10             	add    $0x10,%esp
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	78 43                	js     8023a2 <alloc_sockfd+0x5f>
+  80235f:	83 ec 04             	sub    $0x4,%esp
+  802362:	68 07 04 00 00       	push   $0x407
+  802367:	ff 75 f4             	push   -0xc(%ebp)
+  80236a:	6a 00                	push   $0x0
+  80236c:	e8 04 ea ff ff       	call   800d75 <sys_page_alloc>
+  802371:	89 c3                	mov    %eax,%ebx
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	85 c0                	test   %eax,%eax
+  802378:	78 28                	js     8023a2 <alloc_sockfd+0x5f>
+  80237a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80237d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802383:	89 10                	mov    %edx,(%eax)
+  802385:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802388:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80238f:	89 70 0c             	mov    %esi,0xc(%eax)
+  802392:	83 ec 0c             	sub    $0xc,%esp
+  802395:	50                   	push   %eax
+  802396:	e8 eb f2 ff ff       	call   801686 <fd2num>
+  80239b:	89 c3                	mov    %eax,%ebx
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	eb 0c                	jmp    8023ae <alloc_sockfd+0x6b>
+  8023a2:	83 ec 0c             	sub    $0xc,%esp
+  8023a5:	56                   	push   %esi
+  8023a6:	e8 d7 01 00 00       	call   802582 <nsipc_close>
+  8023ab:	83 c4 10             	add    $0x10,%esp
+  8023ae:	89 d8                	mov    %ebx,%eax
+  8023b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b3:	5b                   	pop    %ebx
+  8023b4:	5e                   	pop    %esi
+  8023b5:	5d                   	pop    %ebp
+  8023b6:	c3                   	ret
+
+008023b7 <accept>:
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	83 ec 08             	sub    $0x8,%esp
+  8023bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c0:	e8 4e ff ff ff       	call   802313 <fd2sockid>
+  8023c5:	85 c0                	test   %eax,%eax
+  8023c7:	78 1b                	js     8023e4 <accept+0x2d>
+  8023c9:	83 ec 04             	sub    $0x4,%esp
+  8023cc:	ff 75 10             	push   0x10(%ebp)
+  8023cf:	ff 75 0c             	push   0xc(%ebp)
+  8023d2:	50                   	push   %eax
+  8023d3:	e8 07 01 00 00       	call   8024df <nsipc_accept>
+  8023d8:	83 c4 10             	add    $0x10,%esp
+  8023db:	85 c0                	test   %eax,%eax
+  8023dd:	78 05                	js     8023e4 <accept+0x2d>
+  8023df:	e8 5f ff ff ff       	call   802343 <alloc_sockfd>
+  8023e4:	c9                   	leave
+  8023e5:	c3                   	ret
+
+008023e6 <bind>:
+  8023e6:	55                   	push   %ebp
+  8023e7:	89 e5                	mov    %esp,%ebp
+  8023e9:	83 ec 08             	sub    $0x8,%esp
+  8023ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ef:	e8 1f ff ff ff       	call   802313 <fd2sockid>
+  8023f4:	85 c0                	test   %eax,%eax
+  8023f6:	78 12                	js     80240a <bind+0x24>
+  8023f8:	83 ec 04             	sub    $0x4,%esp
+  8023fb:	ff 75 10             	push   0x10(%ebp)
+  8023fe:	ff 75 0c             	push   0xc(%ebp)
+  802401:	50                   	push   %eax
+  802402:	e8 24 01 00 00       	call   80252b <nsipc_bind>
+  802407:	83 c4 10             	add    $0x10,%esp
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+
+0080240c <shutdown>:
+  80240c:	55                   	push   %ebp
+  80240d:	89 e5                	mov    %esp,%ebp
+  80240f:	83 ec 08             	sub    $0x8,%esp
+  802412:	8b 45 08             	mov    0x8(%ebp),%eax
+  802415:	e8 f9 fe ff ff       	call   802313 <fd2sockid>
+  80241a:	85 c0                	test   %eax,%eax
+  80241c:	78 0f                	js     80242d <shutdown+0x21>
+  80241e:	83 ec 08             	sub    $0x8,%esp
+  802421:	ff 75 0c             	push   0xc(%ebp)
+  802424:	50                   	push   %eax
+  802425:	e8 36 01 00 00       	call   802560 <nsipc_shutdown>
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	c9                   	leave
+  80242e:	c3                   	ret
+
+0080242f <connect>:
+  80242f:	55                   	push   %ebp
+  802430:	89 e5                	mov    %esp,%ebp
+  802432:	83 ec 08             	sub    $0x8,%esp
+  802435:	8b 45 08             	mov    0x8(%ebp),%eax
+  802438:	e8 d6 fe ff ff       	call   802313 <fd2sockid>
+  80243d:	85 c0                	test   %eax,%eax
+  80243f:	78 12                	js     802453 <connect+0x24>
+  802441:	83 ec 04             	sub    $0x4,%esp
+  802444:	ff 75 10             	push   0x10(%ebp)
+  802447:	ff 75 0c             	push   0xc(%ebp)
+  80244a:	50                   	push   %eax
+  80244b:	e8 4c 01 00 00       	call   80259c <nsipc_connect>
+  802450:	83 c4 10             	add    $0x10,%esp
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+
+00802455 <listen>:
+  802455:	55                   	push   %ebp
+  802456:	89 e5                	mov    %esp,%ebp
+  802458:	83 ec 08             	sub    $0x8,%esp
+  80245b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245e:	e8 b0 fe ff ff       	call   802313 <fd2sockid>
+  802463:	85 c0                	test   %eax,%eax
+  802465:	78 0f                	js     802476 <listen+0x21>
+  802467:	83 ec 08             	sub    $0x8,%esp
+  80246a:	ff 75 0c             	push   0xc(%ebp)
+  80246d:	50                   	push   %eax
+  80246e:	e8 5e 01 00 00       	call   8025d1 <nsipc_listen>
+  802473:	83 c4 10             	add    $0x10,%esp
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+00802478 <socket>:
+  802478:	55                   	push   %ebp
+  802479:	89 e5                	mov    %esp,%ebp
+  80247b:	83 ec 0c             	sub    $0xc,%esp
+  80247e:	ff 75 10             	push   0x10(%ebp)
+  802481:	ff 75 0c             	push   0xc(%ebp)
+  802484:	ff 75 08             	push   0x8(%ebp)
+  802487:	e8 34 02 00 00       	call   8026c0 <nsipc_socket>
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	85 c0                	test   %eax,%eax
+  802491:	78 05                	js     802498 <socket+0x20>
+  802493:	e8 ab fe ff ff       	call   802343 <alloc_sockfd>
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+
+0080249a <nsipc>:
+  80249a:	55                   	push   %ebp
+  80249b:	89 e5                	mov    %esp,%ebp
+  80249d:	53                   	push   %ebx
+  80249e:	83 ec 04             	sub    $0x4,%esp
+  8024a1:	89 c3                	mov    %eax,%ebx
+  8024a3:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8024aa:	74 1f                	je     8024cb <nsipc+0x31>
+  8024ac:	83 ec 08             	sub    $0x8,%esp
+  8024af:	6a 00                	push   $0x0
+  8024b1:	6a 00                	push   $0x0
+  8024b3:	6a 07                	push   $0x7
+  8024b5:	68 00 70 80 00       	push   $0x807000
+  8024ba:	53                   	push   %ebx
+  8024bb:	ff 35 0c 50 80 00    	push   0x80500c
+  8024c1:	e8 d7 09 00 00       	call   802e9d <ipc_call>
+  8024c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+  8024cb:	83 ec 0c             	sub    $0xc,%esp
+  8024ce:	6a 03                	push   $0x3
+  8024d0:	e8 63 0b 00 00       	call   803038 <ipc_find_env>
+  8024d5:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	eb cd                	jmp    8024ac <nsipc+0x12>
+
+008024df <nsipc_accept>:
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	53                   	push   %ebx
+  8024e3:	83 ec 04             	sub    $0x4,%esp
+  8024e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024f3:	e8 a2 ff ff ff       	call   80249a <nsipc>
+  8024f8:	89 c3                	mov    %eax,%ebx
+  8024fa:	85 c0                	test   %eax,%eax
+  8024fc:	79 07                	jns    802505 <nsipc_accept+0x26>
+  8024fe:	89 d8                	mov    %ebx,%eax
+  802500:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802503:	c9                   	leave
+  802504:	c3                   	ret
+  802505:	83 ec 04             	sub    $0x4,%esp
+  802508:	ff 35 10 70 80 00    	push   0x807010
+  80250e:	68 00 70 80 00       	push   $0x807000
+  802513:	ff 75 0c             	push   0xc(%ebp)
+  802516:	e8 aa e5 ff ff       	call   800ac5 <memmove>
+  80251b:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802521:	8b 45 10             	mov    0x10(%ebp),%eax
+  802524:	89 10                	mov    %edx,(%eax)
+  802526:	83 c4 10             	add    $0x10,%esp
+  802529:	eb d3                	jmp    8024fe <nsipc_accept+0x1f>
+
+0080252b <nsipc_bind>:
+  80252b:	55                   	push   %ebp
+  80252c:	89 e5                	mov    %esp,%ebp
+  80252e:	53                   	push   %ebx
+  80252f:	83 ec 08             	sub    $0x8,%esp
+  802532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802535:	8b 45 08             	mov    0x8(%ebp),%eax
+  802538:	a3 00 70 80 00       	mov    %eax,0x807000
+  80253d:	53                   	push   %ebx
+  80253e:	ff 75 0c             	push   0xc(%ebp)
+  802541:	68 04 70 80 00       	push   $0x807004
+  802546:	e8 7a e5 ff ff       	call   800ac5 <memmove>
+  80254b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802551:	b8 02 00 00 00       	mov    $0x2,%eax
+  802556:	e8 3f ff ff ff       	call   80249a <nsipc>
+  80255b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80255e:	c9                   	leave
+  80255f:	c3                   	ret
+
+00802560 <nsipc_shutdown>:
+  802560:	55                   	push   %ebp
+  802561:	89 e5                	mov    %esp,%ebp
+  802563:	83 ec 08             	sub    $0x8,%esp
+  802566:	8b 45 08             	mov    0x8(%ebp),%eax
+  802569:	a3 00 70 80 00       	mov    %eax,0x807000
+  80256e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802571:	a3 04 70 80 00       	mov    %eax,0x807004
+  802576:	b8 03 00 00 00       	mov    $0x3,%eax
+  80257b:	e8 1a ff ff ff       	call   80249a <nsipc>
+  802580:	c9                   	leave
+  802581:	c3                   	ret
+
+00802582 <nsipc_close>:
+  802582:	55                   	push   %ebp
+  802583:	89 e5                	mov    %esp,%ebp
+  802585:	83 ec 08             	sub    $0x8,%esp
+  802588:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802590:	b8 04 00 00 00       	mov    $0x4,%eax
+  802595:	e8 00 ff ff ff       	call   80249a <nsipc>
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+0080259c <nsipc_connect>:
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	53                   	push   %ebx
+  8025a0:	83 ec 08             	sub    $0x8,%esp
+  8025a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025ae:	53                   	push   %ebx
+  8025af:	ff 75 0c             	push   0xc(%ebp)
+  8025b2:	68 04 70 80 00       	push   $0x807004
+  8025b7:	e8 09 e5 ff ff       	call   800ac5 <memmove>
+  8025bc:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8025c2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025c7:	e8 ce fe ff ff       	call   80249a <nsipc>
+  8025cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+
+008025d1 <nsipc_listen>:
+  8025d1:	55                   	push   %ebp
+  8025d2:	89 e5                	mov    %esp,%ebp
+  8025d4:	83 ec 08             	sub    $0x8,%esp
+  8025d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025da:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e2:	a3 04 70 80 00       	mov    %eax,0x807004
+  8025e7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025ec:	e8 a9 fe ff ff       	call   80249a <nsipc>
+  8025f1:	c9                   	leave
+  8025f2:	c3                   	ret
+
+008025f3 <nsipc_recv>:
+  8025f3:	55                   	push   %ebp
+  8025f4:	89 e5                	mov    %esp,%ebp
+  8025f6:	56                   	push   %esi
+  8025f7:	53                   	push   %ebx
+  8025f8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8025fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025fe:	a3 00 70 80 00       	mov    %eax,0x807000
+  802603:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80260c:	a3 08 70 80 00       	mov    %eax,0x807008
+  802611:	b8 07 00 00 00       	mov    $0x7,%eax
+  802616:	e8 7f fe ff ff       	call   80249a <nsipc>
+  80261b:	89 c3                	mov    %eax,%ebx
+  80261d:	85 c0                	test   %eax,%eax
+  80261f:	78 22                	js     802643 <nsipc_recv+0x50>
+  802621:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802626:	39 c6                	cmp    %eax,%esi
+  802628:	0f 4e c6             	cmovle %esi,%eax
+  80262b:	39 c3                	cmp    %eax,%ebx
+  80262d:	7f 1d                	jg     80264c <nsipc_recv+0x59>
+  80262f:	83 ec 04             	sub    $0x4,%esp
+  802632:	53                   	push   %ebx
+  802633:	68 00 70 80 00       	push   $0x807000
+  802638:	ff 75 0c             	push   0xc(%ebp)
+  80263b:	e8 85 e4 ff ff       	call   800ac5 <memmove>
+  802640:	83 c4 10             	add    $0x10,%esp
+  802643:	89 d8                	mov    %ebx,%eax
+  802645:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802648:	5b                   	pop    %ebx
+  802649:	5e                   	pop    %esi
+  80264a:	5d                   	pop    %ebp
+  80264b:	c3                   	ret
+  80264c:	68 8c 37 80 00       	push   $0x80378c
+  802651:	68 a1 37 80 00       	push   $0x8037a1
+  802656:	6a 60                	push   $0x60
+  802658:	68 b6 37 80 00       	push   $0x8037b6
+  80265d:	e8 e1 da ff ff       	call   800143 <_panic>
+
+00802662 <nsipc_send>:
+  802662:	55                   	push   %ebp
+  802663:	89 e5                	mov    %esp,%ebp
+  802665:	53                   	push   %ebx
+  802666:	83 ec 04             	sub    $0x4,%esp
+  802669:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80266c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80266f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802674:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80267a:	7f 2e                	jg     8026aa <nsipc_send+0x48>
+  80267c:	83 ec 04             	sub    $0x4,%esp
+  80267f:	53                   	push   %ebx
+  802680:	ff 75 0c             	push   0xc(%ebp)
+  802683:	68 0c 70 80 00       	push   $0x80700c
+  802688:	e8 38 e4 ff ff       	call   800ac5 <memmove>
+  80268d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802693:	8b 45 14             	mov    0x14(%ebp),%eax
+  802696:	a3 08 70 80 00       	mov    %eax,0x807008
+  80269b:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026a0:	e8 f5 fd ff ff       	call   80249a <nsipc>
+  8026a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a8:	c9                   	leave
+  8026a9:	c3                   	ret
+  8026aa:	68 c2 37 80 00       	push   $0x8037c2
+  8026af:	68 a1 37 80 00       	push   $0x8037a1
+  8026b4:	6a 6b                	push   $0x6b
+  8026b6:	68 b6 37 80 00       	push   $0x8037b6
+  8026bb:	e8 83 da ff ff       	call   800143 <_panic>
+
+008026c0 <nsipc_socket>:
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	83 ec 08             	sub    $0x8,%esp
+  8026c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026d1:	a3 04 70 80 00       	mov    %eax,0x807004
+  8026d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026d9:	a3 08 70 80 00       	mov    %eax,0x807008
+  8026de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026e3:	e8 b2 fd ff ff       	call   80249a <nsipc>
+  8026e8:	c9                   	leave
+  8026e9:	c3                   	ret
+
+008026ea <devpipe_stat>:
+  8026ea:	55                   	push   %ebp
+  8026eb:	89 e5                	mov    %esp,%ebp
+  8026ed:	56                   	push   %esi
+  8026ee:	53                   	push   %ebx
+  8026ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026f2:	83 ec 0c             	sub    $0xc,%esp
+  8026f5:	ff 75 08             	push   0x8(%ebp)
+  8026f8:	e8 99 ef ff ff       	call   801696 <fd2data>
+  8026fd:	89 c6                	mov    %eax,%esi
+  8026ff:	83 c4 08             	add    $0x8,%esp
+  802702:	68 ce 37 80 00       	push   $0x8037ce
+  802707:	53                   	push   %ebx
+  802708:	e8 08 e2 ff ff       	call   800915 <strcpy>
+  80270d:	8b 46 04             	mov    0x4(%esi),%eax
+  802710:	2b 06                	sub    (%esi),%eax
+  802712:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802718:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80271f:	00 00 00 
+  802722:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802729:	40 80 00 
+  80272c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802731:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802734:	5b                   	pop    %ebx
+  802735:	5e                   	pop    %esi
+  802736:	5d                   	pop    %ebp
+  802737:	c3                   	ret
+
+00802738 <devpipe_close>:
+  802738:	55                   	push   %ebp
+  802739:	89 e5                	mov    %esp,%ebp
+  80273b:	53                   	push   %ebx
+  80273c:	83 ec 0c             	sub    $0xc,%esp
+  80273f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802742:	53                   	push   %ebx
+  802743:	6a 00                	push   $0x0
+  802745:	e8 fd e6 ff ff       	call   800e47 <sys_page_unmap>
+  80274a:	89 1c 24             	mov    %ebx,(%esp)
+  80274d:	e8 44 ef ff ff       	call   801696 <fd2data>
+  802752:	83 c4 08             	add    $0x8,%esp
+  802755:	50                   	push   %eax
+  802756:	6a 00                	push   $0x0
+  802758:	e8 ea e6 ff ff       	call   800e47 <sys_page_unmap>
+  80275d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802760:	c9                   	leave
+  802761:	c3                   	ret
+
+00802762 <_pipeisclosed>:
+  802762:	55                   	push   %ebp
+  802763:	89 e5                	mov    %esp,%ebp
+  802765:	57                   	push   %edi
+  802766:	56                   	push   %esi
+  802767:	53                   	push   %ebx
+  802768:	83 ec 1c             	sub    $0x1c,%esp
+  80276b:	89 c7                	mov    %eax,%edi
+  80276d:	89 d6                	mov    %edx,%esi
+  80276f:	a1 10 50 80 00       	mov    0x805010,%eax
+  802774:	8b 58 58             	mov    0x58(%eax),%ebx
+  802777:	83 ec 0c             	sub    $0xc,%esp
+  80277a:	57                   	push   %edi
+  80277b:	e8 d2 08 00 00       	call   803052 <pageref>
+  802780:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802783:	89 34 24             	mov    %esi,(%esp)
+  802786:	e8 c7 08 00 00       	call   803052 <pageref>
+  80278b:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  802791:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802794:	83 c4 10             	add    $0x10,%esp
+  802797:	39 cb                	cmp    %ecx,%ebx
+  802799:	74 1b                	je     8027b6 <_pipeisclosed+0x54>
+  80279b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80279e:	75 cf                	jne    80276f <_pipeisclosed+0xd>
+  8027a0:	8b 42 58             	mov    0x58(%edx),%eax
+  8027a3:	6a 01                	push   $0x1
+  8027a5:	50                   	push   %eax
+  8027a6:	53                   	push   %ebx
+  8027a7:	68 d5 37 80 00       	push   $0x8037d5
+  8027ac:	e8 6d da ff ff       	call   80021e <cprintf>
+  8027b1:	83 c4 10             	add    $0x10,%esp
+  8027b4:	eb b9                	jmp    80276f <_pipeisclosed+0xd>
+  8027b6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027b9:	0f 94 c0             	sete   %al
+  8027bc:	0f b6 c0             	movzbl %al,%eax
+  8027bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c2:	5b                   	pop    %ebx
+  8027c3:	5e                   	pop    %esi
+  8027c4:	5f                   	pop    %edi
+  8027c5:	5d                   	pop    %ebp
+  8027c6:	c3                   	ret
+
+008027c7 <devpipe_write>:
+  8027c7:	55                   	push   %ebp
+  8027c8:	89 e5                	mov    %esp,%ebp
+  8027ca:	57                   	push   %edi
+  8027cb:	56                   	push   %esi
+  8027cc:	53                   	push   %ebx
+  8027cd:	83 ec 28             	sub    $0x28,%esp
+  8027d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027d3:	56                   	push   %esi
+  8027d4:	e8 bd ee ff ff       	call   801696 <fd2data>
+  8027d9:	89 c3                	mov    %eax,%ebx
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027e7:	74 5c                	je     802845 <devpipe_write+0x7e>
+  8027e9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027ec:	8b 0b                	mov    (%ebx),%ecx
+  8027ee:	8d 51 20             	lea    0x20(%ecx),%edx
+  8027f1:	39 d0                	cmp    %edx,%eax
+  8027f3:	72 1e                	jb     802813 <devpipe_write+0x4c>
+  8027f5:	89 da                	mov    %ebx,%edx
+  8027f7:	89 f0                	mov    %esi,%eax
+  8027f9:	e8 64 ff ff ff       	call   802762 <_pipeisclosed>
+  8027fe:	85 c0                	test   %eax,%eax
+  802800:	75 48                	jne    80284a <devpipe_write+0x83>
+  802802:	e8 23 e5 ff ff       	call   800d2a <sys_yield>
+  802807:	8b 43 04             	mov    0x4(%ebx),%eax
+  80280a:	8b 0b                	mov    (%ebx),%ecx
+  80280c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80280f:	39 d0                	cmp    %edx,%eax
+  802811:	73 e2                	jae    8027f5 <devpipe_write+0x2e>
+  802813:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802816:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80281a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80281d:	89 c2                	mov    %eax,%edx
+  80281f:	c1 fa 1f             	sar    $0x1f,%edx
+  802822:	89 d1                	mov    %edx,%ecx
+  802824:	c1 e9 1b             	shr    $0x1b,%ecx
+  802827:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80282a:	83 e2 1f             	and    $0x1f,%edx
+  80282d:	29 ca                	sub    %ecx,%edx
+  80282f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802833:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802837:	83 c0 01             	add    $0x1,%eax
+  80283a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80283d:	83 c7 01             	add    $0x1,%edi
+  802840:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802843:	75 a4                	jne    8027e9 <devpipe_write+0x22>
+  802845:	8b 45 10             	mov    0x10(%ebp),%eax
+  802848:	eb 05                	jmp    80284f <devpipe_write+0x88>
+  80284a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802852:	5b                   	pop    %ebx
+  802853:	5e                   	pop    %esi
+  802854:	5f                   	pop    %edi
+  802855:	5d                   	pop    %ebp
+  802856:	c3                   	ret
+
+00802857 <devpipe_read>:
+  802857:	55                   	push   %ebp
+  802858:	89 e5                	mov    %esp,%ebp
+  80285a:	57                   	push   %edi
+  80285b:	56                   	push   %esi
+  80285c:	53                   	push   %ebx
+  80285d:	83 ec 18             	sub    $0x18,%esp
+  802860:	8b 75 08             	mov    0x8(%ebp),%esi
+  802863:	56                   	push   %esi
+  802864:	e8 2d ee ff ff       	call   801696 <fd2data>
+  802869:	89 c3                	mov    %eax,%ebx
+  80286b:	83 c4 10             	add    $0x10,%esp
+  80286e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802873:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802877:	74 45                	je     8028be <devpipe_read+0x67>
+  802879:	8b 03                	mov    (%ebx),%eax
+  80287b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80287e:	75 1d                	jne    80289d <devpipe_read+0x46>
+  802880:	85 ff                	test   %edi,%edi
+  802882:	75 3f                	jne    8028c3 <devpipe_read+0x6c>
+  802884:	89 da                	mov    %ebx,%edx
+  802886:	89 f0                	mov    %esi,%eax
+  802888:	e8 d5 fe ff ff       	call   802762 <_pipeisclosed>
+  80288d:	85 c0                	test   %eax,%eax
+  80288f:	75 3c                	jne    8028cd <devpipe_read+0x76>
+  802891:	e8 94 e4 ff ff       	call   800d2a <sys_yield>
+  802896:	8b 03                	mov    (%ebx),%eax
+  802898:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80289b:	74 e7                	je     802884 <devpipe_read+0x2d>
+  80289d:	99                   	cltd
+  80289e:	c1 ea 1b             	shr    $0x1b,%edx
+  8028a1:	01 d0                	add    %edx,%eax
+  8028a3:	83 e0 1f             	and    $0x1f,%eax
+  8028a6:	29 d0                	sub    %edx,%eax
+  8028a8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028b0:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8028b3:	83 03 01             	addl   $0x1,(%ebx)
+  8028b6:	83 c7 01             	add    $0x1,%edi
+  8028b9:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8028bc:	75 bb                	jne    802879 <devpipe_read+0x22>
+  8028be:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028c1:	eb 02                	jmp    8028c5 <devpipe_read+0x6e>
+  8028c3:	89 f8                	mov    %edi,%eax
+  8028c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c8:	5b                   	pop    %ebx
+  8028c9:	5e                   	pop    %esi
+  8028ca:	5f                   	pop    %edi
+  8028cb:	5d                   	pop    %ebp
+  8028cc:	c3                   	ret
+  8028cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d2:	eb f1                	jmp    8028c5 <devpipe_read+0x6e>
+
+008028d4 <pipe>:
+  8028d4:	55                   	push   %ebp
+  8028d5:	89 e5                	mov    %esp,%ebp
+  8028d7:	56                   	push   %esi
+  8028d8:	53                   	push   %ebx
+  8028d9:	83 ec 1c             	sub    $0x1c,%esp
+  8028dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028df:	50                   	push   %eax
+  8028e0:	e8 c8 ed ff ff       	call   8016ad <fd_alloc>
+  8028e5:	89 c3                	mov    %eax,%ebx
+  8028e7:	83 c4 10             	add    $0x10,%esp
+  8028ea:	85 c0                	test   %eax,%eax
+  8028ec:	0f 88 23 01 00 00    	js     802a15 <pipe+0x141>
+  8028f2:	83 ec 04             	sub    $0x4,%esp
+  8028f5:	68 07 04 00 00       	push   $0x407
+  8028fa:	ff 75 f4             	push   -0xc(%ebp)
+  8028fd:	6a 00                	push   $0x0
+  8028ff:	e8 71 e4 ff ff       	call   800d75 <sys_page_alloc>
+  802904:	89 c3                	mov    %eax,%ebx
+  802906:	83 c4 10             	add    $0x10,%esp
+  802909:	85 c0                	test   %eax,%eax
+  80290b:	0f 88 04 01 00 00    	js     802a15 <pipe+0x141>
+  802911:	83 ec 0c             	sub    $0xc,%esp
+  802914:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802917:	50                   	push   %eax
+  802918:	e8 90 ed ff ff       	call   8016ad <fd_alloc>
+  80291d:	89 c3                	mov    %eax,%ebx
+  80291f:	83 c4 10             	add    $0x10,%esp
+  802922:	85 c0                	test   %eax,%eax
+  802924:	0f 88 db 00 00 00    	js     802a05 <pipe+0x131>
+  80292a:	83 ec 04             	sub    $0x4,%esp
+  80292d:	68 07 04 00 00       	push   $0x407
+  802932:	ff 75 f0             	push   -0x10(%ebp)
+  802935:	6a 00                	push   $0x0
+  802937:	e8 39 e4 ff ff       	call   800d75 <sys_page_alloc>
+  80293c:	89 c3                	mov    %eax,%ebx
+  80293e:	83 c4 10             	add    $0x10,%esp
+  802941:	85 c0                	test   %eax,%eax
+  802943:	0f 88 bc 00 00 00    	js     802a05 <pipe+0x131>
+  802949:	83 ec 0c             	sub    $0xc,%esp
+  80294c:	ff 75 f4             	push   -0xc(%ebp)
+  80294f:	e8 42 ed ff ff       	call   801696 <fd2data>
+  802954:	89 c6                	mov    %eax,%esi
+  802956:	83 c4 0c             	add    $0xc,%esp
+  802959:	68 07 04 00 00       	push   $0x407
+  80295e:	50                   	push   %eax
+  80295f:	6a 00                	push   $0x0
+  802961:	e8 0f e4 ff ff       	call   800d75 <sys_page_alloc>
+  802966:	89 c3                	mov    %eax,%ebx
+  802968:	83 c4 10             	add    $0x10,%esp
+  80296b:	85 c0                	test   %eax,%eax
+  80296d:	0f 88 82 00 00 00    	js     8029f5 <pipe+0x121>
+  802973:	83 ec 0c             	sub    $0xc,%esp
+  802976:	ff 75 f0             	push   -0x10(%ebp)
+  802979:	e8 18 ed ff ff       	call   801696 <fd2data>
+  80297e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802985:	50                   	push   %eax
+  802986:	6a 00                	push   $0x0
+  802988:	56                   	push   %esi
+  802989:	6a 00                	push   $0x0
+  80298b:	e8 28 e4 ff ff       	call   800db8 <sys_page_map>
+  802990:	89 c3                	mov    %eax,%ebx
+  802992:	83 c4 20             	add    $0x20,%esp
+  802995:	85 c0                	test   %eax,%eax
+  802997:	78 4e                	js     8029e7 <pipe+0x113>
+  802999:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80299e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029a1:	89 02                	mov    %eax,(%edx)
+  8029a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029a6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8029ad:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029b0:	89 02                	mov    %eax,(%edx)
+  8029b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029b5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8029bc:	83 ec 0c             	sub    $0xc,%esp
+  8029bf:	ff 75 f4             	push   -0xc(%ebp)
+  8029c2:	e8 bf ec ff ff       	call   801686 <fd2num>
+  8029c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029ca:	89 01                	mov    %eax,(%ecx)
+  8029cc:	83 c4 04             	add    $0x4,%esp
+  8029cf:	ff 75 f0             	push   -0x10(%ebp)
+  8029d2:	e8 af ec ff ff       	call   801686 <fd2num>
+  8029d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029da:	89 41 04             	mov    %eax,0x4(%ecx)
+  8029dd:	83 c4 10             	add    $0x10,%esp
+  8029e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e5:	eb 2e                	jmp    802a15 <pipe+0x141>
+  8029e7:	83 ec 08             	sub    $0x8,%esp
+  8029ea:	56                   	push   %esi
+  8029eb:	6a 00                	push   $0x0
+  8029ed:	e8 55 e4 ff ff       	call   800e47 <sys_page_unmap>
+  8029f2:	83 c4 10             	add    $0x10,%esp
+  8029f5:	83 ec 08             	sub    $0x8,%esp
+  8029f8:	ff 75 f0             	push   -0x10(%ebp)
+  8029fb:	6a 00                	push   $0x0
+  8029fd:	e8 45 e4 ff ff       	call   800e47 <sys_page_unmap>
+  802a02:	83 c4 10             	add    $0x10,%esp
+  802a05:	83 ec 08             	sub    $0x8,%esp
+  802a08:	ff 75 f4             	push   -0xc(%ebp)
+  802a0b:	6a 00                	push   $0x0
+  802a0d:	e8 35 e4 ff ff       	call   800e47 <sys_page_unmap>
+  802a12:	83 c4 10             	add    $0x10,%esp
+  802a15:	89 d8                	mov    %ebx,%eax
+  802a17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a1a:	5b                   	pop    %ebx
+  802a1b:	5e                   	pop    %esi
+  802a1c:	5d                   	pop    %ebp
+  802a1d:	c3                   	ret
+
+00802a1e <pipeisclosed>:
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	83 ec 20             	sub    $0x20,%esp
+  802a24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a27:	50                   	push   %eax
+  802a28:	ff 75 08             	push   0x8(%ebp)
+  802a2b:	e8 cd ec ff ff       	call   8016fd <fd_lookup>
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	78 18                	js     802a4f <pipeisclosed+0x31>
+  802a37:	83 ec 0c             	sub    $0xc,%esp
+  802a3a:	ff 75 f4             	push   -0xc(%ebp)
+  802a3d:	e8 54 ec ff ff       	call   801696 <fd2data>
+  802a42:	89 c2                	mov    %eax,%edx
+  802a44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a47:	e8 16 fd ff ff       	call   802762 <_pipeisclosed>
+  802a4c:	83 c4 10             	add    $0x10,%esp
+  802a4f:	c9                   	leave
+  802a50:	c3                   	ret
+
+00802a51 <ipcring_init>:
+  802a51:	55                   	push   %ebp
+  802a52:	89 e5                	mov    %esp,%ebp
+  802a54:	53                   	push   %ebx
+  802a55:	83 ec 08             	sub    $0x8,%esp
+  802a58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a5b:	6a 60                	push   $0x60
+  802a5d:	6a 00                	push   $0x0
+  802a5f:	53                   	push   %ebx
+  802a60:	e8 2b e0 ff ff       	call   800a90 <memset>
+  802a65:	a1 10 50 80 00       	mov    0x805010,%eax
+  802a6a:	8b 40 48             	mov    0x48(%eax),%eax
+  802a6d:	89 03                	mov    %eax,(%ebx)
+  802a6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a72:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a75:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a78:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a7b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a7e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a81:	83 c4 10             	add    $0x10,%esp
+  802a84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a87:	c9                   	leave
+  802a88:	c3                   	ret
+
+00802a89 <ipcring_req_slot>:
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8f:	8b 50 10             	mov    0x10(%eax),%edx
+  802a92:	8b 48 18             	mov    0x18(%eax),%ecx
+  802a95:	29 ca                	sub    %ecx,%edx
+  802a97:	83 fa 07             	cmp    $0x7,%edx
+  802a9a:	77 0c                	ja     802aa8 <ipcring_req_slot+0x1f>
+  802a9c:	8b 50 10             	mov    0x10(%eax),%edx
+  802a9f:	83 e2 07             	and    $0x7,%edx
+  802aa2:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802aa6:	5d                   	pop    %ebp
+  802aa7:	c3                   	ret
+  802aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aad:	eb f7                	jmp    802aa6 <ipcring_req_slot+0x1d>
+
+00802aaf <ipcring_req_push>:
+  802aaf:	55                   	push   %ebp
+  802ab0:	89 e5                	mov    %esp,%ebp
+  802ab2:	83 ec 08             	sub    $0x8,%esp
+  802ab5:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ab8:	8b 42 10             	mov    0x10(%edx),%eax
+  802abb:	83 c0 01             	add    $0x1,%eax
+  802abe:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac7:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802acb:	85 c0                	test   %eax,%eax
+  802acd:	75 02                	jne    802ad1 <ipcring_req_push+0x22>
+  802acf:	c9                   	leave
+  802ad0:	c3                   	ret
+  802ad1:	6a 00                	push   $0x0
+  802ad3:	68 00 00 80 ee       	push   $0xee800000
+  802ad8:	ff 72 08             	push   0x8(%edx)
+  802adb:	ff 72 04             	push   0x4(%edx)
+  802ade:	e8 ca e5 ff ff       	call   8010ad <sys_ipc_send>
+  802ae3:	83 c4 10             	add    $0x10,%esp
+  802ae6:	eb e7                	jmp    802acf <ipcring_req_push+0x20>
+
+00802ae8 <ipcring_rsp_wait>:
+  802ae8:	55                   	push   %ebp
+  802ae9:	89 e5                	mov    %esp,%ebp
+  802aeb:	53                   	push   %ebx
+  802aec:	83 ec 04             	sub    $0x4,%esp
+  802aef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802af2:	8b 53 18             	mov    0x18(%ebx),%edx
+  802af5:	8b 43 10             	mov    0x10(%ebx),%eax
+  802af8:	39 c2                	cmp    %eax,%edx
+  802afa:	74 3c                	je     802b38 <ipcring_rsp_wait+0x50>
+  802afc:	8b 53 14             	mov    0x14(%ebx),%edx
+  802aff:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b02:	39 c2                	cmp    %eax,%edx
+  802b04:	75 23                	jne    802b29 <ipcring_rsp_wait+0x41>
+  802b06:	83 ec 08             	sub    $0x8,%esp
+  802b09:	6a 00                	push   $0x0
+  802b0b:	6a 00                	push   $0x0
+  802b0d:	6a 00                	push   $0x0
+  802b0f:	6a 00                	push   $0x0
+  802b11:	ff 73 0c             	push   0xc(%ebx)
+  802b14:	ff 73 04             	push   0x4(%ebx)
+  802b17:	e8 81 03 00 00       	call   802e9d <ipc_call>
+  802b1c:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b1f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b22:	83 c4 20             	add    $0x20,%esp
+  802b25:	39 c2                	cmp    %eax,%edx
+  802b27:	74 dd                	je     802b06 <ipcring_rsp_wait+0x1e>
+  802b29:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b2c:	83 e0 07             	and    $0x7,%eax
+  802b2f:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802b33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b36:	c9                   	leave
+  802b37:	c3                   	ret
+  802b38:	68 f0 37 80 00       	push   $0x8037f0
+  802b3d:	68 a1 37 80 00       	push   $0x8037a1
+  802b42:	6a 3b                	push   $0x3b
+  802b44:	68 11 38 80 00       	push   $0x803811
+  802b49:	e8 f5 d5 ff ff       	call   800143 <_panic>
+
+00802b4e <ipcring_rsp_pop>:
+  802b4e:	55                   	push   %ebp
+  802b4f:	89 e5                	mov    %esp,%ebp
+  802b51:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b54:	8b 42 18             	mov    0x18(%edx),%eax
+  802b57:	83 c0 01             	add    $0x1,%eax
+  802b5a:	89 42 18             	mov    %eax,0x18(%edx)
+  802b5d:	5d                   	pop    %ebp
+  802b5e:	c3                   	ret
+
+00802b5f <ipcring_server_init>:
+  802b5f:	55                   	push   %ebp
+  802b60:	89 e5                	mov    %esp,%ebp
+  802b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b68:	89 10                	mov    %edx,(%eax)
+  802b6a:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b6d:	89 50 04             	mov    %edx,0x4(%eax)
+  802b70:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802b77:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802b7e:	5d                   	pop    %ebp
+  802b7f:	c3                   	ret
+
+00802b80 <ipcring_req_avail>:
+  802b80:	55                   	push   %ebp
+  802b81:	89 e5                	mov    %esp,%ebp
+  802b83:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b86:	8b 02                	mov    (%edx),%eax
+  802b88:	8b 40 10             	mov    0x10(%eax),%eax
+  802b8b:	2b 42 08             	sub    0x8(%edx),%eax
+  802b8e:	ba 08 00 00 00       	mov    $0x8,%edx
+  802b93:	39 d0                	cmp    %edx,%eax
+  802b95:	0f 47 c2             	cmova  %edx,%eax
+  802b98:	5d                   	pop    %ebp
+  802b99:	c3                   	ret
+
+00802b9a <ipcring_req_peek>:
+  802b9a:	55                   	push   %ebp
+  802b9b:	89 e5                	mov    %esp,%ebp
+  802b9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ba0:	8b 42 08             	mov    0x8(%edx),%eax
+  802ba3:	83 e0 07             	and    $0x7,%eax
+  802ba6:	8b 12                	mov    (%edx),%edx
+  802ba8:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802bac:	5d                   	pop    %ebp
+  802bad:	c3                   	ret
+
+00802bae <ipcring_rsp_push>:
+  802bae:	55                   	push   %ebp
+  802baf:	89 e5                	mov    %esp,%ebp
+  802bb1:	83 ec 08             	sub    $0x8,%esp
+  802bb4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bb7:	8b 41 08             	mov    0x8(%ecx),%eax
+  802bba:	83 c0 01             	add    $0x1,%eax
+  802bbd:	89 41 08             	mov    %eax,0x8(%ecx)
+  802bc0:	8b 11                	mov    (%ecx),%edx
+  802bc2:	83 c2 14             	add    $0x14,%edx
+  802bc5:	f0 87 02             	lock xchg %eax,(%edx)
+  802bc8:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802bcc:	75 02                	jne    802bd0 <ipcring_rsp_push+0x22>
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+  802bd0:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802bd7:	6a 00                	push   $0x0
+  802bd9:	68 00 00 80 ee       	push   $0xee800000
+  802bde:	6a 00                	push   $0x0
+  802be0:	ff 71 04             	push   0x4(%ecx)
+  802be3:	e8 e8 e3 ff ff       	call   800fd0 <sys_ipc_try_send>
+  802be8:	83 c4 10             	add    $0x10,%esp
+  802beb:	eb e1                	jmp    802bce <ipcring_rsp_push+0x20>
+
+00802bed <ipcring_client_wait>:
+  802bed:	55                   	push   %ebp
+  802bee:	89 e5                	mov    %esp,%ebp
+  802bf0:	83 ec 08             	sub    $0x8,%esp
+  802bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf6:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802bfd:	8b 10                	mov    (%eax),%edx
+  802bff:	8b 52 18             	mov    0x18(%edx),%edx
+  802c02:	3b 50 08             	cmp    0x8(%eax),%edx
+  802c05:	75 02                	jne    802c09 <ipcring_client_wait+0x1c>
+  802c07:	c9                   	leave
+  802c08:	c3                   	ret
+  802c09:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802c10:	6a 00                	push   $0x0
+  802c12:	68 00 00 80 ee       	push   $0xee800000
+  802c17:	6a 00                	push   $0x0
+  802c19:	ff 70 04             	push   0x4(%eax)
+  802c1c:	e8 af e3 ff ff       	call   800fd0 <sys_ipc_try_send>
+  802c21:	83 c4 10             	add    $0x10,%esp
+  802c24:	eb e1                	jmp    802c07 <ipcring_client_wait+0x1a>
+
+00802c26 <ipcring_server_sleep>:
+  802c26:	55                   	push   %ebp
+  802c27:	89 e5                	mov    %esp,%ebp
+  802c29:	53                   	push   %ebx
+  802c2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c2d:	8b 01                	mov    (%ecx),%eax
+  802c2f:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802c32:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c37:	f0 87 02             	lock xchg %eax,(%edx)
+  802c3a:	8b 11                	mov    (%ecx),%edx
+  802c3c:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802c3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c44:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802c47:	74 0e                	je     802c57 <ipcring_server_sleep+0x31>
+  802c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4e:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c5a:	c9                   	leave
+  802c5b:	c3                   	ret
+
+00802c5c <devcons_close>:
+  802c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c61:	c3                   	ret
+
+00802c62 <devcons_stat>:
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	83 ec 10             	sub    $0x10,%esp
+  802c68:	68 1f 38 80 00       	push   $0x80381f
+  802c6d:	ff 75 0c             	push   0xc(%ebp)
+  802c70:	e8 a0 dc ff ff       	call   800915 <strcpy>
+  802c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <devcons_write>:
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	57                   	push   %edi
+  802c80:	56                   	push   %esi
+  802c81:	53                   	push   %ebx
+  802c82:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802c88:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802c8b:	85 ff                	test   %edi,%edi
+  802c8d:	74 51                	je     802ce0 <devcons_write+0x64>
+  802c8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c99:	89 fb                	mov    %edi,%ebx
+  802c9b:	29 c3                	sub    %eax,%ebx
+  802c9d:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802ca2:	39 d3                	cmp    %edx,%ebx
+  802ca4:	0f 47 da             	cmova  %edx,%ebx
+  802ca7:	83 ec 04             	sub    $0x4,%esp
+  802caa:	53                   	push   %ebx
+  802cab:	03 45 0c             	add    0xc(%ebp),%eax
+  802cae:	50                   	push   %eax
+  802caf:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802cb5:	50                   	push   %eax
+  802cb6:	e8 0a de ff ff       	call   800ac5 <memmove>
+  802cbb:	83 c4 08             	add    $0x8,%esp
+  802cbe:	53                   	push   %ebx
+  802cbf:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802cc5:	50                   	push   %eax
+  802cc6:	e8 c2 df ff ff       	call   800c8d <sys_cputs>
+  802ccb:	01 de                	add    %ebx,%esi
+  802ccd:	89 f0                	mov    %esi,%eax
+  802ccf:	83 c4 10             	add    $0x10,%esp
+  802cd2:	39 fe                	cmp    %edi,%esi
+  802cd4:	72 c3                	jb     802c99 <devcons_write+0x1d>
+  802cd6:	89 f0                	mov    %esi,%eax
+  802cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cdb:	5b                   	pop    %ebx
+  802cdc:	5e                   	pop    %esi
+  802cdd:	5f                   	pop    %edi
+  802cde:	5d                   	pop    %ebp
+  802cdf:	c3                   	ret
+  802ce0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce5:	eb ef                	jmp    802cd6 <devcons_write+0x5a>
+
+00802ce7 <devcons_read>:
+  802ce7:	55                   	push   %ebp
+  802ce8:	89 e5                	mov    %esp,%ebp
+  802cea:	83 ec 08             	sub    $0x8,%esp
+  802ced:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802cf6:	75 07                	jne    802cff <devcons_read+0x18>
+  802cf8:	eb 1f                	jmp    802d19 <devcons_read+0x32>
+  802cfa:	e8 2b e0 ff ff       	call   800d2a <sys_yield>
+  802cff:	e8 a7 df ff ff       	call   800cab <sys_cgetc>
+  802d04:	85 c0                	test   %eax,%eax
+  802d06:	74 f2                	je     802cfa <devcons_read+0x13>
+  802d08:	78 0f                	js     802d19 <devcons_read+0x32>
+  802d0a:	83 f8 04             	cmp    $0x4,%eax
+  802d0d:	74 0c                	je     802d1b <devcons_read+0x34>
+  802d0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d12:	88 02                	mov    %al,(%edx)
+  802d14:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d19:	c9                   	leave
+  802d1a:	c3                   	ret
+  802d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d20:	eb f7                	jmp    802d19 <devcons_read+0x32>
+
+00802d22 <cputchar>:
+  802d22:	55                   	push   %ebp
+  802d23:	89 e5                	mov    %esp,%ebp
+  802d25:	83 ec 20             	sub    $0x20,%esp
+  802d28:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2b:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802d2e:	6a 01                	push   $0x1
+  802d30:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d33:	50                   	push   %eax
+  802d34:	e8 54 df ff ff       	call   800c8d <sys_cputs>
+  802d39:	83 c4 10             	add    $0x10,%esp
+  802d3c:	c9                   	leave
+  802d3d:	c3                   	ret
+
+00802d3e <getchar>:
+  802d3e:	55                   	push   %ebp
+  802d3f:	89 e5                	mov    %esp,%ebp
+  802d41:	83 ec 1c             	sub    $0x1c,%esp
+  802d44:	6a 01                	push   $0x1
+  802d46:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d49:	50                   	push   %eax
+  802d4a:	6a 00                	push   $0x0
+  802d4c:	e8 0e ec ff ff       	call   80195f <read>
+  802d51:	83 c4 10             	add    $0x10,%esp
+  802d54:	85 c0                	test   %eax,%eax
+  802d56:	78 06                	js     802d5e <getchar+0x20>
+  802d58:	74 06                	je     802d60 <getchar+0x22>
+  802d5a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802d5e:	c9                   	leave
+  802d5f:	c3                   	ret
+  802d60:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802d65:	eb f7                	jmp    802d5e <getchar+0x20>
+
+00802d67 <iscons>:
+  802d67:	55                   	push   %ebp
+  802d68:	89 e5                	mov    %esp,%ebp
+  802d6a:	83 ec 20             	sub    $0x20,%esp
+  802d6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d70:	50                   	push   %eax
+  802d71:	ff 75 08             	push   0x8(%ebp)
+  802d74:	e8 84 e9 ff ff       	call   8016fd <fd_lookup>
+  802d79:	83 c4 10             	add    $0x10,%esp
+  802d7c:	85 c0                	test   %eax,%eax
+  802d7e:	78 11                	js     802d91 <iscons+0x2a>
+  802d80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d83:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802d89:	39 10                	cmp    %edx,(%eax)
+  802d8b:	0f 94 c0             	sete   %al
+  802d8e:	0f b6 c0             	movzbl %al,%eax
+  802d91:	c9                   	leave
+  802d92:	c3                   	ret
+
+00802d93 <opencons>:
+  802d93:	55                   	push   %ebp
+  802d94:	89 e5                	mov    %esp,%ebp
+  802d96:	83 ec 24             	sub    $0x24,%esp
+  802d99:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d9c:	50                   	push   %eax
+  802d9d:	e8 0b e9 ff ff       	call   8016ad <fd_alloc>
+  802da2:	83 c4 10             	add    $0x10,%esp
+  802da5:	85 c0                	test   %eax,%eax
+  802da7:	78 3a                	js     802de3 <opencons+0x50>
+  802da9:	83 ec 04             	sub    $0x4,%esp
+  802dac:	68 07 04 00 00       	push   $0x407
+  802db1:	ff 75 f4             	push   -0xc(%ebp)
+  802db4:	6a 00                	push   $0x0
+  802db6:	e8 ba df ff ff       	call   800d75 <sys_page_alloc>
+  802dbb:	83 c4 10             	add    $0x10,%esp
+  802dbe:	85 c0                	test   %eax,%eax
+  802dc0:	78 21                	js     802de3 <opencons+0x50>
+  802dc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dc5:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802dcb:	89 10                	mov    %edx,(%eax)
+  802dcd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dd0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802dd7:	83 ec 0c             	sub    $0xc,%esp
+  802dda:	50                   	push   %eax
+  802ddb:	e8 a6 e8 ff ff       	call   801686 <fd2num>
+  802de0:	83 c4 10             	add    $0x10,%esp
+  802de3:	c9                   	leave
+  802de4:	c3                   	ret
+
+00802de5 <ipc_recv>:
+  802de5:	55                   	push   %ebp
+  802de6:	89 e5                	mov    %esp,%ebp
+  802de8:	56                   	push   %esi
+  802de9:	53                   	push   %ebx
+  802dea:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ded:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802df0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802df3:	85 c0                	test   %eax,%eax
+  802df5:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802dfa:	0f 44 c2             	cmove  %edx,%eax
+  802dfd:	83 ec 0c             	sub    $0xc,%esp
+  802e00:	50                   	push   %eax
+  802e01:	e8 1a e2 ff ff       	call   801020 <sys_ipc_recv>
+  802e06:	83 c4 10             	add    $0x10,%esp
+  802e09:	85 c0                	test   %eax,%eax
+  802e0b:	78 2a                	js     802e37 <ipc_recv+0x52>
+  802e0d:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e12:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802e18:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802e1e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e24:	85 f6                	test   %esi,%esi
+  802e26:	74 02                	je     802e2a <ipc_recv+0x45>
+  802e28:	89 0e                	mov    %ecx,(%esi)
+  802e2a:	85 db                	test   %ebx,%ebx
+  802e2c:	74 02                	je     802e30 <ipc_recv+0x4b>
+  802e2e:	89 13                	mov    %edx,(%ebx)
+  802e30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e33:	5b                   	pop    %ebx
+  802e34:	5e                   	pop    %esi
+  802e35:	5d                   	pop    %ebp
+  802e36:	c3                   	ret
+  802e37:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e41:	eb e1                	jmp    802e24 <ipc_recv+0x3f>
+
+00802e43 <ipc_send>:
+  802e43:	55                   	push   %ebp
+  802e44:	89 e5                	mov    %esp,%ebp
+  802e46:	57                   	push   %edi
+  802e47:	56                   	push   %esi
+  802e48:	53                   	push   %ebx
+  802e49:	83 ec 0c             	sub    $0xc,%esp
+  802e4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802e4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e52:	8b 75 14             	mov    0x14(%ebp),%esi
+  802e55:	85 db                	test   %ebx,%ebx
+  802e57:	74 1e                	je     802e77 <ipc_send+0x34>
+  802e59:	56                   	push   %esi
+  802e5a:	53                   	push   %ebx
+  802e5b:	57                   	push   %edi
+  802e5c:	ff 75 08             	push   0x8(%ebp)
+  802e5f:	e8 49 e2 ff ff       	call   8010ad <sys_ipc_send>
+  802e64:	83 c4 10             	add    $0x10,%esp
+  802e67:	85 c0                	test   %eax,%eax
+  802e69:	74 2a                	je     802e95 <ipc_send+0x52>
+  802e6b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e6e:	75 13                	jne    802e83 <ipc_send+0x40>
+  802e70:	e8 b5 de ff ff       	call   800d2a <sys_yield>
+  802e75:	eb e2                	jmp    802e59 <ipc_send+0x16>
+  802e77:	be 00 00 00 00       	mov    $0x0,%esi
+  802e7c:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802e81:	eb d6                	jmp    802e59 <ipc_send+0x16>
+  802e83:	50                   	push   %eax
+  802e84:	68 2c 38 80 00       	push   $0x80382c
+  802e89:	6a 4f                	push   $0x4f
+  802e8b:	68 6f 38 80 00       	push   $0x80386f
+  802e90:	e8 ae d2 ff ff       	call   800143 <_panic>
+  802e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e98:	5b                   	pop    %ebx
+  802e99:	5e                   	pop    %esi
+  802e9a:	5f                   	pop    %edi
+  802e9b:	5d                   	pop    %ebp
+  802e9c:	c3                   	ret
+
+00802e9d <ipc_call>:
+  802e9d:	55                   	push   %ebp
+  802e9e:	89 e5                	mov    %esp,%ebp
+  802ea0:	57                   	push   %edi
+  802ea1:	56                   	push   %esi
+  802ea2:	53                   	push   %ebx
+  802ea3:	83 ec 0c             	sub    $0xc,%esp
+  802ea6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802eaa:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802eaf:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802eb3:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802eb7:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802ebc:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802ec0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ec4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec9:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802ecd:	eb 05                	jmp    802ed4 <ipc_call+0x37>
+  802ecf:	e8 56 de ff ff       	call   800d2a <sys_yield>
+  802ed4:	83 ec 0c             	sub    $0xc,%esp
+  802ed7:	56                   	push   %esi
+  802ed8:	53                   	push   %ebx
+  802ed9:	57                   	push   %edi
+  802eda:	ff 75 0c             	push   0xc(%ebp)
+  802edd:	ff 75 08             	push   0x8(%ebp)
+  802ee0:	e8 18 e2 ff ff       	call   8010fd <sys_ipc_call>
+  802ee5:	83 c4 20             	add    $0x20,%esp
+  802ee8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802eeb:	74 e2                	je     802ecf <ipc_call+0x32>
+  802eed:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802ef0:	74 2d                	je     802f1f <ipc_call+0x82>
+  802ef2:	85 c0                	test   %eax,%eax
+  802ef4:	78 4f                	js     802f45 <ipc_call+0xa8>
+  802ef6:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802efa:	74 10                	je     802f0c <ipc_call+0x6f>
+  802efc:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f01:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f07:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802f0a:	89 02                	mov    %eax,(%edx)
+  802f0c:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f11:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f1a:	5b                   	pop    %ebx
+  802f1b:	5e                   	pop    %esi
+  802f1c:	5f                   	pop    %edi
+  802f1d:	5d                   	pop    %ebp
+  802f1e:	c3                   	ret
+  802f1f:	ff 75 14             	push   0x14(%ebp)
+  802f22:	ff 75 10             	push   0x10(%ebp)
+  802f25:	ff 75 0c             	push   0xc(%ebp)
+  802f28:	ff 75 08             	push   0x8(%ebp)
+  802f2b:	e8 13 ff ff ff       	call   802e43 <ipc_send>
+  802f30:	83 c4 0c             	add    $0xc,%esp
+  802f33:	ff 75 1c             	push   0x1c(%ebp)
+  802f36:	ff 75 18             	push   0x18(%ebp)
+  802f39:	6a 00                	push   $0x0
+  802f3b:	e8 a5 fe ff ff       	call   802de5 <ipc_recv>
+  802f40:	83 c4 10             	add    $0x10,%esp
+  802f43:	eb d2                	jmp    802f17 <ipc_call+0x7a>
+  802f45:	50                   	push   %eax
+  802f46:	68 79 38 80 00       	push   $0x803879
+  802f4b:	6a 6d                	push   $0x6d
+  802f4d:	68 6f 38 80 00       	push   $0x80386f
+  802f52:	e8 ec d1 ff ff       	call   800143 <_panic>
+
+00802f57 <ipc_reply_recv>:
+  802f57:	55                   	push   %ebp
+  802f58:	89 e5                	mov    %esp,%ebp
+  802f5a:	57                   	push   %edi
+  802f5b:	56                   	push   %esi
+  802f5c:	53                   	push   %ebx
+  802f5d:	83 ec 0c             	sub    $0xc,%esp
+  802f60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f63:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802f66:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802f69:	85 db                	test   %ebx,%ebx
+  802f6b:	0f 84 ac 00 00 00    	je     80301d <ipc_reply_recv+0xc6>
+  802f71:	85 f6                	test   %esi,%esi
+  802f73:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f78:	0f 45 c6             	cmovne %esi,%eax
+  802f7b:	83 ec 0c             	sub    $0xc,%esp
+  802f7e:	50                   	push   %eax
+  802f7f:	ff 75 14             	push   0x14(%ebp)
+  802f82:	53                   	push   %ebx
+  802f83:	ff 75 0c             	push   0xc(%ebp)
+  802f86:	ff 75 08             	push   0x8(%ebp)
+  802f89:	e8 90 e1 ff ff       	call   80111e <sys_ipc_reply_recv>
+  802f8e:	83 c4 20             	add    $0x20,%esp
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	78 3a                	js     802fcf <ipc_reply_recv+0x78>
+  802f95:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f99:	74 10                	je     802fab <ipc_reply_recv+0x54>
+  802f9b:	a1 10 50 80 00       	mov    0x805010,%eax
+  802fa0:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802fa6:	8b 55 18             	mov    0x18(%ebp),%edx
+  802fa9:	89 02                	mov    %eax,(%edx)
+  802fab:	85 ff                	test   %edi,%edi
+  802fad:	74 0d                	je     802fbc <ipc_reply_recv+0x65>
+  802faf:	a1 10 50 80 00       	mov    0x805010,%eax
+  802fb4:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802fba:	89 07                	mov    %eax,(%edi)
+  802fbc:	a1 10 50 80 00       	mov    0x805010,%eax
+  802fc1:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fca:	5b                   	pop    %ebx
+  802fcb:	5e                   	pop    %esi
+  802fcc:	5f                   	pop    %edi
+  802fcd:	5d                   	pop    %ebp
+  802fce:	c3                   	ret
+  802fcf:	ff 75 14             	push   0x14(%ebp)
+  802fd2:	53                   	push   %ebx
+  802fd3:	ff 75 0c             	push   0xc(%ebp)
+  802fd6:	ff 75 08             	push   0x8(%ebp)
+  802fd9:	e8 f2 df ff ff       	call   800fd0 <sys_ipc_try_send>
+  802fde:	89 c2                	mov    %eax,%edx
+  802fe0:	c1 ea 1f             	shr    $0x1f,%edx
+  802fe3:	83 c4 10             	add    $0x10,%esp
+  802fe6:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802fe9:	0f 95 c1             	setne  %cl
+  802fec:	84 d1                	test   %dl,%cl
+  802fee:	74 05                	je     802ff5 <ipc_reply_recv+0x9e>
+  802ff0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ff3:	75 12                	jne    803007 <ipc_reply_recv+0xb0>
+  802ff5:	83 ec 04             	sub    $0x4,%esp
+  802ff8:	57                   	push   %edi
+  802ff9:	56                   	push   %esi
+  802ffa:	ff 75 18             	push   0x18(%ebp)
+  802ffd:	e8 e3 fd ff ff       	call   802de5 <ipc_recv>
+  803002:	83 c4 10             	add    $0x10,%esp
+  803005:	eb c0                	jmp    802fc7 <ipc_reply_recv+0x70>
+  803007:	83 ec 04             	sub    $0x4,%esp
+  80300a:	50                   	push   %eax
+  80300b:	ff 75 08             	push   0x8(%ebp)
+  80300e:	68 4c 38 80 00       	push   $0x80384c
+  803013:	e8 06 d2 ff ff       	call   80021e <cprintf>
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	eb d8                	jmp    802ff5 <ipc_reply_recv+0x9e>
+  80301d:	85 f6                	test   %esi,%esi
+  80301f:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803024:	0f 45 c6             	cmovne %esi,%eax
+  803027:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80302c:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803033:	e9 43 ff ff ff       	jmp    802f7b <ipc_reply_recv+0x24>
+
+00803038 <ipc_find_env>:
+  803038:	55                   	push   %ebp
+  803039:	89 e5                	mov    %esp,%ebp
+  80303b:	83 ec 14             	sub    $0x14,%esp
+  80303e:	ff 75 08             	push   0x8(%ebp)
+  803041:	e8 28 df ff ff       	call   800f6e <sys_env_service>
+  803046:	85 c0                	test   %eax,%eax
+  803048:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304d:	0f 48 c2             	cmovs  %edx,%eax
+  803050:	c9                   	leave
+  803051:	c3                   	ret
+
+00803052 <pageref>:
+  803052:	55                   	push   %ebp
+  803053:	89 e5                	mov    %esp,%ebp
+  803055:	8b 45 08             	mov    0x8(%ebp),%eax
+  803058:	89 c2                	mov    %eax,%edx
+  80305a:	c1 ea 16             	shr    $0x16,%edx
+  80305d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803064:	ba 00 00 00 00       	mov    $0x0,%edx
+  803069:	f6 c1 01             	test   $0x1,%cl
+  80306c:	74 22                	je     803090 <pageref+0x3e>
+  80306e:	c1 e8 0c             	shr    $0xc,%eax
+  803071:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803078:	a8 01                	test   $0x1,%al
+  80307a:	74 14                	je     803090 <pageref+0x3e>
+  80307c:	c1 e8 0c             	shr    $0xc,%eax
+  80307f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803082:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803089:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80308d:	0f b7 d2             	movzwl %dx,%edx
+  803090:	89 d0                	mov    %edx,%eax
+  803092:	5d                   	pop    %ebp
+  803093:	c3                   	ret
+
+00803094 <__udivmoddi4>:
+  803094:	55                   	push   %ebp
+  803095:	57                   	push   %edi
+  803096:	56                   	push   %esi
+  803097:	53                   	push   %ebx
+  803098:	83 ec 24             	sub    $0x24,%esp
+  80309b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80309f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8030a3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8030a7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8030ab:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8030af:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8030b3:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8030b7:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8030bb:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8030bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8030ce:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8030d5:	00 
+  8030d6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8030dd:	00 
+  8030de:	89 fb                	mov    %edi,%ebx
+  8030e0:	eb 08                	jmp    8030ea <__udivmoddi4+0x56>
+  8030e2:	83 e9 01             	sub    $0x1,%ecx
+  8030e5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8030e8:	74 68                	je     803152 <__udivmoddi4+0xbe>
+  8030ea:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8030ee:	01 c0                	add    %eax,%eax
+  8030f0:	89 c6                	mov    %eax,%esi
+  8030f2:	89 d7                	mov    %edx,%edi
+  8030f4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030f8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030fc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8030ff:	d3 ea                	shr    %cl,%edx
+  803101:	f6 c1 20             	test   $0x20,%cl
+  803104:	74 04                	je     80310a <__udivmoddi4+0x76>
+  803106:	89 d0                	mov    %edx,%eax
+  803108:	31 d2                	xor    %edx,%edx
+  80310a:	83 e0 01             	and    $0x1,%eax
+  80310d:	89 04 24             	mov    %eax,(%esp)
+  803110:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803117:	00 
+  803118:	8b 04 24             	mov    (%esp),%eax
+  80311b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80311f:	09 f0                	or     %esi,%eax
+  803121:	09 fa                	or     %edi,%edx
+  803123:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803127:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80312b:	39 f0                	cmp    %esi,%eax
+  80312d:	89 d5                	mov    %edx,%ebp
+  80312f:	19 fd                	sbb    %edi,%ebp
+  803131:	72 af                	jb     8030e2 <__udivmoddi4+0x4e>
+  803133:	29 f0                	sub    %esi,%eax
+  803135:	19 fa                	sbb    %edi,%edx
+  803137:	89 cf                	mov    %ecx,%edi
+  803139:	c1 ef 05             	shr    $0x5,%edi
+  80313c:	83 e7 01             	and    $0x1,%edi
+  80313f:	89 fe                	mov    %edi,%esi
+  803141:	83 f6 01             	xor    $0x1,%esi
+  803144:	d3 e6                	shl    %cl,%esi
+  803146:	d3 e7                	shl    %cl,%edi
+  803148:	09 74 24 18          	or     %esi,0x18(%esp)
+  80314c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803150:	eb 90                	jmp    8030e2 <__udivmoddi4+0x4e>
+  803152:	85 db                	test   %ebx,%ebx
+  803154:	74 05                	je     80315b <__udivmoddi4+0xc7>
+  803156:	89 03                	mov    %eax,(%ebx)
+  803158:	89 53 04             	mov    %edx,0x4(%ebx)
+  80315b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80315f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803163:	83 c4 24             	add    $0x24,%esp
+  803166:	5b                   	pop    %ebx
+  803167:	5e                   	pop    %esi
+  803168:	5f                   	pop    %edi
+  803169:	5d                   	pop    %ebp
+  80316a:	c3                   	ret
+
+0080316b <__udivdi3>:
+  80316b:	83 ec 08             	sub    $0x8,%esp
+  80316e:	6a 00                	push   $0x0
+  803170:	ff 74 24 1c          	push   0x1c(%esp)
+  803174:	ff 74 24 1c          	push   0x1c(%esp)
+  803178:	ff 74 24 1c          	push   0x1c(%esp)
+  80317c:	ff 74 24 1c          	push   0x1c(%esp)
+  803180:	e8 0f ff ff ff       	call   803094 <__udivmoddi4>
+  803185:	83 c4 1c             	add    $0x1c,%esp
+  803188:	c3                   	ret
+
+00803189 <__umoddi3>:
+  803189:	83 ec 18             	sub    $0x18,%esp
+  80318c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803190:	50                   	push   %eax
+  803191:	ff 74 24 2c          	push   0x2c(%esp)
+  803195:	ff 74 24 2c          	push   0x2c(%esp)
+  803199:	ff 74 24 2c          	push   0x2c(%esp)
+  80319d:	ff 74 24 2c          	push   0x2c(%esp)
+  8031a1:	e8 ee fe ff ff       	call   803094 <__udivmoddi4>
+  8031a6:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8031aa:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8031ae:	83 c4 2c             	add    $0x2c,%esp
+  8031b1:	c3                   	ret
+
+008031b2 <__divdi3>:
+  8031b2:	53                   	push   %ebx
+  8031b3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8031b7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8031bb:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8031bf:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8031c3:	85 d2                	test   %edx,%edx
+  8031c5:	78 12                	js     8031d9 <__divdi3+0x27>
+  8031c7:	85 db                	test   %ebx,%ebx
+  8031c9:	78 2e                	js     8031f9 <__divdi3+0x47>
+  8031cb:	53                   	push   %ebx
+  8031cc:	51                   	push   %ecx
+  8031cd:	52                   	push   %edx
+  8031ce:	50                   	push   %eax
+  8031cf:	e8 97 ff ff ff       	call   80316b <__udivdi3>
+  8031d4:	83 c4 10             	add    $0x10,%esp
+  8031d7:	eb 1e                	jmp    8031f7 <__divdi3+0x45>
+  8031d9:	f7 d8                	neg    %eax
+  8031db:	83 d2 00             	adc    $0x0,%edx
+  8031de:	f7 da                	neg    %edx
+  8031e0:	85 db                	test   %ebx,%ebx
+  8031e2:	78 2a                	js     80320e <__divdi3+0x5c>
+  8031e4:	53                   	push   %ebx
+  8031e5:	51                   	push   %ecx
+  8031e6:	52                   	push   %edx
+  8031e7:	50                   	push   %eax
+  8031e8:	e8 7e ff ff ff       	call   80316b <__udivdi3>
+  8031ed:	83 c4 10             	add    $0x10,%esp
+  8031f0:	f7 d8                	neg    %eax
+  8031f2:	83 d2 00             	adc    $0x0,%edx
+  8031f5:	f7 da                	neg    %edx
+  8031f7:	5b                   	pop    %ebx
+  8031f8:	c3                   	ret
+  8031f9:	f7 d9                	neg    %ecx
+  8031fb:	83 d3 00             	adc    $0x0,%ebx
+  8031fe:	f7 db                	neg    %ebx
+  803200:	53                   	push   %ebx
+  803201:	51                   	push   %ecx
+  803202:	52                   	push   %edx
+  803203:	50                   	push   %eax
+  803204:	e8 62 ff ff ff       	call   80316b <__udivdi3>
+  803209:	83 c4 10             	add    $0x10,%esp
+  80320c:	eb e2                	jmp    8031f0 <__divdi3+0x3e>
+  80320e:	f7 d9                	neg    %ecx
+  803210:	83 d3 00             	adc    $0x0,%ebx
+  803213:	f7 db                	neg    %ebx
+  803215:	53                   	push   %ebx
+  803216:	51                   	push   %ecx
+  803217:	52                   	push   %edx
+  803218:	50                   	push   %eax
+  803219:	e8 4d ff ff ff       	call   80316b <__udivdi3>
+  80321e:	83 c4 10             	add    $0x10,%esp
+  803221:	eb d4                	jmp    8031f7 <__divdi3+0x45>
+
+00803223 <__moddi3>:
+  803223:	55                   	push   %ebp
+  803224:	57                   	push   %edi
+  803225:	56                   	push   %esi
+  803226:	53                   	push   %ebx
+  803227:	83 ec 0c             	sub    $0xc,%esp
+  80322a:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80322e:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803232:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803236:	89 e9                	mov    %ebp,%ecx
+  803238:	f7 d9                	neg    %ecx
+  80323a:	89 d0                	mov    %edx,%eax
+  80323c:	83 d0 00             	adc    $0x0,%eax
+  80323f:	f7 d8                	neg    %eax
+  803241:	0f 49 e9             	cmovns %ecx,%ebp
+  803244:	0f 49 d0             	cmovns %eax,%edx
+  803247:	52                   	push   %edx
+  803248:	55                   	push   %ebp
+  803249:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80324d:	f7 da                	neg    %edx
+  80324f:	89 d8                	mov    %ebx,%eax
+  803251:	83 d0 00             	adc    $0x0,%eax
+  803254:	f7 d8                	neg    %eax
+  803256:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80325b:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80325f:	0f 48 c3             	cmovs  %ebx,%eax
+  803262:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803266:	ff 74 24 0c          	push   0xc(%esp)
+  80326a:	ff 74 24 0c          	push   0xc(%esp)
+  80326e:	e8 16 ff ff ff       	call   803189 <__umoddi3>
+  803273:	83 c4 10             	add    $0x10,%esp
+  803276:	85 db                	test   %ebx,%ebx
+  803278:	78 08                	js     803282 <__moddi3+0x5f>
+  80327a:	83 c4 0c             	add    $0xc,%esp
+  80327d:	5b                   	pop    %ebx
+  80327e:	5e                   	pop    %esi
+  80327f:	5f                   	pop    %edi
+  803280:	5d                   	pop    %ebp
+  803281:	c3                   	ret
+  803282:	f7 d8                	neg    %eax
+  803284:	83 d2 00             	adc    $0x0,%edx
+  803287:	f7 da                	neg    %edx
+  803289:	eb ef                	jmp    80327a <__moddi3+0x57>
@@ -0,0 +1,5140 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+  80003f:	53                   	push   %ebx
+  800040:	68 80 32 80 00       	push   $0x803280
+  800045:	e8 bf 01 00 00       	call   800209 <cprintf>
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 02 0d 00 00       	call   800d60 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+  800065:	53                   	push   %ebx
+  800066:	68 cc 32 80 00       	push   $0x8032cc
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 27 08 00 00       	call   80089a <snprintf>
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 a0 32 80 00       	push   $0x8032a0
+  800085:	6a 0f                	push   $0xf
+  800087:	68 8a 32 80 00       	push   $0x80328a
+  80008c:	e8 9d 00 00 00       	call   80012e <_panic>
+
+00800091 <umain>:
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 2d 15 00 00       	call   8015ce <set_pgfault_handler>
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 c8 0b 00 00       	call   800c78 <sys_cputs>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000c0:	e8 31 0c 00 00       	call   800cf6 <sys_getenvid>
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 10 50 80 00       	mov    %eax,0x805010
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 a2 ff ff ff       	call   800091 <umain>
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+  800104:	a1 10 50 80 00       	mov    0x805010,%eax
+  800109:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	75 14                	jne    800127 <exit+0x29>
+  800113:	e8 23 17 00 00       	call   80183b <close_all>
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	6a 00                	push   $0x0
+  80011d:	e8 93 0b 00 00       	call   800cb5 <sys_env_destroy>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	c9                   	leave
+  800126:	c3                   	ret
+  800127:	e8 f6 12 00 00       	call   801422 <sys_lease_complete>
+  80012c:	eb e5                	jmp    800113 <exit+0x15>
+
+0080012e <_panic>:
+  80012e:	55                   	push   %ebp
+  80012f:	89 e5                	mov    %esp,%ebp
+  800131:	56                   	push   %esi
+  800132:	53                   	push   %ebx
+  800133:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800136:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80013c:	e8 b5 0b 00 00       	call   800cf6 <sys_getenvid>
+  800141:	83 ec 0c             	sub    $0xc,%esp
+  800144:	ff 75 0c             	push   0xc(%ebp)
+  800147:	ff 75 08             	push   0x8(%ebp)
+  80014a:	56                   	push   %esi
+  80014b:	50                   	push   %eax
+  80014c:	68 f8 32 80 00       	push   $0x8032f8
+  800151:	e8 b3 00 00 00       	call   800209 <cprintf>
+  800156:	83 c4 18             	add    $0x18,%esp
+  800159:	53                   	push   %ebx
+  80015a:	ff 75 10             	push   0x10(%ebp)
+  80015d:	e8 56 00 00 00       	call   8001b8 <vcprintf>
+  800162:	c7 04 24 c6 37 80 00 	movl   $0x8037c6,(%esp)
+  800169:	e8 9b 00 00 00       	call   800209 <cprintf>
+  80016e:	83 c4 10             	add    $0x10,%esp
+  800171:	cc                   	int3
+  800172:	eb fd                	jmp    800171 <_panic+0x43>
+
+00800174 <putch>:
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	53                   	push   %ebx
+  800178:	83 ec 04             	sub    $0x4,%esp
+  80017b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80017e:	8b 13                	mov    (%ebx),%edx
+  800180:	8d 42 01             	lea    0x1(%edx),%eax
+  800183:	89 03                	mov    %eax,(%ebx)
+  800185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800188:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80018c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800191:	74 09                	je     80019c <putch+0x28>
+  800193:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80019a:	c9                   	leave
+  80019b:	c3                   	ret
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	68 ff 00 00 00       	push   $0xff
+  8001a4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a7:	50                   	push   %eax
+  8001a8:	e8 cb 0a 00 00       	call   800c78 <sys_cputs>
+  8001ad:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b3:	83 c4 10             	add    $0x10,%esp
+  8001b6:	eb db                	jmp    800193 <putch+0x1f>
+
+008001b8 <vcprintf>:
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001c1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c8:	00 00 00 
+  8001cb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d2:	00 00 00 
+  8001d5:	ff 75 0c             	push   0xc(%ebp)
+  8001d8:	ff 75 08             	push   0x8(%ebp)
+  8001db:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e1:	50                   	push   %eax
+  8001e2:	68 74 01 80 00       	push   $0x800174
+  8001e7:	e8 1c 01 00 00       	call   800308 <vprintfmt>
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	e8 77 0a 00 00       	call   800c78 <sys_cputs>
+  800201:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <cprintf>:
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 10             	sub    $0x10,%esp
+  80020f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	ff 75 08             	push   0x8(%ebp)
+  800216:	e8 9d ff ff ff       	call   8001b8 <vcprintf>
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+0080021d <printnum>:
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	57                   	push   %edi
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	83 ec 1c             	sub    $0x1c,%esp
+  800226:	89 c3                	mov    %eax,%ebx
+  800228:	89 d6                	mov    %edx,%esi
+  80022a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800230:	89 d1                	mov    %edx,%ecx
+  800232:	89 c2                	mov    %eax,%edx
+  800234:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800237:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80023a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800240:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800247:	39 c2                	cmp    %eax,%edx
+  800249:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024c:	73 4b                	jae    800299 <printnum+0x7c>
+  80024e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800251:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800254:	85 ff                	test   %edi,%edi
+  800256:	7e 11                	jle    800269 <printnum+0x4c>
+  800258:	83 ec 08             	sub    $0x8,%esp
+  80025b:	56                   	push   %esi
+  80025c:	ff 75 18             	push   0x18(%ebp)
+  80025f:	ff d3                	call   *%ebx
+  800261:	83 c4 10             	add    $0x10,%esp
+  800264:	83 ef 01             	sub    $0x1,%edi
+  800267:	75 ef                	jne    800258 <printnum+0x3b>
+  800269:	83 ec 08             	sub    $0x8,%esp
+  80026c:	56                   	push   %esi
+  80026d:	83 ec 04             	sub    $0x4,%esp
+  800270:	ff 75 e4             	push   -0x1c(%ebp)
+  800273:	ff 75 e0             	push   -0x20(%ebp)
+  800276:	ff 75 dc             	push   -0x24(%ebp)
+  800279:	ff 75 d8             	push   -0x28(%ebp)
+  80027c:	e8 f3 2e 00 00       	call   803174 <__umoddi3>
+  800281:	83 c4 14             	add    $0x14,%esp
+  800284:	0f be 80 1b 33 80 00 	movsbl 0x80331b(%eax),%eax
+  80028b:	50                   	push   %eax
+  80028c:	ff d3                	call   *%ebx
+  80028e:	83 c4 10             	add    $0x10,%esp
+  800291:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800294:	5b                   	pop    %ebx
+  800295:	5e                   	pop    %esi
+  800296:	5f                   	pop    %edi
+  800297:	5d                   	pop    %ebp
+  800298:	c3                   	ret
+  800299:	83 ec 0c             	sub    $0xc,%esp
+  80029c:	ff 75 18             	push   0x18(%ebp)
+  80029f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002a2:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002a5:	52                   	push   %edx
+  8002a6:	50                   	push   %eax
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+  8002aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ad:	ff 75 e0             	push   -0x20(%ebp)
+  8002b0:	ff 75 dc             	push   -0x24(%ebp)
+  8002b3:	ff 75 d8             	push   -0x28(%ebp)
+  8002b6:	e8 9b 2e 00 00       	call   803156 <__udivdi3>
+  8002bb:	83 c4 18             	add    $0x18,%esp
+  8002be:	52                   	push   %edx
+  8002bf:	50                   	push   %eax
+  8002c0:	89 f2                	mov    %esi,%edx
+  8002c2:	89 d8                	mov    %ebx,%eax
+  8002c4:	e8 54 ff ff ff       	call   80021d <printnum>
+  8002c9:	83 c4 20             	add    $0x20,%esp
+  8002cc:	eb 9b                	jmp    800269 <printnum+0x4c>
+
+008002ce <sprintputch>:
+  8002ce:	55                   	push   %ebp
+  8002cf:	89 e5                	mov    %esp,%ebp
+  8002d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002d4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002d8:	8b 10                	mov    (%eax),%edx
+  8002da:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002dd:	73 0a                	jae    8002e9 <sprintputch+0x1b>
+  8002df:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002e2:	89 08                	mov    %ecx,(%eax)
+  8002e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e7:	88 02                	mov    %al,(%edx)
+  8002e9:	5d                   	pop    %ebp
+  8002ea:	c3                   	ret
+
+008002eb <printfmt>:
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	83 ec 08             	sub    $0x8,%esp
+  8002f1:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	ff 75 10             	push   0x10(%ebp)
+  8002f8:	ff 75 0c             	push   0xc(%ebp)
+  8002fb:	ff 75 08             	push   0x8(%ebp)
+  8002fe:	e8 05 00 00 00       	call   800308 <vprintfmt>
+  800303:	83 c4 10             	add    $0x10,%esp
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <vprintfmt>:
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	57                   	push   %edi
+  80030c:	56                   	push   %esi
+  80030d:	53                   	push   %ebx
+  80030e:	83 ec 2c             	sub    $0x2c,%esp
+  800311:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800314:	89 df                	mov    %ebx,%edi
+  800316:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800319:	8b 45 10             	mov    0x10(%ebp),%eax
+  80031c:	8d 70 01             	lea    0x1(%eax),%esi
+  80031f:	0f b6 00             	movzbl (%eax),%eax
+  800322:	83 f8 25             	cmp    $0x25,%eax
+  800325:	74 1e                	je     800345 <vprintfmt+0x3d>
+  800327:	85 c0                	test   %eax,%eax
+  800329:	0f 84 15 05 00 00    	je     800844 <vprintfmt+0x53c>
+  80032f:	83 ec 08             	sub    $0x8,%esp
+  800332:	53                   	push   %ebx
+  800333:	50                   	push   %eax
+  800334:	ff d7                	call   *%edi
+  800336:	83 c6 01             	add    $0x1,%esi
+  800339:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	83 f8 25             	cmp    $0x25,%eax
+  800343:	75 e2                	jne    800327 <vprintfmt+0x1f>
+  800345:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800349:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800350:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800357:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80035e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800363:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800366:	8d 56 01             	lea    0x1(%esi),%edx
+  800369:	0f b6 0e             	movzbl (%esi),%ecx
+  80036c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80036f:	3c 55                	cmp    $0x55,%al
+  800371:	0f 87 3b 04 00 00    	ja     8007b2 <vprintfmt+0x4aa>
+  800377:	0f b6 c0             	movzbl %al,%eax
+  80037a:	ff 24 85 60 34 80 00 	jmp    *0x803460(,%eax,4)
+  800381:	89 75 10             	mov    %esi,0x10(%ebp)
+  800384:	eb 93                	jmp    800319 <vprintfmt+0x11>
+  800386:	89 d6                	mov    %edx,%esi
+  800388:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80038c:	eb d8                	jmp    800366 <vprintfmt+0x5e>
+  80038e:	89 d6                	mov    %edx,%esi
+  800390:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800394:	eb d0                	jmp    800366 <vprintfmt+0x5e>
+  800396:	0f b6 c9             	movzbl %cl,%ecx
+  800399:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80039c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80039f:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003a3:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003a6:	83 f9 09             	cmp    $0x9,%ecx
+  8003a9:	77 6f                	ja     80041a <vprintfmt+0x112>
+  8003ab:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003ae:	83 c2 01             	add    $0x1,%edx
+  8003b1:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003b4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003b8:	0f be 02             	movsbl (%edx),%eax
+  8003bb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003be:	83 fe 09             	cmp    $0x9,%esi
+  8003c1:	76 eb                	jbe    8003ae <vprintfmt+0xa6>
+  8003c3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8003c6:	89 d6                	mov    %edx,%esi
+  8003c8:	eb 13                	jmp    8003dd <vprintfmt+0xd5>
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8b 00                	mov    (%eax),%eax
+  8003cf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003db:	89 d6                	mov    %edx,%esi
+  8003dd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003e1:	79 83                	jns    800366 <vprintfmt+0x5e>
+  8003e3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003e9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003f0:	e9 71 ff ff ff       	jmp    800366 <vprintfmt+0x5e>
+  8003f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003f8:	85 c9                	test   %ecx,%ecx
+  8003fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ff:	0f 49 c1             	cmovns %ecx,%eax
+  800402:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800405:	89 d6                	mov    %edx,%esi
+  800407:	e9 5a ff ff ff       	jmp    800366 <vprintfmt+0x5e>
+  80040c:	89 d6                	mov    %edx,%esi
+  80040e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800415:	e9 4c ff ff ff       	jmp    800366 <vprintfmt+0x5e>
+  80041a:	89 d6                	mov    %edx,%esi
+  80041c:	eb bf                	jmp    8003dd <vprintfmt+0xd5>
+  80041e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800422:	89 d6                	mov    %edx,%esi
+  800424:	e9 3d ff ff ff       	jmp    800366 <vprintfmt+0x5e>
+  800429:	89 55 10             	mov    %edx,0x10(%ebp)
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8d 70 04             	lea    0x4(%eax),%esi
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	ff 30                	push   (%eax)
+  800438:	ff d7                	call   *%edi
+  80043a:	83 c4 10             	add    $0x10,%esp
+  80043d:	89 75 14             	mov    %esi,0x14(%ebp)
+  800440:	e9 d4 fe ff ff       	jmp    800319 <vprintfmt+0x11>
+  800445:	89 55 10             	mov    %edx,0x10(%ebp)
+  800448:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044b:	8d 70 04             	lea    0x4(%eax),%esi
+  80044e:	8b 10                	mov    (%eax),%edx
+  800450:	89 d0                	mov    %edx,%eax
+  800452:	f7 d8                	neg    %eax
+  800454:	0f 48 c2             	cmovs  %edx,%eax
+  800457:	83 f8 12             	cmp    $0x12,%eax
+  80045a:	7f 23                	jg     80047f <vprintfmt+0x177>
+  80045c:	8b 14 85 c0 35 80 00 	mov    0x8035c0(,%eax,4),%edx
+  800463:	85 d2                	test   %edx,%edx
+  800465:	74 18                	je     80047f <vprintfmt+0x177>
+  800467:	52                   	push   %edx
+  800468:	68 93 37 80 00       	push   $0x803793
+  80046d:	53                   	push   %ebx
+  80046e:	57                   	push   %edi
+  80046f:	e8 77 fe ff ff       	call   8002eb <printfmt>
+  800474:	83 c4 10             	add    $0x10,%esp
+  800477:	89 75 14             	mov    %esi,0x14(%ebp)
+  80047a:	e9 9a fe ff ff       	jmp    800319 <vprintfmt+0x11>
+  80047f:	50                   	push   %eax
+  800480:	68 33 33 80 00       	push   $0x803333
+  800485:	53                   	push   %ebx
+  800486:	57                   	push   %edi
+  800487:	e8 5f fe ff ff       	call   8002eb <printfmt>
+  80048c:	83 c4 10             	add    $0x10,%esp
+  80048f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800492:	e9 82 fe ff ff       	jmp    800319 <vprintfmt+0x11>
+  800497:	89 55 10             	mov    %edx,0x10(%ebp)
+  80049a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049d:	83 c0 04             	add    $0x4,%eax
+  8004a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a6:	8b 00                	mov    (%eax),%eax
+  8004a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ab:	85 c0                	test   %eax,%eax
+  8004ad:	0f 84 61 03 00 00    	je     800814 <vprintfmt+0x50c>
+  8004b3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004b7:	7e 06                	jle    8004bf <vprintfmt+0x1b7>
+  8004b9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004bd:	75 29                	jne    8004e8 <vprintfmt+0x1e0>
+  8004bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c2:	8d 70 01             	lea    0x1(%eax),%esi
+  8004c5:	0f b6 00             	movzbl (%eax),%eax
+  8004c8:	0f be d0             	movsbl %al,%edx
+  8004cb:	85 d2                	test   %edx,%edx
+  8004cd:	0f 84 bb 00 00 00    	je     80058e <vprintfmt+0x286>
+  8004d3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004d6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004d9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004dc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004df:	eb 7a                	jmp    80055b <vprintfmt+0x253>
+  8004e1:	c7 45 d0 2c 33 80 00 	movl   $0x80332c,-0x30(%ebp)
+  8004e8:	83 ec 08             	sub    $0x8,%esp
+  8004eb:	ff 75 d4             	push   -0x2c(%ebp)
+  8004ee:	ff 75 d0             	push   -0x30(%ebp)
+  8004f1:	e8 e0 03 00 00       	call   8008d6 <strnlen>
+  8004f6:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004f9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004fc:	83 c4 10             	add    $0x10,%esp
+  8004ff:	85 d2                	test   %edx,%edx
+  800501:	0f 8e d6 02 00 00    	jle    8007dd <vprintfmt+0x4d5>
+  800507:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80050b:	83 ec 08             	sub    $0x8,%esp
+  80050e:	53                   	push   %ebx
+  80050f:	56                   	push   %esi
+  800510:	ff d7                	call   *%edi
+  800512:	83 c4 10             	add    $0x10,%esp
+  800515:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800519:	75 f0                	jne    80050b <vprintfmt+0x203>
+  80051b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80051e:	8d 70 01             	lea    0x1(%eax),%esi
+  800521:	0f b6 00             	movzbl (%eax),%eax
+  800524:	0f be d0             	movsbl %al,%edx
+  800527:	85 d2                	test   %edx,%edx
+  800529:	0f 84 da 02 00 00    	je     800809 <vprintfmt+0x501>
+  80052f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800532:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800535:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800538:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80053b:	eb 1e                	jmp    80055b <vprintfmt+0x253>
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	ff 75 0c             	push   0xc(%ebp)
+  800543:	52                   	push   %edx
+  800544:	ff 55 08             	call   *0x8(%ebp)
+  800547:	83 c4 10             	add    $0x10,%esp
+  80054a:	83 eb 01             	sub    $0x1,%ebx
+  80054d:	83 c6 01             	add    $0x1,%esi
+  800550:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800554:	0f be d0             	movsbl %al,%edx
+  800557:	85 d2                	test   %edx,%edx
+  800559:	74 2a                	je     800585 <vprintfmt+0x27d>
+  80055b:	85 ff                	test   %edi,%edi
+  80055d:	78 05                	js     800564 <vprintfmt+0x25c>
+  80055f:	83 ef 01             	sub    $0x1,%edi
+  800562:	78 59                	js     8005bd <vprintfmt+0x2b5>
+  800564:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800568:	74 d3                	je     80053d <vprintfmt+0x235>
+  80056a:	0f be c0             	movsbl %al,%eax
+  80056d:	83 e8 20             	sub    $0x20,%eax
+  800570:	83 f8 5e             	cmp    $0x5e,%eax
+  800573:	76 c8                	jbe    80053d <vprintfmt+0x235>
+  800575:	83 ec 08             	sub    $0x8,%esp
+  800578:	ff 75 0c             	push   0xc(%ebp)
+  80057b:	6a 3f                	push   $0x3f
+  80057d:	ff 55 08             	call   *0x8(%ebp)
+  800580:	83 c4 10             	add    $0x10,%esp
+  800583:	eb c5                	jmp    80054a <vprintfmt+0x242>
+  800585:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800588:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80058b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80058e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800591:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800595:	7e 1b                	jle    8005b2 <vprintfmt+0x2aa>
+  800597:	83 ec 08             	sub    $0x8,%esp
+  80059a:	53                   	push   %ebx
+  80059b:	6a 20                	push   $0x20
+  80059d:	ff d7                	call   *%edi
+  80059f:	83 c4 10             	add    $0x10,%esp
+  8005a2:	83 ee 01             	sub    $0x1,%esi
+  8005a5:	75 f0                	jne    800597 <vprintfmt+0x28f>
+  8005a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ad:	e9 67 fd ff ff       	jmp    800319 <vprintfmt+0x11>
+  8005b2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b8:	e9 5c fd ff ff       	jmp    800319 <vprintfmt+0x11>
+  8005bd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005c6:	eb c6                	jmp    80058e <vprintfmt+0x286>
+  8005c8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005cb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005ce:	83 f9 01             	cmp    $0x1,%ecx
+  8005d1:	7f 1f                	jg     8005f2 <vprintfmt+0x2ea>
+  8005d3:	85 c9                	test   %ecx,%ecx
+  8005d5:	74 67                	je     80063e <vprintfmt+0x336>
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 30                	mov    (%eax),%esi
+  8005dc:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005df:	89 f0                	mov    %esi,%eax
+  8005e1:	c1 f8 1f             	sar    $0x1f,%eax
+  8005e4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f0:	eb 17                	jmp    800609 <vprintfmt+0x301>
+  8005f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f5:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f8:	8b 00                	mov    (%eax),%eax
+  8005fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8d 40 08             	lea    0x8(%eax),%eax
+  800606:	89 45 14             	mov    %eax,0x14(%ebp)
+  800609:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80060f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800614:	85 c9                	test   %ecx,%ecx
+  800616:	0f 89 12 01 00 00    	jns    80072e <vprintfmt+0x426>
+  80061c:	83 ec 08             	sub    $0x8,%esp
+  80061f:	53                   	push   %ebx
+  800620:	6a 2d                	push   $0x2d
+  800622:	ff d7                	call   *%edi
+  800624:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800627:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80062a:	f7 da                	neg    %edx
+  80062c:	83 d1 00             	adc    $0x0,%ecx
+  80062f:	f7 d9                	neg    %ecx
+  800631:	83 c4 10             	add    $0x10,%esp
+  800634:	be 0a 00 00 00       	mov    $0xa,%esi
+  800639:	e9 f0 00 00 00       	jmp    80072e <vprintfmt+0x426>
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	8b 30                	mov    (%eax),%esi
+  800643:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800646:	89 f0                	mov    %esi,%eax
+  800648:	c1 f8 1f             	sar    $0x1f,%eax
+  80064b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8d 40 04             	lea    0x4(%eax),%eax
+  800654:	89 45 14             	mov    %eax,0x14(%ebp)
+  800657:	eb b0                	jmp    800609 <vprintfmt+0x301>
+  800659:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80065c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80065f:	83 f9 01             	cmp    $0x1,%ecx
+  800662:	7f 1e                	jg     800682 <vprintfmt+0x37a>
+  800664:	85 c9                	test   %ecx,%ecx
+  800666:	74 32                	je     80069a <vprintfmt+0x392>
+  800668:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066b:	8b 10                	mov    (%eax),%edx
+  80066d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800672:	8d 40 04             	lea    0x4(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+  800678:	be 0a 00 00 00       	mov    $0xa,%esi
+  80067d:	e9 ac 00 00 00       	jmp    80072e <vprintfmt+0x426>
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 10                	mov    (%eax),%edx
+  800687:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068a:	8d 40 08             	lea    0x8(%eax),%eax
+  80068d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800690:	be 0a 00 00 00       	mov    $0xa,%esi
+  800695:	e9 94 00 00 00       	jmp    80072e <vprintfmt+0x426>
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8b 10                	mov    (%eax),%edx
+  80069f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006aa:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006af:	eb 7d                	jmp    80072e <vprintfmt+0x426>
+  8006b1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006b4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006b7:	83 f9 01             	cmp    $0x1,%ecx
+  8006ba:	7f 1b                	jg     8006d7 <vprintfmt+0x3cf>
+  8006bc:	85 c9                	test   %ecx,%ecx
+  8006be:	74 2c                	je     8006ec <vprintfmt+0x3e4>
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8b 10                	mov    (%eax),%edx
+  8006c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d0:	be 08 00 00 00       	mov    $0x8,%esi
+  8006d5:	eb 57                	jmp    80072e <vprintfmt+0x426>
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 10                	mov    (%eax),%edx
+  8006dc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006df:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e5:	be 08 00 00 00       	mov    $0x8,%esi
+  8006ea:	eb 42                	jmp    80072e <vprintfmt+0x426>
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8b 10                	mov    (%eax),%edx
+  8006f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fc:	be 08 00 00 00       	mov    $0x8,%esi
+  800701:	eb 2b                	jmp    80072e <vprintfmt+0x426>
+  800703:	89 55 10             	mov    %edx,0x10(%ebp)
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	53                   	push   %ebx
+  80070a:	6a 30                	push   $0x30
+  80070c:	ff d7                	call   *%edi
+  80070e:	83 c4 08             	add    $0x8,%esp
+  800711:	53                   	push   %ebx
+  800712:	6a 78                	push   $0x78
+  800714:	ff d7                	call   *%edi
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 10                	mov    (%eax),%edx
+  80071b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800720:	83 c4 10             	add    $0x10,%esp
+  800723:	8d 40 04             	lea    0x4(%eax),%eax
+  800726:	89 45 14             	mov    %eax,0x14(%ebp)
+  800729:	be 10 00 00 00       	mov    $0x10,%esi
+  80072e:	83 ec 0c             	sub    $0xc,%esp
+  800731:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800735:	50                   	push   %eax
+  800736:	ff 75 e4             	push   -0x1c(%ebp)
+  800739:	56                   	push   %esi
+  80073a:	51                   	push   %ecx
+  80073b:	52                   	push   %edx
+  80073c:	89 da                	mov    %ebx,%edx
+  80073e:	89 f8                	mov    %edi,%eax
+  800740:	e8 d8 fa ff ff       	call   80021d <printnum>
+  800745:	83 c4 20             	add    $0x20,%esp
+  800748:	e9 cc fb ff ff       	jmp    800319 <vprintfmt+0x11>
+  80074d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800750:	89 55 10             	mov    %edx,0x10(%ebp)
+  800753:	83 f9 01             	cmp    $0x1,%ecx
+  800756:	7f 1b                	jg     800773 <vprintfmt+0x46b>
+  800758:	85 c9                	test   %ecx,%ecx
+  80075a:	74 2c                	je     800788 <vprintfmt+0x480>
+  80075c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075f:	8b 10                	mov    (%eax),%edx
+  800761:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800766:	8d 40 04             	lea    0x4(%eax),%eax
+  800769:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076c:	be 10 00 00 00       	mov    $0x10,%esi
+  800771:	eb bb                	jmp    80072e <vprintfmt+0x426>
+  800773:	8b 45 14             	mov    0x14(%ebp),%eax
+  800776:	8b 10                	mov    (%eax),%edx
+  800778:	8b 48 04             	mov    0x4(%eax),%ecx
+  80077b:	8d 40 08             	lea    0x8(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800781:	be 10 00 00 00       	mov    $0x10,%esi
+  800786:	eb a6                	jmp    80072e <vprintfmt+0x426>
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8b 10                	mov    (%eax),%edx
+  80078d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800792:	8d 40 04             	lea    0x4(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+  800798:	be 10 00 00 00       	mov    $0x10,%esi
+  80079d:	eb 8f                	jmp    80072e <vprintfmt+0x426>
+  80079f:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007a2:	83 ec 08             	sub    $0x8,%esp
+  8007a5:	53                   	push   %ebx
+  8007a6:	6a 25                	push   $0x25
+  8007a8:	ff d7                	call   *%edi
+  8007aa:	83 c4 10             	add    $0x10,%esp
+  8007ad:	e9 67 fb ff ff       	jmp    800319 <vprintfmt+0x11>
+  8007b2:	83 ec 08             	sub    $0x8,%esp
+  8007b5:	53                   	push   %ebx
+  8007b6:	6a 25                	push   $0x25
+  8007b8:	ff d7                	call   *%edi
+  8007ba:	83 c4 10             	add    $0x10,%esp
+  8007bd:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007c1:	0f 84 ba fb ff ff    	je     800381 <vprintfmt+0x79>
+  8007c7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007ca:	89 f0                	mov    %esi,%eax
+  8007cc:	83 e8 01             	sub    $0x1,%eax
+  8007cf:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007d3:	75 f7                	jne    8007cc <vprintfmt+0x4c4>
+  8007d5:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007d8:	e9 3c fb ff ff       	jmp    800319 <vprintfmt+0x11>
+  8007dd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007e0:	8d 70 01             	lea    0x1(%eax),%esi
+  8007e3:	0f b6 00             	movzbl (%eax),%eax
+  8007e6:	0f be d0             	movsbl %al,%edx
+  8007e9:	85 d2                	test   %edx,%edx
+  8007eb:	74 11                	je     8007fe <vprintfmt+0x4f6>
+  8007ed:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007f0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007f3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007f6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007f9:	e9 5d fd ff ff       	jmp    80055b <vprintfmt+0x253>
+  8007fe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800801:	89 45 14             	mov    %eax,0x14(%ebp)
+  800804:	e9 10 fb ff ff       	jmp    800319 <vprintfmt+0x11>
+  800809:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80080c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080f:	e9 05 fb ff ff       	jmp    800319 <vprintfmt+0x11>
+  800814:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800818:	7e 0a                	jle    800824 <vprintfmt+0x51c>
+  80081a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80081e:	0f 85 bd fc ff ff    	jne    8004e1 <vprintfmt+0x1d9>
+  800824:	ba 28 00 00 00       	mov    $0x28,%edx
+  800829:	b8 28 00 00 00       	mov    $0x28,%eax
+  80082e:	be 2d 33 80 00       	mov    $0x80332d,%esi
+  800833:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800836:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800839:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80083c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80083f:	e9 17 fd ff ff       	jmp    80055b <vprintfmt+0x253>
+  800844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800847:	5b                   	pop    %ebx
+  800848:	5e                   	pop    %esi
+  800849:	5f                   	pop    %edi
+  80084a:	5d                   	pop    %ebp
+  80084b:	c3                   	ret
+
+0080084c <vsnprintf>:
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	83 ec 18             	sub    $0x18,%esp
+  800852:	8b 45 08             	mov    0x8(%ebp),%eax
+  800855:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800858:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80085b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80085f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800862:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800869:	85 c0                	test   %eax,%eax
+  80086b:	74 26                	je     800893 <vsnprintf+0x47>
+  80086d:	85 d2                	test   %edx,%edx
+  80086f:	7e 22                	jle    800893 <vsnprintf+0x47>
+  800871:	ff 75 14             	push   0x14(%ebp)
+  800874:	ff 75 10             	push   0x10(%ebp)
+  800877:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80087a:	50                   	push   %eax
+  80087b:	68 ce 02 80 00       	push   $0x8002ce
+  800880:	e8 83 fa ff ff       	call   800308 <vprintfmt>
+  800885:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800888:	c6 00 00             	movb   $0x0,(%eax)
+  80088b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80088e:	83 c4 10             	add    $0x10,%esp
+  800891:	c9                   	leave
+  800892:	c3                   	ret
+  800893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800898:	eb f7                	jmp    800891 <vsnprintf+0x45>
+
+0080089a <snprintf>:
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	83 ec 08             	sub    $0x8,%esp
+  8008a0:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008a3:	50                   	push   %eax
+  8008a4:	ff 75 10             	push   0x10(%ebp)
+  8008a7:	ff 75 0c             	push   0xc(%ebp)
+  8008aa:	ff 75 08             	push   0x8(%ebp)
+  8008ad:	e8 9a ff ff ff       	call   80084c <vsnprintf>
+  8008b2:	c9                   	leave
+  8008b3:	c3                   	ret
+
+008008b4 <strlen>:
+  8008b4:	55                   	push   %ebp
+  8008b5:	89 e5                	mov    %esp,%ebp
+  8008b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008ba:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008bd:	74 10                	je     8008cf <strlen+0x1b>
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c4:	83 c0 01             	add    $0x1,%eax
+  8008c7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008cb:	75 f7                	jne    8008c4 <strlen+0x10>
+  8008cd:	5d                   	pop    %ebp
+  8008ce:	c3                   	ret
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	eb f7                	jmp    8008cd <strlen+0x19>
+
+008008d6 <strnlen>:
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008df:	85 d2                	test   %edx,%edx
+  8008e1:	74 16                	je     8008f9 <strnlen+0x23>
+  8008e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ec:	74 09                	je     8008f7 <strnlen+0x21>
+  8008ee:	83 c0 01             	add    $0x1,%eax
+  8008f1:	39 d0                	cmp    %edx,%eax
+  8008f3:	75 f3                	jne    8008e8 <strnlen+0x12>
+  8008f5:	89 d0                	mov    %edx,%eax
+  8008f7:	5d                   	pop    %ebp
+  8008f8:	c3                   	ret
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	eb f7                	jmp    8008f7 <strnlen+0x21>
+
+00800900 <strcpy>:
+  800900:	55                   	push   %ebp
+  800901:	89 e5                	mov    %esp,%ebp
+  800903:	53                   	push   %ebx
+  800904:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800907:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800913:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800916:	83 c0 01             	add    $0x1,%eax
+  800919:	84 d2                	test   %dl,%dl
+  80091b:	75 f2                	jne    80090f <strcpy+0xf>
+  80091d:	89 c8                	mov    %ecx,%eax
+  80091f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+00800924 <strcat>:
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	53                   	push   %ebx
+  800928:	83 ec 10             	sub    $0x10,%esp
+  80092b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80092e:	53                   	push   %ebx
+  80092f:	e8 80 ff ff ff       	call   8008b4 <strlen>
+  800934:	83 c4 08             	add    $0x8,%esp
+  800937:	ff 75 0c             	push   0xc(%ebp)
+  80093a:	01 d8                	add    %ebx,%eax
+  80093c:	50                   	push   %eax
+  80093d:	e8 be ff ff ff       	call   800900 <strcpy>
+  800942:	89 d8                	mov    %ebx,%eax
+  800944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+00800949 <strncpy>:
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	56                   	push   %esi
+  80094d:	53                   	push   %ebx
+  80094e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800951:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800954:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800957:	85 db                	test   %ebx,%ebx
+  800959:	74 17                	je     800972 <strncpy+0x29>
+  80095b:	01 f3                	add    %esi,%ebx
+  80095d:	89 f0                	mov    %esi,%eax
+  80095f:	83 c0 01             	add    $0x1,%eax
+  800962:	0f b6 0a             	movzbl (%edx),%ecx
+  800965:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800968:	80 f9 01             	cmp    $0x1,%cl
+  80096b:	83 da ff             	sbb    $0xffffffff,%edx
+  80096e:	39 c3                	cmp    %eax,%ebx
+  800970:	75 ed                	jne    80095f <strncpy+0x16>
+  800972:	89 f0                	mov    %esi,%eax
+  800974:	5b                   	pop    %ebx
+  800975:	5e                   	pop    %esi
+  800976:	5d                   	pop    %ebp
+  800977:	c3                   	ret
+
+00800978 <strlcpy>:
+  800978:	55                   	push   %ebp
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	56                   	push   %esi
+  80097c:	53                   	push   %ebx
+  80097d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800980:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800983:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800986:	89 f0                	mov    %esi,%eax
+  800988:	85 db                	test   %ebx,%ebx
+  80098a:	74 1e                	je     8009aa <strlcpy+0x32>
+  80098c:	83 eb 01             	sub    $0x1,%ebx
+  80098f:	74 16                	je     8009a7 <strlcpy+0x2f>
+  800991:	01 f3                	add    %esi,%ebx
+  800993:	0f b6 0a             	movzbl (%edx),%ecx
+  800996:	84 c9                	test   %cl,%cl
+  800998:	74 0d                	je     8009a7 <strlcpy+0x2f>
+  80099a:	83 c2 01             	add    $0x1,%edx
+  80099d:	83 c0 01             	add    $0x1,%eax
+  8009a0:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009a3:	39 d8                	cmp    %ebx,%eax
+  8009a5:	75 ec                	jne    800993 <strlcpy+0x1b>
+  8009a7:	c6 00 00             	movb   $0x0,(%eax)
+  8009aa:	29 f0                	sub    %esi,%eax
+  8009ac:	5b                   	pop    %ebx
+  8009ad:	5e                   	pop    %esi
+  8009ae:	5d                   	pop    %ebp
+  8009af:	c3                   	ret
+
+008009b0 <strcmp>:
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009b9:	0f b6 01             	movzbl (%ecx),%eax
+  8009bc:	84 c0                	test   %al,%al
+  8009be:	74 11                	je     8009d1 <strcmp+0x21>
+  8009c0:	38 02                	cmp    %al,(%edx)
+  8009c2:	75 0d                	jne    8009d1 <strcmp+0x21>
+  8009c4:	83 c1 01             	add    $0x1,%ecx
+  8009c7:	83 c2 01             	add    $0x1,%edx
+  8009ca:	0f b6 01             	movzbl (%ecx),%eax
+  8009cd:	84 c0                	test   %al,%al
+  8009cf:	75 ef                	jne    8009c0 <strcmp+0x10>
+  8009d1:	0f b6 c0             	movzbl %al,%eax
+  8009d4:	0f b6 12             	movzbl (%edx),%edx
+  8009d7:	29 d0                	sub    %edx,%eax
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <strncmp>:
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	53                   	push   %ebx
+  8009df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ed:	85 d2                	test   %edx,%edx
+  8009ef:	74 2e                	je     800a1f <strncmp+0x44>
+  8009f1:	0f b6 01             	movzbl (%ecx),%eax
+  8009f4:	84 c0                	test   %al,%al
+  8009f6:	74 16                	je     800a0e <strncmp+0x33>
+  8009f8:	3a 03                	cmp    (%ebx),%al
+  8009fa:	75 12                	jne    800a0e <strncmp+0x33>
+  8009fc:	83 c1 01             	add    $0x1,%ecx
+  8009ff:	83 c3 01             	add    $0x1,%ebx
+  800a02:	83 ea 01             	sub    $0x1,%edx
+  800a05:	75 ea                	jne    8009f1 <strncmp+0x16>
+  800a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0c:	eb 11                	jmp    800a1f <strncmp+0x44>
+  800a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a13:	85 d2                	test   %edx,%edx
+  800a15:	74 08                	je     800a1f <strncmp+0x44>
+  800a17:	0f b6 01             	movzbl (%ecx),%eax
+  800a1a:	0f b6 13             	movzbl (%ebx),%edx
+  800a1d:	29 d0                	sub    %edx,%eax
+  800a1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a22:	c9                   	leave
+  800a23:	c3                   	ret
+
+00800a24 <strchr>:
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a2e:	0f b6 10             	movzbl (%eax),%edx
+  800a31:	84 d2                	test   %dl,%dl
+  800a33:	74 15                	je     800a4a <strchr+0x26>
+  800a35:	38 d1                	cmp    %dl,%cl
+  800a37:	74 0f                	je     800a48 <strchr+0x24>
+  800a39:	83 c0 01             	add    $0x1,%eax
+  800a3c:	0f b6 10             	movzbl (%eax),%edx
+  800a3f:	84 d2                	test   %dl,%dl
+  800a41:	75 f2                	jne    800a35 <strchr+0x11>
+  800a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a48:	5d                   	pop    %ebp
+  800a49:	c3                   	ret
+  800a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4f:	eb f7                	jmp    800a48 <strchr+0x24>
+
+00800a51 <strfind>:
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	53                   	push   %ebx
+  800a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a5b:	0f b6 18             	movzbl (%eax),%ebx
+  800a5e:	38 d3                	cmp    %dl,%bl
+  800a60:	74 14                	je     800a76 <strfind+0x25>
+  800a62:	89 d1                	mov    %edx,%ecx
+  800a64:	84 db                	test   %bl,%bl
+  800a66:	74 0e                	je     800a76 <strfind+0x25>
+  800a68:	83 c0 01             	add    $0x1,%eax
+  800a6b:	0f b6 10             	movzbl (%eax),%edx
+  800a6e:	38 ca                	cmp    %cl,%dl
+  800a70:	74 04                	je     800a76 <strfind+0x25>
+  800a72:	84 d2                	test   %dl,%dl
+  800a74:	75 f2                	jne    800a68 <strfind+0x17>
+  800a76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+00800a7b <memset>:
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	57                   	push   %edi
+  800a7f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a82:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a85:	85 c9                	test   %ecx,%ecx
+  800a87:	74 20                	je     800aa9 <memset+0x2e>
+  800a89:	89 f8                	mov    %edi,%eax
+  800a8b:	09 c8                	or     %ecx,%eax
+  800a8d:	a8 03                	test   $0x3,%al
+  800a8f:	75 12                	jne    800aa3 <memset+0x28>
+  800a91:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a95:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a9b:	c1 e9 02             	shr    $0x2,%ecx
+  800a9e:	fc                   	cld
+  800a9f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aa1:	eb 06                	jmp    800aa9 <memset+0x2e>
+  800aa3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa6:	fc                   	cld
+  800aa7:	f3 aa                	rep stos %al,%es:(%edi)
+  800aa9:	89 f8                	mov    %edi,%eax
+  800aab:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aae:	c9                   	leave
+  800aaf:	c3                   	ret
+
+00800ab0 <memmove>:
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	57                   	push   %edi
+  800ab4:	56                   	push   %esi
+  800ab5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800abb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800abe:	39 c6                	cmp    %eax,%esi
+  800ac0:	73 32                	jae    800af4 <memmove+0x44>
+  800ac2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ac5:	39 d0                	cmp    %edx,%eax
+  800ac7:	73 2b                	jae    800af4 <memmove+0x44>
+  800ac9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800acc:	89 d6                	mov    %edx,%esi
+  800ace:	09 fe                	or     %edi,%esi
+  800ad0:	09 ce                	or     %ecx,%esi
+  800ad2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ad8:	75 0e                	jne    800ae8 <memmove+0x38>
+  800ada:	83 ef 04             	sub    $0x4,%edi
+  800add:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ae0:	c1 e9 02             	shr    $0x2,%ecx
+  800ae3:	fd                   	std
+  800ae4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae6:	eb 09                	jmp    800af1 <memmove+0x41>
+  800ae8:	83 ef 01             	sub    $0x1,%edi
+  800aeb:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800aee:	fd                   	std
+  800aef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800af1:	fc                   	cld
+  800af2:	eb 1a                	jmp    800b0e <memmove+0x5e>
+  800af4:	89 f2                	mov    %esi,%edx
+  800af6:	09 c2                	or     %eax,%edx
+  800af8:	09 ca                	or     %ecx,%edx
+  800afa:	f6 c2 03             	test   $0x3,%dl
+  800afd:	75 0a                	jne    800b09 <memmove+0x59>
+  800aff:	c1 e9 02             	shr    $0x2,%ecx
+  800b02:	89 c7                	mov    %eax,%edi
+  800b04:	fc                   	cld
+  800b05:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b07:	eb 05                	jmp    800b0e <memmove+0x5e>
+  800b09:	89 c7                	mov    %eax,%edi
+  800b0b:	fc                   	cld
+  800b0c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b0e:	5e                   	pop    %esi
+  800b0f:	5f                   	pop    %edi
+  800b10:	5d                   	pop    %ebp
+  800b11:	c3                   	ret
+
+00800b12 <memcpy>:
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	83 ec 0c             	sub    $0xc,%esp
+  800b18:	ff 75 10             	push   0x10(%ebp)
+  800b1b:	ff 75 0c             	push   0xc(%ebp)
+  800b1e:	ff 75 08             	push   0x8(%ebp)
+  800b21:	e8 8a ff ff ff       	call   800ab0 <memmove>
+  800b26:	c9                   	leave
+  800b27:	c3                   	ret
+
+00800b28 <memcmp>:
+  800b28:	55                   	push   %ebp
+  800b29:	89 e5                	mov    %esp,%ebp
+  800b2b:	56                   	push   %esi
+  800b2c:	53                   	push   %ebx
+  800b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b33:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b36:	85 f6                	test   %esi,%esi
+  800b38:	74 29                	je     800b63 <memcmp+0x3b>
+  800b3a:	01 c6                	add    %eax,%esi
+  800b3c:	0f b6 08             	movzbl (%eax),%ecx
+  800b3f:	0f b6 1a             	movzbl (%edx),%ebx
+  800b42:	38 d9                	cmp    %bl,%cl
+  800b44:	75 11                	jne    800b57 <memcmp+0x2f>
+  800b46:	83 c0 01             	add    $0x1,%eax
+  800b49:	83 c2 01             	add    $0x1,%edx
+  800b4c:	39 c6                	cmp    %eax,%esi
+  800b4e:	75 ec                	jne    800b3c <memcmp+0x14>
+  800b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b55:	eb 08                	jmp    800b5f <memcmp+0x37>
+  800b57:	0f b6 c1             	movzbl %cl,%eax
+  800b5a:	0f b6 db             	movzbl %bl,%ebx
+  800b5d:	29 d8                	sub    %ebx,%eax
+  800b5f:	5b                   	pop    %ebx
+  800b60:	5e                   	pop    %esi
+  800b61:	5d                   	pop    %ebp
+  800b62:	c3                   	ret
+  800b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b68:	eb f5                	jmp    800b5f <memcmp+0x37>
+
+00800b6a <memfind>:
+  800b6a:	55                   	push   %ebp
+  800b6b:	89 e5                	mov    %esp,%ebp
+  800b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b73:	89 c2                	mov    %eax,%edx
+  800b75:	03 55 10             	add    0x10(%ebp),%edx
+  800b78:	39 d0                	cmp    %edx,%eax
+  800b7a:	73 0d                	jae    800b89 <memfind+0x1f>
+  800b7c:	38 08                	cmp    %cl,(%eax)
+  800b7e:	74 0d                	je     800b8d <memfind+0x23>
+  800b80:	83 c0 01             	add    $0x1,%eax
+  800b83:	39 c2                	cmp    %eax,%edx
+  800b85:	75 f5                	jne    800b7c <memfind+0x12>
+  800b87:	eb 06                	jmp    800b8f <memfind+0x25>
+  800b89:	89 c2                	mov    %eax,%edx
+  800b8b:	eb 02                	jmp    800b8f <memfind+0x25>
+  800b8d:	89 c2                	mov    %eax,%edx
+  800b8f:	89 d0                	mov    %edx,%eax
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <strtol>:
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	57                   	push   %edi
+  800b97:	56                   	push   %esi
+  800b98:	53                   	push   %ebx
+  800b99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b9f:	0f b6 02             	movzbl (%edx),%eax
+  800ba2:	3c 20                	cmp    $0x20,%al
+  800ba4:	74 04                	je     800baa <strtol+0x17>
+  800ba6:	3c 09                	cmp    $0x9,%al
+  800ba8:	75 0e                	jne    800bb8 <strtol+0x25>
+  800baa:	83 c2 01             	add    $0x1,%edx
+  800bad:	0f b6 02             	movzbl (%edx),%eax
+  800bb0:	3c 20                	cmp    $0x20,%al
+  800bb2:	74 f6                	je     800baa <strtol+0x17>
+  800bb4:	3c 09                	cmp    $0x9,%al
+  800bb6:	74 f2                	je     800baa <strtol+0x17>
+  800bb8:	3c 2b                	cmp    $0x2b,%al
+  800bba:	74 2a                	je     800be6 <strtol+0x53>
+  800bbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bc1:	3c 2d                	cmp    $0x2d,%al
+  800bc3:	74 2b                	je     800bf0 <strtol+0x5d>
+  800bc5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bcb:	75 0f                	jne    800bdc <strtol+0x49>
+  800bcd:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bd0:	74 28                	je     800bfa <strtol+0x67>
+  800bd2:	85 db                	test   %ebx,%ebx
+  800bd4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bd9:	0f 44 d8             	cmove  %eax,%ebx
+  800bdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800be4:	eb 46                	jmp    800c2c <strtol+0x99>
+  800be6:	83 c2 01             	add    $0x1,%edx
+  800be9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bee:	eb d5                	jmp    800bc5 <strtol+0x32>
+  800bf0:	83 c2 01             	add    $0x1,%edx
+  800bf3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bf8:	eb cb                	jmp    800bc5 <strtol+0x32>
+  800bfa:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bfe:	74 0e                	je     800c0e <strtol+0x7b>
+  800c00:	85 db                	test   %ebx,%ebx
+  800c02:	75 d8                	jne    800bdc <strtol+0x49>
+  800c04:	83 c2 01             	add    $0x1,%edx
+  800c07:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c0c:	eb ce                	jmp    800bdc <strtol+0x49>
+  800c0e:	83 c2 02             	add    $0x2,%edx
+  800c11:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c16:	eb c4                	jmp    800bdc <strtol+0x49>
+  800c18:	0f be c0             	movsbl %al,%eax
+  800c1b:	83 e8 30             	sub    $0x30,%eax
+  800c1e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c21:	7d 3a                	jge    800c5d <strtol+0xca>
+  800c23:	83 c2 01             	add    $0x1,%edx
+  800c26:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c2a:	01 c1                	add    %eax,%ecx
+  800c2c:	0f b6 02             	movzbl (%edx),%eax
+  800c2f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c32:	89 f3                	mov    %esi,%ebx
+  800c34:	80 fb 09             	cmp    $0x9,%bl
+  800c37:	76 df                	jbe    800c18 <strtol+0x85>
+  800c39:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c3c:	89 f3                	mov    %esi,%ebx
+  800c3e:	80 fb 19             	cmp    $0x19,%bl
+  800c41:	77 08                	ja     800c4b <strtol+0xb8>
+  800c43:	0f be c0             	movsbl %al,%eax
+  800c46:	83 e8 57             	sub    $0x57,%eax
+  800c49:	eb d3                	jmp    800c1e <strtol+0x8b>
+  800c4b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c4e:	89 f3                	mov    %esi,%ebx
+  800c50:	80 fb 19             	cmp    $0x19,%bl
+  800c53:	77 08                	ja     800c5d <strtol+0xca>
+  800c55:	0f be c0             	movsbl %al,%eax
+  800c58:	83 e8 37             	sub    $0x37,%eax
+  800c5b:	eb c1                	jmp    800c1e <strtol+0x8b>
+  800c5d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c61:	74 05                	je     800c68 <strtol+0xd5>
+  800c63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c66:	89 10                	mov    %edx,(%eax)
+  800c68:	89 c8                	mov    %ecx,%eax
+  800c6a:	f7 d8                	neg    %eax
+  800c6c:	85 ff                	test   %edi,%edi
+  800c6e:	0f 45 c8             	cmovne %eax,%ecx
+  800c71:	89 c8                	mov    %ecx,%eax
+  800c73:	5b                   	pop    %ebx
+  800c74:	5e                   	pop    %esi
+  800c75:	5f                   	pop    %edi
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+
+00800c78 <sys_cputs>:
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+  800c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c89:	89 c3                	mov    %eax,%ebx
+  800c8b:	89 c7                	mov    %eax,%edi
+  800c8d:	89 c6                	mov    %eax,%esi
+  800c8f:	cd 30                	int    $0x30
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+
+00800c96 <sys_cgetc>:
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  800c9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca6:	89 d1                	mov    %edx,%ecx
+  800ca8:	89 d3                	mov    %edx,%ebx
+  800caa:	89 d7                	mov    %edx,%edi
+  800cac:	89 d6                	mov    %edx,%esi
+  800cae:	cd 30                	int    $0x30
+  800cb0:	5b                   	pop    %ebx
+  800cb1:	5e                   	pop    %esi
+  800cb2:	5f                   	pop    %edi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+
+00800cb5 <sys_env_destroy>:
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+  800cbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ccb:	89 cb                	mov    %ecx,%ebx
+  800ccd:	89 cf                	mov    %ecx,%edi
+  800ccf:	89 ce                	mov    %ecx,%esi
+  800cd1:	cd 30                	int    $0x30
+  800cd3:	85 c0                	test   %eax,%eax
+  800cd5:	7f 08                	jg     800cdf <sys_env_destroy+0x2a>
+  800cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+  800ce2:	50                   	push   %eax
+  800ce3:	6a 03                	push   $0x3
+  800ce5:	68 2b 36 80 00       	push   $0x80362b
+  800cea:	6a 24                	push   $0x24
+  800cec:	68 48 36 80 00       	push   $0x803648
+  800cf1:	e8 38 f4 ff ff       	call   80012e <_panic>
+
+00800cf6 <sys_getenvid>:
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	57                   	push   %edi
+  800cfa:	56                   	push   %esi
+  800cfb:	53                   	push   %ebx
+  800cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d01:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d06:	89 d1                	mov    %edx,%ecx
+  800d08:	89 d3                	mov    %edx,%ebx
+  800d0a:	89 d7                	mov    %edx,%edi
+  800d0c:	89 d6                	mov    %edx,%esi
+  800d0e:	cd 30                	int    $0x30
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+
+00800d15 <sys_yield>:
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+  800d1b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d22:	74 26                	je     800d4a <sys_yield+0x35>
+  800d24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d29:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d2e:	89 d1                	mov    %edx,%ecx
+  800d30:	89 d3                	mov    %edx,%ebx
+  800d32:	89 d7                	mov    %edx,%edi
+  800d34:	6a 00                	push   $0x0
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	8d 35 41 0d 80 00    	lea    0x800d41,%esi
+  800d3f:	0f 34                	sysenter
+  800d41:	5d                   	pop    %ebp
+  800d42:	83 c4 04             	add    $0x4,%esp
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+  800d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d54:	89 d1                	mov    %edx,%ecx
+  800d56:	89 d3                	mov    %edx,%ebx
+  800d58:	89 d7                	mov    %edx,%edi
+  800d5a:	89 d6                	mov    %edx,%esi
+  800d5c:	cd 30                	int    $0x30
+  800d5e:	eb e5                	jmp    800d45 <sys_yield+0x30>
+
+00800d60 <sys_page_alloc>:
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	57                   	push   %edi
+  800d64:	56                   	push   %esi
+  800d65:	53                   	push   %ebx
+  800d66:	83 ec 0c             	sub    $0xc,%esp
+  800d69:	be 00 00 00 00       	mov    $0x0,%esi
+  800d6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d74:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7c:	89 f7                	mov    %esi,%edi
+  800d7e:	cd 30                	int    $0x30
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	7f 08                	jg     800d8c <sys_page_alloc+0x2c>
+  800d84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	50                   	push   %eax
+  800d90:	6a 04                	push   $0x4
+  800d92:	68 2b 36 80 00       	push   $0x80362b
+  800d97:	6a 24                	push   $0x24
+  800d99:	68 48 36 80 00       	push   $0x803648
+  800d9e:	e8 8b f3 ff ff       	call   80012e <_panic>
+
+00800da3 <sys_page_map>:
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+  800da9:	83 ec 0c             	sub    $0xc,%esp
+  800dac:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800db3:	74 33                	je     800de8 <sys_page_map+0x45>
+  800db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc6:	ff 75 18             	push   0x18(%ebp)
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	8d 35 d4 0d 80 00    	lea    0x800dd4,%esi
+  800dd2:	0f 34                	sysenter
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	83 c4 04             	add    $0x4,%esp
+  800dd8:	89 c2                	mov    %eax,%edx
+  800dda:	85 c0                	test   %eax,%eax
+  800ddc:	7f 3d                	jg     800e1b <sys_page_map+0x78>
+  800dde:	89 d0                	mov    %edx,%eax
+  800de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+  800de8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ded:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dfc:	cd 30                	int    $0x30
+  800dfe:	89 c2                	mov    %eax,%edx
+  800e00:	85 c0                	test   %eax,%eax
+  800e02:	7e da                	jle    800dde <sys_page_map+0x3b>
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+  800e07:	50                   	push   %eax
+  800e08:	6a 05                	push   $0x5
+  800e0a:	68 2b 36 80 00       	push   $0x80362b
+  800e0f:	6a 24                	push   $0x24
+  800e11:	68 48 36 80 00       	push   $0x803648
+  800e16:	e8 13 f3 ff ff       	call   80012e <_panic>
+  800e1b:	83 ec 0c             	sub    $0xc,%esp
+  800e1e:	50                   	push   %eax
+  800e1f:	6a 05                	push   $0x5
+  800e21:	68 2b 36 80 00       	push   $0x80362b
+  800e26:	6a 48                	push   $0x48
+  800e28:	68 48 36 80 00       	push   $0x803648
+  800e2d:	e8 fc f2 ff ff       	call   80012e <_panic>
+
+00800e32 <sys_page_unmap>:
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+  800e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e4b:	89 df                	mov    %ebx,%edi
+  800e4d:	89 de                	mov    %ebx,%esi
+  800e4f:	cd 30                	int    $0x30
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_page_unmap+0x2b>
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 06                	push   $0x6
+  800e63:	68 2b 36 80 00       	push   $0x80362b
+  800e68:	6a 24                	push   $0x24
+  800e6a:	68 48 36 80 00       	push   $0x803648
+  800e6f:	e8 ba f2 ff ff       	call   80012e <_panic>
+
+00800e74 <sys_fork>:
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e84:	89 d1                	mov    %edx,%ecx
+  800e86:	89 d3                	mov    %edx,%ebx
+  800e88:	89 d7                	mov    %edx,%edi
+  800e8a:	89 d6                	mov    %edx,%esi
+  800e8c:	cd 30                	int    $0x30
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+
+00800e93 <sys_env_set_status>:
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eac:	89 df                	mov    %ebx,%edi
+  800eae:	89 de                	mov    %ebx,%esi
+  800eb0:	cd 30                	int    $0x30
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	7f 08                	jg     800ebe <sys_env_set_status+0x2b>
+  800eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  800ec1:	50                   	push   %eax
+  800ec2:	6a 08                	push   $0x8
+  800ec4:	68 2b 36 80 00       	push   $0x80362b
+  800ec9:	6a 24                	push   $0x24
+  800ecb:	68 48 36 80 00       	push   $0x803648
+  800ed0:	e8 59 f2 ff ff       	call   80012e <_panic>
+
+00800ed5 <sys_env_set_trapframe>:
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	56                   	push   %esi
+  800eda:	53                   	push   %ebx
+  800edb:	83 ec 0c             	sub    $0xc,%esp
+  800ede:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800eee:	89 df                	mov    %ebx,%edi
+  800ef0:	89 de                	mov    %ebx,%esi
+  800ef2:	cd 30                	int    $0x30
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	7f 08                	jg     800f00 <sys_env_set_trapframe+0x2b>
+  800ef8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efb:	5b                   	pop    %ebx
+  800efc:	5e                   	pop    %esi
+  800efd:	5f                   	pop    %edi
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	50                   	push   %eax
+  800f04:	6a 09                	push   $0x9
+  800f06:	68 2b 36 80 00       	push   $0x80362b
+  800f0b:	6a 24                	push   $0x24
+  800f0d:	68 48 36 80 00       	push   $0x803648
+  800f12:	e8 17 f2 ff ff       	call   80012e <_panic>
+
+00800f17 <sys_env_set_cow>:
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	57                   	push   %edi
+  800f1b:	56                   	push   %esi
+  800f1c:	53                   	push   %ebx
+  800f1d:	83 ec 0c             	sub    $0xc,%esp
+  800f20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2b:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f30:	89 df                	mov    %ebx,%edi
+  800f32:	89 de                	mov    %ebx,%esi
+  800f34:	cd 30                	int    $0x30
+  800f36:	85 c0                	test   %eax,%eax
+  800f38:	7f 08                	jg     800f42 <sys_env_set_cow+0x2b>
+  800f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3d:	5b                   	pop    %ebx
+  800f3e:	5e                   	pop    %esi
+  800f3f:	5f                   	pop    %edi
+  800f40:	5d                   	pop    %ebp
+  800f41:	c3                   	ret
+  800f42:	83 ec 0c             	sub    $0xc,%esp
+  800f45:	50                   	push   %eax
+  800f46:	6a 20                	push   $0x20
+  800f48:	68 2b 36 80 00       	push   $0x80362b
+  800f4d:	6a 24                	push   $0x24
+  800f4f:	68 48 36 80 00       	push   $0x803648
+  800f54:	e8 d5 f1 ff ff       	call   80012e <_panic>
+
+00800f59 <sys_env_service>:
+  800f59:	55                   	push   %ebp
+  800f5a:	89 e5                	mov    %esp,%ebp
+  800f5c:	57                   	push   %edi
+  800f5d:	56                   	push   %esi
+  800f5e:	53                   	push   %ebx
+  800f5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f67:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f6c:	89 cb                	mov    %ecx,%ebx
+  800f6e:	89 cf                	mov    %ecx,%edi
+  800f70:	89 ce                	mov    %ecx,%esi
+  800f72:	cd 30                	int    $0x30
+  800f74:	5b                   	pop    %ebx
+  800f75:	5e                   	pop    %esi
+  800f76:	5f                   	pop    %edi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+
+00800f79 <sys_env_set_pgfault_upcall>:
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	57                   	push   %edi
+  800f7d:	56                   	push   %esi
+  800f7e:	53                   	push   %ebx
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  800f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f92:	89 df                	mov    %ebx,%edi
+  800f94:	89 de                	mov    %ebx,%esi
+  800f96:	cd 30                	int    $0x30
+  800f98:	85 c0                	test   %eax,%eax
+  800f9a:	7f 08                	jg     800fa4 <sys_env_set_pgfault_upcall+0x2b>
+  800f9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9f:	5b                   	pop    %ebx
+  800fa0:	5e                   	pop    %esi
+  800fa1:	5f                   	pop    %edi
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	c3                   	ret
+  800fa4:	83 ec 0c             	sub    $0xc,%esp
+  800fa7:	50                   	push   %eax
+  800fa8:	6a 0a                	push   $0xa
+  800faa:	68 2b 36 80 00       	push   $0x80362b
+  800faf:	6a 24                	push   $0x24
+  800fb1:	68 48 36 80 00       	push   $0x803648
+  800fb6:	e8 73 f1 ff ff       	call   80012e <_panic>
+
+00800fbb <sys_ipc_try_send>:
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+  800fc1:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fc8:	74 27                	je     800ff1 <sys_ipc_try_send+0x36>
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fd5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fdb:	6a 00                	push   $0x0
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	8d 35 e8 0f 80 00    	lea    0x800fe8,%esi
+  800fe6:	0f 34                	sysenter
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	83 c4 04             	add    $0x4,%esp
+  800fec:	5b                   	pop    %ebx
+  800fed:	5e                   	pop    %esi
+  800fee:	5f                   	pop    %edi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+  800ff1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ff6:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801004:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801007:	cd 30                	int    $0x30
+  801009:	eb e1                	jmp    800fec <sys_ipc_try_send+0x31>
+
+0080100b <sys_ipc_recv>:
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	57                   	push   %edi
+  80100f:	56                   	push   %esi
+  801010:	53                   	push   %ebx
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  801014:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80101b:	74 32                	je     80104f <sys_ipc_recv+0x44>
+  80101d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801020:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801025:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80102a:	89 cb                	mov    %ecx,%ebx
+  80102c:	89 cf                	mov    %ecx,%edi
+  80102e:	6a 00                	push   $0x0
+  801030:	55                   	push   %ebp
+  801031:	89 e5                	mov    %esp,%ebp
+  801033:	8d 35 3b 10 80 00    	lea    0x80103b,%esi
+  801039:	0f 34                	sysenter
+  80103b:	5d                   	pop    %ebp
+  80103c:	83 c4 04             	add    $0x4,%esp
+  80103f:	89 c2                	mov    %eax,%edx
+  801041:	85 c0                	test   %eax,%eax
+  801043:	7f 3c                	jg     801081 <sys_ipc_recv+0x76>
+  801045:	89 d0                	mov    %edx,%eax
+  801047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+  80104f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801054:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801059:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105c:	89 cb                	mov    %ecx,%ebx
+  80105e:	89 cf                	mov    %ecx,%edi
+  801060:	89 ce                	mov    %ecx,%esi
+  801062:	cd 30                	int    $0x30
+  801064:	89 c2                	mov    %eax,%edx
+  801066:	85 c0                	test   %eax,%eax
+  801068:	7e db                	jle    801045 <sys_ipc_recv+0x3a>
+  80106a:	83 ec 0c             	sub    $0xc,%esp
+  80106d:	50                   	push   %eax
+  80106e:	6a 0d                	push   $0xd
+  801070:	68 2b 36 80 00       	push   $0x80362b
+  801075:	6a 24                	push   $0x24
+  801077:	68 48 36 80 00       	push   $0x803648
+  80107c:	e8 ad f0 ff ff       	call   80012e <_panic>
+  801081:	83 ec 0c             	sub    $0xc,%esp
+  801084:	50                   	push   %eax
+  801085:	6a 0d                	push   $0xd
+  801087:	68 2b 36 80 00       	push   $0x80362b
+  80108c:	6a 48                	push   $0x48
+  80108e:	68 48 36 80 00       	push   $0x803648
+  801093:	e8 96 f0 ff ff       	call   80012e <_panic>
+
+00801098 <sys_ipc_send>:
+  801098:	55                   	push   %ebp
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	57                   	push   %edi
+  80109c:	56                   	push   %esi
+  80109d:	53                   	push   %ebx
+  80109e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010a5:	74 27                	je     8010ce <sys_ipc_send+0x36>
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ad:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b8:	6a 00                	push   $0x0
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	8d 35 c5 10 80 00    	lea    0x8010c5,%esi
+  8010c3:	0f 34                	sysenter
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	83 c4 04             	add    $0x4,%esp
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+  8010ce:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e4:	cd 30                	int    $0x30
+  8010e6:	eb e1                	jmp    8010c9 <sys_ipc_send+0x31>
+
+008010e8 <sys_ipc_call>:
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	57                   	push   %edi
+  8010ec:	56                   	push   %esi
+  8010ed:	53                   	push   %ebx
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  801102:	cd 30                	int    $0x30
+  801104:	5b                   	pop    %ebx
+  801105:	5e                   	pop    %esi
+  801106:	5f                   	pop    %edi
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+
+00801109 <sys_ipc_reply_recv>:
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+  80110f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801112:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801115:	b8 10 00 00 00       	mov    $0x10,%eax
+  80111a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801120:	8b 75 18             	mov    0x18(%ebp),%esi
+  801123:	cd 30                	int    $0x30
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5f                   	pop    %edi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+
+0080112a <sys_time_msec>:
+  80112a:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80112f:	85 c0                	test   %eax,%eax
+  801131:	75 06                	jne    801139 <sys_time_msec+0xf>
+  801133:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801138:	c3                   	ret
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+  801142:	0f 31                	rdtsc
+  801144:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80114a:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801150:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801156:	29 c8                	sub    %ecx,%eax
+  801158:	19 da                	sbb    %ebx,%edx
+  80115a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	52                   	push   %edx
+  801162:	50                   	push   %eax
+  801163:	e8 ee 1f 00 00       	call   803156 <__udivdi3>
+  801168:	83 c4 10             	add    $0x10,%esp
+  80116b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116e:	5b                   	pop    %ebx
+  80116f:	5e                   	pop    %esi
+  801170:	5f                   	pop    %edi
+  801171:	5d                   	pop    %ebp
+  801172:	c3                   	ret
+
+00801173 <sys_env_swap>:
+  801173:	55                   	push   %ebp
+  801174:	89 e5                	mov    %esp,%ebp
+  801176:	57                   	push   %edi
+  801177:	56                   	push   %esi
+  801178:	53                   	push   %ebx
+  801179:	83 ec 0c             	sub    $0xc,%esp
+  80117c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801181:	8b 55 08             	mov    0x8(%ebp),%edx
+  801184:	b8 12 00 00 00       	mov    $0x12,%eax
+  801189:	89 cb                	mov    %ecx,%ebx
+  80118b:	89 cf                	mov    %ecx,%edi
+  80118d:	89 ce                	mov    %ecx,%esi
+  80118f:	cd 30                	int    $0x30
+  801191:	85 c0                	test   %eax,%eax
+  801193:	7f 08                	jg     80119d <sys_env_swap+0x2a>
+  801195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+  80119d:	83 ec 0c             	sub    $0xc,%esp
+  8011a0:	50                   	push   %eax
+  8011a1:	6a 12                	push   $0x12
+  8011a3:	68 2b 36 80 00       	push   $0x80362b
+  8011a8:	6a 24                	push   $0x24
+  8011aa:	68 48 36 80 00       	push   $0x803648
+  8011af:	e8 7a ef ff ff       	call   80012e <_panic>
+
+008011b4 <sys_net_try_send>:
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+  8011bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011cd:	89 df                	mov    %ebx,%edi
+  8011cf:	89 de                	mov    %ebx,%esi
+  8011d1:	cd 30                	int    $0x30
+  8011d3:	85 c0                	test   %eax,%eax
+  8011d5:	7f 08                	jg     8011df <sys_net_try_send+0x2b>
+  8011d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+  8011df:	83 ec 0c             	sub    $0xc,%esp
+  8011e2:	50                   	push   %eax
+  8011e3:	6a 13                	push   $0x13
+  8011e5:	68 2b 36 80 00       	push   $0x80362b
+  8011ea:	6a 24                	push   $0x24
+  8011ec:	68 48 36 80 00       	push   $0x803648
+  8011f1:	e8 38 ef ff ff       	call   80012e <_panic>
+
+008011f6 <sys_net_try_receive>:
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	57                   	push   %edi
+  8011fa:	56                   	push   %esi
+  8011fb:	53                   	push   %ebx
+  8011fc:	83 ec 0c             	sub    $0xc,%esp
+  8011ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801204:	8b 55 08             	mov    0x8(%ebp),%edx
+  801207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80120f:	89 df                	mov    %ebx,%edi
+  801211:	89 de                	mov    %ebx,%esi
+  801213:	cd 30                	int    $0x30
+  801215:	85 c0                	test   %eax,%eax
+  801217:	7f 08                	jg     801221 <sys_net_try_receive+0x2b>
+  801219:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121c:	5b                   	pop    %ebx
+  80121d:	5e                   	pop    %esi
+  80121e:	5f                   	pop    %edi
+  80121f:	5d                   	pop    %ebp
+  801220:	c3                   	ret
+  801221:	83 ec 0c             	sub    $0xc,%esp
+  801224:	50                   	push   %eax
+  801225:	6a 14                	push   $0x14
+  801227:	68 2b 36 80 00       	push   $0x80362b
+  80122c:	6a 24                	push   $0x24
+  80122e:	68 48 36 80 00       	push   $0x803648
+  801233:	e8 f6 ee ff ff       	call   80012e <_panic>
+
+00801238 <sys_net_recv_page>:
+  801238:	55                   	push   %ebp
+  801239:	89 e5                	mov    %esp,%ebp
+  80123b:	57                   	push   %edi
+  80123c:	56                   	push   %esi
+  80123d:	53                   	push   %ebx
+  80123e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+  801246:	b8 27 00 00 00       	mov    $0x27,%eax
+  80124b:	89 cb                	mov    %ecx,%ebx
+  80124d:	89 cf                	mov    %ecx,%edi
+  80124f:	89 ce                	mov    %ecx,%esi
+  801251:	cd 30                	int    $0x30
+  801253:	5b                   	pop    %ebx
+  801254:	5e                   	pop    %esi
+  801255:	5f                   	pop    %edi
+  801256:	5d                   	pop    %ebp
+  801257:	c3                   	ret
+
+00801258 <sys_net_wait>:
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	57                   	push   %edi
+  80125c:	56                   	push   %esi
+  80125d:	53                   	push   %ebx
+  80125e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801263:	b8 26 00 00 00       	mov    $0x26,%eax
+  801268:	89 d1                	mov    %edx,%ecx
+  80126a:	89 d3                	mov    %edx,%ebx
+  80126c:	89 d7                	mov    %edx,%edi
+  80126e:	89 d6                	mov    %edx,%esi
+  801270:	cd 30                	int    $0x30
+  801272:	5b                   	pop    %ebx
+  801273:	5e                   	pop    %esi
+  801274:	5f                   	pop    %edi
+  801275:	5d                   	pop    %ebp
+  801276:	c3                   	ret
+
+00801277 <sys_get_mac>:
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	57                   	push   %edi
+  80127b:	56                   	push   %esi
+  80127c:	53                   	push   %ebx
+  80127d:	83 ec 0c             	sub    $0xc,%esp
+  801280:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801290:	89 df                	mov    %ebx,%edi
+  801292:	89 de                	mov    %ebx,%esi
+  801294:	cd 30                	int    $0x30
+  801296:	85 c0                	test   %eax,%eax
+  801298:	7f 08                	jg     8012a2 <sys_get_mac+0x2b>
+  80129a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+  8012a2:	83 ec 0c             	sub    $0xc,%esp
+  8012a5:	50                   	push   %eax
+  8012a6:	6a 15                	push   $0x15
+  8012a8:	68 2b 36 80 00       	push   $0x80362b
+  8012ad:	6a 24                	push   $0x24
+  8012af:	68 48 36 80 00       	push   $0x803648
+  8012b4:	e8 75 ee ff ff       	call   80012e <_panic>
+
+008012b9 <sys_env_lease>:
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	57                   	push   %edi
+  8012bd:	56                   	push   %esi
+  8012be:	53                   	push   %ebx
+  8012bf:	83 ec 0c             	sub    $0xc,%esp
+  8012c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cd:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012d2:	89 df                	mov    %ebx,%edi
+  8012d4:	89 de                	mov    %ebx,%esi
+  8012d6:	cd 30                	int    $0x30
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	7f 08                	jg     8012e4 <sys_env_lease+0x2b>
+  8012dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012df:	5b                   	pop    %ebx
+  8012e0:	5e                   	pop    %esi
+  8012e1:	5f                   	pop    %edi
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+  8012e4:	83 ec 0c             	sub    $0xc,%esp
+  8012e7:	50                   	push   %eax
+  8012e8:	6a 16                	push   $0x16
+  8012ea:	68 2b 36 80 00       	push   $0x80362b
+  8012ef:	6a 24                	push   $0x24
+  8012f1:	68 48 36 80 00       	push   $0x803648
+  8012f6:	e8 33 ee ff ff       	call   80012e <_panic>
+
+008012fb <sys_copy_mem>:
+  8012fb:	55                   	push   %ebp
+  8012fc:	89 e5                	mov    %esp,%ebp
+  8012fe:	57                   	push   %edi
+  8012ff:	56                   	push   %esi
+  801300:	53                   	push   %ebx
+  801301:	83 ec 0c             	sub    $0xc,%esp
+  801304:	8b 55 08             	mov    0x8(%ebp),%edx
+  801307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80130f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801312:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801315:	8b 75 18             	mov    0x18(%ebp),%esi
+  801318:	cd 30                	int    $0x30
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	7f 08                	jg     801326 <sys_copy_mem+0x2b>
+  80131e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801321:	5b                   	pop    %ebx
+  801322:	5e                   	pop    %esi
+  801323:	5f                   	pop    %edi
+  801324:	5d                   	pop    %ebp
+  801325:	c3                   	ret
+  801326:	83 ec 0c             	sub    $0xc,%esp
+  801329:	50                   	push   %eax
+  80132a:	6a 17                	push   $0x17
+  80132c:	68 2b 36 80 00       	push   $0x80362b
+  801331:	6a 24                	push   $0x24
+  801333:	68 48 36 80 00       	push   $0x803648
+  801338:	e8 f1 ed ff ff       	call   80012e <_panic>
+
+0080133d <sys_get_perms>:
+  80133d:	55                   	push   %ebp
+  80133e:	89 e5                	mov    %esp,%ebp
+  801340:	57                   	push   %edi
+  801341:	56                   	push   %esi
+  801342:	53                   	push   %ebx
+  801343:	83 ec 0c             	sub    $0xc,%esp
+  801346:	be 00 00 00 00       	mov    $0x0,%esi
+  80134b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801351:	b8 18 00 00 00       	mov    $0x18,%eax
+  801356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801359:	89 f7                	mov    %esi,%edi
+  80135b:	cd 30                	int    $0x30
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	7f 08                	jg     801369 <sys_get_perms+0x2c>
+  801361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	50                   	push   %eax
+  80136d:	6a 18                	push   $0x18
+  80136f:	68 2b 36 80 00       	push   $0x80362b
+  801374:	6a 24                	push   $0x24
+  801376:	68 48 36 80 00       	push   $0x803648
+  80137b:	e8 ae ed ff ff       	call   80012e <_panic>
+
+00801380 <sys_env_unsuspend>:
+  801380:	55                   	push   %ebp
+  801381:	89 e5                	mov    %esp,%ebp
+  801383:	57                   	push   %edi
+  801384:	56                   	push   %esi
+  801385:	53                   	push   %ebx
+  801386:	83 ec 0c             	sub    $0xc,%esp
+  801389:	be 00 00 00 00       	mov    $0x0,%esi
+  80138e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801391:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801394:	b8 19 00 00 00       	mov    $0x19,%eax
+  801399:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139c:	89 f7                	mov    %esi,%edi
+  80139e:	cd 30                	int    $0x30
+  8013a0:	85 c0                	test   %eax,%eax
+  8013a2:	7f 08                	jg     8013ac <sys_env_unsuspend+0x2c>
+  8013a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a7:	5b                   	pop    %ebx
+  8013a8:	5e                   	pop    %esi
+  8013a9:	5f                   	pop    %edi
+  8013aa:	5d                   	pop    %ebp
+  8013ab:	c3                   	ret
+  8013ac:	83 ec 0c             	sub    $0xc,%esp
+  8013af:	50                   	push   %eax
+  8013b0:	6a 19                	push   $0x19
+  8013b2:	68 2b 36 80 00       	push   $0x80362b
+  8013b7:	6a 24                	push   $0x24
+  8013b9:	68 48 36 80 00       	push   $0x803648
+  8013be:	e8 6b ed ff ff       	call   80012e <_panic>
+
+008013c3 <sys_migrate>:
+  8013c3:	55                   	push   %ebp
+  8013c4:	89 e5                	mov    %esp,%ebp
+  8013c6:	57                   	push   %edi
+  8013c7:	56                   	push   %esi
+  8013c8:	53                   	push   %ebx
+  8013c9:	83 ec 0c             	sub    $0xc,%esp
+  8013cc:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8013d1:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8013d7:	76 11                	jbe    8013ea <sys_migrate+0x27>
+  8013d9:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8013de:	0f b6 08             	movzbl (%eax),%ecx
+  8013e1:	05 00 10 00 00       	add    $0x1000,%eax
+  8013e6:	39 d0                	cmp    %edx,%eax
+  8013e8:	72 f4                	jb     8013de <sys_migrate+0x1b>
+  8013ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013f7:	89 cb                	mov    %ecx,%ebx
+  8013f9:	89 cf                	mov    %ecx,%edi
+  8013fb:	89 ce                	mov    %ecx,%esi
+  8013fd:	cd 30                	int    $0x30
+  8013ff:	85 c0                	test   %eax,%eax
+  801401:	7f 08                	jg     80140b <sys_migrate+0x48>
+  801403:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801406:	5b                   	pop    %ebx
+  801407:	5e                   	pop    %esi
+  801408:	5f                   	pop    %edi
+  801409:	5d                   	pop    %ebp
+  80140a:	c3                   	ret
+  80140b:	83 ec 0c             	sub    $0xc,%esp
+  80140e:	50                   	push   %eax
+  80140f:	6a 1a                	push   $0x1a
+  801411:	68 2b 36 80 00       	push   $0x80362b
+  801416:	6a 24                	push   $0x24
+  801418:	68 48 36 80 00       	push   $0x803648
+  80141d:	e8 0c ed ff ff       	call   80012e <_panic>
+
+00801422 <sys_lease_complete>:
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	57                   	push   %edi
+  801426:	56                   	push   %esi
+  801427:	53                   	push   %ebx
+  801428:	83 ec 0c             	sub    $0xc,%esp
+  80142b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801430:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801435:	89 d1                	mov    %edx,%ecx
+  801437:	89 d3                	mov    %edx,%ebx
+  801439:	89 d7                	mov    %edx,%edi
+  80143b:	89 d6                	mov    %edx,%esi
+  80143d:	cd 30                	int    $0x30
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	7f 08                	jg     80144b <sys_lease_complete+0x29>
+  801443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801446:	5b                   	pop    %ebx
+  801447:	5e                   	pop    %esi
+  801448:	5f                   	pop    %edi
+  801449:	5d                   	pop    %ebp
+  80144a:	c3                   	ret
+  80144b:	83 ec 0c             	sub    $0xc,%esp
+  80144e:	50                   	push   %eax
+  80144f:	6a 1b                	push   $0x1b
+  801451:	68 2b 36 80 00       	push   $0x80362b
+  801456:	6a 24                	push   $0x24
+  801458:	68 48 36 80 00       	push   $0x803648
+  80145d:	e8 cc ec ff ff       	call   80012e <_panic>
+
+00801462 <sys_env_set_thisenv>:
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	57                   	push   %edi
+  801466:	56                   	push   %esi
+  801467:	53                   	push   %ebx
+  801468:	83 ec 0c             	sub    $0xc,%esp
+  80146b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801470:	8b 55 08             	mov    0x8(%ebp),%edx
+  801473:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801476:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80147b:	89 df                	mov    %ebx,%edi
+  80147d:	89 de                	mov    %ebx,%esi
+  80147f:	cd 30                	int    $0x30
+  801481:	85 c0                	test   %eax,%eax
+  801483:	7f 08                	jg     80148d <sys_env_set_thisenv+0x2b>
+  801485:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801488:	5b                   	pop    %ebx
+  801489:	5e                   	pop    %esi
+  80148a:	5f                   	pop    %edi
+  80148b:	5d                   	pop    %ebp
+  80148c:	c3                   	ret
+  80148d:	83 ec 0c             	sub    $0xc,%esp
+  801490:	50                   	push   %eax
+  801491:	6a 1c                	push   $0x1c
+  801493:	68 2b 36 80 00       	push   $0x80362b
+  801498:	6a 24                	push   $0x24
+  80149a:	68 48 36 80 00       	push   $0x803648
+  80149f:	e8 8a ec ff ff       	call   80012e <_panic>
+
+008014a4 <sys_env_set_sched>:
+  8014a4:	55                   	push   %ebp
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	57                   	push   %edi
+  8014a8:	56                   	push   %esi
+  8014a9:	53                   	push   %ebx
+  8014aa:	83 ec 0c             	sub    $0xc,%esp
+  8014ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c0:	89 f7                	mov    %esi,%edi
+  8014c2:	cd 30                	int    $0x30
+  8014c4:	85 c0                	test   %eax,%eax
+  8014c6:	7f 08                	jg     8014d0 <sys_env_set_sched+0x2c>
+  8014c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014cb:	5b                   	pop    %ebx
+  8014cc:	5e                   	pop    %esi
+  8014cd:	5f                   	pop    %edi
+  8014ce:	5d                   	pop    %ebp
+  8014cf:	c3                   	ret
+  8014d0:	83 ec 0c             	sub    $0xc,%esp
+  8014d3:	50                   	push   %eax
+  8014d4:	6a 1d                	push   $0x1d
+  8014d6:	68 2b 36 80 00       	push   $0x80362b
+  8014db:	6a 24                	push   $0x24
+  8014dd:	68 48 36 80 00       	push   $0x803648
+  8014e2:	e8 47 ec ff ff       	call   80012e <_panic>
+
+008014e7 <sys_batch>:
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	57                   	push   %edi
+  8014eb:	56                   	push   %esi
+  8014ec:	53                   	push   %ebx
+  8014ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014fd:	89 df                	mov    %ebx,%edi
+  8014ff:	89 de                	mov    %ebx,%esi
+  801501:	cd 30                	int    $0x30
+  801503:	5b                   	pop    %ebx
+  801504:	5e                   	pop    %esi
+  801505:	5f                   	pop    %edi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+
+00801508 <sys_env_stats>:
+  801508:	55                   	push   %ebp
+  801509:	89 e5                	mov    %esp,%ebp
+  80150b:	57                   	push   %edi
+  80150c:	56                   	push   %esi
+  80150d:	53                   	push   %ebx
+  80150e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801513:	8b 55 08             	mov    0x8(%ebp),%edx
+  801516:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801519:	b8 23 00 00 00       	mov    $0x23,%eax
+  80151e:	89 df                	mov    %ebx,%edi
+  801520:	89 de                	mov    %ebx,%esi
+  801522:	cd 30                	int    $0x30
+  801524:	5b                   	pop    %ebx
+  801525:	5e                   	pop    %esi
+  801526:	5f                   	pop    %edi
+  801527:	5d                   	pop    %ebp
+  801528:	c3                   	ret
+
+00801529 <sys_trace>:
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	57                   	push   %edi
+  80152d:	56                   	push   %esi
+  80152e:	53                   	push   %ebx
+  80152f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801534:	8b 55 08             	mov    0x8(%ebp),%edx
+  801537:	b8 24 00 00 00       	mov    $0x24,%eax
+  80153c:	89 cb                	mov    %ecx,%ebx
+  80153e:	89 cf                	mov    %ecx,%edi
+  801540:	89 ce                	mov    %ecx,%esi
+  801542:	cd 30                	int    $0x30
+  801544:	5b                   	pop    %ebx
+  801545:	5e                   	pop    %esi
+  801546:	5f                   	pop    %edi
+  801547:	5d                   	pop    %ebp
+  801548:	c3                   	ret
+
+00801549 <sys_env_set_pager>:
+  801549:	55                   	push   %ebp
+  80154a:	89 e5                	mov    %esp,%ebp
+  80154c:	57                   	push   %edi
+  80154d:	56                   	push   %esi
+  80154e:	53                   	push   %ebx
+  80154f:	83 ec 0c             	sub    $0xc,%esp
+  801552:	be 00 00 00 00       	mov    $0x0,%esi
+  801557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155d:	b8 25 00 00 00       	mov    $0x25,%eax
+  801562:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801565:	89 f7                	mov    %esi,%edi
+  801567:	cd 30                	int    $0x30
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	7f 08                	jg     801575 <sys_env_set_pager+0x2c>
+  80156d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5f                   	pop    %edi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+  801575:	83 ec 0c             	sub    $0xc,%esp
+  801578:	50                   	push   %eax
+  801579:	6a 25                	push   $0x25
+  80157b:	68 2b 36 80 00       	push   $0x80362b
+  801580:	6a 24                	push   $0x24
+  801582:	68 48 36 80 00       	push   $0x803648
+  801587:	e8 a2 eb ff ff       	call   80012e <_panic>
+
+0080158c <sys_pager_retire>:
+  80158c:	55                   	push   %ebp
+  80158d:	89 e5                	mov    %esp,%ebp
+  80158f:	57                   	push   %edi
+  801590:	56                   	push   %esi
+  801591:	53                   	push   %ebx
+  801592:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801597:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159a:	b8 28 00 00 00       	mov    $0x28,%eax
+  80159f:	89 cb                	mov    %ecx,%ebx
+  8015a1:	89 cf                	mov    %ecx,%edi
+  8015a3:	89 ce                	mov    %ecx,%esi
+  8015a5:	cd 30                	int    $0x30
+  8015a7:	5b                   	pop    %ebx
+  8015a8:	5e                   	pop    %esi
+  8015a9:	5f                   	pop    %edi
+  8015aa:	5d                   	pop    %ebp
+  8015ab:	c3                   	ret
+
+008015ac <sys_prof>:
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	57                   	push   %edi
+  8015b0:	56                   	push   %esi
+  8015b1:	53                   	push   %ebx
+  8015b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bd:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c5:	89 f7                	mov    %esi,%edi
+  8015c7:	cd 30                	int    $0x30
+  8015c9:	5b                   	pop    %ebx
+  8015ca:	5e                   	pop    %esi
+  8015cb:	5f                   	pop    %edi
+  8015cc:	5d                   	pop    %ebp
+  8015cd:	c3                   	ret
+
+008015ce <set_pgfault_handler>:
+  8015ce:	55                   	push   %ebp
+  8015cf:	89 e5                	mov    %esp,%ebp
+  8015d1:	53                   	push   %ebx
+  8015d2:	83 ec 04             	sub    $0x4,%esp
+  8015d5:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  8015dc:	74 0d                	je     8015eb <set_pgfault_handler+0x1d>
+  8015de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e1:	a3 14 50 80 00       	mov    %eax,0x805014
+  8015e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+  8015eb:	e8 06 f7 ff ff       	call   800cf6 <sys_getenvid>
+  8015f0:	89 c3                	mov    %eax,%ebx
+  8015f2:	83 ec 04             	sub    $0x4,%esp
+  8015f5:	6a 07                	push   $0x7
+  8015f7:	68 00 f0 7f ee       	push   $0xee7ff000
+  8015fc:	50                   	push   %eax
+  8015fd:	e8 5e f7 ff ff       	call   800d60 <sys_page_alloc>
+  801602:	83 c4 10             	add    $0x10,%esp
+  801605:	85 c0                	test   %eax,%eax
+  801607:	78 29                	js     801632 <set_pgfault_handler+0x64>
+  801609:	83 ec 08             	sub    $0x8,%esp
+  80160c:	68 46 16 80 00       	push   $0x801646
+  801611:	53                   	push   %ebx
+  801612:	e8 62 f9 ff ff       	call   800f79 <sys_env_set_pgfault_upcall>
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	79 c0                	jns    8015de <set_pgfault_handler+0x10>
+  80161e:	83 ec 04             	sub    $0x4,%esp
+  801621:	68 90 36 80 00       	push   $0x803690
+  801626:	6a 27                	push   $0x27
+  801628:	68 c2 36 80 00       	push   $0x8036c2
+  80162d:	e8 fc ea ff ff       	call   80012e <_panic>
+  801632:	83 ec 04             	sub    $0x4,%esp
+  801635:	68 58 36 80 00       	push   $0x803658
+  80163a:	6a 23                	push   $0x23
+  80163c:	68 c2 36 80 00       	push   $0x8036c2
+  801641:	e8 e8 ea ff ff       	call   80012e <_panic>
+
+00801646 <_pgfault_upcall>:
+  801646:	54                   	push   %esp
+  801647:	a1 14 50 80 00       	mov    0x805014,%eax
+  80164c:	ff d0                	call   *%eax
+  80164e:	83 c4 04             	add    $0x4,%esp
+  801651:	89 e3                	mov    %esp,%ebx
+  801653:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  801657:	8b 54 24 30          	mov    0x30(%esp),%edx
+  80165b:	89 d4                	mov    %edx,%esp
+  80165d:	51                   	push   %ecx
+  80165e:	89 dc                	mov    %ebx,%esp
+  801660:	83 ea 04             	sub    $0x4,%edx
+  801663:	89 54 24 30          	mov    %edx,0x30(%esp)
+  801667:	83 c4 08             	add    $0x8,%esp
+  80166a:	61                   	popa
+  80166b:	83 c4 04             	add    $0x4,%esp
+  80166e:	9d                   	popf
+  80166f:	5c                   	pop    %esp
+  801670:	c3                   	ret
+
+00801671 <fd2num>:
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	8b 45 08             	mov    0x8(%ebp),%eax
+  801677:	05 00 00 00 30       	add    $0x30000000,%eax
+  80167c:	c1 e8 0c             	shr    $0xc,%eax
+  80167f:	5d                   	pop    %ebp
+  801680:	c3                   	ret
+
+00801681 <fd2data>:
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	8b 45 08             	mov    0x8(%ebp),%eax
+  801687:	05 00 00 00 30       	add    $0x30000000,%eax
+  80168c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801691:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801696:	5d                   	pop    %ebp
+  801697:	c3                   	ret
+
+00801698 <fd_alloc>:
+  801698:	55                   	push   %ebp
+  801699:	89 e5                	mov    %esp,%ebp
+  80169b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016a0:	89 c2                	mov    %eax,%edx
+  8016a2:	c1 ea 16             	shr    $0x16,%edx
+  8016a5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016ac:	f6 c2 01             	test   $0x1,%dl
+  8016af:	74 29                	je     8016da <fd_alloc+0x42>
+  8016b1:	89 c2                	mov    %eax,%edx
+  8016b3:	c1 ea 0c             	shr    $0xc,%edx
+  8016b6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016bd:	f6 c2 01             	test   $0x1,%dl
+  8016c0:	74 18                	je     8016da <fd_alloc+0x42>
+  8016c2:	05 00 10 00 00       	add    $0x1000,%eax
+  8016c7:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8016cc:	75 d2                	jne    8016a0 <fd_alloc+0x8>
+  8016ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016d8:	eb 05                	jmp    8016df <fd_alloc+0x47>
+  8016da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e2:	89 02                	mov    %eax,(%edx)
+  8016e4:	89 c8                	mov    %ecx,%eax
+  8016e6:	5d                   	pop    %ebp
+  8016e7:	c3                   	ret
+
+008016e8 <fd_lookup>:
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ee:	83 f8 1f             	cmp    $0x1f,%eax
+  8016f1:	77 30                	ja     801723 <fd_lookup+0x3b>
+  8016f3:	c1 e0 0c             	shl    $0xc,%eax
+  8016f6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8016fb:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801701:	f6 c2 01             	test   $0x1,%dl
+  801704:	74 24                	je     80172a <fd_lookup+0x42>
+  801706:	89 c2                	mov    %eax,%edx
+  801708:	c1 ea 0c             	shr    $0xc,%edx
+  80170b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801712:	f6 c2 01             	test   $0x1,%dl
+  801715:	74 1a                	je     801731 <fd_lookup+0x49>
+  801717:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171a:	89 02                	mov    %eax,(%edx)
+  80171c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801721:	5d                   	pop    %ebp
+  801722:	c3                   	ret
+  801723:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801728:	eb f7                	jmp    801721 <fd_lookup+0x39>
+  80172a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80172f:	eb f0                	jmp    801721 <fd_lookup+0x39>
+  801731:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801736:	eb e9                	jmp    801721 <fd_lookup+0x39>
+
+00801738 <dev_lookup>:
+  801738:	55                   	push   %ebp
+  801739:	89 e5                	mov    %esp,%ebp
+  80173b:	53                   	push   %ebx
+  80173c:	83 ec 04             	sub    $0x4,%esp
+  80173f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801742:	b8 00 00 00 00       	mov    $0x0,%eax
+  801747:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  80174c:	39 13                	cmp    %edx,(%ebx)
+  80174e:	74 37                	je     801787 <dev_lookup+0x4f>
+  801750:	83 c0 01             	add    $0x1,%eax
+  801753:	8b 1c 85 4c 37 80 00 	mov    0x80374c(,%eax,4),%ebx
+  80175a:	85 db                	test   %ebx,%ebx
+  80175c:	75 ee                	jne    80174c <dev_lookup+0x14>
+  80175e:	a1 10 50 80 00       	mov    0x805010,%eax
+  801763:	8b 40 48             	mov    0x48(%eax),%eax
+  801766:	83 ec 04             	sub    $0x4,%esp
+  801769:	52                   	push   %edx
+  80176a:	50                   	push   %eax
+  80176b:	68 d0 36 80 00       	push   $0x8036d0
+  801770:	e8 94 ea ff ff       	call   800209 <cprintf>
+  801775:	83 c4 10             	add    $0x10,%esp
+  801778:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80177d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801780:	89 1a                	mov    %ebx,(%edx)
+  801782:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801785:	c9                   	leave
+  801786:	c3                   	ret
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178c:	eb ef                	jmp    80177d <dev_lookup+0x45>
+
+0080178e <fd_close>:
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	57                   	push   %edi
+  801792:	56                   	push   %esi
+  801793:	53                   	push   %ebx
+  801794:	83 ec 24             	sub    $0x24,%esp
+  801797:	8b 75 08             	mov    0x8(%ebp),%esi
+  80179a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80179d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017a0:	50                   	push   %eax
+  8017a1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017a7:	c1 e8 0c             	shr    $0xc,%eax
+  8017aa:	50                   	push   %eax
+  8017ab:	e8 38 ff ff ff       	call   8016e8 <fd_lookup>
+  8017b0:	89 c3                	mov    %eax,%ebx
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	78 05                	js     8017be <fd_close+0x30>
+  8017b9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017bc:	74 0f                	je     8017cd <fd_close+0x3f>
+  8017be:	85 ff                	test   %edi,%edi
+  8017c0:	0f 44 df             	cmove  %edi,%ebx
+  8017c3:	89 d8                	mov    %ebx,%eax
+  8017c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c8:	5b                   	pop    %ebx
+  8017c9:	5e                   	pop    %esi
+  8017ca:	5f                   	pop    %edi
+  8017cb:	5d                   	pop    %ebp
+  8017cc:	c3                   	ret
+  8017cd:	83 ec 08             	sub    $0x8,%esp
+  8017d0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017d3:	50                   	push   %eax
+  8017d4:	ff 36                	push   (%esi)
+  8017d6:	e8 5d ff ff ff       	call   801738 <dev_lookup>
+  8017db:	89 c3                	mov    %eax,%ebx
+  8017dd:	83 c4 10             	add    $0x10,%esp
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	78 1a                	js     8017fe <fd_close+0x70>
+  8017e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017e7:	8b 40 10             	mov    0x10(%eax),%eax
+  8017ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	74 0b                	je     8017fe <fd_close+0x70>
+  8017f3:	83 ec 0c             	sub    $0xc,%esp
+  8017f6:	56                   	push   %esi
+  8017f7:	ff d0                	call   *%eax
+  8017f9:	89 c3                	mov    %eax,%ebx
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	83 ec 08             	sub    $0x8,%esp
+  801801:	56                   	push   %esi
+  801802:	6a 00                	push   $0x0
+  801804:	e8 29 f6 ff ff       	call   800e32 <sys_page_unmap>
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	eb b5                	jmp    8017c3 <fd_close+0x35>
+
+0080180e <close>:
+  80180e:	55                   	push   %ebp
+  80180f:	89 e5                	mov    %esp,%ebp
+  801811:	83 ec 20             	sub    $0x20,%esp
+  801814:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801817:	50                   	push   %eax
+  801818:	ff 75 08             	push   0x8(%ebp)
+  80181b:	e8 c8 fe ff ff       	call   8016e8 <fd_lookup>
+  801820:	83 c4 10             	add    $0x10,%esp
+  801823:	85 c0                	test   %eax,%eax
+  801825:	79 02                	jns    801829 <close+0x1b>
+  801827:	c9                   	leave
+  801828:	c3                   	ret
+  801829:	83 ec 08             	sub    $0x8,%esp
+  80182c:	6a 01                	push   $0x1
+  80182e:	ff 75 f4             	push   -0xc(%ebp)
+  801831:	e8 58 ff ff ff       	call   80178e <fd_close>
+  801836:	83 c4 10             	add    $0x10,%esp
+  801839:	eb ec                	jmp    801827 <close+0x19>
+
+0080183b <close_all>:
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	53                   	push   %ebx
+  80183f:	83 ec 04             	sub    $0x4,%esp
+  801842:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801847:	83 ec 0c             	sub    $0xc,%esp
+  80184a:	53                   	push   %ebx
+  80184b:	e8 be ff ff ff       	call   80180e <close>
+  801850:	83 c3 01             	add    $0x1,%ebx
+  801853:	83 c4 10             	add    $0x10,%esp
+  801856:	83 fb 20             	cmp    $0x20,%ebx
+  801859:	75 ec                	jne    801847 <close_all+0xc>
+  80185b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80185e:	c9                   	leave
+  80185f:	c3                   	ret
+
+00801860 <dup>:
+  801860:	55                   	push   %ebp
+  801861:	89 e5                	mov    %esp,%ebp
+  801863:	57                   	push   %edi
+  801864:	56                   	push   %esi
+  801865:	53                   	push   %ebx
+  801866:	83 ec 34             	sub    $0x34,%esp
+  801869:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80186c:	50                   	push   %eax
+  80186d:	ff 75 08             	push   0x8(%ebp)
+  801870:	e8 73 fe ff ff       	call   8016e8 <fd_lookup>
+  801875:	89 c3                	mov    %eax,%ebx
+  801877:	83 c4 10             	add    $0x10,%esp
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	78 7f                	js     8018fd <dup+0x9d>
+  80187e:	83 ec 0c             	sub    $0xc,%esp
+  801881:	ff 75 0c             	push   0xc(%ebp)
+  801884:	e8 85 ff ff ff       	call   80180e <close>
+  801889:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80188c:	c1 e6 0c             	shl    $0xc,%esi
+  80188f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801895:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801898:	89 3c 24             	mov    %edi,(%esp)
+  80189b:	e8 e1 fd ff ff       	call   801681 <fd2data>
+  8018a0:	89 c3                	mov    %eax,%ebx
+  8018a2:	89 34 24             	mov    %esi,(%esp)
+  8018a5:	e8 d7 fd ff ff       	call   801681 <fd2data>
+  8018aa:	83 c4 10             	add    $0x10,%esp
+  8018ad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8018b0:	89 d8                	mov    %ebx,%eax
+  8018b2:	c1 e8 16             	shr    $0x16,%eax
+  8018b5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018bc:	a8 01                	test   $0x1,%al
+  8018be:	74 11                	je     8018d1 <dup+0x71>
+  8018c0:	89 d8                	mov    %ebx,%eax
+  8018c2:	c1 e8 0c             	shr    $0xc,%eax
+  8018c5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018cc:	f6 c2 01             	test   $0x1,%dl
+  8018cf:	75 36                	jne    801907 <dup+0xa7>
+  8018d1:	89 f8                	mov    %edi,%eax
+  8018d3:	c1 e8 0c             	shr    $0xc,%eax
+  8018d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018dd:	83 ec 0c             	sub    $0xc,%esp
+  8018e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018e5:	50                   	push   %eax
+  8018e6:	56                   	push   %esi
+  8018e7:	6a 00                	push   $0x0
+  8018e9:	57                   	push   %edi
+  8018ea:	6a 00                	push   $0x0
+  8018ec:	e8 b2 f4 ff ff       	call   800da3 <sys_page_map>
+  8018f1:	89 c3                	mov    %eax,%ebx
+  8018f3:	83 c4 20             	add    $0x20,%esp
+  8018f6:	85 c0                	test   %eax,%eax
+  8018f8:	78 33                	js     80192d <dup+0xcd>
+  8018fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018fd:	89 d8                	mov    %ebx,%eax
+  8018ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801902:	5b                   	pop    %ebx
+  801903:	5e                   	pop    %esi
+  801904:	5f                   	pop    %edi
+  801905:	5d                   	pop    %ebp
+  801906:	c3                   	ret
+  801907:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80190e:	83 ec 0c             	sub    $0xc,%esp
+  801911:	25 07 0e 00 00       	and    $0xe07,%eax
+  801916:	50                   	push   %eax
+  801917:	ff 75 d4             	push   -0x2c(%ebp)
+  80191a:	6a 00                	push   $0x0
+  80191c:	53                   	push   %ebx
+  80191d:	6a 00                	push   $0x0
+  80191f:	e8 7f f4 ff ff       	call   800da3 <sys_page_map>
+  801924:	89 c3                	mov    %eax,%ebx
+  801926:	83 c4 20             	add    $0x20,%esp
+  801929:	85 c0                	test   %eax,%eax
+  80192b:	79 a4                	jns    8018d1 <dup+0x71>
+  80192d:	83 ec 08             	sub    $0x8,%esp
+  801930:	56                   	push   %esi
+  801931:	6a 00                	push   $0x0
+  801933:	e8 fa f4 ff ff       	call   800e32 <sys_page_unmap>
+  801938:	83 c4 08             	add    $0x8,%esp
+  80193b:	ff 75 d4             	push   -0x2c(%ebp)
+  80193e:	6a 00                	push   $0x0
+  801940:	e8 ed f4 ff ff       	call   800e32 <sys_page_unmap>
+  801945:	83 c4 10             	add    $0x10,%esp
+  801948:	eb b3                	jmp    8018fd <dup+0x9d>
+
+0080194a <read>:
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	56                   	push   %esi
+  80194e:	53                   	push   %ebx
+  80194f:	83 ec 18             	sub    $0x18,%esp
+  801952:	8b 75 08             	mov    0x8(%ebp),%esi
+  801955:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801958:	50                   	push   %eax
+  801959:	56                   	push   %esi
+  80195a:	e8 89 fd ff ff       	call   8016e8 <fd_lookup>
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	85 c0                	test   %eax,%eax
+  801964:	78 3c                	js     8019a2 <read+0x58>
+  801966:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801969:	83 ec 08             	sub    $0x8,%esp
+  80196c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196f:	50                   	push   %eax
+  801970:	ff 33                	push   (%ebx)
+  801972:	e8 c1 fd ff ff       	call   801738 <dev_lookup>
+  801977:	83 c4 10             	add    $0x10,%esp
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 24                	js     8019a2 <read+0x58>
+  80197e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801981:	83 e0 03             	and    $0x3,%eax
+  801984:	83 f8 01             	cmp    $0x1,%eax
+  801987:	74 20                	je     8019a9 <read+0x5f>
+  801989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198c:	8b 40 08             	mov    0x8(%eax),%eax
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	74 37                	je     8019ca <read+0x80>
+  801993:	83 ec 04             	sub    $0x4,%esp
+  801996:	ff 75 10             	push   0x10(%ebp)
+  801999:	ff 75 0c             	push   0xc(%ebp)
+  80199c:	53                   	push   %ebx
+  80199d:	ff d0                	call   *%eax
+  80199f:	83 c4 10             	add    $0x10,%esp
+  8019a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a5:	5b                   	pop    %ebx
+  8019a6:	5e                   	pop    %esi
+  8019a7:	5d                   	pop    %ebp
+  8019a8:	c3                   	ret
+  8019a9:	a1 10 50 80 00       	mov    0x805010,%eax
+  8019ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8019b1:	83 ec 04             	sub    $0x4,%esp
+  8019b4:	56                   	push   %esi
+  8019b5:	50                   	push   %eax
+  8019b6:	68 11 37 80 00       	push   $0x803711
+  8019bb:	e8 49 e8 ff ff       	call   800209 <cprintf>
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c8:	eb d8                	jmp    8019a2 <read+0x58>
+  8019ca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019cf:	eb d1                	jmp    8019a2 <read+0x58>
+
+008019d1 <readn>:
+  8019d1:	55                   	push   %ebp
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	57                   	push   %edi
+  8019d5:	56                   	push   %esi
+  8019d6:	53                   	push   %ebx
+  8019d7:	83 ec 0c             	sub    $0xc,%esp
+  8019da:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8019dd:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019e0:	85 f6                	test   %esi,%esi
+  8019e2:	74 30                	je     801a14 <readn+0x43>
+  8019e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+  8019f1:	89 f2                	mov    %esi,%edx
+  8019f3:	29 c2                	sub    %eax,%edx
+  8019f5:	52                   	push   %edx
+  8019f6:	01 f8                	add    %edi,%eax
+  8019f8:	50                   	push   %eax
+  8019f9:	ff 75 08             	push   0x8(%ebp)
+  8019fc:	e8 49 ff ff ff       	call   80194a <read>
+  801a01:	83 c4 10             	add    $0x10,%esp
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	78 15                	js     801a1d <readn+0x4c>
+  801a08:	74 11                	je     801a1b <readn+0x4a>
+  801a0a:	01 c3                	add    %eax,%ebx
+  801a0c:	89 d8                	mov    %ebx,%eax
+  801a0e:	39 f3                	cmp    %esi,%ebx
+  801a10:	72 dc                	jb     8019ee <readn+0x1d>
+  801a12:	eb 09                	jmp    801a1d <readn+0x4c>
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a19:	eb 02                	jmp    801a1d <readn+0x4c>
+  801a1b:	89 d8                	mov    %ebx,%eax
+  801a1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a20:	5b                   	pop    %ebx
+  801a21:	5e                   	pop    %esi
+  801a22:	5f                   	pop    %edi
+  801a23:	5d                   	pop    %ebp
+  801a24:	c3                   	ret
+
+00801a25 <write>:
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	56                   	push   %esi
+  801a29:	53                   	push   %ebx
+  801a2a:	83 ec 18             	sub    $0x18,%esp
+  801a2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a30:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a33:	50                   	push   %eax
+  801a34:	53                   	push   %ebx
+  801a35:	e8 ae fc ff ff       	call   8016e8 <fd_lookup>
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 37                	js     801a78 <write+0x53>
+  801a41:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a44:	83 ec 08             	sub    $0x8,%esp
+  801a47:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a4a:	50                   	push   %eax
+  801a4b:	ff 36                	push   (%esi)
+  801a4d:	e8 e6 fc ff ff       	call   801738 <dev_lookup>
+  801a52:	83 c4 10             	add    $0x10,%esp
+  801a55:	85 c0                	test   %eax,%eax
+  801a57:	78 1f                	js     801a78 <write+0x53>
+  801a59:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a5d:	74 20                	je     801a7f <write+0x5a>
+  801a5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a62:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	74 37                	je     801aa0 <write+0x7b>
+  801a69:	83 ec 04             	sub    $0x4,%esp
+  801a6c:	ff 75 10             	push   0x10(%ebp)
+  801a6f:	ff 75 0c             	push   0xc(%ebp)
+  801a72:	56                   	push   %esi
+  801a73:	ff d0                	call   *%eax
+  801a75:	83 c4 10             	add    $0x10,%esp
+  801a78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a7b:	5b                   	pop    %ebx
+  801a7c:	5e                   	pop    %esi
+  801a7d:	5d                   	pop    %ebp
+  801a7e:	c3                   	ret
+  801a7f:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a84:	8b 40 48             	mov    0x48(%eax),%eax
+  801a87:	83 ec 04             	sub    $0x4,%esp
+  801a8a:	53                   	push   %ebx
+  801a8b:	50                   	push   %eax
+  801a8c:	68 2d 37 80 00       	push   $0x80372d
+  801a91:	e8 73 e7 ff ff       	call   800209 <cprintf>
+  801a96:	83 c4 10             	add    $0x10,%esp
+  801a99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a9e:	eb d8                	jmp    801a78 <write+0x53>
+  801aa0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aa5:	eb d1                	jmp    801a78 <write+0x53>
+
+00801aa7 <seek>:
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	83 ec 20             	sub    $0x20,%esp
+  801aad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab0:	50                   	push   %eax
+  801ab1:	ff 75 08             	push   0x8(%ebp)
+  801ab4:	e8 2f fc ff ff       	call   8016e8 <fd_lookup>
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 0e                	js     801ace <seek+0x27>
+  801ac0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac6:	89 50 04             	mov    %edx,0x4(%eax)
+  801ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ace:	c9                   	leave
+  801acf:	c3                   	ret
+
+00801ad0 <ftruncate>:
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	56                   	push   %esi
+  801ad4:	53                   	push   %ebx
+  801ad5:	83 ec 18             	sub    $0x18,%esp
+  801ad8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801adb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ade:	50                   	push   %eax
+  801adf:	53                   	push   %ebx
+  801ae0:	e8 03 fc ff ff       	call   8016e8 <fd_lookup>
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 34                	js     801b20 <ftruncate+0x50>
+  801aec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aef:	83 ec 08             	sub    $0x8,%esp
+  801af2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af5:	50                   	push   %eax
+  801af6:	ff 36                	push   (%esi)
+  801af8:	e8 3b fc ff ff       	call   801738 <dev_lookup>
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	78 1c                	js     801b20 <ftruncate+0x50>
+  801b04:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b08:	74 1d                	je     801b27 <ftruncate+0x57>
+  801b0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b0d:	8b 40 18             	mov    0x18(%eax),%eax
+  801b10:	85 c0                	test   %eax,%eax
+  801b12:	74 34                	je     801b48 <ftruncate+0x78>
+  801b14:	83 ec 08             	sub    $0x8,%esp
+  801b17:	ff 75 0c             	push   0xc(%ebp)
+  801b1a:	56                   	push   %esi
+  801b1b:	ff d0                	call   *%eax
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b23:	5b                   	pop    %ebx
+  801b24:	5e                   	pop    %esi
+  801b25:	5d                   	pop    %ebp
+  801b26:	c3                   	ret
+  801b27:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b2c:	8b 40 48             	mov    0x48(%eax),%eax
+  801b2f:	83 ec 04             	sub    $0x4,%esp
+  801b32:	53                   	push   %ebx
+  801b33:	50                   	push   %eax
+  801b34:	68 f0 36 80 00       	push   $0x8036f0
+  801b39:	e8 cb e6 ff ff       	call   800209 <cprintf>
+  801b3e:	83 c4 10             	add    $0x10,%esp
+  801b41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b46:	eb d8                	jmp    801b20 <ftruncate+0x50>
+  801b48:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b4d:	eb d1                	jmp    801b20 <ftruncate+0x50>
+
+00801b4f <fstat>:
+  801b4f:	55                   	push   %ebp
+  801b50:	89 e5                	mov    %esp,%ebp
+  801b52:	56                   	push   %esi
+  801b53:	53                   	push   %ebx
+  801b54:	83 ec 18             	sub    $0x18,%esp
+  801b57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b5a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b5d:	50                   	push   %eax
+  801b5e:	ff 75 08             	push   0x8(%ebp)
+  801b61:	e8 82 fb ff ff       	call   8016e8 <fd_lookup>
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	85 c0                	test   %eax,%eax
+  801b6b:	78 49                	js     801bb6 <fstat+0x67>
+  801b6d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b70:	83 ec 08             	sub    $0x8,%esp
+  801b73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b76:	50                   	push   %eax
+  801b77:	ff 36                	push   (%esi)
+  801b79:	e8 ba fb ff ff       	call   801738 <dev_lookup>
+  801b7e:	83 c4 10             	add    $0x10,%esp
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	78 31                	js     801bb6 <fstat+0x67>
+  801b85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b88:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b8c:	74 2f                	je     801bbd <fstat+0x6e>
+  801b8e:	c6 03 00             	movb   $0x0,(%ebx)
+  801b91:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b98:	00 00 00 
+  801b9b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ba2:	00 00 00 
+  801ba5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801bab:	83 ec 08             	sub    $0x8,%esp
+  801bae:	53                   	push   %ebx
+  801baf:	56                   	push   %esi
+  801bb0:	ff 50 14             	call   *0x14(%eax)
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb9:	5b                   	pop    %ebx
+  801bba:	5e                   	pop    %esi
+  801bbb:	5d                   	pop    %ebp
+  801bbc:	c3                   	ret
+  801bbd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bc2:	eb f2                	jmp    801bb6 <fstat+0x67>
+
+00801bc4 <stat>:
+  801bc4:	55                   	push   %ebp
+  801bc5:	89 e5                	mov    %esp,%ebp
+  801bc7:	56                   	push   %esi
+  801bc8:	53                   	push   %ebx
+  801bc9:	83 ec 08             	sub    $0x8,%esp
+  801bcc:	6a 00                	push   $0x0
+  801bce:	ff 75 08             	push   0x8(%ebp)
+  801bd1:	e8 31 05 00 00       	call   802107 <open>
+  801bd6:	89 c3                	mov    %eax,%ebx
+  801bd8:	83 c4 10             	add    $0x10,%esp
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	78 1b                	js     801bfa <stat+0x36>
+  801bdf:	83 ec 08             	sub    $0x8,%esp
+  801be2:	ff 75 0c             	push   0xc(%ebp)
+  801be5:	50                   	push   %eax
+  801be6:	e8 64 ff ff ff       	call   801b4f <fstat>
+  801beb:	89 c6                	mov    %eax,%esi
+  801bed:	89 1c 24             	mov    %ebx,(%esp)
+  801bf0:	e8 19 fc ff ff       	call   80180e <close>
+  801bf5:	83 c4 10             	add    $0x10,%esp
+  801bf8:	89 f3                	mov    %esi,%ebx
+  801bfa:	89 d8                	mov    %ebx,%eax
+  801bfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bff:	5b                   	pop    %ebx
+  801c00:	5e                   	pop    %esi
+  801c01:	5d                   	pop    %ebp
+  801c02:	c3                   	ret
+
+00801c03 <fsipc>:
+  801c03:	55                   	push   %ebp
+  801c04:	89 e5                	mov    %esp,%ebp
+  801c06:	56                   	push   %esi
+  801c07:	53                   	push   %ebx
+  801c08:	89 c3                	mov    %eax,%ebx
+  801c0a:	89 d6                	mov    %edx,%esi
+  801c0c:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c13:	74 20                	je     801c35 <fsipc+0x32>
+  801c15:	83 ec 08             	sub    $0x8,%esp
+  801c18:	6a 00                	push   $0x0
+  801c1a:	56                   	push   %esi
+  801c1b:	6a 07                	push   $0x7
+  801c1d:	68 00 60 80 00       	push   $0x806000
+  801c22:	53                   	push   %ebx
+  801c23:	ff 35 08 50 80 00    	push   0x805008
+  801c29:	e8 5a 12 00 00       	call   802e88 <ipc_call>
+  801c2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c31:	5b                   	pop    %ebx
+  801c32:	5e                   	pop    %esi
+  801c33:	5d                   	pop    %ebp
+  801c34:	c3                   	ret
+  801c35:	83 ec 0c             	sub    $0xc,%esp
+  801c38:	6a 02                	push   $0x2
+  801c3a:	e8 e4 13 00 00       	call   803023 <ipc_find_env>
+  801c3f:	a3 08 50 80 00       	mov    %eax,0x805008
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	eb cc                	jmp    801c15 <fsipc+0x12>
+
+00801c49 <devfile_trunc>:
+  801c49:	55                   	push   %ebp
+  801c4a:	89 e5                	mov    %esp,%ebp
+  801c4c:	83 ec 08             	sub    $0x8,%esp
+  801c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c52:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c55:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c5d:	a3 04 60 80 00       	mov    %eax,0x806004
+  801c62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c67:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c6c:	e8 92 ff ff ff       	call   801c03 <fsipc>
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+
+00801c73 <devfile_flush>:
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	83 ec 08             	sub    $0x8,%esp
+  801c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c89:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c8e:	e8 70 ff ff ff       	call   801c03 <fsipc>
+  801c93:	c9                   	leave
+  801c94:	c3                   	ret
+
+00801c95 <devfile_stat>:
+  801c95:	55                   	push   %ebp
+  801c96:	89 e5                	mov    %esp,%ebp
+  801c98:	53                   	push   %ebx
+  801c99:	83 ec 04             	sub    $0x4,%esp
+  801c9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ca5:	a3 00 60 80 00       	mov    %eax,0x806000
+  801caa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801caf:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cb4:	e8 4a ff ff ff       	call   801c03 <fsipc>
+  801cb9:	85 c0                	test   %eax,%eax
+  801cbb:	78 2c                	js     801ce9 <devfile_stat+0x54>
+  801cbd:	83 ec 08             	sub    $0x8,%esp
+  801cc0:	68 00 60 80 00       	push   $0x806000
+  801cc5:	53                   	push   %ebx
+  801cc6:	e8 35 ec ff ff       	call   800900 <strcpy>
+  801ccb:	a1 80 60 80 00       	mov    0x806080,%eax
+  801cd0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801cd6:	a1 84 60 80 00       	mov    0x806084,%eax
+  801cdb:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801ce1:	83 c4 10             	add    $0x10,%esp
+  801ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cec:	c9                   	leave
+  801ced:	c3                   	ret
+
+00801cee <fsring_rw>:
+  801cee:	55                   	push   %ebp
+  801cef:	89 e5                	mov    %esp,%ebp
+  801cf1:	57                   	push   %edi
+  801cf2:	56                   	push   %esi
+  801cf3:	53                   	push   %ebx
+  801cf4:	83 ec 2c             	sub    $0x2c,%esp
+  801cf7:	89 c7                	mov    %eax,%edi
+  801cf9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cfc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801cff:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d04:	a8 01                	test   $0x1,%al
+  801d06:	74 0d                	je     801d15 <fsring_rw+0x27>
+  801d08:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d0d:	a8 01                	test   $0x1,%al
+  801d0f:	0f 85 d5 00 00 00    	jne    801dea <fsring_rw+0xfc>
+  801d15:	a1 10 50 80 00       	mov    0x805010,%eax
+  801d1a:	8b 40 48             	mov    0x48(%eax),%eax
+  801d1d:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801d23:	0f 84 fc 00 00 00    	je     801e25 <fsring_rw+0x137>
+  801d29:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801d30:	0f 84 02 01 00 00    	je     801e38 <fsring_rw+0x14a>
+  801d36:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d3b:	83 ec 04             	sub    $0x4,%esp
+  801d3e:	68 07 02 00 00       	push   $0x207
+  801d43:	53                   	push   %ebx
+  801d44:	6a 00                	push   $0x0
+  801d46:	e8 15 f0 ff ff       	call   800d60 <sys_page_alloc>
+  801d4b:	83 c4 10             	add    $0x10,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	0f 88 f9 00 00 00    	js     801e4f <fsring_rw+0x161>
+  801d56:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d5c:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d62:	75 d7                	jne    801d3b <fsring_rw+0x4d>
+  801d64:	6a 0e                	push   $0xe
+  801d66:	6a 0d                	push   $0xd
+  801d68:	ff 35 08 50 80 00    	push   0x805008
+  801d6e:	68 00 00 f0 cf       	push   $0xcff00000
+  801d73:	e8 c4 0c 00 00       	call   802a3c <ipcring_init>
+  801d78:	83 c4 08             	add    $0x8,%esp
+  801d7b:	6a 00                	push   $0x0
+  801d7d:	6a 00                	push   $0x0
+  801d7f:	68 07 02 00 00       	push   $0x207
+  801d84:	68 00 00 f0 cf       	push   $0xcff00000
+  801d89:	6a 0b                	push   $0xb
+  801d8b:	ff 35 08 50 80 00    	push   0x805008
+  801d91:	e8 f2 10 00 00       	call   802e88 <ipc_call>
+  801d96:	89 c6                	mov    %eax,%esi
+  801d98:	83 c4 20             	add    $0x20,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	0f 88 ac 00 00 00    	js     801e4f <fsring_rw+0x161>
+  801da3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da8:	89 d9                	mov    %ebx,%ecx
+  801daa:	83 c3 01             	add    $0x1,%ebx
+  801dad:	89 da                	mov    %ebx,%edx
+  801daf:	c1 e2 0c             	shl    $0xc,%edx
+  801db2:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801db8:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801dbe:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801dc4:	83 ec 08             	sub    $0x8,%esp
+  801dc7:	6a 00                	push   $0x0
+  801dc9:	6a 00                	push   $0x0
+  801dcb:	68 07 02 00 00       	push   $0x207
+  801dd0:	50                   	push   %eax
+  801dd1:	6a 0c                	push   $0xc
+  801dd3:	ff 35 08 50 80 00    	push   0x805008
+  801dd9:	e8 aa 10 00 00       	call   802e88 <ipc_call>
+  801dde:	83 c4 20             	add    $0x20,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 6a                	js     801e4f <fsring_rw+0x161>
+  801de5:	83 fb 08             	cmp    $0x8,%ebx
+  801de8:	75 be                	jne    801da8 <fsring_rw+0xba>
+  801dea:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801dee:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801df3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801df8:	0f 45 c2             	cmovne %edx,%eax
+  801dfb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801dfe:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e05:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e0c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e18:	be 00 00 00 00       	mov    $0x0,%esi
+  801e1d:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801e20:	e9 4b 01 00 00       	jmp    801f70 <fsring_rw+0x282>
+  801e25:	e8 00 f3 ff ff       	call   80112a <sys_time_msec>
+  801e2a:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801e30:	0f 89 f3 fe ff ff    	jns    801d29 <fsring_rw+0x3b>
+  801e36:	eb 54                	jmp    801e8c <fsring_rw+0x19e>
+  801e38:	83 ec 0c             	sub    $0xc,%esp
+  801e3b:	6a 02                	push   $0x2
+  801e3d:	e8 e1 11 00 00       	call   803023 <ipc_find_env>
+  801e42:	a3 08 50 80 00       	mov    %eax,0x805008
+  801e47:	83 c4 10             	add    $0x10,%esp
+  801e4a:	e9 e7 fe ff ff       	jmp    801d36 <fsring_rw+0x48>
+  801e4f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e54:	83 ec 08             	sub    $0x8,%esp
+  801e57:	53                   	push   %ebx
+  801e58:	6a 00                	push   $0x0
+  801e5a:	e8 d3 ef ff ff       	call   800e32 <sys_page_unmap>
+  801e5f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e65:	83 c4 10             	add    $0x10,%esp
+  801e68:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e6e:	75 e4                	jne    801e54 <fsring_rw+0x166>
+  801e70:	e8 b5 f2 ff ff       	call   80112a <sys_time_msec>
+  801e75:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801e7a:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e7f:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e84:	8b 40 48             	mov    0x48(%eax),%eax
+  801e87:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e8c:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801e93:	e9 7a 01 00 00       	jmp    802012 <fsring_rw+0x324>
+  801e98:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e9b:	89 10                	mov    %edx,(%eax)
+  801e9d:	89 58 04             	mov    %ebx,0x4(%eax)
+  801ea0:	89 f2                	mov    %esi,%edx
+  801ea2:	03 57 04             	add    0x4(%edi),%edx
+  801ea5:	89 50 08             	mov    %edx,0x8(%eax)
+  801ea8:	83 ec 04             	sub    $0x4,%esp
+  801eab:	53                   	push   %ebx
+  801eac:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801eaf:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801eb2:	52                   	push   %edx
+  801eb3:	83 c0 0c             	add    $0xc,%eax
+  801eb6:	50                   	push   %eax
+  801eb7:	e8 f4 eb ff ff       	call   800ab0 <memmove>
+  801ebc:	83 c4 10             	add    $0x10,%esp
+  801ebf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ec2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ec5:	89 08                	mov    %ecx,(%eax)
+  801ec7:	83 ec 0c             	sub    $0xc,%esp
+  801eca:	68 00 00 f0 cf       	push   $0xcff00000
+  801ecf:	e8 c6 0b 00 00       	call   802a9a <ipcring_req_push>
+  801ed4:	01 de                	add    %ebx,%esi
+  801ed6:	83 c4 10             	add    $0x10,%esp
+  801ed9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801edc:	73 4c                	jae    801f2a <fsring_rw+0x23c>
+  801ede:	83 ec 0c             	sub    $0xc,%esp
+  801ee1:	68 00 00 f0 cf       	push   $0xcff00000
+  801ee6:	e8 89 0b 00 00       	call   802a74 <ipcring_req_slot>
+  801eeb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801eee:	83 c4 10             	add    $0x10,%esp
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	74 35                	je     801f2a <fsring_rw+0x23c>
+  801ef5:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801efa:	83 e0 07             	and    $0x7,%eax
+  801efd:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f02:	c1 e0 0c             	shl    $0xc,%eax
+  801f05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f08:	29 f3                	sub    %esi,%ebx
+  801f0a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f0d:	39 cb                	cmp    %ecx,%ebx
+  801f0f:	0f 47 d9             	cmova  %ecx,%ebx
+  801f12:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f16:	75 80                	jne    801e98 <fsring_rw+0x1aa>
+  801f18:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f1b:	89 10                	mov    %edx,(%eax)
+  801f1d:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f20:	89 f2                	mov    %esi,%edx
+  801f22:	03 57 04             	add    0x4(%edi),%edx
+  801f25:	89 50 08             	mov    %edx,0x8(%eax)
+  801f28:	eb 95                	jmp    801ebf <fsring_rw+0x1d1>
+  801f2a:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f32:	83 ec 0c             	sub    $0xc,%esp
+  801f35:	68 00 00 f0 cf       	push   $0xcff00000
+  801f3a:	e8 94 0b 00 00       	call   802ad3 <ipcring_rsp_wait>
+  801f3f:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f49:	75 45                	jne    801f90 <fsring_rw+0x2a2>
+  801f4b:	85 db                	test   %ebx,%ebx
+  801f4d:	79 41                	jns    801f90 <fsring_rw+0x2a2>
+  801f4f:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801f52:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801f59:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801f60:	83 ec 0c             	sub    $0xc,%esp
+  801f63:	68 00 00 f0 cf       	push   $0xcff00000
+  801f68:	e8 cc 0b 00 00       	call   802b39 <ipcring_rsp_pop>
+  801f6d:	83 c4 10             	add    $0x10,%esp
+  801f70:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801f76:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f7b:	39 c2                	cmp    %eax,%edx
+  801f7d:	74 75                	je     801ff4 <fsring_rw+0x306>
+  801f7f:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f83:	75 a5                	jne    801f2a <fsring_rw+0x23c>
+  801f85:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f88:	0f 82 50 ff ff ff    	jb     801ede <fsring_rw+0x1f0>
+  801f8e:	eb 9a                	jmp    801f2a <fsring_rw+0x23c>
+  801f90:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f94:	75 ca                	jne    801f60 <fsring_rw+0x272>
+  801f96:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f9a:	74 31                	je     801fcd <fsring_rw+0x2df>
+  801f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fa2:	29 c8                	sub    %ecx,%eax
+  801fa4:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801fa7:	39 d0                	cmp    %edx,%eax
+  801fa9:	0f 47 c2             	cmova  %edx,%eax
+  801fac:	39 d8                	cmp    %ebx,%eax
+  801fae:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fb3:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801fb7:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbf:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801fc3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801fc6:	01 d9                	add    %ebx,%ecx
+  801fc8:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801fcb:	eb 93                	jmp    801f60 <fsring_rw+0x272>
+  801fcd:	83 ec 04             	sub    $0x4,%esp
+  801fd0:	53                   	push   %ebx
+  801fd1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fd4:	83 e0 07             	and    $0x7,%eax
+  801fd7:	c1 e0 0c             	shl    $0xc,%eax
+  801fda:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801fe0:	50                   	push   %eax
+  801fe1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801fe4:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fe7:	01 c8                	add    %ecx,%eax
+  801fe9:	50                   	push   %eax
+  801fea:	e8 c1 ea ff ff       	call   800ab0 <memmove>
+  801fef:	83 c4 10             	add    $0x10,%esp
+  801ff2:	eb a8                	jmp    801f9c <fsring_rw+0x2ae>
+  801ff4:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801ff8:	75 09                	jne    802003 <fsring_rw+0x315>
+  801ffa:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801ffd:	0f 82 db fe ff ff    	jb     801ede <fsring_rw+0x1f0>
+  802003:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802006:	01 57 04             	add    %edx,0x4(%edi)
+  802009:	85 d2                	test   %edx,%edx
+  80200b:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80200f:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802012:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802018:	5b                   	pop    %ebx
+  802019:	5e                   	pop    %esi
+  80201a:	5f                   	pop    %edi
+  80201b:	5d                   	pop    %ebp
+  80201c:	c3                   	ret
+
+0080201d <devfile_write>:
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	57                   	push   %edi
+  802021:	56                   	push   %esi
+  802022:	53                   	push   %ebx
+  802023:	83 ec 0c             	sub    $0xc,%esp
+  802026:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802029:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80202c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80202f:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802035:	76 1a                	jbe    802051 <devfile_write+0x34>
+  802037:	83 ec 0c             	sub    $0xc,%esp
+  80203a:	53                   	push   %ebx
+  80203b:	89 f1                	mov    %esi,%ecx
+  80203d:	ba 06 00 00 00       	mov    $0x6,%edx
+  802042:	89 f8                	mov    %edi,%eax
+  802044:	e8 a5 fc ff ff       	call   801cee <fsring_rw>
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80204f:	75 39                	jne    80208a <devfile_write+0x6d>
+  802051:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802056:	39 c3                	cmp    %eax,%ebx
+  802058:	0f 47 d8             	cmova  %eax,%ebx
+  80205b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80205e:	a3 00 60 80 00       	mov    %eax,0x806000
+  802063:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802069:	83 ec 04             	sub    $0x4,%esp
+  80206c:	53                   	push   %ebx
+  80206d:	56                   	push   %esi
+  80206e:	68 08 60 80 00       	push   $0x806008
+  802073:	e8 38 ea ff ff       	call   800ab0 <memmove>
+  802078:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802082:	e8 7c fb ff ff       	call   801c03 <fsipc>
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80208d:	5b                   	pop    %ebx
+  80208e:	5e                   	pop    %esi
+  80208f:	5f                   	pop    %edi
+  802090:	5d                   	pop    %ebp
+  802091:	c3                   	ret
+
+00802092 <devfile_read>:
+  802092:	55                   	push   %ebp
+  802093:	89 e5                	mov    %esp,%ebp
+  802095:	57                   	push   %edi
+  802096:	56                   	push   %esi
+  802097:	53                   	push   %ebx
+  802098:	83 ec 0c             	sub    $0xc,%esp
+  80209b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80209e:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020a1:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8020a7:	76 1d                	jbe    8020c6 <devfile_read+0x34>
+  8020a9:	83 ec 0c             	sub    $0xc,%esp
+  8020ac:	56                   	push   %esi
+  8020ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020b0:	ba 05 00 00 00       	mov    $0x5,%edx
+  8020b5:	89 f8                	mov    %edi,%eax
+  8020b7:	e8 32 fc ff ff       	call   801cee <fsring_rw>
+  8020bc:	89 c3                	mov    %eax,%ebx
+  8020be:	83 c4 10             	add    $0x10,%esp
+  8020c1:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020c4:	75 37                	jne    8020fd <devfile_read+0x6b>
+  8020c6:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020c9:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020ce:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8020d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020de:	e8 20 fb ff ff       	call   801c03 <fsipc>
+  8020e3:	89 c3                	mov    %eax,%ebx
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	78 14                	js     8020fd <devfile_read+0x6b>
+  8020e9:	83 ec 04             	sub    $0x4,%esp
+  8020ec:	50                   	push   %eax
+  8020ed:	68 00 60 80 00       	push   $0x806000
+  8020f2:	ff 75 0c             	push   0xc(%ebp)
+  8020f5:	e8 b6 e9 ff ff       	call   800ab0 <memmove>
+  8020fa:	83 c4 10             	add    $0x10,%esp
+  8020fd:	89 d8                	mov    %ebx,%eax
+  8020ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802102:	5b                   	pop    %ebx
+  802103:	5e                   	pop    %esi
+  802104:	5f                   	pop    %edi
+  802105:	5d                   	pop    %ebp
+  802106:	c3                   	ret
+
+00802107 <open>:
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	56                   	push   %esi
+  80210b:	53                   	push   %ebx
+  80210c:	83 ec 1c             	sub    $0x1c,%esp
+  80210f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802112:	56                   	push   %esi
+  802113:	e8 9c e7 ff ff       	call   8008b4 <strlen>
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802120:	7f 6c                	jg     80218e <open+0x87>
+  802122:	83 ec 0c             	sub    $0xc,%esp
+  802125:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802128:	50                   	push   %eax
+  802129:	e8 6a f5 ff ff       	call   801698 <fd_alloc>
+  80212e:	89 c3                	mov    %eax,%ebx
+  802130:	83 c4 10             	add    $0x10,%esp
+  802133:	85 c0                	test   %eax,%eax
+  802135:	78 3c                	js     802173 <open+0x6c>
+  802137:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80213a:	a3 00 64 80 00       	mov    %eax,0x806400
+  80213f:	83 ec 08             	sub    $0x8,%esp
+  802142:	56                   	push   %esi
+  802143:	68 00 60 80 00       	push   $0x806000
+  802148:	e8 b3 e7 ff ff       	call   800900 <strcpy>
+  80214d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802150:	b8 01 00 00 00       	mov    $0x1,%eax
+  802155:	e8 a9 fa ff ff       	call   801c03 <fsipc>
+  80215a:	89 c3                	mov    %eax,%ebx
+  80215c:	83 c4 10             	add    $0x10,%esp
+  80215f:	85 c0                	test   %eax,%eax
+  802161:	78 19                	js     80217c <open+0x75>
+  802163:	83 ec 0c             	sub    $0xc,%esp
+  802166:	ff 75 f4             	push   -0xc(%ebp)
+  802169:	e8 03 f5 ff ff       	call   801671 <fd2num>
+  80216e:	89 c3                	mov    %eax,%ebx
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	89 d8                	mov    %ebx,%eax
+  802175:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802178:	5b                   	pop    %ebx
+  802179:	5e                   	pop    %esi
+  80217a:	5d                   	pop    %ebp
+  80217b:	c3                   	ret
+  80217c:	83 ec 08             	sub    $0x8,%esp
+  80217f:	6a 00                	push   $0x0
+  802181:	ff 75 f4             	push   -0xc(%ebp)
+  802184:	e8 05 f6 ff ff       	call   80178e <fd_close>
+  802189:	83 c4 10             	add    $0x10,%esp
+  80218c:	eb e5                	jmp    802173 <open+0x6c>
+  80218e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802193:	eb de                	jmp    802173 <open+0x6c>
+
+00802195 <file_image>:
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	53                   	push   %ebx
+  802199:	83 ec 1c             	sub    $0x1c,%esp
+  80219c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80219f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a2:	50                   	push   %eax
+  8021a3:	ff 75 08             	push   0x8(%ebp)
+  8021a6:	e8 3d f5 ff ff       	call   8016e8 <fd_lookup>
+  8021ab:	83 c4 10             	add    $0x10,%esp
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	78 58                	js     80220a <file_image+0x75>
+  8021b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b5:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021bb:	39 08                	cmp    %ecx,(%eax)
+  8021bd:	75 50                	jne    80220f <file_image+0x7a>
+  8021bf:	83 fb 04             	cmp    $0x4,%ebx
+  8021c2:	77 52                	ja     802216 <file_image+0x81>
+  8021c4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021c7:	a3 00 60 80 00       	mov    %eax,0x806000
+  8021cc:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8021d2:	83 ec 04             	sub    $0x4,%esp
+  8021d5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8021d8:	c1 e0 02             	shl    $0x2,%eax
+  8021db:	50                   	push   %eax
+  8021dc:	ff 75 0c             	push   0xc(%ebp)
+  8021df:	68 08 60 80 00       	push   $0x806008
+  8021e4:	e8 c7 e8 ff ff       	call   800ab0 <memmove>
+  8021e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ee:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8021f3:	e8 0b fa ff ff       	call   801c03 <fsipc>
+  8021f8:	83 c4 10             	add    $0x10,%esp
+  8021fb:	85 c0                	test   %eax,%eax
+  8021fd:	78 0b                	js     80220a <file_image+0x75>
+  8021ff:	8b 55 14             	mov    0x14(%ebp),%edx
+  802202:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802208:	89 0a                	mov    %ecx,(%edx)
+  80220a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80220d:	c9                   	leave
+  80220e:	c3                   	ret
+  80220f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802214:	eb f4                	jmp    80220a <file_image+0x75>
+  802216:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80221b:	eb ed                	jmp    80220a <file_image+0x75>
+
+0080221d <remove>:
+  80221d:	55                   	push   %ebp
+  80221e:	89 e5                	mov    %esp,%ebp
+  802220:	53                   	push   %ebx
+  802221:	83 ec 10             	sub    $0x10,%esp
+  802224:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802227:	53                   	push   %ebx
+  802228:	e8 87 e6 ff ff       	call   8008b4 <strlen>
+  80222d:	83 c4 10             	add    $0x10,%esp
+  802230:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802235:	7f 25                	jg     80225c <remove+0x3f>
+  802237:	83 ec 08             	sub    $0x8,%esp
+  80223a:	53                   	push   %ebx
+  80223b:	68 00 60 80 00       	push   $0x806000
+  802240:	e8 bb e6 ff ff       	call   800900 <strcpy>
+  802245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80224f:	e8 af f9 ff ff       	call   801c03 <fsipc>
+  802254:	83 c4 10             	add    $0x10,%esp
+  802257:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225a:	c9                   	leave
+  80225b:	c3                   	ret
+  80225c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802261:	eb f4                	jmp    802257 <remove+0x3a>
+
+00802263 <sync>:
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+  802266:	83 ec 08             	sub    $0x8,%esp
+  802269:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802273:	e8 8b f9 ff ff       	call   801c03 <fsipc>
+  802278:	c9                   	leave
+  802279:	c3                   	ret
+
+0080227a <devsock_stat>:
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	83 ec 10             	sub    $0x10,%esp
+  802280:	68 60 37 80 00       	push   $0x803760
+  802285:	ff 75 0c             	push   0xc(%ebp)
+  802288:	e8 73 e6 ff ff       	call   800900 <strcpy>
+  80228d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802292:	c9                   	leave
+  802293:	c3                   	ret
+
+00802294 <devsock_close>:
+  802294:	55                   	push   %ebp
+  802295:	89 e5                	mov    %esp,%ebp
+  802297:	53                   	push   %ebx
+  802298:	83 ec 10             	sub    $0x10,%esp
+  80229b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80229e:	53                   	push   %ebx
+  80229f:	e8 99 0d 00 00       	call   80303d <pageref>
+  8022a4:	89 c2                	mov    %eax,%edx
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ae:	83 fa 01             	cmp    $0x1,%edx
+  8022b1:	74 05                	je     8022b8 <devsock_close+0x24>
+  8022b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b6:	c9                   	leave
+  8022b7:	c3                   	ret
+  8022b8:	83 ec 0c             	sub    $0xc,%esp
+  8022bb:	ff 73 0c             	push   0xc(%ebx)
+  8022be:	e8 aa 02 00 00       	call   80256d <nsipc_close>
+  8022c3:	83 c4 10             	add    $0x10,%esp
+  8022c6:	eb eb                	jmp    8022b3 <devsock_close+0x1f>
+
+008022c8 <devsock_write>:
+  8022c8:	55                   	push   %ebp
+  8022c9:	89 e5                	mov    %esp,%ebp
+  8022cb:	83 ec 08             	sub    $0x8,%esp
+  8022ce:	6a 00                	push   $0x0
+  8022d0:	ff 75 10             	push   0x10(%ebp)
+  8022d3:	ff 75 0c             	push   0xc(%ebp)
+  8022d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d9:	ff 70 0c             	push   0xc(%eax)
+  8022dc:	e8 6c 03 00 00       	call   80264d <nsipc_send>
+  8022e1:	c9                   	leave
+  8022e2:	c3                   	ret
+
+008022e3 <devsock_read>:
+  8022e3:	55                   	push   %ebp
+  8022e4:	89 e5                	mov    %esp,%ebp
+  8022e6:	83 ec 08             	sub    $0x8,%esp
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	ff 75 10             	push   0x10(%ebp)
+  8022ee:	ff 75 0c             	push   0xc(%ebp)
+  8022f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f4:	ff 70 0c             	push   0xc(%eax)
+  8022f7:	e8 e2 02 00 00       	call   8025de <nsipc_recv>
+  8022fc:	c9                   	leave
+  8022fd:	c3                   	ret
+
+008022fe <fd2sockid>:
+  8022fe:	55                   	push   %ebp
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	83 ec 20             	sub    $0x20,%esp
+  802304:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802307:	52                   	push   %edx
+  802308:	50                   	push   %eax
+  802309:	e8 da f3 ff ff       	call   8016e8 <fd_lookup>
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	85 c0                	test   %eax,%eax
+  802313:	78 10                	js     802325 <fd2sockid+0x27>
+  802315:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802318:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80231e:	39 08                	cmp    %ecx,(%eax)
+  802320:	75 05                	jne    802327 <fd2sockid+0x29>
+  802322:	8b 40 0c             	mov    0xc(%eax),%eax
+  802325:	c9                   	leave
+  802326:	c3                   	ret
+  802327:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80232c:	eb f7                	jmp    802325 <fd2sockid+0x27>
+
+0080232e <alloc_sockfd>:
+  80232e:	55                   	push   %ebp
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	56                   	push   %esi
+  802332:	53                   	push   %ebx
+  802333:	83 ec 1c             	sub    $0x1c,%esp
+  802336:	89 c6                	mov    %eax,%esi
+  802338:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80233b:	50                   	push   %eax
+  80233c:	e8 57 f3 ff ff       	call   801698 <fd_alloc>
+  802341:	89 c3                	mov    %eax,%ebx
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	85 c0                	test   %eax,%eax
+  802348:	78 43                	js     80238d <alloc_sockfd+0x5f>
+  80234a:	83 ec 04             	sub    $0x4,%esp
+  80234d:	68 07 04 00 00       	push   $0x407
+  802352:	ff 75 f4             	push   -0xc(%ebp)
+  802355:	6a 00                	push   $0x0
+  802357:	e8 04 ea ff ff       	call   800d60 <sys_page_alloc>
+  80235c:	89 c3                	mov    %eax,%ebx
+  80235e:	83 c4 10             	add    $0x10,%esp
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 28                	js     80238d <alloc_sockfd+0x5f>
+  802365:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802368:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80236e:	89 10                	mov    %edx,(%eax)
+  802370:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802373:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80237a:	89 70 0c             	mov    %esi,0xc(%eax)
+  80237d:	83 ec 0c             	sub    $0xc,%esp
+  802380:	50                   	push   %eax
+  802381:	e8 eb f2 ff ff       	call   801671 <fd2num>
+  802386:	89 c3                	mov    %eax,%ebx
+  802388:	83 c4 10             	add    $0x10,%esp
+  80238b:	eb 0c                	jmp    802399 <alloc_sockfd+0x6b>
+  80238d:	83 ec 0c             	sub    $0xc,%esp
+  802390:	56                   	push   %esi
+  802391:	e8 d7 01 00 00       	call   80256d <nsipc_close>
+  802396:	83 c4 10             	add    $0x10,%esp
+  802399:	89 d8                	mov    %ebx,%eax
+  80239b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80239e:	5b                   	pop    %ebx
+  80239f:	5e                   	pop    %esi
+  8023a0:	5d                   	pop    %ebp
+  8023a1:	c3                   	ret
+
+008023a2 <accept>:
+  8023a2:	55                   	push   %ebp
+  8023a3:	89 e5                	mov    %esp,%ebp
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+  8023a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ab:	e8 4e ff ff ff       	call   8022fe <fd2sockid>
+  8023b0:	85 c0                	test   %eax,%eax
+  8023b2:	78 1b                	js     8023cf <accept+0x2d>
+  8023b4:	83 ec 04             	sub    $0x4,%esp
+  8023b7:	ff 75 10             	push   0x10(%ebp)
+  8023ba:	ff 75 0c             	push   0xc(%ebp)
+  8023bd:	50                   	push   %eax
+  8023be:	e8 07 01 00 00       	call   8024ca <nsipc_accept>
+  8023c3:	83 c4 10             	add    $0x10,%esp
+  8023c6:	85 c0                	test   %eax,%eax
+  8023c8:	78 05                	js     8023cf <accept+0x2d>
+  8023ca:	e8 5f ff ff ff       	call   80232e <alloc_sockfd>
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+
+008023d1 <bind>:
+  8023d1:	55                   	push   %ebp
+  8023d2:	89 e5                	mov    %esp,%ebp
+  8023d4:	83 ec 08             	sub    $0x8,%esp
+  8023d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023da:	e8 1f ff ff ff       	call   8022fe <fd2sockid>
+  8023df:	85 c0                	test   %eax,%eax
+  8023e1:	78 12                	js     8023f5 <bind+0x24>
+  8023e3:	83 ec 04             	sub    $0x4,%esp
+  8023e6:	ff 75 10             	push   0x10(%ebp)
+  8023e9:	ff 75 0c             	push   0xc(%ebp)
+  8023ec:	50                   	push   %eax
+  8023ed:	e8 24 01 00 00       	call   802516 <nsipc_bind>
+  8023f2:	83 c4 10             	add    $0x10,%esp
+  8023f5:	c9                   	leave
+  8023f6:	c3                   	ret
+
+008023f7 <shutdown>:
+  8023f7:	55                   	push   %ebp
+  8023f8:	89 e5                	mov    %esp,%ebp
+  8023fa:	83 ec 08             	sub    $0x8,%esp
+  8023fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802400:	e8 f9 fe ff ff       	call   8022fe <fd2sockid>
+  802405:	85 c0                	test   %eax,%eax
+  802407:	78 0f                	js     802418 <shutdown+0x21>
+  802409:	83 ec 08             	sub    $0x8,%esp
+  80240c:	ff 75 0c             	push   0xc(%ebp)
+  80240f:	50                   	push   %eax
+  802410:	e8 36 01 00 00       	call   80254b <nsipc_shutdown>
+  802415:	83 c4 10             	add    $0x10,%esp
+  802418:	c9                   	leave
+  802419:	c3                   	ret
+
+0080241a <connect>:
+  80241a:	55                   	push   %ebp
+  80241b:	89 e5                	mov    %esp,%ebp
+  80241d:	83 ec 08             	sub    $0x8,%esp
+  802420:	8b 45 08             	mov    0x8(%ebp),%eax
+  802423:	e8 d6 fe ff ff       	call   8022fe <fd2sockid>
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	78 12                	js     80243e <connect+0x24>
+  80242c:	83 ec 04             	sub    $0x4,%esp
+  80242f:	ff 75 10             	push   0x10(%ebp)
+  802432:	ff 75 0c             	push   0xc(%ebp)
+  802435:	50                   	push   %eax
+  802436:	e8 4c 01 00 00       	call   802587 <nsipc_connect>
+  80243b:	83 c4 10             	add    $0x10,%esp
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+
+00802440 <listen>:
+  802440:	55                   	push   %ebp
+  802441:	89 e5                	mov    %esp,%ebp
+  802443:	83 ec 08             	sub    $0x8,%esp
+  802446:	8b 45 08             	mov    0x8(%ebp),%eax
+  802449:	e8 b0 fe ff ff       	call   8022fe <fd2sockid>
+  80244e:	85 c0                	test   %eax,%eax
+  802450:	78 0f                	js     802461 <listen+0x21>
+  802452:	83 ec 08             	sub    $0x8,%esp
+  802455:	ff 75 0c             	push   0xc(%ebp)
+  802458:	50                   	push   %eax
+  802459:	e8 5e 01 00 00       	call   8025bc <nsipc_listen>
+  80245e:	83 c4 10             	add    $0x10,%esp
+  802461:	c9                   	leave
+  802462:	c3                   	ret
+
+00802463 <socket>:
+  802463:	55                   	push   %ebp
+  802464:	89 e5                	mov    %esp,%ebp
+  802466:	83 ec 0c             	sub    $0xc,%esp
+  802469:	ff 75 10             	push   0x10(%ebp)
+  80246c:	ff 75 0c             	push   0xc(%ebp)
+  80246f:	ff 75 08             	push   0x8(%ebp)
+  802472:	e8 34 02 00 00       	call   8026ab <nsipc_socket>
+  802477:	83 c4 10             	add    $0x10,%esp
+  80247a:	85 c0                	test   %eax,%eax
+  80247c:	78 05                	js     802483 <socket+0x20>
+  80247e:	e8 ab fe ff ff       	call   80232e <alloc_sockfd>
+  802483:	c9                   	leave
+  802484:	c3                   	ret
+
+00802485 <nsipc>:
+  802485:	55                   	push   %ebp
+  802486:	89 e5                	mov    %esp,%ebp
+  802488:	53                   	push   %ebx
+  802489:	83 ec 04             	sub    $0x4,%esp
+  80248c:	89 c3                	mov    %eax,%ebx
+  80248e:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802495:	74 1f                	je     8024b6 <nsipc+0x31>
+  802497:	83 ec 08             	sub    $0x8,%esp
+  80249a:	6a 00                	push   $0x0
+  80249c:	6a 00                	push   $0x0
+  80249e:	6a 07                	push   $0x7
+  8024a0:	68 00 70 80 00       	push   $0x807000
+  8024a5:	53                   	push   %ebx
+  8024a6:	ff 35 0c 50 80 00    	push   0x80500c
+  8024ac:	e8 d7 09 00 00       	call   802e88 <ipc_call>
+  8024b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b4:	c9                   	leave
+  8024b5:	c3                   	ret
+  8024b6:	83 ec 0c             	sub    $0xc,%esp
+  8024b9:	6a 03                	push   $0x3
+  8024bb:	e8 63 0b 00 00       	call   803023 <ipc_find_env>
+  8024c0:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  8024c5:	83 c4 10             	add    $0x10,%esp
+  8024c8:	eb cd                	jmp    802497 <nsipc+0x12>
+
+008024ca <nsipc_accept>:
+  8024ca:	55                   	push   %ebp
+  8024cb:	89 e5                	mov    %esp,%ebp
+  8024cd:	53                   	push   %ebx
+  8024ce:	83 ec 04             	sub    $0x4,%esp
+  8024d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d4:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024de:	e8 a2 ff ff ff       	call   802485 <nsipc>
+  8024e3:	89 c3                	mov    %eax,%ebx
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	79 07                	jns    8024f0 <nsipc_accept+0x26>
+  8024e9:	89 d8                	mov    %ebx,%eax
+  8024eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+  8024f0:	83 ec 04             	sub    $0x4,%esp
+  8024f3:	ff 35 10 70 80 00    	push   0x807010
+  8024f9:	68 00 70 80 00       	push   $0x807000
+  8024fe:	ff 75 0c             	push   0xc(%ebp)
+  802501:	e8 aa e5 ff ff       	call   800ab0 <memmove>
+  802506:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  80250c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80250f:	89 10                	mov    %edx,(%eax)
+  802511:	83 c4 10             	add    $0x10,%esp
+  802514:	eb d3                	jmp    8024e9 <nsipc_accept+0x1f>
+
+00802516 <nsipc_bind>:
+  802516:	55                   	push   %ebp
+  802517:	89 e5                	mov    %esp,%ebp
+  802519:	53                   	push   %ebx
+  80251a:	83 ec 08             	sub    $0x8,%esp
+  80251d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802520:	8b 45 08             	mov    0x8(%ebp),%eax
+  802523:	a3 00 70 80 00       	mov    %eax,0x807000
+  802528:	53                   	push   %ebx
+  802529:	ff 75 0c             	push   0xc(%ebp)
+  80252c:	68 04 70 80 00       	push   $0x807004
+  802531:	e8 7a e5 ff ff       	call   800ab0 <memmove>
+  802536:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80253c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802541:	e8 3f ff ff ff       	call   802485 <nsipc>
+  802546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802549:	c9                   	leave
+  80254a:	c3                   	ret
+
+0080254b <nsipc_shutdown>:
+  80254b:	55                   	push   %ebp
+  80254c:	89 e5                	mov    %esp,%ebp
+  80254e:	83 ec 08             	sub    $0x8,%esp
+  802551:	8b 45 08             	mov    0x8(%ebp),%eax
+  802554:	a3 00 70 80 00       	mov    %eax,0x807000
+  802559:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80255c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802561:	b8 03 00 00 00       	mov    $0x3,%eax
+  802566:	e8 1a ff ff ff       	call   802485 <nsipc>
+  80256b:	c9                   	leave
+  80256c:	c3                   	ret
+
+0080256d <nsipc_close>:
+  80256d:	55                   	push   %ebp
+  80256e:	89 e5                	mov    %esp,%ebp
+  802570:	83 ec 08             	sub    $0x8,%esp
+  802573:	8b 45 08             	mov    0x8(%ebp),%eax
+  802576:	a3 00 70 80 00       	mov    %eax,0x807000
+  80257b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802580:	e8 00 ff ff ff       	call   802485 <nsipc>
+  802585:	c9                   	leave
+  802586:	c3                   	ret
+
+00802587 <nsipc_connect>:
+  802587:	55                   	push   %ebp
+  802588:	89 e5                	mov    %esp,%ebp
+  80258a:	53                   	push   %ebx
+  80258b:	83 ec 08             	sub    $0x8,%esp
+  80258e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802591:	8b 45 08             	mov    0x8(%ebp),%eax
+  802594:	a3 00 70 80 00       	mov    %eax,0x807000
+  802599:	53                   	push   %ebx
+  80259a:	ff 75 0c             	push   0xc(%ebp)
+  80259d:	68 04 70 80 00       	push   $0x807004
+  8025a2:	e8 09 e5 ff ff       	call   800ab0 <memmove>
+  8025a7:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8025ad:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025b2:	e8 ce fe ff ff       	call   802485 <nsipc>
+  8025b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ba:	c9                   	leave
+  8025bb:	c3                   	ret
+
+008025bc <nsipc_listen>:
+  8025bc:	55                   	push   %ebp
+  8025bd:	89 e5                	mov    %esp,%ebp
+  8025bf:	83 ec 08             	sub    $0x8,%esp
+  8025c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c5:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025cd:	a3 04 70 80 00       	mov    %eax,0x807004
+  8025d2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025d7:	e8 a9 fe ff ff       	call   802485 <nsipc>
+  8025dc:	c9                   	leave
+  8025dd:	c3                   	ret
+
+008025de <nsipc_recv>:
+  8025de:	55                   	push   %ebp
+  8025df:	89 e5                	mov    %esp,%ebp
+  8025e1:	56                   	push   %esi
+  8025e2:	53                   	push   %ebx
+  8025e3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8025e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025ee:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8025f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025f7:	a3 08 70 80 00       	mov    %eax,0x807008
+  8025fc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802601:	e8 7f fe ff ff       	call   802485 <nsipc>
+  802606:	89 c3                	mov    %eax,%ebx
+  802608:	85 c0                	test   %eax,%eax
+  80260a:	78 22                	js     80262e <nsipc_recv+0x50>
+  80260c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802611:	39 c6                	cmp    %eax,%esi
+  802613:	0f 4e c6             	cmovle %esi,%eax
+  802616:	39 c3                	cmp    %eax,%ebx
+  802618:	7f 1d                	jg     802637 <nsipc_recv+0x59>
+  80261a:	83 ec 04             	sub    $0x4,%esp
+  80261d:	53                   	push   %ebx
+  80261e:	68 00 70 80 00       	push   $0x807000
+  802623:	ff 75 0c             	push   0xc(%ebp)
+  802626:	e8 85 e4 ff ff       	call   800ab0 <memmove>
+  80262b:	83 c4 10             	add    $0x10,%esp
+  80262e:	89 d8                	mov    %ebx,%eax
+  802630:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802633:	5b                   	pop    %ebx
+  802634:	5e                   	pop    %esi
+  802635:	5d                   	pop    %ebp
+  802636:	c3                   	ret
+  802637:	68 6c 37 80 00       	push   $0x80376c
+  80263c:	68 81 37 80 00       	push   $0x803781
+  802641:	6a 60                	push   $0x60
+  802643:	68 96 37 80 00       	push   $0x803796
+  802648:	e8 e1 da ff ff       	call   80012e <_panic>
+
+0080264d <nsipc_send>:
+  80264d:	55                   	push   %ebp
+  80264e:	89 e5                	mov    %esp,%ebp
+  802650:	53                   	push   %ebx
+  802651:	83 ec 04             	sub    $0x4,%esp
+  802654:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802657:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80265f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802665:	7f 2e                	jg     802695 <nsipc_send+0x48>
+  802667:	83 ec 04             	sub    $0x4,%esp
+  80266a:	53                   	push   %ebx
+  80266b:	ff 75 0c             	push   0xc(%ebp)
+  80266e:	68 0c 70 80 00       	push   $0x80700c
+  802673:	e8 38 e4 ff ff       	call   800ab0 <memmove>
+  802678:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80267e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802681:	a3 08 70 80 00       	mov    %eax,0x807008
+  802686:	b8 08 00 00 00       	mov    $0x8,%eax
+  80268b:	e8 f5 fd ff ff       	call   802485 <nsipc>
+  802690:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802693:	c9                   	leave
+  802694:	c3                   	ret
+  802695:	68 a2 37 80 00       	push   $0x8037a2
+  80269a:	68 81 37 80 00       	push   $0x803781
+  80269f:	6a 6b                	push   $0x6b
+  8026a1:	68 96 37 80 00       	push   $0x803796
+  8026a6:	e8 83 da ff ff       	call   80012e <_panic>
+
+008026ab <nsipc_socket>:
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	83 ec 08             	sub    $0x8,%esp
+  8026b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b4:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026bc:	a3 04 70 80 00       	mov    %eax,0x807004
+  8026c1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026c4:	a3 08 70 80 00       	mov    %eax,0x807008
+  8026c9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026ce:	e8 b2 fd ff ff       	call   802485 <nsipc>
+  8026d3:	c9                   	leave
+  8026d4:	c3                   	ret
+
+008026d5 <devpipe_stat>:
+  8026d5:	55                   	push   %ebp
+  8026d6:	89 e5                	mov    %esp,%ebp
+  8026d8:	56                   	push   %esi
+  8026d9:	53                   	push   %ebx
+  8026da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026dd:	83 ec 0c             	sub    $0xc,%esp
+  8026e0:	ff 75 08             	push   0x8(%ebp)
+  8026e3:	e8 99 ef ff ff       	call   801681 <fd2data>
+  8026e8:	89 c6                	mov    %eax,%esi
+  8026ea:	83 c4 08             	add    $0x8,%esp
+  8026ed:	68 ae 37 80 00       	push   $0x8037ae
+  8026f2:	53                   	push   %ebx
+  8026f3:	e8 08 e2 ff ff       	call   800900 <strcpy>
+  8026f8:	8b 46 04             	mov    0x4(%esi),%eax
+  8026fb:	2b 06                	sub    (%esi),%eax
+  8026fd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802703:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80270a:	00 00 00 
+  80270d:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802714:	40 80 00 
+  802717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80271f:	5b                   	pop    %ebx
+  802720:	5e                   	pop    %esi
+  802721:	5d                   	pop    %ebp
+  802722:	c3                   	ret
+
+00802723 <devpipe_close>:
+  802723:	55                   	push   %ebp
+  802724:	89 e5                	mov    %esp,%ebp
+  802726:	53                   	push   %ebx
+  802727:	83 ec 0c             	sub    $0xc,%esp
+  80272a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80272d:	53                   	push   %ebx
+  80272e:	6a 00                	push   $0x0
+  802730:	e8 fd e6 ff ff       	call   800e32 <sys_page_unmap>
+  802735:	89 1c 24             	mov    %ebx,(%esp)
+  802738:	e8 44 ef ff ff       	call   801681 <fd2data>
+  80273d:	83 c4 08             	add    $0x8,%esp
+  802740:	50                   	push   %eax
+  802741:	6a 00                	push   $0x0
+  802743:	e8 ea e6 ff ff       	call   800e32 <sys_page_unmap>
+  802748:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274b:	c9                   	leave
+  80274c:	c3                   	ret
+
+0080274d <_pipeisclosed>:
+  80274d:	55                   	push   %ebp
+  80274e:	89 e5                	mov    %esp,%ebp
+  802750:	57                   	push   %edi
+  802751:	56                   	push   %esi
+  802752:	53                   	push   %ebx
+  802753:	83 ec 1c             	sub    $0x1c,%esp
+  802756:	89 c7                	mov    %eax,%edi
+  802758:	89 d6                	mov    %edx,%esi
+  80275a:	a1 10 50 80 00       	mov    0x805010,%eax
+  80275f:	8b 58 58             	mov    0x58(%eax),%ebx
+  802762:	83 ec 0c             	sub    $0xc,%esp
+  802765:	57                   	push   %edi
+  802766:	e8 d2 08 00 00       	call   80303d <pageref>
+  80276b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80276e:	89 34 24             	mov    %esi,(%esp)
+  802771:	e8 c7 08 00 00       	call   80303d <pageref>
+  802776:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  80277c:	8b 4a 58             	mov    0x58(%edx),%ecx
+  80277f:	83 c4 10             	add    $0x10,%esp
+  802782:	39 cb                	cmp    %ecx,%ebx
+  802784:	74 1b                	je     8027a1 <_pipeisclosed+0x54>
+  802786:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802789:	75 cf                	jne    80275a <_pipeisclosed+0xd>
+  80278b:	8b 42 58             	mov    0x58(%edx),%eax
+  80278e:	6a 01                	push   $0x1
+  802790:	50                   	push   %eax
+  802791:	53                   	push   %ebx
+  802792:	68 b5 37 80 00       	push   $0x8037b5
+  802797:	e8 6d da ff ff       	call   800209 <cprintf>
+  80279c:	83 c4 10             	add    $0x10,%esp
+  80279f:	eb b9                	jmp    80275a <_pipeisclosed+0xd>
+  8027a1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027a4:	0f 94 c0             	sete   %al
+  8027a7:	0f b6 c0             	movzbl %al,%eax
+  8027aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ad:	5b                   	pop    %ebx
+  8027ae:	5e                   	pop    %esi
+  8027af:	5f                   	pop    %edi
+  8027b0:	5d                   	pop    %ebp
+  8027b1:	c3                   	ret
+
+008027b2 <devpipe_write>:
+  8027b2:	55                   	push   %ebp
+  8027b3:	89 e5                	mov    %esp,%ebp
+  8027b5:	57                   	push   %edi
+  8027b6:	56                   	push   %esi
+  8027b7:	53                   	push   %ebx
+  8027b8:	83 ec 28             	sub    $0x28,%esp
+  8027bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027be:	56                   	push   %esi
+  8027bf:	e8 bd ee ff ff       	call   801681 <fd2data>
+  8027c4:	89 c3                	mov    %eax,%ebx
+  8027c6:	83 c4 10             	add    $0x10,%esp
+  8027c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027d2:	74 5c                	je     802830 <devpipe_write+0x7e>
+  8027d4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027d7:	8b 0b                	mov    (%ebx),%ecx
+  8027d9:	8d 51 20             	lea    0x20(%ecx),%edx
+  8027dc:	39 d0                	cmp    %edx,%eax
+  8027de:	72 1e                	jb     8027fe <devpipe_write+0x4c>
+  8027e0:	89 da                	mov    %ebx,%edx
+  8027e2:	89 f0                	mov    %esi,%eax
+  8027e4:	e8 64 ff ff ff       	call   80274d <_pipeisclosed>
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	75 48                	jne    802835 <devpipe_write+0x83>
+  8027ed:	e8 23 e5 ff ff       	call   800d15 <sys_yield>
+  8027f2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027f5:	8b 0b                	mov    (%ebx),%ecx
+  8027f7:	8d 51 20             	lea    0x20(%ecx),%edx
+  8027fa:	39 d0                	cmp    %edx,%eax
+  8027fc:	73 e2                	jae    8027e0 <devpipe_write+0x2e>
+  8027fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802801:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802805:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802808:	89 c2                	mov    %eax,%edx
+  80280a:	c1 fa 1f             	sar    $0x1f,%edx
+  80280d:	89 d1                	mov    %edx,%ecx
+  80280f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802812:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802815:	83 e2 1f             	and    $0x1f,%edx
+  802818:	29 ca                	sub    %ecx,%edx
+  80281a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80281e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802822:	83 c0 01             	add    $0x1,%eax
+  802825:	89 43 04             	mov    %eax,0x4(%ebx)
+  802828:	83 c7 01             	add    $0x1,%edi
+  80282b:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80282e:	75 a4                	jne    8027d4 <devpipe_write+0x22>
+  802830:	8b 45 10             	mov    0x10(%ebp),%eax
+  802833:	eb 05                	jmp    80283a <devpipe_write+0x88>
+  802835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283d:	5b                   	pop    %ebx
+  80283e:	5e                   	pop    %esi
+  80283f:	5f                   	pop    %edi
+  802840:	5d                   	pop    %ebp
+  802841:	c3                   	ret
+
+00802842 <devpipe_read>:
+  802842:	55                   	push   %ebp
+  802843:	89 e5                	mov    %esp,%ebp
+  802845:	57                   	push   %edi
+  802846:	56                   	push   %esi
+  802847:	53                   	push   %ebx
+  802848:	83 ec 18             	sub    $0x18,%esp
+  80284b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80284e:	56                   	push   %esi
+  80284f:	e8 2d ee ff ff       	call   801681 <fd2data>
+  802854:	89 c3                	mov    %eax,%ebx
+  802856:	83 c4 10             	add    $0x10,%esp
+  802859:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802862:	74 45                	je     8028a9 <devpipe_read+0x67>
+  802864:	8b 03                	mov    (%ebx),%eax
+  802866:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802869:	75 1d                	jne    802888 <devpipe_read+0x46>
+  80286b:	85 ff                	test   %edi,%edi
+  80286d:	75 3f                	jne    8028ae <devpipe_read+0x6c>
+  80286f:	89 da                	mov    %ebx,%edx
+  802871:	89 f0                	mov    %esi,%eax
+  802873:	e8 d5 fe ff ff       	call   80274d <_pipeisclosed>
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	75 3c                	jne    8028b8 <devpipe_read+0x76>
+  80287c:	e8 94 e4 ff ff       	call   800d15 <sys_yield>
+  802881:	8b 03                	mov    (%ebx),%eax
+  802883:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802886:	74 e7                	je     80286f <devpipe_read+0x2d>
+  802888:	99                   	cltd
+  802889:	c1 ea 1b             	shr    $0x1b,%edx
+  80288c:	01 d0                	add    %edx,%eax
+  80288e:	83 e0 1f             	and    $0x1f,%eax
+  802891:	29 d0                	sub    %edx,%eax
+  802893:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802898:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80289b:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80289e:	83 03 01             	addl   $0x1,(%ebx)
+  8028a1:	83 c7 01             	add    $0x1,%edi
+  8028a4:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8028a7:	75 bb                	jne    802864 <devpipe_read+0x22>
+  8028a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028ac:	eb 02                	jmp    8028b0 <devpipe_read+0x6e>
+  8028ae:	89 f8                	mov    %edi,%eax
+  8028b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b3:	5b                   	pop    %ebx
+  8028b4:	5e                   	pop    %esi
+  8028b5:	5f                   	pop    %edi
+  8028b6:	5d                   	pop    %ebp
+  8028b7:	c3                   	ret
+  8028b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bd:	eb f1                	jmp    8028b0 <devpipe_read+0x6e>
+
+008028bf <pipe>:
+  8028bf:	55                   	push   %ebp
+  8028c0:	89 e5                	mov    %esp,%ebp
+  8028c2:	56                   	push   %esi
+  8028c3:	53                   	push   %ebx
+  8028c4:	83 ec 1c             	sub    $0x1c,%esp
+  8028c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ca:	50                   	push   %eax
+  8028cb:	e8 c8 ed ff ff       	call   801698 <fd_alloc>
+  8028d0:	89 c3                	mov    %eax,%ebx
+  8028d2:	83 c4 10             	add    $0x10,%esp
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	0f 88 23 01 00 00    	js     802a00 <pipe+0x141>
+  8028dd:	83 ec 04             	sub    $0x4,%esp
+  8028e0:	68 07 04 00 00       	push   $0x407
+  8028e5:	ff 75 f4             	push   -0xc(%ebp)
+  8028e8:	6a 00                	push   $0x0
+  8028ea:	e8 71 e4 ff ff       	call   800d60 <sys_page_alloc>
+  8028ef:	89 c3                	mov    %eax,%ebx
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	0f 88 04 01 00 00    	js     802a00 <pipe+0x141>
+  8028fc:	83 ec 0c             	sub    $0xc,%esp
+  8028ff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802902:	50                   	push   %eax
+  802903:	e8 90 ed ff ff       	call   801698 <fd_alloc>
+  802908:	89 c3                	mov    %eax,%ebx
+  80290a:	83 c4 10             	add    $0x10,%esp
+  80290d:	85 c0                	test   %eax,%eax
+  80290f:	0f 88 db 00 00 00    	js     8029f0 <pipe+0x131>
+  802915:	83 ec 04             	sub    $0x4,%esp
+  802918:	68 07 04 00 00       	push   $0x407
+  80291d:	ff 75 f0             	push   -0x10(%ebp)
+  802920:	6a 00                	push   $0x0
+  802922:	e8 39 e4 ff ff       	call   800d60 <sys_page_alloc>
+  802927:	89 c3                	mov    %eax,%ebx
+  802929:	83 c4 10             	add    $0x10,%esp
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	0f 88 bc 00 00 00    	js     8029f0 <pipe+0x131>
+  802934:	83 ec 0c             	sub    $0xc,%esp
+  802937:	ff 75 f4             	push   -0xc(%ebp)
+  80293a:	e8 42 ed ff ff       	call   801681 <fd2data>
+  80293f:	89 c6                	mov    %eax,%esi
+  802941:	83 c4 0c             	add    $0xc,%esp
+  802944:	68 07 04 00 00       	push   $0x407
+  802949:	50                   	push   %eax
+  80294a:	6a 00                	push   $0x0
+  80294c:	e8 0f e4 ff ff       	call   800d60 <sys_page_alloc>
+  802951:	89 c3                	mov    %eax,%ebx
+  802953:	83 c4 10             	add    $0x10,%esp
+  802956:	85 c0                	test   %eax,%eax
+  802958:	0f 88 82 00 00 00    	js     8029e0 <pipe+0x121>
+  80295e:	83 ec 0c             	sub    $0xc,%esp
+  802961:	ff 75 f0             	push   -0x10(%ebp)
+  802964:	e8 18 ed ff ff       	call   801681 <fd2data>
+  802969:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802970:	50                   	push   %eax
+  802971:	6a 00                	push   $0x0
+  802973:	56                   	push   %esi
+  802974:	6a 00                	push   $0x0
+  802976:	e8 28 e4 ff ff       	call   800da3 <sys_page_map>
+  80297b:	89 c3                	mov    %eax,%ebx
+  80297d:	83 c4 20             	add    $0x20,%esp
+  802980:	85 c0                	test   %eax,%eax
+  802982:	78 4e                	js     8029d2 <pipe+0x113>
+  802984:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802989:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80298c:	89 02                	mov    %eax,(%edx)
+  80298e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802991:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802998:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80299b:	89 02                	mov    %eax,(%edx)
+  80299d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029a0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8029a7:	83 ec 0c             	sub    $0xc,%esp
+  8029aa:	ff 75 f4             	push   -0xc(%ebp)
+  8029ad:	e8 bf ec ff ff       	call   801671 <fd2num>
+  8029b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029b5:	89 01                	mov    %eax,(%ecx)
+  8029b7:	83 c4 04             	add    $0x4,%esp
+  8029ba:	ff 75 f0             	push   -0x10(%ebp)
+  8029bd:	e8 af ec ff ff       	call   801671 <fd2num>
+  8029c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029c5:	89 41 04             	mov    %eax,0x4(%ecx)
+  8029c8:	83 c4 10             	add    $0x10,%esp
+  8029cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029d0:	eb 2e                	jmp    802a00 <pipe+0x141>
+  8029d2:	83 ec 08             	sub    $0x8,%esp
+  8029d5:	56                   	push   %esi
+  8029d6:	6a 00                	push   $0x0
+  8029d8:	e8 55 e4 ff ff       	call   800e32 <sys_page_unmap>
+  8029dd:	83 c4 10             	add    $0x10,%esp
+  8029e0:	83 ec 08             	sub    $0x8,%esp
+  8029e3:	ff 75 f0             	push   -0x10(%ebp)
+  8029e6:	6a 00                	push   $0x0
+  8029e8:	e8 45 e4 ff ff       	call   800e32 <sys_page_unmap>
+  8029ed:	83 c4 10             	add    $0x10,%esp
+  8029f0:	83 ec 08             	sub    $0x8,%esp
+  8029f3:	ff 75 f4             	push   -0xc(%ebp)
+  8029f6:	6a 00                	push   $0x0
+  8029f8:	e8 35 e4 ff ff       	call   800e32 <sys_page_unmap>
+  8029fd:	83 c4 10             	add    $0x10,%esp
+  802a00:	89 d8                	mov    %ebx,%eax
+  802a02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a05:	5b                   	pop    %ebx
+  802a06:	5e                   	pop    %esi
+  802a07:	5d                   	pop    %ebp
+  802a08:	c3                   	ret
+
+00802a09 <pipeisclosed>:
+  802a09:	55                   	push   %ebp
+  802a0a:	89 e5                	mov    %esp,%ebp
+  802a0c:	83 ec 20             	sub    $0x20,%esp
+  802a0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a12:	50                   	push   %eax
+  802a13:	ff 75 08             	push   0x8(%ebp)
+  802a16:	e8 cd ec ff ff       	call   8016e8 <fd_lookup>
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	85 c0                	test   %eax,%eax
+  802a20:	78 18                	js     802a3a <pipeisclosed+0x31>
+  802a22:	83 ec 0c             	sub    $0xc,%esp
+  802a25:	ff 75 f4             	push   -0xc(%ebp)
+  802a28:	e8 54 ec ff ff       	call   801681 <fd2data>
+  802a2d:	89 c2                	mov    %eax,%edx
+  802a2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a32:	e8 16 fd ff ff       	call   80274d <_pipeisclosed>
+  802a37:	83 c4 10             	add    $0x10,%esp
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+00802a3c <ipcring_init>:
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	53                   	push   %ebx
+  802a40:	83 ec 08             	sub    $0x8,%esp
+  802a43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a46:	6a 60                	push   $0x60
+  802a48:	6a 00                	push   $0x0
+  802a4a:	53                   	push   %ebx
+  802a4b:	e8 2b e0 ff ff       	call   800a7b <memset>
+  802a50:	a1 10 50 80 00       	mov    0x805010,%eax
+  802a55:	8b 40 48             	mov    0x48(%eax),%eax
+  802a58:	89 03                	mov    %eax,(%ebx)
+  802a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a5d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a60:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a63:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a66:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a69:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a6c:	83 c4 10             	add    $0x10,%esp
+  802a6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a72:	c9                   	leave
+  802a73:	c3                   	ret
+
+00802a74 <ipcring_req_slot>:
+  802a74:	55                   	push   %ebp
+  802a75:	89 e5                	mov    %esp,%ebp
+  802a77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7a:	8b 50 10             	mov    0x10(%eax),%edx
+  802a7d:	8b 48 18             	mov    0x18(%eax),%ecx
+  802a80:	29 ca                	sub    %ecx,%edx
+  802a82:	83 fa 07             	cmp    $0x7,%edx
+  802a85:	77 0c                	ja     802a93 <ipcring_req_slot+0x1f>
+  802a87:	8b 50 10             	mov    0x10(%eax),%edx
+  802a8a:	83 e2 07             	and    $0x7,%edx
+  802a8d:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802a91:	5d                   	pop    %ebp
+  802a92:	c3                   	ret
+  802a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a98:	eb f7                	jmp    802a91 <ipcring_req_slot+0x1d>
+
+00802a9a <ipcring_req_push>:
+  802a9a:	55                   	push   %ebp
+  802a9b:	89 e5                	mov    %esp,%ebp
+  802a9d:	83 ec 08             	sub    $0x8,%esp
+  802aa0:	8b 55 08             	mov    0x8(%ebp),%edx
+  802aa3:	8b 42 10             	mov    0x10(%edx),%eax
+  802aa6:	83 c0 01             	add    $0x1,%eax
+  802aa9:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab2:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802ab6:	85 c0                	test   %eax,%eax
+  802ab8:	75 02                	jne    802abc <ipcring_req_push+0x22>
+  802aba:	c9                   	leave
+  802abb:	c3                   	ret
+  802abc:	6a 00                	push   $0x0
+  802abe:	68 00 00 80 ee       	push   $0xee800000
+  802ac3:	ff 72 08             	push   0x8(%edx)
+  802ac6:	ff 72 04             	push   0x4(%edx)
+  802ac9:	e8 ca e5 ff ff       	call   801098 <sys_ipc_send>
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	eb e7                	jmp    802aba <ipcring_req_push+0x20>
+
+00802ad3 <ipcring_rsp_wait>:
+  802ad3:	55                   	push   %ebp
+  802ad4:	89 e5                	mov    %esp,%ebp
+  802ad6:	53                   	push   %ebx
+  802ad7:	83 ec 04             	sub    $0x4,%esp
+  802ada:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802add:	8b 53 18             	mov    0x18(%ebx),%edx
+  802ae0:	8b 43 10             	mov    0x10(%ebx),%eax
+  802ae3:	39 c2                	cmp    %eax,%edx
+  802ae5:	74 3c                	je     802b23 <ipcring_rsp_wait+0x50>
+  802ae7:	8b 53 14             	mov    0x14(%ebx),%edx
+  802aea:	8b 43 18             	mov    0x18(%ebx),%eax
+  802aed:	39 c2                	cmp    %eax,%edx
+  802aef:	75 23                	jne    802b14 <ipcring_rsp_wait+0x41>
+  802af1:	83 ec 08             	sub    $0x8,%esp
+  802af4:	6a 00                	push   $0x0
+  802af6:	6a 00                	push   $0x0
+  802af8:	6a 00                	push   $0x0
+  802afa:	6a 00                	push   $0x0
+  802afc:	ff 73 0c             	push   0xc(%ebx)
+  802aff:	ff 73 04             	push   0x4(%ebx)
+  802b02:	e8 81 03 00 00       	call   802e88 <ipc_call>
+  802b07:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b0a:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b0d:	83 c4 20             	add    $0x20,%esp
+  802b10:	39 c2                	cmp    %eax,%edx
+  802b12:	74 dd                	je     802af1 <ipcring_rsp_wait+0x1e>
+  802b14:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b17:	83 e0 07             	and    $0x7,%eax
+  802b1a:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802b1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+  802b23:	68 d0 37 80 00       	push   $0x8037d0
+  802b28:	68 81 37 80 00       	push   $0x803781
+  802b2d:	6a 3b                	push   $0x3b
+  802b2f:	68 f1 37 80 00       	push   $0x8037f1
+  802b34:	e8 f5 d5 ff ff       	call   80012e <_panic>
+
+00802b39 <ipcring_rsp_pop>:
+  802b39:	55                   	push   %ebp
+  802b3a:	89 e5                	mov    %esp,%ebp
+  802b3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b3f:	8b 42 18             	mov    0x18(%edx),%eax
+  802b42:	83 c0 01             	add    $0x1,%eax
+  802b45:	89 42 18             	mov    %eax,0x18(%edx)
+  802b48:	5d                   	pop    %ebp
+  802b49:	c3                   	ret
+
+00802b4a <ipcring_server_init>:
+  802b4a:	55                   	push   %ebp
+  802b4b:	89 e5                	mov    %esp,%ebp
+  802b4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b53:	89 10                	mov    %edx,(%eax)
+  802b55:	8b 55 10             	mov    0x10(%ebp),%edx
+  802b58:	89 50 04             	mov    %edx,0x4(%eax)
+  802b5b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802b62:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802b69:	5d                   	pop    %ebp
+  802b6a:	c3                   	ret
+
+00802b6b <ipcring_req_avail>:
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b71:	8b 02                	mov    (%edx),%eax
+  802b73:	8b 40 10             	mov    0x10(%eax),%eax
+  802b76:	2b 42 08             	sub    0x8(%edx),%eax
+  802b79:	ba 08 00 00 00       	mov    $0x8,%edx
+  802b7e:	39 d0                	cmp    %edx,%eax
+  802b80:	0f 47 c2             	cmova  %edx,%eax
+  802b83:	5d                   	pop    %ebp
+  802b84:	c3                   	ret
+
+00802b85 <ipcring_req_peek>:
+  802b85:	55                   	push   %ebp
+  802b86:	89 e5                	mov    %esp,%ebp
+  802b88:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b8b:	8b 42 08             	mov    0x8(%edx),%eax
+  802b8e:	83 e0 07             	and    $0x7,%eax
+  802b91:	8b 12                	mov    (%edx),%edx
+  802b93:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802b97:	5d                   	pop    %ebp
+  802b98:	c3                   	ret
+
+00802b99 <ipcring_rsp_push>:
+  802b99:	55                   	push   %ebp
+  802b9a:	89 e5                	mov    %esp,%ebp
+  802b9c:	83 ec 08             	sub    $0x8,%esp
+  802b9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ba2:	8b 41 08             	mov    0x8(%ecx),%eax
+  802ba5:	83 c0 01             	add    $0x1,%eax
+  802ba8:	89 41 08             	mov    %eax,0x8(%ecx)
+  802bab:	8b 11                	mov    (%ecx),%edx
+  802bad:	83 c2 14             	add    $0x14,%edx
+  802bb0:	f0 87 02             	lock xchg %eax,(%edx)
+  802bb3:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802bb7:	75 02                	jne    802bbb <ipcring_rsp_push+0x22>
+  802bb9:	c9                   	leave
+  802bba:	c3                   	ret
+  802bbb:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802bc2:	6a 00                	push   $0x0
+  802bc4:	68 00 00 80 ee       	push   $0xee800000
+  802bc9:	6a 00                	push   $0x0
+  802bcb:	ff 71 04             	push   0x4(%ecx)
+  802bce:	e8 e8 e3 ff ff       	call   800fbb <sys_ipc_try_send>
+  802bd3:	83 c4 10             	add    $0x10,%esp
+  802bd6:	eb e1                	jmp    802bb9 <ipcring_rsp_push+0x20>
+
+00802bd8 <ipcring_client_wait>:
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	83 ec 08             	sub    $0x8,%esp
+  802bde:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be1:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802be8:	8b 10                	mov    (%eax),%edx
+  802bea:	8b 52 18             	mov    0x18(%edx),%edx
+  802bed:	3b 50 08             	cmp    0x8(%eax),%edx
+  802bf0:	75 02                	jne    802bf4 <ipcring_client_wait+0x1c>
+  802bf2:	c9                   	leave
+  802bf3:	c3                   	ret
+  802bf4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802bfb:	6a 00                	push   $0x0
+  802bfd:	68 00 00 80 ee       	push   $0xee800000
+  802c02:	6a 00                	push   $0x0
+  802c04:	ff 70 04             	push   0x4(%eax)
+  802c07:	e8 af e3 ff ff       	call   800fbb <sys_ipc_try_send>
+  802c0c:	83 c4 10             	add    $0x10,%esp
+  802c0f:	eb e1                	jmp    802bf2 <ipcring_client_wait+0x1a>
+
+00802c11 <ipcring_server_sleep>:
+  802c11:	55                   	push   %ebp
+  802c12:	89 e5                	mov    %esp,%ebp
+  802c14:	53                   	push   %ebx
+  802c15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c18:	8b 01                	mov    (%ecx),%eax
+  802c1a:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802c1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c22:	f0 87 02             	lock xchg %eax,(%edx)
+  802c25:	8b 11                	mov    (%ecx),%edx
+  802c27:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802c2a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c2f:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802c32:	74 0e                	je     802c42 <ipcring_server_sleep+0x31>
+  802c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c39:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+
+00802c47 <devcons_close>:
+  802c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4c:	c3                   	ret
+
+00802c4d <devcons_stat>:
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	83 ec 10             	sub    $0x10,%esp
+  802c53:	68 ff 37 80 00       	push   $0x8037ff
+  802c58:	ff 75 0c             	push   0xc(%ebp)
+  802c5b:	e8 a0 dc ff ff       	call   800900 <strcpy>
+  802c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c65:	c9                   	leave
+  802c66:	c3                   	ret
+
+00802c67 <devcons_write>:
+  802c67:	55                   	push   %ebp
+  802c68:	89 e5                	mov    %esp,%ebp
+  802c6a:	57                   	push   %edi
+  802c6b:	56                   	push   %esi
+  802c6c:	53                   	push   %ebx
+  802c6d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802c73:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802c76:	85 ff                	test   %edi,%edi
+  802c78:	74 51                	je     802ccb <devcons_write+0x64>
+  802c7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c84:	89 fb                	mov    %edi,%ebx
+  802c86:	29 c3                	sub    %eax,%ebx
+  802c88:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802c8d:	39 d3                	cmp    %edx,%ebx
+  802c8f:	0f 47 da             	cmova  %edx,%ebx
+  802c92:	83 ec 04             	sub    $0x4,%esp
+  802c95:	53                   	push   %ebx
+  802c96:	03 45 0c             	add    0xc(%ebp),%eax
+  802c99:	50                   	push   %eax
+  802c9a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802ca0:	50                   	push   %eax
+  802ca1:	e8 0a de ff ff       	call   800ab0 <memmove>
+  802ca6:	83 c4 08             	add    $0x8,%esp
+  802ca9:	53                   	push   %ebx
+  802caa:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802cb0:	50                   	push   %eax
+  802cb1:	e8 c2 df ff ff       	call   800c78 <sys_cputs>
+  802cb6:	01 de                	add    %ebx,%esi
+  802cb8:	89 f0                	mov    %esi,%eax
+  802cba:	83 c4 10             	add    $0x10,%esp
+  802cbd:	39 fe                	cmp    %edi,%esi
+  802cbf:	72 c3                	jb     802c84 <devcons_write+0x1d>
+  802cc1:	89 f0                	mov    %esi,%eax
+  802cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc6:	5b                   	pop    %ebx
+  802cc7:	5e                   	pop    %esi
+  802cc8:	5f                   	pop    %edi
+  802cc9:	5d                   	pop    %ebp
+  802cca:	c3                   	ret
+  802ccb:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd0:	eb ef                	jmp    802cc1 <devcons_write+0x5a>
+
+00802cd2 <devcons_read>:
+  802cd2:	55                   	push   %ebp
+  802cd3:	89 e5                	mov    %esp,%ebp
+  802cd5:	83 ec 08             	sub    $0x8,%esp
+  802cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ce1:	75 07                	jne    802cea <devcons_read+0x18>
+  802ce3:	eb 1f                	jmp    802d04 <devcons_read+0x32>
+  802ce5:	e8 2b e0 ff ff       	call   800d15 <sys_yield>
+  802cea:	e8 a7 df ff ff       	call   800c96 <sys_cgetc>
+  802cef:	85 c0                	test   %eax,%eax
+  802cf1:	74 f2                	je     802ce5 <devcons_read+0x13>
+  802cf3:	78 0f                	js     802d04 <devcons_read+0x32>
+  802cf5:	83 f8 04             	cmp    $0x4,%eax
+  802cf8:	74 0c                	je     802d06 <devcons_read+0x34>
+  802cfa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802cfd:	88 02                	mov    %al,(%edx)
+  802cff:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+  802d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0b:	eb f7                	jmp    802d04 <devcons_read+0x32>
+
+00802d0d <cputchar>:
+  802d0d:	55                   	push   %ebp
+  802d0e:	89 e5                	mov    %esp,%ebp
+  802d10:	83 ec 20             	sub    $0x20,%esp
+  802d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d16:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802d19:	6a 01                	push   $0x1
+  802d1b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d1e:	50                   	push   %eax
+  802d1f:	e8 54 df ff ff       	call   800c78 <sys_cputs>
+  802d24:	83 c4 10             	add    $0x10,%esp
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+00802d29 <getchar>:
+  802d29:	55                   	push   %ebp
+  802d2a:	89 e5                	mov    %esp,%ebp
+  802d2c:	83 ec 1c             	sub    $0x1c,%esp
+  802d2f:	6a 01                	push   $0x1
+  802d31:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d34:	50                   	push   %eax
+  802d35:	6a 00                	push   $0x0
+  802d37:	e8 0e ec ff ff       	call   80194a <read>
+  802d3c:	83 c4 10             	add    $0x10,%esp
+  802d3f:	85 c0                	test   %eax,%eax
+  802d41:	78 06                	js     802d49 <getchar+0x20>
+  802d43:	74 06                	je     802d4b <getchar+0x22>
+  802d45:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802d49:	c9                   	leave
+  802d4a:	c3                   	ret
+  802d4b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802d50:	eb f7                	jmp    802d49 <getchar+0x20>
+
+00802d52 <iscons>:
+  802d52:	55                   	push   %ebp
+  802d53:	89 e5                	mov    %esp,%ebp
+  802d55:	83 ec 20             	sub    $0x20,%esp
+  802d58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d5b:	50                   	push   %eax
+  802d5c:	ff 75 08             	push   0x8(%ebp)
+  802d5f:	e8 84 e9 ff ff       	call   8016e8 <fd_lookup>
+  802d64:	83 c4 10             	add    $0x10,%esp
+  802d67:	85 c0                	test   %eax,%eax
+  802d69:	78 11                	js     802d7c <iscons+0x2a>
+  802d6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d6e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802d74:	39 10                	cmp    %edx,(%eax)
+  802d76:	0f 94 c0             	sete   %al
+  802d79:	0f b6 c0             	movzbl %al,%eax
+  802d7c:	c9                   	leave
+  802d7d:	c3                   	ret
+
+00802d7e <opencons>:
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	83 ec 24             	sub    $0x24,%esp
+  802d84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d87:	50                   	push   %eax
+  802d88:	e8 0b e9 ff ff       	call   801698 <fd_alloc>
+  802d8d:	83 c4 10             	add    $0x10,%esp
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	78 3a                	js     802dce <opencons+0x50>
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	68 07 04 00 00       	push   $0x407
+  802d9c:	ff 75 f4             	push   -0xc(%ebp)
+  802d9f:	6a 00                	push   $0x0
+  802da1:	e8 ba df ff ff       	call   800d60 <sys_page_alloc>
+  802da6:	83 c4 10             	add    $0x10,%esp
+  802da9:	85 c0                	test   %eax,%eax
+  802dab:	78 21                	js     802dce <opencons+0x50>
+  802dad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802db0:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802db6:	89 10                	mov    %edx,(%eax)
+  802db8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dbb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802dc2:	83 ec 0c             	sub    $0xc,%esp
+  802dc5:	50                   	push   %eax
+  802dc6:	e8 a6 e8 ff ff       	call   801671 <fd2num>
+  802dcb:	83 c4 10             	add    $0x10,%esp
+  802dce:	c9                   	leave
+  802dcf:	c3                   	ret
+
+00802dd0 <ipc_recv>:
+  802dd0:	55                   	push   %ebp
+  802dd1:	89 e5                	mov    %esp,%ebp
+  802dd3:	56                   	push   %esi
+  802dd4:	53                   	push   %ebx
+  802dd5:	8b 75 08             	mov    0x8(%ebp),%esi
+  802dd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ddb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802de5:	0f 44 c2             	cmove  %edx,%eax
+  802de8:	83 ec 0c             	sub    $0xc,%esp
+  802deb:	50                   	push   %eax
+  802dec:	e8 1a e2 ff ff       	call   80100b <sys_ipc_recv>
+  802df1:	83 c4 10             	add    $0x10,%esp
+  802df4:	85 c0                	test   %eax,%eax
+  802df6:	78 2a                	js     802e22 <ipc_recv+0x52>
+  802df8:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dfd:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802e03:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802e09:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e0f:	85 f6                	test   %esi,%esi
+  802e11:	74 02                	je     802e15 <ipc_recv+0x45>
+  802e13:	89 0e                	mov    %ecx,(%esi)
+  802e15:	85 db                	test   %ebx,%ebx
+  802e17:	74 02                	je     802e1b <ipc_recv+0x4b>
+  802e19:	89 13                	mov    %edx,(%ebx)
+  802e1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e1e:	5b                   	pop    %ebx
+  802e1f:	5e                   	pop    %esi
+  802e20:	5d                   	pop    %ebp
+  802e21:	c3                   	ret
+  802e22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e2c:	eb e1                	jmp    802e0f <ipc_recv+0x3f>
+
+00802e2e <ipc_send>:
+  802e2e:	55                   	push   %ebp
+  802e2f:	89 e5                	mov    %esp,%ebp
+  802e31:	57                   	push   %edi
+  802e32:	56                   	push   %esi
+  802e33:	53                   	push   %ebx
+  802e34:	83 ec 0c             	sub    $0xc,%esp
+  802e37:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e3d:	8b 75 14             	mov    0x14(%ebp),%esi
+  802e40:	85 db                	test   %ebx,%ebx
+  802e42:	74 1e                	je     802e62 <ipc_send+0x34>
+  802e44:	56                   	push   %esi
+  802e45:	53                   	push   %ebx
+  802e46:	57                   	push   %edi
+  802e47:	ff 75 08             	push   0x8(%ebp)
+  802e4a:	e8 49 e2 ff ff       	call   801098 <sys_ipc_send>
+  802e4f:	83 c4 10             	add    $0x10,%esp
+  802e52:	85 c0                	test   %eax,%eax
+  802e54:	74 2a                	je     802e80 <ipc_send+0x52>
+  802e56:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e59:	75 13                	jne    802e6e <ipc_send+0x40>
+  802e5b:	e8 b5 de ff ff       	call   800d15 <sys_yield>
+  802e60:	eb e2                	jmp    802e44 <ipc_send+0x16>
+  802e62:	be 00 00 00 00       	mov    $0x0,%esi
+  802e67:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802e6c:	eb d6                	jmp    802e44 <ipc_send+0x16>
+  802e6e:	50                   	push   %eax
+  802e6f:	68 0c 38 80 00       	push   $0x80380c
+  802e74:	6a 4f                	push   $0x4f
+  802e76:	68 4f 38 80 00       	push   $0x80384f
+  802e7b:	e8 ae d2 ff ff       	call   80012e <_panic>
+  802e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e83:	5b                   	pop    %ebx
+  802e84:	5e                   	pop    %esi
+  802e85:	5f                   	pop    %edi
+  802e86:	5d                   	pop    %ebp
+  802e87:	c3                   	ret
+
+00802e88 <ipc_call>:
+  802e88:	55                   	push   %ebp
+  802e89:	89 e5                	mov    %esp,%ebp
+  802e8b:	57                   	push   %edi
+  802e8c:	56                   	push   %esi
+  802e8d:	53                   	push   %ebx
+  802e8e:	83 ec 0c             	sub    $0xc,%esp
+  802e91:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e95:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802e9a:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802e9e:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802ea2:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802ea7:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802eab:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802eaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eb4:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802eb8:	eb 05                	jmp    802ebf <ipc_call+0x37>
+  802eba:	e8 56 de ff ff       	call   800d15 <sys_yield>
+  802ebf:	83 ec 0c             	sub    $0xc,%esp
+  802ec2:	56                   	push   %esi
+  802ec3:	53                   	push   %ebx
+  802ec4:	57                   	push   %edi
+  802ec5:	ff 75 0c             	push   0xc(%ebp)
+  802ec8:	ff 75 08             	push   0x8(%ebp)
+  802ecb:	e8 18 e2 ff ff       	call   8010e8 <sys_ipc_call>
+  802ed0:	83 c4 20             	add    $0x20,%esp
+  802ed3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ed6:	74 e2                	je     802eba <ipc_call+0x32>
+  802ed8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802edb:	74 2d                	je     802f0a <ipc_call+0x82>
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	78 4f                	js     802f30 <ipc_call+0xa8>
+  802ee1:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802ee5:	74 10                	je     802ef7 <ipc_call+0x6f>
+  802ee7:	a1 10 50 80 00       	mov    0x805010,%eax
+  802eec:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802ef2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802ef5:	89 02                	mov    %eax,(%edx)
+  802ef7:	a1 10 50 80 00       	mov    0x805010,%eax
+  802efc:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f05:	5b                   	pop    %ebx
+  802f06:	5e                   	pop    %esi
+  802f07:	5f                   	pop    %edi
+  802f08:	5d                   	pop    %ebp
+  802f09:	c3                   	ret
+  802f0a:	ff 75 14             	push   0x14(%ebp)
+  802f0d:	ff 75 10             	push   0x10(%ebp)
+  802f10:	ff 75 0c             	push   0xc(%ebp)
+  802f13:	ff 75 08             	push   0x8(%ebp)
+  802f16:	e8 13 ff ff ff       	call   802e2e <ipc_send>
+  802f1b:	83 c4 0c             	add    $0xc,%esp
+  802f1e:	ff 75 1c             	push   0x1c(%ebp)
+  802f21:	ff 75 18             	push   0x18(%ebp)
+  802f24:	6a 00                	push   $0x0
+  802f26:	e8 a5 fe ff ff       	call   802dd0 <ipc_recv>
+  802f2b:	83 c4 10             	add    $0x10,%esp
+  802f2e:	eb d2                	jmp    802f02 <ipc_call+0x7a>
+  802f30:	50                   	push   %eax
+  802f31:	68 59 38 80 00       	push   $0x803859
+  802f36:	6a 6d                	push   $0x6d
+  802f38:	68 4f 38 80 00       	push   $0x80384f
+  802f3d:	e8 ec d1 ff ff       	call   80012e <_panic>
+
+00802f42 <ipc_reply_recv>:
+  802f42:	55                   	push   %ebp
+  802f43:	89 e5                	mov    %esp,%ebp
+  802f45:	57                   	push   %edi
+  802f46:	56                   	push   %esi
+  802f47:	53                   	push   %ebx
+  802f48:	83 ec 0c             	sub    $0xc,%esp
+  802f4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f4e:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802f51:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802f54:	85 db                	test   %ebx,%ebx
+  802f56:	0f 84 ac 00 00 00    	je     803008 <ipc_reply_recv+0xc6>
+  802f5c:	85 f6                	test   %esi,%esi
+  802f5e:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f63:	0f 45 c6             	cmovne %esi,%eax
+  802f66:	83 ec 0c             	sub    $0xc,%esp
+  802f69:	50                   	push   %eax
+  802f6a:	ff 75 14             	push   0x14(%ebp)
+  802f6d:	53                   	push   %ebx
+  802f6e:	ff 75 0c             	push   0xc(%ebp)
+  802f71:	ff 75 08             	push   0x8(%ebp)
+  802f74:	e8 90 e1 ff ff       	call   801109 <sys_ipc_reply_recv>
+  802f79:	83 c4 20             	add    $0x20,%esp
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	78 3a                	js     802fba <ipc_reply_recv+0x78>
+  802f80:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f84:	74 10                	je     802f96 <ipc_reply_recv+0x54>
+  802f86:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f8b:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802f91:	8b 55 18             	mov    0x18(%ebp),%edx
+  802f94:	89 02                	mov    %eax,(%edx)
+  802f96:	85 ff                	test   %edi,%edi
+  802f98:	74 0d                	je     802fa7 <ipc_reply_recv+0x65>
+  802f9a:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f9f:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802fa5:	89 07                	mov    %eax,(%edi)
+  802fa7:	a1 10 50 80 00       	mov    0x805010,%eax
+  802fac:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802fb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb5:	5b                   	pop    %ebx
+  802fb6:	5e                   	pop    %esi
+  802fb7:	5f                   	pop    %edi
+  802fb8:	5d                   	pop    %ebp
+  802fb9:	c3                   	ret
+  802fba:	ff 75 14             	push   0x14(%ebp)
+  802fbd:	53                   	push   %ebx
+  802fbe:	ff 75 0c             	push   0xc(%ebp)
+  802fc1:	ff 75 08             	push   0x8(%ebp)
+  802fc4:	e8 f2 df ff ff       	call   800fbb <sys_ipc_try_send>
+  802fc9:	89 c2                	mov    %eax,%edx
+  802fcb:	c1 ea 1f             	shr    $0x1f,%edx
+  802fce:	83 c4 10             	add    $0x10,%esp
+  802fd1:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802fd4:	0f 95 c1             	setne  %cl
+  802fd7:	84 d1                	test   %dl,%cl
+  802fd9:	74 05                	je     802fe0 <ipc_reply_recv+0x9e>
+  802fdb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802fde:	75 12                	jne    802ff2 <ipc_reply_recv+0xb0>
+  802fe0:	83 ec 04             	sub    $0x4,%esp
+  802fe3:	57                   	push   %edi
+  802fe4:	56                   	push   %esi
+  802fe5:	ff 75 18             	push   0x18(%ebp)
+  802fe8:	e8 e3 fd ff ff       	call   802dd0 <ipc_recv>
+  802fed:	83 c4 10             	add    $0x10,%esp
+  802ff0:	eb c0                	jmp    802fb2 <ipc_reply_recv+0x70>
+  802ff2:	83 ec 04             	sub    $0x4,%esp
+  802ff5:	50                   	push   %eax
+  802ff6:	ff 75 08             	push   0x8(%ebp)
+  802ff9:	68 2c 38 80 00       	push   $0x80382c
+  802ffe:	e8 06 d2 ff ff       	call   800209 <cprintf>
+  803003:	83 c4 10             	add    $0x10,%esp
+  803006:	eb d8                	jmp    802fe0 <ipc_reply_recv+0x9e>
+  803008:	85 f6                	test   %esi,%esi
+  80300a:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80300f:	0f 45 c6             	cmovne %esi,%eax
+  803012:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803017:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80301e:	e9 43 ff ff ff       	jmp    802f66 <ipc_reply_recv+0x24>
+
+00803023 <ipc_find_env>:
+  803023:	55                   	push   %ebp
+  803024:	89 e5                	mov    %esp,%ebp
+  803026:	83 ec 14             	sub    $0x14,%esp
+  803029:	ff 75 08             	push   0x8(%ebp)
+  80302c:	e8 28 df ff ff       	call   800f59 <sys_env_service>
+  803031:	85 c0                	test   %eax,%eax
+  803033:	ba 00 00 00 00       	mov    $0x0,%edx
+  803038:	0f 48 c2             	cmovs  %edx,%eax
+  80303b:	c9                   	leave
+  80303c:	c3                   	ret
+
+0080303d <pageref>:
+  80303d:	55                   	push   %ebp
+  80303e:	89 e5                	mov    %esp,%ebp
+  803040:	8b 45 08             	mov    0x8(%ebp),%eax
+  803043:	89 c2                	mov    %eax,%edx
+  803045:	c1 ea 16             	shr    $0x16,%edx
+  803048:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80304f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803054:	f6 c1 01             	test   $0x1,%cl
+  803057:	74 22                	je     80307b <pageref+0x3e>
+  803059:	c1 e8 0c             	shr    $0xc,%eax
+  80305c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803063:	a8 01                	test   $0x1,%al
+  803065:	74 14                	je     80307b <pageref+0x3e>
+  803067:	c1 e8 0c             	shr    $0xc,%eax
+  80306a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80306d:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803074:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803078:	0f b7 d2             	movzwl %dx,%edx
+  80307b:	89 d0                	mov    %edx,%eax
+  80307d:	5d                   	pop    %ebp
+  80307e:	c3                   	ret
+
+0080307f <__udivmoddi4>:
+  80307f:	55                   	push   %ebp
+  803080:	57                   	push   %edi
+  803081:	56                   	push   %esi
+  803082:	53                   	push   %ebx
+  803083:	83 ec 24             	sub    $0x24,%esp
+  803086:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80308a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80308e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803092:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803096:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80309a:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80309e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8030a2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8030a6:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8030aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8030b9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8030c0:	00 
+  8030c1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8030c8:	00 
+  8030c9:	89 fb                	mov    %edi,%ebx
+  8030cb:	eb 08                	jmp    8030d5 <__udivmoddi4+0x56>
+  8030cd:	83 e9 01             	sub    $0x1,%ecx
+  8030d0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8030d3:	74 68                	je     80313d <__udivmoddi4+0xbe>
+  8030d5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8030d9:	01 c0                	add    %eax,%eax
+  8030db:	89 c6                	mov    %eax,%esi
+  8030dd:	89 d7                	mov    %edx,%edi
+  8030df:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030e3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030e7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8030ea:	d3 ea                	shr    %cl,%edx
+  8030ec:	f6 c1 20             	test   $0x20,%cl
+  8030ef:	74 04                	je     8030f5 <__udivmoddi4+0x76>
+  8030f1:	89 d0                	mov    %edx,%eax
+  8030f3:	31 d2                	xor    %edx,%edx
+  8030f5:	83 e0 01             	and    $0x1,%eax
+  8030f8:	89 04 24             	mov    %eax,(%esp)
+  8030fb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803102:	00 
+  803103:	8b 04 24             	mov    (%esp),%eax
+  803106:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80310a:	09 f0                	or     %esi,%eax
+  80310c:	09 fa                	or     %edi,%edx
+  80310e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803112:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803116:	39 f0                	cmp    %esi,%eax
+  803118:	89 d5                	mov    %edx,%ebp
+  80311a:	19 fd                	sbb    %edi,%ebp
+  80311c:	72 af                	jb     8030cd <__udivmoddi4+0x4e>
+  80311e:	29 f0                	sub    %esi,%eax
+  803120:	19 fa                	sbb    %edi,%edx
+  803122:	89 cf                	mov    %ecx,%edi
+  803124:	c1 ef 05             	shr    $0x5,%edi
+  803127:	83 e7 01             	and    $0x1,%edi
+  80312a:	89 fe                	mov    %edi,%esi
+  80312c:	83 f6 01             	xor    $0x1,%esi
+  80312f:	d3 e6                	shl    %cl,%esi
+  803131:	d3 e7                	shl    %cl,%edi
+  803133:	09 74 24 18          	or     %esi,0x18(%esp)
+  803137:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80313b:	eb 90                	jmp    8030cd <__udivmoddi4+0x4e>
+  80313d:	85 db                	test   %ebx,%ebx
+  80313f:	74 05                	je     803146 <__udivmoddi4+0xc7>
+  803141:	89 03                	mov    %eax,(%ebx)
+  803143:	89 53 04             	mov    %edx,0x4(%ebx)
+  803146:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80314a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80314e:	83 c4 24             	add    $0x24,%esp
+  803151:	5b                   	pop    %ebx
+  803152:	5e                   	pop    %esi
+  803153:	5f                   	pop    %edi
+  803154:	5d                   	pop    %ebp
+  803155:	c3                   	ret
+
+00803156 <__udivdi3>:
+  803156:	83 ec 08             	sub    $0x8,%esp
+  803159:	6a 00                	push   $0x0
+  80315b:	ff 74 24 1c          	push   0x1c(%esp)
+  80315f:	ff 74 24 1c          	push   0x1c(%esp)
+  803163:	ff 74 24 1c          	push   0x1c(%esp)
+  803167:	ff 74 24 1c          	push   0x1c(%esp)
+  80316b:	e8 0f ff ff ff       	call   80307f <__udivmoddi4>
+  803170:	83 c4 1c             	add    $0x1c,%esp
+  803173:	c3                   	ret
+
+00803174 <__umoddi3>:
+  803174:	83 ec 18             	sub    $0x18,%esp
+  803177:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80317b:	50                   	push   %eax
+  80317c:	ff 74 24 2c          	push   0x2c(%esp)
+  803180:	ff 74 24 2c          	push   0x2c(%esp)
+  803184:	ff 74 24 2c          	push   0x2c(%esp)
+  803188:	ff 74 24 2c          	push   0x2c(%esp)
+  80318c:	e8 ee fe ff ff       	call   80307f <__udivmoddi4>
+  803191:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803195:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803199:	83 c4 2c             	add    $0x2c,%esp
+  80319c:	c3                   	ret
+
+0080319d <__divdi3>:
+  80319d:	53                   	push   %ebx
+  80319e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8031a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8031a6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8031aa:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8031ae:	85 d2                	test   %edx,%edx
+  8031b0:	78 12                	js     8031c4 <__divdi3+0x27>
+  8031b2:	85 db                	test   %ebx,%ebx
+  8031b4:	78 2e                	js     8031e4 <__divdi3+0x47>
+  8031b6:	53                   	push   %ebx
+  8031b7:	51                   	push   %ecx
+  8031b8:	52                   	push   %edx
+  8031b9:	50                   	push   %eax
+  8031ba:	e8 97 ff ff ff       	call   803156 <__udivdi3>
+  8031bf:	83 c4 10             	add    $0x10,%esp
+  8031c2:	eb 1e                	jmp    8031e2 <__divdi3+0x45>
+  8031c4:	f7 d8                	neg    %eax
+  8031c6:	83 d2 00             	adc    $0x0,%edx
+  8031c9:	f7 da                	neg    %edx
+  8031cb:	85 db                	test   %ebx,%ebx
+  8031cd:	78 2a                	js     8031f9 <__divdi3+0x5c>
+  8031cf:	53                   	push   %ebx
+  8031d0:	51                   	push   %ecx
+  8031d1:	52                   	push   %edx
+  8031d2:	50                   	push   %eax
+  8031d3:	e8 7e ff ff ff       	call   803156 <__udivdi3>
+  8031d8:	83 c4 10             	add    $0x10,%esp
+  8031db:	f7 d8                	neg    %eax
+  8031dd:	83 d2 00             	adc    $0x0,%edx
+  8031e0:	f7 da                	neg    %edx
+  8031e2:	5b                   	pop    %ebx
+  8031e3:	c3                   	ret
+  8031e4:	f7 d9                	neg    %ecx
+  8031e6:	83 d3 00             	adc    $0x0,%ebx
+  8031e9:	f7 db                	neg    %ebx
+  8031eb:	53                   	push   %ebx
+  8031ec:	51                   	push   %ecx
+  8031ed:	52                   	push   %edx
+  8031ee:	50                   	push   %eax
+  8031ef:	e8 62 ff ff ff       	call   803156 <__udivdi3>
+  8031f4:	83 c4 10             	add    $0x10,%esp
+  8031f7:	eb e2                	jmp    8031db <__divdi3+0x3e>
+  8031f9:	f7 d9                	neg    %ecx
+  8031fb:	83 d3 00             	adc    $0x0,%ebx
+  8031fe:	f7 db                	neg    %ebx
+  803200:	53                   	push   %ebx
+  803201:	51                   	push   %ecx
+  803202:	52                   	push   %edx
+  803203:	50                   	push   %eax
+  803204:	e8 4d ff ff ff       	call   803156 <__udivdi3>
+  803209:	83 c4 10             	add    $0x10,%esp
+  80320c:	eb d4                	jmp    8031e2 <__divdi3+0x45>
+
+0080320e <__moddi3>:
+  80320e:	55                   	push   %ebp
+  80320f:	57                   	push   %edi
+  803210:	56                   	push   %esi
+  803211:	53                   	push   %ebx
+  803212:	83 ec 0c             	sub    $0xc,%esp
+  803215:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803219:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80321d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803221:	89 e9                	mov    %ebp,%ecx
+  803223:	f7 d9                	neg    %ecx
+  803225:	89 d0                	mov    %edx,%eax
+  803227:	83 d0 00             	adc    $0x0,%eax
+  80322a:	f7 d8                	neg    %eax
+  80322c:	0f 49 e9             	cmovns %ecx,%ebp
+  80322f:	0f 49 d0             	cmovns %eax,%edx
+  803232:	52                   	push   %edx
+  803233:	55                   	push   %ebp
+  803234:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803238:	f7 da                	neg    %edx
+  80323a:	89 d8                	mov    %ebx,%eax
+  80323c:	83 d0 00             	adc    $0x0,%eax
+  80323f:	f7 d8                	neg    %eax
+  803241:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803246:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80324a:	0f 48 c3             	cmovs  %ebx,%eax
+  80324d:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803251:	ff 74 24 0c          	push   0xc(%esp)
+  803255:	ff 74 24 0c          	push   0xc(%esp)
+  803259:	e8 16 ff ff ff       	call   803174 <__umoddi3>
+  80325e:	83 c4 10             	add    $0x10,%esp
+  803261:	85 db                	test   %ebx,%ebx
+  803263:	78 08                	js     80326d <__moddi3+0x5f>
+  803265:	83 c4 0c             	add    $0xc,%esp
+  803268:	5b                   	pop    %ebx
+  803269:	5e                   	pop    %esi
+  80326a:	5f                   	pop    %edi
+  80326b:	5d                   	pop    %ebp
+  80326c:	c3                   	ret
+  80326d:	f7 d8                	neg    %eax
+  80326f:	83 d2 00             	adc    $0x0,%edx
+  803272:	f7 da                	neg    %edx
+  803274:	eb ef                	jmp    803265 <__moddi3+0x57>
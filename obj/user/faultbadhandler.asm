@@ -0,0 +1,5047 @@
+
+obj/user/faultbadhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 7f ee       	push   $0xee7ff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 7f 01 00 00       	call   8001c6 <sys_page_alloc>
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 ef be ad de       	push   $0xdeadbeef
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 89 03 00 00       	call   8003df <sys_env_set_pgfault_upcall>
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800070:	e8 e7 00 00 00       	call   80015c <sys_getenvid>
+  800075:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007a:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800080:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800085:	a3 10 50 80 00       	mov    %eax,0x805010
+  80008a:	85 db                	test   %ebx,%ebx
+  80008c:	7e 07                	jle    800095 <libmain+0x30>
+  80008e:	8b 06                	mov    (%esi),%eax
+  800090:	a3 00 40 80 00       	mov    %eax,0x804000
+  800095:	83 ec 08             	sub    $0x8,%esp
+  800098:	56                   	push   %esi
+  800099:	53                   	push   %ebx
+  80009a:	e8 94 ff ff ff       	call   800033 <umain>
+  80009f:	e8 0a 00 00 00       	call   8000ae <exit>
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000aa:	5b                   	pop    %ebx
+  8000ab:	5e                   	pop    %esi
+  8000ac:	5d                   	pop    %ebp
+  8000ad:	c3                   	ret
+
+008000ae <exit>:
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	83 ec 08             	sub    $0x8,%esp
+  8000b4:	a1 10 50 80 00       	mov    0x805010,%eax
+  8000b9:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	75 14                	jne    8000d7 <exit+0x29>
+  8000c3:	e8 36 0b 00 00       	call   800bfe <close_all>
+  8000c8:	83 ec 0c             	sub    $0xc,%esp
+  8000cb:	6a 00                	push   $0x0
+  8000cd:	e8 49 00 00 00       	call   80011b <sys_env_destroy>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+  8000d5:	c9                   	leave
+  8000d6:	c3                   	ret
+  8000d7:	e8 ac 07 00 00       	call   800888 <sys_lease_complete>
+  8000dc:	eb e5                	jmp    8000c3 <exit+0x15>
+
+008000de <sys_cputs>:
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	57                   	push   %edi
+  8000e2:	56                   	push   %esi
+  8000e3:	53                   	push   %ebx
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ef:	89 c3                	mov    %eax,%ebx
+  8000f1:	89 c7                	mov    %eax,%edi
+  8000f3:	89 c6                	mov    %eax,%esi
+  8000f5:	cd 30                	int    $0x30
+  8000f7:	5b                   	pop    %ebx
+  8000f8:	5e                   	pop    %esi
+  8000f9:	5f                   	pop    %edi
+  8000fa:	5d                   	pop    %ebp
+  8000fb:	c3                   	ret
+
+008000fc <sys_cgetc>:
+  8000fc:	55                   	push   %ebp
+  8000fd:	89 e5                	mov    %esp,%ebp
+  8000ff:	57                   	push   %edi
+  800100:	56                   	push   %esi
+  800101:	53                   	push   %ebx
+  800102:	ba 00 00 00 00       	mov    $0x0,%edx
+  800107:	b8 01 00 00 00       	mov    $0x1,%eax
+  80010c:	89 d1                	mov    %edx,%ecx
+  80010e:	89 d3                	mov    %edx,%ebx
+  800110:	89 d7                	mov    %edx,%edi
+  800112:	89 d6                	mov    %edx,%esi
+  800114:	cd 30                	int    $0x30
+  800116:	5b                   	pop    %ebx
+  800117:	5e                   	pop    %esi
+  800118:	5f                   	pop    %edi
+  800119:	5d                   	pop    %ebp
+  80011a:	c3                   	ret
+
+0080011b <sys_env_destroy>:
+  80011b:	55                   	push   %ebp
+  80011c:	89 e5                	mov    %esp,%ebp
+  80011e:	57                   	push   %edi
+  80011f:	56                   	push   %esi
+  800120:	53                   	push   %ebx
+  800121:	83 ec 0c             	sub    $0xc,%esp
+  800124:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800129:	8b 55 08             	mov    0x8(%ebp),%edx
+  80012c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800131:	89 cb                	mov    %ecx,%ebx
+  800133:	89 cf                	mov    %ecx,%edi
+  800135:	89 ce                	mov    %ecx,%esi
+  800137:	cd 30                	int    $0x30
+  800139:	85 c0                	test   %eax,%eax
+  80013b:	7f 08                	jg     800145 <sys_env_destroy+0x2a>
+  80013d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800140:	5b                   	pop    %ebx
+  800141:	5e                   	pop    %esi
+  800142:	5f                   	pop    %edi
+  800143:	5d                   	pop    %ebp
+  800144:	c3                   	ret
+  800145:	83 ec 0c             	sub    $0xc,%esp
+  800148:	50                   	push   %eax
+  800149:	6a 03                	push   $0x3
+  80014b:	68 aa 31 80 00       	push   $0x8031aa
+  800150:	6a 24                	push   $0x24
+  800152:	68 c7 31 80 00       	push   $0x8031c7
+  800157:	e8 37 20 00 00       	call   802193 <_panic>
+
+0080015c <sys_getenvid>:
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	57                   	push   %edi
+  800160:	56                   	push   %esi
+  800161:	53                   	push   %ebx
+  800162:	ba 00 00 00 00       	mov    $0x0,%edx
+  800167:	b8 02 00 00 00       	mov    $0x2,%eax
+  80016c:	89 d1                	mov    %edx,%ecx
+  80016e:	89 d3                	mov    %edx,%ebx
+  800170:	89 d7                	mov    %edx,%edi
+  800172:	89 d6                	mov    %edx,%esi
+  800174:	cd 30                	int    $0x30
+  800176:	5b                   	pop    %ebx
+  800177:	5e                   	pop    %esi
+  800178:	5f                   	pop    %edi
+  800179:	5d                   	pop    %ebp
+  80017a:	c3                   	ret
+
+0080017b <sys_yield>:
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	56                   	push   %esi
+  800180:	53                   	push   %ebx
+  800181:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800188:	74 26                	je     8001b0 <sys_yield+0x35>
+  80018a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800194:	89 d1                	mov    %edx,%ecx
+  800196:	89 d3                	mov    %edx,%ebx
+  800198:	89 d7                	mov    %edx,%edi
+  80019a:	6a 00                	push   $0x0
+  80019c:	55                   	push   %ebp
+  80019d:	89 e5                	mov    %esp,%ebp
+  80019f:	8d 35 a7 01 80 00    	lea    0x8001a7,%esi
+  8001a5:	0f 34                	sysenter
+  8001a7:	5d                   	pop    %ebp
+  8001a8:	83 c4 04             	add    $0x4,%esp
+  8001ab:	5b                   	pop    %ebx
+  8001ac:	5e                   	pop    %esi
+  8001ad:	5f                   	pop    %edi
+  8001ae:	5d                   	pop    %ebp
+  8001af:	c3                   	ret
+  8001b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001ba:	89 d1                	mov    %edx,%ecx
+  8001bc:	89 d3                	mov    %edx,%ebx
+  8001be:	89 d7                	mov    %edx,%edi
+  8001c0:	89 d6                	mov    %edx,%esi
+  8001c2:	cd 30                	int    $0x30
+  8001c4:	eb e5                	jmp    8001ab <sys_yield+0x30>
+
+008001c6 <sys_page_alloc>:
+  8001c6:	55                   	push   %ebp
+  8001c7:	89 e5                	mov    %esp,%ebp
+  8001c9:	57                   	push   %edi
+  8001ca:	56                   	push   %esi
+  8001cb:	53                   	push   %ebx
+  8001cc:	83 ec 0c             	sub    $0xc,%esp
+  8001cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001da:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001e2:	89 f7                	mov    %esi,%edi
+  8001e4:	cd 30                	int    $0x30
+  8001e6:	85 c0                	test   %eax,%eax
+  8001e8:	7f 08                	jg     8001f2 <sys_page_alloc+0x2c>
+  8001ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ed:	5b                   	pop    %ebx
+  8001ee:	5e                   	pop    %esi
+  8001ef:	5f                   	pop    %edi
+  8001f0:	5d                   	pop    %ebp
+  8001f1:	c3                   	ret
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	50                   	push   %eax
+  8001f6:	6a 04                	push   $0x4
+  8001f8:	68 aa 31 80 00       	push   $0x8031aa
+  8001fd:	6a 24                	push   $0x24
+  8001ff:	68 c7 31 80 00       	push   $0x8031c7
+  800204:	e8 8a 1f 00 00       	call   802193 <_panic>
+
+00800209 <sys_page_map>:
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	57                   	push   %edi
+  80020d:	56                   	push   %esi
+  80020e:	53                   	push   %ebx
+  80020f:	83 ec 0c             	sub    $0xc,%esp
+  800212:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800219:	74 33                	je     80024e <sys_page_map+0x45>
+  80021b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80021e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800221:	b8 05 00 00 00       	mov    $0x5,%eax
+  800226:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800229:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80022c:	ff 75 18             	push   0x18(%ebp)
+  80022f:	55                   	push   %ebp
+  800230:	89 e5                	mov    %esp,%ebp
+  800232:	8d 35 3a 02 80 00    	lea    0x80023a,%esi
+  800238:	0f 34                	sysenter
+  80023a:	5d                   	pop    %ebp
+  80023b:	83 c4 04             	add    $0x4,%esp
+  80023e:	89 c2                	mov    %eax,%edx
+  800240:	85 c0                	test   %eax,%eax
+  800242:	7f 3d                	jg     800281 <sys_page_map+0x78>
+  800244:	89 d0                	mov    %edx,%eax
+  800246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800249:	5b                   	pop    %ebx
+  80024a:	5e                   	pop    %esi
+  80024b:	5f                   	pop    %edi
+  80024c:	5d                   	pop    %ebp
+  80024d:	c3                   	ret
+  80024e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800253:	8b 55 08             	mov    0x8(%ebp),%edx
+  800256:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800259:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80025c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80025f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800262:	cd 30                	int    $0x30
+  800264:	89 c2                	mov    %eax,%edx
+  800266:	85 c0                	test   %eax,%eax
+  800268:	7e da                	jle    800244 <sys_page_map+0x3b>
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+  80026d:	50                   	push   %eax
+  80026e:	6a 05                	push   $0x5
+  800270:	68 aa 31 80 00       	push   $0x8031aa
+  800275:	6a 24                	push   $0x24
+  800277:	68 c7 31 80 00       	push   $0x8031c7
+  80027c:	e8 12 1f 00 00       	call   802193 <_panic>
+  800281:	83 ec 0c             	sub    $0xc,%esp
+  800284:	50                   	push   %eax
+  800285:	6a 05                	push   $0x5
+  800287:	68 aa 31 80 00       	push   $0x8031aa
+  80028c:	6a 48                	push   $0x48
+  80028e:	68 c7 31 80 00       	push   $0x8031c7
+  800293:	e8 fb 1e 00 00       	call   802193 <_panic>
+
+00800298 <sys_page_unmap>:
+  800298:	55                   	push   %ebp
+  800299:	89 e5                	mov    %esp,%ebp
+  80029b:	57                   	push   %edi
+  80029c:	56                   	push   %esi
+  80029d:	53                   	push   %ebx
+  80029e:	83 ec 0c             	sub    $0xc,%esp
+  8002a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ac:	b8 06 00 00 00       	mov    $0x6,%eax
+  8002b1:	89 df                	mov    %ebx,%edi
+  8002b3:	89 de                	mov    %ebx,%esi
+  8002b5:	cd 30                	int    $0x30
+  8002b7:	85 c0                	test   %eax,%eax
+  8002b9:	7f 08                	jg     8002c3 <sys_page_unmap+0x2b>
+  8002bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002be:	5b                   	pop    %ebx
+  8002bf:	5e                   	pop    %esi
+  8002c0:	5f                   	pop    %edi
+  8002c1:	5d                   	pop    %ebp
+  8002c2:	c3                   	ret
+  8002c3:	83 ec 0c             	sub    $0xc,%esp
+  8002c6:	50                   	push   %eax
+  8002c7:	6a 06                	push   $0x6
+  8002c9:	68 aa 31 80 00       	push   $0x8031aa
+  8002ce:	6a 24                	push   $0x24
+  8002d0:	68 c7 31 80 00       	push   $0x8031c7
+  8002d5:	e8 b9 1e 00 00       	call   802193 <_panic>
+
+008002da <sys_fork>:
+  8002da:	55                   	push   %ebp
+  8002db:	89 e5                	mov    %esp,%ebp
+  8002dd:	57                   	push   %edi
+  8002de:	56                   	push   %esi
+  8002df:	53                   	push   %ebx
+  8002e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002ea:	89 d1                	mov    %edx,%ecx
+  8002ec:	89 d3                	mov    %edx,%ebx
+  8002ee:	89 d7                	mov    %edx,%edi
+  8002f0:	89 d6                	mov    %edx,%esi
+  8002f2:	cd 30                	int    $0x30
+  8002f4:	5b                   	pop    %ebx
+  8002f5:	5e                   	pop    %esi
+  8002f6:	5f                   	pop    %edi
+  8002f7:	5d                   	pop    %ebp
+  8002f8:	c3                   	ret
+
+008002f9 <sys_env_set_status>:
+  8002f9:	55                   	push   %ebp
+  8002fa:	89 e5                	mov    %esp,%ebp
+  8002fc:	57                   	push   %edi
+  8002fd:	56                   	push   %esi
+  8002fe:	53                   	push   %ebx
+  8002ff:	83 ec 0c             	sub    $0xc,%esp
+  800302:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800307:	8b 55 08             	mov    0x8(%ebp),%edx
+  80030a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800312:	89 df                	mov    %ebx,%edi
+  800314:	89 de                	mov    %ebx,%esi
+  800316:	cd 30                	int    $0x30
+  800318:	85 c0                	test   %eax,%eax
+  80031a:	7f 08                	jg     800324 <sys_env_set_status+0x2b>
+  80031c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031f:	5b                   	pop    %ebx
+  800320:	5e                   	pop    %esi
+  800321:	5f                   	pop    %edi
+  800322:	5d                   	pop    %ebp
+  800323:	c3                   	ret
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	50                   	push   %eax
+  800328:	6a 08                	push   $0x8
+  80032a:	68 aa 31 80 00       	push   $0x8031aa
+  80032f:	6a 24                	push   $0x24
+  800331:	68 c7 31 80 00       	push   $0x8031c7
+  800336:	e8 58 1e 00 00       	call   802193 <_panic>
+
+0080033b <sys_env_set_trapframe>:
+  80033b:	55                   	push   %ebp
+  80033c:	89 e5                	mov    %esp,%ebp
+  80033e:	57                   	push   %edi
+  80033f:	56                   	push   %esi
+  800340:	53                   	push   %ebx
+  800341:	83 ec 0c             	sub    $0xc,%esp
+  800344:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800349:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80034f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800354:	89 df                	mov    %ebx,%edi
+  800356:	89 de                	mov    %ebx,%esi
+  800358:	cd 30                	int    $0x30
+  80035a:	85 c0                	test   %eax,%eax
+  80035c:	7f 08                	jg     800366 <sys_env_set_trapframe+0x2b>
+  80035e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800361:	5b                   	pop    %ebx
+  800362:	5e                   	pop    %esi
+  800363:	5f                   	pop    %edi
+  800364:	5d                   	pop    %ebp
+  800365:	c3                   	ret
+  800366:	83 ec 0c             	sub    $0xc,%esp
+  800369:	50                   	push   %eax
+  80036a:	6a 09                	push   $0x9
+  80036c:	68 aa 31 80 00       	push   $0x8031aa
+  800371:	6a 24                	push   $0x24
+  800373:	68 c7 31 80 00       	push   $0x8031c7
+  800378:	e8 16 1e 00 00       	call   802193 <_panic>
+
+0080037d <sys_env_set_cow>:
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	57                   	push   %edi
+  800381:	56                   	push   %esi
+  800382:	53                   	push   %ebx
+  800383:	83 ec 0c             	sub    $0xc,%esp
+  800386:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80038b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800391:	b8 20 00 00 00       	mov    $0x20,%eax
+  800396:	89 df                	mov    %ebx,%edi
+  800398:	89 de                	mov    %ebx,%esi
+  80039a:	cd 30                	int    $0x30
+  80039c:	85 c0                	test   %eax,%eax
+  80039e:	7f 08                	jg     8003a8 <sys_env_set_cow+0x2b>
+  8003a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a3:	5b                   	pop    %ebx
+  8003a4:	5e                   	pop    %esi
+  8003a5:	5f                   	pop    %edi
+  8003a6:	5d                   	pop    %ebp
+  8003a7:	c3                   	ret
+  8003a8:	83 ec 0c             	sub    $0xc,%esp
+  8003ab:	50                   	push   %eax
+  8003ac:	6a 20                	push   $0x20
+  8003ae:	68 aa 31 80 00       	push   $0x8031aa
+  8003b3:	6a 24                	push   $0x24
+  8003b5:	68 c7 31 80 00       	push   $0x8031c7
+  8003ba:	e8 d4 1d 00 00       	call   802193 <_panic>
+
+008003bf <sys_env_service>:
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	57                   	push   %edi
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+  8003c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003cd:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003d2:	89 cb                	mov    %ecx,%ebx
+  8003d4:	89 cf                	mov    %ecx,%edi
+  8003d6:	89 ce                	mov    %ecx,%esi
+  8003d8:	cd 30                	int    $0x30
+  8003da:	5b                   	pop    %ebx
+  8003db:	5e                   	pop    %esi
+  8003dc:	5f                   	pop    %edi
+  8003dd:	5d                   	pop    %ebp
+  8003de:	c3                   	ret
+
+008003df <sys_env_set_pgfault_upcall>:
+  8003df:	55                   	push   %ebp
+  8003e0:	89 e5                	mov    %esp,%ebp
+  8003e2:	57                   	push   %edi
+  8003e3:	56                   	push   %esi
+  8003e4:	53                   	push   %ebx
+  8003e5:	83 ec 0c             	sub    $0xc,%esp
+  8003e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003f8:	89 df                	mov    %ebx,%edi
+  8003fa:	89 de                	mov    %ebx,%esi
+  8003fc:	cd 30                	int    $0x30
+  8003fe:	85 c0                	test   %eax,%eax
+  800400:	7f 08                	jg     80040a <sys_env_set_pgfault_upcall+0x2b>
+  800402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800405:	5b                   	pop    %ebx
+  800406:	5e                   	pop    %esi
+  800407:	5f                   	pop    %edi
+  800408:	5d                   	pop    %ebp
+  800409:	c3                   	ret
+  80040a:	83 ec 0c             	sub    $0xc,%esp
+  80040d:	50                   	push   %eax
+  80040e:	6a 0a                	push   $0xa
+  800410:	68 aa 31 80 00       	push   $0x8031aa
+  800415:	6a 24                	push   $0x24
+  800417:	68 c7 31 80 00       	push   $0x8031c7
+  80041c:	e8 72 1d 00 00       	call   802193 <_panic>
+
+00800421 <sys_ipc_try_send>:
+  800421:	55                   	push   %ebp
+  800422:	89 e5                	mov    %esp,%ebp
+  800424:	57                   	push   %edi
+  800425:	56                   	push   %esi
+  800426:	53                   	push   %ebx
+  800427:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80042e:	74 27                	je     800457 <sys_ipc_try_send+0x36>
+  800430:	8b 55 08             	mov    0x8(%ebp),%edx
+  800433:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800436:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80043b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80043e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800441:	6a 00                	push   $0x0
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	8d 35 4e 04 80 00    	lea    0x80044e,%esi
+  80044c:	0f 34                	sysenter
+  80044e:	5d                   	pop    %ebp
+  80044f:	83 c4 04             	add    $0x4,%esp
+  800452:	5b                   	pop    %ebx
+  800453:	5e                   	pop    %esi
+  800454:	5f                   	pop    %edi
+  800455:	5d                   	pop    %ebp
+  800456:	c3                   	ret
+  800457:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80045c:	be 00 00 00 00       	mov    $0x0,%esi
+  800461:	8b 55 08             	mov    0x8(%ebp),%edx
+  800464:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800467:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80046a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80046d:	cd 30                	int    $0x30
+  80046f:	eb e1                	jmp    800452 <sys_ipc_try_send+0x31>
+
+00800471 <sys_ipc_recv>:
+  800471:	55                   	push   %ebp
+  800472:	89 e5                	mov    %esp,%ebp
+  800474:	57                   	push   %edi
+  800475:	56                   	push   %esi
+  800476:	53                   	push   %ebx
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800481:	74 32                	je     8004b5 <sys_ipc_recv+0x44>
+  800483:	8b 55 08             	mov    0x8(%ebp),%edx
+  800486:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800490:	89 cb                	mov    %ecx,%ebx
+  800492:	89 cf                	mov    %ecx,%edi
+  800494:	6a 00                	push   $0x0
+  800496:	55                   	push   %ebp
+  800497:	89 e5                	mov    %esp,%ebp
+  800499:	8d 35 a1 04 80 00    	lea    0x8004a1,%esi
+  80049f:	0f 34                	sysenter
+  8004a1:	5d                   	pop    %ebp
+  8004a2:	83 c4 04             	add    $0x4,%esp
+  8004a5:	89 c2                	mov    %eax,%edx
+  8004a7:	85 c0                	test   %eax,%eax
+  8004a9:	7f 3c                	jg     8004e7 <sys_ipc_recv+0x76>
+  8004ab:	89 d0                	mov    %edx,%eax
+  8004ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+  8004b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ba:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c2:	89 cb                	mov    %ecx,%ebx
+  8004c4:	89 cf                	mov    %ecx,%edi
+  8004c6:	89 ce                	mov    %ecx,%esi
+  8004c8:	cd 30                	int    $0x30
+  8004ca:	89 c2                	mov    %eax,%edx
+  8004cc:	85 c0                	test   %eax,%eax
+  8004ce:	7e db                	jle    8004ab <sys_ipc_recv+0x3a>
+  8004d0:	83 ec 0c             	sub    $0xc,%esp
+  8004d3:	50                   	push   %eax
+  8004d4:	6a 0d                	push   $0xd
+  8004d6:	68 aa 31 80 00       	push   $0x8031aa
+  8004db:	6a 24                	push   $0x24
+  8004dd:	68 c7 31 80 00       	push   $0x8031c7
+  8004e2:	e8 ac 1c 00 00       	call   802193 <_panic>
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	50                   	push   %eax
+  8004eb:	6a 0d                	push   $0xd
+  8004ed:	68 aa 31 80 00       	push   $0x8031aa
+  8004f2:	6a 48                	push   $0x48
+  8004f4:	68 c7 31 80 00       	push   $0x8031c7
+  8004f9:	e8 95 1c 00 00       	call   802193 <_panic>
+
+008004fe <sys_ipc_send>:
+  8004fe:	55                   	push   %ebp
+  8004ff:	89 e5                	mov    %esp,%ebp
+  800501:	57                   	push   %edi
+  800502:	56                   	push   %esi
+  800503:	53                   	push   %ebx
+  800504:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80050b:	74 27                	je     800534 <sys_ipc_send+0x36>
+  80050d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800510:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800513:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800518:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80051b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80051e:	6a 00                	push   $0x0
+  800520:	55                   	push   %ebp
+  800521:	89 e5                	mov    %esp,%ebp
+  800523:	8d 35 2b 05 80 00    	lea    0x80052b,%esi
+  800529:	0f 34                	sysenter
+  80052b:	5d                   	pop    %ebp
+  80052c:	83 c4 04             	add    $0x4,%esp
+  80052f:	5b                   	pop    %ebx
+  800530:	5e                   	pop    %esi
+  800531:	5f                   	pop    %edi
+  800532:	5d                   	pop    %ebp
+  800533:	c3                   	ret
+  800534:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800539:	be 00 00 00 00       	mov    $0x0,%esi
+  80053e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800541:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800544:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800547:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80054a:	cd 30                	int    $0x30
+  80054c:	eb e1                	jmp    80052f <sys_ipc_send+0x31>
+
+0080054e <sys_ipc_call>:
+  80054e:	55                   	push   %ebp
+  80054f:	89 e5                	mov    %esp,%ebp
+  800551:	57                   	push   %edi
+  800552:	56                   	push   %esi
+  800553:	53                   	push   %ebx
+  800554:	8b 55 08             	mov    0x8(%ebp),%edx
+  800557:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80055a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80055f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800562:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800565:	8b 75 18             	mov    0x18(%ebp),%esi
+  800568:	cd 30                	int    $0x30
+  80056a:	5b                   	pop    %ebx
+  80056b:	5e                   	pop    %esi
+  80056c:	5f                   	pop    %edi
+  80056d:	5d                   	pop    %ebp
+  80056e:	c3                   	ret
+
+0080056f <sys_ipc_reply_recv>:
+  80056f:	55                   	push   %ebp
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	57                   	push   %edi
+  800573:	56                   	push   %esi
+  800574:	53                   	push   %ebx
+  800575:	8b 55 08             	mov    0x8(%ebp),%edx
+  800578:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80057b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800580:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800583:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800586:	8b 75 18             	mov    0x18(%ebp),%esi
+  800589:	cd 30                	int    $0x30
+  80058b:	5b                   	pop    %ebx
+  80058c:	5e                   	pop    %esi
+  80058d:	5f                   	pop    %edi
+  80058e:	5d                   	pop    %ebp
+  80058f:	c3                   	ret
+
+00800590 <sys_time_msec>:
+  800590:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  800595:	85 c0                	test   %eax,%eax
+  800597:	75 06                	jne    80059f <sys_time_msec+0xf>
+  800599:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80059e:	c3                   	ret
+  80059f:	55                   	push   %ebp
+  8005a0:	89 e5                	mov    %esp,%ebp
+  8005a2:	57                   	push   %edi
+  8005a3:	56                   	push   %esi
+  8005a4:	53                   	push   %ebx
+  8005a5:	83 ec 0c             	sub    $0xc,%esp
+  8005a8:	0f 31                	rdtsc
+  8005aa:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8005b0:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8005b6:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8005bc:	29 c8                	sub    %ecx,%eax
+  8005be:	19 da                	sbb    %ebx,%edx
+  8005c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005c5:	57                   	push   %edi
+  8005c6:	56                   	push   %esi
+  8005c7:	52                   	push   %edx
+  8005c8:	50                   	push   %eax
+  8005c9:	e8 95 2a 00 00       	call   803063 <__udivdi3>
+  8005ce:	83 c4 10             	add    $0x10,%esp
+  8005d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d4:	5b                   	pop    %ebx
+  8005d5:	5e                   	pop    %esi
+  8005d6:	5f                   	pop    %edi
+  8005d7:	5d                   	pop    %ebp
+  8005d8:	c3                   	ret
+
+008005d9 <sys_env_swap>:
+  8005d9:	55                   	push   %ebp
+  8005da:	89 e5                	mov    %esp,%ebp
+  8005dc:	57                   	push   %edi
+  8005dd:	56                   	push   %esi
+  8005de:	53                   	push   %ebx
+  8005df:	83 ec 0c             	sub    $0xc,%esp
+  8005e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ea:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005ef:	89 cb                	mov    %ecx,%ebx
+  8005f1:	89 cf                	mov    %ecx,%edi
+  8005f3:	89 ce                	mov    %ecx,%esi
+  8005f5:	cd 30                	int    $0x30
+  8005f7:	85 c0                	test   %eax,%eax
+  8005f9:	7f 08                	jg     800603 <sys_env_swap+0x2a>
+  8005fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005fe:	5b                   	pop    %ebx
+  8005ff:	5e                   	pop    %esi
+  800600:	5f                   	pop    %edi
+  800601:	5d                   	pop    %ebp
+  800602:	c3                   	ret
+  800603:	83 ec 0c             	sub    $0xc,%esp
+  800606:	50                   	push   %eax
+  800607:	6a 12                	push   $0x12
+  800609:	68 aa 31 80 00       	push   $0x8031aa
+  80060e:	6a 24                	push   $0x24
+  800610:	68 c7 31 80 00       	push   $0x8031c7
+  800615:	e8 79 1b 00 00       	call   802193 <_panic>
+
+0080061a <sys_net_try_send>:
+  80061a:	55                   	push   %ebp
+  80061b:	89 e5                	mov    %esp,%ebp
+  80061d:	57                   	push   %edi
+  80061e:	56                   	push   %esi
+  80061f:	53                   	push   %ebx
+  800620:	83 ec 0c             	sub    $0xc,%esp
+  800623:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800628:	8b 55 08             	mov    0x8(%ebp),%edx
+  80062b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062e:	b8 13 00 00 00       	mov    $0x13,%eax
+  800633:	89 df                	mov    %ebx,%edi
+  800635:	89 de                	mov    %ebx,%esi
+  800637:	cd 30                	int    $0x30
+  800639:	85 c0                	test   %eax,%eax
+  80063b:	7f 08                	jg     800645 <sys_net_try_send+0x2b>
+  80063d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800640:	5b                   	pop    %ebx
+  800641:	5e                   	pop    %esi
+  800642:	5f                   	pop    %edi
+  800643:	5d                   	pop    %ebp
+  800644:	c3                   	ret
+  800645:	83 ec 0c             	sub    $0xc,%esp
+  800648:	50                   	push   %eax
+  800649:	6a 13                	push   $0x13
+  80064b:	68 aa 31 80 00       	push   $0x8031aa
+  800650:	6a 24                	push   $0x24
+  800652:	68 c7 31 80 00       	push   $0x8031c7
+  800657:	e8 37 1b 00 00       	call   802193 <_panic>
+
+0080065c <sys_net_try_receive>:
+  80065c:	55                   	push   %ebp
+  80065d:	89 e5                	mov    %esp,%ebp
+  80065f:	57                   	push   %edi
+  800660:	56                   	push   %esi
+  800661:	53                   	push   %ebx
+  800662:	83 ec 0c             	sub    $0xc,%esp
+  800665:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800670:	b8 14 00 00 00       	mov    $0x14,%eax
+  800675:	89 df                	mov    %ebx,%edi
+  800677:	89 de                	mov    %ebx,%esi
+  800679:	cd 30                	int    $0x30
+  80067b:	85 c0                	test   %eax,%eax
+  80067d:	7f 08                	jg     800687 <sys_net_try_receive+0x2b>
+  80067f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800682:	5b                   	pop    %ebx
+  800683:	5e                   	pop    %esi
+  800684:	5f                   	pop    %edi
+  800685:	5d                   	pop    %ebp
+  800686:	c3                   	ret
+  800687:	83 ec 0c             	sub    $0xc,%esp
+  80068a:	50                   	push   %eax
+  80068b:	6a 14                	push   $0x14
+  80068d:	68 aa 31 80 00       	push   $0x8031aa
+  800692:	6a 24                	push   $0x24
+  800694:	68 c7 31 80 00       	push   $0x8031c7
+  800699:	e8 f5 1a 00 00       	call   802193 <_panic>
+
+0080069e <sys_net_recv_page>:
+  80069e:	55                   	push   %ebp
+  80069f:	89 e5                	mov    %esp,%ebp
+  8006a1:	57                   	push   %edi
+  8006a2:	56                   	push   %esi
+  8006a3:	53                   	push   %ebx
+  8006a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ac:	b8 27 00 00 00       	mov    $0x27,%eax
+  8006b1:	89 cb                	mov    %ecx,%ebx
+  8006b3:	89 cf                	mov    %ecx,%edi
+  8006b5:	89 ce                	mov    %ecx,%esi
+  8006b7:	cd 30                	int    $0x30
+  8006b9:	5b                   	pop    %ebx
+  8006ba:	5e                   	pop    %esi
+  8006bb:	5f                   	pop    %edi
+  8006bc:	5d                   	pop    %ebp
+  8006bd:	c3                   	ret
+
+008006be <sys_net_wait>:
+  8006be:	55                   	push   %ebp
+  8006bf:	89 e5                	mov    %esp,%ebp
+  8006c1:	57                   	push   %edi
+  8006c2:	56                   	push   %esi
+  8006c3:	53                   	push   %ebx
+  8006c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006c9:	b8 26 00 00 00       	mov    $0x26,%eax
+  8006ce:	89 d1                	mov    %edx,%ecx
+  8006d0:	89 d3                	mov    %edx,%ebx
+  8006d2:	89 d7                	mov    %edx,%edi
+  8006d4:	89 d6                	mov    %edx,%esi
+  8006d6:	cd 30                	int    $0x30
+  8006d8:	5b                   	pop    %ebx
+  8006d9:	5e                   	pop    %esi
+  8006da:	5f                   	pop    %edi
+  8006db:	5d                   	pop    %ebp
+  8006dc:	c3                   	ret
+
+008006dd <sys_get_mac>:
+  8006dd:	55                   	push   %ebp
+  8006de:	89 e5                	mov    %esp,%ebp
+  8006e0:	57                   	push   %edi
+  8006e1:	56                   	push   %esi
+  8006e2:	53                   	push   %ebx
+  8006e3:	83 ec 0c             	sub    $0xc,%esp
+  8006e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006f1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006f6:	89 df                	mov    %ebx,%edi
+  8006f8:	89 de                	mov    %ebx,%esi
+  8006fa:	cd 30                	int    $0x30
+  8006fc:	85 c0                	test   %eax,%eax
+  8006fe:	7f 08                	jg     800708 <sys_get_mac+0x2b>
+  800700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800703:	5b                   	pop    %ebx
+  800704:	5e                   	pop    %esi
+  800705:	5f                   	pop    %edi
+  800706:	5d                   	pop    %ebp
+  800707:	c3                   	ret
+  800708:	83 ec 0c             	sub    $0xc,%esp
+  80070b:	50                   	push   %eax
+  80070c:	6a 15                	push   $0x15
+  80070e:	68 aa 31 80 00       	push   $0x8031aa
+  800713:	6a 24                	push   $0x24
+  800715:	68 c7 31 80 00       	push   $0x8031c7
+  80071a:	e8 74 1a 00 00       	call   802193 <_panic>
+
+0080071f <sys_env_lease>:
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	57                   	push   %edi
+  800723:	56                   	push   %esi
+  800724:	53                   	push   %ebx
+  800725:	83 ec 0c             	sub    $0xc,%esp
+  800728:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80072d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800730:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800733:	b8 16 00 00 00       	mov    $0x16,%eax
+  800738:	89 df                	mov    %ebx,%edi
+  80073a:	89 de                	mov    %ebx,%esi
+  80073c:	cd 30                	int    $0x30
+  80073e:	85 c0                	test   %eax,%eax
+  800740:	7f 08                	jg     80074a <sys_env_lease+0x2b>
+  800742:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800745:	5b                   	pop    %ebx
+  800746:	5e                   	pop    %esi
+  800747:	5f                   	pop    %edi
+  800748:	5d                   	pop    %ebp
+  800749:	c3                   	ret
+  80074a:	83 ec 0c             	sub    $0xc,%esp
+  80074d:	50                   	push   %eax
+  80074e:	6a 16                	push   $0x16
+  800750:	68 aa 31 80 00       	push   $0x8031aa
+  800755:	6a 24                	push   $0x24
+  800757:	68 c7 31 80 00       	push   $0x8031c7
+  80075c:	e8 32 1a 00 00       	call   802193 <_panic>
+
+00800761 <sys_copy_mem>:
+  800761:	55                   	push   %ebp
+  800762:	89 e5                	mov    %esp,%ebp
+  800764:	57                   	push   %edi
+  800765:	56                   	push   %esi
+  800766:	53                   	push   %ebx
+  800767:	83 ec 0c             	sub    $0xc,%esp
+  80076a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80076d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800770:	b8 17 00 00 00       	mov    $0x17,%eax
+  800775:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800778:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80077b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80077e:	cd 30                	int    $0x30
+  800780:	85 c0                	test   %eax,%eax
+  800782:	7f 08                	jg     80078c <sys_copy_mem+0x2b>
+  800784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800787:	5b                   	pop    %ebx
+  800788:	5e                   	pop    %esi
+  800789:	5f                   	pop    %edi
+  80078a:	5d                   	pop    %ebp
+  80078b:	c3                   	ret
+  80078c:	83 ec 0c             	sub    $0xc,%esp
+  80078f:	50                   	push   %eax
+  800790:	6a 17                	push   $0x17
+  800792:	68 aa 31 80 00       	push   $0x8031aa
+  800797:	6a 24                	push   $0x24
+  800799:	68 c7 31 80 00       	push   $0x8031c7
+  80079e:	e8 f0 19 00 00       	call   802193 <_panic>
+
+008007a3 <sys_get_perms>:
+  8007a3:	55                   	push   %ebp
+  8007a4:	89 e5                	mov    %esp,%ebp
+  8007a6:	57                   	push   %edi
+  8007a7:	56                   	push   %esi
+  8007a8:	53                   	push   %ebx
+  8007a9:	83 ec 0c             	sub    $0xc,%esp
+  8007ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8007b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b7:	b8 18 00 00 00       	mov    $0x18,%eax
+  8007bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007bf:	89 f7                	mov    %esi,%edi
+  8007c1:	cd 30                	int    $0x30
+  8007c3:	85 c0                	test   %eax,%eax
+  8007c5:	7f 08                	jg     8007cf <sys_get_perms+0x2c>
+  8007c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ca:	5b                   	pop    %ebx
+  8007cb:	5e                   	pop    %esi
+  8007cc:	5f                   	pop    %edi
+  8007cd:	5d                   	pop    %ebp
+  8007ce:	c3                   	ret
+  8007cf:	83 ec 0c             	sub    $0xc,%esp
+  8007d2:	50                   	push   %eax
+  8007d3:	6a 18                	push   $0x18
+  8007d5:	68 aa 31 80 00       	push   $0x8031aa
+  8007da:	6a 24                	push   $0x24
+  8007dc:	68 c7 31 80 00       	push   $0x8031c7
+  8007e1:	e8 ad 19 00 00       	call   802193 <_panic>
+
+008007e6 <sys_env_unsuspend>:
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	57                   	push   %edi
+  8007ea:	56                   	push   %esi
+  8007eb:	53                   	push   %ebx
+  8007ec:	83 ec 0c             	sub    $0xc,%esp
+  8007ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007fa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800802:	89 f7                	mov    %esi,%edi
+  800804:	cd 30                	int    $0x30
+  800806:	85 c0                	test   %eax,%eax
+  800808:	7f 08                	jg     800812 <sys_env_unsuspend+0x2c>
+  80080a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80080d:	5b                   	pop    %ebx
+  80080e:	5e                   	pop    %esi
+  80080f:	5f                   	pop    %edi
+  800810:	5d                   	pop    %ebp
+  800811:	c3                   	ret
+  800812:	83 ec 0c             	sub    $0xc,%esp
+  800815:	50                   	push   %eax
+  800816:	6a 19                	push   $0x19
+  800818:	68 aa 31 80 00       	push   $0x8031aa
+  80081d:	6a 24                	push   $0x24
+  80081f:	68 c7 31 80 00       	push   $0x8031c7
+  800824:	e8 6a 19 00 00       	call   802193 <_panic>
+
+00800829 <sys_migrate>:
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	57                   	push   %edi
+  80082d:	56                   	push   %esi
+  80082e:	53                   	push   %ebx
+  80082f:	83 ec 0c             	sub    $0xc,%esp
+  800832:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800837:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80083d:	76 11                	jbe    800850 <sys_migrate+0x27>
+  80083f:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800844:	0f b6 08             	movzbl (%eax),%ecx
+  800847:	05 00 10 00 00       	add    $0x1000,%eax
+  80084c:	39 d0                	cmp    %edx,%eax
+  80084e:	72 f4                	jb     800844 <sys_migrate+0x1b>
+  800850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800855:	8b 55 08             	mov    0x8(%ebp),%edx
+  800858:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80085d:	89 cb                	mov    %ecx,%ebx
+  80085f:	89 cf                	mov    %ecx,%edi
+  800861:	89 ce                	mov    %ecx,%esi
+  800863:	cd 30                	int    $0x30
+  800865:	85 c0                	test   %eax,%eax
+  800867:	7f 08                	jg     800871 <sys_migrate+0x48>
+  800869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80086c:	5b                   	pop    %ebx
+  80086d:	5e                   	pop    %esi
+  80086e:	5f                   	pop    %edi
+  80086f:	5d                   	pop    %ebp
+  800870:	c3                   	ret
+  800871:	83 ec 0c             	sub    $0xc,%esp
+  800874:	50                   	push   %eax
+  800875:	6a 1a                	push   $0x1a
+  800877:	68 aa 31 80 00       	push   $0x8031aa
+  80087c:	6a 24                	push   $0x24
+  80087e:	68 c7 31 80 00       	push   $0x8031c7
+  800883:	e8 0b 19 00 00       	call   802193 <_panic>
+
+00800888 <sys_lease_complete>:
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	57                   	push   %edi
+  80088c:	56                   	push   %esi
+  80088d:	53                   	push   %ebx
+  80088e:	83 ec 0c             	sub    $0xc,%esp
+  800891:	ba 00 00 00 00       	mov    $0x0,%edx
+  800896:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80089b:	89 d1                	mov    %edx,%ecx
+  80089d:	89 d3                	mov    %edx,%ebx
+  80089f:	89 d7                	mov    %edx,%edi
+  8008a1:	89 d6                	mov    %edx,%esi
+  8008a3:	cd 30                	int    $0x30
+  8008a5:	85 c0                	test   %eax,%eax
+  8008a7:	7f 08                	jg     8008b1 <sys_lease_complete+0x29>
+  8008a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008ac:	5b                   	pop    %ebx
+  8008ad:	5e                   	pop    %esi
+  8008ae:	5f                   	pop    %edi
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+  8008b1:	83 ec 0c             	sub    $0xc,%esp
+  8008b4:	50                   	push   %eax
+  8008b5:	6a 1b                	push   $0x1b
+  8008b7:	68 aa 31 80 00       	push   $0x8031aa
+  8008bc:	6a 24                	push   $0x24
+  8008be:	68 c7 31 80 00       	push   $0x8031c7
+  8008c3:	e8 cb 18 00 00       	call   802193 <_panic>
+
+008008c8 <sys_env_set_thisenv>:
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	57                   	push   %edi
+  8008cc:	56                   	push   %esi
+  8008cd:	53                   	push   %ebx
+  8008ce:	83 ec 0c             	sub    $0xc,%esp
+  8008d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008dc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008e1:	89 df                	mov    %ebx,%edi
+  8008e3:	89 de                	mov    %ebx,%esi
+  8008e5:	cd 30                	int    $0x30
+  8008e7:	85 c0                	test   %eax,%eax
+  8008e9:	7f 08                	jg     8008f3 <sys_env_set_thisenv+0x2b>
+  8008eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008ee:	5b                   	pop    %ebx
+  8008ef:	5e                   	pop    %esi
+  8008f0:	5f                   	pop    %edi
+  8008f1:	5d                   	pop    %ebp
+  8008f2:	c3                   	ret
+  8008f3:	83 ec 0c             	sub    $0xc,%esp
+  8008f6:	50                   	push   %eax
+  8008f7:	6a 1c                	push   $0x1c
+  8008f9:	68 aa 31 80 00       	push   $0x8031aa
+  8008fe:	6a 24                	push   $0x24
+  800900:	68 c7 31 80 00       	push   $0x8031c7
+  800905:	e8 89 18 00 00       	call   802193 <_panic>
+
+0080090a <sys_env_set_sched>:
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	57                   	push   %edi
+  80090e:	56                   	push   %esi
+  80090f:	53                   	push   %ebx
+  800910:	83 ec 0c             	sub    $0xc,%esp
+  800913:	be 00 00 00 00       	mov    $0x0,%esi
+  800918:	8b 55 08             	mov    0x8(%ebp),%edx
+  80091b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800923:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800926:	89 f7                	mov    %esi,%edi
+  800928:	cd 30                	int    $0x30
+  80092a:	85 c0                	test   %eax,%eax
+  80092c:	7f 08                	jg     800936 <sys_env_set_sched+0x2c>
+  80092e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800931:	5b                   	pop    %ebx
+  800932:	5e                   	pop    %esi
+  800933:	5f                   	pop    %edi
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+  800936:	83 ec 0c             	sub    $0xc,%esp
+  800939:	50                   	push   %eax
+  80093a:	6a 1d                	push   $0x1d
+  80093c:	68 aa 31 80 00       	push   $0x8031aa
+  800941:	6a 24                	push   $0x24
+  800943:	68 c7 31 80 00       	push   $0x8031c7
+  800948:	e8 46 18 00 00       	call   802193 <_panic>
+
+0080094d <sys_batch>:
+  80094d:	55                   	push   %ebp
+  80094e:	89 e5                	mov    %esp,%ebp
+  800950:	57                   	push   %edi
+  800951:	56                   	push   %esi
+  800952:	53                   	push   %ebx
+  800953:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800958:	8b 55 08             	mov    0x8(%ebp),%edx
+  80095b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80095e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800963:	89 df                	mov    %ebx,%edi
+  800965:	89 de                	mov    %ebx,%esi
+  800967:	cd 30                	int    $0x30
+  800969:	5b                   	pop    %ebx
+  80096a:	5e                   	pop    %esi
+  80096b:	5f                   	pop    %edi
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <sys_env_stats>:
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	57                   	push   %edi
+  800972:	56                   	push   %esi
+  800973:	53                   	push   %ebx
+  800974:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800979:	8b 55 08             	mov    0x8(%ebp),%edx
+  80097c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097f:	b8 23 00 00 00       	mov    $0x23,%eax
+  800984:	89 df                	mov    %ebx,%edi
+  800986:	89 de                	mov    %ebx,%esi
+  800988:	cd 30                	int    $0x30
+  80098a:	5b                   	pop    %ebx
+  80098b:	5e                   	pop    %esi
+  80098c:	5f                   	pop    %edi
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <sys_trace>:
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	57                   	push   %edi
+  800993:	56                   	push   %esi
+  800994:	53                   	push   %ebx
+  800995:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80099d:	b8 24 00 00 00       	mov    $0x24,%eax
+  8009a2:	89 cb                	mov    %ecx,%ebx
+  8009a4:	89 cf                	mov    %ecx,%edi
+  8009a6:	89 ce                	mov    %ecx,%esi
+  8009a8:	cd 30                	int    $0x30
+  8009aa:	5b                   	pop    %ebx
+  8009ab:	5e                   	pop    %esi
+  8009ac:	5f                   	pop    %edi
+  8009ad:	5d                   	pop    %ebp
+  8009ae:	c3                   	ret
+
+008009af <sys_env_set_pager>:
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	57                   	push   %edi
+  8009b3:	56                   	push   %esi
+  8009b4:	53                   	push   %ebx
+  8009b5:	83 ec 0c             	sub    $0xc,%esp
+  8009b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8009bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009c3:	b8 25 00 00 00       	mov    $0x25,%eax
+  8009c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009cb:	89 f7                	mov    %esi,%edi
+  8009cd:	cd 30                	int    $0x30
+  8009cf:	85 c0                	test   %eax,%eax
+  8009d1:	7f 08                	jg     8009db <sys_env_set_pager+0x2c>
+  8009d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009d6:	5b                   	pop    %ebx
+  8009d7:	5e                   	pop    %esi
+  8009d8:	5f                   	pop    %edi
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+  8009db:	83 ec 0c             	sub    $0xc,%esp
+  8009de:	50                   	push   %eax
+  8009df:	6a 25                	push   $0x25
+  8009e1:	68 aa 31 80 00       	push   $0x8031aa
+  8009e6:	6a 24                	push   $0x24
+  8009e8:	68 c7 31 80 00       	push   $0x8031c7
+  8009ed:	e8 a1 17 00 00       	call   802193 <_panic>
+
+008009f2 <sys_pager_retire>:
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	57                   	push   %edi
+  8009f6:	56                   	push   %esi
+  8009f7:	53                   	push   %ebx
+  8009f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a00:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a05:	89 cb                	mov    %ecx,%ebx
+  800a07:	89 cf                	mov    %ecx,%edi
+  800a09:	89 ce                	mov    %ecx,%esi
+  800a0b:	cd 30                	int    $0x30
+  800a0d:	5b                   	pop    %ebx
+  800a0e:	5e                   	pop    %esi
+  800a0f:	5f                   	pop    %edi
+  800a10:	5d                   	pop    %ebp
+  800a11:	c3                   	ret
+
+00800a12 <sys_prof>:
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	57                   	push   %edi
+  800a16:	56                   	push   %esi
+  800a17:	53                   	push   %ebx
+  800a18:	be 00 00 00 00       	mov    $0x0,%esi
+  800a1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a23:	b8 22 00 00 00       	mov    $0x22,%eax
+  800a28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a2b:	89 f7                	mov    %esi,%edi
+  800a2d:	cd 30                	int    $0x30
+  800a2f:	5b                   	pop    %ebx
+  800a30:	5e                   	pop    %esi
+  800a31:	5f                   	pop    %edi
+  800a32:	5d                   	pop    %ebp
+  800a33:	c3                   	ret
+
+00800a34 <fd2num>:
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3a:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a3f:	c1 e8 0c             	shr    $0xc,%eax
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <fd2data>:
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4a:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a4f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a54:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a59:	5d                   	pop    %ebp
+  800a5a:	c3                   	ret
+
+00800a5b <fd_alloc>:
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a63:	89 c2                	mov    %eax,%edx
+  800a65:	c1 ea 16             	shr    $0x16,%edx
+  800a68:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a6f:	f6 c2 01             	test   $0x1,%dl
+  800a72:	74 29                	je     800a9d <fd_alloc+0x42>
+  800a74:	89 c2                	mov    %eax,%edx
+  800a76:	c1 ea 0c             	shr    $0xc,%edx
+  800a79:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a80:	f6 c2 01             	test   $0x1,%dl
+  800a83:	74 18                	je     800a9d <fd_alloc+0x42>
+  800a85:	05 00 10 00 00       	add    $0x1000,%eax
+  800a8a:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a8f:	75 d2                	jne    800a63 <fd_alloc+0x8>
+  800a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a96:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a9b:	eb 05                	jmp    800aa2 <fd_alloc+0x47>
+  800a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa5:	89 02                	mov    %eax,(%edx)
+  800aa7:	89 c8                	mov    %ecx,%eax
+  800aa9:	5d                   	pop    %ebp
+  800aaa:	c3                   	ret
+
+00800aab <fd_lookup>:
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab1:	83 f8 1f             	cmp    $0x1f,%eax
+  800ab4:	77 30                	ja     800ae6 <fd_lookup+0x3b>
+  800ab6:	c1 e0 0c             	shl    $0xc,%eax
+  800ab9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800abe:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ac4:	f6 c2 01             	test   $0x1,%dl
+  800ac7:	74 24                	je     800aed <fd_lookup+0x42>
+  800ac9:	89 c2                	mov    %eax,%edx
+  800acb:	c1 ea 0c             	shr    $0xc,%edx
+  800ace:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800ad5:	f6 c2 01             	test   $0x1,%dl
+  800ad8:	74 1a                	je     800af4 <fd_lookup+0x49>
+  800ada:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800add:	89 02                	mov    %eax,(%edx)
+  800adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae4:	5d                   	pop    %ebp
+  800ae5:	c3                   	ret
+  800ae6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aeb:	eb f7                	jmp    800ae4 <fd_lookup+0x39>
+  800aed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af2:	eb f0                	jmp    800ae4 <fd_lookup+0x39>
+  800af4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af9:	eb e9                	jmp    800ae4 <fd_lookup+0x39>
+
+00800afb <dev_lookup>:
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	53                   	push   %ebx
+  800aff:	83 ec 04             	sub    $0x4,%esp
+  800b02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0a:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800b0f:	39 13                	cmp    %edx,(%ebx)
+  800b11:	74 37                	je     800b4a <dev_lookup+0x4f>
+  800b13:	83 c0 01             	add    $0x1,%eax
+  800b16:	8b 1c 85 54 32 80 00 	mov    0x803254(,%eax,4),%ebx
+  800b1d:	85 db                	test   %ebx,%ebx
+  800b1f:	75 ee                	jne    800b0f <dev_lookup+0x14>
+  800b21:	a1 10 50 80 00       	mov    0x805010,%eax
+  800b26:	8b 40 48             	mov    0x48(%eax),%eax
+  800b29:	83 ec 04             	sub    $0x4,%esp
+  800b2c:	52                   	push   %edx
+  800b2d:	50                   	push   %eax
+  800b2e:	68 d8 31 80 00       	push   $0x8031d8
+  800b33:	e8 36 17 00 00       	call   80226e <cprintf>
+  800b38:	83 c4 10             	add    $0x10,%esp
+  800b3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b43:	89 1a                	mov    %ebx,(%edx)
+  800b45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b48:	c9                   	leave
+  800b49:	c3                   	ret
+  800b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4f:	eb ef                	jmp    800b40 <dev_lookup+0x45>
+
+00800b51 <fd_close>:
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	57                   	push   %edi
+  800b55:	56                   	push   %esi
+  800b56:	53                   	push   %ebx
+  800b57:	83 ec 24             	sub    $0x24,%esp
+  800b5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b5d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b60:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b63:	50                   	push   %eax
+  800b64:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b6a:	c1 e8 0c             	shr    $0xc,%eax
+  800b6d:	50                   	push   %eax
+  800b6e:	e8 38 ff ff ff       	call   800aab <fd_lookup>
+  800b73:	89 c3                	mov    %eax,%ebx
+  800b75:	83 c4 10             	add    $0x10,%esp
+  800b78:	85 c0                	test   %eax,%eax
+  800b7a:	78 05                	js     800b81 <fd_close+0x30>
+  800b7c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b7f:	74 0f                	je     800b90 <fd_close+0x3f>
+  800b81:	85 ff                	test   %edi,%edi
+  800b83:	0f 44 df             	cmove  %edi,%ebx
+  800b86:	89 d8                	mov    %ebx,%eax
+  800b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5f                   	pop    %edi
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+  800b90:	83 ec 08             	sub    $0x8,%esp
+  800b93:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b96:	50                   	push   %eax
+  800b97:	ff 36                	push   (%esi)
+  800b99:	e8 5d ff ff ff       	call   800afb <dev_lookup>
+  800b9e:	89 c3                	mov    %eax,%ebx
+  800ba0:	83 c4 10             	add    $0x10,%esp
+  800ba3:	85 c0                	test   %eax,%eax
+  800ba5:	78 1a                	js     800bc1 <fd_close+0x70>
+  800ba7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800baa:	8b 40 10             	mov    0x10(%eax),%eax
+  800bad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb2:	85 c0                	test   %eax,%eax
+  800bb4:	74 0b                	je     800bc1 <fd_close+0x70>
+  800bb6:	83 ec 0c             	sub    $0xc,%esp
+  800bb9:	56                   	push   %esi
+  800bba:	ff d0                	call   *%eax
+  800bbc:	89 c3                	mov    %eax,%ebx
+  800bbe:	83 c4 10             	add    $0x10,%esp
+  800bc1:	83 ec 08             	sub    $0x8,%esp
+  800bc4:	56                   	push   %esi
+  800bc5:	6a 00                	push   $0x0
+  800bc7:	e8 cc f6 ff ff       	call   800298 <sys_page_unmap>
+  800bcc:	83 c4 10             	add    $0x10,%esp
+  800bcf:	eb b5                	jmp    800b86 <fd_close+0x35>
+
+00800bd1 <close>:
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	83 ec 20             	sub    $0x20,%esp
+  800bd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bda:	50                   	push   %eax
+  800bdb:	ff 75 08             	push   0x8(%ebp)
+  800bde:	e8 c8 fe ff ff       	call   800aab <fd_lookup>
+  800be3:	83 c4 10             	add    $0x10,%esp
+  800be6:	85 c0                	test   %eax,%eax
+  800be8:	79 02                	jns    800bec <close+0x1b>
+  800bea:	c9                   	leave
+  800beb:	c3                   	ret
+  800bec:	83 ec 08             	sub    $0x8,%esp
+  800bef:	6a 01                	push   $0x1
+  800bf1:	ff 75 f4             	push   -0xc(%ebp)
+  800bf4:	e8 58 ff ff ff       	call   800b51 <fd_close>
+  800bf9:	83 c4 10             	add    $0x10,%esp
+  800bfc:	eb ec                	jmp    800bea <close+0x19>
+
+00800bfe <close_all>:
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	53                   	push   %ebx
+  800c02:	83 ec 04             	sub    $0x4,%esp
+  800c05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c0a:	83 ec 0c             	sub    $0xc,%esp
+  800c0d:	53                   	push   %ebx
+  800c0e:	e8 be ff ff ff       	call   800bd1 <close>
+  800c13:	83 c3 01             	add    $0x1,%ebx
+  800c16:	83 c4 10             	add    $0x10,%esp
+  800c19:	83 fb 20             	cmp    $0x20,%ebx
+  800c1c:	75 ec                	jne    800c0a <close_all+0xc>
+  800c1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c21:	c9                   	leave
+  800c22:	c3                   	ret
+
+00800c23 <dup>:
+  800c23:	55                   	push   %ebp
+  800c24:	89 e5                	mov    %esp,%ebp
+  800c26:	57                   	push   %edi
+  800c27:	56                   	push   %esi
+  800c28:	53                   	push   %ebx
+  800c29:	83 ec 34             	sub    $0x34,%esp
+  800c2c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c2f:	50                   	push   %eax
+  800c30:	ff 75 08             	push   0x8(%ebp)
+  800c33:	e8 73 fe ff ff       	call   800aab <fd_lookup>
+  800c38:	89 c3                	mov    %eax,%ebx
+  800c3a:	83 c4 10             	add    $0x10,%esp
+  800c3d:	85 c0                	test   %eax,%eax
+  800c3f:	78 7f                	js     800cc0 <dup+0x9d>
+  800c41:	83 ec 0c             	sub    $0xc,%esp
+  800c44:	ff 75 0c             	push   0xc(%ebp)
+  800c47:	e8 85 ff ff ff       	call   800bd1 <close>
+  800c4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c4f:	c1 e6 0c             	shl    $0xc,%esi
+  800c52:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c58:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c5b:	89 3c 24             	mov    %edi,(%esp)
+  800c5e:	e8 e1 fd ff ff       	call   800a44 <fd2data>
+  800c63:	89 c3                	mov    %eax,%ebx
+  800c65:	89 34 24             	mov    %esi,(%esp)
+  800c68:	e8 d7 fd ff ff       	call   800a44 <fd2data>
+  800c6d:	83 c4 10             	add    $0x10,%esp
+  800c70:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c73:	89 d8                	mov    %ebx,%eax
+  800c75:	c1 e8 16             	shr    $0x16,%eax
+  800c78:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c7f:	a8 01                	test   $0x1,%al
+  800c81:	74 11                	je     800c94 <dup+0x71>
+  800c83:	89 d8                	mov    %ebx,%eax
+  800c85:	c1 e8 0c             	shr    $0xc,%eax
+  800c88:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c8f:	f6 c2 01             	test   $0x1,%dl
+  800c92:	75 36                	jne    800cca <dup+0xa7>
+  800c94:	89 f8                	mov    %edi,%eax
+  800c96:	c1 e8 0c             	shr    $0xc,%eax
+  800c99:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ca0:	83 ec 0c             	sub    $0xc,%esp
+  800ca3:	25 07 0e 00 00       	and    $0xe07,%eax
+  800ca8:	50                   	push   %eax
+  800ca9:	56                   	push   %esi
+  800caa:	6a 00                	push   $0x0
+  800cac:	57                   	push   %edi
+  800cad:	6a 00                	push   $0x0
+  800caf:	e8 55 f5 ff ff       	call   800209 <sys_page_map>
+  800cb4:	89 c3                	mov    %eax,%ebx
+  800cb6:	83 c4 20             	add    $0x20,%esp
+  800cb9:	85 c0                	test   %eax,%eax
+  800cbb:	78 33                	js     800cf0 <dup+0xcd>
+  800cbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cc0:	89 d8                	mov    %ebx,%eax
+  800cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+  800cca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  800cd4:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cd9:	50                   	push   %eax
+  800cda:	ff 75 d4             	push   -0x2c(%ebp)
+  800cdd:	6a 00                	push   $0x0
+  800cdf:	53                   	push   %ebx
+  800ce0:	6a 00                	push   $0x0
+  800ce2:	e8 22 f5 ff ff       	call   800209 <sys_page_map>
+  800ce7:	89 c3                	mov    %eax,%ebx
+  800ce9:	83 c4 20             	add    $0x20,%esp
+  800cec:	85 c0                	test   %eax,%eax
+  800cee:	79 a4                	jns    800c94 <dup+0x71>
+  800cf0:	83 ec 08             	sub    $0x8,%esp
+  800cf3:	56                   	push   %esi
+  800cf4:	6a 00                	push   $0x0
+  800cf6:	e8 9d f5 ff ff       	call   800298 <sys_page_unmap>
+  800cfb:	83 c4 08             	add    $0x8,%esp
+  800cfe:	ff 75 d4             	push   -0x2c(%ebp)
+  800d01:	6a 00                	push   $0x0
+  800d03:	e8 90 f5 ff ff       	call   800298 <sys_page_unmap>
+  800d08:	83 c4 10             	add    $0x10,%esp
+  800d0b:	eb b3                	jmp    800cc0 <dup+0x9d>
+
+00800d0d <read>:
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	56                   	push   %esi
+  800d11:	53                   	push   %ebx
+  800d12:	83 ec 18             	sub    $0x18,%esp
+  800d15:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d18:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d1b:	50                   	push   %eax
+  800d1c:	56                   	push   %esi
+  800d1d:	e8 89 fd ff ff       	call   800aab <fd_lookup>
+  800d22:	83 c4 10             	add    $0x10,%esp
+  800d25:	85 c0                	test   %eax,%eax
+  800d27:	78 3c                	js     800d65 <read+0x58>
+  800d29:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d2c:	83 ec 08             	sub    $0x8,%esp
+  800d2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d32:	50                   	push   %eax
+  800d33:	ff 33                	push   (%ebx)
+  800d35:	e8 c1 fd ff ff       	call   800afb <dev_lookup>
+  800d3a:	83 c4 10             	add    $0x10,%esp
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	78 24                	js     800d65 <read+0x58>
+  800d41:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d44:	83 e0 03             	and    $0x3,%eax
+  800d47:	83 f8 01             	cmp    $0x1,%eax
+  800d4a:	74 20                	je     800d6c <read+0x5f>
+  800d4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d4f:	8b 40 08             	mov    0x8(%eax),%eax
+  800d52:	85 c0                	test   %eax,%eax
+  800d54:	74 37                	je     800d8d <read+0x80>
+  800d56:	83 ec 04             	sub    $0x4,%esp
+  800d59:	ff 75 10             	push   0x10(%ebp)
+  800d5c:	ff 75 0c             	push   0xc(%ebp)
+  800d5f:	53                   	push   %ebx
+  800d60:	ff d0                	call   *%eax
+  800d62:	83 c4 10             	add    $0x10,%esp
+  800d65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d68:	5b                   	pop    %ebx
+  800d69:	5e                   	pop    %esi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+  800d6c:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d71:	8b 40 48             	mov    0x48(%eax),%eax
+  800d74:	83 ec 04             	sub    $0x4,%esp
+  800d77:	56                   	push   %esi
+  800d78:	50                   	push   %eax
+  800d79:	68 19 32 80 00       	push   $0x803219
+  800d7e:	e8 eb 14 00 00       	call   80226e <cprintf>
+  800d83:	83 c4 10             	add    $0x10,%esp
+  800d86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d8b:	eb d8                	jmp    800d65 <read+0x58>
+  800d8d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d92:	eb d1                	jmp    800d65 <read+0x58>
+
+00800d94 <readn>:
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+  800d9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800da0:	8b 75 10             	mov    0x10(%ebp),%esi
+  800da3:	85 f6                	test   %esi,%esi
+  800da5:	74 30                	je     800dd7 <readn+0x43>
+  800da7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	83 ec 04             	sub    $0x4,%esp
+  800db4:	89 f2                	mov    %esi,%edx
+  800db6:	29 c2                	sub    %eax,%edx
+  800db8:	52                   	push   %edx
+  800db9:	01 f8                	add    %edi,%eax
+  800dbb:	50                   	push   %eax
+  800dbc:	ff 75 08             	push   0x8(%ebp)
+  800dbf:	e8 49 ff ff ff       	call   800d0d <read>
+  800dc4:	83 c4 10             	add    $0x10,%esp
+  800dc7:	85 c0                	test   %eax,%eax
+  800dc9:	78 15                	js     800de0 <readn+0x4c>
+  800dcb:	74 11                	je     800dde <readn+0x4a>
+  800dcd:	01 c3                	add    %eax,%ebx
+  800dcf:	89 d8                	mov    %ebx,%eax
+  800dd1:	39 f3                	cmp    %esi,%ebx
+  800dd3:	72 dc                	jb     800db1 <readn+0x1d>
+  800dd5:	eb 09                	jmp    800de0 <readn+0x4c>
+  800dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddc:	eb 02                	jmp    800de0 <readn+0x4c>
+  800dde:	89 d8                	mov    %ebx,%eax
+  800de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <write>:
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+  800ded:	83 ec 18             	sub    $0x18,%esp
+  800df0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800df3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800df6:	50                   	push   %eax
+  800df7:	53                   	push   %ebx
+  800df8:	e8 ae fc ff ff       	call   800aab <fd_lookup>
+  800dfd:	83 c4 10             	add    $0x10,%esp
+  800e00:	85 c0                	test   %eax,%eax
+  800e02:	78 37                	js     800e3b <write+0x53>
+  800e04:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e07:	83 ec 08             	sub    $0x8,%esp
+  800e0a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e0d:	50                   	push   %eax
+  800e0e:	ff 36                	push   (%esi)
+  800e10:	e8 e6 fc ff ff       	call   800afb <dev_lookup>
+  800e15:	83 c4 10             	add    $0x10,%esp
+  800e18:	85 c0                	test   %eax,%eax
+  800e1a:	78 1f                	js     800e3b <write+0x53>
+  800e1c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e20:	74 20                	je     800e42 <write+0x5a>
+  800e22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e25:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e28:	85 c0                	test   %eax,%eax
+  800e2a:	74 37                	je     800e63 <write+0x7b>
+  800e2c:	83 ec 04             	sub    $0x4,%esp
+  800e2f:	ff 75 10             	push   0x10(%ebp)
+  800e32:	ff 75 0c             	push   0xc(%ebp)
+  800e35:	56                   	push   %esi
+  800e36:	ff d0                	call   *%eax
+  800e38:	83 c4 10             	add    $0x10,%esp
+  800e3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+  800e42:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e47:	8b 40 48             	mov    0x48(%eax),%eax
+  800e4a:	83 ec 04             	sub    $0x4,%esp
+  800e4d:	53                   	push   %ebx
+  800e4e:	50                   	push   %eax
+  800e4f:	68 35 32 80 00       	push   $0x803235
+  800e54:	e8 15 14 00 00       	call   80226e <cprintf>
+  800e59:	83 c4 10             	add    $0x10,%esp
+  800e5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e61:	eb d8                	jmp    800e3b <write+0x53>
+  800e63:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e68:	eb d1                	jmp    800e3b <write+0x53>
+
+00800e6a <seek>:
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	83 ec 20             	sub    $0x20,%esp
+  800e70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e73:	50                   	push   %eax
+  800e74:	ff 75 08             	push   0x8(%ebp)
+  800e77:	e8 2f fc ff ff       	call   800aab <fd_lookup>
+  800e7c:	83 c4 10             	add    $0x10,%esp
+  800e7f:	85 c0                	test   %eax,%eax
+  800e81:	78 0e                	js     800e91 <seek+0x27>
+  800e83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e89:	89 50 04             	mov    %edx,0x4(%eax)
+  800e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e91:	c9                   	leave
+  800e92:	c3                   	ret
+
+00800e93 <ftruncate>:
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	56                   	push   %esi
+  800e97:	53                   	push   %ebx
+  800e98:	83 ec 18             	sub    $0x18,%esp
+  800e9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e9e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ea1:	50                   	push   %eax
+  800ea2:	53                   	push   %ebx
+  800ea3:	e8 03 fc ff ff       	call   800aab <fd_lookup>
+  800ea8:	83 c4 10             	add    $0x10,%esp
+  800eab:	85 c0                	test   %eax,%eax
+  800ead:	78 34                	js     800ee3 <ftruncate+0x50>
+  800eaf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800eb2:	83 ec 08             	sub    $0x8,%esp
+  800eb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800eb8:	50                   	push   %eax
+  800eb9:	ff 36                	push   (%esi)
+  800ebb:	e8 3b fc ff ff       	call   800afb <dev_lookup>
+  800ec0:	83 c4 10             	add    $0x10,%esp
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	78 1c                	js     800ee3 <ftruncate+0x50>
+  800ec7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ecb:	74 1d                	je     800eea <ftruncate+0x57>
+  800ecd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ed0:	8b 40 18             	mov    0x18(%eax),%eax
+  800ed3:	85 c0                	test   %eax,%eax
+  800ed5:	74 34                	je     800f0b <ftruncate+0x78>
+  800ed7:	83 ec 08             	sub    $0x8,%esp
+  800eda:	ff 75 0c             	push   0xc(%ebp)
+  800edd:	56                   	push   %esi
+  800ede:	ff d0                	call   *%eax
+  800ee0:	83 c4 10             	add    $0x10,%esp
+  800ee3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+  800eea:	a1 10 50 80 00       	mov    0x805010,%eax
+  800eef:	8b 40 48             	mov    0x48(%eax),%eax
+  800ef2:	83 ec 04             	sub    $0x4,%esp
+  800ef5:	53                   	push   %ebx
+  800ef6:	50                   	push   %eax
+  800ef7:	68 f8 31 80 00       	push   $0x8031f8
+  800efc:	e8 6d 13 00 00       	call   80226e <cprintf>
+  800f01:	83 c4 10             	add    $0x10,%esp
+  800f04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f09:	eb d8                	jmp    800ee3 <ftruncate+0x50>
+  800f0b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f10:	eb d1                	jmp    800ee3 <ftruncate+0x50>
+
+00800f12 <fstat>:
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+  800f17:	83 ec 18             	sub    $0x18,%esp
+  800f1a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f20:	50                   	push   %eax
+  800f21:	ff 75 08             	push   0x8(%ebp)
+  800f24:	e8 82 fb ff ff       	call   800aab <fd_lookup>
+  800f29:	83 c4 10             	add    $0x10,%esp
+  800f2c:	85 c0                	test   %eax,%eax
+  800f2e:	78 49                	js     800f79 <fstat+0x67>
+  800f30:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f33:	83 ec 08             	sub    $0x8,%esp
+  800f36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f39:	50                   	push   %eax
+  800f3a:	ff 36                	push   (%esi)
+  800f3c:	e8 ba fb ff ff       	call   800afb <dev_lookup>
+  800f41:	83 c4 10             	add    $0x10,%esp
+  800f44:	85 c0                	test   %eax,%eax
+  800f46:	78 31                	js     800f79 <fstat+0x67>
+  800f48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f4b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f4f:	74 2f                	je     800f80 <fstat+0x6e>
+  800f51:	c6 03 00             	movb   $0x0,(%ebx)
+  800f54:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f5b:	00 00 00 
+  800f5e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f65:	00 00 00 
+  800f68:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f6e:	83 ec 08             	sub    $0x8,%esp
+  800f71:	53                   	push   %ebx
+  800f72:	56                   	push   %esi
+  800f73:	ff 50 14             	call   *0x14(%eax)
+  800f76:	83 c4 10             	add    $0x10,%esp
+  800f79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+  800f80:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f85:	eb f2                	jmp    800f79 <fstat+0x67>
+
+00800f87 <stat>:
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 08             	sub    $0x8,%esp
+  800f8f:	6a 00                	push   $0x0
+  800f91:	ff 75 08             	push   0x8(%ebp)
+  800f94:	e8 31 05 00 00       	call   8014ca <open>
+  800f99:	89 c3                	mov    %eax,%ebx
+  800f9b:	83 c4 10             	add    $0x10,%esp
+  800f9e:	85 c0                	test   %eax,%eax
+  800fa0:	78 1b                	js     800fbd <stat+0x36>
+  800fa2:	83 ec 08             	sub    $0x8,%esp
+  800fa5:	ff 75 0c             	push   0xc(%ebp)
+  800fa8:	50                   	push   %eax
+  800fa9:	e8 64 ff ff ff       	call   800f12 <fstat>
+  800fae:	89 c6                	mov    %eax,%esi
+  800fb0:	89 1c 24             	mov    %ebx,(%esp)
+  800fb3:	e8 19 fc ff ff       	call   800bd1 <close>
+  800fb8:	83 c4 10             	add    $0x10,%esp
+  800fbb:	89 f3                	mov    %esi,%ebx
+  800fbd:	89 d8                	mov    %ebx,%eax
+  800fbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc2:	5b                   	pop    %ebx
+  800fc3:	5e                   	pop    %esi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+
+00800fc6 <fsipc>:
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	89 c3                	mov    %eax,%ebx
+  800fcd:	89 d6                	mov    %edx,%esi
+  800fcf:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800fd6:	74 20                	je     800ff8 <fsipc+0x32>
+  800fd8:	83 ec 08             	sub    $0x8,%esp
+  800fdb:	6a 00                	push   $0x0
+  800fdd:	56                   	push   %esi
+  800fde:	6a 07                	push   $0x7
+  800fe0:	68 00 60 80 00       	push   $0x806000
+  800fe5:	53                   	push   %ebx
+  800fe6:	ff 35 08 50 80 00    	push   0x805008
+  800fec:	e8 a4 1d 00 00       	call   802d95 <ipc_call>
+  800ff1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+  800ff8:	83 ec 0c             	sub    $0xc,%esp
+  800ffb:	6a 02                	push   $0x2
+  800ffd:	e8 2e 1f 00 00       	call   802f30 <ipc_find_env>
+  801002:	a3 08 50 80 00       	mov    %eax,0x805008
+  801007:	83 c4 10             	add    $0x10,%esp
+  80100a:	eb cc                	jmp    800fd8 <fsipc+0x12>
+
+0080100c <devfile_trunc>:
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	83 ec 08             	sub    $0x8,%esp
+  801012:	8b 45 08             	mov    0x8(%ebp),%eax
+  801015:	8b 40 0c             	mov    0xc(%eax),%eax
+  801018:	a3 00 60 80 00       	mov    %eax,0x806000
+  80101d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801020:	a3 04 60 80 00       	mov    %eax,0x806004
+  801025:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80102f:	e8 92 ff ff ff       	call   800fc6 <fsipc>
+  801034:	c9                   	leave
+  801035:	c3                   	ret
+
+00801036 <devfile_flush>:
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	83 ec 08             	sub    $0x8,%esp
+  80103c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801042:	a3 00 60 80 00       	mov    %eax,0x806000
+  801047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801051:	e8 70 ff ff ff       	call   800fc6 <fsipc>
+  801056:	c9                   	leave
+  801057:	c3                   	ret
+
+00801058 <devfile_stat>:
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	53                   	push   %ebx
+  80105c:	83 ec 04             	sub    $0x4,%esp
+  80105f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801062:	8b 45 08             	mov    0x8(%ebp),%eax
+  801065:	8b 40 0c             	mov    0xc(%eax),%eax
+  801068:	a3 00 60 80 00       	mov    %eax,0x806000
+  80106d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801072:	b8 07 00 00 00       	mov    $0x7,%eax
+  801077:	e8 4a ff ff ff       	call   800fc6 <fsipc>
+  80107c:	85 c0                	test   %eax,%eax
+  80107e:	78 2c                	js     8010ac <devfile_stat+0x54>
+  801080:	83 ec 08             	sub    $0x8,%esp
+  801083:	68 00 60 80 00       	push   $0x806000
+  801088:	53                   	push   %ebx
+  801089:	e8 d7 18 00 00       	call   802965 <strcpy>
+  80108e:	a1 80 60 80 00       	mov    0x806080,%eax
+  801093:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801099:	a1 84 60 80 00       	mov    0x806084,%eax
+  80109e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8010a4:	83 c4 10             	add    $0x10,%esp
+  8010a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010af:	c9                   	leave
+  8010b0:	c3                   	ret
+
+008010b1 <fsring_rw>:
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 ec 2c             	sub    $0x2c,%esp
+  8010ba:	89 c7                	mov    %eax,%edi
+  8010bc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8010bf:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8010c2:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8010c7:	a8 01                	test   $0x1,%al
+  8010c9:	74 0d                	je     8010d8 <fsring_rw+0x27>
+  8010cb:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010d0:	a8 01                	test   $0x1,%al
+  8010d2:	0f 85 d5 00 00 00    	jne    8011ad <fsring_rw+0xfc>
+  8010d8:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010dd:	8b 40 48             	mov    0x48(%eax),%eax
+  8010e0:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010e6:	0f 84 fc 00 00 00    	je     8011e8 <fsring_rw+0x137>
+  8010ec:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010f3:	0f 84 02 01 00 00    	je     8011fb <fsring_rw+0x14a>
+  8010f9:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010fe:	83 ec 04             	sub    $0x4,%esp
+  801101:	68 07 02 00 00       	push   $0x207
+  801106:	53                   	push   %ebx
+  801107:	6a 00                	push   $0x0
+  801109:	e8 b8 f0 ff ff       	call   8001c6 <sys_page_alloc>
+  80110e:	83 c4 10             	add    $0x10,%esp
+  801111:	85 c0                	test   %eax,%eax
+  801113:	0f 88 f9 00 00 00    	js     801212 <fsring_rw+0x161>
+  801119:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80111f:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801125:	75 d7                	jne    8010fe <fsring_rw+0x4d>
+  801127:	6a 0e                	push   $0xe
+  801129:	6a 0d                	push   $0xd
+  80112b:	ff 35 08 50 80 00    	push   0x805008
+  801131:	68 00 00 f0 cf       	push   $0xcff00000
+  801136:	e8 c4 0c 00 00       	call   801dff <ipcring_init>
+  80113b:	83 c4 08             	add    $0x8,%esp
+  80113e:	6a 00                	push   $0x0
+  801140:	6a 00                	push   $0x0
+  801142:	68 07 02 00 00       	push   $0x207
+  801147:	68 00 00 f0 cf       	push   $0xcff00000
+  80114c:	6a 0b                	push   $0xb
+  80114e:	ff 35 08 50 80 00    	push   0x805008
+  801154:	e8 3c 1c 00 00       	call   802d95 <ipc_call>
+  801159:	89 c6                	mov    %eax,%esi
+  80115b:	83 c4 20             	add    $0x20,%esp
+  80115e:	85 c0                	test   %eax,%eax
+  801160:	0f 88 ac 00 00 00    	js     801212 <fsring_rw+0x161>
+  801166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116b:	89 d9                	mov    %ebx,%ecx
+  80116d:	83 c3 01             	add    $0x1,%ebx
+  801170:	89 da                	mov    %ebx,%edx
+  801172:	c1 e2 0c             	shl    $0xc,%edx
+  801175:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80117b:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801181:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801187:	83 ec 08             	sub    $0x8,%esp
+  80118a:	6a 00                	push   $0x0
+  80118c:	6a 00                	push   $0x0
+  80118e:	68 07 02 00 00       	push   $0x207
+  801193:	50                   	push   %eax
+  801194:	6a 0c                	push   $0xc
+  801196:	ff 35 08 50 80 00    	push   0x805008
+  80119c:	e8 f4 1b 00 00       	call   802d95 <ipc_call>
+  8011a1:	83 c4 20             	add    $0x20,%esp
+  8011a4:	85 c0                	test   %eax,%eax
+  8011a6:	78 6a                	js     801212 <fsring_rw+0x161>
+  8011a8:	83 fb 08             	cmp    $0x8,%ebx
+  8011ab:	75 be                	jne    80116b <fsring_rw+0xba>
+  8011ad:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8011b1:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8011b6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8011bb:	0f 45 c2             	cmovne %edx,%eax
+  8011be:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011c1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8011c8:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011cf:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011db:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e0:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011e3:	e9 4b 01 00 00       	jmp    801333 <fsring_rw+0x282>
+  8011e8:	e8 a3 f3 ff ff       	call   800590 <sys_time_msec>
+  8011ed:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011f3:	0f 89 f3 fe ff ff    	jns    8010ec <fsring_rw+0x3b>
+  8011f9:	eb 54                	jmp    80124f <fsring_rw+0x19e>
+  8011fb:	83 ec 0c             	sub    $0xc,%esp
+  8011fe:	6a 02                	push   $0x2
+  801200:	e8 2b 1d 00 00       	call   802f30 <ipc_find_env>
+  801205:	a3 08 50 80 00       	mov    %eax,0x805008
+  80120a:	83 c4 10             	add    $0x10,%esp
+  80120d:	e9 e7 fe ff ff       	jmp    8010f9 <fsring_rw+0x48>
+  801212:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801217:	83 ec 08             	sub    $0x8,%esp
+  80121a:	53                   	push   %ebx
+  80121b:	6a 00                	push   $0x0
+  80121d:	e8 76 f0 ff ff       	call   800298 <sys_page_unmap>
+  801222:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801228:	83 c4 10             	add    $0x10,%esp
+  80122b:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801231:	75 e4                	jne    801217 <fsring_rw+0x166>
+  801233:	e8 58 f3 ff ff       	call   800590 <sys_time_msec>
+  801238:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80123d:	a3 00 50 80 00       	mov    %eax,0x805000
+  801242:	a1 10 50 80 00       	mov    0x805010,%eax
+  801247:	8b 40 48             	mov    0x48(%eax),%eax
+  80124a:	a3 04 50 80 00       	mov    %eax,0x805004
+  80124f:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801256:	e9 7a 01 00 00       	jmp    8013d5 <fsring_rw+0x324>
+  80125b:	8b 57 0c             	mov    0xc(%edi),%edx
+  80125e:	89 10                	mov    %edx,(%eax)
+  801260:	89 58 04             	mov    %ebx,0x4(%eax)
+  801263:	89 f2                	mov    %esi,%edx
+  801265:	03 57 04             	add    0x4(%edi),%edx
+  801268:	89 50 08             	mov    %edx,0x8(%eax)
+  80126b:	83 ec 04             	sub    $0x4,%esp
+  80126e:	53                   	push   %ebx
+  80126f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801272:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801275:	52                   	push   %edx
+  801276:	83 c0 0c             	add    $0xc,%eax
+  801279:	50                   	push   %eax
+  80127a:	e8 96 18 00 00       	call   802b15 <memmove>
+  80127f:	83 c4 10             	add    $0x10,%esp
+  801282:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801285:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801288:	89 08                	mov    %ecx,(%eax)
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+  80128d:	68 00 00 f0 cf       	push   $0xcff00000
+  801292:	e8 c6 0b 00 00       	call   801e5d <ipcring_req_push>
+  801297:	01 de                	add    %ebx,%esi
+  801299:	83 c4 10             	add    $0x10,%esp
+  80129c:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80129f:	73 4c                	jae    8012ed <fsring_rw+0x23c>
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	68 00 00 f0 cf       	push   $0xcff00000
+  8012a9:	e8 89 0b 00 00       	call   801e37 <ipcring_req_slot>
+  8012ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012b1:	83 c4 10             	add    $0x10,%esp
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	74 35                	je     8012ed <fsring_rw+0x23c>
+  8012b8:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8012bd:	83 e0 07             	and    $0x7,%eax
+  8012c0:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8012c5:	c1 e0 0c             	shl    $0xc,%eax
+  8012c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012cb:	29 f3                	sub    %esi,%ebx
+  8012cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012d0:	39 cb                	cmp    %ecx,%ebx
+  8012d2:	0f 47 d9             	cmova  %ecx,%ebx
+  8012d5:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012d9:	75 80                	jne    80125b <fsring_rw+0x1aa>
+  8012db:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012de:	89 10                	mov    %edx,(%eax)
+  8012e0:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012e3:	89 f2                	mov    %esi,%edx
+  8012e5:	03 57 04             	add    0x4(%edi),%edx
+  8012e8:	89 50 08             	mov    %edx,0x8(%eax)
+  8012eb:	eb 95                	jmp    801282 <fsring_rw+0x1d1>
+  8012ed:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012f5:	83 ec 0c             	sub    $0xc,%esp
+  8012f8:	68 00 00 f0 cf       	push   $0xcff00000
+  8012fd:	e8 94 0b 00 00       	call   801e96 <ipcring_rsp_wait>
+  801302:	8b 58 04             	mov    0x4(%eax),%ebx
+  801305:	83 c4 10             	add    $0x10,%esp
+  801308:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80130c:	75 45                	jne    801353 <fsring_rw+0x2a2>
+  80130e:	85 db                	test   %ebx,%ebx
+  801310:	79 41                	jns    801353 <fsring_rw+0x2a2>
+  801312:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801315:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80131c:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	68 00 00 f0 cf       	push   $0xcff00000
+  80132b:	e8 cc 0b 00 00       	call   801efc <ipcring_rsp_pop>
+  801330:	83 c4 10             	add    $0x10,%esp
+  801333:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801339:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80133e:	39 c2                	cmp    %eax,%edx
+  801340:	74 75                	je     8013b7 <fsring_rw+0x306>
+  801342:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801346:	75 a5                	jne    8012ed <fsring_rw+0x23c>
+  801348:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80134b:	0f 82 50 ff ff ff    	jb     8012a1 <fsring_rw+0x1f0>
+  801351:	eb 9a                	jmp    8012ed <fsring_rw+0x23c>
+  801353:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801357:	75 ca                	jne    801323 <fsring_rw+0x272>
+  801359:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80135d:	74 31                	je     801390 <fsring_rw+0x2df>
+  80135f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801362:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801365:	29 c8                	sub    %ecx,%eax
+  801367:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80136a:	39 d0                	cmp    %edx,%eax
+  80136c:	0f 47 c2             	cmova  %edx,%eax
+  80136f:	39 d8                	cmp    %ebx,%eax
+  801371:	ba 01 00 00 00       	mov    $0x1,%edx
+  801376:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80137a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80137d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801382:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801386:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801389:	01 d9                	add    %ebx,%ecx
+  80138b:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80138e:	eb 93                	jmp    801323 <fsring_rw+0x272>
+  801390:	83 ec 04             	sub    $0x4,%esp
+  801393:	53                   	push   %ebx
+  801394:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801397:	83 e0 07             	and    $0x7,%eax
+  80139a:	c1 e0 0c             	shl    $0xc,%eax
+  80139d:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8013a3:	50                   	push   %eax
+  8013a4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8013a7:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8013aa:	01 c8                	add    %ecx,%eax
+  8013ac:	50                   	push   %eax
+  8013ad:	e8 63 17 00 00       	call   802b15 <memmove>
+  8013b2:	83 c4 10             	add    $0x10,%esp
+  8013b5:	eb a8                	jmp    80135f <fsring_rw+0x2ae>
+  8013b7:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8013bb:	75 09                	jne    8013c6 <fsring_rw+0x315>
+  8013bd:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8013c0:	0f 82 db fe ff ff    	jb     8012a1 <fsring_rw+0x1f0>
+  8013c6:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8013c9:	01 57 04             	add    %edx,0x4(%edi)
+  8013cc:	85 d2                	test   %edx,%edx
+  8013ce:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013d2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+
+008013e0 <devfile_write>:
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	57                   	push   %edi
+  8013e4:	56                   	push   %esi
+  8013e5:	53                   	push   %ebx
+  8013e6:	83 ec 0c             	sub    $0xc,%esp
+  8013e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f2:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013f8:	76 1a                	jbe    801414 <devfile_write+0x34>
+  8013fa:	83 ec 0c             	sub    $0xc,%esp
+  8013fd:	53                   	push   %ebx
+  8013fe:	89 f1                	mov    %esi,%ecx
+  801400:	ba 06 00 00 00       	mov    $0x6,%edx
+  801405:	89 f8                	mov    %edi,%eax
+  801407:	e8 a5 fc ff ff       	call   8010b1 <fsring_rw>
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801412:	75 39                	jne    80144d <devfile_write+0x6d>
+  801414:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801419:	39 c3                	cmp    %eax,%ebx
+  80141b:	0f 47 d8             	cmova  %eax,%ebx
+  80141e:	8b 47 0c             	mov    0xc(%edi),%eax
+  801421:	a3 00 60 80 00       	mov    %eax,0x806000
+  801426:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80142c:	83 ec 04             	sub    $0x4,%esp
+  80142f:	53                   	push   %ebx
+  801430:	56                   	push   %esi
+  801431:	68 08 60 80 00       	push   $0x806008
+  801436:	e8 da 16 00 00       	call   802b15 <memmove>
+  80143b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801440:	b8 04 00 00 00       	mov    $0x4,%eax
+  801445:	e8 7c fb ff ff       	call   800fc6 <fsipc>
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+
+00801455 <devfile_read>:
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	57                   	push   %edi
+  801459:	56                   	push   %esi
+  80145a:	53                   	push   %ebx
+  80145b:	83 ec 0c             	sub    $0xc,%esp
+  80145e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801461:	8b 75 10             	mov    0x10(%ebp),%esi
+  801464:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80146a:	76 1d                	jbe    801489 <devfile_read+0x34>
+  80146c:	83 ec 0c             	sub    $0xc,%esp
+  80146f:	56                   	push   %esi
+  801470:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801473:	ba 05 00 00 00       	mov    $0x5,%edx
+  801478:	89 f8                	mov    %edi,%eax
+  80147a:	e8 32 fc ff ff       	call   8010b1 <fsring_rw>
+  80147f:	89 c3                	mov    %eax,%ebx
+  801481:	83 c4 10             	add    $0x10,%esp
+  801484:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801487:	75 37                	jne    8014c0 <devfile_read+0x6b>
+  801489:	8b 47 0c             	mov    0xc(%edi),%eax
+  80148c:	a3 00 60 80 00       	mov    %eax,0x806000
+  801491:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149c:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014a1:	e8 20 fb ff ff       	call   800fc6 <fsipc>
+  8014a6:	89 c3                	mov    %eax,%ebx
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	78 14                	js     8014c0 <devfile_read+0x6b>
+  8014ac:	83 ec 04             	sub    $0x4,%esp
+  8014af:	50                   	push   %eax
+  8014b0:	68 00 60 80 00       	push   $0x806000
+  8014b5:	ff 75 0c             	push   0xc(%ebp)
+  8014b8:	e8 58 16 00 00       	call   802b15 <memmove>
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  8014c0:	89 d8                	mov    %ebx,%eax
+  8014c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+
+008014ca <open>:
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	56                   	push   %esi
+  8014ce:	53                   	push   %ebx
+  8014cf:	83 ec 1c             	sub    $0x1c,%esp
+  8014d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014d5:	56                   	push   %esi
+  8014d6:	e8 3e 14 00 00       	call   802919 <strlen>
+  8014db:	83 c4 10             	add    $0x10,%esp
+  8014de:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014e3:	7f 6c                	jg     801551 <open+0x87>
+  8014e5:	83 ec 0c             	sub    $0xc,%esp
+  8014e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014eb:	50                   	push   %eax
+  8014ec:	e8 6a f5 ff ff       	call   800a5b <fd_alloc>
+  8014f1:	89 c3                	mov    %eax,%ebx
+  8014f3:	83 c4 10             	add    $0x10,%esp
+  8014f6:	85 c0                	test   %eax,%eax
+  8014f8:	78 3c                	js     801536 <open+0x6c>
+  8014fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014fd:	a3 00 64 80 00       	mov    %eax,0x806400
+  801502:	83 ec 08             	sub    $0x8,%esp
+  801505:	56                   	push   %esi
+  801506:	68 00 60 80 00       	push   $0x806000
+  80150b:	e8 55 14 00 00       	call   802965 <strcpy>
+  801510:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801513:	b8 01 00 00 00       	mov    $0x1,%eax
+  801518:	e8 a9 fa ff ff       	call   800fc6 <fsipc>
+  80151d:	89 c3                	mov    %eax,%ebx
+  80151f:	83 c4 10             	add    $0x10,%esp
+  801522:	85 c0                	test   %eax,%eax
+  801524:	78 19                	js     80153f <open+0x75>
+  801526:	83 ec 0c             	sub    $0xc,%esp
+  801529:	ff 75 f4             	push   -0xc(%ebp)
+  80152c:	e8 03 f5 ff ff       	call   800a34 <fd2num>
+  801531:	89 c3                	mov    %eax,%ebx
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	89 d8                	mov    %ebx,%eax
+  801538:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5d                   	pop    %ebp
+  80153e:	c3                   	ret
+  80153f:	83 ec 08             	sub    $0x8,%esp
+  801542:	6a 00                	push   $0x0
+  801544:	ff 75 f4             	push   -0xc(%ebp)
+  801547:	e8 05 f6 ff ff       	call   800b51 <fd_close>
+  80154c:	83 c4 10             	add    $0x10,%esp
+  80154f:	eb e5                	jmp    801536 <open+0x6c>
+  801551:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801556:	eb de                	jmp    801536 <open+0x6c>
+
+00801558 <file_image>:
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	53                   	push   %ebx
+  80155c:	83 ec 1c             	sub    $0x1c,%esp
+  80155f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801562:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801565:	50                   	push   %eax
+  801566:	ff 75 08             	push   0x8(%ebp)
+  801569:	e8 3d f5 ff ff       	call   800aab <fd_lookup>
+  80156e:	83 c4 10             	add    $0x10,%esp
+  801571:	85 c0                	test   %eax,%eax
+  801573:	78 58                	js     8015cd <file_image+0x75>
+  801575:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801578:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80157e:	39 08                	cmp    %ecx,(%eax)
+  801580:	75 50                	jne    8015d2 <file_image+0x7a>
+  801582:	83 fb 04             	cmp    $0x4,%ebx
+  801585:	77 52                	ja     8015d9 <file_image+0x81>
+  801587:	8b 40 0c             	mov    0xc(%eax),%eax
+  80158a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80158f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801595:	83 ec 04             	sub    $0x4,%esp
+  801598:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80159b:	c1 e0 02             	shl    $0x2,%eax
+  80159e:	50                   	push   %eax
+  80159f:	ff 75 0c             	push   0xc(%ebp)
+  8015a2:	68 08 60 80 00       	push   $0x806008
+  8015a7:	e8 69 15 00 00       	call   802b15 <memmove>
+  8015ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015b6:	e8 0b fa ff ff       	call   800fc6 <fsipc>
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	78 0b                	js     8015cd <file_image+0x75>
+  8015c2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8015c5:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8015cb:	89 0a                	mov    %ecx,(%edx)
+  8015cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+  8015d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015d7:	eb f4                	jmp    8015cd <file_image+0x75>
+  8015d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015de:	eb ed                	jmp    8015cd <file_image+0x75>
+
+008015e0 <remove>:
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	53                   	push   %ebx
+  8015e4:	83 ec 10             	sub    $0x10,%esp
+  8015e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015ea:	53                   	push   %ebx
+  8015eb:	e8 29 13 00 00       	call   802919 <strlen>
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015f8:	7f 25                	jg     80161f <remove+0x3f>
+  8015fa:	83 ec 08             	sub    $0x8,%esp
+  8015fd:	53                   	push   %ebx
+  8015fe:	68 00 60 80 00       	push   $0x806000
+  801603:	e8 5d 13 00 00       	call   802965 <strcpy>
+  801608:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801612:	e8 af f9 ff ff       	call   800fc6 <fsipc>
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+  80161f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801624:	eb f4                	jmp    80161a <remove+0x3a>
+
+00801626 <sync>:
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  801629:	83 ec 08             	sub    $0x8,%esp
+  80162c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801631:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801636:	e8 8b f9 ff ff       	call   800fc6 <fsipc>
+  80163b:	c9                   	leave
+  80163c:	c3                   	ret
+
+0080163d <devsock_stat>:
+  80163d:	55                   	push   %ebp
+  80163e:	89 e5                	mov    %esp,%ebp
+  801640:	83 ec 10             	sub    $0x10,%esp
+  801643:	68 68 32 80 00       	push   $0x803268
+  801648:	ff 75 0c             	push   0xc(%ebp)
+  80164b:	e8 15 13 00 00       	call   802965 <strcpy>
+  801650:	b8 00 00 00 00       	mov    $0x0,%eax
+  801655:	c9                   	leave
+  801656:	c3                   	ret
+
+00801657 <devsock_close>:
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	53                   	push   %ebx
+  80165b:	83 ec 10             	sub    $0x10,%esp
+  80165e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801661:	53                   	push   %ebx
+  801662:	e8 e3 18 00 00       	call   802f4a <pageref>
+  801667:	89 c2                	mov    %eax,%edx
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801671:	83 fa 01             	cmp    $0x1,%edx
+  801674:	74 05                	je     80167b <devsock_close+0x24>
+  801676:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801679:	c9                   	leave
+  80167a:	c3                   	ret
+  80167b:	83 ec 0c             	sub    $0xc,%esp
+  80167e:	ff 73 0c             	push   0xc(%ebx)
+  801681:	e8 aa 02 00 00       	call   801930 <nsipc_close>
+  801686:	83 c4 10             	add    $0x10,%esp
+  801689:	eb eb                	jmp    801676 <devsock_close+0x1f>
+
+0080168b <devsock_write>:
+  80168b:	55                   	push   %ebp
+  80168c:	89 e5                	mov    %esp,%ebp
+  80168e:	83 ec 08             	sub    $0x8,%esp
+  801691:	6a 00                	push   $0x0
+  801693:	ff 75 10             	push   0x10(%ebp)
+  801696:	ff 75 0c             	push   0xc(%ebp)
+  801699:	8b 45 08             	mov    0x8(%ebp),%eax
+  80169c:	ff 70 0c             	push   0xc(%eax)
+  80169f:	e8 6c 03 00 00       	call   801a10 <nsipc_send>
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+008016a6 <devsock_read>:
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	83 ec 08             	sub    $0x8,%esp
+  8016ac:	6a 00                	push   $0x0
+  8016ae:	ff 75 10             	push   0x10(%ebp)
+  8016b1:	ff 75 0c             	push   0xc(%ebp)
+  8016b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016b7:	ff 70 0c             	push   0xc(%eax)
+  8016ba:	e8 e2 02 00 00       	call   8019a1 <nsipc_recv>
+  8016bf:	c9                   	leave
+  8016c0:	c3                   	ret
+
+008016c1 <fd2sockid>:
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	83 ec 20             	sub    $0x20,%esp
+  8016c7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016ca:	52                   	push   %edx
+  8016cb:	50                   	push   %eax
+  8016cc:	e8 da f3 ff ff       	call   800aab <fd_lookup>
+  8016d1:	83 c4 10             	add    $0x10,%esp
+  8016d4:	85 c0                	test   %eax,%eax
+  8016d6:	78 10                	js     8016e8 <fd2sockid+0x27>
+  8016d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016db:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016e1:	39 08                	cmp    %ecx,(%eax)
+  8016e3:	75 05                	jne    8016ea <fd2sockid+0x29>
+  8016e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+  8016ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ef:	eb f7                	jmp    8016e8 <fd2sockid+0x27>
+
+008016f1 <alloc_sockfd>:
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	56                   	push   %esi
+  8016f5:	53                   	push   %ebx
+  8016f6:	83 ec 1c             	sub    $0x1c,%esp
+  8016f9:	89 c6                	mov    %eax,%esi
+  8016fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016fe:	50                   	push   %eax
+  8016ff:	e8 57 f3 ff ff       	call   800a5b <fd_alloc>
+  801704:	89 c3                	mov    %eax,%ebx
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	78 43                	js     801750 <alloc_sockfd+0x5f>
+  80170d:	83 ec 04             	sub    $0x4,%esp
+  801710:	68 07 04 00 00       	push   $0x407
+  801715:	ff 75 f4             	push   -0xc(%ebp)
+  801718:	6a 00                	push   $0x0
+  80171a:	e8 a7 ea ff ff       	call   8001c6 <sys_page_alloc>
+  80171f:	89 c3                	mov    %eax,%ebx
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 28                	js     801750 <alloc_sockfd+0x5f>
+  801728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801731:	89 10                	mov    %edx,(%eax)
+  801733:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801736:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80173d:	89 70 0c             	mov    %esi,0xc(%eax)
+  801740:	83 ec 0c             	sub    $0xc,%esp
+  801743:	50                   	push   %eax
+  801744:	e8 eb f2 ff ff       	call   800a34 <fd2num>
+  801749:	89 c3                	mov    %eax,%ebx
+  80174b:	83 c4 10             	add    $0x10,%esp
+  80174e:	eb 0c                	jmp    80175c <alloc_sockfd+0x6b>
+  801750:	83 ec 0c             	sub    $0xc,%esp
+  801753:	56                   	push   %esi
+  801754:	e8 d7 01 00 00       	call   801930 <nsipc_close>
+  801759:	83 c4 10             	add    $0x10,%esp
+  80175c:	89 d8                	mov    %ebx,%eax
+  80175e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801761:	5b                   	pop    %ebx
+  801762:	5e                   	pop    %esi
+  801763:	5d                   	pop    %ebp
+  801764:	c3                   	ret
+
+00801765 <accept>:
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+  801768:	83 ec 08             	sub    $0x8,%esp
+  80176b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176e:	e8 4e ff ff ff       	call   8016c1 <fd2sockid>
+  801773:	85 c0                	test   %eax,%eax
+  801775:	78 1b                	js     801792 <accept+0x2d>
+  801777:	83 ec 04             	sub    $0x4,%esp
+  80177a:	ff 75 10             	push   0x10(%ebp)
+  80177d:	ff 75 0c             	push   0xc(%ebp)
+  801780:	50                   	push   %eax
+  801781:	e8 07 01 00 00       	call   80188d <nsipc_accept>
+  801786:	83 c4 10             	add    $0x10,%esp
+  801789:	85 c0                	test   %eax,%eax
+  80178b:	78 05                	js     801792 <accept+0x2d>
+  80178d:	e8 5f ff ff ff       	call   8016f1 <alloc_sockfd>
+  801792:	c9                   	leave
+  801793:	c3                   	ret
+
+00801794 <bind>:
+  801794:	55                   	push   %ebp
+  801795:	89 e5                	mov    %esp,%ebp
+  801797:	83 ec 08             	sub    $0x8,%esp
+  80179a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179d:	e8 1f ff ff ff       	call   8016c1 <fd2sockid>
+  8017a2:	85 c0                	test   %eax,%eax
+  8017a4:	78 12                	js     8017b8 <bind+0x24>
+  8017a6:	83 ec 04             	sub    $0x4,%esp
+  8017a9:	ff 75 10             	push   0x10(%ebp)
+  8017ac:	ff 75 0c             	push   0xc(%ebp)
+  8017af:	50                   	push   %eax
+  8017b0:	e8 24 01 00 00       	call   8018d9 <nsipc_bind>
+  8017b5:	83 c4 10             	add    $0x10,%esp
+  8017b8:	c9                   	leave
+  8017b9:	c3                   	ret
+
+008017ba <shutdown>:
+  8017ba:	55                   	push   %ebp
+  8017bb:	89 e5                	mov    %esp,%ebp
+  8017bd:	83 ec 08             	sub    $0x8,%esp
+  8017c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c3:	e8 f9 fe ff ff       	call   8016c1 <fd2sockid>
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	78 0f                	js     8017db <shutdown+0x21>
+  8017cc:	83 ec 08             	sub    $0x8,%esp
+  8017cf:	ff 75 0c             	push   0xc(%ebp)
+  8017d2:	50                   	push   %eax
+  8017d3:	e8 36 01 00 00       	call   80190e <nsipc_shutdown>
+  8017d8:	83 c4 10             	add    $0x10,%esp
+  8017db:	c9                   	leave
+  8017dc:	c3                   	ret
+
+008017dd <connect>:
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	83 ec 08             	sub    $0x8,%esp
+  8017e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e6:	e8 d6 fe ff ff       	call   8016c1 <fd2sockid>
+  8017eb:	85 c0                	test   %eax,%eax
+  8017ed:	78 12                	js     801801 <connect+0x24>
+  8017ef:	83 ec 04             	sub    $0x4,%esp
+  8017f2:	ff 75 10             	push   0x10(%ebp)
+  8017f5:	ff 75 0c             	push   0xc(%ebp)
+  8017f8:	50                   	push   %eax
+  8017f9:	e8 4c 01 00 00       	call   80194a <nsipc_connect>
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	c9                   	leave
+  801802:	c3                   	ret
+
+00801803 <listen>:
+  801803:	55                   	push   %ebp
+  801804:	89 e5                	mov    %esp,%ebp
+  801806:	83 ec 08             	sub    $0x8,%esp
+  801809:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180c:	e8 b0 fe ff ff       	call   8016c1 <fd2sockid>
+  801811:	85 c0                	test   %eax,%eax
+  801813:	78 0f                	js     801824 <listen+0x21>
+  801815:	83 ec 08             	sub    $0x8,%esp
+  801818:	ff 75 0c             	push   0xc(%ebp)
+  80181b:	50                   	push   %eax
+  80181c:	e8 5e 01 00 00       	call   80197f <nsipc_listen>
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	c9                   	leave
+  801825:	c3                   	ret
+
+00801826 <socket>:
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	83 ec 0c             	sub    $0xc,%esp
+  80182c:	ff 75 10             	push   0x10(%ebp)
+  80182f:	ff 75 0c             	push   0xc(%ebp)
+  801832:	ff 75 08             	push   0x8(%ebp)
+  801835:	e8 34 02 00 00       	call   801a6e <nsipc_socket>
+  80183a:	83 c4 10             	add    $0x10,%esp
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	78 05                	js     801846 <socket+0x20>
+  801841:	e8 ab fe ff ff       	call   8016f1 <alloc_sockfd>
+  801846:	c9                   	leave
+  801847:	c3                   	ret
+
+00801848 <nsipc>:
+  801848:	55                   	push   %ebp
+  801849:	89 e5                	mov    %esp,%ebp
+  80184b:	53                   	push   %ebx
+  80184c:	83 ec 04             	sub    $0x4,%esp
+  80184f:	89 c3                	mov    %eax,%ebx
+  801851:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801858:	74 1f                	je     801879 <nsipc+0x31>
+  80185a:	83 ec 08             	sub    $0x8,%esp
+  80185d:	6a 00                	push   $0x0
+  80185f:	6a 00                	push   $0x0
+  801861:	6a 07                	push   $0x7
+  801863:	68 00 70 80 00       	push   $0x807000
+  801868:	53                   	push   %ebx
+  801869:	ff 35 0c 50 80 00    	push   0x80500c
+  80186f:	e8 21 15 00 00       	call   802d95 <ipc_call>
+  801874:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801877:	c9                   	leave
+  801878:	c3                   	ret
+  801879:	83 ec 0c             	sub    $0xc,%esp
+  80187c:	6a 03                	push   $0x3
+  80187e:	e8 ad 16 00 00       	call   802f30 <ipc_find_env>
+  801883:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801888:	83 c4 10             	add    $0x10,%esp
+  80188b:	eb cd                	jmp    80185a <nsipc+0x12>
+
+0080188d <nsipc_accept>:
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	53                   	push   %ebx
+  801891:	83 ec 04             	sub    $0x4,%esp
+  801894:	8b 45 08             	mov    0x8(%ebp),%eax
+  801897:	a3 00 70 80 00       	mov    %eax,0x807000
+  80189c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018a1:	e8 a2 ff ff ff       	call   801848 <nsipc>
+  8018a6:	89 c3                	mov    %eax,%ebx
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	79 07                	jns    8018b3 <nsipc_accept+0x26>
+  8018ac:	89 d8                	mov    %ebx,%eax
+  8018ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b1:	c9                   	leave
+  8018b2:	c3                   	ret
+  8018b3:	83 ec 04             	sub    $0x4,%esp
+  8018b6:	ff 35 10 70 80 00    	push   0x807010
+  8018bc:	68 00 70 80 00       	push   $0x807000
+  8018c1:	ff 75 0c             	push   0xc(%ebp)
+  8018c4:	e8 4c 12 00 00       	call   802b15 <memmove>
+  8018c9:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018cf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018d2:	89 10                	mov    %edx,(%eax)
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	eb d3                	jmp    8018ac <nsipc_accept+0x1f>
+
+008018d9 <nsipc_bind>:
+  8018d9:	55                   	push   %ebp
+  8018da:	89 e5                	mov    %esp,%ebp
+  8018dc:	53                   	push   %ebx
+  8018dd:	83 ec 08             	sub    $0x8,%esp
+  8018e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018eb:	53                   	push   %ebx
+  8018ec:	ff 75 0c             	push   0xc(%ebp)
+  8018ef:	68 04 70 80 00       	push   $0x807004
+  8018f4:	e8 1c 12 00 00       	call   802b15 <memmove>
+  8018f9:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018ff:	b8 02 00 00 00       	mov    $0x2,%eax
+  801904:	e8 3f ff ff ff       	call   801848 <nsipc>
+  801909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190c:	c9                   	leave
+  80190d:	c3                   	ret
+
+0080190e <nsipc_shutdown>:
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	83 ec 08             	sub    $0x8,%esp
+  801914:	8b 45 08             	mov    0x8(%ebp),%eax
+  801917:	a3 00 70 80 00       	mov    %eax,0x807000
+  80191c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80191f:	a3 04 70 80 00       	mov    %eax,0x807004
+  801924:	b8 03 00 00 00       	mov    $0x3,%eax
+  801929:	e8 1a ff ff ff       	call   801848 <nsipc>
+  80192e:	c9                   	leave
+  80192f:	c3                   	ret
+
+00801930 <nsipc_close>:
+  801930:	55                   	push   %ebp
+  801931:	89 e5                	mov    %esp,%ebp
+  801933:	83 ec 08             	sub    $0x8,%esp
+  801936:	8b 45 08             	mov    0x8(%ebp),%eax
+  801939:	a3 00 70 80 00       	mov    %eax,0x807000
+  80193e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801943:	e8 00 ff ff ff       	call   801848 <nsipc>
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+0080194a <nsipc_connect>:
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	53                   	push   %ebx
+  80194e:	83 ec 08             	sub    $0x8,%esp
+  801951:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801954:	8b 45 08             	mov    0x8(%ebp),%eax
+  801957:	a3 00 70 80 00       	mov    %eax,0x807000
+  80195c:	53                   	push   %ebx
+  80195d:	ff 75 0c             	push   0xc(%ebp)
+  801960:	68 04 70 80 00       	push   $0x807004
+  801965:	e8 ab 11 00 00       	call   802b15 <memmove>
+  80196a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801970:	b8 05 00 00 00       	mov    $0x5,%eax
+  801975:	e8 ce fe ff ff       	call   801848 <nsipc>
+  80197a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80197d:	c9                   	leave
+  80197e:	c3                   	ret
+
+0080197f <nsipc_listen>:
+  80197f:	55                   	push   %ebp
+  801980:	89 e5                	mov    %esp,%ebp
+  801982:	83 ec 08             	sub    $0x8,%esp
+  801985:	8b 45 08             	mov    0x8(%ebp),%eax
+  801988:	a3 00 70 80 00       	mov    %eax,0x807000
+  80198d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801990:	a3 04 70 80 00       	mov    %eax,0x807004
+  801995:	b8 06 00 00 00       	mov    $0x6,%eax
+  80199a:	e8 a9 fe ff ff       	call   801848 <nsipc>
+  80199f:	c9                   	leave
+  8019a0:	c3                   	ret
+
+008019a1 <nsipc_recv>:
+  8019a1:	55                   	push   %ebp
+  8019a2:	89 e5                	mov    %esp,%ebp
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+  8019a6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ac:	a3 00 70 80 00       	mov    %eax,0x807000
+  8019b1:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8019b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019ba:	a3 08 70 80 00       	mov    %eax,0x807008
+  8019bf:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019c4:	e8 7f fe ff ff       	call   801848 <nsipc>
+  8019c9:	89 c3                	mov    %eax,%ebx
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	78 22                	js     8019f1 <nsipc_recv+0x50>
+  8019cf:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019d4:	39 c6                	cmp    %eax,%esi
+  8019d6:	0f 4e c6             	cmovle %esi,%eax
+  8019d9:	39 c3                	cmp    %eax,%ebx
+  8019db:	7f 1d                	jg     8019fa <nsipc_recv+0x59>
+  8019dd:	83 ec 04             	sub    $0x4,%esp
+  8019e0:	53                   	push   %ebx
+  8019e1:	68 00 70 80 00       	push   $0x807000
+  8019e6:	ff 75 0c             	push   0xc(%ebp)
+  8019e9:	e8 27 11 00 00       	call   802b15 <memmove>
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	89 d8                	mov    %ebx,%eax
+  8019f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f6:	5b                   	pop    %ebx
+  8019f7:	5e                   	pop    %esi
+  8019f8:	5d                   	pop    %ebp
+  8019f9:	c3                   	ret
+  8019fa:	68 74 32 80 00       	push   $0x803274
+  8019ff:	68 89 32 80 00       	push   $0x803289
+  801a04:	6a 60                	push   $0x60
+  801a06:	68 9e 32 80 00       	push   $0x80329e
+  801a0b:	e8 83 07 00 00       	call   802193 <_panic>
+
+00801a10 <nsipc_send>:
+  801a10:	55                   	push   %ebp
+  801a11:	89 e5                	mov    %esp,%ebp
+  801a13:	53                   	push   %ebx
+  801a14:	83 ec 04             	sub    $0x4,%esp
+  801a17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1d:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a22:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a28:	7f 2e                	jg     801a58 <nsipc_send+0x48>
+  801a2a:	83 ec 04             	sub    $0x4,%esp
+  801a2d:	53                   	push   %ebx
+  801a2e:	ff 75 0c             	push   0xc(%ebp)
+  801a31:	68 0c 70 80 00       	push   $0x80700c
+  801a36:	e8 da 10 00 00       	call   802b15 <memmove>
+  801a3b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a41:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a44:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a49:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a4e:	e8 f5 fd ff ff       	call   801848 <nsipc>
+  801a53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a56:	c9                   	leave
+  801a57:	c3                   	ret
+  801a58:	68 aa 32 80 00       	push   $0x8032aa
+  801a5d:	68 89 32 80 00       	push   $0x803289
+  801a62:	6a 6b                	push   $0x6b
+  801a64:	68 9e 32 80 00       	push   $0x80329e
+  801a69:	e8 25 07 00 00       	call   802193 <_panic>
+
+00801a6e <nsipc_socket>:
+  801a6e:	55                   	push   %ebp
+  801a6f:	89 e5                	mov    %esp,%ebp
+  801a71:	83 ec 08             	sub    $0x8,%esp
+  801a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a77:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a7f:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a84:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a87:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a8c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a91:	e8 b2 fd ff ff       	call   801848 <nsipc>
+  801a96:	c9                   	leave
+  801a97:	c3                   	ret
+
+00801a98 <devpipe_stat>:
+  801a98:	55                   	push   %ebp
+  801a99:	89 e5                	mov    %esp,%ebp
+  801a9b:	56                   	push   %esi
+  801a9c:	53                   	push   %ebx
+  801a9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801aa0:	83 ec 0c             	sub    $0xc,%esp
+  801aa3:	ff 75 08             	push   0x8(%ebp)
+  801aa6:	e8 99 ef ff ff       	call   800a44 <fd2data>
+  801aab:	89 c6                	mov    %eax,%esi
+  801aad:	83 c4 08             	add    $0x8,%esp
+  801ab0:	68 b6 32 80 00       	push   $0x8032b6
+  801ab5:	53                   	push   %ebx
+  801ab6:	e8 aa 0e 00 00       	call   802965 <strcpy>
+  801abb:	8b 46 04             	mov    0x4(%esi),%eax
+  801abe:	2b 06                	sub    (%esi),%eax
+  801ac0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801ac6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801acd:	00 00 00 
+  801ad0:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801ad7:	40 80 00 
+  801ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  801adf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae2:	5b                   	pop    %ebx
+  801ae3:	5e                   	pop    %esi
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+
+00801ae6 <devpipe_close>:
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	53                   	push   %ebx
+  801aea:	83 ec 0c             	sub    $0xc,%esp
+  801aed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801af0:	53                   	push   %ebx
+  801af1:	6a 00                	push   $0x0
+  801af3:	e8 a0 e7 ff ff       	call   800298 <sys_page_unmap>
+  801af8:	89 1c 24             	mov    %ebx,(%esp)
+  801afb:	e8 44 ef ff ff       	call   800a44 <fd2data>
+  801b00:	83 c4 08             	add    $0x8,%esp
+  801b03:	50                   	push   %eax
+  801b04:	6a 00                	push   $0x0
+  801b06:	e8 8d e7 ff ff       	call   800298 <sys_page_unmap>
+  801b0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+
+00801b10 <_pipeisclosed>:
+  801b10:	55                   	push   %ebp
+  801b11:	89 e5                	mov    %esp,%ebp
+  801b13:	57                   	push   %edi
+  801b14:	56                   	push   %esi
+  801b15:	53                   	push   %ebx
+  801b16:	83 ec 1c             	sub    $0x1c,%esp
+  801b19:	89 c7                	mov    %eax,%edi
+  801b1b:	89 d6                	mov    %edx,%esi
+  801b1d:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b22:	8b 58 58             	mov    0x58(%eax),%ebx
+  801b25:	83 ec 0c             	sub    $0xc,%esp
+  801b28:	57                   	push   %edi
+  801b29:	e8 1c 14 00 00       	call   802f4a <pageref>
+  801b2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b31:	89 34 24             	mov    %esi,(%esp)
+  801b34:	e8 11 14 00 00       	call   802f4a <pageref>
+  801b39:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b3f:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	39 cb                	cmp    %ecx,%ebx
+  801b47:	74 1b                	je     801b64 <_pipeisclosed+0x54>
+  801b49:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b4c:	75 cf                	jne    801b1d <_pipeisclosed+0xd>
+  801b4e:	8b 42 58             	mov    0x58(%edx),%eax
+  801b51:	6a 01                	push   $0x1
+  801b53:	50                   	push   %eax
+  801b54:	53                   	push   %ebx
+  801b55:	68 bd 32 80 00       	push   $0x8032bd
+  801b5a:	e8 0f 07 00 00       	call   80226e <cprintf>
+  801b5f:	83 c4 10             	add    $0x10,%esp
+  801b62:	eb b9                	jmp    801b1d <_pipeisclosed+0xd>
+  801b64:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b67:	0f 94 c0             	sete   %al
+  801b6a:	0f b6 c0             	movzbl %al,%eax
+  801b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b70:	5b                   	pop    %ebx
+  801b71:	5e                   	pop    %esi
+  801b72:	5f                   	pop    %edi
+  801b73:	5d                   	pop    %ebp
+  801b74:	c3                   	ret
+
+00801b75 <devpipe_write>:
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	57                   	push   %edi
+  801b79:	56                   	push   %esi
+  801b7a:	53                   	push   %ebx
+  801b7b:	83 ec 28             	sub    $0x28,%esp
+  801b7e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b81:	56                   	push   %esi
+  801b82:	e8 bd ee ff ff       	call   800a44 <fd2data>
+  801b87:	89 c3                	mov    %eax,%ebx
+  801b89:	83 c4 10             	add    $0x10,%esp
+  801b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b91:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b95:	74 5c                	je     801bf3 <devpipe_write+0x7e>
+  801b97:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b9a:	8b 0b                	mov    (%ebx),%ecx
+  801b9c:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b9f:	39 d0                	cmp    %edx,%eax
+  801ba1:	72 1e                	jb     801bc1 <devpipe_write+0x4c>
+  801ba3:	89 da                	mov    %ebx,%edx
+  801ba5:	89 f0                	mov    %esi,%eax
+  801ba7:	e8 64 ff ff ff       	call   801b10 <_pipeisclosed>
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	75 48                	jne    801bf8 <devpipe_write+0x83>
+  801bb0:	e8 c6 e5 ff ff       	call   80017b <sys_yield>
+  801bb5:	8b 43 04             	mov    0x4(%ebx),%eax
+  801bb8:	8b 0b                	mov    (%ebx),%ecx
+  801bba:	8d 51 20             	lea    0x20(%ecx),%edx
+  801bbd:	39 d0                	cmp    %edx,%eax
+  801bbf:	73 e2                	jae    801ba3 <devpipe_write+0x2e>
+  801bc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801bc8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801bcb:	89 c2                	mov    %eax,%edx
+  801bcd:	c1 fa 1f             	sar    $0x1f,%edx
+  801bd0:	89 d1                	mov    %edx,%ecx
+  801bd2:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bd5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bd8:	83 e2 1f             	and    $0x1f,%edx
+  801bdb:	29 ca                	sub    %ecx,%edx
+  801bdd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801be1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801be5:	83 c0 01             	add    $0x1,%eax
+  801be8:	89 43 04             	mov    %eax,0x4(%ebx)
+  801beb:	83 c7 01             	add    $0x1,%edi
+  801bee:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bf1:	75 a4                	jne    801b97 <devpipe_write+0x22>
+  801bf3:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bf6:	eb 05                	jmp    801bfd <devpipe_write+0x88>
+  801bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c00:	5b                   	pop    %ebx
+  801c01:	5e                   	pop    %esi
+  801c02:	5f                   	pop    %edi
+  801c03:	5d                   	pop    %ebp
+  801c04:	c3                   	ret
+
+00801c05 <devpipe_read>:
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	57                   	push   %edi
+  801c09:	56                   	push   %esi
+  801c0a:	53                   	push   %ebx
+  801c0b:	83 ec 18             	sub    $0x18,%esp
+  801c0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c11:	56                   	push   %esi
+  801c12:	e8 2d ee ff ff       	call   800a44 <fd2data>
+  801c17:	89 c3                	mov    %eax,%ebx
+  801c19:	83 c4 10             	add    $0x10,%esp
+  801c1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c21:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c25:	74 45                	je     801c6c <devpipe_read+0x67>
+  801c27:	8b 03                	mov    (%ebx),%eax
+  801c29:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c2c:	75 1d                	jne    801c4b <devpipe_read+0x46>
+  801c2e:	85 ff                	test   %edi,%edi
+  801c30:	75 3f                	jne    801c71 <devpipe_read+0x6c>
+  801c32:	89 da                	mov    %ebx,%edx
+  801c34:	89 f0                	mov    %esi,%eax
+  801c36:	e8 d5 fe ff ff       	call   801b10 <_pipeisclosed>
+  801c3b:	85 c0                	test   %eax,%eax
+  801c3d:	75 3c                	jne    801c7b <devpipe_read+0x76>
+  801c3f:	e8 37 e5 ff ff       	call   80017b <sys_yield>
+  801c44:	8b 03                	mov    (%ebx),%eax
+  801c46:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c49:	74 e7                	je     801c32 <devpipe_read+0x2d>
+  801c4b:	99                   	cltd
+  801c4c:	c1 ea 1b             	shr    $0x1b,%edx
+  801c4f:	01 d0                	add    %edx,%eax
+  801c51:	83 e0 1f             	and    $0x1f,%eax
+  801c54:	29 d0                	sub    %edx,%eax
+  801c56:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c5e:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c61:	83 03 01             	addl   $0x1,(%ebx)
+  801c64:	83 c7 01             	add    $0x1,%edi
+  801c67:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c6a:	75 bb                	jne    801c27 <devpipe_read+0x22>
+  801c6c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c6f:	eb 02                	jmp    801c73 <devpipe_read+0x6e>
+  801c71:	89 f8                	mov    %edi,%eax
+  801c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c76:	5b                   	pop    %ebx
+  801c77:	5e                   	pop    %esi
+  801c78:	5f                   	pop    %edi
+  801c79:	5d                   	pop    %ebp
+  801c7a:	c3                   	ret
+  801c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c80:	eb f1                	jmp    801c73 <devpipe_read+0x6e>
+
+00801c82 <pipe>:
+  801c82:	55                   	push   %ebp
+  801c83:	89 e5                	mov    %esp,%ebp
+  801c85:	56                   	push   %esi
+  801c86:	53                   	push   %ebx
+  801c87:	83 ec 1c             	sub    $0x1c,%esp
+  801c8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8d:	50                   	push   %eax
+  801c8e:	e8 c8 ed ff ff       	call   800a5b <fd_alloc>
+  801c93:	89 c3                	mov    %eax,%ebx
+  801c95:	83 c4 10             	add    $0x10,%esp
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	0f 88 23 01 00 00    	js     801dc3 <pipe+0x141>
+  801ca0:	83 ec 04             	sub    $0x4,%esp
+  801ca3:	68 07 04 00 00       	push   $0x407
+  801ca8:	ff 75 f4             	push   -0xc(%ebp)
+  801cab:	6a 00                	push   $0x0
+  801cad:	e8 14 e5 ff ff       	call   8001c6 <sys_page_alloc>
+  801cb2:	89 c3                	mov    %eax,%ebx
+  801cb4:	83 c4 10             	add    $0x10,%esp
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	0f 88 04 01 00 00    	js     801dc3 <pipe+0x141>
+  801cbf:	83 ec 0c             	sub    $0xc,%esp
+  801cc2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cc5:	50                   	push   %eax
+  801cc6:	e8 90 ed ff ff       	call   800a5b <fd_alloc>
+  801ccb:	89 c3                	mov    %eax,%ebx
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	0f 88 db 00 00 00    	js     801db3 <pipe+0x131>
+  801cd8:	83 ec 04             	sub    $0x4,%esp
+  801cdb:	68 07 04 00 00       	push   $0x407
+  801ce0:	ff 75 f0             	push   -0x10(%ebp)
+  801ce3:	6a 00                	push   $0x0
+  801ce5:	e8 dc e4 ff ff       	call   8001c6 <sys_page_alloc>
+  801cea:	89 c3                	mov    %eax,%ebx
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	0f 88 bc 00 00 00    	js     801db3 <pipe+0x131>
+  801cf7:	83 ec 0c             	sub    $0xc,%esp
+  801cfa:	ff 75 f4             	push   -0xc(%ebp)
+  801cfd:	e8 42 ed ff ff       	call   800a44 <fd2data>
+  801d02:	89 c6                	mov    %eax,%esi
+  801d04:	83 c4 0c             	add    $0xc,%esp
+  801d07:	68 07 04 00 00       	push   $0x407
+  801d0c:	50                   	push   %eax
+  801d0d:	6a 00                	push   $0x0
+  801d0f:	e8 b2 e4 ff ff       	call   8001c6 <sys_page_alloc>
+  801d14:	89 c3                	mov    %eax,%ebx
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	0f 88 82 00 00 00    	js     801da3 <pipe+0x121>
+  801d21:	83 ec 0c             	sub    $0xc,%esp
+  801d24:	ff 75 f0             	push   -0x10(%ebp)
+  801d27:	e8 18 ed ff ff       	call   800a44 <fd2data>
+  801d2c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d33:	50                   	push   %eax
+  801d34:	6a 00                	push   $0x0
+  801d36:	56                   	push   %esi
+  801d37:	6a 00                	push   $0x0
+  801d39:	e8 cb e4 ff ff       	call   800209 <sys_page_map>
+  801d3e:	89 c3                	mov    %eax,%ebx
+  801d40:	83 c4 20             	add    $0x20,%esp
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 4e                	js     801d95 <pipe+0x113>
+  801d47:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d4c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d4f:	89 02                	mov    %eax,(%edx)
+  801d51:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d54:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d5b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d5e:	89 02                	mov    %eax,(%edx)
+  801d60:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d63:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d6a:	83 ec 0c             	sub    $0xc,%esp
+  801d6d:	ff 75 f4             	push   -0xc(%ebp)
+  801d70:	e8 bf ec ff ff       	call   800a34 <fd2num>
+  801d75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d78:	89 01                	mov    %eax,(%ecx)
+  801d7a:	83 c4 04             	add    $0x4,%esp
+  801d7d:	ff 75 f0             	push   -0x10(%ebp)
+  801d80:	e8 af ec ff ff       	call   800a34 <fd2num>
+  801d85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d88:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d93:	eb 2e                	jmp    801dc3 <pipe+0x141>
+  801d95:	83 ec 08             	sub    $0x8,%esp
+  801d98:	56                   	push   %esi
+  801d99:	6a 00                	push   $0x0
+  801d9b:	e8 f8 e4 ff ff       	call   800298 <sys_page_unmap>
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	83 ec 08             	sub    $0x8,%esp
+  801da6:	ff 75 f0             	push   -0x10(%ebp)
+  801da9:	6a 00                	push   $0x0
+  801dab:	e8 e8 e4 ff ff       	call   800298 <sys_page_unmap>
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	83 ec 08             	sub    $0x8,%esp
+  801db6:	ff 75 f4             	push   -0xc(%ebp)
+  801db9:	6a 00                	push   $0x0
+  801dbb:	e8 d8 e4 ff ff       	call   800298 <sys_page_unmap>
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	89 d8                	mov    %ebx,%eax
+  801dc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc8:	5b                   	pop    %ebx
+  801dc9:	5e                   	pop    %esi
+  801dca:	5d                   	pop    %ebp
+  801dcb:	c3                   	ret
+
+00801dcc <pipeisclosed>:
+  801dcc:	55                   	push   %ebp
+  801dcd:	89 e5                	mov    %esp,%ebp
+  801dcf:	83 ec 20             	sub    $0x20,%esp
+  801dd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dd5:	50                   	push   %eax
+  801dd6:	ff 75 08             	push   0x8(%ebp)
+  801dd9:	e8 cd ec ff ff       	call   800aab <fd_lookup>
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 18                	js     801dfd <pipeisclosed+0x31>
+  801de5:	83 ec 0c             	sub    $0xc,%esp
+  801de8:	ff 75 f4             	push   -0xc(%ebp)
+  801deb:	e8 54 ec ff ff       	call   800a44 <fd2data>
+  801df0:	89 c2                	mov    %eax,%edx
+  801df2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df5:	e8 16 fd ff ff       	call   801b10 <_pipeisclosed>
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	c9                   	leave
+  801dfe:	c3                   	ret
+
+00801dff <ipcring_init>:
+  801dff:	55                   	push   %ebp
+  801e00:	89 e5                	mov    %esp,%ebp
+  801e02:	53                   	push   %ebx
+  801e03:	83 ec 08             	sub    $0x8,%esp
+  801e06:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e09:	6a 60                	push   $0x60
+  801e0b:	6a 00                	push   $0x0
+  801e0d:	53                   	push   %ebx
+  801e0e:	e8 cd 0c 00 00       	call   802ae0 <memset>
+  801e13:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e18:	8b 40 48             	mov    0x48(%eax),%eax
+  801e1b:	89 03                	mov    %eax,(%ebx)
+  801e1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e20:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e23:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e26:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e29:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e2c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e2f:	83 c4 10             	add    $0x10,%esp
+  801e32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e35:	c9                   	leave
+  801e36:	c3                   	ret
+
+00801e37 <ipcring_req_slot>:
+  801e37:	55                   	push   %ebp
+  801e38:	89 e5                	mov    %esp,%ebp
+  801e3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3d:	8b 50 10             	mov    0x10(%eax),%edx
+  801e40:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e43:	29 ca                	sub    %ecx,%edx
+  801e45:	83 fa 07             	cmp    $0x7,%edx
+  801e48:	77 0c                	ja     801e56 <ipcring_req_slot+0x1f>
+  801e4a:	8b 50 10             	mov    0x10(%eax),%edx
+  801e4d:	83 e2 07             	and    $0x7,%edx
+  801e50:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e54:	5d                   	pop    %ebp
+  801e55:	c3                   	ret
+  801e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5b:	eb f7                	jmp    801e54 <ipcring_req_slot+0x1d>
+
+00801e5d <ipcring_req_push>:
+  801e5d:	55                   	push   %ebp
+  801e5e:	89 e5                	mov    %esp,%ebp
+  801e60:	83 ec 08             	sub    $0x8,%esp
+  801e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e66:	8b 42 10             	mov    0x10(%edx),%eax
+  801e69:	83 c0 01             	add    $0x1,%eax
+  801e6c:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e75:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	75 02                	jne    801e7f <ipcring_req_push+0x22>
+  801e7d:	c9                   	leave
+  801e7e:	c3                   	ret
+  801e7f:	6a 00                	push   $0x0
+  801e81:	68 00 00 80 ee       	push   $0xee800000
+  801e86:	ff 72 08             	push   0x8(%edx)
+  801e89:	ff 72 04             	push   0x4(%edx)
+  801e8c:	e8 6d e6 ff ff       	call   8004fe <sys_ipc_send>
+  801e91:	83 c4 10             	add    $0x10,%esp
+  801e94:	eb e7                	jmp    801e7d <ipcring_req_push+0x20>
+
+00801e96 <ipcring_rsp_wait>:
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	53                   	push   %ebx
+  801e9a:	83 ec 04             	sub    $0x4,%esp
+  801e9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ea0:	8b 53 18             	mov    0x18(%ebx),%edx
+  801ea3:	8b 43 10             	mov    0x10(%ebx),%eax
+  801ea6:	39 c2                	cmp    %eax,%edx
+  801ea8:	74 3c                	je     801ee6 <ipcring_rsp_wait+0x50>
+  801eaa:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ead:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eb0:	39 c2                	cmp    %eax,%edx
+  801eb2:	75 23                	jne    801ed7 <ipcring_rsp_wait+0x41>
+  801eb4:	83 ec 08             	sub    $0x8,%esp
+  801eb7:	6a 00                	push   $0x0
+  801eb9:	6a 00                	push   $0x0
+  801ebb:	6a 00                	push   $0x0
+  801ebd:	6a 00                	push   $0x0
+  801ebf:	ff 73 0c             	push   0xc(%ebx)
+  801ec2:	ff 73 04             	push   0x4(%ebx)
+  801ec5:	e8 cb 0e 00 00       	call   802d95 <ipc_call>
+  801eca:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ecd:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ed0:	83 c4 20             	add    $0x20,%esp
+  801ed3:	39 c2                	cmp    %eax,%edx
+  801ed5:	74 dd                	je     801eb4 <ipcring_rsp_wait+0x1e>
+  801ed7:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eda:	83 e0 07             	and    $0x7,%eax
+  801edd:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801ee1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee4:	c9                   	leave
+  801ee5:	c3                   	ret
+  801ee6:	68 d8 32 80 00       	push   $0x8032d8
+  801eeb:	68 89 32 80 00       	push   $0x803289
+  801ef0:	6a 3b                	push   $0x3b
+  801ef2:	68 f9 32 80 00       	push   $0x8032f9
+  801ef7:	e8 97 02 00 00       	call   802193 <_panic>
+
+00801efc <ipcring_rsp_pop>:
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f02:	8b 42 18             	mov    0x18(%edx),%eax
+  801f05:	83 c0 01             	add    $0x1,%eax
+  801f08:	89 42 18             	mov    %eax,0x18(%edx)
+  801f0b:	5d                   	pop    %ebp
+  801f0c:	c3                   	ret
+
+00801f0d <ipcring_server_init>:
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f13:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f16:	89 10                	mov    %edx,(%eax)
+  801f18:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f1b:	89 50 04             	mov    %edx,0x4(%eax)
+  801f1e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801f25:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f2c:	5d                   	pop    %ebp
+  801f2d:	c3                   	ret
+
+00801f2e <ipcring_req_avail>:
+  801f2e:	55                   	push   %ebp
+  801f2f:	89 e5                	mov    %esp,%ebp
+  801f31:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f34:	8b 02                	mov    (%edx),%eax
+  801f36:	8b 40 10             	mov    0x10(%eax),%eax
+  801f39:	2b 42 08             	sub    0x8(%edx),%eax
+  801f3c:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f41:	39 d0                	cmp    %edx,%eax
+  801f43:	0f 47 c2             	cmova  %edx,%eax
+  801f46:	5d                   	pop    %ebp
+  801f47:	c3                   	ret
+
+00801f48 <ipcring_req_peek>:
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f4e:	8b 42 08             	mov    0x8(%edx),%eax
+  801f51:	83 e0 07             	and    $0x7,%eax
+  801f54:	8b 12                	mov    (%edx),%edx
+  801f56:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f5a:	5d                   	pop    %ebp
+  801f5b:	c3                   	ret
+
+00801f5c <ipcring_rsp_push>:
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+  801f62:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f65:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f68:	83 c0 01             	add    $0x1,%eax
+  801f6b:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f6e:	8b 11                	mov    (%ecx),%edx
+  801f70:	83 c2 14             	add    $0x14,%edx
+  801f73:	f0 87 02             	lock xchg %eax,(%edx)
+  801f76:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f7a:	75 02                	jne    801f7e <ipcring_rsp_push+0x22>
+  801f7c:	c9                   	leave
+  801f7d:	c3                   	ret
+  801f7e:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f85:	6a 00                	push   $0x0
+  801f87:	68 00 00 80 ee       	push   $0xee800000
+  801f8c:	6a 00                	push   $0x0
+  801f8e:	ff 71 04             	push   0x4(%ecx)
+  801f91:	e8 8b e4 ff ff       	call   800421 <sys_ipc_try_send>
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	eb e1                	jmp    801f7c <ipcring_rsp_push+0x20>
+
+00801f9b <ipcring_client_wait>:
+  801f9b:	55                   	push   %ebp
+  801f9c:	89 e5                	mov    %esp,%ebp
+  801f9e:	83 ec 08             	sub    $0x8,%esp
+  801fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa4:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801fab:	8b 10                	mov    (%eax),%edx
+  801fad:	8b 52 18             	mov    0x18(%edx),%edx
+  801fb0:	3b 50 08             	cmp    0x8(%eax),%edx
+  801fb3:	75 02                	jne    801fb7 <ipcring_client_wait+0x1c>
+  801fb5:	c9                   	leave
+  801fb6:	c3                   	ret
+  801fb7:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801fbe:	6a 00                	push   $0x0
+  801fc0:	68 00 00 80 ee       	push   $0xee800000
+  801fc5:	6a 00                	push   $0x0
+  801fc7:	ff 70 04             	push   0x4(%eax)
+  801fca:	e8 52 e4 ff ff       	call   800421 <sys_ipc_try_send>
+  801fcf:	83 c4 10             	add    $0x10,%esp
+  801fd2:	eb e1                	jmp    801fb5 <ipcring_client_wait+0x1a>
+
+00801fd4 <ipcring_server_sleep>:
+  801fd4:	55                   	push   %ebp
+  801fd5:	89 e5                	mov    %esp,%ebp
+  801fd7:	53                   	push   %ebx
+  801fd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fdb:	8b 01                	mov    (%ecx),%eax
+  801fdd:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fe0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fe5:	f0 87 02             	lock xchg %eax,(%edx)
+  801fe8:	8b 11                	mov    (%ecx),%edx
+  801fea:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff2:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801ff5:	74 0e                	je     802005 <ipcring_server_sleep+0x31>
+  801ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffc:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802000:	b8 00 00 00 00       	mov    $0x0,%eax
+  802005:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+0080200a <devcons_close>:
+  80200a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200f:	c3                   	ret
+
+00802010 <devcons_stat>:
+  802010:	55                   	push   %ebp
+  802011:	89 e5                	mov    %esp,%ebp
+  802013:	83 ec 10             	sub    $0x10,%esp
+  802016:	68 07 33 80 00       	push   $0x803307
+  80201b:	ff 75 0c             	push   0xc(%ebp)
+  80201e:	e8 42 09 00 00       	call   802965 <strcpy>
+  802023:	b8 00 00 00 00       	mov    $0x0,%eax
+  802028:	c9                   	leave
+  802029:	c3                   	ret
+
+0080202a <devcons_write>:
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	57                   	push   %edi
+  80202e:	56                   	push   %esi
+  80202f:	53                   	push   %ebx
+  802030:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802036:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802039:	85 ff                	test   %edi,%edi
+  80203b:	74 51                	je     80208e <devcons_write+0x64>
+  80203d:	be 00 00 00 00       	mov    $0x0,%esi
+  802042:	b8 00 00 00 00       	mov    $0x0,%eax
+  802047:	89 fb                	mov    %edi,%ebx
+  802049:	29 c3                	sub    %eax,%ebx
+  80204b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802050:	39 d3                	cmp    %edx,%ebx
+  802052:	0f 47 da             	cmova  %edx,%ebx
+  802055:	83 ec 04             	sub    $0x4,%esp
+  802058:	53                   	push   %ebx
+  802059:	03 45 0c             	add    0xc(%ebp),%eax
+  80205c:	50                   	push   %eax
+  80205d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802063:	50                   	push   %eax
+  802064:	e8 ac 0a 00 00       	call   802b15 <memmove>
+  802069:	83 c4 08             	add    $0x8,%esp
+  80206c:	53                   	push   %ebx
+  80206d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802073:	50                   	push   %eax
+  802074:	e8 65 e0 ff ff       	call   8000de <sys_cputs>
+  802079:	01 de                	add    %ebx,%esi
+  80207b:	89 f0                	mov    %esi,%eax
+  80207d:	83 c4 10             	add    $0x10,%esp
+  802080:	39 fe                	cmp    %edi,%esi
+  802082:	72 c3                	jb     802047 <devcons_write+0x1d>
+  802084:	89 f0                	mov    %esi,%eax
+  802086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802089:	5b                   	pop    %ebx
+  80208a:	5e                   	pop    %esi
+  80208b:	5f                   	pop    %edi
+  80208c:	5d                   	pop    %ebp
+  80208d:	c3                   	ret
+  80208e:	be 00 00 00 00       	mov    $0x0,%esi
+  802093:	eb ef                	jmp    802084 <devcons_write+0x5a>
+
+00802095 <devcons_read>:
+  802095:	55                   	push   %ebp
+  802096:	89 e5                	mov    %esp,%ebp
+  802098:	83 ec 08             	sub    $0x8,%esp
+  80209b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020a4:	75 07                	jne    8020ad <devcons_read+0x18>
+  8020a6:	eb 1f                	jmp    8020c7 <devcons_read+0x32>
+  8020a8:	e8 ce e0 ff ff       	call   80017b <sys_yield>
+  8020ad:	e8 4a e0 ff ff       	call   8000fc <sys_cgetc>
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	74 f2                	je     8020a8 <devcons_read+0x13>
+  8020b6:	78 0f                	js     8020c7 <devcons_read+0x32>
+  8020b8:	83 f8 04             	cmp    $0x4,%eax
+  8020bb:	74 0c                	je     8020c9 <devcons_read+0x34>
+  8020bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020c0:	88 02                	mov    %al,(%edx)
+  8020c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020c7:	c9                   	leave
+  8020c8:	c3                   	ret
+  8020c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ce:	eb f7                	jmp    8020c7 <devcons_read+0x32>
+
+008020d0 <cputchar>:
+  8020d0:	55                   	push   %ebp
+  8020d1:	89 e5                	mov    %esp,%ebp
+  8020d3:	83 ec 20             	sub    $0x20,%esp
+  8020d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020dc:	6a 01                	push   $0x1
+  8020de:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020e1:	50                   	push   %eax
+  8020e2:	e8 f7 df ff ff       	call   8000de <sys_cputs>
+  8020e7:	83 c4 10             	add    $0x10,%esp
+  8020ea:	c9                   	leave
+  8020eb:	c3                   	ret
+
+008020ec <getchar>:
+  8020ec:	55                   	push   %ebp
+  8020ed:	89 e5                	mov    %esp,%ebp
+  8020ef:	83 ec 1c             	sub    $0x1c,%esp
+  8020f2:	6a 01                	push   $0x1
+  8020f4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020f7:	50                   	push   %eax
+  8020f8:	6a 00                	push   $0x0
+  8020fa:	e8 0e ec ff ff       	call   800d0d <read>
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	85 c0                	test   %eax,%eax
+  802104:	78 06                	js     80210c <getchar+0x20>
+  802106:	74 06                	je     80210e <getchar+0x22>
+  802108:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  80210c:	c9                   	leave
+  80210d:	c3                   	ret
+  80210e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802113:	eb f7                	jmp    80210c <getchar+0x20>
+
+00802115 <iscons>:
+  802115:	55                   	push   %ebp
+  802116:	89 e5                	mov    %esp,%ebp
+  802118:	83 ec 20             	sub    $0x20,%esp
+  80211b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80211e:	50                   	push   %eax
+  80211f:	ff 75 08             	push   0x8(%ebp)
+  802122:	e8 84 e9 ff ff       	call   800aab <fd_lookup>
+  802127:	83 c4 10             	add    $0x10,%esp
+  80212a:	85 c0                	test   %eax,%eax
+  80212c:	78 11                	js     80213f <iscons+0x2a>
+  80212e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802131:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802137:	39 10                	cmp    %edx,(%eax)
+  802139:	0f 94 c0             	sete   %al
+  80213c:	0f b6 c0             	movzbl %al,%eax
+  80213f:	c9                   	leave
+  802140:	c3                   	ret
+
+00802141 <opencons>:
+  802141:	55                   	push   %ebp
+  802142:	89 e5                	mov    %esp,%ebp
+  802144:	83 ec 24             	sub    $0x24,%esp
+  802147:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80214a:	50                   	push   %eax
+  80214b:	e8 0b e9 ff ff       	call   800a5b <fd_alloc>
+  802150:	83 c4 10             	add    $0x10,%esp
+  802153:	85 c0                	test   %eax,%eax
+  802155:	78 3a                	js     802191 <opencons+0x50>
+  802157:	83 ec 04             	sub    $0x4,%esp
+  80215a:	68 07 04 00 00       	push   $0x407
+  80215f:	ff 75 f4             	push   -0xc(%ebp)
+  802162:	6a 00                	push   $0x0
+  802164:	e8 5d e0 ff ff       	call   8001c6 <sys_page_alloc>
+  802169:	83 c4 10             	add    $0x10,%esp
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	78 21                	js     802191 <opencons+0x50>
+  802170:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802173:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802179:	89 10                	mov    %edx,(%eax)
+  80217b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80217e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802185:	83 ec 0c             	sub    $0xc,%esp
+  802188:	50                   	push   %eax
+  802189:	e8 a6 e8 ff ff       	call   800a34 <fd2num>
+  80218e:	83 c4 10             	add    $0x10,%esp
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+
+00802193 <_panic>:
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	56                   	push   %esi
+  802197:	53                   	push   %ebx
+  802198:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80219b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8021a1:	e8 b6 df ff ff       	call   80015c <sys_getenvid>
+  8021a6:	83 ec 0c             	sub    $0xc,%esp
+  8021a9:	ff 75 0c             	push   0xc(%ebp)
+  8021ac:	ff 75 08             	push   0x8(%ebp)
+  8021af:	56                   	push   %esi
+  8021b0:	50                   	push   %eax
+  8021b1:	68 14 33 80 00       	push   $0x803314
+  8021b6:	e8 b3 00 00 00       	call   80226e <cprintf>
+  8021bb:	83 c4 18             	add    $0x18,%esp
+  8021be:	53                   	push   %ebx
+  8021bf:	ff 75 10             	push   0x10(%ebp)
+  8021c2:	e8 56 00 00 00       	call   80221d <vcprintf>
+  8021c7:	c7 04 24 ce 32 80 00 	movl   $0x8032ce,(%esp)
+  8021ce:	e8 9b 00 00 00       	call   80226e <cprintf>
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	cc                   	int3
+  8021d7:	eb fd                	jmp    8021d6 <_panic+0x43>
+
+008021d9 <putch>:
+  8021d9:	55                   	push   %ebp
+  8021da:	89 e5                	mov    %esp,%ebp
+  8021dc:	53                   	push   %ebx
+  8021dd:	83 ec 04             	sub    $0x4,%esp
+  8021e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021e3:	8b 13                	mov    (%ebx),%edx
+  8021e5:	8d 42 01             	lea    0x1(%edx),%eax
+  8021e8:	89 03                	mov    %eax,(%ebx)
+  8021ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021ed:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021f1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021f6:	74 09                	je     802201 <putch+0x28>
+  8021f8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ff:	c9                   	leave
+  802200:	c3                   	ret
+  802201:	83 ec 08             	sub    $0x8,%esp
+  802204:	68 ff 00 00 00       	push   $0xff
+  802209:	8d 43 08             	lea    0x8(%ebx),%eax
+  80220c:	50                   	push   %eax
+  80220d:	e8 cc de ff ff       	call   8000de <sys_cputs>
+  802212:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802218:	83 c4 10             	add    $0x10,%esp
+  80221b:	eb db                	jmp    8021f8 <putch+0x1f>
+
+0080221d <vcprintf>:
+  80221d:	55                   	push   %ebp
+  80221e:	89 e5                	mov    %esp,%ebp
+  802220:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802226:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80222d:	00 00 00 
+  802230:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802237:	00 00 00 
+  80223a:	ff 75 0c             	push   0xc(%ebp)
+  80223d:	ff 75 08             	push   0x8(%ebp)
+  802240:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802246:	50                   	push   %eax
+  802247:	68 d9 21 80 00       	push   $0x8021d9
+  80224c:	e8 1c 01 00 00       	call   80236d <vprintfmt>
+  802251:	83 c4 08             	add    $0x8,%esp
+  802254:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80225a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802260:	50                   	push   %eax
+  802261:	e8 78 de ff ff       	call   8000de <sys_cputs>
+  802266:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80226c:	c9                   	leave
+  80226d:	c3                   	ret
+
+0080226e <cprintf>:
+  80226e:	55                   	push   %ebp
+  80226f:	89 e5                	mov    %esp,%ebp
+  802271:	83 ec 10             	sub    $0x10,%esp
+  802274:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802277:	50                   	push   %eax
+  802278:	ff 75 08             	push   0x8(%ebp)
+  80227b:	e8 9d ff ff ff       	call   80221d <vcprintf>
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+00802282 <printnum>:
+  802282:	55                   	push   %ebp
+  802283:	89 e5                	mov    %esp,%ebp
+  802285:	57                   	push   %edi
+  802286:	56                   	push   %esi
+  802287:	53                   	push   %ebx
+  802288:	83 ec 1c             	sub    $0x1c,%esp
+  80228b:	89 c3                	mov    %eax,%ebx
+  80228d:	89 d6                	mov    %edx,%esi
+  80228f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802292:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802295:	89 d1                	mov    %edx,%ecx
+  802297:	89 c2                	mov    %eax,%edx
+  802299:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80229c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80229f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8022a5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8022ac:	39 c2                	cmp    %eax,%edx
+  8022ae:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8022b1:	73 4b                	jae    8022fe <printnum+0x7c>
+  8022b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022b6:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8022b9:	85 ff                	test   %edi,%edi
+  8022bb:	7e 11                	jle    8022ce <printnum+0x4c>
+  8022bd:	83 ec 08             	sub    $0x8,%esp
+  8022c0:	56                   	push   %esi
+  8022c1:	ff 75 18             	push   0x18(%ebp)
+  8022c4:	ff d3                	call   *%ebx
+  8022c6:	83 c4 10             	add    $0x10,%esp
+  8022c9:	83 ef 01             	sub    $0x1,%edi
+  8022cc:	75 ef                	jne    8022bd <printnum+0x3b>
+  8022ce:	83 ec 08             	sub    $0x8,%esp
+  8022d1:	56                   	push   %esi
+  8022d2:	83 ec 04             	sub    $0x4,%esp
+  8022d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8022d8:	ff 75 e0             	push   -0x20(%ebp)
+  8022db:	ff 75 dc             	push   -0x24(%ebp)
+  8022de:	ff 75 d8             	push   -0x28(%ebp)
+  8022e1:	e8 9b 0d 00 00       	call   803081 <__umoddi3>
+  8022e6:	83 c4 14             	add    $0x14,%esp
+  8022e9:	0f be 80 37 33 80 00 	movsbl 0x803337(%eax),%eax
+  8022f0:	50                   	push   %eax
+  8022f1:	ff d3                	call   *%ebx
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f9:	5b                   	pop    %ebx
+  8022fa:	5e                   	pop    %esi
+  8022fb:	5f                   	pop    %edi
+  8022fc:	5d                   	pop    %ebp
+  8022fd:	c3                   	ret
+  8022fe:	83 ec 0c             	sub    $0xc,%esp
+  802301:	ff 75 18             	push   0x18(%ebp)
+  802304:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802307:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80230a:	52                   	push   %edx
+  80230b:	50                   	push   %eax
+  80230c:	83 ec 08             	sub    $0x8,%esp
+  80230f:	ff 75 e4             	push   -0x1c(%ebp)
+  802312:	ff 75 e0             	push   -0x20(%ebp)
+  802315:	ff 75 dc             	push   -0x24(%ebp)
+  802318:	ff 75 d8             	push   -0x28(%ebp)
+  80231b:	e8 43 0d 00 00       	call   803063 <__udivdi3>
+  802320:	83 c4 18             	add    $0x18,%esp
+  802323:	52                   	push   %edx
+  802324:	50                   	push   %eax
+  802325:	89 f2                	mov    %esi,%edx
+  802327:	89 d8                	mov    %ebx,%eax
+  802329:	e8 54 ff ff ff       	call   802282 <printnum>
+  80232e:	83 c4 20             	add    $0x20,%esp
+  802331:	eb 9b                	jmp    8022ce <printnum+0x4c>
+
+00802333 <sprintputch>:
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802339:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80233d:	8b 10                	mov    (%eax),%edx
+  80233f:	3b 50 04             	cmp    0x4(%eax),%edx
+  802342:	73 0a                	jae    80234e <sprintputch+0x1b>
+  802344:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802347:	89 08                	mov    %ecx,(%eax)
+  802349:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234c:	88 02                	mov    %al,(%edx)
+  80234e:	5d                   	pop    %ebp
+  80234f:	c3                   	ret
+
+00802350 <printfmt>:
+  802350:	55                   	push   %ebp
+  802351:	89 e5                	mov    %esp,%ebp
+  802353:	83 ec 08             	sub    $0x8,%esp
+  802356:	8d 45 14             	lea    0x14(%ebp),%eax
+  802359:	50                   	push   %eax
+  80235a:	ff 75 10             	push   0x10(%ebp)
+  80235d:	ff 75 0c             	push   0xc(%ebp)
+  802360:	ff 75 08             	push   0x8(%ebp)
+  802363:	e8 05 00 00 00       	call   80236d <vprintfmt>
+  802368:	83 c4 10             	add    $0x10,%esp
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+
+0080236d <vprintfmt>:
+  80236d:	55                   	push   %ebp
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	57                   	push   %edi
+  802371:	56                   	push   %esi
+  802372:	53                   	push   %ebx
+  802373:	83 ec 2c             	sub    $0x2c,%esp
+  802376:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802379:	89 df                	mov    %ebx,%edi
+  80237b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80237e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802381:	8d 70 01             	lea    0x1(%eax),%esi
+  802384:	0f b6 00             	movzbl (%eax),%eax
+  802387:	83 f8 25             	cmp    $0x25,%eax
+  80238a:	74 1e                	je     8023aa <vprintfmt+0x3d>
+  80238c:	85 c0                	test   %eax,%eax
+  80238e:	0f 84 15 05 00 00    	je     8028a9 <vprintfmt+0x53c>
+  802394:	83 ec 08             	sub    $0x8,%esp
+  802397:	53                   	push   %ebx
+  802398:	50                   	push   %eax
+  802399:	ff d7                	call   *%edi
+  80239b:	83 c6 01             	add    $0x1,%esi
+  80239e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8023a2:	83 c4 10             	add    $0x10,%esp
+  8023a5:	83 f8 25             	cmp    $0x25,%eax
+  8023a8:	75 e2                	jne    80238c <vprintfmt+0x1f>
+  8023aa:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8023ae:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8023b5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8023bc:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8023c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023c8:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8023cb:	8d 56 01             	lea    0x1(%esi),%edx
+  8023ce:	0f b6 0e             	movzbl (%esi),%ecx
+  8023d1:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023d4:	3c 55                	cmp    $0x55,%al
+  8023d6:	0f 87 3b 04 00 00    	ja     802817 <vprintfmt+0x4aa>
+  8023dc:	0f b6 c0             	movzbl %al,%eax
+  8023df:	ff 24 85 80 34 80 00 	jmp    *0x803480(,%eax,4)
+  8023e6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023e9:	eb 93                	jmp    80237e <vprintfmt+0x11>
+  8023eb:	89 d6                	mov    %edx,%esi
+  8023ed:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023f1:	eb d8                	jmp    8023cb <vprintfmt+0x5e>
+  8023f3:	89 d6                	mov    %edx,%esi
+  8023f5:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023f9:	eb d0                	jmp    8023cb <vprintfmt+0x5e>
+  8023fb:	0f b6 c9             	movzbl %cl,%ecx
+  8023fe:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802401:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802404:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  802408:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80240b:	83 f9 09             	cmp    $0x9,%ecx
+  80240e:	77 6f                	ja     80247f <vprintfmt+0x112>
+  802410:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  802413:	83 c2 01             	add    $0x1,%edx
+  802416:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802419:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80241d:	0f be 02             	movsbl (%edx),%eax
+  802420:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802423:	83 fe 09             	cmp    $0x9,%esi
+  802426:	76 eb                	jbe    802413 <vprintfmt+0xa6>
+  802428:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80242b:	89 d6                	mov    %edx,%esi
+  80242d:	eb 13                	jmp    802442 <vprintfmt+0xd5>
+  80242f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802432:	8b 00                	mov    (%eax),%eax
+  802434:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80243a:	8d 40 04             	lea    0x4(%eax),%eax
+  80243d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802440:	89 d6                	mov    %edx,%esi
+  802442:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802446:	79 83                	jns    8023cb <vprintfmt+0x5e>
+  802448:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80244b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80244e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802455:	e9 71 ff ff ff       	jmp    8023cb <vprintfmt+0x5e>
+  80245a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80245d:	85 c9                	test   %ecx,%ecx
+  80245f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802464:	0f 49 c1             	cmovns %ecx,%eax
+  802467:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80246a:	89 d6                	mov    %edx,%esi
+  80246c:	e9 5a ff ff ff       	jmp    8023cb <vprintfmt+0x5e>
+  802471:	89 d6                	mov    %edx,%esi
+  802473:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80247a:	e9 4c ff ff ff       	jmp    8023cb <vprintfmt+0x5e>
+  80247f:	89 d6                	mov    %edx,%esi
+  802481:	eb bf                	jmp    802442 <vprintfmt+0xd5>
+  802483:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802487:	89 d6                	mov    %edx,%esi
+  802489:	e9 3d ff ff ff       	jmp    8023cb <vprintfmt+0x5e>
+  80248e:	89 55 10             	mov    %edx,0x10(%ebp)
+  802491:	8b 45 14             	mov    0x14(%ebp),%eax
+  802494:	8d 70 04             	lea    0x4(%eax),%esi
+  802497:	83 ec 08             	sub    $0x8,%esp
+  80249a:	53                   	push   %ebx
+  80249b:	ff 30                	push   (%eax)
+  80249d:	ff d7                	call   *%edi
+  80249f:	83 c4 10             	add    $0x10,%esp
+  8024a2:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024a5:	e9 d4 fe ff ff       	jmp    80237e <vprintfmt+0x11>
+  8024aa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024b0:	8d 70 04             	lea    0x4(%eax),%esi
+  8024b3:	8b 10                	mov    (%eax),%edx
+  8024b5:	89 d0                	mov    %edx,%eax
+  8024b7:	f7 d8                	neg    %eax
+  8024b9:	0f 48 c2             	cmovs  %edx,%eax
+  8024bc:	83 f8 12             	cmp    $0x12,%eax
+  8024bf:	7f 23                	jg     8024e4 <vprintfmt+0x177>
+  8024c1:	8b 14 85 e0 35 80 00 	mov    0x8035e0(,%eax,4),%edx
+  8024c8:	85 d2                	test   %edx,%edx
+  8024ca:	74 18                	je     8024e4 <vprintfmt+0x177>
+  8024cc:	52                   	push   %edx
+  8024cd:	68 9b 32 80 00       	push   $0x80329b
+  8024d2:	53                   	push   %ebx
+  8024d3:	57                   	push   %edi
+  8024d4:	e8 77 fe ff ff       	call   802350 <printfmt>
+  8024d9:	83 c4 10             	add    $0x10,%esp
+  8024dc:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024df:	e9 9a fe ff ff       	jmp    80237e <vprintfmt+0x11>
+  8024e4:	50                   	push   %eax
+  8024e5:	68 4f 33 80 00       	push   $0x80334f
+  8024ea:	53                   	push   %ebx
+  8024eb:	57                   	push   %edi
+  8024ec:	e8 5f fe ff ff       	call   802350 <printfmt>
+  8024f1:	83 c4 10             	add    $0x10,%esp
+  8024f4:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024f7:	e9 82 fe ff ff       	jmp    80237e <vprintfmt+0x11>
+  8024fc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  802502:	83 c0 04             	add    $0x4,%eax
+  802505:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802508:	8b 45 14             	mov    0x14(%ebp),%eax
+  80250b:	8b 00                	mov    (%eax),%eax
+  80250d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802510:	85 c0                	test   %eax,%eax
+  802512:	0f 84 61 03 00 00    	je     802879 <vprintfmt+0x50c>
+  802518:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80251c:	7e 06                	jle    802524 <vprintfmt+0x1b7>
+  80251e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802522:	75 29                	jne    80254d <vprintfmt+0x1e0>
+  802524:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802527:	8d 70 01             	lea    0x1(%eax),%esi
+  80252a:	0f b6 00             	movzbl (%eax),%eax
+  80252d:	0f be d0             	movsbl %al,%edx
+  802530:	85 d2                	test   %edx,%edx
+  802532:	0f 84 bb 00 00 00    	je     8025f3 <vprintfmt+0x286>
+  802538:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80253b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80253e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802541:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802544:	eb 7a                	jmp    8025c0 <vprintfmt+0x253>
+  802546:	c7 45 d0 48 33 80 00 	movl   $0x803348,-0x30(%ebp)
+  80254d:	83 ec 08             	sub    $0x8,%esp
+  802550:	ff 75 d4             	push   -0x2c(%ebp)
+  802553:	ff 75 d0             	push   -0x30(%ebp)
+  802556:	e8 e0 03 00 00       	call   80293b <strnlen>
+  80255b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80255e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802561:	83 c4 10             	add    $0x10,%esp
+  802564:	85 d2                	test   %edx,%edx
+  802566:	0f 8e d6 02 00 00    	jle    802842 <vprintfmt+0x4d5>
+  80256c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802570:	83 ec 08             	sub    $0x8,%esp
+  802573:	53                   	push   %ebx
+  802574:	56                   	push   %esi
+  802575:	ff d7                	call   *%edi
+  802577:	83 c4 10             	add    $0x10,%esp
+  80257a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80257e:	75 f0                	jne    802570 <vprintfmt+0x203>
+  802580:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802583:	8d 70 01             	lea    0x1(%eax),%esi
+  802586:	0f b6 00             	movzbl (%eax),%eax
+  802589:	0f be d0             	movsbl %al,%edx
+  80258c:	85 d2                	test   %edx,%edx
+  80258e:	0f 84 da 02 00 00    	je     80286e <vprintfmt+0x501>
+  802594:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802597:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80259a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80259d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8025a0:	eb 1e                	jmp    8025c0 <vprintfmt+0x253>
+  8025a2:	83 ec 08             	sub    $0x8,%esp
+  8025a5:	ff 75 0c             	push   0xc(%ebp)
+  8025a8:	52                   	push   %edx
+  8025a9:	ff 55 08             	call   *0x8(%ebp)
+  8025ac:	83 c4 10             	add    $0x10,%esp
+  8025af:	83 eb 01             	sub    $0x1,%ebx
+  8025b2:	83 c6 01             	add    $0x1,%esi
+  8025b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8025b9:	0f be d0             	movsbl %al,%edx
+  8025bc:	85 d2                	test   %edx,%edx
+  8025be:	74 2a                	je     8025ea <vprintfmt+0x27d>
+  8025c0:	85 ff                	test   %edi,%edi
+  8025c2:	78 05                	js     8025c9 <vprintfmt+0x25c>
+  8025c4:	83 ef 01             	sub    $0x1,%edi
+  8025c7:	78 59                	js     802622 <vprintfmt+0x2b5>
+  8025c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8025cd:	74 d3                	je     8025a2 <vprintfmt+0x235>
+  8025cf:	0f be c0             	movsbl %al,%eax
+  8025d2:	83 e8 20             	sub    $0x20,%eax
+  8025d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8025d8:	76 c8                	jbe    8025a2 <vprintfmt+0x235>
+  8025da:	83 ec 08             	sub    $0x8,%esp
+  8025dd:	ff 75 0c             	push   0xc(%ebp)
+  8025e0:	6a 3f                	push   $0x3f
+  8025e2:	ff 55 08             	call   *0x8(%ebp)
+  8025e5:	83 c4 10             	add    $0x10,%esp
+  8025e8:	eb c5                	jmp    8025af <vprintfmt+0x242>
+  8025ea:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025f3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025f6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025fa:	7e 1b                	jle    802617 <vprintfmt+0x2aa>
+  8025fc:	83 ec 08             	sub    $0x8,%esp
+  8025ff:	53                   	push   %ebx
+  802600:	6a 20                	push   $0x20
+  802602:	ff d7                	call   *%edi
+  802604:	83 c4 10             	add    $0x10,%esp
+  802607:	83 ee 01             	sub    $0x1,%esi
+  80260a:	75 f0                	jne    8025fc <vprintfmt+0x28f>
+  80260c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80260f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802612:	e9 67 fd ff ff       	jmp    80237e <vprintfmt+0x11>
+  802617:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80261a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80261d:	e9 5c fd ff ff       	jmp    80237e <vprintfmt+0x11>
+  802622:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802625:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802628:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80262b:	eb c6                	jmp    8025f3 <vprintfmt+0x286>
+  80262d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802630:	89 55 10             	mov    %edx,0x10(%ebp)
+  802633:	83 f9 01             	cmp    $0x1,%ecx
+  802636:	7f 1f                	jg     802657 <vprintfmt+0x2ea>
+  802638:	85 c9                	test   %ecx,%ecx
+  80263a:	74 67                	je     8026a3 <vprintfmt+0x336>
+  80263c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80263f:	8b 30                	mov    (%eax),%esi
+  802641:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802644:	89 f0                	mov    %esi,%eax
+  802646:	c1 f8 1f             	sar    $0x1f,%eax
+  802649:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80264c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264f:	8d 40 04             	lea    0x4(%eax),%eax
+  802652:	89 45 14             	mov    %eax,0x14(%ebp)
+  802655:	eb 17                	jmp    80266e <vprintfmt+0x301>
+  802657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80265a:	8b 50 04             	mov    0x4(%eax),%edx
+  80265d:	8b 00                	mov    (%eax),%eax
+  80265f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802662:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802665:	8b 45 14             	mov    0x14(%ebp),%eax
+  802668:	8d 40 08             	lea    0x8(%eax),%eax
+  80266b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80266e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802671:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802674:	be 0a 00 00 00       	mov    $0xa,%esi
+  802679:	85 c9                	test   %ecx,%ecx
+  80267b:	0f 89 12 01 00 00    	jns    802793 <vprintfmt+0x426>
+  802681:	83 ec 08             	sub    $0x8,%esp
+  802684:	53                   	push   %ebx
+  802685:	6a 2d                	push   $0x2d
+  802687:	ff d7                	call   *%edi
+  802689:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80268c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80268f:	f7 da                	neg    %edx
+  802691:	83 d1 00             	adc    $0x0,%ecx
+  802694:	f7 d9                	neg    %ecx
+  802696:	83 c4 10             	add    $0x10,%esp
+  802699:	be 0a 00 00 00       	mov    $0xa,%esi
+  80269e:	e9 f0 00 00 00       	jmp    802793 <vprintfmt+0x426>
+  8026a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a6:	8b 30                	mov    (%eax),%esi
+  8026a8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8026ab:	89 f0                	mov    %esi,%eax
+  8026ad:	c1 f8 1f             	sar    $0x1f,%eax
+  8026b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8026b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8026b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026bc:	eb b0                	jmp    80266e <vprintfmt+0x301>
+  8026be:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026c1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026c4:	83 f9 01             	cmp    $0x1,%ecx
+  8026c7:	7f 1e                	jg     8026e7 <vprintfmt+0x37a>
+  8026c9:	85 c9                	test   %ecx,%ecx
+  8026cb:	74 32                	je     8026ff <vprintfmt+0x392>
+  8026cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026d0:	8b 10                	mov    (%eax),%edx
+  8026d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8026da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026dd:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026e2:	e9 ac 00 00 00       	jmp    802793 <vprintfmt+0x426>
+  8026e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026ea:	8b 10                	mov    (%eax),%edx
+  8026ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8026f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026f5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026fa:	e9 94 00 00 00       	jmp    802793 <vprintfmt+0x426>
+  8026ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  802702:	8b 10                	mov    (%eax),%edx
+  802704:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802709:	8d 40 04             	lea    0x4(%eax),%eax
+  80270c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80270f:	be 0a 00 00 00       	mov    $0xa,%esi
+  802714:	eb 7d                	jmp    802793 <vprintfmt+0x426>
+  802716:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802719:	89 55 10             	mov    %edx,0x10(%ebp)
+  80271c:	83 f9 01             	cmp    $0x1,%ecx
+  80271f:	7f 1b                	jg     80273c <vprintfmt+0x3cf>
+  802721:	85 c9                	test   %ecx,%ecx
+  802723:	74 2c                	je     802751 <vprintfmt+0x3e4>
+  802725:	8b 45 14             	mov    0x14(%ebp),%eax
+  802728:	8b 10                	mov    (%eax),%edx
+  80272a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80272f:	8d 40 04             	lea    0x4(%eax),%eax
+  802732:	89 45 14             	mov    %eax,0x14(%ebp)
+  802735:	be 08 00 00 00       	mov    $0x8,%esi
+  80273a:	eb 57                	jmp    802793 <vprintfmt+0x426>
+  80273c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80273f:	8b 10                	mov    (%eax),%edx
+  802741:	8b 48 04             	mov    0x4(%eax),%ecx
+  802744:	8d 40 08             	lea    0x8(%eax),%eax
+  802747:	89 45 14             	mov    %eax,0x14(%ebp)
+  80274a:	be 08 00 00 00       	mov    $0x8,%esi
+  80274f:	eb 42                	jmp    802793 <vprintfmt+0x426>
+  802751:	8b 45 14             	mov    0x14(%ebp),%eax
+  802754:	8b 10                	mov    (%eax),%edx
+  802756:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275b:	8d 40 04             	lea    0x4(%eax),%eax
+  80275e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802761:	be 08 00 00 00       	mov    $0x8,%esi
+  802766:	eb 2b                	jmp    802793 <vprintfmt+0x426>
+  802768:	89 55 10             	mov    %edx,0x10(%ebp)
+  80276b:	83 ec 08             	sub    $0x8,%esp
+  80276e:	53                   	push   %ebx
+  80276f:	6a 30                	push   $0x30
+  802771:	ff d7                	call   *%edi
+  802773:	83 c4 08             	add    $0x8,%esp
+  802776:	53                   	push   %ebx
+  802777:	6a 78                	push   $0x78
+  802779:	ff d7                	call   *%edi
+  80277b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80277e:	8b 10                	mov    (%eax),%edx
+  802780:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802785:	83 c4 10             	add    $0x10,%esp
+  802788:	8d 40 04             	lea    0x4(%eax),%eax
+  80278b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80278e:	be 10 00 00 00       	mov    $0x10,%esi
+  802793:	83 ec 0c             	sub    $0xc,%esp
+  802796:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80279a:	50                   	push   %eax
+  80279b:	ff 75 e4             	push   -0x1c(%ebp)
+  80279e:	56                   	push   %esi
+  80279f:	51                   	push   %ecx
+  8027a0:	52                   	push   %edx
+  8027a1:	89 da                	mov    %ebx,%edx
+  8027a3:	89 f8                	mov    %edi,%eax
+  8027a5:	e8 d8 fa ff ff       	call   802282 <printnum>
+  8027aa:	83 c4 20             	add    $0x20,%esp
+  8027ad:	e9 cc fb ff ff       	jmp    80237e <vprintfmt+0x11>
+  8027b2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8027b5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027b8:	83 f9 01             	cmp    $0x1,%ecx
+  8027bb:	7f 1b                	jg     8027d8 <vprintfmt+0x46b>
+  8027bd:	85 c9                	test   %ecx,%ecx
+  8027bf:	74 2c                	je     8027ed <vprintfmt+0x480>
+  8027c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c4:	8b 10                	mov    (%eax),%edx
+  8027c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8027ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027d1:	be 10 00 00 00       	mov    $0x10,%esi
+  8027d6:	eb bb                	jmp    802793 <vprintfmt+0x426>
+  8027d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027db:	8b 10                	mov    (%eax),%edx
+  8027dd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027e0:	8d 40 08             	lea    0x8(%eax),%eax
+  8027e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027e6:	be 10 00 00 00       	mov    $0x10,%esi
+  8027eb:	eb a6                	jmp    802793 <vprintfmt+0x426>
+  8027ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027f0:	8b 10                	mov    (%eax),%edx
+  8027f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8027fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027fd:	be 10 00 00 00       	mov    $0x10,%esi
+  802802:	eb 8f                	jmp    802793 <vprintfmt+0x426>
+  802804:	89 55 10             	mov    %edx,0x10(%ebp)
+  802807:	83 ec 08             	sub    $0x8,%esp
+  80280a:	53                   	push   %ebx
+  80280b:	6a 25                	push   $0x25
+  80280d:	ff d7                	call   *%edi
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	e9 67 fb ff ff       	jmp    80237e <vprintfmt+0x11>
+  802817:	83 ec 08             	sub    $0x8,%esp
+  80281a:	53                   	push   %ebx
+  80281b:	6a 25                	push   $0x25
+  80281d:	ff d7                	call   *%edi
+  80281f:	83 c4 10             	add    $0x10,%esp
+  802822:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  802826:	0f 84 ba fb ff ff    	je     8023e6 <vprintfmt+0x79>
+  80282c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80282f:	89 f0                	mov    %esi,%eax
+  802831:	83 e8 01             	sub    $0x1,%eax
+  802834:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802838:	75 f7                	jne    802831 <vprintfmt+0x4c4>
+  80283a:	89 45 10             	mov    %eax,0x10(%ebp)
+  80283d:	e9 3c fb ff ff       	jmp    80237e <vprintfmt+0x11>
+  802842:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802845:	8d 70 01             	lea    0x1(%eax),%esi
+  802848:	0f b6 00             	movzbl (%eax),%eax
+  80284b:	0f be d0             	movsbl %al,%edx
+  80284e:	85 d2                	test   %edx,%edx
+  802850:	74 11                	je     802863 <vprintfmt+0x4f6>
+  802852:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802855:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802858:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80285b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80285e:	e9 5d fd ff ff       	jmp    8025c0 <vprintfmt+0x253>
+  802863:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802866:	89 45 14             	mov    %eax,0x14(%ebp)
+  802869:	e9 10 fb ff ff       	jmp    80237e <vprintfmt+0x11>
+  80286e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802871:	89 45 14             	mov    %eax,0x14(%ebp)
+  802874:	e9 05 fb ff ff       	jmp    80237e <vprintfmt+0x11>
+  802879:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80287d:	7e 0a                	jle    802889 <vprintfmt+0x51c>
+  80287f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802883:	0f 85 bd fc ff ff    	jne    802546 <vprintfmt+0x1d9>
+  802889:	ba 28 00 00 00       	mov    $0x28,%edx
+  80288e:	b8 28 00 00 00       	mov    $0x28,%eax
+  802893:	be 49 33 80 00       	mov    $0x803349,%esi
+  802898:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80289b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80289e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8028a1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8028a4:	e9 17 fd ff ff       	jmp    8025c0 <vprintfmt+0x253>
+  8028a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ac:	5b                   	pop    %ebx
+  8028ad:	5e                   	pop    %esi
+  8028ae:	5f                   	pop    %edi
+  8028af:	5d                   	pop    %ebp
+  8028b0:	c3                   	ret
+
+008028b1 <vsnprintf>:
+  8028b1:	55                   	push   %ebp
+  8028b2:	89 e5                	mov    %esp,%ebp
+  8028b4:	83 ec 18             	sub    $0x18,%esp
+  8028b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028bd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8028c0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8028c4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8028c7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8028ce:	85 c0                	test   %eax,%eax
+  8028d0:	74 26                	je     8028f8 <vsnprintf+0x47>
+  8028d2:	85 d2                	test   %edx,%edx
+  8028d4:	7e 22                	jle    8028f8 <vsnprintf+0x47>
+  8028d6:	ff 75 14             	push   0x14(%ebp)
+  8028d9:	ff 75 10             	push   0x10(%ebp)
+  8028dc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028df:	50                   	push   %eax
+  8028e0:	68 33 23 80 00       	push   $0x802333
+  8028e5:	e8 83 fa ff ff       	call   80236d <vprintfmt>
+  8028ea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028ed:	c6 00 00             	movb   $0x0,(%eax)
+  8028f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028f3:	83 c4 10             	add    $0x10,%esp
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+  8028f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028fd:	eb f7                	jmp    8028f6 <vsnprintf+0x45>
+
+008028ff <snprintf>:
+  8028ff:	55                   	push   %ebp
+  802900:	89 e5                	mov    %esp,%ebp
+  802902:	83 ec 08             	sub    $0x8,%esp
+  802905:	8d 45 14             	lea    0x14(%ebp),%eax
+  802908:	50                   	push   %eax
+  802909:	ff 75 10             	push   0x10(%ebp)
+  80290c:	ff 75 0c             	push   0xc(%ebp)
+  80290f:	ff 75 08             	push   0x8(%ebp)
+  802912:	e8 9a ff ff ff       	call   8028b1 <vsnprintf>
+  802917:	c9                   	leave
+  802918:	c3                   	ret
+
+00802919 <strlen>:
+  802919:	55                   	push   %ebp
+  80291a:	89 e5                	mov    %esp,%ebp
+  80291c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80291f:	80 3a 00             	cmpb   $0x0,(%edx)
+  802922:	74 10                	je     802934 <strlen+0x1b>
+  802924:	b8 00 00 00 00       	mov    $0x0,%eax
+  802929:	83 c0 01             	add    $0x1,%eax
+  80292c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802930:	75 f7                	jne    802929 <strlen+0x10>
+  802932:	5d                   	pop    %ebp
+  802933:	c3                   	ret
+  802934:	b8 00 00 00 00       	mov    $0x0,%eax
+  802939:	eb f7                	jmp    802932 <strlen+0x19>
+
+0080293b <strnlen>:
+  80293b:	55                   	push   %ebp
+  80293c:	89 e5                	mov    %esp,%ebp
+  80293e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802941:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802944:	85 d2                	test   %edx,%edx
+  802946:	74 16                	je     80295e <strnlen+0x23>
+  802948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802951:	74 09                	je     80295c <strnlen+0x21>
+  802953:	83 c0 01             	add    $0x1,%eax
+  802956:	39 d0                	cmp    %edx,%eax
+  802958:	75 f3                	jne    80294d <strnlen+0x12>
+  80295a:	89 d0                	mov    %edx,%eax
+  80295c:	5d                   	pop    %ebp
+  80295d:	c3                   	ret
+  80295e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802963:	eb f7                	jmp    80295c <strnlen+0x21>
+
+00802965 <strcpy>:
+  802965:	55                   	push   %ebp
+  802966:	89 e5                	mov    %esp,%ebp
+  802968:	53                   	push   %ebx
+  802969:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80296c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80296f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802974:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802978:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80297b:	83 c0 01             	add    $0x1,%eax
+  80297e:	84 d2                	test   %dl,%dl
+  802980:	75 f2                	jne    802974 <strcpy+0xf>
+  802982:	89 c8                	mov    %ecx,%eax
+  802984:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802987:	c9                   	leave
+  802988:	c3                   	ret
+
+00802989 <strcat>:
+  802989:	55                   	push   %ebp
+  80298a:	89 e5                	mov    %esp,%ebp
+  80298c:	53                   	push   %ebx
+  80298d:	83 ec 10             	sub    $0x10,%esp
+  802990:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802993:	53                   	push   %ebx
+  802994:	e8 80 ff ff ff       	call   802919 <strlen>
+  802999:	83 c4 08             	add    $0x8,%esp
+  80299c:	ff 75 0c             	push   0xc(%ebp)
+  80299f:	01 d8                	add    %ebx,%eax
+  8029a1:	50                   	push   %eax
+  8029a2:	e8 be ff ff ff       	call   802965 <strcpy>
+  8029a7:	89 d8                	mov    %ebx,%eax
+  8029a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ac:	c9                   	leave
+  8029ad:	c3                   	ret
+
+008029ae <strncpy>:
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	56                   	push   %esi
+  8029b2:	53                   	push   %ebx
+  8029b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029bc:	85 db                	test   %ebx,%ebx
+  8029be:	74 17                	je     8029d7 <strncpy+0x29>
+  8029c0:	01 f3                	add    %esi,%ebx
+  8029c2:	89 f0                	mov    %esi,%eax
+  8029c4:	83 c0 01             	add    $0x1,%eax
+  8029c7:	0f b6 0a             	movzbl (%edx),%ecx
+  8029ca:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029cd:	80 f9 01             	cmp    $0x1,%cl
+  8029d0:	83 da ff             	sbb    $0xffffffff,%edx
+  8029d3:	39 c3                	cmp    %eax,%ebx
+  8029d5:	75 ed                	jne    8029c4 <strncpy+0x16>
+  8029d7:	89 f0                	mov    %esi,%eax
+  8029d9:	5b                   	pop    %ebx
+  8029da:	5e                   	pop    %esi
+  8029db:	5d                   	pop    %ebp
+  8029dc:	c3                   	ret
+
+008029dd <strlcpy>:
+  8029dd:	55                   	push   %ebp
+  8029de:	89 e5                	mov    %esp,%ebp
+  8029e0:	56                   	push   %esi
+  8029e1:	53                   	push   %ebx
+  8029e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029eb:	89 f0                	mov    %esi,%eax
+  8029ed:	85 db                	test   %ebx,%ebx
+  8029ef:	74 1e                	je     802a0f <strlcpy+0x32>
+  8029f1:	83 eb 01             	sub    $0x1,%ebx
+  8029f4:	74 16                	je     802a0c <strlcpy+0x2f>
+  8029f6:	01 f3                	add    %esi,%ebx
+  8029f8:	0f b6 0a             	movzbl (%edx),%ecx
+  8029fb:	84 c9                	test   %cl,%cl
+  8029fd:	74 0d                	je     802a0c <strlcpy+0x2f>
+  8029ff:	83 c2 01             	add    $0x1,%edx
+  802a02:	83 c0 01             	add    $0x1,%eax
+  802a05:	88 48 ff             	mov    %cl,-0x1(%eax)
+  802a08:	39 d8                	cmp    %ebx,%eax
+  802a0a:	75 ec                	jne    8029f8 <strlcpy+0x1b>
+  802a0c:	c6 00 00             	movb   $0x0,(%eax)
+  802a0f:	29 f0                	sub    %esi,%eax
+  802a11:	5b                   	pop    %ebx
+  802a12:	5e                   	pop    %esi
+  802a13:	5d                   	pop    %ebp
+  802a14:	c3                   	ret
+
+00802a15 <strcmp>:
+  802a15:	55                   	push   %ebp
+  802a16:	89 e5                	mov    %esp,%ebp
+  802a18:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a1e:	0f b6 01             	movzbl (%ecx),%eax
+  802a21:	84 c0                	test   %al,%al
+  802a23:	74 11                	je     802a36 <strcmp+0x21>
+  802a25:	38 02                	cmp    %al,(%edx)
+  802a27:	75 0d                	jne    802a36 <strcmp+0x21>
+  802a29:	83 c1 01             	add    $0x1,%ecx
+  802a2c:	83 c2 01             	add    $0x1,%edx
+  802a2f:	0f b6 01             	movzbl (%ecx),%eax
+  802a32:	84 c0                	test   %al,%al
+  802a34:	75 ef                	jne    802a25 <strcmp+0x10>
+  802a36:	0f b6 c0             	movzbl %al,%eax
+  802a39:	0f b6 12             	movzbl (%edx),%edx
+  802a3c:	29 d0                	sub    %edx,%eax
+  802a3e:	5d                   	pop    %ebp
+  802a3f:	c3                   	ret
+
+00802a40 <strncmp>:
+  802a40:	55                   	push   %ebp
+  802a41:	89 e5                	mov    %esp,%ebp
+  802a43:	53                   	push   %ebx
+  802a44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a4a:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a52:	85 d2                	test   %edx,%edx
+  802a54:	74 2e                	je     802a84 <strncmp+0x44>
+  802a56:	0f b6 01             	movzbl (%ecx),%eax
+  802a59:	84 c0                	test   %al,%al
+  802a5b:	74 16                	je     802a73 <strncmp+0x33>
+  802a5d:	3a 03                	cmp    (%ebx),%al
+  802a5f:	75 12                	jne    802a73 <strncmp+0x33>
+  802a61:	83 c1 01             	add    $0x1,%ecx
+  802a64:	83 c3 01             	add    $0x1,%ebx
+  802a67:	83 ea 01             	sub    $0x1,%edx
+  802a6a:	75 ea                	jne    802a56 <strncmp+0x16>
+  802a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a71:	eb 11                	jmp    802a84 <strncmp+0x44>
+  802a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a78:	85 d2                	test   %edx,%edx
+  802a7a:	74 08                	je     802a84 <strncmp+0x44>
+  802a7c:	0f b6 01             	movzbl (%ecx),%eax
+  802a7f:	0f b6 13             	movzbl (%ebx),%edx
+  802a82:	29 d0                	sub    %edx,%eax
+  802a84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a87:	c9                   	leave
+  802a88:	c3                   	ret
+
+00802a89 <strchr>:
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a93:	0f b6 10             	movzbl (%eax),%edx
+  802a96:	84 d2                	test   %dl,%dl
+  802a98:	74 15                	je     802aaf <strchr+0x26>
+  802a9a:	38 d1                	cmp    %dl,%cl
+  802a9c:	74 0f                	je     802aad <strchr+0x24>
+  802a9e:	83 c0 01             	add    $0x1,%eax
+  802aa1:	0f b6 10             	movzbl (%eax),%edx
+  802aa4:	84 d2                	test   %dl,%dl
+  802aa6:	75 f2                	jne    802a9a <strchr+0x11>
+  802aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aad:	5d                   	pop    %ebp
+  802aae:	c3                   	ret
+  802aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab4:	eb f7                	jmp    802aad <strchr+0x24>
+
+00802ab6 <strfind>:
+  802ab6:	55                   	push   %ebp
+  802ab7:	89 e5                	mov    %esp,%ebp
+  802ab9:	53                   	push   %ebx
+  802aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ac0:	0f b6 18             	movzbl (%eax),%ebx
+  802ac3:	38 d3                	cmp    %dl,%bl
+  802ac5:	74 14                	je     802adb <strfind+0x25>
+  802ac7:	89 d1                	mov    %edx,%ecx
+  802ac9:	84 db                	test   %bl,%bl
+  802acb:	74 0e                	je     802adb <strfind+0x25>
+  802acd:	83 c0 01             	add    $0x1,%eax
+  802ad0:	0f b6 10             	movzbl (%eax),%edx
+  802ad3:	38 ca                	cmp    %cl,%dl
+  802ad5:	74 04                	je     802adb <strfind+0x25>
+  802ad7:	84 d2                	test   %dl,%dl
+  802ad9:	75 f2                	jne    802acd <strfind+0x17>
+  802adb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+00802ae0 <memset>:
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	57                   	push   %edi
+  802ae4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ae7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802aea:	85 c9                	test   %ecx,%ecx
+  802aec:	74 20                	je     802b0e <memset+0x2e>
+  802aee:	89 f8                	mov    %edi,%eax
+  802af0:	09 c8                	or     %ecx,%eax
+  802af2:	a8 03                	test   $0x3,%al
+  802af4:	75 12                	jne    802b08 <memset+0x28>
+  802af6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802afa:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802b00:	c1 e9 02             	shr    $0x2,%ecx
+  802b03:	fc                   	cld
+  802b04:	f3 ab                	rep stos %eax,%es:(%edi)
+  802b06:	eb 06                	jmp    802b0e <memset+0x2e>
+  802b08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b0b:	fc                   	cld
+  802b0c:	f3 aa                	rep stos %al,%es:(%edi)
+  802b0e:	89 f8                	mov    %edi,%eax
+  802b10:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802b13:	c9                   	leave
+  802b14:	c3                   	ret
+
+00802b15 <memmove>:
+  802b15:	55                   	push   %ebp
+  802b16:	89 e5                	mov    %esp,%ebp
+  802b18:	57                   	push   %edi
+  802b19:	56                   	push   %esi
+  802b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b20:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802b23:	39 c6                	cmp    %eax,%esi
+  802b25:	73 32                	jae    802b59 <memmove+0x44>
+  802b27:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802b2a:	39 d0                	cmp    %edx,%eax
+  802b2c:	73 2b                	jae    802b59 <memmove+0x44>
+  802b2e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b31:	89 d6                	mov    %edx,%esi
+  802b33:	09 fe                	or     %edi,%esi
+  802b35:	09 ce                	or     %ecx,%esi
+  802b37:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b3d:	75 0e                	jne    802b4d <memmove+0x38>
+  802b3f:	83 ef 04             	sub    $0x4,%edi
+  802b42:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b45:	c1 e9 02             	shr    $0x2,%ecx
+  802b48:	fd                   	std
+  802b49:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b4b:	eb 09                	jmp    802b56 <memmove+0x41>
+  802b4d:	83 ef 01             	sub    $0x1,%edi
+  802b50:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b53:	fd                   	std
+  802b54:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b56:	fc                   	cld
+  802b57:	eb 1a                	jmp    802b73 <memmove+0x5e>
+  802b59:	89 f2                	mov    %esi,%edx
+  802b5b:	09 c2                	or     %eax,%edx
+  802b5d:	09 ca                	or     %ecx,%edx
+  802b5f:	f6 c2 03             	test   $0x3,%dl
+  802b62:	75 0a                	jne    802b6e <memmove+0x59>
+  802b64:	c1 e9 02             	shr    $0x2,%ecx
+  802b67:	89 c7                	mov    %eax,%edi
+  802b69:	fc                   	cld
+  802b6a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b6c:	eb 05                	jmp    802b73 <memmove+0x5e>
+  802b6e:	89 c7                	mov    %eax,%edi
+  802b70:	fc                   	cld
+  802b71:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b73:	5e                   	pop    %esi
+  802b74:	5f                   	pop    %edi
+  802b75:	5d                   	pop    %ebp
+  802b76:	c3                   	ret
+
+00802b77 <memcpy>:
+  802b77:	55                   	push   %ebp
+  802b78:	89 e5                	mov    %esp,%ebp
+  802b7a:	83 ec 0c             	sub    $0xc,%esp
+  802b7d:	ff 75 10             	push   0x10(%ebp)
+  802b80:	ff 75 0c             	push   0xc(%ebp)
+  802b83:	ff 75 08             	push   0x8(%ebp)
+  802b86:	e8 8a ff ff ff       	call   802b15 <memmove>
+  802b8b:	c9                   	leave
+  802b8c:	c3                   	ret
+
+00802b8d <memcmp>:
+  802b8d:	55                   	push   %ebp
+  802b8e:	89 e5                	mov    %esp,%ebp
+  802b90:	56                   	push   %esi
+  802b91:	53                   	push   %ebx
+  802b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b98:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b9b:	85 f6                	test   %esi,%esi
+  802b9d:	74 29                	je     802bc8 <memcmp+0x3b>
+  802b9f:	01 c6                	add    %eax,%esi
+  802ba1:	0f b6 08             	movzbl (%eax),%ecx
+  802ba4:	0f b6 1a             	movzbl (%edx),%ebx
+  802ba7:	38 d9                	cmp    %bl,%cl
+  802ba9:	75 11                	jne    802bbc <memcmp+0x2f>
+  802bab:	83 c0 01             	add    $0x1,%eax
+  802bae:	83 c2 01             	add    $0x1,%edx
+  802bb1:	39 c6                	cmp    %eax,%esi
+  802bb3:	75 ec                	jne    802ba1 <memcmp+0x14>
+  802bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bba:	eb 08                	jmp    802bc4 <memcmp+0x37>
+  802bbc:	0f b6 c1             	movzbl %cl,%eax
+  802bbf:	0f b6 db             	movzbl %bl,%ebx
+  802bc2:	29 d8                	sub    %ebx,%eax
+  802bc4:	5b                   	pop    %ebx
+  802bc5:	5e                   	pop    %esi
+  802bc6:	5d                   	pop    %ebp
+  802bc7:	c3                   	ret
+  802bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcd:	eb f5                	jmp    802bc4 <memcmp+0x37>
+
+00802bcf <memfind>:
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bd8:	89 c2                	mov    %eax,%edx
+  802bda:	03 55 10             	add    0x10(%ebp),%edx
+  802bdd:	39 d0                	cmp    %edx,%eax
+  802bdf:	73 0d                	jae    802bee <memfind+0x1f>
+  802be1:	38 08                	cmp    %cl,(%eax)
+  802be3:	74 0d                	je     802bf2 <memfind+0x23>
+  802be5:	83 c0 01             	add    $0x1,%eax
+  802be8:	39 c2                	cmp    %eax,%edx
+  802bea:	75 f5                	jne    802be1 <memfind+0x12>
+  802bec:	eb 06                	jmp    802bf4 <memfind+0x25>
+  802bee:	89 c2                	mov    %eax,%edx
+  802bf0:	eb 02                	jmp    802bf4 <memfind+0x25>
+  802bf2:	89 c2                	mov    %eax,%edx
+  802bf4:	89 d0                	mov    %edx,%eax
+  802bf6:	5d                   	pop    %ebp
+  802bf7:	c3                   	ret
+
+00802bf8 <strtol>:
+  802bf8:	55                   	push   %ebp
+  802bf9:	89 e5                	mov    %esp,%ebp
+  802bfb:	57                   	push   %edi
+  802bfc:	56                   	push   %esi
+  802bfd:	53                   	push   %ebx
+  802bfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c04:	0f b6 02             	movzbl (%edx),%eax
+  802c07:	3c 20                	cmp    $0x20,%al
+  802c09:	74 04                	je     802c0f <strtol+0x17>
+  802c0b:	3c 09                	cmp    $0x9,%al
+  802c0d:	75 0e                	jne    802c1d <strtol+0x25>
+  802c0f:	83 c2 01             	add    $0x1,%edx
+  802c12:	0f b6 02             	movzbl (%edx),%eax
+  802c15:	3c 20                	cmp    $0x20,%al
+  802c17:	74 f6                	je     802c0f <strtol+0x17>
+  802c19:	3c 09                	cmp    $0x9,%al
+  802c1b:	74 f2                	je     802c0f <strtol+0x17>
+  802c1d:	3c 2b                	cmp    $0x2b,%al
+  802c1f:	74 2a                	je     802c4b <strtol+0x53>
+  802c21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c26:	3c 2d                	cmp    $0x2d,%al
+  802c28:	74 2b                	je     802c55 <strtol+0x5d>
+  802c2a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c30:	75 0f                	jne    802c41 <strtol+0x49>
+  802c32:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c35:	74 28                	je     802c5f <strtol+0x67>
+  802c37:	85 db                	test   %ebx,%ebx
+  802c39:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c3e:	0f 44 d8             	cmove  %eax,%ebx
+  802c41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c46:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c49:	eb 46                	jmp    802c91 <strtol+0x99>
+  802c4b:	83 c2 01             	add    $0x1,%edx
+  802c4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c53:	eb d5                	jmp    802c2a <strtol+0x32>
+  802c55:	83 c2 01             	add    $0x1,%edx
+  802c58:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c5d:	eb cb                	jmp    802c2a <strtol+0x32>
+  802c5f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c63:	74 0e                	je     802c73 <strtol+0x7b>
+  802c65:	85 db                	test   %ebx,%ebx
+  802c67:	75 d8                	jne    802c41 <strtol+0x49>
+  802c69:	83 c2 01             	add    $0x1,%edx
+  802c6c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c71:	eb ce                	jmp    802c41 <strtol+0x49>
+  802c73:	83 c2 02             	add    $0x2,%edx
+  802c76:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c7b:	eb c4                	jmp    802c41 <strtol+0x49>
+  802c7d:	0f be c0             	movsbl %al,%eax
+  802c80:	83 e8 30             	sub    $0x30,%eax
+  802c83:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c86:	7d 3a                	jge    802cc2 <strtol+0xca>
+  802c88:	83 c2 01             	add    $0x1,%edx
+  802c8b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c8f:	01 c1                	add    %eax,%ecx
+  802c91:	0f b6 02             	movzbl (%edx),%eax
+  802c94:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c97:	89 f3                	mov    %esi,%ebx
+  802c99:	80 fb 09             	cmp    $0x9,%bl
+  802c9c:	76 df                	jbe    802c7d <strtol+0x85>
+  802c9e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802ca1:	89 f3                	mov    %esi,%ebx
+  802ca3:	80 fb 19             	cmp    $0x19,%bl
+  802ca6:	77 08                	ja     802cb0 <strtol+0xb8>
+  802ca8:	0f be c0             	movsbl %al,%eax
+  802cab:	83 e8 57             	sub    $0x57,%eax
+  802cae:	eb d3                	jmp    802c83 <strtol+0x8b>
+  802cb0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802cb3:	89 f3                	mov    %esi,%ebx
+  802cb5:	80 fb 19             	cmp    $0x19,%bl
+  802cb8:	77 08                	ja     802cc2 <strtol+0xca>
+  802cba:	0f be c0             	movsbl %al,%eax
+  802cbd:	83 e8 37             	sub    $0x37,%eax
+  802cc0:	eb c1                	jmp    802c83 <strtol+0x8b>
+  802cc2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802cc6:	74 05                	je     802ccd <strtol+0xd5>
+  802cc8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ccb:	89 10                	mov    %edx,(%eax)
+  802ccd:	89 c8                	mov    %ecx,%eax
+  802ccf:	f7 d8                	neg    %eax
+  802cd1:	85 ff                	test   %edi,%edi
+  802cd3:	0f 45 c8             	cmovne %eax,%ecx
+  802cd6:	89 c8                	mov    %ecx,%eax
+  802cd8:	5b                   	pop    %ebx
+  802cd9:	5e                   	pop    %esi
+  802cda:	5f                   	pop    %edi
+  802cdb:	5d                   	pop    %ebp
+  802cdc:	c3                   	ret
+
+00802cdd <ipc_recv>:
+  802cdd:	55                   	push   %ebp
+  802cde:	89 e5                	mov    %esp,%ebp
+  802ce0:	56                   	push   %esi
+  802ce1:	53                   	push   %ebx
+  802ce2:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ce5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ce8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cf2:	0f 44 c2             	cmove  %edx,%eax
+  802cf5:	83 ec 0c             	sub    $0xc,%esp
+  802cf8:	50                   	push   %eax
+  802cf9:	e8 73 d7 ff ff       	call   800471 <sys_ipc_recv>
+  802cfe:	83 c4 10             	add    $0x10,%esp
+  802d01:	85 c0                	test   %eax,%eax
+  802d03:	78 2a                	js     802d2f <ipc_recv+0x52>
+  802d05:	a1 10 50 80 00       	mov    0x805010,%eax
+  802d0a:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802d10:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802d16:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d1c:	85 f6                	test   %esi,%esi
+  802d1e:	74 02                	je     802d22 <ipc_recv+0x45>
+  802d20:	89 0e                	mov    %ecx,(%esi)
+  802d22:	85 db                	test   %ebx,%ebx
+  802d24:	74 02                	je     802d28 <ipc_recv+0x4b>
+  802d26:	89 13                	mov    %edx,(%ebx)
+  802d28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d2b:	5b                   	pop    %ebx
+  802d2c:	5e                   	pop    %esi
+  802d2d:	5d                   	pop    %ebp
+  802d2e:	c3                   	ret
+  802d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d39:	eb e1                	jmp    802d1c <ipc_recv+0x3f>
+
+00802d3b <ipc_send>:
+  802d3b:	55                   	push   %ebp
+  802d3c:	89 e5                	mov    %esp,%ebp
+  802d3e:	57                   	push   %edi
+  802d3f:	56                   	push   %esi
+  802d40:	53                   	push   %ebx
+  802d41:	83 ec 0c             	sub    $0xc,%esp
+  802d44:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d4a:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d4d:	85 db                	test   %ebx,%ebx
+  802d4f:	74 1e                	je     802d6f <ipc_send+0x34>
+  802d51:	56                   	push   %esi
+  802d52:	53                   	push   %ebx
+  802d53:	57                   	push   %edi
+  802d54:	ff 75 08             	push   0x8(%ebp)
+  802d57:	e8 a2 d7 ff ff       	call   8004fe <sys_ipc_send>
+  802d5c:	83 c4 10             	add    $0x10,%esp
+  802d5f:	85 c0                	test   %eax,%eax
+  802d61:	74 2a                	je     802d8d <ipc_send+0x52>
+  802d63:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d66:	75 13                	jne    802d7b <ipc_send+0x40>
+  802d68:	e8 0e d4 ff ff       	call   80017b <sys_yield>
+  802d6d:	eb e2                	jmp    802d51 <ipc_send+0x16>
+  802d6f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d74:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d79:	eb d6                	jmp    802d51 <ipc_send+0x16>
+  802d7b:	50                   	push   %eax
+  802d7c:	68 4c 36 80 00       	push   $0x80364c
+  802d81:	6a 4f                	push   $0x4f
+  802d83:	68 8f 36 80 00       	push   $0x80368f
+  802d88:	e8 06 f4 ff ff       	call   802193 <_panic>
+  802d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d90:	5b                   	pop    %ebx
+  802d91:	5e                   	pop    %esi
+  802d92:	5f                   	pop    %edi
+  802d93:	5d                   	pop    %ebp
+  802d94:	c3                   	ret
+
+00802d95 <ipc_call>:
+  802d95:	55                   	push   %ebp
+  802d96:	89 e5                	mov    %esp,%ebp
+  802d98:	57                   	push   %edi
+  802d99:	56                   	push   %esi
+  802d9a:	53                   	push   %ebx
+  802d9b:	83 ec 0c             	sub    $0xc,%esp
+  802d9e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802da2:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802da7:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802dab:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802daf:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802db4:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802db8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dc1:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802dc5:	eb 05                	jmp    802dcc <ipc_call+0x37>
+  802dc7:	e8 af d3 ff ff       	call   80017b <sys_yield>
+  802dcc:	83 ec 0c             	sub    $0xc,%esp
+  802dcf:	56                   	push   %esi
+  802dd0:	53                   	push   %ebx
+  802dd1:	57                   	push   %edi
+  802dd2:	ff 75 0c             	push   0xc(%ebp)
+  802dd5:	ff 75 08             	push   0x8(%ebp)
+  802dd8:	e8 71 d7 ff ff       	call   80054e <sys_ipc_call>
+  802ddd:	83 c4 20             	add    $0x20,%esp
+  802de0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802de3:	74 e2                	je     802dc7 <ipc_call+0x32>
+  802de5:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802de8:	74 2d                	je     802e17 <ipc_call+0x82>
+  802dea:	85 c0                	test   %eax,%eax
+  802dec:	78 4f                	js     802e3d <ipc_call+0xa8>
+  802dee:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802df2:	74 10                	je     802e04 <ipc_call+0x6f>
+  802df4:	a1 10 50 80 00       	mov    0x805010,%eax
+  802df9:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802dff:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802e02:	89 02                	mov    %eax,(%edx)
+  802e04:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e09:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e12:	5b                   	pop    %ebx
+  802e13:	5e                   	pop    %esi
+  802e14:	5f                   	pop    %edi
+  802e15:	5d                   	pop    %ebp
+  802e16:	c3                   	ret
+  802e17:	ff 75 14             	push   0x14(%ebp)
+  802e1a:	ff 75 10             	push   0x10(%ebp)
+  802e1d:	ff 75 0c             	push   0xc(%ebp)
+  802e20:	ff 75 08             	push   0x8(%ebp)
+  802e23:	e8 13 ff ff ff       	call   802d3b <ipc_send>
+  802e28:	83 c4 0c             	add    $0xc,%esp
+  802e2b:	ff 75 1c             	push   0x1c(%ebp)
+  802e2e:	ff 75 18             	push   0x18(%ebp)
+  802e31:	6a 00                	push   $0x0
+  802e33:	e8 a5 fe ff ff       	call   802cdd <ipc_recv>
+  802e38:	83 c4 10             	add    $0x10,%esp
+  802e3b:	eb d2                	jmp    802e0f <ipc_call+0x7a>
+  802e3d:	50                   	push   %eax
+  802e3e:	68 99 36 80 00       	push   $0x803699
+  802e43:	6a 6d                	push   $0x6d
+  802e45:	68 8f 36 80 00       	push   $0x80368f
+  802e4a:	e8 44 f3 ff ff       	call   802193 <_panic>
+
+00802e4f <ipc_reply_recv>:
+  802e4f:	55                   	push   %ebp
+  802e50:	89 e5                	mov    %esp,%ebp
+  802e52:	57                   	push   %edi
+  802e53:	56                   	push   %esi
+  802e54:	53                   	push   %ebx
+  802e55:	83 ec 0c             	sub    $0xc,%esp
+  802e58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e5b:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e5e:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e61:	85 db                	test   %ebx,%ebx
+  802e63:	0f 84 ac 00 00 00    	je     802f15 <ipc_reply_recv+0xc6>
+  802e69:	85 f6                	test   %esi,%esi
+  802e6b:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e70:	0f 45 c6             	cmovne %esi,%eax
+  802e73:	83 ec 0c             	sub    $0xc,%esp
+  802e76:	50                   	push   %eax
+  802e77:	ff 75 14             	push   0x14(%ebp)
+  802e7a:	53                   	push   %ebx
+  802e7b:	ff 75 0c             	push   0xc(%ebp)
+  802e7e:	ff 75 08             	push   0x8(%ebp)
+  802e81:	e8 e9 d6 ff ff       	call   80056f <sys_ipc_reply_recv>
+  802e86:	83 c4 20             	add    $0x20,%esp
+  802e89:	85 c0                	test   %eax,%eax
+  802e8b:	78 3a                	js     802ec7 <ipc_reply_recv+0x78>
+  802e8d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e91:	74 10                	je     802ea3 <ipc_reply_recv+0x54>
+  802e93:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e98:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e9e:	8b 55 18             	mov    0x18(%ebp),%edx
+  802ea1:	89 02                	mov    %eax,(%edx)
+  802ea3:	85 ff                	test   %edi,%edi
+  802ea5:	74 0d                	je     802eb4 <ipc_reply_recv+0x65>
+  802ea7:	a1 10 50 80 00       	mov    0x805010,%eax
+  802eac:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802eb2:	89 07                	mov    %eax,(%edi)
+  802eb4:	a1 10 50 80 00       	mov    0x805010,%eax
+  802eb9:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ebf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ec2:	5b                   	pop    %ebx
+  802ec3:	5e                   	pop    %esi
+  802ec4:	5f                   	pop    %edi
+  802ec5:	5d                   	pop    %ebp
+  802ec6:	c3                   	ret
+  802ec7:	ff 75 14             	push   0x14(%ebp)
+  802eca:	53                   	push   %ebx
+  802ecb:	ff 75 0c             	push   0xc(%ebp)
+  802ece:	ff 75 08             	push   0x8(%ebp)
+  802ed1:	e8 4b d5 ff ff       	call   800421 <sys_ipc_try_send>
+  802ed6:	89 c2                	mov    %eax,%edx
+  802ed8:	c1 ea 1f             	shr    $0x1f,%edx
+  802edb:	83 c4 10             	add    $0x10,%esp
+  802ede:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802ee1:	0f 95 c1             	setne  %cl
+  802ee4:	84 d1                	test   %dl,%cl
+  802ee6:	74 05                	je     802eed <ipc_reply_recv+0x9e>
+  802ee8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802eeb:	75 12                	jne    802eff <ipc_reply_recv+0xb0>
+  802eed:	83 ec 04             	sub    $0x4,%esp
+  802ef0:	57                   	push   %edi
+  802ef1:	56                   	push   %esi
+  802ef2:	ff 75 18             	push   0x18(%ebp)
+  802ef5:	e8 e3 fd ff ff       	call   802cdd <ipc_recv>
+  802efa:	83 c4 10             	add    $0x10,%esp
+  802efd:	eb c0                	jmp    802ebf <ipc_reply_recv+0x70>
+  802eff:	83 ec 04             	sub    $0x4,%esp
+  802f02:	50                   	push   %eax
+  802f03:	ff 75 08             	push   0x8(%ebp)
+  802f06:	68 6c 36 80 00       	push   $0x80366c
+  802f0b:	e8 5e f3 ff ff       	call   80226e <cprintf>
+  802f10:	83 c4 10             	add    $0x10,%esp
+  802f13:	eb d8                	jmp    802eed <ipc_reply_recv+0x9e>
+  802f15:	85 f6                	test   %esi,%esi
+  802f17:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f1c:	0f 45 c6             	cmovne %esi,%eax
+  802f1f:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f24:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f2b:	e9 43 ff ff ff       	jmp    802e73 <ipc_reply_recv+0x24>
+
+00802f30 <ipc_find_env>:
+  802f30:	55                   	push   %ebp
+  802f31:	89 e5                	mov    %esp,%ebp
+  802f33:	83 ec 14             	sub    $0x14,%esp
+  802f36:	ff 75 08             	push   0x8(%ebp)
+  802f39:	e8 81 d4 ff ff       	call   8003bf <sys_env_service>
+  802f3e:	85 c0                	test   %eax,%eax
+  802f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f45:	0f 48 c2             	cmovs  %edx,%eax
+  802f48:	c9                   	leave
+  802f49:	c3                   	ret
+
+00802f4a <pageref>:
+  802f4a:	55                   	push   %ebp
+  802f4b:	89 e5                	mov    %esp,%ebp
+  802f4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f50:	89 c2                	mov    %eax,%edx
+  802f52:	c1 ea 16             	shr    $0x16,%edx
+  802f55:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f61:	f6 c1 01             	test   $0x1,%cl
+  802f64:	74 22                	je     802f88 <pageref+0x3e>
+  802f66:	c1 e8 0c             	shr    $0xc,%eax
+  802f69:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f70:	a8 01                	test   $0x1,%al
+  802f72:	74 14                	je     802f88 <pageref+0x3e>
+  802f74:	c1 e8 0c             	shr    $0xc,%eax
+  802f77:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f7a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f81:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f85:	0f b7 d2             	movzwl %dx,%edx
+  802f88:	89 d0                	mov    %edx,%eax
+  802f8a:	5d                   	pop    %ebp
+  802f8b:	c3                   	ret
+
+00802f8c <__udivmoddi4>:
+  802f8c:	55                   	push   %ebp
+  802f8d:	57                   	push   %edi
+  802f8e:	56                   	push   %esi
+  802f8f:	53                   	push   %ebx
+  802f90:	83 ec 24             	sub    $0x24,%esp
+  802f93:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f97:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f9b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f9f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802fa3:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802fa7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802fab:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802faf:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802fb3:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802fc6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fcd:	00 
+  802fce:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fd5:	00 
+  802fd6:	89 fb                	mov    %edi,%ebx
+  802fd8:	eb 08                	jmp    802fe2 <__udivmoddi4+0x56>
+  802fda:	83 e9 01             	sub    $0x1,%ecx
+  802fdd:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fe0:	74 68                	je     80304a <__udivmoddi4+0xbe>
+  802fe2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fe6:	01 c0                	add    %eax,%eax
+  802fe8:	89 c6                	mov    %eax,%esi
+  802fea:	89 d7                	mov    %edx,%edi
+  802fec:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ff0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ff4:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ff7:	d3 ea                	shr    %cl,%edx
+  802ff9:	f6 c1 20             	test   $0x20,%cl
+  802ffc:	74 04                	je     803002 <__udivmoddi4+0x76>
+  802ffe:	89 d0                	mov    %edx,%eax
+  803000:	31 d2                	xor    %edx,%edx
+  803002:	83 e0 01             	and    $0x1,%eax
+  803005:	89 04 24             	mov    %eax,(%esp)
+  803008:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80300f:	00 
+  803010:	8b 04 24             	mov    (%esp),%eax
+  803013:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803017:	09 f0                	or     %esi,%eax
+  803019:	09 fa                	or     %edi,%edx
+  80301b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80301f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803023:	39 f0                	cmp    %esi,%eax
+  803025:	89 d5                	mov    %edx,%ebp
+  803027:	19 fd                	sbb    %edi,%ebp
+  803029:	72 af                	jb     802fda <__udivmoddi4+0x4e>
+  80302b:	29 f0                	sub    %esi,%eax
+  80302d:	19 fa                	sbb    %edi,%edx
+  80302f:	89 cf                	mov    %ecx,%edi
+  803031:	c1 ef 05             	shr    $0x5,%edi
+  803034:	83 e7 01             	and    $0x1,%edi
+  803037:	89 fe                	mov    %edi,%esi
+  803039:	83 f6 01             	xor    $0x1,%esi
+  80303c:	d3 e6                	shl    %cl,%esi
+  80303e:	d3 e7                	shl    %cl,%edi
+  803040:	09 74 24 18          	or     %esi,0x18(%esp)
+  803044:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803048:	eb 90                	jmp    802fda <__udivmoddi4+0x4e>
+  80304a:	85 db                	test   %ebx,%ebx
+  80304c:	74 05                	je     803053 <__udivmoddi4+0xc7>
+  80304e:	89 03                	mov    %eax,(%ebx)
+  803050:	89 53 04             	mov    %edx,0x4(%ebx)
+  803053:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803057:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80305b:	83 c4 24             	add    $0x24,%esp
+  80305e:	5b                   	pop    %ebx
+  80305f:	5e                   	pop    %esi
+  803060:	5f                   	pop    %edi
+  803061:	5d                   	pop    %ebp
+  803062:	c3                   	ret
+
+00803063 <__udivdi3>:
+  803063:	83 ec 08             	sub    $0x8,%esp
+  803066:	6a 00                	push   $0x0
+  803068:	ff 74 24 1c          	push   0x1c(%esp)
+  80306c:	ff 74 24 1c          	push   0x1c(%esp)
+  803070:	ff 74 24 1c          	push   0x1c(%esp)
+  803074:	ff 74 24 1c          	push   0x1c(%esp)
+  803078:	e8 0f ff ff ff       	call   802f8c <__udivmoddi4>
+  80307d:	83 c4 1c             	add    $0x1c,%esp
+  803080:	c3                   	ret
+
+00803081 <__umoddi3>:
+  803081:	83 ec 18             	sub    $0x18,%esp
+  803084:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803088:	50                   	push   %eax
+  803089:	ff 74 24 2c          	push   0x2c(%esp)
+  80308d:	ff 74 24 2c          	push   0x2c(%esp)
+  803091:	ff 74 24 2c          	push   0x2c(%esp)
+  803095:	ff 74 24 2c          	push   0x2c(%esp)
+  803099:	e8 ee fe ff ff       	call   802f8c <__udivmoddi4>
+  80309e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8030a2:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8030a6:	83 c4 2c             	add    $0x2c,%esp
+  8030a9:	c3                   	ret
+
+008030aa <__divdi3>:
+  8030aa:	53                   	push   %ebx
+  8030ab:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030af:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030b3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8030b7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030bb:	85 d2                	test   %edx,%edx
+  8030bd:	78 12                	js     8030d1 <__divdi3+0x27>
+  8030bf:	85 db                	test   %ebx,%ebx
+  8030c1:	78 2e                	js     8030f1 <__divdi3+0x47>
+  8030c3:	53                   	push   %ebx
+  8030c4:	51                   	push   %ecx
+  8030c5:	52                   	push   %edx
+  8030c6:	50                   	push   %eax
+  8030c7:	e8 97 ff ff ff       	call   803063 <__udivdi3>
+  8030cc:	83 c4 10             	add    $0x10,%esp
+  8030cf:	eb 1e                	jmp    8030ef <__divdi3+0x45>
+  8030d1:	f7 d8                	neg    %eax
+  8030d3:	83 d2 00             	adc    $0x0,%edx
+  8030d6:	f7 da                	neg    %edx
+  8030d8:	85 db                	test   %ebx,%ebx
+  8030da:	78 2a                	js     803106 <__divdi3+0x5c>
+  8030dc:	53                   	push   %ebx
+  8030dd:	51                   	push   %ecx
+  8030de:	52                   	push   %edx
+  8030df:	50                   	push   %eax
+  8030e0:	e8 7e ff ff ff       	call   803063 <__udivdi3>
+  8030e5:	83 c4 10             	add    $0x10,%esp
+  8030e8:	f7 d8                	neg    %eax
+  8030ea:	83 d2 00             	adc    $0x0,%edx
+  8030ed:	f7 da                	neg    %edx
+  8030ef:	5b                   	pop    %ebx
+  8030f0:	c3                   	ret
+  8030f1:	f7 d9                	neg    %ecx
+  8030f3:	83 d3 00             	adc    $0x0,%ebx
+  8030f6:	f7 db                	neg    %ebx
+  8030f8:	53                   	push   %ebx
+  8030f9:	51                   	push   %ecx
+  8030fa:	52                   	push   %edx
+  8030fb:	50                   	push   %eax
+  8030fc:	e8 62 ff ff ff       	call   803063 <__udivdi3>
+  803101:	83 c4 10             	add    $0x10,%esp
+  803104:	eb e2                	jmp    8030e8 <__divdi3+0x3e>
+  803106:	f7 d9                	neg    %ecx
+  803108:	83 d3 00             	adc    $0x0,%ebx
+  80310b:	f7 db                	neg    %ebx
+  80310d:	53                   	push   %ebx
+  80310e:	51                   	push   %ecx
+  80310f:	52                   	push   %edx
+  803110:	50                   	push   %eax
+  803111:	e8 4d ff ff ff       	call   803063 <__udivdi3>
+  803116:	83 c4 10             	add    $0x10,%esp
+  803119:	eb d4                	jmp    8030ef <__divdi3+0x45>
+
+0080311b <__moddi3>:
+  80311b:	55                   	push   %ebp
+  80311c:	57                   	push   %edi
+  80311d:	56                   	push   %esi
+  80311e:	53                   	push   %ebx
+  80311f:	83 ec 0c             	sub    $0xc,%esp
+  803122:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803126:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80312a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80312e:	89 e9                	mov    %ebp,%ecx
+  803130:	f7 d9                	neg    %ecx
+  803132:	89 d0                	mov    %edx,%eax
+  803134:	83 d0 00             	adc    $0x0,%eax
+  803137:	f7 d8                	neg    %eax
+  803139:	0f 49 e9             	cmovns %ecx,%ebp
+  80313c:	0f 49 d0             	cmovns %eax,%edx
+  80313f:	52                   	push   %edx
+  803140:	55                   	push   %ebp
+  803141:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803145:	f7 da                	neg    %edx
+  803147:	89 d8                	mov    %ebx,%eax
+  803149:	83 d0 00             	adc    $0x0,%eax
+  80314c:	f7 d8                	neg    %eax
+  80314e:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803153:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803157:	0f 48 c3             	cmovs  %ebx,%eax
+  80315a:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80315e:	ff 74 24 0c          	push   0xc(%esp)
+  803162:	ff 74 24 0c          	push   0xc(%esp)
+  803166:	e8 16 ff ff ff       	call   803081 <__umoddi3>
+  80316b:	83 c4 10             	add    $0x10,%esp
+  80316e:	85 db                	test   %ebx,%ebx
+  803170:	78 08                	js     80317a <__moddi3+0x5f>
+  803172:	83 c4 0c             	add    $0xc,%esp
+  803175:	5b                   	pop    %ebx
+  803176:	5e                   	pop    %esi
+  803177:	5f                   	pop    %edi
+  803178:	5d                   	pop    %ebp
+  803179:	c3                   	ret
+  80317a:	f7 d8                	neg    %eax
+  80317c:	83 d2 00             	adc    $0x0,%edx
+  80317f:	f7 da                	neg    %edx
+  803181:	eb ef                	jmp    803172 <__moddi3+0x57>
@@ -0,0 +1,5119 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 60 32 80 00       	push   $0x803260
+  80004a:	e8 3f 01 00 00       	call   80018e <cprintf>
+  80004f:	e8 27 0c 00 00       	call   800c7b <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 de 0b 00 00       	call   800c3a <sys_env_destroy>
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 e2 14 00 00       	call   801553 <set_pgfault_handler>
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	56                   	push   %esi
+  800084:	53                   	push   %ebx
+  800085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800088:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80008b:	e8 eb 0b 00 00       	call   800c7b <sys_getenvid>
+  800090:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800095:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80009b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a0:	a3 10 50 80 00       	mov    %eax,0x805010
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e 07                	jle    8000b0 <libmain+0x30>
+  8000a9:	8b 06                	mov    (%esi),%eax
+  8000ab:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	e8 a7 ff ff ff       	call   800061 <umain>
+  8000ba:	e8 0a 00 00 00       	call   8000c9 <exit>
+  8000bf:	83 c4 10             	add    $0x10,%esp
+  8000c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c5:	5b                   	pop    %ebx
+  8000c6:	5e                   	pop    %esi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 08             	sub    $0x8,%esp
+  8000cf:	a1 10 50 80 00       	mov    0x805010,%eax
+  8000d4:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000da:	85 c0                	test   %eax,%eax
+  8000dc:	75 14                	jne    8000f2 <exit+0x29>
+  8000de:	e8 dd 16 00 00       	call   8017c0 <close_all>
+  8000e3:	83 ec 0c             	sub    $0xc,%esp
+  8000e6:	6a 00                	push   $0x0
+  8000e8:	e8 4d 0b 00 00       	call   800c3a <sys_env_destroy>
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	c9                   	leave
+  8000f1:	c3                   	ret
+  8000f2:	e8 b0 12 00 00       	call   8013a7 <sys_lease_complete>
+  8000f7:	eb e5                	jmp    8000de <exit+0x15>
+
+008000f9 <putch>:
+  8000f9:	55                   	push   %ebp
+  8000fa:	89 e5                	mov    %esp,%ebp
+  8000fc:	53                   	push   %ebx
+  8000fd:	83 ec 04             	sub    $0x4,%esp
+  800100:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800103:	8b 13                	mov    (%ebx),%edx
+  800105:	8d 42 01             	lea    0x1(%edx),%eax
+  800108:	89 03                	mov    %eax,(%ebx)
+  80010a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80010d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800111:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800116:	74 09                	je     800121 <putch+0x28>
+  800118:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80011c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80011f:	c9                   	leave
+  800120:	c3                   	ret
+  800121:	83 ec 08             	sub    $0x8,%esp
+  800124:	68 ff 00 00 00       	push   $0xff
+  800129:	8d 43 08             	lea    0x8(%ebx),%eax
+  80012c:	50                   	push   %eax
+  80012d:	e8 cb 0a 00 00       	call   800bfd <sys_cputs>
+  800132:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	eb db                	jmp    800118 <putch+0x1f>
+
+0080013d <vcprintf>:
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800146:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80014d:	00 00 00 
+  800150:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800157:	00 00 00 
+  80015a:	ff 75 0c             	push   0xc(%ebp)
+  80015d:	ff 75 08             	push   0x8(%ebp)
+  800160:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800166:	50                   	push   %eax
+  800167:	68 f9 00 80 00       	push   $0x8000f9
+  80016c:	e8 1c 01 00 00       	call   80028d <vprintfmt>
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 77 0a 00 00       	call   800bfd <sys_cputs>
+  800186:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+
+0080018e <cprintf>:
+  80018e:	55                   	push   %ebp
+  80018f:	89 e5                	mov    %esp,%ebp
+  800191:	83 ec 10             	sub    $0x10,%esp
+  800194:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800197:	50                   	push   %eax
+  800198:	ff 75 08             	push   0x8(%ebp)
+  80019b:	e8 9d ff ff ff       	call   80013d <vcprintf>
+  8001a0:	c9                   	leave
+  8001a1:	c3                   	ret
+
+008001a2 <printnum>:
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	57                   	push   %edi
+  8001a6:	56                   	push   %esi
+  8001a7:	53                   	push   %ebx
+  8001a8:	83 ec 1c             	sub    $0x1c,%esp
+  8001ab:	89 c3                	mov    %eax,%ebx
+  8001ad:	89 d6                	mov    %edx,%esi
+  8001af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b5:	89 d1                	mov    %edx,%ecx
+  8001b7:	89 c2                	mov    %eax,%edx
+  8001b9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001bc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001bf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001c5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001cc:	39 c2                	cmp    %eax,%edx
+  8001ce:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d1:	73 4b                	jae    80021e <printnum+0x7c>
+  8001d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8001d6:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8001d9:	85 ff                	test   %edi,%edi
+  8001db:	7e 11                	jle    8001ee <printnum+0x4c>
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	56                   	push   %esi
+  8001e1:	ff 75 18             	push   0x18(%ebp)
+  8001e4:	ff d3                	call   *%ebx
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	83 ef 01             	sub    $0x1,%edi
+  8001ec:	75 ef                	jne    8001dd <printnum+0x3b>
+  8001ee:	83 ec 08             	sub    $0x8,%esp
+  8001f1:	56                   	push   %esi
+  8001f2:	83 ec 04             	sub    $0x4,%esp
+  8001f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f8:	ff 75 e0             	push   -0x20(%ebp)
+  8001fb:	ff 75 dc             	push   -0x24(%ebp)
+  8001fe:	ff 75 d8             	push   -0x28(%ebp)
+  800201:	e8 39 2f 00 00       	call   80313f <__umoddi3>
+  800206:	83 c4 14             	add    $0x14,%esp
+  800209:	0f be 80 86 32 80 00 	movsbl 0x803286(%eax),%eax
+  800210:	50                   	push   %eax
+  800211:	ff d3                	call   *%ebx
+  800213:	83 c4 10             	add    $0x10,%esp
+  800216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800219:	5b                   	pop    %ebx
+  80021a:	5e                   	pop    %esi
+  80021b:	5f                   	pop    %edi
+  80021c:	5d                   	pop    %ebp
+  80021d:	c3                   	ret
+  80021e:	83 ec 0c             	sub    $0xc,%esp
+  800221:	ff 75 18             	push   0x18(%ebp)
+  800224:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800227:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80022a:	52                   	push   %edx
+  80022b:	50                   	push   %eax
+  80022c:	83 ec 08             	sub    $0x8,%esp
+  80022f:	ff 75 e4             	push   -0x1c(%ebp)
+  800232:	ff 75 e0             	push   -0x20(%ebp)
+  800235:	ff 75 dc             	push   -0x24(%ebp)
+  800238:	ff 75 d8             	push   -0x28(%ebp)
+  80023b:	e8 e1 2e 00 00       	call   803121 <__udivdi3>
+  800240:	83 c4 18             	add    $0x18,%esp
+  800243:	52                   	push   %edx
+  800244:	50                   	push   %eax
+  800245:	89 f2                	mov    %esi,%edx
+  800247:	89 d8                	mov    %ebx,%eax
+  800249:	e8 54 ff ff ff       	call   8001a2 <printnum>
+  80024e:	83 c4 20             	add    $0x20,%esp
+  800251:	eb 9b                	jmp    8001ee <printnum+0x4c>
+
+00800253 <sprintputch>:
+  800253:	55                   	push   %ebp
+  800254:	89 e5                	mov    %esp,%ebp
+  800256:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800259:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80025d:	8b 10                	mov    (%eax),%edx
+  80025f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800262:	73 0a                	jae    80026e <sprintputch+0x1b>
+  800264:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800267:	89 08                	mov    %ecx,(%eax)
+  800269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026c:	88 02                	mov    %al,(%edx)
+  80026e:	5d                   	pop    %ebp
+  80026f:	c3                   	ret
+
+00800270 <printfmt>:
+  800270:	55                   	push   %ebp
+  800271:	89 e5                	mov    %esp,%ebp
+  800273:	83 ec 08             	sub    $0x8,%esp
+  800276:	8d 45 14             	lea    0x14(%ebp),%eax
+  800279:	50                   	push   %eax
+  80027a:	ff 75 10             	push   0x10(%ebp)
+  80027d:	ff 75 0c             	push   0xc(%ebp)
+  800280:	ff 75 08             	push   0x8(%ebp)
+  800283:	e8 05 00 00 00       	call   80028d <vprintfmt>
+  800288:	83 c4 10             	add    $0x10,%esp
+  80028b:	c9                   	leave
+  80028c:	c3                   	ret
+
+0080028d <vprintfmt>:
+  80028d:	55                   	push   %ebp
+  80028e:	89 e5                	mov    %esp,%ebp
+  800290:	57                   	push   %edi
+  800291:	56                   	push   %esi
+  800292:	53                   	push   %ebx
+  800293:	83 ec 2c             	sub    $0x2c,%esp
+  800296:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800299:	89 df                	mov    %ebx,%edi
+  80029b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80029e:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a1:	8d 70 01             	lea    0x1(%eax),%esi
+  8002a4:	0f b6 00             	movzbl (%eax),%eax
+  8002a7:	83 f8 25             	cmp    $0x25,%eax
+  8002aa:	74 1e                	je     8002ca <vprintfmt+0x3d>
+  8002ac:	85 c0                	test   %eax,%eax
+  8002ae:	0f 84 15 05 00 00    	je     8007c9 <vprintfmt+0x53c>
+  8002b4:	83 ec 08             	sub    $0x8,%esp
+  8002b7:	53                   	push   %ebx
+  8002b8:	50                   	push   %eax
+  8002b9:	ff d7                	call   *%edi
+  8002bb:	83 c6 01             	add    $0x1,%esi
+  8002be:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002c2:	83 c4 10             	add    $0x10,%esp
+  8002c5:	83 f8 25             	cmp    $0x25,%eax
+  8002c8:	75 e2                	jne    8002ac <vprintfmt+0x1f>
+  8002ca:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8002ce:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002d5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8002dc:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8002e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002e8:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8002eb:	8d 56 01             	lea    0x1(%esi),%edx
+  8002ee:	0f b6 0e             	movzbl (%esi),%ecx
+  8002f1:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8002f4:	3c 55                	cmp    $0x55,%al
+  8002f6:	0f 87 3b 04 00 00    	ja     800737 <vprintfmt+0x4aa>
+  8002fc:	0f b6 c0             	movzbl %al,%eax
+  8002ff:	ff 24 85 c0 33 80 00 	jmp    *0x8033c0(,%eax,4)
+  800306:	89 75 10             	mov    %esi,0x10(%ebp)
+  800309:	eb 93                	jmp    80029e <vprintfmt+0x11>
+  80030b:	89 d6                	mov    %edx,%esi
+  80030d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800311:	eb d8                	jmp    8002eb <vprintfmt+0x5e>
+  800313:	89 d6                	mov    %edx,%esi
+  800315:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800319:	eb d0                	jmp    8002eb <vprintfmt+0x5e>
+  80031b:	0f b6 c9             	movzbl %cl,%ecx
+  80031e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800321:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800324:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800328:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80032b:	83 f9 09             	cmp    $0x9,%ecx
+  80032e:	77 6f                	ja     80039f <vprintfmt+0x112>
+  800330:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800333:	83 c2 01             	add    $0x1,%edx
+  800336:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800339:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80033d:	0f be 02             	movsbl (%edx),%eax
+  800340:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800343:	83 fe 09             	cmp    $0x9,%esi
+  800346:	76 eb                	jbe    800333 <vprintfmt+0xa6>
+  800348:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80034b:	89 d6                	mov    %edx,%esi
+  80034d:	eb 13                	jmp    800362 <vprintfmt+0xd5>
+  80034f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800352:	8b 00                	mov    (%eax),%eax
+  800354:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800357:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035a:	8d 40 04             	lea    0x4(%eax),%eax
+  80035d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800360:	89 d6                	mov    %edx,%esi
+  800362:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800366:	79 83                	jns    8002eb <vprintfmt+0x5e>
+  800368:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80036b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80036e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800375:	e9 71 ff ff ff       	jmp    8002eb <vprintfmt+0x5e>
+  80037a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80037d:	85 c9                	test   %ecx,%ecx
+  80037f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800384:	0f 49 c1             	cmovns %ecx,%eax
+  800387:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80038a:	89 d6                	mov    %edx,%esi
+  80038c:	e9 5a ff ff ff       	jmp    8002eb <vprintfmt+0x5e>
+  800391:	89 d6                	mov    %edx,%esi
+  800393:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80039a:	e9 4c ff ff ff       	jmp    8002eb <vprintfmt+0x5e>
+  80039f:	89 d6                	mov    %edx,%esi
+  8003a1:	eb bf                	jmp    800362 <vprintfmt+0xd5>
+  8003a3:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8003a7:	89 d6                	mov    %edx,%esi
+  8003a9:	e9 3d ff ff ff       	jmp    8002eb <vprintfmt+0x5e>
+  8003ae:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8d 70 04             	lea    0x4(%eax),%esi
+  8003b7:	83 ec 08             	sub    $0x8,%esp
+  8003ba:	53                   	push   %ebx
+  8003bb:	ff 30                	push   (%eax)
+  8003bd:	ff d7                	call   *%edi
+  8003bf:	83 c4 10             	add    $0x10,%esp
+  8003c2:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003c5:	e9 d4 fe ff ff       	jmp    80029e <vprintfmt+0x11>
+  8003ca:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d0:	8d 70 04             	lea    0x4(%eax),%esi
+  8003d3:	8b 10                	mov    (%eax),%edx
+  8003d5:	89 d0                	mov    %edx,%eax
+  8003d7:	f7 d8                	neg    %eax
+  8003d9:	0f 48 c2             	cmovs  %edx,%eax
+  8003dc:	83 f8 12             	cmp    $0x12,%eax
+  8003df:	7f 23                	jg     800404 <vprintfmt+0x177>
+  8003e1:	8b 14 85 20 35 80 00 	mov    0x803520(,%eax,4),%edx
+  8003e8:	85 d2                	test   %edx,%edx
+  8003ea:	74 18                	je     800404 <vprintfmt+0x177>
+  8003ec:	52                   	push   %edx
+  8003ed:	68 f3 36 80 00       	push   $0x8036f3
+  8003f2:	53                   	push   %ebx
+  8003f3:	57                   	push   %edi
+  8003f4:	e8 77 fe ff ff       	call   800270 <printfmt>
+  8003f9:	83 c4 10             	add    $0x10,%esp
+  8003fc:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003ff:	e9 9a fe ff ff       	jmp    80029e <vprintfmt+0x11>
+  800404:	50                   	push   %eax
+  800405:	68 9e 32 80 00       	push   $0x80329e
+  80040a:	53                   	push   %ebx
+  80040b:	57                   	push   %edi
+  80040c:	e8 5f fe ff ff       	call   800270 <printfmt>
+  800411:	83 c4 10             	add    $0x10,%esp
+  800414:	89 75 14             	mov    %esi,0x14(%ebp)
+  800417:	e9 82 fe ff ff       	jmp    80029e <vprintfmt+0x11>
+  80041c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80041f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800422:	83 c0 04             	add    $0x4,%eax
+  800425:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800428:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042b:	8b 00                	mov    (%eax),%eax
+  80042d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800430:	85 c0                	test   %eax,%eax
+  800432:	0f 84 61 03 00 00    	je     800799 <vprintfmt+0x50c>
+  800438:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80043c:	7e 06                	jle    800444 <vprintfmt+0x1b7>
+  80043e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800442:	75 29                	jne    80046d <vprintfmt+0x1e0>
+  800444:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800447:	8d 70 01             	lea    0x1(%eax),%esi
+  80044a:	0f b6 00             	movzbl (%eax),%eax
+  80044d:	0f be d0             	movsbl %al,%edx
+  800450:	85 d2                	test   %edx,%edx
+  800452:	0f 84 bb 00 00 00    	je     800513 <vprintfmt+0x286>
+  800458:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80045b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80045e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800461:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800464:	eb 7a                	jmp    8004e0 <vprintfmt+0x253>
+  800466:	c7 45 d0 97 32 80 00 	movl   $0x803297,-0x30(%ebp)
+  80046d:	83 ec 08             	sub    $0x8,%esp
+  800470:	ff 75 d4             	push   -0x2c(%ebp)
+  800473:	ff 75 d0             	push   -0x30(%ebp)
+  800476:	e8 e0 03 00 00       	call   80085b <strnlen>
+  80047b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80047e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800481:	83 c4 10             	add    $0x10,%esp
+  800484:	85 d2                	test   %edx,%edx
+  800486:	0f 8e d6 02 00 00    	jle    800762 <vprintfmt+0x4d5>
+  80048c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	53                   	push   %ebx
+  800494:	56                   	push   %esi
+  800495:	ff d7                	call   *%edi
+  800497:	83 c4 10             	add    $0x10,%esp
+  80049a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80049e:	75 f0                	jne    800490 <vprintfmt+0x203>
+  8004a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004a3:	8d 70 01             	lea    0x1(%eax),%esi
+  8004a6:	0f b6 00             	movzbl (%eax),%eax
+  8004a9:	0f be d0             	movsbl %al,%edx
+  8004ac:	85 d2                	test   %edx,%edx
+  8004ae:	0f 84 da 02 00 00    	je     80078e <vprintfmt+0x501>
+  8004b4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004b7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004ba:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004bd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004c0:	eb 1e                	jmp    8004e0 <vprintfmt+0x253>
+  8004c2:	83 ec 08             	sub    $0x8,%esp
+  8004c5:	ff 75 0c             	push   0xc(%ebp)
+  8004c8:	52                   	push   %edx
+  8004c9:	ff 55 08             	call   *0x8(%ebp)
+  8004cc:	83 c4 10             	add    $0x10,%esp
+  8004cf:	83 eb 01             	sub    $0x1,%ebx
+  8004d2:	83 c6 01             	add    $0x1,%esi
+  8004d5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004d9:	0f be d0             	movsbl %al,%edx
+  8004dc:	85 d2                	test   %edx,%edx
+  8004de:	74 2a                	je     80050a <vprintfmt+0x27d>
+  8004e0:	85 ff                	test   %edi,%edi
+  8004e2:	78 05                	js     8004e9 <vprintfmt+0x25c>
+  8004e4:	83 ef 01             	sub    $0x1,%edi
+  8004e7:	78 59                	js     800542 <vprintfmt+0x2b5>
+  8004e9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ed:	74 d3                	je     8004c2 <vprintfmt+0x235>
+  8004ef:	0f be c0             	movsbl %al,%eax
+  8004f2:	83 e8 20             	sub    $0x20,%eax
+  8004f5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004f8:	76 c8                	jbe    8004c2 <vprintfmt+0x235>
+  8004fa:	83 ec 08             	sub    $0x8,%esp
+  8004fd:	ff 75 0c             	push   0xc(%ebp)
+  800500:	6a 3f                	push   $0x3f
+  800502:	ff 55 08             	call   *0x8(%ebp)
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	eb c5                	jmp    8004cf <vprintfmt+0x242>
+  80050a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80050d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800510:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800513:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800516:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80051a:	7e 1b                	jle    800537 <vprintfmt+0x2aa>
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	6a 20                	push   $0x20
+  800522:	ff d7                	call   *%edi
+  800524:	83 c4 10             	add    $0x10,%esp
+  800527:	83 ee 01             	sub    $0x1,%esi
+  80052a:	75 f0                	jne    80051c <vprintfmt+0x28f>
+  80052c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80052f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800532:	e9 67 fd ff ff       	jmp    80029e <vprintfmt+0x11>
+  800537:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053d:	e9 5c fd ff ff       	jmp    80029e <vprintfmt+0x11>
+  800542:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800545:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800548:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80054b:	eb c6                	jmp    800513 <vprintfmt+0x286>
+  80054d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800550:	89 55 10             	mov    %edx,0x10(%ebp)
+  800553:	83 f9 01             	cmp    $0x1,%ecx
+  800556:	7f 1f                	jg     800577 <vprintfmt+0x2ea>
+  800558:	85 c9                	test   %ecx,%ecx
+  80055a:	74 67                	je     8005c3 <vprintfmt+0x336>
+  80055c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055f:	8b 30                	mov    (%eax),%esi
+  800561:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800564:	89 f0                	mov    %esi,%eax
+  800566:	c1 f8 1f             	sar    $0x1f,%eax
+  800569:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80056c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056f:	8d 40 04             	lea    0x4(%eax),%eax
+  800572:	89 45 14             	mov    %eax,0x14(%ebp)
+  800575:	eb 17                	jmp    80058e <vprintfmt+0x301>
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	8b 50 04             	mov    0x4(%eax),%edx
+  80057d:	8b 00                	mov    (%eax),%eax
+  80057f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800582:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8d 40 08             	lea    0x8(%eax),%eax
+  80058b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800591:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800594:	be 0a 00 00 00       	mov    $0xa,%esi
+  800599:	85 c9                	test   %ecx,%ecx
+  80059b:	0f 89 12 01 00 00    	jns    8006b3 <vprintfmt+0x426>
+  8005a1:	83 ec 08             	sub    $0x8,%esp
+  8005a4:	53                   	push   %ebx
+  8005a5:	6a 2d                	push   $0x2d
+  8005a7:	ff d7                	call   *%edi
+  8005a9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ac:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005af:	f7 da                	neg    %edx
+  8005b1:	83 d1 00             	adc    $0x0,%ecx
+  8005b4:	f7 d9                	neg    %ecx
+  8005b6:	83 c4 10             	add    $0x10,%esp
+  8005b9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005be:	e9 f0 00 00 00       	jmp    8006b3 <vprintfmt+0x426>
+  8005c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c6:	8b 30                	mov    (%eax),%esi
+  8005c8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005cb:	89 f0                	mov    %esi,%eax
+  8005cd:	c1 f8 1f             	sar    $0x1f,%eax
+  8005d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005dc:	eb b0                	jmp    80058e <vprintfmt+0x301>
+  8005de:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005e1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e4:	83 f9 01             	cmp    $0x1,%ecx
+  8005e7:	7f 1e                	jg     800607 <vprintfmt+0x37a>
+  8005e9:	85 c9                	test   %ecx,%ecx
+  8005eb:	74 32                	je     80061f <vprintfmt+0x392>
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8b 10                	mov    (%eax),%edx
+  8005f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fd:	be 0a 00 00 00       	mov    $0xa,%esi
+  800602:	e9 ac 00 00 00       	jmp    8006b3 <vprintfmt+0x426>
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 10                	mov    (%eax),%edx
+  80060c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80060f:	8d 40 08             	lea    0x8(%eax),%eax
+  800612:	89 45 14             	mov    %eax,0x14(%ebp)
+  800615:	be 0a 00 00 00       	mov    $0xa,%esi
+  80061a:	e9 94 00 00 00       	jmp    8006b3 <vprintfmt+0x426>
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 10                	mov    (%eax),%edx
+  800624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800629:	8d 40 04             	lea    0x4(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800634:	eb 7d                	jmp    8006b3 <vprintfmt+0x426>
+  800636:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800639:	89 55 10             	mov    %edx,0x10(%ebp)
+  80063c:	83 f9 01             	cmp    $0x1,%ecx
+  80063f:	7f 1b                	jg     80065c <vprintfmt+0x3cf>
+  800641:	85 c9                	test   %ecx,%ecx
+  800643:	74 2c                	je     800671 <vprintfmt+0x3e4>
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8b 10                	mov    (%eax),%edx
+  80064a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	be 08 00 00 00       	mov    $0x8,%esi
+  80065a:	eb 57                	jmp    8006b3 <vprintfmt+0x426>
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 10                	mov    (%eax),%edx
+  800661:	8b 48 04             	mov    0x4(%eax),%ecx
+  800664:	8d 40 08             	lea    0x8(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066a:	be 08 00 00 00       	mov    $0x8,%esi
+  80066f:	eb 42                	jmp    8006b3 <vprintfmt+0x426>
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 10                	mov    (%eax),%edx
+  800676:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800681:	be 08 00 00 00       	mov    $0x8,%esi
+  800686:	eb 2b                	jmp    8006b3 <vprintfmt+0x426>
+  800688:	89 55 10             	mov    %edx,0x10(%ebp)
+  80068b:	83 ec 08             	sub    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	6a 30                	push   $0x30
+  800691:	ff d7                	call   *%edi
+  800693:	83 c4 08             	add    $0x8,%esp
+  800696:	53                   	push   %ebx
+  800697:	6a 78                	push   $0x78
+  800699:	ff d7                	call   *%edi
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8b 10                	mov    (%eax),%edx
+  8006a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a5:	83 c4 10             	add    $0x10,%esp
+  8006a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ae:	be 10 00 00 00       	mov    $0x10,%esi
+  8006b3:	83 ec 0c             	sub    $0xc,%esp
+  8006b6:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006ba:	50                   	push   %eax
+  8006bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8006be:	56                   	push   %esi
+  8006bf:	51                   	push   %ecx
+  8006c0:	52                   	push   %edx
+  8006c1:	89 da                	mov    %ebx,%edx
+  8006c3:	89 f8                	mov    %edi,%eax
+  8006c5:	e8 d8 fa ff ff       	call   8001a2 <printnum>
+  8006ca:	83 c4 20             	add    $0x20,%esp
+  8006cd:	e9 cc fb ff ff       	jmp    80029e <vprintfmt+0x11>
+  8006d2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006d5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006d8:	83 f9 01             	cmp    $0x1,%ecx
+  8006db:	7f 1b                	jg     8006f8 <vprintfmt+0x46b>
+  8006dd:	85 c9                	test   %ecx,%ecx
+  8006df:	74 2c                	je     80070d <vprintfmt+0x480>
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 10                	mov    (%eax),%edx
+  8006e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f1:	be 10 00 00 00       	mov    $0x10,%esi
+  8006f6:	eb bb                	jmp    8006b3 <vprintfmt+0x426>
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8b 10                	mov    (%eax),%edx
+  8006fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800700:	8d 40 08             	lea    0x8(%eax),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+  800706:	be 10 00 00 00       	mov    $0x10,%esi
+  80070b:	eb a6                	jmp    8006b3 <vprintfmt+0x426>
+  80070d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800710:	8b 10                	mov    (%eax),%edx
+  800712:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071d:	be 10 00 00 00       	mov    $0x10,%esi
+  800722:	eb 8f                	jmp    8006b3 <vprintfmt+0x426>
+  800724:	89 55 10             	mov    %edx,0x10(%ebp)
+  800727:	83 ec 08             	sub    $0x8,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	6a 25                	push   $0x25
+  80072d:	ff d7                	call   *%edi
+  80072f:	83 c4 10             	add    $0x10,%esp
+  800732:	e9 67 fb ff ff       	jmp    80029e <vprintfmt+0x11>
+  800737:	83 ec 08             	sub    $0x8,%esp
+  80073a:	53                   	push   %ebx
+  80073b:	6a 25                	push   $0x25
+  80073d:	ff d7                	call   *%edi
+  80073f:	83 c4 10             	add    $0x10,%esp
+  800742:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800746:	0f 84 ba fb ff ff    	je     800306 <vprintfmt+0x79>
+  80074c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80074f:	89 f0                	mov    %esi,%eax
+  800751:	83 e8 01             	sub    $0x1,%eax
+  800754:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800758:	75 f7                	jne    800751 <vprintfmt+0x4c4>
+  80075a:	89 45 10             	mov    %eax,0x10(%ebp)
+  80075d:	e9 3c fb ff ff       	jmp    80029e <vprintfmt+0x11>
+  800762:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800765:	8d 70 01             	lea    0x1(%eax),%esi
+  800768:	0f b6 00             	movzbl (%eax),%eax
+  80076b:	0f be d0             	movsbl %al,%edx
+  80076e:	85 d2                	test   %edx,%edx
+  800770:	74 11                	je     800783 <vprintfmt+0x4f6>
+  800772:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800775:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800778:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80077b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80077e:	e9 5d fd ff ff       	jmp    8004e0 <vprintfmt+0x253>
+  800783:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+  800789:	e9 10 fb ff ff       	jmp    80029e <vprintfmt+0x11>
+  80078e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+  800794:	e9 05 fb ff ff       	jmp    80029e <vprintfmt+0x11>
+  800799:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80079d:	7e 0a                	jle    8007a9 <vprintfmt+0x51c>
+  80079f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007a3:	0f 85 bd fc ff ff    	jne    800466 <vprintfmt+0x1d9>
+  8007a9:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007ae:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007b3:	be 98 32 80 00       	mov    $0x803298,%esi
+  8007b8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007bb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007be:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007c1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c4:	e9 17 fd ff ff       	jmp    8004e0 <vprintfmt+0x253>
+  8007c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007cc:	5b                   	pop    %ebx
+  8007cd:	5e                   	pop    %esi
+  8007ce:	5f                   	pop    %edi
+  8007cf:	5d                   	pop    %ebp
+  8007d0:	c3                   	ret
+
+008007d1 <vsnprintf>:
+  8007d1:	55                   	push   %ebp
+  8007d2:	89 e5                	mov    %esp,%ebp
+  8007d4:	83 ec 18             	sub    $0x18,%esp
+  8007d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007dd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007e0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007e4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8007ee:	85 c0                	test   %eax,%eax
+  8007f0:	74 26                	je     800818 <vsnprintf+0x47>
+  8007f2:	85 d2                	test   %edx,%edx
+  8007f4:	7e 22                	jle    800818 <vsnprintf+0x47>
+  8007f6:	ff 75 14             	push   0x14(%ebp)
+  8007f9:	ff 75 10             	push   0x10(%ebp)
+  8007fc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007ff:	50                   	push   %eax
+  800800:	68 53 02 80 00       	push   $0x800253
+  800805:	e8 83 fa ff ff       	call   80028d <vprintfmt>
+  80080a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80080d:	c6 00 00             	movb   $0x0,(%eax)
+  800810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800813:	83 c4 10             	add    $0x10,%esp
+  800816:	c9                   	leave
+  800817:	c3                   	ret
+  800818:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80081d:	eb f7                	jmp    800816 <vsnprintf+0x45>
+
+0080081f <snprintf>:
+  80081f:	55                   	push   %ebp
+  800820:	89 e5                	mov    %esp,%ebp
+  800822:	83 ec 08             	sub    $0x8,%esp
+  800825:	8d 45 14             	lea    0x14(%ebp),%eax
+  800828:	50                   	push   %eax
+  800829:	ff 75 10             	push   0x10(%ebp)
+  80082c:	ff 75 0c             	push   0xc(%ebp)
+  80082f:	ff 75 08             	push   0x8(%ebp)
+  800832:	e8 9a ff ff ff       	call   8007d1 <vsnprintf>
+  800837:	c9                   	leave
+  800838:	c3                   	ret
+
+00800839 <strlen>:
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80083f:	80 3a 00             	cmpb   $0x0,(%edx)
+  800842:	74 10                	je     800854 <strlen+0x1b>
+  800844:	b8 00 00 00 00       	mov    $0x0,%eax
+  800849:	83 c0 01             	add    $0x1,%eax
+  80084c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800850:	75 f7                	jne    800849 <strlen+0x10>
+  800852:	5d                   	pop    %ebp
+  800853:	c3                   	ret
+  800854:	b8 00 00 00 00       	mov    $0x0,%eax
+  800859:	eb f7                	jmp    800852 <strlen+0x19>
+
+0080085b <strnlen>:
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800861:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800864:	85 d2                	test   %edx,%edx
+  800866:	74 16                	je     80087e <strnlen+0x23>
+  800868:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800871:	74 09                	je     80087c <strnlen+0x21>
+  800873:	83 c0 01             	add    $0x1,%eax
+  800876:	39 d0                	cmp    %edx,%eax
+  800878:	75 f3                	jne    80086d <strnlen+0x12>
+  80087a:	89 d0                	mov    %edx,%eax
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+  80087e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800883:	eb f7                	jmp    80087c <strnlen+0x21>
+
+00800885 <strcpy>:
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	53                   	push   %ebx
+  800889:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800894:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800898:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80089b:	83 c0 01             	add    $0x1,%eax
+  80089e:	84 d2                	test   %dl,%dl
+  8008a0:	75 f2                	jne    800894 <strcpy+0xf>
+  8008a2:	89 c8                	mov    %ecx,%eax
+  8008a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+
+008008a9 <strcat>:
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	53                   	push   %ebx
+  8008ad:	83 ec 10             	sub    $0x10,%esp
+  8008b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008b3:	53                   	push   %ebx
+  8008b4:	e8 80 ff ff ff       	call   800839 <strlen>
+  8008b9:	83 c4 08             	add    $0x8,%esp
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	01 d8                	add    %ebx,%eax
+  8008c1:	50                   	push   %eax
+  8008c2:	e8 be ff ff ff       	call   800885 <strcpy>
+  8008c7:	89 d8                	mov    %ebx,%eax
+  8008c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cc:	c9                   	leave
+  8008cd:	c3                   	ret
+
+008008ce <strncpy>:
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	56                   	push   %esi
+  8008d2:	53                   	push   %ebx
+  8008d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008dc:	85 db                	test   %ebx,%ebx
+  8008de:	74 17                	je     8008f7 <strncpy+0x29>
+  8008e0:	01 f3                	add    %esi,%ebx
+  8008e2:	89 f0                	mov    %esi,%eax
+  8008e4:	83 c0 01             	add    $0x1,%eax
+  8008e7:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ea:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008ed:	80 f9 01             	cmp    $0x1,%cl
+  8008f0:	83 da ff             	sbb    $0xffffffff,%edx
+  8008f3:	39 c3                	cmp    %eax,%ebx
+  8008f5:	75 ed                	jne    8008e4 <strncpy+0x16>
+  8008f7:	89 f0                	mov    %esi,%eax
+  8008f9:	5b                   	pop    %ebx
+  8008fa:	5e                   	pop    %esi
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+
+008008fd <strlcpy>:
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	56                   	push   %esi
+  800901:	53                   	push   %ebx
+  800902:	8b 75 08             	mov    0x8(%ebp),%esi
+  800905:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800908:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80090b:	89 f0                	mov    %esi,%eax
+  80090d:	85 db                	test   %ebx,%ebx
+  80090f:	74 1e                	je     80092f <strlcpy+0x32>
+  800911:	83 eb 01             	sub    $0x1,%ebx
+  800914:	74 16                	je     80092c <strlcpy+0x2f>
+  800916:	01 f3                	add    %esi,%ebx
+  800918:	0f b6 0a             	movzbl (%edx),%ecx
+  80091b:	84 c9                	test   %cl,%cl
+  80091d:	74 0d                	je     80092c <strlcpy+0x2f>
+  80091f:	83 c2 01             	add    $0x1,%edx
+  800922:	83 c0 01             	add    $0x1,%eax
+  800925:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800928:	39 d8                	cmp    %ebx,%eax
+  80092a:	75 ec                	jne    800918 <strlcpy+0x1b>
+  80092c:	c6 00 00             	movb   $0x0,(%eax)
+  80092f:	29 f0                	sub    %esi,%eax
+  800931:	5b                   	pop    %ebx
+  800932:	5e                   	pop    %esi
+  800933:	5d                   	pop    %ebp
+  800934:	c3                   	ret
+
+00800935 <strcmp>:
+  800935:	55                   	push   %ebp
+  800936:	89 e5                	mov    %esp,%ebp
+  800938:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80093e:	0f b6 01             	movzbl (%ecx),%eax
+  800941:	84 c0                	test   %al,%al
+  800943:	74 11                	je     800956 <strcmp+0x21>
+  800945:	38 02                	cmp    %al,(%edx)
+  800947:	75 0d                	jne    800956 <strcmp+0x21>
+  800949:	83 c1 01             	add    $0x1,%ecx
+  80094c:	83 c2 01             	add    $0x1,%edx
+  80094f:	0f b6 01             	movzbl (%ecx),%eax
+  800952:	84 c0                	test   %al,%al
+  800954:	75 ef                	jne    800945 <strcmp+0x10>
+  800956:	0f b6 c0             	movzbl %al,%eax
+  800959:	0f b6 12             	movzbl (%edx),%edx
+  80095c:	29 d0                	sub    %edx,%eax
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <strncmp>:
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	53                   	push   %ebx
+  800964:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800967:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80096a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80096d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800972:	85 d2                	test   %edx,%edx
+  800974:	74 2e                	je     8009a4 <strncmp+0x44>
+  800976:	0f b6 01             	movzbl (%ecx),%eax
+  800979:	84 c0                	test   %al,%al
+  80097b:	74 16                	je     800993 <strncmp+0x33>
+  80097d:	3a 03                	cmp    (%ebx),%al
+  80097f:	75 12                	jne    800993 <strncmp+0x33>
+  800981:	83 c1 01             	add    $0x1,%ecx
+  800984:	83 c3 01             	add    $0x1,%ebx
+  800987:	83 ea 01             	sub    $0x1,%edx
+  80098a:	75 ea                	jne    800976 <strncmp+0x16>
+  80098c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800991:	eb 11                	jmp    8009a4 <strncmp+0x44>
+  800993:	b8 00 00 00 00       	mov    $0x0,%eax
+  800998:	85 d2                	test   %edx,%edx
+  80099a:	74 08                	je     8009a4 <strncmp+0x44>
+  80099c:	0f b6 01             	movzbl (%ecx),%eax
+  80099f:	0f b6 13             	movzbl (%ebx),%edx
+  8009a2:	29 d0                	sub    %edx,%eax
+  8009a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a7:	c9                   	leave
+  8009a8:	c3                   	ret
+
+008009a9 <strchr>:
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009af:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009b3:	0f b6 10             	movzbl (%eax),%edx
+  8009b6:	84 d2                	test   %dl,%dl
+  8009b8:	74 15                	je     8009cf <strchr+0x26>
+  8009ba:	38 d1                	cmp    %dl,%cl
+  8009bc:	74 0f                	je     8009cd <strchr+0x24>
+  8009be:	83 c0 01             	add    $0x1,%eax
+  8009c1:	0f b6 10             	movzbl (%eax),%edx
+  8009c4:	84 d2                	test   %dl,%dl
+  8009c6:	75 f2                	jne    8009ba <strchr+0x11>
+  8009c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+  8009cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d4:	eb f7                	jmp    8009cd <strchr+0x24>
+
+008009d6 <strfind>:
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	53                   	push   %ebx
+  8009da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e0:	0f b6 18             	movzbl (%eax),%ebx
+  8009e3:	38 d3                	cmp    %dl,%bl
+  8009e5:	74 14                	je     8009fb <strfind+0x25>
+  8009e7:	89 d1                	mov    %edx,%ecx
+  8009e9:	84 db                	test   %bl,%bl
+  8009eb:	74 0e                	je     8009fb <strfind+0x25>
+  8009ed:	83 c0 01             	add    $0x1,%eax
+  8009f0:	0f b6 10             	movzbl (%eax),%edx
+  8009f3:	38 ca                	cmp    %cl,%dl
+  8009f5:	74 04                	je     8009fb <strfind+0x25>
+  8009f7:	84 d2                	test   %dl,%dl
+  8009f9:	75 f2                	jne    8009ed <strfind+0x17>
+  8009fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fe:	c9                   	leave
+  8009ff:	c3                   	ret
+
+00800a00 <memset>:
+  800a00:	55                   	push   %ebp
+  800a01:	89 e5                	mov    %esp,%ebp
+  800a03:	57                   	push   %edi
+  800a04:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a0a:	85 c9                	test   %ecx,%ecx
+  800a0c:	74 20                	je     800a2e <memset+0x2e>
+  800a0e:	89 f8                	mov    %edi,%eax
+  800a10:	09 c8                	or     %ecx,%eax
+  800a12:	a8 03                	test   $0x3,%al
+  800a14:	75 12                	jne    800a28 <memset+0x28>
+  800a16:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a1a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a20:	c1 e9 02             	shr    $0x2,%ecx
+  800a23:	fc                   	cld
+  800a24:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a26:	eb 06                	jmp    800a2e <memset+0x2e>
+  800a28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2b:	fc                   	cld
+  800a2c:	f3 aa                	rep stos %al,%es:(%edi)
+  800a2e:	89 f8                	mov    %edi,%eax
+  800a30:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a33:	c9                   	leave
+  800a34:	c3                   	ret
+
+00800a35 <memmove>:
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	57                   	push   %edi
+  800a39:	56                   	push   %esi
+  800a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a40:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a43:	39 c6                	cmp    %eax,%esi
+  800a45:	73 32                	jae    800a79 <memmove+0x44>
+  800a47:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a4a:	39 d0                	cmp    %edx,%eax
+  800a4c:	73 2b                	jae    800a79 <memmove+0x44>
+  800a4e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a51:	89 d6                	mov    %edx,%esi
+  800a53:	09 fe                	or     %edi,%esi
+  800a55:	09 ce                	or     %ecx,%esi
+  800a57:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a5d:	75 0e                	jne    800a6d <memmove+0x38>
+  800a5f:	83 ef 04             	sub    $0x4,%edi
+  800a62:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a65:	c1 e9 02             	shr    $0x2,%ecx
+  800a68:	fd                   	std
+  800a69:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6b:	eb 09                	jmp    800a76 <memmove+0x41>
+  800a6d:	83 ef 01             	sub    $0x1,%edi
+  800a70:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800a73:	fd                   	std
+  800a74:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a76:	fc                   	cld
+  800a77:	eb 1a                	jmp    800a93 <memmove+0x5e>
+  800a79:	89 f2                	mov    %esi,%edx
+  800a7b:	09 c2                	or     %eax,%edx
+  800a7d:	09 ca                	or     %ecx,%edx
+  800a7f:	f6 c2 03             	test   $0x3,%dl
+  800a82:	75 0a                	jne    800a8e <memmove+0x59>
+  800a84:	c1 e9 02             	shr    $0x2,%ecx
+  800a87:	89 c7                	mov    %eax,%edi
+  800a89:	fc                   	cld
+  800a8a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8c:	eb 05                	jmp    800a93 <memmove+0x5e>
+  800a8e:	89 c7                	mov    %eax,%edi
+  800a90:	fc                   	cld
+  800a91:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a93:	5e                   	pop    %esi
+  800a94:	5f                   	pop    %edi
+  800a95:	5d                   	pop    %ebp
+  800a96:	c3                   	ret
+
+00800a97 <memcpy>:
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	83 ec 0c             	sub    $0xc,%esp
+  800a9d:	ff 75 10             	push   0x10(%ebp)
+  800aa0:	ff 75 0c             	push   0xc(%ebp)
+  800aa3:	ff 75 08             	push   0x8(%ebp)
+  800aa6:	e8 8a ff ff ff       	call   800a35 <memmove>
+  800aab:	c9                   	leave
+  800aac:	c3                   	ret
+
+00800aad <memcmp>:
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	56                   	push   %esi
+  800ab1:	53                   	push   %ebx
+  800ab2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab8:	8b 75 10             	mov    0x10(%ebp),%esi
+  800abb:	85 f6                	test   %esi,%esi
+  800abd:	74 29                	je     800ae8 <memcmp+0x3b>
+  800abf:	01 c6                	add    %eax,%esi
+  800ac1:	0f b6 08             	movzbl (%eax),%ecx
+  800ac4:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac7:	38 d9                	cmp    %bl,%cl
+  800ac9:	75 11                	jne    800adc <memcmp+0x2f>
+  800acb:	83 c0 01             	add    $0x1,%eax
+  800ace:	83 c2 01             	add    $0x1,%edx
+  800ad1:	39 c6                	cmp    %eax,%esi
+  800ad3:	75 ec                	jne    800ac1 <memcmp+0x14>
+  800ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ada:	eb 08                	jmp    800ae4 <memcmp+0x37>
+  800adc:	0f b6 c1             	movzbl %cl,%eax
+  800adf:	0f b6 db             	movzbl %bl,%ebx
+  800ae2:	29 d8                	sub    %ebx,%eax
+  800ae4:	5b                   	pop    %ebx
+  800ae5:	5e                   	pop    %esi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+  800ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aed:	eb f5                	jmp    800ae4 <memcmp+0x37>
+
+00800aef <memfind>:
+  800aef:	55                   	push   %ebp
+  800af0:	89 e5                	mov    %esp,%ebp
+  800af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af8:	89 c2                	mov    %eax,%edx
+  800afa:	03 55 10             	add    0x10(%ebp),%edx
+  800afd:	39 d0                	cmp    %edx,%eax
+  800aff:	73 0d                	jae    800b0e <memfind+0x1f>
+  800b01:	38 08                	cmp    %cl,(%eax)
+  800b03:	74 0d                	je     800b12 <memfind+0x23>
+  800b05:	83 c0 01             	add    $0x1,%eax
+  800b08:	39 c2                	cmp    %eax,%edx
+  800b0a:	75 f5                	jne    800b01 <memfind+0x12>
+  800b0c:	eb 06                	jmp    800b14 <memfind+0x25>
+  800b0e:	89 c2                	mov    %eax,%edx
+  800b10:	eb 02                	jmp    800b14 <memfind+0x25>
+  800b12:	89 c2                	mov    %eax,%edx
+  800b14:	89 d0                	mov    %edx,%eax
+  800b16:	5d                   	pop    %ebp
+  800b17:	c3                   	ret
+
+00800b18 <strtol>:
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	57                   	push   %edi
+  800b1c:	56                   	push   %esi
+  800b1d:	53                   	push   %ebx
+  800b1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b24:	0f b6 02             	movzbl (%edx),%eax
+  800b27:	3c 20                	cmp    $0x20,%al
+  800b29:	74 04                	je     800b2f <strtol+0x17>
+  800b2b:	3c 09                	cmp    $0x9,%al
+  800b2d:	75 0e                	jne    800b3d <strtol+0x25>
+  800b2f:	83 c2 01             	add    $0x1,%edx
+  800b32:	0f b6 02             	movzbl (%edx),%eax
+  800b35:	3c 20                	cmp    $0x20,%al
+  800b37:	74 f6                	je     800b2f <strtol+0x17>
+  800b39:	3c 09                	cmp    $0x9,%al
+  800b3b:	74 f2                	je     800b2f <strtol+0x17>
+  800b3d:	3c 2b                	cmp    $0x2b,%al
+  800b3f:	74 2a                	je     800b6b <strtol+0x53>
+  800b41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b46:	3c 2d                	cmp    $0x2d,%al
+  800b48:	74 2b                	je     800b75 <strtol+0x5d>
+  800b4a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b50:	75 0f                	jne    800b61 <strtol+0x49>
+  800b52:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b55:	74 28                	je     800b7f <strtol+0x67>
+  800b57:	85 db                	test   %ebx,%ebx
+  800b59:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b5e:	0f 44 d8             	cmove  %eax,%ebx
+  800b61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b66:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b69:	eb 46                	jmp    800bb1 <strtol+0x99>
+  800b6b:	83 c2 01             	add    $0x1,%edx
+  800b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b73:	eb d5                	jmp    800b4a <strtol+0x32>
+  800b75:	83 c2 01             	add    $0x1,%edx
+  800b78:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b7d:	eb cb                	jmp    800b4a <strtol+0x32>
+  800b7f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b83:	74 0e                	je     800b93 <strtol+0x7b>
+  800b85:	85 db                	test   %ebx,%ebx
+  800b87:	75 d8                	jne    800b61 <strtol+0x49>
+  800b89:	83 c2 01             	add    $0x1,%edx
+  800b8c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b91:	eb ce                	jmp    800b61 <strtol+0x49>
+  800b93:	83 c2 02             	add    $0x2,%edx
+  800b96:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b9b:	eb c4                	jmp    800b61 <strtol+0x49>
+  800b9d:	0f be c0             	movsbl %al,%eax
+  800ba0:	83 e8 30             	sub    $0x30,%eax
+  800ba3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ba6:	7d 3a                	jge    800be2 <strtol+0xca>
+  800ba8:	83 c2 01             	add    $0x1,%edx
+  800bab:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800baf:	01 c1                	add    %eax,%ecx
+  800bb1:	0f b6 02             	movzbl (%edx),%eax
+  800bb4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bb7:	89 f3                	mov    %esi,%ebx
+  800bb9:	80 fb 09             	cmp    $0x9,%bl
+  800bbc:	76 df                	jbe    800b9d <strtol+0x85>
+  800bbe:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bc1:	89 f3                	mov    %esi,%ebx
+  800bc3:	80 fb 19             	cmp    $0x19,%bl
+  800bc6:	77 08                	ja     800bd0 <strtol+0xb8>
+  800bc8:	0f be c0             	movsbl %al,%eax
+  800bcb:	83 e8 57             	sub    $0x57,%eax
+  800bce:	eb d3                	jmp    800ba3 <strtol+0x8b>
+  800bd0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bd3:	89 f3                	mov    %esi,%ebx
+  800bd5:	80 fb 19             	cmp    $0x19,%bl
+  800bd8:	77 08                	ja     800be2 <strtol+0xca>
+  800bda:	0f be c0             	movsbl %al,%eax
+  800bdd:	83 e8 37             	sub    $0x37,%eax
+  800be0:	eb c1                	jmp    800ba3 <strtol+0x8b>
+  800be2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800be6:	74 05                	je     800bed <strtol+0xd5>
+  800be8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800beb:	89 10                	mov    %edx,(%eax)
+  800bed:	89 c8                	mov    %ecx,%eax
+  800bef:	f7 d8                	neg    %eax
+  800bf1:	85 ff                	test   %edi,%edi
+  800bf3:	0f 45 c8             	cmovne %eax,%ecx
+  800bf6:	89 c8                	mov    %ecx,%eax
+  800bf8:	5b                   	pop    %ebx
+  800bf9:	5e                   	pop    %esi
+  800bfa:	5f                   	pop    %edi
+  800bfb:	5d                   	pop    %ebp
+  800bfc:	c3                   	ret
+
+00800bfd <sys_cputs>:
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	56                   	push   %esi
+  800c02:	53                   	push   %ebx
+  800c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0e:	89 c3                	mov    %eax,%ebx
+  800c10:	89 c7                	mov    %eax,%edi
+  800c12:	89 c6                	mov    %eax,%esi
+  800c14:	cd 30                	int    $0x30
+  800c16:	5b                   	pop    %ebx
+  800c17:	5e                   	pop    %esi
+  800c18:	5f                   	pop    %edi
+  800c19:	5d                   	pop    %ebp
+  800c1a:	c3                   	ret
+
+00800c1b <sys_cgetc>:
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	57                   	push   %edi
+  800c1f:	56                   	push   %esi
+  800c20:	53                   	push   %ebx
+  800c21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c26:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c2b:	89 d1                	mov    %edx,%ecx
+  800c2d:	89 d3                	mov    %edx,%ebx
+  800c2f:	89 d7                	mov    %edx,%edi
+  800c31:	89 d6                	mov    %edx,%esi
+  800c33:	cd 30                	int    $0x30
+  800c35:	5b                   	pop    %ebx
+  800c36:	5e                   	pop    %esi
+  800c37:	5f                   	pop    %edi
+  800c38:	5d                   	pop    %ebp
+  800c39:	c3                   	ret
+
+00800c3a <sys_env_destroy>:
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	57                   	push   %edi
+  800c3e:	56                   	push   %esi
+  800c3f:	53                   	push   %ebx
+  800c40:	83 ec 0c             	sub    $0xc,%esp
+  800c43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c50:	89 cb                	mov    %ecx,%ebx
+  800c52:	89 cf                	mov    %ecx,%edi
+  800c54:	89 ce                	mov    %ecx,%esi
+  800c56:	cd 30                	int    $0x30
+  800c58:	85 c0                	test   %eax,%eax
+  800c5a:	7f 08                	jg     800c64 <sys_env_destroy+0x2a>
+  800c5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5f:	5b                   	pop    %ebx
+  800c60:	5e                   	pop    %esi
+  800c61:	5f                   	pop    %edi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+  800c64:	83 ec 0c             	sub    $0xc,%esp
+  800c67:	50                   	push   %eax
+  800c68:	6a 03                	push   $0x3
+  800c6a:	68 8b 35 80 00       	push   $0x80358b
+  800c6f:	6a 24                	push   $0x24
+  800c71:	68 a8 35 80 00       	push   $0x8035a8
+  800c76:	e8 da 20 00 00       	call   802d55 <_panic>
+
+00800c7b <sys_getenvid>:
+  800c7b:	55                   	push   %ebp
+  800c7c:	89 e5                	mov    %esp,%ebp
+  800c7e:	57                   	push   %edi
+  800c7f:	56                   	push   %esi
+  800c80:	53                   	push   %ebx
+  800c81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c86:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c8b:	89 d1                	mov    %edx,%ecx
+  800c8d:	89 d3                	mov    %edx,%ebx
+  800c8f:	89 d7                	mov    %edx,%edi
+  800c91:	89 d6                	mov    %edx,%esi
+  800c93:	cd 30                	int    $0x30
+  800c95:	5b                   	pop    %ebx
+  800c96:	5e                   	pop    %esi
+  800c97:	5f                   	pop    %edi
+  800c98:	5d                   	pop    %ebp
+  800c99:	c3                   	ret
+
+00800c9a <sys_yield>:
+  800c9a:	55                   	push   %ebp
+  800c9b:	89 e5                	mov    %esp,%ebp
+  800c9d:	57                   	push   %edi
+  800c9e:	56                   	push   %esi
+  800c9f:	53                   	push   %ebx
+  800ca0:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ca7:	74 26                	je     800ccf <sys_yield+0x35>
+  800ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cae:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cb3:	89 d1                	mov    %edx,%ecx
+  800cb5:	89 d3                	mov    %edx,%ebx
+  800cb7:	89 d7                	mov    %edx,%edi
+  800cb9:	6a 00                	push   $0x0
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	8d 35 c6 0c 80 00    	lea    0x800cc6,%esi
+  800cc4:	0f 34                	sysenter
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	83 c4 04             	add    $0x4,%esp
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+  800ccf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cd9:	89 d1                	mov    %edx,%ecx
+  800cdb:	89 d3                	mov    %edx,%ebx
+  800cdd:	89 d7                	mov    %edx,%edi
+  800cdf:	89 d6                	mov    %edx,%esi
+  800ce1:	cd 30                	int    $0x30
+  800ce3:	eb e5                	jmp    800cca <sys_yield+0x30>
+
+00800ce5 <sys_page_alloc>:
+  800ce5:	55                   	push   %ebp
+  800ce6:	89 e5                	mov    %esp,%ebp
+  800ce8:	57                   	push   %edi
+  800ce9:	56                   	push   %esi
+  800cea:	53                   	push   %ebx
+  800ceb:	83 ec 0c             	sub    $0xc,%esp
+  800cee:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d01:	89 f7                	mov    %esi,%edi
+  800d03:	cd 30                	int    $0x30
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	7f 08                	jg     800d11 <sys_page_alloc+0x2c>
+  800d09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0c:	5b                   	pop    %ebx
+  800d0d:	5e                   	pop    %esi
+  800d0e:	5f                   	pop    %edi
+  800d0f:	5d                   	pop    %ebp
+  800d10:	c3                   	ret
+  800d11:	83 ec 0c             	sub    $0xc,%esp
+  800d14:	50                   	push   %eax
+  800d15:	6a 04                	push   $0x4
+  800d17:	68 8b 35 80 00       	push   $0x80358b
+  800d1c:	6a 24                	push   $0x24
+  800d1e:	68 a8 35 80 00       	push   $0x8035a8
+  800d23:	e8 2d 20 00 00       	call   802d55 <_panic>
+
+00800d28 <sys_page_map>:
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	57                   	push   %edi
+  800d2c:	56                   	push   %esi
+  800d2d:	53                   	push   %ebx
+  800d2e:	83 ec 0c             	sub    $0xc,%esp
+  800d31:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d38:	74 33                	je     800d6d <sys_page_map+0x45>
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d40:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d48:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d4b:	ff 75 18             	push   0x18(%ebp)
+  800d4e:	55                   	push   %ebp
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	8d 35 59 0d 80 00    	lea    0x800d59,%esi
+  800d57:	0f 34                	sysenter
+  800d59:	5d                   	pop    %ebp
+  800d5a:	83 c4 04             	add    $0x4,%esp
+  800d5d:	89 c2                	mov    %eax,%edx
+  800d5f:	85 c0                	test   %eax,%eax
+  800d61:	7f 3d                	jg     800da0 <sys_page_map+0x78>
+  800d63:	89 d0                	mov    %edx,%eax
+  800d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d68:	5b                   	pop    %ebx
+  800d69:	5e                   	pop    %esi
+  800d6a:	5f                   	pop    %edi
+  800d6b:	5d                   	pop    %ebp
+  800d6c:	c3                   	ret
+  800d6d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d7e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d81:	cd 30                	int    $0x30
+  800d83:	89 c2                	mov    %eax,%edx
+  800d85:	85 c0                	test   %eax,%eax
+  800d87:	7e da                	jle    800d63 <sys_page_map+0x3b>
+  800d89:	83 ec 0c             	sub    $0xc,%esp
+  800d8c:	50                   	push   %eax
+  800d8d:	6a 05                	push   $0x5
+  800d8f:	68 8b 35 80 00       	push   $0x80358b
+  800d94:	6a 24                	push   $0x24
+  800d96:	68 a8 35 80 00       	push   $0x8035a8
+  800d9b:	e8 b5 1f 00 00       	call   802d55 <_panic>
+  800da0:	83 ec 0c             	sub    $0xc,%esp
+  800da3:	50                   	push   %eax
+  800da4:	6a 05                	push   $0x5
+  800da6:	68 8b 35 80 00       	push   $0x80358b
+  800dab:	6a 48                	push   $0x48
+  800dad:	68 a8 35 80 00       	push   $0x8035a8
+  800db2:	e8 9e 1f 00 00       	call   802d55 <_panic>
+
+00800db7 <sys_page_unmap>:
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+  800dc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dd0:	89 df                	mov    %ebx,%edi
+  800dd2:	89 de                	mov    %ebx,%esi
+  800dd4:	cd 30                	int    $0x30
+  800dd6:	85 c0                	test   %eax,%eax
+  800dd8:	7f 08                	jg     800de2 <sys_page_unmap+0x2b>
+  800dda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ddd:	5b                   	pop    %ebx
+  800dde:	5e                   	pop    %esi
+  800ddf:	5f                   	pop    %edi
+  800de0:	5d                   	pop    %ebp
+  800de1:	c3                   	ret
+  800de2:	83 ec 0c             	sub    $0xc,%esp
+  800de5:	50                   	push   %eax
+  800de6:	6a 06                	push   $0x6
+  800de8:	68 8b 35 80 00       	push   $0x80358b
+  800ded:	6a 24                	push   $0x24
+  800def:	68 a8 35 80 00       	push   $0x8035a8
+  800df4:	e8 5c 1f 00 00       	call   802d55 <_panic>
+
+00800df9 <sys_fork>:
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	57                   	push   %edi
+  800dfd:	56                   	push   %esi
+  800dfe:	53                   	push   %ebx
+  800dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e04:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e09:	89 d1                	mov    %edx,%ecx
+  800e0b:	89 d3                	mov    %edx,%ebx
+  800e0d:	89 d7                	mov    %edx,%edi
+  800e0f:	89 d6                	mov    %edx,%esi
+  800e11:	cd 30                	int    $0x30
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+
+00800e18 <sys_env_set_status>:
+  800e18:	55                   	push   %ebp
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	57                   	push   %edi
+  800e1c:	56                   	push   %esi
+  800e1d:	53                   	push   %ebx
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e31:	89 df                	mov    %ebx,%edi
+  800e33:	89 de                	mov    %ebx,%esi
+  800e35:	cd 30                	int    $0x30
+  800e37:	85 c0                	test   %eax,%eax
+  800e39:	7f 08                	jg     800e43 <sys_env_set_status+0x2b>
+  800e3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5f                   	pop    %edi
+  800e41:	5d                   	pop    %ebp
+  800e42:	c3                   	ret
+  800e43:	83 ec 0c             	sub    $0xc,%esp
+  800e46:	50                   	push   %eax
+  800e47:	6a 08                	push   $0x8
+  800e49:	68 8b 35 80 00       	push   $0x80358b
+  800e4e:	6a 24                	push   $0x24
+  800e50:	68 a8 35 80 00       	push   $0x8035a8
+  800e55:	e8 fb 1e 00 00       	call   802d55 <_panic>
+
+00800e5a <sys_env_set_trapframe>:
+  800e5a:	55                   	push   %ebp
+  800e5b:	89 e5                	mov    %esp,%ebp
+  800e5d:	57                   	push   %edi
+  800e5e:	56                   	push   %esi
+  800e5f:	53                   	push   %ebx
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+  800e63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e73:	89 df                	mov    %ebx,%edi
+  800e75:	89 de                	mov    %ebx,%esi
+  800e77:	cd 30                	int    $0x30
+  800e79:	85 c0                	test   %eax,%eax
+  800e7b:	7f 08                	jg     800e85 <sys_env_set_trapframe+0x2b>
+  800e7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e80:	5b                   	pop    %ebx
+  800e81:	5e                   	pop    %esi
+  800e82:	5f                   	pop    %edi
+  800e83:	5d                   	pop    %ebp
+  800e84:	c3                   	ret
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+  800e88:	50                   	push   %eax
+  800e89:	6a 09                	push   $0x9
+  800e8b:	68 8b 35 80 00       	push   $0x80358b
+  800e90:	6a 24                	push   $0x24
+  800e92:	68 a8 35 80 00       	push   $0x8035a8
+  800e97:	e8 b9 1e 00 00       	call   802d55 <_panic>
+
+00800e9c <sys_env_set_cow>:
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	57                   	push   %edi
+  800ea0:	56                   	push   %esi
+  800ea1:	53                   	push   %ebx
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  800ea5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ead:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb0:	b8 20 00 00 00       	mov    $0x20,%eax
+  800eb5:	89 df                	mov    %ebx,%edi
+  800eb7:	89 de                	mov    %ebx,%esi
+  800eb9:	cd 30                	int    $0x30
+  800ebb:	85 c0                	test   %eax,%eax
+  800ebd:	7f 08                	jg     800ec7 <sys_env_set_cow+0x2b>
+  800ebf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec2:	5b                   	pop    %ebx
+  800ec3:	5e                   	pop    %esi
+  800ec4:	5f                   	pop    %edi
+  800ec5:	5d                   	pop    %ebp
+  800ec6:	c3                   	ret
+  800ec7:	83 ec 0c             	sub    $0xc,%esp
+  800eca:	50                   	push   %eax
+  800ecb:	6a 20                	push   $0x20
+  800ecd:	68 8b 35 80 00       	push   $0x80358b
+  800ed2:	6a 24                	push   $0x24
+  800ed4:	68 a8 35 80 00       	push   $0x8035a8
+  800ed9:	e8 77 1e 00 00       	call   802d55 <_panic>
+
+00800ede <sys_env_service>:
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	56                   	push   %esi
+  800ee3:	53                   	push   %ebx
+  800ee4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	b8 21 00 00 00       	mov    $0x21,%eax
+  800ef1:	89 cb                	mov    %ecx,%ebx
+  800ef3:	89 cf                	mov    %ecx,%edi
+  800ef5:	89 ce                	mov    %ecx,%esi
+  800ef7:	cd 30                	int    $0x30
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5e                   	pop    %esi
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+
+00800efe <sys_env_set_pgfault_upcall>:
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	57                   	push   %edi
+  800f02:	56                   	push   %esi
+  800f03:	53                   	push   %ebx
+  800f04:	83 ec 0c             	sub    $0xc,%esp
+  800f07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f12:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f17:	89 df                	mov    %ebx,%edi
+  800f19:	89 de                	mov    %ebx,%esi
+  800f1b:	cd 30                	int    $0x30
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	7f 08                	jg     800f29 <sys_env_set_pgfault_upcall+0x2b>
+  800f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+  800f2c:	50                   	push   %eax
+  800f2d:	6a 0a                	push   $0xa
+  800f2f:	68 8b 35 80 00       	push   $0x80358b
+  800f34:	6a 24                	push   $0x24
+  800f36:	68 a8 35 80 00       	push   $0x8035a8
+  800f3b:	e8 15 1e 00 00       	call   802d55 <_panic>
+
+00800f40 <sys_ipc_try_send>:
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  800f46:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f4d:	74 27                	je     800f76 <sys_ipc_try_send+0x36>
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f55:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f60:	6a 00                	push   $0x0
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	8d 35 6d 0f 80 00    	lea    0x800f6d,%esi
+  800f6b:	0f 34                	sysenter
+  800f6d:	5d                   	pop    %ebp
+  800f6e:	83 c4 04             	add    $0x4,%esp
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+  800f76:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f7b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8c:	cd 30                	int    $0x30
+  800f8e:	eb e1                	jmp    800f71 <sys_ipc_try_send+0x31>
+
+00800f90 <sys_ipc_recv>:
+  800f90:	55                   	push   %ebp
+  800f91:	89 e5                	mov    %esp,%ebp
+  800f93:	57                   	push   %edi
+  800f94:	56                   	push   %esi
+  800f95:	53                   	push   %ebx
+  800f96:	83 ec 0c             	sub    $0xc,%esp
+  800f99:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fa0:	74 32                	je     800fd4 <sys_ipc_recv+0x44>
+  800fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800faa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800faf:	89 cb                	mov    %ecx,%ebx
+  800fb1:	89 cf                	mov    %ecx,%edi
+  800fb3:	6a 00                	push   $0x0
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	8d 35 c0 0f 80 00    	lea    0x800fc0,%esi
+  800fbe:	0f 34                	sysenter
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	83 c4 04             	add    $0x4,%esp
+  800fc4:	89 c2                	mov    %eax,%edx
+  800fc6:	85 c0                	test   %eax,%eax
+  800fc8:	7f 3c                	jg     801006 <sys_ipc_recv+0x76>
+  800fca:	89 d0                	mov    %edx,%eax
+  800fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+  800fd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe1:	89 cb                	mov    %ecx,%ebx
+  800fe3:	89 cf                	mov    %ecx,%edi
+  800fe5:	89 ce                	mov    %ecx,%esi
+  800fe7:	cd 30                	int    $0x30
+  800fe9:	89 c2                	mov    %eax,%edx
+  800feb:	85 c0                	test   %eax,%eax
+  800fed:	7e db                	jle    800fca <sys_ipc_recv+0x3a>
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+  800ff2:	50                   	push   %eax
+  800ff3:	6a 0d                	push   $0xd
+  800ff5:	68 8b 35 80 00       	push   $0x80358b
+  800ffa:	6a 24                	push   $0x24
+  800ffc:	68 a8 35 80 00       	push   $0x8035a8
+  801001:	e8 4f 1d 00 00       	call   802d55 <_panic>
+  801006:	83 ec 0c             	sub    $0xc,%esp
+  801009:	50                   	push   %eax
+  80100a:	6a 0d                	push   $0xd
+  80100c:	68 8b 35 80 00       	push   $0x80358b
+  801011:	6a 48                	push   $0x48
+  801013:	68 a8 35 80 00       	push   $0x8035a8
+  801018:	e8 38 1d 00 00       	call   802d55 <_panic>
+
+0080101d <sys_ipc_send>:
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+  801023:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80102a:	74 27                	je     801053 <sys_ipc_send+0x36>
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801032:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801037:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103d:	6a 00                	push   $0x0
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	8d 35 4a 10 80 00    	lea    0x80104a,%esi
+  801048:	0f 34                	sysenter
+  80104a:	5d                   	pop    %ebp
+  80104b:	83 c4 04             	add    $0x4,%esp
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+  801053:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801058:	be 00 00 00 00       	mov    $0x0,%esi
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801063:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801066:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801069:	cd 30                	int    $0x30
+  80106b:	eb e1                	jmp    80104e <sys_ipc_send+0x31>
+
+0080106d <sys_ipc_call>:
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	57                   	push   %edi
+  801071:	56                   	push   %esi
+  801072:	53                   	push   %ebx
+  801073:	8b 55 08             	mov    0x8(%ebp),%edx
+  801076:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801079:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80107e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801081:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801084:	8b 75 18             	mov    0x18(%ebp),%esi
+  801087:	cd 30                	int    $0x30
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sys_ipc_reply_recv>:
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80109f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a8:	cd 30                	int    $0x30
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+
+008010af <sys_time_msec>:
+  8010af:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8010b4:	85 c0                	test   %eax,%eax
+  8010b6:	75 06                	jne    8010be <sys_time_msec+0xf>
+  8010b8:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8010bd:	c3                   	ret
+  8010be:	55                   	push   %ebp
+  8010bf:	89 e5                	mov    %esp,%ebp
+  8010c1:	57                   	push   %edi
+  8010c2:	56                   	push   %esi
+  8010c3:	53                   	push   %ebx
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+  8010c7:	0f 31                	rdtsc
+  8010c9:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8010cf:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8010d5:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8010db:	29 c8                	sub    %ecx,%eax
+  8010dd:	19 da                	sbb    %ebx,%edx
+  8010df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e4:	57                   	push   %edi
+  8010e5:	56                   	push   %esi
+  8010e6:	52                   	push   %edx
+  8010e7:	50                   	push   %eax
+  8010e8:	e8 34 20 00 00       	call   803121 <__udivdi3>
+  8010ed:	83 c4 10             	add    $0x10,%esp
+  8010f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <sys_env_swap>:
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+  8010fe:	83 ec 0c             	sub    $0xc,%esp
+  801101:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	b8 12 00 00 00       	mov    $0x12,%eax
+  80110e:	89 cb                	mov    %ecx,%ebx
+  801110:	89 cf                	mov    %ecx,%edi
+  801112:	89 ce                	mov    %ecx,%esi
+  801114:	cd 30                	int    $0x30
+  801116:	85 c0                	test   %eax,%eax
+  801118:	7f 08                	jg     801122 <sys_env_swap+0x2a>
+  80111a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+  801122:	83 ec 0c             	sub    $0xc,%esp
+  801125:	50                   	push   %eax
+  801126:	6a 12                	push   $0x12
+  801128:	68 8b 35 80 00       	push   $0x80358b
+  80112d:	6a 24                	push   $0x24
+  80112f:	68 a8 35 80 00       	push   $0x8035a8
+  801134:	e8 1c 1c 00 00       	call   802d55 <_panic>
+
+00801139 <sys_net_try_send>:
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+  801142:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801152:	89 df                	mov    %ebx,%edi
+  801154:	89 de                	mov    %ebx,%esi
+  801156:	cd 30                	int    $0x30
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	7f 08                	jg     801164 <sys_net_try_send+0x2b>
+  80115c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+  801164:	83 ec 0c             	sub    $0xc,%esp
+  801167:	50                   	push   %eax
+  801168:	6a 13                	push   $0x13
+  80116a:	68 8b 35 80 00       	push   $0x80358b
+  80116f:	6a 24                	push   $0x24
+  801171:	68 a8 35 80 00       	push   $0x8035a8
+  801176:	e8 da 1b 00 00       	call   802d55 <_panic>
+
+0080117b <sys_net_try_receive>:
+  80117b:	55                   	push   %ebp
+  80117c:	89 e5                	mov    %esp,%ebp
+  80117e:	57                   	push   %edi
+  80117f:	56                   	push   %esi
+  801180:	53                   	push   %ebx
+  801181:	83 ec 0c             	sub    $0xc,%esp
+  801184:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801194:	89 df                	mov    %ebx,%edi
+  801196:	89 de                	mov    %ebx,%esi
+  801198:	cd 30                	int    $0x30
+  80119a:	85 c0                	test   %eax,%eax
+  80119c:	7f 08                	jg     8011a6 <sys_net_try_receive+0x2b>
+  80119e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+  8011a6:	83 ec 0c             	sub    $0xc,%esp
+  8011a9:	50                   	push   %eax
+  8011aa:	6a 14                	push   $0x14
+  8011ac:	68 8b 35 80 00       	push   $0x80358b
+  8011b1:	6a 24                	push   $0x24
+  8011b3:	68 a8 35 80 00       	push   $0x8035a8
+  8011b8:	e8 98 1b 00 00       	call   802d55 <_panic>
+
+008011bd <sys_net_recv_page>:
+  8011bd:	55                   	push   %ebp
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	57                   	push   %edi
+  8011c1:	56                   	push   %esi
+  8011c2:	53                   	push   %ebx
+  8011c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cb:	b8 27 00 00 00       	mov    $0x27,%eax
+  8011d0:	89 cb                	mov    %ecx,%ebx
+  8011d2:	89 cf                	mov    %ecx,%edi
+  8011d4:	89 ce                	mov    %ecx,%esi
+  8011d6:	cd 30                	int    $0x30
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+
+008011dd <sys_net_wait>:
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	57                   	push   %edi
+  8011e1:	56                   	push   %esi
+  8011e2:	53                   	push   %ebx
+  8011e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e8:	b8 26 00 00 00       	mov    $0x26,%eax
+  8011ed:	89 d1                	mov    %edx,%ecx
+  8011ef:	89 d3                	mov    %edx,%ebx
+  8011f1:	89 d7                	mov    %edx,%edi
+  8011f3:	89 d6                	mov    %edx,%esi
+  8011f5:	cd 30                	int    $0x30
+  8011f7:	5b                   	pop    %ebx
+  8011f8:	5e                   	pop    %esi
+  8011f9:	5f                   	pop    %edi
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+
+008011fc <sys_get_mac>:
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	56                   	push   %esi
+  801201:	53                   	push   %ebx
+  801202:	83 ec 0c             	sub    $0xc,%esp
+  801205:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801210:	b8 15 00 00 00       	mov    $0x15,%eax
+  801215:	89 df                	mov    %ebx,%edi
+  801217:	89 de                	mov    %ebx,%esi
+  801219:	cd 30                	int    $0x30
+  80121b:	85 c0                	test   %eax,%eax
+  80121d:	7f 08                	jg     801227 <sys_get_mac+0x2b>
+  80121f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801222:	5b                   	pop    %ebx
+  801223:	5e                   	pop    %esi
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+  801227:	83 ec 0c             	sub    $0xc,%esp
+  80122a:	50                   	push   %eax
+  80122b:	6a 15                	push   $0x15
+  80122d:	68 8b 35 80 00       	push   $0x80358b
+  801232:	6a 24                	push   $0x24
+  801234:	68 a8 35 80 00       	push   $0x8035a8
+  801239:	e8 17 1b 00 00       	call   802d55 <_panic>
+
+0080123e <sys_env_lease>:
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	57                   	push   %edi
+  801242:	56                   	push   %esi
+  801243:	53                   	push   %ebx
+  801244:	83 ec 0c             	sub    $0xc,%esp
+  801247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801252:	b8 16 00 00 00       	mov    $0x16,%eax
+  801257:	89 df                	mov    %ebx,%edi
+  801259:	89 de                	mov    %ebx,%esi
+  80125b:	cd 30                	int    $0x30
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	7f 08                	jg     801269 <sys_env_lease+0x2b>
+  801261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  80126c:	50                   	push   %eax
+  80126d:	6a 16                	push   $0x16
+  80126f:	68 8b 35 80 00       	push   $0x80358b
+  801274:	6a 24                	push   $0x24
+  801276:	68 a8 35 80 00       	push   $0x8035a8
+  80127b:	e8 d5 1a 00 00       	call   802d55 <_panic>
+
+00801280 <sys_copy_mem>:
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801294:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801297:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80129a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80129d:	cd 30                	int    $0x30
+  80129f:	85 c0                	test   %eax,%eax
+  8012a1:	7f 08                	jg     8012ab <sys_copy_mem+0x2b>
+  8012a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+  8012ab:	83 ec 0c             	sub    $0xc,%esp
+  8012ae:	50                   	push   %eax
+  8012af:	6a 17                	push   $0x17
+  8012b1:	68 8b 35 80 00       	push   $0x80358b
+  8012b6:	6a 24                	push   $0x24
+  8012b8:	68 a8 35 80 00       	push   $0x8035a8
+  8012bd:	e8 93 1a 00 00       	call   802d55 <_panic>
+
+008012c2 <sys_get_perms>:
+  8012c2:	55                   	push   %ebp
+  8012c3:	89 e5                	mov    %esp,%ebp
+  8012c5:	57                   	push   %edi
+  8012c6:	56                   	push   %esi
+  8012c7:	53                   	push   %ebx
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012de:	89 f7                	mov    %esi,%edi
+  8012e0:	cd 30                	int    $0x30
+  8012e2:	85 c0                	test   %eax,%eax
+  8012e4:	7f 08                	jg     8012ee <sys_get_perms+0x2c>
+  8012e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e9:	5b                   	pop    %ebx
+  8012ea:	5e                   	pop    %esi
+  8012eb:	5f                   	pop    %edi
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+  8012ee:	83 ec 0c             	sub    $0xc,%esp
+  8012f1:	50                   	push   %eax
+  8012f2:	6a 18                	push   $0x18
+  8012f4:	68 8b 35 80 00       	push   $0x80358b
+  8012f9:	6a 24                	push   $0x24
+  8012fb:	68 a8 35 80 00       	push   $0x8035a8
+  801300:	e8 50 1a 00 00       	call   802d55 <_panic>
+
+00801305 <sys_env_unsuspend>:
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+  80130e:	be 00 00 00 00       	mov    $0x0,%esi
+  801313:	8b 55 08             	mov    0x8(%ebp),%edx
+  801316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801319:	b8 19 00 00 00       	mov    $0x19,%eax
+  80131e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801321:	89 f7                	mov    %esi,%edi
+  801323:	cd 30                	int    $0x30
+  801325:	85 c0                	test   %eax,%eax
+  801327:	7f 08                	jg     801331 <sys_env_unsuspend+0x2c>
+  801329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+  801331:	83 ec 0c             	sub    $0xc,%esp
+  801334:	50                   	push   %eax
+  801335:	6a 19                	push   $0x19
+  801337:	68 8b 35 80 00       	push   $0x80358b
+  80133c:	6a 24                	push   $0x24
+  80133e:	68 a8 35 80 00       	push   $0x8035a8
+  801343:	e8 0d 1a 00 00       	call   802d55 <_panic>
+
+00801348 <sys_migrate>:
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	57                   	push   %edi
+  80134c:	56                   	push   %esi
+  80134d:	53                   	push   %ebx
+  80134e:	83 ec 0c             	sub    $0xc,%esp
+  801351:	ba 00 80 80 00       	mov    $0x808000,%edx
+  801356:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80135c:	76 11                	jbe    80136f <sys_migrate+0x27>
+  80135e:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801363:	0f b6 08             	movzbl (%eax),%ecx
+  801366:	05 00 10 00 00       	add    $0x1000,%eax
+  80136b:	39 d0                	cmp    %edx,%eax
+  80136d:	72 f4                	jb     801363 <sys_migrate+0x1b>
+  80136f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801374:	8b 55 08             	mov    0x8(%ebp),%edx
+  801377:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80137c:	89 cb                	mov    %ecx,%ebx
+  80137e:	89 cf                	mov    %ecx,%edi
+  801380:	89 ce                	mov    %ecx,%esi
+  801382:	cd 30                	int    $0x30
+  801384:	85 c0                	test   %eax,%eax
+  801386:	7f 08                	jg     801390 <sys_migrate+0x48>
+  801388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+  801390:	83 ec 0c             	sub    $0xc,%esp
+  801393:	50                   	push   %eax
+  801394:	6a 1a                	push   $0x1a
+  801396:	68 8b 35 80 00       	push   $0x80358b
+  80139b:	6a 24                	push   $0x24
+  80139d:	68 a8 35 80 00       	push   $0x8035a8
+  8013a2:	e8 ae 19 00 00       	call   802d55 <_panic>
+
+008013a7 <sys_lease_complete>:
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	57                   	push   %edi
+  8013ab:	56                   	push   %esi
+  8013ac:	53                   	push   %ebx
+  8013ad:	83 ec 0c             	sub    $0xc,%esp
+  8013b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013ba:	89 d1                	mov    %edx,%ecx
+  8013bc:	89 d3                	mov    %edx,%ebx
+  8013be:	89 d7                	mov    %edx,%edi
+  8013c0:	89 d6                	mov    %edx,%esi
+  8013c2:	cd 30                	int    $0x30
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	7f 08                	jg     8013d0 <sys_lease_complete+0x29>
+  8013c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cb:	5b                   	pop    %ebx
+  8013cc:	5e                   	pop    %esi
+  8013cd:	5f                   	pop    %edi
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	c3                   	ret
+  8013d0:	83 ec 0c             	sub    $0xc,%esp
+  8013d3:	50                   	push   %eax
+  8013d4:	6a 1b                	push   $0x1b
+  8013d6:	68 8b 35 80 00       	push   $0x80358b
+  8013db:	6a 24                	push   $0x24
+  8013dd:	68 a8 35 80 00       	push   $0x8035a8
+  8013e2:	e8 6e 19 00 00       	call   802d55 <_panic>
+
+008013e7 <sys_env_set_thisenv>:
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	57                   	push   %edi
+  8013eb:	56                   	push   %esi
+  8013ec:	53                   	push   %ebx
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801400:	89 df                	mov    %ebx,%edi
+  801402:	89 de                	mov    %ebx,%esi
+  801404:	cd 30                	int    $0x30
+  801406:	85 c0                	test   %eax,%eax
+  801408:	7f 08                	jg     801412 <sys_env_set_thisenv+0x2b>
+  80140a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140d:	5b                   	pop    %ebx
+  80140e:	5e                   	pop    %esi
+  80140f:	5f                   	pop    %edi
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+  801412:	83 ec 0c             	sub    $0xc,%esp
+  801415:	50                   	push   %eax
+  801416:	6a 1c                	push   $0x1c
+  801418:	68 8b 35 80 00       	push   $0x80358b
+  80141d:	6a 24                	push   $0x24
+  80141f:	68 a8 35 80 00       	push   $0x8035a8
+  801424:	e8 2c 19 00 00       	call   802d55 <_panic>
+
+00801429 <sys_env_set_sched>:
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	57                   	push   %edi
+  80142d:	56                   	push   %esi
+  80142e:	53                   	push   %ebx
+  80142f:	83 ec 0c             	sub    $0xc,%esp
+  801432:	be 00 00 00 00       	mov    $0x0,%esi
+  801437:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801442:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801445:	89 f7                	mov    %esi,%edi
+  801447:	cd 30                	int    $0x30
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	7f 08                	jg     801455 <sys_env_set_sched+0x2c>
+  80144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	50                   	push   %eax
+  801459:	6a 1d                	push   $0x1d
+  80145b:	68 8b 35 80 00       	push   $0x80358b
+  801460:	6a 24                	push   $0x24
+  801462:	68 a8 35 80 00       	push   $0x8035a8
+  801467:	e8 e9 18 00 00       	call   802d55 <_panic>
+
+0080146c <sys_batch>:
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	57                   	push   %edi
+  801470:	56                   	push   %esi
+  801471:	53                   	push   %ebx
+  801472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801482:	89 df                	mov    %ebx,%edi
+  801484:	89 de                	mov    %ebx,%esi
+  801486:	cd 30                	int    $0x30
+  801488:	5b                   	pop    %ebx
+  801489:	5e                   	pop    %esi
+  80148a:	5f                   	pop    %edi
+  80148b:	5d                   	pop    %ebp
+  80148c:	c3                   	ret
+
+0080148d <sys_env_stats>:
+  80148d:	55                   	push   %ebp
+  80148e:	89 e5                	mov    %esp,%ebp
+  801490:	57                   	push   %edi
+  801491:	56                   	push   %esi
+  801492:	53                   	push   %ebx
+  801493:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801498:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149e:	b8 23 00 00 00       	mov    $0x23,%eax
+  8014a3:	89 df                	mov    %ebx,%edi
+  8014a5:	89 de                	mov    %ebx,%esi
+  8014a7:	cd 30                	int    $0x30
+  8014a9:	5b                   	pop    %ebx
+  8014aa:	5e                   	pop    %esi
+  8014ab:	5f                   	pop    %edi
+  8014ac:	5d                   	pop    %ebp
+  8014ad:	c3                   	ret
+
+008014ae <sys_trace>:
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	57                   	push   %edi
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+  8014b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bc:	b8 24 00 00 00       	mov    $0x24,%eax
+  8014c1:	89 cb                	mov    %ecx,%ebx
+  8014c3:	89 cf                	mov    %ecx,%edi
+  8014c5:	89 ce                	mov    %ecx,%esi
+  8014c7:	cd 30                	int    $0x30
+  8014c9:	5b                   	pop    %ebx
+  8014ca:	5e                   	pop    %esi
+  8014cb:	5f                   	pop    %edi
+  8014cc:	5d                   	pop    %ebp
+  8014cd:	c3                   	ret
+
+008014ce <sys_env_set_pager>:
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	57                   	push   %edi
+  8014d2:	56                   	push   %esi
+  8014d3:	53                   	push   %ebx
+  8014d4:	83 ec 0c             	sub    $0xc,%esp
+  8014d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e2:	b8 25 00 00 00       	mov    $0x25,%eax
+  8014e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ea:	89 f7                	mov    %esi,%edi
+  8014ec:	cd 30                	int    $0x30
+  8014ee:	85 c0                	test   %eax,%eax
+  8014f0:	7f 08                	jg     8014fa <sys_env_set_pager+0x2c>
+  8014f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f5:	5b                   	pop    %ebx
+  8014f6:	5e                   	pop    %esi
+  8014f7:	5f                   	pop    %edi
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+  8014fa:	83 ec 0c             	sub    $0xc,%esp
+  8014fd:	50                   	push   %eax
+  8014fe:	6a 25                	push   $0x25
+  801500:	68 8b 35 80 00       	push   $0x80358b
+  801505:	6a 24                	push   $0x24
+  801507:	68 a8 35 80 00       	push   $0x8035a8
+  80150c:	e8 44 18 00 00       	call   802d55 <_panic>
+
+00801511 <sys_pager_retire>:
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	57                   	push   %edi
+  801515:	56                   	push   %esi
+  801516:	53                   	push   %ebx
+  801517:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151f:	b8 28 00 00 00       	mov    $0x28,%eax
+  801524:	89 cb                	mov    %ecx,%ebx
+  801526:	89 cf                	mov    %ecx,%edi
+  801528:	89 ce                	mov    %ecx,%esi
+  80152a:	cd 30                	int    $0x30
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+
+00801531 <sys_prof>:
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+  801537:	be 00 00 00 00       	mov    $0x0,%esi
+  80153c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801542:	b8 22 00 00 00       	mov    $0x22,%eax
+  801547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154a:	89 f7                	mov    %esi,%edi
+  80154c:	cd 30                	int    $0x30
+  80154e:	5b                   	pop    %ebx
+  80154f:	5e                   	pop    %esi
+  801550:	5f                   	pop    %edi
+  801551:	5d                   	pop    %ebp
+  801552:	c3                   	ret
+
+00801553 <set_pgfault_handler>:
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	53                   	push   %ebx
+  801557:	83 ec 04             	sub    $0x4,%esp
+  80155a:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  801561:	74 0d                	je     801570 <set_pgfault_handler+0x1d>
+  801563:	8b 45 08             	mov    0x8(%ebp),%eax
+  801566:	a3 14 50 80 00       	mov    %eax,0x805014
+  80156b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156e:	c9                   	leave
+  80156f:	c3                   	ret
+  801570:	e8 06 f7 ff ff       	call   800c7b <sys_getenvid>
+  801575:	89 c3                	mov    %eax,%ebx
+  801577:	83 ec 04             	sub    $0x4,%esp
+  80157a:	6a 07                	push   $0x7
+  80157c:	68 00 f0 7f ee       	push   $0xee7ff000
+  801581:	50                   	push   %eax
+  801582:	e8 5e f7 ff ff       	call   800ce5 <sys_page_alloc>
+  801587:	83 c4 10             	add    $0x10,%esp
+  80158a:	85 c0                	test   %eax,%eax
+  80158c:	78 29                	js     8015b7 <set_pgfault_handler+0x64>
+  80158e:	83 ec 08             	sub    $0x8,%esp
+  801591:	68 cb 15 80 00       	push   $0x8015cb
+  801596:	53                   	push   %ebx
+  801597:	e8 62 f9 ff ff       	call   800efe <sys_env_set_pgfault_upcall>
+  80159c:	83 c4 10             	add    $0x10,%esp
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	79 c0                	jns    801563 <set_pgfault_handler+0x10>
+  8015a3:	83 ec 04             	sub    $0x4,%esp
+  8015a6:	68 f0 35 80 00       	push   $0x8035f0
+  8015ab:	6a 27                	push   $0x27
+  8015ad:	68 22 36 80 00       	push   $0x803622
+  8015b2:	e8 9e 17 00 00       	call   802d55 <_panic>
+  8015b7:	83 ec 04             	sub    $0x4,%esp
+  8015ba:	68 b8 35 80 00       	push   $0x8035b8
+  8015bf:	6a 23                	push   $0x23
+  8015c1:	68 22 36 80 00       	push   $0x803622
+  8015c6:	e8 8a 17 00 00       	call   802d55 <_panic>
+
+008015cb <_pgfault_upcall>:
+  8015cb:	54                   	push   %esp
+  8015cc:	a1 14 50 80 00       	mov    0x805014,%eax
+  8015d1:	ff d0                	call   *%eax
+  8015d3:	83 c4 04             	add    $0x4,%esp
+  8015d6:	89 e3                	mov    %esp,%ebx
+  8015d8:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8015dc:	8b 54 24 30          	mov    0x30(%esp),%edx
+  8015e0:	89 d4                	mov    %edx,%esp
+  8015e2:	51                   	push   %ecx
+  8015e3:	89 dc                	mov    %ebx,%esp
+  8015e5:	83 ea 04             	sub    $0x4,%edx
+  8015e8:	89 54 24 30          	mov    %edx,0x30(%esp)
+  8015ec:	83 c4 08             	add    $0x8,%esp
+  8015ef:	61                   	popa
+  8015f0:	83 c4 04             	add    $0x4,%esp
+  8015f3:	9d                   	popf
+  8015f4:	5c                   	pop    %esp
+  8015f5:	c3                   	ret
+
+008015f6 <fd2num>:
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015fc:	05 00 00 00 30       	add    $0x30000000,%eax
+  801601:	c1 e8 0c             	shr    $0xc,%eax
+  801604:	5d                   	pop    %ebp
+  801605:	c3                   	ret
+
+00801606 <fd2data>:
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	8b 45 08             	mov    0x8(%ebp),%eax
+  80160c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801611:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801616:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+
+0080161d <fd_alloc>:
+  80161d:	55                   	push   %ebp
+  80161e:	89 e5                	mov    %esp,%ebp
+  801620:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801625:	89 c2                	mov    %eax,%edx
+  801627:	c1 ea 16             	shr    $0x16,%edx
+  80162a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801631:	f6 c2 01             	test   $0x1,%dl
+  801634:	74 29                	je     80165f <fd_alloc+0x42>
+  801636:	89 c2                	mov    %eax,%edx
+  801638:	c1 ea 0c             	shr    $0xc,%edx
+  80163b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801642:	f6 c2 01             	test   $0x1,%dl
+  801645:	74 18                	je     80165f <fd_alloc+0x42>
+  801647:	05 00 10 00 00       	add    $0x1000,%eax
+  80164c:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801651:	75 d2                	jne    801625 <fd_alloc+0x8>
+  801653:	b8 00 00 00 00       	mov    $0x0,%eax
+  801658:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80165d:	eb 05                	jmp    801664 <fd_alloc+0x47>
+  80165f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801664:	8b 55 08             	mov    0x8(%ebp),%edx
+  801667:	89 02                	mov    %eax,(%edx)
+  801669:	89 c8                	mov    %ecx,%eax
+  80166b:	5d                   	pop    %ebp
+  80166c:	c3                   	ret
+
+0080166d <fd_lookup>:
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	8b 45 08             	mov    0x8(%ebp),%eax
+  801673:	83 f8 1f             	cmp    $0x1f,%eax
+  801676:	77 30                	ja     8016a8 <fd_lookup+0x3b>
+  801678:	c1 e0 0c             	shl    $0xc,%eax
+  80167b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801680:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801686:	f6 c2 01             	test   $0x1,%dl
+  801689:	74 24                	je     8016af <fd_lookup+0x42>
+  80168b:	89 c2                	mov    %eax,%edx
+  80168d:	c1 ea 0c             	shr    $0xc,%edx
+  801690:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801697:	f6 c2 01             	test   $0x1,%dl
+  80169a:	74 1a                	je     8016b6 <fd_lookup+0x49>
+  80169c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80169f:	89 02                	mov    %eax,(%edx)
+  8016a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a6:	5d                   	pop    %ebp
+  8016a7:	c3                   	ret
+  8016a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ad:	eb f7                	jmp    8016a6 <fd_lookup+0x39>
+  8016af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b4:	eb f0                	jmp    8016a6 <fd_lookup+0x39>
+  8016b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016bb:	eb e9                	jmp    8016a6 <fd_lookup+0x39>
+
+008016bd <dev_lookup>:
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	53                   	push   %ebx
+  8016c1:	83 ec 04             	sub    $0x4,%esp
+  8016c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cc:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8016d1:	39 13                	cmp    %edx,(%ebx)
+  8016d3:	74 37                	je     80170c <dev_lookup+0x4f>
+  8016d5:	83 c0 01             	add    $0x1,%eax
+  8016d8:	8b 1c 85 ac 36 80 00 	mov    0x8036ac(,%eax,4),%ebx
+  8016df:	85 db                	test   %ebx,%ebx
+  8016e1:	75 ee                	jne    8016d1 <dev_lookup+0x14>
+  8016e3:	a1 10 50 80 00       	mov    0x805010,%eax
+  8016e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8016eb:	83 ec 04             	sub    $0x4,%esp
+  8016ee:	52                   	push   %edx
+  8016ef:	50                   	push   %eax
+  8016f0:	68 30 36 80 00       	push   $0x803630
+  8016f5:	e8 94 ea ff ff       	call   80018e <cprintf>
+  8016fa:	83 c4 10             	add    $0x10,%esp
+  8016fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801702:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801705:	89 1a                	mov    %ebx,(%edx)
+  801707:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170a:	c9                   	leave
+  80170b:	c3                   	ret
+  80170c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801711:	eb ef                	jmp    801702 <dev_lookup+0x45>
+
+00801713 <fd_close>:
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	57                   	push   %edi
+  801717:	56                   	push   %esi
+  801718:	53                   	push   %ebx
+  801719:	83 ec 24             	sub    $0x24,%esp
+  80171c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80171f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801722:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801725:	50                   	push   %eax
+  801726:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80172c:	c1 e8 0c             	shr    $0xc,%eax
+  80172f:	50                   	push   %eax
+  801730:	e8 38 ff ff ff       	call   80166d <fd_lookup>
+  801735:	89 c3                	mov    %eax,%ebx
+  801737:	83 c4 10             	add    $0x10,%esp
+  80173a:	85 c0                	test   %eax,%eax
+  80173c:	78 05                	js     801743 <fd_close+0x30>
+  80173e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801741:	74 0f                	je     801752 <fd_close+0x3f>
+  801743:	85 ff                	test   %edi,%edi
+  801745:	0f 44 df             	cmove  %edi,%ebx
+  801748:	89 d8                	mov    %ebx,%eax
+  80174a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174d:	5b                   	pop    %ebx
+  80174e:	5e                   	pop    %esi
+  80174f:	5f                   	pop    %edi
+  801750:	5d                   	pop    %ebp
+  801751:	c3                   	ret
+  801752:	83 ec 08             	sub    $0x8,%esp
+  801755:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801758:	50                   	push   %eax
+  801759:	ff 36                	push   (%esi)
+  80175b:	e8 5d ff ff ff       	call   8016bd <dev_lookup>
+  801760:	89 c3                	mov    %eax,%ebx
+  801762:	83 c4 10             	add    $0x10,%esp
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 1a                	js     801783 <fd_close+0x70>
+  801769:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80176c:	8b 40 10             	mov    0x10(%eax),%eax
+  80176f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801774:	85 c0                	test   %eax,%eax
+  801776:	74 0b                	je     801783 <fd_close+0x70>
+  801778:	83 ec 0c             	sub    $0xc,%esp
+  80177b:	56                   	push   %esi
+  80177c:	ff d0                	call   *%eax
+  80177e:	89 c3                	mov    %eax,%ebx
+  801780:	83 c4 10             	add    $0x10,%esp
+  801783:	83 ec 08             	sub    $0x8,%esp
+  801786:	56                   	push   %esi
+  801787:	6a 00                	push   $0x0
+  801789:	e8 29 f6 ff ff       	call   800db7 <sys_page_unmap>
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	eb b5                	jmp    801748 <fd_close+0x35>
+
+00801793 <close>:
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	83 ec 20             	sub    $0x20,%esp
+  801799:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179c:	50                   	push   %eax
+  80179d:	ff 75 08             	push   0x8(%ebp)
+  8017a0:	e8 c8 fe ff ff       	call   80166d <fd_lookup>
+  8017a5:	83 c4 10             	add    $0x10,%esp
+  8017a8:	85 c0                	test   %eax,%eax
+  8017aa:	79 02                	jns    8017ae <close+0x1b>
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+  8017ae:	83 ec 08             	sub    $0x8,%esp
+  8017b1:	6a 01                	push   $0x1
+  8017b3:	ff 75 f4             	push   -0xc(%ebp)
+  8017b6:	e8 58 ff ff ff       	call   801713 <fd_close>
+  8017bb:	83 c4 10             	add    $0x10,%esp
+  8017be:	eb ec                	jmp    8017ac <close+0x19>
+
+008017c0 <close_all>:
+  8017c0:	55                   	push   %ebp
+  8017c1:	89 e5                	mov    %esp,%ebp
+  8017c3:	53                   	push   %ebx
+  8017c4:	83 ec 04             	sub    $0x4,%esp
+  8017c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cc:	83 ec 0c             	sub    $0xc,%esp
+  8017cf:	53                   	push   %ebx
+  8017d0:	e8 be ff ff ff       	call   801793 <close>
+  8017d5:	83 c3 01             	add    $0x1,%ebx
+  8017d8:	83 c4 10             	add    $0x10,%esp
+  8017db:	83 fb 20             	cmp    $0x20,%ebx
+  8017de:	75 ec                	jne    8017cc <close_all+0xc>
+  8017e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+008017e5 <dup>:
+  8017e5:	55                   	push   %ebp
+  8017e6:	89 e5                	mov    %esp,%ebp
+  8017e8:	57                   	push   %edi
+  8017e9:	56                   	push   %esi
+  8017ea:	53                   	push   %ebx
+  8017eb:	83 ec 34             	sub    $0x34,%esp
+  8017ee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017f1:	50                   	push   %eax
+  8017f2:	ff 75 08             	push   0x8(%ebp)
+  8017f5:	e8 73 fe ff ff       	call   80166d <fd_lookup>
+  8017fa:	89 c3                	mov    %eax,%ebx
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	78 7f                	js     801882 <dup+0x9d>
+  801803:	83 ec 0c             	sub    $0xc,%esp
+  801806:	ff 75 0c             	push   0xc(%ebp)
+  801809:	e8 85 ff ff ff       	call   801793 <close>
+  80180e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801811:	c1 e6 0c             	shl    $0xc,%esi
+  801814:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80181a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80181d:	89 3c 24             	mov    %edi,(%esp)
+  801820:	e8 e1 fd ff ff       	call   801606 <fd2data>
+  801825:	89 c3                	mov    %eax,%ebx
+  801827:	89 34 24             	mov    %esi,(%esp)
+  80182a:	e8 d7 fd ff ff       	call   801606 <fd2data>
+  80182f:	83 c4 10             	add    $0x10,%esp
+  801832:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801835:	89 d8                	mov    %ebx,%eax
+  801837:	c1 e8 16             	shr    $0x16,%eax
+  80183a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801841:	a8 01                	test   $0x1,%al
+  801843:	74 11                	je     801856 <dup+0x71>
+  801845:	89 d8                	mov    %ebx,%eax
+  801847:	c1 e8 0c             	shr    $0xc,%eax
+  80184a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801851:	f6 c2 01             	test   $0x1,%dl
+  801854:	75 36                	jne    80188c <dup+0xa7>
+  801856:	89 f8                	mov    %edi,%eax
+  801858:	c1 e8 0c             	shr    $0xc,%eax
+  80185b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	25 07 0e 00 00       	and    $0xe07,%eax
+  80186a:	50                   	push   %eax
+  80186b:	56                   	push   %esi
+  80186c:	6a 00                	push   $0x0
+  80186e:	57                   	push   %edi
+  80186f:	6a 00                	push   $0x0
+  801871:	e8 b2 f4 ff ff       	call   800d28 <sys_page_map>
+  801876:	89 c3                	mov    %eax,%ebx
+  801878:	83 c4 20             	add    $0x20,%esp
+  80187b:	85 c0                	test   %eax,%eax
+  80187d:	78 33                	js     8018b2 <dup+0xcd>
+  80187f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801882:	89 d8                	mov    %ebx,%eax
+  801884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801887:	5b                   	pop    %ebx
+  801888:	5e                   	pop    %esi
+  801889:	5f                   	pop    %edi
+  80188a:	5d                   	pop    %ebp
+  80188b:	c3                   	ret
+  80188c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801893:	83 ec 0c             	sub    $0xc,%esp
+  801896:	25 07 0e 00 00       	and    $0xe07,%eax
+  80189b:	50                   	push   %eax
+  80189c:	ff 75 d4             	push   -0x2c(%ebp)
+  80189f:	6a 00                	push   $0x0
+  8018a1:	53                   	push   %ebx
+  8018a2:	6a 00                	push   $0x0
+  8018a4:	e8 7f f4 ff ff       	call   800d28 <sys_page_map>
+  8018a9:	89 c3                	mov    %eax,%ebx
+  8018ab:	83 c4 20             	add    $0x20,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	79 a4                	jns    801856 <dup+0x71>
+  8018b2:	83 ec 08             	sub    $0x8,%esp
+  8018b5:	56                   	push   %esi
+  8018b6:	6a 00                	push   $0x0
+  8018b8:	e8 fa f4 ff ff       	call   800db7 <sys_page_unmap>
+  8018bd:	83 c4 08             	add    $0x8,%esp
+  8018c0:	ff 75 d4             	push   -0x2c(%ebp)
+  8018c3:	6a 00                	push   $0x0
+  8018c5:	e8 ed f4 ff ff       	call   800db7 <sys_page_unmap>
+  8018ca:	83 c4 10             	add    $0x10,%esp
+  8018cd:	eb b3                	jmp    801882 <dup+0x9d>
+
+008018cf <read>:
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	56                   	push   %esi
+  8018d3:	53                   	push   %ebx
+  8018d4:	83 ec 18             	sub    $0x18,%esp
+  8018d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018da:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018dd:	50                   	push   %eax
+  8018de:	56                   	push   %esi
+  8018df:	e8 89 fd ff ff       	call   80166d <fd_lookup>
+  8018e4:	83 c4 10             	add    $0x10,%esp
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	78 3c                	js     801927 <read+0x58>
+  8018eb:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018ee:	83 ec 08             	sub    $0x8,%esp
+  8018f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f4:	50                   	push   %eax
+  8018f5:	ff 33                	push   (%ebx)
+  8018f7:	e8 c1 fd ff ff       	call   8016bd <dev_lookup>
+  8018fc:	83 c4 10             	add    $0x10,%esp
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	78 24                	js     801927 <read+0x58>
+  801903:	8b 43 08             	mov    0x8(%ebx),%eax
+  801906:	83 e0 03             	and    $0x3,%eax
+  801909:	83 f8 01             	cmp    $0x1,%eax
+  80190c:	74 20                	je     80192e <read+0x5f>
+  80190e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801911:	8b 40 08             	mov    0x8(%eax),%eax
+  801914:	85 c0                	test   %eax,%eax
+  801916:	74 37                	je     80194f <read+0x80>
+  801918:	83 ec 04             	sub    $0x4,%esp
+  80191b:	ff 75 10             	push   0x10(%ebp)
+  80191e:	ff 75 0c             	push   0xc(%ebp)
+  801921:	53                   	push   %ebx
+  801922:	ff d0                	call   *%eax
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192a:	5b                   	pop    %ebx
+  80192b:	5e                   	pop    %esi
+  80192c:	5d                   	pop    %ebp
+  80192d:	c3                   	ret
+  80192e:	a1 10 50 80 00       	mov    0x805010,%eax
+  801933:	8b 40 48             	mov    0x48(%eax),%eax
+  801936:	83 ec 04             	sub    $0x4,%esp
+  801939:	56                   	push   %esi
+  80193a:	50                   	push   %eax
+  80193b:	68 71 36 80 00       	push   $0x803671
+  801940:	e8 49 e8 ff ff       	call   80018e <cprintf>
+  801945:	83 c4 10             	add    $0x10,%esp
+  801948:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194d:	eb d8                	jmp    801927 <read+0x58>
+  80194f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801954:	eb d1                	jmp    801927 <read+0x58>
+
+00801956 <readn>:
+  801956:	55                   	push   %ebp
+  801957:	89 e5                	mov    %esp,%ebp
+  801959:	57                   	push   %edi
+  80195a:	56                   	push   %esi
+  80195b:	53                   	push   %ebx
+  80195c:	83 ec 0c             	sub    $0xc,%esp
+  80195f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801962:	8b 75 10             	mov    0x10(%ebp),%esi
+  801965:	85 f6                	test   %esi,%esi
+  801967:	74 30                	je     801999 <readn+0x43>
+  801969:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801973:	83 ec 04             	sub    $0x4,%esp
+  801976:	89 f2                	mov    %esi,%edx
+  801978:	29 c2                	sub    %eax,%edx
+  80197a:	52                   	push   %edx
+  80197b:	01 f8                	add    %edi,%eax
+  80197d:	50                   	push   %eax
+  80197e:	ff 75 08             	push   0x8(%ebp)
+  801981:	e8 49 ff ff ff       	call   8018cf <read>
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	78 15                	js     8019a2 <readn+0x4c>
+  80198d:	74 11                	je     8019a0 <readn+0x4a>
+  80198f:	01 c3                	add    %eax,%ebx
+  801991:	89 d8                	mov    %ebx,%eax
+  801993:	39 f3                	cmp    %esi,%ebx
+  801995:	72 dc                	jb     801973 <readn+0x1d>
+  801997:	eb 09                	jmp    8019a2 <readn+0x4c>
+  801999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199e:	eb 02                	jmp    8019a2 <readn+0x4c>
+  8019a0:	89 d8                	mov    %ebx,%eax
+  8019a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a5:	5b                   	pop    %ebx
+  8019a6:	5e                   	pop    %esi
+  8019a7:	5f                   	pop    %edi
+  8019a8:	5d                   	pop    %ebp
+  8019a9:	c3                   	ret
+
+008019aa <write>:
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	56                   	push   %esi
+  8019ae:	53                   	push   %ebx
+  8019af:	83 ec 18             	sub    $0x18,%esp
+  8019b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019b5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	53                   	push   %ebx
+  8019ba:	e8 ae fc ff ff       	call   80166d <fd_lookup>
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 37                	js     8019fd <write+0x53>
+  8019c6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019c9:	83 ec 08             	sub    $0x8,%esp
+  8019cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019cf:	50                   	push   %eax
+  8019d0:	ff 36                	push   (%esi)
+  8019d2:	e8 e6 fc ff ff       	call   8016bd <dev_lookup>
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	78 1f                	js     8019fd <write+0x53>
+  8019de:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019e2:	74 20                	je     801a04 <write+0x5a>
+  8019e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	74 37                	je     801a25 <write+0x7b>
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+  8019f1:	ff 75 10             	push   0x10(%ebp)
+  8019f4:	ff 75 0c             	push   0xc(%ebp)
+  8019f7:	56                   	push   %esi
+  8019f8:	ff d0                	call   *%eax
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a00:	5b                   	pop    %ebx
+  801a01:	5e                   	pop    %esi
+  801a02:	5d                   	pop    %ebp
+  801a03:	c3                   	ret
+  801a04:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a09:	8b 40 48             	mov    0x48(%eax),%eax
+  801a0c:	83 ec 04             	sub    $0x4,%esp
+  801a0f:	53                   	push   %ebx
+  801a10:	50                   	push   %eax
+  801a11:	68 8d 36 80 00       	push   $0x80368d
+  801a16:	e8 73 e7 ff ff       	call   80018e <cprintf>
+  801a1b:	83 c4 10             	add    $0x10,%esp
+  801a1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a23:	eb d8                	jmp    8019fd <write+0x53>
+  801a25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a2a:	eb d1                	jmp    8019fd <write+0x53>
+
+00801a2c <seek>:
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	83 ec 20             	sub    $0x20,%esp
+  801a32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a35:	50                   	push   %eax
+  801a36:	ff 75 08             	push   0x8(%ebp)
+  801a39:	e8 2f fc ff ff       	call   80166d <fd_lookup>
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	78 0e                	js     801a53 <seek+0x27>
+  801a45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4b:	89 50 04             	mov    %edx,0x4(%eax)
+  801a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a53:	c9                   	leave
+  801a54:	c3                   	ret
+
+00801a55 <ftruncate>:
+  801a55:	55                   	push   %ebp
+  801a56:	89 e5                	mov    %esp,%ebp
+  801a58:	56                   	push   %esi
+  801a59:	53                   	push   %ebx
+  801a5a:	83 ec 18             	sub    $0x18,%esp
+  801a5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a60:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a63:	50                   	push   %eax
+  801a64:	53                   	push   %ebx
+  801a65:	e8 03 fc ff ff       	call   80166d <fd_lookup>
+  801a6a:	83 c4 10             	add    $0x10,%esp
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	78 34                	js     801aa5 <ftruncate+0x50>
+  801a71:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a74:	83 ec 08             	sub    $0x8,%esp
+  801a77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7a:	50                   	push   %eax
+  801a7b:	ff 36                	push   (%esi)
+  801a7d:	e8 3b fc ff ff       	call   8016bd <dev_lookup>
+  801a82:	83 c4 10             	add    $0x10,%esp
+  801a85:	85 c0                	test   %eax,%eax
+  801a87:	78 1c                	js     801aa5 <ftruncate+0x50>
+  801a89:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a8d:	74 1d                	je     801aac <ftruncate+0x57>
+  801a8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a92:	8b 40 18             	mov    0x18(%eax),%eax
+  801a95:	85 c0                	test   %eax,%eax
+  801a97:	74 34                	je     801acd <ftruncate+0x78>
+  801a99:	83 ec 08             	sub    $0x8,%esp
+  801a9c:	ff 75 0c             	push   0xc(%ebp)
+  801a9f:	56                   	push   %esi
+  801aa0:	ff d0                	call   *%eax
+  801aa2:	83 c4 10             	add    $0x10,%esp
+  801aa5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa8:	5b                   	pop    %ebx
+  801aa9:	5e                   	pop    %esi
+  801aaa:	5d                   	pop    %ebp
+  801aab:	c3                   	ret
+  801aac:	a1 10 50 80 00       	mov    0x805010,%eax
+  801ab1:	8b 40 48             	mov    0x48(%eax),%eax
+  801ab4:	83 ec 04             	sub    $0x4,%esp
+  801ab7:	53                   	push   %ebx
+  801ab8:	50                   	push   %eax
+  801ab9:	68 50 36 80 00       	push   $0x803650
+  801abe:	e8 cb e6 ff ff       	call   80018e <cprintf>
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801acb:	eb d8                	jmp    801aa5 <ftruncate+0x50>
+  801acd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ad2:	eb d1                	jmp    801aa5 <ftruncate+0x50>
+
+00801ad4 <fstat>:
+  801ad4:	55                   	push   %ebp
+  801ad5:	89 e5                	mov    %esp,%ebp
+  801ad7:	56                   	push   %esi
+  801ad8:	53                   	push   %ebx
+  801ad9:	83 ec 18             	sub    $0x18,%esp
+  801adc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801adf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ae2:	50                   	push   %eax
+  801ae3:	ff 75 08             	push   0x8(%ebp)
+  801ae6:	e8 82 fb ff ff       	call   80166d <fd_lookup>
+  801aeb:	83 c4 10             	add    $0x10,%esp
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	78 49                	js     801b3b <fstat+0x67>
+  801af2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801af5:	83 ec 08             	sub    $0x8,%esp
+  801af8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801afb:	50                   	push   %eax
+  801afc:	ff 36                	push   (%esi)
+  801afe:	e8 ba fb ff ff       	call   8016bd <dev_lookup>
+  801b03:	83 c4 10             	add    $0x10,%esp
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	78 31                	js     801b3b <fstat+0x67>
+  801b0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b0d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b11:	74 2f                	je     801b42 <fstat+0x6e>
+  801b13:	c6 03 00             	movb   $0x0,(%ebx)
+  801b16:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b1d:	00 00 00 
+  801b20:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b27:	00 00 00 
+  801b2a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801b30:	83 ec 08             	sub    $0x8,%esp
+  801b33:	53                   	push   %ebx
+  801b34:	56                   	push   %esi
+  801b35:	ff 50 14             	call   *0x14(%eax)
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3e:	5b                   	pop    %ebx
+  801b3f:	5e                   	pop    %esi
+  801b40:	5d                   	pop    %ebp
+  801b41:	c3                   	ret
+  801b42:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b47:	eb f2                	jmp    801b3b <fstat+0x67>
+
+00801b49 <stat>:
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	56                   	push   %esi
+  801b4d:	53                   	push   %ebx
+  801b4e:	83 ec 08             	sub    $0x8,%esp
+  801b51:	6a 00                	push   $0x0
+  801b53:	ff 75 08             	push   0x8(%ebp)
+  801b56:	e8 31 05 00 00       	call   80208c <open>
+  801b5b:	89 c3                	mov    %eax,%ebx
+  801b5d:	83 c4 10             	add    $0x10,%esp
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	78 1b                	js     801b7f <stat+0x36>
+  801b64:	83 ec 08             	sub    $0x8,%esp
+  801b67:	ff 75 0c             	push   0xc(%ebp)
+  801b6a:	50                   	push   %eax
+  801b6b:	e8 64 ff ff ff       	call   801ad4 <fstat>
+  801b70:	89 c6                	mov    %eax,%esi
+  801b72:	89 1c 24             	mov    %ebx,(%esp)
+  801b75:	e8 19 fc ff ff       	call   801793 <close>
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	89 f3                	mov    %esi,%ebx
+  801b7f:	89 d8                	mov    %ebx,%eax
+  801b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b84:	5b                   	pop    %ebx
+  801b85:	5e                   	pop    %esi
+  801b86:	5d                   	pop    %ebp
+  801b87:	c3                   	ret
+
+00801b88 <fsipc>:
+  801b88:	55                   	push   %ebp
+  801b89:	89 e5                	mov    %esp,%ebp
+  801b8b:	56                   	push   %esi
+  801b8c:	53                   	push   %ebx
+  801b8d:	89 c3                	mov    %eax,%ebx
+  801b8f:	89 d6                	mov    %edx,%esi
+  801b91:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801b98:	74 20                	je     801bba <fsipc+0x32>
+  801b9a:	83 ec 08             	sub    $0x8,%esp
+  801b9d:	6a 00                	push   $0x0
+  801b9f:	56                   	push   %esi
+  801ba0:	6a 07                	push   $0x7
+  801ba2:	68 00 60 80 00       	push   $0x806000
+  801ba7:	53                   	push   %ebx
+  801ba8:	ff 35 08 50 80 00    	push   0x805008
+  801bae:	e8 a0 12 00 00       	call   802e53 <ipc_call>
+  801bb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb6:	5b                   	pop    %ebx
+  801bb7:	5e                   	pop    %esi
+  801bb8:	5d                   	pop    %ebp
+  801bb9:	c3                   	ret
+  801bba:	83 ec 0c             	sub    $0xc,%esp
+  801bbd:	6a 02                	push   $0x2
+  801bbf:	e8 2a 14 00 00       	call   802fee <ipc_find_env>
+  801bc4:	a3 08 50 80 00       	mov    %eax,0x805008
+  801bc9:	83 c4 10             	add    $0x10,%esp
+  801bcc:	eb cc                	jmp    801b9a <fsipc+0x12>
+
+00801bce <devfile_trunc>:
+  801bce:	55                   	push   %ebp
+  801bcf:	89 e5                	mov    %esp,%ebp
+  801bd1:	83 ec 08             	sub    $0x8,%esp
+  801bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bda:	a3 00 60 80 00       	mov    %eax,0x806000
+  801bdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be2:	a3 04 60 80 00       	mov    %eax,0x806004
+  801be7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bec:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bf1:	e8 92 ff ff ff       	call   801b88 <fsipc>
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+
+00801bf8 <devfile_flush>:
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	83 ec 08             	sub    $0x8,%esp
+  801bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c01:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c04:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c13:	e8 70 ff ff ff       	call   801b88 <fsipc>
+  801c18:	c9                   	leave
+  801c19:	c3                   	ret
+
+00801c1a <devfile_stat>:
+  801c1a:	55                   	push   %ebp
+  801c1b:	89 e5                	mov    %esp,%ebp
+  801c1d:	53                   	push   %ebx
+  801c1e:	83 ec 04             	sub    $0x4,%esp
+  801c21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c27:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c2a:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c34:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c39:	e8 4a ff ff ff       	call   801b88 <fsipc>
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	78 2c                	js     801c6e <devfile_stat+0x54>
+  801c42:	83 ec 08             	sub    $0x8,%esp
+  801c45:	68 00 60 80 00       	push   $0x806000
+  801c4a:	53                   	push   %ebx
+  801c4b:	e8 35 ec ff ff       	call   800885 <strcpy>
+  801c50:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c55:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801c5b:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c60:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801c66:	83 c4 10             	add    $0x10,%esp
+  801c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+
+00801c73 <fsring_rw>:
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	57                   	push   %edi
+  801c77:	56                   	push   %esi
+  801c78:	53                   	push   %ebx
+  801c79:	83 ec 2c             	sub    $0x2c,%esp
+  801c7c:	89 c7                	mov    %eax,%edi
+  801c7e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801c81:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801c84:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801c89:	a8 01                	test   $0x1,%al
+  801c8b:	74 0d                	je     801c9a <fsring_rw+0x27>
+  801c8d:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801c92:	a8 01                	test   $0x1,%al
+  801c94:	0f 85 d5 00 00 00    	jne    801d6f <fsring_rw+0xfc>
+  801c9a:	a1 10 50 80 00       	mov    0x805010,%eax
+  801c9f:	8b 40 48             	mov    0x48(%eax),%eax
+  801ca2:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801ca8:	0f 84 fc 00 00 00    	je     801daa <fsring_rw+0x137>
+  801cae:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801cb5:	0f 84 02 01 00 00    	je     801dbd <fsring_rw+0x14a>
+  801cbb:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801cc0:	83 ec 04             	sub    $0x4,%esp
+  801cc3:	68 07 02 00 00       	push   $0x207
+  801cc8:	53                   	push   %ebx
+  801cc9:	6a 00                	push   $0x0
+  801ccb:	e8 15 f0 ff ff       	call   800ce5 <sys_page_alloc>
+  801cd0:	83 c4 10             	add    $0x10,%esp
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	0f 88 f9 00 00 00    	js     801dd4 <fsring_rw+0x161>
+  801cdb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ce1:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ce7:	75 d7                	jne    801cc0 <fsring_rw+0x4d>
+  801ce9:	6a 0e                	push   $0xe
+  801ceb:	6a 0d                	push   $0xd
+  801ced:	ff 35 08 50 80 00    	push   0x805008
+  801cf3:	68 00 00 f0 cf       	push   $0xcff00000
+  801cf8:	e8 c4 0c 00 00       	call   8029c1 <ipcring_init>
+  801cfd:	83 c4 08             	add    $0x8,%esp
+  801d00:	6a 00                	push   $0x0
+  801d02:	6a 00                	push   $0x0
+  801d04:	68 07 02 00 00       	push   $0x207
+  801d09:	68 00 00 f0 cf       	push   $0xcff00000
+  801d0e:	6a 0b                	push   $0xb
+  801d10:	ff 35 08 50 80 00    	push   0x805008
+  801d16:	e8 38 11 00 00       	call   802e53 <ipc_call>
+  801d1b:	89 c6                	mov    %eax,%esi
+  801d1d:	83 c4 20             	add    $0x20,%esp
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	0f 88 ac 00 00 00    	js     801dd4 <fsring_rw+0x161>
+  801d28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d2d:	89 d9                	mov    %ebx,%ecx
+  801d2f:	83 c3 01             	add    $0x1,%ebx
+  801d32:	89 da                	mov    %ebx,%edx
+  801d34:	c1 e2 0c             	shl    $0xc,%edx
+  801d37:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801d3d:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801d43:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801d49:	83 ec 08             	sub    $0x8,%esp
+  801d4c:	6a 00                	push   $0x0
+  801d4e:	6a 00                	push   $0x0
+  801d50:	68 07 02 00 00       	push   $0x207
+  801d55:	50                   	push   %eax
+  801d56:	6a 0c                	push   $0xc
+  801d58:	ff 35 08 50 80 00    	push   0x805008
+  801d5e:	e8 f0 10 00 00       	call   802e53 <ipc_call>
+  801d63:	83 c4 20             	add    $0x20,%esp
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	78 6a                	js     801dd4 <fsring_rw+0x161>
+  801d6a:	83 fb 08             	cmp    $0x8,%ebx
+  801d6d:	75 be                	jne    801d2d <fsring_rw+0xba>
+  801d6f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801d73:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801d78:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801d7d:	0f 45 c2             	cmovne %edx,%eax
+  801d80:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801d83:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801d8a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801d91:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9d:	be 00 00 00 00       	mov    $0x0,%esi
+  801da2:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801da5:	e9 4b 01 00 00       	jmp    801ef5 <fsring_rw+0x282>
+  801daa:	e8 00 f3 ff ff       	call   8010af <sys_time_msec>
+  801daf:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801db5:	0f 89 f3 fe ff ff    	jns    801cae <fsring_rw+0x3b>
+  801dbb:	eb 54                	jmp    801e11 <fsring_rw+0x19e>
+  801dbd:	83 ec 0c             	sub    $0xc,%esp
+  801dc0:	6a 02                	push   $0x2
+  801dc2:	e8 27 12 00 00       	call   802fee <ipc_find_env>
+  801dc7:	a3 08 50 80 00       	mov    %eax,0x805008
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	e9 e7 fe ff ff       	jmp    801cbb <fsring_rw+0x48>
+  801dd4:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dd9:	83 ec 08             	sub    $0x8,%esp
+  801ddc:	53                   	push   %ebx
+  801ddd:	6a 00                	push   $0x0
+  801ddf:	e8 d3 ef ff ff       	call   800db7 <sys_page_unmap>
+  801de4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801df3:	75 e4                	jne    801dd9 <fsring_rw+0x166>
+  801df5:	e8 b5 f2 ff ff       	call   8010af <sys_time_msec>
+  801dfa:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801dff:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e04:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e09:	8b 40 48             	mov    0x48(%eax),%eax
+  801e0c:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e11:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801e18:	e9 7a 01 00 00       	jmp    801f97 <fsring_rw+0x324>
+  801e1d:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e20:	89 10                	mov    %edx,(%eax)
+  801e22:	89 58 04             	mov    %ebx,0x4(%eax)
+  801e25:	89 f2                	mov    %esi,%edx
+  801e27:	03 57 04             	add    0x4(%edi),%edx
+  801e2a:	89 50 08             	mov    %edx,0x8(%eax)
+  801e2d:	83 ec 04             	sub    $0x4,%esp
+  801e30:	53                   	push   %ebx
+  801e31:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801e34:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801e37:	52                   	push   %edx
+  801e38:	83 c0 0c             	add    $0xc,%eax
+  801e3b:	50                   	push   %eax
+  801e3c:	e8 f4 eb ff ff       	call   800a35 <memmove>
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e47:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e4a:	89 08                	mov    %ecx,(%eax)
+  801e4c:	83 ec 0c             	sub    $0xc,%esp
+  801e4f:	68 00 00 f0 cf       	push   $0xcff00000
+  801e54:	e8 c6 0b 00 00       	call   802a1f <ipcring_req_push>
+  801e59:	01 de                	add    %ebx,%esi
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801e61:	73 4c                	jae    801eaf <fsring_rw+0x23c>
+  801e63:	83 ec 0c             	sub    $0xc,%esp
+  801e66:	68 00 00 f0 cf       	push   $0xcff00000
+  801e6b:	e8 89 0b 00 00       	call   8029f9 <ipcring_req_slot>
+  801e70:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e73:	83 c4 10             	add    $0x10,%esp
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	74 35                	je     801eaf <fsring_rw+0x23c>
+  801e7a:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801e7f:	83 e0 07             	and    $0x7,%eax
+  801e82:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801e87:	c1 e0 0c             	shl    $0xc,%eax
+  801e8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e8d:	29 f3                	sub    %esi,%ebx
+  801e8f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801e92:	39 cb                	cmp    %ecx,%ebx
+  801e94:	0f 47 d9             	cmova  %ecx,%ebx
+  801e97:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e9b:	75 80                	jne    801e1d <fsring_rw+0x1aa>
+  801e9d:	8b 57 0c             	mov    0xc(%edi),%edx
+  801ea0:	89 10                	mov    %edx,(%eax)
+  801ea2:	89 58 04             	mov    %ebx,0x4(%eax)
+  801ea5:	89 f2                	mov    %esi,%edx
+  801ea7:	03 57 04             	add    0x4(%edi),%edx
+  801eaa:	89 50 08             	mov    %edx,0x8(%eax)
+  801ead:	eb 95                	jmp    801e44 <fsring_rw+0x1d1>
+  801eaf:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801eb4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801eb7:	83 ec 0c             	sub    $0xc,%esp
+  801eba:	68 00 00 f0 cf       	push   $0xcff00000
+  801ebf:	e8 94 0b 00 00       	call   802a58 <ipcring_rsp_wait>
+  801ec4:	8b 58 04             	mov    0x4(%eax),%ebx
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801ece:	75 45                	jne    801f15 <fsring_rw+0x2a2>
+  801ed0:	85 db                	test   %ebx,%ebx
+  801ed2:	79 41                	jns    801f15 <fsring_rw+0x2a2>
+  801ed4:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801ed7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801ede:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801ee5:	83 ec 0c             	sub    $0xc,%esp
+  801ee8:	68 00 00 f0 cf       	push   $0xcff00000
+  801eed:	e8 cc 0b 00 00       	call   802abe <ipcring_rsp_pop>
+  801ef2:	83 c4 10             	add    $0x10,%esp
+  801ef5:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801efb:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f00:	39 c2                	cmp    %eax,%edx
+  801f02:	74 75                	je     801f79 <fsring_rw+0x306>
+  801f04:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f08:	75 a5                	jne    801eaf <fsring_rw+0x23c>
+  801f0a:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f0d:	0f 82 50 ff ff ff    	jb     801e63 <fsring_rw+0x1f0>
+  801f13:	eb 9a                	jmp    801eaf <fsring_rw+0x23c>
+  801f15:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f19:	75 ca                	jne    801ee5 <fsring_rw+0x272>
+  801f1b:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f1f:	74 31                	je     801f52 <fsring_rw+0x2df>
+  801f21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f24:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f27:	29 c8                	sub    %ecx,%eax
+  801f29:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801f2c:	39 d0                	cmp    %edx,%eax
+  801f2e:	0f 47 c2             	cmova  %edx,%eax
+  801f31:	39 d8                	cmp    %ebx,%eax
+  801f33:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f38:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801f3c:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801f3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f44:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801f48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f4b:	01 d9                	add    %ebx,%ecx
+  801f4d:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801f50:	eb 93                	jmp    801ee5 <fsring_rw+0x272>
+  801f52:	83 ec 04             	sub    $0x4,%esp
+  801f55:	53                   	push   %ebx
+  801f56:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f59:	83 e0 07             	and    $0x7,%eax
+  801f5c:	c1 e0 0c             	shl    $0xc,%eax
+  801f5f:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801f65:	50                   	push   %eax
+  801f66:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801f69:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f6c:	01 c8                	add    %ecx,%eax
+  801f6e:	50                   	push   %eax
+  801f6f:	e8 c1 ea ff ff       	call   800a35 <memmove>
+  801f74:	83 c4 10             	add    $0x10,%esp
+  801f77:	eb a8                	jmp    801f21 <fsring_rw+0x2ae>
+  801f79:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f7d:	75 09                	jne    801f88 <fsring_rw+0x315>
+  801f7f:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f82:	0f 82 db fe ff ff    	jb     801e63 <fsring_rw+0x1f0>
+  801f88:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801f8b:	01 57 04             	add    %edx,0x4(%edi)
+  801f8e:	85 d2                	test   %edx,%edx
+  801f90:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801f94:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801f97:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801f9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f9d:	5b                   	pop    %ebx
+  801f9e:	5e                   	pop    %esi
+  801f9f:	5f                   	pop    %edi
+  801fa0:	5d                   	pop    %ebp
+  801fa1:	c3                   	ret
+
+00801fa2 <devfile_write>:
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	57                   	push   %edi
+  801fa6:	56                   	push   %esi
+  801fa7:	53                   	push   %ebx
+  801fa8:	83 ec 0c             	sub    $0xc,%esp
+  801fab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fb4:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801fba:	76 1a                	jbe    801fd6 <devfile_write+0x34>
+  801fbc:	83 ec 0c             	sub    $0xc,%esp
+  801fbf:	53                   	push   %ebx
+  801fc0:	89 f1                	mov    %esi,%ecx
+  801fc2:	ba 06 00 00 00       	mov    $0x6,%edx
+  801fc7:	89 f8                	mov    %edi,%eax
+  801fc9:	e8 a5 fc ff ff       	call   801c73 <fsring_rw>
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801fd4:	75 39                	jne    80200f <devfile_write+0x6d>
+  801fd6:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801fdb:	39 c3                	cmp    %eax,%ebx
+  801fdd:	0f 47 d8             	cmova  %eax,%ebx
+  801fe0:	8b 47 0c             	mov    0xc(%edi),%eax
+  801fe3:	a3 00 60 80 00       	mov    %eax,0x806000
+  801fe8:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801fee:	83 ec 04             	sub    $0x4,%esp
+  801ff1:	53                   	push   %ebx
+  801ff2:	56                   	push   %esi
+  801ff3:	68 08 60 80 00       	push   $0x806008
+  801ff8:	e8 38 ea ff ff       	call   800a35 <memmove>
+  801ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802002:	b8 04 00 00 00       	mov    $0x4,%eax
+  802007:	e8 7c fb ff ff       	call   801b88 <fsipc>
+  80200c:	83 c4 10             	add    $0x10,%esp
+  80200f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802012:	5b                   	pop    %ebx
+  802013:	5e                   	pop    %esi
+  802014:	5f                   	pop    %edi
+  802015:	5d                   	pop    %ebp
+  802016:	c3                   	ret
+
+00802017 <devfile_read>:
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	57                   	push   %edi
+  80201b:	56                   	push   %esi
+  80201c:	53                   	push   %ebx
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+  802020:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802023:	8b 75 10             	mov    0x10(%ebp),%esi
+  802026:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80202c:	76 1d                	jbe    80204b <devfile_read+0x34>
+  80202e:	83 ec 0c             	sub    $0xc,%esp
+  802031:	56                   	push   %esi
+  802032:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802035:	ba 05 00 00 00       	mov    $0x5,%edx
+  80203a:	89 f8                	mov    %edi,%eax
+  80203c:	e8 32 fc ff ff       	call   801c73 <fsring_rw>
+  802041:	89 c3                	mov    %eax,%ebx
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802049:	75 37                	jne    802082 <devfile_read+0x6b>
+  80204b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80204e:	a3 00 60 80 00       	mov    %eax,0x806000
+  802053:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802063:	e8 20 fb ff ff       	call   801b88 <fsipc>
+  802068:	89 c3                	mov    %eax,%ebx
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	78 14                	js     802082 <devfile_read+0x6b>
+  80206e:	83 ec 04             	sub    $0x4,%esp
+  802071:	50                   	push   %eax
+  802072:	68 00 60 80 00       	push   $0x806000
+  802077:	ff 75 0c             	push   0xc(%ebp)
+  80207a:	e8 b6 e9 ff ff       	call   800a35 <memmove>
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	89 d8                	mov    %ebx,%eax
+  802084:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802087:	5b                   	pop    %ebx
+  802088:	5e                   	pop    %esi
+  802089:	5f                   	pop    %edi
+  80208a:	5d                   	pop    %ebp
+  80208b:	c3                   	ret
+
+0080208c <open>:
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	56                   	push   %esi
+  802090:	53                   	push   %ebx
+  802091:	83 ec 1c             	sub    $0x1c,%esp
+  802094:	8b 75 08             	mov    0x8(%ebp),%esi
+  802097:	56                   	push   %esi
+  802098:	e8 9c e7 ff ff       	call   800839 <strlen>
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020a5:	7f 6c                	jg     802113 <open+0x87>
+  8020a7:	83 ec 0c             	sub    $0xc,%esp
+  8020aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ad:	50                   	push   %eax
+  8020ae:	e8 6a f5 ff ff       	call   80161d <fd_alloc>
+  8020b3:	89 c3                	mov    %eax,%ebx
+  8020b5:	83 c4 10             	add    $0x10,%esp
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	78 3c                	js     8020f8 <open+0x6c>
+  8020bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020bf:	a3 00 64 80 00       	mov    %eax,0x806400
+  8020c4:	83 ec 08             	sub    $0x8,%esp
+  8020c7:	56                   	push   %esi
+  8020c8:	68 00 60 80 00       	push   $0x806000
+  8020cd:	e8 b3 e7 ff ff       	call   800885 <strcpy>
+  8020d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020da:	e8 a9 fa ff ff       	call   801b88 <fsipc>
+  8020df:	89 c3                	mov    %eax,%ebx
+  8020e1:	83 c4 10             	add    $0x10,%esp
+  8020e4:	85 c0                	test   %eax,%eax
+  8020e6:	78 19                	js     802101 <open+0x75>
+  8020e8:	83 ec 0c             	sub    $0xc,%esp
+  8020eb:	ff 75 f4             	push   -0xc(%ebp)
+  8020ee:	e8 03 f5 ff ff       	call   8015f6 <fd2num>
+  8020f3:	89 c3                	mov    %eax,%ebx
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	89 d8                	mov    %ebx,%eax
+  8020fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fd:	5b                   	pop    %ebx
+  8020fe:	5e                   	pop    %esi
+  8020ff:	5d                   	pop    %ebp
+  802100:	c3                   	ret
+  802101:	83 ec 08             	sub    $0x8,%esp
+  802104:	6a 00                	push   $0x0
+  802106:	ff 75 f4             	push   -0xc(%ebp)
+  802109:	e8 05 f6 ff ff       	call   801713 <fd_close>
+  80210e:	83 c4 10             	add    $0x10,%esp
+  802111:	eb e5                	jmp    8020f8 <open+0x6c>
+  802113:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802118:	eb de                	jmp    8020f8 <open+0x6c>
+
+0080211a <file_image>:
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	53                   	push   %ebx
+  80211e:	83 ec 1c             	sub    $0x1c,%esp
+  802121:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802124:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802127:	50                   	push   %eax
+  802128:	ff 75 08             	push   0x8(%ebp)
+  80212b:	e8 3d f5 ff ff       	call   80166d <fd_lookup>
+  802130:	83 c4 10             	add    $0x10,%esp
+  802133:	85 c0                	test   %eax,%eax
+  802135:	78 58                	js     80218f <file_image+0x75>
+  802137:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80213a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802140:	39 08                	cmp    %ecx,(%eax)
+  802142:	75 50                	jne    802194 <file_image+0x7a>
+  802144:	83 fb 04             	cmp    $0x4,%ebx
+  802147:	77 52                	ja     80219b <file_image+0x81>
+  802149:	8b 40 0c             	mov    0xc(%eax),%eax
+  80214c:	a3 00 60 80 00       	mov    %eax,0x806000
+  802151:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802157:	83 ec 04             	sub    $0x4,%esp
+  80215a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80215d:	c1 e0 02             	shl    $0x2,%eax
+  802160:	50                   	push   %eax
+  802161:	ff 75 0c             	push   0xc(%ebp)
+  802164:	68 08 60 80 00       	push   $0x806008
+  802169:	e8 c7 e8 ff ff       	call   800a35 <memmove>
+  80216e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802173:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802178:	e8 0b fa ff ff       	call   801b88 <fsipc>
+  80217d:	83 c4 10             	add    $0x10,%esp
+  802180:	85 c0                	test   %eax,%eax
+  802182:	78 0b                	js     80218f <file_image+0x75>
+  802184:	8b 55 14             	mov    0x14(%ebp),%edx
+  802187:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80218d:	89 0a                	mov    %ecx,(%edx)
+  80218f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802192:	c9                   	leave
+  802193:	c3                   	ret
+  802194:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802199:	eb f4                	jmp    80218f <file_image+0x75>
+  80219b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021a0:	eb ed                	jmp    80218f <file_image+0x75>
+
+008021a2 <remove>:
+  8021a2:	55                   	push   %ebp
+  8021a3:	89 e5                	mov    %esp,%ebp
+  8021a5:	53                   	push   %ebx
+  8021a6:	83 ec 10             	sub    $0x10,%esp
+  8021a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021ac:	53                   	push   %ebx
+  8021ad:	e8 87 e6 ff ff       	call   800839 <strlen>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021ba:	7f 25                	jg     8021e1 <remove+0x3f>
+  8021bc:	83 ec 08             	sub    $0x8,%esp
+  8021bf:	53                   	push   %ebx
+  8021c0:	68 00 60 80 00       	push   $0x806000
+  8021c5:	e8 bb e6 ff ff       	call   800885 <strcpy>
+  8021ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cf:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021d4:	e8 af f9 ff ff       	call   801b88 <fsipc>
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021df:	c9                   	leave
+  8021e0:	c3                   	ret
+  8021e1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8021e6:	eb f4                	jmp    8021dc <remove+0x3a>
+
+008021e8 <sync>:
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+  8021eb:	83 ec 08             	sub    $0x8,%esp
+  8021ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021f8:	e8 8b f9 ff ff       	call   801b88 <fsipc>
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+
+008021ff <devsock_stat>:
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+  802202:	83 ec 10             	sub    $0x10,%esp
+  802205:	68 c0 36 80 00       	push   $0x8036c0
+  80220a:	ff 75 0c             	push   0xc(%ebp)
+  80220d:	e8 73 e6 ff ff       	call   800885 <strcpy>
+  802212:	b8 00 00 00 00       	mov    $0x0,%eax
+  802217:	c9                   	leave
+  802218:	c3                   	ret
+
+00802219 <devsock_close>:
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	53                   	push   %ebx
+  80221d:	83 ec 10             	sub    $0x10,%esp
+  802220:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802223:	53                   	push   %ebx
+  802224:	e8 df 0d 00 00       	call   803008 <pageref>
+  802229:	89 c2                	mov    %eax,%edx
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802233:	83 fa 01             	cmp    $0x1,%edx
+  802236:	74 05                	je     80223d <devsock_close+0x24>
+  802238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223b:	c9                   	leave
+  80223c:	c3                   	ret
+  80223d:	83 ec 0c             	sub    $0xc,%esp
+  802240:	ff 73 0c             	push   0xc(%ebx)
+  802243:	e8 aa 02 00 00       	call   8024f2 <nsipc_close>
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	eb eb                	jmp    802238 <devsock_close+0x1f>
+
+0080224d <devsock_write>:
+  80224d:	55                   	push   %ebp
+  80224e:	89 e5                	mov    %esp,%ebp
+  802250:	83 ec 08             	sub    $0x8,%esp
+  802253:	6a 00                	push   $0x0
+  802255:	ff 75 10             	push   0x10(%ebp)
+  802258:	ff 75 0c             	push   0xc(%ebp)
+  80225b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225e:	ff 70 0c             	push   0xc(%eax)
+  802261:	e8 6c 03 00 00       	call   8025d2 <nsipc_send>
+  802266:	c9                   	leave
+  802267:	c3                   	ret
+
+00802268 <devsock_read>:
+  802268:	55                   	push   %ebp
+  802269:	89 e5                	mov    %esp,%ebp
+  80226b:	83 ec 08             	sub    $0x8,%esp
+  80226e:	6a 00                	push   $0x0
+  802270:	ff 75 10             	push   0x10(%ebp)
+  802273:	ff 75 0c             	push   0xc(%ebp)
+  802276:	8b 45 08             	mov    0x8(%ebp),%eax
+  802279:	ff 70 0c             	push   0xc(%eax)
+  80227c:	e8 e2 02 00 00       	call   802563 <nsipc_recv>
+  802281:	c9                   	leave
+  802282:	c3                   	ret
+
+00802283 <fd2sockid>:
+  802283:	55                   	push   %ebp
+  802284:	89 e5                	mov    %esp,%ebp
+  802286:	83 ec 20             	sub    $0x20,%esp
+  802289:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80228c:	52                   	push   %edx
+  80228d:	50                   	push   %eax
+  80228e:	e8 da f3 ff ff       	call   80166d <fd_lookup>
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	78 10                	js     8022aa <fd2sockid+0x27>
+  80229a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80229d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022a3:	39 08                	cmp    %ecx,(%eax)
+  8022a5:	75 05                	jne    8022ac <fd2sockid+0x29>
+  8022a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022aa:	c9                   	leave
+  8022ab:	c3                   	ret
+  8022ac:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022b1:	eb f7                	jmp    8022aa <fd2sockid+0x27>
+
+008022b3 <alloc_sockfd>:
+  8022b3:	55                   	push   %ebp
+  8022b4:	89 e5                	mov    %esp,%ebp
+  8022b6:	56                   	push   %esi
+  8022b7:	53                   	push   %ebx
+  8022b8:	83 ec 1c             	sub    $0x1c,%esp
+  8022bb:	89 c6                	mov    %eax,%esi
+  8022bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c0:	50                   	push   %eax
+  8022c1:	e8 57 f3 ff ff       	call   80161d <fd_alloc>
+  8022c6:	89 c3                	mov    %eax,%ebx
+  8022c8:	83 c4 10             	add    $0x10,%esp
+  8022cb:	85 c0                	test   %eax,%eax
+  8022cd:	78 43                	js     802312 <alloc_sockfd+0x5f>
+  8022cf:	83 ec 04             	sub    $0x4,%esp
+  8022d2:	68 07 04 00 00       	push   $0x407
+  8022d7:	ff 75 f4             	push   -0xc(%ebp)
+  8022da:	6a 00                	push   $0x0
+  8022dc:	e8 04 ea ff ff       	call   800ce5 <sys_page_alloc>
+  8022e1:	89 c3                	mov    %eax,%ebx
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 28                	js     802312 <alloc_sockfd+0x5f>
+  8022ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ed:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8022f3:	89 10                	mov    %edx,(%eax)
+  8022f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8022ff:	89 70 0c             	mov    %esi,0xc(%eax)
+  802302:	83 ec 0c             	sub    $0xc,%esp
+  802305:	50                   	push   %eax
+  802306:	e8 eb f2 ff ff       	call   8015f6 <fd2num>
+  80230b:	89 c3                	mov    %eax,%ebx
+  80230d:	83 c4 10             	add    $0x10,%esp
+  802310:	eb 0c                	jmp    80231e <alloc_sockfd+0x6b>
+  802312:	83 ec 0c             	sub    $0xc,%esp
+  802315:	56                   	push   %esi
+  802316:	e8 d7 01 00 00       	call   8024f2 <nsipc_close>
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	89 d8                	mov    %ebx,%eax
+  802320:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802323:	5b                   	pop    %ebx
+  802324:	5e                   	pop    %esi
+  802325:	5d                   	pop    %ebp
+  802326:	c3                   	ret
+
+00802327 <accept>:
+  802327:	55                   	push   %ebp
+  802328:	89 e5                	mov    %esp,%ebp
+  80232a:	83 ec 08             	sub    $0x8,%esp
+  80232d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802330:	e8 4e ff ff ff       	call   802283 <fd2sockid>
+  802335:	85 c0                	test   %eax,%eax
+  802337:	78 1b                	js     802354 <accept+0x2d>
+  802339:	83 ec 04             	sub    $0x4,%esp
+  80233c:	ff 75 10             	push   0x10(%ebp)
+  80233f:	ff 75 0c             	push   0xc(%ebp)
+  802342:	50                   	push   %eax
+  802343:	e8 07 01 00 00       	call   80244f <nsipc_accept>
+  802348:	83 c4 10             	add    $0x10,%esp
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	78 05                	js     802354 <accept+0x2d>
+  80234f:	e8 5f ff ff ff       	call   8022b3 <alloc_sockfd>
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+00802356 <bind>:
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	83 ec 08             	sub    $0x8,%esp
+  80235c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235f:	e8 1f ff ff ff       	call   802283 <fd2sockid>
+  802364:	85 c0                	test   %eax,%eax
+  802366:	78 12                	js     80237a <bind+0x24>
+  802368:	83 ec 04             	sub    $0x4,%esp
+  80236b:	ff 75 10             	push   0x10(%ebp)
+  80236e:	ff 75 0c             	push   0xc(%ebp)
+  802371:	50                   	push   %eax
+  802372:	e8 24 01 00 00       	call   80249b <nsipc_bind>
+  802377:	83 c4 10             	add    $0x10,%esp
+  80237a:	c9                   	leave
+  80237b:	c3                   	ret
+
+0080237c <shutdown>:
+  80237c:	55                   	push   %ebp
+  80237d:	89 e5                	mov    %esp,%ebp
+  80237f:	83 ec 08             	sub    $0x8,%esp
+  802382:	8b 45 08             	mov    0x8(%ebp),%eax
+  802385:	e8 f9 fe ff ff       	call   802283 <fd2sockid>
+  80238a:	85 c0                	test   %eax,%eax
+  80238c:	78 0f                	js     80239d <shutdown+0x21>
+  80238e:	83 ec 08             	sub    $0x8,%esp
+  802391:	ff 75 0c             	push   0xc(%ebp)
+  802394:	50                   	push   %eax
+  802395:	e8 36 01 00 00       	call   8024d0 <nsipc_shutdown>
+  80239a:	83 c4 10             	add    $0x10,%esp
+  80239d:	c9                   	leave
+  80239e:	c3                   	ret
+
+0080239f <connect>:
+  80239f:	55                   	push   %ebp
+  8023a0:	89 e5                	mov    %esp,%ebp
+  8023a2:	83 ec 08             	sub    $0x8,%esp
+  8023a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a8:	e8 d6 fe ff ff       	call   802283 <fd2sockid>
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	78 12                	js     8023c3 <connect+0x24>
+  8023b1:	83 ec 04             	sub    $0x4,%esp
+  8023b4:	ff 75 10             	push   0x10(%ebp)
+  8023b7:	ff 75 0c             	push   0xc(%ebp)
+  8023ba:	50                   	push   %eax
+  8023bb:	e8 4c 01 00 00       	call   80250c <nsipc_connect>
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	c9                   	leave
+  8023c4:	c3                   	ret
+
+008023c5 <listen>:
+  8023c5:	55                   	push   %ebp
+  8023c6:	89 e5                	mov    %esp,%ebp
+  8023c8:	83 ec 08             	sub    $0x8,%esp
+  8023cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ce:	e8 b0 fe ff ff       	call   802283 <fd2sockid>
+  8023d3:	85 c0                	test   %eax,%eax
+  8023d5:	78 0f                	js     8023e6 <listen+0x21>
+  8023d7:	83 ec 08             	sub    $0x8,%esp
+  8023da:	ff 75 0c             	push   0xc(%ebp)
+  8023dd:	50                   	push   %eax
+  8023de:	e8 5e 01 00 00       	call   802541 <nsipc_listen>
+  8023e3:	83 c4 10             	add    $0x10,%esp
+  8023e6:	c9                   	leave
+  8023e7:	c3                   	ret
+
+008023e8 <socket>:
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	83 ec 0c             	sub    $0xc,%esp
+  8023ee:	ff 75 10             	push   0x10(%ebp)
+  8023f1:	ff 75 0c             	push   0xc(%ebp)
+  8023f4:	ff 75 08             	push   0x8(%ebp)
+  8023f7:	e8 34 02 00 00       	call   802630 <nsipc_socket>
+  8023fc:	83 c4 10             	add    $0x10,%esp
+  8023ff:	85 c0                	test   %eax,%eax
+  802401:	78 05                	js     802408 <socket+0x20>
+  802403:	e8 ab fe ff ff       	call   8022b3 <alloc_sockfd>
+  802408:	c9                   	leave
+  802409:	c3                   	ret
+
+0080240a <nsipc>:
+  80240a:	55                   	push   %ebp
+  80240b:	89 e5                	mov    %esp,%ebp
+  80240d:	53                   	push   %ebx
+  80240e:	83 ec 04             	sub    $0x4,%esp
+  802411:	89 c3                	mov    %eax,%ebx
+  802413:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80241a:	74 1f                	je     80243b <nsipc+0x31>
+  80241c:	83 ec 08             	sub    $0x8,%esp
+  80241f:	6a 00                	push   $0x0
+  802421:	6a 00                	push   $0x0
+  802423:	6a 07                	push   $0x7
+  802425:	68 00 70 80 00       	push   $0x807000
+  80242a:	53                   	push   %ebx
+  80242b:	ff 35 0c 50 80 00    	push   0x80500c
+  802431:	e8 1d 0a 00 00       	call   802e53 <ipc_call>
+  802436:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+  80243b:	83 ec 0c             	sub    $0xc,%esp
+  80243e:	6a 03                	push   $0x3
+  802440:	e8 a9 0b 00 00       	call   802fee <ipc_find_env>
+  802445:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80244a:	83 c4 10             	add    $0x10,%esp
+  80244d:	eb cd                	jmp    80241c <nsipc+0x12>
+
+0080244f <nsipc_accept>:
+  80244f:	55                   	push   %ebp
+  802450:	89 e5                	mov    %esp,%ebp
+  802452:	53                   	push   %ebx
+  802453:	83 ec 04             	sub    $0x4,%esp
+  802456:	8b 45 08             	mov    0x8(%ebp),%eax
+  802459:	a3 00 70 80 00       	mov    %eax,0x807000
+  80245e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802463:	e8 a2 ff ff ff       	call   80240a <nsipc>
+  802468:	89 c3                	mov    %eax,%ebx
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	79 07                	jns    802475 <nsipc_accept+0x26>
+  80246e:	89 d8                	mov    %ebx,%eax
+  802470:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802473:	c9                   	leave
+  802474:	c3                   	ret
+  802475:	83 ec 04             	sub    $0x4,%esp
+  802478:	ff 35 10 70 80 00    	push   0x807010
+  80247e:	68 00 70 80 00       	push   $0x807000
+  802483:	ff 75 0c             	push   0xc(%ebp)
+  802486:	e8 aa e5 ff ff       	call   800a35 <memmove>
+  80248b:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802491:	8b 45 10             	mov    0x10(%ebp),%eax
+  802494:	89 10                	mov    %edx,(%eax)
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	eb d3                	jmp    80246e <nsipc_accept+0x1f>
+
+0080249b <nsipc_bind>:
+  80249b:	55                   	push   %ebp
+  80249c:	89 e5                	mov    %esp,%ebp
+  80249e:	53                   	push   %ebx
+  80249f:	83 ec 08             	sub    $0x8,%esp
+  8024a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a8:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024ad:	53                   	push   %ebx
+  8024ae:	ff 75 0c             	push   0xc(%ebp)
+  8024b1:	68 04 70 80 00       	push   $0x807004
+  8024b6:	e8 7a e5 ff ff       	call   800a35 <memmove>
+  8024bb:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8024c1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024c6:	e8 3f ff ff ff       	call   80240a <nsipc>
+  8024cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+
+008024d0 <nsipc_shutdown>:
+  8024d0:	55                   	push   %ebp
+  8024d1:	89 e5                	mov    %esp,%ebp
+  8024d3:	83 ec 08             	sub    $0x8,%esp
+  8024d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024e1:	a3 04 70 80 00       	mov    %eax,0x807004
+  8024e6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024eb:	e8 1a ff ff ff       	call   80240a <nsipc>
+  8024f0:	c9                   	leave
+  8024f1:	c3                   	ret
+
+008024f2 <nsipc_close>:
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	83 ec 08             	sub    $0x8,%esp
+  8024f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024fb:	a3 00 70 80 00       	mov    %eax,0x807000
+  802500:	b8 04 00 00 00       	mov    $0x4,%eax
+  802505:	e8 00 ff ff ff       	call   80240a <nsipc>
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+
+0080250c <nsipc_connect>:
+  80250c:	55                   	push   %ebp
+  80250d:	89 e5                	mov    %esp,%ebp
+  80250f:	53                   	push   %ebx
+  802510:	83 ec 08             	sub    $0x8,%esp
+  802513:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802516:	8b 45 08             	mov    0x8(%ebp),%eax
+  802519:	a3 00 70 80 00       	mov    %eax,0x807000
+  80251e:	53                   	push   %ebx
+  80251f:	ff 75 0c             	push   0xc(%ebp)
+  802522:	68 04 70 80 00       	push   $0x807004
+  802527:	e8 09 e5 ff ff       	call   800a35 <memmove>
+  80252c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802532:	b8 05 00 00 00       	mov    $0x5,%eax
+  802537:	e8 ce fe ff ff       	call   80240a <nsipc>
+  80253c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80253f:	c9                   	leave
+  802540:	c3                   	ret
+
+00802541 <nsipc_listen>:
+  802541:	55                   	push   %ebp
+  802542:	89 e5                	mov    %esp,%ebp
+  802544:	83 ec 08             	sub    $0x8,%esp
+  802547:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80254f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802552:	a3 04 70 80 00       	mov    %eax,0x807004
+  802557:	b8 06 00 00 00       	mov    $0x6,%eax
+  80255c:	e8 a9 fe ff ff       	call   80240a <nsipc>
+  802561:	c9                   	leave
+  802562:	c3                   	ret
+
+00802563 <nsipc_recv>:
+  802563:	55                   	push   %ebp
+  802564:	89 e5                	mov    %esp,%ebp
+  802566:	56                   	push   %esi
+  802567:	53                   	push   %ebx
+  802568:	8b 75 10             	mov    0x10(%ebp),%esi
+  80256b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80256e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802573:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80257c:	a3 08 70 80 00       	mov    %eax,0x807008
+  802581:	b8 07 00 00 00       	mov    $0x7,%eax
+  802586:	e8 7f fe ff ff       	call   80240a <nsipc>
+  80258b:	89 c3                	mov    %eax,%ebx
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	78 22                	js     8025b3 <nsipc_recv+0x50>
+  802591:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802596:	39 c6                	cmp    %eax,%esi
+  802598:	0f 4e c6             	cmovle %esi,%eax
+  80259b:	39 c3                	cmp    %eax,%ebx
+  80259d:	7f 1d                	jg     8025bc <nsipc_recv+0x59>
+  80259f:	83 ec 04             	sub    $0x4,%esp
+  8025a2:	53                   	push   %ebx
+  8025a3:	68 00 70 80 00       	push   $0x807000
+  8025a8:	ff 75 0c             	push   0xc(%ebp)
+  8025ab:	e8 85 e4 ff ff       	call   800a35 <memmove>
+  8025b0:	83 c4 10             	add    $0x10,%esp
+  8025b3:	89 d8                	mov    %ebx,%eax
+  8025b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025b8:	5b                   	pop    %ebx
+  8025b9:	5e                   	pop    %esi
+  8025ba:	5d                   	pop    %ebp
+  8025bb:	c3                   	ret
+  8025bc:	68 cc 36 80 00       	push   $0x8036cc
+  8025c1:	68 e1 36 80 00       	push   $0x8036e1
+  8025c6:	6a 60                	push   $0x60
+  8025c8:	68 f6 36 80 00       	push   $0x8036f6
+  8025cd:	e8 83 07 00 00       	call   802d55 <_panic>
+
+008025d2 <nsipc_send>:
+  8025d2:	55                   	push   %ebp
+  8025d3:	89 e5                	mov    %esp,%ebp
+  8025d5:	53                   	push   %ebx
+  8025d6:	83 ec 04             	sub    $0x4,%esp
+  8025d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025df:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025e4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8025ea:	7f 2e                	jg     80261a <nsipc_send+0x48>
+  8025ec:	83 ec 04             	sub    $0x4,%esp
+  8025ef:	53                   	push   %ebx
+  8025f0:	ff 75 0c             	push   0xc(%ebp)
+  8025f3:	68 0c 70 80 00       	push   $0x80700c
+  8025f8:	e8 38 e4 ff ff       	call   800a35 <memmove>
+  8025fd:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802603:	8b 45 14             	mov    0x14(%ebp),%eax
+  802606:	a3 08 70 80 00       	mov    %eax,0x807008
+  80260b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802610:	e8 f5 fd ff ff       	call   80240a <nsipc>
+  802615:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802618:	c9                   	leave
+  802619:	c3                   	ret
+  80261a:	68 02 37 80 00       	push   $0x803702
+  80261f:	68 e1 36 80 00       	push   $0x8036e1
+  802624:	6a 6b                	push   $0x6b
+  802626:	68 f6 36 80 00       	push   $0x8036f6
+  80262b:	e8 25 07 00 00       	call   802d55 <_panic>
+
+00802630 <nsipc_socket>:
+  802630:	55                   	push   %ebp
+  802631:	89 e5                	mov    %esp,%ebp
+  802633:	83 ec 08             	sub    $0x8,%esp
+  802636:	8b 45 08             	mov    0x8(%ebp),%eax
+  802639:	a3 00 70 80 00       	mov    %eax,0x807000
+  80263e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802641:	a3 04 70 80 00       	mov    %eax,0x807004
+  802646:	8b 45 10             	mov    0x10(%ebp),%eax
+  802649:	a3 08 70 80 00       	mov    %eax,0x807008
+  80264e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802653:	e8 b2 fd ff ff       	call   80240a <nsipc>
+  802658:	c9                   	leave
+  802659:	c3                   	ret
+
+0080265a <devpipe_stat>:
+  80265a:	55                   	push   %ebp
+  80265b:	89 e5                	mov    %esp,%ebp
+  80265d:	56                   	push   %esi
+  80265e:	53                   	push   %ebx
+  80265f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802662:	83 ec 0c             	sub    $0xc,%esp
+  802665:	ff 75 08             	push   0x8(%ebp)
+  802668:	e8 99 ef ff ff       	call   801606 <fd2data>
+  80266d:	89 c6                	mov    %eax,%esi
+  80266f:	83 c4 08             	add    $0x8,%esp
+  802672:	68 0e 37 80 00       	push   $0x80370e
+  802677:	53                   	push   %ebx
+  802678:	e8 08 e2 ff ff       	call   800885 <strcpy>
+  80267d:	8b 46 04             	mov    0x4(%esi),%eax
+  802680:	2b 06                	sub    (%esi),%eax
+  802682:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802688:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80268f:	00 00 00 
+  802692:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802699:	40 80 00 
+  80269c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a4:	5b                   	pop    %ebx
+  8026a5:	5e                   	pop    %esi
+  8026a6:	5d                   	pop    %ebp
+  8026a7:	c3                   	ret
+
+008026a8 <devpipe_close>:
+  8026a8:	55                   	push   %ebp
+  8026a9:	89 e5                	mov    %esp,%ebp
+  8026ab:	53                   	push   %ebx
+  8026ac:	83 ec 0c             	sub    $0xc,%esp
+  8026af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026b2:	53                   	push   %ebx
+  8026b3:	6a 00                	push   $0x0
+  8026b5:	e8 fd e6 ff ff       	call   800db7 <sys_page_unmap>
+  8026ba:	89 1c 24             	mov    %ebx,(%esp)
+  8026bd:	e8 44 ef ff ff       	call   801606 <fd2data>
+  8026c2:	83 c4 08             	add    $0x8,%esp
+  8026c5:	50                   	push   %eax
+  8026c6:	6a 00                	push   $0x0
+  8026c8:	e8 ea e6 ff ff       	call   800db7 <sys_page_unmap>
+  8026cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+
+008026d2 <_pipeisclosed>:
+  8026d2:	55                   	push   %ebp
+  8026d3:	89 e5                	mov    %esp,%ebp
+  8026d5:	57                   	push   %edi
+  8026d6:	56                   	push   %esi
+  8026d7:	53                   	push   %ebx
+  8026d8:	83 ec 1c             	sub    $0x1c,%esp
+  8026db:	89 c7                	mov    %eax,%edi
+  8026dd:	89 d6                	mov    %edx,%esi
+  8026df:	a1 10 50 80 00       	mov    0x805010,%eax
+  8026e4:	8b 58 58             	mov    0x58(%eax),%ebx
+  8026e7:	83 ec 0c             	sub    $0xc,%esp
+  8026ea:	57                   	push   %edi
+  8026eb:	e8 18 09 00 00       	call   803008 <pageref>
+  8026f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026f3:	89 34 24             	mov    %esi,(%esp)
+  8026f6:	e8 0d 09 00 00       	call   803008 <pageref>
+  8026fb:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  802701:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802704:	83 c4 10             	add    $0x10,%esp
+  802707:	39 cb                	cmp    %ecx,%ebx
+  802709:	74 1b                	je     802726 <_pipeisclosed+0x54>
+  80270b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80270e:	75 cf                	jne    8026df <_pipeisclosed+0xd>
+  802710:	8b 42 58             	mov    0x58(%edx),%eax
+  802713:	6a 01                	push   $0x1
+  802715:	50                   	push   %eax
+  802716:	53                   	push   %ebx
+  802717:	68 15 37 80 00       	push   $0x803715
+  80271c:	e8 6d da ff ff       	call   80018e <cprintf>
+  802721:	83 c4 10             	add    $0x10,%esp
+  802724:	eb b9                	jmp    8026df <_pipeisclosed+0xd>
+  802726:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802729:	0f 94 c0             	sete   %al
+  80272c:	0f b6 c0             	movzbl %al,%eax
+  80272f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802732:	5b                   	pop    %ebx
+  802733:	5e                   	pop    %esi
+  802734:	5f                   	pop    %edi
+  802735:	5d                   	pop    %ebp
+  802736:	c3                   	ret
+
+00802737 <devpipe_write>:
+  802737:	55                   	push   %ebp
+  802738:	89 e5                	mov    %esp,%ebp
+  80273a:	57                   	push   %edi
+  80273b:	56                   	push   %esi
+  80273c:	53                   	push   %ebx
+  80273d:	83 ec 28             	sub    $0x28,%esp
+  802740:	8b 75 08             	mov    0x8(%ebp),%esi
+  802743:	56                   	push   %esi
+  802744:	e8 bd ee ff ff       	call   801606 <fd2data>
+  802749:	89 c3                	mov    %eax,%ebx
+  80274b:	83 c4 10             	add    $0x10,%esp
+  80274e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802753:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802757:	74 5c                	je     8027b5 <devpipe_write+0x7e>
+  802759:	8b 43 04             	mov    0x4(%ebx),%eax
+  80275c:	8b 0b                	mov    (%ebx),%ecx
+  80275e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802761:	39 d0                	cmp    %edx,%eax
+  802763:	72 1e                	jb     802783 <devpipe_write+0x4c>
+  802765:	89 da                	mov    %ebx,%edx
+  802767:	89 f0                	mov    %esi,%eax
+  802769:	e8 64 ff ff ff       	call   8026d2 <_pipeisclosed>
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	75 48                	jne    8027ba <devpipe_write+0x83>
+  802772:	e8 23 e5 ff ff       	call   800c9a <sys_yield>
+  802777:	8b 43 04             	mov    0x4(%ebx),%eax
+  80277a:	8b 0b                	mov    (%ebx),%ecx
+  80277c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80277f:	39 d0                	cmp    %edx,%eax
+  802781:	73 e2                	jae    802765 <devpipe_write+0x2e>
+  802783:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802786:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80278a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80278d:	89 c2                	mov    %eax,%edx
+  80278f:	c1 fa 1f             	sar    $0x1f,%edx
+  802792:	89 d1                	mov    %edx,%ecx
+  802794:	c1 e9 1b             	shr    $0x1b,%ecx
+  802797:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80279a:	83 e2 1f             	and    $0x1f,%edx
+  80279d:	29 ca                	sub    %ecx,%edx
+  80279f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8027a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8027a7:	83 c0 01             	add    $0x1,%eax
+  8027aa:	89 43 04             	mov    %eax,0x4(%ebx)
+  8027ad:	83 c7 01             	add    $0x1,%edi
+  8027b0:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8027b3:	75 a4                	jne    802759 <devpipe_write+0x22>
+  8027b5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027b8:	eb 05                	jmp    8027bf <devpipe_write+0x88>
+  8027ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c2:	5b                   	pop    %ebx
+  8027c3:	5e                   	pop    %esi
+  8027c4:	5f                   	pop    %edi
+  8027c5:	5d                   	pop    %ebp
+  8027c6:	c3                   	ret
+
+008027c7 <devpipe_read>:
+  8027c7:	55                   	push   %ebp
+  8027c8:	89 e5                	mov    %esp,%ebp
+  8027ca:	57                   	push   %edi
+  8027cb:	56                   	push   %esi
+  8027cc:	53                   	push   %ebx
+  8027cd:	83 ec 18             	sub    $0x18,%esp
+  8027d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027d3:	56                   	push   %esi
+  8027d4:	e8 2d ee ff ff       	call   801606 <fd2data>
+  8027d9:	89 c3                	mov    %eax,%ebx
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027e7:	74 45                	je     80282e <devpipe_read+0x67>
+  8027e9:	8b 03                	mov    (%ebx),%eax
+  8027eb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027ee:	75 1d                	jne    80280d <devpipe_read+0x46>
+  8027f0:	85 ff                	test   %edi,%edi
+  8027f2:	75 3f                	jne    802833 <devpipe_read+0x6c>
+  8027f4:	89 da                	mov    %ebx,%edx
+  8027f6:	89 f0                	mov    %esi,%eax
+  8027f8:	e8 d5 fe ff ff       	call   8026d2 <_pipeisclosed>
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	75 3c                	jne    80283d <devpipe_read+0x76>
+  802801:	e8 94 e4 ff ff       	call   800c9a <sys_yield>
+  802806:	8b 03                	mov    (%ebx),%eax
+  802808:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80280b:	74 e7                	je     8027f4 <devpipe_read+0x2d>
+  80280d:	99                   	cltd
+  80280e:	c1 ea 1b             	shr    $0x1b,%edx
+  802811:	01 d0                	add    %edx,%eax
+  802813:	83 e0 1f             	and    $0x1f,%eax
+  802816:	29 d0                	sub    %edx,%eax
+  802818:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80281d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802820:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802823:	83 03 01             	addl   $0x1,(%ebx)
+  802826:	83 c7 01             	add    $0x1,%edi
+  802829:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80282c:	75 bb                	jne    8027e9 <devpipe_read+0x22>
+  80282e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802831:	eb 02                	jmp    802835 <devpipe_read+0x6e>
+  802833:	89 f8                	mov    %edi,%eax
+  802835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802838:	5b                   	pop    %ebx
+  802839:	5e                   	pop    %esi
+  80283a:	5f                   	pop    %edi
+  80283b:	5d                   	pop    %ebp
+  80283c:	c3                   	ret
+  80283d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802842:	eb f1                	jmp    802835 <devpipe_read+0x6e>
+
+00802844 <pipe>:
+  802844:	55                   	push   %ebp
+  802845:	89 e5                	mov    %esp,%ebp
+  802847:	56                   	push   %esi
+  802848:	53                   	push   %ebx
+  802849:	83 ec 1c             	sub    $0x1c,%esp
+  80284c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80284f:	50                   	push   %eax
+  802850:	e8 c8 ed ff ff       	call   80161d <fd_alloc>
+  802855:	89 c3                	mov    %eax,%ebx
+  802857:	83 c4 10             	add    $0x10,%esp
+  80285a:	85 c0                	test   %eax,%eax
+  80285c:	0f 88 23 01 00 00    	js     802985 <pipe+0x141>
+  802862:	83 ec 04             	sub    $0x4,%esp
+  802865:	68 07 04 00 00       	push   $0x407
+  80286a:	ff 75 f4             	push   -0xc(%ebp)
+  80286d:	6a 00                	push   $0x0
+  80286f:	e8 71 e4 ff ff       	call   800ce5 <sys_page_alloc>
+  802874:	89 c3                	mov    %eax,%ebx
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	0f 88 04 01 00 00    	js     802985 <pipe+0x141>
+  802881:	83 ec 0c             	sub    $0xc,%esp
+  802884:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802887:	50                   	push   %eax
+  802888:	e8 90 ed ff ff       	call   80161d <fd_alloc>
+  80288d:	89 c3                	mov    %eax,%ebx
+  80288f:	83 c4 10             	add    $0x10,%esp
+  802892:	85 c0                	test   %eax,%eax
+  802894:	0f 88 db 00 00 00    	js     802975 <pipe+0x131>
+  80289a:	83 ec 04             	sub    $0x4,%esp
+  80289d:	68 07 04 00 00       	push   $0x407
+  8028a2:	ff 75 f0             	push   -0x10(%ebp)
+  8028a5:	6a 00                	push   $0x0
+  8028a7:	e8 39 e4 ff ff       	call   800ce5 <sys_page_alloc>
+  8028ac:	89 c3                	mov    %eax,%ebx
+  8028ae:	83 c4 10             	add    $0x10,%esp
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	0f 88 bc 00 00 00    	js     802975 <pipe+0x131>
+  8028b9:	83 ec 0c             	sub    $0xc,%esp
+  8028bc:	ff 75 f4             	push   -0xc(%ebp)
+  8028bf:	e8 42 ed ff ff       	call   801606 <fd2data>
+  8028c4:	89 c6                	mov    %eax,%esi
+  8028c6:	83 c4 0c             	add    $0xc,%esp
+  8028c9:	68 07 04 00 00       	push   $0x407
+  8028ce:	50                   	push   %eax
+  8028cf:	6a 00                	push   $0x0
+  8028d1:	e8 0f e4 ff ff       	call   800ce5 <sys_page_alloc>
+  8028d6:	89 c3                	mov    %eax,%ebx
+  8028d8:	83 c4 10             	add    $0x10,%esp
+  8028db:	85 c0                	test   %eax,%eax
+  8028dd:	0f 88 82 00 00 00    	js     802965 <pipe+0x121>
+  8028e3:	83 ec 0c             	sub    $0xc,%esp
+  8028e6:	ff 75 f0             	push   -0x10(%ebp)
+  8028e9:	e8 18 ed ff ff       	call   801606 <fd2data>
+  8028ee:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028f5:	50                   	push   %eax
+  8028f6:	6a 00                	push   $0x0
+  8028f8:	56                   	push   %esi
+  8028f9:	6a 00                	push   $0x0
+  8028fb:	e8 28 e4 ff ff       	call   800d28 <sys_page_map>
+  802900:	89 c3                	mov    %eax,%ebx
+  802902:	83 c4 20             	add    $0x20,%esp
+  802905:	85 c0                	test   %eax,%eax
+  802907:	78 4e                	js     802957 <pipe+0x113>
+  802909:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80290e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802911:	89 02                	mov    %eax,(%edx)
+  802913:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802916:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80291d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802920:	89 02                	mov    %eax,(%edx)
+  802922:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802925:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80292c:	83 ec 0c             	sub    $0xc,%esp
+  80292f:	ff 75 f4             	push   -0xc(%ebp)
+  802932:	e8 bf ec ff ff       	call   8015f6 <fd2num>
+  802937:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80293a:	89 01                	mov    %eax,(%ecx)
+  80293c:	83 c4 04             	add    $0x4,%esp
+  80293f:	ff 75 f0             	push   -0x10(%ebp)
+  802942:	e8 af ec ff ff       	call   8015f6 <fd2num>
+  802947:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80294a:	89 41 04             	mov    %eax,0x4(%ecx)
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802955:	eb 2e                	jmp    802985 <pipe+0x141>
+  802957:	83 ec 08             	sub    $0x8,%esp
+  80295a:	56                   	push   %esi
+  80295b:	6a 00                	push   $0x0
+  80295d:	e8 55 e4 ff ff       	call   800db7 <sys_page_unmap>
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	83 ec 08             	sub    $0x8,%esp
+  802968:	ff 75 f0             	push   -0x10(%ebp)
+  80296b:	6a 00                	push   $0x0
+  80296d:	e8 45 e4 ff ff       	call   800db7 <sys_page_unmap>
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	83 ec 08             	sub    $0x8,%esp
+  802978:	ff 75 f4             	push   -0xc(%ebp)
+  80297b:	6a 00                	push   $0x0
+  80297d:	e8 35 e4 ff ff       	call   800db7 <sys_page_unmap>
+  802982:	83 c4 10             	add    $0x10,%esp
+  802985:	89 d8                	mov    %ebx,%eax
+  802987:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80298a:	5b                   	pop    %ebx
+  80298b:	5e                   	pop    %esi
+  80298c:	5d                   	pop    %ebp
+  80298d:	c3                   	ret
+
+0080298e <pipeisclosed>:
+  80298e:	55                   	push   %ebp
+  80298f:	89 e5                	mov    %esp,%ebp
+  802991:	83 ec 20             	sub    $0x20,%esp
+  802994:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802997:	50                   	push   %eax
+  802998:	ff 75 08             	push   0x8(%ebp)
+  80299b:	e8 cd ec ff ff       	call   80166d <fd_lookup>
+  8029a0:	83 c4 10             	add    $0x10,%esp
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	78 18                	js     8029bf <pipeisclosed+0x31>
+  8029a7:	83 ec 0c             	sub    $0xc,%esp
+  8029aa:	ff 75 f4             	push   -0xc(%ebp)
+  8029ad:	e8 54 ec ff ff       	call   801606 <fd2data>
+  8029b2:	89 c2                	mov    %eax,%edx
+  8029b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029b7:	e8 16 fd ff ff       	call   8026d2 <_pipeisclosed>
+  8029bc:	83 c4 10             	add    $0x10,%esp
+  8029bf:	c9                   	leave
+  8029c0:	c3                   	ret
+
+008029c1 <ipcring_init>:
+  8029c1:	55                   	push   %ebp
+  8029c2:	89 e5                	mov    %esp,%ebp
+  8029c4:	53                   	push   %ebx
+  8029c5:	83 ec 08             	sub    $0x8,%esp
+  8029c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029cb:	6a 60                	push   $0x60
+  8029cd:	6a 00                	push   $0x0
+  8029cf:	53                   	push   %ebx
+  8029d0:	e8 2b e0 ff ff       	call   800a00 <memset>
+  8029d5:	a1 10 50 80 00       	mov    0x805010,%eax
+  8029da:	8b 40 48             	mov    0x48(%eax),%eax
+  8029dd:	89 03                	mov    %eax,(%ebx)
+  8029df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029e2:	89 43 04             	mov    %eax,0x4(%ebx)
+  8029e5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029e8:	89 43 08             	mov    %eax,0x8(%ebx)
+  8029eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ee:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8029f1:	83 c4 10             	add    $0x10,%esp
+  8029f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f7:	c9                   	leave
+  8029f8:	c3                   	ret
+
+008029f9 <ipcring_req_slot>:
+  8029f9:	55                   	push   %ebp
+  8029fa:	89 e5                	mov    %esp,%ebp
+  8029fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ff:	8b 50 10             	mov    0x10(%eax),%edx
+  802a02:	8b 48 18             	mov    0x18(%eax),%ecx
+  802a05:	29 ca                	sub    %ecx,%edx
+  802a07:	83 fa 07             	cmp    $0x7,%edx
+  802a0a:	77 0c                	ja     802a18 <ipcring_req_slot+0x1f>
+  802a0c:	8b 50 10             	mov    0x10(%eax),%edx
+  802a0f:	83 e2 07             	and    $0x7,%edx
+  802a12:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802a16:	5d                   	pop    %ebp
+  802a17:	c3                   	ret
+  802a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1d:	eb f7                	jmp    802a16 <ipcring_req_slot+0x1d>
+
+00802a1f <ipcring_req_push>:
+  802a1f:	55                   	push   %ebp
+  802a20:	89 e5                	mov    %esp,%ebp
+  802a22:	83 ec 08             	sub    $0x8,%esp
+  802a25:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a28:	8b 42 10             	mov    0x10(%edx),%eax
+  802a2b:	83 c0 01             	add    $0x1,%eax
+  802a2e:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a37:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802a3b:	85 c0                	test   %eax,%eax
+  802a3d:	75 02                	jne    802a41 <ipcring_req_push+0x22>
+  802a3f:	c9                   	leave
+  802a40:	c3                   	ret
+  802a41:	6a 00                	push   $0x0
+  802a43:	68 00 00 80 ee       	push   $0xee800000
+  802a48:	ff 72 08             	push   0x8(%edx)
+  802a4b:	ff 72 04             	push   0x4(%edx)
+  802a4e:	e8 ca e5 ff ff       	call   80101d <sys_ipc_send>
+  802a53:	83 c4 10             	add    $0x10,%esp
+  802a56:	eb e7                	jmp    802a3f <ipcring_req_push+0x20>
+
+00802a58 <ipcring_rsp_wait>:
+  802a58:	55                   	push   %ebp
+  802a59:	89 e5                	mov    %esp,%ebp
+  802a5b:	53                   	push   %ebx
+  802a5c:	83 ec 04             	sub    $0x4,%esp
+  802a5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a62:	8b 53 18             	mov    0x18(%ebx),%edx
+  802a65:	8b 43 10             	mov    0x10(%ebx),%eax
+  802a68:	39 c2                	cmp    %eax,%edx
+  802a6a:	74 3c                	je     802aa8 <ipcring_rsp_wait+0x50>
+  802a6c:	8b 53 14             	mov    0x14(%ebx),%edx
+  802a6f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a72:	39 c2                	cmp    %eax,%edx
+  802a74:	75 23                	jne    802a99 <ipcring_rsp_wait+0x41>
+  802a76:	83 ec 08             	sub    $0x8,%esp
+  802a79:	6a 00                	push   $0x0
+  802a7b:	6a 00                	push   $0x0
+  802a7d:	6a 00                	push   $0x0
+  802a7f:	6a 00                	push   $0x0
+  802a81:	ff 73 0c             	push   0xc(%ebx)
+  802a84:	ff 73 04             	push   0x4(%ebx)
+  802a87:	e8 c7 03 00 00       	call   802e53 <ipc_call>
+  802a8c:	8b 53 14             	mov    0x14(%ebx),%edx
+  802a8f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a92:	83 c4 20             	add    $0x20,%esp
+  802a95:	39 c2                	cmp    %eax,%edx
+  802a97:	74 dd                	je     802a76 <ipcring_rsp_wait+0x1e>
+  802a99:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a9c:	83 e0 07             	and    $0x7,%eax
+  802a9f:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802aa3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+  802aa8:	68 30 37 80 00       	push   $0x803730
+  802aad:	68 e1 36 80 00       	push   $0x8036e1
+  802ab2:	6a 3b                	push   $0x3b
+  802ab4:	68 51 37 80 00       	push   $0x803751
+  802ab9:	e8 97 02 00 00       	call   802d55 <_panic>
+
+00802abe <ipcring_rsp_pop>:
+  802abe:	55                   	push   %ebp
+  802abf:	89 e5                	mov    %esp,%ebp
+  802ac1:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ac4:	8b 42 18             	mov    0x18(%edx),%eax
+  802ac7:	83 c0 01             	add    $0x1,%eax
+  802aca:	89 42 18             	mov    %eax,0x18(%edx)
+  802acd:	5d                   	pop    %ebp
+  802ace:	c3                   	ret
+
+00802acf <ipcring_server_init>:
+  802acf:	55                   	push   %ebp
+  802ad0:	89 e5                	mov    %esp,%ebp
+  802ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ad8:	89 10                	mov    %edx,(%eax)
+  802ada:	8b 55 10             	mov    0x10(%ebp),%edx
+  802add:	89 50 04             	mov    %edx,0x4(%eax)
+  802ae0:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802ae7:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802aee:	5d                   	pop    %ebp
+  802aef:	c3                   	ret
+
+00802af0 <ipcring_req_avail>:
+  802af0:	55                   	push   %ebp
+  802af1:	89 e5                	mov    %esp,%ebp
+  802af3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802af6:	8b 02                	mov    (%edx),%eax
+  802af8:	8b 40 10             	mov    0x10(%eax),%eax
+  802afb:	2b 42 08             	sub    0x8(%edx),%eax
+  802afe:	ba 08 00 00 00       	mov    $0x8,%edx
+  802b03:	39 d0                	cmp    %edx,%eax
+  802b05:	0f 47 c2             	cmova  %edx,%eax
+  802b08:	5d                   	pop    %ebp
+  802b09:	c3                   	ret
+
+00802b0a <ipcring_req_peek>:
+  802b0a:	55                   	push   %ebp
+  802b0b:	89 e5                	mov    %esp,%ebp
+  802b0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b10:	8b 42 08             	mov    0x8(%edx),%eax
+  802b13:	83 e0 07             	and    $0x7,%eax
+  802b16:	8b 12                	mov    (%edx),%edx
+  802b18:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802b1c:	5d                   	pop    %ebp
+  802b1d:	c3                   	ret
+
+00802b1e <ipcring_rsp_push>:
+  802b1e:	55                   	push   %ebp
+  802b1f:	89 e5                	mov    %esp,%ebp
+  802b21:	83 ec 08             	sub    $0x8,%esp
+  802b24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b27:	8b 41 08             	mov    0x8(%ecx),%eax
+  802b2a:	83 c0 01             	add    $0x1,%eax
+  802b2d:	89 41 08             	mov    %eax,0x8(%ecx)
+  802b30:	8b 11                	mov    (%ecx),%edx
+  802b32:	83 c2 14             	add    $0x14,%edx
+  802b35:	f0 87 02             	lock xchg %eax,(%edx)
+  802b38:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802b3c:	75 02                	jne    802b40 <ipcring_rsp_push+0x22>
+  802b3e:	c9                   	leave
+  802b3f:	c3                   	ret
+  802b40:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802b47:	6a 00                	push   $0x0
+  802b49:	68 00 00 80 ee       	push   $0xee800000
+  802b4e:	6a 00                	push   $0x0
+  802b50:	ff 71 04             	push   0x4(%ecx)
+  802b53:	e8 e8 e3 ff ff       	call   800f40 <sys_ipc_try_send>
+  802b58:	83 c4 10             	add    $0x10,%esp
+  802b5b:	eb e1                	jmp    802b3e <ipcring_rsp_push+0x20>
+
+00802b5d <ipcring_client_wait>:
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	83 ec 08             	sub    $0x8,%esp
+  802b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b66:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802b6d:	8b 10                	mov    (%eax),%edx
+  802b6f:	8b 52 18             	mov    0x18(%edx),%edx
+  802b72:	3b 50 08             	cmp    0x8(%eax),%edx
+  802b75:	75 02                	jne    802b79 <ipcring_client_wait+0x1c>
+  802b77:	c9                   	leave
+  802b78:	c3                   	ret
+  802b79:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802b80:	6a 00                	push   $0x0
+  802b82:	68 00 00 80 ee       	push   $0xee800000
+  802b87:	6a 00                	push   $0x0
+  802b89:	ff 70 04             	push   0x4(%eax)
+  802b8c:	e8 af e3 ff ff       	call   800f40 <sys_ipc_try_send>
+  802b91:	83 c4 10             	add    $0x10,%esp
+  802b94:	eb e1                	jmp    802b77 <ipcring_client_wait+0x1a>
+
+00802b96 <ipcring_server_sleep>:
+  802b96:	55                   	push   %ebp
+  802b97:	89 e5                	mov    %esp,%ebp
+  802b99:	53                   	push   %ebx
+  802b9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b9d:	8b 01                	mov    (%ecx),%eax
+  802b9f:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802ba2:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ba7:	f0 87 02             	lock xchg %eax,(%edx)
+  802baa:	8b 11                	mov    (%ecx),%edx
+  802bac:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802baf:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bb4:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802bb7:	74 0e                	je     802bc7 <ipcring_server_sleep+0x31>
+  802bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbe:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bca:	c9                   	leave
+  802bcb:	c3                   	ret
+
+00802bcc <devcons_close>:
+  802bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd1:	c3                   	ret
+
+00802bd2 <devcons_stat>:
+  802bd2:	55                   	push   %ebp
+  802bd3:	89 e5                	mov    %esp,%ebp
+  802bd5:	83 ec 10             	sub    $0x10,%esp
+  802bd8:	68 5f 37 80 00       	push   $0x80375f
+  802bdd:	ff 75 0c             	push   0xc(%ebp)
+  802be0:	e8 a0 dc ff ff       	call   800885 <strcpy>
+  802be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bea:	c9                   	leave
+  802beb:	c3                   	ret
+
+00802bec <devcons_write>:
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	57                   	push   %edi
+  802bf0:	56                   	push   %esi
+  802bf1:	53                   	push   %ebx
+  802bf2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802bf8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802bfb:	85 ff                	test   %edi,%edi
+  802bfd:	74 51                	je     802c50 <devcons_write+0x64>
+  802bff:	be 00 00 00 00       	mov    $0x0,%esi
+  802c04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c09:	89 fb                	mov    %edi,%ebx
+  802c0b:	29 c3                	sub    %eax,%ebx
+  802c0d:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802c12:	39 d3                	cmp    %edx,%ebx
+  802c14:	0f 47 da             	cmova  %edx,%ebx
+  802c17:	83 ec 04             	sub    $0x4,%esp
+  802c1a:	53                   	push   %ebx
+  802c1b:	03 45 0c             	add    0xc(%ebp),%eax
+  802c1e:	50                   	push   %eax
+  802c1f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802c25:	50                   	push   %eax
+  802c26:	e8 0a de ff ff       	call   800a35 <memmove>
+  802c2b:	83 c4 08             	add    $0x8,%esp
+  802c2e:	53                   	push   %ebx
+  802c2f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802c35:	50                   	push   %eax
+  802c36:	e8 c2 df ff ff       	call   800bfd <sys_cputs>
+  802c3b:	01 de                	add    %ebx,%esi
+  802c3d:	89 f0                	mov    %esi,%eax
+  802c3f:	83 c4 10             	add    $0x10,%esp
+  802c42:	39 fe                	cmp    %edi,%esi
+  802c44:	72 c3                	jb     802c09 <devcons_write+0x1d>
+  802c46:	89 f0                	mov    %esi,%eax
+  802c48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c4b:	5b                   	pop    %ebx
+  802c4c:	5e                   	pop    %esi
+  802c4d:	5f                   	pop    %edi
+  802c4e:	5d                   	pop    %ebp
+  802c4f:	c3                   	ret
+  802c50:	be 00 00 00 00       	mov    $0x0,%esi
+  802c55:	eb ef                	jmp    802c46 <devcons_write+0x5a>
+
+00802c57 <devcons_read>:
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	83 ec 08             	sub    $0x8,%esp
+  802c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c62:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c66:	75 07                	jne    802c6f <devcons_read+0x18>
+  802c68:	eb 1f                	jmp    802c89 <devcons_read+0x32>
+  802c6a:	e8 2b e0 ff ff       	call   800c9a <sys_yield>
+  802c6f:	e8 a7 df ff ff       	call   800c1b <sys_cgetc>
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	74 f2                	je     802c6a <devcons_read+0x13>
+  802c78:	78 0f                	js     802c89 <devcons_read+0x32>
+  802c7a:	83 f8 04             	cmp    $0x4,%eax
+  802c7d:	74 0c                	je     802c8b <devcons_read+0x34>
+  802c7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c82:	88 02                	mov    %al,(%edx)
+  802c84:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c89:	c9                   	leave
+  802c8a:	c3                   	ret
+  802c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c90:	eb f7                	jmp    802c89 <devcons_read+0x32>
+
+00802c92 <cputchar>:
+  802c92:	55                   	push   %ebp
+  802c93:	89 e5                	mov    %esp,%ebp
+  802c95:	83 ec 20             	sub    $0x20,%esp
+  802c98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9b:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802c9e:	6a 01                	push   $0x1
+  802ca0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ca3:	50                   	push   %eax
+  802ca4:	e8 54 df ff ff       	call   800bfd <sys_cputs>
+  802ca9:	83 c4 10             	add    $0x10,%esp
+  802cac:	c9                   	leave
+  802cad:	c3                   	ret
+
+00802cae <getchar>:
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	83 ec 1c             	sub    $0x1c,%esp
+  802cb4:	6a 01                	push   $0x1
+  802cb6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cb9:	50                   	push   %eax
+  802cba:	6a 00                	push   $0x0
+  802cbc:	e8 0e ec ff ff       	call   8018cf <read>
+  802cc1:	83 c4 10             	add    $0x10,%esp
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	78 06                	js     802cce <getchar+0x20>
+  802cc8:	74 06                	je     802cd0 <getchar+0x22>
+  802cca:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802cce:	c9                   	leave
+  802ccf:	c3                   	ret
+  802cd0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cd5:	eb f7                	jmp    802cce <getchar+0x20>
+
+00802cd7 <iscons>:
+  802cd7:	55                   	push   %ebp
+  802cd8:	89 e5                	mov    %esp,%ebp
+  802cda:	83 ec 20             	sub    $0x20,%esp
+  802cdd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ce0:	50                   	push   %eax
+  802ce1:	ff 75 08             	push   0x8(%ebp)
+  802ce4:	e8 84 e9 ff ff       	call   80166d <fd_lookup>
+  802ce9:	83 c4 10             	add    $0x10,%esp
+  802cec:	85 c0                	test   %eax,%eax
+  802cee:	78 11                	js     802d01 <iscons+0x2a>
+  802cf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cf3:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802cf9:	39 10                	cmp    %edx,(%eax)
+  802cfb:	0f 94 c0             	sete   %al
+  802cfe:	0f b6 c0             	movzbl %al,%eax
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+
+00802d03 <opencons>:
+  802d03:	55                   	push   %ebp
+  802d04:	89 e5                	mov    %esp,%ebp
+  802d06:	83 ec 24             	sub    $0x24,%esp
+  802d09:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d0c:	50                   	push   %eax
+  802d0d:	e8 0b e9 ff ff       	call   80161d <fd_alloc>
+  802d12:	83 c4 10             	add    $0x10,%esp
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	78 3a                	js     802d53 <opencons+0x50>
+  802d19:	83 ec 04             	sub    $0x4,%esp
+  802d1c:	68 07 04 00 00       	push   $0x407
+  802d21:	ff 75 f4             	push   -0xc(%ebp)
+  802d24:	6a 00                	push   $0x0
+  802d26:	e8 ba df ff ff       	call   800ce5 <sys_page_alloc>
+  802d2b:	83 c4 10             	add    $0x10,%esp
+  802d2e:	85 c0                	test   %eax,%eax
+  802d30:	78 21                	js     802d53 <opencons+0x50>
+  802d32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d35:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802d3b:	89 10                	mov    %edx,(%eax)
+  802d3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d40:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802d47:	83 ec 0c             	sub    $0xc,%esp
+  802d4a:	50                   	push   %eax
+  802d4b:	e8 a6 e8 ff ff       	call   8015f6 <fd2num>
+  802d50:	83 c4 10             	add    $0x10,%esp
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+
+00802d55 <_panic>:
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	56                   	push   %esi
+  802d59:	53                   	push   %ebx
+  802d5a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802d5d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802d63:	e8 13 df ff ff       	call   800c7b <sys_getenvid>
+  802d68:	83 ec 0c             	sub    $0xc,%esp
+  802d6b:	ff 75 0c             	push   0xc(%ebp)
+  802d6e:	ff 75 08             	push   0x8(%ebp)
+  802d71:	56                   	push   %esi
+  802d72:	50                   	push   %eax
+  802d73:	68 6c 37 80 00       	push   $0x80376c
+  802d78:	e8 11 d4 ff ff       	call   80018e <cprintf>
+  802d7d:	83 c4 18             	add    $0x18,%esp
+  802d80:	53                   	push   %ebx
+  802d81:	ff 75 10             	push   0x10(%ebp)
+  802d84:	e8 b4 d3 ff ff       	call   80013d <vcprintf>
+  802d89:	c7 04 24 26 37 80 00 	movl   $0x803726,(%esp)
+  802d90:	e8 f9 d3 ff ff       	call   80018e <cprintf>
+  802d95:	83 c4 10             	add    $0x10,%esp
+  802d98:	cc                   	int3
+  802d99:	eb fd                	jmp    802d98 <_panic+0x43>
+
+00802d9b <ipc_recv>:
+  802d9b:	55                   	push   %ebp
+  802d9c:	89 e5                	mov    %esp,%ebp
+  802d9e:	56                   	push   %esi
+  802d9f:	53                   	push   %ebx
+  802da0:	8b 75 08             	mov    0x8(%ebp),%esi
+  802da3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802da9:	85 c0                	test   %eax,%eax
+  802dab:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802db0:	0f 44 c2             	cmove  %edx,%eax
+  802db3:	83 ec 0c             	sub    $0xc,%esp
+  802db6:	50                   	push   %eax
+  802db7:	e8 d4 e1 ff ff       	call   800f90 <sys_ipc_recv>
+  802dbc:	83 c4 10             	add    $0x10,%esp
+  802dbf:	85 c0                	test   %eax,%eax
+  802dc1:	78 2a                	js     802ded <ipc_recv+0x52>
+  802dc3:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dc8:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802dce:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802dd4:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802dda:	85 f6                	test   %esi,%esi
+  802ddc:	74 02                	je     802de0 <ipc_recv+0x45>
+  802dde:	89 0e                	mov    %ecx,(%esi)
+  802de0:	85 db                	test   %ebx,%ebx
+  802de2:	74 02                	je     802de6 <ipc_recv+0x4b>
+  802de4:	89 13                	mov    %edx,(%ebx)
+  802de6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802de9:	5b                   	pop    %ebx
+  802dea:	5e                   	pop    %esi
+  802deb:	5d                   	pop    %ebp
+  802dec:	c3                   	ret
+  802ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802df7:	eb e1                	jmp    802dda <ipc_recv+0x3f>
+
+00802df9 <ipc_send>:
+  802df9:	55                   	push   %ebp
+  802dfa:	89 e5                	mov    %esp,%ebp
+  802dfc:	57                   	push   %edi
+  802dfd:	56                   	push   %esi
+  802dfe:	53                   	push   %ebx
+  802dff:	83 ec 0c             	sub    $0xc,%esp
+  802e02:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802e05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e08:	8b 75 14             	mov    0x14(%ebp),%esi
+  802e0b:	85 db                	test   %ebx,%ebx
+  802e0d:	74 1e                	je     802e2d <ipc_send+0x34>
+  802e0f:	56                   	push   %esi
+  802e10:	53                   	push   %ebx
+  802e11:	57                   	push   %edi
+  802e12:	ff 75 08             	push   0x8(%ebp)
+  802e15:	e8 03 e2 ff ff       	call   80101d <sys_ipc_send>
+  802e1a:	83 c4 10             	add    $0x10,%esp
+  802e1d:	85 c0                	test   %eax,%eax
+  802e1f:	74 2a                	je     802e4b <ipc_send+0x52>
+  802e21:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e24:	75 13                	jne    802e39 <ipc_send+0x40>
+  802e26:	e8 6f de ff ff       	call   800c9a <sys_yield>
+  802e2b:	eb e2                	jmp    802e0f <ipc_send+0x16>
+  802e2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e32:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802e37:	eb d6                	jmp    802e0f <ipc_send+0x16>
+  802e39:	50                   	push   %eax
+  802e3a:	68 90 37 80 00       	push   $0x803790
+  802e3f:	6a 4f                	push   $0x4f
+  802e41:	68 d3 37 80 00       	push   $0x8037d3
+  802e46:	e8 0a ff ff ff       	call   802d55 <_panic>
+  802e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e4e:	5b                   	pop    %ebx
+  802e4f:	5e                   	pop    %esi
+  802e50:	5f                   	pop    %edi
+  802e51:	5d                   	pop    %ebp
+  802e52:	c3                   	ret
+
+00802e53 <ipc_call>:
+  802e53:	55                   	push   %ebp
+  802e54:	89 e5                	mov    %esp,%ebp
+  802e56:	57                   	push   %edi
+  802e57:	56                   	push   %esi
+  802e58:	53                   	push   %ebx
+  802e59:	83 ec 0c             	sub    $0xc,%esp
+  802e5c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e60:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802e65:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802e69:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e6d:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802e72:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802e76:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e7f:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802e83:	eb 05                	jmp    802e8a <ipc_call+0x37>
+  802e85:	e8 10 de ff ff       	call   800c9a <sys_yield>
+  802e8a:	83 ec 0c             	sub    $0xc,%esp
+  802e8d:	56                   	push   %esi
+  802e8e:	53                   	push   %ebx
+  802e8f:	57                   	push   %edi
+  802e90:	ff 75 0c             	push   0xc(%ebp)
+  802e93:	ff 75 08             	push   0x8(%ebp)
+  802e96:	e8 d2 e1 ff ff       	call   80106d <sys_ipc_call>
+  802e9b:	83 c4 20             	add    $0x20,%esp
+  802e9e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ea1:	74 e2                	je     802e85 <ipc_call+0x32>
+  802ea3:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802ea6:	74 2d                	je     802ed5 <ipc_call+0x82>
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	78 4f                	js     802efb <ipc_call+0xa8>
+  802eac:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802eb0:	74 10                	je     802ec2 <ipc_call+0x6f>
+  802eb2:	a1 10 50 80 00       	mov    0x805010,%eax
+  802eb7:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802ebd:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802ec0:	89 02                	mov    %eax,(%edx)
+  802ec2:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ec7:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ed0:	5b                   	pop    %ebx
+  802ed1:	5e                   	pop    %esi
+  802ed2:	5f                   	pop    %edi
+  802ed3:	5d                   	pop    %ebp
+  802ed4:	c3                   	ret
+  802ed5:	ff 75 14             	push   0x14(%ebp)
+  802ed8:	ff 75 10             	push   0x10(%ebp)
+  802edb:	ff 75 0c             	push   0xc(%ebp)
+  802ede:	ff 75 08             	push   0x8(%ebp)
+  802ee1:	e8 13 ff ff ff       	call   802df9 <ipc_send>
+  802ee6:	83 c4 0c             	add    $0xc,%esp
+  802ee9:	ff 75 1c             	push   0x1c(%ebp)
+  802eec:	ff 75 18             	push   0x18(%ebp)
+  802eef:	6a 00                	push   $0x0
+  802ef1:	e8 a5 fe ff ff       	call   802d9b <ipc_recv>
+  802ef6:	83 c4 10             	add    $0x10,%esp
+  802ef9:	eb d2                	jmp    802ecd <ipc_call+0x7a>
+  802efb:	50                   	push   %eax
+  802efc:	68 dd 37 80 00       	push   $0x8037dd
+  802f01:	6a 6d                	push   $0x6d
+  802f03:	68 d3 37 80 00       	push   $0x8037d3
+  802f08:	e8 48 fe ff ff       	call   802d55 <_panic>
+
+00802f0d <ipc_reply_recv>:
+  802f0d:	55                   	push   %ebp
+  802f0e:	89 e5                	mov    %esp,%ebp
+  802f10:	57                   	push   %edi
+  802f11:	56                   	push   %esi
+  802f12:	53                   	push   %ebx
+  802f13:	83 ec 0c             	sub    $0xc,%esp
+  802f16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f19:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802f1c:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802f1f:	85 db                	test   %ebx,%ebx
+  802f21:	0f 84 ac 00 00 00    	je     802fd3 <ipc_reply_recv+0xc6>
+  802f27:	85 f6                	test   %esi,%esi
+  802f29:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f2e:	0f 45 c6             	cmovne %esi,%eax
+  802f31:	83 ec 0c             	sub    $0xc,%esp
+  802f34:	50                   	push   %eax
+  802f35:	ff 75 14             	push   0x14(%ebp)
+  802f38:	53                   	push   %ebx
+  802f39:	ff 75 0c             	push   0xc(%ebp)
+  802f3c:	ff 75 08             	push   0x8(%ebp)
+  802f3f:	e8 4a e1 ff ff       	call   80108e <sys_ipc_reply_recv>
+  802f44:	83 c4 20             	add    $0x20,%esp
+  802f47:	85 c0                	test   %eax,%eax
+  802f49:	78 3a                	js     802f85 <ipc_reply_recv+0x78>
+  802f4b:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f4f:	74 10                	je     802f61 <ipc_reply_recv+0x54>
+  802f51:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f56:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802f5c:	8b 55 18             	mov    0x18(%ebp),%edx
+  802f5f:	89 02                	mov    %eax,(%edx)
+  802f61:	85 ff                	test   %edi,%edi
+  802f63:	74 0d                	je     802f72 <ipc_reply_recv+0x65>
+  802f65:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f6a:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f70:	89 07                	mov    %eax,(%edi)
+  802f72:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f77:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f80:	5b                   	pop    %ebx
+  802f81:	5e                   	pop    %esi
+  802f82:	5f                   	pop    %edi
+  802f83:	5d                   	pop    %ebp
+  802f84:	c3                   	ret
+  802f85:	ff 75 14             	push   0x14(%ebp)
+  802f88:	53                   	push   %ebx
+  802f89:	ff 75 0c             	push   0xc(%ebp)
+  802f8c:	ff 75 08             	push   0x8(%ebp)
+  802f8f:	e8 ac df ff ff       	call   800f40 <sys_ipc_try_send>
+  802f94:	89 c2                	mov    %eax,%edx
+  802f96:	c1 ea 1f             	shr    $0x1f,%edx
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802f9f:	0f 95 c1             	setne  %cl
+  802fa2:	84 d1                	test   %dl,%cl
+  802fa4:	74 05                	je     802fab <ipc_reply_recv+0x9e>
+  802fa6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802fa9:	75 12                	jne    802fbd <ipc_reply_recv+0xb0>
+  802fab:	83 ec 04             	sub    $0x4,%esp
+  802fae:	57                   	push   %edi
+  802faf:	56                   	push   %esi
+  802fb0:	ff 75 18             	push   0x18(%ebp)
+  802fb3:	e8 e3 fd ff ff       	call   802d9b <ipc_recv>
+  802fb8:	83 c4 10             	add    $0x10,%esp
+  802fbb:	eb c0                	jmp    802f7d <ipc_reply_recv+0x70>
+  802fbd:	83 ec 04             	sub    $0x4,%esp
+  802fc0:	50                   	push   %eax
+  802fc1:	ff 75 08             	push   0x8(%ebp)
+  802fc4:	68 b0 37 80 00       	push   $0x8037b0
+  802fc9:	e8 c0 d1 ff ff       	call   80018e <cprintf>
+  802fce:	83 c4 10             	add    $0x10,%esp
+  802fd1:	eb d8                	jmp    802fab <ipc_reply_recv+0x9e>
+  802fd3:	85 f6                	test   %esi,%esi
+  802fd5:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802fda:	0f 45 c6             	cmovne %esi,%eax
+  802fdd:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802fe2:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802fe9:	e9 43 ff ff ff       	jmp    802f31 <ipc_reply_recv+0x24>
+
+00802fee <ipc_find_env>:
+  802fee:	55                   	push   %ebp
+  802fef:	89 e5                	mov    %esp,%ebp
+  802ff1:	83 ec 14             	sub    $0x14,%esp
+  802ff4:	ff 75 08             	push   0x8(%ebp)
+  802ff7:	e8 e2 de ff ff       	call   800ede <sys_env_service>
+  802ffc:	85 c0                	test   %eax,%eax
+  802ffe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803003:	0f 48 c2             	cmovs  %edx,%eax
+  803006:	c9                   	leave
+  803007:	c3                   	ret
+
+00803008 <pageref>:
+  803008:	55                   	push   %ebp
+  803009:	89 e5                	mov    %esp,%ebp
+  80300b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80300e:	89 c2                	mov    %eax,%edx
+  803010:	c1 ea 16             	shr    $0x16,%edx
+  803013:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80301a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80301f:	f6 c1 01             	test   $0x1,%cl
+  803022:	74 22                	je     803046 <pageref+0x3e>
+  803024:	c1 e8 0c             	shr    $0xc,%eax
+  803027:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80302e:	a8 01                	test   $0x1,%al
+  803030:	74 14                	je     803046 <pageref+0x3e>
+  803032:	c1 e8 0c             	shr    $0xc,%eax
+  803035:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803038:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80303f:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803043:	0f b7 d2             	movzwl %dx,%edx
+  803046:	89 d0                	mov    %edx,%eax
+  803048:	5d                   	pop    %ebp
+  803049:	c3                   	ret
+
+0080304a <__udivmoddi4>:
+  80304a:	55                   	push   %ebp
+  80304b:	57                   	push   %edi
+  80304c:	56                   	push   %esi
+  80304d:	53                   	push   %ebx
+  80304e:	83 ec 24             	sub    $0x24,%esp
+  803051:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803055:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803059:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80305d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803061:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803065:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803069:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80306d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803071:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80307f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803084:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80308b:	00 
+  80308c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803093:	00 
+  803094:	89 fb                	mov    %edi,%ebx
+  803096:	eb 08                	jmp    8030a0 <__udivmoddi4+0x56>
+  803098:	83 e9 01             	sub    $0x1,%ecx
+  80309b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80309e:	74 68                	je     803108 <__udivmoddi4+0xbe>
+  8030a0:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8030a4:	01 c0                	add    %eax,%eax
+  8030a6:	89 c6                	mov    %eax,%esi
+  8030a8:	89 d7                	mov    %edx,%edi
+  8030aa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030ae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030b2:	0f ad d0             	shrd   %cl,%edx,%eax
+  8030b5:	d3 ea                	shr    %cl,%edx
+  8030b7:	f6 c1 20             	test   $0x20,%cl
+  8030ba:	74 04                	je     8030c0 <__udivmoddi4+0x76>
+  8030bc:	89 d0                	mov    %edx,%eax
+  8030be:	31 d2                	xor    %edx,%edx
+  8030c0:	83 e0 01             	and    $0x1,%eax
+  8030c3:	89 04 24             	mov    %eax,(%esp)
+  8030c6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8030cd:	00 
+  8030ce:	8b 04 24             	mov    (%esp),%eax
+  8030d1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8030d5:	09 f0                	or     %esi,%eax
+  8030d7:	09 fa                	or     %edi,%edx
+  8030d9:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8030dd:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8030e1:	39 f0                	cmp    %esi,%eax
+  8030e3:	89 d5                	mov    %edx,%ebp
+  8030e5:	19 fd                	sbb    %edi,%ebp
+  8030e7:	72 af                	jb     803098 <__udivmoddi4+0x4e>
+  8030e9:	29 f0                	sub    %esi,%eax
+  8030eb:	19 fa                	sbb    %edi,%edx
+  8030ed:	89 cf                	mov    %ecx,%edi
+  8030ef:	c1 ef 05             	shr    $0x5,%edi
+  8030f2:	83 e7 01             	and    $0x1,%edi
+  8030f5:	89 fe                	mov    %edi,%esi
+  8030f7:	83 f6 01             	xor    $0x1,%esi
+  8030fa:	d3 e6                	shl    %cl,%esi
+  8030fc:	d3 e7                	shl    %cl,%edi
+  8030fe:	09 74 24 18          	or     %esi,0x18(%esp)
+  803102:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803106:	eb 90                	jmp    803098 <__udivmoddi4+0x4e>
+  803108:	85 db                	test   %ebx,%ebx
+  80310a:	74 05                	je     803111 <__udivmoddi4+0xc7>
+  80310c:	89 03                	mov    %eax,(%ebx)
+  80310e:	89 53 04             	mov    %edx,0x4(%ebx)
+  803111:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803115:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803119:	83 c4 24             	add    $0x24,%esp
+  80311c:	5b                   	pop    %ebx
+  80311d:	5e                   	pop    %esi
+  80311e:	5f                   	pop    %edi
+  80311f:	5d                   	pop    %ebp
+  803120:	c3                   	ret
+
+00803121 <__udivdi3>:
+  803121:	83 ec 08             	sub    $0x8,%esp
+  803124:	6a 00                	push   $0x0
+  803126:	ff 74 24 1c          	push   0x1c(%esp)
+  80312a:	ff 74 24 1c          	push   0x1c(%esp)
+  80312e:	ff 74 24 1c          	push   0x1c(%esp)
+  803132:	ff 74 24 1c          	push   0x1c(%esp)
+  803136:	e8 0f ff ff ff       	call   80304a <__udivmoddi4>
+  80313b:	83 c4 1c             	add    $0x1c,%esp
+  80313e:	c3                   	ret
+
+0080313f <__umoddi3>:
+  80313f:	83 ec 18             	sub    $0x18,%esp
+  803142:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803146:	50                   	push   %eax
+  803147:	ff 74 24 2c          	push   0x2c(%esp)
+  80314b:	ff 74 24 2c          	push   0x2c(%esp)
+  80314f:	ff 74 24 2c          	push   0x2c(%esp)
+  803153:	ff 74 24 2c          	push   0x2c(%esp)
+  803157:	e8 ee fe ff ff       	call   80304a <__udivmoddi4>
+  80315c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803160:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803164:	83 c4 2c             	add    $0x2c,%esp
+  803167:	c3                   	ret
+
+00803168 <__divdi3>:
+  803168:	53                   	push   %ebx
+  803169:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80316d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803171:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803175:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803179:	85 d2                	test   %edx,%edx
+  80317b:	78 12                	js     80318f <__divdi3+0x27>
+  80317d:	85 db                	test   %ebx,%ebx
+  80317f:	78 2e                	js     8031af <__divdi3+0x47>
+  803181:	53                   	push   %ebx
+  803182:	51                   	push   %ecx
+  803183:	52                   	push   %edx
+  803184:	50                   	push   %eax
+  803185:	e8 97 ff ff ff       	call   803121 <__udivdi3>
+  80318a:	83 c4 10             	add    $0x10,%esp
+  80318d:	eb 1e                	jmp    8031ad <__divdi3+0x45>
+  80318f:	f7 d8                	neg    %eax
+  803191:	83 d2 00             	adc    $0x0,%edx
+  803194:	f7 da                	neg    %edx
+  803196:	85 db                	test   %ebx,%ebx
+  803198:	78 2a                	js     8031c4 <__divdi3+0x5c>
+  80319a:	53                   	push   %ebx
+  80319b:	51                   	push   %ecx
+  80319c:	52                   	push   %edx
+  80319d:	50                   	push   %eax
+  80319e:	e8 7e ff ff ff       	call   803121 <__udivdi3>
+  8031a3:	83 c4 10             	add    $0x10,%esp
+  8031a6:	f7 d8                	neg    %eax
+  8031a8:	83 d2 00             	adc    $0x0,%edx
+  8031ab:	f7 da                	neg    %edx
+  8031ad:	5b                   	pop    %ebx
+  8031ae:	c3                   	ret
+  8031af:	f7 d9                	neg    %ecx
+  8031b1:	83 d3 00             	adc    $0x0,%ebx
+  8031b4:	f7 db                	neg    %ebx
+  8031b6:	53                   	push   %ebx
+  8031b7:	51                   	push   %ecx
+  8031b8:	52                   	push   %edx
+  8031b9:	50                   	push   %eax
+  8031ba:	e8 62 ff ff ff       	call   803121 <__udivdi3>
+  8031bf:	83 c4 10             	add    $0x10,%esp
+  8031c2:	eb e2                	jmp    8031a6 <__divdi3+0x3e>
+  8031c4:	f7 d9                	neg    %ecx
+  8031c6:	83 d3 00             	adc    $0x0,%ebx
+  8031c9:	f7 db                	neg    %ebx
+  8031cb:	53                   	push   %ebx
+  8031cc:	51                   	push   %ecx
+  8031cd:	52                   	push   %edx
+  8031ce:	50                   	push   %eax
+  8031cf:	e8 4d ff ff ff       	call   803121 <__udivdi3>
+  8031d4:	83 c4 10             	add    $0x10,%esp
+  8031d7:	eb d4                	jmp    8031ad <__divdi3+0x45>
+
+008031d9 <__moddi3>:
+  8031d9:	55                   	push   %ebp
+  8031da:	57                   	push   %edi
+  8031db:	56                   	push   %esi
+  8031dc:	53                   	push   %ebx
+  8031dd:	83 ec 0c             	sub    $0xc,%esp
+  8031e0:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8031e4:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8031e8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031ec:	89 e9                	mov    %ebp,%ecx
+  8031ee:	f7 d9                	neg    %ecx
+  8031f0:	89 d0                	mov    %edx,%eax
+  8031f2:	83 d0 00             	adc    $0x0,%eax
+  8031f5:	f7 d8                	neg    %eax
+  8031f7:	0f 49 e9             	cmovns %ecx,%ebp
+  8031fa:	0f 49 d0             	cmovns %eax,%edx
+  8031fd:	52                   	push   %edx
+  8031fe:	55                   	push   %ebp
+  8031ff:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803203:	f7 da                	neg    %edx
+  803205:	89 d8                	mov    %ebx,%eax
+  803207:	83 d0 00             	adc    $0x0,%eax
+  80320a:	f7 d8                	neg    %eax
+  80320c:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803211:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803215:	0f 48 c3             	cmovs  %ebx,%eax
+  803218:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80321c:	ff 74 24 0c          	push   0xc(%esp)
+  803220:	ff 74 24 0c          	push   0xc(%esp)
+  803224:	e8 16 ff ff ff       	call   80313f <__umoddi3>
+  803229:	83 c4 10             	add    $0x10,%esp
+  80322c:	85 db                	test   %ebx,%ebx
+  80322e:	78 08                	js     803238 <__moddi3+0x5f>
+  803230:	83 c4 0c             	add    $0xc,%esp
+  803233:	5b                   	pop    %ebx
+  803234:	5e                   	pop    %esi
+  803235:	5f                   	pop    %edi
+  803236:	5d                   	pop    %ebp
+  803237:	c3                   	ret
+  803238:	f7 d8                	neg    %eax
+  80323a:	83 d2 00             	adc    $0x0,%edx
+  80323d:	f7 da                	neg    %edx
+  80323f:	eb ef                	jmp    803230 <__moddi3+0x57>
@@ -0,0 +1,5102 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	68 23 0a 80 00       	push   $0x800a23
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 89 03 00 00       	call   8003ce <sys_env_set_pgfault_upcall>
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80005f:	e8 e7 00 00 00       	call   80014b <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 10 50 80 00       	mov    %eax,0x805010
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 40 80 00       	mov    %eax,0x804000
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	a1 10 50 80 00       	mov    0x805010,%eax
+  8000a8:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 14                	jne    8000c6 <exit+0x29>
+  8000b2:	e8 61 0b 00 00       	call   800c18 <close_all>
+  8000b7:	83 ec 0c             	sub    $0xc,%esp
+  8000ba:	6a 00                	push   $0x0
+  8000bc:	e8 49 00 00 00       	call   80010a <sys_env_destroy>
+  8000c1:	83 c4 10             	add    $0x10,%esp
+  8000c4:	c9                   	leave
+  8000c5:	c3                   	ret
+  8000c6:	e8 ac 07 00 00       	call   800877 <sys_lease_complete>
+  8000cb:	eb e5                	jmp    8000b2 <exit+0x15>
+
+008000cd <sys_cputs>:
+  8000cd:	55                   	push   %ebp
+  8000ce:	89 e5                	mov    %esp,%ebp
+  8000d0:	57                   	push   %edi
+  8000d1:	56                   	push   %esi
+  8000d2:	53                   	push   %ebx
+  8000d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000de:	89 c3                	mov    %eax,%ebx
+  8000e0:	89 c7                	mov    %eax,%edi
+  8000e2:	89 c6                	mov    %eax,%esi
+  8000e4:	cd 30                	int    $0x30
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <sys_cgetc>:
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000fb:	89 d1                	mov    %edx,%ecx
+  8000fd:	89 d3                	mov    %edx,%ebx
+  8000ff:	89 d7                	mov    %edx,%edi
+  800101:	89 d6                	mov    %edx,%esi
+  800103:	cd 30                	int    $0x30
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5f                   	pop    %edi
+  800108:	5d                   	pop    %ebp
+  800109:	c3                   	ret
+
+0080010a <sys_env_destroy>:
+  80010a:	55                   	push   %ebp
+  80010b:	89 e5                	mov    %esp,%ebp
+  80010d:	57                   	push   %edi
+  80010e:	56                   	push   %esi
+  80010f:	53                   	push   %ebx
+  800110:	83 ec 0c             	sub    $0xc,%esp
+  800113:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800118:	8b 55 08             	mov    0x8(%ebp),%edx
+  80011b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800120:	89 cb                	mov    %ecx,%ebx
+  800122:	89 cf                	mov    %ecx,%edi
+  800124:	89 ce                	mov    %ecx,%esi
+  800126:	cd 30                	int    $0x30
+  800128:	85 c0                	test   %eax,%eax
+  80012a:	7f 08                	jg     800134 <sys_env_destroy+0x2a>
+  80012c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012f:	5b                   	pop    %ebx
+  800130:	5e                   	pop    %esi
+  800131:	5f                   	pop    %edi
+  800132:	5d                   	pop    %ebp
+  800133:	c3                   	ret
+  800134:	83 ec 0c             	sub    $0xc,%esp
+  800137:	50                   	push   %eax
+  800138:	6a 03                	push   $0x3
+  80013a:	68 2a 32 80 00       	push   $0x80322a
+  80013f:	6a 24                	push   $0x24
+  800141:	68 47 32 80 00       	push   $0x803247
+  800146:	e8 62 20 00 00       	call   8021ad <_panic>
+
+0080014b <sys_getenvid>:
+  80014b:	55                   	push   %ebp
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	57                   	push   %edi
+  80014f:	56                   	push   %esi
+  800150:	53                   	push   %ebx
+  800151:	ba 00 00 00 00       	mov    $0x0,%edx
+  800156:	b8 02 00 00 00       	mov    $0x2,%eax
+  80015b:	89 d1                	mov    %edx,%ecx
+  80015d:	89 d3                	mov    %edx,%ebx
+  80015f:	89 d7                	mov    %edx,%edi
+  800161:	89 d6                	mov    %edx,%esi
+  800163:	cd 30                	int    $0x30
+  800165:	5b                   	pop    %ebx
+  800166:	5e                   	pop    %esi
+  800167:	5f                   	pop    %edi
+  800168:	5d                   	pop    %ebp
+  800169:	c3                   	ret
+
+0080016a <sys_yield>:
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	57                   	push   %edi
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+  800170:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800177:	74 26                	je     80019f <sys_yield+0x35>
+  800179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800183:	89 d1                	mov    %edx,%ecx
+  800185:	89 d3                	mov    %edx,%ebx
+  800187:	89 d7                	mov    %edx,%edi
+  800189:	6a 00                	push   $0x0
+  80018b:	55                   	push   %ebp
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	8d 35 96 01 80 00    	lea    0x800196,%esi
+  800194:	0f 34                	sysenter
+  800196:	5d                   	pop    %ebp
+  800197:	83 c4 04             	add    $0x4,%esp
+  80019a:	5b                   	pop    %ebx
+  80019b:	5e                   	pop    %esi
+  80019c:	5f                   	pop    %edi
+  80019d:	5d                   	pop    %ebp
+  80019e:	c3                   	ret
+  80019f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8001a9:	89 d1                	mov    %edx,%ecx
+  8001ab:	89 d3                	mov    %edx,%ebx
+  8001ad:	89 d7                	mov    %edx,%edi
+  8001af:	89 d6                	mov    %edx,%esi
+  8001b1:	cd 30                	int    $0x30
+  8001b3:	eb e5                	jmp    80019a <sys_yield+0x30>
+
+008001b5 <sys_page_alloc>:
+  8001b5:	55                   	push   %ebp
+  8001b6:	89 e5                	mov    %esp,%ebp
+  8001b8:	57                   	push   %edi
+  8001b9:	56                   	push   %esi
+  8001ba:	53                   	push   %ebx
+  8001bb:	83 ec 0c             	sub    $0xc,%esp
+  8001be:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001d1:	89 f7                	mov    %esi,%edi
+  8001d3:	cd 30                	int    $0x30
+  8001d5:	85 c0                	test   %eax,%eax
+  8001d7:	7f 08                	jg     8001e1 <sys_page_alloc+0x2c>
+  8001d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001dc:	5b                   	pop    %ebx
+  8001dd:	5e                   	pop    %esi
+  8001de:	5f                   	pop    %edi
+  8001df:	5d                   	pop    %ebp
+  8001e0:	c3                   	ret
+  8001e1:	83 ec 0c             	sub    $0xc,%esp
+  8001e4:	50                   	push   %eax
+  8001e5:	6a 04                	push   $0x4
+  8001e7:	68 2a 32 80 00       	push   $0x80322a
+  8001ec:	6a 24                	push   $0x24
+  8001ee:	68 47 32 80 00       	push   $0x803247
+  8001f3:	e8 b5 1f 00 00       	call   8021ad <_panic>
+
+008001f8 <sys_page_map>:
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	57                   	push   %edi
+  8001fc:	56                   	push   %esi
+  8001fd:	53                   	push   %ebx
+  8001fe:	83 ec 0c             	sub    $0xc,%esp
+  800201:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800208:	74 33                	je     80023d <sys_page_map+0x45>
+  80020a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80020d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800210:	b8 05 00 00 00       	mov    $0x5,%eax
+  800215:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800218:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80021b:	ff 75 18             	push   0x18(%ebp)
+  80021e:	55                   	push   %ebp
+  80021f:	89 e5                	mov    %esp,%ebp
+  800221:	8d 35 29 02 80 00    	lea    0x800229,%esi
+  800227:	0f 34                	sysenter
+  800229:	5d                   	pop    %ebp
+  80022a:	83 c4 04             	add    $0x4,%esp
+  80022d:	89 c2                	mov    %eax,%edx
+  80022f:	85 c0                	test   %eax,%eax
+  800231:	7f 3d                	jg     800270 <sys_page_map+0x78>
+  800233:	89 d0                	mov    %edx,%eax
+  800235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800238:	5b                   	pop    %ebx
+  800239:	5e                   	pop    %esi
+  80023a:	5f                   	pop    %edi
+  80023b:	5d                   	pop    %ebp
+  80023c:	c3                   	ret
+  80023d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800242:	8b 55 08             	mov    0x8(%ebp),%edx
+  800245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800248:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80024b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80024e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800251:	cd 30                	int    $0x30
+  800253:	89 c2                	mov    %eax,%edx
+  800255:	85 c0                	test   %eax,%eax
+  800257:	7e da                	jle    800233 <sys_page_map+0x3b>
+  800259:	83 ec 0c             	sub    $0xc,%esp
+  80025c:	50                   	push   %eax
+  80025d:	6a 05                	push   $0x5
+  80025f:	68 2a 32 80 00       	push   $0x80322a
+  800264:	6a 24                	push   $0x24
+  800266:	68 47 32 80 00       	push   $0x803247
+  80026b:	e8 3d 1f 00 00       	call   8021ad <_panic>
+  800270:	83 ec 0c             	sub    $0xc,%esp
+  800273:	50                   	push   %eax
+  800274:	6a 05                	push   $0x5
+  800276:	68 2a 32 80 00       	push   $0x80322a
+  80027b:	6a 48                	push   $0x48
+  80027d:	68 47 32 80 00       	push   $0x803247
+  800282:	e8 26 1f 00 00       	call   8021ad <_panic>
+
+00800287 <sys_page_unmap>:
+  800287:	55                   	push   %ebp
+  800288:	89 e5                	mov    %esp,%ebp
+  80028a:	57                   	push   %edi
+  80028b:	56                   	push   %esi
+  80028c:	53                   	push   %ebx
+  80028d:	83 ec 0c             	sub    $0xc,%esp
+  800290:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800295:	8b 55 08             	mov    0x8(%ebp),%edx
+  800298:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80029b:	b8 06 00 00 00       	mov    $0x6,%eax
+  8002a0:	89 df                	mov    %ebx,%edi
+  8002a2:	89 de                	mov    %ebx,%esi
+  8002a4:	cd 30                	int    $0x30
+  8002a6:	85 c0                	test   %eax,%eax
+  8002a8:	7f 08                	jg     8002b2 <sys_page_unmap+0x2b>
+  8002aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ad:	5b                   	pop    %ebx
+  8002ae:	5e                   	pop    %esi
+  8002af:	5f                   	pop    %edi
+  8002b0:	5d                   	pop    %ebp
+  8002b1:	c3                   	ret
+  8002b2:	83 ec 0c             	sub    $0xc,%esp
+  8002b5:	50                   	push   %eax
+  8002b6:	6a 06                	push   $0x6
+  8002b8:	68 2a 32 80 00       	push   $0x80322a
+  8002bd:	6a 24                	push   $0x24
+  8002bf:	68 47 32 80 00       	push   $0x803247
+  8002c4:	e8 e4 1e 00 00       	call   8021ad <_panic>
+
+008002c9 <sys_fork>:
+  8002c9:	55                   	push   %ebp
+  8002ca:	89 e5                	mov    %esp,%ebp
+  8002cc:	57                   	push   %edi
+  8002cd:	56                   	push   %esi
+  8002ce:	53                   	push   %ebx
+  8002cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002d9:	89 d1                	mov    %edx,%ecx
+  8002db:	89 d3                	mov    %edx,%ebx
+  8002dd:	89 d7                	mov    %edx,%edi
+  8002df:	89 d6                	mov    %edx,%esi
+  8002e1:	cd 30                	int    $0x30
+  8002e3:	5b                   	pop    %ebx
+  8002e4:	5e                   	pop    %esi
+  8002e5:	5f                   	pop    %edi
+  8002e6:	5d                   	pop    %ebp
+  8002e7:	c3                   	ret
+
+008002e8 <sys_env_set_status>:
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	57                   	push   %edi
+  8002ec:	56                   	push   %esi
+  8002ed:	53                   	push   %ebx
+  8002ee:	83 ec 0c             	sub    $0xc,%esp
+  8002f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800301:	89 df                	mov    %ebx,%edi
+  800303:	89 de                	mov    %ebx,%esi
+  800305:	cd 30                	int    $0x30
+  800307:	85 c0                	test   %eax,%eax
+  800309:	7f 08                	jg     800313 <sys_env_set_status+0x2b>
+  80030b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030e:	5b                   	pop    %ebx
+  80030f:	5e                   	pop    %esi
+  800310:	5f                   	pop    %edi
+  800311:	5d                   	pop    %ebp
+  800312:	c3                   	ret
+  800313:	83 ec 0c             	sub    $0xc,%esp
+  800316:	50                   	push   %eax
+  800317:	6a 08                	push   $0x8
+  800319:	68 2a 32 80 00       	push   $0x80322a
+  80031e:	6a 24                	push   $0x24
+  800320:	68 47 32 80 00       	push   $0x803247
+  800325:	e8 83 1e 00 00       	call   8021ad <_panic>
+
+0080032a <sys_env_set_trapframe>:
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	57                   	push   %edi
+  80032e:	56                   	push   %esi
+  80032f:	53                   	push   %ebx
+  800330:	83 ec 0c             	sub    $0xc,%esp
+  800333:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80033b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800343:	89 df                	mov    %ebx,%edi
+  800345:	89 de                	mov    %ebx,%esi
+  800347:	cd 30                	int    $0x30
+  800349:	85 c0                	test   %eax,%eax
+  80034b:	7f 08                	jg     800355 <sys_env_set_trapframe+0x2b>
+  80034d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800350:	5b                   	pop    %ebx
+  800351:	5e                   	pop    %esi
+  800352:	5f                   	pop    %edi
+  800353:	5d                   	pop    %ebp
+  800354:	c3                   	ret
+  800355:	83 ec 0c             	sub    $0xc,%esp
+  800358:	50                   	push   %eax
+  800359:	6a 09                	push   $0x9
+  80035b:	68 2a 32 80 00       	push   $0x80322a
+  800360:	6a 24                	push   $0x24
+  800362:	68 47 32 80 00       	push   $0x803247
+  800367:	e8 41 1e 00 00       	call   8021ad <_panic>
+
+0080036c <sys_env_set_cow>:
+  80036c:	55                   	push   %ebp
+  80036d:	89 e5                	mov    %esp,%ebp
+  80036f:	57                   	push   %edi
+  800370:	56                   	push   %esi
+  800371:	53                   	push   %ebx
+  800372:	83 ec 0c             	sub    $0xc,%esp
+  800375:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80037a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800380:	b8 20 00 00 00       	mov    $0x20,%eax
+  800385:	89 df                	mov    %ebx,%edi
+  800387:	89 de                	mov    %ebx,%esi
+  800389:	cd 30                	int    $0x30
+  80038b:	85 c0                	test   %eax,%eax
+  80038d:	7f 08                	jg     800397 <sys_env_set_cow+0x2b>
+  80038f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800392:	5b                   	pop    %ebx
+  800393:	5e                   	pop    %esi
+  800394:	5f                   	pop    %edi
+  800395:	5d                   	pop    %ebp
+  800396:	c3                   	ret
+  800397:	83 ec 0c             	sub    $0xc,%esp
+  80039a:	50                   	push   %eax
+  80039b:	6a 20                	push   $0x20
+  80039d:	68 2a 32 80 00       	push   $0x80322a
+  8003a2:	6a 24                	push   $0x24
+  8003a4:	68 47 32 80 00       	push   $0x803247
+  8003a9:	e8 ff 1d 00 00       	call   8021ad <_panic>
+
+008003ae <sys_env_service>:
+  8003ae:	55                   	push   %ebp
+  8003af:	89 e5                	mov    %esp,%ebp
+  8003b1:	57                   	push   %edi
+  8003b2:	56                   	push   %esi
+  8003b3:	53                   	push   %ebx
+  8003b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003bc:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003c1:	89 cb                	mov    %ecx,%ebx
+  8003c3:	89 cf                	mov    %ecx,%edi
+  8003c5:	89 ce                	mov    %ecx,%esi
+  8003c7:	cd 30                	int    $0x30
+  8003c9:	5b                   	pop    %ebx
+  8003ca:	5e                   	pop    %esi
+  8003cb:	5f                   	pop    %edi
+  8003cc:	5d                   	pop    %ebp
+  8003cd:	c3                   	ret
+
+008003ce <sys_env_set_pgfault_upcall>:
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	57                   	push   %edi
+  8003d2:	56                   	push   %esi
+  8003d3:	53                   	push   %ebx
+  8003d4:	83 ec 0c             	sub    $0xc,%esp
+  8003d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003e7:	89 df                	mov    %ebx,%edi
+  8003e9:	89 de                	mov    %ebx,%esi
+  8003eb:	cd 30                	int    $0x30
+  8003ed:	85 c0                	test   %eax,%eax
+  8003ef:	7f 08                	jg     8003f9 <sys_env_set_pgfault_upcall+0x2b>
+  8003f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f4:	5b                   	pop    %ebx
+  8003f5:	5e                   	pop    %esi
+  8003f6:	5f                   	pop    %edi
+  8003f7:	5d                   	pop    %ebp
+  8003f8:	c3                   	ret
+  8003f9:	83 ec 0c             	sub    $0xc,%esp
+  8003fc:	50                   	push   %eax
+  8003fd:	6a 0a                	push   $0xa
+  8003ff:	68 2a 32 80 00       	push   $0x80322a
+  800404:	6a 24                	push   $0x24
+  800406:	68 47 32 80 00       	push   $0x803247
+  80040b:	e8 9d 1d 00 00       	call   8021ad <_panic>
+
+00800410 <sys_ipc_try_send>:
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	57                   	push   %edi
+  800414:	56                   	push   %esi
+  800415:	53                   	push   %ebx
+  800416:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80041d:	74 27                	je     800446 <sys_ipc_try_send+0x36>
+  80041f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800422:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800425:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80042a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80042d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800430:	6a 00                	push   $0x0
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	8d 35 3d 04 80 00    	lea    0x80043d,%esi
+  80043b:	0f 34                	sysenter
+  80043d:	5d                   	pop    %ebp
+  80043e:	83 c4 04             	add    $0x4,%esp
+  800441:	5b                   	pop    %ebx
+  800442:	5e                   	pop    %esi
+  800443:	5f                   	pop    %edi
+  800444:	5d                   	pop    %ebp
+  800445:	c3                   	ret
+  800446:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80044b:	be 00 00 00 00       	mov    $0x0,%esi
+  800450:	8b 55 08             	mov    0x8(%ebp),%edx
+  800453:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800456:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800459:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80045c:	cd 30                	int    $0x30
+  80045e:	eb e1                	jmp    800441 <sys_ipc_try_send+0x31>
+
+00800460 <sys_ipc_recv>:
+  800460:	55                   	push   %ebp
+  800461:	89 e5                	mov    %esp,%ebp
+  800463:	57                   	push   %edi
+  800464:	56                   	push   %esi
+  800465:	53                   	push   %ebx
+  800466:	83 ec 0c             	sub    $0xc,%esp
+  800469:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800470:	74 32                	je     8004a4 <sys_ipc_recv+0x44>
+  800472:	8b 55 08             	mov    0x8(%ebp),%edx
+  800475:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80047a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80047f:	89 cb                	mov    %ecx,%ebx
+  800481:	89 cf                	mov    %ecx,%edi
+  800483:	6a 00                	push   $0x0
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	8d 35 90 04 80 00    	lea    0x800490,%esi
+  80048e:	0f 34                	sysenter
+  800490:	5d                   	pop    %ebp
+  800491:	83 c4 04             	add    $0x4,%esp
+  800494:	89 c2                	mov    %eax,%edx
+  800496:	85 c0                	test   %eax,%eax
+  800498:	7f 3c                	jg     8004d6 <sys_ipc_recv+0x76>
+  80049a:	89 d0                	mov    %edx,%eax
+  80049c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049f:	5b                   	pop    %ebx
+  8004a0:	5e                   	pop    %esi
+  8004a1:	5f                   	pop    %edi
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+  8004a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b1:	89 cb                	mov    %ecx,%ebx
+  8004b3:	89 cf                	mov    %ecx,%edi
+  8004b5:	89 ce                	mov    %ecx,%esi
+  8004b7:	cd 30                	int    $0x30
+  8004b9:	89 c2                	mov    %eax,%edx
+  8004bb:	85 c0                	test   %eax,%eax
+  8004bd:	7e db                	jle    80049a <sys_ipc_recv+0x3a>
+  8004bf:	83 ec 0c             	sub    $0xc,%esp
+  8004c2:	50                   	push   %eax
+  8004c3:	6a 0d                	push   $0xd
+  8004c5:	68 2a 32 80 00       	push   $0x80322a
+  8004ca:	6a 24                	push   $0x24
+  8004cc:	68 47 32 80 00       	push   $0x803247
+  8004d1:	e8 d7 1c 00 00       	call   8021ad <_panic>
+  8004d6:	83 ec 0c             	sub    $0xc,%esp
+  8004d9:	50                   	push   %eax
+  8004da:	6a 0d                	push   $0xd
+  8004dc:	68 2a 32 80 00       	push   $0x80322a
+  8004e1:	6a 48                	push   $0x48
+  8004e3:	68 47 32 80 00       	push   $0x803247
+  8004e8:	e8 c0 1c 00 00       	call   8021ad <_panic>
+
+008004ed <sys_ipc_send>:
+  8004ed:	55                   	push   %ebp
+  8004ee:	89 e5                	mov    %esp,%ebp
+  8004f0:	57                   	push   %edi
+  8004f1:	56                   	push   %esi
+  8004f2:	53                   	push   %ebx
+  8004f3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004fa:	74 27                	je     800523 <sys_ipc_send+0x36>
+  8004fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800502:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800507:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80050a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80050d:	6a 00                	push   $0x0
+  80050f:	55                   	push   %ebp
+  800510:	89 e5                	mov    %esp,%ebp
+  800512:	8d 35 1a 05 80 00    	lea    0x80051a,%esi
+  800518:	0f 34                	sysenter
+  80051a:	5d                   	pop    %ebp
+  80051b:	83 c4 04             	add    $0x4,%esp
+  80051e:	5b                   	pop    %ebx
+  80051f:	5e                   	pop    %esi
+  800520:	5f                   	pop    %edi
+  800521:	5d                   	pop    %ebp
+  800522:	c3                   	ret
+  800523:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800528:	be 00 00 00 00       	mov    $0x0,%esi
+  80052d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800530:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800533:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800536:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800539:	cd 30                	int    $0x30
+  80053b:	eb e1                	jmp    80051e <sys_ipc_send+0x31>
+
+0080053d <sys_ipc_call>:
+  80053d:	55                   	push   %ebp
+  80053e:	89 e5                	mov    %esp,%ebp
+  800540:	57                   	push   %edi
+  800541:	56                   	push   %esi
+  800542:	53                   	push   %ebx
+  800543:	8b 55 08             	mov    0x8(%ebp),%edx
+  800546:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800549:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80054e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800551:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800554:	8b 75 18             	mov    0x18(%ebp),%esi
+  800557:	cd 30                	int    $0x30
+  800559:	5b                   	pop    %ebx
+  80055a:	5e                   	pop    %esi
+  80055b:	5f                   	pop    %edi
+  80055c:	5d                   	pop    %ebp
+  80055d:	c3                   	ret
+
+0080055e <sys_ipc_reply_recv>:
+  80055e:	55                   	push   %ebp
+  80055f:	89 e5                	mov    %esp,%ebp
+  800561:	57                   	push   %edi
+  800562:	56                   	push   %esi
+  800563:	53                   	push   %ebx
+  800564:	8b 55 08             	mov    0x8(%ebp),%edx
+  800567:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80056a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80056f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800572:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800575:	8b 75 18             	mov    0x18(%ebp),%esi
+  800578:	cd 30                	int    $0x30
+  80057a:	5b                   	pop    %ebx
+  80057b:	5e                   	pop    %esi
+  80057c:	5f                   	pop    %edi
+  80057d:	5d                   	pop    %ebp
+  80057e:	c3                   	ret
+
+0080057f <sys_time_msec>:
+  80057f:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  800584:	85 c0                	test   %eax,%eax
+  800586:	75 06                	jne    80058e <sys_time_msec+0xf>
+  800588:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80058d:	c3                   	ret
+  80058e:	55                   	push   %ebp
+  80058f:	89 e5                	mov    %esp,%ebp
+  800591:	57                   	push   %edi
+  800592:	56                   	push   %esi
+  800593:	53                   	push   %ebx
+  800594:	83 ec 0c             	sub    $0xc,%esp
+  800597:	0f 31                	rdtsc
+  800599:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80059f:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8005a5:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8005ab:	29 c8                	sub    %ecx,%eax
+  8005ad:	19 da                	sbb    %ebx,%edx
+  8005af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005b4:	57                   	push   %edi
+  8005b5:	56                   	push   %esi
+  8005b6:	52                   	push   %edx
+  8005b7:	50                   	push   %eax
+  8005b8:	e8 38 2b 00 00       	call   8030f5 <__udivdi3>
+  8005bd:	83 c4 10             	add    $0x10,%esp
+  8005c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005c3:	5b                   	pop    %ebx
+  8005c4:	5e                   	pop    %esi
+  8005c5:	5f                   	pop    %edi
+  8005c6:	5d                   	pop    %ebp
+  8005c7:	c3                   	ret
+
+008005c8 <sys_env_swap>:
+  8005c8:	55                   	push   %ebp
+  8005c9:	89 e5                	mov    %esp,%ebp
+  8005cb:	57                   	push   %edi
+  8005cc:	56                   	push   %esi
+  8005cd:	53                   	push   %ebx
+  8005ce:	83 ec 0c             	sub    $0xc,%esp
+  8005d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005d9:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005de:	89 cb                	mov    %ecx,%ebx
+  8005e0:	89 cf                	mov    %ecx,%edi
+  8005e2:	89 ce                	mov    %ecx,%esi
+  8005e4:	cd 30                	int    $0x30
+  8005e6:	85 c0                	test   %eax,%eax
+  8005e8:	7f 08                	jg     8005f2 <sys_env_swap+0x2a>
+  8005ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ed:	5b                   	pop    %ebx
+  8005ee:	5e                   	pop    %esi
+  8005ef:	5f                   	pop    %edi
+  8005f0:	5d                   	pop    %ebp
+  8005f1:	c3                   	ret
+  8005f2:	83 ec 0c             	sub    $0xc,%esp
+  8005f5:	50                   	push   %eax
+  8005f6:	6a 12                	push   $0x12
+  8005f8:	68 2a 32 80 00       	push   $0x80322a
+  8005fd:	6a 24                	push   $0x24
+  8005ff:	68 47 32 80 00       	push   $0x803247
+  800604:	e8 a4 1b 00 00       	call   8021ad <_panic>
+
+00800609 <sys_net_try_send>:
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+  80060c:	57                   	push   %edi
+  80060d:	56                   	push   %esi
+  80060e:	53                   	push   %ebx
+  80060f:	83 ec 0c             	sub    $0xc,%esp
+  800612:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800617:	8b 55 08             	mov    0x8(%ebp),%edx
+  80061a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80061d:	b8 13 00 00 00       	mov    $0x13,%eax
+  800622:	89 df                	mov    %ebx,%edi
+  800624:	89 de                	mov    %ebx,%esi
+  800626:	cd 30                	int    $0x30
+  800628:	85 c0                	test   %eax,%eax
+  80062a:	7f 08                	jg     800634 <sys_net_try_send+0x2b>
+  80062c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80062f:	5b                   	pop    %ebx
+  800630:	5e                   	pop    %esi
+  800631:	5f                   	pop    %edi
+  800632:	5d                   	pop    %ebp
+  800633:	c3                   	ret
+  800634:	83 ec 0c             	sub    $0xc,%esp
+  800637:	50                   	push   %eax
+  800638:	6a 13                	push   $0x13
+  80063a:	68 2a 32 80 00       	push   $0x80322a
+  80063f:	6a 24                	push   $0x24
+  800641:	68 47 32 80 00       	push   $0x803247
+  800646:	e8 62 1b 00 00       	call   8021ad <_panic>
+
+0080064b <sys_net_try_receive>:
+  80064b:	55                   	push   %ebp
+  80064c:	89 e5                	mov    %esp,%ebp
+  80064e:	57                   	push   %edi
+  80064f:	56                   	push   %esi
+  800650:	53                   	push   %ebx
+  800651:	83 ec 0c             	sub    $0xc,%esp
+  800654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800659:	8b 55 08             	mov    0x8(%ebp),%edx
+  80065c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80065f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800664:	89 df                	mov    %ebx,%edi
+  800666:	89 de                	mov    %ebx,%esi
+  800668:	cd 30                	int    $0x30
+  80066a:	85 c0                	test   %eax,%eax
+  80066c:	7f 08                	jg     800676 <sys_net_try_receive+0x2b>
+  80066e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800671:	5b                   	pop    %ebx
+  800672:	5e                   	pop    %esi
+  800673:	5f                   	pop    %edi
+  800674:	5d                   	pop    %ebp
+  800675:	c3                   	ret
+  800676:	83 ec 0c             	sub    $0xc,%esp
+  800679:	50                   	push   %eax
+  80067a:	6a 14                	push   $0x14
+  80067c:	68 2a 32 80 00       	push   $0x80322a
+  800681:	6a 24                	push   $0x24
+  800683:	68 47 32 80 00       	push   $0x803247
+  800688:	e8 20 1b 00 00       	call   8021ad <_panic>
+
+0080068d <sys_net_recv_page>:
+  80068d:	55                   	push   %ebp
+  80068e:	89 e5                	mov    %esp,%ebp
+  800690:	57                   	push   %edi
+  800691:	56                   	push   %esi
+  800692:	53                   	push   %ebx
+  800693:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800698:	8b 55 08             	mov    0x8(%ebp),%edx
+  80069b:	b8 27 00 00 00       	mov    $0x27,%eax
+  8006a0:	89 cb                	mov    %ecx,%ebx
+  8006a2:	89 cf                	mov    %ecx,%edi
+  8006a4:	89 ce                	mov    %ecx,%esi
+  8006a6:	cd 30                	int    $0x30
+  8006a8:	5b                   	pop    %ebx
+  8006a9:	5e                   	pop    %esi
+  8006aa:	5f                   	pop    %edi
+  8006ab:	5d                   	pop    %ebp
+  8006ac:	c3                   	ret
+
+008006ad <sys_net_wait>:
+  8006ad:	55                   	push   %ebp
+  8006ae:	89 e5                	mov    %esp,%ebp
+  8006b0:	57                   	push   %edi
+  8006b1:	56                   	push   %esi
+  8006b2:	53                   	push   %ebx
+  8006b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006b8:	b8 26 00 00 00       	mov    $0x26,%eax
+  8006bd:	89 d1                	mov    %edx,%ecx
+  8006bf:	89 d3                	mov    %edx,%ebx
+  8006c1:	89 d7                	mov    %edx,%edi
+  8006c3:	89 d6                	mov    %edx,%esi
+  8006c5:	cd 30                	int    $0x30
+  8006c7:	5b                   	pop    %ebx
+  8006c8:	5e                   	pop    %esi
+  8006c9:	5f                   	pop    %edi
+  8006ca:	5d                   	pop    %ebp
+  8006cb:	c3                   	ret
+
+008006cc <sys_get_mac>:
+  8006cc:	55                   	push   %ebp
+  8006cd:	89 e5                	mov    %esp,%ebp
+  8006cf:	57                   	push   %edi
+  8006d0:	56                   	push   %esi
+  8006d1:	53                   	push   %ebx
+  8006d2:	83 ec 0c             	sub    $0xc,%esp
+  8006d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006e0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006e5:	89 df                	mov    %ebx,%edi
+  8006e7:	89 de                	mov    %ebx,%esi
+  8006e9:	cd 30                	int    $0x30
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	7f 08                	jg     8006f7 <sys_get_mac+0x2b>
+  8006ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f2:	5b                   	pop    %ebx
+  8006f3:	5e                   	pop    %esi
+  8006f4:	5f                   	pop    %edi
+  8006f5:	5d                   	pop    %ebp
+  8006f6:	c3                   	ret
+  8006f7:	83 ec 0c             	sub    $0xc,%esp
+  8006fa:	50                   	push   %eax
+  8006fb:	6a 15                	push   $0x15
+  8006fd:	68 2a 32 80 00       	push   $0x80322a
+  800702:	6a 24                	push   $0x24
+  800704:	68 47 32 80 00       	push   $0x803247
+  800709:	e8 9f 1a 00 00       	call   8021ad <_panic>
+
+0080070e <sys_env_lease>:
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	57                   	push   %edi
+  800712:	56                   	push   %esi
+  800713:	53                   	push   %ebx
+  800714:	83 ec 0c             	sub    $0xc,%esp
+  800717:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80071c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80071f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800722:	b8 16 00 00 00       	mov    $0x16,%eax
+  800727:	89 df                	mov    %ebx,%edi
+  800729:	89 de                	mov    %ebx,%esi
+  80072b:	cd 30                	int    $0x30
+  80072d:	85 c0                	test   %eax,%eax
+  80072f:	7f 08                	jg     800739 <sys_env_lease+0x2b>
+  800731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800734:	5b                   	pop    %ebx
+  800735:	5e                   	pop    %esi
+  800736:	5f                   	pop    %edi
+  800737:	5d                   	pop    %ebp
+  800738:	c3                   	ret
+  800739:	83 ec 0c             	sub    $0xc,%esp
+  80073c:	50                   	push   %eax
+  80073d:	6a 16                	push   $0x16
+  80073f:	68 2a 32 80 00       	push   $0x80322a
+  800744:	6a 24                	push   $0x24
+  800746:	68 47 32 80 00       	push   $0x803247
+  80074b:	e8 5d 1a 00 00       	call   8021ad <_panic>
+
+00800750 <sys_copy_mem>:
+  800750:	55                   	push   %ebp
+  800751:	89 e5                	mov    %esp,%ebp
+  800753:	57                   	push   %edi
+  800754:	56                   	push   %esi
+  800755:	53                   	push   %ebx
+  800756:	83 ec 0c             	sub    $0xc,%esp
+  800759:	8b 55 08             	mov    0x8(%ebp),%edx
+  80075c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80075f:	b8 17 00 00 00       	mov    $0x17,%eax
+  800764:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800767:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80076a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80076d:	cd 30                	int    $0x30
+  80076f:	85 c0                	test   %eax,%eax
+  800771:	7f 08                	jg     80077b <sys_copy_mem+0x2b>
+  800773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800776:	5b                   	pop    %ebx
+  800777:	5e                   	pop    %esi
+  800778:	5f                   	pop    %edi
+  800779:	5d                   	pop    %ebp
+  80077a:	c3                   	ret
+  80077b:	83 ec 0c             	sub    $0xc,%esp
+  80077e:	50                   	push   %eax
+  80077f:	6a 17                	push   $0x17
+  800781:	68 2a 32 80 00       	push   $0x80322a
+  800786:	6a 24                	push   $0x24
+  800788:	68 47 32 80 00       	push   $0x803247
+  80078d:	e8 1b 1a 00 00       	call   8021ad <_panic>
+
+00800792 <sys_get_perms>:
+  800792:	55                   	push   %ebp
+  800793:	89 e5                	mov    %esp,%ebp
+  800795:	57                   	push   %edi
+  800796:	56                   	push   %esi
+  800797:	53                   	push   %ebx
+  800798:	83 ec 0c             	sub    $0xc,%esp
+  80079b:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007a6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8007ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007ae:	89 f7                	mov    %esi,%edi
+  8007b0:	cd 30                	int    $0x30
+  8007b2:	85 c0                	test   %eax,%eax
+  8007b4:	7f 08                	jg     8007be <sys_get_perms+0x2c>
+  8007b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007b9:	5b                   	pop    %ebx
+  8007ba:	5e                   	pop    %esi
+  8007bb:	5f                   	pop    %edi
+  8007bc:	5d                   	pop    %ebp
+  8007bd:	c3                   	ret
+  8007be:	83 ec 0c             	sub    $0xc,%esp
+  8007c1:	50                   	push   %eax
+  8007c2:	6a 18                	push   $0x18
+  8007c4:	68 2a 32 80 00       	push   $0x80322a
+  8007c9:	6a 24                	push   $0x24
+  8007cb:	68 47 32 80 00       	push   $0x803247
+  8007d0:	e8 d8 19 00 00       	call   8021ad <_panic>
+
+008007d5 <sys_env_unsuspend>:
+  8007d5:	55                   	push   %ebp
+  8007d6:	89 e5                	mov    %esp,%ebp
+  8007d8:	57                   	push   %edi
+  8007d9:	56                   	push   %esi
+  8007da:	53                   	push   %ebx
+  8007db:	83 ec 0c             	sub    $0xc,%esp
+  8007de:	be 00 00 00 00       	mov    $0x0,%esi
+  8007e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007f1:	89 f7                	mov    %esi,%edi
+  8007f3:	cd 30                	int    $0x30
+  8007f5:	85 c0                	test   %eax,%eax
+  8007f7:	7f 08                	jg     800801 <sys_env_unsuspend+0x2c>
+  8007f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007fc:	5b                   	pop    %ebx
+  8007fd:	5e                   	pop    %esi
+  8007fe:	5f                   	pop    %edi
+  8007ff:	5d                   	pop    %ebp
+  800800:	c3                   	ret
+  800801:	83 ec 0c             	sub    $0xc,%esp
+  800804:	50                   	push   %eax
+  800805:	6a 19                	push   $0x19
+  800807:	68 2a 32 80 00       	push   $0x80322a
+  80080c:	6a 24                	push   $0x24
+  80080e:	68 47 32 80 00       	push   $0x803247
+  800813:	e8 95 19 00 00       	call   8021ad <_panic>
+
+00800818 <sys_migrate>:
+  800818:	55                   	push   %ebp
+  800819:	89 e5                	mov    %esp,%ebp
+  80081b:	57                   	push   %edi
+  80081c:	56                   	push   %esi
+  80081d:	53                   	push   %ebx
+  80081e:	83 ec 0c             	sub    $0xc,%esp
+  800821:	ba 04 80 80 00       	mov    $0x808004,%edx
+  800826:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80082c:	76 11                	jbe    80083f <sys_migrate+0x27>
+  80082e:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800833:	0f b6 08             	movzbl (%eax),%ecx
+  800836:	05 00 10 00 00       	add    $0x1000,%eax
+  80083b:	39 d0                	cmp    %edx,%eax
+  80083d:	72 f4                	jb     800833 <sys_migrate+0x1b>
+  80083f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800844:	8b 55 08             	mov    0x8(%ebp),%edx
+  800847:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80084c:	89 cb                	mov    %ecx,%ebx
+  80084e:	89 cf                	mov    %ecx,%edi
+  800850:	89 ce                	mov    %ecx,%esi
+  800852:	cd 30                	int    $0x30
+  800854:	85 c0                	test   %eax,%eax
+  800856:	7f 08                	jg     800860 <sys_migrate+0x48>
+  800858:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085b:	5b                   	pop    %ebx
+  80085c:	5e                   	pop    %esi
+  80085d:	5f                   	pop    %edi
+  80085e:	5d                   	pop    %ebp
+  80085f:	c3                   	ret
+  800860:	83 ec 0c             	sub    $0xc,%esp
+  800863:	50                   	push   %eax
+  800864:	6a 1a                	push   $0x1a
+  800866:	68 2a 32 80 00       	push   $0x80322a
+  80086b:	6a 24                	push   $0x24
+  80086d:	68 47 32 80 00       	push   $0x803247
+  800872:	e8 36 19 00 00       	call   8021ad <_panic>
+
+00800877 <sys_lease_complete>:
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	57                   	push   %edi
+  80087b:	56                   	push   %esi
+  80087c:	53                   	push   %ebx
+  80087d:	83 ec 0c             	sub    $0xc,%esp
+  800880:	ba 00 00 00 00       	mov    $0x0,%edx
+  800885:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80088a:	89 d1                	mov    %edx,%ecx
+  80088c:	89 d3                	mov    %edx,%ebx
+  80088e:	89 d7                	mov    %edx,%edi
+  800890:	89 d6                	mov    %edx,%esi
+  800892:	cd 30                	int    $0x30
+  800894:	85 c0                	test   %eax,%eax
+  800896:	7f 08                	jg     8008a0 <sys_lease_complete+0x29>
+  800898:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80089b:	5b                   	pop    %ebx
+  80089c:	5e                   	pop    %esi
+  80089d:	5f                   	pop    %edi
+  80089e:	5d                   	pop    %ebp
+  80089f:	c3                   	ret
+  8008a0:	83 ec 0c             	sub    $0xc,%esp
+  8008a3:	50                   	push   %eax
+  8008a4:	6a 1b                	push   $0x1b
+  8008a6:	68 2a 32 80 00       	push   $0x80322a
+  8008ab:	6a 24                	push   $0x24
+  8008ad:	68 47 32 80 00       	push   $0x803247
+  8008b2:	e8 f6 18 00 00       	call   8021ad <_panic>
+
+008008b7 <sys_env_set_thisenv>:
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	57                   	push   %edi
+  8008bb:	56                   	push   %esi
+  8008bc:	53                   	push   %ebx
+  8008bd:	83 ec 0c             	sub    $0xc,%esp
+  8008c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008cb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008d0:	89 df                	mov    %ebx,%edi
+  8008d2:	89 de                	mov    %ebx,%esi
+  8008d4:	cd 30                	int    $0x30
+  8008d6:	85 c0                	test   %eax,%eax
+  8008d8:	7f 08                	jg     8008e2 <sys_env_set_thisenv+0x2b>
+  8008da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008dd:	5b                   	pop    %ebx
+  8008de:	5e                   	pop    %esi
+  8008df:	5f                   	pop    %edi
+  8008e0:	5d                   	pop    %ebp
+  8008e1:	c3                   	ret
+  8008e2:	83 ec 0c             	sub    $0xc,%esp
+  8008e5:	50                   	push   %eax
+  8008e6:	6a 1c                	push   $0x1c
+  8008e8:	68 2a 32 80 00       	push   $0x80322a
+  8008ed:	6a 24                	push   $0x24
+  8008ef:	68 47 32 80 00       	push   $0x803247
+  8008f4:	e8 b4 18 00 00       	call   8021ad <_panic>
+
+008008f9 <sys_env_set_sched>:
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	57                   	push   %edi
+  8008fd:	56                   	push   %esi
+  8008fe:	53                   	push   %ebx
+  8008ff:	83 ec 0c             	sub    $0xc,%esp
+  800902:	be 00 00 00 00       	mov    $0x0,%esi
+  800907:	8b 55 08             	mov    0x8(%ebp),%edx
+  80090a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800912:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800915:	89 f7                	mov    %esi,%edi
+  800917:	cd 30                	int    $0x30
+  800919:	85 c0                	test   %eax,%eax
+  80091b:	7f 08                	jg     800925 <sys_env_set_sched+0x2c>
+  80091d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800920:	5b                   	pop    %ebx
+  800921:	5e                   	pop    %esi
+  800922:	5f                   	pop    %edi
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+  800925:	83 ec 0c             	sub    $0xc,%esp
+  800928:	50                   	push   %eax
+  800929:	6a 1d                	push   $0x1d
+  80092b:	68 2a 32 80 00       	push   $0x80322a
+  800930:	6a 24                	push   $0x24
+  800932:	68 47 32 80 00       	push   $0x803247
+  800937:	e8 71 18 00 00       	call   8021ad <_panic>
+
+0080093c <sys_batch>:
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	57                   	push   %edi
+  800940:	56                   	push   %esi
+  800941:	53                   	push   %ebx
+  800942:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800947:	8b 55 08             	mov    0x8(%ebp),%edx
+  80094a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800952:	89 df                	mov    %ebx,%edi
+  800954:	89 de                	mov    %ebx,%esi
+  800956:	cd 30                	int    $0x30
+  800958:	5b                   	pop    %ebx
+  800959:	5e                   	pop    %esi
+  80095a:	5f                   	pop    %edi
+  80095b:	5d                   	pop    %ebp
+  80095c:	c3                   	ret
+
+0080095d <sys_env_stats>:
+  80095d:	55                   	push   %ebp
+  80095e:	89 e5                	mov    %esp,%ebp
+  800960:	57                   	push   %edi
+  800961:	56                   	push   %esi
+  800962:	53                   	push   %ebx
+  800963:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096e:	b8 23 00 00 00       	mov    $0x23,%eax
+  800973:	89 df                	mov    %ebx,%edi
+  800975:	89 de                	mov    %ebx,%esi
+  800977:	cd 30                	int    $0x30
+  800979:	5b                   	pop    %ebx
+  80097a:	5e                   	pop    %esi
+  80097b:	5f                   	pop    %edi
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+
+0080097e <sys_trace>:
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	57                   	push   %edi
+  800982:	56                   	push   %esi
+  800983:	53                   	push   %ebx
+  800984:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800989:	8b 55 08             	mov    0x8(%ebp),%edx
+  80098c:	b8 24 00 00 00       	mov    $0x24,%eax
+  800991:	89 cb                	mov    %ecx,%ebx
+  800993:	89 cf                	mov    %ecx,%edi
+  800995:	89 ce                	mov    %ecx,%esi
+  800997:	cd 30                	int    $0x30
+  800999:	5b                   	pop    %ebx
+  80099a:	5e                   	pop    %esi
+  80099b:	5f                   	pop    %edi
+  80099c:	5d                   	pop    %ebp
+  80099d:	c3                   	ret
+
+0080099e <sys_env_set_pager>:
+  80099e:	55                   	push   %ebp
+  80099f:	89 e5                	mov    %esp,%ebp
+  8009a1:	57                   	push   %edi
+  8009a2:	56                   	push   %esi
+  8009a3:	53                   	push   %ebx
+  8009a4:	83 ec 0c             	sub    $0xc,%esp
+  8009a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009b2:	b8 25 00 00 00       	mov    $0x25,%eax
+  8009b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009ba:	89 f7                	mov    %esi,%edi
+  8009bc:	cd 30                	int    $0x30
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	7f 08                	jg     8009ca <sys_env_set_pager+0x2c>
+  8009c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c5:	5b                   	pop    %ebx
+  8009c6:	5e                   	pop    %esi
+  8009c7:	5f                   	pop    %edi
+  8009c8:	5d                   	pop    %ebp
+  8009c9:	c3                   	ret
+  8009ca:	83 ec 0c             	sub    $0xc,%esp
+  8009cd:	50                   	push   %eax
+  8009ce:	6a 25                	push   $0x25
+  8009d0:	68 2a 32 80 00       	push   $0x80322a
+  8009d5:	6a 24                	push   $0x24
+  8009d7:	68 47 32 80 00       	push   $0x803247
+  8009dc:	e8 cc 17 00 00       	call   8021ad <_panic>
+
+008009e1 <sys_pager_retire>:
+  8009e1:	55                   	push   %ebp
+  8009e2:	89 e5                	mov    %esp,%ebp
+  8009e4:	57                   	push   %edi
+  8009e5:	56                   	push   %esi
+  8009e6:	53                   	push   %ebx
+  8009e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ef:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009f4:	89 cb                	mov    %ecx,%ebx
+  8009f6:	89 cf                	mov    %ecx,%edi
+  8009f8:	89 ce                	mov    %ecx,%esi
+  8009fa:	cd 30                	int    $0x30
+  8009fc:	5b                   	pop    %ebx
+  8009fd:	5e                   	pop    %esi
+  8009fe:	5f                   	pop    %edi
+  8009ff:	5d                   	pop    %ebp
+  800a00:	c3                   	ret
+
+00800a01 <sys_prof>:
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	57                   	push   %edi
+  800a05:	56                   	push   %esi
+  800a06:	53                   	push   %ebx
+  800a07:	be 00 00 00 00       	mov    $0x0,%esi
+  800a0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a12:	b8 22 00 00 00       	mov    $0x22,%eax
+  800a17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a1a:	89 f7                	mov    %esi,%edi
+  800a1c:	cd 30                	int    $0x30
+  800a1e:	5b                   	pop    %ebx
+  800a1f:	5e                   	pop    %esi
+  800a20:	5f                   	pop    %edi
+  800a21:	5d                   	pop    %ebp
+  800a22:	c3                   	ret
+
+00800a23 <_pgfault_upcall>:
+  800a23:	54                   	push   %esp
+  800a24:	a1 00 80 80 00       	mov    0x808000,%eax
+  800a29:	ff d0                	call   *%eax
+  800a2b:	83 c4 04             	add    $0x4,%esp
+  800a2e:	89 e3                	mov    %esp,%ebx
+  800a30:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  800a34:	8b 54 24 30          	mov    0x30(%esp),%edx
+  800a38:	89 d4                	mov    %edx,%esp
+  800a3a:	51                   	push   %ecx
+  800a3b:	89 dc                	mov    %ebx,%esp
+  800a3d:	83 ea 04             	sub    $0x4,%edx
+  800a40:	89 54 24 30          	mov    %edx,0x30(%esp)
+  800a44:	83 c4 08             	add    $0x8,%esp
+  800a47:	61                   	popa
+  800a48:	83 c4 04             	add    $0x4,%esp
+  800a4b:	9d                   	popf
+  800a4c:	5c                   	pop    %esp
+  800a4d:	c3                   	ret
+
+00800a4e <fd2num>:
+  800a4e:	55                   	push   %ebp
+  800a4f:	89 e5                	mov    %esp,%ebp
+  800a51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a54:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a59:	c1 e8 0c             	shr    $0xc,%eax
+  800a5c:	5d                   	pop    %ebp
+  800a5d:	c3                   	ret
+
+00800a5e <fd2data>:
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a64:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a69:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a6e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a73:	5d                   	pop    %ebp
+  800a74:	c3                   	ret
+
+00800a75 <fd_alloc>:
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a7d:	89 c2                	mov    %eax,%edx
+  800a7f:	c1 ea 16             	shr    $0x16,%edx
+  800a82:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a89:	f6 c2 01             	test   $0x1,%dl
+  800a8c:	74 29                	je     800ab7 <fd_alloc+0x42>
+  800a8e:	89 c2                	mov    %eax,%edx
+  800a90:	c1 ea 0c             	shr    $0xc,%edx
+  800a93:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a9a:	f6 c2 01             	test   $0x1,%dl
+  800a9d:	74 18                	je     800ab7 <fd_alloc+0x42>
+  800a9f:	05 00 10 00 00       	add    $0x1000,%eax
+  800aa4:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800aa9:	75 d2                	jne    800a7d <fd_alloc+0x8>
+  800aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800ab5:	eb 05                	jmp    800abc <fd_alloc+0x47>
+  800ab7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abf:	89 02                	mov    %eax,(%edx)
+  800ac1:	89 c8                	mov    %ecx,%eax
+  800ac3:	5d                   	pop    %ebp
+  800ac4:	c3                   	ret
+
+00800ac5 <fd_lookup>:
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acb:	83 f8 1f             	cmp    $0x1f,%eax
+  800ace:	77 30                	ja     800b00 <fd_lookup+0x3b>
+  800ad0:	c1 e0 0c             	shl    $0xc,%eax
+  800ad3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800ad8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ade:	f6 c2 01             	test   $0x1,%dl
+  800ae1:	74 24                	je     800b07 <fd_lookup+0x42>
+  800ae3:	89 c2                	mov    %eax,%edx
+  800ae5:	c1 ea 0c             	shr    $0xc,%edx
+  800ae8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800aef:	f6 c2 01             	test   $0x1,%dl
+  800af2:	74 1a                	je     800b0e <fd_lookup+0x49>
+  800af4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af7:	89 02                	mov    %eax,(%edx)
+  800af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afe:	5d                   	pop    %ebp
+  800aff:	c3                   	ret
+  800b00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b05:	eb f7                	jmp    800afe <fd_lookup+0x39>
+  800b07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b0c:	eb f0                	jmp    800afe <fd_lookup+0x39>
+  800b0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b13:	eb e9                	jmp    800afe <fd_lookup+0x39>
+
+00800b15 <dev_lookup>:
+  800b15:	55                   	push   %ebp
+  800b16:	89 e5                	mov    %esp,%ebp
+  800b18:	53                   	push   %ebx
+  800b19:	83 ec 04             	sub    $0x4,%esp
+  800b1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b24:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800b29:	39 13                	cmp    %edx,(%ebx)
+  800b2b:	74 37                	je     800b64 <dev_lookup+0x4f>
+  800b2d:	83 c0 01             	add    $0x1,%eax
+  800b30:	8b 1c 85 d4 32 80 00 	mov    0x8032d4(,%eax,4),%ebx
+  800b37:	85 db                	test   %ebx,%ebx
+  800b39:	75 ee                	jne    800b29 <dev_lookup+0x14>
+  800b3b:	a1 10 50 80 00       	mov    0x805010,%eax
+  800b40:	8b 40 48             	mov    0x48(%eax),%eax
+  800b43:	83 ec 04             	sub    $0x4,%esp
+  800b46:	52                   	push   %edx
+  800b47:	50                   	push   %eax
+  800b48:	68 58 32 80 00       	push   $0x803258
+  800b4d:	e8 36 17 00 00       	call   802288 <cprintf>
+  800b52:	83 c4 10             	add    $0x10,%esp
+  800b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5d:	89 1a                	mov    %ebx,(%edx)
+  800b5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b62:	c9                   	leave
+  800b63:	c3                   	ret
+  800b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b69:	eb ef                	jmp    800b5a <dev_lookup+0x45>
+
+00800b6b <fd_close>:
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	57                   	push   %edi
+  800b6f:	56                   	push   %esi
+  800b70:	53                   	push   %ebx
+  800b71:	83 ec 24             	sub    $0x24,%esp
+  800b74:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b77:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b7a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b7d:	50                   	push   %eax
+  800b7e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b84:	c1 e8 0c             	shr    $0xc,%eax
+  800b87:	50                   	push   %eax
+  800b88:	e8 38 ff ff ff       	call   800ac5 <fd_lookup>
+  800b8d:	89 c3                	mov    %eax,%ebx
+  800b8f:	83 c4 10             	add    $0x10,%esp
+  800b92:	85 c0                	test   %eax,%eax
+  800b94:	78 05                	js     800b9b <fd_close+0x30>
+  800b96:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b99:	74 0f                	je     800baa <fd_close+0x3f>
+  800b9b:	85 ff                	test   %edi,%edi
+  800b9d:	0f 44 df             	cmove  %edi,%ebx
+  800ba0:	89 d8                	mov    %ebx,%eax
+  800ba2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba5:	5b                   	pop    %ebx
+  800ba6:	5e                   	pop    %esi
+  800ba7:	5f                   	pop    %edi
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+  800baa:	83 ec 08             	sub    $0x8,%esp
+  800bad:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800bb0:	50                   	push   %eax
+  800bb1:	ff 36                	push   (%esi)
+  800bb3:	e8 5d ff ff ff       	call   800b15 <dev_lookup>
+  800bb8:	89 c3                	mov    %eax,%ebx
+  800bba:	83 c4 10             	add    $0x10,%esp
+  800bbd:	85 c0                	test   %eax,%eax
+  800bbf:	78 1a                	js     800bdb <fd_close+0x70>
+  800bc1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800bc4:	8b 40 10             	mov    0x10(%eax),%eax
+  800bc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bcc:	85 c0                	test   %eax,%eax
+  800bce:	74 0b                	je     800bdb <fd_close+0x70>
+  800bd0:	83 ec 0c             	sub    $0xc,%esp
+  800bd3:	56                   	push   %esi
+  800bd4:	ff d0                	call   *%eax
+  800bd6:	89 c3                	mov    %eax,%ebx
+  800bd8:	83 c4 10             	add    $0x10,%esp
+  800bdb:	83 ec 08             	sub    $0x8,%esp
+  800bde:	56                   	push   %esi
+  800bdf:	6a 00                	push   $0x0
+  800be1:	e8 a1 f6 ff ff       	call   800287 <sys_page_unmap>
+  800be6:	83 c4 10             	add    $0x10,%esp
+  800be9:	eb b5                	jmp    800ba0 <fd_close+0x35>
+
+00800beb <close>:
+  800beb:	55                   	push   %ebp
+  800bec:	89 e5                	mov    %esp,%ebp
+  800bee:	83 ec 20             	sub    $0x20,%esp
+  800bf1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bf4:	50                   	push   %eax
+  800bf5:	ff 75 08             	push   0x8(%ebp)
+  800bf8:	e8 c8 fe ff ff       	call   800ac5 <fd_lookup>
+  800bfd:	83 c4 10             	add    $0x10,%esp
+  800c00:	85 c0                	test   %eax,%eax
+  800c02:	79 02                	jns    800c06 <close+0x1b>
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+  800c06:	83 ec 08             	sub    $0x8,%esp
+  800c09:	6a 01                	push   $0x1
+  800c0b:	ff 75 f4             	push   -0xc(%ebp)
+  800c0e:	e8 58 ff ff ff       	call   800b6b <fd_close>
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	eb ec                	jmp    800c04 <close+0x19>
+
+00800c18 <close_all>:
+  800c18:	55                   	push   %ebp
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	53                   	push   %ebx
+  800c1c:	83 ec 04             	sub    $0x4,%esp
+  800c1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c24:	83 ec 0c             	sub    $0xc,%esp
+  800c27:	53                   	push   %ebx
+  800c28:	e8 be ff ff ff       	call   800beb <close>
+  800c2d:	83 c3 01             	add    $0x1,%ebx
+  800c30:	83 c4 10             	add    $0x10,%esp
+  800c33:	83 fb 20             	cmp    $0x20,%ebx
+  800c36:	75 ec                	jne    800c24 <close_all+0xc>
+  800c38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c3b:	c9                   	leave
+  800c3c:	c3                   	ret
+
+00800c3d <dup>:
+  800c3d:	55                   	push   %ebp
+  800c3e:	89 e5                	mov    %esp,%ebp
+  800c40:	57                   	push   %edi
+  800c41:	56                   	push   %esi
+  800c42:	53                   	push   %ebx
+  800c43:	83 ec 34             	sub    $0x34,%esp
+  800c46:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c49:	50                   	push   %eax
+  800c4a:	ff 75 08             	push   0x8(%ebp)
+  800c4d:	e8 73 fe ff ff       	call   800ac5 <fd_lookup>
+  800c52:	89 c3                	mov    %eax,%ebx
+  800c54:	83 c4 10             	add    $0x10,%esp
+  800c57:	85 c0                	test   %eax,%eax
+  800c59:	78 7f                	js     800cda <dup+0x9d>
+  800c5b:	83 ec 0c             	sub    $0xc,%esp
+  800c5e:	ff 75 0c             	push   0xc(%ebp)
+  800c61:	e8 85 ff ff ff       	call   800beb <close>
+  800c66:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c69:	c1 e6 0c             	shl    $0xc,%esi
+  800c6c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c72:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c75:	89 3c 24             	mov    %edi,(%esp)
+  800c78:	e8 e1 fd ff ff       	call   800a5e <fd2data>
+  800c7d:	89 c3                	mov    %eax,%ebx
+  800c7f:	89 34 24             	mov    %esi,(%esp)
+  800c82:	e8 d7 fd ff ff       	call   800a5e <fd2data>
+  800c87:	83 c4 10             	add    $0x10,%esp
+  800c8a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c8d:	89 d8                	mov    %ebx,%eax
+  800c8f:	c1 e8 16             	shr    $0x16,%eax
+  800c92:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c99:	a8 01                	test   $0x1,%al
+  800c9b:	74 11                	je     800cae <dup+0x71>
+  800c9d:	89 d8                	mov    %ebx,%eax
+  800c9f:	c1 e8 0c             	shr    $0xc,%eax
+  800ca2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800ca9:	f6 c2 01             	test   $0x1,%dl
+  800cac:	75 36                	jne    800ce4 <dup+0xa7>
+  800cae:	89 f8                	mov    %edi,%eax
+  800cb0:	c1 e8 0c             	shr    $0xc,%eax
+  800cb3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800cba:	83 ec 0c             	sub    $0xc,%esp
+  800cbd:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cc2:	50                   	push   %eax
+  800cc3:	56                   	push   %esi
+  800cc4:	6a 00                	push   $0x0
+  800cc6:	57                   	push   %edi
+  800cc7:	6a 00                	push   $0x0
+  800cc9:	e8 2a f5 ff ff       	call   8001f8 <sys_page_map>
+  800cce:	89 c3                	mov    %eax,%ebx
+  800cd0:	83 c4 20             	add    $0x20,%esp
+  800cd3:	85 c0                	test   %eax,%eax
+  800cd5:	78 33                	js     800d0a <dup+0xcd>
+  800cd7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cda:	89 d8                	mov    %ebx,%eax
+  800cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5e                   	pop    %esi
+  800ce1:	5f                   	pop    %edi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+  800ce4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ceb:	83 ec 0c             	sub    $0xc,%esp
+  800cee:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cf3:	50                   	push   %eax
+  800cf4:	ff 75 d4             	push   -0x2c(%ebp)
+  800cf7:	6a 00                	push   $0x0
+  800cf9:	53                   	push   %ebx
+  800cfa:	6a 00                	push   $0x0
+  800cfc:	e8 f7 f4 ff ff       	call   8001f8 <sys_page_map>
+  800d01:	89 c3                	mov    %eax,%ebx
+  800d03:	83 c4 20             	add    $0x20,%esp
+  800d06:	85 c0                	test   %eax,%eax
+  800d08:	79 a4                	jns    800cae <dup+0x71>
+  800d0a:	83 ec 08             	sub    $0x8,%esp
+  800d0d:	56                   	push   %esi
+  800d0e:	6a 00                	push   $0x0
+  800d10:	e8 72 f5 ff ff       	call   800287 <sys_page_unmap>
+  800d15:	83 c4 08             	add    $0x8,%esp
+  800d18:	ff 75 d4             	push   -0x2c(%ebp)
+  800d1b:	6a 00                	push   $0x0
+  800d1d:	e8 65 f5 ff ff       	call   800287 <sys_page_unmap>
+  800d22:	83 c4 10             	add    $0x10,%esp
+  800d25:	eb b3                	jmp    800cda <dup+0x9d>
+
+00800d27 <read>:
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 18             	sub    $0x18,%esp
+  800d2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d32:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d35:	50                   	push   %eax
+  800d36:	56                   	push   %esi
+  800d37:	e8 89 fd ff ff       	call   800ac5 <fd_lookup>
+  800d3c:	83 c4 10             	add    $0x10,%esp
+  800d3f:	85 c0                	test   %eax,%eax
+  800d41:	78 3c                	js     800d7f <read+0x58>
+  800d43:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d46:	83 ec 08             	sub    $0x8,%esp
+  800d49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d4c:	50                   	push   %eax
+  800d4d:	ff 33                	push   (%ebx)
+  800d4f:	e8 c1 fd ff ff       	call   800b15 <dev_lookup>
+  800d54:	83 c4 10             	add    $0x10,%esp
+  800d57:	85 c0                	test   %eax,%eax
+  800d59:	78 24                	js     800d7f <read+0x58>
+  800d5b:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d5e:	83 e0 03             	and    $0x3,%eax
+  800d61:	83 f8 01             	cmp    $0x1,%eax
+  800d64:	74 20                	je     800d86 <read+0x5f>
+  800d66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d69:	8b 40 08             	mov    0x8(%eax),%eax
+  800d6c:	85 c0                	test   %eax,%eax
+  800d6e:	74 37                	je     800da7 <read+0x80>
+  800d70:	83 ec 04             	sub    $0x4,%esp
+  800d73:	ff 75 10             	push   0x10(%ebp)
+  800d76:	ff 75 0c             	push   0xc(%ebp)
+  800d79:	53                   	push   %ebx
+  800d7a:	ff d0                	call   *%eax
+  800d7c:	83 c4 10             	add    $0x10,%esp
+  800d7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5d                   	pop    %ebp
+  800d85:	c3                   	ret
+  800d86:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d8b:	8b 40 48             	mov    0x48(%eax),%eax
+  800d8e:	83 ec 04             	sub    $0x4,%esp
+  800d91:	56                   	push   %esi
+  800d92:	50                   	push   %eax
+  800d93:	68 99 32 80 00       	push   $0x803299
+  800d98:	e8 eb 14 00 00       	call   802288 <cprintf>
+  800d9d:	83 c4 10             	add    $0x10,%esp
+  800da0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800da5:	eb d8                	jmp    800d7f <read+0x58>
+  800da7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800dac:	eb d1                	jmp    800d7f <read+0x58>
+
+00800dae <readn>:
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+  800db4:	83 ec 0c             	sub    $0xc,%esp
+  800db7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800dba:	8b 75 10             	mov    0x10(%ebp),%esi
+  800dbd:	85 f6                	test   %esi,%esi
+  800dbf:	74 30                	je     800df1 <readn+0x43>
+  800dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcb:	83 ec 04             	sub    $0x4,%esp
+  800dce:	89 f2                	mov    %esi,%edx
+  800dd0:	29 c2                	sub    %eax,%edx
+  800dd2:	52                   	push   %edx
+  800dd3:	01 f8                	add    %edi,%eax
+  800dd5:	50                   	push   %eax
+  800dd6:	ff 75 08             	push   0x8(%ebp)
+  800dd9:	e8 49 ff ff ff       	call   800d27 <read>
+  800dde:	83 c4 10             	add    $0x10,%esp
+  800de1:	85 c0                	test   %eax,%eax
+  800de3:	78 15                	js     800dfa <readn+0x4c>
+  800de5:	74 11                	je     800df8 <readn+0x4a>
+  800de7:	01 c3                	add    %eax,%ebx
+  800de9:	89 d8                	mov    %ebx,%eax
+  800deb:	39 f3                	cmp    %esi,%ebx
+  800ded:	72 dc                	jb     800dcb <readn+0x1d>
+  800def:	eb 09                	jmp    800dfa <readn+0x4c>
+  800df1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df6:	eb 02                	jmp    800dfa <readn+0x4c>
+  800df8:	89 d8                	mov    %ebx,%eax
+  800dfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dfd:	5b                   	pop    %ebx
+  800dfe:	5e                   	pop    %esi
+  800dff:	5f                   	pop    %edi
+  800e00:	5d                   	pop    %ebp
+  800e01:	c3                   	ret
+
+00800e02 <write>:
+  800e02:	55                   	push   %ebp
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  800e07:	83 ec 18             	sub    $0x18,%esp
+  800e0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e10:	50                   	push   %eax
+  800e11:	53                   	push   %ebx
+  800e12:	e8 ae fc ff ff       	call   800ac5 <fd_lookup>
+  800e17:	83 c4 10             	add    $0x10,%esp
+  800e1a:	85 c0                	test   %eax,%eax
+  800e1c:	78 37                	js     800e55 <write+0x53>
+  800e1e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e21:	83 ec 08             	sub    $0x8,%esp
+  800e24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e27:	50                   	push   %eax
+  800e28:	ff 36                	push   (%esi)
+  800e2a:	e8 e6 fc ff ff       	call   800b15 <dev_lookup>
+  800e2f:	83 c4 10             	add    $0x10,%esp
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	78 1f                	js     800e55 <write+0x53>
+  800e36:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e3a:	74 20                	je     800e5c <write+0x5a>
+  800e3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	74 37                	je     800e7d <write+0x7b>
+  800e46:	83 ec 04             	sub    $0x4,%esp
+  800e49:	ff 75 10             	push   0x10(%ebp)
+  800e4c:	ff 75 0c             	push   0xc(%ebp)
+  800e4f:	56                   	push   %esi
+  800e50:	ff d0                	call   *%eax
+  800e52:	83 c4 10             	add    $0x10,%esp
+  800e55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+  800e5c:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e61:	8b 40 48             	mov    0x48(%eax),%eax
+  800e64:	83 ec 04             	sub    $0x4,%esp
+  800e67:	53                   	push   %ebx
+  800e68:	50                   	push   %eax
+  800e69:	68 b5 32 80 00       	push   $0x8032b5
+  800e6e:	e8 15 14 00 00       	call   802288 <cprintf>
+  800e73:	83 c4 10             	add    $0x10,%esp
+  800e76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e7b:	eb d8                	jmp    800e55 <write+0x53>
+  800e7d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e82:	eb d1                	jmp    800e55 <write+0x53>
+
+00800e84 <seek>:
+  800e84:	55                   	push   %ebp
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	83 ec 20             	sub    $0x20,%esp
+  800e8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e8d:	50                   	push   %eax
+  800e8e:	ff 75 08             	push   0x8(%ebp)
+  800e91:	e8 2f fc ff ff       	call   800ac5 <fd_lookup>
+  800e96:	83 c4 10             	add    $0x10,%esp
+  800e99:	85 c0                	test   %eax,%eax
+  800e9b:	78 0e                	js     800eab <seek+0x27>
+  800e9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ea0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea3:	89 50 04             	mov    %edx,0x4(%eax)
+  800ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eab:	c9                   	leave
+  800eac:	c3                   	ret
+
+00800ead <ftruncate>:
+  800ead:	55                   	push   %ebp
+  800eae:	89 e5                	mov    %esp,%ebp
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	83 ec 18             	sub    $0x18,%esp
+  800eb5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800eb8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ebb:	50                   	push   %eax
+  800ebc:	53                   	push   %ebx
+  800ebd:	e8 03 fc ff ff       	call   800ac5 <fd_lookup>
+  800ec2:	83 c4 10             	add    $0x10,%esp
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	78 34                	js     800efd <ftruncate+0x50>
+  800ec9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ecc:	83 ec 08             	sub    $0x8,%esp
+  800ecf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ed2:	50                   	push   %eax
+  800ed3:	ff 36                	push   (%esi)
+  800ed5:	e8 3b fc ff ff       	call   800b15 <dev_lookup>
+  800eda:	83 c4 10             	add    $0x10,%esp
+  800edd:	85 c0                	test   %eax,%eax
+  800edf:	78 1c                	js     800efd <ftruncate+0x50>
+  800ee1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ee5:	74 1d                	je     800f04 <ftruncate+0x57>
+  800ee7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eea:	8b 40 18             	mov    0x18(%eax),%eax
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	74 34                	je     800f25 <ftruncate+0x78>
+  800ef1:	83 ec 08             	sub    $0x8,%esp
+  800ef4:	ff 75 0c             	push   0xc(%ebp)
+  800ef7:	56                   	push   %esi
+  800ef8:	ff d0                	call   *%eax
+  800efa:	83 c4 10             	add    $0x10,%esp
+  800efd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5d                   	pop    %ebp
+  800f03:	c3                   	ret
+  800f04:	a1 10 50 80 00       	mov    0x805010,%eax
+  800f09:	8b 40 48             	mov    0x48(%eax),%eax
+  800f0c:	83 ec 04             	sub    $0x4,%esp
+  800f0f:	53                   	push   %ebx
+  800f10:	50                   	push   %eax
+  800f11:	68 78 32 80 00       	push   $0x803278
+  800f16:	e8 6d 13 00 00       	call   802288 <cprintf>
+  800f1b:	83 c4 10             	add    $0x10,%esp
+  800f1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f23:	eb d8                	jmp    800efd <ftruncate+0x50>
+  800f25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f2a:	eb d1                	jmp    800efd <ftruncate+0x50>
+
+00800f2c <fstat>:
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 18             	sub    $0x18,%esp
+  800f34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f37:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f3a:	50                   	push   %eax
+  800f3b:	ff 75 08             	push   0x8(%ebp)
+  800f3e:	e8 82 fb ff ff       	call   800ac5 <fd_lookup>
+  800f43:	83 c4 10             	add    $0x10,%esp
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	78 49                	js     800f93 <fstat+0x67>
+  800f4a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f4d:	83 ec 08             	sub    $0x8,%esp
+  800f50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f53:	50                   	push   %eax
+  800f54:	ff 36                	push   (%esi)
+  800f56:	e8 ba fb ff ff       	call   800b15 <dev_lookup>
+  800f5b:	83 c4 10             	add    $0x10,%esp
+  800f5e:	85 c0                	test   %eax,%eax
+  800f60:	78 31                	js     800f93 <fstat+0x67>
+  800f62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f65:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f69:	74 2f                	je     800f9a <fstat+0x6e>
+  800f6b:	c6 03 00             	movb   $0x0,(%ebx)
+  800f6e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f75:	00 00 00 
+  800f78:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f7f:	00 00 00 
+  800f82:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f88:	83 ec 08             	sub    $0x8,%esp
+  800f8b:	53                   	push   %ebx
+  800f8c:	56                   	push   %esi
+  800f8d:	ff 50 14             	call   *0x14(%eax)
+  800f90:	83 c4 10             	add    $0x10,%esp
+  800f93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+  800f9a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f9f:	eb f2                	jmp    800f93 <fstat+0x67>
+
+00800fa1 <stat>:
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  800fa6:	83 ec 08             	sub    $0x8,%esp
+  800fa9:	6a 00                	push   $0x0
+  800fab:	ff 75 08             	push   0x8(%ebp)
+  800fae:	e8 31 05 00 00       	call   8014e4 <open>
+  800fb3:	89 c3                	mov    %eax,%ebx
+  800fb5:	83 c4 10             	add    $0x10,%esp
+  800fb8:	85 c0                	test   %eax,%eax
+  800fba:	78 1b                	js     800fd7 <stat+0x36>
+  800fbc:	83 ec 08             	sub    $0x8,%esp
+  800fbf:	ff 75 0c             	push   0xc(%ebp)
+  800fc2:	50                   	push   %eax
+  800fc3:	e8 64 ff ff ff       	call   800f2c <fstat>
+  800fc8:	89 c6                	mov    %eax,%esi
+  800fca:	89 1c 24             	mov    %ebx,(%esp)
+  800fcd:	e8 19 fc ff ff       	call   800beb <close>
+  800fd2:	83 c4 10             	add    $0x10,%esp
+  800fd5:	89 f3                	mov    %esi,%ebx
+  800fd7:	89 d8                	mov    %ebx,%eax
+  800fd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5e                   	pop    %esi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+
+00800fe0 <fsipc>:
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+  800fe5:	89 c3                	mov    %eax,%ebx
+  800fe7:	89 d6                	mov    %edx,%esi
+  800fe9:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800ff0:	74 20                	je     801012 <fsipc+0x32>
+  800ff2:	83 ec 08             	sub    $0x8,%esp
+  800ff5:	6a 00                	push   $0x0
+  800ff7:	56                   	push   %esi
+  800ff8:	6a 07                	push   $0x7
+  800ffa:	68 00 60 80 00       	push   $0x806000
+  800fff:	53                   	push   %ebx
+  801000:	ff 35 08 50 80 00    	push   0x805008
+  801006:	e8 1c 1e 00 00       	call   802e27 <ipc_call>
+  80100b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+  801012:	83 ec 0c             	sub    $0xc,%esp
+  801015:	6a 02                	push   $0x2
+  801017:	e8 a6 1f 00 00       	call   802fc2 <ipc_find_env>
+  80101c:	a3 08 50 80 00       	mov    %eax,0x805008
+  801021:	83 c4 10             	add    $0x10,%esp
+  801024:	eb cc                	jmp    800ff2 <fsipc+0x12>
+
+00801026 <devfile_trunc>:
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	83 ec 08             	sub    $0x8,%esp
+  80102c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801032:	a3 00 60 80 00       	mov    %eax,0x806000
+  801037:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80103a:	a3 04 60 80 00       	mov    %eax,0x806004
+  80103f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801044:	b8 02 00 00 00       	mov    $0x2,%eax
+  801049:	e8 92 ff ff ff       	call   800fe0 <fsipc>
+  80104e:	c9                   	leave
+  80104f:	c3                   	ret
+
+00801050 <devfile_flush>:
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  801053:	83 ec 08             	sub    $0x8,%esp
+  801056:	8b 45 08             	mov    0x8(%ebp),%eax
+  801059:	8b 40 0c             	mov    0xc(%eax),%eax
+  80105c:	a3 00 60 80 00       	mov    %eax,0x806000
+  801061:	ba 00 00 00 00       	mov    $0x0,%edx
+  801066:	b8 08 00 00 00       	mov    $0x8,%eax
+  80106b:	e8 70 ff ff ff       	call   800fe0 <fsipc>
+  801070:	c9                   	leave
+  801071:	c3                   	ret
+
+00801072 <devfile_stat>:
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	53                   	push   %ebx
+  801076:	83 ec 04             	sub    $0x4,%esp
+  801079:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80107c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80107f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801082:	a3 00 60 80 00       	mov    %eax,0x806000
+  801087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801091:	e8 4a ff ff ff       	call   800fe0 <fsipc>
+  801096:	85 c0                	test   %eax,%eax
+  801098:	78 2c                	js     8010c6 <devfile_stat+0x54>
+  80109a:	83 ec 08             	sub    $0x8,%esp
+  80109d:	68 00 60 80 00       	push   $0x806000
+  8010a2:	53                   	push   %ebx
+  8010a3:	e8 d7 18 00 00       	call   80297f <strcpy>
+  8010a8:	a1 80 60 80 00       	mov    0x806080,%eax
+  8010ad:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8010b3:	a1 84 60 80 00       	mov    0x806084,%eax
+  8010b8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8010be:	83 c4 10             	add    $0x10,%esp
+  8010c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010c9:	c9                   	leave
+  8010ca:	c3                   	ret
+
+008010cb <fsring_rw>:
+  8010cb:	55                   	push   %ebp
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	57                   	push   %edi
+  8010cf:	56                   	push   %esi
+  8010d0:	53                   	push   %ebx
+  8010d1:	83 ec 2c             	sub    $0x2c,%esp
+  8010d4:	89 c7                	mov    %eax,%edi
+  8010d6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8010d9:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8010dc:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8010e1:	a8 01                	test   $0x1,%al
+  8010e3:	74 0d                	je     8010f2 <fsring_rw+0x27>
+  8010e5:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010ea:	a8 01                	test   $0x1,%al
+  8010ec:	0f 85 d5 00 00 00    	jne    8011c7 <fsring_rw+0xfc>
+  8010f2:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010f7:	8b 40 48             	mov    0x48(%eax),%eax
+  8010fa:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801100:	0f 84 fc 00 00 00    	je     801202 <fsring_rw+0x137>
+  801106:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80110d:	0f 84 02 01 00 00    	je     801215 <fsring_rw+0x14a>
+  801113:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801118:	83 ec 04             	sub    $0x4,%esp
+  80111b:	68 07 02 00 00       	push   $0x207
+  801120:	53                   	push   %ebx
+  801121:	6a 00                	push   $0x0
+  801123:	e8 8d f0 ff ff       	call   8001b5 <sys_page_alloc>
+  801128:	83 c4 10             	add    $0x10,%esp
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	0f 88 f9 00 00 00    	js     80122c <fsring_rw+0x161>
+  801133:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801139:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80113f:	75 d7                	jne    801118 <fsring_rw+0x4d>
+  801141:	6a 0e                	push   $0xe
+  801143:	6a 0d                	push   $0xd
+  801145:	ff 35 08 50 80 00    	push   0x805008
+  80114b:	68 00 00 f0 cf       	push   $0xcff00000
+  801150:	e8 c4 0c 00 00       	call   801e19 <ipcring_init>
+  801155:	83 c4 08             	add    $0x8,%esp
+  801158:	6a 00                	push   $0x0
+  80115a:	6a 00                	push   $0x0
+  80115c:	68 07 02 00 00       	push   $0x207
+  801161:	68 00 00 f0 cf       	push   $0xcff00000
+  801166:	6a 0b                	push   $0xb
+  801168:	ff 35 08 50 80 00    	push   0x805008
+  80116e:	e8 b4 1c 00 00       	call   802e27 <ipc_call>
+  801173:	89 c6                	mov    %eax,%esi
+  801175:	83 c4 20             	add    $0x20,%esp
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	0f 88 ac 00 00 00    	js     80122c <fsring_rw+0x161>
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	89 d9                	mov    %ebx,%ecx
+  801187:	83 c3 01             	add    $0x1,%ebx
+  80118a:	89 da                	mov    %ebx,%edx
+  80118c:	c1 e2 0c             	shl    $0xc,%edx
+  80118f:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801195:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80119b:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8011a1:	83 ec 08             	sub    $0x8,%esp
+  8011a4:	6a 00                	push   $0x0
+  8011a6:	6a 00                	push   $0x0
+  8011a8:	68 07 02 00 00       	push   $0x207
+  8011ad:	50                   	push   %eax
+  8011ae:	6a 0c                	push   $0xc
+  8011b0:	ff 35 08 50 80 00    	push   0x805008
+  8011b6:	e8 6c 1c 00 00       	call   802e27 <ipc_call>
+  8011bb:	83 c4 20             	add    $0x20,%esp
+  8011be:	85 c0                	test   %eax,%eax
+  8011c0:	78 6a                	js     80122c <fsring_rw+0x161>
+  8011c2:	83 fb 08             	cmp    $0x8,%ebx
+  8011c5:	75 be                	jne    801185 <fsring_rw+0xba>
+  8011c7:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8011cb:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8011d0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8011d5:	0f 45 c2             	cmovne %edx,%eax
+  8011d8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8011db:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8011e2:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011e9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fa:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011fd:	e9 4b 01 00 00       	jmp    80134d <fsring_rw+0x282>
+  801202:	e8 78 f3 ff ff       	call   80057f <sys_time_msec>
+  801207:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  80120d:	0f 89 f3 fe ff ff    	jns    801106 <fsring_rw+0x3b>
+  801213:	eb 54                	jmp    801269 <fsring_rw+0x19e>
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  801218:	6a 02                	push   $0x2
+  80121a:	e8 a3 1d 00 00       	call   802fc2 <ipc_find_env>
+  80121f:	a3 08 50 80 00       	mov    %eax,0x805008
+  801224:	83 c4 10             	add    $0x10,%esp
+  801227:	e9 e7 fe ff ff       	jmp    801113 <fsring_rw+0x48>
+  80122c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801231:	83 ec 08             	sub    $0x8,%esp
+  801234:	53                   	push   %ebx
+  801235:	6a 00                	push   $0x0
+  801237:	e8 4b f0 ff ff       	call   800287 <sys_page_unmap>
+  80123c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801242:	83 c4 10             	add    $0x10,%esp
+  801245:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80124b:	75 e4                	jne    801231 <fsring_rw+0x166>
+  80124d:	e8 2d f3 ff ff       	call   80057f <sys_time_msec>
+  801252:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801257:	a3 00 50 80 00       	mov    %eax,0x805000
+  80125c:	a1 10 50 80 00       	mov    0x805010,%eax
+  801261:	8b 40 48             	mov    0x48(%eax),%eax
+  801264:	a3 04 50 80 00       	mov    %eax,0x805004
+  801269:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801270:	e9 7a 01 00 00       	jmp    8013ef <fsring_rw+0x324>
+  801275:	8b 57 0c             	mov    0xc(%edi),%edx
+  801278:	89 10                	mov    %edx,(%eax)
+  80127a:	89 58 04             	mov    %ebx,0x4(%eax)
+  80127d:	89 f2                	mov    %esi,%edx
+  80127f:	03 57 04             	add    0x4(%edi),%edx
+  801282:	89 50 08             	mov    %edx,0x8(%eax)
+  801285:	83 ec 04             	sub    $0x4,%esp
+  801288:	53                   	push   %ebx
+  801289:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80128c:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80128f:	52                   	push   %edx
+  801290:	83 c0 0c             	add    $0xc,%eax
+  801293:	50                   	push   %eax
+  801294:	e8 96 18 00 00       	call   802b2f <memmove>
+  801299:	83 c4 10             	add    $0x10,%esp
+  80129c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80129f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8012a2:	89 08                	mov    %ecx,(%eax)
+  8012a4:	83 ec 0c             	sub    $0xc,%esp
+  8012a7:	68 00 00 f0 cf       	push   $0xcff00000
+  8012ac:	e8 c6 0b 00 00       	call   801e77 <ipcring_req_push>
+  8012b1:	01 de                	add    %ebx,%esi
+  8012b3:	83 c4 10             	add    $0x10,%esp
+  8012b6:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8012b9:	73 4c                	jae    801307 <fsring_rw+0x23c>
+  8012bb:	83 ec 0c             	sub    $0xc,%esp
+  8012be:	68 00 00 f0 cf       	push   $0xcff00000
+  8012c3:	e8 89 0b 00 00       	call   801e51 <ipcring_req_slot>
+  8012c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012cb:	83 c4 10             	add    $0x10,%esp
+  8012ce:	85 c0                	test   %eax,%eax
+  8012d0:	74 35                	je     801307 <fsring_rw+0x23c>
+  8012d2:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8012d7:	83 e0 07             	and    $0x7,%eax
+  8012da:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8012df:	c1 e0 0c             	shl    $0xc,%eax
+  8012e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012e5:	29 f3                	sub    %esi,%ebx
+  8012e7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012ea:	39 cb                	cmp    %ecx,%ebx
+  8012ec:	0f 47 d9             	cmova  %ecx,%ebx
+  8012ef:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012f3:	75 80                	jne    801275 <fsring_rw+0x1aa>
+  8012f5:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012f8:	89 10                	mov    %edx,(%eax)
+  8012fa:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012fd:	89 f2                	mov    %esi,%edx
+  8012ff:	03 57 04             	add    0x4(%edi),%edx
+  801302:	89 50 08             	mov    %edx,0x8(%eax)
+  801305:	eb 95                	jmp    80129c <fsring_rw+0x1d1>
+  801307:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80130c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80130f:	83 ec 0c             	sub    $0xc,%esp
+  801312:	68 00 00 f0 cf       	push   $0xcff00000
+  801317:	e8 94 0b 00 00       	call   801eb0 <ipcring_rsp_wait>
+  80131c:	8b 58 04             	mov    0x4(%eax),%ebx
+  80131f:	83 c4 10             	add    $0x10,%esp
+  801322:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801326:	75 45                	jne    80136d <fsring_rw+0x2a2>
+  801328:	85 db                	test   %ebx,%ebx
+  80132a:	79 41                	jns    80136d <fsring_rw+0x2a2>
+  80132c:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80132f:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801336:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  80133d:	83 ec 0c             	sub    $0xc,%esp
+  801340:	68 00 00 f0 cf       	push   $0xcff00000
+  801345:	e8 cc 0b 00 00       	call   801f16 <ipcring_rsp_pop>
+  80134a:	83 c4 10             	add    $0x10,%esp
+  80134d:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801353:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801358:	39 c2                	cmp    %eax,%edx
+  80135a:	74 75                	je     8013d1 <fsring_rw+0x306>
+  80135c:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801360:	75 a5                	jne    801307 <fsring_rw+0x23c>
+  801362:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801365:	0f 82 50 ff ff ff    	jb     8012bb <fsring_rw+0x1f0>
+  80136b:	eb 9a                	jmp    801307 <fsring_rw+0x23c>
+  80136d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801371:	75 ca                	jne    80133d <fsring_rw+0x272>
+  801373:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801377:	74 31                	je     8013aa <fsring_rw+0x2df>
+  801379:	8b 45 08             	mov    0x8(%ebp),%eax
+  80137c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80137f:	29 c8                	sub    %ecx,%eax
+  801381:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801384:	39 d0                	cmp    %edx,%eax
+  801386:	0f 47 c2             	cmova  %edx,%eax
+  801389:	39 d8                	cmp    %ebx,%eax
+  80138b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801390:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801394:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801397:	b8 01 00 00 00       	mov    $0x1,%eax
+  80139c:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8013a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8013a3:	01 d9                	add    %ebx,%ecx
+  8013a5:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8013a8:	eb 93                	jmp    80133d <fsring_rw+0x272>
+  8013aa:	83 ec 04             	sub    $0x4,%esp
+  8013ad:	53                   	push   %ebx
+  8013ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013b1:	83 e0 07             	and    $0x7,%eax
+  8013b4:	c1 e0 0c             	shl    $0xc,%eax
+  8013b7:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8013bd:	50                   	push   %eax
+  8013be:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8013c1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8013c4:	01 c8                	add    %ecx,%eax
+  8013c6:	50                   	push   %eax
+  8013c7:	e8 63 17 00 00       	call   802b2f <memmove>
+  8013cc:	83 c4 10             	add    $0x10,%esp
+  8013cf:	eb a8                	jmp    801379 <fsring_rw+0x2ae>
+  8013d1:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8013d5:	75 09                	jne    8013e0 <fsring_rw+0x315>
+  8013d7:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8013da:	0f 82 db fe ff ff    	jb     8012bb <fsring_rw+0x1f0>
+  8013e0:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8013e3:	01 57 04             	add    %edx,0x4(%edi)
+  8013e6:	85 d2                	test   %edx,%edx
+  8013e8:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013ec:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013ef:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f5:	5b                   	pop    %ebx
+  8013f6:	5e                   	pop    %esi
+  8013f7:	5f                   	pop    %edi
+  8013f8:	5d                   	pop    %ebp
+  8013f9:	c3                   	ret
+
+008013fa <devfile_write>:
+  8013fa:	55                   	push   %ebp
+  8013fb:	89 e5                	mov    %esp,%ebp
+  8013fd:	57                   	push   %edi
+  8013fe:	56                   	push   %esi
+  8013ff:	53                   	push   %ebx
+  801400:	83 ec 0c             	sub    $0xc,%esp
+  801403:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801406:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801409:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140c:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801412:	76 1a                	jbe    80142e <devfile_write+0x34>
+  801414:	83 ec 0c             	sub    $0xc,%esp
+  801417:	53                   	push   %ebx
+  801418:	89 f1                	mov    %esi,%ecx
+  80141a:	ba 06 00 00 00       	mov    $0x6,%edx
+  80141f:	89 f8                	mov    %edi,%eax
+  801421:	e8 a5 fc ff ff       	call   8010cb <fsring_rw>
+  801426:	83 c4 10             	add    $0x10,%esp
+  801429:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80142c:	75 39                	jne    801467 <devfile_write+0x6d>
+  80142e:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801433:	39 c3                	cmp    %eax,%ebx
+  801435:	0f 47 d8             	cmova  %eax,%ebx
+  801438:	8b 47 0c             	mov    0xc(%edi),%eax
+  80143b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801440:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801446:	83 ec 04             	sub    $0x4,%esp
+  801449:	53                   	push   %ebx
+  80144a:	56                   	push   %esi
+  80144b:	68 08 60 80 00       	push   $0x806008
+  801450:	e8 da 16 00 00       	call   802b2f <memmove>
+  801455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80145f:	e8 7c fb ff ff       	call   800fe0 <fsipc>
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146a:	5b                   	pop    %ebx
+  80146b:	5e                   	pop    %esi
+  80146c:	5f                   	pop    %edi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+
+0080146f <devfile_read>:
+  80146f:	55                   	push   %ebp
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	57                   	push   %edi
+  801473:	56                   	push   %esi
+  801474:	53                   	push   %ebx
+  801475:	83 ec 0c             	sub    $0xc,%esp
+  801478:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80147b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80147e:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  801484:	76 1d                	jbe    8014a3 <devfile_read+0x34>
+  801486:	83 ec 0c             	sub    $0xc,%esp
+  801489:	56                   	push   %esi
+  80148a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148d:	ba 05 00 00 00       	mov    $0x5,%edx
+  801492:	89 f8                	mov    %edi,%eax
+  801494:	e8 32 fc ff ff       	call   8010cb <fsring_rw>
+  801499:	89 c3                	mov    %eax,%ebx
+  80149b:	83 c4 10             	add    $0x10,%esp
+  80149e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8014a1:	75 37                	jne    8014da <devfile_read+0x6b>
+  8014a3:	8b 47 0c             	mov    0xc(%edi),%eax
+  8014a6:	a3 00 60 80 00       	mov    %eax,0x806000
+  8014ab:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8014b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014bb:	e8 20 fb ff ff       	call   800fe0 <fsipc>
+  8014c0:	89 c3                	mov    %eax,%ebx
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	78 14                	js     8014da <devfile_read+0x6b>
+  8014c6:	83 ec 04             	sub    $0x4,%esp
+  8014c9:	50                   	push   %eax
+  8014ca:	68 00 60 80 00       	push   $0x806000
+  8014cf:	ff 75 0c             	push   0xc(%ebp)
+  8014d2:	e8 58 16 00 00       	call   802b2f <memmove>
+  8014d7:	83 c4 10             	add    $0x10,%esp
+  8014da:	89 d8                	mov    %ebx,%eax
+  8014dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014df:	5b                   	pop    %ebx
+  8014e0:	5e                   	pop    %esi
+  8014e1:	5f                   	pop    %edi
+  8014e2:	5d                   	pop    %ebp
+  8014e3:	c3                   	ret
+
+008014e4 <open>:
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 ec 1c             	sub    $0x1c,%esp
+  8014ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ef:	56                   	push   %esi
+  8014f0:	e8 3e 14 00 00       	call   802933 <strlen>
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014fd:	7f 6c                	jg     80156b <open+0x87>
+  8014ff:	83 ec 0c             	sub    $0xc,%esp
+  801502:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801505:	50                   	push   %eax
+  801506:	e8 6a f5 ff ff       	call   800a75 <fd_alloc>
+  80150b:	89 c3                	mov    %eax,%ebx
+  80150d:	83 c4 10             	add    $0x10,%esp
+  801510:	85 c0                	test   %eax,%eax
+  801512:	78 3c                	js     801550 <open+0x6c>
+  801514:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801517:	a3 00 64 80 00       	mov    %eax,0x806400
+  80151c:	83 ec 08             	sub    $0x8,%esp
+  80151f:	56                   	push   %esi
+  801520:	68 00 60 80 00       	push   $0x806000
+  801525:	e8 55 14 00 00       	call   80297f <strcpy>
+  80152a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80152d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801532:	e8 a9 fa ff ff       	call   800fe0 <fsipc>
+  801537:	89 c3                	mov    %eax,%ebx
+  801539:	83 c4 10             	add    $0x10,%esp
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	78 19                	js     801559 <open+0x75>
+  801540:	83 ec 0c             	sub    $0xc,%esp
+  801543:	ff 75 f4             	push   -0xc(%ebp)
+  801546:	e8 03 f5 ff ff       	call   800a4e <fd2num>
+  80154b:	89 c3                	mov    %eax,%ebx
+  80154d:	83 c4 10             	add    $0x10,%esp
+  801550:	89 d8                	mov    %ebx,%eax
+  801552:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801555:	5b                   	pop    %ebx
+  801556:	5e                   	pop    %esi
+  801557:	5d                   	pop    %ebp
+  801558:	c3                   	ret
+  801559:	83 ec 08             	sub    $0x8,%esp
+  80155c:	6a 00                	push   $0x0
+  80155e:	ff 75 f4             	push   -0xc(%ebp)
+  801561:	e8 05 f6 ff ff       	call   800b6b <fd_close>
+  801566:	83 c4 10             	add    $0x10,%esp
+  801569:	eb e5                	jmp    801550 <open+0x6c>
+  80156b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801570:	eb de                	jmp    801550 <open+0x6c>
+
+00801572 <file_image>:
+  801572:	55                   	push   %ebp
+  801573:	89 e5                	mov    %esp,%ebp
+  801575:	53                   	push   %ebx
+  801576:	83 ec 1c             	sub    $0x1c,%esp
+  801579:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80157f:	50                   	push   %eax
+  801580:	ff 75 08             	push   0x8(%ebp)
+  801583:	e8 3d f5 ff ff       	call   800ac5 <fd_lookup>
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	78 58                	js     8015e7 <file_image+0x75>
+  80158f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801592:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801598:	39 08                	cmp    %ecx,(%eax)
+  80159a:	75 50                	jne    8015ec <file_image+0x7a>
+  80159c:	83 fb 04             	cmp    $0x4,%ebx
+  80159f:	77 52                	ja     8015f3 <file_image+0x81>
+  8015a1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015a4:	a3 00 60 80 00       	mov    %eax,0x806000
+  8015a9:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8015af:	83 ec 04             	sub    $0x4,%esp
+  8015b2:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8015b5:	c1 e0 02             	shl    $0x2,%eax
+  8015b8:	50                   	push   %eax
+  8015b9:	ff 75 0c             	push   0xc(%ebp)
+  8015bc:	68 08 60 80 00       	push   $0x806008
+  8015c1:	e8 69 15 00 00       	call   802b2f <memmove>
+  8015c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015d0:	e8 0b fa ff ff       	call   800fe0 <fsipc>
+  8015d5:	83 c4 10             	add    $0x10,%esp
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	78 0b                	js     8015e7 <file_image+0x75>
+  8015dc:	8b 55 14             	mov    0x14(%ebp),%edx
+  8015df:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8015e5:	89 0a                	mov    %ecx,(%edx)
+  8015e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ea:	c9                   	leave
+  8015eb:	c3                   	ret
+  8015ec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015f1:	eb f4                	jmp    8015e7 <file_image+0x75>
+  8015f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f8:	eb ed                	jmp    8015e7 <file_image+0x75>
+
+008015fa <remove>:
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	53                   	push   %ebx
+  8015fe:	83 ec 10             	sub    $0x10,%esp
+  801601:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801604:	53                   	push   %ebx
+  801605:	e8 29 13 00 00       	call   802933 <strlen>
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801612:	7f 25                	jg     801639 <remove+0x3f>
+  801614:	83 ec 08             	sub    $0x8,%esp
+  801617:	53                   	push   %ebx
+  801618:	68 00 60 80 00       	push   $0x806000
+  80161d:	e8 5d 13 00 00       	call   80297f <strcpy>
+  801622:	ba 00 00 00 00       	mov    $0x0,%edx
+  801627:	b8 09 00 00 00       	mov    $0x9,%eax
+  80162c:	e8 af f9 ff ff       	call   800fe0 <fsipc>
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801637:	c9                   	leave
+  801638:	c3                   	ret
+  801639:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80163e:	eb f4                	jmp    801634 <remove+0x3a>
+
+00801640 <sync>:
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	83 ec 08             	sub    $0x8,%esp
+  801646:	ba 00 00 00 00       	mov    $0x0,%edx
+  80164b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801650:	e8 8b f9 ff ff       	call   800fe0 <fsipc>
+  801655:	c9                   	leave
+  801656:	c3                   	ret
+
+00801657 <devsock_stat>:
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	83 ec 10             	sub    $0x10,%esp
+  80165d:	68 e8 32 80 00       	push   $0x8032e8
+  801662:	ff 75 0c             	push   0xc(%ebp)
+  801665:	e8 15 13 00 00       	call   80297f <strcpy>
+  80166a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166f:	c9                   	leave
+  801670:	c3                   	ret
+
+00801671 <devsock_close>:
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	53                   	push   %ebx
+  801675:	83 ec 10             	sub    $0x10,%esp
+  801678:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80167b:	53                   	push   %ebx
+  80167c:	e8 5b 19 00 00       	call   802fdc <pageref>
+  801681:	89 c2                	mov    %eax,%edx
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168b:	83 fa 01             	cmp    $0x1,%edx
+  80168e:	74 05                	je     801695 <devsock_close+0x24>
+  801690:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+  801695:	83 ec 0c             	sub    $0xc,%esp
+  801698:	ff 73 0c             	push   0xc(%ebx)
+  80169b:	e8 aa 02 00 00       	call   80194a <nsipc_close>
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	eb eb                	jmp    801690 <devsock_close+0x1f>
+
+008016a5 <devsock_write>:
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	83 ec 08             	sub    $0x8,%esp
+  8016ab:	6a 00                	push   $0x0
+  8016ad:	ff 75 10             	push   0x10(%ebp)
+  8016b0:	ff 75 0c             	push   0xc(%ebp)
+  8016b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016b6:	ff 70 0c             	push   0xc(%eax)
+  8016b9:	e8 6c 03 00 00       	call   801a2a <nsipc_send>
+  8016be:	c9                   	leave
+  8016bf:	c3                   	ret
+
+008016c0 <devsock_read>:
+  8016c0:	55                   	push   %ebp
+  8016c1:	89 e5                	mov    %esp,%ebp
+  8016c3:	83 ec 08             	sub    $0x8,%esp
+  8016c6:	6a 00                	push   $0x0
+  8016c8:	ff 75 10             	push   0x10(%ebp)
+  8016cb:	ff 75 0c             	push   0xc(%ebp)
+  8016ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d1:	ff 70 0c             	push   0xc(%eax)
+  8016d4:	e8 e2 02 00 00       	call   8019bb <nsipc_recv>
+  8016d9:	c9                   	leave
+  8016da:	c3                   	ret
+
+008016db <fd2sockid>:
+  8016db:	55                   	push   %ebp
+  8016dc:	89 e5                	mov    %esp,%ebp
+  8016de:	83 ec 20             	sub    $0x20,%esp
+  8016e1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016e4:	52                   	push   %edx
+  8016e5:	50                   	push   %eax
+  8016e6:	e8 da f3 ff ff       	call   800ac5 <fd_lookup>
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	78 10                	js     801702 <fd2sockid+0x27>
+  8016f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f5:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016fb:	39 08                	cmp    %ecx,(%eax)
+  8016fd:	75 05                	jne    801704 <fd2sockid+0x29>
+  8016ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  801702:	c9                   	leave
+  801703:	c3                   	ret
+  801704:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801709:	eb f7                	jmp    801702 <fd2sockid+0x27>
+
+0080170b <alloc_sockfd>:
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+  801710:	83 ec 1c             	sub    $0x1c,%esp
+  801713:	89 c6                	mov    %eax,%esi
+  801715:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801718:	50                   	push   %eax
+  801719:	e8 57 f3 ff ff       	call   800a75 <fd_alloc>
+  80171e:	89 c3                	mov    %eax,%ebx
+  801720:	83 c4 10             	add    $0x10,%esp
+  801723:	85 c0                	test   %eax,%eax
+  801725:	78 43                	js     80176a <alloc_sockfd+0x5f>
+  801727:	83 ec 04             	sub    $0x4,%esp
+  80172a:	68 07 04 00 00       	push   $0x407
+  80172f:	ff 75 f4             	push   -0xc(%ebp)
+  801732:	6a 00                	push   $0x0
+  801734:	e8 7c ea ff ff       	call   8001b5 <sys_page_alloc>
+  801739:	89 c3                	mov    %eax,%ebx
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	78 28                	js     80176a <alloc_sockfd+0x5f>
+  801742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801745:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80174b:	89 10                	mov    %edx,(%eax)
+  80174d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801750:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801757:	89 70 0c             	mov    %esi,0xc(%eax)
+  80175a:	83 ec 0c             	sub    $0xc,%esp
+  80175d:	50                   	push   %eax
+  80175e:	e8 eb f2 ff ff       	call   800a4e <fd2num>
+  801763:	89 c3                	mov    %eax,%ebx
+  801765:	83 c4 10             	add    $0x10,%esp
+  801768:	eb 0c                	jmp    801776 <alloc_sockfd+0x6b>
+  80176a:	83 ec 0c             	sub    $0xc,%esp
+  80176d:	56                   	push   %esi
+  80176e:	e8 d7 01 00 00       	call   80194a <nsipc_close>
+  801773:	83 c4 10             	add    $0x10,%esp
+  801776:	89 d8                	mov    %ebx,%eax
+  801778:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177b:	5b                   	pop    %ebx
+  80177c:	5e                   	pop    %esi
+  80177d:	5d                   	pop    %ebp
+  80177e:	c3                   	ret
+
+0080177f <accept>:
+  80177f:	55                   	push   %ebp
+  801780:	89 e5                	mov    %esp,%ebp
+  801782:	83 ec 08             	sub    $0x8,%esp
+  801785:	8b 45 08             	mov    0x8(%ebp),%eax
+  801788:	e8 4e ff ff ff       	call   8016db <fd2sockid>
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 1b                	js     8017ac <accept+0x2d>
+  801791:	83 ec 04             	sub    $0x4,%esp
+  801794:	ff 75 10             	push   0x10(%ebp)
+  801797:	ff 75 0c             	push   0xc(%ebp)
+  80179a:	50                   	push   %eax
+  80179b:	e8 07 01 00 00       	call   8018a7 <nsipc_accept>
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	78 05                	js     8017ac <accept+0x2d>
+  8017a7:	e8 5f ff ff ff       	call   80170b <alloc_sockfd>
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+008017ae <bind>:
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	83 ec 08             	sub    $0x8,%esp
+  8017b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b7:	e8 1f ff ff ff       	call   8016db <fd2sockid>
+  8017bc:	85 c0                	test   %eax,%eax
+  8017be:	78 12                	js     8017d2 <bind+0x24>
+  8017c0:	83 ec 04             	sub    $0x4,%esp
+  8017c3:	ff 75 10             	push   0x10(%ebp)
+  8017c6:	ff 75 0c             	push   0xc(%ebp)
+  8017c9:	50                   	push   %eax
+  8017ca:	e8 24 01 00 00       	call   8018f3 <nsipc_bind>
+  8017cf:	83 c4 10             	add    $0x10,%esp
+  8017d2:	c9                   	leave
+  8017d3:	c3                   	ret
+
+008017d4 <shutdown>:
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	83 ec 08             	sub    $0x8,%esp
+  8017da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017dd:	e8 f9 fe ff ff       	call   8016db <fd2sockid>
+  8017e2:	85 c0                	test   %eax,%eax
+  8017e4:	78 0f                	js     8017f5 <shutdown+0x21>
+  8017e6:	83 ec 08             	sub    $0x8,%esp
+  8017e9:	ff 75 0c             	push   0xc(%ebp)
+  8017ec:	50                   	push   %eax
+  8017ed:	e8 36 01 00 00       	call   801928 <nsipc_shutdown>
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	c9                   	leave
+  8017f6:	c3                   	ret
+
+008017f7 <connect>:
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	83 ec 08             	sub    $0x8,%esp
+  8017fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801800:	e8 d6 fe ff ff       	call   8016db <fd2sockid>
+  801805:	85 c0                	test   %eax,%eax
+  801807:	78 12                	js     80181b <connect+0x24>
+  801809:	83 ec 04             	sub    $0x4,%esp
+  80180c:	ff 75 10             	push   0x10(%ebp)
+  80180f:	ff 75 0c             	push   0xc(%ebp)
+  801812:	50                   	push   %eax
+  801813:	e8 4c 01 00 00       	call   801964 <nsipc_connect>
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	c9                   	leave
+  80181c:	c3                   	ret
+
+0080181d <listen>:
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	83 ec 08             	sub    $0x8,%esp
+  801823:	8b 45 08             	mov    0x8(%ebp),%eax
+  801826:	e8 b0 fe ff ff       	call   8016db <fd2sockid>
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	78 0f                	js     80183e <listen+0x21>
+  80182f:	83 ec 08             	sub    $0x8,%esp
+  801832:	ff 75 0c             	push   0xc(%ebp)
+  801835:	50                   	push   %eax
+  801836:	e8 5e 01 00 00       	call   801999 <nsipc_listen>
+  80183b:	83 c4 10             	add    $0x10,%esp
+  80183e:	c9                   	leave
+  80183f:	c3                   	ret
+
+00801840 <socket>:
+  801840:	55                   	push   %ebp
+  801841:	89 e5                	mov    %esp,%ebp
+  801843:	83 ec 0c             	sub    $0xc,%esp
+  801846:	ff 75 10             	push   0x10(%ebp)
+  801849:	ff 75 0c             	push   0xc(%ebp)
+  80184c:	ff 75 08             	push   0x8(%ebp)
+  80184f:	e8 34 02 00 00       	call   801a88 <nsipc_socket>
+  801854:	83 c4 10             	add    $0x10,%esp
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 05                	js     801860 <socket+0x20>
+  80185b:	e8 ab fe ff ff       	call   80170b <alloc_sockfd>
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+
+00801862 <nsipc>:
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	53                   	push   %ebx
+  801866:	83 ec 04             	sub    $0x4,%esp
+  801869:	89 c3                	mov    %eax,%ebx
+  80186b:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801872:	74 1f                	je     801893 <nsipc+0x31>
+  801874:	83 ec 08             	sub    $0x8,%esp
+  801877:	6a 00                	push   $0x0
+  801879:	6a 00                	push   $0x0
+  80187b:	6a 07                	push   $0x7
+  80187d:	68 00 70 80 00       	push   $0x807000
+  801882:	53                   	push   %ebx
+  801883:	ff 35 0c 50 80 00    	push   0x80500c
+  801889:	e8 99 15 00 00       	call   802e27 <ipc_call>
+  80188e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801891:	c9                   	leave
+  801892:	c3                   	ret
+  801893:	83 ec 0c             	sub    $0xc,%esp
+  801896:	6a 03                	push   $0x3
+  801898:	e8 25 17 00 00       	call   802fc2 <ipc_find_env>
+  80189d:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  8018a2:	83 c4 10             	add    $0x10,%esp
+  8018a5:	eb cd                	jmp    801874 <nsipc+0x12>
+
+008018a7 <nsipc_accept>:
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	53                   	push   %ebx
+  8018ab:	83 ec 04             	sub    $0x4,%esp
+  8018ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018bb:	e8 a2 ff ff ff       	call   801862 <nsipc>
+  8018c0:	89 c3                	mov    %eax,%ebx
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	79 07                	jns    8018cd <nsipc_accept+0x26>
+  8018c6:	89 d8                	mov    %ebx,%eax
+  8018c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018cb:	c9                   	leave
+  8018cc:	c3                   	ret
+  8018cd:	83 ec 04             	sub    $0x4,%esp
+  8018d0:	ff 35 10 70 80 00    	push   0x807010
+  8018d6:	68 00 70 80 00       	push   $0x807000
+  8018db:	ff 75 0c             	push   0xc(%ebp)
+  8018de:	e8 4c 12 00 00       	call   802b2f <memmove>
+  8018e3:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018ec:	89 10                	mov    %edx,(%eax)
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	eb d3                	jmp    8018c6 <nsipc_accept+0x1f>
+
+008018f3 <nsipc_bind>:
+  8018f3:	55                   	push   %ebp
+  8018f4:	89 e5                	mov    %esp,%ebp
+  8018f6:	53                   	push   %ebx
+  8018f7:	83 ec 08             	sub    $0x8,%esp
+  8018fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801900:	a3 00 70 80 00       	mov    %eax,0x807000
+  801905:	53                   	push   %ebx
+  801906:	ff 75 0c             	push   0xc(%ebp)
+  801909:	68 04 70 80 00       	push   $0x807004
+  80190e:	e8 1c 12 00 00       	call   802b2f <memmove>
+  801913:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801919:	b8 02 00 00 00       	mov    $0x2,%eax
+  80191e:	e8 3f ff ff ff       	call   801862 <nsipc>
+  801923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801926:	c9                   	leave
+  801927:	c3                   	ret
+
+00801928 <nsipc_shutdown>:
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	83 ec 08             	sub    $0x8,%esp
+  80192e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801931:	a3 00 70 80 00       	mov    %eax,0x807000
+  801936:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801939:	a3 04 70 80 00       	mov    %eax,0x807004
+  80193e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801943:	e8 1a ff ff ff       	call   801862 <nsipc>
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+0080194a <nsipc_close>:
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	83 ec 08             	sub    $0x8,%esp
+  801950:	8b 45 08             	mov    0x8(%ebp),%eax
+  801953:	a3 00 70 80 00       	mov    %eax,0x807000
+  801958:	b8 04 00 00 00       	mov    $0x4,%eax
+  80195d:	e8 00 ff ff ff       	call   801862 <nsipc>
+  801962:	c9                   	leave
+  801963:	c3                   	ret
+
+00801964 <nsipc_connect>:
+  801964:	55                   	push   %ebp
+  801965:	89 e5                	mov    %esp,%ebp
+  801967:	53                   	push   %ebx
+  801968:	83 ec 08             	sub    $0x8,%esp
+  80196b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80196e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801971:	a3 00 70 80 00       	mov    %eax,0x807000
+  801976:	53                   	push   %ebx
+  801977:	ff 75 0c             	push   0xc(%ebp)
+  80197a:	68 04 70 80 00       	push   $0x807004
+  80197f:	e8 ab 11 00 00       	call   802b2f <memmove>
+  801984:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80198a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80198f:	e8 ce fe ff ff       	call   801862 <nsipc>
+  801994:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801997:	c9                   	leave
+  801998:	c3                   	ret
+
+00801999 <nsipc_listen>:
+  801999:	55                   	push   %ebp
+  80199a:	89 e5                	mov    %esp,%ebp
+  80199c:	83 ec 08             	sub    $0x8,%esp
+  80199f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8019a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019aa:	a3 04 70 80 00       	mov    %eax,0x807004
+  8019af:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019b4:	e8 a9 fe ff ff       	call   801862 <nsipc>
+  8019b9:	c9                   	leave
+  8019ba:	c3                   	ret
+
+008019bb <nsipc_recv>:
+  8019bb:	55                   	push   %ebp
+  8019bc:	89 e5                	mov    %esp,%ebp
+  8019be:	56                   	push   %esi
+  8019bf:	53                   	push   %ebx
+  8019c0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8019cb:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8019d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8019d4:	a3 08 70 80 00       	mov    %eax,0x807008
+  8019d9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019de:	e8 7f fe ff ff       	call   801862 <nsipc>
+  8019e3:	89 c3                	mov    %eax,%ebx
+  8019e5:	85 c0                	test   %eax,%eax
+  8019e7:	78 22                	js     801a0b <nsipc_recv+0x50>
+  8019e9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019ee:	39 c6                	cmp    %eax,%esi
+  8019f0:	0f 4e c6             	cmovle %esi,%eax
+  8019f3:	39 c3                	cmp    %eax,%ebx
+  8019f5:	7f 1d                	jg     801a14 <nsipc_recv+0x59>
+  8019f7:	83 ec 04             	sub    $0x4,%esp
+  8019fa:	53                   	push   %ebx
+  8019fb:	68 00 70 80 00       	push   $0x807000
+  801a00:	ff 75 0c             	push   0xc(%ebp)
+  801a03:	e8 27 11 00 00       	call   802b2f <memmove>
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	89 d8                	mov    %ebx,%eax
+  801a0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a10:	5b                   	pop    %ebx
+  801a11:	5e                   	pop    %esi
+  801a12:	5d                   	pop    %ebp
+  801a13:	c3                   	ret
+  801a14:	68 f4 32 80 00       	push   $0x8032f4
+  801a19:	68 09 33 80 00       	push   $0x803309
+  801a1e:	6a 60                	push   $0x60
+  801a20:	68 1e 33 80 00       	push   $0x80331e
+  801a25:	e8 83 07 00 00       	call   8021ad <_panic>
+
+00801a2a <nsipc_send>:
+  801a2a:	55                   	push   %ebp
+  801a2b:	89 e5                	mov    %esp,%ebp
+  801a2d:	53                   	push   %ebx
+  801a2e:	83 ec 04             	sub    $0x4,%esp
+  801a31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a37:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a3c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a42:	7f 2e                	jg     801a72 <nsipc_send+0x48>
+  801a44:	83 ec 04             	sub    $0x4,%esp
+  801a47:	53                   	push   %ebx
+  801a48:	ff 75 0c             	push   0xc(%ebp)
+  801a4b:	68 0c 70 80 00       	push   $0x80700c
+  801a50:	e8 da 10 00 00       	call   802b2f <memmove>
+  801a55:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a5e:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a63:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a68:	e8 f5 fd ff ff       	call   801862 <nsipc>
+  801a6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a70:	c9                   	leave
+  801a71:	c3                   	ret
+  801a72:	68 2a 33 80 00       	push   $0x80332a
+  801a77:	68 09 33 80 00       	push   $0x803309
+  801a7c:	6a 6b                	push   $0x6b
+  801a7e:	68 1e 33 80 00       	push   $0x80331e
+  801a83:	e8 25 07 00 00       	call   8021ad <_panic>
+
+00801a88 <nsipc_socket>:
+  801a88:	55                   	push   %ebp
+  801a89:	89 e5                	mov    %esp,%ebp
+  801a8b:	83 ec 08             	sub    $0x8,%esp
+  801a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a91:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a99:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a9e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801aa1:	a3 08 70 80 00       	mov    %eax,0x807008
+  801aa6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801aab:	e8 b2 fd ff ff       	call   801862 <nsipc>
+  801ab0:	c9                   	leave
+  801ab1:	c3                   	ret
+
+00801ab2 <devpipe_stat>:
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	56                   	push   %esi
+  801ab6:	53                   	push   %ebx
+  801ab7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801aba:	83 ec 0c             	sub    $0xc,%esp
+  801abd:	ff 75 08             	push   0x8(%ebp)
+  801ac0:	e8 99 ef ff ff       	call   800a5e <fd2data>
+  801ac5:	89 c6                	mov    %eax,%esi
+  801ac7:	83 c4 08             	add    $0x8,%esp
+  801aca:	68 36 33 80 00       	push   $0x803336
+  801acf:	53                   	push   %ebx
+  801ad0:	e8 aa 0e 00 00       	call   80297f <strcpy>
+  801ad5:	8b 46 04             	mov    0x4(%esi),%eax
+  801ad8:	2b 06                	sub    (%esi),%eax
+  801ada:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801ae0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ae7:	00 00 00 
+  801aea:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801af1:	40 80 00 
+  801af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afc:	5b                   	pop    %ebx
+  801afd:	5e                   	pop    %esi
+  801afe:	5d                   	pop    %ebp
+  801aff:	c3                   	ret
+
+00801b00 <devpipe_close>:
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	53                   	push   %ebx
+  801b04:	83 ec 0c             	sub    $0xc,%esp
+  801b07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b0a:	53                   	push   %ebx
+  801b0b:	6a 00                	push   $0x0
+  801b0d:	e8 75 e7 ff ff       	call   800287 <sys_page_unmap>
+  801b12:	89 1c 24             	mov    %ebx,(%esp)
+  801b15:	e8 44 ef ff ff       	call   800a5e <fd2data>
+  801b1a:	83 c4 08             	add    $0x8,%esp
+  801b1d:	50                   	push   %eax
+  801b1e:	6a 00                	push   $0x0
+  801b20:	e8 62 e7 ff ff       	call   800287 <sys_page_unmap>
+  801b25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b28:	c9                   	leave
+  801b29:	c3                   	ret
+
+00801b2a <_pipeisclosed>:
+  801b2a:	55                   	push   %ebp
+  801b2b:	89 e5                	mov    %esp,%ebp
+  801b2d:	57                   	push   %edi
+  801b2e:	56                   	push   %esi
+  801b2f:	53                   	push   %ebx
+  801b30:	83 ec 1c             	sub    $0x1c,%esp
+  801b33:	89 c7                	mov    %eax,%edi
+  801b35:	89 d6                	mov    %edx,%esi
+  801b37:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b3c:	8b 58 58             	mov    0x58(%eax),%ebx
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	57                   	push   %edi
+  801b43:	e8 94 14 00 00       	call   802fdc <pageref>
+  801b48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b4b:	89 34 24             	mov    %esi,(%esp)
+  801b4e:	e8 89 14 00 00       	call   802fdc <pageref>
+  801b53:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b59:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	39 cb                	cmp    %ecx,%ebx
+  801b61:	74 1b                	je     801b7e <_pipeisclosed+0x54>
+  801b63:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b66:	75 cf                	jne    801b37 <_pipeisclosed+0xd>
+  801b68:	8b 42 58             	mov    0x58(%edx),%eax
+  801b6b:	6a 01                	push   $0x1
+  801b6d:	50                   	push   %eax
+  801b6e:	53                   	push   %ebx
+  801b6f:	68 3d 33 80 00       	push   $0x80333d
+  801b74:	e8 0f 07 00 00       	call   802288 <cprintf>
+  801b79:	83 c4 10             	add    $0x10,%esp
+  801b7c:	eb b9                	jmp    801b37 <_pipeisclosed+0xd>
+  801b7e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b81:	0f 94 c0             	sete   %al
+  801b84:	0f b6 c0             	movzbl %al,%eax
+  801b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8a:	5b                   	pop    %ebx
+  801b8b:	5e                   	pop    %esi
+  801b8c:	5f                   	pop    %edi
+  801b8d:	5d                   	pop    %ebp
+  801b8e:	c3                   	ret
+
+00801b8f <devpipe_write>:
+  801b8f:	55                   	push   %ebp
+  801b90:	89 e5                	mov    %esp,%ebp
+  801b92:	57                   	push   %edi
+  801b93:	56                   	push   %esi
+  801b94:	53                   	push   %ebx
+  801b95:	83 ec 28             	sub    $0x28,%esp
+  801b98:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b9b:	56                   	push   %esi
+  801b9c:	e8 bd ee ff ff       	call   800a5e <fd2data>
+  801ba1:	89 c3                	mov    %eax,%ebx
+  801ba3:	83 c4 10             	add    $0x10,%esp
+  801ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bab:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801baf:	74 5c                	je     801c0d <devpipe_write+0x7e>
+  801bb1:	8b 43 04             	mov    0x4(%ebx),%eax
+  801bb4:	8b 0b                	mov    (%ebx),%ecx
+  801bb6:	8d 51 20             	lea    0x20(%ecx),%edx
+  801bb9:	39 d0                	cmp    %edx,%eax
+  801bbb:	72 1e                	jb     801bdb <devpipe_write+0x4c>
+  801bbd:	89 da                	mov    %ebx,%edx
+  801bbf:	89 f0                	mov    %esi,%eax
+  801bc1:	e8 64 ff ff ff       	call   801b2a <_pipeisclosed>
+  801bc6:	85 c0                	test   %eax,%eax
+  801bc8:	75 48                	jne    801c12 <devpipe_write+0x83>
+  801bca:	e8 9b e5 ff ff       	call   80016a <sys_yield>
+  801bcf:	8b 43 04             	mov    0x4(%ebx),%eax
+  801bd2:	8b 0b                	mov    (%ebx),%ecx
+  801bd4:	8d 51 20             	lea    0x20(%ecx),%edx
+  801bd7:	39 d0                	cmp    %edx,%eax
+  801bd9:	73 e2                	jae    801bbd <devpipe_write+0x2e>
+  801bdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bde:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801be2:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801be5:	89 c2                	mov    %eax,%edx
+  801be7:	c1 fa 1f             	sar    $0x1f,%edx
+  801bea:	89 d1                	mov    %edx,%ecx
+  801bec:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bef:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bf2:	83 e2 1f             	and    $0x1f,%edx
+  801bf5:	29 ca                	sub    %ecx,%edx
+  801bf7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bfb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bff:	83 c0 01             	add    $0x1,%eax
+  801c02:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c05:	83 c7 01             	add    $0x1,%edi
+  801c08:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c0b:	75 a4                	jne    801bb1 <devpipe_write+0x22>
+  801c0d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c10:	eb 05                	jmp    801c17 <devpipe_write+0x88>
+  801c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1a:	5b                   	pop    %ebx
+  801c1b:	5e                   	pop    %esi
+  801c1c:	5f                   	pop    %edi
+  801c1d:	5d                   	pop    %ebp
+  801c1e:	c3                   	ret
+
+00801c1f <devpipe_read>:
+  801c1f:	55                   	push   %ebp
+  801c20:	89 e5                	mov    %esp,%ebp
+  801c22:	57                   	push   %edi
+  801c23:	56                   	push   %esi
+  801c24:	53                   	push   %ebx
+  801c25:	83 ec 18             	sub    $0x18,%esp
+  801c28:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c2b:	56                   	push   %esi
+  801c2c:	e8 2d ee ff ff       	call   800a5e <fd2data>
+  801c31:	89 c3                	mov    %eax,%ebx
+  801c33:	83 c4 10             	add    $0x10,%esp
+  801c36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c3b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c3f:	74 45                	je     801c86 <devpipe_read+0x67>
+  801c41:	8b 03                	mov    (%ebx),%eax
+  801c43:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c46:	75 1d                	jne    801c65 <devpipe_read+0x46>
+  801c48:	85 ff                	test   %edi,%edi
+  801c4a:	75 3f                	jne    801c8b <devpipe_read+0x6c>
+  801c4c:	89 da                	mov    %ebx,%edx
+  801c4e:	89 f0                	mov    %esi,%eax
+  801c50:	e8 d5 fe ff ff       	call   801b2a <_pipeisclosed>
+  801c55:	85 c0                	test   %eax,%eax
+  801c57:	75 3c                	jne    801c95 <devpipe_read+0x76>
+  801c59:	e8 0c e5 ff ff       	call   80016a <sys_yield>
+  801c5e:	8b 03                	mov    (%ebx),%eax
+  801c60:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c63:	74 e7                	je     801c4c <devpipe_read+0x2d>
+  801c65:	99                   	cltd
+  801c66:	c1 ea 1b             	shr    $0x1b,%edx
+  801c69:	01 d0                	add    %edx,%eax
+  801c6b:	83 e0 1f             	and    $0x1f,%eax
+  801c6e:	29 d0                	sub    %edx,%eax
+  801c70:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c78:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c7b:	83 03 01             	addl   $0x1,(%ebx)
+  801c7e:	83 c7 01             	add    $0x1,%edi
+  801c81:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c84:	75 bb                	jne    801c41 <devpipe_read+0x22>
+  801c86:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c89:	eb 02                	jmp    801c8d <devpipe_read+0x6e>
+  801c8b:	89 f8                	mov    %edi,%eax
+  801c8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c90:	5b                   	pop    %ebx
+  801c91:	5e                   	pop    %esi
+  801c92:	5f                   	pop    %edi
+  801c93:	5d                   	pop    %ebp
+  801c94:	c3                   	ret
+  801c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9a:	eb f1                	jmp    801c8d <devpipe_read+0x6e>
+
+00801c9c <pipe>:
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	56                   	push   %esi
+  801ca0:	53                   	push   %ebx
+  801ca1:	83 ec 1c             	sub    $0x1c,%esp
+  801ca4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ca7:	50                   	push   %eax
+  801ca8:	e8 c8 ed ff ff       	call   800a75 <fd_alloc>
+  801cad:	89 c3                	mov    %eax,%ebx
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	85 c0                	test   %eax,%eax
+  801cb4:	0f 88 23 01 00 00    	js     801ddd <pipe+0x141>
+  801cba:	83 ec 04             	sub    $0x4,%esp
+  801cbd:	68 07 04 00 00       	push   $0x407
+  801cc2:	ff 75 f4             	push   -0xc(%ebp)
+  801cc5:	6a 00                	push   $0x0
+  801cc7:	e8 e9 e4 ff ff       	call   8001b5 <sys_page_alloc>
+  801ccc:	89 c3                	mov    %eax,%ebx
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	0f 88 04 01 00 00    	js     801ddd <pipe+0x141>
+  801cd9:	83 ec 0c             	sub    $0xc,%esp
+  801cdc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cdf:	50                   	push   %eax
+  801ce0:	e8 90 ed ff ff       	call   800a75 <fd_alloc>
+  801ce5:	89 c3                	mov    %eax,%ebx
+  801ce7:	83 c4 10             	add    $0x10,%esp
+  801cea:	85 c0                	test   %eax,%eax
+  801cec:	0f 88 db 00 00 00    	js     801dcd <pipe+0x131>
+  801cf2:	83 ec 04             	sub    $0x4,%esp
+  801cf5:	68 07 04 00 00       	push   $0x407
+  801cfa:	ff 75 f0             	push   -0x10(%ebp)
+  801cfd:	6a 00                	push   $0x0
+  801cff:	e8 b1 e4 ff ff       	call   8001b5 <sys_page_alloc>
+  801d04:	89 c3                	mov    %eax,%ebx
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	0f 88 bc 00 00 00    	js     801dcd <pipe+0x131>
+  801d11:	83 ec 0c             	sub    $0xc,%esp
+  801d14:	ff 75 f4             	push   -0xc(%ebp)
+  801d17:	e8 42 ed ff ff       	call   800a5e <fd2data>
+  801d1c:	89 c6                	mov    %eax,%esi
+  801d1e:	83 c4 0c             	add    $0xc,%esp
+  801d21:	68 07 04 00 00       	push   $0x407
+  801d26:	50                   	push   %eax
+  801d27:	6a 00                	push   $0x0
+  801d29:	e8 87 e4 ff ff       	call   8001b5 <sys_page_alloc>
+  801d2e:	89 c3                	mov    %eax,%ebx
+  801d30:	83 c4 10             	add    $0x10,%esp
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	0f 88 82 00 00 00    	js     801dbd <pipe+0x121>
+  801d3b:	83 ec 0c             	sub    $0xc,%esp
+  801d3e:	ff 75 f0             	push   -0x10(%ebp)
+  801d41:	e8 18 ed ff ff       	call   800a5e <fd2data>
+  801d46:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d4d:	50                   	push   %eax
+  801d4e:	6a 00                	push   $0x0
+  801d50:	56                   	push   %esi
+  801d51:	6a 00                	push   $0x0
+  801d53:	e8 a0 e4 ff ff       	call   8001f8 <sys_page_map>
+  801d58:	89 c3                	mov    %eax,%ebx
+  801d5a:	83 c4 20             	add    $0x20,%esp
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	78 4e                	js     801daf <pipe+0x113>
+  801d61:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d66:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d69:	89 02                	mov    %eax,(%edx)
+  801d6b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d6e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d75:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d78:	89 02                	mov    %eax,(%edx)
+  801d7a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d7d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d84:	83 ec 0c             	sub    $0xc,%esp
+  801d87:	ff 75 f4             	push   -0xc(%ebp)
+  801d8a:	e8 bf ec ff ff       	call   800a4e <fd2num>
+  801d8f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d92:	89 01                	mov    %eax,(%ecx)
+  801d94:	83 c4 04             	add    $0x4,%esp
+  801d97:	ff 75 f0             	push   -0x10(%ebp)
+  801d9a:	e8 af ec ff ff       	call   800a4e <fd2num>
+  801d9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801da2:	89 41 04             	mov    %eax,0x4(%ecx)
+  801da5:	83 c4 10             	add    $0x10,%esp
+  801da8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dad:	eb 2e                	jmp    801ddd <pipe+0x141>
+  801daf:	83 ec 08             	sub    $0x8,%esp
+  801db2:	56                   	push   %esi
+  801db3:	6a 00                	push   $0x0
+  801db5:	e8 cd e4 ff ff       	call   800287 <sys_page_unmap>
+  801dba:	83 c4 10             	add    $0x10,%esp
+  801dbd:	83 ec 08             	sub    $0x8,%esp
+  801dc0:	ff 75 f0             	push   -0x10(%ebp)
+  801dc3:	6a 00                	push   $0x0
+  801dc5:	e8 bd e4 ff ff       	call   800287 <sys_page_unmap>
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	83 ec 08             	sub    $0x8,%esp
+  801dd0:	ff 75 f4             	push   -0xc(%ebp)
+  801dd3:	6a 00                	push   $0x0
+  801dd5:	e8 ad e4 ff ff       	call   800287 <sys_page_unmap>
+  801dda:	83 c4 10             	add    $0x10,%esp
+  801ddd:	89 d8                	mov    %ebx,%eax
+  801ddf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de2:	5b                   	pop    %ebx
+  801de3:	5e                   	pop    %esi
+  801de4:	5d                   	pop    %ebp
+  801de5:	c3                   	ret
+
+00801de6 <pipeisclosed>:
+  801de6:	55                   	push   %ebp
+  801de7:	89 e5                	mov    %esp,%ebp
+  801de9:	83 ec 20             	sub    $0x20,%esp
+  801dec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801def:	50                   	push   %eax
+  801df0:	ff 75 08             	push   0x8(%ebp)
+  801df3:	e8 cd ec ff ff       	call   800ac5 <fd_lookup>
+  801df8:	83 c4 10             	add    $0x10,%esp
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	78 18                	js     801e17 <pipeisclosed+0x31>
+  801dff:	83 ec 0c             	sub    $0xc,%esp
+  801e02:	ff 75 f4             	push   -0xc(%ebp)
+  801e05:	e8 54 ec ff ff       	call   800a5e <fd2data>
+  801e0a:	89 c2                	mov    %eax,%edx
+  801e0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e0f:	e8 16 fd ff ff       	call   801b2a <_pipeisclosed>
+  801e14:	83 c4 10             	add    $0x10,%esp
+  801e17:	c9                   	leave
+  801e18:	c3                   	ret
+
+00801e19 <ipcring_init>:
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	53                   	push   %ebx
+  801e1d:	83 ec 08             	sub    $0x8,%esp
+  801e20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e23:	6a 60                	push   $0x60
+  801e25:	6a 00                	push   $0x0
+  801e27:	53                   	push   %ebx
+  801e28:	e8 cd 0c 00 00       	call   802afa <memset>
+  801e2d:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e32:	8b 40 48             	mov    0x48(%eax),%eax
+  801e35:	89 03                	mov    %eax,(%ebx)
+  801e37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e3a:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e3d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e40:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e43:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e46:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e49:	83 c4 10             	add    $0x10,%esp
+  801e4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <ipcring_req_slot>:
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e57:	8b 50 10             	mov    0x10(%eax),%edx
+  801e5a:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e5d:	29 ca                	sub    %ecx,%edx
+  801e5f:	83 fa 07             	cmp    $0x7,%edx
+  801e62:	77 0c                	ja     801e70 <ipcring_req_slot+0x1f>
+  801e64:	8b 50 10             	mov    0x10(%eax),%edx
+  801e67:	83 e2 07             	and    $0x7,%edx
+  801e6a:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e6e:	5d                   	pop    %ebp
+  801e6f:	c3                   	ret
+  801e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e75:	eb f7                	jmp    801e6e <ipcring_req_slot+0x1d>
+
+00801e77 <ipcring_req_push>:
+  801e77:	55                   	push   %ebp
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	83 ec 08             	sub    $0x8,%esp
+  801e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e80:	8b 42 10             	mov    0x10(%edx),%eax
+  801e83:	83 c0 01             	add    $0x1,%eax
+  801e86:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8f:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e93:	85 c0                	test   %eax,%eax
+  801e95:	75 02                	jne    801e99 <ipcring_req_push+0x22>
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+  801e99:	6a 00                	push   $0x0
+  801e9b:	68 00 00 80 ee       	push   $0xee800000
+  801ea0:	ff 72 08             	push   0x8(%edx)
+  801ea3:	ff 72 04             	push   0x4(%edx)
+  801ea6:	e8 42 e6 ff ff       	call   8004ed <sys_ipc_send>
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	eb e7                	jmp    801e97 <ipcring_req_push+0x20>
+
+00801eb0 <ipcring_rsp_wait>:
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	53                   	push   %ebx
+  801eb4:	83 ec 04             	sub    $0x4,%esp
+  801eb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801eba:	8b 53 18             	mov    0x18(%ebx),%edx
+  801ebd:	8b 43 10             	mov    0x10(%ebx),%eax
+  801ec0:	39 c2                	cmp    %eax,%edx
+  801ec2:	74 3c                	je     801f00 <ipcring_rsp_wait+0x50>
+  801ec4:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ec7:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eca:	39 c2                	cmp    %eax,%edx
+  801ecc:	75 23                	jne    801ef1 <ipcring_rsp_wait+0x41>
+  801ece:	83 ec 08             	sub    $0x8,%esp
+  801ed1:	6a 00                	push   $0x0
+  801ed3:	6a 00                	push   $0x0
+  801ed5:	6a 00                	push   $0x0
+  801ed7:	6a 00                	push   $0x0
+  801ed9:	ff 73 0c             	push   0xc(%ebx)
+  801edc:	ff 73 04             	push   0x4(%ebx)
+  801edf:	e8 43 0f 00 00       	call   802e27 <ipc_call>
+  801ee4:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ee7:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eea:	83 c4 20             	add    $0x20,%esp
+  801eed:	39 c2                	cmp    %eax,%edx
+  801eef:	74 dd                	je     801ece <ipcring_rsp_wait+0x1e>
+  801ef1:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ef4:	83 e0 07             	and    $0x7,%eax
+  801ef7:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801efb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801efe:	c9                   	leave
+  801eff:	c3                   	ret
+  801f00:	68 58 33 80 00       	push   $0x803358
+  801f05:	68 09 33 80 00       	push   $0x803309
+  801f0a:	6a 3b                	push   $0x3b
+  801f0c:	68 79 33 80 00       	push   $0x803379
+  801f11:	e8 97 02 00 00       	call   8021ad <_panic>
+
+00801f16 <ipcring_rsp_pop>:
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+  801f19:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1c:	8b 42 18             	mov    0x18(%edx),%eax
+  801f1f:	83 c0 01             	add    $0x1,%eax
+  801f22:	89 42 18             	mov    %eax,0x18(%edx)
+  801f25:	5d                   	pop    %ebp
+  801f26:	c3                   	ret
+
+00801f27 <ipcring_server_init>:
+  801f27:	55                   	push   %ebp
+  801f28:	89 e5                	mov    %esp,%ebp
+  801f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f30:	89 10                	mov    %edx,(%eax)
+  801f32:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f35:	89 50 04             	mov    %edx,0x4(%eax)
+  801f38:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801f3f:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f46:	5d                   	pop    %ebp
+  801f47:	c3                   	ret
+
+00801f48 <ipcring_req_avail>:
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f4e:	8b 02                	mov    (%edx),%eax
+  801f50:	8b 40 10             	mov    0x10(%eax),%eax
+  801f53:	2b 42 08             	sub    0x8(%edx),%eax
+  801f56:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f5b:	39 d0                	cmp    %edx,%eax
+  801f5d:	0f 47 c2             	cmova  %edx,%eax
+  801f60:	5d                   	pop    %ebp
+  801f61:	c3                   	ret
+
+00801f62 <ipcring_req_peek>:
+  801f62:	55                   	push   %ebp
+  801f63:	89 e5                	mov    %esp,%ebp
+  801f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f68:	8b 42 08             	mov    0x8(%edx),%eax
+  801f6b:	83 e0 07             	and    $0x7,%eax
+  801f6e:	8b 12                	mov    (%edx),%edx
+  801f70:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f74:	5d                   	pop    %ebp
+  801f75:	c3                   	ret
+
+00801f76 <ipcring_rsp_push>:
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	83 ec 08             	sub    $0x8,%esp
+  801f7c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f7f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f82:	83 c0 01             	add    $0x1,%eax
+  801f85:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f88:	8b 11                	mov    (%ecx),%edx
+  801f8a:	83 c2 14             	add    $0x14,%edx
+  801f8d:	f0 87 02             	lock xchg %eax,(%edx)
+  801f90:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f94:	75 02                	jne    801f98 <ipcring_rsp_push+0x22>
+  801f96:	c9                   	leave
+  801f97:	c3                   	ret
+  801f98:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f9f:	6a 00                	push   $0x0
+  801fa1:	68 00 00 80 ee       	push   $0xee800000
+  801fa6:	6a 00                	push   $0x0
+  801fa8:	ff 71 04             	push   0x4(%ecx)
+  801fab:	e8 60 e4 ff ff       	call   800410 <sys_ipc_try_send>
+  801fb0:	83 c4 10             	add    $0x10,%esp
+  801fb3:	eb e1                	jmp    801f96 <ipcring_rsp_push+0x20>
+
+00801fb5 <ipcring_client_wait>:
+  801fb5:	55                   	push   %ebp
+  801fb6:	89 e5                	mov    %esp,%ebp
+  801fb8:	83 ec 08             	sub    $0x8,%esp
+  801fbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbe:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801fc5:	8b 10                	mov    (%eax),%edx
+  801fc7:	8b 52 18             	mov    0x18(%edx),%edx
+  801fca:	3b 50 08             	cmp    0x8(%eax),%edx
+  801fcd:	75 02                	jne    801fd1 <ipcring_client_wait+0x1c>
+  801fcf:	c9                   	leave
+  801fd0:	c3                   	ret
+  801fd1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801fd8:	6a 00                	push   $0x0
+  801fda:	68 00 00 80 ee       	push   $0xee800000
+  801fdf:	6a 00                	push   $0x0
+  801fe1:	ff 70 04             	push   0x4(%eax)
+  801fe4:	e8 27 e4 ff ff       	call   800410 <sys_ipc_try_send>
+  801fe9:	83 c4 10             	add    $0x10,%esp
+  801fec:	eb e1                	jmp    801fcf <ipcring_client_wait+0x1a>
+
+00801fee <ipcring_server_sleep>:
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	53                   	push   %ebx
+  801ff2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ff5:	8b 01                	mov    (%ecx),%eax
+  801ff7:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801ffa:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fff:	f0 87 02             	lock xchg %eax,(%edx)
+  802002:	8b 11                	mov    (%ecx),%edx
+  802004:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802007:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200c:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80200f:	74 0e                	je     80201f <ipcring_server_sleep+0x31>
+  802011:	b8 00 00 00 00       	mov    $0x0,%eax
+  802016:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+00802024 <devcons_close>:
+  802024:	b8 00 00 00 00       	mov    $0x0,%eax
+  802029:	c3                   	ret
+
+0080202a <devcons_stat>:
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	83 ec 10             	sub    $0x10,%esp
+  802030:	68 87 33 80 00       	push   $0x803387
+  802035:	ff 75 0c             	push   0xc(%ebp)
+  802038:	e8 42 09 00 00       	call   80297f <strcpy>
+  80203d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802042:	c9                   	leave
+  802043:	c3                   	ret
+
+00802044 <devcons_write>:
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	57                   	push   %edi
+  802048:	56                   	push   %esi
+  802049:	53                   	push   %ebx
+  80204a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802050:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802053:	85 ff                	test   %edi,%edi
+  802055:	74 51                	je     8020a8 <devcons_write+0x64>
+  802057:	be 00 00 00 00       	mov    $0x0,%esi
+  80205c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802061:	89 fb                	mov    %edi,%ebx
+  802063:	29 c3                	sub    %eax,%ebx
+  802065:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80206a:	39 d3                	cmp    %edx,%ebx
+  80206c:	0f 47 da             	cmova  %edx,%ebx
+  80206f:	83 ec 04             	sub    $0x4,%esp
+  802072:	53                   	push   %ebx
+  802073:	03 45 0c             	add    0xc(%ebp),%eax
+  802076:	50                   	push   %eax
+  802077:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80207d:	50                   	push   %eax
+  80207e:	e8 ac 0a 00 00       	call   802b2f <memmove>
+  802083:	83 c4 08             	add    $0x8,%esp
+  802086:	53                   	push   %ebx
+  802087:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80208d:	50                   	push   %eax
+  80208e:	e8 3a e0 ff ff       	call   8000cd <sys_cputs>
+  802093:	01 de                	add    %ebx,%esi
+  802095:	89 f0                	mov    %esi,%eax
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	39 fe                	cmp    %edi,%esi
+  80209c:	72 c3                	jb     802061 <devcons_write+0x1d>
+  80209e:	89 f0                	mov    %esi,%eax
+  8020a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a3:	5b                   	pop    %ebx
+  8020a4:	5e                   	pop    %esi
+  8020a5:	5f                   	pop    %edi
+  8020a6:	5d                   	pop    %ebp
+  8020a7:	c3                   	ret
+  8020a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ad:	eb ef                	jmp    80209e <devcons_write+0x5a>
+
+008020af <devcons_read>:
+  8020af:	55                   	push   %ebp
+  8020b0:	89 e5                	mov    %esp,%ebp
+  8020b2:	83 ec 08             	sub    $0x8,%esp
+  8020b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ba:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020be:	75 07                	jne    8020c7 <devcons_read+0x18>
+  8020c0:	eb 1f                	jmp    8020e1 <devcons_read+0x32>
+  8020c2:	e8 a3 e0 ff ff       	call   80016a <sys_yield>
+  8020c7:	e8 1f e0 ff ff       	call   8000eb <sys_cgetc>
+  8020cc:	85 c0                	test   %eax,%eax
+  8020ce:	74 f2                	je     8020c2 <devcons_read+0x13>
+  8020d0:	78 0f                	js     8020e1 <devcons_read+0x32>
+  8020d2:	83 f8 04             	cmp    $0x4,%eax
+  8020d5:	74 0c                	je     8020e3 <devcons_read+0x34>
+  8020d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020da:	88 02                	mov    %al,(%edx)
+  8020dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e1:	c9                   	leave
+  8020e2:	c3                   	ret
+  8020e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e8:	eb f7                	jmp    8020e1 <devcons_read+0x32>
+
+008020ea <cputchar>:
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	83 ec 20             	sub    $0x20,%esp
+  8020f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f3:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020f6:	6a 01                	push   $0x1
+  8020f8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020fb:	50                   	push   %eax
+  8020fc:	e8 cc df ff ff       	call   8000cd <sys_cputs>
+  802101:	83 c4 10             	add    $0x10,%esp
+  802104:	c9                   	leave
+  802105:	c3                   	ret
+
+00802106 <getchar>:
+  802106:	55                   	push   %ebp
+  802107:	89 e5                	mov    %esp,%ebp
+  802109:	83 ec 1c             	sub    $0x1c,%esp
+  80210c:	6a 01                	push   $0x1
+  80210e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802111:	50                   	push   %eax
+  802112:	6a 00                	push   $0x0
+  802114:	e8 0e ec ff ff       	call   800d27 <read>
+  802119:	83 c4 10             	add    $0x10,%esp
+  80211c:	85 c0                	test   %eax,%eax
+  80211e:	78 06                	js     802126 <getchar+0x20>
+  802120:	74 06                	je     802128 <getchar+0x22>
+  802122:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802126:	c9                   	leave
+  802127:	c3                   	ret
+  802128:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80212d:	eb f7                	jmp    802126 <getchar+0x20>
+
+0080212f <iscons>:
+  80212f:	55                   	push   %ebp
+  802130:	89 e5                	mov    %esp,%ebp
+  802132:	83 ec 20             	sub    $0x20,%esp
+  802135:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802138:	50                   	push   %eax
+  802139:	ff 75 08             	push   0x8(%ebp)
+  80213c:	e8 84 e9 ff ff       	call   800ac5 <fd_lookup>
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	85 c0                	test   %eax,%eax
+  802146:	78 11                	js     802159 <iscons+0x2a>
+  802148:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214b:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802151:	39 10                	cmp    %edx,(%eax)
+  802153:	0f 94 c0             	sete   %al
+  802156:	0f b6 c0             	movzbl %al,%eax
+  802159:	c9                   	leave
+  80215a:	c3                   	ret
+
+0080215b <opencons>:
+  80215b:	55                   	push   %ebp
+  80215c:	89 e5                	mov    %esp,%ebp
+  80215e:	83 ec 24             	sub    $0x24,%esp
+  802161:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802164:	50                   	push   %eax
+  802165:	e8 0b e9 ff ff       	call   800a75 <fd_alloc>
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	78 3a                	js     8021ab <opencons+0x50>
+  802171:	83 ec 04             	sub    $0x4,%esp
+  802174:	68 07 04 00 00       	push   $0x407
+  802179:	ff 75 f4             	push   -0xc(%ebp)
+  80217c:	6a 00                	push   $0x0
+  80217e:	e8 32 e0 ff ff       	call   8001b5 <sys_page_alloc>
+  802183:	83 c4 10             	add    $0x10,%esp
+  802186:	85 c0                	test   %eax,%eax
+  802188:	78 21                	js     8021ab <opencons+0x50>
+  80218a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802193:	89 10                	mov    %edx,(%eax)
+  802195:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802198:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80219f:	83 ec 0c             	sub    $0xc,%esp
+  8021a2:	50                   	push   %eax
+  8021a3:	e8 a6 e8 ff ff       	call   800a4e <fd2num>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	c9                   	leave
+  8021ac:	c3                   	ret
+
+008021ad <_panic>:
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	56                   	push   %esi
+  8021b1:	53                   	push   %ebx
+  8021b2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8021b5:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8021bb:	e8 8b df ff ff       	call   80014b <sys_getenvid>
+  8021c0:	83 ec 0c             	sub    $0xc,%esp
+  8021c3:	ff 75 0c             	push   0xc(%ebp)
+  8021c6:	ff 75 08             	push   0x8(%ebp)
+  8021c9:	56                   	push   %esi
+  8021ca:	50                   	push   %eax
+  8021cb:	68 94 33 80 00       	push   $0x803394
+  8021d0:	e8 b3 00 00 00       	call   802288 <cprintf>
+  8021d5:	83 c4 18             	add    $0x18,%esp
+  8021d8:	53                   	push   %ebx
+  8021d9:	ff 75 10             	push   0x10(%ebp)
+  8021dc:	e8 56 00 00 00       	call   802237 <vcprintf>
+  8021e1:	c7 04 24 4e 33 80 00 	movl   $0x80334e,(%esp)
+  8021e8:	e8 9b 00 00 00       	call   802288 <cprintf>
+  8021ed:	83 c4 10             	add    $0x10,%esp
+  8021f0:	cc                   	int3
+  8021f1:	eb fd                	jmp    8021f0 <_panic+0x43>
+
+008021f3 <putch>:
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	53                   	push   %ebx
+  8021f7:	83 ec 04             	sub    $0x4,%esp
+  8021fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021fd:	8b 13                	mov    (%ebx),%edx
+  8021ff:	8d 42 01             	lea    0x1(%edx),%eax
+  802202:	89 03                	mov    %eax,(%ebx)
+  802204:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802207:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80220b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802210:	74 09                	je     80221b <putch+0x28>
+  802212:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  802216:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802219:	c9                   	leave
+  80221a:	c3                   	ret
+  80221b:	83 ec 08             	sub    $0x8,%esp
+  80221e:	68 ff 00 00 00       	push   $0xff
+  802223:	8d 43 08             	lea    0x8(%ebx),%eax
+  802226:	50                   	push   %eax
+  802227:	e8 a1 de ff ff       	call   8000cd <sys_cputs>
+  80222c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802232:	83 c4 10             	add    $0x10,%esp
+  802235:	eb db                	jmp    802212 <putch+0x1f>
+
+00802237 <vcprintf>:
+  802237:	55                   	push   %ebp
+  802238:	89 e5                	mov    %esp,%ebp
+  80223a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802240:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802247:	00 00 00 
+  80224a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802251:	00 00 00 
+  802254:	ff 75 0c             	push   0xc(%ebp)
+  802257:	ff 75 08             	push   0x8(%ebp)
+  80225a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802260:	50                   	push   %eax
+  802261:	68 f3 21 80 00       	push   $0x8021f3
+  802266:	e8 1c 01 00 00       	call   802387 <vprintfmt>
+  80226b:	83 c4 08             	add    $0x8,%esp
+  80226e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802274:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80227a:	50                   	push   %eax
+  80227b:	e8 4d de ff ff       	call   8000cd <sys_cputs>
+  802280:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802286:	c9                   	leave
+  802287:	c3                   	ret
+
+00802288 <cprintf>:
+  802288:	55                   	push   %ebp
+  802289:	89 e5                	mov    %esp,%ebp
+  80228b:	83 ec 10             	sub    $0x10,%esp
+  80228e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802291:	50                   	push   %eax
+  802292:	ff 75 08             	push   0x8(%ebp)
+  802295:	e8 9d ff ff ff       	call   802237 <vcprintf>
+  80229a:	c9                   	leave
+  80229b:	c3                   	ret
+
+0080229c <printnum>:
+  80229c:	55                   	push   %ebp
+  80229d:	89 e5                	mov    %esp,%ebp
+  80229f:	57                   	push   %edi
+  8022a0:	56                   	push   %esi
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 1c             	sub    $0x1c,%esp
+  8022a5:	89 c3                	mov    %eax,%ebx
+  8022a7:	89 d6                	mov    %edx,%esi
+  8022a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022af:	89 d1                	mov    %edx,%ecx
+  8022b1:	89 c2                	mov    %eax,%edx
+  8022b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8022b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8022b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8022bf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8022c6:	39 c2                	cmp    %eax,%edx
+  8022c8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8022cb:	73 4b                	jae    802318 <printnum+0x7c>
+  8022cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022d0:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8022d3:	85 ff                	test   %edi,%edi
+  8022d5:	7e 11                	jle    8022e8 <printnum+0x4c>
+  8022d7:	83 ec 08             	sub    $0x8,%esp
+  8022da:	56                   	push   %esi
+  8022db:	ff 75 18             	push   0x18(%ebp)
+  8022de:	ff d3                	call   *%ebx
+  8022e0:	83 c4 10             	add    $0x10,%esp
+  8022e3:	83 ef 01             	sub    $0x1,%edi
+  8022e6:	75 ef                	jne    8022d7 <printnum+0x3b>
+  8022e8:	83 ec 08             	sub    $0x8,%esp
+  8022eb:	56                   	push   %esi
+  8022ec:	83 ec 04             	sub    $0x4,%esp
+  8022ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8022f2:	ff 75 e0             	push   -0x20(%ebp)
+  8022f5:	ff 75 dc             	push   -0x24(%ebp)
+  8022f8:	ff 75 d8             	push   -0x28(%ebp)
+  8022fb:	e8 13 0e 00 00       	call   803113 <__umoddi3>
+  802300:	83 c4 14             	add    $0x14,%esp
+  802303:	0f be 80 b7 33 80 00 	movsbl 0x8033b7(%eax),%eax
+  80230a:	50                   	push   %eax
+  80230b:	ff d3                	call   *%ebx
+  80230d:	83 c4 10             	add    $0x10,%esp
+  802310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802313:	5b                   	pop    %ebx
+  802314:	5e                   	pop    %esi
+  802315:	5f                   	pop    %edi
+  802316:	5d                   	pop    %ebp
+  802317:	c3                   	ret
+  802318:	83 ec 0c             	sub    $0xc,%esp
+  80231b:	ff 75 18             	push   0x18(%ebp)
+  80231e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802321:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802324:	52                   	push   %edx
+  802325:	50                   	push   %eax
+  802326:	83 ec 08             	sub    $0x8,%esp
+  802329:	ff 75 e4             	push   -0x1c(%ebp)
+  80232c:	ff 75 e0             	push   -0x20(%ebp)
+  80232f:	ff 75 dc             	push   -0x24(%ebp)
+  802332:	ff 75 d8             	push   -0x28(%ebp)
+  802335:	e8 bb 0d 00 00       	call   8030f5 <__udivdi3>
+  80233a:	83 c4 18             	add    $0x18,%esp
+  80233d:	52                   	push   %edx
+  80233e:	50                   	push   %eax
+  80233f:	89 f2                	mov    %esi,%edx
+  802341:	89 d8                	mov    %ebx,%eax
+  802343:	e8 54 ff ff ff       	call   80229c <printnum>
+  802348:	83 c4 20             	add    $0x20,%esp
+  80234b:	eb 9b                	jmp    8022e8 <printnum+0x4c>
+
+0080234d <sprintputch>:
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802353:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802357:	8b 10                	mov    (%eax),%edx
+  802359:	3b 50 04             	cmp    0x4(%eax),%edx
+  80235c:	73 0a                	jae    802368 <sprintputch+0x1b>
+  80235e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802361:	89 08                	mov    %ecx,(%eax)
+  802363:	8b 45 08             	mov    0x8(%ebp),%eax
+  802366:	88 02                	mov    %al,(%edx)
+  802368:	5d                   	pop    %ebp
+  802369:	c3                   	ret
+
+0080236a <printfmt>:
+  80236a:	55                   	push   %ebp
+  80236b:	89 e5                	mov    %esp,%ebp
+  80236d:	83 ec 08             	sub    $0x8,%esp
+  802370:	8d 45 14             	lea    0x14(%ebp),%eax
+  802373:	50                   	push   %eax
+  802374:	ff 75 10             	push   0x10(%ebp)
+  802377:	ff 75 0c             	push   0xc(%ebp)
+  80237a:	ff 75 08             	push   0x8(%ebp)
+  80237d:	e8 05 00 00 00       	call   802387 <vprintfmt>
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	c9                   	leave
+  802386:	c3                   	ret
+
+00802387 <vprintfmt>:
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	57                   	push   %edi
+  80238b:	56                   	push   %esi
+  80238c:	53                   	push   %ebx
+  80238d:	83 ec 2c             	sub    $0x2c,%esp
+  802390:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802393:	89 df                	mov    %ebx,%edi
+  802395:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802398:	8b 45 10             	mov    0x10(%ebp),%eax
+  80239b:	8d 70 01             	lea    0x1(%eax),%esi
+  80239e:	0f b6 00             	movzbl (%eax),%eax
+  8023a1:	83 f8 25             	cmp    $0x25,%eax
+  8023a4:	74 1e                	je     8023c4 <vprintfmt+0x3d>
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	0f 84 15 05 00 00    	je     8028c3 <vprintfmt+0x53c>
+  8023ae:	83 ec 08             	sub    $0x8,%esp
+  8023b1:	53                   	push   %ebx
+  8023b2:	50                   	push   %eax
+  8023b3:	ff d7                	call   *%edi
+  8023b5:	83 c6 01             	add    $0x1,%esi
+  8023b8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8023bc:	83 c4 10             	add    $0x10,%esp
+  8023bf:	83 f8 25             	cmp    $0x25,%eax
+  8023c2:	75 e2                	jne    8023a6 <vprintfmt+0x1f>
+  8023c4:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8023c8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8023cf:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8023d6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8023dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8023e5:	8d 56 01             	lea    0x1(%esi),%edx
+  8023e8:	0f b6 0e             	movzbl (%esi),%ecx
+  8023eb:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023ee:	3c 55                	cmp    $0x55,%al
+  8023f0:	0f 87 3b 04 00 00    	ja     802831 <vprintfmt+0x4aa>
+  8023f6:	0f b6 c0             	movzbl %al,%eax
+  8023f9:	ff 24 85 00 35 80 00 	jmp    *0x803500(,%eax,4)
+  802400:	89 75 10             	mov    %esi,0x10(%ebp)
+  802403:	eb 93                	jmp    802398 <vprintfmt+0x11>
+  802405:	89 d6                	mov    %edx,%esi
+  802407:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80240b:	eb d8                	jmp    8023e5 <vprintfmt+0x5e>
+  80240d:	89 d6                	mov    %edx,%esi
+  80240f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802413:	eb d0                	jmp    8023e5 <vprintfmt+0x5e>
+  802415:	0f b6 c9             	movzbl %cl,%ecx
+  802418:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80241b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80241e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  802422:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802425:	83 f9 09             	cmp    $0x9,%ecx
+  802428:	77 6f                	ja     802499 <vprintfmt+0x112>
+  80242a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80242d:	83 c2 01             	add    $0x1,%edx
+  802430:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802433:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  802437:	0f be 02             	movsbl (%edx),%eax
+  80243a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80243d:	83 fe 09             	cmp    $0x9,%esi
+  802440:	76 eb                	jbe    80242d <vprintfmt+0xa6>
+  802442:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802445:	89 d6                	mov    %edx,%esi
+  802447:	eb 13                	jmp    80245c <vprintfmt+0xd5>
+  802449:	8b 45 14             	mov    0x14(%ebp),%eax
+  80244c:	8b 00                	mov    (%eax),%eax
+  80244e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802451:	8b 45 14             	mov    0x14(%ebp),%eax
+  802454:	8d 40 04             	lea    0x4(%eax),%eax
+  802457:	89 45 14             	mov    %eax,0x14(%ebp)
+  80245a:	89 d6                	mov    %edx,%esi
+  80245c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802460:	79 83                	jns    8023e5 <vprintfmt+0x5e>
+  802462:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802465:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802468:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80246f:	e9 71 ff ff ff       	jmp    8023e5 <vprintfmt+0x5e>
+  802474:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802477:	85 c9                	test   %ecx,%ecx
+  802479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247e:	0f 49 c1             	cmovns %ecx,%eax
+  802481:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802484:	89 d6                	mov    %edx,%esi
+  802486:	e9 5a ff ff ff       	jmp    8023e5 <vprintfmt+0x5e>
+  80248b:	89 d6                	mov    %edx,%esi
+  80248d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  802494:	e9 4c ff ff ff       	jmp    8023e5 <vprintfmt+0x5e>
+  802499:	89 d6                	mov    %edx,%esi
+  80249b:	eb bf                	jmp    80245c <vprintfmt+0xd5>
+  80249d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8024a1:	89 d6                	mov    %edx,%esi
+  8024a3:	e9 3d ff ff ff       	jmp    8023e5 <vprintfmt+0x5e>
+  8024a8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ae:	8d 70 04             	lea    0x4(%eax),%esi
+  8024b1:	83 ec 08             	sub    $0x8,%esp
+  8024b4:	53                   	push   %ebx
+  8024b5:	ff 30                	push   (%eax)
+  8024b7:	ff d7                	call   *%edi
+  8024b9:	83 c4 10             	add    $0x10,%esp
+  8024bc:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024bf:	e9 d4 fe ff ff       	jmp    802398 <vprintfmt+0x11>
+  8024c4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ca:	8d 70 04             	lea    0x4(%eax),%esi
+  8024cd:	8b 10                	mov    (%eax),%edx
+  8024cf:	89 d0                	mov    %edx,%eax
+  8024d1:	f7 d8                	neg    %eax
+  8024d3:	0f 48 c2             	cmovs  %edx,%eax
+  8024d6:	83 f8 12             	cmp    $0x12,%eax
+  8024d9:	7f 23                	jg     8024fe <vprintfmt+0x177>
+  8024db:	8b 14 85 60 36 80 00 	mov    0x803660(,%eax,4),%edx
+  8024e2:	85 d2                	test   %edx,%edx
+  8024e4:	74 18                	je     8024fe <vprintfmt+0x177>
+  8024e6:	52                   	push   %edx
+  8024e7:	68 1b 33 80 00       	push   $0x80331b
+  8024ec:	53                   	push   %ebx
+  8024ed:	57                   	push   %edi
+  8024ee:	e8 77 fe ff ff       	call   80236a <printfmt>
+  8024f3:	83 c4 10             	add    $0x10,%esp
+  8024f6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024f9:	e9 9a fe ff ff       	jmp    802398 <vprintfmt+0x11>
+  8024fe:	50                   	push   %eax
+  8024ff:	68 cf 33 80 00       	push   $0x8033cf
+  802504:	53                   	push   %ebx
+  802505:	57                   	push   %edi
+  802506:	e8 5f fe ff ff       	call   80236a <printfmt>
+  80250b:	83 c4 10             	add    $0x10,%esp
+  80250e:	89 75 14             	mov    %esi,0x14(%ebp)
+  802511:	e9 82 fe ff ff       	jmp    802398 <vprintfmt+0x11>
+  802516:	89 55 10             	mov    %edx,0x10(%ebp)
+  802519:	8b 45 14             	mov    0x14(%ebp),%eax
+  80251c:	83 c0 04             	add    $0x4,%eax
+  80251f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802522:	8b 45 14             	mov    0x14(%ebp),%eax
+  802525:	8b 00                	mov    (%eax),%eax
+  802527:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80252a:	85 c0                	test   %eax,%eax
+  80252c:	0f 84 61 03 00 00    	je     802893 <vprintfmt+0x50c>
+  802532:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802536:	7e 06                	jle    80253e <vprintfmt+0x1b7>
+  802538:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80253c:	75 29                	jne    802567 <vprintfmt+0x1e0>
+  80253e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802541:	8d 70 01             	lea    0x1(%eax),%esi
+  802544:	0f b6 00             	movzbl (%eax),%eax
+  802547:	0f be d0             	movsbl %al,%edx
+  80254a:	85 d2                	test   %edx,%edx
+  80254c:	0f 84 bb 00 00 00    	je     80260d <vprintfmt+0x286>
+  802552:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802555:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802558:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80255b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80255e:	eb 7a                	jmp    8025da <vprintfmt+0x253>
+  802560:	c7 45 d0 c8 33 80 00 	movl   $0x8033c8,-0x30(%ebp)
+  802567:	83 ec 08             	sub    $0x8,%esp
+  80256a:	ff 75 d4             	push   -0x2c(%ebp)
+  80256d:	ff 75 d0             	push   -0x30(%ebp)
+  802570:	e8 e0 03 00 00       	call   802955 <strnlen>
+  802575:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802578:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80257b:	83 c4 10             	add    $0x10,%esp
+  80257e:	85 d2                	test   %edx,%edx
+  802580:	0f 8e d6 02 00 00    	jle    80285c <vprintfmt+0x4d5>
+  802586:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80258a:	83 ec 08             	sub    $0x8,%esp
+  80258d:	53                   	push   %ebx
+  80258e:	56                   	push   %esi
+  80258f:	ff d7                	call   *%edi
+  802591:	83 c4 10             	add    $0x10,%esp
+  802594:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802598:	75 f0                	jne    80258a <vprintfmt+0x203>
+  80259a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80259d:	8d 70 01             	lea    0x1(%eax),%esi
+  8025a0:	0f b6 00             	movzbl (%eax),%eax
+  8025a3:	0f be d0             	movsbl %al,%edx
+  8025a6:	85 d2                	test   %edx,%edx
+  8025a8:	0f 84 da 02 00 00    	je     802888 <vprintfmt+0x501>
+  8025ae:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8025b1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8025b4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8025b7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8025ba:	eb 1e                	jmp    8025da <vprintfmt+0x253>
+  8025bc:	83 ec 08             	sub    $0x8,%esp
+  8025bf:	ff 75 0c             	push   0xc(%ebp)
+  8025c2:	52                   	push   %edx
+  8025c3:	ff 55 08             	call   *0x8(%ebp)
+  8025c6:	83 c4 10             	add    $0x10,%esp
+  8025c9:	83 eb 01             	sub    $0x1,%ebx
+  8025cc:	83 c6 01             	add    $0x1,%esi
+  8025cf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8025d3:	0f be d0             	movsbl %al,%edx
+  8025d6:	85 d2                	test   %edx,%edx
+  8025d8:	74 2a                	je     802604 <vprintfmt+0x27d>
+  8025da:	85 ff                	test   %edi,%edi
+  8025dc:	78 05                	js     8025e3 <vprintfmt+0x25c>
+  8025de:	83 ef 01             	sub    $0x1,%edi
+  8025e1:	78 59                	js     80263c <vprintfmt+0x2b5>
+  8025e3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8025e7:	74 d3                	je     8025bc <vprintfmt+0x235>
+  8025e9:	0f be c0             	movsbl %al,%eax
+  8025ec:	83 e8 20             	sub    $0x20,%eax
+  8025ef:	83 f8 5e             	cmp    $0x5e,%eax
+  8025f2:	76 c8                	jbe    8025bc <vprintfmt+0x235>
+  8025f4:	83 ec 08             	sub    $0x8,%esp
+  8025f7:	ff 75 0c             	push   0xc(%ebp)
+  8025fa:	6a 3f                	push   $0x3f
+  8025fc:	ff 55 08             	call   *0x8(%ebp)
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	eb c5                	jmp    8025c9 <vprintfmt+0x242>
+  802604:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802607:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80260a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80260d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802610:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802614:	7e 1b                	jle    802631 <vprintfmt+0x2aa>
+  802616:	83 ec 08             	sub    $0x8,%esp
+  802619:	53                   	push   %ebx
+  80261a:	6a 20                	push   $0x20
+  80261c:	ff d7                	call   *%edi
+  80261e:	83 c4 10             	add    $0x10,%esp
+  802621:	83 ee 01             	sub    $0x1,%esi
+  802624:	75 f0                	jne    802616 <vprintfmt+0x28f>
+  802626:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802629:	89 45 14             	mov    %eax,0x14(%ebp)
+  80262c:	e9 67 fd ff ff       	jmp    802398 <vprintfmt+0x11>
+  802631:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802634:	89 45 14             	mov    %eax,0x14(%ebp)
+  802637:	e9 5c fd ff ff       	jmp    802398 <vprintfmt+0x11>
+  80263c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80263f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802642:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802645:	eb c6                	jmp    80260d <vprintfmt+0x286>
+  802647:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80264a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80264d:	83 f9 01             	cmp    $0x1,%ecx
+  802650:	7f 1f                	jg     802671 <vprintfmt+0x2ea>
+  802652:	85 c9                	test   %ecx,%ecx
+  802654:	74 67                	je     8026bd <vprintfmt+0x336>
+  802656:	8b 45 14             	mov    0x14(%ebp),%eax
+  802659:	8b 30                	mov    (%eax),%esi
+  80265b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80265e:	89 f0                	mov    %esi,%eax
+  802660:	c1 f8 1f             	sar    $0x1f,%eax
+  802663:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802666:	8b 45 14             	mov    0x14(%ebp),%eax
+  802669:	8d 40 04             	lea    0x4(%eax),%eax
+  80266c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80266f:	eb 17                	jmp    802688 <vprintfmt+0x301>
+  802671:	8b 45 14             	mov    0x14(%ebp),%eax
+  802674:	8b 50 04             	mov    0x4(%eax),%edx
+  802677:	8b 00                	mov    (%eax),%eax
+  802679:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80267c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80267f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802682:	8d 40 08             	lea    0x8(%eax),%eax
+  802685:	89 45 14             	mov    %eax,0x14(%ebp)
+  802688:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80268b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80268e:	be 0a 00 00 00       	mov    $0xa,%esi
+  802693:	85 c9                	test   %ecx,%ecx
+  802695:	0f 89 12 01 00 00    	jns    8027ad <vprintfmt+0x426>
+  80269b:	83 ec 08             	sub    $0x8,%esp
+  80269e:	53                   	push   %ebx
+  80269f:	6a 2d                	push   $0x2d
+  8026a1:	ff d7                	call   *%edi
+  8026a3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8026a6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8026a9:	f7 da                	neg    %edx
+  8026ab:	83 d1 00             	adc    $0x0,%ecx
+  8026ae:	f7 d9                	neg    %ecx
+  8026b0:	83 c4 10             	add    $0x10,%esp
+  8026b3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026b8:	e9 f0 00 00 00       	jmp    8027ad <vprintfmt+0x426>
+  8026bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026c0:	8b 30                	mov    (%eax),%esi
+  8026c2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8026c5:	89 f0                	mov    %esi,%eax
+  8026c7:	c1 f8 1f             	sar    $0x1f,%eax
+  8026ca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8026cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8026d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026d6:	eb b0                	jmp    802688 <vprintfmt+0x301>
+  8026d8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026db:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026de:	83 f9 01             	cmp    $0x1,%ecx
+  8026e1:	7f 1e                	jg     802701 <vprintfmt+0x37a>
+  8026e3:	85 c9                	test   %ecx,%ecx
+  8026e5:	74 32                	je     802719 <vprintfmt+0x392>
+  8026e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026ea:	8b 10                	mov    (%eax),%edx
+  8026ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8026f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026f7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026fc:	e9 ac 00 00 00       	jmp    8027ad <vprintfmt+0x426>
+  802701:	8b 45 14             	mov    0x14(%ebp),%eax
+  802704:	8b 10                	mov    (%eax),%edx
+  802706:	8b 48 04             	mov    0x4(%eax),%ecx
+  802709:	8d 40 08             	lea    0x8(%eax),%eax
+  80270c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80270f:	be 0a 00 00 00       	mov    $0xa,%esi
+  802714:	e9 94 00 00 00       	jmp    8027ad <vprintfmt+0x426>
+  802719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80271c:	8b 10                	mov    (%eax),%edx
+  80271e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802723:	8d 40 04             	lea    0x4(%eax),%eax
+  802726:	89 45 14             	mov    %eax,0x14(%ebp)
+  802729:	be 0a 00 00 00       	mov    $0xa,%esi
+  80272e:	eb 7d                	jmp    8027ad <vprintfmt+0x426>
+  802730:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802733:	89 55 10             	mov    %edx,0x10(%ebp)
+  802736:	83 f9 01             	cmp    $0x1,%ecx
+  802739:	7f 1b                	jg     802756 <vprintfmt+0x3cf>
+  80273b:	85 c9                	test   %ecx,%ecx
+  80273d:	74 2c                	je     80276b <vprintfmt+0x3e4>
+  80273f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802742:	8b 10                	mov    (%eax),%edx
+  802744:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802749:	8d 40 04             	lea    0x4(%eax),%eax
+  80274c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80274f:	be 08 00 00 00       	mov    $0x8,%esi
+  802754:	eb 57                	jmp    8027ad <vprintfmt+0x426>
+  802756:	8b 45 14             	mov    0x14(%ebp),%eax
+  802759:	8b 10                	mov    (%eax),%edx
+  80275b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80275e:	8d 40 08             	lea    0x8(%eax),%eax
+  802761:	89 45 14             	mov    %eax,0x14(%ebp)
+  802764:	be 08 00 00 00       	mov    $0x8,%esi
+  802769:	eb 42                	jmp    8027ad <vprintfmt+0x426>
+  80276b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80276e:	8b 10                	mov    (%eax),%edx
+  802770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802775:	8d 40 04             	lea    0x4(%eax),%eax
+  802778:	89 45 14             	mov    %eax,0x14(%ebp)
+  80277b:	be 08 00 00 00       	mov    $0x8,%esi
+  802780:	eb 2b                	jmp    8027ad <vprintfmt+0x426>
+  802782:	89 55 10             	mov    %edx,0x10(%ebp)
+  802785:	83 ec 08             	sub    $0x8,%esp
+  802788:	53                   	push   %ebx
+  802789:	6a 30                	push   $0x30
+  80278b:	ff d7                	call   *%edi
+  80278d:	83 c4 08             	add    $0x8,%esp
+  802790:	53                   	push   %ebx
+  802791:	6a 78                	push   $0x78
+  802793:	ff d7                	call   *%edi
+  802795:	8b 45 14             	mov    0x14(%ebp),%eax
+  802798:	8b 10                	mov    (%eax),%edx
+  80279a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80279f:	83 c4 10             	add    $0x10,%esp
+  8027a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8027a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027a8:	be 10 00 00 00       	mov    $0x10,%esi
+  8027ad:	83 ec 0c             	sub    $0xc,%esp
+  8027b0:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8027b4:	50                   	push   %eax
+  8027b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8027b8:	56                   	push   %esi
+  8027b9:	51                   	push   %ecx
+  8027ba:	52                   	push   %edx
+  8027bb:	89 da                	mov    %ebx,%edx
+  8027bd:	89 f8                	mov    %edi,%eax
+  8027bf:	e8 d8 fa ff ff       	call   80229c <printnum>
+  8027c4:	83 c4 20             	add    $0x20,%esp
+  8027c7:	e9 cc fb ff ff       	jmp    802398 <vprintfmt+0x11>
+  8027cc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8027cf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027d2:	83 f9 01             	cmp    $0x1,%ecx
+  8027d5:	7f 1b                	jg     8027f2 <vprintfmt+0x46b>
+  8027d7:	85 c9                	test   %ecx,%ecx
+  8027d9:	74 2c                	je     802807 <vprintfmt+0x480>
+  8027db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027de:	8b 10                	mov    (%eax),%edx
+  8027e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8027e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027eb:	be 10 00 00 00       	mov    $0x10,%esi
+  8027f0:	eb bb                	jmp    8027ad <vprintfmt+0x426>
+  8027f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027f5:	8b 10                	mov    (%eax),%edx
+  8027f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8027fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  802800:	be 10 00 00 00       	mov    $0x10,%esi
+  802805:	eb a6                	jmp    8027ad <vprintfmt+0x426>
+  802807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80280a:	8b 10                	mov    (%eax),%edx
+  80280c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802811:	8d 40 04             	lea    0x4(%eax),%eax
+  802814:	89 45 14             	mov    %eax,0x14(%ebp)
+  802817:	be 10 00 00 00       	mov    $0x10,%esi
+  80281c:	eb 8f                	jmp    8027ad <vprintfmt+0x426>
+  80281e:	89 55 10             	mov    %edx,0x10(%ebp)
+  802821:	83 ec 08             	sub    $0x8,%esp
+  802824:	53                   	push   %ebx
+  802825:	6a 25                	push   $0x25
+  802827:	ff d7                	call   *%edi
+  802829:	83 c4 10             	add    $0x10,%esp
+  80282c:	e9 67 fb ff ff       	jmp    802398 <vprintfmt+0x11>
+  802831:	83 ec 08             	sub    $0x8,%esp
+  802834:	53                   	push   %ebx
+  802835:	6a 25                	push   $0x25
+  802837:	ff d7                	call   *%edi
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  802840:	0f 84 ba fb ff ff    	je     802400 <vprintfmt+0x79>
+  802846:	89 75 10             	mov    %esi,0x10(%ebp)
+  802849:	89 f0                	mov    %esi,%eax
+  80284b:	83 e8 01             	sub    $0x1,%eax
+  80284e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802852:	75 f7                	jne    80284b <vprintfmt+0x4c4>
+  802854:	89 45 10             	mov    %eax,0x10(%ebp)
+  802857:	e9 3c fb ff ff       	jmp    802398 <vprintfmt+0x11>
+  80285c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80285f:	8d 70 01             	lea    0x1(%eax),%esi
+  802862:	0f b6 00             	movzbl (%eax),%eax
+  802865:	0f be d0             	movsbl %al,%edx
+  802868:	85 d2                	test   %edx,%edx
+  80286a:	74 11                	je     80287d <vprintfmt+0x4f6>
+  80286c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80286f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802872:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802875:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802878:	e9 5d fd ff ff       	jmp    8025da <vprintfmt+0x253>
+  80287d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802880:	89 45 14             	mov    %eax,0x14(%ebp)
+  802883:	e9 10 fb ff ff       	jmp    802398 <vprintfmt+0x11>
+  802888:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80288b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80288e:	e9 05 fb ff ff       	jmp    802398 <vprintfmt+0x11>
+  802893:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802897:	7e 0a                	jle    8028a3 <vprintfmt+0x51c>
+  802899:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80289d:	0f 85 bd fc ff ff    	jne    802560 <vprintfmt+0x1d9>
+  8028a3:	ba 28 00 00 00       	mov    $0x28,%edx
+  8028a8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8028ad:	be c9 33 80 00       	mov    $0x8033c9,%esi
+  8028b2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8028b5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8028b8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8028bb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8028be:	e9 17 fd ff ff       	jmp    8025da <vprintfmt+0x253>
+  8028c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c6:	5b                   	pop    %ebx
+  8028c7:	5e                   	pop    %esi
+  8028c8:	5f                   	pop    %edi
+  8028c9:	5d                   	pop    %ebp
+  8028ca:	c3                   	ret
+
+008028cb <vsnprintf>:
+  8028cb:	55                   	push   %ebp
+  8028cc:	89 e5                	mov    %esp,%ebp
+  8028ce:	83 ec 18             	sub    $0x18,%esp
+  8028d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8028da:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8028de:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8028e1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8028e8:	85 c0                	test   %eax,%eax
+  8028ea:	74 26                	je     802912 <vsnprintf+0x47>
+  8028ec:	85 d2                	test   %edx,%edx
+  8028ee:	7e 22                	jle    802912 <vsnprintf+0x47>
+  8028f0:	ff 75 14             	push   0x14(%ebp)
+  8028f3:	ff 75 10             	push   0x10(%ebp)
+  8028f6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028f9:	50                   	push   %eax
+  8028fa:	68 4d 23 80 00       	push   $0x80234d
+  8028ff:	e8 83 fa ff ff       	call   802387 <vprintfmt>
+  802904:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802907:	c6 00 00             	movb   $0x0,(%eax)
+  80290a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80290d:	83 c4 10             	add    $0x10,%esp
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+  802912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802917:	eb f7                	jmp    802910 <vsnprintf+0x45>
+
+00802919 <snprintf>:
+  802919:	55                   	push   %ebp
+  80291a:	89 e5                	mov    %esp,%ebp
+  80291c:	83 ec 08             	sub    $0x8,%esp
+  80291f:	8d 45 14             	lea    0x14(%ebp),%eax
+  802922:	50                   	push   %eax
+  802923:	ff 75 10             	push   0x10(%ebp)
+  802926:	ff 75 0c             	push   0xc(%ebp)
+  802929:	ff 75 08             	push   0x8(%ebp)
+  80292c:	e8 9a ff ff ff       	call   8028cb <vsnprintf>
+  802931:	c9                   	leave
+  802932:	c3                   	ret
+
+00802933 <strlen>:
+  802933:	55                   	push   %ebp
+  802934:	89 e5                	mov    %esp,%ebp
+  802936:	8b 55 08             	mov    0x8(%ebp),%edx
+  802939:	80 3a 00             	cmpb   $0x0,(%edx)
+  80293c:	74 10                	je     80294e <strlen+0x1b>
+  80293e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802943:	83 c0 01             	add    $0x1,%eax
+  802946:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80294a:	75 f7                	jne    802943 <strlen+0x10>
+  80294c:	5d                   	pop    %ebp
+  80294d:	c3                   	ret
+  80294e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802953:	eb f7                	jmp    80294c <strlen+0x19>
+
+00802955 <strnlen>:
+  802955:	55                   	push   %ebp
+  802956:	89 e5                	mov    %esp,%ebp
+  802958:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80295b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80295e:	85 d2                	test   %edx,%edx
+  802960:	74 16                	je     802978 <strnlen+0x23>
+  802962:	b8 00 00 00 00       	mov    $0x0,%eax
+  802967:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80296b:	74 09                	je     802976 <strnlen+0x21>
+  80296d:	83 c0 01             	add    $0x1,%eax
+  802970:	39 d0                	cmp    %edx,%eax
+  802972:	75 f3                	jne    802967 <strnlen+0x12>
+  802974:	89 d0                	mov    %edx,%eax
+  802976:	5d                   	pop    %ebp
+  802977:	c3                   	ret
+  802978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297d:	eb f7                	jmp    802976 <strnlen+0x21>
+
+0080297f <strcpy>:
+  80297f:	55                   	push   %ebp
+  802980:	89 e5                	mov    %esp,%ebp
+  802982:	53                   	push   %ebx
+  802983:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802986:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802992:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802995:	83 c0 01             	add    $0x1,%eax
+  802998:	84 d2                	test   %dl,%dl
+  80299a:	75 f2                	jne    80298e <strcpy+0xf>
+  80299c:	89 c8                	mov    %ecx,%eax
+  80299e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029a1:	c9                   	leave
+  8029a2:	c3                   	ret
+
+008029a3 <strcat>:
+  8029a3:	55                   	push   %ebp
+  8029a4:	89 e5                	mov    %esp,%ebp
+  8029a6:	53                   	push   %ebx
+  8029a7:	83 ec 10             	sub    $0x10,%esp
+  8029aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029ad:	53                   	push   %ebx
+  8029ae:	e8 80 ff ff ff       	call   802933 <strlen>
+  8029b3:	83 c4 08             	add    $0x8,%esp
+  8029b6:	ff 75 0c             	push   0xc(%ebp)
+  8029b9:	01 d8                	add    %ebx,%eax
+  8029bb:	50                   	push   %eax
+  8029bc:	e8 be ff ff ff       	call   80297f <strcpy>
+  8029c1:	89 d8                	mov    %ebx,%eax
+  8029c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+
+008029c8 <strncpy>:
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	56                   	push   %esi
+  8029cc:	53                   	push   %ebx
+  8029cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029d6:	85 db                	test   %ebx,%ebx
+  8029d8:	74 17                	je     8029f1 <strncpy+0x29>
+  8029da:	01 f3                	add    %esi,%ebx
+  8029dc:	89 f0                	mov    %esi,%eax
+  8029de:	83 c0 01             	add    $0x1,%eax
+  8029e1:	0f b6 0a             	movzbl (%edx),%ecx
+  8029e4:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029e7:	80 f9 01             	cmp    $0x1,%cl
+  8029ea:	83 da ff             	sbb    $0xffffffff,%edx
+  8029ed:	39 c3                	cmp    %eax,%ebx
+  8029ef:	75 ed                	jne    8029de <strncpy+0x16>
+  8029f1:	89 f0                	mov    %esi,%eax
+  8029f3:	5b                   	pop    %ebx
+  8029f4:	5e                   	pop    %esi
+  8029f5:	5d                   	pop    %ebp
+  8029f6:	c3                   	ret
+
+008029f7 <strlcpy>:
+  8029f7:	55                   	push   %ebp
+  8029f8:	89 e5                	mov    %esp,%ebp
+  8029fa:	56                   	push   %esi
+  8029fb:	53                   	push   %ebx
+  8029fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a05:	89 f0                	mov    %esi,%eax
+  802a07:	85 db                	test   %ebx,%ebx
+  802a09:	74 1e                	je     802a29 <strlcpy+0x32>
+  802a0b:	83 eb 01             	sub    $0x1,%ebx
+  802a0e:	74 16                	je     802a26 <strlcpy+0x2f>
+  802a10:	01 f3                	add    %esi,%ebx
+  802a12:	0f b6 0a             	movzbl (%edx),%ecx
+  802a15:	84 c9                	test   %cl,%cl
+  802a17:	74 0d                	je     802a26 <strlcpy+0x2f>
+  802a19:	83 c2 01             	add    $0x1,%edx
+  802a1c:	83 c0 01             	add    $0x1,%eax
+  802a1f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  802a22:	39 d8                	cmp    %ebx,%eax
+  802a24:	75 ec                	jne    802a12 <strlcpy+0x1b>
+  802a26:	c6 00 00             	movb   $0x0,(%eax)
+  802a29:	29 f0                	sub    %esi,%eax
+  802a2b:	5b                   	pop    %ebx
+  802a2c:	5e                   	pop    %esi
+  802a2d:	5d                   	pop    %ebp
+  802a2e:	c3                   	ret
+
+00802a2f <strcmp>:
+  802a2f:	55                   	push   %ebp
+  802a30:	89 e5                	mov    %esp,%ebp
+  802a32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a38:	0f b6 01             	movzbl (%ecx),%eax
+  802a3b:	84 c0                	test   %al,%al
+  802a3d:	74 11                	je     802a50 <strcmp+0x21>
+  802a3f:	38 02                	cmp    %al,(%edx)
+  802a41:	75 0d                	jne    802a50 <strcmp+0x21>
+  802a43:	83 c1 01             	add    $0x1,%ecx
+  802a46:	83 c2 01             	add    $0x1,%edx
+  802a49:	0f b6 01             	movzbl (%ecx),%eax
+  802a4c:	84 c0                	test   %al,%al
+  802a4e:	75 ef                	jne    802a3f <strcmp+0x10>
+  802a50:	0f b6 c0             	movzbl %al,%eax
+  802a53:	0f b6 12             	movzbl (%edx),%edx
+  802a56:	29 d0                	sub    %edx,%eax
+  802a58:	5d                   	pop    %ebp
+  802a59:	c3                   	ret
+
+00802a5a <strncmp>:
+  802a5a:	55                   	push   %ebp
+  802a5b:	89 e5                	mov    %esp,%ebp
+  802a5d:	53                   	push   %ebx
+  802a5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a64:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6c:	85 d2                	test   %edx,%edx
+  802a6e:	74 2e                	je     802a9e <strncmp+0x44>
+  802a70:	0f b6 01             	movzbl (%ecx),%eax
+  802a73:	84 c0                	test   %al,%al
+  802a75:	74 16                	je     802a8d <strncmp+0x33>
+  802a77:	3a 03                	cmp    (%ebx),%al
+  802a79:	75 12                	jne    802a8d <strncmp+0x33>
+  802a7b:	83 c1 01             	add    $0x1,%ecx
+  802a7e:	83 c3 01             	add    $0x1,%ebx
+  802a81:	83 ea 01             	sub    $0x1,%edx
+  802a84:	75 ea                	jne    802a70 <strncmp+0x16>
+  802a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8b:	eb 11                	jmp    802a9e <strncmp+0x44>
+  802a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a92:	85 d2                	test   %edx,%edx
+  802a94:	74 08                	je     802a9e <strncmp+0x44>
+  802a96:	0f b6 01             	movzbl (%ecx),%eax
+  802a99:	0f b6 13             	movzbl (%ebx),%edx
+  802a9c:	29 d0                	sub    %edx,%eax
+  802a9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa1:	c9                   	leave
+  802aa2:	c3                   	ret
+
+00802aa3 <strchr>:
+  802aa3:	55                   	push   %ebp
+  802aa4:	89 e5                	mov    %esp,%ebp
+  802aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802aad:	0f b6 10             	movzbl (%eax),%edx
+  802ab0:	84 d2                	test   %dl,%dl
+  802ab2:	74 15                	je     802ac9 <strchr+0x26>
+  802ab4:	38 d1                	cmp    %dl,%cl
+  802ab6:	74 0f                	je     802ac7 <strchr+0x24>
+  802ab8:	83 c0 01             	add    $0x1,%eax
+  802abb:	0f b6 10             	movzbl (%eax),%edx
+  802abe:	84 d2                	test   %dl,%dl
+  802ac0:	75 f2                	jne    802ab4 <strchr+0x11>
+  802ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac7:	5d                   	pop    %ebp
+  802ac8:	c3                   	ret
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ace:	eb f7                	jmp    802ac7 <strchr+0x24>
+
+00802ad0 <strfind>:
+  802ad0:	55                   	push   %ebp
+  802ad1:	89 e5                	mov    %esp,%ebp
+  802ad3:	53                   	push   %ebx
+  802ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ada:	0f b6 18             	movzbl (%eax),%ebx
+  802add:	38 d3                	cmp    %dl,%bl
+  802adf:	74 14                	je     802af5 <strfind+0x25>
+  802ae1:	89 d1                	mov    %edx,%ecx
+  802ae3:	84 db                	test   %bl,%bl
+  802ae5:	74 0e                	je     802af5 <strfind+0x25>
+  802ae7:	83 c0 01             	add    $0x1,%eax
+  802aea:	0f b6 10             	movzbl (%eax),%edx
+  802aed:	38 ca                	cmp    %cl,%dl
+  802aef:	74 04                	je     802af5 <strfind+0x25>
+  802af1:	84 d2                	test   %dl,%dl
+  802af3:	75 f2                	jne    802ae7 <strfind+0x17>
+  802af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <memset>:
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	57                   	push   %edi
+  802afe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b01:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802b04:	85 c9                	test   %ecx,%ecx
+  802b06:	74 20                	je     802b28 <memset+0x2e>
+  802b08:	89 f8                	mov    %edi,%eax
+  802b0a:	09 c8                	or     %ecx,%eax
+  802b0c:	a8 03                	test   $0x3,%al
+  802b0e:	75 12                	jne    802b22 <memset+0x28>
+  802b10:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802b14:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802b1a:	c1 e9 02             	shr    $0x2,%ecx
+  802b1d:	fc                   	cld
+  802b1e:	f3 ab                	rep stos %eax,%es:(%edi)
+  802b20:	eb 06                	jmp    802b28 <memset+0x2e>
+  802b22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b25:	fc                   	cld
+  802b26:	f3 aa                	rep stos %al,%es:(%edi)
+  802b28:	89 f8                	mov    %edi,%eax
+  802b2a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802b2d:	c9                   	leave
+  802b2e:	c3                   	ret
+
+00802b2f <memmove>:
+  802b2f:	55                   	push   %ebp
+  802b30:	89 e5                	mov    %esp,%ebp
+  802b32:	57                   	push   %edi
+  802b33:	56                   	push   %esi
+  802b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b37:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802b3d:	39 c6                	cmp    %eax,%esi
+  802b3f:	73 32                	jae    802b73 <memmove+0x44>
+  802b41:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802b44:	39 d0                	cmp    %edx,%eax
+  802b46:	73 2b                	jae    802b73 <memmove+0x44>
+  802b48:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b4b:	89 d6                	mov    %edx,%esi
+  802b4d:	09 fe                	or     %edi,%esi
+  802b4f:	09 ce                	or     %ecx,%esi
+  802b51:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b57:	75 0e                	jne    802b67 <memmove+0x38>
+  802b59:	83 ef 04             	sub    $0x4,%edi
+  802b5c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b5f:	c1 e9 02             	shr    $0x2,%ecx
+  802b62:	fd                   	std
+  802b63:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b65:	eb 09                	jmp    802b70 <memmove+0x41>
+  802b67:	83 ef 01             	sub    $0x1,%edi
+  802b6a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b6d:	fd                   	std
+  802b6e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b70:	fc                   	cld
+  802b71:	eb 1a                	jmp    802b8d <memmove+0x5e>
+  802b73:	89 f2                	mov    %esi,%edx
+  802b75:	09 c2                	or     %eax,%edx
+  802b77:	09 ca                	or     %ecx,%edx
+  802b79:	f6 c2 03             	test   $0x3,%dl
+  802b7c:	75 0a                	jne    802b88 <memmove+0x59>
+  802b7e:	c1 e9 02             	shr    $0x2,%ecx
+  802b81:	89 c7                	mov    %eax,%edi
+  802b83:	fc                   	cld
+  802b84:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b86:	eb 05                	jmp    802b8d <memmove+0x5e>
+  802b88:	89 c7                	mov    %eax,%edi
+  802b8a:	fc                   	cld
+  802b8b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b8d:	5e                   	pop    %esi
+  802b8e:	5f                   	pop    %edi
+  802b8f:	5d                   	pop    %ebp
+  802b90:	c3                   	ret
+
+00802b91 <memcpy>:
+  802b91:	55                   	push   %ebp
+  802b92:	89 e5                	mov    %esp,%ebp
+  802b94:	83 ec 0c             	sub    $0xc,%esp
+  802b97:	ff 75 10             	push   0x10(%ebp)
+  802b9a:	ff 75 0c             	push   0xc(%ebp)
+  802b9d:	ff 75 08             	push   0x8(%ebp)
+  802ba0:	e8 8a ff ff ff       	call   802b2f <memmove>
+  802ba5:	c9                   	leave
+  802ba6:	c3                   	ret
+
+00802ba7 <memcmp>:
+  802ba7:	55                   	push   %ebp
+  802ba8:	89 e5                	mov    %esp,%ebp
+  802baa:	56                   	push   %esi
+  802bab:	53                   	push   %ebx
+  802bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  802baf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bb2:	8b 75 10             	mov    0x10(%ebp),%esi
+  802bb5:	85 f6                	test   %esi,%esi
+  802bb7:	74 29                	je     802be2 <memcmp+0x3b>
+  802bb9:	01 c6                	add    %eax,%esi
+  802bbb:	0f b6 08             	movzbl (%eax),%ecx
+  802bbe:	0f b6 1a             	movzbl (%edx),%ebx
+  802bc1:	38 d9                	cmp    %bl,%cl
+  802bc3:	75 11                	jne    802bd6 <memcmp+0x2f>
+  802bc5:	83 c0 01             	add    $0x1,%eax
+  802bc8:	83 c2 01             	add    $0x1,%edx
+  802bcb:	39 c6                	cmp    %eax,%esi
+  802bcd:	75 ec                	jne    802bbb <memcmp+0x14>
+  802bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd4:	eb 08                	jmp    802bde <memcmp+0x37>
+  802bd6:	0f b6 c1             	movzbl %cl,%eax
+  802bd9:	0f b6 db             	movzbl %bl,%ebx
+  802bdc:	29 d8                	sub    %ebx,%eax
+  802bde:	5b                   	pop    %ebx
+  802bdf:	5e                   	pop    %esi
+  802be0:	5d                   	pop    %ebp
+  802be1:	c3                   	ret
+  802be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be7:	eb f5                	jmp    802bde <memcmp+0x37>
+
+00802be9 <memfind>:
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bf2:	89 c2                	mov    %eax,%edx
+  802bf4:	03 55 10             	add    0x10(%ebp),%edx
+  802bf7:	39 d0                	cmp    %edx,%eax
+  802bf9:	73 0d                	jae    802c08 <memfind+0x1f>
+  802bfb:	38 08                	cmp    %cl,(%eax)
+  802bfd:	74 0d                	je     802c0c <memfind+0x23>
+  802bff:	83 c0 01             	add    $0x1,%eax
+  802c02:	39 c2                	cmp    %eax,%edx
+  802c04:	75 f5                	jne    802bfb <memfind+0x12>
+  802c06:	eb 06                	jmp    802c0e <memfind+0x25>
+  802c08:	89 c2                	mov    %eax,%edx
+  802c0a:	eb 02                	jmp    802c0e <memfind+0x25>
+  802c0c:	89 c2                	mov    %eax,%edx
+  802c0e:	89 d0                	mov    %edx,%eax
+  802c10:	5d                   	pop    %ebp
+  802c11:	c3                   	ret
+
+00802c12 <strtol>:
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	57                   	push   %edi
+  802c16:	56                   	push   %esi
+  802c17:	53                   	push   %ebx
+  802c18:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c1e:	0f b6 02             	movzbl (%edx),%eax
+  802c21:	3c 20                	cmp    $0x20,%al
+  802c23:	74 04                	je     802c29 <strtol+0x17>
+  802c25:	3c 09                	cmp    $0x9,%al
+  802c27:	75 0e                	jne    802c37 <strtol+0x25>
+  802c29:	83 c2 01             	add    $0x1,%edx
+  802c2c:	0f b6 02             	movzbl (%edx),%eax
+  802c2f:	3c 20                	cmp    $0x20,%al
+  802c31:	74 f6                	je     802c29 <strtol+0x17>
+  802c33:	3c 09                	cmp    $0x9,%al
+  802c35:	74 f2                	je     802c29 <strtol+0x17>
+  802c37:	3c 2b                	cmp    $0x2b,%al
+  802c39:	74 2a                	je     802c65 <strtol+0x53>
+  802c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c40:	3c 2d                	cmp    $0x2d,%al
+  802c42:	74 2b                	je     802c6f <strtol+0x5d>
+  802c44:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c4a:	75 0f                	jne    802c5b <strtol+0x49>
+  802c4c:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c4f:	74 28                	je     802c79 <strtol+0x67>
+  802c51:	85 db                	test   %ebx,%ebx
+  802c53:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c58:	0f 44 d8             	cmove  %eax,%ebx
+  802c5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c60:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c63:	eb 46                	jmp    802cab <strtol+0x99>
+  802c65:	83 c2 01             	add    $0x1,%edx
+  802c68:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6d:	eb d5                	jmp    802c44 <strtol+0x32>
+  802c6f:	83 c2 01             	add    $0x1,%edx
+  802c72:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c77:	eb cb                	jmp    802c44 <strtol+0x32>
+  802c79:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c7d:	74 0e                	je     802c8d <strtol+0x7b>
+  802c7f:	85 db                	test   %ebx,%ebx
+  802c81:	75 d8                	jne    802c5b <strtol+0x49>
+  802c83:	83 c2 01             	add    $0x1,%edx
+  802c86:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c8b:	eb ce                	jmp    802c5b <strtol+0x49>
+  802c8d:	83 c2 02             	add    $0x2,%edx
+  802c90:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c95:	eb c4                	jmp    802c5b <strtol+0x49>
+  802c97:	0f be c0             	movsbl %al,%eax
+  802c9a:	83 e8 30             	sub    $0x30,%eax
+  802c9d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ca0:	7d 3a                	jge    802cdc <strtol+0xca>
+  802ca2:	83 c2 01             	add    $0x1,%edx
+  802ca5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802ca9:	01 c1                	add    %eax,%ecx
+  802cab:	0f b6 02             	movzbl (%edx),%eax
+  802cae:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802cb1:	89 f3                	mov    %esi,%ebx
+  802cb3:	80 fb 09             	cmp    $0x9,%bl
+  802cb6:	76 df                	jbe    802c97 <strtol+0x85>
+  802cb8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802cbb:	89 f3                	mov    %esi,%ebx
+  802cbd:	80 fb 19             	cmp    $0x19,%bl
+  802cc0:	77 08                	ja     802cca <strtol+0xb8>
+  802cc2:	0f be c0             	movsbl %al,%eax
+  802cc5:	83 e8 57             	sub    $0x57,%eax
+  802cc8:	eb d3                	jmp    802c9d <strtol+0x8b>
+  802cca:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802ccd:	89 f3                	mov    %esi,%ebx
+  802ccf:	80 fb 19             	cmp    $0x19,%bl
+  802cd2:	77 08                	ja     802cdc <strtol+0xca>
+  802cd4:	0f be c0             	movsbl %al,%eax
+  802cd7:	83 e8 37             	sub    $0x37,%eax
+  802cda:	eb c1                	jmp    802c9d <strtol+0x8b>
+  802cdc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802ce0:	74 05                	je     802ce7 <strtol+0xd5>
+  802ce2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ce5:	89 10                	mov    %edx,(%eax)
+  802ce7:	89 c8                	mov    %ecx,%eax
+  802ce9:	f7 d8                	neg    %eax
+  802ceb:	85 ff                	test   %edi,%edi
+  802ced:	0f 45 c8             	cmovne %eax,%ecx
+  802cf0:	89 c8                	mov    %ecx,%eax
+  802cf2:	5b                   	pop    %ebx
+  802cf3:	5e                   	pop    %esi
+  802cf4:	5f                   	pop    %edi
+  802cf5:	5d                   	pop    %ebp
+  802cf6:	c3                   	ret
+
+00802cf7 <set_pgfault_handler>:
+  802cf7:	55                   	push   %ebp
+  802cf8:	89 e5                	mov    %esp,%ebp
+  802cfa:	53                   	push   %ebx
+  802cfb:	83 ec 04             	sub    $0x4,%esp
+  802cfe:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802d05:	74 0d                	je     802d14 <set_pgfault_handler+0x1d>
+  802d07:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d0a:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d12:	c9                   	leave
+  802d13:	c3                   	ret
+  802d14:	e8 32 d4 ff ff       	call   80014b <sys_getenvid>
+  802d19:	89 c3                	mov    %eax,%ebx
+  802d1b:	83 ec 04             	sub    $0x4,%esp
+  802d1e:	6a 07                	push   $0x7
+  802d20:	68 00 f0 7f ee       	push   $0xee7ff000
+  802d25:	50                   	push   %eax
+  802d26:	e8 8a d4 ff ff       	call   8001b5 <sys_page_alloc>
+  802d2b:	83 c4 10             	add    $0x10,%esp
+  802d2e:	85 c0                	test   %eax,%eax
+  802d30:	78 29                	js     802d5b <set_pgfault_handler+0x64>
+  802d32:	83 ec 08             	sub    $0x8,%esp
+  802d35:	68 23 0a 80 00       	push   $0x800a23
+  802d3a:	53                   	push   %ebx
+  802d3b:	e8 8e d6 ff ff       	call   8003ce <sys_env_set_pgfault_upcall>
+  802d40:	83 c4 10             	add    $0x10,%esp
+  802d43:	85 c0                	test   %eax,%eax
+  802d45:	79 c0                	jns    802d07 <set_pgfault_handler+0x10>
+  802d47:	83 ec 04             	sub    $0x4,%esp
+  802d4a:	68 04 37 80 00       	push   $0x803704
+  802d4f:	6a 27                	push   $0x27
+  802d51:	68 36 37 80 00       	push   $0x803736
+  802d56:	e8 52 f4 ff ff       	call   8021ad <_panic>
+  802d5b:	83 ec 04             	sub    $0x4,%esp
+  802d5e:	68 cc 36 80 00       	push   $0x8036cc
+  802d63:	6a 23                	push   $0x23
+  802d65:	68 36 37 80 00       	push   $0x803736
+  802d6a:	e8 3e f4 ff ff       	call   8021ad <_panic>
+
+00802d6f <ipc_recv>:
+  802d6f:	55                   	push   %ebp
+  802d70:	89 e5                	mov    %esp,%ebp
+  802d72:	56                   	push   %esi
+  802d73:	53                   	push   %ebx
+  802d74:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d7d:	85 c0                	test   %eax,%eax
+  802d7f:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802d84:	0f 44 c2             	cmove  %edx,%eax
+  802d87:	83 ec 0c             	sub    $0xc,%esp
+  802d8a:	50                   	push   %eax
+  802d8b:	e8 d0 d6 ff ff       	call   800460 <sys_ipc_recv>
+  802d90:	83 c4 10             	add    $0x10,%esp
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	78 2a                	js     802dc1 <ipc_recv+0x52>
+  802d97:	a1 10 50 80 00       	mov    0x805010,%eax
+  802d9c:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802da2:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802da8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802dae:	85 f6                	test   %esi,%esi
+  802db0:	74 02                	je     802db4 <ipc_recv+0x45>
+  802db2:	89 0e                	mov    %ecx,(%esi)
+  802db4:	85 db                	test   %ebx,%ebx
+  802db6:	74 02                	je     802dba <ipc_recv+0x4b>
+  802db8:	89 13                	mov    %edx,(%ebx)
+  802dba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dbd:	5b                   	pop    %ebx
+  802dbe:	5e                   	pop    %esi
+  802dbf:	5d                   	pop    %ebp
+  802dc0:	c3                   	ret
+  802dc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dcb:	eb e1                	jmp    802dae <ipc_recv+0x3f>
+
+00802dcd <ipc_send>:
+  802dcd:	55                   	push   %ebp
+  802dce:	89 e5                	mov    %esp,%ebp
+  802dd0:	57                   	push   %edi
+  802dd1:	56                   	push   %esi
+  802dd2:	53                   	push   %ebx
+  802dd3:	83 ec 0c             	sub    $0xc,%esp
+  802dd6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802dd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ddc:	8b 75 14             	mov    0x14(%ebp),%esi
+  802ddf:	85 db                	test   %ebx,%ebx
+  802de1:	74 1e                	je     802e01 <ipc_send+0x34>
+  802de3:	56                   	push   %esi
+  802de4:	53                   	push   %ebx
+  802de5:	57                   	push   %edi
+  802de6:	ff 75 08             	push   0x8(%ebp)
+  802de9:	e8 ff d6 ff ff       	call   8004ed <sys_ipc_send>
+  802dee:	83 c4 10             	add    $0x10,%esp
+  802df1:	85 c0                	test   %eax,%eax
+  802df3:	74 2a                	je     802e1f <ipc_send+0x52>
+  802df5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802df8:	75 13                	jne    802e0d <ipc_send+0x40>
+  802dfa:	e8 6b d3 ff ff       	call   80016a <sys_yield>
+  802dff:	eb e2                	jmp    802de3 <ipc_send+0x16>
+  802e01:	be 00 00 00 00       	mov    $0x0,%esi
+  802e06:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802e0b:	eb d6                	jmp    802de3 <ipc_send+0x16>
+  802e0d:	50                   	push   %eax
+  802e0e:	68 44 37 80 00       	push   $0x803744
+  802e13:	6a 4f                	push   $0x4f
+  802e15:	68 87 37 80 00       	push   $0x803787
+  802e1a:	e8 8e f3 ff ff       	call   8021ad <_panic>
+  802e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e22:	5b                   	pop    %ebx
+  802e23:	5e                   	pop    %esi
+  802e24:	5f                   	pop    %edi
+  802e25:	5d                   	pop    %ebp
+  802e26:	c3                   	ret
+
+00802e27 <ipc_call>:
+  802e27:	55                   	push   %ebp
+  802e28:	89 e5                	mov    %esp,%ebp
+  802e2a:	57                   	push   %edi
+  802e2b:	56                   	push   %esi
+  802e2c:	53                   	push   %ebx
+  802e2d:	83 ec 0c             	sub    $0xc,%esp
+  802e30:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e34:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802e39:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802e3d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e41:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802e46:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802e4a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e53:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802e57:	eb 05                	jmp    802e5e <ipc_call+0x37>
+  802e59:	e8 0c d3 ff ff       	call   80016a <sys_yield>
+  802e5e:	83 ec 0c             	sub    $0xc,%esp
+  802e61:	56                   	push   %esi
+  802e62:	53                   	push   %ebx
+  802e63:	57                   	push   %edi
+  802e64:	ff 75 0c             	push   0xc(%ebp)
+  802e67:	ff 75 08             	push   0x8(%ebp)
+  802e6a:	e8 ce d6 ff ff       	call   80053d <sys_ipc_call>
+  802e6f:	83 c4 20             	add    $0x20,%esp
+  802e72:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e75:	74 e2                	je     802e59 <ipc_call+0x32>
+  802e77:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802e7a:	74 2d                	je     802ea9 <ipc_call+0x82>
+  802e7c:	85 c0                	test   %eax,%eax
+  802e7e:	78 4f                	js     802ecf <ipc_call+0xa8>
+  802e80:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802e84:	74 10                	je     802e96 <ipc_call+0x6f>
+  802e86:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e8b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e91:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802e94:	89 02                	mov    %eax,(%edx)
+  802e96:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e9b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ea1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea4:	5b                   	pop    %ebx
+  802ea5:	5e                   	pop    %esi
+  802ea6:	5f                   	pop    %edi
+  802ea7:	5d                   	pop    %ebp
+  802ea8:	c3                   	ret
+  802ea9:	ff 75 14             	push   0x14(%ebp)
+  802eac:	ff 75 10             	push   0x10(%ebp)
+  802eaf:	ff 75 0c             	push   0xc(%ebp)
+  802eb2:	ff 75 08             	push   0x8(%ebp)
+  802eb5:	e8 13 ff ff ff       	call   802dcd <ipc_send>
+  802eba:	83 c4 0c             	add    $0xc,%esp
+  802ebd:	ff 75 1c             	push   0x1c(%ebp)
+  802ec0:	ff 75 18             	push   0x18(%ebp)
+  802ec3:	6a 00                	push   $0x0
+  802ec5:	e8 a5 fe ff ff       	call   802d6f <ipc_recv>
+  802eca:	83 c4 10             	add    $0x10,%esp
+  802ecd:	eb d2                	jmp    802ea1 <ipc_call+0x7a>
+  802ecf:	50                   	push   %eax
+  802ed0:	68 91 37 80 00       	push   $0x803791
+  802ed5:	6a 6d                	push   $0x6d
+  802ed7:	68 87 37 80 00       	push   $0x803787
+  802edc:	e8 cc f2 ff ff       	call   8021ad <_panic>
+
+00802ee1 <ipc_reply_recv>:
+  802ee1:	55                   	push   %ebp
+  802ee2:	89 e5                	mov    %esp,%ebp
+  802ee4:	57                   	push   %edi
+  802ee5:	56                   	push   %esi
+  802ee6:	53                   	push   %ebx
+  802ee7:	83 ec 0c             	sub    $0xc,%esp
+  802eea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802eed:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802ef0:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802ef3:	85 db                	test   %ebx,%ebx
+  802ef5:	0f 84 ac 00 00 00    	je     802fa7 <ipc_reply_recv+0xc6>
+  802efb:	85 f6                	test   %esi,%esi
+  802efd:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f02:	0f 45 c6             	cmovne %esi,%eax
+  802f05:	83 ec 0c             	sub    $0xc,%esp
+  802f08:	50                   	push   %eax
+  802f09:	ff 75 14             	push   0x14(%ebp)
+  802f0c:	53                   	push   %ebx
+  802f0d:	ff 75 0c             	push   0xc(%ebp)
+  802f10:	ff 75 08             	push   0x8(%ebp)
+  802f13:	e8 46 d6 ff ff       	call   80055e <sys_ipc_reply_recv>
+  802f18:	83 c4 20             	add    $0x20,%esp
+  802f1b:	85 c0                	test   %eax,%eax
+  802f1d:	78 3a                	js     802f59 <ipc_reply_recv+0x78>
+  802f1f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f23:	74 10                	je     802f35 <ipc_reply_recv+0x54>
+  802f25:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f2a:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802f30:	8b 55 18             	mov    0x18(%ebp),%edx
+  802f33:	89 02                	mov    %eax,(%edx)
+  802f35:	85 ff                	test   %edi,%edi
+  802f37:	74 0d                	je     802f46 <ipc_reply_recv+0x65>
+  802f39:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f3e:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f44:	89 07                	mov    %eax,(%edi)
+  802f46:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f4b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f54:	5b                   	pop    %ebx
+  802f55:	5e                   	pop    %esi
+  802f56:	5f                   	pop    %edi
+  802f57:	5d                   	pop    %ebp
+  802f58:	c3                   	ret
+  802f59:	ff 75 14             	push   0x14(%ebp)
+  802f5c:	53                   	push   %ebx
+  802f5d:	ff 75 0c             	push   0xc(%ebp)
+  802f60:	ff 75 08             	push   0x8(%ebp)
+  802f63:	e8 a8 d4 ff ff       	call   800410 <sys_ipc_try_send>
+  802f68:	89 c2                	mov    %eax,%edx
+  802f6a:	c1 ea 1f             	shr    $0x1f,%edx
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802f73:	0f 95 c1             	setne  %cl
+  802f76:	84 d1                	test   %dl,%cl
+  802f78:	74 05                	je     802f7f <ipc_reply_recv+0x9e>
+  802f7a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f7d:	75 12                	jne    802f91 <ipc_reply_recv+0xb0>
+  802f7f:	83 ec 04             	sub    $0x4,%esp
+  802f82:	57                   	push   %edi
+  802f83:	56                   	push   %esi
+  802f84:	ff 75 18             	push   0x18(%ebp)
+  802f87:	e8 e3 fd ff ff       	call   802d6f <ipc_recv>
+  802f8c:	83 c4 10             	add    $0x10,%esp
+  802f8f:	eb c0                	jmp    802f51 <ipc_reply_recv+0x70>
+  802f91:	83 ec 04             	sub    $0x4,%esp
+  802f94:	50                   	push   %eax
+  802f95:	ff 75 08             	push   0x8(%ebp)
+  802f98:	68 64 37 80 00       	push   $0x803764
+  802f9d:	e8 e6 f2 ff ff       	call   802288 <cprintf>
+  802fa2:	83 c4 10             	add    $0x10,%esp
+  802fa5:	eb d8                	jmp    802f7f <ipc_reply_recv+0x9e>
+  802fa7:	85 f6                	test   %esi,%esi
+  802fa9:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802fae:	0f 45 c6             	cmovne %esi,%eax
+  802fb1:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802fb6:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802fbd:	e9 43 ff ff ff       	jmp    802f05 <ipc_reply_recv+0x24>
+
+00802fc2 <ipc_find_env>:
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	83 ec 14             	sub    $0x14,%esp
+  802fc8:	ff 75 08             	push   0x8(%ebp)
+  802fcb:	e8 de d3 ff ff       	call   8003ae <sys_env_service>
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd7:	0f 48 c2             	cmovs  %edx,%eax
+  802fda:	c9                   	leave
+  802fdb:	c3                   	ret
+
+00802fdc <pageref>:
+  802fdc:	55                   	push   %ebp
+  802fdd:	89 e5                	mov    %esp,%ebp
+  802fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe2:	89 c2                	mov    %eax,%edx
+  802fe4:	c1 ea 16             	shr    $0x16,%edx
+  802fe7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802fee:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff3:	f6 c1 01             	test   $0x1,%cl
+  802ff6:	74 22                	je     80301a <pageref+0x3e>
+  802ff8:	c1 e8 0c             	shr    $0xc,%eax
+  802ffb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803002:	a8 01                	test   $0x1,%al
+  803004:	74 14                	je     80301a <pageref+0x3e>
+  803006:	c1 e8 0c             	shr    $0xc,%eax
+  803009:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80300c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803013:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803017:	0f b7 d2             	movzwl %dx,%edx
+  80301a:	89 d0                	mov    %edx,%eax
+  80301c:	5d                   	pop    %ebp
+  80301d:	c3                   	ret
+
+0080301e <__udivmoddi4>:
+  80301e:	55                   	push   %ebp
+  80301f:	57                   	push   %edi
+  803020:	56                   	push   %esi
+  803021:	53                   	push   %ebx
+  803022:	83 ec 24             	sub    $0x24,%esp
+  803025:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803029:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80302d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803031:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803035:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803039:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80303d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803041:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803045:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803053:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803058:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80305f:	00 
+  803060:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803067:	00 
+  803068:	89 fb                	mov    %edi,%ebx
+  80306a:	eb 08                	jmp    803074 <__udivmoddi4+0x56>
+  80306c:	83 e9 01             	sub    $0x1,%ecx
+  80306f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803072:	74 68                	je     8030dc <__udivmoddi4+0xbe>
+  803074:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803078:	01 c0                	add    %eax,%eax
+  80307a:	89 c6                	mov    %eax,%esi
+  80307c:	89 d7                	mov    %edx,%edi
+  80307e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803082:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803086:	0f ad d0             	shrd   %cl,%edx,%eax
+  803089:	d3 ea                	shr    %cl,%edx
+  80308b:	f6 c1 20             	test   $0x20,%cl
+  80308e:	74 04                	je     803094 <__udivmoddi4+0x76>
+  803090:	89 d0                	mov    %edx,%eax
+  803092:	31 d2                	xor    %edx,%edx
+  803094:	83 e0 01             	and    $0x1,%eax
+  803097:	89 04 24             	mov    %eax,(%esp)
+  80309a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8030a1:	00 
+  8030a2:	8b 04 24             	mov    (%esp),%eax
+  8030a5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8030a9:	09 f0                	or     %esi,%eax
+  8030ab:	09 fa                	or     %edi,%edx
+  8030ad:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8030b1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8030b5:	39 f0                	cmp    %esi,%eax
+  8030b7:	89 d5                	mov    %edx,%ebp
+  8030b9:	19 fd                	sbb    %edi,%ebp
+  8030bb:	72 af                	jb     80306c <__udivmoddi4+0x4e>
+  8030bd:	29 f0                	sub    %esi,%eax
+  8030bf:	19 fa                	sbb    %edi,%edx
+  8030c1:	89 cf                	mov    %ecx,%edi
+  8030c3:	c1 ef 05             	shr    $0x5,%edi
+  8030c6:	83 e7 01             	and    $0x1,%edi
+  8030c9:	89 fe                	mov    %edi,%esi
+  8030cb:	83 f6 01             	xor    $0x1,%esi
+  8030ce:	d3 e6                	shl    %cl,%esi
+  8030d0:	d3 e7                	shl    %cl,%edi
+  8030d2:	09 74 24 18          	or     %esi,0x18(%esp)
+  8030d6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8030da:	eb 90                	jmp    80306c <__udivmoddi4+0x4e>
+  8030dc:	85 db                	test   %ebx,%ebx
+  8030de:	74 05                	je     8030e5 <__udivmoddi4+0xc7>
+  8030e0:	89 03                	mov    %eax,(%ebx)
+  8030e2:	89 53 04             	mov    %edx,0x4(%ebx)
+  8030e5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8030e9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8030ed:	83 c4 24             	add    $0x24,%esp
+  8030f0:	5b                   	pop    %ebx
+  8030f1:	5e                   	pop    %esi
+  8030f2:	5f                   	pop    %edi
+  8030f3:	5d                   	pop    %ebp
+  8030f4:	c3                   	ret
+
+008030f5 <__udivdi3>:
+  8030f5:	83 ec 08             	sub    $0x8,%esp
+  8030f8:	6a 00                	push   $0x0
+  8030fa:	ff 74 24 1c          	push   0x1c(%esp)
+  8030fe:	ff 74 24 1c          	push   0x1c(%esp)
+  803102:	ff 74 24 1c          	push   0x1c(%esp)
+  803106:	ff 74 24 1c          	push   0x1c(%esp)
+  80310a:	e8 0f ff ff ff       	call   80301e <__udivmoddi4>
+  80310f:	83 c4 1c             	add    $0x1c,%esp
+  803112:	c3                   	ret
+
+00803113 <__umoddi3>:
+  803113:	83 ec 18             	sub    $0x18,%esp
+  803116:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80311a:	50                   	push   %eax
+  80311b:	ff 74 24 2c          	push   0x2c(%esp)
+  80311f:	ff 74 24 2c          	push   0x2c(%esp)
+  803123:	ff 74 24 2c          	push   0x2c(%esp)
+  803127:	ff 74 24 2c          	push   0x2c(%esp)
+  80312b:	e8 ee fe ff ff       	call   80301e <__udivmoddi4>
+  803130:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803134:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803138:	83 c4 2c             	add    $0x2c,%esp
+  80313b:	c3                   	ret
+
+0080313c <__divdi3>:
+  80313c:	53                   	push   %ebx
+  80313d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803141:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803145:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803149:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80314d:	85 d2                	test   %edx,%edx
+  80314f:	78 12                	js     803163 <__divdi3+0x27>
+  803151:	85 db                	test   %ebx,%ebx
+  803153:	78 2e                	js     803183 <__divdi3+0x47>
+  803155:	53                   	push   %ebx
+  803156:	51                   	push   %ecx
+  803157:	52                   	push   %edx
+  803158:	50                   	push   %eax
+  803159:	e8 97 ff ff ff       	call   8030f5 <__udivdi3>
+  80315e:	83 c4 10             	add    $0x10,%esp
+  803161:	eb 1e                	jmp    803181 <__divdi3+0x45>
+  803163:	f7 d8                	neg    %eax
+  803165:	83 d2 00             	adc    $0x0,%edx
+  803168:	f7 da                	neg    %edx
+  80316a:	85 db                	test   %ebx,%ebx
+  80316c:	78 2a                	js     803198 <__divdi3+0x5c>
+  80316e:	53                   	push   %ebx
+  80316f:	51                   	push   %ecx
+  803170:	52                   	push   %edx
+  803171:	50                   	push   %eax
+  803172:	e8 7e ff ff ff       	call   8030f5 <__udivdi3>
+  803177:	83 c4 10             	add    $0x10,%esp
+  80317a:	f7 d8                	neg    %eax
+  80317c:	83 d2 00             	adc    $0x0,%edx
+  80317f:	f7 da                	neg    %edx
+  803181:	5b                   	pop    %ebx
+  803182:	c3                   	ret
+  803183:	f7 d9                	neg    %ecx
+  803185:	83 d3 00             	adc    $0x0,%ebx
+  803188:	f7 db                	neg    %ebx
+  80318a:	53                   	push   %ebx
+  80318b:	51                   	push   %ecx
+  80318c:	52                   	push   %edx
+  80318d:	50                   	push   %eax
+  80318e:	e8 62 ff ff ff       	call   8030f5 <__udivdi3>
+  803193:	83 c4 10             	add    $0x10,%esp
+  803196:	eb e2                	jmp    80317a <__divdi3+0x3e>
+  803198:	f7 d9                	neg    %ecx
+  80319a:	83 d3 00             	adc    $0x0,%ebx
+  80319d:	f7 db                	neg    %ebx
+  80319f:	53                   	push   %ebx
+  8031a0:	51                   	push   %ecx
+  8031a1:	52                   	push   %edx
+  8031a2:	50                   	push   %eax
+  8031a3:	e8 4d ff ff ff       	call   8030f5 <__udivdi3>
+  8031a8:	83 c4 10             	add    $0x10,%esp
+  8031ab:	eb d4                	jmp    803181 <__divdi3+0x45>
+
+008031ad <__moddi3>:
+  8031ad:	55                   	push   %ebp
+  8031ae:	57                   	push   %edi
+  8031af:	56                   	push   %esi
+  8031b0:	53                   	push   %ebx
+  8031b1:	83 ec 0c             	sub    $0xc,%esp
+  8031b4:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8031b8:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8031bc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031c0:	89 e9                	mov    %ebp,%ecx
+  8031c2:	f7 d9                	neg    %ecx
+  8031c4:	89 d0                	mov    %edx,%eax
+  8031c6:	83 d0 00             	adc    $0x0,%eax
+  8031c9:	f7 d8                	neg    %eax
+  8031cb:	0f 49 e9             	cmovns %ecx,%ebp
+  8031ce:	0f 49 d0             	cmovns %eax,%edx
+  8031d1:	52                   	push   %edx
+  8031d2:	55                   	push   %ebp
+  8031d3:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8031d7:	f7 da                	neg    %edx
+  8031d9:	89 d8                	mov    %ebx,%eax
+  8031db:	83 d0 00             	adc    $0x0,%eax
+  8031de:	f7 d8                	neg    %eax
+  8031e0:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8031e5:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8031e9:	0f 48 c3             	cmovs  %ebx,%eax
+  8031ec:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8031f0:	ff 74 24 0c          	push   0xc(%esp)
+  8031f4:	ff 74 24 0c          	push   0xc(%esp)
+  8031f8:	e8 16 ff ff ff       	call   803113 <__umoddi3>
+  8031fd:	83 c4 10             	add    $0x10,%esp
+  803200:	85 db                	test   %ebx,%ebx
+  803202:	78 08                	js     80320c <__moddi3+0x5f>
+  803204:	83 c4 0c             	add    $0xc,%esp
+  803207:	5b                   	pop    %ebx
+  803208:	5e                   	pop    %esi
+  803209:	5f                   	pop    %edi
+  80320a:	5d                   	pop    %ebp
+  80320b:	c3                   	ret
+  80320c:	f7 d8                	neg    %eax
+  80320e:	83 d2 00             	adc    $0x0,%edx
+  803211:	f7 da                	neg    %edx
+  803213:	eb ef                	jmp    803204 <__moddi3+0x57>
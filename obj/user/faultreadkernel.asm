@@ -0,0 +1,5040 @@
+
+obj/user/faultreadkernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	ff 35 00 00 10 f0    	push   0xf0100000
+  80003f:	68 80 31 80 00       	push   $0x803180
+  800044:	e8 13 01 00 00       	call   80015c <cprintf>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800059:	e8 eb 0b 00 00       	call   800c49 <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 10 50 80 00       	mov    %eax,0x805010
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 00 40 80 00       	mov    %eax,0x804000
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	a1 10 50 80 00       	mov    0x805010,%eax
+  8000a2:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000a8:	85 c0                	test   %eax,%eax
+  8000aa:	75 14                	jne    8000c0 <exit+0x29>
+  8000ac:	e8 3a 16 00 00       	call   8016eb <close_all>
+  8000b1:	83 ec 0c             	sub    $0xc,%esp
+  8000b4:	6a 00                	push   $0x0
+  8000b6:	e8 4d 0b 00 00       	call   800c08 <sys_env_destroy>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	c9                   	leave
+  8000bf:	c3                   	ret
+  8000c0:	e8 b0 12 00 00       	call   801375 <sys_lease_complete>
+  8000c5:	eb e5                	jmp    8000ac <exit+0x15>
+
+008000c7 <putch>:
+  8000c7:	55                   	push   %ebp
+  8000c8:	89 e5                	mov    %esp,%ebp
+  8000ca:	53                   	push   %ebx
+  8000cb:	83 ec 04             	sub    $0x4,%esp
+  8000ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000d1:	8b 13                	mov    (%ebx),%edx
+  8000d3:	8d 42 01             	lea    0x1(%edx),%eax
+  8000d6:	89 03                	mov    %eax,(%ebx)
+  8000d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000db:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8000df:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000e4:	74 09                	je     8000ef <putch+0x28>
+  8000e6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8000ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000ed:	c9                   	leave
+  8000ee:	c3                   	ret
+  8000ef:	83 ec 08             	sub    $0x8,%esp
+  8000f2:	68 ff 00 00 00       	push   $0xff
+  8000f7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000fa:	50                   	push   %eax
+  8000fb:	e8 cb 0a 00 00       	call   800bcb <sys_cputs>
+  800100:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb db                	jmp    8000e6 <putch+0x1f>
+
+0080010b <vcprintf>:
+  80010b:	55                   	push   %ebp
+  80010c:	89 e5                	mov    %esp,%ebp
+  80010e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800114:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80011b:	00 00 00 
+  80011e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800125:	00 00 00 
+  800128:	ff 75 0c             	push   0xc(%ebp)
+  80012b:	ff 75 08             	push   0x8(%ebp)
+  80012e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800134:	50                   	push   %eax
+  800135:	68 c7 00 80 00       	push   $0x8000c7
+  80013a:	e8 1c 01 00 00       	call   80025b <vprintfmt>
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800148:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80014e:	50                   	push   %eax
+  80014f:	e8 77 0a 00 00       	call   800bcb <sys_cputs>
+  800154:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80015a:	c9                   	leave
+  80015b:	c3                   	ret
+
+0080015c <cprintf>:
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	83 ec 10             	sub    $0x10,%esp
+  800162:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800165:	50                   	push   %eax
+  800166:	ff 75 08             	push   0x8(%ebp)
+  800169:	e8 9d ff ff ff       	call   80010b <vcprintf>
+  80016e:	c9                   	leave
+  80016f:	c3                   	ret
+
+00800170 <printnum>:
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	57                   	push   %edi
+  800174:	56                   	push   %esi
+  800175:	53                   	push   %ebx
+  800176:	83 ec 1c             	sub    $0x1c,%esp
+  800179:	89 c3                	mov    %eax,%ebx
+  80017b:	89 d6                	mov    %edx,%esi
+  80017d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800180:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800183:	89 d1                	mov    %edx,%ecx
+  800185:	89 c2                	mov    %eax,%edx
+  800187:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80018a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80018d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800190:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800193:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80019a:	39 c2                	cmp    %eax,%edx
+  80019c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80019f:	73 4b                	jae    8001ec <printnum+0x7c>
+  8001a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8001a4:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8001a7:	85 ff                	test   %edi,%edi
+  8001a9:	7e 11                	jle    8001bc <printnum+0x4c>
+  8001ab:	83 ec 08             	sub    $0x8,%esp
+  8001ae:	56                   	push   %esi
+  8001af:	ff 75 18             	push   0x18(%ebp)
+  8001b2:	ff d3                	call   *%ebx
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	83 ef 01             	sub    $0x1,%edi
+  8001ba:	75 ef                	jne    8001ab <printnum+0x3b>
+  8001bc:	83 ec 08             	sub    $0x8,%esp
+  8001bf:	56                   	push   %esi
+  8001c0:	83 ec 04             	sub    $0x4,%esp
+  8001c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8001c6:	ff 75 e0             	push   -0x20(%ebp)
+  8001c9:	ff 75 dc             	push   -0x24(%ebp)
+  8001cc:	ff 75 d8             	push   -0x28(%ebp)
+  8001cf:	e8 96 2e 00 00       	call   80306a <__umoddi3>
+  8001d4:	83 c4 14             	add    $0x14,%esp
+  8001d7:	0f be 80 b1 31 80 00 	movsbl 0x8031b1(%eax),%eax
+  8001de:	50                   	push   %eax
+  8001df:	ff d3                	call   *%ebx
+  8001e1:	83 c4 10             	add    $0x10,%esp
+  8001e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e7:	5b                   	pop    %ebx
+  8001e8:	5e                   	pop    %esi
+  8001e9:	5f                   	pop    %edi
+  8001ea:	5d                   	pop    %ebp
+  8001eb:	c3                   	ret
+  8001ec:	83 ec 0c             	sub    $0xc,%esp
+  8001ef:	ff 75 18             	push   0x18(%ebp)
+  8001f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001f5:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8001f8:	52                   	push   %edx
+  8001f9:	50                   	push   %eax
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+  8001fd:	ff 75 e4             	push   -0x1c(%ebp)
+  800200:	ff 75 e0             	push   -0x20(%ebp)
+  800203:	ff 75 dc             	push   -0x24(%ebp)
+  800206:	ff 75 d8             	push   -0x28(%ebp)
+  800209:	e8 3e 2e 00 00       	call   80304c <__udivdi3>
+  80020e:	83 c4 18             	add    $0x18,%esp
+  800211:	52                   	push   %edx
+  800212:	50                   	push   %eax
+  800213:	89 f2                	mov    %esi,%edx
+  800215:	89 d8                	mov    %ebx,%eax
+  800217:	e8 54 ff ff ff       	call   800170 <printnum>
+  80021c:	83 c4 20             	add    $0x20,%esp
+  80021f:	eb 9b                	jmp    8001bc <printnum+0x4c>
+
+00800221 <sprintputch>:
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800227:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80022b:	8b 10                	mov    (%eax),%edx
+  80022d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800230:	73 0a                	jae    80023c <sprintputch+0x1b>
+  800232:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800235:	89 08                	mov    %ecx,(%eax)
+  800237:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023a:	88 02                	mov    %al,(%edx)
+  80023c:	5d                   	pop    %ebp
+  80023d:	c3                   	ret
+
+0080023e <printfmt>:
+  80023e:	55                   	push   %ebp
+  80023f:	89 e5                	mov    %esp,%ebp
+  800241:	83 ec 08             	sub    $0x8,%esp
+  800244:	8d 45 14             	lea    0x14(%ebp),%eax
+  800247:	50                   	push   %eax
+  800248:	ff 75 10             	push   0x10(%ebp)
+  80024b:	ff 75 0c             	push   0xc(%ebp)
+  80024e:	ff 75 08             	push   0x8(%ebp)
+  800251:	e8 05 00 00 00       	call   80025b <vprintfmt>
+  800256:	83 c4 10             	add    $0x10,%esp
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <vprintfmt>:
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	57                   	push   %edi
+  80025f:	56                   	push   %esi
+  800260:	53                   	push   %ebx
+  800261:	83 ec 2c             	sub    $0x2c,%esp
+  800264:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800267:	89 df                	mov    %ebx,%edi
+  800269:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80026c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80026f:	8d 70 01             	lea    0x1(%eax),%esi
+  800272:	0f b6 00             	movzbl (%eax),%eax
+  800275:	83 f8 25             	cmp    $0x25,%eax
+  800278:	74 1e                	je     800298 <vprintfmt+0x3d>
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 84 15 05 00 00    	je     800797 <vprintfmt+0x53c>
+  800282:	83 ec 08             	sub    $0x8,%esp
+  800285:	53                   	push   %ebx
+  800286:	50                   	push   %eax
+  800287:	ff d7                	call   *%edi
+  800289:	83 c6 01             	add    $0x1,%esi
+  80028c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800290:	83 c4 10             	add    $0x10,%esp
+  800293:	83 f8 25             	cmp    $0x25,%eax
+  800296:	75 e2                	jne    80027a <vprintfmt+0x1f>
+  800298:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80029c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002a3:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8002aa:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8002b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002b6:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8002b9:	8d 56 01             	lea    0x1(%esi),%edx
+  8002bc:	0f b6 0e             	movzbl (%esi),%ecx
+  8002bf:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8002c2:	3c 55                	cmp    $0x55,%al
+  8002c4:	0f 87 3b 04 00 00    	ja     800705 <vprintfmt+0x4aa>
+  8002ca:	0f b6 c0             	movzbl %al,%eax
+  8002cd:	ff 24 85 00 33 80 00 	jmp    *0x803300(,%eax,4)
+  8002d4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8002d7:	eb 93                	jmp    80026c <vprintfmt+0x11>
+  8002d9:	89 d6                	mov    %edx,%esi
+  8002db:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8002df:	eb d8                	jmp    8002b9 <vprintfmt+0x5e>
+  8002e1:	89 d6                	mov    %edx,%esi
+  8002e3:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8002e7:	eb d0                	jmp    8002b9 <vprintfmt+0x5e>
+  8002e9:	0f b6 c9             	movzbl %cl,%ecx
+  8002ec:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8002ef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8002f2:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8002f6:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8002f9:	83 f9 09             	cmp    $0x9,%ecx
+  8002fc:	77 6f                	ja     80036d <vprintfmt+0x112>
+  8002fe:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800301:	83 c2 01             	add    $0x1,%edx
+  800304:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800307:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80030b:	0f be 02             	movsbl (%edx),%eax
+  80030e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800311:	83 fe 09             	cmp    $0x9,%esi
+  800314:	76 eb                	jbe    800301 <vprintfmt+0xa6>
+  800316:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800319:	89 d6                	mov    %edx,%esi
+  80031b:	eb 13                	jmp    800330 <vprintfmt+0xd5>
+  80031d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800320:	8b 00                	mov    (%eax),%eax
+  800322:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800325:	8b 45 14             	mov    0x14(%ebp),%eax
+  800328:	8d 40 04             	lea    0x4(%eax),%eax
+  80032b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80032e:	89 d6                	mov    %edx,%esi
+  800330:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800334:	79 83                	jns    8002b9 <vprintfmt+0x5e>
+  800336:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800339:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80033c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800343:	e9 71 ff ff ff       	jmp    8002b9 <vprintfmt+0x5e>
+  800348:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80034b:	85 c9                	test   %ecx,%ecx
+  80034d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800352:	0f 49 c1             	cmovns %ecx,%eax
+  800355:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800358:	89 d6                	mov    %edx,%esi
+  80035a:	e9 5a ff ff ff       	jmp    8002b9 <vprintfmt+0x5e>
+  80035f:	89 d6                	mov    %edx,%esi
+  800361:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800368:	e9 4c ff ff ff       	jmp    8002b9 <vprintfmt+0x5e>
+  80036d:	89 d6                	mov    %edx,%esi
+  80036f:	eb bf                	jmp    800330 <vprintfmt+0xd5>
+  800371:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800375:	89 d6                	mov    %edx,%esi
+  800377:	e9 3d ff ff ff       	jmp    8002b9 <vprintfmt+0x5e>
+  80037c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80037f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800382:	8d 70 04             	lea    0x4(%eax),%esi
+  800385:	83 ec 08             	sub    $0x8,%esp
+  800388:	53                   	push   %ebx
+  800389:	ff 30                	push   (%eax)
+  80038b:	ff d7                	call   *%edi
+  80038d:	83 c4 10             	add    $0x10,%esp
+  800390:	89 75 14             	mov    %esi,0x14(%ebp)
+  800393:	e9 d4 fe ff ff       	jmp    80026c <vprintfmt+0x11>
+  800398:	89 55 10             	mov    %edx,0x10(%ebp)
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8d 70 04             	lea    0x4(%eax),%esi
+  8003a1:	8b 10                	mov    (%eax),%edx
+  8003a3:	89 d0                	mov    %edx,%eax
+  8003a5:	f7 d8                	neg    %eax
+  8003a7:	0f 48 c2             	cmovs  %edx,%eax
+  8003aa:	83 f8 12             	cmp    $0x12,%eax
+  8003ad:	7f 23                	jg     8003d2 <vprintfmt+0x177>
+  8003af:	8b 14 85 60 34 80 00 	mov    0x803460(,%eax,4),%edx
+  8003b6:	85 d2                	test   %edx,%edx
+  8003b8:	74 18                	je     8003d2 <vprintfmt+0x177>
+  8003ba:	52                   	push   %edx
+  8003bb:	68 bb 35 80 00       	push   $0x8035bb
+  8003c0:	53                   	push   %ebx
+  8003c1:	57                   	push   %edi
+  8003c2:	e8 77 fe ff ff       	call   80023e <printfmt>
+  8003c7:	83 c4 10             	add    $0x10,%esp
+  8003ca:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003cd:	e9 9a fe ff ff       	jmp    80026c <vprintfmt+0x11>
+  8003d2:	50                   	push   %eax
+  8003d3:	68 c9 31 80 00       	push   $0x8031c9
+  8003d8:	53                   	push   %ebx
+  8003d9:	57                   	push   %edi
+  8003da:	e8 5f fe ff ff       	call   80023e <printfmt>
+  8003df:	83 c4 10             	add    $0x10,%esp
+  8003e2:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003e5:	e9 82 fe ff ff       	jmp    80026c <vprintfmt+0x11>
+  8003ea:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f0:	83 c0 04             	add    $0x4,%eax
+  8003f3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8003f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f9:	8b 00                	mov    (%eax),%eax
+  8003fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fe:	85 c0                	test   %eax,%eax
+  800400:	0f 84 61 03 00 00    	je     800767 <vprintfmt+0x50c>
+  800406:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80040a:	7e 06                	jle    800412 <vprintfmt+0x1b7>
+  80040c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800410:	75 29                	jne    80043b <vprintfmt+0x1e0>
+  800412:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800415:	8d 70 01             	lea    0x1(%eax),%esi
+  800418:	0f b6 00             	movzbl (%eax),%eax
+  80041b:	0f be d0             	movsbl %al,%edx
+  80041e:	85 d2                	test   %edx,%edx
+  800420:	0f 84 bb 00 00 00    	je     8004e1 <vprintfmt+0x286>
+  800426:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800429:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80042c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80042f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800432:	eb 7a                	jmp    8004ae <vprintfmt+0x253>
+  800434:	c7 45 d0 c2 31 80 00 	movl   $0x8031c2,-0x30(%ebp)
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	ff 75 d4             	push   -0x2c(%ebp)
+  800441:	ff 75 d0             	push   -0x30(%ebp)
+  800444:	e8 e0 03 00 00       	call   800829 <strnlen>
+  800449:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80044c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80044f:	83 c4 10             	add    $0x10,%esp
+  800452:	85 d2                	test   %edx,%edx
+  800454:	0f 8e d6 02 00 00    	jle    800730 <vprintfmt+0x4d5>
+  80045a:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80045e:	83 ec 08             	sub    $0x8,%esp
+  800461:	53                   	push   %ebx
+  800462:	56                   	push   %esi
+  800463:	ff d7                	call   *%edi
+  800465:	83 c4 10             	add    $0x10,%esp
+  800468:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80046c:	75 f0                	jne    80045e <vprintfmt+0x203>
+  80046e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800471:	8d 70 01             	lea    0x1(%eax),%esi
+  800474:	0f b6 00             	movzbl (%eax),%eax
+  800477:	0f be d0             	movsbl %al,%edx
+  80047a:	85 d2                	test   %edx,%edx
+  80047c:	0f 84 da 02 00 00    	je     80075c <vprintfmt+0x501>
+  800482:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800485:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800488:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80048b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80048e:	eb 1e                	jmp    8004ae <vprintfmt+0x253>
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	ff 75 0c             	push   0xc(%ebp)
+  800496:	52                   	push   %edx
+  800497:	ff 55 08             	call   *0x8(%ebp)
+  80049a:	83 c4 10             	add    $0x10,%esp
+  80049d:	83 eb 01             	sub    $0x1,%ebx
+  8004a0:	83 c6 01             	add    $0x1,%esi
+  8004a3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004a7:	0f be d0             	movsbl %al,%edx
+  8004aa:	85 d2                	test   %edx,%edx
+  8004ac:	74 2a                	je     8004d8 <vprintfmt+0x27d>
+  8004ae:	85 ff                	test   %edi,%edi
+  8004b0:	78 05                	js     8004b7 <vprintfmt+0x25c>
+  8004b2:	83 ef 01             	sub    $0x1,%edi
+  8004b5:	78 59                	js     800510 <vprintfmt+0x2b5>
+  8004b7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004bb:	74 d3                	je     800490 <vprintfmt+0x235>
+  8004bd:	0f be c0             	movsbl %al,%eax
+  8004c0:	83 e8 20             	sub    $0x20,%eax
+  8004c3:	83 f8 5e             	cmp    $0x5e,%eax
+  8004c6:	76 c8                	jbe    800490 <vprintfmt+0x235>
+  8004c8:	83 ec 08             	sub    $0x8,%esp
+  8004cb:	ff 75 0c             	push   0xc(%ebp)
+  8004ce:	6a 3f                	push   $0x3f
+  8004d0:	ff 55 08             	call   *0x8(%ebp)
+  8004d3:	83 c4 10             	add    $0x10,%esp
+  8004d6:	eb c5                	jmp    80049d <vprintfmt+0x242>
+  8004d8:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8004db:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8004de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004e1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8004e4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004e8:	7e 1b                	jle    800505 <vprintfmt+0x2aa>
+  8004ea:	83 ec 08             	sub    $0x8,%esp
+  8004ed:	53                   	push   %ebx
+  8004ee:	6a 20                	push   $0x20
+  8004f0:	ff d7                	call   *%edi
+  8004f2:	83 c4 10             	add    $0x10,%esp
+  8004f5:	83 ee 01             	sub    $0x1,%esi
+  8004f8:	75 f0                	jne    8004ea <vprintfmt+0x28f>
+  8004fa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800500:	e9 67 fd ff ff       	jmp    80026c <vprintfmt+0x11>
+  800505:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800508:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050b:	e9 5c fd ff ff       	jmp    80026c <vprintfmt+0x11>
+  800510:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800513:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800516:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800519:	eb c6                	jmp    8004e1 <vprintfmt+0x286>
+  80051b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80051e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800521:	83 f9 01             	cmp    $0x1,%ecx
+  800524:	7f 1f                	jg     800545 <vprintfmt+0x2ea>
+  800526:	85 c9                	test   %ecx,%ecx
+  800528:	74 67                	je     800591 <vprintfmt+0x336>
+  80052a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052d:	8b 30                	mov    (%eax),%esi
+  80052f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800532:	89 f0                	mov    %esi,%eax
+  800534:	c1 f8 1f             	sar    $0x1f,%eax
+  800537:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80053a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053d:	8d 40 04             	lea    0x4(%eax),%eax
+  800540:	89 45 14             	mov    %eax,0x14(%ebp)
+  800543:	eb 17                	jmp    80055c <vprintfmt+0x301>
+  800545:	8b 45 14             	mov    0x14(%ebp),%eax
+  800548:	8b 50 04             	mov    0x4(%eax),%edx
+  80054b:	8b 00                	mov    (%eax),%eax
+  80054d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800550:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800553:	8b 45 14             	mov    0x14(%ebp),%eax
+  800556:	8d 40 08             	lea    0x8(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80055f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800562:	be 0a 00 00 00       	mov    $0xa,%esi
+  800567:	85 c9                	test   %ecx,%ecx
+  800569:	0f 89 12 01 00 00    	jns    800681 <vprintfmt+0x426>
+  80056f:	83 ec 08             	sub    $0x8,%esp
+  800572:	53                   	push   %ebx
+  800573:	6a 2d                	push   $0x2d
+  800575:	ff d7                	call   *%edi
+  800577:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80057a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80057d:	f7 da                	neg    %edx
+  80057f:	83 d1 00             	adc    $0x0,%ecx
+  800582:	f7 d9                	neg    %ecx
+  800584:	83 c4 10             	add    $0x10,%esp
+  800587:	be 0a 00 00 00       	mov    $0xa,%esi
+  80058c:	e9 f0 00 00 00       	jmp    800681 <vprintfmt+0x426>
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8b 30                	mov    (%eax),%esi
+  800596:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800599:	89 f0                	mov    %esi,%eax
+  80059b:	c1 f8 1f             	sar    $0x1f,%eax
+  80059e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005aa:	eb b0                	jmp    80055c <vprintfmt+0x301>
+  8005ac:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005af:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005b2:	83 f9 01             	cmp    $0x1,%ecx
+  8005b5:	7f 1e                	jg     8005d5 <vprintfmt+0x37a>
+  8005b7:	85 c9                	test   %ecx,%ecx
+  8005b9:	74 32                	je     8005ed <vprintfmt+0x392>
+  8005bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005be:	8b 10                	mov    (%eax),%edx
+  8005c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cb:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005d0:	e9 ac 00 00 00       	jmp    800681 <vprintfmt+0x426>
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8b 10                	mov    (%eax),%edx
+  8005da:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005e8:	e9 94 00 00 00       	jmp    800681 <vprintfmt+0x426>
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8b 10                	mov    (%eax),%edx
+  8005f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fd:	be 0a 00 00 00       	mov    $0xa,%esi
+  800602:	eb 7d                	jmp    800681 <vprintfmt+0x426>
+  800604:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800607:	89 55 10             	mov    %edx,0x10(%ebp)
+  80060a:	83 f9 01             	cmp    $0x1,%ecx
+  80060d:	7f 1b                	jg     80062a <vprintfmt+0x3cf>
+  80060f:	85 c9                	test   %ecx,%ecx
+  800611:	74 2c                	je     80063f <vprintfmt+0x3e4>
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8b 10                	mov    (%eax),%edx
+  800618:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061d:	8d 40 04             	lea    0x4(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+  800623:	be 08 00 00 00       	mov    $0x8,%esi
+  800628:	eb 57                	jmp    800681 <vprintfmt+0x426>
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800632:	8d 40 08             	lea    0x8(%eax),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+  800638:	be 08 00 00 00       	mov    $0x8,%esi
+  80063d:	eb 42                	jmp    800681 <vprintfmt+0x426>
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 10                	mov    (%eax),%edx
+  800644:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800649:	8d 40 04             	lea    0x4(%eax),%eax
+  80064c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80064f:	be 08 00 00 00       	mov    $0x8,%esi
+  800654:	eb 2b                	jmp    800681 <vprintfmt+0x426>
+  800656:	89 55 10             	mov    %edx,0x10(%ebp)
+  800659:	83 ec 08             	sub    $0x8,%esp
+  80065c:	53                   	push   %ebx
+  80065d:	6a 30                	push   $0x30
+  80065f:	ff d7                	call   *%edi
+  800661:	83 c4 08             	add    $0x8,%esp
+  800664:	53                   	push   %ebx
+  800665:	6a 78                	push   $0x78
+  800667:	ff d7                	call   *%edi
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8b 10                	mov    (%eax),%edx
+  80066e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800673:	83 c4 10             	add    $0x10,%esp
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067c:	be 10 00 00 00       	mov    $0x10,%esi
+  800681:	83 ec 0c             	sub    $0xc,%esp
+  800684:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800688:	50                   	push   %eax
+  800689:	ff 75 e4             	push   -0x1c(%ebp)
+  80068c:	56                   	push   %esi
+  80068d:	51                   	push   %ecx
+  80068e:	52                   	push   %edx
+  80068f:	89 da                	mov    %ebx,%edx
+  800691:	89 f8                	mov    %edi,%eax
+  800693:	e8 d8 fa ff ff       	call   800170 <printnum>
+  800698:	83 c4 20             	add    $0x20,%esp
+  80069b:	e9 cc fb ff ff       	jmp    80026c <vprintfmt+0x11>
+  8006a0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006a3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a6:	83 f9 01             	cmp    $0x1,%ecx
+  8006a9:	7f 1b                	jg     8006c6 <vprintfmt+0x46b>
+  8006ab:	85 c9                	test   %ecx,%ecx
+  8006ad:	74 2c                	je     8006db <vprintfmt+0x480>
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8b 10                	mov    (%eax),%edx
+  8006b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bf:	be 10 00 00 00       	mov    $0x10,%esi
+  8006c4:	eb bb                	jmp    800681 <vprintfmt+0x426>
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 10                	mov    (%eax),%edx
+  8006cb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d4:	be 10 00 00 00       	mov    $0x10,%esi
+  8006d9:	eb a6                	jmp    800681 <vprintfmt+0x426>
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 10                	mov    (%eax),%edx
+  8006e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006eb:	be 10 00 00 00       	mov    $0x10,%esi
+  8006f0:	eb 8f                	jmp    800681 <vprintfmt+0x426>
+  8006f2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f5:	83 ec 08             	sub    $0x8,%esp
+  8006f8:	53                   	push   %ebx
+  8006f9:	6a 25                	push   $0x25
+  8006fb:	ff d7                	call   *%edi
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	e9 67 fb ff ff       	jmp    80026c <vprintfmt+0x11>
+  800705:	83 ec 08             	sub    $0x8,%esp
+  800708:	53                   	push   %ebx
+  800709:	6a 25                	push   $0x25
+  80070b:	ff d7                	call   *%edi
+  80070d:	83 c4 10             	add    $0x10,%esp
+  800710:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800714:	0f 84 ba fb ff ff    	je     8002d4 <vprintfmt+0x79>
+  80071a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80071d:	89 f0                	mov    %esi,%eax
+  80071f:	83 e8 01             	sub    $0x1,%eax
+  800722:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800726:	75 f7                	jne    80071f <vprintfmt+0x4c4>
+  800728:	89 45 10             	mov    %eax,0x10(%ebp)
+  80072b:	e9 3c fb ff ff       	jmp    80026c <vprintfmt+0x11>
+  800730:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800733:	8d 70 01             	lea    0x1(%eax),%esi
+  800736:	0f b6 00             	movzbl (%eax),%eax
+  800739:	0f be d0             	movsbl %al,%edx
+  80073c:	85 d2                	test   %edx,%edx
+  80073e:	74 11                	je     800751 <vprintfmt+0x4f6>
+  800740:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800743:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800746:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800749:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80074c:	e9 5d fd ff ff       	jmp    8004ae <vprintfmt+0x253>
+  800751:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800754:	89 45 14             	mov    %eax,0x14(%ebp)
+  800757:	e9 10 fb ff ff       	jmp    80026c <vprintfmt+0x11>
+  80075c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80075f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800762:	e9 05 fb ff ff       	jmp    80026c <vprintfmt+0x11>
+  800767:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80076b:	7e 0a                	jle    800777 <vprintfmt+0x51c>
+  80076d:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800771:	0f 85 bd fc ff ff    	jne    800434 <vprintfmt+0x1d9>
+  800777:	ba 28 00 00 00       	mov    $0x28,%edx
+  80077c:	b8 28 00 00 00       	mov    $0x28,%eax
+  800781:	be c3 31 80 00       	mov    $0x8031c3,%esi
+  800786:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800789:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80078c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80078f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800792:	e9 17 fd ff ff       	jmp    8004ae <vprintfmt+0x253>
+  800797:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80079a:	5b                   	pop    %ebx
+  80079b:	5e                   	pop    %esi
+  80079c:	5f                   	pop    %edi
+  80079d:	5d                   	pop    %ebp
+  80079e:	c3                   	ret
+
+0080079f <vsnprintf>:
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	83 ec 18             	sub    $0x18,%esp
+  8007a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007ae:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007b2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007b5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8007bc:	85 c0                	test   %eax,%eax
+  8007be:	74 26                	je     8007e6 <vsnprintf+0x47>
+  8007c0:	85 d2                	test   %edx,%edx
+  8007c2:	7e 22                	jle    8007e6 <vsnprintf+0x47>
+  8007c4:	ff 75 14             	push   0x14(%ebp)
+  8007c7:	ff 75 10             	push   0x10(%ebp)
+  8007ca:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007cd:	50                   	push   %eax
+  8007ce:	68 21 02 80 00       	push   $0x800221
+  8007d3:	e8 83 fa ff ff       	call   80025b <vprintfmt>
+  8007d8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007db:	c6 00 00             	movb   $0x0,(%eax)
+  8007de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007e1:	83 c4 10             	add    $0x10,%esp
+  8007e4:	c9                   	leave
+  8007e5:	c3                   	ret
+  8007e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007eb:	eb f7                	jmp    8007e4 <vsnprintf+0x45>
+
+008007ed <snprintf>:
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	8d 45 14             	lea    0x14(%ebp),%eax
+  8007f6:	50                   	push   %eax
+  8007f7:	ff 75 10             	push   0x10(%ebp)
+  8007fa:	ff 75 0c             	push   0xc(%ebp)
+  8007fd:	ff 75 08             	push   0x8(%ebp)
+  800800:	e8 9a ff ff ff       	call   80079f <vsnprintf>
+  800805:	c9                   	leave
+  800806:	c3                   	ret
+
+00800807 <strlen>:
+  800807:	55                   	push   %ebp
+  800808:	89 e5                	mov    %esp,%ebp
+  80080a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80080d:	80 3a 00             	cmpb   $0x0,(%edx)
+  800810:	74 10                	je     800822 <strlen+0x1b>
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	83 c0 01             	add    $0x1,%eax
+  80081a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80081e:	75 f7                	jne    800817 <strlen+0x10>
+  800820:	5d                   	pop    %ebp
+  800821:	c3                   	ret
+  800822:	b8 00 00 00 00       	mov    $0x0,%eax
+  800827:	eb f7                	jmp    800820 <strlen+0x19>
+
+00800829 <strnlen>:
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80082f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800832:	85 d2                	test   %edx,%edx
+  800834:	74 16                	je     80084c <strnlen+0x23>
+  800836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80083f:	74 09                	je     80084a <strnlen+0x21>
+  800841:	83 c0 01             	add    $0x1,%eax
+  800844:	39 d0                	cmp    %edx,%eax
+  800846:	75 f3                	jne    80083b <strnlen+0x12>
+  800848:	89 d0                	mov    %edx,%eax
+  80084a:	5d                   	pop    %ebp
+  80084b:	c3                   	ret
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	eb f7                	jmp    80084a <strnlen+0x21>
+
+00800853 <strcpy>:
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	53                   	push   %ebx
+  800857:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80085d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800862:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800866:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800869:	83 c0 01             	add    $0x1,%eax
+  80086c:	84 d2                	test   %dl,%dl
+  80086e:	75 f2                	jne    800862 <strcpy+0xf>
+  800870:	89 c8                	mov    %ecx,%eax
+  800872:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800875:	c9                   	leave
+  800876:	c3                   	ret
+
+00800877 <strcat>:
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	53                   	push   %ebx
+  80087b:	83 ec 10             	sub    $0x10,%esp
+  80087e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800881:	53                   	push   %ebx
+  800882:	e8 80 ff ff ff       	call   800807 <strlen>
+  800887:	83 c4 08             	add    $0x8,%esp
+  80088a:	ff 75 0c             	push   0xc(%ebp)
+  80088d:	01 d8                	add    %ebx,%eax
+  80088f:	50                   	push   %eax
+  800890:	e8 be ff ff ff       	call   800853 <strcpy>
+  800895:	89 d8                	mov    %ebx,%eax
+  800897:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089a:	c9                   	leave
+  80089b:	c3                   	ret
+
+0080089c <strncpy>:
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	56                   	push   %esi
+  8008a0:	53                   	push   %ebx
+  8008a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008aa:	85 db                	test   %ebx,%ebx
+  8008ac:	74 17                	je     8008c5 <strncpy+0x29>
+  8008ae:	01 f3                	add    %esi,%ebx
+  8008b0:	89 f0                	mov    %esi,%eax
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	0f b6 0a             	movzbl (%edx),%ecx
+  8008b8:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008bb:	80 f9 01             	cmp    $0x1,%cl
+  8008be:	83 da ff             	sbb    $0xffffffff,%edx
+  8008c1:	39 c3                	cmp    %eax,%ebx
+  8008c3:	75 ed                	jne    8008b2 <strncpy+0x16>
+  8008c5:	89 f0                	mov    %esi,%eax
+  8008c7:	5b                   	pop    %ebx
+  8008c8:	5e                   	pop    %esi
+  8008c9:	5d                   	pop    %ebp
+  8008ca:	c3                   	ret
+
+008008cb <strlcpy>:
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	56                   	push   %esi
+  8008cf:	53                   	push   %ebx
+  8008d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008d9:	89 f0                	mov    %esi,%eax
+  8008db:	85 db                	test   %ebx,%ebx
+  8008dd:	74 1e                	je     8008fd <strlcpy+0x32>
+  8008df:	83 eb 01             	sub    $0x1,%ebx
+  8008e2:	74 16                	je     8008fa <strlcpy+0x2f>
+  8008e4:	01 f3                	add    %esi,%ebx
+  8008e6:	0f b6 0a             	movzbl (%edx),%ecx
+  8008e9:	84 c9                	test   %cl,%cl
+  8008eb:	74 0d                	je     8008fa <strlcpy+0x2f>
+  8008ed:	83 c2 01             	add    $0x1,%edx
+  8008f0:	83 c0 01             	add    $0x1,%eax
+  8008f3:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8008f6:	39 d8                	cmp    %ebx,%eax
+  8008f8:	75 ec                	jne    8008e6 <strlcpy+0x1b>
+  8008fa:	c6 00 00             	movb   $0x0,(%eax)
+  8008fd:	29 f0                	sub    %esi,%eax
+  8008ff:	5b                   	pop    %ebx
+  800900:	5e                   	pop    %esi
+  800901:	5d                   	pop    %ebp
+  800902:	c3                   	ret
+
+00800903 <strcmp>:
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800909:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80090c:	0f b6 01             	movzbl (%ecx),%eax
+  80090f:	84 c0                	test   %al,%al
+  800911:	74 11                	je     800924 <strcmp+0x21>
+  800913:	38 02                	cmp    %al,(%edx)
+  800915:	75 0d                	jne    800924 <strcmp+0x21>
+  800917:	83 c1 01             	add    $0x1,%ecx
+  80091a:	83 c2 01             	add    $0x1,%edx
+  80091d:	0f b6 01             	movzbl (%ecx),%eax
+  800920:	84 c0                	test   %al,%al
+  800922:	75 ef                	jne    800913 <strcmp+0x10>
+  800924:	0f b6 c0             	movzbl %al,%eax
+  800927:	0f b6 12             	movzbl (%edx),%edx
+  80092a:	29 d0                	sub    %edx,%eax
+  80092c:	5d                   	pop    %ebp
+  80092d:	c3                   	ret
+
+0080092e <strncmp>:
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	53                   	push   %ebx
+  800932:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800935:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800938:	8b 55 10             	mov    0x10(%ebp),%edx
+  80093b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800940:	85 d2                	test   %edx,%edx
+  800942:	74 2e                	je     800972 <strncmp+0x44>
+  800944:	0f b6 01             	movzbl (%ecx),%eax
+  800947:	84 c0                	test   %al,%al
+  800949:	74 16                	je     800961 <strncmp+0x33>
+  80094b:	3a 03                	cmp    (%ebx),%al
+  80094d:	75 12                	jne    800961 <strncmp+0x33>
+  80094f:	83 c1 01             	add    $0x1,%ecx
+  800952:	83 c3 01             	add    $0x1,%ebx
+  800955:	83 ea 01             	sub    $0x1,%edx
+  800958:	75 ea                	jne    800944 <strncmp+0x16>
+  80095a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095f:	eb 11                	jmp    800972 <strncmp+0x44>
+  800961:	b8 00 00 00 00       	mov    $0x0,%eax
+  800966:	85 d2                	test   %edx,%edx
+  800968:	74 08                	je     800972 <strncmp+0x44>
+  80096a:	0f b6 01             	movzbl (%ecx),%eax
+  80096d:	0f b6 13             	movzbl (%ebx),%edx
+  800970:	29 d0                	sub    %edx,%eax
+  800972:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800975:	c9                   	leave
+  800976:	c3                   	ret
+
+00800977 <strchr>:
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800981:	0f b6 10             	movzbl (%eax),%edx
+  800984:	84 d2                	test   %dl,%dl
+  800986:	74 15                	je     80099d <strchr+0x26>
+  800988:	38 d1                	cmp    %dl,%cl
+  80098a:	74 0f                	je     80099b <strchr+0x24>
+  80098c:	83 c0 01             	add    $0x1,%eax
+  80098f:	0f b6 10             	movzbl (%eax),%edx
+  800992:	84 d2                	test   %dl,%dl
+  800994:	75 f2                	jne    800988 <strchr+0x11>
+  800996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099b:	5d                   	pop    %ebp
+  80099c:	c3                   	ret
+  80099d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a2:	eb f7                	jmp    80099b <strchr+0x24>
+
+008009a4 <strfind>:
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	53                   	push   %ebx
+  8009a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ae:	0f b6 18             	movzbl (%eax),%ebx
+  8009b1:	38 d3                	cmp    %dl,%bl
+  8009b3:	74 14                	je     8009c9 <strfind+0x25>
+  8009b5:	89 d1                	mov    %edx,%ecx
+  8009b7:	84 db                	test   %bl,%bl
+  8009b9:	74 0e                	je     8009c9 <strfind+0x25>
+  8009bb:	83 c0 01             	add    $0x1,%eax
+  8009be:	0f b6 10             	movzbl (%eax),%edx
+  8009c1:	38 ca                	cmp    %cl,%dl
+  8009c3:	74 04                	je     8009c9 <strfind+0x25>
+  8009c5:	84 d2                	test   %dl,%dl
+  8009c7:	75 f2                	jne    8009bb <strfind+0x17>
+  8009c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009cc:	c9                   	leave
+  8009cd:	c3                   	ret
+
+008009ce <memset>:
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	57                   	push   %edi
+  8009d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009d5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8009d8:	85 c9                	test   %ecx,%ecx
+  8009da:	74 20                	je     8009fc <memset+0x2e>
+  8009dc:	89 f8                	mov    %edi,%eax
+  8009de:	09 c8                	or     %ecx,%eax
+  8009e0:	a8 03                	test   $0x3,%al
+  8009e2:	75 12                	jne    8009f6 <memset+0x28>
+  8009e4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009e8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  8009ee:	c1 e9 02             	shr    $0x2,%ecx
+  8009f1:	fc                   	cld
+  8009f2:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009f4:	eb 06                	jmp    8009fc <memset+0x2e>
+  8009f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009f9:	fc                   	cld
+  8009fa:	f3 aa                	rep stos %al,%es:(%edi)
+  8009fc:	89 f8                	mov    %edi,%eax
+  8009fe:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a01:	c9                   	leave
+  800a02:	c3                   	ret
+
+00800a03 <memmove>:
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	57                   	push   %edi
+  800a07:	56                   	push   %esi
+  800a08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a0e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a11:	39 c6                	cmp    %eax,%esi
+  800a13:	73 32                	jae    800a47 <memmove+0x44>
+  800a15:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a18:	39 d0                	cmp    %edx,%eax
+  800a1a:	73 2b                	jae    800a47 <memmove+0x44>
+  800a1c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a1f:	89 d6                	mov    %edx,%esi
+  800a21:	09 fe                	or     %edi,%esi
+  800a23:	09 ce                	or     %ecx,%esi
+  800a25:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a2b:	75 0e                	jne    800a3b <memmove+0x38>
+  800a2d:	83 ef 04             	sub    $0x4,%edi
+  800a30:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a33:	c1 e9 02             	shr    $0x2,%ecx
+  800a36:	fd                   	std
+  800a37:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a39:	eb 09                	jmp    800a44 <memmove+0x41>
+  800a3b:	83 ef 01             	sub    $0x1,%edi
+  800a3e:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800a41:	fd                   	std
+  800a42:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a44:	fc                   	cld
+  800a45:	eb 1a                	jmp    800a61 <memmove+0x5e>
+  800a47:	89 f2                	mov    %esi,%edx
+  800a49:	09 c2                	or     %eax,%edx
+  800a4b:	09 ca                	or     %ecx,%edx
+  800a4d:	f6 c2 03             	test   $0x3,%dl
+  800a50:	75 0a                	jne    800a5c <memmove+0x59>
+  800a52:	c1 e9 02             	shr    $0x2,%ecx
+  800a55:	89 c7                	mov    %eax,%edi
+  800a57:	fc                   	cld
+  800a58:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a5a:	eb 05                	jmp    800a61 <memmove+0x5e>
+  800a5c:	89 c7                	mov    %eax,%edi
+  800a5e:	fc                   	cld
+  800a5f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a61:	5e                   	pop    %esi
+  800a62:	5f                   	pop    %edi
+  800a63:	5d                   	pop    %ebp
+  800a64:	c3                   	ret
+
+00800a65 <memcpy>:
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	83 ec 0c             	sub    $0xc,%esp
+  800a6b:	ff 75 10             	push   0x10(%ebp)
+  800a6e:	ff 75 0c             	push   0xc(%ebp)
+  800a71:	ff 75 08             	push   0x8(%ebp)
+  800a74:	e8 8a ff ff ff       	call   800a03 <memmove>
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+00800a7b <memcmp>:
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	56                   	push   %esi
+  800a7f:	53                   	push   %ebx
+  800a80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a86:	8b 75 10             	mov    0x10(%ebp),%esi
+  800a89:	85 f6                	test   %esi,%esi
+  800a8b:	74 29                	je     800ab6 <memcmp+0x3b>
+  800a8d:	01 c6                	add    %eax,%esi
+  800a8f:	0f b6 08             	movzbl (%eax),%ecx
+  800a92:	0f b6 1a             	movzbl (%edx),%ebx
+  800a95:	38 d9                	cmp    %bl,%cl
+  800a97:	75 11                	jne    800aaa <memcmp+0x2f>
+  800a99:	83 c0 01             	add    $0x1,%eax
+  800a9c:	83 c2 01             	add    $0x1,%edx
+  800a9f:	39 c6                	cmp    %eax,%esi
+  800aa1:	75 ec                	jne    800a8f <memcmp+0x14>
+  800aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa8:	eb 08                	jmp    800ab2 <memcmp+0x37>
+  800aaa:	0f b6 c1             	movzbl %cl,%eax
+  800aad:	0f b6 db             	movzbl %bl,%ebx
+  800ab0:	29 d8                	sub    %ebx,%eax
+  800ab2:	5b                   	pop    %ebx
+  800ab3:	5e                   	pop    %esi
+  800ab4:	5d                   	pop    %ebp
+  800ab5:	c3                   	ret
+  800ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abb:	eb f5                	jmp    800ab2 <memcmp+0x37>
+
+00800abd <memfind>:
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac6:	89 c2                	mov    %eax,%edx
+  800ac8:	03 55 10             	add    0x10(%ebp),%edx
+  800acb:	39 d0                	cmp    %edx,%eax
+  800acd:	73 0d                	jae    800adc <memfind+0x1f>
+  800acf:	38 08                	cmp    %cl,(%eax)
+  800ad1:	74 0d                	je     800ae0 <memfind+0x23>
+  800ad3:	83 c0 01             	add    $0x1,%eax
+  800ad6:	39 c2                	cmp    %eax,%edx
+  800ad8:	75 f5                	jne    800acf <memfind+0x12>
+  800ada:	eb 06                	jmp    800ae2 <memfind+0x25>
+  800adc:	89 c2                	mov    %eax,%edx
+  800ade:	eb 02                	jmp    800ae2 <memfind+0x25>
+  800ae0:	89 c2                	mov    %eax,%edx
+  800ae2:	89 d0                	mov    %edx,%eax
+  800ae4:	5d                   	pop    %ebp
+  800ae5:	c3                   	ret
+
+00800ae6 <strtol>:
+  800ae6:	55                   	push   %ebp
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	57                   	push   %edi
+  800aea:	56                   	push   %esi
+  800aeb:	53                   	push   %ebx
+  800aec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800af2:	0f b6 02             	movzbl (%edx),%eax
+  800af5:	3c 20                	cmp    $0x20,%al
+  800af7:	74 04                	je     800afd <strtol+0x17>
+  800af9:	3c 09                	cmp    $0x9,%al
+  800afb:	75 0e                	jne    800b0b <strtol+0x25>
+  800afd:	83 c2 01             	add    $0x1,%edx
+  800b00:	0f b6 02             	movzbl (%edx),%eax
+  800b03:	3c 20                	cmp    $0x20,%al
+  800b05:	74 f6                	je     800afd <strtol+0x17>
+  800b07:	3c 09                	cmp    $0x9,%al
+  800b09:	74 f2                	je     800afd <strtol+0x17>
+  800b0b:	3c 2b                	cmp    $0x2b,%al
+  800b0d:	74 2a                	je     800b39 <strtol+0x53>
+  800b0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b14:	3c 2d                	cmp    $0x2d,%al
+  800b16:	74 2b                	je     800b43 <strtol+0x5d>
+  800b18:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b1e:	75 0f                	jne    800b2f <strtol+0x49>
+  800b20:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b23:	74 28                	je     800b4d <strtol+0x67>
+  800b25:	85 db                	test   %ebx,%ebx
+  800b27:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b2c:	0f 44 d8             	cmove  %eax,%ebx
+  800b2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b34:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b37:	eb 46                	jmp    800b7f <strtol+0x99>
+  800b39:	83 c2 01             	add    $0x1,%edx
+  800b3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b41:	eb d5                	jmp    800b18 <strtol+0x32>
+  800b43:	83 c2 01             	add    $0x1,%edx
+  800b46:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b4b:	eb cb                	jmp    800b18 <strtol+0x32>
+  800b4d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b51:	74 0e                	je     800b61 <strtol+0x7b>
+  800b53:	85 db                	test   %ebx,%ebx
+  800b55:	75 d8                	jne    800b2f <strtol+0x49>
+  800b57:	83 c2 01             	add    $0x1,%edx
+  800b5a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b5f:	eb ce                	jmp    800b2f <strtol+0x49>
+  800b61:	83 c2 02             	add    $0x2,%edx
+  800b64:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b69:	eb c4                	jmp    800b2f <strtol+0x49>
+  800b6b:	0f be c0             	movsbl %al,%eax
+  800b6e:	83 e8 30             	sub    $0x30,%eax
+  800b71:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b74:	7d 3a                	jge    800bb0 <strtol+0xca>
+  800b76:	83 c2 01             	add    $0x1,%edx
+  800b79:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b7d:	01 c1                	add    %eax,%ecx
+  800b7f:	0f b6 02             	movzbl (%edx),%eax
+  800b82:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b85:	89 f3                	mov    %esi,%ebx
+  800b87:	80 fb 09             	cmp    $0x9,%bl
+  800b8a:	76 df                	jbe    800b6b <strtol+0x85>
+  800b8c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b8f:	89 f3                	mov    %esi,%ebx
+  800b91:	80 fb 19             	cmp    $0x19,%bl
+  800b94:	77 08                	ja     800b9e <strtol+0xb8>
+  800b96:	0f be c0             	movsbl %al,%eax
+  800b99:	83 e8 57             	sub    $0x57,%eax
+  800b9c:	eb d3                	jmp    800b71 <strtol+0x8b>
+  800b9e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ba1:	89 f3                	mov    %esi,%ebx
+  800ba3:	80 fb 19             	cmp    $0x19,%bl
+  800ba6:	77 08                	ja     800bb0 <strtol+0xca>
+  800ba8:	0f be c0             	movsbl %al,%eax
+  800bab:	83 e8 37             	sub    $0x37,%eax
+  800bae:	eb c1                	jmp    800b71 <strtol+0x8b>
+  800bb0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bb4:	74 05                	je     800bbb <strtol+0xd5>
+  800bb6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb9:	89 10                	mov    %edx,(%eax)
+  800bbb:	89 c8                	mov    %ecx,%eax
+  800bbd:	f7 d8                	neg    %eax
+  800bbf:	85 ff                	test   %edi,%edi
+  800bc1:	0f 45 c8             	cmovne %eax,%ecx
+  800bc4:	89 c8                	mov    %ecx,%eax
+  800bc6:	5b                   	pop    %ebx
+  800bc7:	5e                   	pop    %esi
+  800bc8:	5f                   	pop    %edi
+  800bc9:	5d                   	pop    %ebp
+  800bca:	c3                   	ret
+
+00800bcb <sys_cputs>:
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	57                   	push   %edi
+  800bcf:	56                   	push   %esi
+  800bd0:	53                   	push   %ebx
+  800bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bdc:	89 c3                	mov    %eax,%ebx
+  800bde:	89 c7                	mov    %eax,%edi
+  800be0:	89 c6                	mov    %eax,%esi
+  800be2:	cd 30                	int    $0x30
+  800be4:	5b                   	pop    %ebx
+  800be5:	5e                   	pop    %esi
+  800be6:	5f                   	pop    %edi
+  800be7:	5d                   	pop    %ebp
+  800be8:	c3                   	ret
+
+00800be9 <sys_cgetc>:
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	57                   	push   %edi
+  800bed:	56                   	push   %esi
+  800bee:	53                   	push   %ebx
+  800bef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bf9:	89 d1                	mov    %edx,%ecx
+  800bfb:	89 d3                	mov    %edx,%ebx
+  800bfd:	89 d7                	mov    %edx,%edi
+  800bff:	89 d6                	mov    %edx,%esi
+  800c01:	cd 30                	int    $0x30
+  800c03:	5b                   	pop    %ebx
+  800c04:	5e                   	pop    %esi
+  800c05:	5f                   	pop    %edi
+  800c06:	5d                   	pop    %ebp
+  800c07:	c3                   	ret
+
+00800c08 <sys_env_destroy>:
+  800c08:	55                   	push   %ebp
+  800c09:	89 e5                	mov    %esp,%ebp
+  800c0b:	57                   	push   %edi
+  800c0c:	56                   	push   %esi
+  800c0d:	53                   	push   %ebx
+  800c0e:	83 ec 0c             	sub    $0xc,%esp
+  800c11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c19:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c1e:	89 cb                	mov    %ecx,%ebx
+  800c20:	89 cf                	mov    %ecx,%edi
+  800c22:	89 ce                	mov    %ecx,%esi
+  800c24:	cd 30                	int    $0x30
+  800c26:	85 c0                	test   %eax,%eax
+  800c28:	7f 08                	jg     800c32 <sys_env_destroy+0x2a>
+  800c2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5f                   	pop    %edi
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+  800c32:	83 ec 0c             	sub    $0xc,%esp
+  800c35:	50                   	push   %eax
+  800c36:	6a 03                	push   $0x3
+  800c38:	68 cb 34 80 00       	push   $0x8034cb
+  800c3d:	6a 24                	push   $0x24
+  800c3f:	68 e8 34 80 00       	push   $0x8034e8
+  800c44:	e8 37 20 00 00       	call   802c80 <_panic>
+
+00800c49 <sys_getenvid>:
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	57                   	push   %edi
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+  800c4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c54:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c59:	89 d1                	mov    %edx,%ecx
+  800c5b:	89 d3                	mov    %edx,%ebx
+  800c5d:	89 d7                	mov    %edx,%edi
+  800c5f:	89 d6                	mov    %edx,%esi
+  800c61:	cd 30                	int    $0x30
+  800c63:	5b                   	pop    %ebx
+  800c64:	5e                   	pop    %esi
+  800c65:	5f                   	pop    %edi
+  800c66:	5d                   	pop    %ebp
+  800c67:	c3                   	ret
+
+00800c68 <sys_yield>:
+  800c68:	55                   	push   %ebp
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	57                   	push   %edi
+  800c6c:	56                   	push   %esi
+  800c6d:	53                   	push   %ebx
+  800c6e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800c75:	74 26                	je     800c9d <sys_yield+0x35>
+  800c77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c81:	89 d1                	mov    %edx,%ecx
+  800c83:	89 d3                	mov    %edx,%ebx
+  800c85:	89 d7                	mov    %edx,%edi
+  800c87:	6a 00                	push   $0x0
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	8d 35 94 0c 80 00    	lea    0x800c94,%esi
+  800c92:	0f 34                	sysenter
+  800c94:	5d                   	pop    %ebp
+  800c95:	83 c4 04             	add    $0x4,%esp
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+  800c9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca7:	89 d1                	mov    %edx,%ecx
+  800ca9:	89 d3                	mov    %edx,%ebx
+  800cab:	89 d7                	mov    %edx,%edi
+  800cad:	89 d6                	mov    %edx,%esi
+  800caf:	cd 30                	int    $0x30
+  800cb1:	eb e5                	jmp    800c98 <sys_yield+0x30>
+
+00800cb3 <sys_page_alloc>:
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	57                   	push   %edi
+  800cb7:	56                   	push   %esi
+  800cb8:	53                   	push   %ebx
+  800cb9:	83 ec 0c             	sub    $0xc,%esp
+  800cbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ccc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ccf:	89 f7                	mov    %esi,%edi
+  800cd1:	cd 30                	int    $0x30
+  800cd3:	85 c0                	test   %eax,%eax
+  800cd5:	7f 08                	jg     800cdf <sys_page_alloc+0x2c>
+  800cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+  800ce2:	50                   	push   %eax
+  800ce3:	6a 04                	push   $0x4
+  800ce5:	68 cb 34 80 00       	push   $0x8034cb
+  800cea:	6a 24                	push   $0x24
+  800cec:	68 e8 34 80 00       	push   $0x8034e8
+  800cf1:	e8 8a 1f 00 00       	call   802c80 <_panic>
+
+00800cf6 <sys_page_map>:
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	57                   	push   %edi
+  800cfa:	56                   	push   %esi
+  800cfb:	53                   	push   %ebx
+  800cfc:	83 ec 0c             	sub    $0xc,%esp
+  800cff:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d06:	74 33                	je     800d3b <sys_page_map+0x45>
+  800d08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d16:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d19:	ff 75 18             	push   0x18(%ebp)
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	8d 35 27 0d 80 00    	lea    0x800d27,%esi
+  800d25:	0f 34                	sysenter
+  800d27:	5d                   	pop    %ebp
+  800d28:	83 c4 04             	add    $0x4,%esp
+  800d2b:	89 c2                	mov    %eax,%edx
+  800d2d:	85 c0                	test   %eax,%eax
+  800d2f:	7f 3d                	jg     800d6e <sys_page_map+0x78>
+  800d31:	89 d0                	mov    %edx,%eax
+  800d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d36:	5b                   	pop    %ebx
+  800d37:	5e                   	pop    %esi
+  800d38:	5f                   	pop    %edi
+  800d39:	5d                   	pop    %ebp
+  800d3a:	c3                   	ret
+  800d3b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d49:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d4c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d4f:	cd 30                	int    $0x30
+  800d51:	89 c2                	mov    %eax,%edx
+  800d53:	85 c0                	test   %eax,%eax
+  800d55:	7e da                	jle    800d31 <sys_page_map+0x3b>
+  800d57:	83 ec 0c             	sub    $0xc,%esp
+  800d5a:	50                   	push   %eax
+  800d5b:	6a 05                	push   $0x5
+  800d5d:	68 cb 34 80 00       	push   $0x8034cb
+  800d62:	6a 24                	push   $0x24
+  800d64:	68 e8 34 80 00       	push   $0x8034e8
+  800d69:	e8 12 1f 00 00       	call   802c80 <_panic>
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+  800d71:	50                   	push   %eax
+  800d72:	6a 05                	push   $0x5
+  800d74:	68 cb 34 80 00       	push   $0x8034cb
+  800d79:	6a 48                	push   $0x48
+  800d7b:	68 e8 34 80 00       	push   $0x8034e8
+  800d80:	e8 fb 1e 00 00       	call   802c80 <_panic>
+
+00800d85 <sys_page_unmap>:
+  800d85:	55                   	push   %ebp
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	57                   	push   %edi
+  800d89:	56                   	push   %esi
+  800d8a:	53                   	push   %ebx
+  800d8b:	83 ec 0c             	sub    $0xc,%esp
+  800d8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d99:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d9e:	89 df                	mov    %ebx,%edi
+  800da0:	89 de                	mov    %ebx,%esi
+  800da2:	cd 30                	int    $0x30
+  800da4:	85 c0                	test   %eax,%eax
+  800da6:	7f 08                	jg     800db0 <sys_page_unmap+0x2b>
+  800da8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dab:	5b                   	pop    %ebx
+  800dac:	5e                   	pop    %esi
+  800dad:	5f                   	pop    %edi
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+  800db0:	83 ec 0c             	sub    $0xc,%esp
+  800db3:	50                   	push   %eax
+  800db4:	6a 06                	push   $0x6
+  800db6:	68 cb 34 80 00       	push   $0x8034cb
+  800dbb:	6a 24                	push   $0x24
+  800dbd:	68 e8 34 80 00       	push   $0x8034e8
+  800dc2:	e8 b9 1e 00 00       	call   802c80 <_panic>
+
+00800dc7 <sys_fork>:
+  800dc7:	55                   	push   %ebp
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	57                   	push   %edi
+  800dcb:	56                   	push   %esi
+  800dcc:	53                   	push   %ebx
+  800dcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800dd7:	89 d1                	mov    %edx,%ecx
+  800dd9:	89 d3                	mov    %edx,%ebx
+  800ddb:	89 d7                	mov    %edx,%edi
+  800ddd:	89 d6                	mov    %edx,%esi
+  800ddf:	cd 30                	int    $0x30
+  800de1:	5b                   	pop    %ebx
+  800de2:	5e                   	pop    %esi
+  800de3:	5f                   	pop    %edi
+  800de4:	5d                   	pop    %ebp
+  800de5:	c3                   	ret
+
+00800de6 <sys_env_set_status>:
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	57                   	push   %edi
+  800dea:	56                   	push   %esi
+  800deb:	53                   	push   %ebx
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+  800def:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dff:	89 df                	mov    %ebx,%edi
+  800e01:	89 de                	mov    %ebx,%esi
+  800e03:	cd 30                	int    $0x30
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 08                	jg     800e11 <sys_env_set_status+0x2b>
+  800e09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  800e14:	50                   	push   %eax
+  800e15:	6a 08                	push   $0x8
+  800e17:	68 cb 34 80 00       	push   $0x8034cb
+  800e1c:	6a 24                	push   $0x24
+  800e1e:	68 e8 34 80 00       	push   $0x8034e8
+  800e23:	e8 58 1e 00 00       	call   802c80 <_panic>
+
+00800e28 <sys_env_set_trapframe>:
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+  800e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e41:	89 df                	mov    %ebx,%edi
+  800e43:	89 de                	mov    %ebx,%esi
+  800e45:	cd 30                	int    $0x30
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_env_set_trapframe+0x2b>
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 09                	push   $0x9
+  800e59:	68 cb 34 80 00       	push   $0x8034cb
+  800e5e:	6a 24                	push   $0x24
+  800e60:	68 e8 34 80 00       	push   $0x8034e8
+  800e65:	e8 16 1e 00 00       	call   802c80 <_panic>
+
+00800e6a <sys_env_set_cow>:
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  800e70:	83 ec 0c             	sub    $0xc,%esp
+  800e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7e:	b8 20 00 00 00       	mov    $0x20,%eax
+  800e83:	89 df                	mov    %ebx,%edi
+  800e85:	89 de                	mov    %ebx,%esi
+  800e87:	cd 30                	int    $0x30
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 08                	jg     800e95 <sys_env_set_cow+0x2b>
+  800e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	50                   	push   %eax
+  800e99:	6a 20                	push   $0x20
+  800e9b:	68 cb 34 80 00       	push   $0x8034cb
+  800ea0:	6a 24                	push   $0x24
+  800ea2:	68 e8 34 80 00       	push   $0x8034e8
+  800ea7:	e8 d4 1d 00 00       	call   802c80 <_panic>
+
+00800eac <sys_env_service>:
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	b8 21 00 00 00       	mov    $0x21,%eax
+  800ebf:	89 cb                	mov    %ecx,%ebx
+  800ec1:	89 cf                	mov    %ecx,%edi
+  800ec3:	89 ce                	mov    %ecx,%esi
+  800ec5:	cd 30                	int    $0x30
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+
+00800ecc <sys_env_set_pgfault_upcall>:
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	57                   	push   %edi
+  800ed0:	56                   	push   %esi
+  800ed1:	53                   	push   %ebx
+  800ed2:	83 ec 0c             	sub    $0xc,%esp
+  800ed5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee5:	89 df                	mov    %ebx,%edi
+  800ee7:	89 de                	mov    %ebx,%esi
+  800ee9:	cd 30                	int    $0x30
+  800eeb:	85 c0                	test   %eax,%eax
+  800eed:	7f 08                	jg     800ef7 <sys_env_set_pgfault_upcall+0x2b>
+  800eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5e                   	pop    %esi
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+  800ef7:	83 ec 0c             	sub    $0xc,%esp
+  800efa:	50                   	push   %eax
+  800efb:	6a 0a                	push   $0xa
+  800efd:	68 cb 34 80 00       	push   $0x8034cb
+  800f02:	6a 24                	push   $0x24
+  800f04:	68 e8 34 80 00       	push   $0x8034e8
+  800f09:	e8 72 1d 00 00       	call   802c80 <_panic>
+
+00800f0e <sys_ipc_try_send>:
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+  800f14:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f1b:	74 27                	je     800f44 <sys_ipc_try_send+0x36>
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2e:	6a 00                	push   $0x0
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	8d 35 3b 0f 80 00    	lea    0x800f3b,%esi
+  800f39:	0f 34                	sysenter
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	83 c4 04             	add    $0x4,%esp
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+  800f44:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f49:	be 00 00 00 00       	mov    $0x0,%esi
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5a:	cd 30                	int    $0x30
+  800f5c:	eb e1                	jmp    800f3f <sys_ipc_try_send+0x31>
+
+00800f5e <sys_ipc_recv>:
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f6e:	74 32                	je     800fa2 <sys_ipc_recv+0x44>
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f78:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f7d:	89 cb                	mov    %ecx,%ebx
+  800f7f:	89 cf                	mov    %ecx,%edi
+  800f81:	6a 00                	push   $0x0
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+  800f8e:	5d                   	pop    %ebp
+  800f8f:	83 c4 04             	add    $0x4,%esp
+  800f92:	89 c2                	mov    %eax,%edx
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 3c                	jg     800fd4 <sys_ipc_recv+0x76>
+  800f98:	89 d0                	mov    %edx,%eax
+  800f9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9d:	5b                   	pop    %ebx
+  800f9e:	5e                   	pop    %esi
+  800f9f:	5f                   	pop    %edi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+  800fa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faf:	89 cb                	mov    %ecx,%ebx
+  800fb1:	89 cf                	mov    %ecx,%edi
+  800fb3:	89 ce                	mov    %ecx,%esi
+  800fb5:	cd 30                	int    $0x30
+  800fb7:	89 c2                	mov    %eax,%edx
+  800fb9:	85 c0                	test   %eax,%eax
+  800fbb:	7e db                	jle    800f98 <sys_ipc_recv+0x3a>
+  800fbd:	83 ec 0c             	sub    $0xc,%esp
+  800fc0:	50                   	push   %eax
+  800fc1:	6a 0d                	push   $0xd
+  800fc3:	68 cb 34 80 00       	push   $0x8034cb
+  800fc8:	6a 24                	push   $0x24
+  800fca:	68 e8 34 80 00       	push   $0x8034e8
+  800fcf:	e8 ac 1c 00 00       	call   802c80 <_panic>
+  800fd4:	83 ec 0c             	sub    $0xc,%esp
+  800fd7:	50                   	push   %eax
+  800fd8:	6a 0d                	push   $0xd
+  800fda:	68 cb 34 80 00       	push   $0x8034cb
+  800fdf:	6a 48                	push   $0x48
+  800fe1:	68 e8 34 80 00       	push   $0x8034e8
+  800fe6:	e8 95 1c 00 00       	call   802c80 <_panic>
+
+00800feb <sys_ipc_send>:
+  800feb:	55                   	push   %ebp
+  800fec:	89 e5                	mov    %esp,%ebp
+  800fee:	57                   	push   %edi
+  800fef:	56                   	push   %esi
+  800ff0:	53                   	push   %ebx
+  800ff1:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ff8:	74 27                	je     801021 <sys_ipc_send+0x36>
+  800ffa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801000:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801005:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801008:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80100b:	6a 00                	push   $0x0
+  80100d:	55                   	push   %ebp
+  80100e:	89 e5                	mov    %esp,%ebp
+  801010:	8d 35 18 10 80 00    	lea    0x801018,%esi
+  801016:	0f 34                	sysenter
+  801018:	5d                   	pop    %ebp
+  801019:	83 c4 04             	add    $0x4,%esp
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+  801021:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801026:	be 00 00 00 00       	mov    $0x0,%esi
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801031:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801034:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801037:	cd 30                	int    $0x30
+  801039:	eb e1                	jmp    80101c <sys_ipc_send+0x31>
+
+0080103b <sys_ipc_call>:
+  80103b:	55                   	push   %ebp
+  80103c:	89 e5                	mov    %esp,%ebp
+  80103e:	57                   	push   %edi
+  80103f:	56                   	push   %esi
+  801040:	53                   	push   %ebx
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80104c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801052:	8b 75 18             	mov    0x18(%ebp),%esi
+  801055:	cd 30                	int    $0x30
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5f                   	pop    %edi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+
+0080105c <sys_ipc_reply_recv>:
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	57                   	push   %edi
+  801060:	56                   	push   %esi
+  801061:	53                   	push   %ebx
+  801062:	8b 55 08             	mov    0x8(%ebp),%edx
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	b8 10 00 00 00       	mov    $0x10,%eax
+  80106d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801070:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801073:	8b 75 18             	mov    0x18(%ebp),%esi
+  801076:	cd 30                	int    $0x30
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+
+0080107d <sys_time_msec>:
+  80107d:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801082:	85 c0                	test   %eax,%eax
+  801084:	75 06                	jne    80108c <sys_time_msec+0xf>
+  801086:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80108b:	c3                   	ret
+  80108c:	55                   	push   %ebp
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	57                   	push   %edi
+  801090:	56                   	push   %esi
+  801091:	53                   	push   %ebx
+  801092:	83 ec 0c             	sub    $0xc,%esp
+  801095:	0f 31                	rdtsc
+  801097:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80109d:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8010a3:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8010a9:	29 c8                	sub    %ecx,%eax
+  8010ab:	19 da                	sbb    %ebx,%edx
+  8010ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b2:	57                   	push   %edi
+  8010b3:	56                   	push   %esi
+  8010b4:	52                   	push   %edx
+  8010b5:	50                   	push   %eax
+  8010b6:	e8 91 1f 00 00       	call   80304c <__udivdi3>
+  8010bb:	83 c4 10             	add    $0x10,%esp
+  8010be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <sys_env_swap>:
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+  8010cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010dc:	89 cb                	mov    %ecx,%ebx
+  8010de:	89 cf                	mov    %ecx,%edi
+  8010e0:	89 ce                	mov    %ecx,%esi
+  8010e2:	cd 30                	int    $0x30
+  8010e4:	85 c0                	test   %eax,%eax
+  8010e6:	7f 08                	jg     8010f0 <sys_env_swap+0x2a>
+  8010e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010eb:	5b                   	pop    %ebx
+  8010ec:	5e                   	pop    %esi
+  8010ed:	5f                   	pop    %edi
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+  8010f3:	50                   	push   %eax
+  8010f4:	6a 12                	push   $0x12
+  8010f6:	68 cb 34 80 00       	push   $0x8034cb
+  8010fb:	6a 24                	push   $0x24
+  8010fd:	68 e8 34 80 00       	push   $0x8034e8
+  801102:	e8 79 1b 00 00       	call   802c80 <_panic>
+
+00801107 <sys_net_try_send>:
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	57                   	push   %edi
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801115:	8b 55 08             	mov    0x8(%ebp),%edx
+  801118:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801120:	89 df                	mov    %ebx,%edi
+  801122:	89 de                	mov    %ebx,%esi
+  801124:	cd 30                	int    $0x30
+  801126:	85 c0                	test   %eax,%eax
+  801128:	7f 08                	jg     801132 <sys_net_try_send+0x2b>
+  80112a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+  801132:	83 ec 0c             	sub    $0xc,%esp
+  801135:	50                   	push   %eax
+  801136:	6a 13                	push   $0x13
+  801138:	68 cb 34 80 00       	push   $0x8034cb
+  80113d:	6a 24                	push   $0x24
+  80113f:	68 e8 34 80 00       	push   $0x8034e8
+  801144:	e8 37 1b 00 00       	call   802c80 <_panic>
+
+00801149 <sys_net_try_receive>:
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+  801152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801162:	89 df                	mov    %ebx,%edi
+  801164:	89 de                	mov    %ebx,%esi
+  801166:	cd 30                	int    $0x30
+  801168:	85 c0                	test   %eax,%eax
+  80116a:	7f 08                	jg     801174 <sys_net_try_receive+0x2b>
+  80116c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116f:	5b                   	pop    %ebx
+  801170:	5e                   	pop    %esi
+  801171:	5f                   	pop    %edi
+  801172:	5d                   	pop    %ebp
+  801173:	c3                   	ret
+  801174:	83 ec 0c             	sub    $0xc,%esp
+  801177:	50                   	push   %eax
+  801178:	6a 14                	push   $0x14
+  80117a:	68 cb 34 80 00       	push   $0x8034cb
+  80117f:	6a 24                	push   $0x24
+  801181:	68 e8 34 80 00       	push   $0x8034e8
+  801186:	e8 f5 1a 00 00       	call   802c80 <_panic>
+
+0080118b <sys_net_recv_page>:
+  80118b:	55                   	push   %ebp
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	57                   	push   %edi
+  80118f:	56                   	push   %esi
+  801190:	53                   	push   %ebx
+  801191:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801196:	8b 55 08             	mov    0x8(%ebp),%edx
+  801199:	b8 27 00 00 00       	mov    $0x27,%eax
+  80119e:	89 cb                	mov    %ecx,%ebx
+  8011a0:	89 cf                	mov    %ecx,%edi
+  8011a2:	89 ce                	mov    %ecx,%esi
+  8011a4:	cd 30                	int    $0x30
+  8011a6:	5b                   	pop    %ebx
+  8011a7:	5e                   	pop    %esi
+  8011a8:	5f                   	pop    %edi
+  8011a9:	5d                   	pop    %ebp
+  8011aa:	c3                   	ret
+
+008011ab <sys_net_wait>:
+  8011ab:	55                   	push   %ebp
+  8011ac:	89 e5                	mov    %esp,%ebp
+  8011ae:	57                   	push   %edi
+  8011af:	56                   	push   %esi
+  8011b0:	53                   	push   %ebx
+  8011b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b6:	b8 26 00 00 00       	mov    $0x26,%eax
+  8011bb:	89 d1                	mov    %edx,%ecx
+  8011bd:	89 d3                	mov    %edx,%ebx
+  8011bf:	89 d7                	mov    %edx,%edi
+  8011c1:	89 d6                	mov    %edx,%esi
+  8011c3:	cd 30                	int    $0x30
+  8011c5:	5b                   	pop    %ebx
+  8011c6:	5e                   	pop    %esi
+  8011c7:	5f                   	pop    %edi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	c3                   	ret
+
+008011ca <sys_get_mac>:
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011e3:	89 df                	mov    %ebx,%edi
+  8011e5:	89 de                	mov    %ebx,%esi
+  8011e7:	cd 30                	int    $0x30
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	7f 08                	jg     8011f5 <sys_get_mac+0x2b>
+  8011ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f0:	5b                   	pop    %ebx
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5f                   	pop    %edi
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	c3                   	ret
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	50                   	push   %eax
+  8011f9:	6a 15                	push   $0x15
+  8011fb:	68 cb 34 80 00       	push   $0x8034cb
+  801200:	6a 24                	push   $0x24
+  801202:	68 e8 34 80 00       	push   $0x8034e8
+  801207:	e8 74 1a 00 00       	call   802c80 <_panic>
+
+0080120c <sys_env_lease>:
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+  801212:	83 ec 0c             	sub    $0xc,%esp
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801220:	b8 16 00 00 00       	mov    $0x16,%eax
+  801225:	89 df                	mov    %ebx,%edi
+  801227:	89 de                	mov    %ebx,%esi
+  801229:	cd 30                	int    $0x30
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	7f 08                	jg     801237 <sys_env_lease+0x2b>
+  80122f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801232:	5b                   	pop    %ebx
+  801233:	5e                   	pop    %esi
+  801234:	5f                   	pop    %edi
+  801235:	5d                   	pop    %ebp
+  801236:	c3                   	ret
+  801237:	83 ec 0c             	sub    $0xc,%esp
+  80123a:	50                   	push   %eax
+  80123b:	6a 16                	push   $0x16
+  80123d:	68 cb 34 80 00       	push   $0x8034cb
+  801242:	6a 24                	push   $0x24
+  801244:	68 e8 34 80 00       	push   $0x8034e8
+  801249:	e8 32 1a 00 00       	call   802c80 <_panic>
+
+0080124e <sys_copy_mem>:
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	57                   	push   %edi
+  801252:	56                   	push   %esi
+  801253:	53                   	push   %ebx
+  801254:	83 ec 0c             	sub    $0xc,%esp
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801262:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801265:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801268:	8b 75 18             	mov    0x18(%ebp),%esi
+  80126b:	cd 30                	int    $0x30
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	7f 08                	jg     801279 <sys_copy_mem+0x2b>
+  801271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801274:	5b                   	pop    %ebx
+  801275:	5e                   	pop    %esi
+  801276:	5f                   	pop    %edi
+  801277:	5d                   	pop    %ebp
+  801278:	c3                   	ret
+  801279:	83 ec 0c             	sub    $0xc,%esp
+  80127c:	50                   	push   %eax
+  80127d:	6a 17                	push   $0x17
+  80127f:	68 cb 34 80 00       	push   $0x8034cb
+  801284:	6a 24                	push   $0x24
+  801286:	68 e8 34 80 00       	push   $0x8034e8
+  80128b:	e8 f0 19 00 00       	call   802c80 <_panic>
+
+00801290 <sys_get_perms>:
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	57                   	push   %edi
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+  801296:	83 ec 0c             	sub    $0xc,%esp
+  801299:	be 00 00 00 00       	mov    $0x0,%esi
+  80129e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ac:	89 f7                	mov    %esi,%edi
+  8012ae:	cd 30                	int    $0x30
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	7f 08                	jg     8012bc <sys_get_perms+0x2c>
+  8012b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b7:	5b                   	pop    %ebx
+  8012b8:	5e                   	pop    %esi
+  8012b9:	5f                   	pop    %edi
+  8012ba:	5d                   	pop    %ebp
+  8012bb:	c3                   	ret
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+  8012bf:	50                   	push   %eax
+  8012c0:	6a 18                	push   $0x18
+  8012c2:	68 cb 34 80 00       	push   $0x8034cb
+  8012c7:	6a 24                	push   $0x24
+  8012c9:	68 e8 34 80 00       	push   $0x8034e8
+  8012ce:	e8 ad 19 00 00       	call   802c80 <_panic>
+
+008012d3 <sys_env_unsuspend>:
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	57                   	push   %edi
+  8012d7:	56                   	push   %esi
+  8012d8:	53                   	push   %ebx
+  8012d9:	83 ec 0c             	sub    $0xc,%esp
+  8012dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e7:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ef:	89 f7                	mov    %esi,%edi
+  8012f1:	cd 30                	int    $0x30
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	7f 08                	jg     8012ff <sys_env_unsuspend+0x2c>
+  8012f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fa:	5b                   	pop    %ebx
+  8012fb:	5e                   	pop    %esi
+  8012fc:	5f                   	pop    %edi
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	50                   	push   %eax
+  801303:	6a 19                	push   $0x19
+  801305:	68 cb 34 80 00       	push   $0x8034cb
+  80130a:	6a 24                	push   $0x24
+  80130c:	68 e8 34 80 00       	push   $0x8034e8
+  801311:	e8 6a 19 00 00       	call   802c80 <_panic>
+
+00801316 <sys_migrate>:
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	57                   	push   %edi
+  80131a:	56                   	push   %esi
+  80131b:	53                   	push   %ebx
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+  80131f:	ba 00 80 80 00       	mov    $0x808000,%edx
+  801324:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80132a:	76 11                	jbe    80133d <sys_migrate+0x27>
+  80132c:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801331:	0f b6 08             	movzbl (%eax),%ecx
+  801334:	05 00 10 00 00       	add    $0x1000,%eax
+  801339:	39 d0                	cmp    %edx,%eax
+  80133b:	72 f4                	jb     801331 <sys_migrate+0x1b>
+  80133d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80134a:	89 cb                	mov    %ecx,%ebx
+  80134c:	89 cf                	mov    %ecx,%edi
+  80134e:	89 ce                	mov    %ecx,%esi
+  801350:	cd 30                	int    $0x30
+  801352:	85 c0                	test   %eax,%eax
+  801354:	7f 08                	jg     80135e <sys_migrate+0x48>
+  801356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801359:	5b                   	pop    %ebx
+  80135a:	5e                   	pop    %esi
+  80135b:	5f                   	pop    %edi
+  80135c:	5d                   	pop    %ebp
+  80135d:	c3                   	ret
+  80135e:	83 ec 0c             	sub    $0xc,%esp
+  801361:	50                   	push   %eax
+  801362:	6a 1a                	push   $0x1a
+  801364:	68 cb 34 80 00       	push   $0x8034cb
+  801369:	6a 24                	push   $0x24
+  80136b:	68 e8 34 80 00       	push   $0x8034e8
+  801370:	e8 0b 19 00 00       	call   802c80 <_panic>
+
+00801375 <sys_lease_complete>:
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+  801378:	57                   	push   %edi
+  801379:	56                   	push   %esi
+  80137a:	53                   	push   %ebx
+  80137b:	83 ec 0c             	sub    $0xc,%esp
+  80137e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801383:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801388:	89 d1                	mov    %edx,%ecx
+  80138a:	89 d3                	mov    %edx,%ebx
+  80138c:	89 d7                	mov    %edx,%edi
+  80138e:	89 d6                	mov    %edx,%esi
+  801390:	cd 30                	int    $0x30
+  801392:	85 c0                	test   %eax,%eax
+  801394:	7f 08                	jg     80139e <sys_lease_complete+0x29>
+  801396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801399:	5b                   	pop    %ebx
+  80139a:	5e                   	pop    %esi
+  80139b:	5f                   	pop    %edi
+  80139c:	5d                   	pop    %ebp
+  80139d:	c3                   	ret
+  80139e:	83 ec 0c             	sub    $0xc,%esp
+  8013a1:	50                   	push   %eax
+  8013a2:	6a 1b                	push   $0x1b
+  8013a4:	68 cb 34 80 00       	push   $0x8034cb
+  8013a9:	6a 24                	push   $0x24
+  8013ab:	68 e8 34 80 00       	push   $0x8034e8
+  8013b0:	e8 cb 18 00 00       	call   802c80 <_panic>
+
+008013b5 <sys_env_set_thisenv>:
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	57                   	push   %edi
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  8013be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013ce:	89 df                	mov    %ebx,%edi
+  8013d0:	89 de                	mov    %ebx,%esi
+  8013d2:	cd 30                	int    $0x30
+  8013d4:	85 c0                	test   %eax,%eax
+  8013d6:	7f 08                	jg     8013e0 <sys_env_set_thisenv+0x2b>
+  8013d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+  8013e0:	83 ec 0c             	sub    $0xc,%esp
+  8013e3:	50                   	push   %eax
+  8013e4:	6a 1c                	push   $0x1c
+  8013e6:	68 cb 34 80 00       	push   $0x8034cb
+  8013eb:	6a 24                	push   $0x24
+  8013ed:	68 e8 34 80 00       	push   $0x8034e8
+  8013f2:	e8 89 18 00 00       	call   802c80 <_panic>
+
+008013f7 <sys_env_set_sched>:
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	57                   	push   %edi
+  8013fb:	56                   	push   %esi
+  8013fc:	53                   	push   %ebx
+  8013fd:	83 ec 0c             	sub    $0xc,%esp
+  801400:	be 00 00 00 00       	mov    $0x0,%esi
+  801405:	8b 55 08             	mov    0x8(%ebp),%edx
+  801408:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801410:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801413:	89 f7                	mov    %esi,%edi
+  801415:	cd 30                	int    $0x30
+  801417:	85 c0                	test   %eax,%eax
+  801419:	7f 08                	jg     801423 <sys_env_set_sched+0x2c>
+  80141b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141e:	5b                   	pop    %ebx
+  80141f:	5e                   	pop    %esi
+  801420:	5f                   	pop    %edi
+  801421:	5d                   	pop    %ebp
+  801422:	c3                   	ret
+  801423:	83 ec 0c             	sub    $0xc,%esp
+  801426:	50                   	push   %eax
+  801427:	6a 1d                	push   $0x1d
+  801429:	68 cb 34 80 00       	push   $0x8034cb
+  80142e:	6a 24                	push   $0x24
+  801430:	68 e8 34 80 00       	push   $0x8034e8
+  801435:	e8 46 18 00 00       	call   802c80 <_panic>
+
+0080143a <sys_batch>:
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	57                   	push   %edi
+  80143e:	56                   	push   %esi
+  80143f:	53                   	push   %ebx
+  801440:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801445:	8b 55 08             	mov    0x8(%ebp),%edx
+  801448:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801450:	89 df                	mov    %ebx,%edi
+  801452:	89 de                	mov    %ebx,%esi
+  801454:	cd 30                	int    $0x30
+  801456:	5b                   	pop    %ebx
+  801457:	5e                   	pop    %esi
+  801458:	5f                   	pop    %edi
+  801459:	5d                   	pop    %ebp
+  80145a:	c3                   	ret
+
+0080145b <sys_env_stats>:
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	57                   	push   %edi
+  80145f:	56                   	push   %esi
+  801460:	53                   	push   %ebx
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801466:	8b 55 08             	mov    0x8(%ebp),%edx
+  801469:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146c:	b8 23 00 00 00       	mov    $0x23,%eax
+  801471:	89 df                	mov    %ebx,%edi
+  801473:	89 de                	mov    %ebx,%esi
+  801475:	cd 30                	int    $0x30
+  801477:	5b                   	pop    %ebx
+  801478:	5e                   	pop    %esi
+  801479:	5f                   	pop    %edi
+  80147a:	5d                   	pop    %ebp
+  80147b:	c3                   	ret
+
+0080147c <sys_trace>:
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	57                   	push   %edi
+  801480:	56                   	push   %esi
+  801481:	53                   	push   %ebx
+  801482:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148a:	b8 24 00 00 00       	mov    $0x24,%eax
+  80148f:	89 cb                	mov    %ecx,%ebx
+  801491:	89 cf                	mov    %ecx,%edi
+  801493:	89 ce                	mov    %ecx,%esi
+  801495:	cd 30                	int    $0x30
+  801497:	5b                   	pop    %ebx
+  801498:	5e                   	pop    %esi
+  801499:	5f                   	pop    %edi
+  80149a:	5d                   	pop    %ebp
+  80149b:	c3                   	ret
+
+0080149c <sys_env_set_pager>:
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	57                   	push   %edi
+  8014a0:	56                   	push   %esi
+  8014a1:	53                   	push   %ebx
+  8014a2:	83 ec 0c             	sub    $0xc,%esp
+  8014a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b0:	b8 25 00 00 00       	mov    $0x25,%eax
+  8014b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b8:	89 f7                	mov    %esi,%edi
+  8014ba:	cd 30                	int    $0x30
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	7f 08                	jg     8014c8 <sys_env_set_pager+0x2c>
+  8014c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c3:	5b                   	pop    %ebx
+  8014c4:	5e                   	pop    %esi
+  8014c5:	5f                   	pop    %edi
+  8014c6:	5d                   	pop    %ebp
+  8014c7:	c3                   	ret
+  8014c8:	83 ec 0c             	sub    $0xc,%esp
+  8014cb:	50                   	push   %eax
+  8014cc:	6a 25                	push   $0x25
+  8014ce:	68 cb 34 80 00       	push   $0x8034cb
+  8014d3:	6a 24                	push   $0x24
+  8014d5:	68 e8 34 80 00       	push   $0x8034e8
+  8014da:	e8 a1 17 00 00       	call   802c80 <_panic>
+
+008014df <sys_pager_retire>:
+  8014df:	55                   	push   %ebp
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	57                   	push   %edi
+  8014e3:	56                   	push   %esi
+  8014e4:	53                   	push   %ebx
+  8014e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ed:	b8 28 00 00 00       	mov    $0x28,%eax
+  8014f2:	89 cb                	mov    %ecx,%ebx
+  8014f4:	89 cf                	mov    %ecx,%edi
+  8014f6:	89 ce                	mov    %ecx,%esi
+  8014f8:	cd 30                	int    $0x30
+  8014fa:	5b                   	pop    %ebx
+  8014fb:	5e                   	pop    %esi
+  8014fc:	5f                   	pop    %edi
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	c3                   	ret
+
+008014ff <sys_prof>:
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	57                   	push   %edi
+  801503:	56                   	push   %esi
+  801504:	53                   	push   %ebx
+  801505:	be 00 00 00 00       	mov    $0x0,%esi
+  80150a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801510:	b8 22 00 00 00       	mov    $0x22,%eax
+  801515:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801518:	89 f7                	mov    %esi,%edi
+  80151a:	cd 30                	int    $0x30
+  80151c:	5b                   	pop    %ebx
+  80151d:	5e                   	pop    %esi
+  80151e:	5f                   	pop    %edi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+
+00801521 <fd2num>:
+  801521:	55                   	push   %ebp
+  801522:	89 e5                	mov    %esp,%ebp
+  801524:	8b 45 08             	mov    0x8(%ebp),%eax
+  801527:	05 00 00 00 30       	add    $0x30000000,%eax
+  80152c:	c1 e8 0c             	shr    $0xc,%eax
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+
+00801531 <fd2data>:
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	8b 45 08             	mov    0x8(%ebp),%eax
+  801537:	05 00 00 00 30       	add    $0x30000000,%eax
+  80153c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801541:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801546:	5d                   	pop    %ebp
+  801547:	c3                   	ret
+
+00801548 <fd_alloc>:
+  801548:	55                   	push   %ebp
+  801549:	89 e5                	mov    %esp,%ebp
+  80154b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801550:	89 c2                	mov    %eax,%edx
+  801552:	c1 ea 16             	shr    $0x16,%edx
+  801555:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80155c:	f6 c2 01             	test   $0x1,%dl
+  80155f:	74 29                	je     80158a <fd_alloc+0x42>
+  801561:	89 c2                	mov    %eax,%edx
+  801563:	c1 ea 0c             	shr    $0xc,%edx
+  801566:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80156d:	f6 c2 01             	test   $0x1,%dl
+  801570:	74 18                	je     80158a <fd_alloc+0x42>
+  801572:	05 00 10 00 00       	add    $0x1000,%eax
+  801577:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80157c:	75 d2                	jne    801550 <fd_alloc+0x8>
+  80157e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801583:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801588:	eb 05                	jmp    80158f <fd_alloc+0x47>
+  80158a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	89 02                	mov    %eax,(%edx)
+  801594:	89 c8                	mov    %ecx,%eax
+  801596:	5d                   	pop    %ebp
+  801597:	c3                   	ret
+
+00801598 <fd_lookup>:
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80159e:	83 f8 1f             	cmp    $0x1f,%eax
+  8015a1:	77 30                	ja     8015d3 <fd_lookup+0x3b>
+  8015a3:	c1 e0 0c             	shl    $0xc,%eax
+  8015a6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8015ab:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015b1:	f6 c2 01             	test   $0x1,%dl
+  8015b4:	74 24                	je     8015da <fd_lookup+0x42>
+  8015b6:	89 c2                	mov    %eax,%edx
+  8015b8:	c1 ea 0c             	shr    $0xc,%edx
+  8015bb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015c2:	f6 c2 01             	test   $0x1,%dl
+  8015c5:	74 1a                	je     8015e1 <fd_lookup+0x49>
+  8015c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ca:	89 02                	mov    %eax,(%edx)
+  8015cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d1:	5d                   	pop    %ebp
+  8015d2:	c3                   	ret
+  8015d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d8:	eb f7                	jmp    8015d1 <fd_lookup+0x39>
+  8015da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015df:	eb f0                	jmp    8015d1 <fd_lookup+0x39>
+  8015e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e6:	eb e9                	jmp    8015d1 <fd_lookup+0x39>
+
+008015e8 <dev_lookup>:
+  8015e8:	55                   	push   %ebp
+  8015e9:	89 e5                	mov    %esp,%ebp
+  8015eb:	53                   	push   %ebx
+  8015ec:	83 ec 04             	sub    $0x4,%esp
+  8015ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f7:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8015fc:	39 13                	cmp    %edx,(%ebx)
+  8015fe:	74 37                	je     801637 <dev_lookup+0x4f>
+  801600:	83 c0 01             	add    $0x1,%eax
+  801603:	8b 1c 85 74 35 80 00 	mov    0x803574(,%eax,4),%ebx
+  80160a:	85 db                	test   %ebx,%ebx
+  80160c:	75 ee                	jne    8015fc <dev_lookup+0x14>
+  80160e:	a1 10 50 80 00       	mov    0x805010,%eax
+  801613:	8b 40 48             	mov    0x48(%eax),%eax
+  801616:	83 ec 04             	sub    $0x4,%esp
+  801619:	52                   	push   %edx
+  80161a:	50                   	push   %eax
+  80161b:	68 f8 34 80 00       	push   $0x8034f8
+  801620:	e8 37 eb ff ff       	call   80015c <cprintf>
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80162d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801630:	89 1a                	mov    %ebx,(%edx)
+  801632:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801635:	c9                   	leave
+  801636:	c3                   	ret
+  801637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163c:	eb ef                	jmp    80162d <dev_lookup+0x45>
+
+0080163e <fd_close>:
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  801641:	57                   	push   %edi
+  801642:	56                   	push   %esi
+  801643:	53                   	push   %ebx
+  801644:	83 ec 24             	sub    $0x24,%esp
+  801647:	8b 75 08             	mov    0x8(%ebp),%esi
+  80164a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80164d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801650:	50                   	push   %eax
+  801651:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801657:	c1 e8 0c             	shr    $0xc,%eax
+  80165a:	50                   	push   %eax
+  80165b:	e8 38 ff ff ff       	call   801598 <fd_lookup>
+  801660:	89 c3                	mov    %eax,%ebx
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 05                	js     80166e <fd_close+0x30>
+  801669:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80166c:	74 0f                	je     80167d <fd_close+0x3f>
+  80166e:	85 ff                	test   %edi,%edi
+  801670:	0f 44 df             	cmove  %edi,%ebx
+  801673:	89 d8                	mov    %ebx,%eax
+  801675:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801678:	5b                   	pop    %ebx
+  801679:	5e                   	pop    %esi
+  80167a:	5f                   	pop    %edi
+  80167b:	5d                   	pop    %ebp
+  80167c:	c3                   	ret
+  80167d:	83 ec 08             	sub    $0x8,%esp
+  801680:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801683:	50                   	push   %eax
+  801684:	ff 36                	push   (%esi)
+  801686:	e8 5d ff ff ff       	call   8015e8 <dev_lookup>
+  80168b:	89 c3                	mov    %eax,%ebx
+  80168d:	83 c4 10             	add    $0x10,%esp
+  801690:	85 c0                	test   %eax,%eax
+  801692:	78 1a                	js     8016ae <fd_close+0x70>
+  801694:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801697:	8b 40 10             	mov    0x10(%eax),%eax
+  80169a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	74 0b                	je     8016ae <fd_close+0x70>
+  8016a3:	83 ec 0c             	sub    $0xc,%esp
+  8016a6:	56                   	push   %esi
+  8016a7:	ff d0                	call   *%eax
+  8016a9:	89 c3                	mov    %eax,%ebx
+  8016ab:	83 c4 10             	add    $0x10,%esp
+  8016ae:	83 ec 08             	sub    $0x8,%esp
+  8016b1:	56                   	push   %esi
+  8016b2:	6a 00                	push   $0x0
+  8016b4:	e8 cc f6 ff ff       	call   800d85 <sys_page_unmap>
+  8016b9:	83 c4 10             	add    $0x10,%esp
+  8016bc:	eb b5                	jmp    801673 <fd_close+0x35>
+
+008016be <close>:
+  8016be:	55                   	push   %ebp
+  8016bf:	89 e5                	mov    %esp,%ebp
+  8016c1:	83 ec 20             	sub    $0x20,%esp
+  8016c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c7:	50                   	push   %eax
+  8016c8:	ff 75 08             	push   0x8(%ebp)
+  8016cb:	e8 c8 fe ff ff       	call   801598 <fd_lookup>
+  8016d0:	83 c4 10             	add    $0x10,%esp
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	79 02                	jns    8016d9 <close+0x1b>
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+  8016d9:	83 ec 08             	sub    $0x8,%esp
+  8016dc:	6a 01                	push   $0x1
+  8016de:	ff 75 f4             	push   -0xc(%ebp)
+  8016e1:	e8 58 ff ff ff       	call   80163e <fd_close>
+  8016e6:	83 c4 10             	add    $0x10,%esp
+  8016e9:	eb ec                	jmp    8016d7 <close+0x19>
+
+008016eb <close_all>:
+  8016eb:	55                   	push   %ebp
+  8016ec:	89 e5                	mov    %esp,%ebp
+  8016ee:	53                   	push   %ebx
+  8016ef:	83 ec 04             	sub    $0x4,%esp
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	83 ec 0c             	sub    $0xc,%esp
+  8016fa:	53                   	push   %ebx
+  8016fb:	e8 be ff ff ff       	call   8016be <close>
+  801700:	83 c3 01             	add    $0x1,%ebx
+  801703:	83 c4 10             	add    $0x10,%esp
+  801706:	83 fb 20             	cmp    $0x20,%ebx
+  801709:	75 ec                	jne    8016f7 <close_all+0xc>
+  80170b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170e:	c9                   	leave
+  80170f:	c3                   	ret
+
+00801710 <dup>:
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  801713:	57                   	push   %edi
+  801714:	56                   	push   %esi
+  801715:	53                   	push   %ebx
+  801716:	83 ec 34             	sub    $0x34,%esp
+  801719:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80171c:	50                   	push   %eax
+  80171d:	ff 75 08             	push   0x8(%ebp)
+  801720:	e8 73 fe ff ff       	call   801598 <fd_lookup>
+  801725:	89 c3                	mov    %eax,%ebx
+  801727:	83 c4 10             	add    $0x10,%esp
+  80172a:	85 c0                	test   %eax,%eax
+  80172c:	78 7f                	js     8017ad <dup+0x9d>
+  80172e:	83 ec 0c             	sub    $0xc,%esp
+  801731:	ff 75 0c             	push   0xc(%ebp)
+  801734:	e8 85 ff ff ff       	call   8016be <close>
+  801739:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80173c:	c1 e6 0c             	shl    $0xc,%esi
+  80173f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801745:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801748:	89 3c 24             	mov    %edi,(%esp)
+  80174b:	e8 e1 fd ff ff       	call   801531 <fd2data>
+  801750:	89 c3                	mov    %eax,%ebx
+  801752:	89 34 24             	mov    %esi,(%esp)
+  801755:	e8 d7 fd ff ff       	call   801531 <fd2data>
+  80175a:	83 c4 10             	add    $0x10,%esp
+  80175d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801760:	89 d8                	mov    %ebx,%eax
+  801762:	c1 e8 16             	shr    $0x16,%eax
+  801765:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80176c:	a8 01                	test   $0x1,%al
+  80176e:	74 11                	je     801781 <dup+0x71>
+  801770:	89 d8                	mov    %ebx,%eax
+  801772:	c1 e8 0c             	shr    $0xc,%eax
+  801775:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80177c:	f6 c2 01             	test   $0x1,%dl
+  80177f:	75 36                	jne    8017b7 <dup+0xa7>
+  801781:	89 f8                	mov    %edi,%eax
+  801783:	c1 e8 0c             	shr    $0xc,%eax
+  801786:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80178d:	83 ec 0c             	sub    $0xc,%esp
+  801790:	25 07 0e 00 00       	and    $0xe07,%eax
+  801795:	50                   	push   %eax
+  801796:	56                   	push   %esi
+  801797:	6a 00                	push   $0x0
+  801799:	57                   	push   %edi
+  80179a:	6a 00                	push   $0x0
+  80179c:	e8 55 f5 ff ff       	call   800cf6 <sys_page_map>
+  8017a1:	89 c3                	mov    %eax,%ebx
+  8017a3:	83 c4 20             	add    $0x20,%esp
+  8017a6:	85 c0                	test   %eax,%eax
+  8017a8:	78 33                	js     8017dd <dup+0xcd>
+  8017aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8017ad:	89 d8                	mov    %ebx,%eax
+  8017af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b2:	5b                   	pop    %ebx
+  8017b3:	5e                   	pop    %esi
+  8017b4:	5f                   	pop    %edi
+  8017b5:	5d                   	pop    %ebp
+  8017b6:	c3                   	ret
+  8017b7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017be:	83 ec 0c             	sub    $0xc,%esp
+  8017c1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017c6:	50                   	push   %eax
+  8017c7:	ff 75 d4             	push   -0x2c(%ebp)
+  8017ca:	6a 00                	push   $0x0
+  8017cc:	53                   	push   %ebx
+  8017cd:	6a 00                	push   $0x0
+  8017cf:	e8 22 f5 ff ff       	call   800cf6 <sys_page_map>
+  8017d4:	89 c3                	mov    %eax,%ebx
+  8017d6:	83 c4 20             	add    $0x20,%esp
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	79 a4                	jns    801781 <dup+0x71>
+  8017dd:	83 ec 08             	sub    $0x8,%esp
+  8017e0:	56                   	push   %esi
+  8017e1:	6a 00                	push   $0x0
+  8017e3:	e8 9d f5 ff ff       	call   800d85 <sys_page_unmap>
+  8017e8:	83 c4 08             	add    $0x8,%esp
+  8017eb:	ff 75 d4             	push   -0x2c(%ebp)
+  8017ee:	6a 00                	push   $0x0
+  8017f0:	e8 90 f5 ff ff       	call   800d85 <sys_page_unmap>
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	eb b3                	jmp    8017ad <dup+0x9d>
+
+008017fa <read>:
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	56                   	push   %esi
+  8017fe:	53                   	push   %ebx
+  8017ff:	83 ec 18             	sub    $0x18,%esp
+  801802:	8b 75 08             	mov    0x8(%ebp),%esi
+  801805:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801808:	50                   	push   %eax
+  801809:	56                   	push   %esi
+  80180a:	e8 89 fd ff ff       	call   801598 <fd_lookup>
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	85 c0                	test   %eax,%eax
+  801814:	78 3c                	js     801852 <read+0x58>
+  801816:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801819:	83 ec 08             	sub    $0x8,%esp
+  80181c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80181f:	50                   	push   %eax
+  801820:	ff 33                	push   (%ebx)
+  801822:	e8 c1 fd ff ff       	call   8015e8 <dev_lookup>
+  801827:	83 c4 10             	add    $0x10,%esp
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	78 24                	js     801852 <read+0x58>
+  80182e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801831:	83 e0 03             	and    $0x3,%eax
+  801834:	83 f8 01             	cmp    $0x1,%eax
+  801837:	74 20                	je     801859 <read+0x5f>
+  801839:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80183c:	8b 40 08             	mov    0x8(%eax),%eax
+  80183f:	85 c0                	test   %eax,%eax
+  801841:	74 37                	je     80187a <read+0x80>
+  801843:	83 ec 04             	sub    $0x4,%esp
+  801846:	ff 75 10             	push   0x10(%ebp)
+  801849:	ff 75 0c             	push   0xc(%ebp)
+  80184c:	53                   	push   %ebx
+  80184d:	ff d0                	call   *%eax
+  80184f:	83 c4 10             	add    $0x10,%esp
+  801852:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801855:	5b                   	pop    %ebx
+  801856:	5e                   	pop    %esi
+  801857:	5d                   	pop    %ebp
+  801858:	c3                   	ret
+  801859:	a1 10 50 80 00       	mov    0x805010,%eax
+  80185e:	8b 40 48             	mov    0x48(%eax),%eax
+  801861:	83 ec 04             	sub    $0x4,%esp
+  801864:	56                   	push   %esi
+  801865:	50                   	push   %eax
+  801866:	68 39 35 80 00       	push   $0x803539
+  80186b:	e8 ec e8 ff ff       	call   80015c <cprintf>
+  801870:	83 c4 10             	add    $0x10,%esp
+  801873:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801878:	eb d8                	jmp    801852 <read+0x58>
+  80187a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80187f:	eb d1                	jmp    801852 <read+0x58>
+
+00801881 <readn>:
+  801881:	55                   	push   %ebp
+  801882:	89 e5                	mov    %esp,%ebp
+  801884:	57                   	push   %edi
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+  801887:	83 ec 0c             	sub    $0xc,%esp
+  80188a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80188d:	8b 75 10             	mov    0x10(%ebp),%esi
+  801890:	85 f6                	test   %esi,%esi
+  801892:	74 30                	je     8018c4 <readn+0x43>
+  801894:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189e:	83 ec 04             	sub    $0x4,%esp
+  8018a1:	89 f2                	mov    %esi,%edx
+  8018a3:	29 c2                	sub    %eax,%edx
+  8018a5:	52                   	push   %edx
+  8018a6:	01 f8                	add    %edi,%eax
+  8018a8:	50                   	push   %eax
+  8018a9:	ff 75 08             	push   0x8(%ebp)
+  8018ac:	e8 49 ff ff ff       	call   8017fa <read>
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 15                	js     8018cd <readn+0x4c>
+  8018b8:	74 11                	je     8018cb <readn+0x4a>
+  8018ba:	01 c3                	add    %eax,%ebx
+  8018bc:	89 d8                	mov    %ebx,%eax
+  8018be:	39 f3                	cmp    %esi,%ebx
+  8018c0:	72 dc                	jb     80189e <readn+0x1d>
+  8018c2:	eb 09                	jmp    8018cd <readn+0x4c>
+  8018c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c9:	eb 02                	jmp    8018cd <readn+0x4c>
+  8018cb:	89 d8                	mov    %ebx,%eax
+  8018cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d0:	5b                   	pop    %ebx
+  8018d1:	5e                   	pop    %esi
+  8018d2:	5f                   	pop    %edi
+  8018d3:	5d                   	pop    %ebp
+  8018d4:	c3                   	ret
+
+008018d5 <write>:
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	56                   	push   %esi
+  8018d9:	53                   	push   %ebx
+  8018da:	83 ec 18             	sub    $0x18,%esp
+  8018dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e3:	50                   	push   %eax
+  8018e4:	53                   	push   %ebx
+  8018e5:	e8 ae fc ff ff       	call   801598 <fd_lookup>
+  8018ea:	83 c4 10             	add    $0x10,%esp
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	78 37                	js     801928 <write+0x53>
+  8018f1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018f4:	83 ec 08             	sub    $0x8,%esp
+  8018f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018fa:	50                   	push   %eax
+  8018fb:	ff 36                	push   (%esi)
+  8018fd:	e8 e6 fc ff ff       	call   8015e8 <dev_lookup>
+  801902:	83 c4 10             	add    $0x10,%esp
+  801905:	85 c0                	test   %eax,%eax
+  801907:	78 1f                	js     801928 <write+0x53>
+  801909:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80190d:	74 20                	je     80192f <write+0x5a>
+  80190f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801912:	8b 40 0c             	mov    0xc(%eax),%eax
+  801915:	85 c0                	test   %eax,%eax
+  801917:	74 37                	je     801950 <write+0x7b>
+  801919:	83 ec 04             	sub    $0x4,%esp
+  80191c:	ff 75 10             	push   0x10(%ebp)
+  80191f:	ff 75 0c             	push   0xc(%ebp)
+  801922:	56                   	push   %esi
+  801923:	ff d0                	call   *%eax
+  801925:	83 c4 10             	add    $0x10,%esp
+  801928:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192b:	5b                   	pop    %ebx
+  80192c:	5e                   	pop    %esi
+  80192d:	5d                   	pop    %ebp
+  80192e:	c3                   	ret
+  80192f:	a1 10 50 80 00       	mov    0x805010,%eax
+  801934:	8b 40 48             	mov    0x48(%eax),%eax
+  801937:	83 ec 04             	sub    $0x4,%esp
+  80193a:	53                   	push   %ebx
+  80193b:	50                   	push   %eax
+  80193c:	68 55 35 80 00       	push   $0x803555
+  801941:	e8 16 e8 ff ff       	call   80015c <cprintf>
+  801946:	83 c4 10             	add    $0x10,%esp
+  801949:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194e:	eb d8                	jmp    801928 <write+0x53>
+  801950:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801955:	eb d1                	jmp    801928 <write+0x53>
+
+00801957 <seek>:
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	83 ec 20             	sub    $0x20,%esp
+  80195d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801960:	50                   	push   %eax
+  801961:	ff 75 08             	push   0x8(%ebp)
+  801964:	e8 2f fc ff ff       	call   801598 <fd_lookup>
+  801969:	83 c4 10             	add    $0x10,%esp
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	78 0e                	js     80197e <seek+0x27>
+  801970:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801973:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801976:	89 50 04             	mov    %edx,0x4(%eax)
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197e:	c9                   	leave
+  80197f:	c3                   	ret
+
+00801980 <ftruncate>:
+  801980:	55                   	push   %ebp
+  801981:	89 e5                	mov    %esp,%ebp
+  801983:	56                   	push   %esi
+  801984:	53                   	push   %ebx
+  801985:	83 ec 18             	sub    $0x18,%esp
+  801988:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80198b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80198e:	50                   	push   %eax
+  80198f:	53                   	push   %ebx
+  801990:	e8 03 fc ff ff       	call   801598 <fd_lookup>
+  801995:	83 c4 10             	add    $0x10,%esp
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	78 34                	js     8019d0 <ftruncate+0x50>
+  80199c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80199f:	83 ec 08             	sub    $0x8,%esp
+  8019a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a5:	50                   	push   %eax
+  8019a6:	ff 36                	push   (%esi)
+  8019a8:	e8 3b fc ff ff       	call   8015e8 <dev_lookup>
+  8019ad:	83 c4 10             	add    $0x10,%esp
+  8019b0:	85 c0                	test   %eax,%eax
+  8019b2:	78 1c                	js     8019d0 <ftruncate+0x50>
+  8019b4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019b8:	74 1d                	je     8019d7 <ftruncate+0x57>
+  8019ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019bd:	8b 40 18             	mov    0x18(%eax),%eax
+  8019c0:	85 c0                	test   %eax,%eax
+  8019c2:	74 34                	je     8019f8 <ftruncate+0x78>
+  8019c4:	83 ec 08             	sub    $0x8,%esp
+  8019c7:	ff 75 0c             	push   0xc(%ebp)
+  8019ca:	56                   	push   %esi
+  8019cb:	ff d0                	call   *%eax
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d3:	5b                   	pop    %ebx
+  8019d4:	5e                   	pop    %esi
+  8019d5:	5d                   	pop    %ebp
+  8019d6:	c3                   	ret
+  8019d7:	a1 10 50 80 00       	mov    0x805010,%eax
+  8019dc:	8b 40 48             	mov    0x48(%eax),%eax
+  8019df:	83 ec 04             	sub    $0x4,%esp
+  8019e2:	53                   	push   %ebx
+  8019e3:	50                   	push   %eax
+  8019e4:	68 18 35 80 00       	push   $0x803518
+  8019e9:	e8 6e e7 ff ff       	call   80015c <cprintf>
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f6:	eb d8                	jmp    8019d0 <ftruncate+0x50>
+  8019f8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019fd:	eb d1                	jmp    8019d0 <ftruncate+0x50>
+
+008019ff <fstat>:
+  8019ff:	55                   	push   %ebp
+  801a00:	89 e5                	mov    %esp,%ebp
+  801a02:	56                   	push   %esi
+  801a03:	53                   	push   %ebx
+  801a04:	83 ec 18             	sub    $0x18,%esp
+  801a07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a0a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a0d:	50                   	push   %eax
+  801a0e:	ff 75 08             	push   0x8(%ebp)
+  801a11:	e8 82 fb ff ff       	call   801598 <fd_lookup>
+  801a16:	83 c4 10             	add    $0x10,%esp
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 49                	js     801a66 <fstat+0x67>
+  801a1d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a20:	83 ec 08             	sub    $0x8,%esp
+  801a23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a26:	50                   	push   %eax
+  801a27:	ff 36                	push   (%esi)
+  801a29:	e8 ba fb ff ff       	call   8015e8 <dev_lookup>
+  801a2e:	83 c4 10             	add    $0x10,%esp
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 31                	js     801a66 <fstat+0x67>
+  801a35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a38:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a3c:	74 2f                	je     801a6d <fstat+0x6e>
+  801a3e:	c6 03 00             	movb   $0x0,(%ebx)
+  801a41:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a48:	00 00 00 
+  801a4b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a52:	00 00 00 
+  801a55:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801a5b:	83 ec 08             	sub    $0x8,%esp
+  801a5e:	53                   	push   %ebx
+  801a5f:	56                   	push   %esi
+  801a60:	ff 50 14             	call   *0x14(%eax)
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a69:	5b                   	pop    %ebx
+  801a6a:	5e                   	pop    %esi
+  801a6b:	5d                   	pop    %ebp
+  801a6c:	c3                   	ret
+  801a6d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a72:	eb f2                	jmp    801a66 <fstat+0x67>
+
+00801a74 <stat>:
+  801a74:	55                   	push   %ebp
+  801a75:	89 e5                	mov    %esp,%ebp
+  801a77:	56                   	push   %esi
+  801a78:	53                   	push   %ebx
+  801a79:	83 ec 08             	sub    $0x8,%esp
+  801a7c:	6a 00                	push   $0x0
+  801a7e:	ff 75 08             	push   0x8(%ebp)
+  801a81:	e8 31 05 00 00       	call   801fb7 <open>
+  801a86:	89 c3                	mov    %eax,%ebx
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 1b                	js     801aaa <stat+0x36>
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	ff 75 0c             	push   0xc(%ebp)
+  801a95:	50                   	push   %eax
+  801a96:	e8 64 ff ff ff       	call   8019ff <fstat>
+  801a9b:	89 c6                	mov    %eax,%esi
+  801a9d:	89 1c 24             	mov    %ebx,(%esp)
+  801aa0:	e8 19 fc ff ff       	call   8016be <close>
+  801aa5:	83 c4 10             	add    $0x10,%esp
+  801aa8:	89 f3                	mov    %esi,%ebx
+  801aaa:	89 d8                	mov    %ebx,%eax
+  801aac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aaf:	5b                   	pop    %ebx
+  801ab0:	5e                   	pop    %esi
+  801ab1:	5d                   	pop    %ebp
+  801ab2:	c3                   	ret
+
+00801ab3 <fsipc>:
+  801ab3:	55                   	push   %ebp
+  801ab4:	89 e5                	mov    %esp,%ebp
+  801ab6:	56                   	push   %esi
+  801ab7:	53                   	push   %ebx
+  801ab8:	89 c3                	mov    %eax,%ebx
+  801aba:	89 d6                	mov    %edx,%esi
+  801abc:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801ac3:	74 20                	je     801ae5 <fsipc+0x32>
+  801ac5:	83 ec 08             	sub    $0x8,%esp
+  801ac8:	6a 00                	push   $0x0
+  801aca:	56                   	push   %esi
+  801acb:	6a 07                	push   $0x7
+  801acd:	68 00 60 80 00       	push   $0x806000
+  801ad2:	53                   	push   %ebx
+  801ad3:	ff 35 08 50 80 00    	push   0x805008
+  801ad9:	e8 a0 12 00 00       	call   802d7e <ipc_call>
+  801ade:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae1:	5b                   	pop    %ebx
+  801ae2:	5e                   	pop    %esi
+  801ae3:	5d                   	pop    %ebp
+  801ae4:	c3                   	ret
+  801ae5:	83 ec 0c             	sub    $0xc,%esp
+  801ae8:	6a 02                	push   $0x2
+  801aea:	e8 2a 14 00 00       	call   802f19 <ipc_find_env>
+  801aef:	a3 08 50 80 00       	mov    %eax,0x805008
+  801af4:	83 c4 10             	add    $0x10,%esp
+  801af7:	eb cc                	jmp    801ac5 <fsipc+0x12>
+
+00801af9 <devfile_trunc>:
+  801af9:	55                   	push   %ebp
+  801afa:	89 e5                	mov    %esp,%ebp
+  801afc:	83 ec 08             	sub    $0x8,%esp
+  801aff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b02:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b05:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b0d:	a3 04 60 80 00       	mov    %eax,0x806004
+  801b12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b17:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b1c:	e8 92 ff ff ff       	call   801ab3 <fsipc>
+  801b21:	c9                   	leave
+  801b22:	c3                   	ret
+
+00801b23 <devfile_flush>:
+  801b23:	55                   	push   %ebp
+  801b24:	89 e5                	mov    %esp,%ebp
+  801b26:	83 ec 08             	sub    $0x8,%esp
+  801b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b39:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b3e:	e8 70 ff ff ff       	call   801ab3 <fsipc>
+  801b43:	c9                   	leave
+  801b44:	c3                   	ret
+
+00801b45 <devfile_stat>:
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	53                   	push   %ebx
+  801b49:	83 ec 04             	sub    $0x4,%esp
+  801b4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b52:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b55:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b64:	e8 4a ff ff ff       	call   801ab3 <fsipc>
+  801b69:	85 c0                	test   %eax,%eax
+  801b6b:	78 2c                	js     801b99 <devfile_stat+0x54>
+  801b6d:	83 ec 08             	sub    $0x8,%esp
+  801b70:	68 00 60 80 00       	push   $0x806000
+  801b75:	53                   	push   %ebx
+  801b76:	e8 d8 ec ff ff       	call   800853 <strcpy>
+  801b7b:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b80:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801b86:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b8b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+00801b9e <fsring_rw>:
+  801b9e:	55                   	push   %ebp
+  801b9f:	89 e5                	mov    %esp,%ebp
+  801ba1:	57                   	push   %edi
+  801ba2:	56                   	push   %esi
+  801ba3:	53                   	push   %ebx
+  801ba4:	83 ec 2c             	sub    $0x2c,%esp
+  801ba7:	89 c7                	mov    %eax,%edi
+  801ba9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bac:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801baf:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801bb4:	a8 01                	test   $0x1,%al
+  801bb6:	74 0d                	je     801bc5 <fsring_rw+0x27>
+  801bb8:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801bbd:	a8 01                	test   $0x1,%al
+  801bbf:	0f 85 d5 00 00 00    	jne    801c9a <fsring_rw+0xfc>
+  801bc5:	a1 10 50 80 00       	mov    0x805010,%eax
+  801bca:	8b 40 48             	mov    0x48(%eax),%eax
+  801bcd:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801bd3:	0f 84 fc 00 00 00    	je     801cd5 <fsring_rw+0x137>
+  801bd9:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801be0:	0f 84 02 01 00 00    	je     801ce8 <fsring_rw+0x14a>
+  801be6:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801beb:	83 ec 04             	sub    $0x4,%esp
+  801bee:	68 07 02 00 00       	push   $0x207
+  801bf3:	53                   	push   %ebx
+  801bf4:	6a 00                	push   $0x0
+  801bf6:	e8 b8 f0 ff ff       	call   800cb3 <sys_page_alloc>
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	85 c0                	test   %eax,%eax
+  801c00:	0f 88 f9 00 00 00    	js     801cff <fsring_rw+0x161>
+  801c06:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c0c:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801c12:	75 d7                	jne    801beb <fsring_rw+0x4d>
+  801c14:	6a 0e                	push   $0xe
+  801c16:	6a 0d                	push   $0xd
+  801c18:	ff 35 08 50 80 00    	push   0x805008
+  801c1e:	68 00 00 f0 cf       	push   $0xcff00000
+  801c23:	e8 c4 0c 00 00       	call   8028ec <ipcring_init>
+  801c28:	83 c4 08             	add    $0x8,%esp
+  801c2b:	6a 00                	push   $0x0
+  801c2d:	6a 00                	push   $0x0
+  801c2f:	68 07 02 00 00       	push   $0x207
+  801c34:	68 00 00 f0 cf       	push   $0xcff00000
+  801c39:	6a 0b                	push   $0xb
+  801c3b:	ff 35 08 50 80 00    	push   0x805008
+  801c41:	e8 38 11 00 00       	call   802d7e <ipc_call>
+  801c46:	89 c6                	mov    %eax,%esi
+  801c48:	83 c4 20             	add    $0x20,%esp
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	0f 88 ac 00 00 00    	js     801cff <fsring_rw+0x161>
+  801c53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c58:	89 d9                	mov    %ebx,%ecx
+  801c5a:	83 c3 01             	add    $0x1,%ebx
+  801c5d:	89 da                	mov    %ebx,%edx
+  801c5f:	c1 e2 0c             	shl    $0xc,%edx
+  801c62:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801c68:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801c6e:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801c74:	83 ec 08             	sub    $0x8,%esp
+  801c77:	6a 00                	push   $0x0
+  801c79:	6a 00                	push   $0x0
+  801c7b:	68 07 02 00 00       	push   $0x207
+  801c80:	50                   	push   %eax
+  801c81:	6a 0c                	push   $0xc
+  801c83:	ff 35 08 50 80 00    	push   0x805008
+  801c89:	e8 f0 10 00 00       	call   802d7e <ipc_call>
+  801c8e:	83 c4 20             	add    $0x20,%esp
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	78 6a                	js     801cff <fsring_rw+0x161>
+  801c95:	83 fb 08             	cmp    $0x8,%ebx
+  801c98:	75 be                	jne    801c58 <fsring_rw+0xba>
+  801c9a:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801c9e:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801ca3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801ca8:	0f 45 c2             	cmovne %edx,%eax
+  801cab:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801cae:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801cb5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801cbc:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801cc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccd:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801cd0:	e9 4b 01 00 00       	jmp    801e20 <fsring_rw+0x282>
+  801cd5:	e8 a3 f3 ff ff       	call   80107d <sys_time_msec>
+  801cda:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801ce0:	0f 89 f3 fe ff ff    	jns    801bd9 <fsring_rw+0x3b>
+  801ce6:	eb 54                	jmp    801d3c <fsring_rw+0x19e>
+  801ce8:	83 ec 0c             	sub    $0xc,%esp
+  801ceb:	6a 02                	push   $0x2
+  801ced:	e8 27 12 00 00       	call   802f19 <ipc_find_env>
+  801cf2:	a3 08 50 80 00       	mov    %eax,0x805008
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	e9 e7 fe ff ff       	jmp    801be6 <fsring_rw+0x48>
+  801cff:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d04:	83 ec 08             	sub    $0x8,%esp
+  801d07:	53                   	push   %ebx
+  801d08:	6a 00                	push   $0x0
+  801d0a:	e8 76 f0 ff ff       	call   800d85 <sys_page_unmap>
+  801d0f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d1e:	75 e4                	jne    801d04 <fsring_rw+0x166>
+  801d20:	e8 58 f3 ff ff       	call   80107d <sys_time_msec>
+  801d25:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801d2a:	a3 00 50 80 00       	mov    %eax,0x805000
+  801d2f:	a1 10 50 80 00       	mov    0x805010,%eax
+  801d34:	8b 40 48             	mov    0x48(%eax),%eax
+  801d37:	a3 04 50 80 00       	mov    %eax,0x805004
+  801d3c:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801d43:	e9 7a 01 00 00       	jmp    801ec2 <fsring_rw+0x324>
+  801d48:	8b 57 0c             	mov    0xc(%edi),%edx
+  801d4b:	89 10                	mov    %edx,(%eax)
+  801d4d:	89 58 04             	mov    %ebx,0x4(%eax)
+  801d50:	89 f2                	mov    %esi,%edx
+  801d52:	03 57 04             	add    0x4(%edi),%edx
+  801d55:	89 50 08             	mov    %edx,0x8(%eax)
+  801d58:	83 ec 04             	sub    $0x4,%esp
+  801d5b:	53                   	push   %ebx
+  801d5c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801d5f:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801d62:	52                   	push   %edx
+  801d63:	83 c0 0c             	add    $0xc,%eax
+  801d66:	50                   	push   %eax
+  801d67:	e8 97 ec ff ff       	call   800a03 <memmove>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d72:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d75:	89 08                	mov    %ecx,(%eax)
+  801d77:	83 ec 0c             	sub    $0xc,%esp
+  801d7a:	68 00 00 f0 cf       	push   $0xcff00000
+  801d7f:	e8 c6 0b 00 00       	call   80294a <ipcring_req_push>
+  801d84:	01 de                	add    %ebx,%esi
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801d8c:	73 4c                	jae    801dda <fsring_rw+0x23c>
+  801d8e:	83 ec 0c             	sub    $0xc,%esp
+  801d91:	68 00 00 f0 cf       	push   $0xcff00000
+  801d96:	e8 89 0b 00 00       	call   802924 <ipcring_req_slot>
+  801d9b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	74 35                	je     801dda <fsring_rw+0x23c>
+  801da5:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801daa:	83 e0 07             	and    $0x7,%eax
+  801dad:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801db2:	c1 e0 0c             	shl    $0xc,%eax
+  801db5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801db8:	29 f3                	sub    %esi,%ebx
+  801dba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801dbd:	39 cb                	cmp    %ecx,%ebx
+  801dbf:	0f 47 d9             	cmova  %ecx,%ebx
+  801dc2:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801dc6:	75 80                	jne    801d48 <fsring_rw+0x1aa>
+  801dc8:	8b 57 0c             	mov    0xc(%edi),%edx
+  801dcb:	89 10                	mov    %edx,(%eax)
+  801dcd:	89 58 04             	mov    %ebx,0x4(%eax)
+  801dd0:	89 f2                	mov    %esi,%edx
+  801dd2:	03 57 04             	add    0x4(%edi),%edx
+  801dd5:	89 50 08             	mov    %edx,0x8(%eax)
+  801dd8:	eb 95                	jmp    801d6f <fsring_rw+0x1d1>
+  801dda:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801ddf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801de2:	83 ec 0c             	sub    $0xc,%esp
+  801de5:	68 00 00 f0 cf       	push   $0xcff00000
+  801dea:	e8 94 0b 00 00       	call   802983 <ipcring_rsp_wait>
+  801def:	8b 58 04             	mov    0x4(%eax),%ebx
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801df9:	75 45                	jne    801e40 <fsring_rw+0x2a2>
+  801dfb:	85 db                	test   %ebx,%ebx
+  801dfd:	79 41                	jns    801e40 <fsring_rw+0x2a2>
+  801dff:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801e02:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801e09:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801e10:	83 ec 0c             	sub    $0xc,%esp
+  801e13:	68 00 00 f0 cf       	push   $0xcff00000
+  801e18:	e8 cc 0b 00 00       	call   8029e9 <ipcring_rsp_pop>
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801e26:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801e2b:	39 c2                	cmp    %eax,%edx
+  801e2d:	74 75                	je     801ea4 <fsring_rw+0x306>
+  801e2f:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801e33:	75 a5                	jne    801dda <fsring_rw+0x23c>
+  801e35:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801e38:	0f 82 50 ff ff ff    	jb     801d8e <fsring_rw+0x1f0>
+  801e3e:	eb 9a                	jmp    801dda <fsring_rw+0x23c>
+  801e40:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e44:	75 ca                	jne    801e10 <fsring_rw+0x272>
+  801e46:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e4a:	74 31                	je     801e7d <fsring_rw+0x2df>
+  801e4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801e52:	29 c8                	sub    %ecx,%eax
+  801e54:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801e57:	39 d0                	cmp    %edx,%eax
+  801e59:	0f 47 c2             	cmova  %edx,%eax
+  801e5c:	39 d8                	cmp    %ebx,%eax
+  801e5e:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e63:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801e67:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801e6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e6f:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801e73:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e76:	01 d9                	add    %ebx,%ecx
+  801e78:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801e7b:	eb 93                	jmp    801e10 <fsring_rw+0x272>
+  801e7d:	83 ec 04             	sub    $0x4,%esp
+  801e80:	53                   	push   %ebx
+  801e81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e84:	83 e0 07             	and    $0x7,%eax
+  801e87:	c1 e0 0c             	shl    $0xc,%eax
+  801e8a:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801e90:	50                   	push   %eax
+  801e91:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801e94:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801e97:	01 c8                	add    %ecx,%eax
+  801e99:	50                   	push   %eax
+  801e9a:	e8 64 eb ff ff       	call   800a03 <memmove>
+  801e9f:	83 c4 10             	add    $0x10,%esp
+  801ea2:	eb a8                	jmp    801e4c <fsring_rw+0x2ae>
+  801ea4:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801ea8:	75 09                	jne    801eb3 <fsring_rw+0x315>
+  801eaa:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801ead:	0f 82 db fe ff ff    	jb     801d8e <fsring_rw+0x1f0>
+  801eb3:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801eb6:	01 57 04             	add    %edx,0x4(%edi)
+  801eb9:	85 d2                	test   %edx,%edx
+  801ebb:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801ebf:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801ec2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801ec5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ec8:	5b                   	pop    %ebx
+  801ec9:	5e                   	pop    %esi
+  801eca:	5f                   	pop    %edi
+  801ecb:	5d                   	pop    %ebp
+  801ecc:	c3                   	ret
+
+00801ecd <devfile_write>:
+  801ecd:	55                   	push   %ebp
+  801ece:	89 e5                	mov    %esp,%ebp
+  801ed0:	57                   	push   %edi
+  801ed1:	56                   	push   %esi
+  801ed2:	53                   	push   %ebx
+  801ed3:	83 ec 0c             	sub    $0xc,%esp
+  801ed6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ed9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801edc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801edf:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801ee5:	76 1a                	jbe    801f01 <devfile_write+0x34>
+  801ee7:	83 ec 0c             	sub    $0xc,%esp
+  801eea:	53                   	push   %ebx
+  801eeb:	89 f1                	mov    %esi,%ecx
+  801eed:	ba 06 00 00 00       	mov    $0x6,%edx
+  801ef2:	89 f8                	mov    %edi,%eax
+  801ef4:	e8 a5 fc ff ff       	call   801b9e <fsring_rw>
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801eff:	75 39                	jne    801f3a <devfile_write+0x6d>
+  801f01:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801f06:	39 c3                	cmp    %eax,%ebx
+  801f08:	0f 47 d8             	cmova  %eax,%ebx
+  801f0b:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f0e:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f13:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801f19:	83 ec 04             	sub    $0x4,%esp
+  801f1c:	53                   	push   %ebx
+  801f1d:	56                   	push   %esi
+  801f1e:	68 08 60 80 00       	push   $0x806008
+  801f23:	e8 db ea ff ff       	call   800a03 <memmove>
+  801f28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f32:	e8 7c fb ff ff       	call   801ab3 <fsipc>
+  801f37:	83 c4 10             	add    $0x10,%esp
+  801f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f3d:	5b                   	pop    %ebx
+  801f3e:	5e                   	pop    %esi
+  801f3f:	5f                   	pop    %edi
+  801f40:	5d                   	pop    %ebp
+  801f41:	c3                   	ret
+
+00801f42 <devfile_read>:
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	57                   	push   %edi
+  801f46:	56                   	push   %esi
+  801f47:	53                   	push   %ebx
+  801f48:	83 ec 0c             	sub    $0xc,%esp
+  801f4b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f4e:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f51:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  801f57:	76 1d                	jbe    801f76 <devfile_read+0x34>
+  801f59:	83 ec 0c             	sub    $0xc,%esp
+  801f5c:	56                   	push   %esi
+  801f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f60:	ba 05 00 00 00       	mov    $0x5,%edx
+  801f65:	89 f8                	mov    %edi,%eax
+  801f67:	e8 32 fc ff ff       	call   801b9e <fsring_rw>
+  801f6c:	89 c3                	mov    %eax,%ebx
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801f74:	75 37                	jne    801fad <devfile_read+0x6b>
+  801f76:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f79:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f7e:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801f84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f89:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f8e:	e8 20 fb ff ff       	call   801ab3 <fsipc>
+  801f93:	89 c3                	mov    %eax,%ebx
+  801f95:	85 c0                	test   %eax,%eax
+  801f97:	78 14                	js     801fad <devfile_read+0x6b>
+  801f99:	83 ec 04             	sub    $0x4,%esp
+  801f9c:	50                   	push   %eax
+  801f9d:	68 00 60 80 00       	push   $0x806000
+  801fa2:	ff 75 0c             	push   0xc(%ebp)
+  801fa5:	e8 59 ea ff ff       	call   800a03 <memmove>
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	89 d8                	mov    %ebx,%eax
+  801faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb2:	5b                   	pop    %ebx
+  801fb3:	5e                   	pop    %esi
+  801fb4:	5f                   	pop    %edi
+  801fb5:	5d                   	pop    %ebp
+  801fb6:	c3                   	ret
+
+00801fb7 <open>:
+  801fb7:	55                   	push   %ebp
+  801fb8:	89 e5                	mov    %esp,%ebp
+  801fba:	56                   	push   %esi
+  801fbb:	53                   	push   %ebx
+  801fbc:	83 ec 1c             	sub    $0x1c,%esp
+  801fbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc2:	56                   	push   %esi
+  801fc3:	e8 3f e8 ff ff       	call   800807 <strlen>
+  801fc8:	83 c4 10             	add    $0x10,%esp
+  801fcb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fd0:	7f 6c                	jg     80203e <open+0x87>
+  801fd2:	83 ec 0c             	sub    $0xc,%esp
+  801fd5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd8:	50                   	push   %eax
+  801fd9:	e8 6a f5 ff ff       	call   801548 <fd_alloc>
+  801fde:	89 c3                	mov    %eax,%ebx
+  801fe0:	83 c4 10             	add    $0x10,%esp
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 3c                	js     802023 <open+0x6c>
+  801fe7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fea:	a3 00 64 80 00       	mov    %eax,0x806400
+  801fef:	83 ec 08             	sub    $0x8,%esp
+  801ff2:	56                   	push   %esi
+  801ff3:	68 00 60 80 00       	push   $0x806000
+  801ff8:	e8 56 e8 ff ff       	call   800853 <strcpy>
+  801ffd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802000:	b8 01 00 00 00       	mov    $0x1,%eax
+  802005:	e8 a9 fa ff ff       	call   801ab3 <fsipc>
+  80200a:	89 c3                	mov    %eax,%ebx
+  80200c:	83 c4 10             	add    $0x10,%esp
+  80200f:	85 c0                	test   %eax,%eax
+  802011:	78 19                	js     80202c <open+0x75>
+  802013:	83 ec 0c             	sub    $0xc,%esp
+  802016:	ff 75 f4             	push   -0xc(%ebp)
+  802019:	e8 03 f5 ff ff       	call   801521 <fd2num>
+  80201e:	89 c3                	mov    %eax,%ebx
+  802020:	83 c4 10             	add    $0x10,%esp
+  802023:	89 d8                	mov    %ebx,%eax
+  802025:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802028:	5b                   	pop    %ebx
+  802029:	5e                   	pop    %esi
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+  80202c:	83 ec 08             	sub    $0x8,%esp
+  80202f:	6a 00                	push   $0x0
+  802031:	ff 75 f4             	push   -0xc(%ebp)
+  802034:	e8 05 f6 ff ff       	call   80163e <fd_close>
+  802039:	83 c4 10             	add    $0x10,%esp
+  80203c:	eb e5                	jmp    802023 <open+0x6c>
+  80203e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802043:	eb de                	jmp    802023 <open+0x6c>
+
+00802045 <file_image>:
+  802045:	55                   	push   %ebp
+  802046:	89 e5                	mov    %esp,%ebp
+  802048:	53                   	push   %ebx
+  802049:	83 ec 1c             	sub    $0x1c,%esp
+  80204c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80204f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802052:	50                   	push   %eax
+  802053:	ff 75 08             	push   0x8(%ebp)
+  802056:	e8 3d f5 ff ff       	call   801598 <fd_lookup>
+  80205b:	83 c4 10             	add    $0x10,%esp
+  80205e:	85 c0                	test   %eax,%eax
+  802060:	78 58                	js     8020ba <file_image+0x75>
+  802062:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802065:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80206b:	39 08                	cmp    %ecx,(%eax)
+  80206d:	75 50                	jne    8020bf <file_image+0x7a>
+  80206f:	83 fb 04             	cmp    $0x4,%ebx
+  802072:	77 52                	ja     8020c6 <file_image+0x81>
+  802074:	8b 40 0c             	mov    0xc(%eax),%eax
+  802077:	a3 00 60 80 00       	mov    %eax,0x806000
+  80207c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802082:	83 ec 04             	sub    $0x4,%esp
+  802085:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802088:	c1 e0 02             	shl    $0x2,%eax
+  80208b:	50                   	push   %eax
+  80208c:	ff 75 0c             	push   0xc(%ebp)
+  80208f:	68 08 60 80 00       	push   $0x806008
+  802094:	e8 6a e9 ff ff       	call   800a03 <memmove>
+  802099:	ba 00 00 00 00       	mov    $0x0,%edx
+  80209e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020a3:	e8 0b fa ff ff       	call   801ab3 <fsipc>
+  8020a8:	83 c4 10             	add    $0x10,%esp
+  8020ab:	85 c0                	test   %eax,%eax
+  8020ad:	78 0b                	js     8020ba <file_image+0x75>
+  8020af:	8b 55 14             	mov    0x14(%ebp),%edx
+  8020b2:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8020b8:	89 0a                	mov    %ecx,(%edx)
+  8020ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020bd:	c9                   	leave
+  8020be:	c3                   	ret
+  8020bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020c4:	eb f4                	jmp    8020ba <file_image+0x75>
+  8020c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020cb:	eb ed                	jmp    8020ba <file_image+0x75>
+
+008020cd <remove>:
+  8020cd:	55                   	push   %ebp
+  8020ce:	89 e5                	mov    %esp,%ebp
+  8020d0:	53                   	push   %ebx
+  8020d1:	83 ec 10             	sub    $0x10,%esp
+  8020d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020d7:	53                   	push   %ebx
+  8020d8:	e8 2a e7 ff ff       	call   800807 <strlen>
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020e5:	7f 25                	jg     80210c <remove+0x3f>
+  8020e7:	83 ec 08             	sub    $0x8,%esp
+  8020ea:	53                   	push   %ebx
+  8020eb:	68 00 60 80 00       	push   $0x806000
+  8020f0:	e8 5e e7 ff ff       	call   800853 <strcpy>
+  8020f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fa:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020ff:	e8 af f9 ff ff       	call   801ab3 <fsipc>
+  802104:	83 c4 10             	add    $0x10,%esp
+  802107:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210a:	c9                   	leave
+  80210b:	c3                   	ret
+  80210c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802111:	eb f4                	jmp    802107 <remove+0x3a>
+
+00802113 <sync>:
+  802113:	55                   	push   %ebp
+  802114:	89 e5                	mov    %esp,%ebp
+  802116:	83 ec 08             	sub    $0x8,%esp
+  802119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802123:	e8 8b f9 ff ff       	call   801ab3 <fsipc>
+  802128:	c9                   	leave
+  802129:	c3                   	ret
+
+0080212a <devsock_stat>:
+  80212a:	55                   	push   %ebp
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	83 ec 10             	sub    $0x10,%esp
+  802130:	68 88 35 80 00       	push   $0x803588
+  802135:	ff 75 0c             	push   0xc(%ebp)
+  802138:	e8 16 e7 ff ff       	call   800853 <strcpy>
+  80213d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802142:	c9                   	leave
+  802143:	c3                   	ret
+
+00802144 <devsock_close>:
+  802144:	55                   	push   %ebp
+  802145:	89 e5                	mov    %esp,%ebp
+  802147:	53                   	push   %ebx
+  802148:	83 ec 10             	sub    $0x10,%esp
+  80214b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80214e:	53                   	push   %ebx
+  80214f:	e8 df 0d 00 00       	call   802f33 <pageref>
+  802154:	89 c2                	mov    %eax,%edx
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215e:	83 fa 01             	cmp    $0x1,%edx
+  802161:	74 05                	je     802168 <devsock_close+0x24>
+  802163:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802166:	c9                   	leave
+  802167:	c3                   	ret
+  802168:	83 ec 0c             	sub    $0xc,%esp
+  80216b:	ff 73 0c             	push   0xc(%ebx)
+  80216e:	e8 aa 02 00 00       	call   80241d <nsipc_close>
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	eb eb                	jmp    802163 <devsock_close+0x1f>
+
+00802178 <devsock_write>:
+  802178:	55                   	push   %ebp
+  802179:	89 e5                	mov    %esp,%ebp
+  80217b:	83 ec 08             	sub    $0x8,%esp
+  80217e:	6a 00                	push   $0x0
+  802180:	ff 75 10             	push   0x10(%ebp)
+  802183:	ff 75 0c             	push   0xc(%ebp)
+  802186:	8b 45 08             	mov    0x8(%ebp),%eax
+  802189:	ff 70 0c             	push   0xc(%eax)
+  80218c:	e8 6c 03 00 00       	call   8024fd <nsipc_send>
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+
+00802193 <devsock_read>:
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	83 ec 08             	sub    $0x8,%esp
+  802199:	6a 00                	push   $0x0
+  80219b:	ff 75 10             	push   0x10(%ebp)
+  80219e:	ff 75 0c             	push   0xc(%ebp)
+  8021a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a4:	ff 70 0c             	push   0xc(%eax)
+  8021a7:	e8 e2 02 00 00       	call   80248e <nsipc_recv>
+  8021ac:	c9                   	leave
+  8021ad:	c3                   	ret
+
+008021ae <fd2sockid>:
+  8021ae:	55                   	push   %ebp
+  8021af:	89 e5                	mov    %esp,%ebp
+  8021b1:	83 ec 20             	sub    $0x20,%esp
+  8021b4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021b7:	52                   	push   %edx
+  8021b8:	50                   	push   %eax
+  8021b9:	e8 da f3 ff ff       	call   801598 <fd_lookup>
+  8021be:	83 c4 10             	add    $0x10,%esp
+  8021c1:	85 c0                	test   %eax,%eax
+  8021c3:	78 10                	js     8021d5 <fd2sockid+0x27>
+  8021c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8021ce:	39 08                	cmp    %ecx,(%eax)
+  8021d0:	75 05                	jne    8021d7 <fd2sockid+0x29>
+  8021d2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d5:	c9                   	leave
+  8021d6:	c3                   	ret
+  8021d7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021dc:	eb f7                	jmp    8021d5 <fd2sockid+0x27>
+
+008021de <alloc_sockfd>:
+  8021de:	55                   	push   %ebp
+  8021df:	89 e5                	mov    %esp,%ebp
+  8021e1:	56                   	push   %esi
+  8021e2:	53                   	push   %ebx
+  8021e3:	83 ec 1c             	sub    $0x1c,%esp
+  8021e6:	89 c6                	mov    %eax,%esi
+  8021e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021eb:	50                   	push   %eax
+  8021ec:	e8 57 f3 ff ff       	call   801548 <fd_alloc>
+  8021f1:	89 c3                	mov    %eax,%ebx
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	85 c0                	test   %eax,%eax
+  8021f8:	78 43                	js     80223d <alloc_sockfd+0x5f>
+  8021fa:	83 ec 04             	sub    $0x4,%esp
+  8021fd:	68 07 04 00 00       	push   $0x407
+  802202:	ff 75 f4             	push   -0xc(%ebp)
+  802205:	6a 00                	push   $0x0
+  802207:	e8 a7 ea ff ff       	call   800cb3 <sys_page_alloc>
+  80220c:	89 c3                	mov    %eax,%ebx
+  80220e:	83 c4 10             	add    $0x10,%esp
+  802211:	85 c0                	test   %eax,%eax
+  802213:	78 28                	js     80223d <alloc_sockfd+0x5f>
+  802215:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802218:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80221e:	89 10                	mov    %edx,(%eax)
+  802220:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802223:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80222a:	89 70 0c             	mov    %esi,0xc(%eax)
+  80222d:	83 ec 0c             	sub    $0xc,%esp
+  802230:	50                   	push   %eax
+  802231:	e8 eb f2 ff ff       	call   801521 <fd2num>
+  802236:	89 c3                	mov    %eax,%ebx
+  802238:	83 c4 10             	add    $0x10,%esp
+  80223b:	eb 0c                	jmp    802249 <alloc_sockfd+0x6b>
+  80223d:	83 ec 0c             	sub    $0xc,%esp
+  802240:	56                   	push   %esi
+  802241:	e8 d7 01 00 00       	call   80241d <nsipc_close>
+  802246:	83 c4 10             	add    $0x10,%esp
+  802249:	89 d8                	mov    %ebx,%eax
+  80224b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224e:	5b                   	pop    %ebx
+  80224f:	5e                   	pop    %esi
+  802250:	5d                   	pop    %ebp
+  802251:	c3                   	ret
+
+00802252 <accept>:
+  802252:	55                   	push   %ebp
+  802253:	89 e5                	mov    %esp,%ebp
+  802255:	83 ec 08             	sub    $0x8,%esp
+  802258:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225b:	e8 4e ff ff ff       	call   8021ae <fd2sockid>
+  802260:	85 c0                	test   %eax,%eax
+  802262:	78 1b                	js     80227f <accept+0x2d>
+  802264:	83 ec 04             	sub    $0x4,%esp
+  802267:	ff 75 10             	push   0x10(%ebp)
+  80226a:	ff 75 0c             	push   0xc(%ebp)
+  80226d:	50                   	push   %eax
+  80226e:	e8 07 01 00 00       	call   80237a <nsipc_accept>
+  802273:	83 c4 10             	add    $0x10,%esp
+  802276:	85 c0                	test   %eax,%eax
+  802278:	78 05                	js     80227f <accept+0x2d>
+  80227a:	e8 5f ff ff ff       	call   8021de <alloc_sockfd>
+  80227f:	c9                   	leave
+  802280:	c3                   	ret
+
+00802281 <bind>:
+  802281:	55                   	push   %ebp
+  802282:	89 e5                	mov    %esp,%ebp
+  802284:	83 ec 08             	sub    $0x8,%esp
+  802287:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228a:	e8 1f ff ff ff       	call   8021ae <fd2sockid>
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 12                	js     8022a5 <bind+0x24>
+  802293:	83 ec 04             	sub    $0x4,%esp
+  802296:	ff 75 10             	push   0x10(%ebp)
+  802299:	ff 75 0c             	push   0xc(%ebp)
+  80229c:	50                   	push   %eax
+  80229d:	e8 24 01 00 00       	call   8023c6 <nsipc_bind>
+  8022a2:	83 c4 10             	add    $0x10,%esp
+  8022a5:	c9                   	leave
+  8022a6:	c3                   	ret
+
+008022a7 <shutdown>:
+  8022a7:	55                   	push   %ebp
+  8022a8:	89 e5                	mov    %esp,%ebp
+  8022aa:	83 ec 08             	sub    $0x8,%esp
+  8022ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b0:	e8 f9 fe ff ff       	call   8021ae <fd2sockid>
+  8022b5:	85 c0                	test   %eax,%eax
+  8022b7:	78 0f                	js     8022c8 <shutdown+0x21>
+  8022b9:	83 ec 08             	sub    $0x8,%esp
+  8022bc:	ff 75 0c             	push   0xc(%ebp)
+  8022bf:	50                   	push   %eax
+  8022c0:	e8 36 01 00 00       	call   8023fb <nsipc_shutdown>
+  8022c5:	83 c4 10             	add    $0x10,%esp
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+
+008022ca <connect>:
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	83 ec 08             	sub    $0x8,%esp
+  8022d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d3:	e8 d6 fe ff ff       	call   8021ae <fd2sockid>
+  8022d8:	85 c0                	test   %eax,%eax
+  8022da:	78 12                	js     8022ee <connect+0x24>
+  8022dc:	83 ec 04             	sub    $0x4,%esp
+  8022df:	ff 75 10             	push   0x10(%ebp)
+  8022e2:	ff 75 0c             	push   0xc(%ebp)
+  8022e5:	50                   	push   %eax
+  8022e6:	e8 4c 01 00 00       	call   802437 <nsipc_connect>
+  8022eb:	83 c4 10             	add    $0x10,%esp
+  8022ee:	c9                   	leave
+  8022ef:	c3                   	ret
+
+008022f0 <listen>:
+  8022f0:	55                   	push   %ebp
+  8022f1:	89 e5                	mov    %esp,%ebp
+  8022f3:	83 ec 08             	sub    $0x8,%esp
+  8022f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f9:	e8 b0 fe ff ff       	call   8021ae <fd2sockid>
+  8022fe:	85 c0                	test   %eax,%eax
+  802300:	78 0f                	js     802311 <listen+0x21>
+  802302:	83 ec 08             	sub    $0x8,%esp
+  802305:	ff 75 0c             	push   0xc(%ebp)
+  802308:	50                   	push   %eax
+  802309:	e8 5e 01 00 00       	call   80246c <nsipc_listen>
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	c9                   	leave
+  802312:	c3                   	ret
+
+00802313 <socket>:
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	83 ec 0c             	sub    $0xc,%esp
+  802319:	ff 75 10             	push   0x10(%ebp)
+  80231c:	ff 75 0c             	push   0xc(%ebp)
+  80231f:	ff 75 08             	push   0x8(%ebp)
+  802322:	e8 34 02 00 00       	call   80255b <nsipc_socket>
+  802327:	83 c4 10             	add    $0x10,%esp
+  80232a:	85 c0                	test   %eax,%eax
+  80232c:	78 05                	js     802333 <socket+0x20>
+  80232e:	e8 ab fe ff ff       	call   8021de <alloc_sockfd>
+  802333:	c9                   	leave
+  802334:	c3                   	ret
+
+00802335 <nsipc>:
+  802335:	55                   	push   %ebp
+  802336:	89 e5                	mov    %esp,%ebp
+  802338:	53                   	push   %ebx
+  802339:	83 ec 04             	sub    $0x4,%esp
+  80233c:	89 c3                	mov    %eax,%ebx
+  80233e:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802345:	74 1f                	je     802366 <nsipc+0x31>
+  802347:	83 ec 08             	sub    $0x8,%esp
+  80234a:	6a 00                	push   $0x0
+  80234c:	6a 00                	push   $0x0
+  80234e:	6a 07                	push   $0x7
+  802350:	68 00 70 80 00       	push   $0x807000
+  802355:	53                   	push   %ebx
+  802356:	ff 35 0c 50 80 00    	push   0x80500c
+  80235c:	e8 1d 0a 00 00       	call   802d7e <ipc_call>
+  802361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+  802366:	83 ec 0c             	sub    $0xc,%esp
+  802369:	6a 03                	push   $0x3
+  80236b:	e8 a9 0b 00 00       	call   802f19 <ipc_find_env>
+  802370:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802375:	83 c4 10             	add    $0x10,%esp
+  802378:	eb cd                	jmp    802347 <nsipc+0x12>
+
+0080237a <nsipc_accept>:
+  80237a:	55                   	push   %ebp
+  80237b:	89 e5                	mov    %esp,%ebp
+  80237d:	53                   	push   %ebx
+  80237e:	83 ec 04             	sub    $0x4,%esp
+  802381:	8b 45 08             	mov    0x8(%ebp),%eax
+  802384:	a3 00 70 80 00       	mov    %eax,0x807000
+  802389:	b8 01 00 00 00       	mov    $0x1,%eax
+  80238e:	e8 a2 ff ff ff       	call   802335 <nsipc>
+  802393:	89 c3                	mov    %eax,%ebx
+  802395:	85 c0                	test   %eax,%eax
+  802397:	79 07                	jns    8023a0 <nsipc_accept+0x26>
+  802399:	89 d8                	mov    %ebx,%eax
+  80239b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239e:	c9                   	leave
+  80239f:	c3                   	ret
+  8023a0:	83 ec 04             	sub    $0x4,%esp
+  8023a3:	ff 35 10 70 80 00    	push   0x807010
+  8023a9:	68 00 70 80 00       	push   $0x807000
+  8023ae:	ff 75 0c             	push   0xc(%ebp)
+  8023b1:	e8 4d e6 ff ff       	call   800a03 <memmove>
+  8023b6:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8023bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023bf:	89 10                	mov    %edx,(%eax)
+  8023c1:	83 c4 10             	add    $0x10,%esp
+  8023c4:	eb d3                	jmp    802399 <nsipc_accept+0x1f>
+
+008023c6 <nsipc_bind>:
+  8023c6:	55                   	push   %ebp
+  8023c7:	89 e5                	mov    %esp,%ebp
+  8023c9:	53                   	push   %ebx
+  8023ca:	83 ec 08             	sub    $0x8,%esp
+  8023cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d3:	a3 00 70 80 00       	mov    %eax,0x807000
+  8023d8:	53                   	push   %ebx
+  8023d9:	ff 75 0c             	push   0xc(%ebp)
+  8023dc:	68 04 70 80 00       	push   $0x807004
+  8023e1:	e8 1d e6 ff ff       	call   800a03 <memmove>
+  8023e6:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8023ec:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023f1:	e8 3f ff ff ff       	call   802335 <nsipc>
+  8023f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+
+008023fb <nsipc_shutdown>:
+  8023fb:	55                   	push   %ebp
+  8023fc:	89 e5                	mov    %esp,%ebp
+  8023fe:	83 ec 08             	sub    $0x8,%esp
+  802401:	8b 45 08             	mov    0x8(%ebp),%eax
+  802404:	a3 00 70 80 00       	mov    %eax,0x807000
+  802409:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80240c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802411:	b8 03 00 00 00       	mov    $0x3,%eax
+  802416:	e8 1a ff ff ff       	call   802335 <nsipc>
+  80241b:	c9                   	leave
+  80241c:	c3                   	ret
+
+0080241d <nsipc_close>:
+  80241d:	55                   	push   %ebp
+  80241e:	89 e5                	mov    %esp,%ebp
+  802420:	83 ec 08             	sub    $0x8,%esp
+  802423:	8b 45 08             	mov    0x8(%ebp),%eax
+  802426:	a3 00 70 80 00       	mov    %eax,0x807000
+  80242b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802430:	e8 00 ff ff ff       	call   802335 <nsipc>
+  802435:	c9                   	leave
+  802436:	c3                   	ret
+
+00802437 <nsipc_connect>:
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	53                   	push   %ebx
+  80243b:	83 ec 08             	sub    $0x8,%esp
+  80243e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802441:	8b 45 08             	mov    0x8(%ebp),%eax
+  802444:	a3 00 70 80 00       	mov    %eax,0x807000
+  802449:	53                   	push   %ebx
+  80244a:	ff 75 0c             	push   0xc(%ebp)
+  80244d:	68 04 70 80 00       	push   $0x807004
+  802452:	e8 ac e5 ff ff       	call   800a03 <memmove>
+  802457:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80245d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802462:	e8 ce fe ff ff       	call   802335 <nsipc>
+  802467:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80246a:	c9                   	leave
+  80246b:	c3                   	ret
+
+0080246c <nsipc_listen>:
+  80246c:	55                   	push   %ebp
+  80246d:	89 e5                	mov    %esp,%ebp
+  80246f:	83 ec 08             	sub    $0x8,%esp
+  802472:	8b 45 08             	mov    0x8(%ebp),%eax
+  802475:	a3 00 70 80 00       	mov    %eax,0x807000
+  80247a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80247d:	a3 04 70 80 00       	mov    %eax,0x807004
+  802482:	b8 06 00 00 00       	mov    $0x6,%eax
+  802487:	e8 a9 fe ff ff       	call   802335 <nsipc>
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+
+0080248e <nsipc_recv>:
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	56                   	push   %esi
+  802492:	53                   	push   %ebx
+  802493:	8b 75 10             	mov    0x10(%ebp),%esi
+  802496:	8b 45 08             	mov    0x8(%ebp),%eax
+  802499:	a3 00 70 80 00       	mov    %eax,0x807000
+  80249e:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8024a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024a7:	a3 08 70 80 00       	mov    %eax,0x807008
+  8024ac:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024b1:	e8 7f fe ff ff       	call   802335 <nsipc>
+  8024b6:	89 c3                	mov    %eax,%ebx
+  8024b8:	85 c0                	test   %eax,%eax
+  8024ba:	78 22                	js     8024de <nsipc_recv+0x50>
+  8024bc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8024c1:	39 c6                	cmp    %eax,%esi
+  8024c3:	0f 4e c6             	cmovle %esi,%eax
+  8024c6:	39 c3                	cmp    %eax,%ebx
+  8024c8:	7f 1d                	jg     8024e7 <nsipc_recv+0x59>
+  8024ca:	83 ec 04             	sub    $0x4,%esp
+  8024cd:	53                   	push   %ebx
+  8024ce:	68 00 70 80 00       	push   $0x807000
+  8024d3:	ff 75 0c             	push   0xc(%ebp)
+  8024d6:	e8 28 e5 ff ff       	call   800a03 <memmove>
+  8024db:	83 c4 10             	add    $0x10,%esp
+  8024de:	89 d8                	mov    %ebx,%eax
+  8024e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e3:	5b                   	pop    %ebx
+  8024e4:	5e                   	pop    %esi
+  8024e5:	5d                   	pop    %ebp
+  8024e6:	c3                   	ret
+  8024e7:	68 94 35 80 00       	push   $0x803594
+  8024ec:	68 a9 35 80 00       	push   $0x8035a9
+  8024f1:	6a 60                	push   $0x60
+  8024f3:	68 be 35 80 00       	push   $0x8035be
+  8024f8:	e8 83 07 00 00       	call   802c80 <_panic>
+
+008024fd <nsipc_send>:
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	53                   	push   %ebx
+  802501:	83 ec 04             	sub    $0x4,%esp
+  802504:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802507:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80250f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802515:	7f 2e                	jg     802545 <nsipc_send+0x48>
+  802517:	83 ec 04             	sub    $0x4,%esp
+  80251a:	53                   	push   %ebx
+  80251b:	ff 75 0c             	push   0xc(%ebp)
+  80251e:	68 0c 70 80 00       	push   $0x80700c
+  802523:	e8 db e4 ff ff       	call   800a03 <memmove>
+  802528:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80252e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802531:	a3 08 70 80 00       	mov    %eax,0x807008
+  802536:	b8 08 00 00 00       	mov    $0x8,%eax
+  80253b:	e8 f5 fd ff ff       	call   802335 <nsipc>
+  802540:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802543:	c9                   	leave
+  802544:	c3                   	ret
+  802545:	68 ca 35 80 00       	push   $0x8035ca
+  80254a:	68 a9 35 80 00       	push   $0x8035a9
+  80254f:	6a 6b                	push   $0x6b
+  802551:	68 be 35 80 00       	push   $0x8035be
+  802556:	e8 25 07 00 00       	call   802c80 <_panic>
+
+0080255b <nsipc_socket>:
+  80255b:	55                   	push   %ebp
+  80255c:	89 e5                	mov    %esp,%ebp
+  80255e:	83 ec 08             	sub    $0x8,%esp
+  802561:	8b 45 08             	mov    0x8(%ebp),%eax
+  802564:	a3 00 70 80 00       	mov    %eax,0x807000
+  802569:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80256c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802571:	8b 45 10             	mov    0x10(%ebp),%eax
+  802574:	a3 08 70 80 00       	mov    %eax,0x807008
+  802579:	b8 09 00 00 00       	mov    $0x9,%eax
+  80257e:	e8 b2 fd ff ff       	call   802335 <nsipc>
+  802583:	c9                   	leave
+  802584:	c3                   	ret
+
+00802585 <devpipe_stat>:
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	56                   	push   %esi
+  802589:	53                   	push   %ebx
+  80258a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80258d:	83 ec 0c             	sub    $0xc,%esp
+  802590:	ff 75 08             	push   0x8(%ebp)
+  802593:	e8 99 ef ff ff       	call   801531 <fd2data>
+  802598:	89 c6                	mov    %eax,%esi
+  80259a:	83 c4 08             	add    $0x8,%esp
+  80259d:	68 d6 35 80 00       	push   $0x8035d6
+  8025a2:	53                   	push   %ebx
+  8025a3:	e8 ab e2 ff ff       	call   800853 <strcpy>
+  8025a8:	8b 46 04             	mov    0x4(%esi),%eax
+  8025ab:	2b 06                	sub    (%esi),%eax
+  8025ad:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8025b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025ba:	00 00 00 
+  8025bd:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8025c4:	40 80 00 
+  8025c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025cf:	5b                   	pop    %ebx
+  8025d0:	5e                   	pop    %esi
+  8025d1:	5d                   	pop    %ebp
+  8025d2:	c3                   	ret
+
+008025d3 <devpipe_close>:
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	53                   	push   %ebx
+  8025d7:	83 ec 0c             	sub    $0xc,%esp
+  8025da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025dd:	53                   	push   %ebx
+  8025de:	6a 00                	push   $0x0
+  8025e0:	e8 a0 e7 ff ff       	call   800d85 <sys_page_unmap>
+  8025e5:	89 1c 24             	mov    %ebx,(%esp)
+  8025e8:	e8 44 ef ff ff       	call   801531 <fd2data>
+  8025ed:	83 c4 08             	add    $0x8,%esp
+  8025f0:	50                   	push   %eax
+  8025f1:	6a 00                	push   $0x0
+  8025f3:	e8 8d e7 ff ff       	call   800d85 <sys_page_unmap>
+  8025f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025fb:	c9                   	leave
+  8025fc:	c3                   	ret
+
+008025fd <_pipeisclosed>:
+  8025fd:	55                   	push   %ebp
+  8025fe:	89 e5                	mov    %esp,%ebp
+  802600:	57                   	push   %edi
+  802601:	56                   	push   %esi
+  802602:	53                   	push   %ebx
+  802603:	83 ec 1c             	sub    $0x1c,%esp
+  802606:	89 c7                	mov    %eax,%edi
+  802608:	89 d6                	mov    %edx,%esi
+  80260a:	a1 10 50 80 00       	mov    0x805010,%eax
+  80260f:	8b 58 58             	mov    0x58(%eax),%ebx
+  802612:	83 ec 0c             	sub    $0xc,%esp
+  802615:	57                   	push   %edi
+  802616:	e8 18 09 00 00       	call   802f33 <pageref>
+  80261b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80261e:	89 34 24             	mov    %esi,(%esp)
+  802621:	e8 0d 09 00 00       	call   802f33 <pageref>
+  802626:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  80262c:	8b 4a 58             	mov    0x58(%edx),%ecx
+  80262f:	83 c4 10             	add    $0x10,%esp
+  802632:	39 cb                	cmp    %ecx,%ebx
+  802634:	74 1b                	je     802651 <_pipeisclosed+0x54>
+  802636:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802639:	75 cf                	jne    80260a <_pipeisclosed+0xd>
+  80263b:	8b 42 58             	mov    0x58(%edx),%eax
+  80263e:	6a 01                	push   $0x1
+  802640:	50                   	push   %eax
+  802641:	53                   	push   %ebx
+  802642:	68 dd 35 80 00       	push   $0x8035dd
+  802647:	e8 10 db ff ff       	call   80015c <cprintf>
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	eb b9                	jmp    80260a <_pipeisclosed+0xd>
+  802651:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802654:	0f 94 c0             	sete   %al
+  802657:	0f b6 c0             	movzbl %al,%eax
+  80265a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80265d:	5b                   	pop    %ebx
+  80265e:	5e                   	pop    %esi
+  80265f:	5f                   	pop    %edi
+  802660:	5d                   	pop    %ebp
+  802661:	c3                   	ret
+
+00802662 <devpipe_write>:
+  802662:	55                   	push   %ebp
+  802663:	89 e5                	mov    %esp,%ebp
+  802665:	57                   	push   %edi
+  802666:	56                   	push   %esi
+  802667:	53                   	push   %ebx
+  802668:	83 ec 28             	sub    $0x28,%esp
+  80266b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80266e:	56                   	push   %esi
+  80266f:	e8 bd ee ff ff       	call   801531 <fd2data>
+  802674:	89 c3                	mov    %eax,%ebx
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802682:	74 5c                	je     8026e0 <devpipe_write+0x7e>
+  802684:	8b 43 04             	mov    0x4(%ebx),%eax
+  802687:	8b 0b                	mov    (%ebx),%ecx
+  802689:	8d 51 20             	lea    0x20(%ecx),%edx
+  80268c:	39 d0                	cmp    %edx,%eax
+  80268e:	72 1e                	jb     8026ae <devpipe_write+0x4c>
+  802690:	89 da                	mov    %ebx,%edx
+  802692:	89 f0                	mov    %esi,%eax
+  802694:	e8 64 ff ff ff       	call   8025fd <_pipeisclosed>
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	75 48                	jne    8026e5 <devpipe_write+0x83>
+  80269d:	e8 c6 e5 ff ff       	call   800c68 <sys_yield>
+  8026a2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026a5:	8b 0b                	mov    (%ebx),%ecx
+  8026a7:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026aa:	39 d0                	cmp    %edx,%eax
+  8026ac:	73 e2                	jae    802690 <devpipe_write+0x2e>
+  8026ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8026b5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8026b8:	89 c2                	mov    %eax,%edx
+  8026ba:	c1 fa 1f             	sar    $0x1f,%edx
+  8026bd:	89 d1                	mov    %edx,%ecx
+  8026bf:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026c2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026c5:	83 e2 1f             	and    $0x1f,%edx
+  8026c8:	29 ca                	sub    %ecx,%edx
+  8026ca:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026ce:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8026d2:	83 c0 01             	add    $0x1,%eax
+  8026d5:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026d8:	83 c7 01             	add    $0x1,%edi
+  8026db:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8026de:	75 a4                	jne    802684 <devpipe_write+0x22>
+  8026e0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026e3:	eb 05                	jmp    8026ea <devpipe_write+0x88>
+  8026e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ed:	5b                   	pop    %ebx
+  8026ee:	5e                   	pop    %esi
+  8026ef:	5f                   	pop    %edi
+  8026f0:	5d                   	pop    %ebp
+  8026f1:	c3                   	ret
+
+008026f2 <devpipe_read>:
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	57                   	push   %edi
+  8026f6:	56                   	push   %esi
+  8026f7:	53                   	push   %ebx
+  8026f8:	83 ec 18             	sub    $0x18,%esp
+  8026fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8026fe:	56                   	push   %esi
+  8026ff:	e8 2d ee ff ff       	call   801531 <fd2data>
+  802704:	89 c3                	mov    %eax,%ebx
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	bf 00 00 00 00       	mov    $0x0,%edi
+  80270e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802712:	74 45                	je     802759 <devpipe_read+0x67>
+  802714:	8b 03                	mov    (%ebx),%eax
+  802716:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802719:	75 1d                	jne    802738 <devpipe_read+0x46>
+  80271b:	85 ff                	test   %edi,%edi
+  80271d:	75 3f                	jne    80275e <devpipe_read+0x6c>
+  80271f:	89 da                	mov    %ebx,%edx
+  802721:	89 f0                	mov    %esi,%eax
+  802723:	e8 d5 fe ff ff       	call   8025fd <_pipeisclosed>
+  802728:	85 c0                	test   %eax,%eax
+  80272a:	75 3c                	jne    802768 <devpipe_read+0x76>
+  80272c:	e8 37 e5 ff ff       	call   800c68 <sys_yield>
+  802731:	8b 03                	mov    (%ebx),%eax
+  802733:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802736:	74 e7                	je     80271f <devpipe_read+0x2d>
+  802738:	99                   	cltd
+  802739:	c1 ea 1b             	shr    $0x1b,%edx
+  80273c:	01 d0                	add    %edx,%eax
+  80273e:	83 e0 1f             	and    $0x1f,%eax
+  802741:	29 d0                	sub    %edx,%eax
+  802743:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802748:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80274b:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80274e:	83 03 01             	addl   $0x1,(%ebx)
+  802751:	83 c7 01             	add    $0x1,%edi
+  802754:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802757:	75 bb                	jne    802714 <devpipe_read+0x22>
+  802759:	8b 45 10             	mov    0x10(%ebp),%eax
+  80275c:	eb 02                	jmp    802760 <devpipe_read+0x6e>
+  80275e:	89 f8                	mov    %edi,%eax
+  802760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802763:	5b                   	pop    %ebx
+  802764:	5e                   	pop    %esi
+  802765:	5f                   	pop    %edi
+  802766:	5d                   	pop    %ebp
+  802767:	c3                   	ret
+  802768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276d:	eb f1                	jmp    802760 <devpipe_read+0x6e>
+
+0080276f <pipe>:
+  80276f:	55                   	push   %ebp
+  802770:	89 e5                	mov    %esp,%ebp
+  802772:	56                   	push   %esi
+  802773:	53                   	push   %ebx
+  802774:	83 ec 1c             	sub    $0x1c,%esp
+  802777:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80277a:	50                   	push   %eax
+  80277b:	e8 c8 ed ff ff       	call   801548 <fd_alloc>
+  802780:	89 c3                	mov    %eax,%ebx
+  802782:	83 c4 10             	add    $0x10,%esp
+  802785:	85 c0                	test   %eax,%eax
+  802787:	0f 88 23 01 00 00    	js     8028b0 <pipe+0x141>
+  80278d:	83 ec 04             	sub    $0x4,%esp
+  802790:	68 07 04 00 00       	push   $0x407
+  802795:	ff 75 f4             	push   -0xc(%ebp)
+  802798:	6a 00                	push   $0x0
+  80279a:	e8 14 e5 ff ff       	call   800cb3 <sys_page_alloc>
+  80279f:	89 c3                	mov    %eax,%ebx
+  8027a1:	83 c4 10             	add    $0x10,%esp
+  8027a4:	85 c0                	test   %eax,%eax
+  8027a6:	0f 88 04 01 00 00    	js     8028b0 <pipe+0x141>
+  8027ac:	83 ec 0c             	sub    $0xc,%esp
+  8027af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027b2:	50                   	push   %eax
+  8027b3:	e8 90 ed ff ff       	call   801548 <fd_alloc>
+  8027b8:	89 c3                	mov    %eax,%ebx
+  8027ba:	83 c4 10             	add    $0x10,%esp
+  8027bd:	85 c0                	test   %eax,%eax
+  8027bf:	0f 88 db 00 00 00    	js     8028a0 <pipe+0x131>
+  8027c5:	83 ec 04             	sub    $0x4,%esp
+  8027c8:	68 07 04 00 00       	push   $0x407
+  8027cd:	ff 75 f0             	push   -0x10(%ebp)
+  8027d0:	6a 00                	push   $0x0
+  8027d2:	e8 dc e4 ff ff       	call   800cb3 <sys_page_alloc>
+  8027d7:	89 c3                	mov    %eax,%ebx
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	0f 88 bc 00 00 00    	js     8028a0 <pipe+0x131>
+  8027e4:	83 ec 0c             	sub    $0xc,%esp
+  8027e7:	ff 75 f4             	push   -0xc(%ebp)
+  8027ea:	e8 42 ed ff ff       	call   801531 <fd2data>
+  8027ef:	89 c6                	mov    %eax,%esi
+  8027f1:	83 c4 0c             	add    $0xc,%esp
+  8027f4:	68 07 04 00 00       	push   $0x407
+  8027f9:	50                   	push   %eax
+  8027fa:	6a 00                	push   $0x0
+  8027fc:	e8 b2 e4 ff ff       	call   800cb3 <sys_page_alloc>
+  802801:	89 c3                	mov    %eax,%ebx
+  802803:	83 c4 10             	add    $0x10,%esp
+  802806:	85 c0                	test   %eax,%eax
+  802808:	0f 88 82 00 00 00    	js     802890 <pipe+0x121>
+  80280e:	83 ec 0c             	sub    $0xc,%esp
+  802811:	ff 75 f0             	push   -0x10(%ebp)
+  802814:	e8 18 ed ff ff       	call   801531 <fd2data>
+  802819:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802820:	50                   	push   %eax
+  802821:	6a 00                	push   $0x0
+  802823:	56                   	push   %esi
+  802824:	6a 00                	push   $0x0
+  802826:	e8 cb e4 ff ff       	call   800cf6 <sys_page_map>
+  80282b:	89 c3                	mov    %eax,%ebx
+  80282d:	83 c4 20             	add    $0x20,%esp
+  802830:	85 c0                	test   %eax,%eax
+  802832:	78 4e                	js     802882 <pipe+0x113>
+  802834:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802839:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80283c:	89 02                	mov    %eax,(%edx)
+  80283e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802841:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802848:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80284b:	89 02                	mov    %eax,(%edx)
+  80284d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802850:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802857:	83 ec 0c             	sub    $0xc,%esp
+  80285a:	ff 75 f4             	push   -0xc(%ebp)
+  80285d:	e8 bf ec ff ff       	call   801521 <fd2num>
+  802862:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802865:	89 01                	mov    %eax,(%ecx)
+  802867:	83 c4 04             	add    $0x4,%esp
+  80286a:	ff 75 f0             	push   -0x10(%ebp)
+  80286d:	e8 af ec ff ff       	call   801521 <fd2num>
+  802872:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802875:	89 41 04             	mov    %eax,0x4(%ecx)
+  802878:	83 c4 10             	add    $0x10,%esp
+  80287b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802880:	eb 2e                	jmp    8028b0 <pipe+0x141>
+  802882:	83 ec 08             	sub    $0x8,%esp
+  802885:	56                   	push   %esi
+  802886:	6a 00                	push   $0x0
+  802888:	e8 f8 e4 ff ff       	call   800d85 <sys_page_unmap>
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	83 ec 08             	sub    $0x8,%esp
+  802893:	ff 75 f0             	push   -0x10(%ebp)
+  802896:	6a 00                	push   $0x0
+  802898:	e8 e8 e4 ff ff       	call   800d85 <sys_page_unmap>
+  80289d:	83 c4 10             	add    $0x10,%esp
+  8028a0:	83 ec 08             	sub    $0x8,%esp
+  8028a3:	ff 75 f4             	push   -0xc(%ebp)
+  8028a6:	6a 00                	push   $0x0
+  8028a8:	e8 d8 e4 ff ff       	call   800d85 <sys_page_unmap>
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	89 d8                	mov    %ebx,%eax
+  8028b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028b5:	5b                   	pop    %ebx
+  8028b6:	5e                   	pop    %esi
+  8028b7:	5d                   	pop    %ebp
+  8028b8:	c3                   	ret
+
+008028b9 <pipeisclosed>:
+  8028b9:	55                   	push   %ebp
+  8028ba:	89 e5                	mov    %esp,%ebp
+  8028bc:	83 ec 20             	sub    $0x20,%esp
+  8028bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028c2:	50                   	push   %eax
+  8028c3:	ff 75 08             	push   0x8(%ebp)
+  8028c6:	e8 cd ec ff ff       	call   801598 <fd_lookup>
+  8028cb:	83 c4 10             	add    $0x10,%esp
+  8028ce:	85 c0                	test   %eax,%eax
+  8028d0:	78 18                	js     8028ea <pipeisclosed+0x31>
+  8028d2:	83 ec 0c             	sub    $0xc,%esp
+  8028d5:	ff 75 f4             	push   -0xc(%ebp)
+  8028d8:	e8 54 ec ff ff       	call   801531 <fd2data>
+  8028dd:	89 c2                	mov    %eax,%edx
+  8028df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028e2:	e8 16 fd ff ff       	call   8025fd <_pipeisclosed>
+  8028e7:	83 c4 10             	add    $0x10,%esp
+  8028ea:	c9                   	leave
+  8028eb:	c3                   	ret
+
+008028ec <ipcring_init>:
+  8028ec:	55                   	push   %ebp
+  8028ed:	89 e5                	mov    %esp,%ebp
+  8028ef:	53                   	push   %ebx
+  8028f0:	83 ec 08             	sub    $0x8,%esp
+  8028f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028f6:	6a 60                	push   $0x60
+  8028f8:	6a 00                	push   $0x0
+  8028fa:	53                   	push   %ebx
+  8028fb:	e8 ce e0 ff ff       	call   8009ce <memset>
+  802900:	a1 10 50 80 00       	mov    0x805010,%eax
+  802905:	8b 40 48             	mov    0x48(%eax),%eax
+  802908:	89 03                	mov    %eax,(%ebx)
+  80290a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80290d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802910:	8b 45 10             	mov    0x10(%ebp),%eax
+  802913:	89 43 08             	mov    %eax,0x8(%ebx)
+  802916:	8b 45 14             	mov    0x14(%ebp),%eax
+  802919:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80291c:	83 c4 10             	add    $0x10,%esp
+  80291f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802922:	c9                   	leave
+  802923:	c3                   	ret
+
+00802924 <ipcring_req_slot>:
+  802924:	55                   	push   %ebp
+  802925:	89 e5                	mov    %esp,%ebp
+  802927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292a:	8b 50 10             	mov    0x10(%eax),%edx
+  80292d:	8b 48 18             	mov    0x18(%eax),%ecx
+  802930:	29 ca                	sub    %ecx,%edx
+  802932:	83 fa 07             	cmp    $0x7,%edx
+  802935:	77 0c                	ja     802943 <ipcring_req_slot+0x1f>
+  802937:	8b 50 10             	mov    0x10(%eax),%edx
+  80293a:	83 e2 07             	and    $0x7,%edx
+  80293d:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802941:	5d                   	pop    %ebp
+  802942:	c3                   	ret
+  802943:	b8 00 00 00 00       	mov    $0x0,%eax
+  802948:	eb f7                	jmp    802941 <ipcring_req_slot+0x1d>
+
+0080294a <ipcring_req_push>:
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	83 ec 08             	sub    $0x8,%esp
+  802950:	8b 55 08             	mov    0x8(%ebp),%edx
+  802953:	8b 42 10             	mov    0x10(%edx),%eax
+  802956:	83 c0 01             	add    $0x1,%eax
+  802959:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80295d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802962:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802966:	85 c0                	test   %eax,%eax
+  802968:	75 02                	jne    80296c <ipcring_req_push+0x22>
+  80296a:	c9                   	leave
+  80296b:	c3                   	ret
+  80296c:	6a 00                	push   $0x0
+  80296e:	68 00 00 80 ee       	push   $0xee800000
+  802973:	ff 72 08             	push   0x8(%edx)
+  802976:	ff 72 04             	push   0x4(%edx)
+  802979:	e8 6d e6 ff ff       	call   800feb <sys_ipc_send>
+  80297e:	83 c4 10             	add    $0x10,%esp
+  802981:	eb e7                	jmp    80296a <ipcring_req_push+0x20>
+
+00802983 <ipcring_rsp_wait>:
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	53                   	push   %ebx
+  802987:	83 ec 04             	sub    $0x4,%esp
+  80298a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80298d:	8b 53 18             	mov    0x18(%ebx),%edx
+  802990:	8b 43 10             	mov    0x10(%ebx),%eax
+  802993:	39 c2                	cmp    %eax,%edx
+  802995:	74 3c                	je     8029d3 <ipcring_rsp_wait+0x50>
+  802997:	8b 53 14             	mov    0x14(%ebx),%edx
+  80299a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80299d:	39 c2                	cmp    %eax,%edx
+  80299f:	75 23                	jne    8029c4 <ipcring_rsp_wait+0x41>
+  8029a1:	83 ec 08             	sub    $0x8,%esp
+  8029a4:	6a 00                	push   $0x0
+  8029a6:	6a 00                	push   $0x0
+  8029a8:	6a 00                	push   $0x0
+  8029aa:	6a 00                	push   $0x0
+  8029ac:	ff 73 0c             	push   0xc(%ebx)
+  8029af:	ff 73 04             	push   0x4(%ebx)
+  8029b2:	e8 c7 03 00 00       	call   802d7e <ipc_call>
+  8029b7:	8b 53 14             	mov    0x14(%ebx),%edx
+  8029ba:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029bd:	83 c4 20             	add    $0x20,%esp
+  8029c0:	39 c2                	cmp    %eax,%edx
+  8029c2:	74 dd                	je     8029a1 <ipcring_rsp_wait+0x1e>
+  8029c4:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029c7:	83 e0 07             	and    $0x7,%eax
+  8029ca:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8029ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029d1:	c9                   	leave
+  8029d2:	c3                   	ret
+  8029d3:	68 f8 35 80 00       	push   $0x8035f8
+  8029d8:	68 a9 35 80 00       	push   $0x8035a9
+  8029dd:	6a 3b                	push   $0x3b
+  8029df:	68 19 36 80 00       	push   $0x803619
+  8029e4:	e8 97 02 00 00       	call   802c80 <_panic>
+
+008029e9 <ipcring_rsp_pop>:
+  8029e9:	55                   	push   %ebp
+  8029ea:	89 e5                	mov    %esp,%ebp
+  8029ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029ef:	8b 42 18             	mov    0x18(%edx),%eax
+  8029f2:	83 c0 01             	add    $0x1,%eax
+  8029f5:	89 42 18             	mov    %eax,0x18(%edx)
+  8029f8:	5d                   	pop    %ebp
+  8029f9:	c3                   	ret
+
+008029fa <ipcring_server_init>:
+  8029fa:	55                   	push   %ebp
+  8029fb:	89 e5                	mov    %esp,%ebp
+  8029fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a03:	89 10                	mov    %edx,(%eax)
+  802a05:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a08:	89 50 04             	mov    %edx,0x4(%eax)
+  802a0b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802a12:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802a19:	5d                   	pop    %ebp
+  802a1a:	c3                   	ret
+
+00802a1b <ipcring_req_avail>:
+  802a1b:	55                   	push   %ebp
+  802a1c:	89 e5                	mov    %esp,%ebp
+  802a1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a21:	8b 02                	mov    (%edx),%eax
+  802a23:	8b 40 10             	mov    0x10(%eax),%eax
+  802a26:	2b 42 08             	sub    0x8(%edx),%eax
+  802a29:	ba 08 00 00 00       	mov    $0x8,%edx
+  802a2e:	39 d0                	cmp    %edx,%eax
+  802a30:	0f 47 c2             	cmova  %edx,%eax
+  802a33:	5d                   	pop    %ebp
+  802a34:	c3                   	ret
+
+00802a35 <ipcring_req_peek>:
+  802a35:	55                   	push   %ebp
+  802a36:	89 e5                	mov    %esp,%ebp
+  802a38:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a3b:	8b 42 08             	mov    0x8(%edx),%eax
+  802a3e:	83 e0 07             	and    $0x7,%eax
+  802a41:	8b 12                	mov    (%edx),%edx
+  802a43:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802a47:	5d                   	pop    %ebp
+  802a48:	c3                   	ret
+
+00802a49 <ipcring_rsp_push>:
+  802a49:	55                   	push   %ebp
+  802a4a:	89 e5                	mov    %esp,%ebp
+  802a4c:	83 ec 08             	sub    $0x8,%esp
+  802a4f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a52:	8b 41 08             	mov    0x8(%ecx),%eax
+  802a55:	83 c0 01             	add    $0x1,%eax
+  802a58:	89 41 08             	mov    %eax,0x8(%ecx)
+  802a5b:	8b 11                	mov    (%ecx),%edx
+  802a5d:	83 c2 14             	add    $0x14,%edx
+  802a60:	f0 87 02             	lock xchg %eax,(%edx)
+  802a63:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802a67:	75 02                	jne    802a6b <ipcring_rsp_push+0x22>
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+  802a6b:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802a72:	6a 00                	push   $0x0
+  802a74:	68 00 00 80 ee       	push   $0xee800000
+  802a79:	6a 00                	push   $0x0
+  802a7b:	ff 71 04             	push   0x4(%ecx)
+  802a7e:	e8 8b e4 ff ff       	call   800f0e <sys_ipc_try_send>
+  802a83:	83 c4 10             	add    $0x10,%esp
+  802a86:	eb e1                	jmp    802a69 <ipcring_rsp_push+0x20>
+
+00802a88 <ipcring_client_wait>:
+  802a88:	55                   	push   %ebp
+  802a89:	89 e5                	mov    %esp,%ebp
+  802a8b:	83 ec 08             	sub    $0x8,%esp
+  802a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a91:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802a98:	8b 10                	mov    (%eax),%edx
+  802a9a:	8b 52 18             	mov    0x18(%edx),%edx
+  802a9d:	3b 50 08             	cmp    0x8(%eax),%edx
+  802aa0:	75 02                	jne    802aa4 <ipcring_client_wait+0x1c>
+  802aa2:	c9                   	leave
+  802aa3:	c3                   	ret
+  802aa4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802aab:	6a 00                	push   $0x0
+  802aad:	68 00 00 80 ee       	push   $0xee800000
+  802ab2:	6a 00                	push   $0x0
+  802ab4:	ff 70 04             	push   0x4(%eax)
+  802ab7:	e8 52 e4 ff ff       	call   800f0e <sys_ipc_try_send>
+  802abc:	83 c4 10             	add    $0x10,%esp
+  802abf:	eb e1                	jmp    802aa2 <ipcring_client_wait+0x1a>
+
+00802ac1 <ipcring_server_sleep>:
+  802ac1:	55                   	push   %ebp
+  802ac2:	89 e5                	mov    %esp,%ebp
+  802ac4:	53                   	push   %ebx
+  802ac5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ac8:	8b 01                	mov    (%ecx),%eax
+  802aca:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802acd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ad2:	f0 87 02             	lock xchg %eax,(%edx)
+  802ad5:	8b 11                	mov    (%ecx),%edx
+  802ad7:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802ada:	b8 01 00 00 00       	mov    $0x1,%eax
+  802adf:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802ae2:	74 0e                	je     802af2 <ipcring_server_sleep+0x31>
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae9:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+
+00802af7 <devcons_close>:
+  802af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afc:	c3                   	ret
+
+00802afd <devcons_stat>:
+  802afd:	55                   	push   %ebp
+  802afe:	89 e5                	mov    %esp,%ebp
+  802b00:	83 ec 10             	sub    $0x10,%esp
+  802b03:	68 27 36 80 00       	push   $0x803627
+  802b08:	ff 75 0c             	push   0xc(%ebp)
+  802b0b:	e8 43 dd ff ff       	call   800853 <strcpy>
+  802b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <devcons_write>:
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	57                   	push   %edi
+  802b1b:	56                   	push   %esi
+  802b1c:	53                   	push   %ebx
+  802b1d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802b23:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802b26:	85 ff                	test   %edi,%edi
+  802b28:	74 51                	je     802b7b <devcons_write+0x64>
+  802b2a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b34:	89 fb                	mov    %edi,%ebx
+  802b36:	29 c3                	sub    %eax,%ebx
+  802b38:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802b3d:	39 d3                	cmp    %edx,%ebx
+  802b3f:	0f 47 da             	cmova  %edx,%ebx
+  802b42:	83 ec 04             	sub    $0x4,%esp
+  802b45:	53                   	push   %ebx
+  802b46:	03 45 0c             	add    0xc(%ebp),%eax
+  802b49:	50                   	push   %eax
+  802b4a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802b50:	50                   	push   %eax
+  802b51:	e8 ad de ff ff       	call   800a03 <memmove>
+  802b56:	83 c4 08             	add    $0x8,%esp
+  802b59:	53                   	push   %ebx
+  802b5a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802b60:	50                   	push   %eax
+  802b61:	e8 65 e0 ff ff       	call   800bcb <sys_cputs>
+  802b66:	01 de                	add    %ebx,%esi
+  802b68:	89 f0                	mov    %esi,%eax
+  802b6a:	83 c4 10             	add    $0x10,%esp
+  802b6d:	39 fe                	cmp    %edi,%esi
+  802b6f:	72 c3                	jb     802b34 <devcons_write+0x1d>
+  802b71:	89 f0                	mov    %esi,%eax
+  802b73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b76:	5b                   	pop    %ebx
+  802b77:	5e                   	pop    %esi
+  802b78:	5f                   	pop    %edi
+  802b79:	5d                   	pop    %ebp
+  802b7a:	c3                   	ret
+  802b7b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b80:	eb ef                	jmp    802b71 <devcons_write+0x5a>
+
+00802b82 <devcons_read>:
+  802b82:	55                   	push   %ebp
+  802b83:	89 e5                	mov    %esp,%ebp
+  802b85:	83 ec 08             	sub    $0x8,%esp
+  802b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b91:	75 07                	jne    802b9a <devcons_read+0x18>
+  802b93:	eb 1f                	jmp    802bb4 <devcons_read+0x32>
+  802b95:	e8 ce e0 ff ff       	call   800c68 <sys_yield>
+  802b9a:	e8 4a e0 ff ff       	call   800be9 <sys_cgetc>
+  802b9f:	85 c0                	test   %eax,%eax
+  802ba1:	74 f2                	je     802b95 <devcons_read+0x13>
+  802ba3:	78 0f                	js     802bb4 <devcons_read+0x32>
+  802ba5:	83 f8 04             	cmp    $0x4,%eax
+  802ba8:	74 0c                	je     802bb6 <devcons_read+0x34>
+  802baa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bad:	88 02                	mov    %al,(%edx)
+  802baf:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bb4:	c9                   	leave
+  802bb5:	c3                   	ret
+  802bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbb:	eb f7                	jmp    802bb4 <devcons_read+0x32>
+
+00802bbd <cputchar>:
+  802bbd:	55                   	push   %ebp
+  802bbe:	89 e5                	mov    %esp,%ebp
+  802bc0:	83 ec 20             	sub    $0x20,%esp
+  802bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc6:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802bc9:	6a 01                	push   $0x1
+  802bcb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bce:	50                   	push   %eax
+  802bcf:	e8 f7 df ff ff       	call   800bcb <sys_cputs>
+  802bd4:	83 c4 10             	add    $0x10,%esp
+  802bd7:	c9                   	leave
+  802bd8:	c3                   	ret
+
+00802bd9 <getchar>:
+  802bd9:	55                   	push   %ebp
+  802bda:	89 e5                	mov    %esp,%ebp
+  802bdc:	83 ec 1c             	sub    $0x1c,%esp
+  802bdf:	6a 01                	push   $0x1
+  802be1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802be4:	50                   	push   %eax
+  802be5:	6a 00                	push   $0x0
+  802be7:	e8 0e ec ff ff       	call   8017fa <read>
+  802bec:	83 c4 10             	add    $0x10,%esp
+  802bef:	85 c0                	test   %eax,%eax
+  802bf1:	78 06                	js     802bf9 <getchar+0x20>
+  802bf3:	74 06                	je     802bfb <getchar+0x22>
+  802bf5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802bf9:	c9                   	leave
+  802bfa:	c3                   	ret
+  802bfb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c00:	eb f7                	jmp    802bf9 <getchar+0x20>
+
+00802c02 <iscons>:
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	83 ec 20             	sub    $0x20,%esp
+  802c08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c0b:	50                   	push   %eax
+  802c0c:	ff 75 08             	push   0x8(%ebp)
+  802c0f:	e8 84 e9 ff ff       	call   801598 <fd_lookup>
+  802c14:	83 c4 10             	add    $0x10,%esp
+  802c17:	85 c0                	test   %eax,%eax
+  802c19:	78 11                	js     802c2c <iscons+0x2a>
+  802c1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c1e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c24:	39 10                	cmp    %edx,(%eax)
+  802c26:	0f 94 c0             	sete   %al
+  802c29:	0f b6 c0             	movzbl %al,%eax
+  802c2c:	c9                   	leave
+  802c2d:	c3                   	ret
+
+00802c2e <opencons>:
+  802c2e:	55                   	push   %ebp
+  802c2f:	89 e5                	mov    %esp,%ebp
+  802c31:	83 ec 24             	sub    $0x24,%esp
+  802c34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c37:	50                   	push   %eax
+  802c38:	e8 0b e9 ff ff       	call   801548 <fd_alloc>
+  802c3d:	83 c4 10             	add    $0x10,%esp
+  802c40:	85 c0                	test   %eax,%eax
+  802c42:	78 3a                	js     802c7e <opencons+0x50>
+  802c44:	83 ec 04             	sub    $0x4,%esp
+  802c47:	68 07 04 00 00       	push   $0x407
+  802c4c:	ff 75 f4             	push   -0xc(%ebp)
+  802c4f:	6a 00                	push   $0x0
+  802c51:	e8 5d e0 ff ff       	call   800cb3 <sys_page_alloc>
+  802c56:	83 c4 10             	add    $0x10,%esp
+  802c59:	85 c0                	test   %eax,%eax
+  802c5b:	78 21                	js     802c7e <opencons+0x50>
+  802c5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c60:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c66:	89 10                	mov    %edx,(%eax)
+  802c68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c6b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c72:	83 ec 0c             	sub    $0xc,%esp
+  802c75:	50                   	push   %eax
+  802c76:	e8 a6 e8 ff ff       	call   801521 <fd2num>
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	c9                   	leave
+  802c7f:	c3                   	ret
+
+00802c80 <_panic>:
+  802c80:	55                   	push   %ebp
+  802c81:	89 e5                	mov    %esp,%ebp
+  802c83:	56                   	push   %esi
+  802c84:	53                   	push   %ebx
+  802c85:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802c88:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802c8e:	e8 b6 df ff ff       	call   800c49 <sys_getenvid>
+  802c93:	83 ec 0c             	sub    $0xc,%esp
+  802c96:	ff 75 0c             	push   0xc(%ebp)
+  802c99:	ff 75 08             	push   0x8(%ebp)
+  802c9c:	56                   	push   %esi
+  802c9d:	50                   	push   %eax
+  802c9e:	68 34 36 80 00       	push   $0x803634
+  802ca3:	e8 b4 d4 ff ff       	call   80015c <cprintf>
+  802ca8:	83 c4 18             	add    $0x18,%esp
+  802cab:	53                   	push   %ebx
+  802cac:	ff 75 10             	push   0x10(%ebp)
+  802caf:	e8 57 d4 ff ff       	call   80010b <vcprintf>
+  802cb4:	c7 04 24 ee 35 80 00 	movl   $0x8035ee,(%esp)
+  802cbb:	e8 9c d4 ff ff       	call   80015c <cprintf>
+  802cc0:	83 c4 10             	add    $0x10,%esp
+  802cc3:	cc                   	int3
+  802cc4:	eb fd                	jmp    802cc3 <_panic+0x43>
+
+00802cc6 <ipc_recv>:
+  802cc6:	55                   	push   %ebp
+  802cc7:	89 e5                	mov    %esp,%ebp
+  802cc9:	56                   	push   %esi
+  802cca:	53                   	push   %ebx
+  802ccb:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cd4:	85 c0                	test   %eax,%eax
+  802cd6:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cdb:	0f 44 c2             	cmove  %edx,%eax
+  802cde:	83 ec 0c             	sub    $0xc,%esp
+  802ce1:	50                   	push   %eax
+  802ce2:	e8 77 e2 ff ff       	call   800f5e <sys_ipc_recv>
+  802ce7:	83 c4 10             	add    $0x10,%esp
+  802cea:	85 c0                	test   %eax,%eax
+  802cec:	78 2a                	js     802d18 <ipc_recv+0x52>
+  802cee:	a1 10 50 80 00       	mov    0x805010,%eax
+  802cf3:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802cf9:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802cff:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d05:	85 f6                	test   %esi,%esi
+  802d07:	74 02                	je     802d0b <ipc_recv+0x45>
+  802d09:	89 0e                	mov    %ecx,(%esi)
+  802d0b:	85 db                	test   %ebx,%ebx
+  802d0d:	74 02                	je     802d11 <ipc_recv+0x4b>
+  802d0f:	89 13                	mov    %edx,(%ebx)
+  802d11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d14:	5b                   	pop    %ebx
+  802d15:	5e                   	pop    %esi
+  802d16:	5d                   	pop    %ebp
+  802d17:	c3                   	ret
+  802d18:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d22:	eb e1                	jmp    802d05 <ipc_recv+0x3f>
+
+00802d24 <ipc_send>:
+  802d24:	55                   	push   %ebp
+  802d25:	89 e5                	mov    %esp,%ebp
+  802d27:	57                   	push   %edi
+  802d28:	56                   	push   %esi
+  802d29:	53                   	push   %ebx
+  802d2a:	83 ec 0c             	sub    $0xc,%esp
+  802d2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d33:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d36:	85 db                	test   %ebx,%ebx
+  802d38:	74 1e                	je     802d58 <ipc_send+0x34>
+  802d3a:	56                   	push   %esi
+  802d3b:	53                   	push   %ebx
+  802d3c:	57                   	push   %edi
+  802d3d:	ff 75 08             	push   0x8(%ebp)
+  802d40:	e8 a6 e2 ff ff       	call   800feb <sys_ipc_send>
+  802d45:	83 c4 10             	add    $0x10,%esp
+  802d48:	85 c0                	test   %eax,%eax
+  802d4a:	74 2a                	je     802d76 <ipc_send+0x52>
+  802d4c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d4f:	75 13                	jne    802d64 <ipc_send+0x40>
+  802d51:	e8 12 df ff ff       	call   800c68 <sys_yield>
+  802d56:	eb e2                	jmp    802d3a <ipc_send+0x16>
+  802d58:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5d:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d62:	eb d6                	jmp    802d3a <ipc_send+0x16>
+  802d64:	50                   	push   %eax
+  802d65:	68 58 36 80 00       	push   $0x803658
+  802d6a:	6a 4f                	push   $0x4f
+  802d6c:	68 9b 36 80 00       	push   $0x80369b
+  802d71:	e8 0a ff ff ff       	call   802c80 <_panic>
+  802d76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d79:	5b                   	pop    %ebx
+  802d7a:	5e                   	pop    %esi
+  802d7b:	5f                   	pop    %edi
+  802d7c:	5d                   	pop    %ebp
+  802d7d:	c3                   	ret
+
+00802d7e <ipc_call>:
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	57                   	push   %edi
+  802d82:	56                   	push   %esi
+  802d83:	53                   	push   %ebx
+  802d84:	83 ec 0c             	sub    $0xc,%esp
+  802d87:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d8b:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d90:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d94:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d98:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d9d:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802da1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802daa:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802dae:	eb 05                	jmp    802db5 <ipc_call+0x37>
+  802db0:	e8 b3 de ff ff       	call   800c68 <sys_yield>
+  802db5:	83 ec 0c             	sub    $0xc,%esp
+  802db8:	56                   	push   %esi
+  802db9:	53                   	push   %ebx
+  802dba:	57                   	push   %edi
+  802dbb:	ff 75 0c             	push   0xc(%ebp)
+  802dbe:	ff 75 08             	push   0x8(%ebp)
+  802dc1:	e8 75 e2 ff ff       	call   80103b <sys_ipc_call>
+  802dc6:	83 c4 20             	add    $0x20,%esp
+  802dc9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dcc:	74 e2                	je     802db0 <ipc_call+0x32>
+  802dce:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802dd1:	74 2d                	je     802e00 <ipc_call+0x82>
+  802dd3:	85 c0                	test   %eax,%eax
+  802dd5:	78 4f                	js     802e26 <ipc_call+0xa8>
+  802dd7:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802ddb:	74 10                	je     802ded <ipc_call+0x6f>
+  802ddd:	a1 10 50 80 00       	mov    0x805010,%eax
+  802de2:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802de8:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802deb:	89 02                	mov    %eax,(%edx)
+  802ded:	a1 10 50 80 00       	mov    0x805010,%eax
+  802df2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802df8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dfb:	5b                   	pop    %ebx
+  802dfc:	5e                   	pop    %esi
+  802dfd:	5f                   	pop    %edi
+  802dfe:	5d                   	pop    %ebp
+  802dff:	c3                   	ret
+  802e00:	ff 75 14             	push   0x14(%ebp)
+  802e03:	ff 75 10             	push   0x10(%ebp)
+  802e06:	ff 75 0c             	push   0xc(%ebp)
+  802e09:	ff 75 08             	push   0x8(%ebp)
+  802e0c:	e8 13 ff ff ff       	call   802d24 <ipc_send>
+  802e11:	83 c4 0c             	add    $0xc,%esp
+  802e14:	ff 75 1c             	push   0x1c(%ebp)
+  802e17:	ff 75 18             	push   0x18(%ebp)
+  802e1a:	6a 00                	push   $0x0
+  802e1c:	e8 a5 fe ff ff       	call   802cc6 <ipc_recv>
+  802e21:	83 c4 10             	add    $0x10,%esp
+  802e24:	eb d2                	jmp    802df8 <ipc_call+0x7a>
+  802e26:	50                   	push   %eax
+  802e27:	68 a5 36 80 00       	push   $0x8036a5
+  802e2c:	6a 6d                	push   $0x6d
+  802e2e:	68 9b 36 80 00       	push   $0x80369b
+  802e33:	e8 48 fe ff ff       	call   802c80 <_panic>
+
+00802e38 <ipc_reply_recv>:
+  802e38:	55                   	push   %ebp
+  802e39:	89 e5                	mov    %esp,%ebp
+  802e3b:	57                   	push   %edi
+  802e3c:	56                   	push   %esi
+  802e3d:	53                   	push   %ebx
+  802e3e:	83 ec 0c             	sub    $0xc,%esp
+  802e41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e44:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e47:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e4a:	85 db                	test   %ebx,%ebx
+  802e4c:	0f 84 ac 00 00 00    	je     802efe <ipc_reply_recv+0xc6>
+  802e52:	85 f6                	test   %esi,%esi
+  802e54:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e59:	0f 45 c6             	cmovne %esi,%eax
+  802e5c:	83 ec 0c             	sub    $0xc,%esp
+  802e5f:	50                   	push   %eax
+  802e60:	ff 75 14             	push   0x14(%ebp)
+  802e63:	53                   	push   %ebx
+  802e64:	ff 75 0c             	push   0xc(%ebp)
+  802e67:	ff 75 08             	push   0x8(%ebp)
+  802e6a:	e8 ed e1 ff ff       	call   80105c <sys_ipc_reply_recv>
+  802e6f:	83 c4 20             	add    $0x20,%esp
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	78 3a                	js     802eb0 <ipc_reply_recv+0x78>
+  802e76:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e7a:	74 10                	je     802e8c <ipc_reply_recv+0x54>
+  802e7c:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e81:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e87:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e8a:	89 02                	mov    %eax,(%edx)
+  802e8c:	85 ff                	test   %edi,%edi
+  802e8e:	74 0d                	je     802e9d <ipc_reply_recv+0x65>
+  802e90:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e95:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e9b:	89 07                	mov    %eax,(%edi)
+  802e9d:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ea2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eab:	5b                   	pop    %ebx
+  802eac:	5e                   	pop    %esi
+  802ead:	5f                   	pop    %edi
+  802eae:	5d                   	pop    %ebp
+  802eaf:	c3                   	ret
+  802eb0:	ff 75 14             	push   0x14(%ebp)
+  802eb3:	53                   	push   %ebx
+  802eb4:	ff 75 0c             	push   0xc(%ebp)
+  802eb7:	ff 75 08             	push   0x8(%ebp)
+  802eba:	e8 4f e0 ff ff       	call   800f0e <sys_ipc_try_send>
+  802ebf:	89 c2                	mov    %eax,%edx
+  802ec1:	c1 ea 1f             	shr    $0x1f,%edx
+  802ec4:	83 c4 10             	add    $0x10,%esp
+  802ec7:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802eca:	0f 95 c1             	setne  %cl
+  802ecd:	84 d1                	test   %dl,%cl
+  802ecf:	74 05                	je     802ed6 <ipc_reply_recv+0x9e>
+  802ed1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ed4:	75 12                	jne    802ee8 <ipc_reply_recv+0xb0>
+  802ed6:	83 ec 04             	sub    $0x4,%esp
+  802ed9:	57                   	push   %edi
+  802eda:	56                   	push   %esi
+  802edb:	ff 75 18             	push   0x18(%ebp)
+  802ede:	e8 e3 fd ff ff       	call   802cc6 <ipc_recv>
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	eb c0                	jmp    802ea8 <ipc_reply_recv+0x70>
+  802ee8:	83 ec 04             	sub    $0x4,%esp
+  802eeb:	50                   	push   %eax
+  802eec:	ff 75 08             	push   0x8(%ebp)
+  802eef:	68 78 36 80 00       	push   $0x803678
+  802ef4:	e8 63 d2 ff ff       	call   80015c <cprintf>
+  802ef9:	83 c4 10             	add    $0x10,%esp
+  802efc:	eb d8                	jmp    802ed6 <ipc_reply_recv+0x9e>
+  802efe:	85 f6                	test   %esi,%esi
+  802f00:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f05:	0f 45 c6             	cmovne %esi,%eax
+  802f08:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f0d:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f14:	e9 43 ff ff ff       	jmp    802e5c <ipc_reply_recv+0x24>
+
+00802f19 <ipc_find_env>:
+  802f19:	55                   	push   %ebp
+  802f1a:	89 e5                	mov    %esp,%ebp
+  802f1c:	83 ec 14             	sub    $0x14,%esp
+  802f1f:	ff 75 08             	push   0x8(%ebp)
+  802f22:	e8 85 df ff ff       	call   800eac <sys_env_service>
+  802f27:	85 c0                	test   %eax,%eax
+  802f29:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f2e:	0f 48 c2             	cmovs  %edx,%eax
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+
+00802f33 <pageref>:
+  802f33:	55                   	push   %ebp
+  802f34:	89 e5                	mov    %esp,%ebp
+  802f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f39:	89 c2                	mov    %eax,%edx
+  802f3b:	c1 ea 16             	shr    $0x16,%edx
+  802f3e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4a:	f6 c1 01             	test   $0x1,%cl
+  802f4d:	74 22                	je     802f71 <pageref+0x3e>
+  802f4f:	c1 e8 0c             	shr    $0xc,%eax
+  802f52:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f59:	a8 01                	test   $0x1,%al
+  802f5b:	74 14                	je     802f71 <pageref+0x3e>
+  802f5d:	c1 e8 0c             	shr    $0xc,%eax
+  802f60:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f63:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f6a:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f6e:	0f b7 d2             	movzwl %dx,%edx
+  802f71:	89 d0                	mov    %edx,%eax
+  802f73:	5d                   	pop    %ebp
+  802f74:	c3                   	ret
+
+00802f75 <__udivmoddi4>:
+  802f75:	55                   	push   %ebp
+  802f76:	57                   	push   %edi
+  802f77:	56                   	push   %esi
+  802f78:	53                   	push   %ebx
+  802f79:	83 ec 24             	sub    $0x24,%esp
+  802f7c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f80:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f84:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f88:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f8c:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f90:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f94:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f98:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f9c:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802faa:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802faf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fb6:	00 
+  802fb7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fbe:	00 
+  802fbf:	89 fb                	mov    %edi,%ebx
+  802fc1:	eb 08                	jmp    802fcb <__udivmoddi4+0x56>
+  802fc3:	83 e9 01             	sub    $0x1,%ecx
+  802fc6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fc9:	74 68                	je     803033 <__udivmoddi4+0xbe>
+  802fcb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fcf:	01 c0                	add    %eax,%eax
+  802fd1:	89 c6                	mov    %eax,%esi
+  802fd3:	89 d7                	mov    %edx,%edi
+  802fd5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fd9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fdd:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fe0:	d3 ea                	shr    %cl,%edx
+  802fe2:	f6 c1 20             	test   $0x20,%cl
+  802fe5:	74 04                	je     802feb <__udivmoddi4+0x76>
+  802fe7:	89 d0                	mov    %edx,%eax
+  802fe9:	31 d2                	xor    %edx,%edx
+  802feb:	83 e0 01             	and    $0x1,%eax
+  802fee:	89 04 24             	mov    %eax,(%esp)
+  802ff1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802ff8:	00 
+  802ff9:	8b 04 24             	mov    (%esp),%eax
+  802ffc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803000:	09 f0                	or     %esi,%eax
+  803002:	09 fa                	or     %edi,%edx
+  803004:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803008:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80300c:	39 f0                	cmp    %esi,%eax
+  80300e:	89 d5                	mov    %edx,%ebp
+  803010:	19 fd                	sbb    %edi,%ebp
+  803012:	72 af                	jb     802fc3 <__udivmoddi4+0x4e>
+  803014:	29 f0                	sub    %esi,%eax
+  803016:	19 fa                	sbb    %edi,%edx
+  803018:	89 cf                	mov    %ecx,%edi
+  80301a:	c1 ef 05             	shr    $0x5,%edi
+  80301d:	83 e7 01             	and    $0x1,%edi
+  803020:	89 fe                	mov    %edi,%esi
+  803022:	83 f6 01             	xor    $0x1,%esi
+  803025:	d3 e6                	shl    %cl,%esi
+  803027:	d3 e7                	shl    %cl,%edi
+  803029:	09 74 24 18          	or     %esi,0x18(%esp)
+  80302d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803031:	eb 90                	jmp    802fc3 <__udivmoddi4+0x4e>
+  803033:	85 db                	test   %ebx,%ebx
+  803035:	74 05                	je     80303c <__udivmoddi4+0xc7>
+  803037:	89 03                	mov    %eax,(%ebx)
+  803039:	89 53 04             	mov    %edx,0x4(%ebx)
+  80303c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803040:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803044:	83 c4 24             	add    $0x24,%esp
+  803047:	5b                   	pop    %ebx
+  803048:	5e                   	pop    %esi
+  803049:	5f                   	pop    %edi
+  80304a:	5d                   	pop    %ebp
+  80304b:	c3                   	ret
+
+0080304c <__udivdi3>:
+  80304c:	83 ec 08             	sub    $0x8,%esp
+  80304f:	6a 00                	push   $0x0
+  803051:	ff 74 24 1c          	push   0x1c(%esp)
+  803055:	ff 74 24 1c          	push   0x1c(%esp)
+  803059:	ff 74 24 1c          	push   0x1c(%esp)
+  80305d:	ff 74 24 1c          	push   0x1c(%esp)
+  803061:	e8 0f ff ff ff       	call   802f75 <__udivmoddi4>
+  803066:	83 c4 1c             	add    $0x1c,%esp
+  803069:	c3                   	ret
+
+0080306a <__umoddi3>:
+  80306a:	83 ec 18             	sub    $0x18,%esp
+  80306d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803071:	50                   	push   %eax
+  803072:	ff 74 24 2c          	push   0x2c(%esp)
+  803076:	ff 74 24 2c          	push   0x2c(%esp)
+  80307a:	ff 74 24 2c          	push   0x2c(%esp)
+  80307e:	ff 74 24 2c          	push   0x2c(%esp)
+  803082:	e8 ee fe ff ff       	call   802f75 <__udivmoddi4>
+  803087:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80308b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80308f:	83 c4 2c             	add    $0x2c,%esp
+  803092:	c3                   	ret
+
+00803093 <__divdi3>:
+  803093:	53                   	push   %ebx
+  803094:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803098:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80309c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8030a0:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030a4:	85 d2                	test   %edx,%edx
+  8030a6:	78 12                	js     8030ba <__divdi3+0x27>
+  8030a8:	85 db                	test   %ebx,%ebx
+  8030aa:	78 2e                	js     8030da <__divdi3+0x47>
+  8030ac:	53                   	push   %ebx
+  8030ad:	51                   	push   %ecx
+  8030ae:	52                   	push   %edx
+  8030af:	50                   	push   %eax
+  8030b0:	e8 97 ff ff ff       	call   80304c <__udivdi3>
+  8030b5:	83 c4 10             	add    $0x10,%esp
+  8030b8:	eb 1e                	jmp    8030d8 <__divdi3+0x45>
+  8030ba:	f7 d8                	neg    %eax
+  8030bc:	83 d2 00             	adc    $0x0,%edx
+  8030bf:	f7 da                	neg    %edx
+  8030c1:	85 db                	test   %ebx,%ebx
+  8030c3:	78 2a                	js     8030ef <__divdi3+0x5c>
+  8030c5:	53                   	push   %ebx
+  8030c6:	51                   	push   %ecx
+  8030c7:	52                   	push   %edx
+  8030c8:	50                   	push   %eax
+  8030c9:	e8 7e ff ff ff       	call   80304c <__udivdi3>
+  8030ce:	83 c4 10             	add    $0x10,%esp
+  8030d1:	f7 d8                	neg    %eax
+  8030d3:	83 d2 00             	adc    $0x0,%edx
+  8030d6:	f7 da                	neg    %edx
+  8030d8:	5b                   	pop    %ebx
+  8030d9:	c3                   	ret
+  8030da:	f7 d9                	neg    %ecx
+  8030dc:	83 d3 00             	adc    $0x0,%ebx
+  8030df:	f7 db                	neg    %ebx
+  8030e1:	53                   	push   %ebx
+  8030e2:	51                   	push   %ecx
+  8030e3:	52                   	push   %edx
+  8030e4:	50                   	push   %eax
+  8030e5:	e8 62 ff ff ff       	call   80304c <__udivdi3>
+  8030ea:	83 c4 10             	add    $0x10,%esp
+  8030ed:	eb e2                	jmp    8030d1 <__divdi3+0x3e>
+  8030ef:	f7 d9                	neg    %ecx
+  8030f1:	83 d3 00             	adc    $0x0,%ebx
+  8030f4:	f7 db                	neg    %ebx
+  8030f6:	53                   	push   %ebx
+  8030f7:	51                   	push   %ecx
+  8030f8:	52                   	push   %edx
+  8030f9:	50                   	push   %eax
+  8030fa:	e8 4d ff ff ff       	call   80304c <__udivdi3>
+  8030ff:	83 c4 10             	add    $0x10,%esp
+  803102:	eb d4                	jmp    8030d8 <__divdi3+0x45>
+
+00803104 <__moddi3>:
+  803104:	55                   	push   %ebp
+  803105:	57                   	push   %edi
+  803106:	56                   	push   %esi
+  803107:	53                   	push   %ebx
+  803108:	83 ec 0c             	sub    $0xc,%esp
+  80310b:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80310f:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803113:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803117:	89 e9                	mov    %ebp,%ecx
+  803119:	f7 d9                	neg    %ecx
+  80311b:	89 d0                	mov    %edx,%eax
+  80311d:	83 d0 00             	adc    $0x0,%eax
+  803120:	f7 d8                	neg    %eax
+  803122:	0f 49 e9             	cmovns %ecx,%ebp
+  803125:	0f 49 d0             	cmovns %eax,%edx
+  803128:	52                   	push   %edx
+  803129:	55                   	push   %ebp
+  80312a:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80312e:	f7 da                	neg    %edx
+  803130:	89 d8                	mov    %ebx,%eax
+  803132:	83 d0 00             	adc    $0x0,%eax
+  803135:	f7 d8                	neg    %eax
+  803137:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80313c:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803140:	0f 48 c3             	cmovs  %ebx,%eax
+  803143:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803147:	ff 74 24 0c          	push   0xc(%esp)
+  80314b:	ff 74 24 0c          	push   0xc(%esp)
+  80314f:	e8 16 ff ff ff       	call   80306a <__umoddi3>
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	85 db                	test   %ebx,%ebx
+  803159:	78 08                	js     803163 <__moddi3+0x5f>
+  80315b:	83 c4 0c             	add    $0xc,%esp
+  80315e:	5b                   	pop    %ebx
+  80315f:	5e                   	pop    %esi
+  803160:	5f                   	pop    %edi
+  803161:	5d                   	pop    %ebp
+  803162:	c3                   	ret
+  803163:	f7 d8                	neg    %eax
+  803165:	83 d2 00             	adc    $0x0,%edx
+  803168:	f7 da                	neg    %edx
+  80316a:	eb ef                	jmp    80315b <__moddi3+0x57>
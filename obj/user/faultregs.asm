@@ -0,0 +1,5460 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 aa 05 00 00       	call   8005db <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 d1 37 80 00       	push   $0x8037d1
+  800049:	68 a0 37 80 00       	push   $0x8037a0
+  80004e:	e8 dc 06 00 00       	call   80072f <cprintf>
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 b0 37 80 00       	push   $0x8037b0
+  80005c:	68 b4 37 80 00       	push   $0x8037b4
+  800061:	e8 c9 06 00 00       	call   80072f <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 c8 37 80 00       	push   $0x8037c8
+  80007b:	e8 af 06 00 00       	call   80072f <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 d2 37 80 00       	push   $0x8037d2
+  800093:	68 b4 37 80 00       	push   $0x8037b4
+  800098:	e8 92 06 00 00       	call   80072f <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 c8 37 80 00       	push   $0x8037c8
+  8000b4:	e8 76 06 00 00       	call   80072f <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 d6 37 80 00       	push   $0x8037d6
+  8000cc:	68 b4 37 80 00       	push   $0x8037b4
+  8000d1:	e8 59 06 00 00       	call   80072f <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 c8 37 80 00       	push   $0x8037c8
+  8000ed:	e8 3d 06 00 00       	call   80072f <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 da 37 80 00       	push   $0x8037da
+  800105:	68 b4 37 80 00       	push   $0x8037b4
+  80010a:	e8 20 06 00 00       	call   80072f <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 c8 37 80 00       	push   $0x8037c8
+  800126:	e8 04 06 00 00       	call   80072f <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 de 37 80 00       	push   $0x8037de
+  80013e:	68 b4 37 80 00       	push   $0x8037b4
+  800143:	e8 e7 05 00 00       	call   80072f <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 c8 37 80 00       	push   $0x8037c8
+  80015f:	e8 cb 05 00 00       	call   80072f <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 e2 37 80 00       	push   $0x8037e2
+  800177:	68 b4 37 80 00       	push   $0x8037b4
+  80017c:	e8 ae 05 00 00       	call   80072f <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 c8 37 80 00       	push   $0x8037c8
+  800198:	e8 92 05 00 00       	call   80072f <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 e6 37 80 00       	push   $0x8037e6
+  8001b0:	68 b4 37 80 00       	push   $0x8037b4
+  8001b5:	e8 75 05 00 00       	call   80072f <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 c8 37 80 00       	push   $0x8037c8
+  8001d1:	e8 59 05 00 00       	call   80072f <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 ea 37 80 00       	push   $0x8037ea
+  8001e9:	68 b4 37 80 00       	push   $0x8037b4
+  8001ee:	e8 3c 05 00 00       	call   80072f <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 c8 37 80 00       	push   $0x8037c8
+  80020a:	e8 20 05 00 00       	call   80072f <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 ee 37 80 00       	push   $0x8037ee
+  800222:	68 b4 37 80 00       	push   $0x8037b4
+  800227:	e8 03 05 00 00       	call   80072f <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 c8 37 80 00       	push   $0x8037c8
+  800243:	e8 e7 04 00 00       	call   80072f <cprintf>
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 f5 37 80 00       	push   $0x8037f5
+  800253:	68 b4 37 80 00       	push   $0x8037b4
+  800258:	e8 d2 04 00 00       	call   80072f <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 c8 37 80 00       	push   $0x8037c8
+  800274:	e8 b6 04 00 00       	call   80072f <cprintf>
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 f9 37 80 00       	push   $0x8037f9
+  800284:	e8 a6 04 00 00       	call   80072f <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 c8 37 80 00       	push   $0x8037c8
+  800294:	e8 96 04 00 00       	call   80072f <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 c4 37 80 00       	push   $0x8037c4
+  8002a9:	e8 81 04 00 00       	call   80072f <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 c4 37 80 00       	push   $0x8037c4
+  8002c3:	e8 67 04 00 00       	call   80072f <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 c4 37 80 00       	push   $0x8037c4
+  8002d8:	e8 52 04 00 00       	call   80072f <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 c4 37 80 00       	push   $0x8037c4
+  8002ed:	e8 3d 04 00 00       	call   80072f <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 c4 37 80 00       	push   $0x8037c4
+  800302:	e8 28 04 00 00       	call   80072f <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 c4 37 80 00       	push   $0x8037c4
+  800317:	e8 13 04 00 00       	call   80072f <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 c4 37 80 00       	push   $0x8037c4
+  80032c:	e8 fe 03 00 00       	call   80072f <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 c4 37 80 00       	push   $0x8037c4
+  800341:	e8 e9 03 00 00       	call   80072f <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 c4 37 80 00       	push   $0x8037c4
+  800356:	e8 d4 03 00 00       	call   80072f <cprintf>
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 f5 37 80 00       	push   $0x8037f5
+  800366:	68 b4 37 80 00       	push   $0x8037b4
+  80036b:	e8 bf 03 00 00       	call   80072f <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 c4 37 80 00       	push   $0x8037c4
+  800387:	e8 a3 03 00 00       	call   80072f <cprintf>
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 f9 37 80 00       	push   $0x8037f9
+  800397:	e8 93 03 00 00       	call   80072f <cprintf>
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 c4 37 80 00       	push   $0x8037c4
+  8003af:	e8 7b 03 00 00       	call   80072f <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 c4 37 80 00       	push   $0x8037c4
+  8003c7:	e8 63 03 00 00       	call   80072f <cprintf>
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 f9 37 80 00       	push   $0x8037f9
+  8003d7:	e8 53 03 00 00       	call   80072f <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 9d 00 00 00    	jne    800498 <pgfault+0xb4>
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 50 80 00    	mov    %edx,0x805040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 50 80 00    	mov    %edx,0x805044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 50 80 00    	mov    %edx,0x805048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 50 80 00    	mov    %edx,0x80504c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 50 80 00    	mov    %edx,0x805050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 50 80 00    	mov    %edx,0x805054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 50 80 00    	mov    %edx,0x805058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 50 80 00    	mov    %edx,0x80505c
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 50 80 00    	mov    %edx,0x805060
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	89 15 64 50 80 00    	mov    %edx,0x805064
+  800455:	8b 40 30             	mov    0x30(%eax),%eax
+  800458:	a3 68 50 80 00       	mov    %eax,0x805068
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	68 1f 38 80 00       	push   $0x80381f
+  800465:	68 2d 38 80 00       	push   $0x80382d
+  80046a:	b9 40 50 80 00       	mov    $0x805040,%ecx
+  80046f:	ba 18 38 80 00       	mov    $0x803818,%edx
+  800474:	b8 80 50 80 00       	mov    $0x805080,%eax
+  800479:	e8 b5 fb ff ff       	call   800033 <check_regs>
+  80047e:	83 c4 0c             	add    $0xc,%esp
+  800481:	6a 07                	push   $0x7
+  800483:	68 00 00 40 00       	push   $0x400000
+  800488:	6a 00                	push   $0x0
+  80048a:	e8 f7 0d 00 00       	call   801286 <sys_page_alloc>
+  80048f:	83 c4 10             	add    $0x10,%esp
+  800492:	85 c0                	test   %eax,%eax
+  800494:	78 1a                	js     8004b0 <pgfault+0xcc>
+  800496:	c9                   	leave
+  800497:	c3                   	ret
+  800498:	83 ec 0c             	sub    $0xc,%esp
+  80049b:	ff 70 28             	push   0x28(%eax)
+  80049e:	52                   	push   %edx
+  80049f:	68 60 38 80 00       	push   $0x803860
+  8004a4:	6a 50                	push   $0x50
+  8004a6:	68 07 38 80 00       	push   $0x803807
+  8004ab:	e8 a4 01 00 00       	call   800654 <_panic>
+  8004b0:	50                   	push   %eax
+  8004b1:	68 34 38 80 00       	push   $0x803834
+  8004b6:	6a 5c                	push   $0x5c
+  8004b8:	68 07 38 80 00       	push   $0x803807
+  8004bd:	e8 92 01 00 00       	call   800654 <_panic>
+
+008004c2 <umain>:
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	83 ec 14             	sub    $0x14,%esp
+  8004c8:	68 e4 03 80 00       	push   $0x8003e4
+  8004cd:	e8 22 16 00 00       	call   801af4 <set_pgfault_handler>
+  8004d2:	50                   	push   %eax
+  8004d3:	9c                   	pushf
+  8004d4:	58                   	pop    %eax
+  8004d5:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004da:	50                   	push   %eax
+  8004db:	9d                   	popf
+  8004dc:	a3 a4 50 80 00       	mov    %eax,0x8050a4
+  8004e1:	8d 05 1c 05 80 00    	lea    0x80051c,%eax
+  8004e7:	a3 a0 50 80 00       	mov    %eax,0x8050a0
+  8004ec:	58                   	pop    %eax
+  8004ed:	89 3d 80 50 80 00    	mov    %edi,0x805080
+  8004f3:	89 35 84 50 80 00    	mov    %esi,0x805084
+  8004f9:	89 2d 88 50 80 00    	mov    %ebp,0x805088
+  8004ff:	89 1d 90 50 80 00    	mov    %ebx,0x805090
+  800505:	89 15 94 50 80 00    	mov    %edx,0x805094
+  80050b:	89 0d 98 50 80 00    	mov    %ecx,0x805098
+  800511:	a3 9c 50 80 00       	mov    %eax,0x80509c
+  800516:	89 25 a8 50 80 00    	mov    %esp,0x8050a8
+  80051c:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800523:	00 00 00 
+  800526:	89 3d 00 50 80 00    	mov    %edi,0x805000
+  80052c:	89 35 04 50 80 00    	mov    %esi,0x805004
+  800532:	89 2d 08 50 80 00    	mov    %ebp,0x805008
+  800538:	89 1d 10 50 80 00    	mov    %ebx,0x805010
+  80053e:	89 15 14 50 80 00    	mov    %edx,0x805014
+  800544:	89 0d 18 50 80 00    	mov    %ecx,0x805018
+  80054a:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  80054f:	89 25 28 50 80 00    	mov    %esp,0x805028
+  800555:	8b 3d 80 50 80 00    	mov    0x805080,%edi
+  80055b:	8b 35 84 50 80 00    	mov    0x805084,%esi
+  800561:	8b 2d 88 50 80 00    	mov    0x805088,%ebp
+  800567:	8b 1d 90 50 80 00    	mov    0x805090,%ebx
+  80056d:	8b 15 94 50 80 00    	mov    0x805094,%edx
+  800573:	8b 0d 98 50 80 00    	mov    0x805098,%ecx
+  800579:	a1 9c 50 80 00       	mov    0x80509c,%eax
+  80057e:	8b 25 a8 50 80 00    	mov    0x8050a8,%esp
+  800584:	50                   	push   %eax
+  800585:	9c                   	pushf
+  800586:	58                   	pop    %eax
+  800587:	a3 24 50 80 00       	mov    %eax,0x805024
+  80058c:	58                   	pop    %eax
+  80058d:	83 c4 10             	add    $0x10,%esp
+  800590:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  800597:	75 30                	jne    8005c9 <umain+0x107>
+  800599:	a1 a0 50 80 00       	mov    0x8050a0,%eax
+  80059e:	a3 20 50 80 00       	mov    %eax,0x805020
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	68 47 38 80 00       	push   $0x803847
+  8005ab:	68 58 38 80 00       	push   $0x803858
+  8005b0:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  8005b5:	ba 18 38 80 00       	mov    $0x803818,%edx
+  8005ba:	b8 80 50 80 00       	mov    $0x805080,%eax
+  8005bf:	e8 6f fa ff ff       	call   800033 <check_regs>
+  8005c4:	83 c4 10             	add    $0x10,%esp
+  8005c7:	c9                   	leave
+  8005c8:	c3                   	ret
+  8005c9:	83 ec 0c             	sub    $0xc,%esp
+  8005cc:	68 94 38 80 00       	push   $0x803894
+  8005d1:	e8 59 01 00 00       	call   80072f <cprintf>
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	eb be                	jmp    800599 <umain+0xd7>
+
+008005db <libmain>:
+  8005db:	55                   	push   %ebp
+  8005dc:	89 e5                	mov    %esp,%ebp
+  8005de:	56                   	push   %esi
+  8005df:	53                   	push   %ebx
+  8005e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8005e6:	e8 31 0c 00 00       	call   80121c <sys_getenvid>
+  8005eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005f0:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8005f6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005fb:	a3 bc 50 80 00       	mov    %eax,0x8050bc
+  800600:	85 db                	test   %ebx,%ebx
+  800602:	7e 07                	jle    80060b <libmain+0x30>
+  800604:	8b 06                	mov    (%esi),%eax
+  800606:	a3 00 40 80 00       	mov    %eax,0x804000
+  80060b:	83 ec 08             	sub    $0x8,%esp
+  80060e:	56                   	push   %esi
+  80060f:	53                   	push   %ebx
+  800610:	e8 ad fe ff ff       	call   8004c2 <umain>
+  800615:	e8 0a 00 00 00       	call   800624 <exit>
+  80061a:	83 c4 10             	add    $0x10,%esp
+  80061d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800620:	5b                   	pop    %ebx
+  800621:	5e                   	pop    %esi
+  800622:	5d                   	pop    %ebp
+  800623:	c3                   	ret
+
+00800624 <exit>:
+  800624:	55                   	push   %ebp
+  800625:	89 e5                	mov    %esp,%ebp
+  800627:	83 ec 08             	sub    $0x8,%esp
+  80062a:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  80062f:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800635:	85 c0                	test   %eax,%eax
+  800637:	75 14                	jne    80064d <exit+0x29>
+  800639:	e8 23 17 00 00       	call   801d61 <close_all>
+  80063e:	83 ec 0c             	sub    $0xc,%esp
+  800641:	6a 00                	push   $0x0
+  800643:	e8 93 0b 00 00       	call   8011db <sys_env_destroy>
+  800648:	83 c4 10             	add    $0x10,%esp
+  80064b:	c9                   	leave
+  80064c:	c3                   	ret
+  80064d:	e8 f6 12 00 00       	call   801948 <sys_lease_complete>
+  800652:	eb e5                	jmp    800639 <exit+0x15>
+
+00800654 <_panic>:
+  800654:	55                   	push   %ebp
+  800655:	89 e5                	mov    %esp,%ebp
+  800657:	56                   	push   %esi
+  800658:	53                   	push   %ebx
+  800659:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80065c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800662:	e8 b5 0b 00 00       	call   80121c <sys_getenvid>
+  800667:	83 ec 0c             	sub    $0xc,%esp
+  80066a:	ff 75 0c             	push   0xc(%ebp)
+  80066d:	ff 75 08             	push   0x8(%ebp)
+  800670:	56                   	push   %esi
+  800671:	50                   	push   %eax
+  800672:	68 c0 38 80 00       	push   $0x8038c0
+  800677:	e8 b3 00 00 00       	call   80072f <cprintf>
+  80067c:	83 c4 18             	add    $0x18,%esp
+  80067f:	53                   	push   %ebx
+  800680:	ff 75 10             	push   0x10(%ebp)
+  800683:	e8 56 00 00 00       	call   8006de <vcprintf>
+  800688:	c7 04 24 d0 37 80 00 	movl   $0x8037d0,(%esp)
+  80068f:	e8 9b 00 00 00       	call   80072f <cprintf>
+  800694:	83 c4 10             	add    $0x10,%esp
+  800697:	cc                   	int3
+  800698:	eb fd                	jmp    800697 <_panic+0x43>
+
+0080069a <putch>:
+  80069a:	55                   	push   %ebp
+  80069b:	89 e5                	mov    %esp,%ebp
+  80069d:	53                   	push   %ebx
+  80069e:	83 ec 04             	sub    $0x4,%esp
+  8006a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006a4:	8b 13                	mov    (%ebx),%edx
+  8006a6:	8d 42 01             	lea    0x1(%edx),%eax
+  8006a9:	89 03                	mov    %eax,(%ebx)
+  8006ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006ae:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8006b2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006b7:	74 09                	je     8006c2 <putch+0x28>
+  8006b9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8006bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006c0:	c9                   	leave
+  8006c1:	c3                   	ret
+  8006c2:	83 ec 08             	sub    $0x8,%esp
+  8006c5:	68 ff 00 00 00       	push   $0xff
+  8006ca:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006cd:	50                   	push   %eax
+  8006ce:	e8 cb 0a 00 00       	call   80119e <sys_cputs>
+  8006d3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	eb db                	jmp    8006b9 <putch+0x1f>
+
+008006de <vcprintf>:
+  8006de:	55                   	push   %ebp
+  8006df:	89 e5                	mov    %esp,%ebp
+  8006e1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8006e7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006ee:	00 00 00 
+  8006f1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006f8:	00 00 00 
+  8006fb:	ff 75 0c             	push   0xc(%ebp)
+  8006fe:	ff 75 08             	push   0x8(%ebp)
+  800701:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800707:	50                   	push   %eax
+  800708:	68 9a 06 80 00       	push   $0x80069a
+  80070d:	e8 1c 01 00 00       	call   80082e <vprintfmt>
+  800712:	83 c4 08             	add    $0x8,%esp
+  800715:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80071b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800721:	50                   	push   %eax
+  800722:	e8 77 0a 00 00       	call   80119e <sys_cputs>
+  800727:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80072d:	c9                   	leave
+  80072e:	c3                   	ret
+
+0080072f <cprintf>:
+  80072f:	55                   	push   %ebp
+  800730:	89 e5                	mov    %esp,%ebp
+  800732:	83 ec 10             	sub    $0x10,%esp
+  800735:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800738:	50                   	push   %eax
+  800739:	ff 75 08             	push   0x8(%ebp)
+  80073c:	e8 9d ff ff ff       	call   8006de <vcprintf>
+  800741:	c9                   	leave
+  800742:	c3                   	ret
+
+00800743 <printnum>:
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	57                   	push   %edi
+  800747:	56                   	push   %esi
+  800748:	53                   	push   %ebx
+  800749:	83 ec 1c             	sub    $0x1c,%esp
+  80074c:	89 c3                	mov    %eax,%ebx
+  80074e:	89 d6                	mov    %edx,%esi
+  800750:	8b 45 08             	mov    0x8(%ebp),%eax
+  800753:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800756:	89 d1                	mov    %edx,%ecx
+  800758:	89 c2                	mov    %eax,%edx
+  80075a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800760:	8b 45 10             	mov    0x10(%ebp),%eax
+  800763:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800766:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80076d:	39 c2                	cmp    %eax,%edx
+  80076f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800772:	73 4b                	jae    8007bf <printnum+0x7c>
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80077a:	85 ff                	test   %edi,%edi
+  80077c:	7e 11                	jle    80078f <printnum+0x4c>
+  80077e:	83 ec 08             	sub    $0x8,%esp
+  800781:	56                   	push   %esi
+  800782:	ff 75 18             	push   0x18(%ebp)
+  800785:	ff d3                	call   *%ebx
+  800787:	83 c4 10             	add    $0x10,%esp
+  80078a:	83 ef 01             	sub    $0x1,%edi
+  80078d:	75 ef                	jne    80077e <printnum+0x3b>
+  80078f:	83 ec 08             	sub    $0x8,%esp
+  800792:	56                   	push   %esi
+  800793:	83 ec 04             	sub    $0x4,%esp
+  800796:	ff 75 e4             	push   -0x1c(%ebp)
+  800799:	ff 75 e0             	push   -0x20(%ebp)
+  80079c:	ff 75 dc             	push   -0x24(%ebp)
+  80079f:	ff 75 d8             	push   -0x28(%ebp)
+  8007a2:	e8 f3 2e 00 00       	call   80369a <__umoddi3>
+  8007a7:	83 c4 14             	add    $0x14,%esp
+  8007aa:	0f be 80 e3 38 80 00 	movsbl 0x8038e3(%eax),%eax
+  8007b1:	50                   	push   %eax
+  8007b2:	ff d3                	call   *%ebx
+  8007b4:	83 c4 10             	add    $0x10,%esp
+  8007b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ba:	5b                   	pop    %ebx
+  8007bb:	5e                   	pop    %esi
+  8007bc:	5f                   	pop    %edi
+  8007bd:	5d                   	pop    %ebp
+  8007be:	c3                   	ret
+  8007bf:	83 ec 0c             	sub    $0xc,%esp
+  8007c2:	ff 75 18             	push   0x18(%ebp)
+  8007c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007c8:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8007cb:	52                   	push   %edx
+  8007cc:	50                   	push   %eax
+  8007cd:	83 ec 08             	sub    $0x8,%esp
+  8007d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8007d3:	ff 75 e0             	push   -0x20(%ebp)
+  8007d6:	ff 75 dc             	push   -0x24(%ebp)
+  8007d9:	ff 75 d8             	push   -0x28(%ebp)
+  8007dc:	e8 9b 2e 00 00       	call   80367c <__udivdi3>
+  8007e1:	83 c4 18             	add    $0x18,%esp
+  8007e4:	52                   	push   %edx
+  8007e5:	50                   	push   %eax
+  8007e6:	89 f2                	mov    %esi,%edx
+  8007e8:	89 d8                	mov    %ebx,%eax
+  8007ea:	e8 54 ff ff ff       	call   800743 <printnum>
+  8007ef:	83 c4 20             	add    $0x20,%esp
+  8007f2:	eb 9b                	jmp    80078f <printnum+0x4c>
+
+008007f4 <sprintputch>:
+  8007f4:	55                   	push   %ebp
+  8007f5:	89 e5                	mov    %esp,%ebp
+  8007f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8007fa:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8007fe:	8b 10                	mov    (%eax),%edx
+  800800:	3b 50 04             	cmp    0x4(%eax),%edx
+  800803:	73 0a                	jae    80080f <sprintputch+0x1b>
+  800805:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800808:	89 08                	mov    %ecx,(%eax)
+  80080a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080d:	88 02                	mov    %al,(%edx)
+  80080f:	5d                   	pop    %ebp
+  800810:	c3                   	ret
+
+00800811 <printfmt>:
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	83 ec 08             	sub    $0x8,%esp
+  800817:	8d 45 14             	lea    0x14(%ebp),%eax
+  80081a:	50                   	push   %eax
+  80081b:	ff 75 10             	push   0x10(%ebp)
+  80081e:	ff 75 0c             	push   0xc(%ebp)
+  800821:	ff 75 08             	push   0x8(%ebp)
+  800824:	e8 05 00 00 00       	call   80082e <vprintfmt>
+  800829:	83 c4 10             	add    $0x10,%esp
+  80082c:	c9                   	leave
+  80082d:	c3                   	ret
+
+0080082e <vprintfmt>:
+  80082e:	55                   	push   %ebp
+  80082f:	89 e5                	mov    %esp,%ebp
+  800831:	57                   	push   %edi
+  800832:	56                   	push   %esi
+  800833:	53                   	push   %ebx
+  800834:	83 ec 2c             	sub    $0x2c,%esp
+  800837:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80083a:	89 df                	mov    %ebx,%edi
+  80083c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80083f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800842:	8d 70 01             	lea    0x1(%eax),%esi
+  800845:	0f b6 00             	movzbl (%eax),%eax
+  800848:	83 f8 25             	cmp    $0x25,%eax
+  80084b:	74 1e                	je     80086b <vprintfmt+0x3d>
+  80084d:	85 c0                	test   %eax,%eax
+  80084f:	0f 84 15 05 00 00    	je     800d6a <vprintfmt+0x53c>
+  800855:	83 ec 08             	sub    $0x8,%esp
+  800858:	53                   	push   %ebx
+  800859:	50                   	push   %eax
+  80085a:	ff d7                	call   *%edi
+  80085c:	83 c6 01             	add    $0x1,%esi
+  80085f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800863:	83 c4 10             	add    $0x10,%esp
+  800866:	83 f8 25             	cmp    $0x25,%eax
+  800869:	75 e2                	jne    80084d <vprintfmt+0x1f>
+  80086b:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80086f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800876:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80087d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800884:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800889:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80088c:	8d 56 01             	lea    0x1(%esi),%edx
+  80088f:	0f b6 0e             	movzbl (%esi),%ecx
+  800892:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800895:	3c 55                	cmp    $0x55,%al
+  800897:	0f 87 3b 04 00 00    	ja     800cd8 <vprintfmt+0x4aa>
+  80089d:	0f b6 c0             	movzbl %al,%eax
+  8008a0:	ff 24 85 20 3a 80 00 	jmp    *0x803a20(,%eax,4)
+  8008a7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008aa:	eb 93                	jmp    80083f <vprintfmt+0x11>
+  8008ac:	89 d6                	mov    %edx,%esi
+  8008ae:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8008b2:	eb d8                	jmp    80088c <vprintfmt+0x5e>
+  8008b4:	89 d6                	mov    %edx,%esi
+  8008b6:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8008ba:	eb d0                	jmp    80088c <vprintfmt+0x5e>
+  8008bc:	0f b6 c9             	movzbl %cl,%ecx
+  8008bf:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8008c2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8008c5:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8008c9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8008cc:	83 f9 09             	cmp    $0x9,%ecx
+  8008cf:	77 6f                	ja     800940 <vprintfmt+0x112>
+  8008d1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8008d4:	83 c2 01             	add    $0x1,%edx
+  8008d7:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8008da:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8008de:	0f be 02             	movsbl (%edx),%eax
+  8008e1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8008e4:	83 fe 09             	cmp    $0x9,%esi
+  8008e7:	76 eb                	jbe    8008d4 <vprintfmt+0xa6>
+  8008e9:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8008ec:	89 d6                	mov    %edx,%esi
+  8008ee:	eb 13                	jmp    800903 <vprintfmt+0xd5>
+  8008f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f3:	8b 00                	mov    (%eax),%eax
+  8008f5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8008f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800901:	89 d6                	mov    %edx,%esi
+  800903:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800907:	79 83                	jns    80088c <vprintfmt+0x5e>
+  800909:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80090c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80090f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800916:	e9 71 ff ff ff       	jmp    80088c <vprintfmt+0x5e>
+  80091b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80091e:	85 c9                	test   %ecx,%ecx
+  800920:	b8 00 00 00 00       	mov    $0x0,%eax
+  800925:	0f 49 c1             	cmovns %ecx,%eax
+  800928:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80092b:	89 d6                	mov    %edx,%esi
+  80092d:	e9 5a ff ff ff       	jmp    80088c <vprintfmt+0x5e>
+  800932:	89 d6                	mov    %edx,%esi
+  800934:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80093b:	e9 4c ff ff ff       	jmp    80088c <vprintfmt+0x5e>
+  800940:	89 d6                	mov    %edx,%esi
+  800942:	eb bf                	jmp    800903 <vprintfmt+0xd5>
+  800944:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800948:	89 d6                	mov    %edx,%esi
+  80094a:	e9 3d ff ff ff       	jmp    80088c <vprintfmt+0x5e>
+  80094f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800952:	8b 45 14             	mov    0x14(%ebp),%eax
+  800955:	8d 70 04             	lea    0x4(%eax),%esi
+  800958:	83 ec 08             	sub    $0x8,%esp
+  80095b:	53                   	push   %ebx
+  80095c:	ff 30                	push   (%eax)
+  80095e:	ff d7                	call   *%edi
+  800960:	83 c4 10             	add    $0x10,%esp
+  800963:	89 75 14             	mov    %esi,0x14(%ebp)
+  800966:	e9 d4 fe ff ff       	jmp    80083f <vprintfmt+0x11>
+  80096b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80096e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800971:	8d 70 04             	lea    0x4(%eax),%esi
+  800974:	8b 10                	mov    (%eax),%edx
+  800976:	89 d0                	mov    %edx,%eax
+  800978:	f7 d8                	neg    %eax
+  80097a:	0f 48 c2             	cmovs  %edx,%eax
+  80097d:	83 f8 12             	cmp    $0x12,%eax
+  800980:	7f 23                	jg     8009a5 <vprintfmt+0x177>
+  800982:	8b 14 85 80 3b 80 00 	mov    0x803b80(,%eax,4),%edx
+  800989:	85 d2                	test   %edx,%edx
+  80098b:	74 18                	je     8009a5 <vprintfmt+0x177>
+  80098d:	52                   	push   %edx
+  80098e:	68 53 3d 80 00       	push   $0x803d53
+  800993:	53                   	push   %ebx
+  800994:	57                   	push   %edi
+  800995:	e8 77 fe ff ff       	call   800811 <printfmt>
+  80099a:	83 c4 10             	add    $0x10,%esp
+  80099d:	89 75 14             	mov    %esi,0x14(%ebp)
+  8009a0:	e9 9a fe ff ff       	jmp    80083f <vprintfmt+0x11>
+  8009a5:	50                   	push   %eax
+  8009a6:	68 fb 38 80 00       	push   $0x8038fb
+  8009ab:	53                   	push   %ebx
+  8009ac:	57                   	push   %edi
+  8009ad:	e8 5f fe ff ff       	call   800811 <printfmt>
+  8009b2:	83 c4 10             	add    $0x10,%esp
+  8009b5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8009b8:	e9 82 fe ff ff       	jmp    80083f <vprintfmt+0x11>
+  8009bd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c3:	83 c0 04             	add    $0x4,%eax
+  8009c6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8009c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cc:	8b 00                	mov    (%eax),%eax
+  8009ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009d1:	85 c0                	test   %eax,%eax
+  8009d3:	0f 84 61 03 00 00    	je     800d3a <vprintfmt+0x50c>
+  8009d9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009dd:	7e 06                	jle    8009e5 <vprintfmt+0x1b7>
+  8009df:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009e3:	75 29                	jne    800a0e <vprintfmt+0x1e0>
+  8009e5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009e8:	8d 70 01             	lea    0x1(%eax),%esi
+  8009eb:	0f b6 00             	movzbl (%eax),%eax
+  8009ee:	0f be d0             	movsbl %al,%edx
+  8009f1:	85 d2                	test   %edx,%edx
+  8009f3:	0f 84 bb 00 00 00    	je     800ab4 <vprintfmt+0x286>
+  8009f9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009fc:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009ff:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a02:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a05:	eb 7a                	jmp    800a81 <vprintfmt+0x253>
+  800a07:	c7 45 d0 f4 38 80 00 	movl   $0x8038f4,-0x30(%ebp)
+  800a0e:	83 ec 08             	sub    $0x8,%esp
+  800a11:	ff 75 d4             	push   -0x2c(%ebp)
+  800a14:	ff 75 d0             	push   -0x30(%ebp)
+  800a17:	e8 e0 03 00 00       	call   800dfc <strnlen>
+  800a1c:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800a1f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800a22:	83 c4 10             	add    $0x10,%esp
+  800a25:	85 d2                	test   %edx,%edx
+  800a27:	0f 8e d6 02 00 00    	jle    800d03 <vprintfmt+0x4d5>
+  800a2d:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800a31:	83 ec 08             	sub    $0x8,%esp
+  800a34:	53                   	push   %ebx
+  800a35:	56                   	push   %esi
+  800a36:	ff d7                	call   *%edi
+  800a38:	83 c4 10             	add    $0x10,%esp
+  800a3b:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800a3f:	75 f0                	jne    800a31 <vprintfmt+0x203>
+  800a41:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a44:	8d 70 01             	lea    0x1(%eax),%esi
+  800a47:	0f b6 00             	movzbl (%eax),%eax
+  800a4a:	0f be d0             	movsbl %al,%edx
+  800a4d:	85 d2                	test   %edx,%edx
+  800a4f:	0f 84 da 02 00 00    	je     800d2f <vprintfmt+0x501>
+  800a55:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a58:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a5b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a5e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a61:	eb 1e                	jmp    800a81 <vprintfmt+0x253>
+  800a63:	83 ec 08             	sub    $0x8,%esp
+  800a66:	ff 75 0c             	push   0xc(%ebp)
+  800a69:	52                   	push   %edx
+  800a6a:	ff 55 08             	call   *0x8(%ebp)
+  800a6d:	83 c4 10             	add    $0x10,%esp
+  800a70:	83 eb 01             	sub    $0x1,%ebx
+  800a73:	83 c6 01             	add    $0x1,%esi
+  800a76:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a7a:	0f be d0             	movsbl %al,%edx
+  800a7d:	85 d2                	test   %edx,%edx
+  800a7f:	74 2a                	je     800aab <vprintfmt+0x27d>
+  800a81:	85 ff                	test   %edi,%edi
+  800a83:	78 05                	js     800a8a <vprintfmt+0x25c>
+  800a85:	83 ef 01             	sub    $0x1,%edi
+  800a88:	78 59                	js     800ae3 <vprintfmt+0x2b5>
+  800a8a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a8e:	74 d3                	je     800a63 <vprintfmt+0x235>
+  800a90:	0f be c0             	movsbl %al,%eax
+  800a93:	83 e8 20             	sub    $0x20,%eax
+  800a96:	83 f8 5e             	cmp    $0x5e,%eax
+  800a99:	76 c8                	jbe    800a63 <vprintfmt+0x235>
+  800a9b:	83 ec 08             	sub    $0x8,%esp
+  800a9e:	ff 75 0c             	push   0xc(%ebp)
+  800aa1:	6a 3f                	push   $0x3f
+  800aa3:	ff 55 08             	call   *0x8(%ebp)
+  800aa6:	83 c4 10             	add    $0x10,%esp
+  800aa9:	eb c5                	jmp    800a70 <vprintfmt+0x242>
+  800aab:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800aae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ab4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800ab7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800abb:	7e 1b                	jle    800ad8 <vprintfmt+0x2aa>
+  800abd:	83 ec 08             	sub    $0x8,%esp
+  800ac0:	53                   	push   %ebx
+  800ac1:	6a 20                	push   $0x20
+  800ac3:	ff d7                	call   *%edi
+  800ac5:	83 c4 10             	add    $0x10,%esp
+  800ac8:	83 ee 01             	sub    $0x1,%esi
+  800acb:	75 f0                	jne    800abd <vprintfmt+0x28f>
+  800acd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ad0:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad3:	e9 67 fd ff ff       	jmp    80083f <vprintfmt+0x11>
+  800ad8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800adb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ade:	e9 5c fd ff ff       	jmp    80083f <vprintfmt+0x11>
+  800ae3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ae6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ae9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800aec:	eb c6                	jmp    800ab4 <vprintfmt+0x286>
+  800aee:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800af1:	89 55 10             	mov    %edx,0x10(%ebp)
+  800af4:	83 f9 01             	cmp    $0x1,%ecx
+  800af7:	7f 1f                	jg     800b18 <vprintfmt+0x2ea>
+  800af9:	85 c9                	test   %ecx,%ecx
+  800afb:	74 67                	je     800b64 <vprintfmt+0x336>
+  800afd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b00:	8b 30                	mov    (%eax),%esi
+  800b02:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b05:	89 f0                	mov    %esi,%eax
+  800b07:	c1 f8 1f             	sar    $0x1f,%eax
+  800b0a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b10:	8d 40 04             	lea    0x4(%eax),%eax
+  800b13:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b16:	eb 17                	jmp    800b2f <vprintfmt+0x301>
+  800b18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1b:	8b 50 04             	mov    0x4(%eax),%edx
+  800b1e:	8b 00                	mov    (%eax),%eax
+  800b20:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b23:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b29:	8d 40 08             	lea    0x8(%eax),%eax
+  800b2c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b2f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b32:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b35:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b3a:	85 c9                	test   %ecx,%ecx
+  800b3c:	0f 89 12 01 00 00    	jns    800c54 <vprintfmt+0x426>
+  800b42:	83 ec 08             	sub    $0x8,%esp
+  800b45:	53                   	push   %ebx
+  800b46:	6a 2d                	push   $0x2d
+  800b48:	ff d7                	call   *%edi
+  800b4a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b4d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b50:	f7 da                	neg    %edx
+  800b52:	83 d1 00             	adc    $0x0,%ecx
+  800b55:	f7 d9                	neg    %ecx
+  800b57:	83 c4 10             	add    $0x10,%esp
+  800b5a:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b5f:	e9 f0 00 00 00       	jmp    800c54 <vprintfmt+0x426>
+  800b64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b67:	8b 30                	mov    (%eax),%esi
+  800b69:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b6c:	89 f0                	mov    %esi,%eax
+  800b6e:	c1 f8 1f             	sar    $0x1f,%eax
+  800b71:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b74:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b77:	8d 40 04             	lea    0x4(%eax),%eax
+  800b7a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b7d:	eb b0                	jmp    800b2f <vprintfmt+0x301>
+  800b7f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b82:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b85:	83 f9 01             	cmp    $0x1,%ecx
+  800b88:	7f 1e                	jg     800ba8 <vprintfmt+0x37a>
+  800b8a:	85 c9                	test   %ecx,%ecx
+  800b8c:	74 32                	je     800bc0 <vprintfmt+0x392>
+  800b8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b91:	8b 10                	mov    (%eax),%edx
+  800b93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b98:	8d 40 04             	lea    0x4(%eax),%eax
+  800b9b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b9e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ba3:	e9 ac 00 00 00       	jmp    800c54 <vprintfmt+0x426>
+  800ba8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bab:	8b 10                	mov    (%eax),%edx
+  800bad:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bb0:	8d 40 08             	lea    0x8(%eax),%eax
+  800bb3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bb6:	be 0a 00 00 00       	mov    $0xa,%esi
+  800bbb:	e9 94 00 00 00       	jmp    800c54 <vprintfmt+0x426>
+  800bc0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc3:	8b 10                	mov    (%eax),%edx
+  800bc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bca:	8d 40 04             	lea    0x4(%eax),%eax
+  800bcd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bd0:	be 0a 00 00 00       	mov    $0xa,%esi
+  800bd5:	eb 7d                	jmp    800c54 <vprintfmt+0x426>
+  800bd7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800bda:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bdd:	83 f9 01             	cmp    $0x1,%ecx
+  800be0:	7f 1b                	jg     800bfd <vprintfmt+0x3cf>
+  800be2:	85 c9                	test   %ecx,%ecx
+  800be4:	74 2c                	je     800c12 <vprintfmt+0x3e4>
+  800be6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be9:	8b 10                	mov    (%eax),%edx
+  800beb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf0:	8d 40 04             	lea    0x4(%eax),%eax
+  800bf3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bf6:	be 08 00 00 00       	mov    $0x8,%esi
+  800bfb:	eb 57                	jmp    800c54 <vprintfmt+0x426>
+  800bfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c00:	8b 10                	mov    (%eax),%edx
+  800c02:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c05:	8d 40 08             	lea    0x8(%eax),%eax
+  800c08:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c0b:	be 08 00 00 00       	mov    $0x8,%esi
+  800c10:	eb 42                	jmp    800c54 <vprintfmt+0x426>
+  800c12:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c15:	8b 10                	mov    (%eax),%edx
+  800c17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c1c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c1f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c22:	be 08 00 00 00       	mov    $0x8,%esi
+  800c27:	eb 2b                	jmp    800c54 <vprintfmt+0x426>
+  800c29:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c2c:	83 ec 08             	sub    $0x8,%esp
+  800c2f:	53                   	push   %ebx
+  800c30:	6a 30                	push   $0x30
+  800c32:	ff d7                	call   *%edi
+  800c34:	83 c4 08             	add    $0x8,%esp
+  800c37:	53                   	push   %ebx
+  800c38:	6a 78                	push   $0x78
+  800c3a:	ff d7                	call   *%edi
+  800c3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3f:	8b 10                	mov    (%eax),%edx
+  800c41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c46:	83 c4 10             	add    $0x10,%esp
+  800c49:	8d 40 04             	lea    0x4(%eax),%eax
+  800c4c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c4f:	be 10 00 00 00       	mov    $0x10,%esi
+  800c54:	83 ec 0c             	sub    $0xc,%esp
+  800c57:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800c5b:	50                   	push   %eax
+  800c5c:	ff 75 e4             	push   -0x1c(%ebp)
+  800c5f:	56                   	push   %esi
+  800c60:	51                   	push   %ecx
+  800c61:	52                   	push   %edx
+  800c62:	89 da                	mov    %ebx,%edx
+  800c64:	89 f8                	mov    %edi,%eax
+  800c66:	e8 d8 fa ff ff       	call   800743 <printnum>
+  800c6b:	83 c4 20             	add    $0x20,%esp
+  800c6e:	e9 cc fb ff ff       	jmp    80083f <vprintfmt+0x11>
+  800c73:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c76:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c79:	83 f9 01             	cmp    $0x1,%ecx
+  800c7c:	7f 1b                	jg     800c99 <vprintfmt+0x46b>
+  800c7e:	85 c9                	test   %ecx,%ecx
+  800c80:	74 2c                	je     800cae <vprintfmt+0x480>
+  800c82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c85:	8b 10                	mov    (%eax),%edx
+  800c87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c8f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c92:	be 10 00 00 00       	mov    $0x10,%esi
+  800c97:	eb bb                	jmp    800c54 <vprintfmt+0x426>
+  800c99:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c9c:	8b 10                	mov    (%eax),%edx
+  800c9e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ca1:	8d 40 08             	lea    0x8(%eax),%eax
+  800ca4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ca7:	be 10 00 00 00       	mov    $0x10,%esi
+  800cac:	eb a6                	jmp    800c54 <vprintfmt+0x426>
+  800cae:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cb1:	8b 10                	mov    (%eax),%edx
+  800cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb8:	8d 40 04             	lea    0x4(%eax),%eax
+  800cbb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cbe:	be 10 00 00 00       	mov    $0x10,%esi
+  800cc3:	eb 8f                	jmp    800c54 <vprintfmt+0x426>
+  800cc5:	89 55 10             	mov    %edx,0x10(%ebp)
+  800cc8:	83 ec 08             	sub    $0x8,%esp
+  800ccb:	53                   	push   %ebx
+  800ccc:	6a 25                	push   $0x25
+  800cce:	ff d7                	call   *%edi
+  800cd0:	83 c4 10             	add    $0x10,%esp
+  800cd3:	e9 67 fb ff ff       	jmp    80083f <vprintfmt+0x11>
+  800cd8:	83 ec 08             	sub    $0x8,%esp
+  800cdb:	53                   	push   %ebx
+  800cdc:	6a 25                	push   $0x25
+  800cde:	ff d7                	call   *%edi
+  800ce0:	83 c4 10             	add    $0x10,%esp
+  800ce3:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800ce7:	0f 84 ba fb ff ff    	je     8008a7 <vprintfmt+0x79>
+  800ced:	89 75 10             	mov    %esi,0x10(%ebp)
+  800cf0:	89 f0                	mov    %esi,%eax
+  800cf2:	83 e8 01             	sub    $0x1,%eax
+  800cf5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800cf9:	75 f7                	jne    800cf2 <vprintfmt+0x4c4>
+  800cfb:	89 45 10             	mov    %eax,0x10(%ebp)
+  800cfe:	e9 3c fb ff ff       	jmp    80083f <vprintfmt+0x11>
+  800d03:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d06:	8d 70 01             	lea    0x1(%eax),%esi
+  800d09:	0f b6 00             	movzbl (%eax),%eax
+  800d0c:	0f be d0             	movsbl %al,%edx
+  800d0f:	85 d2                	test   %edx,%edx
+  800d11:	74 11                	je     800d24 <vprintfmt+0x4f6>
+  800d13:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d16:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d19:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d1c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d1f:	e9 5d fd ff ff       	jmp    800a81 <vprintfmt+0x253>
+  800d24:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d27:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d2a:	e9 10 fb ff ff       	jmp    80083f <vprintfmt+0x11>
+  800d2f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d32:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d35:	e9 05 fb ff ff       	jmp    80083f <vprintfmt+0x11>
+  800d3a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800d3e:	7e 0a                	jle    800d4a <vprintfmt+0x51c>
+  800d40:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800d44:	0f 85 bd fc ff ff    	jne    800a07 <vprintfmt+0x1d9>
+  800d4a:	ba 28 00 00 00       	mov    $0x28,%edx
+  800d4f:	b8 28 00 00 00       	mov    $0x28,%eax
+  800d54:	be f5 38 80 00       	mov    $0x8038f5,%esi
+  800d59:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d5c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d5f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d62:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d65:	e9 17 fd ff ff       	jmp    800a81 <vprintfmt+0x253>
+  800d6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5f                   	pop    %edi
+  800d70:	5d                   	pop    %ebp
+  800d71:	c3                   	ret
+
+00800d72 <vsnprintf>:
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	83 ec 18             	sub    $0x18,%esp
+  800d78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d7e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d81:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d85:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d88:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800d8f:	85 c0                	test   %eax,%eax
+  800d91:	74 26                	je     800db9 <vsnprintf+0x47>
+  800d93:	85 d2                	test   %edx,%edx
+  800d95:	7e 22                	jle    800db9 <vsnprintf+0x47>
+  800d97:	ff 75 14             	push   0x14(%ebp)
+  800d9a:	ff 75 10             	push   0x10(%ebp)
+  800d9d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800da0:	50                   	push   %eax
+  800da1:	68 f4 07 80 00       	push   $0x8007f4
+  800da6:	e8 83 fa ff ff       	call   80082e <vprintfmt>
+  800dab:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800dae:	c6 00 00             	movb   $0x0,(%eax)
+  800db1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800db4:	83 c4 10             	add    $0x10,%esp
+  800db7:	c9                   	leave
+  800db8:	c3                   	ret
+  800db9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dbe:	eb f7                	jmp    800db7 <vsnprintf+0x45>
+
+00800dc0 <snprintf>:
+  800dc0:	55                   	push   %ebp
+  800dc1:	89 e5                	mov    %esp,%ebp
+  800dc3:	83 ec 08             	sub    $0x8,%esp
+  800dc6:	8d 45 14             	lea    0x14(%ebp),%eax
+  800dc9:	50                   	push   %eax
+  800dca:	ff 75 10             	push   0x10(%ebp)
+  800dcd:	ff 75 0c             	push   0xc(%ebp)
+  800dd0:	ff 75 08             	push   0x8(%ebp)
+  800dd3:	e8 9a ff ff ff       	call   800d72 <vsnprintf>
+  800dd8:	c9                   	leave
+  800dd9:	c3                   	ret
+
+00800dda <strlen>:
+  800dda:	55                   	push   %ebp
+  800ddb:	89 e5                	mov    %esp,%ebp
+  800ddd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de0:	80 3a 00             	cmpb   $0x0,(%edx)
+  800de3:	74 10                	je     800df5 <strlen+0x1b>
+  800de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dea:	83 c0 01             	add    $0x1,%eax
+  800ded:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800df1:	75 f7                	jne    800dea <strlen+0x10>
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfa:	eb f7                	jmp    800df3 <strlen+0x19>
+
+00800dfc <strnlen>:
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e05:	85 d2                	test   %edx,%edx
+  800e07:	74 16                	je     800e1f <strnlen+0x23>
+  800e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800e12:	74 09                	je     800e1d <strnlen+0x21>
+  800e14:	83 c0 01             	add    $0x1,%eax
+  800e17:	39 d0                	cmp    %edx,%eax
+  800e19:	75 f3                	jne    800e0e <strnlen+0x12>
+  800e1b:	89 d0                	mov    %edx,%eax
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+  800e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e24:	eb f7                	jmp    800e1d <strnlen+0x21>
+
+00800e26 <strcpy>:
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	53                   	push   %ebx
+  800e2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e2d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e35:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e39:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e3c:	83 c0 01             	add    $0x1,%eax
+  800e3f:	84 d2                	test   %dl,%dl
+  800e41:	75 f2                	jne    800e35 <strcpy+0xf>
+  800e43:	89 c8                	mov    %ecx,%eax
+  800e45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e48:	c9                   	leave
+  800e49:	c3                   	ret
+
+00800e4a <strcat>:
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	53                   	push   %ebx
+  800e4e:	83 ec 10             	sub    $0x10,%esp
+  800e51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e54:	53                   	push   %ebx
+  800e55:	e8 80 ff ff ff       	call   800dda <strlen>
+  800e5a:	83 c4 08             	add    $0x8,%esp
+  800e5d:	ff 75 0c             	push   0xc(%ebp)
+  800e60:	01 d8                	add    %ebx,%eax
+  800e62:	50                   	push   %eax
+  800e63:	e8 be ff ff ff       	call   800e26 <strcpy>
+  800e68:	89 d8                	mov    %ebx,%eax
+  800e6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e6d:	c9                   	leave
+  800e6e:	c3                   	ret
+
+00800e6f <strncpy>:
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	56                   	push   %esi
+  800e73:	53                   	push   %ebx
+  800e74:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7d:	85 db                	test   %ebx,%ebx
+  800e7f:	74 17                	je     800e98 <strncpy+0x29>
+  800e81:	01 f3                	add    %esi,%ebx
+  800e83:	89 f0                	mov    %esi,%eax
+  800e85:	83 c0 01             	add    $0x1,%eax
+  800e88:	0f b6 0a             	movzbl (%edx),%ecx
+  800e8b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800e8e:	80 f9 01             	cmp    $0x1,%cl
+  800e91:	83 da ff             	sbb    $0xffffffff,%edx
+  800e94:	39 c3                	cmp    %eax,%ebx
+  800e96:	75 ed                	jne    800e85 <strncpy+0x16>
+  800e98:	89 f0                	mov    %esi,%eax
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+
+00800e9e <strlcpy>:
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	56                   	push   %esi
+  800ea2:	53                   	push   %ebx
+  800ea3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ea9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eac:	89 f0                	mov    %esi,%eax
+  800eae:	85 db                	test   %ebx,%ebx
+  800eb0:	74 1e                	je     800ed0 <strlcpy+0x32>
+  800eb2:	83 eb 01             	sub    $0x1,%ebx
+  800eb5:	74 16                	je     800ecd <strlcpy+0x2f>
+  800eb7:	01 f3                	add    %esi,%ebx
+  800eb9:	0f b6 0a             	movzbl (%edx),%ecx
+  800ebc:	84 c9                	test   %cl,%cl
+  800ebe:	74 0d                	je     800ecd <strlcpy+0x2f>
+  800ec0:	83 c2 01             	add    $0x1,%edx
+  800ec3:	83 c0 01             	add    $0x1,%eax
+  800ec6:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800ec9:	39 d8                	cmp    %ebx,%eax
+  800ecb:	75 ec                	jne    800eb9 <strlcpy+0x1b>
+  800ecd:	c6 00 00             	movb   $0x0,(%eax)
+  800ed0:	29 f0                	sub    %esi,%eax
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+
+00800ed6 <strcmp>:
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800edc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800edf:	0f b6 01             	movzbl (%ecx),%eax
+  800ee2:	84 c0                	test   %al,%al
+  800ee4:	74 11                	je     800ef7 <strcmp+0x21>
+  800ee6:	38 02                	cmp    %al,(%edx)
+  800ee8:	75 0d                	jne    800ef7 <strcmp+0x21>
+  800eea:	83 c1 01             	add    $0x1,%ecx
+  800eed:	83 c2 01             	add    $0x1,%edx
+  800ef0:	0f b6 01             	movzbl (%ecx),%eax
+  800ef3:	84 c0                	test   %al,%al
+  800ef5:	75 ef                	jne    800ee6 <strcmp+0x10>
+  800ef7:	0f b6 c0             	movzbl %al,%eax
+  800efa:	0f b6 12             	movzbl (%edx),%edx
+  800efd:	29 d0                	sub    %edx,%eax
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+
+00800f01 <strncmp>:
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	53                   	push   %ebx
+  800f05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f0b:	8b 55 10             	mov    0x10(%ebp),%edx
+  800f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f13:	85 d2                	test   %edx,%edx
+  800f15:	74 2e                	je     800f45 <strncmp+0x44>
+  800f17:	0f b6 01             	movzbl (%ecx),%eax
+  800f1a:	84 c0                	test   %al,%al
+  800f1c:	74 16                	je     800f34 <strncmp+0x33>
+  800f1e:	3a 03                	cmp    (%ebx),%al
+  800f20:	75 12                	jne    800f34 <strncmp+0x33>
+  800f22:	83 c1 01             	add    $0x1,%ecx
+  800f25:	83 c3 01             	add    $0x1,%ebx
+  800f28:	83 ea 01             	sub    $0x1,%edx
+  800f2b:	75 ea                	jne    800f17 <strncmp+0x16>
+  800f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f32:	eb 11                	jmp    800f45 <strncmp+0x44>
+  800f34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f39:	85 d2                	test   %edx,%edx
+  800f3b:	74 08                	je     800f45 <strncmp+0x44>
+  800f3d:	0f b6 01             	movzbl (%ecx),%eax
+  800f40:	0f b6 13             	movzbl (%ebx),%edx
+  800f43:	29 d0                	sub    %edx,%eax
+  800f45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f48:	c9                   	leave
+  800f49:	c3                   	ret
+
+00800f4a <strchr>:
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f50:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800f54:	0f b6 10             	movzbl (%eax),%edx
+  800f57:	84 d2                	test   %dl,%dl
+  800f59:	74 15                	je     800f70 <strchr+0x26>
+  800f5b:	38 d1                	cmp    %dl,%cl
+  800f5d:	74 0f                	je     800f6e <strchr+0x24>
+  800f5f:	83 c0 01             	add    $0x1,%eax
+  800f62:	0f b6 10             	movzbl (%eax),%edx
+  800f65:	84 d2                	test   %dl,%dl
+  800f67:	75 f2                	jne    800f5b <strchr+0x11>
+  800f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6e:	5d                   	pop    %ebp
+  800f6f:	c3                   	ret
+  800f70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f75:	eb f7                	jmp    800f6e <strchr+0x24>
+
+00800f77 <strfind>:
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	53                   	push   %ebx
+  800f7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f81:	0f b6 18             	movzbl (%eax),%ebx
+  800f84:	38 d3                	cmp    %dl,%bl
+  800f86:	74 14                	je     800f9c <strfind+0x25>
+  800f88:	89 d1                	mov    %edx,%ecx
+  800f8a:	84 db                	test   %bl,%bl
+  800f8c:	74 0e                	je     800f9c <strfind+0x25>
+  800f8e:	83 c0 01             	add    $0x1,%eax
+  800f91:	0f b6 10             	movzbl (%eax),%edx
+  800f94:	38 ca                	cmp    %cl,%dl
+  800f96:	74 04                	je     800f9c <strfind+0x25>
+  800f98:	84 d2                	test   %dl,%dl
+  800f9a:	75 f2                	jne    800f8e <strfind+0x17>
+  800f9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f9f:	c9                   	leave
+  800fa0:	c3                   	ret
+
+00800fa1 <memset>:
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	57                   	push   %edi
+  800fa5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fa8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800fab:	85 c9                	test   %ecx,%ecx
+  800fad:	74 20                	je     800fcf <memset+0x2e>
+  800faf:	89 f8                	mov    %edi,%eax
+  800fb1:	09 c8                	or     %ecx,%eax
+  800fb3:	a8 03                	test   $0x3,%al
+  800fb5:	75 12                	jne    800fc9 <memset+0x28>
+  800fb7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800fbb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800fc1:	c1 e9 02             	shr    $0x2,%ecx
+  800fc4:	fc                   	cld
+  800fc5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800fc7:	eb 06                	jmp    800fcf <memset+0x2e>
+  800fc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fcc:	fc                   	cld
+  800fcd:	f3 aa                	rep stos %al,%es:(%edi)
+  800fcf:	89 f8                	mov    %edi,%eax
+  800fd1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800fd4:	c9                   	leave
+  800fd5:	c3                   	ret
+
+00800fd6 <memmove>:
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fde:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800fe1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800fe4:	39 c6                	cmp    %eax,%esi
+  800fe6:	73 32                	jae    80101a <memmove+0x44>
+  800fe8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800feb:	39 d0                	cmp    %edx,%eax
+  800fed:	73 2b                	jae    80101a <memmove+0x44>
+  800fef:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800ff2:	89 d6                	mov    %edx,%esi
+  800ff4:	09 fe                	or     %edi,%esi
+  800ff6:	09 ce                	or     %ecx,%esi
+  800ff8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ffe:	75 0e                	jne    80100e <memmove+0x38>
+  801000:	83 ef 04             	sub    $0x4,%edi
+  801003:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801006:	c1 e9 02             	shr    $0x2,%ecx
+  801009:	fd                   	std
+  80100a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80100c:	eb 09                	jmp    801017 <memmove+0x41>
+  80100e:	83 ef 01             	sub    $0x1,%edi
+  801011:	8d 72 ff             	lea    -0x1(%edx),%esi
+  801014:	fd                   	std
+  801015:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801017:	fc                   	cld
+  801018:	eb 1a                	jmp    801034 <memmove+0x5e>
+  80101a:	89 f2                	mov    %esi,%edx
+  80101c:	09 c2                	or     %eax,%edx
+  80101e:	09 ca                	or     %ecx,%edx
+  801020:	f6 c2 03             	test   $0x3,%dl
+  801023:	75 0a                	jne    80102f <memmove+0x59>
+  801025:	c1 e9 02             	shr    $0x2,%ecx
+  801028:	89 c7                	mov    %eax,%edi
+  80102a:	fc                   	cld
+  80102b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80102d:	eb 05                	jmp    801034 <memmove+0x5e>
+  80102f:	89 c7                	mov    %eax,%edi
+  801031:	fc                   	cld
+  801032:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+
+00801038 <memcpy>:
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+  80103e:	ff 75 10             	push   0x10(%ebp)
+  801041:	ff 75 0c             	push   0xc(%ebp)
+  801044:	ff 75 08             	push   0x8(%ebp)
+  801047:	e8 8a ff ff ff       	call   800fd6 <memmove>
+  80104c:	c9                   	leave
+  80104d:	c3                   	ret
+
+0080104e <memcmp>:
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	56                   	push   %esi
+  801052:	53                   	push   %ebx
+  801053:	8b 45 08             	mov    0x8(%ebp),%eax
+  801056:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801059:	8b 75 10             	mov    0x10(%ebp),%esi
+  80105c:	85 f6                	test   %esi,%esi
+  80105e:	74 29                	je     801089 <memcmp+0x3b>
+  801060:	01 c6                	add    %eax,%esi
+  801062:	0f b6 08             	movzbl (%eax),%ecx
+  801065:	0f b6 1a             	movzbl (%edx),%ebx
+  801068:	38 d9                	cmp    %bl,%cl
+  80106a:	75 11                	jne    80107d <memcmp+0x2f>
+  80106c:	83 c0 01             	add    $0x1,%eax
+  80106f:	83 c2 01             	add    $0x1,%edx
+  801072:	39 c6                	cmp    %eax,%esi
+  801074:	75 ec                	jne    801062 <memcmp+0x14>
+  801076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107b:	eb 08                	jmp    801085 <memcmp+0x37>
+  80107d:	0f b6 c1             	movzbl %cl,%eax
+  801080:	0f b6 db             	movzbl %bl,%ebx
+  801083:	29 d8                	sub    %ebx,%eax
+  801085:	5b                   	pop    %ebx
+  801086:	5e                   	pop    %esi
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+  801089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108e:	eb f5                	jmp    801085 <memcmp+0x37>
+
+00801090 <memfind>:
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	8b 45 08             	mov    0x8(%ebp),%eax
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	89 c2                	mov    %eax,%edx
+  80109b:	03 55 10             	add    0x10(%ebp),%edx
+  80109e:	39 d0                	cmp    %edx,%eax
+  8010a0:	73 0d                	jae    8010af <memfind+0x1f>
+  8010a2:	38 08                	cmp    %cl,(%eax)
+  8010a4:	74 0d                	je     8010b3 <memfind+0x23>
+  8010a6:	83 c0 01             	add    $0x1,%eax
+  8010a9:	39 c2                	cmp    %eax,%edx
+  8010ab:	75 f5                	jne    8010a2 <memfind+0x12>
+  8010ad:	eb 06                	jmp    8010b5 <memfind+0x25>
+  8010af:	89 c2                	mov    %eax,%edx
+  8010b1:	eb 02                	jmp    8010b5 <memfind+0x25>
+  8010b3:	89 c2                	mov    %eax,%edx
+  8010b5:	89 d0                	mov    %edx,%eax
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+
+008010b9 <strtol>:
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	57                   	push   %edi
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c5:	0f b6 02             	movzbl (%edx),%eax
+  8010c8:	3c 20                	cmp    $0x20,%al
+  8010ca:	74 04                	je     8010d0 <strtol+0x17>
+  8010cc:	3c 09                	cmp    $0x9,%al
+  8010ce:	75 0e                	jne    8010de <strtol+0x25>
+  8010d0:	83 c2 01             	add    $0x1,%edx
+  8010d3:	0f b6 02             	movzbl (%edx),%eax
+  8010d6:	3c 20                	cmp    $0x20,%al
+  8010d8:	74 f6                	je     8010d0 <strtol+0x17>
+  8010da:	3c 09                	cmp    $0x9,%al
+  8010dc:	74 f2                	je     8010d0 <strtol+0x17>
+  8010de:	3c 2b                	cmp    $0x2b,%al
+  8010e0:	74 2a                	je     80110c <strtol+0x53>
+  8010e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e7:	3c 2d                	cmp    $0x2d,%al
+  8010e9:	74 2b                	je     801116 <strtol+0x5d>
+  8010eb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8010f1:	75 0f                	jne    801102 <strtol+0x49>
+  8010f3:	80 3a 30             	cmpb   $0x30,(%edx)
+  8010f6:	74 28                	je     801120 <strtol+0x67>
+  8010f8:	85 db                	test   %ebx,%ebx
+  8010fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ff:	0f 44 d8             	cmove  %eax,%ebx
+  801102:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801107:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80110a:	eb 46                	jmp    801152 <strtol+0x99>
+  80110c:	83 c2 01             	add    $0x1,%edx
+  80110f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801114:	eb d5                	jmp    8010eb <strtol+0x32>
+  801116:	83 c2 01             	add    $0x1,%edx
+  801119:	bf 01 00 00 00       	mov    $0x1,%edi
+  80111e:	eb cb                	jmp    8010eb <strtol+0x32>
+  801120:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801124:	74 0e                	je     801134 <strtol+0x7b>
+  801126:	85 db                	test   %ebx,%ebx
+  801128:	75 d8                	jne    801102 <strtol+0x49>
+  80112a:	83 c2 01             	add    $0x1,%edx
+  80112d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801132:	eb ce                	jmp    801102 <strtol+0x49>
+  801134:	83 c2 02             	add    $0x2,%edx
+  801137:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80113c:	eb c4                	jmp    801102 <strtol+0x49>
+  80113e:	0f be c0             	movsbl %al,%eax
+  801141:	83 e8 30             	sub    $0x30,%eax
+  801144:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801147:	7d 3a                	jge    801183 <strtol+0xca>
+  801149:	83 c2 01             	add    $0x1,%edx
+  80114c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801150:	01 c1                	add    %eax,%ecx
+  801152:	0f b6 02             	movzbl (%edx),%eax
+  801155:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801158:	89 f3                	mov    %esi,%ebx
+  80115a:	80 fb 09             	cmp    $0x9,%bl
+  80115d:	76 df                	jbe    80113e <strtol+0x85>
+  80115f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801162:	89 f3                	mov    %esi,%ebx
+  801164:	80 fb 19             	cmp    $0x19,%bl
+  801167:	77 08                	ja     801171 <strtol+0xb8>
+  801169:	0f be c0             	movsbl %al,%eax
+  80116c:	83 e8 57             	sub    $0x57,%eax
+  80116f:	eb d3                	jmp    801144 <strtol+0x8b>
+  801171:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801174:	89 f3                	mov    %esi,%ebx
+  801176:	80 fb 19             	cmp    $0x19,%bl
+  801179:	77 08                	ja     801183 <strtol+0xca>
+  80117b:	0f be c0             	movsbl %al,%eax
+  80117e:	83 e8 37             	sub    $0x37,%eax
+  801181:	eb c1                	jmp    801144 <strtol+0x8b>
+  801183:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801187:	74 05                	je     80118e <strtol+0xd5>
+  801189:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80118c:	89 10                	mov    %edx,(%eax)
+  80118e:	89 c8                	mov    %ecx,%eax
+  801190:	f7 d8                	neg    %eax
+  801192:	85 ff                	test   %edi,%edi
+  801194:	0f 45 c8             	cmovne %eax,%ecx
+  801197:	89 c8                	mov    %ecx,%eax
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+
+0080119e <sys_cputs>:
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	57                   	push   %edi
+  8011a2:	56                   	push   %esi
+  8011a3:	53                   	push   %ebx
+  8011a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011af:	89 c3                	mov    %eax,%ebx
+  8011b1:	89 c7                	mov    %eax,%edi
+  8011b3:	89 c6                	mov    %eax,%esi
+  8011b5:	cd 30                	int    $0x30
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <sys_cgetc>:
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011cc:	89 d1                	mov    %edx,%ecx
+  8011ce:	89 d3                	mov    %edx,%ebx
+  8011d0:	89 d7                	mov    %edx,%edi
+  8011d2:	89 d6                	mov    %edx,%esi
+  8011d4:	cd 30                	int    $0x30
+  8011d6:	5b                   	pop    %ebx
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5f                   	pop    %edi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+
+008011db <sys_env_destroy>:
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  8011e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011f1:	89 cb                	mov    %ecx,%ebx
+  8011f3:	89 cf                	mov    %ecx,%edi
+  8011f5:	89 ce                	mov    %ecx,%esi
+  8011f7:	cd 30                	int    $0x30
+  8011f9:	85 c0                	test   %eax,%eax
+  8011fb:	7f 08                	jg     801205 <sys_env_destroy+0x2a>
+  8011fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801200:	5b                   	pop    %ebx
+  801201:	5e                   	pop    %esi
+  801202:	5f                   	pop    %edi
+  801203:	5d                   	pop    %ebp
+  801204:	c3                   	ret
+  801205:	83 ec 0c             	sub    $0xc,%esp
+  801208:	50                   	push   %eax
+  801209:	6a 03                	push   $0x3
+  80120b:	68 eb 3b 80 00       	push   $0x803beb
+  801210:	6a 24                	push   $0x24
+  801212:	68 08 3c 80 00       	push   $0x803c08
+  801217:	e8 38 f4 ff ff       	call   800654 <_panic>
+
+0080121c <sys_getenvid>:
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	57                   	push   %edi
+  801220:	56                   	push   %esi
+  801221:	53                   	push   %ebx
+  801222:	ba 00 00 00 00       	mov    $0x0,%edx
+  801227:	b8 02 00 00 00       	mov    $0x2,%eax
+  80122c:	89 d1                	mov    %edx,%ecx
+  80122e:	89 d3                	mov    %edx,%ebx
+  801230:	89 d7                	mov    %edx,%edi
+  801232:	89 d6                	mov    %edx,%esi
+  801234:	cd 30                	int    $0x30
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5f                   	pop    %edi
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+
+0080123b <sys_yield>:
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	57                   	push   %edi
+  80123f:	56                   	push   %esi
+  801240:	53                   	push   %ebx
+  801241:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801248:	74 26                	je     801270 <sys_yield+0x35>
+  80124a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801254:	89 d1                	mov    %edx,%ecx
+  801256:	89 d3                	mov    %edx,%ebx
+  801258:	89 d7                	mov    %edx,%edi
+  80125a:	6a 00                	push   $0x0
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	8d 35 67 12 80 00    	lea    0x801267,%esi
+  801265:	0f 34                	sysenter
+  801267:	5d                   	pop    %ebp
+  801268:	83 c4 04             	add    $0x4,%esp
+  80126b:	5b                   	pop    %ebx
+  80126c:	5e                   	pop    %esi
+  80126d:	5f                   	pop    %edi
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+  801270:	ba 00 00 00 00       	mov    $0x0,%edx
+  801275:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80127a:	89 d1                	mov    %edx,%ecx
+  80127c:	89 d3                	mov    %edx,%ebx
+  80127e:	89 d7                	mov    %edx,%edi
+  801280:	89 d6                	mov    %edx,%esi
+  801282:	cd 30                	int    $0x30
+  801284:	eb e5                	jmp    80126b <sys_yield+0x30>
+
+00801286 <sys_page_alloc>:
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	57                   	push   %edi
+  80128a:	56                   	push   %esi
+  80128b:	53                   	push   %ebx
+  80128c:	83 ec 0c             	sub    $0xc,%esp
+  80128f:	be 00 00 00 00       	mov    $0x0,%esi
+  801294:	8b 55 08             	mov    0x8(%ebp),%edx
+  801297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80129f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a2:	89 f7                	mov    %esi,%edi
+  8012a4:	cd 30                	int    $0x30
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	7f 08                	jg     8012b2 <sys_page_alloc+0x2c>
+  8012aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5f                   	pop    %edi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+  8012b2:	83 ec 0c             	sub    $0xc,%esp
+  8012b5:	50                   	push   %eax
+  8012b6:	6a 04                	push   $0x4
+  8012b8:	68 eb 3b 80 00       	push   $0x803beb
+  8012bd:	6a 24                	push   $0x24
+  8012bf:	68 08 3c 80 00       	push   $0x803c08
+  8012c4:	e8 8b f3 ff ff       	call   800654 <_panic>
+
+008012c9 <sys_page_map>:
+  8012c9:	55                   	push   %ebp
+  8012ca:	89 e5                	mov    %esp,%ebp
+  8012cc:	57                   	push   %edi
+  8012cd:	56                   	push   %esi
+  8012ce:	53                   	push   %ebx
+  8012cf:	83 ec 0c             	sub    $0xc,%esp
+  8012d2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012d9:	74 33                	je     80130e <sys_page_map+0x45>
+  8012db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8012e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ec:	ff 75 18             	push   0x18(%ebp)
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	8d 35 fa 12 80 00    	lea    0x8012fa,%esi
+  8012f8:	0f 34                	sysenter
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	83 c4 04             	add    $0x4,%esp
+  8012fe:	89 c2                	mov    %eax,%edx
+  801300:	85 c0                	test   %eax,%eax
+  801302:	7f 3d                	jg     801341 <sys_page_map+0x78>
+  801304:	89 d0                	mov    %edx,%eax
+  801306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5f                   	pop    %edi
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+  80130e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801313:	8b 55 08             	mov    0x8(%ebp),%edx
+  801316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801319:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80131f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801322:	cd 30                	int    $0x30
+  801324:	89 c2                	mov    %eax,%edx
+  801326:	85 c0                	test   %eax,%eax
+  801328:	7e da                	jle    801304 <sys_page_map+0x3b>
+  80132a:	83 ec 0c             	sub    $0xc,%esp
+  80132d:	50                   	push   %eax
+  80132e:	6a 05                	push   $0x5
+  801330:	68 eb 3b 80 00       	push   $0x803beb
+  801335:	6a 24                	push   $0x24
+  801337:	68 08 3c 80 00       	push   $0x803c08
+  80133c:	e8 13 f3 ff ff       	call   800654 <_panic>
+  801341:	83 ec 0c             	sub    $0xc,%esp
+  801344:	50                   	push   %eax
+  801345:	6a 05                	push   $0x5
+  801347:	68 eb 3b 80 00       	push   $0x803beb
+  80134c:	6a 48                	push   $0x48
+  80134e:	68 08 3c 80 00       	push   $0x803c08
+  801353:	e8 fc f2 ff ff       	call   800654 <_panic>
+
+00801358 <sys_page_unmap>:
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	57                   	push   %edi
+  80135c:	56                   	push   %esi
+  80135d:	53                   	push   %ebx
+  80135e:	83 ec 0c             	sub    $0xc,%esp
+  801361:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801366:	8b 55 08             	mov    0x8(%ebp),%edx
+  801369:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801371:	89 df                	mov    %ebx,%edi
+  801373:	89 de                	mov    %ebx,%esi
+  801375:	cd 30                	int    $0x30
+  801377:	85 c0                	test   %eax,%eax
+  801379:	7f 08                	jg     801383 <sys_page_unmap+0x2b>
+  80137b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137e:	5b                   	pop    %ebx
+  80137f:	5e                   	pop    %esi
+  801380:	5f                   	pop    %edi
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  801386:	50                   	push   %eax
+  801387:	6a 06                	push   $0x6
+  801389:	68 eb 3b 80 00       	push   $0x803beb
+  80138e:	6a 24                	push   $0x24
+  801390:	68 08 3c 80 00       	push   $0x803c08
+  801395:	e8 ba f2 ff ff       	call   800654 <_panic>
+
+0080139a <sys_fork>:
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+  80139d:	57                   	push   %edi
+  80139e:	56                   	push   %esi
+  80139f:	53                   	push   %ebx
+  8013a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013aa:	89 d1                	mov    %edx,%ecx
+  8013ac:	89 d3                	mov    %edx,%ebx
+  8013ae:	89 d7                	mov    %edx,%edi
+  8013b0:	89 d6                	mov    %edx,%esi
+  8013b2:	cd 30                	int    $0x30
+  8013b4:	5b                   	pop    %ebx
+  8013b5:	5e                   	pop    %esi
+  8013b6:	5f                   	pop    %edi
+  8013b7:	5d                   	pop    %ebp
+  8013b8:	c3                   	ret
+
+008013b9 <sys_env_set_status>:
+  8013b9:	55                   	push   %ebp
+  8013ba:	89 e5                	mov    %esp,%ebp
+  8013bc:	57                   	push   %edi
+  8013bd:	56                   	push   %esi
+  8013be:	53                   	push   %ebx
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013d2:	89 df                	mov    %ebx,%edi
+  8013d4:	89 de                	mov    %ebx,%esi
+  8013d6:	cd 30                	int    $0x30
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	7f 08                	jg     8013e4 <sys_env_set_status+0x2b>
+  8013dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013df:	5b                   	pop    %ebx
+  8013e0:	5e                   	pop    %esi
+  8013e1:	5f                   	pop    %edi
+  8013e2:	5d                   	pop    %ebp
+  8013e3:	c3                   	ret
+  8013e4:	83 ec 0c             	sub    $0xc,%esp
+  8013e7:	50                   	push   %eax
+  8013e8:	6a 08                	push   $0x8
+  8013ea:	68 eb 3b 80 00       	push   $0x803beb
+  8013ef:	6a 24                	push   $0x24
+  8013f1:	68 08 3c 80 00       	push   $0x803c08
+  8013f6:	e8 59 f2 ff ff       	call   800654 <_panic>
+
+008013fb <sys_env_set_trapframe>:
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	57                   	push   %edi
+  8013ff:	56                   	push   %esi
+  801400:	53                   	push   %ebx
+  801401:	83 ec 0c             	sub    $0xc,%esp
+  801404:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801414:	89 df                	mov    %ebx,%edi
+  801416:	89 de                	mov    %ebx,%esi
+  801418:	cd 30                	int    $0x30
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	7f 08                	jg     801426 <sys_env_set_trapframe+0x2b>
+  80141e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801421:	5b                   	pop    %ebx
+  801422:	5e                   	pop    %esi
+  801423:	5f                   	pop    %edi
+  801424:	5d                   	pop    %ebp
+  801425:	c3                   	ret
+  801426:	83 ec 0c             	sub    $0xc,%esp
+  801429:	50                   	push   %eax
+  80142a:	6a 09                	push   $0x9
+  80142c:	68 eb 3b 80 00       	push   $0x803beb
+  801431:	6a 24                	push   $0x24
+  801433:	68 08 3c 80 00       	push   $0x803c08
+  801438:	e8 17 f2 ff ff       	call   800654 <_panic>
+
+0080143d <sys_env_set_cow>:
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	57                   	push   %edi
+  801441:	56                   	push   %esi
+  801442:	53                   	push   %ebx
+  801443:	83 ec 0c             	sub    $0xc,%esp
+  801446:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801451:	b8 20 00 00 00       	mov    $0x20,%eax
+  801456:	89 df                	mov    %ebx,%edi
+  801458:	89 de                	mov    %ebx,%esi
+  80145a:	cd 30                	int    $0x30
+  80145c:	85 c0                	test   %eax,%eax
+  80145e:	7f 08                	jg     801468 <sys_env_set_cow+0x2b>
+  801460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801463:	5b                   	pop    %ebx
+  801464:	5e                   	pop    %esi
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+  801468:	83 ec 0c             	sub    $0xc,%esp
+  80146b:	50                   	push   %eax
+  80146c:	6a 20                	push   $0x20
+  80146e:	68 eb 3b 80 00       	push   $0x803beb
+  801473:	6a 24                	push   $0x24
+  801475:	68 08 3c 80 00       	push   $0x803c08
+  80147a:	e8 d5 f1 ff ff       	call   800654 <_panic>
+
+0080147f <sys_env_service>:
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	57                   	push   %edi
+  801483:	56                   	push   %esi
+  801484:	53                   	push   %ebx
+  801485:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148d:	b8 21 00 00 00       	mov    $0x21,%eax
+  801492:	89 cb                	mov    %ecx,%ebx
+  801494:	89 cf                	mov    %ecx,%edi
+  801496:	89 ce                	mov    %ecx,%esi
+  801498:	cd 30                	int    $0x30
+  80149a:	5b                   	pop    %ebx
+  80149b:	5e                   	pop    %esi
+  80149c:	5f                   	pop    %edi
+  80149d:	5d                   	pop    %ebp
+  80149e:	c3                   	ret
+
+0080149f <sys_env_set_pgfault_upcall>:
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	57                   	push   %edi
+  8014a3:	56                   	push   %esi
+  8014a4:	53                   	push   %ebx
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014b8:	89 df                	mov    %ebx,%edi
+  8014ba:	89 de                	mov    %ebx,%esi
+  8014bc:	cd 30                	int    $0x30
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	7f 08                	jg     8014ca <sys_env_set_pgfault_upcall+0x2b>
+  8014c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+  8014ca:	83 ec 0c             	sub    $0xc,%esp
+  8014cd:	50                   	push   %eax
+  8014ce:	6a 0a                	push   $0xa
+  8014d0:	68 eb 3b 80 00       	push   $0x803beb
+  8014d5:	6a 24                	push   $0x24
+  8014d7:	68 08 3c 80 00       	push   $0x803c08
+  8014dc:	e8 73 f1 ff ff       	call   800654 <_panic>
+
+008014e1 <sys_ipc_try_send>:
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+  8014e7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8014ee:	74 27                	je     801517 <sys_ipc_try_send+0x36>
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801501:	6a 00                	push   $0x0
+  801503:	55                   	push   %ebp
+  801504:	89 e5                	mov    %esp,%ebp
+  801506:	8d 35 0e 15 80 00    	lea    0x80150e,%esi
+  80150c:	0f 34                	sysenter
+  80150e:	5d                   	pop    %ebp
+  80150f:	83 c4 04             	add    $0x4,%esp
+  801512:	5b                   	pop    %ebx
+  801513:	5e                   	pop    %esi
+  801514:	5f                   	pop    %edi
+  801515:	5d                   	pop    %ebp
+  801516:	c3                   	ret
+  801517:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80151c:	be 00 00 00 00       	mov    $0x0,%esi
+  801521:	8b 55 08             	mov    0x8(%ebp),%edx
+  801524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801527:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80152d:	cd 30                	int    $0x30
+  80152f:	eb e1                	jmp    801512 <sys_ipc_try_send+0x31>
+
+00801531 <sys_ipc_recv>:
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+  801537:	83 ec 0c             	sub    $0xc,%esp
+  80153a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801541:	74 32                	je     801575 <sys_ipc_recv+0x44>
+  801543:	8b 55 08             	mov    0x8(%ebp),%edx
+  801546:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80154b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801550:	89 cb                	mov    %ecx,%ebx
+  801552:	89 cf                	mov    %ecx,%edi
+  801554:	6a 00                	push   $0x0
+  801556:	55                   	push   %ebp
+  801557:	89 e5                	mov    %esp,%ebp
+  801559:	8d 35 61 15 80 00    	lea    0x801561,%esi
+  80155f:	0f 34                	sysenter
+  801561:	5d                   	pop    %ebp
+  801562:	83 c4 04             	add    $0x4,%esp
+  801565:	89 c2                	mov    %eax,%edx
+  801567:	85 c0                	test   %eax,%eax
+  801569:	7f 3c                	jg     8015a7 <sys_ipc_recv+0x76>
+  80156b:	89 d0                	mov    %edx,%eax
+  80156d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5f                   	pop    %edi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+  801575:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80157f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801582:	89 cb                	mov    %ecx,%ebx
+  801584:	89 cf                	mov    %ecx,%edi
+  801586:	89 ce                	mov    %ecx,%esi
+  801588:	cd 30                	int    $0x30
+  80158a:	89 c2                	mov    %eax,%edx
+  80158c:	85 c0                	test   %eax,%eax
+  80158e:	7e db                	jle    80156b <sys_ipc_recv+0x3a>
+  801590:	83 ec 0c             	sub    $0xc,%esp
+  801593:	50                   	push   %eax
+  801594:	6a 0d                	push   $0xd
+  801596:	68 eb 3b 80 00       	push   $0x803beb
+  80159b:	6a 24                	push   $0x24
+  80159d:	68 08 3c 80 00       	push   $0x803c08
+  8015a2:	e8 ad f0 ff ff       	call   800654 <_panic>
+  8015a7:	83 ec 0c             	sub    $0xc,%esp
+  8015aa:	50                   	push   %eax
+  8015ab:	6a 0d                	push   $0xd
+  8015ad:	68 eb 3b 80 00       	push   $0x803beb
+  8015b2:	6a 48                	push   $0x48
+  8015b4:	68 08 3c 80 00       	push   $0x803c08
+  8015b9:	e8 96 f0 ff ff       	call   800654 <_panic>
+
+008015be <sys_ipc_send>:
+  8015be:	55                   	push   %ebp
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	57                   	push   %edi
+  8015c2:	56                   	push   %esi
+  8015c3:	53                   	push   %ebx
+  8015c4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8015cb:	74 27                	je     8015f4 <sys_ipc_send+0x36>
+  8015cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015de:	6a 00                	push   $0x0
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	8d 35 eb 15 80 00    	lea    0x8015eb,%esi
+  8015e9:	0f 34                	sysenter
+  8015eb:	5d                   	pop    %ebp
+  8015ec:	83 c4 04             	add    $0x4,%esp
+  8015ef:	5b                   	pop    %ebx
+  8015f0:	5e                   	pop    %esi
+  8015f1:	5f                   	pop    %edi
+  8015f2:	5d                   	pop    %ebp
+  8015f3:	c3                   	ret
+  8015f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801601:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801604:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801607:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80160a:	cd 30                	int    $0x30
+  80160c:	eb e1                	jmp    8015ef <sys_ipc_send+0x31>
+
+0080160e <sys_ipc_call>:
+  80160e:	55                   	push   %ebp
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	57                   	push   %edi
+  801612:	56                   	push   %esi
+  801613:	53                   	push   %ebx
+  801614:	8b 55 08             	mov    0x8(%ebp),%edx
+  801617:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80161f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801622:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801625:	8b 75 18             	mov    0x18(%ebp),%esi
+  801628:	cd 30                	int    $0x30
+  80162a:	5b                   	pop    %ebx
+  80162b:	5e                   	pop    %esi
+  80162c:	5f                   	pop    %edi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+
+0080162f <sys_ipc_reply_recv>:
+  80162f:	55                   	push   %ebp
+  801630:	89 e5                	mov    %esp,%ebp
+  801632:	57                   	push   %edi
+  801633:	56                   	push   %esi
+  801634:	53                   	push   %ebx
+  801635:	8b 55 08             	mov    0x8(%ebp),%edx
+  801638:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801640:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801643:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801646:	8b 75 18             	mov    0x18(%ebp),%esi
+  801649:	cd 30                	int    $0x30
+  80164b:	5b                   	pop    %ebx
+  80164c:	5e                   	pop    %esi
+  80164d:	5f                   	pop    %edi
+  80164e:	5d                   	pop    %ebp
+  80164f:	c3                   	ret
+
+00801650 <sys_time_msec>:
+  801650:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801655:	85 c0                	test   %eax,%eax
+  801657:	75 06                	jne    80165f <sys_time_msec+0xf>
+  801659:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80165e:	c3                   	ret
+  80165f:	55                   	push   %ebp
+  801660:	89 e5                	mov    %esp,%ebp
+  801662:	57                   	push   %edi
+  801663:	56                   	push   %esi
+  801664:	53                   	push   %ebx
+  801665:	83 ec 0c             	sub    $0xc,%esp
+  801668:	0f 31                	rdtsc
+  80166a:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801670:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801676:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80167c:	29 c8                	sub    %ecx,%eax
+  80167e:	19 da                	sbb    %ebx,%edx
+  801680:	bf 00 00 00 00       	mov    $0x0,%edi
+  801685:	57                   	push   %edi
+  801686:	56                   	push   %esi
+  801687:	52                   	push   %edx
+  801688:	50                   	push   %eax
+  801689:	e8 ee 1f 00 00       	call   80367c <__udivdi3>
+  80168e:	83 c4 10             	add    $0x10,%esp
+  801691:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801694:	5b                   	pop    %ebx
+  801695:	5e                   	pop    %esi
+  801696:	5f                   	pop    %edi
+  801697:	5d                   	pop    %ebp
+  801698:	c3                   	ret
+
+00801699 <sys_env_swap>:
+  801699:	55                   	push   %ebp
+  80169a:	89 e5                	mov    %esp,%ebp
+  80169c:	57                   	push   %edi
+  80169d:	56                   	push   %esi
+  80169e:	53                   	push   %ebx
+  80169f:	83 ec 0c             	sub    $0xc,%esp
+  8016a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016aa:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016af:	89 cb                	mov    %ecx,%ebx
+  8016b1:	89 cf                	mov    %ecx,%edi
+  8016b3:	89 ce                	mov    %ecx,%esi
+  8016b5:	cd 30                	int    $0x30
+  8016b7:	85 c0                	test   %eax,%eax
+  8016b9:	7f 08                	jg     8016c3 <sys_env_swap+0x2a>
+  8016bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016be:	5b                   	pop    %ebx
+  8016bf:	5e                   	pop    %esi
+  8016c0:	5f                   	pop    %edi
+  8016c1:	5d                   	pop    %ebp
+  8016c2:	c3                   	ret
+  8016c3:	83 ec 0c             	sub    $0xc,%esp
+  8016c6:	50                   	push   %eax
+  8016c7:	6a 12                	push   $0x12
+  8016c9:	68 eb 3b 80 00       	push   $0x803beb
+  8016ce:	6a 24                	push   $0x24
+  8016d0:	68 08 3c 80 00       	push   $0x803c08
+  8016d5:	e8 7a ef ff ff       	call   800654 <_panic>
+
+008016da <sys_net_try_send>:
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	57                   	push   %edi
+  8016de:	56                   	push   %esi
+  8016df:	53                   	push   %ebx
+  8016e0:	83 ec 0c             	sub    $0xc,%esp
+  8016e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ee:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016f3:	89 df                	mov    %ebx,%edi
+  8016f5:	89 de                	mov    %ebx,%esi
+  8016f7:	cd 30                	int    $0x30
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	7f 08                	jg     801705 <sys_net_try_send+0x2b>
+  8016fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801700:	5b                   	pop    %ebx
+  801701:	5e                   	pop    %esi
+  801702:	5f                   	pop    %edi
+  801703:	5d                   	pop    %ebp
+  801704:	c3                   	ret
+  801705:	83 ec 0c             	sub    $0xc,%esp
+  801708:	50                   	push   %eax
+  801709:	6a 13                	push   $0x13
+  80170b:	68 eb 3b 80 00       	push   $0x803beb
+  801710:	6a 24                	push   $0x24
+  801712:	68 08 3c 80 00       	push   $0x803c08
+  801717:	e8 38 ef ff ff       	call   800654 <_panic>
+
+0080171c <sys_net_try_receive>:
+  80171c:	55                   	push   %ebp
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	57                   	push   %edi
+  801720:	56                   	push   %esi
+  801721:	53                   	push   %ebx
+  801722:	83 ec 0c             	sub    $0xc,%esp
+  801725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801730:	b8 14 00 00 00       	mov    $0x14,%eax
+  801735:	89 df                	mov    %ebx,%edi
+  801737:	89 de                	mov    %ebx,%esi
+  801739:	cd 30                	int    $0x30
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	7f 08                	jg     801747 <sys_net_try_receive+0x2b>
+  80173f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801742:	5b                   	pop    %ebx
+  801743:	5e                   	pop    %esi
+  801744:	5f                   	pop    %edi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+  801747:	83 ec 0c             	sub    $0xc,%esp
+  80174a:	50                   	push   %eax
+  80174b:	6a 14                	push   $0x14
+  80174d:	68 eb 3b 80 00       	push   $0x803beb
+  801752:	6a 24                	push   $0x24
+  801754:	68 08 3c 80 00       	push   $0x803c08
+  801759:	e8 f6 ee ff ff       	call   800654 <_panic>
+
+0080175e <sys_net_recv_page>:
+  80175e:	55                   	push   %ebp
+  80175f:	89 e5                	mov    %esp,%ebp
+  801761:	57                   	push   %edi
+  801762:	56                   	push   %esi
+  801763:	53                   	push   %ebx
+  801764:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801769:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176c:	b8 27 00 00 00       	mov    $0x27,%eax
+  801771:	89 cb                	mov    %ecx,%ebx
+  801773:	89 cf                	mov    %ecx,%edi
+  801775:	89 ce                	mov    %ecx,%esi
+  801777:	cd 30                	int    $0x30
+  801779:	5b                   	pop    %ebx
+  80177a:	5e                   	pop    %esi
+  80177b:	5f                   	pop    %edi
+  80177c:	5d                   	pop    %ebp
+  80177d:	c3                   	ret
+
+0080177e <sys_net_wait>:
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	57                   	push   %edi
+  801782:	56                   	push   %esi
+  801783:	53                   	push   %ebx
+  801784:	ba 00 00 00 00       	mov    $0x0,%edx
+  801789:	b8 26 00 00 00       	mov    $0x26,%eax
+  80178e:	89 d1                	mov    %edx,%ecx
+  801790:	89 d3                	mov    %edx,%ebx
+  801792:	89 d7                	mov    %edx,%edi
+  801794:	89 d6                	mov    %edx,%esi
+  801796:	cd 30                	int    $0x30
+  801798:	5b                   	pop    %ebx
+  801799:	5e                   	pop    %esi
+  80179a:	5f                   	pop    %edi
+  80179b:	5d                   	pop    %ebp
+  80179c:	c3                   	ret
+
+0080179d <sys_get_mac>:
+  80179d:	55                   	push   %ebp
+  80179e:	89 e5                	mov    %esp,%ebp
+  8017a0:	57                   	push   %edi
+  8017a1:	56                   	push   %esi
+  8017a2:	53                   	push   %ebx
+  8017a3:	83 ec 0c             	sub    $0xc,%esp
+  8017a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017b6:	89 df                	mov    %ebx,%edi
+  8017b8:	89 de                	mov    %ebx,%esi
+  8017ba:	cd 30                	int    $0x30
+  8017bc:	85 c0                	test   %eax,%eax
+  8017be:	7f 08                	jg     8017c8 <sys_get_mac+0x2b>
+  8017c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c3:	5b                   	pop    %ebx
+  8017c4:	5e                   	pop    %esi
+  8017c5:	5f                   	pop    %edi
+  8017c6:	5d                   	pop    %ebp
+  8017c7:	c3                   	ret
+  8017c8:	83 ec 0c             	sub    $0xc,%esp
+  8017cb:	50                   	push   %eax
+  8017cc:	6a 15                	push   $0x15
+  8017ce:	68 eb 3b 80 00       	push   $0x803beb
+  8017d3:	6a 24                	push   $0x24
+  8017d5:	68 08 3c 80 00       	push   $0x803c08
+  8017da:	e8 75 ee ff ff       	call   800654 <_panic>
+
+008017df <sys_env_lease>:
+  8017df:	55                   	push   %ebp
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	57                   	push   %edi
+  8017e3:	56                   	push   %esi
+  8017e4:	53                   	push   %ebx
+  8017e5:	83 ec 0c             	sub    $0xc,%esp
+  8017e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017f8:	89 df                	mov    %ebx,%edi
+  8017fa:	89 de                	mov    %ebx,%esi
+  8017fc:	cd 30                	int    $0x30
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	7f 08                	jg     80180a <sys_env_lease+0x2b>
+  801802:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801805:	5b                   	pop    %ebx
+  801806:	5e                   	pop    %esi
+  801807:	5f                   	pop    %edi
+  801808:	5d                   	pop    %ebp
+  801809:	c3                   	ret
+  80180a:	83 ec 0c             	sub    $0xc,%esp
+  80180d:	50                   	push   %eax
+  80180e:	6a 16                	push   $0x16
+  801810:	68 eb 3b 80 00       	push   $0x803beb
+  801815:	6a 24                	push   $0x24
+  801817:	68 08 3c 80 00       	push   $0x803c08
+  80181c:	e8 33 ee ff ff       	call   800654 <_panic>
+
+00801821 <sys_copy_mem>:
+  801821:	55                   	push   %ebp
+  801822:	89 e5                	mov    %esp,%ebp
+  801824:	57                   	push   %edi
+  801825:	56                   	push   %esi
+  801826:	53                   	push   %ebx
+  801827:	83 ec 0c             	sub    $0xc,%esp
+  80182a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801830:	b8 17 00 00 00       	mov    $0x17,%eax
+  801835:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801838:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80183b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80183e:	cd 30                	int    $0x30
+  801840:	85 c0                	test   %eax,%eax
+  801842:	7f 08                	jg     80184c <sys_copy_mem+0x2b>
+  801844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801847:	5b                   	pop    %ebx
+  801848:	5e                   	pop    %esi
+  801849:	5f                   	pop    %edi
+  80184a:	5d                   	pop    %ebp
+  80184b:	c3                   	ret
+  80184c:	83 ec 0c             	sub    $0xc,%esp
+  80184f:	50                   	push   %eax
+  801850:	6a 17                	push   $0x17
+  801852:	68 eb 3b 80 00       	push   $0x803beb
+  801857:	6a 24                	push   $0x24
+  801859:	68 08 3c 80 00       	push   $0x803c08
+  80185e:	e8 f1 ed ff ff       	call   800654 <_panic>
+
+00801863 <sys_get_perms>:
+  801863:	55                   	push   %ebp
+  801864:	89 e5                	mov    %esp,%ebp
+  801866:	57                   	push   %edi
+  801867:	56                   	push   %esi
+  801868:	53                   	push   %ebx
+  801869:	83 ec 0c             	sub    $0xc,%esp
+  80186c:	be 00 00 00 00       	mov    $0x0,%esi
+  801871:	8b 55 08             	mov    0x8(%ebp),%edx
+  801874:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801877:	b8 18 00 00 00       	mov    $0x18,%eax
+  80187c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80187f:	89 f7                	mov    %esi,%edi
+  801881:	cd 30                	int    $0x30
+  801883:	85 c0                	test   %eax,%eax
+  801885:	7f 08                	jg     80188f <sys_get_perms+0x2c>
+  801887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188a:	5b                   	pop    %ebx
+  80188b:	5e                   	pop    %esi
+  80188c:	5f                   	pop    %edi
+  80188d:	5d                   	pop    %ebp
+  80188e:	c3                   	ret
+  80188f:	83 ec 0c             	sub    $0xc,%esp
+  801892:	50                   	push   %eax
+  801893:	6a 18                	push   $0x18
+  801895:	68 eb 3b 80 00       	push   $0x803beb
+  80189a:	6a 24                	push   $0x24
+  80189c:	68 08 3c 80 00       	push   $0x803c08
+  8018a1:	e8 ae ed ff ff       	call   800654 <_panic>
+
+008018a6 <sys_env_unsuspend>:
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	57                   	push   %edi
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+  8018ac:	83 ec 0c             	sub    $0xc,%esp
+  8018af:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ba:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018c2:	89 f7                	mov    %esi,%edi
+  8018c4:	cd 30                	int    $0x30
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	7f 08                	jg     8018d2 <sys_env_unsuspend+0x2c>
+  8018ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5f                   	pop    %edi
+  8018d0:	5d                   	pop    %ebp
+  8018d1:	c3                   	ret
+  8018d2:	83 ec 0c             	sub    $0xc,%esp
+  8018d5:	50                   	push   %eax
+  8018d6:	6a 19                	push   $0x19
+  8018d8:	68 eb 3b 80 00       	push   $0x803beb
+  8018dd:	6a 24                	push   $0x24
+  8018df:	68 08 3c 80 00       	push   $0x803c08
+  8018e4:	e8 6b ed ff ff       	call   800654 <_panic>
+
+008018e9 <sys_migrate>:
+  8018e9:	55                   	push   %ebp
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	57                   	push   %edi
+  8018ed:	56                   	push   %esi
+  8018ee:	53                   	push   %ebx
+  8018ef:	83 ec 0c             	sub    $0xc,%esp
+  8018f2:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8018f7:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8018fd:	76 11                	jbe    801910 <sys_migrate+0x27>
+  8018ff:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801904:	0f b6 08             	movzbl (%eax),%ecx
+  801907:	05 00 10 00 00       	add    $0x1000,%eax
+  80190c:	39 d0                	cmp    %edx,%eax
+  80190e:	72 f4                	jb     801904 <sys_migrate+0x1b>
+  801910:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801915:	8b 55 08             	mov    0x8(%ebp),%edx
+  801918:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80191d:	89 cb                	mov    %ecx,%ebx
+  80191f:	89 cf                	mov    %ecx,%edi
+  801921:	89 ce                	mov    %ecx,%esi
+  801923:	cd 30                	int    $0x30
+  801925:	85 c0                	test   %eax,%eax
+  801927:	7f 08                	jg     801931 <sys_migrate+0x48>
+  801929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192c:	5b                   	pop    %ebx
+  80192d:	5e                   	pop    %esi
+  80192e:	5f                   	pop    %edi
+  80192f:	5d                   	pop    %ebp
+  801930:	c3                   	ret
+  801931:	83 ec 0c             	sub    $0xc,%esp
+  801934:	50                   	push   %eax
+  801935:	6a 1a                	push   $0x1a
+  801937:	68 eb 3b 80 00       	push   $0x803beb
+  80193c:	6a 24                	push   $0x24
+  80193e:	68 08 3c 80 00       	push   $0x803c08
+  801943:	e8 0c ed ff ff       	call   800654 <_panic>
+
+00801948 <sys_lease_complete>:
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	57                   	push   %edi
+  80194c:	56                   	push   %esi
+  80194d:	53                   	push   %ebx
+  80194e:	83 ec 0c             	sub    $0xc,%esp
+  801951:	ba 00 00 00 00       	mov    $0x0,%edx
+  801956:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80195b:	89 d1                	mov    %edx,%ecx
+  80195d:	89 d3                	mov    %edx,%ebx
+  80195f:	89 d7                	mov    %edx,%edi
+  801961:	89 d6                	mov    %edx,%esi
+  801963:	cd 30                	int    $0x30
+  801965:	85 c0                	test   %eax,%eax
+  801967:	7f 08                	jg     801971 <sys_lease_complete+0x29>
+  801969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196c:	5b                   	pop    %ebx
+  80196d:	5e                   	pop    %esi
+  80196e:	5f                   	pop    %edi
+  80196f:	5d                   	pop    %ebp
+  801970:	c3                   	ret
+  801971:	83 ec 0c             	sub    $0xc,%esp
+  801974:	50                   	push   %eax
+  801975:	6a 1b                	push   $0x1b
+  801977:	68 eb 3b 80 00       	push   $0x803beb
+  80197c:	6a 24                	push   $0x24
+  80197e:	68 08 3c 80 00       	push   $0x803c08
+  801983:	e8 cc ec ff ff       	call   800654 <_panic>
+
+00801988 <sys_env_set_thisenv>:
+  801988:	55                   	push   %ebp
+  801989:	89 e5                	mov    %esp,%ebp
+  80198b:	57                   	push   %edi
+  80198c:	56                   	push   %esi
+  80198d:	53                   	push   %ebx
+  80198e:	83 ec 0c             	sub    $0xc,%esp
+  801991:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801996:	8b 55 08             	mov    0x8(%ebp),%edx
+  801999:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80199c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8019a1:	89 df                	mov    %ebx,%edi
+  8019a3:	89 de                	mov    %ebx,%esi
+  8019a5:	cd 30                	int    $0x30
+  8019a7:	85 c0                	test   %eax,%eax
+  8019a9:	7f 08                	jg     8019b3 <sys_env_set_thisenv+0x2b>
+  8019ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ae:	5b                   	pop    %ebx
+  8019af:	5e                   	pop    %esi
+  8019b0:	5f                   	pop    %edi
+  8019b1:	5d                   	pop    %ebp
+  8019b2:	c3                   	ret
+  8019b3:	83 ec 0c             	sub    $0xc,%esp
+  8019b6:	50                   	push   %eax
+  8019b7:	6a 1c                	push   $0x1c
+  8019b9:	68 eb 3b 80 00       	push   $0x803beb
+  8019be:	6a 24                	push   $0x24
+  8019c0:	68 08 3c 80 00       	push   $0x803c08
+  8019c5:	e8 8a ec ff ff       	call   800654 <_panic>
+
+008019ca <sys_env_set_sched>:
+  8019ca:	55                   	push   %ebp
+  8019cb:	89 e5                	mov    %esp,%ebp
+  8019cd:	57                   	push   %edi
+  8019ce:	56                   	push   %esi
+  8019cf:	53                   	push   %ebx
+  8019d0:	83 ec 0c             	sub    $0xc,%esp
+  8019d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019de:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8019e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019e6:	89 f7                	mov    %esi,%edi
+  8019e8:	cd 30                	int    $0x30
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	7f 08                	jg     8019f6 <sys_env_set_sched+0x2c>
+  8019ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f1:	5b                   	pop    %ebx
+  8019f2:	5e                   	pop    %esi
+  8019f3:	5f                   	pop    %edi
+  8019f4:	5d                   	pop    %ebp
+  8019f5:	c3                   	ret
+  8019f6:	83 ec 0c             	sub    $0xc,%esp
+  8019f9:	50                   	push   %eax
+  8019fa:	6a 1d                	push   $0x1d
+  8019fc:	68 eb 3b 80 00       	push   $0x803beb
+  801a01:	6a 24                	push   $0x24
+  801a03:	68 08 3c 80 00       	push   $0x803c08
+  801a08:	e8 47 ec ff ff       	call   800654 <_panic>
+
+00801a0d <sys_batch>:
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	57                   	push   %edi
+  801a11:	56                   	push   %esi
+  801a12:	53                   	push   %ebx
+  801a13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a18:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a1e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a23:	89 df                	mov    %ebx,%edi
+  801a25:	89 de                	mov    %ebx,%esi
+  801a27:	cd 30                	int    $0x30
+  801a29:	5b                   	pop    %ebx
+  801a2a:	5e                   	pop    %esi
+  801a2b:	5f                   	pop    %edi
+  801a2c:	5d                   	pop    %ebp
+  801a2d:	c3                   	ret
+
+00801a2e <sys_env_stats>:
+  801a2e:	55                   	push   %ebp
+  801a2f:	89 e5                	mov    %esp,%ebp
+  801a31:	57                   	push   %edi
+  801a32:	56                   	push   %esi
+  801a33:	53                   	push   %ebx
+  801a34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a3f:	b8 23 00 00 00       	mov    $0x23,%eax
+  801a44:	89 df                	mov    %ebx,%edi
+  801a46:	89 de                	mov    %ebx,%esi
+  801a48:	cd 30                	int    $0x30
+  801a4a:	5b                   	pop    %ebx
+  801a4b:	5e                   	pop    %esi
+  801a4c:	5f                   	pop    %edi
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+
+00801a4f <sys_trace>:
+  801a4f:	55                   	push   %ebp
+  801a50:	89 e5                	mov    %esp,%ebp
+  801a52:	57                   	push   %edi
+  801a53:	56                   	push   %esi
+  801a54:	53                   	push   %ebx
+  801a55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a5d:	b8 24 00 00 00       	mov    $0x24,%eax
+  801a62:	89 cb                	mov    %ecx,%ebx
+  801a64:	89 cf                	mov    %ecx,%edi
+  801a66:	89 ce                	mov    %ecx,%esi
+  801a68:	cd 30                	int    $0x30
+  801a6a:	5b                   	pop    %ebx
+  801a6b:	5e                   	pop    %esi
+  801a6c:	5f                   	pop    %edi
+  801a6d:	5d                   	pop    %ebp
+  801a6e:	c3                   	ret
+
+00801a6f <sys_env_set_pager>:
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	57                   	push   %edi
+  801a73:	56                   	push   %esi
+  801a74:	53                   	push   %ebx
+  801a75:	83 ec 0c             	sub    $0xc,%esp
+  801a78:	be 00 00 00 00       	mov    $0x0,%esi
+  801a7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a83:	b8 25 00 00 00       	mov    $0x25,%eax
+  801a88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a8b:	89 f7                	mov    %esi,%edi
+  801a8d:	cd 30                	int    $0x30
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	7f 08                	jg     801a9b <sys_env_set_pager+0x2c>
+  801a93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a96:	5b                   	pop    %ebx
+  801a97:	5e                   	pop    %esi
+  801a98:	5f                   	pop    %edi
+  801a99:	5d                   	pop    %ebp
+  801a9a:	c3                   	ret
+  801a9b:	83 ec 0c             	sub    $0xc,%esp
+  801a9e:	50                   	push   %eax
+  801a9f:	6a 25                	push   $0x25
+  801aa1:	68 eb 3b 80 00       	push   $0x803beb
+  801aa6:	6a 24                	push   $0x24
+  801aa8:	68 08 3c 80 00       	push   $0x803c08
+  801aad:	e8 a2 eb ff ff       	call   800654 <_panic>
+
+00801ab2 <sys_pager_retire>:
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	57                   	push   %edi
+  801ab6:	56                   	push   %esi
+  801ab7:	53                   	push   %ebx
+  801ab8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801abd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+  801ac5:	89 cb                	mov    %ecx,%ebx
+  801ac7:	89 cf                	mov    %ecx,%edi
+  801ac9:	89 ce                	mov    %ecx,%esi
+  801acb:	cd 30                	int    $0x30
+  801acd:	5b                   	pop    %ebx
+  801ace:	5e                   	pop    %esi
+  801acf:	5f                   	pop    %edi
+  801ad0:	5d                   	pop    %ebp
+  801ad1:	c3                   	ret
+
+00801ad2 <sys_prof>:
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	57                   	push   %edi
+  801ad6:	56                   	push   %esi
+  801ad7:	53                   	push   %ebx
+  801ad8:	be 00 00 00 00       	mov    $0x0,%esi
+  801add:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae3:	b8 22 00 00 00       	mov    $0x22,%eax
+  801ae8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801aeb:	89 f7                	mov    %esi,%edi
+  801aed:	cd 30                	int    $0x30
+  801aef:	5b                   	pop    %ebx
+  801af0:	5e                   	pop    %esi
+  801af1:	5f                   	pop    %edi
+  801af2:	5d                   	pop    %ebp
+  801af3:	c3                   	ret
+
+00801af4 <set_pgfault_handler>:
+  801af4:	55                   	push   %ebp
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	53                   	push   %ebx
+  801af8:	83 ec 04             	sub    $0x4,%esp
+  801afb:	83 3d c0 50 80 00 00 	cmpl   $0x0,0x8050c0
+  801b02:	74 0d                	je     801b11 <set_pgfault_handler+0x1d>
+  801b04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b07:	a3 c0 50 80 00       	mov    %eax,0x8050c0
+  801b0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0f:	c9                   	leave
+  801b10:	c3                   	ret
+  801b11:	e8 06 f7 ff ff       	call   80121c <sys_getenvid>
+  801b16:	89 c3                	mov    %eax,%ebx
+  801b18:	83 ec 04             	sub    $0x4,%esp
+  801b1b:	6a 07                	push   $0x7
+  801b1d:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b22:	50                   	push   %eax
+  801b23:	e8 5e f7 ff ff       	call   801286 <sys_page_alloc>
+  801b28:	83 c4 10             	add    $0x10,%esp
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	78 29                	js     801b58 <set_pgfault_handler+0x64>
+  801b2f:	83 ec 08             	sub    $0x8,%esp
+  801b32:	68 6c 1b 80 00       	push   $0x801b6c
+  801b37:	53                   	push   %ebx
+  801b38:	e8 62 f9 ff ff       	call   80149f <sys_env_set_pgfault_upcall>
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	79 c0                	jns    801b04 <set_pgfault_handler+0x10>
+  801b44:	83 ec 04             	sub    $0x4,%esp
+  801b47:	68 50 3c 80 00       	push   $0x803c50
+  801b4c:	6a 27                	push   $0x27
+  801b4e:	68 82 3c 80 00       	push   $0x803c82
+  801b53:	e8 fc ea ff ff       	call   800654 <_panic>
+  801b58:	83 ec 04             	sub    $0x4,%esp
+  801b5b:	68 18 3c 80 00       	push   $0x803c18
+  801b60:	6a 23                	push   $0x23
+  801b62:	68 82 3c 80 00       	push   $0x803c82
+  801b67:	e8 e8 ea ff ff       	call   800654 <_panic>
+
+00801b6c <_pgfault_upcall>:
+  801b6c:	54                   	push   %esp
+  801b6d:	a1 c0 50 80 00       	mov    0x8050c0,%eax
+  801b72:	ff d0                	call   *%eax
+  801b74:	83 c4 04             	add    $0x4,%esp
+  801b77:	89 e3                	mov    %esp,%ebx
+  801b79:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  801b7d:	8b 54 24 30          	mov    0x30(%esp),%edx
+  801b81:	89 d4                	mov    %edx,%esp
+  801b83:	51                   	push   %ecx
+  801b84:	89 dc                	mov    %ebx,%esp
+  801b86:	83 ea 04             	sub    $0x4,%edx
+  801b89:	89 54 24 30          	mov    %edx,0x30(%esp)
+  801b8d:	83 c4 08             	add    $0x8,%esp
+  801b90:	61                   	popa
+  801b91:	83 c4 04             	add    $0x4,%esp
+  801b94:	9d                   	popf
+  801b95:	5c                   	pop    %esp
+  801b96:	c3                   	ret
+
+00801b97 <fd2num>:
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+  801b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ba2:	c1 e8 0c             	shr    $0xc,%eax
+  801ba5:	5d                   	pop    %ebp
+  801ba6:	c3                   	ret
+
+00801ba7 <fd2data>:
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+  801baa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bad:	05 00 00 00 30       	add    $0x30000000,%eax
+  801bb2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bb7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801bbc:	5d                   	pop    %ebp
+  801bbd:	c3                   	ret
+
+00801bbe <fd_alloc>:
+  801bbe:	55                   	push   %ebp
+  801bbf:	89 e5                	mov    %esp,%ebp
+  801bc1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801bc6:	89 c2                	mov    %eax,%edx
+  801bc8:	c1 ea 16             	shr    $0x16,%edx
+  801bcb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bd2:	f6 c2 01             	test   $0x1,%dl
+  801bd5:	74 29                	je     801c00 <fd_alloc+0x42>
+  801bd7:	89 c2                	mov    %eax,%edx
+  801bd9:	c1 ea 0c             	shr    $0xc,%edx
+  801bdc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801be3:	f6 c2 01             	test   $0x1,%dl
+  801be6:	74 18                	je     801c00 <fd_alloc+0x42>
+  801be8:	05 00 10 00 00       	add    $0x1000,%eax
+  801bed:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801bf2:	75 d2                	jne    801bc6 <fd_alloc+0x8>
+  801bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801bfe:	eb 05                	jmp    801c05 <fd_alloc+0x47>
+  801c00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c05:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c08:	89 02                	mov    %eax,(%edx)
+  801c0a:	89 c8                	mov    %ecx,%eax
+  801c0c:	5d                   	pop    %ebp
+  801c0d:	c3                   	ret
+
+00801c0e <fd_lookup>:
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c14:	83 f8 1f             	cmp    $0x1f,%eax
+  801c17:	77 30                	ja     801c49 <fd_lookup+0x3b>
+  801c19:	c1 e0 0c             	shl    $0xc,%eax
+  801c1c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801c21:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c27:	f6 c2 01             	test   $0x1,%dl
+  801c2a:	74 24                	je     801c50 <fd_lookup+0x42>
+  801c2c:	89 c2                	mov    %eax,%edx
+  801c2e:	c1 ea 0c             	shr    $0xc,%edx
+  801c31:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c38:	f6 c2 01             	test   $0x1,%dl
+  801c3b:	74 1a                	je     801c57 <fd_lookup+0x49>
+  801c3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c40:	89 02                	mov    %eax,(%edx)
+  801c42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c47:	5d                   	pop    %ebp
+  801c48:	c3                   	ret
+  801c49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c4e:	eb f7                	jmp    801c47 <fd_lookup+0x39>
+  801c50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c55:	eb f0                	jmp    801c47 <fd_lookup+0x39>
+  801c57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c5c:	eb e9                	jmp    801c47 <fd_lookup+0x39>
+
+00801c5e <dev_lookup>:
+  801c5e:	55                   	push   %ebp
+  801c5f:	89 e5                	mov    %esp,%ebp
+  801c61:	53                   	push   %ebx
+  801c62:	83 ec 04             	sub    $0x4,%esp
+  801c65:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6d:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801c72:	39 13                	cmp    %edx,(%ebx)
+  801c74:	74 37                	je     801cad <dev_lookup+0x4f>
+  801c76:	83 c0 01             	add    $0x1,%eax
+  801c79:	8b 1c 85 0c 3d 80 00 	mov    0x803d0c(,%eax,4),%ebx
+  801c80:	85 db                	test   %ebx,%ebx
+  801c82:	75 ee                	jne    801c72 <dev_lookup+0x14>
+  801c84:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  801c89:	8b 40 48             	mov    0x48(%eax),%eax
+  801c8c:	83 ec 04             	sub    $0x4,%esp
+  801c8f:	52                   	push   %edx
+  801c90:	50                   	push   %eax
+  801c91:	68 90 3c 80 00       	push   $0x803c90
+  801c96:	e8 94 ea ff ff       	call   80072f <cprintf>
+  801c9b:	83 c4 10             	add    $0x10,%esp
+  801c9e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ca6:	89 1a                	mov    %ebx,(%edx)
+  801ca8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cab:	c9                   	leave
+  801cac:	c3                   	ret
+  801cad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb2:	eb ef                	jmp    801ca3 <dev_lookup+0x45>
+
+00801cb4 <fd_close>:
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	57                   	push   %edi
+  801cb8:	56                   	push   %esi
+  801cb9:	53                   	push   %ebx
+  801cba:	83 ec 24             	sub    $0x24,%esp
+  801cbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cc0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801cc3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cc6:	50                   	push   %eax
+  801cc7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ccd:	c1 e8 0c             	shr    $0xc,%eax
+  801cd0:	50                   	push   %eax
+  801cd1:	e8 38 ff ff ff       	call   801c0e <fd_lookup>
+  801cd6:	89 c3                	mov    %eax,%ebx
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	85 c0                	test   %eax,%eax
+  801cdd:	78 05                	js     801ce4 <fd_close+0x30>
+  801cdf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ce2:	74 0f                	je     801cf3 <fd_close+0x3f>
+  801ce4:	85 ff                	test   %edi,%edi
+  801ce6:	0f 44 df             	cmove  %edi,%ebx
+  801ce9:	89 d8                	mov    %ebx,%eax
+  801ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cee:	5b                   	pop    %ebx
+  801cef:	5e                   	pop    %esi
+  801cf0:	5f                   	pop    %edi
+  801cf1:	5d                   	pop    %ebp
+  801cf2:	c3                   	ret
+  801cf3:	83 ec 08             	sub    $0x8,%esp
+  801cf6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801cf9:	50                   	push   %eax
+  801cfa:	ff 36                	push   (%esi)
+  801cfc:	e8 5d ff ff ff       	call   801c5e <dev_lookup>
+  801d01:	89 c3                	mov    %eax,%ebx
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 1a                	js     801d24 <fd_close+0x70>
+  801d0a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d0d:	8b 40 10             	mov    0x10(%eax),%eax
+  801d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	74 0b                	je     801d24 <fd_close+0x70>
+  801d19:	83 ec 0c             	sub    $0xc,%esp
+  801d1c:	56                   	push   %esi
+  801d1d:	ff d0                	call   *%eax
+  801d1f:	89 c3                	mov    %eax,%ebx
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	83 ec 08             	sub    $0x8,%esp
+  801d27:	56                   	push   %esi
+  801d28:	6a 00                	push   $0x0
+  801d2a:	e8 29 f6 ff ff       	call   801358 <sys_page_unmap>
+  801d2f:	83 c4 10             	add    $0x10,%esp
+  801d32:	eb b5                	jmp    801ce9 <fd_close+0x35>
+
+00801d34 <close>:
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	83 ec 20             	sub    $0x20,%esp
+  801d3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3d:	50                   	push   %eax
+  801d3e:	ff 75 08             	push   0x8(%ebp)
+  801d41:	e8 c8 fe ff ff       	call   801c0e <fd_lookup>
+  801d46:	83 c4 10             	add    $0x10,%esp
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	79 02                	jns    801d4f <close+0x1b>
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+  801d4f:	83 ec 08             	sub    $0x8,%esp
+  801d52:	6a 01                	push   $0x1
+  801d54:	ff 75 f4             	push   -0xc(%ebp)
+  801d57:	e8 58 ff ff ff       	call   801cb4 <fd_close>
+  801d5c:	83 c4 10             	add    $0x10,%esp
+  801d5f:	eb ec                	jmp    801d4d <close+0x19>
+
+00801d61 <close_all>:
+  801d61:	55                   	push   %ebp
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	53                   	push   %ebx
+  801d65:	83 ec 04             	sub    $0x4,%esp
+  801d68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6d:	83 ec 0c             	sub    $0xc,%esp
+  801d70:	53                   	push   %ebx
+  801d71:	e8 be ff ff ff       	call   801d34 <close>
+  801d76:	83 c3 01             	add    $0x1,%ebx
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	83 fb 20             	cmp    $0x20,%ebx
+  801d7f:	75 ec                	jne    801d6d <close_all+0xc>
+  801d81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d84:	c9                   	leave
+  801d85:	c3                   	ret
+
+00801d86 <dup>:
+  801d86:	55                   	push   %ebp
+  801d87:	89 e5                	mov    %esp,%ebp
+  801d89:	57                   	push   %edi
+  801d8a:	56                   	push   %esi
+  801d8b:	53                   	push   %ebx
+  801d8c:	83 ec 34             	sub    $0x34,%esp
+  801d8f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d92:	50                   	push   %eax
+  801d93:	ff 75 08             	push   0x8(%ebp)
+  801d96:	e8 73 fe ff ff       	call   801c0e <fd_lookup>
+  801d9b:	89 c3                	mov    %eax,%ebx
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 7f                	js     801e23 <dup+0x9d>
+  801da4:	83 ec 0c             	sub    $0xc,%esp
+  801da7:	ff 75 0c             	push   0xc(%ebp)
+  801daa:	e8 85 ff ff ff       	call   801d34 <close>
+  801daf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801db2:	c1 e6 0c             	shl    $0xc,%esi
+  801db5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801dbb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801dbe:	89 3c 24             	mov    %edi,(%esp)
+  801dc1:	e8 e1 fd ff ff       	call   801ba7 <fd2data>
+  801dc6:	89 c3                	mov    %eax,%ebx
+  801dc8:	89 34 24             	mov    %esi,(%esp)
+  801dcb:	e8 d7 fd ff ff       	call   801ba7 <fd2data>
+  801dd0:	83 c4 10             	add    $0x10,%esp
+  801dd3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dd6:	89 d8                	mov    %ebx,%eax
+  801dd8:	c1 e8 16             	shr    $0x16,%eax
+  801ddb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801de2:	a8 01                	test   $0x1,%al
+  801de4:	74 11                	je     801df7 <dup+0x71>
+  801de6:	89 d8                	mov    %ebx,%eax
+  801de8:	c1 e8 0c             	shr    $0xc,%eax
+  801deb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801df2:	f6 c2 01             	test   $0x1,%dl
+  801df5:	75 36                	jne    801e2d <dup+0xa7>
+  801df7:	89 f8                	mov    %edi,%eax
+  801df9:	c1 e8 0c             	shr    $0xc,%eax
+  801dfc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e03:	83 ec 0c             	sub    $0xc,%esp
+  801e06:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e0b:	50                   	push   %eax
+  801e0c:	56                   	push   %esi
+  801e0d:	6a 00                	push   $0x0
+  801e0f:	57                   	push   %edi
+  801e10:	6a 00                	push   $0x0
+  801e12:	e8 b2 f4 ff ff       	call   8012c9 <sys_page_map>
+  801e17:	89 c3                	mov    %eax,%ebx
+  801e19:	83 c4 20             	add    $0x20,%esp
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	78 33                	js     801e53 <dup+0xcd>
+  801e20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e23:	89 d8                	mov    %ebx,%eax
+  801e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e28:	5b                   	pop    %ebx
+  801e29:	5e                   	pop    %esi
+  801e2a:	5f                   	pop    %edi
+  801e2b:	5d                   	pop    %ebp
+  801e2c:	c3                   	ret
+  801e2d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e34:	83 ec 0c             	sub    $0xc,%esp
+  801e37:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e3c:	50                   	push   %eax
+  801e3d:	ff 75 d4             	push   -0x2c(%ebp)
+  801e40:	6a 00                	push   $0x0
+  801e42:	53                   	push   %ebx
+  801e43:	6a 00                	push   $0x0
+  801e45:	e8 7f f4 ff ff       	call   8012c9 <sys_page_map>
+  801e4a:	89 c3                	mov    %eax,%ebx
+  801e4c:	83 c4 20             	add    $0x20,%esp
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	79 a4                	jns    801df7 <dup+0x71>
+  801e53:	83 ec 08             	sub    $0x8,%esp
+  801e56:	56                   	push   %esi
+  801e57:	6a 00                	push   $0x0
+  801e59:	e8 fa f4 ff ff       	call   801358 <sys_page_unmap>
+  801e5e:	83 c4 08             	add    $0x8,%esp
+  801e61:	ff 75 d4             	push   -0x2c(%ebp)
+  801e64:	6a 00                	push   $0x0
+  801e66:	e8 ed f4 ff ff       	call   801358 <sys_page_unmap>
+  801e6b:	83 c4 10             	add    $0x10,%esp
+  801e6e:	eb b3                	jmp    801e23 <dup+0x9d>
+
+00801e70 <read>:
+  801e70:	55                   	push   %ebp
+  801e71:	89 e5                	mov    %esp,%ebp
+  801e73:	56                   	push   %esi
+  801e74:	53                   	push   %ebx
+  801e75:	83 ec 18             	sub    $0x18,%esp
+  801e78:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e7b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e7e:	50                   	push   %eax
+  801e7f:	56                   	push   %esi
+  801e80:	e8 89 fd ff ff       	call   801c0e <fd_lookup>
+  801e85:	83 c4 10             	add    $0x10,%esp
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 3c                	js     801ec8 <read+0x58>
+  801e8c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801e8f:	83 ec 08             	sub    $0x8,%esp
+  801e92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e95:	50                   	push   %eax
+  801e96:	ff 33                	push   (%ebx)
+  801e98:	e8 c1 fd ff ff       	call   801c5e <dev_lookup>
+  801e9d:	83 c4 10             	add    $0x10,%esp
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	78 24                	js     801ec8 <read+0x58>
+  801ea4:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ea7:	83 e0 03             	and    $0x3,%eax
+  801eaa:	83 f8 01             	cmp    $0x1,%eax
+  801ead:	74 20                	je     801ecf <read+0x5f>
+  801eaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb2:	8b 40 08             	mov    0x8(%eax),%eax
+  801eb5:	85 c0                	test   %eax,%eax
+  801eb7:	74 37                	je     801ef0 <read+0x80>
+  801eb9:	83 ec 04             	sub    $0x4,%esp
+  801ebc:	ff 75 10             	push   0x10(%ebp)
+  801ebf:	ff 75 0c             	push   0xc(%ebp)
+  801ec2:	53                   	push   %ebx
+  801ec3:	ff d0                	call   *%eax
+  801ec5:	83 c4 10             	add    $0x10,%esp
+  801ec8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ecb:	5b                   	pop    %ebx
+  801ecc:	5e                   	pop    %esi
+  801ecd:	5d                   	pop    %ebp
+  801ece:	c3                   	ret
+  801ecf:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  801ed4:	8b 40 48             	mov    0x48(%eax),%eax
+  801ed7:	83 ec 04             	sub    $0x4,%esp
+  801eda:	56                   	push   %esi
+  801edb:	50                   	push   %eax
+  801edc:	68 d1 3c 80 00       	push   $0x803cd1
+  801ee1:	e8 49 e8 ff ff       	call   80072f <cprintf>
+  801ee6:	83 c4 10             	add    $0x10,%esp
+  801ee9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eee:	eb d8                	jmp    801ec8 <read+0x58>
+  801ef0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef5:	eb d1                	jmp    801ec8 <read+0x58>
+
+00801ef7 <readn>:
+  801ef7:	55                   	push   %ebp
+  801ef8:	89 e5                	mov    %esp,%ebp
+  801efa:	57                   	push   %edi
+  801efb:	56                   	push   %esi
+  801efc:	53                   	push   %ebx
+  801efd:	83 ec 0c             	sub    $0xc,%esp
+  801f00:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f03:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f06:	85 f6                	test   %esi,%esi
+  801f08:	74 30                	je     801f3a <readn+0x43>
+  801f0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f14:	83 ec 04             	sub    $0x4,%esp
+  801f17:	89 f2                	mov    %esi,%edx
+  801f19:	29 c2                	sub    %eax,%edx
+  801f1b:	52                   	push   %edx
+  801f1c:	01 f8                	add    %edi,%eax
+  801f1e:	50                   	push   %eax
+  801f1f:	ff 75 08             	push   0x8(%ebp)
+  801f22:	e8 49 ff ff ff       	call   801e70 <read>
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	78 15                	js     801f43 <readn+0x4c>
+  801f2e:	74 11                	je     801f41 <readn+0x4a>
+  801f30:	01 c3                	add    %eax,%ebx
+  801f32:	89 d8                	mov    %ebx,%eax
+  801f34:	39 f3                	cmp    %esi,%ebx
+  801f36:	72 dc                	jb     801f14 <readn+0x1d>
+  801f38:	eb 09                	jmp    801f43 <readn+0x4c>
+  801f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3f:	eb 02                	jmp    801f43 <readn+0x4c>
+  801f41:	89 d8                	mov    %ebx,%eax
+  801f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f46:	5b                   	pop    %ebx
+  801f47:	5e                   	pop    %esi
+  801f48:	5f                   	pop    %edi
+  801f49:	5d                   	pop    %ebp
+  801f4a:	c3                   	ret
+
+00801f4b <write>:
+  801f4b:	55                   	push   %ebp
+  801f4c:	89 e5                	mov    %esp,%ebp
+  801f4e:	56                   	push   %esi
+  801f4f:	53                   	push   %ebx
+  801f50:	83 ec 18             	sub    $0x18,%esp
+  801f53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f56:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f59:	50                   	push   %eax
+  801f5a:	53                   	push   %ebx
+  801f5b:	e8 ae fc ff ff       	call   801c0e <fd_lookup>
+  801f60:	83 c4 10             	add    $0x10,%esp
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	78 37                	js     801f9e <write+0x53>
+  801f67:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f6a:	83 ec 08             	sub    $0x8,%esp
+  801f6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f70:	50                   	push   %eax
+  801f71:	ff 36                	push   (%esi)
+  801f73:	e8 e6 fc ff ff       	call   801c5e <dev_lookup>
+  801f78:	83 c4 10             	add    $0x10,%esp
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	78 1f                	js     801f9e <write+0x53>
+  801f7f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f83:	74 20                	je     801fa5 <write+0x5a>
+  801f85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f88:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f8b:	85 c0                	test   %eax,%eax
+  801f8d:	74 37                	je     801fc6 <write+0x7b>
+  801f8f:	83 ec 04             	sub    $0x4,%esp
+  801f92:	ff 75 10             	push   0x10(%ebp)
+  801f95:	ff 75 0c             	push   0xc(%ebp)
+  801f98:	56                   	push   %esi
+  801f99:	ff d0                	call   *%eax
+  801f9b:	83 c4 10             	add    $0x10,%esp
+  801f9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa1:	5b                   	pop    %ebx
+  801fa2:	5e                   	pop    %esi
+  801fa3:	5d                   	pop    %ebp
+  801fa4:	c3                   	ret
+  801fa5:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  801faa:	8b 40 48             	mov    0x48(%eax),%eax
+  801fad:	83 ec 04             	sub    $0x4,%esp
+  801fb0:	53                   	push   %ebx
+  801fb1:	50                   	push   %eax
+  801fb2:	68 ed 3c 80 00       	push   $0x803ced
+  801fb7:	e8 73 e7 ff ff       	call   80072f <cprintf>
+  801fbc:	83 c4 10             	add    $0x10,%esp
+  801fbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fc4:	eb d8                	jmp    801f9e <write+0x53>
+  801fc6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fcb:	eb d1                	jmp    801f9e <write+0x53>
+
+00801fcd <seek>:
+  801fcd:	55                   	push   %ebp
+  801fce:	89 e5                	mov    %esp,%ebp
+  801fd0:	83 ec 20             	sub    $0x20,%esp
+  801fd3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd6:	50                   	push   %eax
+  801fd7:	ff 75 08             	push   0x8(%ebp)
+  801fda:	e8 2f fc ff ff       	call   801c0e <fd_lookup>
+  801fdf:	83 c4 10             	add    $0x10,%esp
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	78 0e                	js     801ff4 <seek+0x27>
+  801fe6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fe9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fec:	89 50 04             	mov    %edx,0x4(%eax)
+  801fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff4:	c9                   	leave
+  801ff5:	c3                   	ret
+
+00801ff6 <ftruncate>:
+  801ff6:	55                   	push   %ebp
+  801ff7:	89 e5                	mov    %esp,%ebp
+  801ff9:	56                   	push   %esi
+  801ffa:	53                   	push   %ebx
+  801ffb:	83 ec 18             	sub    $0x18,%esp
+  801ffe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802001:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802004:	50                   	push   %eax
+  802005:	53                   	push   %ebx
+  802006:	e8 03 fc ff ff       	call   801c0e <fd_lookup>
+  80200b:	83 c4 10             	add    $0x10,%esp
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	78 34                	js     802046 <ftruncate+0x50>
+  802012:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802015:	83 ec 08             	sub    $0x8,%esp
+  802018:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80201b:	50                   	push   %eax
+  80201c:	ff 36                	push   (%esi)
+  80201e:	e8 3b fc ff ff       	call   801c5e <dev_lookup>
+  802023:	83 c4 10             	add    $0x10,%esp
+  802026:	85 c0                	test   %eax,%eax
+  802028:	78 1c                	js     802046 <ftruncate+0x50>
+  80202a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80202e:	74 1d                	je     80204d <ftruncate+0x57>
+  802030:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802033:	8b 40 18             	mov    0x18(%eax),%eax
+  802036:	85 c0                	test   %eax,%eax
+  802038:	74 34                	je     80206e <ftruncate+0x78>
+  80203a:	83 ec 08             	sub    $0x8,%esp
+  80203d:	ff 75 0c             	push   0xc(%ebp)
+  802040:	56                   	push   %esi
+  802041:	ff d0                	call   *%eax
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802049:	5b                   	pop    %ebx
+  80204a:	5e                   	pop    %esi
+  80204b:	5d                   	pop    %ebp
+  80204c:	c3                   	ret
+  80204d:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  802052:	8b 40 48             	mov    0x48(%eax),%eax
+  802055:	83 ec 04             	sub    $0x4,%esp
+  802058:	53                   	push   %ebx
+  802059:	50                   	push   %eax
+  80205a:	68 b0 3c 80 00       	push   $0x803cb0
+  80205f:	e8 cb e6 ff ff       	call   80072f <cprintf>
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80206c:	eb d8                	jmp    802046 <ftruncate+0x50>
+  80206e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802073:	eb d1                	jmp    802046 <ftruncate+0x50>
+
+00802075 <fstat>:
+  802075:	55                   	push   %ebp
+  802076:	89 e5                	mov    %esp,%ebp
+  802078:	56                   	push   %esi
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 18             	sub    $0x18,%esp
+  80207d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802080:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802083:	50                   	push   %eax
+  802084:	ff 75 08             	push   0x8(%ebp)
+  802087:	e8 82 fb ff ff       	call   801c0e <fd_lookup>
+  80208c:	83 c4 10             	add    $0x10,%esp
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	78 49                	js     8020dc <fstat+0x67>
+  802093:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802096:	83 ec 08             	sub    $0x8,%esp
+  802099:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80209c:	50                   	push   %eax
+  80209d:	ff 36                	push   (%esi)
+  80209f:	e8 ba fb ff ff       	call   801c5e <dev_lookup>
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 31                	js     8020dc <fstat+0x67>
+  8020ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ae:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020b2:	74 2f                	je     8020e3 <fstat+0x6e>
+  8020b4:	c6 03 00             	movb   $0x0,(%ebx)
+  8020b7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8020be:	00 00 00 
+  8020c1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020c8:	00 00 00 
+  8020cb:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8020d1:	83 ec 08             	sub    $0x8,%esp
+  8020d4:	53                   	push   %ebx
+  8020d5:	56                   	push   %esi
+  8020d6:	ff 50 14             	call   *0x14(%eax)
+  8020d9:	83 c4 10             	add    $0x10,%esp
+  8020dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020df:	5b                   	pop    %ebx
+  8020e0:	5e                   	pop    %esi
+  8020e1:	5d                   	pop    %ebp
+  8020e2:	c3                   	ret
+  8020e3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020e8:	eb f2                	jmp    8020dc <fstat+0x67>
+
+008020ea <stat>:
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	56                   	push   %esi
+  8020ee:	53                   	push   %ebx
+  8020ef:	83 ec 08             	sub    $0x8,%esp
+  8020f2:	6a 00                	push   $0x0
+  8020f4:	ff 75 08             	push   0x8(%ebp)
+  8020f7:	e8 31 05 00 00       	call   80262d <open>
+  8020fc:	89 c3                	mov    %eax,%ebx
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	85 c0                	test   %eax,%eax
+  802103:	78 1b                	js     802120 <stat+0x36>
+  802105:	83 ec 08             	sub    $0x8,%esp
+  802108:	ff 75 0c             	push   0xc(%ebp)
+  80210b:	50                   	push   %eax
+  80210c:	e8 64 ff ff ff       	call   802075 <fstat>
+  802111:	89 c6                	mov    %eax,%esi
+  802113:	89 1c 24             	mov    %ebx,(%esp)
+  802116:	e8 19 fc ff ff       	call   801d34 <close>
+  80211b:	83 c4 10             	add    $0x10,%esp
+  80211e:	89 f3                	mov    %esi,%ebx
+  802120:	89 d8                	mov    %ebx,%eax
+  802122:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802125:	5b                   	pop    %ebx
+  802126:	5e                   	pop    %esi
+  802127:	5d                   	pop    %ebp
+  802128:	c3                   	ret
+
+00802129 <fsipc>:
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	56                   	push   %esi
+  80212d:	53                   	push   %ebx
+  80212e:	89 c3                	mov    %eax,%ebx
+  802130:	89 d6                	mov    %edx,%esi
+  802132:	83 3d b4 50 80 00 00 	cmpl   $0x0,0x8050b4
+  802139:	74 20                	je     80215b <fsipc+0x32>
+  80213b:	83 ec 08             	sub    $0x8,%esp
+  80213e:	6a 00                	push   $0x0
+  802140:	56                   	push   %esi
+  802141:	6a 07                	push   $0x7
+  802143:	68 00 60 80 00       	push   $0x806000
+  802148:	53                   	push   %ebx
+  802149:	ff 35 b4 50 80 00    	push   0x8050b4
+  80214f:	e8 5a 12 00 00       	call   8033ae <ipc_call>
+  802154:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802157:	5b                   	pop    %ebx
+  802158:	5e                   	pop    %esi
+  802159:	5d                   	pop    %ebp
+  80215a:	c3                   	ret
+  80215b:	83 ec 0c             	sub    $0xc,%esp
+  80215e:	6a 02                	push   $0x2
+  802160:	e8 e4 13 00 00       	call   803549 <ipc_find_env>
+  802165:	a3 b4 50 80 00       	mov    %eax,0x8050b4
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	eb cc                	jmp    80213b <fsipc+0x12>
+
+0080216f <devfile_trunc>:
+  80216f:	55                   	push   %ebp
+  802170:	89 e5                	mov    %esp,%ebp
+  802172:	83 ec 08             	sub    $0x8,%esp
+  802175:	8b 45 08             	mov    0x8(%ebp),%eax
+  802178:	8b 40 0c             	mov    0xc(%eax),%eax
+  80217b:	a3 00 60 80 00       	mov    %eax,0x806000
+  802180:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802183:	a3 04 60 80 00       	mov    %eax,0x806004
+  802188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802192:	e8 92 ff ff ff       	call   802129 <fsipc>
+  802197:	c9                   	leave
+  802198:	c3                   	ret
+
+00802199 <devfile_flush>:
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	83 ec 08             	sub    $0x8,%esp
+  80219f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021a5:	a3 00 60 80 00       	mov    %eax,0x806000
+  8021aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021b4:	e8 70 ff ff ff       	call   802129 <fsipc>
+  8021b9:	c9                   	leave
+  8021ba:	c3                   	ret
+
+008021bb <devfile_stat>:
+  8021bb:	55                   	push   %ebp
+  8021bc:	89 e5                	mov    %esp,%ebp
+  8021be:	53                   	push   %ebx
+  8021bf:	83 ec 04             	sub    $0x4,%esp
+  8021c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021cb:	a3 00 60 80 00       	mov    %eax,0x806000
+  8021d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021da:	e8 4a ff ff ff       	call   802129 <fsipc>
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	78 2c                	js     80220f <devfile_stat+0x54>
+  8021e3:	83 ec 08             	sub    $0x8,%esp
+  8021e6:	68 00 60 80 00       	push   $0x806000
+  8021eb:	53                   	push   %ebx
+  8021ec:	e8 35 ec ff ff       	call   800e26 <strcpy>
+  8021f1:	a1 80 60 80 00       	mov    0x806080,%eax
+  8021f6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8021fc:	a1 84 60 80 00       	mov    0x806084,%eax
+  802201:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802207:	83 c4 10             	add    $0x10,%esp
+  80220a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802212:	c9                   	leave
+  802213:	c3                   	ret
+
+00802214 <fsring_rw>:
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	57                   	push   %edi
+  802218:	56                   	push   %esi
+  802219:	53                   	push   %ebx
+  80221a:	83 ec 2c             	sub    $0x2c,%esp
+  80221d:	89 c7                	mov    %eax,%edi
+  80221f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802222:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802225:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80222a:	a8 01                	test   $0x1,%al
+  80222c:	74 0d                	je     80223b <fsring_rw+0x27>
+  80222e:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802233:	a8 01                	test   $0x1,%al
+  802235:	0f 85 d5 00 00 00    	jne    802310 <fsring_rw+0xfc>
+  80223b:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  802240:	8b 40 48             	mov    0x48(%eax),%eax
+  802243:	3b 05 b0 50 80 00    	cmp    0x8050b0,%eax
+  802249:	0f 84 fc 00 00 00    	je     80234b <fsring_rw+0x137>
+  80224f:	83 3d b4 50 80 00 00 	cmpl   $0x0,0x8050b4
+  802256:	0f 84 02 01 00 00    	je     80235e <fsring_rw+0x14a>
+  80225c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802261:	83 ec 04             	sub    $0x4,%esp
+  802264:	68 07 02 00 00       	push   $0x207
+  802269:	53                   	push   %ebx
+  80226a:	6a 00                	push   $0x0
+  80226c:	e8 15 f0 ff ff       	call   801286 <sys_page_alloc>
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	85 c0                	test   %eax,%eax
+  802276:	0f 88 f9 00 00 00    	js     802375 <fsring_rw+0x161>
+  80227c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802282:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802288:	75 d7                	jne    802261 <fsring_rw+0x4d>
+  80228a:	6a 0e                	push   $0xe
+  80228c:	6a 0d                	push   $0xd
+  80228e:	ff 35 b4 50 80 00    	push   0x8050b4
+  802294:	68 00 00 f0 cf       	push   $0xcff00000
+  802299:	e8 c4 0c 00 00       	call   802f62 <ipcring_init>
+  80229e:	83 c4 08             	add    $0x8,%esp
+  8022a1:	6a 00                	push   $0x0
+  8022a3:	6a 00                	push   $0x0
+  8022a5:	68 07 02 00 00       	push   $0x207
+  8022aa:	68 00 00 f0 cf       	push   $0xcff00000
+  8022af:	6a 0b                	push   $0xb
+  8022b1:	ff 35 b4 50 80 00    	push   0x8050b4
+  8022b7:	e8 f2 10 00 00       	call   8033ae <ipc_call>
+  8022bc:	89 c6                	mov    %eax,%esi
+  8022be:	83 c4 20             	add    $0x20,%esp
+  8022c1:	85 c0                	test   %eax,%eax
+  8022c3:	0f 88 ac 00 00 00    	js     802375 <fsring_rw+0x161>
+  8022c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022ce:	89 d9                	mov    %ebx,%ecx
+  8022d0:	83 c3 01             	add    $0x1,%ebx
+  8022d3:	89 da                	mov    %ebx,%edx
+  8022d5:	c1 e2 0c             	shl    $0xc,%edx
+  8022d8:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8022de:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8022e4:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8022ea:	83 ec 08             	sub    $0x8,%esp
+  8022ed:	6a 00                	push   $0x0
+  8022ef:	6a 00                	push   $0x0
+  8022f1:	68 07 02 00 00       	push   $0x207
+  8022f6:	50                   	push   %eax
+  8022f7:	6a 0c                	push   $0xc
+  8022f9:	ff 35 b4 50 80 00    	push   0x8050b4
+  8022ff:	e8 aa 10 00 00       	call   8033ae <ipc_call>
+  802304:	83 c4 20             	add    $0x20,%esp
+  802307:	85 c0                	test   %eax,%eax
+  802309:	78 6a                	js     802375 <fsring_rw+0x161>
+  80230b:	83 fb 08             	cmp    $0x8,%ebx
+  80230e:	75 be                	jne    8022ce <fsring_rw+0xba>
+  802310:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802314:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802319:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80231e:	0f 45 c2             	cmovne %edx,%eax
+  802321:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802324:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80232b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802332:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802339:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233e:	be 00 00 00 00       	mov    $0x0,%esi
+  802343:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802346:	e9 4b 01 00 00       	jmp    802496 <fsring_rw+0x282>
+  80234b:	e8 00 f3 ff ff       	call   801650 <sys_time_msec>
+  802350:	3b 05 ac 50 80 00    	cmp    0x8050ac,%eax
+  802356:	0f 89 f3 fe ff ff    	jns    80224f <fsring_rw+0x3b>
+  80235c:	eb 54                	jmp    8023b2 <fsring_rw+0x19e>
+  80235e:	83 ec 0c             	sub    $0xc,%esp
+  802361:	6a 02                	push   $0x2
+  802363:	e8 e1 11 00 00       	call   803549 <ipc_find_env>
+  802368:	a3 b4 50 80 00       	mov    %eax,0x8050b4
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	e9 e7 fe ff ff       	jmp    80225c <fsring_rw+0x48>
+  802375:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80237a:	83 ec 08             	sub    $0x8,%esp
+  80237d:	53                   	push   %ebx
+  80237e:	6a 00                	push   $0x0
+  802380:	e8 d3 ef ff ff       	call   801358 <sys_page_unmap>
+  802385:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80238b:	83 c4 10             	add    $0x10,%esp
+  80238e:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802394:	75 e4                	jne    80237a <fsring_rw+0x166>
+  802396:	e8 b5 f2 ff ff       	call   801650 <sys_time_msec>
+  80239b:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8023a0:	a3 ac 50 80 00       	mov    %eax,0x8050ac
+  8023a5:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  8023aa:	8b 40 48             	mov    0x48(%eax),%eax
+  8023ad:	a3 b0 50 80 00       	mov    %eax,0x8050b0
+  8023b2:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8023b9:	e9 7a 01 00 00       	jmp    802538 <fsring_rw+0x324>
+  8023be:	8b 57 0c             	mov    0xc(%edi),%edx
+  8023c1:	89 10                	mov    %edx,(%eax)
+  8023c3:	89 58 04             	mov    %ebx,0x4(%eax)
+  8023c6:	89 f2                	mov    %esi,%edx
+  8023c8:	03 57 04             	add    0x4(%edi),%edx
+  8023cb:	89 50 08             	mov    %edx,0x8(%eax)
+  8023ce:	83 ec 04             	sub    $0x4,%esp
+  8023d1:	53                   	push   %ebx
+  8023d2:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8023d5:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8023d8:	52                   	push   %edx
+  8023d9:	83 c0 0c             	add    $0xc,%eax
+  8023dc:	50                   	push   %eax
+  8023dd:	e8 f4 eb ff ff       	call   800fd6 <memmove>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+  8023e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023e8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023eb:	89 08                	mov    %ecx,(%eax)
+  8023ed:	83 ec 0c             	sub    $0xc,%esp
+  8023f0:	68 00 00 f0 cf       	push   $0xcff00000
+  8023f5:	e8 c6 0b 00 00       	call   802fc0 <ipcring_req_push>
+  8023fa:	01 de                	add    %ebx,%esi
+  8023fc:	83 c4 10             	add    $0x10,%esp
+  8023ff:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802402:	73 4c                	jae    802450 <fsring_rw+0x23c>
+  802404:	83 ec 0c             	sub    $0xc,%esp
+  802407:	68 00 00 f0 cf       	push   $0xcff00000
+  80240c:	e8 89 0b 00 00       	call   802f9a <ipcring_req_slot>
+  802411:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802414:	83 c4 10             	add    $0x10,%esp
+  802417:	85 c0                	test   %eax,%eax
+  802419:	74 35                	je     802450 <fsring_rw+0x23c>
+  80241b:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802420:	83 e0 07             	and    $0x7,%eax
+  802423:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802428:	c1 e0 0c             	shl    $0xc,%eax
+  80242b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80242e:	29 f3                	sub    %esi,%ebx
+  802430:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802433:	39 cb                	cmp    %ecx,%ebx
+  802435:	0f 47 d9             	cmova  %ecx,%ebx
+  802438:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80243c:	75 80                	jne    8023be <fsring_rw+0x1aa>
+  80243e:	8b 57 0c             	mov    0xc(%edi),%edx
+  802441:	89 10                	mov    %edx,(%eax)
+  802443:	89 58 04             	mov    %ebx,0x4(%eax)
+  802446:	89 f2                	mov    %esi,%edx
+  802448:	03 57 04             	add    0x4(%edi),%edx
+  80244b:	89 50 08             	mov    %edx,0x8(%eax)
+  80244e:	eb 95                	jmp    8023e5 <fsring_rw+0x1d1>
+  802450:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802455:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802458:	83 ec 0c             	sub    $0xc,%esp
+  80245b:	68 00 00 f0 cf       	push   $0xcff00000
+  802460:	e8 94 0b 00 00       	call   802ff9 <ipcring_rsp_wait>
+  802465:	8b 58 04             	mov    0x4(%eax),%ebx
+  802468:	83 c4 10             	add    $0x10,%esp
+  80246b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80246f:	75 45                	jne    8024b6 <fsring_rw+0x2a2>
+  802471:	85 db                	test   %ebx,%ebx
+  802473:	79 41                	jns    8024b6 <fsring_rw+0x2a2>
+  802475:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802478:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80247f:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802486:	83 ec 0c             	sub    $0xc,%esp
+  802489:	68 00 00 f0 cf       	push   $0xcff00000
+  80248e:	e8 cc 0b 00 00       	call   80305f <ipcring_rsp_pop>
+  802493:	83 c4 10             	add    $0x10,%esp
+  802496:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80249c:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8024a1:	39 c2                	cmp    %eax,%edx
+  8024a3:	74 75                	je     80251a <fsring_rw+0x306>
+  8024a5:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8024a9:	75 a5                	jne    802450 <fsring_rw+0x23c>
+  8024ab:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8024ae:	0f 82 50 ff ff ff    	jb     802404 <fsring_rw+0x1f0>
+  8024b4:	eb 9a                	jmp    802450 <fsring_rw+0x23c>
+  8024b6:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8024ba:	75 ca                	jne    802486 <fsring_rw+0x272>
+  8024bc:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8024c0:	74 31                	je     8024f3 <fsring_rw+0x2df>
+  8024c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c5:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8024c8:	29 c8                	sub    %ecx,%eax
+  8024ca:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8024cd:	39 d0                	cmp    %edx,%eax
+  8024cf:	0f 47 c2             	cmova  %edx,%eax
+  8024d2:	39 d8                	cmp    %ebx,%eax
+  8024d4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8024d9:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8024dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8024e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024e5:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8024e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024ec:	01 d9                	add    %ebx,%ecx
+  8024ee:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8024f1:	eb 93                	jmp    802486 <fsring_rw+0x272>
+  8024f3:	83 ec 04             	sub    $0x4,%esp
+  8024f6:	53                   	push   %ebx
+  8024f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024fa:	83 e0 07             	and    $0x7,%eax
+  8024fd:	c1 e0 0c             	shl    $0xc,%eax
+  802500:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802506:	50                   	push   %eax
+  802507:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80250a:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80250d:	01 c8                	add    %ecx,%eax
+  80250f:	50                   	push   %eax
+  802510:	e8 c1 ea ff ff       	call   800fd6 <memmove>
+  802515:	83 c4 10             	add    $0x10,%esp
+  802518:	eb a8                	jmp    8024c2 <fsring_rw+0x2ae>
+  80251a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80251e:	75 09                	jne    802529 <fsring_rw+0x315>
+  802520:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802523:	0f 82 db fe ff ff    	jb     802404 <fsring_rw+0x1f0>
+  802529:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80252c:	01 57 04             	add    %edx,0x4(%edi)
+  80252f:	85 d2                	test   %edx,%edx
+  802531:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802535:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802538:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80253b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80253e:	5b                   	pop    %ebx
+  80253f:	5e                   	pop    %esi
+  802540:	5f                   	pop    %edi
+  802541:	5d                   	pop    %ebp
+  802542:	c3                   	ret
+
+00802543 <devfile_write>:
+  802543:	55                   	push   %ebp
+  802544:	89 e5                	mov    %esp,%ebp
+  802546:	57                   	push   %edi
+  802547:	56                   	push   %esi
+  802548:	53                   	push   %ebx
+  802549:	83 ec 0c             	sub    $0xc,%esp
+  80254c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80254f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802552:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802555:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80255b:	76 1a                	jbe    802577 <devfile_write+0x34>
+  80255d:	83 ec 0c             	sub    $0xc,%esp
+  802560:	53                   	push   %ebx
+  802561:	89 f1                	mov    %esi,%ecx
+  802563:	ba 06 00 00 00       	mov    $0x6,%edx
+  802568:	89 f8                	mov    %edi,%eax
+  80256a:	e8 a5 fc ff ff       	call   802214 <fsring_rw>
+  80256f:	83 c4 10             	add    $0x10,%esp
+  802572:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802575:	75 39                	jne    8025b0 <devfile_write+0x6d>
+  802577:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80257c:	39 c3                	cmp    %eax,%ebx
+  80257e:	0f 47 d8             	cmova  %eax,%ebx
+  802581:	8b 47 0c             	mov    0xc(%edi),%eax
+  802584:	a3 00 60 80 00       	mov    %eax,0x806000
+  802589:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80258f:	83 ec 04             	sub    $0x4,%esp
+  802592:	53                   	push   %ebx
+  802593:	56                   	push   %esi
+  802594:	68 08 60 80 00       	push   $0x806008
+  802599:	e8 38 ea ff ff       	call   800fd6 <memmove>
+  80259e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025a8:	e8 7c fb ff ff       	call   802129 <fsipc>
+  8025ad:	83 c4 10             	add    $0x10,%esp
+  8025b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b3:	5b                   	pop    %ebx
+  8025b4:	5e                   	pop    %esi
+  8025b5:	5f                   	pop    %edi
+  8025b6:	5d                   	pop    %ebp
+  8025b7:	c3                   	ret
+
+008025b8 <devfile_read>:
+  8025b8:	55                   	push   %ebp
+  8025b9:	89 e5                	mov    %esp,%ebp
+  8025bb:	57                   	push   %edi
+  8025bc:	56                   	push   %esi
+  8025bd:	53                   	push   %ebx
+  8025be:	83 ec 0c             	sub    $0xc,%esp
+  8025c1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025c4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8025c7:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8025cd:	76 1d                	jbe    8025ec <devfile_read+0x34>
+  8025cf:	83 ec 0c             	sub    $0xc,%esp
+  8025d2:	56                   	push   %esi
+  8025d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025d6:	ba 05 00 00 00       	mov    $0x5,%edx
+  8025db:	89 f8                	mov    %edi,%eax
+  8025dd:	e8 32 fc ff ff       	call   802214 <fsring_rw>
+  8025e2:	89 c3                	mov    %eax,%ebx
+  8025e4:	83 c4 10             	add    $0x10,%esp
+  8025e7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8025ea:	75 37                	jne    802623 <devfile_read+0x6b>
+  8025ec:	8b 47 0c             	mov    0xc(%edi),%eax
+  8025ef:	a3 00 60 80 00       	mov    %eax,0x806000
+  8025f4:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8025fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ff:	b8 03 00 00 00       	mov    $0x3,%eax
+  802604:	e8 20 fb ff ff       	call   802129 <fsipc>
+  802609:	89 c3                	mov    %eax,%ebx
+  80260b:	85 c0                	test   %eax,%eax
+  80260d:	78 14                	js     802623 <devfile_read+0x6b>
+  80260f:	83 ec 04             	sub    $0x4,%esp
+  802612:	50                   	push   %eax
+  802613:	68 00 60 80 00       	push   $0x806000
+  802618:	ff 75 0c             	push   0xc(%ebp)
+  80261b:	e8 b6 e9 ff ff       	call   800fd6 <memmove>
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	89 d8                	mov    %ebx,%eax
+  802625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802628:	5b                   	pop    %ebx
+  802629:	5e                   	pop    %esi
+  80262a:	5f                   	pop    %edi
+  80262b:	5d                   	pop    %ebp
+  80262c:	c3                   	ret
+
+0080262d <open>:
+  80262d:	55                   	push   %ebp
+  80262e:	89 e5                	mov    %esp,%ebp
+  802630:	56                   	push   %esi
+  802631:	53                   	push   %ebx
+  802632:	83 ec 1c             	sub    $0x1c,%esp
+  802635:	8b 75 08             	mov    0x8(%ebp),%esi
+  802638:	56                   	push   %esi
+  802639:	e8 9c e7 ff ff       	call   800dda <strlen>
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802646:	7f 6c                	jg     8026b4 <open+0x87>
+  802648:	83 ec 0c             	sub    $0xc,%esp
+  80264b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80264e:	50                   	push   %eax
+  80264f:	e8 6a f5 ff ff       	call   801bbe <fd_alloc>
+  802654:	89 c3                	mov    %eax,%ebx
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	85 c0                	test   %eax,%eax
+  80265b:	78 3c                	js     802699 <open+0x6c>
+  80265d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802660:	a3 00 64 80 00       	mov    %eax,0x806400
+  802665:	83 ec 08             	sub    $0x8,%esp
+  802668:	56                   	push   %esi
+  802669:	68 00 60 80 00       	push   $0x806000
+  80266e:	e8 b3 e7 ff ff       	call   800e26 <strcpy>
+  802673:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802676:	b8 01 00 00 00       	mov    $0x1,%eax
+  80267b:	e8 a9 fa ff ff       	call   802129 <fsipc>
+  802680:	89 c3                	mov    %eax,%ebx
+  802682:	83 c4 10             	add    $0x10,%esp
+  802685:	85 c0                	test   %eax,%eax
+  802687:	78 19                	js     8026a2 <open+0x75>
+  802689:	83 ec 0c             	sub    $0xc,%esp
+  80268c:	ff 75 f4             	push   -0xc(%ebp)
+  80268f:	e8 03 f5 ff ff       	call   801b97 <fd2num>
+  802694:	89 c3                	mov    %eax,%ebx
+  802696:	83 c4 10             	add    $0x10,%esp
+  802699:	89 d8                	mov    %ebx,%eax
+  80269b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80269e:	5b                   	pop    %ebx
+  80269f:	5e                   	pop    %esi
+  8026a0:	5d                   	pop    %ebp
+  8026a1:	c3                   	ret
+  8026a2:	83 ec 08             	sub    $0x8,%esp
+  8026a5:	6a 00                	push   $0x0
+  8026a7:	ff 75 f4             	push   -0xc(%ebp)
+  8026aa:	e8 05 f6 ff ff       	call   801cb4 <fd_close>
+  8026af:	83 c4 10             	add    $0x10,%esp
+  8026b2:	eb e5                	jmp    802699 <open+0x6c>
+  8026b4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8026b9:	eb de                	jmp    802699 <open+0x6c>
+
+008026bb <file_image>:
+  8026bb:	55                   	push   %ebp
+  8026bc:	89 e5                	mov    %esp,%ebp
+  8026be:	53                   	push   %ebx
+  8026bf:	83 ec 1c             	sub    $0x1c,%esp
+  8026c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c8:	50                   	push   %eax
+  8026c9:	ff 75 08             	push   0x8(%ebp)
+  8026cc:	e8 3d f5 ff ff       	call   801c0e <fd_lookup>
+  8026d1:	83 c4 10             	add    $0x10,%esp
+  8026d4:	85 c0                	test   %eax,%eax
+  8026d6:	78 58                	js     802730 <file_image+0x75>
+  8026d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026db:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8026e1:	39 08                	cmp    %ecx,(%eax)
+  8026e3:	75 50                	jne    802735 <file_image+0x7a>
+  8026e5:	83 fb 04             	cmp    $0x4,%ebx
+  8026e8:	77 52                	ja     80273c <file_image+0x81>
+  8026ea:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026ed:	a3 00 60 80 00       	mov    %eax,0x806000
+  8026f2:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8026f8:	83 ec 04             	sub    $0x4,%esp
+  8026fb:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8026fe:	c1 e0 02             	shl    $0x2,%eax
+  802701:	50                   	push   %eax
+  802702:	ff 75 0c             	push   0xc(%ebp)
+  802705:	68 08 60 80 00       	push   $0x806008
+  80270a:	e8 c7 e8 ff ff       	call   800fd6 <memmove>
+  80270f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802714:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802719:	e8 0b fa ff ff       	call   802129 <fsipc>
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	78 0b                	js     802730 <file_image+0x75>
+  802725:	8b 55 14             	mov    0x14(%ebp),%edx
+  802728:	8b 0d b4 50 80 00    	mov    0x8050b4,%ecx
+  80272e:	89 0a                	mov    %ecx,(%edx)
+  802730:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802733:	c9                   	leave
+  802734:	c3                   	ret
+  802735:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80273a:	eb f4                	jmp    802730 <file_image+0x75>
+  80273c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802741:	eb ed                	jmp    802730 <file_image+0x75>
+
+00802743 <remove>:
+  802743:	55                   	push   %ebp
+  802744:	89 e5                	mov    %esp,%ebp
+  802746:	53                   	push   %ebx
+  802747:	83 ec 10             	sub    $0x10,%esp
+  80274a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80274d:	53                   	push   %ebx
+  80274e:	e8 87 e6 ff ff       	call   800dda <strlen>
+  802753:	83 c4 10             	add    $0x10,%esp
+  802756:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80275b:	7f 25                	jg     802782 <remove+0x3f>
+  80275d:	83 ec 08             	sub    $0x8,%esp
+  802760:	53                   	push   %ebx
+  802761:	68 00 60 80 00       	push   $0x806000
+  802766:	e8 bb e6 ff ff       	call   800e26 <strcpy>
+  80276b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802770:	b8 09 00 00 00       	mov    $0x9,%eax
+  802775:	e8 af f9 ff ff       	call   802129 <fsipc>
+  80277a:	83 c4 10             	add    $0x10,%esp
+  80277d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802780:	c9                   	leave
+  802781:	c3                   	ret
+  802782:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802787:	eb f4                	jmp    80277d <remove+0x3a>
+
+00802789 <sync>:
+  802789:	55                   	push   %ebp
+  80278a:	89 e5                	mov    %esp,%ebp
+  80278c:	83 ec 08             	sub    $0x8,%esp
+  80278f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802794:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802799:	e8 8b f9 ff ff       	call   802129 <fsipc>
+  80279e:	c9                   	leave
+  80279f:	c3                   	ret
+
+008027a0 <devsock_stat>:
+  8027a0:	55                   	push   %ebp
+  8027a1:	89 e5                	mov    %esp,%ebp
+  8027a3:	83 ec 10             	sub    $0x10,%esp
+  8027a6:	68 20 3d 80 00       	push   $0x803d20
+  8027ab:	ff 75 0c             	push   0xc(%ebp)
+  8027ae:	e8 73 e6 ff ff       	call   800e26 <strcpy>
+  8027b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b8:	c9                   	leave
+  8027b9:	c3                   	ret
+
+008027ba <devsock_close>:
+  8027ba:	55                   	push   %ebp
+  8027bb:	89 e5                	mov    %esp,%ebp
+  8027bd:	53                   	push   %ebx
+  8027be:	83 ec 10             	sub    $0x10,%esp
+  8027c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027c4:	53                   	push   %ebx
+  8027c5:	e8 99 0d 00 00       	call   803563 <pageref>
+  8027ca:	89 c2                	mov    %eax,%edx
+  8027cc:	83 c4 10             	add    $0x10,%esp
+  8027cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d4:	83 fa 01             	cmp    $0x1,%edx
+  8027d7:	74 05                	je     8027de <devsock_close+0x24>
+  8027d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027dc:	c9                   	leave
+  8027dd:	c3                   	ret
+  8027de:	83 ec 0c             	sub    $0xc,%esp
+  8027e1:	ff 73 0c             	push   0xc(%ebx)
+  8027e4:	e8 aa 02 00 00       	call   802a93 <nsipc_close>
+  8027e9:	83 c4 10             	add    $0x10,%esp
+  8027ec:	eb eb                	jmp    8027d9 <devsock_close+0x1f>
+
+008027ee <devsock_write>:
+  8027ee:	55                   	push   %ebp
+  8027ef:	89 e5                	mov    %esp,%ebp
+  8027f1:	83 ec 08             	sub    $0x8,%esp
+  8027f4:	6a 00                	push   $0x0
+  8027f6:	ff 75 10             	push   0x10(%ebp)
+  8027f9:	ff 75 0c             	push   0xc(%ebp)
+  8027fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ff:	ff 70 0c             	push   0xc(%eax)
+  802802:	e8 6c 03 00 00       	call   802b73 <nsipc_send>
+  802807:	c9                   	leave
+  802808:	c3                   	ret
+
+00802809 <devsock_read>:
+  802809:	55                   	push   %ebp
+  80280a:	89 e5                	mov    %esp,%ebp
+  80280c:	83 ec 08             	sub    $0x8,%esp
+  80280f:	6a 00                	push   $0x0
+  802811:	ff 75 10             	push   0x10(%ebp)
+  802814:	ff 75 0c             	push   0xc(%ebp)
+  802817:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281a:	ff 70 0c             	push   0xc(%eax)
+  80281d:	e8 e2 02 00 00       	call   802b04 <nsipc_recv>
+  802822:	c9                   	leave
+  802823:	c3                   	ret
+
+00802824 <fd2sockid>:
+  802824:	55                   	push   %ebp
+  802825:	89 e5                	mov    %esp,%ebp
+  802827:	83 ec 20             	sub    $0x20,%esp
+  80282a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80282d:	52                   	push   %edx
+  80282e:	50                   	push   %eax
+  80282f:	e8 da f3 ff ff       	call   801c0e <fd_lookup>
+  802834:	83 c4 10             	add    $0x10,%esp
+  802837:	85 c0                	test   %eax,%eax
+  802839:	78 10                	js     80284b <fd2sockid+0x27>
+  80283b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80283e:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802844:	39 08                	cmp    %ecx,(%eax)
+  802846:	75 05                	jne    80284d <fd2sockid+0x29>
+  802848:	8b 40 0c             	mov    0xc(%eax),%eax
+  80284b:	c9                   	leave
+  80284c:	c3                   	ret
+  80284d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802852:	eb f7                	jmp    80284b <fd2sockid+0x27>
+
+00802854 <alloc_sockfd>:
+  802854:	55                   	push   %ebp
+  802855:	89 e5                	mov    %esp,%ebp
+  802857:	56                   	push   %esi
+  802858:	53                   	push   %ebx
+  802859:	83 ec 1c             	sub    $0x1c,%esp
+  80285c:	89 c6                	mov    %eax,%esi
+  80285e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802861:	50                   	push   %eax
+  802862:	e8 57 f3 ff ff       	call   801bbe <fd_alloc>
+  802867:	89 c3                	mov    %eax,%ebx
+  802869:	83 c4 10             	add    $0x10,%esp
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	78 43                	js     8028b3 <alloc_sockfd+0x5f>
+  802870:	83 ec 04             	sub    $0x4,%esp
+  802873:	68 07 04 00 00       	push   $0x407
+  802878:	ff 75 f4             	push   -0xc(%ebp)
+  80287b:	6a 00                	push   $0x0
+  80287d:	e8 04 ea ff ff       	call   801286 <sys_page_alloc>
+  802882:	89 c3                	mov    %eax,%ebx
+  802884:	83 c4 10             	add    $0x10,%esp
+  802887:	85 c0                	test   %eax,%eax
+  802889:	78 28                	js     8028b3 <alloc_sockfd+0x5f>
+  80288b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80288e:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802894:	89 10                	mov    %edx,(%eax)
+  802896:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802899:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8028a0:	89 70 0c             	mov    %esi,0xc(%eax)
+  8028a3:	83 ec 0c             	sub    $0xc,%esp
+  8028a6:	50                   	push   %eax
+  8028a7:	e8 eb f2 ff ff       	call   801b97 <fd2num>
+  8028ac:	89 c3                	mov    %eax,%ebx
+  8028ae:	83 c4 10             	add    $0x10,%esp
+  8028b1:	eb 0c                	jmp    8028bf <alloc_sockfd+0x6b>
+  8028b3:	83 ec 0c             	sub    $0xc,%esp
+  8028b6:	56                   	push   %esi
+  8028b7:	e8 d7 01 00 00       	call   802a93 <nsipc_close>
+  8028bc:	83 c4 10             	add    $0x10,%esp
+  8028bf:	89 d8                	mov    %ebx,%eax
+  8028c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c4:	5b                   	pop    %ebx
+  8028c5:	5e                   	pop    %esi
+  8028c6:	5d                   	pop    %ebp
+  8028c7:	c3                   	ret
+
+008028c8 <accept>:
+  8028c8:	55                   	push   %ebp
+  8028c9:	89 e5                	mov    %esp,%ebp
+  8028cb:	83 ec 08             	sub    $0x8,%esp
+  8028ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d1:	e8 4e ff ff ff       	call   802824 <fd2sockid>
+  8028d6:	85 c0                	test   %eax,%eax
+  8028d8:	78 1b                	js     8028f5 <accept+0x2d>
+  8028da:	83 ec 04             	sub    $0x4,%esp
+  8028dd:	ff 75 10             	push   0x10(%ebp)
+  8028e0:	ff 75 0c             	push   0xc(%ebp)
+  8028e3:	50                   	push   %eax
+  8028e4:	e8 07 01 00 00       	call   8029f0 <nsipc_accept>
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	78 05                	js     8028f5 <accept+0x2d>
+  8028f0:	e8 5f ff ff ff       	call   802854 <alloc_sockfd>
+  8028f5:	c9                   	leave
+  8028f6:	c3                   	ret
+
+008028f7 <bind>:
+  8028f7:	55                   	push   %ebp
+  8028f8:	89 e5                	mov    %esp,%ebp
+  8028fa:	83 ec 08             	sub    $0x8,%esp
+  8028fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802900:	e8 1f ff ff ff       	call   802824 <fd2sockid>
+  802905:	85 c0                	test   %eax,%eax
+  802907:	78 12                	js     80291b <bind+0x24>
+  802909:	83 ec 04             	sub    $0x4,%esp
+  80290c:	ff 75 10             	push   0x10(%ebp)
+  80290f:	ff 75 0c             	push   0xc(%ebp)
+  802912:	50                   	push   %eax
+  802913:	e8 24 01 00 00       	call   802a3c <nsipc_bind>
+  802918:	83 c4 10             	add    $0x10,%esp
+  80291b:	c9                   	leave
+  80291c:	c3                   	ret
+
+0080291d <shutdown>:
+  80291d:	55                   	push   %ebp
+  80291e:	89 e5                	mov    %esp,%ebp
+  802920:	83 ec 08             	sub    $0x8,%esp
+  802923:	8b 45 08             	mov    0x8(%ebp),%eax
+  802926:	e8 f9 fe ff ff       	call   802824 <fd2sockid>
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	78 0f                	js     80293e <shutdown+0x21>
+  80292f:	83 ec 08             	sub    $0x8,%esp
+  802932:	ff 75 0c             	push   0xc(%ebp)
+  802935:	50                   	push   %eax
+  802936:	e8 36 01 00 00       	call   802a71 <nsipc_shutdown>
+  80293b:	83 c4 10             	add    $0x10,%esp
+  80293e:	c9                   	leave
+  80293f:	c3                   	ret
+
+00802940 <connect>:
+  802940:	55                   	push   %ebp
+  802941:	89 e5                	mov    %esp,%ebp
+  802943:	83 ec 08             	sub    $0x8,%esp
+  802946:	8b 45 08             	mov    0x8(%ebp),%eax
+  802949:	e8 d6 fe ff ff       	call   802824 <fd2sockid>
+  80294e:	85 c0                	test   %eax,%eax
+  802950:	78 12                	js     802964 <connect+0x24>
+  802952:	83 ec 04             	sub    $0x4,%esp
+  802955:	ff 75 10             	push   0x10(%ebp)
+  802958:	ff 75 0c             	push   0xc(%ebp)
+  80295b:	50                   	push   %eax
+  80295c:	e8 4c 01 00 00       	call   802aad <nsipc_connect>
+  802961:	83 c4 10             	add    $0x10,%esp
+  802964:	c9                   	leave
+  802965:	c3                   	ret
+
+00802966 <listen>:
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	83 ec 08             	sub    $0x8,%esp
+  80296c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296f:	e8 b0 fe ff ff       	call   802824 <fd2sockid>
+  802974:	85 c0                	test   %eax,%eax
+  802976:	78 0f                	js     802987 <listen+0x21>
+  802978:	83 ec 08             	sub    $0x8,%esp
+  80297b:	ff 75 0c             	push   0xc(%ebp)
+  80297e:	50                   	push   %eax
+  80297f:	e8 5e 01 00 00       	call   802ae2 <nsipc_listen>
+  802984:	83 c4 10             	add    $0x10,%esp
+  802987:	c9                   	leave
+  802988:	c3                   	ret
+
+00802989 <socket>:
+  802989:	55                   	push   %ebp
+  80298a:	89 e5                	mov    %esp,%ebp
+  80298c:	83 ec 0c             	sub    $0xc,%esp
+  80298f:	ff 75 10             	push   0x10(%ebp)
+  802992:	ff 75 0c             	push   0xc(%ebp)
+  802995:	ff 75 08             	push   0x8(%ebp)
+  802998:	e8 34 02 00 00       	call   802bd1 <nsipc_socket>
+  80299d:	83 c4 10             	add    $0x10,%esp
+  8029a0:	85 c0                	test   %eax,%eax
+  8029a2:	78 05                	js     8029a9 <socket+0x20>
+  8029a4:	e8 ab fe ff ff       	call   802854 <alloc_sockfd>
+  8029a9:	c9                   	leave
+  8029aa:	c3                   	ret
+
+008029ab <nsipc>:
+  8029ab:	55                   	push   %ebp
+  8029ac:	89 e5                	mov    %esp,%ebp
+  8029ae:	53                   	push   %ebx
+  8029af:	83 ec 04             	sub    $0x4,%esp
+  8029b2:	89 c3                	mov    %eax,%ebx
+  8029b4:	83 3d b8 50 80 00 00 	cmpl   $0x0,0x8050b8
+  8029bb:	74 1f                	je     8029dc <nsipc+0x31>
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+  8029c0:	6a 00                	push   $0x0
+  8029c2:	6a 00                	push   $0x0
+  8029c4:	6a 07                	push   $0x7
+  8029c6:	68 00 70 80 00       	push   $0x807000
+  8029cb:	53                   	push   %ebx
+  8029cc:	ff 35 b8 50 80 00    	push   0x8050b8
+  8029d2:	e8 d7 09 00 00       	call   8033ae <ipc_call>
+  8029d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029da:	c9                   	leave
+  8029db:	c3                   	ret
+  8029dc:	83 ec 0c             	sub    $0xc,%esp
+  8029df:	6a 03                	push   $0x3
+  8029e1:	e8 63 0b 00 00       	call   803549 <ipc_find_env>
+  8029e6:	a3 b8 50 80 00       	mov    %eax,0x8050b8
+  8029eb:	83 c4 10             	add    $0x10,%esp
+  8029ee:	eb cd                	jmp    8029bd <nsipc+0x12>
+
+008029f0 <nsipc_accept>:
+  8029f0:	55                   	push   %ebp
+  8029f1:	89 e5                	mov    %esp,%ebp
+  8029f3:	53                   	push   %ebx
+  8029f4:	83 ec 04             	sub    $0x4,%esp
+  8029f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fa:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a04:	e8 a2 ff ff ff       	call   8029ab <nsipc>
+  802a09:	89 c3                	mov    %eax,%ebx
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	79 07                	jns    802a16 <nsipc_accept+0x26>
+  802a0f:	89 d8                	mov    %ebx,%eax
+  802a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a14:	c9                   	leave
+  802a15:	c3                   	ret
+  802a16:	83 ec 04             	sub    $0x4,%esp
+  802a19:	ff 35 10 70 80 00    	push   0x807010
+  802a1f:	68 00 70 80 00       	push   $0x807000
+  802a24:	ff 75 0c             	push   0xc(%ebp)
+  802a27:	e8 aa e5 ff ff       	call   800fd6 <memmove>
+  802a2c:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802a32:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a35:	89 10                	mov    %edx,(%eax)
+  802a37:	83 c4 10             	add    $0x10,%esp
+  802a3a:	eb d3                	jmp    802a0f <nsipc_accept+0x1f>
+
+00802a3c <nsipc_bind>:
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	53                   	push   %ebx
+  802a40:	83 ec 08             	sub    $0x8,%esp
+  802a43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a49:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a4e:	53                   	push   %ebx
+  802a4f:	ff 75 0c             	push   0xc(%ebp)
+  802a52:	68 04 70 80 00       	push   $0x807004
+  802a57:	e8 7a e5 ff ff       	call   800fd6 <memmove>
+  802a5c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802a62:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a67:	e8 3f ff ff ff       	call   8029ab <nsipc>
+  802a6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+
+00802a71 <nsipc_shutdown>:
+  802a71:	55                   	push   %ebp
+  802a72:	89 e5                	mov    %esp,%ebp
+  802a74:	83 ec 08             	sub    $0x8,%esp
+  802a77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a7a:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a82:	a3 04 70 80 00       	mov    %eax,0x807004
+  802a87:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a8c:	e8 1a ff ff ff       	call   8029ab <nsipc>
+  802a91:	c9                   	leave
+  802a92:	c3                   	ret
+
+00802a93 <nsipc_close>:
+  802a93:	55                   	push   %ebp
+  802a94:	89 e5                	mov    %esp,%ebp
+  802a96:	83 ec 08             	sub    $0x8,%esp
+  802a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802aa1:	b8 04 00 00 00       	mov    $0x4,%eax
+  802aa6:	e8 00 ff ff ff       	call   8029ab <nsipc>
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+00802aad <nsipc_connect>:
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	53                   	push   %ebx
+  802ab1:	83 ec 08             	sub    $0x8,%esp
+  802ab4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aba:	a3 00 70 80 00       	mov    %eax,0x807000
+  802abf:	53                   	push   %ebx
+  802ac0:	ff 75 0c             	push   0xc(%ebp)
+  802ac3:	68 04 70 80 00       	push   $0x807004
+  802ac8:	e8 09 e5 ff ff       	call   800fd6 <memmove>
+  802acd:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802ad3:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ad8:	e8 ce fe ff ff       	call   8029ab <nsipc>
+  802add:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ae0:	c9                   	leave
+  802ae1:	c3                   	ret
+
+00802ae2 <nsipc_listen>:
+  802ae2:	55                   	push   %ebp
+  802ae3:	89 e5                	mov    %esp,%ebp
+  802ae5:	83 ec 08             	sub    $0x8,%esp
+  802ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aeb:	a3 00 70 80 00       	mov    %eax,0x807000
+  802af0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af3:	a3 04 70 80 00       	mov    %eax,0x807004
+  802af8:	b8 06 00 00 00       	mov    $0x6,%eax
+  802afd:	e8 a9 fe ff ff       	call   8029ab <nsipc>
+  802b02:	c9                   	leave
+  802b03:	c3                   	ret
+
+00802b04 <nsipc_recv>:
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+  802b07:	56                   	push   %esi
+  802b08:	53                   	push   %ebx
+  802b09:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b14:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802b1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b1d:	a3 08 70 80 00       	mov    %eax,0x807008
+  802b22:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b27:	e8 7f fe ff ff       	call   8029ab <nsipc>
+  802b2c:	89 c3                	mov    %eax,%ebx
+  802b2e:	85 c0                	test   %eax,%eax
+  802b30:	78 22                	js     802b54 <nsipc_recv+0x50>
+  802b32:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b37:	39 c6                	cmp    %eax,%esi
+  802b39:	0f 4e c6             	cmovle %esi,%eax
+  802b3c:	39 c3                	cmp    %eax,%ebx
+  802b3e:	7f 1d                	jg     802b5d <nsipc_recv+0x59>
+  802b40:	83 ec 04             	sub    $0x4,%esp
+  802b43:	53                   	push   %ebx
+  802b44:	68 00 70 80 00       	push   $0x807000
+  802b49:	ff 75 0c             	push   0xc(%ebp)
+  802b4c:	e8 85 e4 ff ff       	call   800fd6 <memmove>
+  802b51:	83 c4 10             	add    $0x10,%esp
+  802b54:	89 d8                	mov    %ebx,%eax
+  802b56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b59:	5b                   	pop    %ebx
+  802b5a:	5e                   	pop    %esi
+  802b5b:	5d                   	pop    %ebp
+  802b5c:	c3                   	ret
+  802b5d:	68 2c 3d 80 00       	push   $0x803d2c
+  802b62:	68 41 3d 80 00       	push   $0x803d41
+  802b67:	6a 60                	push   $0x60
+  802b69:	68 56 3d 80 00       	push   $0x803d56
+  802b6e:	e8 e1 da ff ff       	call   800654 <_panic>
+
+00802b73 <nsipc_send>:
+  802b73:	55                   	push   %ebp
+  802b74:	89 e5                	mov    %esp,%ebp
+  802b76:	53                   	push   %ebx
+  802b77:	83 ec 04             	sub    $0x4,%esp
+  802b7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b80:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b85:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b8b:	7f 2e                	jg     802bbb <nsipc_send+0x48>
+  802b8d:	83 ec 04             	sub    $0x4,%esp
+  802b90:	53                   	push   %ebx
+  802b91:	ff 75 0c             	push   0xc(%ebp)
+  802b94:	68 0c 70 80 00       	push   $0x80700c
+  802b99:	e8 38 e4 ff ff       	call   800fd6 <memmove>
+  802b9e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802ba4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ba7:	a3 08 70 80 00       	mov    %eax,0x807008
+  802bac:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bb1:	e8 f5 fd ff ff       	call   8029ab <nsipc>
+  802bb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb9:	c9                   	leave
+  802bba:	c3                   	ret
+  802bbb:	68 62 3d 80 00       	push   $0x803d62
+  802bc0:	68 41 3d 80 00       	push   $0x803d41
+  802bc5:	6a 6b                	push   $0x6b
+  802bc7:	68 56 3d 80 00       	push   $0x803d56
+  802bcc:	e8 83 da ff ff       	call   800654 <_panic>
+
+00802bd1 <nsipc_socket>:
+  802bd1:	55                   	push   %ebp
+  802bd2:	89 e5                	mov    %esp,%ebp
+  802bd4:	83 ec 08             	sub    $0x8,%esp
+  802bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bda:	a3 00 70 80 00       	mov    %eax,0x807000
+  802bdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802be2:	a3 04 70 80 00       	mov    %eax,0x807004
+  802be7:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bea:	a3 08 70 80 00       	mov    %eax,0x807008
+  802bef:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bf4:	e8 b2 fd ff ff       	call   8029ab <nsipc>
+  802bf9:	c9                   	leave
+  802bfa:	c3                   	ret
+
+00802bfb <devpipe_stat>:
+  802bfb:	55                   	push   %ebp
+  802bfc:	89 e5                	mov    %esp,%ebp
+  802bfe:	56                   	push   %esi
+  802bff:	53                   	push   %ebx
+  802c00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802c03:	83 ec 0c             	sub    $0xc,%esp
+  802c06:	ff 75 08             	push   0x8(%ebp)
+  802c09:	e8 99 ef ff ff       	call   801ba7 <fd2data>
+  802c0e:	89 c6                	mov    %eax,%esi
+  802c10:	83 c4 08             	add    $0x8,%esp
+  802c13:	68 6e 3d 80 00       	push   $0x803d6e
+  802c18:	53                   	push   %ebx
+  802c19:	e8 08 e2 ff ff       	call   800e26 <strcpy>
+  802c1e:	8b 46 04             	mov    0x4(%esi),%eax
+  802c21:	2b 06                	sub    (%esi),%eax
+  802c23:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802c29:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c30:	00 00 00 
+  802c33:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802c3a:	40 80 00 
+  802c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c45:	5b                   	pop    %ebx
+  802c46:	5e                   	pop    %esi
+  802c47:	5d                   	pop    %ebp
+  802c48:	c3                   	ret
+
+00802c49 <devpipe_close>:
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	53                   	push   %ebx
+  802c4d:	83 ec 0c             	sub    $0xc,%esp
+  802c50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c53:	53                   	push   %ebx
+  802c54:	6a 00                	push   $0x0
+  802c56:	e8 fd e6 ff ff       	call   801358 <sys_page_unmap>
+  802c5b:	89 1c 24             	mov    %ebx,(%esp)
+  802c5e:	e8 44 ef ff ff       	call   801ba7 <fd2data>
+  802c63:	83 c4 08             	add    $0x8,%esp
+  802c66:	50                   	push   %eax
+  802c67:	6a 00                	push   $0x0
+  802c69:	e8 ea e6 ff ff       	call   801358 <sys_page_unmap>
+  802c6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c71:	c9                   	leave
+  802c72:	c3                   	ret
+
+00802c73 <_pipeisclosed>:
+  802c73:	55                   	push   %ebp
+  802c74:	89 e5                	mov    %esp,%ebp
+  802c76:	57                   	push   %edi
+  802c77:	56                   	push   %esi
+  802c78:	53                   	push   %ebx
+  802c79:	83 ec 1c             	sub    $0x1c,%esp
+  802c7c:	89 c7                	mov    %eax,%edi
+  802c7e:	89 d6                	mov    %edx,%esi
+  802c80:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  802c85:	8b 58 58             	mov    0x58(%eax),%ebx
+  802c88:	83 ec 0c             	sub    $0xc,%esp
+  802c8b:	57                   	push   %edi
+  802c8c:	e8 d2 08 00 00       	call   803563 <pageref>
+  802c91:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c94:	89 34 24             	mov    %esi,(%esp)
+  802c97:	e8 c7 08 00 00       	call   803563 <pageref>
+  802c9c:	8b 15 bc 50 80 00    	mov    0x8050bc,%edx
+  802ca2:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802ca5:	83 c4 10             	add    $0x10,%esp
+  802ca8:	39 cb                	cmp    %ecx,%ebx
+  802caa:	74 1b                	je     802cc7 <_pipeisclosed+0x54>
+  802cac:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802caf:	75 cf                	jne    802c80 <_pipeisclosed+0xd>
+  802cb1:	8b 42 58             	mov    0x58(%edx),%eax
+  802cb4:	6a 01                	push   $0x1
+  802cb6:	50                   	push   %eax
+  802cb7:	53                   	push   %ebx
+  802cb8:	68 75 3d 80 00       	push   $0x803d75
+  802cbd:	e8 6d da ff ff       	call   80072f <cprintf>
+  802cc2:	83 c4 10             	add    $0x10,%esp
+  802cc5:	eb b9                	jmp    802c80 <_pipeisclosed+0xd>
+  802cc7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cca:	0f 94 c0             	sete   %al
+  802ccd:	0f b6 c0             	movzbl %al,%eax
+  802cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cd3:	5b                   	pop    %ebx
+  802cd4:	5e                   	pop    %esi
+  802cd5:	5f                   	pop    %edi
+  802cd6:	5d                   	pop    %ebp
+  802cd7:	c3                   	ret
+
+00802cd8 <devpipe_write>:
+  802cd8:	55                   	push   %ebp
+  802cd9:	89 e5                	mov    %esp,%ebp
+  802cdb:	57                   	push   %edi
+  802cdc:	56                   	push   %esi
+  802cdd:	53                   	push   %ebx
+  802cde:	83 ec 28             	sub    $0x28,%esp
+  802ce1:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ce4:	56                   	push   %esi
+  802ce5:	e8 bd ee ff ff       	call   801ba7 <fd2data>
+  802cea:	89 c3                	mov    %eax,%ebx
+  802cec:	83 c4 10             	add    $0x10,%esp
+  802cef:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802cf8:	74 5c                	je     802d56 <devpipe_write+0x7e>
+  802cfa:	8b 43 04             	mov    0x4(%ebx),%eax
+  802cfd:	8b 0b                	mov    (%ebx),%ecx
+  802cff:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d02:	39 d0                	cmp    %edx,%eax
+  802d04:	72 1e                	jb     802d24 <devpipe_write+0x4c>
+  802d06:	89 da                	mov    %ebx,%edx
+  802d08:	89 f0                	mov    %esi,%eax
+  802d0a:	e8 64 ff ff ff       	call   802c73 <_pipeisclosed>
+  802d0f:	85 c0                	test   %eax,%eax
+  802d11:	75 48                	jne    802d5b <devpipe_write+0x83>
+  802d13:	e8 23 e5 ff ff       	call   80123b <sys_yield>
+  802d18:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d1b:	8b 0b                	mov    (%ebx),%ecx
+  802d1d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d20:	39 d0                	cmp    %edx,%eax
+  802d22:	73 e2                	jae    802d06 <devpipe_write+0x2e>
+  802d24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d27:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802d2b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802d2e:	89 c2                	mov    %eax,%edx
+  802d30:	c1 fa 1f             	sar    $0x1f,%edx
+  802d33:	89 d1                	mov    %edx,%ecx
+  802d35:	c1 e9 1b             	shr    $0x1b,%ecx
+  802d38:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d3b:	83 e2 1f             	and    $0x1f,%edx
+  802d3e:	29 ca                	sub    %ecx,%edx
+  802d40:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802d44:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802d48:	83 c0 01             	add    $0x1,%eax
+  802d4b:	89 43 04             	mov    %eax,0x4(%ebx)
+  802d4e:	83 c7 01             	add    $0x1,%edi
+  802d51:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802d54:	75 a4                	jne    802cfa <devpipe_write+0x22>
+  802d56:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d59:	eb 05                	jmp    802d60 <devpipe_write+0x88>
+  802d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d63:	5b                   	pop    %ebx
+  802d64:	5e                   	pop    %esi
+  802d65:	5f                   	pop    %edi
+  802d66:	5d                   	pop    %ebp
+  802d67:	c3                   	ret
+
+00802d68 <devpipe_read>:
+  802d68:	55                   	push   %ebp
+  802d69:	89 e5                	mov    %esp,%ebp
+  802d6b:	57                   	push   %edi
+  802d6c:	56                   	push   %esi
+  802d6d:	53                   	push   %ebx
+  802d6e:	83 ec 18             	sub    $0x18,%esp
+  802d71:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d74:	56                   	push   %esi
+  802d75:	e8 2d ee ff ff       	call   801ba7 <fd2data>
+  802d7a:	89 c3                	mov    %eax,%ebx
+  802d7c:	83 c4 10             	add    $0x10,%esp
+  802d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d84:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d88:	74 45                	je     802dcf <devpipe_read+0x67>
+  802d8a:	8b 03                	mov    (%ebx),%eax
+  802d8c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d8f:	75 1d                	jne    802dae <devpipe_read+0x46>
+  802d91:	85 ff                	test   %edi,%edi
+  802d93:	75 3f                	jne    802dd4 <devpipe_read+0x6c>
+  802d95:	89 da                	mov    %ebx,%edx
+  802d97:	89 f0                	mov    %esi,%eax
+  802d99:	e8 d5 fe ff ff       	call   802c73 <_pipeisclosed>
+  802d9e:	85 c0                	test   %eax,%eax
+  802da0:	75 3c                	jne    802dde <devpipe_read+0x76>
+  802da2:	e8 94 e4 ff ff       	call   80123b <sys_yield>
+  802da7:	8b 03                	mov    (%ebx),%eax
+  802da9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802dac:	74 e7                	je     802d95 <devpipe_read+0x2d>
+  802dae:	99                   	cltd
+  802daf:	c1 ea 1b             	shr    $0x1b,%edx
+  802db2:	01 d0                	add    %edx,%eax
+  802db4:	83 e0 1f             	and    $0x1f,%eax
+  802db7:	29 d0                	sub    %edx,%eax
+  802db9:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802dbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dc1:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802dc4:	83 03 01             	addl   $0x1,(%ebx)
+  802dc7:	83 c7 01             	add    $0x1,%edi
+  802dca:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802dcd:	75 bb                	jne    802d8a <devpipe_read+0x22>
+  802dcf:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dd2:	eb 02                	jmp    802dd6 <devpipe_read+0x6e>
+  802dd4:	89 f8                	mov    %edi,%eax
+  802dd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dd9:	5b                   	pop    %ebx
+  802dda:	5e                   	pop    %esi
+  802ddb:	5f                   	pop    %edi
+  802ddc:	5d                   	pop    %ebp
+  802ddd:	c3                   	ret
+  802dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de3:	eb f1                	jmp    802dd6 <devpipe_read+0x6e>
+
+00802de5 <pipe>:
+  802de5:	55                   	push   %ebp
+  802de6:	89 e5                	mov    %esp,%ebp
+  802de8:	56                   	push   %esi
+  802de9:	53                   	push   %ebx
+  802dea:	83 ec 1c             	sub    $0x1c,%esp
+  802ded:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802df0:	50                   	push   %eax
+  802df1:	e8 c8 ed ff ff       	call   801bbe <fd_alloc>
+  802df6:	89 c3                	mov    %eax,%ebx
+  802df8:	83 c4 10             	add    $0x10,%esp
+  802dfb:	85 c0                	test   %eax,%eax
+  802dfd:	0f 88 23 01 00 00    	js     802f26 <pipe+0x141>
+  802e03:	83 ec 04             	sub    $0x4,%esp
+  802e06:	68 07 04 00 00       	push   $0x407
+  802e0b:	ff 75 f4             	push   -0xc(%ebp)
+  802e0e:	6a 00                	push   $0x0
+  802e10:	e8 71 e4 ff ff       	call   801286 <sys_page_alloc>
+  802e15:	89 c3                	mov    %eax,%ebx
+  802e17:	83 c4 10             	add    $0x10,%esp
+  802e1a:	85 c0                	test   %eax,%eax
+  802e1c:	0f 88 04 01 00 00    	js     802f26 <pipe+0x141>
+  802e22:	83 ec 0c             	sub    $0xc,%esp
+  802e25:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e28:	50                   	push   %eax
+  802e29:	e8 90 ed ff ff       	call   801bbe <fd_alloc>
+  802e2e:	89 c3                	mov    %eax,%ebx
+  802e30:	83 c4 10             	add    $0x10,%esp
+  802e33:	85 c0                	test   %eax,%eax
+  802e35:	0f 88 db 00 00 00    	js     802f16 <pipe+0x131>
+  802e3b:	83 ec 04             	sub    $0x4,%esp
+  802e3e:	68 07 04 00 00       	push   $0x407
+  802e43:	ff 75 f0             	push   -0x10(%ebp)
+  802e46:	6a 00                	push   $0x0
+  802e48:	e8 39 e4 ff ff       	call   801286 <sys_page_alloc>
+  802e4d:	89 c3                	mov    %eax,%ebx
+  802e4f:	83 c4 10             	add    $0x10,%esp
+  802e52:	85 c0                	test   %eax,%eax
+  802e54:	0f 88 bc 00 00 00    	js     802f16 <pipe+0x131>
+  802e5a:	83 ec 0c             	sub    $0xc,%esp
+  802e5d:	ff 75 f4             	push   -0xc(%ebp)
+  802e60:	e8 42 ed ff ff       	call   801ba7 <fd2data>
+  802e65:	89 c6                	mov    %eax,%esi
+  802e67:	83 c4 0c             	add    $0xc,%esp
+  802e6a:	68 07 04 00 00       	push   $0x407
+  802e6f:	50                   	push   %eax
+  802e70:	6a 00                	push   $0x0
+  802e72:	e8 0f e4 ff ff       	call   801286 <sys_page_alloc>
+  802e77:	89 c3                	mov    %eax,%ebx
+  802e79:	83 c4 10             	add    $0x10,%esp
+  802e7c:	85 c0                	test   %eax,%eax
+  802e7e:	0f 88 82 00 00 00    	js     802f06 <pipe+0x121>
+  802e84:	83 ec 0c             	sub    $0xc,%esp
+  802e87:	ff 75 f0             	push   -0x10(%ebp)
+  802e8a:	e8 18 ed ff ff       	call   801ba7 <fd2data>
+  802e8f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e96:	50                   	push   %eax
+  802e97:	6a 00                	push   $0x0
+  802e99:	56                   	push   %esi
+  802e9a:	6a 00                	push   $0x0
+  802e9c:	e8 28 e4 ff ff       	call   8012c9 <sys_page_map>
+  802ea1:	89 c3                	mov    %eax,%ebx
+  802ea3:	83 c4 20             	add    $0x20,%esp
+  802ea6:	85 c0                	test   %eax,%eax
+  802ea8:	78 4e                	js     802ef8 <pipe+0x113>
+  802eaa:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802eaf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802eb2:	89 02                	mov    %eax,(%edx)
+  802eb4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802eb7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802ebe:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802ec1:	89 02                	mov    %eax,(%edx)
+  802ec3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802ec6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802ecd:	83 ec 0c             	sub    $0xc,%esp
+  802ed0:	ff 75 f4             	push   -0xc(%ebp)
+  802ed3:	e8 bf ec ff ff       	call   801b97 <fd2num>
+  802ed8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802edb:	89 01                	mov    %eax,(%ecx)
+  802edd:	83 c4 04             	add    $0x4,%esp
+  802ee0:	ff 75 f0             	push   -0x10(%ebp)
+  802ee3:	e8 af ec ff ff       	call   801b97 <fd2num>
+  802ee8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802eeb:	89 41 04             	mov    %eax,0x4(%ecx)
+  802eee:	83 c4 10             	add    $0x10,%esp
+  802ef1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ef6:	eb 2e                	jmp    802f26 <pipe+0x141>
+  802ef8:	83 ec 08             	sub    $0x8,%esp
+  802efb:	56                   	push   %esi
+  802efc:	6a 00                	push   $0x0
+  802efe:	e8 55 e4 ff ff       	call   801358 <sys_page_unmap>
+  802f03:	83 c4 10             	add    $0x10,%esp
+  802f06:	83 ec 08             	sub    $0x8,%esp
+  802f09:	ff 75 f0             	push   -0x10(%ebp)
+  802f0c:	6a 00                	push   $0x0
+  802f0e:	e8 45 e4 ff ff       	call   801358 <sys_page_unmap>
+  802f13:	83 c4 10             	add    $0x10,%esp
+  802f16:	83 ec 08             	sub    $0x8,%esp
+  802f19:	ff 75 f4             	push   -0xc(%ebp)
+  802f1c:	6a 00                	push   $0x0
+  802f1e:	e8 35 e4 ff ff       	call   801358 <sys_page_unmap>
+  802f23:	83 c4 10             	add    $0x10,%esp
+  802f26:	89 d8                	mov    %ebx,%eax
+  802f28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f2b:	5b                   	pop    %ebx
+  802f2c:	5e                   	pop    %esi
+  802f2d:	5d                   	pop    %ebp
+  802f2e:	c3                   	ret
+
+00802f2f <pipeisclosed>:
+  802f2f:	55                   	push   %ebp
+  802f30:	89 e5                	mov    %esp,%ebp
+  802f32:	83 ec 20             	sub    $0x20,%esp
+  802f35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f38:	50                   	push   %eax
+  802f39:	ff 75 08             	push   0x8(%ebp)
+  802f3c:	e8 cd ec ff ff       	call   801c0e <fd_lookup>
+  802f41:	83 c4 10             	add    $0x10,%esp
+  802f44:	85 c0                	test   %eax,%eax
+  802f46:	78 18                	js     802f60 <pipeisclosed+0x31>
+  802f48:	83 ec 0c             	sub    $0xc,%esp
+  802f4b:	ff 75 f4             	push   -0xc(%ebp)
+  802f4e:	e8 54 ec ff ff       	call   801ba7 <fd2data>
+  802f53:	89 c2                	mov    %eax,%edx
+  802f55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f58:	e8 16 fd ff ff       	call   802c73 <_pipeisclosed>
+  802f5d:	83 c4 10             	add    $0x10,%esp
+  802f60:	c9                   	leave
+  802f61:	c3                   	ret
+
+00802f62 <ipcring_init>:
+  802f62:	55                   	push   %ebp
+  802f63:	89 e5                	mov    %esp,%ebp
+  802f65:	53                   	push   %ebx
+  802f66:	83 ec 08             	sub    $0x8,%esp
+  802f69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f6c:	6a 60                	push   $0x60
+  802f6e:	6a 00                	push   $0x0
+  802f70:	53                   	push   %ebx
+  802f71:	e8 2b e0 ff ff       	call   800fa1 <memset>
+  802f76:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  802f7b:	8b 40 48             	mov    0x48(%eax),%eax
+  802f7e:	89 03                	mov    %eax,(%ebx)
+  802f80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f83:	89 43 04             	mov    %eax,0x4(%ebx)
+  802f86:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f89:	89 43 08             	mov    %eax,0x8(%ebx)
+  802f8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f8f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802f92:	83 c4 10             	add    $0x10,%esp
+  802f95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f98:	c9                   	leave
+  802f99:	c3                   	ret
+
+00802f9a <ipcring_req_slot>:
+  802f9a:	55                   	push   %ebp
+  802f9b:	89 e5                	mov    %esp,%ebp
+  802f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa0:	8b 50 10             	mov    0x10(%eax),%edx
+  802fa3:	8b 48 18             	mov    0x18(%eax),%ecx
+  802fa6:	29 ca                	sub    %ecx,%edx
+  802fa8:	83 fa 07             	cmp    $0x7,%edx
+  802fab:	77 0c                	ja     802fb9 <ipcring_req_slot+0x1f>
+  802fad:	8b 50 10             	mov    0x10(%eax),%edx
+  802fb0:	83 e2 07             	and    $0x7,%edx
+  802fb3:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802fb7:	5d                   	pop    %ebp
+  802fb8:	c3                   	ret
+  802fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbe:	eb f7                	jmp    802fb7 <ipcring_req_slot+0x1d>
+
+00802fc0 <ipcring_req_push>:
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	83 ec 08             	sub    $0x8,%esp
+  802fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fc9:	8b 42 10             	mov    0x10(%edx),%eax
+  802fcc:	83 c0 01             	add    $0x1,%eax
+  802fcf:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd8:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802fdc:	85 c0                	test   %eax,%eax
+  802fde:	75 02                	jne    802fe2 <ipcring_req_push+0x22>
+  802fe0:	c9                   	leave
+  802fe1:	c3                   	ret
+  802fe2:	6a 00                	push   $0x0
+  802fe4:	68 00 00 80 ee       	push   $0xee800000
+  802fe9:	ff 72 08             	push   0x8(%edx)
+  802fec:	ff 72 04             	push   0x4(%edx)
+  802fef:	e8 ca e5 ff ff       	call   8015be <sys_ipc_send>
+  802ff4:	83 c4 10             	add    $0x10,%esp
+  802ff7:	eb e7                	jmp    802fe0 <ipcring_req_push+0x20>
+
+00802ff9 <ipcring_rsp_wait>:
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	53                   	push   %ebx
+  802ffd:	83 ec 04             	sub    $0x4,%esp
+  803000:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803003:	8b 53 18             	mov    0x18(%ebx),%edx
+  803006:	8b 43 10             	mov    0x10(%ebx),%eax
+  803009:	39 c2                	cmp    %eax,%edx
+  80300b:	74 3c                	je     803049 <ipcring_rsp_wait+0x50>
+  80300d:	8b 53 14             	mov    0x14(%ebx),%edx
+  803010:	8b 43 18             	mov    0x18(%ebx),%eax
+  803013:	39 c2                	cmp    %eax,%edx
+  803015:	75 23                	jne    80303a <ipcring_rsp_wait+0x41>
+  803017:	83 ec 08             	sub    $0x8,%esp
+  80301a:	6a 00                	push   $0x0
+  80301c:	6a 00                	push   $0x0
+  80301e:	6a 00                	push   $0x0
+  803020:	6a 00                	push   $0x0
+  803022:	ff 73 0c             	push   0xc(%ebx)
+  803025:	ff 73 04             	push   0x4(%ebx)
+  803028:	e8 81 03 00 00       	call   8033ae <ipc_call>
+  80302d:	8b 53 14             	mov    0x14(%ebx),%edx
+  803030:	8b 43 18             	mov    0x18(%ebx),%eax
+  803033:	83 c4 20             	add    $0x20,%esp
+  803036:	39 c2                	cmp    %eax,%edx
+  803038:	74 dd                	je     803017 <ipcring_rsp_wait+0x1e>
+  80303a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80303d:	83 e0 07             	and    $0x7,%eax
+  803040:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803044:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803047:	c9                   	leave
+  803048:	c3                   	ret
+  803049:	68 90 3d 80 00       	push   $0x803d90
+  80304e:	68 41 3d 80 00       	push   $0x803d41
+  803053:	6a 3b                	push   $0x3b
+  803055:	68 b1 3d 80 00       	push   $0x803db1
+  80305a:	e8 f5 d5 ff ff       	call   800654 <_panic>
+
+0080305f <ipcring_rsp_pop>:
+  80305f:	55                   	push   %ebp
+  803060:	89 e5                	mov    %esp,%ebp
+  803062:	8b 55 08             	mov    0x8(%ebp),%edx
+  803065:	8b 42 18             	mov    0x18(%edx),%eax
+  803068:	83 c0 01             	add    $0x1,%eax
+  80306b:	89 42 18             	mov    %eax,0x18(%edx)
+  80306e:	5d                   	pop    %ebp
+  80306f:	c3                   	ret
+
+00803070 <ipcring_server_init>:
+  803070:	55                   	push   %ebp
+  803071:	89 e5                	mov    %esp,%ebp
+  803073:	8b 45 08             	mov    0x8(%ebp),%eax
+  803076:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803079:	89 10                	mov    %edx,(%eax)
+  80307b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80307e:	89 50 04             	mov    %edx,0x4(%eax)
+  803081:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803088:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80308f:	5d                   	pop    %ebp
+  803090:	c3                   	ret
+
+00803091 <ipcring_req_avail>:
+  803091:	55                   	push   %ebp
+  803092:	89 e5                	mov    %esp,%ebp
+  803094:	8b 55 08             	mov    0x8(%ebp),%edx
+  803097:	8b 02                	mov    (%edx),%eax
+  803099:	8b 40 10             	mov    0x10(%eax),%eax
+  80309c:	2b 42 08             	sub    0x8(%edx),%eax
+  80309f:	ba 08 00 00 00       	mov    $0x8,%edx
+  8030a4:	39 d0                	cmp    %edx,%eax
+  8030a6:	0f 47 c2             	cmova  %edx,%eax
+  8030a9:	5d                   	pop    %ebp
+  8030aa:	c3                   	ret
+
+008030ab <ipcring_req_peek>:
+  8030ab:	55                   	push   %ebp
+  8030ac:	89 e5                	mov    %esp,%ebp
+  8030ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030b1:	8b 42 08             	mov    0x8(%edx),%eax
+  8030b4:	83 e0 07             	and    $0x7,%eax
+  8030b7:	8b 12                	mov    (%edx),%edx
+  8030b9:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8030bd:	5d                   	pop    %ebp
+  8030be:	c3                   	ret
+
+008030bf <ipcring_rsp_push>:
+  8030bf:	55                   	push   %ebp
+  8030c0:	89 e5                	mov    %esp,%ebp
+  8030c2:	83 ec 08             	sub    $0x8,%esp
+  8030c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030c8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8030cb:	83 c0 01             	add    $0x1,%eax
+  8030ce:	89 41 08             	mov    %eax,0x8(%ecx)
+  8030d1:	8b 11                	mov    (%ecx),%edx
+  8030d3:	83 c2 14             	add    $0x14,%edx
+  8030d6:	f0 87 02             	lock xchg %eax,(%edx)
+  8030d9:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8030dd:	75 02                	jne    8030e1 <ipcring_rsp_push+0x22>
+  8030df:	c9                   	leave
+  8030e0:	c3                   	ret
+  8030e1:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8030e8:	6a 00                	push   $0x0
+  8030ea:	68 00 00 80 ee       	push   $0xee800000
+  8030ef:	6a 00                	push   $0x0
+  8030f1:	ff 71 04             	push   0x4(%ecx)
+  8030f4:	e8 e8 e3 ff ff       	call   8014e1 <sys_ipc_try_send>
+  8030f9:	83 c4 10             	add    $0x10,%esp
+  8030fc:	eb e1                	jmp    8030df <ipcring_rsp_push+0x20>
+
+008030fe <ipcring_client_wait>:
+  8030fe:	55                   	push   %ebp
+  8030ff:	89 e5                	mov    %esp,%ebp
+  803101:	83 ec 08             	sub    $0x8,%esp
+  803104:	8b 45 08             	mov    0x8(%ebp),%eax
+  803107:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  80310e:	8b 10                	mov    (%eax),%edx
+  803110:	8b 52 18             	mov    0x18(%edx),%edx
+  803113:	3b 50 08             	cmp    0x8(%eax),%edx
+  803116:	75 02                	jne    80311a <ipcring_client_wait+0x1c>
+  803118:	c9                   	leave
+  803119:	c3                   	ret
+  80311a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803121:	6a 00                	push   $0x0
+  803123:	68 00 00 80 ee       	push   $0xee800000
+  803128:	6a 00                	push   $0x0
+  80312a:	ff 70 04             	push   0x4(%eax)
+  80312d:	e8 af e3 ff ff       	call   8014e1 <sys_ipc_try_send>
+  803132:	83 c4 10             	add    $0x10,%esp
+  803135:	eb e1                	jmp    803118 <ipcring_client_wait+0x1a>
+
+00803137 <ipcring_server_sleep>:
+  803137:	55                   	push   %ebp
+  803138:	89 e5                	mov    %esp,%ebp
+  80313a:	53                   	push   %ebx
+  80313b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80313e:	8b 01                	mov    (%ecx),%eax
+  803140:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803143:	b8 01 00 00 00       	mov    $0x1,%eax
+  803148:	f0 87 02             	lock xchg %eax,(%edx)
+  80314b:	8b 11                	mov    (%ecx),%edx
+  80314d:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803150:	b8 01 00 00 00       	mov    $0x1,%eax
+  803155:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803158:	74 0e                	je     803168 <ipcring_server_sleep+0x31>
+  80315a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315f:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803163:	b8 00 00 00 00       	mov    $0x0,%eax
+  803168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80316b:	c9                   	leave
+  80316c:	c3                   	ret
+
+0080316d <devcons_close>:
+  80316d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803172:	c3                   	ret
+
+00803173 <devcons_stat>:
+  803173:	55                   	push   %ebp
+  803174:	89 e5                	mov    %esp,%ebp
+  803176:	83 ec 10             	sub    $0x10,%esp
+  803179:	68 bf 3d 80 00       	push   $0x803dbf
+  80317e:	ff 75 0c             	push   0xc(%ebp)
+  803181:	e8 a0 dc ff ff       	call   800e26 <strcpy>
+  803186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80318b:	c9                   	leave
+  80318c:	c3                   	ret
+
+0080318d <devcons_write>:
+  80318d:	55                   	push   %ebp
+  80318e:	89 e5                	mov    %esp,%ebp
+  803190:	57                   	push   %edi
+  803191:	56                   	push   %esi
+  803192:	53                   	push   %ebx
+  803193:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803199:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80319c:	85 ff                	test   %edi,%edi
+  80319e:	74 51                	je     8031f1 <devcons_write+0x64>
+  8031a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8031a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031aa:	89 fb                	mov    %edi,%ebx
+  8031ac:	29 c3                	sub    %eax,%ebx
+  8031ae:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8031b3:	39 d3                	cmp    %edx,%ebx
+  8031b5:	0f 47 da             	cmova  %edx,%ebx
+  8031b8:	83 ec 04             	sub    $0x4,%esp
+  8031bb:	53                   	push   %ebx
+  8031bc:	03 45 0c             	add    0xc(%ebp),%eax
+  8031bf:	50                   	push   %eax
+  8031c0:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8031c6:	50                   	push   %eax
+  8031c7:	e8 0a de ff ff       	call   800fd6 <memmove>
+  8031cc:	83 c4 08             	add    $0x8,%esp
+  8031cf:	53                   	push   %ebx
+  8031d0:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8031d6:	50                   	push   %eax
+  8031d7:	e8 c2 df ff ff       	call   80119e <sys_cputs>
+  8031dc:	01 de                	add    %ebx,%esi
+  8031de:	89 f0                	mov    %esi,%eax
+  8031e0:	83 c4 10             	add    $0x10,%esp
+  8031e3:	39 fe                	cmp    %edi,%esi
+  8031e5:	72 c3                	jb     8031aa <devcons_write+0x1d>
+  8031e7:	89 f0                	mov    %esi,%eax
+  8031e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031ec:	5b                   	pop    %ebx
+  8031ed:	5e                   	pop    %esi
+  8031ee:	5f                   	pop    %edi
+  8031ef:	5d                   	pop    %ebp
+  8031f0:	c3                   	ret
+  8031f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f6:	eb ef                	jmp    8031e7 <devcons_write+0x5a>
+
+008031f8 <devcons_read>:
+  8031f8:	55                   	push   %ebp
+  8031f9:	89 e5                	mov    %esp,%ebp
+  8031fb:	83 ec 08             	sub    $0x8,%esp
+  8031fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803203:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803207:	75 07                	jne    803210 <devcons_read+0x18>
+  803209:	eb 1f                	jmp    80322a <devcons_read+0x32>
+  80320b:	e8 2b e0 ff ff       	call   80123b <sys_yield>
+  803210:	e8 a7 df ff ff       	call   8011bc <sys_cgetc>
+  803215:	85 c0                	test   %eax,%eax
+  803217:	74 f2                	je     80320b <devcons_read+0x13>
+  803219:	78 0f                	js     80322a <devcons_read+0x32>
+  80321b:	83 f8 04             	cmp    $0x4,%eax
+  80321e:	74 0c                	je     80322c <devcons_read+0x34>
+  803220:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803223:	88 02                	mov    %al,(%edx)
+  803225:	b8 01 00 00 00       	mov    $0x1,%eax
+  80322a:	c9                   	leave
+  80322b:	c3                   	ret
+  80322c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803231:	eb f7                	jmp    80322a <devcons_read+0x32>
+
+00803233 <cputchar>:
+  803233:	55                   	push   %ebp
+  803234:	89 e5                	mov    %esp,%ebp
+  803236:	83 ec 20             	sub    $0x20,%esp
+  803239:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323c:	88 45 f7             	mov    %al,-0x9(%ebp)
+  80323f:	6a 01                	push   $0x1
+  803241:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803244:	50                   	push   %eax
+  803245:	e8 54 df ff ff       	call   80119e <sys_cputs>
+  80324a:	83 c4 10             	add    $0x10,%esp
+  80324d:	c9                   	leave
+  80324e:	c3                   	ret
+
+0080324f <getchar>:
+  80324f:	55                   	push   %ebp
+  803250:	89 e5                	mov    %esp,%ebp
+  803252:	83 ec 1c             	sub    $0x1c,%esp
+  803255:	6a 01                	push   $0x1
+  803257:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80325a:	50                   	push   %eax
+  80325b:	6a 00                	push   $0x0
+  80325d:	e8 0e ec ff ff       	call   801e70 <read>
+  803262:	83 c4 10             	add    $0x10,%esp
+  803265:	85 c0                	test   %eax,%eax
+  803267:	78 06                	js     80326f <getchar+0x20>
+  803269:	74 06                	je     803271 <getchar+0x22>
+  80326b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  80326f:	c9                   	leave
+  803270:	c3                   	ret
+  803271:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803276:	eb f7                	jmp    80326f <getchar+0x20>
+
+00803278 <iscons>:
+  803278:	55                   	push   %ebp
+  803279:	89 e5                	mov    %esp,%ebp
+  80327b:	83 ec 20             	sub    $0x20,%esp
+  80327e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803281:	50                   	push   %eax
+  803282:	ff 75 08             	push   0x8(%ebp)
+  803285:	e8 84 e9 ff ff       	call   801c0e <fd_lookup>
+  80328a:	83 c4 10             	add    $0x10,%esp
+  80328d:	85 c0                	test   %eax,%eax
+  80328f:	78 11                	js     8032a2 <iscons+0x2a>
+  803291:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803294:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80329a:	39 10                	cmp    %edx,(%eax)
+  80329c:	0f 94 c0             	sete   %al
+  80329f:	0f b6 c0             	movzbl %al,%eax
+  8032a2:	c9                   	leave
+  8032a3:	c3                   	ret
+
+008032a4 <opencons>:
+  8032a4:	55                   	push   %ebp
+  8032a5:	89 e5                	mov    %esp,%ebp
+  8032a7:	83 ec 24             	sub    $0x24,%esp
+  8032aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032ad:	50                   	push   %eax
+  8032ae:	e8 0b e9 ff ff       	call   801bbe <fd_alloc>
+  8032b3:	83 c4 10             	add    $0x10,%esp
+  8032b6:	85 c0                	test   %eax,%eax
+  8032b8:	78 3a                	js     8032f4 <opencons+0x50>
+  8032ba:	83 ec 04             	sub    $0x4,%esp
+  8032bd:	68 07 04 00 00       	push   $0x407
+  8032c2:	ff 75 f4             	push   -0xc(%ebp)
+  8032c5:	6a 00                	push   $0x0
+  8032c7:	e8 ba df ff ff       	call   801286 <sys_page_alloc>
+  8032cc:	83 c4 10             	add    $0x10,%esp
+  8032cf:	85 c0                	test   %eax,%eax
+  8032d1:	78 21                	js     8032f4 <opencons+0x50>
+  8032d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032d6:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8032dc:	89 10                	mov    %edx,(%eax)
+  8032de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8032e8:	83 ec 0c             	sub    $0xc,%esp
+  8032eb:	50                   	push   %eax
+  8032ec:	e8 a6 e8 ff ff       	call   801b97 <fd2num>
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+008032f6 <ipc_recv>:
+  8032f6:	55                   	push   %ebp
+  8032f7:	89 e5                	mov    %esp,%ebp
+  8032f9:	56                   	push   %esi
+  8032fa:	53                   	push   %ebx
+  8032fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803301:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803304:	85 c0                	test   %eax,%eax
+  803306:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  80330b:	0f 44 c2             	cmove  %edx,%eax
+  80330e:	83 ec 0c             	sub    $0xc,%esp
+  803311:	50                   	push   %eax
+  803312:	e8 1a e2 ff ff       	call   801531 <sys_ipc_recv>
+  803317:	83 c4 10             	add    $0x10,%esp
+  80331a:	85 c0                	test   %eax,%eax
+  80331c:	78 2a                	js     803348 <ipc_recv+0x52>
+  80331e:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  803323:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803329:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  80332f:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803335:	85 f6                	test   %esi,%esi
+  803337:	74 02                	je     80333b <ipc_recv+0x45>
+  803339:	89 0e                	mov    %ecx,(%esi)
+  80333b:	85 db                	test   %ebx,%ebx
+  80333d:	74 02                	je     803341 <ipc_recv+0x4b>
+  80333f:	89 13                	mov    %edx,(%ebx)
+  803341:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803344:	5b                   	pop    %ebx
+  803345:	5e                   	pop    %esi
+  803346:	5d                   	pop    %ebp
+  803347:	c3                   	ret
+  803348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80334d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803352:	eb e1                	jmp    803335 <ipc_recv+0x3f>
+
+00803354 <ipc_send>:
+  803354:	55                   	push   %ebp
+  803355:	89 e5                	mov    %esp,%ebp
+  803357:	57                   	push   %edi
+  803358:	56                   	push   %esi
+  803359:	53                   	push   %ebx
+  80335a:	83 ec 0c             	sub    $0xc,%esp
+  80335d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803360:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803363:	8b 75 14             	mov    0x14(%ebp),%esi
+  803366:	85 db                	test   %ebx,%ebx
+  803368:	74 1e                	je     803388 <ipc_send+0x34>
+  80336a:	56                   	push   %esi
+  80336b:	53                   	push   %ebx
+  80336c:	57                   	push   %edi
+  80336d:	ff 75 08             	push   0x8(%ebp)
+  803370:	e8 49 e2 ff ff       	call   8015be <sys_ipc_send>
+  803375:	83 c4 10             	add    $0x10,%esp
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	74 2a                	je     8033a6 <ipc_send+0x52>
+  80337c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80337f:	75 13                	jne    803394 <ipc_send+0x40>
+  803381:	e8 b5 de ff ff       	call   80123b <sys_yield>
+  803386:	eb e2                	jmp    80336a <ipc_send+0x16>
+  803388:	be 00 00 00 00       	mov    $0x0,%esi
+  80338d:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803392:	eb d6                	jmp    80336a <ipc_send+0x16>
+  803394:	50                   	push   %eax
+  803395:	68 cc 3d 80 00       	push   $0x803dcc
+  80339a:	6a 4f                	push   $0x4f
+  80339c:	68 0f 3e 80 00       	push   $0x803e0f
+  8033a1:	e8 ae d2 ff ff       	call   800654 <_panic>
+  8033a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a9:	5b                   	pop    %ebx
+  8033aa:	5e                   	pop    %esi
+  8033ab:	5f                   	pop    %edi
+  8033ac:	5d                   	pop    %ebp
+  8033ad:	c3                   	ret
+
+008033ae <ipc_call>:
+  8033ae:	55                   	push   %ebp
+  8033af:	89 e5                	mov    %esp,%ebp
+  8033b1:	57                   	push   %edi
+  8033b2:	56                   	push   %esi
+  8033b3:	53                   	push   %ebx
+  8033b4:	83 ec 0c             	sub    $0xc,%esp
+  8033b7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033bb:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8033c0:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8033c4:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8033c8:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8033cd:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8033d1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033da:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  8033de:	eb 05                	jmp    8033e5 <ipc_call+0x37>
+  8033e0:	e8 56 de ff ff       	call   80123b <sys_yield>
+  8033e5:	83 ec 0c             	sub    $0xc,%esp
+  8033e8:	56                   	push   %esi
+  8033e9:	53                   	push   %ebx
+  8033ea:	57                   	push   %edi
+  8033eb:	ff 75 0c             	push   0xc(%ebp)
+  8033ee:	ff 75 08             	push   0x8(%ebp)
+  8033f1:	e8 18 e2 ff ff       	call   80160e <sys_ipc_call>
+  8033f6:	83 c4 20             	add    $0x20,%esp
+  8033f9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033fc:	74 e2                	je     8033e0 <ipc_call+0x32>
+  8033fe:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803401:	74 2d                	je     803430 <ipc_call+0x82>
+  803403:	85 c0                	test   %eax,%eax
+  803405:	78 4f                	js     803456 <ipc_call+0xa8>
+  803407:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80340b:	74 10                	je     80341d <ipc_call+0x6f>
+  80340d:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  803412:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803418:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80341b:	89 02                	mov    %eax,(%edx)
+  80341d:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  803422:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80342b:	5b                   	pop    %ebx
+  80342c:	5e                   	pop    %esi
+  80342d:	5f                   	pop    %edi
+  80342e:	5d                   	pop    %ebp
+  80342f:	c3                   	ret
+  803430:	ff 75 14             	push   0x14(%ebp)
+  803433:	ff 75 10             	push   0x10(%ebp)
+  803436:	ff 75 0c             	push   0xc(%ebp)
+  803439:	ff 75 08             	push   0x8(%ebp)
+  80343c:	e8 13 ff ff ff       	call   803354 <ipc_send>
+  803441:	83 c4 0c             	add    $0xc,%esp
+  803444:	ff 75 1c             	push   0x1c(%ebp)
+  803447:	ff 75 18             	push   0x18(%ebp)
+  80344a:	6a 00                	push   $0x0
+  80344c:	e8 a5 fe ff ff       	call   8032f6 <ipc_recv>
+  803451:	83 c4 10             	add    $0x10,%esp
+  803454:	eb d2                	jmp    803428 <ipc_call+0x7a>
+  803456:	50                   	push   %eax
+  803457:	68 19 3e 80 00       	push   $0x803e19
+  80345c:	6a 6d                	push   $0x6d
+  80345e:	68 0f 3e 80 00       	push   $0x803e0f
+  803463:	e8 ec d1 ff ff       	call   800654 <_panic>
+
+00803468 <ipc_reply_recv>:
+  803468:	55                   	push   %ebp
+  803469:	89 e5                	mov    %esp,%ebp
+  80346b:	57                   	push   %edi
+  80346c:	56                   	push   %esi
+  80346d:	53                   	push   %ebx
+  80346e:	83 ec 0c             	sub    $0xc,%esp
+  803471:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803474:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803477:	8b 7d 20             	mov    0x20(%ebp),%edi
+  80347a:	85 db                	test   %ebx,%ebx
+  80347c:	0f 84 ac 00 00 00    	je     80352e <ipc_reply_recv+0xc6>
+  803482:	85 f6                	test   %esi,%esi
+  803484:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803489:	0f 45 c6             	cmovne %esi,%eax
+  80348c:	83 ec 0c             	sub    $0xc,%esp
+  80348f:	50                   	push   %eax
+  803490:	ff 75 14             	push   0x14(%ebp)
+  803493:	53                   	push   %ebx
+  803494:	ff 75 0c             	push   0xc(%ebp)
+  803497:	ff 75 08             	push   0x8(%ebp)
+  80349a:	e8 90 e1 ff ff       	call   80162f <sys_ipc_reply_recv>
+  80349f:	83 c4 20             	add    $0x20,%esp
+  8034a2:	85 c0                	test   %eax,%eax
+  8034a4:	78 3a                	js     8034e0 <ipc_reply_recv+0x78>
+  8034a6:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8034aa:	74 10                	je     8034bc <ipc_reply_recv+0x54>
+  8034ac:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  8034b1:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8034b7:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034ba:	89 02                	mov    %eax,(%edx)
+  8034bc:	85 ff                	test   %edi,%edi
+  8034be:	74 0d                	je     8034cd <ipc_reply_recv+0x65>
+  8034c0:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  8034c5:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8034cb:	89 07                	mov    %eax,(%edi)
+  8034cd:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+  8034d2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8034d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034db:	5b                   	pop    %ebx
+  8034dc:	5e                   	pop    %esi
+  8034dd:	5f                   	pop    %edi
+  8034de:	5d                   	pop    %ebp
+  8034df:	c3                   	ret
+  8034e0:	ff 75 14             	push   0x14(%ebp)
+  8034e3:	53                   	push   %ebx
+  8034e4:	ff 75 0c             	push   0xc(%ebp)
+  8034e7:	ff 75 08             	push   0x8(%ebp)
+  8034ea:	e8 f2 df ff ff       	call   8014e1 <sys_ipc_try_send>
+  8034ef:	89 c2                	mov    %eax,%edx
+  8034f1:	c1 ea 1f             	shr    $0x1f,%edx
+  8034f4:	83 c4 10             	add    $0x10,%esp
+  8034f7:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8034fa:	0f 95 c1             	setne  %cl
+  8034fd:	84 d1                	test   %dl,%cl
+  8034ff:	74 05                	je     803506 <ipc_reply_recv+0x9e>
+  803501:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803504:	75 12                	jne    803518 <ipc_reply_recv+0xb0>
+  803506:	83 ec 04             	sub    $0x4,%esp
+  803509:	57                   	push   %edi
+  80350a:	56                   	push   %esi
+  80350b:	ff 75 18             	push   0x18(%ebp)
+  80350e:	e8 e3 fd ff ff       	call   8032f6 <ipc_recv>
+  803513:	83 c4 10             	add    $0x10,%esp
+  803516:	eb c0                	jmp    8034d8 <ipc_reply_recv+0x70>
+  803518:	83 ec 04             	sub    $0x4,%esp
+  80351b:	50                   	push   %eax
+  80351c:	ff 75 08             	push   0x8(%ebp)
+  80351f:	68 ec 3d 80 00       	push   $0x803dec
+  803524:	e8 06 d2 ff ff       	call   80072f <cprintf>
+  803529:	83 c4 10             	add    $0x10,%esp
+  80352c:	eb d8                	jmp    803506 <ipc_reply_recv+0x9e>
+  80352e:	85 f6                	test   %esi,%esi
+  803530:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803535:	0f 45 c6             	cmovne %esi,%eax
+  803538:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80353d:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803544:	e9 43 ff ff ff       	jmp    80348c <ipc_reply_recv+0x24>
+
+00803549 <ipc_find_env>:
+  803549:	55                   	push   %ebp
+  80354a:	89 e5                	mov    %esp,%ebp
+  80354c:	83 ec 14             	sub    $0x14,%esp
+  80354f:	ff 75 08             	push   0x8(%ebp)
+  803552:	e8 28 df ff ff       	call   80147f <sys_env_service>
+  803557:	85 c0                	test   %eax,%eax
+  803559:	ba 00 00 00 00       	mov    $0x0,%edx
+  80355e:	0f 48 c2             	cmovs  %edx,%eax
+  803561:	c9                   	leave
+  803562:	c3                   	ret
+
+00803563 <pageref>:
+  803563:	55                   	push   %ebp
+  803564:	89 e5                	mov    %esp,%ebp
+  803566:	8b 45 08             	mov    0x8(%ebp),%eax
+  803569:	89 c2                	mov    %eax,%edx
+  80356b:	c1 ea 16             	shr    $0x16,%edx
+  80356e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803575:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357a:	f6 c1 01             	test   $0x1,%cl
+  80357d:	74 22                	je     8035a1 <pageref+0x3e>
+  80357f:	c1 e8 0c             	shr    $0xc,%eax
+  803582:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803589:	a8 01                	test   $0x1,%al
+  80358b:	74 14                	je     8035a1 <pageref+0x3e>
+  80358d:	c1 e8 0c             	shr    $0xc,%eax
+  803590:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803593:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80359a:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80359e:	0f b7 d2             	movzwl %dx,%edx
+  8035a1:	89 d0                	mov    %edx,%eax
+  8035a3:	5d                   	pop    %ebp
+  8035a4:	c3                   	ret
+
+008035a5 <__udivmoddi4>:
+  8035a5:	55                   	push   %ebp
+  8035a6:	57                   	push   %edi
+  8035a7:	56                   	push   %esi
+  8035a8:	53                   	push   %ebx
+  8035a9:	83 ec 24             	sub    $0x24,%esp
+  8035ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035b4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035b8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035bc:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8035c0:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8035c4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035c8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035cc:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8035d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035da:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035df:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035e6:	00 
+  8035e7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035ee:	00 
+  8035ef:	89 fb                	mov    %edi,%ebx
+  8035f1:	eb 08                	jmp    8035fb <__udivmoddi4+0x56>
+  8035f3:	83 e9 01             	sub    $0x1,%ecx
+  8035f6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035f9:	74 68                	je     803663 <__udivmoddi4+0xbe>
+  8035fb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035ff:	01 c0                	add    %eax,%eax
+  803601:	89 c6                	mov    %eax,%esi
+  803603:	89 d7                	mov    %edx,%edi
+  803605:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803609:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80360d:	0f ad d0             	shrd   %cl,%edx,%eax
+  803610:	d3 ea                	shr    %cl,%edx
+  803612:	f6 c1 20             	test   $0x20,%cl
+  803615:	74 04                	je     80361b <__udivmoddi4+0x76>
+  803617:	89 d0                	mov    %edx,%eax
+  803619:	31 d2                	xor    %edx,%edx
+  80361b:	83 e0 01             	and    $0x1,%eax
+  80361e:	89 04 24             	mov    %eax,(%esp)
+  803621:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803628:	00 
+  803629:	8b 04 24             	mov    (%esp),%eax
+  80362c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803630:	09 f0                	or     %esi,%eax
+  803632:	09 fa                	or     %edi,%edx
+  803634:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803638:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80363c:	39 f0                	cmp    %esi,%eax
+  80363e:	89 d5                	mov    %edx,%ebp
+  803640:	19 fd                	sbb    %edi,%ebp
+  803642:	72 af                	jb     8035f3 <__udivmoddi4+0x4e>
+  803644:	29 f0                	sub    %esi,%eax
+  803646:	19 fa                	sbb    %edi,%edx
+  803648:	89 cf                	mov    %ecx,%edi
+  80364a:	c1 ef 05             	shr    $0x5,%edi
+  80364d:	83 e7 01             	and    $0x1,%edi
+  803650:	89 fe                	mov    %edi,%esi
+  803652:	83 f6 01             	xor    $0x1,%esi
+  803655:	d3 e6                	shl    %cl,%esi
+  803657:	d3 e7                	shl    %cl,%edi
+  803659:	09 74 24 18          	or     %esi,0x18(%esp)
+  80365d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803661:	eb 90                	jmp    8035f3 <__udivmoddi4+0x4e>
+  803663:	85 db                	test   %ebx,%ebx
+  803665:	74 05                	je     80366c <__udivmoddi4+0xc7>
+  803667:	89 03                	mov    %eax,(%ebx)
+  803669:	89 53 04             	mov    %edx,0x4(%ebx)
+  80366c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803670:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803674:	83 c4 24             	add    $0x24,%esp
+  803677:	5b                   	pop    %ebx
+  803678:	5e                   	pop    %esi
+  803679:	5f                   	pop    %edi
+  80367a:	5d                   	pop    %ebp
+  80367b:	c3                   	ret
+
+0080367c <__udivdi3>:
+  80367c:	83 ec 08             	sub    $0x8,%esp
+  80367f:	6a 00                	push   $0x0
+  803681:	ff 74 24 1c          	push   0x1c(%esp)
+  803685:	ff 74 24 1c          	push   0x1c(%esp)
+  803689:	ff 74 24 1c          	push   0x1c(%esp)
+  80368d:	ff 74 24 1c          	push   0x1c(%esp)
+  803691:	e8 0f ff ff ff       	call   8035a5 <__udivmoddi4>
+  803696:	83 c4 1c             	add    $0x1c,%esp
+  803699:	c3                   	ret
+
+0080369a <__umoddi3>:
+  80369a:	83 ec 18             	sub    $0x18,%esp
+  80369d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036a1:	50                   	push   %eax
+  8036a2:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a6:	ff 74 24 2c          	push   0x2c(%esp)
+  8036aa:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ae:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b2:	e8 ee fe ff ff       	call   8035a5 <__udivmoddi4>
+  8036b7:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8036bb:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8036bf:	83 c4 2c             	add    $0x2c,%esp
+  8036c2:	c3                   	ret
+
+008036c3 <__divdi3>:
+  8036c3:	53                   	push   %ebx
+  8036c4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036c8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036cc:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036d0:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036d4:	85 d2                	test   %edx,%edx
+  8036d6:	78 12                	js     8036ea <__divdi3+0x27>
+  8036d8:	85 db                	test   %ebx,%ebx
+  8036da:	78 2e                	js     80370a <__divdi3+0x47>
+  8036dc:	53                   	push   %ebx
+  8036dd:	51                   	push   %ecx
+  8036de:	52                   	push   %edx
+  8036df:	50                   	push   %eax
+  8036e0:	e8 97 ff ff ff       	call   80367c <__udivdi3>
+  8036e5:	83 c4 10             	add    $0x10,%esp
+  8036e8:	eb 1e                	jmp    803708 <__divdi3+0x45>
+  8036ea:	f7 d8                	neg    %eax
+  8036ec:	83 d2 00             	adc    $0x0,%edx
+  8036ef:	f7 da                	neg    %edx
+  8036f1:	85 db                	test   %ebx,%ebx
+  8036f3:	78 2a                	js     80371f <__divdi3+0x5c>
+  8036f5:	53                   	push   %ebx
+  8036f6:	51                   	push   %ecx
+  8036f7:	52                   	push   %edx
+  8036f8:	50                   	push   %eax
+  8036f9:	e8 7e ff ff ff       	call   80367c <__udivdi3>
+  8036fe:	83 c4 10             	add    $0x10,%esp
+  803701:	f7 d8                	neg    %eax
+  803703:	83 d2 00             	adc    $0x0,%edx
+  803706:	f7 da                	neg    %edx
+  803708:	5b                   	pop    %ebx
+  803709:	c3                   	ret
+  80370a:	f7 d9                	neg    %ecx
+  80370c:	83 d3 00             	adc    $0x0,%ebx
+  80370f:	f7 db                	neg    %ebx
+  803711:	53                   	push   %ebx
+  803712:	51                   	push   %ecx
+  803713:	52                   	push   %edx
+  803714:	50                   	push   %eax
+  803715:	e8 62 ff ff ff       	call   80367c <__udivdi3>
+  80371a:	83 c4 10             	add    $0x10,%esp
+  80371d:	eb e2                	jmp    803701 <__divdi3+0x3e>
+  80371f:	f7 d9                	neg    %ecx
+  803721:	83 d3 00             	adc    $0x0,%ebx
+  803724:	f7 db                	neg    %ebx
+  803726:	53                   	push   %ebx
+  803727:	51                   	push   %ecx
+  803728:	52                   	push   %edx
+  803729:	50                   	push   %eax
+  80372a:	e8 4d ff ff ff       	call   80367c <__udivdi3>
+  80372f:	83 c4 10             	add    $0x10,%esp
+  803732:	eb d4                	jmp    803708 <__divdi3+0x45>
+
+00803734 <__moddi3>:
+  803734:	55                   	push   %ebp
+  803735:	57                   	push   %edi
+  803736:	56                   	push   %esi
+  803737:	53                   	push   %ebx
+  803738:	83 ec 0c             	sub    $0xc,%esp
+  80373b:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80373f:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803743:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803747:	89 e9                	mov    %ebp,%ecx
+  803749:	f7 d9                	neg    %ecx
+  80374b:	89 d0                	mov    %edx,%eax
+  80374d:	83 d0 00             	adc    $0x0,%eax
+  803750:	f7 d8                	neg    %eax
+  803752:	0f 49 e9             	cmovns %ecx,%ebp
+  803755:	0f 49 d0             	cmovns %eax,%edx
+  803758:	52                   	push   %edx
+  803759:	55                   	push   %ebp
+  80375a:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80375e:	f7 da                	neg    %edx
+  803760:	89 d8                	mov    %ebx,%eax
+  803762:	83 d0 00             	adc    $0x0,%eax
+  803765:	f7 d8                	neg    %eax
+  803767:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80376c:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803770:	0f 48 c3             	cmovs  %ebx,%eax
+  803773:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803777:	ff 74 24 0c          	push   0xc(%esp)
+  80377b:	ff 74 24 0c          	push   0xc(%esp)
+  80377f:	e8 16 ff ff ff       	call   80369a <__umoddi3>
+  803784:	83 c4 10             	add    $0x10,%esp
+  803787:	85 db                	test   %ebx,%ebx
+  803789:	78 08                	js     803793 <__moddi3+0x5f>
+  80378b:	83 c4 0c             	add    $0xc,%esp
+  80378e:	5b                   	pop    %ebx
+  80378f:	5e                   	pop    %esi
+  803790:	5f                   	pop    %edi
+  803791:	5d                   	pop    %ebp
+  803792:	c3                   	ret
+  803793:	f7 d8                	neg    %eax
+  803795:	83 d2 00             	adc    $0x0,%edx
+  803798:	f7 da                	neg    %edx
+  80379a:	eb ef                	jmp    80378b <__moddi3+0x57>
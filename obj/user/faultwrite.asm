@@ -0,0 +1,5034 @@
+
+obj/user/faultwrite.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80003a:	00 00 00 
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800049:	e8 e7 00 00 00       	call   800135 <sys_getenvid>
+  80004e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800053:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800059:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005e:	a3 10 50 80 00       	mov    %eax,0x805010
+  800063:	85 db                	test   %ebx,%ebx
+  800065:	7e 07                	jle    80006e <libmain+0x30>
+  800067:	8b 06                	mov    (%esi),%eax
+  800069:	a3 00 40 80 00       	mov    %eax,0x804000
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	56                   	push   %esi
+  800072:	53                   	push   %ebx
+  800073:	e8 bb ff ff ff       	call   800033 <umain>
+  800078:	e8 0a 00 00 00       	call   800087 <exit>
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800083:	5b                   	pop    %ebx
+  800084:	5e                   	pop    %esi
+  800085:	5d                   	pop    %ebp
+  800086:	c3                   	ret
+
+00800087 <exit>:
+  800087:	55                   	push   %ebp
+  800088:	89 e5                	mov    %esp,%ebp
+  80008a:	83 ec 08             	sub    $0x8,%esp
+  80008d:	a1 10 50 80 00       	mov    0x805010,%eax
+  800092:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800098:	85 c0                	test   %eax,%eax
+  80009a:	75 14                	jne    8000b0 <exit+0x29>
+  80009c:	e8 36 0b 00 00       	call   800bd7 <close_all>
+  8000a1:	83 ec 0c             	sub    $0xc,%esp
+  8000a4:	6a 00                	push   $0x0
+  8000a6:	e8 49 00 00 00       	call   8000f4 <sys_env_destroy>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	c9                   	leave
+  8000af:	c3                   	ret
+  8000b0:	e8 ac 07 00 00       	call   800861 <sys_lease_complete>
+  8000b5:	eb e5                	jmp    80009c <exit+0x15>
+
+008000b7 <sys_cputs>:
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	57                   	push   %edi
+  8000bb:	56                   	push   %esi
+  8000bc:	53                   	push   %ebx
+  8000bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c8:	89 c3                	mov    %eax,%ebx
+  8000ca:	89 c7                	mov    %eax,%edi
+  8000cc:	89 c6                	mov    %eax,%esi
+  8000ce:	cd 30                	int    $0x30
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5f                   	pop    %edi
+  8000d3:	5d                   	pop    %ebp
+  8000d4:	c3                   	ret
+
+008000d5 <sys_cgetc>:
+  8000d5:	55                   	push   %ebp
+  8000d6:	89 e5                	mov    %esp,%ebp
+  8000d8:	57                   	push   %edi
+  8000d9:	56                   	push   %esi
+  8000da:	53                   	push   %ebx
+  8000db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e5:	89 d1                	mov    %edx,%ecx
+  8000e7:	89 d3                	mov    %edx,%ebx
+  8000e9:	89 d7                	mov    %edx,%edi
+  8000eb:	89 d6                	mov    %edx,%esi
+  8000ed:	cd 30                	int    $0x30
+  8000ef:	5b                   	pop    %ebx
+  8000f0:	5e                   	pop    %esi
+  8000f1:	5f                   	pop    %edi
+  8000f2:	5d                   	pop    %ebp
+  8000f3:	c3                   	ret
+
+008000f4 <sys_env_destroy>:
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	57                   	push   %edi
+  8000f8:	56                   	push   %esi
+  8000f9:	53                   	push   %ebx
+  8000fa:	83 ec 0c             	sub    $0xc,%esp
+  8000fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800102:	8b 55 08             	mov    0x8(%ebp),%edx
+  800105:	b8 03 00 00 00       	mov    $0x3,%eax
+  80010a:	89 cb                	mov    %ecx,%ebx
+  80010c:	89 cf                	mov    %ecx,%edi
+  80010e:	89 ce                	mov    %ecx,%esi
+  800110:	cd 30                	int    $0x30
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f 08                	jg     80011e <sys_env_destroy+0x2a>
+  800116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800119:	5b                   	pop    %ebx
+  80011a:	5e                   	pop    %esi
+  80011b:	5f                   	pop    %edi
+  80011c:	5d                   	pop    %ebp
+  80011d:	c3                   	ret
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	50                   	push   %eax
+  800122:	6a 03                	push   $0x3
+  800124:	68 6a 31 80 00       	push   $0x80316a
+  800129:	6a 24                	push   $0x24
+  80012b:	68 87 31 80 00       	push   $0x803187
+  800130:	e8 37 20 00 00       	call   80216c <_panic>
+
+00800135 <sys_getenvid>:
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	57                   	push   %edi
+  800139:	56                   	push   %esi
+  80013a:	53                   	push   %ebx
+  80013b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800140:	b8 02 00 00 00       	mov    $0x2,%eax
+  800145:	89 d1                	mov    %edx,%ecx
+  800147:	89 d3                	mov    %edx,%ebx
+  800149:	89 d7                	mov    %edx,%edi
+  80014b:	89 d6                	mov    %edx,%esi
+  80014d:	cd 30                	int    $0x30
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+
+00800154 <sys_yield>:
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	57                   	push   %edi
+  800158:	56                   	push   %esi
+  800159:	53                   	push   %ebx
+  80015a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800161:	74 26                	je     800189 <sys_yield+0x35>
+  800163:	ba 00 00 00 00       	mov    $0x0,%edx
+  800168:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80016d:	89 d1                	mov    %edx,%ecx
+  80016f:	89 d3                	mov    %edx,%ebx
+  800171:	89 d7                	mov    %edx,%edi
+  800173:	6a 00                	push   $0x0
+  800175:	55                   	push   %ebp
+  800176:	89 e5                	mov    %esp,%ebp
+  800178:	8d 35 80 01 80 00    	lea    0x800180,%esi
+  80017e:	0f 34                	sysenter
+  800180:	5d                   	pop    %ebp
+  800181:	83 c4 04             	add    $0x4,%esp
+  800184:	5b                   	pop    %ebx
+  800185:	5e                   	pop    %esi
+  800186:	5f                   	pop    %edi
+  800187:	5d                   	pop    %ebp
+  800188:	c3                   	ret
+  800189:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800193:	89 d1                	mov    %edx,%ecx
+  800195:	89 d3                	mov    %edx,%ebx
+  800197:	89 d7                	mov    %edx,%edi
+  800199:	89 d6                	mov    %edx,%esi
+  80019b:	cd 30                	int    $0x30
+  80019d:	eb e5                	jmp    800184 <sys_yield+0x30>
+
+0080019f <sys_page_alloc>:
+  80019f:	55                   	push   %ebp
+  8001a0:	89 e5                	mov    %esp,%ebp
+  8001a2:	57                   	push   %edi
+  8001a3:	56                   	push   %esi
+  8001a4:	53                   	push   %ebx
+  8001a5:	83 ec 0c             	sub    $0xc,%esp
+  8001a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001bb:	89 f7                	mov    %esi,%edi
+  8001bd:	cd 30                	int    $0x30
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	7f 08                	jg     8001cb <sys_page_alloc+0x2c>
+  8001c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c6:	5b                   	pop    %ebx
+  8001c7:	5e                   	pop    %esi
+  8001c8:	5f                   	pop    %edi
+  8001c9:	5d                   	pop    %ebp
+  8001ca:	c3                   	ret
+  8001cb:	83 ec 0c             	sub    $0xc,%esp
+  8001ce:	50                   	push   %eax
+  8001cf:	6a 04                	push   $0x4
+  8001d1:	68 6a 31 80 00       	push   $0x80316a
+  8001d6:	6a 24                	push   $0x24
+  8001d8:	68 87 31 80 00       	push   $0x803187
+  8001dd:	e8 8a 1f 00 00       	call   80216c <_panic>
+
+008001e2 <sys_page_map>:
+  8001e2:	55                   	push   %ebp
+  8001e3:	89 e5                	mov    %esp,%ebp
+  8001e5:	57                   	push   %edi
+  8001e6:	56                   	push   %esi
+  8001e7:	53                   	push   %ebx
+  8001e8:	83 ec 0c             	sub    $0xc,%esp
+  8001eb:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8001f2:	74 33                	je     800227 <sys_page_map+0x45>
+  8001f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001fa:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800202:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800205:	ff 75 18             	push   0x18(%ebp)
+  800208:	55                   	push   %ebp
+  800209:	89 e5                	mov    %esp,%ebp
+  80020b:	8d 35 13 02 80 00    	lea    0x800213,%esi
+  800211:	0f 34                	sysenter
+  800213:	5d                   	pop    %ebp
+  800214:	83 c4 04             	add    $0x4,%esp
+  800217:	89 c2                	mov    %eax,%edx
+  800219:	85 c0                	test   %eax,%eax
+  80021b:	7f 3d                	jg     80025a <sys_page_map+0x78>
+  80021d:	89 d0                	mov    %edx,%eax
+  80021f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800222:	5b                   	pop    %ebx
+  800223:	5e                   	pop    %esi
+  800224:	5f                   	pop    %edi
+  800225:	5d                   	pop    %ebp
+  800226:	c3                   	ret
+  800227:	b8 05 00 00 00       	mov    $0x5,%eax
+  80022c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800232:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800235:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800238:	8b 75 18             	mov    0x18(%ebp),%esi
+  80023b:	cd 30                	int    $0x30
+  80023d:	89 c2                	mov    %eax,%edx
+  80023f:	85 c0                	test   %eax,%eax
+  800241:	7e da                	jle    80021d <sys_page_map+0x3b>
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	50                   	push   %eax
+  800247:	6a 05                	push   $0x5
+  800249:	68 6a 31 80 00       	push   $0x80316a
+  80024e:	6a 24                	push   $0x24
+  800250:	68 87 31 80 00       	push   $0x803187
+  800255:	e8 12 1f 00 00       	call   80216c <_panic>
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+  80025d:	50                   	push   %eax
+  80025e:	6a 05                	push   $0x5
+  800260:	68 6a 31 80 00       	push   $0x80316a
+  800265:	6a 48                	push   $0x48
+  800267:	68 87 31 80 00       	push   $0x803187
+  80026c:	e8 fb 1e 00 00       	call   80216c <_panic>
+
+00800271 <sys_page_unmap>:
+  800271:	55                   	push   %ebp
+  800272:	89 e5                	mov    %esp,%ebp
+  800274:	57                   	push   %edi
+  800275:	56                   	push   %esi
+  800276:	53                   	push   %ebx
+  800277:	83 ec 0c             	sub    $0xc,%esp
+  80027a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80027f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800282:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800285:	b8 06 00 00 00       	mov    $0x6,%eax
+  80028a:	89 df                	mov    %ebx,%edi
+  80028c:	89 de                	mov    %ebx,%esi
+  80028e:	cd 30                	int    $0x30
+  800290:	85 c0                	test   %eax,%eax
+  800292:	7f 08                	jg     80029c <sys_page_unmap+0x2b>
+  800294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800297:	5b                   	pop    %ebx
+  800298:	5e                   	pop    %esi
+  800299:	5f                   	pop    %edi
+  80029a:	5d                   	pop    %ebp
+  80029b:	c3                   	ret
+  80029c:	83 ec 0c             	sub    $0xc,%esp
+  80029f:	50                   	push   %eax
+  8002a0:	6a 06                	push   $0x6
+  8002a2:	68 6a 31 80 00       	push   $0x80316a
+  8002a7:	6a 24                	push   $0x24
+  8002a9:	68 87 31 80 00       	push   $0x803187
+  8002ae:	e8 b9 1e 00 00       	call   80216c <_panic>
+
+008002b3 <sys_fork>:
+  8002b3:	55                   	push   %ebp
+  8002b4:	89 e5                	mov    %esp,%ebp
+  8002b6:	57                   	push   %edi
+  8002b7:	56                   	push   %esi
+  8002b8:	53                   	push   %ebx
+  8002b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002be:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	89 d3                	mov    %edx,%ebx
+  8002c7:	89 d7                	mov    %edx,%edi
+  8002c9:	89 d6                	mov    %edx,%esi
+  8002cb:	cd 30                	int    $0x30
+  8002cd:	5b                   	pop    %ebx
+  8002ce:	5e                   	pop    %esi
+  8002cf:	5f                   	pop    %edi
+  8002d0:	5d                   	pop    %ebp
+  8002d1:	c3                   	ret
+
+008002d2 <sys_env_set_status>:
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	57                   	push   %edi
+  8002d6:	56                   	push   %esi
+  8002d7:	53                   	push   %ebx
+  8002d8:	83 ec 0c             	sub    $0xc,%esp
+  8002db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002e6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002eb:	89 df                	mov    %ebx,%edi
+  8002ed:	89 de                	mov    %ebx,%esi
+  8002ef:	cd 30                	int    $0x30
+  8002f1:	85 c0                	test   %eax,%eax
+  8002f3:	7f 08                	jg     8002fd <sys_env_set_status+0x2b>
+  8002f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f8:	5b                   	pop    %ebx
+  8002f9:	5e                   	pop    %esi
+  8002fa:	5f                   	pop    %edi
+  8002fb:	5d                   	pop    %ebp
+  8002fc:	c3                   	ret
+  8002fd:	83 ec 0c             	sub    $0xc,%esp
+  800300:	50                   	push   %eax
+  800301:	6a 08                	push   $0x8
+  800303:	68 6a 31 80 00       	push   $0x80316a
+  800308:	6a 24                	push   $0x24
+  80030a:	68 87 31 80 00       	push   $0x803187
+  80030f:	e8 58 1e 00 00       	call   80216c <_panic>
+
+00800314 <sys_env_set_trapframe>:
+  800314:	55                   	push   %ebp
+  800315:	89 e5                	mov    %esp,%ebp
+  800317:	57                   	push   %edi
+  800318:	56                   	push   %esi
+  800319:	53                   	push   %ebx
+  80031a:	83 ec 0c             	sub    $0xc,%esp
+  80031d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800322:	8b 55 08             	mov    0x8(%ebp),%edx
+  800325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800328:	b8 09 00 00 00       	mov    $0x9,%eax
+  80032d:	89 df                	mov    %ebx,%edi
+  80032f:	89 de                	mov    %ebx,%esi
+  800331:	cd 30                	int    $0x30
+  800333:	85 c0                	test   %eax,%eax
+  800335:	7f 08                	jg     80033f <sys_env_set_trapframe+0x2b>
+  800337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033a:	5b                   	pop    %ebx
+  80033b:	5e                   	pop    %esi
+  80033c:	5f                   	pop    %edi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+  80033f:	83 ec 0c             	sub    $0xc,%esp
+  800342:	50                   	push   %eax
+  800343:	6a 09                	push   $0x9
+  800345:	68 6a 31 80 00       	push   $0x80316a
+  80034a:	6a 24                	push   $0x24
+  80034c:	68 87 31 80 00       	push   $0x803187
+  800351:	e8 16 1e 00 00       	call   80216c <_panic>
+
+00800356 <sys_env_set_cow>:
+  800356:	55                   	push   %ebp
+  800357:	89 e5                	mov    %esp,%ebp
+  800359:	57                   	push   %edi
+  80035a:	56                   	push   %esi
+  80035b:	53                   	push   %ebx
+  80035c:	83 ec 0c             	sub    $0xc,%esp
+  80035f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800364:	8b 55 08             	mov    0x8(%ebp),%edx
+  800367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80036a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80036f:	89 df                	mov    %ebx,%edi
+  800371:	89 de                	mov    %ebx,%esi
+  800373:	cd 30                	int    $0x30
+  800375:	85 c0                	test   %eax,%eax
+  800377:	7f 08                	jg     800381 <sys_env_set_cow+0x2b>
+  800379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037c:	5b                   	pop    %ebx
+  80037d:	5e                   	pop    %esi
+  80037e:	5f                   	pop    %edi
+  80037f:	5d                   	pop    %ebp
+  800380:	c3                   	ret
+  800381:	83 ec 0c             	sub    $0xc,%esp
+  800384:	50                   	push   %eax
+  800385:	6a 20                	push   $0x20
+  800387:	68 6a 31 80 00       	push   $0x80316a
+  80038c:	6a 24                	push   $0x24
+  80038e:	68 87 31 80 00       	push   $0x803187
+  800393:	e8 d4 1d 00 00       	call   80216c <_panic>
+
+00800398 <sys_env_service>:
+  800398:	55                   	push   %ebp
+  800399:	89 e5                	mov    %esp,%ebp
+  80039b:	57                   	push   %edi
+  80039c:	56                   	push   %esi
+  80039d:	53                   	push   %ebx
+  80039e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003ab:	89 cb                	mov    %ecx,%ebx
+  8003ad:	89 cf                	mov    %ecx,%edi
+  8003af:	89 ce                	mov    %ecx,%esi
+  8003b1:	cd 30                	int    $0x30
+  8003b3:	5b                   	pop    %ebx
+  8003b4:	5e                   	pop    %esi
+  8003b5:	5f                   	pop    %edi
+  8003b6:	5d                   	pop    %ebp
+  8003b7:	c3                   	ret
+
+008003b8 <sys_env_set_pgfault_upcall>:
+  8003b8:	55                   	push   %ebp
+  8003b9:	89 e5                	mov    %esp,%ebp
+  8003bb:	57                   	push   %edi
+  8003bc:	56                   	push   %esi
+  8003bd:	53                   	push   %ebx
+  8003be:	83 ec 0c             	sub    $0xc,%esp
+  8003c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003d1:	89 df                	mov    %ebx,%edi
+  8003d3:	89 de                	mov    %ebx,%esi
+  8003d5:	cd 30                	int    $0x30
+  8003d7:	85 c0                	test   %eax,%eax
+  8003d9:	7f 08                	jg     8003e3 <sys_env_set_pgfault_upcall+0x2b>
+  8003db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003de:	5b                   	pop    %ebx
+  8003df:	5e                   	pop    %esi
+  8003e0:	5f                   	pop    %edi
+  8003e1:	5d                   	pop    %ebp
+  8003e2:	c3                   	ret
+  8003e3:	83 ec 0c             	sub    $0xc,%esp
+  8003e6:	50                   	push   %eax
+  8003e7:	6a 0a                	push   $0xa
+  8003e9:	68 6a 31 80 00       	push   $0x80316a
+  8003ee:	6a 24                	push   $0x24
+  8003f0:	68 87 31 80 00       	push   $0x803187
+  8003f5:	e8 72 1d 00 00       	call   80216c <_panic>
+
+008003fa <sys_ipc_try_send>:
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	57                   	push   %edi
+  8003fe:	56                   	push   %esi
+  8003ff:	53                   	push   %ebx
+  800400:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800407:	74 27                	je     800430 <sys_ipc_try_send+0x36>
+  800409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80040c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80040f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800414:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800417:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80041a:	6a 00                	push   $0x0
+  80041c:	55                   	push   %ebp
+  80041d:	89 e5                	mov    %esp,%ebp
+  80041f:	8d 35 27 04 80 00    	lea    0x800427,%esi
+  800425:	0f 34                	sysenter
+  800427:	5d                   	pop    %ebp
+  800428:	83 c4 04             	add    $0x4,%esp
+  80042b:	5b                   	pop    %ebx
+  80042c:	5e                   	pop    %esi
+  80042d:	5f                   	pop    %edi
+  80042e:	5d                   	pop    %ebp
+  80042f:	c3                   	ret
+  800430:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800435:	be 00 00 00 00       	mov    $0x0,%esi
+  80043a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800440:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800443:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800446:	cd 30                	int    $0x30
+  800448:	eb e1                	jmp    80042b <sys_ipc_try_send+0x31>
+
+0080044a <sys_ipc_recv>:
+  80044a:	55                   	push   %ebp
+  80044b:	89 e5                	mov    %esp,%ebp
+  80044d:	57                   	push   %edi
+  80044e:	56                   	push   %esi
+  80044f:	53                   	push   %ebx
+  800450:	83 ec 0c             	sub    $0xc,%esp
+  800453:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80045a:	74 32                	je     80048e <sys_ipc_recv+0x44>
+  80045c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800464:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800469:	89 cb                	mov    %ecx,%ebx
+  80046b:	89 cf                	mov    %ecx,%edi
+  80046d:	6a 00                	push   $0x0
+  80046f:	55                   	push   %ebp
+  800470:	89 e5                	mov    %esp,%ebp
+  800472:	8d 35 7a 04 80 00    	lea    0x80047a,%esi
+  800478:	0f 34                	sysenter
+  80047a:	5d                   	pop    %ebp
+  80047b:	83 c4 04             	add    $0x4,%esp
+  80047e:	89 c2                	mov    %eax,%edx
+  800480:	85 c0                	test   %eax,%eax
+  800482:	7f 3c                	jg     8004c0 <sys_ipc_recv+0x76>
+  800484:	89 d0                	mov    %edx,%eax
+  800486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800489:	5b                   	pop    %ebx
+  80048a:	5e                   	pop    %esi
+  80048b:	5f                   	pop    %edi
+  80048c:	5d                   	pop    %ebp
+  80048d:	c3                   	ret
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800493:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800498:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049b:	89 cb                	mov    %ecx,%ebx
+  80049d:	89 cf                	mov    %ecx,%edi
+  80049f:	89 ce                	mov    %ecx,%esi
+  8004a1:	cd 30                	int    $0x30
+  8004a3:	89 c2                	mov    %eax,%edx
+  8004a5:	85 c0                	test   %eax,%eax
+  8004a7:	7e db                	jle    800484 <sys_ipc_recv+0x3a>
+  8004a9:	83 ec 0c             	sub    $0xc,%esp
+  8004ac:	50                   	push   %eax
+  8004ad:	6a 0d                	push   $0xd
+  8004af:	68 6a 31 80 00       	push   $0x80316a
+  8004b4:	6a 24                	push   $0x24
+  8004b6:	68 87 31 80 00       	push   $0x803187
+  8004bb:	e8 ac 1c 00 00       	call   80216c <_panic>
+  8004c0:	83 ec 0c             	sub    $0xc,%esp
+  8004c3:	50                   	push   %eax
+  8004c4:	6a 0d                	push   $0xd
+  8004c6:	68 6a 31 80 00       	push   $0x80316a
+  8004cb:	6a 48                	push   $0x48
+  8004cd:	68 87 31 80 00       	push   $0x803187
+  8004d2:	e8 95 1c 00 00       	call   80216c <_panic>
+
+008004d7 <sys_ipc_send>:
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	57                   	push   %edi
+  8004db:	56                   	push   %esi
+  8004dc:	53                   	push   %ebx
+  8004dd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004e4:	74 27                	je     80050d <sys_ipc_send+0x36>
+  8004e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f7:	6a 00                	push   $0x0
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	8d 35 04 05 80 00    	lea    0x800504,%esi
+  800502:	0f 34                	sysenter
+  800504:	5d                   	pop    %ebp
+  800505:	83 c4 04             	add    $0x4,%esp
+  800508:	5b                   	pop    %ebx
+  800509:	5e                   	pop    %esi
+  80050a:	5f                   	pop    %edi
+  80050b:	5d                   	pop    %ebp
+  80050c:	c3                   	ret
+  80050d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800512:	be 00 00 00 00       	mov    $0x0,%esi
+  800517:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80051d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800520:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800523:	cd 30                	int    $0x30
+  800525:	eb e1                	jmp    800508 <sys_ipc_send+0x31>
+
+00800527 <sys_ipc_call>:
+  800527:	55                   	push   %ebp
+  800528:	89 e5                	mov    %esp,%ebp
+  80052a:	57                   	push   %edi
+  80052b:	56                   	push   %esi
+  80052c:	53                   	push   %ebx
+  80052d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800530:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800533:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80053b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80053e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800541:	cd 30                	int    $0x30
+  800543:	5b                   	pop    %ebx
+  800544:	5e                   	pop    %esi
+  800545:	5f                   	pop    %edi
+  800546:	5d                   	pop    %ebp
+  800547:	c3                   	ret
+
+00800548 <sys_ipc_reply_recv>:
+  800548:	55                   	push   %ebp
+  800549:	89 e5                	mov    %esp,%ebp
+  80054b:	57                   	push   %edi
+  80054c:	56                   	push   %esi
+  80054d:	53                   	push   %ebx
+  80054e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800551:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800554:	b8 10 00 00 00       	mov    $0x10,%eax
+  800559:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80055c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80055f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800562:	cd 30                	int    $0x30
+  800564:	5b                   	pop    %ebx
+  800565:	5e                   	pop    %esi
+  800566:	5f                   	pop    %edi
+  800567:	5d                   	pop    %ebp
+  800568:	c3                   	ret
+
+00800569 <sys_time_msec>:
+  800569:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80056e:	85 c0                	test   %eax,%eax
+  800570:	75 06                	jne    800578 <sys_time_msec+0xf>
+  800572:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  800577:	c3                   	ret
+  800578:	55                   	push   %ebp
+  800579:	89 e5                	mov    %esp,%ebp
+  80057b:	57                   	push   %edi
+  80057c:	56                   	push   %esi
+  80057d:	53                   	push   %ebx
+  80057e:	83 ec 0c             	sub    $0xc,%esp
+  800581:	0f 31                	rdtsc
+  800583:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800589:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80058f:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  800595:	29 c8                	sub    %ecx,%eax
+  800597:	19 da                	sbb    %ebx,%edx
+  800599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80059e:	57                   	push   %edi
+  80059f:	56                   	push   %esi
+  8005a0:	52                   	push   %edx
+  8005a1:	50                   	push   %eax
+  8005a2:	e8 95 2a 00 00       	call   80303c <__udivdi3>
+  8005a7:	83 c4 10             	add    $0x10,%esp
+  8005aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ad:	5b                   	pop    %ebx
+  8005ae:	5e                   	pop    %esi
+  8005af:	5f                   	pop    %edi
+  8005b0:	5d                   	pop    %ebp
+  8005b1:	c3                   	ret
+
+008005b2 <sys_env_swap>:
+  8005b2:	55                   	push   %ebp
+  8005b3:	89 e5                	mov    %esp,%ebp
+  8005b5:	57                   	push   %edi
+  8005b6:	56                   	push   %esi
+  8005b7:	53                   	push   %ebx
+  8005b8:	83 ec 0c             	sub    $0xc,%esp
+  8005bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005c8:	89 cb                	mov    %ecx,%ebx
+  8005ca:	89 cf                	mov    %ecx,%edi
+  8005cc:	89 ce                	mov    %ecx,%esi
+  8005ce:	cd 30                	int    $0x30
+  8005d0:	85 c0                	test   %eax,%eax
+  8005d2:	7f 08                	jg     8005dc <sys_env_swap+0x2a>
+  8005d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d7:	5b                   	pop    %ebx
+  8005d8:	5e                   	pop    %esi
+  8005d9:	5f                   	pop    %edi
+  8005da:	5d                   	pop    %ebp
+  8005db:	c3                   	ret
+  8005dc:	83 ec 0c             	sub    $0xc,%esp
+  8005df:	50                   	push   %eax
+  8005e0:	6a 12                	push   $0x12
+  8005e2:	68 6a 31 80 00       	push   $0x80316a
+  8005e7:	6a 24                	push   $0x24
+  8005e9:	68 87 31 80 00       	push   $0x803187
+  8005ee:	e8 79 1b 00 00       	call   80216c <_panic>
+
+008005f3 <sys_net_try_send>:
+  8005f3:	55                   	push   %ebp
+  8005f4:	89 e5                	mov    %esp,%ebp
+  8005f6:	57                   	push   %edi
+  8005f7:	56                   	push   %esi
+  8005f8:	53                   	push   %ebx
+  8005f9:	83 ec 0c             	sub    $0xc,%esp
+  8005fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800601:	8b 55 08             	mov    0x8(%ebp),%edx
+  800604:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800607:	b8 13 00 00 00       	mov    $0x13,%eax
+  80060c:	89 df                	mov    %ebx,%edi
+  80060e:	89 de                	mov    %ebx,%esi
+  800610:	cd 30                	int    $0x30
+  800612:	85 c0                	test   %eax,%eax
+  800614:	7f 08                	jg     80061e <sys_net_try_send+0x2b>
+  800616:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800619:	5b                   	pop    %ebx
+  80061a:	5e                   	pop    %esi
+  80061b:	5f                   	pop    %edi
+  80061c:	5d                   	pop    %ebp
+  80061d:	c3                   	ret
+  80061e:	83 ec 0c             	sub    $0xc,%esp
+  800621:	50                   	push   %eax
+  800622:	6a 13                	push   $0x13
+  800624:	68 6a 31 80 00       	push   $0x80316a
+  800629:	6a 24                	push   $0x24
+  80062b:	68 87 31 80 00       	push   $0x803187
+  800630:	e8 37 1b 00 00       	call   80216c <_panic>
+
+00800635 <sys_net_try_receive>:
+  800635:	55                   	push   %ebp
+  800636:	89 e5                	mov    %esp,%ebp
+  800638:	57                   	push   %edi
+  800639:	56                   	push   %esi
+  80063a:	53                   	push   %ebx
+  80063b:	83 ec 0c             	sub    $0xc,%esp
+  80063e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800643:	8b 55 08             	mov    0x8(%ebp),%edx
+  800646:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800649:	b8 14 00 00 00       	mov    $0x14,%eax
+  80064e:	89 df                	mov    %ebx,%edi
+  800650:	89 de                	mov    %ebx,%esi
+  800652:	cd 30                	int    $0x30
+  800654:	85 c0                	test   %eax,%eax
+  800656:	7f 08                	jg     800660 <sys_net_try_receive+0x2b>
+  800658:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80065b:	5b                   	pop    %ebx
+  80065c:	5e                   	pop    %esi
+  80065d:	5f                   	pop    %edi
+  80065e:	5d                   	pop    %ebp
+  80065f:	c3                   	ret
+  800660:	83 ec 0c             	sub    $0xc,%esp
+  800663:	50                   	push   %eax
+  800664:	6a 14                	push   $0x14
+  800666:	68 6a 31 80 00       	push   $0x80316a
+  80066b:	6a 24                	push   $0x24
+  80066d:	68 87 31 80 00       	push   $0x803187
+  800672:	e8 f5 1a 00 00       	call   80216c <_panic>
+
+00800677 <sys_net_recv_page>:
+  800677:	55                   	push   %ebp
+  800678:	89 e5                	mov    %esp,%ebp
+  80067a:	57                   	push   %edi
+  80067b:	56                   	push   %esi
+  80067c:	53                   	push   %ebx
+  80067d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800682:	8b 55 08             	mov    0x8(%ebp),%edx
+  800685:	b8 27 00 00 00       	mov    $0x27,%eax
+  80068a:	89 cb                	mov    %ecx,%ebx
+  80068c:	89 cf                	mov    %ecx,%edi
+  80068e:	89 ce                	mov    %ecx,%esi
+  800690:	cd 30                	int    $0x30
+  800692:	5b                   	pop    %ebx
+  800693:	5e                   	pop    %esi
+  800694:	5f                   	pop    %edi
+  800695:	5d                   	pop    %ebp
+  800696:	c3                   	ret
+
+00800697 <sys_net_wait>:
+  800697:	55                   	push   %ebp
+  800698:	89 e5                	mov    %esp,%ebp
+  80069a:	57                   	push   %edi
+  80069b:	56                   	push   %esi
+  80069c:	53                   	push   %ebx
+  80069d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a2:	b8 26 00 00 00       	mov    $0x26,%eax
+  8006a7:	89 d1                	mov    %edx,%ecx
+  8006a9:	89 d3                	mov    %edx,%ebx
+  8006ab:	89 d7                	mov    %edx,%edi
+  8006ad:	89 d6                	mov    %edx,%esi
+  8006af:	cd 30                	int    $0x30
+  8006b1:	5b                   	pop    %ebx
+  8006b2:	5e                   	pop    %esi
+  8006b3:	5f                   	pop    %edi
+  8006b4:	5d                   	pop    %ebp
+  8006b5:	c3                   	ret
+
+008006b6 <sys_get_mac>:
+  8006b6:	55                   	push   %ebp
+  8006b7:	89 e5                	mov    %esp,%ebp
+  8006b9:	57                   	push   %edi
+  8006ba:	56                   	push   %esi
+  8006bb:	53                   	push   %ebx
+  8006bc:	83 ec 0c             	sub    $0xc,%esp
+  8006bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006ca:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006cf:	89 df                	mov    %ebx,%edi
+  8006d1:	89 de                	mov    %ebx,%esi
+  8006d3:	cd 30                	int    $0x30
+  8006d5:	85 c0                	test   %eax,%eax
+  8006d7:	7f 08                	jg     8006e1 <sys_get_mac+0x2b>
+  8006d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006dc:	5b                   	pop    %ebx
+  8006dd:	5e                   	pop    %esi
+  8006de:	5f                   	pop    %edi
+  8006df:	5d                   	pop    %ebp
+  8006e0:	c3                   	ret
+  8006e1:	83 ec 0c             	sub    $0xc,%esp
+  8006e4:	50                   	push   %eax
+  8006e5:	6a 15                	push   $0x15
+  8006e7:	68 6a 31 80 00       	push   $0x80316a
+  8006ec:	6a 24                	push   $0x24
+  8006ee:	68 87 31 80 00       	push   $0x803187
+  8006f3:	e8 74 1a 00 00       	call   80216c <_panic>
+
+008006f8 <sys_env_lease>:
+  8006f8:	55                   	push   %ebp
+  8006f9:	89 e5                	mov    %esp,%ebp
+  8006fb:	57                   	push   %edi
+  8006fc:	56                   	push   %esi
+  8006fd:	53                   	push   %ebx
+  8006fe:	83 ec 0c             	sub    $0xc,%esp
+  800701:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800706:	8b 55 08             	mov    0x8(%ebp),%edx
+  800709:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80070c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800711:	89 df                	mov    %ebx,%edi
+  800713:	89 de                	mov    %ebx,%esi
+  800715:	cd 30                	int    $0x30
+  800717:	85 c0                	test   %eax,%eax
+  800719:	7f 08                	jg     800723 <sys_env_lease+0x2b>
+  80071b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80071e:	5b                   	pop    %ebx
+  80071f:	5e                   	pop    %esi
+  800720:	5f                   	pop    %edi
+  800721:	5d                   	pop    %ebp
+  800722:	c3                   	ret
+  800723:	83 ec 0c             	sub    $0xc,%esp
+  800726:	50                   	push   %eax
+  800727:	6a 16                	push   $0x16
+  800729:	68 6a 31 80 00       	push   $0x80316a
+  80072e:	6a 24                	push   $0x24
+  800730:	68 87 31 80 00       	push   $0x803187
+  800735:	e8 32 1a 00 00       	call   80216c <_panic>
+
+0080073a <sys_copy_mem>:
+  80073a:	55                   	push   %ebp
+  80073b:	89 e5                	mov    %esp,%ebp
+  80073d:	57                   	push   %edi
+  80073e:	56                   	push   %esi
+  80073f:	53                   	push   %ebx
+  800740:	83 ec 0c             	sub    $0xc,%esp
+  800743:	8b 55 08             	mov    0x8(%ebp),%edx
+  800746:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800749:	b8 17 00 00 00       	mov    $0x17,%eax
+  80074e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800751:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800754:	8b 75 18             	mov    0x18(%ebp),%esi
+  800757:	cd 30                	int    $0x30
+  800759:	85 c0                	test   %eax,%eax
+  80075b:	7f 08                	jg     800765 <sys_copy_mem+0x2b>
+  80075d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800760:	5b                   	pop    %ebx
+  800761:	5e                   	pop    %esi
+  800762:	5f                   	pop    %edi
+  800763:	5d                   	pop    %ebp
+  800764:	c3                   	ret
+  800765:	83 ec 0c             	sub    $0xc,%esp
+  800768:	50                   	push   %eax
+  800769:	6a 17                	push   $0x17
+  80076b:	68 6a 31 80 00       	push   $0x80316a
+  800770:	6a 24                	push   $0x24
+  800772:	68 87 31 80 00       	push   $0x803187
+  800777:	e8 f0 19 00 00       	call   80216c <_panic>
+
+0080077c <sys_get_perms>:
+  80077c:	55                   	push   %ebp
+  80077d:	89 e5                	mov    %esp,%ebp
+  80077f:	57                   	push   %edi
+  800780:	56                   	push   %esi
+  800781:	53                   	push   %ebx
+  800782:	83 ec 0c             	sub    $0xc,%esp
+  800785:	be 00 00 00 00       	mov    $0x0,%esi
+  80078a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80078d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800790:	b8 18 00 00 00       	mov    $0x18,%eax
+  800795:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800798:	89 f7                	mov    %esi,%edi
+  80079a:	cd 30                	int    $0x30
+  80079c:	85 c0                	test   %eax,%eax
+  80079e:	7f 08                	jg     8007a8 <sys_get_perms+0x2c>
+  8007a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a3:	5b                   	pop    %ebx
+  8007a4:	5e                   	pop    %esi
+  8007a5:	5f                   	pop    %edi
+  8007a6:	5d                   	pop    %ebp
+  8007a7:	c3                   	ret
+  8007a8:	83 ec 0c             	sub    $0xc,%esp
+  8007ab:	50                   	push   %eax
+  8007ac:	6a 18                	push   $0x18
+  8007ae:	68 6a 31 80 00       	push   $0x80316a
+  8007b3:	6a 24                	push   $0x24
+  8007b5:	68 87 31 80 00       	push   $0x803187
+  8007ba:	e8 ad 19 00 00       	call   80216c <_panic>
+
+008007bf <sys_env_unsuspend>:
+  8007bf:	55                   	push   %ebp
+  8007c0:	89 e5                	mov    %esp,%ebp
+  8007c2:	57                   	push   %edi
+  8007c3:	56                   	push   %esi
+  8007c4:	53                   	push   %ebx
+  8007c5:	83 ec 0c             	sub    $0xc,%esp
+  8007c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8007cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d3:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007db:	89 f7                	mov    %esi,%edi
+  8007dd:	cd 30                	int    $0x30
+  8007df:	85 c0                	test   %eax,%eax
+  8007e1:	7f 08                	jg     8007eb <sys_env_unsuspend+0x2c>
+  8007e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e6:	5b                   	pop    %ebx
+  8007e7:	5e                   	pop    %esi
+  8007e8:	5f                   	pop    %edi
+  8007e9:	5d                   	pop    %ebp
+  8007ea:	c3                   	ret
+  8007eb:	83 ec 0c             	sub    $0xc,%esp
+  8007ee:	50                   	push   %eax
+  8007ef:	6a 19                	push   $0x19
+  8007f1:	68 6a 31 80 00       	push   $0x80316a
+  8007f6:	6a 24                	push   $0x24
+  8007f8:	68 87 31 80 00       	push   $0x803187
+  8007fd:	e8 6a 19 00 00       	call   80216c <_panic>
+
+00800802 <sys_migrate>:
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	57                   	push   %edi
+  800806:	56                   	push   %esi
+  800807:	53                   	push   %ebx
+  800808:	83 ec 0c             	sub    $0xc,%esp
+  80080b:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800810:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  800816:	76 11                	jbe    800829 <sys_migrate+0x27>
+  800818:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80081d:	0f b6 08             	movzbl (%eax),%ecx
+  800820:	05 00 10 00 00       	add    $0x1000,%eax
+  800825:	39 d0                	cmp    %edx,%eax
+  800827:	72 f4                	jb     80081d <sys_migrate+0x1b>
+  800829:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800831:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800836:	89 cb                	mov    %ecx,%ebx
+  800838:	89 cf                	mov    %ecx,%edi
+  80083a:	89 ce                	mov    %ecx,%esi
+  80083c:	cd 30                	int    $0x30
+  80083e:	85 c0                	test   %eax,%eax
+  800840:	7f 08                	jg     80084a <sys_migrate+0x48>
+  800842:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800845:	5b                   	pop    %ebx
+  800846:	5e                   	pop    %esi
+  800847:	5f                   	pop    %edi
+  800848:	5d                   	pop    %ebp
+  800849:	c3                   	ret
+  80084a:	83 ec 0c             	sub    $0xc,%esp
+  80084d:	50                   	push   %eax
+  80084e:	6a 1a                	push   $0x1a
+  800850:	68 6a 31 80 00       	push   $0x80316a
+  800855:	6a 24                	push   $0x24
+  800857:	68 87 31 80 00       	push   $0x803187
+  80085c:	e8 0b 19 00 00       	call   80216c <_panic>
+
+00800861 <sys_lease_complete>:
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	57                   	push   %edi
+  800865:	56                   	push   %esi
+  800866:	53                   	push   %ebx
+  800867:	83 ec 0c             	sub    $0xc,%esp
+  80086a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800874:	89 d1                	mov    %edx,%ecx
+  800876:	89 d3                	mov    %edx,%ebx
+  800878:	89 d7                	mov    %edx,%edi
+  80087a:	89 d6                	mov    %edx,%esi
+  80087c:	cd 30                	int    $0x30
+  80087e:	85 c0                	test   %eax,%eax
+  800880:	7f 08                	jg     80088a <sys_lease_complete+0x29>
+  800882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800885:	5b                   	pop    %ebx
+  800886:	5e                   	pop    %esi
+  800887:	5f                   	pop    %edi
+  800888:	5d                   	pop    %ebp
+  800889:	c3                   	ret
+  80088a:	83 ec 0c             	sub    $0xc,%esp
+  80088d:	50                   	push   %eax
+  80088e:	6a 1b                	push   $0x1b
+  800890:	68 6a 31 80 00       	push   $0x80316a
+  800895:	6a 24                	push   $0x24
+  800897:	68 87 31 80 00       	push   $0x803187
+  80089c:	e8 cb 18 00 00       	call   80216c <_panic>
+
+008008a1 <sys_env_set_thisenv>:
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	57                   	push   %edi
+  8008a5:	56                   	push   %esi
+  8008a6:	53                   	push   %ebx
+  8008a7:	83 ec 0c             	sub    $0xc,%esp
+  8008aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008ba:	89 df                	mov    %ebx,%edi
+  8008bc:	89 de                	mov    %ebx,%esi
+  8008be:	cd 30                	int    $0x30
+  8008c0:	85 c0                	test   %eax,%eax
+  8008c2:	7f 08                	jg     8008cc <sys_env_set_thisenv+0x2b>
+  8008c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c7:	5b                   	pop    %ebx
+  8008c8:	5e                   	pop    %esi
+  8008c9:	5f                   	pop    %edi
+  8008ca:	5d                   	pop    %ebp
+  8008cb:	c3                   	ret
+  8008cc:	83 ec 0c             	sub    $0xc,%esp
+  8008cf:	50                   	push   %eax
+  8008d0:	6a 1c                	push   $0x1c
+  8008d2:	68 6a 31 80 00       	push   $0x80316a
+  8008d7:	6a 24                	push   $0x24
+  8008d9:	68 87 31 80 00       	push   $0x803187
+  8008de:	e8 89 18 00 00       	call   80216c <_panic>
+
+008008e3 <sys_env_set_sched>:
+  8008e3:	55                   	push   %ebp
+  8008e4:	89 e5                	mov    %esp,%ebp
+  8008e6:	57                   	push   %edi
+  8008e7:	56                   	push   %esi
+  8008e8:	53                   	push   %ebx
+  8008e9:	83 ec 0c             	sub    $0xc,%esp
+  8008ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8008fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008ff:	89 f7                	mov    %esi,%edi
+  800901:	cd 30                	int    $0x30
+  800903:	85 c0                	test   %eax,%eax
+  800905:	7f 08                	jg     80090f <sys_env_set_sched+0x2c>
+  800907:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80090a:	5b                   	pop    %ebx
+  80090b:	5e                   	pop    %esi
+  80090c:	5f                   	pop    %edi
+  80090d:	5d                   	pop    %ebp
+  80090e:	c3                   	ret
+  80090f:	83 ec 0c             	sub    $0xc,%esp
+  800912:	50                   	push   %eax
+  800913:	6a 1d                	push   $0x1d
+  800915:	68 6a 31 80 00       	push   $0x80316a
+  80091a:	6a 24                	push   $0x24
+  80091c:	68 87 31 80 00       	push   $0x803187
+  800921:	e8 46 18 00 00       	call   80216c <_panic>
+
+00800926 <sys_batch>:
+  800926:	55                   	push   %ebp
+  800927:	89 e5                	mov    %esp,%ebp
+  800929:	57                   	push   %edi
+  80092a:	56                   	push   %esi
+  80092b:	53                   	push   %ebx
+  80092c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800931:	8b 55 08             	mov    0x8(%ebp),%edx
+  800934:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800937:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80093c:	89 df                	mov    %ebx,%edi
+  80093e:	89 de                	mov    %ebx,%esi
+  800940:	cd 30                	int    $0x30
+  800942:	5b                   	pop    %ebx
+  800943:	5e                   	pop    %esi
+  800944:	5f                   	pop    %edi
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+
+00800947 <sys_env_stats>:
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	57                   	push   %edi
+  80094b:	56                   	push   %esi
+  80094c:	53                   	push   %ebx
+  80094d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800952:	8b 55 08             	mov    0x8(%ebp),%edx
+  800955:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800958:	b8 23 00 00 00       	mov    $0x23,%eax
+  80095d:	89 df                	mov    %ebx,%edi
+  80095f:	89 de                	mov    %ebx,%esi
+  800961:	cd 30                	int    $0x30
+  800963:	5b                   	pop    %ebx
+  800964:	5e                   	pop    %esi
+  800965:	5f                   	pop    %edi
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <sys_trace>:
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	57                   	push   %edi
+  80096c:	56                   	push   %esi
+  80096d:	53                   	push   %ebx
+  80096e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800973:	8b 55 08             	mov    0x8(%ebp),%edx
+  800976:	b8 24 00 00 00       	mov    $0x24,%eax
+  80097b:	89 cb                	mov    %ecx,%ebx
+  80097d:	89 cf                	mov    %ecx,%edi
+  80097f:	89 ce                	mov    %ecx,%esi
+  800981:	cd 30                	int    $0x30
+  800983:	5b                   	pop    %ebx
+  800984:	5e                   	pop    %esi
+  800985:	5f                   	pop    %edi
+  800986:	5d                   	pop    %ebp
+  800987:	c3                   	ret
+
+00800988 <sys_env_set_pager>:
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	57                   	push   %edi
+  80098c:	56                   	push   %esi
+  80098d:	53                   	push   %ebx
+  80098e:	83 ec 0c             	sub    $0xc,%esp
+  800991:	be 00 00 00 00       	mov    $0x0,%esi
+  800996:	8b 55 08             	mov    0x8(%ebp),%edx
+  800999:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80099c:	b8 25 00 00 00       	mov    $0x25,%eax
+  8009a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009a4:	89 f7                	mov    %esi,%edi
+  8009a6:	cd 30                	int    $0x30
+  8009a8:	85 c0                	test   %eax,%eax
+  8009aa:	7f 08                	jg     8009b4 <sys_env_set_pager+0x2c>
+  8009ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009af:	5b                   	pop    %ebx
+  8009b0:	5e                   	pop    %esi
+  8009b1:	5f                   	pop    %edi
+  8009b2:	5d                   	pop    %ebp
+  8009b3:	c3                   	ret
+  8009b4:	83 ec 0c             	sub    $0xc,%esp
+  8009b7:	50                   	push   %eax
+  8009b8:	6a 25                	push   $0x25
+  8009ba:	68 6a 31 80 00       	push   $0x80316a
+  8009bf:	6a 24                	push   $0x24
+  8009c1:	68 87 31 80 00       	push   $0x803187
+  8009c6:	e8 a1 17 00 00       	call   80216c <_panic>
+
+008009cb <sys_pager_retire>:
+  8009cb:	55                   	push   %ebp
+  8009cc:	89 e5                	mov    %esp,%ebp
+  8009ce:	57                   	push   %edi
+  8009cf:	56                   	push   %esi
+  8009d0:	53                   	push   %ebx
+  8009d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009de:	89 cb                	mov    %ecx,%ebx
+  8009e0:	89 cf                	mov    %ecx,%edi
+  8009e2:	89 ce                	mov    %ecx,%esi
+  8009e4:	cd 30                	int    $0x30
+  8009e6:	5b                   	pop    %ebx
+  8009e7:	5e                   	pop    %esi
+  8009e8:	5f                   	pop    %edi
+  8009e9:	5d                   	pop    %ebp
+  8009ea:	c3                   	ret
+
+008009eb <sys_prof>:
+  8009eb:	55                   	push   %ebp
+  8009ec:	89 e5                	mov    %esp,%ebp
+  8009ee:	57                   	push   %edi
+  8009ef:	56                   	push   %esi
+  8009f0:	53                   	push   %ebx
+  8009f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8009f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009fc:	b8 22 00 00 00       	mov    $0x22,%eax
+  800a01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a04:	89 f7                	mov    %esi,%edi
+  800a06:	cd 30                	int    $0x30
+  800a08:	5b                   	pop    %ebx
+  800a09:	5e                   	pop    %esi
+  800a0a:	5f                   	pop    %edi
+  800a0b:	5d                   	pop    %ebp
+  800a0c:	c3                   	ret
+
+00800a0d <fd2num>:
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a13:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a18:	c1 e8 0c             	shr    $0xc,%eax
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+
+00800a1d <fd2data>:
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a28:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a2d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a32:	5d                   	pop    %ebp
+  800a33:	c3                   	ret
+
+00800a34 <fd_alloc>:
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a3c:	89 c2                	mov    %eax,%edx
+  800a3e:	c1 ea 16             	shr    $0x16,%edx
+  800a41:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a48:	f6 c2 01             	test   $0x1,%dl
+  800a4b:	74 29                	je     800a76 <fd_alloc+0x42>
+  800a4d:	89 c2                	mov    %eax,%edx
+  800a4f:	c1 ea 0c             	shr    $0xc,%edx
+  800a52:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a59:	f6 c2 01             	test   $0x1,%dl
+  800a5c:	74 18                	je     800a76 <fd_alloc+0x42>
+  800a5e:	05 00 10 00 00       	add    $0x1000,%eax
+  800a63:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a68:	75 d2                	jne    800a3c <fd_alloc+0x8>
+  800a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a74:	eb 05                	jmp    800a7b <fd_alloc+0x47>
+  800a76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7e:	89 02                	mov    %eax,(%edx)
+  800a80:	89 c8                	mov    %ecx,%eax
+  800a82:	5d                   	pop    %ebp
+  800a83:	c3                   	ret
+
+00800a84 <fd_lookup>:
+  800a84:	55                   	push   %ebp
+  800a85:	89 e5                	mov    %esp,%ebp
+  800a87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8a:	83 f8 1f             	cmp    $0x1f,%eax
+  800a8d:	77 30                	ja     800abf <fd_lookup+0x3b>
+  800a8f:	c1 e0 0c             	shl    $0xc,%eax
+  800a92:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800a97:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800a9d:	f6 c2 01             	test   $0x1,%dl
+  800aa0:	74 24                	je     800ac6 <fd_lookup+0x42>
+  800aa2:	89 c2                	mov    %eax,%edx
+  800aa4:	c1 ea 0c             	shr    $0xc,%edx
+  800aa7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800aae:	f6 c2 01             	test   $0x1,%dl
+  800ab1:	74 1a                	je     800acd <fd_lookup+0x49>
+  800ab3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab6:	89 02                	mov    %eax,(%edx)
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+  800abf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac4:	eb f7                	jmp    800abd <fd_lookup+0x39>
+  800ac6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800acb:	eb f0                	jmp    800abd <fd_lookup+0x39>
+  800acd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad2:	eb e9                	jmp    800abd <fd_lookup+0x39>
+
+00800ad4 <dev_lookup>:
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	53                   	push   %ebx
+  800ad8:	83 ec 04             	sub    $0x4,%esp
+  800adb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ade:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae3:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800ae8:	39 13                	cmp    %edx,(%ebx)
+  800aea:	74 37                	je     800b23 <dev_lookup+0x4f>
+  800aec:	83 c0 01             	add    $0x1,%eax
+  800aef:	8b 1c 85 14 32 80 00 	mov    0x803214(,%eax,4),%ebx
+  800af6:	85 db                	test   %ebx,%ebx
+  800af8:	75 ee                	jne    800ae8 <dev_lookup+0x14>
+  800afa:	a1 10 50 80 00       	mov    0x805010,%eax
+  800aff:	8b 40 48             	mov    0x48(%eax),%eax
+  800b02:	83 ec 04             	sub    $0x4,%esp
+  800b05:	52                   	push   %edx
+  800b06:	50                   	push   %eax
+  800b07:	68 98 31 80 00       	push   $0x803198
+  800b0c:	e8 36 17 00 00       	call   802247 <cprintf>
+  800b11:	83 c4 10             	add    $0x10,%esp
+  800b14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b19:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b1c:	89 1a                	mov    %ebx,(%edx)
+  800b1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b21:	c9                   	leave
+  800b22:	c3                   	ret
+  800b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b28:	eb ef                	jmp    800b19 <dev_lookup+0x45>
+
+00800b2a <fd_close>:
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	57                   	push   %edi
+  800b2e:	56                   	push   %esi
+  800b2f:	53                   	push   %ebx
+  800b30:	83 ec 24             	sub    $0x24,%esp
+  800b33:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b36:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b39:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b3c:	50                   	push   %eax
+  800b3d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b43:	c1 e8 0c             	shr    $0xc,%eax
+  800b46:	50                   	push   %eax
+  800b47:	e8 38 ff ff ff       	call   800a84 <fd_lookup>
+  800b4c:	89 c3                	mov    %eax,%ebx
+  800b4e:	83 c4 10             	add    $0x10,%esp
+  800b51:	85 c0                	test   %eax,%eax
+  800b53:	78 05                	js     800b5a <fd_close+0x30>
+  800b55:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b58:	74 0f                	je     800b69 <fd_close+0x3f>
+  800b5a:	85 ff                	test   %edi,%edi
+  800b5c:	0f 44 df             	cmove  %edi,%ebx
+  800b5f:	89 d8                	mov    %ebx,%eax
+  800b61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b64:	5b                   	pop    %ebx
+  800b65:	5e                   	pop    %esi
+  800b66:	5f                   	pop    %edi
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+  800b69:	83 ec 08             	sub    $0x8,%esp
+  800b6c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b6f:	50                   	push   %eax
+  800b70:	ff 36                	push   (%esi)
+  800b72:	e8 5d ff ff ff       	call   800ad4 <dev_lookup>
+  800b77:	89 c3                	mov    %eax,%ebx
+  800b79:	83 c4 10             	add    $0x10,%esp
+  800b7c:	85 c0                	test   %eax,%eax
+  800b7e:	78 1a                	js     800b9a <fd_close+0x70>
+  800b80:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b83:	8b 40 10             	mov    0x10(%eax),%eax
+  800b86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b8b:	85 c0                	test   %eax,%eax
+  800b8d:	74 0b                	je     800b9a <fd_close+0x70>
+  800b8f:	83 ec 0c             	sub    $0xc,%esp
+  800b92:	56                   	push   %esi
+  800b93:	ff d0                	call   *%eax
+  800b95:	89 c3                	mov    %eax,%ebx
+  800b97:	83 c4 10             	add    $0x10,%esp
+  800b9a:	83 ec 08             	sub    $0x8,%esp
+  800b9d:	56                   	push   %esi
+  800b9e:	6a 00                	push   $0x0
+  800ba0:	e8 cc f6 ff ff       	call   800271 <sys_page_unmap>
+  800ba5:	83 c4 10             	add    $0x10,%esp
+  800ba8:	eb b5                	jmp    800b5f <fd_close+0x35>
+
+00800baa <close>:
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	83 ec 20             	sub    $0x20,%esp
+  800bb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bb3:	50                   	push   %eax
+  800bb4:	ff 75 08             	push   0x8(%ebp)
+  800bb7:	e8 c8 fe ff ff       	call   800a84 <fd_lookup>
+  800bbc:	83 c4 10             	add    $0x10,%esp
+  800bbf:	85 c0                	test   %eax,%eax
+  800bc1:	79 02                	jns    800bc5 <close+0x1b>
+  800bc3:	c9                   	leave
+  800bc4:	c3                   	ret
+  800bc5:	83 ec 08             	sub    $0x8,%esp
+  800bc8:	6a 01                	push   $0x1
+  800bca:	ff 75 f4             	push   -0xc(%ebp)
+  800bcd:	e8 58 ff ff ff       	call   800b2a <fd_close>
+  800bd2:	83 c4 10             	add    $0x10,%esp
+  800bd5:	eb ec                	jmp    800bc3 <close+0x19>
+
+00800bd7 <close_all>:
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	53                   	push   %ebx
+  800bdb:	83 ec 04             	sub    $0x4,%esp
+  800bde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800be3:	83 ec 0c             	sub    $0xc,%esp
+  800be6:	53                   	push   %ebx
+  800be7:	e8 be ff ff ff       	call   800baa <close>
+  800bec:	83 c3 01             	add    $0x1,%ebx
+  800bef:	83 c4 10             	add    $0x10,%esp
+  800bf2:	83 fb 20             	cmp    $0x20,%ebx
+  800bf5:	75 ec                	jne    800be3 <close_all+0xc>
+  800bf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bfa:	c9                   	leave
+  800bfb:	c3                   	ret
+
+00800bfc <dup>:
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	57                   	push   %edi
+  800c00:	56                   	push   %esi
+  800c01:	53                   	push   %ebx
+  800c02:	83 ec 34             	sub    $0x34,%esp
+  800c05:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c08:	50                   	push   %eax
+  800c09:	ff 75 08             	push   0x8(%ebp)
+  800c0c:	e8 73 fe ff ff       	call   800a84 <fd_lookup>
+  800c11:	89 c3                	mov    %eax,%ebx
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	85 c0                	test   %eax,%eax
+  800c18:	78 7f                	js     800c99 <dup+0x9d>
+  800c1a:	83 ec 0c             	sub    $0xc,%esp
+  800c1d:	ff 75 0c             	push   0xc(%ebp)
+  800c20:	e8 85 ff ff ff       	call   800baa <close>
+  800c25:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c28:	c1 e6 0c             	shl    $0xc,%esi
+  800c2b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c31:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c34:	89 3c 24             	mov    %edi,(%esp)
+  800c37:	e8 e1 fd ff ff       	call   800a1d <fd2data>
+  800c3c:	89 c3                	mov    %eax,%ebx
+  800c3e:	89 34 24             	mov    %esi,(%esp)
+  800c41:	e8 d7 fd ff ff       	call   800a1d <fd2data>
+  800c46:	83 c4 10             	add    $0x10,%esp
+  800c49:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c4c:	89 d8                	mov    %ebx,%eax
+  800c4e:	c1 e8 16             	shr    $0x16,%eax
+  800c51:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c58:	a8 01                	test   $0x1,%al
+  800c5a:	74 11                	je     800c6d <dup+0x71>
+  800c5c:	89 d8                	mov    %ebx,%eax
+  800c5e:	c1 e8 0c             	shr    $0xc,%eax
+  800c61:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c68:	f6 c2 01             	test   $0x1,%dl
+  800c6b:	75 36                	jne    800ca3 <dup+0xa7>
+  800c6d:	89 f8                	mov    %edi,%eax
+  800c6f:	c1 e8 0c             	shr    $0xc,%eax
+  800c72:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+  800c7c:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c81:	50                   	push   %eax
+  800c82:	56                   	push   %esi
+  800c83:	6a 00                	push   $0x0
+  800c85:	57                   	push   %edi
+  800c86:	6a 00                	push   $0x0
+  800c88:	e8 55 f5 ff ff       	call   8001e2 <sys_page_map>
+  800c8d:	89 c3                	mov    %eax,%ebx
+  800c8f:	83 c4 20             	add    $0x20,%esp
+  800c92:	85 c0                	test   %eax,%eax
+  800c94:	78 33                	js     800cc9 <dup+0xcd>
+  800c96:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c99:	89 d8                	mov    %ebx,%eax
+  800c9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9e:	5b                   	pop    %ebx
+  800c9f:	5e                   	pop    %esi
+  800ca0:	5f                   	pop    %edi
+  800ca1:	5d                   	pop    %ebp
+  800ca2:	c3                   	ret
+  800ca3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800caa:	83 ec 0c             	sub    $0xc,%esp
+  800cad:	25 07 0e 00 00       	and    $0xe07,%eax
+  800cb2:	50                   	push   %eax
+  800cb3:	ff 75 d4             	push   -0x2c(%ebp)
+  800cb6:	6a 00                	push   $0x0
+  800cb8:	53                   	push   %ebx
+  800cb9:	6a 00                	push   $0x0
+  800cbb:	e8 22 f5 ff ff       	call   8001e2 <sys_page_map>
+  800cc0:	89 c3                	mov    %eax,%ebx
+  800cc2:	83 c4 20             	add    $0x20,%esp
+  800cc5:	85 c0                	test   %eax,%eax
+  800cc7:	79 a4                	jns    800c6d <dup+0x71>
+  800cc9:	83 ec 08             	sub    $0x8,%esp
+  800ccc:	56                   	push   %esi
+  800ccd:	6a 00                	push   $0x0
+  800ccf:	e8 9d f5 ff ff       	call   800271 <sys_page_unmap>
+  800cd4:	83 c4 08             	add    $0x8,%esp
+  800cd7:	ff 75 d4             	push   -0x2c(%ebp)
+  800cda:	6a 00                	push   $0x0
+  800cdc:	e8 90 f5 ff ff       	call   800271 <sys_page_unmap>
+  800ce1:	83 c4 10             	add    $0x10,%esp
+  800ce4:	eb b3                	jmp    800c99 <dup+0x9d>
+
+00800ce6 <read>:
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	56                   	push   %esi
+  800cea:	53                   	push   %ebx
+  800ceb:	83 ec 18             	sub    $0x18,%esp
+  800cee:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cf1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800cf4:	50                   	push   %eax
+  800cf5:	56                   	push   %esi
+  800cf6:	e8 89 fd ff ff       	call   800a84 <fd_lookup>
+  800cfb:	83 c4 10             	add    $0x10,%esp
+  800cfe:	85 c0                	test   %eax,%eax
+  800d00:	78 3c                	js     800d3e <read+0x58>
+  800d02:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800d05:	83 ec 08             	sub    $0x8,%esp
+  800d08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d0b:	50                   	push   %eax
+  800d0c:	ff 33                	push   (%ebx)
+  800d0e:	e8 c1 fd ff ff       	call   800ad4 <dev_lookup>
+  800d13:	83 c4 10             	add    $0x10,%esp
+  800d16:	85 c0                	test   %eax,%eax
+  800d18:	78 24                	js     800d3e <read+0x58>
+  800d1a:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d1d:	83 e0 03             	and    $0x3,%eax
+  800d20:	83 f8 01             	cmp    $0x1,%eax
+  800d23:	74 20                	je     800d45 <read+0x5f>
+  800d25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d28:	8b 40 08             	mov    0x8(%eax),%eax
+  800d2b:	85 c0                	test   %eax,%eax
+  800d2d:	74 37                	je     800d66 <read+0x80>
+  800d2f:	83 ec 04             	sub    $0x4,%esp
+  800d32:	ff 75 10             	push   0x10(%ebp)
+  800d35:	ff 75 0c             	push   0xc(%ebp)
+  800d38:	53                   	push   %ebx
+  800d39:	ff d0                	call   *%eax
+  800d3b:	83 c4 10             	add    $0x10,%esp
+  800d3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+  800d45:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d4a:	8b 40 48             	mov    0x48(%eax),%eax
+  800d4d:	83 ec 04             	sub    $0x4,%esp
+  800d50:	56                   	push   %esi
+  800d51:	50                   	push   %eax
+  800d52:	68 d9 31 80 00       	push   $0x8031d9
+  800d57:	e8 eb 14 00 00       	call   802247 <cprintf>
+  800d5c:	83 c4 10             	add    $0x10,%esp
+  800d5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d64:	eb d8                	jmp    800d3e <read+0x58>
+  800d66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d6b:	eb d1                	jmp    800d3e <read+0x58>
+
+00800d6d <readn>:
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	56                   	push   %esi
+  800d72:	53                   	push   %ebx
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+  800d76:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d79:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d7c:	85 f6                	test   %esi,%esi
+  800d7e:	74 30                	je     800db0 <readn+0x43>
+  800d80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8a:	83 ec 04             	sub    $0x4,%esp
+  800d8d:	89 f2                	mov    %esi,%edx
+  800d8f:	29 c2                	sub    %eax,%edx
+  800d91:	52                   	push   %edx
+  800d92:	01 f8                	add    %edi,%eax
+  800d94:	50                   	push   %eax
+  800d95:	ff 75 08             	push   0x8(%ebp)
+  800d98:	e8 49 ff ff ff       	call   800ce6 <read>
+  800d9d:	83 c4 10             	add    $0x10,%esp
+  800da0:	85 c0                	test   %eax,%eax
+  800da2:	78 15                	js     800db9 <readn+0x4c>
+  800da4:	74 11                	je     800db7 <readn+0x4a>
+  800da6:	01 c3                	add    %eax,%ebx
+  800da8:	89 d8                	mov    %ebx,%eax
+  800daa:	39 f3                	cmp    %esi,%ebx
+  800dac:	72 dc                	jb     800d8a <readn+0x1d>
+  800dae:	eb 09                	jmp    800db9 <readn+0x4c>
+  800db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db5:	eb 02                	jmp    800db9 <readn+0x4c>
+  800db7:	89 d8                	mov    %ebx,%eax
+  800db9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbc:	5b                   	pop    %ebx
+  800dbd:	5e                   	pop    %esi
+  800dbe:	5f                   	pop    %edi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+
+00800dc1 <write>:
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	56                   	push   %esi
+  800dc5:	53                   	push   %ebx
+  800dc6:	83 ec 18             	sub    $0x18,%esp
+  800dc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dcc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dcf:	50                   	push   %eax
+  800dd0:	53                   	push   %ebx
+  800dd1:	e8 ae fc ff ff       	call   800a84 <fd_lookup>
+  800dd6:	83 c4 10             	add    $0x10,%esp
+  800dd9:	85 c0                	test   %eax,%eax
+  800ddb:	78 37                	js     800e14 <write+0x53>
+  800ddd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800de0:	83 ec 08             	sub    $0x8,%esp
+  800de3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800de6:	50                   	push   %eax
+  800de7:	ff 36                	push   (%esi)
+  800de9:	e8 e6 fc ff ff       	call   800ad4 <dev_lookup>
+  800dee:	83 c4 10             	add    $0x10,%esp
+  800df1:	85 c0                	test   %eax,%eax
+  800df3:	78 1f                	js     800e14 <write+0x53>
+  800df5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800df9:	74 20                	je     800e1b <write+0x5a>
+  800dfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800dfe:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	74 37                	je     800e3c <write+0x7b>
+  800e05:	83 ec 04             	sub    $0x4,%esp
+  800e08:	ff 75 10             	push   0x10(%ebp)
+  800e0b:	ff 75 0c             	push   0xc(%ebp)
+  800e0e:	56                   	push   %esi
+  800e0f:	ff d0                	call   *%eax
+  800e11:	83 c4 10             	add    $0x10,%esp
+  800e14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e17:	5b                   	pop    %ebx
+  800e18:	5e                   	pop    %esi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+  800e1b:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e20:	8b 40 48             	mov    0x48(%eax),%eax
+  800e23:	83 ec 04             	sub    $0x4,%esp
+  800e26:	53                   	push   %ebx
+  800e27:	50                   	push   %eax
+  800e28:	68 f5 31 80 00       	push   $0x8031f5
+  800e2d:	e8 15 14 00 00       	call   802247 <cprintf>
+  800e32:	83 c4 10             	add    $0x10,%esp
+  800e35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e3a:	eb d8                	jmp    800e14 <write+0x53>
+  800e3c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e41:	eb d1                	jmp    800e14 <write+0x53>
+
+00800e43 <seek>:
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	83 ec 20             	sub    $0x20,%esp
+  800e49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e4c:	50                   	push   %eax
+  800e4d:	ff 75 08             	push   0x8(%ebp)
+  800e50:	e8 2f fc ff ff       	call   800a84 <fd_lookup>
+  800e55:	83 c4 10             	add    $0x10,%esp
+  800e58:	85 c0                	test   %eax,%eax
+  800e5a:	78 0e                	js     800e6a <seek+0x27>
+  800e5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e62:	89 50 04             	mov    %edx,0x4(%eax)
+  800e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6a:	c9                   	leave
+  800e6b:	c3                   	ret
+
+00800e6c <ftruncate>:
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  800e71:	83 ec 18             	sub    $0x18,%esp
+  800e74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e7a:	50                   	push   %eax
+  800e7b:	53                   	push   %ebx
+  800e7c:	e8 03 fc ff ff       	call   800a84 <fd_lookup>
+  800e81:	83 c4 10             	add    $0x10,%esp
+  800e84:	85 c0                	test   %eax,%eax
+  800e86:	78 34                	js     800ebc <ftruncate+0x50>
+  800e88:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e8b:	83 ec 08             	sub    $0x8,%esp
+  800e8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e91:	50                   	push   %eax
+  800e92:	ff 36                	push   (%esi)
+  800e94:	e8 3b fc ff ff       	call   800ad4 <dev_lookup>
+  800e99:	83 c4 10             	add    $0x10,%esp
+  800e9c:	85 c0                	test   %eax,%eax
+  800e9e:	78 1c                	js     800ebc <ftruncate+0x50>
+  800ea0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ea4:	74 1d                	je     800ec3 <ftruncate+0x57>
+  800ea6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea9:	8b 40 18             	mov    0x18(%eax),%eax
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	74 34                	je     800ee4 <ftruncate+0x78>
+  800eb0:	83 ec 08             	sub    $0x8,%esp
+  800eb3:	ff 75 0c             	push   0xc(%ebp)
+  800eb6:	56                   	push   %esi
+  800eb7:	ff d0                	call   *%eax
+  800eb9:	83 c4 10             	add    $0x10,%esp
+  800ebc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+  800ec3:	a1 10 50 80 00       	mov    0x805010,%eax
+  800ec8:	8b 40 48             	mov    0x48(%eax),%eax
+  800ecb:	83 ec 04             	sub    $0x4,%esp
+  800ece:	53                   	push   %ebx
+  800ecf:	50                   	push   %eax
+  800ed0:	68 b8 31 80 00       	push   $0x8031b8
+  800ed5:	e8 6d 13 00 00       	call   802247 <cprintf>
+  800eda:	83 c4 10             	add    $0x10,%esp
+  800edd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee2:	eb d8                	jmp    800ebc <ftruncate+0x50>
+  800ee4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ee9:	eb d1                	jmp    800ebc <ftruncate+0x50>
+
+00800eeb <fstat>:
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	56                   	push   %esi
+  800eef:	53                   	push   %ebx
+  800ef0:	83 ec 18             	sub    $0x18,%esp
+  800ef3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ef6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ef9:	50                   	push   %eax
+  800efa:	ff 75 08             	push   0x8(%ebp)
+  800efd:	e8 82 fb ff ff       	call   800a84 <fd_lookup>
+  800f02:	83 c4 10             	add    $0x10,%esp
+  800f05:	85 c0                	test   %eax,%eax
+  800f07:	78 49                	js     800f52 <fstat+0x67>
+  800f09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f0c:	83 ec 08             	sub    $0x8,%esp
+  800f0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f12:	50                   	push   %eax
+  800f13:	ff 36                	push   (%esi)
+  800f15:	e8 ba fb ff ff       	call   800ad4 <dev_lookup>
+  800f1a:	83 c4 10             	add    $0x10,%esp
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	78 31                	js     800f52 <fstat+0x67>
+  800f21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f24:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f28:	74 2f                	je     800f59 <fstat+0x6e>
+  800f2a:	c6 03 00             	movb   $0x0,(%ebx)
+  800f2d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f34:	00 00 00 
+  800f37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f3e:	00 00 00 
+  800f41:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f47:	83 ec 08             	sub    $0x8,%esp
+  800f4a:	53                   	push   %ebx
+  800f4b:	56                   	push   %esi
+  800f4c:	ff 50 14             	call   *0x14(%eax)
+  800f4f:	83 c4 10             	add    $0x10,%esp
+  800f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f55:	5b                   	pop    %ebx
+  800f56:	5e                   	pop    %esi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+  800f59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f5e:	eb f2                	jmp    800f52 <fstat+0x67>
+
+00800f60 <stat>:
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	56                   	push   %esi
+  800f64:	53                   	push   %ebx
+  800f65:	83 ec 08             	sub    $0x8,%esp
+  800f68:	6a 00                	push   $0x0
+  800f6a:	ff 75 08             	push   0x8(%ebp)
+  800f6d:	e8 31 05 00 00       	call   8014a3 <open>
+  800f72:	89 c3                	mov    %eax,%ebx
+  800f74:	83 c4 10             	add    $0x10,%esp
+  800f77:	85 c0                	test   %eax,%eax
+  800f79:	78 1b                	js     800f96 <stat+0x36>
+  800f7b:	83 ec 08             	sub    $0x8,%esp
+  800f7e:	ff 75 0c             	push   0xc(%ebp)
+  800f81:	50                   	push   %eax
+  800f82:	e8 64 ff ff ff       	call   800eeb <fstat>
+  800f87:	89 c6                	mov    %eax,%esi
+  800f89:	89 1c 24             	mov    %ebx,(%esp)
+  800f8c:	e8 19 fc ff ff       	call   800baa <close>
+  800f91:	83 c4 10             	add    $0x10,%esp
+  800f94:	89 f3                	mov    %esi,%ebx
+  800f96:	89 d8                	mov    %ebx,%eax
+  800f98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5d                   	pop    %ebp
+  800f9e:	c3                   	ret
+
+00800f9f <fsipc>:
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	56                   	push   %esi
+  800fa3:	53                   	push   %ebx
+  800fa4:	89 c3                	mov    %eax,%ebx
+  800fa6:	89 d6                	mov    %edx,%esi
+  800fa8:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800faf:	74 20                	je     800fd1 <fsipc+0x32>
+  800fb1:	83 ec 08             	sub    $0x8,%esp
+  800fb4:	6a 00                	push   $0x0
+  800fb6:	56                   	push   %esi
+  800fb7:	6a 07                	push   $0x7
+  800fb9:	68 00 60 80 00       	push   $0x806000
+  800fbe:	53                   	push   %ebx
+  800fbf:	ff 35 08 50 80 00    	push   0x805008
+  800fc5:	e8 a4 1d 00 00       	call   802d6e <ipc_call>
+  800fca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5e                   	pop    %esi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+  800fd4:	6a 02                	push   $0x2
+  800fd6:	e8 2e 1f 00 00       	call   802f09 <ipc_find_env>
+  800fdb:	a3 08 50 80 00       	mov    %eax,0x805008
+  800fe0:	83 c4 10             	add    $0x10,%esp
+  800fe3:	eb cc                	jmp    800fb1 <fsipc+0x12>
+
+00800fe5 <devfile_trunc>:
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	83 ec 08             	sub    $0x8,%esp
+  800feb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fee:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ff1:	a3 00 60 80 00       	mov    %eax,0x806000
+  800ff6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff9:	a3 04 60 80 00       	mov    %eax,0x806004
+  800ffe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801003:	b8 02 00 00 00       	mov    $0x2,%eax
+  801008:	e8 92 ff ff ff       	call   800f9f <fsipc>
+  80100d:	c9                   	leave
+  80100e:	c3                   	ret
+
+0080100f <devfile_flush>:
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	83 ec 08             	sub    $0x8,%esp
+  801015:	8b 45 08             	mov    0x8(%ebp),%eax
+  801018:	8b 40 0c             	mov    0xc(%eax),%eax
+  80101b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801020:	ba 00 00 00 00       	mov    $0x0,%edx
+  801025:	b8 08 00 00 00       	mov    $0x8,%eax
+  80102a:	e8 70 ff ff ff       	call   800f9f <fsipc>
+  80102f:	c9                   	leave
+  801030:	c3                   	ret
+
+00801031 <devfile_stat>:
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	53                   	push   %ebx
+  801035:	83 ec 04             	sub    $0x4,%esp
+  801038:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80103b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801041:	a3 00 60 80 00       	mov    %eax,0x806000
+  801046:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801050:	e8 4a ff ff ff       	call   800f9f <fsipc>
+  801055:	85 c0                	test   %eax,%eax
+  801057:	78 2c                	js     801085 <devfile_stat+0x54>
+  801059:	83 ec 08             	sub    $0x8,%esp
+  80105c:	68 00 60 80 00       	push   $0x806000
+  801061:	53                   	push   %ebx
+  801062:	e8 d7 18 00 00       	call   80293e <strcpy>
+  801067:	a1 80 60 80 00       	mov    0x806080,%eax
+  80106c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801072:	a1 84 60 80 00       	mov    0x806084,%eax
+  801077:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80107d:	83 c4 10             	add    $0x10,%esp
+  801080:	b8 00 00 00 00       	mov    $0x0,%eax
+  801085:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801088:	c9                   	leave
+  801089:	c3                   	ret
+
+0080108a <fsring_rw>:
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	57                   	push   %edi
+  80108e:	56                   	push   %esi
+  80108f:	53                   	push   %ebx
+  801090:	83 ec 2c             	sub    $0x2c,%esp
+  801093:	89 c7                	mov    %eax,%edi
+  801095:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801098:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80109b:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8010a0:	a8 01                	test   $0x1,%al
+  8010a2:	74 0d                	je     8010b1 <fsring_rw+0x27>
+  8010a4:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010a9:	a8 01                	test   $0x1,%al
+  8010ab:	0f 85 d5 00 00 00    	jne    801186 <fsring_rw+0xfc>
+  8010b1:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8010b9:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010bf:	0f 84 fc 00 00 00    	je     8011c1 <fsring_rw+0x137>
+  8010c5:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010cc:	0f 84 02 01 00 00    	je     8011d4 <fsring_rw+0x14a>
+  8010d2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010d7:	83 ec 04             	sub    $0x4,%esp
+  8010da:	68 07 02 00 00       	push   $0x207
+  8010df:	53                   	push   %ebx
+  8010e0:	6a 00                	push   $0x0
+  8010e2:	e8 b8 f0 ff ff       	call   80019f <sys_page_alloc>
+  8010e7:	83 c4 10             	add    $0x10,%esp
+  8010ea:	85 c0                	test   %eax,%eax
+  8010ec:	0f 88 f9 00 00 00    	js     8011eb <fsring_rw+0x161>
+  8010f2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010f8:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8010fe:	75 d7                	jne    8010d7 <fsring_rw+0x4d>
+  801100:	6a 0e                	push   $0xe
+  801102:	6a 0d                	push   $0xd
+  801104:	ff 35 08 50 80 00    	push   0x805008
+  80110a:	68 00 00 f0 cf       	push   $0xcff00000
+  80110f:	e8 c4 0c 00 00       	call   801dd8 <ipcring_init>
+  801114:	83 c4 08             	add    $0x8,%esp
+  801117:	6a 00                	push   $0x0
+  801119:	6a 00                	push   $0x0
+  80111b:	68 07 02 00 00       	push   $0x207
+  801120:	68 00 00 f0 cf       	push   $0xcff00000
+  801125:	6a 0b                	push   $0xb
+  801127:	ff 35 08 50 80 00    	push   0x805008
+  80112d:	e8 3c 1c 00 00       	call   802d6e <ipc_call>
+  801132:	89 c6                	mov    %eax,%esi
+  801134:	83 c4 20             	add    $0x20,%esp
+  801137:	85 c0                	test   %eax,%eax
+  801139:	0f 88 ac 00 00 00    	js     8011eb <fsring_rw+0x161>
+  80113f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801144:	89 d9                	mov    %ebx,%ecx
+  801146:	83 c3 01             	add    $0x1,%ebx
+  801149:	89 da                	mov    %ebx,%edx
+  80114b:	c1 e2 0c             	shl    $0xc,%edx
+  80114e:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801154:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80115a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801160:	83 ec 08             	sub    $0x8,%esp
+  801163:	6a 00                	push   $0x0
+  801165:	6a 00                	push   $0x0
+  801167:	68 07 02 00 00       	push   $0x207
+  80116c:	50                   	push   %eax
+  80116d:	6a 0c                	push   $0xc
+  80116f:	ff 35 08 50 80 00    	push   0x805008
+  801175:	e8 f4 1b 00 00       	call   802d6e <ipc_call>
+  80117a:	83 c4 20             	add    $0x20,%esp
+  80117d:	85 c0                	test   %eax,%eax
+  80117f:	78 6a                	js     8011eb <fsring_rw+0x161>
+  801181:	83 fb 08             	cmp    $0x8,%ebx
+  801184:	75 be                	jne    801144 <fsring_rw+0xba>
+  801186:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80118a:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80118f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801194:	0f 45 c2             	cmovne %edx,%eax
+  801197:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80119a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8011a1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011a8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011bc:	e9 4b 01 00 00       	jmp    80130c <fsring_rw+0x282>
+  8011c1:	e8 a3 f3 ff ff       	call   800569 <sys_time_msec>
+  8011c6:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011cc:	0f 89 f3 fe ff ff    	jns    8010c5 <fsring_rw+0x3b>
+  8011d2:	eb 54                	jmp    801228 <fsring_rw+0x19e>
+  8011d4:	83 ec 0c             	sub    $0xc,%esp
+  8011d7:	6a 02                	push   $0x2
+  8011d9:	e8 2b 1d 00 00       	call   802f09 <ipc_find_env>
+  8011de:	a3 08 50 80 00       	mov    %eax,0x805008
+  8011e3:	83 c4 10             	add    $0x10,%esp
+  8011e6:	e9 e7 fe ff ff       	jmp    8010d2 <fsring_rw+0x48>
+  8011eb:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8011f0:	83 ec 08             	sub    $0x8,%esp
+  8011f3:	53                   	push   %ebx
+  8011f4:	6a 00                	push   $0x0
+  8011f6:	e8 76 f0 ff ff       	call   800271 <sys_page_unmap>
+  8011fb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801201:	83 c4 10             	add    $0x10,%esp
+  801204:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80120a:	75 e4                	jne    8011f0 <fsring_rw+0x166>
+  80120c:	e8 58 f3 ff ff       	call   800569 <sys_time_msec>
+  801211:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801216:	a3 00 50 80 00       	mov    %eax,0x805000
+  80121b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801220:	8b 40 48             	mov    0x48(%eax),%eax
+  801223:	a3 04 50 80 00       	mov    %eax,0x805004
+  801228:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80122f:	e9 7a 01 00 00       	jmp    8013ae <fsring_rw+0x324>
+  801234:	8b 57 0c             	mov    0xc(%edi),%edx
+  801237:	89 10                	mov    %edx,(%eax)
+  801239:	89 58 04             	mov    %ebx,0x4(%eax)
+  80123c:	89 f2                	mov    %esi,%edx
+  80123e:	03 57 04             	add    0x4(%edi),%edx
+  801241:	89 50 08             	mov    %edx,0x8(%eax)
+  801244:	83 ec 04             	sub    $0x4,%esp
+  801247:	53                   	push   %ebx
+  801248:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80124b:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80124e:	52                   	push   %edx
+  80124f:	83 c0 0c             	add    $0xc,%eax
+  801252:	50                   	push   %eax
+  801253:	e8 96 18 00 00       	call   802aee <memmove>
+  801258:	83 c4 10             	add    $0x10,%esp
+  80125b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80125e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801261:	89 08                	mov    %ecx,(%eax)
+  801263:	83 ec 0c             	sub    $0xc,%esp
+  801266:	68 00 00 f0 cf       	push   $0xcff00000
+  80126b:	e8 c6 0b 00 00       	call   801e36 <ipcring_req_push>
+  801270:	01 de                	add    %ebx,%esi
+  801272:	83 c4 10             	add    $0x10,%esp
+  801275:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801278:	73 4c                	jae    8012c6 <fsring_rw+0x23c>
+  80127a:	83 ec 0c             	sub    $0xc,%esp
+  80127d:	68 00 00 f0 cf       	push   $0xcff00000
+  801282:	e8 89 0b 00 00       	call   801e10 <ipcring_req_slot>
+  801287:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80128a:	83 c4 10             	add    $0x10,%esp
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	74 35                	je     8012c6 <fsring_rw+0x23c>
+  801291:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801296:	83 e0 07             	and    $0x7,%eax
+  801299:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80129e:	c1 e0 0c             	shl    $0xc,%eax
+  8012a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8012a4:	29 f3                	sub    %esi,%ebx
+  8012a6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012a9:	39 cb                	cmp    %ecx,%ebx
+  8012ab:	0f 47 d9             	cmova  %ecx,%ebx
+  8012ae:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012b2:	75 80                	jne    801234 <fsring_rw+0x1aa>
+  8012b4:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012b7:	89 10                	mov    %edx,(%eax)
+  8012b9:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012bc:	89 f2                	mov    %esi,%edx
+  8012be:	03 57 04             	add    0x4(%edi),%edx
+  8012c1:	89 50 08             	mov    %edx,0x8(%eax)
+  8012c4:	eb 95                	jmp    80125b <fsring_rw+0x1d1>
+  8012c6:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012ce:	83 ec 0c             	sub    $0xc,%esp
+  8012d1:	68 00 00 f0 cf       	push   $0xcff00000
+  8012d6:	e8 94 0b 00 00       	call   801e6f <ipcring_rsp_wait>
+  8012db:	8b 58 04             	mov    0x4(%eax),%ebx
+  8012de:	83 c4 10             	add    $0x10,%esp
+  8012e1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8012e5:	75 45                	jne    80132c <fsring_rw+0x2a2>
+  8012e7:	85 db                	test   %ebx,%ebx
+  8012e9:	79 41                	jns    80132c <fsring_rw+0x2a2>
+  8012eb:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8012ee:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8012f5:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8012fc:	83 ec 0c             	sub    $0xc,%esp
+  8012ff:	68 00 00 f0 cf       	push   $0xcff00000
+  801304:	e8 cc 0b 00 00       	call   801ed5 <ipcring_rsp_pop>
+  801309:	83 c4 10             	add    $0x10,%esp
+  80130c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801312:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801317:	39 c2                	cmp    %eax,%edx
+  801319:	74 75                	je     801390 <fsring_rw+0x306>
+  80131b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80131f:	75 a5                	jne    8012c6 <fsring_rw+0x23c>
+  801321:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801324:	0f 82 50 ff ff ff    	jb     80127a <fsring_rw+0x1f0>
+  80132a:	eb 9a                	jmp    8012c6 <fsring_rw+0x23c>
+  80132c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801330:	75 ca                	jne    8012fc <fsring_rw+0x272>
+  801332:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801336:	74 31                	je     801369 <fsring_rw+0x2df>
+  801338:	8b 45 08             	mov    0x8(%ebp),%eax
+  80133b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80133e:	29 c8                	sub    %ecx,%eax
+  801340:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801343:	39 d0                	cmp    %edx,%eax
+  801345:	0f 47 c2             	cmova  %edx,%eax
+  801348:	39 d8                	cmp    %ebx,%eax
+  80134a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80134f:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801353:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801356:	b8 01 00 00 00       	mov    $0x1,%eax
+  80135b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80135f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801362:	01 d9                	add    %ebx,%ecx
+  801364:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801367:	eb 93                	jmp    8012fc <fsring_rw+0x272>
+  801369:	83 ec 04             	sub    $0x4,%esp
+  80136c:	53                   	push   %ebx
+  80136d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801370:	83 e0 07             	and    $0x7,%eax
+  801373:	c1 e0 0c             	shl    $0xc,%eax
+  801376:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80137c:	50                   	push   %eax
+  80137d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801380:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801383:	01 c8                	add    %ecx,%eax
+  801385:	50                   	push   %eax
+  801386:	e8 63 17 00 00       	call   802aee <memmove>
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	eb a8                	jmp    801338 <fsring_rw+0x2ae>
+  801390:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801394:	75 09                	jne    80139f <fsring_rw+0x315>
+  801396:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801399:	0f 82 db fe ff ff    	jb     80127a <fsring_rw+0x1f0>
+  80139f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8013a2:	01 57 04             	add    %edx,0x4(%edi)
+  8013a5:	85 d2                	test   %edx,%edx
+  8013a7:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013ab:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013ae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b4:	5b                   	pop    %ebx
+  8013b5:	5e                   	pop    %esi
+  8013b6:	5f                   	pop    %edi
+  8013b7:	5d                   	pop    %ebp
+  8013b8:	c3                   	ret
+
+008013b9 <devfile_write>:
+  8013b9:	55                   	push   %ebp
+  8013ba:	89 e5                	mov    %esp,%ebp
+  8013bc:	57                   	push   %edi
+  8013bd:	56                   	push   %esi
+  8013be:	53                   	push   %ebx
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013cb:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013d1:	76 1a                	jbe    8013ed <devfile_write+0x34>
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	53                   	push   %ebx
+  8013d7:	89 f1                	mov    %esi,%ecx
+  8013d9:	ba 06 00 00 00       	mov    $0x6,%edx
+  8013de:	89 f8                	mov    %edi,%eax
+  8013e0:	e8 a5 fc ff ff       	call   80108a <fsring_rw>
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013eb:	75 39                	jne    801426 <devfile_write+0x6d>
+  8013ed:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8013f2:	39 c3                	cmp    %eax,%ebx
+  8013f4:	0f 47 d8             	cmova  %eax,%ebx
+  8013f7:	8b 47 0c             	mov    0xc(%edi),%eax
+  8013fa:	a3 00 60 80 00       	mov    %eax,0x806000
+  8013ff:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801405:	83 ec 04             	sub    $0x4,%esp
+  801408:	53                   	push   %ebx
+  801409:	56                   	push   %esi
+  80140a:	68 08 60 80 00       	push   $0x806008
+  80140f:	e8 da 16 00 00       	call   802aee <memmove>
+  801414:	ba 00 00 00 00       	mov    $0x0,%edx
+  801419:	b8 04 00 00 00       	mov    $0x4,%eax
+  80141e:	e8 7c fb ff ff       	call   800f9f <fsipc>
+  801423:	83 c4 10             	add    $0x10,%esp
+  801426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+
+0080142e <devfile_read>:
+  80142e:	55                   	push   %ebp
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	57                   	push   %edi
+  801432:	56                   	push   %esi
+  801433:	53                   	push   %ebx
+  801434:	83 ec 0c             	sub    $0xc,%esp
+  801437:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80143a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80143d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  801443:	76 1d                	jbe    801462 <devfile_read+0x34>
+  801445:	83 ec 0c             	sub    $0xc,%esp
+  801448:	56                   	push   %esi
+  801449:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144c:	ba 05 00 00 00       	mov    $0x5,%edx
+  801451:	89 f8                	mov    %edi,%eax
+  801453:	e8 32 fc ff ff       	call   80108a <fsring_rw>
+  801458:	89 c3                	mov    %eax,%ebx
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801460:	75 37                	jne    801499 <devfile_read+0x6b>
+  801462:	8b 47 0c             	mov    0xc(%edi),%eax
+  801465:	a3 00 60 80 00       	mov    %eax,0x806000
+  80146a:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801470:	ba 00 00 00 00       	mov    $0x0,%edx
+  801475:	b8 03 00 00 00       	mov    $0x3,%eax
+  80147a:	e8 20 fb ff ff       	call   800f9f <fsipc>
+  80147f:	89 c3                	mov    %eax,%ebx
+  801481:	85 c0                	test   %eax,%eax
+  801483:	78 14                	js     801499 <devfile_read+0x6b>
+  801485:	83 ec 04             	sub    $0x4,%esp
+  801488:	50                   	push   %eax
+  801489:	68 00 60 80 00       	push   $0x806000
+  80148e:	ff 75 0c             	push   0xc(%ebp)
+  801491:	e8 58 16 00 00       	call   802aee <memmove>
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	89 d8                	mov    %ebx,%eax
+  80149b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149e:	5b                   	pop    %ebx
+  80149f:	5e                   	pop    %esi
+  8014a0:	5f                   	pop    %edi
+  8014a1:	5d                   	pop    %ebp
+  8014a2:	c3                   	ret
+
+008014a3 <open>:
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	83 ec 1c             	sub    $0x1c,%esp
+  8014ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ae:	56                   	push   %esi
+  8014af:	e8 3e 14 00 00       	call   8028f2 <strlen>
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014bc:	7f 6c                	jg     80152a <open+0x87>
+  8014be:	83 ec 0c             	sub    $0xc,%esp
+  8014c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c4:	50                   	push   %eax
+  8014c5:	e8 6a f5 ff ff       	call   800a34 <fd_alloc>
+  8014ca:	89 c3                	mov    %eax,%ebx
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 3c                	js     80150f <open+0x6c>
+  8014d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014d6:	a3 00 64 80 00       	mov    %eax,0x806400
+  8014db:	83 ec 08             	sub    $0x8,%esp
+  8014de:	56                   	push   %esi
+  8014df:	68 00 60 80 00       	push   $0x806000
+  8014e4:	e8 55 14 00 00       	call   80293e <strcpy>
+  8014e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f1:	e8 a9 fa ff ff       	call   800f9f <fsipc>
+  8014f6:	89 c3                	mov    %eax,%ebx
+  8014f8:	83 c4 10             	add    $0x10,%esp
+  8014fb:	85 c0                	test   %eax,%eax
+  8014fd:	78 19                	js     801518 <open+0x75>
+  8014ff:	83 ec 0c             	sub    $0xc,%esp
+  801502:	ff 75 f4             	push   -0xc(%ebp)
+  801505:	e8 03 f5 ff ff       	call   800a0d <fd2num>
+  80150a:	89 c3                	mov    %eax,%ebx
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	89 d8                	mov    %ebx,%eax
+  801511:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801514:	5b                   	pop    %ebx
+  801515:	5e                   	pop    %esi
+  801516:	5d                   	pop    %ebp
+  801517:	c3                   	ret
+  801518:	83 ec 08             	sub    $0x8,%esp
+  80151b:	6a 00                	push   $0x0
+  80151d:	ff 75 f4             	push   -0xc(%ebp)
+  801520:	e8 05 f6 ff ff       	call   800b2a <fd_close>
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	eb e5                	jmp    80150f <open+0x6c>
+  80152a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80152f:	eb de                	jmp    80150f <open+0x6c>
+
+00801531 <file_image>:
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	53                   	push   %ebx
+  801535:	83 ec 1c             	sub    $0x1c,%esp
+  801538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153e:	50                   	push   %eax
+  80153f:	ff 75 08             	push   0x8(%ebp)
+  801542:	e8 3d f5 ff ff       	call   800a84 <fd_lookup>
+  801547:	83 c4 10             	add    $0x10,%esp
+  80154a:	85 c0                	test   %eax,%eax
+  80154c:	78 58                	js     8015a6 <file_image+0x75>
+  80154e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801551:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801557:	39 08                	cmp    %ecx,(%eax)
+  801559:	75 50                	jne    8015ab <file_image+0x7a>
+  80155b:	83 fb 04             	cmp    $0x4,%ebx
+  80155e:	77 52                	ja     8015b2 <file_image+0x81>
+  801560:	8b 40 0c             	mov    0xc(%eax),%eax
+  801563:	a3 00 60 80 00       	mov    %eax,0x806000
+  801568:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80156e:	83 ec 04             	sub    $0x4,%esp
+  801571:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  801574:	c1 e0 02             	shl    $0x2,%eax
+  801577:	50                   	push   %eax
+  801578:	ff 75 0c             	push   0xc(%ebp)
+  80157b:	68 08 60 80 00       	push   $0x806008
+  801580:	e8 69 15 00 00       	call   802aee <memmove>
+  801585:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80158f:	e8 0b fa ff ff       	call   800f9f <fsipc>
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	85 c0                	test   %eax,%eax
+  801599:	78 0b                	js     8015a6 <file_image+0x75>
+  80159b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80159e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8015a4:	89 0a                	mov    %ecx,(%edx)
+  8015a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a9:	c9                   	leave
+  8015aa:	c3                   	ret
+  8015ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b0:	eb f4                	jmp    8015a6 <file_image+0x75>
+  8015b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b7:	eb ed                	jmp    8015a6 <file_image+0x75>
+
+008015b9 <remove>:
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	53                   	push   %ebx
+  8015bd:	83 ec 10             	sub    $0x10,%esp
+  8015c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015c3:	53                   	push   %ebx
+  8015c4:	e8 29 13 00 00       	call   8028f2 <strlen>
+  8015c9:	83 c4 10             	add    $0x10,%esp
+  8015cc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015d1:	7f 25                	jg     8015f8 <remove+0x3f>
+  8015d3:	83 ec 08             	sub    $0x8,%esp
+  8015d6:	53                   	push   %ebx
+  8015d7:	68 00 60 80 00       	push   $0x806000
+  8015dc:	e8 5d 13 00 00       	call   80293e <strcpy>
+  8015e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015eb:	e8 af f9 ff ff       	call   800f9f <fsipc>
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f6:	c9                   	leave
+  8015f7:	c3                   	ret
+  8015f8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8015fd:	eb f4                	jmp    8015f3 <remove+0x3a>
+
+008015ff <sync>:
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	83 ec 08             	sub    $0x8,%esp
+  801605:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80160f:	e8 8b f9 ff ff       	call   800f9f <fsipc>
+  801614:	c9                   	leave
+  801615:	c3                   	ret
+
+00801616 <devsock_stat>:
+  801616:	55                   	push   %ebp
+  801617:	89 e5                	mov    %esp,%ebp
+  801619:	83 ec 10             	sub    $0x10,%esp
+  80161c:	68 28 32 80 00       	push   $0x803228
+  801621:	ff 75 0c             	push   0xc(%ebp)
+  801624:	e8 15 13 00 00       	call   80293e <strcpy>
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	c9                   	leave
+  80162f:	c3                   	ret
+
+00801630 <devsock_close>:
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	53                   	push   %ebx
+  801634:	83 ec 10             	sub    $0x10,%esp
+  801637:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80163a:	53                   	push   %ebx
+  80163b:	e8 e3 18 00 00       	call   802f23 <pageref>
+  801640:	89 c2                	mov    %eax,%edx
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164a:	83 fa 01             	cmp    $0x1,%edx
+  80164d:	74 05                	je     801654 <devsock_close+0x24>
+  80164f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801652:	c9                   	leave
+  801653:	c3                   	ret
+  801654:	83 ec 0c             	sub    $0xc,%esp
+  801657:	ff 73 0c             	push   0xc(%ebx)
+  80165a:	e8 aa 02 00 00       	call   801909 <nsipc_close>
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	eb eb                	jmp    80164f <devsock_close+0x1f>
+
+00801664 <devsock_write>:
+  801664:	55                   	push   %ebp
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	83 ec 08             	sub    $0x8,%esp
+  80166a:	6a 00                	push   $0x0
+  80166c:	ff 75 10             	push   0x10(%ebp)
+  80166f:	ff 75 0c             	push   0xc(%ebp)
+  801672:	8b 45 08             	mov    0x8(%ebp),%eax
+  801675:	ff 70 0c             	push   0xc(%eax)
+  801678:	e8 6c 03 00 00       	call   8019e9 <nsipc_send>
+  80167d:	c9                   	leave
+  80167e:	c3                   	ret
+
+0080167f <devsock_read>:
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	83 ec 08             	sub    $0x8,%esp
+  801685:	6a 00                	push   $0x0
+  801687:	ff 75 10             	push   0x10(%ebp)
+  80168a:	ff 75 0c             	push   0xc(%ebp)
+  80168d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801690:	ff 70 0c             	push   0xc(%eax)
+  801693:	e8 e2 02 00 00       	call   80197a <nsipc_recv>
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+
+0080169a <fd2sockid>:
+  80169a:	55                   	push   %ebp
+  80169b:	89 e5                	mov    %esp,%ebp
+  80169d:	83 ec 20             	sub    $0x20,%esp
+  8016a0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016a3:	52                   	push   %edx
+  8016a4:	50                   	push   %eax
+  8016a5:	e8 da f3 ff ff       	call   800a84 <fd_lookup>
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	78 10                	js     8016c1 <fd2sockid+0x27>
+  8016b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b4:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016ba:	39 08                	cmp    %ecx,(%eax)
+  8016bc:	75 05                	jne    8016c3 <fd2sockid+0x29>
+  8016be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016c1:	c9                   	leave
+  8016c2:	c3                   	ret
+  8016c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c8:	eb f7                	jmp    8016c1 <fd2sockid+0x27>
+
+008016ca <alloc_sockfd>:
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	56                   	push   %esi
+  8016ce:	53                   	push   %ebx
+  8016cf:	83 ec 1c             	sub    $0x1c,%esp
+  8016d2:	89 c6                	mov    %eax,%esi
+  8016d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d7:	50                   	push   %eax
+  8016d8:	e8 57 f3 ff ff       	call   800a34 <fd_alloc>
+  8016dd:	89 c3                	mov    %eax,%ebx
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	78 43                	js     801729 <alloc_sockfd+0x5f>
+  8016e6:	83 ec 04             	sub    $0x4,%esp
+  8016e9:	68 07 04 00 00       	push   $0x407
+  8016ee:	ff 75 f4             	push   -0xc(%ebp)
+  8016f1:	6a 00                	push   $0x0
+  8016f3:	e8 a7 ea ff ff       	call   80019f <sys_page_alloc>
+  8016f8:	89 c3                	mov    %eax,%ebx
+  8016fa:	83 c4 10             	add    $0x10,%esp
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	78 28                	js     801729 <alloc_sockfd+0x5f>
+  801701:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801704:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80170a:	89 10                	mov    %edx,(%eax)
+  80170c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801716:	89 70 0c             	mov    %esi,0xc(%eax)
+  801719:	83 ec 0c             	sub    $0xc,%esp
+  80171c:	50                   	push   %eax
+  80171d:	e8 eb f2 ff ff       	call   800a0d <fd2num>
+  801722:	89 c3                	mov    %eax,%ebx
+  801724:	83 c4 10             	add    $0x10,%esp
+  801727:	eb 0c                	jmp    801735 <alloc_sockfd+0x6b>
+  801729:	83 ec 0c             	sub    $0xc,%esp
+  80172c:	56                   	push   %esi
+  80172d:	e8 d7 01 00 00       	call   801909 <nsipc_close>
+  801732:	83 c4 10             	add    $0x10,%esp
+  801735:	89 d8                	mov    %ebx,%eax
+  801737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5e                   	pop    %esi
+  80173c:	5d                   	pop    %ebp
+  80173d:	c3                   	ret
+
+0080173e <accept>:
+  80173e:	55                   	push   %ebp
+  80173f:	89 e5                	mov    %esp,%ebp
+  801741:	83 ec 08             	sub    $0x8,%esp
+  801744:	8b 45 08             	mov    0x8(%ebp),%eax
+  801747:	e8 4e ff ff ff       	call   80169a <fd2sockid>
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	78 1b                	js     80176b <accept+0x2d>
+  801750:	83 ec 04             	sub    $0x4,%esp
+  801753:	ff 75 10             	push   0x10(%ebp)
+  801756:	ff 75 0c             	push   0xc(%ebp)
+  801759:	50                   	push   %eax
+  80175a:	e8 07 01 00 00       	call   801866 <nsipc_accept>
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	85 c0                	test   %eax,%eax
+  801764:	78 05                	js     80176b <accept+0x2d>
+  801766:	e8 5f ff ff ff       	call   8016ca <alloc_sockfd>
+  80176b:	c9                   	leave
+  80176c:	c3                   	ret
+
+0080176d <bind>:
+  80176d:	55                   	push   %ebp
+  80176e:	89 e5                	mov    %esp,%ebp
+  801770:	83 ec 08             	sub    $0x8,%esp
+  801773:	8b 45 08             	mov    0x8(%ebp),%eax
+  801776:	e8 1f ff ff ff       	call   80169a <fd2sockid>
+  80177b:	85 c0                	test   %eax,%eax
+  80177d:	78 12                	js     801791 <bind+0x24>
+  80177f:	83 ec 04             	sub    $0x4,%esp
+  801782:	ff 75 10             	push   0x10(%ebp)
+  801785:	ff 75 0c             	push   0xc(%ebp)
+  801788:	50                   	push   %eax
+  801789:	e8 24 01 00 00       	call   8018b2 <nsipc_bind>
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	c9                   	leave
+  801792:	c3                   	ret
+
+00801793 <shutdown>:
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	83 ec 08             	sub    $0x8,%esp
+  801799:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179c:	e8 f9 fe ff ff       	call   80169a <fd2sockid>
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	78 0f                	js     8017b4 <shutdown+0x21>
+  8017a5:	83 ec 08             	sub    $0x8,%esp
+  8017a8:	ff 75 0c             	push   0xc(%ebp)
+  8017ab:	50                   	push   %eax
+  8017ac:	e8 36 01 00 00       	call   8018e7 <nsipc_shutdown>
+  8017b1:	83 c4 10             	add    $0x10,%esp
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+008017b6 <connect>:
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	83 ec 08             	sub    $0x8,%esp
+  8017bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017bf:	e8 d6 fe ff ff       	call   80169a <fd2sockid>
+  8017c4:	85 c0                	test   %eax,%eax
+  8017c6:	78 12                	js     8017da <connect+0x24>
+  8017c8:	83 ec 04             	sub    $0x4,%esp
+  8017cb:	ff 75 10             	push   0x10(%ebp)
+  8017ce:	ff 75 0c             	push   0xc(%ebp)
+  8017d1:	50                   	push   %eax
+  8017d2:	e8 4c 01 00 00       	call   801923 <nsipc_connect>
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	c9                   	leave
+  8017db:	c3                   	ret
+
+008017dc <listen>:
+  8017dc:	55                   	push   %ebp
+  8017dd:	89 e5                	mov    %esp,%ebp
+  8017df:	83 ec 08             	sub    $0x8,%esp
+  8017e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e5:	e8 b0 fe ff ff       	call   80169a <fd2sockid>
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	78 0f                	js     8017fd <listen+0x21>
+  8017ee:	83 ec 08             	sub    $0x8,%esp
+  8017f1:	ff 75 0c             	push   0xc(%ebp)
+  8017f4:	50                   	push   %eax
+  8017f5:	e8 5e 01 00 00       	call   801958 <nsipc_listen>
+  8017fa:	83 c4 10             	add    $0x10,%esp
+  8017fd:	c9                   	leave
+  8017fe:	c3                   	ret
+
+008017ff <socket>:
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	83 ec 0c             	sub    $0xc,%esp
+  801805:	ff 75 10             	push   0x10(%ebp)
+  801808:	ff 75 0c             	push   0xc(%ebp)
+  80180b:	ff 75 08             	push   0x8(%ebp)
+  80180e:	e8 34 02 00 00       	call   801a47 <nsipc_socket>
+  801813:	83 c4 10             	add    $0x10,%esp
+  801816:	85 c0                	test   %eax,%eax
+  801818:	78 05                	js     80181f <socket+0x20>
+  80181a:	e8 ab fe ff ff       	call   8016ca <alloc_sockfd>
+  80181f:	c9                   	leave
+  801820:	c3                   	ret
+
+00801821 <nsipc>:
+  801821:	55                   	push   %ebp
+  801822:	89 e5                	mov    %esp,%ebp
+  801824:	53                   	push   %ebx
+  801825:	83 ec 04             	sub    $0x4,%esp
+  801828:	89 c3                	mov    %eax,%ebx
+  80182a:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801831:	74 1f                	je     801852 <nsipc+0x31>
+  801833:	83 ec 08             	sub    $0x8,%esp
+  801836:	6a 00                	push   $0x0
+  801838:	6a 00                	push   $0x0
+  80183a:	6a 07                	push   $0x7
+  80183c:	68 00 70 80 00       	push   $0x807000
+  801841:	53                   	push   %ebx
+  801842:	ff 35 0c 50 80 00    	push   0x80500c
+  801848:	e8 21 15 00 00       	call   802d6e <ipc_call>
+  80184d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801850:	c9                   	leave
+  801851:	c3                   	ret
+  801852:	83 ec 0c             	sub    $0xc,%esp
+  801855:	6a 03                	push   $0x3
+  801857:	e8 ad 16 00 00       	call   802f09 <ipc_find_env>
+  80185c:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	eb cd                	jmp    801833 <nsipc+0x12>
+
+00801866 <nsipc_accept>:
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	53                   	push   %ebx
+  80186a:	83 ec 04             	sub    $0x4,%esp
+  80186d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801870:	a3 00 70 80 00       	mov    %eax,0x807000
+  801875:	b8 01 00 00 00       	mov    $0x1,%eax
+  80187a:	e8 a2 ff ff ff       	call   801821 <nsipc>
+  80187f:	89 c3                	mov    %eax,%ebx
+  801881:	85 c0                	test   %eax,%eax
+  801883:	79 07                	jns    80188c <nsipc_accept+0x26>
+  801885:	89 d8                	mov    %ebx,%eax
+  801887:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80188a:	c9                   	leave
+  80188b:	c3                   	ret
+  80188c:	83 ec 04             	sub    $0x4,%esp
+  80188f:	ff 35 10 70 80 00    	push   0x807010
+  801895:	68 00 70 80 00       	push   $0x807000
+  80189a:	ff 75 0c             	push   0xc(%ebp)
+  80189d:	e8 4c 12 00 00       	call   802aee <memmove>
+  8018a2:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018a8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018ab:	89 10                	mov    %edx,(%eax)
+  8018ad:	83 c4 10             	add    $0x10,%esp
+  8018b0:	eb d3                	jmp    801885 <nsipc_accept+0x1f>
+
+008018b2 <nsipc_bind>:
+  8018b2:	55                   	push   %ebp
+  8018b3:	89 e5                	mov    %esp,%ebp
+  8018b5:	53                   	push   %ebx
+  8018b6:	83 ec 08             	sub    $0x8,%esp
+  8018b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bf:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018c4:	53                   	push   %ebx
+  8018c5:	ff 75 0c             	push   0xc(%ebp)
+  8018c8:	68 04 70 80 00       	push   $0x807004
+  8018cd:	e8 1c 12 00 00       	call   802aee <memmove>
+  8018d2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018d8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018dd:	e8 3f ff ff ff       	call   801821 <nsipc>
+  8018e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e5:	c9                   	leave
+  8018e6:	c3                   	ret
+
+008018e7 <nsipc_shutdown>:
+  8018e7:	55                   	push   %ebp
+  8018e8:	89 e5                	mov    %esp,%ebp
+  8018ea:	83 ec 08             	sub    $0x8,%esp
+  8018ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f8:	a3 04 70 80 00       	mov    %eax,0x807004
+  8018fd:	b8 03 00 00 00       	mov    $0x3,%eax
+  801902:	e8 1a ff ff ff       	call   801821 <nsipc>
+  801907:	c9                   	leave
+  801908:	c3                   	ret
+
+00801909 <nsipc_close>:
+  801909:	55                   	push   %ebp
+  80190a:	89 e5                	mov    %esp,%ebp
+  80190c:	83 ec 08             	sub    $0x8,%esp
+  80190f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801912:	a3 00 70 80 00       	mov    %eax,0x807000
+  801917:	b8 04 00 00 00       	mov    $0x4,%eax
+  80191c:	e8 00 ff ff ff       	call   801821 <nsipc>
+  801921:	c9                   	leave
+  801922:	c3                   	ret
+
+00801923 <nsipc_connect>:
+  801923:	55                   	push   %ebp
+  801924:	89 e5                	mov    %esp,%ebp
+  801926:	53                   	push   %ebx
+  801927:	83 ec 08             	sub    $0x8,%esp
+  80192a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80192d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801930:	a3 00 70 80 00       	mov    %eax,0x807000
+  801935:	53                   	push   %ebx
+  801936:	ff 75 0c             	push   0xc(%ebp)
+  801939:	68 04 70 80 00       	push   $0x807004
+  80193e:	e8 ab 11 00 00       	call   802aee <memmove>
+  801943:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801949:	b8 05 00 00 00       	mov    $0x5,%eax
+  80194e:	e8 ce fe ff ff       	call   801821 <nsipc>
+  801953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801956:	c9                   	leave
+  801957:	c3                   	ret
+
+00801958 <nsipc_listen>:
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	83 ec 08             	sub    $0x8,%esp
+  80195e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801961:	a3 00 70 80 00       	mov    %eax,0x807000
+  801966:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801969:	a3 04 70 80 00       	mov    %eax,0x807004
+  80196e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801973:	e8 a9 fe ff ff       	call   801821 <nsipc>
+  801978:	c9                   	leave
+  801979:	c3                   	ret
+
+0080197a <nsipc_recv>:
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	56                   	push   %esi
+  80197e:	53                   	push   %ebx
+  80197f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801982:	8b 45 08             	mov    0x8(%ebp),%eax
+  801985:	a3 00 70 80 00       	mov    %eax,0x807000
+  80198a:	89 35 04 70 80 00    	mov    %esi,0x807004
+  801990:	8b 45 14             	mov    0x14(%ebp),%eax
+  801993:	a3 08 70 80 00       	mov    %eax,0x807008
+  801998:	b8 07 00 00 00       	mov    $0x7,%eax
+  80199d:	e8 7f fe ff ff       	call   801821 <nsipc>
+  8019a2:	89 c3                	mov    %eax,%ebx
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	78 22                	js     8019ca <nsipc_recv+0x50>
+  8019a8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019ad:	39 c6                	cmp    %eax,%esi
+  8019af:	0f 4e c6             	cmovle %esi,%eax
+  8019b2:	39 c3                	cmp    %eax,%ebx
+  8019b4:	7f 1d                	jg     8019d3 <nsipc_recv+0x59>
+  8019b6:	83 ec 04             	sub    $0x4,%esp
+  8019b9:	53                   	push   %ebx
+  8019ba:	68 00 70 80 00       	push   $0x807000
+  8019bf:	ff 75 0c             	push   0xc(%ebp)
+  8019c2:	e8 27 11 00 00       	call   802aee <memmove>
+  8019c7:	83 c4 10             	add    $0x10,%esp
+  8019ca:	89 d8                	mov    %ebx,%eax
+  8019cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019cf:	5b                   	pop    %ebx
+  8019d0:	5e                   	pop    %esi
+  8019d1:	5d                   	pop    %ebp
+  8019d2:	c3                   	ret
+  8019d3:	68 34 32 80 00       	push   $0x803234
+  8019d8:	68 49 32 80 00       	push   $0x803249
+  8019dd:	6a 60                	push   $0x60
+  8019df:	68 5e 32 80 00       	push   $0x80325e
+  8019e4:	e8 83 07 00 00       	call   80216c <_panic>
+
+008019e9 <nsipc_send>:
+  8019e9:	55                   	push   %ebp
+  8019ea:	89 e5                	mov    %esp,%ebp
+  8019ec:	53                   	push   %ebx
+  8019ed:	83 ec 04             	sub    $0x4,%esp
+  8019f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8019fb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801a01:	7f 2e                	jg     801a31 <nsipc_send+0x48>
+  801a03:	83 ec 04             	sub    $0x4,%esp
+  801a06:	53                   	push   %ebx
+  801a07:	ff 75 0c             	push   0xc(%ebp)
+  801a0a:	68 0c 70 80 00       	push   $0x80700c
+  801a0f:	e8 da 10 00 00       	call   802aee <memmove>
+  801a14:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a1d:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a22:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a27:	e8 f5 fd ff ff       	call   801821 <nsipc>
+  801a2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a2f:	c9                   	leave
+  801a30:	c3                   	ret
+  801a31:	68 6a 32 80 00       	push   $0x80326a
+  801a36:	68 49 32 80 00       	push   $0x803249
+  801a3b:	6a 6b                	push   $0x6b
+  801a3d:	68 5e 32 80 00       	push   $0x80325e
+  801a42:	e8 25 07 00 00       	call   80216c <_panic>
+
+00801a47 <nsipc_socket>:
+  801a47:	55                   	push   %ebp
+  801a48:	89 e5                	mov    %esp,%ebp
+  801a4a:	83 ec 08             	sub    $0x8,%esp
+  801a4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a50:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a58:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a5d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a60:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a65:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a6a:	e8 b2 fd ff ff       	call   801821 <nsipc>
+  801a6f:	c9                   	leave
+  801a70:	c3                   	ret
+
+00801a71 <devpipe_stat>:
+  801a71:	55                   	push   %ebp
+  801a72:	89 e5                	mov    %esp,%ebp
+  801a74:	56                   	push   %esi
+  801a75:	53                   	push   %ebx
+  801a76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a79:	83 ec 0c             	sub    $0xc,%esp
+  801a7c:	ff 75 08             	push   0x8(%ebp)
+  801a7f:	e8 99 ef ff ff       	call   800a1d <fd2data>
+  801a84:	89 c6                	mov    %eax,%esi
+  801a86:	83 c4 08             	add    $0x8,%esp
+  801a89:	68 76 32 80 00       	push   $0x803276
+  801a8e:	53                   	push   %ebx
+  801a8f:	e8 aa 0e 00 00       	call   80293e <strcpy>
+  801a94:	8b 46 04             	mov    0x4(%esi),%eax
+  801a97:	2b 06                	sub    (%esi),%eax
+  801a99:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801a9f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801aa6:	00 00 00 
+  801aa9:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801ab0:	40 80 00 
+  801ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abb:	5b                   	pop    %ebx
+  801abc:	5e                   	pop    %esi
+  801abd:	5d                   	pop    %ebp
+  801abe:	c3                   	ret
+
+00801abf <devpipe_close>:
+  801abf:	55                   	push   %ebp
+  801ac0:	89 e5                	mov    %esp,%ebp
+  801ac2:	53                   	push   %ebx
+  801ac3:	83 ec 0c             	sub    $0xc,%esp
+  801ac6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ac9:	53                   	push   %ebx
+  801aca:	6a 00                	push   $0x0
+  801acc:	e8 a0 e7 ff ff       	call   800271 <sys_page_unmap>
+  801ad1:	89 1c 24             	mov    %ebx,(%esp)
+  801ad4:	e8 44 ef ff ff       	call   800a1d <fd2data>
+  801ad9:	83 c4 08             	add    $0x8,%esp
+  801adc:	50                   	push   %eax
+  801add:	6a 00                	push   $0x0
+  801adf:	e8 8d e7 ff ff       	call   800271 <sys_page_unmap>
+  801ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+00801ae9 <_pipeisclosed>:
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	57                   	push   %edi
+  801aed:	56                   	push   %esi
+  801aee:	53                   	push   %ebx
+  801aef:	83 ec 1c             	sub    $0x1c,%esp
+  801af2:	89 c7                	mov    %eax,%edi
+  801af4:	89 d6                	mov    %edx,%esi
+  801af6:	a1 10 50 80 00       	mov    0x805010,%eax
+  801afb:	8b 58 58             	mov    0x58(%eax),%ebx
+  801afe:	83 ec 0c             	sub    $0xc,%esp
+  801b01:	57                   	push   %edi
+  801b02:	e8 1c 14 00 00       	call   802f23 <pageref>
+  801b07:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b0a:	89 34 24             	mov    %esi,(%esp)
+  801b0d:	e8 11 14 00 00       	call   802f23 <pageref>
+  801b12:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b18:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b1b:	83 c4 10             	add    $0x10,%esp
+  801b1e:	39 cb                	cmp    %ecx,%ebx
+  801b20:	74 1b                	je     801b3d <_pipeisclosed+0x54>
+  801b22:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b25:	75 cf                	jne    801af6 <_pipeisclosed+0xd>
+  801b27:	8b 42 58             	mov    0x58(%edx),%eax
+  801b2a:	6a 01                	push   $0x1
+  801b2c:	50                   	push   %eax
+  801b2d:	53                   	push   %ebx
+  801b2e:	68 7d 32 80 00       	push   $0x80327d
+  801b33:	e8 0f 07 00 00       	call   802247 <cprintf>
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	eb b9                	jmp    801af6 <_pipeisclosed+0xd>
+  801b3d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b40:	0f 94 c0             	sete   %al
+  801b43:	0f b6 c0             	movzbl %al,%eax
+  801b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b49:	5b                   	pop    %ebx
+  801b4a:	5e                   	pop    %esi
+  801b4b:	5f                   	pop    %edi
+  801b4c:	5d                   	pop    %ebp
+  801b4d:	c3                   	ret
+
+00801b4e <devpipe_write>:
+  801b4e:	55                   	push   %ebp
+  801b4f:	89 e5                	mov    %esp,%ebp
+  801b51:	57                   	push   %edi
+  801b52:	56                   	push   %esi
+  801b53:	53                   	push   %ebx
+  801b54:	83 ec 28             	sub    $0x28,%esp
+  801b57:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b5a:	56                   	push   %esi
+  801b5b:	e8 bd ee ff ff       	call   800a1d <fd2data>
+  801b60:	89 c3                	mov    %eax,%ebx
+  801b62:	83 c4 10             	add    $0x10,%esp
+  801b65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b6a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b6e:	74 5c                	je     801bcc <devpipe_write+0x7e>
+  801b70:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b73:	8b 0b                	mov    (%ebx),%ecx
+  801b75:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b78:	39 d0                	cmp    %edx,%eax
+  801b7a:	72 1e                	jb     801b9a <devpipe_write+0x4c>
+  801b7c:	89 da                	mov    %ebx,%edx
+  801b7e:	89 f0                	mov    %esi,%eax
+  801b80:	e8 64 ff ff ff       	call   801ae9 <_pipeisclosed>
+  801b85:	85 c0                	test   %eax,%eax
+  801b87:	75 48                	jne    801bd1 <devpipe_write+0x83>
+  801b89:	e8 c6 e5 ff ff       	call   800154 <sys_yield>
+  801b8e:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b91:	8b 0b                	mov    (%ebx),%ecx
+  801b93:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b96:	39 d0                	cmp    %edx,%eax
+  801b98:	73 e2                	jae    801b7c <devpipe_write+0x2e>
+  801b9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b9d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801ba1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801ba4:	89 c2                	mov    %eax,%edx
+  801ba6:	c1 fa 1f             	sar    $0x1f,%edx
+  801ba9:	89 d1                	mov    %edx,%ecx
+  801bab:	c1 e9 1b             	shr    $0x1b,%ecx
+  801bae:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801bb1:	83 e2 1f             	and    $0x1f,%edx
+  801bb4:	29 ca                	sub    %ecx,%edx
+  801bb6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bba:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bbe:	83 c0 01             	add    $0x1,%eax
+  801bc1:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bc4:	83 c7 01             	add    $0x1,%edi
+  801bc7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bca:	75 a4                	jne    801b70 <devpipe_write+0x22>
+  801bcc:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bcf:	eb 05                	jmp    801bd6 <devpipe_write+0x88>
+  801bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd9:	5b                   	pop    %ebx
+  801bda:	5e                   	pop    %esi
+  801bdb:	5f                   	pop    %edi
+  801bdc:	5d                   	pop    %ebp
+  801bdd:	c3                   	ret
+
+00801bde <devpipe_read>:
+  801bde:	55                   	push   %ebp
+  801bdf:	89 e5                	mov    %esp,%ebp
+  801be1:	57                   	push   %edi
+  801be2:	56                   	push   %esi
+  801be3:	53                   	push   %ebx
+  801be4:	83 ec 18             	sub    $0x18,%esp
+  801be7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bea:	56                   	push   %esi
+  801beb:	e8 2d ee ff ff       	call   800a1d <fd2data>
+  801bf0:	89 c3                	mov    %eax,%ebx
+  801bf2:	83 c4 10             	add    $0x10,%esp
+  801bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801bfe:	74 45                	je     801c45 <devpipe_read+0x67>
+  801c00:	8b 03                	mov    (%ebx),%eax
+  801c02:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c05:	75 1d                	jne    801c24 <devpipe_read+0x46>
+  801c07:	85 ff                	test   %edi,%edi
+  801c09:	75 3f                	jne    801c4a <devpipe_read+0x6c>
+  801c0b:	89 da                	mov    %ebx,%edx
+  801c0d:	89 f0                	mov    %esi,%eax
+  801c0f:	e8 d5 fe ff ff       	call   801ae9 <_pipeisclosed>
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	75 3c                	jne    801c54 <devpipe_read+0x76>
+  801c18:	e8 37 e5 ff ff       	call   800154 <sys_yield>
+  801c1d:	8b 03                	mov    (%ebx),%eax
+  801c1f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c22:	74 e7                	je     801c0b <devpipe_read+0x2d>
+  801c24:	99                   	cltd
+  801c25:	c1 ea 1b             	shr    $0x1b,%edx
+  801c28:	01 d0                	add    %edx,%eax
+  801c2a:	83 e0 1f             	and    $0x1f,%eax
+  801c2d:	29 d0                	sub    %edx,%eax
+  801c2f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c37:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c3a:	83 03 01             	addl   $0x1,(%ebx)
+  801c3d:	83 c7 01             	add    $0x1,%edi
+  801c40:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c43:	75 bb                	jne    801c00 <devpipe_read+0x22>
+  801c45:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c48:	eb 02                	jmp    801c4c <devpipe_read+0x6e>
+  801c4a:	89 f8                	mov    %edi,%eax
+  801c4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c4f:	5b                   	pop    %ebx
+  801c50:	5e                   	pop    %esi
+  801c51:	5f                   	pop    %edi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+  801c54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c59:	eb f1                	jmp    801c4c <devpipe_read+0x6e>
+
+00801c5b <pipe>:
+  801c5b:	55                   	push   %ebp
+  801c5c:	89 e5                	mov    %esp,%ebp
+  801c5e:	56                   	push   %esi
+  801c5f:	53                   	push   %ebx
+  801c60:	83 ec 1c             	sub    $0x1c,%esp
+  801c63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c66:	50                   	push   %eax
+  801c67:	e8 c8 ed ff ff       	call   800a34 <fd_alloc>
+  801c6c:	89 c3                	mov    %eax,%ebx
+  801c6e:	83 c4 10             	add    $0x10,%esp
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	0f 88 23 01 00 00    	js     801d9c <pipe+0x141>
+  801c79:	83 ec 04             	sub    $0x4,%esp
+  801c7c:	68 07 04 00 00       	push   $0x407
+  801c81:	ff 75 f4             	push   -0xc(%ebp)
+  801c84:	6a 00                	push   $0x0
+  801c86:	e8 14 e5 ff ff       	call   80019f <sys_page_alloc>
+  801c8b:	89 c3                	mov    %eax,%ebx
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	0f 88 04 01 00 00    	js     801d9c <pipe+0x141>
+  801c98:	83 ec 0c             	sub    $0xc,%esp
+  801c9b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c9e:	50                   	push   %eax
+  801c9f:	e8 90 ed ff ff       	call   800a34 <fd_alloc>
+  801ca4:	89 c3                	mov    %eax,%ebx
+  801ca6:	83 c4 10             	add    $0x10,%esp
+  801ca9:	85 c0                	test   %eax,%eax
+  801cab:	0f 88 db 00 00 00    	js     801d8c <pipe+0x131>
+  801cb1:	83 ec 04             	sub    $0x4,%esp
+  801cb4:	68 07 04 00 00       	push   $0x407
+  801cb9:	ff 75 f0             	push   -0x10(%ebp)
+  801cbc:	6a 00                	push   $0x0
+  801cbe:	e8 dc e4 ff ff       	call   80019f <sys_page_alloc>
+  801cc3:	89 c3                	mov    %eax,%ebx
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	0f 88 bc 00 00 00    	js     801d8c <pipe+0x131>
+  801cd0:	83 ec 0c             	sub    $0xc,%esp
+  801cd3:	ff 75 f4             	push   -0xc(%ebp)
+  801cd6:	e8 42 ed ff ff       	call   800a1d <fd2data>
+  801cdb:	89 c6                	mov    %eax,%esi
+  801cdd:	83 c4 0c             	add    $0xc,%esp
+  801ce0:	68 07 04 00 00       	push   $0x407
+  801ce5:	50                   	push   %eax
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	e8 b2 e4 ff ff       	call   80019f <sys_page_alloc>
+  801ced:	89 c3                	mov    %eax,%ebx
+  801cef:	83 c4 10             	add    $0x10,%esp
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	0f 88 82 00 00 00    	js     801d7c <pipe+0x121>
+  801cfa:	83 ec 0c             	sub    $0xc,%esp
+  801cfd:	ff 75 f0             	push   -0x10(%ebp)
+  801d00:	e8 18 ed ff ff       	call   800a1d <fd2data>
+  801d05:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d0c:	50                   	push   %eax
+  801d0d:	6a 00                	push   $0x0
+  801d0f:	56                   	push   %esi
+  801d10:	6a 00                	push   $0x0
+  801d12:	e8 cb e4 ff ff       	call   8001e2 <sys_page_map>
+  801d17:	89 c3                	mov    %eax,%ebx
+  801d19:	83 c4 20             	add    $0x20,%esp
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	78 4e                	js     801d6e <pipe+0x113>
+  801d20:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d25:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d28:	89 02                	mov    %eax,(%edx)
+  801d2a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d2d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d34:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d37:	89 02                	mov    %eax,(%edx)
+  801d39:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d3c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d43:	83 ec 0c             	sub    $0xc,%esp
+  801d46:	ff 75 f4             	push   -0xc(%ebp)
+  801d49:	e8 bf ec ff ff       	call   800a0d <fd2num>
+  801d4e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d51:	89 01                	mov    %eax,(%ecx)
+  801d53:	83 c4 04             	add    $0x4,%esp
+  801d56:	ff 75 f0             	push   -0x10(%ebp)
+  801d59:	e8 af ec ff ff       	call   800a0d <fd2num>
+  801d5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d61:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d64:	83 c4 10             	add    $0x10,%esp
+  801d67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d6c:	eb 2e                	jmp    801d9c <pipe+0x141>
+  801d6e:	83 ec 08             	sub    $0x8,%esp
+  801d71:	56                   	push   %esi
+  801d72:	6a 00                	push   $0x0
+  801d74:	e8 f8 e4 ff ff       	call   800271 <sys_page_unmap>
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	83 ec 08             	sub    $0x8,%esp
+  801d7f:	ff 75 f0             	push   -0x10(%ebp)
+  801d82:	6a 00                	push   $0x0
+  801d84:	e8 e8 e4 ff ff       	call   800271 <sys_page_unmap>
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	83 ec 08             	sub    $0x8,%esp
+  801d8f:	ff 75 f4             	push   -0xc(%ebp)
+  801d92:	6a 00                	push   $0x0
+  801d94:	e8 d8 e4 ff ff       	call   800271 <sys_page_unmap>
+  801d99:	83 c4 10             	add    $0x10,%esp
+  801d9c:	89 d8                	mov    %ebx,%eax
+  801d9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da1:	5b                   	pop    %ebx
+  801da2:	5e                   	pop    %esi
+  801da3:	5d                   	pop    %ebp
+  801da4:	c3                   	ret
+
+00801da5 <pipeisclosed>:
+  801da5:	55                   	push   %ebp
+  801da6:	89 e5                	mov    %esp,%ebp
+  801da8:	83 ec 20             	sub    $0x20,%esp
+  801dab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dae:	50                   	push   %eax
+  801daf:	ff 75 08             	push   0x8(%ebp)
+  801db2:	e8 cd ec ff ff       	call   800a84 <fd_lookup>
+  801db7:	83 c4 10             	add    $0x10,%esp
+  801dba:	85 c0                	test   %eax,%eax
+  801dbc:	78 18                	js     801dd6 <pipeisclosed+0x31>
+  801dbe:	83 ec 0c             	sub    $0xc,%esp
+  801dc1:	ff 75 f4             	push   -0xc(%ebp)
+  801dc4:	e8 54 ec ff ff       	call   800a1d <fd2data>
+  801dc9:	89 c2                	mov    %eax,%edx
+  801dcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dce:	e8 16 fd ff ff       	call   801ae9 <_pipeisclosed>
+  801dd3:	83 c4 10             	add    $0x10,%esp
+  801dd6:	c9                   	leave
+  801dd7:	c3                   	ret
+
+00801dd8 <ipcring_init>:
+  801dd8:	55                   	push   %ebp
+  801dd9:	89 e5                	mov    %esp,%ebp
+  801ddb:	53                   	push   %ebx
+  801ddc:	83 ec 08             	sub    $0x8,%esp
+  801ddf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801de2:	6a 60                	push   $0x60
+  801de4:	6a 00                	push   $0x0
+  801de6:	53                   	push   %ebx
+  801de7:	e8 cd 0c 00 00       	call   802ab9 <memset>
+  801dec:	a1 10 50 80 00       	mov    0x805010,%eax
+  801df1:	8b 40 48             	mov    0x48(%eax),%eax
+  801df4:	89 03                	mov    %eax,(%ebx)
+  801df6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801df9:	89 43 04             	mov    %eax,0x4(%ebx)
+  801dfc:	8b 45 10             	mov    0x10(%ebp),%eax
+  801dff:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e02:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e05:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e08:	83 c4 10             	add    $0x10,%esp
+  801e0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0e:	c9                   	leave
+  801e0f:	c3                   	ret
+
+00801e10 <ipcring_req_slot>:
+  801e10:	55                   	push   %ebp
+  801e11:	89 e5                	mov    %esp,%ebp
+  801e13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e16:	8b 50 10             	mov    0x10(%eax),%edx
+  801e19:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e1c:	29 ca                	sub    %ecx,%edx
+  801e1e:	83 fa 07             	cmp    $0x7,%edx
+  801e21:	77 0c                	ja     801e2f <ipcring_req_slot+0x1f>
+  801e23:	8b 50 10             	mov    0x10(%eax),%edx
+  801e26:	83 e2 07             	and    $0x7,%edx
+  801e29:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e2d:	5d                   	pop    %ebp
+  801e2e:	c3                   	ret
+  801e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e34:	eb f7                	jmp    801e2d <ipcring_req_slot+0x1d>
+
+00801e36 <ipcring_req_push>:
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	83 ec 08             	sub    $0x8,%esp
+  801e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e3f:	8b 42 10             	mov    0x10(%edx),%eax
+  801e42:	83 c0 01             	add    $0x1,%eax
+  801e45:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	75 02                	jne    801e58 <ipcring_req_push+0x22>
+  801e56:	c9                   	leave
+  801e57:	c3                   	ret
+  801e58:	6a 00                	push   $0x0
+  801e5a:	68 00 00 80 ee       	push   $0xee800000
+  801e5f:	ff 72 08             	push   0x8(%edx)
+  801e62:	ff 72 04             	push   0x4(%edx)
+  801e65:	e8 6d e6 ff ff       	call   8004d7 <sys_ipc_send>
+  801e6a:	83 c4 10             	add    $0x10,%esp
+  801e6d:	eb e7                	jmp    801e56 <ipcring_req_push+0x20>
+
+00801e6f <ipcring_rsp_wait>:
+  801e6f:	55                   	push   %ebp
+  801e70:	89 e5                	mov    %esp,%ebp
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 04             	sub    $0x4,%esp
+  801e76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e79:	8b 53 18             	mov    0x18(%ebx),%edx
+  801e7c:	8b 43 10             	mov    0x10(%ebx),%eax
+  801e7f:	39 c2                	cmp    %eax,%edx
+  801e81:	74 3c                	je     801ebf <ipcring_rsp_wait+0x50>
+  801e83:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e86:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e89:	39 c2                	cmp    %eax,%edx
+  801e8b:	75 23                	jne    801eb0 <ipcring_rsp_wait+0x41>
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+  801e90:	6a 00                	push   $0x0
+  801e92:	6a 00                	push   $0x0
+  801e94:	6a 00                	push   $0x0
+  801e96:	6a 00                	push   $0x0
+  801e98:	ff 73 0c             	push   0xc(%ebx)
+  801e9b:	ff 73 04             	push   0x4(%ebx)
+  801e9e:	e8 cb 0e 00 00       	call   802d6e <ipc_call>
+  801ea3:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ea6:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ea9:	83 c4 20             	add    $0x20,%esp
+  801eac:	39 c2                	cmp    %eax,%edx
+  801eae:	74 dd                	je     801e8d <ipcring_rsp_wait+0x1e>
+  801eb0:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eb3:	83 e0 07             	and    $0x7,%eax
+  801eb6:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801eba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebd:	c9                   	leave
+  801ebe:	c3                   	ret
+  801ebf:	68 98 32 80 00       	push   $0x803298
+  801ec4:	68 49 32 80 00       	push   $0x803249
+  801ec9:	6a 3b                	push   $0x3b
+  801ecb:	68 b9 32 80 00       	push   $0x8032b9
+  801ed0:	e8 97 02 00 00       	call   80216c <_panic>
+
+00801ed5 <ipcring_rsp_pop>:
+  801ed5:	55                   	push   %ebp
+  801ed6:	89 e5                	mov    %esp,%ebp
+  801ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801edb:	8b 42 18             	mov    0x18(%edx),%eax
+  801ede:	83 c0 01             	add    $0x1,%eax
+  801ee1:	89 42 18             	mov    %eax,0x18(%edx)
+  801ee4:	5d                   	pop    %ebp
+  801ee5:	c3                   	ret
+
+00801ee6 <ipcring_server_init>:
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eef:	89 10                	mov    %edx,(%eax)
+  801ef1:	8b 55 10             	mov    0x10(%ebp),%edx
+  801ef4:	89 50 04             	mov    %edx,0x4(%eax)
+  801ef7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801efe:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f05:	5d                   	pop    %ebp
+  801f06:	c3                   	ret
+
+00801f07 <ipcring_req_avail>:
+  801f07:	55                   	push   %ebp
+  801f08:	89 e5                	mov    %esp,%ebp
+  801f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f0d:	8b 02                	mov    (%edx),%eax
+  801f0f:	8b 40 10             	mov    0x10(%eax),%eax
+  801f12:	2b 42 08             	sub    0x8(%edx),%eax
+  801f15:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f1a:	39 d0                	cmp    %edx,%eax
+  801f1c:	0f 47 c2             	cmova  %edx,%eax
+  801f1f:	5d                   	pop    %ebp
+  801f20:	c3                   	ret
+
+00801f21 <ipcring_req_peek>:
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f27:	8b 42 08             	mov    0x8(%edx),%eax
+  801f2a:	83 e0 07             	and    $0x7,%eax
+  801f2d:	8b 12                	mov    (%edx),%edx
+  801f2f:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f33:	5d                   	pop    %ebp
+  801f34:	c3                   	ret
+
+00801f35 <ipcring_rsp_push>:
+  801f35:	55                   	push   %ebp
+  801f36:	89 e5                	mov    %esp,%ebp
+  801f38:	83 ec 08             	sub    $0x8,%esp
+  801f3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f3e:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f41:	83 c0 01             	add    $0x1,%eax
+  801f44:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f47:	8b 11                	mov    (%ecx),%edx
+  801f49:	83 c2 14             	add    $0x14,%edx
+  801f4c:	f0 87 02             	lock xchg %eax,(%edx)
+  801f4f:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f53:	75 02                	jne    801f57 <ipcring_rsp_push+0x22>
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+  801f57:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f5e:	6a 00                	push   $0x0
+  801f60:	68 00 00 80 ee       	push   $0xee800000
+  801f65:	6a 00                	push   $0x0
+  801f67:	ff 71 04             	push   0x4(%ecx)
+  801f6a:	e8 8b e4 ff ff       	call   8003fa <sys_ipc_try_send>
+  801f6f:	83 c4 10             	add    $0x10,%esp
+  801f72:	eb e1                	jmp    801f55 <ipcring_rsp_push+0x20>
+
+00801f74 <ipcring_client_wait>:
+  801f74:	55                   	push   %ebp
+  801f75:	89 e5                	mov    %esp,%ebp
+  801f77:	83 ec 08             	sub    $0x8,%esp
+  801f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7d:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801f84:	8b 10                	mov    (%eax),%edx
+  801f86:	8b 52 18             	mov    0x18(%edx),%edx
+  801f89:	3b 50 08             	cmp    0x8(%eax),%edx
+  801f8c:	75 02                	jne    801f90 <ipcring_client_wait+0x1c>
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+  801f90:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f97:	6a 00                	push   $0x0
+  801f99:	68 00 00 80 ee       	push   $0xee800000
+  801f9e:	6a 00                	push   $0x0
+  801fa0:	ff 70 04             	push   0x4(%eax)
+  801fa3:	e8 52 e4 ff ff       	call   8003fa <sys_ipc_try_send>
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	eb e1                	jmp    801f8e <ipcring_client_wait+0x1a>
+
+00801fad <ipcring_server_sleep>:
+  801fad:	55                   	push   %ebp
+  801fae:	89 e5                	mov    %esp,%ebp
+  801fb0:	53                   	push   %ebx
+  801fb1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fb4:	8b 01                	mov    (%ecx),%eax
+  801fb6:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbe:	f0 87 02             	lock xchg %eax,(%edx)
+  801fc1:	8b 11                	mov    (%ecx),%edx
+  801fc3:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fc6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fcb:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801fce:	74 0e                	je     801fde <ipcring_server_sleep+0x31>
+  801fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd5:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe1:	c9                   	leave
+  801fe2:	c3                   	ret
+
+00801fe3 <devcons_close>:
+  801fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe8:	c3                   	ret
+
+00801fe9 <devcons_stat>:
+  801fe9:	55                   	push   %ebp
+  801fea:	89 e5                	mov    %esp,%ebp
+  801fec:	83 ec 10             	sub    $0x10,%esp
+  801fef:	68 c7 32 80 00       	push   $0x8032c7
+  801ff4:	ff 75 0c             	push   0xc(%ebp)
+  801ff7:	e8 42 09 00 00       	call   80293e <strcpy>
+  801ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802001:	c9                   	leave
+  802002:	c3                   	ret
+
+00802003 <devcons_write>:
+  802003:	55                   	push   %ebp
+  802004:	89 e5                	mov    %esp,%ebp
+  802006:	57                   	push   %edi
+  802007:	56                   	push   %esi
+  802008:	53                   	push   %ebx
+  802009:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80200f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802012:	85 ff                	test   %edi,%edi
+  802014:	74 51                	je     802067 <devcons_write+0x64>
+  802016:	be 00 00 00 00       	mov    $0x0,%esi
+  80201b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802020:	89 fb                	mov    %edi,%ebx
+  802022:	29 c3                	sub    %eax,%ebx
+  802024:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802029:	39 d3                	cmp    %edx,%ebx
+  80202b:	0f 47 da             	cmova  %edx,%ebx
+  80202e:	83 ec 04             	sub    $0x4,%esp
+  802031:	53                   	push   %ebx
+  802032:	03 45 0c             	add    0xc(%ebp),%eax
+  802035:	50                   	push   %eax
+  802036:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80203c:	50                   	push   %eax
+  80203d:	e8 ac 0a 00 00       	call   802aee <memmove>
+  802042:	83 c4 08             	add    $0x8,%esp
+  802045:	53                   	push   %ebx
+  802046:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80204c:	50                   	push   %eax
+  80204d:	e8 65 e0 ff ff       	call   8000b7 <sys_cputs>
+  802052:	01 de                	add    %ebx,%esi
+  802054:	89 f0                	mov    %esi,%eax
+  802056:	83 c4 10             	add    $0x10,%esp
+  802059:	39 fe                	cmp    %edi,%esi
+  80205b:	72 c3                	jb     802020 <devcons_write+0x1d>
+  80205d:	89 f0                	mov    %esi,%eax
+  80205f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802062:	5b                   	pop    %ebx
+  802063:	5e                   	pop    %esi
+  802064:	5f                   	pop    %edi
+  802065:	5d                   	pop    %ebp
+  802066:	c3                   	ret
+  802067:	be 00 00 00 00       	mov    $0x0,%esi
+  80206c:	eb ef                	jmp    80205d <devcons_write+0x5a>
+
+0080206e <devcons_read>:
+  80206e:	55                   	push   %ebp
+  80206f:	89 e5                	mov    %esp,%ebp
+  802071:	83 ec 08             	sub    $0x8,%esp
+  802074:	b8 00 00 00 00       	mov    $0x0,%eax
+  802079:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80207d:	75 07                	jne    802086 <devcons_read+0x18>
+  80207f:	eb 1f                	jmp    8020a0 <devcons_read+0x32>
+  802081:	e8 ce e0 ff ff       	call   800154 <sys_yield>
+  802086:	e8 4a e0 ff ff       	call   8000d5 <sys_cgetc>
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	74 f2                	je     802081 <devcons_read+0x13>
+  80208f:	78 0f                	js     8020a0 <devcons_read+0x32>
+  802091:	83 f8 04             	cmp    $0x4,%eax
+  802094:	74 0c                	je     8020a2 <devcons_read+0x34>
+  802096:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802099:	88 02                	mov    %al,(%edx)
+  80209b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020a0:	c9                   	leave
+  8020a1:	c3                   	ret
+  8020a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a7:	eb f7                	jmp    8020a0 <devcons_read+0x32>
+
+008020a9 <cputchar>:
+  8020a9:	55                   	push   %ebp
+  8020aa:	89 e5                	mov    %esp,%ebp
+  8020ac:	83 ec 20             	sub    $0x20,%esp
+  8020af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b2:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020b5:	6a 01                	push   $0x1
+  8020b7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020ba:	50                   	push   %eax
+  8020bb:	e8 f7 df ff ff       	call   8000b7 <sys_cputs>
+  8020c0:	83 c4 10             	add    $0x10,%esp
+  8020c3:	c9                   	leave
+  8020c4:	c3                   	ret
+
+008020c5 <getchar>:
+  8020c5:	55                   	push   %ebp
+  8020c6:	89 e5                	mov    %esp,%ebp
+  8020c8:	83 ec 1c             	sub    $0x1c,%esp
+  8020cb:	6a 01                	push   $0x1
+  8020cd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020d0:	50                   	push   %eax
+  8020d1:	6a 00                	push   $0x0
+  8020d3:	e8 0e ec ff ff       	call   800ce6 <read>
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	78 06                	js     8020e5 <getchar+0x20>
+  8020df:	74 06                	je     8020e7 <getchar+0x22>
+  8020e1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8020e5:	c9                   	leave
+  8020e6:	c3                   	ret
+  8020e7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020ec:	eb f7                	jmp    8020e5 <getchar+0x20>
+
+008020ee <iscons>:
+  8020ee:	55                   	push   %ebp
+  8020ef:	89 e5                	mov    %esp,%ebp
+  8020f1:	83 ec 20             	sub    $0x20,%esp
+  8020f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f7:	50                   	push   %eax
+  8020f8:	ff 75 08             	push   0x8(%ebp)
+  8020fb:	e8 84 e9 ff ff       	call   800a84 <fd_lookup>
+  802100:	83 c4 10             	add    $0x10,%esp
+  802103:	85 c0                	test   %eax,%eax
+  802105:	78 11                	js     802118 <iscons+0x2a>
+  802107:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80210a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802110:	39 10                	cmp    %edx,(%eax)
+  802112:	0f 94 c0             	sete   %al
+  802115:	0f b6 c0             	movzbl %al,%eax
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+0080211a <opencons>:
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	83 ec 24             	sub    $0x24,%esp
+  802120:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802123:	50                   	push   %eax
+  802124:	e8 0b e9 ff ff       	call   800a34 <fd_alloc>
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	78 3a                	js     80216a <opencons+0x50>
+  802130:	83 ec 04             	sub    $0x4,%esp
+  802133:	68 07 04 00 00       	push   $0x407
+  802138:	ff 75 f4             	push   -0xc(%ebp)
+  80213b:	6a 00                	push   $0x0
+  80213d:	e8 5d e0 ff ff       	call   80019f <sys_page_alloc>
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	85 c0                	test   %eax,%eax
+  802147:	78 21                	js     80216a <opencons+0x50>
+  802149:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214c:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802152:	89 10                	mov    %edx,(%eax)
+  802154:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802157:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80215e:	83 ec 0c             	sub    $0xc,%esp
+  802161:	50                   	push   %eax
+  802162:	e8 a6 e8 ff ff       	call   800a0d <fd2num>
+  802167:	83 c4 10             	add    $0x10,%esp
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+
+0080216c <_panic>:
+  80216c:	55                   	push   %ebp
+  80216d:	89 e5                	mov    %esp,%ebp
+  80216f:	56                   	push   %esi
+  802170:	53                   	push   %ebx
+  802171:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802174:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80217a:	e8 b6 df ff ff       	call   800135 <sys_getenvid>
+  80217f:	83 ec 0c             	sub    $0xc,%esp
+  802182:	ff 75 0c             	push   0xc(%ebp)
+  802185:	ff 75 08             	push   0x8(%ebp)
+  802188:	56                   	push   %esi
+  802189:	50                   	push   %eax
+  80218a:	68 d4 32 80 00       	push   $0x8032d4
+  80218f:	e8 b3 00 00 00       	call   802247 <cprintf>
+  802194:	83 c4 18             	add    $0x18,%esp
+  802197:	53                   	push   %ebx
+  802198:	ff 75 10             	push   0x10(%ebp)
+  80219b:	e8 56 00 00 00       	call   8021f6 <vcprintf>
+  8021a0:	c7 04 24 8e 32 80 00 	movl   $0x80328e,(%esp)
+  8021a7:	e8 9b 00 00 00       	call   802247 <cprintf>
+  8021ac:	83 c4 10             	add    $0x10,%esp
+  8021af:	cc                   	int3
+  8021b0:	eb fd                	jmp    8021af <_panic+0x43>
+
+008021b2 <putch>:
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	53                   	push   %ebx
+  8021b6:	83 ec 04             	sub    $0x4,%esp
+  8021b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021bc:	8b 13                	mov    (%ebx),%edx
+  8021be:	8d 42 01             	lea    0x1(%edx),%eax
+  8021c1:	89 03                	mov    %eax,(%ebx)
+  8021c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021c6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021ca:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021cf:	74 09                	je     8021da <putch+0x28>
+  8021d1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021d8:	c9                   	leave
+  8021d9:	c3                   	ret
+  8021da:	83 ec 08             	sub    $0x8,%esp
+  8021dd:	68 ff 00 00 00       	push   $0xff
+  8021e2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	e8 cc de ff ff       	call   8000b7 <sys_cputs>
+  8021eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8021f1:	83 c4 10             	add    $0x10,%esp
+  8021f4:	eb db                	jmp    8021d1 <putch+0x1f>
+
+008021f6 <vcprintf>:
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8021ff:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802206:	00 00 00 
+  802209:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802210:	00 00 00 
+  802213:	ff 75 0c             	push   0xc(%ebp)
+  802216:	ff 75 08             	push   0x8(%ebp)
+  802219:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80221f:	50                   	push   %eax
+  802220:	68 b2 21 80 00       	push   $0x8021b2
+  802225:	e8 1c 01 00 00       	call   802346 <vprintfmt>
+  80222a:	83 c4 08             	add    $0x8,%esp
+  80222d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802233:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802239:	50                   	push   %eax
+  80223a:	e8 78 de ff ff       	call   8000b7 <sys_cputs>
+  80223f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802245:	c9                   	leave
+  802246:	c3                   	ret
+
+00802247 <cprintf>:
+  802247:	55                   	push   %ebp
+  802248:	89 e5                	mov    %esp,%ebp
+  80224a:	83 ec 10             	sub    $0x10,%esp
+  80224d:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802250:	50                   	push   %eax
+  802251:	ff 75 08             	push   0x8(%ebp)
+  802254:	e8 9d ff ff ff       	call   8021f6 <vcprintf>
+  802259:	c9                   	leave
+  80225a:	c3                   	ret
+
+0080225b <printnum>:
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	57                   	push   %edi
+  80225f:	56                   	push   %esi
+  802260:	53                   	push   %ebx
+  802261:	83 ec 1c             	sub    $0x1c,%esp
+  802264:	89 c3                	mov    %eax,%ebx
+  802266:	89 d6                	mov    %edx,%esi
+  802268:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80226e:	89 d1                	mov    %edx,%ecx
+  802270:	89 c2                	mov    %eax,%edx
+  802272:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802275:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802278:	8b 45 10             	mov    0x10(%ebp),%eax
+  80227b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80227e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802285:	39 c2                	cmp    %eax,%edx
+  802287:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80228a:	73 4b                	jae    8022d7 <printnum+0x7c>
+  80228c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80228f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802292:	85 ff                	test   %edi,%edi
+  802294:	7e 11                	jle    8022a7 <printnum+0x4c>
+  802296:	83 ec 08             	sub    $0x8,%esp
+  802299:	56                   	push   %esi
+  80229a:	ff 75 18             	push   0x18(%ebp)
+  80229d:	ff d3                	call   *%ebx
+  80229f:	83 c4 10             	add    $0x10,%esp
+  8022a2:	83 ef 01             	sub    $0x1,%edi
+  8022a5:	75 ef                	jne    802296 <printnum+0x3b>
+  8022a7:	83 ec 08             	sub    $0x8,%esp
+  8022aa:	56                   	push   %esi
+  8022ab:	83 ec 04             	sub    $0x4,%esp
+  8022ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8022b1:	ff 75 e0             	push   -0x20(%ebp)
+  8022b4:	ff 75 dc             	push   -0x24(%ebp)
+  8022b7:	ff 75 d8             	push   -0x28(%ebp)
+  8022ba:	e8 9b 0d 00 00       	call   80305a <__umoddi3>
+  8022bf:	83 c4 14             	add    $0x14,%esp
+  8022c2:	0f be 80 f7 32 80 00 	movsbl 0x8032f7(%eax),%eax
+  8022c9:	50                   	push   %eax
+  8022ca:	ff d3                	call   *%ebx
+  8022cc:	83 c4 10             	add    $0x10,%esp
+  8022cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d2:	5b                   	pop    %ebx
+  8022d3:	5e                   	pop    %esi
+  8022d4:	5f                   	pop    %edi
+  8022d5:	5d                   	pop    %ebp
+  8022d6:	c3                   	ret
+  8022d7:	83 ec 0c             	sub    $0xc,%esp
+  8022da:	ff 75 18             	push   0x18(%ebp)
+  8022dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022e0:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8022e3:	52                   	push   %edx
+  8022e4:	50                   	push   %eax
+  8022e5:	83 ec 08             	sub    $0x8,%esp
+  8022e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8022eb:	ff 75 e0             	push   -0x20(%ebp)
+  8022ee:	ff 75 dc             	push   -0x24(%ebp)
+  8022f1:	ff 75 d8             	push   -0x28(%ebp)
+  8022f4:	e8 43 0d 00 00       	call   80303c <__udivdi3>
+  8022f9:	83 c4 18             	add    $0x18,%esp
+  8022fc:	52                   	push   %edx
+  8022fd:	50                   	push   %eax
+  8022fe:	89 f2                	mov    %esi,%edx
+  802300:	89 d8                	mov    %ebx,%eax
+  802302:	e8 54 ff ff ff       	call   80225b <printnum>
+  802307:	83 c4 20             	add    $0x20,%esp
+  80230a:	eb 9b                	jmp    8022a7 <printnum+0x4c>
+
+0080230c <sprintputch>:
+  80230c:	55                   	push   %ebp
+  80230d:	89 e5                	mov    %esp,%ebp
+  80230f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802312:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802316:	8b 10                	mov    (%eax),%edx
+  802318:	3b 50 04             	cmp    0x4(%eax),%edx
+  80231b:	73 0a                	jae    802327 <sprintputch+0x1b>
+  80231d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802320:	89 08                	mov    %ecx,(%eax)
+  802322:	8b 45 08             	mov    0x8(%ebp),%eax
+  802325:	88 02                	mov    %al,(%edx)
+  802327:	5d                   	pop    %ebp
+  802328:	c3                   	ret
+
+00802329 <printfmt>:
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	83 ec 08             	sub    $0x8,%esp
+  80232f:	8d 45 14             	lea    0x14(%ebp),%eax
+  802332:	50                   	push   %eax
+  802333:	ff 75 10             	push   0x10(%ebp)
+  802336:	ff 75 0c             	push   0xc(%ebp)
+  802339:	ff 75 08             	push   0x8(%ebp)
+  80233c:	e8 05 00 00 00       	call   802346 <vprintfmt>
+  802341:	83 c4 10             	add    $0x10,%esp
+  802344:	c9                   	leave
+  802345:	c3                   	ret
+
+00802346 <vprintfmt>:
+  802346:	55                   	push   %ebp
+  802347:	89 e5                	mov    %esp,%ebp
+  802349:	57                   	push   %edi
+  80234a:	56                   	push   %esi
+  80234b:	53                   	push   %ebx
+  80234c:	83 ec 2c             	sub    $0x2c,%esp
+  80234f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802352:	89 df                	mov    %ebx,%edi
+  802354:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802357:	8b 45 10             	mov    0x10(%ebp),%eax
+  80235a:	8d 70 01             	lea    0x1(%eax),%esi
+  80235d:	0f b6 00             	movzbl (%eax),%eax
+  802360:	83 f8 25             	cmp    $0x25,%eax
+  802363:	74 1e                	je     802383 <vprintfmt+0x3d>
+  802365:	85 c0                	test   %eax,%eax
+  802367:	0f 84 15 05 00 00    	je     802882 <vprintfmt+0x53c>
+  80236d:	83 ec 08             	sub    $0x8,%esp
+  802370:	53                   	push   %ebx
+  802371:	50                   	push   %eax
+  802372:	ff d7                	call   *%edi
+  802374:	83 c6 01             	add    $0x1,%esi
+  802377:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80237b:	83 c4 10             	add    $0x10,%esp
+  80237e:	83 f8 25             	cmp    $0x25,%eax
+  802381:	75 e2                	jne    802365 <vprintfmt+0x1f>
+  802383:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  802387:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80238e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802395:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80239c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023a1:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8023a4:	8d 56 01             	lea    0x1(%esi),%edx
+  8023a7:	0f b6 0e             	movzbl (%esi),%ecx
+  8023aa:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023ad:	3c 55                	cmp    $0x55,%al
+  8023af:	0f 87 3b 04 00 00    	ja     8027f0 <vprintfmt+0x4aa>
+  8023b5:	0f b6 c0             	movzbl %al,%eax
+  8023b8:	ff 24 85 40 34 80 00 	jmp    *0x803440(,%eax,4)
+  8023bf:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023c2:	eb 93                	jmp    802357 <vprintfmt+0x11>
+  8023c4:	89 d6                	mov    %edx,%esi
+  8023c6:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023ca:	eb d8                	jmp    8023a4 <vprintfmt+0x5e>
+  8023cc:	89 d6                	mov    %edx,%esi
+  8023ce:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023d2:	eb d0                	jmp    8023a4 <vprintfmt+0x5e>
+  8023d4:	0f b6 c9             	movzbl %cl,%ecx
+  8023d7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8023da:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023dd:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8023e1:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8023e4:	83 f9 09             	cmp    $0x9,%ecx
+  8023e7:	77 6f                	ja     802458 <vprintfmt+0x112>
+  8023e9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8023ec:	83 c2 01             	add    $0x1,%edx
+  8023ef:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8023f2:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8023f6:	0f be 02             	movsbl (%edx),%eax
+  8023f9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8023fc:	83 fe 09             	cmp    $0x9,%esi
+  8023ff:	76 eb                	jbe    8023ec <vprintfmt+0xa6>
+  802401:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802404:	89 d6                	mov    %edx,%esi
+  802406:	eb 13                	jmp    80241b <vprintfmt+0xd5>
+  802408:	8b 45 14             	mov    0x14(%ebp),%eax
+  80240b:	8b 00                	mov    (%eax),%eax
+  80240d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802410:	8b 45 14             	mov    0x14(%ebp),%eax
+  802413:	8d 40 04             	lea    0x4(%eax),%eax
+  802416:	89 45 14             	mov    %eax,0x14(%ebp)
+  802419:	89 d6                	mov    %edx,%esi
+  80241b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80241f:	79 83                	jns    8023a4 <vprintfmt+0x5e>
+  802421:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802424:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802427:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80242e:	e9 71 ff ff ff       	jmp    8023a4 <vprintfmt+0x5e>
+  802433:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802436:	85 c9                	test   %ecx,%ecx
+  802438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243d:	0f 49 c1             	cmovns %ecx,%eax
+  802440:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802443:	89 d6                	mov    %edx,%esi
+  802445:	e9 5a ff ff ff       	jmp    8023a4 <vprintfmt+0x5e>
+  80244a:	89 d6                	mov    %edx,%esi
+  80244c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  802453:	e9 4c ff ff ff       	jmp    8023a4 <vprintfmt+0x5e>
+  802458:	89 d6                	mov    %edx,%esi
+  80245a:	eb bf                	jmp    80241b <vprintfmt+0xd5>
+  80245c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802460:	89 d6                	mov    %edx,%esi
+  802462:	e9 3d ff ff ff       	jmp    8023a4 <vprintfmt+0x5e>
+  802467:	89 55 10             	mov    %edx,0x10(%ebp)
+  80246a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80246d:	8d 70 04             	lea    0x4(%eax),%esi
+  802470:	83 ec 08             	sub    $0x8,%esp
+  802473:	53                   	push   %ebx
+  802474:	ff 30                	push   (%eax)
+  802476:	ff d7                	call   *%edi
+  802478:	83 c4 10             	add    $0x10,%esp
+  80247b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80247e:	e9 d4 fe ff ff       	jmp    802357 <vprintfmt+0x11>
+  802483:	89 55 10             	mov    %edx,0x10(%ebp)
+  802486:	8b 45 14             	mov    0x14(%ebp),%eax
+  802489:	8d 70 04             	lea    0x4(%eax),%esi
+  80248c:	8b 10                	mov    (%eax),%edx
+  80248e:	89 d0                	mov    %edx,%eax
+  802490:	f7 d8                	neg    %eax
+  802492:	0f 48 c2             	cmovs  %edx,%eax
+  802495:	83 f8 12             	cmp    $0x12,%eax
+  802498:	7f 23                	jg     8024bd <vprintfmt+0x177>
+  80249a:	8b 14 85 a0 35 80 00 	mov    0x8035a0(,%eax,4),%edx
+  8024a1:	85 d2                	test   %edx,%edx
+  8024a3:	74 18                	je     8024bd <vprintfmt+0x177>
+  8024a5:	52                   	push   %edx
+  8024a6:	68 5b 32 80 00       	push   $0x80325b
+  8024ab:	53                   	push   %ebx
+  8024ac:	57                   	push   %edi
+  8024ad:	e8 77 fe ff ff       	call   802329 <printfmt>
+  8024b2:	83 c4 10             	add    $0x10,%esp
+  8024b5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024b8:	e9 9a fe ff ff       	jmp    802357 <vprintfmt+0x11>
+  8024bd:	50                   	push   %eax
+  8024be:	68 0f 33 80 00       	push   $0x80330f
+  8024c3:	53                   	push   %ebx
+  8024c4:	57                   	push   %edi
+  8024c5:	e8 5f fe ff ff       	call   802329 <printfmt>
+  8024ca:	83 c4 10             	add    $0x10,%esp
+  8024cd:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024d0:	e9 82 fe ff ff       	jmp    802357 <vprintfmt+0x11>
+  8024d5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024db:	83 c0 04             	add    $0x4,%eax
+  8024de:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8024e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e4:	8b 00                	mov    (%eax),%eax
+  8024e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024e9:	85 c0                	test   %eax,%eax
+  8024eb:	0f 84 61 03 00 00    	je     802852 <vprintfmt+0x50c>
+  8024f1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8024f5:	7e 06                	jle    8024fd <vprintfmt+0x1b7>
+  8024f7:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8024fb:	75 29                	jne    802526 <vprintfmt+0x1e0>
+  8024fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802500:	8d 70 01             	lea    0x1(%eax),%esi
+  802503:	0f b6 00             	movzbl (%eax),%eax
+  802506:	0f be d0             	movsbl %al,%edx
+  802509:	85 d2                	test   %edx,%edx
+  80250b:	0f 84 bb 00 00 00    	je     8025cc <vprintfmt+0x286>
+  802511:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802514:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802517:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80251a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80251d:	eb 7a                	jmp    802599 <vprintfmt+0x253>
+  80251f:	c7 45 d0 08 33 80 00 	movl   $0x803308,-0x30(%ebp)
+  802526:	83 ec 08             	sub    $0x8,%esp
+  802529:	ff 75 d4             	push   -0x2c(%ebp)
+  80252c:	ff 75 d0             	push   -0x30(%ebp)
+  80252f:	e8 e0 03 00 00       	call   802914 <strnlen>
+  802534:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802537:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80253a:	83 c4 10             	add    $0x10,%esp
+  80253d:	85 d2                	test   %edx,%edx
+  80253f:	0f 8e d6 02 00 00    	jle    80281b <vprintfmt+0x4d5>
+  802545:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802549:	83 ec 08             	sub    $0x8,%esp
+  80254c:	53                   	push   %ebx
+  80254d:	56                   	push   %esi
+  80254e:	ff d7                	call   *%edi
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802557:	75 f0                	jne    802549 <vprintfmt+0x203>
+  802559:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80255c:	8d 70 01             	lea    0x1(%eax),%esi
+  80255f:	0f b6 00             	movzbl (%eax),%eax
+  802562:	0f be d0             	movsbl %al,%edx
+  802565:	85 d2                	test   %edx,%edx
+  802567:	0f 84 da 02 00 00    	je     802847 <vprintfmt+0x501>
+  80256d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802570:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802573:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802576:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802579:	eb 1e                	jmp    802599 <vprintfmt+0x253>
+  80257b:	83 ec 08             	sub    $0x8,%esp
+  80257e:	ff 75 0c             	push   0xc(%ebp)
+  802581:	52                   	push   %edx
+  802582:	ff 55 08             	call   *0x8(%ebp)
+  802585:	83 c4 10             	add    $0x10,%esp
+  802588:	83 eb 01             	sub    $0x1,%ebx
+  80258b:	83 c6 01             	add    $0x1,%esi
+  80258e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802592:	0f be d0             	movsbl %al,%edx
+  802595:	85 d2                	test   %edx,%edx
+  802597:	74 2a                	je     8025c3 <vprintfmt+0x27d>
+  802599:	85 ff                	test   %edi,%edi
+  80259b:	78 05                	js     8025a2 <vprintfmt+0x25c>
+  80259d:	83 ef 01             	sub    $0x1,%edi
+  8025a0:	78 59                	js     8025fb <vprintfmt+0x2b5>
+  8025a2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8025a6:	74 d3                	je     80257b <vprintfmt+0x235>
+  8025a8:	0f be c0             	movsbl %al,%eax
+  8025ab:	83 e8 20             	sub    $0x20,%eax
+  8025ae:	83 f8 5e             	cmp    $0x5e,%eax
+  8025b1:	76 c8                	jbe    80257b <vprintfmt+0x235>
+  8025b3:	83 ec 08             	sub    $0x8,%esp
+  8025b6:	ff 75 0c             	push   0xc(%ebp)
+  8025b9:	6a 3f                	push   $0x3f
+  8025bb:	ff 55 08             	call   *0x8(%ebp)
+  8025be:	83 c4 10             	add    $0x10,%esp
+  8025c1:	eb c5                	jmp    802588 <vprintfmt+0x242>
+  8025c3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025cc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025cf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025d3:	7e 1b                	jle    8025f0 <vprintfmt+0x2aa>
+  8025d5:	83 ec 08             	sub    $0x8,%esp
+  8025d8:	53                   	push   %ebx
+  8025d9:	6a 20                	push   $0x20
+  8025db:	ff d7                	call   *%edi
+  8025dd:	83 c4 10             	add    $0x10,%esp
+  8025e0:	83 ee 01             	sub    $0x1,%esi
+  8025e3:	75 f0                	jne    8025d5 <vprintfmt+0x28f>
+  8025e5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025eb:	e9 67 fd ff ff       	jmp    802357 <vprintfmt+0x11>
+  8025f0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025f6:	e9 5c fd ff ff       	jmp    802357 <vprintfmt+0x11>
+  8025fb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802601:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802604:	eb c6                	jmp    8025cc <vprintfmt+0x286>
+  802606:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802609:	89 55 10             	mov    %edx,0x10(%ebp)
+  80260c:	83 f9 01             	cmp    $0x1,%ecx
+  80260f:	7f 1f                	jg     802630 <vprintfmt+0x2ea>
+  802611:	85 c9                	test   %ecx,%ecx
+  802613:	74 67                	je     80267c <vprintfmt+0x336>
+  802615:	8b 45 14             	mov    0x14(%ebp),%eax
+  802618:	8b 30                	mov    (%eax),%esi
+  80261a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80261d:	89 f0                	mov    %esi,%eax
+  80261f:	c1 f8 1f             	sar    $0x1f,%eax
+  802622:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802625:	8b 45 14             	mov    0x14(%ebp),%eax
+  802628:	8d 40 04             	lea    0x4(%eax),%eax
+  80262b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80262e:	eb 17                	jmp    802647 <vprintfmt+0x301>
+  802630:	8b 45 14             	mov    0x14(%ebp),%eax
+  802633:	8b 50 04             	mov    0x4(%eax),%edx
+  802636:	8b 00                	mov    (%eax),%eax
+  802638:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80263b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80263e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802641:	8d 40 08             	lea    0x8(%eax),%eax
+  802644:	89 45 14             	mov    %eax,0x14(%ebp)
+  802647:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80264a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80264d:	be 0a 00 00 00       	mov    $0xa,%esi
+  802652:	85 c9                	test   %ecx,%ecx
+  802654:	0f 89 12 01 00 00    	jns    80276c <vprintfmt+0x426>
+  80265a:	83 ec 08             	sub    $0x8,%esp
+  80265d:	53                   	push   %ebx
+  80265e:	6a 2d                	push   $0x2d
+  802660:	ff d7                	call   *%edi
+  802662:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802665:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802668:	f7 da                	neg    %edx
+  80266a:	83 d1 00             	adc    $0x0,%ecx
+  80266d:	f7 d9                	neg    %ecx
+  80266f:	83 c4 10             	add    $0x10,%esp
+  802672:	be 0a 00 00 00       	mov    $0xa,%esi
+  802677:	e9 f0 00 00 00       	jmp    80276c <vprintfmt+0x426>
+  80267c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80267f:	8b 30                	mov    (%eax),%esi
+  802681:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802684:	89 f0                	mov    %esi,%eax
+  802686:	c1 f8 1f             	sar    $0x1f,%eax
+  802689:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80268c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80268f:	8d 40 04             	lea    0x4(%eax),%eax
+  802692:	89 45 14             	mov    %eax,0x14(%ebp)
+  802695:	eb b0                	jmp    802647 <vprintfmt+0x301>
+  802697:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80269a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80269d:	83 f9 01             	cmp    $0x1,%ecx
+  8026a0:	7f 1e                	jg     8026c0 <vprintfmt+0x37a>
+  8026a2:	85 c9                	test   %ecx,%ecx
+  8026a4:	74 32                	je     8026d8 <vprintfmt+0x392>
+  8026a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a9:	8b 10                	mov    (%eax),%edx
+  8026ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8026b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026b6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026bb:	e9 ac 00 00 00       	jmp    80276c <vprintfmt+0x426>
+  8026c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026c3:	8b 10                	mov    (%eax),%edx
+  8026c5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8026cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026ce:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026d3:	e9 94 00 00 00       	jmp    80276c <vprintfmt+0x426>
+  8026d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026db:	8b 10                	mov    (%eax),%edx
+  8026dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8026e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026e8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026ed:	eb 7d                	jmp    80276c <vprintfmt+0x426>
+  8026ef:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026f2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026f5:	83 f9 01             	cmp    $0x1,%ecx
+  8026f8:	7f 1b                	jg     802715 <vprintfmt+0x3cf>
+  8026fa:	85 c9                	test   %ecx,%ecx
+  8026fc:	74 2c                	je     80272a <vprintfmt+0x3e4>
+  8026fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802701:	8b 10                	mov    (%eax),%edx
+  802703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802708:	8d 40 04             	lea    0x4(%eax),%eax
+  80270b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80270e:	be 08 00 00 00       	mov    $0x8,%esi
+  802713:	eb 57                	jmp    80276c <vprintfmt+0x426>
+  802715:	8b 45 14             	mov    0x14(%ebp),%eax
+  802718:	8b 10                	mov    (%eax),%edx
+  80271a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80271d:	8d 40 08             	lea    0x8(%eax),%eax
+  802720:	89 45 14             	mov    %eax,0x14(%ebp)
+  802723:	be 08 00 00 00       	mov    $0x8,%esi
+  802728:	eb 42                	jmp    80276c <vprintfmt+0x426>
+  80272a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80272d:	8b 10                	mov    (%eax),%edx
+  80272f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802734:	8d 40 04             	lea    0x4(%eax),%eax
+  802737:	89 45 14             	mov    %eax,0x14(%ebp)
+  80273a:	be 08 00 00 00       	mov    $0x8,%esi
+  80273f:	eb 2b                	jmp    80276c <vprintfmt+0x426>
+  802741:	89 55 10             	mov    %edx,0x10(%ebp)
+  802744:	83 ec 08             	sub    $0x8,%esp
+  802747:	53                   	push   %ebx
+  802748:	6a 30                	push   $0x30
+  80274a:	ff d7                	call   *%edi
+  80274c:	83 c4 08             	add    $0x8,%esp
+  80274f:	53                   	push   %ebx
+  802750:	6a 78                	push   $0x78
+  802752:	ff d7                	call   *%edi
+  802754:	8b 45 14             	mov    0x14(%ebp),%eax
+  802757:	8b 10                	mov    (%eax),%edx
+  802759:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275e:	83 c4 10             	add    $0x10,%esp
+  802761:	8d 40 04             	lea    0x4(%eax),%eax
+  802764:	89 45 14             	mov    %eax,0x14(%ebp)
+  802767:	be 10 00 00 00       	mov    $0x10,%esi
+  80276c:	83 ec 0c             	sub    $0xc,%esp
+  80276f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802773:	50                   	push   %eax
+  802774:	ff 75 e4             	push   -0x1c(%ebp)
+  802777:	56                   	push   %esi
+  802778:	51                   	push   %ecx
+  802779:	52                   	push   %edx
+  80277a:	89 da                	mov    %ebx,%edx
+  80277c:	89 f8                	mov    %edi,%eax
+  80277e:	e8 d8 fa ff ff       	call   80225b <printnum>
+  802783:	83 c4 20             	add    $0x20,%esp
+  802786:	e9 cc fb ff ff       	jmp    802357 <vprintfmt+0x11>
+  80278b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80278e:	89 55 10             	mov    %edx,0x10(%ebp)
+  802791:	83 f9 01             	cmp    $0x1,%ecx
+  802794:	7f 1b                	jg     8027b1 <vprintfmt+0x46b>
+  802796:	85 c9                	test   %ecx,%ecx
+  802798:	74 2c                	je     8027c6 <vprintfmt+0x480>
+  80279a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80279d:	8b 10                	mov    (%eax),%edx
+  80279f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8027a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027aa:	be 10 00 00 00       	mov    $0x10,%esi
+  8027af:	eb bb                	jmp    80276c <vprintfmt+0x426>
+  8027b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027b4:	8b 10                	mov    (%eax),%edx
+  8027b6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027b9:	8d 40 08             	lea    0x8(%eax),%eax
+  8027bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027bf:	be 10 00 00 00       	mov    $0x10,%esi
+  8027c4:	eb a6                	jmp    80276c <vprintfmt+0x426>
+  8027c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c9:	8b 10                	mov    (%eax),%edx
+  8027cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8027d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027d6:	be 10 00 00 00       	mov    $0x10,%esi
+  8027db:	eb 8f                	jmp    80276c <vprintfmt+0x426>
+  8027dd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027e0:	83 ec 08             	sub    $0x8,%esp
+  8027e3:	53                   	push   %ebx
+  8027e4:	6a 25                	push   $0x25
+  8027e6:	ff d7                	call   *%edi
+  8027e8:	83 c4 10             	add    $0x10,%esp
+  8027eb:	e9 67 fb ff ff       	jmp    802357 <vprintfmt+0x11>
+  8027f0:	83 ec 08             	sub    $0x8,%esp
+  8027f3:	53                   	push   %ebx
+  8027f4:	6a 25                	push   $0x25
+  8027f6:	ff d7                	call   *%edi
+  8027f8:	83 c4 10             	add    $0x10,%esp
+  8027fb:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8027ff:	0f 84 ba fb ff ff    	je     8023bf <vprintfmt+0x79>
+  802805:	89 75 10             	mov    %esi,0x10(%ebp)
+  802808:	89 f0                	mov    %esi,%eax
+  80280a:	83 e8 01             	sub    $0x1,%eax
+  80280d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802811:	75 f7                	jne    80280a <vprintfmt+0x4c4>
+  802813:	89 45 10             	mov    %eax,0x10(%ebp)
+  802816:	e9 3c fb ff ff       	jmp    802357 <vprintfmt+0x11>
+  80281b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80281e:	8d 70 01             	lea    0x1(%eax),%esi
+  802821:	0f b6 00             	movzbl (%eax),%eax
+  802824:	0f be d0             	movsbl %al,%edx
+  802827:	85 d2                	test   %edx,%edx
+  802829:	74 11                	je     80283c <vprintfmt+0x4f6>
+  80282b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80282e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802831:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802834:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802837:	e9 5d fd ff ff       	jmp    802599 <vprintfmt+0x253>
+  80283c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80283f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802842:	e9 10 fb ff ff       	jmp    802357 <vprintfmt+0x11>
+  802847:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80284a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80284d:	e9 05 fb ff ff       	jmp    802357 <vprintfmt+0x11>
+  802852:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802856:	7e 0a                	jle    802862 <vprintfmt+0x51c>
+  802858:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80285c:	0f 85 bd fc ff ff    	jne    80251f <vprintfmt+0x1d9>
+  802862:	ba 28 00 00 00       	mov    $0x28,%edx
+  802867:	b8 28 00 00 00       	mov    $0x28,%eax
+  80286c:	be 09 33 80 00       	mov    $0x803309,%esi
+  802871:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802874:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802877:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80287a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80287d:	e9 17 fd ff ff       	jmp    802599 <vprintfmt+0x253>
+  802882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802885:	5b                   	pop    %ebx
+  802886:	5e                   	pop    %esi
+  802887:	5f                   	pop    %edi
+  802888:	5d                   	pop    %ebp
+  802889:	c3                   	ret
+
+0080288a <vsnprintf>:
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	83 ec 18             	sub    $0x18,%esp
+  802890:	8b 45 08             	mov    0x8(%ebp),%eax
+  802893:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802896:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802899:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80289d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8028a0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	74 26                	je     8028d1 <vsnprintf+0x47>
+  8028ab:	85 d2                	test   %edx,%edx
+  8028ad:	7e 22                	jle    8028d1 <vsnprintf+0x47>
+  8028af:	ff 75 14             	push   0x14(%ebp)
+  8028b2:	ff 75 10             	push   0x10(%ebp)
+  8028b5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028b8:	50                   	push   %eax
+  8028b9:	68 0c 23 80 00       	push   $0x80230c
+  8028be:	e8 83 fa ff ff       	call   802346 <vprintfmt>
+  8028c3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028c6:	c6 00 00             	movb   $0x0,(%eax)
+  8028c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028cc:	83 c4 10             	add    $0x10,%esp
+  8028cf:	c9                   	leave
+  8028d0:	c3                   	ret
+  8028d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028d6:	eb f7                	jmp    8028cf <vsnprintf+0x45>
+
+008028d8 <snprintf>:
+  8028d8:	55                   	push   %ebp
+  8028d9:	89 e5                	mov    %esp,%ebp
+  8028db:	83 ec 08             	sub    $0x8,%esp
+  8028de:	8d 45 14             	lea    0x14(%ebp),%eax
+  8028e1:	50                   	push   %eax
+  8028e2:	ff 75 10             	push   0x10(%ebp)
+  8028e5:	ff 75 0c             	push   0xc(%ebp)
+  8028e8:	ff 75 08             	push   0x8(%ebp)
+  8028eb:	e8 9a ff ff ff       	call   80288a <vsnprintf>
+  8028f0:	c9                   	leave
+  8028f1:	c3                   	ret
+
+008028f2 <strlen>:
+  8028f2:	55                   	push   %ebp
+  8028f3:	89 e5                	mov    %esp,%ebp
+  8028f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028f8:	80 3a 00             	cmpb   $0x0,(%edx)
+  8028fb:	74 10                	je     80290d <strlen+0x1b>
+  8028fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802902:	83 c0 01             	add    $0x1,%eax
+  802905:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802909:	75 f7                	jne    802902 <strlen+0x10>
+  80290b:	5d                   	pop    %ebp
+  80290c:	c3                   	ret
+  80290d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802912:	eb f7                	jmp    80290b <strlen+0x19>
+
+00802914 <strnlen>:
+  802914:	55                   	push   %ebp
+  802915:	89 e5                	mov    %esp,%ebp
+  802917:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80291a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80291d:	85 d2                	test   %edx,%edx
+  80291f:	74 16                	je     802937 <strnlen+0x23>
+  802921:	b8 00 00 00 00       	mov    $0x0,%eax
+  802926:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80292a:	74 09                	je     802935 <strnlen+0x21>
+  80292c:	83 c0 01             	add    $0x1,%eax
+  80292f:	39 d0                	cmp    %edx,%eax
+  802931:	75 f3                	jne    802926 <strnlen+0x12>
+  802933:	89 d0                	mov    %edx,%eax
+  802935:	5d                   	pop    %ebp
+  802936:	c3                   	ret
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293c:	eb f7                	jmp    802935 <strnlen+0x21>
+
+0080293e <strcpy>:
+  80293e:	55                   	push   %ebp
+  80293f:	89 e5                	mov    %esp,%ebp
+  802941:	53                   	push   %ebx
+  802942:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802945:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802951:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802954:	83 c0 01             	add    $0x1,%eax
+  802957:	84 d2                	test   %dl,%dl
+  802959:	75 f2                	jne    80294d <strcpy+0xf>
+  80295b:	89 c8                	mov    %ecx,%eax
+  80295d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+
+00802962 <strcat>:
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	53                   	push   %ebx
+  802966:	83 ec 10             	sub    $0x10,%esp
+  802969:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80296c:	53                   	push   %ebx
+  80296d:	e8 80 ff ff ff       	call   8028f2 <strlen>
+  802972:	83 c4 08             	add    $0x8,%esp
+  802975:	ff 75 0c             	push   0xc(%ebp)
+  802978:	01 d8                	add    %ebx,%eax
+  80297a:	50                   	push   %eax
+  80297b:	e8 be ff ff ff       	call   80293e <strcpy>
+  802980:	89 d8                	mov    %ebx,%eax
+  802982:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802985:	c9                   	leave
+  802986:	c3                   	ret
+
+00802987 <strncpy>:
+  802987:	55                   	push   %ebp
+  802988:	89 e5                	mov    %esp,%ebp
+  80298a:	56                   	push   %esi
+  80298b:	53                   	push   %ebx
+  80298c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80298f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802992:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802995:	85 db                	test   %ebx,%ebx
+  802997:	74 17                	je     8029b0 <strncpy+0x29>
+  802999:	01 f3                	add    %esi,%ebx
+  80299b:	89 f0                	mov    %esi,%eax
+  80299d:	83 c0 01             	add    $0x1,%eax
+  8029a0:	0f b6 0a             	movzbl (%edx),%ecx
+  8029a3:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029a6:	80 f9 01             	cmp    $0x1,%cl
+  8029a9:	83 da ff             	sbb    $0xffffffff,%edx
+  8029ac:	39 c3                	cmp    %eax,%ebx
+  8029ae:	75 ed                	jne    80299d <strncpy+0x16>
+  8029b0:	89 f0                	mov    %esi,%eax
+  8029b2:	5b                   	pop    %ebx
+  8029b3:	5e                   	pop    %esi
+  8029b4:	5d                   	pop    %ebp
+  8029b5:	c3                   	ret
+
+008029b6 <strlcpy>:
+  8029b6:	55                   	push   %ebp
+  8029b7:	89 e5                	mov    %esp,%ebp
+  8029b9:	56                   	push   %esi
+  8029ba:	53                   	push   %ebx
+  8029bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029c4:	89 f0                	mov    %esi,%eax
+  8029c6:	85 db                	test   %ebx,%ebx
+  8029c8:	74 1e                	je     8029e8 <strlcpy+0x32>
+  8029ca:	83 eb 01             	sub    $0x1,%ebx
+  8029cd:	74 16                	je     8029e5 <strlcpy+0x2f>
+  8029cf:	01 f3                	add    %esi,%ebx
+  8029d1:	0f b6 0a             	movzbl (%edx),%ecx
+  8029d4:	84 c9                	test   %cl,%cl
+  8029d6:	74 0d                	je     8029e5 <strlcpy+0x2f>
+  8029d8:	83 c2 01             	add    $0x1,%edx
+  8029db:	83 c0 01             	add    $0x1,%eax
+  8029de:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029e1:	39 d8                	cmp    %ebx,%eax
+  8029e3:	75 ec                	jne    8029d1 <strlcpy+0x1b>
+  8029e5:	c6 00 00             	movb   $0x0,(%eax)
+  8029e8:	29 f0                	sub    %esi,%eax
+  8029ea:	5b                   	pop    %ebx
+  8029eb:	5e                   	pop    %esi
+  8029ec:	5d                   	pop    %ebp
+  8029ed:	c3                   	ret
+
+008029ee <strcmp>:
+  8029ee:	55                   	push   %ebp
+  8029ef:	89 e5                	mov    %esp,%ebp
+  8029f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029f7:	0f b6 01             	movzbl (%ecx),%eax
+  8029fa:	84 c0                	test   %al,%al
+  8029fc:	74 11                	je     802a0f <strcmp+0x21>
+  8029fe:	38 02                	cmp    %al,(%edx)
+  802a00:	75 0d                	jne    802a0f <strcmp+0x21>
+  802a02:	83 c1 01             	add    $0x1,%ecx
+  802a05:	83 c2 01             	add    $0x1,%edx
+  802a08:	0f b6 01             	movzbl (%ecx),%eax
+  802a0b:	84 c0                	test   %al,%al
+  802a0d:	75 ef                	jne    8029fe <strcmp+0x10>
+  802a0f:	0f b6 c0             	movzbl %al,%eax
+  802a12:	0f b6 12             	movzbl (%edx),%edx
+  802a15:	29 d0                	sub    %edx,%eax
+  802a17:	5d                   	pop    %ebp
+  802a18:	c3                   	ret
+
+00802a19 <strncmp>:
+  802a19:	55                   	push   %ebp
+  802a1a:	89 e5                	mov    %esp,%ebp
+  802a1c:	53                   	push   %ebx
+  802a1d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a23:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2b:	85 d2                	test   %edx,%edx
+  802a2d:	74 2e                	je     802a5d <strncmp+0x44>
+  802a2f:	0f b6 01             	movzbl (%ecx),%eax
+  802a32:	84 c0                	test   %al,%al
+  802a34:	74 16                	je     802a4c <strncmp+0x33>
+  802a36:	3a 03                	cmp    (%ebx),%al
+  802a38:	75 12                	jne    802a4c <strncmp+0x33>
+  802a3a:	83 c1 01             	add    $0x1,%ecx
+  802a3d:	83 c3 01             	add    $0x1,%ebx
+  802a40:	83 ea 01             	sub    $0x1,%edx
+  802a43:	75 ea                	jne    802a2f <strncmp+0x16>
+  802a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4a:	eb 11                	jmp    802a5d <strncmp+0x44>
+  802a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a51:	85 d2                	test   %edx,%edx
+  802a53:	74 08                	je     802a5d <strncmp+0x44>
+  802a55:	0f b6 01             	movzbl (%ecx),%eax
+  802a58:	0f b6 13             	movzbl (%ebx),%edx
+  802a5b:	29 d0                	sub    %edx,%eax
+  802a5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+
+00802a62 <strchr>:
+  802a62:	55                   	push   %ebp
+  802a63:	89 e5                	mov    %esp,%ebp
+  802a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a68:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a6c:	0f b6 10             	movzbl (%eax),%edx
+  802a6f:	84 d2                	test   %dl,%dl
+  802a71:	74 15                	je     802a88 <strchr+0x26>
+  802a73:	38 d1                	cmp    %dl,%cl
+  802a75:	74 0f                	je     802a86 <strchr+0x24>
+  802a77:	83 c0 01             	add    $0x1,%eax
+  802a7a:	0f b6 10             	movzbl (%eax),%edx
+  802a7d:	84 d2                	test   %dl,%dl
+  802a7f:	75 f2                	jne    802a73 <strchr+0x11>
+  802a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a86:	5d                   	pop    %ebp
+  802a87:	c3                   	ret
+  802a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8d:	eb f7                	jmp    802a86 <strchr+0x24>
+
+00802a8f <strfind>:
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	53                   	push   %ebx
+  802a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a99:	0f b6 18             	movzbl (%eax),%ebx
+  802a9c:	38 d3                	cmp    %dl,%bl
+  802a9e:	74 14                	je     802ab4 <strfind+0x25>
+  802aa0:	89 d1                	mov    %edx,%ecx
+  802aa2:	84 db                	test   %bl,%bl
+  802aa4:	74 0e                	je     802ab4 <strfind+0x25>
+  802aa6:	83 c0 01             	add    $0x1,%eax
+  802aa9:	0f b6 10             	movzbl (%eax),%edx
+  802aac:	38 ca                	cmp    %cl,%dl
+  802aae:	74 04                	je     802ab4 <strfind+0x25>
+  802ab0:	84 d2                	test   %dl,%dl
+  802ab2:	75 f2                	jne    802aa6 <strfind+0x17>
+  802ab4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+
+00802ab9 <memset>:
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	57                   	push   %edi
+  802abd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ac0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802ac3:	85 c9                	test   %ecx,%ecx
+  802ac5:	74 20                	je     802ae7 <memset+0x2e>
+  802ac7:	89 f8                	mov    %edi,%eax
+  802ac9:	09 c8                	or     %ecx,%eax
+  802acb:	a8 03                	test   $0x3,%al
+  802acd:	75 12                	jne    802ae1 <memset+0x28>
+  802acf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802ad3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802ad9:	c1 e9 02             	shr    $0x2,%ecx
+  802adc:	fc                   	cld
+  802add:	f3 ab                	rep stos %eax,%es:(%edi)
+  802adf:	eb 06                	jmp    802ae7 <memset+0x2e>
+  802ae1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae4:	fc                   	cld
+  802ae5:	f3 aa                	rep stos %al,%es:(%edi)
+  802ae7:	89 f8                	mov    %edi,%eax
+  802ae9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802aec:	c9                   	leave
+  802aed:	c3                   	ret
+
+00802aee <memmove>:
+  802aee:	55                   	push   %ebp
+  802aef:	89 e5                	mov    %esp,%ebp
+  802af1:	57                   	push   %edi
+  802af2:	56                   	push   %esi
+  802af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802af9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802afc:	39 c6                	cmp    %eax,%esi
+  802afe:	73 32                	jae    802b32 <memmove+0x44>
+  802b00:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802b03:	39 d0                	cmp    %edx,%eax
+  802b05:	73 2b                	jae    802b32 <memmove+0x44>
+  802b07:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b0a:	89 d6                	mov    %edx,%esi
+  802b0c:	09 fe                	or     %edi,%esi
+  802b0e:	09 ce                	or     %ecx,%esi
+  802b10:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b16:	75 0e                	jne    802b26 <memmove+0x38>
+  802b18:	83 ef 04             	sub    $0x4,%edi
+  802b1b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b1e:	c1 e9 02             	shr    $0x2,%ecx
+  802b21:	fd                   	std
+  802b22:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b24:	eb 09                	jmp    802b2f <memmove+0x41>
+  802b26:	83 ef 01             	sub    $0x1,%edi
+  802b29:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b2c:	fd                   	std
+  802b2d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b2f:	fc                   	cld
+  802b30:	eb 1a                	jmp    802b4c <memmove+0x5e>
+  802b32:	89 f2                	mov    %esi,%edx
+  802b34:	09 c2                	or     %eax,%edx
+  802b36:	09 ca                	or     %ecx,%edx
+  802b38:	f6 c2 03             	test   $0x3,%dl
+  802b3b:	75 0a                	jne    802b47 <memmove+0x59>
+  802b3d:	c1 e9 02             	shr    $0x2,%ecx
+  802b40:	89 c7                	mov    %eax,%edi
+  802b42:	fc                   	cld
+  802b43:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b45:	eb 05                	jmp    802b4c <memmove+0x5e>
+  802b47:	89 c7                	mov    %eax,%edi
+  802b49:	fc                   	cld
+  802b4a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b4c:	5e                   	pop    %esi
+  802b4d:	5f                   	pop    %edi
+  802b4e:	5d                   	pop    %ebp
+  802b4f:	c3                   	ret
+
+00802b50 <memcpy>:
+  802b50:	55                   	push   %ebp
+  802b51:	89 e5                	mov    %esp,%ebp
+  802b53:	83 ec 0c             	sub    $0xc,%esp
+  802b56:	ff 75 10             	push   0x10(%ebp)
+  802b59:	ff 75 0c             	push   0xc(%ebp)
+  802b5c:	ff 75 08             	push   0x8(%ebp)
+  802b5f:	e8 8a ff ff ff       	call   802aee <memmove>
+  802b64:	c9                   	leave
+  802b65:	c3                   	ret
+
+00802b66 <memcmp>:
+  802b66:	55                   	push   %ebp
+  802b67:	89 e5                	mov    %esp,%ebp
+  802b69:	56                   	push   %esi
+  802b6a:	53                   	push   %ebx
+  802b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b71:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b74:	85 f6                	test   %esi,%esi
+  802b76:	74 29                	je     802ba1 <memcmp+0x3b>
+  802b78:	01 c6                	add    %eax,%esi
+  802b7a:	0f b6 08             	movzbl (%eax),%ecx
+  802b7d:	0f b6 1a             	movzbl (%edx),%ebx
+  802b80:	38 d9                	cmp    %bl,%cl
+  802b82:	75 11                	jne    802b95 <memcmp+0x2f>
+  802b84:	83 c0 01             	add    $0x1,%eax
+  802b87:	83 c2 01             	add    $0x1,%edx
+  802b8a:	39 c6                	cmp    %eax,%esi
+  802b8c:	75 ec                	jne    802b7a <memcmp+0x14>
+  802b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b93:	eb 08                	jmp    802b9d <memcmp+0x37>
+  802b95:	0f b6 c1             	movzbl %cl,%eax
+  802b98:	0f b6 db             	movzbl %bl,%ebx
+  802b9b:	29 d8                	sub    %ebx,%eax
+  802b9d:	5b                   	pop    %ebx
+  802b9e:	5e                   	pop    %esi
+  802b9f:	5d                   	pop    %ebp
+  802ba0:	c3                   	ret
+  802ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba6:	eb f5                	jmp    802b9d <memcmp+0x37>
+
+00802ba8 <memfind>:
+  802ba8:	55                   	push   %ebp
+  802ba9:	89 e5                	mov    %esp,%ebp
+  802bab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bb1:	89 c2                	mov    %eax,%edx
+  802bb3:	03 55 10             	add    0x10(%ebp),%edx
+  802bb6:	39 d0                	cmp    %edx,%eax
+  802bb8:	73 0d                	jae    802bc7 <memfind+0x1f>
+  802bba:	38 08                	cmp    %cl,(%eax)
+  802bbc:	74 0d                	je     802bcb <memfind+0x23>
+  802bbe:	83 c0 01             	add    $0x1,%eax
+  802bc1:	39 c2                	cmp    %eax,%edx
+  802bc3:	75 f5                	jne    802bba <memfind+0x12>
+  802bc5:	eb 06                	jmp    802bcd <memfind+0x25>
+  802bc7:	89 c2                	mov    %eax,%edx
+  802bc9:	eb 02                	jmp    802bcd <memfind+0x25>
+  802bcb:	89 c2                	mov    %eax,%edx
+  802bcd:	89 d0                	mov    %edx,%eax
+  802bcf:	5d                   	pop    %ebp
+  802bd0:	c3                   	ret
+
+00802bd1 <strtol>:
+  802bd1:	55                   	push   %ebp
+  802bd2:	89 e5                	mov    %esp,%ebp
+  802bd4:	57                   	push   %edi
+  802bd5:	56                   	push   %esi
+  802bd6:	53                   	push   %ebx
+  802bd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bdd:	0f b6 02             	movzbl (%edx),%eax
+  802be0:	3c 20                	cmp    $0x20,%al
+  802be2:	74 04                	je     802be8 <strtol+0x17>
+  802be4:	3c 09                	cmp    $0x9,%al
+  802be6:	75 0e                	jne    802bf6 <strtol+0x25>
+  802be8:	83 c2 01             	add    $0x1,%edx
+  802beb:	0f b6 02             	movzbl (%edx),%eax
+  802bee:	3c 20                	cmp    $0x20,%al
+  802bf0:	74 f6                	je     802be8 <strtol+0x17>
+  802bf2:	3c 09                	cmp    $0x9,%al
+  802bf4:	74 f2                	je     802be8 <strtol+0x17>
+  802bf6:	3c 2b                	cmp    $0x2b,%al
+  802bf8:	74 2a                	je     802c24 <strtol+0x53>
+  802bfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bff:	3c 2d                	cmp    $0x2d,%al
+  802c01:	74 2b                	je     802c2e <strtol+0x5d>
+  802c03:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c09:	75 0f                	jne    802c1a <strtol+0x49>
+  802c0b:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c0e:	74 28                	je     802c38 <strtol+0x67>
+  802c10:	85 db                	test   %ebx,%ebx
+  802c12:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c17:	0f 44 d8             	cmove  %eax,%ebx
+  802c1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c1f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c22:	eb 46                	jmp    802c6a <strtol+0x99>
+  802c24:	83 c2 01             	add    $0x1,%edx
+  802c27:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2c:	eb d5                	jmp    802c03 <strtol+0x32>
+  802c2e:	83 c2 01             	add    $0x1,%edx
+  802c31:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c36:	eb cb                	jmp    802c03 <strtol+0x32>
+  802c38:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c3c:	74 0e                	je     802c4c <strtol+0x7b>
+  802c3e:	85 db                	test   %ebx,%ebx
+  802c40:	75 d8                	jne    802c1a <strtol+0x49>
+  802c42:	83 c2 01             	add    $0x1,%edx
+  802c45:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c4a:	eb ce                	jmp    802c1a <strtol+0x49>
+  802c4c:	83 c2 02             	add    $0x2,%edx
+  802c4f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c54:	eb c4                	jmp    802c1a <strtol+0x49>
+  802c56:	0f be c0             	movsbl %al,%eax
+  802c59:	83 e8 30             	sub    $0x30,%eax
+  802c5c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c5f:	7d 3a                	jge    802c9b <strtol+0xca>
+  802c61:	83 c2 01             	add    $0x1,%edx
+  802c64:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c68:	01 c1                	add    %eax,%ecx
+  802c6a:	0f b6 02             	movzbl (%edx),%eax
+  802c6d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c70:	89 f3                	mov    %esi,%ebx
+  802c72:	80 fb 09             	cmp    $0x9,%bl
+  802c75:	76 df                	jbe    802c56 <strtol+0x85>
+  802c77:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802c7a:	89 f3                	mov    %esi,%ebx
+  802c7c:	80 fb 19             	cmp    $0x19,%bl
+  802c7f:	77 08                	ja     802c89 <strtol+0xb8>
+  802c81:	0f be c0             	movsbl %al,%eax
+  802c84:	83 e8 57             	sub    $0x57,%eax
+  802c87:	eb d3                	jmp    802c5c <strtol+0x8b>
+  802c89:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802c8c:	89 f3                	mov    %esi,%ebx
+  802c8e:	80 fb 19             	cmp    $0x19,%bl
+  802c91:	77 08                	ja     802c9b <strtol+0xca>
+  802c93:	0f be c0             	movsbl %al,%eax
+  802c96:	83 e8 37             	sub    $0x37,%eax
+  802c99:	eb c1                	jmp    802c5c <strtol+0x8b>
+  802c9b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802c9f:	74 05                	je     802ca6 <strtol+0xd5>
+  802ca1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ca4:	89 10                	mov    %edx,(%eax)
+  802ca6:	89 c8                	mov    %ecx,%eax
+  802ca8:	f7 d8                	neg    %eax
+  802caa:	85 ff                	test   %edi,%edi
+  802cac:	0f 45 c8             	cmovne %eax,%ecx
+  802caf:	89 c8                	mov    %ecx,%eax
+  802cb1:	5b                   	pop    %ebx
+  802cb2:	5e                   	pop    %esi
+  802cb3:	5f                   	pop    %edi
+  802cb4:	5d                   	pop    %ebp
+  802cb5:	c3                   	ret
+
+00802cb6 <ipc_recv>:
+  802cb6:	55                   	push   %ebp
+  802cb7:	89 e5                	mov    %esp,%ebp
+  802cb9:	56                   	push   %esi
+  802cba:	53                   	push   %ebx
+  802cbb:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802ccb:	0f 44 c2             	cmove  %edx,%eax
+  802cce:	83 ec 0c             	sub    $0xc,%esp
+  802cd1:	50                   	push   %eax
+  802cd2:	e8 73 d7 ff ff       	call   80044a <sys_ipc_recv>
+  802cd7:	83 c4 10             	add    $0x10,%esp
+  802cda:	85 c0                	test   %eax,%eax
+  802cdc:	78 2a                	js     802d08 <ipc_recv+0x52>
+  802cde:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ce3:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802ce9:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802cef:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802cf5:	85 f6                	test   %esi,%esi
+  802cf7:	74 02                	je     802cfb <ipc_recv+0x45>
+  802cf9:	89 0e                	mov    %ecx,(%esi)
+  802cfb:	85 db                	test   %ebx,%ebx
+  802cfd:	74 02                	je     802d01 <ipc_recv+0x4b>
+  802cff:	89 13                	mov    %edx,(%ebx)
+  802d01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d04:	5b                   	pop    %ebx
+  802d05:	5e                   	pop    %esi
+  802d06:	5d                   	pop    %ebp
+  802d07:	c3                   	ret
+  802d08:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d12:	eb e1                	jmp    802cf5 <ipc_recv+0x3f>
+
+00802d14 <ipc_send>:
+  802d14:	55                   	push   %ebp
+  802d15:	89 e5                	mov    %esp,%ebp
+  802d17:	57                   	push   %edi
+  802d18:	56                   	push   %esi
+  802d19:	53                   	push   %ebx
+  802d1a:	83 ec 0c             	sub    $0xc,%esp
+  802d1d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d23:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d26:	85 db                	test   %ebx,%ebx
+  802d28:	74 1e                	je     802d48 <ipc_send+0x34>
+  802d2a:	56                   	push   %esi
+  802d2b:	53                   	push   %ebx
+  802d2c:	57                   	push   %edi
+  802d2d:	ff 75 08             	push   0x8(%ebp)
+  802d30:	e8 a2 d7 ff ff       	call   8004d7 <sys_ipc_send>
+  802d35:	83 c4 10             	add    $0x10,%esp
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	74 2a                	je     802d66 <ipc_send+0x52>
+  802d3c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d3f:	75 13                	jne    802d54 <ipc_send+0x40>
+  802d41:	e8 0e d4 ff ff       	call   800154 <sys_yield>
+  802d46:	eb e2                	jmp    802d2a <ipc_send+0x16>
+  802d48:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4d:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d52:	eb d6                	jmp    802d2a <ipc_send+0x16>
+  802d54:	50                   	push   %eax
+  802d55:	68 0c 36 80 00       	push   $0x80360c
+  802d5a:	6a 4f                	push   $0x4f
+  802d5c:	68 4f 36 80 00       	push   $0x80364f
+  802d61:	e8 06 f4 ff ff       	call   80216c <_panic>
+  802d66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d69:	5b                   	pop    %ebx
+  802d6a:	5e                   	pop    %esi
+  802d6b:	5f                   	pop    %edi
+  802d6c:	5d                   	pop    %ebp
+  802d6d:	c3                   	ret
+
+00802d6e <ipc_call>:
+  802d6e:	55                   	push   %ebp
+  802d6f:	89 e5                	mov    %esp,%ebp
+  802d71:	57                   	push   %edi
+  802d72:	56                   	push   %esi
+  802d73:	53                   	push   %ebx
+  802d74:	83 ec 0c             	sub    $0xc,%esp
+  802d77:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d7b:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d80:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d84:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d88:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d8d:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802d91:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d9a:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802d9e:	eb 05                	jmp    802da5 <ipc_call+0x37>
+  802da0:	e8 af d3 ff ff       	call   800154 <sys_yield>
+  802da5:	83 ec 0c             	sub    $0xc,%esp
+  802da8:	56                   	push   %esi
+  802da9:	53                   	push   %ebx
+  802daa:	57                   	push   %edi
+  802dab:	ff 75 0c             	push   0xc(%ebp)
+  802dae:	ff 75 08             	push   0x8(%ebp)
+  802db1:	e8 71 d7 ff ff       	call   800527 <sys_ipc_call>
+  802db6:	83 c4 20             	add    $0x20,%esp
+  802db9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dbc:	74 e2                	je     802da0 <ipc_call+0x32>
+  802dbe:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802dc1:	74 2d                	je     802df0 <ipc_call+0x82>
+  802dc3:	85 c0                	test   %eax,%eax
+  802dc5:	78 4f                	js     802e16 <ipc_call+0xa8>
+  802dc7:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802dcb:	74 10                	je     802ddd <ipc_call+0x6f>
+  802dcd:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dd2:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802dd8:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802ddb:	89 02                	mov    %eax,(%edx)
+  802ddd:	a1 10 50 80 00       	mov    0x805010,%eax
+  802de2:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802deb:	5b                   	pop    %ebx
+  802dec:	5e                   	pop    %esi
+  802ded:	5f                   	pop    %edi
+  802dee:	5d                   	pop    %ebp
+  802def:	c3                   	ret
+  802df0:	ff 75 14             	push   0x14(%ebp)
+  802df3:	ff 75 10             	push   0x10(%ebp)
+  802df6:	ff 75 0c             	push   0xc(%ebp)
+  802df9:	ff 75 08             	push   0x8(%ebp)
+  802dfc:	e8 13 ff ff ff       	call   802d14 <ipc_send>
+  802e01:	83 c4 0c             	add    $0xc,%esp
+  802e04:	ff 75 1c             	push   0x1c(%ebp)
+  802e07:	ff 75 18             	push   0x18(%ebp)
+  802e0a:	6a 00                	push   $0x0
+  802e0c:	e8 a5 fe ff ff       	call   802cb6 <ipc_recv>
+  802e11:	83 c4 10             	add    $0x10,%esp
+  802e14:	eb d2                	jmp    802de8 <ipc_call+0x7a>
+  802e16:	50                   	push   %eax
+  802e17:	68 59 36 80 00       	push   $0x803659
+  802e1c:	6a 6d                	push   $0x6d
+  802e1e:	68 4f 36 80 00       	push   $0x80364f
+  802e23:	e8 44 f3 ff ff       	call   80216c <_panic>
+
+00802e28 <ipc_reply_recv>:
+  802e28:	55                   	push   %ebp
+  802e29:	89 e5                	mov    %esp,%ebp
+  802e2b:	57                   	push   %edi
+  802e2c:	56                   	push   %esi
+  802e2d:	53                   	push   %ebx
+  802e2e:	83 ec 0c             	sub    $0xc,%esp
+  802e31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e34:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e37:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e3a:	85 db                	test   %ebx,%ebx
+  802e3c:	0f 84 ac 00 00 00    	je     802eee <ipc_reply_recv+0xc6>
+  802e42:	85 f6                	test   %esi,%esi
+  802e44:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e49:	0f 45 c6             	cmovne %esi,%eax
+  802e4c:	83 ec 0c             	sub    $0xc,%esp
+  802e4f:	50                   	push   %eax
+  802e50:	ff 75 14             	push   0x14(%ebp)
+  802e53:	53                   	push   %ebx
+  802e54:	ff 75 0c             	push   0xc(%ebp)
+  802e57:	ff 75 08             	push   0x8(%ebp)
+  802e5a:	e8 e9 d6 ff ff       	call   800548 <sys_ipc_reply_recv>
+  802e5f:	83 c4 20             	add    $0x20,%esp
+  802e62:	85 c0                	test   %eax,%eax
+  802e64:	78 3a                	js     802ea0 <ipc_reply_recv+0x78>
+  802e66:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e6a:	74 10                	je     802e7c <ipc_reply_recv+0x54>
+  802e6c:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e71:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e77:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e7a:	89 02                	mov    %eax,(%edx)
+  802e7c:	85 ff                	test   %edi,%edi
+  802e7e:	74 0d                	je     802e8d <ipc_reply_recv+0x65>
+  802e80:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e85:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e8b:	89 07                	mov    %eax,(%edi)
+  802e8d:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e92:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e9b:	5b                   	pop    %ebx
+  802e9c:	5e                   	pop    %esi
+  802e9d:	5f                   	pop    %edi
+  802e9e:	5d                   	pop    %ebp
+  802e9f:	c3                   	ret
+  802ea0:	ff 75 14             	push   0x14(%ebp)
+  802ea3:	53                   	push   %ebx
+  802ea4:	ff 75 0c             	push   0xc(%ebp)
+  802ea7:	ff 75 08             	push   0x8(%ebp)
+  802eaa:	e8 4b d5 ff ff       	call   8003fa <sys_ipc_try_send>
+  802eaf:	89 c2                	mov    %eax,%edx
+  802eb1:	c1 ea 1f             	shr    $0x1f,%edx
+  802eb4:	83 c4 10             	add    $0x10,%esp
+  802eb7:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802eba:	0f 95 c1             	setne  %cl
+  802ebd:	84 d1                	test   %dl,%cl
+  802ebf:	74 05                	je     802ec6 <ipc_reply_recv+0x9e>
+  802ec1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ec4:	75 12                	jne    802ed8 <ipc_reply_recv+0xb0>
+  802ec6:	83 ec 04             	sub    $0x4,%esp
+  802ec9:	57                   	push   %edi
+  802eca:	56                   	push   %esi
+  802ecb:	ff 75 18             	push   0x18(%ebp)
+  802ece:	e8 e3 fd ff ff       	call   802cb6 <ipc_recv>
+  802ed3:	83 c4 10             	add    $0x10,%esp
+  802ed6:	eb c0                	jmp    802e98 <ipc_reply_recv+0x70>
+  802ed8:	83 ec 04             	sub    $0x4,%esp
+  802edb:	50                   	push   %eax
+  802edc:	ff 75 08             	push   0x8(%ebp)
+  802edf:	68 2c 36 80 00       	push   $0x80362c
+  802ee4:	e8 5e f3 ff ff       	call   802247 <cprintf>
+  802ee9:	83 c4 10             	add    $0x10,%esp
+  802eec:	eb d8                	jmp    802ec6 <ipc_reply_recv+0x9e>
+  802eee:	85 f6                	test   %esi,%esi
+  802ef0:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802ef5:	0f 45 c6             	cmovne %esi,%eax
+  802ef8:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802efd:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f04:	e9 43 ff ff ff       	jmp    802e4c <ipc_reply_recv+0x24>
+
+00802f09 <ipc_find_env>:
+  802f09:	55                   	push   %ebp
+  802f0a:	89 e5                	mov    %esp,%ebp
+  802f0c:	83 ec 14             	sub    $0x14,%esp
+  802f0f:	ff 75 08             	push   0x8(%ebp)
+  802f12:	e8 81 d4 ff ff       	call   800398 <sys_env_service>
+  802f17:	85 c0                	test   %eax,%eax
+  802f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1e:	0f 48 c2             	cmovs  %edx,%eax
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+
+00802f23 <pageref>:
+  802f23:	55                   	push   %ebp
+  802f24:	89 e5                	mov    %esp,%ebp
+  802f26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f29:	89 c2                	mov    %eax,%edx
+  802f2b:	c1 ea 16             	shr    $0x16,%edx
+  802f2e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f35:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f3a:	f6 c1 01             	test   $0x1,%cl
+  802f3d:	74 22                	je     802f61 <pageref+0x3e>
+  802f3f:	c1 e8 0c             	shr    $0xc,%eax
+  802f42:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f49:	a8 01                	test   $0x1,%al
+  802f4b:	74 14                	je     802f61 <pageref+0x3e>
+  802f4d:	c1 e8 0c             	shr    $0xc,%eax
+  802f50:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f53:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f5a:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f5e:	0f b7 d2             	movzwl %dx,%edx
+  802f61:	89 d0                	mov    %edx,%eax
+  802f63:	5d                   	pop    %ebp
+  802f64:	c3                   	ret
+
+00802f65 <__udivmoddi4>:
+  802f65:	55                   	push   %ebp
+  802f66:	57                   	push   %edi
+  802f67:	56                   	push   %esi
+  802f68:	53                   	push   %ebx
+  802f69:	83 ec 24             	sub    $0x24,%esp
+  802f6c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f70:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f74:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f78:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f7c:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f80:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f84:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f88:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f8c:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802f90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f9f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802fa6:	00 
+  802fa7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fae:	00 
+  802faf:	89 fb                	mov    %edi,%ebx
+  802fb1:	eb 08                	jmp    802fbb <__udivmoddi4+0x56>
+  802fb3:	83 e9 01             	sub    $0x1,%ecx
+  802fb6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fb9:	74 68                	je     803023 <__udivmoddi4+0xbe>
+  802fbb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fbf:	01 c0                	add    %eax,%eax
+  802fc1:	89 c6                	mov    %eax,%esi
+  802fc3:	89 d7                	mov    %edx,%edi
+  802fc5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fc9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fcd:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fd0:	d3 ea                	shr    %cl,%edx
+  802fd2:	f6 c1 20             	test   $0x20,%cl
+  802fd5:	74 04                	je     802fdb <__udivmoddi4+0x76>
+  802fd7:	89 d0                	mov    %edx,%eax
+  802fd9:	31 d2                	xor    %edx,%edx
+  802fdb:	83 e0 01             	and    $0x1,%eax
+  802fde:	89 04 24             	mov    %eax,(%esp)
+  802fe1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fe8:	00 
+  802fe9:	8b 04 24             	mov    (%esp),%eax
+  802fec:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802ff0:	09 f0                	or     %esi,%eax
+  802ff2:	09 fa                	or     %edi,%edx
+  802ff4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ff8:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802ffc:	39 f0                	cmp    %esi,%eax
+  802ffe:	89 d5                	mov    %edx,%ebp
+  803000:	19 fd                	sbb    %edi,%ebp
+  803002:	72 af                	jb     802fb3 <__udivmoddi4+0x4e>
+  803004:	29 f0                	sub    %esi,%eax
+  803006:	19 fa                	sbb    %edi,%edx
+  803008:	89 cf                	mov    %ecx,%edi
+  80300a:	c1 ef 05             	shr    $0x5,%edi
+  80300d:	83 e7 01             	and    $0x1,%edi
+  803010:	89 fe                	mov    %edi,%esi
+  803012:	83 f6 01             	xor    $0x1,%esi
+  803015:	d3 e6                	shl    %cl,%esi
+  803017:	d3 e7                	shl    %cl,%edi
+  803019:	09 74 24 18          	or     %esi,0x18(%esp)
+  80301d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803021:	eb 90                	jmp    802fb3 <__udivmoddi4+0x4e>
+  803023:	85 db                	test   %ebx,%ebx
+  803025:	74 05                	je     80302c <__udivmoddi4+0xc7>
+  803027:	89 03                	mov    %eax,(%ebx)
+  803029:	89 53 04             	mov    %edx,0x4(%ebx)
+  80302c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803030:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803034:	83 c4 24             	add    $0x24,%esp
+  803037:	5b                   	pop    %ebx
+  803038:	5e                   	pop    %esi
+  803039:	5f                   	pop    %edi
+  80303a:	5d                   	pop    %ebp
+  80303b:	c3                   	ret
+
+0080303c <__udivdi3>:
+  80303c:	83 ec 08             	sub    $0x8,%esp
+  80303f:	6a 00                	push   $0x0
+  803041:	ff 74 24 1c          	push   0x1c(%esp)
+  803045:	ff 74 24 1c          	push   0x1c(%esp)
+  803049:	ff 74 24 1c          	push   0x1c(%esp)
+  80304d:	ff 74 24 1c          	push   0x1c(%esp)
+  803051:	e8 0f ff ff ff       	call   802f65 <__udivmoddi4>
+  803056:	83 c4 1c             	add    $0x1c,%esp
+  803059:	c3                   	ret
+
+0080305a <__umoddi3>:
+  80305a:	83 ec 18             	sub    $0x18,%esp
+  80305d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803061:	50                   	push   %eax
+  803062:	ff 74 24 2c          	push   0x2c(%esp)
+  803066:	ff 74 24 2c          	push   0x2c(%esp)
+  80306a:	ff 74 24 2c          	push   0x2c(%esp)
+  80306e:	ff 74 24 2c          	push   0x2c(%esp)
+  803072:	e8 ee fe ff ff       	call   802f65 <__udivmoddi4>
+  803077:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80307b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80307f:	83 c4 2c             	add    $0x2c,%esp
+  803082:	c3                   	ret
+
+00803083 <__divdi3>:
+  803083:	53                   	push   %ebx
+  803084:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803088:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80308c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803090:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803094:	85 d2                	test   %edx,%edx
+  803096:	78 12                	js     8030aa <__divdi3+0x27>
+  803098:	85 db                	test   %ebx,%ebx
+  80309a:	78 2e                	js     8030ca <__divdi3+0x47>
+  80309c:	53                   	push   %ebx
+  80309d:	51                   	push   %ecx
+  80309e:	52                   	push   %edx
+  80309f:	50                   	push   %eax
+  8030a0:	e8 97 ff ff ff       	call   80303c <__udivdi3>
+  8030a5:	83 c4 10             	add    $0x10,%esp
+  8030a8:	eb 1e                	jmp    8030c8 <__divdi3+0x45>
+  8030aa:	f7 d8                	neg    %eax
+  8030ac:	83 d2 00             	adc    $0x0,%edx
+  8030af:	f7 da                	neg    %edx
+  8030b1:	85 db                	test   %ebx,%ebx
+  8030b3:	78 2a                	js     8030df <__divdi3+0x5c>
+  8030b5:	53                   	push   %ebx
+  8030b6:	51                   	push   %ecx
+  8030b7:	52                   	push   %edx
+  8030b8:	50                   	push   %eax
+  8030b9:	e8 7e ff ff ff       	call   80303c <__udivdi3>
+  8030be:	83 c4 10             	add    $0x10,%esp
+  8030c1:	f7 d8                	neg    %eax
+  8030c3:	83 d2 00             	adc    $0x0,%edx
+  8030c6:	f7 da                	neg    %edx
+  8030c8:	5b                   	pop    %ebx
+  8030c9:	c3                   	ret
+  8030ca:	f7 d9                	neg    %ecx
+  8030cc:	83 d3 00             	adc    $0x0,%ebx
+  8030cf:	f7 db                	neg    %ebx
+  8030d1:	53                   	push   %ebx
+  8030d2:	51                   	push   %ecx
+  8030d3:	52                   	push   %edx
+  8030d4:	50                   	push   %eax
+  8030d5:	e8 62 ff ff ff       	call   80303c <__udivdi3>
+  8030da:	83 c4 10             	add    $0x10,%esp
+  8030dd:	eb e2                	jmp    8030c1 <__divdi3+0x3e>
+  8030df:	f7 d9                	neg    %ecx
+  8030e1:	83 d3 00             	adc    $0x0,%ebx
+  8030e4:	f7 db                	neg    %ebx
+  8030e6:	53                   	push   %ebx
+  8030e7:	51                   	push   %ecx
+  8030e8:	52                   	push   %edx
+  8030e9:	50                   	push   %eax
+  8030ea:	e8 4d ff ff ff       	call   80303c <__udivdi3>
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	eb d4                	jmp    8030c8 <__divdi3+0x45>
+
+008030f4 <__moddi3>:
+  8030f4:	55                   	push   %ebp
+  8030f5:	57                   	push   %edi
+  8030f6:	56                   	push   %esi
+  8030f7:	53                   	push   %ebx
+  8030f8:	83 ec 0c             	sub    $0xc,%esp
+  8030fb:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8030ff:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803103:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803107:	89 e9                	mov    %ebp,%ecx
+  803109:	f7 d9                	neg    %ecx
+  80310b:	89 d0                	mov    %edx,%eax
+  80310d:	83 d0 00             	adc    $0x0,%eax
+  803110:	f7 d8                	neg    %eax
+  803112:	0f 49 e9             	cmovns %ecx,%ebp
+  803115:	0f 49 d0             	cmovns %eax,%edx
+  803118:	52                   	push   %edx
+  803119:	55                   	push   %ebp
+  80311a:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80311e:	f7 da                	neg    %edx
+  803120:	89 d8                	mov    %ebx,%eax
+  803122:	83 d0 00             	adc    $0x0,%eax
+  803125:	f7 d8                	neg    %eax
+  803127:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80312c:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803130:	0f 48 c3             	cmovs  %ebx,%eax
+  803133:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803137:	ff 74 24 0c          	push   0xc(%esp)
+  80313b:	ff 74 24 0c          	push   0xc(%esp)
+  80313f:	e8 16 ff ff ff       	call   80305a <__umoddi3>
+  803144:	83 c4 10             	add    $0x10,%esp
+  803147:	85 db                	test   %ebx,%ebx
+  803149:	78 08                	js     803153 <__moddi3+0x5f>
+  80314b:	83 c4 0c             	add    $0xc,%esp
+  80314e:	5b                   	pop    %ebx
+  80314f:	5e                   	pop    %esi
+  803150:	5f                   	pop    %edi
+  803151:	5d                   	pop    %ebp
+  803152:	c3                   	ret
+  803153:	f7 d8                	neg    %eax
+  803155:	83 d2 00             	adc    $0x0,%edx
+  803158:	f7 da                	neg    %edx
+  80315a:	eb ef                	jmp    80314b <__moddi3+0x57>
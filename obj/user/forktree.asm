@@ -0,0 +1,5564 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	e8 9c 0c 00 00       	call   800cde <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 e0 37 80 00       	push   $0x8037e0
+  80004c:	e8 a0 01 00 00       	call   8001f1 <cprintf>
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80007d:	53                   	push   %ebx
+  80007e:	e8 19 08 00 00       	call   80089c <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 f1 37 80 00       	push   $0x8037f1
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 d6 07 00 00       	call   800882 <snprintf>
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 30 17 00 00       	call   8017e4 <sfork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+  8000c4:	e8 63 00 00 00       	call   80012c <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+  8000d4:	68 f0 37 80 00       	push   $0x8037f0
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ee:	e8 eb 0b 00 00       	call   800cde <sys_getenvid>
+  8000f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800103:	a3 14 50 80 00       	mov    %eax,0x805014
+  800108:	85 db                	test   %ebx,%ebx
+  80010a:	7e 07                	jle    800113 <libmain+0x30>
+  80010c:	8b 06                	mov    (%esi),%eax
+  80010e:	a3 00 40 80 00       	mov    %eax,0x804000
+  800113:	83 ec 08             	sub    $0x8,%esp
+  800116:	56                   	push   %esi
+  800117:	53                   	push   %ebx
+  800118:	e8 b1 ff ff ff       	call   8000ce <umain>
+  80011d:	e8 0a 00 00 00       	call   80012c <exit>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800128:	5b                   	pop    %ebx
+  800129:	5e                   	pop    %esi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+
+0080012c <exit>:
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	83 ec 08             	sub    $0x8,%esp
+  800132:	a1 14 50 80 00       	mov    0x805014,%eax
+  800137:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80013d:	85 c0                	test   %eax,%eax
+  80013f:	75 14                	jne    800155 <exit+0x29>
+  800141:	e8 6b 1b 00 00       	call   801cb1 <close_all>
+  800146:	83 ec 0c             	sub    $0xc,%esp
+  800149:	6a 00                	push   $0x0
+  80014b:	e8 4d 0b 00 00       	call   800c9d <sys_env_destroy>
+  800150:	83 c4 10             	add    $0x10,%esp
+  800153:	c9                   	leave
+  800154:	c3                   	ret
+  800155:	e8 b0 12 00 00       	call   80140a <sys_lease_complete>
+  80015a:	eb e5                	jmp    800141 <exit+0x15>
+
+0080015c <putch>:
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	53                   	push   %ebx
+  800160:	83 ec 04             	sub    $0x4,%esp
+  800163:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800166:	8b 13                	mov    (%ebx),%edx
+  800168:	8d 42 01             	lea    0x1(%edx),%eax
+  80016b:	89 03                	mov    %eax,(%ebx)
+  80016d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800170:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800174:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800179:	74 09                	je     800184 <putch+0x28>
+  80017b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80017f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800182:	c9                   	leave
+  800183:	c3                   	ret
+  800184:	83 ec 08             	sub    $0x8,%esp
+  800187:	68 ff 00 00 00       	push   $0xff
+  80018c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80018f:	50                   	push   %eax
+  800190:	e8 cb 0a 00 00       	call   800c60 <sys_cputs>
+  800195:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019b:	83 c4 10             	add    $0x10,%esp
+  80019e:	eb db                	jmp    80017b <putch+0x1f>
+
+008001a0 <vcprintf>:
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001a9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b0:	00 00 00 
+  8001b3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ba:	00 00 00 
+  8001bd:	ff 75 0c             	push   0xc(%ebp)
+  8001c0:	ff 75 08             	push   0x8(%ebp)
+  8001c3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001c9:	50                   	push   %eax
+  8001ca:	68 5c 01 80 00       	push   $0x80015c
+  8001cf:	e8 1c 01 00 00       	call   8002f0 <vprintfmt>
+  8001d4:	83 c4 08             	add    $0x8,%esp
+  8001d7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001dd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e3:	50                   	push   %eax
+  8001e4:	e8 77 0a 00 00       	call   800c60 <sys_cputs>
+  8001e9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ef:	c9                   	leave
+  8001f0:	c3                   	ret
+
+008001f1 <cprintf>:
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	83 ec 10             	sub    $0x10,%esp
+  8001f7:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001fa:	50                   	push   %eax
+  8001fb:	ff 75 08             	push   0x8(%ebp)
+  8001fe:	e8 9d ff ff ff       	call   8001a0 <vcprintf>
+  800203:	c9                   	leave
+  800204:	c3                   	ret
+
+00800205 <printnum>:
+  800205:	55                   	push   %ebp
+  800206:	89 e5                	mov    %esp,%ebp
+  800208:	57                   	push   %edi
+  800209:	56                   	push   %esi
+  80020a:	53                   	push   %ebx
+  80020b:	83 ec 1c             	sub    $0x1c,%esp
+  80020e:	89 c3                	mov    %eax,%ebx
+  800210:	89 d6                	mov    %edx,%esi
+  800212:	8b 45 08             	mov    0x8(%ebp),%eax
+  800215:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800218:	89 d1                	mov    %edx,%ecx
+  80021a:	89 c2                	mov    %eax,%edx
+  80021c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80021f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800222:	8b 45 10             	mov    0x10(%ebp),%eax
+  800225:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800228:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80022f:	39 c2                	cmp    %eax,%edx
+  800231:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800234:	73 4b                	jae    800281 <printnum+0x7c>
+  800236:	8b 45 14             	mov    0x14(%ebp),%eax
+  800239:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80023c:	85 ff                	test   %edi,%edi
+  80023e:	7e 11                	jle    800251 <printnum+0x4c>
+  800240:	83 ec 08             	sub    $0x8,%esp
+  800243:	56                   	push   %esi
+  800244:	ff 75 18             	push   0x18(%ebp)
+  800247:	ff d3                	call   *%ebx
+  800249:	83 c4 10             	add    $0x10,%esp
+  80024c:	83 ef 01             	sub    $0x1,%edi
+  80024f:	75 ef                	jne    800240 <printnum+0x3b>
+  800251:	83 ec 08             	sub    $0x8,%esp
+  800254:	56                   	push   %esi
+  800255:	83 ec 04             	sub    $0x4,%esp
+  800258:	ff 75 e4             	push   -0x1c(%ebp)
+  80025b:	ff 75 e0             	push   -0x20(%ebp)
+  80025e:	ff 75 dc             	push   -0x24(%ebp)
+  800261:	ff 75 d8             	push   -0x28(%ebp)
+  800264:	e8 6a 34 00 00       	call   8036d3 <__umoddi3>
+  800269:	83 c4 14             	add    $0x14,%esp
+  80026c:	0f be 80 00 38 80 00 	movsbl 0x803800(%eax),%eax
+  800273:	50                   	push   %eax
+  800274:	ff d3                	call   *%ebx
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027c:	5b                   	pop    %ebx
+  80027d:	5e                   	pop    %esi
+  80027e:	5f                   	pop    %edi
+  80027f:	5d                   	pop    %ebp
+  800280:	c3                   	ret
+  800281:	83 ec 0c             	sub    $0xc,%esp
+  800284:	ff 75 18             	push   0x18(%ebp)
+  800287:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80028a:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80028d:	52                   	push   %edx
+  80028e:	50                   	push   %eax
+  80028f:	83 ec 08             	sub    $0x8,%esp
+  800292:	ff 75 e4             	push   -0x1c(%ebp)
+  800295:	ff 75 e0             	push   -0x20(%ebp)
+  800298:	ff 75 dc             	push   -0x24(%ebp)
+  80029b:	ff 75 d8             	push   -0x28(%ebp)
+  80029e:	e8 12 34 00 00       	call   8036b5 <__udivdi3>
+  8002a3:	83 c4 18             	add    $0x18,%esp
+  8002a6:	52                   	push   %edx
+  8002a7:	50                   	push   %eax
+  8002a8:	89 f2                	mov    %esi,%edx
+  8002aa:	89 d8                	mov    %ebx,%eax
+  8002ac:	e8 54 ff ff ff       	call   800205 <printnum>
+  8002b1:	83 c4 20             	add    $0x20,%esp
+  8002b4:	eb 9b                	jmp    800251 <printnum+0x4c>
+
+008002b6 <sprintputch>:
+  8002b6:	55                   	push   %ebp
+  8002b7:	89 e5                	mov    %esp,%ebp
+  8002b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002bc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002c0:	8b 10                	mov    (%eax),%edx
+  8002c2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c5:	73 0a                	jae    8002d1 <sprintputch+0x1b>
+  8002c7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ca:	89 08                	mov    %ecx,(%eax)
+  8002cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002cf:	88 02                	mov    %al,(%edx)
+  8002d1:	5d                   	pop    %ebp
+  8002d2:	c3                   	ret
+
+008002d3 <printfmt>:
+  8002d3:	55                   	push   %ebp
+  8002d4:	89 e5                	mov    %esp,%ebp
+  8002d6:	83 ec 08             	sub    $0x8,%esp
+  8002d9:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002dc:	50                   	push   %eax
+  8002dd:	ff 75 10             	push   0x10(%ebp)
+  8002e0:	ff 75 0c             	push   0xc(%ebp)
+  8002e3:	ff 75 08             	push   0x8(%ebp)
+  8002e6:	e8 05 00 00 00       	call   8002f0 <vprintfmt>
+  8002eb:	83 c4 10             	add    $0x10,%esp
+  8002ee:	c9                   	leave
+  8002ef:	c3                   	ret
+
+008002f0 <vprintfmt>:
+  8002f0:	55                   	push   %ebp
+  8002f1:	89 e5                	mov    %esp,%ebp
+  8002f3:	57                   	push   %edi
+  8002f4:	56                   	push   %esi
+  8002f5:	53                   	push   %ebx
+  8002f6:	83 ec 2c             	sub    $0x2c,%esp
+  8002f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002fc:	89 df                	mov    %ebx,%edi
+  8002fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800301:	8b 45 10             	mov    0x10(%ebp),%eax
+  800304:	8d 70 01             	lea    0x1(%eax),%esi
+  800307:	0f b6 00             	movzbl (%eax),%eax
+  80030a:	83 f8 25             	cmp    $0x25,%eax
+  80030d:	74 1e                	je     80032d <vprintfmt+0x3d>
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	0f 84 15 05 00 00    	je     80082c <vprintfmt+0x53c>
+  800317:	83 ec 08             	sub    $0x8,%esp
+  80031a:	53                   	push   %ebx
+  80031b:	50                   	push   %eax
+  80031c:	ff d7                	call   *%edi
+  80031e:	83 c6 01             	add    $0x1,%esi
+  800321:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800325:	83 c4 10             	add    $0x10,%esp
+  800328:	83 f8 25             	cmp    $0x25,%eax
+  80032b:	75 e2                	jne    80030f <vprintfmt+0x1f>
+  80032d:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800331:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800338:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80033f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800346:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80034b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80034e:	8d 56 01             	lea    0x1(%esi),%edx
+  800351:	0f b6 0e             	movzbl (%esi),%ecx
+  800354:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800357:	3c 55                	cmp    $0x55,%al
+  800359:	0f 87 3b 04 00 00    	ja     80079a <vprintfmt+0x4aa>
+  80035f:	0f b6 c0             	movzbl %al,%eax
+  800362:	ff 24 85 40 39 80 00 	jmp    *0x803940(,%eax,4)
+  800369:	89 75 10             	mov    %esi,0x10(%ebp)
+  80036c:	eb 93                	jmp    800301 <vprintfmt+0x11>
+  80036e:	89 d6                	mov    %edx,%esi
+  800370:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800374:	eb d8                	jmp    80034e <vprintfmt+0x5e>
+  800376:	89 d6                	mov    %edx,%esi
+  800378:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80037c:	eb d0                	jmp    80034e <vprintfmt+0x5e>
+  80037e:	0f b6 c9             	movzbl %cl,%ecx
+  800381:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800384:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800387:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80038b:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80038e:	83 f9 09             	cmp    $0x9,%ecx
+  800391:	77 6f                	ja     800402 <vprintfmt+0x112>
+  800393:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800396:	83 c2 01             	add    $0x1,%edx
+  800399:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80039c:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003a0:	0f be 02             	movsbl (%edx),%eax
+  8003a3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003a6:	83 fe 09             	cmp    $0x9,%esi
+  8003a9:	76 eb                	jbe    800396 <vprintfmt+0xa6>
+  8003ab:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8003ae:	89 d6                	mov    %edx,%esi
+  8003b0:	eb 13                	jmp    8003c5 <vprintfmt+0xd5>
+  8003b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b5:	8b 00                	mov    (%eax),%eax
+  8003b7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003c3:	89 d6                	mov    %edx,%esi
+  8003c5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003c9:	79 83                	jns    80034e <vprintfmt+0x5e>
+  8003cb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003d1:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003d8:	e9 71 ff ff ff       	jmp    80034e <vprintfmt+0x5e>
+  8003dd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e0:	85 c9                	test   %ecx,%ecx
+  8003e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e7:	0f 49 c1             	cmovns %ecx,%eax
+  8003ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ed:	89 d6                	mov    %edx,%esi
+  8003ef:	e9 5a ff ff ff       	jmp    80034e <vprintfmt+0x5e>
+  8003f4:	89 d6                	mov    %edx,%esi
+  8003f6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003fd:	e9 4c ff ff ff       	jmp    80034e <vprintfmt+0x5e>
+  800402:	89 d6                	mov    %edx,%esi
+  800404:	eb bf                	jmp    8003c5 <vprintfmt+0xd5>
+  800406:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80040a:	89 d6                	mov    %edx,%esi
+  80040c:	e9 3d ff ff ff       	jmp    80034e <vprintfmt+0x5e>
+  800411:	89 55 10             	mov    %edx,0x10(%ebp)
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8d 70 04             	lea    0x4(%eax),%esi
+  80041a:	83 ec 08             	sub    $0x8,%esp
+  80041d:	53                   	push   %ebx
+  80041e:	ff 30                	push   (%eax)
+  800420:	ff d7                	call   *%edi
+  800422:	83 c4 10             	add    $0x10,%esp
+  800425:	89 75 14             	mov    %esi,0x14(%ebp)
+  800428:	e9 d4 fe ff ff       	jmp    800301 <vprintfmt+0x11>
+  80042d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800430:	8b 45 14             	mov    0x14(%ebp),%eax
+  800433:	8d 70 04             	lea    0x4(%eax),%esi
+  800436:	8b 10                	mov    (%eax),%edx
+  800438:	89 d0                	mov    %edx,%eax
+  80043a:	f7 d8                	neg    %eax
+  80043c:	0f 48 c2             	cmovs  %edx,%eax
+  80043f:	83 f8 12             	cmp    $0x12,%eax
+  800442:	7f 23                	jg     800467 <vprintfmt+0x177>
+  800444:	8b 14 85 a0 3a 80 00 	mov    0x803aa0(,%eax,4),%edx
+  80044b:	85 d2                	test   %edx,%edx
+  80044d:	74 18                	je     800467 <vprintfmt+0x177>
+  80044f:	52                   	push   %edx
+  800450:	68 e3 3c 80 00       	push   $0x803ce3
+  800455:	53                   	push   %ebx
+  800456:	57                   	push   %edi
+  800457:	e8 77 fe ff ff       	call   8002d3 <printfmt>
+  80045c:	83 c4 10             	add    $0x10,%esp
+  80045f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800462:	e9 9a fe ff ff       	jmp    800301 <vprintfmt+0x11>
+  800467:	50                   	push   %eax
+  800468:	68 18 38 80 00       	push   $0x803818
+  80046d:	53                   	push   %ebx
+  80046e:	57                   	push   %edi
+  80046f:	e8 5f fe ff ff       	call   8002d3 <printfmt>
+  800474:	83 c4 10             	add    $0x10,%esp
+  800477:	89 75 14             	mov    %esi,0x14(%ebp)
+  80047a:	e9 82 fe ff ff       	jmp    800301 <vprintfmt+0x11>
+  80047f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800482:	8b 45 14             	mov    0x14(%ebp),%eax
+  800485:	83 c0 04             	add    $0x4,%eax
+  800488:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80048b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048e:	8b 00                	mov    (%eax),%eax
+  800490:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800493:	85 c0                	test   %eax,%eax
+  800495:	0f 84 61 03 00 00    	je     8007fc <vprintfmt+0x50c>
+  80049b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80049f:	7e 06                	jle    8004a7 <vprintfmt+0x1b7>
+  8004a1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004a5:	75 29                	jne    8004d0 <vprintfmt+0x1e0>
+  8004a7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004aa:	8d 70 01             	lea    0x1(%eax),%esi
+  8004ad:	0f b6 00             	movzbl (%eax),%eax
+  8004b0:	0f be d0             	movsbl %al,%edx
+  8004b3:	85 d2                	test   %edx,%edx
+  8004b5:	0f 84 bb 00 00 00    	je     800576 <vprintfmt+0x286>
+  8004bb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004be:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004c1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004c4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004c7:	eb 7a                	jmp    800543 <vprintfmt+0x253>
+  8004c9:	c7 45 d0 11 38 80 00 	movl   $0x803811,-0x30(%ebp)
+  8004d0:	83 ec 08             	sub    $0x8,%esp
+  8004d3:	ff 75 d4             	push   -0x2c(%ebp)
+  8004d6:	ff 75 d0             	push   -0x30(%ebp)
+  8004d9:	e8 e0 03 00 00       	call   8008be <strnlen>
+  8004de:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004e4:	83 c4 10             	add    $0x10,%esp
+  8004e7:	85 d2                	test   %edx,%edx
+  8004e9:	0f 8e d6 02 00 00    	jle    8007c5 <vprintfmt+0x4d5>
+  8004ef:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004f3:	83 ec 08             	sub    $0x8,%esp
+  8004f6:	53                   	push   %ebx
+  8004f7:	56                   	push   %esi
+  8004f8:	ff d7                	call   *%edi
+  8004fa:	83 c4 10             	add    $0x10,%esp
+  8004fd:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800501:	75 f0                	jne    8004f3 <vprintfmt+0x203>
+  800503:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800506:	8d 70 01             	lea    0x1(%eax),%esi
+  800509:	0f b6 00             	movzbl (%eax),%eax
+  80050c:	0f be d0             	movsbl %al,%edx
+  80050f:	85 d2                	test   %edx,%edx
+  800511:	0f 84 da 02 00 00    	je     8007f1 <vprintfmt+0x501>
+  800517:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80051a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80051d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800520:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800523:	eb 1e                	jmp    800543 <vprintfmt+0x253>
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	ff 75 0c             	push   0xc(%ebp)
+  80052b:	52                   	push   %edx
+  80052c:	ff 55 08             	call   *0x8(%ebp)
+  80052f:	83 c4 10             	add    $0x10,%esp
+  800532:	83 eb 01             	sub    $0x1,%ebx
+  800535:	83 c6 01             	add    $0x1,%esi
+  800538:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80053c:	0f be d0             	movsbl %al,%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	74 2a                	je     80056d <vprintfmt+0x27d>
+  800543:	85 ff                	test   %edi,%edi
+  800545:	78 05                	js     80054c <vprintfmt+0x25c>
+  800547:	83 ef 01             	sub    $0x1,%edi
+  80054a:	78 59                	js     8005a5 <vprintfmt+0x2b5>
+  80054c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800550:	74 d3                	je     800525 <vprintfmt+0x235>
+  800552:	0f be c0             	movsbl %al,%eax
+  800555:	83 e8 20             	sub    $0x20,%eax
+  800558:	83 f8 5e             	cmp    $0x5e,%eax
+  80055b:	76 c8                	jbe    800525 <vprintfmt+0x235>
+  80055d:	83 ec 08             	sub    $0x8,%esp
+  800560:	ff 75 0c             	push   0xc(%ebp)
+  800563:	6a 3f                	push   $0x3f
+  800565:	ff 55 08             	call   *0x8(%ebp)
+  800568:	83 c4 10             	add    $0x10,%esp
+  80056b:	eb c5                	jmp    800532 <vprintfmt+0x242>
+  80056d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800570:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800573:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800576:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800579:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80057d:	7e 1b                	jle    80059a <vprintfmt+0x2aa>
+  80057f:	83 ec 08             	sub    $0x8,%esp
+  800582:	53                   	push   %ebx
+  800583:	6a 20                	push   $0x20
+  800585:	ff d7                	call   *%edi
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	83 ee 01             	sub    $0x1,%esi
+  80058d:	75 f0                	jne    80057f <vprintfmt+0x28f>
+  80058f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800592:	89 45 14             	mov    %eax,0x14(%ebp)
+  800595:	e9 67 fd ff ff       	jmp    800301 <vprintfmt+0x11>
+  80059a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80059d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a0:	e9 5c fd ff ff       	jmp    800301 <vprintfmt+0x11>
+  8005a5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005ae:	eb c6                	jmp    800576 <vprintfmt+0x286>
+  8005b0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005b3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005b6:	83 f9 01             	cmp    $0x1,%ecx
+  8005b9:	7f 1f                	jg     8005da <vprintfmt+0x2ea>
+  8005bb:	85 c9                	test   %ecx,%ecx
+  8005bd:	74 67                	je     800626 <vprintfmt+0x336>
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8b 30                	mov    (%eax),%esi
+  8005c4:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005c7:	89 f0                	mov    %esi,%eax
+  8005c9:	c1 f8 1f             	sar    $0x1f,%eax
+  8005cc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d8:	eb 17                	jmp    8005f1 <vprintfmt+0x301>
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 50 04             	mov    0x4(%eax),%edx
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005fc:	85 c9                	test   %ecx,%ecx
+  8005fe:	0f 89 12 01 00 00    	jns    800716 <vprintfmt+0x426>
+  800604:	83 ec 08             	sub    $0x8,%esp
+  800607:	53                   	push   %ebx
+  800608:	6a 2d                	push   $0x2d
+  80060a:	ff d7                	call   *%edi
+  80060c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800612:	f7 da                	neg    %edx
+  800614:	83 d1 00             	adc    $0x0,%ecx
+  800617:	f7 d9                	neg    %ecx
+  800619:	83 c4 10             	add    $0x10,%esp
+  80061c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800621:	e9 f0 00 00 00       	jmp    800716 <vprintfmt+0x426>
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8b 30                	mov    (%eax),%esi
+  80062b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80062e:	89 f0                	mov    %esi,%eax
+  800630:	c1 f8 1f             	sar    $0x1f,%eax
+  800633:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8d 40 04             	lea    0x4(%eax),%eax
+  80063c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063f:	eb b0                	jmp    8005f1 <vprintfmt+0x301>
+  800641:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800644:	89 55 10             	mov    %edx,0x10(%ebp)
+  800647:	83 f9 01             	cmp    $0x1,%ecx
+  80064a:	7f 1e                	jg     80066a <vprintfmt+0x37a>
+  80064c:	85 c9                	test   %ecx,%ecx
+  80064e:	74 32                	je     800682 <vprintfmt+0x392>
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 10                	mov    (%eax),%edx
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800660:	be 0a 00 00 00       	mov    $0xa,%esi
+  800665:	e9 ac 00 00 00       	jmp    800716 <vprintfmt+0x426>
+  80066a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066d:	8b 10                	mov    (%eax),%edx
+  80066f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800672:	8d 40 08             	lea    0x8(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+  800678:	be 0a 00 00 00       	mov    $0xa,%esi
+  80067d:	e9 94 00 00 00       	jmp    800716 <vprintfmt+0x426>
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 10                	mov    (%eax),%edx
+  800687:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068c:	8d 40 04             	lea    0x4(%eax),%eax
+  80068f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800692:	be 0a 00 00 00       	mov    $0xa,%esi
+  800697:	eb 7d                	jmp    800716 <vprintfmt+0x426>
+  800699:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80069c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80069f:	83 f9 01             	cmp    $0x1,%ecx
+  8006a2:	7f 1b                	jg     8006bf <vprintfmt+0x3cf>
+  8006a4:	85 c9                	test   %ecx,%ecx
+  8006a6:	74 2c                	je     8006d4 <vprintfmt+0x3e4>
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8b 10                	mov    (%eax),%edx
+  8006ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b8:	be 08 00 00 00       	mov    $0x8,%esi
+  8006bd:	eb 57                	jmp    800716 <vprintfmt+0x426>
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ca:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cd:	be 08 00 00 00       	mov    $0x8,%esi
+  8006d2:	eb 42                	jmp    800716 <vprintfmt+0x426>
+  8006d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d7:	8b 10                	mov    (%eax),%edx
+  8006d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e4:	be 08 00 00 00       	mov    $0x8,%esi
+  8006e9:	eb 2b                	jmp    800716 <vprintfmt+0x426>
+  8006eb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ee:	83 ec 08             	sub    $0x8,%esp
+  8006f1:	53                   	push   %ebx
+  8006f2:	6a 30                	push   $0x30
+  8006f4:	ff d7                	call   *%edi
+  8006f6:	83 c4 08             	add    $0x8,%esp
+  8006f9:	53                   	push   %ebx
+  8006fa:	6a 78                	push   $0x78
+  8006fc:	ff d7                	call   *%edi
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800708:	83 c4 10             	add    $0x10,%esp
+  80070b:	8d 40 04             	lea    0x4(%eax),%eax
+  80070e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800711:	be 10 00 00 00       	mov    $0x10,%esi
+  800716:	83 ec 0c             	sub    $0xc,%esp
+  800719:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80071d:	50                   	push   %eax
+  80071e:	ff 75 e4             	push   -0x1c(%ebp)
+  800721:	56                   	push   %esi
+  800722:	51                   	push   %ecx
+  800723:	52                   	push   %edx
+  800724:	89 da                	mov    %ebx,%edx
+  800726:	89 f8                	mov    %edi,%eax
+  800728:	e8 d8 fa ff ff       	call   800205 <printnum>
+  80072d:	83 c4 20             	add    $0x20,%esp
+  800730:	e9 cc fb ff ff       	jmp    800301 <vprintfmt+0x11>
+  800735:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800738:	89 55 10             	mov    %edx,0x10(%ebp)
+  80073b:	83 f9 01             	cmp    $0x1,%ecx
+  80073e:	7f 1b                	jg     80075b <vprintfmt+0x46b>
+  800740:	85 c9                	test   %ecx,%ecx
+  800742:	74 2c                	je     800770 <vprintfmt+0x480>
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8b 10                	mov    (%eax),%edx
+  800749:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074e:	8d 40 04             	lea    0x4(%eax),%eax
+  800751:	89 45 14             	mov    %eax,0x14(%ebp)
+  800754:	be 10 00 00 00       	mov    $0x10,%esi
+  800759:	eb bb                	jmp    800716 <vprintfmt+0x426>
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8b 10                	mov    (%eax),%edx
+  800760:	8b 48 04             	mov    0x4(%eax),%ecx
+  800763:	8d 40 08             	lea    0x8(%eax),%eax
+  800766:	89 45 14             	mov    %eax,0x14(%ebp)
+  800769:	be 10 00 00 00       	mov    $0x10,%esi
+  80076e:	eb a6                	jmp    800716 <vprintfmt+0x426>
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8b 10                	mov    (%eax),%edx
+  800775:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077a:	8d 40 04             	lea    0x4(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800780:	be 10 00 00 00       	mov    $0x10,%esi
+  800785:	eb 8f                	jmp    800716 <vprintfmt+0x426>
+  800787:	89 55 10             	mov    %edx,0x10(%ebp)
+  80078a:	83 ec 08             	sub    $0x8,%esp
+  80078d:	53                   	push   %ebx
+  80078e:	6a 25                	push   $0x25
+  800790:	ff d7                	call   *%edi
+  800792:	83 c4 10             	add    $0x10,%esp
+  800795:	e9 67 fb ff ff       	jmp    800301 <vprintfmt+0x11>
+  80079a:	83 ec 08             	sub    $0x8,%esp
+  80079d:	53                   	push   %ebx
+  80079e:	6a 25                	push   $0x25
+  8007a0:	ff d7                	call   *%edi
+  8007a2:	83 c4 10             	add    $0x10,%esp
+  8007a5:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007a9:	0f 84 ba fb ff ff    	je     800369 <vprintfmt+0x79>
+  8007af:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007b2:	89 f0                	mov    %esi,%eax
+  8007b4:	83 e8 01             	sub    $0x1,%eax
+  8007b7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007bb:	75 f7                	jne    8007b4 <vprintfmt+0x4c4>
+  8007bd:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007c0:	e9 3c fb ff ff       	jmp    800301 <vprintfmt+0x11>
+  8007c5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007c8:	8d 70 01             	lea    0x1(%eax),%esi
+  8007cb:	0f b6 00             	movzbl (%eax),%eax
+  8007ce:	0f be d0             	movsbl %al,%edx
+  8007d1:	85 d2                	test   %edx,%edx
+  8007d3:	74 11                	je     8007e6 <vprintfmt+0x4f6>
+  8007d5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007d8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007db:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007de:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007e1:	e9 5d fd ff ff       	jmp    800543 <vprintfmt+0x253>
+  8007e6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ec:	e9 10 fb ff ff       	jmp    800301 <vprintfmt+0x11>
+  8007f1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f7:	e9 05 fb ff ff       	jmp    800301 <vprintfmt+0x11>
+  8007fc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800800:	7e 0a                	jle    80080c <vprintfmt+0x51c>
+  800802:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800806:	0f 85 bd fc ff ff    	jne    8004c9 <vprintfmt+0x1d9>
+  80080c:	ba 28 00 00 00       	mov    $0x28,%edx
+  800811:	b8 28 00 00 00       	mov    $0x28,%eax
+  800816:	be 12 38 80 00       	mov    $0x803812,%esi
+  80081b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80081e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800821:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800824:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800827:	e9 17 fd ff ff       	jmp    800543 <vprintfmt+0x253>
+  80082c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80082f:	5b                   	pop    %ebx
+  800830:	5e                   	pop    %esi
+  800831:	5f                   	pop    %edi
+  800832:	5d                   	pop    %ebp
+  800833:	c3                   	ret
+
+00800834 <vsnprintf>:
+  800834:	55                   	push   %ebp
+  800835:	89 e5                	mov    %esp,%ebp
+  800837:	83 ec 18             	sub    $0x18,%esp
+  80083a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80083d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800840:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800843:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800847:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80084a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800851:	85 c0                	test   %eax,%eax
+  800853:	74 26                	je     80087b <vsnprintf+0x47>
+  800855:	85 d2                	test   %edx,%edx
+  800857:	7e 22                	jle    80087b <vsnprintf+0x47>
+  800859:	ff 75 14             	push   0x14(%ebp)
+  80085c:	ff 75 10             	push   0x10(%ebp)
+  80085f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800862:	50                   	push   %eax
+  800863:	68 b6 02 80 00       	push   $0x8002b6
+  800868:	e8 83 fa ff ff       	call   8002f0 <vprintfmt>
+  80086d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800870:	c6 00 00             	movb   $0x0,(%eax)
+  800873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800876:	83 c4 10             	add    $0x10,%esp
+  800879:	c9                   	leave
+  80087a:	c3                   	ret
+  80087b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800880:	eb f7                	jmp    800879 <vsnprintf+0x45>
+
+00800882 <snprintf>:
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	83 ec 08             	sub    $0x8,%esp
+  800888:	8d 45 14             	lea    0x14(%ebp),%eax
+  80088b:	50                   	push   %eax
+  80088c:	ff 75 10             	push   0x10(%ebp)
+  80088f:	ff 75 0c             	push   0xc(%ebp)
+  800892:	ff 75 08             	push   0x8(%ebp)
+  800895:	e8 9a ff ff ff       	call   800834 <vsnprintf>
+  80089a:	c9                   	leave
+  80089b:	c3                   	ret
+
+0080089c <strlen>:
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008a2:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008a5:	74 10                	je     8008b7 <strlen+0x1b>
+  8008a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ac:	83 c0 01             	add    $0x1,%eax
+  8008af:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008b3:	75 f7                	jne    8008ac <strlen+0x10>
+  8008b5:	5d                   	pop    %ebp
+  8008b6:	c3                   	ret
+  8008b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bc:	eb f7                	jmp    8008b5 <strlen+0x19>
+
+008008be <strnlen>:
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008c7:	85 d2                	test   %edx,%edx
+  8008c9:	74 16                	je     8008e1 <strnlen+0x23>
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008d4:	74 09                	je     8008df <strnlen+0x21>
+  8008d6:	83 c0 01             	add    $0x1,%eax
+  8008d9:	39 d0                	cmp    %edx,%eax
+  8008db:	75 f3                	jne    8008d0 <strnlen+0x12>
+  8008dd:	89 d0                	mov    %edx,%eax
+  8008df:	5d                   	pop    %ebp
+  8008e0:	c3                   	ret
+  8008e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e6:	eb f7                	jmp    8008df <strnlen+0x21>
+
+008008e8 <strcpy>:
+  8008e8:	55                   	push   %ebp
+  8008e9:	89 e5                	mov    %esp,%ebp
+  8008eb:	53                   	push   %ebx
+  8008ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008fb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008fe:	83 c0 01             	add    $0x1,%eax
+  800901:	84 d2                	test   %dl,%dl
+  800903:	75 f2                	jne    8008f7 <strcpy+0xf>
+  800905:	89 c8                	mov    %ecx,%eax
+  800907:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090a:	c9                   	leave
+  80090b:	c3                   	ret
+
+0080090c <strcat>:
+  80090c:	55                   	push   %ebp
+  80090d:	89 e5                	mov    %esp,%ebp
+  80090f:	53                   	push   %ebx
+  800910:	83 ec 10             	sub    $0x10,%esp
+  800913:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800916:	53                   	push   %ebx
+  800917:	e8 80 ff ff ff       	call   80089c <strlen>
+  80091c:	83 c4 08             	add    $0x8,%esp
+  80091f:	ff 75 0c             	push   0xc(%ebp)
+  800922:	01 d8                	add    %ebx,%eax
+  800924:	50                   	push   %eax
+  800925:	e8 be ff ff ff       	call   8008e8 <strcpy>
+  80092a:	89 d8                	mov    %ebx,%eax
+  80092c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092f:	c9                   	leave
+  800930:	c3                   	ret
+
+00800931 <strncpy>:
+  800931:	55                   	push   %ebp
+  800932:	89 e5                	mov    %esp,%ebp
+  800934:	56                   	push   %esi
+  800935:	53                   	push   %ebx
+  800936:	8b 75 08             	mov    0x8(%ebp),%esi
+  800939:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80093c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80093f:	85 db                	test   %ebx,%ebx
+  800941:	74 17                	je     80095a <strncpy+0x29>
+  800943:	01 f3                	add    %esi,%ebx
+  800945:	89 f0                	mov    %esi,%eax
+  800947:	83 c0 01             	add    $0x1,%eax
+  80094a:	0f b6 0a             	movzbl (%edx),%ecx
+  80094d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800950:	80 f9 01             	cmp    $0x1,%cl
+  800953:	83 da ff             	sbb    $0xffffffff,%edx
+  800956:	39 c3                	cmp    %eax,%ebx
+  800958:	75 ed                	jne    800947 <strncpy+0x16>
+  80095a:	89 f0                	mov    %esi,%eax
+  80095c:	5b                   	pop    %ebx
+  80095d:	5e                   	pop    %esi
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <strlcpy>:
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	56                   	push   %esi
+  800964:	53                   	push   %ebx
+  800965:	8b 75 08             	mov    0x8(%ebp),%esi
+  800968:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80096b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80096e:	89 f0                	mov    %esi,%eax
+  800970:	85 db                	test   %ebx,%ebx
+  800972:	74 1e                	je     800992 <strlcpy+0x32>
+  800974:	83 eb 01             	sub    $0x1,%ebx
+  800977:	74 16                	je     80098f <strlcpy+0x2f>
+  800979:	01 f3                	add    %esi,%ebx
+  80097b:	0f b6 0a             	movzbl (%edx),%ecx
+  80097e:	84 c9                	test   %cl,%cl
+  800980:	74 0d                	je     80098f <strlcpy+0x2f>
+  800982:	83 c2 01             	add    $0x1,%edx
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80098b:	39 d8                	cmp    %ebx,%eax
+  80098d:	75 ec                	jne    80097b <strlcpy+0x1b>
+  80098f:	c6 00 00             	movb   $0x0,(%eax)
+  800992:	29 f0                	sub    %esi,%eax
+  800994:	5b                   	pop    %ebx
+  800995:	5e                   	pop    %esi
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <strcmp>:
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80099e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009a1:	0f b6 01             	movzbl (%ecx),%eax
+  8009a4:	84 c0                	test   %al,%al
+  8009a6:	74 11                	je     8009b9 <strcmp+0x21>
+  8009a8:	38 02                	cmp    %al,(%edx)
+  8009aa:	75 0d                	jne    8009b9 <strcmp+0x21>
+  8009ac:	83 c1 01             	add    $0x1,%ecx
+  8009af:	83 c2 01             	add    $0x1,%edx
+  8009b2:	0f b6 01             	movzbl (%ecx),%eax
+  8009b5:	84 c0                	test   %al,%al
+  8009b7:	75 ef                	jne    8009a8 <strcmp+0x10>
+  8009b9:	0f b6 c0             	movzbl %al,%eax
+  8009bc:	0f b6 12             	movzbl (%edx),%edx
+  8009bf:	29 d0                	sub    %edx,%eax
+  8009c1:	5d                   	pop    %ebp
+  8009c2:	c3                   	ret
+
+008009c3 <strncmp>:
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	53                   	push   %ebx
+  8009c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009cd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d5:	85 d2                	test   %edx,%edx
+  8009d7:	74 2e                	je     800a07 <strncmp+0x44>
+  8009d9:	0f b6 01             	movzbl (%ecx),%eax
+  8009dc:	84 c0                	test   %al,%al
+  8009de:	74 16                	je     8009f6 <strncmp+0x33>
+  8009e0:	3a 03                	cmp    (%ebx),%al
+  8009e2:	75 12                	jne    8009f6 <strncmp+0x33>
+  8009e4:	83 c1 01             	add    $0x1,%ecx
+  8009e7:	83 c3 01             	add    $0x1,%ebx
+  8009ea:	83 ea 01             	sub    $0x1,%edx
+  8009ed:	75 ea                	jne    8009d9 <strncmp+0x16>
+  8009ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f4:	eb 11                	jmp    800a07 <strncmp+0x44>
+  8009f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fb:	85 d2                	test   %edx,%edx
+  8009fd:	74 08                	je     800a07 <strncmp+0x44>
+  8009ff:	0f b6 01             	movzbl (%ecx),%eax
+  800a02:	0f b6 13             	movzbl (%ebx),%edx
+  800a05:	29 d0                	sub    %edx,%eax
+  800a07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a0a:	c9                   	leave
+  800a0b:	c3                   	ret
+
+00800a0c <strchr>:
+  800a0c:	55                   	push   %ebp
+  800a0d:	89 e5                	mov    %esp,%ebp
+  800a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a12:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a16:	0f b6 10             	movzbl (%eax),%edx
+  800a19:	84 d2                	test   %dl,%dl
+  800a1b:	74 15                	je     800a32 <strchr+0x26>
+  800a1d:	38 d1                	cmp    %dl,%cl
+  800a1f:	74 0f                	je     800a30 <strchr+0x24>
+  800a21:	83 c0 01             	add    $0x1,%eax
+  800a24:	0f b6 10             	movzbl (%eax),%edx
+  800a27:	84 d2                	test   %dl,%dl
+  800a29:	75 f2                	jne    800a1d <strchr+0x11>
+  800a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+  800a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a37:	eb f7                	jmp    800a30 <strchr+0x24>
+
+00800a39 <strfind>:
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	53                   	push   %ebx
+  800a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a43:	0f b6 18             	movzbl (%eax),%ebx
+  800a46:	38 d3                	cmp    %dl,%bl
+  800a48:	74 14                	je     800a5e <strfind+0x25>
+  800a4a:	89 d1                	mov    %edx,%ecx
+  800a4c:	84 db                	test   %bl,%bl
+  800a4e:	74 0e                	je     800a5e <strfind+0x25>
+  800a50:	83 c0 01             	add    $0x1,%eax
+  800a53:	0f b6 10             	movzbl (%eax),%edx
+  800a56:	38 ca                	cmp    %cl,%dl
+  800a58:	74 04                	je     800a5e <strfind+0x25>
+  800a5a:	84 d2                	test   %dl,%dl
+  800a5c:	75 f2                	jne    800a50 <strfind+0x17>
+  800a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a61:	c9                   	leave
+  800a62:	c3                   	ret
+
+00800a63 <memset>:
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	57                   	push   %edi
+  800a67:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a6d:	85 c9                	test   %ecx,%ecx
+  800a6f:	74 20                	je     800a91 <memset+0x2e>
+  800a71:	89 f8                	mov    %edi,%eax
+  800a73:	09 c8                	or     %ecx,%eax
+  800a75:	a8 03                	test   $0x3,%al
+  800a77:	75 12                	jne    800a8b <memset+0x28>
+  800a79:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a7d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a83:	c1 e9 02             	shr    $0x2,%ecx
+  800a86:	fc                   	cld
+  800a87:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a89:	eb 06                	jmp    800a91 <memset+0x2e>
+  800a8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a8e:	fc                   	cld
+  800a8f:	f3 aa                	rep stos %al,%es:(%edi)
+  800a91:	89 f8                	mov    %edi,%eax
+  800a93:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a96:	c9                   	leave
+  800a97:	c3                   	ret
+
+00800a98 <memmove>:
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	57                   	push   %edi
+  800a9c:	56                   	push   %esi
+  800a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aa3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800aa6:	39 c6                	cmp    %eax,%esi
+  800aa8:	73 32                	jae    800adc <memmove+0x44>
+  800aaa:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aad:	39 d0                	cmp    %edx,%eax
+  800aaf:	73 2b                	jae    800adc <memmove+0x44>
+  800ab1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800ab4:	89 d6                	mov    %edx,%esi
+  800ab6:	09 fe                	or     %edi,%esi
+  800ab8:	09 ce                	or     %ecx,%esi
+  800aba:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ac0:	75 0e                	jne    800ad0 <memmove+0x38>
+  800ac2:	83 ef 04             	sub    $0x4,%edi
+  800ac5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ac8:	c1 e9 02             	shr    $0x2,%ecx
+  800acb:	fd                   	std
+  800acc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ace:	eb 09                	jmp    800ad9 <memmove+0x41>
+  800ad0:	83 ef 01             	sub    $0x1,%edi
+  800ad3:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800ad6:	fd                   	std
+  800ad7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ad9:	fc                   	cld
+  800ada:	eb 1a                	jmp    800af6 <memmove+0x5e>
+  800adc:	89 f2                	mov    %esi,%edx
+  800ade:	09 c2                	or     %eax,%edx
+  800ae0:	09 ca                	or     %ecx,%edx
+  800ae2:	f6 c2 03             	test   $0x3,%dl
+  800ae5:	75 0a                	jne    800af1 <memmove+0x59>
+  800ae7:	c1 e9 02             	shr    $0x2,%ecx
+  800aea:	89 c7                	mov    %eax,%edi
+  800aec:	fc                   	cld
+  800aed:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aef:	eb 05                	jmp    800af6 <memmove+0x5e>
+  800af1:	89 c7                	mov    %eax,%edi
+  800af3:	fc                   	cld
+  800af4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800af6:	5e                   	pop    %esi
+  800af7:	5f                   	pop    %edi
+  800af8:	5d                   	pop    %ebp
+  800af9:	c3                   	ret
+
+00800afa <memcpy>:
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	83 ec 0c             	sub    $0xc,%esp
+  800b00:	ff 75 10             	push   0x10(%ebp)
+  800b03:	ff 75 0c             	push   0xc(%ebp)
+  800b06:	ff 75 08             	push   0x8(%ebp)
+  800b09:	e8 8a ff ff ff       	call   800a98 <memmove>
+  800b0e:	c9                   	leave
+  800b0f:	c3                   	ret
+
+00800b10 <memcmp>:
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	56                   	push   %esi
+  800b14:	53                   	push   %ebx
+  800b15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b18:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b1b:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b1e:	85 f6                	test   %esi,%esi
+  800b20:	74 29                	je     800b4b <memcmp+0x3b>
+  800b22:	01 c6                	add    %eax,%esi
+  800b24:	0f b6 08             	movzbl (%eax),%ecx
+  800b27:	0f b6 1a             	movzbl (%edx),%ebx
+  800b2a:	38 d9                	cmp    %bl,%cl
+  800b2c:	75 11                	jne    800b3f <memcmp+0x2f>
+  800b2e:	83 c0 01             	add    $0x1,%eax
+  800b31:	83 c2 01             	add    $0x1,%edx
+  800b34:	39 c6                	cmp    %eax,%esi
+  800b36:	75 ec                	jne    800b24 <memcmp+0x14>
+  800b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3d:	eb 08                	jmp    800b47 <memcmp+0x37>
+  800b3f:	0f b6 c1             	movzbl %cl,%eax
+  800b42:	0f b6 db             	movzbl %bl,%ebx
+  800b45:	29 d8                	sub    %ebx,%eax
+  800b47:	5b                   	pop    %ebx
+  800b48:	5e                   	pop    %esi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+  800b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b50:	eb f5                	jmp    800b47 <memcmp+0x37>
+
+00800b52 <memfind>:
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	03 55 10             	add    0x10(%ebp),%edx
+  800b60:	39 d0                	cmp    %edx,%eax
+  800b62:	73 0d                	jae    800b71 <memfind+0x1f>
+  800b64:	38 08                	cmp    %cl,(%eax)
+  800b66:	74 0d                	je     800b75 <memfind+0x23>
+  800b68:	83 c0 01             	add    $0x1,%eax
+  800b6b:	39 c2                	cmp    %eax,%edx
+  800b6d:	75 f5                	jne    800b64 <memfind+0x12>
+  800b6f:	eb 06                	jmp    800b77 <memfind+0x25>
+  800b71:	89 c2                	mov    %eax,%edx
+  800b73:	eb 02                	jmp    800b77 <memfind+0x25>
+  800b75:	89 c2                	mov    %eax,%edx
+  800b77:	89 d0                	mov    %edx,%eax
+  800b79:	5d                   	pop    %ebp
+  800b7a:	c3                   	ret
+
+00800b7b <strtol>:
+  800b7b:	55                   	push   %ebp
+  800b7c:	89 e5                	mov    %esp,%ebp
+  800b7e:	57                   	push   %edi
+  800b7f:	56                   	push   %esi
+  800b80:	53                   	push   %ebx
+  800b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b87:	0f b6 02             	movzbl (%edx),%eax
+  800b8a:	3c 20                	cmp    $0x20,%al
+  800b8c:	74 04                	je     800b92 <strtol+0x17>
+  800b8e:	3c 09                	cmp    $0x9,%al
+  800b90:	75 0e                	jne    800ba0 <strtol+0x25>
+  800b92:	83 c2 01             	add    $0x1,%edx
+  800b95:	0f b6 02             	movzbl (%edx),%eax
+  800b98:	3c 20                	cmp    $0x20,%al
+  800b9a:	74 f6                	je     800b92 <strtol+0x17>
+  800b9c:	3c 09                	cmp    $0x9,%al
+  800b9e:	74 f2                	je     800b92 <strtol+0x17>
+  800ba0:	3c 2b                	cmp    $0x2b,%al
+  800ba2:	74 2a                	je     800bce <strtol+0x53>
+  800ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba9:	3c 2d                	cmp    $0x2d,%al
+  800bab:	74 2b                	je     800bd8 <strtol+0x5d>
+  800bad:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bb3:	75 0f                	jne    800bc4 <strtol+0x49>
+  800bb5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bb8:	74 28                	je     800be2 <strtol+0x67>
+  800bba:	85 db                	test   %ebx,%ebx
+  800bbc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bc1:	0f 44 d8             	cmove  %eax,%ebx
+  800bc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bcc:	eb 46                	jmp    800c14 <strtol+0x99>
+  800bce:	83 c2 01             	add    $0x1,%edx
+  800bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd6:	eb d5                	jmp    800bad <strtol+0x32>
+  800bd8:	83 c2 01             	add    $0x1,%edx
+  800bdb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800be0:	eb cb                	jmp    800bad <strtol+0x32>
+  800be2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800be6:	74 0e                	je     800bf6 <strtol+0x7b>
+  800be8:	85 db                	test   %ebx,%ebx
+  800bea:	75 d8                	jne    800bc4 <strtol+0x49>
+  800bec:	83 c2 01             	add    $0x1,%edx
+  800bef:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bf4:	eb ce                	jmp    800bc4 <strtol+0x49>
+  800bf6:	83 c2 02             	add    $0x2,%edx
+  800bf9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bfe:	eb c4                	jmp    800bc4 <strtol+0x49>
+  800c00:	0f be c0             	movsbl %al,%eax
+  800c03:	83 e8 30             	sub    $0x30,%eax
+  800c06:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c09:	7d 3a                	jge    800c45 <strtol+0xca>
+  800c0b:	83 c2 01             	add    $0x1,%edx
+  800c0e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c12:	01 c1                	add    %eax,%ecx
+  800c14:	0f b6 02             	movzbl (%edx),%eax
+  800c17:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c1a:	89 f3                	mov    %esi,%ebx
+  800c1c:	80 fb 09             	cmp    $0x9,%bl
+  800c1f:	76 df                	jbe    800c00 <strtol+0x85>
+  800c21:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c24:	89 f3                	mov    %esi,%ebx
+  800c26:	80 fb 19             	cmp    $0x19,%bl
+  800c29:	77 08                	ja     800c33 <strtol+0xb8>
+  800c2b:	0f be c0             	movsbl %al,%eax
+  800c2e:	83 e8 57             	sub    $0x57,%eax
+  800c31:	eb d3                	jmp    800c06 <strtol+0x8b>
+  800c33:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c36:	89 f3                	mov    %esi,%ebx
+  800c38:	80 fb 19             	cmp    $0x19,%bl
+  800c3b:	77 08                	ja     800c45 <strtol+0xca>
+  800c3d:	0f be c0             	movsbl %al,%eax
+  800c40:	83 e8 37             	sub    $0x37,%eax
+  800c43:	eb c1                	jmp    800c06 <strtol+0x8b>
+  800c45:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c49:	74 05                	je     800c50 <strtol+0xd5>
+  800c4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c4e:	89 10                	mov    %edx,(%eax)
+  800c50:	89 c8                	mov    %ecx,%eax
+  800c52:	f7 d8                	neg    %eax
+  800c54:	85 ff                	test   %edi,%edi
+  800c56:	0f 45 c8             	cmovne %eax,%ecx
+  800c59:	89 c8                	mov    %ecx,%eax
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5f                   	pop    %edi
+  800c5e:	5d                   	pop    %ebp
+  800c5f:	c3                   	ret
+
+00800c60 <sys_cputs>:
+  800c60:	55                   	push   %ebp
+  800c61:	89 e5                	mov    %esp,%ebp
+  800c63:	57                   	push   %edi
+  800c64:	56                   	push   %esi
+  800c65:	53                   	push   %ebx
+  800c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c71:	89 c3                	mov    %eax,%ebx
+  800c73:	89 c7                	mov    %eax,%edi
+  800c75:	89 c6                	mov    %eax,%esi
+  800c77:	cd 30                	int    $0x30
+  800c79:	5b                   	pop    %ebx
+  800c7a:	5e                   	pop    %esi
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+
+00800c7e <sys_cgetc>:
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	57                   	push   %edi
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  800c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c89:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8e:	89 d1                	mov    %edx,%ecx
+  800c90:	89 d3                	mov    %edx,%ebx
+  800c92:	89 d7                	mov    %edx,%edi
+  800c94:	89 d6                	mov    %edx,%esi
+  800c96:	cd 30                	int    $0x30
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+
+00800c9d <sys_env_destroy>:
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	57                   	push   %edi
+  800ca1:	56                   	push   %esi
+  800ca2:	53                   	push   %ebx
+  800ca3:	83 ec 0c             	sub    $0xc,%esp
+  800ca6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cae:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cb3:	89 cb                	mov    %ecx,%ebx
+  800cb5:	89 cf                	mov    %ecx,%edi
+  800cb7:	89 ce                	mov    %ecx,%esi
+  800cb9:	cd 30                	int    $0x30
+  800cbb:	85 c0                	test   %eax,%eax
+  800cbd:	7f 08                	jg     800cc7 <sys_env_destroy+0x2a>
+  800cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc2:	5b                   	pop    %ebx
+  800cc3:	5e                   	pop    %esi
+  800cc4:	5f                   	pop    %edi
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	c3                   	ret
+  800cc7:	83 ec 0c             	sub    $0xc,%esp
+  800cca:	50                   	push   %eax
+  800ccb:	6a 03                	push   $0x3
+  800ccd:	68 0b 3b 80 00       	push   $0x803b0b
+  800cd2:	6a 24                	push   $0x24
+  800cd4:	68 28 3b 80 00       	push   $0x803b28
+  800cd9:	e8 68 25 00 00       	call   803246 <_panic>
+
+00800cde <sys_getenvid>:
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	57                   	push   %edi
+  800ce2:	56                   	push   %esi
+  800ce3:	53                   	push   %ebx
+  800ce4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cee:	89 d1                	mov    %edx,%ecx
+  800cf0:	89 d3                	mov    %edx,%ebx
+  800cf2:	89 d7                	mov    %edx,%edi
+  800cf4:	89 d6                	mov    %edx,%esi
+  800cf6:	cd 30                	int    $0x30
+  800cf8:	5b                   	pop    %ebx
+  800cf9:	5e                   	pop    %esi
+  800cfa:	5f                   	pop    %edi
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	c3                   	ret
+
+00800cfd <sys_yield>:
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	57                   	push   %edi
+  800d01:	56                   	push   %esi
+  800d02:	53                   	push   %ebx
+  800d03:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d0a:	74 26                	je     800d32 <sys_yield+0x35>
+  800d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d11:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d16:	89 d1                	mov    %edx,%ecx
+  800d18:	89 d3                	mov    %edx,%ebx
+  800d1a:	89 d7                	mov    %edx,%edi
+  800d1c:	6a 00                	push   $0x0
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	8d 35 29 0d 80 00    	lea    0x800d29,%esi
+  800d27:	0f 34                	sysenter
+  800d29:	5d                   	pop    %ebp
+  800d2a:	83 c4 04             	add    $0x4,%esp
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+  800d32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d37:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d3c:	89 d1                	mov    %edx,%ecx
+  800d3e:	89 d3                	mov    %edx,%ebx
+  800d40:	89 d7                	mov    %edx,%edi
+  800d42:	89 d6                	mov    %edx,%esi
+  800d44:	cd 30                	int    $0x30
+  800d46:	eb e5                	jmp    800d2d <sys_yield+0x30>
+
+00800d48 <sys_page_alloc>:
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	57                   	push   %edi
+  800d4c:	56                   	push   %esi
+  800d4d:	53                   	push   %ebx
+  800d4e:	83 ec 0c             	sub    $0xc,%esp
+  800d51:	be 00 00 00 00       	mov    $0x0,%esi
+  800d56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d64:	89 f7                	mov    %esi,%edi
+  800d66:	cd 30                	int    $0x30
+  800d68:	85 c0                	test   %eax,%eax
+  800d6a:	7f 08                	jg     800d74 <sys_page_alloc+0x2c>
+  800d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5f                   	pop    %edi
+  800d72:	5d                   	pop    %ebp
+  800d73:	c3                   	ret
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+  800d77:	50                   	push   %eax
+  800d78:	6a 04                	push   $0x4
+  800d7a:	68 0b 3b 80 00       	push   $0x803b0b
+  800d7f:	6a 24                	push   $0x24
+  800d81:	68 28 3b 80 00       	push   $0x803b28
+  800d86:	e8 bb 24 00 00       	call   803246 <_panic>
+
+00800d8b <sys_page_map>:
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	57                   	push   %edi
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+  800d94:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d9b:	74 33                	je     800dd0 <sys_page_map+0x45>
+  800d9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800da8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dae:	ff 75 18             	push   0x18(%ebp)
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	8d 35 bc 0d 80 00    	lea    0x800dbc,%esi
+  800dba:	0f 34                	sysenter
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	83 c4 04             	add    $0x4,%esp
+  800dc0:	89 c2                	mov    %eax,%edx
+  800dc2:	85 c0                	test   %eax,%eax
+  800dc4:	7f 3d                	jg     800e03 <sys_page_map+0x78>
+  800dc6:	89 d0                	mov    %edx,%eax
+  800dc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+  800dd0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dde:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800de4:	cd 30                	int    $0x30
+  800de6:	89 c2                	mov    %eax,%edx
+  800de8:	85 c0                	test   %eax,%eax
+  800dea:	7e da                	jle    800dc6 <sys_page_map+0x3b>
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+  800def:	50                   	push   %eax
+  800df0:	6a 05                	push   $0x5
+  800df2:	68 0b 3b 80 00       	push   $0x803b0b
+  800df7:	6a 24                	push   $0x24
+  800df9:	68 28 3b 80 00       	push   $0x803b28
+  800dfe:	e8 43 24 00 00       	call   803246 <_panic>
+  800e03:	83 ec 0c             	sub    $0xc,%esp
+  800e06:	50                   	push   %eax
+  800e07:	6a 05                	push   $0x5
+  800e09:	68 0b 3b 80 00       	push   $0x803b0b
+  800e0e:	6a 48                	push   $0x48
+  800e10:	68 28 3b 80 00       	push   $0x803b28
+  800e15:	e8 2c 24 00 00       	call   803246 <_panic>
+
+00800e1a <sys_page_unmap>:
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	53                   	push   %ebx
+  800e20:	83 ec 0c             	sub    $0xc,%esp
+  800e23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e33:	89 df                	mov    %ebx,%edi
+  800e35:	89 de                	mov    %ebx,%esi
+  800e37:	cd 30                	int    $0x30
+  800e39:	85 c0                	test   %eax,%eax
+  800e3b:	7f 08                	jg     800e45 <sys_page_unmap+0x2b>
+  800e3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e40:	5b                   	pop    %ebx
+  800e41:	5e                   	pop    %esi
+  800e42:	5f                   	pop    %edi
+  800e43:	5d                   	pop    %ebp
+  800e44:	c3                   	ret
+  800e45:	83 ec 0c             	sub    $0xc,%esp
+  800e48:	50                   	push   %eax
+  800e49:	6a 06                	push   $0x6
+  800e4b:	68 0b 3b 80 00       	push   $0x803b0b
+  800e50:	6a 24                	push   $0x24
+  800e52:	68 28 3b 80 00       	push   $0x803b28
+  800e57:	e8 ea 23 00 00       	call   803246 <_panic>
+
+00800e5c <sys_fork>:
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	57                   	push   %edi
+  800e60:	56                   	push   %esi
+  800e61:	53                   	push   %ebx
+  800e62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e67:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e6c:	89 d1                	mov    %edx,%ecx
+  800e6e:	89 d3                	mov    %edx,%ebx
+  800e70:	89 d7                	mov    %edx,%edi
+  800e72:	89 d6                	mov    %edx,%esi
+  800e74:	cd 30                	int    $0x30
+  800e76:	5b                   	pop    %ebx
+  800e77:	5e                   	pop    %esi
+  800e78:	5f                   	pop    %edi
+  800e79:	5d                   	pop    %ebp
+  800e7a:	c3                   	ret
+
+00800e7b <sys_env_set_status>:
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	57                   	push   %edi
+  800e7f:	56                   	push   %esi
+  800e80:	53                   	push   %ebx
+  800e81:	83 ec 0c             	sub    $0xc,%esp
+  800e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e94:	89 df                	mov    %ebx,%edi
+  800e96:	89 de                	mov    %ebx,%esi
+  800e98:	cd 30                	int    $0x30
+  800e9a:	85 c0                	test   %eax,%eax
+  800e9c:	7f 08                	jg     800ea6 <sys_env_set_status+0x2b>
+  800e9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+  800ea9:	50                   	push   %eax
+  800eaa:	6a 08                	push   $0x8
+  800eac:	68 0b 3b 80 00       	push   $0x803b0b
+  800eb1:	6a 24                	push   $0x24
+  800eb3:	68 28 3b 80 00       	push   $0x803b28
+  800eb8:	e8 89 23 00 00       	call   803246 <_panic>
+
+00800ebd <sys_env_set_trapframe>:
+  800ebd:	55                   	push   %ebp
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	57                   	push   %edi
+  800ec1:	56                   	push   %esi
+  800ec2:	53                   	push   %ebx
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ed6:	89 df                	mov    %ebx,%edi
+  800ed8:	89 de                	mov    %ebx,%esi
+  800eda:	cd 30                	int    $0x30
+  800edc:	85 c0                	test   %eax,%eax
+  800ede:	7f 08                	jg     800ee8 <sys_env_set_trapframe+0x2b>
+  800ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+  800eeb:	50                   	push   %eax
+  800eec:	6a 09                	push   $0x9
+  800eee:	68 0b 3b 80 00       	push   $0x803b0b
+  800ef3:	6a 24                	push   $0x24
+  800ef5:	68 28 3b 80 00       	push   $0x803b28
+  800efa:	e8 47 23 00 00       	call   803246 <_panic>
+
+00800eff <sys_env_set_cow>:
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	57                   	push   %edi
+  800f03:	56                   	push   %esi
+  800f04:	53                   	push   %ebx
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+  800f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f18:	89 df                	mov    %ebx,%edi
+  800f1a:	89 de                	mov    %ebx,%esi
+  800f1c:	cd 30                	int    $0x30
+  800f1e:	85 c0                	test   %eax,%eax
+  800f20:	7f 08                	jg     800f2a <sys_env_set_cow+0x2b>
+  800f22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f25:	5b                   	pop    %ebx
+  800f26:	5e                   	pop    %esi
+  800f27:	5f                   	pop    %edi
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+  800f2a:	83 ec 0c             	sub    $0xc,%esp
+  800f2d:	50                   	push   %eax
+  800f2e:	6a 20                	push   $0x20
+  800f30:	68 0b 3b 80 00       	push   $0x803b0b
+  800f35:	6a 24                	push   $0x24
+  800f37:	68 28 3b 80 00       	push   $0x803b28
+  800f3c:	e8 05 23 00 00       	call   803246 <_panic>
+
+00800f41 <sys_env_service>:
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	57                   	push   %edi
+  800f45:	56                   	push   %esi
+  800f46:	53                   	push   %ebx
+  800f47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f54:	89 cb                	mov    %ecx,%ebx
+  800f56:	89 cf                	mov    %ecx,%edi
+  800f58:	89 ce                	mov    %ecx,%esi
+  800f5a:	cd 30                	int    $0x30
+  800f5c:	5b                   	pop    %ebx
+  800f5d:	5e                   	pop    %esi
+  800f5e:	5f                   	pop    %edi
+  800f5f:	5d                   	pop    %ebp
+  800f60:	c3                   	ret
+
+00800f61 <sys_env_set_pgfault_upcall>:
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+  800f6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f7a:	89 df                	mov    %ebx,%edi
+  800f7c:	89 de                	mov    %ebx,%esi
+  800f7e:	cd 30                	int    $0x30
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	7f 08                	jg     800f8c <sys_env_set_pgfault_upcall+0x2b>
+  800f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+  800f8c:	83 ec 0c             	sub    $0xc,%esp
+  800f8f:	50                   	push   %eax
+  800f90:	6a 0a                	push   $0xa
+  800f92:	68 0b 3b 80 00       	push   $0x803b0b
+  800f97:	6a 24                	push   $0x24
+  800f99:	68 28 3b 80 00       	push   $0x803b28
+  800f9e:	e8 a3 22 00 00       	call   803246 <_panic>
+
+00800fa3 <sys_ipc_try_send>:
+  800fa3:	55                   	push   %ebp
+  800fa4:	89 e5                	mov    %esp,%ebp
+  800fa6:	57                   	push   %edi
+  800fa7:	56                   	push   %esi
+  800fa8:	53                   	push   %ebx
+  800fa9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fb0:	74 27                	je     800fd9 <sys_ipc_try_send+0x36>
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc3:	6a 00                	push   $0x0
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	8d 35 d0 0f 80 00    	lea    0x800fd0,%esi
+  800fce:	0f 34                	sysenter
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	83 c4 04             	add    $0x4,%esp
+  800fd4:	5b                   	pop    %ebx
+  800fd5:	5e                   	pop    %esi
+  800fd6:	5f                   	pop    %edi
+  800fd7:	5d                   	pop    %ebp
+  800fd8:	c3                   	ret
+  800fd9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fde:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fef:	cd 30                	int    $0x30
+  800ff1:	eb e1                	jmp    800fd4 <sys_ipc_try_send+0x31>
+
+00800ff3 <sys_ipc_recv>:
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+  800ffc:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801003:	74 32                	je     801037 <sys_ipc_recv+0x44>
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+  801008:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80100d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801012:	89 cb                	mov    %ecx,%ebx
+  801014:	89 cf                	mov    %ecx,%edi
+  801016:	6a 00                	push   $0x0
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	8d 35 23 10 80 00    	lea    0x801023,%esi
+  801021:	0f 34                	sysenter
+  801023:	5d                   	pop    %ebp
+  801024:	83 c4 04             	add    $0x4,%esp
+  801027:	89 c2                	mov    %eax,%edx
+  801029:	85 c0                	test   %eax,%eax
+  80102b:	7f 3c                	jg     801069 <sys_ipc_recv+0x76>
+  80102d:	89 d0                	mov    %edx,%eax
+  80102f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+  801037:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80103c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	89 cb                	mov    %ecx,%ebx
+  801046:	89 cf                	mov    %ecx,%edi
+  801048:	89 ce                	mov    %ecx,%esi
+  80104a:	cd 30                	int    $0x30
+  80104c:	89 c2                	mov    %eax,%edx
+  80104e:	85 c0                	test   %eax,%eax
+  801050:	7e db                	jle    80102d <sys_ipc_recv+0x3a>
+  801052:	83 ec 0c             	sub    $0xc,%esp
+  801055:	50                   	push   %eax
+  801056:	6a 0d                	push   $0xd
+  801058:	68 0b 3b 80 00       	push   $0x803b0b
+  80105d:	6a 24                	push   $0x24
+  80105f:	68 28 3b 80 00       	push   $0x803b28
+  801064:	e8 dd 21 00 00       	call   803246 <_panic>
+  801069:	83 ec 0c             	sub    $0xc,%esp
+  80106c:	50                   	push   %eax
+  80106d:	6a 0d                	push   $0xd
+  80106f:	68 0b 3b 80 00       	push   $0x803b0b
+  801074:	6a 48                	push   $0x48
+  801076:	68 28 3b 80 00       	push   $0x803b28
+  80107b:	e8 c6 21 00 00       	call   803246 <_panic>
+
+00801080 <sys_ipc_send>:
+  801080:	55                   	push   %ebp
+  801081:	89 e5                	mov    %esp,%ebp
+  801083:	57                   	push   %edi
+  801084:	56                   	push   %esi
+  801085:	53                   	push   %ebx
+  801086:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80108d:	74 27                	je     8010b6 <sys_ipc_send+0x36>
+  80108f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801092:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801095:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80109a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a0:	6a 00                	push   $0x0
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	8d 35 ad 10 80 00    	lea    0x8010ad,%esi
+  8010ab:	0f 34                	sysenter
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	83 c4 04             	add    $0x4,%esp
+  8010b1:	5b                   	pop    %ebx
+  8010b2:	5e                   	pop    %esi
+  8010b3:	5f                   	pop    %edi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+  8010b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cc:	cd 30                	int    $0x30
+  8010ce:	eb e1                	jmp    8010b1 <sys_ipc_send+0x31>
+
+008010d0 <sys_ipc_call>:
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	57                   	push   %edi
+  8010d4:	56                   	push   %esi
+  8010d5:	53                   	push   %ebx
+  8010d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010ea:	cd 30                	int    $0x30
+  8010ec:	5b                   	pop    %ebx
+  8010ed:	5e                   	pop    %esi
+  8010ee:	5f                   	pop    %edi
+  8010ef:	5d                   	pop    %ebp
+  8010f0:	c3                   	ret
+
+008010f1 <sys_ipc_reply_recv>:
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fd:	b8 10 00 00 00       	mov    $0x10,%eax
+  801102:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801105:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801108:	8b 75 18             	mov    0x18(%ebp),%esi
+  80110b:	cd 30                	int    $0x30
+  80110d:	5b                   	pop    %ebx
+  80110e:	5e                   	pop    %esi
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+
+00801112 <sys_time_msec>:
+  801112:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801117:	85 c0                	test   %eax,%eax
+  801119:	75 06                	jne    801121 <sys_time_msec+0xf>
+  80111b:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801120:	c3                   	ret
+  801121:	55                   	push   %ebp
+  801122:	89 e5                	mov    %esp,%ebp
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	53                   	push   %ebx
+  801127:	83 ec 0c             	sub    $0xc,%esp
+  80112a:	0f 31                	rdtsc
+  80112c:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801132:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801138:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80113e:	29 c8                	sub    %ecx,%eax
+  801140:	19 da                	sbb    %ebx,%edx
+  801142:	bf 00 00 00 00       	mov    $0x0,%edi
+  801147:	57                   	push   %edi
+  801148:	56                   	push   %esi
+  801149:	52                   	push   %edx
+  80114a:	50                   	push   %eax
+  80114b:	e8 65 25 00 00       	call   8036b5 <__udivdi3>
+  801150:	83 c4 10             	add    $0x10,%esp
+  801153:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801156:	5b                   	pop    %ebx
+  801157:	5e                   	pop    %esi
+  801158:	5f                   	pop    %edi
+  801159:	5d                   	pop    %ebp
+  80115a:	c3                   	ret
+
+0080115b <sys_env_swap>:
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	57                   	push   %edi
+  80115f:	56                   	push   %esi
+  801160:	53                   	push   %ebx
+  801161:	83 ec 0c             	sub    $0xc,%esp
+  801164:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801169:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801171:	89 cb                	mov    %ecx,%ebx
+  801173:	89 cf                	mov    %ecx,%edi
+  801175:	89 ce                	mov    %ecx,%esi
+  801177:	cd 30                	int    $0x30
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	7f 08                	jg     801185 <sys_env_swap+0x2a>
+  80117d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5f                   	pop    %edi
+  801183:	5d                   	pop    %ebp
+  801184:	c3                   	ret
+  801185:	83 ec 0c             	sub    $0xc,%esp
+  801188:	50                   	push   %eax
+  801189:	6a 12                	push   $0x12
+  80118b:	68 0b 3b 80 00       	push   $0x803b0b
+  801190:	6a 24                	push   $0x24
+  801192:	68 28 3b 80 00       	push   $0x803b28
+  801197:	e8 aa 20 00 00       	call   803246 <_panic>
+
+0080119c <sys_net_try_send>:
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	57                   	push   %edi
+  8011a0:	56                   	push   %esi
+  8011a1:	53                   	push   %ebx
+  8011a2:	83 ec 0c             	sub    $0xc,%esp
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011b5:	89 df                	mov    %ebx,%edi
+  8011b7:	89 de                	mov    %ebx,%esi
+  8011b9:	cd 30                	int    $0x30
+  8011bb:	85 c0                	test   %eax,%eax
+  8011bd:	7f 08                	jg     8011c7 <sys_net_try_send+0x2b>
+  8011bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c2:	5b                   	pop    %ebx
+  8011c3:	5e                   	pop    %esi
+  8011c4:	5f                   	pop    %edi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	c3                   	ret
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  8011ca:	50                   	push   %eax
+  8011cb:	6a 13                	push   $0x13
+  8011cd:	68 0b 3b 80 00       	push   $0x803b0b
+  8011d2:	6a 24                	push   $0x24
+  8011d4:	68 28 3b 80 00       	push   $0x803b28
+  8011d9:	e8 68 20 00 00       	call   803246 <_panic>
+
+008011de <sys_net_try_receive>:
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+  8011e4:	83 ec 0c             	sub    $0xc,%esp
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011f7:	89 df                	mov    %ebx,%edi
+  8011f9:	89 de                	mov    %ebx,%esi
+  8011fb:	cd 30                	int    $0x30
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	7f 08                	jg     801209 <sys_net_try_receive+0x2b>
+  801201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801204:	5b                   	pop    %ebx
+  801205:	5e                   	pop    %esi
+  801206:	5f                   	pop    %edi
+  801207:	5d                   	pop    %ebp
+  801208:	c3                   	ret
+  801209:	83 ec 0c             	sub    $0xc,%esp
+  80120c:	50                   	push   %eax
+  80120d:	6a 14                	push   $0x14
+  80120f:	68 0b 3b 80 00       	push   $0x803b0b
+  801214:	6a 24                	push   $0x24
+  801216:	68 28 3b 80 00       	push   $0x803b28
+  80121b:	e8 26 20 00 00       	call   803246 <_panic>
+
+00801220 <sys_net_recv_page>:
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	57                   	push   %edi
+  801224:	56                   	push   %esi
+  801225:	53                   	push   %ebx
+  801226:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	b8 27 00 00 00       	mov    $0x27,%eax
+  801233:	89 cb                	mov    %ecx,%ebx
+  801235:	89 cf                	mov    %ecx,%edi
+  801237:	89 ce                	mov    %ecx,%esi
+  801239:	cd 30                	int    $0x30
+  80123b:	5b                   	pop    %ebx
+  80123c:	5e                   	pop    %esi
+  80123d:	5f                   	pop    %edi
+  80123e:	5d                   	pop    %ebp
+  80123f:	c3                   	ret
+
+00801240 <sys_net_wait>:
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	57                   	push   %edi
+  801244:	56                   	push   %esi
+  801245:	53                   	push   %ebx
+  801246:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124b:	b8 26 00 00 00       	mov    $0x26,%eax
+  801250:	89 d1                	mov    %edx,%ecx
+  801252:	89 d3                	mov    %edx,%ebx
+  801254:	89 d7                	mov    %edx,%edi
+  801256:	89 d6                	mov    %edx,%esi
+  801258:	cd 30                	int    $0x30
+  80125a:	5b                   	pop    %ebx
+  80125b:	5e                   	pop    %esi
+  80125c:	5f                   	pop    %edi
+  80125d:	5d                   	pop    %ebp
+  80125e:	c3                   	ret
+
+0080125f <sys_get_mac>:
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	57                   	push   %edi
+  801263:	56                   	push   %esi
+  801264:	53                   	push   %ebx
+  801265:	83 ec 0c             	sub    $0xc,%esp
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801273:	b8 15 00 00 00       	mov    $0x15,%eax
+  801278:	89 df                	mov    %ebx,%edi
+  80127a:	89 de                	mov    %ebx,%esi
+  80127c:	cd 30                	int    $0x30
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	7f 08                	jg     80128a <sys_get_mac+0x2b>
+  801282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+  80128d:	50                   	push   %eax
+  80128e:	6a 15                	push   $0x15
+  801290:	68 0b 3b 80 00       	push   $0x803b0b
+  801295:	6a 24                	push   $0x24
+  801297:	68 28 3b 80 00       	push   $0x803b28
+  80129c:	e8 a5 1f 00 00       	call   803246 <_panic>
+
+008012a1 <sys_env_lease>:
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	57                   	push   %edi
+  8012a5:	56                   	push   %esi
+  8012a6:	53                   	push   %ebx
+  8012a7:	83 ec 0c             	sub    $0xc,%esp
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012ba:	89 df                	mov    %ebx,%edi
+  8012bc:	89 de                	mov    %ebx,%esi
+  8012be:	cd 30                	int    $0x30
+  8012c0:	85 c0                	test   %eax,%eax
+  8012c2:	7f 08                	jg     8012cc <sys_env_lease+0x2b>
+  8012c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c7:	5b                   	pop    %ebx
+  8012c8:	5e                   	pop    %esi
+  8012c9:	5f                   	pop    %edi
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	c3                   	ret
+  8012cc:	83 ec 0c             	sub    $0xc,%esp
+  8012cf:	50                   	push   %eax
+  8012d0:	6a 16                	push   $0x16
+  8012d2:	68 0b 3b 80 00       	push   $0x803b0b
+  8012d7:	6a 24                	push   $0x24
+  8012d9:	68 28 3b 80 00       	push   $0x803b28
+  8012de:	e8 63 1f 00 00       	call   803246 <_panic>
+
+008012e3 <sys_copy_mem>:
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	57                   	push   %edi
+  8012e7:	56                   	push   %esi
+  8012e8:	53                   	push   %ebx
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+  8012ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fd:	8b 75 18             	mov    0x18(%ebp),%esi
+  801300:	cd 30                	int    $0x30
+  801302:	85 c0                	test   %eax,%eax
+  801304:	7f 08                	jg     80130e <sys_copy_mem+0x2b>
+  801306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5f                   	pop    %edi
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+  80130e:	83 ec 0c             	sub    $0xc,%esp
+  801311:	50                   	push   %eax
+  801312:	6a 17                	push   $0x17
+  801314:	68 0b 3b 80 00       	push   $0x803b0b
+  801319:	6a 24                	push   $0x24
+  80131b:	68 28 3b 80 00       	push   $0x803b28
+  801320:	e8 21 1f 00 00       	call   803246 <_panic>
+
+00801325 <sys_get_perms>:
+  801325:	55                   	push   %ebp
+  801326:	89 e5                	mov    %esp,%ebp
+  801328:	57                   	push   %edi
+  801329:	56                   	push   %esi
+  80132a:	53                   	push   %ebx
+  80132b:	83 ec 0c             	sub    $0xc,%esp
+  80132e:	be 00 00 00 00       	mov    $0x0,%esi
+  801333:	8b 55 08             	mov    0x8(%ebp),%edx
+  801336:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801339:	b8 18 00 00 00       	mov    $0x18,%eax
+  80133e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801341:	89 f7                	mov    %esi,%edi
+  801343:	cd 30                	int    $0x30
+  801345:	85 c0                	test   %eax,%eax
+  801347:	7f 08                	jg     801351 <sys_get_perms+0x2c>
+  801349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+  801351:	83 ec 0c             	sub    $0xc,%esp
+  801354:	50                   	push   %eax
+  801355:	6a 18                	push   $0x18
+  801357:	68 0b 3b 80 00       	push   $0x803b0b
+  80135c:	6a 24                	push   $0x24
+  80135e:	68 28 3b 80 00       	push   $0x803b28
+  801363:	e8 de 1e 00 00       	call   803246 <_panic>
+
+00801368 <sys_env_unsuspend>:
+  801368:	55                   	push   %ebp
+  801369:	89 e5                	mov    %esp,%ebp
+  80136b:	57                   	push   %edi
+  80136c:	56                   	push   %esi
+  80136d:	53                   	push   %ebx
+  80136e:	83 ec 0c             	sub    $0xc,%esp
+  801371:	be 00 00 00 00       	mov    $0x0,%esi
+  801376:	8b 55 08             	mov    0x8(%ebp),%edx
+  801379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801381:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801384:	89 f7                	mov    %esi,%edi
+  801386:	cd 30                	int    $0x30
+  801388:	85 c0                	test   %eax,%eax
+  80138a:	7f 08                	jg     801394 <sys_env_unsuspend+0x2c>
+  80138c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138f:	5b                   	pop    %ebx
+  801390:	5e                   	pop    %esi
+  801391:	5f                   	pop    %edi
+  801392:	5d                   	pop    %ebp
+  801393:	c3                   	ret
+  801394:	83 ec 0c             	sub    $0xc,%esp
+  801397:	50                   	push   %eax
+  801398:	6a 19                	push   $0x19
+  80139a:	68 0b 3b 80 00       	push   $0x803b0b
+  80139f:	6a 24                	push   $0x24
+  8013a1:	68 28 3b 80 00       	push   $0x803b28
+  8013a6:	e8 9b 1e 00 00       	call   803246 <_panic>
+
+008013ab <sys_migrate>:
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	57                   	push   %edi
+  8013af:	56                   	push   %esi
+  8013b0:	53                   	push   %ebx
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+  8013b4:	ba 04 80 80 00       	mov    $0x808004,%edx
+  8013b9:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8013bf:	76 11                	jbe    8013d2 <sys_migrate+0x27>
+  8013c1:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8013c6:	0f b6 08             	movzbl (%eax),%ecx
+  8013c9:	05 00 10 00 00       	add    $0x1000,%eax
+  8013ce:	39 d0                	cmp    %edx,%eax
+  8013d0:	72 f4                	jb     8013c6 <sys_migrate+0x1b>
+  8013d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013da:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013df:	89 cb                	mov    %ecx,%ebx
+  8013e1:	89 cf                	mov    %ecx,%edi
+  8013e3:	89 ce                	mov    %ecx,%esi
+  8013e5:	cd 30                	int    $0x30
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	7f 08                	jg     8013f3 <sys_migrate+0x48>
+  8013eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ee:	5b                   	pop    %ebx
+  8013ef:	5e                   	pop    %esi
+  8013f0:	5f                   	pop    %edi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+  8013f3:	83 ec 0c             	sub    $0xc,%esp
+  8013f6:	50                   	push   %eax
+  8013f7:	6a 1a                	push   $0x1a
+  8013f9:	68 0b 3b 80 00       	push   $0x803b0b
+  8013fe:	6a 24                	push   $0x24
+  801400:	68 28 3b 80 00       	push   $0x803b28
+  801405:	e8 3c 1e 00 00       	call   803246 <_panic>
+
+0080140a <sys_lease_complete>:
+  80140a:	55                   	push   %ebp
+  80140b:	89 e5                	mov    %esp,%ebp
+  80140d:	57                   	push   %edi
+  80140e:	56                   	push   %esi
+  80140f:	53                   	push   %ebx
+  801410:	83 ec 0c             	sub    $0xc,%esp
+  801413:	ba 00 00 00 00       	mov    $0x0,%edx
+  801418:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80141d:	89 d1                	mov    %edx,%ecx
+  80141f:	89 d3                	mov    %edx,%ebx
+  801421:	89 d7                	mov    %edx,%edi
+  801423:	89 d6                	mov    %edx,%esi
+  801425:	cd 30                	int    $0x30
+  801427:	85 c0                	test   %eax,%eax
+  801429:	7f 08                	jg     801433 <sys_lease_complete+0x29>
+  80142b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142e:	5b                   	pop    %ebx
+  80142f:	5e                   	pop    %esi
+  801430:	5f                   	pop    %edi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+  801433:	83 ec 0c             	sub    $0xc,%esp
+  801436:	50                   	push   %eax
+  801437:	6a 1b                	push   $0x1b
+  801439:	68 0b 3b 80 00       	push   $0x803b0b
+  80143e:	6a 24                	push   $0x24
+  801440:	68 28 3b 80 00       	push   $0x803b28
+  801445:	e8 fc 1d 00 00       	call   803246 <_panic>
+
+0080144a <sys_env_set_thisenv>:
+  80144a:	55                   	push   %ebp
+  80144b:	89 e5                	mov    %esp,%ebp
+  80144d:	57                   	push   %edi
+  80144e:	56                   	push   %esi
+  80144f:	53                   	push   %ebx
+  801450:	83 ec 0c             	sub    $0xc,%esp
+  801453:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801463:	89 df                	mov    %ebx,%edi
+  801465:	89 de                	mov    %ebx,%esi
+  801467:	cd 30                	int    $0x30
+  801469:	85 c0                	test   %eax,%eax
+  80146b:	7f 08                	jg     801475 <sys_env_set_thisenv+0x2b>
+  80146d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+  801475:	83 ec 0c             	sub    $0xc,%esp
+  801478:	50                   	push   %eax
+  801479:	6a 1c                	push   $0x1c
+  80147b:	68 0b 3b 80 00       	push   $0x803b0b
+  801480:	6a 24                	push   $0x24
+  801482:	68 28 3b 80 00       	push   $0x803b28
+  801487:	e8 ba 1d 00 00       	call   803246 <_panic>
+
+0080148c <sys_env_set_sched>:
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	57                   	push   %edi
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+  801492:	83 ec 0c             	sub    $0xc,%esp
+  801495:	be 00 00 00 00       	mov    $0x0,%esi
+  80149a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a8:	89 f7                	mov    %esi,%edi
+  8014aa:	cd 30                	int    $0x30
+  8014ac:	85 c0                	test   %eax,%eax
+  8014ae:	7f 08                	jg     8014b8 <sys_env_set_sched+0x2c>
+  8014b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b3:	5b                   	pop    %ebx
+  8014b4:	5e                   	pop    %esi
+  8014b5:	5f                   	pop    %edi
+  8014b6:	5d                   	pop    %ebp
+  8014b7:	c3                   	ret
+  8014b8:	83 ec 0c             	sub    $0xc,%esp
+  8014bb:	50                   	push   %eax
+  8014bc:	6a 1d                	push   $0x1d
+  8014be:	68 0b 3b 80 00       	push   $0x803b0b
+  8014c3:	6a 24                	push   $0x24
+  8014c5:	68 28 3b 80 00       	push   $0x803b28
+  8014ca:	e8 77 1d 00 00       	call   803246 <_panic>
+
+008014cf <sys_batch>:
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	57                   	push   %edi
+  8014d3:	56                   	push   %esi
+  8014d4:	53                   	push   %ebx
+  8014d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014e5:	89 df                	mov    %ebx,%edi
+  8014e7:	89 de                	mov    %ebx,%esi
+  8014e9:	cd 30                	int    $0x30
+  8014eb:	5b                   	pop    %ebx
+  8014ec:	5e                   	pop    %esi
+  8014ed:	5f                   	pop    %edi
+  8014ee:	5d                   	pop    %ebp
+  8014ef:	c3                   	ret
+
+008014f0 <sys_env_stats>:
+  8014f0:	55                   	push   %ebp
+  8014f1:	89 e5                	mov    %esp,%ebp
+  8014f3:	57                   	push   %edi
+  8014f4:	56                   	push   %esi
+  8014f5:	53                   	push   %ebx
+  8014f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801501:	b8 23 00 00 00       	mov    $0x23,%eax
+  801506:	89 df                	mov    %ebx,%edi
+  801508:	89 de                	mov    %ebx,%esi
+  80150a:	cd 30                	int    $0x30
+  80150c:	5b                   	pop    %ebx
+  80150d:	5e                   	pop    %esi
+  80150e:	5f                   	pop    %edi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+
+00801511 <sys_trace>:
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	57                   	push   %edi
+  801515:	56                   	push   %esi
+  801516:	53                   	push   %ebx
+  801517:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151f:	b8 24 00 00 00       	mov    $0x24,%eax
+  801524:	89 cb                	mov    %ecx,%ebx
+  801526:	89 cf                	mov    %ecx,%edi
+  801528:	89 ce                	mov    %ecx,%esi
+  80152a:	cd 30                	int    $0x30
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+
+00801531 <sys_env_set_pager>:
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+  801537:	83 ec 0c             	sub    $0xc,%esp
+  80153a:	be 00 00 00 00       	mov    $0x0,%esi
+  80153f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801542:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801545:	b8 25 00 00 00       	mov    $0x25,%eax
+  80154a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154d:	89 f7                	mov    %esi,%edi
+  80154f:	cd 30                	int    $0x30
+  801551:	85 c0                	test   %eax,%eax
+  801553:	7f 08                	jg     80155d <sys_env_set_pager+0x2c>
+  801555:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801558:	5b                   	pop    %ebx
+  801559:	5e                   	pop    %esi
+  80155a:	5f                   	pop    %edi
+  80155b:	5d                   	pop    %ebp
+  80155c:	c3                   	ret
+  80155d:	83 ec 0c             	sub    $0xc,%esp
+  801560:	50                   	push   %eax
+  801561:	6a 25                	push   $0x25
+  801563:	68 0b 3b 80 00       	push   $0x803b0b
+  801568:	6a 24                	push   $0x24
+  80156a:	68 28 3b 80 00       	push   $0x803b28
+  80156f:	e8 d2 1c 00 00       	call   803246 <_panic>
+
+00801574 <sys_pager_retire>:
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	57                   	push   %edi
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+  80157a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801582:	b8 28 00 00 00       	mov    $0x28,%eax
+  801587:	89 cb                	mov    %ecx,%ebx
+  801589:	89 cf                	mov    %ecx,%edi
+  80158b:	89 ce                	mov    %ecx,%esi
+  80158d:	cd 30                	int    $0x30
+  80158f:	5b                   	pop    %ebx
+  801590:	5e                   	pop    %esi
+  801591:	5f                   	pop    %edi
+  801592:	5d                   	pop    %ebp
+  801593:	c3                   	ret
+
+00801594 <sys_prof>:
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	57                   	push   %edi
+  801598:	56                   	push   %esi
+  801599:	53                   	push   %ebx
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ad:	89 f7                	mov    %esi,%edi
+  8015af:	cd 30                	int    $0x30
+  8015b1:	5b                   	pop    %ebx
+  8015b2:	5e                   	pop    %esi
+  8015b3:	5f                   	pop    %edi
+  8015b4:	5d                   	pop    %ebp
+  8015b5:	c3                   	ret
+
+008015b6 <dupq_flush>:
+  8015b6:	55                   	push   %ebp
+  8015b7:	89 e5                	mov    %esp,%ebp
+  8015b9:	53                   	push   %ebx
+  8015ba:	83 ec 0c             	sub    $0xc,%esp
+  8015bd:	8b 1d 00 50 80 00    	mov    0x805000,%ebx
+  8015c3:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8015ca:	00 00 00 
+  8015cd:	53                   	push   %ebx
+  8015ce:	68 00 00 40 00       	push   $0x400000
+  8015d3:	e8 f7 fe ff ff       	call   8014cf <sys_batch>
+  8015d8:	83 c4 10             	add    $0x10,%esp
+  8015db:	85 c0                	test   %eax,%eax
+  8015dd:	78 14                	js     8015f3 <dupq_flush+0x3d>
+  8015df:	39 c3                	cmp    %eax,%ebx
+  8015e1:	7e 0b                	jle    8015ee <dupq_flush+0x38>
+  8015e3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8015e6:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8015ec:	eb 05                	jmp    8015f3 <dupq_flush+0x3d>
+  8015ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f6:	c9                   	leave
+  8015f7:	c3                   	ret
+
+008015f8 <pgfault>:
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	56                   	push   %esi
+  8015fc:	53                   	push   %ebx
+  8015fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801600:	8b 30                	mov    (%eax),%esi
+  801602:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801606:	0f 84 83 00 00 00    	je     80168f <pgfault+0x97>
+  80160c:	89 f0                	mov    %esi,%eax
+  80160e:	c1 e8 0c             	shr    $0xc,%eax
+  801611:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801618:	f6 c4 08             	test   $0x8,%ah
+  80161b:	0f 84 80 00 00 00    	je     8016a1 <pgfault+0xa9>
+  801621:	e8 b8 f6 ff ff       	call   800cde <sys_getenvid>
+  801626:	89 c3                	mov    %eax,%ebx
+  801628:	83 ec 04             	sub    $0x4,%esp
+  80162b:	6a 07                	push   $0x7
+  80162d:	68 00 f0 7f 00       	push   $0x7ff000
+  801632:	50                   	push   %eax
+  801633:	e8 10 f7 ff ff       	call   800d48 <sys_page_alloc>
+  801638:	83 c4 10             	add    $0x10,%esp
+  80163b:	85 c0                	test   %eax,%eax
+  80163d:	78 74                	js     8016b3 <pgfault+0xbb>
+  80163f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801645:	83 ec 04             	sub    $0x4,%esp
+  801648:	68 00 10 00 00       	push   $0x1000
+  80164d:	56                   	push   %esi
+  80164e:	68 00 f0 7f 00       	push   $0x7ff000
+  801653:	e8 40 f4 ff ff       	call   800a98 <memmove>
+  801658:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80165f:	56                   	push   %esi
+  801660:	53                   	push   %ebx
+  801661:	68 00 f0 7f 00       	push   $0x7ff000
+  801666:	53                   	push   %ebx
+  801667:	e8 1f f7 ff ff       	call   800d8b <sys_page_map>
+  80166c:	83 c4 20             	add    $0x20,%esp
+  80166f:	85 c0                	test   %eax,%eax
+  801671:	78 54                	js     8016c7 <pgfault+0xcf>
+  801673:	83 ec 08             	sub    $0x8,%esp
+  801676:	68 00 f0 7f 00       	push   $0x7ff000
+  80167b:	53                   	push   %ebx
+  80167c:	e8 99 f7 ff ff       	call   800e1a <sys_page_unmap>
+  801681:	83 c4 10             	add    $0x10,%esp
+  801684:	85 c0                	test   %eax,%eax
+  801686:	78 53                	js     8016db <pgfault+0xe3>
+  801688:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80168b:	5b                   	pop    %ebx
+  80168c:	5e                   	pop    %esi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+  80168f:	56                   	push   %esi
+  801690:	68 38 3b 80 00       	push   $0x803b38
+  801695:	6a 19                	push   $0x19
+  801697:	68 14 3c 80 00       	push   $0x803c14
+  80169c:	e8 a5 1b 00 00       	call   803246 <_panic>
+  8016a1:	56                   	push   %esi
+  8016a2:	68 6c 3b 80 00       	push   $0x803b6c
+  8016a7:	6a 1e                	push   $0x1e
+  8016a9:	68 14 3c 80 00       	push   $0x803c14
+  8016ae:	e8 93 1b 00 00       	call   803246 <_panic>
+  8016b3:	83 ec 04             	sub    $0x4,%esp
+  8016b6:	68 a0 3b 80 00       	push   $0x803ba0
+  8016bb:	6a 2e                	push   $0x2e
+  8016bd:	68 14 3c 80 00       	push   $0x803c14
+  8016c2:	e8 7f 1b 00 00       	call   803246 <_panic>
+  8016c7:	83 ec 04             	sub    $0x4,%esp
+  8016ca:	68 c4 3b 80 00       	push   $0x803bc4
+  8016cf:	6a 37                	push   $0x37
+  8016d1:	68 14 3c 80 00       	push   $0x803c14
+  8016d6:	e8 6b 1b 00 00       	call   803246 <_panic>
+  8016db:	83 ec 04             	sub    $0x4,%esp
+  8016de:	68 f0 3b 80 00       	push   $0x803bf0
+  8016e3:	6a 3c                	push   $0x3c
+  8016e5:	68 14 3c 80 00       	push   $0x803c14
+  8016ea:	e8 57 1b 00 00       	call   803246 <_panic>
+
+008016ef <dupq_begin>:
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	83 ec 0c             	sub    $0xc,%esp
+  8016f5:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8016fc:	00 00 00 
+  8016ff:	6a 07                	push   $0x7
+  801701:	68 00 00 40 00       	push   $0x400000
+  801706:	6a 00                	push   $0x0
+  801708:	e8 3b f6 ff ff       	call   800d48 <sys_page_alloc>
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+0080170f <dupq_map>:
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	83 ec 08             	sub    $0x8,%esp
+  801715:	81 3d 00 50 80 00 92 	cmpl   $0x92,0x805000
+  80171c:	00 00 00 
+  80171f:	74 46                	je     801767 <dupq_map+0x58>
+  801721:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  801727:	8d 42 01             	lea    0x1(%edx),%eax
+  80172a:	a3 00 50 80 00       	mov    %eax,0x805000
+  80172f:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801732:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801738:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  80173f:	00 00 00 
+  801742:	8b 55 08             	mov    0x8(%ebp),%edx
+  801745:	89 50 04             	mov    %edx,0x4(%eax)
+  801748:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80174b:	c1 e2 0c             	shl    $0xc,%edx
+  80174e:	89 50 08             	mov    %edx,0x8(%eax)
+  801751:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801754:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801757:	89 50 10             	mov    %edx,0x10(%eax)
+  80175a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80175d:	89 50 14             	mov    %edx,0x14(%eax)
+  801760:	b8 00 00 00 00       	mov    $0x0,%eax
+  801765:	c9                   	leave
+  801766:	c3                   	ret
+  801767:	e8 4a fe ff ff       	call   8015b6 <dupq_flush>
+  80176c:	85 c0                	test   %eax,%eax
+  80176e:	79 b1                	jns    801721 <dupq_map+0x12>
+  801770:	eb f3                	jmp    801765 <dupq_map+0x56>
+
+00801772 <dupq_end>:
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	53                   	push   %ebx
+  801776:	83 ec 04             	sub    $0x4,%esp
+  801779:	e8 38 fe ff ff       	call   8015b6 <dupq_flush>
+  80177e:	89 c3                	mov    %eax,%ebx
+  801780:	83 ec 08             	sub    $0x8,%esp
+  801783:	68 00 00 40 00       	push   $0x400000
+  801788:	6a 00                	push   $0x0
+  80178a:	e8 8b f6 ff ff       	call   800e1a <sys_page_unmap>
+  80178f:	89 d8                	mov    %ebx,%eax
+  801791:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801794:	c9                   	leave
+  801795:	c3                   	ret
+
+00801796 <fork>:
+  801796:	55                   	push   %ebp
+  801797:	89 e5                	mov    %esp,%ebp
+  801799:	53                   	push   %ebx
+  80179a:	83 ec 10             	sub    $0x10,%esp
+  80179d:	68 f8 15 80 00       	push   $0x8015f8
+  8017a2:	e8 e5 1a 00 00       	call   80328c <set_pgfault_handler>
+  8017a7:	83 c4 08             	add    $0x8,%esp
+  8017aa:	6a 01                	push   $0x1
+  8017ac:	6a 00                	push   $0x0
+  8017ae:	e8 4c f7 ff ff       	call   800eff <sys_env_set_cow>
+  8017b3:	e8 a4 f6 ff ff       	call   800e5c <sys_fork>
+  8017b8:	89 c3                	mov    %eax,%ebx
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	74 07                	je     8017c8 <fork+0x32>
+  8017c1:	89 d8                	mov    %ebx,%eax
+  8017c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017c6:	c9                   	leave
+  8017c7:	c3                   	ret
+  8017c8:	e8 11 f5 ff ff       	call   800cde <sys_getenvid>
+  8017cd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017d2:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8017d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017dd:	a3 14 50 80 00       	mov    %eax,0x805014
+  8017e2:	eb dd                	jmp    8017c1 <fork+0x2b>
+
+008017e4 <sfork>:
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	57                   	push   %edi
+  8017e8:	56                   	push   %esi
+  8017e9:	53                   	push   %ebx
+  8017ea:	83 ec 1c             	sub    $0x1c,%esp
+  8017ed:	e8 ec f4 ff ff       	call   800cde <sys_getenvid>
+  8017f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017f5:	83 ec 0c             	sub    $0xc,%esp
+  8017f8:	68 f8 15 80 00       	push   $0x8015f8
+  8017fd:	e8 8a 1a 00 00       	call   80328c <set_pgfault_handler>
+  801802:	b8 07 00 00 00       	mov    $0x7,%eax
+  801807:	cd 30                	int    $0x30
+  801809:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80180c:	83 c4 10             	add    $0x10,%esp
+  80180f:	85 c0                	test   %eax,%eax
+  801811:	0f 88 45 02 00 00    	js     801a5c <sfork+0x278>
+  801817:	89 c6                	mov    %eax,%esi
+  801819:	74 17                	je     801832 <sfork+0x4e>
+  80181b:	e8 cf fe ff ff       	call   8016ef <dupq_begin>
+  801820:	85 c0                	test   %eax,%eax
+  801822:	0f 88 40 02 00 00    	js     801a68 <sfork+0x284>
+  801828:	bf 02 00 00 00       	mov    $0x2,%edi
+  80182d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801830:	eb 39                	jmp    80186b <sfork+0x87>
+  801832:	e8 a7 f4 ff ff       	call   800cde <sys_getenvid>
+  801837:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80183c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801842:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801847:	a3 14 50 80 00       	mov    %eax,0x805014
+  80184c:	e9 23 01 00 00       	jmp    801974 <sfork+0x190>
+  801851:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801858:	a8 01                	test   $0x1,%al
+  80185a:	75 5b                	jne    8018b7 <sfork+0xd3>
+  80185c:	83 c7 01             	add    $0x1,%edi
+  80185f:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801865:	0f 84 40 01 00 00    	je     8019ab <sfork+0x1c7>
+  80186b:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801872:	a8 01                	test   $0x1,%al
+  801874:	74 db                	je     801851 <sfork+0x6d>
+  801876:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80187d:	a8 80                	test   $0x80,%al
+  80187f:	74 d0                	je     801851 <sfork+0x6d>
+  801881:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801888:	25 07 0e 00 00       	and    $0xe07,%eax
+  80188d:	0c 80                	or     $0x80,%al
+  80188f:	50                   	push   %eax
+  801890:	ff 75 e4             	push   -0x1c(%ebp)
+  801893:	89 f8                	mov    %edi,%eax
+  801895:	c1 e0 16             	shl    $0x16,%eax
+  801898:	c1 e8 0c             	shr    $0xc,%eax
+  80189b:	50                   	push   %eax
+  80189c:	ff 75 e0             	push   -0x20(%ebp)
+  80189f:	e8 6b fe ff ff       	call   80170f <dupq_map>
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  8018a7:	85 c0                	test   %eax,%eax
+  8018a9:	79 b1                	jns    80185c <sfork+0x78>
+  8018ab:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8018b2:	e9 bd 00 00 00       	jmp    801974 <sfork+0x190>
+  8018b7:	89 fe                	mov    %edi,%esi
+  8018b9:	c1 e6 16             	shl    $0x16,%esi
+  8018bc:	89 f0                	mov    %esi,%eax
+  8018be:	c1 e8 0c             	shr    $0xc,%eax
+  8018c1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8018c6:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8018c9:	eb 57                	jmp    801922 <sfork+0x13e>
+  8018cb:	e8 0e f4 ff ff       	call   800cde <sys_getenvid>
+  8018d0:	89 c7                	mov    %eax,%edi
+  8018d2:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  8018d7:	f6 c4 04             	test   $0x4,%ah
+  8018da:	0f 85 9f 00 00 00    	jne    80197f <sfork+0x19b>
+  8018e0:	a9 02 08 00 00       	test   $0x802,%eax
+  8018e5:	0f 85 c5 01 00 00    	jne    801ab0 <sfork+0x2cc>
+  8018eb:	6a 05                	push   $0x5
+  8018ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8018f0:	68 fd e7 0e 00       	push   $0xee7fd
+  8018f5:	57                   	push   %edi
+  8018f6:	e8 14 fe ff ff       	call   80170f <dupq_map>
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801904:	0f 84 91 00 00 00    	je     80199b <sfork+0x1b7>
+  80190a:	89 f0                	mov    %esi,%eax
+  80190c:	09 d8                	or     %ebx,%eax
+  80190e:	c1 e8 0c             	shr    $0xc,%eax
+  801911:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801917:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  80191c:	0f 84 81 00 00 00    	je     8019a3 <sfork+0x1bf>
+  801922:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801927:	74 a2                	je     8018cb <sfork+0xe7>
+  801929:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801930:	f6 c2 01             	test   $0x1,%dl
+  801933:	74 c9                	je     8018fe <sfork+0x11a>
+  801935:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80193c:	f6 c6 02             	test   $0x2,%dh
+  80193f:	75 bd                	jne    8018fe <sfork+0x11a>
+  801941:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801948:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80194f:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801955:	f7 d2                	not    %edx
+  801957:	21 ca                	and    %ecx,%edx
+  801959:	52                   	push   %edx
+  80195a:	ff 75 e4             	push   -0x1c(%ebp)
+  80195d:	50                   	push   %eax
+  80195e:	ff 75 e0             	push   -0x20(%ebp)
+  801961:	e8 a9 fd ff ff       	call   80170f <dupq_map>
+  801966:	83 c4 10             	add    $0x10,%esp
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	79 91                	jns    8018fe <sfork+0x11a>
+  80196d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801974:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801977:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80197a:	5b                   	pop    %ebx
+  80197b:	5e                   	pop    %esi
+  80197c:	5f                   	pop    %edi
+  80197d:	5d                   	pop    %ebp
+  80197e:	c3                   	ret
+  80197f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801984:	50                   	push   %eax
+  801985:	ff 75 e4             	push   -0x1c(%ebp)
+  801988:	68 fd e7 0e 00       	push   $0xee7fd
+  80198d:	57                   	push   %edi
+  80198e:	e8 7c fd ff ff       	call   80170f <dupq_map>
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	e9 63 ff ff ff       	jmp    8018fe <sfork+0x11a>
+  80199b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80199e:	e9 b9 fe ff ff       	jmp    80185c <sfork+0x78>
+  8019a3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8019a6:	e9 b1 fe ff ff       	jmp    80185c <sfork+0x78>
+  8019ab:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8019ae:	e8 bf fd ff ff       	call   801772 <dupq_end>
+  8019b3:	85 c0                	test   %eax,%eax
+  8019b5:	0f 88 b9 00 00 00    	js     801a74 <sfork+0x290>
+  8019bb:	83 ec 04             	sub    $0x4,%esp
+  8019be:	6a 07                	push   $0x7
+  8019c0:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019c5:	56                   	push   %esi
+  8019c6:	e8 7d f3 ff ff       	call   800d48 <sys_page_alloc>
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	0f 88 aa 00 00 00    	js     801a80 <sfork+0x29c>
+  8019d6:	83 ec 0c             	sub    $0xc,%esp
+  8019d9:	6a 07                	push   $0x7
+  8019db:	68 00 f0 7f 00       	push   $0x7ff000
+  8019e0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8019e3:	57                   	push   %edi
+  8019e4:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019e9:	56                   	push   %esi
+  8019ea:	e8 9c f3 ff ff       	call   800d8b <sys_page_map>
+  8019ef:	83 c4 20             	add    $0x20,%esp
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	0f 88 92 00 00 00    	js     801a8c <sfork+0x2a8>
+  8019fa:	83 ec 04             	sub    $0x4,%esp
+  8019fd:	68 00 10 00 00       	push   $0x1000
+  801a02:	68 00 f0 7f 00       	push   $0x7ff000
+  801a07:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a0c:	e8 87 f0 ff ff       	call   800a98 <memmove>
+  801a11:	83 c4 08             	add    $0x8,%esp
+  801a14:	68 00 f0 7f 00       	push   $0x7ff000
+  801a19:	57                   	push   %edi
+  801a1a:	e8 fb f3 ff ff       	call   800e1a <sys_page_unmap>
+  801a1f:	83 c4 10             	add    $0x10,%esp
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	78 72                	js     801a98 <sfork+0x2b4>
+  801a26:	83 ec 08             	sub    $0x8,%esp
+  801a29:	68 04 33 80 00       	push   $0x803304
+  801a2e:	56                   	push   %esi
+  801a2f:	e8 2d f5 ff ff       	call   800f61 <sys_env_set_pgfault_upcall>
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 69                	js     801aa4 <sfork+0x2c0>
+  801a3b:	83 ec 08             	sub    $0x8,%esp
+  801a3e:	6a 02                	push   $0x2
+  801a40:	56                   	push   %esi
+  801a41:	e8 35 f4 ff ff       	call   800e7b <sys_env_set_status>
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a50:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801a54:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a57:	e9 18 ff ff ff       	jmp    801974 <sfork+0x190>
+  801a5c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a63:	e9 0c ff ff ff       	jmp    801974 <sfork+0x190>
+  801a68:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a6f:	e9 00 ff ff ff       	jmp    801974 <sfork+0x190>
+  801a74:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a7b:	e9 f4 fe ff ff       	jmp    801974 <sfork+0x190>
+  801a80:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a87:	e9 e8 fe ff ff       	jmp    801974 <sfork+0x190>
+  801a8c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a93:	e9 dc fe ff ff       	jmp    801974 <sfork+0x190>
+  801a98:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a9f:	e9 d0 fe ff ff       	jmp    801974 <sfork+0x190>
+  801aa4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801aab:	e9 c4 fe ff ff       	jmp    801974 <sfork+0x190>
+  801ab0:	68 05 08 00 00       	push   $0x805
+  801ab5:	ff 75 e4             	push   -0x1c(%ebp)
+  801ab8:	68 fd e7 0e 00       	push   $0xee7fd
+  801abd:	57                   	push   %edi
+  801abe:	e8 4c fc ff ff       	call   80170f <dupq_map>
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	0f 88 30 fe ff ff    	js     8018fe <sfork+0x11a>
+  801ace:	68 05 08 00 00       	push   $0x805
+  801ad3:	57                   	push   %edi
+  801ad4:	68 fd e7 0e 00       	push   $0xee7fd
+  801ad9:	57                   	push   %edi
+  801ada:	e8 30 fc ff ff       	call   80170f <dupq_map>
+  801adf:	83 c4 10             	add    $0x10,%esp
+  801ae2:	e9 17 fe ff ff       	jmp    8018fe <sfork+0x11a>
+
+00801ae7 <fd2num>:
+  801ae7:	55                   	push   %ebp
+  801ae8:	89 e5                	mov    %esp,%ebp
+  801aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aed:	05 00 00 00 30       	add    $0x30000000,%eax
+  801af2:	c1 e8 0c             	shr    $0xc,%eax
+  801af5:	5d                   	pop    %ebp
+  801af6:	c3                   	ret
+
+00801af7 <fd2data>:
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afd:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b02:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b07:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801b0c:	5d                   	pop    %ebp
+  801b0d:	c3                   	ret
+
+00801b0e <fd_alloc>:
+  801b0e:	55                   	push   %ebp
+  801b0f:	89 e5                	mov    %esp,%ebp
+  801b11:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801b16:	89 c2                	mov    %eax,%edx
+  801b18:	c1 ea 16             	shr    $0x16,%edx
+  801b1b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b22:	f6 c2 01             	test   $0x1,%dl
+  801b25:	74 29                	je     801b50 <fd_alloc+0x42>
+  801b27:	89 c2                	mov    %eax,%edx
+  801b29:	c1 ea 0c             	shr    $0xc,%edx
+  801b2c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b33:	f6 c2 01             	test   $0x1,%dl
+  801b36:	74 18                	je     801b50 <fd_alloc+0x42>
+  801b38:	05 00 10 00 00       	add    $0x1000,%eax
+  801b3d:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801b42:	75 d2                	jne    801b16 <fd_alloc+0x8>
+  801b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b49:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b4e:	eb 05                	jmp    801b55 <fd_alloc+0x47>
+  801b50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b55:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b58:	89 02                	mov    %eax,(%edx)
+  801b5a:	89 c8                	mov    %ecx,%eax
+  801b5c:	5d                   	pop    %ebp
+  801b5d:	c3                   	ret
+
+00801b5e <fd_lookup>:
+  801b5e:	55                   	push   %ebp
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b64:	83 f8 1f             	cmp    $0x1f,%eax
+  801b67:	77 30                	ja     801b99 <fd_lookup+0x3b>
+  801b69:	c1 e0 0c             	shl    $0xc,%eax
+  801b6c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801b71:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b77:	f6 c2 01             	test   $0x1,%dl
+  801b7a:	74 24                	je     801ba0 <fd_lookup+0x42>
+  801b7c:	89 c2                	mov    %eax,%edx
+  801b7e:	c1 ea 0c             	shr    $0xc,%edx
+  801b81:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b88:	f6 c2 01             	test   $0x1,%dl
+  801b8b:	74 1a                	je     801ba7 <fd_lookup+0x49>
+  801b8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b90:	89 02                	mov    %eax,(%edx)
+  801b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b97:	5d                   	pop    %ebp
+  801b98:	c3                   	ret
+  801b99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b9e:	eb f7                	jmp    801b97 <fd_lookup+0x39>
+  801ba0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba5:	eb f0                	jmp    801b97 <fd_lookup+0x39>
+  801ba7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bac:	eb e9                	jmp    801b97 <fd_lookup+0x39>
+
+00801bae <dev_lookup>:
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	53                   	push   %ebx
+  801bb2:	83 ec 04             	sub    $0x4,%esp
+  801bb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bbd:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801bc2:	39 13                	cmp    %edx,(%ebx)
+  801bc4:	74 37                	je     801bfd <dev_lookup+0x4f>
+  801bc6:	83 c0 01             	add    $0x1,%eax
+  801bc9:	8b 1c 85 9c 3c 80 00 	mov    0x803c9c(,%eax,4),%ebx
+  801bd0:	85 db                	test   %ebx,%ebx
+  801bd2:	75 ee                	jne    801bc2 <dev_lookup+0x14>
+  801bd4:	a1 14 50 80 00       	mov    0x805014,%eax
+  801bd9:	8b 40 48             	mov    0x48(%eax),%eax
+  801bdc:	83 ec 04             	sub    $0x4,%esp
+  801bdf:	52                   	push   %edx
+  801be0:	50                   	push   %eax
+  801be1:	68 20 3c 80 00       	push   $0x803c20
+  801be6:	e8 06 e6 ff ff       	call   8001f1 <cprintf>
+  801beb:	83 c4 10             	add    $0x10,%esp
+  801bee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bf3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bf6:	89 1a                	mov    %ebx,(%edx)
+  801bf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfb:	c9                   	leave
+  801bfc:	c3                   	ret
+  801bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c02:	eb ef                	jmp    801bf3 <dev_lookup+0x45>
+
+00801c04 <fd_close>:
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	57                   	push   %edi
+  801c08:	56                   	push   %esi
+  801c09:	53                   	push   %ebx
+  801c0a:	83 ec 24             	sub    $0x24,%esp
+  801c0d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c10:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801c13:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c16:	50                   	push   %eax
+  801c17:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c1d:	c1 e8 0c             	shr    $0xc,%eax
+  801c20:	50                   	push   %eax
+  801c21:	e8 38 ff ff ff       	call   801b5e <fd_lookup>
+  801c26:	89 c3                	mov    %eax,%ebx
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 05                	js     801c34 <fd_close+0x30>
+  801c2f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c32:	74 0f                	je     801c43 <fd_close+0x3f>
+  801c34:	85 ff                	test   %edi,%edi
+  801c36:	0f 44 df             	cmove  %edi,%ebx
+  801c39:	89 d8                	mov    %ebx,%eax
+  801c3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3e:	5b                   	pop    %ebx
+  801c3f:	5e                   	pop    %esi
+  801c40:	5f                   	pop    %edi
+  801c41:	5d                   	pop    %ebp
+  801c42:	c3                   	ret
+  801c43:	83 ec 08             	sub    $0x8,%esp
+  801c46:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c49:	50                   	push   %eax
+  801c4a:	ff 36                	push   (%esi)
+  801c4c:	e8 5d ff ff ff       	call   801bae <dev_lookup>
+  801c51:	89 c3                	mov    %eax,%ebx
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	85 c0                	test   %eax,%eax
+  801c58:	78 1a                	js     801c74 <fd_close+0x70>
+  801c5a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c5d:	8b 40 10             	mov    0x10(%eax),%eax
+  801c60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	74 0b                	je     801c74 <fd_close+0x70>
+  801c69:	83 ec 0c             	sub    $0xc,%esp
+  801c6c:	56                   	push   %esi
+  801c6d:	ff d0                	call   *%eax
+  801c6f:	89 c3                	mov    %eax,%ebx
+  801c71:	83 c4 10             	add    $0x10,%esp
+  801c74:	83 ec 08             	sub    $0x8,%esp
+  801c77:	56                   	push   %esi
+  801c78:	6a 00                	push   $0x0
+  801c7a:	e8 9b f1 ff ff       	call   800e1a <sys_page_unmap>
+  801c7f:	83 c4 10             	add    $0x10,%esp
+  801c82:	eb b5                	jmp    801c39 <fd_close+0x35>
+
+00801c84 <close>:
+  801c84:	55                   	push   %ebp
+  801c85:	89 e5                	mov    %esp,%ebp
+  801c87:	83 ec 20             	sub    $0x20,%esp
+  801c8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8d:	50                   	push   %eax
+  801c8e:	ff 75 08             	push   0x8(%ebp)
+  801c91:	e8 c8 fe ff ff       	call   801b5e <fd_lookup>
+  801c96:	83 c4 10             	add    $0x10,%esp
+  801c99:	85 c0                	test   %eax,%eax
+  801c9b:	79 02                	jns    801c9f <close+0x1b>
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	6a 01                	push   $0x1
+  801ca4:	ff 75 f4             	push   -0xc(%ebp)
+  801ca7:	e8 58 ff ff ff       	call   801c04 <fd_close>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	eb ec                	jmp    801c9d <close+0x19>
+
+00801cb1 <close_all>:
+  801cb1:	55                   	push   %ebp
+  801cb2:	89 e5                	mov    %esp,%ebp
+  801cb4:	53                   	push   %ebx
+  801cb5:	83 ec 04             	sub    $0x4,%esp
+  801cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbd:	83 ec 0c             	sub    $0xc,%esp
+  801cc0:	53                   	push   %ebx
+  801cc1:	e8 be ff ff ff       	call   801c84 <close>
+  801cc6:	83 c3 01             	add    $0x1,%ebx
+  801cc9:	83 c4 10             	add    $0x10,%esp
+  801ccc:	83 fb 20             	cmp    $0x20,%ebx
+  801ccf:	75 ec                	jne    801cbd <close_all+0xc>
+  801cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd4:	c9                   	leave
+  801cd5:	c3                   	ret
+
+00801cd6 <dup>:
+  801cd6:	55                   	push   %ebp
+  801cd7:	89 e5                	mov    %esp,%ebp
+  801cd9:	57                   	push   %edi
+  801cda:	56                   	push   %esi
+  801cdb:	53                   	push   %ebx
+  801cdc:	83 ec 34             	sub    $0x34,%esp
+  801cdf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ce2:	50                   	push   %eax
+  801ce3:	ff 75 08             	push   0x8(%ebp)
+  801ce6:	e8 73 fe ff ff       	call   801b5e <fd_lookup>
+  801ceb:	89 c3                	mov    %eax,%ebx
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 7f                	js     801d73 <dup+0x9d>
+  801cf4:	83 ec 0c             	sub    $0xc,%esp
+  801cf7:	ff 75 0c             	push   0xc(%ebp)
+  801cfa:	e8 85 ff ff ff       	call   801c84 <close>
+  801cff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d02:	c1 e6 0c             	shl    $0xc,%esi
+  801d05:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801d0b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d0e:	89 3c 24             	mov    %edi,(%esp)
+  801d11:	e8 e1 fd ff ff       	call   801af7 <fd2data>
+  801d16:	89 c3                	mov    %eax,%ebx
+  801d18:	89 34 24             	mov    %esi,(%esp)
+  801d1b:	e8 d7 fd ff ff       	call   801af7 <fd2data>
+  801d20:	83 c4 10             	add    $0x10,%esp
+  801d23:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d26:	89 d8                	mov    %ebx,%eax
+  801d28:	c1 e8 16             	shr    $0x16,%eax
+  801d2b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d32:	a8 01                	test   $0x1,%al
+  801d34:	74 11                	je     801d47 <dup+0x71>
+  801d36:	89 d8                	mov    %ebx,%eax
+  801d38:	c1 e8 0c             	shr    $0xc,%eax
+  801d3b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d42:	f6 c2 01             	test   $0x1,%dl
+  801d45:	75 36                	jne    801d7d <dup+0xa7>
+  801d47:	89 f8                	mov    %edi,%eax
+  801d49:	c1 e8 0c             	shr    $0xc,%eax
+  801d4c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d53:	83 ec 0c             	sub    $0xc,%esp
+  801d56:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d5b:	50                   	push   %eax
+  801d5c:	56                   	push   %esi
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	57                   	push   %edi
+  801d60:	6a 00                	push   $0x0
+  801d62:	e8 24 f0 ff ff       	call   800d8b <sys_page_map>
+  801d67:	89 c3                	mov    %eax,%ebx
+  801d69:	83 c4 20             	add    $0x20,%esp
+  801d6c:	85 c0                	test   %eax,%eax
+  801d6e:	78 33                	js     801da3 <dup+0xcd>
+  801d70:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d73:	89 d8                	mov    %ebx,%eax
+  801d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d78:	5b                   	pop    %ebx
+  801d79:	5e                   	pop    %esi
+  801d7a:	5f                   	pop    %edi
+  801d7b:	5d                   	pop    %ebp
+  801d7c:	c3                   	ret
+  801d7d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d84:	83 ec 0c             	sub    $0xc,%esp
+  801d87:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d8c:	50                   	push   %eax
+  801d8d:	ff 75 d4             	push   -0x2c(%ebp)
+  801d90:	6a 00                	push   $0x0
+  801d92:	53                   	push   %ebx
+  801d93:	6a 00                	push   $0x0
+  801d95:	e8 f1 ef ff ff       	call   800d8b <sys_page_map>
+  801d9a:	89 c3                	mov    %eax,%ebx
+  801d9c:	83 c4 20             	add    $0x20,%esp
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	79 a4                	jns    801d47 <dup+0x71>
+  801da3:	83 ec 08             	sub    $0x8,%esp
+  801da6:	56                   	push   %esi
+  801da7:	6a 00                	push   $0x0
+  801da9:	e8 6c f0 ff ff       	call   800e1a <sys_page_unmap>
+  801dae:	83 c4 08             	add    $0x8,%esp
+  801db1:	ff 75 d4             	push   -0x2c(%ebp)
+  801db4:	6a 00                	push   $0x0
+  801db6:	e8 5f f0 ff ff       	call   800e1a <sys_page_unmap>
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	eb b3                	jmp    801d73 <dup+0x9d>
+
+00801dc0 <read>:
+  801dc0:	55                   	push   %ebp
+  801dc1:	89 e5                	mov    %esp,%ebp
+  801dc3:	56                   	push   %esi
+  801dc4:	53                   	push   %ebx
+  801dc5:	83 ec 18             	sub    $0x18,%esp
+  801dc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dcb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dce:	50                   	push   %eax
+  801dcf:	56                   	push   %esi
+  801dd0:	e8 89 fd ff ff       	call   801b5e <fd_lookup>
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	78 3c                	js     801e18 <read+0x58>
+  801ddc:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ddf:	83 ec 08             	sub    $0x8,%esp
+  801de2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de5:	50                   	push   %eax
+  801de6:	ff 33                	push   (%ebx)
+  801de8:	e8 c1 fd ff ff       	call   801bae <dev_lookup>
+  801ded:	83 c4 10             	add    $0x10,%esp
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	78 24                	js     801e18 <read+0x58>
+  801df4:	8b 43 08             	mov    0x8(%ebx),%eax
+  801df7:	83 e0 03             	and    $0x3,%eax
+  801dfa:	83 f8 01             	cmp    $0x1,%eax
+  801dfd:	74 20                	je     801e1f <read+0x5f>
+  801dff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e02:	8b 40 08             	mov    0x8(%eax),%eax
+  801e05:	85 c0                	test   %eax,%eax
+  801e07:	74 37                	je     801e40 <read+0x80>
+  801e09:	83 ec 04             	sub    $0x4,%esp
+  801e0c:	ff 75 10             	push   0x10(%ebp)
+  801e0f:	ff 75 0c             	push   0xc(%ebp)
+  801e12:	53                   	push   %ebx
+  801e13:	ff d0                	call   *%eax
+  801e15:	83 c4 10             	add    $0x10,%esp
+  801e18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1b:	5b                   	pop    %ebx
+  801e1c:	5e                   	pop    %esi
+  801e1d:	5d                   	pop    %ebp
+  801e1e:	c3                   	ret
+  801e1f:	a1 14 50 80 00       	mov    0x805014,%eax
+  801e24:	8b 40 48             	mov    0x48(%eax),%eax
+  801e27:	83 ec 04             	sub    $0x4,%esp
+  801e2a:	56                   	push   %esi
+  801e2b:	50                   	push   %eax
+  801e2c:	68 61 3c 80 00       	push   $0x803c61
+  801e31:	e8 bb e3 ff ff       	call   8001f1 <cprintf>
+  801e36:	83 c4 10             	add    $0x10,%esp
+  801e39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e3e:	eb d8                	jmp    801e18 <read+0x58>
+  801e40:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e45:	eb d1                	jmp    801e18 <read+0x58>
+
+00801e47 <readn>:
+  801e47:	55                   	push   %ebp
+  801e48:	89 e5                	mov    %esp,%ebp
+  801e4a:	57                   	push   %edi
+  801e4b:	56                   	push   %esi
+  801e4c:	53                   	push   %ebx
+  801e4d:	83 ec 0c             	sub    $0xc,%esp
+  801e50:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e53:	8b 75 10             	mov    0x10(%ebp),%esi
+  801e56:	85 f6                	test   %esi,%esi
+  801e58:	74 30                	je     801e8a <readn+0x43>
+  801e5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e64:	83 ec 04             	sub    $0x4,%esp
+  801e67:	89 f2                	mov    %esi,%edx
+  801e69:	29 c2                	sub    %eax,%edx
+  801e6b:	52                   	push   %edx
+  801e6c:	01 f8                	add    %edi,%eax
+  801e6e:	50                   	push   %eax
+  801e6f:	ff 75 08             	push   0x8(%ebp)
+  801e72:	e8 49 ff ff ff       	call   801dc0 <read>
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	78 15                	js     801e93 <readn+0x4c>
+  801e7e:	74 11                	je     801e91 <readn+0x4a>
+  801e80:	01 c3                	add    %eax,%ebx
+  801e82:	89 d8                	mov    %ebx,%eax
+  801e84:	39 f3                	cmp    %esi,%ebx
+  801e86:	72 dc                	jb     801e64 <readn+0x1d>
+  801e88:	eb 09                	jmp    801e93 <readn+0x4c>
+  801e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8f:	eb 02                	jmp    801e93 <readn+0x4c>
+  801e91:	89 d8                	mov    %ebx,%eax
+  801e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e96:	5b                   	pop    %ebx
+  801e97:	5e                   	pop    %esi
+  801e98:	5f                   	pop    %edi
+  801e99:	5d                   	pop    %ebp
+  801e9a:	c3                   	ret
+
+00801e9b <write>:
+  801e9b:	55                   	push   %ebp
+  801e9c:	89 e5                	mov    %esp,%ebp
+  801e9e:	56                   	push   %esi
+  801e9f:	53                   	push   %ebx
+  801ea0:	83 ec 18             	sub    $0x18,%esp
+  801ea3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ea6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ea9:	50                   	push   %eax
+  801eaa:	53                   	push   %ebx
+  801eab:	e8 ae fc ff ff       	call   801b5e <fd_lookup>
+  801eb0:	83 c4 10             	add    $0x10,%esp
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 37                	js     801eee <write+0x53>
+  801eb7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801eba:	83 ec 08             	sub    $0x8,%esp
+  801ebd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec0:	50                   	push   %eax
+  801ec1:	ff 36                	push   (%esi)
+  801ec3:	e8 e6 fc ff ff       	call   801bae <dev_lookup>
+  801ec8:	83 c4 10             	add    $0x10,%esp
+  801ecb:	85 c0                	test   %eax,%eax
+  801ecd:	78 1f                	js     801eee <write+0x53>
+  801ecf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ed3:	74 20                	je     801ef5 <write+0x5a>
+  801ed5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	74 37                	je     801f16 <write+0x7b>
+  801edf:	83 ec 04             	sub    $0x4,%esp
+  801ee2:	ff 75 10             	push   0x10(%ebp)
+  801ee5:	ff 75 0c             	push   0xc(%ebp)
+  801ee8:	56                   	push   %esi
+  801ee9:	ff d0                	call   *%eax
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef1:	5b                   	pop    %ebx
+  801ef2:	5e                   	pop    %esi
+  801ef3:	5d                   	pop    %ebp
+  801ef4:	c3                   	ret
+  801ef5:	a1 14 50 80 00       	mov    0x805014,%eax
+  801efa:	8b 40 48             	mov    0x48(%eax),%eax
+  801efd:	83 ec 04             	sub    $0x4,%esp
+  801f00:	53                   	push   %ebx
+  801f01:	50                   	push   %eax
+  801f02:	68 7d 3c 80 00       	push   $0x803c7d
+  801f07:	e8 e5 e2 ff ff       	call   8001f1 <cprintf>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  801f0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f14:	eb d8                	jmp    801eee <write+0x53>
+  801f16:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f1b:	eb d1                	jmp    801eee <write+0x53>
+
+00801f1d <seek>:
+  801f1d:	55                   	push   %ebp
+  801f1e:	89 e5                	mov    %esp,%ebp
+  801f20:	83 ec 20             	sub    $0x20,%esp
+  801f23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f26:	50                   	push   %eax
+  801f27:	ff 75 08             	push   0x8(%ebp)
+  801f2a:	e8 2f fc ff ff       	call   801b5e <fd_lookup>
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	78 0e                	js     801f44 <seek+0x27>
+  801f36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f3c:	89 50 04             	mov    %edx,0x4(%eax)
+  801f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+00801f46 <ftruncate>:
+  801f46:	55                   	push   %ebp
+  801f47:	89 e5                	mov    %esp,%ebp
+  801f49:	56                   	push   %esi
+  801f4a:	53                   	push   %ebx
+  801f4b:	83 ec 18             	sub    $0x18,%esp
+  801f4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f51:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f54:	50                   	push   %eax
+  801f55:	53                   	push   %ebx
+  801f56:	e8 03 fc ff ff       	call   801b5e <fd_lookup>
+  801f5b:	83 c4 10             	add    $0x10,%esp
+  801f5e:	85 c0                	test   %eax,%eax
+  801f60:	78 34                	js     801f96 <ftruncate+0x50>
+  801f62:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f65:	83 ec 08             	sub    $0x8,%esp
+  801f68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f6b:	50                   	push   %eax
+  801f6c:	ff 36                	push   (%esi)
+  801f6e:	e8 3b fc ff ff       	call   801bae <dev_lookup>
+  801f73:	83 c4 10             	add    $0x10,%esp
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	78 1c                	js     801f96 <ftruncate+0x50>
+  801f7a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f7e:	74 1d                	je     801f9d <ftruncate+0x57>
+  801f80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f83:	8b 40 18             	mov    0x18(%eax),%eax
+  801f86:	85 c0                	test   %eax,%eax
+  801f88:	74 34                	je     801fbe <ftruncate+0x78>
+  801f8a:	83 ec 08             	sub    $0x8,%esp
+  801f8d:	ff 75 0c             	push   0xc(%ebp)
+  801f90:	56                   	push   %esi
+  801f91:	ff d0                	call   *%eax
+  801f93:	83 c4 10             	add    $0x10,%esp
+  801f96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f99:	5b                   	pop    %ebx
+  801f9a:	5e                   	pop    %esi
+  801f9b:	5d                   	pop    %ebp
+  801f9c:	c3                   	ret
+  801f9d:	a1 14 50 80 00       	mov    0x805014,%eax
+  801fa2:	8b 40 48             	mov    0x48(%eax),%eax
+  801fa5:	83 ec 04             	sub    $0x4,%esp
+  801fa8:	53                   	push   %ebx
+  801fa9:	50                   	push   %eax
+  801faa:	68 40 3c 80 00       	push   $0x803c40
+  801faf:	e8 3d e2 ff ff       	call   8001f1 <cprintf>
+  801fb4:	83 c4 10             	add    $0x10,%esp
+  801fb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fbc:	eb d8                	jmp    801f96 <ftruncate+0x50>
+  801fbe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fc3:	eb d1                	jmp    801f96 <ftruncate+0x50>
+
+00801fc5 <fstat>:
+  801fc5:	55                   	push   %ebp
+  801fc6:	89 e5                	mov    %esp,%ebp
+  801fc8:	56                   	push   %esi
+  801fc9:	53                   	push   %ebx
+  801fca:	83 ec 18             	sub    $0x18,%esp
+  801fcd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fd0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fd3:	50                   	push   %eax
+  801fd4:	ff 75 08             	push   0x8(%ebp)
+  801fd7:	e8 82 fb ff ff       	call   801b5e <fd_lookup>
+  801fdc:	83 c4 10             	add    $0x10,%esp
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	78 49                	js     80202c <fstat+0x67>
+  801fe3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fe6:	83 ec 08             	sub    $0x8,%esp
+  801fe9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fec:	50                   	push   %eax
+  801fed:	ff 36                	push   (%esi)
+  801fef:	e8 ba fb ff ff       	call   801bae <dev_lookup>
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 31                	js     80202c <fstat+0x67>
+  801ffb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ffe:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802002:	74 2f                	je     802033 <fstat+0x6e>
+  802004:	c6 03 00             	movb   $0x0,(%ebx)
+  802007:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80200e:	00 00 00 
+  802011:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802018:	00 00 00 
+  80201b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802021:	83 ec 08             	sub    $0x8,%esp
+  802024:	53                   	push   %ebx
+  802025:	56                   	push   %esi
+  802026:	ff 50 14             	call   *0x14(%eax)
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202f:	5b                   	pop    %ebx
+  802030:	5e                   	pop    %esi
+  802031:	5d                   	pop    %ebp
+  802032:	c3                   	ret
+  802033:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802038:	eb f2                	jmp    80202c <fstat+0x67>
+
+0080203a <stat>:
+  80203a:	55                   	push   %ebp
+  80203b:	89 e5                	mov    %esp,%ebp
+  80203d:	56                   	push   %esi
+  80203e:	53                   	push   %ebx
+  80203f:	83 ec 08             	sub    $0x8,%esp
+  802042:	6a 00                	push   $0x0
+  802044:	ff 75 08             	push   0x8(%ebp)
+  802047:	e8 31 05 00 00       	call   80257d <open>
+  80204c:	89 c3                	mov    %eax,%ebx
+  80204e:	83 c4 10             	add    $0x10,%esp
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 1b                	js     802070 <stat+0x36>
+  802055:	83 ec 08             	sub    $0x8,%esp
+  802058:	ff 75 0c             	push   0xc(%ebp)
+  80205b:	50                   	push   %eax
+  80205c:	e8 64 ff ff ff       	call   801fc5 <fstat>
+  802061:	89 c6                	mov    %eax,%esi
+  802063:	89 1c 24             	mov    %ebx,(%esp)
+  802066:	e8 19 fc ff ff       	call   801c84 <close>
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	89 f3                	mov    %esi,%ebx
+  802070:	89 d8                	mov    %ebx,%eax
+  802072:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802075:	5b                   	pop    %ebx
+  802076:	5e                   	pop    %esi
+  802077:	5d                   	pop    %ebp
+  802078:	c3                   	ret
+
+00802079 <fsipc>:
+  802079:	55                   	push   %ebp
+  80207a:	89 e5                	mov    %esp,%ebp
+  80207c:	56                   	push   %esi
+  80207d:	53                   	push   %ebx
+  80207e:	89 c3                	mov    %eax,%ebx
+  802080:	89 d6                	mov    %edx,%esi
+  802082:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802089:	74 20                	je     8020ab <fsipc+0x32>
+  80208b:	83 ec 08             	sub    $0x8,%esp
+  80208e:	6a 00                	push   $0x0
+  802090:	56                   	push   %esi
+  802091:	6a 07                	push   $0x7
+  802093:	68 00 60 80 00       	push   $0x806000
+  802098:	53                   	push   %ebx
+  802099:	ff 35 0c 50 80 00    	push   0x80500c
+  80209f:	e8 43 13 00 00       	call   8033e7 <ipc_call>
+  8020a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a7:	5b                   	pop    %ebx
+  8020a8:	5e                   	pop    %esi
+  8020a9:	5d                   	pop    %ebp
+  8020aa:	c3                   	ret
+  8020ab:	83 ec 0c             	sub    $0xc,%esp
+  8020ae:	6a 02                	push   $0x2
+  8020b0:	e8 cd 14 00 00       	call   803582 <ipc_find_env>
+  8020b5:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  8020ba:	83 c4 10             	add    $0x10,%esp
+  8020bd:	eb cc                	jmp    80208b <fsipc+0x12>
+
+008020bf <devfile_trunc>:
+  8020bf:	55                   	push   %ebp
+  8020c0:	89 e5                	mov    %esp,%ebp
+  8020c2:	83 ec 08             	sub    $0x8,%esp
+  8020c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020cb:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d3:	a3 04 60 80 00       	mov    %eax,0x806004
+  8020d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020dd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020e2:	e8 92 ff ff ff       	call   802079 <fsipc>
+  8020e7:	c9                   	leave
+  8020e8:	c3                   	ret
+
+008020e9 <devfile_flush>:
+  8020e9:	55                   	push   %ebp
+  8020ea:	89 e5                	mov    %esp,%ebp
+  8020ec:	83 ec 08             	sub    $0x8,%esp
+  8020ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020f5:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  802104:	e8 70 ff ff ff       	call   802079 <fsipc>
+  802109:	c9                   	leave
+  80210a:	c3                   	ret
+
+0080210b <devfile_stat>:
+  80210b:	55                   	push   %ebp
+  80210c:	89 e5                	mov    %esp,%ebp
+  80210e:	53                   	push   %ebx
+  80210f:	83 ec 04             	sub    $0x4,%esp
+  802112:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802115:	8b 45 08             	mov    0x8(%ebp),%eax
+  802118:	8b 40 0c             	mov    0xc(%eax),%eax
+  80211b:	a3 00 60 80 00       	mov    %eax,0x806000
+  802120:	ba 00 00 00 00       	mov    $0x0,%edx
+  802125:	b8 07 00 00 00       	mov    $0x7,%eax
+  80212a:	e8 4a ff ff ff       	call   802079 <fsipc>
+  80212f:	85 c0                	test   %eax,%eax
+  802131:	78 2c                	js     80215f <devfile_stat+0x54>
+  802133:	83 ec 08             	sub    $0x8,%esp
+  802136:	68 00 60 80 00       	push   $0x806000
+  80213b:	53                   	push   %ebx
+  80213c:	e8 a7 e7 ff ff       	call   8008e8 <strcpy>
+  802141:	a1 80 60 80 00       	mov    0x806080,%eax
+  802146:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80214c:	a1 84 60 80 00       	mov    0x806084,%eax
+  802151:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+
+00802164 <fsring_rw>:
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	57                   	push   %edi
+  802168:	56                   	push   %esi
+  802169:	53                   	push   %ebx
+  80216a:	83 ec 2c             	sub    $0x2c,%esp
+  80216d:	89 c7                	mov    %eax,%edi
+  80216f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802172:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802175:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80217a:	a8 01                	test   $0x1,%al
+  80217c:	74 0d                	je     80218b <fsring_rw+0x27>
+  80217e:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802183:	a8 01                	test   $0x1,%al
+  802185:	0f 85 d5 00 00 00    	jne    802260 <fsring_rw+0xfc>
+  80218b:	a1 14 50 80 00       	mov    0x805014,%eax
+  802190:	8b 40 48             	mov    0x48(%eax),%eax
+  802193:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  802199:	0f 84 fc 00 00 00    	je     80229b <fsring_rw+0x137>
+  80219f:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8021a6:	0f 84 02 01 00 00    	je     8022ae <fsring_rw+0x14a>
+  8021ac:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8021b1:	83 ec 04             	sub    $0x4,%esp
+  8021b4:	68 07 02 00 00       	push   $0x207
+  8021b9:	53                   	push   %ebx
+  8021ba:	6a 00                	push   $0x0
+  8021bc:	e8 87 eb ff ff       	call   800d48 <sys_page_alloc>
+  8021c1:	83 c4 10             	add    $0x10,%esp
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	0f 88 f9 00 00 00    	js     8022c5 <fsring_rw+0x161>
+  8021cc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021d2:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8021d8:	75 d7                	jne    8021b1 <fsring_rw+0x4d>
+  8021da:	6a 0e                	push   $0xe
+  8021dc:	6a 0d                	push   $0xd
+  8021de:	ff 35 0c 50 80 00    	push   0x80500c
+  8021e4:	68 00 00 f0 cf       	push   $0xcff00000
+  8021e9:	e8 c4 0c 00 00       	call   802eb2 <ipcring_init>
+  8021ee:	83 c4 08             	add    $0x8,%esp
+  8021f1:	6a 00                	push   $0x0
+  8021f3:	6a 00                	push   $0x0
+  8021f5:	68 07 02 00 00       	push   $0x207
+  8021fa:	68 00 00 f0 cf       	push   $0xcff00000
+  8021ff:	6a 0b                	push   $0xb
+  802201:	ff 35 0c 50 80 00    	push   0x80500c
+  802207:	e8 db 11 00 00       	call   8033e7 <ipc_call>
+  80220c:	89 c6                	mov    %eax,%esi
+  80220e:	83 c4 20             	add    $0x20,%esp
+  802211:	85 c0                	test   %eax,%eax
+  802213:	0f 88 ac 00 00 00    	js     8022c5 <fsring_rw+0x161>
+  802219:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80221e:	89 d9                	mov    %ebx,%ecx
+  802220:	83 c3 01             	add    $0x1,%ebx
+  802223:	89 da                	mov    %ebx,%edx
+  802225:	c1 e2 0c             	shl    $0xc,%edx
+  802228:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80222e:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802234:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80223a:	83 ec 08             	sub    $0x8,%esp
+  80223d:	6a 00                	push   $0x0
+  80223f:	6a 00                	push   $0x0
+  802241:	68 07 02 00 00       	push   $0x207
+  802246:	50                   	push   %eax
+  802247:	6a 0c                	push   $0xc
+  802249:	ff 35 0c 50 80 00    	push   0x80500c
+  80224f:	e8 93 11 00 00       	call   8033e7 <ipc_call>
+  802254:	83 c4 20             	add    $0x20,%esp
+  802257:	85 c0                	test   %eax,%eax
+  802259:	78 6a                	js     8022c5 <fsring_rw+0x161>
+  80225b:	83 fb 08             	cmp    $0x8,%ebx
+  80225e:	75 be                	jne    80221e <fsring_rw+0xba>
+  802260:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802264:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802269:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80226e:	0f 45 c2             	cmovne %edx,%eax
+  802271:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802274:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80227b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802282:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802289:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228e:	be 00 00 00 00       	mov    $0x0,%esi
+  802293:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802296:	e9 4b 01 00 00       	jmp    8023e6 <fsring_rw+0x282>
+  80229b:	e8 72 ee ff ff       	call   801112 <sys_time_msec>
+  8022a0:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8022a6:	0f 89 f3 fe ff ff    	jns    80219f <fsring_rw+0x3b>
+  8022ac:	eb 54                	jmp    802302 <fsring_rw+0x19e>
+  8022ae:	83 ec 0c             	sub    $0xc,%esp
+  8022b1:	6a 02                	push   $0x2
+  8022b3:	e8 ca 12 00 00       	call   803582 <ipc_find_env>
+  8022b8:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  8022bd:	83 c4 10             	add    $0x10,%esp
+  8022c0:	e9 e7 fe ff ff       	jmp    8021ac <fsring_rw+0x48>
+  8022c5:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8022ca:	83 ec 08             	sub    $0x8,%esp
+  8022cd:	53                   	push   %ebx
+  8022ce:	6a 00                	push   $0x0
+  8022d0:	e8 45 eb ff ff       	call   800e1a <sys_page_unmap>
+  8022d5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022db:	83 c4 10             	add    $0x10,%esp
+  8022de:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8022e4:	75 e4                	jne    8022ca <fsring_rw+0x166>
+  8022e6:	e8 27 ee ff ff       	call   801112 <sys_time_msec>
+  8022eb:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8022f0:	a3 04 50 80 00       	mov    %eax,0x805004
+  8022f5:	a1 14 50 80 00       	mov    0x805014,%eax
+  8022fa:	8b 40 48             	mov    0x48(%eax),%eax
+  8022fd:	a3 08 50 80 00       	mov    %eax,0x805008
+  802302:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802309:	e9 7a 01 00 00       	jmp    802488 <fsring_rw+0x324>
+  80230e:	8b 57 0c             	mov    0xc(%edi),%edx
+  802311:	89 10                	mov    %edx,(%eax)
+  802313:	89 58 04             	mov    %ebx,0x4(%eax)
+  802316:	89 f2                	mov    %esi,%edx
+  802318:	03 57 04             	add    0x4(%edi),%edx
+  80231b:	89 50 08             	mov    %edx,0x8(%eax)
+  80231e:	83 ec 04             	sub    $0x4,%esp
+  802321:	53                   	push   %ebx
+  802322:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802325:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802328:	52                   	push   %edx
+  802329:	83 c0 0c             	add    $0xc,%eax
+  80232c:	50                   	push   %eax
+  80232d:	e8 66 e7 ff ff       	call   800a98 <memmove>
+  802332:	83 c4 10             	add    $0x10,%esp
+  802335:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802338:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80233b:	89 08                	mov    %ecx,(%eax)
+  80233d:	83 ec 0c             	sub    $0xc,%esp
+  802340:	68 00 00 f0 cf       	push   $0xcff00000
+  802345:	e8 c6 0b 00 00       	call   802f10 <ipcring_req_push>
+  80234a:	01 de                	add    %ebx,%esi
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802352:	73 4c                	jae    8023a0 <fsring_rw+0x23c>
+  802354:	83 ec 0c             	sub    $0xc,%esp
+  802357:	68 00 00 f0 cf       	push   $0xcff00000
+  80235c:	e8 89 0b 00 00       	call   802eea <ipcring_req_slot>
+  802361:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802364:	83 c4 10             	add    $0x10,%esp
+  802367:	85 c0                	test   %eax,%eax
+  802369:	74 35                	je     8023a0 <fsring_rw+0x23c>
+  80236b:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802370:	83 e0 07             	and    $0x7,%eax
+  802373:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802378:	c1 e0 0c             	shl    $0xc,%eax
+  80237b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80237e:	29 f3                	sub    %esi,%ebx
+  802380:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802383:	39 cb                	cmp    %ecx,%ebx
+  802385:	0f 47 d9             	cmova  %ecx,%ebx
+  802388:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80238c:	75 80                	jne    80230e <fsring_rw+0x1aa>
+  80238e:	8b 57 0c             	mov    0xc(%edi),%edx
+  802391:	89 10                	mov    %edx,(%eax)
+  802393:	89 58 04             	mov    %ebx,0x4(%eax)
+  802396:	89 f2                	mov    %esi,%edx
+  802398:	03 57 04             	add    0x4(%edi),%edx
+  80239b:	89 50 08             	mov    %edx,0x8(%eax)
+  80239e:	eb 95                	jmp    802335 <fsring_rw+0x1d1>
+  8023a0:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8023a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023a8:	83 ec 0c             	sub    $0xc,%esp
+  8023ab:	68 00 00 f0 cf       	push   $0xcff00000
+  8023b0:	e8 94 0b 00 00       	call   802f49 <ipcring_rsp_wait>
+  8023b5:	8b 58 04             	mov    0x4(%eax),%ebx
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8023bf:	75 45                	jne    802406 <fsring_rw+0x2a2>
+  8023c1:	85 db                	test   %ebx,%ebx
+  8023c3:	79 41                	jns    802406 <fsring_rw+0x2a2>
+  8023c5:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8023c8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8023cf:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8023d6:	83 ec 0c             	sub    $0xc,%esp
+  8023d9:	68 00 00 f0 cf       	push   $0xcff00000
+  8023de:	e8 cc 0b 00 00       	call   802faf <ipcring_rsp_pop>
+  8023e3:	83 c4 10             	add    $0x10,%esp
+  8023e6:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8023ec:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8023f1:	39 c2                	cmp    %eax,%edx
+  8023f3:	74 75                	je     80246a <fsring_rw+0x306>
+  8023f5:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8023f9:	75 a5                	jne    8023a0 <fsring_rw+0x23c>
+  8023fb:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8023fe:	0f 82 50 ff ff ff    	jb     802354 <fsring_rw+0x1f0>
+  802404:	eb 9a                	jmp    8023a0 <fsring_rw+0x23c>
+  802406:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80240a:	75 ca                	jne    8023d6 <fsring_rw+0x272>
+  80240c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802410:	74 31                	je     802443 <fsring_rw+0x2df>
+  802412:	8b 45 08             	mov    0x8(%ebp),%eax
+  802415:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802418:	29 c8                	sub    %ecx,%eax
+  80241a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80241d:	39 d0                	cmp    %edx,%eax
+  80241f:	0f 47 c2             	cmova  %edx,%eax
+  802422:	39 d8                	cmp    %ebx,%eax
+  802424:	ba 01 00 00 00       	mov    $0x1,%edx
+  802429:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80242d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802430:	b8 01 00 00 00       	mov    $0x1,%eax
+  802435:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802439:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80243c:	01 d9                	add    %ebx,%ecx
+  80243e:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802441:	eb 93                	jmp    8023d6 <fsring_rw+0x272>
+  802443:	83 ec 04             	sub    $0x4,%esp
+  802446:	53                   	push   %ebx
+  802447:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80244a:	83 e0 07             	and    $0x7,%eax
+  80244d:	c1 e0 0c             	shl    $0xc,%eax
+  802450:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802456:	50                   	push   %eax
+  802457:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80245a:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80245d:	01 c8                	add    %ecx,%eax
+  80245f:	50                   	push   %eax
+  802460:	e8 33 e6 ff ff       	call   800a98 <memmove>
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	eb a8                	jmp    802412 <fsring_rw+0x2ae>
+  80246a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80246e:	75 09                	jne    802479 <fsring_rw+0x315>
+  802470:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802473:	0f 82 db fe ff ff    	jb     802354 <fsring_rw+0x1f0>
+  802479:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80247c:	01 57 04             	add    %edx,0x4(%edi)
+  80247f:	85 d2                	test   %edx,%edx
+  802481:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802485:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802488:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80248b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248e:	5b                   	pop    %ebx
+  80248f:	5e                   	pop    %esi
+  802490:	5f                   	pop    %edi
+  802491:	5d                   	pop    %ebp
+  802492:	c3                   	ret
+
+00802493 <devfile_write>:
+  802493:	55                   	push   %ebp
+  802494:	89 e5                	mov    %esp,%ebp
+  802496:	57                   	push   %edi
+  802497:	56                   	push   %esi
+  802498:	53                   	push   %ebx
+  802499:	83 ec 0c             	sub    $0xc,%esp
+  80249c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80249f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8024a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024a5:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8024ab:	76 1a                	jbe    8024c7 <devfile_write+0x34>
+  8024ad:	83 ec 0c             	sub    $0xc,%esp
+  8024b0:	53                   	push   %ebx
+  8024b1:	89 f1                	mov    %esi,%ecx
+  8024b3:	ba 06 00 00 00       	mov    $0x6,%edx
+  8024b8:	89 f8                	mov    %edi,%eax
+  8024ba:	e8 a5 fc ff ff       	call   802164 <fsring_rw>
+  8024bf:	83 c4 10             	add    $0x10,%esp
+  8024c2:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8024c5:	75 39                	jne    802500 <devfile_write+0x6d>
+  8024c7:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8024cc:	39 c3                	cmp    %eax,%ebx
+  8024ce:	0f 47 d8             	cmova  %eax,%ebx
+  8024d1:	8b 47 0c             	mov    0xc(%edi),%eax
+  8024d4:	a3 00 60 80 00       	mov    %eax,0x806000
+  8024d9:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8024df:	83 ec 04             	sub    $0x4,%esp
+  8024e2:	53                   	push   %ebx
+  8024e3:	56                   	push   %esi
+  8024e4:	68 08 60 80 00       	push   $0x806008
+  8024e9:	e8 aa e5 ff ff       	call   800a98 <memmove>
+  8024ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024f8:	e8 7c fb ff ff       	call   802079 <fsipc>
+  8024fd:	83 c4 10             	add    $0x10,%esp
+  802500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802503:	5b                   	pop    %ebx
+  802504:	5e                   	pop    %esi
+  802505:	5f                   	pop    %edi
+  802506:	5d                   	pop    %ebp
+  802507:	c3                   	ret
+
+00802508 <devfile_read>:
+  802508:	55                   	push   %ebp
+  802509:	89 e5                	mov    %esp,%ebp
+  80250b:	57                   	push   %edi
+  80250c:	56                   	push   %esi
+  80250d:	53                   	push   %ebx
+  80250e:	83 ec 0c             	sub    $0xc,%esp
+  802511:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802514:	8b 75 10             	mov    0x10(%ebp),%esi
+  802517:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80251d:	76 1d                	jbe    80253c <devfile_read+0x34>
+  80251f:	83 ec 0c             	sub    $0xc,%esp
+  802522:	56                   	push   %esi
+  802523:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802526:	ba 05 00 00 00       	mov    $0x5,%edx
+  80252b:	89 f8                	mov    %edi,%eax
+  80252d:	e8 32 fc ff ff       	call   802164 <fsring_rw>
+  802532:	89 c3                	mov    %eax,%ebx
+  802534:	83 c4 10             	add    $0x10,%esp
+  802537:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80253a:	75 37                	jne    802573 <devfile_read+0x6b>
+  80253c:	8b 47 0c             	mov    0xc(%edi),%eax
+  80253f:	a3 00 60 80 00       	mov    %eax,0x806000
+  802544:	89 35 04 60 80 00    	mov    %esi,0x806004
+  80254a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802554:	e8 20 fb ff ff       	call   802079 <fsipc>
+  802559:	89 c3                	mov    %eax,%ebx
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	78 14                	js     802573 <devfile_read+0x6b>
+  80255f:	83 ec 04             	sub    $0x4,%esp
+  802562:	50                   	push   %eax
+  802563:	68 00 60 80 00       	push   $0x806000
+  802568:	ff 75 0c             	push   0xc(%ebp)
+  80256b:	e8 28 e5 ff ff       	call   800a98 <memmove>
+  802570:	83 c4 10             	add    $0x10,%esp
+  802573:	89 d8                	mov    %ebx,%eax
+  802575:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802578:	5b                   	pop    %ebx
+  802579:	5e                   	pop    %esi
+  80257a:	5f                   	pop    %edi
+  80257b:	5d                   	pop    %ebp
+  80257c:	c3                   	ret
+
+0080257d <open>:
+  80257d:	55                   	push   %ebp
+  80257e:	89 e5                	mov    %esp,%ebp
+  802580:	56                   	push   %esi
+  802581:	53                   	push   %ebx
+  802582:	83 ec 1c             	sub    $0x1c,%esp
+  802585:	8b 75 08             	mov    0x8(%ebp),%esi
+  802588:	56                   	push   %esi
+  802589:	e8 0e e3 ff ff       	call   80089c <strlen>
+  80258e:	83 c4 10             	add    $0x10,%esp
+  802591:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802596:	7f 6c                	jg     802604 <open+0x87>
+  802598:	83 ec 0c             	sub    $0xc,%esp
+  80259b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80259e:	50                   	push   %eax
+  80259f:	e8 6a f5 ff ff       	call   801b0e <fd_alloc>
+  8025a4:	89 c3                	mov    %eax,%ebx
+  8025a6:	83 c4 10             	add    $0x10,%esp
+  8025a9:	85 c0                	test   %eax,%eax
+  8025ab:	78 3c                	js     8025e9 <open+0x6c>
+  8025ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025b0:	a3 00 64 80 00       	mov    %eax,0x806400
+  8025b5:	83 ec 08             	sub    $0x8,%esp
+  8025b8:	56                   	push   %esi
+  8025b9:	68 00 60 80 00       	push   $0x806000
+  8025be:	e8 25 e3 ff ff       	call   8008e8 <strcpy>
+  8025c3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025cb:	e8 a9 fa ff ff       	call   802079 <fsipc>
+  8025d0:	89 c3                	mov    %eax,%ebx
+  8025d2:	83 c4 10             	add    $0x10,%esp
+  8025d5:	85 c0                	test   %eax,%eax
+  8025d7:	78 19                	js     8025f2 <open+0x75>
+  8025d9:	83 ec 0c             	sub    $0xc,%esp
+  8025dc:	ff 75 f4             	push   -0xc(%ebp)
+  8025df:	e8 03 f5 ff ff       	call   801ae7 <fd2num>
+  8025e4:	89 c3                	mov    %eax,%ebx
+  8025e6:	83 c4 10             	add    $0x10,%esp
+  8025e9:	89 d8                	mov    %ebx,%eax
+  8025eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ee:	5b                   	pop    %ebx
+  8025ef:	5e                   	pop    %esi
+  8025f0:	5d                   	pop    %ebp
+  8025f1:	c3                   	ret
+  8025f2:	83 ec 08             	sub    $0x8,%esp
+  8025f5:	6a 00                	push   $0x0
+  8025f7:	ff 75 f4             	push   -0xc(%ebp)
+  8025fa:	e8 05 f6 ff ff       	call   801c04 <fd_close>
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	eb e5                	jmp    8025e9 <open+0x6c>
+  802604:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802609:	eb de                	jmp    8025e9 <open+0x6c>
+
+0080260b <file_image>:
+  80260b:	55                   	push   %ebp
+  80260c:	89 e5                	mov    %esp,%ebp
+  80260e:	53                   	push   %ebx
+  80260f:	83 ec 1c             	sub    $0x1c,%esp
+  802612:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802615:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802618:	50                   	push   %eax
+  802619:	ff 75 08             	push   0x8(%ebp)
+  80261c:	e8 3d f5 ff ff       	call   801b5e <fd_lookup>
+  802621:	83 c4 10             	add    $0x10,%esp
+  802624:	85 c0                	test   %eax,%eax
+  802626:	78 58                	js     802680 <file_image+0x75>
+  802628:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80262b:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802631:	39 08                	cmp    %ecx,(%eax)
+  802633:	75 50                	jne    802685 <file_image+0x7a>
+  802635:	83 fb 04             	cmp    $0x4,%ebx
+  802638:	77 52                	ja     80268c <file_image+0x81>
+  80263a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80263d:	a3 00 60 80 00       	mov    %eax,0x806000
+  802642:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802648:	83 ec 04             	sub    $0x4,%esp
+  80264b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80264e:	c1 e0 02             	shl    $0x2,%eax
+  802651:	50                   	push   %eax
+  802652:	ff 75 0c             	push   0xc(%ebp)
+  802655:	68 08 60 80 00       	push   $0x806008
+  80265a:	e8 39 e4 ff ff       	call   800a98 <memmove>
+  80265f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802664:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802669:	e8 0b fa ff ff       	call   802079 <fsipc>
+  80266e:	83 c4 10             	add    $0x10,%esp
+  802671:	85 c0                	test   %eax,%eax
+  802673:	78 0b                	js     802680 <file_image+0x75>
+  802675:	8b 55 14             	mov    0x14(%ebp),%edx
+  802678:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  80267e:	89 0a                	mov    %ecx,(%edx)
+  802680:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802683:	c9                   	leave
+  802684:	c3                   	ret
+  802685:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80268a:	eb f4                	jmp    802680 <file_image+0x75>
+  80268c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802691:	eb ed                	jmp    802680 <file_image+0x75>
+
+00802693 <remove>:
+  802693:	55                   	push   %ebp
+  802694:	89 e5                	mov    %esp,%ebp
+  802696:	53                   	push   %ebx
+  802697:	83 ec 10             	sub    $0x10,%esp
+  80269a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80269d:	53                   	push   %ebx
+  80269e:	e8 f9 e1 ff ff       	call   80089c <strlen>
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026ab:	7f 25                	jg     8026d2 <remove+0x3f>
+  8026ad:	83 ec 08             	sub    $0x8,%esp
+  8026b0:	53                   	push   %ebx
+  8026b1:	68 00 60 80 00       	push   $0x806000
+  8026b6:	e8 2d e2 ff ff       	call   8008e8 <strcpy>
+  8026bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026c5:	e8 af f9 ff ff       	call   802079 <fsipc>
+  8026ca:	83 c4 10             	add    $0x10,%esp
+  8026cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+  8026d2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026d7:	eb f4                	jmp    8026cd <remove+0x3a>
+
+008026d9 <sync>:
+  8026d9:	55                   	push   %ebp
+  8026da:	89 e5                	mov    %esp,%ebp
+  8026dc:	83 ec 08             	sub    $0x8,%esp
+  8026df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026e9:	e8 8b f9 ff ff       	call   802079 <fsipc>
+  8026ee:	c9                   	leave
+  8026ef:	c3                   	ret
+
+008026f0 <devsock_stat>:
+  8026f0:	55                   	push   %ebp
+  8026f1:	89 e5                	mov    %esp,%ebp
+  8026f3:	83 ec 10             	sub    $0x10,%esp
+  8026f6:	68 b0 3c 80 00       	push   $0x803cb0
+  8026fb:	ff 75 0c             	push   0xc(%ebp)
+  8026fe:	e8 e5 e1 ff ff       	call   8008e8 <strcpy>
+  802703:	b8 00 00 00 00       	mov    $0x0,%eax
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+
+0080270a <devsock_close>:
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	53                   	push   %ebx
+  80270e:	83 ec 10             	sub    $0x10,%esp
+  802711:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802714:	53                   	push   %ebx
+  802715:	e8 82 0e 00 00       	call   80359c <pageref>
+  80271a:	89 c2                	mov    %eax,%edx
+  80271c:	83 c4 10             	add    $0x10,%esp
+  80271f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802724:	83 fa 01             	cmp    $0x1,%edx
+  802727:	74 05                	je     80272e <devsock_close+0x24>
+  802729:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272c:	c9                   	leave
+  80272d:	c3                   	ret
+  80272e:	83 ec 0c             	sub    $0xc,%esp
+  802731:	ff 73 0c             	push   0xc(%ebx)
+  802734:	e8 aa 02 00 00       	call   8029e3 <nsipc_close>
+  802739:	83 c4 10             	add    $0x10,%esp
+  80273c:	eb eb                	jmp    802729 <devsock_close+0x1f>
+
+0080273e <devsock_write>:
+  80273e:	55                   	push   %ebp
+  80273f:	89 e5                	mov    %esp,%ebp
+  802741:	83 ec 08             	sub    $0x8,%esp
+  802744:	6a 00                	push   $0x0
+  802746:	ff 75 10             	push   0x10(%ebp)
+  802749:	ff 75 0c             	push   0xc(%ebp)
+  80274c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274f:	ff 70 0c             	push   0xc(%eax)
+  802752:	e8 6c 03 00 00       	call   802ac3 <nsipc_send>
+  802757:	c9                   	leave
+  802758:	c3                   	ret
+
+00802759 <devsock_read>:
+  802759:	55                   	push   %ebp
+  80275a:	89 e5                	mov    %esp,%ebp
+  80275c:	83 ec 08             	sub    $0x8,%esp
+  80275f:	6a 00                	push   $0x0
+  802761:	ff 75 10             	push   0x10(%ebp)
+  802764:	ff 75 0c             	push   0xc(%ebp)
+  802767:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276a:	ff 70 0c             	push   0xc(%eax)
+  80276d:	e8 e2 02 00 00       	call   802a54 <nsipc_recv>
+  802772:	c9                   	leave
+  802773:	c3                   	ret
+
+00802774 <fd2sockid>:
+  802774:	55                   	push   %ebp
+  802775:	89 e5                	mov    %esp,%ebp
+  802777:	83 ec 20             	sub    $0x20,%esp
+  80277a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80277d:	52                   	push   %edx
+  80277e:	50                   	push   %eax
+  80277f:	e8 da f3 ff ff       	call   801b5e <fd_lookup>
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	78 10                	js     80279b <fd2sockid+0x27>
+  80278b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80278e:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802794:	39 08                	cmp    %ecx,(%eax)
+  802796:	75 05                	jne    80279d <fd2sockid+0x29>
+  802798:	8b 40 0c             	mov    0xc(%eax),%eax
+  80279b:	c9                   	leave
+  80279c:	c3                   	ret
+  80279d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027a2:	eb f7                	jmp    80279b <fd2sockid+0x27>
+
+008027a4 <alloc_sockfd>:
+  8027a4:	55                   	push   %ebp
+  8027a5:	89 e5                	mov    %esp,%ebp
+  8027a7:	56                   	push   %esi
+  8027a8:	53                   	push   %ebx
+  8027a9:	83 ec 1c             	sub    $0x1c,%esp
+  8027ac:	89 c6                	mov    %eax,%esi
+  8027ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027b1:	50                   	push   %eax
+  8027b2:	e8 57 f3 ff ff       	call   801b0e <fd_alloc>
+  8027b7:	89 c3                	mov    %eax,%ebx
+  8027b9:	83 c4 10             	add    $0x10,%esp
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	78 43                	js     802803 <alloc_sockfd+0x5f>
+  8027c0:	83 ec 04             	sub    $0x4,%esp
+  8027c3:	68 07 04 00 00       	push   $0x407
+  8027c8:	ff 75 f4             	push   -0xc(%ebp)
+  8027cb:	6a 00                	push   $0x0
+  8027cd:	e8 76 e5 ff ff       	call   800d48 <sys_page_alloc>
+  8027d2:	89 c3                	mov    %eax,%ebx
+  8027d4:	83 c4 10             	add    $0x10,%esp
+  8027d7:	85 c0                	test   %eax,%eax
+  8027d9:	78 28                	js     802803 <alloc_sockfd+0x5f>
+  8027db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027de:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8027e4:	89 10                	mov    %edx,(%eax)
+  8027e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027e9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8027f0:	89 70 0c             	mov    %esi,0xc(%eax)
+  8027f3:	83 ec 0c             	sub    $0xc,%esp
+  8027f6:	50                   	push   %eax
+  8027f7:	e8 eb f2 ff ff       	call   801ae7 <fd2num>
+  8027fc:	89 c3                	mov    %eax,%ebx
+  8027fe:	83 c4 10             	add    $0x10,%esp
+  802801:	eb 0c                	jmp    80280f <alloc_sockfd+0x6b>
+  802803:	83 ec 0c             	sub    $0xc,%esp
+  802806:	56                   	push   %esi
+  802807:	e8 d7 01 00 00       	call   8029e3 <nsipc_close>
+  80280c:	83 c4 10             	add    $0x10,%esp
+  80280f:	89 d8                	mov    %ebx,%eax
+  802811:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802814:	5b                   	pop    %ebx
+  802815:	5e                   	pop    %esi
+  802816:	5d                   	pop    %ebp
+  802817:	c3                   	ret
+
+00802818 <accept>:
+  802818:	55                   	push   %ebp
+  802819:	89 e5                	mov    %esp,%ebp
+  80281b:	83 ec 08             	sub    $0x8,%esp
+  80281e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802821:	e8 4e ff ff ff       	call   802774 <fd2sockid>
+  802826:	85 c0                	test   %eax,%eax
+  802828:	78 1b                	js     802845 <accept+0x2d>
+  80282a:	83 ec 04             	sub    $0x4,%esp
+  80282d:	ff 75 10             	push   0x10(%ebp)
+  802830:	ff 75 0c             	push   0xc(%ebp)
+  802833:	50                   	push   %eax
+  802834:	e8 07 01 00 00       	call   802940 <nsipc_accept>
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	85 c0                	test   %eax,%eax
+  80283e:	78 05                	js     802845 <accept+0x2d>
+  802840:	e8 5f ff ff ff       	call   8027a4 <alloc_sockfd>
+  802845:	c9                   	leave
+  802846:	c3                   	ret
+
+00802847 <bind>:
+  802847:	55                   	push   %ebp
+  802848:	89 e5                	mov    %esp,%ebp
+  80284a:	83 ec 08             	sub    $0x8,%esp
+  80284d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802850:	e8 1f ff ff ff       	call   802774 <fd2sockid>
+  802855:	85 c0                	test   %eax,%eax
+  802857:	78 12                	js     80286b <bind+0x24>
+  802859:	83 ec 04             	sub    $0x4,%esp
+  80285c:	ff 75 10             	push   0x10(%ebp)
+  80285f:	ff 75 0c             	push   0xc(%ebp)
+  802862:	50                   	push   %eax
+  802863:	e8 24 01 00 00       	call   80298c <nsipc_bind>
+  802868:	83 c4 10             	add    $0x10,%esp
+  80286b:	c9                   	leave
+  80286c:	c3                   	ret
+
+0080286d <shutdown>:
+  80286d:	55                   	push   %ebp
+  80286e:	89 e5                	mov    %esp,%ebp
+  802870:	83 ec 08             	sub    $0x8,%esp
+  802873:	8b 45 08             	mov    0x8(%ebp),%eax
+  802876:	e8 f9 fe ff ff       	call   802774 <fd2sockid>
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	78 0f                	js     80288e <shutdown+0x21>
+  80287f:	83 ec 08             	sub    $0x8,%esp
+  802882:	ff 75 0c             	push   0xc(%ebp)
+  802885:	50                   	push   %eax
+  802886:	e8 36 01 00 00       	call   8029c1 <nsipc_shutdown>
+  80288b:	83 c4 10             	add    $0x10,%esp
+  80288e:	c9                   	leave
+  80288f:	c3                   	ret
+
+00802890 <connect>:
+  802890:	55                   	push   %ebp
+  802891:	89 e5                	mov    %esp,%ebp
+  802893:	83 ec 08             	sub    $0x8,%esp
+  802896:	8b 45 08             	mov    0x8(%ebp),%eax
+  802899:	e8 d6 fe ff ff       	call   802774 <fd2sockid>
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	78 12                	js     8028b4 <connect+0x24>
+  8028a2:	83 ec 04             	sub    $0x4,%esp
+  8028a5:	ff 75 10             	push   0x10(%ebp)
+  8028a8:	ff 75 0c             	push   0xc(%ebp)
+  8028ab:	50                   	push   %eax
+  8028ac:	e8 4c 01 00 00       	call   8029fd <nsipc_connect>
+  8028b1:	83 c4 10             	add    $0x10,%esp
+  8028b4:	c9                   	leave
+  8028b5:	c3                   	ret
+
+008028b6 <listen>:
+  8028b6:	55                   	push   %ebp
+  8028b7:	89 e5                	mov    %esp,%ebp
+  8028b9:	83 ec 08             	sub    $0x8,%esp
+  8028bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bf:	e8 b0 fe ff ff       	call   802774 <fd2sockid>
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	78 0f                	js     8028d7 <listen+0x21>
+  8028c8:	83 ec 08             	sub    $0x8,%esp
+  8028cb:	ff 75 0c             	push   0xc(%ebp)
+  8028ce:	50                   	push   %eax
+  8028cf:	e8 5e 01 00 00       	call   802a32 <nsipc_listen>
+  8028d4:	83 c4 10             	add    $0x10,%esp
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+
+008028d9 <socket>:
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	83 ec 0c             	sub    $0xc,%esp
+  8028df:	ff 75 10             	push   0x10(%ebp)
+  8028e2:	ff 75 0c             	push   0xc(%ebp)
+  8028e5:	ff 75 08             	push   0x8(%ebp)
+  8028e8:	e8 34 02 00 00       	call   802b21 <nsipc_socket>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+  8028f0:	85 c0                	test   %eax,%eax
+  8028f2:	78 05                	js     8028f9 <socket+0x20>
+  8028f4:	e8 ab fe ff ff       	call   8027a4 <alloc_sockfd>
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+008028fb <nsipc>:
+  8028fb:	55                   	push   %ebp
+  8028fc:	89 e5                	mov    %esp,%ebp
+  8028fe:	53                   	push   %ebx
+  8028ff:	83 ec 04             	sub    $0x4,%esp
+  802902:	89 c3                	mov    %eax,%ebx
+  802904:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  80290b:	74 1f                	je     80292c <nsipc+0x31>
+  80290d:	83 ec 08             	sub    $0x8,%esp
+  802910:	6a 00                	push   $0x0
+  802912:	6a 00                	push   $0x0
+  802914:	6a 07                	push   $0x7
+  802916:	68 00 70 80 00       	push   $0x807000
+  80291b:	53                   	push   %ebx
+  80291c:	ff 35 10 50 80 00    	push   0x805010
+  802922:	e8 c0 0a 00 00       	call   8033e7 <ipc_call>
+  802927:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80292a:	c9                   	leave
+  80292b:	c3                   	ret
+  80292c:	83 ec 0c             	sub    $0xc,%esp
+  80292f:	6a 03                	push   $0x3
+  802931:	e8 4c 0c 00 00       	call   803582 <ipc_find_env>
+  802936:	a3 10 50 80 00       	mov    %eax,0x805010
+  80293b:	83 c4 10             	add    $0x10,%esp
+  80293e:	eb cd                	jmp    80290d <nsipc+0x12>
+
+00802940 <nsipc_accept>:
+  802940:	55                   	push   %ebp
+  802941:	89 e5                	mov    %esp,%ebp
+  802943:	53                   	push   %ebx
+  802944:	83 ec 04             	sub    $0x4,%esp
+  802947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80294f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802954:	e8 a2 ff ff ff       	call   8028fb <nsipc>
+  802959:	89 c3                	mov    %eax,%ebx
+  80295b:	85 c0                	test   %eax,%eax
+  80295d:	79 07                	jns    802966 <nsipc_accept+0x26>
+  80295f:	89 d8                	mov    %ebx,%eax
+  802961:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802964:	c9                   	leave
+  802965:	c3                   	ret
+  802966:	83 ec 04             	sub    $0x4,%esp
+  802969:	ff 35 10 70 80 00    	push   0x807010
+  80296f:	68 00 70 80 00       	push   $0x807000
+  802974:	ff 75 0c             	push   0xc(%ebp)
+  802977:	e8 1c e1 ff ff       	call   800a98 <memmove>
+  80297c:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802982:	8b 45 10             	mov    0x10(%ebp),%eax
+  802985:	89 10                	mov    %edx,(%eax)
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	eb d3                	jmp    80295f <nsipc_accept+0x1f>
+
+0080298c <nsipc_bind>:
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	53                   	push   %ebx
+  802990:	83 ec 08             	sub    $0x8,%esp
+  802993:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802996:	8b 45 08             	mov    0x8(%ebp),%eax
+  802999:	a3 00 70 80 00       	mov    %eax,0x807000
+  80299e:	53                   	push   %ebx
+  80299f:	ff 75 0c             	push   0xc(%ebp)
+  8029a2:	68 04 70 80 00       	push   $0x807004
+  8029a7:	e8 ec e0 ff ff       	call   800a98 <memmove>
+  8029ac:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8029b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029b7:	e8 3f ff ff ff       	call   8028fb <nsipc>
+  8029bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029bf:	c9                   	leave
+  8029c0:	c3                   	ret
+
+008029c1 <nsipc_shutdown>:
+  8029c1:	55                   	push   %ebp
+  8029c2:	89 e5                	mov    %esp,%ebp
+  8029c4:	83 ec 08             	sub    $0x8,%esp
+  8029c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ca:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d2:	a3 04 70 80 00       	mov    %eax,0x807004
+  8029d7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029dc:	e8 1a ff ff ff       	call   8028fb <nsipc>
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+008029e3 <nsipc_close>:
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	83 ec 08             	sub    $0x8,%esp
+  8029e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ec:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029f1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029f6:	e8 00 ff ff ff       	call   8028fb <nsipc>
+  8029fb:	c9                   	leave
+  8029fc:	c3                   	ret
+
+008029fd <nsipc_connect>:
+  8029fd:	55                   	push   %ebp
+  8029fe:	89 e5                	mov    %esp,%ebp
+  802a00:	53                   	push   %ebx
+  802a01:	83 ec 08             	sub    $0x8,%esp
+  802a04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a07:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0a:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a0f:	53                   	push   %ebx
+  802a10:	ff 75 0c             	push   0xc(%ebp)
+  802a13:	68 04 70 80 00       	push   $0x807004
+  802a18:	e8 7b e0 ff ff       	call   800a98 <memmove>
+  802a1d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802a23:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a28:	e8 ce fe ff ff       	call   8028fb <nsipc>
+  802a2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a30:	c9                   	leave
+  802a31:	c3                   	ret
+
+00802a32 <nsipc_listen>:
+  802a32:	55                   	push   %ebp
+  802a33:	89 e5                	mov    %esp,%ebp
+  802a35:	83 ec 08             	sub    $0x8,%esp
+  802a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a43:	a3 04 70 80 00       	mov    %eax,0x807004
+  802a48:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a4d:	e8 a9 fe ff ff       	call   8028fb <nsipc>
+  802a52:	c9                   	leave
+  802a53:	c3                   	ret
+
+00802a54 <nsipc_recv>:
+  802a54:	55                   	push   %ebp
+  802a55:	89 e5                	mov    %esp,%ebp
+  802a57:	56                   	push   %esi
+  802a58:	53                   	push   %ebx
+  802a59:	8b 75 10             	mov    0x10(%ebp),%esi
+  802a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a64:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802a6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a6d:	a3 08 70 80 00       	mov    %eax,0x807008
+  802a72:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a77:	e8 7f fe ff ff       	call   8028fb <nsipc>
+  802a7c:	89 c3                	mov    %eax,%ebx
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	78 22                	js     802aa4 <nsipc_recv+0x50>
+  802a82:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a87:	39 c6                	cmp    %eax,%esi
+  802a89:	0f 4e c6             	cmovle %esi,%eax
+  802a8c:	39 c3                	cmp    %eax,%ebx
+  802a8e:	7f 1d                	jg     802aad <nsipc_recv+0x59>
+  802a90:	83 ec 04             	sub    $0x4,%esp
+  802a93:	53                   	push   %ebx
+  802a94:	68 00 70 80 00       	push   $0x807000
+  802a99:	ff 75 0c             	push   0xc(%ebp)
+  802a9c:	e8 f7 df ff ff       	call   800a98 <memmove>
+  802aa1:	83 c4 10             	add    $0x10,%esp
+  802aa4:	89 d8                	mov    %ebx,%eax
+  802aa6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aa9:	5b                   	pop    %ebx
+  802aaa:	5e                   	pop    %esi
+  802aab:	5d                   	pop    %ebp
+  802aac:	c3                   	ret
+  802aad:	68 bc 3c 80 00       	push   $0x803cbc
+  802ab2:	68 d1 3c 80 00       	push   $0x803cd1
+  802ab7:	6a 60                	push   $0x60
+  802ab9:	68 e6 3c 80 00       	push   $0x803ce6
+  802abe:	e8 83 07 00 00       	call   803246 <_panic>
+
+00802ac3 <nsipc_send>:
+  802ac3:	55                   	push   %ebp
+  802ac4:	89 e5                	mov    %esp,%ebp
+  802ac6:	53                   	push   %ebx
+  802ac7:	83 ec 04             	sub    $0x4,%esp
+  802aca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802acd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad0:	a3 00 70 80 00       	mov    %eax,0x807000
+  802ad5:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802adb:	7f 2e                	jg     802b0b <nsipc_send+0x48>
+  802add:	83 ec 04             	sub    $0x4,%esp
+  802ae0:	53                   	push   %ebx
+  802ae1:	ff 75 0c             	push   0xc(%ebp)
+  802ae4:	68 0c 70 80 00       	push   $0x80700c
+  802ae9:	e8 aa df ff ff       	call   800a98 <memmove>
+  802aee:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802af4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af7:	a3 08 70 80 00       	mov    %eax,0x807008
+  802afc:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b01:	e8 f5 fd ff ff       	call   8028fb <nsipc>
+  802b06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+  802b0b:	68 f2 3c 80 00       	push   $0x803cf2
+  802b10:	68 d1 3c 80 00       	push   $0x803cd1
+  802b15:	6a 6b                	push   $0x6b
+  802b17:	68 e6 3c 80 00       	push   $0x803ce6
+  802b1c:	e8 25 07 00 00       	call   803246 <_panic>
+
+00802b21 <nsipc_socket>:
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	83 ec 08             	sub    $0x8,%esp
+  802b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2a:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b32:	a3 04 70 80 00       	mov    %eax,0x807004
+  802b37:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b3a:	a3 08 70 80 00       	mov    %eax,0x807008
+  802b3f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b44:	e8 b2 fd ff ff       	call   8028fb <nsipc>
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+
+00802b4b <devpipe_stat>:
+  802b4b:	55                   	push   %ebp
+  802b4c:	89 e5                	mov    %esp,%ebp
+  802b4e:	56                   	push   %esi
+  802b4f:	53                   	push   %ebx
+  802b50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802b53:	83 ec 0c             	sub    $0xc,%esp
+  802b56:	ff 75 08             	push   0x8(%ebp)
+  802b59:	e8 99 ef ff ff       	call   801af7 <fd2data>
+  802b5e:	89 c6                	mov    %eax,%esi
+  802b60:	83 c4 08             	add    $0x8,%esp
+  802b63:	68 fe 3c 80 00       	push   $0x803cfe
+  802b68:	53                   	push   %ebx
+  802b69:	e8 7a dd ff ff       	call   8008e8 <strcpy>
+  802b6e:	8b 46 04             	mov    0x4(%esi),%eax
+  802b71:	2b 06                	sub    (%esi),%eax
+  802b73:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802b79:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802b80:	00 00 00 
+  802b83:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802b8a:	40 80 00 
+  802b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b95:	5b                   	pop    %ebx
+  802b96:	5e                   	pop    %esi
+  802b97:	5d                   	pop    %ebp
+  802b98:	c3                   	ret
+
+00802b99 <devpipe_close>:
+  802b99:	55                   	push   %ebp
+  802b9a:	89 e5                	mov    %esp,%ebp
+  802b9c:	53                   	push   %ebx
+  802b9d:	83 ec 0c             	sub    $0xc,%esp
+  802ba0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ba3:	53                   	push   %ebx
+  802ba4:	6a 00                	push   $0x0
+  802ba6:	e8 6f e2 ff ff       	call   800e1a <sys_page_unmap>
+  802bab:	89 1c 24             	mov    %ebx,(%esp)
+  802bae:	e8 44 ef ff ff       	call   801af7 <fd2data>
+  802bb3:	83 c4 08             	add    $0x8,%esp
+  802bb6:	50                   	push   %eax
+  802bb7:	6a 00                	push   $0x0
+  802bb9:	e8 5c e2 ff ff       	call   800e1a <sys_page_unmap>
+  802bbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc1:	c9                   	leave
+  802bc2:	c3                   	ret
+
+00802bc3 <_pipeisclosed>:
+  802bc3:	55                   	push   %ebp
+  802bc4:	89 e5                	mov    %esp,%ebp
+  802bc6:	57                   	push   %edi
+  802bc7:	56                   	push   %esi
+  802bc8:	53                   	push   %ebx
+  802bc9:	83 ec 1c             	sub    $0x1c,%esp
+  802bcc:	89 c7                	mov    %eax,%edi
+  802bce:	89 d6                	mov    %edx,%esi
+  802bd0:	a1 14 50 80 00       	mov    0x805014,%eax
+  802bd5:	8b 58 58             	mov    0x58(%eax),%ebx
+  802bd8:	83 ec 0c             	sub    $0xc,%esp
+  802bdb:	57                   	push   %edi
+  802bdc:	e8 bb 09 00 00       	call   80359c <pageref>
+  802be1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802be4:	89 34 24             	mov    %esi,(%esp)
+  802be7:	e8 b0 09 00 00       	call   80359c <pageref>
+  802bec:	8b 15 14 50 80 00    	mov    0x805014,%edx
+  802bf2:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802bf5:	83 c4 10             	add    $0x10,%esp
+  802bf8:	39 cb                	cmp    %ecx,%ebx
+  802bfa:	74 1b                	je     802c17 <_pipeisclosed+0x54>
+  802bfc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bff:	75 cf                	jne    802bd0 <_pipeisclosed+0xd>
+  802c01:	8b 42 58             	mov    0x58(%edx),%eax
+  802c04:	6a 01                	push   $0x1
+  802c06:	50                   	push   %eax
+  802c07:	53                   	push   %ebx
+  802c08:	68 05 3d 80 00       	push   $0x803d05
+  802c0d:	e8 df d5 ff ff       	call   8001f1 <cprintf>
+  802c12:	83 c4 10             	add    $0x10,%esp
+  802c15:	eb b9                	jmp    802bd0 <_pipeisclosed+0xd>
+  802c17:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c1a:	0f 94 c0             	sete   %al
+  802c1d:	0f b6 c0             	movzbl %al,%eax
+  802c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c23:	5b                   	pop    %ebx
+  802c24:	5e                   	pop    %esi
+  802c25:	5f                   	pop    %edi
+  802c26:	5d                   	pop    %ebp
+  802c27:	c3                   	ret
+
+00802c28 <devpipe_write>:
+  802c28:	55                   	push   %ebp
+  802c29:	89 e5                	mov    %esp,%ebp
+  802c2b:	57                   	push   %edi
+  802c2c:	56                   	push   %esi
+  802c2d:	53                   	push   %ebx
+  802c2e:	83 ec 28             	sub    $0x28,%esp
+  802c31:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c34:	56                   	push   %esi
+  802c35:	e8 bd ee ff ff       	call   801af7 <fd2data>
+  802c3a:	89 c3                	mov    %eax,%ebx
+  802c3c:	83 c4 10             	add    $0x10,%esp
+  802c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c44:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c48:	74 5c                	je     802ca6 <devpipe_write+0x7e>
+  802c4a:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c4d:	8b 0b                	mov    (%ebx),%ecx
+  802c4f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c52:	39 d0                	cmp    %edx,%eax
+  802c54:	72 1e                	jb     802c74 <devpipe_write+0x4c>
+  802c56:	89 da                	mov    %ebx,%edx
+  802c58:	89 f0                	mov    %esi,%eax
+  802c5a:	e8 64 ff ff ff       	call   802bc3 <_pipeisclosed>
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	75 48                	jne    802cab <devpipe_write+0x83>
+  802c63:	e8 95 e0 ff ff       	call   800cfd <sys_yield>
+  802c68:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c6b:	8b 0b                	mov    (%ebx),%ecx
+  802c6d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c70:	39 d0                	cmp    %edx,%eax
+  802c72:	73 e2                	jae    802c56 <devpipe_write+0x2e>
+  802c74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c77:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802c7b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802c7e:	89 c2                	mov    %eax,%edx
+  802c80:	c1 fa 1f             	sar    $0x1f,%edx
+  802c83:	89 d1                	mov    %edx,%ecx
+  802c85:	c1 e9 1b             	shr    $0x1b,%ecx
+  802c88:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c8b:	83 e2 1f             	and    $0x1f,%edx
+  802c8e:	29 ca                	sub    %ecx,%edx
+  802c90:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802c94:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802c98:	83 c0 01             	add    $0x1,%eax
+  802c9b:	89 43 04             	mov    %eax,0x4(%ebx)
+  802c9e:	83 c7 01             	add    $0x1,%edi
+  802ca1:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802ca4:	75 a4                	jne    802c4a <devpipe_write+0x22>
+  802ca6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ca9:	eb 05                	jmp    802cb0 <devpipe_write+0x88>
+  802cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb3:	5b                   	pop    %ebx
+  802cb4:	5e                   	pop    %esi
+  802cb5:	5f                   	pop    %edi
+  802cb6:	5d                   	pop    %ebp
+  802cb7:	c3                   	ret
+
+00802cb8 <devpipe_read>:
+  802cb8:	55                   	push   %ebp
+  802cb9:	89 e5                	mov    %esp,%ebp
+  802cbb:	57                   	push   %edi
+  802cbc:	56                   	push   %esi
+  802cbd:	53                   	push   %ebx
+  802cbe:	83 ec 18             	sub    $0x18,%esp
+  802cc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cc4:	56                   	push   %esi
+  802cc5:	e8 2d ee ff ff       	call   801af7 <fd2data>
+  802cca:	89 c3                	mov    %eax,%ebx
+  802ccc:	83 c4 10             	add    $0x10,%esp
+  802ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802cd8:	74 45                	je     802d1f <devpipe_read+0x67>
+  802cda:	8b 03                	mov    (%ebx),%eax
+  802cdc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802cdf:	75 1d                	jne    802cfe <devpipe_read+0x46>
+  802ce1:	85 ff                	test   %edi,%edi
+  802ce3:	75 3f                	jne    802d24 <devpipe_read+0x6c>
+  802ce5:	89 da                	mov    %ebx,%edx
+  802ce7:	89 f0                	mov    %esi,%eax
+  802ce9:	e8 d5 fe ff ff       	call   802bc3 <_pipeisclosed>
+  802cee:	85 c0                	test   %eax,%eax
+  802cf0:	75 3c                	jne    802d2e <devpipe_read+0x76>
+  802cf2:	e8 06 e0 ff ff       	call   800cfd <sys_yield>
+  802cf7:	8b 03                	mov    (%ebx),%eax
+  802cf9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802cfc:	74 e7                	je     802ce5 <devpipe_read+0x2d>
+  802cfe:	99                   	cltd
+  802cff:	c1 ea 1b             	shr    $0x1b,%edx
+  802d02:	01 d0                	add    %edx,%eax
+  802d04:	83 e0 1f             	and    $0x1f,%eax
+  802d07:	29 d0                	sub    %edx,%eax
+  802d09:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802d0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d11:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802d14:	83 03 01             	addl   $0x1,(%ebx)
+  802d17:	83 c7 01             	add    $0x1,%edi
+  802d1a:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802d1d:	75 bb                	jne    802cda <devpipe_read+0x22>
+  802d1f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d22:	eb 02                	jmp    802d26 <devpipe_read+0x6e>
+  802d24:	89 f8                	mov    %edi,%eax
+  802d26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d29:	5b                   	pop    %ebx
+  802d2a:	5e                   	pop    %esi
+  802d2b:	5f                   	pop    %edi
+  802d2c:	5d                   	pop    %ebp
+  802d2d:	c3                   	ret
+  802d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d33:	eb f1                	jmp    802d26 <devpipe_read+0x6e>
+
+00802d35 <pipe>:
+  802d35:	55                   	push   %ebp
+  802d36:	89 e5                	mov    %esp,%ebp
+  802d38:	56                   	push   %esi
+  802d39:	53                   	push   %ebx
+  802d3a:	83 ec 1c             	sub    $0x1c,%esp
+  802d3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d40:	50                   	push   %eax
+  802d41:	e8 c8 ed ff ff       	call   801b0e <fd_alloc>
+  802d46:	89 c3                	mov    %eax,%ebx
+  802d48:	83 c4 10             	add    $0x10,%esp
+  802d4b:	85 c0                	test   %eax,%eax
+  802d4d:	0f 88 23 01 00 00    	js     802e76 <pipe+0x141>
+  802d53:	83 ec 04             	sub    $0x4,%esp
+  802d56:	68 07 04 00 00       	push   $0x407
+  802d5b:	ff 75 f4             	push   -0xc(%ebp)
+  802d5e:	6a 00                	push   $0x0
+  802d60:	e8 e3 df ff ff       	call   800d48 <sys_page_alloc>
+  802d65:	89 c3                	mov    %eax,%ebx
+  802d67:	83 c4 10             	add    $0x10,%esp
+  802d6a:	85 c0                	test   %eax,%eax
+  802d6c:	0f 88 04 01 00 00    	js     802e76 <pipe+0x141>
+  802d72:	83 ec 0c             	sub    $0xc,%esp
+  802d75:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d78:	50                   	push   %eax
+  802d79:	e8 90 ed ff ff       	call   801b0e <fd_alloc>
+  802d7e:	89 c3                	mov    %eax,%ebx
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	0f 88 db 00 00 00    	js     802e66 <pipe+0x131>
+  802d8b:	83 ec 04             	sub    $0x4,%esp
+  802d8e:	68 07 04 00 00       	push   $0x407
+  802d93:	ff 75 f0             	push   -0x10(%ebp)
+  802d96:	6a 00                	push   $0x0
+  802d98:	e8 ab df ff ff       	call   800d48 <sys_page_alloc>
+  802d9d:	89 c3                	mov    %eax,%ebx
+  802d9f:	83 c4 10             	add    $0x10,%esp
+  802da2:	85 c0                	test   %eax,%eax
+  802da4:	0f 88 bc 00 00 00    	js     802e66 <pipe+0x131>
+  802daa:	83 ec 0c             	sub    $0xc,%esp
+  802dad:	ff 75 f4             	push   -0xc(%ebp)
+  802db0:	e8 42 ed ff ff       	call   801af7 <fd2data>
+  802db5:	89 c6                	mov    %eax,%esi
+  802db7:	83 c4 0c             	add    $0xc,%esp
+  802dba:	68 07 04 00 00       	push   $0x407
+  802dbf:	50                   	push   %eax
+  802dc0:	6a 00                	push   $0x0
+  802dc2:	e8 81 df ff ff       	call   800d48 <sys_page_alloc>
+  802dc7:	89 c3                	mov    %eax,%ebx
+  802dc9:	83 c4 10             	add    $0x10,%esp
+  802dcc:	85 c0                	test   %eax,%eax
+  802dce:	0f 88 82 00 00 00    	js     802e56 <pipe+0x121>
+  802dd4:	83 ec 0c             	sub    $0xc,%esp
+  802dd7:	ff 75 f0             	push   -0x10(%ebp)
+  802dda:	e8 18 ed ff ff       	call   801af7 <fd2data>
+  802ddf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802de6:	50                   	push   %eax
+  802de7:	6a 00                	push   $0x0
+  802de9:	56                   	push   %esi
+  802dea:	6a 00                	push   $0x0
+  802dec:	e8 9a df ff ff       	call   800d8b <sys_page_map>
+  802df1:	89 c3                	mov    %eax,%ebx
+  802df3:	83 c4 20             	add    $0x20,%esp
+  802df6:	85 c0                	test   %eax,%eax
+  802df8:	78 4e                	js     802e48 <pipe+0x113>
+  802dfa:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802dff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e02:	89 02                	mov    %eax,(%edx)
+  802e04:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e07:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802e0e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802e11:	89 02                	mov    %eax,(%edx)
+  802e13:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802e16:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802e1d:	83 ec 0c             	sub    $0xc,%esp
+  802e20:	ff 75 f4             	push   -0xc(%ebp)
+  802e23:	e8 bf ec ff ff       	call   801ae7 <fd2num>
+  802e28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e2b:	89 01                	mov    %eax,(%ecx)
+  802e2d:	83 c4 04             	add    $0x4,%esp
+  802e30:	ff 75 f0             	push   -0x10(%ebp)
+  802e33:	e8 af ec ff ff       	call   801ae7 <fd2num>
+  802e38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e3b:	89 41 04             	mov    %eax,0x4(%ecx)
+  802e3e:	83 c4 10             	add    $0x10,%esp
+  802e41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e46:	eb 2e                	jmp    802e76 <pipe+0x141>
+  802e48:	83 ec 08             	sub    $0x8,%esp
+  802e4b:	56                   	push   %esi
+  802e4c:	6a 00                	push   $0x0
+  802e4e:	e8 c7 df ff ff       	call   800e1a <sys_page_unmap>
+  802e53:	83 c4 10             	add    $0x10,%esp
+  802e56:	83 ec 08             	sub    $0x8,%esp
+  802e59:	ff 75 f0             	push   -0x10(%ebp)
+  802e5c:	6a 00                	push   $0x0
+  802e5e:	e8 b7 df ff ff       	call   800e1a <sys_page_unmap>
+  802e63:	83 c4 10             	add    $0x10,%esp
+  802e66:	83 ec 08             	sub    $0x8,%esp
+  802e69:	ff 75 f4             	push   -0xc(%ebp)
+  802e6c:	6a 00                	push   $0x0
+  802e6e:	e8 a7 df ff ff       	call   800e1a <sys_page_unmap>
+  802e73:	83 c4 10             	add    $0x10,%esp
+  802e76:	89 d8                	mov    %ebx,%eax
+  802e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e7b:	5b                   	pop    %ebx
+  802e7c:	5e                   	pop    %esi
+  802e7d:	5d                   	pop    %ebp
+  802e7e:	c3                   	ret
+
+00802e7f <pipeisclosed>:
+  802e7f:	55                   	push   %ebp
+  802e80:	89 e5                	mov    %esp,%ebp
+  802e82:	83 ec 20             	sub    $0x20,%esp
+  802e85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e88:	50                   	push   %eax
+  802e89:	ff 75 08             	push   0x8(%ebp)
+  802e8c:	e8 cd ec ff ff       	call   801b5e <fd_lookup>
+  802e91:	83 c4 10             	add    $0x10,%esp
+  802e94:	85 c0                	test   %eax,%eax
+  802e96:	78 18                	js     802eb0 <pipeisclosed+0x31>
+  802e98:	83 ec 0c             	sub    $0xc,%esp
+  802e9b:	ff 75 f4             	push   -0xc(%ebp)
+  802e9e:	e8 54 ec ff ff       	call   801af7 <fd2data>
+  802ea3:	89 c2                	mov    %eax,%edx
+  802ea5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ea8:	e8 16 fd ff ff       	call   802bc3 <_pipeisclosed>
+  802ead:	83 c4 10             	add    $0x10,%esp
+  802eb0:	c9                   	leave
+  802eb1:	c3                   	ret
+
+00802eb2 <ipcring_init>:
+  802eb2:	55                   	push   %ebp
+  802eb3:	89 e5                	mov    %esp,%ebp
+  802eb5:	53                   	push   %ebx
+  802eb6:	83 ec 08             	sub    $0x8,%esp
+  802eb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ebc:	6a 60                	push   $0x60
+  802ebe:	6a 00                	push   $0x0
+  802ec0:	53                   	push   %ebx
+  802ec1:	e8 9d db ff ff       	call   800a63 <memset>
+  802ec6:	a1 14 50 80 00       	mov    0x805014,%eax
+  802ecb:	8b 40 48             	mov    0x48(%eax),%eax
+  802ece:	89 03                	mov    %eax,(%ebx)
+  802ed0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ed3:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ed6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ed9:	89 43 08             	mov    %eax,0x8(%ebx)
+  802edc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802edf:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ee8:	c9                   	leave
+  802ee9:	c3                   	ret
+
+00802eea <ipcring_req_slot>:
+  802eea:	55                   	push   %ebp
+  802eeb:	89 e5                	mov    %esp,%ebp
+  802eed:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef0:	8b 50 10             	mov    0x10(%eax),%edx
+  802ef3:	8b 48 18             	mov    0x18(%eax),%ecx
+  802ef6:	29 ca                	sub    %ecx,%edx
+  802ef8:	83 fa 07             	cmp    $0x7,%edx
+  802efb:	77 0c                	ja     802f09 <ipcring_req_slot+0x1f>
+  802efd:	8b 50 10             	mov    0x10(%eax),%edx
+  802f00:	83 e2 07             	and    $0x7,%edx
+  802f03:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802f07:	5d                   	pop    %ebp
+  802f08:	c3                   	ret
+  802f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0e:	eb f7                	jmp    802f07 <ipcring_req_slot+0x1d>
+
+00802f10 <ipcring_req_push>:
+  802f10:	55                   	push   %ebp
+  802f11:	89 e5                	mov    %esp,%ebp
+  802f13:	83 ec 08             	sub    $0x8,%esp
+  802f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f19:	8b 42 10             	mov    0x10(%edx),%eax
+  802f1c:	83 c0 01             	add    $0x1,%eax
+  802f1f:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f28:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802f2c:	85 c0                	test   %eax,%eax
+  802f2e:	75 02                	jne    802f32 <ipcring_req_push+0x22>
+  802f30:	c9                   	leave
+  802f31:	c3                   	ret
+  802f32:	6a 00                	push   $0x0
+  802f34:	68 00 00 80 ee       	push   $0xee800000
+  802f39:	ff 72 08             	push   0x8(%edx)
+  802f3c:	ff 72 04             	push   0x4(%edx)
+  802f3f:	e8 3c e1 ff ff       	call   801080 <sys_ipc_send>
+  802f44:	83 c4 10             	add    $0x10,%esp
+  802f47:	eb e7                	jmp    802f30 <ipcring_req_push+0x20>
+
+00802f49 <ipcring_rsp_wait>:
+  802f49:	55                   	push   %ebp
+  802f4a:	89 e5                	mov    %esp,%ebp
+  802f4c:	53                   	push   %ebx
+  802f4d:	83 ec 04             	sub    $0x4,%esp
+  802f50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f53:	8b 53 18             	mov    0x18(%ebx),%edx
+  802f56:	8b 43 10             	mov    0x10(%ebx),%eax
+  802f59:	39 c2                	cmp    %eax,%edx
+  802f5b:	74 3c                	je     802f99 <ipcring_rsp_wait+0x50>
+  802f5d:	8b 53 14             	mov    0x14(%ebx),%edx
+  802f60:	8b 43 18             	mov    0x18(%ebx),%eax
+  802f63:	39 c2                	cmp    %eax,%edx
+  802f65:	75 23                	jne    802f8a <ipcring_rsp_wait+0x41>
+  802f67:	83 ec 08             	sub    $0x8,%esp
+  802f6a:	6a 00                	push   $0x0
+  802f6c:	6a 00                	push   $0x0
+  802f6e:	6a 00                	push   $0x0
+  802f70:	6a 00                	push   $0x0
+  802f72:	ff 73 0c             	push   0xc(%ebx)
+  802f75:	ff 73 04             	push   0x4(%ebx)
+  802f78:	e8 6a 04 00 00       	call   8033e7 <ipc_call>
+  802f7d:	8b 53 14             	mov    0x14(%ebx),%edx
+  802f80:	8b 43 18             	mov    0x18(%ebx),%eax
+  802f83:	83 c4 20             	add    $0x20,%esp
+  802f86:	39 c2                	cmp    %eax,%edx
+  802f88:	74 dd                	je     802f67 <ipcring_rsp_wait+0x1e>
+  802f8a:	8b 43 18             	mov    0x18(%ebx),%eax
+  802f8d:	83 e0 07             	and    $0x7,%eax
+  802f90:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802f94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f97:	c9                   	leave
+  802f98:	c3                   	ret
+  802f99:	68 20 3d 80 00       	push   $0x803d20
+  802f9e:	68 d1 3c 80 00       	push   $0x803cd1
+  802fa3:	6a 3b                	push   $0x3b
+  802fa5:	68 41 3d 80 00       	push   $0x803d41
+  802faa:	e8 97 02 00 00       	call   803246 <_panic>
+
+00802faf <ipcring_rsp_pop>:
+  802faf:	55                   	push   %ebp
+  802fb0:	89 e5                	mov    %esp,%ebp
+  802fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fb5:	8b 42 18             	mov    0x18(%edx),%eax
+  802fb8:	83 c0 01             	add    $0x1,%eax
+  802fbb:	89 42 18             	mov    %eax,0x18(%edx)
+  802fbe:	5d                   	pop    %ebp
+  802fbf:	c3                   	ret
+
+00802fc0 <ipcring_server_init>:
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802fc9:	89 10                	mov    %edx,(%eax)
+  802fcb:	8b 55 10             	mov    0x10(%ebp),%edx
+  802fce:	89 50 04             	mov    %edx,0x4(%eax)
+  802fd1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802fd8:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802fdf:	5d                   	pop    %ebp
+  802fe0:	c3                   	ret
+
+00802fe1 <ipcring_req_avail>:
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fe7:	8b 02                	mov    (%edx),%eax
+  802fe9:	8b 40 10             	mov    0x10(%eax),%eax
+  802fec:	2b 42 08             	sub    0x8(%edx),%eax
+  802fef:	ba 08 00 00 00       	mov    $0x8,%edx
+  802ff4:	39 d0                	cmp    %edx,%eax
+  802ff6:	0f 47 c2             	cmova  %edx,%eax
+  802ff9:	5d                   	pop    %ebp
+  802ffa:	c3                   	ret
+
+00802ffb <ipcring_req_peek>:
+  802ffb:	55                   	push   %ebp
+  802ffc:	89 e5                	mov    %esp,%ebp
+  802ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  803001:	8b 42 08             	mov    0x8(%edx),%eax
+  803004:	83 e0 07             	and    $0x7,%eax
+  803007:	8b 12                	mov    (%edx),%edx
+  803009:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80300d:	5d                   	pop    %ebp
+  80300e:	c3                   	ret
+
+0080300f <ipcring_rsp_push>:
+  80300f:	55                   	push   %ebp
+  803010:	89 e5                	mov    %esp,%ebp
+  803012:	83 ec 08             	sub    $0x8,%esp
+  803015:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803018:	8b 41 08             	mov    0x8(%ecx),%eax
+  80301b:	83 c0 01             	add    $0x1,%eax
+  80301e:	89 41 08             	mov    %eax,0x8(%ecx)
+  803021:	8b 11                	mov    (%ecx),%edx
+  803023:	83 c2 14             	add    $0x14,%edx
+  803026:	f0 87 02             	lock xchg %eax,(%edx)
+  803029:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80302d:	75 02                	jne    803031 <ipcring_rsp_push+0x22>
+  80302f:	c9                   	leave
+  803030:	c3                   	ret
+  803031:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803038:	6a 00                	push   $0x0
+  80303a:	68 00 00 80 ee       	push   $0xee800000
+  80303f:	6a 00                	push   $0x0
+  803041:	ff 71 04             	push   0x4(%ecx)
+  803044:	e8 5a df ff ff       	call   800fa3 <sys_ipc_try_send>
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	eb e1                	jmp    80302f <ipcring_rsp_push+0x20>
+
+0080304e <ipcring_client_wait>:
+  80304e:	55                   	push   %ebp
+  80304f:	89 e5                	mov    %esp,%ebp
+  803051:	83 ec 08             	sub    $0x8,%esp
+  803054:	8b 45 08             	mov    0x8(%ebp),%eax
+  803057:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  80305e:	8b 10                	mov    (%eax),%edx
+  803060:	8b 52 18             	mov    0x18(%edx),%edx
+  803063:	3b 50 08             	cmp    0x8(%eax),%edx
+  803066:	75 02                	jne    80306a <ipcring_client_wait+0x1c>
+  803068:	c9                   	leave
+  803069:	c3                   	ret
+  80306a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803071:	6a 00                	push   $0x0
+  803073:	68 00 00 80 ee       	push   $0xee800000
+  803078:	6a 00                	push   $0x0
+  80307a:	ff 70 04             	push   0x4(%eax)
+  80307d:	e8 21 df ff ff       	call   800fa3 <sys_ipc_try_send>
+  803082:	83 c4 10             	add    $0x10,%esp
+  803085:	eb e1                	jmp    803068 <ipcring_client_wait+0x1a>
+
+00803087 <ipcring_server_sleep>:
+  803087:	55                   	push   %ebp
+  803088:	89 e5                	mov    %esp,%ebp
+  80308a:	53                   	push   %ebx
+  80308b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80308e:	8b 01                	mov    (%ecx),%eax
+  803090:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803093:	b8 01 00 00 00       	mov    $0x1,%eax
+  803098:	f0 87 02             	lock xchg %eax,(%edx)
+  80309b:	8b 11                	mov    (%ecx),%edx
+  80309d:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8030a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030a5:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8030a8:	74 0e                	je     8030b8 <ipcring_server_sleep+0x31>
+  8030aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030af:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8030b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030bb:	c9                   	leave
+  8030bc:	c3                   	ret
+
+008030bd <devcons_close>:
+  8030bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c2:	c3                   	ret
+
+008030c3 <devcons_stat>:
+  8030c3:	55                   	push   %ebp
+  8030c4:	89 e5                	mov    %esp,%ebp
+  8030c6:	83 ec 10             	sub    $0x10,%esp
+  8030c9:	68 4f 3d 80 00       	push   $0x803d4f
+  8030ce:	ff 75 0c             	push   0xc(%ebp)
+  8030d1:	e8 12 d8 ff ff       	call   8008e8 <strcpy>
+  8030d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030db:	c9                   	leave
+  8030dc:	c3                   	ret
+
+008030dd <devcons_write>:
+  8030dd:	55                   	push   %ebp
+  8030de:	89 e5                	mov    %esp,%ebp
+  8030e0:	57                   	push   %edi
+  8030e1:	56                   	push   %esi
+  8030e2:	53                   	push   %ebx
+  8030e3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8030e9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8030ec:	85 ff                	test   %edi,%edi
+  8030ee:	74 51                	je     803141 <devcons_write+0x64>
+  8030f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8030f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030fa:	89 fb                	mov    %edi,%ebx
+  8030fc:	29 c3                	sub    %eax,%ebx
+  8030fe:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803103:	39 d3                	cmp    %edx,%ebx
+  803105:	0f 47 da             	cmova  %edx,%ebx
+  803108:	83 ec 04             	sub    $0x4,%esp
+  80310b:	53                   	push   %ebx
+  80310c:	03 45 0c             	add    0xc(%ebp),%eax
+  80310f:	50                   	push   %eax
+  803110:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803116:	50                   	push   %eax
+  803117:	e8 7c d9 ff ff       	call   800a98 <memmove>
+  80311c:	83 c4 08             	add    $0x8,%esp
+  80311f:	53                   	push   %ebx
+  803120:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803126:	50                   	push   %eax
+  803127:	e8 34 db ff ff       	call   800c60 <sys_cputs>
+  80312c:	01 de                	add    %ebx,%esi
+  80312e:	89 f0                	mov    %esi,%eax
+  803130:	83 c4 10             	add    $0x10,%esp
+  803133:	39 fe                	cmp    %edi,%esi
+  803135:	72 c3                	jb     8030fa <devcons_write+0x1d>
+  803137:	89 f0                	mov    %esi,%eax
+  803139:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80313c:	5b                   	pop    %ebx
+  80313d:	5e                   	pop    %esi
+  80313e:	5f                   	pop    %edi
+  80313f:	5d                   	pop    %ebp
+  803140:	c3                   	ret
+  803141:	be 00 00 00 00       	mov    $0x0,%esi
+  803146:	eb ef                	jmp    803137 <devcons_write+0x5a>
+
+00803148 <devcons_read>:
+  803148:	55                   	push   %ebp
+  803149:	89 e5                	mov    %esp,%ebp
+  80314b:	83 ec 08             	sub    $0x8,%esp
+  80314e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803153:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803157:	75 07                	jne    803160 <devcons_read+0x18>
+  803159:	eb 1f                	jmp    80317a <devcons_read+0x32>
+  80315b:	e8 9d db ff ff       	call   800cfd <sys_yield>
+  803160:	e8 19 db ff ff       	call   800c7e <sys_cgetc>
+  803165:	85 c0                	test   %eax,%eax
+  803167:	74 f2                	je     80315b <devcons_read+0x13>
+  803169:	78 0f                	js     80317a <devcons_read+0x32>
+  80316b:	83 f8 04             	cmp    $0x4,%eax
+  80316e:	74 0c                	je     80317c <devcons_read+0x34>
+  803170:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803173:	88 02                	mov    %al,(%edx)
+  803175:	b8 01 00 00 00       	mov    $0x1,%eax
+  80317a:	c9                   	leave
+  80317b:	c3                   	ret
+  80317c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803181:	eb f7                	jmp    80317a <devcons_read+0x32>
+
+00803183 <cputchar>:
+  803183:	55                   	push   %ebp
+  803184:	89 e5                	mov    %esp,%ebp
+  803186:	83 ec 20             	sub    $0x20,%esp
+  803189:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318c:	88 45 f7             	mov    %al,-0x9(%ebp)
+  80318f:	6a 01                	push   $0x1
+  803191:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803194:	50                   	push   %eax
+  803195:	e8 c6 da ff ff       	call   800c60 <sys_cputs>
+  80319a:	83 c4 10             	add    $0x10,%esp
+  80319d:	c9                   	leave
+  80319e:	c3                   	ret
+
+0080319f <getchar>:
+  80319f:	55                   	push   %ebp
+  8031a0:	89 e5                	mov    %esp,%ebp
+  8031a2:	83 ec 1c             	sub    $0x1c,%esp
+  8031a5:	6a 01                	push   $0x1
+  8031a7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031aa:	50                   	push   %eax
+  8031ab:	6a 00                	push   $0x0
+  8031ad:	e8 0e ec ff ff       	call   801dc0 <read>
+  8031b2:	83 c4 10             	add    $0x10,%esp
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	78 06                	js     8031bf <getchar+0x20>
+  8031b9:	74 06                	je     8031c1 <getchar+0x22>
+  8031bb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8031bf:	c9                   	leave
+  8031c0:	c3                   	ret
+  8031c1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8031c6:	eb f7                	jmp    8031bf <getchar+0x20>
+
+008031c8 <iscons>:
+  8031c8:	55                   	push   %ebp
+  8031c9:	89 e5                	mov    %esp,%ebp
+  8031cb:	83 ec 20             	sub    $0x20,%esp
+  8031ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031d1:	50                   	push   %eax
+  8031d2:	ff 75 08             	push   0x8(%ebp)
+  8031d5:	e8 84 e9 ff ff       	call   801b5e <fd_lookup>
+  8031da:	83 c4 10             	add    $0x10,%esp
+  8031dd:	85 c0                	test   %eax,%eax
+  8031df:	78 11                	js     8031f2 <iscons+0x2a>
+  8031e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031e4:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8031ea:	39 10                	cmp    %edx,(%eax)
+  8031ec:	0f 94 c0             	sete   %al
+  8031ef:	0f b6 c0             	movzbl %al,%eax
+  8031f2:	c9                   	leave
+  8031f3:	c3                   	ret
+
+008031f4 <opencons>:
+  8031f4:	55                   	push   %ebp
+  8031f5:	89 e5                	mov    %esp,%ebp
+  8031f7:	83 ec 24             	sub    $0x24,%esp
+  8031fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031fd:	50                   	push   %eax
+  8031fe:	e8 0b e9 ff ff       	call   801b0e <fd_alloc>
+  803203:	83 c4 10             	add    $0x10,%esp
+  803206:	85 c0                	test   %eax,%eax
+  803208:	78 3a                	js     803244 <opencons+0x50>
+  80320a:	83 ec 04             	sub    $0x4,%esp
+  80320d:	68 07 04 00 00       	push   $0x407
+  803212:	ff 75 f4             	push   -0xc(%ebp)
+  803215:	6a 00                	push   $0x0
+  803217:	e8 2c db ff ff       	call   800d48 <sys_page_alloc>
+  80321c:	83 c4 10             	add    $0x10,%esp
+  80321f:	85 c0                	test   %eax,%eax
+  803221:	78 21                	js     803244 <opencons+0x50>
+  803223:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803226:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80322c:	89 10                	mov    %edx,(%eax)
+  80322e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803231:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803238:	83 ec 0c             	sub    $0xc,%esp
+  80323b:	50                   	push   %eax
+  80323c:	e8 a6 e8 ff ff       	call   801ae7 <fd2num>
+  803241:	83 c4 10             	add    $0x10,%esp
+  803244:	c9                   	leave
+  803245:	c3                   	ret
+
+00803246 <_panic>:
+  803246:	55                   	push   %ebp
+  803247:	89 e5                	mov    %esp,%ebp
+  803249:	56                   	push   %esi
+  80324a:	53                   	push   %ebx
+  80324b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80324e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803254:	e8 85 da ff ff       	call   800cde <sys_getenvid>
+  803259:	83 ec 0c             	sub    $0xc,%esp
+  80325c:	ff 75 0c             	push   0xc(%ebp)
+  80325f:	ff 75 08             	push   0x8(%ebp)
+  803262:	56                   	push   %esi
+  803263:	50                   	push   %eax
+  803264:	68 5c 3d 80 00       	push   $0x803d5c
+  803269:	e8 83 cf ff ff       	call   8001f1 <cprintf>
+  80326e:	83 c4 18             	add    $0x18,%esp
+  803271:	53                   	push   %ebx
+  803272:	ff 75 10             	push   0x10(%ebp)
+  803275:	e8 26 cf ff ff       	call   8001a0 <vcprintf>
+  80327a:	c7 04 24 ef 37 80 00 	movl   $0x8037ef,(%esp)
+  803281:	e8 6b cf ff ff       	call   8001f1 <cprintf>
+  803286:	83 c4 10             	add    $0x10,%esp
+  803289:	cc                   	int3
+  80328a:	eb fd                	jmp    803289 <_panic+0x43>
+
+0080328c <set_pgfault_handler>:
+  80328c:	55                   	push   %ebp
+  80328d:	89 e5                	mov    %esp,%ebp
+  80328f:	53                   	push   %ebx
+  803290:	83 ec 04             	sub    $0x4,%esp
+  803293:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80329a:	74 0d                	je     8032a9 <set_pgfault_handler+0x1d>
+  80329c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329f:	a3 00 80 80 00       	mov    %eax,0x808000
+  8032a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a7:	c9                   	leave
+  8032a8:	c3                   	ret
+  8032a9:	e8 30 da ff ff       	call   800cde <sys_getenvid>
+  8032ae:	89 c3                	mov    %eax,%ebx
+  8032b0:	83 ec 04             	sub    $0x4,%esp
+  8032b3:	6a 07                	push   $0x7
+  8032b5:	68 00 f0 7f ee       	push   $0xee7ff000
+  8032ba:	50                   	push   %eax
+  8032bb:	e8 88 da ff ff       	call   800d48 <sys_page_alloc>
+  8032c0:	83 c4 10             	add    $0x10,%esp
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	78 29                	js     8032f0 <set_pgfault_handler+0x64>
+  8032c7:	83 ec 08             	sub    $0x8,%esp
+  8032ca:	68 04 33 80 00       	push   $0x803304
+  8032cf:	53                   	push   %ebx
+  8032d0:	e8 8c dc ff ff       	call   800f61 <sys_env_set_pgfault_upcall>
+  8032d5:	83 c4 10             	add    $0x10,%esp
+  8032d8:	85 c0                	test   %eax,%eax
+  8032da:	79 c0                	jns    80329c <set_pgfault_handler+0x10>
+  8032dc:	83 ec 04             	sub    $0x4,%esp
+  8032df:	68 b8 3d 80 00       	push   $0x803db8
+  8032e4:	6a 27                	push   $0x27
+  8032e6:	68 ea 3d 80 00       	push   $0x803dea
+  8032eb:	e8 56 ff ff ff       	call   803246 <_panic>
+  8032f0:	83 ec 04             	sub    $0x4,%esp
+  8032f3:	68 80 3d 80 00       	push   $0x803d80
+  8032f8:	6a 23                	push   $0x23
+  8032fa:	68 ea 3d 80 00       	push   $0x803dea
+  8032ff:	e8 42 ff ff ff       	call   803246 <_panic>
+
+00803304 <_pgfault_upcall>:
+  803304:	54                   	push   %esp
+  803305:	a1 00 80 80 00       	mov    0x808000,%eax
+  80330a:	ff d0                	call   *%eax
+  80330c:	83 c4 04             	add    $0x4,%esp
+  80330f:	89 e3                	mov    %esp,%ebx
+  803311:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803315:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803319:	89 d4                	mov    %edx,%esp
+  80331b:	51                   	push   %ecx
+  80331c:	89 dc                	mov    %ebx,%esp
+  80331e:	83 ea 04             	sub    $0x4,%edx
+  803321:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803325:	83 c4 08             	add    $0x8,%esp
+  803328:	61                   	popa
+  803329:	83 c4 04             	add    $0x4,%esp
+  80332c:	9d                   	popf
+  80332d:	5c                   	pop    %esp
+  80332e:	c3                   	ret
+
+0080332f <ipc_recv>:
+  80332f:	55                   	push   %ebp
+  803330:	89 e5                	mov    %esp,%ebp
+  803332:	56                   	push   %esi
+  803333:	53                   	push   %ebx
+  803334:	8b 75 08             	mov    0x8(%ebp),%esi
+  803337:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80333a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80333d:	85 c0                	test   %eax,%eax
+  80333f:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803344:	0f 44 c2             	cmove  %edx,%eax
+  803347:	83 ec 0c             	sub    $0xc,%esp
+  80334a:	50                   	push   %eax
+  80334b:	e8 a3 dc ff ff       	call   800ff3 <sys_ipc_recv>
+  803350:	83 c4 10             	add    $0x10,%esp
+  803353:	85 c0                	test   %eax,%eax
+  803355:	78 2a                	js     803381 <ipc_recv+0x52>
+  803357:	a1 14 50 80 00       	mov    0x805014,%eax
+  80335c:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803362:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803368:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80336e:	85 f6                	test   %esi,%esi
+  803370:	74 02                	je     803374 <ipc_recv+0x45>
+  803372:	89 0e                	mov    %ecx,(%esi)
+  803374:	85 db                	test   %ebx,%ebx
+  803376:	74 02                	je     80337a <ipc_recv+0x4b>
+  803378:	89 13                	mov    %edx,(%ebx)
+  80337a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80337d:	5b                   	pop    %ebx
+  80337e:	5e                   	pop    %esi
+  80337f:	5d                   	pop    %ebp
+  803380:	c3                   	ret
+  803381:	ba 00 00 00 00       	mov    $0x0,%edx
+  803386:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80338b:	eb e1                	jmp    80336e <ipc_recv+0x3f>
+
+0080338d <ipc_send>:
+  80338d:	55                   	push   %ebp
+  80338e:	89 e5                	mov    %esp,%ebp
+  803390:	57                   	push   %edi
+  803391:	56                   	push   %esi
+  803392:	53                   	push   %ebx
+  803393:	83 ec 0c             	sub    $0xc,%esp
+  803396:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803399:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80339c:	8b 75 14             	mov    0x14(%ebp),%esi
+  80339f:	85 db                	test   %ebx,%ebx
+  8033a1:	74 1e                	je     8033c1 <ipc_send+0x34>
+  8033a3:	56                   	push   %esi
+  8033a4:	53                   	push   %ebx
+  8033a5:	57                   	push   %edi
+  8033a6:	ff 75 08             	push   0x8(%ebp)
+  8033a9:	e8 d2 dc ff ff       	call   801080 <sys_ipc_send>
+  8033ae:	83 c4 10             	add    $0x10,%esp
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	74 2a                	je     8033df <ipc_send+0x52>
+  8033b5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033b8:	75 13                	jne    8033cd <ipc_send+0x40>
+  8033ba:	e8 3e d9 ff ff       	call   800cfd <sys_yield>
+  8033bf:	eb e2                	jmp    8033a3 <ipc_send+0x16>
+  8033c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8033c6:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8033cb:	eb d6                	jmp    8033a3 <ipc_send+0x16>
+  8033cd:	50                   	push   %eax
+  8033ce:	68 f8 3d 80 00       	push   $0x803df8
+  8033d3:	6a 4f                	push   $0x4f
+  8033d5:	68 3b 3e 80 00       	push   $0x803e3b
+  8033da:	e8 67 fe ff ff       	call   803246 <_panic>
+  8033df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e2:	5b                   	pop    %ebx
+  8033e3:	5e                   	pop    %esi
+  8033e4:	5f                   	pop    %edi
+  8033e5:	5d                   	pop    %ebp
+  8033e6:	c3                   	ret
+
+008033e7 <ipc_call>:
+  8033e7:	55                   	push   %ebp
+  8033e8:	89 e5                	mov    %esp,%ebp
+  8033ea:	57                   	push   %edi
+  8033eb:	56                   	push   %esi
+  8033ec:	53                   	push   %ebx
+  8033ed:	83 ec 0c             	sub    $0xc,%esp
+  8033f0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033f4:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8033f9:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8033fd:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803401:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803406:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80340a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80340e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803413:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803417:	eb 05                	jmp    80341e <ipc_call+0x37>
+  803419:	e8 df d8 ff ff       	call   800cfd <sys_yield>
+  80341e:	83 ec 0c             	sub    $0xc,%esp
+  803421:	56                   	push   %esi
+  803422:	53                   	push   %ebx
+  803423:	57                   	push   %edi
+  803424:	ff 75 0c             	push   0xc(%ebp)
+  803427:	ff 75 08             	push   0x8(%ebp)
+  80342a:	e8 a1 dc ff ff       	call   8010d0 <sys_ipc_call>
+  80342f:	83 c4 20             	add    $0x20,%esp
+  803432:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803435:	74 e2                	je     803419 <ipc_call+0x32>
+  803437:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80343a:	74 2d                	je     803469 <ipc_call+0x82>
+  80343c:	85 c0                	test   %eax,%eax
+  80343e:	78 4f                	js     80348f <ipc_call+0xa8>
+  803440:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803444:	74 10                	je     803456 <ipc_call+0x6f>
+  803446:	a1 14 50 80 00       	mov    0x805014,%eax
+  80344b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803451:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803454:	89 02                	mov    %eax,(%edx)
+  803456:	a1 14 50 80 00       	mov    0x805014,%eax
+  80345b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803461:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803464:	5b                   	pop    %ebx
+  803465:	5e                   	pop    %esi
+  803466:	5f                   	pop    %edi
+  803467:	5d                   	pop    %ebp
+  803468:	c3                   	ret
+  803469:	ff 75 14             	push   0x14(%ebp)
+  80346c:	ff 75 10             	push   0x10(%ebp)
+  80346f:	ff 75 0c             	push   0xc(%ebp)
+  803472:	ff 75 08             	push   0x8(%ebp)
+  803475:	e8 13 ff ff ff       	call   80338d <ipc_send>
+  80347a:	83 c4 0c             	add    $0xc,%esp
+  80347d:	ff 75 1c             	push   0x1c(%ebp)
+  803480:	ff 75 18             	push   0x18(%ebp)
+  803483:	6a 00                	push   $0x0
+  803485:	e8 a5 fe ff ff       	call   80332f <ipc_recv>
+  80348a:	83 c4 10             	add    $0x10,%esp
+  80348d:	eb d2                	jmp    803461 <ipc_call+0x7a>
+  80348f:	50                   	push   %eax
+  803490:	68 45 3e 80 00       	push   $0x803e45
+  803495:	6a 6d                	push   $0x6d
+  803497:	68 3b 3e 80 00       	push   $0x803e3b
+  80349c:	e8 a5 fd ff ff       	call   803246 <_panic>
+
+008034a1 <ipc_reply_recv>:
+  8034a1:	55                   	push   %ebp
+  8034a2:	89 e5                	mov    %esp,%ebp
+  8034a4:	57                   	push   %edi
+  8034a5:	56                   	push   %esi
+  8034a6:	53                   	push   %ebx
+  8034a7:	83 ec 0c             	sub    $0xc,%esp
+  8034aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034ad:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8034b0:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8034b3:	85 db                	test   %ebx,%ebx
+  8034b5:	0f 84 ac 00 00 00    	je     803567 <ipc_reply_recv+0xc6>
+  8034bb:	85 f6                	test   %esi,%esi
+  8034bd:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8034c2:	0f 45 c6             	cmovne %esi,%eax
+  8034c5:	83 ec 0c             	sub    $0xc,%esp
+  8034c8:	50                   	push   %eax
+  8034c9:	ff 75 14             	push   0x14(%ebp)
+  8034cc:	53                   	push   %ebx
+  8034cd:	ff 75 0c             	push   0xc(%ebp)
+  8034d0:	ff 75 08             	push   0x8(%ebp)
+  8034d3:	e8 19 dc ff ff       	call   8010f1 <sys_ipc_reply_recv>
+  8034d8:	83 c4 20             	add    $0x20,%esp
+  8034db:	85 c0                	test   %eax,%eax
+  8034dd:	78 3a                	js     803519 <ipc_reply_recv+0x78>
+  8034df:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8034e3:	74 10                	je     8034f5 <ipc_reply_recv+0x54>
+  8034e5:	a1 14 50 80 00       	mov    0x805014,%eax
+  8034ea:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8034f0:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034f3:	89 02                	mov    %eax,(%edx)
+  8034f5:	85 ff                	test   %edi,%edi
+  8034f7:	74 0d                	je     803506 <ipc_reply_recv+0x65>
+  8034f9:	a1 14 50 80 00       	mov    0x805014,%eax
+  8034fe:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803504:	89 07                	mov    %eax,(%edi)
+  803506:	a1 14 50 80 00       	mov    0x805014,%eax
+  80350b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803514:	5b                   	pop    %ebx
+  803515:	5e                   	pop    %esi
+  803516:	5f                   	pop    %edi
+  803517:	5d                   	pop    %ebp
+  803518:	c3                   	ret
+  803519:	ff 75 14             	push   0x14(%ebp)
+  80351c:	53                   	push   %ebx
+  80351d:	ff 75 0c             	push   0xc(%ebp)
+  803520:	ff 75 08             	push   0x8(%ebp)
+  803523:	e8 7b da ff ff       	call   800fa3 <sys_ipc_try_send>
+  803528:	89 c2                	mov    %eax,%edx
+  80352a:	c1 ea 1f             	shr    $0x1f,%edx
+  80352d:	83 c4 10             	add    $0x10,%esp
+  803530:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803533:	0f 95 c1             	setne  %cl
+  803536:	84 d1                	test   %dl,%cl
+  803538:	74 05                	je     80353f <ipc_reply_recv+0x9e>
+  80353a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80353d:	75 12                	jne    803551 <ipc_reply_recv+0xb0>
+  80353f:	83 ec 04             	sub    $0x4,%esp
+  803542:	57                   	push   %edi
+  803543:	56                   	push   %esi
+  803544:	ff 75 18             	push   0x18(%ebp)
+  803547:	e8 e3 fd ff ff       	call   80332f <ipc_recv>
+  80354c:	83 c4 10             	add    $0x10,%esp
+  80354f:	eb c0                	jmp    803511 <ipc_reply_recv+0x70>
+  803551:	83 ec 04             	sub    $0x4,%esp
+  803554:	50                   	push   %eax
+  803555:	ff 75 08             	push   0x8(%ebp)
+  803558:	68 18 3e 80 00       	push   $0x803e18
+  80355d:	e8 8f cc ff ff       	call   8001f1 <cprintf>
+  803562:	83 c4 10             	add    $0x10,%esp
+  803565:	eb d8                	jmp    80353f <ipc_reply_recv+0x9e>
+  803567:	85 f6                	test   %esi,%esi
+  803569:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80356e:	0f 45 c6             	cmovne %esi,%eax
+  803571:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803576:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80357d:	e9 43 ff ff ff       	jmp    8034c5 <ipc_reply_recv+0x24>
+
+00803582 <ipc_find_env>:
+  803582:	55                   	push   %ebp
+  803583:	89 e5                	mov    %esp,%ebp
+  803585:	83 ec 14             	sub    $0x14,%esp
+  803588:	ff 75 08             	push   0x8(%ebp)
+  80358b:	e8 b1 d9 ff ff       	call   800f41 <sys_env_service>
+  803590:	85 c0                	test   %eax,%eax
+  803592:	ba 00 00 00 00       	mov    $0x0,%edx
+  803597:	0f 48 c2             	cmovs  %edx,%eax
+  80359a:	c9                   	leave
+  80359b:	c3                   	ret
+
+0080359c <pageref>:
+  80359c:	55                   	push   %ebp
+  80359d:	89 e5                	mov    %esp,%ebp
+  80359f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035a2:	89 c2                	mov    %eax,%edx
+  8035a4:	c1 ea 16             	shr    $0x16,%edx
+  8035a7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8035ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b3:	f6 c1 01             	test   $0x1,%cl
+  8035b6:	74 22                	je     8035da <pageref+0x3e>
+  8035b8:	c1 e8 0c             	shr    $0xc,%eax
+  8035bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035c2:	a8 01                	test   $0x1,%al
+  8035c4:	74 14                	je     8035da <pageref+0x3e>
+  8035c6:	c1 e8 0c             	shr    $0xc,%eax
+  8035c9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035cc:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035d3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035d7:	0f b7 d2             	movzwl %dx,%edx
+  8035da:	89 d0                	mov    %edx,%eax
+  8035dc:	5d                   	pop    %ebp
+  8035dd:	c3                   	ret
+
+008035de <__udivmoddi4>:
+  8035de:	55                   	push   %ebp
+  8035df:	57                   	push   %edi
+  8035e0:	56                   	push   %esi
+  8035e1:	53                   	push   %ebx
+  8035e2:	83 ec 24             	sub    $0x24,%esp
+  8035e5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035e9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035ed:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035f1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035f5:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8035f9:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8035fd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803601:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803605:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803613:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803618:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80361f:	00 
+  803620:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803627:	00 
+  803628:	89 fb                	mov    %edi,%ebx
+  80362a:	eb 08                	jmp    803634 <__udivmoddi4+0x56>
+  80362c:	83 e9 01             	sub    $0x1,%ecx
+  80362f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803632:	74 68                	je     80369c <__udivmoddi4+0xbe>
+  803634:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803638:	01 c0                	add    %eax,%eax
+  80363a:	89 c6                	mov    %eax,%esi
+  80363c:	89 d7                	mov    %edx,%edi
+  80363e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803642:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803646:	0f ad d0             	shrd   %cl,%edx,%eax
+  803649:	d3 ea                	shr    %cl,%edx
+  80364b:	f6 c1 20             	test   $0x20,%cl
+  80364e:	74 04                	je     803654 <__udivmoddi4+0x76>
+  803650:	89 d0                	mov    %edx,%eax
+  803652:	31 d2                	xor    %edx,%edx
+  803654:	83 e0 01             	and    $0x1,%eax
+  803657:	89 04 24             	mov    %eax,(%esp)
+  80365a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803661:	00 
+  803662:	8b 04 24             	mov    (%esp),%eax
+  803665:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803669:	09 f0                	or     %esi,%eax
+  80366b:	09 fa                	or     %edi,%edx
+  80366d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803671:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803675:	39 f0                	cmp    %esi,%eax
+  803677:	89 d5                	mov    %edx,%ebp
+  803679:	19 fd                	sbb    %edi,%ebp
+  80367b:	72 af                	jb     80362c <__udivmoddi4+0x4e>
+  80367d:	29 f0                	sub    %esi,%eax
+  80367f:	19 fa                	sbb    %edi,%edx
+  803681:	89 cf                	mov    %ecx,%edi
+  803683:	c1 ef 05             	shr    $0x5,%edi
+  803686:	83 e7 01             	and    $0x1,%edi
+  803689:	89 fe                	mov    %edi,%esi
+  80368b:	83 f6 01             	xor    $0x1,%esi
+  80368e:	d3 e6                	shl    %cl,%esi
+  803690:	d3 e7                	shl    %cl,%edi
+  803692:	09 74 24 18          	or     %esi,0x18(%esp)
+  803696:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80369a:	eb 90                	jmp    80362c <__udivmoddi4+0x4e>
+  80369c:	85 db                	test   %ebx,%ebx
+  80369e:	74 05                	je     8036a5 <__udivmoddi4+0xc7>
+  8036a0:	89 03                	mov    %eax,(%ebx)
+  8036a2:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036a5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036a9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036ad:	83 c4 24             	add    $0x24,%esp
+  8036b0:	5b                   	pop    %ebx
+  8036b1:	5e                   	pop    %esi
+  8036b2:	5f                   	pop    %edi
+  8036b3:	5d                   	pop    %ebp
+  8036b4:	c3                   	ret
+
+008036b5 <__udivdi3>:
+  8036b5:	83 ec 08             	sub    $0x8,%esp
+  8036b8:	6a 00                	push   $0x0
+  8036ba:	ff 74 24 1c          	push   0x1c(%esp)
+  8036be:	ff 74 24 1c          	push   0x1c(%esp)
+  8036c2:	ff 74 24 1c          	push   0x1c(%esp)
+  8036c6:	ff 74 24 1c          	push   0x1c(%esp)
+  8036ca:	e8 0f ff ff ff       	call   8035de <__udivmoddi4>
+  8036cf:	83 c4 1c             	add    $0x1c,%esp
+  8036d2:	c3                   	ret
+
+008036d3 <__umoddi3>:
+  8036d3:	83 ec 18             	sub    $0x18,%esp
+  8036d6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036da:	50                   	push   %eax
+  8036db:	ff 74 24 2c          	push   0x2c(%esp)
+  8036df:	ff 74 24 2c          	push   0x2c(%esp)
+  8036e3:	ff 74 24 2c          	push   0x2c(%esp)
+  8036e7:	ff 74 24 2c          	push   0x2c(%esp)
+  8036eb:	e8 ee fe ff ff       	call   8035de <__udivmoddi4>
+  8036f0:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8036f4:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8036f8:	83 c4 2c             	add    $0x2c,%esp
+  8036fb:	c3                   	ret
+
+008036fc <__divdi3>:
+  8036fc:	53                   	push   %ebx
+  8036fd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803701:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803705:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803709:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80370d:	85 d2                	test   %edx,%edx
+  80370f:	78 12                	js     803723 <__divdi3+0x27>
+  803711:	85 db                	test   %ebx,%ebx
+  803713:	78 2e                	js     803743 <__divdi3+0x47>
+  803715:	53                   	push   %ebx
+  803716:	51                   	push   %ecx
+  803717:	52                   	push   %edx
+  803718:	50                   	push   %eax
+  803719:	e8 97 ff ff ff       	call   8036b5 <__udivdi3>
+  80371e:	83 c4 10             	add    $0x10,%esp
+  803721:	eb 1e                	jmp    803741 <__divdi3+0x45>
+  803723:	f7 d8                	neg    %eax
+  803725:	83 d2 00             	adc    $0x0,%edx
+  803728:	f7 da                	neg    %edx
+  80372a:	85 db                	test   %ebx,%ebx
+  80372c:	78 2a                	js     803758 <__divdi3+0x5c>
+  80372e:	53                   	push   %ebx
+  80372f:	51                   	push   %ecx
+  803730:	52                   	push   %edx
+  803731:	50                   	push   %eax
+  803732:	e8 7e ff ff ff       	call   8036b5 <__udivdi3>
+  803737:	83 c4 10             	add    $0x10,%esp
+  80373a:	f7 d8                	neg    %eax
+  80373c:	83 d2 00             	adc    $0x0,%edx
+  80373f:	f7 da                	neg    %edx
+  803741:	5b                   	pop    %ebx
+  803742:	c3                   	ret
+  803743:	f7 d9                	neg    %ecx
+  803745:	83 d3 00             	adc    $0x0,%ebx
+  803748:	f7 db                	neg    %ebx
+  80374a:	53                   	push   %ebx
+  80374b:	51                   	push   %ecx
+  80374c:	52                   	push   %edx
+  80374d:	50                   	push   %eax
+  80374e:	e8 62 ff ff ff       	call   8036b5 <__udivdi3>
+  803753:	83 c4 10             	add    $0x10,%esp
+  803756:	eb e2                	jmp    80373a <__divdi3+0x3e>
+  803758:	f7 d9                	neg    %ecx
+  80375a:	83 d3 00             	adc    $0x0,%ebx
+  80375d:	f7 db                	neg    %ebx
+  80375f:	53                   	push   %ebx
+  803760:	51                   	push   %ecx
+  803761:	52                   	push   %edx
+  803762:	50                   	push   %eax
+  803763:	e8 4d ff ff ff       	call   8036b5 <__udivdi3>
+  803768:	83 c4 10             	add    $0x10,%esp
+  80376b:	eb d4                	jmp    803741 <__divdi3+0x45>
+
+0080376d <__moddi3>:
+  80376d:	55                   	push   %ebp
+  80376e:	57                   	push   %edi
+  80376f:	56                   	push   %esi
+  803770:	53                   	push   %ebx
+  803771:	83 ec 0c             	sub    $0xc,%esp
+  803774:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803778:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80377c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803780:	89 e9                	mov    %ebp,%ecx
+  803782:	f7 d9                	neg    %ecx
+  803784:	89 d0                	mov    %edx,%eax
+  803786:	83 d0 00             	adc    $0x0,%eax
+  803789:	f7 d8                	neg    %eax
+  80378b:	0f 49 e9             	cmovns %ecx,%ebp
+  80378e:	0f 49 d0             	cmovns %eax,%edx
+  803791:	52                   	push   %edx
+  803792:	55                   	push   %ebp
+  803793:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803797:	f7 da                	neg    %edx
+  803799:	89 d8                	mov    %ebx,%eax
+  80379b:	83 d0 00             	adc    $0x0,%eax
+  80379e:	f7 d8                	neg    %eax
+  8037a0:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8037a5:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8037a9:	0f 48 c3             	cmovs  %ebx,%eax
+  8037ac:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8037b0:	ff 74 24 0c          	push   0xc(%esp)
+  8037b4:	ff 74 24 0c          	push   0xc(%esp)
+  8037b8:	e8 16 ff ff ff       	call   8036d3 <__umoddi3>
+  8037bd:	83 c4 10             	add    $0x10,%esp
+  8037c0:	85 db                	test   %ebx,%ebx
+  8037c2:	78 08                	js     8037cc <__moddi3+0x5f>
+  8037c4:	83 c4 0c             	add    $0xc,%esp
+  8037c7:	5b                   	pop    %ebx
+  8037c8:	5e                   	pop    %esi
+  8037c9:	5f                   	pop    %edi
+  8037ca:	5d                   	pop    %ebp
+  8037cb:	c3                   	ret
+  8037cc:	f7 d8                	neg    %eax
+  8037ce:	83 d2 00             	adc    $0x0,%edx
+  8037d1:	f7 da                	neg    %edx
+  8037d3:	eb ef                	jmp    8037c4 <__moddi3+0x57>
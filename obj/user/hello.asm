@@ -0,0 +1,5537 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 92 00 00 00       	call   8000c3 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	e8 37 17 00 00       	call   801776 <fork>
+  80003f:	85 c0                	test   %eax,%eax
+  800041:	75 47                	jne    80008a <umain+0x57>
+  800043:	83 ec 0c             	sub    $0xc,%esp
+  800046:	68 14 50 80 00       	push   $0x805014
+  80004b:	e8 3b 13 00 00       	call   80138b <sys_migrate>
+  800050:	a1 14 50 80 00       	mov    0x805014,%eax
+  800055:	8b 40 48             	mov    0x48(%eax),%eax
+  800058:	83 c4 08             	add    $0x8,%esp
+  80005b:	50                   	push   %eax
+  80005c:	68 c0 37 80 00       	push   $0x8037c0
+  800061:	e8 6b 01 00 00       	call   8001d1 <cprintf>
+  800066:	83 c4 0c             	add    $0xc,%esp
+  800069:	6a 00                	push   $0x0
+  80006b:	6a 00                	push   $0x0
+  80006d:	6a 00                	push   $0x0
+  80006f:	e8 53 1a 00 00       	call   801ac7 <ipc_recv>
+  800074:	83 c4 08             	add    $0x8,%esp
+  800077:	50                   	push   %eax
+  800078:	68 20 38 80 00       	push   $0x803820
+  80007d:	e8 4f 01 00 00       	call   8001d1 <cprintf>
+  800082:	83 c4 10             	add    $0x10,%esp
+  800085:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800088:	c9                   	leave
+  800089:	c3                   	ret
+  80008a:	89 c3                	mov    %eax,%ebx
+  80008c:	a1 14 50 80 00       	mov    0x805014,%eax
+  800091:	8b 40 48             	mov    0x48(%eax),%eax
+  800094:	83 ec 08             	sub    $0x8,%esp
+  800097:	50                   	push   %eax
+  800098:	68 f0 37 80 00       	push   $0x8037f0
+  80009d:	e8 2f 01 00 00       	call   8001d1 <cprintf>
+  8000a2:	6a 00                	push   $0x0
+  8000a4:	6a 00                	push   $0x0
+  8000a6:	68 00 01 00 00       	push   $0x100
+  8000ab:	53                   	push   %ebx
+  8000ac:	e8 74 1a 00 00       	call   801b25 <ipc_send>
+  8000b1:	83 c4 14             	add    $0x14,%esp
+  8000b4:	68 38 38 80 00       	push   $0x803838
+  8000b9:	e8 13 01 00 00       	call   8001d1 <cprintf>
+  8000be:	83 c4 10             	add    $0x10,%esp
+  8000c1:	eb c2                	jmp    800085 <umain+0x52>
+
+008000c3 <libmain>:
+  8000c3:	55                   	push   %ebp
+  8000c4:	89 e5                	mov    %esp,%ebp
+  8000c6:	56                   	push   %esi
+  8000c7:	53                   	push   %ebx
+  8000c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ce:	e8 eb 0b 00 00       	call   800cbe <sys_getenvid>
+  8000d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e3:	a3 14 50 80 00       	mov    %eax,0x805014
+  8000e8:	85 db                	test   %ebx,%ebx
+  8000ea:	7e 07                	jle    8000f3 <libmain+0x30>
+  8000ec:	8b 06                	mov    (%esi),%eax
+  8000ee:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000f3:	83 ec 08             	sub    $0x8,%esp
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+  8000f8:	e8 36 ff ff ff       	call   800033 <umain>
+  8000fd:	e8 0a 00 00 00       	call   80010c <exit>
+  800102:	83 c4 10             	add    $0x10,%esp
+  800105:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800108:	5b                   	pop    %ebx
+  800109:	5e                   	pop    %esi
+  80010a:	5d                   	pop    %ebp
+  80010b:	c3                   	ret
+
+0080010c <exit>:
+  80010c:	55                   	push   %ebp
+  80010d:	89 e5                	mov    %esp,%ebp
+  80010f:	83 ec 08             	sub    $0x8,%esp
+  800112:	a1 14 50 80 00       	mov    0x805014,%eax
+  800117:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80011d:	85 c0                	test   %eax,%eax
+  80011f:	75 14                	jne    800135 <exit+0x29>
+  800121:	e8 d8 1d 00 00       	call   801efe <close_all>
+  800126:	83 ec 0c             	sub    $0xc,%esp
+  800129:	6a 00                	push   $0x0
+  80012b:	e8 4d 0b 00 00       	call   800c7d <sys_env_destroy>
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	c9                   	leave
+  800134:	c3                   	ret
+  800135:	e8 b0 12 00 00       	call   8013ea <sys_lease_complete>
+  80013a:	eb e5                	jmp    800121 <exit+0x15>
+
+0080013c <putch>:
+  80013c:	55                   	push   %ebp
+  80013d:	89 e5                	mov    %esp,%ebp
+  80013f:	53                   	push   %ebx
+  800140:	83 ec 04             	sub    $0x4,%esp
+  800143:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800146:	8b 13                	mov    (%ebx),%edx
+  800148:	8d 42 01             	lea    0x1(%edx),%eax
+  80014b:	89 03                	mov    %eax,(%ebx)
+  80014d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800150:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800154:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800159:	74 09                	je     800164 <putch+0x28>
+  80015b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80015f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800162:	c9                   	leave
+  800163:	c3                   	ret
+  800164:	83 ec 08             	sub    $0x8,%esp
+  800167:	68 ff 00 00 00       	push   $0xff
+  80016c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80016f:	50                   	push   %eax
+  800170:	e8 cb 0a 00 00       	call   800c40 <sys_cputs>
+  800175:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80017b:	83 c4 10             	add    $0x10,%esp
+  80017e:	eb db                	jmp    80015b <putch+0x1f>
+
+00800180 <vcprintf>:
+  800180:	55                   	push   %ebp
+  800181:	89 e5                	mov    %esp,%ebp
+  800183:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800189:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800190:	00 00 00 
+  800193:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80019a:	00 00 00 
+  80019d:	ff 75 0c             	push   0xc(%ebp)
+  8001a0:	ff 75 08             	push   0x8(%ebp)
+  8001a3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	68 3c 01 80 00       	push   $0x80013c
+  8001af:	e8 1c 01 00 00       	call   8002d0 <vprintfmt>
+  8001b4:	83 c4 08             	add    $0x8,%esp
+  8001b7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001bd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001c3:	50                   	push   %eax
+  8001c4:	e8 77 0a 00 00       	call   800c40 <sys_cputs>
+  8001c9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001cf:	c9                   	leave
+  8001d0:	c3                   	ret
+
+008001d1 <cprintf>:
+  8001d1:	55                   	push   %ebp
+  8001d2:	89 e5                	mov    %esp,%ebp
+  8001d4:	83 ec 10             	sub    $0x10,%esp
+  8001d7:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001da:	50                   	push   %eax
+  8001db:	ff 75 08             	push   0x8(%ebp)
+  8001de:	e8 9d ff ff ff       	call   800180 <vcprintf>
+  8001e3:	c9                   	leave
+  8001e4:	c3                   	ret
+
+008001e5 <printnum>:
+  8001e5:	55                   	push   %ebp
+  8001e6:	89 e5                	mov    %esp,%ebp
+  8001e8:	57                   	push   %edi
+  8001e9:	56                   	push   %esi
+  8001ea:	53                   	push   %ebx
+  8001eb:	83 ec 1c             	sub    $0x1c,%esp
+  8001ee:	89 c3                	mov    %eax,%ebx
+  8001f0:	89 d6                	mov    %edx,%esi
+  8001f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001f8:	89 d1                	mov    %edx,%ecx
+  8001fa:	89 c2                	mov    %eax,%edx
+  8001fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001ff:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800202:	8b 45 10             	mov    0x10(%ebp),%eax
+  800205:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800208:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80020f:	39 c2                	cmp    %eax,%edx
+  800211:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800214:	73 4b                	jae    800261 <printnum+0x7c>
+  800216:	8b 45 14             	mov    0x14(%ebp),%eax
+  800219:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80021c:	85 ff                	test   %edi,%edi
+  80021e:	7e 11                	jle    800231 <printnum+0x4c>
+  800220:	83 ec 08             	sub    $0x8,%esp
+  800223:	56                   	push   %esi
+  800224:	ff 75 18             	push   0x18(%ebp)
+  800227:	ff d3                	call   *%ebx
+  800229:	83 c4 10             	add    $0x10,%esp
+  80022c:	83 ef 01             	sub    $0x1,%edi
+  80022f:	75 ef                	jne    800220 <printnum+0x3b>
+  800231:	83 ec 08             	sub    $0x8,%esp
+  800234:	56                   	push   %esi
+  800235:	83 ec 04             	sub    $0x4,%esp
+  800238:	ff 75 e4             	push   -0x1c(%ebp)
+  80023b:	ff 75 e0             	push   -0x20(%ebp)
+  80023e:	ff 75 dc             	push   -0x24(%ebp)
+  800241:	ff 75 d8             	push   -0x28(%ebp)
+  800244:	e8 6a 34 00 00       	call   8036b3 <__umoddi3>
+  800249:	83 c4 14             	add    $0x14,%esp
+  80024c:	0f be 80 57 38 80 00 	movsbl 0x803857(%eax),%eax
+  800253:	50                   	push   %eax
+  800254:	ff d3                	call   *%ebx
+  800256:	83 c4 10             	add    $0x10,%esp
+  800259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025c:	5b                   	pop    %ebx
+  80025d:	5e                   	pop    %esi
+  80025e:	5f                   	pop    %edi
+  80025f:	5d                   	pop    %ebp
+  800260:	c3                   	ret
+  800261:	83 ec 0c             	sub    $0xc,%esp
+  800264:	ff 75 18             	push   0x18(%ebp)
+  800267:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80026a:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80026d:	52                   	push   %edx
+  80026e:	50                   	push   %eax
+  80026f:	83 ec 08             	sub    $0x8,%esp
+  800272:	ff 75 e4             	push   -0x1c(%ebp)
+  800275:	ff 75 e0             	push   -0x20(%ebp)
+  800278:	ff 75 dc             	push   -0x24(%ebp)
+  80027b:	ff 75 d8             	push   -0x28(%ebp)
+  80027e:	e8 12 34 00 00       	call   803695 <__udivdi3>
+  800283:	83 c4 18             	add    $0x18,%esp
+  800286:	52                   	push   %edx
+  800287:	50                   	push   %eax
+  800288:	89 f2                	mov    %esi,%edx
+  80028a:	89 d8                	mov    %ebx,%eax
+  80028c:	e8 54 ff ff ff       	call   8001e5 <printnum>
+  800291:	83 c4 20             	add    $0x20,%esp
+  800294:	eb 9b                	jmp    800231 <printnum+0x4c>
+
+00800296 <sprintputch>:
+  800296:	55                   	push   %ebp
+  800297:	89 e5                	mov    %esp,%ebp
+  800299:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80029c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002a0:	8b 10                	mov    (%eax),%edx
+  8002a2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a5:	73 0a                	jae    8002b1 <sprintputch+0x1b>
+  8002a7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002aa:	89 08                	mov    %ecx,(%eax)
+  8002ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002af:	88 02                	mov    %al,(%edx)
+  8002b1:	5d                   	pop    %ebp
+  8002b2:	c3                   	ret
+
+008002b3 <printfmt>:
+  8002b3:	55                   	push   %ebp
+  8002b4:	89 e5                	mov    %esp,%ebp
+  8002b6:	83 ec 08             	sub    $0x8,%esp
+  8002b9:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002bc:	50                   	push   %eax
+  8002bd:	ff 75 10             	push   0x10(%ebp)
+  8002c0:	ff 75 0c             	push   0xc(%ebp)
+  8002c3:	ff 75 08             	push   0x8(%ebp)
+  8002c6:	e8 05 00 00 00       	call   8002d0 <vprintfmt>
+  8002cb:	83 c4 10             	add    $0x10,%esp
+  8002ce:	c9                   	leave
+  8002cf:	c3                   	ret
+
+008002d0 <vprintfmt>:
+  8002d0:	55                   	push   %ebp
+  8002d1:	89 e5                	mov    %esp,%ebp
+  8002d3:	57                   	push   %edi
+  8002d4:	56                   	push   %esi
+  8002d5:	53                   	push   %ebx
+  8002d6:	83 ec 2c             	sub    $0x2c,%esp
+  8002d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002dc:	89 df                	mov    %ebx,%edi
+  8002de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002e1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002e4:	8d 70 01             	lea    0x1(%eax),%esi
+  8002e7:	0f b6 00             	movzbl (%eax),%eax
+  8002ea:	83 f8 25             	cmp    $0x25,%eax
+  8002ed:	74 1e                	je     80030d <vprintfmt+0x3d>
+  8002ef:	85 c0                	test   %eax,%eax
+  8002f1:	0f 84 15 05 00 00    	je     80080c <vprintfmt+0x53c>
+  8002f7:	83 ec 08             	sub    $0x8,%esp
+  8002fa:	53                   	push   %ebx
+  8002fb:	50                   	push   %eax
+  8002fc:	ff d7                	call   *%edi
+  8002fe:	83 c6 01             	add    $0x1,%esi
+  800301:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800305:	83 c4 10             	add    $0x10,%esp
+  800308:	83 f8 25             	cmp    $0x25,%eax
+  80030b:	75 e2                	jne    8002ef <vprintfmt+0x1f>
+  80030d:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800311:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800318:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80031f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800326:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80032b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80032e:	8d 56 01             	lea    0x1(%esi),%edx
+  800331:	0f b6 0e             	movzbl (%esi),%ecx
+  800334:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800337:	3c 55                	cmp    $0x55,%al
+  800339:	0f 87 3b 04 00 00    	ja     80077a <vprintfmt+0x4aa>
+  80033f:	0f b6 c0             	movzbl %al,%eax
+  800342:	ff 24 85 a0 39 80 00 	jmp    *0x8039a0(,%eax,4)
+  800349:	89 75 10             	mov    %esi,0x10(%ebp)
+  80034c:	eb 93                	jmp    8002e1 <vprintfmt+0x11>
+  80034e:	89 d6                	mov    %edx,%esi
+  800350:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800354:	eb d8                	jmp    80032e <vprintfmt+0x5e>
+  800356:	89 d6                	mov    %edx,%esi
+  800358:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80035c:	eb d0                	jmp    80032e <vprintfmt+0x5e>
+  80035e:	0f b6 c9             	movzbl %cl,%ecx
+  800361:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800364:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800367:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80036b:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80036e:	83 f9 09             	cmp    $0x9,%ecx
+  800371:	77 6f                	ja     8003e2 <vprintfmt+0x112>
+  800373:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800376:	83 c2 01             	add    $0x1,%edx
+  800379:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80037c:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800380:	0f be 02             	movsbl (%edx),%eax
+  800383:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800386:	83 fe 09             	cmp    $0x9,%esi
+  800389:	76 eb                	jbe    800376 <vprintfmt+0xa6>
+  80038b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80038e:	89 d6                	mov    %edx,%esi
+  800390:	eb 13                	jmp    8003a5 <vprintfmt+0xd5>
+  800392:	8b 45 14             	mov    0x14(%ebp),%eax
+  800395:	8b 00                	mov    (%eax),%eax
+  800397:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80039a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039d:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003a3:	89 d6                	mov    %edx,%esi
+  8003a5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003a9:	79 83                	jns    80032e <vprintfmt+0x5e>
+  8003ab:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003b1:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003b8:	e9 71 ff ff ff       	jmp    80032e <vprintfmt+0x5e>
+  8003bd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003c0:	85 c9                	test   %ecx,%ecx
+  8003c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c7:	0f 49 c1             	cmovns %ecx,%eax
+  8003ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003cd:	89 d6                	mov    %edx,%esi
+  8003cf:	e9 5a ff ff ff       	jmp    80032e <vprintfmt+0x5e>
+  8003d4:	89 d6                	mov    %edx,%esi
+  8003d6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003dd:	e9 4c ff ff ff       	jmp    80032e <vprintfmt+0x5e>
+  8003e2:	89 d6                	mov    %edx,%esi
+  8003e4:	eb bf                	jmp    8003a5 <vprintfmt+0xd5>
+  8003e6:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8003ea:	89 d6                	mov    %edx,%esi
+  8003ec:	e9 3d ff ff ff       	jmp    80032e <vprintfmt+0x5e>
+  8003f1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f7:	8d 70 04             	lea    0x4(%eax),%esi
+  8003fa:	83 ec 08             	sub    $0x8,%esp
+  8003fd:	53                   	push   %ebx
+  8003fe:	ff 30                	push   (%eax)
+  800400:	ff d7                	call   *%edi
+  800402:	83 c4 10             	add    $0x10,%esp
+  800405:	89 75 14             	mov    %esi,0x14(%ebp)
+  800408:	e9 d4 fe ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  80040d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800410:	8b 45 14             	mov    0x14(%ebp),%eax
+  800413:	8d 70 04             	lea    0x4(%eax),%esi
+  800416:	8b 10                	mov    (%eax),%edx
+  800418:	89 d0                	mov    %edx,%eax
+  80041a:	f7 d8                	neg    %eax
+  80041c:	0f 48 c2             	cmovs  %edx,%eax
+  80041f:	83 f8 12             	cmp    $0x12,%eax
+  800422:	7f 23                	jg     800447 <vprintfmt+0x177>
+  800424:	8b 14 85 00 3b 80 00 	mov    0x803b00(,%eax,4),%edx
+  80042b:	85 d2                	test   %edx,%edx
+  80042d:	74 18                	je     800447 <vprintfmt+0x177>
+  80042f:	52                   	push   %edx
+  800430:	68 af 3d 80 00       	push   $0x803daf
+  800435:	53                   	push   %ebx
+  800436:	57                   	push   %edi
+  800437:	e8 77 fe ff ff       	call   8002b3 <printfmt>
+  80043c:	83 c4 10             	add    $0x10,%esp
+  80043f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800442:	e9 9a fe ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  800447:	50                   	push   %eax
+  800448:	68 6f 38 80 00       	push   $0x80386f
+  80044d:	53                   	push   %ebx
+  80044e:	57                   	push   %edi
+  80044f:	e8 5f fe ff ff       	call   8002b3 <printfmt>
+  800454:	83 c4 10             	add    $0x10,%esp
+  800457:	89 75 14             	mov    %esi,0x14(%ebp)
+  80045a:	e9 82 fe ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  80045f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800462:	8b 45 14             	mov    0x14(%ebp),%eax
+  800465:	83 c0 04             	add    $0x4,%eax
+  800468:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80046b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046e:	8b 00                	mov    (%eax),%eax
+  800470:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800473:	85 c0                	test   %eax,%eax
+  800475:	0f 84 61 03 00 00    	je     8007dc <vprintfmt+0x50c>
+  80047b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80047f:	7e 06                	jle    800487 <vprintfmt+0x1b7>
+  800481:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800485:	75 29                	jne    8004b0 <vprintfmt+0x1e0>
+  800487:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80048a:	8d 70 01             	lea    0x1(%eax),%esi
+  80048d:	0f b6 00             	movzbl (%eax),%eax
+  800490:	0f be d0             	movsbl %al,%edx
+  800493:	85 d2                	test   %edx,%edx
+  800495:	0f 84 bb 00 00 00    	je     800556 <vprintfmt+0x286>
+  80049b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80049e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004a1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004a4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004a7:	eb 7a                	jmp    800523 <vprintfmt+0x253>
+  8004a9:	c7 45 d0 68 38 80 00 	movl   $0x803868,-0x30(%ebp)
+  8004b0:	83 ec 08             	sub    $0x8,%esp
+  8004b3:	ff 75 d4             	push   -0x2c(%ebp)
+  8004b6:	ff 75 d0             	push   -0x30(%ebp)
+  8004b9:	e8 e0 03 00 00       	call   80089e <strnlen>
+  8004be:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004c4:	83 c4 10             	add    $0x10,%esp
+  8004c7:	85 d2                	test   %edx,%edx
+  8004c9:	0f 8e d6 02 00 00    	jle    8007a5 <vprintfmt+0x4d5>
+  8004cf:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004d3:	83 ec 08             	sub    $0x8,%esp
+  8004d6:	53                   	push   %ebx
+  8004d7:	56                   	push   %esi
+  8004d8:	ff d7                	call   *%edi
+  8004da:	83 c4 10             	add    $0x10,%esp
+  8004dd:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004e1:	75 f0                	jne    8004d3 <vprintfmt+0x203>
+  8004e3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004e6:	8d 70 01             	lea    0x1(%eax),%esi
+  8004e9:	0f b6 00             	movzbl (%eax),%eax
+  8004ec:	0f be d0             	movsbl %al,%edx
+  8004ef:	85 d2                	test   %edx,%edx
+  8004f1:	0f 84 da 02 00 00    	je     8007d1 <vprintfmt+0x501>
+  8004f7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004fa:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004fd:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800500:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800503:	eb 1e                	jmp    800523 <vprintfmt+0x253>
+  800505:	83 ec 08             	sub    $0x8,%esp
+  800508:	ff 75 0c             	push   0xc(%ebp)
+  80050b:	52                   	push   %edx
+  80050c:	ff 55 08             	call   *0x8(%ebp)
+  80050f:	83 c4 10             	add    $0x10,%esp
+  800512:	83 eb 01             	sub    $0x1,%ebx
+  800515:	83 c6 01             	add    $0x1,%esi
+  800518:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051c:	0f be d0             	movsbl %al,%edx
+  80051f:	85 d2                	test   %edx,%edx
+  800521:	74 2a                	je     80054d <vprintfmt+0x27d>
+  800523:	85 ff                	test   %edi,%edi
+  800525:	78 05                	js     80052c <vprintfmt+0x25c>
+  800527:	83 ef 01             	sub    $0x1,%edi
+  80052a:	78 59                	js     800585 <vprintfmt+0x2b5>
+  80052c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800530:	74 d3                	je     800505 <vprintfmt+0x235>
+  800532:	0f be c0             	movsbl %al,%eax
+  800535:	83 e8 20             	sub    $0x20,%eax
+  800538:	83 f8 5e             	cmp    $0x5e,%eax
+  80053b:	76 c8                	jbe    800505 <vprintfmt+0x235>
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	ff 75 0c             	push   0xc(%ebp)
+  800543:	6a 3f                	push   $0x3f
+  800545:	ff 55 08             	call   *0x8(%ebp)
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	eb c5                	jmp    800512 <vprintfmt+0x242>
+  80054d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800550:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800553:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800556:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800559:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80055d:	7e 1b                	jle    80057a <vprintfmt+0x2aa>
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	6a 20                	push   $0x20
+  800565:	ff d7                	call   *%edi
+  800567:	83 c4 10             	add    $0x10,%esp
+  80056a:	83 ee 01             	sub    $0x1,%esi
+  80056d:	75 f0                	jne    80055f <vprintfmt+0x28f>
+  80056f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800572:	89 45 14             	mov    %eax,0x14(%ebp)
+  800575:	e9 67 fd ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  80057a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80057d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800580:	e9 5c fd ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  800585:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800588:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80058b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80058e:	eb c6                	jmp    800556 <vprintfmt+0x286>
+  800590:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800593:	89 55 10             	mov    %edx,0x10(%ebp)
+  800596:	83 f9 01             	cmp    $0x1,%ecx
+  800599:	7f 1f                	jg     8005ba <vprintfmt+0x2ea>
+  80059b:	85 c9                	test   %ecx,%ecx
+  80059d:	74 67                	je     800606 <vprintfmt+0x336>
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8b 30                	mov    (%eax),%esi
+  8005a4:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005a7:	89 f0                	mov    %esi,%eax
+  8005a9:	c1 f8 1f             	sar    $0x1f,%eax
+  8005ac:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b8:	eb 17                	jmp    8005d1 <vprintfmt+0x301>
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c0:	8b 00                	mov    (%eax),%eax
+  8005c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005dc:	85 c9                	test   %ecx,%ecx
+  8005de:	0f 89 12 01 00 00    	jns    8006f6 <vprintfmt+0x426>
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	53                   	push   %ebx
+  8005e8:	6a 2d                	push   $0x2d
+  8005ea:	ff d7                	call   *%edi
+  8005ec:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ef:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f2:	f7 da                	neg    %edx
+  8005f4:	83 d1 00             	adc    $0x0,%ecx
+  8005f7:	f7 d9                	neg    %ecx
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	be 0a 00 00 00       	mov    $0xa,%esi
+  800601:	e9 f0 00 00 00       	jmp    8006f6 <vprintfmt+0x426>
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8b 30                	mov    (%eax),%esi
+  80060b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80060e:	89 f0                	mov    %esi,%eax
+  800610:	c1 f8 1f             	sar    $0x1f,%eax
+  800613:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8d 40 04             	lea    0x4(%eax),%eax
+  80061c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061f:	eb b0                	jmp    8005d1 <vprintfmt+0x301>
+  800621:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800624:	89 55 10             	mov    %edx,0x10(%ebp)
+  800627:	83 f9 01             	cmp    $0x1,%ecx
+  80062a:	7f 1e                	jg     80064a <vprintfmt+0x37a>
+  80062c:	85 c9                	test   %ecx,%ecx
+  80062e:	74 32                	je     800662 <vprintfmt+0x392>
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8b 10                	mov    (%eax),%edx
+  800635:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063a:	8d 40 04             	lea    0x4(%eax),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800640:	be 0a 00 00 00       	mov    $0xa,%esi
+  800645:	e9 ac 00 00 00       	jmp    8006f6 <vprintfmt+0x426>
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8b 10                	mov    (%eax),%edx
+  80064f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800652:	8d 40 08             	lea    0x8(%eax),%eax
+  800655:	89 45 14             	mov    %eax,0x14(%ebp)
+  800658:	be 0a 00 00 00       	mov    $0xa,%esi
+  80065d:	e9 94 00 00 00       	jmp    8006f6 <vprintfmt+0x426>
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 10                	mov    (%eax),%edx
+  800667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066c:	8d 40 04             	lea    0x4(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800672:	be 0a 00 00 00       	mov    $0xa,%esi
+  800677:	eb 7d                	jmp    8006f6 <vprintfmt+0x426>
+  800679:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80067c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80067f:	83 f9 01             	cmp    $0x1,%ecx
+  800682:	7f 1b                	jg     80069f <vprintfmt+0x3cf>
+  800684:	85 c9                	test   %ecx,%ecx
+  800686:	74 2c                	je     8006b4 <vprintfmt+0x3e4>
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 10                	mov    (%eax),%edx
+  80068d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800692:	8d 40 04             	lea    0x4(%eax),%eax
+  800695:	89 45 14             	mov    %eax,0x14(%ebp)
+  800698:	be 08 00 00 00       	mov    $0x8,%esi
+  80069d:	eb 57                	jmp    8006f6 <vprintfmt+0x426>
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8b 10                	mov    (%eax),%edx
+  8006a4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ad:	be 08 00 00 00       	mov    $0x8,%esi
+  8006b2:	eb 42                	jmp    8006f6 <vprintfmt+0x426>
+  8006b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b7:	8b 10                	mov    (%eax),%edx
+  8006b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006be:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c4:	be 08 00 00 00       	mov    $0x8,%esi
+  8006c9:	eb 2b                	jmp    8006f6 <vprintfmt+0x426>
+  8006cb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+  8006d1:	53                   	push   %ebx
+  8006d2:	6a 30                	push   $0x30
+  8006d4:	ff d7                	call   *%edi
+  8006d6:	83 c4 08             	add    $0x8,%esp
+  8006d9:	53                   	push   %ebx
+  8006da:	6a 78                	push   $0x78
+  8006dc:	ff d7                	call   *%edi
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 10                	mov    (%eax),%edx
+  8006e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e8:	83 c4 10             	add    $0x10,%esp
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f1:	be 10 00 00 00       	mov    $0x10,%esi
+  8006f6:	83 ec 0c             	sub    $0xc,%esp
+  8006f9:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006fd:	50                   	push   %eax
+  8006fe:	ff 75 e4             	push   -0x1c(%ebp)
+  800701:	56                   	push   %esi
+  800702:	51                   	push   %ecx
+  800703:	52                   	push   %edx
+  800704:	89 da                	mov    %ebx,%edx
+  800706:	89 f8                	mov    %edi,%eax
+  800708:	e8 d8 fa ff ff       	call   8001e5 <printnum>
+  80070d:	83 c4 20             	add    $0x20,%esp
+  800710:	e9 cc fb ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  800715:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800718:	89 55 10             	mov    %edx,0x10(%ebp)
+  80071b:	83 f9 01             	cmp    $0x1,%ecx
+  80071e:	7f 1b                	jg     80073b <vprintfmt+0x46b>
+  800720:	85 c9                	test   %ecx,%ecx
+  800722:	74 2c                	je     800750 <vprintfmt+0x480>
+  800724:	8b 45 14             	mov    0x14(%ebp),%eax
+  800727:	8b 10                	mov    (%eax),%edx
+  800729:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072e:	8d 40 04             	lea    0x4(%eax),%eax
+  800731:	89 45 14             	mov    %eax,0x14(%ebp)
+  800734:	be 10 00 00 00       	mov    $0x10,%esi
+  800739:	eb bb                	jmp    8006f6 <vprintfmt+0x426>
+  80073b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073e:	8b 10                	mov    (%eax),%edx
+  800740:	8b 48 04             	mov    0x4(%eax),%ecx
+  800743:	8d 40 08             	lea    0x8(%eax),%eax
+  800746:	89 45 14             	mov    %eax,0x14(%ebp)
+  800749:	be 10 00 00 00       	mov    $0x10,%esi
+  80074e:	eb a6                	jmp    8006f6 <vprintfmt+0x426>
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075a:	8d 40 04             	lea    0x4(%eax),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800760:	be 10 00 00 00       	mov    $0x10,%esi
+  800765:	eb 8f                	jmp    8006f6 <vprintfmt+0x426>
+  800767:	89 55 10             	mov    %edx,0x10(%ebp)
+  80076a:	83 ec 08             	sub    $0x8,%esp
+  80076d:	53                   	push   %ebx
+  80076e:	6a 25                	push   $0x25
+  800770:	ff d7                	call   *%edi
+  800772:	83 c4 10             	add    $0x10,%esp
+  800775:	e9 67 fb ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  80077a:	83 ec 08             	sub    $0x8,%esp
+  80077d:	53                   	push   %ebx
+  80077e:	6a 25                	push   $0x25
+  800780:	ff d7                	call   *%edi
+  800782:	83 c4 10             	add    $0x10,%esp
+  800785:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800789:	0f 84 ba fb ff ff    	je     800349 <vprintfmt+0x79>
+  80078f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800792:	89 f0                	mov    %esi,%eax
+  800794:	83 e8 01             	sub    $0x1,%eax
+  800797:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80079b:	75 f7                	jne    800794 <vprintfmt+0x4c4>
+  80079d:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007a0:	e9 3c fb ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  8007a5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a8:	8d 70 01             	lea    0x1(%eax),%esi
+  8007ab:	0f b6 00             	movzbl (%eax),%eax
+  8007ae:	0f be d0             	movsbl %al,%edx
+  8007b1:	85 d2                	test   %edx,%edx
+  8007b3:	74 11                	je     8007c6 <vprintfmt+0x4f6>
+  8007b5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007b8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007bb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007be:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c1:	e9 5d fd ff ff       	jmp    800523 <vprintfmt+0x253>
+  8007c6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007c9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007cc:	e9 10 fb ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  8007d1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d7:	e9 05 fb ff ff       	jmp    8002e1 <vprintfmt+0x11>
+  8007dc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007e0:	7e 0a                	jle    8007ec <vprintfmt+0x51c>
+  8007e2:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007e6:	0f 85 bd fc ff ff    	jne    8004a9 <vprintfmt+0x1d9>
+  8007ec:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007f1:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007f6:	be 69 38 80 00       	mov    $0x803869,%esi
+  8007fb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007fe:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800801:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800804:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800807:	e9 17 fd ff ff       	jmp    800523 <vprintfmt+0x253>
+  80080c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80080f:	5b                   	pop    %ebx
+  800810:	5e                   	pop    %esi
+  800811:	5f                   	pop    %edi
+  800812:	5d                   	pop    %ebp
+  800813:	c3                   	ret
+
+00800814 <vsnprintf>:
+  800814:	55                   	push   %ebp
+  800815:	89 e5                	mov    %esp,%ebp
+  800817:	83 ec 18             	sub    $0x18,%esp
+  80081a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800820:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800823:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800827:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80082a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800831:	85 c0                	test   %eax,%eax
+  800833:	74 26                	je     80085b <vsnprintf+0x47>
+  800835:	85 d2                	test   %edx,%edx
+  800837:	7e 22                	jle    80085b <vsnprintf+0x47>
+  800839:	ff 75 14             	push   0x14(%ebp)
+  80083c:	ff 75 10             	push   0x10(%ebp)
+  80083f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800842:	50                   	push   %eax
+  800843:	68 96 02 80 00       	push   $0x800296
+  800848:	e8 83 fa ff ff       	call   8002d0 <vprintfmt>
+  80084d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800850:	c6 00 00             	movb   $0x0,(%eax)
+  800853:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800856:	83 c4 10             	add    $0x10,%esp
+  800859:	c9                   	leave
+  80085a:	c3                   	ret
+  80085b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800860:	eb f7                	jmp    800859 <vsnprintf+0x45>
+
+00800862 <snprintf>:
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	83 ec 08             	sub    $0x8,%esp
+  800868:	8d 45 14             	lea    0x14(%ebp),%eax
+  80086b:	50                   	push   %eax
+  80086c:	ff 75 10             	push   0x10(%ebp)
+  80086f:	ff 75 0c             	push   0xc(%ebp)
+  800872:	ff 75 08             	push   0x8(%ebp)
+  800875:	e8 9a ff ff ff       	call   800814 <vsnprintf>
+  80087a:	c9                   	leave
+  80087b:	c3                   	ret
+
+0080087c <strlen>:
+  80087c:	55                   	push   %ebp
+  80087d:	89 e5                	mov    %esp,%ebp
+  80087f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800882:	80 3a 00             	cmpb   $0x0,(%edx)
+  800885:	74 10                	je     800897 <strlen+0x1b>
+  800887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088c:	83 c0 01             	add    $0x1,%eax
+  80088f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800893:	75 f7                	jne    80088c <strlen+0x10>
+  800895:	5d                   	pop    %ebp
+  800896:	c3                   	ret
+  800897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089c:	eb f7                	jmp    800895 <strlen+0x19>
+
+0080089e <strnlen>:
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a7:	85 d2                	test   %edx,%edx
+  8008a9:	74 16                	je     8008c1 <strnlen+0x23>
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b4:	74 09                	je     8008bf <strnlen+0x21>
+  8008b6:	83 c0 01             	add    $0x1,%eax
+  8008b9:	39 d0                	cmp    %edx,%eax
+  8008bb:	75 f3                	jne    8008b0 <strnlen+0x12>
+  8008bd:	89 d0                	mov    %edx,%eax
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c6:	eb f7                	jmp    8008bf <strnlen+0x21>
+
+008008c8 <strcpy>:
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	53                   	push   %ebx
+  8008cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008db:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008de:	83 c0 01             	add    $0x1,%eax
+  8008e1:	84 d2                	test   %dl,%dl
+  8008e3:	75 f2                	jne    8008d7 <strcpy+0xf>
+  8008e5:	89 c8                	mov    %ecx,%eax
+  8008e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+
+008008ec <strcat>:
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	53                   	push   %ebx
+  8008f0:	83 ec 10             	sub    $0x10,%esp
+  8008f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008f6:	53                   	push   %ebx
+  8008f7:	e8 80 ff ff ff       	call   80087c <strlen>
+  8008fc:	83 c4 08             	add    $0x8,%esp
+  8008ff:	ff 75 0c             	push   0xc(%ebp)
+  800902:	01 d8                	add    %ebx,%eax
+  800904:	50                   	push   %eax
+  800905:	e8 be ff ff ff       	call   8008c8 <strcpy>
+  80090a:	89 d8                	mov    %ebx,%eax
+  80090c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090f:	c9                   	leave
+  800910:	c3                   	ret
+
+00800911 <strncpy>:
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	56                   	push   %esi
+  800915:	53                   	push   %ebx
+  800916:	8b 75 08             	mov    0x8(%ebp),%esi
+  800919:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80091f:	85 db                	test   %ebx,%ebx
+  800921:	74 17                	je     80093a <strncpy+0x29>
+  800923:	01 f3                	add    %esi,%ebx
+  800925:	89 f0                	mov    %esi,%eax
+  800927:	83 c0 01             	add    $0x1,%eax
+  80092a:	0f b6 0a             	movzbl (%edx),%ecx
+  80092d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800930:	80 f9 01             	cmp    $0x1,%cl
+  800933:	83 da ff             	sbb    $0xffffffff,%edx
+  800936:	39 c3                	cmp    %eax,%ebx
+  800938:	75 ed                	jne    800927 <strncpy+0x16>
+  80093a:	89 f0                	mov    %esi,%eax
+  80093c:	5b                   	pop    %ebx
+  80093d:	5e                   	pop    %esi
+  80093e:	5d                   	pop    %ebp
+  80093f:	c3                   	ret
+
+00800940 <strlcpy>:
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+  800945:	8b 75 08             	mov    0x8(%ebp),%esi
+  800948:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80094b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80094e:	89 f0                	mov    %esi,%eax
+  800950:	85 db                	test   %ebx,%ebx
+  800952:	74 1e                	je     800972 <strlcpy+0x32>
+  800954:	83 eb 01             	sub    $0x1,%ebx
+  800957:	74 16                	je     80096f <strlcpy+0x2f>
+  800959:	01 f3                	add    %esi,%ebx
+  80095b:	0f b6 0a             	movzbl (%edx),%ecx
+  80095e:	84 c9                	test   %cl,%cl
+  800960:	74 0d                	je     80096f <strlcpy+0x2f>
+  800962:	83 c2 01             	add    $0x1,%edx
+  800965:	83 c0 01             	add    $0x1,%eax
+  800968:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80096b:	39 d8                	cmp    %ebx,%eax
+  80096d:	75 ec                	jne    80095b <strlcpy+0x1b>
+  80096f:	c6 00 00             	movb   $0x0,(%eax)
+  800972:	29 f0                	sub    %esi,%eax
+  800974:	5b                   	pop    %ebx
+  800975:	5e                   	pop    %esi
+  800976:	5d                   	pop    %ebp
+  800977:	c3                   	ret
+
+00800978 <strcmp>:
+  800978:	55                   	push   %ebp
+  800979:	89 e5                	mov    %esp,%ebp
+  80097b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80097e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800981:	0f b6 01             	movzbl (%ecx),%eax
+  800984:	84 c0                	test   %al,%al
+  800986:	74 11                	je     800999 <strcmp+0x21>
+  800988:	38 02                	cmp    %al,(%edx)
+  80098a:	75 0d                	jne    800999 <strcmp+0x21>
+  80098c:	83 c1 01             	add    $0x1,%ecx
+  80098f:	83 c2 01             	add    $0x1,%edx
+  800992:	0f b6 01             	movzbl (%ecx),%eax
+  800995:	84 c0                	test   %al,%al
+  800997:	75 ef                	jne    800988 <strcmp+0x10>
+  800999:	0f b6 c0             	movzbl %al,%eax
+  80099c:	0f b6 12             	movzbl (%edx),%edx
+  80099f:	29 d0                	sub    %edx,%eax
+  8009a1:	5d                   	pop    %ebp
+  8009a2:	c3                   	ret
+
+008009a3 <strncmp>:
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	53                   	push   %ebx
+  8009a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009ad:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b5:	85 d2                	test   %edx,%edx
+  8009b7:	74 2e                	je     8009e7 <strncmp+0x44>
+  8009b9:	0f b6 01             	movzbl (%ecx),%eax
+  8009bc:	84 c0                	test   %al,%al
+  8009be:	74 16                	je     8009d6 <strncmp+0x33>
+  8009c0:	3a 03                	cmp    (%ebx),%al
+  8009c2:	75 12                	jne    8009d6 <strncmp+0x33>
+  8009c4:	83 c1 01             	add    $0x1,%ecx
+  8009c7:	83 c3 01             	add    $0x1,%ebx
+  8009ca:	83 ea 01             	sub    $0x1,%edx
+  8009cd:	75 ea                	jne    8009b9 <strncmp+0x16>
+  8009cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d4:	eb 11                	jmp    8009e7 <strncmp+0x44>
+  8009d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009db:	85 d2                	test   %edx,%edx
+  8009dd:	74 08                	je     8009e7 <strncmp+0x44>
+  8009df:	0f b6 01             	movzbl (%ecx),%eax
+  8009e2:	0f b6 13             	movzbl (%ebx),%edx
+  8009e5:	29 d0                	sub    %edx,%eax
+  8009e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ea:	c9                   	leave
+  8009eb:	c3                   	ret
+
+008009ec <strchr>:
+  8009ec:	55                   	push   %ebp
+  8009ed:	89 e5                	mov    %esp,%ebp
+  8009ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009f6:	0f b6 10             	movzbl (%eax),%edx
+  8009f9:	84 d2                	test   %dl,%dl
+  8009fb:	74 15                	je     800a12 <strchr+0x26>
+  8009fd:	38 d1                	cmp    %dl,%cl
+  8009ff:	74 0f                	je     800a10 <strchr+0x24>
+  800a01:	83 c0 01             	add    $0x1,%eax
+  800a04:	0f b6 10             	movzbl (%eax),%edx
+  800a07:	84 d2                	test   %dl,%dl
+  800a09:	75 f2                	jne    8009fd <strchr+0x11>
+  800a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a10:	5d                   	pop    %ebp
+  800a11:	c3                   	ret
+  800a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a17:	eb f7                	jmp    800a10 <strchr+0x24>
+
+00800a19 <strfind>:
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	53                   	push   %ebx
+  800a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a23:	0f b6 18             	movzbl (%eax),%ebx
+  800a26:	38 d3                	cmp    %dl,%bl
+  800a28:	74 14                	je     800a3e <strfind+0x25>
+  800a2a:	89 d1                	mov    %edx,%ecx
+  800a2c:	84 db                	test   %bl,%bl
+  800a2e:	74 0e                	je     800a3e <strfind+0x25>
+  800a30:	83 c0 01             	add    $0x1,%eax
+  800a33:	0f b6 10             	movzbl (%eax),%edx
+  800a36:	38 ca                	cmp    %cl,%dl
+  800a38:	74 04                	je     800a3e <strfind+0x25>
+  800a3a:	84 d2                	test   %dl,%dl
+  800a3c:	75 f2                	jne    800a30 <strfind+0x17>
+  800a3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a41:	c9                   	leave
+  800a42:	c3                   	ret
+
+00800a43 <memset>:
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	57                   	push   %edi
+  800a47:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a4d:	85 c9                	test   %ecx,%ecx
+  800a4f:	74 20                	je     800a71 <memset+0x2e>
+  800a51:	89 f8                	mov    %edi,%eax
+  800a53:	09 c8                	or     %ecx,%eax
+  800a55:	a8 03                	test   $0x3,%al
+  800a57:	75 12                	jne    800a6b <memset+0x28>
+  800a59:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a5d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a63:	c1 e9 02             	shr    $0x2,%ecx
+  800a66:	fc                   	cld
+  800a67:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a69:	eb 06                	jmp    800a71 <memset+0x2e>
+  800a6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a6e:	fc                   	cld
+  800a6f:	f3 aa                	rep stos %al,%es:(%edi)
+  800a71:	89 f8                	mov    %edi,%eax
+  800a73:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a76:	c9                   	leave
+  800a77:	c3                   	ret
+
+00800a78 <memmove>:
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	57                   	push   %edi
+  800a7c:	56                   	push   %esi
+  800a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a80:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a83:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a86:	39 c6                	cmp    %eax,%esi
+  800a88:	73 32                	jae    800abc <memmove+0x44>
+  800a8a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a8d:	39 d0                	cmp    %edx,%eax
+  800a8f:	73 2b                	jae    800abc <memmove+0x44>
+  800a91:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a94:	89 d6                	mov    %edx,%esi
+  800a96:	09 fe                	or     %edi,%esi
+  800a98:	09 ce                	or     %ecx,%esi
+  800a9a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa0:	75 0e                	jne    800ab0 <memmove+0x38>
+  800aa2:	83 ef 04             	sub    $0x4,%edi
+  800aa5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa8:	c1 e9 02             	shr    $0x2,%ecx
+  800aab:	fd                   	std
+  800aac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aae:	eb 09                	jmp    800ab9 <memmove+0x41>
+  800ab0:	83 ef 01             	sub    $0x1,%edi
+  800ab3:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800ab6:	fd                   	std
+  800ab7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ab9:	fc                   	cld
+  800aba:	eb 1a                	jmp    800ad6 <memmove+0x5e>
+  800abc:	89 f2                	mov    %esi,%edx
+  800abe:	09 c2                	or     %eax,%edx
+  800ac0:	09 ca                	or     %ecx,%edx
+  800ac2:	f6 c2 03             	test   $0x3,%dl
+  800ac5:	75 0a                	jne    800ad1 <memmove+0x59>
+  800ac7:	c1 e9 02             	shr    $0x2,%ecx
+  800aca:	89 c7                	mov    %eax,%edi
+  800acc:	fc                   	cld
+  800acd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800acf:	eb 05                	jmp    800ad6 <memmove+0x5e>
+  800ad1:	89 c7                	mov    %eax,%edi
+  800ad3:	fc                   	cld
+  800ad4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ad6:	5e                   	pop    %esi
+  800ad7:	5f                   	pop    %edi
+  800ad8:	5d                   	pop    %ebp
+  800ad9:	c3                   	ret
+
+00800ada <memcpy>:
+  800ada:	55                   	push   %ebp
+  800adb:	89 e5                	mov    %esp,%ebp
+  800add:	83 ec 0c             	sub    $0xc,%esp
+  800ae0:	ff 75 10             	push   0x10(%ebp)
+  800ae3:	ff 75 0c             	push   0xc(%ebp)
+  800ae6:	ff 75 08             	push   0x8(%ebp)
+  800ae9:	e8 8a ff ff ff       	call   800a78 <memmove>
+  800aee:	c9                   	leave
+  800aef:	c3                   	ret
+
+00800af0 <memcmp>:
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	56                   	push   %esi
+  800af4:	53                   	push   %ebx
+  800af5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800afb:	8b 75 10             	mov    0x10(%ebp),%esi
+  800afe:	85 f6                	test   %esi,%esi
+  800b00:	74 29                	je     800b2b <memcmp+0x3b>
+  800b02:	01 c6                	add    %eax,%esi
+  800b04:	0f b6 08             	movzbl (%eax),%ecx
+  800b07:	0f b6 1a             	movzbl (%edx),%ebx
+  800b0a:	38 d9                	cmp    %bl,%cl
+  800b0c:	75 11                	jne    800b1f <memcmp+0x2f>
+  800b0e:	83 c0 01             	add    $0x1,%eax
+  800b11:	83 c2 01             	add    $0x1,%edx
+  800b14:	39 c6                	cmp    %eax,%esi
+  800b16:	75 ec                	jne    800b04 <memcmp+0x14>
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	eb 08                	jmp    800b27 <memcmp+0x37>
+  800b1f:	0f b6 c1             	movzbl %cl,%eax
+  800b22:	0f b6 db             	movzbl %bl,%ebx
+  800b25:	29 d8                	sub    %ebx,%eax
+  800b27:	5b                   	pop    %ebx
+  800b28:	5e                   	pop    %esi
+  800b29:	5d                   	pop    %ebp
+  800b2a:	c3                   	ret
+  800b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b30:	eb f5                	jmp    800b27 <memcmp+0x37>
+
+00800b32 <memfind>:
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b3b:	89 c2                	mov    %eax,%edx
+  800b3d:	03 55 10             	add    0x10(%ebp),%edx
+  800b40:	39 d0                	cmp    %edx,%eax
+  800b42:	73 0d                	jae    800b51 <memfind+0x1f>
+  800b44:	38 08                	cmp    %cl,(%eax)
+  800b46:	74 0d                	je     800b55 <memfind+0x23>
+  800b48:	83 c0 01             	add    $0x1,%eax
+  800b4b:	39 c2                	cmp    %eax,%edx
+  800b4d:	75 f5                	jne    800b44 <memfind+0x12>
+  800b4f:	eb 06                	jmp    800b57 <memfind+0x25>
+  800b51:	89 c2                	mov    %eax,%edx
+  800b53:	eb 02                	jmp    800b57 <memfind+0x25>
+  800b55:	89 c2                	mov    %eax,%edx
+  800b57:	89 d0                	mov    %edx,%eax
+  800b59:	5d                   	pop    %ebp
+  800b5a:	c3                   	ret
+
+00800b5b <strtol>:
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	57                   	push   %edi
+  800b5f:	56                   	push   %esi
+  800b60:	53                   	push   %ebx
+  800b61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b67:	0f b6 02             	movzbl (%edx),%eax
+  800b6a:	3c 20                	cmp    $0x20,%al
+  800b6c:	74 04                	je     800b72 <strtol+0x17>
+  800b6e:	3c 09                	cmp    $0x9,%al
+  800b70:	75 0e                	jne    800b80 <strtol+0x25>
+  800b72:	83 c2 01             	add    $0x1,%edx
+  800b75:	0f b6 02             	movzbl (%edx),%eax
+  800b78:	3c 20                	cmp    $0x20,%al
+  800b7a:	74 f6                	je     800b72 <strtol+0x17>
+  800b7c:	3c 09                	cmp    $0x9,%al
+  800b7e:	74 f2                	je     800b72 <strtol+0x17>
+  800b80:	3c 2b                	cmp    $0x2b,%al
+  800b82:	74 2a                	je     800bae <strtol+0x53>
+  800b84:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 2b                	je     800bb8 <strtol+0x5d>
+  800b8d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b93:	75 0f                	jne    800ba4 <strtol+0x49>
+  800b95:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b98:	74 28                	je     800bc2 <strtol+0x67>
+  800b9a:	85 db                	test   %ebx,%ebx
+  800b9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ba1:	0f 44 d8             	cmove  %eax,%ebx
+  800ba4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bac:	eb 46                	jmp    800bf4 <strtol+0x99>
+  800bae:	83 c2 01             	add    $0x1,%edx
+  800bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb6:	eb d5                	jmp    800b8d <strtol+0x32>
+  800bb8:	83 c2 01             	add    $0x1,%edx
+  800bbb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bc0:	eb cb                	jmp    800b8d <strtol+0x32>
+  800bc2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bc6:	74 0e                	je     800bd6 <strtol+0x7b>
+  800bc8:	85 db                	test   %ebx,%ebx
+  800bca:	75 d8                	jne    800ba4 <strtol+0x49>
+  800bcc:	83 c2 01             	add    $0x1,%edx
+  800bcf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bd4:	eb ce                	jmp    800ba4 <strtol+0x49>
+  800bd6:	83 c2 02             	add    $0x2,%edx
+  800bd9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bde:	eb c4                	jmp    800ba4 <strtol+0x49>
+  800be0:	0f be c0             	movsbl %al,%eax
+  800be3:	83 e8 30             	sub    $0x30,%eax
+  800be6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800be9:	7d 3a                	jge    800c25 <strtol+0xca>
+  800beb:	83 c2 01             	add    $0x1,%edx
+  800bee:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bf2:	01 c1                	add    %eax,%ecx
+  800bf4:	0f b6 02             	movzbl (%edx),%eax
+  800bf7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bfa:	89 f3                	mov    %esi,%ebx
+  800bfc:	80 fb 09             	cmp    $0x9,%bl
+  800bff:	76 df                	jbe    800be0 <strtol+0x85>
+  800c01:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c04:	89 f3                	mov    %esi,%ebx
+  800c06:	80 fb 19             	cmp    $0x19,%bl
+  800c09:	77 08                	ja     800c13 <strtol+0xb8>
+  800c0b:	0f be c0             	movsbl %al,%eax
+  800c0e:	83 e8 57             	sub    $0x57,%eax
+  800c11:	eb d3                	jmp    800be6 <strtol+0x8b>
+  800c13:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c16:	89 f3                	mov    %esi,%ebx
+  800c18:	80 fb 19             	cmp    $0x19,%bl
+  800c1b:	77 08                	ja     800c25 <strtol+0xca>
+  800c1d:	0f be c0             	movsbl %al,%eax
+  800c20:	83 e8 37             	sub    $0x37,%eax
+  800c23:	eb c1                	jmp    800be6 <strtol+0x8b>
+  800c25:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c29:	74 05                	je     800c30 <strtol+0xd5>
+  800c2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c2e:	89 10                	mov    %edx,(%eax)
+  800c30:	89 c8                	mov    %ecx,%eax
+  800c32:	f7 d8                	neg    %eax
+  800c34:	85 ff                	test   %edi,%edi
+  800c36:	0f 45 c8             	cmovne %eax,%ecx
+  800c39:	89 c8                	mov    %ecx,%eax
+  800c3b:	5b                   	pop    %ebx
+  800c3c:	5e                   	pop    %esi
+  800c3d:	5f                   	pop    %edi
+  800c3e:	5d                   	pop    %ebp
+  800c3f:	c3                   	ret
+
+00800c40 <sys_cputs>:
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	57                   	push   %edi
+  800c44:	56                   	push   %esi
+  800c45:	53                   	push   %ebx
+  800c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c51:	89 c3                	mov    %eax,%ebx
+  800c53:	89 c7                	mov    %eax,%edi
+  800c55:	89 c6                	mov    %eax,%esi
+  800c57:	cd 30                	int    $0x30
+  800c59:	5b                   	pop    %ebx
+  800c5a:	5e                   	pop    %esi
+  800c5b:	5f                   	pop    %edi
+  800c5c:	5d                   	pop    %ebp
+  800c5d:	c3                   	ret
+
+00800c5e <sys_cgetc>:
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	57                   	push   %edi
+  800c62:	56                   	push   %esi
+  800c63:	53                   	push   %ebx
+  800c64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c69:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c6e:	89 d1                	mov    %edx,%ecx
+  800c70:	89 d3                	mov    %edx,%ebx
+  800c72:	89 d7                	mov    %edx,%edi
+  800c74:	89 d6                	mov    %edx,%esi
+  800c76:	cd 30                	int    $0x30
+  800c78:	5b                   	pop    %ebx
+  800c79:	5e                   	pop    %esi
+  800c7a:	5f                   	pop    %edi
+  800c7b:	5d                   	pop    %ebp
+  800c7c:	c3                   	ret
+
+00800c7d <sys_env_destroy>:
+  800c7d:	55                   	push   %ebp
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	57                   	push   %edi
+  800c81:	56                   	push   %esi
+  800c82:	53                   	push   %ebx
+  800c83:	83 ec 0c             	sub    $0xc,%esp
+  800c86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c93:	89 cb                	mov    %ecx,%ebx
+  800c95:	89 cf                	mov    %ecx,%edi
+  800c97:	89 ce                	mov    %ecx,%esi
+  800c99:	cd 30                	int    $0x30
+  800c9b:	85 c0                	test   %eax,%eax
+  800c9d:	7f 08                	jg     800ca7 <sys_env_destroy+0x2a>
+  800c9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca2:	5b                   	pop    %ebx
+  800ca3:	5e                   	pop    %esi
+  800ca4:	5f                   	pop    %edi
+  800ca5:	5d                   	pop    %ebp
+  800ca6:	c3                   	ret
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+  800caa:	50                   	push   %eax
+  800cab:	6a 03                	push   $0x3
+  800cad:	68 6b 3b 80 00       	push   $0x803b6b
+  800cb2:	6a 24                	push   $0x24
+  800cb4:	68 88 3b 80 00       	push   $0x803b88
+  800cb9:	e8 d5 27 00 00       	call   803493 <_panic>
+
+00800cbe <sys_getenvid>:
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	57                   	push   %edi
+  800cc2:	56                   	push   %esi
+  800cc3:	53                   	push   %ebx
+  800cc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cce:	89 d1                	mov    %edx,%ecx
+  800cd0:	89 d3                	mov    %edx,%ebx
+  800cd2:	89 d7                	mov    %edx,%edi
+  800cd4:	89 d6                	mov    %edx,%esi
+  800cd6:	cd 30                	int    $0x30
+  800cd8:	5b                   	pop    %ebx
+  800cd9:	5e                   	pop    %esi
+  800cda:	5f                   	pop    %edi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+
+00800cdd <sys_yield>:
+  800cdd:	55                   	push   %ebp
+  800cde:	89 e5                	mov    %esp,%ebp
+  800ce0:	57                   	push   %edi
+  800ce1:	56                   	push   %esi
+  800ce2:	53                   	push   %ebx
+  800ce3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800cea:	74 26                	je     800d12 <sys_yield+0x35>
+  800cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf6:	89 d1                	mov    %edx,%ecx
+  800cf8:	89 d3                	mov    %edx,%ebx
+  800cfa:	89 d7                	mov    %edx,%edi
+  800cfc:	6a 00                	push   $0x0
+  800cfe:	55                   	push   %ebp
+  800cff:	89 e5                	mov    %esp,%ebp
+  800d01:	8d 35 09 0d 80 00    	lea    0x800d09,%esi
+  800d07:	0f 34                	sysenter
+  800d09:	5d                   	pop    %ebp
+  800d0a:	83 c4 04             	add    $0x4,%esp
+  800d0d:	5b                   	pop    %ebx
+  800d0e:	5e                   	pop    %esi
+  800d0f:	5f                   	pop    %edi
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+  800d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d17:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d1c:	89 d1                	mov    %edx,%ecx
+  800d1e:	89 d3                	mov    %edx,%ebx
+  800d20:	89 d7                	mov    %edx,%edi
+  800d22:	89 d6                	mov    %edx,%esi
+  800d24:	cd 30                	int    $0x30
+  800d26:	eb e5                	jmp    800d0d <sys_yield+0x30>
+
+00800d28 <sys_page_alloc>:
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	57                   	push   %edi
+  800d2c:	56                   	push   %esi
+  800d2d:	53                   	push   %ebx
+  800d2e:	83 ec 0c             	sub    $0xc,%esp
+  800d31:	be 00 00 00 00       	mov    $0x0,%esi
+  800d36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d44:	89 f7                	mov    %esi,%edi
+  800d46:	cd 30                	int    $0x30
+  800d48:	85 c0                	test   %eax,%eax
+  800d4a:	7f 08                	jg     800d54 <sys_page_alloc+0x2c>
+  800d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5f                   	pop    %edi
+  800d52:	5d                   	pop    %ebp
+  800d53:	c3                   	ret
+  800d54:	83 ec 0c             	sub    $0xc,%esp
+  800d57:	50                   	push   %eax
+  800d58:	6a 04                	push   $0x4
+  800d5a:	68 6b 3b 80 00       	push   $0x803b6b
+  800d5f:	6a 24                	push   $0x24
+  800d61:	68 88 3b 80 00       	push   $0x803b88
+  800d66:	e8 28 27 00 00       	call   803493 <_panic>
+
+00800d6b <sys_page_map>:
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	57                   	push   %edi
+  800d6f:	56                   	push   %esi
+  800d70:	53                   	push   %ebx
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+  800d74:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d7b:	74 33                	je     800db0 <sys_page_map+0x45>
+  800d7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d83:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d8e:	ff 75 18             	push   0x18(%ebp)
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	8d 35 9c 0d 80 00    	lea    0x800d9c,%esi
+  800d9a:	0f 34                	sysenter
+  800d9c:	5d                   	pop    %ebp
+  800d9d:	83 c4 04             	add    $0x4,%esp
+  800da0:	89 c2                	mov    %eax,%edx
+  800da2:	85 c0                	test   %eax,%eax
+  800da4:	7f 3d                	jg     800de3 <sys_page_map+0x78>
+  800da6:	89 d0                	mov    %edx,%eax
+  800da8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dab:	5b                   	pop    %ebx
+  800dac:	5e                   	pop    %esi
+  800dad:	5f                   	pop    %edi
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+  800db0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dc4:	cd 30                	int    $0x30
+  800dc6:	89 c2                	mov    %eax,%edx
+  800dc8:	85 c0                	test   %eax,%eax
+  800dca:	7e da                	jle    800da6 <sys_page_map+0x3b>
+  800dcc:	83 ec 0c             	sub    $0xc,%esp
+  800dcf:	50                   	push   %eax
+  800dd0:	6a 05                	push   $0x5
+  800dd2:	68 6b 3b 80 00       	push   $0x803b6b
+  800dd7:	6a 24                	push   $0x24
+  800dd9:	68 88 3b 80 00       	push   $0x803b88
+  800dde:	e8 b0 26 00 00       	call   803493 <_panic>
+  800de3:	83 ec 0c             	sub    $0xc,%esp
+  800de6:	50                   	push   %eax
+  800de7:	6a 05                	push   $0x5
+  800de9:	68 6b 3b 80 00       	push   $0x803b6b
+  800dee:	6a 48                	push   $0x48
+  800df0:	68 88 3b 80 00       	push   $0x803b88
+  800df5:	e8 99 26 00 00       	call   803493 <_panic>
+
+00800dfa <sys_page_unmap>:
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	57                   	push   %edi
+  800dfe:	56                   	push   %esi
+  800dff:	53                   	push   %ebx
+  800e00:	83 ec 0c             	sub    $0xc,%esp
+  800e03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e13:	89 df                	mov    %ebx,%edi
+  800e15:	89 de                	mov    %ebx,%esi
+  800e17:	cd 30                	int    $0x30
+  800e19:	85 c0                	test   %eax,%eax
+  800e1b:	7f 08                	jg     800e25 <sys_page_unmap+0x2b>
+  800e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5f                   	pop    %edi
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+  800e28:	50                   	push   %eax
+  800e29:	6a 06                	push   $0x6
+  800e2b:	68 6b 3b 80 00       	push   $0x803b6b
+  800e30:	6a 24                	push   $0x24
+  800e32:	68 88 3b 80 00       	push   $0x803b88
+  800e37:	e8 57 26 00 00       	call   803493 <_panic>
+
+00800e3c <sys_fork>:
+  800e3c:	55                   	push   %ebp
+  800e3d:	89 e5                	mov    %esp,%ebp
+  800e3f:	57                   	push   %edi
+  800e40:	56                   	push   %esi
+  800e41:	53                   	push   %ebx
+  800e42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e47:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e4c:	89 d1                	mov    %edx,%ecx
+  800e4e:	89 d3                	mov    %edx,%ebx
+  800e50:	89 d7                	mov    %edx,%edi
+  800e52:	89 d6                	mov    %edx,%esi
+  800e54:	cd 30                	int    $0x30
+  800e56:	5b                   	pop    %ebx
+  800e57:	5e                   	pop    %esi
+  800e58:	5f                   	pop    %edi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+
+00800e5b <sys_env_set_status>:
+  800e5b:	55                   	push   %ebp
+  800e5c:	89 e5                	mov    %esp,%ebp
+  800e5e:	57                   	push   %edi
+  800e5f:	56                   	push   %esi
+  800e60:	53                   	push   %ebx
+  800e61:	83 ec 0c             	sub    $0xc,%esp
+  800e64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e74:	89 df                	mov    %ebx,%edi
+  800e76:	89 de                	mov    %ebx,%esi
+  800e78:	cd 30                	int    $0x30
+  800e7a:	85 c0                	test   %eax,%eax
+  800e7c:	7f 08                	jg     800e86 <sys_env_set_status+0x2b>
+  800e7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e81:	5b                   	pop    %ebx
+  800e82:	5e                   	pop    %esi
+  800e83:	5f                   	pop    %edi
+  800e84:	5d                   	pop    %ebp
+  800e85:	c3                   	ret
+  800e86:	83 ec 0c             	sub    $0xc,%esp
+  800e89:	50                   	push   %eax
+  800e8a:	6a 08                	push   $0x8
+  800e8c:	68 6b 3b 80 00       	push   $0x803b6b
+  800e91:	6a 24                	push   $0x24
+  800e93:	68 88 3b 80 00       	push   $0x803b88
+  800e98:	e8 f6 25 00 00       	call   803493 <_panic>
+
+00800e9d <sys_env_set_trapframe>:
+  800e9d:	55                   	push   %ebp
+  800e9e:	89 e5                	mov    %esp,%ebp
+  800ea0:	57                   	push   %edi
+  800ea1:	56                   	push   %esi
+  800ea2:	53                   	push   %ebx
+  800ea3:	83 ec 0c             	sub    $0xc,%esp
+  800ea6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800eb6:	89 df                	mov    %ebx,%edi
+  800eb8:	89 de                	mov    %ebx,%esi
+  800eba:	cd 30                	int    $0x30
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	7f 08                	jg     800ec8 <sys_env_set_trapframe+0x2b>
+  800ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+  800ec8:	83 ec 0c             	sub    $0xc,%esp
+  800ecb:	50                   	push   %eax
+  800ecc:	6a 09                	push   $0x9
+  800ece:	68 6b 3b 80 00       	push   $0x803b6b
+  800ed3:	6a 24                	push   $0x24
+  800ed5:	68 88 3b 80 00       	push   $0x803b88
+  800eda:	e8 b4 25 00 00       	call   803493 <_panic>
+
+00800edf <sys_env_set_cow>:
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	57                   	push   %edi
+  800ee3:	56                   	push   %esi
+  800ee4:	53                   	push   %ebx
+  800ee5:	83 ec 0c             	sub    $0xc,%esp
+  800ee8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef3:	b8 20 00 00 00       	mov    $0x20,%eax
+  800ef8:	89 df                	mov    %ebx,%edi
+  800efa:	89 de                	mov    %ebx,%esi
+  800efc:	cd 30                	int    $0x30
+  800efe:	85 c0                	test   %eax,%eax
+  800f00:	7f 08                	jg     800f0a <sys_env_set_cow+0x2b>
+  800f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f05:	5b                   	pop    %ebx
+  800f06:	5e                   	pop    %esi
+  800f07:	5f                   	pop    %edi
+  800f08:	5d                   	pop    %ebp
+  800f09:	c3                   	ret
+  800f0a:	83 ec 0c             	sub    $0xc,%esp
+  800f0d:	50                   	push   %eax
+  800f0e:	6a 20                	push   $0x20
+  800f10:	68 6b 3b 80 00       	push   $0x803b6b
+  800f15:	6a 24                	push   $0x24
+  800f17:	68 88 3b 80 00       	push   $0x803b88
+  800f1c:	e8 72 25 00 00       	call   803493 <_panic>
+
+00800f21 <sys_env_service>:
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2f:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f34:	89 cb                	mov    %ecx,%ebx
+  800f36:	89 cf                	mov    %ecx,%edi
+  800f38:	89 ce                	mov    %ecx,%esi
+  800f3a:	cd 30                	int    $0x30
+  800f3c:	5b                   	pop    %ebx
+  800f3d:	5e                   	pop    %esi
+  800f3e:	5f                   	pop    %edi
+  800f3f:	5d                   	pop    %ebp
+  800f40:	c3                   	ret
+
+00800f41 <sys_env_set_pgfault_upcall>:
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	57                   	push   %edi
+  800f45:	56                   	push   %esi
+  800f46:	53                   	push   %ebx
+  800f47:	83 ec 0c             	sub    $0xc,%esp
+  800f4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f55:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f5a:	89 df                	mov    %ebx,%edi
+  800f5c:	89 de                	mov    %ebx,%esi
+  800f5e:	cd 30                	int    $0x30
+  800f60:	85 c0                	test   %eax,%eax
+  800f62:	7f 08                	jg     800f6c <sys_env_set_pgfault_upcall+0x2b>
+  800f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  800f6f:	50                   	push   %eax
+  800f70:	6a 0a                	push   $0xa
+  800f72:	68 6b 3b 80 00       	push   $0x803b6b
+  800f77:	6a 24                	push   $0x24
+  800f79:	68 88 3b 80 00       	push   $0x803b88
+  800f7e:	e8 10 25 00 00       	call   803493 <_panic>
+
+00800f83 <sys_ipc_try_send>:
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+  800f89:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f90:	74 27                	je     800fb9 <sys_ipc_try_send+0x36>
+  800f92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f98:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa3:	6a 00                	push   $0x0
+  800fa5:	55                   	push   %ebp
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	8d 35 b0 0f 80 00    	lea    0x800fb0,%esi
+  800fae:	0f 34                	sysenter
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	83 c4 04             	add    $0x4,%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+  800fb9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fbe:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fcc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fcf:	cd 30                	int    $0x30
+  800fd1:	eb e1                	jmp    800fb4 <sys_ipc_try_send+0x31>
+
+00800fd3 <sys_ipc_recv>:
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+  800fd9:	83 ec 0c             	sub    $0xc,%esp
+  800fdc:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fe3:	74 32                	je     801017 <sys_ipc_recv+0x44>
+  800fe5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fed:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ff2:	89 cb                	mov    %ecx,%ebx
+  800ff4:	89 cf                	mov    %ecx,%edi
+  800ff6:	6a 00                	push   $0x0
+  800ff8:	55                   	push   %ebp
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	8d 35 03 10 80 00    	lea    0x801003,%esi
+  801001:	0f 34                	sysenter
+  801003:	5d                   	pop    %ebp
+  801004:	83 c4 04             	add    $0x4,%esp
+  801007:	89 c2                	mov    %eax,%edx
+  801009:	85 c0                	test   %eax,%eax
+  80100b:	7f 3c                	jg     801049 <sys_ipc_recv+0x76>
+  80100d:	89 d0                	mov    %edx,%eax
+  80100f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801012:	5b                   	pop    %ebx
+  801013:	5e                   	pop    %esi
+  801014:	5f                   	pop    %edi
+  801015:	5d                   	pop    %ebp
+  801016:	c3                   	ret
+  801017:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801021:	8b 55 08             	mov    0x8(%ebp),%edx
+  801024:	89 cb                	mov    %ecx,%ebx
+  801026:	89 cf                	mov    %ecx,%edi
+  801028:	89 ce                	mov    %ecx,%esi
+  80102a:	cd 30                	int    $0x30
+  80102c:	89 c2                	mov    %eax,%edx
+  80102e:	85 c0                	test   %eax,%eax
+  801030:	7e db                	jle    80100d <sys_ipc_recv+0x3a>
+  801032:	83 ec 0c             	sub    $0xc,%esp
+  801035:	50                   	push   %eax
+  801036:	6a 0d                	push   $0xd
+  801038:	68 6b 3b 80 00       	push   $0x803b6b
+  80103d:	6a 24                	push   $0x24
+  80103f:	68 88 3b 80 00       	push   $0x803b88
+  801044:	e8 4a 24 00 00       	call   803493 <_panic>
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	50                   	push   %eax
+  80104d:	6a 0d                	push   $0xd
+  80104f:	68 6b 3b 80 00       	push   $0x803b6b
+  801054:	6a 48                	push   $0x48
+  801056:	68 88 3b 80 00       	push   $0x803b88
+  80105b:	e8 33 24 00 00       	call   803493 <_panic>
+
+00801060 <sys_ipc_send>:
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+  801066:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80106d:	74 27                	je     801096 <sys_ipc_send+0x36>
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80107a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801080:	6a 00                	push   $0x0
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	8d 35 8d 10 80 00    	lea    0x80108d,%esi
+  80108b:	0f 34                	sysenter
+  80108d:	5d                   	pop    %ebp
+  80108e:	83 c4 04             	add    $0x4,%esp
+  801091:	5b                   	pop    %ebx
+  801092:	5e                   	pop    %esi
+  801093:	5f                   	pop    %edi
+  801094:	5d                   	pop    %ebp
+  801095:	c3                   	ret
+  801096:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80109b:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ac:	cd 30                	int    $0x30
+  8010ae:	eb e1                	jmp    801091 <sys_ipc_send+0x31>
+
+008010b0 <sys_ipc_call>:
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	57                   	push   %edi
+  8010b4:	56                   	push   %esi
+  8010b5:	53                   	push   %ebx
+  8010b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010ca:	cd 30                	int    $0x30
+  8010cc:	5b                   	pop    %ebx
+  8010cd:	5e                   	pop    %esi
+  8010ce:	5f                   	pop    %edi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+
+008010d1 <sys_ipc_reply_recv>:
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	57                   	push   %edi
+  8010d5:	56                   	push   %esi
+  8010d6:	53                   	push   %ebx
+  8010d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dd:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010eb:	cd 30                	int    $0x30
+  8010ed:	5b                   	pop    %ebx
+  8010ee:	5e                   	pop    %esi
+  8010ef:	5f                   	pop    %edi
+  8010f0:	5d                   	pop    %ebp
+  8010f1:	c3                   	ret
+
+008010f2 <sys_time_msec>:
+  8010f2:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8010f7:	85 c0                	test   %eax,%eax
+  8010f9:	75 06                	jne    801101 <sys_time_msec+0xf>
+  8010fb:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801100:	c3                   	ret
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	0f 31                	rdtsc
+  80110c:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801112:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801118:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80111e:	29 c8                	sub    %ecx,%eax
+  801120:	19 da                	sbb    %ebx,%edx
+  801122:	bf 00 00 00 00       	mov    $0x0,%edi
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	52                   	push   %edx
+  80112a:	50                   	push   %eax
+  80112b:	e8 65 25 00 00       	call   803695 <__udivdi3>
+  801130:	83 c4 10             	add    $0x10,%esp
+  801133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+
+0080113b <sys_env_swap>:
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+  801141:	83 ec 0c             	sub    $0xc,%esp
+  801144:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801151:	89 cb                	mov    %ecx,%ebx
+  801153:	89 cf                	mov    %ecx,%edi
+  801155:	89 ce                	mov    %ecx,%esi
+  801157:	cd 30                	int    $0x30
+  801159:	85 c0                	test   %eax,%eax
+  80115b:	7f 08                	jg     801165 <sys_env_swap+0x2a>
+  80115d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801160:	5b                   	pop    %ebx
+  801161:	5e                   	pop    %esi
+  801162:	5f                   	pop    %edi
+  801163:	5d                   	pop    %ebp
+  801164:	c3                   	ret
+  801165:	83 ec 0c             	sub    $0xc,%esp
+  801168:	50                   	push   %eax
+  801169:	6a 12                	push   $0x12
+  80116b:	68 6b 3b 80 00       	push   $0x803b6b
+  801170:	6a 24                	push   $0x24
+  801172:	68 88 3b 80 00       	push   $0x803b88
+  801177:	e8 17 23 00 00       	call   803493 <_panic>
+
+0080117c <sys_net_try_send>:
+  80117c:	55                   	push   %ebp
+  80117d:	89 e5                	mov    %esp,%ebp
+  80117f:	57                   	push   %edi
+  801180:	56                   	push   %esi
+  801181:	53                   	push   %ebx
+  801182:	83 ec 0c             	sub    $0xc,%esp
+  801185:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801190:	b8 13 00 00 00       	mov    $0x13,%eax
+  801195:	89 df                	mov    %ebx,%edi
+  801197:	89 de                	mov    %ebx,%esi
+  801199:	cd 30                	int    $0x30
+  80119b:	85 c0                	test   %eax,%eax
+  80119d:	7f 08                	jg     8011a7 <sys_net_try_send+0x2b>
+  80119f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a2:	5b                   	pop    %ebx
+  8011a3:	5e                   	pop    %esi
+  8011a4:	5f                   	pop    %edi
+  8011a5:	5d                   	pop    %ebp
+  8011a6:	c3                   	ret
+  8011a7:	83 ec 0c             	sub    $0xc,%esp
+  8011aa:	50                   	push   %eax
+  8011ab:	6a 13                	push   $0x13
+  8011ad:	68 6b 3b 80 00       	push   $0x803b6b
+  8011b2:	6a 24                	push   $0x24
+  8011b4:	68 88 3b 80 00       	push   $0x803b88
+  8011b9:	e8 d5 22 00 00       	call   803493 <_panic>
+
+008011be <sys_net_try_receive>:
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	57                   	push   %edi
+  8011c2:	56                   	push   %esi
+  8011c3:	53                   	push   %ebx
+  8011c4:	83 ec 0c             	sub    $0xc,%esp
+  8011c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011d7:	89 df                	mov    %ebx,%edi
+  8011d9:	89 de                	mov    %ebx,%esi
+  8011db:	cd 30                	int    $0x30
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	7f 08                	jg     8011e9 <sys_net_try_receive+0x2b>
+  8011e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+  8011e9:	83 ec 0c             	sub    $0xc,%esp
+  8011ec:	50                   	push   %eax
+  8011ed:	6a 14                	push   $0x14
+  8011ef:	68 6b 3b 80 00       	push   $0x803b6b
+  8011f4:	6a 24                	push   $0x24
+  8011f6:	68 88 3b 80 00       	push   $0x803b88
+  8011fb:	e8 93 22 00 00       	call   803493 <_panic>
+
+00801200 <sys_net_recv_page>:
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+  801206:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	b8 27 00 00 00       	mov    $0x27,%eax
+  801213:	89 cb                	mov    %ecx,%ebx
+  801215:	89 cf                	mov    %ecx,%edi
+  801217:	89 ce                	mov    %ecx,%esi
+  801219:	cd 30                	int    $0x30
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+
+00801220 <sys_net_wait>:
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	57                   	push   %edi
+  801224:	56                   	push   %esi
+  801225:	53                   	push   %ebx
+  801226:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122b:	b8 26 00 00 00       	mov    $0x26,%eax
+  801230:	89 d1                	mov    %edx,%ecx
+  801232:	89 d3                	mov    %edx,%ebx
+  801234:	89 d7                	mov    %edx,%edi
+  801236:	89 d6                	mov    %edx,%esi
+  801238:	cd 30                	int    $0x30
+  80123a:	5b                   	pop    %ebx
+  80123b:	5e                   	pop    %esi
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <sys_get_mac>:
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+  801245:	83 ec 0c             	sub    $0xc,%esp
+  801248:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801250:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801253:	b8 15 00 00 00       	mov    $0x15,%eax
+  801258:	89 df                	mov    %ebx,%edi
+  80125a:	89 de                	mov    %ebx,%esi
+  80125c:	cd 30                	int    $0x30
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	7f 08                	jg     80126a <sys_get_mac+0x2b>
+  801262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801265:	5b                   	pop    %ebx
+  801266:	5e                   	pop    %esi
+  801267:	5f                   	pop    %edi
+  801268:	5d                   	pop    %ebp
+  801269:	c3                   	ret
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+  80126d:	50                   	push   %eax
+  80126e:	6a 15                	push   $0x15
+  801270:	68 6b 3b 80 00       	push   $0x803b6b
+  801275:	6a 24                	push   $0x24
+  801277:	68 88 3b 80 00       	push   $0x803b88
+  80127c:	e8 12 22 00 00       	call   803493 <_panic>
+
+00801281 <sys_env_lease>:
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	57                   	push   %edi
+  801285:	56                   	push   %esi
+  801286:	53                   	push   %ebx
+  801287:	83 ec 0c             	sub    $0xc,%esp
+  80128a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801292:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801295:	b8 16 00 00 00       	mov    $0x16,%eax
+  80129a:	89 df                	mov    %ebx,%edi
+  80129c:	89 de                	mov    %ebx,%esi
+  80129e:	cd 30                	int    $0x30
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	7f 08                	jg     8012ac <sys_env_lease+0x2b>
+  8012a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+  8012ac:	83 ec 0c             	sub    $0xc,%esp
+  8012af:	50                   	push   %eax
+  8012b0:	6a 16                	push   $0x16
+  8012b2:	68 6b 3b 80 00       	push   $0x803b6b
+  8012b7:	6a 24                	push   $0x24
+  8012b9:	68 88 3b 80 00       	push   $0x803b88
+  8012be:	e8 d0 21 00 00       	call   803493 <_panic>
+
+008012c3 <sys_copy_mem>:
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+  8012c9:	83 ec 0c             	sub    $0xc,%esp
+  8012cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012dd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012e0:	cd 30                	int    $0x30
+  8012e2:	85 c0                	test   %eax,%eax
+  8012e4:	7f 08                	jg     8012ee <sys_copy_mem+0x2b>
+  8012e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e9:	5b                   	pop    %ebx
+  8012ea:	5e                   	pop    %esi
+  8012eb:	5f                   	pop    %edi
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+  8012ee:	83 ec 0c             	sub    $0xc,%esp
+  8012f1:	50                   	push   %eax
+  8012f2:	6a 17                	push   $0x17
+  8012f4:	68 6b 3b 80 00       	push   $0x803b6b
+  8012f9:	6a 24                	push   $0x24
+  8012fb:	68 88 3b 80 00       	push   $0x803b88
+  801300:	e8 8e 21 00 00       	call   803493 <_panic>
+
+00801305 <sys_get_perms>:
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+  80130e:	be 00 00 00 00       	mov    $0x0,%esi
+  801313:	8b 55 08             	mov    0x8(%ebp),%edx
+  801316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801319:	b8 18 00 00 00       	mov    $0x18,%eax
+  80131e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801321:	89 f7                	mov    %esi,%edi
+  801323:	cd 30                	int    $0x30
+  801325:	85 c0                	test   %eax,%eax
+  801327:	7f 08                	jg     801331 <sys_get_perms+0x2c>
+  801329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+  801331:	83 ec 0c             	sub    $0xc,%esp
+  801334:	50                   	push   %eax
+  801335:	6a 18                	push   $0x18
+  801337:	68 6b 3b 80 00       	push   $0x803b6b
+  80133c:	6a 24                	push   $0x24
+  80133e:	68 88 3b 80 00       	push   $0x803b88
+  801343:	e8 4b 21 00 00       	call   803493 <_panic>
+
+00801348 <sys_env_unsuspend>:
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	57                   	push   %edi
+  80134c:	56                   	push   %esi
+  80134d:	53                   	push   %ebx
+  80134e:	83 ec 0c             	sub    $0xc,%esp
+  801351:	be 00 00 00 00       	mov    $0x0,%esi
+  801356:	8b 55 08             	mov    0x8(%ebp),%edx
+  801359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801361:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801364:	89 f7                	mov    %esi,%edi
+  801366:	cd 30                	int    $0x30
+  801368:	85 c0                	test   %eax,%eax
+  80136a:	7f 08                	jg     801374 <sys_env_unsuspend+0x2c>
+  80136c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136f:	5b                   	pop    %ebx
+  801370:	5e                   	pop    %esi
+  801371:	5f                   	pop    %edi
+  801372:	5d                   	pop    %ebp
+  801373:	c3                   	ret
+  801374:	83 ec 0c             	sub    $0xc,%esp
+  801377:	50                   	push   %eax
+  801378:	6a 19                	push   $0x19
+  80137a:	68 6b 3b 80 00       	push   $0x803b6b
+  80137f:	6a 24                	push   $0x24
+  801381:	68 88 3b 80 00       	push   $0x803b88
+  801386:	e8 08 21 00 00       	call   803493 <_panic>
+
+0080138b <sys_migrate>:
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  80138e:	57                   	push   %edi
+  80138f:	56                   	push   %esi
+  801390:	53                   	push   %ebx
+  801391:	83 ec 0c             	sub    $0xc,%esp
+  801394:	ba 04 80 80 00       	mov    $0x808004,%edx
+  801399:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80139f:	76 11                	jbe    8013b2 <sys_migrate+0x27>
+  8013a1:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8013a6:	0f b6 08             	movzbl (%eax),%ecx
+  8013a9:	05 00 10 00 00       	add    $0x1000,%eax
+  8013ae:	39 d0                	cmp    %edx,%eax
+  8013b0:	72 f4                	jb     8013a6 <sys_migrate+0x1b>
+  8013b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ba:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013bf:	89 cb                	mov    %ecx,%ebx
+  8013c1:	89 cf                	mov    %ecx,%edi
+  8013c3:	89 ce                	mov    %ecx,%esi
+  8013c5:	cd 30                	int    $0x30
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	7f 08                	jg     8013d3 <sys_migrate+0x48>
+  8013cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5e                   	pop    %esi
+  8013d0:	5f                   	pop    %edi
+  8013d1:	5d                   	pop    %ebp
+  8013d2:	c3                   	ret
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	50                   	push   %eax
+  8013d7:	6a 1a                	push   $0x1a
+  8013d9:	68 6b 3b 80 00       	push   $0x803b6b
+  8013de:	6a 24                	push   $0x24
+  8013e0:	68 88 3b 80 00       	push   $0x803b88
+  8013e5:	e8 a9 20 00 00       	call   803493 <_panic>
+
+008013ea <sys_lease_complete>:
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	57                   	push   %edi
+  8013ee:	56                   	push   %esi
+  8013ef:	53                   	push   %ebx
+  8013f0:	83 ec 0c             	sub    $0xc,%esp
+  8013f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013fd:	89 d1                	mov    %edx,%ecx
+  8013ff:	89 d3                	mov    %edx,%ebx
+  801401:	89 d7                	mov    %edx,%edi
+  801403:	89 d6                	mov    %edx,%esi
+  801405:	cd 30                	int    $0x30
+  801407:	85 c0                	test   %eax,%eax
+  801409:	7f 08                	jg     801413 <sys_lease_complete+0x29>
+  80140b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140e:	5b                   	pop    %ebx
+  80140f:	5e                   	pop    %esi
+  801410:	5f                   	pop    %edi
+  801411:	5d                   	pop    %ebp
+  801412:	c3                   	ret
+  801413:	83 ec 0c             	sub    $0xc,%esp
+  801416:	50                   	push   %eax
+  801417:	6a 1b                	push   $0x1b
+  801419:	68 6b 3b 80 00       	push   $0x803b6b
+  80141e:	6a 24                	push   $0x24
+  801420:	68 88 3b 80 00       	push   $0x803b88
+  801425:	e8 69 20 00 00       	call   803493 <_panic>
+
+0080142a <sys_env_set_thisenv>:
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+  801430:	83 ec 0c             	sub    $0xc,%esp
+  801433:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801438:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801443:	89 df                	mov    %ebx,%edi
+  801445:	89 de                	mov    %ebx,%esi
+  801447:	cd 30                	int    $0x30
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	7f 08                	jg     801455 <sys_env_set_thisenv+0x2b>
+  80144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	50                   	push   %eax
+  801459:	6a 1c                	push   $0x1c
+  80145b:	68 6b 3b 80 00       	push   $0x803b6b
+  801460:	6a 24                	push   $0x24
+  801462:	68 88 3b 80 00       	push   $0x803b88
+  801467:	e8 27 20 00 00       	call   803493 <_panic>
+
+0080146c <sys_env_set_sched>:
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	57                   	push   %edi
+  801470:	56                   	push   %esi
+  801471:	53                   	push   %ebx
+  801472:	83 ec 0c             	sub    $0xc,%esp
+  801475:	be 00 00 00 00       	mov    $0x0,%esi
+  80147a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801480:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801485:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801488:	89 f7                	mov    %esi,%edi
+  80148a:	cd 30                	int    $0x30
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	7f 08                	jg     801498 <sys_env_set_sched+0x2c>
+  801490:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801493:	5b                   	pop    %ebx
+  801494:	5e                   	pop    %esi
+  801495:	5f                   	pop    %edi
+  801496:	5d                   	pop    %ebp
+  801497:	c3                   	ret
+  801498:	83 ec 0c             	sub    $0xc,%esp
+  80149b:	50                   	push   %eax
+  80149c:	6a 1d                	push   $0x1d
+  80149e:	68 6b 3b 80 00       	push   $0x803b6b
+  8014a3:	6a 24                	push   $0x24
+  8014a5:	68 88 3b 80 00       	push   $0x803b88
+  8014aa:	e8 e4 1f 00 00       	call   803493 <_panic>
+
+008014af <sys_batch>:
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	57                   	push   %edi
+  8014b3:	56                   	push   %esi
+  8014b4:	53                   	push   %ebx
+  8014b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014c5:	89 df                	mov    %ebx,%edi
+  8014c7:	89 de                	mov    %ebx,%esi
+  8014c9:	cd 30                	int    $0x30
+  8014cb:	5b                   	pop    %ebx
+  8014cc:	5e                   	pop    %esi
+  8014cd:	5f                   	pop    %edi
+  8014ce:	5d                   	pop    %ebp
+  8014cf:	c3                   	ret
+
+008014d0 <sys_env_stats>:
+  8014d0:	55                   	push   %ebp
+  8014d1:	89 e5                	mov    %esp,%ebp
+  8014d3:	57                   	push   %edi
+  8014d4:	56                   	push   %esi
+  8014d5:	53                   	push   %ebx
+  8014d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e1:	b8 23 00 00 00       	mov    $0x23,%eax
+  8014e6:	89 df                	mov    %ebx,%edi
+  8014e8:	89 de                	mov    %ebx,%esi
+  8014ea:	cd 30                	int    $0x30
+  8014ec:	5b                   	pop    %ebx
+  8014ed:	5e                   	pop    %esi
+  8014ee:	5f                   	pop    %edi
+  8014ef:	5d                   	pop    %ebp
+  8014f0:	c3                   	ret
+
+008014f1 <sys_trace>:
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	57                   	push   %edi
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+  8014f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ff:	b8 24 00 00 00       	mov    $0x24,%eax
+  801504:	89 cb                	mov    %ecx,%ebx
+  801506:	89 cf                	mov    %ecx,%edi
+  801508:	89 ce                	mov    %ecx,%esi
+  80150a:	cd 30                	int    $0x30
+  80150c:	5b                   	pop    %ebx
+  80150d:	5e                   	pop    %esi
+  80150e:	5f                   	pop    %edi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+
+00801511 <sys_env_set_pager>:
+  801511:	55                   	push   %ebp
+  801512:	89 e5                	mov    %esp,%ebp
+  801514:	57                   	push   %edi
+  801515:	56                   	push   %esi
+  801516:	53                   	push   %ebx
+  801517:	83 ec 0c             	sub    $0xc,%esp
+  80151a:	be 00 00 00 00       	mov    $0x0,%esi
+  80151f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801522:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801525:	b8 25 00 00 00       	mov    $0x25,%eax
+  80152a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152d:	89 f7                	mov    %esi,%edi
+  80152f:	cd 30                	int    $0x30
+  801531:	85 c0                	test   %eax,%eax
+  801533:	7f 08                	jg     80153d <sys_env_set_pager+0x2c>
+  801535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801538:	5b                   	pop    %ebx
+  801539:	5e                   	pop    %esi
+  80153a:	5f                   	pop    %edi
+  80153b:	5d                   	pop    %ebp
+  80153c:	c3                   	ret
+  80153d:	83 ec 0c             	sub    $0xc,%esp
+  801540:	50                   	push   %eax
+  801541:	6a 25                	push   $0x25
+  801543:	68 6b 3b 80 00       	push   $0x803b6b
+  801548:	6a 24                	push   $0x24
+  80154a:	68 88 3b 80 00       	push   $0x803b88
+  80154f:	e8 3f 1f 00 00       	call   803493 <_panic>
+
+00801554 <sys_pager_retire>:
+  801554:	55                   	push   %ebp
+  801555:	89 e5                	mov    %esp,%ebp
+  801557:	57                   	push   %edi
+  801558:	56                   	push   %esi
+  801559:	53                   	push   %ebx
+  80155a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80155f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801562:	b8 28 00 00 00       	mov    $0x28,%eax
+  801567:	89 cb                	mov    %ecx,%ebx
+  801569:	89 cf                	mov    %ecx,%edi
+  80156b:	89 ce                	mov    %ecx,%esi
+  80156d:	cd 30                	int    $0x30
+  80156f:	5b                   	pop    %ebx
+  801570:	5e                   	pop    %esi
+  801571:	5f                   	pop    %edi
+  801572:	5d                   	pop    %ebp
+  801573:	c3                   	ret
+
+00801574 <sys_prof>:
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	57                   	push   %edi
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+  80157a:	be 00 00 00 00       	mov    $0x0,%esi
+  80157f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801582:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801585:	b8 22 00 00 00       	mov    $0x22,%eax
+  80158a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158d:	89 f7                	mov    %esi,%edi
+  80158f:	cd 30                	int    $0x30
+  801591:	5b                   	pop    %ebx
+  801592:	5e                   	pop    %esi
+  801593:	5f                   	pop    %edi
+  801594:	5d                   	pop    %ebp
+  801595:	c3                   	ret
+
+00801596 <dupq_flush>:
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	53                   	push   %ebx
+  80159a:	83 ec 0c             	sub    $0xc,%esp
+  80159d:	8b 1d 00 50 80 00    	mov    0x805000,%ebx
+  8015a3:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8015aa:	00 00 00 
+  8015ad:	53                   	push   %ebx
+  8015ae:	68 00 00 40 00       	push   $0x400000
+  8015b3:	e8 f7 fe ff ff       	call   8014af <sys_batch>
+  8015b8:	83 c4 10             	add    $0x10,%esp
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	78 14                	js     8015d3 <dupq_flush+0x3d>
+  8015bf:	39 c3                	cmp    %eax,%ebx
+  8015c1:	7e 0b                	jle    8015ce <dupq_flush+0x38>
+  8015c3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8015c6:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8015cc:	eb 05                	jmp    8015d3 <dupq_flush+0x3d>
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015d6:	c9                   	leave
+  8015d7:	c3                   	ret
+
+008015d8 <pgfault>:
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+  8015dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e0:	8b 30                	mov    (%eax),%esi
+  8015e2:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8015e6:	0f 84 83 00 00 00    	je     80166f <pgfault+0x97>
+  8015ec:	89 f0                	mov    %esi,%eax
+  8015ee:	c1 e8 0c             	shr    $0xc,%eax
+  8015f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015f8:	f6 c4 08             	test   $0x8,%ah
+  8015fb:	0f 84 80 00 00 00    	je     801681 <pgfault+0xa9>
+  801601:	e8 b8 f6 ff ff       	call   800cbe <sys_getenvid>
+  801606:	89 c3                	mov    %eax,%ebx
+  801608:	83 ec 04             	sub    $0x4,%esp
+  80160b:	6a 07                	push   $0x7
+  80160d:	68 00 f0 7f 00       	push   $0x7ff000
+  801612:	50                   	push   %eax
+  801613:	e8 10 f7 ff ff       	call   800d28 <sys_page_alloc>
+  801618:	83 c4 10             	add    $0x10,%esp
+  80161b:	85 c0                	test   %eax,%eax
+  80161d:	78 74                	js     801693 <pgfault+0xbb>
+  80161f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801625:	83 ec 04             	sub    $0x4,%esp
+  801628:	68 00 10 00 00       	push   $0x1000
+  80162d:	56                   	push   %esi
+  80162e:	68 00 f0 7f 00       	push   $0x7ff000
+  801633:	e8 40 f4 ff ff       	call   800a78 <memmove>
+  801638:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80163f:	56                   	push   %esi
+  801640:	53                   	push   %ebx
+  801641:	68 00 f0 7f 00       	push   $0x7ff000
+  801646:	53                   	push   %ebx
+  801647:	e8 1f f7 ff ff       	call   800d6b <sys_page_map>
+  80164c:	83 c4 20             	add    $0x20,%esp
+  80164f:	85 c0                	test   %eax,%eax
+  801651:	78 54                	js     8016a7 <pgfault+0xcf>
+  801653:	83 ec 08             	sub    $0x8,%esp
+  801656:	68 00 f0 7f 00       	push   $0x7ff000
+  80165b:	53                   	push   %ebx
+  80165c:	e8 99 f7 ff ff       	call   800dfa <sys_page_unmap>
+  801661:	83 c4 10             	add    $0x10,%esp
+  801664:	85 c0                	test   %eax,%eax
+  801666:	78 53                	js     8016bb <pgfault+0xe3>
+  801668:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80166b:	5b                   	pop    %ebx
+  80166c:	5e                   	pop    %esi
+  80166d:	5d                   	pop    %ebp
+  80166e:	c3                   	ret
+  80166f:	56                   	push   %esi
+  801670:	68 98 3b 80 00       	push   $0x803b98
+  801675:	6a 19                	push   $0x19
+  801677:	68 74 3c 80 00       	push   $0x803c74
+  80167c:	e8 12 1e 00 00       	call   803493 <_panic>
+  801681:	56                   	push   %esi
+  801682:	68 cc 3b 80 00       	push   $0x803bcc
+  801687:	6a 1e                	push   $0x1e
+  801689:	68 74 3c 80 00       	push   $0x803c74
+  80168e:	e8 00 1e 00 00       	call   803493 <_panic>
+  801693:	83 ec 04             	sub    $0x4,%esp
+  801696:	68 00 3c 80 00       	push   $0x803c00
+  80169b:	6a 2e                	push   $0x2e
+  80169d:	68 74 3c 80 00       	push   $0x803c74
+  8016a2:	e8 ec 1d 00 00       	call   803493 <_panic>
+  8016a7:	83 ec 04             	sub    $0x4,%esp
+  8016aa:	68 24 3c 80 00       	push   $0x803c24
+  8016af:	6a 37                	push   $0x37
+  8016b1:	68 74 3c 80 00       	push   $0x803c74
+  8016b6:	e8 d8 1d 00 00       	call   803493 <_panic>
+  8016bb:	83 ec 04             	sub    $0x4,%esp
+  8016be:	68 50 3c 80 00       	push   $0x803c50
+  8016c3:	6a 3c                	push   $0x3c
+  8016c5:	68 74 3c 80 00       	push   $0x803c74
+  8016ca:	e8 c4 1d 00 00       	call   803493 <_panic>
+
+008016cf <dupq_begin>:
+  8016cf:	55                   	push   %ebp
+  8016d0:	89 e5                	mov    %esp,%ebp
+  8016d2:	83 ec 0c             	sub    $0xc,%esp
+  8016d5:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8016dc:	00 00 00 
+  8016df:	6a 07                	push   $0x7
+  8016e1:	68 00 00 40 00       	push   $0x400000
+  8016e6:	6a 00                	push   $0x0
+  8016e8:	e8 3b f6 ff ff       	call   800d28 <sys_page_alloc>
+  8016ed:	c9                   	leave
+  8016ee:	c3                   	ret
+
+008016ef <dupq_map>:
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	83 ec 08             	sub    $0x8,%esp
+  8016f5:	81 3d 00 50 80 00 92 	cmpl   $0x92,0x805000
+  8016fc:	00 00 00 
+  8016ff:	74 46                	je     801747 <dupq_map+0x58>
+  801701:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  801707:	8d 42 01             	lea    0x1(%edx),%eax
+  80170a:	a3 00 50 80 00       	mov    %eax,0x805000
+  80170f:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801712:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801718:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  80171f:	00 00 00 
+  801722:	8b 55 08             	mov    0x8(%ebp),%edx
+  801725:	89 50 04             	mov    %edx,0x4(%eax)
+  801728:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80172b:	c1 e2 0c             	shl    $0xc,%edx
+  80172e:	89 50 08             	mov    %edx,0x8(%eax)
+  801731:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801734:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801737:	89 50 10             	mov    %edx,0x10(%eax)
+  80173a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80173d:	89 50 14             	mov    %edx,0x14(%eax)
+  801740:	b8 00 00 00 00       	mov    $0x0,%eax
+  801745:	c9                   	leave
+  801746:	c3                   	ret
+  801747:	e8 4a fe ff ff       	call   801596 <dupq_flush>
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	79 b1                	jns    801701 <dupq_map+0x12>
+  801750:	eb f3                	jmp    801745 <dupq_map+0x56>
+
+00801752 <dupq_end>:
+  801752:	55                   	push   %ebp
+  801753:	89 e5                	mov    %esp,%ebp
+  801755:	53                   	push   %ebx
+  801756:	83 ec 04             	sub    $0x4,%esp
+  801759:	e8 38 fe ff ff       	call   801596 <dupq_flush>
+  80175e:	89 c3                	mov    %eax,%ebx
+  801760:	83 ec 08             	sub    $0x8,%esp
+  801763:	68 00 00 40 00       	push   $0x400000
+  801768:	6a 00                	push   $0x0
+  80176a:	e8 8b f6 ff ff       	call   800dfa <sys_page_unmap>
+  80176f:	89 d8                	mov    %ebx,%eax
+  801771:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801774:	c9                   	leave
+  801775:	c3                   	ret
+
+00801776 <fork>:
+  801776:	55                   	push   %ebp
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	53                   	push   %ebx
+  80177a:	83 ec 10             	sub    $0x10,%esp
+  80177d:	68 d8 15 80 00       	push   $0x8015d8
+  801782:	e8 52 1d 00 00       	call   8034d9 <set_pgfault_handler>
+  801787:	83 c4 08             	add    $0x8,%esp
+  80178a:	6a 01                	push   $0x1
+  80178c:	6a 00                	push   $0x0
+  80178e:	e8 4c f7 ff ff       	call   800edf <sys_env_set_cow>
+  801793:	e8 a4 f6 ff ff       	call   800e3c <sys_fork>
+  801798:	89 c3                	mov    %eax,%ebx
+  80179a:	83 c4 10             	add    $0x10,%esp
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	74 07                	je     8017a8 <fork+0x32>
+  8017a1:	89 d8                	mov    %ebx,%eax
+  8017a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a6:	c9                   	leave
+  8017a7:	c3                   	ret
+  8017a8:	e8 11 f5 ff ff       	call   800cbe <sys_getenvid>
+  8017ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017b2:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8017b8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017bd:	a3 14 50 80 00       	mov    %eax,0x805014
+  8017c2:	eb dd                	jmp    8017a1 <fork+0x2b>
+
+008017c4 <sfork>:
+  8017c4:	55                   	push   %ebp
+  8017c5:	89 e5                	mov    %esp,%ebp
+  8017c7:	57                   	push   %edi
+  8017c8:	56                   	push   %esi
+  8017c9:	53                   	push   %ebx
+  8017ca:	83 ec 1c             	sub    $0x1c,%esp
+  8017cd:	e8 ec f4 ff ff       	call   800cbe <sys_getenvid>
+  8017d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017d5:	83 ec 0c             	sub    $0xc,%esp
+  8017d8:	68 d8 15 80 00       	push   $0x8015d8
+  8017dd:	e8 f7 1c 00 00       	call   8034d9 <set_pgfault_handler>
+  8017e2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017e7:	cd 30                	int    $0x30
+  8017e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017ec:	83 c4 10             	add    $0x10,%esp
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	0f 88 45 02 00 00    	js     801a3c <sfork+0x278>
+  8017f7:	89 c6                	mov    %eax,%esi
+  8017f9:	74 17                	je     801812 <sfork+0x4e>
+  8017fb:	e8 cf fe ff ff       	call   8016cf <dupq_begin>
+  801800:	85 c0                	test   %eax,%eax
+  801802:	0f 88 40 02 00 00    	js     801a48 <sfork+0x284>
+  801808:	bf 02 00 00 00       	mov    $0x2,%edi
+  80180d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801810:	eb 39                	jmp    80184b <sfork+0x87>
+  801812:	e8 a7 f4 ff ff       	call   800cbe <sys_getenvid>
+  801817:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80181c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801822:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801827:	a3 14 50 80 00       	mov    %eax,0x805014
+  80182c:	e9 23 01 00 00       	jmp    801954 <sfork+0x190>
+  801831:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801838:	a8 01                	test   $0x1,%al
+  80183a:	75 5b                	jne    801897 <sfork+0xd3>
+  80183c:	83 c7 01             	add    $0x1,%edi
+  80183f:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801845:	0f 84 40 01 00 00    	je     80198b <sfork+0x1c7>
+  80184b:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801852:	a8 01                	test   $0x1,%al
+  801854:	74 db                	je     801831 <sfork+0x6d>
+  801856:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80185d:	a8 80                	test   $0x80,%al
+  80185f:	74 d0                	je     801831 <sfork+0x6d>
+  801861:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801868:	25 07 0e 00 00       	and    $0xe07,%eax
+  80186d:	0c 80                	or     $0x80,%al
+  80186f:	50                   	push   %eax
+  801870:	ff 75 e4             	push   -0x1c(%ebp)
+  801873:	89 f8                	mov    %edi,%eax
+  801875:	c1 e0 16             	shl    $0x16,%eax
+  801878:	c1 e8 0c             	shr    $0xc,%eax
+  80187b:	50                   	push   %eax
+  80187c:	ff 75 e0             	push   -0x20(%ebp)
+  80187f:	e8 6b fe ff ff       	call   8016ef <dupq_map>
+  801884:	83 c4 10             	add    $0x10,%esp
+  801887:	85 c0                	test   %eax,%eax
+  801889:	79 b1                	jns    80183c <sfork+0x78>
+  80188b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801892:	e9 bd 00 00 00       	jmp    801954 <sfork+0x190>
+  801897:	89 fe                	mov    %edi,%esi
+  801899:	c1 e6 16             	shl    $0x16,%esi
+  80189c:	89 f0                	mov    %esi,%eax
+  80189e:	c1 e8 0c             	shr    $0xc,%eax
+  8018a1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8018a6:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8018a9:	eb 57                	jmp    801902 <sfork+0x13e>
+  8018ab:	e8 0e f4 ff ff       	call   800cbe <sys_getenvid>
+  8018b0:	89 c7                	mov    %eax,%edi
+  8018b2:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  8018b7:	f6 c4 04             	test   $0x4,%ah
+  8018ba:	0f 85 9f 00 00 00    	jne    80195f <sfork+0x19b>
+  8018c0:	a9 02 08 00 00       	test   $0x802,%eax
+  8018c5:	0f 85 c5 01 00 00    	jne    801a90 <sfork+0x2cc>
+  8018cb:	6a 05                	push   $0x5
+  8018cd:	ff 75 e4             	push   -0x1c(%ebp)
+  8018d0:	68 fd e7 0e 00       	push   $0xee7fd
+  8018d5:	57                   	push   %edi
+  8018d6:	e8 14 fe ff ff       	call   8016ef <dupq_map>
+  8018db:	83 c4 10             	add    $0x10,%esp
+  8018de:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8018e4:	0f 84 91 00 00 00    	je     80197b <sfork+0x1b7>
+  8018ea:	89 f0                	mov    %esi,%eax
+  8018ec:	09 d8                	or     %ebx,%eax
+  8018ee:	c1 e8 0c             	shr    $0xc,%eax
+  8018f1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018f7:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  8018fc:	0f 84 81 00 00 00    	je     801983 <sfork+0x1bf>
+  801902:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801907:	74 a2                	je     8018ab <sfork+0xe7>
+  801909:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801910:	f6 c2 01             	test   $0x1,%dl
+  801913:	74 c9                	je     8018de <sfork+0x11a>
+  801915:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80191c:	f6 c6 02             	test   $0x2,%dh
+  80191f:	75 bd                	jne    8018de <sfork+0x11a>
+  801921:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801928:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80192f:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801935:	f7 d2                	not    %edx
+  801937:	21 ca                	and    %ecx,%edx
+  801939:	52                   	push   %edx
+  80193a:	ff 75 e4             	push   -0x1c(%ebp)
+  80193d:	50                   	push   %eax
+  80193e:	ff 75 e0             	push   -0x20(%ebp)
+  801941:	e8 a9 fd ff ff       	call   8016ef <dupq_map>
+  801946:	83 c4 10             	add    $0x10,%esp
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	79 91                	jns    8018de <sfork+0x11a>
+  80194d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801954:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801957:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80195a:	5b                   	pop    %ebx
+  80195b:	5e                   	pop    %esi
+  80195c:	5f                   	pop    %edi
+  80195d:	5d                   	pop    %ebp
+  80195e:	c3                   	ret
+  80195f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801964:	50                   	push   %eax
+  801965:	ff 75 e4             	push   -0x1c(%ebp)
+  801968:	68 fd e7 0e 00       	push   $0xee7fd
+  80196d:	57                   	push   %edi
+  80196e:	e8 7c fd ff ff       	call   8016ef <dupq_map>
+  801973:	83 c4 10             	add    $0x10,%esp
+  801976:	e9 63 ff ff ff       	jmp    8018de <sfork+0x11a>
+  80197b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80197e:	e9 b9 fe ff ff       	jmp    80183c <sfork+0x78>
+  801983:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801986:	e9 b1 fe ff ff       	jmp    80183c <sfork+0x78>
+  80198b:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80198e:	e8 bf fd ff ff       	call   801752 <dupq_end>
+  801993:	85 c0                	test   %eax,%eax
+  801995:	0f 88 b9 00 00 00    	js     801a54 <sfork+0x290>
+  80199b:	83 ec 04             	sub    $0x4,%esp
+  80199e:	6a 07                	push   $0x7
+  8019a0:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019a5:	56                   	push   %esi
+  8019a6:	e8 7d f3 ff ff       	call   800d28 <sys_page_alloc>
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	0f 88 aa 00 00 00    	js     801a60 <sfork+0x29c>
+  8019b6:	83 ec 0c             	sub    $0xc,%esp
+  8019b9:	6a 07                	push   $0x7
+  8019bb:	68 00 f0 7f 00       	push   $0x7ff000
+  8019c0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8019c3:	57                   	push   %edi
+  8019c4:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019c9:	56                   	push   %esi
+  8019ca:	e8 9c f3 ff ff       	call   800d6b <sys_page_map>
+  8019cf:	83 c4 20             	add    $0x20,%esp
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	0f 88 92 00 00 00    	js     801a6c <sfork+0x2a8>
+  8019da:	83 ec 04             	sub    $0x4,%esp
+  8019dd:	68 00 10 00 00       	push   $0x1000
+  8019e2:	68 00 f0 7f 00       	push   $0x7ff000
+  8019e7:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019ec:	e8 87 f0 ff ff       	call   800a78 <memmove>
+  8019f1:	83 c4 08             	add    $0x8,%esp
+  8019f4:	68 00 f0 7f 00       	push   $0x7ff000
+  8019f9:	57                   	push   %edi
+  8019fa:	e8 fb f3 ff ff       	call   800dfa <sys_page_unmap>
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	78 72                	js     801a78 <sfork+0x2b4>
+  801a06:	83 ec 08             	sub    $0x8,%esp
+  801a09:	68 51 35 80 00       	push   $0x803551
+  801a0e:	56                   	push   %esi
+  801a0f:	e8 2d f5 ff ff       	call   800f41 <sys_env_set_pgfault_upcall>
+  801a14:	83 c4 10             	add    $0x10,%esp
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	78 69                	js     801a84 <sfork+0x2c0>
+  801a1b:	83 ec 08             	sub    $0x8,%esp
+  801a1e:	6a 02                	push   $0x2
+  801a20:	56                   	push   %esi
+  801a21:	e8 35 f4 ff ff       	call   800e5b <sys_env_set_status>
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	85 c0                	test   %eax,%eax
+  801a2b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a30:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801a34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a37:	e9 18 ff ff ff       	jmp    801954 <sfork+0x190>
+  801a3c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a43:	e9 0c ff ff ff       	jmp    801954 <sfork+0x190>
+  801a48:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a4f:	e9 00 ff ff ff       	jmp    801954 <sfork+0x190>
+  801a54:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a5b:	e9 f4 fe ff ff       	jmp    801954 <sfork+0x190>
+  801a60:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a67:	e9 e8 fe ff ff       	jmp    801954 <sfork+0x190>
+  801a6c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a73:	e9 dc fe ff ff       	jmp    801954 <sfork+0x190>
+  801a78:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a7f:	e9 d0 fe ff ff       	jmp    801954 <sfork+0x190>
+  801a84:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a8b:	e9 c4 fe ff ff       	jmp    801954 <sfork+0x190>
+  801a90:	68 05 08 00 00       	push   $0x805
+  801a95:	ff 75 e4             	push   -0x1c(%ebp)
+  801a98:	68 fd e7 0e 00       	push   $0xee7fd
+  801a9d:	57                   	push   %edi
+  801a9e:	e8 4c fc ff ff       	call   8016ef <dupq_map>
+  801aa3:	83 c4 10             	add    $0x10,%esp
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	0f 88 30 fe ff ff    	js     8018de <sfork+0x11a>
+  801aae:	68 05 08 00 00       	push   $0x805
+  801ab3:	57                   	push   %edi
+  801ab4:	68 fd e7 0e 00       	push   $0xee7fd
+  801ab9:	57                   	push   %edi
+  801aba:	e8 30 fc ff ff       	call   8016ef <dupq_map>
+  801abf:	83 c4 10             	add    $0x10,%esp
+  801ac2:	e9 17 fe ff ff       	jmp    8018de <sfork+0x11a>
+
+00801ac7 <ipc_recv>:
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	56                   	push   %esi
+  801acb:	53                   	push   %ebx
+  801acc:	8b 75 08             	mov    0x8(%ebp),%esi
+  801acf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ad2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801adc:	0f 44 c2             	cmove  %edx,%eax
+  801adf:	83 ec 0c             	sub    $0xc,%esp
+  801ae2:	50                   	push   %eax
+  801ae3:	e8 eb f4 ff ff       	call   800fd3 <sys_ipc_recv>
+  801ae8:	83 c4 10             	add    $0x10,%esp
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	78 2a                	js     801b19 <ipc_recv+0x52>
+  801aef:	a1 14 50 80 00       	mov    0x805014,%eax
+  801af4:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801afa:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801b00:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801b06:	85 f6                	test   %esi,%esi
+  801b08:	74 02                	je     801b0c <ipc_recv+0x45>
+  801b0a:	89 0e                	mov    %ecx,(%esi)
+  801b0c:	85 db                	test   %ebx,%ebx
+  801b0e:	74 02                	je     801b12 <ipc_recv+0x4b>
+  801b10:	89 13                	mov    %edx,(%ebx)
+  801b12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b15:	5b                   	pop    %ebx
+  801b16:	5e                   	pop    %esi
+  801b17:	5d                   	pop    %ebp
+  801b18:	c3                   	ret
+  801b19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b23:	eb e1                	jmp    801b06 <ipc_recv+0x3f>
+
+00801b25 <ipc_send>:
+  801b25:	55                   	push   %ebp
+  801b26:	89 e5                	mov    %esp,%ebp
+  801b28:	57                   	push   %edi
+  801b29:	56                   	push   %esi
+  801b2a:	53                   	push   %ebx
+  801b2b:	83 ec 0c             	sub    $0xc,%esp
+  801b2e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b34:	8b 75 14             	mov    0x14(%ebp),%esi
+  801b37:	85 db                	test   %ebx,%ebx
+  801b39:	74 1e                	je     801b59 <ipc_send+0x34>
+  801b3b:	56                   	push   %esi
+  801b3c:	53                   	push   %ebx
+  801b3d:	57                   	push   %edi
+  801b3e:	ff 75 08             	push   0x8(%ebp)
+  801b41:	e8 1a f5 ff ff       	call   801060 <sys_ipc_send>
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	74 2a                	je     801b77 <ipc_send+0x52>
+  801b4d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b50:	75 13                	jne    801b65 <ipc_send+0x40>
+  801b52:	e8 86 f1 ff ff       	call   800cdd <sys_yield>
+  801b57:	eb e2                	jmp    801b3b <ipc_send+0x16>
+  801b59:	be 00 00 00 00       	mov    $0x0,%esi
+  801b5e:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801b63:	eb d6                	jmp    801b3b <ipc_send+0x16>
+  801b65:	50                   	push   %eax
+  801b66:	68 80 3c 80 00       	push   $0x803c80
+  801b6b:	6a 4f                	push   $0x4f
+  801b6d:	68 c3 3c 80 00       	push   $0x803cc3
+  801b72:	e8 1c 19 00 00       	call   803493 <_panic>
+  801b77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7a:	5b                   	pop    %ebx
+  801b7b:	5e                   	pop    %esi
+  801b7c:	5f                   	pop    %edi
+  801b7d:	5d                   	pop    %ebp
+  801b7e:	c3                   	ret
+
+00801b7f <ipc_call>:
+  801b7f:	55                   	push   %ebp
+  801b80:	89 e5                	mov    %esp,%ebp
+  801b82:	57                   	push   %edi
+  801b83:	56                   	push   %esi
+  801b84:	53                   	push   %ebx
+  801b85:	83 ec 0c             	sub    $0xc,%esp
+  801b88:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b8c:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801b91:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801b95:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801b99:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801b9e:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801ba2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ba6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bab:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801baf:	eb 05                	jmp    801bb6 <ipc_call+0x37>
+  801bb1:	e8 27 f1 ff ff       	call   800cdd <sys_yield>
+  801bb6:	83 ec 0c             	sub    $0xc,%esp
+  801bb9:	56                   	push   %esi
+  801bba:	53                   	push   %ebx
+  801bbb:	57                   	push   %edi
+  801bbc:	ff 75 0c             	push   0xc(%ebp)
+  801bbf:	ff 75 08             	push   0x8(%ebp)
+  801bc2:	e8 e9 f4 ff ff       	call   8010b0 <sys_ipc_call>
+  801bc7:	83 c4 20             	add    $0x20,%esp
+  801bca:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801bcd:	74 e2                	je     801bb1 <ipc_call+0x32>
+  801bcf:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801bd2:	74 2d                	je     801c01 <ipc_call+0x82>
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	78 4f                	js     801c27 <ipc_call+0xa8>
+  801bd8:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801bdc:	74 10                	je     801bee <ipc_call+0x6f>
+  801bde:	a1 14 50 80 00       	mov    0x805014,%eax
+  801be3:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801be9:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801bec:	89 02                	mov    %eax,(%edx)
+  801bee:	a1 14 50 80 00       	mov    0x805014,%eax
+  801bf3:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801bf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bfc:	5b                   	pop    %ebx
+  801bfd:	5e                   	pop    %esi
+  801bfe:	5f                   	pop    %edi
+  801bff:	5d                   	pop    %ebp
+  801c00:	c3                   	ret
+  801c01:	ff 75 14             	push   0x14(%ebp)
+  801c04:	ff 75 10             	push   0x10(%ebp)
+  801c07:	ff 75 0c             	push   0xc(%ebp)
+  801c0a:	ff 75 08             	push   0x8(%ebp)
+  801c0d:	e8 13 ff ff ff       	call   801b25 <ipc_send>
+  801c12:	83 c4 0c             	add    $0xc,%esp
+  801c15:	ff 75 1c             	push   0x1c(%ebp)
+  801c18:	ff 75 18             	push   0x18(%ebp)
+  801c1b:	6a 00                	push   $0x0
+  801c1d:	e8 a5 fe ff ff       	call   801ac7 <ipc_recv>
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	eb d2                	jmp    801bf9 <ipc_call+0x7a>
+  801c27:	50                   	push   %eax
+  801c28:	68 cd 3c 80 00       	push   $0x803ccd
+  801c2d:	6a 6d                	push   $0x6d
+  801c2f:	68 c3 3c 80 00       	push   $0x803cc3
+  801c34:	e8 5a 18 00 00       	call   803493 <_panic>
+
+00801c39 <ipc_reply_recv>:
+  801c39:	55                   	push   %ebp
+  801c3a:	89 e5                	mov    %esp,%ebp
+  801c3c:	57                   	push   %edi
+  801c3d:	56                   	push   %esi
+  801c3e:	53                   	push   %ebx
+  801c3f:	83 ec 0c             	sub    $0xc,%esp
+  801c42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c45:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801c48:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801c4b:	85 db                	test   %ebx,%ebx
+  801c4d:	0f 84 ac 00 00 00    	je     801cff <ipc_reply_recv+0xc6>
+  801c53:	85 f6                	test   %esi,%esi
+  801c55:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801c5a:	0f 45 c6             	cmovne %esi,%eax
+  801c5d:	83 ec 0c             	sub    $0xc,%esp
+  801c60:	50                   	push   %eax
+  801c61:	ff 75 14             	push   0x14(%ebp)
+  801c64:	53                   	push   %ebx
+  801c65:	ff 75 0c             	push   0xc(%ebp)
+  801c68:	ff 75 08             	push   0x8(%ebp)
+  801c6b:	e8 61 f4 ff ff       	call   8010d1 <sys_ipc_reply_recv>
+  801c70:	83 c4 20             	add    $0x20,%esp
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	78 3a                	js     801cb1 <ipc_reply_recv+0x78>
+  801c77:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801c7b:	74 10                	je     801c8d <ipc_reply_recv+0x54>
+  801c7d:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c82:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801c88:	8b 55 18             	mov    0x18(%ebp),%edx
+  801c8b:	89 02                	mov    %eax,(%edx)
+  801c8d:	85 ff                	test   %edi,%edi
+  801c8f:	74 0d                	je     801c9e <ipc_reply_recv+0x65>
+  801c91:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c96:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801c9c:	89 07                	mov    %eax,(%edi)
+  801c9e:	a1 14 50 80 00       	mov    0x805014,%eax
+  801ca3:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cac:	5b                   	pop    %ebx
+  801cad:	5e                   	pop    %esi
+  801cae:	5f                   	pop    %edi
+  801caf:	5d                   	pop    %ebp
+  801cb0:	c3                   	ret
+  801cb1:	ff 75 14             	push   0x14(%ebp)
+  801cb4:	53                   	push   %ebx
+  801cb5:	ff 75 0c             	push   0xc(%ebp)
+  801cb8:	ff 75 08             	push   0x8(%ebp)
+  801cbb:	e8 c3 f2 ff ff       	call   800f83 <sys_ipc_try_send>
+  801cc0:	89 c2                	mov    %eax,%edx
+  801cc2:	c1 ea 1f             	shr    $0x1f,%edx
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801ccb:	0f 95 c1             	setne  %cl
+  801cce:	84 d1                	test   %dl,%cl
+  801cd0:	74 05                	je     801cd7 <ipc_reply_recv+0x9e>
+  801cd2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cd5:	75 12                	jne    801ce9 <ipc_reply_recv+0xb0>
+  801cd7:	83 ec 04             	sub    $0x4,%esp
+  801cda:	57                   	push   %edi
+  801cdb:	56                   	push   %esi
+  801cdc:	ff 75 18             	push   0x18(%ebp)
+  801cdf:	e8 e3 fd ff ff       	call   801ac7 <ipc_recv>
+  801ce4:	83 c4 10             	add    $0x10,%esp
+  801ce7:	eb c0                	jmp    801ca9 <ipc_reply_recv+0x70>
+  801ce9:	83 ec 04             	sub    $0x4,%esp
+  801cec:	50                   	push   %eax
+  801ced:	ff 75 08             	push   0x8(%ebp)
+  801cf0:	68 a0 3c 80 00       	push   $0x803ca0
+  801cf5:	e8 d7 e4 ff ff       	call   8001d1 <cprintf>
+  801cfa:	83 c4 10             	add    $0x10,%esp
+  801cfd:	eb d8                	jmp    801cd7 <ipc_reply_recv+0x9e>
+  801cff:	85 f6                	test   %esi,%esi
+  801d01:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801d06:	0f 45 c6             	cmovne %esi,%eax
+  801d09:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801d0e:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801d15:	e9 43 ff ff ff       	jmp    801c5d <ipc_reply_recv+0x24>
+
+00801d1a <ipc_find_env>:
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	83 ec 14             	sub    $0x14,%esp
+  801d20:	ff 75 08             	push   0x8(%ebp)
+  801d23:	e8 f9 f1 ff ff       	call   800f21 <sys_env_service>
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2f:	0f 48 c2             	cmovs  %edx,%eax
+  801d32:	c9                   	leave
+  801d33:	c3                   	ret
+
+00801d34 <fd2num>:
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3a:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d3f:	c1 e8 0c             	shr    $0xc,%eax
+  801d42:	5d                   	pop    %ebp
+  801d43:	c3                   	ret
+
+00801d44 <fd2data>:
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4a:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d4f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d54:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801d59:	5d                   	pop    %ebp
+  801d5a:	c3                   	ret
+
+00801d5b <fd_alloc>:
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801d63:	89 c2                	mov    %eax,%edx
+  801d65:	c1 ea 16             	shr    $0x16,%edx
+  801d68:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d6f:	f6 c2 01             	test   $0x1,%dl
+  801d72:	74 29                	je     801d9d <fd_alloc+0x42>
+  801d74:	89 c2                	mov    %eax,%edx
+  801d76:	c1 ea 0c             	shr    $0xc,%edx
+  801d79:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d80:	f6 c2 01             	test   $0x1,%dl
+  801d83:	74 18                	je     801d9d <fd_alloc+0x42>
+  801d85:	05 00 10 00 00       	add    $0x1000,%eax
+  801d8a:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801d8f:	75 d2                	jne    801d63 <fd_alloc+0x8>
+  801d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d96:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d9b:	eb 05                	jmp    801da2 <fd_alloc+0x47>
+  801d9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801da2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da5:	89 02                	mov    %eax,(%edx)
+  801da7:	89 c8                	mov    %ecx,%eax
+  801da9:	5d                   	pop    %ebp
+  801daa:	c3                   	ret
+
+00801dab <fd_lookup>:
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db1:	83 f8 1f             	cmp    $0x1f,%eax
+  801db4:	77 30                	ja     801de6 <fd_lookup+0x3b>
+  801db6:	c1 e0 0c             	shl    $0xc,%eax
+  801db9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801dbe:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801dc4:	f6 c2 01             	test   $0x1,%dl
+  801dc7:	74 24                	je     801ded <fd_lookup+0x42>
+  801dc9:	89 c2                	mov    %eax,%edx
+  801dcb:	c1 ea 0c             	shr    $0xc,%edx
+  801dce:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dd5:	f6 c2 01             	test   $0x1,%dl
+  801dd8:	74 1a                	je     801df4 <fd_lookup+0x49>
+  801dda:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ddd:	89 02                	mov    %eax,(%edx)
+  801ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de4:	5d                   	pop    %ebp
+  801de5:	c3                   	ret
+  801de6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801deb:	eb f7                	jmp    801de4 <fd_lookup+0x39>
+  801ded:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df2:	eb f0                	jmp    801de4 <fd_lookup+0x39>
+  801df4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df9:	eb e9                	jmp    801de4 <fd_lookup+0x39>
+
+00801dfb <dev_lookup>:
+  801dfb:	55                   	push   %ebp
+  801dfc:	89 e5                	mov    %esp,%ebp
+  801dfe:	53                   	push   %ebx
+  801dff:	83 ec 04             	sub    $0x4,%esp
+  801e02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0a:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801e0f:	39 13                	cmp    %edx,(%ebx)
+  801e11:	74 37                	je     801e4a <dev_lookup+0x4f>
+  801e13:	83 c0 01             	add    $0x1,%eax
+  801e16:	8b 1c 85 68 3d 80 00 	mov    0x803d68(,%eax,4),%ebx
+  801e1d:	85 db                	test   %ebx,%ebx
+  801e1f:	75 ee                	jne    801e0f <dev_lookup+0x14>
+  801e21:	a1 14 50 80 00       	mov    0x805014,%eax
+  801e26:	8b 40 48             	mov    0x48(%eax),%eax
+  801e29:	83 ec 04             	sub    $0x4,%esp
+  801e2c:	52                   	push   %edx
+  801e2d:	50                   	push   %eax
+  801e2e:	68 ec 3c 80 00       	push   $0x803cec
+  801e33:	e8 99 e3 ff ff       	call   8001d1 <cprintf>
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e43:	89 1a                	mov    %ebx,(%edx)
+  801e45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e48:	c9                   	leave
+  801e49:	c3                   	ret
+  801e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4f:	eb ef                	jmp    801e40 <dev_lookup+0x45>
+
+00801e51 <fd_close>:
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	57                   	push   %edi
+  801e55:	56                   	push   %esi
+  801e56:	53                   	push   %ebx
+  801e57:	83 ec 24             	sub    $0x24,%esp
+  801e5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e60:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e63:	50                   	push   %eax
+  801e64:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e6a:	c1 e8 0c             	shr    $0xc,%eax
+  801e6d:	50                   	push   %eax
+  801e6e:	e8 38 ff ff ff       	call   801dab <fd_lookup>
+  801e73:	89 c3                	mov    %eax,%ebx
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 05                	js     801e81 <fd_close+0x30>
+  801e7c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e7f:	74 0f                	je     801e90 <fd_close+0x3f>
+  801e81:	85 ff                	test   %edi,%edi
+  801e83:	0f 44 df             	cmove  %edi,%ebx
+  801e86:	89 d8                	mov    %ebx,%eax
+  801e88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8b:	5b                   	pop    %ebx
+  801e8c:	5e                   	pop    %esi
+  801e8d:	5f                   	pop    %edi
+  801e8e:	5d                   	pop    %ebp
+  801e8f:	c3                   	ret
+  801e90:	83 ec 08             	sub    $0x8,%esp
+  801e93:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e96:	50                   	push   %eax
+  801e97:	ff 36                	push   (%esi)
+  801e99:	e8 5d ff ff ff       	call   801dfb <dev_lookup>
+  801e9e:	89 c3                	mov    %eax,%ebx
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	85 c0                	test   %eax,%eax
+  801ea5:	78 1a                	js     801ec1 <fd_close+0x70>
+  801ea7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801eaa:	8b 40 10             	mov    0x10(%eax),%eax
+  801ead:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	74 0b                	je     801ec1 <fd_close+0x70>
+  801eb6:	83 ec 0c             	sub    $0xc,%esp
+  801eb9:	56                   	push   %esi
+  801eba:	ff d0                	call   *%eax
+  801ebc:	89 c3                	mov    %eax,%ebx
+  801ebe:	83 c4 10             	add    $0x10,%esp
+  801ec1:	83 ec 08             	sub    $0x8,%esp
+  801ec4:	56                   	push   %esi
+  801ec5:	6a 00                	push   $0x0
+  801ec7:	e8 2e ef ff ff       	call   800dfa <sys_page_unmap>
+  801ecc:	83 c4 10             	add    $0x10,%esp
+  801ecf:	eb b5                	jmp    801e86 <fd_close+0x35>
+
+00801ed1 <close>:
+  801ed1:	55                   	push   %ebp
+  801ed2:	89 e5                	mov    %esp,%ebp
+  801ed4:	83 ec 20             	sub    $0x20,%esp
+  801ed7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eda:	50                   	push   %eax
+  801edb:	ff 75 08             	push   0x8(%ebp)
+  801ede:	e8 c8 fe ff ff       	call   801dab <fd_lookup>
+  801ee3:	83 c4 10             	add    $0x10,%esp
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	79 02                	jns    801eec <close+0x1b>
+  801eea:	c9                   	leave
+  801eeb:	c3                   	ret
+  801eec:	83 ec 08             	sub    $0x8,%esp
+  801eef:	6a 01                	push   $0x1
+  801ef1:	ff 75 f4             	push   -0xc(%ebp)
+  801ef4:	e8 58 ff ff ff       	call   801e51 <fd_close>
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	eb ec                	jmp    801eea <close+0x19>
+
+00801efe <close_all>:
+  801efe:	55                   	push   %ebp
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	53                   	push   %ebx
+  801f02:	83 ec 04             	sub    $0x4,%esp
+  801f05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f0a:	83 ec 0c             	sub    $0xc,%esp
+  801f0d:	53                   	push   %ebx
+  801f0e:	e8 be ff ff ff       	call   801ed1 <close>
+  801f13:	83 c3 01             	add    $0x1,%ebx
+  801f16:	83 c4 10             	add    $0x10,%esp
+  801f19:	83 fb 20             	cmp    $0x20,%ebx
+  801f1c:	75 ec                	jne    801f0a <close_all+0xc>
+  801f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+00801f23 <dup>:
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	57                   	push   %edi
+  801f27:	56                   	push   %esi
+  801f28:	53                   	push   %ebx
+  801f29:	83 ec 34             	sub    $0x34,%esp
+  801f2c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f2f:	50                   	push   %eax
+  801f30:	ff 75 08             	push   0x8(%ebp)
+  801f33:	e8 73 fe ff ff       	call   801dab <fd_lookup>
+  801f38:	89 c3                	mov    %eax,%ebx
+  801f3a:	83 c4 10             	add    $0x10,%esp
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	78 7f                	js     801fc0 <dup+0x9d>
+  801f41:	83 ec 0c             	sub    $0xc,%esp
+  801f44:	ff 75 0c             	push   0xc(%ebp)
+  801f47:	e8 85 ff ff ff       	call   801ed1 <close>
+  801f4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f4f:	c1 e6 0c             	shl    $0xc,%esi
+  801f52:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801f58:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f5b:	89 3c 24             	mov    %edi,(%esp)
+  801f5e:	e8 e1 fd ff ff       	call   801d44 <fd2data>
+  801f63:	89 c3                	mov    %eax,%ebx
+  801f65:	89 34 24             	mov    %esi,(%esp)
+  801f68:	e8 d7 fd ff ff       	call   801d44 <fd2data>
+  801f6d:	83 c4 10             	add    $0x10,%esp
+  801f70:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f73:	89 d8                	mov    %ebx,%eax
+  801f75:	c1 e8 16             	shr    $0x16,%eax
+  801f78:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f7f:	a8 01                	test   $0x1,%al
+  801f81:	74 11                	je     801f94 <dup+0x71>
+  801f83:	89 d8                	mov    %ebx,%eax
+  801f85:	c1 e8 0c             	shr    $0xc,%eax
+  801f88:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f8f:	f6 c2 01             	test   $0x1,%dl
+  801f92:	75 36                	jne    801fca <dup+0xa7>
+  801f94:	89 f8                	mov    %edi,%eax
+  801f96:	c1 e8 0c             	shr    $0xc,%eax
+  801f99:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fa0:	83 ec 0c             	sub    $0xc,%esp
+  801fa3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fa8:	50                   	push   %eax
+  801fa9:	56                   	push   %esi
+  801faa:	6a 00                	push   $0x0
+  801fac:	57                   	push   %edi
+  801fad:	6a 00                	push   $0x0
+  801faf:	e8 b7 ed ff ff       	call   800d6b <sys_page_map>
+  801fb4:	89 c3                	mov    %eax,%ebx
+  801fb6:	83 c4 20             	add    $0x20,%esp
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	78 33                	js     801ff0 <dup+0xcd>
+  801fbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fc0:	89 d8                	mov    %ebx,%eax
+  801fc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc5:	5b                   	pop    %ebx
+  801fc6:	5e                   	pop    %esi
+  801fc7:	5f                   	pop    %edi
+  801fc8:	5d                   	pop    %ebp
+  801fc9:	c3                   	ret
+  801fca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+  801fd4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fd9:	50                   	push   %eax
+  801fda:	ff 75 d4             	push   -0x2c(%ebp)
+  801fdd:	6a 00                	push   $0x0
+  801fdf:	53                   	push   %ebx
+  801fe0:	6a 00                	push   $0x0
+  801fe2:	e8 84 ed ff ff       	call   800d6b <sys_page_map>
+  801fe7:	89 c3                	mov    %eax,%ebx
+  801fe9:	83 c4 20             	add    $0x20,%esp
+  801fec:	85 c0                	test   %eax,%eax
+  801fee:	79 a4                	jns    801f94 <dup+0x71>
+  801ff0:	83 ec 08             	sub    $0x8,%esp
+  801ff3:	56                   	push   %esi
+  801ff4:	6a 00                	push   $0x0
+  801ff6:	e8 ff ed ff ff       	call   800dfa <sys_page_unmap>
+  801ffb:	83 c4 08             	add    $0x8,%esp
+  801ffe:	ff 75 d4             	push   -0x2c(%ebp)
+  802001:	6a 00                	push   $0x0
+  802003:	e8 f2 ed ff ff       	call   800dfa <sys_page_unmap>
+  802008:	83 c4 10             	add    $0x10,%esp
+  80200b:	eb b3                	jmp    801fc0 <dup+0x9d>
+
+0080200d <read>:
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	56                   	push   %esi
+  802011:	53                   	push   %ebx
+  802012:	83 ec 18             	sub    $0x18,%esp
+  802015:	8b 75 08             	mov    0x8(%ebp),%esi
+  802018:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80201b:	50                   	push   %eax
+  80201c:	56                   	push   %esi
+  80201d:	e8 89 fd ff ff       	call   801dab <fd_lookup>
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	85 c0                	test   %eax,%eax
+  802027:	78 3c                	js     802065 <read+0x58>
+  802029:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80202c:	83 ec 08             	sub    $0x8,%esp
+  80202f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802032:	50                   	push   %eax
+  802033:	ff 33                	push   (%ebx)
+  802035:	e8 c1 fd ff ff       	call   801dfb <dev_lookup>
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 24                	js     802065 <read+0x58>
+  802041:	8b 43 08             	mov    0x8(%ebx),%eax
+  802044:	83 e0 03             	and    $0x3,%eax
+  802047:	83 f8 01             	cmp    $0x1,%eax
+  80204a:	74 20                	je     80206c <read+0x5f>
+  80204c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204f:	8b 40 08             	mov    0x8(%eax),%eax
+  802052:	85 c0                	test   %eax,%eax
+  802054:	74 37                	je     80208d <read+0x80>
+  802056:	83 ec 04             	sub    $0x4,%esp
+  802059:	ff 75 10             	push   0x10(%ebp)
+  80205c:	ff 75 0c             	push   0xc(%ebp)
+  80205f:	53                   	push   %ebx
+  802060:	ff d0                	call   *%eax
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802068:	5b                   	pop    %ebx
+  802069:	5e                   	pop    %esi
+  80206a:	5d                   	pop    %ebp
+  80206b:	c3                   	ret
+  80206c:	a1 14 50 80 00       	mov    0x805014,%eax
+  802071:	8b 40 48             	mov    0x48(%eax),%eax
+  802074:	83 ec 04             	sub    $0x4,%esp
+  802077:	56                   	push   %esi
+  802078:	50                   	push   %eax
+  802079:	68 2d 3d 80 00       	push   $0x803d2d
+  80207e:	e8 4e e1 ff ff       	call   8001d1 <cprintf>
+  802083:	83 c4 10             	add    $0x10,%esp
+  802086:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80208b:	eb d8                	jmp    802065 <read+0x58>
+  80208d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802092:	eb d1                	jmp    802065 <read+0x58>
+
+00802094 <readn>:
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+  802097:	57                   	push   %edi
+  802098:	56                   	push   %esi
+  802099:	53                   	push   %ebx
+  80209a:	83 ec 0c             	sub    $0xc,%esp
+  80209d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020a0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020a3:	85 f6                	test   %esi,%esi
+  8020a5:	74 30                	je     8020d7 <readn+0x43>
+  8020a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b1:	83 ec 04             	sub    $0x4,%esp
+  8020b4:	89 f2                	mov    %esi,%edx
+  8020b6:	29 c2                	sub    %eax,%edx
+  8020b8:	52                   	push   %edx
+  8020b9:	01 f8                	add    %edi,%eax
+  8020bb:	50                   	push   %eax
+  8020bc:	ff 75 08             	push   0x8(%ebp)
+  8020bf:	e8 49 ff ff ff       	call   80200d <read>
+  8020c4:	83 c4 10             	add    $0x10,%esp
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	78 15                	js     8020e0 <readn+0x4c>
+  8020cb:	74 11                	je     8020de <readn+0x4a>
+  8020cd:	01 c3                	add    %eax,%ebx
+  8020cf:	89 d8                	mov    %ebx,%eax
+  8020d1:	39 f3                	cmp    %esi,%ebx
+  8020d3:	72 dc                	jb     8020b1 <readn+0x1d>
+  8020d5:	eb 09                	jmp    8020e0 <readn+0x4c>
+  8020d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dc:	eb 02                	jmp    8020e0 <readn+0x4c>
+  8020de:	89 d8                	mov    %ebx,%eax
+  8020e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e3:	5b                   	pop    %ebx
+  8020e4:	5e                   	pop    %esi
+  8020e5:	5f                   	pop    %edi
+  8020e6:	5d                   	pop    %ebp
+  8020e7:	c3                   	ret
+
+008020e8 <write>:
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	56                   	push   %esi
+  8020ec:	53                   	push   %ebx
+  8020ed:	83 ec 18             	sub    $0x18,%esp
+  8020f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020f6:	50                   	push   %eax
+  8020f7:	53                   	push   %ebx
+  8020f8:	e8 ae fc ff ff       	call   801dab <fd_lookup>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 37                	js     80213b <write+0x53>
+  802104:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802107:	83 ec 08             	sub    $0x8,%esp
+  80210a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80210d:	50                   	push   %eax
+  80210e:	ff 36                	push   (%esi)
+  802110:	e8 e6 fc ff ff       	call   801dfb <dev_lookup>
+  802115:	83 c4 10             	add    $0x10,%esp
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	78 1f                	js     80213b <write+0x53>
+  80211c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802120:	74 20                	je     802142 <write+0x5a>
+  802122:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802125:	8b 40 0c             	mov    0xc(%eax),%eax
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	74 37                	je     802163 <write+0x7b>
+  80212c:	83 ec 04             	sub    $0x4,%esp
+  80212f:	ff 75 10             	push   0x10(%ebp)
+  802132:	ff 75 0c             	push   0xc(%ebp)
+  802135:	56                   	push   %esi
+  802136:	ff d0                	call   *%eax
+  802138:	83 c4 10             	add    $0x10,%esp
+  80213b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80213e:	5b                   	pop    %ebx
+  80213f:	5e                   	pop    %esi
+  802140:	5d                   	pop    %ebp
+  802141:	c3                   	ret
+  802142:	a1 14 50 80 00       	mov    0x805014,%eax
+  802147:	8b 40 48             	mov    0x48(%eax),%eax
+  80214a:	83 ec 04             	sub    $0x4,%esp
+  80214d:	53                   	push   %ebx
+  80214e:	50                   	push   %eax
+  80214f:	68 49 3d 80 00       	push   $0x803d49
+  802154:	e8 78 e0 ff ff       	call   8001d1 <cprintf>
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802161:	eb d8                	jmp    80213b <write+0x53>
+  802163:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802168:	eb d1                	jmp    80213b <write+0x53>
+
+0080216a <seek>:
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	83 ec 20             	sub    $0x20,%esp
+  802170:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802173:	50                   	push   %eax
+  802174:	ff 75 08             	push   0x8(%ebp)
+  802177:	e8 2f fc ff ff       	call   801dab <fd_lookup>
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	78 0e                	js     802191 <seek+0x27>
+  802183:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802189:	89 50 04             	mov    %edx,0x4(%eax)
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+
+00802193 <ftruncate>:
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	56                   	push   %esi
+  802197:	53                   	push   %ebx
+  802198:	83 ec 18             	sub    $0x18,%esp
+  80219b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80219e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021a1:	50                   	push   %eax
+  8021a2:	53                   	push   %ebx
+  8021a3:	e8 03 fc ff ff       	call   801dab <fd_lookup>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	78 34                	js     8021e3 <ftruncate+0x50>
+  8021af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021b2:	83 ec 08             	sub    $0x8,%esp
+  8021b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b8:	50                   	push   %eax
+  8021b9:	ff 36                	push   (%esi)
+  8021bb:	e8 3b fc ff ff       	call   801dfb <dev_lookup>
+  8021c0:	83 c4 10             	add    $0x10,%esp
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 1c                	js     8021e3 <ftruncate+0x50>
+  8021c7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021cb:	74 1d                	je     8021ea <ftruncate+0x57>
+  8021cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d0:	8b 40 18             	mov    0x18(%eax),%eax
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	74 34                	je     80220b <ftruncate+0x78>
+  8021d7:	83 ec 08             	sub    $0x8,%esp
+  8021da:	ff 75 0c             	push   0xc(%ebp)
+  8021dd:	56                   	push   %esi
+  8021de:	ff d0                	call   *%eax
+  8021e0:	83 c4 10             	add    $0x10,%esp
+  8021e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e6:	5b                   	pop    %ebx
+  8021e7:	5e                   	pop    %esi
+  8021e8:	5d                   	pop    %ebp
+  8021e9:	c3                   	ret
+  8021ea:	a1 14 50 80 00       	mov    0x805014,%eax
+  8021ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8021f2:	83 ec 04             	sub    $0x4,%esp
+  8021f5:	53                   	push   %ebx
+  8021f6:	50                   	push   %eax
+  8021f7:	68 0c 3d 80 00       	push   $0x803d0c
+  8021fc:	e8 d0 df ff ff       	call   8001d1 <cprintf>
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802209:	eb d8                	jmp    8021e3 <ftruncate+0x50>
+  80220b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802210:	eb d1                	jmp    8021e3 <ftruncate+0x50>
+
+00802212 <fstat>:
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	56                   	push   %esi
+  802216:	53                   	push   %ebx
+  802217:	83 ec 18             	sub    $0x18,%esp
+  80221a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80221d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802220:	50                   	push   %eax
+  802221:	ff 75 08             	push   0x8(%ebp)
+  802224:	e8 82 fb ff ff       	call   801dab <fd_lookup>
+  802229:	83 c4 10             	add    $0x10,%esp
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	78 49                	js     802279 <fstat+0x67>
+  802230:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802239:	50                   	push   %eax
+  80223a:	ff 36                	push   (%esi)
+  80223c:	e8 ba fb ff ff       	call   801dfb <dev_lookup>
+  802241:	83 c4 10             	add    $0x10,%esp
+  802244:	85 c0                	test   %eax,%eax
+  802246:	78 31                	js     802279 <fstat+0x67>
+  802248:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80224f:	74 2f                	je     802280 <fstat+0x6e>
+  802251:	c6 03 00             	movb   $0x0,(%ebx)
+  802254:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80225b:	00 00 00 
+  80225e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802265:	00 00 00 
+  802268:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  80226e:	83 ec 08             	sub    $0x8,%esp
+  802271:	53                   	push   %ebx
+  802272:	56                   	push   %esi
+  802273:	ff 50 14             	call   *0x14(%eax)
+  802276:	83 c4 10             	add    $0x10,%esp
+  802279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227c:	5b                   	pop    %ebx
+  80227d:	5e                   	pop    %esi
+  80227e:	5d                   	pop    %ebp
+  80227f:	c3                   	ret
+  802280:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802285:	eb f2                	jmp    802279 <fstat+0x67>
+
+00802287 <stat>:
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	56                   	push   %esi
+  80228b:	53                   	push   %ebx
+  80228c:	83 ec 08             	sub    $0x8,%esp
+  80228f:	6a 00                	push   $0x0
+  802291:	ff 75 08             	push   0x8(%ebp)
+  802294:	e8 31 05 00 00       	call   8027ca <open>
+  802299:	89 c3                	mov    %eax,%ebx
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	78 1b                	js     8022bd <stat+0x36>
+  8022a2:	83 ec 08             	sub    $0x8,%esp
+  8022a5:	ff 75 0c             	push   0xc(%ebp)
+  8022a8:	50                   	push   %eax
+  8022a9:	e8 64 ff ff ff       	call   802212 <fstat>
+  8022ae:	89 c6                	mov    %eax,%esi
+  8022b0:	89 1c 24             	mov    %ebx,(%esp)
+  8022b3:	e8 19 fc ff ff       	call   801ed1 <close>
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	89 f3                	mov    %esi,%ebx
+  8022bd:	89 d8                	mov    %ebx,%eax
+  8022bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c2:	5b                   	pop    %ebx
+  8022c3:	5e                   	pop    %esi
+  8022c4:	5d                   	pop    %ebp
+  8022c5:	c3                   	ret
+
+008022c6 <fsipc>:
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	56                   	push   %esi
+  8022ca:	53                   	push   %ebx
+  8022cb:	89 c3                	mov    %eax,%ebx
+  8022cd:	89 d6                	mov    %edx,%esi
+  8022cf:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8022d6:	74 20                	je     8022f8 <fsipc+0x32>
+  8022d8:	83 ec 08             	sub    $0x8,%esp
+  8022db:	6a 00                	push   $0x0
+  8022dd:	56                   	push   %esi
+  8022de:	6a 07                	push   $0x7
+  8022e0:	68 00 60 80 00       	push   $0x806000
+  8022e5:	53                   	push   %ebx
+  8022e6:	ff 35 0c 50 80 00    	push   0x80500c
+  8022ec:	e8 8e f8 ff ff       	call   801b7f <ipc_call>
+  8022f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f4:	5b                   	pop    %ebx
+  8022f5:	5e                   	pop    %esi
+  8022f6:	5d                   	pop    %ebp
+  8022f7:	c3                   	ret
+  8022f8:	83 ec 0c             	sub    $0xc,%esp
+  8022fb:	6a 02                	push   $0x2
+  8022fd:	e8 18 fa ff ff       	call   801d1a <ipc_find_env>
+  802302:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	eb cc                	jmp    8022d8 <fsipc+0x12>
+
+0080230c <devfile_trunc>:
+  80230c:	55                   	push   %ebp
+  80230d:	89 e5                	mov    %esp,%ebp
+  80230f:	83 ec 08             	sub    $0x8,%esp
+  802312:	8b 45 08             	mov    0x8(%ebp),%eax
+  802315:	8b 40 0c             	mov    0xc(%eax),%eax
+  802318:	a3 00 60 80 00       	mov    %eax,0x806000
+  80231d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802320:	a3 04 60 80 00       	mov    %eax,0x806004
+  802325:	ba 00 00 00 00       	mov    $0x0,%edx
+  80232a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80232f:	e8 92 ff ff ff       	call   8022c6 <fsipc>
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+00802336 <devfile_flush>:
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	83 ec 08             	sub    $0x8,%esp
+  80233c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802342:	a3 00 60 80 00       	mov    %eax,0x806000
+  802347:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802351:	e8 70 ff ff ff       	call   8022c6 <fsipc>
+  802356:	c9                   	leave
+  802357:	c3                   	ret
+
+00802358 <devfile_stat>:
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	53                   	push   %ebx
+  80235c:	83 ec 04             	sub    $0x4,%esp
+  80235f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802362:	8b 45 08             	mov    0x8(%ebp),%eax
+  802365:	8b 40 0c             	mov    0xc(%eax),%eax
+  802368:	a3 00 60 80 00       	mov    %eax,0x806000
+  80236d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802372:	b8 07 00 00 00       	mov    $0x7,%eax
+  802377:	e8 4a ff ff ff       	call   8022c6 <fsipc>
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	78 2c                	js     8023ac <devfile_stat+0x54>
+  802380:	83 ec 08             	sub    $0x8,%esp
+  802383:	68 00 60 80 00       	push   $0x806000
+  802388:	53                   	push   %ebx
+  802389:	e8 3a e5 ff ff       	call   8008c8 <strcpy>
+  80238e:	a1 80 60 80 00       	mov    0x806080,%eax
+  802393:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802399:	a1 84 60 80 00       	mov    0x806084,%eax
+  80239e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8023a4:	83 c4 10             	add    $0x10,%esp
+  8023a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023af:	c9                   	leave
+  8023b0:	c3                   	ret
+
+008023b1 <fsring_rw>:
+  8023b1:	55                   	push   %ebp
+  8023b2:	89 e5                	mov    %esp,%ebp
+  8023b4:	57                   	push   %edi
+  8023b5:	56                   	push   %esi
+  8023b6:	53                   	push   %ebx
+  8023b7:	83 ec 2c             	sub    $0x2c,%esp
+  8023ba:	89 c7                	mov    %eax,%edi
+  8023bc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8023bf:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8023c2:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8023c7:	a8 01                	test   $0x1,%al
+  8023c9:	74 0d                	je     8023d8 <fsring_rw+0x27>
+  8023cb:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8023d0:	a8 01                	test   $0x1,%al
+  8023d2:	0f 85 d5 00 00 00    	jne    8024ad <fsring_rw+0xfc>
+  8023d8:	a1 14 50 80 00       	mov    0x805014,%eax
+  8023dd:	8b 40 48             	mov    0x48(%eax),%eax
+  8023e0:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  8023e6:	0f 84 fc 00 00 00    	je     8024e8 <fsring_rw+0x137>
+  8023ec:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8023f3:	0f 84 02 01 00 00    	je     8024fb <fsring_rw+0x14a>
+  8023f9:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8023fe:	83 ec 04             	sub    $0x4,%esp
+  802401:	68 07 02 00 00       	push   $0x207
+  802406:	53                   	push   %ebx
+  802407:	6a 00                	push   $0x0
+  802409:	e8 1a e9 ff ff       	call   800d28 <sys_page_alloc>
+  80240e:	83 c4 10             	add    $0x10,%esp
+  802411:	85 c0                	test   %eax,%eax
+  802413:	0f 88 f9 00 00 00    	js     802512 <fsring_rw+0x161>
+  802419:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80241f:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802425:	75 d7                	jne    8023fe <fsring_rw+0x4d>
+  802427:	6a 0e                	push   $0xe
+  802429:	6a 0d                	push   $0xd
+  80242b:	ff 35 0c 50 80 00    	push   0x80500c
+  802431:	68 00 00 f0 cf       	push   $0xcff00000
+  802436:	e8 c4 0c 00 00       	call   8030ff <ipcring_init>
+  80243b:	83 c4 08             	add    $0x8,%esp
+  80243e:	6a 00                	push   $0x0
+  802440:	6a 00                	push   $0x0
+  802442:	68 07 02 00 00       	push   $0x207
+  802447:	68 00 00 f0 cf       	push   $0xcff00000
+  80244c:	6a 0b                	push   $0xb
+  80244e:	ff 35 0c 50 80 00    	push   0x80500c
+  802454:	e8 26 f7 ff ff       	call   801b7f <ipc_call>
+  802459:	89 c6                	mov    %eax,%esi
+  80245b:	83 c4 20             	add    $0x20,%esp
+  80245e:	85 c0                	test   %eax,%eax
+  802460:	0f 88 ac 00 00 00    	js     802512 <fsring_rw+0x161>
+  802466:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80246b:	89 d9                	mov    %ebx,%ecx
+  80246d:	83 c3 01             	add    $0x1,%ebx
+  802470:	89 da                	mov    %ebx,%edx
+  802472:	c1 e2 0c             	shl    $0xc,%edx
+  802475:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80247b:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802481:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802487:	83 ec 08             	sub    $0x8,%esp
+  80248a:	6a 00                	push   $0x0
+  80248c:	6a 00                	push   $0x0
+  80248e:	68 07 02 00 00       	push   $0x207
+  802493:	50                   	push   %eax
+  802494:	6a 0c                	push   $0xc
+  802496:	ff 35 0c 50 80 00    	push   0x80500c
+  80249c:	e8 de f6 ff ff       	call   801b7f <ipc_call>
+  8024a1:	83 c4 20             	add    $0x20,%esp
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	78 6a                	js     802512 <fsring_rw+0x161>
+  8024a8:	83 fb 08             	cmp    $0x8,%ebx
+  8024ab:	75 be                	jne    80246b <fsring_rw+0xba>
+  8024ad:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8024b1:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8024b6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024bb:	0f 45 c2             	cmovne %edx,%eax
+  8024be:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8024c1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8024c8:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8024cf:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8024d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024db:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e0:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8024e3:	e9 4b 01 00 00       	jmp    802633 <fsring_rw+0x282>
+  8024e8:	e8 05 ec ff ff       	call   8010f2 <sys_time_msec>
+  8024ed:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8024f3:	0f 89 f3 fe ff ff    	jns    8023ec <fsring_rw+0x3b>
+  8024f9:	eb 54                	jmp    80254f <fsring_rw+0x19e>
+  8024fb:	83 ec 0c             	sub    $0xc,%esp
+  8024fe:	6a 02                	push   $0x2
+  802500:	e8 15 f8 ff ff       	call   801d1a <ipc_find_env>
+  802505:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80250a:	83 c4 10             	add    $0x10,%esp
+  80250d:	e9 e7 fe ff ff       	jmp    8023f9 <fsring_rw+0x48>
+  802512:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802517:	83 ec 08             	sub    $0x8,%esp
+  80251a:	53                   	push   %ebx
+  80251b:	6a 00                	push   $0x0
+  80251d:	e8 d8 e8 ff ff       	call   800dfa <sys_page_unmap>
+  802522:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802528:	83 c4 10             	add    $0x10,%esp
+  80252b:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802531:	75 e4                	jne    802517 <fsring_rw+0x166>
+  802533:	e8 ba eb ff ff       	call   8010f2 <sys_time_msec>
+  802538:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80253d:	a3 04 50 80 00       	mov    %eax,0x805004
+  802542:	a1 14 50 80 00       	mov    0x805014,%eax
+  802547:	8b 40 48             	mov    0x48(%eax),%eax
+  80254a:	a3 08 50 80 00       	mov    %eax,0x805008
+  80254f:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802556:	e9 7a 01 00 00       	jmp    8026d5 <fsring_rw+0x324>
+  80255b:	8b 57 0c             	mov    0xc(%edi),%edx
+  80255e:	89 10                	mov    %edx,(%eax)
+  802560:	89 58 04             	mov    %ebx,0x4(%eax)
+  802563:	89 f2                	mov    %esi,%edx
+  802565:	03 57 04             	add    0x4(%edi),%edx
+  802568:	89 50 08             	mov    %edx,0x8(%eax)
+  80256b:	83 ec 04             	sub    $0x4,%esp
+  80256e:	53                   	push   %ebx
+  80256f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802572:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802575:	52                   	push   %edx
+  802576:	83 c0 0c             	add    $0xc,%eax
+  802579:	50                   	push   %eax
+  80257a:	e8 f9 e4 ff ff       	call   800a78 <memmove>
+  80257f:	83 c4 10             	add    $0x10,%esp
+  802582:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802585:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802588:	89 08                	mov    %ecx,(%eax)
+  80258a:	83 ec 0c             	sub    $0xc,%esp
+  80258d:	68 00 00 f0 cf       	push   $0xcff00000
+  802592:	e8 c6 0b 00 00       	call   80315d <ipcring_req_push>
+  802597:	01 de                	add    %ebx,%esi
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80259f:	73 4c                	jae    8025ed <fsring_rw+0x23c>
+  8025a1:	83 ec 0c             	sub    $0xc,%esp
+  8025a4:	68 00 00 f0 cf       	push   $0xcff00000
+  8025a9:	e8 89 0b 00 00       	call   803137 <ipcring_req_slot>
+  8025ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025b1:	83 c4 10             	add    $0x10,%esp
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	74 35                	je     8025ed <fsring_rw+0x23c>
+  8025b8:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8025bd:	83 e0 07             	and    $0x7,%eax
+  8025c0:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8025c5:	c1 e0 0c             	shl    $0xc,%eax
+  8025c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025cb:	29 f3                	sub    %esi,%ebx
+  8025cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8025d0:	39 cb                	cmp    %ecx,%ebx
+  8025d2:	0f 47 d9             	cmova  %ecx,%ebx
+  8025d5:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8025d9:	75 80                	jne    80255b <fsring_rw+0x1aa>
+  8025db:	8b 57 0c             	mov    0xc(%edi),%edx
+  8025de:	89 10                	mov    %edx,(%eax)
+  8025e0:	89 58 04             	mov    %ebx,0x4(%eax)
+  8025e3:	89 f2                	mov    %esi,%edx
+  8025e5:	03 57 04             	add    0x4(%edi),%edx
+  8025e8:	89 50 08             	mov    %edx,0x8(%eax)
+  8025eb:	eb 95                	jmp    802582 <fsring_rw+0x1d1>
+  8025ed:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8025f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025f5:	83 ec 0c             	sub    $0xc,%esp
+  8025f8:	68 00 00 f0 cf       	push   $0xcff00000
+  8025fd:	e8 94 0b 00 00       	call   803196 <ipcring_rsp_wait>
+  802602:	8b 58 04             	mov    0x4(%eax),%ebx
+  802605:	83 c4 10             	add    $0x10,%esp
+  802608:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80260c:	75 45                	jne    802653 <fsring_rw+0x2a2>
+  80260e:	85 db                	test   %ebx,%ebx
+  802610:	79 41                	jns    802653 <fsring_rw+0x2a2>
+  802612:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802615:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80261c:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802623:	83 ec 0c             	sub    $0xc,%esp
+  802626:	68 00 00 f0 cf       	push   $0xcff00000
+  80262b:	e8 cc 0b 00 00       	call   8031fc <ipcring_rsp_pop>
+  802630:	83 c4 10             	add    $0x10,%esp
+  802633:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802639:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80263e:	39 c2                	cmp    %eax,%edx
+  802640:	74 75                	je     8026b7 <fsring_rw+0x306>
+  802642:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802646:	75 a5                	jne    8025ed <fsring_rw+0x23c>
+  802648:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80264b:	0f 82 50 ff ff ff    	jb     8025a1 <fsring_rw+0x1f0>
+  802651:	eb 9a                	jmp    8025ed <fsring_rw+0x23c>
+  802653:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802657:	75 ca                	jne    802623 <fsring_rw+0x272>
+  802659:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80265d:	74 31                	je     802690 <fsring_rw+0x2df>
+  80265f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802662:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802665:	29 c8                	sub    %ecx,%eax
+  802667:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80266a:	39 d0                	cmp    %edx,%eax
+  80266c:	0f 47 c2             	cmova  %edx,%eax
+  80266f:	39 d8                	cmp    %ebx,%eax
+  802671:	ba 01 00 00 00       	mov    $0x1,%edx
+  802676:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80267a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80267d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802682:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802686:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802689:	01 d9                	add    %ebx,%ecx
+  80268b:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80268e:	eb 93                	jmp    802623 <fsring_rw+0x272>
+  802690:	83 ec 04             	sub    $0x4,%esp
+  802693:	53                   	push   %ebx
+  802694:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802697:	83 e0 07             	and    $0x7,%eax
+  80269a:	c1 e0 0c             	shl    $0xc,%eax
+  80269d:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8026a3:	50                   	push   %eax
+  8026a4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026a7:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8026aa:	01 c8                	add    %ecx,%eax
+  8026ac:	50                   	push   %eax
+  8026ad:	e8 c6 e3 ff ff       	call   800a78 <memmove>
+  8026b2:	83 c4 10             	add    $0x10,%esp
+  8026b5:	eb a8                	jmp    80265f <fsring_rw+0x2ae>
+  8026b7:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8026bb:	75 09                	jne    8026c6 <fsring_rw+0x315>
+  8026bd:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8026c0:	0f 82 db fe ff ff    	jb     8025a1 <fsring_rw+0x1f0>
+  8026c6:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8026c9:	01 57 04             	add    %edx,0x4(%edi)
+  8026cc:	85 d2                	test   %edx,%edx
+  8026ce:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8026d2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8026d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8026d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026db:	5b                   	pop    %ebx
+  8026dc:	5e                   	pop    %esi
+  8026dd:	5f                   	pop    %edi
+  8026de:	5d                   	pop    %ebp
+  8026df:	c3                   	ret
+
+008026e0 <devfile_write>:
+  8026e0:	55                   	push   %ebp
+  8026e1:	89 e5                	mov    %esp,%ebp
+  8026e3:	57                   	push   %edi
+  8026e4:	56                   	push   %esi
+  8026e5:	53                   	push   %ebx
+  8026e6:	83 ec 0c             	sub    $0xc,%esp
+  8026e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8026ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026f2:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8026f8:	76 1a                	jbe    802714 <devfile_write+0x34>
+  8026fa:	83 ec 0c             	sub    $0xc,%esp
+  8026fd:	53                   	push   %ebx
+  8026fe:	89 f1                	mov    %esi,%ecx
+  802700:	ba 06 00 00 00       	mov    $0x6,%edx
+  802705:	89 f8                	mov    %edi,%eax
+  802707:	e8 a5 fc ff ff       	call   8023b1 <fsring_rw>
+  80270c:	83 c4 10             	add    $0x10,%esp
+  80270f:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802712:	75 39                	jne    80274d <devfile_write+0x6d>
+  802714:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802719:	39 c3                	cmp    %eax,%ebx
+  80271b:	0f 47 d8             	cmova  %eax,%ebx
+  80271e:	8b 47 0c             	mov    0xc(%edi),%eax
+  802721:	a3 00 60 80 00       	mov    %eax,0x806000
+  802726:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80272c:	83 ec 04             	sub    $0x4,%esp
+  80272f:	53                   	push   %ebx
+  802730:	56                   	push   %esi
+  802731:	68 08 60 80 00       	push   $0x806008
+  802736:	e8 3d e3 ff ff       	call   800a78 <memmove>
+  80273b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802740:	b8 04 00 00 00       	mov    $0x4,%eax
+  802745:	e8 7c fb ff ff       	call   8022c6 <fsipc>
+  80274a:	83 c4 10             	add    $0x10,%esp
+  80274d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802750:	5b                   	pop    %ebx
+  802751:	5e                   	pop    %esi
+  802752:	5f                   	pop    %edi
+  802753:	5d                   	pop    %ebp
+  802754:	c3                   	ret
+
+00802755 <devfile_read>:
+  802755:	55                   	push   %ebp
+  802756:	89 e5                	mov    %esp,%ebp
+  802758:	57                   	push   %edi
+  802759:	56                   	push   %esi
+  80275a:	53                   	push   %ebx
+  80275b:	83 ec 0c             	sub    $0xc,%esp
+  80275e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802761:	8b 75 10             	mov    0x10(%ebp),%esi
+  802764:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80276a:	76 1d                	jbe    802789 <devfile_read+0x34>
+  80276c:	83 ec 0c             	sub    $0xc,%esp
+  80276f:	56                   	push   %esi
+  802770:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802773:	ba 05 00 00 00       	mov    $0x5,%edx
+  802778:	89 f8                	mov    %edi,%eax
+  80277a:	e8 32 fc ff ff       	call   8023b1 <fsring_rw>
+  80277f:	89 c3                	mov    %eax,%ebx
+  802781:	83 c4 10             	add    $0x10,%esp
+  802784:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802787:	75 37                	jne    8027c0 <devfile_read+0x6b>
+  802789:	8b 47 0c             	mov    0xc(%edi),%eax
+  80278c:	a3 00 60 80 00       	mov    %eax,0x806000
+  802791:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802797:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279c:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027a1:	e8 20 fb ff ff       	call   8022c6 <fsipc>
+  8027a6:	89 c3                	mov    %eax,%ebx
+  8027a8:	85 c0                	test   %eax,%eax
+  8027aa:	78 14                	js     8027c0 <devfile_read+0x6b>
+  8027ac:	83 ec 04             	sub    $0x4,%esp
+  8027af:	50                   	push   %eax
+  8027b0:	68 00 60 80 00       	push   $0x806000
+  8027b5:	ff 75 0c             	push   0xc(%ebp)
+  8027b8:	e8 bb e2 ff ff       	call   800a78 <memmove>
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	89 d8                	mov    %ebx,%eax
+  8027c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c5:	5b                   	pop    %ebx
+  8027c6:	5e                   	pop    %esi
+  8027c7:	5f                   	pop    %edi
+  8027c8:	5d                   	pop    %ebp
+  8027c9:	c3                   	ret
+
+008027ca <open>:
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	56                   	push   %esi
+  8027ce:	53                   	push   %ebx
+  8027cf:	83 ec 1c             	sub    $0x1c,%esp
+  8027d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027d5:	56                   	push   %esi
+  8027d6:	e8 a1 e0 ff ff       	call   80087c <strlen>
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027e3:	7f 6c                	jg     802851 <open+0x87>
+  8027e5:	83 ec 0c             	sub    $0xc,%esp
+  8027e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027eb:	50                   	push   %eax
+  8027ec:	e8 6a f5 ff ff       	call   801d5b <fd_alloc>
+  8027f1:	89 c3                	mov    %eax,%ebx
+  8027f3:	83 c4 10             	add    $0x10,%esp
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 3c                	js     802836 <open+0x6c>
+  8027fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027fd:	a3 00 64 80 00       	mov    %eax,0x806400
+  802802:	83 ec 08             	sub    $0x8,%esp
+  802805:	56                   	push   %esi
+  802806:	68 00 60 80 00       	push   $0x806000
+  80280b:	e8 b8 e0 ff ff       	call   8008c8 <strcpy>
+  802810:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802813:	b8 01 00 00 00       	mov    $0x1,%eax
+  802818:	e8 a9 fa ff ff       	call   8022c6 <fsipc>
+  80281d:	89 c3                	mov    %eax,%ebx
+  80281f:	83 c4 10             	add    $0x10,%esp
+  802822:	85 c0                	test   %eax,%eax
+  802824:	78 19                	js     80283f <open+0x75>
+  802826:	83 ec 0c             	sub    $0xc,%esp
+  802829:	ff 75 f4             	push   -0xc(%ebp)
+  80282c:	e8 03 f5 ff ff       	call   801d34 <fd2num>
+  802831:	89 c3                	mov    %eax,%ebx
+  802833:	83 c4 10             	add    $0x10,%esp
+  802836:	89 d8                	mov    %ebx,%eax
+  802838:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80283b:	5b                   	pop    %ebx
+  80283c:	5e                   	pop    %esi
+  80283d:	5d                   	pop    %ebp
+  80283e:	c3                   	ret
+  80283f:	83 ec 08             	sub    $0x8,%esp
+  802842:	6a 00                	push   $0x0
+  802844:	ff 75 f4             	push   -0xc(%ebp)
+  802847:	e8 05 f6 ff ff       	call   801e51 <fd_close>
+  80284c:	83 c4 10             	add    $0x10,%esp
+  80284f:	eb e5                	jmp    802836 <open+0x6c>
+  802851:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802856:	eb de                	jmp    802836 <open+0x6c>
+
+00802858 <file_image>:
+  802858:	55                   	push   %ebp
+  802859:	89 e5                	mov    %esp,%ebp
+  80285b:	53                   	push   %ebx
+  80285c:	83 ec 1c             	sub    $0x1c,%esp
+  80285f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802862:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802865:	50                   	push   %eax
+  802866:	ff 75 08             	push   0x8(%ebp)
+  802869:	e8 3d f5 ff ff       	call   801dab <fd_lookup>
+  80286e:	83 c4 10             	add    $0x10,%esp
+  802871:	85 c0                	test   %eax,%eax
+  802873:	78 58                	js     8028cd <file_image+0x75>
+  802875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802878:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80287e:	39 08                	cmp    %ecx,(%eax)
+  802880:	75 50                	jne    8028d2 <file_image+0x7a>
+  802882:	83 fb 04             	cmp    $0x4,%ebx
+  802885:	77 52                	ja     8028d9 <file_image+0x81>
+  802887:	8b 40 0c             	mov    0xc(%eax),%eax
+  80288a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80288f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802895:	83 ec 04             	sub    $0x4,%esp
+  802898:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80289b:	c1 e0 02             	shl    $0x2,%eax
+  80289e:	50                   	push   %eax
+  80289f:	ff 75 0c             	push   0xc(%ebp)
+  8028a2:	68 08 60 80 00       	push   $0x806008
+  8028a7:	e8 cc e1 ff ff       	call   800a78 <memmove>
+  8028ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028b6:	e8 0b fa ff ff       	call   8022c6 <fsipc>
+  8028bb:	83 c4 10             	add    $0x10,%esp
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	78 0b                	js     8028cd <file_image+0x75>
+  8028c2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8028c5:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  8028cb:	89 0a                	mov    %ecx,(%edx)
+  8028cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+  8028d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028d7:	eb f4                	jmp    8028cd <file_image+0x75>
+  8028d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028de:	eb ed                	jmp    8028cd <file_image+0x75>
+
+008028e0 <remove>:
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+  8028e3:	53                   	push   %ebx
+  8028e4:	83 ec 10             	sub    $0x10,%esp
+  8028e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028ea:	53                   	push   %ebx
+  8028eb:	e8 8c df ff ff       	call   80087c <strlen>
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028f8:	7f 25                	jg     80291f <remove+0x3f>
+  8028fa:	83 ec 08             	sub    $0x8,%esp
+  8028fd:	53                   	push   %ebx
+  8028fe:	68 00 60 80 00       	push   $0x806000
+  802903:	e8 c0 df ff ff       	call   8008c8 <strcpy>
+  802908:	ba 00 00 00 00       	mov    $0x0,%edx
+  80290d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802912:	e8 af f9 ff ff       	call   8022c6 <fsipc>
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291d:	c9                   	leave
+  80291e:	c3                   	ret
+  80291f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802924:	eb f4                	jmp    80291a <remove+0x3a>
+
+00802926 <sync>:
+  802926:	55                   	push   %ebp
+  802927:	89 e5                	mov    %esp,%ebp
+  802929:	83 ec 08             	sub    $0x8,%esp
+  80292c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802931:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802936:	e8 8b f9 ff ff       	call   8022c6 <fsipc>
+  80293b:	c9                   	leave
+  80293c:	c3                   	ret
+
+0080293d <devsock_stat>:
+  80293d:	55                   	push   %ebp
+  80293e:	89 e5                	mov    %esp,%ebp
+  802940:	83 ec 10             	sub    $0x10,%esp
+  802943:	68 7c 3d 80 00       	push   $0x803d7c
+  802948:	ff 75 0c             	push   0xc(%ebp)
+  80294b:	e8 78 df ff ff       	call   8008c8 <strcpy>
+  802950:	b8 00 00 00 00       	mov    $0x0,%eax
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+
+00802957 <devsock_close>:
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	53                   	push   %ebx
+  80295b:	83 ec 10             	sub    $0x10,%esp
+  80295e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802961:	53                   	push   %ebx
+  802962:	e8 15 0c 00 00       	call   80357c <pageref>
+  802967:	89 c2                	mov    %eax,%edx
+  802969:	83 c4 10             	add    $0x10,%esp
+  80296c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802971:	83 fa 01             	cmp    $0x1,%edx
+  802974:	74 05                	je     80297b <devsock_close+0x24>
+  802976:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802979:	c9                   	leave
+  80297a:	c3                   	ret
+  80297b:	83 ec 0c             	sub    $0xc,%esp
+  80297e:	ff 73 0c             	push   0xc(%ebx)
+  802981:	e8 aa 02 00 00       	call   802c30 <nsipc_close>
+  802986:	83 c4 10             	add    $0x10,%esp
+  802989:	eb eb                	jmp    802976 <devsock_close+0x1f>
+
+0080298b <devsock_write>:
+  80298b:	55                   	push   %ebp
+  80298c:	89 e5                	mov    %esp,%ebp
+  80298e:	83 ec 08             	sub    $0x8,%esp
+  802991:	6a 00                	push   $0x0
+  802993:	ff 75 10             	push   0x10(%ebp)
+  802996:	ff 75 0c             	push   0xc(%ebp)
+  802999:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299c:	ff 70 0c             	push   0xc(%eax)
+  80299f:	e8 6c 03 00 00       	call   802d10 <nsipc_send>
+  8029a4:	c9                   	leave
+  8029a5:	c3                   	ret
+
+008029a6 <devsock_read>:
+  8029a6:	55                   	push   %ebp
+  8029a7:	89 e5                	mov    %esp,%ebp
+  8029a9:	83 ec 08             	sub    $0x8,%esp
+  8029ac:	6a 00                	push   $0x0
+  8029ae:	ff 75 10             	push   0x10(%ebp)
+  8029b1:	ff 75 0c             	push   0xc(%ebp)
+  8029b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b7:	ff 70 0c             	push   0xc(%eax)
+  8029ba:	e8 e2 02 00 00       	call   802ca1 <nsipc_recv>
+  8029bf:	c9                   	leave
+  8029c0:	c3                   	ret
+
+008029c1 <fd2sockid>:
+  8029c1:	55                   	push   %ebp
+  8029c2:	89 e5                	mov    %esp,%ebp
+  8029c4:	83 ec 20             	sub    $0x20,%esp
+  8029c7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029ca:	52                   	push   %edx
+  8029cb:	50                   	push   %eax
+  8029cc:	e8 da f3 ff ff       	call   801dab <fd_lookup>
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	78 10                	js     8029e8 <fd2sockid+0x27>
+  8029d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029db:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8029e1:	39 08                	cmp    %ecx,(%eax)
+  8029e3:	75 05                	jne    8029ea <fd2sockid+0x29>
+  8029e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029e8:	c9                   	leave
+  8029e9:	c3                   	ret
+  8029ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029ef:	eb f7                	jmp    8029e8 <fd2sockid+0x27>
+
+008029f1 <alloc_sockfd>:
+  8029f1:	55                   	push   %ebp
+  8029f2:	89 e5                	mov    %esp,%ebp
+  8029f4:	56                   	push   %esi
+  8029f5:	53                   	push   %ebx
+  8029f6:	83 ec 1c             	sub    $0x1c,%esp
+  8029f9:	89 c6                	mov    %eax,%esi
+  8029fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029fe:	50                   	push   %eax
+  8029ff:	e8 57 f3 ff ff       	call   801d5b <fd_alloc>
+  802a04:	89 c3                	mov    %eax,%ebx
+  802a06:	83 c4 10             	add    $0x10,%esp
+  802a09:	85 c0                	test   %eax,%eax
+  802a0b:	78 43                	js     802a50 <alloc_sockfd+0x5f>
+  802a0d:	83 ec 04             	sub    $0x4,%esp
+  802a10:	68 07 04 00 00       	push   $0x407
+  802a15:	ff 75 f4             	push   -0xc(%ebp)
+  802a18:	6a 00                	push   $0x0
+  802a1a:	e8 09 e3 ff ff       	call   800d28 <sys_page_alloc>
+  802a1f:	89 c3                	mov    %eax,%ebx
+  802a21:	83 c4 10             	add    $0x10,%esp
+  802a24:	85 c0                	test   %eax,%eax
+  802a26:	78 28                	js     802a50 <alloc_sockfd+0x5f>
+  802a28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a2b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a31:	89 10                	mov    %edx,(%eax)
+  802a33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a36:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802a3d:	89 70 0c             	mov    %esi,0xc(%eax)
+  802a40:	83 ec 0c             	sub    $0xc,%esp
+  802a43:	50                   	push   %eax
+  802a44:	e8 eb f2 ff ff       	call   801d34 <fd2num>
+  802a49:	89 c3                	mov    %eax,%ebx
+  802a4b:	83 c4 10             	add    $0x10,%esp
+  802a4e:	eb 0c                	jmp    802a5c <alloc_sockfd+0x6b>
+  802a50:	83 ec 0c             	sub    $0xc,%esp
+  802a53:	56                   	push   %esi
+  802a54:	e8 d7 01 00 00       	call   802c30 <nsipc_close>
+  802a59:	83 c4 10             	add    $0x10,%esp
+  802a5c:	89 d8                	mov    %ebx,%eax
+  802a5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a61:	5b                   	pop    %ebx
+  802a62:	5e                   	pop    %esi
+  802a63:	5d                   	pop    %ebp
+  802a64:	c3                   	ret
+
+00802a65 <accept>:
+  802a65:	55                   	push   %ebp
+  802a66:	89 e5                	mov    %esp,%ebp
+  802a68:	83 ec 08             	sub    $0x8,%esp
+  802a6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6e:	e8 4e ff ff ff       	call   8029c1 <fd2sockid>
+  802a73:	85 c0                	test   %eax,%eax
+  802a75:	78 1b                	js     802a92 <accept+0x2d>
+  802a77:	83 ec 04             	sub    $0x4,%esp
+  802a7a:	ff 75 10             	push   0x10(%ebp)
+  802a7d:	ff 75 0c             	push   0xc(%ebp)
+  802a80:	50                   	push   %eax
+  802a81:	e8 07 01 00 00       	call   802b8d <nsipc_accept>
+  802a86:	83 c4 10             	add    $0x10,%esp
+  802a89:	85 c0                	test   %eax,%eax
+  802a8b:	78 05                	js     802a92 <accept+0x2d>
+  802a8d:	e8 5f ff ff ff       	call   8029f1 <alloc_sockfd>
+  802a92:	c9                   	leave
+  802a93:	c3                   	ret
+
+00802a94 <bind>:
+  802a94:	55                   	push   %ebp
+  802a95:	89 e5                	mov    %esp,%ebp
+  802a97:	83 ec 08             	sub    $0x8,%esp
+  802a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9d:	e8 1f ff ff ff       	call   8029c1 <fd2sockid>
+  802aa2:	85 c0                	test   %eax,%eax
+  802aa4:	78 12                	js     802ab8 <bind+0x24>
+  802aa6:	83 ec 04             	sub    $0x4,%esp
+  802aa9:	ff 75 10             	push   0x10(%ebp)
+  802aac:	ff 75 0c             	push   0xc(%ebp)
+  802aaf:	50                   	push   %eax
+  802ab0:	e8 24 01 00 00       	call   802bd9 <nsipc_bind>
+  802ab5:	83 c4 10             	add    $0x10,%esp
+  802ab8:	c9                   	leave
+  802ab9:	c3                   	ret
+
+00802aba <shutdown>:
+  802aba:	55                   	push   %ebp
+  802abb:	89 e5                	mov    %esp,%ebp
+  802abd:	83 ec 08             	sub    $0x8,%esp
+  802ac0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac3:	e8 f9 fe ff ff       	call   8029c1 <fd2sockid>
+  802ac8:	85 c0                	test   %eax,%eax
+  802aca:	78 0f                	js     802adb <shutdown+0x21>
+  802acc:	83 ec 08             	sub    $0x8,%esp
+  802acf:	ff 75 0c             	push   0xc(%ebp)
+  802ad2:	50                   	push   %eax
+  802ad3:	e8 36 01 00 00       	call   802c0e <nsipc_shutdown>
+  802ad8:	83 c4 10             	add    $0x10,%esp
+  802adb:	c9                   	leave
+  802adc:	c3                   	ret
+
+00802add <connect>:
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	83 ec 08             	sub    $0x8,%esp
+  802ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae6:	e8 d6 fe ff ff       	call   8029c1 <fd2sockid>
+  802aeb:	85 c0                	test   %eax,%eax
+  802aed:	78 12                	js     802b01 <connect+0x24>
+  802aef:	83 ec 04             	sub    $0x4,%esp
+  802af2:	ff 75 10             	push   0x10(%ebp)
+  802af5:	ff 75 0c             	push   0xc(%ebp)
+  802af8:	50                   	push   %eax
+  802af9:	e8 4c 01 00 00       	call   802c4a <nsipc_connect>
+  802afe:	83 c4 10             	add    $0x10,%esp
+  802b01:	c9                   	leave
+  802b02:	c3                   	ret
+
+00802b03 <listen>:
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	83 ec 08             	sub    $0x8,%esp
+  802b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0c:	e8 b0 fe ff ff       	call   8029c1 <fd2sockid>
+  802b11:	85 c0                	test   %eax,%eax
+  802b13:	78 0f                	js     802b24 <listen+0x21>
+  802b15:	83 ec 08             	sub    $0x8,%esp
+  802b18:	ff 75 0c             	push   0xc(%ebp)
+  802b1b:	50                   	push   %eax
+  802b1c:	e8 5e 01 00 00       	call   802c7f <nsipc_listen>
+  802b21:	83 c4 10             	add    $0x10,%esp
+  802b24:	c9                   	leave
+  802b25:	c3                   	ret
+
+00802b26 <socket>:
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	83 ec 0c             	sub    $0xc,%esp
+  802b2c:	ff 75 10             	push   0x10(%ebp)
+  802b2f:	ff 75 0c             	push   0xc(%ebp)
+  802b32:	ff 75 08             	push   0x8(%ebp)
+  802b35:	e8 34 02 00 00       	call   802d6e <nsipc_socket>
+  802b3a:	83 c4 10             	add    $0x10,%esp
+  802b3d:	85 c0                	test   %eax,%eax
+  802b3f:	78 05                	js     802b46 <socket+0x20>
+  802b41:	e8 ab fe ff ff       	call   8029f1 <alloc_sockfd>
+  802b46:	c9                   	leave
+  802b47:	c3                   	ret
+
+00802b48 <nsipc>:
+  802b48:	55                   	push   %ebp
+  802b49:	89 e5                	mov    %esp,%ebp
+  802b4b:	53                   	push   %ebx
+  802b4c:	83 ec 04             	sub    $0x4,%esp
+  802b4f:	89 c3                	mov    %eax,%ebx
+  802b51:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  802b58:	74 1f                	je     802b79 <nsipc+0x31>
+  802b5a:	83 ec 08             	sub    $0x8,%esp
+  802b5d:	6a 00                	push   $0x0
+  802b5f:	6a 00                	push   $0x0
+  802b61:	6a 07                	push   $0x7
+  802b63:	68 00 70 80 00       	push   $0x807000
+  802b68:	53                   	push   %ebx
+  802b69:	ff 35 10 50 80 00    	push   0x805010
+  802b6f:	e8 0b f0 ff ff       	call   801b7f <ipc_call>
+  802b74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b77:	c9                   	leave
+  802b78:	c3                   	ret
+  802b79:	83 ec 0c             	sub    $0xc,%esp
+  802b7c:	6a 03                	push   $0x3
+  802b7e:	e8 97 f1 ff ff       	call   801d1a <ipc_find_env>
+  802b83:	a3 10 50 80 00       	mov    %eax,0x805010
+  802b88:	83 c4 10             	add    $0x10,%esp
+  802b8b:	eb cd                	jmp    802b5a <nsipc+0x12>
+
+00802b8d <nsipc_accept>:
+  802b8d:	55                   	push   %ebp
+  802b8e:	89 e5                	mov    %esp,%ebp
+  802b90:	53                   	push   %ebx
+  802b91:	83 ec 04             	sub    $0x4,%esp
+  802b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b97:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b9c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ba1:	e8 a2 ff ff ff       	call   802b48 <nsipc>
+  802ba6:	89 c3                	mov    %eax,%ebx
+  802ba8:	85 c0                	test   %eax,%eax
+  802baa:	79 07                	jns    802bb3 <nsipc_accept+0x26>
+  802bac:	89 d8                	mov    %ebx,%eax
+  802bae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb1:	c9                   	leave
+  802bb2:	c3                   	ret
+  802bb3:	83 ec 04             	sub    $0x4,%esp
+  802bb6:	ff 35 10 70 80 00    	push   0x807010
+  802bbc:	68 00 70 80 00       	push   $0x807000
+  802bc1:	ff 75 0c             	push   0xc(%ebp)
+  802bc4:	e8 af de ff ff       	call   800a78 <memmove>
+  802bc9:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802bcf:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd2:	89 10                	mov    %edx,(%eax)
+  802bd4:	83 c4 10             	add    $0x10,%esp
+  802bd7:	eb d3                	jmp    802bac <nsipc_accept+0x1f>
+
+00802bd9 <nsipc_bind>:
+  802bd9:	55                   	push   %ebp
+  802bda:	89 e5                	mov    %esp,%ebp
+  802bdc:	53                   	push   %ebx
+  802bdd:	83 ec 08             	sub    $0x8,%esp
+  802be0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be6:	a3 00 70 80 00       	mov    %eax,0x807000
+  802beb:	53                   	push   %ebx
+  802bec:	ff 75 0c             	push   0xc(%ebp)
+  802bef:	68 04 70 80 00       	push   $0x807004
+  802bf4:	e8 7f de ff ff       	call   800a78 <memmove>
+  802bf9:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802bff:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c04:	e8 3f ff ff ff       	call   802b48 <nsipc>
+  802c09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c0c:	c9                   	leave
+  802c0d:	c3                   	ret
+
+00802c0e <nsipc_shutdown>:
+  802c0e:	55                   	push   %ebp
+  802c0f:	89 e5                	mov    %esp,%ebp
+  802c11:	83 ec 08             	sub    $0x8,%esp
+  802c14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c17:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c1f:	a3 04 70 80 00       	mov    %eax,0x807004
+  802c24:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c29:	e8 1a ff ff ff       	call   802b48 <nsipc>
+  802c2e:	c9                   	leave
+  802c2f:	c3                   	ret
+
+00802c30 <nsipc_close>:
+  802c30:	55                   	push   %ebp
+  802c31:	89 e5                	mov    %esp,%ebp
+  802c33:	83 ec 08             	sub    $0x8,%esp
+  802c36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c39:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c3e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c43:	e8 00 ff ff ff       	call   802b48 <nsipc>
+  802c48:	c9                   	leave
+  802c49:	c3                   	ret
+
+00802c4a <nsipc_connect>:
+  802c4a:	55                   	push   %ebp
+  802c4b:	89 e5                	mov    %esp,%ebp
+  802c4d:	53                   	push   %ebx
+  802c4e:	83 ec 08             	sub    $0x8,%esp
+  802c51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c57:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c5c:	53                   	push   %ebx
+  802c5d:	ff 75 0c             	push   0xc(%ebp)
+  802c60:	68 04 70 80 00       	push   $0x807004
+  802c65:	e8 0e de ff ff       	call   800a78 <memmove>
+  802c6a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802c70:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c75:	e8 ce fe ff ff       	call   802b48 <nsipc>
+  802c7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c7d:	c9                   	leave
+  802c7e:	c3                   	ret
+
+00802c7f <nsipc_listen>:
+  802c7f:	55                   	push   %ebp
+  802c80:	89 e5                	mov    %esp,%ebp
+  802c82:	83 ec 08             	sub    $0x8,%esp
+  802c85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c88:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c90:	a3 04 70 80 00       	mov    %eax,0x807004
+  802c95:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c9a:	e8 a9 fe ff ff       	call   802b48 <nsipc>
+  802c9f:	c9                   	leave
+  802ca0:	c3                   	ret
+
+00802ca1 <nsipc_recv>:
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	56                   	push   %esi
+  802ca5:	53                   	push   %ebx
+  802ca6:	8b 75 10             	mov    0x10(%ebp),%esi
+  802ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cac:	a3 00 70 80 00       	mov    %eax,0x807000
+  802cb1:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802cb7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cba:	a3 08 70 80 00       	mov    %eax,0x807008
+  802cbf:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cc4:	e8 7f fe ff ff       	call   802b48 <nsipc>
+  802cc9:	89 c3                	mov    %eax,%ebx
+  802ccb:	85 c0                	test   %eax,%eax
+  802ccd:	78 22                	js     802cf1 <nsipc_recv+0x50>
+  802ccf:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802cd4:	39 c6                	cmp    %eax,%esi
+  802cd6:	0f 4e c6             	cmovle %esi,%eax
+  802cd9:	39 c3                	cmp    %eax,%ebx
+  802cdb:	7f 1d                	jg     802cfa <nsipc_recv+0x59>
+  802cdd:	83 ec 04             	sub    $0x4,%esp
+  802ce0:	53                   	push   %ebx
+  802ce1:	68 00 70 80 00       	push   $0x807000
+  802ce6:	ff 75 0c             	push   0xc(%ebp)
+  802ce9:	e8 8a dd ff ff       	call   800a78 <memmove>
+  802cee:	83 c4 10             	add    $0x10,%esp
+  802cf1:	89 d8                	mov    %ebx,%eax
+  802cf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf6:	5b                   	pop    %ebx
+  802cf7:	5e                   	pop    %esi
+  802cf8:	5d                   	pop    %ebp
+  802cf9:	c3                   	ret
+  802cfa:	68 88 3d 80 00       	push   $0x803d88
+  802cff:	68 9d 3d 80 00       	push   $0x803d9d
+  802d04:	6a 60                	push   $0x60
+  802d06:	68 b2 3d 80 00       	push   $0x803db2
+  802d0b:	e8 83 07 00 00       	call   803493 <_panic>
+
+00802d10 <nsipc_send>:
+  802d10:	55                   	push   %ebp
+  802d11:	89 e5                	mov    %esp,%ebp
+  802d13:	53                   	push   %ebx
+  802d14:	83 ec 04             	sub    $0x4,%esp
+  802d17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d22:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d28:	7f 2e                	jg     802d58 <nsipc_send+0x48>
+  802d2a:	83 ec 04             	sub    $0x4,%esp
+  802d2d:	53                   	push   %ebx
+  802d2e:	ff 75 0c             	push   0xc(%ebp)
+  802d31:	68 0c 70 80 00       	push   $0x80700c
+  802d36:	e8 3d dd ff ff       	call   800a78 <memmove>
+  802d3b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802d41:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d44:	a3 08 70 80 00       	mov    %eax,0x807008
+  802d49:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d4e:	e8 f5 fd ff ff       	call   802b48 <nsipc>
+  802d53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d56:	c9                   	leave
+  802d57:	c3                   	ret
+  802d58:	68 be 3d 80 00       	push   $0x803dbe
+  802d5d:	68 9d 3d 80 00       	push   $0x803d9d
+  802d62:	6a 6b                	push   $0x6b
+  802d64:	68 b2 3d 80 00       	push   $0x803db2
+  802d69:	e8 25 07 00 00       	call   803493 <_panic>
+
+00802d6e <nsipc_socket>:
+  802d6e:	55                   	push   %ebp
+  802d6f:	89 e5                	mov    %esp,%ebp
+  802d71:	83 ec 08             	sub    $0x8,%esp
+  802d74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d77:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d7f:	a3 04 70 80 00       	mov    %eax,0x807004
+  802d84:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d87:	a3 08 70 80 00       	mov    %eax,0x807008
+  802d8c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d91:	e8 b2 fd ff ff       	call   802b48 <nsipc>
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+
+00802d98 <devpipe_stat>:
+  802d98:	55                   	push   %ebp
+  802d99:	89 e5                	mov    %esp,%ebp
+  802d9b:	56                   	push   %esi
+  802d9c:	53                   	push   %ebx
+  802d9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802da0:	83 ec 0c             	sub    $0xc,%esp
+  802da3:	ff 75 08             	push   0x8(%ebp)
+  802da6:	e8 99 ef ff ff       	call   801d44 <fd2data>
+  802dab:	89 c6                	mov    %eax,%esi
+  802dad:	83 c4 08             	add    $0x8,%esp
+  802db0:	68 ca 3d 80 00       	push   $0x803dca
+  802db5:	53                   	push   %ebx
+  802db6:	e8 0d db ff ff       	call   8008c8 <strcpy>
+  802dbb:	8b 46 04             	mov    0x4(%esi),%eax
+  802dbe:	2b 06                	sub    (%esi),%eax
+  802dc0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802dc6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802dcd:	00 00 00 
+  802dd0:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802dd7:	40 80 00 
+  802dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802de2:	5b                   	pop    %ebx
+  802de3:	5e                   	pop    %esi
+  802de4:	5d                   	pop    %ebp
+  802de5:	c3                   	ret
+
+00802de6 <devpipe_close>:
+  802de6:	55                   	push   %ebp
+  802de7:	89 e5                	mov    %esp,%ebp
+  802de9:	53                   	push   %ebx
+  802dea:	83 ec 0c             	sub    $0xc,%esp
+  802ded:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802df0:	53                   	push   %ebx
+  802df1:	6a 00                	push   $0x0
+  802df3:	e8 02 e0 ff ff       	call   800dfa <sys_page_unmap>
+  802df8:	89 1c 24             	mov    %ebx,(%esp)
+  802dfb:	e8 44 ef ff ff       	call   801d44 <fd2data>
+  802e00:	83 c4 08             	add    $0x8,%esp
+  802e03:	50                   	push   %eax
+  802e04:	6a 00                	push   $0x0
+  802e06:	e8 ef df ff ff       	call   800dfa <sys_page_unmap>
+  802e0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e0e:	c9                   	leave
+  802e0f:	c3                   	ret
+
+00802e10 <_pipeisclosed>:
+  802e10:	55                   	push   %ebp
+  802e11:	89 e5                	mov    %esp,%ebp
+  802e13:	57                   	push   %edi
+  802e14:	56                   	push   %esi
+  802e15:	53                   	push   %ebx
+  802e16:	83 ec 1c             	sub    $0x1c,%esp
+  802e19:	89 c7                	mov    %eax,%edi
+  802e1b:	89 d6                	mov    %edx,%esi
+  802e1d:	a1 14 50 80 00       	mov    0x805014,%eax
+  802e22:	8b 58 58             	mov    0x58(%eax),%ebx
+  802e25:	83 ec 0c             	sub    $0xc,%esp
+  802e28:	57                   	push   %edi
+  802e29:	e8 4e 07 00 00       	call   80357c <pageref>
+  802e2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e31:	89 34 24             	mov    %esi,(%esp)
+  802e34:	e8 43 07 00 00       	call   80357c <pageref>
+  802e39:	8b 15 14 50 80 00    	mov    0x805014,%edx
+  802e3f:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802e42:	83 c4 10             	add    $0x10,%esp
+  802e45:	39 cb                	cmp    %ecx,%ebx
+  802e47:	74 1b                	je     802e64 <_pipeisclosed+0x54>
+  802e49:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e4c:	75 cf                	jne    802e1d <_pipeisclosed+0xd>
+  802e4e:	8b 42 58             	mov    0x58(%edx),%eax
+  802e51:	6a 01                	push   $0x1
+  802e53:	50                   	push   %eax
+  802e54:	53                   	push   %ebx
+  802e55:	68 d1 3d 80 00       	push   $0x803dd1
+  802e5a:	e8 72 d3 ff ff       	call   8001d1 <cprintf>
+  802e5f:	83 c4 10             	add    $0x10,%esp
+  802e62:	eb b9                	jmp    802e1d <_pipeisclosed+0xd>
+  802e64:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e67:	0f 94 c0             	sete   %al
+  802e6a:	0f b6 c0             	movzbl %al,%eax
+  802e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e70:	5b                   	pop    %ebx
+  802e71:	5e                   	pop    %esi
+  802e72:	5f                   	pop    %edi
+  802e73:	5d                   	pop    %ebp
+  802e74:	c3                   	ret
+
+00802e75 <devpipe_write>:
+  802e75:	55                   	push   %ebp
+  802e76:	89 e5                	mov    %esp,%ebp
+  802e78:	57                   	push   %edi
+  802e79:	56                   	push   %esi
+  802e7a:	53                   	push   %ebx
+  802e7b:	83 ec 28             	sub    $0x28,%esp
+  802e7e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e81:	56                   	push   %esi
+  802e82:	e8 bd ee ff ff       	call   801d44 <fd2data>
+  802e87:	89 c3                	mov    %eax,%ebx
+  802e89:	83 c4 10             	add    $0x10,%esp
+  802e8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e91:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e95:	74 5c                	je     802ef3 <devpipe_write+0x7e>
+  802e97:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e9a:	8b 0b                	mov    (%ebx),%ecx
+  802e9c:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e9f:	39 d0                	cmp    %edx,%eax
+  802ea1:	72 1e                	jb     802ec1 <devpipe_write+0x4c>
+  802ea3:	89 da                	mov    %ebx,%edx
+  802ea5:	89 f0                	mov    %esi,%eax
+  802ea7:	e8 64 ff ff ff       	call   802e10 <_pipeisclosed>
+  802eac:	85 c0                	test   %eax,%eax
+  802eae:	75 48                	jne    802ef8 <devpipe_write+0x83>
+  802eb0:	e8 28 de ff ff       	call   800cdd <sys_yield>
+  802eb5:	8b 43 04             	mov    0x4(%ebx),%eax
+  802eb8:	8b 0b                	mov    (%ebx),%ecx
+  802eba:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ebd:	39 d0                	cmp    %edx,%eax
+  802ebf:	73 e2                	jae    802ea3 <devpipe_write+0x2e>
+  802ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ec4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802ec8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ecb:	89 c2                	mov    %eax,%edx
+  802ecd:	c1 fa 1f             	sar    $0x1f,%edx
+  802ed0:	89 d1                	mov    %edx,%ecx
+  802ed2:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ed5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ed8:	83 e2 1f             	and    $0x1f,%edx
+  802edb:	29 ca                	sub    %ecx,%edx
+  802edd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ee1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802ee5:	83 c0 01             	add    $0x1,%eax
+  802ee8:	89 43 04             	mov    %eax,0x4(%ebx)
+  802eeb:	83 c7 01             	add    $0x1,%edi
+  802eee:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802ef1:	75 a4                	jne    802e97 <devpipe_write+0x22>
+  802ef3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ef6:	eb 05                	jmp    802efd <devpipe_write+0x88>
+  802ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f00:	5b                   	pop    %ebx
+  802f01:	5e                   	pop    %esi
+  802f02:	5f                   	pop    %edi
+  802f03:	5d                   	pop    %ebp
+  802f04:	c3                   	ret
+
+00802f05 <devpipe_read>:
+  802f05:	55                   	push   %ebp
+  802f06:	89 e5                	mov    %esp,%ebp
+  802f08:	57                   	push   %edi
+  802f09:	56                   	push   %esi
+  802f0a:	53                   	push   %ebx
+  802f0b:	83 ec 18             	sub    $0x18,%esp
+  802f0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f11:	56                   	push   %esi
+  802f12:	e8 2d ee ff ff       	call   801d44 <fd2data>
+  802f17:	89 c3                	mov    %eax,%ebx
+  802f19:	83 c4 10             	add    $0x10,%esp
+  802f1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f21:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f25:	74 45                	je     802f6c <devpipe_read+0x67>
+  802f27:	8b 03                	mov    (%ebx),%eax
+  802f29:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f2c:	75 1d                	jne    802f4b <devpipe_read+0x46>
+  802f2e:	85 ff                	test   %edi,%edi
+  802f30:	75 3f                	jne    802f71 <devpipe_read+0x6c>
+  802f32:	89 da                	mov    %ebx,%edx
+  802f34:	89 f0                	mov    %esi,%eax
+  802f36:	e8 d5 fe ff ff       	call   802e10 <_pipeisclosed>
+  802f3b:	85 c0                	test   %eax,%eax
+  802f3d:	75 3c                	jne    802f7b <devpipe_read+0x76>
+  802f3f:	e8 99 dd ff ff       	call   800cdd <sys_yield>
+  802f44:	8b 03                	mov    (%ebx),%eax
+  802f46:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f49:	74 e7                	je     802f32 <devpipe_read+0x2d>
+  802f4b:	99                   	cltd
+  802f4c:	c1 ea 1b             	shr    $0x1b,%edx
+  802f4f:	01 d0                	add    %edx,%eax
+  802f51:	83 e0 1f             	and    $0x1f,%eax
+  802f54:	29 d0                	sub    %edx,%eax
+  802f56:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f5e:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802f61:	83 03 01             	addl   $0x1,(%ebx)
+  802f64:	83 c7 01             	add    $0x1,%edi
+  802f67:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802f6a:	75 bb                	jne    802f27 <devpipe_read+0x22>
+  802f6c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f6f:	eb 02                	jmp    802f73 <devpipe_read+0x6e>
+  802f71:	89 f8                	mov    %edi,%eax
+  802f73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f76:	5b                   	pop    %ebx
+  802f77:	5e                   	pop    %esi
+  802f78:	5f                   	pop    %edi
+  802f79:	5d                   	pop    %ebp
+  802f7a:	c3                   	ret
+  802f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f80:	eb f1                	jmp    802f73 <devpipe_read+0x6e>
+
+00802f82 <pipe>:
+  802f82:	55                   	push   %ebp
+  802f83:	89 e5                	mov    %esp,%ebp
+  802f85:	56                   	push   %esi
+  802f86:	53                   	push   %ebx
+  802f87:	83 ec 1c             	sub    $0x1c,%esp
+  802f8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f8d:	50                   	push   %eax
+  802f8e:	e8 c8 ed ff ff       	call   801d5b <fd_alloc>
+  802f93:	89 c3                	mov    %eax,%ebx
+  802f95:	83 c4 10             	add    $0x10,%esp
+  802f98:	85 c0                	test   %eax,%eax
+  802f9a:	0f 88 23 01 00 00    	js     8030c3 <pipe+0x141>
+  802fa0:	83 ec 04             	sub    $0x4,%esp
+  802fa3:	68 07 04 00 00       	push   $0x407
+  802fa8:	ff 75 f4             	push   -0xc(%ebp)
+  802fab:	6a 00                	push   $0x0
+  802fad:	e8 76 dd ff ff       	call   800d28 <sys_page_alloc>
+  802fb2:	89 c3                	mov    %eax,%ebx
+  802fb4:	83 c4 10             	add    $0x10,%esp
+  802fb7:	85 c0                	test   %eax,%eax
+  802fb9:	0f 88 04 01 00 00    	js     8030c3 <pipe+0x141>
+  802fbf:	83 ec 0c             	sub    $0xc,%esp
+  802fc2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802fc5:	50                   	push   %eax
+  802fc6:	e8 90 ed ff ff       	call   801d5b <fd_alloc>
+  802fcb:	89 c3                	mov    %eax,%ebx
+  802fcd:	83 c4 10             	add    $0x10,%esp
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	0f 88 db 00 00 00    	js     8030b3 <pipe+0x131>
+  802fd8:	83 ec 04             	sub    $0x4,%esp
+  802fdb:	68 07 04 00 00       	push   $0x407
+  802fe0:	ff 75 f0             	push   -0x10(%ebp)
+  802fe3:	6a 00                	push   $0x0
+  802fe5:	e8 3e dd ff ff       	call   800d28 <sys_page_alloc>
+  802fea:	89 c3                	mov    %eax,%ebx
+  802fec:	83 c4 10             	add    $0x10,%esp
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	0f 88 bc 00 00 00    	js     8030b3 <pipe+0x131>
+  802ff7:	83 ec 0c             	sub    $0xc,%esp
+  802ffa:	ff 75 f4             	push   -0xc(%ebp)
+  802ffd:	e8 42 ed ff ff       	call   801d44 <fd2data>
+  803002:	89 c6                	mov    %eax,%esi
+  803004:	83 c4 0c             	add    $0xc,%esp
+  803007:	68 07 04 00 00       	push   $0x407
+  80300c:	50                   	push   %eax
+  80300d:	6a 00                	push   $0x0
+  80300f:	e8 14 dd ff ff       	call   800d28 <sys_page_alloc>
+  803014:	89 c3                	mov    %eax,%ebx
+  803016:	83 c4 10             	add    $0x10,%esp
+  803019:	85 c0                	test   %eax,%eax
+  80301b:	0f 88 82 00 00 00    	js     8030a3 <pipe+0x121>
+  803021:	83 ec 0c             	sub    $0xc,%esp
+  803024:	ff 75 f0             	push   -0x10(%ebp)
+  803027:	e8 18 ed ff ff       	call   801d44 <fd2data>
+  80302c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803033:	50                   	push   %eax
+  803034:	6a 00                	push   $0x0
+  803036:	56                   	push   %esi
+  803037:	6a 00                	push   $0x0
+  803039:	e8 2d dd ff ff       	call   800d6b <sys_page_map>
+  80303e:	89 c3                	mov    %eax,%ebx
+  803040:	83 c4 20             	add    $0x20,%esp
+  803043:	85 c0                	test   %eax,%eax
+  803045:	78 4e                	js     803095 <pipe+0x113>
+  803047:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80304c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80304f:	89 02                	mov    %eax,(%edx)
+  803051:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803054:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80305b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80305e:	89 02                	mov    %eax,(%edx)
+  803060:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803063:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80306a:	83 ec 0c             	sub    $0xc,%esp
+  80306d:	ff 75 f4             	push   -0xc(%ebp)
+  803070:	e8 bf ec ff ff       	call   801d34 <fd2num>
+  803075:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803078:	89 01                	mov    %eax,(%ecx)
+  80307a:	83 c4 04             	add    $0x4,%esp
+  80307d:	ff 75 f0             	push   -0x10(%ebp)
+  803080:	e8 af ec ff ff       	call   801d34 <fd2num>
+  803085:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803088:	89 41 04             	mov    %eax,0x4(%ecx)
+  80308b:	83 c4 10             	add    $0x10,%esp
+  80308e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803093:	eb 2e                	jmp    8030c3 <pipe+0x141>
+  803095:	83 ec 08             	sub    $0x8,%esp
+  803098:	56                   	push   %esi
+  803099:	6a 00                	push   $0x0
+  80309b:	e8 5a dd ff ff       	call   800dfa <sys_page_unmap>
+  8030a0:	83 c4 10             	add    $0x10,%esp
+  8030a3:	83 ec 08             	sub    $0x8,%esp
+  8030a6:	ff 75 f0             	push   -0x10(%ebp)
+  8030a9:	6a 00                	push   $0x0
+  8030ab:	e8 4a dd ff ff       	call   800dfa <sys_page_unmap>
+  8030b0:	83 c4 10             	add    $0x10,%esp
+  8030b3:	83 ec 08             	sub    $0x8,%esp
+  8030b6:	ff 75 f4             	push   -0xc(%ebp)
+  8030b9:	6a 00                	push   $0x0
+  8030bb:	e8 3a dd ff ff       	call   800dfa <sys_page_unmap>
+  8030c0:	83 c4 10             	add    $0x10,%esp
+  8030c3:	89 d8                	mov    %ebx,%eax
+  8030c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030c8:	5b                   	pop    %ebx
+  8030c9:	5e                   	pop    %esi
+  8030ca:	5d                   	pop    %ebp
+  8030cb:	c3                   	ret
+
+008030cc <pipeisclosed>:
+  8030cc:	55                   	push   %ebp
+  8030cd:	89 e5                	mov    %esp,%ebp
+  8030cf:	83 ec 20             	sub    $0x20,%esp
+  8030d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030d5:	50                   	push   %eax
+  8030d6:	ff 75 08             	push   0x8(%ebp)
+  8030d9:	e8 cd ec ff ff       	call   801dab <fd_lookup>
+  8030de:	83 c4 10             	add    $0x10,%esp
+  8030e1:	85 c0                	test   %eax,%eax
+  8030e3:	78 18                	js     8030fd <pipeisclosed+0x31>
+  8030e5:	83 ec 0c             	sub    $0xc,%esp
+  8030e8:	ff 75 f4             	push   -0xc(%ebp)
+  8030eb:	e8 54 ec ff ff       	call   801d44 <fd2data>
+  8030f0:	89 c2                	mov    %eax,%edx
+  8030f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030f5:	e8 16 fd ff ff       	call   802e10 <_pipeisclosed>
+  8030fa:	83 c4 10             	add    $0x10,%esp
+  8030fd:	c9                   	leave
+  8030fe:	c3                   	ret
+
+008030ff <ipcring_init>:
+  8030ff:	55                   	push   %ebp
+  803100:	89 e5                	mov    %esp,%ebp
+  803102:	53                   	push   %ebx
+  803103:	83 ec 08             	sub    $0x8,%esp
+  803106:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803109:	6a 60                	push   $0x60
+  80310b:	6a 00                	push   $0x0
+  80310d:	53                   	push   %ebx
+  80310e:	e8 30 d9 ff ff       	call   800a43 <memset>
+  803113:	a1 14 50 80 00       	mov    0x805014,%eax
+  803118:	8b 40 48             	mov    0x48(%eax),%eax
+  80311b:	89 03                	mov    %eax,(%ebx)
+  80311d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803120:	89 43 04             	mov    %eax,0x4(%ebx)
+  803123:	8b 45 10             	mov    0x10(%ebp),%eax
+  803126:	89 43 08             	mov    %eax,0x8(%ebx)
+  803129:	8b 45 14             	mov    0x14(%ebp),%eax
+  80312c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80312f:	83 c4 10             	add    $0x10,%esp
+  803132:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803135:	c9                   	leave
+  803136:	c3                   	ret
+
+00803137 <ipcring_req_slot>:
+  803137:	55                   	push   %ebp
+  803138:	89 e5                	mov    %esp,%ebp
+  80313a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80313d:	8b 50 10             	mov    0x10(%eax),%edx
+  803140:	8b 48 18             	mov    0x18(%eax),%ecx
+  803143:	29 ca                	sub    %ecx,%edx
+  803145:	83 fa 07             	cmp    $0x7,%edx
+  803148:	77 0c                	ja     803156 <ipcring_req_slot+0x1f>
+  80314a:	8b 50 10             	mov    0x10(%eax),%edx
+  80314d:	83 e2 07             	and    $0x7,%edx
+  803150:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803154:	5d                   	pop    %ebp
+  803155:	c3                   	ret
+  803156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315b:	eb f7                	jmp    803154 <ipcring_req_slot+0x1d>
+
+0080315d <ipcring_req_push>:
+  80315d:	55                   	push   %ebp
+  80315e:	89 e5                	mov    %esp,%ebp
+  803160:	83 ec 08             	sub    $0x8,%esp
+  803163:	8b 55 08             	mov    0x8(%ebp),%edx
+  803166:	8b 42 10             	mov    0x10(%edx),%eax
+  803169:	83 c0 01             	add    $0x1,%eax
+  80316c:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803170:	b8 00 00 00 00       	mov    $0x0,%eax
+  803175:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803179:	85 c0                	test   %eax,%eax
+  80317b:	75 02                	jne    80317f <ipcring_req_push+0x22>
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+  80317f:	6a 00                	push   $0x0
+  803181:	68 00 00 80 ee       	push   $0xee800000
+  803186:	ff 72 08             	push   0x8(%edx)
+  803189:	ff 72 04             	push   0x4(%edx)
+  80318c:	e8 cf de ff ff       	call   801060 <sys_ipc_send>
+  803191:	83 c4 10             	add    $0x10,%esp
+  803194:	eb e7                	jmp    80317d <ipcring_req_push+0x20>
+
+00803196 <ipcring_rsp_wait>:
+  803196:	55                   	push   %ebp
+  803197:	89 e5                	mov    %esp,%ebp
+  803199:	53                   	push   %ebx
+  80319a:	83 ec 04             	sub    $0x4,%esp
+  80319d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8031a0:	8b 53 18             	mov    0x18(%ebx),%edx
+  8031a3:	8b 43 10             	mov    0x10(%ebx),%eax
+  8031a6:	39 c2                	cmp    %eax,%edx
+  8031a8:	74 3c                	je     8031e6 <ipcring_rsp_wait+0x50>
+  8031aa:	8b 53 14             	mov    0x14(%ebx),%edx
+  8031ad:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031b0:	39 c2                	cmp    %eax,%edx
+  8031b2:	75 23                	jne    8031d7 <ipcring_rsp_wait+0x41>
+  8031b4:	83 ec 08             	sub    $0x8,%esp
+  8031b7:	6a 00                	push   $0x0
+  8031b9:	6a 00                	push   $0x0
+  8031bb:	6a 00                	push   $0x0
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	ff 73 0c             	push   0xc(%ebx)
+  8031c2:	ff 73 04             	push   0x4(%ebx)
+  8031c5:	e8 b5 e9 ff ff       	call   801b7f <ipc_call>
+  8031ca:	8b 53 14             	mov    0x14(%ebx),%edx
+  8031cd:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031d0:	83 c4 20             	add    $0x20,%esp
+  8031d3:	39 c2                	cmp    %eax,%edx
+  8031d5:	74 dd                	je     8031b4 <ipcring_rsp_wait+0x1e>
+  8031d7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031da:	83 e0 07             	and    $0x7,%eax
+  8031dd:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8031e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031e4:	c9                   	leave
+  8031e5:	c3                   	ret
+  8031e6:	68 ec 3d 80 00       	push   $0x803dec
+  8031eb:	68 9d 3d 80 00       	push   $0x803d9d
+  8031f0:	6a 3b                	push   $0x3b
+  8031f2:	68 0d 3e 80 00       	push   $0x803e0d
+  8031f7:	e8 97 02 00 00       	call   803493 <_panic>
+
+008031fc <ipcring_rsp_pop>:
+  8031fc:	55                   	push   %ebp
+  8031fd:	89 e5                	mov    %esp,%ebp
+  8031ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  803202:	8b 42 18             	mov    0x18(%edx),%eax
+  803205:	83 c0 01             	add    $0x1,%eax
+  803208:	89 42 18             	mov    %eax,0x18(%edx)
+  80320b:	5d                   	pop    %ebp
+  80320c:	c3                   	ret
+
+0080320d <ipcring_server_init>:
+  80320d:	55                   	push   %ebp
+  80320e:	89 e5                	mov    %esp,%ebp
+  803210:	8b 45 08             	mov    0x8(%ebp),%eax
+  803213:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803216:	89 10                	mov    %edx,(%eax)
+  803218:	8b 55 10             	mov    0x10(%ebp),%edx
+  80321b:	89 50 04             	mov    %edx,0x4(%eax)
+  80321e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803225:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80322c:	5d                   	pop    %ebp
+  80322d:	c3                   	ret
+
+0080322e <ipcring_req_avail>:
+  80322e:	55                   	push   %ebp
+  80322f:	89 e5                	mov    %esp,%ebp
+  803231:	8b 55 08             	mov    0x8(%ebp),%edx
+  803234:	8b 02                	mov    (%edx),%eax
+  803236:	8b 40 10             	mov    0x10(%eax),%eax
+  803239:	2b 42 08             	sub    0x8(%edx),%eax
+  80323c:	ba 08 00 00 00       	mov    $0x8,%edx
+  803241:	39 d0                	cmp    %edx,%eax
+  803243:	0f 47 c2             	cmova  %edx,%eax
+  803246:	5d                   	pop    %ebp
+  803247:	c3                   	ret
+
+00803248 <ipcring_req_peek>:
+  803248:	55                   	push   %ebp
+  803249:	89 e5                	mov    %esp,%ebp
+  80324b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80324e:	8b 42 08             	mov    0x8(%edx),%eax
+  803251:	83 e0 07             	and    $0x7,%eax
+  803254:	8b 12                	mov    (%edx),%edx
+  803256:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80325a:	5d                   	pop    %ebp
+  80325b:	c3                   	ret
+
+0080325c <ipcring_rsp_push>:
+  80325c:	55                   	push   %ebp
+  80325d:	89 e5                	mov    %esp,%ebp
+  80325f:	83 ec 08             	sub    $0x8,%esp
+  803262:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803265:	8b 41 08             	mov    0x8(%ecx),%eax
+  803268:	83 c0 01             	add    $0x1,%eax
+  80326b:	89 41 08             	mov    %eax,0x8(%ecx)
+  80326e:	8b 11                	mov    (%ecx),%edx
+  803270:	83 c2 14             	add    $0x14,%edx
+  803273:	f0 87 02             	lock xchg %eax,(%edx)
+  803276:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80327a:	75 02                	jne    80327e <ipcring_rsp_push+0x22>
+  80327c:	c9                   	leave
+  80327d:	c3                   	ret
+  80327e:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803285:	6a 00                	push   $0x0
+  803287:	68 00 00 80 ee       	push   $0xee800000
+  80328c:	6a 00                	push   $0x0
+  80328e:	ff 71 04             	push   0x4(%ecx)
+  803291:	e8 ed dc ff ff       	call   800f83 <sys_ipc_try_send>
+  803296:	83 c4 10             	add    $0x10,%esp
+  803299:	eb e1                	jmp    80327c <ipcring_rsp_push+0x20>
+
+0080329b <ipcring_client_wait>:
+  80329b:	55                   	push   %ebp
+  80329c:	89 e5                	mov    %esp,%ebp
+  80329e:	83 ec 08             	sub    $0x8,%esp
+  8032a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a4:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8032ab:	8b 10                	mov    (%eax),%edx
+  8032ad:	8b 52 18             	mov    0x18(%edx),%edx
+  8032b0:	3b 50 08             	cmp    0x8(%eax),%edx
+  8032b3:	75 02                	jne    8032b7 <ipcring_client_wait+0x1c>
+  8032b5:	c9                   	leave
+  8032b6:	c3                   	ret
+  8032b7:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8032be:	6a 00                	push   $0x0
+  8032c0:	68 00 00 80 ee       	push   $0xee800000
+  8032c5:	6a 00                	push   $0x0
+  8032c7:	ff 70 04             	push   0x4(%eax)
+  8032ca:	e8 b4 dc ff ff       	call   800f83 <sys_ipc_try_send>
+  8032cf:	83 c4 10             	add    $0x10,%esp
+  8032d2:	eb e1                	jmp    8032b5 <ipcring_client_wait+0x1a>
+
+008032d4 <ipcring_server_sleep>:
+  8032d4:	55                   	push   %ebp
+  8032d5:	89 e5                	mov    %esp,%ebp
+  8032d7:	53                   	push   %ebx
+  8032d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032db:	8b 01                	mov    (%ecx),%eax
+  8032dd:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8032e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032e5:	f0 87 02             	lock xchg %eax,(%edx)
+  8032e8:	8b 11                	mov    (%ecx),%edx
+  8032ea:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8032ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032f2:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8032f5:	74 0e                	je     803305 <ipcring_server_sleep+0x31>
+  8032f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fc:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803300:	b8 00 00 00 00       	mov    $0x0,%eax
+  803305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803308:	c9                   	leave
+  803309:	c3                   	ret
+
+0080330a <devcons_close>:
+  80330a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330f:	c3                   	ret
+
+00803310 <devcons_stat>:
+  803310:	55                   	push   %ebp
+  803311:	89 e5                	mov    %esp,%ebp
+  803313:	83 ec 10             	sub    $0x10,%esp
+  803316:	68 1b 3e 80 00       	push   $0x803e1b
+  80331b:	ff 75 0c             	push   0xc(%ebp)
+  80331e:	e8 a5 d5 ff ff       	call   8008c8 <strcpy>
+  803323:	b8 00 00 00 00       	mov    $0x0,%eax
+  803328:	c9                   	leave
+  803329:	c3                   	ret
+
+0080332a <devcons_write>:
+  80332a:	55                   	push   %ebp
+  80332b:	89 e5                	mov    %esp,%ebp
+  80332d:	57                   	push   %edi
+  80332e:	56                   	push   %esi
+  80332f:	53                   	push   %ebx
+  803330:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803336:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803339:	85 ff                	test   %edi,%edi
+  80333b:	74 51                	je     80338e <devcons_write+0x64>
+  80333d:	be 00 00 00 00       	mov    $0x0,%esi
+  803342:	b8 00 00 00 00       	mov    $0x0,%eax
+  803347:	89 fb                	mov    %edi,%ebx
+  803349:	29 c3                	sub    %eax,%ebx
+  80334b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803350:	39 d3                	cmp    %edx,%ebx
+  803352:	0f 47 da             	cmova  %edx,%ebx
+  803355:	83 ec 04             	sub    $0x4,%esp
+  803358:	53                   	push   %ebx
+  803359:	03 45 0c             	add    0xc(%ebp),%eax
+  80335c:	50                   	push   %eax
+  80335d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803363:	50                   	push   %eax
+  803364:	e8 0f d7 ff ff       	call   800a78 <memmove>
+  803369:	83 c4 08             	add    $0x8,%esp
+  80336c:	53                   	push   %ebx
+  80336d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803373:	50                   	push   %eax
+  803374:	e8 c7 d8 ff ff       	call   800c40 <sys_cputs>
+  803379:	01 de                	add    %ebx,%esi
+  80337b:	89 f0                	mov    %esi,%eax
+  80337d:	83 c4 10             	add    $0x10,%esp
+  803380:	39 fe                	cmp    %edi,%esi
+  803382:	72 c3                	jb     803347 <devcons_write+0x1d>
+  803384:	89 f0                	mov    %esi,%eax
+  803386:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803389:	5b                   	pop    %ebx
+  80338a:	5e                   	pop    %esi
+  80338b:	5f                   	pop    %edi
+  80338c:	5d                   	pop    %ebp
+  80338d:	c3                   	ret
+  80338e:	be 00 00 00 00       	mov    $0x0,%esi
+  803393:	eb ef                	jmp    803384 <devcons_write+0x5a>
+
+00803395 <devcons_read>:
+  803395:	55                   	push   %ebp
+  803396:	89 e5                	mov    %esp,%ebp
+  803398:	83 ec 08             	sub    $0x8,%esp
+  80339b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033a4:	75 07                	jne    8033ad <devcons_read+0x18>
+  8033a6:	eb 1f                	jmp    8033c7 <devcons_read+0x32>
+  8033a8:	e8 30 d9 ff ff       	call   800cdd <sys_yield>
+  8033ad:	e8 ac d8 ff ff       	call   800c5e <sys_cgetc>
+  8033b2:	85 c0                	test   %eax,%eax
+  8033b4:	74 f2                	je     8033a8 <devcons_read+0x13>
+  8033b6:	78 0f                	js     8033c7 <devcons_read+0x32>
+  8033b8:	83 f8 04             	cmp    $0x4,%eax
+  8033bb:	74 0c                	je     8033c9 <devcons_read+0x34>
+  8033bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033c0:	88 02                	mov    %al,(%edx)
+  8033c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033c7:	c9                   	leave
+  8033c8:	c3                   	ret
+  8033c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ce:	eb f7                	jmp    8033c7 <devcons_read+0x32>
+
+008033d0 <cputchar>:
+  8033d0:	55                   	push   %ebp
+  8033d1:	89 e5                	mov    %esp,%ebp
+  8033d3:	83 ec 20             	sub    $0x20,%esp
+  8033d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8033dc:	6a 01                	push   $0x1
+  8033de:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033e1:	50                   	push   %eax
+  8033e2:	e8 59 d8 ff ff       	call   800c40 <sys_cputs>
+  8033e7:	83 c4 10             	add    $0x10,%esp
+  8033ea:	c9                   	leave
+  8033eb:	c3                   	ret
+
+008033ec <getchar>:
+  8033ec:	55                   	push   %ebp
+  8033ed:	89 e5                	mov    %esp,%ebp
+  8033ef:	83 ec 1c             	sub    $0x1c,%esp
+  8033f2:	6a 01                	push   $0x1
+  8033f4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033f7:	50                   	push   %eax
+  8033f8:	6a 00                	push   $0x0
+  8033fa:	e8 0e ec ff ff       	call   80200d <read>
+  8033ff:	83 c4 10             	add    $0x10,%esp
+  803402:	85 c0                	test   %eax,%eax
+  803404:	78 06                	js     80340c <getchar+0x20>
+  803406:	74 06                	je     80340e <getchar+0x22>
+  803408:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  80340c:	c9                   	leave
+  80340d:	c3                   	ret
+  80340e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803413:	eb f7                	jmp    80340c <getchar+0x20>
+
+00803415 <iscons>:
+  803415:	55                   	push   %ebp
+  803416:	89 e5                	mov    %esp,%ebp
+  803418:	83 ec 20             	sub    $0x20,%esp
+  80341b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80341e:	50                   	push   %eax
+  80341f:	ff 75 08             	push   0x8(%ebp)
+  803422:	e8 84 e9 ff ff       	call   801dab <fd_lookup>
+  803427:	83 c4 10             	add    $0x10,%esp
+  80342a:	85 c0                	test   %eax,%eax
+  80342c:	78 11                	js     80343f <iscons+0x2a>
+  80342e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803431:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803437:	39 10                	cmp    %edx,(%eax)
+  803439:	0f 94 c0             	sete   %al
+  80343c:	0f b6 c0             	movzbl %al,%eax
+  80343f:	c9                   	leave
+  803440:	c3                   	ret
+
+00803441 <opencons>:
+  803441:	55                   	push   %ebp
+  803442:	89 e5                	mov    %esp,%ebp
+  803444:	83 ec 24             	sub    $0x24,%esp
+  803447:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80344a:	50                   	push   %eax
+  80344b:	e8 0b e9 ff ff       	call   801d5b <fd_alloc>
+  803450:	83 c4 10             	add    $0x10,%esp
+  803453:	85 c0                	test   %eax,%eax
+  803455:	78 3a                	js     803491 <opencons+0x50>
+  803457:	83 ec 04             	sub    $0x4,%esp
+  80345a:	68 07 04 00 00       	push   $0x407
+  80345f:	ff 75 f4             	push   -0xc(%ebp)
+  803462:	6a 00                	push   $0x0
+  803464:	e8 bf d8 ff ff       	call   800d28 <sys_page_alloc>
+  803469:	83 c4 10             	add    $0x10,%esp
+  80346c:	85 c0                	test   %eax,%eax
+  80346e:	78 21                	js     803491 <opencons+0x50>
+  803470:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803473:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803479:	89 10                	mov    %edx,(%eax)
+  80347b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803485:	83 ec 0c             	sub    $0xc,%esp
+  803488:	50                   	push   %eax
+  803489:	e8 a6 e8 ff ff       	call   801d34 <fd2num>
+  80348e:	83 c4 10             	add    $0x10,%esp
+  803491:	c9                   	leave
+  803492:	c3                   	ret
+
+00803493 <_panic>:
+  803493:	55                   	push   %ebp
+  803494:	89 e5                	mov    %esp,%ebp
+  803496:	56                   	push   %esi
+  803497:	53                   	push   %ebx
+  803498:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80349b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8034a1:	e8 18 d8 ff ff       	call   800cbe <sys_getenvid>
+  8034a6:	83 ec 0c             	sub    $0xc,%esp
+  8034a9:	ff 75 0c             	push   0xc(%ebp)
+  8034ac:	ff 75 08             	push   0x8(%ebp)
+  8034af:	56                   	push   %esi
+  8034b0:	50                   	push   %eax
+  8034b1:	68 28 3e 80 00       	push   $0x803e28
+  8034b6:	e8 16 cd ff ff       	call   8001d1 <cprintf>
+  8034bb:	83 c4 18             	add    $0x18,%esp
+  8034be:	53                   	push   %ebx
+  8034bf:	ff 75 10             	push   0x10(%ebp)
+  8034c2:	e8 b9 cc ff ff       	call   800180 <vcprintf>
+  8034c7:	c7 04 24 4b 38 80 00 	movl   $0x80384b,(%esp)
+  8034ce:	e8 fe cc ff ff       	call   8001d1 <cprintf>
+  8034d3:	83 c4 10             	add    $0x10,%esp
+  8034d6:	cc                   	int3
+  8034d7:	eb fd                	jmp    8034d6 <_panic+0x43>
+
+008034d9 <set_pgfault_handler>:
+  8034d9:	55                   	push   %ebp
+  8034da:	89 e5                	mov    %esp,%ebp
+  8034dc:	53                   	push   %ebx
+  8034dd:	83 ec 04             	sub    $0x4,%esp
+  8034e0:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8034e7:	74 0d                	je     8034f6 <set_pgfault_handler+0x1d>
+  8034e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ec:	a3 00 80 80 00       	mov    %eax,0x808000
+  8034f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034f4:	c9                   	leave
+  8034f5:	c3                   	ret
+  8034f6:	e8 c3 d7 ff ff       	call   800cbe <sys_getenvid>
+  8034fb:	89 c3                	mov    %eax,%ebx
+  8034fd:	83 ec 04             	sub    $0x4,%esp
+  803500:	6a 07                	push   $0x7
+  803502:	68 00 f0 7f ee       	push   $0xee7ff000
+  803507:	50                   	push   %eax
+  803508:	e8 1b d8 ff ff       	call   800d28 <sys_page_alloc>
+  80350d:	83 c4 10             	add    $0x10,%esp
+  803510:	85 c0                	test   %eax,%eax
+  803512:	78 29                	js     80353d <set_pgfault_handler+0x64>
+  803514:	83 ec 08             	sub    $0x8,%esp
+  803517:	68 51 35 80 00       	push   $0x803551
+  80351c:	53                   	push   %ebx
+  80351d:	e8 1f da ff ff       	call   800f41 <sys_env_set_pgfault_upcall>
+  803522:	83 c4 10             	add    $0x10,%esp
+  803525:	85 c0                	test   %eax,%eax
+  803527:	79 c0                	jns    8034e9 <set_pgfault_handler+0x10>
+  803529:	83 ec 04             	sub    $0x4,%esp
+  80352c:	68 84 3e 80 00       	push   $0x803e84
+  803531:	6a 27                	push   $0x27
+  803533:	68 b6 3e 80 00       	push   $0x803eb6
+  803538:	e8 56 ff ff ff       	call   803493 <_panic>
+  80353d:	83 ec 04             	sub    $0x4,%esp
+  803540:	68 4c 3e 80 00       	push   $0x803e4c
+  803545:	6a 23                	push   $0x23
+  803547:	68 b6 3e 80 00       	push   $0x803eb6
+  80354c:	e8 42 ff ff ff       	call   803493 <_panic>
+
+00803551 <_pgfault_upcall>:
+  803551:	54                   	push   %esp
+  803552:	a1 00 80 80 00       	mov    0x808000,%eax
+  803557:	ff d0                	call   *%eax
+  803559:	83 c4 04             	add    $0x4,%esp
+  80355c:	89 e3                	mov    %esp,%ebx
+  80355e:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803562:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803566:	89 d4                	mov    %edx,%esp
+  803568:	51                   	push   %ecx
+  803569:	89 dc                	mov    %ebx,%esp
+  80356b:	83 ea 04             	sub    $0x4,%edx
+  80356e:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803572:	83 c4 08             	add    $0x8,%esp
+  803575:	61                   	popa
+  803576:	83 c4 04             	add    $0x4,%esp
+  803579:	9d                   	popf
+  80357a:	5c                   	pop    %esp
+  80357b:	c3                   	ret
+
+0080357c <pageref>:
+  80357c:	55                   	push   %ebp
+  80357d:	89 e5                	mov    %esp,%ebp
+  80357f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803582:	89 c2                	mov    %eax,%edx
+  803584:	c1 ea 16             	shr    $0x16,%edx
+  803587:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80358e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803593:	f6 c1 01             	test   $0x1,%cl
+  803596:	74 22                	je     8035ba <pageref+0x3e>
+  803598:	c1 e8 0c             	shr    $0xc,%eax
+  80359b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035a2:	a8 01                	test   $0x1,%al
+  8035a4:	74 14                	je     8035ba <pageref+0x3e>
+  8035a6:	c1 e8 0c             	shr    $0xc,%eax
+  8035a9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035ac:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035b3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035b7:	0f b7 d2             	movzwl %dx,%edx
+  8035ba:	89 d0                	mov    %edx,%eax
+  8035bc:	5d                   	pop    %ebp
+  8035bd:	c3                   	ret
+
+008035be <__udivmoddi4>:
+  8035be:	55                   	push   %ebp
+  8035bf:	57                   	push   %edi
+  8035c0:	56                   	push   %esi
+  8035c1:	53                   	push   %ebx
+  8035c2:	83 ec 24             	sub    $0x24,%esp
+  8035c5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035c9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035cd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035d1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035d5:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8035d9:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8035dd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035e1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035e5:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8035e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035f8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035ff:	00 
+  803600:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803607:	00 
+  803608:	89 fb                	mov    %edi,%ebx
+  80360a:	eb 08                	jmp    803614 <__udivmoddi4+0x56>
+  80360c:	83 e9 01             	sub    $0x1,%ecx
+  80360f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803612:	74 68                	je     80367c <__udivmoddi4+0xbe>
+  803614:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803618:	01 c0                	add    %eax,%eax
+  80361a:	89 c6                	mov    %eax,%esi
+  80361c:	89 d7                	mov    %edx,%edi
+  80361e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803622:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803626:	0f ad d0             	shrd   %cl,%edx,%eax
+  803629:	d3 ea                	shr    %cl,%edx
+  80362b:	f6 c1 20             	test   $0x20,%cl
+  80362e:	74 04                	je     803634 <__udivmoddi4+0x76>
+  803630:	89 d0                	mov    %edx,%eax
+  803632:	31 d2                	xor    %edx,%edx
+  803634:	83 e0 01             	and    $0x1,%eax
+  803637:	89 04 24             	mov    %eax,(%esp)
+  80363a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803641:	00 
+  803642:	8b 04 24             	mov    (%esp),%eax
+  803645:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803649:	09 f0                	or     %esi,%eax
+  80364b:	09 fa                	or     %edi,%edx
+  80364d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803651:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803655:	39 f0                	cmp    %esi,%eax
+  803657:	89 d5                	mov    %edx,%ebp
+  803659:	19 fd                	sbb    %edi,%ebp
+  80365b:	72 af                	jb     80360c <__udivmoddi4+0x4e>
+  80365d:	29 f0                	sub    %esi,%eax
+  80365f:	19 fa                	sbb    %edi,%edx
+  803661:	89 cf                	mov    %ecx,%edi
+  803663:	c1 ef 05             	shr    $0x5,%edi
+  803666:	83 e7 01             	and    $0x1,%edi
+  803669:	89 fe                	mov    %edi,%esi
+  80366b:	83 f6 01             	xor    $0x1,%esi
+  80366e:	d3 e6                	shl    %cl,%esi
+  803670:	d3 e7                	shl    %cl,%edi
+  803672:	09 74 24 18          	or     %esi,0x18(%esp)
+  803676:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80367a:	eb 90                	jmp    80360c <__udivmoddi4+0x4e>
+  80367c:	85 db                	test   %ebx,%ebx
+  80367e:	74 05                	je     803685 <__udivmoddi4+0xc7>
+  803680:	89 03                	mov    %eax,(%ebx)
+  803682:	89 53 04             	mov    %edx,0x4(%ebx)
+  803685:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803689:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80368d:	83 c4 24             	add    $0x24,%esp
+  803690:	5b                   	pop    %ebx
+  803691:	5e                   	pop    %esi
+  803692:	5f                   	pop    %edi
+  803693:	5d                   	pop    %ebp
+  803694:	c3                   	ret
+
+00803695 <__udivdi3>:
+  803695:	83 ec 08             	sub    $0x8,%esp
+  803698:	6a 00                	push   $0x0
+  80369a:	ff 74 24 1c          	push   0x1c(%esp)
+  80369e:	ff 74 24 1c          	push   0x1c(%esp)
+  8036a2:	ff 74 24 1c          	push   0x1c(%esp)
+  8036a6:	ff 74 24 1c          	push   0x1c(%esp)
+  8036aa:	e8 0f ff ff ff       	call   8035be <__udivmoddi4>
+  8036af:	83 c4 1c             	add    $0x1c,%esp
+  8036b2:	c3                   	ret
+
+008036b3 <__umoddi3>:
+  8036b3:	83 ec 18             	sub    $0x18,%esp
+  8036b6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036ba:	50                   	push   %eax
+  8036bb:	ff 74 24 2c          	push   0x2c(%esp)
+  8036bf:	ff 74 24 2c          	push   0x2c(%esp)
+  8036c3:	ff 74 24 2c          	push   0x2c(%esp)
+  8036c7:	ff 74 24 2c          	push   0x2c(%esp)
+  8036cb:	e8 ee fe ff ff       	call   8035be <__udivmoddi4>
+  8036d0:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8036d4:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8036d8:	83 c4 2c             	add    $0x2c,%esp
+  8036db:	c3                   	ret
+
+008036dc <__divdi3>:
+  8036dc:	53                   	push   %ebx
+  8036dd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036e1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036e5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036e9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036ed:	85 d2                	test   %edx,%edx
+  8036ef:	78 12                	js     803703 <__divdi3+0x27>
+  8036f1:	85 db                	test   %ebx,%ebx
+  8036f3:	78 2e                	js     803723 <__divdi3+0x47>
+  8036f5:	53                   	push   %ebx
+  8036f6:	51                   	push   %ecx
+  8036f7:	52                   	push   %edx
+  8036f8:	50                   	push   %eax
+  8036f9:	e8 97 ff ff ff       	call   803695 <__udivdi3>
+  8036fe:	83 c4 10             	add    $0x10,%esp
+  803701:	eb 1e                	jmp    803721 <__divdi3+0x45>
+  803703:	f7 d8                	neg    %eax
+  803705:	83 d2 00             	adc    $0x0,%edx
+  803708:	f7 da                	neg    %edx
+  80370a:	85 db                	test   %ebx,%ebx
+  80370c:	78 2a                	js     803738 <__divdi3+0x5c>
+  80370e:	53                   	push   %ebx
+  80370f:	51                   	push   %ecx
+  803710:	52                   	push   %edx
+  803711:	50                   	push   %eax
+  803712:	e8 7e ff ff ff       	call   803695 <__udivdi3>
+  803717:	83 c4 10             	add    $0x10,%esp
+  80371a:	f7 d8                	neg    %eax
+  80371c:	83 d2 00             	adc    $0x0,%edx
+  80371f:	f7 da                	neg    %edx
+  803721:	5b                   	pop    %ebx
+  803722:	c3                   	ret
+  803723:	f7 d9                	neg    %ecx
+  803725:	83 d3 00             	adc    $0x0,%ebx
+  803728:	f7 db                	neg    %ebx
+  80372a:	53                   	push   %ebx
+  80372b:	51                   	push   %ecx
+  80372c:	52                   	push   %edx
+  80372d:	50                   	push   %eax
+  80372e:	e8 62 ff ff ff       	call   803695 <__udivdi3>
+  803733:	83 c4 10             	add    $0x10,%esp
+  803736:	eb e2                	jmp    80371a <__divdi3+0x3e>
+  803738:	f7 d9                	neg    %ecx
+  80373a:	83 d3 00             	adc    $0x0,%ebx
+  80373d:	f7 db                	neg    %ebx
+  80373f:	53                   	push   %ebx
+  803740:	51                   	push   %ecx
+  803741:	52                   	push   %edx
+  803742:	50                   	push   %eax
+  803743:	e8 4d ff ff ff       	call   803695 <__udivdi3>
+  803748:	83 c4 10             	add    $0x10,%esp
+  80374b:	eb d4                	jmp    803721 <__divdi3+0x45>
+
+0080374d <__moddi3>:
+  80374d:	55                   	push   %ebp
+  80374e:	57                   	push   %edi
+  80374f:	56                   	push   %esi
+  803750:	53                   	push   %ebx
+  803751:	83 ec 0c             	sub    $0xc,%esp
+  803754:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803758:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80375c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803760:	89 e9                	mov    %ebp,%ecx
+  803762:	f7 d9                	neg    %ecx
+  803764:	89 d0                	mov    %edx,%eax
+  803766:	83 d0 00             	adc    $0x0,%eax
+  803769:	f7 d8                	neg    %eax
+  80376b:	0f 49 e9             	cmovns %ecx,%ebp
+  80376e:	0f 49 d0             	cmovns %eax,%edx
+  803771:	52                   	push   %edx
+  803772:	55                   	push   %ebp
+  803773:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803777:	f7 da                	neg    %edx
+  803779:	89 d8                	mov    %ebx,%eax
+  80377b:	83 d0 00             	adc    $0x0,%eax
+  80377e:	f7 d8                	neg    %eax
+  803780:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803785:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803789:	0f 48 c3             	cmovs  %ebx,%eax
+  80378c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803790:	ff 74 24 0c          	push   0xc(%esp)
+  803794:	ff 74 24 0c          	push   0xc(%esp)
+  803798:	e8 16 ff ff ff       	call   8036b3 <__umoddi3>
+  80379d:	83 c4 10             	add    $0x10,%esp
+  8037a0:	85 db                	test   %ebx,%ebx
+  8037a2:	78 08                	js     8037ac <__moddi3+0x5f>
+  8037a4:	83 c4 0c             	add    $0xc,%esp
+  8037a7:	5b                   	pop    %ebx
+  8037a8:	5e                   	pop    %esi
+  8037a9:	5f                   	pop    %edi
+  8037aa:	5d                   	pop    %ebp
+  8037ab:	c3                   	ret
+  8037ac:	f7 d8                	neg    %eax
+  8037ae:	83 d2 00             	adc    $0x0,%edx
+  8037b1:	f7 da                	neg    %edx
+  8037b3:	eb ef                	jmp    8037a4 <__moddi3+0x57>
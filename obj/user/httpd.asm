@@ -0,0 +1,6037 @@
+
+obj/user/httpd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 d0 05 00 00       	call   800601 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 08             	sub    $0x8,%esp
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+  80003f:	6a 07                	push   $0x7
+  800041:	89 d8                	mov    %ebx,%eax
+  800043:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800048:	50                   	push   %eax
+  800049:	6a 00                	push   $0x0
+  80004b:	e8 5c 12 00 00       	call   8012ac <sys_page_alloc>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 05                	js     80005c <handler+0x29>
+  800057:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80005a:	c9                   	leave
+  80005b:	c3                   	ret
+  80005c:	83 ec 0c             	sub    $0xc,%esp
+  80005f:	50                   	push   %eax
+  800060:	53                   	push   %ebx
+  800061:	68 a0 3d 80 00       	push   $0x803da0
+  800066:	68 4e 01 00 00       	push   $0x14e
+  80006b:	68 c6 3f 80 00       	push   $0x803fc6
+  800070:	e8 05 06 00 00       	call   80067a <_panic>
+
+00800075 <die>:
+  800075:	55                   	push   %ebp
+  800076:	89 e5                	mov    %esp,%ebp
+  800078:	83 ec 10             	sub    $0x10,%esp
+  80007b:	50                   	push   %eax
+  80007c:	68 d3 3f 80 00       	push   $0x803fd3
+  800081:	e8 cf 06 00 00       	call   800755 <cprintf>
+  800086:	e8 bf 05 00 00       	call   80064a <exit>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	c9                   	leave
+  80008f:	c3                   	ret
+
+00800090 <send_error>:
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	57                   	push   %edi
+  800094:	56                   	push   %esi
+  800095:	53                   	push   %ebx
+  800096:	81 ec 0c 02 00 00    	sub    $0x20c,%esp
+  80009c:	89 c3                	mov    %eax,%ebx
+  80009e:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8000a4:	b8 00 50 80 00       	mov    $0x805000,%eax
+  8000a9:	85 c9                	test   %ecx,%ecx
+  8000ab:	74 1a                	je     8000c7 <send_error+0x37>
+  8000ad:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  8000b1:	74 1b                	je     8000ce <send_error+0x3e>
+  8000b3:	39 ca                	cmp    %ecx,%edx
+  8000b5:	74 17                	je     8000ce <send_error+0x3e>
+  8000b7:	83 c0 08             	add    $0x8,%eax
+  8000ba:	8b 08                	mov    (%eax),%ecx
+  8000bc:	85 c9                	test   %ecx,%ecx
+  8000be:	75 ed                	jne    8000ad <send_error+0x1d>
+  8000c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8000c5:	eb 46                	jmp    80010d <send_error+0x7d>
+  8000c7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8000cc:	eb 3f                	jmp    80010d <send_error+0x7d>
+  8000ce:	85 c9                	test   %ecx,%ecx
+  8000d0:	74 43                	je     800115 <send_error+0x85>
+  8000d2:	8b 40 04             	mov    0x4(%eax),%eax
+  8000d5:	83 ec 04             	sub    $0x4,%esp
+  8000d8:	50                   	push   %eax
+  8000d9:	51                   	push   %ecx
+  8000da:	50                   	push   %eax
+  8000db:	51                   	push   %ecx
+  8000dc:	68 cc 3d 80 00       	push   $0x803dcc
+  8000e1:	68 00 02 00 00       	push   $0x200
+  8000e6:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+  8000ec:	57                   	push   %edi
+  8000ed:	e8 f4 0c 00 00       	call   800de6 <snprintf>
+  8000f2:	89 c6                	mov    %eax,%esi
+  8000f4:	83 c4 1c             	add    $0x1c,%esp
+  8000f7:	50                   	push   %eax
+  8000f8:	57                   	push   %edi
+  8000f9:	ff 33                	push   (%ebx)
+  8000fb:	e8 71 1e 00 00       	call   801f71 <write>
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	39 f0                	cmp    %esi,%eax
+  800105:	0f 95 c0             	setne  %al
+  800108:	0f b6 c0             	movzbl %al,%eax
+  80010b:	f7 d8                	neg    %eax
+  80010d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800110:	5b                   	pop    %ebx
+  800111:	5e                   	pop    %esi
+  800112:	5f                   	pop    %edi
+  800113:	5d                   	pop    %ebp
+  800114:	c3                   	ret
+  800115:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80011a:	eb f1                	jmp    80010d <send_error+0x7d>
+
+0080011c <handle_client>:
+  80011c:	55                   	push   %ebp
+  80011d:	89 e5                	mov    %esp,%ebp
+  80011f:	57                   	push   %edi
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	81 ec 40 0d 00 00    	sub    $0xd40,%esp
+  800128:	89 c6                	mov    %eax,%esi
+  80012a:	68 00 02 00 00       	push   $0x200
+  80012f:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  800135:	50                   	push   %eax
+  800136:	56                   	push   %esi
+  800137:	e8 5a 1d 00 00       	call   801e96 <read>
+  80013c:	83 c4 10             	add    $0x10,%esp
+  80013f:	85 c0                	test   %eax,%eax
+  800141:	0f 88 64 01 00 00    	js     8002ab <handle_client+0x18f>
+  800147:	83 ec 04             	sub    $0x4,%esp
+  80014a:	6a 04                	push   $0x4
+  80014c:	6a 00                	push   $0x0
+  80014e:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800151:	50                   	push   %eax
+  800152:	e8 70 0e 00 00       	call   800fc7 <memset>
+  800157:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  80015a:	83 c4 0c             	add    $0xc,%esp
+  80015d:	6a 04                	push   $0x4
+  80015f:	68 e6 3f 80 00       	push   $0x803fe6
+  800164:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	e8 b7 0d 00 00       	call   800f27 <strncmp>
+  800170:	83 c4 10             	add    $0x10,%esp
+  800173:	85 c0                	test   %eax,%eax
+  800175:	0f 85 7e 03 00 00    	jne    8004f9 <handle_client+0x3dd>
+  80017b:	f6 85 e0 fd ff ff df 	testb  $0xdf,-0x220(%ebp)
+  800182:	0f 84 3a 01 00 00    	je     8002c2 <handle_client+0x1a6>
+  800188:	8d 9d e0 fd ff ff    	lea    -0x220(%ebp),%ebx
+  80018e:	83 c3 01             	add    $0x1,%ebx
+  800191:	f6 03 df             	testb  $0xdf,(%ebx)
+  800194:	75 f8                	jne    80018e <handle_client+0x72>
+  800196:	89 df                	mov    %ebx,%edi
+  800198:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+  80019e:	29 c7                	sub    %eax,%edi
+  8001a0:	83 ec 0c             	sub    $0xc,%esp
+  8001a3:	8d 47 01             	lea    0x1(%edi),%eax
+  8001a6:	50                   	push   %eax
+  8001a7:	e8 21 2b 00 00       	call   802ccd <malloc>
+  8001ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001af:	83 c4 0c             	add    $0xc,%esp
+  8001b2:	57                   	push   %edi
+  8001b3:	8d 8d e0 fd ff ff    	lea    -0x220(%ebp),%ecx
+  8001b9:	51                   	push   %ecx
+  8001ba:	50                   	push   %eax
+  8001bb:	e8 3c 0e 00 00       	call   800ffc <memmove>
+  8001c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8001c3:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+  8001c7:	8d 7b 01             	lea    0x1(%ebx),%edi
+  8001ca:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+  8001ce:	83 c4 10             	add    $0x10,%esp
+  8001d1:	84 c0                	test   %al,%al
+  8001d3:	0f 84 f4 00 00 00    	je     8002cd <handle_client+0x1b1>
+  8001d9:	3c 0a                	cmp    $0xa,%al
+  8001db:	0f 84 ec 00 00 00    	je     8002cd <handle_client+0x1b1>
+  8001e1:	89 f8                	mov    %edi,%eax
+  8001e3:	83 c0 01             	add    $0x1,%eax
+  8001e6:	0f b6 10             	movzbl (%eax),%edx
+  8001e9:	84 d2                	test   %dl,%dl
+  8001eb:	74 05                	je     8001f2 <handle_client+0xd6>
+  8001ed:	80 fa 0a             	cmp    $0xa,%dl
+  8001f0:	75 f1                	jne    8001e3 <handle_client+0xc7>
+  8001f2:	29 f8                	sub    %edi,%eax
+  8001f4:	89 c3                	mov    %eax,%ebx
+  8001f6:	83 ec 0c             	sub    $0xc,%esp
+  8001f9:	8d 40 01             	lea    0x1(%eax),%eax
+  8001fc:	50                   	push   %eax
+  8001fd:	e8 cb 2a 00 00       	call   802ccd <malloc>
+  800202:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800205:	83 c4 0c             	add    $0xc,%esp
+  800208:	53                   	push   %ebx
+  800209:	57                   	push   %edi
+  80020a:	50                   	push   %eax
+  80020b:	e8 ec 0d 00 00       	call   800ffc <memmove>
+  800210:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800213:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  800217:	83 c4 04             	add    $0x4,%esp
+  80021a:	ff 75 e0             	push   -0x20(%ebp)
+  80021d:	e8 de 0b 00 00       	call   800e00 <strlen>
+  800222:	83 c4 0c             	add    $0xc,%esp
+  800225:	50                   	push   %eax
+  800226:	ff 75 e0             	push   -0x20(%ebp)
+  800229:	8d 9d ee f3 ff ff    	lea    -0xc12(%ebp),%ebx
+  80022f:	53                   	push   %ebx
+  800230:	e8 c7 0d 00 00       	call   800ffc <memmove>
+  800235:	83 c4 08             	add    $0x8,%esp
+  800238:	6a 00                	push   $0x0
+  80023a:	53                   	push   %ebx
+  80023b:	e8 13 24 00 00       	call   802653 <open>
+  800240:	89 c7                	mov    %eax,%edi
+  800242:	83 c4 10             	add    $0x10,%esp
+  800245:	85 c0                	test   %eax,%eax
+  800247:	0f 88 87 00 00 00    	js     8002d4 <handle_client+0x1b8>
+  80024d:	83 ec 08             	sub    $0x8,%esp
+  800250:	8d 85 d4 f2 ff ff    	lea    -0xd2c(%ebp),%eax
+  800256:	50                   	push   %eax
+  800257:	57                   	push   %edi
+  800258:	e8 3e 1e 00 00       	call   80209b <fstat>
+  80025d:	83 c4 10             	add    $0x10,%esp
+  800260:	85 c0                	test   %eax,%eax
+  800262:	78 7d                	js     8002e1 <handle_client+0x1c5>
+  800264:	83 bd 58 f3 ff ff 00 	cmpl   $0x0,-0xca8(%ebp)
+  80026b:	0f 85 a2 00 00 00    	jne    800313 <handle_client+0x1f7>
+  800271:	8b 85 54 f3 ff ff    	mov    -0xcac(%ebp),%eax
+  800277:	89 85 c0 f2 ff ff    	mov    %eax,-0xd40(%ebp)
+  80027d:	a1 10 50 80 00       	mov    0x805010,%eax
+  800282:	bb 10 50 80 00       	mov    $0x805010,%ebx
+  800287:	85 c0                	test   %eax,%eax
+  800289:	74 56                	je     8002e1 <handle_client+0x1c5>
+  80028b:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  80028f:	0f 84 8d 00 00 00    	je     800322 <handle_client+0x206>
+  800295:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  80029a:	0f 84 82 00 00 00    	je     800322 <handle_client+0x206>
+  8002a0:	83 c3 08             	add    $0x8,%ebx
+  8002a3:	8b 03                	mov    (%ebx),%eax
+  8002a5:	85 c0                	test   %eax,%eax
+  8002a7:	75 e2                	jne    80028b <handle_client+0x16f>
+  8002a9:	eb 36                	jmp    8002e1 <handle_client+0x1c5>
+  8002ab:	83 ec 04             	sub    $0x4,%esp
+  8002ae:	68 d7 3f 80 00       	push   $0x803fd7
+  8002b3:	68 2e 01 00 00       	push   $0x12e
+  8002b8:	68 c6 3f 80 00       	push   $0x803fc6
+  8002bd:	e8 b8 03 00 00       	call   80067a <_panic>
+  8002c2:	8d 9d e0 fd ff ff    	lea    -0x220(%ebp),%ebx
+  8002c8:	e9 c9 fe ff ff       	jmp    800196 <handle_client+0x7a>
+  8002cd:	89 f8                	mov    %edi,%eax
+  8002cf:	e9 1e ff ff ff       	jmp    8001f2 <handle_client+0xd6>
+  8002d4:	ba 94 01 00 00       	mov    $0x194,%edx
+  8002d9:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8002dc:	e8 af fd ff ff       	call   800090 <send_error>
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	57                   	push   %edi
+  8002e5:	e8 70 1a 00 00       	call   801d5a <close>
+  8002ea:	83 c4 10             	add    $0x10,%esp
+  8002ed:	83 ec 0c             	sub    $0xc,%esp
+  8002f0:	ff 75 e0             	push   -0x20(%ebp)
+  8002f3:	e8 29 29 00 00       	call   802c21 <free>
+  8002f8:	83 c4 04             	add    $0x4,%esp
+  8002fb:	ff 75 e4             	push   -0x1c(%ebp)
+  8002fe:	e8 1e 29 00 00       	call   802c21 <free>
+  800303:	89 34 24             	mov    %esi,(%esp)
+  800306:	e8 4f 1a 00 00       	call   801d5a <close>
+  80030b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030e:	5b                   	pop    %ebx
+  80030f:	5e                   	pop    %esi
+  800310:	5f                   	pop    %edi
+  800311:	5d                   	pop    %ebp
+  800312:	c3                   	ret
+  800313:	ba 94 01 00 00       	mov    $0x194,%edx
+  800318:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80031b:	e8 70 fd ff ff       	call   800090 <send_error>
+  800320:	eb bf                	jmp    8002e1 <handle_client+0x1c5>
+  800322:	85 c0                	test   %eax,%eax
+  800324:	74 bb                	je     8002e1 <handle_client+0x1c5>
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	ff 73 04             	push   0x4(%ebx)
+  80032c:	e8 cf 0a 00 00       	call   800e00 <strlen>
+  800331:	83 c4 0c             	add    $0xc,%esp
+  800334:	89 85 c4 f2 ff ff    	mov    %eax,-0xd3c(%ebp)
+  80033a:	50                   	push   %eax
+  80033b:	ff 73 04             	push   0x4(%ebx)
+  80033e:	ff 75 dc             	push   -0x24(%ebp)
+  800341:	e8 2b 1c 00 00       	call   801f71 <write>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	39 85 c4 f2 ff ff    	cmp    %eax,-0xd3c(%ebp)
+  80034f:	0f 85 3d 01 00 00    	jne    800492 <handle_client+0x376>
+  800355:	ff b5 c0 f2 ff ff    	push   -0xd40(%ebp)
+  80035b:	68 1a 40 80 00       	push   $0x80401a
+  800360:	6a 40                	push   $0x40
+  800362:	8d 85 ee f7 ff ff    	lea    -0x812(%ebp),%eax
+  800368:	50                   	push   %eax
+  800369:	e8 78 0a 00 00       	call   800de6 <snprintf>
+  80036e:	89 c3                	mov    %eax,%ebx
+  800370:	83 c4 10             	add    $0x10,%esp
+  800373:	83 f8 3f             	cmp    $0x3f,%eax
+  800376:	0f 8f 25 01 00 00    	jg     8004a1 <handle_client+0x385>
+  80037c:	83 ec 04             	sub    $0x4,%esp
+  80037f:	53                   	push   %ebx
+  800380:	8d 85 ee f7 ff ff    	lea    -0x812(%ebp),%eax
+  800386:	50                   	push   %eax
+  800387:	ff 75 dc             	push   -0x24(%ebp)
+  80038a:	e8 e2 1b 00 00       	call   801f71 <write>
+  80038f:	83 c4 10             	add    $0x10,%esp
+  800392:	39 c3                	cmp    %eax,%ebx
+  800394:	0f 85 47 ff ff ff    	jne    8002e1 <handle_client+0x1c5>
+  80039a:	68 fd 3f 80 00       	push   $0x803ffd
+  80039f:	68 07 40 80 00       	push   $0x804007
+  8003a4:	68 80 00 00 00       	push   $0x80
+  8003a9:	8d 85 ee f7 ff ff    	lea    -0x812(%ebp),%eax
+  8003af:	50                   	push   %eax
+  8003b0:	e8 31 0a 00 00       	call   800de6 <snprintf>
+  8003b5:	89 c3                	mov    %eax,%ebx
+  8003b7:	83 c4 10             	add    $0x10,%esp
+  8003ba:	83 f8 7f             	cmp    $0x7f,%eax
+  8003bd:	0f 8f f2 00 00 00    	jg     8004b5 <handle_client+0x399>
+  8003c3:	83 ec 04             	sub    $0x4,%esp
+  8003c6:	50                   	push   %eax
+  8003c7:	8d 85 ee f7 ff ff    	lea    -0x812(%ebp),%eax
+  8003cd:	50                   	push   %eax
+  8003ce:	ff 75 dc             	push   -0x24(%ebp)
+  8003d1:	e8 9b 1b 00 00       	call   801f71 <write>
+  8003d6:	83 c4 10             	add    $0x10,%esp
+  8003d9:	39 c3                	cmp    %eax,%ebx
+  8003db:	0f 85 00 ff ff ff    	jne    8002e1 <handle_client+0x1c5>
+  8003e1:	83 ec 0c             	sub    $0xc,%esp
+  8003e4:	68 2d 40 80 00       	push   $0x80402d
+  8003e9:	e8 12 0a 00 00       	call   800e00 <strlen>
+  8003ee:	89 c3                	mov    %eax,%ebx
+  8003f0:	83 c4 0c             	add    $0xc,%esp
+  8003f3:	50                   	push   %eax
+  8003f4:	68 2d 40 80 00       	push   $0x80402d
+  8003f9:	ff 75 dc             	push   -0x24(%ebp)
+  8003fc:	e8 70 1b 00 00       	call   801f71 <write>
+  800401:	83 c4 10             	add    $0x10,%esp
+  800404:	39 c3                	cmp    %eax,%ebx
+  800406:	0f 85 d5 fe ff ff    	jne    8002e1 <handle_client+0x1c5>
+  80040c:	83 ec 08             	sub    $0x8,%esp
+  80040f:	8d 85 60 f3 ff ff    	lea    -0xca0(%ebp),%eax
+  800415:	50                   	push   %eax
+  800416:	57                   	push   %edi
+  800417:	e8 7f 1c 00 00       	call   80209b <fstat>
+  80041c:	83 c4 10             	add    $0x10,%esp
+  80041f:	85 c0                	test   %eax,%eax
+  800421:	0f 88 a5 00 00 00    	js     8004cc <handle_client+0x3b0>
+  800427:	81 bd e0 f3 ff ff ee 	cmpl   $0x5ee,-0xc20(%ebp)
+  80042e:	05 00 00 
+  800431:	0f 8f a4 00 00 00    	jg     8004db <handle_client+0x3bf>
+  800437:	83 ec 04             	sub    $0x4,%esp
+  80043a:	ff b5 e0 f3 ff ff    	push   -0xc20(%ebp)
+  800440:	8d 85 ee f7 ff ff    	lea    -0x812(%ebp),%eax
+  800446:	50                   	push   %eax
+  800447:	57                   	push   %edi
+  800448:	e8 d0 1a 00 00       	call   801f1d <readn>
+  80044d:	83 c4 10             	add    $0x10,%esp
+  800450:	3b 85 e0 f3 ff ff    	cmp    -0xc20(%ebp),%eax
+  800456:	0f 85 8e 00 00 00    	jne    8004ea <handle_client+0x3ce>
+  80045c:	83 ec 04             	sub    $0x4,%esp
+  80045f:	ff b5 e0 f3 ff ff    	push   -0xc20(%ebp)
+  800465:	8d 85 ee f7 ff ff    	lea    -0x812(%ebp),%eax
+  80046b:	50                   	push   %eax
+  80046c:	ff 75 dc             	push   -0x24(%ebp)
+  80046f:	e8 fd 1a 00 00       	call   801f71 <write>
+  800474:	83 c4 10             	add    $0x10,%esp
+  800477:	3b 85 e0 f3 ff ff    	cmp    -0xc20(%ebp),%eax
+  80047d:	0f 84 5e fe ff ff    	je     8002e1 <handle_client+0x1c5>
+  800483:	b8 dc 3e 80 00       	mov    $0x803edc,%eax
+  800488:	e8 e8 fb ff ff       	call   800075 <die>
+  80048d:	e9 4f fe ff ff       	jmp    8002e1 <handle_client+0x1c5>
+  800492:	b8 48 3e 80 00       	mov    $0x803e48,%eax
+  800497:	e8 d9 fb ff ff       	call   800075 <die>
+  80049c:	e9 b4 fe ff ff       	jmp    800355 <handle_client+0x239>
+  8004a1:	83 ec 04             	sub    $0x4,%esp
+  8004a4:	68 eb 3f 80 00       	push   $0x803feb
+  8004a9:	6a 6f                	push   $0x6f
+  8004ab:	68 c6 3f 80 00       	push   $0x803fc6
+  8004b0:	e8 c5 01 00 00       	call   80067a <_panic>
+  8004b5:	83 ec 04             	sub    $0x4,%esp
+  8004b8:	68 eb 3f 80 00       	push   $0x803feb
+  8004bd:	68 8b 00 00 00       	push   $0x8b
+  8004c2:	68 c6 3f 80 00       	push   $0x803fc6
+  8004c7:	e8 ae 01 00 00       	call   80067a <_panic>
+  8004cc:	b8 68 3e 80 00       	mov    $0x803e68,%eax
+  8004d1:	e8 9f fb ff ff       	call   800075 <die>
+  8004d6:	e9 4c ff ff ff       	jmp    800427 <handle_client+0x30b>
+  8004db:	b8 88 3e 80 00       	mov    $0x803e88,%eax
+  8004e0:	e8 90 fb ff ff       	call   800075 <die>
+  8004e5:	e9 4d ff ff ff       	jmp    800437 <handle_client+0x31b>
+  8004ea:	b8 b0 3e 80 00       	mov    $0x803eb0,%eax
+  8004ef:	e8 81 fb ff ff       	call   800075 <die>
+  8004f4:	e9 63 ff ff ff       	jmp    80045c <handle_client+0x340>
+  8004f9:	ba 90 01 00 00       	mov    $0x190,%edx
+  8004fe:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800501:	e8 8a fb ff ff       	call   800090 <send_error>
+  800506:	e9 e2 fd ff ff       	jmp    8002ed <handle_client+0x1d1>
+
+0080050b <umain>:
+  80050b:	55                   	push   %ebp
+  80050c:	89 e5                	mov    %esp,%ebp
+  80050e:	57                   	push   %edi
+  80050f:	56                   	push   %esi
+  800510:	53                   	push   %ebx
+  800511:	83 ec 48             	sub    $0x48,%esp
+  800514:	c7 05 20 50 80 00 30 	movl   $0x804030,0x805020
+  80051b:	40 80 00 
+  80051e:	68 33 00 80 00       	push   $0x800033
+  800523:	e8 f2 15 00 00       	call   801b1a <set_pgfault_handler>
+  800528:	83 c4 0c             	add    $0xc,%esp
+  80052b:	6a 06                	push   $0x6
+  80052d:	6a 01                	push   $0x1
+  80052f:	6a 02                	push   $0x2
+  800531:	e8 79 24 00 00       	call   8029af <socket>
+  800536:	89 c6                	mov    %eax,%esi
+  800538:	83 c4 10             	add    $0x10,%esp
+  80053b:	85 c0                	test   %eax,%eax
+  80053d:	78 6d                	js     8005ac <umain+0xa1>
+  80053f:	83 ec 04             	sub    $0x4,%esp
+  800542:	6a 10                	push   $0x10
+  800544:	6a 00                	push   $0x0
+  800546:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800549:	53                   	push   %ebx
+  80054a:	e8 78 0a 00 00       	call   800fc7 <memset>
+  80054f:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+  800553:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80055a:	e8 d5 33 00 00       	call   803934 <htonl>
+  80055f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800562:	c7 04 24 50 00 00 00 	movl   $0x50,(%esp)
+  800569:	e8 ac 33 00 00       	call   80391a <htons>
+  80056e:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+  800572:	83 c4 0c             	add    $0xc,%esp
+  800575:	6a 10                	push   $0x10
+  800577:	53                   	push   %ebx
+  800578:	56                   	push   %esi
+  800579:	e8 9f 23 00 00       	call   80291d <bind>
+  80057e:	83 c4 10             	add    $0x10,%esp
+  800581:	85 c0                	test   %eax,%eax
+  800583:	78 33                	js     8005b8 <umain+0xad>
+  800585:	83 ec 08             	sub    $0x8,%esp
+  800588:	6a 05                	push   $0x5
+  80058a:	56                   	push   %esi
+  80058b:	e8 fc 23 00 00       	call   80298c <listen>
+  800590:	83 c4 10             	add    $0x10,%esp
+  800593:	85 c0                	test   %eax,%eax
+  800595:	78 2d                	js     8005c4 <umain+0xb9>
+  800597:	83 ec 0c             	sub    $0xc,%esp
+  80059a:	68 58 3f 80 00       	push   $0x803f58
+  80059f:	e8 b1 01 00 00       	call   800755 <cprintf>
+  8005a4:	83 c4 10             	add    $0x10,%esp
+  8005a7:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  8005aa:	eb 35                	jmp    8005e1 <umain+0xd6>
+  8005ac:	b8 37 40 80 00       	mov    $0x804037,%eax
+  8005b1:	e8 bf fa ff ff       	call   800075 <die>
+  8005b6:	eb 87                	jmp    80053f <umain+0x34>
+  8005b8:	b8 10 3f 80 00       	mov    $0x803f10,%eax
+  8005bd:	e8 b3 fa ff ff       	call   800075 <die>
+  8005c2:	eb c1                	jmp    800585 <umain+0x7a>
+  8005c4:	b8 34 3f 80 00       	mov    $0x803f34,%eax
+  8005c9:	e8 a7 fa ff ff       	call   800075 <die>
+  8005ce:	eb c7                	jmp    800597 <umain+0x8c>
+  8005d0:	b8 7c 3f 80 00       	mov    $0x803f7c,%eax
+  8005d5:	e8 9b fa ff ff       	call   800075 <die>
+  8005da:	89 d8                	mov    %ebx,%eax
+  8005dc:	e8 3b fb ff ff       	call   80011c <handle_client>
+  8005e1:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+  8005e8:	83 ec 04             	sub    $0x4,%esp
+  8005eb:	57                   	push   %edi
+  8005ec:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8005ef:	50                   	push   %eax
+  8005f0:	56                   	push   %esi
+  8005f1:	e8 f8 22 00 00       	call   8028ee <accept>
+  8005f6:	89 c3                	mov    %eax,%ebx
+  8005f8:	83 c4 10             	add    $0x10,%esp
+  8005fb:	85 c0                	test   %eax,%eax
+  8005fd:	78 d1                	js     8005d0 <umain+0xc5>
+  8005ff:	eb d9                	jmp    8005da <umain+0xcf>
+
+00800601 <libmain>:
+  800601:	55                   	push   %ebp
+  800602:	89 e5                	mov    %esp,%ebp
+  800604:	56                   	push   %esi
+  800605:	53                   	push   %ebx
+  800606:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800609:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80060c:	e8 31 0c 00 00       	call   801242 <sys_getenvid>
+  800611:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800616:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80061c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800621:	a3 24 60 80 00       	mov    %eax,0x806024
+  800626:	85 db                	test   %ebx,%ebx
+  800628:	7e 07                	jle    800631 <libmain+0x30>
+  80062a:	8b 06                	mov    (%esi),%eax
+  80062c:	a3 20 50 80 00       	mov    %eax,0x805020
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	56                   	push   %esi
+  800635:	53                   	push   %ebx
+  800636:	e8 d0 fe ff ff       	call   80050b <umain>
+  80063b:	e8 0a 00 00 00       	call   80064a <exit>
+  800640:	83 c4 10             	add    $0x10,%esp
+  800643:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800646:	5b                   	pop    %ebx
+  800647:	5e                   	pop    %esi
+  800648:	5d                   	pop    %ebp
+  800649:	c3                   	ret
+
+0080064a <exit>:
+  80064a:	55                   	push   %ebp
+  80064b:	89 e5                	mov    %esp,%ebp
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	a1 24 60 80 00       	mov    0x806024,%eax
+  800655:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80065b:	85 c0                	test   %eax,%eax
+  80065d:	75 14                	jne    800673 <exit+0x29>
+  80065f:	e8 23 17 00 00       	call   801d87 <close_all>
+  800664:	83 ec 0c             	sub    $0xc,%esp
+  800667:	6a 00                	push   $0x0
+  800669:	e8 93 0b 00 00       	call   801201 <sys_env_destroy>
+  80066e:	83 c4 10             	add    $0x10,%esp
+  800671:	c9                   	leave
+  800672:	c3                   	ret
+  800673:	e8 f6 12 00 00       	call   80196e <sys_lease_complete>
+  800678:	eb e5                	jmp    80065f <exit+0x15>
+
+0080067a <_panic>:
+  80067a:	55                   	push   %ebp
+  80067b:	89 e5                	mov    %esp,%ebp
+  80067d:	56                   	push   %esi
+  80067e:	53                   	push   %ebx
+  80067f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800682:	8b 35 20 50 80 00    	mov    0x805020,%esi
+  800688:	e8 b5 0b 00 00       	call   801242 <sys_getenvid>
+  80068d:	83 ec 0c             	sub    $0xc,%esp
+  800690:	ff 75 0c             	push   0xc(%ebp)
+  800693:	ff 75 08             	push   0x8(%ebp)
+  800696:	56                   	push   %esi
+  800697:	50                   	push   %eax
+  800698:	68 70 40 80 00       	push   $0x804070
+  80069d:	e8 b3 00 00 00       	call   800755 <cprintf>
+  8006a2:	83 c4 18             	add    $0x18,%esp
+  8006a5:	53                   	push   %ebx
+  8006a6:	ff 75 10             	push   0x10(%ebp)
+  8006a9:	e8 56 00 00 00       	call   800704 <vcprintf>
+  8006ae:	c7 04 24 2e 40 80 00 	movl   $0x80402e,(%esp)
+  8006b5:	e8 9b 00 00 00       	call   800755 <cprintf>
+  8006ba:	83 c4 10             	add    $0x10,%esp
+  8006bd:	cc                   	int3
+  8006be:	eb fd                	jmp    8006bd <_panic+0x43>
+
+008006c0 <putch>:
+  8006c0:	55                   	push   %ebp
+  8006c1:	89 e5                	mov    %esp,%ebp
+  8006c3:	53                   	push   %ebx
+  8006c4:	83 ec 04             	sub    $0x4,%esp
+  8006c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006ca:	8b 13                	mov    (%ebx),%edx
+  8006cc:	8d 42 01             	lea    0x1(%edx),%eax
+  8006cf:	89 03                	mov    %eax,(%ebx)
+  8006d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006d4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8006d8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006dd:	74 09                	je     8006e8 <putch+0x28>
+  8006df:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8006e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006e6:	c9                   	leave
+  8006e7:	c3                   	ret
+  8006e8:	83 ec 08             	sub    $0x8,%esp
+  8006eb:	68 ff 00 00 00       	push   $0xff
+  8006f0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006f3:	50                   	push   %eax
+  8006f4:	e8 cb 0a 00 00       	call   8011c4 <sys_cputs>
+  8006f9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006ff:	83 c4 10             	add    $0x10,%esp
+  800702:	eb db                	jmp    8006df <putch+0x1f>
+
+00800704 <vcprintf>:
+  800704:	55                   	push   %ebp
+  800705:	89 e5                	mov    %esp,%ebp
+  800707:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80070d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800714:	00 00 00 
+  800717:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80071e:	00 00 00 
+  800721:	ff 75 0c             	push   0xc(%ebp)
+  800724:	ff 75 08             	push   0x8(%ebp)
+  800727:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80072d:	50                   	push   %eax
+  80072e:	68 c0 06 80 00       	push   $0x8006c0
+  800733:	e8 1c 01 00 00       	call   800854 <vprintfmt>
+  800738:	83 c4 08             	add    $0x8,%esp
+  80073b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800741:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800747:	50                   	push   %eax
+  800748:	e8 77 0a 00 00       	call   8011c4 <sys_cputs>
+  80074d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800753:	c9                   	leave
+  800754:	c3                   	ret
+
+00800755 <cprintf>:
+  800755:	55                   	push   %ebp
+  800756:	89 e5                	mov    %esp,%ebp
+  800758:	83 ec 10             	sub    $0x10,%esp
+  80075b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80075e:	50                   	push   %eax
+  80075f:	ff 75 08             	push   0x8(%ebp)
+  800762:	e8 9d ff ff ff       	call   800704 <vcprintf>
+  800767:	c9                   	leave
+  800768:	c3                   	ret
+
+00800769 <printnum>:
+  800769:	55                   	push   %ebp
+  80076a:	89 e5                	mov    %esp,%ebp
+  80076c:	57                   	push   %edi
+  80076d:	56                   	push   %esi
+  80076e:	53                   	push   %ebx
+  80076f:	83 ec 1c             	sub    $0x1c,%esp
+  800772:	89 c3                	mov    %eax,%ebx
+  800774:	89 d6                	mov    %edx,%esi
+  800776:	8b 45 08             	mov    0x8(%ebp),%eax
+  800779:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80077c:	89 d1                	mov    %edx,%ecx
+  80077e:	89 c2                	mov    %eax,%edx
+  800780:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800783:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800786:	8b 45 10             	mov    0x10(%ebp),%eax
+  800789:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800793:	39 c2                	cmp    %eax,%edx
+  800795:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800798:	73 4b                	jae    8007e5 <printnum+0x7c>
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8007a0:	85 ff                	test   %edi,%edi
+  8007a2:	7e 11                	jle    8007b5 <printnum+0x4c>
+  8007a4:	83 ec 08             	sub    $0x8,%esp
+  8007a7:	56                   	push   %esi
+  8007a8:	ff 75 18             	push   0x18(%ebp)
+  8007ab:	ff d3                	call   *%ebx
+  8007ad:	83 c4 10             	add    $0x10,%esp
+  8007b0:	83 ef 01             	sub    $0x1,%edi
+  8007b3:	75 ef                	jne    8007a4 <printnum+0x3b>
+  8007b5:	83 ec 08             	sub    $0x8,%esp
+  8007b8:	56                   	push   %esi
+  8007b9:	83 ec 04             	sub    $0x4,%esp
+  8007bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8007bf:	ff 75 e0             	push   -0x20(%ebp)
+  8007c2:	ff 75 dc             	push   -0x24(%ebp)
+  8007c5:	ff 75 d8             	push   -0x28(%ebp)
+  8007c8:	e8 b3 34 00 00       	call   803c80 <__umoddi3>
+  8007cd:	83 c4 14             	add    $0x14,%esp
+  8007d0:	0f be 80 93 40 80 00 	movsbl 0x804093(%eax),%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	ff d3                	call   *%ebx
+  8007da:	83 c4 10             	add    $0x10,%esp
+  8007dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e0:	5b                   	pop    %ebx
+  8007e1:	5e                   	pop    %esi
+  8007e2:	5f                   	pop    %edi
+  8007e3:	5d                   	pop    %ebp
+  8007e4:	c3                   	ret
+  8007e5:	83 ec 0c             	sub    $0xc,%esp
+  8007e8:	ff 75 18             	push   0x18(%ebp)
+  8007eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007ee:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8007f1:	52                   	push   %edx
+  8007f2:	50                   	push   %eax
+  8007f3:	83 ec 08             	sub    $0x8,%esp
+  8007f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8007f9:	ff 75 e0             	push   -0x20(%ebp)
+  8007fc:	ff 75 dc             	push   -0x24(%ebp)
+  8007ff:	ff 75 d8             	push   -0x28(%ebp)
+  800802:	e8 5b 34 00 00       	call   803c62 <__udivdi3>
+  800807:	83 c4 18             	add    $0x18,%esp
+  80080a:	52                   	push   %edx
+  80080b:	50                   	push   %eax
+  80080c:	89 f2                	mov    %esi,%edx
+  80080e:	89 d8                	mov    %ebx,%eax
+  800810:	e8 54 ff ff ff       	call   800769 <printnum>
+  800815:	83 c4 20             	add    $0x20,%esp
+  800818:	eb 9b                	jmp    8007b5 <printnum+0x4c>
+
+0080081a <sprintputch>:
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800820:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800824:	8b 10                	mov    (%eax),%edx
+  800826:	3b 50 04             	cmp    0x4(%eax),%edx
+  800829:	73 0a                	jae    800835 <sprintputch+0x1b>
+  80082b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80082e:	89 08                	mov    %ecx,(%eax)
+  800830:	8b 45 08             	mov    0x8(%ebp),%eax
+  800833:	88 02                	mov    %al,(%edx)
+  800835:	5d                   	pop    %ebp
+  800836:	c3                   	ret
+
+00800837 <printfmt>:
+  800837:	55                   	push   %ebp
+  800838:	89 e5                	mov    %esp,%ebp
+  80083a:	83 ec 08             	sub    $0x8,%esp
+  80083d:	8d 45 14             	lea    0x14(%ebp),%eax
+  800840:	50                   	push   %eax
+  800841:	ff 75 10             	push   0x10(%ebp)
+  800844:	ff 75 0c             	push   0xc(%ebp)
+  800847:	ff 75 08             	push   0x8(%ebp)
+  80084a:	e8 05 00 00 00       	call   800854 <vprintfmt>
+  80084f:	83 c4 10             	add    $0x10,%esp
+  800852:	c9                   	leave
+  800853:	c3                   	ret
+
+00800854 <vprintfmt>:
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	57                   	push   %edi
+  800858:	56                   	push   %esi
+  800859:	53                   	push   %ebx
+  80085a:	83 ec 2c             	sub    $0x2c,%esp
+  80085d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800860:	89 df                	mov    %ebx,%edi
+  800862:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800865:	8b 45 10             	mov    0x10(%ebp),%eax
+  800868:	8d 70 01             	lea    0x1(%eax),%esi
+  80086b:	0f b6 00             	movzbl (%eax),%eax
+  80086e:	83 f8 25             	cmp    $0x25,%eax
+  800871:	74 1e                	je     800891 <vprintfmt+0x3d>
+  800873:	85 c0                	test   %eax,%eax
+  800875:	0f 84 15 05 00 00    	je     800d90 <vprintfmt+0x53c>
+  80087b:	83 ec 08             	sub    $0x8,%esp
+  80087e:	53                   	push   %ebx
+  80087f:	50                   	push   %eax
+  800880:	ff d7                	call   *%edi
+  800882:	83 c6 01             	add    $0x1,%esi
+  800885:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800889:	83 c4 10             	add    $0x10,%esp
+  80088c:	83 f8 25             	cmp    $0x25,%eax
+  80088f:	75 e2                	jne    800873 <vprintfmt+0x1f>
+  800891:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800895:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80089c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8008a3:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8008aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008af:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8008b2:	8d 56 01             	lea    0x1(%esi),%edx
+  8008b5:	0f b6 0e             	movzbl (%esi),%ecx
+  8008b8:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8008bb:	3c 55                	cmp    $0x55,%al
+  8008bd:	0f 87 3b 04 00 00    	ja     800cfe <vprintfmt+0x4aa>
+  8008c3:	0f b6 c0             	movzbl %al,%eax
+  8008c6:	ff 24 85 e0 41 80 00 	jmp    *0x8041e0(,%eax,4)
+  8008cd:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008d0:	eb 93                	jmp    800865 <vprintfmt+0x11>
+  8008d2:	89 d6                	mov    %edx,%esi
+  8008d4:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8008d8:	eb d8                	jmp    8008b2 <vprintfmt+0x5e>
+  8008da:	89 d6                	mov    %edx,%esi
+  8008dc:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8008e0:	eb d0                	jmp    8008b2 <vprintfmt+0x5e>
+  8008e2:	0f b6 c9             	movzbl %cl,%ecx
+  8008e5:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8008e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8008eb:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8008ef:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8008f2:	83 f9 09             	cmp    $0x9,%ecx
+  8008f5:	77 6f                	ja     800966 <vprintfmt+0x112>
+  8008f7:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8008fa:	83 c2 01             	add    $0x1,%edx
+  8008fd:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800900:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800904:	0f be 02             	movsbl (%edx),%eax
+  800907:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80090a:	83 fe 09             	cmp    $0x9,%esi
+  80090d:	76 eb                	jbe    8008fa <vprintfmt+0xa6>
+  80090f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800912:	89 d6                	mov    %edx,%esi
+  800914:	eb 13                	jmp    800929 <vprintfmt+0xd5>
+  800916:	8b 45 14             	mov    0x14(%ebp),%eax
+  800919:	8b 00                	mov    (%eax),%eax
+  80091b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80091e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800921:	8d 40 04             	lea    0x4(%eax),%eax
+  800924:	89 45 14             	mov    %eax,0x14(%ebp)
+  800927:	89 d6                	mov    %edx,%esi
+  800929:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80092d:	79 83                	jns    8008b2 <vprintfmt+0x5e>
+  80092f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800932:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800935:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80093c:	e9 71 ff ff ff       	jmp    8008b2 <vprintfmt+0x5e>
+  800941:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800944:	85 c9                	test   %ecx,%ecx
+  800946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094b:	0f 49 c1             	cmovns %ecx,%eax
+  80094e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800951:	89 d6                	mov    %edx,%esi
+  800953:	e9 5a ff ff ff       	jmp    8008b2 <vprintfmt+0x5e>
+  800958:	89 d6                	mov    %edx,%esi
+  80095a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800961:	e9 4c ff ff ff       	jmp    8008b2 <vprintfmt+0x5e>
+  800966:	89 d6                	mov    %edx,%esi
+  800968:	eb bf                	jmp    800929 <vprintfmt+0xd5>
+  80096a:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80096e:	89 d6                	mov    %edx,%esi
+  800970:	e9 3d ff ff ff       	jmp    8008b2 <vprintfmt+0x5e>
+  800975:	89 55 10             	mov    %edx,0x10(%ebp)
+  800978:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097b:	8d 70 04             	lea    0x4(%eax),%esi
+  80097e:	83 ec 08             	sub    $0x8,%esp
+  800981:	53                   	push   %ebx
+  800982:	ff 30                	push   (%eax)
+  800984:	ff d7                	call   *%edi
+  800986:	83 c4 10             	add    $0x10,%esp
+  800989:	89 75 14             	mov    %esi,0x14(%ebp)
+  80098c:	e9 d4 fe ff ff       	jmp    800865 <vprintfmt+0x11>
+  800991:	89 55 10             	mov    %edx,0x10(%ebp)
+  800994:	8b 45 14             	mov    0x14(%ebp),%eax
+  800997:	8d 70 04             	lea    0x4(%eax),%esi
+  80099a:	8b 10                	mov    (%eax),%edx
+  80099c:	89 d0                	mov    %edx,%eax
+  80099e:	f7 d8                	neg    %eax
+  8009a0:	0f 48 c2             	cmovs  %edx,%eax
+  8009a3:	83 f8 12             	cmp    $0x12,%eax
+  8009a6:	7f 23                	jg     8009cb <vprintfmt+0x177>
+  8009a8:	8b 14 85 40 43 80 00 	mov    0x804340(,%eax,4),%edx
+  8009af:	85 d2                	test   %edx,%edx
+  8009b1:	74 18                	je     8009cb <vprintfmt+0x177>
+  8009b3:	52                   	push   %edx
+  8009b4:	68 13 45 80 00       	push   $0x804513
+  8009b9:	53                   	push   %ebx
+  8009ba:	57                   	push   %edi
+  8009bb:	e8 77 fe ff ff       	call   800837 <printfmt>
+  8009c0:	83 c4 10             	add    $0x10,%esp
+  8009c3:	89 75 14             	mov    %esi,0x14(%ebp)
+  8009c6:	e9 9a fe ff ff       	jmp    800865 <vprintfmt+0x11>
+  8009cb:	50                   	push   %eax
+  8009cc:	68 ab 40 80 00       	push   $0x8040ab
+  8009d1:	53                   	push   %ebx
+  8009d2:	57                   	push   %edi
+  8009d3:	e8 5f fe ff ff       	call   800837 <printfmt>
+  8009d8:	83 c4 10             	add    $0x10,%esp
+  8009db:	89 75 14             	mov    %esi,0x14(%ebp)
+  8009de:	e9 82 fe ff ff       	jmp    800865 <vprintfmt+0x11>
+  8009e3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e9:	83 c0 04             	add    $0x4,%eax
+  8009ec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8009ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f2:	8b 00                	mov    (%eax),%eax
+  8009f4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009f7:	85 c0                	test   %eax,%eax
+  8009f9:	0f 84 61 03 00 00    	je     800d60 <vprintfmt+0x50c>
+  8009ff:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a03:	7e 06                	jle    800a0b <vprintfmt+0x1b7>
+  800a05:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a09:	75 29                	jne    800a34 <vprintfmt+0x1e0>
+  800a0b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a0e:	8d 70 01             	lea    0x1(%eax),%esi
+  800a11:	0f b6 00             	movzbl (%eax),%eax
+  800a14:	0f be d0             	movsbl %al,%edx
+  800a17:	85 d2                	test   %edx,%edx
+  800a19:	0f 84 bb 00 00 00    	je     800ada <vprintfmt+0x286>
+  800a1f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a22:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a25:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a28:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a2b:	eb 7a                	jmp    800aa7 <vprintfmt+0x253>
+  800a2d:	c7 45 d0 a4 40 80 00 	movl   $0x8040a4,-0x30(%ebp)
+  800a34:	83 ec 08             	sub    $0x8,%esp
+  800a37:	ff 75 d4             	push   -0x2c(%ebp)
+  800a3a:	ff 75 d0             	push   -0x30(%ebp)
+  800a3d:	e8 e0 03 00 00       	call   800e22 <strnlen>
+  800a42:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800a45:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800a48:	83 c4 10             	add    $0x10,%esp
+  800a4b:	85 d2                	test   %edx,%edx
+  800a4d:	0f 8e d6 02 00 00    	jle    800d29 <vprintfmt+0x4d5>
+  800a53:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800a57:	83 ec 08             	sub    $0x8,%esp
+  800a5a:	53                   	push   %ebx
+  800a5b:	56                   	push   %esi
+  800a5c:	ff d7                	call   *%edi
+  800a5e:	83 c4 10             	add    $0x10,%esp
+  800a61:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800a65:	75 f0                	jne    800a57 <vprintfmt+0x203>
+  800a67:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a6a:	8d 70 01             	lea    0x1(%eax),%esi
+  800a6d:	0f b6 00             	movzbl (%eax),%eax
+  800a70:	0f be d0             	movsbl %al,%edx
+  800a73:	85 d2                	test   %edx,%edx
+  800a75:	0f 84 da 02 00 00    	je     800d55 <vprintfmt+0x501>
+  800a7b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a7e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a81:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a84:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a87:	eb 1e                	jmp    800aa7 <vprintfmt+0x253>
+  800a89:	83 ec 08             	sub    $0x8,%esp
+  800a8c:	ff 75 0c             	push   0xc(%ebp)
+  800a8f:	52                   	push   %edx
+  800a90:	ff 55 08             	call   *0x8(%ebp)
+  800a93:	83 c4 10             	add    $0x10,%esp
+  800a96:	83 eb 01             	sub    $0x1,%ebx
+  800a99:	83 c6 01             	add    $0x1,%esi
+  800a9c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800aa0:	0f be d0             	movsbl %al,%edx
+  800aa3:	85 d2                	test   %edx,%edx
+  800aa5:	74 2a                	je     800ad1 <vprintfmt+0x27d>
+  800aa7:	85 ff                	test   %edi,%edi
+  800aa9:	78 05                	js     800ab0 <vprintfmt+0x25c>
+  800aab:	83 ef 01             	sub    $0x1,%edi
+  800aae:	78 59                	js     800b09 <vprintfmt+0x2b5>
+  800ab0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800ab4:	74 d3                	je     800a89 <vprintfmt+0x235>
+  800ab6:	0f be c0             	movsbl %al,%eax
+  800ab9:	83 e8 20             	sub    $0x20,%eax
+  800abc:	83 f8 5e             	cmp    $0x5e,%eax
+  800abf:	76 c8                	jbe    800a89 <vprintfmt+0x235>
+  800ac1:	83 ec 08             	sub    $0x8,%esp
+  800ac4:	ff 75 0c             	push   0xc(%ebp)
+  800ac7:	6a 3f                	push   $0x3f
+  800ac9:	ff 55 08             	call   *0x8(%ebp)
+  800acc:	83 c4 10             	add    $0x10,%esp
+  800acf:	eb c5                	jmp    800a96 <vprintfmt+0x242>
+  800ad1:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ad4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ad7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ada:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800add:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800ae1:	7e 1b                	jle    800afe <vprintfmt+0x2aa>
+  800ae3:	83 ec 08             	sub    $0x8,%esp
+  800ae6:	53                   	push   %ebx
+  800ae7:	6a 20                	push   $0x20
+  800ae9:	ff d7                	call   *%edi
+  800aeb:	83 c4 10             	add    $0x10,%esp
+  800aee:	83 ee 01             	sub    $0x1,%esi
+  800af1:	75 f0                	jne    800ae3 <vprintfmt+0x28f>
+  800af3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800af6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800af9:	e9 67 fd ff ff       	jmp    800865 <vprintfmt+0x11>
+  800afe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b01:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b04:	e9 5c fd ff ff       	jmp    800865 <vprintfmt+0x11>
+  800b09:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b0f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b12:	eb c6                	jmp    800ada <vprintfmt+0x286>
+  800b14:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b17:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b1a:	83 f9 01             	cmp    $0x1,%ecx
+  800b1d:	7f 1f                	jg     800b3e <vprintfmt+0x2ea>
+  800b1f:	85 c9                	test   %ecx,%ecx
+  800b21:	74 67                	je     800b8a <vprintfmt+0x336>
+  800b23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b26:	8b 30                	mov    (%eax),%esi
+  800b28:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b2b:	89 f0                	mov    %esi,%eax
+  800b2d:	c1 f8 1f             	sar    $0x1f,%eax
+  800b30:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b36:	8d 40 04             	lea    0x4(%eax),%eax
+  800b39:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b3c:	eb 17                	jmp    800b55 <vprintfmt+0x301>
+  800b3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b41:	8b 50 04             	mov    0x4(%eax),%edx
+  800b44:	8b 00                	mov    (%eax),%eax
+  800b46:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b49:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4f:	8d 40 08             	lea    0x8(%eax),%eax
+  800b52:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b55:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b58:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b5b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b60:	85 c9                	test   %ecx,%ecx
+  800b62:	0f 89 12 01 00 00    	jns    800c7a <vprintfmt+0x426>
+  800b68:	83 ec 08             	sub    $0x8,%esp
+  800b6b:	53                   	push   %ebx
+  800b6c:	6a 2d                	push   $0x2d
+  800b6e:	ff d7                	call   *%edi
+  800b70:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b73:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b76:	f7 da                	neg    %edx
+  800b78:	83 d1 00             	adc    $0x0,%ecx
+  800b7b:	f7 d9                	neg    %ecx
+  800b7d:	83 c4 10             	add    $0x10,%esp
+  800b80:	be 0a 00 00 00       	mov    $0xa,%esi
+  800b85:	e9 f0 00 00 00       	jmp    800c7a <vprintfmt+0x426>
+  800b8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8d:	8b 30                	mov    (%eax),%esi
+  800b8f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800b92:	89 f0                	mov    %esi,%eax
+  800b94:	c1 f8 1f             	sar    $0x1f,%eax
+  800b97:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800b9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9d:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba0:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ba3:	eb b0                	jmp    800b55 <vprintfmt+0x301>
+  800ba5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ba8:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bab:	83 f9 01             	cmp    $0x1,%ecx
+  800bae:	7f 1e                	jg     800bce <vprintfmt+0x37a>
+  800bb0:	85 c9                	test   %ecx,%ecx
+  800bb2:	74 32                	je     800be6 <vprintfmt+0x392>
+  800bb4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb7:	8b 10                	mov    (%eax),%edx
+  800bb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bbe:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bc4:	be 0a 00 00 00       	mov    $0xa,%esi
+  800bc9:	e9 ac 00 00 00       	jmp    800c7a <vprintfmt+0x426>
+  800bce:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd1:	8b 10                	mov    (%eax),%edx
+  800bd3:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bd6:	8d 40 08             	lea    0x8(%eax),%eax
+  800bd9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bdc:	be 0a 00 00 00       	mov    $0xa,%esi
+  800be1:	e9 94 00 00 00       	jmp    800c7a <vprintfmt+0x426>
+  800be6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be9:	8b 10                	mov    (%eax),%edx
+  800beb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf0:	8d 40 04             	lea    0x4(%eax),%eax
+  800bf3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bf6:	be 0a 00 00 00       	mov    $0xa,%esi
+  800bfb:	eb 7d                	jmp    800c7a <vprintfmt+0x426>
+  800bfd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c00:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c03:	83 f9 01             	cmp    $0x1,%ecx
+  800c06:	7f 1b                	jg     800c23 <vprintfmt+0x3cf>
+  800c08:	85 c9                	test   %ecx,%ecx
+  800c0a:	74 2c                	je     800c38 <vprintfmt+0x3e4>
+  800c0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c0f:	8b 10                	mov    (%eax),%edx
+  800c11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c16:	8d 40 04             	lea    0x4(%eax),%eax
+  800c19:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c1c:	be 08 00 00 00       	mov    $0x8,%esi
+  800c21:	eb 57                	jmp    800c7a <vprintfmt+0x426>
+  800c23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c26:	8b 10                	mov    (%eax),%edx
+  800c28:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c2b:	8d 40 08             	lea    0x8(%eax),%eax
+  800c2e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c31:	be 08 00 00 00       	mov    $0x8,%esi
+  800c36:	eb 42                	jmp    800c7a <vprintfmt+0x426>
+  800c38:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3b:	8b 10                	mov    (%eax),%edx
+  800c3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c42:	8d 40 04             	lea    0x4(%eax),%eax
+  800c45:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c48:	be 08 00 00 00       	mov    $0x8,%esi
+  800c4d:	eb 2b                	jmp    800c7a <vprintfmt+0x426>
+  800c4f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c52:	83 ec 08             	sub    $0x8,%esp
+  800c55:	53                   	push   %ebx
+  800c56:	6a 30                	push   $0x30
+  800c58:	ff d7                	call   *%edi
+  800c5a:	83 c4 08             	add    $0x8,%esp
+  800c5d:	53                   	push   %ebx
+  800c5e:	6a 78                	push   $0x78
+  800c60:	ff d7                	call   *%edi
+  800c62:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c65:	8b 10                	mov    (%eax),%edx
+  800c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6c:	83 c4 10             	add    $0x10,%esp
+  800c6f:	8d 40 04             	lea    0x4(%eax),%eax
+  800c72:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c75:	be 10 00 00 00       	mov    $0x10,%esi
+  800c7a:	83 ec 0c             	sub    $0xc,%esp
+  800c7d:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800c81:	50                   	push   %eax
+  800c82:	ff 75 e4             	push   -0x1c(%ebp)
+  800c85:	56                   	push   %esi
+  800c86:	51                   	push   %ecx
+  800c87:	52                   	push   %edx
+  800c88:	89 da                	mov    %ebx,%edx
+  800c8a:	89 f8                	mov    %edi,%eax
+  800c8c:	e8 d8 fa ff ff       	call   800769 <printnum>
+  800c91:	83 c4 20             	add    $0x20,%esp
+  800c94:	e9 cc fb ff ff       	jmp    800865 <vprintfmt+0x11>
+  800c99:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c9c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c9f:	83 f9 01             	cmp    $0x1,%ecx
+  800ca2:	7f 1b                	jg     800cbf <vprintfmt+0x46b>
+  800ca4:	85 c9                	test   %ecx,%ecx
+  800ca6:	74 2c                	je     800cd4 <vprintfmt+0x480>
+  800ca8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cab:	8b 10                	mov    (%eax),%edx
+  800cad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb2:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cb8:	be 10 00 00 00       	mov    $0x10,%esi
+  800cbd:	eb bb                	jmp    800c7a <vprintfmt+0x426>
+  800cbf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc2:	8b 10                	mov    (%eax),%edx
+  800cc4:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cc7:	8d 40 08             	lea    0x8(%eax),%eax
+  800cca:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ccd:	be 10 00 00 00       	mov    $0x10,%esi
+  800cd2:	eb a6                	jmp    800c7a <vprintfmt+0x426>
+  800cd4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd7:	8b 10                	mov    (%eax),%edx
+  800cd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cde:	8d 40 04             	lea    0x4(%eax),%eax
+  800ce1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ce4:	be 10 00 00 00       	mov    $0x10,%esi
+  800ce9:	eb 8f                	jmp    800c7a <vprintfmt+0x426>
+  800ceb:	89 55 10             	mov    %edx,0x10(%ebp)
+  800cee:	83 ec 08             	sub    $0x8,%esp
+  800cf1:	53                   	push   %ebx
+  800cf2:	6a 25                	push   $0x25
+  800cf4:	ff d7                	call   *%edi
+  800cf6:	83 c4 10             	add    $0x10,%esp
+  800cf9:	e9 67 fb ff ff       	jmp    800865 <vprintfmt+0x11>
+  800cfe:	83 ec 08             	sub    $0x8,%esp
+  800d01:	53                   	push   %ebx
+  800d02:	6a 25                	push   $0x25
+  800d04:	ff d7                	call   *%edi
+  800d06:	83 c4 10             	add    $0x10,%esp
+  800d09:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800d0d:	0f 84 ba fb ff ff    	je     8008cd <vprintfmt+0x79>
+  800d13:	89 75 10             	mov    %esi,0x10(%ebp)
+  800d16:	89 f0                	mov    %esi,%eax
+  800d18:	83 e8 01             	sub    $0x1,%eax
+  800d1b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d1f:	75 f7                	jne    800d18 <vprintfmt+0x4c4>
+  800d21:	89 45 10             	mov    %eax,0x10(%ebp)
+  800d24:	e9 3c fb ff ff       	jmp    800865 <vprintfmt+0x11>
+  800d29:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d2c:	8d 70 01             	lea    0x1(%eax),%esi
+  800d2f:	0f b6 00             	movzbl (%eax),%eax
+  800d32:	0f be d0             	movsbl %al,%edx
+  800d35:	85 d2                	test   %edx,%edx
+  800d37:	74 11                	je     800d4a <vprintfmt+0x4f6>
+  800d39:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d3c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d3f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d42:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d45:	e9 5d fd ff ff       	jmp    800aa7 <vprintfmt+0x253>
+  800d4a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d4d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d50:	e9 10 fb ff ff       	jmp    800865 <vprintfmt+0x11>
+  800d55:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800d58:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d5b:	e9 05 fb ff ff       	jmp    800865 <vprintfmt+0x11>
+  800d60:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800d64:	7e 0a                	jle    800d70 <vprintfmt+0x51c>
+  800d66:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800d6a:	0f 85 bd fc ff ff    	jne    800a2d <vprintfmt+0x1d9>
+  800d70:	ba 28 00 00 00       	mov    $0x28,%edx
+  800d75:	b8 28 00 00 00       	mov    $0x28,%eax
+  800d7a:	be a5 40 80 00       	mov    $0x8040a5,%esi
+  800d7f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800d82:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800d85:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800d88:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d8b:	e9 17 fd ff ff       	jmp    800aa7 <vprintfmt+0x253>
+  800d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d93:	5b                   	pop    %ebx
+  800d94:	5e                   	pop    %esi
+  800d95:	5f                   	pop    %edi
+  800d96:	5d                   	pop    %ebp
+  800d97:	c3                   	ret
+
+00800d98 <vsnprintf>:
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	83 ec 18             	sub    $0x18,%esp
+  800d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800da4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800da7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800dab:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800dae:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800db5:	85 c0                	test   %eax,%eax
+  800db7:	74 26                	je     800ddf <vsnprintf+0x47>
+  800db9:	85 d2                	test   %edx,%edx
+  800dbb:	7e 22                	jle    800ddf <vsnprintf+0x47>
+  800dbd:	ff 75 14             	push   0x14(%ebp)
+  800dc0:	ff 75 10             	push   0x10(%ebp)
+  800dc3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800dc6:	50                   	push   %eax
+  800dc7:	68 1a 08 80 00       	push   $0x80081a
+  800dcc:	e8 83 fa ff ff       	call   800854 <vprintfmt>
+  800dd1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800dd4:	c6 00 00             	movb   $0x0,(%eax)
+  800dd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800dda:	83 c4 10             	add    $0x10,%esp
+  800ddd:	c9                   	leave
+  800dde:	c3                   	ret
+  800ddf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800de4:	eb f7                	jmp    800ddd <vsnprintf+0x45>
+
+00800de6 <snprintf>:
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	83 ec 08             	sub    $0x8,%esp
+  800dec:	8d 45 14             	lea    0x14(%ebp),%eax
+  800def:	50                   	push   %eax
+  800df0:	ff 75 10             	push   0x10(%ebp)
+  800df3:	ff 75 0c             	push   0xc(%ebp)
+  800df6:	ff 75 08             	push   0x8(%ebp)
+  800df9:	e8 9a ff ff ff       	call   800d98 <vsnprintf>
+  800dfe:	c9                   	leave
+  800dff:	c3                   	ret
+
+00800e00 <strlen>:
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e06:	80 3a 00             	cmpb   $0x0,(%edx)
+  800e09:	74 10                	je     800e1b <strlen+0x1b>
+  800e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e10:	83 c0 01             	add    $0x1,%eax
+  800e13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800e17:	75 f7                	jne    800e10 <strlen+0x10>
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+  800e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e20:	eb f7                	jmp    800e19 <strlen+0x19>
+
+00800e22 <strnlen>:
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e28:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e2b:	85 d2                	test   %edx,%edx
+  800e2d:	74 16                	je     800e45 <strnlen+0x23>
+  800e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e34:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800e38:	74 09                	je     800e43 <strnlen+0x21>
+  800e3a:	83 c0 01             	add    $0x1,%eax
+  800e3d:	39 d0                	cmp    %edx,%eax
+  800e3f:	75 f3                	jne    800e34 <strnlen+0x12>
+  800e41:	89 d0                	mov    %edx,%eax
+  800e43:	5d                   	pop    %ebp
+  800e44:	c3                   	ret
+  800e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4a:	eb f7                	jmp    800e43 <strnlen+0x21>
+
+00800e4c <strcpy>:
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	53                   	push   %ebx
+  800e50:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e5f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e62:	83 c0 01             	add    $0x1,%eax
+  800e65:	84 d2                	test   %dl,%dl
+  800e67:	75 f2                	jne    800e5b <strcpy+0xf>
+  800e69:	89 c8                	mov    %ecx,%eax
+  800e6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e6e:	c9                   	leave
+  800e6f:	c3                   	ret
+
+00800e70 <strcat>:
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	53                   	push   %ebx
+  800e74:	83 ec 10             	sub    $0x10,%esp
+  800e77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e7a:	53                   	push   %ebx
+  800e7b:	e8 80 ff ff ff       	call   800e00 <strlen>
+  800e80:	83 c4 08             	add    $0x8,%esp
+  800e83:	ff 75 0c             	push   0xc(%ebp)
+  800e86:	01 d8                	add    %ebx,%eax
+  800e88:	50                   	push   %eax
+  800e89:	e8 be ff ff ff       	call   800e4c <strcpy>
+  800e8e:	89 d8                	mov    %ebx,%eax
+  800e90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e93:	c9                   	leave
+  800e94:	c3                   	ret
+
+00800e95 <strncpy>:
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	56                   	push   %esi
+  800e99:	53                   	push   %ebx
+  800e9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ea0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea3:	85 db                	test   %ebx,%ebx
+  800ea5:	74 17                	je     800ebe <strncpy+0x29>
+  800ea7:	01 f3                	add    %esi,%ebx
+  800ea9:	89 f0                	mov    %esi,%eax
+  800eab:	83 c0 01             	add    $0x1,%eax
+  800eae:	0f b6 0a             	movzbl (%edx),%ecx
+  800eb1:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800eb4:	80 f9 01             	cmp    $0x1,%cl
+  800eb7:	83 da ff             	sbb    $0xffffffff,%edx
+  800eba:	39 c3                	cmp    %eax,%ebx
+  800ebc:	75 ed                	jne    800eab <strncpy+0x16>
+  800ebe:	89 f0                	mov    %esi,%eax
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	c3                   	ret
+
+00800ec4 <strlcpy>:
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+  800ec9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ecc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ecf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed2:	89 f0                	mov    %esi,%eax
+  800ed4:	85 db                	test   %ebx,%ebx
+  800ed6:	74 1e                	je     800ef6 <strlcpy+0x32>
+  800ed8:	83 eb 01             	sub    $0x1,%ebx
+  800edb:	74 16                	je     800ef3 <strlcpy+0x2f>
+  800edd:	01 f3                	add    %esi,%ebx
+  800edf:	0f b6 0a             	movzbl (%edx),%ecx
+  800ee2:	84 c9                	test   %cl,%cl
+  800ee4:	74 0d                	je     800ef3 <strlcpy+0x2f>
+  800ee6:	83 c2 01             	add    $0x1,%edx
+  800ee9:	83 c0 01             	add    $0x1,%eax
+  800eec:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800eef:	39 d8                	cmp    %ebx,%eax
+  800ef1:	75 ec                	jne    800edf <strlcpy+0x1b>
+  800ef3:	c6 00 00             	movb   $0x0,(%eax)
+  800ef6:	29 f0                	sub    %esi,%eax
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+
+00800efc <strcmp>:
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f05:	0f b6 01             	movzbl (%ecx),%eax
+  800f08:	84 c0                	test   %al,%al
+  800f0a:	74 11                	je     800f1d <strcmp+0x21>
+  800f0c:	38 02                	cmp    %al,(%edx)
+  800f0e:	75 0d                	jne    800f1d <strcmp+0x21>
+  800f10:	83 c1 01             	add    $0x1,%ecx
+  800f13:	83 c2 01             	add    $0x1,%edx
+  800f16:	0f b6 01             	movzbl (%ecx),%eax
+  800f19:	84 c0                	test   %al,%al
+  800f1b:	75 ef                	jne    800f0c <strcmp+0x10>
+  800f1d:	0f b6 c0             	movzbl %al,%eax
+  800f20:	0f b6 12             	movzbl (%edx),%edx
+  800f23:	29 d0                	sub    %edx,%eax
+  800f25:	5d                   	pop    %ebp
+  800f26:	c3                   	ret
+
+00800f27 <strncmp>:
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	53                   	push   %ebx
+  800f2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f2e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f31:	8b 55 10             	mov    0x10(%ebp),%edx
+  800f34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f39:	85 d2                	test   %edx,%edx
+  800f3b:	74 2e                	je     800f6b <strncmp+0x44>
+  800f3d:	0f b6 01             	movzbl (%ecx),%eax
+  800f40:	84 c0                	test   %al,%al
+  800f42:	74 16                	je     800f5a <strncmp+0x33>
+  800f44:	3a 03                	cmp    (%ebx),%al
+  800f46:	75 12                	jne    800f5a <strncmp+0x33>
+  800f48:	83 c1 01             	add    $0x1,%ecx
+  800f4b:	83 c3 01             	add    $0x1,%ebx
+  800f4e:	83 ea 01             	sub    $0x1,%edx
+  800f51:	75 ea                	jne    800f3d <strncmp+0x16>
+  800f53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f58:	eb 11                	jmp    800f6b <strncmp+0x44>
+  800f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5f:	85 d2                	test   %edx,%edx
+  800f61:	74 08                	je     800f6b <strncmp+0x44>
+  800f63:	0f b6 01             	movzbl (%ecx),%eax
+  800f66:	0f b6 13             	movzbl (%ebx),%edx
+  800f69:	29 d0                	sub    %edx,%eax
+  800f6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f6e:	c9                   	leave
+  800f6f:	c3                   	ret
+
+00800f70 <strchr>:
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f76:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800f7a:	0f b6 10             	movzbl (%eax),%edx
+  800f7d:	84 d2                	test   %dl,%dl
+  800f7f:	74 15                	je     800f96 <strchr+0x26>
+  800f81:	38 d1                	cmp    %dl,%cl
+  800f83:	74 0f                	je     800f94 <strchr+0x24>
+  800f85:	83 c0 01             	add    $0x1,%eax
+  800f88:	0f b6 10             	movzbl (%eax),%edx
+  800f8b:	84 d2                	test   %dl,%dl
+  800f8d:	75 f2                	jne    800f81 <strchr+0x11>
+  800f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f94:	5d                   	pop    %ebp
+  800f95:	c3                   	ret
+  800f96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9b:	eb f7                	jmp    800f94 <strchr+0x24>
+
+00800f9d <strfind>:
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	53                   	push   %ebx
+  800fa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fa7:	0f b6 18             	movzbl (%eax),%ebx
+  800faa:	38 d3                	cmp    %dl,%bl
+  800fac:	74 14                	je     800fc2 <strfind+0x25>
+  800fae:	89 d1                	mov    %edx,%ecx
+  800fb0:	84 db                	test   %bl,%bl
+  800fb2:	74 0e                	je     800fc2 <strfind+0x25>
+  800fb4:	83 c0 01             	add    $0x1,%eax
+  800fb7:	0f b6 10             	movzbl (%eax),%edx
+  800fba:	38 ca                	cmp    %cl,%dl
+  800fbc:	74 04                	je     800fc2 <strfind+0x25>
+  800fbe:	84 d2                	test   %dl,%dl
+  800fc0:	75 f2                	jne    800fb4 <strfind+0x17>
+  800fc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fc5:	c9                   	leave
+  800fc6:	c3                   	ret
+
+00800fc7 <memset>:
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fce:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800fd1:	85 c9                	test   %ecx,%ecx
+  800fd3:	74 20                	je     800ff5 <memset+0x2e>
+  800fd5:	89 f8                	mov    %edi,%eax
+  800fd7:	09 c8                	or     %ecx,%eax
+  800fd9:	a8 03                	test   $0x3,%al
+  800fdb:	75 12                	jne    800fef <memset+0x28>
+  800fdd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800fe1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800fe7:	c1 e9 02             	shr    $0x2,%ecx
+  800fea:	fc                   	cld
+  800feb:	f3 ab                	rep stos %eax,%es:(%edi)
+  800fed:	eb 06                	jmp    800ff5 <memset+0x2e>
+  800fef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff2:	fc                   	cld
+  800ff3:	f3 aa                	rep stos %al,%es:(%edi)
+  800ff5:	89 f8                	mov    %edi,%eax
+  800ff7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ffa:	c9                   	leave
+  800ffb:	c3                   	ret
+
+00800ffc <memmove>:
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	56                   	push   %esi
+  801001:	8b 45 08             	mov    0x8(%ebp),%eax
+  801004:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801007:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80100a:	39 c6                	cmp    %eax,%esi
+  80100c:	73 32                	jae    801040 <memmove+0x44>
+  80100e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801011:	39 d0                	cmp    %edx,%eax
+  801013:	73 2b                	jae    801040 <memmove+0x44>
+  801015:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  801018:	89 d6                	mov    %edx,%esi
+  80101a:	09 fe                	or     %edi,%esi
+  80101c:	09 ce                	or     %ecx,%esi
+  80101e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801024:	75 0e                	jne    801034 <memmove+0x38>
+  801026:	83 ef 04             	sub    $0x4,%edi
+  801029:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80102c:	c1 e9 02             	shr    $0x2,%ecx
+  80102f:	fd                   	std
+  801030:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801032:	eb 09                	jmp    80103d <memmove+0x41>
+  801034:	83 ef 01             	sub    $0x1,%edi
+  801037:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80103a:	fd                   	std
+  80103b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80103d:	fc                   	cld
+  80103e:	eb 1a                	jmp    80105a <memmove+0x5e>
+  801040:	89 f2                	mov    %esi,%edx
+  801042:	09 c2                	or     %eax,%edx
+  801044:	09 ca                	or     %ecx,%edx
+  801046:	f6 c2 03             	test   $0x3,%dl
+  801049:	75 0a                	jne    801055 <memmove+0x59>
+  80104b:	c1 e9 02             	shr    $0x2,%ecx
+  80104e:	89 c7                	mov    %eax,%edi
+  801050:	fc                   	cld
+  801051:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801053:	eb 05                	jmp    80105a <memmove+0x5e>
+  801055:	89 c7                	mov    %eax,%edi
+  801057:	fc                   	cld
+  801058:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+
+0080105e <memcpy>:
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	83 ec 0c             	sub    $0xc,%esp
+  801064:	ff 75 10             	push   0x10(%ebp)
+  801067:	ff 75 0c             	push   0xc(%ebp)
+  80106a:	ff 75 08             	push   0x8(%ebp)
+  80106d:	e8 8a ff ff ff       	call   800ffc <memmove>
+  801072:	c9                   	leave
+  801073:	c3                   	ret
+
+00801074 <memcmp>:
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+  801079:	8b 45 08             	mov    0x8(%ebp),%eax
+  80107c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80107f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801082:	85 f6                	test   %esi,%esi
+  801084:	74 29                	je     8010af <memcmp+0x3b>
+  801086:	01 c6                	add    %eax,%esi
+  801088:	0f b6 08             	movzbl (%eax),%ecx
+  80108b:	0f b6 1a             	movzbl (%edx),%ebx
+  80108e:	38 d9                	cmp    %bl,%cl
+  801090:	75 11                	jne    8010a3 <memcmp+0x2f>
+  801092:	83 c0 01             	add    $0x1,%eax
+  801095:	83 c2 01             	add    $0x1,%edx
+  801098:	39 c6                	cmp    %eax,%esi
+  80109a:	75 ec                	jne    801088 <memcmp+0x14>
+  80109c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a1:	eb 08                	jmp    8010ab <memcmp+0x37>
+  8010a3:	0f b6 c1             	movzbl %cl,%eax
+  8010a6:	0f b6 db             	movzbl %bl,%ebx
+  8010a9:	29 d8                	sub    %ebx,%eax
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5e                   	pop    %esi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+  8010af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b4:	eb f5                	jmp    8010ab <memcmp+0x37>
+
+008010b6 <memfind>:
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bf:	89 c2                	mov    %eax,%edx
+  8010c1:	03 55 10             	add    0x10(%ebp),%edx
+  8010c4:	39 d0                	cmp    %edx,%eax
+  8010c6:	73 0d                	jae    8010d5 <memfind+0x1f>
+  8010c8:	38 08                	cmp    %cl,(%eax)
+  8010ca:	74 0d                	je     8010d9 <memfind+0x23>
+  8010cc:	83 c0 01             	add    $0x1,%eax
+  8010cf:	39 c2                	cmp    %eax,%edx
+  8010d1:	75 f5                	jne    8010c8 <memfind+0x12>
+  8010d3:	eb 06                	jmp    8010db <memfind+0x25>
+  8010d5:	89 c2                	mov    %eax,%edx
+  8010d7:	eb 02                	jmp    8010db <memfind+0x25>
+  8010d9:	89 c2                	mov    %eax,%edx
+  8010db:	89 d0                	mov    %edx,%eax
+  8010dd:	5d                   	pop    %ebp
+  8010de:	c3                   	ret
+
+008010df <strtol>:
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010eb:	0f b6 02             	movzbl (%edx),%eax
+  8010ee:	3c 20                	cmp    $0x20,%al
+  8010f0:	74 04                	je     8010f6 <strtol+0x17>
+  8010f2:	3c 09                	cmp    $0x9,%al
+  8010f4:	75 0e                	jne    801104 <strtol+0x25>
+  8010f6:	83 c2 01             	add    $0x1,%edx
+  8010f9:	0f b6 02             	movzbl (%edx),%eax
+  8010fc:	3c 20                	cmp    $0x20,%al
+  8010fe:	74 f6                	je     8010f6 <strtol+0x17>
+  801100:	3c 09                	cmp    $0x9,%al
+  801102:	74 f2                	je     8010f6 <strtol+0x17>
+  801104:	3c 2b                	cmp    $0x2b,%al
+  801106:	74 2a                	je     801132 <strtol+0x53>
+  801108:	bf 00 00 00 00       	mov    $0x0,%edi
+  80110d:	3c 2d                	cmp    $0x2d,%al
+  80110f:	74 2b                	je     80113c <strtol+0x5d>
+  801111:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801117:	75 0f                	jne    801128 <strtol+0x49>
+  801119:	80 3a 30             	cmpb   $0x30,(%edx)
+  80111c:	74 28                	je     801146 <strtol+0x67>
+  80111e:	85 db                	test   %ebx,%ebx
+  801120:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801125:	0f 44 d8             	cmove  %eax,%ebx
+  801128:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80112d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801130:	eb 46                	jmp    801178 <strtol+0x99>
+  801132:	83 c2 01             	add    $0x1,%edx
+  801135:	bf 00 00 00 00       	mov    $0x0,%edi
+  80113a:	eb d5                	jmp    801111 <strtol+0x32>
+  80113c:	83 c2 01             	add    $0x1,%edx
+  80113f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801144:	eb cb                	jmp    801111 <strtol+0x32>
+  801146:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80114a:	74 0e                	je     80115a <strtol+0x7b>
+  80114c:	85 db                	test   %ebx,%ebx
+  80114e:	75 d8                	jne    801128 <strtol+0x49>
+  801150:	83 c2 01             	add    $0x1,%edx
+  801153:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801158:	eb ce                	jmp    801128 <strtol+0x49>
+  80115a:	83 c2 02             	add    $0x2,%edx
+  80115d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801162:	eb c4                	jmp    801128 <strtol+0x49>
+  801164:	0f be c0             	movsbl %al,%eax
+  801167:	83 e8 30             	sub    $0x30,%eax
+  80116a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80116d:	7d 3a                	jge    8011a9 <strtol+0xca>
+  80116f:	83 c2 01             	add    $0x1,%edx
+  801172:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801176:	01 c1                	add    %eax,%ecx
+  801178:	0f b6 02             	movzbl (%edx),%eax
+  80117b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80117e:	89 f3                	mov    %esi,%ebx
+  801180:	80 fb 09             	cmp    $0x9,%bl
+  801183:	76 df                	jbe    801164 <strtol+0x85>
+  801185:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801188:	89 f3                	mov    %esi,%ebx
+  80118a:	80 fb 19             	cmp    $0x19,%bl
+  80118d:	77 08                	ja     801197 <strtol+0xb8>
+  80118f:	0f be c0             	movsbl %al,%eax
+  801192:	83 e8 57             	sub    $0x57,%eax
+  801195:	eb d3                	jmp    80116a <strtol+0x8b>
+  801197:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80119a:	89 f3                	mov    %esi,%ebx
+  80119c:	80 fb 19             	cmp    $0x19,%bl
+  80119f:	77 08                	ja     8011a9 <strtol+0xca>
+  8011a1:	0f be c0             	movsbl %al,%eax
+  8011a4:	83 e8 37             	sub    $0x37,%eax
+  8011a7:	eb c1                	jmp    80116a <strtol+0x8b>
+  8011a9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8011ad:	74 05                	je     8011b4 <strtol+0xd5>
+  8011af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011b2:	89 10                	mov    %edx,(%eax)
+  8011b4:	89 c8                	mov    %ecx,%eax
+  8011b6:	f7 d8                	neg    %eax
+  8011b8:	85 ff                	test   %edi,%edi
+  8011ba:	0f 45 c8             	cmovne %eax,%ecx
+  8011bd:	89 c8                	mov    %ecx,%eax
+  8011bf:	5b                   	pop    %ebx
+  8011c0:	5e                   	pop    %esi
+  8011c1:	5f                   	pop    %edi
+  8011c2:	5d                   	pop    %ebp
+  8011c3:	c3                   	ret
+
+008011c4 <sys_cputs>:
+  8011c4:	55                   	push   %ebp
+  8011c5:	89 e5                	mov    %esp,%ebp
+  8011c7:	57                   	push   %edi
+  8011c8:	56                   	push   %esi
+  8011c9:	53                   	push   %ebx
+  8011ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d5:	89 c3                	mov    %eax,%ebx
+  8011d7:	89 c7                	mov    %eax,%edi
+  8011d9:	89 c6                	mov    %eax,%esi
+  8011db:	cd 30                	int    $0x30
+  8011dd:	5b                   	pop    %ebx
+  8011de:	5e                   	pop    %esi
+  8011df:	5f                   	pop    %edi
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+
+008011e2 <sys_cgetc>:
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  8011e5:	57                   	push   %edi
+  8011e6:	56                   	push   %esi
+  8011e7:	53                   	push   %ebx
+  8011e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f2:	89 d1                	mov    %edx,%ecx
+  8011f4:	89 d3                	mov    %edx,%ebx
+  8011f6:	89 d7                	mov    %edx,%edi
+  8011f8:	89 d6                	mov    %edx,%esi
+  8011fa:	cd 30                	int    $0x30
+  8011fc:	5b                   	pop    %ebx
+  8011fd:	5e                   	pop    %esi
+  8011fe:	5f                   	pop    %edi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+
+00801201 <sys_env_destroy>:
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	57                   	push   %edi
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+  801207:	83 ec 0c             	sub    $0xc,%esp
+  80120a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801212:	b8 03 00 00 00       	mov    $0x3,%eax
+  801217:	89 cb                	mov    %ecx,%ebx
+  801219:	89 cf                	mov    %ecx,%edi
+  80121b:	89 ce                	mov    %ecx,%esi
+  80121d:	cd 30                	int    $0x30
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	7f 08                	jg     80122b <sys_env_destroy+0x2a>
+  801223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801226:	5b                   	pop    %ebx
+  801227:	5e                   	pop    %esi
+  801228:	5f                   	pop    %edi
+  801229:	5d                   	pop    %ebp
+  80122a:	c3                   	ret
+  80122b:	83 ec 0c             	sub    $0xc,%esp
+  80122e:	50                   	push   %eax
+  80122f:	6a 03                	push   $0x3
+  801231:	68 ab 43 80 00       	push   $0x8043ab
+  801236:	6a 24                	push   $0x24
+  801238:	68 c8 43 80 00       	push   $0x8043c8
+  80123d:	e8 38 f4 ff ff       	call   80067a <_panic>
+
+00801242 <sys_getenvid>:
+  801242:	55                   	push   %ebp
+  801243:	89 e5                	mov    %esp,%ebp
+  801245:	57                   	push   %edi
+  801246:	56                   	push   %esi
+  801247:	53                   	push   %ebx
+  801248:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801252:	89 d1                	mov    %edx,%ecx
+  801254:	89 d3                	mov    %edx,%ebx
+  801256:	89 d7                	mov    %edx,%edi
+  801258:	89 d6                	mov    %edx,%esi
+  80125a:	cd 30                	int    $0x30
+  80125c:	5b                   	pop    %ebx
+  80125d:	5e                   	pop    %esi
+  80125e:	5f                   	pop    %edi
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+
+00801261 <sys_yield>:
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	57                   	push   %edi
+  801265:	56                   	push   %esi
+  801266:	53                   	push   %ebx
+  801267:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80126e:	74 26                	je     801296 <sys_yield+0x35>
+  801270:	ba 00 00 00 00       	mov    $0x0,%edx
+  801275:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80127a:	89 d1                	mov    %edx,%ecx
+  80127c:	89 d3                	mov    %edx,%ebx
+  80127e:	89 d7                	mov    %edx,%edi
+  801280:	6a 00                	push   $0x0
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	8d 35 8d 12 80 00    	lea    0x80128d,%esi
+  80128b:	0f 34                	sysenter
+  80128d:	5d                   	pop    %ebp
+  80128e:	83 c4 04             	add    $0x4,%esp
+  801291:	5b                   	pop    %ebx
+  801292:	5e                   	pop    %esi
+  801293:	5f                   	pop    %edi
+  801294:	5d                   	pop    %ebp
+  801295:	c3                   	ret
+  801296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8012a0:	89 d1                	mov    %edx,%ecx
+  8012a2:	89 d3                	mov    %edx,%ebx
+  8012a4:	89 d7                	mov    %edx,%edi
+  8012a6:	89 d6                	mov    %edx,%esi
+  8012a8:	cd 30                	int    $0x30
+  8012aa:	eb e5                	jmp    801291 <sys_yield+0x30>
+
+008012ac <sys_page_alloc>:
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+  8012b2:	83 ec 0c             	sub    $0xc,%esp
+  8012b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c8:	89 f7                	mov    %esi,%edi
+  8012ca:	cd 30                	int    $0x30
+  8012cc:	85 c0                	test   %eax,%eax
+  8012ce:	7f 08                	jg     8012d8 <sys_page_alloc+0x2c>
+  8012d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d3:	5b                   	pop    %ebx
+  8012d4:	5e                   	pop    %esi
+  8012d5:	5f                   	pop    %edi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	c3                   	ret
+  8012d8:	83 ec 0c             	sub    $0xc,%esp
+  8012db:	50                   	push   %eax
+  8012dc:	6a 04                	push   $0x4
+  8012de:	68 ab 43 80 00       	push   $0x8043ab
+  8012e3:	6a 24                	push   $0x24
+  8012e5:	68 c8 43 80 00       	push   $0x8043c8
+  8012ea:	e8 8b f3 ff ff       	call   80067a <_panic>
+
+008012ef <sys_page_map>:
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+  8012f5:	83 ec 0c             	sub    $0xc,%esp
+  8012f8:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012ff:	74 33                	je     801334 <sys_page_map+0x45>
+  801301:	8b 55 08             	mov    0x8(%ebp),%edx
+  801304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801307:	b8 05 00 00 00       	mov    $0x5,%eax
+  80130c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801312:	ff 75 18             	push   0x18(%ebp)
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	8d 35 20 13 80 00    	lea    0x801320,%esi
+  80131e:	0f 34                	sysenter
+  801320:	5d                   	pop    %ebp
+  801321:	83 c4 04             	add    $0x4,%esp
+  801324:	89 c2                	mov    %eax,%edx
+  801326:	85 c0                	test   %eax,%eax
+  801328:	7f 3d                	jg     801367 <sys_page_map+0x78>
+  80132a:	89 d0                	mov    %edx,%eax
+  80132c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132f:	5b                   	pop    %ebx
+  801330:	5e                   	pop    %esi
+  801331:	5f                   	pop    %edi
+  801332:	5d                   	pop    %ebp
+  801333:	c3                   	ret
+  801334:	b8 05 00 00 00       	mov    $0x5,%eax
+  801339:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801342:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801345:	8b 75 18             	mov    0x18(%ebp),%esi
+  801348:	cd 30                	int    $0x30
+  80134a:	89 c2                	mov    %eax,%edx
+  80134c:	85 c0                	test   %eax,%eax
+  80134e:	7e da                	jle    80132a <sys_page_map+0x3b>
+  801350:	83 ec 0c             	sub    $0xc,%esp
+  801353:	50                   	push   %eax
+  801354:	6a 05                	push   $0x5
+  801356:	68 ab 43 80 00       	push   $0x8043ab
+  80135b:	6a 24                	push   $0x24
+  80135d:	68 c8 43 80 00       	push   $0x8043c8
+  801362:	e8 13 f3 ff ff       	call   80067a <_panic>
+  801367:	83 ec 0c             	sub    $0xc,%esp
+  80136a:	50                   	push   %eax
+  80136b:	6a 05                	push   $0x5
+  80136d:	68 ab 43 80 00       	push   $0x8043ab
+  801372:	6a 48                	push   $0x48
+  801374:	68 c8 43 80 00       	push   $0x8043c8
+  801379:	e8 fc f2 ff ff       	call   80067a <_panic>
+
+0080137e <sys_page_unmap>:
+  80137e:	55                   	push   %ebp
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	57                   	push   %edi
+  801382:	56                   	push   %esi
+  801383:	53                   	push   %ebx
+  801384:	83 ec 0c             	sub    $0xc,%esp
+  801387:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801392:	b8 06 00 00 00       	mov    $0x6,%eax
+  801397:	89 df                	mov    %ebx,%edi
+  801399:	89 de                	mov    %ebx,%esi
+  80139b:	cd 30                	int    $0x30
+  80139d:	85 c0                	test   %eax,%eax
+  80139f:	7f 08                	jg     8013a9 <sys_page_unmap+0x2b>
+  8013a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a4:	5b                   	pop    %ebx
+  8013a5:	5e                   	pop    %esi
+  8013a6:	5f                   	pop    %edi
+  8013a7:	5d                   	pop    %ebp
+  8013a8:	c3                   	ret
+  8013a9:	83 ec 0c             	sub    $0xc,%esp
+  8013ac:	50                   	push   %eax
+  8013ad:	6a 06                	push   $0x6
+  8013af:	68 ab 43 80 00       	push   $0x8043ab
+  8013b4:	6a 24                	push   $0x24
+  8013b6:	68 c8 43 80 00       	push   $0x8043c8
+  8013bb:	e8 ba f2 ff ff       	call   80067a <_panic>
+
+008013c0 <sys_fork>:
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	57                   	push   %edi
+  8013c4:	56                   	push   %esi
+  8013c5:	53                   	push   %ebx
+  8013c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013d0:	89 d1                	mov    %edx,%ecx
+  8013d2:	89 d3                	mov    %edx,%ebx
+  8013d4:	89 d7                	mov    %edx,%edi
+  8013d6:	89 d6                	mov    %edx,%esi
+  8013d8:	cd 30                	int    $0x30
+  8013da:	5b                   	pop    %ebx
+  8013db:	5e                   	pop    %esi
+  8013dc:	5f                   	pop    %edi
+  8013dd:	5d                   	pop    %ebp
+  8013de:	c3                   	ret
+
+008013df <sys_env_set_status>:
+  8013df:	55                   	push   %ebp
+  8013e0:	89 e5                	mov    %esp,%ebp
+  8013e2:	57                   	push   %edi
+  8013e3:	56                   	push   %esi
+  8013e4:	53                   	push   %ebx
+  8013e5:	83 ec 0c             	sub    $0xc,%esp
+  8013e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013f8:	89 df                	mov    %ebx,%edi
+  8013fa:	89 de                	mov    %ebx,%esi
+  8013fc:	cd 30                	int    $0x30
+  8013fe:	85 c0                	test   %eax,%eax
+  801400:	7f 08                	jg     80140a <sys_env_set_status+0x2b>
+  801402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801405:	5b                   	pop    %ebx
+  801406:	5e                   	pop    %esi
+  801407:	5f                   	pop    %edi
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+  80140a:	83 ec 0c             	sub    $0xc,%esp
+  80140d:	50                   	push   %eax
+  80140e:	6a 08                	push   $0x8
+  801410:	68 ab 43 80 00       	push   $0x8043ab
+  801415:	6a 24                	push   $0x24
+  801417:	68 c8 43 80 00       	push   $0x8043c8
+  80141c:	e8 59 f2 ff ff       	call   80067a <_panic>
+
+00801421 <sys_env_set_trapframe>:
+  801421:	55                   	push   %ebp
+  801422:	89 e5                	mov    %esp,%ebp
+  801424:	57                   	push   %edi
+  801425:	56                   	push   %esi
+  801426:	53                   	push   %ebx
+  801427:	83 ec 0c             	sub    $0xc,%esp
+  80142a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801432:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801435:	b8 09 00 00 00       	mov    $0x9,%eax
+  80143a:	89 df                	mov    %ebx,%edi
+  80143c:	89 de                	mov    %ebx,%esi
+  80143e:	cd 30                	int    $0x30
+  801440:	85 c0                	test   %eax,%eax
+  801442:	7f 08                	jg     80144c <sys_env_set_trapframe+0x2b>
+  801444:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801447:	5b                   	pop    %ebx
+  801448:	5e                   	pop    %esi
+  801449:	5f                   	pop    %edi
+  80144a:	5d                   	pop    %ebp
+  80144b:	c3                   	ret
+  80144c:	83 ec 0c             	sub    $0xc,%esp
+  80144f:	50                   	push   %eax
+  801450:	6a 09                	push   $0x9
+  801452:	68 ab 43 80 00       	push   $0x8043ab
+  801457:	6a 24                	push   $0x24
+  801459:	68 c8 43 80 00       	push   $0x8043c8
+  80145e:	e8 17 f2 ff ff       	call   80067a <_panic>
+
+00801463 <sys_env_set_cow>:
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	57                   	push   %edi
+  801467:	56                   	push   %esi
+  801468:	53                   	push   %ebx
+  801469:	83 ec 0c             	sub    $0xc,%esp
+  80146c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801471:	8b 55 08             	mov    0x8(%ebp),%edx
+  801474:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801477:	b8 20 00 00 00       	mov    $0x20,%eax
+  80147c:	89 df                	mov    %ebx,%edi
+  80147e:	89 de                	mov    %ebx,%esi
+  801480:	cd 30                	int    $0x30
+  801482:	85 c0                	test   %eax,%eax
+  801484:	7f 08                	jg     80148e <sys_env_set_cow+0x2b>
+  801486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801489:	5b                   	pop    %ebx
+  80148a:	5e                   	pop    %esi
+  80148b:	5f                   	pop    %edi
+  80148c:	5d                   	pop    %ebp
+  80148d:	c3                   	ret
+  80148e:	83 ec 0c             	sub    $0xc,%esp
+  801491:	50                   	push   %eax
+  801492:	6a 20                	push   $0x20
+  801494:	68 ab 43 80 00       	push   $0x8043ab
+  801499:	6a 24                	push   $0x24
+  80149b:	68 c8 43 80 00       	push   $0x8043c8
+  8014a0:	e8 d5 f1 ff ff       	call   80067a <_panic>
+
+008014a5 <sys_env_service>:
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+  8014ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	b8 21 00 00 00       	mov    $0x21,%eax
+  8014b8:	89 cb                	mov    %ecx,%ebx
+  8014ba:	89 cf                	mov    %ecx,%edi
+  8014bc:	89 ce                	mov    %ecx,%esi
+  8014be:	cd 30                	int    $0x30
+  8014c0:	5b                   	pop    %ebx
+  8014c1:	5e                   	pop    %esi
+  8014c2:	5f                   	pop    %edi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+
+008014c5 <sys_env_set_pgfault_upcall>:
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	57                   	push   %edi
+  8014c9:	56                   	push   %esi
+  8014ca:	53                   	push   %ebx
+  8014cb:	83 ec 0c             	sub    $0xc,%esp
+  8014ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014de:	89 df                	mov    %ebx,%edi
+  8014e0:	89 de                	mov    %ebx,%esi
+  8014e2:	cd 30                	int    $0x30
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	7f 08                	jg     8014f0 <sys_env_set_pgfault_upcall+0x2b>
+  8014e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014eb:	5b                   	pop    %ebx
+  8014ec:	5e                   	pop    %esi
+  8014ed:	5f                   	pop    %edi
+  8014ee:	5d                   	pop    %ebp
+  8014ef:	c3                   	ret
+  8014f0:	83 ec 0c             	sub    $0xc,%esp
+  8014f3:	50                   	push   %eax
+  8014f4:	6a 0a                	push   $0xa
+  8014f6:	68 ab 43 80 00       	push   $0x8043ab
+  8014fb:	6a 24                	push   $0x24
+  8014fd:	68 c8 43 80 00       	push   $0x8043c8
+  801502:	e8 73 f1 ff ff       	call   80067a <_panic>
+
+00801507 <sys_ipc_try_send>:
+  801507:	55                   	push   %ebp
+  801508:	89 e5                	mov    %esp,%ebp
+  80150a:	57                   	push   %edi
+  80150b:	56                   	push   %esi
+  80150c:	53                   	push   %ebx
+  80150d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801514:	74 27                	je     80153d <sys_ipc_try_send+0x36>
+  801516:	8b 55 08             	mov    0x8(%ebp),%edx
+  801519:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801521:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801524:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801527:	6a 00                	push   $0x0
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	8d 35 34 15 80 00    	lea    0x801534,%esi
+  801532:	0f 34                	sysenter
+  801534:	5d                   	pop    %ebp
+  801535:	83 c4 04             	add    $0x4,%esp
+  801538:	5b                   	pop    %ebx
+  801539:	5e                   	pop    %esi
+  80153a:	5f                   	pop    %edi
+  80153b:	5d                   	pop    %ebp
+  80153c:	c3                   	ret
+  80153d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801542:	be 00 00 00 00       	mov    $0x0,%esi
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801550:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801553:	cd 30                	int    $0x30
+  801555:	eb e1                	jmp    801538 <sys_ipc_try_send+0x31>
+
+00801557 <sys_ipc_recv>:
+  801557:	55                   	push   %ebp
+  801558:	89 e5                	mov    %esp,%ebp
+  80155a:	57                   	push   %edi
+  80155b:	56                   	push   %esi
+  80155c:	53                   	push   %ebx
+  80155d:	83 ec 0c             	sub    $0xc,%esp
+  801560:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801567:	74 32                	je     80159b <sys_ipc_recv+0x44>
+  801569:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801571:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801576:	89 cb                	mov    %ecx,%ebx
+  801578:	89 cf                	mov    %ecx,%edi
+  80157a:	6a 00                	push   $0x0
+  80157c:	55                   	push   %ebp
+  80157d:	89 e5                	mov    %esp,%ebp
+  80157f:	8d 35 87 15 80 00    	lea    0x801587,%esi
+  801585:	0f 34                	sysenter
+  801587:	5d                   	pop    %ebp
+  801588:	83 c4 04             	add    $0x4,%esp
+  80158b:	89 c2                	mov    %eax,%edx
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	7f 3c                	jg     8015cd <sys_ipc_recv+0x76>
+  801591:	89 d0                	mov    %edx,%eax
+  801593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801596:	5b                   	pop    %ebx
+  801597:	5e                   	pop    %esi
+  801598:	5f                   	pop    %edi
+  801599:	5d                   	pop    %ebp
+  80159a:	c3                   	ret
+  80159b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a8:	89 cb                	mov    %ecx,%ebx
+  8015aa:	89 cf                	mov    %ecx,%edi
+  8015ac:	89 ce                	mov    %ecx,%esi
+  8015ae:	cd 30                	int    $0x30
+  8015b0:	89 c2                	mov    %eax,%edx
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	7e db                	jle    801591 <sys_ipc_recv+0x3a>
+  8015b6:	83 ec 0c             	sub    $0xc,%esp
+  8015b9:	50                   	push   %eax
+  8015ba:	6a 0d                	push   $0xd
+  8015bc:	68 ab 43 80 00       	push   $0x8043ab
+  8015c1:	6a 24                	push   $0x24
+  8015c3:	68 c8 43 80 00       	push   $0x8043c8
+  8015c8:	e8 ad f0 ff ff       	call   80067a <_panic>
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	50                   	push   %eax
+  8015d1:	6a 0d                	push   $0xd
+  8015d3:	68 ab 43 80 00       	push   $0x8043ab
+  8015d8:	6a 48                	push   $0x48
+  8015da:	68 c8 43 80 00       	push   $0x8043c8
+  8015df:	e8 96 f0 ff ff       	call   80067a <_panic>
+
+008015e4 <sys_ipc_send>:
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	57                   	push   %edi
+  8015e8:	56                   	push   %esi
+  8015e9:	53                   	push   %ebx
+  8015ea:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8015f1:	74 27                	je     80161a <sys_ipc_send+0x36>
+  8015f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801601:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801604:	6a 00                	push   $0x0
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	8d 35 11 16 80 00    	lea    0x801611,%esi
+  80160f:	0f 34                	sysenter
+  801611:	5d                   	pop    %ebp
+  801612:	83 c4 04             	add    $0x4,%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+  80161a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80161f:	be 00 00 00 00       	mov    $0x0,%esi
+  801624:	8b 55 08             	mov    0x8(%ebp),%edx
+  801627:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80162d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801630:	cd 30                	int    $0x30
+  801632:	eb e1                	jmp    801615 <sys_ipc_send+0x31>
+
+00801634 <sys_ipc_call>:
+  801634:	55                   	push   %ebp
+  801635:	89 e5                	mov    %esp,%ebp
+  801637:	57                   	push   %edi
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801640:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801645:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801648:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80164b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80164e:	cd 30                	int    $0x30
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5f                   	pop    %edi
+  801653:	5d                   	pop    %ebp
+  801654:	c3                   	ret
+
+00801655 <sys_ipc_reply_recv>:
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	57                   	push   %edi
+  801659:	56                   	push   %esi
+  80165a:	53                   	push   %ebx
+  80165b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801661:	b8 10 00 00 00       	mov    $0x10,%eax
+  801666:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801669:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80166c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80166f:	cd 30                	int    $0x30
+  801671:	5b                   	pop    %ebx
+  801672:	5e                   	pop    %esi
+  801673:	5f                   	pop    %edi
+  801674:	5d                   	pop    %ebp
+  801675:	c3                   	ret
+
+00801676 <sys_time_msec>:
+  801676:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	75 06                	jne    801685 <sys_time_msec+0xf>
+  80167f:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801684:	c3                   	ret
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	57                   	push   %edi
+  801689:	56                   	push   %esi
+  80168a:	53                   	push   %ebx
+  80168b:	83 ec 0c             	sub    $0xc,%esp
+  80168e:	0f 31                	rdtsc
+  801690:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801696:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80169c:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8016a2:	29 c8                	sub    %ecx,%eax
+  8016a4:	19 da                	sbb    %ebx,%edx
+  8016a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ab:	57                   	push   %edi
+  8016ac:	56                   	push   %esi
+  8016ad:	52                   	push   %edx
+  8016ae:	50                   	push   %eax
+  8016af:	e8 ae 25 00 00       	call   803c62 <__udivdi3>
+  8016b4:	83 c4 10             	add    $0x10,%esp
+  8016b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ba:	5b                   	pop    %ebx
+  8016bb:	5e                   	pop    %esi
+  8016bc:	5f                   	pop    %edi
+  8016bd:	5d                   	pop    %ebp
+  8016be:	c3                   	ret
+
+008016bf <sys_env_swap>:
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	57                   	push   %edi
+  8016c3:	56                   	push   %esi
+  8016c4:	53                   	push   %ebx
+  8016c5:	83 ec 0c             	sub    $0xc,%esp
+  8016c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016d5:	89 cb                	mov    %ecx,%ebx
+  8016d7:	89 cf                	mov    %ecx,%edi
+  8016d9:	89 ce                	mov    %ecx,%esi
+  8016db:	cd 30                	int    $0x30
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	7f 08                	jg     8016e9 <sys_env_swap+0x2a>
+  8016e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e4:	5b                   	pop    %ebx
+  8016e5:	5e                   	pop    %esi
+  8016e6:	5f                   	pop    %edi
+  8016e7:	5d                   	pop    %ebp
+  8016e8:	c3                   	ret
+  8016e9:	83 ec 0c             	sub    $0xc,%esp
+  8016ec:	50                   	push   %eax
+  8016ed:	6a 12                	push   $0x12
+  8016ef:	68 ab 43 80 00       	push   $0x8043ab
+  8016f4:	6a 24                	push   $0x24
+  8016f6:	68 c8 43 80 00       	push   $0x8043c8
+  8016fb:	e8 7a ef ff ff       	call   80067a <_panic>
+
+00801700 <sys_net_try_send>:
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	57                   	push   %edi
+  801704:	56                   	push   %esi
+  801705:	53                   	push   %ebx
+  801706:	83 ec 0c             	sub    $0xc,%esp
+  801709:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801711:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801714:	b8 13 00 00 00       	mov    $0x13,%eax
+  801719:	89 df                	mov    %ebx,%edi
+  80171b:	89 de                	mov    %ebx,%esi
+  80171d:	cd 30                	int    $0x30
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	7f 08                	jg     80172b <sys_net_try_send+0x2b>
+  801723:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801726:	5b                   	pop    %ebx
+  801727:	5e                   	pop    %esi
+  801728:	5f                   	pop    %edi
+  801729:	5d                   	pop    %ebp
+  80172a:	c3                   	ret
+  80172b:	83 ec 0c             	sub    $0xc,%esp
+  80172e:	50                   	push   %eax
+  80172f:	6a 13                	push   $0x13
+  801731:	68 ab 43 80 00       	push   $0x8043ab
+  801736:	6a 24                	push   $0x24
+  801738:	68 c8 43 80 00       	push   $0x8043c8
+  80173d:	e8 38 ef ff ff       	call   80067a <_panic>
+
+00801742 <sys_net_try_receive>:
+  801742:	55                   	push   %ebp
+  801743:	89 e5                	mov    %esp,%ebp
+  801745:	57                   	push   %edi
+  801746:	56                   	push   %esi
+  801747:	53                   	push   %ebx
+  801748:	83 ec 0c             	sub    $0xc,%esp
+  80174b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801750:	8b 55 08             	mov    0x8(%ebp),%edx
+  801753:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801756:	b8 14 00 00 00       	mov    $0x14,%eax
+  80175b:	89 df                	mov    %ebx,%edi
+  80175d:	89 de                	mov    %ebx,%esi
+  80175f:	cd 30                	int    $0x30
+  801761:	85 c0                	test   %eax,%eax
+  801763:	7f 08                	jg     80176d <sys_net_try_receive+0x2b>
+  801765:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801768:	5b                   	pop    %ebx
+  801769:	5e                   	pop    %esi
+  80176a:	5f                   	pop    %edi
+  80176b:	5d                   	pop    %ebp
+  80176c:	c3                   	ret
+  80176d:	83 ec 0c             	sub    $0xc,%esp
+  801770:	50                   	push   %eax
+  801771:	6a 14                	push   $0x14
+  801773:	68 ab 43 80 00       	push   $0x8043ab
+  801778:	6a 24                	push   $0x24
+  80177a:	68 c8 43 80 00       	push   $0x8043c8
+  80177f:	e8 f6 ee ff ff       	call   80067a <_panic>
+
+00801784 <sys_net_recv_page>:
+  801784:	55                   	push   %ebp
+  801785:	89 e5                	mov    %esp,%ebp
+  801787:	57                   	push   %edi
+  801788:	56                   	push   %esi
+  801789:	53                   	push   %ebx
+  80178a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801792:	b8 27 00 00 00       	mov    $0x27,%eax
+  801797:	89 cb                	mov    %ecx,%ebx
+  801799:	89 cf                	mov    %ecx,%edi
+  80179b:	89 ce                	mov    %ecx,%esi
+  80179d:	cd 30                	int    $0x30
+  80179f:	5b                   	pop    %ebx
+  8017a0:	5e                   	pop    %esi
+  8017a1:	5f                   	pop    %edi
+  8017a2:	5d                   	pop    %ebp
+  8017a3:	c3                   	ret
+
+008017a4 <sys_net_wait>:
+  8017a4:	55                   	push   %ebp
+  8017a5:	89 e5                	mov    %esp,%ebp
+  8017a7:	57                   	push   %edi
+  8017a8:	56                   	push   %esi
+  8017a9:	53                   	push   %ebx
+  8017aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017af:	b8 26 00 00 00       	mov    $0x26,%eax
+  8017b4:	89 d1                	mov    %edx,%ecx
+  8017b6:	89 d3                	mov    %edx,%ebx
+  8017b8:	89 d7                	mov    %edx,%edi
+  8017ba:	89 d6                	mov    %edx,%esi
+  8017bc:	cd 30                	int    $0x30
+  8017be:	5b                   	pop    %ebx
+  8017bf:	5e                   	pop    %esi
+  8017c0:	5f                   	pop    %edi
+  8017c1:	5d                   	pop    %ebp
+  8017c2:	c3                   	ret
+
+008017c3 <sys_get_mac>:
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	57                   	push   %edi
+  8017c7:	56                   	push   %esi
+  8017c8:	53                   	push   %ebx
+  8017c9:	83 ec 0c             	sub    $0xc,%esp
+  8017cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017dc:	89 df                	mov    %ebx,%edi
+  8017de:	89 de                	mov    %ebx,%esi
+  8017e0:	cd 30                	int    $0x30
+  8017e2:	85 c0                	test   %eax,%eax
+  8017e4:	7f 08                	jg     8017ee <sys_get_mac+0x2b>
+  8017e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e9:	5b                   	pop    %ebx
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5f                   	pop    %edi
+  8017ec:	5d                   	pop    %ebp
+  8017ed:	c3                   	ret
+  8017ee:	83 ec 0c             	sub    $0xc,%esp
+  8017f1:	50                   	push   %eax
+  8017f2:	6a 15                	push   $0x15
+  8017f4:	68 ab 43 80 00       	push   $0x8043ab
+  8017f9:	6a 24                	push   $0x24
+  8017fb:	68 c8 43 80 00       	push   $0x8043c8
+  801800:	e8 75 ee ff ff       	call   80067a <_panic>
+
+00801805 <sys_env_lease>:
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	57                   	push   %edi
+  801809:	56                   	push   %esi
+  80180a:	53                   	push   %ebx
+  80180b:	83 ec 0c             	sub    $0xc,%esp
+  80180e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801813:	8b 55 08             	mov    0x8(%ebp),%edx
+  801816:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801819:	b8 16 00 00 00       	mov    $0x16,%eax
+  80181e:	89 df                	mov    %ebx,%edi
+  801820:	89 de                	mov    %ebx,%esi
+  801822:	cd 30                	int    $0x30
+  801824:	85 c0                	test   %eax,%eax
+  801826:	7f 08                	jg     801830 <sys_env_lease+0x2b>
+  801828:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80182b:	5b                   	pop    %ebx
+  80182c:	5e                   	pop    %esi
+  80182d:	5f                   	pop    %edi
+  80182e:	5d                   	pop    %ebp
+  80182f:	c3                   	ret
+  801830:	83 ec 0c             	sub    $0xc,%esp
+  801833:	50                   	push   %eax
+  801834:	6a 16                	push   $0x16
+  801836:	68 ab 43 80 00       	push   $0x8043ab
+  80183b:	6a 24                	push   $0x24
+  80183d:	68 c8 43 80 00       	push   $0x8043c8
+  801842:	e8 33 ee ff ff       	call   80067a <_panic>
+
+00801847 <sys_copy_mem>:
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	57                   	push   %edi
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+  80184d:	83 ec 0c             	sub    $0xc,%esp
+  801850:	8b 55 08             	mov    0x8(%ebp),%edx
+  801853:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801856:	b8 17 00 00 00       	mov    $0x17,%eax
+  80185b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80185e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801861:	8b 75 18             	mov    0x18(%ebp),%esi
+  801864:	cd 30                	int    $0x30
+  801866:	85 c0                	test   %eax,%eax
+  801868:	7f 08                	jg     801872 <sys_copy_mem+0x2b>
+  80186a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80186d:	5b                   	pop    %ebx
+  80186e:	5e                   	pop    %esi
+  80186f:	5f                   	pop    %edi
+  801870:	5d                   	pop    %ebp
+  801871:	c3                   	ret
+  801872:	83 ec 0c             	sub    $0xc,%esp
+  801875:	50                   	push   %eax
+  801876:	6a 17                	push   $0x17
+  801878:	68 ab 43 80 00       	push   $0x8043ab
+  80187d:	6a 24                	push   $0x24
+  80187f:	68 c8 43 80 00       	push   $0x8043c8
+  801884:	e8 f1 ed ff ff       	call   80067a <_panic>
+
+00801889 <sys_get_perms>:
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+  80188c:	57                   	push   %edi
+  80188d:	56                   	push   %esi
+  80188e:	53                   	push   %ebx
+  80188f:	83 ec 0c             	sub    $0xc,%esp
+  801892:	be 00 00 00 00       	mov    $0x0,%esi
+  801897:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189d:	b8 18 00 00 00       	mov    $0x18,%eax
+  8018a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018a5:	89 f7                	mov    %esi,%edi
+  8018a7:	cd 30                	int    $0x30
+  8018a9:	85 c0                	test   %eax,%eax
+  8018ab:	7f 08                	jg     8018b5 <sys_get_perms+0x2c>
+  8018ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b0:	5b                   	pop    %ebx
+  8018b1:	5e                   	pop    %esi
+  8018b2:	5f                   	pop    %edi
+  8018b3:	5d                   	pop    %ebp
+  8018b4:	c3                   	ret
+  8018b5:	83 ec 0c             	sub    $0xc,%esp
+  8018b8:	50                   	push   %eax
+  8018b9:	6a 18                	push   $0x18
+  8018bb:	68 ab 43 80 00       	push   $0x8043ab
+  8018c0:	6a 24                	push   $0x24
+  8018c2:	68 c8 43 80 00       	push   $0x8043c8
+  8018c7:	e8 ae ed ff ff       	call   80067a <_panic>
+
+008018cc <sys_env_unsuspend>:
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	57                   	push   %edi
+  8018d0:	56                   	push   %esi
+  8018d1:	53                   	push   %ebx
+  8018d2:	83 ec 0c             	sub    $0xc,%esp
+  8018d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8018da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e0:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e8:	89 f7                	mov    %esi,%edi
+  8018ea:	cd 30                	int    $0x30
+  8018ec:	85 c0                	test   %eax,%eax
+  8018ee:	7f 08                	jg     8018f8 <sys_env_unsuspend+0x2c>
+  8018f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f3:	5b                   	pop    %ebx
+  8018f4:	5e                   	pop    %esi
+  8018f5:	5f                   	pop    %edi
+  8018f6:	5d                   	pop    %ebp
+  8018f7:	c3                   	ret
+  8018f8:	83 ec 0c             	sub    $0xc,%esp
+  8018fb:	50                   	push   %eax
+  8018fc:	6a 19                	push   $0x19
+  8018fe:	68 ab 43 80 00       	push   $0x8043ab
+  801903:	6a 24                	push   $0x24
+  801905:	68 c8 43 80 00       	push   $0x8043c8
+  80190a:	e8 6b ed ff ff       	call   80067a <_panic>
+
+0080190f <sys_migrate>:
+  80190f:	55                   	push   %ebp
+  801910:	89 e5                	mov    %esp,%ebp
+  801912:	57                   	push   %edi
+  801913:	56                   	push   %esi
+  801914:	53                   	push   %ebx
+  801915:	83 ec 0c             	sub    $0xc,%esp
+  801918:	ba 00 90 80 00       	mov    $0x809000,%edx
+  80191d:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801923:	76 11                	jbe    801936 <sys_migrate+0x27>
+  801925:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80192a:	0f b6 08             	movzbl (%eax),%ecx
+  80192d:	05 00 10 00 00       	add    $0x1000,%eax
+  801932:	39 d0                	cmp    %edx,%eax
+  801934:	72 f4                	jb     80192a <sys_migrate+0x1b>
+  801936:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80193b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801943:	89 cb                	mov    %ecx,%ebx
+  801945:	89 cf                	mov    %ecx,%edi
+  801947:	89 ce                	mov    %ecx,%esi
+  801949:	cd 30                	int    $0x30
+  80194b:	85 c0                	test   %eax,%eax
+  80194d:	7f 08                	jg     801957 <sys_migrate+0x48>
+  80194f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801952:	5b                   	pop    %ebx
+  801953:	5e                   	pop    %esi
+  801954:	5f                   	pop    %edi
+  801955:	5d                   	pop    %ebp
+  801956:	c3                   	ret
+  801957:	83 ec 0c             	sub    $0xc,%esp
+  80195a:	50                   	push   %eax
+  80195b:	6a 1a                	push   $0x1a
+  80195d:	68 ab 43 80 00       	push   $0x8043ab
+  801962:	6a 24                	push   $0x24
+  801964:	68 c8 43 80 00       	push   $0x8043c8
+  801969:	e8 0c ed ff ff       	call   80067a <_panic>
+
+0080196e <sys_lease_complete>:
+  80196e:	55                   	push   %ebp
+  80196f:	89 e5                	mov    %esp,%ebp
+  801971:	57                   	push   %edi
+  801972:	56                   	push   %esi
+  801973:	53                   	push   %ebx
+  801974:	83 ec 0c             	sub    $0xc,%esp
+  801977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801981:	89 d1                	mov    %edx,%ecx
+  801983:	89 d3                	mov    %edx,%ebx
+  801985:	89 d7                	mov    %edx,%edi
+  801987:	89 d6                	mov    %edx,%esi
+  801989:	cd 30                	int    $0x30
+  80198b:	85 c0                	test   %eax,%eax
+  80198d:	7f 08                	jg     801997 <sys_lease_complete+0x29>
+  80198f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801992:	5b                   	pop    %ebx
+  801993:	5e                   	pop    %esi
+  801994:	5f                   	pop    %edi
+  801995:	5d                   	pop    %ebp
+  801996:	c3                   	ret
+  801997:	83 ec 0c             	sub    $0xc,%esp
+  80199a:	50                   	push   %eax
+  80199b:	6a 1b                	push   $0x1b
+  80199d:	68 ab 43 80 00       	push   $0x8043ab
+  8019a2:	6a 24                	push   $0x24
+  8019a4:	68 c8 43 80 00       	push   $0x8043c8
+  8019a9:	e8 cc ec ff ff       	call   80067a <_panic>
+
+008019ae <sys_env_set_thisenv>:
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+  8019b1:	57                   	push   %edi
+  8019b2:	56                   	push   %esi
+  8019b3:	53                   	push   %ebx
+  8019b4:	83 ec 0c             	sub    $0xc,%esp
+  8019b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8019c7:	89 df                	mov    %ebx,%edi
+  8019c9:	89 de                	mov    %ebx,%esi
+  8019cb:	cd 30                	int    $0x30
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	7f 08                	jg     8019d9 <sys_env_set_thisenv+0x2b>
+  8019d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d4:	5b                   	pop    %ebx
+  8019d5:	5e                   	pop    %esi
+  8019d6:	5f                   	pop    %edi
+  8019d7:	5d                   	pop    %ebp
+  8019d8:	c3                   	ret
+  8019d9:	83 ec 0c             	sub    $0xc,%esp
+  8019dc:	50                   	push   %eax
+  8019dd:	6a 1c                	push   $0x1c
+  8019df:	68 ab 43 80 00       	push   $0x8043ab
+  8019e4:	6a 24                	push   $0x24
+  8019e6:	68 c8 43 80 00       	push   $0x8043c8
+  8019eb:	e8 8a ec ff ff       	call   80067a <_panic>
+
+008019f0 <sys_env_set_sched>:
+  8019f0:	55                   	push   %ebp
+  8019f1:	89 e5                	mov    %esp,%ebp
+  8019f3:	57                   	push   %edi
+  8019f4:	56                   	push   %esi
+  8019f5:	53                   	push   %ebx
+  8019f6:	83 ec 0c             	sub    $0xc,%esp
+  8019f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a04:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801a09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a0c:	89 f7                	mov    %esi,%edi
+  801a0e:	cd 30                	int    $0x30
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	7f 08                	jg     801a1c <sys_env_set_sched+0x2c>
+  801a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a17:	5b                   	pop    %ebx
+  801a18:	5e                   	pop    %esi
+  801a19:	5f                   	pop    %edi
+  801a1a:	5d                   	pop    %ebp
+  801a1b:	c3                   	ret
+  801a1c:	83 ec 0c             	sub    $0xc,%esp
+  801a1f:	50                   	push   %eax
+  801a20:	6a 1d                	push   $0x1d
+  801a22:	68 ab 43 80 00       	push   $0x8043ab
+  801a27:	6a 24                	push   $0x24
+  801a29:	68 c8 43 80 00       	push   $0x8043c8
+  801a2e:	e8 47 ec ff ff       	call   80067a <_panic>
+
+00801a33 <sys_batch>:
+  801a33:	55                   	push   %ebp
+  801a34:	89 e5                	mov    %esp,%ebp
+  801a36:	57                   	push   %edi
+  801a37:	56                   	push   %esi
+  801a38:	53                   	push   %ebx
+  801a39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a44:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a49:	89 df                	mov    %ebx,%edi
+  801a4b:	89 de                	mov    %ebx,%esi
+  801a4d:	cd 30                	int    $0x30
+  801a4f:	5b                   	pop    %ebx
+  801a50:	5e                   	pop    %esi
+  801a51:	5f                   	pop    %edi
+  801a52:	5d                   	pop    %ebp
+  801a53:	c3                   	ret
+
+00801a54 <sys_env_stats>:
+  801a54:	55                   	push   %ebp
+  801a55:	89 e5                	mov    %esp,%ebp
+  801a57:	57                   	push   %edi
+  801a58:	56                   	push   %esi
+  801a59:	53                   	push   %ebx
+  801a5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a65:	b8 23 00 00 00       	mov    $0x23,%eax
+  801a6a:	89 df                	mov    %ebx,%edi
+  801a6c:	89 de                	mov    %ebx,%esi
+  801a6e:	cd 30                	int    $0x30
+  801a70:	5b                   	pop    %ebx
+  801a71:	5e                   	pop    %esi
+  801a72:	5f                   	pop    %edi
+  801a73:	5d                   	pop    %ebp
+  801a74:	c3                   	ret
+
+00801a75 <sys_trace>:
+  801a75:	55                   	push   %ebp
+  801a76:	89 e5                	mov    %esp,%ebp
+  801a78:	57                   	push   %edi
+  801a79:	56                   	push   %esi
+  801a7a:	53                   	push   %ebx
+  801a7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a83:	b8 24 00 00 00       	mov    $0x24,%eax
+  801a88:	89 cb                	mov    %ecx,%ebx
+  801a8a:	89 cf                	mov    %ecx,%edi
+  801a8c:	89 ce                	mov    %ecx,%esi
+  801a8e:	cd 30                	int    $0x30
+  801a90:	5b                   	pop    %ebx
+  801a91:	5e                   	pop    %esi
+  801a92:	5f                   	pop    %edi
+  801a93:	5d                   	pop    %ebp
+  801a94:	c3                   	ret
+
+00801a95 <sys_env_set_pager>:
+  801a95:	55                   	push   %ebp
+  801a96:	89 e5                	mov    %esp,%ebp
+  801a98:	57                   	push   %edi
+  801a99:	56                   	push   %esi
+  801a9a:	53                   	push   %ebx
+  801a9b:	83 ec 0c             	sub    $0xc,%esp
+  801a9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa9:	b8 25 00 00 00       	mov    $0x25,%eax
+  801aae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ab1:	89 f7                	mov    %esi,%edi
+  801ab3:	cd 30                	int    $0x30
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	7f 08                	jg     801ac1 <sys_env_set_pager+0x2c>
+  801ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801abc:	5b                   	pop    %ebx
+  801abd:	5e                   	pop    %esi
+  801abe:	5f                   	pop    %edi
+  801abf:	5d                   	pop    %ebp
+  801ac0:	c3                   	ret
+  801ac1:	83 ec 0c             	sub    $0xc,%esp
+  801ac4:	50                   	push   %eax
+  801ac5:	6a 25                	push   $0x25
+  801ac7:	68 ab 43 80 00       	push   $0x8043ab
+  801acc:	6a 24                	push   $0x24
+  801ace:	68 c8 43 80 00       	push   $0x8043c8
+  801ad3:	e8 a2 eb ff ff       	call   80067a <_panic>
+
+00801ad8 <sys_pager_retire>:
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	57                   	push   %edi
+  801adc:	56                   	push   %esi
+  801add:	53                   	push   %ebx
+  801ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ae3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae6:	b8 28 00 00 00       	mov    $0x28,%eax
+  801aeb:	89 cb                	mov    %ecx,%ebx
+  801aed:	89 cf                	mov    %ecx,%edi
+  801aef:	89 ce                	mov    %ecx,%esi
+  801af1:	cd 30                	int    $0x30
+  801af3:	5b                   	pop    %ebx
+  801af4:	5e                   	pop    %esi
+  801af5:	5f                   	pop    %edi
+  801af6:	5d                   	pop    %ebp
+  801af7:	c3                   	ret
+
+00801af8 <sys_prof>:
+  801af8:	55                   	push   %ebp
+  801af9:	89 e5                	mov    %esp,%ebp
+  801afb:	57                   	push   %edi
+  801afc:	56                   	push   %esi
+  801afd:	53                   	push   %ebx
+  801afe:	be 00 00 00 00       	mov    $0x0,%esi
+  801b03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b09:	b8 22 00 00 00       	mov    $0x22,%eax
+  801b0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b11:	89 f7                	mov    %esi,%edi
+  801b13:	cd 30                	int    $0x30
+  801b15:	5b                   	pop    %ebx
+  801b16:	5e                   	pop    %esi
+  801b17:	5f                   	pop    %edi
+  801b18:	5d                   	pop    %ebp
+  801b19:	c3                   	ret
+
+00801b1a <set_pgfault_handler>:
+  801b1a:	55                   	push   %ebp
+  801b1b:	89 e5                	mov    %esp,%ebp
+  801b1d:	53                   	push   %ebx
+  801b1e:	83 ec 04             	sub    $0x4,%esp
+  801b21:	83 3d 28 60 80 00 00 	cmpl   $0x0,0x806028
+  801b28:	74 0d                	je     801b37 <set_pgfault_handler+0x1d>
+  801b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b2d:	a3 28 60 80 00       	mov    %eax,0x806028
+  801b32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+  801b37:	e8 06 f7 ff ff       	call   801242 <sys_getenvid>
+  801b3c:	89 c3                	mov    %eax,%ebx
+  801b3e:	83 ec 04             	sub    $0x4,%esp
+  801b41:	6a 07                	push   $0x7
+  801b43:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b48:	50                   	push   %eax
+  801b49:	e8 5e f7 ff ff       	call   8012ac <sys_page_alloc>
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	78 29                	js     801b7e <set_pgfault_handler+0x64>
+  801b55:	83 ec 08             	sub    $0x8,%esp
+  801b58:	68 92 1b 80 00       	push   $0x801b92
+  801b5d:	53                   	push   %ebx
+  801b5e:	e8 62 f9 ff ff       	call   8014c5 <sys_env_set_pgfault_upcall>
+  801b63:	83 c4 10             	add    $0x10,%esp
+  801b66:	85 c0                	test   %eax,%eax
+  801b68:	79 c0                	jns    801b2a <set_pgfault_handler+0x10>
+  801b6a:	83 ec 04             	sub    $0x4,%esp
+  801b6d:	68 10 44 80 00       	push   $0x804410
+  801b72:	6a 27                	push   $0x27
+  801b74:	68 42 44 80 00       	push   $0x804442
+  801b79:	e8 fc ea ff ff       	call   80067a <_panic>
+  801b7e:	83 ec 04             	sub    $0x4,%esp
+  801b81:	68 d8 43 80 00       	push   $0x8043d8
+  801b86:	6a 23                	push   $0x23
+  801b88:	68 42 44 80 00       	push   $0x804442
+  801b8d:	e8 e8 ea ff ff       	call   80067a <_panic>
+
+00801b92 <_pgfault_upcall>:
+  801b92:	54                   	push   %esp
+  801b93:	a1 28 60 80 00       	mov    0x806028,%eax
+  801b98:	ff d0                	call   *%eax
+  801b9a:	83 c4 04             	add    $0x4,%esp
+  801b9d:	89 e3                	mov    %esp,%ebx
+  801b9f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  801ba3:	8b 54 24 30          	mov    0x30(%esp),%edx
+  801ba7:	89 d4                	mov    %edx,%esp
+  801ba9:	51                   	push   %ecx
+  801baa:	89 dc                	mov    %ebx,%esp
+  801bac:	83 ea 04             	sub    $0x4,%edx
+  801baf:	89 54 24 30          	mov    %edx,0x30(%esp)
+  801bb3:	83 c4 08             	add    $0x8,%esp
+  801bb6:	61                   	popa
+  801bb7:	83 c4 04             	add    $0x4,%esp
+  801bba:	9d                   	popf
+  801bbb:	5c                   	pop    %esp
+  801bbc:	c3                   	ret
+
+00801bbd <fd2num>:
+  801bbd:	55                   	push   %ebp
+  801bbe:	89 e5                	mov    %esp,%ebp
+  801bc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc3:	05 00 00 00 30       	add    $0x30000000,%eax
+  801bc8:	c1 e8 0c             	shr    $0xc,%eax
+  801bcb:	5d                   	pop    %ebp
+  801bcc:	c3                   	ret
+
+00801bcd <fd2data>:
+  801bcd:	55                   	push   %ebp
+  801bce:	89 e5                	mov    %esp,%ebp
+  801bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd3:	05 00 00 00 30       	add    $0x30000000,%eax
+  801bd8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bdd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801be2:	5d                   	pop    %ebp
+  801be3:	c3                   	ret
+
+00801be4 <fd_alloc>:
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801bec:	89 c2                	mov    %eax,%edx
+  801bee:	c1 ea 16             	shr    $0x16,%edx
+  801bf1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bf8:	f6 c2 01             	test   $0x1,%dl
+  801bfb:	74 29                	je     801c26 <fd_alloc+0x42>
+  801bfd:	89 c2                	mov    %eax,%edx
+  801bff:	c1 ea 0c             	shr    $0xc,%edx
+  801c02:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c09:	f6 c2 01             	test   $0x1,%dl
+  801c0c:	74 18                	je     801c26 <fd_alloc+0x42>
+  801c0e:	05 00 10 00 00       	add    $0x1000,%eax
+  801c13:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801c18:	75 d2                	jne    801bec <fd_alloc+0x8>
+  801c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c24:	eb 05                	jmp    801c2b <fd_alloc+0x47>
+  801c26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c2e:	89 02                	mov    %eax,(%edx)
+  801c30:	89 c8                	mov    %ecx,%eax
+  801c32:	5d                   	pop    %ebp
+  801c33:	c3                   	ret
+
+00801c34 <fd_lookup>:
+  801c34:	55                   	push   %ebp
+  801c35:	89 e5                	mov    %esp,%ebp
+  801c37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c3a:	83 f8 1f             	cmp    $0x1f,%eax
+  801c3d:	77 30                	ja     801c6f <fd_lookup+0x3b>
+  801c3f:	c1 e0 0c             	shl    $0xc,%eax
+  801c42:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801c47:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c4d:	f6 c2 01             	test   $0x1,%dl
+  801c50:	74 24                	je     801c76 <fd_lookup+0x42>
+  801c52:	89 c2                	mov    %eax,%edx
+  801c54:	c1 ea 0c             	shr    $0xc,%edx
+  801c57:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c5e:	f6 c2 01             	test   $0x1,%dl
+  801c61:	74 1a                	je     801c7d <fd_lookup+0x49>
+  801c63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c66:	89 02                	mov    %eax,(%edx)
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6d:	5d                   	pop    %ebp
+  801c6e:	c3                   	ret
+  801c6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c74:	eb f7                	jmp    801c6d <fd_lookup+0x39>
+  801c76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c7b:	eb f0                	jmp    801c6d <fd_lookup+0x39>
+  801c7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c82:	eb e9                	jmp    801c6d <fd_lookup+0x39>
+
+00801c84 <dev_lookup>:
+  801c84:	55                   	push   %ebp
+  801c85:	89 e5                	mov    %esp,%ebp
+  801c87:	53                   	push   %ebx
+  801c88:	83 ec 04             	sub    $0x4,%esp
+  801c8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c93:	bb 24 50 80 00       	mov    $0x805024,%ebx
+  801c98:	39 13                	cmp    %edx,(%ebx)
+  801c9a:	74 37                	je     801cd3 <dev_lookup+0x4f>
+  801c9c:	83 c0 01             	add    $0x1,%eax
+  801c9f:	8b 1c 85 cc 44 80 00 	mov    0x8044cc(,%eax,4),%ebx
+  801ca6:	85 db                	test   %ebx,%ebx
+  801ca8:	75 ee                	jne    801c98 <dev_lookup+0x14>
+  801caa:	a1 24 60 80 00       	mov    0x806024,%eax
+  801caf:	8b 40 48             	mov    0x48(%eax),%eax
+  801cb2:	83 ec 04             	sub    $0x4,%esp
+  801cb5:	52                   	push   %edx
+  801cb6:	50                   	push   %eax
+  801cb7:	68 50 44 80 00       	push   $0x804450
+  801cbc:	e8 94 ea ff ff       	call   800755 <cprintf>
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ccc:	89 1a                	mov    %ebx,(%edx)
+  801cce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd1:	c9                   	leave
+  801cd2:	c3                   	ret
+  801cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd8:	eb ef                	jmp    801cc9 <dev_lookup+0x45>
+
+00801cda <fd_close>:
+  801cda:	55                   	push   %ebp
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	57                   	push   %edi
+  801cde:	56                   	push   %esi
+  801cdf:	53                   	push   %ebx
+  801ce0:	83 ec 24             	sub    $0x24,%esp
+  801ce3:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ce6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ce9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cec:	50                   	push   %eax
+  801ced:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801cf3:	c1 e8 0c             	shr    $0xc,%eax
+  801cf6:	50                   	push   %eax
+  801cf7:	e8 38 ff ff ff       	call   801c34 <fd_lookup>
+  801cfc:	89 c3                	mov    %eax,%ebx
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	85 c0                	test   %eax,%eax
+  801d03:	78 05                	js     801d0a <fd_close+0x30>
+  801d05:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d08:	74 0f                	je     801d19 <fd_close+0x3f>
+  801d0a:	85 ff                	test   %edi,%edi
+  801d0c:	0f 44 df             	cmove  %edi,%ebx
+  801d0f:	89 d8                	mov    %ebx,%eax
+  801d11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d14:	5b                   	pop    %ebx
+  801d15:	5e                   	pop    %esi
+  801d16:	5f                   	pop    %edi
+  801d17:	5d                   	pop    %ebp
+  801d18:	c3                   	ret
+  801d19:	83 ec 08             	sub    $0x8,%esp
+  801d1c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d1f:	50                   	push   %eax
+  801d20:	ff 36                	push   (%esi)
+  801d22:	e8 5d ff ff ff       	call   801c84 <dev_lookup>
+  801d27:	89 c3                	mov    %eax,%ebx
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 1a                	js     801d4a <fd_close+0x70>
+  801d30:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d33:	8b 40 10             	mov    0x10(%eax),%eax
+  801d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	74 0b                	je     801d4a <fd_close+0x70>
+  801d3f:	83 ec 0c             	sub    $0xc,%esp
+  801d42:	56                   	push   %esi
+  801d43:	ff d0                	call   *%eax
+  801d45:	89 c3                	mov    %eax,%ebx
+  801d47:	83 c4 10             	add    $0x10,%esp
+  801d4a:	83 ec 08             	sub    $0x8,%esp
+  801d4d:	56                   	push   %esi
+  801d4e:	6a 00                	push   $0x0
+  801d50:	e8 29 f6 ff ff       	call   80137e <sys_page_unmap>
+  801d55:	83 c4 10             	add    $0x10,%esp
+  801d58:	eb b5                	jmp    801d0f <fd_close+0x35>
+
+00801d5a <close>:
+  801d5a:	55                   	push   %ebp
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	83 ec 20             	sub    $0x20,%esp
+  801d60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d63:	50                   	push   %eax
+  801d64:	ff 75 08             	push   0x8(%ebp)
+  801d67:	e8 c8 fe ff ff       	call   801c34 <fd_lookup>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	79 02                	jns    801d75 <close+0x1b>
+  801d73:	c9                   	leave
+  801d74:	c3                   	ret
+  801d75:	83 ec 08             	sub    $0x8,%esp
+  801d78:	6a 01                	push   $0x1
+  801d7a:	ff 75 f4             	push   -0xc(%ebp)
+  801d7d:	e8 58 ff ff ff       	call   801cda <fd_close>
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	eb ec                	jmp    801d73 <close+0x19>
+
+00801d87 <close_all>:
+  801d87:	55                   	push   %ebp
+  801d88:	89 e5                	mov    %esp,%ebp
+  801d8a:	53                   	push   %ebx
+  801d8b:	83 ec 04             	sub    $0x4,%esp
+  801d8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d93:	83 ec 0c             	sub    $0xc,%esp
+  801d96:	53                   	push   %ebx
+  801d97:	e8 be ff ff ff       	call   801d5a <close>
+  801d9c:	83 c3 01             	add    $0x1,%ebx
+  801d9f:	83 c4 10             	add    $0x10,%esp
+  801da2:	83 fb 20             	cmp    $0x20,%ebx
+  801da5:	75 ec                	jne    801d93 <close_all+0xc>
+  801da7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801daa:	c9                   	leave
+  801dab:	c3                   	ret
+
+00801dac <dup>:
+  801dac:	55                   	push   %ebp
+  801dad:	89 e5                	mov    %esp,%ebp
+  801daf:	57                   	push   %edi
+  801db0:	56                   	push   %esi
+  801db1:	53                   	push   %ebx
+  801db2:	83 ec 34             	sub    $0x34,%esp
+  801db5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801db8:	50                   	push   %eax
+  801db9:	ff 75 08             	push   0x8(%ebp)
+  801dbc:	e8 73 fe ff ff       	call   801c34 <fd_lookup>
+  801dc1:	89 c3                	mov    %eax,%ebx
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	78 7f                	js     801e49 <dup+0x9d>
+  801dca:	83 ec 0c             	sub    $0xc,%esp
+  801dcd:	ff 75 0c             	push   0xc(%ebp)
+  801dd0:	e8 85 ff ff ff       	call   801d5a <close>
+  801dd5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dd8:	c1 e6 0c             	shl    $0xc,%esi
+  801ddb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801de1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de4:	89 3c 24             	mov    %edi,(%esp)
+  801de7:	e8 e1 fd ff ff       	call   801bcd <fd2data>
+  801dec:	89 c3                	mov    %eax,%ebx
+  801dee:	89 34 24             	mov    %esi,(%esp)
+  801df1:	e8 d7 fd ff ff       	call   801bcd <fd2data>
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dfc:	89 d8                	mov    %ebx,%eax
+  801dfe:	c1 e8 16             	shr    $0x16,%eax
+  801e01:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e08:	a8 01                	test   $0x1,%al
+  801e0a:	74 11                	je     801e1d <dup+0x71>
+  801e0c:	89 d8                	mov    %ebx,%eax
+  801e0e:	c1 e8 0c             	shr    $0xc,%eax
+  801e11:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e18:	f6 c2 01             	test   $0x1,%dl
+  801e1b:	75 36                	jne    801e53 <dup+0xa7>
+  801e1d:	89 f8                	mov    %edi,%eax
+  801e1f:	c1 e8 0c             	shr    $0xc,%eax
+  801e22:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e29:	83 ec 0c             	sub    $0xc,%esp
+  801e2c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e31:	50                   	push   %eax
+  801e32:	56                   	push   %esi
+  801e33:	6a 00                	push   $0x0
+  801e35:	57                   	push   %edi
+  801e36:	6a 00                	push   $0x0
+  801e38:	e8 b2 f4 ff ff       	call   8012ef <sys_page_map>
+  801e3d:	89 c3                	mov    %eax,%ebx
+  801e3f:	83 c4 20             	add    $0x20,%esp
+  801e42:	85 c0                	test   %eax,%eax
+  801e44:	78 33                	js     801e79 <dup+0xcd>
+  801e46:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e49:	89 d8                	mov    %ebx,%eax
+  801e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e4e:	5b                   	pop    %ebx
+  801e4f:	5e                   	pop    %esi
+  801e50:	5f                   	pop    %edi
+  801e51:	5d                   	pop    %ebp
+  801e52:	c3                   	ret
+  801e53:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e5a:	83 ec 0c             	sub    $0xc,%esp
+  801e5d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e62:	50                   	push   %eax
+  801e63:	ff 75 d4             	push   -0x2c(%ebp)
+  801e66:	6a 00                	push   $0x0
+  801e68:	53                   	push   %ebx
+  801e69:	6a 00                	push   $0x0
+  801e6b:	e8 7f f4 ff ff       	call   8012ef <sys_page_map>
+  801e70:	89 c3                	mov    %eax,%ebx
+  801e72:	83 c4 20             	add    $0x20,%esp
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	79 a4                	jns    801e1d <dup+0x71>
+  801e79:	83 ec 08             	sub    $0x8,%esp
+  801e7c:	56                   	push   %esi
+  801e7d:	6a 00                	push   $0x0
+  801e7f:	e8 fa f4 ff ff       	call   80137e <sys_page_unmap>
+  801e84:	83 c4 08             	add    $0x8,%esp
+  801e87:	ff 75 d4             	push   -0x2c(%ebp)
+  801e8a:	6a 00                	push   $0x0
+  801e8c:	e8 ed f4 ff ff       	call   80137e <sys_page_unmap>
+  801e91:	83 c4 10             	add    $0x10,%esp
+  801e94:	eb b3                	jmp    801e49 <dup+0x9d>
+
+00801e96 <read>:
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	56                   	push   %esi
+  801e9a:	53                   	push   %ebx
+  801e9b:	83 ec 18             	sub    $0x18,%esp
+  801e9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ea1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ea4:	50                   	push   %eax
+  801ea5:	56                   	push   %esi
+  801ea6:	e8 89 fd ff ff       	call   801c34 <fd_lookup>
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	78 3c                	js     801eee <read+0x58>
+  801eb2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801eb5:	83 ec 08             	sub    $0x8,%esp
+  801eb8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ebb:	50                   	push   %eax
+  801ebc:	ff 33                	push   (%ebx)
+  801ebe:	e8 c1 fd ff ff       	call   801c84 <dev_lookup>
+  801ec3:	83 c4 10             	add    $0x10,%esp
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	78 24                	js     801eee <read+0x58>
+  801eca:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ecd:	83 e0 03             	and    $0x3,%eax
+  801ed0:	83 f8 01             	cmp    $0x1,%eax
+  801ed3:	74 20                	je     801ef5 <read+0x5f>
+  801ed5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed8:	8b 40 08             	mov    0x8(%eax),%eax
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	74 37                	je     801f16 <read+0x80>
+  801edf:	83 ec 04             	sub    $0x4,%esp
+  801ee2:	ff 75 10             	push   0x10(%ebp)
+  801ee5:	ff 75 0c             	push   0xc(%ebp)
+  801ee8:	53                   	push   %ebx
+  801ee9:	ff d0                	call   *%eax
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef1:	5b                   	pop    %ebx
+  801ef2:	5e                   	pop    %esi
+  801ef3:	5d                   	pop    %ebp
+  801ef4:	c3                   	ret
+  801ef5:	a1 24 60 80 00       	mov    0x806024,%eax
+  801efa:	8b 40 48             	mov    0x48(%eax),%eax
+  801efd:	83 ec 04             	sub    $0x4,%esp
+  801f00:	56                   	push   %esi
+  801f01:	50                   	push   %eax
+  801f02:	68 91 44 80 00       	push   $0x804491
+  801f07:	e8 49 e8 ff ff       	call   800755 <cprintf>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  801f0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f14:	eb d8                	jmp    801eee <read+0x58>
+  801f16:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f1b:	eb d1                	jmp    801eee <read+0x58>
+
+00801f1d <readn>:
+  801f1d:	55                   	push   %ebp
+  801f1e:	89 e5                	mov    %esp,%ebp
+  801f20:	57                   	push   %edi
+  801f21:	56                   	push   %esi
+  801f22:	53                   	push   %ebx
+  801f23:	83 ec 0c             	sub    $0xc,%esp
+  801f26:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f29:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f2c:	85 f6                	test   %esi,%esi
+  801f2e:	74 30                	je     801f60 <readn+0x43>
+  801f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3a:	83 ec 04             	sub    $0x4,%esp
+  801f3d:	89 f2                	mov    %esi,%edx
+  801f3f:	29 c2                	sub    %eax,%edx
+  801f41:	52                   	push   %edx
+  801f42:	01 f8                	add    %edi,%eax
+  801f44:	50                   	push   %eax
+  801f45:	ff 75 08             	push   0x8(%ebp)
+  801f48:	e8 49 ff ff ff       	call   801e96 <read>
+  801f4d:	83 c4 10             	add    $0x10,%esp
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	78 15                	js     801f69 <readn+0x4c>
+  801f54:	74 11                	je     801f67 <readn+0x4a>
+  801f56:	01 c3                	add    %eax,%ebx
+  801f58:	89 d8                	mov    %ebx,%eax
+  801f5a:	39 f3                	cmp    %esi,%ebx
+  801f5c:	72 dc                	jb     801f3a <readn+0x1d>
+  801f5e:	eb 09                	jmp    801f69 <readn+0x4c>
+  801f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f65:	eb 02                	jmp    801f69 <readn+0x4c>
+  801f67:	89 d8                	mov    %ebx,%eax
+  801f69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f6c:	5b                   	pop    %ebx
+  801f6d:	5e                   	pop    %esi
+  801f6e:	5f                   	pop    %edi
+  801f6f:	5d                   	pop    %ebp
+  801f70:	c3                   	ret
+
+00801f71 <write>:
+  801f71:	55                   	push   %ebp
+  801f72:	89 e5                	mov    %esp,%ebp
+  801f74:	56                   	push   %esi
+  801f75:	53                   	push   %ebx
+  801f76:	83 ec 18             	sub    $0x18,%esp
+  801f79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f7c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f7f:	50                   	push   %eax
+  801f80:	53                   	push   %ebx
+  801f81:	e8 ae fc ff ff       	call   801c34 <fd_lookup>
+  801f86:	83 c4 10             	add    $0x10,%esp
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	78 37                	js     801fc4 <write+0x53>
+  801f8d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f90:	83 ec 08             	sub    $0x8,%esp
+  801f93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f96:	50                   	push   %eax
+  801f97:	ff 36                	push   (%esi)
+  801f99:	e8 e6 fc ff ff       	call   801c84 <dev_lookup>
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	78 1f                	js     801fc4 <write+0x53>
+  801fa5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fa9:	74 20                	je     801fcb <write+0x5a>
+  801fab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fae:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	74 37                	je     801fec <write+0x7b>
+  801fb5:	83 ec 04             	sub    $0x4,%esp
+  801fb8:	ff 75 10             	push   0x10(%ebp)
+  801fbb:	ff 75 0c             	push   0xc(%ebp)
+  801fbe:	56                   	push   %esi
+  801fbf:	ff d0                	call   *%eax
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc7:	5b                   	pop    %ebx
+  801fc8:	5e                   	pop    %esi
+  801fc9:	5d                   	pop    %ebp
+  801fca:	c3                   	ret
+  801fcb:	a1 24 60 80 00       	mov    0x806024,%eax
+  801fd0:	8b 40 48             	mov    0x48(%eax),%eax
+  801fd3:	83 ec 04             	sub    $0x4,%esp
+  801fd6:	53                   	push   %ebx
+  801fd7:	50                   	push   %eax
+  801fd8:	68 ad 44 80 00       	push   $0x8044ad
+  801fdd:	e8 73 e7 ff ff       	call   800755 <cprintf>
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fea:	eb d8                	jmp    801fc4 <write+0x53>
+  801fec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ff1:	eb d1                	jmp    801fc4 <write+0x53>
+
+00801ff3 <seek>:
+  801ff3:	55                   	push   %ebp
+  801ff4:	89 e5                	mov    %esp,%ebp
+  801ff6:	83 ec 20             	sub    $0x20,%esp
+  801ff9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ffc:	50                   	push   %eax
+  801ffd:	ff 75 08             	push   0x8(%ebp)
+  802000:	e8 2f fc ff ff       	call   801c34 <fd_lookup>
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	85 c0                	test   %eax,%eax
+  80200a:	78 0e                	js     80201a <seek+0x27>
+  80200c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80200f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802012:	89 50 04             	mov    %edx,0x4(%eax)
+  802015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201a:	c9                   	leave
+  80201b:	c3                   	ret
+
+0080201c <ftruncate>:
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	56                   	push   %esi
+  802020:	53                   	push   %ebx
+  802021:	83 ec 18             	sub    $0x18,%esp
+  802024:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802027:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80202a:	50                   	push   %eax
+  80202b:	53                   	push   %ebx
+  80202c:	e8 03 fc ff ff       	call   801c34 <fd_lookup>
+  802031:	83 c4 10             	add    $0x10,%esp
+  802034:	85 c0                	test   %eax,%eax
+  802036:	78 34                	js     80206c <ftruncate+0x50>
+  802038:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80203b:	83 ec 08             	sub    $0x8,%esp
+  80203e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802041:	50                   	push   %eax
+  802042:	ff 36                	push   (%esi)
+  802044:	e8 3b fc ff ff       	call   801c84 <dev_lookup>
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 1c                	js     80206c <ftruncate+0x50>
+  802050:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802054:	74 1d                	je     802073 <ftruncate+0x57>
+  802056:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802059:	8b 40 18             	mov    0x18(%eax),%eax
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	74 34                	je     802094 <ftruncate+0x78>
+  802060:	83 ec 08             	sub    $0x8,%esp
+  802063:	ff 75 0c             	push   0xc(%ebp)
+  802066:	56                   	push   %esi
+  802067:	ff d0                	call   *%eax
+  802069:	83 c4 10             	add    $0x10,%esp
+  80206c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80206f:	5b                   	pop    %ebx
+  802070:	5e                   	pop    %esi
+  802071:	5d                   	pop    %ebp
+  802072:	c3                   	ret
+  802073:	a1 24 60 80 00       	mov    0x806024,%eax
+  802078:	8b 40 48             	mov    0x48(%eax),%eax
+  80207b:	83 ec 04             	sub    $0x4,%esp
+  80207e:	53                   	push   %ebx
+  80207f:	50                   	push   %eax
+  802080:	68 70 44 80 00       	push   $0x804470
+  802085:	e8 cb e6 ff ff       	call   800755 <cprintf>
+  80208a:	83 c4 10             	add    $0x10,%esp
+  80208d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802092:	eb d8                	jmp    80206c <ftruncate+0x50>
+  802094:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802099:	eb d1                	jmp    80206c <ftruncate+0x50>
+
+0080209b <fstat>:
+  80209b:	55                   	push   %ebp
+  80209c:	89 e5                	mov    %esp,%ebp
+  80209e:	56                   	push   %esi
+  80209f:	53                   	push   %ebx
+  8020a0:	83 ec 18             	sub    $0x18,%esp
+  8020a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020a9:	50                   	push   %eax
+  8020aa:	ff 75 08             	push   0x8(%ebp)
+  8020ad:	e8 82 fb ff ff       	call   801c34 <fd_lookup>
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	85 c0                	test   %eax,%eax
+  8020b7:	78 49                	js     802102 <fstat+0x67>
+  8020b9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020bc:	83 ec 08             	sub    $0x8,%esp
+  8020bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c2:	50                   	push   %eax
+  8020c3:	ff 36                	push   (%esi)
+  8020c5:	e8 ba fb ff ff       	call   801c84 <dev_lookup>
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	78 31                	js     802102 <fstat+0x67>
+  8020d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020d4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020d8:	74 2f                	je     802109 <fstat+0x6e>
+  8020da:	c6 03 00             	movb   $0x0,(%ebx)
+  8020dd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8020e4:	00 00 00 
+  8020e7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020ee:	00 00 00 
+  8020f1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8020f7:	83 ec 08             	sub    $0x8,%esp
+  8020fa:	53                   	push   %ebx
+  8020fb:	56                   	push   %esi
+  8020fc:	ff 50 14             	call   *0x14(%eax)
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802105:	5b                   	pop    %ebx
+  802106:	5e                   	pop    %esi
+  802107:	5d                   	pop    %ebp
+  802108:	c3                   	ret
+  802109:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80210e:	eb f2                	jmp    802102 <fstat+0x67>
+
+00802110 <stat>:
+  802110:	55                   	push   %ebp
+  802111:	89 e5                	mov    %esp,%ebp
+  802113:	56                   	push   %esi
+  802114:	53                   	push   %ebx
+  802115:	83 ec 08             	sub    $0x8,%esp
+  802118:	6a 00                	push   $0x0
+  80211a:	ff 75 08             	push   0x8(%ebp)
+  80211d:	e8 31 05 00 00       	call   802653 <open>
+  802122:	89 c3                	mov    %eax,%ebx
+  802124:	83 c4 10             	add    $0x10,%esp
+  802127:	85 c0                	test   %eax,%eax
+  802129:	78 1b                	js     802146 <stat+0x36>
+  80212b:	83 ec 08             	sub    $0x8,%esp
+  80212e:	ff 75 0c             	push   0xc(%ebp)
+  802131:	50                   	push   %eax
+  802132:	e8 64 ff ff ff       	call   80209b <fstat>
+  802137:	89 c6                	mov    %eax,%esi
+  802139:	89 1c 24             	mov    %ebx,(%esp)
+  80213c:	e8 19 fc ff ff       	call   801d5a <close>
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	89 f3                	mov    %esi,%ebx
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5d                   	pop    %ebp
+  80214e:	c3                   	ret
+
+0080214f <fsipc>:
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	56                   	push   %esi
+  802153:	53                   	push   %ebx
+  802154:	89 c3                	mov    %eax,%ebx
+  802156:	89 d6                	mov    %edx,%esi
+  802158:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80215f:	74 20                	je     802181 <fsipc+0x32>
+  802161:	83 ec 08             	sub    $0x8,%esp
+  802164:	6a 00                	push   $0x0
+  802166:	56                   	push   %esi
+  802167:	6a 07                	push   $0x7
+  802169:	68 00 70 80 00       	push   $0x807000
+  80216e:	53                   	push   %ebx
+  80216f:	ff 35 08 60 80 00    	push   0x806008
+  802175:	e8 f5 14 00 00       	call   80366f <ipc_call>
+  80217a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217d:	5b                   	pop    %ebx
+  80217e:	5e                   	pop    %esi
+  80217f:	5d                   	pop    %ebp
+  802180:	c3                   	ret
+  802181:	83 ec 0c             	sub    $0xc,%esp
+  802184:	6a 02                	push   $0x2
+  802186:	e8 7f 16 00 00       	call   80380a <ipc_find_env>
+  80218b:	a3 08 60 80 00       	mov    %eax,0x806008
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	eb cc                	jmp    802161 <fsipc+0x12>
+
+00802195 <devfile_trunc>:
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	83 ec 08             	sub    $0x8,%esp
+  80219b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219e:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021a1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a9:	a3 04 70 80 00       	mov    %eax,0x807004
+  8021ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021b8:	e8 92 ff ff ff       	call   80214f <fsipc>
+  8021bd:	c9                   	leave
+  8021be:	c3                   	ret
+
+008021bf <devfile_flush>:
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	83 ec 08             	sub    $0x8,%esp
+  8021c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021cb:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021da:	e8 70 ff ff ff       	call   80214f <fsipc>
+  8021df:	c9                   	leave
+  8021e0:	c3                   	ret
+
+008021e1 <devfile_stat>:
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	53                   	push   %ebx
+  8021e5:	83 ec 04             	sub    $0x4,%esp
+  8021e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021f1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fb:	b8 07 00 00 00       	mov    $0x7,%eax
+  802200:	e8 4a ff ff ff       	call   80214f <fsipc>
+  802205:	85 c0                	test   %eax,%eax
+  802207:	78 2c                	js     802235 <devfile_stat+0x54>
+  802209:	83 ec 08             	sub    $0x8,%esp
+  80220c:	68 00 70 80 00       	push   $0x807000
+  802211:	53                   	push   %ebx
+  802212:	e8 35 ec ff ff       	call   800e4c <strcpy>
+  802217:	a1 80 70 80 00       	mov    0x807080,%eax
+  80221c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802222:	a1 84 70 80 00       	mov    0x807084,%eax
+  802227:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80222d:	83 c4 10             	add    $0x10,%esp
+  802230:	b8 00 00 00 00       	mov    $0x0,%eax
+  802235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802238:	c9                   	leave
+  802239:	c3                   	ret
+
+0080223a <fsring_rw>:
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	57                   	push   %edi
+  80223e:	56                   	push   %esi
+  80223f:	53                   	push   %ebx
+  802240:	83 ec 2c             	sub    $0x2c,%esp
+  802243:	89 c7                	mov    %eax,%edi
+  802245:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802248:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80224b:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802250:	a8 01                	test   $0x1,%al
+  802252:	74 0d                	je     802261 <fsring_rw+0x27>
+  802254:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802259:	a8 01                	test   $0x1,%al
+  80225b:	0f 85 d5 00 00 00    	jne    802336 <fsring_rw+0xfc>
+  802261:	a1 24 60 80 00       	mov    0x806024,%eax
+  802266:	8b 40 48             	mov    0x48(%eax),%eax
+  802269:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  80226f:	0f 84 fc 00 00 00    	je     802371 <fsring_rw+0x137>
+  802275:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  80227c:	0f 84 02 01 00 00    	je     802384 <fsring_rw+0x14a>
+  802282:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802287:	83 ec 04             	sub    $0x4,%esp
+  80228a:	68 07 02 00 00       	push   $0x207
+  80228f:	53                   	push   %ebx
+  802290:	6a 00                	push   $0x0
+  802292:	e8 15 f0 ff ff       	call   8012ac <sys_page_alloc>
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	0f 88 f9 00 00 00    	js     80239b <fsring_rw+0x161>
+  8022a2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022a8:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8022ae:	75 d7                	jne    802287 <fsring_rw+0x4d>
+  8022b0:	6a 0e                	push   $0xe
+  8022b2:	6a 0d                	push   $0xd
+  8022b4:	ff 35 08 60 80 00    	push   0x806008
+  8022ba:	68 00 00 f0 cf       	push   $0xcff00000
+  8022bf:	e8 5f 0f 00 00       	call   803223 <ipcring_init>
+  8022c4:	83 c4 08             	add    $0x8,%esp
+  8022c7:	6a 00                	push   $0x0
+  8022c9:	6a 00                	push   $0x0
+  8022cb:	68 07 02 00 00       	push   $0x207
+  8022d0:	68 00 00 f0 cf       	push   $0xcff00000
+  8022d5:	6a 0b                	push   $0xb
+  8022d7:	ff 35 08 60 80 00    	push   0x806008
+  8022dd:	e8 8d 13 00 00       	call   80366f <ipc_call>
+  8022e2:	89 c6                	mov    %eax,%esi
+  8022e4:	83 c4 20             	add    $0x20,%esp
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	0f 88 ac 00 00 00    	js     80239b <fsring_rw+0x161>
+  8022ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022f4:	89 d9                	mov    %ebx,%ecx
+  8022f6:	83 c3 01             	add    $0x1,%ebx
+  8022f9:	89 da                	mov    %ebx,%edx
+  8022fb:	c1 e2 0c             	shl    $0xc,%edx
+  8022fe:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802304:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80230a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802310:	83 ec 08             	sub    $0x8,%esp
+  802313:	6a 00                	push   $0x0
+  802315:	6a 00                	push   $0x0
+  802317:	68 07 02 00 00       	push   $0x207
+  80231c:	50                   	push   %eax
+  80231d:	6a 0c                	push   $0xc
+  80231f:	ff 35 08 60 80 00    	push   0x806008
+  802325:	e8 45 13 00 00       	call   80366f <ipc_call>
+  80232a:	83 c4 20             	add    $0x20,%esp
+  80232d:	85 c0                	test   %eax,%eax
+  80232f:	78 6a                	js     80239b <fsring_rw+0x161>
+  802331:	83 fb 08             	cmp    $0x8,%ebx
+  802334:	75 be                	jne    8022f4 <fsring_rw+0xba>
+  802336:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80233a:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80233f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802344:	0f 45 c2             	cmovne %edx,%eax
+  802347:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80234a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802351:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802358:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  80235f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802364:	be 00 00 00 00       	mov    $0x0,%esi
+  802369:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80236c:	e9 4b 01 00 00       	jmp    8024bc <fsring_rw+0x282>
+  802371:	e8 00 f3 ff ff       	call   801676 <sys_time_msec>
+  802376:	3b 05 00 60 80 00    	cmp    0x806000,%eax
+  80237c:	0f 89 f3 fe ff ff    	jns    802275 <fsring_rw+0x3b>
+  802382:	eb 54                	jmp    8023d8 <fsring_rw+0x19e>
+  802384:	83 ec 0c             	sub    $0xc,%esp
+  802387:	6a 02                	push   $0x2
+  802389:	e8 7c 14 00 00       	call   80380a <ipc_find_env>
+  80238e:	a3 08 60 80 00       	mov    %eax,0x806008
+  802393:	83 c4 10             	add    $0x10,%esp
+  802396:	e9 e7 fe ff ff       	jmp    802282 <fsring_rw+0x48>
+  80239b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8023a0:	83 ec 08             	sub    $0x8,%esp
+  8023a3:	53                   	push   %ebx
+  8023a4:	6a 00                	push   $0x0
+  8023a6:	e8 d3 ef ff ff       	call   80137e <sys_page_unmap>
+  8023ab:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8023ba:	75 e4                	jne    8023a0 <fsring_rw+0x166>
+  8023bc:	e8 b5 f2 ff ff       	call   801676 <sys_time_msec>
+  8023c1:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8023c6:	a3 00 60 80 00       	mov    %eax,0x806000
+  8023cb:	a1 24 60 80 00       	mov    0x806024,%eax
+  8023d0:	8b 40 48             	mov    0x48(%eax),%eax
+  8023d3:	a3 04 60 80 00       	mov    %eax,0x806004
+  8023d8:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8023df:	e9 7a 01 00 00       	jmp    80255e <fsring_rw+0x324>
+  8023e4:	8b 57 0c             	mov    0xc(%edi),%edx
+  8023e7:	89 10                	mov    %edx,(%eax)
+  8023e9:	89 58 04             	mov    %ebx,0x4(%eax)
+  8023ec:	89 f2                	mov    %esi,%edx
+  8023ee:	03 57 04             	add    0x4(%edi),%edx
+  8023f1:	89 50 08             	mov    %edx,0x8(%eax)
+  8023f4:	83 ec 04             	sub    $0x4,%esp
+  8023f7:	53                   	push   %ebx
+  8023f8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8023fb:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8023fe:	52                   	push   %edx
+  8023ff:	83 c0 0c             	add    $0xc,%eax
+  802402:	50                   	push   %eax
+  802403:	e8 f4 eb ff ff       	call   800ffc <memmove>
+  802408:	83 c4 10             	add    $0x10,%esp
+  80240b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80240e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802411:	89 08                	mov    %ecx,(%eax)
+  802413:	83 ec 0c             	sub    $0xc,%esp
+  802416:	68 00 00 f0 cf       	push   $0xcff00000
+  80241b:	e8 61 0e 00 00       	call   803281 <ipcring_req_push>
+  802420:	01 de                	add    %ebx,%esi
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802428:	73 4c                	jae    802476 <fsring_rw+0x23c>
+  80242a:	83 ec 0c             	sub    $0xc,%esp
+  80242d:	68 00 00 f0 cf       	push   $0xcff00000
+  802432:	e8 24 0e 00 00       	call   80325b <ipcring_req_slot>
+  802437:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80243a:	83 c4 10             	add    $0x10,%esp
+  80243d:	85 c0                	test   %eax,%eax
+  80243f:	74 35                	je     802476 <fsring_rw+0x23c>
+  802441:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802446:	83 e0 07             	and    $0x7,%eax
+  802449:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80244e:	c1 e0 0c             	shl    $0xc,%eax
+  802451:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802454:	29 f3                	sub    %esi,%ebx
+  802456:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802459:	39 cb                	cmp    %ecx,%ebx
+  80245b:	0f 47 d9             	cmova  %ecx,%ebx
+  80245e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802462:	75 80                	jne    8023e4 <fsring_rw+0x1aa>
+  802464:	8b 57 0c             	mov    0xc(%edi),%edx
+  802467:	89 10                	mov    %edx,(%eax)
+  802469:	89 58 04             	mov    %ebx,0x4(%eax)
+  80246c:	89 f2                	mov    %esi,%edx
+  80246e:	03 57 04             	add    0x4(%edi),%edx
+  802471:	89 50 08             	mov    %edx,0x8(%eax)
+  802474:	eb 95                	jmp    80240b <fsring_rw+0x1d1>
+  802476:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80247b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80247e:	83 ec 0c             	sub    $0xc,%esp
+  802481:	68 00 00 f0 cf       	push   $0xcff00000
+  802486:	e8 2f 0e 00 00       	call   8032ba <ipcring_rsp_wait>
+  80248b:	8b 58 04             	mov    0x4(%eax),%ebx
+  80248e:	83 c4 10             	add    $0x10,%esp
+  802491:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802495:	75 45                	jne    8024dc <fsring_rw+0x2a2>
+  802497:	85 db                	test   %ebx,%ebx
+  802499:	79 41                	jns    8024dc <fsring_rw+0x2a2>
+  80249b:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80249e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8024a5:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8024ac:	83 ec 0c             	sub    $0xc,%esp
+  8024af:	68 00 00 f0 cf       	push   $0xcff00000
+  8024b4:	e8 67 0e 00 00       	call   803320 <ipcring_rsp_pop>
+  8024b9:	83 c4 10             	add    $0x10,%esp
+  8024bc:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8024c2:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8024c7:	39 c2                	cmp    %eax,%edx
+  8024c9:	74 75                	je     802540 <fsring_rw+0x306>
+  8024cb:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8024cf:	75 a5                	jne    802476 <fsring_rw+0x23c>
+  8024d1:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8024d4:	0f 82 50 ff ff ff    	jb     80242a <fsring_rw+0x1f0>
+  8024da:	eb 9a                	jmp    802476 <fsring_rw+0x23c>
+  8024dc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8024e0:	75 ca                	jne    8024ac <fsring_rw+0x272>
+  8024e2:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8024e6:	74 31                	je     802519 <fsring_rw+0x2df>
+  8024e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024eb:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8024ee:	29 c8                	sub    %ecx,%eax
+  8024f0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8024f3:	39 d0                	cmp    %edx,%eax
+  8024f5:	0f 47 c2             	cmova  %edx,%eax
+  8024f8:	39 d8                	cmp    %ebx,%eax
+  8024fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8024ff:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802503:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802506:	b8 01 00 00 00       	mov    $0x1,%eax
+  80250b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80250f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802512:	01 d9                	add    %ebx,%ecx
+  802514:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802517:	eb 93                	jmp    8024ac <fsring_rw+0x272>
+  802519:	83 ec 04             	sub    $0x4,%esp
+  80251c:	53                   	push   %ebx
+  80251d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802520:	83 e0 07             	and    $0x7,%eax
+  802523:	c1 e0 0c             	shl    $0xc,%eax
+  802526:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80252c:	50                   	push   %eax
+  80252d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802530:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802533:	01 c8                	add    %ecx,%eax
+  802535:	50                   	push   %eax
+  802536:	e8 c1 ea ff ff       	call   800ffc <memmove>
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	eb a8                	jmp    8024e8 <fsring_rw+0x2ae>
+  802540:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802544:	75 09                	jne    80254f <fsring_rw+0x315>
+  802546:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802549:	0f 82 db fe ff ff    	jb     80242a <fsring_rw+0x1f0>
+  80254f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802552:	01 57 04             	add    %edx,0x4(%edi)
+  802555:	85 d2                	test   %edx,%edx
+  802557:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80255b:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80255e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802564:	5b                   	pop    %ebx
+  802565:	5e                   	pop    %esi
+  802566:	5f                   	pop    %edi
+  802567:	5d                   	pop    %ebp
+  802568:	c3                   	ret
+
+00802569 <devfile_write>:
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	57                   	push   %edi
+  80256d:	56                   	push   %esi
+  80256e:	53                   	push   %ebx
+  80256f:	83 ec 0c             	sub    $0xc,%esp
+  802572:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802575:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802578:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80257b:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802581:	76 1a                	jbe    80259d <devfile_write+0x34>
+  802583:	83 ec 0c             	sub    $0xc,%esp
+  802586:	53                   	push   %ebx
+  802587:	89 f1                	mov    %esi,%ecx
+  802589:	ba 06 00 00 00       	mov    $0x6,%edx
+  80258e:	89 f8                	mov    %edi,%eax
+  802590:	e8 a5 fc ff ff       	call   80223a <fsring_rw>
+  802595:	83 c4 10             	add    $0x10,%esp
+  802598:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80259b:	75 39                	jne    8025d6 <devfile_write+0x6d>
+  80259d:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8025a2:	39 c3                	cmp    %eax,%ebx
+  8025a4:	0f 47 d8             	cmova  %eax,%ebx
+  8025a7:	8b 47 0c             	mov    0xc(%edi),%eax
+  8025aa:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025af:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8025b5:	83 ec 04             	sub    $0x4,%esp
+  8025b8:	53                   	push   %ebx
+  8025b9:	56                   	push   %esi
+  8025ba:	68 08 70 80 00       	push   $0x807008
+  8025bf:	e8 38 ea ff ff       	call   800ffc <memmove>
+  8025c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025ce:	e8 7c fb ff ff       	call   80214f <fsipc>
+  8025d3:	83 c4 10             	add    $0x10,%esp
+  8025d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d9:	5b                   	pop    %ebx
+  8025da:	5e                   	pop    %esi
+  8025db:	5f                   	pop    %edi
+  8025dc:	5d                   	pop    %ebp
+  8025dd:	c3                   	ret
+
+008025de <devfile_read>:
+  8025de:	55                   	push   %ebp
+  8025df:	89 e5                	mov    %esp,%ebp
+  8025e1:	57                   	push   %edi
+  8025e2:	56                   	push   %esi
+  8025e3:	53                   	push   %ebx
+  8025e4:	83 ec 0c             	sub    $0xc,%esp
+  8025e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025ea:	8b 75 10             	mov    0x10(%ebp),%esi
+  8025ed:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8025f3:	76 1d                	jbe    802612 <devfile_read+0x34>
+  8025f5:	83 ec 0c             	sub    $0xc,%esp
+  8025f8:	56                   	push   %esi
+  8025f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025fc:	ba 05 00 00 00       	mov    $0x5,%edx
+  802601:	89 f8                	mov    %edi,%eax
+  802603:	e8 32 fc ff ff       	call   80223a <fsring_rw>
+  802608:	89 c3                	mov    %eax,%ebx
+  80260a:	83 c4 10             	add    $0x10,%esp
+  80260d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802610:	75 37                	jne    802649 <devfile_read+0x6b>
+  802612:	8b 47 0c             	mov    0xc(%edi),%eax
+  802615:	a3 00 70 80 00       	mov    %eax,0x807000
+  80261a:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802620:	ba 00 00 00 00       	mov    $0x0,%edx
+  802625:	b8 03 00 00 00       	mov    $0x3,%eax
+  80262a:	e8 20 fb ff ff       	call   80214f <fsipc>
+  80262f:	89 c3                	mov    %eax,%ebx
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 14                	js     802649 <devfile_read+0x6b>
+  802635:	83 ec 04             	sub    $0x4,%esp
+  802638:	50                   	push   %eax
+  802639:	68 00 70 80 00       	push   $0x807000
+  80263e:	ff 75 0c             	push   0xc(%ebp)
+  802641:	e8 b6 e9 ff ff       	call   800ffc <memmove>
+  802646:	83 c4 10             	add    $0x10,%esp
+  802649:	89 d8                	mov    %ebx,%eax
+  80264b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264e:	5b                   	pop    %ebx
+  80264f:	5e                   	pop    %esi
+  802650:	5f                   	pop    %edi
+  802651:	5d                   	pop    %ebp
+  802652:	c3                   	ret
+
+00802653 <open>:
+  802653:	55                   	push   %ebp
+  802654:	89 e5                	mov    %esp,%ebp
+  802656:	56                   	push   %esi
+  802657:	53                   	push   %ebx
+  802658:	83 ec 1c             	sub    $0x1c,%esp
+  80265b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80265e:	56                   	push   %esi
+  80265f:	e8 9c e7 ff ff       	call   800e00 <strlen>
+  802664:	83 c4 10             	add    $0x10,%esp
+  802667:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80266c:	7f 6c                	jg     8026da <open+0x87>
+  80266e:	83 ec 0c             	sub    $0xc,%esp
+  802671:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802674:	50                   	push   %eax
+  802675:	e8 6a f5 ff ff       	call   801be4 <fd_alloc>
+  80267a:	89 c3                	mov    %eax,%ebx
+  80267c:	83 c4 10             	add    $0x10,%esp
+  80267f:	85 c0                	test   %eax,%eax
+  802681:	78 3c                	js     8026bf <open+0x6c>
+  802683:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802686:	a3 00 74 80 00       	mov    %eax,0x807400
+  80268b:	83 ec 08             	sub    $0x8,%esp
+  80268e:	56                   	push   %esi
+  80268f:	68 00 70 80 00       	push   $0x807000
+  802694:	e8 b3 e7 ff ff       	call   800e4c <strcpy>
+  802699:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80269c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026a1:	e8 a9 fa ff ff       	call   80214f <fsipc>
+  8026a6:	89 c3                	mov    %eax,%ebx
+  8026a8:	83 c4 10             	add    $0x10,%esp
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	78 19                	js     8026c8 <open+0x75>
+  8026af:	83 ec 0c             	sub    $0xc,%esp
+  8026b2:	ff 75 f4             	push   -0xc(%ebp)
+  8026b5:	e8 03 f5 ff ff       	call   801bbd <fd2num>
+  8026ba:	89 c3                	mov    %eax,%ebx
+  8026bc:	83 c4 10             	add    $0x10,%esp
+  8026bf:	89 d8                	mov    %ebx,%eax
+  8026c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c4:	5b                   	pop    %ebx
+  8026c5:	5e                   	pop    %esi
+  8026c6:	5d                   	pop    %ebp
+  8026c7:	c3                   	ret
+  8026c8:	83 ec 08             	sub    $0x8,%esp
+  8026cb:	6a 00                	push   $0x0
+  8026cd:	ff 75 f4             	push   -0xc(%ebp)
+  8026d0:	e8 05 f6 ff ff       	call   801cda <fd_close>
+  8026d5:	83 c4 10             	add    $0x10,%esp
+  8026d8:	eb e5                	jmp    8026bf <open+0x6c>
+  8026da:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8026df:	eb de                	jmp    8026bf <open+0x6c>
+
+008026e1 <file_image>:
+  8026e1:	55                   	push   %ebp
+  8026e2:	89 e5                	mov    %esp,%ebp
+  8026e4:	53                   	push   %ebx
+  8026e5:	83 ec 1c             	sub    $0x1c,%esp
+  8026e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ee:	50                   	push   %eax
+  8026ef:	ff 75 08             	push   0x8(%ebp)
+  8026f2:	e8 3d f5 ff ff       	call   801c34 <fd_lookup>
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	78 58                	js     802756 <file_image+0x75>
+  8026fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802701:	8b 0d 24 50 80 00    	mov    0x805024,%ecx
+  802707:	39 08                	cmp    %ecx,(%eax)
+  802709:	75 50                	jne    80275b <file_image+0x7a>
+  80270b:	83 fb 04             	cmp    $0x4,%ebx
+  80270e:	77 52                	ja     802762 <file_image+0x81>
+  802710:	8b 40 0c             	mov    0xc(%eax),%eax
+  802713:	a3 00 70 80 00       	mov    %eax,0x807000
+  802718:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80271e:	83 ec 04             	sub    $0x4,%esp
+  802721:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802724:	c1 e0 02             	shl    $0x2,%eax
+  802727:	50                   	push   %eax
+  802728:	ff 75 0c             	push   0xc(%ebp)
+  80272b:	68 08 70 80 00       	push   $0x807008
+  802730:	e8 c7 e8 ff ff       	call   800ffc <memmove>
+  802735:	ba 00 00 00 00       	mov    $0x0,%edx
+  80273a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80273f:	e8 0b fa ff ff       	call   80214f <fsipc>
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	85 c0                	test   %eax,%eax
+  802749:	78 0b                	js     802756 <file_image+0x75>
+  80274b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80274e:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802754:	89 0a                	mov    %ecx,(%edx)
+  802756:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802759:	c9                   	leave
+  80275a:	c3                   	ret
+  80275b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802760:	eb f4                	jmp    802756 <file_image+0x75>
+  802762:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802767:	eb ed                	jmp    802756 <file_image+0x75>
+
+00802769 <remove>:
+  802769:	55                   	push   %ebp
+  80276a:	89 e5                	mov    %esp,%ebp
+  80276c:	53                   	push   %ebx
+  80276d:	83 ec 10             	sub    $0x10,%esp
+  802770:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802773:	53                   	push   %ebx
+  802774:	e8 87 e6 ff ff       	call   800e00 <strlen>
+  802779:	83 c4 10             	add    $0x10,%esp
+  80277c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802781:	7f 25                	jg     8027a8 <remove+0x3f>
+  802783:	83 ec 08             	sub    $0x8,%esp
+  802786:	53                   	push   %ebx
+  802787:	68 00 70 80 00       	push   $0x807000
+  80278c:	e8 bb e6 ff ff       	call   800e4c <strcpy>
+  802791:	ba 00 00 00 00       	mov    $0x0,%edx
+  802796:	b8 09 00 00 00       	mov    $0x9,%eax
+  80279b:	e8 af f9 ff ff       	call   80214f <fsipc>
+  8027a0:	83 c4 10             	add    $0x10,%esp
+  8027a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027a6:	c9                   	leave
+  8027a7:	c3                   	ret
+  8027a8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8027ad:	eb f4                	jmp    8027a3 <remove+0x3a>
+
+008027af <sync>:
+  8027af:	55                   	push   %ebp
+  8027b0:	89 e5                	mov    %esp,%ebp
+  8027b2:	83 ec 08             	sub    $0x8,%esp
+  8027b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8027bf:	e8 8b f9 ff ff       	call   80214f <fsipc>
+  8027c4:	c9                   	leave
+  8027c5:	c3                   	ret
+
+008027c6 <devsock_stat>:
+  8027c6:	55                   	push   %ebp
+  8027c7:	89 e5                	mov    %esp,%ebp
+  8027c9:	83 ec 10             	sub    $0x10,%esp
+  8027cc:	68 e0 44 80 00       	push   $0x8044e0
+  8027d1:	ff 75 0c             	push   0xc(%ebp)
+  8027d4:	e8 73 e6 ff ff       	call   800e4c <strcpy>
+  8027d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027de:	c9                   	leave
+  8027df:	c3                   	ret
+
+008027e0 <devsock_close>:
+  8027e0:	55                   	push   %ebp
+  8027e1:	89 e5                	mov    %esp,%ebp
+  8027e3:	53                   	push   %ebx
+  8027e4:	83 ec 10             	sub    $0x10,%esp
+  8027e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027ea:	53                   	push   %ebx
+  8027eb:	e8 34 10 00 00       	call   803824 <pageref>
+  8027f0:	89 c2                	mov    %eax,%edx
+  8027f2:	83 c4 10             	add    $0x10,%esp
+  8027f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fa:	83 fa 01             	cmp    $0x1,%edx
+  8027fd:	74 05                	je     802804 <devsock_close+0x24>
+  8027ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802802:	c9                   	leave
+  802803:	c3                   	ret
+  802804:	83 ec 0c             	sub    $0xc,%esp
+  802807:	ff 73 0c             	push   0xc(%ebx)
+  80280a:	e8 aa 02 00 00       	call   802ab9 <nsipc_close>
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	eb eb                	jmp    8027ff <devsock_close+0x1f>
+
+00802814 <devsock_write>:
+  802814:	55                   	push   %ebp
+  802815:	89 e5                	mov    %esp,%ebp
+  802817:	83 ec 08             	sub    $0x8,%esp
+  80281a:	6a 00                	push   $0x0
+  80281c:	ff 75 10             	push   0x10(%ebp)
+  80281f:	ff 75 0c             	push   0xc(%ebp)
+  802822:	8b 45 08             	mov    0x8(%ebp),%eax
+  802825:	ff 70 0c             	push   0xc(%eax)
+  802828:	e8 6c 03 00 00       	call   802b99 <nsipc_send>
+  80282d:	c9                   	leave
+  80282e:	c3                   	ret
+
+0080282f <devsock_read>:
+  80282f:	55                   	push   %ebp
+  802830:	89 e5                	mov    %esp,%ebp
+  802832:	83 ec 08             	sub    $0x8,%esp
+  802835:	6a 00                	push   $0x0
+  802837:	ff 75 10             	push   0x10(%ebp)
+  80283a:	ff 75 0c             	push   0xc(%ebp)
+  80283d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802840:	ff 70 0c             	push   0xc(%eax)
+  802843:	e8 e2 02 00 00       	call   802b2a <nsipc_recv>
+  802848:	c9                   	leave
+  802849:	c3                   	ret
+
+0080284a <fd2sockid>:
+  80284a:	55                   	push   %ebp
+  80284b:	89 e5                	mov    %esp,%ebp
+  80284d:	83 ec 20             	sub    $0x20,%esp
+  802850:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802853:	52                   	push   %edx
+  802854:	50                   	push   %eax
+  802855:	e8 da f3 ff ff       	call   801c34 <fd_lookup>
+  80285a:	83 c4 10             	add    $0x10,%esp
+  80285d:	85 c0                	test   %eax,%eax
+  80285f:	78 10                	js     802871 <fd2sockid+0x27>
+  802861:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802864:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  80286a:	39 08                	cmp    %ecx,(%eax)
+  80286c:	75 05                	jne    802873 <fd2sockid+0x29>
+  80286e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802871:	c9                   	leave
+  802872:	c3                   	ret
+  802873:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802878:	eb f7                	jmp    802871 <fd2sockid+0x27>
+
+0080287a <alloc_sockfd>:
+  80287a:	55                   	push   %ebp
+  80287b:	89 e5                	mov    %esp,%ebp
+  80287d:	56                   	push   %esi
+  80287e:	53                   	push   %ebx
+  80287f:	83 ec 1c             	sub    $0x1c,%esp
+  802882:	89 c6                	mov    %eax,%esi
+  802884:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802887:	50                   	push   %eax
+  802888:	e8 57 f3 ff ff       	call   801be4 <fd_alloc>
+  80288d:	89 c3                	mov    %eax,%ebx
+  80288f:	83 c4 10             	add    $0x10,%esp
+  802892:	85 c0                	test   %eax,%eax
+  802894:	78 43                	js     8028d9 <alloc_sockfd+0x5f>
+  802896:	83 ec 04             	sub    $0x4,%esp
+  802899:	68 07 04 00 00       	push   $0x407
+  80289e:	ff 75 f4             	push   -0xc(%ebp)
+  8028a1:	6a 00                	push   $0x0
+  8028a3:	e8 04 ea ff ff       	call   8012ac <sys_page_alloc>
+  8028a8:	89 c3                	mov    %eax,%ebx
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	78 28                	js     8028d9 <alloc_sockfd+0x5f>
+  8028b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b4:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8028ba:	89 10                	mov    %edx,(%eax)
+  8028bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028bf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8028c6:	89 70 0c             	mov    %esi,0xc(%eax)
+  8028c9:	83 ec 0c             	sub    $0xc,%esp
+  8028cc:	50                   	push   %eax
+  8028cd:	e8 eb f2 ff ff       	call   801bbd <fd2num>
+  8028d2:	89 c3                	mov    %eax,%ebx
+  8028d4:	83 c4 10             	add    $0x10,%esp
+  8028d7:	eb 0c                	jmp    8028e5 <alloc_sockfd+0x6b>
+  8028d9:	83 ec 0c             	sub    $0xc,%esp
+  8028dc:	56                   	push   %esi
+  8028dd:	e8 d7 01 00 00       	call   802ab9 <nsipc_close>
+  8028e2:	83 c4 10             	add    $0x10,%esp
+  8028e5:	89 d8                	mov    %ebx,%eax
+  8028e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ea:	5b                   	pop    %ebx
+  8028eb:	5e                   	pop    %esi
+  8028ec:	5d                   	pop    %ebp
+  8028ed:	c3                   	ret
+
+008028ee <accept>:
+  8028ee:	55                   	push   %ebp
+  8028ef:	89 e5                	mov    %esp,%ebp
+  8028f1:	83 ec 08             	sub    $0x8,%esp
+  8028f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f7:	e8 4e ff ff ff       	call   80284a <fd2sockid>
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	78 1b                	js     80291b <accept+0x2d>
+  802900:	83 ec 04             	sub    $0x4,%esp
+  802903:	ff 75 10             	push   0x10(%ebp)
+  802906:	ff 75 0c             	push   0xc(%ebp)
+  802909:	50                   	push   %eax
+  80290a:	e8 07 01 00 00       	call   802a16 <nsipc_accept>
+  80290f:	83 c4 10             	add    $0x10,%esp
+  802912:	85 c0                	test   %eax,%eax
+  802914:	78 05                	js     80291b <accept+0x2d>
+  802916:	e8 5f ff ff ff       	call   80287a <alloc_sockfd>
+  80291b:	c9                   	leave
+  80291c:	c3                   	ret
+
+0080291d <bind>:
+  80291d:	55                   	push   %ebp
+  80291e:	89 e5                	mov    %esp,%ebp
+  802920:	83 ec 08             	sub    $0x8,%esp
+  802923:	8b 45 08             	mov    0x8(%ebp),%eax
+  802926:	e8 1f ff ff ff       	call   80284a <fd2sockid>
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	78 12                	js     802941 <bind+0x24>
+  80292f:	83 ec 04             	sub    $0x4,%esp
+  802932:	ff 75 10             	push   0x10(%ebp)
+  802935:	ff 75 0c             	push   0xc(%ebp)
+  802938:	50                   	push   %eax
+  802939:	e8 24 01 00 00       	call   802a62 <nsipc_bind>
+  80293e:	83 c4 10             	add    $0x10,%esp
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+00802943 <shutdown>:
+  802943:	55                   	push   %ebp
+  802944:	89 e5                	mov    %esp,%ebp
+  802946:	83 ec 08             	sub    $0x8,%esp
+  802949:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294c:	e8 f9 fe ff ff       	call   80284a <fd2sockid>
+  802951:	85 c0                	test   %eax,%eax
+  802953:	78 0f                	js     802964 <shutdown+0x21>
+  802955:	83 ec 08             	sub    $0x8,%esp
+  802958:	ff 75 0c             	push   0xc(%ebp)
+  80295b:	50                   	push   %eax
+  80295c:	e8 36 01 00 00       	call   802a97 <nsipc_shutdown>
+  802961:	83 c4 10             	add    $0x10,%esp
+  802964:	c9                   	leave
+  802965:	c3                   	ret
+
+00802966 <connect>:
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	83 ec 08             	sub    $0x8,%esp
+  80296c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296f:	e8 d6 fe ff ff       	call   80284a <fd2sockid>
+  802974:	85 c0                	test   %eax,%eax
+  802976:	78 12                	js     80298a <connect+0x24>
+  802978:	83 ec 04             	sub    $0x4,%esp
+  80297b:	ff 75 10             	push   0x10(%ebp)
+  80297e:	ff 75 0c             	push   0xc(%ebp)
+  802981:	50                   	push   %eax
+  802982:	e8 4c 01 00 00       	call   802ad3 <nsipc_connect>
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <listen>:
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	83 ec 08             	sub    $0x8,%esp
+  802992:	8b 45 08             	mov    0x8(%ebp),%eax
+  802995:	e8 b0 fe ff ff       	call   80284a <fd2sockid>
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 0f                	js     8029ad <listen+0x21>
+  80299e:	83 ec 08             	sub    $0x8,%esp
+  8029a1:	ff 75 0c             	push   0xc(%ebp)
+  8029a4:	50                   	push   %eax
+  8029a5:	e8 5e 01 00 00       	call   802b08 <nsipc_listen>
+  8029aa:	83 c4 10             	add    $0x10,%esp
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+
+008029af <socket>:
+  8029af:	55                   	push   %ebp
+  8029b0:	89 e5                	mov    %esp,%ebp
+  8029b2:	83 ec 0c             	sub    $0xc,%esp
+  8029b5:	ff 75 10             	push   0x10(%ebp)
+  8029b8:	ff 75 0c             	push   0xc(%ebp)
+  8029bb:	ff 75 08             	push   0x8(%ebp)
+  8029be:	e8 34 02 00 00       	call   802bf7 <nsipc_socket>
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	85 c0                	test   %eax,%eax
+  8029c8:	78 05                	js     8029cf <socket+0x20>
+  8029ca:	e8 ab fe ff ff       	call   80287a <alloc_sockfd>
+  8029cf:	c9                   	leave
+  8029d0:	c3                   	ret
+
+008029d1 <nsipc>:
+  8029d1:	55                   	push   %ebp
+  8029d2:	89 e5                	mov    %esp,%ebp
+  8029d4:	53                   	push   %ebx
+  8029d5:	83 ec 04             	sub    $0x4,%esp
+  8029d8:	89 c3                	mov    %eax,%ebx
+  8029da:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  8029e1:	74 1f                	je     802a02 <nsipc+0x31>
+  8029e3:	83 ec 08             	sub    $0x8,%esp
+  8029e6:	6a 00                	push   $0x0
+  8029e8:	6a 00                	push   $0x0
+  8029ea:	6a 07                	push   $0x7
+  8029ec:	68 00 80 80 00       	push   $0x808000
+  8029f1:	53                   	push   %ebx
+  8029f2:	ff 35 0c 60 80 00    	push   0x80600c
+  8029f8:	e8 72 0c 00 00       	call   80366f <ipc_call>
+  8029fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+  802a02:	83 ec 0c             	sub    $0xc,%esp
+  802a05:	6a 03                	push   $0x3
+  802a07:	e8 fe 0d 00 00       	call   80380a <ipc_find_env>
+  802a0c:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802a11:	83 c4 10             	add    $0x10,%esp
+  802a14:	eb cd                	jmp    8029e3 <nsipc+0x12>
+
+00802a16 <nsipc_accept>:
+  802a16:	55                   	push   %ebp
+  802a17:	89 e5                	mov    %esp,%ebp
+  802a19:	53                   	push   %ebx
+  802a1a:	83 ec 04             	sub    $0x4,%esp
+  802a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a20:	a3 00 80 80 00       	mov    %eax,0x808000
+  802a25:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a2a:	e8 a2 ff ff ff       	call   8029d1 <nsipc>
+  802a2f:	89 c3                	mov    %eax,%ebx
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	79 07                	jns    802a3c <nsipc_accept+0x26>
+  802a35:	89 d8                	mov    %ebx,%eax
+  802a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+  802a3c:	83 ec 04             	sub    $0x4,%esp
+  802a3f:	ff 35 10 80 80 00    	push   0x808010
+  802a45:	68 00 80 80 00       	push   $0x808000
+  802a4a:	ff 75 0c             	push   0xc(%ebp)
+  802a4d:	e8 aa e5 ff ff       	call   800ffc <memmove>
+  802a52:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a58:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a5b:	89 10                	mov    %edx,(%eax)
+  802a5d:	83 c4 10             	add    $0x10,%esp
+  802a60:	eb d3                	jmp    802a35 <nsipc_accept+0x1f>
+
+00802a62 <nsipc_bind>:
+  802a62:	55                   	push   %ebp
+  802a63:	89 e5                	mov    %esp,%ebp
+  802a65:	53                   	push   %ebx
+  802a66:	83 ec 08             	sub    $0x8,%esp
+  802a69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6f:	a3 00 80 80 00       	mov    %eax,0x808000
+  802a74:	53                   	push   %ebx
+  802a75:	ff 75 0c             	push   0xc(%ebp)
+  802a78:	68 04 80 80 00       	push   $0x808004
+  802a7d:	e8 7a e5 ff ff       	call   800ffc <memmove>
+  802a82:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802a88:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a8d:	e8 3f ff ff ff       	call   8029d1 <nsipc>
+  802a92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+00802a97 <nsipc_shutdown>:
+  802a97:	55                   	push   %ebp
+  802a98:	89 e5                	mov    %esp,%ebp
+  802a9a:	83 ec 08             	sub    $0x8,%esp
+  802a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa0:	a3 00 80 80 00       	mov    %eax,0x808000
+  802aa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aa8:	a3 04 80 80 00       	mov    %eax,0x808004
+  802aad:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ab2:	e8 1a ff ff ff       	call   8029d1 <nsipc>
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+
+00802ab9 <nsipc_close>:
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	83 ec 08             	sub    $0x8,%esp
+  802abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac2:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ac7:	b8 04 00 00 00       	mov    $0x4,%eax
+  802acc:	e8 00 ff ff ff       	call   8029d1 <nsipc>
+  802ad1:	c9                   	leave
+  802ad2:	c3                   	ret
+
+00802ad3 <nsipc_connect>:
+  802ad3:	55                   	push   %ebp
+  802ad4:	89 e5                	mov    %esp,%ebp
+  802ad6:	53                   	push   %ebx
+  802ad7:	83 ec 08             	sub    $0x8,%esp
+  802ada:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802add:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae0:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ae5:	53                   	push   %ebx
+  802ae6:	ff 75 0c             	push   0xc(%ebp)
+  802ae9:	68 04 80 80 00       	push   $0x808004
+  802aee:	e8 09 e5 ff ff       	call   800ffc <memmove>
+  802af3:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802af9:	b8 05 00 00 00       	mov    $0x5,%eax
+  802afe:	e8 ce fe ff ff       	call   8029d1 <nsipc>
+  802b03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b06:	c9                   	leave
+  802b07:	c3                   	ret
+
+00802b08 <nsipc_listen>:
+  802b08:	55                   	push   %ebp
+  802b09:	89 e5                	mov    %esp,%ebp
+  802b0b:	83 ec 08             	sub    $0x8,%esp
+  802b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b11:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b19:	a3 04 80 80 00       	mov    %eax,0x808004
+  802b1e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b23:	e8 a9 fe ff ff       	call   8029d1 <nsipc>
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+00802b2a <nsipc_recv>:
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	56                   	push   %esi
+  802b2e:	53                   	push   %ebx
+  802b2f:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b32:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b35:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b3a:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802b40:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b43:	a3 08 80 80 00       	mov    %eax,0x808008
+  802b48:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b4d:	e8 7f fe ff ff       	call   8029d1 <nsipc>
+  802b52:	89 c3                	mov    %eax,%ebx
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	78 22                	js     802b7a <nsipc_recv+0x50>
+  802b58:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b5d:	39 c6                	cmp    %eax,%esi
+  802b5f:	0f 4e c6             	cmovle %esi,%eax
+  802b62:	39 c3                	cmp    %eax,%ebx
+  802b64:	7f 1d                	jg     802b83 <nsipc_recv+0x59>
+  802b66:	83 ec 04             	sub    $0x4,%esp
+  802b69:	53                   	push   %ebx
+  802b6a:	68 00 80 80 00       	push   $0x808000
+  802b6f:	ff 75 0c             	push   0xc(%ebp)
+  802b72:	e8 85 e4 ff ff       	call   800ffc <memmove>
+  802b77:	83 c4 10             	add    $0x10,%esp
+  802b7a:	89 d8                	mov    %ebx,%eax
+  802b7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b7f:	5b                   	pop    %ebx
+  802b80:	5e                   	pop    %esi
+  802b81:	5d                   	pop    %ebp
+  802b82:	c3                   	ret
+  802b83:	68 ec 44 80 00       	push   $0x8044ec
+  802b88:	68 01 45 80 00       	push   $0x804501
+  802b8d:	6a 60                	push   $0x60
+  802b8f:	68 16 45 80 00       	push   $0x804516
+  802b94:	e8 e1 da ff ff       	call   80067a <_panic>
+
+00802b99 <nsipc_send>:
+  802b99:	55                   	push   %ebp
+  802b9a:	89 e5                	mov    %esp,%ebp
+  802b9c:	53                   	push   %ebx
+  802b9d:	83 ec 04             	sub    $0x4,%esp
+  802ba0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba6:	a3 00 80 80 00       	mov    %eax,0x808000
+  802bab:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bb1:	7f 2e                	jg     802be1 <nsipc_send+0x48>
+  802bb3:	83 ec 04             	sub    $0x4,%esp
+  802bb6:	53                   	push   %ebx
+  802bb7:	ff 75 0c             	push   0xc(%ebp)
+  802bba:	68 0c 80 80 00       	push   $0x80800c
+  802bbf:	e8 38 e4 ff ff       	call   800ffc <memmove>
+  802bc4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802bca:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bcd:	a3 08 80 80 00       	mov    %eax,0x808008
+  802bd2:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bd7:	e8 f5 fd ff ff       	call   8029d1 <nsipc>
+  802bdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+  802be1:	68 22 45 80 00       	push   $0x804522
+  802be6:	68 01 45 80 00       	push   $0x804501
+  802beb:	6a 6b                	push   $0x6b
+  802bed:	68 16 45 80 00       	push   $0x804516
+  802bf2:	e8 83 da ff ff       	call   80067a <_panic>
+
+00802bf7 <nsipc_socket>:
+  802bf7:	55                   	push   %ebp
+  802bf8:	89 e5                	mov    %esp,%ebp
+  802bfa:	83 ec 08             	sub    $0x8,%esp
+  802bfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c00:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c08:	a3 04 80 80 00       	mov    %eax,0x808004
+  802c0d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c10:	a3 08 80 80 00       	mov    %eax,0x808008
+  802c15:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c1a:	e8 b2 fd ff ff       	call   8029d1 <nsipc>
+  802c1f:	c9                   	leave
+  802c20:	c3                   	ret
+
+00802c21 <free>:
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	53                   	push   %ebx
+  802c25:	83 ec 04             	sub    $0x4,%esp
+  802c28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c2b:	85 db                	test   %ebx,%ebx
+  802c2d:	0f 84 85 00 00 00    	je     802cb8 <free+0x97>
+  802c33:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c39:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c3e:	77 51                	ja     802c91 <free+0x70>
+  802c40:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802c46:	89 d8                	mov    %ebx,%eax
+  802c48:	c1 e8 0c             	shr    $0xc,%eax
+  802c4b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c52:	f6 c4 04             	test   $0x4,%ah
+  802c55:	74 50                	je     802ca7 <free+0x86>
+  802c57:	83 ec 08             	sub    $0x8,%esp
+  802c5a:	53                   	push   %ebx
+  802c5b:	6a 00                	push   $0x0
+  802c5d:	e8 1c e7 ff ff       	call   80137e <sys_page_unmap>
+  802c62:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c68:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c6e:	83 c4 10             	add    $0x10,%esp
+  802c71:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c76:	76 ce                	jbe    802c46 <free+0x25>
+  802c78:	68 6b 45 80 00       	push   $0x80456b
+  802c7d:	68 01 45 80 00       	push   $0x804501
+  802c82:	68 81 00 00 00       	push   $0x81
+  802c87:	68 5e 45 80 00       	push   $0x80455e
+  802c8c:	e8 e9 d9 ff ff       	call   80067a <_panic>
+  802c91:	68 30 45 80 00       	push   $0x804530
+  802c96:	68 01 45 80 00       	push   $0x804501
+  802c9b:	6a 7a                	push   $0x7a
+  802c9d:	68 5e 45 80 00       	push   $0x80455e
+  802ca2:	e8 d3 d9 ff ff       	call   80067a <_panic>
+  802ca7:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802cad:	83 e8 01             	sub    $0x1,%eax
+  802cb0:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802cb6:	74 05                	je     802cbd <free+0x9c>
+  802cb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cbb:	c9                   	leave
+  802cbc:	c3                   	ret
+  802cbd:	83 ec 08             	sub    $0x8,%esp
+  802cc0:	53                   	push   %ebx
+  802cc1:	6a 00                	push   $0x0
+  802cc3:	e8 b6 e6 ff ff       	call   80137e <sys_page_unmap>
+  802cc8:	83 c4 10             	add    $0x10,%esp
+  802ccb:	eb eb                	jmp    802cb8 <free+0x97>
+
+00802ccd <malloc>:
+  802ccd:	55                   	push   %ebp
+  802cce:	89 e5                	mov    %esp,%ebp
+  802cd0:	57                   	push   %edi
+  802cd1:	56                   	push   %esi
+  802cd2:	53                   	push   %ebx
+  802cd3:	83 ec 1c             	sub    $0x1c,%esp
+  802cd6:	a1 10 60 80 00       	mov    0x806010,%eax
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	74 6c                	je     802d4b <malloc+0x7e>
+  802cdf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ce2:	8d 57 03             	lea    0x3(%edi),%edx
+  802ce5:	89 d6                	mov    %edx,%esi
+  802ce7:	83 e6 fc             	and    $0xfffffffc,%esi
+  802cea:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802cf0:	0f 87 69 01 00 00    	ja     802e5f <malloc+0x192>
+  802cf6:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802cfb:	74 30                	je     802d2d <malloc+0x60>
+  802cfd:	89 c3                	mov    %eax,%ebx
+  802cff:	c1 eb 0c             	shr    $0xc,%ebx
+  802d02:	8d 54 30 03          	lea    0x3(%eax,%esi,1),%edx
+  802d06:	c1 ea 0c             	shr    $0xc,%edx
+  802d09:	39 d3                	cmp    %edx,%ebx
+  802d0b:	74 60                	je     802d6d <malloc+0xa0>
+  802d0d:	83 ec 0c             	sub    $0xc,%esp
+  802d10:	50                   	push   %eax
+  802d11:	e8 0b ff ff ff       	call   802c21 <free>
+  802d16:	a1 10 60 80 00       	mov    0x806010,%eax
+  802d1b:	05 00 10 00 00       	add    $0x1000,%eax
+  802d20:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d25:	a3 10 60 80 00       	mov    %eax,0x806010
+  802d2a:	83 c4 10             	add    $0x10,%esp
+  802d2d:	8b 0d 10 60 80 00    	mov    0x806010,%ecx
+  802d33:	ba 02 00 00 00       	mov    $0x2,%edx
+  802d38:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802d3c:	8d 7e 04             	lea    0x4(%esi),%edi
+  802d3f:	89 cb                	mov    %ecx,%ebx
+  802d41:	01 f9                	add    %edi,%ecx
+  802d43:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802d46:	e9 8e 00 00 00       	jmp    802dd9 <malloc+0x10c>
+  802d4b:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802d52:	00 00 08 
+  802d55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d58:	8d 57 03             	lea    0x3(%edi),%edx
+  802d5b:	89 d6                	mov    %edx,%esi
+  802d5d:	83 e6 fc             	and    $0xfffffffc,%esi
+  802d60:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802d66:	76 c5                	jbe    802d2d <malloc+0x60>
+  802d68:	e9 ea 00 00 00       	jmp    802e57 <malloc+0x18a>
+  802d6d:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  802d73:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802d79:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+  802d7d:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  802d80:	89 15 10 60 80 00    	mov    %edx,0x806010
+  802d86:	e9 cc 00 00 00       	jmp    802e57 <malloc+0x18a>
+  802d8b:	05 00 10 00 00       	add    $0x1000,%eax
+  802d90:	39 c8                	cmp    %ecx,%eax
+  802d92:	0f 83 d5 00 00 00    	jae    802e6d <malloc+0x1a0>
+  802d98:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802d9d:	77 22                	ja     802dc1 <malloc+0xf4>
+  802d9f:	89 c2                	mov    %eax,%edx
+  802da1:	c1 ea 16             	shr    $0x16,%edx
+  802da4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802dab:	f6 c2 01             	test   $0x1,%dl
+  802dae:	74 db                	je     802d8b <malloc+0xbe>
+  802db0:	89 c2                	mov    %eax,%edx
+  802db2:	c1 ea 0c             	shr    $0xc,%edx
+  802db5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802dbc:	f6 c2 01             	test   $0x1,%dl
+  802dbf:	74 ca                	je     802d8b <malloc+0xbe>
+  802dc1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802dc7:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802dcd:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802dd1:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802dd7:	74 14                	je     802ded <malloc+0x120>
+  802dd9:	39 cb                	cmp    %ecx,%ebx
+  802ddb:	0f 83 8c 00 00 00    	jae    802e6d <malloc+0x1a0>
+  802de1:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  802de7:	77 d8                	ja     802dc1 <malloc+0xf4>
+  802de9:	89 d8                	mov    %ebx,%eax
+  802deb:	eb b2                	jmp    802d9f <malloc+0xd2>
+  802ded:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802df0:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802df5:	83 ea 01             	sub    $0x1,%edx
+  802df8:	0f 85 41 ff ff ff    	jne    802d3f <malloc+0x72>
+  802dfe:	c7 05 10 60 80 00 00 	movl   $0x8000000,0x806010
+  802e05:	00 00 08 
+  802e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0d:	eb 48                	jmp    802e57 <malloc+0x18a>
+  802e0f:	85 db                	test   %ebx,%ebx
+  802e11:	78 53                	js     802e66 <malloc+0x199>
+  802e13:	83 ec 08             	sub    $0x8,%esp
+  802e16:	89 d8                	mov    %ebx,%eax
+  802e18:	03 05 10 60 80 00    	add    0x806010,%eax
+  802e1e:	50                   	push   %eax
+  802e1f:	6a 00                	push   $0x0
+  802e21:	e8 58 e5 ff ff       	call   80137e <sys_page_unmap>
+  802e26:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802e2c:	83 c4 10             	add    $0x10,%esp
+  802e2f:	81 fb 00 f0 ff ff    	cmp    $0xfffff000,%ebx
+  802e35:	75 dc                	jne    802e13 <malloc+0x146>
+  802e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3c:	eb 19                	jmp    802e57 <malloc+0x18a>
+  802e3e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e41:	a1 10 60 80 00       	mov    0x806010,%eax
+  802e46:	c7 44 18 fc 02 00 00 	movl   $0x2,-0x4(%eax,%ebx,1)
+  802e4d:	00 
+  802e4e:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  802e51:	89 15 10 60 80 00    	mov    %edx,0x806010
+  802e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e5a:	5b                   	pop    %ebx
+  802e5b:	5e                   	pop    %esi
+  802e5c:	5f                   	pop    %edi
+  802e5d:	5d                   	pop    %ebp
+  802e5e:	c3                   	ret
+  802e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e64:	eb f1                	jmp    802e57 <malloc+0x18a>
+  802e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6b:	eb ea                	jmp    802e57 <malloc+0x18a>
+  802e6d:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802e71:	74 06                	je     802e79 <malloc+0x1ac>
+  802e73:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+  802e79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e7e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802e81:	39 fb                	cmp    %edi,%ebx
+  802e83:	73 b9                	jae    802e3e <malloc+0x171>
+  802e85:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802e8b:	83 ec 04             	sub    $0x4,%esp
+  802e8e:	39 fe                	cmp    %edi,%esi
+  802e90:	0f 92 c0             	setb   %al
+  802e93:	0f b6 c0             	movzbl %al,%eax
+  802e96:	c1 e0 0a             	shl    $0xa,%eax
+  802e99:	83 c8 07             	or     $0x7,%eax
+  802e9c:	50                   	push   %eax
+  802e9d:	89 d8                	mov    %ebx,%eax
+  802e9f:	03 05 10 60 80 00    	add    0x806010,%eax
+  802ea5:	50                   	push   %eax
+  802ea6:	6a 00                	push   $0x0
+  802ea8:	e8 ff e3 ff ff       	call   8012ac <sys_page_alloc>
+  802ead:	83 c4 10             	add    $0x10,%esp
+  802eb0:	85 c0                	test   %eax,%eax
+  802eb2:	0f 88 57 ff ff ff    	js     802e0f <malloc+0x142>
+  802eb8:	89 f3                	mov    %esi,%ebx
+  802eba:	eb c5                	jmp    802e81 <malloc+0x1b4>
+
+00802ebc <devpipe_stat>:
+  802ebc:	55                   	push   %ebp
+  802ebd:	89 e5                	mov    %esp,%ebp
+  802ebf:	56                   	push   %esi
+  802ec0:	53                   	push   %ebx
+  802ec1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ec4:	83 ec 0c             	sub    $0xc,%esp
+  802ec7:	ff 75 08             	push   0x8(%ebp)
+  802eca:	e8 fe ec ff ff       	call   801bcd <fd2data>
+  802ecf:	89 c6                	mov    %eax,%esi
+  802ed1:	83 c4 08             	add    $0x8,%esp
+  802ed4:	68 83 45 80 00       	push   $0x804583
+  802ed9:	53                   	push   %ebx
+  802eda:	e8 6d df ff ff       	call   800e4c <strcpy>
+  802edf:	8b 46 04             	mov    0x4(%esi),%eax
+  802ee2:	2b 06                	sub    (%esi),%eax
+  802ee4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802eea:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ef1:	00 00 00 
+  802ef4:	c7 83 88 00 00 00 5c 	movl   $0x80505c,0x88(%ebx)
+  802efb:	50 80 00 
+  802efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f06:	5b                   	pop    %ebx
+  802f07:	5e                   	pop    %esi
+  802f08:	5d                   	pop    %ebp
+  802f09:	c3                   	ret
+
+00802f0a <devpipe_close>:
+  802f0a:	55                   	push   %ebp
+  802f0b:	89 e5                	mov    %esp,%ebp
+  802f0d:	53                   	push   %ebx
+  802f0e:	83 ec 0c             	sub    $0xc,%esp
+  802f11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f14:	53                   	push   %ebx
+  802f15:	6a 00                	push   $0x0
+  802f17:	e8 62 e4 ff ff       	call   80137e <sys_page_unmap>
+  802f1c:	89 1c 24             	mov    %ebx,(%esp)
+  802f1f:	e8 a9 ec ff ff       	call   801bcd <fd2data>
+  802f24:	83 c4 08             	add    $0x8,%esp
+  802f27:	50                   	push   %eax
+  802f28:	6a 00                	push   $0x0
+  802f2a:	e8 4f e4 ff ff       	call   80137e <sys_page_unmap>
+  802f2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f32:	c9                   	leave
+  802f33:	c3                   	ret
+
+00802f34 <_pipeisclosed>:
+  802f34:	55                   	push   %ebp
+  802f35:	89 e5                	mov    %esp,%ebp
+  802f37:	57                   	push   %edi
+  802f38:	56                   	push   %esi
+  802f39:	53                   	push   %ebx
+  802f3a:	83 ec 1c             	sub    $0x1c,%esp
+  802f3d:	89 c7                	mov    %eax,%edi
+  802f3f:	89 d6                	mov    %edx,%esi
+  802f41:	a1 24 60 80 00       	mov    0x806024,%eax
+  802f46:	8b 58 58             	mov    0x58(%eax),%ebx
+  802f49:	83 ec 0c             	sub    $0xc,%esp
+  802f4c:	57                   	push   %edi
+  802f4d:	e8 d2 08 00 00       	call   803824 <pageref>
+  802f52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f55:	89 34 24             	mov    %esi,(%esp)
+  802f58:	e8 c7 08 00 00       	call   803824 <pageref>
+  802f5d:	8b 15 24 60 80 00    	mov    0x806024,%edx
+  802f63:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802f66:	83 c4 10             	add    $0x10,%esp
+  802f69:	39 cb                	cmp    %ecx,%ebx
+  802f6b:	74 1b                	je     802f88 <_pipeisclosed+0x54>
+  802f6d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f70:	75 cf                	jne    802f41 <_pipeisclosed+0xd>
+  802f72:	8b 42 58             	mov    0x58(%edx),%eax
+  802f75:	6a 01                	push   $0x1
+  802f77:	50                   	push   %eax
+  802f78:	53                   	push   %ebx
+  802f79:	68 8a 45 80 00       	push   $0x80458a
+  802f7e:	e8 d2 d7 ff ff       	call   800755 <cprintf>
+  802f83:	83 c4 10             	add    $0x10,%esp
+  802f86:	eb b9                	jmp    802f41 <_pipeisclosed+0xd>
+  802f88:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f8b:	0f 94 c0             	sete   %al
+  802f8e:	0f b6 c0             	movzbl %al,%eax
+  802f91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f94:	5b                   	pop    %ebx
+  802f95:	5e                   	pop    %esi
+  802f96:	5f                   	pop    %edi
+  802f97:	5d                   	pop    %ebp
+  802f98:	c3                   	ret
+
+00802f99 <devpipe_write>:
+  802f99:	55                   	push   %ebp
+  802f9a:	89 e5                	mov    %esp,%ebp
+  802f9c:	57                   	push   %edi
+  802f9d:	56                   	push   %esi
+  802f9e:	53                   	push   %ebx
+  802f9f:	83 ec 28             	sub    $0x28,%esp
+  802fa2:	8b 75 08             	mov    0x8(%ebp),%esi
+  802fa5:	56                   	push   %esi
+  802fa6:	e8 22 ec ff ff       	call   801bcd <fd2data>
+  802fab:	89 c3                	mov    %eax,%ebx
+  802fad:	83 c4 10             	add    $0x10,%esp
+  802fb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fb9:	74 5c                	je     803017 <devpipe_write+0x7e>
+  802fbb:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fbe:	8b 0b                	mov    (%ebx),%ecx
+  802fc0:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fc3:	39 d0                	cmp    %edx,%eax
+  802fc5:	72 1e                	jb     802fe5 <devpipe_write+0x4c>
+  802fc7:	89 da                	mov    %ebx,%edx
+  802fc9:	89 f0                	mov    %esi,%eax
+  802fcb:	e8 64 ff ff ff       	call   802f34 <_pipeisclosed>
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	75 48                	jne    80301c <devpipe_write+0x83>
+  802fd4:	e8 88 e2 ff ff       	call   801261 <sys_yield>
+  802fd9:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fdc:	8b 0b                	mov    (%ebx),%ecx
+  802fde:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fe1:	39 d0                	cmp    %edx,%eax
+  802fe3:	73 e2                	jae    802fc7 <devpipe_write+0x2e>
+  802fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fe8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802fec:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802fef:	89 c2                	mov    %eax,%edx
+  802ff1:	c1 fa 1f             	sar    $0x1f,%edx
+  802ff4:	89 d1                	mov    %edx,%ecx
+  802ff6:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ff9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ffc:	83 e2 1f             	and    $0x1f,%edx
+  802fff:	29 ca                	sub    %ecx,%edx
+  803001:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803005:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  803009:	83 c0 01             	add    $0x1,%eax
+  80300c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80300f:	83 c7 01             	add    $0x1,%edi
+  803012:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803015:	75 a4                	jne    802fbb <devpipe_write+0x22>
+  803017:	8b 45 10             	mov    0x10(%ebp),%eax
+  80301a:	eb 05                	jmp    803021 <devpipe_write+0x88>
+  80301c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803021:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803024:	5b                   	pop    %ebx
+  803025:	5e                   	pop    %esi
+  803026:	5f                   	pop    %edi
+  803027:	5d                   	pop    %ebp
+  803028:	c3                   	ret
+
+00803029 <devpipe_read>:
+  803029:	55                   	push   %ebp
+  80302a:	89 e5                	mov    %esp,%ebp
+  80302c:	57                   	push   %edi
+  80302d:	56                   	push   %esi
+  80302e:	53                   	push   %ebx
+  80302f:	83 ec 18             	sub    $0x18,%esp
+  803032:	8b 75 08             	mov    0x8(%ebp),%esi
+  803035:	56                   	push   %esi
+  803036:	e8 92 eb ff ff       	call   801bcd <fd2data>
+  80303b:	89 c3                	mov    %eax,%ebx
+  80303d:	83 c4 10             	add    $0x10,%esp
+  803040:	bf 00 00 00 00       	mov    $0x0,%edi
+  803045:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803049:	74 45                	je     803090 <devpipe_read+0x67>
+  80304b:	8b 03                	mov    (%ebx),%eax
+  80304d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803050:	75 1d                	jne    80306f <devpipe_read+0x46>
+  803052:	85 ff                	test   %edi,%edi
+  803054:	75 3f                	jne    803095 <devpipe_read+0x6c>
+  803056:	89 da                	mov    %ebx,%edx
+  803058:	89 f0                	mov    %esi,%eax
+  80305a:	e8 d5 fe ff ff       	call   802f34 <_pipeisclosed>
+  80305f:	85 c0                	test   %eax,%eax
+  803061:	75 3c                	jne    80309f <devpipe_read+0x76>
+  803063:	e8 f9 e1 ff ff       	call   801261 <sys_yield>
+  803068:	8b 03                	mov    (%ebx),%eax
+  80306a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80306d:	74 e7                	je     803056 <devpipe_read+0x2d>
+  80306f:	99                   	cltd
+  803070:	c1 ea 1b             	shr    $0x1b,%edx
+  803073:	01 d0                	add    %edx,%eax
+  803075:	83 e0 1f             	and    $0x1f,%eax
+  803078:	29 d0                	sub    %edx,%eax
+  80307a:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80307f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803082:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  803085:	83 03 01             	addl   $0x1,(%ebx)
+  803088:	83 c7 01             	add    $0x1,%edi
+  80308b:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80308e:	75 bb                	jne    80304b <devpipe_read+0x22>
+  803090:	8b 45 10             	mov    0x10(%ebp),%eax
+  803093:	eb 02                	jmp    803097 <devpipe_read+0x6e>
+  803095:	89 f8                	mov    %edi,%eax
+  803097:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80309a:	5b                   	pop    %ebx
+  80309b:	5e                   	pop    %esi
+  80309c:	5f                   	pop    %edi
+  80309d:	5d                   	pop    %ebp
+  80309e:	c3                   	ret
+  80309f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a4:	eb f1                	jmp    803097 <devpipe_read+0x6e>
+
+008030a6 <pipe>:
+  8030a6:	55                   	push   %ebp
+  8030a7:	89 e5                	mov    %esp,%ebp
+  8030a9:	56                   	push   %esi
+  8030aa:	53                   	push   %ebx
+  8030ab:	83 ec 1c             	sub    $0x1c,%esp
+  8030ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030b1:	50                   	push   %eax
+  8030b2:	e8 2d eb ff ff       	call   801be4 <fd_alloc>
+  8030b7:	89 c3                	mov    %eax,%ebx
+  8030b9:	83 c4 10             	add    $0x10,%esp
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	0f 88 23 01 00 00    	js     8031e7 <pipe+0x141>
+  8030c4:	83 ec 04             	sub    $0x4,%esp
+  8030c7:	68 07 04 00 00       	push   $0x407
+  8030cc:	ff 75 f4             	push   -0xc(%ebp)
+  8030cf:	6a 00                	push   $0x0
+  8030d1:	e8 d6 e1 ff ff       	call   8012ac <sys_page_alloc>
+  8030d6:	89 c3                	mov    %eax,%ebx
+  8030d8:	83 c4 10             	add    $0x10,%esp
+  8030db:	85 c0                	test   %eax,%eax
+  8030dd:	0f 88 04 01 00 00    	js     8031e7 <pipe+0x141>
+  8030e3:	83 ec 0c             	sub    $0xc,%esp
+  8030e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030e9:	50                   	push   %eax
+  8030ea:	e8 f5 ea ff ff       	call   801be4 <fd_alloc>
+  8030ef:	89 c3                	mov    %eax,%ebx
+  8030f1:	83 c4 10             	add    $0x10,%esp
+  8030f4:	85 c0                	test   %eax,%eax
+  8030f6:	0f 88 db 00 00 00    	js     8031d7 <pipe+0x131>
+  8030fc:	83 ec 04             	sub    $0x4,%esp
+  8030ff:	68 07 04 00 00       	push   $0x407
+  803104:	ff 75 f0             	push   -0x10(%ebp)
+  803107:	6a 00                	push   $0x0
+  803109:	e8 9e e1 ff ff       	call   8012ac <sys_page_alloc>
+  80310e:	89 c3                	mov    %eax,%ebx
+  803110:	83 c4 10             	add    $0x10,%esp
+  803113:	85 c0                	test   %eax,%eax
+  803115:	0f 88 bc 00 00 00    	js     8031d7 <pipe+0x131>
+  80311b:	83 ec 0c             	sub    $0xc,%esp
+  80311e:	ff 75 f4             	push   -0xc(%ebp)
+  803121:	e8 a7 ea ff ff       	call   801bcd <fd2data>
+  803126:	89 c6                	mov    %eax,%esi
+  803128:	83 c4 0c             	add    $0xc,%esp
+  80312b:	68 07 04 00 00       	push   $0x407
+  803130:	50                   	push   %eax
+  803131:	6a 00                	push   $0x0
+  803133:	e8 74 e1 ff ff       	call   8012ac <sys_page_alloc>
+  803138:	89 c3                	mov    %eax,%ebx
+  80313a:	83 c4 10             	add    $0x10,%esp
+  80313d:	85 c0                	test   %eax,%eax
+  80313f:	0f 88 82 00 00 00    	js     8031c7 <pipe+0x121>
+  803145:	83 ec 0c             	sub    $0xc,%esp
+  803148:	ff 75 f0             	push   -0x10(%ebp)
+  80314b:	e8 7d ea ff ff       	call   801bcd <fd2data>
+  803150:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803157:	50                   	push   %eax
+  803158:	6a 00                	push   $0x0
+  80315a:	56                   	push   %esi
+  80315b:	6a 00                	push   $0x0
+  80315d:	e8 8d e1 ff ff       	call   8012ef <sys_page_map>
+  803162:	89 c3                	mov    %eax,%ebx
+  803164:	83 c4 20             	add    $0x20,%esp
+  803167:	85 c0                	test   %eax,%eax
+  803169:	78 4e                	js     8031b9 <pipe+0x113>
+  80316b:	a1 5c 50 80 00       	mov    0x80505c,%eax
+  803170:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803173:	89 02                	mov    %eax,(%edx)
+  803175:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803178:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80317f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803182:	89 02                	mov    %eax,(%edx)
+  803184:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803187:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80318e:	83 ec 0c             	sub    $0xc,%esp
+  803191:	ff 75 f4             	push   -0xc(%ebp)
+  803194:	e8 24 ea ff ff       	call   801bbd <fd2num>
+  803199:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80319c:	89 01                	mov    %eax,(%ecx)
+  80319e:	83 c4 04             	add    $0x4,%esp
+  8031a1:	ff 75 f0             	push   -0x10(%ebp)
+  8031a4:	e8 14 ea ff ff       	call   801bbd <fd2num>
+  8031a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031ac:	89 41 04             	mov    %eax,0x4(%ecx)
+  8031af:	83 c4 10             	add    $0x10,%esp
+  8031b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031b7:	eb 2e                	jmp    8031e7 <pipe+0x141>
+  8031b9:	83 ec 08             	sub    $0x8,%esp
+  8031bc:	56                   	push   %esi
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	e8 ba e1 ff ff       	call   80137e <sys_page_unmap>
+  8031c4:	83 c4 10             	add    $0x10,%esp
+  8031c7:	83 ec 08             	sub    $0x8,%esp
+  8031ca:	ff 75 f0             	push   -0x10(%ebp)
+  8031cd:	6a 00                	push   $0x0
+  8031cf:	e8 aa e1 ff ff       	call   80137e <sys_page_unmap>
+  8031d4:	83 c4 10             	add    $0x10,%esp
+  8031d7:	83 ec 08             	sub    $0x8,%esp
+  8031da:	ff 75 f4             	push   -0xc(%ebp)
+  8031dd:	6a 00                	push   $0x0
+  8031df:	e8 9a e1 ff ff       	call   80137e <sys_page_unmap>
+  8031e4:	83 c4 10             	add    $0x10,%esp
+  8031e7:	89 d8                	mov    %ebx,%eax
+  8031e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031ec:	5b                   	pop    %ebx
+  8031ed:	5e                   	pop    %esi
+  8031ee:	5d                   	pop    %ebp
+  8031ef:	c3                   	ret
+
+008031f0 <pipeisclosed>:
+  8031f0:	55                   	push   %ebp
+  8031f1:	89 e5                	mov    %esp,%ebp
+  8031f3:	83 ec 20             	sub    $0x20,%esp
+  8031f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031f9:	50                   	push   %eax
+  8031fa:	ff 75 08             	push   0x8(%ebp)
+  8031fd:	e8 32 ea ff ff       	call   801c34 <fd_lookup>
+  803202:	83 c4 10             	add    $0x10,%esp
+  803205:	85 c0                	test   %eax,%eax
+  803207:	78 18                	js     803221 <pipeisclosed+0x31>
+  803209:	83 ec 0c             	sub    $0xc,%esp
+  80320c:	ff 75 f4             	push   -0xc(%ebp)
+  80320f:	e8 b9 e9 ff ff       	call   801bcd <fd2data>
+  803214:	89 c2                	mov    %eax,%edx
+  803216:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803219:	e8 16 fd ff ff       	call   802f34 <_pipeisclosed>
+  80321e:	83 c4 10             	add    $0x10,%esp
+  803221:	c9                   	leave
+  803222:	c3                   	ret
+
+00803223 <ipcring_init>:
+  803223:	55                   	push   %ebp
+  803224:	89 e5                	mov    %esp,%ebp
+  803226:	53                   	push   %ebx
+  803227:	83 ec 08             	sub    $0x8,%esp
+  80322a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80322d:	6a 60                	push   $0x60
+  80322f:	6a 00                	push   $0x0
+  803231:	53                   	push   %ebx
+  803232:	e8 90 dd ff ff       	call   800fc7 <memset>
+  803237:	a1 24 60 80 00       	mov    0x806024,%eax
+  80323c:	8b 40 48             	mov    0x48(%eax),%eax
+  80323f:	89 03                	mov    %eax,(%ebx)
+  803241:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803244:	89 43 04             	mov    %eax,0x4(%ebx)
+  803247:	8b 45 10             	mov    0x10(%ebp),%eax
+  80324a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80324d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803250:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803253:	83 c4 10             	add    $0x10,%esp
+  803256:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803259:	c9                   	leave
+  80325a:	c3                   	ret
+
+0080325b <ipcring_req_slot>:
+  80325b:	55                   	push   %ebp
+  80325c:	89 e5                	mov    %esp,%ebp
+  80325e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803261:	8b 50 10             	mov    0x10(%eax),%edx
+  803264:	8b 48 18             	mov    0x18(%eax),%ecx
+  803267:	29 ca                	sub    %ecx,%edx
+  803269:	83 fa 07             	cmp    $0x7,%edx
+  80326c:	77 0c                	ja     80327a <ipcring_req_slot+0x1f>
+  80326e:	8b 50 10             	mov    0x10(%eax),%edx
+  803271:	83 e2 07             	and    $0x7,%edx
+  803274:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803278:	5d                   	pop    %ebp
+  803279:	c3                   	ret
+  80327a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327f:	eb f7                	jmp    803278 <ipcring_req_slot+0x1d>
+
+00803281 <ipcring_req_push>:
+  803281:	55                   	push   %ebp
+  803282:	89 e5                	mov    %esp,%ebp
+  803284:	83 ec 08             	sub    $0x8,%esp
+  803287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80328a:	8b 42 10             	mov    0x10(%edx),%eax
+  80328d:	83 c0 01             	add    $0x1,%eax
+  803290:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803294:	b8 00 00 00 00       	mov    $0x0,%eax
+  803299:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80329d:	85 c0                	test   %eax,%eax
+  80329f:	75 02                	jne    8032a3 <ipcring_req_push+0x22>
+  8032a1:	c9                   	leave
+  8032a2:	c3                   	ret
+  8032a3:	6a 00                	push   $0x0
+  8032a5:	68 00 00 80 ee       	push   $0xee800000
+  8032aa:	ff 72 08             	push   0x8(%edx)
+  8032ad:	ff 72 04             	push   0x4(%edx)
+  8032b0:	e8 2f e3 ff ff       	call   8015e4 <sys_ipc_send>
+  8032b5:	83 c4 10             	add    $0x10,%esp
+  8032b8:	eb e7                	jmp    8032a1 <ipcring_req_push+0x20>
+
+008032ba <ipcring_rsp_wait>:
+  8032ba:	55                   	push   %ebp
+  8032bb:	89 e5                	mov    %esp,%ebp
+  8032bd:	53                   	push   %ebx
+  8032be:	83 ec 04             	sub    $0x4,%esp
+  8032c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8032c4:	8b 53 18             	mov    0x18(%ebx),%edx
+  8032c7:	8b 43 10             	mov    0x10(%ebx),%eax
+  8032ca:	39 c2                	cmp    %eax,%edx
+  8032cc:	74 3c                	je     80330a <ipcring_rsp_wait+0x50>
+  8032ce:	8b 53 14             	mov    0x14(%ebx),%edx
+  8032d1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032d4:	39 c2                	cmp    %eax,%edx
+  8032d6:	75 23                	jne    8032fb <ipcring_rsp_wait+0x41>
+  8032d8:	83 ec 08             	sub    $0x8,%esp
+  8032db:	6a 00                	push   $0x0
+  8032dd:	6a 00                	push   $0x0
+  8032df:	6a 00                	push   $0x0
+  8032e1:	6a 00                	push   $0x0
+  8032e3:	ff 73 0c             	push   0xc(%ebx)
+  8032e6:	ff 73 04             	push   0x4(%ebx)
+  8032e9:	e8 81 03 00 00       	call   80366f <ipc_call>
+  8032ee:	8b 53 14             	mov    0x14(%ebx),%edx
+  8032f1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032f4:	83 c4 20             	add    $0x20,%esp
+  8032f7:	39 c2                	cmp    %eax,%edx
+  8032f9:	74 dd                	je     8032d8 <ipcring_rsp_wait+0x1e>
+  8032fb:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032fe:	83 e0 07             	and    $0x7,%eax
+  803301:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803308:	c9                   	leave
+  803309:	c3                   	ret
+  80330a:	68 a4 45 80 00       	push   $0x8045a4
+  80330f:	68 01 45 80 00       	push   $0x804501
+  803314:	6a 3b                	push   $0x3b
+  803316:	68 c5 45 80 00       	push   $0x8045c5
+  80331b:	e8 5a d3 ff ff       	call   80067a <_panic>
+
+00803320 <ipcring_rsp_pop>:
+  803320:	55                   	push   %ebp
+  803321:	89 e5                	mov    %esp,%ebp
+  803323:	8b 55 08             	mov    0x8(%ebp),%edx
+  803326:	8b 42 18             	mov    0x18(%edx),%eax
+  803329:	83 c0 01             	add    $0x1,%eax
+  80332c:	89 42 18             	mov    %eax,0x18(%edx)
+  80332f:	5d                   	pop    %ebp
+  803330:	c3                   	ret
+
+00803331 <ipcring_server_init>:
+  803331:	55                   	push   %ebp
+  803332:	89 e5                	mov    %esp,%ebp
+  803334:	8b 45 08             	mov    0x8(%ebp),%eax
+  803337:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80333a:	89 10                	mov    %edx,(%eax)
+  80333c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80333f:	89 50 04             	mov    %edx,0x4(%eax)
+  803342:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803349:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803350:	5d                   	pop    %ebp
+  803351:	c3                   	ret
+
+00803352 <ipcring_req_avail>:
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	8b 55 08             	mov    0x8(%ebp),%edx
+  803358:	8b 02                	mov    (%edx),%eax
+  80335a:	8b 40 10             	mov    0x10(%eax),%eax
+  80335d:	2b 42 08             	sub    0x8(%edx),%eax
+  803360:	ba 08 00 00 00       	mov    $0x8,%edx
+  803365:	39 d0                	cmp    %edx,%eax
+  803367:	0f 47 c2             	cmova  %edx,%eax
+  80336a:	5d                   	pop    %ebp
+  80336b:	c3                   	ret
+
+0080336c <ipcring_req_peek>:
+  80336c:	55                   	push   %ebp
+  80336d:	89 e5                	mov    %esp,%ebp
+  80336f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803372:	8b 42 08             	mov    0x8(%edx),%eax
+  803375:	83 e0 07             	and    $0x7,%eax
+  803378:	8b 12                	mov    (%edx),%edx
+  80337a:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80337e:	5d                   	pop    %ebp
+  80337f:	c3                   	ret
+
+00803380 <ipcring_rsp_push>:
+  803380:	55                   	push   %ebp
+  803381:	89 e5                	mov    %esp,%ebp
+  803383:	83 ec 08             	sub    $0x8,%esp
+  803386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803389:	8b 41 08             	mov    0x8(%ecx),%eax
+  80338c:	83 c0 01             	add    $0x1,%eax
+  80338f:	89 41 08             	mov    %eax,0x8(%ecx)
+  803392:	8b 11                	mov    (%ecx),%edx
+  803394:	83 c2 14             	add    $0x14,%edx
+  803397:	f0 87 02             	lock xchg %eax,(%edx)
+  80339a:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80339e:	75 02                	jne    8033a2 <ipcring_rsp_push+0x22>
+  8033a0:	c9                   	leave
+  8033a1:	c3                   	ret
+  8033a2:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8033a9:	6a 00                	push   $0x0
+  8033ab:	68 00 00 80 ee       	push   $0xee800000
+  8033b0:	6a 00                	push   $0x0
+  8033b2:	ff 71 04             	push   0x4(%ecx)
+  8033b5:	e8 4d e1 ff ff       	call   801507 <sys_ipc_try_send>
+  8033ba:	83 c4 10             	add    $0x10,%esp
+  8033bd:	eb e1                	jmp    8033a0 <ipcring_rsp_push+0x20>
+
+008033bf <ipcring_client_wait>:
+  8033bf:	55                   	push   %ebp
+  8033c0:	89 e5                	mov    %esp,%ebp
+  8033c2:	83 ec 08             	sub    $0x8,%esp
+  8033c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c8:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8033cf:	8b 10                	mov    (%eax),%edx
+  8033d1:	8b 52 18             	mov    0x18(%edx),%edx
+  8033d4:	3b 50 08             	cmp    0x8(%eax),%edx
+  8033d7:	75 02                	jne    8033db <ipcring_client_wait+0x1c>
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+  8033db:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8033e2:	6a 00                	push   $0x0
+  8033e4:	68 00 00 80 ee       	push   $0xee800000
+  8033e9:	6a 00                	push   $0x0
+  8033eb:	ff 70 04             	push   0x4(%eax)
+  8033ee:	e8 14 e1 ff ff       	call   801507 <sys_ipc_try_send>
+  8033f3:	83 c4 10             	add    $0x10,%esp
+  8033f6:	eb e1                	jmp    8033d9 <ipcring_client_wait+0x1a>
+
+008033f8 <ipcring_server_sleep>:
+  8033f8:	55                   	push   %ebp
+  8033f9:	89 e5                	mov    %esp,%ebp
+  8033fb:	53                   	push   %ebx
+  8033fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033ff:	8b 01                	mov    (%ecx),%eax
+  803401:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803404:	b8 01 00 00 00       	mov    $0x1,%eax
+  803409:	f0 87 02             	lock xchg %eax,(%edx)
+  80340c:	8b 11                	mov    (%ecx),%edx
+  80340e:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803411:	b8 01 00 00 00       	mov    $0x1,%eax
+  803416:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803419:	74 0e                	je     803429 <ipcring_server_sleep+0x31>
+  80341b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803420:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803424:	b8 00 00 00 00       	mov    $0x0,%eax
+  803429:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80342c:	c9                   	leave
+  80342d:	c3                   	ret
+
+0080342e <devcons_close>:
+  80342e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803433:	c3                   	ret
+
+00803434 <devcons_stat>:
+  803434:	55                   	push   %ebp
+  803435:	89 e5                	mov    %esp,%ebp
+  803437:	83 ec 10             	sub    $0x10,%esp
+  80343a:	68 d3 45 80 00       	push   $0x8045d3
+  80343f:	ff 75 0c             	push   0xc(%ebp)
+  803442:	e8 05 da ff ff       	call   800e4c <strcpy>
+  803447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344c:	c9                   	leave
+  80344d:	c3                   	ret
+
+0080344e <devcons_write>:
+  80344e:	55                   	push   %ebp
+  80344f:	89 e5                	mov    %esp,%ebp
+  803451:	57                   	push   %edi
+  803452:	56                   	push   %esi
+  803453:	53                   	push   %ebx
+  803454:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80345a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80345d:	85 ff                	test   %edi,%edi
+  80345f:	74 51                	je     8034b2 <devcons_write+0x64>
+  803461:	be 00 00 00 00       	mov    $0x0,%esi
+  803466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346b:	89 fb                	mov    %edi,%ebx
+  80346d:	29 c3                	sub    %eax,%ebx
+  80346f:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803474:	39 d3                	cmp    %edx,%ebx
+  803476:	0f 47 da             	cmova  %edx,%ebx
+  803479:	83 ec 04             	sub    $0x4,%esp
+  80347c:	53                   	push   %ebx
+  80347d:	03 45 0c             	add    0xc(%ebp),%eax
+  803480:	50                   	push   %eax
+  803481:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803487:	50                   	push   %eax
+  803488:	e8 6f db ff ff       	call   800ffc <memmove>
+  80348d:	83 c4 08             	add    $0x8,%esp
+  803490:	53                   	push   %ebx
+  803491:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803497:	50                   	push   %eax
+  803498:	e8 27 dd ff ff       	call   8011c4 <sys_cputs>
+  80349d:	01 de                	add    %ebx,%esi
+  80349f:	89 f0                	mov    %esi,%eax
+  8034a1:	83 c4 10             	add    $0x10,%esp
+  8034a4:	39 fe                	cmp    %edi,%esi
+  8034a6:	72 c3                	jb     80346b <devcons_write+0x1d>
+  8034a8:	89 f0                	mov    %esi,%eax
+  8034aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034ad:	5b                   	pop    %ebx
+  8034ae:	5e                   	pop    %esi
+  8034af:	5f                   	pop    %edi
+  8034b0:	5d                   	pop    %ebp
+  8034b1:	c3                   	ret
+  8034b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b7:	eb ef                	jmp    8034a8 <devcons_write+0x5a>
+
+008034b9 <devcons_read>:
+  8034b9:	55                   	push   %ebp
+  8034ba:	89 e5                	mov    %esp,%ebp
+  8034bc:	83 ec 08             	sub    $0x8,%esp
+  8034bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034c8:	75 07                	jne    8034d1 <devcons_read+0x18>
+  8034ca:	eb 1f                	jmp    8034eb <devcons_read+0x32>
+  8034cc:	e8 90 dd ff ff       	call   801261 <sys_yield>
+  8034d1:	e8 0c dd ff ff       	call   8011e2 <sys_cgetc>
+  8034d6:	85 c0                	test   %eax,%eax
+  8034d8:	74 f2                	je     8034cc <devcons_read+0x13>
+  8034da:	78 0f                	js     8034eb <devcons_read+0x32>
+  8034dc:	83 f8 04             	cmp    $0x4,%eax
+  8034df:	74 0c                	je     8034ed <devcons_read+0x34>
+  8034e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034e4:	88 02                	mov    %al,(%edx)
+  8034e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034eb:	c9                   	leave
+  8034ec:	c3                   	ret
+  8034ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f2:	eb f7                	jmp    8034eb <devcons_read+0x32>
+
+008034f4 <cputchar>:
+  8034f4:	55                   	push   %ebp
+  8034f5:	89 e5                	mov    %esp,%ebp
+  8034f7:	83 ec 20             	sub    $0x20,%esp
+  8034fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034fd:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803500:	6a 01                	push   $0x1
+  803502:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803505:	50                   	push   %eax
+  803506:	e8 b9 dc ff ff       	call   8011c4 <sys_cputs>
+  80350b:	83 c4 10             	add    $0x10,%esp
+  80350e:	c9                   	leave
+  80350f:	c3                   	ret
+
+00803510 <getchar>:
+  803510:	55                   	push   %ebp
+  803511:	89 e5                	mov    %esp,%ebp
+  803513:	83 ec 1c             	sub    $0x1c,%esp
+  803516:	6a 01                	push   $0x1
+  803518:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80351b:	50                   	push   %eax
+  80351c:	6a 00                	push   $0x0
+  80351e:	e8 73 e9 ff ff       	call   801e96 <read>
+  803523:	83 c4 10             	add    $0x10,%esp
+  803526:	85 c0                	test   %eax,%eax
+  803528:	78 06                	js     803530 <getchar+0x20>
+  80352a:	74 06                	je     803532 <getchar+0x22>
+  80352c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803530:	c9                   	leave
+  803531:	c3                   	ret
+  803532:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803537:	eb f7                	jmp    803530 <getchar+0x20>
+
+00803539 <iscons>:
+  803539:	55                   	push   %ebp
+  80353a:	89 e5                	mov    %esp,%ebp
+  80353c:	83 ec 20             	sub    $0x20,%esp
+  80353f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803542:	50                   	push   %eax
+  803543:	ff 75 08             	push   0x8(%ebp)
+  803546:	e8 e9 e6 ff ff       	call   801c34 <fd_lookup>
+  80354b:	83 c4 10             	add    $0x10,%esp
+  80354e:	85 c0                	test   %eax,%eax
+  803550:	78 11                	js     803563 <iscons+0x2a>
+  803552:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803555:	8b 15 78 50 80 00    	mov    0x805078,%edx
+  80355b:	39 10                	cmp    %edx,(%eax)
+  80355d:	0f 94 c0             	sete   %al
+  803560:	0f b6 c0             	movzbl %al,%eax
+  803563:	c9                   	leave
+  803564:	c3                   	ret
+
+00803565 <opencons>:
+  803565:	55                   	push   %ebp
+  803566:	89 e5                	mov    %esp,%ebp
+  803568:	83 ec 24             	sub    $0x24,%esp
+  80356b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80356e:	50                   	push   %eax
+  80356f:	e8 70 e6 ff ff       	call   801be4 <fd_alloc>
+  803574:	83 c4 10             	add    $0x10,%esp
+  803577:	85 c0                	test   %eax,%eax
+  803579:	78 3a                	js     8035b5 <opencons+0x50>
+  80357b:	83 ec 04             	sub    $0x4,%esp
+  80357e:	68 07 04 00 00       	push   $0x407
+  803583:	ff 75 f4             	push   -0xc(%ebp)
+  803586:	6a 00                	push   $0x0
+  803588:	e8 1f dd ff ff       	call   8012ac <sys_page_alloc>
+  80358d:	83 c4 10             	add    $0x10,%esp
+  803590:	85 c0                	test   %eax,%eax
+  803592:	78 21                	js     8035b5 <opencons+0x50>
+  803594:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803597:	8b 15 78 50 80 00    	mov    0x805078,%edx
+  80359d:	89 10                	mov    %edx,(%eax)
+  80359f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035a2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8035a9:	83 ec 0c             	sub    $0xc,%esp
+  8035ac:	50                   	push   %eax
+  8035ad:	e8 0b e6 ff ff       	call   801bbd <fd2num>
+  8035b2:	83 c4 10             	add    $0x10,%esp
+  8035b5:	c9                   	leave
+  8035b6:	c3                   	ret
+
+008035b7 <ipc_recv>:
+  8035b7:	55                   	push   %ebp
+  8035b8:	89 e5                	mov    %esp,%ebp
+  8035ba:	56                   	push   %esi
+  8035bb:	53                   	push   %ebx
+  8035bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035c5:	85 c0                	test   %eax,%eax
+  8035c7:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  8035cc:	0f 44 c2             	cmove  %edx,%eax
+  8035cf:	83 ec 0c             	sub    $0xc,%esp
+  8035d2:	50                   	push   %eax
+  8035d3:	e8 7f df ff ff       	call   801557 <sys_ipc_recv>
+  8035d8:	83 c4 10             	add    $0x10,%esp
+  8035db:	85 c0                	test   %eax,%eax
+  8035dd:	78 2a                	js     803609 <ipc_recv+0x52>
+  8035df:	a1 24 60 80 00       	mov    0x806024,%eax
+  8035e4:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8035ea:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8035f0:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8035f6:	85 f6                	test   %esi,%esi
+  8035f8:	74 02                	je     8035fc <ipc_recv+0x45>
+  8035fa:	89 0e                	mov    %ecx,(%esi)
+  8035fc:	85 db                	test   %ebx,%ebx
+  8035fe:	74 02                	je     803602 <ipc_recv+0x4b>
+  803600:	89 13                	mov    %edx,(%ebx)
+  803602:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803605:	5b                   	pop    %ebx
+  803606:	5e                   	pop    %esi
+  803607:	5d                   	pop    %ebp
+  803608:	c3                   	ret
+  803609:	ba 00 00 00 00       	mov    $0x0,%edx
+  80360e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803613:	eb e1                	jmp    8035f6 <ipc_recv+0x3f>
+
+00803615 <ipc_send>:
+  803615:	55                   	push   %ebp
+  803616:	89 e5                	mov    %esp,%ebp
+  803618:	57                   	push   %edi
+  803619:	56                   	push   %esi
+  80361a:	53                   	push   %ebx
+  80361b:	83 ec 0c             	sub    $0xc,%esp
+  80361e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803621:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803624:	8b 75 14             	mov    0x14(%ebp),%esi
+  803627:	85 db                	test   %ebx,%ebx
+  803629:	74 1e                	je     803649 <ipc_send+0x34>
+  80362b:	56                   	push   %esi
+  80362c:	53                   	push   %ebx
+  80362d:	57                   	push   %edi
+  80362e:	ff 75 08             	push   0x8(%ebp)
+  803631:	e8 ae df ff ff       	call   8015e4 <sys_ipc_send>
+  803636:	83 c4 10             	add    $0x10,%esp
+  803639:	85 c0                	test   %eax,%eax
+  80363b:	74 2a                	je     803667 <ipc_send+0x52>
+  80363d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803640:	75 13                	jne    803655 <ipc_send+0x40>
+  803642:	e8 1a dc ff ff       	call   801261 <sys_yield>
+  803647:	eb e2                	jmp    80362b <ipc_send+0x16>
+  803649:	be 00 00 00 00       	mov    $0x0,%esi
+  80364e:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803653:	eb d6                	jmp    80362b <ipc_send+0x16>
+  803655:	50                   	push   %eax
+  803656:	68 e0 45 80 00       	push   $0x8045e0
+  80365b:	6a 4f                	push   $0x4f
+  80365d:	68 23 46 80 00       	push   $0x804623
+  803662:	e8 13 d0 ff ff       	call   80067a <_panic>
+  803667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80366a:	5b                   	pop    %ebx
+  80366b:	5e                   	pop    %esi
+  80366c:	5f                   	pop    %edi
+  80366d:	5d                   	pop    %ebp
+  80366e:	c3                   	ret
+
+0080366f <ipc_call>:
+  80366f:	55                   	push   %ebp
+  803670:	89 e5                	mov    %esp,%ebp
+  803672:	57                   	push   %edi
+  803673:	56                   	push   %esi
+  803674:	53                   	push   %ebx
+  803675:	83 ec 0c             	sub    $0xc,%esp
+  803678:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80367c:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803681:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803685:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803689:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  80368e:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803692:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803696:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80369b:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  80369f:	eb 05                	jmp    8036a6 <ipc_call+0x37>
+  8036a1:	e8 bb db ff ff       	call   801261 <sys_yield>
+  8036a6:	83 ec 0c             	sub    $0xc,%esp
+  8036a9:	56                   	push   %esi
+  8036aa:	53                   	push   %ebx
+  8036ab:	57                   	push   %edi
+  8036ac:	ff 75 0c             	push   0xc(%ebp)
+  8036af:	ff 75 08             	push   0x8(%ebp)
+  8036b2:	e8 7d df ff ff       	call   801634 <sys_ipc_call>
+  8036b7:	83 c4 20             	add    $0x20,%esp
+  8036ba:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8036bd:	74 e2                	je     8036a1 <ipc_call+0x32>
+  8036bf:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8036c2:	74 2d                	je     8036f1 <ipc_call+0x82>
+  8036c4:	85 c0                	test   %eax,%eax
+  8036c6:	78 4f                	js     803717 <ipc_call+0xa8>
+  8036c8:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8036cc:	74 10                	je     8036de <ipc_call+0x6f>
+  8036ce:	a1 24 60 80 00       	mov    0x806024,%eax
+  8036d3:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8036d9:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8036dc:	89 02                	mov    %eax,(%edx)
+  8036de:	a1 24 60 80 00       	mov    0x806024,%eax
+  8036e3:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8036e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ec:	5b                   	pop    %ebx
+  8036ed:	5e                   	pop    %esi
+  8036ee:	5f                   	pop    %edi
+  8036ef:	5d                   	pop    %ebp
+  8036f0:	c3                   	ret
+  8036f1:	ff 75 14             	push   0x14(%ebp)
+  8036f4:	ff 75 10             	push   0x10(%ebp)
+  8036f7:	ff 75 0c             	push   0xc(%ebp)
+  8036fa:	ff 75 08             	push   0x8(%ebp)
+  8036fd:	e8 13 ff ff ff       	call   803615 <ipc_send>
+  803702:	83 c4 0c             	add    $0xc,%esp
+  803705:	ff 75 1c             	push   0x1c(%ebp)
+  803708:	ff 75 18             	push   0x18(%ebp)
+  80370b:	6a 00                	push   $0x0
+  80370d:	e8 a5 fe ff ff       	call   8035b7 <ipc_recv>
+  803712:	83 c4 10             	add    $0x10,%esp
+  803715:	eb d2                	jmp    8036e9 <ipc_call+0x7a>
+  803717:	50                   	push   %eax
+  803718:	68 2d 46 80 00       	push   $0x80462d
+  80371d:	6a 6d                	push   $0x6d
+  80371f:	68 23 46 80 00       	push   $0x804623
+  803724:	e8 51 cf ff ff       	call   80067a <_panic>
+
+00803729 <ipc_reply_recv>:
+  803729:	55                   	push   %ebp
+  80372a:	89 e5                	mov    %esp,%ebp
+  80372c:	57                   	push   %edi
+  80372d:	56                   	push   %esi
+  80372e:	53                   	push   %ebx
+  80372f:	83 ec 0c             	sub    $0xc,%esp
+  803732:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803735:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803738:	8b 7d 20             	mov    0x20(%ebp),%edi
+  80373b:	85 db                	test   %ebx,%ebx
+  80373d:	0f 84 ac 00 00 00    	je     8037ef <ipc_reply_recv+0xc6>
+  803743:	85 f6                	test   %esi,%esi
+  803745:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80374a:	0f 45 c6             	cmovne %esi,%eax
+  80374d:	83 ec 0c             	sub    $0xc,%esp
+  803750:	50                   	push   %eax
+  803751:	ff 75 14             	push   0x14(%ebp)
+  803754:	53                   	push   %ebx
+  803755:	ff 75 0c             	push   0xc(%ebp)
+  803758:	ff 75 08             	push   0x8(%ebp)
+  80375b:	e8 f5 de ff ff       	call   801655 <sys_ipc_reply_recv>
+  803760:	83 c4 20             	add    $0x20,%esp
+  803763:	85 c0                	test   %eax,%eax
+  803765:	78 3a                	js     8037a1 <ipc_reply_recv+0x78>
+  803767:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80376b:	74 10                	je     80377d <ipc_reply_recv+0x54>
+  80376d:	a1 24 60 80 00       	mov    0x806024,%eax
+  803772:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803778:	8b 55 18             	mov    0x18(%ebp),%edx
+  80377b:	89 02                	mov    %eax,(%edx)
+  80377d:	85 ff                	test   %edi,%edi
+  80377f:	74 0d                	je     80378e <ipc_reply_recv+0x65>
+  803781:	a1 24 60 80 00       	mov    0x806024,%eax
+  803786:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80378c:	89 07                	mov    %eax,(%edi)
+  80378e:	a1 24 60 80 00       	mov    0x806024,%eax
+  803793:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80379c:	5b                   	pop    %ebx
+  80379d:	5e                   	pop    %esi
+  80379e:	5f                   	pop    %edi
+  80379f:	5d                   	pop    %ebp
+  8037a0:	c3                   	ret
+  8037a1:	ff 75 14             	push   0x14(%ebp)
+  8037a4:	53                   	push   %ebx
+  8037a5:	ff 75 0c             	push   0xc(%ebp)
+  8037a8:	ff 75 08             	push   0x8(%ebp)
+  8037ab:	e8 57 dd ff ff       	call   801507 <sys_ipc_try_send>
+  8037b0:	89 c2                	mov    %eax,%edx
+  8037b2:	c1 ea 1f             	shr    $0x1f,%edx
+  8037b5:	83 c4 10             	add    $0x10,%esp
+  8037b8:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8037bb:	0f 95 c1             	setne  %cl
+  8037be:	84 d1                	test   %dl,%cl
+  8037c0:	74 05                	je     8037c7 <ipc_reply_recv+0x9e>
+  8037c2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037c5:	75 12                	jne    8037d9 <ipc_reply_recv+0xb0>
+  8037c7:	83 ec 04             	sub    $0x4,%esp
+  8037ca:	57                   	push   %edi
+  8037cb:	56                   	push   %esi
+  8037cc:	ff 75 18             	push   0x18(%ebp)
+  8037cf:	e8 e3 fd ff ff       	call   8035b7 <ipc_recv>
+  8037d4:	83 c4 10             	add    $0x10,%esp
+  8037d7:	eb c0                	jmp    803799 <ipc_reply_recv+0x70>
+  8037d9:	83 ec 04             	sub    $0x4,%esp
+  8037dc:	50                   	push   %eax
+  8037dd:	ff 75 08             	push   0x8(%ebp)
+  8037e0:	68 00 46 80 00       	push   $0x804600
+  8037e5:	e8 6b cf ff ff       	call   800755 <cprintf>
+  8037ea:	83 c4 10             	add    $0x10,%esp
+  8037ed:	eb d8                	jmp    8037c7 <ipc_reply_recv+0x9e>
+  8037ef:	85 f6                	test   %esi,%esi
+  8037f1:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8037f6:	0f 45 c6             	cmovne %esi,%eax
+  8037f9:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8037fe:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803805:	e9 43 ff ff ff       	jmp    80374d <ipc_reply_recv+0x24>
+
+0080380a <ipc_find_env>:
+  80380a:	55                   	push   %ebp
+  80380b:	89 e5                	mov    %esp,%ebp
+  80380d:	83 ec 14             	sub    $0x14,%esp
+  803810:	ff 75 08             	push   0x8(%ebp)
+  803813:	e8 8d dc ff ff       	call   8014a5 <sys_env_service>
+  803818:	85 c0                	test   %eax,%eax
+  80381a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80381f:	0f 48 c2             	cmovs  %edx,%eax
+  803822:	c9                   	leave
+  803823:	c3                   	ret
+
+00803824 <pageref>:
+  803824:	55                   	push   %ebp
+  803825:	89 e5                	mov    %esp,%ebp
+  803827:	8b 45 08             	mov    0x8(%ebp),%eax
+  80382a:	89 c2                	mov    %eax,%edx
+  80382c:	c1 ea 16             	shr    $0x16,%edx
+  80382f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803836:	ba 00 00 00 00       	mov    $0x0,%edx
+  80383b:	f6 c1 01             	test   $0x1,%cl
+  80383e:	74 22                	je     803862 <pageref+0x3e>
+  803840:	c1 e8 0c             	shr    $0xc,%eax
+  803843:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80384a:	a8 01                	test   $0x1,%al
+  80384c:	74 14                	je     803862 <pageref+0x3e>
+  80384e:	c1 e8 0c             	shr    $0xc,%eax
+  803851:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803854:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80385b:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80385f:	0f b7 d2             	movzwl %dx,%edx
+  803862:	89 d0                	mov    %edx,%eax
+  803864:	5d                   	pop    %ebp
+  803865:	c3                   	ret
+
+00803866 <inet_ntoa>:
+  803866:	55                   	push   %ebp
+  803867:	89 e5                	mov    %esp,%ebp
+  803869:	57                   	push   %edi
+  80386a:	56                   	push   %esi
+  80386b:	53                   	push   %ebx
+  80386c:	83 ec 1c             	sub    $0x1c,%esp
+  80386f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803872:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  803875:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  803878:	bf 14 60 80 00       	mov    $0x806014,%edi
+  80387d:	0f b6 16             	movzbl (%esi),%edx
+  803880:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803885:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803888:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80388b:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803890:	f6 e2                	mul    %dl
+  803892:	66 c1 e8 0b          	shr    $0xb,%ax
+  803896:	89 c7                	mov    %eax,%edi
+  803898:	88 45 e0             	mov    %al,-0x20(%ebp)
+  80389b:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  80389e:	01 db                	add    %ebx,%ebx
+  8038a0:	89 d0                	mov    %edx,%eax
+  8038a2:	29 d8                	sub    %ebx,%eax
+  8038a4:	89 d6                	mov    %edx,%esi
+  8038a6:	89 fa                	mov    %edi,%edx
+  8038a8:	89 cb                	mov    %ecx,%ebx
+  8038aa:	83 c1 01             	add    $0x1,%ecx
+  8038ad:	0f b6 fb             	movzbl %bl,%edi
+  8038b0:	83 c0 30             	add    $0x30,%eax
+  8038b3:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+  8038b7:	89 f0                	mov    %esi,%eax
+  8038b9:	3c 09                	cmp    $0x9,%al
+  8038bb:	77 ce                	ja     80388b <inet_ntoa+0x25>
+  8038bd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8038c0:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8038c3:	88 16                	mov    %dl,(%esi)
+  8038c5:	84 c9                	test   %cl,%cl
+  8038c7:	74 4d                	je     803916 <inet_ntoa+0xb0>
+  8038c9:	0f b6 db             	movzbl %bl,%ebx
+  8038cc:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  8038cf:	01 d8                	add    %ebx,%eax
+  8038d1:	89 f9                	mov    %edi,%ecx
+  8038d3:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8038d6:	83 c1 01             	add    $0x1,%ecx
+  8038d9:	0f b6 10             	movzbl (%eax),%edx
+  8038dc:	88 51 ff             	mov    %dl,-0x1(%ecx)
+  8038df:	89 c2                	mov    %eax,%edx
+  8038e1:	83 e8 01             	sub    $0x1,%eax
+  8038e4:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  8038e7:	39 da                	cmp    %ebx,%edx
+  8038e9:	75 eb                	jne    8038d6 <inet_ntoa+0x70>
+  8038eb:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8038ee:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+  8038f2:	8d 78 01             	lea    0x1(%eax),%edi
+  8038f5:	c6 00 2e             	movb   $0x2e,(%eax)
+  8038f8:	83 c6 01             	add    $0x1,%esi
+  8038fb:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8038fe:	39 ce                	cmp    %ecx,%esi
+  803900:	0f 85 77 ff ff ff    	jne    80387d <inet_ntoa+0x17>
+  803906:	c6 00 00             	movb   $0x0,(%eax)
+  803909:	b8 14 60 80 00       	mov    $0x806014,%eax
+  80390e:	83 c4 1c             	add    $0x1c,%esp
+  803911:	5b                   	pop    %ebx
+  803912:	5e                   	pop    %esi
+  803913:	5f                   	pop    %edi
+  803914:	5d                   	pop    %ebp
+  803915:	c3                   	ret
+  803916:	89 f8                	mov    %edi,%eax
+  803918:	eb d8                	jmp    8038f2 <inet_ntoa+0x8c>
+
+0080391a <htons>:
+  80391a:	55                   	push   %ebp
+  80391b:	89 e5                	mov    %esp,%ebp
+  80391d:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803921:	66 c1 c0 08          	rol    $0x8,%ax
+  803925:	5d                   	pop    %ebp
+  803926:	c3                   	ret
+
+00803927 <ntohs>:
+  803927:	55                   	push   %ebp
+  803928:	89 e5                	mov    %esp,%ebp
+  80392a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80392e:	66 c1 c0 08          	rol    $0x8,%ax
+  803932:	5d                   	pop    %ebp
+  803933:	c3                   	ret
+
+00803934 <htonl>:
+  803934:	55                   	push   %ebp
+  803935:	89 e5                	mov    %esp,%ebp
+  803937:	8b 55 08             	mov    0x8(%ebp),%edx
+  80393a:	89 d0                	mov    %edx,%eax
+  80393c:	c1 e0 18             	shl    $0x18,%eax
+  80393f:	89 d1                	mov    %edx,%ecx
+  803941:	c1 e9 18             	shr    $0x18,%ecx
+  803944:	09 c8                	or     %ecx,%eax
+  803946:	89 d1                	mov    %edx,%ecx
+  803948:	c1 e1 08             	shl    $0x8,%ecx
+  80394b:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+  803951:	09 c8                	or     %ecx,%eax
+  803953:	c1 ea 08             	shr    $0x8,%edx
+  803956:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  80395c:	09 d0                	or     %edx,%eax
+  80395e:	5d                   	pop    %ebp
+  80395f:	c3                   	ret
+
+00803960 <inet_aton>:
+  803960:	55                   	push   %ebp
+  803961:	89 e5                	mov    %esp,%ebp
+  803963:	57                   	push   %edi
+  803964:	56                   	push   %esi
+  803965:	53                   	push   %ebx
+  803966:	83 ec 2c             	sub    $0x2c,%esp
+  803969:	8b 55 08             	mov    0x8(%ebp),%edx
+  80396c:	0f b6 0a             	movzbl (%edx),%ecx
+  80396f:	0f be c1             	movsbl %cl,%eax
+  803972:	83 e9 30             	sub    $0x30,%ecx
+  803975:	80 f9 09             	cmp    $0x9,%cl
+  803978:	0f 87 b6 01 00 00    	ja     803b34 <inet_aton+0x1d4>
+  80397e:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  803981:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803984:	e9 aa 00 00 00       	jmp    803a33 <inet_aton+0xd3>
+  803989:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  80398d:	89 c1                	mov    %eax,%ecx
+  80398f:	83 e1 df             	and    $0xffffffdf,%ecx
+  803992:	80 f9 58             	cmp    $0x58,%cl
+  803995:	74 10                	je     8039a7 <inet_aton+0x47>
+  803997:	83 c2 01             	add    $0x1,%edx
+  80399a:	0f be c0             	movsbl %al,%eax
+  80399d:	bf 08 00 00 00       	mov    $0x8,%edi
+  8039a2:	e9 9a 00 00 00       	jmp    803a41 <inet_aton+0xe1>
+  8039a7:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8039ab:	8d 52 02             	lea    0x2(%edx),%edx
+  8039ae:	bf 10 00 00 00       	mov    $0x10,%edi
+  8039b3:	e9 89 00 00 00       	jmp    803a41 <inet_aton+0xe1>
+  8039b8:	0f af d7             	imul   %edi,%edx
+  8039bb:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  8039bf:	0f be 01             	movsbl (%ecx),%eax
+  8039c2:	83 c1 01             	add    $0x1,%ecx
+  8039c5:	88 45 d7             	mov    %al,-0x29(%ebp)
+  8039c8:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  8039cb:	80 fb 09             	cmp    $0x9,%bl
+  8039ce:	76 e8                	jbe    8039b8 <inet_aton+0x58>
+  8039d0:	83 ff 10             	cmp    $0x10,%edi
+  8039d3:	75 2e                	jne    803a03 <inet_aton+0xa3>
+  8039d5:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  8039d9:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  8039dc:	83 e3 df             	and    $0xffffffdf,%ebx
+  8039df:	83 eb 41             	sub    $0x41,%ebx
+  8039e2:	80 fb 05             	cmp    $0x5,%bl
+  8039e5:	77 1c                	ja     803a03 <inet_aton+0xa3>
+  8039e7:	c1 e2 04             	shl    $0x4,%edx
+  8039ea:	83 c0 0a             	add    $0xa,%eax
+  8039ed:	89 f3                	mov    %esi,%ebx
+  8039ef:	80 fb 1a             	cmp    $0x1a,%bl
+  8039f2:	19 db                	sbb    %ebx,%ebx
+  8039f4:	83 e3 20             	and    $0x20,%ebx
+  8039f7:	83 c3 41             	add    $0x41,%ebx
+  8039fa:	29 d8                	sub    %ebx,%eax
+  8039fc:	09 c2                	or     %eax,%edx
+  8039fe:	0f be 01             	movsbl (%ecx),%eax
+  803a01:	eb bf                	jmp    8039c2 <inet_aton+0x62>
+  803a03:	83 f8 2e             	cmp    $0x2e,%eax
+  803a06:	75 46                	jne    803a4e <inet_aton+0xee>
+  803a08:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803a0b:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803a0e:	39 f0                	cmp    %esi,%eax
+  803a10:	0f 84 25 01 00 00    	je     803b3b <inet_aton+0x1db>
+  803a16:	83 c0 04             	add    $0x4,%eax
+  803a19:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803a1c:	89 50 fc             	mov    %edx,-0x4(%eax)
+  803a1f:	89 ca                	mov    %ecx,%edx
+  803a21:	0f b6 09             	movzbl (%ecx),%ecx
+  803a24:	0f be c1             	movsbl %cl,%eax
+  803a27:	83 e9 30             	sub    $0x30,%ecx
+  803a2a:	80 f9 09             	cmp    $0x9,%cl
+  803a2d:	0f 87 17 01 00 00    	ja     803b4a <inet_aton+0x1ea>
+  803a33:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803a38:	83 f8 30             	cmp    $0x30,%eax
+  803a3b:	0f 84 48 ff ff ff    	je     803989 <inet_aton+0x29>
+  803a41:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803a44:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a49:	e9 77 ff ff ff       	jmp    8039c5 <inet_aton+0x65>
+  803a4e:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803a52:	89 d6                	mov    %edx,%esi
+  803a54:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803a57:	85 c0                	test   %eax,%eax
+  803a59:	74 2e                	je     803a89 <inet_aton+0x129>
+  803a5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a60:	89 fa                	mov    %edi,%edx
+  803a62:	80 fa 1f             	cmp    $0x1f,%dl
+  803a65:	0f 86 d5 00 00 00    	jbe    803b40 <inet_aton+0x1e0>
+  803a6b:	84 c0                	test   %al,%al
+  803a6d:	0f 88 cd 00 00 00    	js     803b40 <inet_aton+0x1e0>
+  803a73:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803a76:	83 f9 04             	cmp    $0x4,%ecx
+  803a79:	76 0e                	jbe    803a89 <inet_aton+0x129>
+  803a7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a80:	83 f8 20             	cmp    $0x20,%eax
+  803a83:	0f 85 b7 00 00 00    	jne    803b40 <inet_aton+0x1e0>
+  803a89:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803a8c:	89 d8                	mov    %ebx,%eax
+  803a8e:	29 c8                	sub    %ecx,%eax
+  803a90:	c1 f8 02             	sar    $0x2,%eax
+  803a93:	8d 48 01             	lea    0x1(%eax),%ecx
+  803a96:	83 f8 02             	cmp    $0x2,%eax
+  803a99:	74 7a                	je     803b15 <inet_aton+0x1b5>
+  803a9b:	83 f9 03             	cmp    $0x3,%ecx
+  803a9e:	7f 49                	jg     803ae9 <inet_aton+0x189>
+  803aa0:	85 c9                	test   %ecx,%ecx
+  803aa2:	0f 84 98 00 00 00    	je     803b40 <inet_aton+0x1e0>
+  803aa8:	83 f9 02             	cmp    $0x2,%ecx
+  803aab:	75 19                	jne    803ac6 <inet_aton+0x166>
+  803aad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ab2:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803ab8:	0f 87 82 00 00 00    	ja     803b40 <inet_aton+0x1e0>
+  803abe:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803ac1:	c1 e0 18             	shl    $0x18,%eax
+  803ac4:	09 c6                	or     %eax,%esi
+  803ac6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803acb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803acf:	74 6f                	je     803b40 <inet_aton+0x1e0>
+  803ad1:	83 ec 0c             	sub    $0xc,%esp
+  803ad4:	56                   	push   %esi
+  803ad5:	e8 5a fe ff ff       	call   803934 <htonl>
+  803ada:	83 c4 10             	add    $0x10,%esp
+  803add:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803ae0:	89 06                	mov    %eax,(%esi)
+  803ae2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ae7:	eb 57                	jmp    803b40 <inet_aton+0x1e0>
+  803ae9:	83 f9 04             	cmp    $0x4,%ecx
+  803aec:	75 d8                	jne    803ac6 <inet_aton+0x166>
+  803aee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803af3:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803af9:	77 45                	ja     803b40 <inet_aton+0x1e0>
+  803afb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803afe:	c1 e0 18             	shl    $0x18,%eax
+  803b01:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803b04:	c1 e1 10             	shl    $0x10,%ecx
+  803b07:	09 c8                	or     %ecx,%eax
+  803b09:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803b0c:	c1 e1 08             	shl    $0x8,%ecx
+  803b0f:	09 c8                	or     %ecx,%eax
+  803b11:	09 c6                	or     %eax,%esi
+  803b13:	eb b1                	jmp    803ac6 <inet_aton+0x166>
+  803b15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b1a:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803b20:	77 1e                	ja     803b40 <inet_aton+0x1e0>
+  803b22:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803b25:	c1 e0 18             	shl    $0x18,%eax
+  803b28:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803b2b:	c1 e1 10             	shl    $0x10,%ecx
+  803b2e:	09 c8                	or     %ecx,%eax
+  803b30:	09 c6                	or     %eax,%esi
+  803b32:	eb 92                	jmp    803ac6 <inet_aton+0x166>
+  803b34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b39:	eb 05                	jmp    803b40 <inet_aton+0x1e0>
+  803b3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b40:	89 c8                	mov    %ecx,%eax
+  803b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b45:	5b                   	pop    %ebx
+  803b46:	5e                   	pop    %esi
+  803b47:	5f                   	pop    %edi
+  803b48:	5d                   	pop    %ebp
+  803b49:	c3                   	ret
+  803b4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b4f:	eb ef                	jmp    803b40 <inet_aton+0x1e0>
+
+00803b51 <inet_addr>:
+  803b51:	55                   	push   %ebp
+  803b52:	89 e5                	mov    %esp,%ebp
+  803b54:	83 ec 20             	sub    $0x20,%esp
+  803b57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b5a:	50                   	push   %eax
+  803b5b:	ff 75 08             	push   0x8(%ebp)
+  803b5e:	e8 fd fd ff ff       	call   803960 <inet_aton>
+  803b63:	89 c2                	mov    %eax,%edx
+  803b65:	83 c4 10             	add    $0x10,%esp
+  803b68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803b6d:	85 d2                	test   %edx,%edx
+  803b6f:	75 02                	jne    803b73 <inet_addr+0x22>
+  803b71:	c9                   	leave
+  803b72:	c3                   	ret
+  803b73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b76:	eb f9                	jmp    803b71 <inet_addr+0x20>
+
+00803b78 <ntohl>:
+  803b78:	55                   	push   %ebp
+  803b79:	89 e5                	mov    %esp,%ebp
+  803b7b:	83 ec 14             	sub    $0x14,%esp
+  803b7e:	ff 75 08             	push   0x8(%ebp)
+  803b81:	e8 ae fd ff ff       	call   803934 <htonl>
+  803b86:	83 c4 10             	add    $0x10,%esp
+  803b89:	c9                   	leave
+  803b8a:	c3                   	ret
+
+00803b8b <__udivmoddi4>:
+  803b8b:	55                   	push   %ebp
+  803b8c:	57                   	push   %edi
+  803b8d:	56                   	push   %esi
+  803b8e:	53                   	push   %ebx
+  803b8f:	83 ec 24             	sub    $0x24,%esp
+  803b92:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b96:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b9a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b9e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803ba2:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803ba6:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803baa:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803bae:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803bb2:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803bc5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803bcc:	00 
+  803bcd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803bd4:	00 
+  803bd5:	89 fb                	mov    %edi,%ebx
+  803bd7:	eb 08                	jmp    803be1 <__udivmoddi4+0x56>
+  803bd9:	83 e9 01             	sub    $0x1,%ecx
+  803bdc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803bdf:	74 68                	je     803c49 <__udivmoddi4+0xbe>
+  803be1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803be5:	01 c0                	add    %eax,%eax
+  803be7:	89 c6                	mov    %eax,%esi
+  803be9:	89 d7                	mov    %edx,%edi
+  803beb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803bef:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803bf3:	0f ad d0             	shrd   %cl,%edx,%eax
+  803bf6:	d3 ea                	shr    %cl,%edx
+  803bf8:	f6 c1 20             	test   $0x20,%cl
+  803bfb:	74 04                	je     803c01 <__udivmoddi4+0x76>
+  803bfd:	89 d0                	mov    %edx,%eax
+  803bff:	31 d2                	xor    %edx,%edx
+  803c01:	83 e0 01             	and    $0x1,%eax
+  803c04:	89 04 24             	mov    %eax,(%esp)
+  803c07:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803c0e:	00 
+  803c0f:	8b 04 24             	mov    (%esp),%eax
+  803c12:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803c16:	09 f0                	or     %esi,%eax
+  803c18:	09 fa                	or     %edi,%edx
+  803c1a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803c1e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803c22:	39 f0                	cmp    %esi,%eax
+  803c24:	89 d5                	mov    %edx,%ebp
+  803c26:	19 fd                	sbb    %edi,%ebp
+  803c28:	72 af                	jb     803bd9 <__udivmoddi4+0x4e>
+  803c2a:	29 f0                	sub    %esi,%eax
+  803c2c:	19 fa                	sbb    %edi,%edx
+  803c2e:	89 cf                	mov    %ecx,%edi
+  803c30:	c1 ef 05             	shr    $0x5,%edi
+  803c33:	83 e7 01             	and    $0x1,%edi
+  803c36:	89 fe                	mov    %edi,%esi
+  803c38:	83 f6 01             	xor    $0x1,%esi
+  803c3b:	d3 e6                	shl    %cl,%esi
+  803c3d:	d3 e7                	shl    %cl,%edi
+  803c3f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803c43:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803c47:	eb 90                	jmp    803bd9 <__udivmoddi4+0x4e>
+  803c49:	85 db                	test   %ebx,%ebx
+  803c4b:	74 05                	je     803c52 <__udivmoddi4+0xc7>
+  803c4d:	89 03                	mov    %eax,(%ebx)
+  803c4f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803c52:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c56:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c5a:	83 c4 24             	add    $0x24,%esp
+  803c5d:	5b                   	pop    %ebx
+  803c5e:	5e                   	pop    %esi
+  803c5f:	5f                   	pop    %edi
+  803c60:	5d                   	pop    %ebp
+  803c61:	c3                   	ret
+
+00803c62 <__udivdi3>:
+  803c62:	83 ec 08             	sub    $0x8,%esp
+  803c65:	6a 00                	push   $0x0
+  803c67:	ff 74 24 1c          	push   0x1c(%esp)
+  803c6b:	ff 74 24 1c          	push   0x1c(%esp)
+  803c6f:	ff 74 24 1c          	push   0x1c(%esp)
+  803c73:	ff 74 24 1c          	push   0x1c(%esp)
+  803c77:	e8 0f ff ff ff       	call   803b8b <__udivmoddi4>
+  803c7c:	83 c4 1c             	add    $0x1c,%esp
+  803c7f:	c3                   	ret
+
+00803c80 <__umoddi3>:
+  803c80:	83 ec 18             	sub    $0x18,%esp
+  803c83:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803c87:	50                   	push   %eax
+  803c88:	ff 74 24 2c          	push   0x2c(%esp)
+  803c8c:	ff 74 24 2c          	push   0x2c(%esp)
+  803c90:	ff 74 24 2c          	push   0x2c(%esp)
+  803c94:	ff 74 24 2c          	push   0x2c(%esp)
+  803c98:	e8 ee fe ff ff       	call   803b8b <__udivmoddi4>
+  803c9d:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803ca1:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803ca5:	83 c4 2c             	add    $0x2c,%esp
+  803ca8:	c3                   	ret
+
+00803ca9 <__divdi3>:
+  803ca9:	53                   	push   %ebx
+  803caa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803cae:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803cb2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803cb6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803cba:	85 d2                	test   %edx,%edx
+  803cbc:	78 12                	js     803cd0 <__divdi3+0x27>
+  803cbe:	85 db                	test   %ebx,%ebx
+  803cc0:	78 2e                	js     803cf0 <__divdi3+0x47>
+  803cc2:	53                   	push   %ebx
+  803cc3:	51                   	push   %ecx
+  803cc4:	52                   	push   %edx
+  803cc5:	50                   	push   %eax
+  803cc6:	e8 97 ff ff ff       	call   803c62 <__udivdi3>
+  803ccb:	83 c4 10             	add    $0x10,%esp
+  803cce:	eb 1e                	jmp    803cee <__divdi3+0x45>
+  803cd0:	f7 d8                	neg    %eax
+  803cd2:	83 d2 00             	adc    $0x0,%edx
+  803cd5:	f7 da                	neg    %edx
+  803cd7:	85 db                	test   %ebx,%ebx
+  803cd9:	78 2a                	js     803d05 <__divdi3+0x5c>
+  803cdb:	53                   	push   %ebx
+  803cdc:	51                   	push   %ecx
+  803cdd:	52                   	push   %edx
+  803cde:	50                   	push   %eax
+  803cdf:	e8 7e ff ff ff       	call   803c62 <__udivdi3>
+  803ce4:	83 c4 10             	add    $0x10,%esp
+  803ce7:	f7 d8                	neg    %eax
+  803ce9:	83 d2 00             	adc    $0x0,%edx
+  803cec:	f7 da                	neg    %edx
+  803cee:	5b                   	pop    %ebx
+  803cef:	c3                   	ret
+  803cf0:	f7 d9                	neg    %ecx
+  803cf2:	83 d3 00             	adc    $0x0,%ebx
+  803cf5:	f7 db                	neg    %ebx
+  803cf7:	53                   	push   %ebx
+  803cf8:	51                   	push   %ecx
+  803cf9:	52                   	push   %edx
+  803cfa:	50                   	push   %eax
+  803cfb:	e8 62 ff ff ff       	call   803c62 <__udivdi3>
+  803d00:	83 c4 10             	add    $0x10,%esp
+  803d03:	eb e2                	jmp    803ce7 <__divdi3+0x3e>
+  803d05:	f7 d9                	neg    %ecx
+  803d07:	83 d3 00             	adc    $0x0,%ebx
+  803d0a:	f7 db                	neg    %ebx
+  803d0c:	53                   	push   %ebx
+  803d0d:	51                   	push   %ecx
+  803d0e:	52                   	push   %edx
+  803d0f:	50                   	push   %eax
+  803d10:	e8 4d ff ff ff       	call   803c62 <__udivdi3>
+  803d15:	83 c4 10             	add    $0x10,%esp
+  803d18:	eb d4                	jmp    803cee <__divdi3+0x45>
+
+00803d1a <__moddi3>:
+  803d1a:	55                   	push   %ebp
+  803d1b:	57                   	push   %edi
+  803d1c:	56                   	push   %esi
+  803d1d:	53                   	push   %ebx
+  803d1e:	83 ec 0c             	sub    $0xc,%esp
+  803d21:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803d25:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803d29:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d2d:	89 e9                	mov    %ebp,%ecx
+  803d2f:	f7 d9                	neg    %ecx
+  803d31:	89 d0                	mov    %edx,%eax
+  803d33:	83 d0 00             	adc    $0x0,%eax
+  803d36:	f7 d8                	neg    %eax
+  803d38:	0f 49 e9             	cmovns %ecx,%ebp
+  803d3b:	0f 49 d0             	cmovns %eax,%edx
+  803d3e:	52                   	push   %edx
+  803d3f:	55                   	push   %ebp
+  803d40:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803d44:	f7 da                	neg    %edx
+  803d46:	89 d8                	mov    %ebx,%eax
+  803d48:	83 d0 00             	adc    $0x0,%eax
+  803d4b:	f7 d8                	neg    %eax
+  803d4d:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803d52:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803d56:	0f 48 c3             	cmovs  %ebx,%eax
+  803d59:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803d5d:	ff 74 24 0c          	push   0xc(%esp)
+  803d61:	ff 74 24 0c          	push   0xc(%esp)
+  803d65:	e8 16 ff ff ff       	call   803c80 <__umoddi3>
+  803d6a:	83 c4 10             	add    $0x10,%esp
+  803d6d:	85 db                	test   %ebx,%ebx
+  803d6f:	78 08                	js     803d79 <__moddi3+0x5f>
+  803d71:	83 c4 0c             	add    $0xc,%esp
+  803d74:	5b                   	pop    %ebx
+  803d75:	5e                   	pop    %esi
+  803d76:	5f                   	pop    %edi
+  803d77:	5d                   	pop    %ebp
+  803d78:	c3                   	ret
+  803d79:	f7 d8                	neg    %eax
+  803d7b:	83 d2 00             	adc    $0x0,%edx
+  803d7e:	f7 da                	neg    %edx
+  803d80:	eb ef                	jmp    803d71 <__moddi3+0x57>
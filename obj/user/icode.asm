@@ -0,0 +1,6213 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+  80003e:	c7 05 00 50 80 00 00 	movl   $0x804100,0x805000
+  800045:	41 80 00 
+  800048:	68 06 41 80 00       	push   $0x804106
+  80004d:	e8 36 02 00 00       	call   800288 <cprintf>
+  800052:	c7 04 24 15 41 80 00 	movl   $0x804115,(%esp)
+  800059:	e8 2a 02 00 00       	call   800288 <cprintf>
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 28 41 80 00       	push   $0x804128
+  800068:	e8 76 20 00 00       	call   8020e3 <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 51 41 80 00       	push   $0x804151
+  80007e:	e8 05 02 00 00       	call   800288 <cprintf>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+  80008e:	50                   	push   %eax
+  80008f:	68 2e 41 80 00       	push   $0x80412e
+  800094:	6a 0f                	push   $0xf
+  800096:	68 44 41 80 00       	push   $0x804144
+  80009b:	e8 0d 01 00 00       	call   8001ad <_panic>
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 4d 0c 00 00       	call   800cf7 <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 6a 18 00 00       	call   801926 <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 64 41 80 00       	push   $0x804164
+  8000cb:	e8 b8 01 00 00       	call   800288 <cprintf>
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 12 17 00 00       	call   8017ea <close>
+  8000d8:	c7 04 24 78 41 80 00 	movl   $0x804178,(%esp)
+  8000df:	e8 a4 01 00 00       	call   800288 <cprintf>
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 8c 41 80 00       	push   $0x80418c
+  8000f0:	68 95 41 80 00       	push   $0x804195
+  8000f5:	68 9f 41 80 00       	push   $0x80419f
+  8000fa:	68 9e 41 80 00       	push   $0x80419e
+  8000ff:	e8 37 29 00 00       	call   802a3b <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 bb 41 80 00       	push   $0x8041bb
+  800113:	e8 70 01 00 00       	call   800288 <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+  800122:	50                   	push   %eax
+  800123:	68 a4 41 80 00       	push   $0x8041a4
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 44 41 80 00       	push   $0x804144
+  80012f:	e8 79 00 00 00       	call   8001ad <_panic>
+
+00800134 <libmain>:
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	56                   	push   %esi
+  800138:	53                   	push   %ebx
+  800139:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80013f:	e8 31 0c 00 00       	call   800d75 <sys_getenvid>
+  800144:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800149:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80014f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800154:	a3 14 60 80 00       	mov    %eax,0x806014
+  800159:	85 db                	test   %ebx,%ebx
+  80015b:	7e 07                	jle    800164 <libmain+0x30>
+  80015d:	8b 06                	mov    (%esi),%eax
+  80015f:	a3 00 50 80 00       	mov    %eax,0x805000
+  800164:	83 ec 08             	sub    $0x8,%esp
+  800167:	56                   	push   %esi
+  800168:	53                   	push   %ebx
+  800169:	e8 c5 fe ff ff       	call   800033 <umain>
+  80016e:	e8 0a 00 00 00       	call   80017d <exit>
+  800173:	83 c4 10             	add    $0x10,%esp
+  800176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800179:	5b                   	pop    %ebx
+  80017a:	5e                   	pop    %esi
+  80017b:	5d                   	pop    %ebp
+  80017c:	c3                   	ret
+
+0080017d <exit>:
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	83 ec 08             	sub    $0x8,%esp
+  800183:	a1 14 60 80 00       	mov    0x806014,%eax
+  800188:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80018e:	85 c0                	test   %eax,%eax
+  800190:	75 14                	jne    8001a6 <exit+0x29>
+  800192:	e8 80 16 00 00       	call   801817 <close_all>
+  800197:	83 ec 0c             	sub    $0xc,%esp
+  80019a:	6a 00                	push   $0x0
+  80019c:	e8 93 0b 00 00       	call   800d34 <sys_env_destroy>
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+  8001a6:	e8 f6 12 00 00       	call   8014a1 <sys_lease_complete>
+  8001ab:	eb e5                	jmp    800192 <exit+0x15>
+
+008001ad <_panic>:
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	56                   	push   %esi
+  8001b1:	53                   	push   %ebx
+  8001b2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8001b5:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001bb:	e8 b5 0b 00 00       	call   800d75 <sys_getenvid>
+  8001c0:	83 ec 0c             	sub    $0xc,%esp
+  8001c3:	ff 75 0c             	push   0xc(%ebp)
+  8001c6:	ff 75 08             	push   0x8(%ebp)
+  8001c9:	56                   	push   %esi
+  8001ca:	50                   	push   %eax
+  8001cb:	68 d8 41 80 00       	push   $0x8041d8
+  8001d0:	e8 b3 00 00 00       	call   800288 <cprintf>
+  8001d5:	83 c4 18             	add    $0x18,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	ff 75 10             	push   0x10(%ebp)
+  8001dc:	e8 56 00 00 00       	call   800237 <vcprintf>
+  8001e1:	c7 04 24 ef 46 80 00 	movl   $0x8046ef,(%esp)
+  8001e8:	e8 9b 00 00 00       	call   800288 <cprintf>
+  8001ed:	83 c4 10             	add    $0x10,%esp
+  8001f0:	cc                   	int3
+  8001f1:	eb fd                	jmp    8001f0 <_panic+0x43>
+
+008001f3 <putch>:
+  8001f3:	55                   	push   %ebp
+  8001f4:	89 e5                	mov    %esp,%ebp
+  8001f6:	53                   	push   %ebx
+  8001f7:	83 ec 04             	sub    $0x4,%esp
+  8001fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001fd:	8b 13                	mov    (%ebx),%edx
+  8001ff:	8d 42 01             	lea    0x1(%edx),%eax
+  800202:	89 03                	mov    %eax,(%ebx)
+  800204:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800207:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80020b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800210:	74 09                	je     80021b <putch+0x28>
+  800212:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800216:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800219:	c9                   	leave
+  80021a:	c3                   	ret
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	68 ff 00 00 00       	push   $0xff
+  800223:	8d 43 08             	lea    0x8(%ebx),%eax
+  800226:	50                   	push   %eax
+  800227:	e8 cb 0a 00 00       	call   800cf7 <sys_cputs>
+  80022c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800232:	83 c4 10             	add    $0x10,%esp
+  800235:	eb db                	jmp    800212 <putch+0x1f>
+
+00800237 <vcprintf>:
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800240:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800247:	00 00 00 
+  80024a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800251:	00 00 00 
+  800254:	ff 75 0c             	push   0xc(%ebp)
+  800257:	ff 75 08             	push   0x8(%ebp)
+  80025a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800260:	50                   	push   %eax
+  800261:	68 f3 01 80 00       	push   $0x8001f3
+  800266:	e8 1c 01 00 00       	call   800387 <vprintfmt>
+  80026b:	83 c4 08             	add    $0x8,%esp
+  80026e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800274:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80027a:	50                   	push   %eax
+  80027b:	e8 77 0a 00 00       	call   800cf7 <sys_cputs>
+  800280:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800286:	c9                   	leave
+  800287:	c3                   	ret
+
+00800288 <cprintf>:
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	83 ec 10             	sub    $0x10,%esp
+  80028e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800291:	50                   	push   %eax
+  800292:	ff 75 08             	push   0x8(%ebp)
+  800295:	e8 9d ff ff ff       	call   800237 <vcprintf>
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+0080029c <printnum>:
+  80029c:	55                   	push   %ebp
+  80029d:	89 e5                	mov    %esp,%ebp
+  80029f:	57                   	push   %edi
+  8002a0:	56                   	push   %esi
+  8002a1:	53                   	push   %ebx
+  8002a2:	83 ec 1c             	sub    $0x1c,%esp
+  8002a5:	89 c3                	mov    %eax,%ebx
+  8002a7:	89 d6                	mov    %edx,%esi
+  8002a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002af:	89 d1                	mov    %edx,%ecx
+  8002b1:	89 c2                	mov    %eax,%edx
+  8002b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002bf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002c6:	39 c2                	cmp    %eax,%edx
+  8002c8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002cb:	73 4b                	jae    800318 <printnum+0x7c>
+  8002cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002d0:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8002d3:	85 ff                	test   %edi,%edi
+  8002d5:	7e 11                	jle    8002e8 <printnum+0x4c>
+  8002d7:	83 ec 08             	sub    $0x8,%esp
+  8002da:	56                   	push   %esi
+  8002db:	ff 75 18             	push   0x18(%ebp)
+  8002de:	ff d3                	call   *%ebx
+  8002e0:	83 c4 10             	add    $0x10,%esp
+  8002e3:	83 ef 01             	sub    $0x1,%edi
+  8002e6:	75 ef                	jne    8002d7 <printnum+0x3b>
+  8002e8:	83 ec 08             	sub    $0x8,%esp
+  8002eb:	56                   	push   %esi
+  8002ec:	83 ec 04             	sub    $0x4,%esp
+  8002ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f2:	ff 75 e0             	push   -0x20(%ebp)
+  8002f5:	ff 75 dc             	push   -0x24(%ebp)
+  8002f8:	ff 75 d8             	push   -0x28(%ebp)
+  8002fb:	e8 f9 3c 00 00       	call   803ff9 <__umoddi3>
+  800300:	83 c4 14             	add    $0x14,%esp
+  800303:	0f be 80 fb 41 80 00 	movsbl 0x8041fb(%eax),%eax
+  80030a:	50                   	push   %eax
+  80030b:	ff d3                	call   *%ebx
+  80030d:	83 c4 10             	add    $0x10,%esp
+  800310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800313:	5b                   	pop    %ebx
+  800314:	5e                   	pop    %esi
+  800315:	5f                   	pop    %edi
+  800316:	5d                   	pop    %ebp
+  800317:	c3                   	ret
+  800318:	83 ec 0c             	sub    $0xc,%esp
+  80031b:	ff 75 18             	push   0x18(%ebp)
+  80031e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800321:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800324:	52                   	push   %edx
+  800325:	50                   	push   %eax
+  800326:	83 ec 08             	sub    $0x8,%esp
+  800329:	ff 75 e4             	push   -0x1c(%ebp)
+  80032c:	ff 75 e0             	push   -0x20(%ebp)
+  80032f:	ff 75 dc             	push   -0x24(%ebp)
+  800332:	ff 75 d8             	push   -0x28(%ebp)
+  800335:	e8 a1 3c 00 00       	call   803fdb <__udivdi3>
+  80033a:	83 c4 18             	add    $0x18,%esp
+  80033d:	52                   	push   %edx
+  80033e:	50                   	push   %eax
+  80033f:	89 f2                	mov    %esi,%edx
+  800341:	89 d8                	mov    %ebx,%eax
+  800343:	e8 54 ff ff ff       	call   80029c <printnum>
+  800348:	83 c4 20             	add    $0x20,%esp
+  80034b:	eb 9b                	jmp    8002e8 <printnum+0x4c>
+
+0080034d <sprintputch>:
+  80034d:	55                   	push   %ebp
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800353:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800357:	8b 10                	mov    (%eax),%edx
+  800359:	3b 50 04             	cmp    0x4(%eax),%edx
+  80035c:	73 0a                	jae    800368 <sprintputch+0x1b>
+  80035e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800361:	89 08                	mov    %ecx,(%eax)
+  800363:	8b 45 08             	mov    0x8(%ebp),%eax
+  800366:	88 02                	mov    %al,(%edx)
+  800368:	5d                   	pop    %ebp
+  800369:	c3                   	ret
+
+0080036a <printfmt>:
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	83 ec 08             	sub    $0x8,%esp
+  800370:	8d 45 14             	lea    0x14(%ebp),%eax
+  800373:	50                   	push   %eax
+  800374:	ff 75 10             	push   0x10(%ebp)
+  800377:	ff 75 0c             	push   0xc(%ebp)
+  80037a:	ff 75 08             	push   0x8(%ebp)
+  80037d:	e8 05 00 00 00       	call   800387 <vprintfmt>
+  800382:	83 c4 10             	add    $0x10,%esp
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+
+00800387 <vprintfmt>:
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	57                   	push   %edi
+  80038b:	56                   	push   %esi
+  80038c:	53                   	push   %ebx
+  80038d:	83 ec 2c             	sub    $0x2c,%esp
+  800390:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800393:	89 df                	mov    %ebx,%edi
+  800395:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800398:	8b 45 10             	mov    0x10(%ebp),%eax
+  80039b:	8d 70 01             	lea    0x1(%eax),%esi
+  80039e:	0f b6 00             	movzbl (%eax),%eax
+  8003a1:	83 f8 25             	cmp    $0x25,%eax
+  8003a4:	74 1e                	je     8003c4 <vprintfmt+0x3d>
+  8003a6:	85 c0                	test   %eax,%eax
+  8003a8:	0f 84 15 05 00 00    	je     8008c3 <vprintfmt+0x53c>
+  8003ae:	83 ec 08             	sub    $0x8,%esp
+  8003b1:	53                   	push   %ebx
+  8003b2:	50                   	push   %eax
+  8003b3:	ff d7                	call   *%edi
+  8003b5:	83 c6 01             	add    $0x1,%esi
+  8003b8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003bc:	83 c4 10             	add    $0x10,%esp
+  8003bf:	83 f8 25             	cmp    $0x25,%eax
+  8003c2:	75 e2                	jne    8003a6 <vprintfmt+0x1f>
+  8003c4:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8003c8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8003cf:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003d6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8003dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003e2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8003e5:	8d 56 01             	lea    0x1(%esi),%edx
+  8003e8:	0f b6 0e             	movzbl (%esi),%ecx
+  8003eb:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003ee:	3c 55                	cmp    $0x55,%al
+  8003f0:	0f 87 3b 04 00 00    	ja     800831 <vprintfmt+0x4aa>
+  8003f6:	0f b6 c0             	movzbl %al,%eax
+  8003f9:	ff 24 85 40 43 80 00 	jmp    *0x804340(,%eax,4)
+  800400:	89 75 10             	mov    %esi,0x10(%ebp)
+  800403:	eb 93                	jmp    800398 <vprintfmt+0x11>
+  800405:	89 d6                	mov    %edx,%esi
+  800407:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80040b:	eb d8                	jmp    8003e5 <vprintfmt+0x5e>
+  80040d:	89 d6                	mov    %edx,%esi
+  80040f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800413:	eb d0                	jmp    8003e5 <vprintfmt+0x5e>
+  800415:	0f b6 c9             	movzbl %cl,%ecx
+  800418:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80041b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80041e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800422:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800425:	83 f9 09             	cmp    $0x9,%ecx
+  800428:	77 6f                	ja     800499 <vprintfmt+0x112>
+  80042a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80042d:	83 c2 01             	add    $0x1,%edx
+  800430:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800433:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800437:	0f be 02             	movsbl (%edx),%eax
+  80043a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80043d:	83 fe 09             	cmp    $0x9,%esi
+  800440:	76 eb                	jbe    80042d <vprintfmt+0xa6>
+  800442:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800445:	89 d6                	mov    %edx,%esi
+  800447:	eb 13                	jmp    80045c <vprintfmt+0xd5>
+  800449:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044c:	8b 00                	mov    (%eax),%eax
+  80044e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800451:	8b 45 14             	mov    0x14(%ebp),%eax
+  800454:	8d 40 04             	lea    0x4(%eax),%eax
+  800457:	89 45 14             	mov    %eax,0x14(%ebp)
+  80045a:	89 d6                	mov    %edx,%esi
+  80045c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800460:	79 83                	jns    8003e5 <vprintfmt+0x5e>
+  800462:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800465:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800468:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80046f:	e9 71 ff ff ff       	jmp    8003e5 <vprintfmt+0x5e>
+  800474:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800477:	85 c9                	test   %ecx,%ecx
+  800479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047e:	0f 49 c1             	cmovns %ecx,%eax
+  800481:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800484:	89 d6                	mov    %edx,%esi
+  800486:	e9 5a ff ff ff       	jmp    8003e5 <vprintfmt+0x5e>
+  80048b:	89 d6                	mov    %edx,%esi
+  80048d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800494:	e9 4c ff ff ff       	jmp    8003e5 <vprintfmt+0x5e>
+  800499:	89 d6                	mov    %edx,%esi
+  80049b:	eb bf                	jmp    80045c <vprintfmt+0xd5>
+  80049d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8004a1:	89 d6                	mov    %edx,%esi
+  8004a3:	e9 3d ff ff ff       	jmp    8003e5 <vprintfmt+0x5e>
+  8004a8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8d 70 04             	lea    0x4(%eax),%esi
+  8004b1:	83 ec 08             	sub    $0x8,%esp
+  8004b4:	53                   	push   %ebx
+  8004b5:	ff 30                	push   (%eax)
+  8004b7:	ff d7                	call   *%edi
+  8004b9:	83 c4 10             	add    $0x10,%esp
+  8004bc:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004bf:	e9 d4 fe ff ff       	jmp    800398 <vprintfmt+0x11>
+  8004c4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ca:	8d 70 04             	lea    0x4(%eax),%esi
+  8004cd:	8b 10                	mov    (%eax),%edx
+  8004cf:	89 d0                	mov    %edx,%eax
+  8004d1:	f7 d8                	neg    %eax
+  8004d3:	0f 48 c2             	cmovs  %edx,%eax
+  8004d6:	83 f8 12             	cmp    $0x12,%eax
+  8004d9:	7f 23                	jg     8004fe <vprintfmt+0x177>
+  8004db:	8b 14 85 a0 44 80 00 	mov    0x8044a0(,%eax,4),%edx
+  8004e2:	85 d2                	test   %edx,%edx
+  8004e4:	74 18                	je     8004fe <vprintfmt+0x177>
+  8004e6:	52                   	push   %edx
+  8004e7:	68 1d 46 80 00       	push   $0x80461d
+  8004ec:	53                   	push   %ebx
+  8004ed:	57                   	push   %edi
+  8004ee:	e8 77 fe ff ff       	call   80036a <printfmt>
+  8004f3:	83 c4 10             	add    $0x10,%esp
+  8004f6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004f9:	e9 9a fe ff ff       	jmp    800398 <vprintfmt+0x11>
+  8004fe:	50                   	push   %eax
+  8004ff:	68 13 42 80 00       	push   $0x804213
+  800504:	53                   	push   %ebx
+  800505:	57                   	push   %edi
+  800506:	e8 5f fe ff ff       	call   80036a <printfmt>
+  80050b:	83 c4 10             	add    $0x10,%esp
+  80050e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800511:	e9 82 fe ff ff       	jmp    800398 <vprintfmt+0x11>
+  800516:	89 55 10             	mov    %edx,0x10(%ebp)
+  800519:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051c:	83 c0 04             	add    $0x4,%eax
+  80051f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800522:	8b 45 14             	mov    0x14(%ebp),%eax
+  800525:	8b 00                	mov    (%eax),%eax
+  800527:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80052a:	85 c0                	test   %eax,%eax
+  80052c:	0f 84 61 03 00 00    	je     800893 <vprintfmt+0x50c>
+  800532:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800536:	7e 06                	jle    80053e <vprintfmt+0x1b7>
+  800538:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80053c:	75 29                	jne    800567 <vprintfmt+0x1e0>
+  80053e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800541:	8d 70 01             	lea    0x1(%eax),%esi
+  800544:	0f b6 00             	movzbl (%eax),%eax
+  800547:	0f be d0             	movsbl %al,%edx
+  80054a:	85 d2                	test   %edx,%edx
+  80054c:	0f 84 bb 00 00 00    	je     80060d <vprintfmt+0x286>
+  800552:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800555:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800558:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80055b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80055e:	eb 7a                	jmp    8005da <vprintfmt+0x253>
+  800560:	c7 45 d0 0c 42 80 00 	movl   $0x80420c,-0x30(%ebp)
+  800567:	83 ec 08             	sub    $0x8,%esp
+  80056a:	ff 75 d4             	push   -0x2c(%ebp)
+  80056d:	ff 75 d0             	push   -0x30(%ebp)
+  800570:	e8 e0 03 00 00       	call   800955 <strnlen>
+  800575:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800578:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80057b:	83 c4 10             	add    $0x10,%esp
+  80057e:	85 d2                	test   %edx,%edx
+  800580:	0f 8e d6 02 00 00    	jle    80085c <vprintfmt+0x4d5>
+  800586:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80058a:	83 ec 08             	sub    $0x8,%esp
+  80058d:	53                   	push   %ebx
+  80058e:	56                   	push   %esi
+  80058f:	ff d7                	call   *%edi
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800598:	75 f0                	jne    80058a <vprintfmt+0x203>
+  80059a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80059d:	8d 70 01             	lea    0x1(%eax),%esi
+  8005a0:	0f b6 00             	movzbl (%eax),%eax
+  8005a3:	0f be d0             	movsbl %al,%edx
+  8005a6:	85 d2                	test   %edx,%edx
+  8005a8:	0f 84 da 02 00 00    	je     800888 <vprintfmt+0x501>
+  8005ae:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005b1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005b4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005b7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005ba:	eb 1e                	jmp    8005da <vprintfmt+0x253>
+  8005bc:	83 ec 08             	sub    $0x8,%esp
+  8005bf:	ff 75 0c             	push   0xc(%ebp)
+  8005c2:	52                   	push   %edx
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	83 eb 01             	sub    $0x1,%ebx
+  8005cc:	83 c6 01             	add    $0x1,%esi
+  8005cf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d3:	0f be d0             	movsbl %al,%edx
+  8005d6:	85 d2                	test   %edx,%edx
+  8005d8:	74 2a                	je     800604 <vprintfmt+0x27d>
+  8005da:	85 ff                	test   %edi,%edi
+  8005dc:	78 05                	js     8005e3 <vprintfmt+0x25c>
+  8005de:	83 ef 01             	sub    $0x1,%edi
+  8005e1:	78 59                	js     80063c <vprintfmt+0x2b5>
+  8005e3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e7:	74 d3                	je     8005bc <vprintfmt+0x235>
+  8005e9:	0f be c0             	movsbl %al,%eax
+  8005ec:	83 e8 20             	sub    $0x20,%eax
+  8005ef:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f2:	76 c8                	jbe    8005bc <vprintfmt+0x235>
+  8005f4:	83 ec 08             	sub    $0x8,%esp
+  8005f7:	ff 75 0c             	push   0xc(%ebp)
+  8005fa:	6a 3f                	push   $0x3f
+  8005fc:	ff 55 08             	call   *0x8(%ebp)
+  8005ff:	83 c4 10             	add    $0x10,%esp
+  800602:	eb c5                	jmp    8005c9 <vprintfmt+0x242>
+  800604:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800607:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80060a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80060d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800610:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800614:	7e 1b                	jle    800631 <vprintfmt+0x2aa>
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	53                   	push   %ebx
+  80061a:	6a 20                	push   $0x20
+  80061c:	ff d7                	call   *%edi
+  80061e:	83 c4 10             	add    $0x10,%esp
+  800621:	83 ee 01             	sub    $0x1,%esi
+  800624:	75 f0                	jne    800616 <vprintfmt+0x28f>
+  800626:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800629:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062c:	e9 67 fd ff ff       	jmp    800398 <vprintfmt+0x11>
+  800631:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800634:	89 45 14             	mov    %eax,0x14(%ebp)
+  800637:	e9 5c fd ff ff       	jmp    800398 <vprintfmt+0x11>
+  80063c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80063f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800642:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800645:	eb c6                	jmp    80060d <vprintfmt+0x286>
+  800647:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80064a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80064d:	83 f9 01             	cmp    $0x1,%ecx
+  800650:	7f 1f                	jg     800671 <vprintfmt+0x2ea>
+  800652:	85 c9                	test   %ecx,%ecx
+  800654:	74 67                	je     8006bd <vprintfmt+0x336>
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 30                	mov    (%eax),%esi
+  80065b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80065e:	89 f0                	mov    %esi,%eax
+  800660:	c1 f8 1f             	sar    $0x1f,%eax
+  800663:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8d 40 04             	lea    0x4(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066f:	eb 17                	jmp    800688 <vprintfmt+0x301>
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 50 04             	mov    0x4(%eax),%edx
+  800677:	8b 00                	mov    (%eax),%eax
+  800679:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8d 40 08             	lea    0x8(%eax),%eax
+  800685:	89 45 14             	mov    %eax,0x14(%ebp)
+  800688:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80068b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80068e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800693:	85 c9                	test   %ecx,%ecx
+  800695:	0f 89 12 01 00 00    	jns    8007ad <vprintfmt+0x426>
+  80069b:	83 ec 08             	sub    $0x8,%esp
+  80069e:	53                   	push   %ebx
+  80069f:	6a 2d                	push   $0x2d
+  8006a1:	ff d7                	call   *%edi
+  8006a3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006a9:	f7 da                	neg    %edx
+  8006ab:	83 d1 00             	adc    $0x0,%ecx
+  8006ae:	f7 d9                	neg    %ecx
+  8006b0:	83 c4 10             	add    $0x10,%esp
+  8006b3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006b8:	e9 f0 00 00 00       	jmp    8007ad <vprintfmt+0x426>
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 30                	mov    (%eax),%esi
+  8006c2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006c5:	89 f0                	mov    %esi,%eax
+  8006c7:	c1 f8 1f             	sar    $0x1f,%eax
+  8006ca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d6:	eb b0                	jmp    800688 <vprintfmt+0x301>
+  8006d8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006db:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006de:	83 f9 01             	cmp    $0x1,%ecx
+  8006e1:	7f 1e                	jg     800701 <vprintfmt+0x37a>
+  8006e3:	85 c9                	test   %ecx,%ecx
+  8006e5:	74 32                	je     800719 <vprintfmt+0x392>
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8b 10                	mov    (%eax),%edx
+  8006ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006fc:	e9 ac 00 00 00       	jmp    8007ad <vprintfmt+0x426>
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 10                	mov    (%eax),%edx
+  800706:	8b 48 04             	mov    0x4(%eax),%ecx
+  800709:	8d 40 08             	lea    0x8(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800714:	e9 94 00 00 00       	jmp    8007ad <vprintfmt+0x426>
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800723:	8d 40 04             	lea    0x4(%eax),%eax
+  800726:	89 45 14             	mov    %eax,0x14(%ebp)
+  800729:	be 0a 00 00 00       	mov    $0xa,%esi
+  80072e:	eb 7d                	jmp    8007ad <vprintfmt+0x426>
+  800730:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800733:	89 55 10             	mov    %edx,0x10(%ebp)
+  800736:	83 f9 01             	cmp    $0x1,%ecx
+  800739:	7f 1b                	jg     800756 <vprintfmt+0x3cf>
+  80073b:	85 c9                	test   %ecx,%ecx
+  80073d:	74 2c                	je     80076b <vprintfmt+0x3e4>
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8b 10                	mov    (%eax),%edx
+  800744:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800749:	8d 40 04             	lea    0x4(%eax),%eax
+  80074c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074f:	be 08 00 00 00       	mov    $0x8,%esi
+  800754:	eb 57                	jmp    8007ad <vprintfmt+0x426>
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 10                	mov    (%eax),%edx
+  80075b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80075e:	8d 40 08             	lea    0x8(%eax),%eax
+  800761:	89 45 14             	mov    %eax,0x14(%ebp)
+  800764:	be 08 00 00 00       	mov    $0x8,%esi
+  800769:	eb 42                	jmp    8007ad <vprintfmt+0x426>
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8b 10                	mov    (%eax),%edx
+  800770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800775:	8d 40 04             	lea    0x4(%eax),%eax
+  800778:	89 45 14             	mov    %eax,0x14(%ebp)
+  80077b:	be 08 00 00 00       	mov    $0x8,%esi
+  800780:	eb 2b                	jmp    8007ad <vprintfmt+0x426>
+  800782:	89 55 10             	mov    %edx,0x10(%ebp)
+  800785:	83 ec 08             	sub    $0x8,%esp
+  800788:	53                   	push   %ebx
+  800789:	6a 30                	push   $0x30
+  80078b:	ff d7                	call   *%edi
+  80078d:	83 c4 08             	add    $0x8,%esp
+  800790:	53                   	push   %ebx
+  800791:	6a 78                	push   $0x78
+  800793:	ff d7                	call   *%edi
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8b 10                	mov    (%eax),%edx
+  80079a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079f:	83 c4 10             	add    $0x10,%esp
+  8007a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a8:	be 10 00 00 00       	mov    $0x10,%esi
+  8007ad:	83 ec 0c             	sub    $0xc,%esp
+  8007b0:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007b4:	50                   	push   %eax
+  8007b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b8:	56                   	push   %esi
+  8007b9:	51                   	push   %ecx
+  8007ba:	52                   	push   %edx
+  8007bb:	89 da                	mov    %ebx,%edx
+  8007bd:	89 f8                	mov    %edi,%eax
+  8007bf:	e8 d8 fa ff ff       	call   80029c <printnum>
+  8007c4:	83 c4 20             	add    $0x20,%esp
+  8007c7:	e9 cc fb ff ff       	jmp    800398 <vprintfmt+0x11>
+  8007cc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007cf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d2:	83 f9 01             	cmp    $0x1,%ecx
+  8007d5:	7f 1b                	jg     8007f2 <vprintfmt+0x46b>
+  8007d7:	85 c9                	test   %ecx,%ecx
+  8007d9:	74 2c                	je     800807 <vprintfmt+0x480>
+  8007db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007de:	8b 10                	mov    (%eax),%edx
+  8007e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007eb:	be 10 00 00 00       	mov    $0x10,%esi
+  8007f0:	eb bb                	jmp    8007ad <vprintfmt+0x426>
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8b 10                	mov    (%eax),%edx
+  8007f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800800:	be 10 00 00 00       	mov    $0x10,%esi
+  800805:	eb a6                	jmp    8007ad <vprintfmt+0x426>
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 10                	mov    (%eax),%edx
+  80080c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800811:	8d 40 04             	lea    0x4(%eax),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+  800817:	be 10 00 00 00       	mov    $0x10,%esi
+  80081c:	eb 8f                	jmp    8007ad <vprintfmt+0x426>
+  80081e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800821:	83 ec 08             	sub    $0x8,%esp
+  800824:	53                   	push   %ebx
+  800825:	6a 25                	push   $0x25
+  800827:	ff d7                	call   *%edi
+  800829:	83 c4 10             	add    $0x10,%esp
+  80082c:	e9 67 fb ff ff       	jmp    800398 <vprintfmt+0x11>
+  800831:	83 ec 08             	sub    $0x8,%esp
+  800834:	53                   	push   %ebx
+  800835:	6a 25                	push   $0x25
+  800837:	ff d7                	call   *%edi
+  800839:	83 c4 10             	add    $0x10,%esp
+  80083c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800840:	0f 84 ba fb ff ff    	je     800400 <vprintfmt+0x79>
+  800846:	89 75 10             	mov    %esi,0x10(%ebp)
+  800849:	89 f0                	mov    %esi,%eax
+  80084b:	83 e8 01             	sub    $0x1,%eax
+  80084e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800852:	75 f7                	jne    80084b <vprintfmt+0x4c4>
+  800854:	89 45 10             	mov    %eax,0x10(%ebp)
+  800857:	e9 3c fb ff ff       	jmp    800398 <vprintfmt+0x11>
+  80085c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80085f:	8d 70 01             	lea    0x1(%eax),%esi
+  800862:	0f b6 00             	movzbl (%eax),%eax
+  800865:	0f be d0             	movsbl %al,%edx
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	74 11                	je     80087d <vprintfmt+0x4f6>
+  80086c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80086f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800872:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800875:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800878:	e9 5d fd ff ff       	jmp    8005da <vprintfmt+0x253>
+  80087d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800880:	89 45 14             	mov    %eax,0x14(%ebp)
+  800883:	e9 10 fb ff ff       	jmp    800398 <vprintfmt+0x11>
+  800888:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088e:	e9 05 fb ff ff       	jmp    800398 <vprintfmt+0x11>
+  800893:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800897:	7e 0a                	jle    8008a3 <vprintfmt+0x51c>
+  800899:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80089d:	0f 85 bd fc ff ff    	jne    800560 <vprintfmt+0x1d9>
+  8008a3:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008a8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008ad:	be 0d 42 80 00       	mov    $0x80420d,%esi
+  8008b2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008b5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008b8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008bb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008be:	e9 17 fd ff ff       	jmp    8005da <vprintfmt+0x253>
+  8008c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c6:	5b                   	pop    %ebx
+  8008c7:	5e                   	pop    %esi
+  8008c8:	5f                   	pop    %edi
+  8008c9:	5d                   	pop    %ebp
+  8008ca:	c3                   	ret
+
+008008cb <vsnprintf>:
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	83 ec 18             	sub    $0x18,%esp
+  8008d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008da:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008de:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008e1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8008e8:	85 c0                	test   %eax,%eax
+  8008ea:	74 26                	je     800912 <vsnprintf+0x47>
+  8008ec:	85 d2                	test   %edx,%edx
+  8008ee:	7e 22                	jle    800912 <vsnprintf+0x47>
+  8008f0:	ff 75 14             	push   0x14(%ebp)
+  8008f3:	ff 75 10             	push   0x10(%ebp)
+  8008f6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008f9:	50                   	push   %eax
+  8008fa:	68 4d 03 80 00       	push   $0x80034d
+  8008ff:	e8 83 fa ff ff       	call   800387 <vprintfmt>
+  800904:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800907:	c6 00 00             	movb   $0x0,(%eax)
+  80090a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80090d:	83 c4 10             	add    $0x10,%esp
+  800910:	c9                   	leave
+  800911:	c3                   	ret
+  800912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800917:	eb f7                	jmp    800910 <vsnprintf+0x45>
+
+00800919 <snprintf>:
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	83 ec 08             	sub    $0x8,%esp
+  80091f:	8d 45 14             	lea    0x14(%ebp),%eax
+  800922:	50                   	push   %eax
+  800923:	ff 75 10             	push   0x10(%ebp)
+  800926:	ff 75 0c             	push   0xc(%ebp)
+  800929:	ff 75 08             	push   0x8(%ebp)
+  80092c:	e8 9a ff ff ff       	call   8008cb <vsnprintf>
+  800931:	c9                   	leave
+  800932:	c3                   	ret
+
+00800933 <strlen>:
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	8b 55 08             	mov    0x8(%ebp),%edx
+  800939:	80 3a 00             	cmpb   $0x0,(%edx)
+  80093c:	74 10                	je     80094e <strlen+0x1b>
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800943:	83 c0 01             	add    $0x1,%eax
+  800946:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80094a:	75 f7                	jne    800943 <strlen+0x10>
+  80094c:	5d                   	pop    %ebp
+  80094d:	c3                   	ret
+  80094e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800953:	eb f7                	jmp    80094c <strlen+0x19>
+
+00800955 <strnlen>:
+  800955:	55                   	push   %ebp
+  800956:	89 e5                	mov    %esp,%ebp
+  800958:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095e:	85 d2                	test   %edx,%edx
+  800960:	74 16                	je     800978 <strnlen+0x23>
+  800962:	b8 00 00 00 00       	mov    $0x0,%eax
+  800967:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80096b:	74 09                	je     800976 <strnlen+0x21>
+  80096d:	83 c0 01             	add    $0x1,%eax
+  800970:	39 d0                	cmp    %edx,%eax
+  800972:	75 f3                	jne    800967 <strnlen+0x12>
+  800974:	89 d0                	mov    %edx,%eax
+  800976:	5d                   	pop    %ebp
+  800977:	c3                   	ret
+  800978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097d:	eb f7                	jmp    800976 <strnlen+0x21>
+
+0080097f <strcpy>:
+  80097f:	55                   	push   %ebp
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	53                   	push   %ebx
+  800983:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800986:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800992:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800995:	83 c0 01             	add    $0x1,%eax
+  800998:	84 d2                	test   %dl,%dl
+  80099a:	75 f2                	jne    80098e <strcpy+0xf>
+  80099c:	89 c8                	mov    %ecx,%eax
+  80099e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a1:	c9                   	leave
+  8009a2:	c3                   	ret
+
+008009a3 <strcat>:
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	53                   	push   %ebx
+  8009a7:	83 ec 10             	sub    $0x10,%esp
+  8009aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009ad:	53                   	push   %ebx
+  8009ae:	e8 80 ff ff ff       	call   800933 <strlen>
+  8009b3:	83 c4 08             	add    $0x8,%esp
+  8009b6:	ff 75 0c             	push   0xc(%ebp)
+  8009b9:	01 d8                	add    %ebx,%eax
+  8009bb:	50                   	push   %eax
+  8009bc:	e8 be ff ff ff       	call   80097f <strcpy>
+  8009c1:	89 d8                	mov    %ebx,%eax
+  8009c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c6:	c9                   	leave
+  8009c7:	c3                   	ret
+
+008009c8 <strncpy>:
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	56                   	push   %esi
+  8009cc:	53                   	push   %ebx
+  8009cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009d6:	85 db                	test   %ebx,%ebx
+  8009d8:	74 17                	je     8009f1 <strncpy+0x29>
+  8009da:	01 f3                	add    %esi,%ebx
+  8009dc:	89 f0                	mov    %esi,%eax
+  8009de:	83 c0 01             	add    $0x1,%eax
+  8009e1:	0f b6 0a             	movzbl (%edx),%ecx
+  8009e4:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009e7:	80 f9 01             	cmp    $0x1,%cl
+  8009ea:	83 da ff             	sbb    $0xffffffff,%edx
+  8009ed:	39 c3                	cmp    %eax,%ebx
+  8009ef:	75 ed                	jne    8009de <strncpy+0x16>
+  8009f1:	89 f0                	mov    %esi,%eax
+  8009f3:	5b                   	pop    %ebx
+  8009f4:	5e                   	pop    %esi
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <strlcpy>:
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	56                   	push   %esi
+  8009fb:	53                   	push   %ebx
+  8009fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a05:	89 f0                	mov    %esi,%eax
+  800a07:	85 db                	test   %ebx,%ebx
+  800a09:	74 1e                	je     800a29 <strlcpy+0x32>
+  800a0b:	83 eb 01             	sub    $0x1,%ebx
+  800a0e:	74 16                	je     800a26 <strlcpy+0x2f>
+  800a10:	01 f3                	add    %esi,%ebx
+  800a12:	0f b6 0a             	movzbl (%edx),%ecx
+  800a15:	84 c9                	test   %cl,%cl
+  800a17:	74 0d                	je     800a26 <strlcpy+0x2f>
+  800a19:	83 c2 01             	add    $0x1,%edx
+  800a1c:	83 c0 01             	add    $0x1,%eax
+  800a1f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a22:	39 d8                	cmp    %ebx,%eax
+  800a24:	75 ec                	jne    800a12 <strlcpy+0x1b>
+  800a26:	c6 00 00             	movb   $0x0,(%eax)
+  800a29:	29 f0                	sub    %esi,%eax
+  800a2b:	5b                   	pop    %ebx
+  800a2c:	5e                   	pop    %esi
+  800a2d:	5d                   	pop    %ebp
+  800a2e:	c3                   	ret
+
+00800a2f <strcmp>:
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a38:	0f b6 01             	movzbl (%ecx),%eax
+  800a3b:	84 c0                	test   %al,%al
+  800a3d:	74 11                	je     800a50 <strcmp+0x21>
+  800a3f:	38 02                	cmp    %al,(%edx)
+  800a41:	75 0d                	jne    800a50 <strcmp+0x21>
+  800a43:	83 c1 01             	add    $0x1,%ecx
+  800a46:	83 c2 01             	add    $0x1,%edx
+  800a49:	0f b6 01             	movzbl (%ecx),%eax
+  800a4c:	84 c0                	test   %al,%al
+  800a4e:	75 ef                	jne    800a3f <strcmp+0x10>
+  800a50:	0f b6 c0             	movzbl %al,%eax
+  800a53:	0f b6 12             	movzbl (%edx),%edx
+  800a56:	29 d0                	sub    %edx,%eax
+  800a58:	5d                   	pop    %ebp
+  800a59:	c3                   	ret
+
+00800a5a <strncmp>:
+  800a5a:	55                   	push   %ebp
+  800a5b:	89 e5                	mov    %esp,%ebp
+  800a5d:	53                   	push   %ebx
+  800a5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a64:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	85 d2                	test   %edx,%edx
+  800a6e:	74 2e                	je     800a9e <strncmp+0x44>
+  800a70:	0f b6 01             	movzbl (%ecx),%eax
+  800a73:	84 c0                	test   %al,%al
+  800a75:	74 16                	je     800a8d <strncmp+0x33>
+  800a77:	3a 03                	cmp    (%ebx),%al
+  800a79:	75 12                	jne    800a8d <strncmp+0x33>
+  800a7b:	83 c1 01             	add    $0x1,%ecx
+  800a7e:	83 c3 01             	add    $0x1,%ebx
+  800a81:	83 ea 01             	sub    $0x1,%edx
+  800a84:	75 ea                	jne    800a70 <strncmp+0x16>
+  800a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8b:	eb 11                	jmp    800a9e <strncmp+0x44>
+  800a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a92:	85 d2                	test   %edx,%edx
+  800a94:	74 08                	je     800a9e <strncmp+0x44>
+  800a96:	0f b6 01             	movzbl (%ecx),%eax
+  800a99:	0f b6 13             	movzbl (%ebx),%edx
+  800a9c:	29 d0                	sub    %edx,%eax
+  800a9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa1:	c9                   	leave
+  800aa2:	c3                   	ret
+
+00800aa3 <strchr>:
+  800aa3:	55                   	push   %ebp
+  800aa4:	89 e5                	mov    %esp,%ebp
+  800aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800aad:	0f b6 10             	movzbl (%eax),%edx
+  800ab0:	84 d2                	test   %dl,%dl
+  800ab2:	74 15                	je     800ac9 <strchr+0x26>
+  800ab4:	38 d1                	cmp    %dl,%cl
+  800ab6:	74 0f                	je     800ac7 <strchr+0x24>
+  800ab8:	83 c0 01             	add    $0x1,%eax
+  800abb:	0f b6 10             	movzbl (%eax),%edx
+  800abe:	84 d2                	test   %dl,%dl
+  800ac0:	75 f2                	jne    800ab4 <strchr+0x11>
+  800ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac7:	5d                   	pop    %ebp
+  800ac8:	c3                   	ret
+  800ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ace:	eb f7                	jmp    800ac7 <strchr+0x24>
+
+00800ad0 <strfind>:
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	53                   	push   %ebx
+  800ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ada:	0f b6 18             	movzbl (%eax),%ebx
+  800add:	38 d3                	cmp    %dl,%bl
+  800adf:	74 14                	je     800af5 <strfind+0x25>
+  800ae1:	89 d1                	mov    %edx,%ecx
+  800ae3:	84 db                	test   %bl,%bl
+  800ae5:	74 0e                	je     800af5 <strfind+0x25>
+  800ae7:	83 c0 01             	add    $0x1,%eax
+  800aea:	0f b6 10             	movzbl (%eax),%edx
+  800aed:	38 ca                	cmp    %cl,%dl
+  800aef:	74 04                	je     800af5 <strfind+0x25>
+  800af1:	84 d2                	test   %dl,%dl
+  800af3:	75 f2                	jne    800ae7 <strfind+0x17>
+  800af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af8:	c9                   	leave
+  800af9:	c3                   	ret
+
+00800afa <memset>:
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	57                   	push   %edi
+  800afe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b01:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b04:	85 c9                	test   %ecx,%ecx
+  800b06:	74 20                	je     800b28 <memset+0x2e>
+  800b08:	89 f8                	mov    %edi,%eax
+  800b0a:	09 c8                	or     %ecx,%eax
+  800b0c:	a8 03                	test   $0x3,%al
+  800b0e:	75 12                	jne    800b22 <memset+0x28>
+  800b10:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b14:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800b1a:	c1 e9 02             	shr    $0x2,%ecx
+  800b1d:	fc                   	cld
+  800b1e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b20:	eb 06                	jmp    800b28 <memset+0x2e>
+  800b22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b25:	fc                   	cld
+  800b26:	f3 aa                	rep stos %al,%es:(%edi)
+  800b28:	89 f8                	mov    %edi,%eax
+  800b2a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b2d:	c9                   	leave
+  800b2e:	c3                   	ret
+
+00800b2f <memmove>:
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	57                   	push   %edi
+  800b33:	56                   	push   %esi
+  800b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b37:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b3d:	39 c6                	cmp    %eax,%esi
+  800b3f:	73 32                	jae    800b73 <memmove+0x44>
+  800b41:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b44:	39 d0                	cmp    %edx,%eax
+  800b46:	73 2b                	jae    800b73 <memmove+0x44>
+  800b48:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800b4b:	89 d6                	mov    %edx,%esi
+  800b4d:	09 fe                	or     %edi,%esi
+  800b4f:	09 ce                	or     %ecx,%esi
+  800b51:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b57:	75 0e                	jne    800b67 <memmove+0x38>
+  800b59:	83 ef 04             	sub    $0x4,%edi
+  800b5c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b5f:	c1 e9 02             	shr    $0x2,%ecx
+  800b62:	fd                   	std
+  800b63:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b65:	eb 09                	jmp    800b70 <memmove+0x41>
+  800b67:	83 ef 01             	sub    $0x1,%edi
+  800b6a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b6d:	fd                   	std
+  800b6e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b70:	fc                   	cld
+  800b71:	eb 1a                	jmp    800b8d <memmove+0x5e>
+  800b73:	89 f2                	mov    %esi,%edx
+  800b75:	09 c2                	or     %eax,%edx
+  800b77:	09 ca                	or     %ecx,%edx
+  800b79:	f6 c2 03             	test   $0x3,%dl
+  800b7c:	75 0a                	jne    800b88 <memmove+0x59>
+  800b7e:	c1 e9 02             	shr    $0x2,%ecx
+  800b81:	89 c7                	mov    %eax,%edi
+  800b83:	fc                   	cld
+  800b84:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b86:	eb 05                	jmp    800b8d <memmove+0x5e>
+  800b88:	89 c7                	mov    %eax,%edi
+  800b8a:	fc                   	cld
+  800b8b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b8d:	5e                   	pop    %esi
+  800b8e:	5f                   	pop    %edi
+  800b8f:	5d                   	pop    %ebp
+  800b90:	c3                   	ret
+
+00800b91 <memcpy>:
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	83 ec 0c             	sub    $0xc,%esp
+  800b97:	ff 75 10             	push   0x10(%ebp)
+  800b9a:	ff 75 0c             	push   0xc(%ebp)
+  800b9d:	ff 75 08             	push   0x8(%ebp)
+  800ba0:	e8 8a ff ff ff       	call   800b2f <memmove>
+  800ba5:	c9                   	leave
+  800ba6:	c3                   	ret
+
+00800ba7 <memcmp>:
+  800ba7:	55                   	push   %ebp
+  800ba8:	89 e5                	mov    %esp,%ebp
+  800baa:	56                   	push   %esi
+  800bab:	53                   	push   %ebx
+  800bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bb2:	8b 75 10             	mov    0x10(%ebp),%esi
+  800bb5:	85 f6                	test   %esi,%esi
+  800bb7:	74 29                	je     800be2 <memcmp+0x3b>
+  800bb9:	01 c6                	add    %eax,%esi
+  800bbb:	0f b6 08             	movzbl (%eax),%ecx
+  800bbe:	0f b6 1a             	movzbl (%edx),%ebx
+  800bc1:	38 d9                	cmp    %bl,%cl
+  800bc3:	75 11                	jne    800bd6 <memcmp+0x2f>
+  800bc5:	83 c0 01             	add    $0x1,%eax
+  800bc8:	83 c2 01             	add    $0x1,%edx
+  800bcb:	39 c6                	cmp    %eax,%esi
+  800bcd:	75 ec                	jne    800bbb <memcmp+0x14>
+  800bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd4:	eb 08                	jmp    800bde <memcmp+0x37>
+  800bd6:	0f b6 c1             	movzbl %cl,%eax
+  800bd9:	0f b6 db             	movzbl %bl,%ebx
+  800bdc:	29 d8                	sub    %ebx,%eax
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5d                   	pop    %ebp
+  800be1:	c3                   	ret
+  800be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be7:	eb f5                	jmp    800bde <memcmp+0x37>
+
+00800be9 <memfind>:
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf2:	89 c2                	mov    %eax,%edx
+  800bf4:	03 55 10             	add    0x10(%ebp),%edx
+  800bf7:	39 d0                	cmp    %edx,%eax
+  800bf9:	73 0d                	jae    800c08 <memfind+0x1f>
+  800bfb:	38 08                	cmp    %cl,(%eax)
+  800bfd:	74 0d                	je     800c0c <memfind+0x23>
+  800bff:	83 c0 01             	add    $0x1,%eax
+  800c02:	39 c2                	cmp    %eax,%edx
+  800c04:	75 f5                	jne    800bfb <memfind+0x12>
+  800c06:	eb 06                	jmp    800c0e <memfind+0x25>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	eb 02                	jmp    800c0e <memfind+0x25>
+  800c0c:	89 c2                	mov    %eax,%edx
+  800c0e:	89 d0                	mov    %edx,%eax
+  800c10:	5d                   	pop    %ebp
+  800c11:	c3                   	ret
+
+00800c12 <strtol>:
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	57                   	push   %edi
+  800c16:	56                   	push   %esi
+  800c17:	53                   	push   %ebx
+  800c18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c1e:	0f b6 02             	movzbl (%edx),%eax
+  800c21:	3c 20                	cmp    $0x20,%al
+  800c23:	74 04                	je     800c29 <strtol+0x17>
+  800c25:	3c 09                	cmp    $0x9,%al
+  800c27:	75 0e                	jne    800c37 <strtol+0x25>
+  800c29:	83 c2 01             	add    $0x1,%edx
+  800c2c:	0f b6 02             	movzbl (%edx),%eax
+  800c2f:	3c 20                	cmp    $0x20,%al
+  800c31:	74 f6                	je     800c29 <strtol+0x17>
+  800c33:	3c 09                	cmp    $0x9,%al
+  800c35:	74 f2                	je     800c29 <strtol+0x17>
+  800c37:	3c 2b                	cmp    $0x2b,%al
+  800c39:	74 2a                	je     800c65 <strtol+0x53>
+  800c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c40:	3c 2d                	cmp    $0x2d,%al
+  800c42:	74 2b                	je     800c6f <strtol+0x5d>
+  800c44:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c4a:	75 0f                	jne    800c5b <strtol+0x49>
+  800c4c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c4f:	74 28                	je     800c79 <strtol+0x67>
+  800c51:	85 db                	test   %ebx,%ebx
+  800c53:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c58:	0f 44 d8             	cmove  %eax,%ebx
+  800c5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c60:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c63:	eb 46                	jmp    800cab <strtol+0x99>
+  800c65:	83 c2 01             	add    $0x1,%edx
+  800c68:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6d:	eb d5                	jmp    800c44 <strtol+0x32>
+  800c6f:	83 c2 01             	add    $0x1,%edx
+  800c72:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c77:	eb cb                	jmp    800c44 <strtol+0x32>
+  800c79:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c7d:	74 0e                	je     800c8d <strtol+0x7b>
+  800c7f:	85 db                	test   %ebx,%ebx
+  800c81:	75 d8                	jne    800c5b <strtol+0x49>
+  800c83:	83 c2 01             	add    $0x1,%edx
+  800c86:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c8b:	eb ce                	jmp    800c5b <strtol+0x49>
+  800c8d:	83 c2 02             	add    $0x2,%edx
+  800c90:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c95:	eb c4                	jmp    800c5b <strtol+0x49>
+  800c97:	0f be c0             	movsbl %al,%eax
+  800c9a:	83 e8 30             	sub    $0x30,%eax
+  800c9d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ca0:	7d 3a                	jge    800cdc <strtol+0xca>
+  800ca2:	83 c2 01             	add    $0x1,%edx
+  800ca5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ca9:	01 c1                	add    %eax,%ecx
+  800cab:	0f b6 02             	movzbl (%edx),%eax
+  800cae:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cb1:	89 f3                	mov    %esi,%ebx
+  800cb3:	80 fb 09             	cmp    $0x9,%bl
+  800cb6:	76 df                	jbe    800c97 <strtol+0x85>
+  800cb8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cbb:	89 f3                	mov    %esi,%ebx
+  800cbd:	80 fb 19             	cmp    $0x19,%bl
+  800cc0:	77 08                	ja     800cca <strtol+0xb8>
+  800cc2:	0f be c0             	movsbl %al,%eax
+  800cc5:	83 e8 57             	sub    $0x57,%eax
+  800cc8:	eb d3                	jmp    800c9d <strtol+0x8b>
+  800cca:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ccd:	89 f3                	mov    %esi,%ebx
+  800ccf:	80 fb 19             	cmp    $0x19,%bl
+  800cd2:	77 08                	ja     800cdc <strtol+0xca>
+  800cd4:	0f be c0             	movsbl %al,%eax
+  800cd7:	83 e8 37             	sub    $0x37,%eax
+  800cda:	eb c1                	jmp    800c9d <strtol+0x8b>
+  800cdc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ce0:	74 05                	je     800ce7 <strtol+0xd5>
+  800ce2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce5:	89 10                	mov    %edx,(%eax)
+  800ce7:	89 c8                	mov    %ecx,%eax
+  800ce9:	f7 d8                	neg    %eax
+  800ceb:	85 ff                	test   %edi,%edi
+  800ced:	0f 45 c8             	cmovne %eax,%ecx
+  800cf0:	89 c8                	mov    %ecx,%eax
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+
+00800cf7 <sys_cputs>:
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	57                   	push   %edi
+  800cfb:	56                   	push   %esi
+  800cfc:	53                   	push   %ebx
+  800cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d08:	89 c3                	mov    %eax,%ebx
+  800d0a:	89 c7                	mov    %eax,%edi
+  800d0c:	89 c6                	mov    %eax,%esi
+  800d0e:	cd 30                	int    $0x30
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+
+00800d15 <sys_cgetc>:
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+  800d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d25:	89 d1                	mov    %edx,%ecx
+  800d27:	89 d3                	mov    %edx,%ebx
+  800d29:	89 d7                	mov    %edx,%edi
+  800d2b:	89 d6                	mov    %edx,%esi
+  800d2d:	cd 30                	int    $0x30
+  800d2f:	5b                   	pop    %ebx
+  800d30:	5e                   	pop    %esi
+  800d31:	5f                   	pop    %edi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+
+00800d34 <sys_env_destroy>:
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	56                   	push   %esi
+  800d39:	53                   	push   %ebx
+  800d3a:	83 ec 0c             	sub    $0xc,%esp
+  800d3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d45:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d4a:	89 cb                	mov    %ecx,%ebx
+  800d4c:	89 cf                	mov    %ecx,%edi
+  800d4e:	89 ce                	mov    %ecx,%esi
+  800d50:	cd 30                	int    $0x30
+  800d52:	85 c0                	test   %eax,%eax
+  800d54:	7f 08                	jg     800d5e <sys_env_destroy+0x2a>
+  800d56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+  800d5e:	83 ec 0c             	sub    $0xc,%esp
+  800d61:	50                   	push   %eax
+  800d62:	6a 03                	push   $0x3
+  800d64:	68 0b 45 80 00       	push   $0x80450b
+  800d69:	6a 24                	push   $0x24
+  800d6b:	68 28 45 80 00       	push   $0x804528
+  800d70:	e8 38 f4 ff ff       	call   8001ad <_panic>
+
+00800d75 <sys_getenvid>:
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+  800d7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d80:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d85:	89 d1                	mov    %edx,%ecx
+  800d87:	89 d3                	mov    %edx,%ebx
+  800d89:	89 d7                	mov    %edx,%edi
+  800d8b:	89 d6                	mov    %edx,%esi
+  800d8d:	cd 30                	int    $0x30
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+
+00800d94 <sys_yield>:
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800da1:	74 26                	je     800dc9 <sys_yield+0x35>
+  800da3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dad:	89 d1                	mov    %edx,%ecx
+  800daf:	89 d3                	mov    %edx,%ebx
+  800db1:	89 d7                	mov    %edx,%edi
+  800db3:	6a 00                	push   $0x0
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	8d 35 c0 0d 80 00    	lea    0x800dc0,%esi
+  800dbe:	0f 34                	sysenter
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	83 c4 04             	add    $0x4,%esp
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+  800dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dce:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd3:	89 d1                	mov    %edx,%ecx
+  800dd5:	89 d3                	mov    %edx,%ebx
+  800dd7:	89 d7                	mov    %edx,%edi
+  800dd9:	89 d6                	mov    %edx,%esi
+  800ddb:	cd 30                	int    $0x30
+  800ddd:	eb e5                	jmp    800dc4 <sys_yield+0x30>
+
+00800ddf <sys_page_alloc>:
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+  800de5:	83 ec 0c             	sub    $0xc,%esp
+  800de8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ded:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfb:	89 f7                	mov    %esi,%edi
+  800dfd:	cd 30                	int    $0x30
+  800dff:	85 c0                	test   %eax,%eax
+  800e01:	7f 08                	jg     800e0b <sys_page_alloc+0x2c>
+  800e03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e06:	5b                   	pop    %ebx
+  800e07:	5e                   	pop    %esi
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+  800e0b:	83 ec 0c             	sub    $0xc,%esp
+  800e0e:	50                   	push   %eax
+  800e0f:	6a 04                	push   $0x4
+  800e11:	68 0b 45 80 00       	push   $0x80450b
+  800e16:	6a 24                	push   $0x24
+  800e18:	68 28 45 80 00       	push   $0x804528
+  800e1d:	e8 8b f3 ff ff       	call   8001ad <_panic>
+
+00800e22 <sys_page_map>:
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	57                   	push   %edi
+  800e26:	56                   	push   %esi
+  800e27:	53                   	push   %ebx
+  800e28:	83 ec 0c             	sub    $0xc,%esp
+  800e2b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e32:	74 33                	je     800e67 <sys_page_map+0x45>
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e42:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e45:	ff 75 18             	push   0x18(%ebp)
+  800e48:	55                   	push   %ebp
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	8d 35 53 0e 80 00    	lea    0x800e53,%esi
+  800e51:	0f 34                	sysenter
+  800e53:	5d                   	pop    %ebp
+  800e54:	83 c4 04             	add    $0x4,%esp
+  800e57:	89 c2                	mov    %eax,%edx
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	7f 3d                	jg     800e9a <sys_page_map+0x78>
+  800e5d:	89 d0                	mov    %edx,%eax
+  800e5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+  800e67:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e75:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e78:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e7b:	cd 30                	int    $0x30
+  800e7d:	89 c2                	mov    %eax,%edx
+  800e7f:	85 c0                	test   %eax,%eax
+  800e81:	7e da                	jle    800e5d <sys_page_map+0x3b>
+  800e83:	83 ec 0c             	sub    $0xc,%esp
+  800e86:	50                   	push   %eax
+  800e87:	6a 05                	push   $0x5
+  800e89:	68 0b 45 80 00       	push   $0x80450b
+  800e8e:	6a 24                	push   $0x24
+  800e90:	68 28 45 80 00       	push   $0x804528
+  800e95:	e8 13 f3 ff ff       	call   8001ad <_panic>
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  800e9d:	50                   	push   %eax
+  800e9e:	6a 05                	push   $0x5
+  800ea0:	68 0b 45 80 00       	push   $0x80450b
+  800ea5:	6a 48                	push   $0x48
+  800ea7:	68 28 45 80 00       	push   $0x804528
+  800eac:	e8 fc f2 ff ff       	call   8001ad <_panic>
+
+00800eb1 <sys_page_unmap>:
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	56                   	push   %esi
+  800eb6:	53                   	push   %ebx
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+  800eba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eca:	89 df                	mov    %ebx,%edi
+  800ecc:	89 de                	mov    %ebx,%esi
+  800ece:	cd 30                	int    $0x30
+  800ed0:	85 c0                	test   %eax,%eax
+  800ed2:	7f 08                	jg     800edc <sys_page_unmap+0x2b>
+  800ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed7:	5b                   	pop    %ebx
+  800ed8:	5e                   	pop    %esi
+  800ed9:	5f                   	pop    %edi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+  800edf:	50                   	push   %eax
+  800ee0:	6a 06                	push   $0x6
+  800ee2:	68 0b 45 80 00       	push   $0x80450b
+  800ee7:	6a 24                	push   $0x24
+  800ee9:	68 28 45 80 00       	push   $0x804528
+  800eee:	e8 ba f2 ff ff       	call   8001ad <_panic>
+
+00800ef3 <sys_fork>:
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  800ef9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efe:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f03:	89 d1                	mov    %edx,%ecx
+  800f05:	89 d3                	mov    %edx,%ebx
+  800f07:	89 d7                	mov    %edx,%edi
+  800f09:	89 d6                	mov    %edx,%esi
+  800f0b:	cd 30                	int    $0x30
+  800f0d:	5b                   	pop    %ebx
+  800f0e:	5e                   	pop    %esi
+  800f0f:	5f                   	pop    %edi
+  800f10:	5d                   	pop    %ebp
+  800f11:	c3                   	ret
+
+00800f12 <sys_env_set_status>:
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+  800f18:	83 ec 0c             	sub    $0xc,%esp
+  800f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f2b:	89 df                	mov    %ebx,%edi
+  800f2d:	89 de                	mov    %ebx,%esi
+  800f2f:	cd 30                	int    $0x30
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	7f 08                	jg     800f3d <sys_env_set_status+0x2b>
+  800f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f38:	5b                   	pop    %ebx
+  800f39:	5e                   	pop    %esi
+  800f3a:	5f                   	pop    %edi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+  800f3d:	83 ec 0c             	sub    $0xc,%esp
+  800f40:	50                   	push   %eax
+  800f41:	6a 08                	push   $0x8
+  800f43:	68 0b 45 80 00       	push   $0x80450b
+  800f48:	6a 24                	push   $0x24
+  800f4a:	68 28 45 80 00       	push   $0x804528
+  800f4f:	e8 59 f2 ff ff       	call   8001ad <_panic>
+
+00800f54 <sys_env_set_trapframe>:
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	57                   	push   %edi
+  800f58:	56                   	push   %esi
+  800f59:	53                   	push   %ebx
+  800f5a:	83 ec 0c             	sub    $0xc,%esp
+  800f5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f68:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f6d:	89 df                	mov    %ebx,%edi
+  800f6f:	89 de                	mov    %ebx,%esi
+  800f71:	cd 30                	int    $0x30
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	7f 08                	jg     800f7f <sys_env_set_trapframe+0x2b>
+  800f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  800f82:	50                   	push   %eax
+  800f83:	6a 09                	push   $0x9
+  800f85:	68 0b 45 80 00       	push   $0x80450b
+  800f8a:	6a 24                	push   $0x24
+  800f8c:	68 28 45 80 00       	push   $0x804528
+  800f91:	e8 17 f2 ff ff       	call   8001ad <_panic>
+
+00800f96 <sys_env_set_cow>:
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	57                   	push   %edi
+  800f9a:	56                   	push   %esi
+  800f9b:	53                   	push   %ebx
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	b8 20 00 00 00       	mov    $0x20,%eax
+  800faf:	89 df                	mov    %ebx,%edi
+  800fb1:	89 de                	mov    %ebx,%esi
+  800fb3:	cd 30                	int    $0x30
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	7f 08                	jg     800fc1 <sys_env_set_cow+0x2b>
+  800fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+  800fc4:	50                   	push   %eax
+  800fc5:	6a 20                	push   $0x20
+  800fc7:	68 0b 45 80 00       	push   $0x80450b
+  800fcc:	6a 24                	push   $0x24
+  800fce:	68 28 45 80 00       	push   $0x804528
+  800fd3:	e8 d5 f1 ff ff       	call   8001ad <_panic>
+
+00800fd8 <sys_env_service>:
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	56                   	push   %esi
+  800fdd:	53                   	push   %ebx
+  800fde:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe6:	b8 21 00 00 00       	mov    $0x21,%eax
+  800feb:	89 cb                	mov    %ecx,%ebx
+  800fed:	89 cf                	mov    %ecx,%edi
+  800fef:	89 ce                	mov    %ecx,%esi
+  800ff1:	cd 30                	int    $0x30
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+
+00800ff8 <sys_env_set_pgfault_upcall>:
+  800ff8:	55                   	push   %ebp
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	57                   	push   %edi
+  800ffc:	56                   	push   %esi
+  800ffd:	53                   	push   %ebx
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+  801001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801011:	89 df                	mov    %ebx,%edi
+  801013:	89 de                	mov    %ebx,%esi
+  801015:	cd 30                	int    $0x30
+  801017:	85 c0                	test   %eax,%eax
+  801019:	7f 08                	jg     801023 <sys_env_set_pgfault_upcall+0x2b>
+  80101b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+  801023:	83 ec 0c             	sub    $0xc,%esp
+  801026:	50                   	push   %eax
+  801027:	6a 0a                	push   $0xa
+  801029:	68 0b 45 80 00       	push   $0x80450b
+  80102e:	6a 24                	push   $0x24
+  801030:	68 28 45 80 00       	push   $0x804528
+  801035:	e8 73 f1 ff ff       	call   8001ad <_panic>
+
+0080103a <sys_ipc_try_send>:
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	57                   	push   %edi
+  80103e:	56                   	push   %esi
+  80103f:	53                   	push   %ebx
+  801040:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801047:	74 27                	je     801070 <sys_ipc_try_send+0x36>
+  801049:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801054:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801057:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80105a:	6a 00                	push   $0x0
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	8d 35 67 10 80 00    	lea    0x801067,%esi
+  801065:	0f 34                	sysenter
+  801067:	5d                   	pop    %ebp
+  801068:	83 c4 04             	add    $0x4,%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+  801070:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801075:	be 00 00 00 00       	mov    $0x0,%esi
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801080:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801083:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801086:	cd 30                	int    $0x30
+  801088:	eb e1                	jmp    80106b <sys_ipc_try_send+0x31>
+
+0080108a <sys_ipc_recv>:
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	57                   	push   %edi
+  80108e:	56                   	push   %esi
+  80108f:	53                   	push   %ebx
+  801090:	83 ec 0c             	sub    $0xc,%esp
+  801093:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80109a:	74 32                	je     8010ce <sys_ipc_recv+0x44>
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010a9:	89 cb                	mov    %ecx,%ebx
+  8010ab:	89 cf                	mov    %ecx,%edi
+  8010ad:	6a 00                	push   $0x0
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	8d 35 ba 10 80 00    	lea    0x8010ba,%esi
+  8010b8:	0f 34                	sysenter
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	83 c4 04             	add    $0x4,%esp
+  8010be:	89 c2                	mov    %eax,%edx
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 3c                	jg     801100 <sys_ipc_recv+0x76>
+  8010c4:	89 d0                	mov    %edx,%eax
+  8010c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+  8010ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010db:	89 cb                	mov    %ecx,%ebx
+  8010dd:	89 cf                	mov    %ecx,%edi
+  8010df:	89 ce                	mov    %ecx,%esi
+  8010e1:	cd 30                	int    $0x30
+  8010e3:	89 c2                	mov    %eax,%edx
+  8010e5:	85 c0                	test   %eax,%eax
+  8010e7:	7e db                	jle    8010c4 <sys_ipc_recv+0x3a>
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  8010ec:	50                   	push   %eax
+  8010ed:	6a 0d                	push   $0xd
+  8010ef:	68 0b 45 80 00       	push   $0x80450b
+  8010f4:	6a 24                	push   $0x24
+  8010f6:	68 28 45 80 00       	push   $0x804528
+  8010fb:	e8 ad f0 ff ff       	call   8001ad <_panic>
+  801100:	83 ec 0c             	sub    $0xc,%esp
+  801103:	50                   	push   %eax
+  801104:	6a 0d                	push   $0xd
+  801106:	68 0b 45 80 00       	push   $0x80450b
+  80110b:	6a 48                	push   $0x48
+  80110d:	68 28 45 80 00       	push   $0x804528
+  801112:	e8 96 f0 ff ff       	call   8001ad <_panic>
+
+00801117 <sys_ipc_send>:
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+  80111a:	57                   	push   %edi
+  80111b:	56                   	push   %esi
+  80111c:	53                   	push   %ebx
+  80111d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801124:	74 27                	je     80114d <sys_ipc_send+0x36>
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801131:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801134:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801137:	6a 00                	push   $0x0
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	8d 35 44 11 80 00    	lea    0x801144,%esi
+  801142:	0f 34                	sysenter
+  801144:	5d                   	pop    %ebp
+  801145:	83 c4 04             	add    $0x4,%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+  80114d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801152:	be 00 00 00 00       	mov    $0x0,%esi
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801160:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801163:	cd 30                	int    $0x30
+  801165:	eb e1                	jmp    801148 <sys_ipc_send+0x31>
+
+00801167 <sys_ipc_call>:
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801178:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801181:	cd 30                	int    $0x30
+  801183:	5b                   	pop    %ebx
+  801184:	5e                   	pop    %esi
+  801185:	5f                   	pop    %edi
+  801186:	5d                   	pop    %ebp
+  801187:	c3                   	ret
+
+00801188 <sys_ipc_reply_recv>:
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+  80118e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801191:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801194:	b8 10 00 00 00       	mov    $0x10,%eax
+  801199:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119f:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a2:	cd 30                	int    $0x30
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+
+008011a9 <sys_time_msec>:
+  8011a9:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8011ae:	85 c0                	test   %eax,%eax
+  8011b0:	75 06                	jne    8011b8 <sys_time_msec+0xf>
+  8011b2:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8011b7:	c3                   	ret
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	57                   	push   %edi
+  8011bc:	56                   	push   %esi
+  8011bd:	53                   	push   %ebx
+  8011be:	83 ec 0c             	sub    $0xc,%esp
+  8011c1:	0f 31                	rdtsc
+  8011c3:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8011c9:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8011cf:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8011d5:	29 c8                	sub    %ecx,%eax
+  8011d7:	19 da                	sbb    %ebx,%edx
+  8011d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	52                   	push   %edx
+  8011e1:	50                   	push   %eax
+  8011e2:	e8 f4 2d 00 00       	call   803fdb <__udivdi3>
+  8011e7:	83 c4 10             	add    $0x10,%esp
+  8011ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ed:	5b                   	pop    %ebx
+  8011ee:	5e                   	pop    %esi
+  8011ef:	5f                   	pop    %edi
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	c3                   	ret
+
+008011f2 <sys_env_swap>:
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	57                   	push   %edi
+  8011f6:	56                   	push   %esi
+  8011f7:	53                   	push   %ebx
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+  8011fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	b8 12 00 00 00       	mov    $0x12,%eax
+  801208:	89 cb                	mov    %ecx,%ebx
+  80120a:	89 cf                	mov    %ecx,%edi
+  80120c:	89 ce                	mov    %ecx,%esi
+  80120e:	cd 30                	int    $0x30
+  801210:	85 c0                	test   %eax,%eax
+  801212:	7f 08                	jg     80121c <sys_env_swap+0x2a>
+  801214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801217:	5b                   	pop    %ebx
+  801218:	5e                   	pop    %esi
+  801219:	5f                   	pop    %edi
+  80121a:	5d                   	pop    %ebp
+  80121b:	c3                   	ret
+  80121c:	83 ec 0c             	sub    $0xc,%esp
+  80121f:	50                   	push   %eax
+  801220:	6a 12                	push   $0x12
+  801222:	68 0b 45 80 00       	push   $0x80450b
+  801227:	6a 24                	push   $0x24
+  801229:	68 28 45 80 00       	push   $0x804528
+  80122e:	e8 7a ef ff ff       	call   8001ad <_panic>
+
+00801233 <sys_net_try_send>:
+  801233:	55                   	push   %ebp
+  801234:	89 e5                	mov    %esp,%ebp
+  801236:	57                   	push   %edi
+  801237:	56                   	push   %esi
+  801238:	53                   	push   %ebx
+  801239:	83 ec 0c             	sub    $0xc,%esp
+  80123c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801241:	8b 55 08             	mov    0x8(%ebp),%edx
+  801244:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801247:	b8 13 00 00 00       	mov    $0x13,%eax
+  80124c:	89 df                	mov    %ebx,%edi
+  80124e:	89 de                	mov    %ebx,%esi
+  801250:	cd 30                	int    $0x30
+  801252:	85 c0                	test   %eax,%eax
+  801254:	7f 08                	jg     80125e <sys_net_try_send+0x2b>
+  801256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+  801261:	50                   	push   %eax
+  801262:	6a 13                	push   $0x13
+  801264:	68 0b 45 80 00       	push   $0x80450b
+  801269:	6a 24                	push   $0x24
+  80126b:	68 28 45 80 00       	push   $0x804528
+  801270:	e8 38 ef ff ff       	call   8001ad <_panic>
+
+00801275 <sys_net_try_receive>:
+  801275:	55                   	push   %ebp
+  801276:	89 e5                	mov    %esp,%ebp
+  801278:	57                   	push   %edi
+  801279:	56                   	push   %esi
+  80127a:	53                   	push   %ebx
+  80127b:	83 ec 0c             	sub    $0xc,%esp
+  80127e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801283:	8b 55 08             	mov    0x8(%ebp),%edx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	b8 14 00 00 00       	mov    $0x14,%eax
+  80128e:	89 df                	mov    %ebx,%edi
+  801290:	89 de                	mov    %ebx,%esi
+  801292:	cd 30                	int    $0x30
+  801294:	85 c0                	test   %eax,%eax
+  801296:	7f 08                	jg     8012a0 <sys_net_try_receive+0x2b>
+  801298:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129b:	5b                   	pop    %ebx
+  80129c:	5e                   	pop    %esi
+  80129d:	5f                   	pop    %edi
+  80129e:	5d                   	pop    %ebp
+  80129f:	c3                   	ret
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+  8012a3:	50                   	push   %eax
+  8012a4:	6a 14                	push   $0x14
+  8012a6:	68 0b 45 80 00       	push   $0x80450b
+  8012ab:	6a 24                	push   $0x24
+  8012ad:	68 28 45 80 00       	push   $0x804528
+  8012b2:	e8 f6 ee ff ff       	call   8001ad <_panic>
+
+008012b7 <sys_net_recv_page>:
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	57                   	push   %edi
+  8012bb:	56                   	push   %esi
+  8012bc:	53                   	push   %ebx
+  8012bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c5:	b8 27 00 00 00       	mov    $0x27,%eax
+  8012ca:	89 cb                	mov    %ecx,%ebx
+  8012cc:	89 cf                	mov    %ecx,%edi
+  8012ce:	89 ce                	mov    %ecx,%esi
+  8012d0:	cd 30                	int    $0x30
+  8012d2:	5b                   	pop    %ebx
+  8012d3:	5e                   	pop    %esi
+  8012d4:	5f                   	pop    %edi
+  8012d5:	5d                   	pop    %ebp
+  8012d6:	c3                   	ret
+
+008012d7 <sys_net_wait>:
+  8012d7:	55                   	push   %ebp
+  8012d8:	89 e5                	mov    %esp,%ebp
+  8012da:	57                   	push   %edi
+  8012db:	56                   	push   %esi
+  8012dc:	53                   	push   %ebx
+  8012dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e2:	b8 26 00 00 00       	mov    $0x26,%eax
+  8012e7:	89 d1                	mov    %edx,%ecx
+  8012e9:	89 d3                	mov    %edx,%ebx
+  8012eb:	89 d7                	mov    %edx,%edi
+  8012ed:	89 d6                	mov    %edx,%esi
+  8012ef:	cd 30                	int    $0x30
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+
+008012f6 <sys_get_mac>:
+  8012f6:	55                   	push   %ebp
+  8012f7:	89 e5                	mov    %esp,%ebp
+  8012f9:	57                   	push   %edi
+  8012fa:	56                   	push   %esi
+  8012fb:	53                   	push   %ebx
+  8012fc:	83 ec 0c             	sub    $0xc,%esp
+  8012ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801304:	8b 55 08             	mov    0x8(%ebp),%edx
+  801307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80130f:	89 df                	mov    %ebx,%edi
+  801311:	89 de                	mov    %ebx,%esi
+  801313:	cd 30                	int    $0x30
+  801315:	85 c0                	test   %eax,%eax
+  801317:	7f 08                	jg     801321 <sys_get_mac+0x2b>
+  801319:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131c:	5b                   	pop    %ebx
+  80131d:	5e                   	pop    %esi
+  80131e:	5f                   	pop    %edi
+  80131f:	5d                   	pop    %ebp
+  801320:	c3                   	ret
+  801321:	83 ec 0c             	sub    $0xc,%esp
+  801324:	50                   	push   %eax
+  801325:	6a 15                	push   $0x15
+  801327:	68 0b 45 80 00       	push   $0x80450b
+  80132c:	6a 24                	push   $0x24
+  80132e:	68 28 45 80 00       	push   $0x804528
+  801333:	e8 75 ee ff ff       	call   8001ad <_panic>
+
+00801338 <sys_env_lease>:
+  801338:	55                   	push   %ebp
+  801339:	89 e5                	mov    %esp,%ebp
+  80133b:	57                   	push   %edi
+  80133c:	56                   	push   %esi
+  80133d:	53                   	push   %ebx
+  80133e:	83 ec 0c             	sub    $0xc,%esp
+  801341:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801346:	8b 55 08             	mov    0x8(%ebp),%edx
+  801349:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801351:	89 df                	mov    %ebx,%edi
+  801353:	89 de                	mov    %ebx,%esi
+  801355:	cd 30                	int    $0x30
+  801357:	85 c0                	test   %eax,%eax
+  801359:	7f 08                	jg     801363 <sys_env_lease+0x2b>
+  80135b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135e:	5b                   	pop    %ebx
+  80135f:	5e                   	pop    %esi
+  801360:	5f                   	pop    %edi
+  801361:	5d                   	pop    %ebp
+  801362:	c3                   	ret
+  801363:	83 ec 0c             	sub    $0xc,%esp
+  801366:	50                   	push   %eax
+  801367:	6a 16                	push   $0x16
+  801369:	68 0b 45 80 00       	push   $0x80450b
+  80136e:	6a 24                	push   $0x24
+  801370:	68 28 45 80 00       	push   $0x804528
+  801375:	e8 33 ee ff ff       	call   8001ad <_panic>
+
+0080137a <sys_copy_mem>:
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	57                   	push   %edi
+  80137e:	56                   	push   %esi
+  80137f:	53                   	push   %ebx
+  801380:	83 ec 0c             	sub    $0xc,%esp
+  801383:	8b 55 08             	mov    0x8(%ebp),%edx
+  801386:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801389:	b8 17 00 00 00       	mov    $0x17,%eax
+  80138e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801391:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801394:	8b 75 18             	mov    0x18(%ebp),%esi
+  801397:	cd 30                	int    $0x30
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	7f 08                	jg     8013a5 <sys_copy_mem+0x2b>
+  80139d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a0:	5b                   	pop    %ebx
+  8013a1:	5e                   	pop    %esi
+  8013a2:	5f                   	pop    %edi
+  8013a3:	5d                   	pop    %ebp
+  8013a4:	c3                   	ret
+  8013a5:	83 ec 0c             	sub    $0xc,%esp
+  8013a8:	50                   	push   %eax
+  8013a9:	6a 17                	push   $0x17
+  8013ab:	68 0b 45 80 00       	push   $0x80450b
+  8013b0:	6a 24                	push   $0x24
+  8013b2:	68 28 45 80 00       	push   $0x804528
+  8013b7:	e8 f1 ed ff ff       	call   8001ad <_panic>
+
+008013bc <sys_get_perms>:
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	57                   	push   %edi
+  8013c0:	56                   	push   %esi
+  8013c1:	53                   	push   %ebx
+  8013c2:	83 ec 0c             	sub    $0xc,%esp
+  8013c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d8:	89 f7                	mov    %esi,%edi
+  8013da:	cd 30                	int    $0x30
+  8013dc:	85 c0                	test   %eax,%eax
+  8013de:	7f 08                	jg     8013e8 <sys_get_perms+0x2c>
+  8013e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e3:	5b                   	pop    %ebx
+  8013e4:	5e                   	pop    %esi
+  8013e5:	5f                   	pop    %edi
+  8013e6:	5d                   	pop    %ebp
+  8013e7:	c3                   	ret
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+  8013eb:	50                   	push   %eax
+  8013ec:	6a 18                	push   $0x18
+  8013ee:	68 0b 45 80 00       	push   $0x80450b
+  8013f3:	6a 24                	push   $0x24
+  8013f5:	68 28 45 80 00       	push   $0x804528
+  8013fa:	e8 ae ed ff ff       	call   8001ad <_panic>
+
+008013ff <sys_env_unsuspend>:
+  8013ff:	55                   	push   %ebp
+  801400:	89 e5                	mov    %esp,%ebp
+  801402:	57                   	push   %edi
+  801403:	56                   	push   %esi
+  801404:	53                   	push   %ebx
+  801405:	83 ec 0c             	sub    $0xc,%esp
+  801408:	be 00 00 00 00       	mov    $0x0,%esi
+  80140d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801410:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801413:	b8 19 00 00 00       	mov    $0x19,%eax
+  801418:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80141b:	89 f7                	mov    %esi,%edi
+  80141d:	cd 30                	int    $0x30
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	7f 08                	jg     80142b <sys_env_unsuspend+0x2c>
+  801423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5f                   	pop    %edi
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+  80142b:	83 ec 0c             	sub    $0xc,%esp
+  80142e:	50                   	push   %eax
+  80142f:	6a 19                	push   $0x19
+  801431:	68 0b 45 80 00       	push   $0x80450b
+  801436:	6a 24                	push   $0x24
+  801438:	68 28 45 80 00       	push   $0x804528
+  80143d:	e8 6b ed ff ff       	call   8001ad <_panic>
+
+00801442 <sys_migrate>:
+  801442:	55                   	push   %ebp
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	57                   	push   %edi
+  801446:	56                   	push   %esi
+  801447:	53                   	push   %ebx
+  801448:	83 ec 0c             	sub    $0xc,%esp
+  80144b:	ba 04 90 80 00       	mov    $0x809004,%edx
+  801450:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801456:	76 11                	jbe    801469 <sys_migrate+0x27>
+  801458:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80145d:	0f b6 08             	movzbl (%eax),%ecx
+  801460:	05 00 10 00 00       	add    $0x1000,%eax
+  801465:	39 d0                	cmp    %edx,%eax
+  801467:	72 f4                	jb     80145d <sys_migrate+0x1b>
+  801469:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801471:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801476:	89 cb                	mov    %ecx,%ebx
+  801478:	89 cf                	mov    %ecx,%edi
+  80147a:	89 ce                	mov    %ecx,%esi
+  80147c:	cd 30                	int    $0x30
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	7f 08                	jg     80148a <sys_migrate+0x48>
+  801482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+  80148a:	83 ec 0c             	sub    $0xc,%esp
+  80148d:	50                   	push   %eax
+  80148e:	6a 1a                	push   $0x1a
+  801490:	68 0b 45 80 00       	push   $0x80450b
+  801495:	6a 24                	push   $0x24
+  801497:	68 28 45 80 00       	push   $0x804528
+  80149c:	e8 0c ed ff ff       	call   8001ad <_panic>
+
+008014a1 <sys_lease_complete>:
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	57                   	push   %edi
+  8014a5:	56                   	push   %esi
+  8014a6:	53                   	push   %ebx
+  8014a7:	83 ec 0c             	sub    $0xc,%esp
+  8014aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014b4:	89 d1                	mov    %edx,%ecx
+  8014b6:	89 d3                	mov    %edx,%ebx
+  8014b8:	89 d7                	mov    %edx,%edi
+  8014ba:	89 d6                	mov    %edx,%esi
+  8014bc:	cd 30                	int    $0x30
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	7f 08                	jg     8014ca <sys_lease_complete+0x29>
+  8014c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+  8014ca:	83 ec 0c             	sub    $0xc,%esp
+  8014cd:	50                   	push   %eax
+  8014ce:	6a 1b                	push   $0x1b
+  8014d0:	68 0b 45 80 00       	push   $0x80450b
+  8014d5:	6a 24                	push   $0x24
+  8014d7:	68 28 45 80 00       	push   $0x804528
+  8014dc:	e8 cc ec ff ff       	call   8001ad <_panic>
+
+008014e1 <sys_env_set_thisenv>:
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+  8014e7:	83 ec 0c             	sub    $0xc,%esp
+  8014ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014fa:	89 df                	mov    %ebx,%edi
+  8014fc:	89 de                	mov    %ebx,%esi
+  8014fe:	cd 30                	int    $0x30
+  801500:	85 c0                	test   %eax,%eax
+  801502:	7f 08                	jg     80150c <sys_env_set_thisenv+0x2b>
+  801504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801507:	5b                   	pop    %ebx
+  801508:	5e                   	pop    %esi
+  801509:	5f                   	pop    %edi
+  80150a:	5d                   	pop    %ebp
+  80150b:	c3                   	ret
+  80150c:	83 ec 0c             	sub    $0xc,%esp
+  80150f:	50                   	push   %eax
+  801510:	6a 1c                	push   $0x1c
+  801512:	68 0b 45 80 00       	push   $0x80450b
+  801517:	6a 24                	push   $0x24
+  801519:	68 28 45 80 00       	push   $0x804528
+  80151e:	e8 8a ec ff ff       	call   8001ad <_panic>
+
+00801523 <sys_env_set_sched>:
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	57                   	push   %edi
+  801527:	56                   	push   %esi
+  801528:	53                   	push   %ebx
+  801529:	83 ec 0c             	sub    $0xc,%esp
+  80152c:	be 00 00 00 00       	mov    $0x0,%esi
+  801531:	8b 55 08             	mov    0x8(%ebp),%edx
+  801534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801537:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80153c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153f:	89 f7                	mov    %esi,%edi
+  801541:	cd 30                	int    $0x30
+  801543:	85 c0                	test   %eax,%eax
+  801545:	7f 08                	jg     80154f <sys_env_set_sched+0x2c>
+  801547:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154a:	5b                   	pop    %ebx
+  80154b:	5e                   	pop    %esi
+  80154c:	5f                   	pop    %edi
+  80154d:	5d                   	pop    %ebp
+  80154e:	c3                   	ret
+  80154f:	83 ec 0c             	sub    $0xc,%esp
+  801552:	50                   	push   %eax
+  801553:	6a 1d                	push   $0x1d
+  801555:	68 0b 45 80 00       	push   $0x80450b
+  80155a:	6a 24                	push   $0x24
+  80155c:	68 28 45 80 00       	push   $0x804528
+  801561:	e8 47 ec ff ff       	call   8001ad <_panic>
+
+00801566 <sys_batch>:
+  801566:	55                   	push   %ebp
+  801567:	89 e5                	mov    %esp,%ebp
+  801569:	57                   	push   %edi
+  80156a:	56                   	push   %esi
+  80156b:	53                   	push   %ebx
+  80156c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801577:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80157c:	89 df                	mov    %ebx,%edi
+  80157e:	89 de                	mov    %ebx,%esi
+  801580:	cd 30                	int    $0x30
+  801582:	5b                   	pop    %ebx
+  801583:	5e                   	pop    %esi
+  801584:	5f                   	pop    %edi
+  801585:	5d                   	pop    %ebp
+  801586:	c3                   	ret
+
+00801587 <sys_env_stats>:
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	57                   	push   %edi
+  80158b:	56                   	push   %esi
+  80158c:	53                   	push   %ebx
+  80158d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801592:	8b 55 08             	mov    0x8(%ebp),%edx
+  801595:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801598:	b8 23 00 00 00       	mov    $0x23,%eax
+  80159d:	89 df                	mov    %ebx,%edi
+  80159f:	89 de                	mov    %ebx,%esi
+  8015a1:	cd 30                	int    $0x30
+  8015a3:	5b                   	pop    %ebx
+  8015a4:	5e                   	pop    %esi
+  8015a5:	5f                   	pop    %edi
+  8015a6:	5d                   	pop    %ebp
+  8015a7:	c3                   	ret
+
+008015a8 <sys_trace>:
+  8015a8:	55                   	push   %ebp
+  8015a9:	89 e5                	mov    %esp,%ebp
+  8015ab:	57                   	push   %edi
+  8015ac:	56                   	push   %esi
+  8015ad:	53                   	push   %ebx
+  8015ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b6:	b8 24 00 00 00       	mov    $0x24,%eax
+  8015bb:	89 cb                	mov    %ecx,%ebx
+  8015bd:	89 cf                	mov    %ecx,%edi
+  8015bf:	89 ce                	mov    %ecx,%esi
+  8015c1:	cd 30                	int    $0x30
+  8015c3:	5b                   	pop    %ebx
+  8015c4:	5e                   	pop    %esi
+  8015c5:	5f                   	pop    %edi
+  8015c6:	5d                   	pop    %ebp
+  8015c7:	c3                   	ret
+
+008015c8 <sys_env_set_pager>:
+  8015c8:	55                   	push   %ebp
+  8015c9:	89 e5                	mov    %esp,%ebp
+  8015cb:	57                   	push   %edi
+  8015cc:	56                   	push   %esi
+  8015cd:	53                   	push   %ebx
+  8015ce:	83 ec 0c             	sub    $0xc,%esp
+  8015d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015dc:	b8 25 00 00 00       	mov    $0x25,%eax
+  8015e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e4:	89 f7                	mov    %esi,%edi
+  8015e6:	cd 30                	int    $0x30
+  8015e8:	85 c0                	test   %eax,%eax
+  8015ea:	7f 08                	jg     8015f4 <sys_env_set_pager+0x2c>
+  8015ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ef:	5b                   	pop    %ebx
+  8015f0:	5e                   	pop    %esi
+  8015f1:	5f                   	pop    %edi
+  8015f2:	5d                   	pop    %ebp
+  8015f3:	c3                   	ret
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+  8015f7:	50                   	push   %eax
+  8015f8:	6a 25                	push   $0x25
+  8015fa:	68 0b 45 80 00       	push   $0x80450b
+  8015ff:	6a 24                	push   $0x24
+  801601:	68 28 45 80 00       	push   $0x804528
+  801606:	e8 a2 eb ff ff       	call   8001ad <_panic>
+
+0080160b <sys_pager_retire>:
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	57                   	push   %edi
+  80160f:	56                   	push   %esi
+  801610:	53                   	push   %ebx
+  801611:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801616:	8b 55 08             	mov    0x8(%ebp),%edx
+  801619:	b8 28 00 00 00       	mov    $0x28,%eax
+  80161e:	89 cb                	mov    %ecx,%ebx
+  801620:	89 cf                	mov    %ecx,%edi
+  801622:	89 ce                	mov    %ecx,%esi
+  801624:	cd 30                	int    $0x30
+  801626:	5b                   	pop    %ebx
+  801627:	5e                   	pop    %esi
+  801628:	5f                   	pop    %edi
+  801629:	5d                   	pop    %ebp
+  80162a:	c3                   	ret
+
+0080162b <sys_prof>:
+  80162b:	55                   	push   %ebp
+  80162c:	89 e5                	mov    %esp,%ebp
+  80162e:	57                   	push   %edi
+  80162f:	56                   	push   %esi
+  801630:	53                   	push   %ebx
+  801631:	be 00 00 00 00       	mov    $0x0,%esi
+  801636:	8b 55 08             	mov    0x8(%ebp),%edx
+  801639:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163c:	b8 22 00 00 00       	mov    $0x22,%eax
+  801641:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801644:	89 f7                	mov    %esi,%edi
+  801646:	cd 30                	int    $0x30
+  801648:	5b                   	pop    %ebx
+  801649:	5e                   	pop    %esi
+  80164a:	5f                   	pop    %edi
+  80164b:	5d                   	pop    %ebp
+  80164c:	c3                   	ret
+
+0080164d <fd2num>:
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	8b 45 08             	mov    0x8(%ebp),%eax
+  801653:	05 00 00 00 30       	add    $0x30000000,%eax
+  801658:	c1 e8 0c             	shr    $0xc,%eax
+  80165b:	5d                   	pop    %ebp
+  80165c:	c3                   	ret
+
+0080165d <fd2data>:
+  80165d:	55                   	push   %ebp
+  80165e:	89 e5                	mov    %esp,%ebp
+  801660:	8b 45 08             	mov    0x8(%ebp),%eax
+  801663:	05 00 00 00 30       	add    $0x30000000,%eax
+  801668:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80166d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801672:	5d                   	pop    %ebp
+  801673:	c3                   	ret
+
+00801674 <fd_alloc>:
+  801674:	55                   	push   %ebp
+  801675:	89 e5                	mov    %esp,%ebp
+  801677:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80167c:	89 c2                	mov    %eax,%edx
+  80167e:	c1 ea 16             	shr    $0x16,%edx
+  801681:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801688:	f6 c2 01             	test   $0x1,%dl
+  80168b:	74 29                	je     8016b6 <fd_alloc+0x42>
+  80168d:	89 c2                	mov    %eax,%edx
+  80168f:	c1 ea 0c             	shr    $0xc,%edx
+  801692:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801699:	f6 c2 01             	test   $0x1,%dl
+  80169c:	74 18                	je     8016b6 <fd_alloc+0x42>
+  80169e:	05 00 10 00 00       	add    $0x1000,%eax
+  8016a3:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8016a8:	75 d2                	jne    80167c <fd_alloc+0x8>
+  8016aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016af:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016b4:	eb 05                	jmp    8016bb <fd_alloc+0x47>
+  8016b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016be:	89 02                	mov    %eax,(%edx)
+  8016c0:	89 c8                	mov    %ecx,%eax
+  8016c2:	5d                   	pop    %ebp
+  8016c3:	c3                   	ret
+
+008016c4 <fd_lookup>:
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ca:	83 f8 1f             	cmp    $0x1f,%eax
+  8016cd:	77 30                	ja     8016ff <fd_lookup+0x3b>
+  8016cf:	c1 e0 0c             	shl    $0xc,%eax
+  8016d2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8016d7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016dd:	f6 c2 01             	test   $0x1,%dl
+  8016e0:	74 24                	je     801706 <fd_lookup+0x42>
+  8016e2:	89 c2                	mov    %eax,%edx
+  8016e4:	c1 ea 0c             	shr    $0xc,%edx
+  8016e7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016ee:	f6 c2 01             	test   $0x1,%dl
+  8016f1:	74 1a                	je     80170d <fd_lookup+0x49>
+  8016f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016f6:	89 02                	mov    %eax,(%edx)
+  8016f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fd:	5d                   	pop    %ebp
+  8016fe:	c3                   	ret
+  8016ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801704:	eb f7                	jmp    8016fd <fd_lookup+0x39>
+  801706:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80170b:	eb f0                	jmp    8016fd <fd_lookup+0x39>
+  80170d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801712:	eb e9                	jmp    8016fd <fd_lookup+0x39>
+
+00801714 <dev_lookup>:
+  801714:	55                   	push   %ebp
+  801715:	89 e5                	mov    %esp,%ebp
+  801717:	53                   	push   %ebx
+  801718:	83 ec 04             	sub    $0x4,%esp
+  80171b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801723:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801728:	39 13                	cmp    %edx,(%ebx)
+  80172a:	74 37                	je     801763 <dev_lookup+0x4f>
+  80172c:	83 c0 01             	add    $0x1,%eax
+  80172f:	8b 1c 85 b4 45 80 00 	mov    0x8045b4(,%eax,4),%ebx
+  801736:	85 db                	test   %ebx,%ebx
+  801738:	75 ee                	jne    801728 <dev_lookup+0x14>
+  80173a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80173f:	8b 40 48             	mov    0x48(%eax),%eax
+  801742:	83 ec 04             	sub    $0x4,%esp
+  801745:	52                   	push   %edx
+  801746:	50                   	push   %eax
+  801747:	68 38 45 80 00       	push   $0x804538
+  80174c:	e8 37 eb ff ff       	call   800288 <cprintf>
+  801751:	83 c4 10             	add    $0x10,%esp
+  801754:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801759:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80175c:	89 1a                	mov    %ebx,(%edx)
+  80175e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+  801763:	b8 00 00 00 00       	mov    $0x0,%eax
+  801768:	eb ef                	jmp    801759 <dev_lookup+0x45>
+
+0080176a <fd_close>:
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	57                   	push   %edi
+  80176e:	56                   	push   %esi
+  80176f:	53                   	push   %ebx
+  801770:	83 ec 24             	sub    $0x24,%esp
+  801773:	8b 75 08             	mov    0x8(%ebp),%esi
+  801776:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801779:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80177c:	50                   	push   %eax
+  80177d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801783:	c1 e8 0c             	shr    $0xc,%eax
+  801786:	50                   	push   %eax
+  801787:	e8 38 ff ff ff       	call   8016c4 <fd_lookup>
+  80178c:	89 c3                	mov    %eax,%ebx
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	85 c0                	test   %eax,%eax
+  801793:	78 05                	js     80179a <fd_close+0x30>
+  801795:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801798:	74 0f                	je     8017a9 <fd_close+0x3f>
+  80179a:	85 ff                	test   %edi,%edi
+  80179c:	0f 44 df             	cmove  %edi,%ebx
+  80179f:	89 d8                	mov    %ebx,%eax
+  8017a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a4:	5b                   	pop    %ebx
+  8017a5:	5e                   	pop    %esi
+  8017a6:	5f                   	pop    %edi
+  8017a7:	5d                   	pop    %ebp
+  8017a8:	c3                   	ret
+  8017a9:	83 ec 08             	sub    $0x8,%esp
+  8017ac:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017af:	50                   	push   %eax
+  8017b0:	ff 36                	push   (%esi)
+  8017b2:	e8 5d ff ff ff       	call   801714 <dev_lookup>
+  8017b7:	89 c3                	mov    %eax,%ebx
+  8017b9:	83 c4 10             	add    $0x10,%esp
+  8017bc:	85 c0                	test   %eax,%eax
+  8017be:	78 1a                	js     8017da <fd_close+0x70>
+  8017c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017c3:	8b 40 10             	mov    0x10(%eax),%eax
+  8017c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	74 0b                	je     8017da <fd_close+0x70>
+  8017cf:	83 ec 0c             	sub    $0xc,%esp
+  8017d2:	56                   	push   %esi
+  8017d3:	ff d0                	call   *%eax
+  8017d5:	89 c3                	mov    %eax,%ebx
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	83 ec 08             	sub    $0x8,%esp
+  8017dd:	56                   	push   %esi
+  8017de:	6a 00                	push   $0x0
+  8017e0:	e8 cc f6 ff ff       	call   800eb1 <sys_page_unmap>
+  8017e5:	83 c4 10             	add    $0x10,%esp
+  8017e8:	eb b5                	jmp    80179f <fd_close+0x35>
+
+008017ea <close>:
+  8017ea:	55                   	push   %ebp
+  8017eb:	89 e5                	mov    %esp,%ebp
+  8017ed:	83 ec 20             	sub    $0x20,%esp
+  8017f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f3:	50                   	push   %eax
+  8017f4:	ff 75 08             	push   0x8(%ebp)
+  8017f7:	e8 c8 fe ff ff       	call   8016c4 <fd_lookup>
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	85 c0                	test   %eax,%eax
+  801801:	79 02                	jns    801805 <close+0x1b>
+  801803:	c9                   	leave
+  801804:	c3                   	ret
+  801805:	83 ec 08             	sub    $0x8,%esp
+  801808:	6a 01                	push   $0x1
+  80180a:	ff 75 f4             	push   -0xc(%ebp)
+  80180d:	e8 58 ff ff ff       	call   80176a <fd_close>
+  801812:	83 c4 10             	add    $0x10,%esp
+  801815:	eb ec                	jmp    801803 <close+0x19>
+
+00801817 <close_all>:
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	53                   	push   %ebx
+  80181b:	83 ec 04             	sub    $0x4,%esp
+  80181e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801823:	83 ec 0c             	sub    $0xc,%esp
+  801826:	53                   	push   %ebx
+  801827:	e8 be ff ff ff       	call   8017ea <close>
+  80182c:	83 c3 01             	add    $0x1,%ebx
+  80182f:	83 c4 10             	add    $0x10,%esp
+  801832:	83 fb 20             	cmp    $0x20,%ebx
+  801835:	75 ec                	jne    801823 <close_all+0xc>
+  801837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80183a:	c9                   	leave
+  80183b:	c3                   	ret
+
+0080183c <dup>:
+  80183c:	55                   	push   %ebp
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	57                   	push   %edi
+  801840:	56                   	push   %esi
+  801841:	53                   	push   %ebx
+  801842:	83 ec 34             	sub    $0x34,%esp
+  801845:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801848:	50                   	push   %eax
+  801849:	ff 75 08             	push   0x8(%ebp)
+  80184c:	e8 73 fe ff ff       	call   8016c4 <fd_lookup>
+  801851:	89 c3                	mov    %eax,%ebx
+  801853:	83 c4 10             	add    $0x10,%esp
+  801856:	85 c0                	test   %eax,%eax
+  801858:	78 7f                	js     8018d9 <dup+0x9d>
+  80185a:	83 ec 0c             	sub    $0xc,%esp
+  80185d:	ff 75 0c             	push   0xc(%ebp)
+  801860:	e8 85 ff ff ff       	call   8017ea <close>
+  801865:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801868:	c1 e6 0c             	shl    $0xc,%esi
+  80186b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801871:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801874:	89 3c 24             	mov    %edi,(%esp)
+  801877:	e8 e1 fd ff ff       	call   80165d <fd2data>
+  80187c:	89 c3                	mov    %eax,%ebx
+  80187e:	89 34 24             	mov    %esi,(%esp)
+  801881:	e8 d7 fd ff ff       	call   80165d <fd2data>
+  801886:	83 c4 10             	add    $0x10,%esp
+  801889:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80188c:	89 d8                	mov    %ebx,%eax
+  80188e:	c1 e8 16             	shr    $0x16,%eax
+  801891:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801898:	a8 01                	test   $0x1,%al
+  80189a:	74 11                	je     8018ad <dup+0x71>
+  80189c:	89 d8                	mov    %ebx,%eax
+  80189e:	c1 e8 0c             	shr    $0xc,%eax
+  8018a1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018a8:	f6 c2 01             	test   $0x1,%dl
+  8018ab:	75 36                	jne    8018e3 <dup+0xa7>
+  8018ad:	89 f8                	mov    %edi,%eax
+  8018af:	c1 e8 0c             	shr    $0xc,%eax
+  8018b2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018b9:	83 ec 0c             	sub    $0xc,%esp
+  8018bc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018c1:	50                   	push   %eax
+  8018c2:	56                   	push   %esi
+  8018c3:	6a 00                	push   $0x0
+  8018c5:	57                   	push   %edi
+  8018c6:	6a 00                	push   $0x0
+  8018c8:	e8 55 f5 ff ff       	call   800e22 <sys_page_map>
+  8018cd:	89 c3                	mov    %eax,%ebx
+  8018cf:	83 c4 20             	add    $0x20,%esp
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	78 33                	js     801909 <dup+0xcd>
+  8018d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018d9:	89 d8                	mov    %ebx,%eax
+  8018db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018de:	5b                   	pop    %ebx
+  8018df:	5e                   	pop    %esi
+  8018e0:	5f                   	pop    %edi
+  8018e1:	5d                   	pop    %ebp
+  8018e2:	c3                   	ret
+  8018e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018f2:	50                   	push   %eax
+  8018f3:	ff 75 d4             	push   -0x2c(%ebp)
+  8018f6:	6a 00                	push   $0x0
+  8018f8:	53                   	push   %ebx
+  8018f9:	6a 00                	push   $0x0
+  8018fb:	e8 22 f5 ff ff       	call   800e22 <sys_page_map>
+  801900:	89 c3                	mov    %eax,%ebx
+  801902:	83 c4 20             	add    $0x20,%esp
+  801905:	85 c0                	test   %eax,%eax
+  801907:	79 a4                	jns    8018ad <dup+0x71>
+  801909:	83 ec 08             	sub    $0x8,%esp
+  80190c:	56                   	push   %esi
+  80190d:	6a 00                	push   $0x0
+  80190f:	e8 9d f5 ff ff       	call   800eb1 <sys_page_unmap>
+  801914:	83 c4 08             	add    $0x8,%esp
+  801917:	ff 75 d4             	push   -0x2c(%ebp)
+  80191a:	6a 00                	push   $0x0
+  80191c:	e8 90 f5 ff ff       	call   800eb1 <sys_page_unmap>
+  801921:	83 c4 10             	add    $0x10,%esp
+  801924:	eb b3                	jmp    8018d9 <dup+0x9d>
+
+00801926 <read>:
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	56                   	push   %esi
+  80192a:	53                   	push   %ebx
+  80192b:	83 ec 18             	sub    $0x18,%esp
+  80192e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801931:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801934:	50                   	push   %eax
+  801935:	56                   	push   %esi
+  801936:	e8 89 fd ff ff       	call   8016c4 <fd_lookup>
+  80193b:	83 c4 10             	add    $0x10,%esp
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	78 3c                	js     80197e <read+0x58>
+  801942:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801945:	83 ec 08             	sub    $0x8,%esp
+  801948:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80194b:	50                   	push   %eax
+  80194c:	ff 33                	push   (%ebx)
+  80194e:	e8 c1 fd ff ff       	call   801714 <dev_lookup>
+  801953:	83 c4 10             	add    $0x10,%esp
+  801956:	85 c0                	test   %eax,%eax
+  801958:	78 24                	js     80197e <read+0x58>
+  80195a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80195d:	83 e0 03             	and    $0x3,%eax
+  801960:	83 f8 01             	cmp    $0x1,%eax
+  801963:	74 20                	je     801985 <read+0x5f>
+  801965:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801968:	8b 40 08             	mov    0x8(%eax),%eax
+  80196b:	85 c0                	test   %eax,%eax
+  80196d:	74 37                	je     8019a6 <read+0x80>
+  80196f:	83 ec 04             	sub    $0x4,%esp
+  801972:	ff 75 10             	push   0x10(%ebp)
+  801975:	ff 75 0c             	push   0xc(%ebp)
+  801978:	53                   	push   %ebx
+  801979:	ff d0                	call   *%eax
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801981:	5b                   	pop    %ebx
+  801982:	5e                   	pop    %esi
+  801983:	5d                   	pop    %ebp
+  801984:	c3                   	ret
+  801985:	a1 14 60 80 00       	mov    0x806014,%eax
+  80198a:	8b 40 48             	mov    0x48(%eax),%eax
+  80198d:	83 ec 04             	sub    $0x4,%esp
+  801990:	56                   	push   %esi
+  801991:	50                   	push   %eax
+  801992:	68 79 45 80 00       	push   $0x804579
+  801997:	e8 ec e8 ff ff       	call   800288 <cprintf>
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a4:	eb d8                	jmp    80197e <read+0x58>
+  8019a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019ab:	eb d1                	jmp    80197e <read+0x58>
+
+008019ad <readn>:
+  8019ad:	55                   	push   %ebp
+  8019ae:	89 e5                	mov    %esp,%ebp
+  8019b0:	57                   	push   %edi
+  8019b1:	56                   	push   %esi
+  8019b2:	53                   	push   %ebx
+  8019b3:	83 ec 0c             	sub    $0xc,%esp
+  8019b6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8019b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019bc:	85 f6                	test   %esi,%esi
+  8019be:	74 30                	je     8019f0 <readn+0x43>
+  8019c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ca:	83 ec 04             	sub    $0x4,%esp
+  8019cd:	89 f2                	mov    %esi,%edx
+  8019cf:	29 c2                	sub    %eax,%edx
+  8019d1:	52                   	push   %edx
+  8019d2:	01 f8                	add    %edi,%eax
+  8019d4:	50                   	push   %eax
+  8019d5:	ff 75 08             	push   0x8(%ebp)
+  8019d8:	e8 49 ff ff ff       	call   801926 <read>
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 15                	js     8019f9 <readn+0x4c>
+  8019e4:	74 11                	je     8019f7 <readn+0x4a>
+  8019e6:	01 c3                	add    %eax,%ebx
+  8019e8:	89 d8                	mov    %ebx,%eax
+  8019ea:	39 f3                	cmp    %esi,%ebx
+  8019ec:	72 dc                	jb     8019ca <readn+0x1d>
+  8019ee:	eb 09                	jmp    8019f9 <readn+0x4c>
+  8019f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f5:	eb 02                	jmp    8019f9 <readn+0x4c>
+  8019f7:	89 d8                	mov    %ebx,%eax
+  8019f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019fc:	5b                   	pop    %ebx
+  8019fd:	5e                   	pop    %esi
+  8019fe:	5f                   	pop    %edi
+  8019ff:	5d                   	pop    %ebp
+  801a00:	c3                   	ret
+
+00801a01 <write>:
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	56                   	push   %esi
+  801a05:	53                   	push   %ebx
+  801a06:	83 ec 18             	sub    $0x18,%esp
+  801a09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a0f:	50                   	push   %eax
+  801a10:	53                   	push   %ebx
+  801a11:	e8 ae fc ff ff       	call   8016c4 <fd_lookup>
+  801a16:	83 c4 10             	add    $0x10,%esp
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 37                	js     801a54 <write+0x53>
+  801a1d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a20:	83 ec 08             	sub    $0x8,%esp
+  801a23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a26:	50                   	push   %eax
+  801a27:	ff 36                	push   (%esi)
+  801a29:	e8 e6 fc ff ff       	call   801714 <dev_lookup>
+  801a2e:	83 c4 10             	add    $0x10,%esp
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 1f                	js     801a54 <write+0x53>
+  801a35:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a39:	74 20                	je     801a5b <write+0x5a>
+  801a3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	74 37                	je     801a7c <write+0x7b>
+  801a45:	83 ec 04             	sub    $0x4,%esp
+  801a48:	ff 75 10             	push   0x10(%ebp)
+  801a4b:	ff 75 0c             	push   0xc(%ebp)
+  801a4e:	56                   	push   %esi
+  801a4f:	ff d0                	call   *%eax
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a57:	5b                   	pop    %ebx
+  801a58:	5e                   	pop    %esi
+  801a59:	5d                   	pop    %ebp
+  801a5a:	c3                   	ret
+  801a5b:	a1 14 60 80 00       	mov    0x806014,%eax
+  801a60:	8b 40 48             	mov    0x48(%eax),%eax
+  801a63:	83 ec 04             	sub    $0x4,%esp
+  801a66:	53                   	push   %ebx
+  801a67:	50                   	push   %eax
+  801a68:	68 95 45 80 00       	push   $0x804595
+  801a6d:	e8 16 e8 ff ff       	call   800288 <cprintf>
+  801a72:	83 c4 10             	add    $0x10,%esp
+  801a75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7a:	eb d8                	jmp    801a54 <write+0x53>
+  801a7c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a81:	eb d1                	jmp    801a54 <write+0x53>
+
+00801a83 <seek>:
+  801a83:	55                   	push   %ebp
+  801a84:	89 e5                	mov    %esp,%ebp
+  801a86:	83 ec 20             	sub    $0x20,%esp
+  801a89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a8c:	50                   	push   %eax
+  801a8d:	ff 75 08             	push   0x8(%ebp)
+  801a90:	e8 2f fc ff ff       	call   8016c4 <fd_lookup>
+  801a95:	83 c4 10             	add    $0x10,%esp
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	78 0e                	js     801aaa <seek+0x27>
+  801a9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa2:	89 50 04             	mov    %edx,0x4(%eax)
+  801aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+
+00801aac <ftruncate>:
+  801aac:	55                   	push   %ebp
+  801aad:	89 e5                	mov    %esp,%ebp
+  801aaf:	56                   	push   %esi
+  801ab0:	53                   	push   %ebx
+  801ab1:	83 ec 18             	sub    $0x18,%esp
+  801ab4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ab7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aba:	50                   	push   %eax
+  801abb:	53                   	push   %ebx
+  801abc:	e8 03 fc ff ff       	call   8016c4 <fd_lookup>
+  801ac1:	83 c4 10             	add    $0x10,%esp
+  801ac4:	85 c0                	test   %eax,%eax
+  801ac6:	78 34                	js     801afc <ftruncate+0x50>
+  801ac8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801acb:	83 ec 08             	sub    $0x8,%esp
+  801ace:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad1:	50                   	push   %eax
+  801ad2:	ff 36                	push   (%esi)
+  801ad4:	e8 3b fc ff ff       	call   801714 <dev_lookup>
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 1c                	js     801afc <ftruncate+0x50>
+  801ae0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ae4:	74 1d                	je     801b03 <ftruncate+0x57>
+  801ae6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae9:	8b 40 18             	mov    0x18(%eax),%eax
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	74 34                	je     801b24 <ftruncate+0x78>
+  801af0:	83 ec 08             	sub    $0x8,%esp
+  801af3:	ff 75 0c             	push   0xc(%ebp)
+  801af6:	56                   	push   %esi
+  801af7:	ff d0                	call   *%eax
+  801af9:	83 c4 10             	add    $0x10,%esp
+  801afc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aff:	5b                   	pop    %ebx
+  801b00:	5e                   	pop    %esi
+  801b01:	5d                   	pop    %ebp
+  801b02:	c3                   	ret
+  801b03:	a1 14 60 80 00       	mov    0x806014,%eax
+  801b08:	8b 40 48             	mov    0x48(%eax),%eax
+  801b0b:	83 ec 04             	sub    $0x4,%esp
+  801b0e:	53                   	push   %ebx
+  801b0f:	50                   	push   %eax
+  801b10:	68 58 45 80 00       	push   $0x804558
+  801b15:	e8 6e e7 ff ff       	call   800288 <cprintf>
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b22:	eb d8                	jmp    801afc <ftruncate+0x50>
+  801b24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b29:	eb d1                	jmp    801afc <ftruncate+0x50>
+
+00801b2b <fstat>:
+  801b2b:	55                   	push   %ebp
+  801b2c:	89 e5                	mov    %esp,%ebp
+  801b2e:	56                   	push   %esi
+  801b2f:	53                   	push   %ebx
+  801b30:	83 ec 18             	sub    $0x18,%esp
+  801b33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b36:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b39:	50                   	push   %eax
+  801b3a:	ff 75 08             	push   0x8(%ebp)
+  801b3d:	e8 82 fb ff ff       	call   8016c4 <fd_lookup>
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	78 49                	js     801b92 <fstat+0x67>
+  801b49:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+  801b4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b52:	50                   	push   %eax
+  801b53:	ff 36                	push   (%esi)
+  801b55:	e8 ba fb ff ff       	call   801714 <dev_lookup>
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 31                	js     801b92 <fstat+0x67>
+  801b61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b64:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b68:	74 2f                	je     801b99 <fstat+0x6e>
+  801b6a:	c6 03 00             	movb   $0x0,(%ebx)
+  801b6d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b74:	00 00 00 
+  801b77:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b7e:	00 00 00 
+  801b81:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801b87:	83 ec 08             	sub    $0x8,%esp
+  801b8a:	53                   	push   %ebx
+  801b8b:	56                   	push   %esi
+  801b8c:	ff 50 14             	call   *0x14(%eax)
+  801b8f:	83 c4 10             	add    $0x10,%esp
+  801b92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b95:	5b                   	pop    %ebx
+  801b96:	5e                   	pop    %esi
+  801b97:	5d                   	pop    %ebp
+  801b98:	c3                   	ret
+  801b99:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b9e:	eb f2                	jmp    801b92 <fstat+0x67>
+
+00801ba0 <stat>:
+  801ba0:	55                   	push   %ebp
+  801ba1:	89 e5                	mov    %esp,%ebp
+  801ba3:	56                   	push   %esi
+  801ba4:	53                   	push   %ebx
+  801ba5:	83 ec 08             	sub    $0x8,%esp
+  801ba8:	6a 00                	push   $0x0
+  801baa:	ff 75 08             	push   0x8(%ebp)
+  801bad:	e8 31 05 00 00       	call   8020e3 <open>
+  801bb2:	89 c3                	mov    %eax,%ebx
+  801bb4:	83 c4 10             	add    $0x10,%esp
+  801bb7:	85 c0                	test   %eax,%eax
+  801bb9:	78 1b                	js     801bd6 <stat+0x36>
+  801bbb:	83 ec 08             	sub    $0x8,%esp
+  801bbe:	ff 75 0c             	push   0xc(%ebp)
+  801bc1:	50                   	push   %eax
+  801bc2:	e8 64 ff ff ff       	call   801b2b <fstat>
+  801bc7:	89 c6                	mov    %eax,%esi
+  801bc9:	89 1c 24             	mov    %ebx,(%esp)
+  801bcc:	e8 19 fc ff ff       	call   8017ea <close>
+  801bd1:	83 c4 10             	add    $0x10,%esp
+  801bd4:	89 f3                	mov    %esi,%ebx
+  801bd6:	89 d8                	mov    %ebx,%eax
+  801bd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bdb:	5b                   	pop    %ebx
+  801bdc:	5e                   	pop    %esi
+  801bdd:	5d                   	pop    %ebp
+  801bde:	c3                   	ret
+
+00801bdf <fsipc>:
+  801bdf:	55                   	push   %ebp
+  801be0:	89 e5                	mov    %esp,%ebp
+  801be2:	56                   	push   %esi
+  801be3:	53                   	push   %ebx
+  801be4:	89 c3                	mov    %eax,%ebx
+  801be6:	89 d6                	mov    %edx,%esi
+  801be8:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801bef:	74 20                	je     801c11 <fsipc+0x32>
+  801bf1:	83 ec 08             	sub    $0x8,%esp
+  801bf4:	6a 00                	push   $0x0
+  801bf6:	56                   	push   %esi
+  801bf7:	6a 07                	push   $0x7
+  801bf9:	68 00 70 80 00       	push   $0x807000
+  801bfe:	53                   	push   %ebx
+  801bff:	ff 35 08 60 80 00    	push   0x806008
+  801c05:	e8 60 20 00 00       	call   803c6a <ipc_call>
+  801c0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c0d:	5b                   	pop    %ebx
+  801c0e:	5e                   	pop    %esi
+  801c0f:	5d                   	pop    %ebp
+  801c10:	c3                   	ret
+  801c11:	83 ec 0c             	sub    $0xc,%esp
+  801c14:	6a 02                	push   $0x2
+  801c16:	e8 ea 21 00 00       	call   803e05 <ipc_find_env>
+  801c1b:	a3 08 60 80 00       	mov    %eax,0x806008
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	eb cc                	jmp    801bf1 <fsipc+0x12>
+
+00801c25 <devfile_trunc>:
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	83 ec 08             	sub    $0x8,%esp
+  801c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c31:	a3 00 70 80 00       	mov    %eax,0x807000
+  801c36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c39:	a3 04 70 80 00       	mov    %eax,0x807004
+  801c3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c43:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c48:	e8 92 ff ff ff       	call   801bdf <fsipc>
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+00801c4f <devfile_flush>:
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	83 ec 08             	sub    $0x8,%esp
+  801c55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c5b:	a3 00 70 80 00       	mov    %eax,0x807000
+  801c60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c65:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c6a:	e8 70 ff ff ff       	call   801bdf <fsipc>
+  801c6f:	c9                   	leave
+  801c70:	c3                   	ret
+
+00801c71 <devfile_stat>:
+  801c71:	55                   	push   %ebp
+  801c72:	89 e5                	mov    %esp,%ebp
+  801c74:	53                   	push   %ebx
+  801c75:	83 ec 04             	sub    $0x4,%esp
+  801c78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c81:	a3 00 70 80 00       	mov    %eax,0x807000
+  801c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c90:	e8 4a ff ff ff       	call   801bdf <fsipc>
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	78 2c                	js     801cc5 <devfile_stat+0x54>
+  801c99:	83 ec 08             	sub    $0x8,%esp
+  801c9c:	68 00 70 80 00       	push   $0x807000
+  801ca1:	53                   	push   %ebx
+  801ca2:	e8 d8 ec ff ff       	call   80097f <strcpy>
+  801ca7:	a1 80 70 80 00       	mov    0x807080,%eax
+  801cac:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801cb2:	a1 84 70 80 00       	mov    0x807084,%eax
+  801cb7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801cbd:	83 c4 10             	add    $0x10,%esp
+  801cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc8:	c9                   	leave
+  801cc9:	c3                   	ret
+
+00801cca <fsring_rw>:
+  801cca:	55                   	push   %ebp
+  801ccb:	89 e5                	mov    %esp,%ebp
+  801ccd:	57                   	push   %edi
+  801cce:	56                   	push   %esi
+  801ccf:	53                   	push   %ebx
+  801cd0:	83 ec 2c             	sub    $0x2c,%esp
+  801cd3:	89 c7                	mov    %eax,%edi
+  801cd5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cd8:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801cdb:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801ce0:	a8 01                	test   $0x1,%al
+  801ce2:	74 0d                	je     801cf1 <fsring_rw+0x27>
+  801ce4:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801ce9:	a8 01                	test   $0x1,%al
+  801ceb:	0f 85 d5 00 00 00    	jne    801dc6 <fsring_rw+0xfc>
+  801cf1:	a1 14 60 80 00       	mov    0x806014,%eax
+  801cf6:	8b 40 48             	mov    0x48(%eax),%eax
+  801cf9:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  801cff:	0f 84 fc 00 00 00    	je     801e01 <fsring_rw+0x137>
+  801d05:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801d0c:	0f 84 02 01 00 00    	je     801e14 <fsring_rw+0x14a>
+  801d12:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d17:	83 ec 04             	sub    $0x4,%esp
+  801d1a:	68 07 02 00 00       	push   $0x207
+  801d1f:	53                   	push   %ebx
+  801d20:	6a 00                	push   $0x0
+  801d22:	e8 b8 f0 ff ff       	call   800ddf <sys_page_alloc>
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	0f 88 f9 00 00 00    	js     801e2b <fsring_rw+0x161>
+  801d32:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d38:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d3e:	75 d7                	jne    801d17 <fsring_rw+0x4d>
+  801d40:	6a 0e                	push   $0xe
+  801d42:	6a 0d                	push   $0xd
+  801d44:	ff 35 08 60 80 00    	push   0x806008
+  801d4a:	68 00 00 f0 cf       	push   $0xcff00000
+  801d4f:	e8 99 15 00 00       	call   8032ed <ipcring_init>
+  801d54:	83 c4 08             	add    $0x8,%esp
+  801d57:	6a 00                	push   $0x0
+  801d59:	6a 00                	push   $0x0
+  801d5b:	68 07 02 00 00       	push   $0x207
+  801d60:	68 00 00 f0 cf       	push   $0xcff00000
+  801d65:	6a 0b                	push   $0xb
+  801d67:	ff 35 08 60 80 00    	push   0x806008
+  801d6d:	e8 f8 1e 00 00       	call   803c6a <ipc_call>
+  801d72:	89 c6                	mov    %eax,%esi
+  801d74:	83 c4 20             	add    $0x20,%esp
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	0f 88 ac 00 00 00    	js     801e2b <fsring_rw+0x161>
+  801d7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d84:	89 d9                	mov    %ebx,%ecx
+  801d86:	83 c3 01             	add    $0x1,%ebx
+  801d89:	89 da                	mov    %ebx,%edx
+  801d8b:	c1 e2 0c             	shl    $0xc,%edx
+  801d8e:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801d94:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801d9a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801da0:	83 ec 08             	sub    $0x8,%esp
+  801da3:	6a 00                	push   $0x0
+  801da5:	6a 00                	push   $0x0
+  801da7:	68 07 02 00 00       	push   $0x207
+  801dac:	50                   	push   %eax
+  801dad:	6a 0c                	push   $0xc
+  801daf:	ff 35 08 60 80 00    	push   0x806008
+  801db5:	e8 b0 1e 00 00       	call   803c6a <ipc_call>
+  801dba:	83 c4 20             	add    $0x20,%esp
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 6a                	js     801e2b <fsring_rw+0x161>
+  801dc1:	83 fb 08             	cmp    $0x8,%ebx
+  801dc4:	75 be                	jne    801d84 <fsring_rw+0xba>
+  801dc6:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801dca:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801dcf:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801dd4:	0f 45 c2             	cmovne %edx,%eax
+  801dd7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801dda:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801de1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801de8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801def:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df4:	be 00 00 00 00       	mov    $0x0,%esi
+  801df9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801dfc:	e9 4b 01 00 00       	jmp    801f4c <fsring_rw+0x282>
+  801e01:	e8 a3 f3 ff ff       	call   8011a9 <sys_time_msec>
+  801e06:	3b 05 00 60 80 00    	cmp    0x806000,%eax
+  801e0c:	0f 89 f3 fe ff ff    	jns    801d05 <fsring_rw+0x3b>
+  801e12:	eb 54                	jmp    801e68 <fsring_rw+0x19e>
+  801e14:	83 ec 0c             	sub    $0xc,%esp
+  801e17:	6a 02                	push   $0x2
+  801e19:	e8 e7 1f 00 00       	call   803e05 <ipc_find_env>
+  801e1e:	a3 08 60 80 00       	mov    %eax,0x806008
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	e9 e7 fe ff ff       	jmp    801d12 <fsring_rw+0x48>
+  801e2b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e30:	83 ec 08             	sub    $0x8,%esp
+  801e33:	53                   	push   %ebx
+  801e34:	6a 00                	push   $0x0
+  801e36:	e8 76 f0 ff ff       	call   800eb1 <sys_page_unmap>
+  801e3b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e4a:	75 e4                	jne    801e30 <fsring_rw+0x166>
+  801e4c:	e8 58 f3 ff ff       	call   8011a9 <sys_time_msec>
+  801e51:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801e56:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e5b:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e60:	8b 40 48             	mov    0x48(%eax),%eax
+  801e63:	a3 04 60 80 00       	mov    %eax,0x806004
+  801e68:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801e6f:	e9 7a 01 00 00       	jmp    801fee <fsring_rw+0x324>
+  801e74:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e77:	89 10                	mov    %edx,(%eax)
+  801e79:	89 58 04             	mov    %ebx,0x4(%eax)
+  801e7c:	89 f2                	mov    %esi,%edx
+  801e7e:	03 57 04             	add    0x4(%edi),%edx
+  801e81:	89 50 08             	mov    %edx,0x8(%eax)
+  801e84:	83 ec 04             	sub    $0x4,%esp
+  801e87:	53                   	push   %ebx
+  801e88:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801e8b:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801e8e:	52                   	push   %edx
+  801e8f:	83 c0 0c             	add    $0xc,%eax
+  801e92:	50                   	push   %eax
+  801e93:	e8 97 ec ff ff       	call   800b2f <memmove>
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e9e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ea1:	89 08                	mov    %ecx,(%eax)
+  801ea3:	83 ec 0c             	sub    $0xc,%esp
+  801ea6:	68 00 00 f0 cf       	push   $0xcff00000
+  801eab:	e8 9b 14 00 00       	call   80334b <ipcring_req_push>
+  801eb0:	01 de                	add    %ebx,%esi
+  801eb2:	83 c4 10             	add    $0x10,%esp
+  801eb5:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801eb8:	73 4c                	jae    801f06 <fsring_rw+0x23c>
+  801eba:	83 ec 0c             	sub    $0xc,%esp
+  801ebd:	68 00 00 f0 cf       	push   $0xcff00000
+  801ec2:	e8 5e 14 00 00       	call   803325 <ipcring_req_slot>
+  801ec7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	74 35                	je     801f06 <fsring_rw+0x23c>
+  801ed1:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801ed6:	83 e0 07             	and    $0x7,%eax
+  801ed9:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801ede:	c1 e0 0c             	shl    $0xc,%eax
+  801ee1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ee4:	29 f3                	sub    %esi,%ebx
+  801ee6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ee9:	39 cb                	cmp    %ecx,%ebx
+  801eeb:	0f 47 d9             	cmova  %ecx,%ebx
+  801eee:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801ef2:	75 80                	jne    801e74 <fsring_rw+0x1aa>
+  801ef4:	8b 57 0c             	mov    0xc(%edi),%edx
+  801ef7:	89 10                	mov    %edx,(%eax)
+  801ef9:	89 58 04             	mov    %ebx,0x4(%eax)
+  801efc:	89 f2                	mov    %esi,%edx
+  801efe:	03 57 04             	add    0x4(%edi),%edx
+  801f01:	89 50 08             	mov    %edx,0x8(%eax)
+  801f04:	eb 95                	jmp    801e9b <fsring_rw+0x1d1>
+  801f06:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f0b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f0e:	83 ec 0c             	sub    $0xc,%esp
+  801f11:	68 00 00 f0 cf       	push   $0xcff00000
+  801f16:	e8 69 14 00 00       	call   803384 <ipcring_rsp_wait>
+  801f1b:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f1e:	83 c4 10             	add    $0x10,%esp
+  801f21:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f25:	75 45                	jne    801f6c <fsring_rw+0x2a2>
+  801f27:	85 db                	test   %ebx,%ebx
+  801f29:	79 41                	jns    801f6c <fsring_rw+0x2a2>
+  801f2b:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801f2e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801f35:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801f3c:	83 ec 0c             	sub    $0xc,%esp
+  801f3f:	68 00 00 f0 cf       	push   $0xcff00000
+  801f44:	e8 a1 14 00 00       	call   8033ea <ipcring_rsp_pop>
+  801f49:	83 c4 10             	add    $0x10,%esp
+  801f4c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801f52:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f57:	39 c2                	cmp    %eax,%edx
+  801f59:	74 75                	je     801fd0 <fsring_rw+0x306>
+  801f5b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f5f:	75 a5                	jne    801f06 <fsring_rw+0x23c>
+  801f61:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f64:	0f 82 50 ff ff ff    	jb     801eba <fsring_rw+0x1f0>
+  801f6a:	eb 9a                	jmp    801f06 <fsring_rw+0x23c>
+  801f6c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f70:	75 ca                	jne    801f3c <fsring_rw+0x272>
+  801f72:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f76:	74 31                	je     801fa9 <fsring_rw+0x2df>
+  801f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f7e:	29 c8                	sub    %ecx,%eax
+  801f80:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801f83:	39 d0                	cmp    %edx,%eax
+  801f85:	0f 47 c2             	cmova  %edx,%eax
+  801f88:	39 d8                	cmp    %ebx,%eax
+  801f8a:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f8f:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801f93:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801f96:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801f9f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801fa2:	01 d9                	add    %ebx,%ecx
+  801fa4:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801fa7:	eb 93                	jmp    801f3c <fsring_rw+0x272>
+  801fa9:	83 ec 04             	sub    $0x4,%esp
+  801fac:	53                   	push   %ebx
+  801fad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fb0:	83 e0 07             	and    $0x7,%eax
+  801fb3:	c1 e0 0c             	shl    $0xc,%eax
+  801fb6:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801fbc:	50                   	push   %eax
+  801fbd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801fc0:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fc3:	01 c8                	add    %ecx,%eax
+  801fc5:	50                   	push   %eax
+  801fc6:	e8 64 eb ff ff       	call   800b2f <memmove>
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	eb a8                	jmp    801f78 <fsring_rw+0x2ae>
+  801fd0:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801fd4:	75 09                	jne    801fdf <fsring_rw+0x315>
+  801fd6:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801fd9:	0f 82 db fe ff ff    	jb     801eba <fsring_rw+0x1f0>
+  801fdf:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801fe2:	01 57 04             	add    %edx,0x4(%edi)
+  801fe5:	85 d2                	test   %edx,%edx
+  801fe7:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801feb:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801fee:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801ff1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff4:	5b                   	pop    %ebx
+  801ff5:	5e                   	pop    %esi
+  801ff6:	5f                   	pop    %edi
+  801ff7:	5d                   	pop    %ebp
+  801ff8:	c3                   	ret
+
+00801ff9 <devfile_write>:
+  801ff9:	55                   	push   %ebp
+  801ffa:	89 e5                	mov    %esp,%ebp
+  801ffc:	57                   	push   %edi
+  801ffd:	56                   	push   %esi
+  801ffe:	53                   	push   %ebx
+  801fff:	83 ec 0c             	sub    $0xc,%esp
+  802002:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802005:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802008:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80200b:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802011:	76 1a                	jbe    80202d <devfile_write+0x34>
+  802013:	83 ec 0c             	sub    $0xc,%esp
+  802016:	53                   	push   %ebx
+  802017:	89 f1                	mov    %esi,%ecx
+  802019:	ba 06 00 00 00       	mov    $0x6,%edx
+  80201e:	89 f8                	mov    %edi,%eax
+  802020:	e8 a5 fc ff ff       	call   801cca <fsring_rw>
+  802025:	83 c4 10             	add    $0x10,%esp
+  802028:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80202b:	75 39                	jne    802066 <devfile_write+0x6d>
+  80202d:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802032:	39 c3                	cmp    %eax,%ebx
+  802034:	0f 47 d8             	cmova  %eax,%ebx
+  802037:	8b 47 0c             	mov    0xc(%edi),%eax
+  80203a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80203f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802045:	83 ec 04             	sub    $0x4,%esp
+  802048:	53                   	push   %ebx
+  802049:	56                   	push   %esi
+  80204a:	68 08 70 80 00       	push   $0x807008
+  80204f:	e8 db ea ff ff       	call   800b2f <memmove>
+  802054:	ba 00 00 00 00       	mov    $0x0,%edx
+  802059:	b8 04 00 00 00       	mov    $0x4,%eax
+  80205e:	e8 7c fb ff ff       	call   801bdf <fsipc>
+  802063:	83 c4 10             	add    $0x10,%esp
+  802066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802069:	5b                   	pop    %ebx
+  80206a:	5e                   	pop    %esi
+  80206b:	5f                   	pop    %edi
+  80206c:	5d                   	pop    %ebp
+  80206d:	c3                   	ret
+
+0080206e <devfile_read>:
+  80206e:	55                   	push   %ebp
+  80206f:	89 e5                	mov    %esp,%ebp
+  802071:	57                   	push   %edi
+  802072:	56                   	push   %esi
+  802073:	53                   	push   %ebx
+  802074:	83 ec 0c             	sub    $0xc,%esp
+  802077:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80207a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80207d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802083:	76 1d                	jbe    8020a2 <devfile_read+0x34>
+  802085:	83 ec 0c             	sub    $0xc,%esp
+  802088:	56                   	push   %esi
+  802089:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80208c:	ba 05 00 00 00       	mov    $0x5,%edx
+  802091:	89 f8                	mov    %edi,%eax
+  802093:	e8 32 fc ff ff       	call   801cca <fsring_rw>
+  802098:	89 c3                	mov    %eax,%ebx
+  80209a:	83 c4 10             	add    $0x10,%esp
+  80209d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020a0:	75 37                	jne    8020d9 <devfile_read+0x6b>
+  8020a2:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020a5:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020aa:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8020b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020ba:	e8 20 fb ff ff       	call   801bdf <fsipc>
+  8020bf:	89 c3                	mov    %eax,%ebx
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	78 14                	js     8020d9 <devfile_read+0x6b>
+  8020c5:	83 ec 04             	sub    $0x4,%esp
+  8020c8:	50                   	push   %eax
+  8020c9:	68 00 70 80 00       	push   $0x807000
+  8020ce:	ff 75 0c             	push   0xc(%ebp)
+  8020d1:	e8 59 ea ff ff       	call   800b2f <memmove>
+  8020d6:	83 c4 10             	add    $0x10,%esp
+  8020d9:	89 d8                	mov    %ebx,%eax
+  8020db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020de:	5b                   	pop    %ebx
+  8020df:	5e                   	pop    %esi
+  8020e0:	5f                   	pop    %edi
+  8020e1:	5d                   	pop    %ebp
+  8020e2:	c3                   	ret
+
+008020e3 <open>:
+  8020e3:	55                   	push   %ebp
+  8020e4:	89 e5                	mov    %esp,%ebp
+  8020e6:	56                   	push   %esi
+  8020e7:	53                   	push   %ebx
+  8020e8:	83 ec 1c             	sub    $0x1c,%esp
+  8020eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020ee:	56                   	push   %esi
+  8020ef:	e8 3f e8 ff ff       	call   800933 <strlen>
+  8020f4:	83 c4 10             	add    $0x10,%esp
+  8020f7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020fc:	7f 6c                	jg     80216a <open+0x87>
+  8020fe:	83 ec 0c             	sub    $0xc,%esp
+  802101:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802104:	50                   	push   %eax
+  802105:	e8 6a f5 ff ff       	call   801674 <fd_alloc>
+  80210a:	89 c3                	mov    %eax,%ebx
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	85 c0                	test   %eax,%eax
+  802111:	78 3c                	js     80214f <open+0x6c>
+  802113:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802116:	a3 00 74 80 00       	mov    %eax,0x807400
+  80211b:	83 ec 08             	sub    $0x8,%esp
+  80211e:	56                   	push   %esi
+  80211f:	68 00 70 80 00       	push   $0x807000
+  802124:	e8 56 e8 ff ff       	call   80097f <strcpy>
+  802129:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80212c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802131:	e8 a9 fa ff ff       	call   801bdf <fsipc>
+  802136:	89 c3                	mov    %eax,%ebx
+  802138:	83 c4 10             	add    $0x10,%esp
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	78 19                	js     802158 <open+0x75>
+  80213f:	83 ec 0c             	sub    $0xc,%esp
+  802142:	ff 75 f4             	push   -0xc(%ebp)
+  802145:	e8 03 f5 ff ff       	call   80164d <fd2num>
+  80214a:	89 c3                	mov    %eax,%ebx
+  80214c:	83 c4 10             	add    $0x10,%esp
+  80214f:	89 d8                	mov    %ebx,%eax
+  802151:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802154:	5b                   	pop    %ebx
+  802155:	5e                   	pop    %esi
+  802156:	5d                   	pop    %ebp
+  802157:	c3                   	ret
+  802158:	83 ec 08             	sub    $0x8,%esp
+  80215b:	6a 00                	push   $0x0
+  80215d:	ff 75 f4             	push   -0xc(%ebp)
+  802160:	e8 05 f6 ff ff       	call   80176a <fd_close>
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	eb e5                	jmp    80214f <open+0x6c>
+  80216a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80216f:	eb de                	jmp    80214f <open+0x6c>
+
+00802171 <file_image>:
+  802171:	55                   	push   %ebp
+  802172:	89 e5                	mov    %esp,%ebp
+  802174:	53                   	push   %ebx
+  802175:	83 ec 1c             	sub    $0x1c,%esp
+  802178:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80217b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217e:	50                   	push   %eax
+  80217f:	ff 75 08             	push   0x8(%ebp)
+  802182:	e8 3d f5 ff ff       	call   8016c4 <fd_lookup>
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 58                	js     8021e6 <file_image+0x75>
+  80218e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802191:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802197:	39 08                	cmp    %ecx,(%eax)
+  802199:	75 50                	jne    8021eb <file_image+0x7a>
+  80219b:	83 fb 04             	cmp    $0x4,%ebx
+  80219e:	77 52                	ja     8021f2 <file_image+0x81>
+  8021a0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021a3:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021a8:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8021ae:	83 ec 04             	sub    $0x4,%esp
+  8021b1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8021b4:	c1 e0 02             	shl    $0x2,%eax
+  8021b7:	50                   	push   %eax
+  8021b8:	ff 75 0c             	push   0xc(%ebp)
+  8021bb:	68 08 70 80 00       	push   $0x807008
+  8021c0:	e8 6a e9 ff ff       	call   800b2f <memmove>
+  8021c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ca:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8021cf:	e8 0b fa ff ff       	call   801bdf <fsipc>
+  8021d4:	83 c4 10             	add    $0x10,%esp
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 0b                	js     8021e6 <file_image+0x75>
+  8021db:	8b 55 14             	mov    0x14(%ebp),%edx
+  8021de:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  8021e4:	89 0a                	mov    %ecx,(%edx)
+  8021e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+  8021eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021f0:	eb f4                	jmp    8021e6 <file_image+0x75>
+  8021f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f7:	eb ed                	jmp    8021e6 <file_image+0x75>
+
+008021f9 <remove>:
+  8021f9:	55                   	push   %ebp
+  8021fa:	89 e5                	mov    %esp,%ebp
+  8021fc:	53                   	push   %ebx
+  8021fd:	83 ec 10             	sub    $0x10,%esp
+  802200:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802203:	53                   	push   %ebx
+  802204:	e8 2a e7 ff ff       	call   800933 <strlen>
+  802209:	83 c4 10             	add    $0x10,%esp
+  80220c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802211:	7f 25                	jg     802238 <remove+0x3f>
+  802213:	83 ec 08             	sub    $0x8,%esp
+  802216:	53                   	push   %ebx
+  802217:	68 00 70 80 00       	push   $0x807000
+  80221c:	e8 5e e7 ff ff       	call   80097f <strcpy>
+  802221:	ba 00 00 00 00       	mov    $0x0,%edx
+  802226:	b8 09 00 00 00       	mov    $0x9,%eax
+  80222b:	e8 af f9 ff ff       	call   801bdf <fsipc>
+  802230:	83 c4 10             	add    $0x10,%esp
+  802233:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+  802238:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80223d:	eb f4                	jmp    802233 <remove+0x3a>
+
+0080223f <sync>:
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	83 ec 08             	sub    $0x8,%esp
+  802245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80224f:	e8 8b f9 ff ff       	call   801bdf <fsipc>
+  802254:	c9                   	leave
+  802255:	c3                   	ret
+
+00802256 <map_segment>:
+  802256:	55                   	push   %ebp
+  802257:	89 e5                	mov    %esp,%ebp
+  802259:	57                   	push   %edi
+  80225a:	56                   	push   %esi
+  80225b:	53                   	push   %ebx
+  80225c:	83 ec 1c             	sub    $0x1c,%esp
+  80225f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802262:	89 d7                	mov    %edx,%edi
+  802264:	89 d0                	mov    %edx,%eax
+  802266:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80226b:	74 0a                	je     802277 <map_segment+0x21>
+  80226d:	29 c7                	sub    %eax,%edi
+  80226f:	01 c1                	add    %eax,%ecx
+  802271:	01 45 0c             	add    %eax,0xc(%ebp)
+  802274:	29 45 10             	sub    %eax,0x10(%ebp)
+  802277:	85 c9                	test   %ecx,%ecx
+  802279:	0f 84 fb 00 00 00    	je     80237a <map_segment+0x124>
+  80227f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802284:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802287:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80228a:	e9 a6 00 00 00       	jmp    802335 <map_segment+0xdf>
+  80228f:	83 ec 04             	sub    $0x4,%esp
+  802292:	6a 07                	push   $0x7
+  802294:	68 00 00 40 00       	push   $0x400000
+  802299:	6a 00                	push   $0x0
+  80229b:	e8 3f eb ff ff       	call   800ddf <sys_page_alloc>
+  8022a0:	83 c4 10             	add    $0x10,%esp
+  8022a3:	85 c0                	test   %eax,%eax
+  8022a5:	0f 88 c7 00 00 00    	js     802372 <map_segment+0x11c>
+  8022ab:	83 ec 08             	sub    $0x8,%esp
+  8022ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022b1:	03 45 10             	add    0x10(%ebp),%eax
+  8022b4:	50                   	push   %eax
+  8022b5:	ff 75 08             	push   0x8(%ebp)
+  8022b8:	e8 c6 f7 ff ff       	call   801a83 <seek>
+  8022bd:	83 c4 10             	add    $0x10,%esp
+  8022c0:	85 c0                	test   %eax,%eax
+  8022c2:	0f 88 aa 00 00 00    	js     802372 <map_segment+0x11c>
+  8022c8:	83 ec 04             	sub    $0x4,%esp
+  8022cb:	89 f2                	mov    %esi,%edx
+  8022cd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8022d0:	29 ca                	sub    %ecx,%edx
+  8022d2:	89 d0                	mov    %edx,%eax
+  8022d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022d9:	39 d0                	cmp    %edx,%eax
+  8022db:	0f 47 c2             	cmova  %edx,%eax
+  8022de:	50                   	push   %eax
+  8022df:	68 00 00 40 00       	push   $0x400000
+  8022e4:	ff 75 08             	push   0x8(%ebp)
+  8022e7:	e8 c1 f6 ff ff       	call   8019ad <readn>
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 7f                	js     802372 <map_segment+0x11c>
+  8022f3:	83 ec 0c             	sub    $0xc,%esp
+  8022f6:	ff 75 14             	push   0x14(%ebp)
+  8022f9:	57                   	push   %edi
+  8022fa:	ff 75 e0             	push   -0x20(%ebp)
+  8022fd:	68 00 00 40 00       	push   $0x400000
+  802302:	6a 00                	push   $0x0
+  802304:	e8 19 eb ff ff       	call   800e22 <sys_page_map>
+  802309:	83 c4 20             	add    $0x20,%esp
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	78 48                	js     802358 <map_segment+0x102>
+  802310:	83 ec 08             	sub    $0x8,%esp
+  802313:	68 00 00 40 00       	push   $0x400000
+  802318:	6a 00                	push   $0x0
+  80231a:	e8 92 eb ff ff       	call   800eb1 <sys_page_unmap>
+  80231f:	83 c4 10             	add    $0x10,%esp
+  802322:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802328:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80232e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802331:	39 c3                	cmp    %eax,%ebx
+  802333:	73 38                	jae    80236d <map_segment+0x117>
+  802335:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802338:	39 f3                	cmp    %esi,%ebx
+  80233a:	0f 82 4f ff ff ff    	jb     80228f <map_segment+0x39>
+  802340:	83 ec 04             	sub    $0x4,%esp
+  802343:	ff 75 14             	push   0x14(%ebp)
+  802346:	57                   	push   %edi
+  802347:	ff 75 e0             	push   -0x20(%ebp)
+  80234a:	e8 90 ea ff ff       	call   800ddf <sys_page_alloc>
+  80234f:	83 c4 10             	add    $0x10,%esp
+  802352:	85 c0                	test   %eax,%eax
+  802354:	79 cc                	jns    802322 <map_segment+0xcc>
+  802356:	eb 1a                	jmp    802372 <map_segment+0x11c>
+  802358:	50                   	push   %eax
+  802359:	68 c8 45 80 00       	push   $0x8045c8
+  80235e:	68 75 01 00 00       	push   $0x175
+  802363:	68 e5 45 80 00       	push   $0x8045e5
+  802368:	e8 40 de ff ff       	call   8001ad <_panic>
+  80236d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802372:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802375:	5b                   	pop    %ebx
+  802376:	5e                   	pop    %esi
+  802377:	5f                   	pop    %edi
+  802378:	5d                   	pop    %ebp
+  802379:	c3                   	ret
+  80237a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237f:	eb f1                	jmp    802372 <map_segment+0x11c>
+
+00802381 <execv>:
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+  802384:	57                   	push   %edi
+  802385:	56                   	push   %esi
+  802386:	53                   	push   %ebx
+  802387:	81 ec d4 02 00 00    	sub    $0x2d4,%esp
+  80238d:	6a 00                	push   $0x0
+  80238f:	ff 75 08             	push   0x8(%ebp)
+  802392:	e8 4c fd ff ff       	call   8020e3 <open>
+  802397:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	85 c0                	test   %eax,%eax
+  8023a2:	0f 88 ea 05 00 00    	js     802992 <execv+0x611>
+  8023a8:	89 c6                	mov    %eax,%esi
+  8023aa:	83 ec 04             	sub    $0x4,%esp
+  8023ad:	68 00 02 00 00       	push   $0x200
+  8023b2:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8023b8:	50                   	push   %eax
+  8023b9:	56                   	push   %esi
+  8023ba:	e8 ee f5 ff ff       	call   8019ad <readn>
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8023c7:	0f 85 e1 01 00 00    	jne    8025ae <execv+0x22d>
+  8023cd:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8023d4:	45 4c 46 
+  8023d7:	0f 85 d1 01 00 00    	jne    8025ae <execv+0x22d>
+  8023dd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023e2:	cd 30                	int    $0x30
+  8023e4:	89 85 40 fd ff ff    	mov    %eax,-0x2c0(%ebp)
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	0f 88 94 05 00 00    	js     802986 <execv+0x605>
+  8023f2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023f7:	69 f0 ac 01 00 00    	imul   $0x1ac,%eax,%esi
+  8023fd:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802403:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802409:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80240e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802410:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802416:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  80241c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80241f:	8b 00                	mov    (%eax),%eax
+  802421:	85 c0                	test   %eax,%eax
+  802423:	0f 84 ad 05 00 00    	je     8029d6 <execv+0x655>
+  802429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80242e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802433:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802436:	83 ec 0c             	sub    $0xc,%esp
+  802439:	50                   	push   %eax
+  80243a:	e8 f4 e4 ff ff       	call   800933 <strlen>
+  80243f:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  802443:	89 d9                	mov    %ebx,%ecx
+  802445:	83 c3 01             	add    $0x1,%ebx
+  802448:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%ebp)
+  80244e:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  802455:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  802458:	83 c4 10             	add    $0x10,%esp
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	75 d7                	jne    802436 <execv+0xb5>
+  80245f:	89 95 2c fd ff ff    	mov    %edx,-0x2d4(%ebp)
+  802465:	89 8d 30 fd ff ff    	mov    %ecx,-0x2d0(%ebp)
+  80246b:	be 00 10 40 00       	mov    $0x401000,%esi
+  802470:	29 fe                	sub    %edi,%esi
+  802472:	89 f2                	mov    %esi,%edx
+  802474:	83 e2 fc             	and    $0xfffffffc,%edx
+  802477:	8d 04 8d 08 00 00 00 	lea    0x8(,%ecx,4),%eax
+  80247e:	89 d7                	mov    %edx,%edi
+  802480:	29 c7                	sub    %eax,%edi
+  802482:	8d 47 f8             	lea    -0x8(%edi),%eax
+  802485:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80248a:	0f 86 1f 05 00 00    	jbe    8029af <execv+0x62e>
+  802490:	83 ec 04             	sub    $0x4,%esp
+  802493:	6a 07                	push   $0x7
+  802495:	68 00 00 40 00       	push   $0x400000
+  80249a:	6a 00                	push   $0x0
+  80249c:	e8 3e e9 ff ff       	call   800ddf <sys_page_alloc>
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	0f 88 08 05 00 00    	js     8029b4 <execv+0x633>
+  8024ac:	85 db                	test   %ebx,%ebx
+  8024ae:	7e 58                	jle    802508 <execv+0x187>
+  8024b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b5:	89 bd 34 fd ff ff    	mov    %edi,-0x2cc(%ebp)
+  8024bb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024be:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+  8024c4:	8d 86 00 d0 3f ee    	lea    -0x11c03000(%esi),%eax
+  8024ca:	8b 8d 34 fd ff ff    	mov    -0x2cc(%ebp),%ecx
+  8024d0:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+  8024d3:	83 ec 08             	sub    $0x8,%esp
+  8024d6:	ff 34 9f             	push   (%edi,%ebx,4)
+  8024d9:	56                   	push   %esi
+  8024da:	e8 a0 e4 ff ff       	call   80097f <strcpy>
+  8024df:	83 c4 04             	add    $0x4,%esp
+  8024e2:	ff 34 9f             	push   (%edi,%ebx,4)
+  8024e5:	e8 49 e4 ff ff       	call   800933 <strlen>
+  8024ea:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  8024ee:	83 c3 01             	add    $0x1,%ebx
+  8024f1:	83 c4 10             	add    $0x10,%esp
+  8024f4:	8b 8d 3c fd ff ff    	mov    -0x2c4(%ebp),%ecx
+  8024fa:	39 8d 30 fd ff ff    	cmp    %ecx,-0x2d0(%ebp)
+  802500:	75 bc                	jne    8024be <execv+0x13d>
+  802502:	8b bd 34 fd ff ff    	mov    -0x2cc(%ebp),%edi
+  802508:	8b 85 2c fd ff ff    	mov    -0x2d4(%ebp),%eax
+  80250e:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+  802515:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  80251b:	0f 85 c5 00 00 00    	jne    8025e6 <execv+0x265>
+  802521:	8d 87 00 d0 3f ee    	lea    -0x11c03000(%edi),%eax
+  802527:	89 47 fc             	mov    %eax,-0x4(%edi)
+  80252a:	8b 85 38 fd ff ff    	mov    -0x2c8(%ebp),%eax
+  802530:	89 47 f8             	mov    %eax,-0x8(%edi)
+  802533:	8d 87 f8 cf 3f ee    	lea    -0x11c03008(%edi),%eax
+  802539:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  80253f:	83 ec 0c             	sub    $0xc,%esp
+  802542:	6a 07                	push   $0x7
+  802544:	68 00 d0 7f ee       	push   $0xee7fd000
+  802549:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80254f:	68 00 00 40 00       	push   $0x400000
+  802554:	6a 00                	push   $0x0
+  802556:	e8 c7 e8 ff ff       	call   800e22 <sys_page_map>
+  80255b:	89 c3                	mov    %eax,%ebx
+  80255d:	83 c4 20             	add    $0x20,%esp
+  802560:	85 c0                	test   %eax,%eax
+  802562:	0f 88 54 04 00 00    	js     8029bc <execv+0x63b>
+  802568:	83 ec 08             	sub    $0x8,%esp
+  80256b:	68 00 00 40 00       	push   $0x400000
+  802570:	6a 00                	push   $0x0
+  802572:	e8 3a e9 ff ff       	call   800eb1 <sys_page_unmap>
+  802577:	89 c3                	mov    %eax,%ebx
+  802579:	83 c4 10             	add    $0x10,%esp
+  80257c:	85 c0                	test   %eax,%eax
+  80257e:	0f 88 38 04 00 00    	js     8029bc <execv+0x63b>
+  802584:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80258a:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+  802591:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  802598:	00 
+  802599:	0f 84 01 04 00 00    	je     8029a0 <execv+0x61f>
+  80259f:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a9:	e9 88 00 00 00       	jmp    802636 <execv+0x2b5>
+  8025ae:	83 ec 0c             	sub    $0xc,%esp
+  8025b1:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8025b7:	e8 2e f2 ff ff       	call   8017ea <close>
+  8025bc:	83 c4 0c             	add    $0xc,%esp
+  8025bf:	68 7f 45 4c 46       	push   $0x464c457f
+  8025c4:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8025ca:	68 f1 45 80 00       	push   $0x8045f1
+  8025cf:	e8 b4 dc ff ff       	call   800288 <cprintf>
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	c7 85 44 fd ff ff f2 	movl   $0xfffffff2,-0x2bc(%ebp)
+  8025de:	ff ff ff 
+  8025e1:	e9 ac 03 00 00       	jmp    802992 <execv+0x611>
+  8025e6:	68 78 46 80 00       	push   $0x804678
+  8025eb:	68 0b 46 80 00       	push   $0x80460b
+  8025f0:	68 41 01 00 00       	push   $0x141
+  8025f5:	68 e5 45 80 00       	push   $0x8045e5
+  8025fa:	e8 ae db ff ff       	call   8001ad <_panic>
+  8025ff:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  802602:	50                   	push   %eax
+  802603:	ff 73 04             	push   0x4(%ebx)
+  802606:	ff 73 10             	push   0x10(%ebx)
+  802609:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  80260f:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802615:	e8 3c fc ff ff       	call   802256 <map_segment>
+  80261a:	83 c4 10             	add    $0x10,%esp
+  80261d:	85 c0                	test   %eax,%eax
+  80261f:	0f 88 34 03 00 00    	js     802959 <execv+0x5d8>
+  802625:	83 c7 01             	add    $0x1,%edi
+  802628:	83 c3 20             	add    $0x20,%ebx
+  80262b:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802632:	39 f8                	cmp    %edi,%eax
+  802634:	7e 5d                	jle    802693 <execv+0x312>
+  802636:	83 3b 01             	cmpl   $0x1,(%ebx)
+  802639:	75 ea                	jne    802625 <execv+0x2a4>
+  80263b:	8b 43 18             	mov    0x18(%ebx),%eax
+  80263e:	83 e0 02             	and    $0x2,%eax
+  802641:	83 f8 01             	cmp    $0x1,%eax
+  802644:	19 c0                	sbb    %eax,%eax
+  802646:	83 e0 fe             	and    $0xfffffffe,%eax
+  802649:	83 c0 07             	add    $0x7,%eax
+  80264c:	8b 53 08             	mov    0x8(%ebx),%edx
+  80264f:	81 fa ff ff 7f 00    	cmp    $0x7fffff,%edx
+  802655:	76 a8                	jbe    8025ff <execv+0x27e>
+  802657:	83 fe 03             	cmp    $0x3,%esi
+  80265a:	7f a3                	jg     8025ff <execv+0x27e>
+  80265c:	8d 0c b6             	lea    (%esi,%esi,4),%ecx
+  80265f:	c1 e1 02             	shl    $0x2,%ecx
+  802662:	89 94 0d 54 fd ff ff 	mov    %edx,-0x2ac(%ebp,%ecx,1)
+  802669:	8b 53 14             	mov    0x14(%ebx),%edx
+  80266c:	89 94 0d 58 fd ff ff 	mov    %edx,-0x2a8(%ebp,%ecx,1)
+  802673:	8b 53 10             	mov    0x10(%ebx),%edx
+  802676:	89 94 0d 5c fd ff ff 	mov    %edx,-0x2a4(%ebp,%ecx,1)
+  80267d:	8b 53 04             	mov    0x4(%ebx),%edx
+  802680:	89 94 0d 60 fd ff ff 	mov    %edx,-0x2a0(%ebp,%ecx,1)
+  802687:	89 84 0d 64 fd ff ff 	mov    %eax,-0x29c(%ebp,%ecx,1)
+  80268e:	83 c6 01             	add    $0x1,%esi
+  802691:	eb 92                	jmp    802625 <execv+0x2a4>
+  802693:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  80269a:	00 00 00 
+  80269d:	85 f6                	test   %esi,%esi
+  80269f:	7f 12                	jg     8026b3 <execv+0x332>
+  8026a1:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  8026a7:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  8026ae:	00 00 00 
+  8026b1:	eb 7e                	jmp    802731 <execv+0x3b0>
+  8026b3:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  8026b9:	50                   	push   %eax
+  8026ba:	56                   	push   %esi
+  8026bb:	8d 85 54 fd ff ff    	lea    -0x2ac(%ebp),%eax
+  8026c1:	50                   	push   %eax
+  8026c2:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8026c8:	e8 a4 fa ff ff       	call   802171 <file_image>
+  8026cd:	89 85 3c fd ff ff    	mov    %eax,-0x2c4(%ebp)
+  8026d3:	83 c4 10             	add    $0x10,%esp
+  8026d6:	85 c0                	test   %eax,%eax
+  8026d8:	0f 88 9e 00 00 00    	js     80277c <execv+0x3fb>
+  8026de:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  8026e4:	85 c0                	test   %eax,%eax
+  8026e6:	75 49                	jne    802731 <execv+0x3b0>
+  8026e8:	8d 9d 54 fd ff ff    	lea    -0x2ac(%ebp),%ebx
+  8026ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026f3:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  8026f6:	8b 13                	mov    (%ebx),%edx
+  8026f8:	ff 73 10             	push   0x10(%ebx)
+  8026fb:	ff 73 0c             	push   0xc(%ebx)
+  8026fe:	ff 73 08             	push   0x8(%ebx)
+  802701:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802707:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  80270d:	e8 44 fb ff ff       	call   802256 <map_segment>
+  802712:	83 c4 10             	add    $0x10,%esp
+  802715:	85 c0                	test   %eax,%eax
+  802717:	0f 88 65 02 00 00    	js     802982 <execv+0x601>
+  80271d:	83 c7 01             	add    $0x1,%edi
+  802720:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802726:	83 c3 14             	add    $0x14,%ebx
+  802729:	39 fe                	cmp    %edi,%esi
+  80272b:	7e 04                	jle    802731 <execv+0x3b0>
+  80272d:	85 c0                	test   %eax,%eax
+  80272f:	74 c2                	je     8026f3 <execv+0x372>
+  802731:	83 ec 04             	sub    $0x4,%esp
+  802734:	ff b5 3c fd ff ff    	push   -0x2c4(%ebp)
+  80273a:	50                   	push   %eax
+  80273b:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802741:	e8 82 ee ff ff       	call   8015c8 <sys_env_set_pager>
+  802746:	89 c7                	mov    %eax,%edi
+  802748:	83 c4 10             	add    $0x10,%esp
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	0f 88 08 02 00 00    	js     80295b <execv+0x5da>
+  802753:	83 ec 0c             	sub    $0xc,%esp
+  802756:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  80275c:	e8 89 f0 ff ff       	call   8017ea <close>
+  802761:	e8 54 10 00 00       	call   8037ba <dupq_begin>
+  802766:	89 c7                	mov    %eax,%edi
+  802768:	83 c4 10             	add    $0x10,%esp
+  80276b:	89 c1                	mov    %eax,%ecx
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	0f 88 91 00 00 00    	js     802806 <execv+0x485>
+  802775:	be 02 00 00 00       	mov    $0x2,%esi
+  80277a:	eb 33                	jmp    8027af <execv+0x42e>
+  80277c:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802783:	00 00 00 
+  802786:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  80278d:	00 00 00 
+  802790:	e9 53 ff ff ff       	jmp    8026e8 <execv+0x367>
+  802795:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80279c:	a8 01                	test   $0x1,%al
+  80279e:	75 7b                	jne    80281b <execv+0x49a>
+  8027a0:	83 c6 01             	add    $0x1,%esi
+  8027a3:	81 fe ba 03 00 00    	cmp    $0x3ba,%esi
+  8027a9:	0f 84 e5 00 00 00    	je     802894 <execv+0x513>
+  8027af:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027b6:	a8 01                	test   $0x1,%al
+  8027b8:	74 db                	je     802795 <execv+0x414>
+  8027ba:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027c1:	a8 80                	test   $0x80,%al
+  8027c3:	74 d0                	je     802795 <execv+0x414>
+  8027c5:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027cc:	f6 c4 04             	test   $0x4,%ah
+  8027cf:	74 cf                	je     8027a0 <execv+0x41f>
+  8027d1:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027d8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8027dd:	0c 80                	or     $0x80,%al
+  8027df:	50                   	push   %eax
+  8027e0:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8027e6:	89 f0                	mov    %esi,%eax
+  8027e8:	c1 e0 16             	shl    $0x16,%eax
+  8027eb:	c1 e8 0c             	shr    $0xc,%eax
+  8027ee:	50                   	push   %eax
+  8027ef:	6a 00                	push   $0x0
+  8027f1:	e8 e4 0f 00 00       	call   8037da <dupq_map>
+  8027f6:	89 c1                	mov    %eax,%ecx
+  8027f8:	83 c4 10             	add    $0x10,%esp
+  8027fb:	85 c0                	test   %eax,%eax
+  8027fd:	79 a1                	jns    8027a0 <execv+0x41f>
+  8027ff:	89 c7                	mov    %eax,%edi
+  802801:	e8 37 10 00 00       	call   80383d <dupq_end>
+  802806:	57                   	push   %edi
+  802807:	68 20 46 80 00       	push   $0x804620
+  80280c:	68 ac 00 00 00       	push   $0xac
+  802811:	68 e5 45 80 00       	push   $0x8045e5
+  802816:	e8 92 d9 ff ff       	call   8001ad <_panic>
+  80281b:	89 f7                	mov    %esi,%edi
+  80281d:	c1 e7 16             	shl    $0x16,%edi
+  802820:	89 f8                	mov    %edi,%eax
+  802822:	c1 e8 0c             	shr    $0xc,%eax
+  802825:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80282a:	eb 24                	jmp    802850 <execv+0x4cf>
+  80282c:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802832:	0f 84 68 ff ff ff    	je     8027a0 <execv+0x41f>
+  802838:	89 d8                	mov    %ebx,%eax
+  80283a:	09 f8                	or     %edi,%eax
+  80283c:	c1 e8 0c             	shr    $0xc,%eax
+  80283f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802845:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  80284a:	0f 84 50 ff ff ff    	je     8027a0 <execv+0x41f>
+  802850:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802857:	f6 c2 01             	test   $0x1,%dl
+  80285a:	74 d0                	je     80282c <execv+0x4ab>
+  80285c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802863:	f6 c6 04             	test   $0x4,%dh
+  802866:	74 c4                	je     80282c <execv+0x4ab>
+  802868:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80286f:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802875:	52                   	push   %edx
+  802876:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80287c:	50                   	push   %eax
+  80287d:	6a 00                	push   $0x0
+  80287f:	e8 56 0f 00 00       	call   8037da <dupq_map>
+  802884:	89 c1                	mov    %eax,%ecx
+  802886:	83 c4 10             	add    $0x10,%esp
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	79 9f                	jns    80282c <execv+0x4ab>
+  80288d:	89 c7                	mov    %eax,%edi
+  80288f:	e9 6d ff ff ff       	jmp    802801 <execv+0x480>
+  802894:	89 cf                	mov    %ecx,%edi
+  802896:	85 c9                	test   %ecx,%ecx
+  802898:	0f 88 63 ff ff ff    	js     802801 <execv+0x480>
+  80289e:	e8 9a 0f 00 00       	call   80383d <dupq_end>
+  8028a3:	89 c7                	mov    %eax,%edi
+  8028a5:	85 c0                	test   %eax,%eax
+  8028a7:	0f 88 59 ff ff ff    	js     802806 <execv+0x485>
+  8028ad:	83 ec 08             	sub    $0x8,%esp
+  8028b0:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8028b6:	50                   	push   %eax
+  8028b7:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8028bd:	e8 92 e6 ff ff       	call   800f54 <sys_env_set_trapframe>
+  8028c2:	83 c4 10             	add    $0x10,%esp
+  8028c5:	85 c0                	test   %eax,%eax
+  8028c7:	78 2e                	js     8028f7 <execv+0x576>
+  8028c9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028cd:	74 52                	je     802921 <execv+0x5a0>
+  8028cf:	83 ec 08             	sub    $0x8,%esp
+  8028d2:	6a 02                	push   $0x2
+  8028d4:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8028da:	e8 33 e6 ff ff       	call   800f12 <sys_env_set_status>
+  8028df:	83 c4 10             	add    $0x10,%esp
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	78 26                	js     80290c <execv+0x58b>
+  8028e6:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  8028ec:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  8028f2:	e9 9b 00 00 00       	jmp    802992 <execv+0x611>
+  8028f7:	50                   	push   %eax
+  8028f8:	68 36 46 80 00       	push   $0x804636
+  8028fd:	68 af 00 00 00       	push   $0xaf
+  802902:	68 e5 45 80 00       	push   $0x8045e5
+  802907:	e8 a1 d8 ff ff       	call   8001ad <_panic>
+  80290c:	50                   	push   %eax
+  80290d:	68 50 46 80 00       	push   $0x804650
+  802912:	68 b3 00 00 00       	push   $0xb3
+  802917:	68 e5 45 80 00       	push   $0x8045e5
+  80291c:	e8 8c d8 ff ff       	call   8001ad <_panic>
+  802921:	83 ec 0c             	sub    $0xc,%esp
+  802924:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80292a:	e8 c3 e8 ff ff       	call   8011f2 <sys_env_swap>
+  80292f:	83 c4 10             	add    $0x10,%esp
+  802932:	85 c0                	test   %eax,%eax
+  802934:	78 0e                	js     802944 <execv+0x5c3>
+  802936:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  80293c:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802942:	eb 4e                	jmp    802992 <execv+0x611>
+  802944:	50                   	push   %eax
+  802945:	68 67 46 80 00       	push   $0x804667
+  80294a:	68 ba 00 00 00       	push   $0xba
+  80294f:	68 e5 45 80 00       	push   $0x8045e5
+  802954:	e8 54 d8 ff ff       	call   8001ad <_panic>
+  802959:	89 c7                	mov    %eax,%edi
+  80295b:	83 ec 0c             	sub    $0xc,%esp
+  80295e:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802964:	e8 cb e3 ff ff       	call   800d34 <sys_env_destroy>
+  802969:	83 c4 04             	add    $0x4,%esp
+  80296c:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802972:	e8 73 ee ff ff       	call   8017ea <close>
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	89 bd 44 fd ff ff    	mov    %edi,-0x2bc(%ebp)
+  802980:	eb 10                	jmp    802992 <execv+0x611>
+  802982:	89 c7                	mov    %eax,%edi
+  802984:	eb d5                	jmp    80295b <execv+0x5da>
+  802986:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  80298c:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802992:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  802998:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80299b:	5b                   	pop    %ebx
+  80299c:	5e                   	pop    %esi
+  80299d:	5f                   	pop    %edi
+  80299e:	5d                   	pop    %ebp
+  80299f:	c3                   	ret
+  8029a0:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  8029a7:	00 00 00 
+  8029aa:	e9 f2 fc ff ff       	jmp    8026a1 <execv+0x320>
+  8029af:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8029b4:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  8029ba:	eb d6                	jmp    802992 <execv+0x611>
+  8029bc:	83 ec 08             	sub    $0x8,%esp
+  8029bf:	68 00 00 40 00       	push   $0x400000
+  8029c4:	6a 00                	push   $0x0
+  8029c6:	e8 e6 e4 ff ff       	call   800eb1 <sys_page_unmap>
+  8029cb:	83 c4 10             	add    $0x10,%esp
+  8029ce:	89 9d 44 fd ff ff    	mov    %ebx,-0x2bc(%ebp)
+  8029d4:	eb bc                	jmp    802992 <execv+0x611>
+  8029d6:	83 ec 04             	sub    $0x4,%esp
+  8029d9:	6a 07                	push   $0x7
+  8029db:	68 00 00 40 00       	push   $0x400000
+  8029e0:	6a 00                	push   $0x0
+  8029e2:	e8 f8 e3 ff ff       	call   800ddf <sys_page_alloc>
+  8029e7:	83 c4 10             	add    $0x10,%esp
+  8029ea:	85 c0                	test   %eax,%eax
+  8029ec:	78 c6                	js     8029b4 <execv+0x633>
+  8029ee:	c7 85 2c fd ff ff 00 	movl   $0x0,-0x2d4(%ebp)
+  8029f5:	00 00 00 
+  8029f8:	c7 85 38 fd ff ff 00 	movl   $0x0,-0x2c8(%ebp)
+  8029ff:	00 00 00 
+  802a02:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+  802a07:	be 00 10 40 00       	mov    $0x401000,%esi
+  802a0c:	e9 f7 fa ff ff       	jmp    802508 <execv+0x187>
+
+00802a11 <spawn>:
+  802a11:	55                   	push   %ebp
+  802a12:	89 e5                	mov    %esp,%ebp
+  802a14:	83 ec 0c             	sub    $0xc,%esp
+  802a17:	6a 01                	push   $0x1
+  802a19:	ff 75 0c             	push   0xc(%ebp)
+  802a1c:	ff 75 08             	push   0x8(%ebp)
+  802a1f:	e8 5d f9 ff ff       	call   802381 <execv>
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+00802a26 <exec>:
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	83 ec 0c             	sub    $0xc,%esp
+  802a2c:	6a 00                	push   $0x0
+  802a2e:	ff 75 0c             	push   0xc(%ebp)
+  802a31:	ff 75 08             	push   0x8(%ebp)
+  802a34:	e8 48 f9 ff ff       	call   802381 <execv>
+  802a39:	c9                   	leave
+  802a3a:	c3                   	ret
+
+00802a3b <spawnl>:
+  802a3b:	55                   	push   %ebp
+  802a3c:	89 e5                	mov    %esp,%ebp
+  802a3e:	56                   	push   %esi
+  802a3f:	53                   	push   %ebx
+  802a40:	8d 45 10             	lea    0x10(%ebp),%eax
+  802a43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a48:	eb 05                	jmp    802a4f <spawnl+0x14>
+  802a4a:	83 c1 01             	add    $0x1,%ecx
+  802a4d:	89 d0                	mov    %edx,%eax
+  802a4f:	8d 50 04             	lea    0x4(%eax),%edx
+  802a52:	83 38 00             	cmpl   $0x0,(%eax)
+  802a55:	75 f3                	jne    802a4a <spawnl+0xf>
+  802a57:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802a5e:	83 e0 f0             	and    $0xfffffff0,%eax
+  802a61:	29 c4                	sub    %eax,%esp
+  802a63:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802a67:	89 d8                	mov    %ebx,%eax
+  802a69:	c1 e8 02             	shr    $0x2,%eax
+  802a6c:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802a6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a72:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802a79:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802a80:	00 
+  802a81:	8d 55 10             	lea    0x10(%ebp),%edx
+  802a84:	89 ce                	mov    %ecx,%esi
+  802a86:	85 c9                	test   %ecx,%ecx
+  802a88:	74 16                	je     802aa0 <spawnl+0x65>
+  802a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8f:	83 c0 01             	add    $0x1,%eax
+  802a92:	89 d1                	mov    %edx,%ecx
+  802a94:	83 c2 04             	add    $0x4,%edx
+  802a97:	8b 09                	mov    (%ecx),%ecx
+  802a99:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802a9c:	39 f0                	cmp    %esi,%eax
+  802a9e:	75 ef                	jne    802a8f <spawnl+0x54>
+  802aa0:	83 ec 08             	sub    $0x8,%esp
+  802aa3:	53                   	push   %ebx
+  802aa4:	ff 75 08             	push   0x8(%ebp)
+  802aa7:	e8 65 ff ff ff       	call   802a11 <spawn>
+  802aac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aaf:	5b                   	pop    %ebx
+  802ab0:	5e                   	pop    %esi
+  802ab1:	5d                   	pop    %ebp
+  802ab2:	c3                   	ret
+
+00802ab3 <execl>:
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	56                   	push   %esi
+  802ab7:	53                   	push   %ebx
+  802ab8:	8d 45 10             	lea    0x10(%ebp),%eax
+  802abb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ac0:	eb 05                	jmp    802ac7 <execl+0x14>
+  802ac2:	83 c1 01             	add    $0x1,%ecx
+  802ac5:	89 d0                	mov    %edx,%eax
+  802ac7:	8d 50 04             	lea    0x4(%eax),%edx
+  802aca:	83 38 00             	cmpl   $0x0,(%eax)
+  802acd:	75 f3                	jne    802ac2 <execl+0xf>
+  802acf:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802ad6:	83 e0 f0             	and    $0xfffffff0,%eax
+  802ad9:	29 c4                	sub    %eax,%esp
+  802adb:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802adf:	89 d8                	mov    %ebx,%eax
+  802ae1:	c1 e8 02             	shr    $0x2,%eax
+  802ae4:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802ae7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aea:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802af1:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802af8:	00 
+  802af9:	8d 55 10             	lea    0x10(%ebp),%edx
+  802afc:	89 ce                	mov    %ecx,%esi
+  802afe:	85 c9                	test   %ecx,%ecx
+  802b00:	74 16                	je     802b18 <execl+0x65>
+  802b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b07:	83 c0 01             	add    $0x1,%eax
+  802b0a:	89 d1                	mov    %edx,%ecx
+  802b0c:	83 c2 04             	add    $0x4,%edx
+  802b0f:	8b 09                	mov    (%ecx),%ecx
+  802b11:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802b14:	39 f0                	cmp    %esi,%eax
+  802b16:	75 ef                	jne    802b07 <execl+0x54>
+  802b18:	83 ec 08             	sub    $0x8,%esp
+  802b1b:	53                   	push   %ebx
+  802b1c:	ff 75 08             	push   0x8(%ebp)
+  802b1f:	e8 02 ff ff ff       	call   802a26 <exec>
+  802b24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b27:	5b                   	pop    %ebx
+  802b28:	5e                   	pop    %esi
+  802b29:	5d                   	pop    %ebp
+  802b2a:	c3                   	ret
+
+00802b2b <devsock_stat>:
+  802b2b:	55                   	push   %ebp
+  802b2c:	89 e5                	mov    %esp,%ebp
+  802b2e:	83 ec 10             	sub    $0x10,%esp
+  802b31:	68 9e 46 80 00       	push   $0x80469e
+  802b36:	ff 75 0c             	push   0xc(%ebp)
+  802b39:	e8 41 de ff ff       	call   80097f <strcpy>
+  802b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b43:	c9                   	leave
+  802b44:	c3                   	ret
+
+00802b45 <devsock_close>:
+  802b45:	55                   	push   %ebp
+  802b46:	89 e5                	mov    %esp,%ebp
+  802b48:	53                   	push   %ebx
+  802b49:	83 ec 10             	sub    $0x10,%esp
+  802b4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b4f:	53                   	push   %ebx
+  802b50:	e8 ca 12 00 00       	call   803e1f <pageref>
+  802b55:	89 c2                	mov    %eax,%edx
+  802b57:	83 c4 10             	add    $0x10,%esp
+  802b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5f:	83 fa 01             	cmp    $0x1,%edx
+  802b62:	74 05                	je     802b69 <devsock_close+0x24>
+  802b64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b67:	c9                   	leave
+  802b68:	c3                   	ret
+  802b69:	83 ec 0c             	sub    $0xc,%esp
+  802b6c:	ff 73 0c             	push   0xc(%ebx)
+  802b6f:	e8 aa 02 00 00       	call   802e1e <nsipc_close>
+  802b74:	83 c4 10             	add    $0x10,%esp
+  802b77:	eb eb                	jmp    802b64 <devsock_close+0x1f>
+
+00802b79 <devsock_write>:
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	83 ec 08             	sub    $0x8,%esp
+  802b7f:	6a 00                	push   $0x0
+  802b81:	ff 75 10             	push   0x10(%ebp)
+  802b84:	ff 75 0c             	push   0xc(%ebp)
+  802b87:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8a:	ff 70 0c             	push   0xc(%eax)
+  802b8d:	e8 6c 03 00 00       	call   802efe <nsipc_send>
+  802b92:	c9                   	leave
+  802b93:	c3                   	ret
+
+00802b94 <devsock_read>:
+  802b94:	55                   	push   %ebp
+  802b95:	89 e5                	mov    %esp,%ebp
+  802b97:	83 ec 08             	sub    $0x8,%esp
+  802b9a:	6a 00                	push   $0x0
+  802b9c:	ff 75 10             	push   0x10(%ebp)
+  802b9f:	ff 75 0c             	push   0xc(%ebp)
+  802ba2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba5:	ff 70 0c             	push   0xc(%eax)
+  802ba8:	e8 e2 02 00 00       	call   802e8f <nsipc_recv>
+  802bad:	c9                   	leave
+  802bae:	c3                   	ret
+
+00802baf <fd2sockid>:
+  802baf:	55                   	push   %ebp
+  802bb0:	89 e5                	mov    %esp,%ebp
+  802bb2:	83 ec 20             	sub    $0x20,%esp
+  802bb5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bb8:	52                   	push   %edx
+  802bb9:	50                   	push   %eax
+  802bba:	e8 05 eb ff ff       	call   8016c4 <fd_lookup>
+  802bbf:	83 c4 10             	add    $0x10,%esp
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	78 10                	js     802bd6 <fd2sockid+0x27>
+  802bc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc9:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802bcf:	39 08                	cmp    %ecx,(%eax)
+  802bd1:	75 05                	jne    802bd8 <fd2sockid+0x29>
+  802bd3:	8b 40 0c             	mov    0xc(%eax),%eax
+  802bd6:	c9                   	leave
+  802bd7:	c3                   	ret
+  802bd8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bdd:	eb f7                	jmp    802bd6 <fd2sockid+0x27>
+
+00802bdf <alloc_sockfd>:
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	56                   	push   %esi
+  802be3:	53                   	push   %ebx
+  802be4:	83 ec 1c             	sub    $0x1c,%esp
+  802be7:	89 c6                	mov    %eax,%esi
+  802be9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bec:	50                   	push   %eax
+  802bed:	e8 82 ea ff ff       	call   801674 <fd_alloc>
+  802bf2:	89 c3                	mov    %eax,%ebx
+  802bf4:	83 c4 10             	add    $0x10,%esp
+  802bf7:	85 c0                	test   %eax,%eax
+  802bf9:	78 43                	js     802c3e <alloc_sockfd+0x5f>
+  802bfb:	83 ec 04             	sub    $0x4,%esp
+  802bfe:	68 07 04 00 00       	push   $0x407
+  802c03:	ff 75 f4             	push   -0xc(%ebp)
+  802c06:	6a 00                	push   $0x0
+  802c08:	e8 d2 e1 ff ff       	call   800ddf <sys_page_alloc>
+  802c0d:	89 c3                	mov    %eax,%ebx
+  802c0f:	83 c4 10             	add    $0x10,%esp
+  802c12:	85 c0                	test   %eax,%eax
+  802c14:	78 28                	js     802c3e <alloc_sockfd+0x5f>
+  802c16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c19:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802c1f:	89 10                	mov    %edx,(%eax)
+  802c21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c24:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c2b:	89 70 0c             	mov    %esi,0xc(%eax)
+  802c2e:	83 ec 0c             	sub    $0xc,%esp
+  802c31:	50                   	push   %eax
+  802c32:	e8 16 ea ff ff       	call   80164d <fd2num>
+  802c37:	89 c3                	mov    %eax,%ebx
+  802c39:	83 c4 10             	add    $0x10,%esp
+  802c3c:	eb 0c                	jmp    802c4a <alloc_sockfd+0x6b>
+  802c3e:	83 ec 0c             	sub    $0xc,%esp
+  802c41:	56                   	push   %esi
+  802c42:	e8 d7 01 00 00       	call   802e1e <nsipc_close>
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	89 d8                	mov    %ebx,%eax
+  802c4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c4f:	5b                   	pop    %ebx
+  802c50:	5e                   	pop    %esi
+  802c51:	5d                   	pop    %ebp
+  802c52:	c3                   	ret
+
+00802c53 <accept>:
+  802c53:	55                   	push   %ebp
+  802c54:	89 e5                	mov    %esp,%ebp
+  802c56:	83 ec 08             	sub    $0x8,%esp
+  802c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c5c:	e8 4e ff ff ff       	call   802baf <fd2sockid>
+  802c61:	85 c0                	test   %eax,%eax
+  802c63:	78 1b                	js     802c80 <accept+0x2d>
+  802c65:	83 ec 04             	sub    $0x4,%esp
+  802c68:	ff 75 10             	push   0x10(%ebp)
+  802c6b:	ff 75 0c             	push   0xc(%ebp)
+  802c6e:	50                   	push   %eax
+  802c6f:	e8 07 01 00 00       	call   802d7b <nsipc_accept>
+  802c74:	83 c4 10             	add    $0x10,%esp
+  802c77:	85 c0                	test   %eax,%eax
+  802c79:	78 05                	js     802c80 <accept+0x2d>
+  802c7b:	e8 5f ff ff ff       	call   802bdf <alloc_sockfd>
+  802c80:	c9                   	leave
+  802c81:	c3                   	ret
+
+00802c82 <bind>:
+  802c82:	55                   	push   %ebp
+  802c83:	89 e5                	mov    %esp,%ebp
+  802c85:	83 ec 08             	sub    $0x8,%esp
+  802c88:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c8b:	e8 1f ff ff ff       	call   802baf <fd2sockid>
+  802c90:	85 c0                	test   %eax,%eax
+  802c92:	78 12                	js     802ca6 <bind+0x24>
+  802c94:	83 ec 04             	sub    $0x4,%esp
+  802c97:	ff 75 10             	push   0x10(%ebp)
+  802c9a:	ff 75 0c             	push   0xc(%ebp)
+  802c9d:	50                   	push   %eax
+  802c9e:	e8 24 01 00 00       	call   802dc7 <nsipc_bind>
+  802ca3:	83 c4 10             	add    $0x10,%esp
+  802ca6:	c9                   	leave
+  802ca7:	c3                   	ret
+
+00802ca8 <shutdown>:
+  802ca8:	55                   	push   %ebp
+  802ca9:	89 e5                	mov    %esp,%ebp
+  802cab:	83 ec 08             	sub    $0x8,%esp
+  802cae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb1:	e8 f9 fe ff ff       	call   802baf <fd2sockid>
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	78 0f                	js     802cc9 <shutdown+0x21>
+  802cba:	83 ec 08             	sub    $0x8,%esp
+  802cbd:	ff 75 0c             	push   0xc(%ebp)
+  802cc0:	50                   	push   %eax
+  802cc1:	e8 36 01 00 00       	call   802dfc <nsipc_shutdown>
+  802cc6:	83 c4 10             	add    $0x10,%esp
+  802cc9:	c9                   	leave
+  802cca:	c3                   	ret
+
+00802ccb <connect>:
+  802ccb:	55                   	push   %ebp
+  802ccc:	89 e5                	mov    %esp,%ebp
+  802cce:	83 ec 08             	sub    $0x8,%esp
+  802cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd4:	e8 d6 fe ff ff       	call   802baf <fd2sockid>
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	78 12                	js     802cef <connect+0x24>
+  802cdd:	83 ec 04             	sub    $0x4,%esp
+  802ce0:	ff 75 10             	push   0x10(%ebp)
+  802ce3:	ff 75 0c             	push   0xc(%ebp)
+  802ce6:	50                   	push   %eax
+  802ce7:	e8 4c 01 00 00       	call   802e38 <nsipc_connect>
+  802cec:	83 c4 10             	add    $0x10,%esp
+  802cef:	c9                   	leave
+  802cf0:	c3                   	ret
+
+00802cf1 <listen>:
+  802cf1:	55                   	push   %ebp
+  802cf2:	89 e5                	mov    %esp,%ebp
+  802cf4:	83 ec 08             	sub    $0x8,%esp
+  802cf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfa:	e8 b0 fe ff ff       	call   802baf <fd2sockid>
+  802cff:	85 c0                	test   %eax,%eax
+  802d01:	78 0f                	js     802d12 <listen+0x21>
+  802d03:	83 ec 08             	sub    $0x8,%esp
+  802d06:	ff 75 0c             	push   0xc(%ebp)
+  802d09:	50                   	push   %eax
+  802d0a:	e8 5e 01 00 00       	call   802e6d <nsipc_listen>
+  802d0f:	83 c4 10             	add    $0x10,%esp
+  802d12:	c9                   	leave
+  802d13:	c3                   	ret
+
+00802d14 <socket>:
+  802d14:	55                   	push   %ebp
+  802d15:	89 e5                	mov    %esp,%ebp
+  802d17:	83 ec 0c             	sub    $0xc,%esp
+  802d1a:	ff 75 10             	push   0x10(%ebp)
+  802d1d:	ff 75 0c             	push   0xc(%ebp)
+  802d20:	ff 75 08             	push   0x8(%ebp)
+  802d23:	e8 34 02 00 00       	call   802f5c <nsipc_socket>
+  802d28:	83 c4 10             	add    $0x10,%esp
+  802d2b:	85 c0                	test   %eax,%eax
+  802d2d:	78 05                	js     802d34 <socket+0x20>
+  802d2f:	e8 ab fe ff ff       	call   802bdf <alloc_sockfd>
+  802d34:	c9                   	leave
+  802d35:	c3                   	ret
+
+00802d36 <nsipc>:
+  802d36:	55                   	push   %ebp
+  802d37:	89 e5                	mov    %esp,%ebp
+  802d39:	53                   	push   %ebx
+  802d3a:	83 ec 04             	sub    $0x4,%esp
+  802d3d:	89 c3                	mov    %eax,%ebx
+  802d3f:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802d46:	74 1f                	je     802d67 <nsipc+0x31>
+  802d48:	83 ec 08             	sub    $0x8,%esp
+  802d4b:	6a 00                	push   $0x0
+  802d4d:	6a 00                	push   $0x0
+  802d4f:	6a 07                	push   $0x7
+  802d51:	68 00 80 80 00       	push   $0x808000
+  802d56:	53                   	push   %ebx
+  802d57:	ff 35 0c 60 80 00    	push   0x80600c
+  802d5d:	e8 08 0f 00 00       	call   803c6a <ipc_call>
+  802d62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d65:	c9                   	leave
+  802d66:	c3                   	ret
+  802d67:	83 ec 0c             	sub    $0xc,%esp
+  802d6a:	6a 03                	push   $0x3
+  802d6c:	e8 94 10 00 00       	call   803e05 <ipc_find_env>
+  802d71:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802d76:	83 c4 10             	add    $0x10,%esp
+  802d79:	eb cd                	jmp    802d48 <nsipc+0x12>
+
+00802d7b <nsipc_accept>:
+  802d7b:	55                   	push   %ebp
+  802d7c:	89 e5                	mov    %esp,%ebp
+  802d7e:	53                   	push   %ebx
+  802d7f:	83 ec 04             	sub    $0x4,%esp
+  802d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d85:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d8f:	e8 a2 ff ff ff       	call   802d36 <nsipc>
+  802d94:	89 c3                	mov    %eax,%ebx
+  802d96:	85 c0                	test   %eax,%eax
+  802d98:	79 07                	jns    802da1 <nsipc_accept+0x26>
+  802d9a:	89 d8                	mov    %ebx,%eax
+  802d9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d9f:	c9                   	leave
+  802da0:	c3                   	ret
+  802da1:	83 ec 04             	sub    $0x4,%esp
+  802da4:	ff 35 10 80 80 00    	push   0x808010
+  802daa:	68 00 80 80 00       	push   $0x808000
+  802daf:	ff 75 0c             	push   0xc(%ebp)
+  802db2:	e8 78 dd ff ff       	call   800b2f <memmove>
+  802db7:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802dbd:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dc0:	89 10                	mov    %edx,(%eax)
+  802dc2:	83 c4 10             	add    $0x10,%esp
+  802dc5:	eb d3                	jmp    802d9a <nsipc_accept+0x1f>
+
+00802dc7 <nsipc_bind>:
+  802dc7:	55                   	push   %ebp
+  802dc8:	89 e5                	mov    %esp,%ebp
+  802dca:	53                   	push   %ebx
+  802dcb:	83 ec 08             	sub    $0x8,%esp
+  802dce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd4:	a3 00 80 80 00       	mov    %eax,0x808000
+  802dd9:	53                   	push   %ebx
+  802dda:	ff 75 0c             	push   0xc(%ebp)
+  802ddd:	68 04 80 80 00       	push   $0x808004
+  802de2:	e8 48 dd ff ff       	call   800b2f <memmove>
+  802de7:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802ded:	b8 02 00 00 00       	mov    $0x2,%eax
+  802df2:	e8 3f ff ff ff       	call   802d36 <nsipc>
+  802df7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dfa:	c9                   	leave
+  802dfb:	c3                   	ret
+
+00802dfc <nsipc_shutdown>:
+  802dfc:	55                   	push   %ebp
+  802dfd:	89 e5                	mov    %esp,%ebp
+  802dff:	83 ec 08             	sub    $0x8,%esp
+  802e02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e05:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e0d:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e12:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e17:	e8 1a ff ff ff       	call   802d36 <nsipc>
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+
+00802e1e <nsipc_close>:
+  802e1e:	55                   	push   %ebp
+  802e1f:	89 e5                	mov    %esp,%ebp
+  802e21:	83 ec 08             	sub    $0x8,%esp
+  802e24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e27:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e2c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e31:	e8 00 ff ff ff       	call   802d36 <nsipc>
+  802e36:	c9                   	leave
+  802e37:	c3                   	ret
+
+00802e38 <nsipc_connect>:
+  802e38:	55                   	push   %ebp
+  802e39:	89 e5                	mov    %esp,%ebp
+  802e3b:	53                   	push   %ebx
+  802e3c:	83 ec 08             	sub    $0x8,%esp
+  802e3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e42:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e45:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e4a:	53                   	push   %ebx
+  802e4b:	ff 75 0c             	push   0xc(%ebp)
+  802e4e:	68 04 80 80 00       	push   $0x808004
+  802e53:	e8 d7 dc ff ff       	call   800b2f <memmove>
+  802e58:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802e5e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e63:	e8 ce fe ff ff       	call   802d36 <nsipc>
+  802e68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e6b:	c9                   	leave
+  802e6c:	c3                   	ret
+
+00802e6d <nsipc_listen>:
+  802e6d:	55                   	push   %ebp
+  802e6e:	89 e5                	mov    %esp,%ebp
+  802e70:	83 ec 08             	sub    $0x8,%esp
+  802e73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e76:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e7e:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e83:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e88:	e8 a9 fe ff ff       	call   802d36 <nsipc>
+  802e8d:	c9                   	leave
+  802e8e:	c3                   	ret
+
+00802e8f <nsipc_recv>:
+  802e8f:	55                   	push   %ebp
+  802e90:	89 e5                	mov    %esp,%ebp
+  802e92:	56                   	push   %esi
+  802e93:	53                   	push   %ebx
+  802e94:	8b 75 10             	mov    0x10(%ebp),%esi
+  802e97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9a:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e9f:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802ea5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea8:	a3 08 80 80 00       	mov    %eax,0x808008
+  802ead:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eb2:	e8 7f fe ff ff       	call   802d36 <nsipc>
+  802eb7:	89 c3                	mov    %eax,%ebx
+  802eb9:	85 c0                	test   %eax,%eax
+  802ebb:	78 22                	js     802edf <nsipc_recv+0x50>
+  802ebd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ec2:	39 c6                	cmp    %eax,%esi
+  802ec4:	0f 4e c6             	cmovle %esi,%eax
+  802ec7:	39 c3                	cmp    %eax,%ebx
+  802ec9:	7f 1d                	jg     802ee8 <nsipc_recv+0x59>
+  802ecb:	83 ec 04             	sub    $0x4,%esp
+  802ece:	53                   	push   %ebx
+  802ecf:	68 00 80 80 00       	push   $0x808000
+  802ed4:	ff 75 0c             	push   0xc(%ebp)
+  802ed7:	e8 53 dc ff ff       	call   800b2f <memmove>
+  802edc:	83 c4 10             	add    $0x10,%esp
+  802edf:	89 d8                	mov    %ebx,%eax
+  802ee1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ee4:	5b                   	pop    %ebx
+  802ee5:	5e                   	pop    %esi
+  802ee6:	5d                   	pop    %ebp
+  802ee7:	c3                   	ret
+  802ee8:	68 aa 46 80 00       	push   $0x8046aa
+  802eed:	68 0b 46 80 00       	push   $0x80460b
+  802ef2:	6a 60                	push   $0x60
+  802ef4:	68 bf 46 80 00       	push   $0x8046bf
+  802ef9:	e8 af d2 ff ff       	call   8001ad <_panic>
+
+00802efe <nsipc_send>:
+  802efe:	55                   	push   %ebp
+  802eff:	89 e5                	mov    %esp,%ebp
+  802f01:	53                   	push   %ebx
+  802f02:	83 ec 04             	sub    $0x4,%esp
+  802f05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0b:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f10:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f16:	7f 2e                	jg     802f46 <nsipc_send+0x48>
+  802f18:	83 ec 04             	sub    $0x4,%esp
+  802f1b:	53                   	push   %ebx
+  802f1c:	ff 75 0c             	push   0xc(%ebp)
+  802f1f:	68 0c 80 80 00       	push   $0x80800c
+  802f24:	e8 06 dc ff ff       	call   800b2f <memmove>
+  802f29:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802f2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f32:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f37:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f3c:	e8 f5 fd ff ff       	call   802d36 <nsipc>
+  802f41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f44:	c9                   	leave
+  802f45:	c3                   	ret
+  802f46:	68 cb 46 80 00       	push   $0x8046cb
+  802f4b:	68 0b 46 80 00       	push   $0x80460b
+  802f50:	6a 6b                	push   $0x6b
+  802f52:	68 bf 46 80 00       	push   $0x8046bf
+  802f57:	e8 51 d2 ff ff       	call   8001ad <_panic>
+
+00802f5c <nsipc_socket>:
+  802f5c:	55                   	push   %ebp
+  802f5d:	89 e5                	mov    %esp,%ebp
+  802f5f:	83 ec 08             	sub    $0x8,%esp
+  802f62:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f65:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f6d:	a3 04 80 80 00       	mov    %eax,0x808004
+  802f72:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f75:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f7a:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f7f:	e8 b2 fd ff ff       	call   802d36 <nsipc>
+  802f84:	c9                   	leave
+  802f85:	c3                   	ret
+
+00802f86 <devpipe_stat>:
+  802f86:	55                   	push   %ebp
+  802f87:	89 e5                	mov    %esp,%ebp
+  802f89:	56                   	push   %esi
+  802f8a:	53                   	push   %ebx
+  802f8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802f8e:	83 ec 0c             	sub    $0xc,%esp
+  802f91:	ff 75 08             	push   0x8(%ebp)
+  802f94:	e8 c4 e6 ff ff       	call   80165d <fd2data>
+  802f99:	89 c6                	mov    %eax,%esi
+  802f9b:	83 c4 08             	add    $0x8,%esp
+  802f9e:	68 d7 46 80 00       	push   $0x8046d7
+  802fa3:	53                   	push   %ebx
+  802fa4:	e8 d6 d9 ff ff       	call   80097f <strcpy>
+  802fa9:	8b 46 04             	mov    0x4(%esi),%eax
+  802fac:	2b 06                	sub    (%esi),%eax
+  802fae:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802fb4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fbb:	00 00 00 
+  802fbe:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802fc5:	50 80 00 
+  802fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fd0:	5b                   	pop    %ebx
+  802fd1:	5e                   	pop    %esi
+  802fd2:	5d                   	pop    %ebp
+  802fd3:	c3                   	ret
+
+00802fd4 <devpipe_close>:
+  802fd4:	55                   	push   %ebp
+  802fd5:	89 e5                	mov    %esp,%ebp
+  802fd7:	53                   	push   %ebx
+  802fd8:	83 ec 0c             	sub    $0xc,%esp
+  802fdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fde:	53                   	push   %ebx
+  802fdf:	6a 00                	push   $0x0
+  802fe1:	e8 cb de ff ff       	call   800eb1 <sys_page_unmap>
+  802fe6:	89 1c 24             	mov    %ebx,(%esp)
+  802fe9:	e8 6f e6 ff ff       	call   80165d <fd2data>
+  802fee:	83 c4 08             	add    $0x8,%esp
+  802ff1:	50                   	push   %eax
+  802ff2:	6a 00                	push   $0x0
+  802ff4:	e8 b8 de ff ff       	call   800eb1 <sys_page_unmap>
+  802ff9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ffc:	c9                   	leave
+  802ffd:	c3                   	ret
+
+00802ffe <_pipeisclosed>:
+  802ffe:	55                   	push   %ebp
+  802fff:	89 e5                	mov    %esp,%ebp
+  803001:	57                   	push   %edi
+  803002:	56                   	push   %esi
+  803003:	53                   	push   %ebx
+  803004:	83 ec 1c             	sub    $0x1c,%esp
+  803007:	89 c7                	mov    %eax,%edi
+  803009:	89 d6                	mov    %edx,%esi
+  80300b:	a1 14 60 80 00       	mov    0x806014,%eax
+  803010:	8b 58 58             	mov    0x58(%eax),%ebx
+  803013:	83 ec 0c             	sub    $0xc,%esp
+  803016:	57                   	push   %edi
+  803017:	e8 03 0e 00 00       	call   803e1f <pageref>
+  80301c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80301f:	89 34 24             	mov    %esi,(%esp)
+  803022:	e8 f8 0d 00 00       	call   803e1f <pageref>
+  803027:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  80302d:	8b 4a 58             	mov    0x58(%edx),%ecx
+  803030:	83 c4 10             	add    $0x10,%esp
+  803033:	39 cb                	cmp    %ecx,%ebx
+  803035:	74 1b                	je     803052 <_pipeisclosed+0x54>
+  803037:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80303a:	75 cf                	jne    80300b <_pipeisclosed+0xd>
+  80303c:	8b 42 58             	mov    0x58(%edx),%eax
+  80303f:	6a 01                	push   $0x1
+  803041:	50                   	push   %eax
+  803042:	53                   	push   %ebx
+  803043:	68 de 46 80 00       	push   $0x8046de
+  803048:	e8 3b d2 ff ff       	call   800288 <cprintf>
+  80304d:	83 c4 10             	add    $0x10,%esp
+  803050:	eb b9                	jmp    80300b <_pipeisclosed+0xd>
+  803052:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803055:	0f 94 c0             	sete   %al
+  803058:	0f b6 c0             	movzbl %al,%eax
+  80305b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80305e:	5b                   	pop    %ebx
+  80305f:	5e                   	pop    %esi
+  803060:	5f                   	pop    %edi
+  803061:	5d                   	pop    %ebp
+  803062:	c3                   	ret
+
+00803063 <devpipe_write>:
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	57                   	push   %edi
+  803067:	56                   	push   %esi
+  803068:	53                   	push   %ebx
+  803069:	83 ec 28             	sub    $0x28,%esp
+  80306c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80306f:	56                   	push   %esi
+  803070:	e8 e8 e5 ff ff       	call   80165d <fd2data>
+  803075:	89 c3                	mov    %eax,%ebx
+  803077:	83 c4 10             	add    $0x10,%esp
+  80307a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803083:	74 5c                	je     8030e1 <devpipe_write+0x7e>
+  803085:	8b 43 04             	mov    0x4(%ebx),%eax
+  803088:	8b 0b                	mov    (%ebx),%ecx
+  80308a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80308d:	39 d0                	cmp    %edx,%eax
+  80308f:	72 1e                	jb     8030af <devpipe_write+0x4c>
+  803091:	89 da                	mov    %ebx,%edx
+  803093:	89 f0                	mov    %esi,%eax
+  803095:	e8 64 ff ff ff       	call   802ffe <_pipeisclosed>
+  80309a:	85 c0                	test   %eax,%eax
+  80309c:	75 48                	jne    8030e6 <devpipe_write+0x83>
+  80309e:	e8 f1 dc ff ff       	call   800d94 <sys_yield>
+  8030a3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030a6:	8b 0b                	mov    (%ebx),%ecx
+  8030a8:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030ab:	39 d0                	cmp    %edx,%eax
+  8030ad:	73 e2                	jae    803091 <devpipe_write+0x2e>
+  8030af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030b2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030b6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030b9:	89 c2                	mov    %eax,%edx
+  8030bb:	c1 fa 1f             	sar    $0x1f,%edx
+  8030be:	89 d1                	mov    %edx,%ecx
+  8030c0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030c3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030c6:	83 e2 1f             	and    $0x1f,%edx
+  8030c9:	29 ca                	sub    %ecx,%edx
+  8030cb:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8030d3:	83 c0 01             	add    $0x1,%eax
+  8030d6:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030d9:	83 c7 01             	add    $0x1,%edi
+  8030dc:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8030df:	75 a4                	jne    803085 <devpipe_write+0x22>
+  8030e1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030e4:	eb 05                	jmp    8030eb <devpipe_write+0x88>
+  8030e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030ee:	5b                   	pop    %ebx
+  8030ef:	5e                   	pop    %esi
+  8030f0:	5f                   	pop    %edi
+  8030f1:	5d                   	pop    %ebp
+  8030f2:	c3                   	ret
+
+008030f3 <devpipe_read>:
+  8030f3:	55                   	push   %ebp
+  8030f4:	89 e5                	mov    %esp,%ebp
+  8030f6:	57                   	push   %edi
+  8030f7:	56                   	push   %esi
+  8030f8:	53                   	push   %ebx
+  8030f9:	83 ec 18             	sub    $0x18,%esp
+  8030fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030ff:	56                   	push   %esi
+  803100:	e8 58 e5 ff ff       	call   80165d <fd2data>
+  803105:	89 c3                	mov    %eax,%ebx
+  803107:	83 c4 10             	add    $0x10,%esp
+  80310a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803113:	74 45                	je     80315a <devpipe_read+0x67>
+  803115:	8b 03                	mov    (%ebx),%eax
+  803117:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80311a:	75 1d                	jne    803139 <devpipe_read+0x46>
+  80311c:	85 ff                	test   %edi,%edi
+  80311e:	75 3f                	jne    80315f <devpipe_read+0x6c>
+  803120:	89 da                	mov    %ebx,%edx
+  803122:	89 f0                	mov    %esi,%eax
+  803124:	e8 d5 fe ff ff       	call   802ffe <_pipeisclosed>
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	75 3c                	jne    803169 <devpipe_read+0x76>
+  80312d:	e8 62 dc ff ff       	call   800d94 <sys_yield>
+  803132:	8b 03                	mov    (%ebx),%eax
+  803134:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803137:	74 e7                	je     803120 <devpipe_read+0x2d>
+  803139:	99                   	cltd
+  80313a:	c1 ea 1b             	shr    $0x1b,%edx
+  80313d:	01 d0                	add    %edx,%eax
+  80313f:	83 e0 1f             	and    $0x1f,%eax
+  803142:	29 d0                	sub    %edx,%eax
+  803144:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803149:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80314c:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80314f:	83 03 01             	addl   $0x1,(%ebx)
+  803152:	83 c7 01             	add    $0x1,%edi
+  803155:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803158:	75 bb                	jne    803115 <devpipe_read+0x22>
+  80315a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80315d:	eb 02                	jmp    803161 <devpipe_read+0x6e>
+  80315f:	89 f8                	mov    %edi,%eax
+  803161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803164:	5b                   	pop    %ebx
+  803165:	5e                   	pop    %esi
+  803166:	5f                   	pop    %edi
+  803167:	5d                   	pop    %ebp
+  803168:	c3                   	ret
+  803169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316e:	eb f1                	jmp    803161 <devpipe_read+0x6e>
+
+00803170 <pipe>:
+  803170:	55                   	push   %ebp
+  803171:	89 e5                	mov    %esp,%ebp
+  803173:	56                   	push   %esi
+  803174:	53                   	push   %ebx
+  803175:	83 ec 1c             	sub    $0x1c,%esp
+  803178:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80317b:	50                   	push   %eax
+  80317c:	e8 f3 e4 ff ff       	call   801674 <fd_alloc>
+  803181:	89 c3                	mov    %eax,%ebx
+  803183:	83 c4 10             	add    $0x10,%esp
+  803186:	85 c0                	test   %eax,%eax
+  803188:	0f 88 23 01 00 00    	js     8032b1 <pipe+0x141>
+  80318e:	83 ec 04             	sub    $0x4,%esp
+  803191:	68 07 04 00 00       	push   $0x407
+  803196:	ff 75 f4             	push   -0xc(%ebp)
+  803199:	6a 00                	push   $0x0
+  80319b:	e8 3f dc ff ff       	call   800ddf <sys_page_alloc>
+  8031a0:	89 c3                	mov    %eax,%ebx
+  8031a2:	83 c4 10             	add    $0x10,%esp
+  8031a5:	85 c0                	test   %eax,%eax
+  8031a7:	0f 88 04 01 00 00    	js     8032b1 <pipe+0x141>
+  8031ad:	83 ec 0c             	sub    $0xc,%esp
+  8031b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031b3:	50                   	push   %eax
+  8031b4:	e8 bb e4 ff ff       	call   801674 <fd_alloc>
+  8031b9:	89 c3                	mov    %eax,%ebx
+  8031bb:	83 c4 10             	add    $0x10,%esp
+  8031be:	85 c0                	test   %eax,%eax
+  8031c0:	0f 88 db 00 00 00    	js     8032a1 <pipe+0x131>
+  8031c6:	83 ec 04             	sub    $0x4,%esp
+  8031c9:	68 07 04 00 00       	push   $0x407
+  8031ce:	ff 75 f0             	push   -0x10(%ebp)
+  8031d1:	6a 00                	push   $0x0
+  8031d3:	e8 07 dc ff ff       	call   800ddf <sys_page_alloc>
+  8031d8:	89 c3                	mov    %eax,%ebx
+  8031da:	83 c4 10             	add    $0x10,%esp
+  8031dd:	85 c0                	test   %eax,%eax
+  8031df:	0f 88 bc 00 00 00    	js     8032a1 <pipe+0x131>
+  8031e5:	83 ec 0c             	sub    $0xc,%esp
+  8031e8:	ff 75 f4             	push   -0xc(%ebp)
+  8031eb:	e8 6d e4 ff ff       	call   80165d <fd2data>
+  8031f0:	89 c6                	mov    %eax,%esi
+  8031f2:	83 c4 0c             	add    $0xc,%esp
+  8031f5:	68 07 04 00 00       	push   $0x407
+  8031fa:	50                   	push   %eax
+  8031fb:	6a 00                	push   $0x0
+  8031fd:	e8 dd db ff ff       	call   800ddf <sys_page_alloc>
+  803202:	89 c3                	mov    %eax,%ebx
+  803204:	83 c4 10             	add    $0x10,%esp
+  803207:	85 c0                	test   %eax,%eax
+  803209:	0f 88 82 00 00 00    	js     803291 <pipe+0x121>
+  80320f:	83 ec 0c             	sub    $0xc,%esp
+  803212:	ff 75 f0             	push   -0x10(%ebp)
+  803215:	e8 43 e4 ff ff       	call   80165d <fd2data>
+  80321a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803221:	50                   	push   %eax
+  803222:	6a 00                	push   $0x0
+  803224:	56                   	push   %esi
+  803225:	6a 00                	push   $0x0
+  803227:	e8 f6 db ff ff       	call   800e22 <sys_page_map>
+  80322c:	89 c3                	mov    %eax,%ebx
+  80322e:	83 c4 20             	add    $0x20,%esp
+  803231:	85 c0                	test   %eax,%eax
+  803233:	78 4e                	js     803283 <pipe+0x113>
+  803235:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  80323a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80323d:	89 02                	mov    %eax,(%edx)
+  80323f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803242:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803249:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80324c:	89 02                	mov    %eax,(%edx)
+  80324e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803251:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803258:	83 ec 0c             	sub    $0xc,%esp
+  80325b:	ff 75 f4             	push   -0xc(%ebp)
+  80325e:	e8 ea e3 ff ff       	call   80164d <fd2num>
+  803263:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803266:	89 01                	mov    %eax,(%ecx)
+  803268:	83 c4 04             	add    $0x4,%esp
+  80326b:	ff 75 f0             	push   -0x10(%ebp)
+  80326e:	e8 da e3 ff ff       	call   80164d <fd2num>
+  803273:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803276:	89 41 04             	mov    %eax,0x4(%ecx)
+  803279:	83 c4 10             	add    $0x10,%esp
+  80327c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803281:	eb 2e                	jmp    8032b1 <pipe+0x141>
+  803283:	83 ec 08             	sub    $0x8,%esp
+  803286:	56                   	push   %esi
+  803287:	6a 00                	push   $0x0
+  803289:	e8 23 dc ff ff       	call   800eb1 <sys_page_unmap>
+  80328e:	83 c4 10             	add    $0x10,%esp
+  803291:	83 ec 08             	sub    $0x8,%esp
+  803294:	ff 75 f0             	push   -0x10(%ebp)
+  803297:	6a 00                	push   $0x0
+  803299:	e8 13 dc ff ff       	call   800eb1 <sys_page_unmap>
+  80329e:	83 c4 10             	add    $0x10,%esp
+  8032a1:	83 ec 08             	sub    $0x8,%esp
+  8032a4:	ff 75 f4             	push   -0xc(%ebp)
+  8032a7:	6a 00                	push   $0x0
+  8032a9:	e8 03 dc ff ff       	call   800eb1 <sys_page_unmap>
+  8032ae:	83 c4 10             	add    $0x10,%esp
+  8032b1:	89 d8                	mov    %ebx,%eax
+  8032b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b6:	5b                   	pop    %ebx
+  8032b7:	5e                   	pop    %esi
+  8032b8:	5d                   	pop    %ebp
+  8032b9:	c3                   	ret
+
+008032ba <pipeisclosed>:
+  8032ba:	55                   	push   %ebp
+  8032bb:	89 e5                	mov    %esp,%ebp
+  8032bd:	83 ec 20             	sub    $0x20,%esp
+  8032c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032c3:	50                   	push   %eax
+  8032c4:	ff 75 08             	push   0x8(%ebp)
+  8032c7:	e8 f8 e3 ff ff       	call   8016c4 <fd_lookup>
+  8032cc:	83 c4 10             	add    $0x10,%esp
+  8032cf:	85 c0                	test   %eax,%eax
+  8032d1:	78 18                	js     8032eb <pipeisclosed+0x31>
+  8032d3:	83 ec 0c             	sub    $0xc,%esp
+  8032d6:	ff 75 f4             	push   -0xc(%ebp)
+  8032d9:	e8 7f e3 ff ff       	call   80165d <fd2data>
+  8032de:	89 c2                	mov    %eax,%edx
+  8032e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e3:	e8 16 fd ff ff       	call   802ffe <_pipeisclosed>
+  8032e8:	83 c4 10             	add    $0x10,%esp
+  8032eb:	c9                   	leave
+  8032ec:	c3                   	ret
+
+008032ed <ipcring_init>:
+  8032ed:	55                   	push   %ebp
+  8032ee:	89 e5                	mov    %esp,%ebp
+  8032f0:	53                   	push   %ebx
+  8032f1:	83 ec 08             	sub    $0x8,%esp
+  8032f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8032f7:	6a 60                	push   $0x60
+  8032f9:	6a 00                	push   $0x0
+  8032fb:	53                   	push   %ebx
+  8032fc:	e8 f9 d7 ff ff       	call   800afa <memset>
+  803301:	a1 14 60 80 00       	mov    0x806014,%eax
+  803306:	8b 40 48             	mov    0x48(%eax),%eax
+  803309:	89 03                	mov    %eax,(%ebx)
+  80330b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80330e:	89 43 04             	mov    %eax,0x4(%ebx)
+  803311:	8b 45 10             	mov    0x10(%ebp),%eax
+  803314:	89 43 08             	mov    %eax,0x8(%ebx)
+  803317:	8b 45 14             	mov    0x14(%ebp),%eax
+  80331a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80331d:	83 c4 10             	add    $0x10,%esp
+  803320:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803323:	c9                   	leave
+  803324:	c3                   	ret
+
+00803325 <ipcring_req_slot>:
+  803325:	55                   	push   %ebp
+  803326:	89 e5                	mov    %esp,%ebp
+  803328:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332b:	8b 50 10             	mov    0x10(%eax),%edx
+  80332e:	8b 48 18             	mov    0x18(%eax),%ecx
+  803331:	29 ca                	sub    %ecx,%edx
+  803333:	83 fa 07             	cmp    $0x7,%edx
+  803336:	77 0c                	ja     803344 <ipcring_req_slot+0x1f>
+  803338:	8b 50 10             	mov    0x10(%eax),%edx
+  80333b:	83 e2 07             	and    $0x7,%edx
+  80333e:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803342:	5d                   	pop    %ebp
+  803343:	c3                   	ret
+  803344:	b8 00 00 00 00       	mov    $0x0,%eax
+  803349:	eb f7                	jmp    803342 <ipcring_req_slot+0x1d>
+
+0080334b <ipcring_req_push>:
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	83 ec 08             	sub    $0x8,%esp
+  803351:	8b 55 08             	mov    0x8(%ebp),%edx
+  803354:	8b 42 10             	mov    0x10(%edx),%eax
+  803357:	83 c0 01             	add    $0x1,%eax
+  80335a:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80335e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803363:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803367:	85 c0                	test   %eax,%eax
+  803369:	75 02                	jne    80336d <ipcring_req_push+0x22>
+  80336b:	c9                   	leave
+  80336c:	c3                   	ret
+  80336d:	6a 00                	push   $0x0
+  80336f:	68 00 00 80 ee       	push   $0xee800000
+  803374:	ff 72 08             	push   0x8(%edx)
+  803377:	ff 72 04             	push   0x4(%edx)
+  80337a:	e8 98 dd ff ff       	call   801117 <sys_ipc_send>
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	eb e7                	jmp    80336b <ipcring_req_push+0x20>
+
+00803384 <ipcring_rsp_wait>:
+  803384:	55                   	push   %ebp
+  803385:	89 e5                	mov    %esp,%ebp
+  803387:	53                   	push   %ebx
+  803388:	83 ec 04             	sub    $0x4,%esp
+  80338b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80338e:	8b 53 18             	mov    0x18(%ebx),%edx
+  803391:	8b 43 10             	mov    0x10(%ebx),%eax
+  803394:	39 c2                	cmp    %eax,%edx
+  803396:	74 3c                	je     8033d4 <ipcring_rsp_wait+0x50>
+  803398:	8b 53 14             	mov    0x14(%ebx),%edx
+  80339b:	8b 43 18             	mov    0x18(%ebx),%eax
+  80339e:	39 c2                	cmp    %eax,%edx
+  8033a0:	75 23                	jne    8033c5 <ipcring_rsp_wait+0x41>
+  8033a2:	83 ec 08             	sub    $0x8,%esp
+  8033a5:	6a 00                	push   $0x0
+  8033a7:	6a 00                	push   $0x0
+  8033a9:	6a 00                	push   $0x0
+  8033ab:	6a 00                	push   $0x0
+  8033ad:	ff 73 0c             	push   0xc(%ebx)
+  8033b0:	ff 73 04             	push   0x4(%ebx)
+  8033b3:	e8 b2 08 00 00       	call   803c6a <ipc_call>
+  8033b8:	8b 53 14             	mov    0x14(%ebx),%edx
+  8033bb:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033be:	83 c4 20             	add    $0x20,%esp
+  8033c1:	39 c2                	cmp    %eax,%edx
+  8033c3:	74 dd                	je     8033a2 <ipcring_rsp_wait+0x1e>
+  8033c5:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033c8:	83 e0 07             	and    $0x7,%eax
+  8033cb:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8033cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033d2:	c9                   	leave
+  8033d3:	c3                   	ret
+  8033d4:	68 f8 46 80 00       	push   $0x8046f8
+  8033d9:	68 0b 46 80 00       	push   $0x80460b
+  8033de:	6a 3b                	push   $0x3b
+  8033e0:	68 19 47 80 00       	push   $0x804719
+  8033e5:	e8 c3 cd ff ff       	call   8001ad <_panic>
+
+008033ea <ipcring_rsp_pop>:
+  8033ea:	55                   	push   %ebp
+  8033eb:	89 e5                	mov    %esp,%ebp
+  8033ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033f0:	8b 42 18             	mov    0x18(%edx),%eax
+  8033f3:	83 c0 01             	add    $0x1,%eax
+  8033f6:	89 42 18             	mov    %eax,0x18(%edx)
+  8033f9:	5d                   	pop    %ebp
+  8033fa:	c3                   	ret
+
+008033fb <ipcring_server_init>:
+  8033fb:	55                   	push   %ebp
+  8033fc:	89 e5                	mov    %esp,%ebp
+  8033fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803401:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803404:	89 10                	mov    %edx,(%eax)
+  803406:	8b 55 10             	mov    0x10(%ebp),%edx
+  803409:	89 50 04             	mov    %edx,0x4(%eax)
+  80340c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803413:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80341a:	5d                   	pop    %ebp
+  80341b:	c3                   	ret
+
+0080341c <ipcring_req_avail>:
+  80341c:	55                   	push   %ebp
+  80341d:	89 e5                	mov    %esp,%ebp
+  80341f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803422:	8b 02                	mov    (%edx),%eax
+  803424:	8b 40 10             	mov    0x10(%eax),%eax
+  803427:	2b 42 08             	sub    0x8(%edx),%eax
+  80342a:	ba 08 00 00 00       	mov    $0x8,%edx
+  80342f:	39 d0                	cmp    %edx,%eax
+  803431:	0f 47 c2             	cmova  %edx,%eax
+  803434:	5d                   	pop    %ebp
+  803435:	c3                   	ret
+
+00803436 <ipcring_req_peek>:
+  803436:	55                   	push   %ebp
+  803437:	89 e5                	mov    %esp,%ebp
+  803439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80343c:	8b 42 08             	mov    0x8(%edx),%eax
+  80343f:	83 e0 07             	and    $0x7,%eax
+  803442:	8b 12                	mov    (%edx),%edx
+  803444:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803448:	5d                   	pop    %ebp
+  803449:	c3                   	ret
+
+0080344a <ipcring_rsp_push>:
+  80344a:	55                   	push   %ebp
+  80344b:	89 e5                	mov    %esp,%ebp
+  80344d:	83 ec 08             	sub    $0x8,%esp
+  803450:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803453:	8b 41 08             	mov    0x8(%ecx),%eax
+  803456:	83 c0 01             	add    $0x1,%eax
+  803459:	89 41 08             	mov    %eax,0x8(%ecx)
+  80345c:	8b 11                	mov    (%ecx),%edx
+  80345e:	83 c2 14             	add    $0x14,%edx
+  803461:	f0 87 02             	lock xchg %eax,(%edx)
+  803464:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803468:	75 02                	jne    80346c <ipcring_rsp_push+0x22>
+  80346a:	c9                   	leave
+  80346b:	c3                   	ret
+  80346c:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803473:	6a 00                	push   $0x0
+  803475:	68 00 00 80 ee       	push   $0xee800000
+  80347a:	6a 00                	push   $0x0
+  80347c:	ff 71 04             	push   0x4(%ecx)
+  80347f:	e8 b6 db ff ff       	call   80103a <sys_ipc_try_send>
+  803484:	83 c4 10             	add    $0x10,%esp
+  803487:	eb e1                	jmp    80346a <ipcring_rsp_push+0x20>
+
+00803489 <ipcring_client_wait>:
+  803489:	55                   	push   %ebp
+  80348a:	89 e5                	mov    %esp,%ebp
+  80348c:	83 ec 08             	sub    $0x8,%esp
+  80348f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803492:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803499:	8b 10                	mov    (%eax),%edx
+  80349b:	8b 52 18             	mov    0x18(%edx),%edx
+  80349e:	3b 50 08             	cmp    0x8(%eax),%edx
+  8034a1:	75 02                	jne    8034a5 <ipcring_client_wait+0x1c>
+  8034a3:	c9                   	leave
+  8034a4:	c3                   	ret
+  8034a5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	68 00 00 80 ee       	push   $0xee800000
+  8034b3:	6a 00                	push   $0x0
+  8034b5:	ff 70 04             	push   0x4(%eax)
+  8034b8:	e8 7d db ff ff       	call   80103a <sys_ipc_try_send>
+  8034bd:	83 c4 10             	add    $0x10,%esp
+  8034c0:	eb e1                	jmp    8034a3 <ipcring_client_wait+0x1a>
+
+008034c2 <ipcring_server_sleep>:
+  8034c2:	55                   	push   %ebp
+  8034c3:	89 e5                	mov    %esp,%ebp
+  8034c5:	53                   	push   %ebx
+  8034c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034c9:	8b 01                	mov    (%ecx),%eax
+  8034cb:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8034ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034d3:	f0 87 02             	lock xchg %eax,(%edx)
+  8034d6:	8b 11                	mov    (%ecx),%edx
+  8034d8:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8034db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034e0:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8034e3:	74 0e                	je     8034f3 <ipcring_server_sleep+0x31>
+  8034e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ea:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8034ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034f6:	c9                   	leave
+  8034f7:	c3                   	ret
+
+008034f8 <devcons_close>:
+  8034f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fd:	c3                   	ret
+
+008034fe <devcons_stat>:
+  8034fe:	55                   	push   %ebp
+  8034ff:	89 e5                	mov    %esp,%ebp
+  803501:	83 ec 10             	sub    $0x10,%esp
+  803504:	68 27 47 80 00       	push   $0x804727
+  803509:	ff 75 0c             	push   0xc(%ebp)
+  80350c:	e8 6e d4 ff ff       	call   80097f <strcpy>
+  803511:	b8 00 00 00 00       	mov    $0x0,%eax
+  803516:	c9                   	leave
+  803517:	c3                   	ret
+
+00803518 <devcons_write>:
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	57                   	push   %edi
+  80351c:	56                   	push   %esi
+  80351d:	53                   	push   %ebx
+  80351e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803524:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803527:	85 ff                	test   %edi,%edi
+  803529:	74 51                	je     80357c <devcons_write+0x64>
+  80352b:	be 00 00 00 00       	mov    $0x0,%esi
+  803530:	b8 00 00 00 00       	mov    $0x0,%eax
+  803535:	89 fb                	mov    %edi,%ebx
+  803537:	29 c3                	sub    %eax,%ebx
+  803539:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80353e:	39 d3                	cmp    %edx,%ebx
+  803540:	0f 47 da             	cmova  %edx,%ebx
+  803543:	83 ec 04             	sub    $0x4,%esp
+  803546:	53                   	push   %ebx
+  803547:	03 45 0c             	add    0xc(%ebp),%eax
+  80354a:	50                   	push   %eax
+  80354b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803551:	50                   	push   %eax
+  803552:	e8 d8 d5 ff ff       	call   800b2f <memmove>
+  803557:	83 c4 08             	add    $0x8,%esp
+  80355a:	53                   	push   %ebx
+  80355b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803561:	50                   	push   %eax
+  803562:	e8 90 d7 ff ff       	call   800cf7 <sys_cputs>
+  803567:	01 de                	add    %ebx,%esi
+  803569:	89 f0                	mov    %esi,%eax
+  80356b:	83 c4 10             	add    $0x10,%esp
+  80356e:	39 fe                	cmp    %edi,%esi
+  803570:	72 c3                	jb     803535 <devcons_write+0x1d>
+  803572:	89 f0                	mov    %esi,%eax
+  803574:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803577:	5b                   	pop    %ebx
+  803578:	5e                   	pop    %esi
+  803579:	5f                   	pop    %edi
+  80357a:	5d                   	pop    %ebp
+  80357b:	c3                   	ret
+  80357c:	be 00 00 00 00       	mov    $0x0,%esi
+  803581:	eb ef                	jmp    803572 <devcons_write+0x5a>
+
+00803583 <devcons_read>:
+  803583:	55                   	push   %ebp
+  803584:	89 e5                	mov    %esp,%ebp
+  803586:	83 ec 08             	sub    $0x8,%esp
+  803589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803592:	75 07                	jne    80359b <devcons_read+0x18>
+  803594:	eb 1f                	jmp    8035b5 <devcons_read+0x32>
+  803596:	e8 f9 d7 ff ff       	call   800d94 <sys_yield>
+  80359b:	e8 75 d7 ff ff       	call   800d15 <sys_cgetc>
+  8035a0:	85 c0                	test   %eax,%eax
+  8035a2:	74 f2                	je     803596 <devcons_read+0x13>
+  8035a4:	78 0f                	js     8035b5 <devcons_read+0x32>
+  8035a6:	83 f8 04             	cmp    $0x4,%eax
+  8035a9:	74 0c                	je     8035b7 <devcons_read+0x34>
+  8035ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035ae:	88 02                	mov    %al,(%edx)
+  8035b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035b5:	c9                   	leave
+  8035b6:	c3                   	ret
+  8035b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bc:	eb f7                	jmp    8035b5 <devcons_read+0x32>
+
+008035be <cputchar>:
+  8035be:	55                   	push   %ebp
+  8035bf:	89 e5                	mov    %esp,%ebp
+  8035c1:	83 ec 20             	sub    $0x20,%esp
+  8035c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c7:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8035ca:	6a 01                	push   $0x1
+  8035cc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035cf:	50                   	push   %eax
+  8035d0:	e8 22 d7 ff ff       	call   800cf7 <sys_cputs>
+  8035d5:	83 c4 10             	add    $0x10,%esp
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+
+008035da <getchar>:
+  8035da:	55                   	push   %ebp
+  8035db:	89 e5                	mov    %esp,%ebp
+  8035dd:	83 ec 1c             	sub    $0x1c,%esp
+  8035e0:	6a 01                	push   $0x1
+  8035e2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035e5:	50                   	push   %eax
+  8035e6:	6a 00                	push   $0x0
+  8035e8:	e8 39 e3 ff ff       	call   801926 <read>
+  8035ed:	83 c4 10             	add    $0x10,%esp
+  8035f0:	85 c0                	test   %eax,%eax
+  8035f2:	78 06                	js     8035fa <getchar+0x20>
+  8035f4:	74 06                	je     8035fc <getchar+0x22>
+  8035f6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8035fa:	c9                   	leave
+  8035fb:	c3                   	ret
+  8035fc:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803601:	eb f7                	jmp    8035fa <getchar+0x20>
+
+00803603 <iscons>:
+  803603:	55                   	push   %ebp
+  803604:	89 e5                	mov    %esp,%ebp
+  803606:	83 ec 20             	sub    $0x20,%esp
+  803609:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80360c:	50                   	push   %eax
+  80360d:	ff 75 08             	push   0x8(%ebp)
+  803610:	e8 af e0 ff ff       	call   8016c4 <fd_lookup>
+  803615:	83 c4 10             	add    $0x10,%esp
+  803618:	85 c0                	test   %eax,%eax
+  80361a:	78 11                	js     80362d <iscons+0x2a>
+  80361c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80361f:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803625:	39 10                	cmp    %edx,(%eax)
+  803627:	0f 94 c0             	sete   %al
+  80362a:	0f b6 c0             	movzbl %al,%eax
+  80362d:	c9                   	leave
+  80362e:	c3                   	ret
+
+0080362f <opencons>:
+  80362f:	55                   	push   %ebp
+  803630:	89 e5                	mov    %esp,%ebp
+  803632:	83 ec 24             	sub    $0x24,%esp
+  803635:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803638:	50                   	push   %eax
+  803639:	e8 36 e0 ff ff       	call   801674 <fd_alloc>
+  80363e:	83 c4 10             	add    $0x10,%esp
+  803641:	85 c0                	test   %eax,%eax
+  803643:	78 3a                	js     80367f <opencons+0x50>
+  803645:	83 ec 04             	sub    $0x4,%esp
+  803648:	68 07 04 00 00       	push   $0x407
+  80364d:	ff 75 f4             	push   -0xc(%ebp)
+  803650:	6a 00                	push   $0x0
+  803652:	e8 88 d7 ff ff       	call   800ddf <sys_page_alloc>
+  803657:	83 c4 10             	add    $0x10,%esp
+  80365a:	85 c0                	test   %eax,%eax
+  80365c:	78 21                	js     80367f <opencons+0x50>
+  80365e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803661:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803667:	89 10                	mov    %edx,(%eax)
+  803669:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80366c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803673:	83 ec 0c             	sub    $0xc,%esp
+  803676:	50                   	push   %eax
+  803677:	e8 d1 df ff ff       	call   80164d <fd2num>
+  80367c:	83 c4 10             	add    $0x10,%esp
+  80367f:	c9                   	leave
+  803680:	c3                   	ret
+
+00803681 <dupq_flush>:
+  803681:	55                   	push   %ebp
+  803682:	89 e5                	mov    %esp,%ebp
+  803684:	53                   	push   %ebx
+  803685:	83 ec 0c             	sub    $0xc,%esp
+  803688:	8b 1d 10 60 80 00    	mov    0x806010,%ebx
+  80368e:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  803695:	00 00 00 
+  803698:	53                   	push   %ebx
+  803699:	68 00 00 40 00       	push   $0x400000
+  80369e:	e8 c3 de ff ff       	call   801566 <sys_batch>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	78 14                	js     8036be <dupq_flush+0x3d>
+  8036aa:	39 c3                	cmp    %eax,%ebx
+  8036ac:	7e 0b                	jle    8036b9 <dupq_flush+0x38>
+  8036ae:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8036b1:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8036b7:	eb 05                	jmp    8036be <dupq_flush+0x3d>
+  8036b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c1:	c9                   	leave
+  8036c2:	c3                   	ret
+
+008036c3 <pgfault>:
+  8036c3:	55                   	push   %ebp
+  8036c4:	89 e5                	mov    %esp,%ebp
+  8036c6:	56                   	push   %esi
+  8036c7:	53                   	push   %ebx
+  8036c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036cb:	8b 30                	mov    (%eax),%esi
+  8036cd:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8036d1:	0f 84 83 00 00 00    	je     80375a <pgfault+0x97>
+  8036d7:	89 f0                	mov    %esi,%eax
+  8036d9:	c1 e8 0c             	shr    $0xc,%eax
+  8036dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036e3:	f6 c4 08             	test   $0x8,%ah
+  8036e6:	0f 84 80 00 00 00    	je     80376c <pgfault+0xa9>
+  8036ec:	e8 84 d6 ff ff       	call   800d75 <sys_getenvid>
+  8036f1:	89 c3                	mov    %eax,%ebx
+  8036f3:	83 ec 04             	sub    $0x4,%esp
+  8036f6:	6a 07                	push   $0x7
+  8036f8:	68 00 f0 7f 00       	push   $0x7ff000
+  8036fd:	50                   	push   %eax
+  8036fe:	e8 dc d6 ff ff       	call   800ddf <sys_page_alloc>
+  803703:	83 c4 10             	add    $0x10,%esp
+  803706:	85 c0                	test   %eax,%eax
+  803708:	78 74                	js     80377e <pgfault+0xbb>
+  80370a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803710:	83 ec 04             	sub    $0x4,%esp
+  803713:	68 00 10 00 00       	push   $0x1000
+  803718:	56                   	push   %esi
+  803719:	68 00 f0 7f 00       	push   $0x7ff000
+  80371e:	e8 0c d4 ff ff       	call   800b2f <memmove>
+  803723:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80372a:	56                   	push   %esi
+  80372b:	53                   	push   %ebx
+  80372c:	68 00 f0 7f 00       	push   $0x7ff000
+  803731:	53                   	push   %ebx
+  803732:	e8 eb d6 ff ff       	call   800e22 <sys_page_map>
+  803737:	83 c4 20             	add    $0x20,%esp
+  80373a:	85 c0                	test   %eax,%eax
+  80373c:	78 54                	js     803792 <pgfault+0xcf>
+  80373e:	83 ec 08             	sub    $0x8,%esp
+  803741:	68 00 f0 7f 00       	push   $0x7ff000
+  803746:	53                   	push   %ebx
+  803747:	e8 65 d7 ff ff       	call   800eb1 <sys_page_unmap>
+  80374c:	83 c4 10             	add    $0x10,%esp
+  80374f:	85 c0                	test   %eax,%eax
+  803751:	78 53                	js     8037a6 <pgfault+0xe3>
+  803753:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803756:	5b                   	pop    %ebx
+  803757:	5e                   	pop    %esi
+  803758:	5d                   	pop    %ebp
+  803759:	c3                   	ret
+  80375a:	56                   	push   %esi
+  80375b:	68 34 47 80 00       	push   $0x804734
+  803760:	6a 19                	push   $0x19
+  803762:	68 10 48 80 00       	push   $0x804810
+  803767:	e8 41 ca ff ff       	call   8001ad <_panic>
+  80376c:	56                   	push   %esi
+  80376d:	68 68 47 80 00       	push   $0x804768
+  803772:	6a 1e                	push   $0x1e
+  803774:	68 10 48 80 00       	push   $0x804810
+  803779:	e8 2f ca ff ff       	call   8001ad <_panic>
+  80377e:	83 ec 04             	sub    $0x4,%esp
+  803781:	68 9c 47 80 00       	push   $0x80479c
+  803786:	6a 2e                	push   $0x2e
+  803788:	68 10 48 80 00       	push   $0x804810
+  80378d:	e8 1b ca ff ff       	call   8001ad <_panic>
+  803792:	83 ec 04             	sub    $0x4,%esp
+  803795:	68 c0 47 80 00       	push   $0x8047c0
+  80379a:	6a 37                	push   $0x37
+  80379c:	68 10 48 80 00       	push   $0x804810
+  8037a1:	e8 07 ca ff ff       	call   8001ad <_panic>
+  8037a6:	83 ec 04             	sub    $0x4,%esp
+  8037a9:	68 ec 47 80 00       	push   $0x8047ec
+  8037ae:	6a 3c                	push   $0x3c
+  8037b0:	68 10 48 80 00       	push   $0x804810
+  8037b5:	e8 f3 c9 ff ff       	call   8001ad <_panic>
+
+008037ba <dupq_begin>:
+  8037ba:	55                   	push   %ebp
+  8037bb:	89 e5                	mov    %esp,%ebp
+  8037bd:	83 ec 0c             	sub    $0xc,%esp
+  8037c0:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8037c7:	00 00 00 
+  8037ca:	6a 07                	push   $0x7
+  8037cc:	68 00 00 40 00       	push   $0x400000
+  8037d1:	6a 00                	push   $0x0
+  8037d3:	e8 07 d6 ff ff       	call   800ddf <sys_page_alloc>
+  8037d8:	c9                   	leave
+  8037d9:	c3                   	ret
+
+008037da <dupq_map>:
+  8037da:	55                   	push   %ebp
+  8037db:	89 e5                	mov    %esp,%ebp
+  8037dd:	83 ec 08             	sub    $0x8,%esp
+  8037e0:	81 3d 10 60 80 00 92 	cmpl   $0x92,0x806010
+  8037e7:	00 00 00 
+  8037ea:	74 46                	je     803832 <dupq_map+0x58>
+  8037ec:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8037f2:	8d 42 01             	lea    0x1(%edx),%eax
+  8037f5:	a3 10 60 80 00       	mov    %eax,0x806010
+  8037fa:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8037fd:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  803803:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  80380a:	00 00 00 
+  80380d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803810:	89 50 04             	mov    %edx,0x4(%eax)
+  803813:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803816:	c1 e2 0c             	shl    $0xc,%edx
+  803819:	89 50 08             	mov    %edx,0x8(%eax)
+  80381c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80381f:	89 48 0c             	mov    %ecx,0xc(%eax)
+  803822:	89 50 10             	mov    %edx,0x10(%eax)
+  803825:	8b 55 14             	mov    0x14(%ebp),%edx
+  803828:	89 50 14             	mov    %edx,0x14(%eax)
+  80382b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803830:	c9                   	leave
+  803831:	c3                   	ret
+  803832:	e8 4a fe ff ff       	call   803681 <dupq_flush>
+  803837:	85 c0                	test   %eax,%eax
+  803839:	79 b1                	jns    8037ec <dupq_map+0x12>
+  80383b:	eb f3                	jmp    803830 <dupq_map+0x56>
+
+0080383d <dupq_end>:
+  80383d:	55                   	push   %ebp
+  80383e:	89 e5                	mov    %esp,%ebp
+  803840:	53                   	push   %ebx
+  803841:	83 ec 04             	sub    $0x4,%esp
+  803844:	e8 38 fe ff ff       	call   803681 <dupq_flush>
+  803849:	89 c3                	mov    %eax,%ebx
+  80384b:	83 ec 08             	sub    $0x8,%esp
+  80384e:	68 00 00 40 00       	push   $0x400000
+  803853:	6a 00                	push   $0x0
+  803855:	e8 57 d6 ff ff       	call   800eb1 <sys_page_unmap>
+  80385a:	89 d8                	mov    %ebx,%eax
+  80385c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80385f:	c9                   	leave
+  803860:	c3                   	ret
+
+00803861 <fork>:
+  803861:	55                   	push   %ebp
+  803862:	89 e5                	mov    %esp,%ebp
+  803864:	53                   	push   %ebx
+  803865:	83 ec 10             	sub    $0x10,%esp
+  803868:	68 c3 36 80 00       	push   $0x8036c3
+  80386d:	e8 ef 05 00 00       	call   803e61 <set_pgfault_handler>
+  803872:	83 c4 08             	add    $0x8,%esp
+  803875:	6a 01                	push   $0x1
+  803877:	6a 00                	push   $0x0
+  803879:	e8 18 d7 ff ff       	call   800f96 <sys_env_set_cow>
+  80387e:	e8 70 d6 ff ff       	call   800ef3 <sys_fork>
+  803883:	89 c3                	mov    %eax,%ebx
+  803885:	83 c4 10             	add    $0x10,%esp
+  803888:	85 c0                	test   %eax,%eax
+  80388a:	74 07                	je     803893 <fork+0x32>
+  80388c:	89 d8                	mov    %ebx,%eax
+  80388e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803891:	c9                   	leave
+  803892:	c3                   	ret
+  803893:	e8 dd d4 ff ff       	call   800d75 <sys_getenvid>
+  803898:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80389d:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8038a3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038a8:	a3 14 60 80 00       	mov    %eax,0x806014
+  8038ad:	eb dd                	jmp    80388c <fork+0x2b>
+
+008038af <sfork>:
+  8038af:	55                   	push   %ebp
+  8038b0:	89 e5                	mov    %esp,%ebp
+  8038b2:	57                   	push   %edi
+  8038b3:	56                   	push   %esi
+  8038b4:	53                   	push   %ebx
+  8038b5:	83 ec 1c             	sub    $0x1c,%esp
+  8038b8:	e8 b8 d4 ff ff       	call   800d75 <sys_getenvid>
+  8038bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8038c0:	83 ec 0c             	sub    $0xc,%esp
+  8038c3:	68 c3 36 80 00       	push   $0x8036c3
+  8038c8:	e8 94 05 00 00       	call   803e61 <set_pgfault_handler>
+  8038cd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8038d2:	cd 30                	int    $0x30
+  8038d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038d7:	83 c4 10             	add    $0x10,%esp
+  8038da:	85 c0                	test   %eax,%eax
+  8038dc:	0f 88 45 02 00 00    	js     803b27 <sfork+0x278>
+  8038e2:	89 c6                	mov    %eax,%esi
+  8038e4:	74 17                	je     8038fd <sfork+0x4e>
+  8038e6:	e8 cf fe ff ff       	call   8037ba <dupq_begin>
+  8038eb:	85 c0                	test   %eax,%eax
+  8038ed:	0f 88 40 02 00 00    	js     803b33 <sfork+0x284>
+  8038f3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8038f8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8038fb:	eb 39                	jmp    803936 <sfork+0x87>
+  8038fd:	e8 73 d4 ff ff       	call   800d75 <sys_getenvid>
+  803902:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803907:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80390d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803912:	a3 14 60 80 00       	mov    %eax,0x806014
+  803917:	e9 23 01 00 00       	jmp    803a3f <sfork+0x190>
+  80391c:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803923:	a8 01                	test   $0x1,%al
+  803925:	75 5b                	jne    803982 <sfork+0xd3>
+  803927:	83 c7 01             	add    $0x1,%edi
+  80392a:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  803930:	0f 84 40 01 00 00    	je     803a76 <sfork+0x1c7>
+  803936:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80393d:	a8 01                	test   $0x1,%al
+  80393f:	74 db                	je     80391c <sfork+0x6d>
+  803941:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803948:	a8 80                	test   $0x80,%al
+  80394a:	74 d0                	je     80391c <sfork+0x6d>
+  80394c:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803953:	25 07 0e 00 00       	and    $0xe07,%eax
+  803958:	0c 80                	or     $0x80,%al
+  80395a:	50                   	push   %eax
+  80395b:	ff 75 e4             	push   -0x1c(%ebp)
+  80395e:	89 f8                	mov    %edi,%eax
+  803960:	c1 e0 16             	shl    $0x16,%eax
+  803963:	c1 e8 0c             	shr    $0xc,%eax
+  803966:	50                   	push   %eax
+  803967:	ff 75 e0             	push   -0x20(%ebp)
+  80396a:	e8 6b fe ff ff       	call   8037da <dupq_map>
+  80396f:	83 c4 10             	add    $0x10,%esp
+  803972:	85 c0                	test   %eax,%eax
+  803974:	79 b1                	jns    803927 <sfork+0x78>
+  803976:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80397d:	e9 bd 00 00 00       	jmp    803a3f <sfork+0x190>
+  803982:	89 fe                	mov    %edi,%esi
+  803984:	c1 e6 16             	shl    $0x16,%esi
+  803987:	89 f0                	mov    %esi,%eax
+  803989:	c1 e8 0c             	shr    $0xc,%eax
+  80398c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803991:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803994:	eb 57                	jmp    8039ed <sfork+0x13e>
+  803996:	e8 da d3 ff ff       	call   800d75 <sys_getenvid>
+  80399b:	89 c7                	mov    %eax,%edi
+  80399d:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  8039a2:	f6 c4 04             	test   $0x4,%ah
+  8039a5:	0f 85 9f 00 00 00    	jne    803a4a <sfork+0x19b>
+  8039ab:	a9 02 08 00 00       	test   $0x802,%eax
+  8039b0:	0f 85 c5 01 00 00    	jne    803b7b <sfork+0x2cc>
+  8039b6:	6a 05                	push   $0x5
+  8039b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8039bb:	68 fd e7 0e 00       	push   $0xee7fd
+  8039c0:	57                   	push   %edi
+  8039c1:	e8 14 fe ff ff       	call   8037da <dupq_map>
+  8039c6:	83 c4 10             	add    $0x10,%esp
+  8039c9:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8039cf:	0f 84 91 00 00 00    	je     803a66 <sfork+0x1b7>
+  8039d5:	89 f0                	mov    %esi,%eax
+  8039d7:	09 d8                	or     %ebx,%eax
+  8039d9:	c1 e8 0c             	shr    $0xc,%eax
+  8039dc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8039e2:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  8039e7:	0f 84 81 00 00 00    	je     803a6e <sfork+0x1bf>
+  8039ed:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  8039f2:	74 a2                	je     803996 <sfork+0xe7>
+  8039f4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8039fb:	f6 c2 01             	test   $0x1,%dl
+  8039fe:	74 c9                	je     8039c9 <sfork+0x11a>
+  803a00:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a07:	f6 c6 02             	test   $0x2,%dh
+  803a0a:	75 bd                	jne    8039c9 <sfork+0x11a>
+  803a0c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803a13:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a1a:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  803a20:	f7 d2                	not    %edx
+  803a22:	21 ca                	and    %ecx,%edx
+  803a24:	52                   	push   %edx
+  803a25:	ff 75 e4             	push   -0x1c(%ebp)
+  803a28:	50                   	push   %eax
+  803a29:	ff 75 e0             	push   -0x20(%ebp)
+  803a2c:	e8 a9 fd ff ff       	call   8037da <dupq_map>
+  803a31:	83 c4 10             	add    $0x10,%esp
+  803a34:	85 c0                	test   %eax,%eax
+  803a36:	79 91                	jns    8039c9 <sfork+0x11a>
+  803a38:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803a3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a45:	5b                   	pop    %ebx
+  803a46:	5e                   	pop    %esi
+  803a47:	5f                   	pop    %edi
+  803a48:	5d                   	pop    %ebp
+  803a49:	c3                   	ret
+  803a4a:	25 07 0e 00 00       	and    $0xe07,%eax
+  803a4f:	50                   	push   %eax
+  803a50:	ff 75 e4             	push   -0x1c(%ebp)
+  803a53:	68 fd e7 0e 00       	push   $0xee7fd
+  803a58:	57                   	push   %edi
+  803a59:	e8 7c fd ff ff       	call   8037da <dupq_map>
+  803a5e:	83 c4 10             	add    $0x10,%esp
+  803a61:	e9 63 ff ff ff       	jmp    8039c9 <sfork+0x11a>
+  803a66:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803a69:	e9 b9 fe ff ff       	jmp    803927 <sfork+0x78>
+  803a6e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803a71:	e9 b1 fe ff ff       	jmp    803927 <sfork+0x78>
+  803a76:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803a79:	e8 bf fd ff ff       	call   80383d <dupq_end>
+  803a7e:	85 c0                	test   %eax,%eax
+  803a80:	0f 88 b9 00 00 00    	js     803b3f <sfork+0x290>
+  803a86:	83 ec 04             	sub    $0x4,%esp
+  803a89:	6a 07                	push   $0x7
+  803a8b:	68 00 f0 7f ee       	push   $0xee7ff000
+  803a90:	56                   	push   %esi
+  803a91:	e8 49 d3 ff ff       	call   800ddf <sys_page_alloc>
+  803a96:	83 c4 10             	add    $0x10,%esp
+  803a99:	85 c0                	test   %eax,%eax
+  803a9b:	0f 88 aa 00 00 00    	js     803b4b <sfork+0x29c>
+  803aa1:	83 ec 0c             	sub    $0xc,%esp
+  803aa4:	6a 07                	push   $0x7
+  803aa6:	68 00 f0 7f 00       	push   $0x7ff000
+  803aab:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803aae:	57                   	push   %edi
+  803aaf:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ab4:	56                   	push   %esi
+  803ab5:	e8 68 d3 ff ff       	call   800e22 <sys_page_map>
+  803aba:	83 c4 20             	add    $0x20,%esp
+  803abd:	85 c0                	test   %eax,%eax
+  803abf:	0f 88 92 00 00 00    	js     803b57 <sfork+0x2a8>
+  803ac5:	83 ec 04             	sub    $0x4,%esp
+  803ac8:	68 00 10 00 00       	push   $0x1000
+  803acd:	68 00 f0 7f 00       	push   $0x7ff000
+  803ad2:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ad7:	e8 53 d0 ff ff       	call   800b2f <memmove>
+  803adc:	83 c4 08             	add    $0x8,%esp
+  803adf:	68 00 f0 7f 00       	push   $0x7ff000
+  803ae4:	57                   	push   %edi
+  803ae5:	e8 c7 d3 ff ff       	call   800eb1 <sys_page_unmap>
+  803aea:	83 c4 10             	add    $0x10,%esp
+  803aed:	85 c0                	test   %eax,%eax
+  803aef:	78 72                	js     803b63 <sfork+0x2b4>
+  803af1:	83 ec 08             	sub    $0x8,%esp
+  803af4:	68 d9 3e 80 00       	push   $0x803ed9
+  803af9:	56                   	push   %esi
+  803afa:	e8 f9 d4 ff ff       	call   800ff8 <sys_env_set_pgfault_upcall>
+  803aff:	83 c4 10             	add    $0x10,%esp
+  803b02:	85 c0                	test   %eax,%eax
+  803b04:	78 69                	js     803b6f <sfork+0x2c0>
+  803b06:	83 ec 08             	sub    $0x8,%esp
+  803b09:	6a 02                	push   $0x2
+  803b0b:	56                   	push   %esi
+  803b0c:	e8 01 d4 ff ff       	call   800f12 <sys_env_set_status>
+  803b11:	83 c4 10             	add    $0x10,%esp
+  803b14:	85 c0                	test   %eax,%eax
+  803b16:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803b1b:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  803b1f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803b22:	e9 18 ff ff ff       	jmp    803a3f <sfork+0x190>
+  803b27:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b2e:	e9 0c ff ff ff       	jmp    803a3f <sfork+0x190>
+  803b33:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b3a:	e9 00 ff ff ff       	jmp    803a3f <sfork+0x190>
+  803b3f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b46:	e9 f4 fe ff ff       	jmp    803a3f <sfork+0x190>
+  803b4b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b52:	e9 e8 fe ff ff       	jmp    803a3f <sfork+0x190>
+  803b57:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b5e:	e9 dc fe ff ff       	jmp    803a3f <sfork+0x190>
+  803b63:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b6a:	e9 d0 fe ff ff       	jmp    803a3f <sfork+0x190>
+  803b6f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b76:	e9 c4 fe ff ff       	jmp    803a3f <sfork+0x190>
+  803b7b:	68 05 08 00 00       	push   $0x805
+  803b80:	ff 75 e4             	push   -0x1c(%ebp)
+  803b83:	68 fd e7 0e 00       	push   $0xee7fd
+  803b88:	57                   	push   %edi
+  803b89:	e8 4c fc ff ff       	call   8037da <dupq_map>
+  803b8e:	83 c4 10             	add    $0x10,%esp
+  803b91:	85 c0                	test   %eax,%eax
+  803b93:	0f 88 30 fe ff ff    	js     8039c9 <sfork+0x11a>
+  803b99:	68 05 08 00 00       	push   $0x805
+  803b9e:	57                   	push   %edi
+  803b9f:	68 fd e7 0e 00       	push   $0xee7fd
+  803ba4:	57                   	push   %edi
+  803ba5:	e8 30 fc ff ff       	call   8037da <dupq_map>
+  803baa:	83 c4 10             	add    $0x10,%esp
+  803bad:	e9 17 fe ff ff       	jmp    8039c9 <sfork+0x11a>
+
+00803bb2 <ipc_recv>:
+  803bb2:	55                   	push   %ebp
+  803bb3:	89 e5                	mov    %esp,%ebp
+  803bb5:	56                   	push   %esi
+  803bb6:	53                   	push   %ebx
+  803bb7:	8b 75 08             	mov    0x8(%ebp),%esi
+  803bba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803bbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803bc0:	85 c0                	test   %eax,%eax
+  803bc2:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803bc7:	0f 44 c2             	cmove  %edx,%eax
+  803bca:	83 ec 0c             	sub    $0xc,%esp
+  803bcd:	50                   	push   %eax
+  803bce:	e8 b7 d4 ff ff       	call   80108a <sys_ipc_recv>
+  803bd3:	83 c4 10             	add    $0x10,%esp
+  803bd6:	85 c0                	test   %eax,%eax
+  803bd8:	78 2a                	js     803c04 <ipc_recv+0x52>
+  803bda:	a1 14 60 80 00       	mov    0x806014,%eax
+  803bdf:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803be5:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803beb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803bf1:	85 f6                	test   %esi,%esi
+  803bf3:	74 02                	je     803bf7 <ipc_recv+0x45>
+  803bf5:	89 0e                	mov    %ecx,(%esi)
+  803bf7:	85 db                	test   %ebx,%ebx
+  803bf9:	74 02                	je     803bfd <ipc_recv+0x4b>
+  803bfb:	89 13                	mov    %edx,(%ebx)
+  803bfd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c00:	5b                   	pop    %ebx
+  803c01:	5e                   	pop    %esi
+  803c02:	5d                   	pop    %ebp
+  803c03:	c3                   	ret
+  803c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c0e:	eb e1                	jmp    803bf1 <ipc_recv+0x3f>
+
+00803c10 <ipc_send>:
+  803c10:	55                   	push   %ebp
+  803c11:	89 e5                	mov    %esp,%ebp
+  803c13:	57                   	push   %edi
+  803c14:	56                   	push   %esi
+  803c15:	53                   	push   %ebx
+  803c16:	83 ec 0c             	sub    $0xc,%esp
+  803c19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803c1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c1f:	8b 75 14             	mov    0x14(%ebp),%esi
+  803c22:	85 db                	test   %ebx,%ebx
+  803c24:	74 1e                	je     803c44 <ipc_send+0x34>
+  803c26:	56                   	push   %esi
+  803c27:	53                   	push   %ebx
+  803c28:	57                   	push   %edi
+  803c29:	ff 75 08             	push   0x8(%ebp)
+  803c2c:	e8 e6 d4 ff ff       	call   801117 <sys_ipc_send>
+  803c31:	83 c4 10             	add    $0x10,%esp
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	74 2a                	je     803c62 <ipc_send+0x52>
+  803c38:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803c3b:	75 13                	jne    803c50 <ipc_send+0x40>
+  803c3d:	e8 52 d1 ff ff       	call   800d94 <sys_yield>
+  803c42:	eb e2                	jmp    803c26 <ipc_send+0x16>
+  803c44:	be 00 00 00 00       	mov    $0x0,%esi
+  803c49:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803c4e:	eb d6                	jmp    803c26 <ipc_send+0x16>
+  803c50:	50                   	push   %eax
+  803c51:	68 1c 48 80 00       	push   $0x80481c
+  803c56:	6a 4f                	push   $0x4f
+  803c58:	68 5f 48 80 00       	push   $0x80485f
+  803c5d:	e8 4b c5 ff ff       	call   8001ad <_panic>
+  803c62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c65:	5b                   	pop    %ebx
+  803c66:	5e                   	pop    %esi
+  803c67:	5f                   	pop    %edi
+  803c68:	5d                   	pop    %ebp
+  803c69:	c3                   	ret
+
+00803c6a <ipc_call>:
+  803c6a:	55                   	push   %ebp
+  803c6b:	89 e5                	mov    %esp,%ebp
+  803c6d:	57                   	push   %edi
+  803c6e:	56                   	push   %esi
+  803c6f:	53                   	push   %ebx
+  803c70:	83 ec 0c             	sub    $0xc,%esp
+  803c73:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c77:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803c7c:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803c80:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803c84:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803c89:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803c8d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c96:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803c9a:	eb 05                	jmp    803ca1 <ipc_call+0x37>
+  803c9c:	e8 f3 d0 ff ff       	call   800d94 <sys_yield>
+  803ca1:	83 ec 0c             	sub    $0xc,%esp
+  803ca4:	56                   	push   %esi
+  803ca5:	53                   	push   %ebx
+  803ca6:	57                   	push   %edi
+  803ca7:	ff 75 0c             	push   0xc(%ebp)
+  803caa:	ff 75 08             	push   0x8(%ebp)
+  803cad:	e8 b5 d4 ff ff       	call   801167 <sys_ipc_call>
+  803cb2:	83 c4 20             	add    $0x20,%esp
+  803cb5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803cb8:	74 e2                	je     803c9c <ipc_call+0x32>
+  803cba:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803cbd:	74 2d                	je     803cec <ipc_call+0x82>
+  803cbf:	85 c0                	test   %eax,%eax
+  803cc1:	78 4f                	js     803d12 <ipc_call+0xa8>
+  803cc3:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803cc7:	74 10                	je     803cd9 <ipc_call+0x6f>
+  803cc9:	a1 14 60 80 00       	mov    0x806014,%eax
+  803cce:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803cd4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803cd7:	89 02                	mov    %eax,(%edx)
+  803cd9:	a1 14 60 80 00       	mov    0x806014,%eax
+  803cde:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803ce4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ce7:	5b                   	pop    %ebx
+  803ce8:	5e                   	pop    %esi
+  803ce9:	5f                   	pop    %edi
+  803cea:	5d                   	pop    %ebp
+  803ceb:	c3                   	ret
+  803cec:	ff 75 14             	push   0x14(%ebp)
+  803cef:	ff 75 10             	push   0x10(%ebp)
+  803cf2:	ff 75 0c             	push   0xc(%ebp)
+  803cf5:	ff 75 08             	push   0x8(%ebp)
+  803cf8:	e8 13 ff ff ff       	call   803c10 <ipc_send>
+  803cfd:	83 c4 0c             	add    $0xc,%esp
+  803d00:	ff 75 1c             	push   0x1c(%ebp)
+  803d03:	ff 75 18             	push   0x18(%ebp)
+  803d06:	6a 00                	push   $0x0
+  803d08:	e8 a5 fe ff ff       	call   803bb2 <ipc_recv>
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	eb d2                	jmp    803ce4 <ipc_call+0x7a>
+  803d12:	50                   	push   %eax
+  803d13:	68 69 48 80 00       	push   $0x804869
+  803d18:	6a 6d                	push   $0x6d
+  803d1a:	68 5f 48 80 00       	push   $0x80485f
+  803d1f:	e8 89 c4 ff ff       	call   8001ad <_panic>
+
+00803d24 <ipc_reply_recv>:
+  803d24:	55                   	push   %ebp
+  803d25:	89 e5                	mov    %esp,%ebp
+  803d27:	57                   	push   %edi
+  803d28:	56                   	push   %esi
+  803d29:	53                   	push   %ebx
+  803d2a:	83 ec 0c             	sub    $0xc,%esp
+  803d2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d30:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803d33:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803d36:	85 db                	test   %ebx,%ebx
+  803d38:	0f 84 ac 00 00 00    	je     803dea <ipc_reply_recv+0xc6>
+  803d3e:	85 f6                	test   %esi,%esi
+  803d40:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803d45:	0f 45 c6             	cmovne %esi,%eax
+  803d48:	83 ec 0c             	sub    $0xc,%esp
+  803d4b:	50                   	push   %eax
+  803d4c:	ff 75 14             	push   0x14(%ebp)
+  803d4f:	53                   	push   %ebx
+  803d50:	ff 75 0c             	push   0xc(%ebp)
+  803d53:	ff 75 08             	push   0x8(%ebp)
+  803d56:	e8 2d d4 ff ff       	call   801188 <sys_ipc_reply_recv>
+  803d5b:	83 c4 20             	add    $0x20,%esp
+  803d5e:	85 c0                	test   %eax,%eax
+  803d60:	78 3a                	js     803d9c <ipc_reply_recv+0x78>
+  803d62:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803d66:	74 10                	je     803d78 <ipc_reply_recv+0x54>
+  803d68:	a1 14 60 80 00       	mov    0x806014,%eax
+  803d6d:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803d73:	8b 55 18             	mov    0x18(%ebp),%edx
+  803d76:	89 02                	mov    %eax,(%edx)
+  803d78:	85 ff                	test   %edi,%edi
+  803d7a:	74 0d                	je     803d89 <ipc_reply_recv+0x65>
+  803d7c:	a1 14 60 80 00       	mov    0x806014,%eax
+  803d81:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803d87:	89 07                	mov    %eax,(%edi)
+  803d89:	a1 14 60 80 00       	mov    0x806014,%eax
+  803d8e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d97:	5b                   	pop    %ebx
+  803d98:	5e                   	pop    %esi
+  803d99:	5f                   	pop    %edi
+  803d9a:	5d                   	pop    %ebp
+  803d9b:	c3                   	ret
+  803d9c:	ff 75 14             	push   0x14(%ebp)
+  803d9f:	53                   	push   %ebx
+  803da0:	ff 75 0c             	push   0xc(%ebp)
+  803da3:	ff 75 08             	push   0x8(%ebp)
+  803da6:	e8 8f d2 ff ff       	call   80103a <sys_ipc_try_send>
+  803dab:	89 c2                	mov    %eax,%edx
+  803dad:	c1 ea 1f             	shr    $0x1f,%edx
+  803db0:	83 c4 10             	add    $0x10,%esp
+  803db3:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803db6:	0f 95 c1             	setne  %cl
+  803db9:	84 d1                	test   %dl,%cl
+  803dbb:	74 05                	je     803dc2 <ipc_reply_recv+0x9e>
+  803dbd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803dc0:	75 12                	jne    803dd4 <ipc_reply_recv+0xb0>
+  803dc2:	83 ec 04             	sub    $0x4,%esp
+  803dc5:	57                   	push   %edi
+  803dc6:	56                   	push   %esi
+  803dc7:	ff 75 18             	push   0x18(%ebp)
+  803dca:	e8 e3 fd ff ff       	call   803bb2 <ipc_recv>
+  803dcf:	83 c4 10             	add    $0x10,%esp
+  803dd2:	eb c0                	jmp    803d94 <ipc_reply_recv+0x70>
+  803dd4:	83 ec 04             	sub    $0x4,%esp
+  803dd7:	50                   	push   %eax
+  803dd8:	ff 75 08             	push   0x8(%ebp)
+  803ddb:	68 3c 48 80 00       	push   $0x80483c
+  803de0:	e8 a3 c4 ff ff       	call   800288 <cprintf>
+  803de5:	83 c4 10             	add    $0x10,%esp
+  803de8:	eb d8                	jmp    803dc2 <ipc_reply_recv+0x9e>
+  803dea:	85 f6                	test   %esi,%esi
+  803dec:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803df1:	0f 45 c6             	cmovne %esi,%eax
+  803df4:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803df9:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803e00:	e9 43 ff ff ff       	jmp    803d48 <ipc_reply_recv+0x24>
+
+00803e05 <ipc_find_env>:
+  803e05:	55                   	push   %ebp
+  803e06:	89 e5                	mov    %esp,%ebp
+  803e08:	83 ec 14             	sub    $0x14,%esp
+  803e0b:	ff 75 08             	push   0x8(%ebp)
+  803e0e:	e8 c5 d1 ff ff       	call   800fd8 <sys_env_service>
+  803e13:	85 c0                	test   %eax,%eax
+  803e15:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e1a:	0f 48 c2             	cmovs  %edx,%eax
+  803e1d:	c9                   	leave
+  803e1e:	c3                   	ret
+
+00803e1f <pageref>:
+  803e1f:	55                   	push   %ebp
+  803e20:	89 e5                	mov    %esp,%ebp
+  803e22:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e25:	89 c2                	mov    %eax,%edx
+  803e27:	c1 ea 16             	shr    $0x16,%edx
+  803e2a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e36:	f6 c1 01             	test   $0x1,%cl
+  803e39:	74 22                	je     803e5d <pageref+0x3e>
+  803e3b:	c1 e8 0c             	shr    $0xc,%eax
+  803e3e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e45:	a8 01                	test   $0x1,%al
+  803e47:	74 14                	je     803e5d <pageref+0x3e>
+  803e49:	c1 e8 0c             	shr    $0xc,%eax
+  803e4c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803e4f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803e56:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803e5a:	0f b7 d2             	movzwl %dx,%edx
+  803e5d:	89 d0                	mov    %edx,%eax
+  803e5f:	5d                   	pop    %ebp
+  803e60:	c3                   	ret
+
+00803e61 <set_pgfault_handler>:
+  803e61:	55                   	push   %ebp
+  803e62:	89 e5                	mov    %esp,%ebp
+  803e64:	53                   	push   %ebx
+  803e65:	83 ec 04             	sub    $0x4,%esp
+  803e68:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803e6f:	74 0d                	je     803e7e <set_pgfault_handler+0x1d>
+  803e71:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e74:	a3 00 90 80 00       	mov    %eax,0x809000
+  803e79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e7c:	c9                   	leave
+  803e7d:	c3                   	ret
+  803e7e:	e8 f2 ce ff ff       	call   800d75 <sys_getenvid>
+  803e83:	89 c3                	mov    %eax,%ebx
+  803e85:	83 ec 04             	sub    $0x4,%esp
+  803e88:	6a 07                	push   $0x7
+  803e8a:	68 00 f0 7f ee       	push   $0xee7ff000
+  803e8f:	50                   	push   %eax
+  803e90:	e8 4a cf ff ff       	call   800ddf <sys_page_alloc>
+  803e95:	83 c4 10             	add    $0x10,%esp
+  803e98:	85 c0                	test   %eax,%eax
+  803e9a:	78 29                	js     803ec5 <set_pgfault_handler+0x64>
+  803e9c:	83 ec 08             	sub    $0x8,%esp
+  803e9f:	68 d9 3e 80 00       	push   $0x803ed9
+  803ea4:	53                   	push   %ebx
+  803ea5:	e8 4e d1 ff ff       	call   800ff8 <sys_env_set_pgfault_upcall>
+  803eaa:	83 c4 10             	add    $0x10,%esp
+  803ead:	85 c0                	test   %eax,%eax
+  803eaf:	79 c0                	jns    803e71 <set_pgfault_handler+0x10>
+  803eb1:	83 ec 04             	sub    $0x4,%esp
+  803eb4:	68 c0 48 80 00       	push   $0x8048c0
+  803eb9:	6a 27                	push   $0x27
+  803ebb:	68 f2 48 80 00       	push   $0x8048f2
+  803ec0:	e8 e8 c2 ff ff       	call   8001ad <_panic>
+  803ec5:	83 ec 04             	sub    $0x4,%esp
+  803ec8:	68 88 48 80 00       	push   $0x804888
+  803ecd:	6a 23                	push   $0x23
+  803ecf:	68 f2 48 80 00       	push   $0x8048f2
+  803ed4:	e8 d4 c2 ff ff       	call   8001ad <_panic>
+
+00803ed9 <_pgfault_upcall>:
+  803ed9:	54                   	push   %esp
+  803eda:	a1 00 90 80 00       	mov    0x809000,%eax
+  803edf:	ff d0                	call   *%eax
+  803ee1:	83 c4 04             	add    $0x4,%esp
+  803ee4:	89 e3                	mov    %esp,%ebx
+  803ee6:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803eea:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803eee:	89 d4                	mov    %edx,%esp
+  803ef0:	51                   	push   %ecx
+  803ef1:	89 dc                	mov    %ebx,%esp
+  803ef3:	83 ea 04             	sub    $0x4,%edx
+  803ef6:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803efa:	83 c4 08             	add    $0x8,%esp
+  803efd:	61                   	popa
+  803efe:	83 c4 04             	add    $0x4,%esp
+  803f01:	9d                   	popf
+  803f02:	5c                   	pop    %esp
+  803f03:	c3                   	ret
+
+00803f04 <__udivmoddi4>:
+  803f04:	55                   	push   %ebp
+  803f05:	57                   	push   %edi
+  803f06:	56                   	push   %esi
+  803f07:	53                   	push   %ebx
+  803f08:	83 ec 24             	sub    $0x24,%esp
+  803f0b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803f0f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803f13:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f17:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f1b:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803f1f:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803f23:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803f27:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803f2b:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f39:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803f3e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803f45:	00 
+  803f46:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803f4d:	00 
+  803f4e:	89 fb                	mov    %edi,%ebx
+  803f50:	eb 08                	jmp    803f5a <__udivmoddi4+0x56>
+  803f52:	83 e9 01             	sub    $0x1,%ecx
+  803f55:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803f58:	74 68                	je     803fc2 <__udivmoddi4+0xbe>
+  803f5a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803f5e:	01 c0                	add    %eax,%eax
+  803f60:	89 c6                	mov    %eax,%esi
+  803f62:	89 d7                	mov    %edx,%edi
+  803f64:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f68:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f6c:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f6f:	d3 ea                	shr    %cl,%edx
+  803f71:	f6 c1 20             	test   $0x20,%cl
+  803f74:	74 04                	je     803f7a <__udivmoddi4+0x76>
+  803f76:	89 d0                	mov    %edx,%eax
+  803f78:	31 d2                	xor    %edx,%edx
+  803f7a:	83 e0 01             	and    $0x1,%eax
+  803f7d:	89 04 24             	mov    %eax,(%esp)
+  803f80:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f87:	00 
+  803f88:	8b 04 24             	mov    (%esp),%eax
+  803f8b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f8f:	09 f0                	or     %esi,%eax
+  803f91:	09 fa                	or     %edi,%edx
+  803f93:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f97:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f9b:	39 f0                	cmp    %esi,%eax
+  803f9d:	89 d5                	mov    %edx,%ebp
+  803f9f:	19 fd                	sbb    %edi,%ebp
+  803fa1:	72 af                	jb     803f52 <__udivmoddi4+0x4e>
+  803fa3:	29 f0                	sub    %esi,%eax
+  803fa5:	19 fa                	sbb    %edi,%edx
+  803fa7:	89 cf                	mov    %ecx,%edi
+  803fa9:	c1 ef 05             	shr    $0x5,%edi
+  803fac:	83 e7 01             	and    $0x1,%edi
+  803faf:	89 fe                	mov    %edi,%esi
+  803fb1:	83 f6 01             	xor    $0x1,%esi
+  803fb4:	d3 e6                	shl    %cl,%esi
+  803fb6:	d3 e7                	shl    %cl,%edi
+  803fb8:	09 74 24 18          	or     %esi,0x18(%esp)
+  803fbc:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803fc0:	eb 90                	jmp    803f52 <__udivmoddi4+0x4e>
+  803fc2:	85 db                	test   %ebx,%ebx
+  803fc4:	74 05                	je     803fcb <__udivmoddi4+0xc7>
+  803fc6:	89 03                	mov    %eax,(%ebx)
+  803fc8:	89 53 04             	mov    %edx,0x4(%ebx)
+  803fcb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803fcf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803fd3:	83 c4 24             	add    $0x24,%esp
+  803fd6:	5b                   	pop    %ebx
+  803fd7:	5e                   	pop    %esi
+  803fd8:	5f                   	pop    %edi
+  803fd9:	5d                   	pop    %ebp
+  803fda:	c3                   	ret
+
+00803fdb <__udivdi3>:
+  803fdb:	83 ec 08             	sub    $0x8,%esp
+  803fde:	6a 00                	push   $0x0
+  803fe0:	ff 74 24 1c          	push   0x1c(%esp)
+  803fe4:	ff 74 24 1c          	push   0x1c(%esp)
+  803fe8:	ff 74 24 1c          	push   0x1c(%esp)
+  803fec:	ff 74 24 1c          	push   0x1c(%esp)
+  803ff0:	e8 0f ff ff ff       	call   803f04 <__udivmoddi4>
+  803ff5:	83 c4 1c             	add    $0x1c,%esp
+  803ff8:	c3                   	ret
+
+00803ff9 <__umoddi3>:
+  803ff9:	83 ec 18             	sub    $0x18,%esp
+  803ffc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804000:	50                   	push   %eax
+  804001:	ff 74 24 2c          	push   0x2c(%esp)
+  804005:	ff 74 24 2c          	push   0x2c(%esp)
+  804009:	ff 74 24 2c          	push   0x2c(%esp)
+  80400d:	ff 74 24 2c          	push   0x2c(%esp)
+  804011:	e8 ee fe ff ff       	call   803f04 <__udivmoddi4>
+  804016:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80401a:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80401e:	83 c4 2c             	add    $0x2c,%esp
+  804021:	c3                   	ret
+
+00804022 <__divdi3>:
+  804022:	53                   	push   %ebx
+  804023:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804027:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80402b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80402f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804033:	85 d2                	test   %edx,%edx
+  804035:	78 12                	js     804049 <__divdi3+0x27>
+  804037:	85 db                	test   %ebx,%ebx
+  804039:	78 2e                	js     804069 <__divdi3+0x47>
+  80403b:	53                   	push   %ebx
+  80403c:	51                   	push   %ecx
+  80403d:	52                   	push   %edx
+  80403e:	50                   	push   %eax
+  80403f:	e8 97 ff ff ff       	call   803fdb <__udivdi3>
+  804044:	83 c4 10             	add    $0x10,%esp
+  804047:	eb 1e                	jmp    804067 <__divdi3+0x45>
+  804049:	f7 d8                	neg    %eax
+  80404b:	83 d2 00             	adc    $0x0,%edx
+  80404e:	f7 da                	neg    %edx
+  804050:	85 db                	test   %ebx,%ebx
+  804052:	78 2a                	js     80407e <__divdi3+0x5c>
+  804054:	53                   	push   %ebx
+  804055:	51                   	push   %ecx
+  804056:	52                   	push   %edx
+  804057:	50                   	push   %eax
+  804058:	e8 7e ff ff ff       	call   803fdb <__udivdi3>
+  80405d:	83 c4 10             	add    $0x10,%esp
+  804060:	f7 d8                	neg    %eax
+  804062:	83 d2 00             	adc    $0x0,%edx
+  804065:	f7 da                	neg    %edx
+  804067:	5b                   	pop    %ebx
+  804068:	c3                   	ret
+  804069:	f7 d9                	neg    %ecx
+  80406b:	83 d3 00             	adc    $0x0,%ebx
+  80406e:	f7 db                	neg    %ebx
+  804070:	53                   	push   %ebx
+  804071:	51                   	push   %ecx
+  804072:	52                   	push   %edx
+  804073:	50                   	push   %eax
+  804074:	e8 62 ff ff ff       	call   803fdb <__udivdi3>
+  804079:	83 c4 10             	add    $0x10,%esp
+  80407c:	eb e2                	jmp    804060 <__divdi3+0x3e>
+  80407e:	f7 d9                	neg    %ecx
+  804080:	83 d3 00             	adc    $0x0,%ebx
+  804083:	f7 db                	neg    %ebx
+  804085:	53                   	push   %ebx
+  804086:	51                   	push   %ecx
+  804087:	52                   	push   %edx
+  804088:	50                   	push   %eax
+  804089:	e8 4d ff ff ff       	call   803fdb <__udivdi3>
+  80408e:	83 c4 10             	add    $0x10,%esp
+  804091:	eb d4                	jmp    804067 <__divdi3+0x45>
+
+00804093 <__moddi3>:
+  804093:	55                   	push   %ebp
+  804094:	57                   	push   %edi
+  804095:	56                   	push   %esi
+  804096:	53                   	push   %ebx
+  804097:	83 ec 0c             	sub    $0xc,%esp
+  80409a:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80409e:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8040a2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8040a6:	89 e9                	mov    %ebp,%ecx
+  8040a8:	f7 d9                	neg    %ecx
+  8040aa:	89 d0                	mov    %edx,%eax
+  8040ac:	83 d0 00             	adc    $0x0,%eax
+  8040af:	f7 d8                	neg    %eax
+  8040b1:	0f 49 e9             	cmovns %ecx,%ebp
+  8040b4:	0f 49 d0             	cmovns %eax,%edx
+  8040b7:	52                   	push   %edx
+  8040b8:	55                   	push   %ebp
+  8040b9:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8040bd:	f7 da                	neg    %edx
+  8040bf:	89 d8                	mov    %ebx,%eax
+  8040c1:	83 d0 00             	adc    $0x0,%eax
+  8040c4:	f7 d8                	neg    %eax
+  8040c6:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8040cb:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8040cf:	0f 48 c3             	cmovs  %ebx,%eax
+  8040d2:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8040d6:	ff 74 24 0c          	push   0xc(%esp)
+  8040da:	ff 74 24 0c          	push   0xc(%esp)
+  8040de:	e8 16 ff ff ff       	call   803ff9 <__umoddi3>
+  8040e3:	83 c4 10             	add    $0x10,%esp
+  8040e6:	85 db                	test   %ebx,%ebx
+  8040e8:	78 08                	js     8040f2 <__moddi3+0x5f>
+  8040ea:	83 c4 0c             	add    $0xc,%esp
+  8040ed:	5b                   	pop    %ebx
+  8040ee:	5e                   	pop    %esi
+  8040ef:	5f                   	pop    %edi
+  8040f0:	5d                   	pop    %ebp
+  8040f1:	c3                   	ret
+  8040f2:	f7 d8                	neg    %eax
+  8040f4:	83 d2 00             	adc    $0x0,%edx
+  8040f7:	f7 da                	neg    %edx
+  8040f9:	eb ef                	jmp    8040ea <__moddi3+0x57>
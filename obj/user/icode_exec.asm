@@ -0,0 +1,6209 @@
+
+obj/user/icode_exec.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 00 01 00 00       	call   800131 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+  80003e:	c7 05 00 50 80 00 00 	movl   $0x804100,0x805000
+  800045:	41 80 00 
+  800048:	68 06 41 80 00       	push   $0x804106
+  80004d:	e8 33 02 00 00       	call   800285 <cprintf>
+  800052:	c7 04 24 15 41 80 00 	movl   $0x804115,(%esp)
+  800059:	e8 27 02 00 00       	call   800285 <cprintf>
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 28 41 80 00       	push   $0x804128
+  800068:	e8 73 20 00 00       	call   8020e0 <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 56 41 80 00       	push   $0x804156
+  80007e:	e8 02 02 00 00       	call   800285 <cprintf>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+  80008e:	50                   	push   %eax
+  80008f:	68 2e 41 80 00       	push   $0x80412e
+  800094:	6a 0f                	push   $0xf
+  800096:	68 44 41 80 00       	push   $0x804144
+  80009b:	e8 0a 01 00 00       	call   8001aa <_panic>
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 4a 0c 00 00       	call   800cf4 <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 67 18 00 00       	call   801923 <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 69 41 80 00       	push   $0x804169
+  8000cb:	e8 b5 01 00 00       	call   800285 <cprintf>
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 0f 17 00 00       	call   8017e7 <close>
+  8000d8:	c7 04 24 7d 41 80 00 	movl   $0x80417d,(%esp)
+  8000df:	e8 a1 01 00 00       	call   800285 <cprintf>
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 91 41 80 00       	push   $0x804191
+  8000f0:	68 9a 41 80 00       	push   $0x80419a
+  8000f5:	68 a4 41 80 00       	push   $0x8041a4
+  8000fa:	68 a3 41 80 00       	push   $0x8041a3
+  8000ff:	e8 ac 29 00 00       	call   802ab0 <execl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 14                	js     80011f <umain+0xec>
+  80010b:	83 ec 04             	sub    $0x4,%esp
+  80010e:	68 c0 41 80 00       	push   $0x8041c0
+  800113:	6a 1c                	push   $0x1c
+  800115:	68 44 41 80 00       	push   $0x804144
+  80011a:	e8 8b 00 00 00       	call   8001aa <_panic>
+  80011f:	50                   	push   %eax
+  800120:	68 a9 41 80 00       	push   $0x8041a9
+  800125:	6a 1a                	push   $0x1a
+  800127:	68 44 41 80 00       	push   $0x804144
+  80012c:	e8 79 00 00 00       	call   8001aa <_panic>
+
+00800131 <libmain>:
+  800131:	55                   	push   %ebp
+  800132:	89 e5                	mov    %esp,%ebp
+  800134:	56                   	push   %esi
+  800135:	53                   	push   %ebx
+  800136:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800139:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80013c:	e8 31 0c 00 00       	call   800d72 <sys_getenvid>
+  800141:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800146:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80014c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800151:	a3 14 60 80 00       	mov    %eax,0x806014
+  800156:	85 db                	test   %ebx,%ebx
+  800158:	7e 07                	jle    800161 <libmain+0x30>
+  80015a:	8b 06                	mov    (%esi),%eax
+  80015c:	a3 00 50 80 00       	mov    %eax,0x805000
+  800161:	83 ec 08             	sub    $0x8,%esp
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  800166:	e8 c8 fe ff ff       	call   800033 <umain>
+  80016b:	e8 0a 00 00 00       	call   80017a <exit>
+  800170:	83 c4 10             	add    $0x10,%esp
+  800173:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800176:	5b                   	pop    %ebx
+  800177:	5e                   	pop    %esi
+  800178:	5d                   	pop    %ebp
+  800179:	c3                   	ret
+
+0080017a <exit>:
+  80017a:	55                   	push   %ebp
+  80017b:	89 e5                	mov    %esp,%ebp
+  80017d:	83 ec 08             	sub    $0x8,%esp
+  800180:	a1 14 60 80 00       	mov    0x806014,%eax
+  800185:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80018b:	85 c0                	test   %eax,%eax
+  80018d:	75 14                	jne    8001a3 <exit+0x29>
+  80018f:	e8 80 16 00 00       	call   801814 <close_all>
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	6a 00                	push   $0x0
+  800199:	e8 93 0b 00 00       	call   800d31 <sys_env_destroy>
+  80019e:	83 c4 10             	add    $0x10,%esp
+  8001a1:	c9                   	leave
+  8001a2:	c3                   	ret
+  8001a3:	e8 f6 12 00 00       	call   80149e <sys_lease_complete>
+  8001a8:	eb e5                	jmp    80018f <exit+0x15>
+
+008001aa <_panic>:
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	56                   	push   %esi
+  8001ae:	53                   	push   %ebx
+  8001af:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8001b2:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001b8:	e8 b5 0b 00 00       	call   800d72 <sys_getenvid>
+  8001bd:	83 ec 0c             	sub    $0xc,%esp
+  8001c0:	ff 75 0c             	push   0xc(%ebp)
+  8001c3:	ff 75 08             	push   0x8(%ebp)
+  8001c6:	56                   	push   %esi
+  8001c7:	50                   	push   %eax
+  8001c8:	68 e4 41 80 00       	push   $0x8041e4
+  8001cd:	e8 b3 00 00 00       	call   800285 <cprintf>
+  8001d2:	83 c4 18             	add    $0x18,%esp
+  8001d5:	53                   	push   %ebx
+  8001d6:	ff 75 10             	push   0x10(%ebp)
+  8001d9:	e8 56 00 00 00       	call   800234 <vcprintf>
+  8001de:	c7 04 24 d8 41 80 00 	movl   $0x8041d8,(%esp)
+  8001e5:	e8 9b 00 00 00       	call   800285 <cprintf>
+  8001ea:	83 c4 10             	add    $0x10,%esp
+  8001ed:	cc                   	int3
+  8001ee:	eb fd                	jmp    8001ed <_panic+0x43>
+
+008001f0 <putch>:
+  8001f0:	55                   	push   %ebp
+  8001f1:	89 e5                	mov    %esp,%ebp
+  8001f3:	53                   	push   %ebx
+  8001f4:	83 ec 04             	sub    $0x4,%esp
+  8001f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001fa:	8b 13                	mov    (%ebx),%edx
+  8001fc:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ff:	89 03                	mov    %eax,(%ebx)
+  800201:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800204:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800208:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80020d:	74 09                	je     800218 <putch+0x28>
+  80020f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800213:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800216:	c9                   	leave
+  800217:	c3                   	ret
+  800218:	83 ec 08             	sub    $0x8,%esp
+  80021b:	68 ff 00 00 00       	push   $0xff
+  800220:	8d 43 08             	lea    0x8(%ebx),%eax
+  800223:	50                   	push   %eax
+  800224:	e8 cb 0a 00 00       	call   800cf4 <sys_cputs>
+  800229:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80022f:	83 c4 10             	add    $0x10,%esp
+  800232:	eb db                	jmp    80020f <putch+0x1f>
+
+00800234 <vcprintf>:
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80023d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800244:	00 00 00 
+  800247:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80024e:	00 00 00 
+  800251:	ff 75 0c             	push   0xc(%ebp)
+  800254:	ff 75 08             	push   0x8(%ebp)
+  800257:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80025d:	50                   	push   %eax
+  80025e:	68 f0 01 80 00       	push   $0x8001f0
+  800263:	e8 1c 01 00 00       	call   800384 <vprintfmt>
+  800268:	83 c4 08             	add    $0x8,%esp
+  80026b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800271:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800277:	50                   	push   %eax
+  800278:	e8 77 0a 00 00       	call   800cf4 <sys_cputs>
+  80027d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800283:	c9                   	leave
+  800284:	c3                   	ret
+
+00800285 <cprintf>:
+  800285:	55                   	push   %ebp
+  800286:	89 e5                	mov    %esp,%ebp
+  800288:	83 ec 10             	sub    $0x10,%esp
+  80028b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80028e:	50                   	push   %eax
+  80028f:	ff 75 08             	push   0x8(%ebp)
+  800292:	e8 9d ff ff ff       	call   800234 <vcprintf>
+  800297:	c9                   	leave
+  800298:	c3                   	ret
+
+00800299 <printnum>:
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	57                   	push   %edi
+  80029d:	56                   	push   %esi
+  80029e:	53                   	push   %ebx
+  80029f:	83 ec 1c             	sub    $0x1c,%esp
+  8002a2:	89 c3                	mov    %eax,%ebx
+  8002a4:	89 d6                	mov    %edx,%esi
+  8002a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002ac:	89 d1                	mov    %edx,%ecx
+  8002ae:	89 c2                	mov    %eax,%edx
+  8002b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002b3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002b6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002bc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002c3:	39 c2                	cmp    %eax,%edx
+  8002c5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002c8:	73 4b                	jae    800315 <printnum+0x7c>
+  8002ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002cd:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8002d0:	85 ff                	test   %edi,%edi
+  8002d2:	7e 11                	jle    8002e5 <printnum+0x4c>
+  8002d4:	83 ec 08             	sub    $0x8,%esp
+  8002d7:	56                   	push   %esi
+  8002d8:	ff 75 18             	push   0x18(%ebp)
+  8002db:	ff d3                	call   *%ebx
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	83 ef 01             	sub    $0x1,%edi
+  8002e3:	75 ef                	jne    8002d4 <printnum+0x3b>
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	56                   	push   %esi
+  8002e9:	83 ec 04             	sub    $0x4,%esp
+  8002ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ef:	ff 75 e0             	push   -0x20(%ebp)
+  8002f2:	ff 75 dc             	push   -0x24(%ebp)
+  8002f5:	ff 75 d8             	push   -0x28(%ebp)
+  8002f8:	e8 f9 3c 00 00       	call   803ff6 <__umoddi3>
+  8002fd:	83 c4 14             	add    $0x14,%esp
+  800300:	0f be 80 07 42 80 00 	movsbl 0x804207(%eax),%eax
+  800307:	50                   	push   %eax
+  800308:	ff d3                	call   *%ebx
+  80030a:	83 c4 10             	add    $0x10,%esp
+  80030d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800310:	5b                   	pop    %ebx
+  800311:	5e                   	pop    %esi
+  800312:	5f                   	pop    %edi
+  800313:	5d                   	pop    %ebp
+  800314:	c3                   	ret
+  800315:	83 ec 0c             	sub    $0xc,%esp
+  800318:	ff 75 18             	push   0x18(%ebp)
+  80031b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80031e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800321:	52                   	push   %edx
+  800322:	50                   	push   %eax
+  800323:	83 ec 08             	sub    $0x8,%esp
+  800326:	ff 75 e4             	push   -0x1c(%ebp)
+  800329:	ff 75 e0             	push   -0x20(%ebp)
+  80032c:	ff 75 dc             	push   -0x24(%ebp)
+  80032f:	ff 75 d8             	push   -0x28(%ebp)
+  800332:	e8 a1 3c 00 00       	call   803fd8 <__udivdi3>
+  800337:	83 c4 18             	add    $0x18,%esp
+  80033a:	52                   	push   %edx
+  80033b:	50                   	push   %eax
+  80033c:	89 f2                	mov    %esi,%edx
+  80033e:	89 d8                	mov    %ebx,%eax
+  800340:	e8 54 ff ff ff       	call   800299 <printnum>
+  800345:	83 c4 20             	add    $0x20,%esp
+  800348:	eb 9b                	jmp    8002e5 <printnum+0x4c>
+
+0080034a <sprintputch>:
+  80034a:	55                   	push   %ebp
+  80034b:	89 e5                	mov    %esp,%ebp
+  80034d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800350:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800354:	8b 10                	mov    (%eax),%edx
+  800356:	3b 50 04             	cmp    0x4(%eax),%edx
+  800359:	73 0a                	jae    800365 <sprintputch+0x1b>
+  80035b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80035e:	89 08                	mov    %ecx,(%eax)
+  800360:	8b 45 08             	mov    0x8(%ebp),%eax
+  800363:	88 02                	mov    %al,(%edx)
+  800365:	5d                   	pop    %ebp
+  800366:	c3                   	ret
+
+00800367 <printfmt>:
+  800367:	55                   	push   %ebp
+  800368:	89 e5                	mov    %esp,%ebp
+  80036a:	83 ec 08             	sub    $0x8,%esp
+  80036d:	8d 45 14             	lea    0x14(%ebp),%eax
+  800370:	50                   	push   %eax
+  800371:	ff 75 10             	push   0x10(%ebp)
+  800374:	ff 75 0c             	push   0xc(%ebp)
+  800377:	ff 75 08             	push   0x8(%ebp)
+  80037a:	e8 05 00 00 00       	call   800384 <vprintfmt>
+  80037f:	83 c4 10             	add    $0x10,%esp
+  800382:	c9                   	leave
+  800383:	c3                   	ret
+
+00800384 <vprintfmt>:
+  800384:	55                   	push   %ebp
+  800385:	89 e5                	mov    %esp,%ebp
+  800387:	57                   	push   %edi
+  800388:	56                   	push   %esi
+  800389:	53                   	push   %ebx
+  80038a:	83 ec 2c             	sub    $0x2c,%esp
+  80038d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800390:	89 df                	mov    %ebx,%edi
+  800392:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800395:	8b 45 10             	mov    0x10(%ebp),%eax
+  800398:	8d 70 01             	lea    0x1(%eax),%esi
+  80039b:	0f b6 00             	movzbl (%eax),%eax
+  80039e:	83 f8 25             	cmp    $0x25,%eax
+  8003a1:	74 1e                	je     8003c1 <vprintfmt+0x3d>
+  8003a3:	85 c0                	test   %eax,%eax
+  8003a5:	0f 84 15 05 00 00    	je     8008c0 <vprintfmt+0x53c>
+  8003ab:	83 ec 08             	sub    $0x8,%esp
+  8003ae:	53                   	push   %ebx
+  8003af:	50                   	push   %eax
+  8003b0:	ff d7                	call   *%edi
+  8003b2:	83 c6 01             	add    $0x1,%esi
+  8003b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003b9:	83 c4 10             	add    $0x10,%esp
+  8003bc:	83 f8 25             	cmp    $0x25,%eax
+  8003bf:	75 e2                	jne    8003a3 <vprintfmt+0x1f>
+  8003c1:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8003c5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8003cc:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003d3:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8003da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003df:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8003e2:	8d 56 01             	lea    0x1(%esi),%edx
+  8003e5:	0f b6 0e             	movzbl (%esi),%ecx
+  8003e8:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003eb:	3c 55                	cmp    $0x55,%al
+  8003ed:	0f 87 3b 04 00 00    	ja     80082e <vprintfmt+0x4aa>
+  8003f3:	0f b6 c0             	movzbl %al,%eax
+  8003f6:	ff 24 85 40 43 80 00 	jmp    *0x804340(,%eax,4)
+  8003fd:	89 75 10             	mov    %esi,0x10(%ebp)
+  800400:	eb 93                	jmp    800395 <vprintfmt+0x11>
+  800402:	89 d6                	mov    %edx,%esi
+  800404:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800408:	eb d8                	jmp    8003e2 <vprintfmt+0x5e>
+  80040a:	89 d6                	mov    %edx,%esi
+  80040c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800410:	eb d0                	jmp    8003e2 <vprintfmt+0x5e>
+  800412:	0f b6 c9             	movzbl %cl,%ecx
+  800415:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800418:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80041b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80041f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800422:	83 f9 09             	cmp    $0x9,%ecx
+  800425:	77 6f                	ja     800496 <vprintfmt+0x112>
+  800427:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80042a:	83 c2 01             	add    $0x1,%edx
+  80042d:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800430:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800434:	0f be 02             	movsbl (%edx),%eax
+  800437:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80043a:	83 fe 09             	cmp    $0x9,%esi
+  80043d:	76 eb                	jbe    80042a <vprintfmt+0xa6>
+  80043f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800442:	89 d6                	mov    %edx,%esi
+  800444:	eb 13                	jmp    800459 <vprintfmt+0xd5>
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	8b 00                	mov    (%eax),%eax
+  80044b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 40 04             	lea    0x4(%eax),%eax
+  800454:	89 45 14             	mov    %eax,0x14(%ebp)
+  800457:	89 d6                	mov    %edx,%esi
+  800459:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80045d:	79 83                	jns    8003e2 <vprintfmt+0x5e>
+  80045f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800462:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800465:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80046c:	e9 71 ff ff ff       	jmp    8003e2 <vprintfmt+0x5e>
+  800471:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800474:	85 c9                	test   %ecx,%ecx
+  800476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047b:	0f 49 c1             	cmovns %ecx,%eax
+  80047e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800481:	89 d6                	mov    %edx,%esi
+  800483:	e9 5a ff ff ff       	jmp    8003e2 <vprintfmt+0x5e>
+  800488:	89 d6                	mov    %edx,%esi
+  80048a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800491:	e9 4c ff ff ff       	jmp    8003e2 <vprintfmt+0x5e>
+  800496:	89 d6                	mov    %edx,%esi
+  800498:	eb bf                	jmp    800459 <vprintfmt+0xd5>
+  80049a:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80049e:	89 d6                	mov    %edx,%esi
+  8004a0:	e9 3d ff ff ff       	jmp    8003e2 <vprintfmt+0x5e>
+  8004a5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8d 70 04             	lea    0x4(%eax),%esi
+  8004ae:	83 ec 08             	sub    $0x8,%esp
+  8004b1:	53                   	push   %ebx
+  8004b2:	ff 30                	push   (%eax)
+  8004b4:	ff d7                	call   *%edi
+  8004b6:	83 c4 10             	add    $0x10,%esp
+  8004b9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004bc:	e9 d4 fe ff ff       	jmp    800395 <vprintfmt+0x11>
+  8004c1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c7:	8d 70 04             	lea    0x4(%eax),%esi
+  8004ca:	8b 10                	mov    (%eax),%edx
+  8004cc:	89 d0                	mov    %edx,%eax
+  8004ce:	f7 d8                	neg    %eax
+  8004d0:	0f 48 c2             	cmovs  %edx,%eax
+  8004d3:	83 f8 12             	cmp    $0x12,%eax
+  8004d6:	7f 23                	jg     8004fb <vprintfmt+0x177>
+  8004d8:	8b 14 85 a0 44 80 00 	mov    0x8044a0(,%eax,4),%edx
+  8004df:	85 d2                	test   %edx,%edx
+  8004e1:	74 18                	je     8004fb <vprintfmt+0x177>
+  8004e3:	52                   	push   %edx
+  8004e4:	68 1d 46 80 00       	push   $0x80461d
+  8004e9:	53                   	push   %ebx
+  8004ea:	57                   	push   %edi
+  8004eb:	e8 77 fe ff ff       	call   800367 <printfmt>
+  8004f0:	83 c4 10             	add    $0x10,%esp
+  8004f3:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004f6:	e9 9a fe ff ff       	jmp    800395 <vprintfmt+0x11>
+  8004fb:	50                   	push   %eax
+  8004fc:	68 1f 42 80 00       	push   $0x80421f
+  800501:	53                   	push   %ebx
+  800502:	57                   	push   %edi
+  800503:	e8 5f fe ff ff       	call   800367 <printfmt>
+  800508:	83 c4 10             	add    $0x10,%esp
+  80050b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80050e:	e9 82 fe ff ff       	jmp    800395 <vprintfmt+0x11>
+  800513:	89 55 10             	mov    %edx,0x10(%ebp)
+  800516:	8b 45 14             	mov    0x14(%ebp),%eax
+  800519:	83 c0 04             	add    $0x4,%eax
+  80051c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	8b 00                	mov    (%eax),%eax
+  800524:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800527:	85 c0                	test   %eax,%eax
+  800529:	0f 84 61 03 00 00    	je     800890 <vprintfmt+0x50c>
+  80052f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800533:	7e 06                	jle    80053b <vprintfmt+0x1b7>
+  800535:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800539:	75 29                	jne    800564 <vprintfmt+0x1e0>
+  80053b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80053e:	8d 70 01             	lea    0x1(%eax),%esi
+  800541:	0f b6 00             	movzbl (%eax),%eax
+  800544:	0f be d0             	movsbl %al,%edx
+  800547:	85 d2                	test   %edx,%edx
+  800549:	0f 84 bb 00 00 00    	je     80060a <vprintfmt+0x286>
+  80054f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800552:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800555:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800558:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80055b:	eb 7a                	jmp    8005d7 <vprintfmt+0x253>
+  80055d:	c7 45 d0 18 42 80 00 	movl   $0x804218,-0x30(%ebp)
+  800564:	83 ec 08             	sub    $0x8,%esp
+  800567:	ff 75 d4             	push   -0x2c(%ebp)
+  80056a:	ff 75 d0             	push   -0x30(%ebp)
+  80056d:	e8 e0 03 00 00       	call   800952 <strnlen>
+  800572:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800575:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800578:	83 c4 10             	add    $0x10,%esp
+  80057b:	85 d2                	test   %edx,%edx
+  80057d:	0f 8e d6 02 00 00    	jle    800859 <vprintfmt+0x4d5>
+  800583:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800587:	83 ec 08             	sub    $0x8,%esp
+  80058a:	53                   	push   %ebx
+  80058b:	56                   	push   %esi
+  80058c:	ff d7                	call   *%edi
+  80058e:	83 c4 10             	add    $0x10,%esp
+  800591:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800595:	75 f0                	jne    800587 <vprintfmt+0x203>
+  800597:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80059a:	8d 70 01             	lea    0x1(%eax),%esi
+  80059d:	0f b6 00             	movzbl (%eax),%eax
+  8005a0:	0f be d0             	movsbl %al,%edx
+  8005a3:	85 d2                	test   %edx,%edx
+  8005a5:	0f 84 da 02 00 00    	je     800885 <vprintfmt+0x501>
+  8005ab:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005ae:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005b1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005b4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005b7:	eb 1e                	jmp    8005d7 <vprintfmt+0x253>
+  8005b9:	83 ec 08             	sub    $0x8,%esp
+  8005bc:	ff 75 0c             	push   0xc(%ebp)
+  8005bf:	52                   	push   %edx
+  8005c0:	ff 55 08             	call   *0x8(%ebp)
+  8005c3:	83 c4 10             	add    $0x10,%esp
+  8005c6:	83 eb 01             	sub    $0x1,%ebx
+  8005c9:	83 c6 01             	add    $0x1,%esi
+  8005cc:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d0:	0f be d0             	movsbl %al,%edx
+  8005d3:	85 d2                	test   %edx,%edx
+  8005d5:	74 2a                	je     800601 <vprintfmt+0x27d>
+  8005d7:	85 ff                	test   %edi,%edi
+  8005d9:	78 05                	js     8005e0 <vprintfmt+0x25c>
+  8005db:	83 ef 01             	sub    $0x1,%edi
+  8005de:	78 59                	js     800639 <vprintfmt+0x2b5>
+  8005e0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e4:	74 d3                	je     8005b9 <vprintfmt+0x235>
+  8005e6:	0f be c0             	movsbl %al,%eax
+  8005e9:	83 e8 20             	sub    $0x20,%eax
+  8005ec:	83 f8 5e             	cmp    $0x5e,%eax
+  8005ef:	76 c8                	jbe    8005b9 <vprintfmt+0x235>
+  8005f1:	83 ec 08             	sub    $0x8,%esp
+  8005f4:	ff 75 0c             	push   0xc(%ebp)
+  8005f7:	6a 3f                	push   $0x3f
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+  8005ff:	eb c5                	jmp    8005c6 <vprintfmt+0x242>
+  800601:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800604:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800607:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80060a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80060d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800611:	7e 1b                	jle    80062e <vprintfmt+0x2aa>
+  800613:	83 ec 08             	sub    $0x8,%esp
+  800616:	53                   	push   %ebx
+  800617:	6a 20                	push   $0x20
+  800619:	ff d7                	call   *%edi
+  80061b:	83 c4 10             	add    $0x10,%esp
+  80061e:	83 ee 01             	sub    $0x1,%esi
+  800621:	75 f0                	jne    800613 <vprintfmt+0x28f>
+  800623:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800626:	89 45 14             	mov    %eax,0x14(%ebp)
+  800629:	e9 67 fd ff ff       	jmp    800395 <vprintfmt+0x11>
+  80062e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+  800634:	e9 5c fd ff ff       	jmp    800395 <vprintfmt+0x11>
+  800639:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80063c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80063f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800642:	eb c6                	jmp    80060a <vprintfmt+0x286>
+  800644:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800647:	89 55 10             	mov    %edx,0x10(%ebp)
+  80064a:	83 f9 01             	cmp    $0x1,%ecx
+  80064d:	7f 1f                	jg     80066e <vprintfmt+0x2ea>
+  80064f:	85 c9                	test   %ecx,%ecx
+  800651:	74 67                	je     8006ba <vprintfmt+0x336>
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 30                	mov    (%eax),%esi
+  800658:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80065b:	89 f0                	mov    %esi,%eax
+  80065d:	c1 f8 1f             	sar    $0x1f,%eax
+  800660:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800663:	8b 45 14             	mov    0x14(%ebp),%eax
+  800666:	8d 40 04             	lea    0x4(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066c:	eb 17                	jmp    800685 <vprintfmt+0x301>
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 50 04             	mov    0x4(%eax),%edx
+  800674:	8b 00                	mov    (%eax),%eax
+  800676:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800679:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8d 40 08             	lea    0x8(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+  800685:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800688:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80068b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800690:	85 c9                	test   %ecx,%ecx
+  800692:	0f 89 12 01 00 00    	jns    8007aa <vprintfmt+0x426>
+  800698:	83 ec 08             	sub    $0x8,%esp
+  80069b:	53                   	push   %ebx
+  80069c:	6a 2d                	push   $0x2d
+  80069e:	ff d7                	call   *%edi
+  8006a0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006a6:	f7 da                	neg    %edx
+  8006a8:	83 d1 00             	adc    $0x0,%ecx
+  8006ab:	f7 d9                	neg    %ecx
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006b5:	e9 f0 00 00 00       	jmp    8007aa <vprintfmt+0x426>
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8b 30                	mov    (%eax),%esi
+  8006bf:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006c2:	89 f0                	mov    %esi,%eax
+  8006c4:	c1 f8 1f             	sar    $0x1f,%eax
+  8006c7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d3:	eb b0                	jmp    800685 <vprintfmt+0x301>
+  8006d5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006d8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006db:	83 f9 01             	cmp    $0x1,%ecx
+  8006de:	7f 1e                	jg     8006fe <vprintfmt+0x37a>
+  8006e0:	85 c9                	test   %ecx,%ecx
+  8006e2:	74 32                	je     800716 <vprintfmt+0x392>
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 10                	mov    (%eax),%edx
+  8006e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006f9:	e9 ac 00 00 00       	jmp    8007aa <vprintfmt+0x426>
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	8b 48 04             	mov    0x4(%eax),%ecx
+  800706:	8d 40 08             	lea    0x8(%eax),%eax
+  800709:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800711:	e9 94 00 00 00       	jmp    8007aa <vprintfmt+0x426>
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 10                	mov    (%eax),%edx
+  80071b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800720:	8d 40 04             	lea    0x4(%eax),%eax
+  800723:	89 45 14             	mov    %eax,0x14(%ebp)
+  800726:	be 0a 00 00 00       	mov    $0xa,%esi
+  80072b:	eb 7d                	jmp    8007aa <vprintfmt+0x426>
+  80072d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800730:	89 55 10             	mov    %edx,0x10(%ebp)
+  800733:	83 f9 01             	cmp    $0x1,%ecx
+  800736:	7f 1b                	jg     800753 <vprintfmt+0x3cf>
+  800738:	85 c9                	test   %ecx,%ecx
+  80073a:	74 2c                	je     800768 <vprintfmt+0x3e4>
+  80073c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073f:	8b 10                	mov    (%eax),%edx
+  800741:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800746:	8d 40 04             	lea    0x4(%eax),%eax
+  800749:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074c:	be 08 00 00 00       	mov    $0x8,%esi
+  800751:	eb 57                	jmp    8007aa <vprintfmt+0x426>
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8b 10                	mov    (%eax),%edx
+  800758:	8b 48 04             	mov    0x4(%eax),%ecx
+  80075b:	8d 40 08             	lea    0x8(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800761:	be 08 00 00 00       	mov    $0x8,%esi
+  800766:	eb 42                	jmp    8007aa <vprintfmt+0x426>
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 10                	mov    (%eax),%edx
+  80076d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800772:	8d 40 04             	lea    0x4(%eax),%eax
+  800775:	89 45 14             	mov    %eax,0x14(%ebp)
+  800778:	be 08 00 00 00       	mov    $0x8,%esi
+  80077d:	eb 2b                	jmp    8007aa <vprintfmt+0x426>
+  80077f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800782:	83 ec 08             	sub    $0x8,%esp
+  800785:	53                   	push   %ebx
+  800786:	6a 30                	push   $0x30
+  800788:	ff d7                	call   *%edi
+  80078a:	83 c4 08             	add    $0x8,%esp
+  80078d:	53                   	push   %ebx
+  80078e:	6a 78                	push   $0x78
+  800790:	ff d7                	call   *%edi
+  800792:	8b 45 14             	mov    0x14(%ebp),%eax
+  800795:	8b 10                	mov    (%eax),%edx
+  800797:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a5:	be 10 00 00 00       	mov    $0x10,%esi
+  8007aa:	83 ec 0c             	sub    $0xc,%esp
+  8007ad:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007b1:	50                   	push   %eax
+  8007b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b5:	56                   	push   %esi
+  8007b6:	51                   	push   %ecx
+  8007b7:	52                   	push   %edx
+  8007b8:	89 da                	mov    %ebx,%edx
+  8007ba:	89 f8                	mov    %edi,%eax
+  8007bc:	e8 d8 fa ff ff       	call   800299 <printnum>
+  8007c1:	83 c4 20             	add    $0x20,%esp
+  8007c4:	e9 cc fb ff ff       	jmp    800395 <vprintfmt+0x11>
+  8007c9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007cc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007cf:	83 f9 01             	cmp    $0x1,%ecx
+  8007d2:	7f 1b                	jg     8007ef <vprintfmt+0x46b>
+  8007d4:	85 c9                	test   %ecx,%ecx
+  8007d6:	74 2c                	je     800804 <vprintfmt+0x480>
+  8007d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007db:	8b 10                	mov    (%eax),%edx
+  8007dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e8:	be 10 00 00 00       	mov    $0x10,%esi
+  8007ed:	eb bb                	jmp    8007aa <vprintfmt+0x426>
+  8007ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f2:	8b 10                	mov    (%eax),%edx
+  8007f4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007f7:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fd:	be 10 00 00 00       	mov    $0x10,%esi
+  800802:	eb a6                	jmp    8007aa <vprintfmt+0x426>
+  800804:	8b 45 14             	mov    0x14(%ebp),%eax
+  800807:	8b 10                	mov    (%eax),%edx
+  800809:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080e:	8d 40 04             	lea    0x4(%eax),%eax
+  800811:	89 45 14             	mov    %eax,0x14(%ebp)
+  800814:	be 10 00 00 00       	mov    $0x10,%esi
+  800819:	eb 8f                	jmp    8007aa <vprintfmt+0x426>
+  80081b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80081e:	83 ec 08             	sub    $0x8,%esp
+  800821:	53                   	push   %ebx
+  800822:	6a 25                	push   $0x25
+  800824:	ff d7                	call   *%edi
+  800826:	83 c4 10             	add    $0x10,%esp
+  800829:	e9 67 fb ff ff       	jmp    800395 <vprintfmt+0x11>
+  80082e:	83 ec 08             	sub    $0x8,%esp
+  800831:	53                   	push   %ebx
+  800832:	6a 25                	push   $0x25
+  800834:	ff d7                	call   *%edi
+  800836:	83 c4 10             	add    $0x10,%esp
+  800839:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80083d:	0f 84 ba fb ff ff    	je     8003fd <vprintfmt+0x79>
+  800843:	89 75 10             	mov    %esi,0x10(%ebp)
+  800846:	89 f0                	mov    %esi,%eax
+  800848:	83 e8 01             	sub    $0x1,%eax
+  80084b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80084f:	75 f7                	jne    800848 <vprintfmt+0x4c4>
+  800851:	89 45 10             	mov    %eax,0x10(%ebp)
+  800854:	e9 3c fb ff ff       	jmp    800395 <vprintfmt+0x11>
+  800859:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80085c:	8d 70 01             	lea    0x1(%eax),%esi
+  80085f:	0f b6 00             	movzbl (%eax),%eax
+  800862:	0f be d0             	movsbl %al,%edx
+  800865:	85 d2                	test   %edx,%edx
+  800867:	74 11                	je     80087a <vprintfmt+0x4f6>
+  800869:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80086c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80086f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800872:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800875:	e9 5d fd ff ff       	jmp    8005d7 <vprintfmt+0x253>
+  80087a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80087d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800880:	e9 10 fb ff ff       	jmp    800395 <vprintfmt+0x11>
+  800885:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800888:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088b:	e9 05 fb ff ff       	jmp    800395 <vprintfmt+0x11>
+  800890:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800894:	7e 0a                	jle    8008a0 <vprintfmt+0x51c>
+  800896:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80089a:	0f 85 bd fc ff ff    	jne    80055d <vprintfmt+0x1d9>
+  8008a0:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008a5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008aa:	be 19 42 80 00       	mov    $0x804219,%esi
+  8008af:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008b2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008b5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008b8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008bb:	e9 17 fd ff ff       	jmp    8005d7 <vprintfmt+0x253>
+  8008c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008c3:	5b                   	pop    %ebx
+  8008c4:	5e                   	pop    %esi
+  8008c5:	5f                   	pop    %edi
+  8008c6:	5d                   	pop    %ebp
+  8008c7:	c3                   	ret
+
+008008c8 <vsnprintf>:
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	83 ec 18             	sub    $0x18,%esp
+  8008ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008d4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008d7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008db:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8008e5:	85 c0                	test   %eax,%eax
+  8008e7:	74 26                	je     80090f <vsnprintf+0x47>
+  8008e9:	85 d2                	test   %edx,%edx
+  8008eb:	7e 22                	jle    80090f <vsnprintf+0x47>
+  8008ed:	ff 75 14             	push   0x14(%ebp)
+  8008f0:	ff 75 10             	push   0x10(%ebp)
+  8008f3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008f6:	50                   	push   %eax
+  8008f7:	68 4a 03 80 00       	push   $0x80034a
+  8008fc:	e8 83 fa ff ff       	call   800384 <vprintfmt>
+  800901:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800904:	c6 00 00             	movb   $0x0,(%eax)
+  800907:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80090a:	83 c4 10             	add    $0x10,%esp
+  80090d:	c9                   	leave
+  80090e:	c3                   	ret
+  80090f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800914:	eb f7                	jmp    80090d <vsnprintf+0x45>
+
+00800916 <snprintf>:
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	83 ec 08             	sub    $0x8,%esp
+  80091c:	8d 45 14             	lea    0x14(%ebp),%eax
+  80091f:	50                   	push   %eax
+  800920:	ff 75 10             	push   0x10(%ebp)
+  800923:	ff 75 0c             	push   0xc(%ebp)
+  800926:	ff 75 08             	push   0x8(%ebp)
+  800929:	e8 9a ff ff ff       	call   8008c8 <vsnprintf>
+  80092e:	c9                   	leave
+  80092f:	c3                   	ret
+
+00800930 <strlen>:
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	8b 55 08             	mov    0x8(%ebp),%edx
+  800936:	80 3a 00             	cmpb   $0x0,(%edx)
+  800939:	74 10                	je     80094b <strlen+0x1b>
+  80093b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800940:	83 c0 01             	add    $0x1,%eax
+  800943:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800947:	75 f7                	jne    800940 <strlen+0x10>
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+  80094b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800950:	eb f7                	jmp    800949 <strlen+0x19>
+
+00800952 <strnlen>:
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800958:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095b:	85 d2                	test   %edx,%edx
+  80095d:	74 16                	je     800975 <strnlen+0x23>
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800968:	74 09                	je     800973 <strnlen+0x21>
+  80096a:	83 c0 01             	add    $0x1,%eax
+  80096d:	39 d0                	cmp    %edx,%eax
+  80096f:	75 f3                	jne    800964 <strnlen+0x12>
+  800971:	89 d0                	mov    %edx,%eax
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+  800975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097a:	eb f7                	jmp    800973 <strnlen+0x21>
+
+0080097c <strcpy>:
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	53                   	push   %ebx
+  800980:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800983:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80098f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800992:	83 c0 01             	add    $0x1,%eax
+  800995:	84 d2                	test   %dl,%dl
+  800997:	75 f2                	jne    80098b <strcpy+0xf>
+  800999:	89 c8                	mov    %ecx,%eax
+  80099b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80099e:	c9                   	leave
+  80099f:	c3                   	ret
+
+008009a0 <strcat>:
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	53                   	push   %ebx
+  8009a4:	83 ec 10             	sub    $0x10,%esp
+  8009a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009aa:	53                   	push   %ebx
+  8009ab:	e8 80 ff ff ff       	call   800930 <strlen>
+  8009b0:	83 c4 08             	add    $0x8,%esp
+  8009b3:	ff 75 0c             	push   0xc(%ebp)
+  8009b6:	01 d8                	add    %ebx,%eax
+  8009b8:	50                   	push   %eax
+  8009b9:	e8 be ff ff ff       	call   80097c <strcpy>
+  8009be:	89 d8                	mov    %ebx,%eax
+  8009c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c3:	c9                   	leave
+  8009c4:	c3                   	ret
+
+008009c5 <strncpy>:
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	56                   	push   %esi
+  8009c9:	53                   	push   %ebx
+  8009ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009d3:	85 db                	test   %ebx,%ebx
+  8009d5:	74 17                	je     8009ee <strncpy+0x29>
+  8009d7:	01 f3                	add    %esi,%ebx
+  8009d9:	89 f0                	mov    %esi,%eax
+  8009db:	83 c0 01             	add    $0x1,%eax
+  8009de:	0f b6 0a             	movzbl (%edx),%ecx
+  8009e1:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009e4:	80 f9 01             	cmp    $0x1,%cl
+  8009e7:	83 da ff             	sbb    $0xffffffff,%edx
+  8009ea:	39 c3                	cmp    %eax,%ebx
+  8009ec:	75 ed                	jne    8009db <strncpy+0x16>
+  8009ee:	89 f0                	mov    %esi,%eax
+  8009f0:	5b                   	pop    %ebx
+  8009f1:	5e                   	pop    %esi
+  8009f2:	5d                   	pop    %ebp
+  8009f3:	c3                   	ret
+
+008009f4 <strlcpy>:
+  8009f4:	55                   	push   %ebp
+  8009f5:	89 e5                	mov    %esp,%ebp
+  8009f7:	56                   	push   %esi
+  8009f8:	53                   	push   %ebx
+  8009f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a02:	89 f0                	mov    %esi,%eax
+  800a04:	85 db                	test   %ebx,%ebx
+  800a06:	74 1e                	je     800a26 <strlcpy+0x32>
+  800a08:	83 eb 01             	sub    $0x1,%ebx
+  800a0b:	74 16                	je     800a23 <strlcpy+0x2f>
+  800a0d:	01 f3                	add    %esi,%ebx
+  800a0f:	0f b6 0a             	movzbl (%edx),%ecx
+  800a12:	84 c9                	test   %cl,%cl
+  800a14:	74 0d                	je     800a23 <strlcpy+0x2f>
+  800a16:	83 c2 01             	add    $0x1,%edx
+  800a19:	83 c0 01             	add    $0x1,%eax
+  800a1c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a1f:	39 d8                	cmp    %ebx,%eax
+  800a21:	75 ec                	jne    800a0f <strlcpy+0x1b>
+  800a23:	c6 00 00             	movb   $0x0,(%eax)
+  800a26:	29 f0                	sub    %esi,%eax
+  800a28:	5b                   	pop    %ebx
+  800a29:	5e                   	pop    %esi
+  800a2a:	5d                   	pop    %ebp
+  800a2b:	c3                   	ret
+
+00800a2c <strcmp>:
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a32:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a35:	0f b6 01             	movzbl (%ecx),%eax
+  800a38:	84 c0                	test   %al,%al
+  800a3a:	74 11                	je     800a4d <strcmp+0x21>
+  800a3c:	38 02                	cmp    %al,(%edx)
+  800a3e:	75 0d                	jne    800a4d <strcmp+0x21>
+  800a40:	83 c1 01             	add    $0x1,%ecx
+  800a43:	83 c2 01             	add    $0x1,%edx
+  800a46:	0f b6 01             	movzbl (%ecx),%eax
+  800a49:	84 c0                	test   %al,%al
+  800a4b:	75 ef                	jne    800a3c <strcmp+0x10>
+  800a4d:	0f b6 c0             	movzbl %al,%eax
+  800a50:	0f b6 12             	movzbl (%edx),%edx
+  800a53:	29 d0                	sub    %edx,%eax
+  800a55:	5d                   	pop    %ebp
+  800a56:	c3                   	ret
+
+00800a57 <strncmp>:
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	53                   	push   %ebx
+  800a5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a5e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a61:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a69:	85 d2                	test   %edx,%edx
+  800a6b:	74 2e                	je     800a9b <strncmp+0x44>
+  800a6d:	0f b6 01             	movzbl (%ecx),%eax
+  800a70:	84 c0                	test   %al,%al
+  800a72:	74 16                	je     800a8a <strncmp+0x33>
+  800a74:	3a 03                	cmp    (%ebx),%al
+  800a76:	75 12                	jne    800a8a <strncmp+0x33>
+  800a78:	83 c1 01             	add    $0x1,%ecx
+  800a7b:	83 c3 01             	add    $0x1,%ebx
+  800a7e:	83 ea 01             	sub    $0x1,%edx
+  800a81:	75 ea                	jne    800a6d <strncmp+0x16>
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a88:	eb 11                	jmp    800a9b <strncmp+0x44>
+  800a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8f:	85 d2                	test   %edx,%edx
+  800a91:	74 08                	je     800a9b <strncmp+0x44>
+  800a93:	0f b6 01             	movzbl (%ecx),%eax
+  800a96:	0f b6 13             	movzbl (%ebx),%edx
+  800a99:	29 d0                	sub    %edx,%eax
+  800a9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a9e:	c9                   	leave
+  800a9f:	c3                   	ret
+
+00800aa0 <strchr>:
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800aaa:	0f b6 10             	movzbl (%eax),%edx
+  800aad:	84 d2                	test   %dl,%dl
+  800aaf:	74 15                	je     800ac6 <strchr+0x26>
+  800ab1:	38 d1                	cmp    %dl,%cl
+  800ab3:	74 0f                	je     800ac4 <strchr+0x24>
+  800ab5:	83 c0 01             	add    $0x1,%eax
+  800ab8:	0f b6 10             	movzbl (%eax),%edx
+  800abb:	84 d2                	test   %dl,%dl
+  800abd:	75 f2                	jne    800ab1 <strchr+0x11>
+  800abf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+  800ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acb:	eb f7                	jmp    800ac4 <strchr+0x24>
+
+00800acd <strfind>:
+  800acd:	55                   	push   %ebp
+  800ace:	89 e5                	mov    %esp,%ebp
+  800ad0:	53                   	push   %ebx
+  800ad1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad7:	0f b6 18             	movzbl (%eax),%ebx
+  800ada:	38 d3                	cmp    %dl,%bl
+  800adc:	74 14                	je     800af2 <strfind+0x25>
+  800ade:	89 d1                	mov    %edx,%ecx
+  800ae0:	84 db                	test   %bl,%bl
+  800ae2:	74 0e                	je     800af2 <strfind+0x25>
+  800ae4:	83 c0 01             	add    $0x1,%eax
+  800ae7:	0f b6 10             	movzbl (%eax),%edx
+  800aea:	38 ca                	cmp    %cl,%dl
+  800aec:	74 04                	je     800af2 <strfind+0x25>
+  800aee:	84 d2                	test   %dl,%dl
+  800af0:	75 f2                	jne    800ae4 <strfind+0x17>
+  800af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af5:	c9                   	leave
+  800af6:	c3                   	ret
+
+00800af7 <memset>:
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	57                   	push   %edi
+  800afb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800afe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b01:	85 c9                	test   %ecx,%ecx
+  800b03:	74 20                	je     800b25 <memset+0x2e>
+  800b05:	89 f8                	mov    %edi,%eax
+  800b07:	09 c8                	or     %ecx,%eax
+  800b09:	a8 03                	test   $0x3,%al
+  800b0b:	75 12                	jne    800b1f <memset+0x28>
+  800b0d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b11:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800b17:	c1 e9 02             	shr    $0x2,%ecx
+  800b1a:	fc                   	cld
+  800b1b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b1d:	eb 06                	jmp    800b25 <memset+0x2e>
+  800b1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b22:	fc                   	cld
+  800b23:	f3 aa                	rep stos %al,%es:(%edi)
+  800b25:	89 f8                	mov    %edi,%eax
+  800b27:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b2a:	c9                   	leave
+  800b2b:	c3                   	ret
+
+00800b2c <memmove>:
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	57                   	push   %edi
+  800b30:	56                   	push   %esi
+  800b31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b34:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b3a:	39 c6                	cmp    %eax,%esi
+  800b3c:	73 32                	jae    800b70 <memmove+0x44>
+  800b3e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b41:	39 d0                	cmp    %edx,%eax
+  800b43:	73 2b                	jae    800b70 <memmove+0x44>
+  800b45:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800b48:	89 d6                	mov    %edx,%esi
+  800b4a:	09 fe                	or     %edi,%esi
+  800b4c:	09 ce                	or     %ecx,%esi
+  800b4e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b54:	75 0e                	jne    800b64 <memmove+0x38>
+  800b56:	83 ef 04             	sub    $0x4,%edi
+  800b59:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b5c:	c1 e9 02             	shr    $0x2,%ecx
+  800b5f:	fd                   	std
+  800b60:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b62:	eb 09                	jmp    800b6d <memmove+0x41>
+  800b64:	83 ef 01             	sub    $0x1,%edi
+  800b67:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b6a:	fd                   	std
+  800b6b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b6d:	fc                   	cld
+  800b6e:	eb 1a                	jmp    800b8a <memmove+0x5e>
+  800b70:	89 f2                	mov    %esi,%edx
+  800b72:	09 c2                	or     %eax,%edx
+  800b74:	09 ca                	or     %ecx,%edx
+  800b76:	f6 c2 03             	test   $0x3,%dl
+  800b79:	75 0a                	jne    800b85 <memmove+0x59>
+  800b7b:	c1 e9 02             	shr    $0x2,%ecx
+  800b7e:	89 c7                	mov    %eax,%edi
+  800b80:	fc                   	cld
+  800b81:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b83:	eb 05                	jmp    800b8a <memmove+0x5e>
+  800b85:	89 c7                	mov    %eax,%edi
+  800b87:	fc                   	cld
+  800b88:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b8a:	5e                   	pop    %esi
+  800b8b:	5f                   	pop    %edi
+  800b8c:	5d                   	pop    %ebp
+  800b8d:	c3                   	ret
+
+00800b8e <memcpy>:
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	83 ec 0c             	sub    $0xc,%esp
+  800b94:	ff 75 10             	push   0x10(%ebp)
+  800b97:	ff 75 0c             	push   0xc(%ebp)
+  800b9a:	ff 75 08             	push   0x8(%ebp)
+  800b9d:	e8 8a ff ff ff       	call   800b2c <memmove>
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+
+00800ba4 <memcmp>:
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	56                   	push   %esi
+  800ba8:	53                   	push   %ebx
+  800ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800baf:	8b 75 10             	mov    0x10(%ebp),%esi
+  800bb2:	85 f6                	test   %esi,%esi
+  800bb4:	74 29                	je     800bdf <memcmp+0x3b>
+  800bb6:	01 c6                	add    %eax,%esi
+  800bb8:	0f b6 08             	movzbl (%eax),%ecx
+  800bbb:	0f b6 1a             	movzbl (%edx),%ebx
+  800bbe:	38 d9                	cmp    %bl,%cl
+  800bc0:	75 11                	jne    800bd3 <memcmp+0x2f>
+  800bc2:	83 c0 01             	add    $0x1,%eax
+  800bc5:	83 c2 01             	add    $0x1,%edx
+  800bc8:	39 c6                	cmp    %eax,%esi
+  800bca:	75 ec                	jne    800bb8 <memcmp+0x14>
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd1:	eb 08                	jmp    800bdb <memcmp+0x37>
+  800bd3:	0f b6 c1             	movzbl %cl,%eax
+  800bd6:	0f b6 db             	movzbl %bl,%ebx
+  800bd9:	29 d8                	sub    %ebx,%eax
+  800bdb:	5b                   	pop    %ebx
+  800bdc:	5e                   	pop    %esi
+  800bdd:	5d                   	pop    %ebp
+  800bde:	c3                   	ret
+  800bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be4:	eb f5                	jmp    800bdb <memcmp+0x37>
+
+00800be6 <memfind>:
+  800be6:	55                   	push   %ebp
+  800be7:	89 e5                	mov    %esp,%ebp
+  800be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bef:	89 c2                	mov    %eax,%edx
+  800bf1:	03 55 10             	add    0x10(%ebp),%edx
+  800bf4:	39 d0                	cmp    %edx,%eax
+  800bf6:	73 0d                	jae    800c05 <memfind+0x1f>
+  800bf8:	38 08                	cmp    %cl,(%eax)
+  800bfa:	74 0d                	je     800c09 <memfind+0x23>
+  800bfc:	83 c0 01             	add    $0x1,%eax
+  800bff:	39 c2                	cmp    %eax,%edx
+  800c01:	75 f5                	jne    800bf8 <memfind+0x12>
+  800c03:	eb 06                	jmp    800c0b <memfind+0x25>
+  800c05:	89 c2                	mov    %eax,%edx
+  800c07:	eb 02                	jmp    800c0b <memfind+0x25>
+  800c09:	89 c2                	mov    %eax,%edx
+  800c0b:	89 d0                	mov    %edx,%eax
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	c3                   	ret
+
+00800c0f <strtol>:
+  800c0f:	55                   	push   %ebp
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	57                   	push   %edi
+  800c13:	56                   	push   %esi
+  800c14:	53                   	push   %ebx
+  800c15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c1b:	0f b6 02             	movzbl (%edx),%eax
+  800c1e:	3c 20                	cmp    $0x20,%al
+  800c20:	74 04                	je     800c26 <strtol+0x17>
+  800c22:	3c 09                	cmp    $0x9,%al
+  800c24:	75 0e                	jne    800c34 <strtol+0x25>
+  800c26:	83 c2 01             	add    $0x1,%edx
+  800c29:	0f b6 02             	movzbl (%edx),%eax
+  800c2c:	3c 20                	cmp    $0x20,%al
+  800c2e:	74 f6                	je     800c26 <strtol+0x17>
+  800c30:	3c 09                	cmp    $0x9,%al
+  800c32:	74 f2                	je     800c26 <strtol+0x17>
+  800c34:	3c 2b                	cmp    $0x2b,%al
+  800c36:	74 2a                	je     800c62 <strtol+0x53>
+  800c38:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c3d:	3c 2d                	cmp    $0x2d,%al
+  800c3f:	74 2b                	je     800c6c <strtol+0x5d>
+  800c41:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c47:	75 0f                	jne    800c58 <strtol+0x49>
+  800c49:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c4c:	74 28                	je     800c76 <strtol+0x67>
+  800c4e:	85 db                	test   %ebx,%ebx
+  800c50:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c55:	0f 44 d8             	cmove  %eax,%ebx
+  800c58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c60:	eb 46                	jmp    800ca8 <strtol+0x99>
+  800c62:	83 c2 01             	add    $0x1,%edx
+  800c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c6a:	eb d5                	jmp    800c41 <strtol+0x32>
+  800c6c:	83 c2 01             	add    $0x1,%edx
+  800c6f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c74:	eb cb                	jmp    800c41 <strtol+0x32>
+  800c76:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c7a:	74 0e                	je     800c8a <strtol+0x7b>
+  800c7c:	85 db                	test   %ebx,%ebx
+  800c7e:	75 d8                	jne    800c58 <strtol+0x49>
+  800c80:	83 c2 01             	add    $0x1,%edx
+  800c83:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c88:	eb ce                	jmp    800c58 <strtol+0x49>
+  800c8a:	83 c2 02             	add    $0x2,%edx
+  800c8d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c92:	eb c4                	jmp    800c58 <strtol+0x49>
+  800c94:	0f be c0             	movsbl %al,%eax
+  800c97:	83 e8 30             	sub    $0x30,%eax
+  800c9a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c9d:	7d 3a                	jge    800cd9 <strtol+0xca>
+  800c9f:	83 c2 01             	add    $0x1,%edx
+  800ca2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ca6:	01 c1                	add    %eax,%ecx
+  800ca8:	0f b6 02             	movzbl (%edx),%eax
+  800cab:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cae:	89 f3                	mov    %esi,%ebx
+  800cb0:	80 fb 09             	cmp    $0x9,%bl
+  800cb3:	76 df                	jbe    800c94 <strtol+0x85>
+  800cb5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cb8:	89 f3                	mov    %esi,%ebx
+  800cba:	80 fb 19             	cmp    $0x19,%bl
+  800cbd:	77 08                	ja     800cc7 <strtol+0xb8>
+  800cbf:	0f be c0             	movsbl %al,%eax
+  800cc2:	83 e8 57             	sub    $0x57,%eax
+  800cc5:	eb d3                	jmp    800c9a <strtol+0x8b>
+  800cc7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cca:	89 f3                	mov    %esi,%ebx
+  800ccc:	80 fb 19             	cmp    $0x19,%bl
+  800ccf:	77 08                	ja     800cd9 <strtol+0xca>
+  800cd1:	0f be c0             	movsbl %al,%eax
+  800cd4:	83 e8 37             	sub    $0x37,%eax
+  800cd7:	eb c1                	jmp    800c9a <strtol+0x8b>
+  800cd9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cdd:	74 05                	je     800ce4 <strtol+0xd5>
+  800cdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce2:	89 10                	mov    %edx,(%eax)
+  800ce4:	89 c8                	mov    %ecx,%eax
+  800ce6:	f7 d8                	neg    %eax
+  800ce8:	85 ff                	test   %edi,%edi
+  800cea:	0f 45 c8             	cmovne %eax,%ecx
+  800ced:	89 c8                	mov    %ecx,%eax
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+
+00800cf4 <sys_cputs>:
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d05:	89 c3                	mov    %eax,%ebx
+  800d07:	89 c7                	mov    %eax,%edi
+  800d09:	89 c6                	mov    %eax,%esi
+  800d0b:	cd 30                	int    $0x30
+  800d0d:	5b                   	pop    %ebx
+  800d0e:	5e                   	pop    %esi
+  800d0f:	5f                   	pop    %edi
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+
+00800d12 <sys_cgetc>:
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	57                   	push   %edi
+  800d16:	56                   	push   %esi
+  800d17:	53                   	push   %ebx
+  800d18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d22:	89 d1                	mov    %edx,%ecx
+  800d24:	89 d3                	mov    %edx,%ebx
+  800d26:	89 d7                	mov    %edx,%edi
+  800d28:	89 d6                	mov    %edx,%esi
+  800d2a:	cd 30                	int    $0x30
+  800d2c:	5b                   	pop    %ebx
+  800d2d:	5e                   	pop    %esi
+  800d2e:	5f                   	pop    %edi
+  800d2f:	5d                   	pop    %ebp
+  800d30:	c3                   	ret
+
+00800d31 <sys_env_destroy>:
+  800d31:	55                   	push   %ebp
+  800d32:	89 e5                	mov    %esp,%ebp
+  800d34:	57                   	push   %edi
+  800d35:	56                   	push   %esi
+  800d36:	53                   	push   %ebx
+  800d37:	83 ec 0c             	sub    $0xc,%esp
+  800d3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d42:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d47:	89 cb                	mov    %ecx,%ebx
+  800d49:	89 cf                	mov    %ecx,%edi
+  800d4b:	89 ce                	mov    %ecx,%esi
+  800d4d:	cd 30                	int    $0x30
+  800d4f:	85 c0                	test   %eax,%eax
+  800d51:	7f 08                	jg     800d5b <sys_env_destroy+0x2a>
+  800d53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+  800d5b:	83 ec 0c             	sub    $0xc,%esp
+  800d5e:	50                   	push   %eax
+  800d5f:	6a 03                	push   $0x3
+  800d61:	68 0b 45 80 00       	push   $0x80450b
+  800d66:	6a 24                	push   $0x24
+  800d68:	68 28 45 80 00       	push   $0x804528
+  800d6d:	e8 38 f4 ff ff       	call   8001aa <_panic>
+
+00800d72 <sys_getenvid>:
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	56                   	push   %esi
+  800d77:	53                   	push   %ebx
+  800d78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d82:	89 d1                	mov    %edx,%ecx
+  800d84:	89 d3                	mov    %edx,%ebx
+  800d86:	89 d7                	mov    %edx,%edi
+  800d88:	89 d6                	mov    %edx,%esi
+  800d8a:	cd 30                	int    $0x30
+  800d8c:	5b                   	pop    %ebx
+  800d8d:	5e                   	pop    %esi
+  800d8e:	5f                   	pop    %edi
+  800d8f:	5d                   	pop    %ebp
+  800d90:	c3                   	ret
+
+00800d91 <sys_yield>:
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	57                   	push   %edi
+  800d95:	56                   	push   %esi
+  800d96:	53                   	push   %ebx
+  800d97:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d9e:	74 26                	je     800dc6 <sys_yield+0x35>
+  800da0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800daa:	89 d1                	mov    %edx,%ecx
+  800dac:	89 d3                	mov    %edx,%ebx
+  800dae:	89 d7                	mov    %edx,%edi
+  800db0:	6a 00                	push   $0x0
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	8d 35 bd 0d 80 00    	lea    0x800dbd,%esi
+  800dbb:	0f 34                	sysenter
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	83 c4 04             	add    $0x4,%esp
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+  800dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd0:	89 d1                	mov    %edx,%ecx
+  800dd2:	89 d3                	mov    %edx,%ebx
+  800dd4:	89 d7                	mov    %edx,%edi
+  800dd6:	89 d6                	mov    %edx,%esi
+  800dd8:	cd 30                	int    $0x30
+  800dda:	eb e5                	jmp    800dc1 <sys_yield+0x30>
+
+00800ddc <sys_page_alloc>:
+  800ddc:	55                   	push   %ebp
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	57                   	push   %edi
+  800de0:	56                   	push   %esi
+  800de1:	53                   	push   %ebx
+  800de2:	83 ec 0c             	sub    $0xc,%esp
+  800de5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ded:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df8:	89 f7                	mov    %esi,%edi
+  800dfa:	cd 30                	int    $0x30
+  800dfc:	85 c0                	test   %eax,%eax
+  800dfe:	7f 08                	jg     800e08 <sys_page_alloc+0x2c>
+  800e00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e03:	5b                   	pop    %ebx
+  800e04:	5e                   	pop    %esi
+  800e05:	5f                   	pop    %edi
+  800e06:	5d                   	pop    %ebp
+  800e07:	c3                   	ret
+  800e08:	83 ec 0c             	sub    $0xc,%esp
+  800e0b:	50                   	push   %eax
+  800e0c:	6a 04                	push   $0x4
+  800e0e:	68 0b 45 80 00       	push   $0x80450b
+  800e13:	6a 24                	push   $0x24
+  800e15:	68 28 45 80 00       	push   $0x804528
+  800e1a:	e8 8b f3 ff ff       	call   8001aa <_panic>
+
+00800e1f <sys_page_map>:
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+  800e28:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e2f:	74 33                	je     800e64 <sys_page_map+0x45>
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e42:	ff 75 18             	push   0x18(%ebp)
+  800e45:	55                   	push   %ebp
+  800e46:	89 e5                	mov    %esp,%ebp
+  800e48:	8d 35 50 0e 80 00    	lea    0x800e50,%esi
+  800e4e:	0f 34                	sysenter
+  800e50:	5d                   	pop    %ebp
+  800e51:	83 c4 04             	add    $0x4,%esp
+  800e54:	89 c2                	mov    %eax,%edx
+  800e56:	85 c0                	test   %eax,%eax
+  800e58:	7f 3d                	jg     800e97 <sys_page_map+0x78>
+  800e5a:	89 d0                	mov    %edx,%eax
+  800e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5f:	5b                   	pop    %ebx
+  800e60:	5e                   	pop    %esi
+  800e61:	5f                   	pop    %edi
+  800e62:	5d                   	pop    %ebp
+  800e63:	c3                   	ret
+  800e64:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e72:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e75:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e78:	cd 30                	int    $0x30
+  800e7a:	89 c2                	mov    %eax,%edx
+  800e7c:	85 c0                	test   %eax,%eax
+  800e7e:	7e da                	jle    800e5a <sys_page_map+0x3b>
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 05                	push   $0x5
+  800e86:	68 0b 45 80 00       	push   $0x80450b
+  800e8b:	6a 24                	push   $0x24
+  800e8d:	68 28 45 80 00       	push   $0x804528
+  800e92:	e8 13 f3 ff ff       	call   8001aa <_panic>
+  800e97:	83 ec 0c             	sub    $0xc,%esp
+  800e9a:	50                   	push   %eax
+  800e9b:	6a 05                	push   $0x5
+  800e9d:	68 0b 45 80 00       	push   $0x80450b
+  800ea2:	6a 48                	push   $0x48
+  800ea4:	68 28 45 80 00       	push   $0x804528
+  800ea9:	e8 fc f2 ff ff       	call   8001aa <_panic>
+
+00800eae <sys_page_unmap>:
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	57                   	push   %edi
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec2:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ec7:	89 df                	mov    %ebx,%edi
+  800ec9:	89 de                	mov    %ebx,%esi
+  800ecb:	cd 30                	int    $0x30
+  800ecd:	85 c0                	test   %eax,%eax
+  800ecf:	7f 08                	jg     800ed9 <sys_page_unmap+0x2b>
+  800ed1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed4:	5b                   	pop    %ebx
+  800ed5:	5e                   	pop    %esi
+  800ed6:	5f                   	pop    %edi
+  800ed7:	5d                   	pop    %ebp
+  800ed8:	c3                   	ret
+  800ed9:	83 ec 0c             	sub    $0xc,%esp
+  800edc:	50                   	push   %eax
+  800edd:	6a 06                	push   $0x6
+  800edf:	68 0b 45 80 00       	push   $0x80450b
+  800ee4:	6a 24                	push   $0x24
+  800ee6:	68 28 45 80 00       	push   $0x804528
+  800eeb:	e8 ba f2 ff ff       	call   8001aa <_panic>
+
+00800ef0 <sys_fork>:
+  800ef0:	55                   	push   %ebp
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	57                   	push   %edi
+  800ef4:	56                   	push   %esi
+  800ef5:	53                   	push   %ebx
+  800ef6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f00:	89 d1                	mov    %edx,%ecx
+  800f02:	89 d3                	mov    %edx,%ebx
+  800f04:	89 d7                	mov    %edx,%edi
+  800f06:	89 d6                	mov    %edx,%esi
+  800f08:	cd 30                	int    $0x30
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+
+00800f0f <sys_env_set_status>:
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	57                   	push   %edi
+  800f13:	56                   	push   %esi
+  800f14:	53                   	push   %ebx
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+  800f18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f28:	89 df                	mov    %ebx,%edi
+  800f2a:	89 de                	mov    %ebx,%esi
+  800f2c:	cd 30                	int    $0x30
+  800f2e:	85 c0                	test   %eax,%eax
+  800f30:	7f 08                	jg     800f3a <sys_env_set_status+0x2b>
+  800f32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f35:	5b                   	pop    %ebx
+  800f36:	5e                   	pop    %esi
+  800f37:	5f                   	pop    %edi
+  800f38:	5d                   	pop    %ebp
+  800f39:	c3                   	ret
+  800f3a:	83 ec 0c             	sub    $0xc,%esp
+  800f3d:	50                   	push   %eax
+  800f3e:	6a 08                	push   $0x8
+  800f40:	68 0b 45 80 00       	push   $0x80450b
+  800f45:	6a 24                	push   $0x24
+  800f47:	68 28 45 80 00       	push   $0x804528
+  800f4c:	e8 59 f2 ff ff       	call   8001aa <_panic>
+
+00800f51 <sys_env_set_trapframe>:
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	57                   	push   %edi
+  800f55:	56                   	push   %esi
+  800f56:	53                   	push   %ebx
+  800f57:	83 ec 0c             	sub    $0xc,%esp
+  800f5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f65:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f6a:	89 df                	mov    %ebx,%edi
+  800f6c:	89 de                	mov    %ebx,%esi
+  800f6e:	cd 30                	int    $0x30
+  800f70:	85 c0                	test   %eax,%eax
+  800f72:	7f 08                	jg     800f7c <sys_env_set_trapframe+0x2b>
+  800f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f77:	5b                   	pop    %ebx
+  800f78:	5e                   	pop    %esi
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+  800f7f:	50                   	push   %eax
+  800f80:	6a 09                	push   $0x9
+  800f82:	68 0b 45 80 00       	push   $0x80450b
+  800f87:	6a 24                	push   $0x24
+  800f89:	68 28 45 80 00       	push   $0x804528
+  800f8e:	e8 17 f2 ff ff       	call   8001aa <_panic>
+
+00800f93 <sys_env_set_cow>:
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+  800f9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa7:	b8 20 00 00 00       	mov    $0x20,%eax
+  800fac:	89 df                	mov    %ebx,%edi
+  800fae:	89 de                	mov    %ebx,%esi
+  800fb0:	cd 30                	int    $0x30
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	7f 08                	jg     800fbe <sys_env_set_cow+0x2b>
+  800fb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  800fc1:	50                   	push   %eax
+  800fc2:	6a 20                	push   $0x20
+  800fc4:	68 0b 45 80 00       	push   $0x80450b
+  800fc9:	6a 24                	push   $0x24
+  800fcb:	68 28 45 80 00       	push   $0x804528
+  800fd0:	e8 d5 f1 ff ff       	call   8001aa <_panic>
+
+00800fd5 <sys_env_service>:
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	57                   	push   %edi
+  800fd9:	56                   	push   %esi
+  800fda:	53                   	push   %ebx
+  800fdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	b8 21 00 00 00       	mov    $0x21,%eax
+  800fe8:	89 cb                	mov    %ecx,%ebx
+  800fea:	89 cf                	mov    %ecx,%edi
+  800fec:	89 ce                	mov    %ecx,%esi
+  800fee:	cd 30                	int    $0x30
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_env_set_pgfault_upcall>:
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+  800ffe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80100e:	89 df                	mov    %ebx,%edi
+  801010:	89 de                	mov    %ebx,%esi
+  801012:	cd 30                	int    $0x30
+  801014:	85 c0                	test   %eax,%eax
+  801016:	7f 08                	jg     801020 <sys_env_set_pgfault_upcall+0x2b>
+  801018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+  801020:	83 ec 0c             	sub    $0xc,%esp
+  801023:	50                   	push   %eax
+  801024:	6a 0a                	push   $0xa
+  801026:	68 0b 45 80 00       	push   $0x80450b
+  80102b:	6a 24                	push   $0x24
+  80102d:	68 28 45 80 00       	push   $0x804528
+  801032:	e8 73 f1 ff ff       	call   8001aa <_panic>
+
+00801037 <sys_ipc_try_send>:
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+  80103d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801044:	74 27                	je     80106d <sys_ipc_try_send+0x36>
+  801046:	8b 55 08             	mov    0x8(%ebp),%edx
+  801049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801051:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801054:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801057:	6a 00                	push   $0x0
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	8d 35 64 10 80 00    	lea    0x801064,%esi
+  801062:	0f 34                	sysenter
+  801064:	5d                   	pop    %ebp
+  801065:	83 c4 04             	add    $0x4,%esp
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+  80106d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801072:	be 00 00 00 00       	mov    $0x0,%esi
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801080:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801083:	cd 30                	int    $0x30
+  801085:	eb e1                	jmp    801068 <sys_ipc_try_send+0x31>
+
+00801087 <sys_ipc_recv>:
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	56                   	push   %esi
+  80108c:	53                   	push   %ebx
+  80108d:	83 ec 0c             	sub    $0xc,%esp
+  801090:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801097:	74 32                	je     8010cb <sys_ipc_recv+0x44>
+  801099:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010a6:	89 cb                	mov    %ecx,%ebx
+  8010a8:	89 cf                	mov    %ecx,%edi
+  8010aa:	6a 00                	push   $0x0
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	8d 35 b7 10 80 00    	lea    0x8010b7,%esi
+  8010b5:	0f 34                	sysenter
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	83 c4 04             	add    $0x4,%esp
+  8010bb:	89 c2                	mov    %eax,%edx
+  8010bd:	85 c0                	test   %eax,%eax
+  8010bf:	7f 3c                	jg     8010fd <sys_ipc_recv+0x76>
+  8010c1:	89 d0                	mov    %edx,%eax
+  8010c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c6:	5b                   	pop    %ebx
+  8010c7:	5e                   	pop    %esi
+  8010c8:	5f                   	pop    %edi
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	c3                   	ret
+  8010cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	89 cb                	mov    %ecx,%ebx
+  8010da:	89 cf                	mov    %ecx,%edi
+  8010dc:	89 ce                	mov    %ecx,%esi
+  8010de:	cd 30                	int    $0x30
+  8010e0:	89 c2                	mov    %eax,%edx
+  8010e2:	85 c0                	test   %eax,%eax
+  8010e4:	7e db                	jle    8010c1 <sys_ipc_recv+0x3a>
+  8010e6:	83 ec 0c             	sub    $0xc,%esp
+  8010e9:	50                   	push   %eax
+  8010ea:	6a 0d                	push   $0xd
+  8010ec:	68 0b 45 80 00       	push   $0x80450b
+  8010f1:	6a 24                	push   $0x24
+  8010f3:	68 28 45 80 00       	push   $0x804528
+  8010f8:	e8 ad f0 ff ff       	call   8001aa <_panic>
+  8010fd:	83 ec 0c             	sub    $0xc,%esp
+  801100:	50                   	push   %eax
+  801101:	6a 0d                	push   $0xd
+  801103:	68 0b 45 80 00       	push   $0x80450b
+  801108:	6a 48                	push   $0x48
+  80110a:	68 28 45 80 00       	push   $0x804528
+  80110f:	e8 96 f0 ff ff       	call   8001aa <_panic>
+
+00801114 <sys_ipc_send>:
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	57                   	push   %edi
+  801118:	56                   	push   %esi
+  801119:	53                   	push   %ebx
+  80111a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801121:	74 27                	je     80114a <sys_ipc_send+0x36>
+  801123:	8b 55 08             	mov    0x8(%ebp),%edx
+  801126:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801129:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80112e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801131:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801134:	6a 00                	push   $0x0
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  801139:	8d 35 41 11 80 00    	lea    0x801141,%esi
+  80113f:	0f 34                	sysenter
+  801141:	5d                   	pop    %ebp
+  801142:	83 c4 04             	add    $0x4,%esp
+  801145:	5b                   	pop    %ebx
+  801146:	5e                   	pop    %esi
+  801147:	5f                   	pop    %edi
+  801148:	5d                   	pop    %ebp
+  801149:	c3                   	ret
+  80114a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80114f:	be 00 00 00 00       	mov    $0x0,%esi
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801160:	cd 30                	int    $0x30
+  801162:	eb e1                	jmp    801145 <sys_ipc_send+0x31>
+
+00801164 <sys_ipc_call>:
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801170:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801175:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801178:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80117e:	cd 30                	int    $0x30
+  801180:	5b                   	pop    %ebx
+  801181:	5e                   	pop    %esi
+  801182:	5f                   	pop    %edi
+  801183:	5d                   	pop    %ebp
+  801184:	c3                   	ret
+
+00801185 <sys_ipc_reply_recv>:
+  801185:	55                   	push   %ebp
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	57                   	push   %edi
+  801189:	56                   	push   %esi
+  80118a:	53                   	push   %ebx
+  80118b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801191:	b8 10 00 00 00       	mov    $0x10,%eax
+  801196:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801199:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80119f:	cd 30                	int    $0x30
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+
+008011a6 <sys_time_msec>:
+  8011a6:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8011ab:	85 c0                	test   %eax,%eax
+  8011ad:	75 06                	jne    8011b5 <sys_time_msec+0xf>
+  8011af:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8011b4:	c3                   	ret
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	57                   	push   %edi
+  8011b9:	56                   	push   %esi
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+  8011be:	0f 31                	rdtsc
+  8011c0:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8011c6:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8011cc:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8011d2:	29 c8                	sub    %ecx,%eax
+  8011d4:	19 da                	sbb    %ebx,%edx
+  8011d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011db:	57                   	push   %edi
+  8011dc:	56                   	push   %esi
+  8011dd:	52                   	push   %edx
+  8011de:	50                   	push   %eax
+  8011df:	e8 f4 2d 00 00       	call   803fd8 <__udivdi3>
+  8011e4:	83 c4 10             	add    $0x10,%esp
+  8011e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ea:	5b                   	pop    %ebx
+  8011eb:	5e                   	pop    %esi
+  8011ec:	5f                   	pop    %edi
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	c3                   	ret
+
+008011ef <sys_env_swap>:
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801200:	b8 12 00 00 00       	mov    $0x12,%eax
+  801205:	89 cb                	mov    %ecx,%ebx
+  801207:	89 cf                	mov    %ecx,%edi
+  801209:	89 ce                	mov    %ecx,%esi
+  80120b:	cd 30                	int    $0x30
+  80120d:	85 c0                	test   %eax,%eax
+  80120f:	7f 08                	jg     801219 <sys_env_swap+0x2a>
+  801211:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801214:	5b                   	pop    %ebx
+  801215:	5e                   	pop    %esi
+  801216:	5f                   	pop    %edi
+  801217:	5d                   	pop    %ebp
+  801218:	c3                   	ret
+  801219:	83 ec 0c             	sub    $0xc,%esp
+  80121c:	50                   	push   %eax
+  80121d:	6a 12                	push   $0x12
+  80121f:	68 0b 45 80 00       	push   $0x80450b
+  801224:	6a 24                	push   $0x24
+  801226:	68 28 45 80 00       	push   $0x804528
+  80122b:	e8 7a ef ff ff       	call   8001aa <_panic>
+
+00801230 <sys_net_try_send>:
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	57                   	push   %edi
+  801234:	56                   	push   %esi
+  801235:	53                   	push   %ebx
+  801236:	83 ec 0c             	sub    $0xc,%esp
+  801239:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801244:	b8 13 00 00 00       	mov    $0x13,%eax
+  801249:	89 df                	mov    %ebx,%edi
+  80124b:	89 de                	mov    %ebx,%esi
+  80124d:	cd 30                	int    $0x30
+  80124f:	85 c0                	test   %eax,%eax
+  801251:	7f 08                	jg     80125b <sys_net_try_send+0x2b>
+  801253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801256:	5b                   	pop    %ebx
+  801257:	5e                   	pop    %esi
+  801258:	5f                   	pop    %edi
+  801259:	5d                   	pop    %ebp
+  80125a:	c3                   	ret
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+  80125e:	50                   	push   %eax
+  80125f:	6a 13                	push   $0x13
+  801261:	68 0b 45 80 00       	push   $0x80450b
+  801266:	6a 24                	push   $0x24
+  801268:	68 28 45 80 00       	push   $0x804528
+  80126d:	e8 38 ef ff ff       	call   8001aa <_panic>
+
+00801272 <sys_net_try_receive>:
+  801272:	55                   	push   %ebp
+  801273:	89 e5                	mov    %esp,%ebp
+  801275:	57                   	push   %edi
+  801276:	56                   	push   %esi
+  801277:	53                   	push   %ebx
+  801278:	83 ec 0c             	sub    $0xc,%esp
+  80127b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801280:	8b 55 08             	mov    0x8(%ebp),%edx
+  801283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801286:	b8 14 00 00 00       	mov    $0x14,%eax
+  80128b:	89 df                	mov    %ebx,%edi
+  80128d:	89 de                	mov    %ebx,%esi
+  80128f:	cd 30                	int    $0x30
+  801291:	85 c0                	test   %eax,%eax
+  801293:	7f 08                	jg     80129d <sys_net_try_receive+0x2b>
+  801295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801298:	5b                   	pop    %ebx
+  801299:	5e                   	pop    %esi
+  80129a:	5f                   	pop    %edi
+  80129b:	5d                   	pop    %ebp
+  80129c:	c3                   	ret
+  80129d:	83 ec 0c             	sub    $0xc,%esp
+  8012a0:	50                   	push   %eax
+  8012a1:	6a 14                	push   $0x14
+  8012a3:	68 0b 45 80 00       	push   $0x80450b
+  8012a8:	6a 24                	push   $0x24
+  8012aa:	68 28 45 80 00       	push   $0x804528
+  8012af:	e8 f6 ee ff ff       	call   8001aa <_panic>
+
+008012b4 <sys_net_recv_page>:
+  8012b4:	55                   	push   %ebp
+  8012b5:	89 e5                	mov    %esp,%ebp
+  8012b7:	57                   	push   %edi
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+  8012ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c2:	b8 27 00 00 00       	mov    $0x27,%eax
+  8012c7:	89 cb                	mov    %ecx,%ebx
+  8012c9:	89 cf                	mov    %ecx,%edi
+  8012cb:	89 ce                	mov    %ecx,%esi
+  8012cd:	cd 30                	int    $0x30
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5e                   	pop    %esi
+  8012d1:	5f                   	pop    %edi
+  8012d2:	5d                   	pop    %ebp
+  8012d3:	c3                   	ret
+
+008012d4 <sys_net_wait>:
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+  8012da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012df:	b8 26 00 00 00       	mov    $0x26,%eax
+  8012e4:	89 d1                	mov    %edx,%ecx
+  8012e6:	89 d3                	mov    %edx,%ebx
+  8012e8:	89 d7                	mov    %edx,%edi
+  8012ea:	89 d6                	mov    %edx,%esi
+  8012ec:	cd 30                	int    $0x30
+  8012ee:	5b                   	pop    %ebx
+  8012ef:	5e                   	pop    %esi
+  8012f0:	5f                   	pop    %edi
+  8012f1:	5d                   	pop    %ebp
+  8012f2:	c3                   	ret
+
+008012f3 <sys_get_mac>:
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	57                   	push   %edi
+  8012f7:	56                   	push   %esi
+  8012f8:	53                   	push   %ebx
+  8012f9:	83 ec 0c             	sub    $0xc,%esp
+  8012fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801301:	8b 55 08             	mov    0x8(%ebp),%edx
+  801304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801307:	b8 15 00 00 00       	mov    $0x15,%eax
+  80130c:	89 df                	mov    %ebx,%edi
+  80130e:	89 de                	mov    %ebx,%esi
+  801310:	cd 30                	int    $0x30
+  801312:	85 c0                	test   %eax,%eax
+  801314:	7f 08                	jg     80131e <sys_get_mac+0x2b>
+  801316:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5f                   	pop    %edi
+  80131c:	5d                   	pop    %ebp
+  80131d:	c3                   	ret
+  80131e:	83 ec 0c             	sub    $0xc,%esp
+  801321:	50                   	push   %eax
+  801322:	6a 15                	push   $0x15
+  801324:	68 0b 45 80 00       	push   $0x80450b
+  801329:	6a 24                	push   $0x24
+  80132b:	68 28 45 80 00       	push   $0x804528
+  801330:	e8 75 ee ff ff       	call   8001aa <_panic>
+
+00801335 <sys_env_lease>:
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	57                   	push   %edi
+  801339:	56                   	push   %esi
+  80133a:	53                   	push   %ebx
+  80133b:	83 ec 0c             	sub    $0xc,%esp
+  80133e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801343:	8b 55 08             	mov    0x8(%ebp),%edx
+  801346:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801349:	b8 16 00 00 00       	mov    $0x16,%eax
+  80134e:	89 df                	mov    %ebx,%edi
+  801350:	89 de                	mov    %ebx,%esi
+  801352:	cd 30                	int    $0x30
+  801354:	85 c0                	test   %eax,%eax
+  801356:	7f 08                	jg     801360 <sys_env_lease+0x2b>
+  801358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135b:	5b                   	pop    %ebx
+  80135c:	5e                   	pop    %esi
+  80135d:	5f                   	pop    %edi
+  80135e:	5d                   	pop    %ebp
+  80135f:	c3                   	ret
+  801360:	83 ec 0c             	sub    $0xc,%esp
+  801363:	50                   	push   %eax
+  801364:	6a 16                	push   $0x16
+  801366:	68 0b 45 80 00       	push   $0x80450b
+  80136b:	6a 24                	push   $0x24
+  80136d:	68 28 45 80 00       	push   $0x804528
+  801372:	e8 33 ee ff ff       	call   8001aa <_panic>
+
+00801377 <sys_copy_mem>:
+  801377:	55                   	push   %ebp
+  801378:	89 e5                	mov    %esp,%ebp
+  80137a:	57                   	push   %edi
+  80137b:	56                   	push   %esi
+  80137c:	53                   	push   %ebx
+  80137d:	83 ec 0c             	sub    $0xc,%esp
+  801380:	8b 55 08             	mov    0x8(%ebp),%edx
+  801383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801386:	b8 17 00 00 00       	mov    $0x17,%eax
+  80138b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80138e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801391:	8b 75 18             	mov    0x18(%ebp),%esi
+  801394:	cd 30                	int    $0x30
+  801396:	85 c0                	test   %eax,%eax
+  801398:	7f 08                	jg     8013a2 <sys_copy_mem+0x2b>
+  80139a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139d:	5b                   	pop    %ebx
+  80139e:	5e                   	pop    %esi
+  80139f:	5f                   	pop    %edi
+  8013a0:	5d                   	pop    %ebp
+  8013a1:	c3                   	ret
+  8013a2:	83 ec 0c             	sub    $0xc,%esp
+  8013a5:	50                   	push   %eax
+  8013a6:	6a 17                	push   $0x17
+  8013a8:	68 0b 45 80 00       	push   $0x80450b
+  8013ad:	6a 24                	push   $0x24
+  8013af:	68 28 45 80 00       	push   $0x804528
+  8013b4:	e8 f1 ed ff ff       	call   8001aa <_panic>
+
+008013b9 <sys_get_perms>:
+  8013b9:	55                   	push   %ebp
+  8013ba:	89 e5                	mov    %esp,%ebp
+  8013bc:	57                   	push   %edi
+  8013bd:	56                   	push   %esi
+  8013be:	53                   	push   %ebx
+  8013bf:	83 ec 0c             	sub    $0xc,%esp
+  8013c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cd:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d5:	89 f7                	mov    %esi,%edi
+  8013d7:	cd 30                	int    $0x30
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	7f 08                	jg     8013e5 <sys_get_perms+0x2c>
+  8013dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e0:	5b                   	pop    %ebx
+  8013e1:	5e                   	pop    %esi
+  8013e2:	5f                   	pop    %edi
+  8013e3:	5d                   	pop    %ebp
+  8013e4:	c3                   	ret
+  8013e5:	83 ec 0c             	sub    $0xc,%esp
+  8013e8:	50                   	push   %eax
+  8013e9:	6a 18                	push   $0x18
+  8013eb:	68 0b 45 80 00       	push   $0x80450b
+  8013f0:	6a 24                	push   $0x24
+  8013f2:	68 28 45 80 00       	push   $0x804528
+  8013f7:	e8 ae ed ff ff       	call   8001aa <_panic>
+
+008013fc <sys_env_unsuspend>:
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	57                   	push   %edi
+  801400:	56                   	push   %esi
+  801401:	53                   	push   %ebx
+  801402:	83 ec 0c             	sub    $0xc,%esp
+  801405:	be 00 00 00 00       	mov    $0x0,%esi
+  80140a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801410:	b8 19 00 00 00       	mov    $0x19,%eax
+  801415:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801418:	89 f7                	mov    %esi,%edi
+  80141a:	cd 30                	int    $0x30
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	7f 08                	jg     801428 <sys_env_unsuspend+0x2c>
+  801420:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801423:	5b                   	pop    %ebx
+  801424:	5e                   	pop    %esi
+  801425:	5f                   	pop    %edi
+  801426:	5d                   	pop    %ebp
+  801427:	c3                   	ret
+  801428:	83 ec 0c             	sub    $0xc,%esp
+  80142b:	50                   	push   %eax
+  80142c:	6a 19                	push   $0x19
+  80142e:	68 0b 45 80 00       	push   $0x80450b
+  801433:	6a 24                	push   $0x24
+  801435:	68 28 45 80 00       	push   $0x804528
+  80143a:	e8 6b ed ff ff       	call   8001aa <_panic>
+
+0080143f <sys_migrate>:
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	57                   	push   %edi
+  801443:	56                   	push   %esi
+  801444:	53                   	push   %ebx
+  801445:	83 ec 0c             	sub    $0xc,%esp
+  801448:	ba 04 90 80 00       	mov    $0x809004,%edx
+  80144d:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801453:	76 11                	jbe    801466 <sys_migrate+0x27>
+  801455:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80145a:	0f b6 08             	movzbl (%eax),%ecx
+  80145d:	05 00 10 00 00       	add    $0x1000,%eax
+  801462:	39 d0                	cmp    %edx,%eax
+  801464:	72 f4                	jb     80145a <sys_migrate+0x1b>
+  801466:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801473:	89 cb                	mov    %ecx,%ebx
+  801475:	89 cf                	mov    %ecx,%edi
+  801477:	89 ce                	mov    %ecx,%esi
+  801479:	cd 30                	int    $0x30
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	7f 08                	jg     801487 <sys_migrate+0x48>
+  80147f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801482:	5b                   	pop    %ebx
+  801483:	5e                   	pop    %esi
+  801484:	5f                   	pop    %edi
+  801485:	5d                   	pop    %ebp
+  801486:	c3                   	ret
+  801487:	83 ec 0c             	sub    $0xc,%esp
+  80148a:	50                   	push   %eax
+  80148b:	6a 1a                	push   $0x1a
+  80148d:	68 0b 45 80 00       	push   $0x80450b
+  801492:	6a 24                	push   $0x24
+  801494:	68 28 45 80 00       	push   $0x804528
+  801499:	e8 0c ed ff ff       	call   8001aa <_panic>
+
+0080149e <sys_lease_complete>:
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	57                   	push   %edi
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+  8014a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014b1:	89 d1                	mov    %edx,%ecx
+  8014b3:	89 d3                	mov    %edx,%ebx
+  8014b5:	89 d7                	mov    %edx,%edi
+  8014b7:	89 d6                	mov    %edx,%esi
+  8014b9:	cd 30                	int    $0x30
+  8014bb:	85 c0                	test   %eax,%eax
+  8014bd:	7f 08                	jg     8014c7 <sys_lease_complete+0x29>
+  8014bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c2:	5b                   	pop    %ebx
+  8014c3:	5e                   	pop    %esi
+  8014c4:	5f                   	pop    %edi
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+  8014c7:	83 ec 0c             	sub    $0xc,%esp
+  8014ca:	50                   	push   %eax
+  8014cb:	6a 1b                	push   $0x1b
+  8014cd:	68 0b 45 80 00       	push   $0x80450b
+  8014d2:	6a 24                	push   $0x24
+  8014d4:	68 28 45 80 00       	push   $0x804528
+  8014d9:	e8 cc ec ff ff       	call   8001aa <_panic>
+
+008014de <sys_env_set_thisenv>:
+  8014de:	55                   	push   %ebp
+  8014df:	89 e5                	mov    %esp,%ebp
+  8014e1:	57                   	push   %edi
+  8014e2:	56                   	push   %esi
+  8014e3:	53                   	push   %ebx
+  8014e4:	83 ec 0c             	sub    $0xc,%esp
+  8014e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014f7:	89 df                	mov    %ebx,%edi
+  8014f9:	89 de                	mov    %ebx,%esi
+  8014fb:	cd 30                	int    $0x30
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	7f 08                	jg     801509 <sys_env_set_thisenv+0x2b>
+  801501:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801504:	5b                   	pop    %ebx
+  801505:	5e                   	pop    %esi
+  801506:	5f                   	pop    %edi
+  801507:	5d                   	pop    %ebp
+  801508:	c3                   	ret
+  801509:	83 ec 0c             	sub    $0xc,%esp
+  80150c:	50                   	push   %eax
+  80150d:	6a 1c                	push   $0x1c
+  80150f:	68 0b 45 80 00       	push   $0x80450b
+  801514:	6a 24                	push   $0x24
+  801516:	68 28 45 80 00       	push   $0x804528
+  80151b:	e8 8a ec ff ff       	call   8001aa <_panic>
+
+00801520 <sys_env_set_sched>:
+  801520:	55                   	push   %ebp
+  801521:	89 e5                	mov    %esp,%ebp
+  801523:	57                   	push   %edi
+  801524:	56                   	push   %esi
+  801525:	53                   	push   %ebx
+  801526:	83 ec 0c             	sub    $0xc,%esp
+  801529:	be 00 00 00 00       	mov    $0x0,%esi
+  80152e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801531:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801534:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801539:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153c:	89 f7                	mov    %esi,%edi
+  80153e:	cd 30                	int    $0x30
+  801540:	85 c0                	test   %eax,%eax
+  801542:	7f 08                	jg     80154c <sys_env_set_sched+0x2c>
+  801544:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801547:	5b                   	pop    %ebx
+  801548:	5e                   	pop    %esi
+  801549:	5f                   	pop    %edi
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+  80154c:	83 ec 0c             	sub    $0xc,%esp
+  80154f:	50                   	push   %eax
+  801550:	6a 1d                	push   $0x1d
+  801552:	68 0b 45 80 00       	push   $0x80450b
+  801557:	6a 24                	push   $0x24
+  801559:	68 28 45 80 00       	push   $0x804528
+  80155e:	e8 47 ec ff ff       	call   8001aa <_panic>
+
+00801563 <sys_batch>:
+  801563:	55                   	push   %ebp
+  801564:	89 e5                	mov    %esp,%ebp
+  801566:	57                   	push   %edi
+  801567:	56                   	push   %esi
+  801568:	53                   	push   %ebx
+  801569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801571:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801574:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801579:	89 df                	mov    %ebx,%edi
+  80157b:	89 de                	mov    %ebx,%esi
+  80157d:	cd 30                	int    $0x30
+  80157f:	5b                   	pop    %ebx
+  801580:	5e                   	pop    %esi
+  801581:	5f                   	pop    %edi
+  801582:	5d                   	pop    %ebp
+  801583:	c3                   	ret
+
+00801584 <sys_env_stats>:
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	57                   	push   %edi
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+  80158a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801595:	b8 23 00 00 00       	mov    $0x23,%eax
+  80159a:	89 df                	mov    %ebx,%edi
+  80159c:	89 de                	mov    %ebx,%esi
+  80159e:	cd 30                	int    $0x30
+  8015a0:	5b                   	pop    %ebx
+  8015a1:	5e                   	pop    %esi
+  8015a2:	5f                   	pop    %edi
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+
+008015a5 <sys_trace>:
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+  8015ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b3:	b8 24 00 00 00       	mov    $0x24,%eax
+  8015b8:	89 cb                	mov    %ecx,%ebx
+  8015ba:	89 cf                	mov    %ecx,%edi
+  8015bc:	89 ce                	mov    %ecx,%esi
+  8015be:	cd 30                	int    $0x30
+  8015c0:	5b                   	pop    %ebx
+  8015c1:	5e                   	pop    %esi
+  8015c2:	5f                   	pop    %edi
+  8015c3:	5d                   	pop    %ebp
+  8015c4:	c3                   	ret
+
+008015c5 <sys_env_set_pager>:
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	57                   	push   %edi
+  8015c9:	56                   	push   %esi
+  8015ca:	53                   	push   %ebx
+  8015cb:	83 ec 0c             	sub    $0xc,%esp
+  8015ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d9:	b8 25 00 00 00       	mov    $0x25,%eax
+  8015de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e1:	89 f7                	mov    %esi,%edi
+  8015e3:	cd 30                	int    $0x30
+  8015e5:	85 c0                	test   %eax,%eax
+  8015e7:	7f 08                	jg     8015f1 <sys_env_set_pager+0x2c>
+  8015e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ec:	5b                   	pop    %ebx
+  8015ed:	5e                   	pop    %esi
+  8015ee:	5f                   	pop    %edi
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	c3                   	ret
+  8015f1:	83 ec 0c             	sub    $0xc,%esp
+  8015f4:	50                   	push   %eax
+  8015f5:	6a 25                	push   $0x25
+  8015f7:	68 0b 45 80 00       	push   $0x80450b
+  8015fc:	6a 24                	push   $0x24
+  8015fe:	68 28 45 80 00       	push   $0x804528
+  801603:	e8 a2 eb ff ff       	call   8001aa <_panic>
+
+00801608 <sys_pager_retire>:
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	57                   	push   %edi
+  80160c:	56                   	push   %esi
+  80160d:	53                   	push   %ebx
+  80160e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801613:	8b 55 08             	mov    0x8(%ebp),%edx
+  801616:	b8 28 00 00 00       	mov    $0x28,%eax
+  80161b:	89 cb                	mov    %ecx,%ebx
+  80161d:	89 cf                	mov    %ecx,%edi
+  80161f:	89 ce                	mov    %ecx,%esi
+  801621:	cd 30                	int    $0x30
+  801623:	5b                   	pop    %ebx
+  801624:	5e                   	pop    %esi
+  801625:	5f                   	pop    %edi
+  801626:	5d                   	pop    %ebp
+  801627:	c3                   	ret
+
+00801628 <sys_prof>:
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	57                   	push   %edi
+  80162c:	56                   	push   %esi
+  80162d:	53                   	push   %ebx
+  80162e:	be 00 00 00 00       	mov    $0x0,%esi
+  801633:	8b 55 08             	mov    0x8(%ebp),%edx
+  801636:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801639:	b8 22 00 00 00       	mov    $0x22,%eax
+  80163e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801641:	89 f7                	mov    %esi,%edi
+  801643:	cd 30                	int    $0x30
+  801645:	5b                   	pop    %ebx
+  801646:	5e                   	pop    %esi
+  801647:	5f                   	pop    %edi
+  801648:	5d                   	pop    %ebp
+  801649:	c3                   	ret
+
+0080164a <fd2num>:
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  80164d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801650:	05 00 00 00 30       	add    $0x30000000,%eax
+  801655:	c1 e8 0c             	shr    $0xc,%eax
+  801658:	5d                   	pop    %ebp
+  801659:	c3                   	ret
+
+0080165a <fd2data>:
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801660:	05 00 00 00 30       	add    $0x30000000,%eax
+  801665:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80166a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  80166f:	5d                   	pop    %ebp
+  801670:	c3                   	ret
+
+00801671 <fd_alloc>:
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801679:	89 c2                	mov    %eax,%edx
+  80167b:	c1 ea 16             	shr    $0x16,%edx
+  80167e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801685:	f6 c2 01             	test   $0x1,%dl
+  801688:	74 29                	je     8016b3 <fd_alloc+0x42>
+  80168a:	89 c2                	mov    %eax,%edx
+  80168c:	c1 ea 0c             	shr    $0xc,%edx
+  80168f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801696:	f6 c2 01             	test   $0x1,%dl
+  801699:	74 18                	je     8016b3 <fd_alloc+0x42>
+  80169b:	05 00 10 00 00       	add    $0x1000,%eax
+  8016a0:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8016a5:	75 d2                	jne    801679 <fd_alloc+0x8>
+  8016a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ac:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016b1:	eb 05                	jmp    8016b8 <fd_alloc+0x47>
+  8016b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bb:	89 02                	mov    %eax,(%edx)
+  8016bd:	89 c8                	mov    %ecx,%eax
+  8016bf:	5d                   	pop    %ebp
+  8016c0:	c3                   	ret
+
+008016c1 <fd_lookup>:
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c7:	83 f8 1f             	cmp    $0x1f,%eax
+  8016ca:	77 30                	ja     8016fc <fd_lookup+0x3b>
+  8016cc:	c1 e0 0c             	shl    $0xc,%eax
+  8016cf:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8016d4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016da:	f6 c2 01             	test   $0x1,%dl
+  8016dd:	74 24                	je     801703 <fd_lookup+0x42>
+  8016df:	89 c2                	mov    %eax,%edx
+  8016e1:	c1 ea 0c             	shr    $0xc,%edx
+  8016e4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016eb:	f6 c2 01             	test   $0x1,%dl
+  8016ee:	74 1a                	je     80170a <fd_lookup+0x49>
+  8016f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016f3:	89 02                	mov    %eax,(%edx)
+  8016f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fa:	5d                   	pop    %ebp
+  8016fb:	c3                   	ret
+  8016fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801701:	eb f7                	jmp    8016fa <fd_lookup+0x39>
+  801703:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801708:	eb f0                	jmp    8016fa <fd_lookup+0x39>
+  80170a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80170f:	eb e9                	jmp    8016fa <fd_lookup+0x39>
+
+00801711 <dev_lookup>:
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	53                   	push   %ebx
+  801715:	83 ec 04             	sub    $0x4,%esp
+  801718:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801720:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801725:	39 13                	cmp    %edx,(%ebx)
+  801727:	74 37                	je     801760 <dev_lookup+0x4f>
+  801729:	83 c0 01             	add    $0x1,%eax
+  80172c:	8b 1c 85 b4 45 80 00 	mov    0x8045b4(,%eax,4),%ebx
+  801733:	85 db                	test   %ebx,%ebx
+  801735:	75 ee                	jne    801725 <dev_lookup+0x14>
+  801737:	a1 14 60 80 00       	mov    0x806014,%eax
+  80173c:	8b 40 48             	mov    0x48(%eax),%eax
+  80173f:	83 ec 04             	sub    $0x4,%esp
+  801742:	52                   	push   %edx
+  801743:	50                   	push   %eax
+  801744:	68 38 45 80 00       	push   $0x804538
+  801749:	e8 37 eb ff ff       	call   800285 <cprintf>
+  80174e:	83 c4 10             	add    $0x10,%esp
+  801751:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801756:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801759:	89 1a                	mov    %ebx,(%edx)
+  80175b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80175e:	c9                   	leave
+  80175f:	c3                   	ret
+  801760:	b8 00 00 00 00       	mov    $0x0,%eax
+  801765:	eb ef                	jmp    801756 <dev_lookup+0x45>
+
+00801767 <fd_close>:
+  801767:	55                   	push   %ebp
+  801768:	89 e5                	mov    %esp,%ebp
+  80176a:	57                   	push   %edi
+  80176b:	56                   	push   %esi
+  80176c:	53                   	push   %ebx
+  80176d:	83 ec 24             	sub    $0x24,%esp
+  801770:	8b 75 08             	mov    0x8(%ebp),%esi
+  801773:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801776:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801779:	50                   	push   %eax
+  80177a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801780:	c1 e8 0c             	shr    $0xc,%eax
+  801783:	50                   	push   %eax
+  801784:	e8 38 ff ff ff       	call   8016c1 <fd_lookup>
+  801789:	89 c3                	mov    %eax,%ebx
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	85 c0                	test   %eax,%eax
+  801790:	78 05                	js     801797 <fd_close+0x30>
+  801792:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801795:	74 0f                	je     8017a6 <fd_close+0x3f>
+  801797:	85 ff                	test   %edi,%edi
+  801799:	0f 44 df             	cmove  %edi,%ebx
+  80179c:	89 d8                	mov    %ebx,%eax
+  80179e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a1:	5b                   	pop    %ebx
+  8017a2:	5e                   	pop    %esi
+  8017a3:	5f                   	pop    %edi
+  8017a4:	5d                   	pop    %ebp
+  8017a5:	c3                   	ret
+  8017a6:	83 ec 08             	sub    $0x8,%esp
+  8017a9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017ac:	50                   	push   %eax
+  8017ad:	ff 36                	push   (%esi)
+  8017af:	e8 5d ff ff ff       	call   801711 <dev_lookup>
+  8017b4:	89 c3                	mov    %eax,%ebx
+  8017b6:	83 c4 10             	add    $0x10,%esp
+  8017b9:	85 c0                	test   %eax,%eax
+  8017bb:	78 1a                	js     8017d7 <fd_close+0x70>
+  8017bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017c0:	8b 40 10             	mov    0x10(%eax),%eax
+  8017c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	74 0b                	je     8017d7 <fd_close+0x70>
+  8017cc:	83 ec 0c             	sub    $0xc,%esp
+  8017cf:	56                   	push   %esi
+  8017d0:	ff d0                	call   *%eax
+  8017d2:	89 c3                	mov    %eax,%ebx
+  8017d4:	83 c4 10             	add    $0x10,%esp
+  8017d7:	83 ec 08             	sub    $0x8,%esp
+  8017da:	56                   	push   %esi
+  8017db:	6a 00                	push   $0x0
+  8017dd:	e8 cc f6 ff ff       	call   800eae <sys_page_unmap>
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	eb b5                	jmp    80179c <fd_close+0x35>
+
+008017e7 <close>:
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	83 ec 20             	sub    $0x20,%esp
+  8017ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f0:	50                   	push   %eax
+  8017f1:	ff 75 08             	push   0x8(%ebp)
+  8017f4:	e8 c8 fe ff ff       	call   8016c1 <fd_lookup>
+  8017f9:	83 c4 10             	add    $0x10,%esp
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	79 02                	jns    801802 <close+0x1b>
+  801800:	c9                   	leave
+  801801:	c3                   	ret
+  801802:	83 ec 08             	sub    $0x8,%esp
+  801805:	6a 01                	push   $0x1
+  801807:	ff 75 f4             	push   -0xc(%ebp)
+  80180a:	e8 58 ff ff ff       	call   801767 <fd_close>
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	eb ec                	jmp    801800 <close+0x19>
+
+00801814 <close_all>:
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	53                   	push   %ebx
+  801818:	83 ec 04             	sub    $0x4,%esp
+  80181b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801820:	83 ec 0c             	sub    $0xc,%esp
+  801823:	53                   	push   %ebx
+  801824:	e8 be ff ff ff       	call   8017e7 <close>
+  801829:	83 c3 01             	add    $0x1,%ebx
+  80182c:	83 c4 10             	add    $0x10,%esp
+  80182f:	83 fb 20             	cmp    $0x20,%ebx
+  801832:	75 ec                	jne    801820 <close_all+0xc>
+  801834:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801837:	c9                   	leave
+  801838:	c3                   	ret
+
+00801839 <dup>:
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	57                   	push   %edi
+  80183d:	56                   	push   %esi
+  80183e:	53                   	push   %ebx
+  80183f:	83 ec 34             	sub    $0x34,%esp
+  801842:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801845:	50                   	push   %eax
+  801846:	ff 75 08             	push   0x8(%ebp)
+  801849:	e8 73 fe ff ff       	call   8016c1 <fd_lookup>
+  80184e:	89 c3                	mov    %eax,%ebx
+  801850:	83 c4 10             	add    $0x10,%esp
+  801853:	85 c0                	test   %eax,%eax
+  801855:	78 7f                	js     8018d6 <dup+0x9d>
+  801857:	83 ec 0c             	sub    $0xc,%esp
+  80185a:	ff 75 0c             	push   0xc(%ebp)
+  80185d:	e8 85 ff ff ff       	call   8017e7 <close>
+  801862:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801865:	c1 e6 0c             	shl    $0xc,%esi
+  801868:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80186e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801871:	89 3c 24             	mov    %edi,(%esp)
+  801874:	e8 e1 fd ff ff       	call   80165a <fd2data>
+  801879:	89 c3                	mov    %eax,%ebx
+  80187b:	89 34 24             	mov    %esi,(%esp)
+  80187e:	e8 d7 fd ff ff       	call   80165a <fd2data>
+  801883:	83 c4 10             	add    $0x10,%esp
+  801886:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801889:	89 d8                	mov    %ebx,%eax
+  80188b:	c1 e8 16             	shr    $0x16,%eax
+  80188e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801895:	a8 01                	test   $0x1,%al
+  801897:	74 11                	je     8018aa <dup+0x71>
+  801899:	89 d8                	mov    %ebx,%eax
+  80189b:	c1 e8 0c             	shr    $0xc,%eax
+  80189e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018a5:	f6 c2 01             	test   $0x1,%dl
+  8018a8:	75 36                	jne    8018e0 <dup+0xa7>
+  8018aa:	89 f8                	mov    %edi,%eax
+  8018ac:	c1 e8 0c             	shr    $0xc,%eax
+  8018af:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018b6:	83 ec 0c             	sub    $0xc,%esp
+  8018b9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018be:	50                   	push   %eax
+  8018bf:	56                   	push   %esi
+  8018c0:	6a 00                	push   $0x0
+  8018c2:	57                   	push   %edi
+  8018c3:	6a 00                	push   $0x0
+  8018c5:	e8 55 f5 ff ff       	call   800e1f <sys_page_map>
+  8018ca:	89 c3                	mov    %eax,%ebx
+  8018cc:	83 c4 20             	add    $0x20,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 33                	js     801906 <dup+0xcd>
+  8018d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8018d6:	89 d8                	mov    %ebx,%eax
+  8018d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018db:	5b                   	pop    %ebx
+  8018dc:	5e                   	pop    %esi
+  8018dd:	5f                   	pop    %edi
+  8018de:	5d                   	pop    %ebp
+  8018df:	c3                   	ret
+  8018e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018e7:	83 ec 0c             	sub    $0xc,%esp
+  8018ea:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018ef:	50                   	push   %eax
+  8018f0:	ff 75 d4             	push   -0x2c(%ebp)
+  8018f3:	6a 00                	push   $0x0
+  8018f5:	53                   	push   %ebx
+  8018f6:	6a 00                	push   $0x0
+  8018f8:	e8 22 f5 ff ff       	call   800e1f <sys_page_map>
+  8018fd:	89 c3                	mov    %eax,%ebx
+  8018ff:	83 c4 20             	add    $0x20,%esp
+  801902:	85 c0                	test   %eax,%eax
+  801904:	79 a4                	jns    8018aa <dup+0x71>
+  801906:	83 ec 08             	sub    $0x8,%esp
+  801909:	56                   	push   %esi
+  80190a:	6a 00                	push   $0x0
+  80190c:	e8 9d f5 ff ff       	call   800eae <sys_page_unmap>
+  801911:	83 c4 08             	add    $0x8,%esp
+  801914:	ff 75 d4             	push   -0x2c(%ebp)
+  801917:	6a 00                	push   $0x0
+  801919:	e8 90 f5 ff ff       	call   800eae <sys_page_unmap>
+  80191e:	83 c4 10             	add    $0x10,%esp
+  801921:	eb b3                	jmp    8018d6 <dup+0x9d>
+
+00801923 <read>:
+  801923:	55                   	push   %ebp
+  801924:	89 e5                	mov    %esp,%ebp
+  801926:	56                   	push   %esi
+  801927:	53                   	push   %ebx
+  801928:	83 ec 18             	sub    $0x18,%esp
+  80192b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80192e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801931:	50                   	push   %eax
+  801932:	56                   	push   %esi
+  801933:	e8 89 fd ff ff       	call   8016c1 <fd_lookup>
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	78 3c                	js     80197b <read+0x58>
+  80193f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801942:	83 ec 08             	sub    $0x8,%esp
+  801945:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801948:	50                   	push   %eax
+  801949:	ff 33                	push   (%ebx)
+  80194b:	e8 c1 fd ff ff       	call   801711 <dev_lookup>
+  801950:	83 c4 10             	add    $0x10,%esp
+  801953:	85 c0                	test   %eax,%eax
+  801955:	78 24                	js     80197b <read+0x58>
+  801957:	8b 43 08             	mov    0x8(%ebx),%eax
+  80195a:	83 e0 03             	and    $0x3,%eax
+  80195d:	83 f8 01             	cmp    $0x1,%eax
+  801960:	74 20                	je     801982 <read+0x5f>
+  801962:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801965:	8b 40 08             	mov    0x8(%eax),%eax
+  801968:	85 c0                	test   %eax,%eax
+  80196a:	74 37                	je     8019a3 <read+0x80>
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	ff 75 10             	push   0x10(%ebp)
+  801972:	ff 75 0c             	push   0xc(%ebp)
+  801975:	53                   	push   %ebx
+  801976:	ff d0                	call   *%eax
+  801978:	83 c4 10             	add    $0x10,%esp
+  80197b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197e:	5b                   	pop    %ebx
+  80197f:	5e                   	pop    %esi
+  801980:	5d                   	pop    %ebp
+  801981:	c3                   	ret
+  801982:	a1 14 60 80 00       	mov    0x806014,%eax
+  801987:	8b 40 48             	mov    0x48(%eax),%eax
+  80198a:	83 ec 04             	sub    $0x4,%esp
+  80198d:	56                   	push   %esi
+  80198e:	50                   	push   %eax
+  80198f:	68 79 45 80 00       	push   $0x804579
+  801994:	e8 ec e8 ff ff       	call   800285 <cprintf>
+  801999:	83 c4 10             	add    $0x10,%esp
+  80199c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a1:	eb d8                	jmp    80197b <read+0x58>
+  8019a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019a8:	eb d1                	jmp    80197b <read+0x58>
+
+008019aa <readn>:
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	57                   	push   %edi
+  8019ae:	56                   	push   %esi
+  8019af:	53                   	push   %ebx
+  8019b0:	83 ec 0c             	sub    $0xc,%esp
+  8019b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8019b6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8019b9:	85 f6                	test   %esi,%esi
+  8019bb:	74 30                	je     8019ed <readn+0x43>
+  8019bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c7:	83 ec 04             	sub    $0x4,%esp
+  8019ca:	89 f2                	mov    %esi,%edx
+  8019cc:	29 c2                	sub    %eax,%edx
+  8019ce:	52                   	push   %edx
+  8019cf:	01 f8                	add    %edi,%eax
+  8019d1:	50                   	push   %eax
+  8019d2:	ff 75 08             	push   0x8(%ebp)
+  8019d5:	e8 49 ff ff ff       	call   801923 <read>
+  8019da:	83 c4 10             	add    $0x10,%esp
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	78 15                	js     8019f6 <readn+0x4c>
+  8019e1:	74 11                	je     8019f4 <readn+0x4a>
+  8019e3:	01 c3                	add    %eax,%ebx
+  8019e5:	89 d8                	mov    %ebx,%eax
+  8019e7:	39 f3                	cmp    %esi,%ebx
+  8019e9:	72 dc                	jb     8019c7 <readn+0x1d>
+  8019eb:	eb 09                	jmp    8019f6 <readn+0x4c>
+  8019ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f2:	eb 02                	jmp    8019f6 <readn+0x4c>
+  8019f4:	89 d8                	mov    %ebx,%eax
+  8019f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f9:	5b                   	pop    %ebx
+  8019fa:	5e                   	pop    %esi
+  8019fb:	5f                   	pop    %edi
+  8019fc:	5d                   	pop    %ebp
+  8019fd:	c3                   	ret
+
+008019fe <write>:
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	56                   	push   %esi
+  801a02:	53                   	push   %ebx
+  801a03:	83 ec 18             	sub    $0x18,%esp
+  801a06:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a09:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a0c:	50                   	push   %eax
+  801a0d:	53                   	push   %ebx
+  801a0e:	e8 ae fc ff ff       	call   8016c1 <fd_lookup>
+  801a13:	83 c4 10             	add    $0x10,%esp
+  801a16:	85 c0                	test   %eax,%eax
+  801a18:	78 37                	js     801a51 <write+0x53>
+  801a1a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a1d:	83 ec 08             	sub    $0x8,%esp
+  801a20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a23:	50                   	push   %eax
+  801a24:	ff 36                	push   (%esi)
+  801a26:	e8 e6 fc ff ff       	call   801711 <dev_lookup>
+  801a2b:	83 c4 10             	add    $0x10,%esp
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	78 1f                	js     801a51 <write+0x53>
+  801a32:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a36:	74 20                	je     801a58 <write+0x5a>
+  801a38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	74 37                	je     801a79 <write+0x7b>
+  801a42:	83 ec 04             	sub    $0x4,%esp
+  801a45:	ff 75 10             	push   0x10(%ebp)
+  801a48:	ff 75 0c             	push   0xc(%ebp)
+  801a4b:	56                   	push   %esi
+  801a4c:	ff d0                	call   *%eax
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a54:	5b                   	pop    %ebx
+  801a55:	5e                   	pop    %esi
+  801a56:	5d                   	pop    %ebp
+  801a57:	c3                   	ret
+  801a58:	a1 14 60 80 00       	mov    0x806014,%eax
+  801a5d:	8b 40 48             	mov    0x48(%eax),%eax
+  801a60:	83 ec 04             	sub    $0x4,%esp
+  801a63:	53                   	push   %ebx
+  801a64:	50                   	push   %eax
+  801a65:	68 95 45 80 00       	push   $0x804595
+  801a6a:	e8 16 e8 ff ff       	call   800285 <cprintf>
+  801a6f:	83 c4 10             	add    $0x10,%esp
+  801a72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a77:	eb d8                	jmp    801a51 <write+0x53>
+  801a79:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a7e:	eb d1                	jmp    801a51 <write+0x53>
+
+00801a80 <seek>:
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	83 ec 20             	sub    $0x20,%esp
+  801a86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a89:	50                   	push   %eax
+  801a8a:	ff 75 08             	push   0x8(%ebp)
+  801a8d:	e8 2f fc ff ff       	call   8016c1 <fd_lookup>
+  801a92:	83 c4 10             	add    $0x10,%esp
+  801a95:	85 c0                	test   %eax,%eax
+  801a97:	78 0e                	js     801aa7 <seek+0x27>
+  801a99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a9f:	89 50 04             	mov    %edx,0x4(%eax)
+  801aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa7:	c9                   	leave
+  801aa8:	c3                   	ret
+
+00801aa9 <ftruncate>:
+  801aa9:	55                   	push   %ebp
+  801aaa:	89 e5                	mov    %esp,%ebp
+  801aac:	56                   	push   %esi
+  801aad:	53                   	push   %ebx
+  801aae:	83 ec 18             	sub    $0x18,%esp
+  801ab1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ab4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ab7:	50                   	push   %eax
+  801ab8:	53                   	push   %ebx
+  801ab9:	e8 03 fc ff ff       	call   8016c1 <fd_lookup>
+  801abe:	83 c4 10             	add    $0x10,%esp
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	78 34                	js     801af9 <ftruncate+0x50>
+  801ac5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ac8:	83 ec 08             	sub    $0x8,%esp
+  801acb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ace:	50                   	push   %eax
+  801acf:	ff 36                	push   (%esi)
+  801ad1:	e8 3b fc ff ff       	call   801711 <dev_lookup>
+  801ad6:	83 c4 10             	add    $0x10,%esp
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	78 1c                	js     801af9 <ftruncate+0x50>
+  801add:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ae1:	74 1d                	je     801b00 <ftruncate+0x57>
+  801ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae6:	8b 40 18             	mov    0x18(%eax),%eax
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	74 34                	je     801b21 <ftruncate+0x78>
+  801aed:	83 ec 08             	sub    $0x8,%esp
+  801af0:	ff 75 0c             	push   0xc(%ebp)
+  801af3:	56                   	push   %esi
+  801af4:	ff d0                	call   *%eax
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afc:	5b                   	pop    %ebx
+  801afd:	5e                   	pop    %esi
+  801afe:	5d                   	pop    %ebp
+  801aff:	c3                   	ret
+  801b00:	a1 14 60 80 00       	mov    0x806014,%eax
+  801b05:	8b 40 48             	mov    0x48(%eax),%eax
+  801b08:	83 ec 04             	sub    $0x4,%esp
+  801b0b:	53                   	push   %ebx
+  801b0c:	50                   	push   %eax
+  801b0d:	68 58 45 80 00       	push   $0x804558
+  801b12:	e8 6e e7 ff ff       	call   800285 <cprintf>
+  801b17:	83 c4 10             	add    $0x10,%esp
+  801b1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b1f:	eb d8                	jmp    801af9 <ftruncate+0x50>
+  801b21:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b26:	eb d1                	jmp    801af9 <ftruncate+0x50>
+
+00801b28 <fstat>:
+  801b28:	55                   	push   %ebp
+  801b29:	89 e5                	mov    %esp,%ebp
+  801b2b:	56                   	push   %esi
+  801b2c:	53                   	push   %ebx
+  801b2d:	83 ec 18             	sub    $0x18,%esp
+  801b30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b33:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b36:	50                   	push   %eax
+  801b37:	ff 75 08             	push   0x8(%ebp)
+  801b3a:	e8 82 fb ff ff       	call   8016c1 <fd_lookup>
+  801b3f:	83 c4 10             	add    $0x10,%esp
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	78 49                	js     801b8f <fstat+0x67>
+  801b46:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b49:	83 ec 08             	sub    $0x8,%esp
+  801b4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b4f:	50                   	push   %eax
+  801b50:	ff 36                	push   (%esi)
+  801b52:	e8 ba fb ff ff       	call   801711 <dev_lookup>
+  801b57:	83 c4 10             	add    $0x10,%esp
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	78 31                	js     801b8f <fstat+0x67>
+  801b5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b61:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b65:	74 2f                	je     801b96 <fstat+0x6e>
+  801b67:	c6 03 00             	movb   $0x0,(%ebx)
+  801b6a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b71:	00 00 00 
+  801b74:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b7b:	00 00 00 
+  801b7e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801b84:	83 ec 08             	sub    $0x8,%esp
+  801b87:	53                   	push   %ebx
+  801b88:	56                   	push   %esi
+  801b89:	ff 50 14             	call   *0x14(%eax)
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b92:	5b                   	pop    %ebx
+  801b93:	5e                   	pop    %esi
+  801b94:	5d                   	pop    %ebp
+  801b95:	c3                   	ret
+  801b96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b9b:	eb f2                	jmp    801b8f <fstat+0x67>
+
+00801b9d <stat>:
+  801b9d:	55                   	push   %ebp
+  801b9e:	89 e5                	mov    %esp,%ebp
+  801ba0:	56                   	push   %esi
+  801ba1:	53                   	push   %ebx
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+  801ba5:	6a 00                	push   $0x0
+  801ba7:	ff 75 08             	push   0x8(%ebp)
+  801baa:	e8 31 05 00 00       	call   8020e0 <open>
+  801baf:	89 c3                	mov    %eax,%ebx
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	78 1b                	js     801bd3 <stat+0x36>
+  801bb8:	83 ec 08             	sub    $0x8,%esp
+  801bbb:	ff 75 0c             	push   0xc(%ebp)
+  801bbe:	50                   	push   %eax
+  801bbf:	e8 64 ff ff ff       	call   801b28 <fstat>
+  801bc4:	89 c6                	mov    %eax,%esi
+  801bc6:	89 1c 24             	mov    %ebx,(%esp)
+  801bc9:	e8 19 fc ff ff       	call   8017e7 <close>
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	89 f3                	mov    %esi,%ebx
+  801bd3:	89 d8                	mov    %ebx,%eax
+  801bd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd8:	5b                   	pop    %ebx
+  801bd9:	5e                   	pop    %esi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+
+00801bdc <fsipc>:
+  801bdc:	55                   	push   %ebp
+  801bdd:	89 e5                	mov    %esp,%ebp
+  801bdf:	56                   	push   %esi
+  801be0:	53                   	push   %ebx
+  801be1:	89 c3                	mov    %eax,%ebx
+  801be3:	89 d6                	mov    %edx,%esi
+  801be5:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801bec:	74 20                	je     801c0e <fsipc+0x32>
+  801bee:	83 ec 08             	sub    $0x8,%esp
+  801bf1:	6a 00                	push   $0x0
+  801bf3:	56                   	push   %esi
+  801bf4:	6a 07                	push   $0x7
+  801bf6:	68 00 70 80 00       	push   $0x807000
+  801bfb:	53                   	push   %ebx
+  801bfc:	ff 35 08 60 80 00    	push   0x806008
+  801c02:	e8 60 20 00 00       	call   803c67 <ipc_call>
+  801c07:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c0a:	5b                   	pop    %ebx
+  801c0b:	5e                   	pop    %esi
+  801c0c:	5d                   	pop    %ebp
+  801c0d:	c3                   	ret
+  801c0e:	83 ec 0c             	sub    $0xc,%esp
+  801c11:	6a 02                	push   $0x2
+  801c13:	e8 ea 21 00 00       	call   803e02 <ipc_find_env>
+  801c18:	a3 08 60 80 00       	mov    %eax,0x806008
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	eb cc                	jmp    801bee <fsipc+0x12>
+
+00801c22 <devfile_trunc>:
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	83 ec 08             	sub    $0x8,%esp
+  801c28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c2e:	a3 00 70 80 00       	mov    %eax,0x807000
+  801c33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c36:	a3 04 70 80 00       	mov    %eax,0x807004
+  801c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c40:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c45:	e8 92 ff ff ff       	call   801bdc <fsipc>
+  801c4a:	c9                   	leave
+  801c4b:	c3                   	ret
+
+00801c4c <devfile_flush>:
+  801c4c:	55                   	push   %ebp
+  801c4d:	89 e5                	mov    %esp,%ebp
+  801c4f:	83 ec 08             	sub    $0x8,%esp
+  801c52:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c58:	a3 00 70 80 00       	mov    %eax,0x807000
+  801c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c62:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c67:	e8 70 ff ff ff       	call   801bdc <fsipc>
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+
+00801c6e <devfile_stat>:
+  801c6e:	55                   	push   %ebp
+  801c6f:	89 e5                	mov    %esp,%ebp
+  801c71:	53                   	push   %ebx
+  801c72:	83 ec 04             	sub    $0x4,%esp
+  801c75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7e:	a3 00 70 80 00       	mov    %eax,0x807000
+  801c83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c88:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c8d:	e8 4a ff ff ff       	call   801bdc <fsipc>
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	78 2c                	js     801cc2 <devfile_stat+0x54>
+  801c96:	83 ec 08             	sub    $0x8,%esp
+  801c99:	68 00 70 80 00       	push   $0x807000
+  801c9e:	53                   	push   %ebx
+  801c9f:	e8 d8 ec ff ff       	call   80097c <strcpy>
+  801ca4:	a1 80 70 80 00       	mov    0x807080,%eax
+  801ca9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801caf:	a1 84 70 80 00       	mov    0x807084,%eax
+  801cb4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801cba:	83 c4 10             	add    $0x10,%esp
+  801cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+
+00801cc7 <fsring_rw>:
+  801cc7:	55                   	push   %ebp
+  801cc8:	89 e5                	mov    %esp,%ebp
+  801cca:	57                   	push   %edi
+  801ccb:	56                   	push   %esi
+  801ccc:	53                   	push   %ebx
+  801ccd:	83 ec 2c             	sub    $0x2c,%esp
+  801cd0:	89 c7                	mov    %eax,%edi
+  801cd2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801cd5:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801cd8:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801cdd:	a8 01                	test   $0x1,%al
+  801cdf:	74 0d                	je     801cee <fsring_rw+0x27>
+  801ce1:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801ce6:	a8 01                	test   $0x1,%al
+  801ce8:	0f 85 d5 00 00 00    	jne    801dc3 <fsring_rw+0xfc>
+  801cee:	a1 14 60 80 00       	mov    0x806014,%eax
+  801cf3:	8b 40 48             	mov    0x48(%eax),%eax
+  801cf6:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  801cfc:	0f 84 fc 00 00 00    	je     801dfe <fsring_rw+0x137>
+  801d02:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  801d09:	0f 84 02 01 00 00    	je     801e11 <fsring_rw+0x14a>
+  801d0f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d14:	83 ec 04             	sub    $0x4,%esp
+  801d17:	68 07 02 00 00       	push   $0x207
+  801d1c:	53                   	push   %ebx
+  801d1d:	6a 00                	push   $0x0
+  801d1f:	e8 b8 f0 ff ff       	call   800ddc <sys_page_alloc>
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	0f 88 f9 00 00 00    	js     801e28 <fsring_rw+0x161>
+  801d2f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d35:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d3b:	75 d7                	jne    801d14 <fsring_rw+0x4d>
+  801d3d:	6a 0e                	push   $0xe
+  801d3f:	6a 0d                	push   $0xd
+  801d41:	ff 35 08 60 80 00    	push   0x806008
+  801d47:	68 00 00 f0 cf       	push   $0xcff00000
+  801d4c:	e8 99 15 00 00       	call   8032ea <ipcring_init>
+  801d51:	83 c4 08             	add    $0x8,%esp
+  801d54:	6a 00                	push   $0x0
+  801d56:	6a 00                	push   $0x0
+  801d58:	68 07 02 00 00       	push   $0x207
+  801d5d:	68 00 00 f0 cf       	push   $0xcff00000
+  801d62:	6a 0b                	push   $0xb
+  801d64:	ff 35 08 60 80 00    	push   0x806008
+  801d6a:	e8 f8 1e 00 00       	call   803c67 <ipc_call>
+  801d6f:	89 c6                	mov    %eax,%esi
+  801d71:	83 c4 20             	add    $0x20,%esp
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	0f 88 ac 00 00 00    	js     801e28 <fsring_rw+0x161>
+  801d7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d81:	89 d9                	mov    %ebx,%ecx
+  801d83:	83 c3 01             	add    $0x1,%ebx
+  801d86:	89 da                	mov    %ebx,%edx
+  801d88:	c1 e2 0c             	shl    $0xc,%edx
+  801d8b:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801d91:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801d97:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801d9d:	83 ec 08             	sub    $0x8,%esp
+  801da0:	6a 00                	push   $0x0
+  801da2:	6a 00                	push   $0x0
+  801da4:	68 07 02 00 00       	push   $0x207
+  801da9:	50                   	push   %eax
+  801daa:	6a 0c                	push   $0xc
+  801dac:	ff 35 08 60 80 00    	push   0x806008
+  801db2:	e8 b0 1e 00 00       	call   803c67 <ipc_call>
+  801db7:	83 c4 20             	add    $0x20,%esp
+  801dba:	85 c0                	test   %eax,%eax
+  801dbc:	78 6a                	js     801e28 <fsring_rw+0x161>
+  801dbe:	83 fb 08             	cmp    $0x8,%ebx
+  801dc1:	75 be                	jne    801d81 <fsring_rw+0xba>
+  801dc3:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801dc7:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801dcc:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801dd1:	0f 45 c2             	cmovne %edx,%eax
+  801dd4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801dd7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801dde:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801de5:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801dec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df1:	be 00 00 00 00       	mov    $0x0,%esi
+  801df6:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801df9:	e9 4b 01 00 00       	jmp    801f49 <fsring_rw+0x282>
+  801dfe:	e8 a3 f3 ff ff       	call   8011a6 <sys_time_msec>
+  801e03:	3b 05 00 60 80 00    	cmp    0x806000,%eax
+  801e09:	0f 89 f3 fe ff ff    	jns    801d02 <fsring_rw+0x3b>
+  801e0f:	eb 54                	jmp    801e65 <fsring_rw+0x19e>
+  801e11:	83 ec 0c             	sub    $0xc,%esp
+  801e14:	6a 02                	push   $0x2
+  801e16:	e8 e7 1f 00 00       	call   803e02 <ipc_find_env>
+  801e1b:	a3 08 60 80 00       	mov    %eax,0x806008
+  801e20:	83 c4 10             	add    $0x10,%esp
+  801e23:	e9 e7 fe ff ff       	jmp    801d0f <fsring_rw+0x48>
+  801e28:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e2d:	83 ec 08             	sub    $0x8,%esp
+  801e30:	53                   	push   %ebx
+  801e31:	6a 00                	push   $0x0
+  801e33:	e8 76 f0 ff ff       	call   800eae <sys_page_unmap>
+  801e38:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e47:	75 e4                	jne    801e2d <fsring_rw+0x166>
+  801e49:	e8 58 f3 ff ff       	call   8011a6 <sys_time_msec>
+  801e4e:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801e53:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e58:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e5d:	8b 40 48             	mov    0x48(%eax),%eax
+  801e60:	a3 04 60 80 00       	mov    %eax,0x806004
+  801e65:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801e6c:	e9 7a 01 00 00       	jmp    801feb <fsring_rw+0x324>
+  801e71:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e74:	89 10                	mov    %edx,(%eax)
+  801e76:	89 58 04             	mov    %ebx,0x4(%eax)
+  801e79:	89 f2                	mov    %esi,%edx
+  801e7b:	03 57 04             	add    0x4(%edi),%edx
+  801e7e:	89 50 08             	mov    %edx,0x8(%eax)
+  801e81:	83 ec 04             	sub    $0x4,%esp
+  801e84:	53                   	push   %ebx
+  801e85:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801e88:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801e8b:	52                   	push   %edx
+  801e8c:	83 c0 0c             	add    $0xc,%eax
+  801e8f:	50                   	push   %eax
+  801e90:	e8 97 ec ff ff       	call   800b2c <memmove>
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e9b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e9e:	89 08                	mov    %ecx,(%eax)
+  801ea0:	83 ec 0c             	sub    $0xc,%esp
+  801ea3:	68 00 00 f0 cf       	push   $0xcff00000
+  801ea8:	e8 9b 14 00 00       	call   803348 <ipcring_req_push>
+  801ead:	01 de                	add    %ebx,%esi
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801eb5:	73 4c                	jae    801f03 <fsring_rw+0x23c>
+  801eb7:	83 ec 0c             	sub    $0xc,%esp
+  801eba:	68 00 00 f0 cf       	push   $0xcff00000
+  801ebf:	e8 5e 14 00 00       	call   803322 <ipcring_req_slot>
+  801ec4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	74 35                	je     801f03 <fsring_rw+0x23c>
+  801ece:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801ed3:	83 e0 07             	and    $0x7,%eax
+  801ed6:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801edb:	c1 e0 0c             	shl    $0xc,%eax
+  801ede:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ee1:	29 f3                	sub    %esi,%ebx
+  801ee3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ee6:	39 cb                	cmp    %ecx,%ebx
+  801ee8:	0f 47 d9             	cmova  %ecx,%ebx
+  801eeb:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801eef:	75 80                	jne    801e71 <fsring_rw+0x1aa>
+  801ef1:	8b 57 0c             	mov    0xc(%edi),%edx
+  801ef4:	89 10                	mov    %edx,(%eax)
+  801ef6:	89 58 04             	mov    %ebx,0x4(%eax)
+  801ef9:	89 f2                	mov    %esi,%edx
+  801efb:	03 57 04             	add    0x4(%edi),%edx
+  801efe:	89 50 08             	mov    %edx,0x8(%eax)
+  801f01:	eb 95                	jmp    801e98 <fsring_rw+0x1d1>
+  801f03:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f0b:	83 ec 0c             	sub    $0xc,%esp
+  801f0e:	68 00 00 f0 cf       	push   $0xcff00000
+  801f13:	e8 69 14 00 00       	call   803381 <ipcring_rsp_wait>
+  801f18:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f1b:	83 c4 10             	add    $0x10,%esp
+  801f1e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f22:	75 45                	jne    801f69 <fsring_rw+0x2a2>
+  801f24:	85 db                	test   %ebx,%ebx
+  801f26:	79 41                	jns    801f69 <fsring_rw+0x2a2>
+  801f28:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801f2b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801f32:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801f39:	83 ec 0c             	sub    $0xc,%esp
+  801f3c:	68 00 00 f0 cf       	push   $0xcff00000
+  801f41:	e8 a1 14 00 00       	call   8033e7 <ipcring_rsp_pop>
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801f4f:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f54:	39 c2                	cmp    %eax,%edx
+  801f56:	74 75                	je     801fcd <fsring_rw+0x306>
+  801f58:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f5c:	75 a5                	jne    801f03 <fsring_rw+0x23c>
+  801f5e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f61:	0f 82 50 ff ff ff    	jb     801eb7 <fsring_rw+0x1f0>
+  801f67:	eb 9a                	jmp    801f03 <fsring_rw+0x23c>
+  801f69:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f6d:	75 ca                	jne    801f39 <fsring_rw+0x272>
+  801f6f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f73:	74 31                	je     801fa6 <fsring_rw+0x2df>
+  801f75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f78:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f7b:	29 c8                	sub    %ecx,%eax
+  801f7d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801f80:	39 d0                	cmp    %edx,%eax
+  801f82:	0f 47 c2             	cmova  %edx,%eax
+  801f85:	39 d8                	cmp    %ebx,%eax
+  801f87:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f8c:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801f90:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801f93:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f98:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801f9c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f9f:	01 d9                	add    %ebx,%ecx
+  801fa1:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801fa4:	eb 93                	jmp    801f39 <fsring_rw+0x272>
+  801fa6:	83 ec 04             	sub    $0x4,%esp
+  801fa9:	53                   	push   %ebx
+  801faa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fad:	83 e0 07             	and    $0x7,%eax
+  801fb0:	c1 e0 0c             	shl    $0xc,%eax
+  801fb3:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801fb9:	50                   	push   %eax
+  801fba:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801fbd:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fc0:	01 c8                	add    %ecx,%eax
+  801fc2:	50                   	push   %eax
+  801fc3:	e8 64 eb ff ff       	call   800b2c <memmove>
+  801fc8:	83 c4 10             	add    $0x10,%esp
+  801fcb:	eb a8                	jmp    801f75 <fsring_rw+0x2ae>
+  801fcd:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801fd1:	75 09                	jne    801fdc <fsring_rw+0x315>
+  801fd3:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801fd6:	0f 82 db fe ff ff    	jb     801eb7 <fsring_rw+0x1f0>
+  801fdc:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801fdf:	01 57 04             	add    %edx,0x4(%edi)
+  801fe2:	85 d2                	test   %edx,%edx
+  801fe4:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801fe8:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801feb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff1:	5b                   	pop    %ebx
+  801ff2:	5e                   	pop    %esi
+  801ff3:	5f                   	pop    %edi
+  801ff4:	5d                   	pop    %ebp
+  801ff5:	c3                   	ret
+
+00801ff6 <devfile_write>:
+  801ff6:	55                   	push   %ebp
+  801ff7:	89 e5                	mov    %esp,%ebp
+  801ff9:	57                   	push   %edi
+  801ffa:	56                   	push   %esi
+  801ffb:	53                   	push   %ebx
+  801ffc:	83 ec 0c             	sub    $0xc,%esp
+  801fff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802002:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802005:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802008:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80200e:	76 1a                	jbe    80202a <devfile_write+0x34>
+  802010:	83 ec 0c             	sub    $0xc,%esp
+  802013:	53                   	push   %ebx
+  802014:	89 f1                	mov    %esi,%ecx
+  802016:	ba 06 00 00 00       	mov    $0x6,%edx
+  80201b:	89 f8                	mov    %edi,%eax
+  80201d:	e8 a5 fc ff ff       	call   801cc7 <fsring_rw>
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802028:	75 39                	jne    802063 <devfile_write+0x6d>
+  80202a:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80202f:	39 c3                	cmp    %eax,%ebx
+  802031:	0f 47 d8             	cmova  %eax,%ebx
+  802034:	8b 47 0c             	mov    0xc(%edi),%eax
+  802037:	a3 00 70 80 00       	mov    %eax,0x807000
+  80203c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802042:	83 ec 04             	sub    $0x4,%esp
+  802045:	53                   	push   %ebx
+  802046:	56                   	push   %esi
+  802047:	68 08 70 80 00       	push   $0x807008
+  80204c:	e8 db ea ff ff       	call   800b2c <memmove>
+  802051:	ba 00 00 00 00       	mov    $0x0,%edx
+  802056:	b8 04 00 00 00       	mov    $0x4,%eax
+  80205b:	e8 7c fb ff ff       	call   801bdc <fsipc>
+  802060:	83 c4 10             	add    $0x10,%esp
+  802063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802066:	5b                   	pop    %ebx
+  802067:	5e                   	pop    %esi
+  802068:	5f                   	pop    %edi
+  802069:	5d                   	pop    %ebp
+  80206a:	c3                   	ret
+
+0080206b <devfile_read>:
+  80206b:	55                   	push   %ebp
+  80206c:	89 e5                	mov    %esp,%ebp
+  80206e:	57                   	push   %edi
+  80206f:	56                   	push   %esi
+  802070:	53                   	push   %ebx
+  802071:	83 ec 0c             	sub    $0xc,%esp
+  802074:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802077:	8b 75 10             	mov    0x10(%ebp),%esi
+  80207a:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802080:	76 1d                	jbe    80209f <devfile_read+0x34>
+  802082:	83 ec 0c             	sub    $0xc,%esp
+  802085:	56                   	push   %esi
+  802086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802089:	ba 05 00 00 00       	mov    $0x5,%edx
+  80208e:	89 f8                	mov    %edi,%eax
+  802090:	e8 32 fc ff ff       	call   801cc7 <fsring_rw>
+  802095:	89 c3                	mov    %eax,%ebx
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80209d:	75 37                	jne    8020d6 <devfile_read+0x6b>
+  80209f:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020a2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020a7:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8020ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020b7:	e8 20 fb ff ff       	call   801bdc <fsipc>
+  8020bc:	89 c3                	mov    %eax,%ebx
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 14                	js     8020d6 <devfile_read+0x6b>
+  8020c2:	83 ec 04             	sub    $0x4,%esp
+  8020c5:	50                   	push   %eax
+  8020c6:	68 00 70 80 00       	push   $0x807000
+  8020cb:	ff 75 0c             	push   0xc(%ebp)
+  8020ce:	e8 59 ea ff ff       	call   800b2c <memmove>
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	89 d8                	mov    %ebx,%eax
+  8020d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020db:	5b                   	pop    %ebx
+  8020dc:	5e                   	pop    %esi
+  8020dd:	5f                   	pop    %edi
+  8020de:	5d                   	pop    %ebp
+  8020df:	c3                   	ret
+
+008020e0 <open>:
+  8020e0:	55                   	push   %ebp
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	56                   	push   %esi
+  8020e4:	53                   	push   %ebx
+  8020e5:	83 ec 1c             	sub    $0x1c,%esp
+  8020e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020eb:	56                   	push   %esi
+  8020ec:	e8 3f e8 ff ff       	call   800930 <strlen>
+  8020f1:	83 c4 10             	add    $0x10,%esp
+  8020f4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020f9:	7f 6c                	jg     802167 <open+0x87>
+  8020fb:	83 ec 0c             	sub    $0xc,%esp
+  8020fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802101:	50                   	push   %eax
+  802102:	e8 6a f5 ff ff       	call   801671 <fd_alloc>
+  802107:	89 c3                	mov    %eax,%ebx
+  802109:	83 c4 10             	add    $0x10,%esp
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	78 3c                	js     80214c <open+0x6c>
+  802110:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802113:	a3 00 74 80 00       	mov    %eax,0x807400
+  802118:	83 ec 08             	sub    $0x8,%esp
+  80211b:	56                   	push   %esi
+  80211c:	68 00 70 80 00       	push   $0x807000
+  802121:	e8 56 e8 ff ff       	call   80097c <strcpy>
+  802126:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802129:	b8 01 00 00 00       	mov    $0x1,%eax
+  80212e:	e8 a9 fa ff ff       	call   801bdc <fsipc>
+  802133:	89 c3                	mov    %eax,%ebx
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	78 19                	js     802155 <open+0x75>
+  80213c:	83 ec 0c             	sub    $0xc,%esp
+  80213f:	ff 75 f4             	push   -0xc(%ebp)
+  802142:	e8 03 f5 ff ff       	call   80164a <fd2num>
+  802147:	89 c3                	mov    %eax,%ebx
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	89 d8                	mov    %ebx,%eax
+  80214e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802151:	5b                   	pop    %ebx
+  802152:	5e                   	pop    %esi
+  802153:	5d                   	pop    %ebp
+  802154:	c3                   	ret
+  802155:	83 ec 08             	sub    $0x8,%esp
+  802158:	6a 00                	push   $0x0
+  80215a:	ff 75 f4             	push   -0xc(%ebp)
+  80215d:	e8 05 f6 ff ff       	call   801767 <fd_close>
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	eb e5                	jmp    80214c <open+0x6c>
+  802167:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80216c:	eb de                	jmp    80214c <open+0x6c>
+
+0080216e <file_image>:
+  80216e:	55                   	push   %ebp
+  80216f:	89 e5                	mov    %esp,%ebp
+  802171:	53                   	push   %ebx
+  802172:	83 ec 1c             	sub    $0x1c,%esp
+  802175:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802178:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217b:	50                   	push   %eax
+  80217c:	ff 75 08             	push   0x8(%ebp)
+  80217f:	e8 3d f5 ff ff       	call   8016c1 <fd_lookup>
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	85 c0                	test   %eax,%eax
+  802189:	78 58                	js     8021e3 <file_image+0x75>
+  80218b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218e:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802194:	39 08                	cmp    %ecx,(%eax)
+  802196:	75 50                	jne    8021e8 <file_image+0x7a>
+  802198:	83 fb 04             	cmp    $0x4,%ebx
+  80219b:	77 52                	ja     8021ef <file_image+0x81>
+  80219d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021a0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021a5:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8021ab:	83 ec 04             	sub    $0x4,%esp
+  8021ae:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8021b1:	c1 e0 02             	shl    $0x2,%eax
+  8021b4:	50                   	push   %eax
+  8021b5:	ff 75 0c             	push   0xc(%ebp)
+  8021b8:	68 08 70 80 00       	push   $0x807008
+  8021bd:	e8 6a e9 ff ff       	call   800b2c <memmove>
+  8021c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8021cc:	e8 0b fa ff ff       	call   801bdc <fsipc>
+  8021d1:	83 c4 10             	add    $0x10,%esp
+  8021d4:	85 c0                	test   %eax,%eax
+  8021d6:	78 0b                	js     8021e3 <file_image+0x75>
+  8021d8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8021db:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  8021e1:	89 0a                	mov    %ecx,(%edx)
+  8021e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+  8021e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021ed:	eb f4                	jmp    8021e3 <file_image+0x75>
+  8021ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f4:	eb ed                	jmp    8021e3 <file_image+0x75>
+
+008021f6 <remove>:
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	53                   	push   %ebx
+  8021fa:	83 ec 10             	sub    $0x10,%esp
+  8021fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802200:	53                   	push   %ebx
+  802201:	e8 2a e7 ff ff       	call   800930 <strlen>
+  802206:	83 c4 10             	add    $0x10,%esp
+  802209:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80220e:	7f 25                	jg     802235 <remove+0x3f>
+  802210:	83 ec 08             	sub    $0x8,%esp
+  802213:	53                   	push   %ebx
+  802214:	68 00 70 80 00       	push   $0x807000
+  802219:	e8 5e e7 ff ff       	call   80097c <strcpy>
+  80221e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802223:	b8 09 00 00 00       	mov    $0x9,%eax
+  802228:	e8 af f9 ff ff       	call   801bdc <fsipc>
+  80222d:	83 c4 10             	add    $0x10,%esp
+  802230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802233:	c9                   	leave
+  802234:	c3                   	ret
+  802235:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80223a:	eb f4                	jmp    802230 <remove+0x3a>
+
+0080223c <sync>:
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	83 ec 08             	sub    $0x8,%esp
+  802242:	ba 00 00 00 00       	mov    $0x0,%edx
+  802247:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80224c:	e8 8b f9 ff ff       	call   801bdc <fsipc>
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+
+00802253 <map_segment>:
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	57                   	push   %edi
+  802257:	56                   	push   %esi
+  802258:	53                   	push   %ebx
+  802259:	83 ec 1c             	sub    $0x1c,%esp
+  80225c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80225f:	89 d7                	mov    %edx,%edi
+  802261:	89 d0                	mov    %edx,%eax
+  802263:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802268:	74 0a                	je     802274 <map_segment+0x21>
+  80226a:	29 c7                	sub    %eax,%edi
+  80226c:	01 c1                	add    %eax,%ecx
+  80226e:	01 45 0c             	add    %eax,0xc(%ebp)
+  802271:	29 45 10             	sub    %eax,0x10(%ebp)
+  802274:	85 c9                	test   %ecx,%ecx
+  802276:	0f 84 fb 00 00 00    	je     802377 <map_segment+0x124>
+  80227c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802281:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802284:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802287:	e9 a6 00 00 00       	jmp    802332 <map_segment+0xdf>
+  80228c:	83 ec 04             	sub    $0x4,%esp
+  80228f:	6a 07                	push   $0x7
+  802291:	68 00 00 40 00       	push   $0x400000
+  802296:	6a 00                	push   $0x0
+  802298:	e8 3f eb ff ff       	call   800ddc <sys_page_alloc>
+  80229d:	83 c4 10             	add    $0x10,%esp
+  8022a0:	85 c0                	test   %eax,%eax
+  8022a2:	0f 88 c7 00 00 00    	js     80236f <map_segment+0x11c>
+  8022a8:	83 ec 08             	sub    $0x8,%esp
+  8022ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022ae:	03 45 10             	add    0x10(%ebp),%eax
+  8022b1:	50                   	push   %eax
+  8022b2:	ff 75 08             	push   0x8(%ebp)
+  8022b5:	e8 c6 f7 ff ff       	call   801a80 <seek>
+  8022ba:	83 c4 10             	add    $0x10,%esp
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	0f 88 aa 00 00 00    	js     80236f <map_segment+0x11c>
+  8022c5:	83 ec 04             	sub    $0x4,%esp
+  8022c8:	89 f2                	mov    %esi,%edx
+  8022ca:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8022cd:	29 ca                	sub    %ecx,%edx
+  8022cf:	89 d0                	mov    %edx,%eax
+  8022d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022d6:	39 d0                	cmp    %edx,%eax
+  8022d8:	0f 47 c2             	cmova  %edx,%eax
+  8022db:	50                   	push   %eax
+  8022dc:	68 00 00 40 00       	push   $0x400000
+  8022e1:	ff 75 08             	push   0x8(%ebp)
+  8022e4:	e8 c1 f6 ff ff       	call   8019aa <readn>
+  8022e9:	83 c4 10             	add    $0x10,%esp
+  8022ec:	85 c0                	test   %eax,%eax
+  8022ee:	78 7f                	js     80236f <map_segment+0x11c>
+  8022f0:	83 ec 0c             	sub    $0xc,%esp
+  8022f3:	ff 75 14             	push   0x14(%ebp)
+  8022f6:	57                   	push   %edi
+  8022f7:	ff 75 e0             	push   -0x20(%ebp)
+  8022fa:	68 00 00 40 00       	push   $0x400000
+  8022ff:	6a 00                	push   $0x0
+  802301:	e8 19 eb ff ff       	call   800e1f <sys_page_map>
+  802306:	83 c4 20             	add    $0x20,%esp
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	78 48                	js     802355 <map_segment+0x102>
+  80230d:	83 ec 08             	sub    $0x8,%esp
+  802310:	68 00 00 40 00       	push   $0x400000
+  802315:	6a 00                	push   $0x0
+  802317:	e8 92 eb ff ff       	call   800eae <sys_page_unmap>
+  80231c:	83 c4 10             	add    $0x10,%esp
+  80231f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802325:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80232b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80232e:	39 c3                	cmp    %eax,%ebx
+  802330:	73 38                	jae    80236a <map_segment+0x117>
+  802332:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802335:	39 f3                	cmp    %esi,%ebx
+  802337:	0f 82 4f ff ff ff    	jb     80228c <map_segment+0x39>
+  80233d:	83 ec 04             	sub    $0x4,%esp
+  802340:	ff 75 14             	push   0x14(%ebp)
+  802343:	57                   	push   %edi
+  802344:	ff 75 e0             	push   -0x20(%ebp)
+  802347:	e8 90 ea ff ff       	call   800ddc <sys_page_alloc>
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	79 cc                	jns    80231f <map_segment+0xcc>
+  802353:	eb 1a                	jmp    80236f <map_segment+0x11c>
+  802355:	50                   	push   %eax
+  802356:	68 c8 45 80 00       	push   $0x8045c8
+  80235b:	68 75 01 00 00       	push   $0x175
+  802360:	68 e5 45 80 00       	push   $0x8045e5
+  802365:	e8 40 de ff ff       	call   8001aa <_panic>
+  80236a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802372:	5b                   	pop    %ebx
+  802373:	5e                   	pop    %esi
+  802374:	5f                   	pop    %edi
+  802375:	5d                   	pop    %ebp
+  802376:	c3                   	ret
+  802377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237c:	eb f1                	jmp    80236f <map_segment+0x11c>
+
+0080237e <execv>:
+  80237e:	55                   	push   %ebp
+  80237f:	89 e5                	mov    %esp,%ebp
+  802381:	57                   	push   %edi
+  802382:	56                   	push   %esi
+  802383:	53                   	push   %ebx
+  802384:	81 ec d4 02 00 00    	sub    $0x2d4,%esp
+  80238a:	6a 00                	push   $0x0
+  80238c:	ff 75 08             	push   0x8(%ebp)
+  80238f:	e8 4c fd ff ff       	call   8020e0 <open>
+  802394:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80239a:	83 c4 10             	add    $0x10,%esp
+  80239d:	85 c0                	test   %eax,%eax
+  80239f:	0f 88 ea 05 00 00    	js     80298f <execv+0x611>
+  8023a5:	89 c6                	mov    %eax,%esi
+  8023a7:	83 ec 04             	sub    $0x4,%esp
+  8023aa:	68 00 02 00 00       	push   $0x200
+  8023af:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8023b5:	50                   	push   %eax
+  8023b6:	56                   	push   %esi
+  8023b7:	e8 ee f5 ff ff       	call   8019aa <readn>
+  8023bc:	83 c4 10             	add    $0x10,%esp
+  8023bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8023c4:	0f 85 e1 01 00 00    	jne    8025ab <execv+0x22d>
+  8023ca:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8023d1:	45 4c 46 
+  8023d4:	0f 85 d1 01 00 00    	jne    8025ab <execv+0x22d>
+  8023da:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023df:	cd 30                	int    $0x30
+  8023e1:	89 85 40 fd ff ff    	mov    %eax,-0x2c0(%ebp)
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	0f 88 94 05 00 00    	js     802983 <execv+0x605>
+  8023ef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023f4:	69 f0 ac 01 00 00    	imul   $0x1ac,%eax,%esi
+  8023fa:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802400:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802406:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80240b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80240d:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802413:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  802419:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80241c:	8b 00                	mov    (%eax),%eax
+  80241e:	85 c0                	test   %eax,%eax
+  802420:	0f 84 ad 05 00 00    	je     8029d3 <execv+0x655>
+  802426:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80242b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802430:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802433:	83 ec 0c             	sub    $0xc,%esp
+  802436:	50                   	push   %eax
+  802437:	e8 f4 e4 ff ff       	call   800930 <strlen>
+  80243c:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  802440:	89 d9                	mov    %ebx,%ecx
+  802442:	83 c3 01             	add    $0x1,%ebx
+  802445:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%ebp)
+  80244b:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  802452:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  802455:	83 c4 10             	add    $0x10,%esp
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	75 d7                	jne    802433 <execv+0xb5>
+  80245c:	89 95 2c fd ff ff    	mov    %edx,-0x2d4(%ebp)
+  802462:	89 8d 30 fd ff ff    	mov    %ecx,-0x2d0(%ebp)
+  802468:	be 00 10 40 00       	mov    $0x401000,%esi
+  80246d:	29 fe                	sub    %edi,%esi
+  80246f:	89 f2                	mov    %esi,%edx
+  802471:	83 e2 fc             	and    $0xfffffffc,%edx
+  802474:	8d 04 8d 08 00 00 00 	lea    0x8(,%ecx,4),%eax
+  80247b:	89 d7                	mov    %edx,%edi
+  80247d:	29 c7                	sub    %eax,%edi
+  80247f:	8d 47 f8             	lea    -0x8(%edi),%eax
+  802482:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802487:	0f 86 1f 05 00 00    	jbe    8029ac <execv+0x62e>
+  80248d:	83 ec 04             	sub    $0x4,%esp
+  802490:	6a 07                	push   $0x7
+  802492:	68 00 00 40 00       	push   $0x400000
+  802497:	6a 00                	push   $0x0
+  802499:	e8 3e e9 ff ff       	call   800ddc <sys_page_alloc>
+  80249e:	83 c4 10             	add    $0x10,%esp
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	0f 88 08 05 00 00    	js     8029b1 <execv+0x633>
+  8024a9:	85 db                	test   %ebx,%ebx
+  8024ab:	7e 58                	jle    802505 <execv+0x187>
+  8024ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b2:	89 bd 34 fd ff ff    	mov    %edi,-0x2cc(%ebp)
+  8024b8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024bb:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+  8024c1:	8d 86 00 d0 3f ee    	lea    -0x11c03000(%esi),%eax
+  8024c7:	8b 8d 34 fd ff ff    	mov    -0x2cc(%ebp),%ecx
+  8024cd:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+  8024d0:	83 ec 08             	sub    $0x8,%esp
+  8024d3:	ff 34 9f             	push   (%edi,%ebx,4)
+  8024d6:	56                   	push   %esi
+  8024d7:	e8 a0 e4 ff ff       	call   80097c <strcpy>
+  8024dc:	83 c4 04             	add    $0x4,%esp
+  8024df:	ff 34 9f             	push   (%edi,%ebx,4)
+  8024e2:	e8 49 e4 ff ff       	call   800930 <strlen>
+  8024e7:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  8024eb:	83 c3 01             	add    $0x1,%ebx
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	8b 8d 3c fd ff ff    	mov    -0x2c4(%ebp),%ecx
+  8024f7:	39 8d 30 fd ff ff    	cmp    %ecx,-0x2d0(%ebp)
+  8024fd:	75 bc                	jne    8024bb <execv+0x13d>
+  8024ff:	8b bd 34 fd ff ff    	mov    -0x2cc(%ebp),%edi
+  802505:	8b 85 2c fd ff ff    	mov    -0x2d4(%ebp),%eax
+  80250b:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+  802512:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  802518:	0f 85 c5 00 00 00    	jne    8025e3 <execv+0x265>
+  80251e:	8d 87 00 d0 3f ee    	lea    -0x11c03000(%edi),%eax
+  802524:	89 47 fc             	mov    %eax,-0x4(%edi)
+  802527:	8b 85 38 fd ff ff    	mov    -0x2c8(%ebp),%eax
+  80252d:	89 47 f8             	mov    %eax,-0x8(%edi)
+  802530:	8d 87 f8 cf 3f ee    	lea    -0x11c03008(%edi),%eax
+  802536:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  80253c:	83 ec 0c             	sub    $0xc,%esp
+  80253f:	6a 07                	push   $0x7
+  802541:	68 00 d0 7f ee       	push   $0xee7fd000
+  802546:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80254c:	68 00 00 40 00       	push   $0x400000
+  802551:	6a 00                	push   $0x0
+  802553:	e8 c7 e8 ff ff       	call   800e1f <sys_page_map>
+  802558:	89 c3                	mov    %eax,%ebx
+  80255a:	83 c4 20             	add    $0x20,%esp
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	0f 88 54 04 00 00    	js     8029b9 <execv+0x63b>
+  802565:	83 ec 08             	sub    $0x8,%esp
+  802568:	68 00 00 40 00       	push   $0x400000
+  80256d:	6a 00                	push   $0x0
+  80256f:	e8 3a e9 ff ff       	call   800eae <sys_page_unmap>
+  802574:	89 c3                	mov    %eax,%ebx
+  802576:	83 c4 10             	add    $0x10,%esp
+  802579:	85 c0                	test   %eax,%eax
+  80257b:	0f 88 38 04 00 00    	js     8029b9 <execv+0x63b>
+  802581:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802587:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+  80258e:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  802595:	00 
+  802596:	0f 84 01 04 00 00    	je     80299d <execv+0x61f>
+  80259c:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a6:	e9 88 00 00 00       	jmp    802633 <execv+0x2b5>
+  8025ab:	83 ec 0c             	sub    $0xc,%esp
+  8025ae:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8025b4:	e8 2e f2 ff ff       	call   8017e7 <close>
+  8025b9:	83 c4 0c             	add    $0xc,%esp
+  8025bc:	68 7f 45 4c 46       	push   $0x464c457f
+  8025c1:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8025c7:	68 f1 45 80 00       	push   $0x8045f1
+  8025cc:	e8 b4 dc ff ff       	call   800285 <cprintf>
+  8025d1:	83 c4 10             	add    $0x10,%esp
+  8025d4:	c7 85 44 fd ff ff f2 	movl   $0xfffffff2,-0x2bc(%ebp)
+  8025db:	ff ff ff 
+  8025de:	e9 ac 03 00 00       	jmp    80298f <execv+0x611>
+  8025e3:	68 78 46 80 00       	push   $0x804678
+  8025e8:	68 0b 46 80 00       	push   $0x80460b
+  8025ed:	68 41 01 00 00       	push   $0x141
+  8025f2:	68 e5 45 80 00       	push   $0x8045e5
+  8025f7:	e8 ae db ff ff       	call   8001aa <_panic>
+  8025fc:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  8025ff:	50                   	push   %eax
+  802600:	ff 73 04             	push   0x4(%ebx)
+  802603:	ff 73 10             	push   0x10(%ebx)
+  802606:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  80260c:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802612:	e8 3c fc ff ff       	call   802253 <map_segment>
+  802617:	83 c4 10             	add    $0x10,%esp
+  80261a:	85 c0                	test   %eax,%eax
+  80261c:	0f 88 34 03 00 00    	js     802956 <execv+0x5d8>
+  802622:	83 c7 01             	add    $0x1,%edi
+  802625:	83 c3 20             	add    $0x20,%ebx
+  802628:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  80262f:	39 f8                	cmp    %edi,%eax
+  802631:	7e 5d                	jle    802690 <execv+0x312>
+  802633:	83 3b 01             	cmpl   $0x1,(%ebx)
+  802636:	75 ea                	jne    802622 <execv+0x2a4>
+  802638:	8b 43 18             	mov    0x18(%ebx),%eax
+  80263b:	83 e0 02             	and    $0x2,%eax
+  80263e:	83 f8 01             	cmp    $0x1,%eax
+  802641:	19 c0                	sbb    %eax,%eax
+  802643:	83 e0 fe             	and    $0xfffffffe,%eax
+  802646:	83 c0 07             	add    $0x7,%eax
+  802649:	8b 53 08             	mov    0x8(%ebx),%edx
+  80264c:	81 fa ff ff 7f 00    	cmp    $0x7fffff,%edx
+  802652:	76 a8                	jbe    8025fc <execv+0x27e>
+  802654:	83 fe 03             	cmp    $0x3,%esi
+  802657:	7f a3                	jg     8025fc <execv+0x27e>
+  802659:	8d 0c b6             	lea    (%esi,%esi,4),%ecx
+  80265c:	c1 e1 02             	shl    $0x2,%ecx
+  80265f:	89 94 0d 54 fd ff ff 	mov    %edx,-0x2ac(%ebp,%ecx,1)
+  802666:	8b 53 14             	mov    0x14(%ebx),%edx
+  802669:	89 94 0d 58 fd ff ff 	mov    %edx,-0x2a8(%ebp,%ecx,1)
+  802670:	8b 53 10             	mov    0x10(%ebx),%edx
+  802673:	89 94 0d 5c fd ff ff 	mov    %edx,-0x2a4(%ebp,%ecx,1)
+  80267a:	8b 53 04             	mov    0x4(%ebx),%edx
+  80267d:	89 94 0d 60 fd ff ff 	mov    %edx,-0x2a0(%ebp,%ecx,1)
+  802684:	89 84 0d 64 fd ff ff 	mov    %eax,-0x29c(%ebp,%ecx,1)
+  80268b:	83 c6 01             	add    $0x1,%esi
+  80268e:	eb 92                	jmp    802622 <execv+0x2a4>
+  802690:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802697:	00 00 00 
+  80269a:	85 f6                	test   %esi,%esi
+  80269c:	7f 12                	jg     8026b0 <execv+0x332>
+  80269e:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  8026a4:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  8026ab:	00 00 00 
+  8026ae:	eb 7e                	jmp    80272e <execv+0x3b0>
+  8026b0:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  8026b6:	50                   	push   %eax
+  8026b7:	56                   	push   %esi
+  8026b8:	8d 85 54 fd ff ff    	lea    -0x2ac(%ebp),%eax
+  8026be:	50                   	push   %eax
+  8026bf:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8026c5:	e8 a4 fa ff ff       	call   80216e <file_image>
+  8026ca:	89 85 3c fd ff ff    	mov    %eax,-0x2c4(%ebp)
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	0f 88 9e 00 00 00    	js     802779 <execv+0x3fb>
+  8026db:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	75 49                	jne    80272e <execv+0x3b0>
+  8026e5:	8d 9d 54 fd ff ff    	lea    -0x2ac(%ebp),%ebx
+  8026eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026f0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  8026f3:	8b 13                	mov    (%ebx),%edx
+  8026f5:	ff 73 10             	push   0x10(%ebx)
+  8026f8:	ff 73 0c             	push   0xc(%ebx)
+  8026fb:	ff 73 08             	push   0x8(%ebx)
+  8026fe:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802704:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  80270a:	e8 44 fb ff ff       	call   802253 <map_segment>
+  80270f:	83 c4 10             	add    $0x10,%esp
+  802712:	85 c0                	test   %eax,%eax
+  802714:	0f 88 65 02 00 00    	js     80297f <execv+0x601>
+  80271a:	83 c7 01             	add    $0x1,%edi
+  80271d:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802723:	83 c3 14             	add    $0x14,%ebx
+  802726:	39 fe                	cmp    %edi,%esi
+  802728:	7e 04                	jle    80272e <execv+0x3b0>
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	74 c2                	je     8026f0 <execv+0x372>
+  80272e:	83 ec 04             	sub    $0x4,%esp
+  802731:	ff b5 3c fd ff ff    	push   -0x2c4(%ebp)
+  802737:	50                   	push   %eax
+  802738:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80273e:	e8 82 ee ff ff       	call   8015c5 <sys_env_set_pager>
+  802743:	89 c7                	mov    %eax,%edi
+  802745:	83 c4 10             	add    $0x10,%esp
+  802748:	85 c0                	test   %eax,%eax
+  80274a:	0f 88 08 02 00 00    	js     802958 <execv+0x5da>
+  802750:	83 ec 0c             	sub    $0xc,%esp
+  802753:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802759:	e8 89 f0 ff ff       	call   8017e7 <close>
+  80275e:	e8 54 10 00 00       	call   8037b7 <dupq_begin>
+  802763:	89 c7                	mov    %eax,%edi
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	89 c1                	mov    %eax,%ecx
+  80276a:	85 c0                	test   %eax,%eax
+  80276c:	0f 88 91 00 00 00    	js     802803 <execv+0x485>
+  802772:	be 02 00 00 00       	mov    $0x2,%esi
+  802777:	eb 33                	jmp    8027ac <execv+0x42e>
+  802779:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802780:	00 00 00 
+  802783:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  80278a:	00 00 00 
+  80278d:	e9 53 ff ff ff       	jmp    8026e5 <execv+0x367>
+  802792:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802799:	a8 01                	test   $0x1,%al
+  80279b:	75 7b                	jne    802818 <execv+0x49a>
+  80279d:	83 c6 01             	add    $0x1,%esi
+  8027a0:	81 fe ba 03 00 00    	cmp    $0x3ba,%esi
+  8027a6:	0f 84 e5 00 00 00    	je     802891 <execv+0x513>
+  8027ac:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027b3:	a8 01                	test   $0x1,%al
+  8027b5:	74 db                	je     802792 <execv+0x414>
+  8027b7:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027be:	a8 80                	test   $0x80,%al
+  8027c0:	74 d0                	je     802792 <execv+0x414>
+  8027c2:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027c9:	f6 c4 04             	test   $0x4,%ah
+  8027cc:	74 cf                	je     80279d <execv+0x41f>
+  8027ce:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8027d5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8027da:	0c 80                	or     $0x80,%al
+  8027dc:	50                   	push   %eax
+  8027dd:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8027e3:	89 f0                	mov    %esi,%eax
+  8027e5:	c1 e0 16             	shl    $0x16,%eax
+  8027e8:	c1 e8 0c             	shr    $0xc,%eax
+  8027eb:	50                   	push   %eax
+  8027ec:	6a 00                	push   $0x0
+  8027ee:	e8 e4 0f 00 00       	call   8037d7 <dupq_map>
+  8027f3:	89 c1                	mov    %eax,%ecx
+  8027f5:	83 c4 10             	add    $0x10,%esp
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	79 a1                	jns    80279d <execv+0x41f>
+  8027fc:	89 c7                	mov    %eax,%edi
+  8027fe:	e8 37 10 00 00       	call   80383a <dupq_end>
+  802803:	57                   	push   %edi
+  802804:	68 20 46 80 00       	push   $0x804620
+  802809:	68 ac 00 00 00       	push   $0xac
+  80280e:	68 e5 45 80 00       	push   $0x8045e5
+  802813:	e8 92 d9 ff ff       	call   8001aa <_panic>
+  802818:	89 f7                	mov    %esi,%edi
+  80281a:	c1 e7 16             	shl    $0x16,%edi
+  80281d:	89 f8                	mov    %edi,%eax
+  80281f:	c1 e8 0c             	shr    $0xc,%eax
+  802822:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802827:	eb 24                	jmp    80284d <execv+0x4cf>
+  802829:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  80282f:	0f 84 68 ff ff ff    	je     80279d <execv+0x41f>
+  802835:	89 d8                	mov    %ebx,%eax
+  802837:	09 f8                	or     %edi,%eax
+  802839:	c1 e8 0c             	shr    $0xc,%eax
+  80283c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802842:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  802847:	0f 84 50 ff ff ff    	je     80279d <execv+0x41f>
+  80284d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802854:	f6 c2 01             	test   $0x1,%dl
+  802857:	74 d0                	je     802829 <execv+0x4ab>
+  802859:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802860:	f6 c6 04             	test   $0x4,%dh
+  802863:	74 c4                	je     802829 <execv+0x4ab>
+  802865:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80286c:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802872:	52                   	push   %edx
+  802873:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802879:	50                   	push   %eax
+  80287a:	6a 00                	push   $0x0
+  80287c:	e8 56 0f 00 00       	call   8037d7 <dupq_map>
+  802881:	89 c1                	mov    %eax,%ecx
+  802883:	83 c4 10             	add    $0x10,%esp
+  802886:	85 c0                	test   %eax,%eax
+  802888:	79 9f                	jns    802829 <execv+0x4ab>
+  80288a:	89 c7                	mov    %eax,%edi
+  80288c:	e9 6d ff ff ff       	jmp    8027fe <execv+0x480>
+  802891:	89 cf                	mov    %ecx,%edi
+  802893:	85 c9                	test   %ecx,%ecx
+  802895:	0f 88 63 ff ff ff    	js     8027fe <execv+0x480>
+  80289b:	e8 9a 0f 00 00       	call   80383a <dupq_end>
+  8028a0:	89 c7                	mov    %eax,%edi
+  8028a2:	85 c0                	test   %eax,%eax
+  8028a4:	0f 88 59 ff ff ff    	js     802803 <execv+0x485>
+  8028aa:	83 ec 08             	sub    $0x8,%esp
+  8028ad:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8028b3:	50                   	push   %eax
+  8028b4:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8028ba:	e8 92 e6 ff ff       	call   800f51 <sys_env_set_trapframe>
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  8028c2:	85 c0                	test   %eax,%eax
+  8028c4:	78 2e                	js     8028f4 <execv+0x576>
+  8028c6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028ca:	74 52                	je     80291e <execv+0x5a0>
+  8028cc:	83 ec 08             	sub    $0x8,%esp
+  8028cf:	6a 02                	push   $0x2
+  8028d1:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8028d7:	e8 33 e6 ff ff       	call   800f0f <sys_env_set_status>
+  8028dc:	83 c4 10             	add    $0x10,%esp
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	78 26                	js     802909 <execv+0x58b>
+  8028e3:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  8028e9:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  8028ef:	e9 9b 00 00 00       	jmp    80298f <execv+0x611>
+  8028f4:	50                   	push   %eax
+  8028f5:	68 36 46 80 00       	push   $0x804636
+  8028fa:	68 af 00 00 00       	push   $0xaf
+  8028ff:	68 e5 45 80 00       	push   $0x8045e5
+  802904:	e8 a1 d8 ff ff       	call   8001aa <_panic>
+  802909:	50                   	push   %eax
+  80290a:	68 50 46 80 00       	push   $0x804650
+  80290f:	68 b3 00 00 00       	push   $0xb3
+  802914:	68 e5 45 80 00       	push   $0x8045e5
+  802919:	e8 8c d8 ff ff       	call   8001aa <_panic>
+  80291e:	83 ec 0c             	sub    $0xc,%esp
+  802921:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802927:	e8 c3 e8 ff ff       	call   8011ef <sys_env_swap>
+  80292c:	83 c4 10             	add    $0x10,%esp
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	78 0e                	js     802941 <execv+0x5c3>
+  802933:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802939:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80293f:	eb 4e                	jmp    80298f <execv+0x611>
+  802941:	50                   	push   %eax
+  802942:	68 67 46 80 00       	push   $0x804667
+  802947:	68 ba 00 00 00       	push   $0xba
+  80294c:	68 e5 45 80 00       	push   $0x8045e5
+  802951:	e8 54 d8 ff ff       	call   8001aa <_panic>
+  802956:	89 c7                	mov    %eax,%edi
+  802958:	83 ec 0c             	sub    $0xc,%esp
+  80295b:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802961:	e8 cb e3 ff ff       	call   800d31 <sys_env_destroy>
+  802966:	83 c4 04             	add    $0x4,%esp
+  802969:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  80296f:	e8 73 ee ff ff       	call   8017e7 <close>
+  802974:	83 c4 10             	add    $0x10,%esp
+  802977:	89 bd 44 fd ff ff    	mov    %edi,-0x2bc(%ebp)
+  80297d:	eb 10                	jmp    80298f <execv+0x611>
+  80297f:	89 c7                	mov    %eax,%edi
+  802981:	eb d5                	jmp    802958 <execv+0x5da>
+  802983:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802989:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80298f:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  802995:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802998:	5b                   	pop    %ebx
+  802999:	5e                   	pop    %esi
+  80299a:	5f                   	pop    %edi
+  80299b:	5d                   	pop    %ebp
+  80299c:	c3                   	ret
+  80299d:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  8029a4:	00 00 00 
+  8029a7:	e9 f2 fc ff ff       	jmp    80269e <execv+0x320>
+  8029ac:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8029b1:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  8029b7:	eb d6                	jmp    80298f <execv+0x611>
+  8029b9:	83 ec 08             	sub    $0x8,%esp
+  8029bc:	68 00 00 40 00       	push   $0x400000
+  8029c1:	6a 00                	push   $0x0
+  8029c3:	e8 e6 e4 ff ff       	call   800eae <sys_page_unmap>
+  8029c8:	83 c4 10             	add    $0x10,%esp
+  8029cb:	89 9d 44 fd ff ff    	mov    %ebx,-0x2bc(%ebp)
+  8029d1:	eb bc                	jmp    80298f <execv+0x611>
+  8029d3:	83 ec 04             	sub    $0x4,%esp
+  8029d6:	6a 07                	push   $0x7
+  8029d8:	68 00 00 40 00       	push   $0x400000
+  8029dd:	6a 00                	push   $0x0
+  8029df:	e8 f8 e3 ff ff       	call   800ddc <sys_page_alloc>
+  8029e4:	83 c4 10             	add    $0x10,%esp
+  8029e7:	85 c0                	test   %eax,%eax
+  8029e9:	78 c6                	js     8029b1 <execv+0x633>
+  8029eb:	c7 85 2c fd ff ff 00 	movl   $0x0,-0x2d4(%ebp)
+  8029f2:	00 00 00 
+  8029f5:	c7 85 38 fd ff ff 00 	movl   $0x0,-0x2c8(%ebp)
+  8029fc:	00 00 00 
+  8029ff:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+  802a04:	be 00 10 40 00       	mov    $0x401000,%esi
+  802a09:	e9 f7 fa ff ff       	jmp    802505 <execv+0x187>
+
+00802a0e <spawn>:
+  802a0e:	55                   	push   %ebp
+  802a0f:	89 e5                	mov    %esp,%ebp
+  802a11:	83 ec 0c             	sub    $0xc,%esp
+  802a14:	6a 01                	push   $0x1
+  802a16:	ff 75 0c             	push   0xc(%ebp)
+  802a19:	ff 75 08             	push   0x8(%ebp)
+  802a1c:	e8 5d f9 ff ff       	call   80237e <execv>
+  802a21:	c9                   	leave
+  802a22:	c3                   	ret
+
+00802a23 <exec>:
+  802a23:	55                   	push   %ebp
+  802a24:	89 e5                	mov    %esp,%ebp
+  802a26:	83 ec 0c             	sub    $0xc,%esp
+  802a29:	6a 00                	push   $0x0
+  802a2b:	ff 75 0c             	push   0xc(%ebp)
+  802a2e:	ff 75 08             	push   0x8(%ebp)
+  802a31:	e8 48 f9 ff ff       	call   80237e <execv>
+  802a36:	c9                   	leave
+  802a37:	c3                   	ret
+
+00802a38 <spawnl>:
+  802a38:	55                   	push   %ebp
+  802a39:	89 e5                	mov    %esp,%ebp
+  802a3b:	56                   	push   %esi
+  802a3c:	53                   	push   %ebx
+  802a3d:	8d 45 10             	lea    0x10(%ebp),%eax
+  802a40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a45:	eb 05                	jmp    802a4c <spawnl+0x14>
+  802a47:	83 c1 01             	add    $0x1,%ecx
+  802a4a:	89 d0                	mov    %edx,%eax
+  802a4c:	8d 50 04             	lea    0x4(%eax),%edx
+  802a4f:	83 38 00             	cmpl   $0x0,(%eax)
+  802a52:	75 f3                	jne    802a47 <spawnl+0xf>
+  802a54:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802a5b:	83 e0 f0             	and    $0xfffffff0,%eax
+  802a5e:	29 c4                	sub    %eax,%esp
+  802a60:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802a64:	89 d8                	mov    %ebx,%eax
+  802a66:	c1 e8 02             	shr    $0x2,%eax
+  802a69:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802a6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a6f:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802a76:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802a7d:	00 
+  802a7e:	8d 55 10             	lea    0x10(%ebp),%edx
+  802a81:	89 ce                	mov    %ecx,%esi
+  802a83:	85 c9                	test   %ecx,%ecx
+  802a85:	74 16                	je     802a9d <spawnl+0x65>
+  802a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8c:	83 c0 01             	add    $0x1,%eax
+  802a8f:	89 d1                	mov    %edx,%ecx
+  802a91:	83 c2 04             	add    $0x4,%edx
+  802a94:	8b 09                	mov    (%ecx),%ecx
+  802a96:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802a99:	39 f0                	cmp    %esi,%eax
+  802a9b:	75 ef                	jne    802a8c <spawnl+0x54>
+  802a9d:	83 ec 08             	sub    $0x8,%esp
+  802aa0:	53                   	push   %ebx
+  802aa1:	ff 75 08             	push   0x8(%ebp)
+  802aa4:	e8 65 ff ff ff       	call   802a0e <spawn>
+  802aa9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aac:	5b                   	pop    %ebx
+  802aad:	5e                   	pop    %esi
+  802aae:	5d                   	pop    %ebp
+  802aaf:	c3                   	ret
+
+00802ab0 <execl>:
+  802ab0:	55                   	push   %ebp
+  802ab1:	89 e5                	mov    %esp,%ebp
+  802ab3:	56                   	push   %esi
+  802ab4:	53                   	push   %ebx
+  802ab5:	8d 45 10             	lea    0x10(%ebp),%eax
+  802ab8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802abd:	eb 05                	jmp    802ac4 <execl+0x14>
+  802abf:	83 c1 01             	add    $0x1,%ecx
+  802ac2:	89 d0                	mov    %edx,%eax
+  802ac4:	8d 50 04             	lea    0x4(%eax),%edx
+  802ac7:	83 38 00             	cmpl   $0x0,(%eax)
+  802aca:	75 f3                	jne    802abf <execl+0xf>
+  802acc:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802ad3:	83 e0 f0             	and    $0xfffffff0,%eax
+  802ad6:	29 c4                	sub    %eax,%esp
+  802ad8:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802adc:	89 d8                	mov    %ebx,%eax
+  802ade:	c1 e8 02             	shr    $0x2,%eax
+  802ae1:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802ae4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ae7:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802aee:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802af5:	00 
+  802af6:	8d 55 10             	lea    0x10(%ebp),%edx
+  802af9:	89 ce                	mov    %ecx,%esi
+  802afb:	85 c9                	test   %ecx,%ecx
+  802afd:	74 16                	je     802b15 <execl+0x65>
+  802aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b04:	83 c0 01             	add    $0x1,%eax
+  802b07:	89 d1                	mov    %edx,%ecx
+  802b09:	83 c2 04             	add    $0x4,%edx
+  802b0c:	8b 09                	mov    (%ecx),%ecx
+  802b0e:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802b11:	39 f0                	cmp    %esi,%eax
+  802b13:	75 ef                	jne    802b04 <execl+0x54>
+  802b15:	83 ec 08             	sub    $0x8,%esp
+  802b18:	53                   	push   %ebx
+  802b19:	ff 75 08             	push   0x8(%ebp)
+  802b1c:	e8 02 ff ff ff       	call   802a23 <exec>
+  802b21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b24:	5b                   	pop    %ebx
+  802b25:	5e                   	pop    %esi
+  802b26:	5d                   	pop    %ebp
+  802b27:	c3                   	ret
+
+00802b28 <devsock_stat>:
+  802b28:	55                   	push   %ebp
+  802b29:	89 e5                	mov    %esp,%ebp
+  802b2b:	83 ec 10             	sub    $0x10,%esp
+  802b2e:	68 9e 46 80 00       	push   $0x80469e
+  802b33:	ff 75 0c             	push   0xc(%ebp)
+  802b36:	e8 41 de ff ff       	call   80097c <strcpy>
+  802b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b40:	c9                   	leave
+  802b41:	c3                   	ret
+
+00802b42 <devsock_close>:
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	53                   	push   %ebx
+  802b46:	83 ec 10             	sub    $0x10,%esp
+  802b49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b4c:	53                   	push   %ebx
+  802b4d:	e8 ca 12 00 00       	call   803e1c <pageref>
+  802b52:	89 c2                	mov    %eax,%edx
+  802b54:	83 c4 10             	add    $0x10,%esp
+  802b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5c:	83 fa 01             	cmp    $0x1,%edx
+  802b5f:	74 05                	je     802b66 <devsock_close+0x24>
+  802b61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b64:	c9                   	leave
+  802b65:	c3                   	ret
+  802b66:	83 ec 0c             	sub    $0xc,%esp
+  802b69:	ff 73 0c             	push   0xc(%ebx)
+  802b6c:	e8 aa 02 00 00       	call   802e1b <nsipc_close>
+  802b71:	83 c4 10             	add    $0x10,%esp
+  802b74:	eb eb                	jmp    802b61 <devsock_close+0x1f>
+
+00802b76 <devsock_write>:
+  802b76:	55                   	push   %ebp
+  802b77:	89 e5                	mov    %esp,%ebp
+  802b79:	83 ec 08             	sub    $0x8,%esp
+  802b7c:	6a 00                	push   $0x0
+  802b7e:	ff 75 10             	push   0x10(%ebp)
+  802b81:	ff 75 0c             	push   0xc(%ebp)
+  802b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b87:	ff 70 0c             	push   0xc(%eax)
+  802b8a:	e8 6c 03 00 00       	call   802efb <nsipc_send>
+  802b8f:	c9                   	leave
+  802b90:	c3                   	ret
+
+00802b91 <devsock_read>:
+  802b91:	55                   	push   %ebp
+  802b92:	89 e5                	mov    %esp,%ebp
+  802b94:	83 ec 08             	sub    $0x8,%esp
+  802b97:	6a 00                	push   $0x0
+  802b99:	ff 75 10             	push   0x10(%ebp)
+  802b9c:	ff 75 0c             	push   0xc(%ebp)
+  802b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba2:	ff 70 0c             	push   0xc(%eax)
+  802ba5:	e8 e2 02 00 00       	call   802e8c <nsipc_recv>
+  802baa:	c9                   	leave
+  802bab:	c3                   	ret
+
+00802bac <fd2sockid>:
+  802bac:	55                   	push   %ebp
+  802bad:	89 e5                	mov    %esp,%ebp
+  802baf:	83 ec 20             	sub    $0x20,%esp
+  802bb2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bb5:	52                   	push   %edx
+  802bb6:	50                   	push   %eax
+  802bb7:	e8 05 eb ff ff       	call   8016c1 <fd_lookup>
+  802bbc:	83 c4 10             	add    $0x10,%esp
+  802bbf:	85 c0                	test   %eax,%eax
+  802bc1:	78 10                	js     802bd3 <fd2sockid+0x27>
+  802bc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc6:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802bcc:	39 08                	cmp    %ecx,(%eax)
+  802bce:	75 05                	jne    802bd5 <fd2sockid+0x29>
+  802bd0:	8b 40 0c             	mov    0xc(%eax),%eax
+  802bd3:	c9                   	leave
+  802bd4:	c3                   	ret
+  802bd5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bda:	eb f7                	jmp    802bd3 <fd2sockid+0x27>
+
+00802bdc <alloc_sockfd>:
+  802bdc:	55                   	push   %ebp
+  802bdd:	89 e5                	mov    %esp,%ebp
+  802bdf:	56                   	push   %esi
+  802be0:	53                   	push   %ebx
+  802be1:	83 ec 1c             	sub    $0x1c,%esp
+  802be4:	89 c6                	mov    %eax,%esi
+  802be6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802be9:	50                   	push   %eax
+  802bea:	e8 82 ea ff ff       	call   801671 <fd_alloc>
+  802bef:	89 c3                	mov    %eax,%ebx
+  802bf1:	83 c4 10             	add    $0x10,%esp
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	78 43                	js     802c3b <alloc_sockfd+0x5f>
+  802bf8:	83 ec 04             	sub    $0x4,%esp
+  802bfb:	68 07 04 00 00       	push   $0x407
+  802c00:	ff 75 f4             	push   -0xc(%ebp)
+  802c03:	6a 00                	push   $0x0
+  802c05:	e8 d2 e1 ff ff       	call   800ddc <sys_page_alloc>
+  802c0a:	89 c3                	mov    %eax,%ebx
+  802c0c:	83 c4 10             	add    $0x10,%esp
+  802c0f:	85 c0                	test   %eax,%eax
+  802c11:	78 28                	js     802c3b <alloc_sockfd+0x5f>
+  802c13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c16:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802c1c:	89 10                	mov    %edx,(%eax)
+  802c1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c21:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c28:	89 70 0c             	mov    %esi,0xc(%eax)
+  802c2b:	83 ec 0c             	sub    $0xc,%esp
+  802c2e:	50                   	push   %eax
+  802c2f:	e8 16 ea ff ff       	call   80164a <fd2num>
+  802c34:	89 c3                	mov    %eax,%ebx
+  802c36:	83 c4 10             	add    $0x10,%esp
+  802c39:	eb 0c                	jmp    802c47 <alloc_sockfd+0x6b>
+  802c3b:	83 ec 0c             	sub    $0xc,%esp
+  802c3e:	56                   	push   %esi
+  802c3f:	e8 d7 01 00 00       	call   802e1b <nsipc_close>
+  802c44:	83 c4 10             	add    $0x10,%esp
+  802c47:	89 d8                	mov    %ebx,%eax
+  802c49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c4c:	5b                   	pop    %ebx
+  802c4d:	5e                   	pop    %esi
+  802c4e:	5d                   	pop    %ebp
+  802c4f:	c3                   	ret
+
+00802c50 <accept>:
+  802c50:	55                   	push   %ebp
+  802c51:	89 e5                	mov    %esp,%ebp
+  802c53:	83 ec 08             	sub    $0x8,%esp
+  802c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c59:	e8 4e ff ff ff       	call   802bac <fd2sockid>
+  802c5e:	85 c0                	test   %eax,%eax
+  802c60:	78 1b                	js     802c7d <accept+0x2d>
+  802c62:	83 ec 04             	sub    $0x4,%esp
+  802c65:	ff 75 10             	push   0x10(%ebp)
+  802c68:	ff 75 0c             	push   0xc(%ebp)
+  802c6b:	50                   	push   %eax
+  802c6c:	e8 07 01 00 00       	call   802d78 <nsipc_accept>
+  802c71:	83 c4 10             	add    $0x10,%esp
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	78 05                	js     802c7d <accept+0x2d>
+  802c78:	e8 5f ff ff ff       	call   802bdc <alloc_sockfd>
+  802c7d:	c9                   	leave
+  802c7e:	c3                   	ret
+
+00802c7f <bind>:
+  802c7f:	55                   	push   %ebp
+  802c80:	89 e5                	mov    %esp,%ebp
+  802c82:	83 ec 08             	sub    $0x8,%esp
+  802c85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c88:	e8 1f ff ff ff       	call   802bac <fd2sockid>
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	78 12                	js     802ca3 <bind+0x24>
+  802c91:	83 ec 04             	sub    $0x4,%esp
+  802c94:	ff 75 10             	push   0x10(%ebp)
+  802c97:	ff 75 0c             	push   0xc(%ebp)
+  802c9a:	50                   	push   %eax
+  802c9b:	e8 24 01 00 00       	call   802dc4 <nsipc_bind>
+  802ca0:	83 c4 10             	add    $0x10,%esp
+  802ca3:	c9                   	leave
+  802ca4:	c3                   	ret
+
+00802ca5 <shutdown>:
+  802ca5:	55                   	push   %ebp
+  802ca6:	89 e5                	mov    %esp,%ebp
+  802ca8:	83 ec 08             	sub    $0x8,%esp
+  802cab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cae:	e8 f9 fe ff ff       	call   802bac <fd2sockid>
+  802cb3:	85 c0                	test   %eax,%eax
+  802cb5:	78 0f                	js     802cc6 <shutdown+0x21>
+  802cb7:	83 ec 08             	sub    $0x8,%esp
+  802cba:	ff 75 0c             	push   0xc(%ebp)
+  802cbd:	50                   	push   %eax
+  802cbe:	e8 36 01 00 00       	call   802df9 <nsipc_shutdown>
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	c9                   	leave
+  802cc7:	c3                   	ret
+
+00802cc8 <connect>:
+  802cc8:	55                   	push   %ebp
+  802cc9:	89 e5                	mov    %esp,%ebp
+  802ccb:	83 ec 08             	sub    $0x8,%esp
+  802cce:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd1:	e8 d6 fe ff ff       	call   802bac <fd2sockid>
+  802cd6:	85 c0                	test   %eax,%eax
+  802cd8:	78 12                	js     802cec <connect+0x24>
+  802cda:	83 ec 04             	sub    $0x4,%esp
+  802cdd:	ff 75 10             	push   0x10(%ebp)
+  802ce0:	ff 75 0c             	push   0xc(%ebp)
+  802ce3:	50                   	push   %eax
+  802ce4:	e8 4c 01 00 00       	call   802e35 <nsipc_connect>
+  802ce9:	83 c4 10             	add    $0x10,%esp
+  802cec:	c9                   	leave
+  802ced:	c3                   	ret
+
+00802cee <listen>:
+  802cee:	55                   	push   %ebp
+  802cef:	89 e5                	mov    %esp,%ebp
+  802cf1:	83 ec 08             	sub    $0x8,%esp
+  802cf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf7:	e8 b0 fe ff ff       	call   802bac <fd2sockid>
+  802cfc:	85 c0                	test   %eax,%eax
+  802cfe:	78 0f                	js     802d0f <listen+0x21>
+  802d00:	83 ec 08             	sub    $0x8,%esp
+  802d03:	ff 75 0c             	push   0xc(%ebp)
+  802d06:	50                   	push   %eax
+  802d07:	e8 5e 01 00 00       	call   802e6a <nsipc_listen>
+  802d0c:	83 c4 10             	add    $0x10,%esp
+  802d0f:	c9                   	leave
+  802d10:	c3                   	ret
+
+00802d11 <socket>:
+  802d11:	55                   	push   %ebp
+  802d12:	89 e5                	mov    %esp,%ebp
+  802d14:	83 ec 0c             	sub    $0xc,%esp
+  802d17:	ff 75 10             	push   0x10(%ebp)
+  802d1a:	ff 75 0c             	push   0xc(%ebp)
+  802d1d:	ff 75 08             	push   0x8(%ebp)
+  802d20:	e8 34 02 00 00       	call   802f59 <nsipc_socket>
+  802d25:	83 c4 10             	add    $0x10,%esp
+  802d28:	85 c0                	test   %eax,%eax
+  802d2a:	78 05                	js     802d31 <socket+0x20>
+  802d2c:	e8 ab fe ff ff       	call   802bdc <alloc_sockfd>
+  802d31:	c9                   	leave
+  802d32:	c3                   	ret
+
+00802d33 <nsipc>:
+  802d33:	55                   	push   %ebp
+  802d34:	89 e5                	mov    %esp,%ebp
+  802d36:	53                   	push   %ebx
+  802d37:	83 ec 04             	sub    $0x4,%esp
+  802d3a:	89 c3                	mov    %eax,%ebx
+  802d3c:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802d43:	74 1f                	je     802d64 <nsipc+0x31>
+  802d45:	83 ec 08             	sub    $0x8,%esp
+  802d48:	6a 00                	push   $0x0
+  802d4a:	6a 00                	push   $0x0
+  802d4c:	6a 07                	push   $0x7
+  802d4e:	68 00 80 80 00       	push   $0x808000
+  802d53:	53                   	push   %ebx
+  802d54:	ff 35 0c 60 80 00    	push   0x80600c
+  802d5a:	e8 08 0f 00 00       	call   803c67 <ipc_call>
+  802d5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+  802d64:	83 ec 0c             	sub    $0xc,%esp
+  802d67:	6a 03                	push   $0x3
+  802d69:	e8 94 10 00 00       	call   803e02 <ipc_find_env>
+  802d6e:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	eb cd                	jmp    802d45 <nsipc+0x12>
+
+00802d78 <nsipc_accept>:
+  802d78:	55                   	push   %ebp
+  802d79:	89 e5                	mov    %esp,%ebp
+  802d7b:	53                   	push   %ebx
+  802d7c:	83 ec 04             	sub    $0x4,%esp
+  802d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d82:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d87:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d8c:	e8 a2 ff ff ff       	call   802d33 <nsipc>
+  802d91:	89 c3                	mov    %eax,%ebx
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	79 07                	jns    802d9e <nsipc_accept+0x26>
+  802d97:	89 d8                	mov    %ebx,%eax
+  802d99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d9c:	c9                   	leave
+  802d9d:	c3                   	ret
+  802d9e:	83 ec 04             	sub    $0x4,%esp
+  802da1:	ff 35 10 80 80 00    	push   0x808010
+  802da7:	68 00 80 80 00       	push   $0x808000
+  802dac:	ff 75 0c             	push   0xc(%ebp)
+  802daf:	e8 78 dd ff ff       	call   800b2c <memmove>
+  802db4:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802dba:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dbd:	89 10                	mov    %edx,(%eax)
+  802dbf:	83 c4 10             	add    $0x10,%esp
+  802dc2:	eb d3                	jmp    802d97 <nsipc_accept+0x1f>
+
+00802dc4 <nsipc_bind>:
+  802dc4:	55                   	push   %ebp
+  802dc5:	89 e5                	mov    %esp,%ebp
+  802dc7:	53                   	push   %ebx
+  802dc8:	83 ec 08             	sub    $0x8,%esp
+  802dcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dce:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd1:	a3 00 80 80 00       	mov    %eax,0x808000
+  802dd6:	53                   	push   %ebx
+  802dd7:	ff 75 0c             	push   0xc(%ebp)
+  802dda:	68 04 80 80 00       	push   $0x808004
+  802ddf:	e8 48 dd ff ff       	call   800b2c <memmove>
+  802de4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802dea:	b8 02 00 00 00       	mov    $0x2,%eax
+  802def:	e8 3f ff ff ff       	call   802d33 <nsipc>
+  802df4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df7:	c9                   	leave
+  802df8:	c3                   	ret
+
+00802df9 <nsipc_shutdown>:
+  802df9:	55                   	push   %ebp
+  802dfa:	89 e5                	mov    %esp,%ebp
+  802dfc:	83 ec 08             	sub    $0x8,%esp
+  802dff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e02:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e0a:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e0f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e14:	e8 1a ff ff ff       	call   802d33 <nsipc>
+  802e19:	c9                   	leave
+  802e1a:	c3                   	ret
+
+00802e1b <nsipc_close>:
+  802e1b:	55                   	push   %ebp
+  802e1c:	89 e5                	mov    %esp,%ebp
+  802e1e:	83 ec 08             	sub    $0x8,%esp
+  802e21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e24:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e29:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e2e:	e8 00 ff ff ff       	call   802d33 <nsipc>
+  802e33:	c9                   	leave
+  802e34:	c3                   	ret
+
+00802e35 <nsipc_connect>:
+  802e35:	55                   	push   %ebp
+  802e36:	89 e5                	mov    %esp,%ebp
+  802e38:	53                   	push   %ebx
+  802e39:	83 ec 08             	sub    $0x8,%esp
+  802e3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e42:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e47:	53                   	push   %ebx
+  802e48:	ff 75 0c             	push   0xc(%ebp)
+  802e4b:	68 04 80 80 00       	push   $0x808004
+  802e50:	e8 d7 dc ff ff       	call   800b2c <memmove>
+  802e55:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802e5b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e60:	e8 ce fe ff ff       	call   802d33 <nsipc>
+  802e65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e68:	c9                   	leave
+  802e69:	c3                   	ret
+
+00802e6a <nsipc_listen>:
+  802e6a:	55                   	push   %ebp
+  802e6b:	89 e5                	mov    %esp,%ebp
+  802e6d:	83 ec 08             	sub    $0x8,%esp
+  802e70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e73:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e7b:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e80:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e85:	e8 a9 fe ff ff       	call   802d33 <nsipc>
+  802e8a:	c9                   	leave
+  802e8b:	c3                   	ret
+
+00802e8c <nsipc_recv>:
+  802e8c:	55                   	push   %ebp
+  802e8d:	89 e5                	mov    %esp,%ebp
+  802e8f:	56                   	push   %esi
+  802e90:	53                   	push   %ebx
+  802e91:	8b 75 10             	mov    0x10(%ebp),%esi
+  802e94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e97:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e9c:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802ea2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea5:	a3 08 80 80 00       	mov    %eax,0x808008
+  802eaa:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eaf:	e8 7f fe ff ff       	call   802d33 <nsipc>
+  802eb4:	89 c3                	mov    %eax,%ebx
+  802eb6:	85 c0                	test   %eax,%eax
+  802eb8:	78 22                	js     802edc <nsipc_recv+0x50>
+  802eba:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ebf:	39 c6                	cmp    %eax,%esi
+  802ec1:	0f 4e c6             	cmovle %esi,%eax
+  802ec4:	39 c3                	cmp    %eax,%ebx
+  802ec6:	7f 1d                	jg     802ee5 <nsipc_recv+0x59>
+  802ec8:	83 ec 04             	sub    $0x4,%esp
+  802ecb:	53                   	push   %ebx
+  802ecc:	68 00 80 80 00       	push   $0x808000
+  802ed1:	ff 75 0c             	push   0xc(%ebp)
+  802ed4:	e8 53 dc ff ff       	call   800b2c <memmove>
+  802ed9:	83 c4 10             	add    $0x10,%esp
+  802edc:	89 d8                	mov    %ebx,%eax
+  802ede:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ee1:	5b                   	pop    %ebx
+  802ee2:	5e                   	pop    %esi
+  802ee3:	5d                   	pop    %ebp
+  802ee4:	c3                   	ret
+  802ee5:	68 aa 46 80 00       	push   $0x8046aa
+  802eea:	68 0b 46 80 00       	push   $0x80460b
+  802eef:	6a 60                	push   $0x60
+  802ef1:	68 bf 46 80 00       	push   $0x8046bf
+  802ef6:	e8 af d2 ff ff       	call   8001aa <_panic>
+
+00802efb <nsipc_send>:
+  802efb:	55                   	push   %ebp
+  802efc:	89 e5                	mov    %esp,%ebp
+  802efe:	53                   	push   %ebx
+  802eff:	83 ec 04             	sub    $0x4,%esp
+  802f02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f08:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f0d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f13:	7f 2e                	jg     802f43 <nsipc_send+0x48>
+  802f15:	83 ec 04             	sub    $0x4,%esp
+  802f18:	53                   	push   %ebx
+  802f19:	ff 75 0c             	push   0xc(%ebp)
+  802f1c:	68 0c 80 80 00       	push   $0x80800c
+  802f21:	e8 06 dc ff ff       	call   800b2c <memmove>
+  802f26:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802f2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2f:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f34:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f39:	e8 f5 fd ff ff       	call   802d33 <nsipc>
+  802f3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f41:	c9                   	leave
+  802f42:	c3                   	ret
+  802f43:	68 cb 46 80 00       	push   $0x8046cb
+  802f48:	68 0b 46 80 00       	push   $0x80460b
+  802f4d:	6a 6b                	push   $0x6b
+  802f4f:	68 bf 46 80 00       	push   $0x8046bf
+  802f54:	e8 51 d2 ff ff       	call   8001aa <_panic>
+
+00802f59 <nsipc_socket>:
+  802f59:	55                   	push   %ebp
+  802f5a:	89 e5                	mov    %esp,%ebp
+  802f5c:	83 ec 08             	sub    $0x8,%esp
+  802f5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f62:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f6a:	a3 04 80 80 00       	mov    %eax,0x808004
+  802f6f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f72:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f77:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f7c:	e8 b2 fd ff ff       	call   802d33 <nsipc>
+  802f81:	c9                   	leave
+  802f82:	c3                   	ret
+
+00802f83 <devpipe_stat>:
+  802f83:	55                   	push   %ebp
+  802f84:	89 e5                	mov    %esp,%ebp
+  802f86:	56                   	push   %esi
+  802f87:	53                   	push   %ebx
+  802f88:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802f8b:	83 ec 0c             	sub    $0xc,%esp
+  802f8e:	ff 75 08             	push   0x8(%ebp)
+  802f91:	e8 c4 e6 ff ff       	call   80165a <fd2data>
+  802f96:	89 c6                	mov    %eax,%esi
+  802f98:	83 c4 08             	add    $0x8,%esp
+  802f9b:	68 d7 46 80 00       	push   $0x8046d7
+  802fa0:	53                   	push   %ebx
+  802fa1:	e8 d6 d9 ff ff       	call   80097c <strcpy>
+  802fa6:	8b 46 04             	mov    0x4(%esi),%eax
+  802fa9:	2b 06                	sub    (%esi),%eax
+  802fab:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802fb1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fb8:	00 00 00 
+  802fbb:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802fc2:	50 80 00 
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fcd:	5b                   	pop    %ebx
+  802fce:	5e                   	pop    %esi
+  802fcf:	5d                   	pop    %ebp
+  802fd0:	c3                   	ret
+
+00802fd1 <devpipe_close>:
+  802fd1:	55                   	push   %ebp
+  802fd2:	89 e5                	mov    %esp,%ebp
+  802fd4:	53                   	push   %ebx
+  802fd5:	83 ec 0c             	sub    $0xc,%esp
+  802fd8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fdb:	53                   	push   %ebx
+  802fdc:	6a 00                	push   $0x0
+  802fde:	e8 cb de ff ff       	call   800eae <sys_page_unmap>
+  802fe3:	89 1c 24             	mov    %ebx,(%esp)
+  802fe6:	e8 6f e6 ff ff       	call   80165a <fd2data>
+  802feb:	83 c4 08             	add    $0x8,%esp
+  802fee:	50                   	push   %eax
+  802fef:	6a 00                	push   $0x0
+  802ff1:	e8 b8 de ff ff       	call   800eae <sys_page_unmap>
+  802ff6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+
+00802ffb <_pipeisclosed>:
+  802ffb:	55                   	push   %ebp
+  802ffc:	89 e5                	mov    %esp,%ebp
+  802ffe:	57                   	push   %edi
+  802fff:	56                   	push   %esi
+  803000:	53                   	push   %ebx
+  803001:	83 ec 1c             	sub    $0x1c,%esp
+  803004:	89 c7                	mov    %eax,%edi
+  803006:	89 d6                	mov    %edx,%esi
+  803008:	a1 14 60 80 00       	mov    0x806014,%eax
+  80300d:	8b 58 58             	mov    0x58(%eax),%ebx
+  803010:	83 ec 0c             	sub    $0xc,%esp
+  803013:	57                   	push   %edi
+  803014:	e8 03 0e 00 00       	call   803e1c <pageref>
+  803019:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80301c:	89 34 24             	mov    %esi,(%esp)
+  80301f:	e8 f8 0d 00 00       	call   803e1c <pageref>
+  803024:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  80302a:	8b 4a 58             	mov    0x58(%edx),%ecx
+  80302d:	83 c4 10             	add    $0x10,%esp
+  803030:	39 cb                	cmp    %ecx,%ebx
+  803032:	74 1b                	je     80304f <_pipeisclosed+0x54>
+  803034:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803037:	75 cf                	jne    803008 <_pipeisclosed+0xd>
+  803039:	8b 42 58             	mov    0x58(%edx),%eax
+  80303c:	6a 01                	push   $0x1
+  80303e:	50                   	push   %eax
+  80303f:	53                   	push   %ebx
+  803040:	68 de 46 80 00       	push   $0x8046de
+  803045:	e8 3b d2 ff ff       	call   800285 <cprintf>
+  80304a:	83 c4 10             	add    $0x10,%esp
+  80304d:	eb b9                	jmp    803008 <_pipeisclosed+0xd>
+  80304f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803052:	0f 94 c0             	sete   %al
+  803055:	0f b6 c0             	movzbl %al,%eax
+  803058:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80305b:	5b                   	pop    %ebx
+  80305c:	5e                   	pop    %esi
+  80305d:	5f                   	pop    %edi
+  80305e:	5d                   	pop    %ebp
+  80305f:	c3                   	ret
+
+00803060 <devpipe_write>:
+  803060:	55                   	push   %ebp
+  803061:	89 e5                	mov    %esp,%ebp
+  803063:	57                   	push   %edi
+  803064:	56                   	push   %esi
+  803065:	53                   	push   %ebx
+  803066:	83 ec 28             	sub    $0x28,%esp
+  803069:	8b 75 08             	mov    0x8(%ebp),%esi
+  80306c:	56                   	push   %esi
+  80306d:	e8 e8 e5 ff ff       	call   80165a <fd2data>
+  803072:	89 c3                	mov    %eax,%ebx
+  803074:	83 c4 10             	add    $0x10,%esp
+  803077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803080:	74 5c                	je     8030de <devpipe_write+0x7e>
+  803082:	8b 43 04             	mov    0x4(%ebx),%eax
+  803085:	8b 0b                	mov    (%ebx),%ecx
+  803087:	8d 51 20             	lea    0x20(%ecx),%edx
+  80308a:	39 d0                	cmp    %edx,%eax
+  80308c:	72 1e                	jb     8030ac <devpipe_write+0x4c>
+  80308e:	89 da                	mov    %ebx,%edx
+  803090:	89 f0                	mov    %esi,%eax
+  803092:	e8 64 ff ff ff       	call   802ffb <_pipeisclosed>
+  803097:	85 c0                	test   %eax,%eax
+  803099:	75 48                	jne    8030e3 <devpipe_write+0x83>
+  80309b:	e8 f1 dc ff ff       	call   800d91 <sys_yield>
+  8030a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030a3:	8b 0b                	mov    (%ebx),%ecx
+  8030a5:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030a8:	39 d0                	cmp    %edx,%eax
+  8030aa:	73 e2                	jae    80308e <devpipe_write+0x2e>
+  8030ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030af:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030b3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030b6:	89 c2                	mov    %eax,%edx
+  8030b8:	c1 fa 1f             	sar    $0x1f,%edx
+  8030bb:	89 d1                	mov    %edx,%ecx
+  8030bd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030c0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030c3:	83 e2 1f             	and    $0x1f,%edx
+  8030c6:	29 ca                	sub    %ecx,%edx
+  8030c8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030cc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8030d0:	83 c0 01             	add    $0x1,%eax
+  8030d3:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030d6:	83 c7 01             	add    $0x1,%edi
+  8030d9:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8030dc:	75 a4                	jne    803082 <devpipe_write+0x22>
+  8030de:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030e1:	eb 05                	jmp    8030e8 <devpipe_write+0x88>
+  8030e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030eb:	5b                   	pop    %ebx
+  8030ec:	5e                   	pop    %esi
+  8030ed:	5f                   	pop    %edi
+  8030ee:	5d                   	pop    %ebp
+  8030ef:	c3                   	ret
+
+008030f0 <devpipe_read>:
+  8030f0:	55                   	push   %ebp
+  8030f1:	89 e5                	mov    %esp,%ebp
+  8030f3:	57                   	push   %edi
+  8030f4:	56                   	push   %esi
+  8030f5:	53                   	push   %ebx
+  8030f6:	83 ec 18             	sub    $0x18,%esp
+  8030f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030fc:	56                   	push   %esi
+  8030fd:	e8 58 e5 ff ff       	call   80165a <fd2data>
+  803102:	89 c3                	mov    %eax,%ebx
+  803104:	83 c4 10             	add    $0x10,%esp
+  803107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803110:	74 45                	je     803157 <devpipe_read+0x67>
+  803112:	8b 03                	mov    (%ebx),%eax
+  803114:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803117:	75 1d                	jne    803136 <devpipe_read+0x46>
+  803119:	85 ff                	test   %edi,%edi
+  80311b:	75 3f                	jne    80315c <devpipe_read+0x6c>
+  80311d:	89 da                	mov    %ebx,%edx
+  80311f:	89 f0                	mov    %esi,%eax
+  803121:	e8 d5 fe ff ff       	call   802ffb <_pipeisclosed>
+  803126:	85 c0                	test   %eax,%eax
+  803128:	75 3c                	jne    803166 <devpipe_read+0x76>
+  80312a:	e8 62 dc ff ff       	call   800d91 <sys_yield>
+  80312f:	8b 03                	mov    (%ebx),%eax
+  803131:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803134:	74 e7                	je     80311d <devpipe_read+0x2d>
+  803136:	99                   	cltd
+  803137:	c1 ea 1b             	shr    $0x1b,%edx
+  80313a:	01 d0                	add    %edx,%eax
+  80313c:	83 e0 1f             	and    $0x1f,%eax
+  80313f:	29 d0                	sub    %edx,%eax
+  803141:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803146:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803149:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80314c:	83 03 01             	addl   $0x1,(%ebx)
+  80314f:	83 c7 01             	add    $0x1,%edi
+  803152:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803155:	75 bb                	jne    803112 <devpipe_read+0x22>
+  803157:	8b 45 10             	mov    0x10(%ebp),%eax
+  80315a:	eb 02                	jmp    80315e <devpipe_read+0x6e>
+  80315c:	89 f8                	mov    %edi,%eax
+  80315e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803161:	5b                   	pop    %ebx
+  803162:	5e                   	pop    %esi
+  803163:	5f                   	pop    %edi
+  803164:	5d                   	pop    %ebp
+  803165:	c3                   	ret
+  803166:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316b:	eb f1                	jmp    80315e <devpipe_read+0x6e>
+
+0080316d <pipe>:
+  80316d:	55                   	push   %ebp
+  80316e:	89 e5                	mov    %esp,%ebp
+  803170:	56                   	push   %esi
+  803171:	53                   	push   %ebx
+  803172:	83 ec 1c             	sub    $0x1c,%esp
+  803175:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803178:	50                   	push   %eax
+  803179:	e8 f3 e4 ff ff       	call   801671 <fd_alloc>
+  80317e:	89 c3                	mov    %eax,%ebx
+  803180:	83 c4 10             	add    $0x10,%esp
+  803183:	85 c0                	test   %eax,%eax
+  803185:	0f 88 23 01 00 00    	js     8032ae <pipe+0x141>
+  80318b:	83 ec 04             	sub    $0x4,%esp
+  80318e:	68 07 04 00 00       	push   $0x407
+  803193:	ff 75 f4             	push   -0xc(%ebp)
+  803196:	6a 00                	push   $0x0
+  803198:	e8 3f dc ff ff       	call   800ddc <sys_page_alloc>
+  80319d:	89 c3                	mov    %eax,%ebx
+  80319f:	83 c4 10             	add    $0x10,%esp
+  8031a2:	85 c0                	test   %eax,%eax
+  8031a4:	0f 88 04 01 00 00    	js     8032ae <pipe+0x141>
+  8031aa:	83 ec 0c             	sub    $0xc,%esp
+  8031ad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031b0:	50                   	push   %eax
+  8031b1:	e8 bb e4 ff ff       	call   801671 <fd_alloc>
+  8031b6:	89 c3                	mov    %eax,%ebx
+  8031b8:	83 c4 10             	add    $0x10,%esp
+  8031bb:	85 c0                	test   %eax,%eax
+  8031bd:	0f 88 db 00 00 00    	js     80329e <pipe+0x131>
+  8031c3:	83 ec 04             	sub    $0x4,%esp
+  8031c6:	68 07 04 00 00       	push   $0x407
+  8031cb:	ff 75 f0             	push   -0x10(%ebp)
+  8031ce:	6a 00                	push   $0x0
+  8031d0:	e8 07 dc ff ff       	call   800ddc <sys_page_alloc>
+  8031d5:	89 c3                	mov    %eax,%ebx
+  8031d7:	83 c4 10             	add    $0x10,%esp
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	0f 88 bc 00 00 00    	js     80329e <pipe+0x131>
+  8031e2:	83 ec 0c             	sub    $0xc,%esp
+  8031e5:	ff 75 f4             	push   -0xc(%ebp)
+  8031e8:	e8 6d e4 ff ff       	call   80165a <fd2data>
+  8031ed:	89 c6                	mov    %eax,%esi
+  8031ef:	83 c4 0c             	add    $0xc,%esp
+  8031f2:	68 07 04 00 00       	push   $0x407
+  8031f7:	50                   	push   %eax
+  8031f8:	6a 00                	push   $0x0
+  8031fa:	e8 dd db ff ff       	call   800ddc <sys_page_alloc>
+  8031ff:	89 c3                	mov    %eax,%ebx
+  803201:	83 c4 10             	add    $0x10,%esp
+  803204:	85 c0                	test   %eax,%eax
+  803206:	0f 88 82 00 00 00    	js     80328e <pipe+0x121>
+  80320c:	83 ec 0c             	sub    $0xc,%esp
+  80320f:	ff 75 f0             	push   -0x10(%ebp)
+  803212:	e8 43 e4 ff ff       	call   80165a <fd2data>
+  803217:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80321e:	50                   	push   %eax
+  80321f:	6a 00                	push   $0x0
+  803221:	56                   	push   %esi
+  803222:	6a 00                	push   $0x0
+  803224:	e8 f6 db ff ff       	call   800e1f <sys_page_map>
+  803229:	89 c3                	mov    %eax,%ebx
+  80322b:	83 c4 20             	add    $0x20,%esp
+  80322e:	85 c0                	test   %eax,%eax
+  803230:	78 4e                	js     803280 <pipe+0x113>
+  803232:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  803237:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80323a:	89 02                	mov    %eax,(%edx)
+  80323c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80323f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803246:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803249:	89 02                	mov    %eax,(%edx)
+  80324b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80324e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803255:	83 ec 0c             	sub    $0xc,%esp
+  803258:	ff 75 f4             	push   -0xc(%ebp)
+  80325b:	e8 ea e3 ff ff       	call   80164a <fd2num>
+  803260:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803263:	89 01                	mov    %eax,(%ecx)
+  803265:	83 c4 04             	add    $0x4,%esp
+  803268:	ff 75 f0             	push   -0x10(%ebp)
+  80326b:	e8 da e3 ff ff       	call   80164a <fd2num>
+  803270:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803273:	89 41 04             	mov    %eax,0x4(%ecx)
+  803276:	83 c4 10             	add    $0x10,%esp
+  803279:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80327e:	eb 2e                	jmp    8032ae <pipe+0x141>
+  803280:	83 ec 08             	sub    $0x8,%esp
+  803283:	56                   	push   %esi
+  803284:	6a 00                	push   $0x0
+  803286:	e8 23 dc ff ff       	call   800eae <sys_page_unmap>
+  80328b:	83 c4 10             	add    $0x10,%esp
+  80328e:	83 ec 08             	sub    $0x8,%esp
+  803291:	ff 75 f0             	push   -0x10(%ebp)
+  803294:	6a 00                	push   $0x0
+  803296:	e8 13 dc ff ff       	call   800eae <sys_page_unmap>
+  80329b:	83 c4 10             	add    $0x10,%esp
+  80329e:	83 ec 08             	sub    $0x8,%esp
+  8032a1:	ff 75 f4             	push   -0xc(%ebp)
+  8032a4:	6a 00                	push   $0x0
+  8032a6:	e8 03 dc ff ff       	call   800eae <sys_page_unmap>
+  8032ab:	83 c4 10             	add    $0x10,%esp
+  8032ae:	89 d8                	mov    %ebx,%eax
+  8032b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b3:	5b                   	pop    %ebx
+  8032b4:	5e                   	pop    %esi
+  8032b5:	5d                   	pop    %ebp
+  8032b6:	c3                   	ret
+
+008032b7 <pipeisclosed>:
+  8032b7:	55                   	push   %ebp
+  8032b8:	89 e5                	mov    %esp,%ebp
+  8032ba:	83 ec 20             	sub    $0x20,%esp
+  8032bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032c0:	50                   	push   %eax
+  8032c1:	ff 75 08             	push   0x8(%ebp)
+  8032c4:	e8 f8 e3 ff ff       	call   8016c1 <fd_lookup>
+  8032c9:	83 c4 10             	add    $0x10,%esp
+  8032cc:	85 c0                	test   %eax,%eax
+  8032ce:	78 18                	js     8032e8 <pipeisclosed+0x31>
+  8032d0:	83 ec 0c             	sub    $0xc,%esp
+  8032d3:	ff 75 f4             	push   -0xc(%ebp)
+  8032d6:	e8 7f e3 ff ff       	call   80165a <fd2data>
+  8032db:	89 c2                	mov    %eax,%edx
+  8032dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e0:	e8 16 fd ff ff       	call   802ffb <_pipeisclosed>
+  8032e5:	83 c4 10             	add    $0x10,%esp
+  8032e8:	c9                   	leave
+  8032e9:	c3                   	ret
+
+008032ea <ipcring_init>:
+  8032ea:	55                   	push   %ebp
+  8032eb:	89 e5                	mov    %esp,%ebp
+  8032ed:	53                   	push   %ebx
+  8032ee:	83 ec 08             	sub    $0x8,%esp
+  8032f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8032f4:	6a 60                	push   $0x60
+  8032f6:	6a 00                	push   $0x0
+  8032f8:	53                   	push   %ebx
+  8032f9:	e8 f9 d7 ff ff       	call   800af7 <memset>
+  8032fe:	a1 14 60 80 00       	mov    0x806014,%eax
+  803303:	8b 40 48             	mov    0x48(%eax),%eax
+  803306:	89 03                	mov    %eax,(%ebx)
+  803308:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80330b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80330e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803311:	89 43 08             	mov    %eax,0x8(%ebx)
+  803314:	8b 45 14             	mov    0x14(%ebp),%eax
+  803317:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80331a:	83 c4 10             	add    $0x10,%esp
+  80331d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803320:	c9                   	leave
+  803321:	c3                   	ret
+
+00803322 <ipcring_req_slot>:
+  803322:	55                   	push   %ebp
+  803323:	89 e5                	mov    %esp,%ebp
+  803325:	8b 45 08             	mov    0x8(%ebp),%eax
+  803328:	8b 50 10             	mov    0x10(%eax),%edx
+  80332b:	8b 48 18             	mov    0x18(%eax),%ecx
+  80332e:	29 ca                	sub    %ecx,%edx
+  803330:	83 fa 07             	cmp    $0x7,%edx
+  803333:	77 0c                	ja     803341 <ipcring_req_slot+0x1f>
+  803335:	8b 50 10             	mov    0x10(%eax),%edx
+  803338:	83 e2 07             	and    $0x7,%edx
+  80333b:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80333f:	5d                   	pop    %ebp
+  803340:	c3                   	ret
+  803341:	b8 00 00 00 00       	mov    $0x0,%eax
+  803346:	eb f7                	jmp    80333f <ipcring_req_slot+0x1d>
+
+00803348 <ipcring_req_push>:
+  803348:	55                   	push   %ebp
+  803349:	89 e5                	mov    %esp,%ebp
+  80334b:	83 ec 08             	sub    $0x8,%esp
+  80334e:	8b 55 08             	mov    0x8(%ebp),%edx
+  803351:	8b 42 10             	mov    0x10(%edx),%eax
+  803354:	83 c0 01             	add    $0x1,%eax
+  803357:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80335b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803360:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803364:	85 c0                	test   %eax,%eax
+  803366:	75 02                	jne    80336a <ipcring_req_push+0x22>
+  803368:	c9                   	leave
+  803369:	c3                   	ret
+  80336a:	6a 00                	push   $0x0
+  80336c:	68 00 00 80 ee       	push   $0xee800000
+  803371:	ff 72 08             	push   0x8(%edx)
+  803374:	ff 72 04             	push   0x4(%edx)
+  803377:	e8 98 dd ff ff       	call   801114 <sys_ipc_send>
+  80337c:	83 c4 10             	add    $0x10,%esp
+  80337f:	eb e7                	jmp    803368 <ipcring_req_push+0x20>
+
+00803381 <ipcring_rsp_wait>:
+  803381:	55                   	push   %ebp
+  803382:	89 e5                	mov    %esp,%ebp
+  803384:	53                   	push   %ebx
+  803385:	83 ec 04             	sub    $0x4,%esp
+  803388:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80338b:	8b 53 18             	mov    0x18(%ebx),%edx
+  80338e:	8b 43 10             	mov    0x10(%ebx),%eax
+  803391:	39 c2                	cmp    %eax,%edx
+  803393:	74 3c                	je     8033d1 <ipcring_rsp_wait+0x50>
+  803395:	8b 53 14             	mov    0x14(%ebx),%edx
+  803398:	8b 43 18             	mov    0x18(%ebx),%eax
+  80339b:	39 c2                	cmp    %eax,%edx
+  80339d:	75 23                	jne    8033c2 <ipcring_rsp_wait+0x41>
+  80339f:	83 ec 08             	sub    $0x8,%esp
+  8033a2:	6a 00                	push   $0x0
+  8033a4:	6a 00                	push   $0x0
+  8033a6:	6a 00                	push   $0x0
+  8033a8:	6a 00                	push   $0x0
+  8033aa:	ff 73 0c             	push   0xc(%ebx)
+  8033ad:	ff 73 04             	push   0x4(%ebx)
+  8033b0:	e8 b2 08 00 00       	call   803c67 <ipc_call>
+  8033b5:	8b 53 14             	mov    0x14(%ebx),%edx
+  8033b8:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033bb:	83 c4 20             	add    $0x20,%esp
+  8033be:	39 c2                	cmp    %eax,%edx
+  8033c0:	74 dd                	je     80339f <ipcring_rsp_wait+0x1e>
+  8033c2:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033c5:	83 e0 07             	and    $0x7,%eax
+  8033c8:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8033cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033cf:	c9                   	leave
+  8033d0:	c3                   	ret
+  8033d1:	68 f8 46 80 00       	push   $0x8046f8
+  8033d6:	68 0b 46 80 00       	push   $0x80460b
+  8033db:	6a 3b                	push   $0x3b
+  8033dd:	68 19 47 80 00       	push   $0x804719
+  8033e2:	e8 c3 cd ff ff       	call   8001aa <_panic>
+
+008033e7 <ipcring_rsp_pop>:
+  8033e7:	55                   	push   %ebp
+  8033e8:	89 e5                	mov    %esp,%ebp
+  8033ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033ed:	8b 42 18             	mov    0x18(%edx),%eax
+  8033f0:	83 c0 01             	add    $0x1,%eax
+  8033f3:	89 42 18             	mov    %eax,0x18(%edx)
+  8033f6:	5d                   	pop    %ebp
+  8033f7:	c3                   	ret
+
+008033f8 <ipcring_server_init>:
+  8033f8:	55                   	push   %ebp
+  8033f9:	89 e5                	mov    %esp,%ebp
+  8033fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803401:	89 10                	mov    %edx,(%eax)
+  803403:	8b 55 10             	mov    0x10(%ebp),%edx
+  803406:	89 50 04             	mov    %edx,0x4(%eax)
+  803409:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803410:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803417:	5d                   	pop    %ebp
+  803418:	c3                   	ret
+
+00803419 <ipcring_req_avail>:
+  803419:	55                   	push   %ebp
+  80341a:	89 e5                	mov    %esp,%ebp
+  80341c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80341f:	8b 02                	mov    (%edx),%eax
+  803421:	8b 40 10             	mov    0x10(%eax),%eax
+  803424:	2b 42 08             	sub    0x8(%edx),%eax
+  803427:	ba 08 00 00 00       	mov    $0x8,%edx
+  80342c:	39 d0                	cmp    %edx,%eax
+  80342e:	0f 47 c2             	cmova  %edx,%eax
+  803431:	5d                   	pop    %ebp
+  803432:	c3                   	ret
+
+00803433 <ipcring_req_peek>:
+  803433:	55                   	push   %ebp
+  803434:	89 e5                	mov    %esp,%ebp
+  803436:	8b 55 08             	mov    0x8(%ebp),%edx
+  803439:	8b 42 08             	mov    0x8(%edx),%eax
+  80343c:	83 e0 07             	and    $0x7,%eax
+  80343f:	8b 12                	mov    (%edx),%edx
+  803441:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803445:	5d                   	pop    %ebp
+  803446:	c3                   	ret
+
+00803447 <ipcring_rsp_push>:
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	83 ec 08             	sub    $0x8,%esp
+  80344d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803450:	8b 41 08             	mov    0x8(%ecx),%eax
+  803453:	83 c0 01             	add    $0x1,%eax
+  803456:	89 41 08             	mov    %eax,0x8(%ecx)
+  803459:	8b 11                	mov    (%ecx),%edx
+  80345b:	83 c2 14             	add    $0x14,%edx
+  80345e:	f0 87 02             	lock xchg %eax,(%edx)
+  803461:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803465:	75 02                	jne    803469 <ipcring_rsp_push+0x22>
+  803467:	c9                   	leave
+  803468:	c3                   	ret
+  803469:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803470:	6a 00                	push   $0x0
+  803472:	68 00 00 80 ee       	push   $0xee800000
+  803477:	6a 00                	push   $0x0
+  803479:	ff 71 04             	push   0x4(%ecx)
+  80347c:	e8 b6 db ff ff       	call   801037 <sys_ipc_try_send>
+  803481:	83 c4 10             	add    $0x10,%esp
+  803484:	eb e1                	jmp    803467 <ipcring_rsp_push+0x20>
+
+00803486 <ipcring_client_wait>:
+  803486:	55                   	push   %ebp
+  803487:	89 e5                	mov    %esp,%ebp
+  803489:	83 ec 08             	sub    $0x8,%esp
+  80348c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348f:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803496:	8b 10                	mov    (%eax),%edx
+  803498:	8b 52 18             	mov    0x18(%edx),%edx
+  80349b:	3b 50 08             	cmp    0x8(%eax),%edx
+  80349e:	75 02                	jne    8034a2 <ipcring_client_wait+0x1c>
+  8034a0:	c9                   	leave
+  8034a1:	c3                   	ret
+  8034a2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8034a9:	6a 00                	push   $0x0
+  8034ab:	68 00 00 80 ee       	push   $0xee800000
+  8034b0:	6a 00                	push   $0x0
+  8034b2:	ff 70 04             	push   0x4(%eax)
+  8034b5:	e8 7d db ff ff       	call   801037 <sys_ipc_try_send>
+  8034ba:	83 c4 10             	add    $0x10,%esp
+  8034bd:	eb e1                	jmp    8034a0 <ipcring_client_wait+0x1a>
+
+008034bf <ipcring_server_sleep>:
+  8034bf:	55                   	push   %ebp
+  8034c0:	89 e5                	mov    %esp,%ebp
+  8034c2:	53                   	push   %ebx
+  8034c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034c6:	8b 01                	mov    (%ecx),%eax
+  8034c8:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8034cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034d0:	f0 87 02             	lock xchg %eax,(%edx)
+  8034d3:	8b 11                	mov    (%ecx),%edx
+  8034d5:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8034d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034dd:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8034e0:	74 0e                	je     8034f0 <ipcring_server_sleep+0x31>
+  8034e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e7:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8034eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034f3:	c9                   	leave
+  8034f4:	c3                   	ret
+
+008034f5 <devcons_close>:
+  8034f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fa:	c3                   	ret
+
+008034fb <devcons_stat>:
+  8034fb:	55                   	push   %ebp
+  8034fc:	89 e5                	mov    %esp,%ebp
+  8034fe:	83 ec 10             	sub    $0x10,%esp
+  803501:	68 27 47 80 00       	push   $0x804727
+  803506:	ff 75 0c             	push   0xc(%ebp)
+  803509:	e8 6e d4 ff ff       	call   80097c <strcpy>
+  80350e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803513:	c9                   	leave
+  803514:	c3                   	ret
+
+00803515 <devcons_write>:
+  803515:	55                   	push   %ebp
+  803516:	89 e5                	mov    %esp,%ebp
+  803518:	57                   	push   %edi
+  803519:	56                   	push   %esi
+  80351a:	53                   	push   %ebx
+  80351b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803521:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803524:	85 ff                	test   %edi,%edi
+  803526:	74 51                	je     803579 <devcons_write+0x64>
+  803528:	be 00 00 00 00       	mov    $0x0,%esi
+  80352d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803532:	89 fb                	mov    %edi,%ebx
+  803534:	29 c3                	sub    %eax,%ebx
+  803536:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80353b:	39 d3                	cmp    %edx,%ebx
+  80353d:	0f 47 da             	cmova  %edx,%ebx
+  803540:	83 ec 04             	sub    $0x4,%esp
+  803543:	53                   	push   %ebx
+  803544:	03 45 0c             	add    0xc(%ebp),%eax
+  803547:	50                   	push   %eax
+  803548:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80354e:	50                   	push   %eax
+  80354f:	e8 d8 d5 ff ff       	call   800b2c <memmove>
+  803554:	83 c4 08             	add    $0x8,%esp
+  803557:	53                   	push   %ebx
+  803558:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80355e:	50                   	push   %eax
+  80355f:	e8 90 d7 ff ff       	call   800cf4 <sys_cputs>
+  803564:	01 de                	add    %ebx,%esi
+  803566:	89 f0                	mov    %esi,%eax
+  803568:	83 c4 10             	add    $0x10,%esp
+  80356b:	39 fe                	cmp    %edi,%esi
+  80356d:	72 c3                	jb     803532 <devcons_write+0x1d>
+  80356f:	89 f0                	mov    %esi,%eax
+  803571:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803574:	5b                   	pop    %ebx
+  803575:	5e                   	pop    %esi
+  803576:	5f                   	pop    %edi
+  803577:	5d                   	pop    %ebp
+  803578:	c3                   	ret
+  803579:	be 00 00 00 00       	mov    $0x0,%esi
+  80357e:	eb ef                	jmp    80356f <devcons_write+0x5a>
+
+00803580 <devcons_read>:
+  803580:	55                   	push   %ebp
+  803581:	89 e5                	mov    %esp,%ebp
+  803583:	83 ec 08             	sub    $0x8,%esp
+  803586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80358f:	75 07                	jne    803598 <devcons_read+0x18>
+  803591:	eb 1f                	jmp    8035b2 <devcons_read+0x32>
+  803593:	e8 f9 d7 ff ff       	call   800d91 <sys_yield>
+  803598:	e8 75 d7 ff ff       	call   800d12 <sys_cgetc>
+  80359d:	85 c0                	test   %eax,%eax
+  80359f:	74 f2                	je     803593 <devcons_read+0x13>
+  8035a1:	78 0f                	js     8035b2 <devcons_read+0x32>
+  8035a3:	83 f8 04             	cmp    $0x4,%eax
+  8035a6:	74 0c                	je     8035b4 <devcons_read+0x34>
+  8035a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035ab:	88 02                	mov    %al,(%edx)
+  8035ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035b2:	c9                   	leave
+  8035b3:	c3                   	ret
+  8035b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b9:	eb f7                	jmp    8035b2 <devcons_read+0x32>
+
+008035bb <cputchar>:
+  8035bb:	55                   	push   %ebp
+  8035bc:	89 e5                	mov    %esp,%ebp
+  8035be:	83 ec 20             	sub    $0x20,%esp
+  8035c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c4:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8035c7:	6a 01                	push   $0x1
+  8035c9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035cc:	50                   	push   %eax
+  8035cd:	e8 22 d7 ff ff       	call   800cf4 <sys_cputs>
+  8035d2:	83 c4 10             	add    $0x10,%esp
+  8035d5:	c9                   	leave
+  8035d6:	c3                   	ret
+
+008035d7 <getchar>:
+  8035d7:	55                   	push   %ebp
+  8035d8:	89 e5                	mov    %esp,%ebp
+  8035da:	83 ec 1c             	sub    $0x1c,%esp
+  8035dd:	6a 01                	push   $0x1
+  8035df:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035e2:	50                   	push   %eax
+  8035e3:	6a 00                	push   $0x0
+  8035e5:	e8 39 e3 ff ff       	call   801923 <read>
+  8035ea:	83 c4 10             	add    $0x10,%esp
+  8035ed:	85 c0                	test   %eax,%eax
+  8035ef:	78 06                	js     8035f7 <getchar+0x20>
+  8035f1:	74 06                	je     8035f9 <getchar+0x22>
+  8035f3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8035f7:	c9                   	leave
+  8035f8:	c3                   	ret
+  8035f9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8035fe:	eb f7                	jmp    8035f7 <getchar+0x20>
+
+00803600 <iscons>:
+  803600:	55                   	push   %ebp
+  803601:	89 e5                	mov    %esp,%ebp
+  803603:	83 ec 20             	sub    $0x20,%esp
+  803606:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803609:	50                   	push   %eax
+  80360a:	ff 75 08             	push   0x8(%ebp)
+  80360d:	e8 af e0 ff ff       	call   8016c1 <fd_lookup>
+  803612:	83 c4 10             	add    $0x10,%esp
+  803615:	85 c0                	test   %eax,%eax
+  803617:	78 11                	js     80362a <iscons+0x2a>
+  803619:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80361c:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803622:	39 10                	cmp    %edx,(%eax)
+  803624:	0f 94 c0             	sete   %al
+  803627:	0f b6 c0             	movzbl %al,%eax
+  80362a:	c9                   	leave
+  80362b:	c3                   	ret
+
+0080362c <opencons>:
+  80362c:	55                   	push   %ebp
+  80362d:	89 e5                	mov    %esp,%ebp
+  80362f:	83 ec 24             	sub    $0x24,%esp
+  803632:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803635:	50                   	push   %eax
+  803636:	e8 36 e0 ff ff       	call   801671 <fd_alloc>
+  80363b:	83 c4 10             	add    $0x10,%esp
+  80363e:	85 c0                	test   %eax,%eax
+  803640:	78 3a                	js     80367c <opencons+0x50>
+  803642:	83 ec 04             	sub    $0x4,%esp
+  803645:	68 07 04 00 00       	push   $0x407
+  80364a:	ff 75 f4             	push   -0xc(%ebp)
+  80364d:	6a 00                	push   $0x0
+  80364f:	e8 88 d7 ff ff       	call   800ddc <sys_page_alloc>
+  803654:	83 c4 10             	add    $0x10,%esp
+  803657:	85 c0                	test   %eax,%eax
+  803659:	78 21                	js     80367c <opencons+0x50>
+  80365b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80365e:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803664:	89 10                	mov    %edx,(%eax)
+  803666:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803669:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803670:	83 ec 0c             	sub    $0xc,%esp
+  803673:	50                   	push   %eax
+  803674:	e8 d1 df ff ff       	call   80164a <fd2num>
+  803679:	83 c4 10             	add    $0x10,%esp
+  80367c:	c9                   	leave
+  80367d:	c3                   	ret
+
+0080367e <dupq_flush>:
+  80367e:	55                   	push   %ebp
+  80367f:	89 e5                	mov    %esp,%ebp
+  803681:	53                   	push   %ebx
+  803682:	83 ec 0c             	sub    $0xc,%esp
+  803685:	8b 1d 10 60 80 00    	mov    0x806010,%ebx
+  80368b:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  803692:	00 00 00 
+  803695:	53                   	push   %ebx
+  803696:	68 00 00 40 00       	push   $0x400000
+  80369b:	e8 c3 de ff ff       	call   801563 <sys_batch>
+  8036a0:	83 c4 10             	add    $0x10,%esp
+  8036a3:	85 c0                	test   %eax,%eax
+  8036a5:	78 14                	js     8036bb <dupq_flush+0x3d>
+  8036a7:	39 c3                	cmp    %eax,%ebx
+  8036a9:	7e 0b                	jle    8036b6 <dupq_flush+0x38>
+  8036ab:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8036ae:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8036b4:	eb 05                	jmp    8036bb <dupq_flush+0x3d>
+  8036b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036be:	c9                   	leave
+  8036bf:	c3                   	ret
+
+008036c0 <pgfault>:
+  8036c0:	55                   	push   %ebp
+  8036c1:	89 e5                	mov    %esp,%ebp
+  8036c3:	56                   	push   %esi
+  8036c4:	53                   	push   %ebx
+  8036c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036c8:	8b 30                	mov    (%eax),%esi
+  8036ca:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8036ce:	0f 84 83 00 00 00    	je     803757 <pgfault+0x97>
+  8036d4:	89 f0                	mov    %esi,%eax
+  8036d6:	c1 e8 0c             	shr    $0xc,%eax
+  8036d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036e0:	f6 c4 08             	test   $0x8,%ah
+  8036e3:	0f 84 80 00 00 00    	je     803769 <pgfault+0xa9>
+  8036e9:	e8 84 d6 ff ff       	call   800d72 <sys_getenvid>
+  8036ee:	89 c3                	mov    %eax,%ebx
+  8036f0:	83 ec 04             	sub    $0x4,%esp
+  8036f3:	6a 07                	push   $0x7
+  8036f5:	68 00 f0 7f 00       	push   $0x7ff000
+  8036fa:	50                   	push   %eax
+  8036fb:	e8 dc d6 ff ff       	call   800ddc <sys_page_alloc>
+  803700:	83 c4 10             	add    $0x10,%esp
+  803703:	85 c0                	test   %eax,%eax
+  803705:	78 74                	js     80377b <pgfault+0xbb>
+  803707:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80370d:	83 ec 04             	sub    $0x4,%esp
+  803710:	68 00 10 00 00       	push   $0x1000
+  803715:	56                   	push   %esi
+  803716:	68 00 f0 7f 00       	push   $0x7ff000
+  80371b:	e8 0c d4 ff ff       	call   800b2c <memmove>
+  803720:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803727:	56                   	push   %esi
+  803728:	53                   	push   %ebx
+  803729:	68 00 f0 7f 00       	push   $0x7ff000
+  80372e:	53                   	push   %ebx
+  80372f:	e8 eb d6 ff ff       	call   800e1f <sys_page_map>
+  803734:	83 c4 20             	add    $0x20,%esp
+  803737:	85 c0                	test   %eax,%eax
+  803739:	78 54                	js     80378f <pgfault+0xcf>
+  80373b:	83 ec 08             	sub    $0x8,%esp
+  80373e:	68 00 f0 7f 00       	push   $0x7ff000
+  803743:	53                   	push   %ebx
+  803744:	e8 65 d7 ff ff       	call   800eae <sys_page_unmap>
+  803749:	83 c4 10             	add    $0x10,%esp
+  80374c:	85 c0                	test   %eax,%eax
+  80374e:	78 53                	js     8037a3 <pgfault+0xe3>
+  803750:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803753:	5b                   	pop    %ebx
+  803754:	5e                   	pop    %esi
+  803755:	5d                   	pop    %ebp
+  803756:	c3                   	ret
+  803757:	56                   	push   %esi
+  803758:	68 34 47 80 00       	push   $0x804734
+  80375d:	6a 19                	push   $0x19
+  80375f:	68 10 48 80 00       	push   $0x804810
+  803764:	e8 41 ca ff ff       	call   8001aa <_panic>
+  803769:	56                   	push   %esi
+  80376a:	68 68 47 80 00       	push   $0x804768
+  80376f:	6a 1e                	push   $0x1e
+  803771:	68 10 48 80 00       	push   $0x804810
+  803776:	e8 2f ca ff ff       	call   8001aa <_panic>
+  80377b:	83 ec 04             	sub    $0x4,%esp
+  80377e:	68 9c 47 80 00       	push   $0x80479c
+  803783:	6a 2e                	push   $0x2e
+  803785:	68 10 48 80 00       	push   $0x804810
+  80378a:	e8 1b ca ff ff       	call   8001aa <_panic>
+  80378f:	83 ec 04             	sub    $0x4,%esp
+  803792:	68 c0 47 80 00       	push   $0x8047c0
+  803797:	6a 37                	push   $0x37
+  803799:	68 10 48 80 00       	push   $0x804810
+  80379e:	e8 07 ca ff ff       	call   8001aa <_panic>
+  8037a3:	83 ec 04             	sub    $0x4,%esp
+  8037a6:	68 ec 47 80 00       	push   $0x8047ec
+  8037ab:	6a 3c                	push   $0x3c
+  8037ad:	68 10 48 80 00       	push   $0x804810
+  8037b2:	e8 f3 c9 ff ff       	call   8001aa <_panic>
+
+008037b7 <dupq_begin>:
+  8037b7:	55                   	push   %ebp
+  8037b8:	89 e5                	mov    %esp,%ebp
+  8037ba:	83 ec 0c             	sub    $0xc,%esp
+  8037bd:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8037c4:	00 00 00 
+  8037c7:	6a 07                	push   $0x7
+  8037c9:	68 00 00 40 00       	push   $0x400000
+  8037ce:	6a 00                	push   $0x0
+  8037d0:	e8 07 d6 ff ff       	call   800ddc <sys_page_alloc>
+  8037d5:	c9                   	leave
+  8037d6:	c3                   	ret
+
+008037d7 <dupq_map>:
+  8037d7:	55                   	push   %ebp
+  8037d8:	89 e5                	mov    %esp,%ebp
+  8037da:	83 ec 08             	sub    $0x8,%esp
+  8037dd:	81 3d 10 60 80 00 92 	cmpl   $0x92,0x806010
+  8037e4:	00 00 00 
+  8037e7:	74 46                	je     80382f <dupq_map+0x58>
+  8037e9:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8037ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8037f2:	a3 10 60 80 00       	mov    %eax,0x806010
+  8037f7:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8037fa:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  803800:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  803807:	00 00 00 
+  80380a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80380d:	89 50 04             	mov    %edx,0x4(%eax)
+  803810:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803813:	c1 e2 0c             	shl    $0xc,%edx
+  803816:	89 50 08             	mov    %edx,0x8(%eax)
+  803819:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80381c:	89 48 0c             	mov    %ecx,0xc(%eax)
+  80381f:	89 50 10             	mov    %edx,0x10(%eax)
+  803822:	8b 55 14             	mov    0x14(%ebp),%edx
+  803825:	89 50 14             	mov    %edx,0x14(%eax)
+  803828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80382d:	c9                   	leave
+  80382e:	c3                   	ret
+  80382f:	e8 4a fe ff ff       	call   80367e <dupq_flush>
+  803834:	85 c0                	test   %eax,%eax
+  803836:	79 b1                	jns    8037e9 <dupq_map+0x12>
+  803838:	eb f3                	jmp    80382d <dupq_map+0x56>
+
+0080383a <dupq_end>:
+  80383a:	55                   	push   %ebp
+  80383b:	89 e5                	mov    %esp,%ebp
+  80383d:	53                   	push   %ebx
+  80383e:	83 ec 04             	sub    $0x4,%esp
+  803841:	e8 38 fe ff ff       	call   80367e <dupq_flush>
+  803846:	89 c3                	mov    %eax,%ebx
+  803848:	83 ec 08             	sub    $0x8,%esp
+  80384b:	68 00 00 40 00       	push   $0x400000
+  803850:	6a 00                	push   $0x0
+  803852:	e8 57 d6 ff ff       	call   800eae <sys_page_unmap>
+  803857:	89 d8                	mov    %ebx,%eax
+  803859:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80385c:	c9                   	leave
+  80385d:	c3                   	ret
+
+0080385e <fork>:
+  80385e:	55                   	push   %ebp
+  80385f:	89 e5                	mov    %esp,%ebp
+  803861:	53                   	push   %ebx
+  803862:	83 ec 10             	sub    $0x10,%esp
+  803865:	68 c0 36 80 00       	push   $0x8036c0
+  80386a:	e8 ef 05 00 00       	call   803e5e <set_pgfault_handler>
+  80386f:	83 c4 08             	add    $0x8,%esp
+  803872:	6a 01                	push   $0x1
+  803874:	6a 00                	push   $0x0
+  803876:	e8 18 d7 ff ff       	call   800f93 <sys_env_set_cow>
+  80387b:	e8 70 d6 ff ff       	call   800ef0 <sys_fork>
+  803880:	89 c3                	mov    %eax,%ebx
+  803882:	83 c4 10             	add    $0x10,%esp
+  803885:	85 c0                	test   %eax,%eax
+  803887:	74 07                	je     803890 <fork+0x32>
+  803889:	89 d8                	mov    %ebx,%eax
+  80388b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80388e:	c9                   	leave
+  80388f:	c3                   	ret
+  803890:	e8 dd d4 ff ff       	call   800d72 <sys_getenvid>
+  803895:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80389a:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8038a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038a5:	a3 14 60 80 00       	mov    %eax,0x806014
+  8038aa:	eb dd                	jmp    803889 <fork+0x2b>
+
+008038ac <sfork>:
+  8038ac:	55                   	push   %ebp
+  8038ad:	89 e5                	mov    %esp,%ebp
+  8038af:	57                   	push   %edi
+  8038b0:	56                   	push   %esi
+  8038b1:	53                   	push   %ebx
+  8038b2:	83 ec 1c             	sub    $0x1c,%esp
+  8038b5:	e8 b8 d4 ff ff       	call   800d72 <sys_getenvid>
+  8038ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8038bd:	83 ec 0c             	sub    $0xc,%esp
+  8038c0:	68 c0 36 80 00       	push   $0x8036c0
+  8038c5:	e8 94 05 00 00       	call   803e5e <set_pgfault_handler>
+  8038ca:	b8 07 00 00 00       	mov    $0x7,%eax
+  8038cf:	cd 30                	int    $0x30
+  8038d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038d4:	83 c4 10             	add    $0x10,%esp
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	0f 88 45 02 00 00    	js     803b24 <sfork+0x278>
+  8038df:	89 c6                	mov    %eax,%esi
+  8038e1:	74 17                	je     8038fa <sfork+0x4e>
+  8038e3:	e8 cf fe ff ff       	call   8037b7 <dupq_begin>
+  8038e8:	85 c0                	test   %eax,%eax
+  8038ea:	0f 88 40 02 00 00    	js     803b30 <sfork+0x284>
+  8038f0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8038f5:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8038f8:	eb 39                	jmp    803933 <sfork+0x87>
+  8038fa:	e8 73 d4 ff ff       	call   800d72 <sys_getenvid>
+  8038ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803904:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80390a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80390f:	a3 14 60 80 00       	mov    %eax,0x806014
+  803914:	e9 23 01 00 00       	jmp    803a3c <sfork+0x190>
+  803919:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803920:	a8 01                	test   $0x1,%al
+  803922:	75 5b                	jne    80397f <sfork+0xd3>
+  803924:	83 c7 01             	add    $0x1,%edi
+  803927:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  80392d:	0f 84 40 01 00 00    	je     803a73 <sfork+0x1c7>
+  803933:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80393a:	a8 01                	test   $0x1,%al
+  80393c:	74 db                	je     803919 <sfork+0x6d>
+  80393e:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803945:	a8 80                	test   $0x80,%al
+  803947:	74 d0                	je     803919 <sfork+0x6d>
+  803949:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803950:	25 07 0e 00 00       	and    $0xe07,%eax
+  803955:	0c 80                	or     $0x80,%al
+  803957:	50                   	push   %eax
+  803958:	ff 75 e4             	push   -0x1c(%ebp)
+  80395b:	89 f8                	mov    %edi,%eax
+  80395d:	c1 e0 16             	shl    $0x16,%eax
+  803960:	c1 e8 0c             	shr    $0xc,%eax
+  803963:	50                   	push   %eax
+  803964:	ff 75 e0             	push   -0x20(%ebp)
+  803967:	e8 6b fe ff ff       	call   8037d7 <dupq_map>
+  80396c:	83 c4 10             	add    $0x10,%esp
+  80396f:	85 c0                	test   %eax,%eax
+  803971:	79 b1                	jns    803924 <sfork+0x78>
+  803973:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80397a:	e9 bd 00 00 00       	jmp    803a3c <sfork+0x190>
+  80397f:	89 fe                	mov    %edi,%esi
+  803981:	c1 e6 16             	shl    $0x16,%esi
+  803984:	89 f0                	mov    %esi,%eax
+  803986:	c1 e8 0c             	shr    $0xc,%eax
+  803989:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80398e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803991:	eb 57                	jmp    8039ea <sfork+0x13e>
+  803993:	e8 da d3 ff ff       	call   800d72 <sys_getenvid>
+  803998:	89 c7                	mov    %eax,%edi
+  80399a:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  80399f:	f6 c4 04             	test   $0x4,%ah
+  8039a2:	0f 85 9f 00 00 00    	jne    803a47 <sfork+0x19b>
+  8039a8:	a9 02 08 00 00       	test   $0x802,%eax
+  8039ad:	0f 85 c5 01 00 00    	jne    803b78 <sfork+0x2cc>
+  8039b3:	6a 05                	push   $0x5
+  8039b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8039b8:	68 fd e7 0e 00       	push   $0xee7fd
+  8039bd:	57                   	push   %edi
+  8039be:	e8 14 fe ff ff       	call   8037d7 <dupq_map>
+  8039c3:	83 c4 10             	add    $0x10,%esp
+  8039c6:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8039cc:	0f 84 91 00 00 00    	je     803a63 <sfork+0x1b7>
+  8039d2:	89 f0                	mov    %esi,%eax
+  8039d4:	09 d8                	or     %ebx,%eax
+  8039d6:	c1 e8 0c             	shr    $0xc,%eax
+  8039d9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8039df:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  8039e4:	0f 84 81 00 00 00    	je     803a6b <sfork+0x1bf>
+  8039ea:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  8039ef:	74 a2                	je     803993 <sfork+0xe7>
+  8039f1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8039f8:	f6 c2 01             	test   $0x1,%dl
+  8039fb:	74 c9                	je     8039c6 <sfork+0x11a>
+  8039fd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a04:	f6 c6 02             	test   $0x2,%dh
+  803a07:	75 bd                	jne    8039c6 <sfork+0x11a>
+  803a09:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803a10:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a17:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  803a1d:	f7 d2                	not    %edx
+  803a1f:	21 ca                	and    %ecx,%edx
+  803a21:	52                   	push   %edx
+  803a22:	ff 75 e4             	push   -0x1c(%ebp)
+  803a25:	50                   	push   %eax
+  803a26:	ff 75 e0             	push   -0x20(%ebp)
+  803a29:	e8 a9 fd ff ff       	call   8037d7 <dupq_map>
+  803a2e:	83 c4 10             	add    $0x10,%esp
+  803a31:	85 c0                	test   %eax,%eax
+  803a33:	79 91                	jns    8039c6 <sfork+0x11a>
+  803a35:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803a3c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a42:	5b                   	pop    %ebx
+  803a43:	5e                   	pop    %esi
+  803a44:	5f                   	pop    %edi
+  803a45:	5d                   	pop    %ebp
+  803a46:	c3                   	ret
+  803a47:	25 07 0e 00 00       	and    $0xe07,%eax
+  803a4c:	50                   	push   %eax
+  803a4d:	ff 75 e4             	push   -0x1c(%ebp)
+  803a50:	68 fd e7 0e 00       	push   $0xee7fd
+  803a55:	57                   	push   %edi
+  803a56:	e8 7c fd ff ff       	call   8037d7 <dupq_map>
+  803a5b:	83 c4 10             	add    $0x10,%esp
+  803a5e:	e9 63 ff ff ff       	jmp    8039c6 <sfork+0x11a>
+  803a63:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803a66:	e9 b9 fe ff ff       	jmp    803924 <sfork+0x78>
+  803a6b:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803a6e:	e9 b1 fe ff ff       	jmp    803924 <sfork+0x78>
+  803a73:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803a76:	e8 bf fd ff ff       	call   80383a <dupq_end>
+  803a7b:	85 c0                	test   %eax,%eax
+  803a7d:	0f 88 b9 00 00 00    	js     803b3c <sfork+0x290>
+  803a83:	83 ec 04             	sub    $0x4,%esp
+  803a86:	6a 07                	push   $0x7
+  803a88:	68 00 f0 7f ee       	push   $0xee7ff000
+  803a8d:	56                   	push   %esi
+  803a8e:	e8 49 d3 ff ff       	call   800ddc <sys_page_alloc>
+  803a93:	83 c4 10             	add    $0x10,%esp
+  803a96:	85 c0                	test   %eax,%eax
+  803a98:	0f 88 aa 00 00 00    	js     803b48 <sfork+0x29c>
+  803a9e:	83 ec 0c             	sub    $0xc,%esp
+  803aa1:	6a 07                	push   $0x7
+  803aa3:	68 00 f0 7f 00       	push   $0x7ff000
+  803aa8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803aab:	57                   	push   %edi
+  803aac:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ab1:	56                   	push   %esi
+  803ab2:	e8 68 d3 ff ff       	call   800e1f <sys_page_map>
+  803ab7:	83 c4 20             	add    $0x20,%esp
+  803aba:	85 c0                	test   %eax,%eax
+  803abc:	0f 88 92 00 00 00    	js     803b54 <sfork+0x2a8>
+  803ac2:	83 ec 04             	sub    $0x4,%esp
+  803ac5:	68 00 10 00 00       	push   $0x1000
+  803aca:	68 00 f0 7f 00       	push   $0x7ff000
+  803acf:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ad4:	e8 53 d0 ff ff       	call   800b2c <memmove>
+  803ad9:	83 c4 08             	add    $0x8,%esp
+  803adc:	68 00 f0 7f 00       	push   $0x7ff000
+  803ae1:	57                   	push   %edi
+  803ae2:	e8 c7 d3 ff ff       	call   800eae <sys_page_unmap>
+  803ae7:	83 c4 10             	add    $0x10,%esp
+  803aea:	85 c0                	test   %eax,%eax
+  803aec:	78 72                	js     803b60 <sfork+0x2b4>
+  803aee:	83 ec 08             	sub    $0x8,%esp
+  803af1:	68 d6 3e 80 00       	push   $0x803ed6
+  803af6:	56                   	push   %esi
+  803af7:	e8 f9 d4 ff ff       	call   800ff5 <sys_env_set_pgfault_upcall>
+  803afc:	83 c4 10             	add    $0x10,%esp
+  803aff:	85 c0                	test   %eax,%eax
+  803b01:	78 69                	js     803b6c <sfork+0x2c0>
+  803b03:	83 ec 08             	sub    $0x8,%esp
+  803b06:	6a 02                	push   $0x2
+  803b08:	56                   	push   %esi
+  803b09:	e8 01 d4 ff ff       	call   800f0f <sys_env_set_status>
+  803b0e:	83 c4 10             	add    $0x10,%esp
+  803b11:	85 c0                	test   %eax,%eax
+  803b13:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803b18:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  803b1c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803b1f:	e9 18 ff ff ff       	jmp    803a3c <sfork+0x190>
+  803b24:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b2b:	e9 0c ff ff ff       	jmp    803a3c <sfork+0x190>
+  803b30:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b37:	e9 00 ff ff ff       	jmp    803a3c <sfork+0x190>
+  803b3c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b43:	e9 f4 fe ff ff       	jmp    803a3c <sfork+0x190>
+  803b48:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b4f:	e9 e8 fe ff ff       	jmp    803a3c <sfork+0x190>
+  803b54:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b5b:	e9 dc fe ff ff       	jmp    803a3c <sfork+0x190>
+  803b60:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b67:	e9 d0 fe ff ff       	jmp    803a3c <sfork+0x190>
+  803b6c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803b73:	e9 c4 fe ff ff       	jmp    803a3c <sfork+0x190>
+  803b78:	68 05 08 00 00       	push   $0x805
+  803b7d:	ff 75 e4             	push   -0x1c(%ebp)
+  803b80:	68 fd e7 0e 00       	push   $0xee7fd
+  803b85:	57                   	push   %edi
+  803b86:	e8 4c fc ff ff       	call   8037d7 <dupq_map>
+  803b8b:	83 c4 10             	add    $0x10,%esp
+  803b8e:	85 c0                	test   %eax,%eax
+  803b90:	0f 88 30 fe ff ff    	js     8039c6 <sfork+0x11a>
+  803b96:	68 05 08 00 00       	push   $0x805
+  803b9b:	57                   	push   %edi
+  803b9c:	68 fd e7 0e 00       	push   $0xee7fd
+  803ba1:	57                   	push   %edi
+  803ba2:	e8 30 fc ff ff       	call   8037d7 <dupq_map>
+  803ba7:	83 c4 10             	add    $0x10,%esp
+  803baa:	e9 17 fe ff ff       	jmp    8039c6 <sfork+0x11a>
+
+00803baf <ipc_recv>:
+  803baf:	55                   	push   %ebp
+  803bb0:	89 e5                	mov    %esp,%ebp
+  803bb2:	56                   	push   %esi
+  803bb3:	53                   	push   %ebx
+  803bb4:	8b 75 08             	mov    0x8(%ebp),%esi
+  803bb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803bba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803bbd:	85 c0                	test   %eax,%eax
+  803bbf:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803bc4:	0f 44 c2             	cmove  %edx,%eax
+  803bc7:	83 ec 0c             	sub    $0xc,%esp
+  803bca:	50                   	push   %eax
+  803bcb:	e8 b7 d4 ff ff       	call   801087 <sys_ipc_recv>
+  803bd0:	83 c4 10             	add    $0x10,%esp
+  803bd3:	85 c0                	test   %eax,%eax
+  803bd5:	78 2a                	js     803c01 <ipc_recv+0x52>
+  803bd7:	a1 14 60 80 00       	mov    0x806014,%eax
+  803bdc:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803be2:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803be8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803bee:	85 f6                	test   %esi,%esi
+  803bf0:	74 02                	je     803bf4 <ipc_recv+0x45>
+  803bf2:	89 0e                	mov    %ecx,(%esi)
+  803bf4:	85 db                	test   %ebx,%ebx
+  803bf6:	74 02                	je     803bfa <ipc_recv+0x4b>
+  803bf8:	89 13                	mov    %edx,(%ebx)
+  803bfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bfd:	5b                   	pop    %ebx
+  803bfe:	5e                   	pop    %esi
+  803bff:	5d                   	pop    %ebp
+  803c00:	c3                   	ret
+  803c01:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c0b:	eb e1                	jmp    803bee <ipc_recv+0x3f>
+
+00803c0d <ipc_send>:
+  803c0d:	55                   	push   %ebp
+  803c0e:	89 e5                	mov    %esp,%ebp
+  803c10:	57                   	push   %edi
+  803c11:	56                   	push   %esi
+  803c12:	53                   	push   %ebx
+  803c13:	83 ec 0c             	sub    $0xc,%esp
+  803c16:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803c19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c1c:	8b 75 14             	mov    0x14(%ebp),%esi
+  803c1f:	85 db                	test   %ebx,%ebx
+  803c21:	74 1e                	je     803c41 <ipc_send+0x34>
+  803c23:	56                   	push   %esi
+  803c24:	53                   	push   %ebx
+  803c25:	57                   	push   %edi
+  803c26:	ff 75 08             	push   0x8(%ebp)
+  803c29:	e8 e6 d4 ff ff       	call   801114 <sys_ipc_send>
+  803c2e:	83 c4 10             	add    $0x10,%esp
+  803c31:	85 c0                	test   %eax,%eax
+  803c33:	74 2a                	je     803c5f <ipc_send+0x52>
+  803c35:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803c38:	75 13                	jne    803c4d <ipc_send+0x40>
+  803c3a:	e8 52 d1 ff ff       	call   800d91 <sys_yield>
+  803c3f:	eb e2                	jmp    803c23 <ipc_send+0x16>
+  803c41:	be 00 00 00 00       	mov    $0x0,%esi
+  803c46:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803c4b:	eb d6                	jmp    803c23 <ipc_send+0x16>
+  803c4d:	50                   	push   %eax
+  803c4e:	68 1c 48 80 00       	push   $0x80481c
+  803c53:	6a 4f                	push   $0x4f
+  803c55:	68 5f 48 80 00       	push   $0x80485f
+  803c5a:	e8 4b c5 ff ff       	call   8001aa <_panic>
+  803c5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c62:	5b                   	pop    %ebx
+  803c63:	5e                   	pop    %esi
+  803c64:	5f                   	pop    %edi
+  803c65:	5d                   	pop    %ebp
+  803c66:	c3                   	ret
+
+00803c67 <ipc_call>:
+  803c67:	55                   	push   %ebp
+  803c68:	89 e5                	mov    %esp,%ebp
+  803c6a:	57                   	push   %edi
+  803c6b:	56                   	push   %esi
+  803c6c:	53                   	push   %ebx
+  803c6d:	83 ec 0c             	sub    $0xc,%esp
+  803c70:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c74:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803c79:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803c7d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803c81:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803c86:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803c8a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c93:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803c97:	eb 05                	jmp    803c9e <ipc_call+0x37>
+  803c99:	e8 f3 d0 ff ff       	call   800d91 <sys_yield>
+  803c9e:	83 ec 0c             	sub    $0xc,%esp
+  803ca1:	56                   	push   %esi
+  803ca2:	53                   	push   %ebx
+  803ca3:	57                   	push   %edi
+  803ca4:	ff 75 0c             	push   0xc(%ebp)
+  803ca7:	ff 75 08             	push   0x8(%ebp)
+  803caa:	e8 b5 d4 ff ff       	call   801164 <sys_ipc_call>
+  803caf:	83 c4 20             	add    $0x20,%esp
+  803cb2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803cb5:	74 e2                	je     803c99 <ipc_call+0x32>
+  803cb7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803cba:	74 2d                	je     803ce9 <ipc_call+0x82>
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	78 4f                	js     803d0f <ipc_call+0xa8>
+  803cc0:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803cc4:	74 10                	je     803cd6 <ipc_call+0x6f>
+  803cc6:	a1 14 60 80 00       	mov    0x806014,%eax
+  803ccb:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803cd1:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803cd4:	89 02                	mov    %eax,(%edx)
+  803cd6:	a1 14 60 80 00       	mov    0x806014,%eax
+  803cdb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803ce1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ce4:	5b                   	pop    %ebx
+  803ce5:	5e                   	pop    %esi
+  803ce6:	5f                   	pop    %edi
+  803ce7:	5d                   	pop    %ebp
+  803ce8:	c3                   	ret
+  803ce9:	ff 75 14             	push   0x14(%ebp)
+  803cec:	ff 75 10             	push   0x10(%ebp)
+  803cef:	ff 75 0c             	push   0xc(%ebp)
+  803cf2:	ff 75 08             	push   0x8(%ebp)
+  803cf5:	e8 13 ff ff ff       	call   803c0d <ipc_send>
+  803cfa:	83 c4 0c             	add    $0xc,%esp
+  803cfd:	ff 75 1c             	push   0x1c(%ebp)
+  803d00:	ff 75 18             	push   0x18(%ebp)
+  803d03:	6a 00                	push   $0x0
+  803d05:	e8 a5 fe ff ff       	call   803baf <ipc_recv>
+  803d0a:	83 c4 10             	add    $0x10,%esp
+  803d0d:	eb d2                	jmp    803ce1 <ipc_call+0x7a>
+  803d0f:	50                   	push   %eax
+  803d10:	68 69 48 80 00       	push   $0x804869
+  803d15:	6a 6d                	push   $0x6d
+  803d17:	68 5f 48 80 00       	push   $0x80485f
+  803d1c:	e8 89 c4 ff ff       	call   8001aa <_panic>
+
+00803d21 <ipc_reply_recv>:
+  803d21:	55                   	push   %ebp
+  803d22:	89 e5                	mov    %esp,%ebp
+  803d24:	57                   	push   %edi
+  803d25:	56                   	push   %esi
+  803d26:	53                   	push   %ebx
+  803d27:	83 ec 0c             	sub    $0xc,%esp
+  803d2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d2d:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803d30:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803d33:	85 db                	test   %ebx,%ebx
+  803d35:	0f 84 ac 00 00 00    	je     803de7 <ipc_reply_recv+0xc6>
+  803d3b:	85 f6                	test   %esi,%esi
+  803d3d:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803d42:	0f 45 c6             	cmovne %esi,%eax
+  803d45:	83 ec 0c             	sub    $0xc,%esp
+  803d48:	50                   	push   %eax
+  803d49:	ff 75 14             	push   0x14(%ebp)
+  803d4c:	53                   	push   %ebx
+  803d4d:	ff 75 0c             	push   0xc(%ebp)
+  803d50:	ff 75 08             	push   0x8(%ebp)
+  803d53:	e8 2d d4 ff ff       	call   801185 <sys_ipc_reply_recv>
+  803d58:	83 c4 20             	add    $0x20,%esp
+  803d5b:	85 c0                	test   %eax,%eax
+  803d5d:	78 3a                	js     803d99 <ipc_reply_recv+0x78>
+  803d5f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803d63:	74 10                	je     803d75 <ipc_reply_recv+0x54>
+  803d65:	a1 14 60 80 00       	mov    0x806014,%eax
+  803d6a:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803d70:	8b 55 18             	mov    0x18(%ebp),%edx
+  803d73:	89 02                	mov    %eax,(%edx)
+  803d75:	85 ff                	test   %edi,%edi
+  803d77:	74 0d                	je     803d86 <ipc_reply_recv+0x65>
+  803d79:	a1 14 60 80 00       	mov    0x806014,%eax
+  803d7e:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803d84:	89 07                	mov    %eax,(%edi)
+  803d86:	a1 14 60 80 00       	mov    0x806014,%eax
+  803d8b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d94:	5b                   	pop    %ebx
+  803d95:	5e                   	pop    %esi
+  803d96:	5f                   	pop    %edi
+  803d97:	5d                   	pop    %ebp
+  803d98:	c3                   	ret
+  803d99:	ff 75 14             	push   0x14(%ebp)
+  803d9c:	53                   	push   %ebx
+  803d9d:	ff 75 0c             	push   0xc(%ebp)
+  803da0:	ff 75 08             	push   0x8(%ebp)
+  803da3:	e8 8f d2 ff ff       	call   801037 <sys_ipc_try_send>
+  803da8:	89 c2                	mov    %eax,%edx
+  803daa:	c1 ea 1f             	shr    $0x1f,%edx
+  803dad:	83 c4 10             	add    $0x10,%esp
+  803db0:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803db3:	0f 95 c1             	setne  %cl
+  803db6:	84 d1                	test   %dl,%cl
+  803db8:	74 05                	je     803dbf <ipc_reply_recv+0x9e>
+  803dba:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803dbd:	75 12                	jne    803dd1 <ipc_reply_recv+0xb0>
+  803dbf:	83 ec 04             	sub    $0x4,%esp
+  803dc2:	57                   	push   %edi
+  803dc3:	56                   	push   %esi
+  803dc4:	ff 75 18             	push   0x18(%ebp)
+  803dc7:	e8 e3 fd ff ff       	call   803baf <ipc_recv>
+  803dcc:	83 c4 10             	add    $0x10,%esp
+  803dcf:	eb c0                	jmp    803d91 <ipc_reply_recv+0x70>
+  803dd1:	83 ec 04             	sub    $0x4,%esp
+  803dd4:	50                   	push   %eax
+  803dd5:	ff 75 08             	push   0x8(%ebp)
+  803dd8:	68 3c 48 80 00       	push   $0x80483c
+  803ddd:	e8 a3 c4 ff ff       	call   800285 <cprintf>
+  803de2:	83 c4 10             	add    $0x10,%esp
+  803de5:	eb d8                	jmp    803dbf <ipc_reply_recv+0x9e>
+  803de7:	85 f6                	test   %esi,%esi
+  803de9:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803dee:	0f 45 c6             	cmovne %esi,%eax
+  803df1:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803df6:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803dfd:	e9 43 ff ff ff       	jmp    803d45 <ipc_reply_recv+0x24>
+
+00803e02 <ipc_find_env>:
+  803e02:	55                   	push   %ebp
+  803e03:	89 e5                	mov    %esp,%ebp
+  803e05:	83 ec 14             	sub    $0x14,%esp
+  803e08:	ff 75 08             	push   0x8(%ebp)
+  803e0b:	e8 c5 d1 ff ff       	call   800fd5 <sys_env_service>
+  803e10:	85 c0                	test   %eax,%eax
+  803e12:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e17:	0f 48 c2             	cmovs  %edx,%eax
+  803e1a:	c9                   	leave
+  803e1b:	c3                   	ret
+
+00803e1c <pageref>:
+  803e1c:	55                   	push   %ebp
+  803e1d:	89 e5                	mov    %esp,%ebp
+  803e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e22:	89 c2                	mov    %eax,%edx
+  803e24:	c1 ea 16             	shr    $0x16,%edx
+  803e27:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e33:	f6 c1 01             	test   $0x1,%cl
+  803e36:	74 22                	je     803e5a <pageref+0x3e>
+  803e38:	c1 e8 0c             	shr    $0xc,%eax
+  803e3b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e42:	a8 01                	test   $0x1,%al
+  803e44:	74 14                	je     803e5a <pageref+0x3e>
+  803e46:	c1 e8 0c             	shr    $0xc,%eax
+  803e49:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803e4c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803e53:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803e57:	0f b7 d2             	movzwl %dx,%edx
+  803e5a:	89 d0                	mov    %edx,%eax
+  803e5c:	5d                   	pop    %ebp
+  803e5d:	c3                   	ret
+
+00803e5e <set_pgfault_handler>:
+  803e5e:	55                   	push   %ebp
+  803e5f:	89 e5                	mov    %esp,%ebp
+  803e61:	53                   	push   %ebx
+  803e62:	83 ec 04             	sub    $0x4,%esp
+  803e65:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803e6c:	74 0d                	je     803e7b <set_pgfault_handler+0x1d>
+  803e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e71:	a3 00 90 80 00       	mov    %eax,0x809000
+  803e76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e79:	c9                   	leave
+  803e7a:	c3                   	ret
+  803e7b:	e8 f2 ce ff ff       	call   800d72 <sys_getenvid>
+  803e80:	89 c3                	mov    %eax,%ebx
+  803e82:	83 ec 04             	sub    $0x4,%esp
+  803e85:	6a 07                	push   $0x7
+  803e87:	68 00 f0 7f ee       	push   $0xee7ff000
+  803e8c:	50                   	push   %eax
+  803e8d:	e8 4a cf ff ff       	call   800ddc <sys_page_alloc>
+  803e92:	83 c4 10             	add    $0x10,%esp
+  803e95:	85 c0                	test   %eax,%eax
+  803e97:	78 29                	js     803ec2 <set_pgfault_handler+0x64>
+  803e99:	83 ec 08             	sub    $0x8,%esp
+  803e9c:	68 d6 3e 80 00       	push   $0x803ed6
+  803ea1:	53                   	push   %ebx
+  803ea2:	e8 4e d1 ff ff       	call   800ff5 <sys_env_set_pgfault_upcall>
+  803ea7:	83 c4 10             	add    $0x10,%esp
+  803eaa:	85 c0                	test   %eax,%eax
+  803eac:	79 c0                	jns    803e6e <set_pgfault_handler+0x10>
+  803eae:	83 ec 04             	sub    $0x4,%esp
+  803eb1:	68 c0 48 80 00       	push   $0x8048c0
+  803eb6:	6a 27                	push   $0x27
+  803eb8:	68 f2 48 80 00       	push   $0x8048f2
+  803ebd:	e8 e8 c2 ff ff       	call   8001aa <_panic>
+  803ec2:	83 ec 04             	sub    $0x4,%esp
+  803ec5:	68 88 48 80 00       	push   $0x804888
+  803eca:	6a 23                	push   $0x23
+  803ecc:	68 f2 48 80 00       	push   $0x8048f2
+  803ed1:	e8 d4 c2 ff ff       	call   8001aa <_panic>
+
+00803ed6 <_pgfault_upcall>:
+  803ed6:	54                   	push   %esp
+  803ed7:	a1 00 90 80 00       	mov    0x809000,%eax
+  803edc:	ff d0                	call   *%eax
+  803ede:	83 c4 04             	add    $0x4,%esp
+  803ee1:	89 e3                	mov    %esp,%ebx
+  803ee3:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803ee7:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803eeb:	89 d4                	mov    %edx,%esp
+  803eed:	51                   	push   %ecx
+  803eee:	89 dc                	mov    %ebx,%esp
+  803ef0:	83 ea 04             	sub    $0x4,%edx
+  803ef3:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803ef7:	83 c4 08             	add    $0x8,%esp
+  803efa:	61                   	popa
+  803efb:	83 c4 04             	add    $0x4,%esp
+  803efe:	9d                   	popf
+  803eff:	5c                   	pop    %esp
+  803f00:	c3                   	ret
+
+00803f01 <__udivmoddi4>:
+  803f01:	55                   	push   %ebp
+  803f02:	57                   	push   %edi
+  803f03:	56                   	push   %esi
+  803f04:	53                   	push   %ebx
+  803f05:	83 ec 24             	sub    $0x24,%esp
+  803f08:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803f0c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803f10:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f14:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f18:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803f1c:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803f20:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803f24:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803f28:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f36:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803f3b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803f42:	00 
+  803f43:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803f4a:	00 
+  803f4b:	89 fb                	mov    %edi,%ebx
+  803f4d:	eb 08                	jmp    803f57 <__udivmoddi4+0x56>
+  803f4f:	83 e9 01             	sub    $0x1,%ecx
+  803f52:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803f55:	74 68                	je     803fbf <__udivmoddi4+0xbe>
+  803f57:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803f5b:	01 c0                	add    %eax,%eax
+  803f5d:	89 c6                	mov    %eax,%esi
+  803f5f:	89 d7                	mov    %edx,%edi
+  803f61:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f65:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f69:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f6c:	d3 ea                	shr    %cl,%edx
+  803f6e:	f6 c1 20             	test   $0x20,%cl
+  803f71:	74 04                	je     803f77 <__udivmoddi4+0x76>
+  803f73:	89 d0                	mov    %edx,%eax
+  803f75:	31 d2                	xor    %edx,%edx
+  803f77:	83 e0 01             	and    $0x1,%eax
+  803f7a:	89 04 24             	mov    %eax,(%esp)
+  803f7d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f84:	00 
+  803f85:	8b 04 24             	mov    (%esp),%eax
+  803f88:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f8c:	09 f0                	or     %esi,%eax
+  803f8e:	09 fa                	or     %edi,%edx
+  803f90:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f94:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f98:	39 f0                	cmp    %esi,%eax
+  803f9a:	89 d5                	mov    %edx,%ebp
+  803f9c:	19 fd                	sbb    %edi,%ebp
+  803f9e:	72 af                	jb     803f4f <__udivmoddi4+0x4e>
+  803fa0:	29 f0                	sub    %esi,%eax
+  803fa2:	19 fa                	sbb    %edi,%edx
+  803fa4:	89 cf                	mov    %ecx,%edi
+  803fa6:	c1 ef 05             	shr    $0x5,%edi
+  803fa9:	83 e7 01             	and    $0x1,%edi
+  803fac:	89 fe                	mov    %edi,%esi
+  803fae:	83 f6 01             	xor    $0x1,%esi
+  803fb1:	d3 e6                	shl    %cl,%esi
+  803fb3:	d3 e7                	shl    %cl,%edi
+  803fb5:	09 74 24 18          	or     %esi,0x18(%esp)
+  803fb9:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803fbd:	eb 90                	jmp    803f4f <__udivmoddi4+0x4e>
+  803fbf:	85 db                	test   %ebx,%ebx
+  803fc1:	74 05                	je     803fc8 <__udivmoddi4+0xc7>
+  803fc3:	89 03                	mov    %eax,(%ebx)
+  803fc5:	89 53 04             	mov    %edx,0x4(%ebx)
+  803fc8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803fcc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803fd0:	83 c4 24             	add    $0x24,%esp
+  803fd3:	5b                   	pop    %ebx
+  803fd4:	5e                   	pop    %esi
+  803fd5:	5f                   	pop    %edi
+  803fd6:	5d                   	pop    %ebp
+  803fd7:	c3                   	ret
+
+00803fd8 <__udivdi3>:
+  803fd8:	83 ec 08             	sub    $0x8,%esp
+  803fdb:	6a 00                	push   $0x0
+  803fdd:	ff 74 24 1c          	push   0x1c(%esp)
+  803fe1:	ff 74 24 1c          	push   0x1c(%esp)
+  803fe5:	ff 74 24 1c          	push   0x1c(%esp)
+  803fe9:	ff 74 24 1c          	push   0x1c(%esp)
+  803fed:	e8 0f ff ff ff       	call   803f01 <__udivmoddi4>
+  803ff2:	83 c4 1c             	add    $0x1c,%esp
+  803ff5:	c3                   	ret
+
+00803ff6 <__umoddi3>:
+  803ff6:	83 ec 18             	sub    $0x18,%esp
+  803ff9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803ffd:	50                   	push   %eax
+  803ffe:	ff 74 24 2c          	push   0x2c(%esp)
+  804002:	ff 74 24 2c          	push   0x2c(%esp)
+  804006:	ff 74 24 2c          	push   0x2c(%esp)
+  80400a:	ff 74 24 2c          	push   0x2c(%esp)
+  80400e:	e8 ee fe ff ff       	call   803f01 <__udivmoddi4>
+  804013:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804017:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80401b:	83 c4 2c             	add    $0x2c,%esp
+  80401e:	c3                   	ret
+
+0080401f <__divdi3>:
+  80401f:	53                   	push   %ebx
+  804020:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804024:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804028:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80402c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804030:	85 d2                	test   %edx,%edx
+  804032:	78 12                	js     804046 <__divdi3+0x27>
+  804034:	85 db                	test   %ebx,%ebx
+  804036:	78 2e                	js     804066 <__divdi3+0x47>
+  804038:	53                   	push   %ebx
+  804039:	51                   	push   %ecx
+  80403a:	52                   	push   %edx
+  80403b:	50                   	push   %eax
+  80403c:	e8 97 ff ff ff       	call   803fd8 <__udivdi3>
+  804041:	83 c4 10             	add    $0x10,%esp
+  804044:	eb 1e                	jmp    804064 <__divdi3+0x45>
+  804046:	f7 d8                	neg    %eax
+  804048:	83 d2 00             	adc    $0x0,%edx
+  80404b:	f7 da                	neg    %edx
+  80404d:	85 db                	test   %ebx,%ebx
+  80404f:	78 2a                	js     80407b <__divdi3+0x5c>
+  804051:	53                   	push   %ebx
+  804052:	51                   	push   %ecx
+  804053:	52                   	push   %edx
+  804054:	50                   	push   %eax
+  804055:	e8 7e ff ff ff       	call   803fd8 <__udivdi3>
+  80405a:	83 c4 10             	add    $0x10,%esp
+  80405d:	f7 d8                	neg    %eax
+  80405f:	83 d2 00             	adc    $0x0,%edx
+  804062:	f7 da                	neg    %edx
+  804064:	5b                   	pop    %ebx
+  804065:	c3                   	ret
+  804066:	f7 d9                	neg    %ecx
+  804068:	83 d3 00             	adc    $0x0,%ebx
+  80406b:	f7 db                	neg    %ebx
+  80406d:	53                   	push   %ebx
+  80406e:	51                   	push   %ecx
+  80406f:	52                   	push   %edx
+  804070:	50                   	push   %eax
+  804071:	e8 62 ff ff ff       	call   803fd8 <__udivdi3>
+  804076:	83 c4 10             	add    $0x10,%esp
+  804079:	eb e2                	jmp    80405d <__divdi3+0x3e>
+  80407b:	f7 d9                	neg    %ecx
+  80407d:	83 d3 00             	adc    $0x0,%ebx
+  804080:	f7 db                	neg    %ebx
+  804082:	53                   	push   %ebx
+  804083:	51                   	push   %ecx
+  804084:	52                   	push   %edx
+  804085:	50                   	push   %eax
+  804086:	e8 4d ff ff ff       	call   803fd8 <__udivdi3>
+  80408b:	83 c4 10             	add    $0x10,%esp
+  80408e:	eb d4                	jmp    804064 <__divdi3+0x45>
+
+00804090 <__moddi3>:
+  804090:	55                   	push   %ebp
+  804091:	57                   	push   %edi
+  804092:	56                   	push   %esi
+  804093:	53                   	push   %ebx
+  804094:	83 ec 0c             	sub    $0xc,%esp
+  804097:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80409b:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80409f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8040a3:	89 e9                	mov    %ebp,%ecx
+  8040a5:	f7 d9                	neg    %ecx
+  8040a7:	89 d0                	mov    %edx,%eax
+  8040a9:	83 d0 00             	adc    $0x0,%eax
+  8040ac:	f7 d8                	neg    %eax
+  8040ae:	0f 49 e9             	cmovns %ecx,%ebp
+  8040b1:	0f 49 d0             	cmovns %eax,%edx
+  8040b4:	52                   	push   %edx
+  8040b5:	55                   	push   %ebp
+  8040b6:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8040ba:	f7 da                	neg    %edx
+  8040bc:	89 d8                	mov    %ebx,%eax
+  8040be:	83 d0 00             	adc    $0x0,%eax
+  8040c1:	f7 d8                	neg    %eax
+  8040c3:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8040c8:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8040cc:	0f 48 c3             	cmovs  %ebx,%eax
+  8040cf:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8040d3:	ff 74 24 0c          	push   0xc(%esp)
+  8040d7:	ff 74 24 0c          	push   0xc(%esp)
+  8040db:	e8 16 ff ff ff       	call   803ff6 <__umoddi3>
+  8040e0:	83 c4 10             	add    $0x10,%esp
+  8040e3:	85 db                	test   %ebx,%ebx
+  8040e5:	78 08                	js     8040ef <__moddi3+0x5f>
+  8040e7:	83 c4 0c             	add    $0xc,%esp
+  8040ea:	5b                   	pop    %ebx
+  8040eb:	5e                   	pop    %esi
+  8040ec:	5f                   	pop    %edi
+  8040ed:	5d                   	pop    %ebp
+  8040ee:	c3                   	ret
+  8040ef:	f7 d8                	neg    %eax
+  8040f1:	83 d2 00             	adc    $0x0,%edx
+  8040f4:	f7 da                	neg    %edx
+  8040f6:	eb ef                	jmp    8040e7 <__moddi3+0x57>
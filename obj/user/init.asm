@@ -0,0 +1,6327 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 8d 03 00 00       	call   8003be <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80003e:	85 db                	test   %ebx,%ebx
+  800040:	7e 20                	jle    800062 <sum+0x2f>
+  800042:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004c:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  800050:	0f af d0             	imul   %eax,%edx
+  800053:	31 d1                	xor    %edx,%ecx
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	39 c3                	cmp    %eax,%ebx
+  80005a:	75 f0                	jne    80004c <sum+0x19>
+  80005c:	89 c8                	mov    %ecx,%eax
+  80005e:	5b                   	pop    %ebx
+  80005f:	5e                   	pop    %esi
+  800060:	5d                   	pop    %ebp
+  800061:	c3                   	ret
+  800062:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800067:	eb f3                	jmp    80005c <sum+0x29>
+
+00800069 <umain>:
+  800069:	55                   	push   %ebp
+  80006a:	89 e5                	mov    %esp,%ebp
+  80006c:	57                   	push   %edi
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800075:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800078:	68 60 42 80 00       	push   $0x804260
+  80007d:	e8 90 04 00 00       	call   800512 <cprintf>
+  800082:	83 c4 08             	add    $0x8,%esp
+  800085:	68 70 17 00 00       	push   $0x1770
+  80008a:	68 00 50 80 00       	push   $0x805000
+  80008f:	e8 9f ff ff ff       	call   800033 <sum>
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  80009c:	0f 84 eb 00 00 00    	je     80018d <umain+0x124>
+  8000a2:	83 ec 04             	sub    $0x4,%esp
+  8000a5:	68 9e 98 0f 00       	push   $0xf989e
+  8000aa:	50                   	push   %eax
+  8000ab:	68 28 43 80 00       	push   $0x804328
+  8000b0:	e8 5d 04 00 00       	call   800512 <cprintf>
+  8000b5:	83 c4 10             	add    $0x10,%esp
+  8000b8:	83 ec 08             	sub    $0x8,%esp
+  8000bb:	68 70 17 00 00       	push   $0x1770
+  8000c0:	68 20 70 80 00       	push   $0x807020
+  8000c5:	e8 69 ff ff ff       	call   800033 <sum>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+  8000cd:	85 c0                	test   %eax,%eax
+  8000cf:	0f 84 cd 00 00 00    	je     8001a2 <umain+0x139>
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	50                   	push   %eax
+  8000d9:	68 64 43 80 00       	push   $0x804364
+  8000de:	e8 2f 04 00 00       	call   800512 <cprintf>
+  8000e3:	83 c4 10             	add    $0x10,%esp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+  8000e9:	68 9c 42 80 00       	push   $0x80429c
+  8000ee:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000f4:	50                   	push   %eax
+  8000f5:	e8 33 0b 00 00       	call   800c2d <strcat>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+  8000fd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800101:	7e 3e                	jle    800141 <umain+0xd8>
+  800103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800108:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  80010e:	83 ec 08             	sub    $0x8,%esp
+  800111:	68 a8 42 80 00       	push   $0x8042a8
+  800116:	56                   	push   %esi
+  800117:	e8 11 0b 00 00       	call   800c2d <strcat>
+  80011c:	83 c4 08             	add    $0x8,%esp
+  80011f:	ff 34 9f             	push   (%edi,%ebx,4)
+  800122:	56                   	push   %esi
+  800123:	e8 05 0b 00 00       	call   800c2d <strcat>
+  800128:	83 c4 08             	add    $0x8,%esp
+  80012b:	68 a9 42 80 00       	push   $0x8042a9
+  800130:	56                   	push   %esi
+  800131:	e8 f7 0a 00 00       	call   800c2d <strcat>
+  800136:	83 c3 01             	add    $0x1,%ebx
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  80013f:	75 cd                	jne    80010e <umain+0xa5>
+  800141:	83 ec 08             	sub    $0x8,%esp
+  800144:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80014a:	50                   	push   %eax
+  80014b:	68 ab 42 80 00       	push   $0x8042ab
+  800150:	e8 bd 03 00 00       	call   800512 <cprintf>
+  800155:	c7 04 24 af 42 80 00 	movl   $0x8042af,(%esp)
+  80015c:	e8 b1 03 00 00       	call   800512 <cprintf>
+  800161:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800168:	e8 07 19 00 00       	call   801a74 <close>
+  80016d:	e8 fa 01 00 00       	call   80036c <opencons>
+  800172:	83 c4 10             	add    $0x10,%esp
+  800175:	85 c0                	test   %eax,%eax
+  800177:	78 3e                	js     8001b7 <umain+0x14e>
+  800179:	74 4e                	je     8001c9 <umain+0x160>
+  80017b:	50                   	push   %eax
+  80017c:	68 da 42 80 00       	push   $0x8042da
+  800181:	6a 39                	push   $0x39
+  800183:	68 ce 42 80 00       	push   $0x8042ce
+  800188:	e8 aa 02 00 00       	call   800437 <_panic>
+  80018d:	83 ec 0c             	sub    $0xc,%esp
+  800190:	68 6f 42 80 00       	push   $0x80426f
+  800195:	e8 78 03 00 00       	call   800512 <cprintf>
+  80019a:	83 c4 10             	add    $0x10,%esp
+  80019d:	e9 16 ff ff ff       	jmp    8000b8 <umain+0x4f>
+  8001a2:	83 ec 0c             	sub    $0xc,%esp
+  8001a5:	68 86 42 80 00       	push   $0x804286
+  8001aa:	e8 63 03 00 00       	call   800512 <cprintf>
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	e9 2f ff ff ff       	jmp    8000e6 <umain+0x7d>
+  8001b7:	50                   	push   %eax
+  8001b8:	68 c1 42 80 00       	push   $0x8042c1
+  8001bd:	6a 37                	push   $0x37
+  8001bf:	68 ce 42 80 00       	push   $0x8042ce
+  8001c4:	e8 6e 02 00 00       	call   800437 <_panic>
+  8001c9:	83 ec 08             	sub    $0x8,%esp
+  8001cc:	6a 01                	push   $0x1
+  8001ce:	6a 00                	push   $0x0
+  8001d0:	e8 f1 18 00 00       	call   801ac6 <dup>
+  8001d5:	83 c4 10             	add    $0x10,%esp
+  8001d8:	85 c0                	test   %eax,%eax
+  8001da:	79 23                	jns    8001ff <umain+0x196>
+  8001dc:	50                   	push   %eax
+  8001dd:	68 f4 42 80 00       	push   $0x8042f4
+  8001e2:	6a 3b                	push   $0x3b
+  8001e4:	68 ce 42 80 00       	push   $0x8042ce
+  8001e9:	e8 49 02 00 00       	call   800437 <_panic>
+  8001ee:	83 ec 08             	sub    $0x8,%esp
+  8001f1:	50                   	push   %eax
+  8001f2:	68 13 43 80 00       	push   $0x804313
+  8001f7:	e8 16 03 00 00       	call   800512 <cprintf>
+  8001fc:	83 c4 10             	add    $0x10,%esp
+  8001ff:	83 ec 0c             	sub    $0xc,%esp
+  800202:	68 fc 42 80 00       	push   $0x8042fc
+  800207:	e8 06 03 00 00       	call   800512 <cprintf>
+  80020c:	83 c4 0c             	add    $0xc,%esp
+  80020f:	6a 00                	push   $0x0
+  800211:	68 10 43 80 00       	push   $0x804310
+  800216:	68 0f 43 80 00       	push   $0x80430f
+  80021b:	e8 a5 2a 00 00       	call   802cc5 <spawnl>
+  800220:	83 c4 10             	add    $0x10,%esp
+  800223:	85 c0                	test   %eax,%eax
+  800225:	78 c7                	js     8001ee <umain+0x185>
+  800227:	83 ec 0c             	sub    $0xc,%esp
+  80022a:	50                   	push   %eax
+  80022b:	e8 47 33 00 00       	call   803577 <wait>
+  800230:	83 c4 10             	add    $0x10,%esp
+  800233:	eb ca                	jmp    8001ff <umain+0x196>
+
+00800235 <devcons_close>:
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c3                   	ret
+
+0080023b <devcons_stat>:
+  80023b:	55                   	push   %ebp
+  80023c:	89 e5                	mov    %esp,%ebp
+  80023e:	83 ec 10             	sub    $0x10,%esp
+  800241:	68 93 43 80 00       	push   $0x804393
+  800246:	ff 75 0c             	push   0xc(%ebp)
+  800249:	e8 bb 09 00 00       	call   800c09 <strcpy>
+  80024e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800253:	c9                   	leave
+  800254:	c3                   	ret
+
+00800255 <devcons_write>:
+  800255:	55                   	push   %ebp
+  800256:	89 e5                	mov    %esp,%ebp
+  800258:	57                   	push   %edi
+  800259:	56                   	push   %esi
+  80025a:	53                   	push   %ebx
+  80025b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  800261:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800264:	85 ff                	test   %edi,%edi
+  800266:	74 51                	je     8002b9 <devcons_write+0x64>
+  800268:	be 00 00 00 00       	mov    $0x0,%esi
+  80026d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800272:	89 fb                	mov    %edi,%ebx
+  800274:	29 c3                	sub    %eax,%ebx
+  800276:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80027b:	39 d3                	cmp    %edx,%ebx
+  80027d:	0f 47 da             	cmova  %edx,%ebx
+  800280:	83 ec 04             	sub    $0x4,%esp
+  800283:	53                   	push   %ebx
+  800284:	03 45 0c             	add    0xc(%ebp),%eax
+  800287:	50                   	push   %eax
+  800288:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80028e:	50                   	push   %eax
+  80028f:	e8 25 0b 00 00       	call   800db9 <memmove>
+  800294:	83 c4 08             	add    $0x8,%esp
+  800297:	53                   	push   %ebx
+  800298:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80029e:	50                   	push   %eax
+  80029f:	e8 dd 0c 00 00       	call   800f81 <sys_cputs>
+  8002a4:	01 de                	add    %ebx,%esi
+  8002a6:	89 f0                	mov    %esi,%eax
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	39 fe                	cmp    %edi,%esi
+  8002ad:	72 c3                	jb     800272 <devcons_write+0x1d>
+  8002af:	89 f0                	mov    %esi,%eax
+  8002b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b4:	5b                   	pop    %ebx
+  8002b5:	5e                   	pop    %esi
+  8002b6:	5f                   	pop    %edi
+  8002b7:	5d                   	pop    %ebp
+  8002b8:	c3                   	ret
+  8002b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8002be:	eb ef                	jmp    8002af <devcons_write+0x5a>
+
+008002c0 <devcons_read>:
+  8002c0:	55                   	push   %ebp
+  8002c1:	89 e5                	mov    %esp,%ebp
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002cf:	75 07                	jne    8002d8 <devcons_read+0x18>
+  8002d1:	eb 1f                	jmp    8002f2 <devcons_read+0x32>
+  8002d3:	e8 46 0d 00 00       	call   80101e <sys_yield>
+  8002d8:	e8 c2 0c 00 00       	call   800f9f <sys_cgetc>
+  8002dd:	85 c0                	test   %eax,%eax
+  8002df:	74 f2                	je     8002d3 <devcons_read+0x13>
+  8002e1:	78 0f                	js     8002f2 <devcons_read+0x32>
+  8002e3:	83 f8 04             	cmp    $0x4,%eax
+  8002e6:	74 0c                	je     8002f4 <devcons_read+0x34>
+  8002e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002eb:	88 02                	mov    %al,(%edx)
+  8002ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002f2:	c9                   	leave
+  8002f3:	c3                   	ret
+  8002f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f9:	eb f7                	jmp    8002f2 <devcons_read+0x32>
+
+008002fb <cputchar>:
+  8002fb:	55                   	push   %ebp
+  8002fc:	89 e5                	mov    %esp,%ebp
+  8002fe:	83 ec 20             	sub    $0x20,%esp
+  800301:	8b 45 08             	mov    0x8(%ebp),%eax
+  800304:	88 45 f7             	mov    %al,-0x9(%ebp)
+  800307:	6a 01                	push   $0x1
+  800309:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80030c:	50                   	push   %eax
+  80030d:	e8 6f 0c 00 00       	call   800f81 <sys_cputs>
+  800312:	83 c4 10             	add    $0x10,%esp
+  800315:	c9                   	leave
+  800316:	c3                   	ret
+
+00800317 <getchar>:
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 1c             	sub    $0x1c,%esp
+  80031d:	6a 01                	push   $0x1
+  80031f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800322:	50                   	push   %eax
+  800323:	6a 00                	push   $0x0
+  800325:	e8 86 18 00 00       	call   801bb0 <read>
+  80032a:	83 c4 10             	add    $0x10,%esp
+  80032d:	85 c0                	test   %eax,%eax
+  80032f:	78 06                	js     800337 <getchar+0x20>
+  800331:	74 06                	je     800339 <getchar+0x22>
+  800333:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  800337:	c9                   	leave
+  800338:	c3                   	ret
+  800339:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80033e:	eb f7                	jmp    800337 <getchar+0x20>
+
+00800340 <iscons>:
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	83 ec 20             	sub    $0x20,%esp
+  800346:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800349:	50                   	push   %eax
+  80034a:	ff 75 08             	push   0x8(%ebp)
+  80034d:	e8 fc 15 00 00       	call   80194e <fd_lookup>
+  800352:	83 c4 10             	add    $0x10,%esp
+  800355:	85 c0                	test   %eax,%eax
+  800357:	78 11                	js     80036a <iscons+0x2a>
+  800359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80035c:	8b 15 70 67 80 00    	mov    0x806770,%edx
+  800362:	39 10                	cmp    %edx,(%eax)
+  800364:	0f 94 c0             	sete   %al
+  800367:	0f b6 c0             	movzbl %al,%eax
+  80036a:	c9                   	leave
+  80036b:	c3                   	ret
+
+0080036c <opencons>:
+  80036c:	55                   	push   %ebp
+  80036d:	89 e5                	mov    %esp,%ebp
+  80036f:	83 ec 24             	sub    $0x24,%esp
+  800372:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800375:	50                   	push   %eax
+  800376:	e8 83 15 00 00       	call   8018fe <fd_alloc>
+  80037b:	83 c4 10             	add    $0x10,%esp
+  80037e:	85 c0                	test   %eax,%eax
+  800380:	78 3a                	js     8003bc <opencons+0x50>
+  800382:	83 ec 04             	sub    $0x4,%esp
+  800385:	68 07 04 00 00       	push   $0x407
+  80038a:	ff 75 f4             	push   -0xc(%ebp)
+  80038d:	6a 00                	push   $0x0
+  80038f:	e8 d5 0c 00 00       	call   801069 <sys_page_alloc>
+  800394:	83 c4 10             	add    $0x10,%esp
+  800397:	85 c0                	test   %eax,%eax
+  800399:	78 21                	js     8003bc <opencons+0x50>
+  80039b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80039e:	8b 15 70 67 80 00    	mov    0x806770,%edx
+  8003a4:	89 10                	mov    %edx,(%eax)
+  8003a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8003a9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8003b0:	83 ec 0c             	sub    $0xc,%esp
+  8003b3:	50                   	push   %eax
+  8003b4:	e8 1e 15 00 00       	call   8018d7 <fd2num>
+  8003b9:	83 c4 10             	add    $0x10,%esp
+  8003bc:	c9                   	leave
+  8003bd:	c3                   	ret
+
+008003be <libmain>:
+  8003be:	55                   	push   %ebp
+  8003bf:	89 e5                	mov    %esp,%ebp
+  8003c1:	56                   	push   %esi
+  8003c2:	53                   	push   %ebx
+  8003c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003c6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8003c9:	e8 31 0c 00 00       	call   800fff <sys_getenvid>
+  8003ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003d3:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8003d9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003de:	a3 90 87 80 00       	mov    %eax,0x808790
+  8003e3:	85 db                	test   %ebx,%ebx
+  8003e5:	7e 07                	jle    8003ee <libmain+0x30>
+  8003e7:	8b 06                	mov    (%esi),%eax
+  8003e9:	a3 8c 67 80 00       	mov    %eax,0x80678c
+  8003ee:	83 ec 08             	sub    $0x8,%esp
+  8003f1:	56                   	push   %esi
+  8003f2:	53                   	push   %ebx
+  8003f3:	e8 71 fc ff ff       	call   800069 <umain>
+  8003f8:	e8 0a 00 00 00       	call   800407 <exit>
+  8003fd:	83 c4 10             	add    $0x10,%esp
+  800400:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800403:	5b                   	pop    %ebx
+  800404:	5e                   	pop    %esi
+  800405:	5d                   	pop    %ebp
+  800406:	c3                   	ret
+
+00800407 <exit>:
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 08             	sub    $0x8,%esp
+  80040d:	a1 90 87 80 00       	mov    0x808790,%eax
+  800412:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800418:	85 c0                	test   %eax,%eax
+  80041a:	75 14                	jne    800430 <exit+0x29>
+  80041c:	e8 80 16 00 00       	call   801aa1 <close_all>
+  800421:	83 ec 0c             	sub    $0xc,%esp
+  800424:	6a 00                	push   $0x0
+  800426:	e8 93 0b 00 00       	call   800fbe <sys_env_destroy>
+  80042b:	83 c4 10             	add    $0x10,%esp
+  80042e:	c9                   	leave
+  80042f:	c3                   	ret
+  800430:	e8 f6 12 00 00       	call   80172b <sys_lease_complete>
+  800435:	eb e5                	jmp    80041c <exit+0x15>
+
+00800437 <_panic>:
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	56                   	push   %esi
+  80043b:	53                   	push   %ebx
+  80043c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80043f:	8b 35 8c 67 80 00    	mov    0x80678c,%esi
+  800445:	e8 b5 0b 00 00       	call   800fff <sys_getenvid>
+  80044a:	83 ec 0c             	sub    $0xc,%esp
+  80044d:	ff 75 0c             	push   0xc(%ebp)
+  800450:	ff 75 08             	push   0x8(%ebp)
+  800453:	56                   	push   %esi
+  800454:	50                   	push   %eax
+  800455:	68 ac 43 80 00       	push   $0x8043ac
+  80045a:	e8 b3 00 00 00       	call   800512 <cprintf>
+  80045f:	83 c4 18             	add    $0x18,%esp
+  800462:	53                   	push   %ebx
+  800463:	ff 75 10             	push   0x10(%ebp)
+  800466:	e8 56 00 00 00       	call   8004c1 <vcprintf>
+  80046b:	c7 04 24 cf 48 80 00 	movl   $0x8048cf,(%esp)
+  800472:	e8 9b 00 00 00       	call   800512 <cprintf>
+  800477:	83 c4 10             	add    $0x10,%esp
+  80047a:	cc                   	int3
+  80047b:	eb fd                	jmp    80047a <_panic+0x43>
+
+0080047d <putch>:
+  80047d:	55                   	push   %ebp
+  80047e:	89 e5                	mov    %esp,%ebp
+  800480:	53                   	push   %ebx
+  800481:	83 ec 04             	sub    $0x4,%esp
+  800484:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800487:	8b 13                	mov    (%ebx),%edx
+  800489:	8d 42 01             	lea    0x1(%edx),%eax
+  80048c:	89 03                	mov    %eax,(%ebx)
+  80048e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800491:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800495:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80049a:	74 09                	je     8004a5 <putch+0x28>
+  80049c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8004a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004a3:	c9                   	leave
+  8004a4:	c3                   	ret
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	68 ff 00 00 00       	push   $0xff
+  8004ad:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004b0:	50                   	push   %eax
+  8004b1:	e8 cb 0a 00 00       	call   800f81 <sys_cputs>
+  8004b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	eb db                	jmp    80049c <putch+0x1f>
+
+008004c1 <vcprintf>:
+  8004c1:	55                   	push   %ebp
+  8004c2:	89 e5                	mov    %esp,%ebp
+  8004c4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8004ca:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004d1:	00 00 00 
+  8004d4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004db:	00 00 00 
+  8004de:	ff 75 0c             	push   0xc(%ebp)
+  8004e1:	ff 75 08             	push   0x8(%ebp)
+  8004e4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004ea:	50                   	push   %eax
+  8004eb:	68 7d 04 80 00       	push   $0x80047d
+  8004f0:	e8 1c 01 00 00       	call   800611 <vprintfmt>
+  8004f5:	83 c4 08             	add    $0x8,%esp
+  8004f8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004fe:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800504:	50                   	push   %eax
+  800505:	e8 77 0a 00 00       	call   800f81 <sys_cputs>
+  80050a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800510:	c9                   	leave
+  800511:	c3                   	ret
+
+00800512 <cprintf>:
+  800512:	55                   	push   %ebp
+  800513:	89 e5                	mov    %esp,%ebp
+  800515:	83 ec 10             	sub    $0x10,%esp
+  800518:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80051b:	50                   	push   %eax
+  80051c:	ff 75 08             	push   0x8(%ebp)
+  80051f:	e8 9d ff ff ff       	call   8004c1 <vcprintf>
+  800524:	c9                   	leave
+  800525:	c3                   	ret
+
+00800526 <printnum>:
+  800526:	55                   	push   %ebp
+  800527:	89 e5                	mov    %esp,%ebp
+  800529:	57                   	push   %edi
+  80052a:	56                   	push   %esi
+  80052b:	53                   	push   %ebx
+  80052c:	83 ec 1c             	sub    $0x1c,%esp
+  80052f:	89 c3                	mov    %eax,%ebx
+  800531:	89 d6                	mov    %edx,%esi
+  800533:	8b 45 08             	mov    0x8(%ebp),%eax
+  800536:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800539:	89 d1                	mov    %edx,%ecx
+  80053b:	89 c2                	mov    %eax,%edx
+  80053d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800540:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800543:	8b 45 10             	mov    0x10(%ebp),%eax
+  800546:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800549:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800550:	39 c2                	cmp    %eax,%edx
+  800552:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800555:	73 4b                	jae    8005a2 <printnum+0x7c>
+  800557:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055a:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80055d:	85 ff                	test   %edi,%edi
+  80055f:	7e 11                	jle    800572 <printnum+0x4c>
+  800561:	83 ec 08             	sub    $0x8,%esp
+  800564:	56                   	push   %esi
+  800565:	ff 75 18             	push   0x18(%ebp)
+  800568:	ff d3                	call   *%ebx
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	83 ef 01             	sub    $0x1,%edi
+  800570:	75 ef                	jne    800561 <printnum+0x3b>
+  800572:	83 ec 08             	sub    $0x8,%esp
+  800575:	56                   	push   %esi
+  800576:	83 ec 04             	sub    $0x4,%esp
+  800579:	ff 75 e4             	push   -0x1c(%ebp)
+  80057c:	ff 75 e0             	push   -0x20(%ebp)
+  80057f:	ff 75 dc             	push   -0x24(%ebp)
+  800582:	ff 75 d8             	push   -0x28(%ebp)
+  800585:	e8 d2 3b 00 00       	call   80415c <__umoddi3>
+  80058a:	83 c4 14             	add    $0x14,%esp
+  80058d:	0f be 80 cf 43 80 00 	movsbl 0x8043cf(%eax),%eax
+  800594:	50                   	push   %eax
+  800595:	ff d3                	call   *%ebx
+  800597:	83 c4 10             	add    $0x10,%esp
+  80059a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80059d:	5b                   	pop    %ebx
+  80059e:	5e                   	pop    %esi
+  80059f:	5f                   	pop    %edi
+  8005a0:	5d                   	pop    %ebp
+  8005a1:	c3                   	ret
+  8005a2:	83 ec 0c             	sub    $0xc,%esp
+  8005a5:	ff 75 18             	push   0x18(%ebp)
+  8005a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005ab:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8005ae:	52                   	push   %edx
+  8005af:	50                   	push   %eax
+  8005b0:	83 ec 08             	sub    $0x8,%esp
+  8005b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8005b6:	ff 75 e0             	push   -0x20(%ebp)
+  8005b9:	ff 75 dc             	push   -0x24(%ebp)
+  8005bc:	ff 75 d8             	push   -0x28(%ebp)
+  8005bf:	e8 7a 3b 00 00       	call   80413e <__udivdi3>
+  8005c4:	83 c4 18             	add    $0x18,%esp
+  8005c7:	52                   	push   %edx
+  8005c8:	50                   	push   %eax
+  8005c9:	89 f2                	mov    %esi,%edx
+  8005cb:	89 d8                	mov    %ebx,%eax
+  8005cd:	e8 54 ff ff ff       	call   800526 <printnum>
+  8005d2:	83 c4 20             	add    $0x20,%esp
+  8005d5:	eb 9b                	jmp    800572 <printnum+0x4c>
+
+008005d7 <sprintputch>:
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8005dd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8005e1:	8b 10                	mov    (%eax),%edx
+  8005e3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005e6:	73 0a                	jae    8005f2 <sprintputch+0x1b>
+  8005e8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005eb:	89 08                	mov    %ecx,(%eax)
+  8005ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005f0:	88 02                	mov    %al,(%edx)
+  8005f2:	5d                   	pop    %ebp
+  8005f3:	c3                   	ret
+
+008005f4 <printfmt>:
+  8005f4:	55                   	push   %ebp
+  8005f5:	89 e5                	mov    %esp,%ebp
+  8005f7:	83 ec 08             	sub    $0x8,%esp
+  8005fa:	8d 45 14             	lea    0x14(%ebp),%eax
+  8005fd:	50                   	push   %eax
+  8005fe:	ff 75 10             	push   0x10(%ebp)
+  800601:	ff 75 0c             	push   0xc(%ebp)
+  800604:	ff 75 08             	push   0x8(%ebp)
+  800607:	e8 05 00 00 00       	call   800611 <vprintfmt>
+  80060c:	83 c4 10             	add    $0x10,%esp
+  80060f:	c9                   	leave
+  800610:	c3                   	ret
+
+00800611 <vprintfmt>:
+  800611:	55                   	push   %ebp
+  800612:	89 e5                	mov    %esp,%ebp
+  800614:	57                   	push   %edi
+  800615:	56                   	push   %esi
+  800616:	53                   	push   %ebx
+  800617:	83 ec 2c             	sub    $0x2c,%esp
+  80061a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80061d:	89 df                	mov    %ebx,%edi
+  80061f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800622:	8b 45 10             	mov    0x10(%ebp),%eax
+  800625:	8d 70 01             	lea    0x1(%eax),%esi
+  800628:	0f b6 00             	movzbl (%eax),%eax
+  80062b:	83 f8 25             	cmp    $0x25,%eax
+  80062e:	74 1e                	je     80064e <vprintfmt+0x3d>
+  800630:	85 c0                	test   %eax,%eax
+  800632:	0f 84 15 05 00 00    	je     800b4d <vprintfmt+0x53c>
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	50                   	push   %eax
+  80063d:	ff d7                	call   *%edi
+  80063f:	83 c6 01             	add    $0x1,%esi
+  800642:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800646:	83 c4 10             	add    $0x10,%esp
+  800649:	83 f8 25             	cmp    $0x25,%eax
+  80064c:	75 e2                	jne    800630 <vprintfmt+0x1f>
+  80064e:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800652:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800659:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800660:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80066f:	8d 56 01             	lea    0x1(%esi),%edx
+  800672:	0f b6 0e             	movzbl (%esi),%ecx
+  800675:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800678:	3c 55                	cmp    $0x55,%al
+  80067a:	0f 87 3b 04 00 00    	ja     800abb <vprintfmt+0x4aa>
+  800680:	0f b6 c0             	movzbl %al,%eax
+  800683:	ff 24 85 20 45 80 00 	jmp    *0x804520(,%eax,4)
+  80068a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80068d:	eb 93                	jmp    800622 <vprintfmt+0x11>
+  80068f:	89 d6                	mov    %edx,%esi
+  800691:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800695:	eb d8                	jmp    80066f <vprintfmt+0x5e>
+  800697:	89 d6                	mov    %edx,%esi
+  800699:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80069d:	eb d0                	jmp    80066f <vprintfmt+0x5e>
+  80069f:	0f b6 c9             	movzbl %cl,%ecx
+  8006a2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8006a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8006a8:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8006ac:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006af:	83 f9 09             	cmp    $0x9,%ecx
+  8006b2:	77 6f                	ja     800723 <vprintfmt+0x112>
+  8006b4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8006b7:	83 c2 01             	add    $0x1,%edx
+  8006ba:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8006bd:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8006c1:	0f be 02             	movsbl (%edx),%eax
+  8006c4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8006c7:	83 fe 09             	cmp    $0x9,%esi
+  8006ca:	76 eb                	jbe    8006b7 <vprintfmt+0xa6>
+  8006cc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8006cf:	89 d6                	mov    %edx,%esi
+  8006d1:	eb 13                	jmp    8006e6 <vprintfmt+0xd5>
+  8006d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d6:	8b 00                	mov    (%eax),%eax
+  8006d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e4:	89 d6                	mov    %edx,%esi
+  8006e6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006ea:	79 83                	jns    80066f <vprintfmt+0x5e>
+  8006ec:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f2:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8006f9:	e9 71 ff ff ff       	jmp    80066f <vprintfmt+0x5e>
+  8006fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800701:	85 c9                	test   %ecx,%ecx
+  800703:	b8 00 00 00 00       	mov    $0x0,%eax
+  800708:	0f 49 c1             	cmovns %ecx,%eax
+  80070b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80070e:	89 d6                	mov    %edx,%esi
+  800710:	e9 5a ff ff ff       	jmp    80066f <vprintfmt+0x5e>
+  800715:	89 d6                	mov    %edx,%esi
+  800717:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80071e:	e9 4c ff ff ff       	jmp    80066f <vprintfmt+0x5e>
+  800723:	89 d6                	mov    %edx,%esi
+  800725:	eb bf                	jmp    8006e6 <vprintfmt+0xd5>
+  800727:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80072b:	89 d6                	mov    %edx,%esi
+  80072d:	e9 3d ff ff ff       	jmp    80066f <vprintfmt+0x5e>
+  800732:	89 55 10             	mov    %edx,0x10(%ebp)
+  800735:	8b 45 14             	mov    0x14(%ebp),%eax
+  800738:	8d 70 04             	lea    0x4(%eax),%esi
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	53                   	push   %ebx
+  80073f:	ff 30                	push   (%eax)
+  800741:	ff d7                	call   *%edi
+  800743:	83 c4 10             	add    $0x10,%esp
+  800746:	89 75 14             	mov    %esi,0x14(%ebp)
+  800749:	e9 d4 fe ff ff       	jmp    800622 <vprintfmt+0x11>
+  80074e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8d 70 04             	lea    0x4(%eax),%esi
+  800757:	8b 10                	mov    (%eax),%edx
+  800759:	89 d0                	mov    %edx,%eax
+  80075b:	f7 d8                	neg    %eax
+  80075d:	0f 48 c2             	cmovs  %edx,%eax
+  800760:	83 f8 12             	cmp    $0x12,%eax
+  800763:	7f 23                	jg     800788 <vprintfmt+0x177>
+  800765:	8b 14 85 80 46 80 00 	mov    0x804680(,%eax,4),%edx
+  80076c:	85 d2                	test   %edx,%edx
+  80076e:	74 18                	je     800788 <vprintfmt+0x177>
+  800770:	52                   	push   %edx
+  800771:	68 fd 47 80 00       	push   $0x8047fd
+  800776:	53                   	push   %ebx
+  800777:	57                   	push   %edi
+  800778:	e8 77 fe ff ff       	call   8005f4 <printfmt>
+  80077d:	83 c4 10             	add    $0x10,%esp
+  800780:	89 75 14             	mov    %esi,0x14(%ebp)
+  800783:	e9 9a fe ff ff       	jmp    800622 <vprintfmt+0x11>
+  800788:	50                   	push   %eax
+  800789:	68 e7 43 80 00       	push   $0x8043e7
+  80078e:	53                   	push   %ebx
+  80078f:	57                   	push   %edi
+  800790:	e8 5f fe ff ff       	call   8005f4 <printfmt>
+  800795:	83 c4 10             	add    $0x10,%esp
+  800798:	89 75 14             	mov    %esi,0x14(%ebp)
+  80079b:	e9 82 fe ff ff       	jmp    800622 <vprintfmt+0x11>
+  8007a0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	83 c0 04             	add    $0x4,%eax
+  8007a9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8b 00                	mov    (%eax),%eax
+  8007b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007b4:	85 c0                	test   %eax,%eax
+  8007b6:	0f 84 61 03 00 00    	je     800b1d <vprintfmt+0x50c>
+  8007bc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007c0:	7e 06                	jle    8007c8 <vprintfmt+0x1b7>
+  8007c2:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007c6:	75 29                	jne    8007f1 <vprintfmt+0x1e0>
+  8007c8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007cb:	8d 70 01             	lea    0x1(%eax),%esi
+  8007ce:	0f b6 00             	movzbl (%eax),%eax
+  8007d1:	0f be d0             	movsbl %al,%edx
+  8007d4:	85 d2                	test   %edx,%edx
+  8007d6:	0f 84 bb 00 00 00    	je     800897 <vprintfmt+0x286>
+  8007dc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007df:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007e2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007e5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007e8:	eb 7a                	jmp    800864 <vprintfmt+0x253>
+  8007ea:	c7 45 d0 e0 43 80 00 	movl   $0x8043e0,-0x30(%ebp)
+  8007f1:	83 ec 08             	sub    $0x8,%esp
+  8007f4:	ff 75 d4             	push   -0x2c(%ebp)
+  8007f7:	ff 75 d0             	push   -0x30(%ebp)
+  8007fa:	e8 e0 03 00 00       	call   800bdf <strnlen>
+  8007ff:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800802:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800805:	83 c4 10             	add    $0x10,%esp
+  800808:	85 d2                	test   %edx,%edx
+  80080a:	0f 8e d6 02 00 00    	jle    800ae6 <vprintfmt+0x4d5>
+  800810:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800814:	83 ec 08             	sub    $0x8,%esp
+  800817:	53                   	push   %ebx
+  800818:	56                   	push   %esi
+  800819:	ff d7                	call   *%edi
+  80081b:	83 c4 10             	add    $0x10,%esp
+  80081e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800822:	75 f0                	jne    800814 <vprintfmt+0x203>
+  800824:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800827:	8d 70 01             	lea    0x1(%eax),%esi
+  80082a:	0f b6 00             	movzbl (%eax),%eax
+  80082d:	0f be d0             	movsbl %al,%edx
+  800830:	85 d2                	test   %edx,%edx
+  800832:	0f 84 da 02 00 00    	je     800b12 <vprintfmt+0x501>
+  800838:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80083b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80083e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800841:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800844:	eb 1e                	jmp    800864 <vprintfmt+0x253>
+  800846:	83 ec 08             	sub    $0x8,%esp
+  800849:	ff 75 0c             	push   0xc(%ebp)
+  80084c:	52                   	push   %edx
+  80084d:	ff 55 08             	call   *0x8(%ebp)
+  800850:	83 c4 10             	add    $0x10,%esp
+  800853:	83 eb 01             	sub    $0x1,%ebx
+  800856:	83 c6 01             	add    $0x1,%esi
+  800859:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80085d:	0f be d0             	movsbl %al,%edx
+  800860:	85 d2                	test   %edx,%edx
+  800862:	74 2a                	je     80088e <vprintfmt+0x27d>
+  800864:	85 ff                	test   %edi,%edi
+  800866:	78 05                	js     80086d <vprintfmt+0x25c>
+  800868:	83 ef 01             	sub    $0x1,%edi
+  80086b:	78 59                	js     8008c6 <vprintfmt+0x2b5>
+  80086d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800871:	74 d3                	je     800846 <vprintfmt+0x235>
+  800873:	0f be c0             	movsbl %al,%eax
+  800876:	83 e8 20             	sub    $0x20,%eax
+  800879:	83 f8 5e             	cmp    $0x5e,%eax
+  80087c:	76 c8                	jbe    800846 <vprintfmt+0x235>
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	ff 75 0c             	push   0xc(%ebp)
+  800884:	6a 3f                	push   $0x3f
+  800886:	ff 55 08             	call   *0x8(%ebp)
+  800889:	83 c4 10             	add    $0x10,%esp
+  80088c:	eb c5                	jmp    800853 <vprintfmt+0x242>
+  80088e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800891:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800894:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800897:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80089a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80089e:	7e 1b                	jle    8008bb <vprintfmt+0x2aa>
+  8008a0:	83 ec 08             	sub    $0x8,%esp
+  8008a3:	53                   	push   %ebx
+  8008a4:	6a 20                	push   $0x20
+  8008a6:	ff d7                	call   *%edi
+  8008a8:	83 c4 10             	add    $0x10,%esp
+  8008ab:	83 ee 01             	sub    $0x1,%esi
+  8008ae:	75 f0                	jne    8008a0 <vprintfmt+0x28f>
+  8008b0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b6:	e9 67 fd ff ff       	jmp    800622 <vprintfmt+0x11>
+  8008bb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c1:	e9 5c fd ff ff       	jmp    800622 <vprintfmt+0x11>
+  8008c6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8008c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008cf:	eb c6                	jmp    800897 <vprintfmt+0x286>
+  8008d1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008d4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008d7:	83 f9 01             	cmp    $0x1,%ecx
+  8008da:	7f 1f                	jg     8008fb <vprintfmt+0x2ea>
+  8008dc:	85 c9                	test   %ecx,%ecx
+  8008de:	74 67                	je     800947 <vprintfmt+0x336>
+  8008e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e3:	8b 30                	mov    (%eax),%esi
+  8008e5:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008e8:	89 f0                	mov    %esi,%eax
+  8008ea:	c1 f8 1f             	sar    $0x1f,%eax
+  8008ed:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f9:	eb 17                	jmp    800912 <vprintfmt+0x301>
+  8008fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fe:	8b 50 04             	mov    0x4(%eax),%edx
+  800901:	8b 00                	mov    (%eax),%eax
+  800903:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800906:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800909:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090c:	8d 40 08             	lea    0x8(%eax),%eax
+  80090f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800912:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800915:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800918:	be 0a 00 00 00       	mov    $0xa,%esi
+  80091d:	85 c9                	test   %ecx,%ecx
+  80091f:	0f 89 12 01 00 00    	jns    800a37 <vprintfmt+0x426>
+  800925:	83 ec 08             	sub    $0x8,%esp
+  800928:	53                   	push   %ebx
+  800929:	6a 2d                	push   $0x2d
+  80092b:	ff d7                	call   *%edi
+  80092d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800930:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800933:	f7 da                	neg    %edx
+  800935:	83 d1 00             	adc    $0x0,%ecx
+  800938:	f7 d9                	neg    %ecx
+  80093a:	83 c4 10             	add    $0x10,%esp
+  80093d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800942:	e9 f0 00 00 00       	jmp    800a37 <vprintfmt+0x426>
+  800947:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094a:	8b 30                	mov    (%eax),%esi
+  80094c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80094f:	89 f0                	mov    %esi,%eax
+  800951:	c1 f8 1f             	sar    $0x1f,%eax
+  800954:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800957:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095a:	8d 40 04             	lea    0x4(%eax),%eax
+  80095d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800960:	eb b0                	jmp    800912 <vprintfmt+0x301>
+  800962:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800965:	89 55 10             	mov    %edx,0x10(%ebp)
+  800968:	83 f9 01             	cmp    $0x1,%ecx
+  80096b:	7f 1e                	jg     80098b <vprintfmt+0x37a>
+  80096d:	85 c9                	test   %ecx,%ecx
+  80096f:	74 32                	je     8009a3 <vprintfmt+0x392>
+  800971:	8b 45 14             	mov    0x14(%ebp),%eax
+  800974:	8b 10                	mov    (%eax),%edx
+  800976:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097b:	8d 40 04             	lea    0x4(%eax),%eax
+  80097e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800981:	be 0a 00 00 00       	mov    $0xa,%esi
+  800986:	e9 ac 00 00 00       	jmp    800a37 <vprintfmt+0x426>
+  80098b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098e:	8b 10                	mov    (%eax),%edx
+  800990:	8b 48 04             	mov    0x4(%eax),%ecx
+  800993:	8d 40 08             	lea    0x8(%eax),%eax
+  800996:	89 45 14             	mov    %eax,0x14(%ebp)
+  800999:	be 0a 00 00 00       	mov    $0xa,%esi
+  80099e:	e9 94 00 00 00       	jmp    800a37 <vprintfmt+0x426>
+  8009a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a6:	8b 10                	mov    (%eax),%edx
+  8009a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009b3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8009b8:	eb 7d                	jmp    800a37 <vprintfmt+0x426>
+  8009ba:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009bd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009c0:	83 f9 01             	cmp    $0x1,%ecx
+  8009c3:	7f 1b                	jg     8009e0 <vprintfmt+0x3cf>
+  8009c5:	85 c9                	test   %ecx,%ecx
+  8009c7:	74 2c                	je     8009f5 <vprintfmt+0x3e4>
+  8009c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cc:	8b 10                	mov    (%eax),%edx
+  8009ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d9:	be 08 00 00 00       	mov    $0x8,%esi
+  8009de:	eb 57                	jmp    800a37 <vprintfmt+0x426>
+  8009e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e3:	8b 10                	mov    (%eax),%edx
+  8009e5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ee:	be 08 00 00 00       	mov    $0x8,%esi
+  8009f3:	eb 42                	jmp    800a37 <vprintfmt+0x426>
+  8009f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f8:	8b 10                	mov    (%eax),%edx
+  8009fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800a02:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a05:	be 08 00 00 00       	mov    $0x8,%esi
+  800a0a:	eb 2b                	jmp    800a37 <vprintfmt+0x426>
+  800a0c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a0f:	83 ec 08             	sub    $0x8,%esp
+  800a12:	53                   	push   %ebx
+  800a13:	6a 30                	push   $0x30
+  800a15:	ff d7                	call   *%edi
+  800a17:	83 c4 08             	add    $0x8,%esp
+  800a1a:	53                   	push   %ebx
+  800a1b:	6a 78                	push   $0x78
+  800a1d:	ff d7                	call   *%edi
+  800a1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a22:	8b 10                	mov    (%eax),%edx
+  800a24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a29:	83 c4 10             	add    $0x10,%esp
+  800a2c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a32:	be 10 00 00 00       	mov    $0x10,%esi
+  800a37:	83 ec 0c             	sub    $0xc,%esp
+  800a3a:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800a3e:	50                   	push   %eax
+  800a3f:	ff 75 e4             	push   -0x1c(%ebp)
+  800a42:	56                   	push   %esi
+  800a43:	51                   	push   %ecx
+  800a44:	52                   	push   %edx
+  800a45:	89 da                	mov    %ebx,%edx
+  800a47:	89 f8                	mov    %edi,%eax
+  800a49:	e8 d8 fa ff ff       	call   800526 <printnum>
+  800a4e:	83 c4 20             	add    $0x20,%esp
+  800a51:	e9 cc fb ff ff       	jmp    800622 <vprintfmt+0x11>
+  800a56:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a59:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a5c:	83 f9 01             	cmp    $0x1,%ecx
+  800a5f:	7f 1b                	jg     800a7c <vprintfmt+0x46b>
+  800a61:	85 c9                	test   %ecx,%ecx
+  800a63:	74 2c                	je     800a91 <vprintfmt+0x480>
+  800a65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a68:	8b 10                	mov    (%eax),%edx
+  800a6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a6f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a72:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a75:	be 10 00 00 00       	mov    $0x10,%esi
+  800a7a:	eb bb                	jmp    800a37 <vprintfmt+0x426>
+  800a7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7f:	8b 10                	mov    (%eax),%edx
+  800a81:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a84:	8d 40 08             	lea    0x8(%eax),%eax
+  800a87:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a8a:	be 10 00 00 00       	mov    $0x10,%esi
+  800a8f:	eb a6                	jmp    800a37 <vprintfmt+0x426>
+  800a91:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a94:	8b 10                	mov    (%eax),%edx
+  800a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a9e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa1:	be 10 00 00 00       	mov    $0x10,%esi
+  800aa6:	eb 8f                	jmp    800a37 <vprintfmt+0x426>
+  800aa8:	89 55 10             	mov    %edx,0x10(%ebp)
+  800aab:	83 ec 08             	sub    $0x8,%esp
+  800aae:	53                   	push   %ebx
+  800aaf:	6a 25                	push   $0x25
+  800ab1:	ff d7                	call   *%edi
+  800ab3:	83 c4 10             	add    $0x10,%esp
+  800ab6:	e9 67 fb ff ff       	jmp    800622 <vprintfmt+0x11>
+  800abb:	83 ec 08             	sub    $0x8,%esp
+  800abe:	53                   	push   %ebx
+  800abf:	6a 25                	push   $0x25
+  800ac1:	ff d7                	call   *%edi
+  800ac3:	83 c4 10             	add    $0x10,%esp
+  800ac6:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800aca:	0f 84 ba fb ff ff    	je     80068a <vprintfmt+0x79>
+  800ad0:	89 75 10             	mov    %esi,0x10(%ebp)
+  800ad3:	89 f0                	mov    %esi,%eax
+  800ad5:	83 e8 01             	sub    $0x1,%eax
+  800ad8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800adc:	75 f7                	jne    800ad5 <vprintfmt+0x4c4>
+  800ade:	89 45 10             	mov    %eax,0x10(%ebp)
+  800ae1:	e9 3c fb ff ff       	jmp    800622 <vprintfmt+0x11>
+  800ae6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ae9:	8d 70 01             	lea    0x1(%eax),%esi
+  800aec:	0f b6 00             	movzbl (%eax),%eax
+  800aef:	0f be d0             	movsbl %al,%edx
+  800af2:	85 d2                	test   %edx,%edx
+  800af4:	74 11                	je     800b07 <vprintfmt+0x4f6>
+  800af6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800af9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800afc:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800aff:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b02:	e9 5d fd ff ff       	jmp    800864 <vprintfmt+0x253>
+  800b07:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b0a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b0d:	e9 10 fb ff ff       	jmp    800622 <vprintfmt+0x11>
+  800b12:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b15:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b18:	e9 05 fb ff ff       	jmp    800622 <vprintfmt+0x11>
+  800b1d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b21:	7e 0a                	jle    800b2d <vprintfmt+0x51c>
+  800b23:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800b27:	0f 85 bd fc ff ff    	jne    8007ea <vprintfmt+0x1d9>
+  800b2d:	ba 28 00 00 00       	mov    $0x28,%edx
+  800b32:	b8 28 00 00 00       	mov    $0x28,%eax
+  800b37:	be e1 43 80 00       	mov    $0x8043e1,%esi
+  800b3c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b3f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b42:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b45:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b48:	e9 17 fd ff ff       	jmp    800864 <vprintfmt+0x253>
+  800b4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b50:	5b                   	pop    %ebx
+  800b51:	5e                   	pop    %esi
+  800b52:	5f                   	pop    %edi
+  800b53:	5d                   	pop    %ebp
+  800b54:	c3                   	ret
+
+00800b55 <vsnprintf>:
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	83 ec 18             	sub    $0x18,%esp
+  800b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b61:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b64:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b68:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b6b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b72:	85 c0                	test   %eax,%eax
+  800b74:	74 26                	je     800b9c <vsnprintf+0x47>
+  800b76:	85 d2                	test   %edx,%edx
+  800b78:	7e 22                	jle    800b9c <vsnprintf+0x47>
+  800b7a:	ff 75 14             	push   0x14(%ebp)
+  800b7d:	ff 75 10             	push   0x10(%ebp)
+  800b80:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b83:	50                   	push   %eax
+  800b84:	68 d7 05 80 00       	push   $0x8005d7
+  800b89:	e8 83 fa ff ff       	call   800611 <vprintfmt>
+  800b8e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b91:	c6 00 00             	movb   $0x0,(%eax)
+  800b94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b97:	83 c4 10             	add    $0x10,%esp
+  800b9a:	c9                   	leave
+  800b9b:	c3                   	ret
+  800b9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba1:	eb f7                	jmp    800b9a <vsnprintf+0x45>
+
+00800ba3 <snprintf>:
+  800ba3:	55                   	push   %ebp
+  800ba4:	89 e5                	mov    %esp,%ebp
+  800ba6:	83 ec 08             	sub    $0x8,%esp
+  800ba9:	8d 45 14             	lea    0x14(%ebp),%eax
+  800bac:	50                   	push   %eax
+  800bad:	ff 75 10             	push   0x10(%ebp)
+  800bb0:	ff 75 0c             	push   0xc(%ebp)
+  800bb3:	ff 75 08             	push   0x8(%ebp)
+  800bb6:	e8 9a ff ff ff       	call   800b55 <vsnprintf>
+  800bbb:	c9                   	leave
+  800bbc:	c3                   	ret
+
+00800bbd <strlen>:
+  800bbd:	55                   	push   %ebp
+  800bbe:	89 e5                	mov    %esp,%ebp
+  800bc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc3:	80 3a 00             	cmpb   $0x0,(%edx)
+  800bc6:	74 10                	je     800bd8 <strlen+0x1b>
+  800bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcd:	83 c0 01             	add    $0x1,%eax
+  800bd0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bd4:	75 f7                	jne    800bcd <strlen+0x10>
+  800bd6:	5d                   	pop    %ebp
+  800bd7:	c3                   	ret
+  800bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdd:	eb f7                	jmp    800bd6 <strlen+0x19>
+
+00800bdf <strnlen>:
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800be5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be8:	85 d2                	test   %edx,%edx
+  800bea:	74 16                	je     800c02 <strnlen+0x23>
+  800bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bf5:	74 09                	je     800c00 <strnlen+0x21>
+  800bf7:	83 c0 01             	add    $0x1,%eax
+  800bfa:	39 d0                	cmp    %edx,%eax
+  800bfc:	75 f3                	jne    800bf1 <strnlen+0x12>
+  800bfe:	89 d0                	mov    %edx,%eax
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+  800c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c07:	eb f7                	jmp    800c00 <strnlen+0x21>
+
+00800c09 <strcpy>:
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	53                   	push   %ebx
+  800c0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c1c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c1f:	83 c0 01             	add    $0x1,%eax
+  800c22:	84 d2                	test   %dl,%dl
+  800c24:	75 f2                	jne    800c18 <strcpy+0xf>
+  800c26:	89 c8                	mov    %ecx,%eax
+  800c28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c2b:	c9                   	leave
+  800c2c:	c3                   	ret
+
+00800c2d <strcat>:
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	53                   	push   %ebx
+  800c31:	83 ec 10             	sub    $0x10,%esp
+  800c34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c37:	53                   	push   %ebx
+  800c38:	e8 80 ff ff ff       	call   800bbd <strlen>
+  800c3d:	83 c4 08             	add    $0x8,%esp
+  800c40:	ff 75 0c             	push   0xc(%ebp)
+  800c43:	01 d8                	add    %ebx,%eax
+  800c45:	50                   	push   %eax
+  800c46:	e8 be ff ff ff       	call   800c09 <strcpy>
+  800c4b:	89 d8                	mov    %ebx,%eax
+  800c4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c50:	c9                   	leave
+  800c51:	c3                   	ret
+
+00800c52 <strncpy>:
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	56                   	push   %esi
+  800c56:	53                   	push   %ebx
+  800c57:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c60:	85 db                	test   %ebx,%ebx
+  800c62:	74 17                	je     800c7b <strncpy+0x29>
+  800c64:	01 f3                	add    %esi,%ebx
+  800c66:	89 f0                	mov    %esi,%eax
+  800c68:	83 c0 01             	add    $0x1,%eax
+  800c6b:	0f b6 0a             	movzbl (%edx),%ecx
+  800c6e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800c71:	80 f9 01             	cmp    $0x1,%cl
+  800c74:	83 da ff             	sbb    $0xffffffff,%edx
+  800c77:	39 c3                	cmp    %eax,%ebx
+  800c79:	75 ed                	jne    800c68 <strncpy+0x16>
+  800c7b:	89 f0                	mov    %esi,%eax
+  800c7d:	5b                   	pop    %ebx
+  800c7e:	5e                   	pop    %esi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <strlcpy>:
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+  800c86:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c8f:	89 f0                	mov    %esi,%eax
+  800c91:	85 db                	test   %ebx,%ebx
+  800c93:	74 1e                	je     800cb3 <strlcpy+0x32>
+  800c95:	83 eb 01             	sub    $0x1,%ebx
+  800c98:	74 16                	je     800cb0 <strlcpy+0x2f>
+  800c9a:	01 f3                	add    %esi,%ebx
+  800c9c:	0f b6 0a             	movzbl (%edx),%ecx
+  800c9f:	84 c9                	test   %cl,%cl
+  800ca1:	74 0d                	je     800cb0 <strlcpy+0x2f>
+  800ca3:	83 c2 01             	add    $0x1,%edx
+  800ca6:	83 c0 01             	add    $0x1,%eax
+  800ca9:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800cac:	39 d8                	cmp    %ebx,%eax
+  800cae:	75 ec                	jne    800c9c <strlcpy+0x1b>
+  800cb0:	c6 00 00             	movb   $0x0,(%eax)
+  800cb3:	29 f0                	sub    %esi,%eax
+  800cb5:	5b                   	pop    %ebx
+  800cb6:	5e                   	pop    %esi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	c3                   	ret
+
+00800cb9 <strcmp>:
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cc2:	0f b6 01             	movzbl (%ecx),%eax
+  800cc5:	84 c0                	test   %al,%al
+  800cc7:	74 11                	je     800cda <strcmp+0x21>
+  800cc9:	38 02                	cmp    %al,(%edx)
+  800ccb:	75 0d                	jne    800cda <strcmp+0x21>
+  800ccd:	83 c1 01             	add    $0x1,%ecx
+  800cd0:	83 c2 01             	add    $0x1,%edx
+  800cd3:	0f b6 01             	movzbl (%ecx),%eax
+  800cd6:	84 c0                	test   %al,%al
+  800cd8:	75 ef                	jne    800cc9 <strcmp+0x10>
+  800cda:	0f b6 c0             	movzbl %al,%eax
+  800cdd:	0f b6 12             	movzbl (%edx),%edx
+  800ce0:	29 d0                	sub    %edx,%eax
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+
+00800ce4 <strncmp>:
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	53                   	push   %ebx
+  800ce8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ceb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cee:	8b 55 10             	mov    0x10(%ebp),%edx
+  800cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf6:	85 d2                	test   %edx,%edx
+  800cf8:	74 2e                	je     800d28 <strncmp+0x44>
+  800cfa:	0f b6 01             	movzbl (%ecx),%eax
+  800cfd:	84 c0                	test   %al,%al
+  800cff:	74 16                	je     800d17 <strncmp+0x33>
+  800d01:	3a 03                	cmp    (%ebx),%al
+  800d03:	75 12                	jne    800d17 <strncmp+0x33>
+  800d05:	83 c1 01             	add    $0x1,%ecx
+  800d08:	83 c3 01             	add    $0x1,%ebx
+  800d0b:	83 ea 01             	sub    $0x1,%edx
+  800d0e:	75 ea                	jne    800cfa <strncmp+0x16>
+  800d10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d15:	eb 11                	jmp    800d28 <strncmp+0x44>
+  800d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1c:	85 d2                	test   %edx,%edx
+  800d1e:	74 08                	je     800d28 <strncmp+0x44>
+  800d20:	0f b6 01             	movzbl (%ecx),%eax
+  800d23:	0f b6 13             	movzbl (%ebx),%edx
+  800d26:	29 d0                	sub    %edx,%eax
+  800d28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d2b:	c9                   	leave
+  800d2c:	c3                   	ret
+
+00800d2d <strchr>:
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d33:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800d37:	0f b6 10             	movzbl (%eax),%edx
+  800d3a:	84 d2                	test   %dl,%dl
+  800d3c:	74 15                	je     800d53 <strchr+0x26>
+  800d3e:	38 d1                	cmp    %dl,%cl
+  800d40:	74 0f                	je     800d51 <strchr+0x24>
+  800d42:	83 c0 01             	add    $0x1,%eax
+  800d45:	0f b6 10             	movzbl (%eax),%edx
+  800d48:	84 d2                	test   %dl,%dl
+  800d4a:	75 f2                	jne    800d3e <strchr+0x11>
+  800d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+  800d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d58:	eb f7                	jmp    800d51 <strchr+0x24>
+
+00800d5a <strfind>:
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	53                   	push   %ebx
+  800d5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d64:	0f b6 18             	movzbl (%eax),%ebx
+  800d67:	38 d3                	cmp    %dl,%bl
+  800d69:	74 14                	je     800d7f <strfind+0x25>
+  800d6b:	89 d1                	mov    %edx,%ecx
+  800d6d:	84 db                	test   %bl,%bl
+  800d6f:	74 0e                	je     800d7f <strfind+0x25>
+  800d71:	83 c0 01             	add    $0x1,%eax
+  800d74:	0f b6 10             	movzbl (%eax),%edx
+  800d77:	38 ca                	cmp    %cl,%dl
+  800d79:	74 04                	je     800d7f <strfind+0x25>
+  800d7b:	84 d2                	test   %dl,%dl
+  800d7d:	75 f2                	jne    800d71 <strfind+0x17>
+  800d7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d82:	c9                   	leave
+  800d83:	c3                   	ret
+
+00800d84 <memset>:
+  800d84:	55                   	push   %ebp
+  800d85:	89 e5                	mov    %esp,%ebp
+  800d87:	57                   	push   %edi
+  800d88:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d8b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800d8e:	85 c9                	test   %ecx,%ecx
+  800d90:	74 20                	je     800db2 <memset+0x2e>
+  800d92:	89 f8                	mov    %edi,%eax
+  800d94:	09 c8                	or     %ecx,%eax
+  800d96:	a8 03                	test   $0x3,%al
+  800d98:	75 12                	jne    800dac <memset+0x28>
+  800d9a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d9e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800da4:	c1 e9 02             	shr    $0x2,%ecx
+  800da7:	fc                   	cld
+  800da8:	f3 ab                	rep stos %eax,%es:(%edi)
+  800daa:	eb 06                	jmp    800db2 <memset+0x2e>
+  800dac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800daf:	fc                   	cld
+  800db0:	f3 aa                	rep stos %al,%es:(%edi)
+  800db2:	89 f8                	mov    %edi,%eax
+  800db4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800db7:	c9                   	leave
+  800db8:	c3                   	ret
+
+00800db9 <memmove>:
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	56                   	push   %esi
+  800dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800dc4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800dc7:	39 c6                	cmp    %eax,%esi
+  800dc9:	73 32                	jae    800dfd <memmove+0x44>
+  800dcb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800dce:	39 d0                	cmp    %edx,%eax
+  800dd0:	73 2b                	jae    800dfd <memmove+0x44>
+  800dd2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800dd5:	89 d6                	mov    %edx,%esi
+  800dd7:	09 fe                	or     %edi,%esi
+  800dd9:	09 ce                	or     %ecx,%esi
+  800ddb:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800de1:	75 0e                	jne    800df1 <memmove+0x38>
+  800de3:	83 ef 04             	sub    $0x4,%edi
+  800de6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800de9:	c1 e9 02             	shr    $0x2,%ecx
+  800dec:	fd                   	std
+  800ded:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800def:	eb 09                	jmp    800dfa <memmove+0x41>
+  800df1:	83 ef 01             	sub    $0x1,%edi
+  800df4:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800df7:	fd                   	std
+  800df8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800dfa:	fc                   	cld
+  800dfb:	eb 1a                	jmp    800e17 <memmove+0x5e>
+  800dfd:	89 f2                	mov    %esi,%edx
+  800dff:	09 c2                	or     %eax,%edx
+  800e01:	09 ca                	or     %ecx,%edx
+  800e03:	f6 c2 03             	test   $0x3,%dl
+  800e06:	75 0a                	jne    800e12 <memmove+0x59>
+  800e08:	c1 e9 02             	shr    $0x2,%ecx
+  800e0b:	89 c7                	mov    %eax,%edi
+  800e0d:	fc                   	cld
+  800e0e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e10:	eb 05                	jmp    800e17 <memmove+0x5e>
+  800e12:	89 c7                	mov    %eax,%edi
+  800e14:	fc                   	cld
+  800e15:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800e17:	5e                   	pop    %esi
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+
+00800e1b <memcpy>:
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	ff 75 10             	push   0x10(%ebp)
+  800e24:	ff 75 0c             	push   0xc(%ebp)
+  800e27:	ff 75 08             	push   0x8(%ebp)
+  800e2a:	e8 8a ff ff ff       	call   800db9 <memmove>
+  800e2f:	c9                   	leave
+  800e30:	c3                   	ret
+
+00800e31 <memcmp>:
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  800e36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e3c:	8b 75 10             	mov    0x10(%ebp),%esi
+  800e3f:	85 f6                	test   %esi,%esi
+  800e41:	74 29                	je     800e6c <memcmp+0x3b>
+  800e43:	01 c6                	add    %eax,%esi
+  800e45:	0f b6 08             	movzbl (%eax),%ecx
+  800e48:	0f b6 1a             	movzbl (%edx),%ebx
+  800e4b:	38 d9                	cmp    %bl,%cl
+  800e4d:	75 11                	jne    800e60 <memcmp+0x2f>
+  800e4f:	83 c0 01             	add    $0x1,%eax
+  800e52:	83 c2 01             	add    $0x1,%edx
+  800e55:	39 c6                	cmp    %eax,%esi
+  800e57:	75 ec                	jne    800e45 <memcmp+0x14>
+  800e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5e:	eb 08                	jmp    800e68 <memcmp+0x37>
+  800e60:	0f b6 c1             	movzbl %cl,%eax
+  800e63:	0f b6 db             	movzbl %bl,%ebx
+  800e66:	29 d8                	sub    %ebx,%eax
+  800e68:	5b                   	pop    %ebx
+  800e69:	5e                   	pop    %esi
+  800e6a:	5d                   	pop    %ebp
+  800e6b:	c3                   	ret
+  800e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e71:	eb f5                	jmp    800e68 <memcmp+0x37>
+
+00800e73 <memfind>:
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	89 c2                	mov    %eax,%edx
+  800e7e:	03 55 10             	add    0x10(%ebp),%edx
+  800e81:	39 d0                	cmp    %edx,%eax
+  800e83:	73 0d                	jae    800e92 <memfind+0x1f>
+  800e85:	38 08                	cmp    %cl,(%eax)
+  800e87:	74 0d                	je     800e96 <memfind+0x23>
+  800e89:	83 c0 01             	add    $0x1,%eax
+  800e8c:	39 c2                	cmp    %eax,%edx
+  800e8e:	75 f5                	jne    800e85 <memfind+0x12>
+  800e90:	eb 06                	jmp    800e98 <memfind+0x25>
+  800e92:	89 c2                	mov    %eax,%edx
+  800e94:	eb 02                	jmp    800e98 <memfind+0x25>
+  800e96:	89 c2                	mov    %eax,%edx
+  800e98:	89 d0                	mov    %edx,%eax
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+
+00800e9c <strtol>:
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	57                   	push   %edi
+  800ea0:	56                   	push   %esi
+  800ea1:	53                   	push   %ebx
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea8:	0f b6 02             	movzbl (%edx),%eax
+  800eab:	3c 20                	cmp    $0x20,%al
+  800ead:	74 04                	je     800eb3 <strtol+0x17>
+  800eaf:	3c 09                	cmp    $0x9,%al
+  800eb1:	75 0e                	jne    800ec1 <strtol+0x25>
+  800eb3:	83 c2 01             	add    $0x1,%edx
+  800eb6:	0f b6 02             	movzbl (%edx),%eax
+  800eb9:	3c 20                	cmp    $0x20,%al
+  800ebb:	74 f6                	je     800eb3 <strtol+0x17>
+  800ebd:	3c 09                	cmp    $0x9,%al
+  800ebf:	74 f2                	je     800eb3 <strtol+0x17>
+  800ec1:	3c 2b                	cmp    $0x2b,%al
+  800ec3:	74 2a                	je     800eef <strtol+0x53>
+  800ec5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eca:	3c 2d                	cmp    $0x2d,%al
+  800ecc:	74 2b                	je     800ef9 <strtol+0x5d>
+  800ece:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ed4:	75 0f                	jne    800ee5 <strtol+0x49>
+  800ed6:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ed9:	74 28                	je     800f03 <strtol+0x67>
+  800edb:	85 db                	test   %ebx,%ebx
+  800edd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee2:	0f 44 d8             	cmove  %eax,%ebx
+  800ee5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eea:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800eed:	eb 46                	jmp    800f35 <strtol+0x99>
+  800eef:	83 c2 01             	add    $0x1,%edx
+  800ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef7:	eb d5                	jmp    800ece <strtol+0x32>
+  800ef9:	83 c2 01             	add    $0x1,%edx
+  800efc:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f01:	eb cb                	jmp    800ece <strtol+0x32>
+  800f03:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f07:	74 0e                	je     800f17 <strtol+0x7b>
+  800f09:	85 db                	test   %ebx,%ebx
+  800f0b:	75 d8                	jne    800ee5 <strtol+0x49>
+  800f0d:	83 c2 01             	add    $0x1,%edx
+  800f10:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f15:	eb ce                	jmp    800ee5 <strtol+0x49>
+  800f17:	83 c2 02             	add    $0x2,%edx
+  800f1a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f1f:	eb c4                	jmp    800ee5 <strtol+0x49>
+  800f21:	0f be c0             	movsbl %al,%eax
+  800f24:	83 e8 30             	sub    $0x30,%eax
+  800f27:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f2a:	7d 3a                	jge    800f66 <strtol+0xca>
+  800f2c:	83 c2 01             	add    $0x1,%edx
+  800f2f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f33:	01 c1                	add    %eax,%ecx
+  800f35:	0f b6 02             	movzbl (%edx),%eax
+  800f38:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f3b:	89 f3                	mov    %esi,%ebx
+  800f3d:	80 fb 09             	cmp    $0x9,%bl
+  800f40:	76 df                	jbe    800f21 <strtol+0x85>
+  800f42:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f45:	89 f3                	mov    %esi,%ebx
+  800f47:	80 fb 19             	cmp    $0x19,%bl
+  800f4a:	77 08                	ja     800f54 <strtol+0xb8>
+  800f4c:	0f be c0             	movsbl %al,%eax
+  800f4f:	83 e8 57             	sub    $0x57,%eax
+  800f52:	eb d3                	jmp    800f27 <strtol+0x8b>
+  800f54:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f57:	89 f3                	mov    %esi,%ebx
+  800f59:	80 fb 19             	cmp    $0x19,%bl
+  800f5c:	77 08                	ja     800f66 <strtol+0xca>
+  800f5e:	0f be c0             	movsbl %al,%eax
+  800f61:	83 e8 37             	sub    $0x37,%eax
+  800f64:	eb c1                	jmp    800f27 <strtol+0x8b>
+  800f66:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f6a:	74 05                	je     800f71 <strtol+0xd5>
+  800f6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f6f:	89 10                	mov    %edx,(%eax)
+  800f71:	89 c8                	mov    %ecx,%eax
+  800f73:	f7 d8                	neg    %eax
+  800f75:	85 ff                	test   %edi,%edi
+  800f77:	0f 45 c8             	cmovne %eax,%ecx
+  800f7a:	89 c8                	mov    %ecx,%eax
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+
+00800f81 <sys_cputs>:
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	56                   	push   %esi
+  800f86:	53                   	push   %ebx
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f92:	89 c3                	mov    %eax,%ebx
+  800f94:	89 c7                	mov    %eax,%edi
+  800f96:	89 c6                	mov    %eax,%esi
+  800f98:	cd 30                	int    $0x30
+  800f9a:	5b                   	pop    %ebx
+  800f9b:	5e                   	pop    %esi
+  800f9c:	5f                   	pop    %edi
+  800f9d:	5d                   	pop    %ebp
+  800f9e:	c3                   	ret
+
+00800f9f <sys_cgetc>:
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  800fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800faa:	b8 01 00 00 00       	mov    $0x1,%eax
+  800faf:	89 d1                	mov    %edx,%ecx
+  800fb1:	89 d3                	mov    %edx,%ebx
+  800fb3:	89 d7                	mov    %edx,%edi
+  800fb5:	89 d6                	mov    %edx,%esi
+  800fb7:	cd 30                	int    $0x30
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+
+00800fbe <sys_env_destroy>:
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fd4:	89 cb                	mov    %ecx,%ebx
+  800fd6:	89 cf                	mov    %ecx,%edi
+  800fd8:	89 ce                	mov    %ecx,%esi
+  800fda:	cd 30                	int    $0x30
+  800fdc:	85 c0                	test   %eax,%eax
+  800fde:	7f 08                	jg     800fe8 <sys_env_destroy+0x2a>
+  800fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe3:	5b                   	pop    %ebx
+  800fe4:	5e                   	pop    %esi
+  800fe5:	5f                   	pop    %edi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	c3                   	ret
+  800fe8:	83 ec 0c             	sub    $0xc,%esp
+  800feb:	50                   	push   %eax
+  800fec:	6a 03                	push   $0x3
+  800fee:	68 eb 46 80 00       	push   $0x8046eb
+  800ff3:	6a 24                	push   $0x24
+  800ff5:	68 08 47 80 00       	push   $0x804708
+  800ffa:	e8 38 f4 ff ff       	call   800437 <_panic>
+
+00800fff <sys_getenvid>:
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+  801005:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80100f:	89 d1                	mov    %edx,%ecx
+  801011:	89 d3                	mov    %edx,%ebx
+  801013:	89 d7                	mov    %edx,%edi
+  801015:	89 d6                	mov    %edx,%esi
+  801017:	cd 30                	int    $0x30
+  801019:	5b                   	pop    %ebx
+  80101a:	5e                   	pop    %esi
+  80101b:	5f                   	pop    %edi
+  80101c:	5d                   	pop    %ebp
+  80101d:	c3                   	ret
+
+0080101e <sys_yield>:
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	57                   	push   %edi
+  801022:	56                   	push   %esi
+  801023:	53                   	push   %ebx
+  801024:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80102b:	74 26                	je     801053 <sys_yield+0x35>
+  80102d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801032:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801037:	89 d1                	mov    %edx,%ecx
+  801039:	89 d3                	mov    %edx,%ebx
+  80103b:	89 d7                	mov    %edx,%edi
+  80103d:	6a 00                	push   $0x0
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	8d 35 4a 10 80 00    	lea    0x80104a,%esi
+  801048:	0f 34                	sysenter
+  80104a:	5d                   	pop    %ebp
+  80104b:	83 c4 04             	add    $0x4,%esp
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+  801053:	ba 00 00 00 00       	mov    $0x0,%edx
+  801058:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80105d:	89 d1                	mov    %edx,%ecx
+  80105f:	89 d3                	mov    %edx,%ebx
+  801061:	89 d7                	mov    %edx,%edi
+  801063:	89 d6                	mov    %edx,%esi
+  801065:	cd 30                	int    $0x30
+  801067:	eb e5                	jmp    80104e <sys_yield+0x30>
+
+00801069 <sys_page_alloc>:
+  801069:	55                   	push   %ebp
+  80106a:	89 e5                	mov    %esp,%ebp
+  80106c:	57                   	push   %edi
+  80106d:	56                   	push   %esi
+  80106e:	53                   	push   %ebx
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	be 00 00 00 00       	mov    $0x0,%esi
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801082:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801085:	89 f7                	mov    %esi,%edi
+  801087:	cd 30                	int    $0x30
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	7f 08                	jg     801095 <sys_page_alloc+0x2c>
+  80108d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+  801095:	83 ec 0c             	sub    $0xc,%esp
+  801098:	50                   	push   %eax
+  801099:	6a 04                	push   $0x4
+  80109b:	68 eb 46 80 00       	push   $0x8046eb
+  8010a0:	6a 24                	push   $0x24
+  8010a2:	68 08 47 80 00       	push   $0x804708
+  8010a7:	e8 8b f3 ff ff       	call   800437 <_panic>
+
+008010ac <sys_page_map>:
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	56                   	push   %esi
+  8010b1:	53                   	push   %ebx
+  8010b2:	83 ec 0c             	sub    $0xc,%esp
+  8010b5:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010bc:	74 33                	je     8010f1 <sys_page_map+0x45>
+  8010be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010cc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cf:	ff 75 18             	push   0x18(%ebp)
+  8010d2:	55                   	push   %ebp
+  8010d3:	89 e5                	mov    %esp,%ebp
+  8010d5:	8d 35 dd 10 80 00    	lea    0x8010dd,%esi
+  8010db:	0f 34                	sysenter
+  8010dd:	5d                   	pop    %ebp
+  8010de:	83 c4 04             	add    $0x4,%esp
+  8010e1:	89 c2                	mov    %eax,%edx
+  8010e3:	85 c0                	test   %eax,%eax
+  8010e5:	7f 3d                	jg     801124 <sys_page_map+0x78>
+  8010e7:	89 d0                	mov    %edx,%eax
+  8010e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ec:	5b                   	pop    %ebx
+  8010ed:	5e                   	pop    %esi
+  8010ee:	5f                   	pop    %edi
+  8010ef:	5d                   	pop    %ebp
+  8010f0:	c3                   	ret
+  8010f1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801102:	8b 75 18             	mov    0x18(%ebp),%esi
+  801105:	cd 30                	int    $0x30
+  801107:	89 c2                	mov    %eax,%edx
+  801109:	85 c0                	test   %eax,%eax
+  80110b:	7e da                	jle    8010e7 <sys_page_map+0x3b>
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+  801110:	50                   	push   %eax
+  801111:	6a 05                	push   $0x5
+  801113:	68 eb 46 80 00       	push   $0x8046eb
+  801118:	6a 24                	push   $0x24
+  80111a:	68 08 47 80 00       	push   $0x804708
+  80111f:	e8 13 f3 ff ff       	call   800437 <_panic>
+  801124:	83 ec 0c             	sub    $0xc,%esp
+  801127:	50                   	push   %eax
+  801128:	6a 05                	push   $0x5
+  80112a:	68 eb 46 80 00       	push   $0x8046eb
+  80112f:	6a 48                	push   $0x48
+  801131:	68 08 47 80 00       	push   $0x804708
+  801136:	e8 fc f2 ff ff       	call   800437 <_panic>
+
+0080113b <sys_page_unmap>:
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+  801141:	83 ec 0c             	sub    $0xc,%esp
+  801144:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801154:	89 df                	mov    %ebx,%edi
+  801156:	89 de                	mov    %ebx,%esi
+  801158:	cd 30                	int    $0x30
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	7f 08                	jg     801166 <sys_page_unmap+0x2b>
+  80115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  801169:	50                   	push   %eax
+  80116a:	6a 06                	push   $0x6
+  80116c:	68 eb 46 80 00       	push   $0x8046eb
+  801171:	6a 24                	push   $0x24
+  801173:	68 08 47 80 00       	push   $0x804708
+  801178:	e8 ba f2 ff ff       	call   800437 <_panic>
+
+0080117d <sys_fork>:
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	ba 00 00 00 00       	mov    $0x0,%edx
+  801188:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80118d:	89 d1                	mov    %edx,%ecx
+  80118f:	89 d3                	mov    %edx,%ebx
+  801191:	89 d7                	mov    %edx,%edi
+  801193:	89 d6                	mov    %edx,%esi
+  801195:	cd 30                	int    $0x30
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+
+0080119c <sys_env_set_status>:
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	57                   	push   %edi
+  8011a0:	56                   	push   %esi
+  8011a1:	53                   	push   %ebx
+  8011a2:	83 ec 0c             	sub    $0xc,%esp
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011b5:	89 df                	mov    %ebx,%edi
+  8011b7:	89 de                	mov    %ebx,%esi
+  8011b9:	cd 30                	int    $0x30
+  8011bb:	85 c0                	test   %eax,%eax
+  8011bd:	7f 08                	jg     8011c7 <sys_env_set_status+0x2b>
+  8011bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c2:	5b                   	pop    %ebx
+  8011c3:	5e                   	pop    %esi
+  8011c4:	5f                   	pop    %edi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	c3                   	ret
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  8011ca:	50                   	push   %eax
+  8011cb:	6a 08                	push   $0x8
+  8011cd:	68 eb 46 80 00       	push   $0x8046eb
+  8011d2:	6a 24                	push   $0x24
+  8011d4:	68 08 47 80 00       	push   $0x804708
+  8011d9:	e8 59 f2 ff ff       	call   800437 <_panic>
+
+008011de <sys_env_set_trapframe>:
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+  8011e4:	83 ec 0c             	sub    $0xc,%esp
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011f7:	89 df                	mov    %ebx,%edi
+  8011f9:	89 de                	mov    %ebx,%esi
+  8011fb:	cd 30                	int    $0x30
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	7f 08                	jg     801209 <sys_env_set_trapframe+0x2b>
+  801201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801204:	5b                   	pop    %ebx
+  801205:	5e                   	pop    %esi
+  801206:	5f                   	pop    %edi
+  801207:	5d                   	pop    %ebp
+  801208:	c3                   	ret
+  801209:	83 ec 0c             	sub    $0xc,%esp
+  80120c:	50                   	push   %eax
+  80120d:	6a 09                	push   $0x9
+  80120f:	68 eb 46 80 00       	push   $0x8046eb
+  801214:	6a 24                	push   $0x24
+  801216:	68 08 47 80 00       	push   $0x804708
+  80121b:	e8 17 f2 ff ff       	call   800437 <_panic>
+
+00801220 <sys_env_set_cow>:
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	57                   	push   %edi
+  801224:	56                   	push   %esi
+  801225:	53                   	push   %ebx
+  801226:	83 ec 0c             	sub    $0xc,%esp
+  801229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801231:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801234:	b8 20 00 00 00       	mov    $0x20,%eax
+  801239:	89 df                	mov    %ebx,%edi
+  80123b:	89 de                	mov    %ebx,%esi
+  80123d:	cd 30                	int    $0x30
+  80123f:	85 c0                	test   %eax,%eax
+  801241:	7f 08                	jg     80124b <sys_env_set_cow+0x2b>
+  801243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+  80124b:	83 ec 0c             	sub    $0xc,%esp
+  80124e:	50                   	push   %eax
+  80124f:	6a 20                	push   $0x20
+  801251:	68 eb 46 80 00       	push   $0x8046eb
+  801256:	6a 24                	push   $0x24
+  801258:	68 08 47 80 00       	push   $0x804708
+  80125d:	e8 d5 f1 ff ff       	call   800437 <_panic>
+
+00801262 <sys_env_service>:
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	57                   	push   %edi
+  801266:	56                   	push   %esi
+  801267:	53                   	push   %ebx
+  801268:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	b8 21 00 00 00       	mov    $0x21,%eax
+  801275:	89 cb                	mov    %ecx,%ebx
+  801277:	89 cf                	mov    %ecx,%edi
+  801279:	89 ce                	mov    %ecx,%esi
+  80127b:	cd 30                	int    $0x30
+  80127d:	5b                   	pop    %ebx
+  80127e:	5e                   	pop    %esi
+  80127f:	5f                   	pop    %edi
+  801280:	5d                   	pop    %ebp
+  801281:	c3                   	ret
+
+00801282 <sys_env_set_pgfault_upcall>:
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	83 ec 0c             	sub    $0xc,%esp
+  80128b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801290:	8b 55 08             	mov    0x8(%ebp),%edx
+  801293:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801296:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80129b:	89 df                	mov    %ebx,%edi
+  80129d:	89 de                	mov    %ebx,%esi
+  80129f:	cd 30                	int    $0x30
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	7f 08                	jg     8012ad <sys_env_set_pgfault_upcall+0x2b>
+  8012a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a8:	5b                   	pop    %ebx
+  8012a9:	5e                   	pop    %esi
+  8012aa:	5f                   	pop    %edi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+  8012ad:	83 ec 0c             	sub    $0xc,%esp
+  8012b0:	50                   	push   %eax
+  8012b1:	6a 0a                	push   $0xa
+  8012b3:	68 eb 46 80 00       	push   $0x8046eb
+  8012b8:	6a 24                	push   $0x24
+  8012ba:	68 08 47 80 00       	push   $0x804708
+  8012bf:	e8 73 f1 ff ff       	call   800437 <_panic>
+
+008012c4 <sys_ipc_try_send>:
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	57                   	push   %edi
+  8012c8:	56                   	push   %esi
+  8012c9:	53                   	push   %ebx
+  8012ca:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012d1:	74 27                	je     8012fa <sys_ipc_try_send+0x36>
+  8012d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012e4:	6a 00                	push   $0x0
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+  8012e9:	8d 35 f1 12 80 00    	lea    0x8012f1,%esi
+  8012ef:	0f 34                	sysenter
+  8012f1:	5d                   	pop    %ebp
+  8012f2:	83 c4 04             	add    $0x4,%esp
+  8012f5:	5b                   	pop    %ebx
+  8012f6:	5e                   	pop    %esi
+  8012f7:	5f                   	pop    %edi
+  8012f8:	5d                   	pop    %ebp
+  8012f9:	c3                   	ret
+  8012fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801304:	8b 55 08             	mov    0x8(%ebp),%edx
+  801307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801310:	cd 30                	int    $0x30
+  801312:	eb e1                	jmp    8012f5 <sys_ipc_try_send+0x31>
+
+00801314 <sys_ipc_recv>:
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	57                   	push   %edi
+  801318:	56                   	push   %esi
+  801319:	53                   	push   %ebx
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+  80131d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801324:	74 32                	je     801358 <sys_ipc_recv+0x44>
+  801326:	8b 55 08             	mov    0x8(%ebp),%edx
+  801329:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801333:	89 cb                	mov    %ecx,%ebx
+  801335:	89 cf                	mov    %ecx,%edi
+  801337:	6a 00                	push   $0x0
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	8d 35 44 13 80 00    	lea    0x801344,%esi
+  801342:	0f 34                	sysenter
+  801344:	5d                   	pop    %ebp
+  801345:	83 c4 04             	add    $0x4,%esp
+  801348:	89 c2                	mov    %eax,%edx
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	7f 3c                	jg     80138a <sys_ipc_recv+0x76>
+  80134e:	89 d0                	mov    %edx,%eax
+  801350:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801353:	5b                   	pop    %ebx
+  801354:	5e                   	pop    %esi
+  801355:	5f                   	pop    %edi
+  801356:	5d                   	pop    %ebp
+  801357:	c3                   	ret
+  801358:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801362:	8b 55 08             	mov    0x8(%ebp),%edx
+  801365:	89 cb                	mov    %ecx,%ebx
+  801367:	89 cf                	mov    %ecx,%edi
+  801369:	89 ce                	mov    %ecx,%esi
+  80136b:	cd 30                	int    $0x30
+  80136d:	89 c2                	mov    %eax,%edx
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	7e db                	jle    80134e <sys_ipc_recv+0x3a>
+  801373:	83 ec 0c             	sub    $0xc,%esp
+  801376:	50                   	push   %eax
+  801377:	6a 0d                	push   $0xd
+  801379:	68 eb 46 80 00       	push   $0x8046eb
+  80137e:	6a 24                	push   $0x24
+  801380:	68 08 47 80 00       	push   $0x804708
+  801385:	e8 ad f0 ff ff       	call   800437 <_panic>
+  80138a:	83 ec 0c             	sub    $0xc,%esp
+  80138d:	50                   	push   %eax
+  80138e:	6a 0d                	push   $0xd
+  801390:	68 eb 46 80 00       	push   $0x8046eb
+  801395:	6a 48                	push   $0x48
+  801397:	68 08 47 80 00       	push   $0x804708
+  80139c:	e8 96 f0 ff ff       	call   800437 <_panic>
+
+008013a1 <sys_ipc_send>:
+  8013a1:	55                   	push   %ebp
+  8013a2:	89 e5                	mov    %esp,%ebp
+  8013a4:	57                   	push   %edi
+  8013a5:	56                   	push   %esi
+  8013a6:	53                   	push   %ebx
+  8013a7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8013ae:	74 27                	je     8013d7 <sys_ipc_send+0x36>
+  8013b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013be:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c1:	6a 00                	push   $0x0
+  8013c3:	55                   	push   %ebp
+  8013c4:	89 e5                	mov    %esp,%ebp
+  8013c6:	8d 35 ce 13 80 00    	lea    0x8013ce,%esi
+  8013cc:	0f 34                	sysenter
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	83 c4 04             	add    $0x4,%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+  8013d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013ed:	cd 30                	int    $0x30
+  8013ef:	eb e1                	jmp    8013d2 <sys_ipc_send+0x31>
+
+008013f1 <sys_ipc_call>:
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	57                   	push   %edi
+  8013f5:	56                   	push   %esi
+  8013f6:	53                   	push   %ebx
+  8013f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801402:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801405:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801408:	8b 75 18             	mov    0x18(%ebp),%esi
+  80140b:	cd 30                	int    $0x30
+  80140d:	5b                   	pop    %ebx
+  80140e:	5e                   	pop    %esi
+  80140f:	5f                   	pop    %edi
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+
+00801412 <sys_ipc_reply_recv>:
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	57                   	push   %edi
+  801416:	56                   	push   %esi
+  801417:	53                   	push   %ebx
+  801418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801423:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801426:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801429:	8b 75 18             	mov    0x18(%ebp),%esi
+  80142c:	cd 30                	int    $0x30
+  80142e:	5b                   	pop    %ebx
+  80142f:	5e                   	pop    %esi
+  801430:	5f                   	pop    %edi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+
+00801433 <sys_time_msec>:
+  801433:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	75 06                	jne    801442 <sys_time_msec+0xf>
+  80143c:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801441:	c3                   	ret
+  801442:	55                   	push   %ebp
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	57                   	push   %edi
+  801446:	56                   	push   %esi
+  801447:	53                   	push   %ebx
+  801448:	83 ec 0c             	sub    $0xc,%esp
+  80144b:	0f 31                	rdtsc
+  80144d:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801453:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801459:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80145f:	29 c8                	sub    %ecx,%eax
+  801461:	19 da                	sbb    %ebx,%edx
+  801463:	bf 00 00 00 00       	mov    $0x0,%edi
+  801468:	57                   	push   %edi
+  801469:	56                   	push   %esi
+  80146a:	52                   	push   %edx
+  80146b:	50                   	push   %eax
+  80146c:	e8 cd 2c 00 00       	call   80413e <__udivdi3>
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801477:	5b                   	pop    %ebx
+  801478:	5e                   	pop    %esi
+  801479:	5f                   	pop    %edi
+  80147a:	5d                   	pop    %ebp
+  80147b:	c3                   	ret
+
+0080147c <sys_env_swap>:
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	57                   	push   %edi
+  801480:	56                   	push   %esi
+  801481:	53                   	push   %ebx
+  801482:	83 ec 0c             	sub    $0xc,%esp
+  801485:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801492:	89 cb                	mov    %ecx,%ebx
+  801494:	89 cf                	mov    %ecx,%edi
+  801496:	89 ce                	mov    %ecx,%esi
+  801498:	cd 30                	int    $0x30
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	7f 08                	jg     8014a6 <sys_env_swap+0x2a>
+  80149e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a1:	5b                   	pop    %ebx
+  8014a2:	5e                   	pop    %esi
+  8014a3:	5f                   	pop    %edi
+  8014a4:	5d                   	pop    %ebp
+  8014a5:	c3                   	ret
+  8014a6:	83 ec 0c             	sub    $0xc,%esp
+  8014a9:	50                   	push   %eax
+  8014aa:	6a 12                	push   $0x12
+  8014ac:	68 eb 46 80 00       	push   $0x8046eb
+  8014b1:	6a 24                	push   $0x24
+  8014b3:	68 08 47 80 00       	push   $0x804708
+  8014b8:	e8 7a ef ff ff       	call   800437 <_panic>
+
+008014bd <sys_net_try_send>:
+  8014bd:	55                   	push   %ebp
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	57                   	push   %edi
+  8014c1:	56                   	push   %esi
+  8014c2:	53                   	push   %ebx
+  8014c3:	83 ec 0c             	sub    $0xc,%esp
+  8014c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014d6:	89 df                	mov    %ebx,%edi
+  8014d8:	89 de                	mov    %ebx,%esi
+  8014da:	cd 30                	int    $0x30
+  8014dc:	85 c0                	test   %eax,%eax
+  8014de:	7f 08                	jg     8014e8 <sys_net_try_send+0x2b>
+  8014e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e3:	5b                   	pop    %ebx
+  8014e4:	5e                   	pop    %esi
+  8014e5:	5f                   	pop    %edi
+  8014e6:	5d                   	pop    %ebp
+  8014e7:	c3                   	ret
+  8014e8:	83 ec 0c             	sub    $0xc,%esp
+  8014eb:	50                   	push   %eax
+  8014ec:	6a 13                	push   $0x13
+  8014ee:	68 eb 46 80 00       	push   $0x8046eb
+  8014f3:	6a 24                	push   $0x24
+  8014f5:	68 08 47 80 00       	push   $0x804708
+  8014fa:	e8 38 ef ff ff       	call   800437 <_panic>
+
+008014ff <sys_net_try_receive>:
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	57                   	push   %edi
+  801503:	56                   	push   %esi
+  801504:	53                   	push   %ebx
+  801505:	83 ec 0c             	sub    $0xc,%esp
+  801508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801510:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801513:	b8 14 00 00 00       	mov    $0x14,%eax
+  801518:	89 df                	mov    %ebx,%edi
+  80151a:	89 de                	mov    %ebx,%esi
+  80151c:	cd 30                	int    $0x30
+  80151e:	85 c0                	test   %eax,%eax
+  801520:	7f 08                	jg     80152a <sys_net_try_receive+0x2b>
+  801522:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801525:	5b                   	pop    %ebx
+  801526:	5e                   	pop    %esi
+  801527:	5f                   	pop    %edi
+  801528:	5d                   	pop    %ebp
+  801529:	c3                   	ret
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	50                   	push   %eax
+  80152e:	6a 14                	push   $0x14
+  801530:	68 eb 46 80 00       	push   $0x8046eb
+  801535:	6a 24                	push   $0x24
+  801537:	68 08 47 80 00       	push   $0x804708
+  80153c:	e8 f6 ee ff ff       	call   800437 <_panic>
+
+00801541 <sys_net_recv_page>:
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+  801547:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80154c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154f:	b8 27 00 00 00       	mov    $0x27,%eax
+  801554:	89 cb                	mov    %ecx,%ebx
+  801556:	89 cf                	mov    %ecx,%edi
+  801558:	89 ce                	mov    %ecx,%esi
+  80155a:	cd 30                	int    $0x30
+  80155c:	5b                   	pop    %ebx
+  80155d:	5e                   	pop    %esi
+  80155e:	5f                   	pop    %edi
+  80155f:	5d                   	pop    %ebp
+  801560:	c3                   	ret
+
+00801561 <sys_net_wait>:
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	57                   	push   %edi
+  801565:	56                   	push   %esi
+  801566:	53                   	push   %ebx
+  801567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156c:	b8 26 00 00 00       	mov    $0x26,%eax
+  801571:	89 d1                	mov    %edx,%ecx
+  801573:	89 d3                	mov    %edx,%ebx
+  801575:	89 d7                	mov    %edx,%edi
+  801577:	89 d6                	mov    %edx,%esi
+  801579:	cd 30                	int    $0x30
+  80157b:	5b                   	pop    %ebx
+  80157c:	5e                   	pop    %esi
+  80157d:	5f                   	pop    %edi
+  80157e:	5d                   	pop    %ebp
+  80157f:	c3                   	ret
+
+00801580 <sys_get_mac>:
+  801580:	55                   	push   %ebp
+  801581:	89 e5                	mov    %esp,%ebp
+  801583:	57                   	push   %edi
+  801584:	56                   	push   %esi
+  801585:	53                   	push   %ebx
+  801586:	83 ec 0c             	sub    $0xc,%esp
+  801589:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801591:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801594:	b8 15 00 00 00       	mov    $0x15,%eax
+  801599:	89 df                	mov    %ebx,%edi
+  80159b:	89 de                	mov    %ebx,%esi
+  80159d:	cd 30                	int    $0x30
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	7f 08                	jg     8015ab <sys_get_mac+0x2b>
+  8015a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a6:	5b                   	pop    %ebx
+  8015a7:	5e                   	pop    %esi
+  8015a8:	5f                   	pop    %edi
+  8015a9:	5d                   	pop    %ebp
+  8015aa:	c3                   	ret
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+  8015ae:	50                   	push   %eax
+  8015af:	6a 15                	push   $0x15
+  8015b1:	68 eb 46 80 00       	push   $0x8046eb
+  8015b6:	6a 24                	push   $0x24
+  8015b8:	68 08 47 80 00       	push   $0x804708
+  8015bd:	e8 75 ee ff ff       	call   800437 <_panic>
+
+008015c2 <sys_env_lease>:
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	57                   	push   %edi
+  8015c6:	56                   	push   %esi
+  8015c7:	53                   	push   %ebx
+  8015c8:	83 ec 0c             	sub    $0xc,%esp
+  8015cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8015db:	89 df                	mov    %ebx,%edi
+  8015dd:	89 de                	mov    %ebx,%esi
+  8015df:	cd 30                	int    $0x30
+  8015e1:	85 c0                	test   %eax,%eax
+  8015e3:	7f 08                	jg     8015ed <sys_env_lease+0x2b>
+  8015e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e8:	5b                   	pop    %ebx
+  8015e9:	5e                   	pop    %esi
+  8015ea:	5f                   	pop    %edi
+  8015eb:	5d                   	pop    %ebp
+  8015ec:	c3                   	ret
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+  8015f0:	50                   	push   %eax
+  8015f1:	6a 16                	push   $0x16
+  8015f3:	68 eb 46 80 00       	push   $0x8046eb
+  8015f8:	6a 24                	push   $0x24
+  8015fa:	68 08 47 80 00       	push   $0x804708
+  8015ff:	e8 33 ee ff ff       	call   800437 <_panic>
+
+00801604 <sys_copy_mem>:
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+  801607:	57                   	push   %edi
+  801608:	56                   	push   %esi
+  801609:	53                   	push   %ebx
+  80160a:	83 ec 0c             	sub    $0xc,%esp
+  80160d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801610:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801613:	b8 17 00 00 00       	mov    $0x17,%eax
+  801618:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80161b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80161e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801621:	cd 30                	int    $0x30
+  801623:	85 c0                	test   %eax,%eax
+  801625:	7f 08                	jg     80162f <sys_copy_mem+0x2b>
+  801627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162a:	5b                   	pop    %ebx
+  80162b:	5e                   	pop    %esi
+  80162c:	5f                   	pop    %edi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+  80162f:	83 ec 0c             	sub    $0xc,%esp
+  801632:	50                   	push   %eax
+  801633:	6a 17                	push   $0x17
+  801635:	68 eb 46 80 00       	push   $0x8046eb
+  80163a:	6a 24                	push   $0x24
+  80163c:	68 08 47 80 00       	push   $0x804708
+  801641:	e8 f1 ed ff ff       	call   800437 <_panic>
+
+00801646 <sys_get_perms>:
+  801646:	55                   	push   %ebp
+  801647:	89 e5                	mov    %esp,%ebp
+  801649:	57                   	push   %edi
+  80164a:	56                   	push   %esi
+  80164b:	53                   	push   %ebx
+  80164c:	83 ec 0c             	sub    $0xc,%esp
+  80164f:	be 00 00 00 00       	mov    $0x0,%esi
+  801654:	8b 55 08             	mov    0x8(%ebp),%edx
+  801657:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80165f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801662:	89 f7                	mov    %esi,%edi
+  801664:	cd 30                	int    $0x30
+  801666:	85 c0                	test   %eax,%eax
+  801668:	7f 08                	jg     801672 <sys_get_perms+0x2c>
+  80166a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166d:	5b                   	pop    %ebx
+  80166e:	5e                   	pop    %esi
+  80166f:	5f                   	pop    %edi
+  801670:	5d                   	pop    %ebp
+  801671:	c3                   	ret
+  801672:	83 ec 0c             	sub    $0xc,%esp
+  801675:	50                   	push   %eax
+  801676:	6a 18                	push   $0x18
+  801678:	68 eb 46 80 00       	push   $0x8046eb
+  80167d:	6a 24                	push   $0x24
+  80167f:	68 08 47 80 00       	push   $0x804708
+  801684:	e8 ae ed ff ff       	call   800437 <_panic>
+
+00801689 <sys_env_unsuspend>:
+  801689:	55                   	push   %ebp
+  80168a:	89 e5                	mov    %esp,%ebp
+  80168c:	57                   	push   %edi
+  80168d:	56                   	push   %esi
+  80168e:	53                   	push   %ebx
+  80168f:	83 ec 0c             	sub    $0xc,%esp
+  801692:	be 00 00 00 00       	mov    $0x0,%esi
+  801697:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169d:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a5:	89 f7                	mov    %esi,%edi
+  8016a7:	cd 30                	int    $0x30
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	7f 08                	jg     8016b5 <sys_env_unsuspend+0x2c>
+  8016ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b0:	5b                   	pop    %ebx
+  8016b1:	5e                   	pop    %esi
+  8016b2:	5f                   	pop    %edi
+  8016b3:	5d                   	pop    %ebp
+  8016b4:	c3                   	ret
+  8016b5:	83 ec 0c             	sub    $0xc,%esp
+  8016b8:	50                   	push   %eax
+  8016b9:	6a 19                	push   $0x19
+  8016bb:	68 eb 46 80 00       	push   $0x8046eb
+  8016c0:	6a 24                	push   $0x24
+  8016c2:	68 08 47 80 00       	push   $0x804708
+  8016c7:	e8 6b ed ff ff       	call   800437 <_panic>
+
+008016cc <sys_migrate>:
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	57                   	push   %edi
+  8016d0:	56                   	push   %esi
+  8016d1:	53                   	push   %ebx
+  8016d2:	83 ec 0c             	sub    $0xc,%esp
+  8016d5:	ba 04 b0 80 00       	mov    $0x80b004,%edx
+  8016da:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8016e0:	76 11                	jbe    8016f3 <sys_migrate+0x27>
+  8016e2:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8016e7:	0f b6 08             	movzbl (%eax),%ecx
+  8016ea:	05 00 10 00 00       	add    $0x1000,%eax
+  8016ef:	39 d0                	cmp    %edx,%eax
+  8016f1:	72 f4                	jb     8016e7 <sys_migrate+0x1b>
+  8016f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801700:	89 cb                	mov    %ecx,%ebx
+  801702:	89 cf                	mov    %ecx,%edi
+  801704:	89 ce                	mov    %ecx,%esi
+  801706:	cd 30                	int    $0x30
+  801708:	85 c0                	test   %eax,%eax
+  80170a:	7f 08                	jg     801714 <sys_migrate+0x48>
+  80170c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170f:	5b                   	pop    %ebx
+  801710:	5e                   	pop    %esi
+  801711:	5f                   	pop    %edi
+  801712:	5d                   	pop    %ebp
+  801713:	c3                   	ret
+  801714:	83 ec 0c             	sub    $0xc,%esp
+  801717:	50                   	push   %eax
+  801718:	6a 1a                	push   $0x1a
+  80171a:	68 eb 46 80 00       	push   $0x8046eb
+  80171f:	6a 24                	push   $0x24
+  801721:	68 08 47 80 00       	push   $0x804708
+  801726:	e8 0c ed ff ff       	call   800437 <_panic>
+
+0080172b <sys_lease_complete>:
+  80172b:	55                   	push   %ebp
+  80172c:	89 e5                	mov    %esp,%ebp
+  80172e:	57                   	push   %edi
+  80172f:	56                   	push   %esi
+  801730:	53                   	push   %ebx
+  801731:	83 ec 0c             	sub    $0xc,%esp
+  801734:	ba 00 00 00 00       	mov    $0x0,%edx
+  801739:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80173e:	89 d1                	mov    %edx,%ecx
+  801740:	89 d3                	mov    %edx,%ebx
+  801742:	89 d7                	mov    %edx,%edi
+  801744:	89 d6                	mov    %edx,%esi
+  801746:	cd 30                	int    $0x30
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	7f 08                	jg     801754 <sys_lease_complete+0x29>
+  80174c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174f:	5b                   	pop    %ebx
+  801750:	5e                   	pop    %esi
+  801751:	5f                   	pop    %edi
+  801752:	5d                   	pop    %ebp
+  801753:	c3                   	ret
+  801754:	83 ec 0c             	sub    $0xc,%esp
+  801757:	50                   	push   %eax
+  801758:	6a 1b                	push   $0x1b
+  80175a:	68 eb 46 80 00       	push   $0x8046eb
+  80175f:	6a 24                	push   $0x24
+  801761:	68 08 47 80 00       	push   $0x804708
+  801766:	e8 cc ec ff ff       	call   800437 <_panic>
+
+0080176b <sys_env_set_thisenv>:
+  80176b:	55                   	push   %ebp
+  80176c:	89 e5                	mov    %esp,%ebp
+  80176e:	57                   	push   %edi
+  80176f:	56                   	push   %esi
+  801770:	53                   	push   %ebx
+  801771:	83 ec 0c             	sub    $0xc,%esp
+  801774:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801779:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801784:	89 df                	mov    %ebx,%edi
+  801786:	89 de                	mov    %ebx,%esi
+  801788:	cd 30                	int    $0x30
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	7f 08                	jg     801796 <sys_env_set_thisenv+0x2b>
+  80178e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801791:	5b                   	pop    %ebx
+  801792:	5e                   	pop    %esi
+  801793:	5f                   	pop    %edi
+  801794:	5d                   	pop    %ebp
+  801795:	c3                   	ret
+  801796:	83 ec 0c             	sub    $0xc,%esp
+  801799:	50                   	push   %eax
+  80179a:	6a 1c                	push   $0x1c
+  80179c:	68 eb 46 80 00       	push   $0x8046eb
+  8017a1:	6a 24                	push   $0x24
+  8017a3:	68 08 47 80 00       	push   $0x804708
+  8017a8:	e8 8a ec ff ff       	call   800437 <_panic>
+
+008017ad <sys_env_set_sched>:
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	57                   	push   %edi
+  8017b1:	56                   	push   %esi
+  8017b2:	53                   	push   %ebx
+  8017b3:	83 ec 0c             	sub    $0xc,%esp
+  8017b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8017c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017c9:	89 f7                	mov    %esi,%edi
+  8017cb:	cd 30                	int    $0x30
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	7f 08                	jg     8017d9 <sys_env_set_sched+0x2c>
+  8017d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d4:	5b                   	pop    %ebx
+  8017d5:	5e                   	pop    %esi
+  8017d6:	5f                   	pop    %edi
+  8017d7:	5d                   	pop    %ebp
+  8017d8:	c3                   	ret
+  8017d9:	83 ec 0c             	sub    $0xc,%esp
+  8017dc:	50                   	push   %eax
+  8017dd:	6a 1d                	push   $0x1d
+  8017df:	68 eb 46 80 00       	push   $0x8046eb
+  8017e4:	6a 24                	push   $0x24
+  8017e6:	68 08 47 80 00       	push   $0x804708
+  8017eb:	e8 47 ec ff ff       	call   800437 <_panic>
+
+008017f0 <sys_batch>:
+  8017f0:	55                   	push   %ebp
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	57                   	push   %edi
+  8017f4:	56                   	push   %esi
+  8017f5:	53                   	push   %ebx
+  8017f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801801:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801806:	89 df                	mov    %ebx,%edi
+  801808:	89 de                	mov    %ebx,%esi
+  80180a:	cd 30                	int    $0x30
+  80180c:	5b                   	pop    %ebx
+  80180d:	5e                   	pop    %esi
+  80180e:	5f                   	pop    %edi
+  80180f:	5d                   	pop    %ebp
+  801810:	c3                   	ret
+
+00801811 <sys_env_stats>:
+  801811:	55                   	push   %ebp
+  801812:	89 e5                	mov    %esp,%ebp
+  801814:	57                   	push   %edi
+  801815:	56                   	push   %esi
+  801816:	53                   	push   %ebx
+  801817:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801822:	b8 23 00 00 00       	mov    $0x23,%eax
+  801827:	89 df                	mov    %ebx,%edi
+  801829:	89 de                	mov    %ebx,%esi
+  80182b:	cd 30                	int    $0x30
+  80182d:	5b                   	pop    %ebx
+  80182e:	5e                   	pop    %esi
+  80182f:	5f                   	pop    %edi
+  801830:	5d                   	pop    %ebp
+  801831:	c3                   	ret
+
+00801832 <sys_trace>:
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	57                   	push   %edi
+  801836:	56                   	push   %esi
+  801837:	53                   	push   %ebx
+  801838:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80183d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801840:	b8 24 00 00 00       	mov    $0x24,%eax
+  801845:	89 cb                	mov    %ecx,%ebx
+  801847:	89 cf                	mov    %ecx,%edi
+  801849:	89 ce                	mov    %ecx,%esi
+  80184b:	cd 30                	int    $0x30
+  80184d:	5b                   	pop    %ebx
+  80184e:	5e                   	pop    %esi
+  80184f:	5f                   	pop    %edi
+  801850:	5d                   	pop    %ebp
+  801851:	c3                   	ret
+
+00801852 <sys_env_set_pager>:
+  801852:	55                   	push   %ebp
+  801853:	89 e5                	mov    %esp,%ebp
+  801855:	57                   	push   %edi
+  801856:	56                   	push   %esi
+  801857:	53                   	push   %ebx
+  801858:	83 ec 0c             	sub    $0xc,%esp
+  80185b:	be 00 00 00 00       	mov    $0x0,%esi
+  801860:	8b 55 08             	mov    0x8(%ebp),%edx
+  801863:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801866:	b8 25 00 00 00       	mov    $0x25,%eax
+  80186b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186e:	89 f7                	mov    %esi,%edi
+  801870:	cd 30                	int    $0x30
+  801872:	85 c0                	test   %eax,%eax
+  801874:	7f 08                	jg     80187e <sys_env_set_pager+0x2c>
+  801876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801879:	5b                   	pop    %ebx
+  80187a:	5e                   	pop    %esi
+  80187b:	5f                   	pop    %edi
+  80187c:	5d                   	pop    %ebp
+  80187d:	c3                   	ret
+  80187e:	83 ec 0c             	sub    $0xc,%esp
+  801881:	50                   	push   %eax
+  801882:	6a 25                	push   $0x25
+  801884:	68 eb 46 80 00       	push   $0x8046eb
+  801889:	6a 24                	push   $0x24
+  80188b:	68 08 47 80 00       	push   $0x804708
+  801890:	e8 a2 eb ff ff       	call   800437 <_panic>
+
+00801895 <sys_pager_retire>:
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	57                   	push   %edi
+  801899:	56                   	push   %esi
+  80189a:	53                   	push   %ebx
+  80189b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8018a8:	89 cb                	mov    %ecx,%ebx
+  8018aa:	89 cf                	mov    %ecx,%edi
+  8018ac:	89 ce                	mov    %ecx,%esi
+  8018ae:	cd 30                	int    $0x30
+  8018b0:	5b                   	pop    %ebx
+  8018b1:	5e                   	pop    %esi
+  8018b2:	5f                   	pop    %edi
+  8018b3:	5d                   	pop    %ebp
+  8018b4:	c3                   	ret
+
+008018b5 <sys_prof>:
+  8018b5:	55                   	push   %ebp
+  8018b6:	89 e5                	mov    %esp,%ebp
+  8018b8:	57                   	push   %edi
+  8018b9:	56                   	push   %esi
+  8018ba:	53                   	push   %ebx
+  8018bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c6:	b8 22 00 00 00       	mov    $0x22,%eax
+  8018cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018ce:	89 f7                	mov    %esi,%edi
+  8018d0:	cd 30                	int    $0x30
+  8018d2:	5b                   	pop    %ebx
+  8018d3:	5e                   	pop    %esi
+  8018d4:	5f                   	pop    %edi
+  8018d5:	5d                   	pop    %ebp
+  8018d6:	c3                   	ret
+
+008018d7 <fd2num>:
+  8018d7:	55                   	push   %ebp
+  8018d8:	89 e5                	mov    %esp,%ebp
+  8018da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018dd:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018e2:	c1 e8 0c             	shr    $0xc,%eax
+  8018e5:	5d                   	pop    %ebp
+  8018e6:	c3                   	ret
+
+008018e7 <fd2data>:
+  8018e7:	55                   	push   %ebp
+  8018e8:	89 e5                	mov    %esp,%ebp
+  8018ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ed:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018f2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018f7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8018fc:	5d                   	pop    %ebp
+  8018fd:	c3                   	ret
+
+008018fe <fd_alloc>:
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801906:	89 c2                	mov    %eax,%edx
+  801908:	c1 ea 16             	shr    $0x16,%edx
+  80190b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801912:	f6 c2 01             	test   $0x1,%dl
+  801915:	74 29                	je     801940 <fd_alloc+0x42>
+  801917:	89 c2                	mov    %eax,%edx
+  801919:	c1 ea 0c             	shr    $0xc,%edx
+  80191c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801923:	f6 c2 01             	test   $0x1,%dl
+  801926:	74 18                	je     801940 <fd_alloc+0x42>
+  801928:	05 00 10 00 00       	add    $0x1000,%eax
+  80192d:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801932:	75 d2                	jne    801906 <fd_alloc+0x8>
+  801934:	b8 00 00 00 00       	mov    $0x0,%eax
+  801939:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80193e:	eb 05                	jmp    801945 <fd_alloc+0x47>
+  801940:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801945:	8b 55 08             	mov    0x8(%ebp),%edx
+  801948:	89 02                	mov    %eax,(%edx)
+  80194a:	89 c8                	mov    %ecx,%eax
+  80194c:	5d                   	pop    %ebp
+  80194d:	c3                   	ret
+
+0080194e <fd_lookup>:
+  80194e:	55                   	push   %ebp
+  80194f:	89 e5                	mov    %esp,%ebp
+  801951:	8b 45 08             	mov    0x8(%ebp),%eax
+  801954:	83 f8 1f             	cmp    $0x1f,%eax
+  801957:	77 30                	ja     801989 <fd_lookup+0x3b>
+  801959:	c1 e0 0c             	shl    $0xc,%eax
+  80195c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801961:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801967:	f6 c2 01             	test   $0x1,%dl
+  80196a:	74 24                	je     801990 <fd_lookup+0x42>
+  80196c:	89 c2                	mov    %eax,%edx
+  80196e:	c1 ea 0c             	shr    $0xc,%edx
+  801971:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801978:	f6 c2 01             	test   $0x1,%dl
+  80197b:	74 1a                	je     801997 <fd_lookup+0x49>
+  80197d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801980:	89 02                	mov    %eax,(%edx)
+  801982:	b8 00 00 00 00       	mov    $0x0,%eax
+  801987:	5d                   	pop    %ebp
+  801988:	c3                   	ret
+  801989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80198e:	eb f7                	jmp    801987 <fd_lookup+0x39>
+  801990:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801995:	eb f0                	jmp    801987 <fd_lookup+0x39>
+  801997:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80199c:	eb e9                	jmp    801987 <fd_lookup+0x39>
+
+0080199e <dev_lookup>:
+  80199e:	55                   	push   %ebp
+  80199f:	89 e5                	mov    %esp,%ebp
+  8019a1:	53                   	push   %ebx
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+  8019a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ad:	bb 90 67 80 00       	mov    $0x806790,%ebx
+  8019b2:	39 13                	cmp    %edx,(%ebx)
+  8019b4:	74 37                	je     8019ed <dev_lookup+0x4f>
+  8019b6:	83 c0 01             	add    $0x1,%eax
+  8019b9:	8b 1c 85 94 47 80 00 	mov    0x804794(,%eax,4),%ebx
+  8019c0:	85 db                	test   %ebx,%ebx
+  8019c2:	75 ee                	jne    8019b2 <dev_lookup+0x14>
+  8019c4:	a1 90 87 80 00       	mov    0x808790,%eax
+  8019c9:	8b 40 48             	mov    0x48(%eax),%eax
+  8019cc:	83 ec 04             	sub    $0x4,%esp
+  8019cf:	52                   	push   %edx
+  8019d0:	50                   	push   %eax
+  8019d1:	68 18 47 80 00       	push   $0x804718
+  8019d6:	e8 37 eb ff ff       	call   800512 <cprintf>
+  8019db:	83 c4 10             	add    $0x10,%esp
+  8019de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019e6:	89 1a                	mov    %ebx,(%edx)
+  8019e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019eb:	c9                   	leave
+  8019ec:	c3                   	ret
+  8019ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f2:	eb ef                	jmp    8019e3 <dev_lookup+0x45>
+
+008019f4 <fd_close>:
+  8019f4:	55                   	push   %ebp
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	57                   	push   %edi
+  8019f8:	56                   	push   %esi
+  8019f9:	53                   	push   %ebx
+  8019fa:	83 ec 24             	sub    $0x24,%esp
+  8019fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a00:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a03:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a06:	50                   	push   %eax
+  801a07:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a0d:	c1 e8 0c             	shr    $0xc,%eax
+  801a10:	50                   	push   %eax
+  801a11:	e8 38 ff ff ff       	call   80194e <fd_lookup>
+  801a16:	89 c3                	mov    %eax,%ebx
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	78 05                	js     801a24 <fd_close+0x30>
+  801a1f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a22:	74 0f                	je     801a33 <fd_close+0x3f>
+  801a24:	85 ff                	test   %edi,%edi
+  801a26:	0f 44 df             	cmove  %edi,%ebx
+  801a29:	89 d8                	mov    %ebx,%eax
+  801a2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a2e:	5b                   	pop    %ebx
+  801a2f:	5e                   	pop    %esi
+  801a30:	5f                   	pop    %edi
+  801a31:	5d                   	pop    %ebp
+  801a32:	c3                   	ret
+  801a33:	83 ec 08             	sub    $0x8,%esp
+  801a36:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a39:	50                   	push   %eax
+  801a3a:	ff 36                	push   (%esi)
+  801a3c:	e8 5d ff ff ff       	call   80199e <dev_lookup>
+  801a41:	89 c3                	mov    %eax,%ebx
+  801a43:	83 c4 10             	add    $0x10,%esp
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	78 1a                	js     801a64 <fd_close+0x70>
+  801a4a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a4d:	8b 40 10             	mov    0x10(%eax),%eax
+  801a50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a55:	85 c0                	test   %eax,%eax
+  801a57:	74 0b                	je     801a64 <fd_close+0x70>
+  801a59:	83 ec 0c             	sub    $0xc,%esp
+  801a5c:	56                   	push   %esi
+  801a5d:	ff d0                	call   *%eax
+  801a5f:	89 c3                	mov    %eax,%ebx
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	83 ec 08             	sub    $0x8,%esp
+  801a67:	56                   	push   %esi
+  801a68:	6a 00                	push   $0x0
+  801a6a:	e8 cc f6 ff ff       	call   80113b <sys_page_unmap>
+  801a6f:	83 c4 10             	add    $0x10,%esp
+  801a72:	eb b5                	jmp    801a29 <fd_close+0x35>
+
+00801a74 <close>:
+  801a74:	55                   	push   %ebp
+  801a75:	89 e5                	mov    %esp,%ebp
+  801a77:	83 ec 20             	sub    $0x20,%esp
+  801a7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7d:	50                   	push   %eax
+  801a7e:	ff 75 08             	push   0x8(%ebp)
+  801a81:	e8 c8 fe ff ff       	call   80194e <fd_lookup>
+  801a86:	83 c4 10             	add    $0x10,%esp
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	79 02                	jns    801a8f <close+0x1b>
+  801a8d:	c9                   	leave
+  801a8e:	c3                   	ret
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	6a 01                	push   $0x1
+  801a94:	ff 75 f4             	push   -0xc(%ebp)
+  801a97:	e8 58 ff ff ff       	call   8019f4 <fd_close>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	eb ec                	jmp    801a8d <close+0x19>
+
+00801aa1 <close_all>:
+  801aa1:	55                   	push   %ebp
+  801aa2:	89 e5                	mov    %esp,%ebp
+  801aa4:	53                   	push   %ebx
+  801aa5:	83 ec 04             	sub    $0x4,%esp
+  801aa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aad:	83 ec 0c             	sub    $0xc,%esp
+  801ab0:	53                   	push   %ebx
+  801ab1:	e8 be ff ff ff       	call   801a74 <close>
+  801ab6:	83 c3 01             	add    $0x1,%ebx
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	83 fb 20             	cmp    $0x20,%ebx
+  801abf:	75 ec                	jne    801aad <close_all+0xc>
+  801ac1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac4:	c9                   	leave
+  801ac5:	c3                   	ret
+
+00801ac6 <dup>:
+  801ac6:	55                   	push   %ebp
+  801ac7:	89 e5                	mov    %esp,%ebp
+  801ac9:	57                   	push   %edi
+  801aca:	56                   	push   %esi
+  801acb:	53                   	push   %ebx
+  801acc:	83 ec 34             	sub    $0x34,%esp
+  801acf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ad2:	50                   	push   %eax
+  801ad3:	ff 75 08             	push   0x8(%ebp)
+  801ad6:	e8 73 fe ff ff       	call   80194e <fd_lookup>
+  801adb:	89 c3                	mov    %eax,%ebx
+  801add:	83 c4 10             	add    $0x10,%esp
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 7f                	js     801b63 <dup+0x9d>
+  801ae4:	83 ec 0c             	sub    $0xc,%esp
+  801ae7:	ff 75 0c             	push   0xc(%ebp)
+  801aea:	e8 85 ff ff ff       	call   801a74 <close>
+  801aef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801af2:	c1 e6 0c             	shl    $0xc,%esi
+  801af5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801afb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801afe:	89 3c 24             	mov    %edi,(%esp)
+  801b01:	e8 e1 fd ff ff       	call   8018e7 <fd2data>
+  801b06:	89 c3                	mov    %eax,%ebx
+  801b08:	89 34 24             	mov    %esi,(%esp)
+  801b0b:	e8 d7 fd ff ff       	call   8018e7 <fd2data>
+  801b10:	83 c4 10             	add    $0x10,%esp
+  801b13:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801b16:	89 d8                	mov    %ebx,%eax
+  801b18:	c1 e8 16             	shr    $0x16,%eax
+  801b1b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b22:	a8 01                	test   $0x1,%al
+  801b24:	74 11                	je     801b37 <dup+0x71>
+  801b26:	89 d8                	mov    %ebx,%eax
+  801b28:	c1 e8 0c             	shr    $0xc,%eax
+  801b2b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b32:	f6 c2 01             	test   $0x1,%dl
+  801b35:	75 36                	jne    801b6d <dup+0xa7>
+  801b37:	89 f8                	mov    %edi,%eax
+  801b39:	c1 e8 0c             	shr    $0xc,%eax
+  801b3c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b43:	83 ec 0c             	sub    $0xc,%esp
+  801b46:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b4b:	50                   	push   %eax
+  801b4c:	56                   	push   %esi
+  801b4d:	6a 00                	push   $0x0
+  801b4f:	57                   	push   %edi
+  801b50:	6a 00                	push   $0x0
+  801b52:	e8 55 f5 ff ff       	call   8010ac <sys_page_map>
+  801b57:	89 c3                	mov    %eax,%ebx
+  801b59:	83 c4 20             	add    $0x20,%esp
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 33                	js     801b93 <dup+0xcd>
+  801b60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b63:	89 d8                	mov    %ebx,%eax
+  801b65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b68:	5b                   	pop    %ebx
+  801b69:	5e                   	pop    %esi
+  801b6a:	5f                   	pop    %edi
+  801b6b:	5d                   	pop    %ebp
+  801b6c:	c3                   	ret
+  801b6d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b74:	83 ec 0c             	sub    $0xc,%esp
+  801b77:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b7c:	50                   	push   %eax
+  801b7d:	ff 75 d4             	push   -0x2c(%ebp)
+  801b80:	6a 00                	push   $0x0
+  801b82:	53                   	push   %ebx
+  801b83:	6a 00                	push   $0x0
+  801b85:	e8 22 f5 ff ff       	call   8010ac <sys_page_map>
+  801b8a:	89 c3                	mov    %eax,%ebx
+  801b8c:	83 c4 20             	add    $0x20,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	79 a4                	jns    801b37 <dup+0x71>
+  801b93:	83 ec 08             	sub    $0x8,%esp
+  801b96:	56                   	push   %esi
+  801b97:	6a 00                	push   $0x0
+  801b99:	e8 9d f5 ff ff       	call   80113b <sys_page_unmap>
+  801b9e:	83 c4 08             	add    $0x8,%esp
+  801ba1:	ff 75 d4             	push   -0x2c(%ebp)
+  801ba4:	6a 00                	push   $0x0
+  801ba6:	e8 90 f5 ff ff       	call   80113b <sys_page_unmap>
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	eb b3                	jmp    801b63 <dup+0x9d>
+
+00801bb0 <read>:
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	56                   	push   %esi
+  801bb4:	53                   	push   %ebx
+  801bb5:	83 ec 18             	sub    $0x18,%esp
+  801bb8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bbb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bbe:	50                   	push   %eax
+  801bbf:	56                   	push   %esi
+  801bc0:	e8 89 fd ff ff       	call   80194e <fd_lookup>
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 3c                	js     801c08 <read+0x58>
+  801bcc:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801bcf:	83 ec 08             	sub    $0x8,%esp
+  801bd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd5:	50                   	push   %eax
+  801bd6:	ff 33                	push   (%ebx)
+  801bd8:	e8 c1 fd ff ff       	call   80199e <dev_lookup>
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 24                	js     801c08 <read+0x58>
+  801be4:	8b 43 08             	mov    0x8(%ebx),%eax
+  801be7:	83 e0 03             	and    $0x3,%eax
+  801bea:	83 f8 01             	cmp    $0x1,%eax
+  801bed:	74 20                	je     801c0f <read+0x5f>
+  801bef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bf2:	8b 40 08             	mov    0x8(%eax),%eax
+  801bf5:	85 c0                	test   %eax,%eax
+  801bf7:	74 37                	je     801c30 <read+0x80>
+  801bf9:	83 ec 04             	sub    $0x4,%esp
+  801bfc:	ff 75 10             	push   0x10(%ebp)
+  801bff:	ff 75 0c             	push   0xc(%ebp)
+  801c02:	53                   	push   %ebx
+  801c03:	ff d0                	call   *%eax
+  801c05:	83 c4 10             	add    $0x10,%esp
+  801c08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c0b:	5b                   	pop    %ebx
+  801c0c:	5e                   	pop    %esi
+  801c0d:	5d                   	pop    %ebp
+  801c0e:	c3                   	ret
+  801c0f:	a1 90 87 80 00       	mov    0x808790,%eax
+  801c14:	8b 40 48             	mov    0x48(%eax),%eax
+  801c17:	83 ec 04             	sub    $0x4,%esp
+  801c1a:	56                   	push   %esi
+  801c1b:	50                   	push   %eax
+  801c1c:	68 59 47 80 00       	push   $0x804759
+  801c21:	e8 ec e8 ff ff       	call   800512 <cprintf>
+  801c26:	83 c4 10             	add    $0x10,%esp
+  801c29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c2e:	eb d8                	jmp    801c08 <read+0x58>
+  801c30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c35:	eb d1                	jmp    801c08 <read+0x58>
+
+00801c37 <readn>:
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	57                   	push   %edi
+  801c3b:	56                   	push   %esi
+  801c3c:	53                   	push   %ebx
+  801c3d:	83 ec 0c             	sub    $0xc,%esp
+  801c40:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801c43:	8b 75 10             	mov    0x10(%ebp),%esi
+  801c46:	85 f6                	test   %esi,%esi
+  801c48:	74 30                	je     801c7a <readn+0x43>
+  801c4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c54:	83 ec 04             	sub    $0x4,%esp
+  801c57:	89 f2                	mov    %esi,%edx
+  801c59:	29 c2                	sub    %eax,%edx
+  801c5b:	52                   	push   %edx
+  801c5c:	01 f8                	add    %edi,%eax
+  801c5e:	50                   	push   %eax
+  801c5f:	ff 75 08             	push   0x8(%ebp)
+  801c62:	e8 49 ff ff ff       	call   801bb0 <read>
+  801c67:	83 c4 10             	add    $0x10,%esp
+  801c6a:	85 c0                	test   %eax,%eax
+  801c6c:	78 15                	js     801c83 <readn+0x4c>
+  801c6e:	74 11                	je     801c81 <readn+0x4a>
+  801c70:	01 c3                	add    %eax,%ebx
+  801c72:	89 d8                	mov    %ebx,%eax
+  801c74:	39 f3                	cmp    %esi,%ebx
+  801c76:	72 dc                	jb     801c54 <readn+0x1d>
+  801c78:	eb 09                	jmp    801c83 <readn+0x4c>
+  801c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7f:	eb 02                	jmp    801c83 <readn+0x4c>
+  801c81:	89 d8                	mov    %ebx,%eax
+  801c83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c86:	5b                   	pop    %ebx
+  801c87:	5e                   	pop    %esi
+  801c88:	5f                   	pop    %edi
+  801c89:	5d                   	pop    %ebp
+  801c8a:	c3                   	ret
+
+00801c8b <write>:
+  801c8b:	55                   	push   %ebp
+  801c8c:	89 e5                	mov    %esp,%ebp
+  801c8e:	56                   	push   %esi
+  801c8f:	53                   	push   %ebx
+  801c90:	83 ec 18             	sub    $0x18,%esp
+  801c93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c96:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c99:	50                   	push   %eax
+  801c9a:	53                   	push   %ebx
+  801c9b:	e8 ae fc ff ff       	call   80194e <fd_lookup>
+  801ca0:	83 c4 10             	add    $0x10,%esp
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 37                	js     801cde <write+0x53>
+  801ca7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801caa:	83 ec 08             	sub    $0x8,%esp
+  801cad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb0:	50                   	push   %eax
+  801cb1:	ff 36                	push   (%esi)
+  801cb3:	e8 e6 fc ff ff       	call   80199e <dev_lookup>
+  801cb8:	83 c4 10             	add    $0x10,%esp
+  801cbb:	85 c0                	test   %eax,%eax
+  801cbd:	78 1f                	js     801cde <write+0x53>
+  801cbf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cc3:	74 20                	je     801ce5 <write+0x5a>
+  801cc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cc8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	74 37                	je     801d06 <write+0x7b>
+  801ccf:	83 ec 04             	sub    $0x4,%esp
+  801cd2:	ff 75 10             	push   0x10(%ebp)
+  801cd5:	ff 75 0c             	push   0xc(%ebp)
+  801cd8:	56                   	push   %esi
+  801cd9:	ff d0                	call   *%eax
+  801cdb:	83 c4 10             	add    $0x10,%esp
+  801cde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce1:	5b                   	pop    %ebx
+  801ce2:	5e                   	pop    %esi
+  801ce3:	5d                   	pop    %ebp
+  801ce4:	c3                   	ret
+  801ce5:	a1 90 87 80 00       	mov    0x808790,%eax
+  801cea:	8b 40 48             	mov    0x48(%eax),%eax
+  801ced:	83 ec 04             	sub    $0x4,%esp
+  801cf0:	53                   	push   %ebx
+  801cf1:	50                   	push   %eax
+  801cf2:	68 75 47 80 00       	push   $0x804775
+  801cf7:	e8 16 e8 ff ff       	call   800512 <cprintf>
+  801cfc:	83 c4 10             	add    $0x10,%esp
+  801cff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d04:	eb d8                	jmp    801cde <write+0x53>
+  801d06:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d0b:	eb d1                	jmp    801cde <write+0x53>
+
+00801d0d <seek>:
+  801d0d:	55                   	push   %ebp
+  801d0e:	89 e5                	mov    %esp,%ebp
+  801d10:	83 ec 20             	sub    $0x20,%esp
+  801d13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d16:	50                   	push   %eax
+  801d17:	ff 75 08             	push   0x8(%ebp)
+  801d1a:	e8 2f fc ff ff       	call   80194e <fd_lookup>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 0e                	js     801d34 <seek+0x27>
+  801d26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d2c:	89 50 04             	mov    %edx,0x4(%eax)
+  801d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d34:	c9                   	leave
+  801d35:	c3                   	ret
+
+00801d36 <ftruncate>:
+  801d36:	55                   	push   %ebp
+  801d37:	89 e5                	mov    %esp,%ebp
+  801d39:	56                   	push   %esi
+  801d3a:	53                   	push   %ebx
+  801d3b:	83 ec 18             	sub    $0x18,%esp
+  801d3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d41:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d44:	50                   	push   %eax
+  801d45:	53                   	push   %ebx
+  801d46:	e8 03 fc ff ff       	call   80194e <fd_lookup>
+  801d4b:	83 c4 10             	add    $0x10,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 34                	js     801d86 <ftruncate+0x50>
+  801d52:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d55:	83 ec 08             	sub    $0x8,%esp
+  801d58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d5b:	50                   	push   %eax
+  801d5c:	ff 36                	push   (%esi)
+  801d5e:	e8 3b fc ff ff       	call   80199e <dev_lookup>
+  801d63:	83 c4 10             	add    $0x10,%esp
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	78 1c                	js     801d86 <ftruncate+0x50>
+  801d6a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d6e:	74 1d                	je     801d8d <ftruncate+0x57>
+  801d70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d73:	8b 40 18             	mov    0x18(%eax),%eax
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	74 34                	je     801dae <ftruncate+0x78>
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+  801d7d:	ff 75 0c             	push   0xc(%ebp)
+  801d80:	56                   	push   %esi
+  801d81:	ff d0                	call   *%eax
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d89:	5b                   	pop    %ebx
+  801d8a:	5e                   	pop    %esi
+  801d8b:	5d                   	pop    %ebp
+  801d8c:	c3                   	ret
+  801d8d:	a1 90 87 80 00       	mov    0x808790,%eax
+  801d92:	8b 40 48             	mov    0x48(%eax),%eax
+  801d95:	83 ec 04             	sub    $0x4,%esp
+  801d98:	53                   	push   %ebx
+  801d99:	50                   	push   %eax
+  801d9a:	68 38 47 80 00       	push   $0x804738
+  801d9f:	e8 6e e7 ff ff       	call   800512 <cprintf>
+  801da4:	83 c4 10             	add    $0x10,%esp
+  801da7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dac:	eb d8                	jmp    801d86 <ftruncate+0x50>
+  801dae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801db3:	eb d1                	jmp    801d86 <ftruncate+0x50>
+
+00801db5 <fstat>:
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	56                   	push   %esi
+  801db9:	53                   	push   %ebx
+  801dba:	83 ec 18             	sub    $0x18,%esp
+  801dbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801dc0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dc3:	50                   	push   %eax
+  801dc4:	ff 75 08             	push   0x8(%ebp)
+  801dc7:	e8 82 fb ff ff       	call   80194e <fd_lookup>
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	78 49                	js     801e1c <fstat+0x67>
+  801dd3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dd6:	83 ec 08             	sub    $0x8,%esp
+  801dd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ddc:	50                   	push   %eax
+  801ddd:	ff 36                	push   (%esi)
+  801ddf:	e8 ba fb ff ff       	call   80199e <dev_lookup>
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 31                	js     801e1c <fstat+0x67>
+  801deb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dee:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801df2:	74 2f                	je     801e23 <fstat+0x6e>
+  801df4:	c6 03 00             	movb   $0x0,(%ebx)
+  801df7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801dfe:	00 00 00 
+  801e01:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e08:	00 00 00 
+  801e0b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801e11:	83 ec 08             	sub    $0x8,%esp
+  801e14:	53                   	push   %ebx
+  801e15:	56                   	push   %esi
+  801e16:	ff 50 14             	call   *0x14(%eax)
+  801e19:	83 c4 10             	add    $0x10,%esp
+  801e1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1f:	5b                   	pop    %ebx
+  801e20:	5e                   	pop    %esi
+  801e21:	5d                   	pop    %ebp
+  801e22:	c3                   	ret
+  801e23:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e28:	eb f2                	jmp    801e1c <fstat+0x67>
+
+00801e2a <stat>:
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	56                   	push   %esi
+  801e2e:	53                   	push   %ebx
+  801e2f:	83 ec 08             	sub    $0x8,%esp
+  801e32:	6a 00                	push   $0x0
+  801e34:	ff 75 08             	push   0x8(%ebp)
+  801e37:	e8 31 05 00 00       	call   80236d <open>
+  801e3c:	89 c3                	mov    %eax,%ebx
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	85 c0                	test   %eax,%eax
+  801e43:	78 1b                	js     801e60 <stat+0x36>
+  801e45:	83 ec 08             	sub    $0x8,%esp
+  801e48:	ff 75 0c             	push   0xc(%ebp)
+  801e4b:	50                   	push   %eax
+  801e4c:	e8 64 ff ff ff       	call   801db5 <fstat>
+  801e51:	89 c6                	mov    %eax,%esi
+  801e53:	89 1c 24             	mov    %ebx,(%esp)
+  801e56:	e8 19 fc ff ff       	call   801a74 <close>
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	89 f3                	mov    %esi,%ebx
+  801e60:	89 d8                	mov    %ebx,%eax
+  801e62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e65:	5b                   	pop    %ebx
+  801e66:	5e                   	pop    %esi
+  801e67:	5d                   	pop    %ebp
+  801e68:	c3                   	ret
+
+00801e69 <fsipc>:
+  801e69:	55                   	push   %ebp
+  801e6a:	89 e5                	mov    %esp,%ebp
+  801e6c:	56                   	push   %esi
+  801e6d:	53                   	push   %ebx
+  801e6e:	89 c3                	mov    %eax,%ebx
+  801e70:	89 d6                	mov    %edx,%esi
+  801e72:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  801e79:	74 20                	je     801e9b <fsipc+0x32>
+  801e7b:	83 ec 08             	sub    $0x8,%esp
+  801e7e:	6a 00                	push   $0x0
+  801e80:	56                   	push   %esi
+  801e81:	6a 07                	push   $0x7
+  801e83:	68 00 90 80 00       	push   $0x809000
+  801e88:	53                   	push   %ebx
+  801e89:	ff 35 08 70 80 00    	push   0x807008
+  801e8f:	e8 39 1f 00 00       	call   803dcd <ipc_call>
+  801e94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e97:	5b                   	pop    %ebx
+  801e98:	5e                   	pop    %esi
+  801e99:	5d                   	pop    %ebp
+  801e9a:	c3                   	ret
+  801e9b:	83 ec 0c             	sub    $0xc,%esp
+  801e9e:	6a 02                	push   $0x2
+  801ea0:	e8 c3 20 00 00       	call   803f68 <ipc_find_env>
+  801ea5:	a3 08 70 80 00       	mov    %eax,0x807008
+  801eaa:	83 c4 10             	add    $0x10,%esp
+  801ead:	eb cc                	jmp    801e7b <fsipc+0x12>
+
+00801eaf <devfile_trunc>:
+  801eaf:	55                   	push   %ebp
+  801eb0:	89 e5                	mov    %esp,%ebp
+  801eb2:	83 ec 08             	sub    $0x8,%esp
+  801eb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ebb:	a3 00 90 80 00       	mov    %eax,0x809000
+  801ec0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ec3:	a3 04 90 80 00       	mov    %eax,0x809004
+  801ec8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecd:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ed2:	e8 92 ff ff ff       	call   801e69 <fsipc>
+  801ed7:	c9                   	leave
+  801ed8:	c3                   	ret
+
+00801ed9 <devfile_flush>:
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	83 ec 08             	sub    $0x8,%esp
+  801edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee5:	a3 00 90 80 00       	mov    %eax,0x809000
+  801eea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eef:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ef4:	e8 70 ff ff ff       	call   801e69 <fsipc>
+  801ef9:	c9                   	leave
+  801efa:	c3                   	ret
+
+00801efb <devfile_stat>:
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	53                   	push   %ebx
+  801eff:	83 ec 04             	sub    $0x4,%esp
+  801f02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f08:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f0b:	a3 00 90 80 00       	mov    %eax,0x809000
+  801f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f15:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f1a:	e8 4a ff ff ff       	call   801e69 <fsipc>
+  801f1f:	85 c0                	test   %eax,%eax
+  801f21:	78 2c                	js     801f4f <devfile_stat+0x54>
+  801f23:	83 ec 08             	sub    $0x8,%esp
+  801f26:	68 00 90 80 00       	push   $0x809000
+  801f2b:	53                   	push   %ebx
+  801f2c:	e8 d8 ec ff ff       	call   800c09 <strcpy>
+  801f31:	a1 80 90 80 00       	mov    0x809080,%eax
+  801f36:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801f3c:	a1 84 90 80 00       	mov    0x809084,%eax
+  801f41:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f52:	c9                   	leave
+  801f53:	c3                   	ret
+
+00801f54 <fsring_rw>:
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	57                   	push   %edi
+  801f58:	56                   	push   %esi
+  801f59:	53                   	push   %ebx
+  801f5a:	83 ec 2c             	sub    $0x2c,%esp
+  801f5d:	89 c7                	mov    %eax,%edi
+  801f5f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801f62:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801f65:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801f6a:	a8 01                	test   $0x1,%al
+  801f6c:	74 0d                	je     801f7b <fsring_rw+0x27>
+  801f6e:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801f73:	a8 01                	test   $0x1,%al
+  801f75:	0f 85 d5 00 00 00    	jne    802050 <fsring_rw+0xfc>
+  801f7b:	a1 90 87 80 00       	mov    0x808790,%eax
+  801f80:	8b 40 48             	mov    0x48(%eax),%eax
+  801f83:	3b 05 04 70 80 00    	cmp    0x807004,%eax
+  801f89:	0f 84 fc 00 00 00    	je     80208b <fsring_rw+0x137>
+  801f8f:	83 3d 08 70 80 00 00 	cmpl   $0x0,0x807008
+  801f96:	0f 84 02 01 00 00    	je     80209e <fsring_rw+0x14a>
+  801f9c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801fa1:	83 ec 04             	sub    $0x4,%esp
+  801fa4:	68 07 02 00 00       	push   $0x207
+  801fa9:	53                   	push   %ebx
+  801faa:	6a 00                	push   $0x0
+  801fac:	e8 b8 f0 ff ff       	call   801069 <sys_page_alloc>
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	0f 88 f9 00 00 00    	js     8020b5 <fsring_rw+0x161>
+  801fbc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fc2:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801fc8:	75 d7                	jne    801fa1 <fsring_rw+0x4d>
+  801fca:	6a 0e                	push   $0xe
+  801fcc:	6a 0d                	push   $0xd
+  801fce:	ff 35 08 70 80 00    	push   0x807008
+  801fd4:	68 00 00 f0 cf       	push   $0xcff00000
+  801fd9:	e8 fb 15 00 00       	call   8035d9 <ipcring_init>
+  801fde:	83 c4 08             	add    $0x8,%esp
+  801fe1:	6a 00                	push   $0x0
+  801fe3:	6a 00                	push   $0x0
+  801fe5:	68 07 02 00 00       	push   $0x207
+  801fea:	68 00 00 f0 cf       	push   $0xcff00000
+  801fef:	6a 0b                	push   $0xb
+  801ff1:	ff 35 08 70 80 00    	push   0x807008
+  801ff7:	e8 d1 1d 00 00       	call   803dcd <ipc_call>
+  801ffc:	89 c6                	mov    %eax,%esi
+  801ffe:	83 c4 20             	add    $0x20,%esp
+  802001:	85 c0                	test   %eax,%eax
+  802003:	0f 88 ac 00 00 00    	js     8020b5 <fsring_rw+0x161>
+  802009:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80200e:	89 d9                	mov    %ebx,%ecx
+  802010:	83 c3 01             	add    $0x1,%ebx
+  802013:	89 da                	mov    %ebx,%edx
+  802015:	c1 e2 0c             	shl    $0xc,%edx
+  802018:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80201e:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802024:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80202a:	83 ec 08             	sub    $0x8,%esp
+  80202d:	6a 00                	push   $0x0
+  80202f:	6a 00                	push   $0x0
+  802031:	68 07 02 00 00       	push   $0x207
+  802036:	50                   	push   %eax
+  802037:	6a 0c                	push   $0xc
+  802039:	ff 35 08 70 80 00    	push   0x807008
+  80203f:	e8 89 1d 00 00       	call   803dcd <ipc_call>
+  802044:	83 c4 20             	add    $0x20,%esp
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 6a                	js     8020b5 <fsring_rw+0x161>
+  80204b:	83 fb 08             	cmp    $0x8,%ebx
+  80204e:	75 be                	jne    80200e <fsring_rw+0xba>
+  802050:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802054:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802059:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80205e:	0f 45 c2             	cmovne %edx,%eax
+  802061:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802064:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80206b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802072:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802079:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207e:	be 00 00 00 00       	mov    $0x0,%esi
+  802083:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802086:	e9 4b 01 00 00       	jmp    8021d6 <fsring_rw+0x282>
+  80208b:	e8 a3 f3 ff ff       	call   801433 <sys_time_msec>
+  802090:	3b 05 00 70 80 00    	cmp    0x807000,%eax
+  802096:	0f 89 f3 fe ff ff    	jns    801f8f <fsring_rw+0x3b>
+  80209c:	eb 54                	jmp    8020f2 <fsring_rw+0x19e>
+  80209e:	83 ec 0c             	sub    $0xc,%esp
+  8020a1:	6a 02                	push   $0x2
+  8020a3:	e8 c0 1e 00 00       	call   803f68 <ipc_find_env>
+  8020a8:	a3 08 70 80 00       	mov    %eax,0x807008
+  8020ad:	83 c4 10             	add    $0x10,%esp
+  8020b0:	e9 e7 fe ff ff       	jmp    801f9c <fsring_rw+0x48>
+  8020b5:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020ba:	83 ec 08             	sub    $0x8,%esp
+  8020bd:	53                   	push   %ebx
+  8020be:	6a 00                	push   $0x0
+  8020c0:	e8 76 f0 ff ff       	call   80113b <sys_page_unmap>
+  8020c5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020cb:	83 c4 10             	add    $0x10,%esp
+  8020ce:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8020d4:	75 e4                	jne    8020ba <fsring_rw+0x166>
+  8020d6:	e8 58 f3 ff ff       	call   801433 <sys_time_msec>
+  8020db:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8020e0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020e5:	a1 90 87 80 00       	mov    0x808790,%eax
+  8020ea:	8b 40 48             	mov    0x48(%eax),%eax
+  8020ed:	a3 04 70 80 00       	mov    %eax,0x807004
+  8020f2:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8020f9:	e9 7a 01 00 00       	jmp    802278 <fsring_rw+0x324>
+  8020fe:	8b 57 0c             	mov    0xc(%edi),%edx
+  802101:	89 10                	mov    %edx,(%eax)
+  802103:	89 58 04             	mov    %ebx,0x4(%eax)
+  802106:	89 f2                	mov    %esi,%edx
+  802108:	03 57 04             	add    0x4(%edi),%edx
+  80210b:	89 50 08             	mov    %edx,0x8(%eax)
+  80210e:	83 ec 04             	sub    $0x4,%esp
+  802111:	53                   	push   %ebx
+  802112:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802115:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802118:	52                   	push   %edx
+  802119:	83 c0 0c             	add    $0xc,%eax
+  80211c:	50                   	push   %eax
+  80211d:	e8 97 ec ff ff       	call   800db9 <memmove>
+  802122:	83 c4 10             	add    $0x10,%esp
+  802125:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802128:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80212b:	89 08                	mov    %ecx,(%eax)
+  80212d:	83 ec 0c             	sub    $0xc,%esp
+  802130:	68 00 00 f0 cf       	push   $0xcff00000
+  802135:	e8 fd 14 00 00       	call   803637 <ipcring_req_push>
+  80213a:	01 de                	add    %ebx,%esi
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802142:	73 4c                	jae    802190 <fsring_rw+0x23c>
+  802144:	83 ec 0c             	sub    $0xc,%esp
+  802147:	68 00 00 f0 cf       	push   $0xcff00000
+  80214c:	e8 c0 14 00 00       	call   803611 <ipcring_req_slot>
+  802151:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802154:	83 c4 10             	add    $0x10,%esp
+  802157:	85 c0                	test   %eax,%eax
+  802159:	74 35                	je     802190 <fsring_rw+0x23c>
+  80215b:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802160:	83 e0 07             	and    $0x7,%eax
+  802163:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802168:	c1 e0 0c             	shl    $0xc,%eax
+  80216b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80216e:	29 f3                	sub    %esi,%ebx
+  802170:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802173:	39 cb                	cmp    %ecx,%ebx
+  802175:	0f 47 d9             	cmova  %ecx,%ebx
+  802178:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80217c:	75 80                	jne    8020fe <fsring_rw+0x1aa>
+  80217e:	8b 57 0c             	mov    0xc(%edi),%edx
+  802181:	89 10                	mov    %edx,(%eax)
+  802183:	89 58 04             	mov    %ebx,0x4(%eax)
+  802186:	89 f2                	mov    %esi,%edx
+  802188:	03 57 04             	add    0x4(%edi),%edx
+  80218b:	89 50 08             	mov    %edx,0x8(%eax)
+  80218e:	eb 95                	jmp    802125 <fsring_rw+0x1d1>
+  802190:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802195:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802198:	83 ec 0c             	sub    $0xc,%esp
+  80219b:	68 00 00 f0 cf       	push   $0xcff00000
+  8021a0:	e8 cb 14 00 00       	call   803670 <ipcring_rsp_wait>
+  8021a5:	8b 58 04             	mov    0x4(%eax),%ebx
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8021af:	75 45                	jne    8021f6 <fsring_rw+0x2a2>
+  8021b1:	85 db                	test   %ebx,%ebx
+  8021b3:	79 41                	jns    8021f6 <fsring_rw+0x2a2>
+  8021b5:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8021b8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8021bf:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8021c6:	83 ec 0c             	sub    $0xc,%esp
+  8021c9:	68 00 00 f0 cf       	push   $0xcff00000
+  8021ce:	e8 03 15 00 00       	call   8036d6 <ipcring_rsp_pop>
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8021dc:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8021e1:	39 c2                	cmp    %eax,%edx
+  8021e3:	74 75                	je     80225a <fsring_rw+0x306>
+  8021e5:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8021e9:	75 a5                	jne    802190 <fsring_rw+0x23c>
+  8021eb:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8021ee:	0f 82 50 ff ff ff    	jb     802144 <fsring_rw+0x1f0>
+  8021f4:	eb 9a                	jmp    802190 <fsring_rw+0x23c>
+  8021f6:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8021fa:	75 ca                	jne    8021c6 <fsring_rw+0x272>
+  8021fc:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802200:	74 31                	je     802233 <fsring_rw+0x2df>
+  802202:	8b 45 08             	mov    0x8(%ebp),%eax
+  802205:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802208:	29 c8                	sub    %ecx,%eax
+  80220a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80220d:	39 d0                	cmp    %edx,%eax
+  80220f:	0f 47 c2             	cmova  %edx,%eax
+  802212:	39 d8                	cmp    %ebx,%eax
+  802214:	ba 01 00 00 00       	mov    $0x1,%edx
+  802219:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80221d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802220:	b8 01 00 00 00       	mov    $0x1,%eax
+  802225:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802229:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80222c:	01 d9                	add    %ebx,%ecx
+  80222e:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802231:	eb 93                	jmp    8021c6 <fsring_rw+0x272>
+  802233:	83 ec 04             	sub    $0x4,%esp
+  802236:	53                   	push   %ebx
+  802237:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80223a:	83 e0 07             	and    $0x7,%eax
+  80223d:	c1 e0 0c             	shl    $0xc,%eax
+  802240:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802246:	50                   	push   %eax
+  802247:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80224a:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80224d:	01 c8                	add    %ecx,%eax
+  80224f:	50                   	push   %eax
+  802250:	e8 64 eb ff ff       	call   800db9 <memmove>
+  802255:	83 c4 10             	add    $0x10,%esp
+  802258:	eb a8                	jmp    802202 <fsring_rw+0x2ae>
+  80225a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80225e:	75 09                	jne    802269 <fsring_rw+0x315>
+  802260:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802263:	0f 82 db fe ff ff    	jb     802144 <fsring_rw+0x1f0>
+  802269:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80226c:	01 57 04             	add    %edx,0x4(%edi)
+  80226f:	85 d2                	test   %edx,%edx
+  802271:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802275:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802278:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80227b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80227e:	5b                   	pop    %ebx
+  80227f:	5e                   	pop    %esi
+  802280:	5f                   	pop    %edi
+  802281:	5d                   	pop    %ebp
+  802282:	c3                   	ret
+
+00802283 <devfile_write>:
+  802283:	55                   	push   %ebp
+  802284:	89 e5                	mov    %esp,%ebp
+  802286:	57                   	push   %edi
+  802287:	56                   	push   %esi
+  802288:	53                   	push   %ebx
+  802289:	83 ec 0c             	sub    $0xc,%esp
+  80228c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80228f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802295:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80229b:	76 1a                	jbe    8022b7 <devfile_write+0x34>
+  80229d:	83 ec 0c             	sub    $0xc,%esp
+  8022a0:	53                   	push   %ebx
+  8022a1:	89 f1                	mov    %esi,%ecx
+  8022a3:	ba 06 00 00 00       	mov    $0x6,%edx
+  8022a8:	89 f8                	mov    %edi,%eax
+  8022aa:	e8 a5 fc ff ff       	call   801f54 <fsring_rw>
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8022b5:	75 39                	jne    8022f0 <devfile_write+0x6d>
+  8022b7:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8022bc:	39 c3                	cmp    %eax,%ebx
+  8022be:	0f 47 d8             	cmova  %eax,%ebx
+  8022c1:	8b 47 0c             	mov    0xc(%edi),%eax
+  8022c4:	a3 00 90 80 00       	mov    %eax,0x809000
+  8022c9:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  8022cf:	83 ec 04             	sub    $0x4,%esp
+  8022d2:	53                   	push   %ebx
+  8022d3:	56                   	push   %esi
+  8022d4:	68 08 90 80 00       	push   $0x809008
+  8022d9:	e8 db ea ff ff       	call   800db9 <memmove>
+  8022de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022e8:	e8 7c fb ff ff       	call   801e69 <fsipc>
+  8022ed:	83 c4 10             	add    $0x10,%esp
+  8022f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f3:	5b                   	pop    %ebx
+  8022f4:	5e                   	pop    %esi
+  8022f5:	5f                   	pop    %edi
+  8022f6:	5d                   	pop    %ebp
+  8022f7:	c3                   	ret
+
+008022f8 <devfile_read>:
+  8022f8:	55                   	push   %ebp
+  8022f9:	89 e5                	mov    %esp,%ebp
+  8022fb:	57                   	push   %edi
+  8022fc:	56                   	push   %esi
+  8022fd:	53                   	push   %ebx
+  8022fe:	83 ec 0c             	sub    $0xc,%esp
+  802301:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802304:	8b 75 10             	mov    0x10(%ebp),%esi
+  802307:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80230d:	76 1d                	jbe    80232c <devfile_read+0x34>
+  80230f:	83 ec 0c             	sub    $0xc,%esp
+  802312:	56                   	push   %esi
+  802313:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802316:	ba 05 00 00 00       	mov    $0x5,%edx
+  80231b:	89 f8                	mov    %edi,%eax
+  80231d:	e8 32 fc ff ff       	call   801f54 <fsring_rw>
+  802322:	89 c3                	mov    %eax,%ebx
+  802324:	83 c4 10             	add    $0x10,%esp
+  802327:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80232a:	75 37                	jne    802363 <devfile_read+0x6b>
+  80232c:	8b 47 0c             	mov    0xc(%edi),%eax
+  80232f:	a3 00 90 80 00       	mov    %eax,0x809000
+  802334:	89 35 04 90 80 00    	mov    %esi,0x809004
+  80233a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802344:	e8 20 fb ff ff       	call   801e69 <fsipc>
+  802349:	89 c3                	mov    %eax,%ebx
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	78 14                	js     802363 <devfile_read+0x6b>
+  80234f:	83 ec 04             	sub    $0x4,%esp
+  802352:	50                   	push   %eax
+  802353:	68 00 90 80 00       	push   $0x809000
+  802358:	ff 75 0c             	push   0xc(%ebp)
+  80235b:	e8 59 ea ff ff       	call   800db9 <memmove>
+  802360:	83 c4 10             	add    $0x10,%esp
+  802363:	89 d8                	mov    %ebx,%eax
+  802365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802368:	5b                   	pop    %ebx
+  802369:	5e                   	pop    %esi
+  80236a:	5f                   	pop    %edi
+  80236b:	5d                   	pop    %ebp
+  80236c:	c3                   	ret
+
+0080236d <open>:
+  80236d:	55                   	push   %ebp
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	56                   	push   %esi
+  802371:	53                   	push   %ebx
+  802372:	83 ec 1c             	sub    $0x1c,%esp
+  802375:	8b 75 08             	mov    0x8(%ebp),%esi
+  802378:	56                   	push   %esi
+  802379:	e8 3f e8 ff ff       	call   800bbd <strlen>
+  80237e:	83 c4 10             	add    $0x10,%esp
+  802381:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802386:	7f 6c                	jg     8023f4 <open+0x87>
+  802388:	83 ec 0c             	sub    $0xc,%esp
+  80238b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80238e:	50                   	push   %eax
+  80238f:	e8 6a f5 ff ff       	call   8018fe <fd_alloc>
+  802394:	89 c3                	mov    %eax,%ebx
+  802396:	83 c4 10             	add    $0x10,%esp
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	78 3c                	js     8023d9 <open+0x6c>
+  80239d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a0:	a3 00 94 80 00       	mov    %eax,0x809400
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+  8023a8:	56                   	push   %esi
+  8023a9:	68 00 90 80 00       	push   $0x809000
+  8023ae:	e8 56 e8 ff ff       	call   800c09 <strcpy>
+  8023b3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023bb:	e8 a9 fa ff ff       	call   801e69 <fsipc>
+  8023c0:	89 c3                	mov    %eax,%ebx
+  8023c2:	83 c4 10             	add    $0x10,%esp
+  8023c5:	85 c0                	test   %eax,%eax
+  8023c7:	78 19                	js     8023e2 <open+0x75>
+  8023c9:	83 ec 0c             	sub    $0xc,%esp
+  8023cc:	ff 75 f4             	push   -0xc(%ebp)
+  8023cf:	e8 03 f5 ff ff       	call   8018d7 <fd2num>
+  8023d4:	89 c3                	mov    %eax,%ebx
+  8023d6:	83 c4 10             	add    $0x10,%esp
+  8023d9:	89 d8                	mov    %ebx,%eax
+  8023db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023de:	5b                   	pop    %ebx
+  8023df:	5e                   	pop    %esi
+  8023e0:	5d                   	pop    %ebp
+  8023e1:	c3                   	ret
+  8023e2:	83 ec 08             	sub    $0x8,%esp
+  8023e5:	6a 00                	push   $0x0
+  8023e7:	ff 75 f4             	push   -0xc(%ebp)
+  8023ea:	e8 05 f6 ff ff       	call   8019f4 <fd_close>
+  8023ef:	83 c4 10             	add    $0x10,%esp
+  8023f2:	eb e5                	jmp    8023d9 <open+0x6c>
+  8023f4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023f9:	eb de                	jmp    8023d9 <open+0x6c>
+
+008023fb <file_image>:
+  8023fb:	55                   	push   %ebp
+  8023fc:	89 e5                	mov    %esp,%ebp
+  8023fe:	53                   	push   %ebx
+  8023ff:	83 ec 1c             	sub    $0x1c,%esp
+  802402:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802405:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802408:	50                   	push   %eax
+  802409:	ff 75 08             	push   0x8(%ebp)
+  80240c:	e8 3d f5 ff ff       	call   80194e <fd_lookup>
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	85 c0                	test   %eax,%eax
+  802416:	78 58                	js     802470 <file_image+0x75>
+  802418:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80241b:	8b 0d 90 67 80 00    	mov    0x806790,%ecx
+  802421:	39 08                	cmp    %ecx,(%eax)
+  802423:	75 50                	jne    802475 <file_image+0x7a>
+  802425:	83 fb 04             	cmp    $0x4,%ebx
+  802428:	77 52                	ja     80247c <file_image+0x81>
+  80242a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80242d:	a3 00 90 80 00       	mov    %eax,0x809000
+  802432:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  802438:	83 ec 04             	sub    $0x4,%esp
+  80243b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80243e:	c1 e0 02             	shl    $0x2,%eax
+  802441:	50                   	push   %eax
+  802442:	ff 75 0c             	push   0xc(%ebp)
+  802445:	68 08 90 80 00       	push   $0x809008
+  80244a:	e8 6a e9 ff ff       	call   800db9 <memmove>
+  80244f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802454:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802459:	e8 0b fa ff ff       	call   801e69 <fsipc>
+  80245e:	83 c4 10             	add    $0x10,%esp
+  802461:	85 c0                	test   %eax,%eax
+  802463:	78 0b                	js     802470 <file_image+0x75>
+  802465:	8b 55 14             	mov    0x14(%ebp),%edx
+  802468:	8b 0d 08 70 80 00    	mov    0x807008,%ecx
+  80246e:	89 0a                	mov    %ecx,(%edx)
+  802470:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802473:	c9                   	leave
+  802474:	c3                   	ret
+  802475:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80247a:	eb f4                	jmp    802470 <file_image+0x75>
+  80247c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802481:	eb ed                	jmp    802470 <file_image+0x75>
+
+00802483 <remove>:
+  802483:	55                   	push   %ebp
+  802484:	89 e5                	mov    %esp,%ebp
+  802486:	53                   	push   %ebx
+  802487:	83 ec 10             	sub    $0x10,%esp
+  80248a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80248d:	53                   	push   %ebx
+  80248e:	e8 2a e7 ff ff       	call   800bbd <strlen>
+  802493:	83 c4 10             	add    $0x10,%esp
+  802496:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80249b:	7f 25                	jg     8024c2 <remove+0x3f>
+  80249d:	83 ec 08             	sub    $0x8,%esp
+  8024a0:	53                   	push   %ebx
+  8024a1:	68 00 90 80 00       	push   $0x809000
+  8024a6:	e8 5e e7 ff ff       	call   800c09 <strcpy>
+  8024ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024b5:	e8 af f9 ff ff       	call   801e69 <fsipc>
+  8024ba:	83 c4 10             	add    $0x10,%esp
+  8024bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c0:	c9                   	leave
+  8024c1:	c3                   	ret
+  8024c2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024c7:	eb f4                	jmp    8024bd <remove+0x3a>
+
+008024c9 <sync>:
+  8024c9:	55                   	push   %ebp
+  8024ca:	89 e5                	mov    %esp,%ebp
+  8024cc:	83 ec 08             	sub    $0x8,%esp
+  8024cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024d9:	e8 8b f9 ff ff       	call   801e69 <fsipc>
+  8024de:	c9                   	leave
+  8024df:	c3                   	ret
+
+008024e0 <map_segment>:
+  8024e0:	55                   	push   %ebp
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	57                   	push   %edi
+  8024e4:	56                   	push   %esi
+  8024e5:	53                   	push   %ebx
+  8024e6:	83 ec 1c             	sub    $0x1c,%esp
+  8024e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8024ec:	89 d7                	mov    %edx,%edi
+  8024ee:	89 d0                	mov    %edx,%eax
+  8024f0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024f5:	74 0a                	je     802501 <map_segment+0x21>
+  8024f7:	29 c7                	sub    %eax,%edi
+  8024f9:	01 c1                	add    %eax,%ecx
+  8024fb:	01 45 0c             	add    %eax,0xc(%ebp)
+  8024fe:	29 45 10             	sub    %eax,0x10(%ebp)
+  802501:	85 c9                	test   %ecx,%ecx
+  802503:	0f 84 fb 00 00 00    	je     802604 <map_segment+0x124>
+  802509:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80250e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802511:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802514:	e9 a6 00 00 00       	jmp    8025bf <map_segment+0xdf>
+  802519:	83 ec 04             	sub    $0x4,%esp
+  80251c:	6a 07                	push   $0x7
+  80251e:	68 00 00 40 00       	push   $0x400000
+  802523:	6a 00                	push   $0x0
+  802525:	e8 3f eb ff ff       	call   801069 <sys_page_alloc>
+  80252a:	83 c4 10             	add    $0x10,%esp
+  80252d:	85 c0                	test   %eax,%eax
+  80252f:	0f 88 c7 00 00 00    	js     8025fc <map_segment+0x11c>
+  802535:	83 ec 08             	sub    $0x8,%esp
+  802538:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80253b:	03 45 10             	add    0x10(%ebp),%eax
+  80253e:	50                   	push   %eax
+  80253f:	ff 75 08             	push   0x8(%ebp)
+  802542:	e8 c6 f7 ff ff       	call   801d0d <seek>
+  802547:	83 c4 10             	add    $0x10,%esp
+  80254a:	85 c0                	test   %eax,%eax
+  80254c:	0f 88 aa 00 00 00    	js     8025fc <map_segment+0x11c>
+  802552:	83 ec 04             	sub    $0x4,%esp
+  802555:	89 f2                	mov    %esi,%edx
+  802557:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80255a:	29 ca                	sub    %ecx,%edx
+  80255c:	89 d0                	mov    %edx,%eax
+  80255e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802563:	39 d0                	cmp    %edx,%eax
+  802565:	0f 47 c2             	cmova  %edx,%eax
+  802568:	50                   	push   %eax
+  802569:	68 00 00 40 00       	push   $0x400000
+  80256e:	ff 75 08             	push   0x8(%ebp)
+  802571:	e8 c1 f6 ff ff       	call   801c37 <readn>
+  802576:	83 c4 10             	add    $0x10,%esp
+  802579:	85 c0                	test   %eax,%eax
+  80257b:	78 7f                	js     8025fc <map_segment+0x11c>
+  80257d:	83 ec 0c             	sub    $0xc,%esp
+  802580:	ff 75 14             	push   0x14(%ebp)
+  802583:	57                   	push   %edi
+  802584:	ff 75 e0             	push   -0x20(%ebp)
+  802587:	68 00 00 40 00       	push   $0x400000
+  80258c:	6a 00                	push   $0x0
+  80258e:	e8 19 eb ff ff       	call   8010ac <sys_page_map>
+  802593:	83 c4 20             	add    $0x20,%esp
+  802596:	85 c0                	test   %eax,%eax
+  802598:	78 48                	js     8025e2 <map_segment+0x102>
+  80259a:	83 ec 08             	sub    $0x8,%esp
+  80259d:	68 00 00 40 00       	push   $0x400000
+  8025a2:	6a 00                	push   $0x0
+  8025a4:	e8 92 eb ff ff       	call   80113b <sys_page_unmap>
+  8025a9:	83 c4 10             	add    $0x10,%esp
+  8025ac:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025b2:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8025b8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025bb:	39 c3                	cmp    %eax,%ebx
+  8025bd:	73 38                	jae    8025f7 <map_segment+0x117>
+  8025bf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025c2:	39 f3                	cmp    %esi,%ebx
+  8025c4:	0f 82 4f ff ff ff    	jb     802519 <map_segment+0x39>
+  8025ca:	83 ec 04             	sub    $0x4,%esp
+  8025cd:	ff 75 14             	push   0x14(%ebp)
+  8025d0:	57                   	push   %edi
+  8025d1:	ff 75 e0             	push   -0x20(%ebp)
+  8025d4:	e8 90 ea ff ff       	call   801069 <sys_page_alloc>
+  8025d9:	83 c4 10             	add    $0x10,%esp
+  8025dc:	85 c0                	test   %eax,%eax
+  8025de:	79 cc                	jns    8025ac <map_segment+0xcc>
+  8025e0:	eb 1a                	jmp    8025fc <map_segment+0x11c>
+  8025e2:	50                   	push   %eax
+  8025e3:	68 a8 47 80 00       	push   $0x8047a8
+  8025e8:	68 75 01 00 00       	push   $0x175
+  8025ed:	68 c5 47 80 00       	push   $0x8047c5
+  8025f2:	e8 40 de ff ff       	call   800437 <_panic>
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ff:	5b                   	pop    %ebx
+  802600:	5e                   	pop    %esi
+  802601:	5f                   	pop    %edi
+  802602:	5d                   	pop    %ebp
+  802603:	c3                   	ret
+  802604:	b8 00 00 00 00       	mov    $0x0,%eax
+  802609:	eb f1                	jmp    8025fc <map_segment+0x11c>
+
+0080260b <execv>:
+  80260b:	55                   	push   %ebp
+  80260c:	89 e5                	mov    %esp,%ebp
+  80260e:	57                   	push   %edi
+  80260f:	56                   	push   %esi
+  802610:	53                   	push   %ebx
+  802611:	81 ec d4 02 00 00    	sub    $0x2d4,%esp
+  802617:	6a 00                	push   $0x0
+  802619:	ff 75 08             	push   0x8(%ebp)
+  80261c:	e8 4c fd ff ff       	call   80236d <open>
+  802621:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802627:	83 c4 10             	add    $0x10,%esp
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	0f 88 ea 05 00 00    	js     802c1c <execv+0x611>
+  802632:	89 c6                	mov    %eax,%esi
+  802634:	83 ec 04             	sub    $0x4,%esp
+  802637:	68 00 02 00 00       	push   $0x200
+  80263c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802642:	50                   	push   %eax
+  802643:	56                   	push   %esi
+  802644:	e8 ee f5 ff ff       	call   801c37 <readn>
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802651:	0f 85 e1 01 00 00    	jne    802838 <execv+0x22d>
+  802657:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80265e:	45 4c 46 
+  802661:	0f 85 d1 01 00 00    	jne    802838 <execv+0x22d>
+  802667:	b8 07 00 00 00       	mov    $0x7,%eax
+  80266c:	cd 30                	int    $0x30
+  80266e:	89 85 40 fd ff ff    	mov    %eax,-0x2c0(%ebp)
+  802674:	85 c0                	test   %eax,%eax
+  802676:	0f 88 94 05 00 00    	js     802c10 <execv+0x605>
+  80267c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802681:	69 f0 ac 01 00 00    	imul   $0x1ac,%eax,%esi
+  802687:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80268d:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802693:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802698:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80269a:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8026a0:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8026a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026a9:	8b 00                	mov    (%eax),%eax
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	0f 84 ad 05 00 00    	je     802c60 <execv+0x655>
+  8026b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8026c0:	83 ec 0c             	sub    $0xc,%esp
+  8026c3:	50                   	push   %eax
+  8026c4:	e8 f4 e4 ff ff       	call   800bbd <strlen>
+  8026c9:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  8026cd:	89 d9                	mov    %ebx,%ecx
+  8026cf:	83 c3 01             	add    $0x1,%ebx
+  8026d2:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%ebp)
+  8026d8:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  8026df:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8026e2:	83 c4 10             	add    $0x10,%esp
+  8026e5:	85 c0                	test   %eax,%eax
+  8026e7:	75 d7                	jne    8026c0 <execv+0xb5>
+  8026e9:	89 95 2c fd ff ff    	mov    %edx,-0x2d4(%ebp)
+  8026ef:	89 8d 30 fd ff ff    	mov    %ecx,-0x2d0(%ebp)
+  8026f5:	be 00 10 40 00       	mov    $0x401000,%esi
+  8026fa:	29 fe                	sub    %edi,%esi
+  8026fc:	89 f2                	mov    %esi,%edx
+  8026fe:	83 e2 fc             	and    $0xfffffffc,%edx
+  802701:	8d 04 8d 08 00 00 00 	lea    0x8(,%ecx,4),%eax
+  802708:	89 d7                	mov    %edx,%edi
+  80270a:	29 c7                	sub    %eax,%edi
+  80270c:	8d 47 f8             	lea    -0x8(%edi),%eax
+  80270f:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802714:	0f 86 1f 05 00 00    	jbe    802c39 <execv+0x62e>
+  80271a:	83 ec 04             	sub    $0x4,%esp
+  80271d:	6a 07                	push   $0x7
+  80271f:	68 00 00 40 00       	push   $0x400000
+  802724:	6a 00                	push   $0x0
+  802726:	e8 3e e9 ff ff       	call   801069 <sys_page_alloc>
+  80272b:	83 c4 10             	add    $0x10,%esp
+  80272e:	85 c0                	test   %eax,%eax
+  802730:	0f 88 08 05 00 00    	js     802c3e <execv+0x633>
+  802736:	85 db                	test   %ebx,%ebx
+  802738:	7e 58                	jle    802792 <execv+0x187>
+  80273a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80273f:	89 bd 34 fd ff ff    	mov    %edi,-0x2cc(%ebp)
+  802745:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802748:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+  80274e:	8d 86 00 d0 3f ee    	lea    -0x11c03000(%esi),%eax
+  802754:	8b 8d 34 fd ff ff    	mov    -0x2cc(%ebp),%ecx
+  80275a:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+  80275d:	83 ec 08             	sub    $0x8,%esp
+  802760:	ff 34 9f             	push   (%edi,%ebx,4)
+  802763:	56                   	push   %esi
+  802764:	e8 a0 e4 ff ff       	call   800c09 <strcpy>
+  802769:	83 c4 04             	add    $0x4,%esp
+  80276c:	ff 34 9f             	push   (%edi,%ebx,4)
+  80276f:	e8 49 e4 ff ff       	call   800bbd <strlen>
+  802774:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  802778:	83 c3 01             	add    $0x1,%ebx
+  80277b:	83 c4 10             	add    $0x10,%esp
+  80277e:	8b 8d 3c fd ff ff    	mov    -0x2c4(%ebp),%ecx
+  802784:	39 8d 30 fd ff ff    	cmp    %ecx,-0x2d0(%ebp)
+  80278a:	75 bc                	jne    802748 <execv+0x13d>
+  80278c:	8b bd 34 fd ff ff    	mov    -0x2cc(%ebp),%edi
+  802792:	8b 85 2c fd ff ff    	mov    -0x2d4(%ebp),%eax
+  802798:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+  80279f:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  8027a5:	0f 85 c5 00 00 00    	jne    802870 <execv+0x265>
+  8027ab:	8d 87 00 d0 3f ee    	lea    -0x11c03000(%edi),%eax
+  8027b1:	89 47 fc             	mov    %eax,-0x4(%edi)
+  8027b4:	8b 85 38 fd ff ff    	mov    -0x2c8(%ebp),%eax
+  8027ba:	89 47 f8             	mov    %eax,-0x8(%edi)
+  8027bd:	8d 87 f8 cf 3f ee    	lea    -0x11c03008(%edi),%eax
+  8027c3:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  8027c9:	83 ec 0c             	sub    $0xc,%esp
+  8027cc:	6a 07                	push   $0x7
+  8027ce:	68 00 d0 7f ee       	push   $0xee7fd000
+  8027d3:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8027d9:	68 00 00 40 00       	push   $0x400000
+  8027de:	6a 00                	push   $0x0
+  8027e0:	e8 c7 e8 ff ff       	call   8010ac <sys_page_map>
+  8027e5:	89 c3                	mov    %eax,%ebx
+  8027e7:	83 c4 20             	add    $0x20,%esp
+  8027ea:	85 c0                	test   %eax,%eax
+  8027ec:	0f 88 54 04 00 00    	js     802c46 <execv+0x63b>
+  8027f2:	83 ec 08             	sub    $0x8,%esp
+  8027f5:	68 00 00 40 00       	push   $0x400000
+  8027fa:	6a 00                	push   $0x0
+  8027fc:	e8 3a e9 ff ff       	call   80113b <sys_page_unmap>
+  802801:	89 c3                	mov    %eax,%ebx
+  802803:	83 c4 10             	add    $0x10,%esp
+  802806:	85 c0                	test   %eax,%eax
+  802808:	0f 88 38 04 00 00    	js     802c46 <execv+0x63b>
+  80280e:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802814:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+  80281b:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  802822:	00 
+  802823:	0f 84 01 04 00 00    	je     802c2a <execv+0x61f>
+  802829:	be 00 00 00 00       	mov    $0x0,%esi
+  80282e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802833:	e9 88 00 00 00       	jmp    8028c0 <execv+0x2b5>
+  802838:	83 ec 0c             	sub    $0xc,%esp
+  80283b:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802841:	e8 2e f2 ff ff       	call   801a74 <close>
+  802846:	83 c4 0c             	add    $0xc,%esp
+  802849:	68 7f 45 4c 46       	push   $0x464c457f
+  80284e:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802854:	68 d1 47 80 00       	push   $0x8047d1
+  802859:	e8 b4 dc ff ff       	call   800512 <cprintf>
+  80285e:	83 c4 10             	add    $0x10,%esp
+  802861:	c7 85 44 fd ff ff f2 	movl   $0xfffffff2,-0x2bc(%ebp)
+  802868:	ff ff ff 
+  80286b:	e9 ac 03 00 00       	jmp    802c1c <execv+0x611>
+  802870:	68 58 48 80 00       	push   $0x804858
+  802875:	68 eb 47 80 00       	push   $0x8047eb
+  80287a:	68 41 01 00 00       	push   $0x141
+  80287f:	68 c5 47 80 00       	push   $0x8047c5
+  802884:	e8 ae db ff ff       	call   800437 <_panic>
+  802889:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  80288c:	50                   	push   %eax
+  80288d:	ff 73 04             	push   0x4(%ebx)
+  802890:	ff 73 10             	push   0x10(%ebx)
+  802893:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802899:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  80289f:	e8 3c fc ff ff       	call   8024e0 <map_segment>
+  8028a4:	83 c4 10             	add    $0x10,%esp
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	0f 88 34 03 00 00    	js     802be3 <execv+0x5d8>
+  8028af:	83 c7 01             	add    $0x1,%edi
+  8028b2:	83 c3 20             	add    $0x20,%ebx
+  8028b5:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8028bc:	39 f8                	cmp    %edi,%eax
+  8028be:	7e 5d                	jle    80291d <execv+0x312>
+  8028c0:	83 3b 01             	cmpl   $0x1,(%ebx)
+  8028c3:	75 ea                	jne    8028af <execv+0x2a4>
+  8028c5:	8b 43 18             	mov    0x18(%ebx),%eax
+  8028c8:	83 e0 02             	and    $0x2,%eax
+  8028cb:	83 f8 01             	cmp    $0x1,%eax
+  8028ce:	19 c0                	sbb    %eax,%eax
+  8028d0:	83 e0 fe             	and    $0xfffffffe,%eax
+  8028d3:	83 c0 07             	add    $0x7,%eax
+  8028d6:	8b 53 08             	mov    0x8(%ebx),%edx
+  8028d9:	81 fa ff ff 7f 00    	cmp    $0x7fffff,%edx
+  8028df:	76 a8                	jbe    802889 <execv+0x27e>
+  8028e1:	83 fe 03             	cmp    $0x3,%esi
+  8028e4:	7f a3                	jg     802889 <execv+0x27e>
+  8028e6:	8d 0c b6             	lea    (%esi,%esi,4),%ecx
+  8028e9:	c1 e1 02             	shl    $0x2,%ecx
+  8028ec:	89 94 0d 54 fd ff ff 	mov    %edx,-0x2ac(%ebp,%ecx,1)
+  8028f3:	8b 53 14             	mov    0x14(%ebx),%edx
+  8028f6:	89 94 0d 58 fd ff ff 	mov    %edx,-0x2a8(%ebp,%ecx,1)
+  8028fd:	8b 53 10             	mov    0x10(%ebx),%edx
+  802900:	89 94 0d 5c fd ff ff 	mov    %edx,-0x2a4(%ebp,%ecx,1)
+  802907:	8b 53 04             	mov    0x4(%ebx),%edx
+  80290a:	89 94 0d 60 fd ff ff 	mov    %edx,-0x2a0(%ebp,%ecx,1)
+  802911:	89 84 0d 64 fd ff ff 	mov    %eax,-0x29c(%ebp,%ecx,1)
+  802918:	83 c6 01             	add    $0x1,%esi
+  80291b:	eb 92                	jmp    8028af <execv+0x2a4>
+  80291d:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802924:	00 00 00 
+  802927:	85 f6                	test   %esi,%esi
+  802929:	7f 12                	jg     80293d <execv+0x332>
+  80292b:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802931:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  802938:	00 00 00 
+  80293b:	eb 7e                	jmp    8029bb <execv+0x3b0>
+  80293d:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  802943:	50                   	push   %eax
+  802944:	56                   	push   %esi
+  802945:	8d 85 54 fd ff ff    	lea    -0x2ac(%ebp),%eax
+  80294b:	50                   	push   %eax
+  80294c:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802952:	e8 a4 fa ff ff       	call   8023fb <file_image>
+  802957:	89 85 3c fd ff ff    	mov    %eax,-0x2c4(%ebp)
+  80295d:	83 c4 10             	add    $0x10,%esp
+  802960:	85 c0                	test   %eax,%eax
+  802962:	0f 88 9e 00 00 00    	js     802a06 <execv+0x3fb>
+  802968:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  80296e:	85 c0                	test   %eax,%eax
+  802970:	75 49                	jne    8029bb <execv+0x3b0>
+  802972:	8d 9d 54 fd ff ff    	lea    -0x2ac(%ebp),%ebx
+  802978:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297d:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  802980:	8b 13                	mov    (%ebx),%edx
+  802982:	ff 73 10             	push   0x10(%ebx)
+  802985:	ff 73 0c             	push   0xc(%ebx)
+  802988:	ff 73 08             	push   0x8(%ebx)
+  80298b:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802991:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802997:	e8 44 fb ff ff       	call   8024e0 <map_segment>
+  80299c:	83 c4 10             	add    $0x10,%esp
+  80299f:	85 c0                	test   %eax,%eax
+  8029a1:	0f 88 65 02 00 00    	js     802c0c <execv+0x601>
+  8029a7:	83 c7 01             	add    $0x1,%edi
+  8029aa:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  8029b0:	83 c3 14             	add    $0x14,%ebx
+  8029b3:	39 fe                	cmp    %edi,%esi
+  8029b5:	7e 04                	jle    8029bb <execv+0x3b0>
+  8029b7:	85 c0                	test   %eax,%eax
+  8029b9:	74 c2                	je     80297d <execv+0x372>
+  8029bb:	83 ec 04             	sub    $0x4,%esp
+  8029be:	ff b5 3c fd ff ff    	push   -0x2c4(%ebp)
+  8029c4:	50                   	push   %eax
+  8029c5:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8029cb:	e8 82 ee ff ff       	call   801852 <sys_env_set_pager>
+  8029d0:	89 c7                	mov    %eax,%edi
+  8029d2:	83 c4 10             	add    $0x10,%esp
+  8029d5:	85 c0                	test   %eax,%eax
+  8029d7:	0f 88 08 02 00 00    	js     802be5 <execv+0x5da>
+  8029dd:	83 ec 0c             	sub    $0xc,%esp
+  8029e0:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8029e6:	e8 89 f0 ff ff       	call   801a74 <close>
+  8029eb:	e8 2d 0f 00 00       	call   80391d <dupq_begin>
+  8029f0:	89 c7                	mov    %eax,%edi
+  8029f2:	83 c4 10             	add    $0x10,%esp
+  8029f5:	89 c1                	mov    %eax,%ecx
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	0f 88 91 00 00 00    	js     802a90 <execv+0x485>
+  8029ff:	be 02 00 00 00       	mov    $0x2,%esi
+  802a04:	eb 33                	jmp    802a39 <execv+0x42e>
+  802a06:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802a0d:	00 00 00 
+  802a10:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  802a17:	00 00 00 
+  802a1a:	e9 53 ff ff ff       	jmp    802972 <execv+0x367>
+  802a1f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802a26:	a8 01                	test   $0x1,%al
+  802a28:	75 7b                	jne    802aa5 <execv+0x49a>
+  802a2a:	83 c6 01             	add    $0x1,%esi
+  802a2d:	81 fe ba 03 00 00    	cmp    $0x3ba,%esi
+  802a33:	0f 84 e5 00 00 00    	je     802b1e <execv+0x513>
+  802a39:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802a40:	a8 01                	test   $0x1,%al
+  802a42:	74 db                	je     802a1f <execv+0x414>
+  802a44:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802a4b:	a8 80                	test   $0x80,%al
+  802a4d:	74 d0                	je     802a1f <execv+0x414>
+  802a4f:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802a56:	f6 c4 04             	test   $0x4,%ah
+  802a59:	74 cf                	je     802a2a <execv+0x41f>
+  802a5b:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802a62:	25 07 0e 00 00       	and    $0xe07,%eax
+  802a67:	0c 80                	or     $0x80,%al
+  802a69:	50                   	push   %eax
+  802a6a:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802a70:	89 f0                	mov    %esi,%eax
+  802a72:	c1 e0 16             	shl    $0x16,%eax
+  802a75:	c1 e8 0c             	shr    $0xc,%eax
+  802a78:	50                   	push   %eax
+  802a79:	6a 00                	push   $0x0
+  802a7b:	e8 bd 0e 00 00       	call   80393d <dupq_map>
+  802a80:	89 c1                	mov    %eax,%ecx
+  802a82:	83 c4 10             	add    $0x10,%esp
+  802a85:	85 c0                	test   %eax,%eax
+  802a87:	79 a1                	jns    802a2a <execv+0x41f>
+  802a89:	89 c7                	mov    %eax,%edi
+  802a8b:	e8 10 0f 00 00       	call   8039a0 <dupq_end>
+  802a90:	57                   	push   %edi
+  802a91:	68 00 48 80 00       	push   $0x804800
+  802a96:	68 ac 00 00 00       	push   $0xac
+  802a9b:	68 c5 47 80 00       	push   $0x8047c5
+  802aa0:	e8 92 d9 ff ff       	call   800437 <_panic>
+  802aa5:	89 f7                	mov    %esi,%edi
+  802aa7:	c1 e7 16             	shl    $0x16,%edi
+  802aaa:	89 f8                	mov    %edi,%eax
+  802aac:	c1 e8 0c             	shr    $0xc,%eax
+  802aaf:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802ab4:	eb 24                	jmp    802ada <execv+0x4cf>
+  802ab6:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802abc:	0f 84 68 ff ff ff    	je     802a2a <execv+0x41f>
+  802ac2:	89 d8                	mov    %ebx,%eax
+  802ac4:	09 f8                	or     %edi,%eax
+  802ac6:	c1 e8 0c             	shr    $0xc,%eax
+  802ac9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802acf:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  802ad4:	0f 84 50 ff ff ff    	je     802a2a <execv+0x41f>
+  802ada:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802ae1:	f6 c2 01             	test   $0x1,%dl
+  802ae4:	74 d0                	je     802ab6 <execv+0x4ab>
+  802ae6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802aed:	f6 c6 04             	test   $0x4,%dh
+  802af0:	74 c4                	je     802ab6 <execv+0x4ab>
+  802af2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802af9:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802aff:	52                   	push   %edx
+  802b00:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802b06:	50                   	push   %eax
+  802b07:	6a 00                	push   $0x0
+  802b09:	e8 2f 0e 00 00       	call   80393d <dupq_map>
+  802b0e:	89 c1                	mov    %eax,%ecx
+  802b10:	83 c4 10             	add    $0x10,%esp
+  802b13:	85 c0                	test   %eax,%eax
+  802b15:	79 9f                	jns    802ab6 <execv+0x4ab>
+  802b17:	89 c7                	mov    %eax,%edi
+  802b19:	e9 6d ff ff ff       	jmp    802a8b <execv+0x480>
+  802b1e:	89 cf                	mov    %ecx,%edi
+  802b20:	85 c9                	test   %ecx,%ecx
+  802b22:	0f 88 63 ff ff ff    	js     802a8b <execv+0x480>
+  802b28:	e8 73 0e 00 00       	call   8039a0 <dupq_end>
+  802b2d:	89 c7                	mov    %eax,%edi
+  802b2f:	85 c0                	test   %eax,%eax
+  802b31:	0f 88 59 ff ff ff    	js     802a90 <execv+0x485>
+  802b37:	83 ec 08             	sub    $0x8,%esp
+  802b3a:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802b40:	50                   	push   %eax
+  802b41:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802b47:	e8 92 e6 ff ff       	call   8011de <sys_env_set_trapframe>
+  802b4c:	83 c4 10             	add    $0x10,%esp
+  802b4f:	85 c0                	test   %eax,%eax
+  802b51:	78 2e                	js     802b81 <execv+0x576>
+  802b53:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b57:	74 52                	je     802bab <execv+0x5a0>
+  802b59:	83 ec 08             	sub    $0x8,%esp
+  802b5c:	6a 02                	push   $0x2
+  802b5e:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802b64:	e8 33 e6 ff ff       	call   80119c <sys_env_set_status>
+  802b69:	83 c4 10             	add    $0x10,%esp
+  802b6c:	85 c0                	test   %eax,%eax
+  802b6e:	78 26                	js     802b96 <execv+0x58b>
+  802b70:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802b76:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802b7c:	e9 9b 00 00 00       	jmp    802c1c <execv+0x611>
+  802b81:	50                   	push   %eax
+  802b82:	68 16 48 80 00       	push   $0x804816
+  802b87:	68 af 00 00 00       	push   $0xaf
+  802b8c:	68 c5 47 80 00       	push   $0x8047c5
+  802b91:	e8 a1 d8 ff ff       	call   800437 <_panic>
+  802b96:	50                   	push   %eax
+  802b97:	68 30 48 80 00       	push   $0x804830
+  802b9c:	68 b3 00 00 00       	push   $0xb3
+  802ba1:	68 c5 47 80 00       	push   $0x8047c5
+  802ba6:	e8 8c d8 ff ff       	call   800437 <_panic>
+  802bab:	83 ec 0c             	sub    $0xc,%esp
+  802bae:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802bb4:	e8 c3 e8 ff ff       	call   80147c <sys_env_swap>
+  802bb9:	83 c4 10             	add    $0x10,%esp
+  802bbc:	85 c0                	test   %eax,%eax
+  802bbe:	78 0e                	js     802bce <execv+0x5c3>
+  802bc0:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802bc6:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802bcc:	eb 4e                	jmp    802c1c <execv+0x611>
+  802bce:	50                   	push   %eax
+  802bcf:	68 47 48 80 00       	push   $0x804847
+  802bd4:	68 ba 00 00 00       	push   $0xba
+  802bd9:	68 c5 47 80 00       	push   $0x8047c5
+  802bde:	e8 54 d8 ff ff       	call   800437 <_panic>
+  802be3:	89 c7                	mov    %eax,%edi
+  802be5:	83 ec 0c             	sub    $0xc,%esp
+  802be8:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802bee:	e8 cb e3 ff ff       	call   800fbe <sys_env_destroy>
+  802bf3:	83 c4 04             	add    $0x4,%esp
+  802bf6:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802bfc:	e8 73 ee ff ff       	call   801a74 <close>
+  802c01:	83 c4 10             	add    $0x10,%esp
+  802c04:	89 bd 44 fd ff ff    	mov    %edi,-0x2bc(%ebp)
+  802c0a:	eb 10                	jmp    802c1c <execv+0x611>
+  802c0c:	89 c7                	mov    %eax,%edi
+  802c0e:	eb d5                	jmp    802be5 <execv+0x5da>
+  802c10:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802c16:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802c1c:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  802c22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c25:	5b                   	pop    %ebx
+  802c26:	5e                   	pop    %esi
+  802c27:	5f                   	pop    %edi
+  802c28:	5d                   	pop    %ebp
+  802c29:	c3                   	ret
+  802c2a:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802c31:	00 00 00 
+  802c34:	e9 f2 fc ff ff       	jmp    80292b <execv+0x320>
+  802c39:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802c3e:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802c44:	eb d6                	jmp    802c1c <execv+0x611>
+  802c46:	83 ec 08             	sub    $0x8,%esp
+  802c49:	68 00 00 40 00       	push   $0x400000
+  802c4e:	6a 00                	push   $0x0
+  802c50:	e8 e6 e4 ff ff       	call   80113b <sys_page_unmap>
+  802c55:	83 c4 10             	add    $0x10,%esp
+  802c58:	89 9d 44 fd ff ff    	mov    %ebx,-0x2bc(%ebp)
+  802c5e:	eb bc                	jmp    802c1c <execv+0x611>
+  802c60:	83 ec 04             	sub    $0x4,%esp
+  802c63:	6a 07                	push   $0x7
+  802c65:	68 00 00 40 00       	push   $0x400000
+  802c6a:	6a 00                	push   $0x0
+  802c6c:	e8 f8 e3 ff ff       	call   801069 <sys_page_alloc>
+  802c71:	83 c4 10             	add    $0x10,%esp
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	78 c6                	js     802c3e <execv+0x633>
+  802c78:	c7 85 2c fd ff ff 00 	movl   $0x0,-0x2d4(%ebp)
+  802c7f:	00 00 00 
+  802c82:	c7 85 38 fd ff ff 00 	movl   $0x0,-0x2c8(%ebp)
+  802c89:	00 00 00 
+  802c8c:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+  802c91:	be 00 10 40 00       	mov    $0x401000,%esi
+  802c96:	e9 f7 fa ff ff       	jmp    802792 <execv+0x187>
+
+00802c9b <spawn>:
+  802c9b:	55                   	push   %ebp
+  802c9c:	89 e5                	mov    %esp,%ebp
+  802c9e:	83 ec 0c             	sub    $0xc,%esp
+  802ca1:	6a 01                	push   $0x1
+  802ca3:	ff 75 0c             	push   0xc(%ebp)
+  802ca6:	ff 75 08             	push   0x8(%ebp)
+  802ca9:	e8 5d f9 ff ff       	call   80260b <execv>
+  802cae:	c9                   	leave
+  802caf:	c3                   	ret
+
+00802cb0 <exec>:
+  802cb0:	55                   	push   %ebp
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	83 ec 0c             	sub    $0xc,%esp
+  802cb6:	6a 00                	push   $0x0
+  802cb8:	ff 75 0c             	push   0xc(%ebp)
+  802cbb:	ff 75 08             	push   0x8(%ebp)
+  802cbe:	e8 48 f9 ff ff       	call   80260b <execv>
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+
+00802cc5 <spawnl>:
+  802cc5:	55                   	push   %ebp
+  802cc6:	89 e5                	mov    %esp,%ebp
+  802cc8:	56                   	push   %esi
+  802cc9:	53                   	push   %ebx
+  802cca:	8d 45 10             	lea    0x10(%ebp),%eax
+  802ccd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cd2:	eb 05                	jmp    802cd9 <spawnl+0x14>
+  802cd4:	83 c1 01             	add    $0x1,%ecx
+  802cd7:	89 d0                	mov    %edx,%eax
+  802cd9:	8d 50 04             	lea    0x4(%eax),%edx
+  802cdc:	83 38 00             	cmpl   $0x0,(%eax)
+  802cdf:	75 f3                	jne    802cd4 <spawnl+0xf>
+  802ce1:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802ce8:	83 e0 f0             	and    $0xfffffff0,%eax
+  802ceb:	29 c4                	sub    %eax,%esp
+  802ced:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802cf1:	89 d8                	mov    %ebx,%eax
+  802cf3:	c1 e8 02             	shr    $0x2,%eax
+  802cf6:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802cf9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802cfc:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802d03:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802d0a:	00 
+  802d0b:	8d 55 10             	lea    0x10(%ebp),%edx
+  802d0e:	89 ce                	mov    %ecx,%esi
+  802d10:	85 c9                	test   %ecx,%ecx
+  802d12:	74 16                	je     802d2a <spawnl+0x65>
+  802d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d19:	83 c0 01             	add    $0x1,%eax
+  802d1c:	89 d1                	mov    %edx,%ecx
+  802d1e:	83 c2 04             	add    $0x4,%edx
+  802d21:	8b 09                	mov    (%ecx),%ecx
+  802d23:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802d26:	39 f0                	cmp    %esi,%eax
+  802d28:	75 ef                	jne    802d19 <spawnl+0x54>
+  802d2a:	83 ec 08             	sub    $0x8,%esp
+  802d2d:	53                   	push   %ebx
+  802d2e:	ff 75 08             	push   0x8(%ebp)
+  802d31:	e8 65 ff ff ff       	call   802c9b <spawn>
+  802d36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d39:	5b                   	pop    %ebx
+  802d3a:	5e                   	pop    %esi
+  802d3b:	5d                   	pop    %ebp
+  802d3c:	c3                   	ret
+
+00802d3d <execl>:
+  802d3d:	55                   	push   %ebp
+  802d3e:	89 e5                	mov    %esp,%ebp
+  802d40:	56                   	push   %esi
+  802d41:	53                   	push   %ebx
+  802d42:	8d 45 10             	lea    0x10(%ebp),%eax
+  802d45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d4a:	eb 05                	jmp    802d51 <execl+0x14>
+  802d4c:	83 c1 01             	add    $0x1,%ecx
+  802d4f:	89 d0                	mov    %edx,%eax
+  802d51:	8d 50 04             	lea    0x4(%eax),%edx
+  802d54:	83 38 00             	cmpl   $0x0,(%eax)
+  802d57:	75 f3                	jne    802d4c <execl+0xf>
+  802d59:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802d60:	83 e0 f0             	and    $0xfffffff0,%eax
+  802d63:	29 c4                	sub    %eax,%esp
+  802d65:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802d69:	89 d8                	mov    %ebx,%eax
+  802d6b:	c1 e8 02             	shr    $0x2,%eax
+  802d6e:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802d71:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d74:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802d7b:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802d82:	00 
+  802d83:	8d 55 10             	lea    0x10(%ebp),%edx
+  802d86:	89 ce                	mov    %ecx,%esi
+  802d88:	85 c9                	test   %ecx,%ecx
+  802d8a:	74 16                	je     802da2 <execl+0x65>
+  802d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d91:	83 c0 01             	add    $0x1,%eax
+  802d94:	89 d1                	mov    %edx,%ecx
+  802d96:	83 c2 04             	add    $0x4,%edx
+  802d99:	8b 09                	mov    (%ecx),%ecx
+  802d9b:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802d9e:	39 f0                	cmp    %esi,%eax
+  802da0:	75 ef                	jne    802d91 <execl+0x54>
+  802da2:	83 ec 08             	sub    $0x8,%esp
+  802da5:	53                   	push   %ebx
+  802da6:	ff 75 08             	push   0x8(%ebp)
+  802da9:	e8 02 ff ff ff       	call   802cb0 <exec>
+  802dae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802db1:	5b                   	pop    %ebx
+  802db2:	5e                   	pop    %esi
+  802db3:	5d                   	pop    %ebp
+  802db4:	c3                   	ret
+
+00802db5 <devsock_stat>:
+  802db5:	55                   	push   %ebp
+  802db6:	89 e5                	mov    %esp,%ebp
+  802db8:	83 ec 10             	sub    $0x10,%esp
+  802dbb:	68 7e 48 80 00       	push   $0x80487e
+  802dc0:	ff 75 0c             	push   0xc(%ebp)
+  802dc3:	e8 41 de ff ff       	call   800c09 <strcpy>
+  802dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcd:	c9                   	leave
+  802dce:	c3                   	ret
+
+00802dcf <devsock_close>:
+  802dcf:	55                   	push   %ebp
+  802dd0:	89 e5                	mov    %esp,%ebp
+  802dd2:	53                   	push   %ebx
+  802dd3:	83 ec 10             	sub    $0x10,%esp
+  802dd6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802dd9:	53                   	push   %ebx
+  802dda:	e8 a3 11 00 00       	call   803f82 <pageref>
+  802ddf:	89 c2                	mov    %eax,%edx
+  802de1:	83 c4 10             	add    $0x10,%esp
+  802de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de9:	83 fa 01             	cmp    $0x1,%edx
+  802dec:	74 05                	je     802df3 <devsock_close+0x24>
+  802dee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df1:	c9                   	leave
+  802df2:	c3                   	ret
+  802df3:	83 ec 0c             	sub    $0xc,%esp
+  802df6:	ff 73 0c             	push   0xc(%ebx)
+  802df9:	e8 aa 02 00 00       	call   8030a8 <nsipc_close>
+  802dfe:	83 c4 10             	add    $0x10,%esp
+  802e01:	eb eb                	jmp    802dee <devsock_close+0x1f>
+
+00802e03 <devsock_write>:
+  802e03:	55                   	push   %ebp
+  802e04:	89 e5                	mov    %esp,%ebp
+  802e06:	83 ec 08             	sub    $0x8,%esp
+  802e09:	6a 00                	push   $0x0
+  802e0b:	ff 75 10             	push   0x10(%ebp)
+  802e0e:	ff 75 0c             	push   0xc(%ebp)
+  802e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e14:	ff 70 0c             	push   0xc(%eax)
+  802e17:	e8 6c 03 00 00       	call   803188 <nsipc_send>
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+
+00802e1e <devsock_read>:
+  802e1e:	55                   	push   %ebp
+  802e1f:	89 e5                	mov    %esp,%ebp
+  802e21:	83 ec 08             	sub    $0x8,%esp
+  802e24:	6a 00                	push   $0x0
+  802e26:	ff 75 10             	push   0x10(%ebp)
+  802e29:	ff 75 0c             	push   0xc(%ebp)
+  802e2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2f:	ff 70 0c             	push   0xc(%eax)
+  802e32:	e8 e2 02 00 00       	call   803119 <nsipc_recv>
+  802e37:	c9                   	leave
+  802e38:	c3                   	ret
+
+00802e39 <fd2sockid>:
+  802e39:	55                   	push   %ebp
+  802e3a:	89 e5                	mov    %esp,%ebp
+  802e3c:	83 ec 20             	sub    $0x20,%esp
+  802e3f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802e42:	52                   	push   %edx
+  802e43:	50                   	push   %eax
+  802e44:	e8 05 eb ff ff       	call   80194e <fd_lookup>
+  802e49:	83 c4 10             	add    $0x10,%esp
+  802e4c:	85 c0                	test   %eax,%eax
+  802e4e:	78 10                	js     802e60 <fd2sockid+0x27>
+  802e50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e53:	8b 0d ac 67 80 00    	mov    0x8067ac,%ecx
+  802e59:	39 08                	cmp    %ecx,(%eax)
+  802e5b:	75 05                	jne    802e62 <fd2sockid+0x29>
+  802e5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802e60:	c9                   	leave
+  802e61:	c3                   	ret
+  802e62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e67:	eb f7                	jmp    802e60 <fd2sockid+0x27>
+
+00802e69 <alloc_sockfd>:
+  802e69:	55                   	push   %ebp
+  802e6a:	89 e5                	mov    %esp,%ebp
+  802e6c:	56                   	push   %esi
+  802e6d:	53                   	push   %ebx
+  802e6e:	83 ec 1c             	sub    $0x1c,%esp
+  802e71:	89 c6                	mov    %eax,%esi
+  802e73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e76:	50                   	push   %eax
+  802e77:	e8 82 ea ff ff       	call   8018fe <fd_alloc>
+  802e7c:	89 c3                	mov    %eax,%ebx
+  802e7e:	83 c4 10             	add    $0x10,%esp
+  802e81:	85 c0                	test   %eax,%eax
+  802e83:	78 43                	js     802ec8 <alloc_sockfd+0x5f>
+  802e85:	83 ec 04             	sub    $0x4,%esp
+  802e88:	68 07 04 00 00       	push   $0x407
+  802e8d:	ff 75 f4             	push   -0xc(%ebp)
+  802e90:	6a 00                	push   $0x0
+  802e92:	e8 d2 e1 ff ff       	call   801069 <sys_page_alloc>
+  802e97:	89 c3                	mov    %eax,%ebx
+  802e99:	83 c4 10             	add    $0x10,%esp
+  802e9c:	85 c0                	test   %eax,%eax
+  802e9e:	78 28                	js     802ec8 <alloc_sockfd+0x5f>
+  802ea0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ea3:	8b 15 ac 67 80 00    	mov    0x8067ac,%edx
+  802ea9:	89 10                	mov    %edx,(%eax)
+  802eab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eae:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802eb5:	89 70 0c             	mov    %esi,0xc(%eax)
+  802eb8:	83 ec 0c             	sub    $0xc,%esp
+  802ebb:	50                   	push   %eax
+  802ebc:	e8 16 ea ff ff       	call   8018d7 <fd2num>
+  802ec1:	89 c3                	mov    %eax,%ebx
+  802ec3:	83 c4 10             	add    $0x10,%esp
+  802ec6:	eb 0c                	jmp    802ed4 <alloc_sockfd+0x6b>
+  802ec8:	83 ec 0c             	sub    $0xc,%esp
+  802ecb:	56                   	push   %esi
+  802ecc:	e8 d7 01 00 00       	call   8030a8 <nsipc_close>
+  802ed1:	83 c4 10             	add    $0x10,%esp
+  802ed4:	89 d8                	mov    %ebx,%eax
+  802ed6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ed9:	5b                   	pop    %ebx
+  802eda:	5e                   	pop    %esi
+  802edb:	5d                   	pop    %ebp
+  802edc:	c3                   	ret
+
+00802edd <accept>:
+  802edd:	55                   	push   %ebp
+  802ede:	89 e5                	mov    %esp,%ebp
+  802ee0:	83 ec 08             	sub    $0x8,%esp
+  802ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee6:	e8 4e ff ff ff       	call   802e39 <fd2sockid>
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	78 1b                	js     802f0a <accept+0x2d>
+  802eef:	83 ec 04             	sub    $0x4,%esp
+  802ef2:	ff 75 10             	push   0x10(%ebp)
+  802ef5:	ff 75 0c             	push   0xc(%ebp)
+  802ef8:	50                   	push   %eax
+  802ef9:	e8 07 01 00 00       	call   803005 <nsipc_accept>
+  802efe:	83 c4 10             	add    $0x10,%esp
+  802f01:	85 c0                	test   %eax,%eax
+  802f03:	78 05                	js     802f0a <accept+0x2d>
+  802f05:	e8 5f ff ff ff       	call   802e69 <alloc_sockfd>
+  802f0a:	c9                   	leave
+  802f0b:	c3                   	ret
+
+00802f0c <bind>:
+  802f0c:	55                   	push   %ebp
+  802f0d:	89 e5                	mov    %esp,%ebp
+  802f0f:	83 ec 08             	sub    $0x8,%esp
+  802f12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f15:	e8 1f ff ff ff       	call   802e39 <fd2sockid>
+  802f1a:	85 c0                	test   %eax,%eax
+  802f1c:	78 12                	js     802f30 <bind+0x24>
+  802f1e:	83 ec 04             	sub    $0x4,%esp
+  802f21:	ff 75 10             	push   0x10(%ebp)
+  802f24:	ff 75 0c             	push   0xc(%ebp)
+  802f27:	50                   	push   %eax
+  802f28:	e8 24 01 00 00       	call   803051 <nsipc_bind>
+  802f2d:	83 c4 10             	add    $0x10,%esp
+  802f30:	c9                   	leave
+  802f31:	c3                   	ret
+
+00802f32 <shutdown>:
+  802f32:	55                   	push   %ebp
+  802f33:	89 e5                	mov    %esp,%ebp
+  802f35:	83 ec 08             	sub    $0x8,%esp
+  802f38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f3b:	e8 f9 fe ff ff       	call   802e39 <fd2sockid>
+  802f40:	85 c0                	test   %eax,%eax
+  802f42:	78 0f                	js     802f53 <shutdown+0x21>
+  802f44:	83 ec 08             	sub    $0x8,%esp
+  802f47:	ff 75 0c             	push   0xc(%ebp)
+  802f4a:	50                   	push   %eax
+  802f4b:	e8 36 01 00 00       	call   803086 <nsipc_shutdown>
+  802f50:	83 c4 10             	add    $0x10,%esp
+  802f53:	c9                   	leave
+  802f54:	c3                   	ret
+
+00802f55 <connect>:
+  802f55:	55                   	push   %ebp
+  802f56:	89 e5                	mov    %esp,%ebp
+  802f58:	83 ec 08             	sub    $0x8,%esp
+  802f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f5e:	e8 d6 fe ff ff       	call   802e39 <fd2sockid>
+  802f63:	85 c0                	test   %eax,%eax
+  802f65:	78 12                	js     802f79 <connect+0x24>
+  802f67:	83 ec 04             	sub    $0x4,%esp
+  802f6a:	ff 75 10             	push   0x10(%ebp)
+  802f6d:	ff 75 0c             	push   0xc(%ebp)
+  802f70:	50                   	push   %eax
+  802f71:	e8 4c 01 00 00       	call   8030c2 <nsipc_connect>
+  802f76:	83 c4 10             	add    $0x10,%esp
+  802f79:	c9                   	leave
+  802f7a:	c3                   	ret
+
+00802f7b <listen>:
+  802f7b:	55                   	push   %ebp
+  802f7c:	89 e5                	mov    %esp,%ebp
+  802f7e:	83 ec 08             	sub    $0x8,%esp
+  802f81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f84:	e8 b0 fe ff ff       	call   802e39 <fd2sockid>
+  802f89:	85 c0                	test   %eax,%eax
+  802f8b:	78 0f                	js     802f9c <listen+0x21>
+  802f8d:	83 ec 08             	sub    $0x8,%esp
+  802f90:	ff 75 0c             	push   0xc(%ebp)
+  802f93:	50                   	push   %eax
+  802f94:	e8 5e 01 00 00       	call   8030f7 <nsipc_listen>
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	c9                   	leave
+  802f9d:	c3                   	ret
+
+00802f9e <socket>:
+  802f9e:	55                   	push   %ebp
+  802f9f:	89 e5                	mov    %esp,%ebp
+  802fa1:	83 ec 0c             	sub    $0xc,%esp
+  802fa4:	ff 75 10             	push   0x10(%ebp)
+  802fa7:	ff 75 0c             	push   0xc(%ebp)
+  802faa:	ff 75 08             	push   0x8(%ebp)
+  802fad:	e8 34 02 00 00       	call   8031e6 <nsipc_socket>
+  802fb2:	83 c4 10             	add    $0x10,%esp
+  802fb5:	85 c0                	test   %eax,%eax
+  802fb7:	78 05                	js     802fbe <socket+0x20>
+  802fb9:	e8 ab fe ff ff       	call   802e69 <alloc_sockfd>
+  802fbe:	c9                   	leave
+  802fbf:	c3                   	ret
+
+00802fc0 <nsipc>:
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	53                   	push   %ebx
+  802fc4:	83 ec 04             	sub    $0x4,%esp
+  802fc7:	89 c3                	mov    %eax,%ebx
+  802fc9:	83 3d 0c 70 80 00 00 	cmpl   $0x0,0x80700c
+  802fd0:	74 1f                	je     802ff1 <nsipc+0x31>
+  802fd2:	83 ec 08             	sub    $0x8,%esp
+  802fd5:	6a 00                	push   $0x0
+  802fd7:	6a 00                	push   $0x0
+  802fd9:	6a 07                	push   $0x7
+  802fdb:	68 00 a0 80 00       	push   $0x80a000
+  802fe0:	53                   	push   %ebx
+  802fe1:	ff 35 0c 70 80 00    	push   0x80700c
+  802fe7:	e8 e1 0d 00 00       	call   803dcd <ipc_call>
+  802fec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fef:	c9                   	leave
+  802ff0:	c3                   	ret
+  802ff1:	83 ec 0c             	sub    $0xc,%esp
+  802ff4:	6a 03                	push   $0x3
+  802ff6:	e8 6d 0f 00 00       	call   803f68 <ipc_find_env>
+  802ffb:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  803000:	83 c4 10             	add    $0x10,%esp
+  803003:	eb cd                	jmp    802fd2 <nsipc+0x12>
+
+00803005 <nsipc_accept>:
+  803005:	55                   	push   %ebp
+  803006:	89 e5                	mov    %esp,%ebp
+  803008:	53                   	push   %ebx
+  803009:	83 ec 04             	sub    $0x4,%esp
+  80300c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80300f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  803014:	b8 01 00 00 00       	mov    $0x1,%eax
+  803019:	e8 a2 ff ff ff       	call   802fc0 <nsipc>
+  80301e:	89 c3                	mov    %eax,%ebx
+  803020:	85 c0                	test   %eax,%eax
+  803022:	79 07                	jns    80302b <nsipc_accept+0x26>
+  803024:	89 d8                	mov    %ebx,%eax
+  803026:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803029:	c9                   	leave
+  80302a:	c3                   	ret
+  80302b:	83 ec 04             	sub    $0x4,%esp
+  80302e:	ff 35 10 a0 80 00    	push   0x80a010
+  803034:	68 00 a0 80 00       	push   $0x80a000
+  803039:	ff 75 0c             	push   0xc(%ebp)
+  80303c:	e8 78 dd ff ff       	call   800db9 <memmove>
+  803041:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  803047:	8b 45 10             	mov    0x10(%ebp),%eax
+  80304a:	89 10                	mov    %edx,(%eax)
+  80304c:	83 c4 10             	add    $0x10,%esp
+  80304f:	eb d3                	jmp    803024 <nsipc_accept+0x1f>
+
+00803051 <nsipc_bind>:
+  803051:	55                   	push   %ebp
+  803052:	89 e5                	mov    %esp,%ebp
+  803054:	53                   	push   %ebx
+  803055:	83 ec 08             	sub    $0x8,%esp
+  803058:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80305b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80305e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  803063:	53                   	push   %ebx
+  803064:	ff 75 0c             	push   0xc(%ebp)
+  803067:	68 04 a0 80 00       	push   $0x80a004
+  80306c:	e8 48 dd ff ff       	call   800db9 <memmove>
+  803071:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+  803077:	b8 02 00 00 00       	mov    $0x2,%eax
+  80307c:	e8 3f ff ff ff       	call   802fc0 <nsipc>
+  803081:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803084:	c9                   	leave
+  803085:	c3                   	ret
+
+00803086 <nsipc_shutdown>:
+  803086:	55                   	push   %ebp
+  803087:	89 e5                	mov    %esp,%ebp
+  803089:	83 ec 08             	sub    $0x8,%esp
+  80308c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  803094:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803097:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  80309c:	b8 03 00 00 00       	mov    $0x3,%eax
+  8030a1:	e8 1a ff ff ff       	call   802fc0 <nsipc>
+  8030a6:	c9                   	leave
+  8030a7:	c3                   	ret
+
+008030a8 <nsipc_close>:
+  8030a8:	55                   	push   %ebp
+  8030a9:	89 e5                	mov    %esp,%ebp
+  8030ab:	83 ec 08             	sub    $0x8,%esp
+  8030ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b1:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8030b6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8030bb:	e8 00 ff ff ff       	call   802fc0 <nsipc>
+  8030c0:	c9                   	leave
+  8030c1:	c3                   	ret
+
+008030c2 <nsipc_connect>:
+  8030c2:	55                   	push   %ebp
+  8030c3:	89 e5                	mov    %esp,%ebp
+  8030c5:	53                   	push   %ebx
+  8030c6:	83 ec 08             	sub    $0x8,%esp
+  8030c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030cf:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8030d4:	53                   	push   %ebx
+  8030d5:	ff 75 0c             	push   0xc(%ebp)
+  8030d8:	68 04 a0 80 00       	push   $0x80a004
+  8030dd:	e8 d7 dc ff ff       	call   800db9 <memmove>
+  8030e2:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+  8030e8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8030ed:	e8 ce fe ff ff       	call   802fc0 <nsipc>
+  8030f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f5:	c9                   	leave
+  8030f6:	c3                   	ret
+
+008030f7 <nsipc_listen>:
+  8030f7:	55                   	push   %ebp
+  8030f8:	89 e5                	mov    %esp,%ebp
+  8030fa:	83 ec 08             	sub    $0x8,%esp
+  8030fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803100:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  803105:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803108:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  80310d:	b8 06 00 00 00       	mov    $0x6,%eax
+  803112:	e8 a9 fe ff ff       	call   802fc0 <nsipc>
+  803117:	c9                   	leave
+  803118:	c3                   	ret
+
+00803119 <nsipc_recv>:
+  803119:	55                   	push   %ebp
+  80311a:	89 e5                	mov    %esp,%ebp
+  80311c:	56                   	push   %esi
+  80311d:	53                   	push   %ebx
+  80311e:	8b 75 10             	mov    0x10(%ebp),%esi
+  803121:	8b 45 08             	mov    0x8(%ebp),%eax
+  803124:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  803129:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+  80312f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803132:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  803137:	b8 07 00 00 00       	mov    $0x7,%eax
+  80313c:	e8 7f fe ff ff       	call   802fc0 <nsipc>
+  803141:	89 c3                	mov    %eax,%ebx
+  803143:	85 c0                	test   %eax,%eax
+  803145:	78 22                	js     803169 <nsipc_recv+0x50>
+  803147:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80314c:	39 c6                	cmp    %eax,%esi
+  80314e:	0f 4e c6             	cmovle %esi,%eax
+  803151:	39 c3                	cmp    %eax,%ebx
+  803153:	7f 1d                	jg     803172 <nsipc_recv+0x59>
+  803155:	83 ec 04             	sub    $0x4,%esp
+  803158:	53                   	push   %ebx
+  803159:	68 00 a0 80 00       	push   $0x80a000
+  80315e:	ff 75 0c             	push   0xc(%ebp)
+  803161:	e8 53 dc ff ff       	call   800db9 <memmove>
+  803166:	83 c4 10             	add    $0x10,%esp
+  803169:	89 d8                	mov    %ebx,%eax
+  80316b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80316e:	5b                   	pop    %ebx
+  80316f:	5e                   	pop    %esi
+  803170:	5d                   	pop    %ebp
+  803171:	c3                   	ret
+  803172:	68 8a 48 80 00       	push   $0x80488a
+  803177:	68 eb 47 80 00       	push   $0x8047eb
+  80317c:	6a 60                	push   $0x60
+  80317e:	68 9f 48 80 00       	push   $0x80489f
+  803183:	e8 af d2 ff ff       	call   800437 <_panic>
+
+00803188 <nsipc_send>:
+  803188:	55                   	push   %ebp
+  803189:	89 e5                	mov    %esp,%ebp
+  80318b:	53                   	push   %ebx
+  80318c:	83 ec 04             	sub    $0x4,%esp
+  80318f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803192:	8b 45 08             	mov    0x8(%ebp),%eax
+  803195:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  80319a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8031a0:	7f 2e                	jg     8031d0 <nsipc_send+0x48>
+  8031a2:	83 ec 04             	sub    $0x4,%esp
+  8031a5:	53                   	push   %ebx
+  8031a6:	ff 75 0c             	push   0xc(%ebp)
+  8031a9:	68 0c a0 80 00       	push   $0x80a00c
+  8031ae:	e8 06 dc ff ff       	call   800db9 <memmove>
+  8031b3:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+  8031b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031bc:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  8031c1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8031c6:	e8 f5 fd ff ff       	call   802fc0 <nsipc>
+  8031cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ce:	c9                   	leave
+  8031cf:	c3                   	ret
+  8031d0:	68 ab 48 80 00       	push   $0x8048ab
+  8031d5:	68 eb 47 80 00       	push   $0x8047eb
+  8031da:	6a 6b                	push   $0x6b
+  8031dc:	68 9f 48 80 00       	push   $0x80489f
+  8031e1:	e8 51 d2 ff ff       	call   800437 <_panic>
+
+008031e6 <nsipc_socket>:
+  8031e6:	55                   	push   %ebp
+  8031e7:	89 e5                	mov    %esp,%ebp
+  8031e9:	83 ec 08             	sub    $0x8,%esp
+  8031ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ef:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8031f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031f7:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  8031fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031ff:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  803204:	b8 09 00 00 00       	mov    $0x9,%eax
+  803209:	e8 b2 fd ff ff       	call   802fc0 <nsipc>
+  80320e:	c9                   	leave
+  80320f:	c3                   	ret
+
+00803210 <devpipe_stat>:
+  803210:	55                   	push   %ebp
+  803211:	89 e5                	mov    %esp,%ebp
+  803213:	56                   	push   %esi
+  803214:	53                   	push   %ebx
+  803215:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803218:	83 ec 0c             	sub    $0xc,%esp
+  80321b:	ff 75 08             	push   0x8(%ebp)
+  80321e:	e8 c4 e6 ff ff       	call   8018e7 <fd2data>
+  803223:	89 c6                	mov    %eax,%esi
+  803225:	83 c4 08             	add    $0x8,%esp
+  803228:	68 b7 48 80 00       	push   $0x8048b7
+  80322d:	53                   	push   %ebx
+  80322e:	e8 d6 d9 ff ff       	call   800c09 <strcpy>
+  803233:	8b 46 04             	mov    0x4(%esi),%eax
+  803236:	2b 06                	sub    (%esi),%eax
+  803238:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80323e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803245:	00 00 00 
+  803248:	c7 83 88 00 00 00 c8 	movl   $0x8067c8,0x88(%ebx)
+  80324f:	67 80 00 
+  803252:	b8 00 00 00 00       	mov    $0x0,%eax
+  803257:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80325a:	5b                   	pop    %ebx
+  80325b:	5e                   	pop    %esi
+  80325c:	5d                   	pop    %ebp
+  80325d:	c3                   	ret
+
+0080325e <devpipe_close>:
+  80325e:	55                   	push   %ebp
+  80325f:	89 e5                	mov    %esp,%ebp
+  803261:	53                   	push   %ebx
+  803262:	83 ec 0c             	sub    $0xc,%esp
+  803265:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803268:	53                   	push   %ebx
+  803269:	6a 00                	push   $0x0
+  80326b:	e8 cb de ff ff       	call   80113b <sys_page_unmap>
+  803270:	89 1c 24             	mov    %ebx,(%esp)
+  803273:	e8 6f e6 ff ff       	call   8018e7 <fd2data>
+  803278:	83 c4 08             	add    $0x8,%esp
+  80327b:	50                   	push   %eax
+  80327c:	6a 00                	push   $0x0
+  80327e:	e8 b8 de ff ff       	call   80113b <sys_page_unmap>
+  803283:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803286:	c9                   	leave
+  803287:	c3                   	ret
+
+00803288 <_pipeisclosed>:
+  803288:	55                   	push   %ebp
+  803289:	89 e5                	mov    %esp,%ebp
+  80328b:	57                   	push   %edi
+  80328c:	56                   	push   %esi
+  80328d:	53                   	push   %ebx
+  80328e:	83 ec 1c             	sub    $0x1c,%esp
+  803291:	89 c7                	mov    %eax,%edi
+  803293:	89 d6                	mov    %edx,%esi
+  803295:	a1 90 87 80 00       	mov    0x808790,%eax
+  80329a:	8b 58 58             	mov    0x58(%eax),%ebx
+  80329d:	83 ec 0c             	sub    $0xc,%esp
+  8032a0:	57                   	push   %edi
+  8032a1:	e8 dc 0c 00 00       	call   803f82 <pageref>
+  8032a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032a9:	89 34 24             	mov    %esi,(%esp)
+  8032ac:	e8 d1 0c 00 00       	call   803f82 <pageref>
+  8032b1:	8b 15 90 87 80 00    	mov    0x808790,%edx
+  8032b7:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8032ba:	83 c4 10             	add    $0x10,%esp
+  8032bd:	39 cb                	cmp    %ecx,%ebx
+  8032bf:	74 1b                	je     8032dc <_pipeisclosed+0x54>
+  8032c1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032c4:	75 cf                	jne    803295 <_pipeisclosed+0xd>
+  8032c6:	8b 42 58             	mov    0x58(%edx),%eax
+  8032c9:	6a 01                	push   $0x1
+  8032cb:	50                   	push   %eax
+  8032cc:	53                   	push   %ebx
+  8032cd:	68 be 48 80 00       	push   $0x8048be
+  8032d2:	e8 3b d2 ff ff       	call   800512 <cprintf>
+  8032d7:	83 c4 10             	add    $0x10,%esp
+  8032da:	eb b9                	jmp    803295 <_pipeisclosed+0xd>
+  8032dc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032df:	0f 94 c0             	sete   %al
+  8032e2:	0f b6 c0             	movzbl %al,%eax
+  8032e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032e8:	5b                   	pop    %ebx
+  8032e9:	5e                   	pop    %esi
+  8032ea:	5f                   	pop    %edi
+  8032eb:	5d                   	pop    %ebp
+  8032ec:	c3                   	ret
+
+008032ed <devpipe_write>:
+  8032ed:	55                   	push   %ebp
+  8032ee:	89 e5                	mov    %esp,%ebp
+  8032f0:	57                   	push   %edi
+  8032f1:	56                   	push   %esi
+  8032f2:	53                   	push   %ebx
+  8032f3:	83 ec 28             	sub    $0x28,%esp
+  8032f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032f9:	56                   	push   %esi
+  8032fa:	e8 e8 e5 ff ff       	call   8018e7 <fd2data>
+  8032ff:	89 c3                	mov    %eax,%ebx
+  803301:	83 c4 10             	add    $0x10,%esp
+  803304:	bf 00 00 00 00       	mov    $0x0,%edi
+  803309:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80330d:	74 5c                	je     80336b <devpipe_write+0x7e>
+  80330f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803312:	8b 0b                	mov    (%ebx),%ecx
+  803314:	8d 51 20             	lea    0x20(%ecx),%edx
+  803317:	39 d0                	cmp    %edx,%eax
+  803319:	72 1e                	jb     803339 <devpipe_write+0x4c>
+  80331b:	89 da                	mov    %ebx,%edx
+  80331d:	89 f0                	mov    %esi,%eax
+  80331f:	e8 64 ff ff ff       	call   803288 <_pipeisclosed>
+  803324:	85 c0                	test   %eax,%eax
+  803326:	75 48                	jne    803370 <devpipe_write+0x83>
+  803328:	e8 f1 dc ff ff       	call   80101e <sys_yield>
+  80332d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803330:	8b 0b                	mov    (%ebx),%ecx
+  803332:	8d 51 20             	lea    0x20(%ecx),%edx
+  803335:	39 d0                	cmp    %edx,%eax
+  803337:	73 e2                	jae    80331b <devpipe_write+0x2e>
+  803339:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80333c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803340:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803343:	89 c2                	mov    %eax,%edx
+  803345:	c1 fa 1f             	sar    $0x1f,%edx
+  803348:	89 d1                	mov    %edx,%ecx
+  80334a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80334d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803350:	83 e2 1f             	and    $0x1f,%edx
+  803353:	29 ca                	sub    %ecx,%edx
+  803355:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803359:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80335d:	83 c0 01             	add    $0x1,%eax
+  803360:	89 43 04             	mov    %eax,0x4(%ebx)
+  803363:	83 c7 01             	add    $0x1,%edi
+  803366:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803369:	75 a4                	jne    80330f <devpipe_write+0x22>
+  80336b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80336e:	eb 05                	jmp    803375 <devpipe_write+0x88>
+  803370:	b8 00 00 00 00       	mov    $0x0,%eax
+  803375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803378:	5b                   	pop    %ebx
+  803379:	5e                   	pop    %esi
+  80337a:	5f                   	pop    %edi
+  80337b:	5d                   	pop    %ebp
+  80337c:	c3                   	ret
+
+0080337d <devpipe_read>:
+  80337d:	55                   	push   %ebp
+  80337e:	89 e5                	mov    %esp,%ebp
+  803380:	57                   	push   %edi
+  803381:	56                   	push   %esi
+  803382:	53                   	push   %ebx
+  803383:	83 ec 18             	sub    $0x18,%esp
+  803386:	8b 75 08             	mov    0x8(%ebp),%esi
+  803389:	56                   	push   %esi
+  80338a:	e8 58 e5 ff ff       	call   8018e7 <fd2data>
+  80338f:	89 c3                	mov    %eax,%ebx
+  803391:	83 c4 10             	add    $0x10,%esp
+  803394:	bf 00 00 00 00       	mov    $0x0,%edi
+  803399:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80339d:	74 45                	je     8033e4 <devpipe_read+0x67>
+  80339f:	8b 03                	mov    (%ebx),%eax
+  8033a1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8033a4:	75 1d                	jne    8033c3 <devpipe_read+0x46>
+  8033a6:	85 ff                	test   %edi,%edi
+  8033a8:	75 3f                	jne    8033e9 <devpipe_read+0x6c>
+  8033aa:	89 da                	mov    %ebx,%edx
+  8033ac:	89 f0                	mov    %esi,%eax
+  8033ae:	e8 d5 fe ff ff       	call   803288 <_pipeisclosed>
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	75 3c                	jne    8033f3 <devpipe_read+0x76>
+  8033b7:	e8 62 dc ff ff       	call   80101e <sys_yield>
+  8033bc:	8b 03                	mov    (%ebx),%eax
+  8033be:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8033c1:	74 e7                	je     8033aa <devpipe_read+0x2d>
+  8033c3:	99                   	cltd
+  8033c4:	c1 ea 1b             	shr    $0x1b,%edx
+  8033c7:	01 d0                	add    %edx,%eax
+  8033c9:	83 e0 1f             	and    $0x1f,%eax
+  8033cc:	29 d0                	sub    %edx,%eax
+  8033ce:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8033d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8033d6:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8033d9:	83 03 01             	addl   $0x1,(%ebx)
+  8033dc:	83 c7 01             	add    $0x1,%edi
+  8033df:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8033e2:	75 bb                	jne    80339f <devpipe_read+0x22>
+  8033e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033e7:	eb 02                	jmp    8033eb <devpipe_read+0x6e>
+  8033e9:	89 f8                	mov    %edi,%eax
+  8033eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033ee:	5b                   	pop    %ebx
+  8033ef:	5e                   	pop    %esi
+  8033f0:	5f                   	pop    %edi
+  8033f1:	5d                   	pop    %ebp
+  8033f2:	c3                   	ret
+  8033f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f8:	eb f1                	jmp    8033eb <devpipe_read+0x6e>
+
+008033fa <pipe>:
+  8033fa:	55                   	push   %ebp
+  8033fb:	89 e5                	mov    %esp,%ebp
+  8033fd:	56                   	push   %esi
+  8033fe:	53                   	push   %ebx
+  8033ff:	83 ec 1c             	sub    $0x1c,%esp
+  803402:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803405:	50                   	push   %eax
+  803406:	e8 f3 e4 ff ff       	call   8018fe <fd_alloc>
+  80340b:	89 c3                	mov    %eax,%ebx
+  80340d:	83 c4 10             	add    $0x10,%esp
+  803410:	85 c0                	test   %eax,%eax
+  803412:	0f 88 23 01 00 00    	js     80353b <pipe+0x141>
+  803418:	83 ec 04             	sub    $0x4,%esp
+  80341b:	68 07 04 00 00       	push   $0x407
+  803420:	ff 75 f4             	push   -0xc(%ebp)
+  803423:	6a 00                	push   $0x0
+  803425:	e8 3f dc ff ff       	call   801069 <sys_page_alloc>
+  80342a:	89 c3                	mov    %eax,%ebx
+  80342c:	83 c4 10             	add    $0x10,%esp
+  80342f:	85 c0                	test   %eax,%eax
+  803431:	0f 88 04 01 00 00    	js     80353b <pipe+0x141>
+  803437:	83 ec 0c             	sub    $0xc,%esp
+  80343a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80343d:	50                   	push   %eax
+  80343e:	e8 bb e4 ff ff       	call   8018fe <fd_alloc>
+  803443:	89 c3                	mov    %eax,%ebx
+  803445:	83 c4 10             	add    $0x10,%esp
+  803448:	85 c0                	test   %eax,%eax
+  80344a:	0f 88 db 00 00 00    	js     80352b <pipe+0x131>
+  803450:	83 ec 04             	sub    $0x4,%esp
+  803453:	68 07 04 00 00       	push   $0x407
+  803458:	ff 75 f0             	push   -0x10(%ebp)
+  80345b:	6a 00                	push   $0x0
+  80345d:	e8 07 dc ff ff       	call   801069 <sys_page_alloc>
+  803462:	89 c3                	mov    %eax,%ebx
+  803464:	83 c4 10             	add    $0x10,%esp
+  803467:	85 c0                	test   %eax,%eax
+  803469:	0f 88 bc 00 00 00    	js     80352b <pipe+0x131>
+  80346f:	83 ec 0c             	sub    $0xc,%esp
+  803472:	ff 75 f4             	push   -0xc(%ebp)
+  803475:	e8 6d e4 ff ff       	call   8018e7 <fd2data>
+  80347a:	89 c6                	mov    %eax,%esi
+  80347c:	83 c4 0c             	add    $0xc,%esp
+  80347f:	68 07 04 00 00       	push   $0x407
+  803484:	50                   	push   %eax
+  803485:	6a 00                	push   $0x0
+  803487:	e8 dd db ff ff       	call   801069 <sys_page_alloc>
+  80348c:	89 c3                	mov    %eax,%ebx
+  80348e:	83 c4 10             	add    $0x10,%esp
+  803491:	85 c0                	test   %eax,%eax
+  803493:	0f 88 82 00 00 00    	js     80351b <pipe+0x121>
+  803499:	83 ec 0c             	sub    $0xc,%esp
+  80349c:	ff 75 f0             	push   -0x10(%ebp)
+  80349f:	e8 43 e4 ff ff       	call   8018e7 <fd2data>
+  8034a4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8034ab:	50                   	push   %eax
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	56                   	push   %esi
+  8034af:	6a 00                	push   $0x0
+  8034b1:	e8 f6 db ff ff       	call   8010ac <sys_page_map>
+  8034b6:	89 c3                	mov    %eax,%ebx
+  8034b8:	83 c4 20             	add    $0x20,%esp
+  8034bb:	85 c0                	test   %eax,%eax
+  8034bd:	78 4e                	js     80350d <pipe+0x113>
+  8034bf:	a1 c8 67 80 00       	mov    0x8067c8,%eax
+  8034c4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8034c7:	89 02                	mov    %eax,(%edx)
+  8034c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8034cc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8034d3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8034d6:	89 02                	mov    %eax,(%edx)
+  8034d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8034db:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8034e2:	83 ec 0c             	sub    $0xc,%esp
+  8034e5:	ff 75 f4             	push   -0xc(%ebp)
+  8034e8:	e8 ea e3 ff ff       	call   8018d7 <fd2num>
+  8034ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034f0:	89 01                	mov    %eax,(%ecx)
+  8034f2:	83 c4 04             	add    $0x4,%esp
+  8034f5:	ff 75 f0             	push   -0x10(%ebp)
+  8034f8:	e8 da e3 ff ff       	call   8018d7 <fd2num>
+  8034fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803500:	89 41 04             	mov    %eax,0x4(%ecx)
+  803503:	83 c4 10             	add    $0x10,%esp
+  803506:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80350b:	eb 2e                	jmp    80353b <pipe+0x141>
+  80350d:	83 ec 08             	sub    $0x8,%esp
+  803510:	56                   	push   %esi
+  803511:	6a 00                	push   $0x0
+  803513:	e8 23 dc ff ff       	call   80113b <sys_page_unmap>
+  803518:	83 c4 10             	add    $0x10,%esp
+  80351b:	83 ec 08             	sub    $0x8,%esp
+  80351e:	ff 75 f0             	push   -0x10(%ebp)
+  803521:	6a 00                	push   $0x0
+  803523:	e8 13 dc ff ff       	call   80113b <sys_page_unmap>
+  803528:	83 c4 10             	add    $0x10,%esp
+  80352b:	83 ec 08             	sub    $0x8,%esp
+  80352e:	ff 75 f4             	push   -0xc(%ebp)
+  803531:	6a 00                	push   $0x0
+  803533:	e8 03 dc ff ff       	call   80113b <sys_page_unmap>
+  803538:	83 c4 10             	add    $0x10,%esp
+  80353b:	89 d8                	mov    %ebx,%eax
+  80353d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803540:	5b                   	pop    %ebx
+  803541:	5e                   	pop    %esi
+  803542:	5d                   	pop    %ebp
+  803543:	c3                   	ret
+
+00803544 <pipeisclosed>:
+  803544:	55                   	push   %ebp
+  803545:	89 e5                	mov    %esp,%ebp
+  803547:	83 ec 20             	sub    $0x20,%esp
+  80354a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80354d:	50                   	push   %eax
+  80354e:	ff 75 08             	push   0x8(%ebp)
+  803551:	e8 f8 e3 ff ff       	call   80194e <fd_lookup>
+  803556:	83 c4 10             	add    $0x10,%esp
+  803559:	85 c0                	test   %eax,%eax
+  80355b:	78 18                	js     803575 <pipeisclosed+0x31>
+  80355d:	83 ec 0c             	sub    $0xc,%esp
+  803560:	ff 75 f4             	push   -0xc(%ebp)
+  803563:	e8 7f e3 ff ff       	call   8018e7 <fd2data>
+  803568:	89 c2                	mov    %eax,%edx
+  80356a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80356d:	e8 16 fd ff ff       	call   803288 <_pipeisclosed>
+  803572:	83 c4 10             	add    $0x10,%esp
+  803575:	c9                   	leave
+  803576:	c3                   	ret
+
+00803577 <wait>:
+  803577:	55                   	push   %ebp
+  803578:	89 e5                	mov    %esp,%ebp
+  80357a:	56                   	push   %esi
+  80357b:	53                   	push   %ebx
+  80357c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80357f:	85 f6                	test   %esi,%esi
+  803581:	74 40                	je     8035c3 <wait+0x4c>
+  803583:	89 f3                	mov    %esi,%ebx
+  803585:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80358b:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  803591:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803596:	8b 40 48             	mov    0x48(%eax),%eax
+  803599:	39 c6                	cmp    %eax,%esi
+  80359b:	75 1f                	jne    8035bc <wait+0x45>
+  80359d:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  8035a3:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8035a9:	8b 43 54             	mov    0x54(%ebx),%eax
+  8035ac:	85 c0                	test   %eax,%eax
+  8035ae:	74 0c                	je     8035bc <wait+0x45>
+  8035b0:	e8 69 da ff ff       	call   80101e <sys_yield>
+  8035b5:	8b 43 48             	mov    0x48(%ebx),%eax
+  8035b8:	39 f0                	cmp    %esi,%eax
+  8035ba:	74 ed                	je     8035a9 <wait+0x32>
+  8035bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035bf:	5b                   	pop    %ebx
+  8035c0:	5e                   	pop    %esi
+  8035c1:	5d                   	pop    %ebp
+  8035c2:	c3                   	ret
+  8035c3:	68 d6 48 80 00       	push   $0x8048d6
+  8035c8:	68 eb 47 80 00       	push   $0x8047eb
+  8035cd:	6a 09                	push   $0x9
+  8035cf:	68 e1 48 80 00       	push   $0x8048e1
+  8035d4:	e8 5e ce ff ff       	call   800437 <_panic>
+
+008035d9 <ipcring_init>:
+  8035d9:	55                   	push   %ebp
+  8035da:	89 e5                	mov    %esp,%ebp
+  8035dc:	53                   	push   %ebx
+  8035dd:	83 ec 08             	sub    $0x8,%esp
+  8035e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8035e3:	6a 60                	push   $0x60
+  8035e5:	6a 00                	push   $0x0
+  8035e7:	53                   	push   %ebx
+  8035e8:	e8 97 d7 ff ff       	call   800d84 <memset>
+  8035ed:	a1 90 87 80 00       	mov    0x808790,%eax
+  8035f2:	8b 40 48             	mov    0x48(%eax),%eax
+  8035f5:	89 03                	mov    %eax,(%ebx)
+  8035f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035fa:	89 43 04             	mov    %eax,0x4(%ebx)
+  8035fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  803600:	89 43 08             	mov    %eax,0x8(%ebx)
+  803603:	8b 45 14             	mov    0x14(%ebp),%eax
+  803606:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803609:	83 c4 10             	add    $0x10,%esp
+  80360c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80360f:	c9                   	leave
+  803610:	c3                   	ret
+
+00803611 <ipcring_req_slot>:
+  803611:	55                   	push   %ebp
+  803612:	89 e5                	mov    %esp,%ebp
+  803614:	8b 45 08             	mov    0x8(%ebp),%eax
+  803617:	8b 50 10             	mov    0x10(%eax),%edx
+  80361a:	8b 48 18             	mov    0x18(%eax),%ecx
+  80361d:	29 ca                	sub    %ecx,%edx
+  80361f:	83 fa 07             	cmp    $0x7,%edx
+  803622:	77 0c                	ja     803630 <ipcring_req_slot+0x1f>
+  803624:	8b 50 10             	mov    0x10(%eax),%edx
+  803627:	83 e2 07             	and    $0x7,%edx
+  80362a:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80362e:	5d                   	pop    %ebp
+  80362f:	c3                   	ret
+  803630:	b8 00 00 00 00       	mov    $0x0,%eax
+  803635:	eb f7                	jmp    80362e <ipcring_req_slot+0x1d>
+
+00803637 <ipcring_req_push>:
+  803637:	55                   	push   %ebp
+  803638:	89 e5                	mov    %esp,%ebp
+  80363a:	83 ec 08             	sub    $0x8,%esp
+  80363d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803640:	8b 42 10             	mov    0x10(%edx),%eax
+  803643:	83 c0 01             	add    $0x1,%eax
+  803646:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80364a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364f:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803653:	85 c0                	test   %eax,%eax
+  803655:	75 02                	jne    803659 <ipcring_req_push+0x22>
+  803657:	c9                   	leave
+  803658:	c3                   	ret
+  803659:	6a 00                	push   $0x0
+  80365b:	68 00 00 80 ee       	push   $0xee800000
+  803660:	ff 72 08             	push   0x8(%edx)
+  803663:	ff 72 04             	push   0x4(%edx)
+  803666:	e8 36 dd ff ff       	call   8013a1 <sys_ipc_send>
+  80366b:	83 c4 10             	add    $0x10,%esp
+  80366e:	eb e7                	jmp    803657 <ipcring_req_push+0x20>
+
+00803670 <ipcring_rsp_wait>:
+  803670:	55                   	push   %ebp
+  803671:	89 e5                	mov    %esp,%ebp
+  803673:	53                   	push   %ebx
+  803674:	83 ec 04             	sub    $0x4,%esp
+  803677:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80367a:	8b 53 18             	mov    0x18(%ebx),%edx
+  80367d:	8b 43 10             	mov    0x10(%ebx),%eax
+  803680:	39 c2                	cmp    %eax,%edx
+  803682:	74 3c                	je     8036c0 <ipcring_rsp_wait+0x50>
+  803684:	8b 53 14             	mov    0x14(%ebx),%edx
+  803687:	8b 43 18             	mov    0x18(%ebx),%eax
+  80368a:	39 c2                	cmp    %eax,%edx
+  80368c:	75 23                	jne    8036b1 <ipcring_rsp_wait+0x41>
+  80368e:	83 ec 08             	sub    $0x8,%esp
+  803691:	6a 00                	push   $0x0
+  803693:	6a 00                	push   $0x0
+  803695:	6a 00                	push   $0x0
+  803697:	6a 00                	push   $0x0
+  803699:	ff 73 0c             	push   0xc(%ebx)
+  80369c:	ff 73 04             	push   0x4(%ebx)
+  80369f:	e8 29 07 00 00       	call   803dcd <ipc_call>
+  8036a4:	8b 53 14             	mov    0x14(%ebx),%edx
+  8036a7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8036aa:	83 c4 20             	add    $0x20,%esp
+  8036ad:	39 c2                	cmp    %eax,%edx
+  8036af:	74 dd                	je     80368e <ipcring_rsp_wait+0x1e>
+  8036b1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8036b4:	83 e0 07             	and    $0x7,%eax
+  8036b7:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8036bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036be:	c9                   	leave
+  8036bf:	c3                   	ret
+  8036c0:	68 ec 48 80 00       	push   $0x8048ec
+  8036c5:	68 eb 47 80 00       	push   $0x8047eb
+  8036ca:	6a 3b                	push   $0x3b
+  8036cc:	68 0d 49 80 00       	push   $0x80490d
+  8036d1:	e8 61 cd ff ff       	call   800437 <_panic>
+
+008036d6 <ipcring_rsp_pop>:
+  8036d6:	55                   	push   %ebp
+  8036d7:	89 e5                	mov    %esp,%ebp
+  8036d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8036dc:	8b 42 18             	mov    0x18(%edx),%eax
+  8036df:	83 c0 01             	add    $0x1,%eax
+  8036e2:	89 42 18             	mov    %eax,0x18(%edx)
+  8036e5:	5d                   	pop    %ebp
+  8036e6:	c3                   	ret
+
+008036e7 <ipcring_server_init>:
+  8036e7:	55                   	push   %ebp
+  8036e8:	89 e5                	mov    %esp,%ebp
+  8036ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036f0:	89 10                	mov    %edx,(%eax)
+  8036f2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036f5:	89 50 04             	mov    %edx,0x4(%eax)
+  8036f8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  8036ff:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803706:	5d                   	pop    %ebp
+  803707:	c3                   	ret
+
+00803708 <ipcring_req_avail>:
+  803708:	55                   	push   %ebp
+  803709:	89 e5                	mov    %esp,%ebp
+  80370b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80370e:	8b 02                	mov    (%edx),%eax
+  803710:	8b 40 10             	mov    0x10(%eax),%eax
+  803713:	2b 42 08             	sub    0x8(%edx),%eax
+  803716:	ba 08 00 00 00       	mov    $0x8,%edx
+  80371b:	39 d0                	cmp    %edx,%eax
+  80371d:	0f 47 c2             	cmova  %edx,%eax
+  803720:	5d                   	pop    %ebp
+  803721:	c3                   	ret
+
+00803722 <ipcring_req_peek>:
+  803722:	55                   	push   %ebp
+  803723:	89 e5                	mov    %esp,%ebp
+  803725:	8b 55 08             	mov    0x8(%ebp),%edx
+  803728:	8b 42 08             	mov    0x8(%edx),%eax
+  80372b:	83 e0 07             	and    $0x7,%eax
+  80372e:	8b 12                	mov    (%edx),%edx
+  803730:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803734:	5d                   	pop    %ebp
+  803735:	c3                   	ret
+
+00803736 <ipcring_rsp_push>:
+  803736:	55                   	push   %ebp
+  803737:	89 e5                	mov    %esp,%ebp
+  803739:	83 ec 08             	sub    $0x8,%esp
+  80373c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80373f:	8b 41 08             	mov    0x8(%ecx),%eax
+  803742:	83 c0 01             	add    $0x1,%eax
+  803745:	89 41 08             	mov    %eax,0x8(%ecx)
+  803748:	8b 11                	mov    (%ecx),%edx
+  80374a:	83 c2 14             	add    $0x14,%edx
+  80374d:	f0 87 02             	lock xchg %eax,(%edx)
+  803750:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803754:	75 02                	jne    803758 <ipcring_rsp_push+0x22>
+  803756:	c9                   	leave
+  803757:	c3                   	ret
+  803758:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80375f:	6a 00                	push   $0x0
+  803761:	68 00 00 80 ee       	push   $0xee800000
+  803766:	6a 00                	push   $0x0
+  803768:	ff 71 04             	push   0x4(%ecx)
+  80376b:	e8 54 db ff ff       	call   8012c4 <sys_ipc_try_send>
+  803770:	83 c4 10             	add    $0x10,%esp
+  803773:	eb e1                	jmp    803756 <ipcring_rsp_push+0x20>
+
+00803775 <ipcring_client_wait>:
+  803775:	55                   	push   %ebp
+  803776:	89 e5                	mov    %esp,%ebp
+  803778:	83 ec 08             	sub    $0x8,%esp
+  80377b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80377e:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803785:	8b 10                	mov    (%eax),%edx
+  803787:	8b 52 18             	mov    0x18(%edx),%edx
+  80378a:	3b 50 08             	cmp    0x8(%eax),%edx
+  80378d:	75 02                	jne    803791 <ipcring_client_wait+0x1c>
+  80378f:	c9                   	leave
+  803790:	c3                   	ret
+  803791:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803798:	6a 00                	push   $0x0
+  80379a:	68 00 00 80 ee       	push   $0xee800000
+  80379f:	6a 00                	push   $0x0
+  8037a1:	ff 70 04             	push   0x4(%eax)
+  8037a4:	e8 1b db ff ff       	call   8012c4 <sys_ipc_try_send>
+  8037a9:	83 c4 10             	add    $0x10,%esp
+  8037ac:	eb e1                	jmp    80378f <ipcring_client_wait+0x1a>
+
+008037ae <ipcring_server_sleep>:
+  8037ae:	55                   	push   %ebp
+  8037af:	89 e5                	mov    %esp,%ebp
+  8037b1:	53                   	push   %ebx
+  8037b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037b5:	8b 01                	mov    (%ecx),%eax
+  8037b7:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8037ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037bf:	f0 87 02             	lock xchg %eax,(%edx)
+  8037c2:	8b 11                	mov    (%ecx),%edx
+  8037c4:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8037c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8037cc:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8037cf:	74 0e                	je     8037df <ipcring_server_sleep+0x31>
+  8037d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d6:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8037da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037e2:	c9                   	leave
+  8037e3:	c3                   	ret
+
+008037e4 <dupq_flush>:
+  8037e4:	55                   	push   %ebp
+  8037e5:	89 e5                	mov    %esp,%ebp
+  8037e7:	53                   	push   %ebx
+  8037e8:	83 ec 0c             	sub    $0xc,%esp
+  8037eb:	8b 1d 10 70 80 00    	mov    0x807010,%ebx
+  8037f1:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  8037f8:	00 00 00 
+  8037fb:	53                   	push   %ebx
+  8037fc:	68 00 00 40 00       	push   $0x400000
+  803801:	e8 ea df ff ff       	call   8017f0 <sys_batch>
+  803806:	83 c4 10             	add    $0x10,%esp
+  803809:	85 c0                	test   %eax,%eax
+  80380b:	78 14                	js     803821 <dupq_flush+0x3d>
+  80380d:	39 c3                	cmp    %eax,%ebx
+  80380f:	7e 0b                	jle    80381c <dupq_flush+0x38>
+  803811:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803814:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  80381a:	eb 05                	jmp    803821 <dupq_flush+0x3d>
+  80381c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803821:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803824:	c9                   	leave
+  803825:	c3                   	ret
+
+00803826 <pgfault>:
+  803826:	55                   	push   %ebp
+  803827:	89 e5                	mov    %esp,%ebp
+  803829:	56                   	push   %esi
+  80382a:	53                   	push   %ebx
+  80382b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80382e:	8b 30                	mov    (%eax),%esi
+  803830:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  803834:	0f 84 83 00 00 00    	je     8038bd <pgfault+0x97>
+  80383a:	89 f0                	mov    %esi,%eax
+  80383c:	c1 e8 0c             	shr    $0xc,%eax
+  80383f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803846:	f6 c4 08             	test   $0x8,%ah
+  803849:	0f 84 80 00 00 00    	je     8038cf <pgfault+0xa9>
+  80384f:	e8 ab d7 ff ff       	call   800fff <sys_getenvid>
+  803854:	89 c3                	mov    %eax,%ebx
+  803856:	83 ec 04             	sub    $0x4,%esp
+  803859:	6a 07                	push   $0x7
+  80385b:	68 00 f0 7f 00       	push   $0x7ff000
+  803860:	50                   	push   %eax
+  803861:	e8 03 d8 ff ff       	call   801069 <sys_page_alloc>
+  803866:	83 c4 10             	add    $0x10,%esp
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	78 74                	js     8038e1 <pgfault+0xbb>
+  80386d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803873:	83 ec 04             	sub    $0x4,%esp
+  803876:	68 00 10 00 00       	push   $0x1000
+  80387b:	56                   	push   %esi
+  80387c:	68 00 f0 7f 00       	push   $0x7ff000
+  803881:	e8 33 d5 ff ff       	call   800db9 <memmove>
+  803886:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80388d:	56                   	push   %esi
+  80388e:	53                   	push   %ebx
+  80388f:	68 00 f0 7f 00       	push   $0x7ff000
+  803894:	53                   	push   %ebx
+  803895:	e8 12 d8 ff ff       	call   8010ac <sys_page_map>
+  80389a:	83 c4 20             	add    $0x20,%esp
+  80389d:	85 c0                	test   %eax,%eax
+  80389f:	78 54                	js     8038f5 <pgfault+0xcf>
+  8038a1:	83 ec 08             	sub    $0x8,%esp
+  8038a4:	68 00 f0 7f 00       	push   $0x7ff000
+  8038a9:	53                   	push   %ebx
+  8038aa:	e8 8c d8 ff ff       	call   80113b <sys_page_unmap>
+  8038af:	83 c4 10             	add    $0x10,%esp
+  8038b2:	85 c0                	test   %eax,%eax
+  8038b4:	78 53                	js     803909 <pgfault+0xe3>
+  8038b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038b9:	5b                   	pop    %ebx
+  8038ba:	5e                   	pop    %esi
+  8038bb:	5d                   	pop    %ebp
+  8038bc:	c3                   	ret
+  8038bd:	56                   	push   %esi
+  8038be:	68 1c 49 80 00       	push   $0x80491c
+  8038c3:	6a 19                	push   $0x19
+  8038c5:	68 f8 49 80 00       	push   $0x8049f8
+  8038ca:	e8 68 cb ff ff       	call   800437 <_panic>
+  8038cf:	56                   	push   %esi
+  8038d0:	68 50 49 80 00       	push   $0x804950
+  8038d5:	6a 1e                	push   $0x1e
+  8038d7:	68 f8 49 80 00       	push   $0x8049f8
+  8038dc:	e8 56 cb ff ff       	call   800437 <_panic>
+  8038e1:	83 ec 04             	sub    $0x4,%esp
+  8038e4:	68 84 49 80 00       	push   $0x804984
+  8038e9:	6a 2e                	push   $0x2e
+  8038eb:	68 f8 49 80 00       	push   $0x8049f8
+  8038f0:	e8 42 cb ff ff       	call   800437 <_panic>
+  8038f5:	83 ec 04             	sub    $0x4,%esp
+  8038f8:	68 a8 49 80 00       	push   $0x8049a8
+  8038fd:	6a 37                	push   $0x37
+  8038ff:	68 f8 49 80 00       	push   $0x8049f8
+  803904:	e8 2e cb ff ff       	call   800437 <_panic>
+  803909:	83 ec 04             	sub    $0x4,%esp
+  80390c:	68 d4 49 80 00       	push   $0x8049d4
+  803911:	6a 3c                	push   $0x3c
+  803913:	68 f8 49 80 00       	push   $0x8049f8
+  803918:	e8 1a cb ff ff       	call   800437 <_panic>
+
+0080391d <dupq_begin>:
+  80391d:	55                   	push   %ebp
+  80391e:	89 e5                	mov    %esp,%ebp
+  803920:	83 ec 0c             	sub    $0xc,%esp
+  803923:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  80392a:	00 00 00 
+  80392d:	6a 07                	push   $0x7
+  80392f:	68 00 00 40 00       	push   $0x400000
+  803934:	6a 00                	push   $0x0
+  803936:	e8 2e d7 ff ff       	call   801069 <sys_page_alloc>
+  80393b:	c9                   	leave
+  80393c:	c3                   	ret
+
+0080393d <dupq_map>:
+  80393d:	55                   	push   %ebp
+  80393e:	89 e5                	mov    %esp,%ebp
+  803940:	83 ec 08             	sub    $0x8,%esp
+  803943:	81 3d 10 70 80 00 92 	cmpl   $0x92,0x807010
+  80394a:	00 00 00 
+  80394d:	74 46                	je     803995 <dupq_map+0x58>
+  80394f:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  803955:	8d 42 01             	lea    0x1(%edx),%eax
+  803958:	a3 10 70 80 00       	mov    %eax,0x807010
+  80395d:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803960:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  803966:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  80396d:	00 00 00 
+  803970:	8b 55 08             	mov    0x8(%ebp),%edx
+  803973:	89 50 04             	mov    %edx,0x4(%eax)
+  803976:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803979:	c1 e2 0c             	shl    $0xc,%edx
+  80397c:	89 50 08             	mov    %edx,0x8(%eax)
+  80397f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  803982:	89 48 0c             	mov    %ecx,0xc(%eax)
+  803985:	89 50 10             	mov    %edx,0x10(%eax)
+  803988:	8b 55 14             	mov    0x14(%ebp),%edx
+  80398b:	89 50 14             	mov    %edx,0x14(%eax)
+  80398e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803993:	c9                   	leave
+  803994:	c3                   	ret
+  803995:	e8 4a fe ff ff       	call   8037e4 <dupq_flush>
+  80399a:	85 c0                	test   %eax,%eax
+  80399c:	79 b1                	jns    80394f <dupq_map+0x12>
+  80399e:	eb f3                	jmp    803993 <dupq_map+0x56>
+
+008039a0 <dupq_end>:
+  8039a0:	55                   	push   %ebp
+  8039a1:	89 e5                	mov    %esp,%ebp
+  8039a3:	53                   	push   %ebx
+  8039a4:	83 ec 04             	sub    $0x4,%esp
+  8039a7:	e8 38 fe ff ff       	call   8037e4 <dupq_flush>
+  8039ac:	89 c3                	mov    %eax,%ebx
+  8039ae:	83 ec 08             	sub    $0x8,%esp
+  8039b1:	68 00 00 40 00       	push   $0x400000
+  8039b6:	6a 00                	push   $0x0
+  8039b8:	e8 7e d7 ff ff       	call   80113b <sys_page_unmap>
+  8039bd:	89 d8                	mov    %ebx,%eax
+  8039bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c2:	c9                   	leave
+  8039c3:	c3                   	ret
+
+008039c4 <fork>:
+  8039c4:	55                   	push   %ebp
+  8039c5:	89 e5                	mov    %esp,%ebp
+  8039c7:	53                   	push   %ebx
+  8039c8:	83 ec 10             	sub    $0x10,%esp
+  8039cb:	68 26 38 80 00       	push   $0x803826
+  8039d0:	e8 ef 05 00 00       	call   803fc4 <set_pgfault_handler>
+  8039d5:	83 c4 08             	add    $0x8,%esp
+  8039d8:	6a 01                	push   $0x1
+  8039da:	6a 00                	push   $0x0
+  8039dc:	e8 3f d8 ff ff       	call   801220 <sys_env_set_cow>
+  8039e1:	e8 97 d7 ff ff       	call   80117d <sys_fork>
+  8039e6:	89 c3                	mov    %eax,%ebx
+  8039e8:	83 c4 10             	add    $0x10,%esp
+  8039eb:	85 c0                	test   %eax,%eax
+  8039ed:	74 07                	je     8039f6 <fork+0x32>
+  8039ef:	89 d8                	mov    %ebx,%eax
+  8039f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039f4:	c9                   	leave
+  8039f5:	c3                   	ret
+  8039f6:	e8 04 d6 ff ff       	call   800fff <sys_getenvid>
+  8039fb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a00:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  803a06:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a0b:	a3 90 87 80 00       	mov    %eax,0x808790
+  803a10:	eb dd                	jmp    8039ef <fork+0x2b>
+
+00803a12 <sfork>:
+  803a12:	55                   	push   %ebp
+  803a13:	89 e5                	mov    %esp,%ebp
+  803a15:	57                   	push   %edi
+  803a16:	56                   	push   %esi
+  803a17:	53                   	push   %ebx
+  803a18:	83 ec 1c             	sub    $0x1c,%esp
+  803a1b:	e8 df d5 ff ff       	call   800fff <sys_getenvid>
+  803a20:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803a23:	83 ec 0c             	sub    $0xc,%esp
+  803a26:	68 26 38 80 00       	push   $0x803826
+  803a2b:	e8 94 05 00 00       	call   803fc4 <set_pgfault_handler>
+  803a30:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a35:	cd 30                	int    $0x30
+  803a37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803a3a:	83 c4 10             	add    $0x10,%esp
+  803a3d:	85 c0                	test   %eax,%eax
+  803a3f:	0f 88 45 02 00 00    	js     803c8a <sfork+0x278>
+  803a45:	89 c6                	mov    %eax,%esi
+  803a47:	74 17                	je     803a60 <sfork+0x4e>
+  803a49:	e8 cf fe ff ff       	call   80391d <dupq_begin>
+  803a4e:	85 c0                	test   %eax,%eax
+  803a50:	0f 88 40 02 00 00    	js     803c96 <sfork+0x284>
+  803a56:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a5b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  803a5e:	eb 39                	jmp    803a99 <sfork+0x87>
+  803a60:	e8 9a d5 ff ff       	call   800fff <sys_getenvid>
+  803a65:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a6a:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  803a70:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a75:	a3 90 87 80 00       	mov    %eax,0x808790
+  803a7a:	e9 23 01 00 00       	jmp    803ba2 <sfork+0x190>
+  803a7f:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803a86:	a8 01                	test   $0x1,%al
+  803a88:	75 5b                	jne    803ae5 <sfork+0xd3>
+  803a8a:	83 c7 01             	add    $0x1,%edi
+  803a8d:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  803a93:	0f 84 40 01 00 00    	je     803bd9 <sfork+0x1c7>
+  803a99:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803aa0:	a8 01                	test   $0x1,%al
+  803aa2:	74 db                	je     803a7f <sfork+0x6d>
+  803aa4:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803aab:	a8 80                	test   $0x80,%al
+  803aad:	74 d0                	je     803a7f <sfork+0x6d>
+  803aaf:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803ab6:	25 07 0e 00 00       	and    $0xe07,%eax
+  803abb:	0c 80                	or     $0x80,%al
+  803abd:	50                   	push   %eax
+  803abe:	ff 75 e4             	push   -0x1c(%ebp)
+  803ac1:	89 f8                	mov    %edi,%eax
+  803ac3:	c1 e0 16             	shl    $0x16,%eax
+  803ac6:	c1 e8 0c             	shr    $0xc,%eax
+  803ac9:	50                   	push   %eax
+  803aca:	ff 75 e0             	push   -0x20(%ebp)
+  803acd:	e8 6b fe ff ff       	call   80393d <dupq_map>
+  803ad2:	83 c4 10             	add    $0x10,%esp
+  803ad5:	85 c0                	test   %eax,%eax
+  803ad7:	79 b1                	jns    803a8a <sfork+0x78>
+  803ad9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803ae0:	e9 bd 00 00 00       	jmp    803ba2 <sfork+0x190>
+  803ae5:	89 fe                	mov    %edi,%esi
+  803ae7:	c1 e6 16             	shl    $0x16,%esi
+  803aea:	89 f0                	mov    %esi,%eax
+  803aec:	c1 e8 0c             	shr    $0xc,%eax
+  803aef:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803af4:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803af7:	eb 57                	jmp    803b50 <sfork+0x13e>
+  803af9:	e8 01 d5 ff ff       	call   800fff <sys_getenvid>
+  803afe:	89 c7                	mov    %eax,%edi
+  803b00:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  803b05:	f6 c4 04             	test   $0x4,%ah
+  803b08:	0f 85 9f 00 00 00    	jne    803bad <sfork+0x19b>
+  803b0e:	a9 02 08 00 00       	test   $0x802,%eax
+  803b13:	0f 85 c5 01 00 00    	jne    803cde <sfork+0x2cc>
+  803b19:	6a 05                	push   $0x5
+  803b1b:	ff 75 e4             	push   -0x1c(%ebp)
+  803b1e:	68 fd e7 0e 00       	push   $0xee7fd
+  803b23:	57                   	push   %edi
+  803b24:	e8 14 fe ff ff       	call   80393d <dupq_map>
+  803b29:	83 c4 10             	add    $0x10,%esp
+  803b2c:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  803b32:	0f 84 91 00 00 00    	je     803bc9 <sfork+0x1b7>
+  803b38:	89 f0                	mov    %esi,%eax
+  803b3a:	09 d8                	or     %ebx,%eax
+  803b3c:	c1 e8 0c             	shr    $0xc,%eax
+  803b3f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803b45:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  803b4a:	0f 84 81 00 00 00    	je     803bd1 <sfork+0x1bf>
+  803b50:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  803b55:	74 a2                	je     803af9 <sfork+0xe7>
+  803b57:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803b5e:	f6 c2 01             	test   $0x1,%dl
+  803b61:	74 c9                	je     803b2c <sfork+0x11a>
+  803b63:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803b6a:	f6 c6 02             	test   $0x2,%dh
+  803b6d:	75 bd                	jne    803b2c <sfork+0x11a>
+  803b6f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803b76:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803b7d:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  803b83:	f7 d2                	not    %edx
+  803b85:	21 ca                	and    %ecx,%edx
+  803b87:	52                   	push   %edx
+  803b88:	ff 75 e4             	push   -0x1c(%ebp)
+  803b8b:	50                   	push   %eax
+  803b8c:	ff 75 e0             	push   -0x20(%ebp)
+  803b8f:	e8 a9 fd ff ff       	call   80393d <dupq_map>
+  803b94:	83 c4 10             	add    $0x10,%esp
+  803b97:	85 c0                	test   %eax,%eax
+  803b99:	79 91                	jns    803b2c <sfork+0x11a>
+  803b9b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803ba2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ba8:	5b                   	pop    %ebx
+  803ba9:	5e                   	pop    %esi
+  803baa:	5f                   	pop    %edi
+  803bab:	5d                   	pop    %ebp
+  803bac:	c3                   	ret
+  803bad:	25 07 0e 00 00       	and    $0xe07,%eax
+  803bb2:	50                   	push   %eax
+  803bb3:	ff 75 e4             	push   -0x1c(%ebp)
+  803bb6:	68 fd e7 0e 00       	push   $0xee7fd
+  803bbb:	57                   	push   %edi
+  803bbc:	e8 7c fd ff ff       	call   80393d <dupq_map>
+  803bc1:	83 c4 10             	add    $0x10,%esp
+  803bc4:	e9 63 ff ff ff       	jmp    803b2c <sfork+0x11a>
+  803bc9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803bcc:	e9 b9 fe ff ff       	jmp    803a8a <sfork+0x78>
+  803bd1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803bd4:	e9 b1 fe ff ff       	jmp    803a8a <sfork+0x78>
+  803bd9:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803bdc:	e8 bf fd ff ff       	call   8039a0 <dupq_end>
+  803be1:	85 c0                	test   %eax,%eax
+  803be3:	0f 88 b9 00 00 00    	js     803ca2 <sfork+0x290>
+  803be9:	83 ec 04             	sub    $0x4,%esp
+  803bec:	6a 07                	push   $0x7
+  803bee:	68 00 f0 7f ee       	push   $0xee7ff000
+  803bf3:	56                   	push   %esi
+  803bf4:	e8 70 d4 ff ff       	call   801069 <sys_page_alloc>
+  803bf9:	83 c4 10             	add    $0x10,%esp
+  803bfc:	85 c0                	test   %eax,%eax
+  803bfe:	0f 88 aa 00 00 00    	js     803cae <sfork+0x29c>
+  803c04:	83 ec 0c             	sub    $0xc,%esp
+  803c07:	6a 07                	push   $0x7
+  803c09:	68 00 f0 7f 00       	push   $0x7ff000
+  803c0e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803c11:	57                   	push   %edi
+  803c12:	68 00 f0 7f ee       	push   $0xee7ff000
+  803c17:	56                   	push   %esi
+  803c18:	e8 8f d4 ff ff       	call   8010ac <sys_page_map>
+  803c1d:	83 c4 20             	add    $0x20,%esp
+  803c20:	85 c0                	test   %eax,%eax
+  803c22:	0f 88 92 00 00 00    	js     803cba <sfork+0x2a8>
+  803c28:	83 ec 04             	sub    $0x4,%esp
+  803c2b:	68 00 10 00 00       	push   $0x1000
+  803c30:	68 00 f0 7f 00       	push   $0x7ff000
+  803c35:	68 00 f0 7f ee       	push   $0xee7ff000
+  803c3a:	e8 7a d1 ff ff       	call   800db9 <memmove>
+  803c3f:	83 c4 08             	add    $0x8,%esp
+  803c42:	68 00 f0 7f 00       	push   $0x7ff000
+  803c47:	57                   	push   %edi
+  803c48:	e8 ee d4 ff ff       	call   80113b <sys_page_unmap>
+  803c4d:	83 c4 10             	add    $0x10,%esp
+  803c50:	85 c0                	test   %eax,%eax
+  803c52:	78 72                	js     803cc6 <sfork+0x2b4>
+  803c54:	83 ec 08             	sub    $0x8,%esp
+  803c57:	68 3c 40 80 00       	push   $0x80403c
+  803c5c:	56                   	push   %esi
+  803c5d:	e8 20 d6 ff ff       	call   801282 <sys_env_set_pgfault_upcall>
+  803c62:	83 c4 10             	add    $0x10,%esp
+  803c65:	85 c0                	test   %eax,%eax
+  803c67:	78 69                	js     803cd2 <sfork+0x2c0>
+  803c69:	83 ec 08             	sub    $0x8,%esp
+  803c6c:	6a 02                	push   $0x2
+  803c6e:	56                   	push   %esi
+  803c6f:	e8 28 d5 ff ff       	call   80119c <sys_env_set_status>
+  803c74:	83 c4 10             	add    $0x10,%esp
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803c7e:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  803c82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c85:	e9 18 ff ff ff       	jmp    803ba2 <sfork+0x190>
+  803c8a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803c91:	e9 0c ff ff ff       	jmp    803ba2 <sfork+0x190>
+  803c96:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803c9d:	e9 00 ff ff ff       	jmp    803ba2 <sfork+0x190>
+  803ca2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803ca9:	e9 f4 fe ff ff       	jmp    803ba2 <sfork+0x190>
+  803cae:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803cb5:	e9 e8 fe ff ff       	jmp    803ba2 <sfork+0x190>
+  803cba:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803cc1:	e9 dc fe ff ff       	jmp    803ba2 <sfork+0x190>
+  803cc6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803ccd:	e9 d0 fe ff ff       	jmp    803ba2 <sfork+0x190>
+  803cd2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803cd9:	e9 c4 fe ff ff       	jmp    803ba2 <sfork+0x190>
+  803cde:	68 05 08 00 00       	push   $0x805
+  803ce3:	ff 75 e4             	push   -0x1c(%ebp)
+  803ce6:	68 fd e7 0e 00       	push   $0xee7fd
+  803ceb:	57                   	push   %edi
+  803cec:	e8 4c fc ff ff       	call   80393d <dupq_map>
+  803cf1:	83 c4 10             	add    $0x10,%esp
+  803cf4:	85 c0                	test   %eax,%eax
+  803cf6:	0f 88 30 fe ff ff    	js     803b2c <sfork+0x11a>
+  803cfc:	68 05 08 00 00       	push   $0x805
+  803d01:	57                   	push   %edi
+  803d02:	68 fd e7 0e 00       	push   $0xee7fd
+  803d07:	57                   	push   %edi
+  803d08:	e8 30 fc ff ff       	call   80393d <dupq_map>
+  803d0d:	83 c4 10             	add    $0x10,%esp
+  803d10:	e9 17 fe ff ff       	jmp    803b2c <sfork+0x11a>
+
+00803d15 <ipc_recv>:
+  803d15:	55                   	push   %ebp
+  803d16:	89 e5                	mov    %esp,%ebp
+  803d18:	56                   	push   %esi
+  803d19:	53                   	push   %ebx
+  803d1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d23:	85 c0                	test   %eax,%eax
+  803d25:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803d2a:	0f 44 c2             	cmove  %edx,%eax
+  803d2d:	83 ec 0c             	sub    $0xc,%esp
+  803d30:	50                   	push   %eax
+  803d31:	e8 de d5 ff ff       	call   801314 <sys_ipc_recv>
+  803d36:	83 c4 10             	add    $0x10,%esp
+  803d39:	85 c0                	test   %eax,%eax
+  803d3b:	78 2a                	js     803d67 <ipc_recv+0x52>
+  803d3d:	a1 90 87 80 00       	mov    0x808790,%eax
+  803d42:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803d48:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803d4e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803d54:	85 f6                	test   %esi,%esi
+  803d56:	74 02                	je     803d5a <ipc_recv+0x45>
+  803d58:	89 0e                	mov    %ecx,(%esi)
+  803d5a:	85 db                	test   %ebx,%ebx
+  803d5c:	74 02                	je     803d60 <ipc_recv+0x4b>
+  803d5e:	89 13                	mov    %edx,(%ebx)
+  803d60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d63:	5b                   	pop    %ebx
+  803d64:	5e                   	pop    %esi
+  803d65:	5d                   	pop    %ebp
+  803d66:	c3                   	ret
+  803d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d71:	eb e1                	jmp    803d54 <ipc_recv+0x3f>
+
+00803d73 <ipc_send>:
+  803d73:	55                   	push   %ebp
+  803d74:	89 e5                	mov    %esp,%ebp
+  803d76:	57                   	push   %edi
+  803d77:	56                   	push   %esi
+  803d78:	53                   	push   %ebx
+  803d79:	83 ec 0c             	sub    $0xc,%esp
+  803d7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803d7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d82:	8b 75 14             	mov    0x14(%ebp),%esi
+  803d85:	85 db                	test   %ebx,%ebx
+  803d87:	74 1e                	je     803da7 <ipc_send+0x34>
+  803d89:	56                   	push   %esi
+  803d8a:	53                   	push   %ebx
+  803d8b:	57                   	push   %edi
+  803d8c:	ff 75 08             	push   0x8(%ebp)
+  803d8f:	e8 0d d6 ff ff       	call   8013a1 <sys_ipc_send>
+  803d94:	83 c4 10             	add    $0x10,%esp
+  803d97:	85 c0                	test   %eax,%eax
+  803d99:	74 2a                	je     803dc5 <ipc_send+0x52>
+  803d9b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803d9e:	75 13                	jne    803db3 <ipc_send+0x40>
+  803da0:	e8 79 d2 ff ff       	call   80101e <sys_yield>
+  803da5:	eb e2                	jmp    803d89 <ipc_send+0x16>
+  803da7:	be 00 00 00 00       	mov    $0x0,%esi
+  803dac:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803db1:	eb d6                	jmp    803d89 <ipc_send+0x16>
+  803db3:	50                   	push   %eax
+  803db4:	68 04 4a 80 00       	push   $0x804a04
+  803db9:	6a 4f                	push   $0x4f
+  803dbb:	68 47 4a 80 00       	push   $0x804a47
+  803dc0:	e8 72 c6 ff ff       	call   800437 <_panic>
+  803dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dc8:	5b                   	pop    %ebx
+  803dc9:	5e                   	pop    %esi
+  803dca:	5f                   	pop    %edi
+  803dcb:	5d                   	pop    %ebp
+  803dcc:	c3                   	ret
+
+00803dcd <ipc_call>:
+  803dcd:	55                   	push   %ebp
+  803dce:	89 e5                	mov    %esp,%ebp
+  803dd0:	57                   	push   %edi
+  803dd1:	56                   	push   %esi
+  803dd2:	53                   	push   %ebx
+  803dd3:	83 ec 0c             	sub    $0xc,%esp
+  803dd6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803dda:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803ddf:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803de3:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803de7:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803dec:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803df0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803df4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803df9:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803dfd:	eb 05                	jmp    803e04 <ipc_call+0x37>
+  803dff:	e8 1a d2 ff ff       	call   80101e <sys_yield>
+  803e04:	83 ec 0c             	sub    $0xc,%esp
+  803e07:	56                   	push   %esi
+  803e08:	53                   	push   %ebx
+  803e09:	57                   	push   %edi
+  803e0a:	ff 75 0c             	push   0xc(%ebp)
+  803e0d:	ff 75 08             	push   0x8(%ebp)
+  803e10:	e8 dc d5 ff ff       	call   8013f1 <sys_ipc_call>
+  803e15:	83 c4 20             	add    $0x20,%esp
+  803e18:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803e1b:	74 e2                	je     803dff <ipc_call+0x32>
+  803e1d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803e20:	74 2d                	je     803e4f <ipc_call+0x82>
+  803e22:	85 c0                	test   %eax,%eax
+  803e24:	78 4f                	js     803e75 <ipc_call+0xa8>
+  803e26:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803e2a:	74 10                	je     803e3c <ipc_call+0x6f>
+  803e2c:	a1 90 87 80 00       	mov    0x808790,%eax
+  803e31:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803e37:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803e3a:	89 02                	mov    %eax,(%edx)
+  803e3c:	a1 90 87 80 00       	mov    0x808790,%eax
+  803e41:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803e47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e4a:	5b                   	pop    %ebx
+  803e4b:	5e                   	pop    %esi
+  803e4c:	5f                   	pop    %edi
+  803e4d:	5d                   	pop    %ebp
+  803e4e:	c3                   	ret
+  803e4f:	ff 75 14             	push   0x14(%ebp)
+  803e52:	ff 75 10             	push   0x10(%ebp)
+  803e55:	ff 75 0c             	push   0xc(%ebp)
+  803e58:	ff 75 08             	push   0x8(%ebp)
+  803e5b:	e8 13 ff ff ff       	call   803d73 <ipc_send>
+  803e60:	83 c4 0c             	add    $0xc,%esp
+  803e63:	ff 75 1c             	push   0x1c(%ebp)
+  803e66:	ff 75 18             	push   0x18(%ebp)
+  803e69:	6a 00                	push   $0x0
+  803e6b:	e8 a5 fe ff ff       	call   803d15 <ipc_recv>
+  803e70:	83 c4 10             	add    $0x10,%esp
+  803e73:	eb d2                	jmp    803e47 <ipc_call+0x7a>
+  803e75:	50                   	push   %eax
+  803e76:	68 51 4a 80 00       	push   $0x804a51
+  803e7b:	6a 6d                	push   $0x6d
+  803e7d:	68 47 4a 80 00       	push   $0x804a47
+  803e82:	e8 b0 c5 ff ff       	call   800437 <_panic>
+
+00803e87 <ipc_reply_recv>:
+  803e87:	55                   	push   %ebp
+  803e88:	89 e5                	mov    %esp,%ebp
+  803e8a:	57                   	push   %edi
+  803e8b:	56                   	push   %esi
+  803e8c:	53                   	push   %ebx
+  803e8d:	83 ec 0c             	sub    $0xc,%esp
+  803e90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803e93:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803e96:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803e99:	85 db                	test   %ebx,%ebx
+  803e9b:	0f 84 ac 00 00 00    	je     803f4d <ipc_reply_recv+0xc6>
+  803ea1:	85 f6                	test   %esi,%esi
+  803ea3:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803ea8:	0f 45 c6             	cmovne %esi,%eax
+  803eab:	83 ec 0c             	sub    $0xc,%esp
+  803eae:	50                   	push   %eax
+  803eaf:	ff 75 14             	push   0x14(%ebp)
+  803eb2:	53                   	push   %ebx
+  803eb3:	ff 75 0c             	push   0xc(%ebp)
+  803eb6:	ff 75 08             	push   0x8(%ebp)
+  803eb9:	e8 54 d5 ff ff       	call   801412 <sys_ipc_reply_recv>
+  803ebe:	83 c4 20             	add    $0x20,%esp
+  803ec1:	85 c0                	test   %eax,%eax
+  803ec3:	78 3a                	js     803eff <ipc_reply_recv+0x78>
+  803ec5:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803ec9:	74 10                	je     803edb <ipc_reply_recv+0x54>
+  803ecb:	a1 90 87 80 00       	mov    0x808790,%eax
+  803ed0:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803ed6:	8b 55 18             	mov    0x18(%ebp),%edx
+  803ed9:	89 02                	mov    %eax,(%edx)
+  803edb:	85 ff                	test   %edi,%edi
+  803edd:	74 0d                	je     803eec <ipc_reply_recv+0x65>
+  803edf:	a1 90 87 80 00       	mov    0x808790,%eax
+  803ee4:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803eea:	89 07                	mov    %eax,(%edi)
+  803eec:	a1 90 87 80 00       	mov    0x808790,%eax
+  803ef1:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803ef7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803efa:	5b                   	pop    %ebx
+  803efb:	5e                   	pop    %esi
+  803efc:	5f                   	pop    %edi
+  803efd:	5d                   	pop    %ebp
+  803efe:	c3                   	ret
+  803eff:	ff 75 14             	push   0x14(%ebp)
+  803f02:	53                   	push   %ebx
+  803f03:	ff 75 0c             	push   0xc(%ebp)
+  803f06:	ff 75 08             	push   0x8(%ebp)
+  803f09:	e8 b6 d3 ff ff       	call   8012c4 <sys_ipc_try_send>
+  803f0e:	89 c2                	mov    %eax,%edx
+  803f10:	c1 ea 1f             	shr    $0x1f,%edx
+  803f13:	83 c4 10             	add    $0x10,%esp
+  803f16:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803f19:	0f 95 c1             	setne  %cl
+  803f1c:	84 d1                	test   %dl,%cl
+  803f1e:	74 05                	je     803f25 <ipc_reply_recv+0x9e>
+  803f20:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803f23:	75 12                	jne    803f37 <ipc_reply_recv+0xb0>
+  803f25:	83 ec 04             	sub    $0x4,%esp
+  803f28:	57                   	push   %edi
+  803f29:	56                   	push   %esi
+  803f2a:	ff 75 18             	push   0x18(%ebp)
+  803f2d:	e8 e3 fd ff ff       	call   803d15 <ipc_recv>
+  803f32:	83 c4 10             	add    $0x10,%esp
+  803f35:	eb c0                	jmp    803ef7 <ipc_reply_recv+0x70>
+  803f37:	83 ec 04             	sub    $0x4,%esp
+  803f3a:	50                   	push   %eax
+  803f3b:	ff 75 08             	push   0x8(%ebp)
+  803f3e:	68 24 4a 80 00       	push   $0x804a24
+  803f43:	e8 ca c5 ff ff       	call   800512 <cprintf>
+  803f48:	83 c4 10             	add    $0x10,%esp
+  803f4b:	eb d8                	jmp    803f25 <ipc_reply_recv+0x9e>
+  803f4d:	85 f6                	test   %esi,%esi
+  803f4f:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803f54:	0f 45 c6             	cmovne %esi,%eax
+  803f57:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803f5c:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803f63:	e9 43 ff ff ff       	jmp    803eab <ipc_reply_recv+0x24>
+
+00803f68 <ipc_find_env>:
+  803f68:	55                   	push   %ebp
+  803f69:	89 e5                	mov    %esp,%ebp
+  803f6b:	83 ec 14             	sub    $0x14,%esp
+  803f6e:	ff 75 08             	push   0x8(%ebp)
+  803f71:	e8 ec d2 ff ff       	call   801262 <sys_env_service>
+  803f76:	85 c0                	test   %eax,%eax
+  803f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f7d:	0f 48 c2             	cmovs  %edx,%eax
+  803f80:	c9                   	leave
+  803f81:	c3                   	ret
+
+00803f82 <pageref>:
+  803f82:	55                   	push   %ebp
+  803f83:	89 e5                	mov    %esp,%ebp
+  803f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f88:	89 c2                	mov    %eax,%edx
+  803f8a:	c1 ea 16             	shr    $0x16,%edx
+  803f8d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f99:	f6 c1 01             	test   $0x1,%cl
+  803f9c:	74 22                	je     803fc0 <pageref+0x3e>
+  803f9e:	c1 e8 0c             	shr    $0xc,%eax
+  803fa1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803fa8:	a8 01                	test   $0x1,%al
+  803faa:	74 14                	je     803fc0 <pageref+0x3e>
+  803fac:	c1 e8 0c             	shr    $0xc,%eax
+  803faf:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803fb2:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803fb9:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803fbd:	0f b7 d2             	movzwl %dx,%edx
+  803fc0:	89 d0                	mov    %edx,%eax
+  803fc2:	5d                   	pop    %ebp
+  803fc3:	c3                   	ret
+
+00803fc4 <set_pgfault_handler>:
+  803fc4:	55                   	push   %ebp
+  803fc5:	89 e5                	mov    %esp,%ebp
+  803fc7:	53                   	push   %ebx
+  803fc8:	83 ec 04             	sub    $0x4,%esp
+  803fcb:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803fd2:	74 0d                	je     803fe1 <set_pgfault_handler+0x1d>
+  803fd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fd7:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  803fdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fdf:	c9                   	leave
+  803fe0:	c3                   	ret
+  803fe1:	e8 19 d0 ff ff       	call   800fff <sys_getenvid>
+  803fe6:	89 c3                	mov    %eax,%ebx
+  803fe8:	83 ec 04             	sub    $0x4,%esp
+  803feb:	6a 07                	push   $0x7
+  803fed:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ff2:	50                   	push   %eax
+  803ff3:	e8 71 d0 ff ff       	call   801069 <sys_page_alloc>
+  803ff8:	83 c4 10             	add    $0x10,%esp
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	78 29                	js     804028 <set_pgfault_handler+0x64>
+  803fff:	83 ec 08             	sub    $0x8,%esp
+  804002:	68 3c 40 80 00       	push   $0x80403c
+  804007:	53                   	push   %ebx
+  804008:	e8 75 d2 ff ff       	call   801282 <sys_env_set_pgfault_upcall>
+  80400d:	83 c4 10             	add    $0x10,%esp
+  804010:	85 c0                	test   %eax,%eax
+  804012:	79 c0                	jns    803fd4 <set_pgfault_handler+0x10>
+  804014:	83 ec 04             	sub    $0x4,%esp
+  804017:	68 a8 4a 80 00       	push   $0x804aa8
+  80401c:	6a 27                	push   $0x27
+  80401e:	68 da 4a 80 00       	push   $0x804ada
+  804023:	e8 0f c4 ff ff       	call   800437 <_panic>
+  804028:	83 ec 04             	sub    $0x4,%esp
+  80402b:	68 70 4a 80 00       	push   $0x804a70
+  804030:	6a 23                	push   $0x23
+  804032:	68 da 4a 80 00       	push   $0x804ada
+  804037:	e8 fb c3 ff ff       	call   800437 <_panic>
+
+0080403c <_pgfault_upcall>:
+  80403c:	54                   	push   %esp
+  80403d:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  804042:	ff d0                	call   *%eax
+  804044:	83 c4 04             	add    $0x4,%esp
+  804047:	89 e3                	mov    %esp,%ebx
+  804049:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80404d:	8b 54 24 30          	mov    0x30(%esp),%edx
+  804051:	89 d4                	mov    %edx,%esp
+  804053:	51                   	push   %ecx
+  804054:	89 dc                	mov    %ebx,%esp
+  804056:	83 ea 04             	sub    $0x4,%edx
+  804059:	89 54 24 30          	mov    %edx,0x30(%esp)
+  80405d:	83 c4 08             	add    $0x8,%esp
+  804060:	61                   	popa
+  804061:	83 c4 04             	add    $0x4,%esp
+  804064:	9d                   	popf
+  804065:	5c                   	pop    %esp
+  804066:	c3                   	ret
+
+00804067 <__udivmoddi4>:
+  804067:	55                   	push   %ebp
+  804068:	57                   	push   %edi
+  804069:	56                   	push   %esi
+  80406a:	53                   	push   %ebx
+  80406b:	83 ec 24             	sub    $0x24,%esp
+  80406e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804072:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804076:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80407a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80407e:	8b 44 24 40          	mov    0x40(%esp),%eax
+  804082:	8b 54 24 44          	mov    0x44(%esp),%edx
+  804086:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80408a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80408e:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  804092:	b8 00 00 00 00       	mov    $0x0,%eax
+  804097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80409c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8040a1:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8040a8:	00 
+  8040a9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8040b0:	00 
+  8040b1:	89 fb                	mov    %edi,%ebx
+  8040b3:	eb 08                	jmp    8040bd <__udivmoddi4+0x56>
+  8040b5:	83 e9 01             	sub    $0x1,%ecx
+  8040b8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8040bb:	74 68                	je     804125 <__udivmoddi4+0xbe>
+  8040bd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8040c1:	01 c0                	add    %eax,%eax
+  8040c3:	89 c6                	mov    %eax,%esi
+  8040c5:	89 d7                	mov    %edx,%edi
+  8040c7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8040cb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8040cf:	0f ad d0             	shrd   %cl,%edx,%eax
+  8040d2:	d3 ea                	shr    %cl,%edx
+  8040d4:	f6 c1 20             	test   $0x20,%cl
+  8040d7:	74 04                	je     8040dd <__udivmoddi4+0x76>
+  8040d9:	89 d0                	mov    %edx,%eax
+  8040db:	31 d2                	xor    %edx,%edx
+  8040dd:	83 e0 01             	and    $0x1,%eax
+  8040e0:	89 04 24             	mov    %eax,(%esp)
+  8040e3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8040ea:	00 
+  8040eb:	8b 04 24             	mov    (%esp),%eax
+  8040ee:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8040f2:	09 f0                	or     %esi,%eax
+  8040f4:	09 fa                	or     %edi,%edx
+  8040f6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8040fa:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8040fe:	39 f0                	cmp    %esi,%eax
+  804100:	89 d5                	mov    %edx,%ebp
+  804102:	19 fd                	sbb    %edi,%ebp
+  804104:	72 af                	jb     8040b5 <__udivmoddi4+0x4e>
+  804106:	29 f0                	sub    %esi,%eax
+  804108:	19 fa                	sbb    %edi,%edx
+  80410a:	89 cf                	mov    %ecx,%edi
+  80410c:	c1 ef 05             	shr    $0x5,%edi
+  80410f:	83 e7 01             	and    $0x1,%edi
+  804112:	89 fe                	mov    %edi,%esi
+  804114:	83 f6 01             	xor    $0x1,%esi
+  804117:	d3 e6                	shl    %cl,%esi
+  804119:	d3 e7                	shl    %cl,%edi
+  80411b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80411f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804123:	eb 90                	jmp    8040b5 <__udivmoddi4+0x4e>
+  804125:	85 db                	test   %ebx,%ebx
+  804127:	74 05                	je     80412e <__udivmoddi4+0xc7>
+  804129:	89 03                	mov    %eax,(%ebx)
+  80412b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80412e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804132:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804136:	83 c4 24             	add    $0x24,%esp
+  804139:	5b                   	pop    %ebx
+  80413a:	5e                   	pop    %esi
+  80413b:	5f                   	pop    %edi
+  80413c:	5d                   	pop    %ebp
+  80413d:	c3                   	ret
+
+0080413e <__udivdi3>:
+  80413e:	83 ec 08             	sub    $0x8,%esp
+  804141:	6a 00                	push   $0x0
+  804143:	ff 74 24 1c          	push   0x1c(%esp)
+  804147:	ff 74 24 1c          	push   0x1c(%esp)
+  80414b:	ff 74 24 1c          	push   0x1c(%esp)
+  80414f:	ff 74 24 1c          	push   0x1c(%esp)
+  804153:	e8 0f ff ff ff       	call   804067 <__udivmoddi4>
+  804158:	83 c4 1c             	add    $0x1c,%esp
+  80415b:	c3                   	ret
+
+0080415c <__umoddi3>:
+  80415c:	83 ec 18             	sub    $0x18,%esp
+  80415f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804163:	50                   	push   %eax
+  804164:	ff 74 24 2c          	push   0x2c(%esp)
+  804168:	ff 74 24 2c          	push   0x2c(%esp)
+  80416c:	ff 74 24 2c          	push   0x2c(%esp)
+  804170:	ff 74 24 2c          	push   0x2c(%esp)
+  804174:	e8 ee fe ff ff       	call   804067 <__udivmoddi4>
+  804179:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80417d:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804181:	83 c4 2c             	add    $0x2c,%esp
+  804184:	c3                   	ret
+
+00804185 <__divdi3>:
+  804185:	53                   	push   %ebx
+  804186:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80418a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80418e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804192:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804196:	85 d2                	test   %edx,%edx
+  804198:	78 12                	js     8041ac <__divdi3+0x27>
+  80419a:	85 db                	test   %ebx,%ebx
+  80419c:	78 2e                	js     8041cc <__divdi3+0x47>
+  80419e:	53                   	push   %ebx
+  80419f:	51                   	push   %ecx
+  8041a0:	52                   	push   %edx
+  8041a1:	50                   	push   %eax
+  8041a2:	e8 97 ff ff ff       	call   80413e <__udivdi3>
+  8041a7:	83 c4 10             	add    $0x10,%esp
+  8041aa:	eb 1e                	jmp    8041ca <__divdi3+0x45>
+  8041ac:	f7 d8                	neg    %eax
+  8041ae:	83 d2 00             	adc    $0x0,%edx
+  8041b1:	f7 da                	neg    %edx
+  8041b3:	85 db                	test   %ebx,%ebx
+  8041b5:	78 2a                	js     8041e1 <__divdi3+0x5c>
+  8041b7:	53                   	push   %ebx
+  8041b8:	51                   	push   %ecx
+  8041b9:	52                   	push   %edx
+  8041ba:	50                   	push   %eax
+  8041bb:	e8 7e ff ff ff       	call   80413e <__udivdi3>
+  8041c0:	83 c4 10             	add    $0x10,%esp
+  8041c3:	f7 d8                	neg    %eax
+  8041c5:	83 d2 00             	adc    $0x0,%edx
+  8041c8:	f7 da                	neg    %edx
+  8041ca:	5b                   	pop    %ebx
+  8041cb:	c3                   	ret
+  8041cc:	f7 d9                	neg    %ecx
+  8041ce:	83 d3 00             	adc    $0x0,%ebx
+  8041d1:	f7 db                	neg    %ebx
+  8041d3:	53                   	push   %ebx
+  8041d4:	51                   	push   %ecx
+  8041d5:	52                   	push   %edx
+  8041d6:	50                   	push   %eax
+  8041d7:	e8 62 ff ff ff       	call   80413e <__udivdi3>
+  8041dc:	83 c4 10             	add    $0x10,%esp
+  8041df:	eb e2                	jmp    8041c3 <__divdi3+0x3e>
+  8041e1:	f7 d9                	neg    %ecx
+  8041e3:	83 d3 00             	adc    $0x0,%ebx
+  8041e6:	f7 db                	neg    %ebx
+  8041e8:	53                   	push   %ebx
+  8041e9:	51                   	push   %ecx
+  8041ea:	52                   	push   %edx
+  8041eb:	50                   	push   %eax
+  8041ec:	e8 4d ff ff ff       	call   80413e <__udivdi3>
+  8041f1:	83 c4 10             	add    $0x10,%esp
+  8041f4:	eb d4                	jmp    8041ca <__divdi3+0x45>
+
+008041f6 <__moddi3>:
+  8041f6:	55                   	push   %ebp
+  8041f7:	57                   	push   %edi
+  8041f8:	56                   	push   %esi
+  8041f9:	53                   	push   %ebx
+  8041fa:	83 ec 0c             	sub    $0xc,%esp
+  8041fd:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  804201:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  804205:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804209:	89 e9                	mov    %ebp,%ecx
+  80420b:	f7 d9                	neg    %ecx
+  80420d:	89 d0                	mov    %edx,%eax
+  80420f:	83 d0 00             	adc    $0x0,%eax
+  804212:	f7 d8                	neg    %eax
+  804214:	0f 49 e9             	cmovns %ecx,%ebp
+  804217:	0f 49 d0             	cmovns %eax,%edx
+  80421a:	52                   	push   %edx
+  80421b:	55                   	push   %ebp
+  80421c:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804220:	f7 da                	neg    %edx
+  804222:	89 d8                	mov    %ebx,%eax
+  804224:	83 d0 00             	adc    $0x0,%eax
+  804227:	f7 d8                	neg    %eax
+  804229:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80422e:	89 54 24 08          	mov    %edx,0x8(%esp)
+  804232:	0f 48 c3             	cmovs  %ebx,%eax
+  804235:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  804239:	ff 74 24 0c          	push   0xc(%esp)
+  80423d:	ff 74 24 0c          	push   0xc(%esp)
+  804241:	e8 16 ff ff ff       	call   80415c <__umoddi3>
+  804246:	83 c4 10             	add    $0x10,%esp
+  804249:	85 db                	test   %ebx,%ebx
+  80424b:	78 08                	js     804255 <__moddi3+0x5f>
+  80424d:	83 c4 0c             	add    $0xc,%esp
+  804250:	5b                   	pop    %ebx
+  804251:	5e                   	pop    %esi
+  804252:	5f                   	pop    %edi
+  804253:	5d                   	pop    %ebp
+  804254:	c3                   	ret
+  804255:	f7 d8                	neg    %eax
+  804257:	83 d2 00             	adc    $0x0,%edx
+  80425a:	f7 da                	neg    %edx
+  80425c:	eb ef                	jmp    80424d <__moddi3+0x57>
@@ -0,0 +1,5498 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 94 02 00 00       	call   8002c5 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	83 3d d0 51 80 00 00 	cmpl   $0x0,0x8051d0
+  800044:	74 20                	je     800066 <ls1+0x33>
+  800046:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+  80004a:	19 c0                	sbb    %eax,%eax
+  80004c:	83 e0 c9             	and    $0xffffffc9,%eax
+  80004f:	83 c0 64             	add    $0x64,%eax
+  800052:	83 ec 04             	sub    $0x4,%esp
+  800055:	50                   	push   %eax
+  800056:	ff 75 10             	push   0x10(%ebp)
+  800059:	68 62 36 80 00       	push   $0x803662
+  80005e:	e8 d1 25 00 00       	call   802634 <printf>
+  800063:	83 c4 10             	add    $0x10,%esp
+  800066:	85 db                	test   %ebx,%ebx
+  800068:	74 1c                	je     800086 <ls1+0x53>
+  80006a:	b8 c8 36 80 00       	mov    $0x8036c8,%eax
+  80006f:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800072:	75 49                	jne    8000bd <ls1+0x8a>
+  800074:	83 ec 04             	sub    $0x4,%esp
+  800077:	50                   	push   %eax
+  800078:	53                   	push   %ebx
+  800079:	68 6b 36 80 00       	push   $0x80366b
+  80007e:	e8 b1 25 00 00       	call   802634 <printf>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 ec 08             	sub    $0x8,%esp
+  800089:	ff 75 14             	push   0x14(%ebp)
+  80008c:	68 1b 3b 80 00       	push   $0x803b1b
+  800091:	e8 9e 25 00 00       	call   802634 <printf>
+  800096:	83 c4 10             	add    $0x10,%esp
+  800099:	83 3d 38 51 80 00 00 	cmpl   $0x0,0x805138
+  8000a0:	74 06                	je     8000a8 <ls1+0x75>
+  8000a2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8000a6:	75 35                	jne    8000dd <ls1+0xaa>
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	68 c7 36 80 00       	push   $0x8036c7
+  8000b0:	e8 7f 25 00 00       	call   802634 <printf>
+  8000b5:	83 c4 10             	add    $0x10,%esp
+  8000b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000bb:	c9                   	leave
+  8000bc:	c3                   	ret
+  8000bd:	83 ec 0c             	sub    $0xc,%esp
+  8000c0:	53                   	push   %ebx
+  8000c1:	e8 fe 09 00 00       	call   800ac4 <strlen>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000ce:	b8 c8 36 80 00       	mov    $0x8036c8,%eax
+  8000d3:	ba 60 36 80 00       	mov    $0x803660,%edx
+  8000d8:	0f 45 c2             	cmovne %edx,%eax
+  8000db:	eb 97                	jmp    800074 <ls1+0x41>
+  8000dd:	83 ec 0c             	sub    $0xc,%esp
+  8000e0:	68 60 36 80 00       	push   $0x803660
+  8000e5:	e8 4a 25 00 00       	call   802634 <printf>
+  8000ea:	83 c4 10             	add    $0x10,%esp
+  8000ed:	eb b9                	jmp    8000a8 <ls1+0x75>
+
+008000ef <lsdir>:
+  8000ef:	55                   	push   %ebp
+  8000f0:	89 e5                	mov    %esp,%ebp
+  8000f2:	57                   	push   %edi
+  8000f3:	56                   	push   %esi
+  8000f4:	53                   	push   %ebx
+  8000f5:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  8000fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000fe:	6a 00                	push   $0x0
+  800100:	57                   	push   %edi
+  800101:	e8 bd 22 00 00       	call   8023c3 <open>
+  800106:	89 c3                	mov    %eax,%ebx
+  800108:	83 c4 10             	add    $0x10,%esp
+  80010b:	85 c0                	test   %eax,%eax
+  80010d:	78 50                	js     80015f <lsdir+0x70>
+  80010f:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800115:	83 ec 04             	sub    $0x4,%esp
+  800118:	68 00 01 00 00       	push   $0x100
+  80011d:	56                   	push   %esi
+  80011e:	53                   	push   %ebx
+  80011f:	e8 69 1b 00 00       	call   801c8d <readn>
+  800124:	83 c4 10             	add    $0x10,%esp
+  800127:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80012c:	75 47                	jne    800175 <lsdir+0x86>
+  80012e:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  800135:	74 de                	je     800115 <lsdir+0x26>
+  800137:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80013d:	50                   	push   %eax
+  80013e:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  800144:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  80014b:	0f 94 c0             	sete   %al
+  80014e:	0f b6 c0             	movzbl %al,%eax
+  800151:	50                   	push   %eax
+  800152:	ff 75 0c             	push   0xc(%ebp)
+  800155:	e8 d9 fe ff ff       	call   800033 <ls1>
+  80015a:	83 c4 10             	add    $0x10,%esp
+  80015d:	eb b6                	jmp    800115 <lsdir+0x26>
+  80015f:	83 ec 0c             	sub    $0xc,%esp
+  800162:	50                   	push   %eax
+  800163:	57                   	push   %edi
+  800164:	68 70 36 80 00       	push   $0x803670
+  800169:	6a 1d                	push   $0x1d
+  80016b:	68 7c 36 80 00       	push   $0x80367c
+  800170:	e8 c9 01 00 00       	call   80033e <_panic>
+  800175:	85 c0                	test   %eax,%eax
+  800177:	7f 0a                	jg     800183 <lsdir+0x94>
+  800179:	78 1a                	js     800195 <lsdir+0xa6>
+  80017b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80017e:	5b                   	pop    %ebx
+  80017f:	5e                   	pop    %esi
+  800180:	5f                   	pop    %edi
+  800181:	5d                   	pop    %ebp
+  800182:	c3                   	ret
+  800183:	57                   	push   %edi
+  800184:	68 86 36 80 00       	push   $0x803686
+  800189:	6a 22                	push   $0x22
+  80018b:	68 7c 36 80 00       	push   $0x80367c
+  800190:	e8 a9 01 00 00       	call   80033e <_panic>
+  800195:	83 ec 0c             	sub    $0xc,%esp
+  800198:	50                   	push   %eax
+  800199:	57                   	push   %edi
+  80019a:	68 cc 36 80 00       	push   $0x8036cc
+  80019f:	6a 24                	push   $0x24
+  8001a1:	68 7c 36 80 00       	push   $0x80367c
+  8001a6:	e8 93 01 00 00       	call   80033e <_panic>
+
+008001ab <ls>:
+  8001ab:	55                   	push   %ebp
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	53                   	push   %ebx
+  8001af:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001b8:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001be:	50                   	push   %eax
+  8001bf:	53                   	push   %ebx
+  8001c0:	e8 bb 1c 00 00       	call   801e80 <stat>
+  8001c5:	83 c4 10             	add    $0x10,%esp
+  8001c8:	85 c0                	test   %eax,%eax
+  8001ca:	78 24                	js     8001f0 <ls+0x45>
+  8001cc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001cf:	85 c0                	test   %eax,%eax
+  8001d1:	74 09                	je     8001dc <ls+0x31>
+  8001d3:	83 3d b0 51 80 00 00 	cmpl   $0x0,0x8051b0
+  8001da:	74 2a                	je     800206 <ls+0x5b>
+  8001dc:	53                   	push   %ebx
+  8001dd:	ff 75 ec             	push   -0x14(%ebp)
+  8001e0:	50                   	push   %eax
+  8001e1:	6a 00                	push   $0x0
+  8001e3:	e8 4b fe ff ff       	call   800033 <ls1>
+  8001e8:	83 c4 10             	add    $0x10,%esp
+  8001eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ee:	c9                   	leave
+  8001ef:	c3                   	ret
+  8001f0:	83 ec 0c             	sub    $0xc,%esp
+  8001f3:	50                   	push   %eax
+  8001f4:	53                   	push   %ebx
+  8001f5:	68 a1 36 80 00       	push   $0x8036a1
+  8001fa:	6a 0f                	push   $0xf
+  8001fc:	68 7c 36 80 00       	push   $0x80367c
+  800201:	e8 38 01 00 00       	call   80033e <_panic>
+  800206:	83 ec 08             	sub    $0x8,%esp
+  800209:	ff 75 0c             	push   0xc(%ebp)
+  80020c:	53                   	push   %ebx
+  80020d:	e8 dd fe ff ff       	call   8000ef <lsdir>
+  800212:	83 c4 10             	add    $0x10,%esp
+  800215:	eb d4                	jmp    8001eb <ls+0x40>
+
+00800217 <usage>:
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	83 ec 14             	sub    $0x14,%esp
+  80021d:	68 ad 36 80 00       	push   $0x8036ad
+  800222:	e8 0d 24 00 00       	call   802634 <printf>
+  800227:	e8 e2 00 00 00       	call   80030e <exit>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	c9                   	leave
+  800230:	c3                   	ret
+
+00800231 <umain>:
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	56                   	push   %esi
+  800235:	53                   	push   %ebx
+  800236:	83 ec 14             	sub    $0x14,%esp
+  800239:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80023c:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80023f:	50                   	push   %eax
+  800240:	56                   	push   %esi
+  800241:	8d 45 08             	lea    0x8(%ebp),%eax
+  800244:	50                   	push   %eax
+  800245:	e8 94 15 00 00       	call   8017de <argstart>
+  80024a:	83 c4 10             	add    $0x10,%esp
+  80024d:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  800250:	eb 08                	jmp    80025a <umain+0x29>
+  800252:	83 04 85 20 50 80 00 	addl   $0x1,0x805020(,%eax,4)
+  800259:	01 
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+  80025d:	53                   	push   %ebx
+  80025e:	e8 ab 15 00 00       	call   80180e <argnext>
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 16                	js     800280 <umain+0x4f>
+  80026a:	89 c2                	mov    %eax,%edx
+  80026c:	83 e2 f7             	and    $0xfffffff7,%edx
+  80026f:	83 fa 64             	cmp    $0x64,%edx
+  800272:	74 de                	je     800252 <umain+0x21>
+  800274:	83 f8 46             	cmp    $0x46,%eax
+  800277:	74 d9                	je     800252 <umain+0x21>
+  800279:	e8 99 ff ff ff       	call   800217 <usage>
+  80027e:	eb da                	jmp    80025a <umain+0x29>
+  800280:	8b 45 08             	mov    0x8(%ebp),%eax
+  800283:	83 f8 01             	cmp    $0x1,%eax
+  800286:	74 26                	je     8002ae <umain+0x7d>
+  800288:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80028d:	7e 18                	jle    8002a7 <umain+0x76>
+  80028f:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  800292:	83 ec 08             	sub    $0x8,%esp
+  800295:	50                   	push   %eax
+  800296:	50                   	push   %eax
+  800297:	e8 0f ff ff ff       	call   8001ab <ls>
+  80029c:	83 c3 01             	add    $0x1,%ebx
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002a5:	7f e8                	jg     80028f <umain+0x5e>
+  8002a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002aa:	5b                   	pop    %ebx
+  8002ab:	5e                   	pop    %esi
+  8002ac:	5d                   	pop    %ebp
+  8002ad:	c3                   	ret
+  8002ae:	83 ec 08             	sub    $0x8,%esp
+  8002b1:	68 c8 36 80 00       	push   $0x8036c8
+  8002b6:	68 60 36 80 00       	push   $0x803660
+  8002bb:	e8 eb fe ff ff       	call   8001ab <ls>
+  8002c0:	83 c4 10             	add    $0x10,%esp
+  8002c3:	eb e2                	jmp    8002a7 <umain+0x76>
+
+008002c5 <libmain>:
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	56                   	push   %esi
+  8002c9:	53                   	push   %ebx
+  8002ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8002d0:	e8 31 0c 00 00       	call   800f06 <sys_getenvid>
+  8002d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002da:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8002e0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002e5:	a3 20 54 80 00       	mov    %eax,0x805420
+  8002ea:	85 db                	test   %ebx,%ebx
+  8002ec:	7e 07                	jle    8002f5 <libmain+0x30>
+  8002ee:	8b 06                	mov    (%esi),%eax
+  8002f0:	a3 00 40 80 00       	mov    %eax,0x804000
+  8002f5:	83 ec 08             	sub    $0x8,%esp
+  8002f8:	56                   	push   %esi
+  8002f9:	53                   	push   %ebx
+  8002fa:	e8 32 ff ff ff       	call   800231 <umain>
+  8002ff:	e8 0a 00 00 00       	call   80030e <exit>
+  800304:	83 c4 10             	add    $0x10,%esp
+  800307:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80030a:	5b                   	pop    %ebx
+  80030b:	5e                   	pop    %esi
+  80030c:	5d                   	pop    %ebp
+  80030d:	c3                   	ret
+
+0080030e <exit>:
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	83 ec 08             	sub    $0x8,%esp
+  800314:	a1 20 54 80 00       	mov    0x805420,%eax
+  800319:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80031f:	85 c0                	test   %eax,%eax
+  800321:	75 14                	jne    800337 <exit+0x29>
+  800323:	e8 cf 17 00 00       	call   801af7 <close_all>
+  800328:	83 ec 0c             	sub    $0xc,%esp
+  80032b:	6a 00                	push   $0x0
+  80032d:	e8 93 0b 00 00       	call   800ec5 <sys_env_destroy>
+  800332:	83 c4 10             	add    $0x10,%esp
+  800335:	c9                   	leave
+  800336:	c3                   	ret
+  800337:	e8 f6 12 00 00       	call   801632 <sys_lease_complete>
+  80033c:	eb e5                	jmp    800323 <exit+0x15>
+
+0080033e <_panic>:
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	56                   	push   %esi
+  800342:	53                   	push   %ebx
+  800343:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800346:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80034c:	e8 b5 0b 00 00       	call   800f06 <sys_getenvid>
+  800351:	83 ec 0c             	sub    $0xc,%esp
+  800354:	ff 75 0c             	push   0xc(%ebp)
+  800357:	ff 75 08             	push   0x8(%ebp)
+  80035a:	56                   	push   %esi
+  80035b:	50                   	push   %eax
+  80035c:	68 f8 36 80 00       	push   $0x8036f8
+  800361:	e8 b3 00 00 00       	call   800419 <cprintf>
+  800366:	83 c4 18             	add    $0x18,%esp
+  800369:	53                   	push   %ebx
+  80036a:	ff 75 10             	push   0x10(%ebp)
+  80036d:	e8 56 00 00 00       	call   8003c8 <vcprintf>
+  800372:	c7 04 24 c7 36 80 00 	movl   $0x8036c7,(%esp)
+  800379:	e8 9b 00 00 00       	call   800419 <cprintf>
+  80037e:	83 c4 10             	add    $0x10,%esp
+  800381:	cc                   	int3
+  800382:	eb fd                	jmp    800381 <_panic+0x43>
+
+00800384 <putch>:
+  800384:	55                   	push   %ebp
+  800385:	89 e5                	mov    %esp,%ebp
+  800387:	53                   	push   %ebx
+  800388:	83 ec 04             	sub    $0x4,%esp
+  80038b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80038e:	8b 13                	mov    (%ebx),%edx
+  800390:	8d 42 01             	lea    0x1(%edx),%eax
+  800393:	89 03                	mov    %eax,(%ebx)
+  800395:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800398:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80039c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003a1:	74 09                	je     8003ac <putch+0x28>
+  8003a3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8003a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003aa:	c9                   	leave
+  8003ab:	c3                   	ret
+  8003ac:	83 ec 08             	sub    $0x8,%esp
+  8003af:	68 ff 00 00 00       	push   $0xff
+  8003b4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003b7:	50                   	push   %eax
+  8003b8:	e8 cb 0a 00 00       	call   800e88 <sys_cputs>
+  8003bd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003c3:	83 c4 10             	add    $0x10,%esp
+  8003c6:	eb db                	jmp    8003a3 <putch+0x1f>
+
+008003c8 <vcprintf>:
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8003d1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003d8:	00 00 00 
+  8003db:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003e2:	00 00 00 
+  8003e5:	ff 75 0c             	push   0xc(%ebp)
+  8003e8:	ff 75 08             	push   0x8(%ebp)
+  8003eb:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003f1:	50                   	push   %eax
+  8003f2:	68 84 03 80 00       	push   $0x800384
+  8003f7:	e8 1c 01 00 00       	call   800518 <vprintfmt>
+  8003fc:	83 c4 08             	add    $0x8,%esp
+  8003ff:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800405:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80040b:	50                   	push   %eax
+  80040c:	e8 77 0a 00 00       	call   800e88 <sys_cputs>
+  800411:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800417:	c9                   	leave
+  800418:	c3                   	ret
+
+00800419 <cprintf>:
+  800419:	55                   	push   %ebp
+  80041a:	89 e5                	mov    %esp,%ebp
+  80041c:	83 ec 10             	sub    $0x10,%esp
+  80041f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800422:	50                   	push   %eax
+  800423:	ff 75 08             	push   0x8(%ebp)
+  800426:	e8 9d ff ff ff       	call   8003c8 <vcprintf>
+  80042b:	c9                   	leave
+  80042c:	c3                   	ret
+
+0080042d <printnum>:
+  80042d:	55                   	push   %ebp
+  80042e:	89 e5                	mov    %esp,%ebp
+  800430:	57                   	push   %edi
+  800431:	56                   	push   %esi
+  800432:	53                   	push   %ebx
+  800433:	83 ec 1c             	sub    $0x1c,%esp
+  800436:	89 c3                	mov    %eax,%ebx
+  800438:	89 d6                	mov    %edx,%esi
+  80043a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80043d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800440:	89 d1                	mov    %edx,%ecx
+  800442:	89 c2                	mov    %eax,%edx
+  800444:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800447:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80044a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80044d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800450:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800457:	39 c2                	cmp    %eax,%edx
+  800459:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80045c:	73 4b                	jae    8004a9 <printnum+0x7c>
+  80045e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800461:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800464:	85 ff                	test   %edi,%edi
+  800466:	7e 11                	jle    800479 <printnum+0x4c>
+  800468:	83 ec 08             	sub    $0x8,%esp
+  80046b:	56                   	push   %esi
+  80046c:	ff 75 18             	push   0x18(%ebp)
+  80046f:	ff d3                	call   *%ebx
+  800471:	83 c4 10             	add    $0x10,%esp
+  800474:	83 ef 01             	sub    $0x1,%edi
+  800477:	75 ef                	jne    800468 <printnum+0x3b>
+  800479:	83 ec 08             	sub    $0x8,%esp
+  80047c:	56                   	push   %esi
+  80047d:	83 ec 04             	sub    $0x4,%esp
+  800480:	ff 75 e4             	push   -0x1c(%ebp)
+  800483:	ff 75 e0             	push   -0x20(%ebp)
+  800486:	ff 75 dc             	push   -0x24(%ebp)
+  800489:	ff 75 d8             	push   -0x28(%ebp)
+  80048c:	e8 b3 30 00 00       	call   803544 <__umoddi3>
+  800491:	83 c4 14             	add    $0x14,%esp
+  800494:	0f be 80 1b 37 80 00 	movsbl 0x80371b(%eax),%eax
+  80049b:	50                   	push   %eax
+  80049c:	ff d3                	call   *%ebx
+  80049e:	83 c4 10             	add    $0x10,%esp
+  8004a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a4:	5b                   	pop    %ebx
+  8004a5:	5e                   	pop    %esi
+  8004a6:	5f                   	pop    %edi
+  8004a7:	5d                   	pop    %ebp
+  8004a8:	c3                   	ret
+  8004a9:	83 ec 0c             	sub    $0xc,%esp
+  8004ac:	ff 75 18             	push   0x18(%ebp)
+  8004af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004b2:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004b5:	52                   	push   %edx
+  8004b6:	50                   	push   %eax
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8004bd:	ff 75 e0             	push   -0x20(%ebp)
+  8004c0:	ff 75 dc             	push   -0x24(%ebp)
+  8004c3:	ff 75 d8             	push   -0x28(%ebp)
+  8004c6:	e8 5b 30 00 00       	call   803526 <__udivdi3>
+  8004cb:	83 c4 18             	add    $0x18,%esp
+  8004ce:	52                   	push   %edx
+  8004cf:	50                   	push   %eax
+  8004d0:	89 f2                	mov    %esi,%edx
+  8004d2:	89 d8                	mov    %ebx,%eax
+  8004d4:	e8 54 ff ff ff       	call   80042d <printnum>
+  8004d9:	83 c4 20             	add    $0x20,%esp
+  8004dc:	eb 9b                	jmp    800479 <printnum+0x4c>
+
+008004de <sprintputch>:
+  8004de:	55                   	push   %ebp
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004e4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8004e8:	8b 10                	mov    (%eax),%edx
+  8004ea:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004ed:	73 0a                	jae    8004f9 <sprintputch+0x1b>
+  8004ef:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004f2:	89 08                	mov    %ecx,(%eax)
+  8004f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f7:	88 02                	mov    %al,(%edx)
+  8004f9:	5d                   	pop    %ebp
+  8004fa:	c3                   	ret
+
+008004fb <printfmt>:
+  8004fb:	55                   	push   %ebp
+  8004fc:	89 e5                	mov    %esp,%ebp
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	8d 45 14             	lea    0x14(%ebp),%eax
+  800504:	50                   	push   %eax
+  800505:	ff 75 10             	push   0x10(%ebp)
+  800508:	ff 75 0c             	push   0xc(%ebp)
+  80050b:	ff 75 08             	push   0x8(%ebp)
+  80050e:	e8 05 00 00 00       	call   800518 <vprintfmt>
+  800513:	83 c4 10             	add    $0x10,%esp
+  800516:	c9                   	leave
+  800517:	c3                   	ret
+
+00800518 <vprintfmt>:
+  800518:	55                   	push   %ebp
+  800519:	89 e5                	mov    %esp,%ebp
+  80051b:	57                   	push   %edi
+  80051c:	56                   	push   %esi
+  80051d:	53                   	push   %ebx
+  80051e:	83 ec 2c             	sub    $0x2c,%esp
+  800521:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800524:	89 df                	mov    %ebx,%edi
+  800526:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800529:	8b 45 10             	mov    0x10(%ebp),%eax
+  80052c:	8d 70 01             	lea    0x1(%eax),%esi
+  80052f:	0f b6 00             	movzbl (%eax),%eax
+  800532:	83 f8 25             	cmp    $0x25,%eax
+  800535:	74 1e                	je     800555 <vprintfmt+0x3d>
+  800537:	85 c0                	test   %eax,%eax
+  800539:	0f 84 15 05 00 00    	je     800a54 <vprintfmt+0x53c>
+  80053f:	83 ec 08             	sub    $0x8,%esp
+  800542:	53                   	push   %ebx
+  800543:	50                   	push   %eax
+  800544:	ff d7                	call   *%edi
+  800546:	83 c6 01             	add    $0x1,%esi
+  800549:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80054d:	83 c4 10             	add    $0x10,%esp
+  800550:	83 f8 25             	cmp    $0x25,%eax
+  800553:	75 e2                	jne    800537 <vprintfmt+0x1f>
+  800555:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800559:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800560:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800567:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80056e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800573:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800576:	8d 56 01             	lea    0x1(%esi),%edx
+  800579:	0f b6 0e             	movzbl (%esi),%ecx
+  80057c:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80057f:	3c 55                	cmp    $0x55,%al
+  800581:	0f 87 3b 04 00 00    	ja     8009c2 <vprintfmt+0x4aa>
+  800587:	0f b6 c0             	movzbl %al,%eax
+  80058a:	ff 24 85 60 38 80 00 	jmp    *0x803860(,%eax,4)
+  800591:	89 75 10             	mov    %esi,0x10(%ebp)
+  800594:	eb 93                	jmp    800529 <vprintfmt+0x11>
+  800596:	89 d6                	mov    %edx,%esi
+  800598:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80059c:	eb d8                	jmp    800576 <vprintfmt+0x5e>
+  80059e:	89 d6                	mov    %edx,%esi
+  8005a0:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005a4:	eb d0                	jmp    800576 <vprintfmt+0x5e>
+  8005a6:	0f b6 c9             	movzbl %cl,%ecx
+  8005a9:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005ac:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8005af:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8005b3:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005b6:	83 f9 09             	cmp    $0x9,%ecx
+  8005b9:	77 6f                	ja     80062a <vprintfmt+0x112>
+  8005bb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8005be:	83 c2 01             	add    $0x1,%edx
+  8005c1:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8005c4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8005c8:	0f be 02             	movsbl (%edx),%eax
+  8005cb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005ce:	83 fe 09             	cmp    $0x9,%esi
+  8005d1:	76 eb                	jbe    8005be <vprintfmt+0xa6>
+  8005d3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8005d6:	89 d6                	mov    %edx,%esi
+  8005d8:	eb 13                	jmp    8005ed <vprintfmt+0xd5>
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 00                	mov    (%eax),%eax
+  8005df:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8005e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005eb:	89 d6                	mov    %edx,%esi
+  8005ed:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005f1:	79 83                	jns    800576 <vprintfmt+0x5e>
+  8005f3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005f9:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800600:	e9 71 ff ff ff       	jmp    800576 <vprintfmt+0x5e>
+  800605:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800608:	85 c9                	test   %ecx,%ecx
+  80060a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060f:	0f 49 c1             	cmovns %ecx,%eax
+  800612:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800615:	89 d6                	mov    %edx,%esi
+  800617:	e9 5a ff ff ff       	jmp    800576 <vprintfmt+0x5e>
+  80061c:	89 d6                	mov    %edx,%esi
+  80061e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800625:	e9 4c ff ff ff       	jmp    800576 <vprintfmt+0x5e>
+  80062a:	89 d6                	mov    %edx,%esi
+  80062c:	eb bf                	jmp    8005ed <vprintfmt+0xd5>
+  80062e:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800632:	89 d6                	mov    %edx,%esi
+  800634:	e9 3d ff ff ff       	jmp    800576 <vprintfmt+0x5e>
+  800639:	89 55 10             	mov    %edx,0x10(%ebp)
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8d 70 04             	lea    0x4(%eax),%esi
+  800642:	83 ec 08             	sub    $0x8,%esp
+  800645:	53                   	push   %ebx
+  800646:	ff 30                	push   (%eax)
+  800648:	ff d7                	call   *%edi
+  80064a:	83 c4 10             	add    $0x10,%esp
+  80064d:	89 75 14             	mov    %esi,0x14(%ebp)
+  800650:	e9 d4 fe ff ff       	jmp    800529 <vprintfmt+0x11>
+  800655:	89 55 10             	mov    %edx,0x10(%ebp)
+  800658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065b:	8d 70 04             	lea    0x4(%eax),%esi
+  80065e:	8b 10                	mov    (%eax),%edx
+  800660:	89 d0                	mov    %edx,%eax
+  800662:	f7 d8                	neg    %eax
+  800664:	0f 48 c2             	cmovs  %edx,%eax
+  800667:	83 f8 12             	cmp    $0x12,%eax
+  80066a:	7f 23                	jg     80068f <vprintfmt+0x177>
+  80066c:	8b 14 85 c0 39 80 00 	mov    0x8039c0(,%eax,4),%edx
+  800673:	85 d2                	test   %edx,%edx
+  800675:	74 18                	je     80068f <vprintfmt+0x177>
+  800677:	52                   	push   %edx
+  800678:	68 1b 3b 80 00       	push   $0x803b1b
+  80067d:	53                   	push   %ebx
+  80067e:	57                   	push   %edi
+  80067f:	e8 77 fe ff ff       	call   8004fb <printfmt>
+  800684:	83 c4 10             	add    $0x10,%esp
+  800687:	89 75 14             	mov    %esi,0x14(%ebp)
+  80068a:	e9 9a fe ff ff       	jmp    800529 <vprintfmt+0x11>
+  80068f:	50                   	push   %eax
+  800690:	68 33 37 80 00       	push   $0x803733
+  800695:	53                   	push   %ebx
+  800696:	57                   	push   %edi
+  800697:	e8 5f fe ff ff       	call   8004fb <printfmt>
+  80069c:	83 c4 10             	add    $0x10,%esp
+  80069f:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006a2:	e9 82 fe ff ff       	jmp    800529 <vprintfmt+0x11>
+  8006a7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ad:	83 c0 04             	add    $0x4,%eax
+  8006b0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 00                	mov    (%eax),%eax
+  8006b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006bb:	85 c0                	test   %eax,%eax
+  8006bd:	0f 84 61 03 00 00    	je     800a24 <vprintfmt+0x50c>
+  8006c3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006c7:	7e 06                	jle    8006cf <vprintfmt+0x1b7>
+  8006c9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8006cd:	75 29                	jne    8006f8 <vprintfmt+0x1e0>
+  8006cf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006d2:	8d 70 01             	lea    0x1(%eax),%esi
+  8006d5:	0f b6 00             	movzbl (%eax),%eax
+  8006d8:	0f be d0             	movsbl %al,%edx
+  8006db:	85 d2                	test   %edx,%edx
+  8006dd:	0f 84 bb 00 00 00    	je     80079e <vprintfmt+0x286>
+  8006e3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006e6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006e9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006ec:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006ef:	eb 7a                	jmp    80076b <vprintfmt+0x253>
+  8006f1:	c7 45 d0 2c 37 80 00 	movl   $0x80372c,-0x30(%ebp)
+  8006f8:	83 ec 08             	sub    $0x8,%esp
+  8006fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8006fe:	ff 75 d0             	push   -0x30(%ebp)
+  800701:	e8 e0 03 00 00       	call   800ae6 <strnlen>
+  800706:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800709:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80070c:	83 c4 10             	add    $0x10,%esp
+  80070f:	85 d2                	test   %edx,%edx
+  800711:	0f 8e d6 02 00 00    	jle    8009ed <vprintfmt+0x4d5>
+  800717:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80071b:	83 ec 08             	sub    $0x8,%esp
+  80071e:	53                   	push   %ebx
+  80071f:	56                   	push   %esi
+  800720:	ff d7                	call   *%edi
+  800722:	83 c4 10             	add    $0x10,%esp
+  800725:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800729:	75 f0                	jne    80071b <vprintfmt+0x203>
+  80072b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80072e:	8d 70 01             	lea    0x1(%eax),%esi
+  800731:	0f b6 00             	movzbl (%eax),%eax
+  800734:	0f be d0             	movsbl %al,%edx
+  800737:	85 d2                	test   %edx,%edx
+  800739:	0f 84 da 02 00 00    	je     800a19 <vprintfmt+0x501>
+  80073f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800742:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800745:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800748:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80074b:	eb 1e                	jmp    80076b <vprintfmt+0x253>
+  80074d:	83 ec 08             	sub    $0x8,%esp
+  800750:	ff 75 0c             	push   0xc(%ebp)
+  800753:	52                   	push   %edx
+  800754:	ff 55 08             	call   *0x8(%ebp)
+  800757:	83 c4 10             	add    $0x10,%esp
+  80075a:	83 eb 01             	sub    $0x1,%ebx
+  80075d:	83 c6 01             	add    $0x1,%esi
+  800760:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800764:	0f be d0             	movsbl %al,%edx
+  800767:	85 d2                	test   %edx,%edx
+  800769:	74 2a                	je     800795 <vprintfmt+0x27d>
+  80076b:	85 ff                	test   %edi,%edi
+  80076d:	78 05                	js     800774 <vprintfmt+0x25c>
+  80076f:	83 ef 01             	sub    $0x1,%edi
+  800772:	78 59                	js     8007cd <vprintfmt+0x2b5>
+  800774:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800778:	74 d3                	je     80074d <vprintfmt+0x235>
+  80077a:	0f be c0             	movsbl %al,%eax
+  80077d:	83 e8 20             	sub    $0x20,%eax
+  800780:	83 f8 5e             	cmp    $0x5e,%eax
+  800783:	76 c8                	jbe    80074d <vprintfmt+0x235>
+  800785:	83 ec 08             	sub    $0x8,%esp
+  800788:	ff 75 0c             	push   0xc(%ebp)
+  80078b:	6a 3f                	push   $0x3f
+  80078d:	ff 55 08             	call   *0x8(%ebp)
+  800790:	83 c4 10             	add    $0x10,%esp
+  800793:	eb c5                	jmp    80075a <vprintfmt+0x242>
+  800795:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800798:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80079b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80079e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007a1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007a5:	7e 1b                	jle    8007c2 <vprintfmt+0x2aa>
+  8007a7:	83 ec 08             	sub    $0x8,%esp
+  8007aa:	53                   	push   %ebx
+  8007ab:	6a 20                	push   $0x20
+  8007ad:	ff d7                	call   *%edi
+  8007af:	83 c4 10             	add    $0x10,%esp
+  8007b2:	83 ee 01             	sub    $0x1,%esi
+  8007b5:	75 f0                	jne    8007a7 <vprintfmt+0x28f>
+  8007b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bd:	e9 67 fd ff ff       	jmp    800529 <vprintfmt+0x11>
+  8007c2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c8:	e9 5c fd ff ff       	jmp    800529 <vprintfmt+0x11>
+  8007cd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007d0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007d6:	eb c6                	jmp    80079e <vprintfmt+0x286>
+  8007d8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007db:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007de:	83 f9 01             	cmp    $0x1,%ecx
+  8007e1:	7f 1f                	jg     800802 <vprintfmt+0x2ea>
+  8007e3:	85 c9                	test   %ecx,%ecx
+  8007e5:	74 67                	je     80084e <vprintfmt+0x336>
+  8007e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ea:	8b 30                	mov    (%eax),%esi
+  8007ec:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007ef:	89 f0                	mov    %esi,%eax
+  8007f1:	c1 f8 1f             	sar    $0x1f,%eax
+  8007f4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800800:	eb 17                	jmp    800819 <vprintfmt+0x301>
+  800802:	8b 45 14             	mov    0x14(%ebp),%eax
+  800805:	8b 50 04             	mov    0x4(%eax),%edx
+  800808:	8b 00                	mov    (%eax),%eax
+  80080a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80080d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8d 40 08             	lea    0x8(%eax),%eax
+  800816:	89 45 14             	mov    %eax,0x14(%ebp)
+  800819:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80081c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80081f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800824:	85 c9                	test   %ecx,%ecx
+  800826:	0f 89 12 01 00 00    	jns    80093e <vprintfmt+0x426>
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  80082f:	53                   	push   %ebx
+  800830:	6a 2d                	push   $0x2d
+  800832:	ff d7                	call   *%edi
+  800834:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800837:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80083a:	f7 da                	neg    %edx
+  80083c:	83 d1 00             	adc    $0x0,%ecx
+  80083f:	f7 d9                	neg    %ecx
+  800841:	83 c4 10             	add    $0x10,%esp
+  800844:	be 0a 00 00 00       	mov    $0xa,%esi
+  800849:	e9 f0 00 00 00       	jmp    80093e <vprintfmt+0x426>
+  80084e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800851:	8b 30                	mov    (%eax),%esi
+  800853:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800856:	89 f0                	mov    %esi,%eax
+  800858:	c1 f8 1f             	sar    $0x1f,%eax
+  80085b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80085e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800861:	8d 40 04             	lea    0x4(%eax),%eax
+  800864:	89 45 14             	mov    %eax,0x14(%ebp)
+  800867:	eb b0                	jmp    800819 <vprintfmt+0x301>
+  800869:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80086c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80086f:	83 f9 01             	cmp    $0x1,%ecx
+  800872:	7f 1e                	jg     800892 <vprintfmt+0x37a>
+  800874:	85 c9                	test   %ecx,%ecx
+  800876:	74 32                	je     8008aa <vprintfmt+0x392>
+  800878:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087b:	8b 10                	mov    (%eax),%edx
+  80087d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800882:	8d 40 04             	lea    0x4(%eax),%eax
+  800885:	89 45 14             	mov    %eax,0x14(%ebp)
+  800888:	be 0a 00 00 00       	mov    $0xa,%esi
+  80088d:	e9 ac 00 00 00       	jmp    80093e <vprintfmt+0x426>
+  800892:	8b 45 14             	mov    0x14(%ebp),%eax
+  800895:	8b 10                	mov    (%eax),%edx
+  800897:	8b 48 04             	mov    0x4(%eax),%ecx
+  80089a:	8d 40 08             	lea    0x8(%eax),%eax
+  80089d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008a0:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008a5:	e9 94 00 00 00       	jmp    80093e <vprintfmt+0x426>
+  8008aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ad:	8b 10                	mov    (%eax),%edx
+  8008af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ba:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008bf:	eb 7d                	jmp    80093e <vprintfmt+0x426>
+  8008c1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008c4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c7:	83 f9 01             	cmp    $0x1,%ecx
+  8008ca:	7f 1b                	jg     8008e7 <vprintfmt+0x3cf>
+  8008cc:	85 c9                	test   %ecx,%ecx
+  8008ce:	74 2c                	je     8008fc <vprintfmt+0x3e4>
+  8008d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d3:	8b 10                	mov    (%eax),%edx
+  8008d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008da:	8d 40 04             	lea    0x4(%eax),%eax
+  8008dd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e0:	be 08 00 00 00       	mov    $0x8,%esi
+  8008e5:	eb 57                	jmp    80093e <vprintfmt+0x426>
+  8008e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ea:	8b 10                	mov    (%eax),%edx
+  8008ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f5:	be 08 00 00 00       	mov    $0x8,%esi
+  8008fa:	eb 42                	jmp    80093e <vprintfmt+0x426>
+  8008fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ff:	8b 10                	mov    (%eax),%edx
+  800901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800906:	8d 40 04             	lea    0x4(%eax),%eax
+  800909:	89 45 14             	mov    %eax,0x14(%ebp)
+  80090c:	be 08 00 00 00       	mov    $0x8,%esi
+  800911:	eb 2b                	jmp    80093e <vprintfmt+0x426>
+  800913:	89 55 10             	mov    %edx,0x10(%ebp)
+  800916:	83 ec 08             	sub    $0x8,%esp
+  800919:	53                   	push   %ebx
+  80091a:	6a 30                	push   $0x30
+  80091c:	ff d7                	call   *%edi
+  80091e:	83 c4 08             	add    $0x8,%esp
+  800921:	53                   	push   %ebx
+  800922:	6a 78                	push   $0x78
+  800924:	ff d7                	call   *%edi
+  800926:	8b 45 14             	mov    0x14(%ebp),%eax
+  800929:	8b 10                	mov    (%eax),%edx
+  80092b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800930:	83 c4 10             	add    $0x10,%esp
+  800933:	8d 40 04             	lea    0x4(%eax),%eax
+  800936:	89 45 14             	mov    %eax,0x14(%ebp)
+  800939:	be 10 00 00 00       	mov    $0x10,%esi
+  80093e:	83 ec 0c             	sub    $0xc,%esp
+  800941:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800945:	50                   	push   %eax
+  800946:	ff 75 e4             	push   -0x1c(%ebp)
+  800949:	56                   	push   %esi
+  80094a:	51                   	push   %ecx
+  80094b:	52                   	push   %edx
+  80094c:	89 da                	mov    %ebx,%edx
+  80094e:	89 f8                	mov    %edi,%eax
+  800950:	e8 d8 fa ff ff       	call   80042d <printnum>
+  800955:	83 c4 20             	add    $0x20,%esp
+  800958:	e9 cc fb ff ff       	jmp    800529 <vprintfmt+0x11>
+  80095d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800960:	89 55 10             	mov    %edx,0x10(%ebp)
+  800963:	83 f9 01             	cmp    $0x1,%ecx
+  800966:	7f 1b                	jg     800983 <vprintfmt+0x46b>
+  800968:	85 c9                	test   %ecx,%ecx
+  80096a:	74 2c                	je     800998 <vprintfmt+0x480>
+  80096c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096f:	8b 10                	mov    (%eax),%edx
+  800971:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800976:	8d 40 04             	lea    0x4(%eax),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097c:	be 10 00 00 00       	mov    $0x10,%esi
+  800981:	eb bb                	jmp    80093e <vprintfmt+0x426>
+  800983:	8b 45 14             	mov    0x14(%ebp),%eax
+  800986:	8b 10                	mov    (%eax),%edx
+  800988:	8b 48 04             	mov    0x4(%eax),%ecx
+  80098b:	8d 40 08             	lea    0x8(%eax),%eax
+  80098e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800991:	be 10 00 00 00       	mov    $0x10,%esi
+  800996:	eb a6                	jmp    80093e <vprintfmt+0x426>
+  800998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099b:	8b 10                	mov    (%eax),%edx
+  80099d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a8:	be 10 00 00 00       	mov    $0x10,%esi
+  8009ad:	eb 8f                	jmp    80093e <vprintfmt+0x426>
+  8009af:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009b2:	83 ec 08             	sub    $0x8,%esp
+  8009b5:	53                   	push   %ebx
+  8009b6:	6a 25                	push   $0x25
+  8009b8:	ff d7                	call   *%edi
+  8009ba:	83 c4 10             	add    $0x10,%esp
+  8009bd:	e9 67 fb ff ff       	jmp    800529 <vprintfmt+0x11>
+  8009c2:	83 ec 08             	sub    $0x8,%esp
+  8009c5:	53                   	push   %ebx
+  8009c6:	6a 25                	push   $0x25
+  8009c8:	ff d7                	call   *%edi
+  8009ca:	83 c4 10             	add    $0x10,%esp
+  8009cd:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8009d1:	0f 84 ba fb ff ff    	je     800591 <vprintfmt+0x79>
+  8009d7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8009da:	89 f0                	mov    %esi,%eax
+  8009dc:	83 e8 01             	sub    $0x1,%eax
+  8009df:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009e3:	75 f7                	jne    8009dc <vprintfmt+0x4c4>
+  8009e5:	89 45 10             	mov    %eax,0x10(%ebp)
+  8009e8:	e9 3c fb ff ff       	jmp    800529 <vprintfmt+0x11>
+  8009ed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009f0:	8d 70 01             	lea    0x1(%eax),%esi
+  8009f3:	0f b6 00             	movzbl (%eax),%eax
+  8009f6:	0f be d0             	movsbl %al,%edx
+  8009f9:	85 d2                	test   %edx,%edx
+  8009fb:	74 11                	je     800a0e <vprintfmt+0x4f6>
+  8009fd:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a00:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a03:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a06:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a09:	e9 5d fd ff ff       	jmp    80076b <vprintfmt+0x253>
+  800a0e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a11:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a14:	e9 10 fb ff ff       	jmp    800529 <vprintfmt+0x11>
+  800a19:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a1c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a1f:	e9 05 fb ff ff       	jmp    800529 <vprintfmt+0x11>
+  800a24:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a28:	7e 0a                	jle    800a34 <vprintfmt+0x51c>
+  800a2a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a2e:	0f 85 bd fc ff ff    	jne    8006f1 <vprintfmt+0x1d9>
+  800a34:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a39:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a3e:	be 2d 37 80 00       	mov    $0x80372d,%esi
+  800a43:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a46:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a49:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a4c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a4f:	e9 17 fd ff ff       	jmp    80076b <vprintfmt+0x253>
+  800a54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a57:	5b                   	pop    %ebx
+  800a58:	5e                   	pop    %esi
+  800a59:	5f                   	pop    %edi
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+
+00800a5c <vsnprintf>:
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	83 ec 18             	sub    $0x18,%esp
+  800a62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a68:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a6b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a6f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a72:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a79:	85 c0                	test   %eax,%eax
+  800a7b:	74 26                	je     800aa3 <vsnprintf+0x47>
+  800a7d:	85 d2                	test   %edx,%edx
+  800a7f:	7e 22                	jle    800aa3 <vsnprintf+0x47>
+  800a81:	ff 75 14             	push   0x14(%ebp)
+  800a84:	ff 75 10             	push   0x10(%ebp)
+  800a87:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a8a:	50                   	push   %eax
+  800a8b:	68 de 04 80 00       	push   $0x8004de
+  800a90:	e8 83 fa ff ff       	call   800518 <vprintfmt>
+  800a95:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a98:	c6 00 00             	movb   $0x0,(%eax)
+  800a9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a9e:	83 c4 10             	add    $0x10,%esp
+  800aa1:	c9                   	leave
+  800aa2:	c3                   	ret
+  800aa3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aa8:	eb f7                	jmp    800aa1 <vsnprintf+0x45>
+
+00800aaa <snprintf>:
+  800aaa:	55                   	push   %ebp
+  800aab:	89 e5                	mov    %esp,%ebp
+  800aad:	83 ec 08             	sub    $0x8,%esp
+  800ab0:	8d 45 14             	lea    0x14(%ebp),%eax
+  800ab3:	50                   	push   %eax
+  800ab4:	ff 75 10             	push   0x10(%ebp)
+  800ab7:	ff 75 0c             	push   0xc(%ebp)
+  800aba:	ff 75 08             	push   0x8(%ebp)
+  800abd:	e8 9a ff ff ff       	call   800a5c <vsnprintf>
+  800ac2:	c9                   	leave
+  800ac3:	c3                   	ret
+
+00800ac4 <strlen>:
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aca:	80 3a 00             	cmpb   $0x0,(%edx)
+  800acd:	74 10                	je     800adf <strlen+0x1b>
+  800acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad4:	83 c0 01             	add    $0x1,%eax
+  800ad7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800adb:	75 f7                	jne    800ad4 <strlen+0x10>
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+  800adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae4:	eb f7                	jmp    800add <strlen+0x19>
+
+00800ae6 <strnlen>:
+  800ae6:	55                   	push   %ebp
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aef:	85 d2                	test   %edx,%edx
+  800af1:	74 16                	je     800b09 <strnlen+0x23>
+  800af3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800afc:	74 09                	je     800b07 <strnlen+0x21>
+  800afe:	83 c0 01             	add    $0x1,%eax
+  800b01:	39 d0                	cmp    %edx,%eax
+  800b03:	75 f3                	jne    800af8 <strnlen+0x12>
+  800b05:	89 d0                	mov    %edx,%eax
+  800b07:	5d                   	pop    %ebp
+  800b08:	c3                   	ret
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	eb f7                	jmp    800b07 <strnlen+0x21>
+
+00800b10 <strcpy>:
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	53                   	push   %ebx
+  800b14:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b23:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b26:	83 c0 01             	add    $0x1,%eax
+  800b29:	84 d2                	test   %dl,%dl
+  800b2b:	75 f2                	jne    800b1f <strcpy+0xf>
+  800b2d:	89 c8                	mov    %ecx,%eax
+  800b2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b32:	c9                   	leave
+  800b33:	c3                   	ret
+
+00800b34 <strcat>:
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	53                   	push   %ebx
+  800b38:	83 ec 10             	sub    $0x10,%esp
+  800b3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b3e:	53                   	push   %ebx
+  800b3f:	e8 80 ff ff ff       	call   800ac4 <strlen>
+  800b44:	83 c4 08             	add    $0x8,%esp
+  800b47:	ff 75 0c             	push   0xc(%ebp)
+  800b4a:	01 d8                	add    %ebx,%eax
+  800b4c:	50                   	push   %eax
+  800b4d:	e8 be ff ff ff       	call   800b10 <strcpy>
+  800b52:	89 d8                	mov    %ebx,%eax
+  800b54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b57:	c9                   	leave
+  800b58:	c3                   	ret
+
+00800b59 <strncpy>:
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	56                   	push   %esi
+  800b5d:	53                   	push   %ebx
+  800b5e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b67:	85 db                	test   %ebx,%ebx
+  800b69:	74 17                	je     800b82 <strncpy+0x29>
+  800b6b:	01 f3                	add    %esi,%ebx
+  800b6d:	89 f0                	mov    %esi,%eax
+  800b6f:	83 c0 01             	add    $0x1,%eax
+  800b72:	0f b6 0a             	movzbl (%edx),%ecx
+  800b75:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b78:	80 f9 01             	cmp    $0x1,%cl
+  800b7b:	83 da ff             	sbb    $0xffffffff,%edx
+  800b7e:	39 c3                	cmp    %eax,%ebx
+  800b80:	75 ed                	jne    800b6f <strncpy+0x16>
+  800b82:	89 f0                	mov    %esi,%eax
+  800b84:	5b                   	pop    %ebx
+  800b85:	5e                   	pop    %esi
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <strlcpy>:
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	56                   	push   %esi
+  800b8c:	53                   	push   %ebx
+  800b8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b93:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b96:	89 f0                	mov    %esi,%eax
+  800b98:	85 db                	test   %ebx,%ebx
+  800b9a:	74 1e                	je     800bba <strlcpy+0x32>
+  800b9c:	83 eb 01             	sub    $0x1,%ebx
+  800b9f:	74 16                	je     800bb7 <strlcpy+0x2f>
+  800ba1:	01 f3                	add    %esi,%ebx
+  800ba3:	0f b6 0a             	movzbl (%edx),%ecx
+  800ba6:	84 c9                	test   %cl,%cl
+  800ba8:	74 0d                	je     800bb7 <strlcpy+0x2f>
+  800baa:	83 c2 01             	add    $0x1,%edx
+  800bad:	83 c0 01             	add    $0x1,%eax
+  800bb0:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800bb3:	39 d8                	cmp    %ebx,%eax
+  800bb5:	75 ec                	jne    800ba3 <strlcpy+0x1b>
+  800bb7:	c6 00 00             	movb   $0x0,(%eax)
+  800bba:	29 f0                	sub    %esi,%eax
+  800bbc:	5b                   	pop    %ebx
+  800bbd:	5e                   	pop    %esi
+  800bbe:	5d                   	pop    %ebp
+  800bbf:	c3                   	ret
+
+00800bc0 <strcmp>:
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bc9:	0f b6 01             	movzbl (%ecx),%eax
+  800bcc:	84 c0                	test   %al,%al
+  800bce:	74 11                	je     800be1 <strcmp+0x21>
+  800bd0:	38 02                	cmp    %al,(%edx)
+  800bd2:	75 0d                	jne    800be1 <strcmp+0x21>
+  800bd4:	83 c1 01             	add    $0x1,%ecx
+  800bd7:	83 c2 01             	add    $0x1,%edx
+  800bda:	0f b6 01             	movzbl (%ecx),%eax
+  800bdd:	84 c0                	test   %al,%al
+  800bdf:	75 ef                	jne    800bd0 <strcmp+0x10>
+  800be1:	0f b6 c0             	movzbl %al,%eax
+  800be4:	0f b6 12             	movzbl (%edx),%edx
+  800be7:	29 d0                	sub    %edx,%eax
+  800be9:	5d                   	pop    %ebp
+  800bea:	c3                   	ret
+
+00800beb <strncmp>:
+  800beb:	55                   	push   %ebp
+  800bec:	89 e5                	mov    %esp,%ebp
+  800bee:	53                   	push   %ebx
+  800bef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bf2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bf5:	8b 55 10             	mov    0x10(%ebp),%edx
+  800bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfd:	85 d2                	test   %edx,%edx
+  800bff:	74 2e                	je     800c2f <strncmp+0x44>
+  800c01:	0f b6 01             	movzbl (%ecx),%eax
+  800c04:	84 c0                	test   %al,%al
+  800c06:	74 16                	je     800c1e <strncmp+0x33>
+  800c08:	3a 03                	cmp    (%ebx),%al
+  800c0a:	75 12                	jne    800c1e <strncmp+0x33>
+  800c0c:	83 c1 01             	add    $0x1,%ecx
+  800c0f:	83 c3 01             	add    $0x1,%ebx
+  800c12:	83 ea 01             	sub    $0x1,%edx
+  800c15:	75 ea                	jne    800c01 <strncmp+0x16>
+  800c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1c:	eb 11                	jmp    800c2f <strncmp+0x44>
+  800c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c23:	85 d2                	test   %edx,%edx
+  800c25:	74 08                	je     800c2f <strncmp+0x44>
+  800c27:	0f b6 01             	movzbl (%ecx),%eax
+  800c2a:	0f b6 13             	movzbl (%ebx),%edx
+  800c2d:	29 d0                	sub    %edx,%eax
+  800c2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c32:	c9                   	leave
+  800c33:	c3                   	ret
+
+00800c34 <strchr>:
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800c3e:	0f b6 10             	movzbl (%eax),%edx
+  800c41:	84 d2                	test   %dl,%dl
+  800c43:	74 15                	je     800c5a <strchr+0x26>
+  800c45:	38 d1                	cmp    %dl,%cl
+  800c47:	74 0f                	je     800c58 <strchr+0x24>
+  800c49:	83 c0 01             	add    $0x1,%eax
+  800c4c:	0f b6 10             	movzbl (%eax),%edx
+  800c4f:	84 d2                	test   %dl,%dl
+  800c51:	75 f2                	jne    800c45 <strchr+0x11>
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c58:	5d                   	pop    %ebp
+  800c59:	c3                   	ret
+  800c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5f:	eb f7                	jmp    800c58 <strchr+0x24>
+
+00800c61 <strfind>:
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	53                   	push   %ebx
+  800c65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c68:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c6b:	0f b6 18             	movzbl (%eax),%ebx
+  800c6e:	38 d3                	cmp    %dl,%bl
+  800c70:	74 14                	je     800c86 <strfind+0x25>
+  800c72:	89 d1                	mov    %edx,%ecx
+  800c74:	84 db                	test   %bl,%bl
+  800c76:	74 0e                	je     800c86 <strfind+0x25>
+  800c78:	83 c0 01             	add    $0x1,%eax
+  800c7b:	0f b6 10             	movzbl (%eax),%edx
+  800c7e:	38 ca                	cmp    %cl,%dl
+  800c80:	74 04                	je     800c86 <strfind+0x25>
+  800c82:	84 d2                	test   %dl,%dl
+  800c84:	75 f2                	jne    800c78 <strfind+0x17>
+  800c86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c89:	c9                   	leave
+  800c8a:	c3                   	ret
+
+00800c8b <memset>:
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	57                   	push   %edi
+  800c8f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c92:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c95:	85 c9                	test   %ecx,%ecx
+  800c97:	74 20                	je     800cb9 <memset+0x2e>
+  800c99:	89 f8                	mov    %edi,%eax
+  800c9b:	09 c8                	or     %ecx,%eax
+  800c9d:	a8 03                	test   $0x3,%al
+  800c9f:	75 12                	jne    800cb3 <memset+0x28>
+  800ca1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ca5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800cab:	c1 e9 02             	shr    $0x2,%ecx
+  800cae:	fc                   	cld
+  800caf:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cb1:	eb 06                	jmp    800cb9 <memset+0x2e>
+  800cb3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cb6:	fc                   	cld
+  800cb7:	f3 aa                	rep stos %al,%es:(%edi)
+  800cb9:	89 f8                	mov    %edi,%eax
+  800cbb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cbe:	c9                   	leave
+  800cbf:	c3                   	ret
+
+00800cc0 <memmove>:
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	57                   	push   %edi
+  800cc4:	56                   	push   %esi
+  800cc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ccb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800cce:	39 c6                	cmp    %eax,%esi
+  800cd0:	73 32                	jae    800d04 <memmove+0x44>
+  800cd2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800cd5:	39 d0                	cmp    %edx,%eax
+  800cd7:	73 2b                	jae    800d04 <memmove+0x44>
+  800cd9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800cdc:	89 d6                	mov    %edx,%esi
+  800cde:	09 fe                	or     %edi,%esi
+  800ce0:	09 ce                	or     %ecx,%esi
+  800ce2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ce8:	75 0e                	jne    800cf8 <memmove+0x38>
+  800cea:	83 ef 04             	sub    $0x4,%edi
+  800ced:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800cf0:	c1 e9 02             	shr    $0x2,%ecx
+  800cf3:	fd                   	std
+  800cf4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cf6:	eb 09                	jmp    800d01 <memmove+0x41>
+  800cf8:	83 ef 01             	sub    $0x1,%edi
+  800cfb:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800cfe:	fd                   	std
+  800cff:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d01:	fc                   	cld
+  800d02:	eb 1a                	jmp    800d1e <memmove+0x5e>
+  800d04:	89 f2                	mov    %esi,%edx
+  800d06:	09 c2                	or     %eax,%edx
+  800d08:	09 ca                	or     %ecx,%edx
+  800d0a:	f6 c2 03             	test   $0x3,%dl
+  800d0d:	75 0a                	jne    800d19 <memmove+0x59>
+  800d0f:	c1 e9 02             	shr    $0x2,%ecx
+  800d12:	89 c7                	mov    %eax,%edi
+  800d14:	fc                   	cld
+  800d15:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d17:	eb 05                	jmp    800d1e <memmove+0x5e>
+  800d19:	89 c7                	mov    %eax,%edi
+  800d1b:	fc                   	cld
+  800d1c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d1e:	5e                   	pop    %esi
+  800d1f:	5f                   	pop    %edi
+  800d20:	5d                   	pop    %ebp
+  800d21:	c3                   	ret
+
+00800d22 <memcpy>:
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+  800d28:	ff 75 10             	push   0x10(%ebp)
+  800d2b:	ff 75 0c             	push   0xc(%ebp)
+  800d2e:	ff 75 08             	push   0x8(%ebp)
+  800d31:	e8 8a ff ff ff       	call   800cc0 <memmove>
+  800d36:	c9                   	leave
+  800d37:	c3                   	ret
+
+00800d38 <memcmp>:
+  800d38:	55                   	push   %ebp
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+  800d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d43:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d46:	85 f6                	test   %esi,%esi
+  800d48:	74 29                	je     800d73 <memcmp+0x3b>
+  800d4a:	01 c6                	add    %eax,%esi
+  800d4c:	0f b6 08             	movzbl (%eax),%ecx
+  800d4f:	0f b6 1a             	movzbl (%edx),%ebx
+  800d52:	38 d9                	cmp    %bl,%cl
+  800d54:	75 11                	jne    800d67 <memcmp+0x2f>
+  800d56:	83 c0 01             	add    $0x1,%eax
+  800d59:	83 c2 01             	add    $0x1,%edx
+  800d5c:	39 c6                	cmp    %eax,%esi
+  800d5e:	75 ec                	jne    800d4c <memcmp+0x14>
+  800d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d65:	eb 08                	jmp    800d6f <memcmp+0x37>
+  800d67:	0f b6 c1             	movzbl %cl,%eax
+  800d6a:	0f b6 db             	movzbl %bl,%ebx
+  800d6d:	29 d8                	sub    %ebx,%eax
+  800d6f:	5b                   	pop    %ebx
+  800d70:	5e                   	pop    %esi
+  800d71:	5d                   	pop    %ebp
+  800d72:	c3                   	ret
+  800d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d78:	eb f5                	jmp    800d6f <memcmp+0x37>
+
+00800d7a <memfind>:
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d83:	89 c2                	mov    %eax,%edx
+  800d85:	03 55 10             	add    0x10(%ebp),%edx
+  800d88:	39 d0                	cmp    %edx,%eax
+  800d8a:	73 0d                	jae    800d99 <memfind+0x1f>
+  800d8c:	38 08                	cmp    %cl,(%eax)
+  800d8e:	74 0d                	je     800d9d <memfind+0x23>
+  800d90:	83 c0 01             	add    $0x1,%eax
+  800d93:	39 c2                	cmp    %eax,%edx
+  800d95:	75 f5                	jne    800d8c <memfind+0x12>
+  800d97:	eb 06                	jmp    800d9f <memfind+0x25>
+  800d99:	89 c2                	mov    %eax,%edx
+  800d9b:	eb 02                	jmp    800d9f <memfind+0x25>
+  800d9d:	89 c2                	mov    %eax,%edx
+  800d9f:	89 d0                	mov    %edx,%eax
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+
+00800da3 <strtol>:
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+  800da9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800daf:	0f b6 02             	movzbl (%edx),%eax
+  800db2:	3c 20                	cmp    $0x20,%al
+  800db4:	74 04                	je     800dba <strtol+0x17>
+  800db6:	3c 09                	cmp    $0x9,%al
+  800db8:	75 0e                	jne    800dc8 <strtol+0x25>
+  800dba:	83 c2 01             	add    $0x1,%edx
+  800dbd:	0f b6 02             	movzbl (%edx),%eax
+  800dc0:	3c 20                	cmp    $0x20,%al
+  800dc2:	74 f6                	je     800dba <strtol+0x17>
+  800dc4:	3c 09                	cmp    $0x9,%al
+  800dc6:	74 f2                	je     800dba <strtol+0x17>
+  800dc8:	3c 2b                	cmp    $0x2b,%al
+  800dca:	74 2a                	je     800df6 <strtol+0x53>
+  800dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd1:	3c 2d                	cmp    $0x2d,%al
+  800dd3:	74 2b                	je     800e00 <strtol+0x5d>
+  800dd5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ddb:	75 0f                	jne    800dec <strtol+0x49>
+  800ddd:	80 3a 30             	cmpb   $0x30,(%edx)
+  800de0:	74 28                	je     800e0a <strtol+0x67>
+  800de2:	85 db                	test   %ebx,%ebx
+  800de4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800de9:	0f 44 d8             	cmove  %eax,%ebx
+  800dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800df4:	eb 46                	jmp    800e3c <strtol+0x99>
+  800df6:	83 c2 01             	add    $0x1,%edx
+  800df9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dfe:	eb d5                	jmp    800dd5 <strtol+0x32>
+  800e00:	83 c2 01             	add    $0x1,%edx
+  800e03:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e08:	eb cb                	jmp    800dd5 <strtol+0x32>
+  800e0a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e0e:	74 0e                	je     800e1e <strtol+0x7b>
+  800e10:	85 db                	test   %ebx,%ebx
+  800e12:	75 d8                	jne    800dec <strtol+0x49>
+  800e14:	83 c2 01             	add    $0x1,%edx
+  800e17:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e1c:	eb ce                	jmp    800dec <strtol+0x49>
+  800e1e:	83 c2 02             	add    $0x2,%edx
+  800e21:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e26:	eb c4                	jmp    800dec <strtol+0x49>
+  800e28:	0f be c0             	movsbl %al,%eax
+  800e2b:	83 e8 30             	sub    $0x30,%eax
+  800e2e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e31:	7d 3a                	jge    800e6d <strtol+0xca>
+  800e33:	83 c2 01             	add    $0x1,%edx
+  800e36:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e3a:	01 c1                	add    %eax,%ecx
+  800e3c:	0f b6 02             	movzbl (%edx),%eax
+  800e3f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e42:	89 f3                	mov    %esi,%ebx
+  800e44:	80 fb 09             	cmp    $0x9,%bl
+  800e47:	76 df                	jbe    800e28 <strtol+0x85>
+  800e49:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e4c:	89 f3                	mov    %esi,%ebx
+  800e4e:	80 fb 19             	cmp    $0x19,%bl
+  800e51:	77 08                	ja     800e5b <strtol+0xb8>
+  800e53:	0f be c0             	movsbl %al,%eax
+  800e56:	83 e8 57             	sub    $0x57,%eax
+  800e59:	eb d3                	jmp    800e2e <strtol+0x8b>
+  800e5b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e5e:	89 f3                	mov    %esi,%ebx
+  800e60:	80 fb 19             	cmp    $0x19,%bl
+  800e63:	77 08                	ja     800e6d <strtol+0xca>
+  800e65:	0f be c0             	movsbl %al,%eax
+  800e68:	83 e8 37             	sub    $0x37,%eax
+  800e6b:	eb c1                	jmp    800e2e <strtol+0x8b>
+  800e6d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e71:	74 05                	je     800e78 <strtol+0xd5>
+  800e73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e76:	89 10                	mov    %edx,(%eax)
+  800e78:	89 c8                	mov    %ecx,%eax
+  800e7a:	f7 d8                	neg    %eax
+  800e7c:	85 ff                	test   %edi,%edi
+  800e7e:	0f 45 c8             	cmovne %eax,%ecx
+  800e81:	89 c8                	mov    %ecx,%eax
+  800e83:	5b                   	pop    %ebx
+  800e84:	5e                   	pop    %esi
+  800e85:	5f                   	pop    %edi
+  800e86:	5d                   	pop    %ebp
+  800e87:	c3                   	ret
+
+00800e88 <sys_cputs>:
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	57                   	push   %edi
+  800e8c:	56                   	push   %esi
+  800e8d:	53                   	push   %ebx
+  800e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e99:	89 c3                	mov    %eax,%ebx
+  800e9b:	89 c7                	mov    %eax,%edi
+  800e9d:	89 c6                	mov    %eax,%esi
+  800e9f:	cd 30                	int    $0x30
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+
+00800ea6 <sys_cgetc>:
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  800eac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb6:	89 d1                	mov    %edx,%ecx
+  800eb8:	89 d3                	mov    %edx,%ebx
+  800eba:	89 d7                	mov    %edx,%edi
+  800ebc:	89 d6                	mov    %edx,%esi
+  800ebe:	cd 30                	int    $0x30
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+
+00800ec5 <sys_env_destroy>:
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+  800ece:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800edb:	89 cb                	mov    %ecx,%ebx
+  800edd:	89 cf                	mov    %ecx,%edi
+  800edf:	89 ce                	mov    %ecx,%esi
+  800ee1:	cd 30                	int    $0x30
+  800ee3:	85 c0                	test   %eax,%eax
+  800ee5:	7f 08                	jg     800eef <sys_env_destroy+0x2a>
+  800ee7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eea:	5b                   	pop    %ebx
+  800eeb:	5e                   	pop    %esi
+  800eec:	5f                   	pop    %edi
+  800eed:	5d                   	pop    %ebp
+  800eee:	c3                   	ret
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+  800ef2:	50                   	push   %eax
+  800ef3:	6a 03                	push   $0x3
+  800ef5:	68 2b 3a 80 00       	push   $0x803a2b
+  800efa:	6a 24                	push   $0x24
+  800efc:	68 48 3a 80 00       	push   $0x803a48
+  800f01:	e8 38 f4 ff ff       	call   80033e <_panic>
+
+00800f06 <sys_getenvid>:
+  800f06:	55                   	push   %ebp
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	57                   	push   %edi
+  800f0a:	56                   	push   %esi
+  800f0b:	53                   	push   %ebx
+  800f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f11:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f16:	89 d1                	mov    %edx,%ecx
+  800f18:	89 d3                	mov    %edx,%ebx
+  800f1a:	89 d7                	mov    %edx,%edi
+  800f1c:	89 d6                	mov    %edx,%esi
+  800f1e:	cd 30                	int    $0x30
+  800f20:	5b                   	pop    %ebx
+  800f21:	5e                   	pop    %esi
+  800f22:	5f                   	pop    %edi
+  800f23:	5d                   	pop    %ebp
+  800f24:	c3                   	ret
+
+00800f25 <sys_yield>:
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	57                   	push   %edi
+  800f29:	56                   	push   %esi
+  800f2a:	53                   	push   %ebx
+  800f2b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f32:	74 26                	je     800f5a <sys_yield+0x35>
+  800f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f39:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f3e:	89 d1                	mov    %edx,%ecx
+  800f40:	89 d3                	mov    %edx,%ebx
+  800f42:	89 d7                	mov    %edx,%edi
+  800f44:	6a 00                	push   $0x0
+  800f46:	55                   	push   %ebp
+  800f47:	89 e5                	mov    %esp,%ebp
+  800f49:	8d 35 51 0f 80 00    	lea    0x800f51,%esi
+  800f4f:	0f 34                	sysenter
+  800f51:	5d                   	pop    %ebp
+  800f52:	83 c4 04             	add    $0x4,%esp
+  800f55:	5b                   	pop    %ebx
+  800f56:	5e                   	pop    %esi
+  800f57:	5f                   	pop    %edi
+  800f58:	5d                   	pop    %ebp
+  800f59:	c3                   	ret
+  800f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f64:	89 d1                	mov    %edx,%ecx
+  800f66:	89 d3                	mov    %edx,%ebx
+  800f68:	89 d7                	mov    %edx,%edi
+  800f6a:	89 d6                	mov    %edx,%esi
+  800f6c:	cd 30                	int    $0x30
+  800f6e:	eb e5                	jmp    800f55 <sys_yield+0x30>
+
+00800f70 <sys_page_alloc>:
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+  800f76:	83 ec 0c             	sub    $0xc,%esp
+  800f79:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8c:	89 f7                	mov    %esi,%edi
+  800f8e:	cd 30                	int    $0x30
+  800f90:	85 c0                	test   %eax,%eax
+  800f92:	7f 08                	jg     800f9c <sys_page_alloc+0x2c>
+  800f94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f97:	5b                   	pop    %ebx
+  800f98:	5e                   	pop    %esi
+  800f99:	5f                   	pop    %edi
+  800f9a:	5d                   	pop    %ebp
+  800f9b:	c3                   	ret
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  800f9f:	50                   	push   %eax
+  800fa0:	6a 04                	push   $0x4
+  800fa2:	68 2b 3a 80 00       	push   $0x803a2b
+  800fa7:	6a 24                	push   $0x24
+  800fa9:	68 48 3a 80 00       	push   $0x803a48
+  800fae:	e8 8b f3 ff ff       	call   80033e <_panic>
+
+00800fb3 <sys_page_map>:
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fc3:	74 33                	je     800ff8 <sys_page_map+0x45>
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd6:	ff 75 18             	push   0x18(%ebp)
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	8d 35 e4 0f 80 00    	lea    0x800fe4,%esi
+  800fe2:	0f 34                	sysenter
+  800fe4:	5d                   	pop    %ebp
+  800fe5:	83 c4 04             	add    $0x4,%esp
+  800fe8:	89 c2                	mov    %eax,%edx
+  800fea:	85 c0                	test   %eax,%eax
+  800fec:	7f 3d                	jg     80102b <sys_page_map+0x78>
+  800fee:	89 d0                	mov    %edx,%eax
+  800ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+  800ff8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801006:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801009:	8b 75 18             	mov    0x18(%ebp),%esi
+  80100c:	cd 30                	int    $0x30
+  80100e:	89 c2                	mov    %eax,%edx
+  801010:	85 c0                	test   %eax,%eax
+  801012:	7e da                	jle    800fee <sys_page_map+0x3b>
+  801014:	83 ec 0c             	sub    $0xc,%esp
+  801017:	50                   	push   %eax
+  801018:	6a 05                	push   $0x5
+  80101a:	68 2b 3a 80 00       	push   $0x803a2b
+  80101f:	6a 24                	push   $0x24
+  801021:	68 48 3a 80 00       	push   $0x803a48
+  801026:	e8 13 f3 ff ff       	call   80033e <_panic>
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+  80102e:	50                   	push   %eax
+  80102f:	6a 05                	push   $0x5
+  801031:	68 2b 3a 80 00       	push   $0x803a2b
+  801036:	6a 48                	push   $0x48
+  801038:	68 48 3a 80 00       	push   $0x803a48
+  80103d:	e8 fc f2 ff ff       	call   80033e <_panic>
+
+00801042 <sys_page_unmap>:
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+  801048:	83 ec 0c             	sub    $0xc,%esp
+  80104b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	b8 06 00 00 00       	mov    $0x6,%eax
+  80105b:	89 df                	mov    %ebx,%edi
+  80105d:	89 de                	mov    %ebx,%esi
+  80105f:	cd 30                	int    $0x30
+  801061:	85 c0                	test   %eax,%eax
+  801063:	7f 08                	jg     80106d <sys_page_unmap+0x2b>
+  801065:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+  80106d:	83 ec 0c             	sub    $0xc,%esp
+  801070:	50                   	push   %eax
+  801071:	6a 06                	push   $0x6
+  801073:	68 2b 3a 80 00       	push   $0x803a2b
+  801078:	6a 24                	push   $0x24
+  80107a:	68 48 3a 80 00       	push   $0x803a48
+  80107f:	e8 ba f2 ff ff       	call   80033e <_panic>
+
+00801084 <sys_fork>:
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	57                   	push   %edi
+  801088:	56                   	push   %esi
+  801089:	53                   	push   %ebx
+  80108a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801094:	89 d1                	mov    %edx,%ecx
+  801096:	89 d3                	mov    %edx,%ebx
+  801098:	89 d7                	mov    %edx,%edi
+  80109a:	89 d6                	mov    %edx,%esi
+  80109c:	cd 30                	int    $0x30
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+
+008010a3 <sys_env_set_status>:
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	56                   	push   %esi
+  8010a8:	53                   	push   %ebx
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010bc:	89 df                	mov    %ebx,%edi
+  8010be:	89 de                	mov    %ebx,%esi
+  8010c0:	cd 30                	int    $0x30
+  8010c2:	85 c0                	test   %eax,%eax
+  8010c4:	7f 08                	jg     8010ce <sys_env_set_status+0x2b>
+  8010c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+  8010ce:	83 ec 0c             	sub    $0xc,%esp
+  8010d1:	50                   	push   %eax
+  8010d2:	6a 08                	push   $0x8
+  8010d4:	68 2b 3a 80 00       	push   $0x803a2b
+  8010d9:	6a 24                	push   $0x24
+  8010db:	68 48 3a 80 00       	push   $0x803a48
+  8010e0:	e8 59 f2 ff ff       	call   80033e <_panic>
+
+008010e5 <sys_env_set_trapframe>:
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	56                   	push   %esi
+  8010ea:	53                   	push   %ebx
+  8010eb:	83 ec 0c             	sub    $0xc,%esp
+  8010ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010fe:	89 df                	mov    %ebx,%edi
+  801100:	89 de                	mov    %ebx,%esi
+  801102:	cd 30                	int    $0x30
+  801104:	85 c0                	test   %eax,%eax
+  801106:	7f 08                	jg     801110 <sys_env_set_trapframe+0x2b>
+  801108:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110b:	5b                   	pop    %ebx
+  80110c:	5e                   	pop    %esi
+  80110d:	5f                   	pop    %edi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	50                   	push   %eax
+  801114:	6a 09                	push   $0x9
+  801116:	68 2b 3a 80 00       	push   $0x803a2b
+  80111b:	6a 24                	push   $0x24
+  80111d:	68 48 3a 80 00       	push   $0x803a48
+  801122:	e8 17 f2 ff ff       	call   80033e <_panic>
+
+00801127 <sys_env_set_cow>:
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	57                   	push   %edi
+  80112b:	56                   	push   %esi
+  80112c:	53                   	push   %ebx
+  80112d:	83 ec 0c             	sub    $0xc,%esp
+  801130:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801135:	8b 55 08             	mov    0x8(%ebp),%edx
+  801138:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801140:	89 df                	mov    %ebx,%edi
+  801142:	89 de                	mov    %ebx,%esi
+  801144:	cd 30                	int    $0x30
+  801146:	85 c0                	test   %eax,%eax
+  801148:	7f 08                	jg     801152 <sys_env_set_cow+0x2b>
+  80114a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114d:	5b                   	pop    %ebx
+  80114e:	5e                   	pop    %esi
+  80114f:	5f                   	pop    %edi
+  801150:	5d                   	pop    %ebp
+  801151:	c3                   	ret
+  801152:	83 ec 0c             	sub    $0xc,%esp
+  801155:	50                   	push   %eax
+  801156:	6a 20                	push   $0x20
+  801158:	68 2b 3a 80 00       	push   $0x803a2b
+  80115d:	6a 24                	push   $0x24
+  80115f:	68 48 3a 80 00       	push   $0x803a48
+  801164:	e8 d5 f1 ff ff       	call   80033e <_panic>
+
+00801169 <sys_env_service>:
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	57                   	push   %edi
+  80116d:	56                   	push   %esi
+  80116e:	53                   	push   %ebx
+  80116f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801174:	8b 55 08             	mov    0x8(%ebp),%edx
+  801177:	b8 21 00 00 00       	mov    $0x21,%eax
+  80117c:	89 cb                	mov    %ecx,%ebx
+  80117e:	89 cf                	mov    %ecx,%edi
+  801180:	89 ce                	mov    %ecx,%esi
+  801182:	cd 30                	int    $0x30
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_env_set_pgfault_upcall>:
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+  801192:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801197:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011a2:	89 df                	mov    %ebx,%edi
+  8011a4:	89 de                	mov    %ebx,%esi
+  8011a6:	cd 30                	int    $0x30
+  8011a8:	85 c0                	test   %eax,%eax
+  8011aa:	7f 08                	jg     8011b4 <sys_env_set_pgfault_upcall+0x2b>
+  8011ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011af:	5b                   	pop    %ebx
+  8011b0:	5e                   	pop    %esi
+  8011b1:	5f                   	pop    %edi
+  8011b2:	5d                   	pop    %ebp
+  8011b3:	c3                   	ret
+  8011b4:	83 ec 0c             	sub    $0xc,%esp
+  8011b7:	50                   	push   %eax
+  8011b8:	6a 0a                	push   $0xa
+  8011ba:	68 2b 3a 80 00       	push   $0x803a2b
+  8011bf:	6a 24                	push   $0x24
+  8011c1:	68 48 3a 80 00       	push   $0x803a48
+  8011c6:	e8 73 f1 ff ff       	call   80033e <_panic>
+
+008011cb <sys_ipc_try_send>:
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	57                   	push   %edi
+  8011cf:	56                   	push   %esi
+  8011d0:	53                   	push   %ebx
+  8011d1:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011d8:	74 27                	je     801201 <sys_ipc_try_send+0x36>
+  8011da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011eb:	6a 00                	push   $0x0
+  8011ed:	55                   	push   %ebp
+  8011ee:	89 e5                	mov    %esp,%ebp
+  8011f0:	8d 35 f8 11 80 00    	lea    0x8011f8,%esi
+  8011f6:	0f 34                	sysenter
+  8011f8:	5d                   	pop    %ebp
+  8011f9:	83 c4 04             	add    $0x4,%esp
+  8011fc:	5b                   	pop    %ebx
+  8011fd:	5e                   	pop    %esi
+  8011fe:	5f                   	pop    %edi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+  801201:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801206:	be 00 00 00 00       	mov    $0x0,%esi
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801211:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801214:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801217:	cd 30                	int    $0x30
+  801219:	eb e1                	jmp    8011fc <sys_ipc_try_send+0x31>
+
+0080121b <sys_ipc_recv>:
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	56                   	push   %esi
+  801220:	53                   	push   %ebx
+  801221:	83 ec 0c             	sub    $0xc,%esp
+  801224:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80122b:	74 32                	je     80125f <sys_ipc_recv+0x44>
+  80122d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801230:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801235:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80123a:	89 cb                	mov    %ecx,%ebx
+  80123c:	89 cf                	mov    %ecx,%edi
+  80123e:	6a 00                	push   $0x0
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	8d 35 4b 12 80 00    	lea    0x80124b,%esi
+  801249:	0f 34                	sysenter
+  80124b:	5d                   	pop    %ebp
+  80124c:	83 c4 04             	add    $0x4,%esp
+  80124f:	89 c2                	mov    %eax,%edx
+  801251:	85 c0                	test   %eax,%eax
+  801253:	7f 3c                	jg     801291 <sys_ipc_recv+0x76>
+  801255:	89 d0                	mov    %edx,%eax
+  801257:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125a:	5b                   	pop    %ebx
+  80125b:	5e                   	pop    %esi
+  80125c:	5f                   	pop    %edi
+  80125d:	5d                   	pop    %ebp
+  80125e:	c3                   	ret
+  80125f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801264:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126c:	89 cb                	mov    %ecx,%ebx
+  80126e:	89 cf                	mov    %ecx,%edi
+  801270:	89 ce                	mov    %ecx,%esi
+  801272:	cd 30                	int    $0x30
+  801274:	89 c2                	mov    %eax,%edx
+  801276:	85 c0                	test   %eax,%eax
+  801278:	7e db                	jle    801255 <sys_ipc_recv+0x3a>
+  80127a:	83 ec 0c             	sub    $0xc,%esp
+  80127d:	50                   	push   %eax
+  80127e:	6a 0d                	push   $0xd
+  801280:	68 2b 3a 80 00       	push   $0x803a2b
+  801285:	6a 24                	push   $0x24
+  801287:	68 48 3a 80 00       	push   $0x803a48
+  80128c:	e8 ad f0 ff ff       	call   80033e <_panic>
+  801291:	83 ec 0c             	sub    $0xc,%esp
+  801294:	50                   	push   %eax
+  801295:	6a 0d                	push   $0xd
+  801297:	68 2b 3a 80 00       	push   $0x803a2b
+  80129c:	6a 48                	push   $0x48
+  80129e:	68 48 3a 80 00       	push   $0x803a48
+  8012a3:	e8 96 f0 ff ff       	call   80033e <_panic>
+
+008012a8 <sys_ipc_send>:
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	57                   	push   %edi
+  8012ac:	56                   	push   %esi
+  8012ad:	53                   	push   %ebx
+  8012ae:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012b5:	74 27                	je     8012de <sys_ipc_send+0x36>
+  8012b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c8:	6a 00                	push   $0x0
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	8d 35 d5 12 80 00    	lea    0x8012d5,%esi
+  8012d3:	0f 34                	sysenter
+  8012d5:	5d                   	pop    %ebp
+  8012d6:	83 c4 04             	add    $0x4,%esp
+  8012d9:	5b                   	pop    %ebx
+  8012da:	5e                   	pop    %esi
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+  8012de:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f4:	cd 30                	int    $0x30
+  8012f6:	eb e1                	jmp    8012d9 <sys_ipc_send+0x31>
+
+008012f8 <sys_ipc_call>:
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+  8012fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801301:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801304:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801309:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801312:	cd 30                	int    $0x30
+  801314:	5b                   	pop    %ebx
+  801315:	5e                   	pop    %esi
+  801316:	5f                   	pop    %edi
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+
+00801319 <sys_ipc_reply_recv>:
+  801319:	55                   	push   %ebp
+  80131a:	89 e5                	mov    %esp,%ebp
+  80131c:	57                   	push   %edi
+  80131d:	56                   	push   %esi
+  80131e:	53                   	push   %ebx
+  80131f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801322:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801325:	b8 10 00 00 00       	mov    $0x10,%eax
+  80132a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801330:	8b 75 18             	mov    0x18(%ebp),%esi
+  801333:	cd 30                	int    $0x30
+  801335:	5b                   	pop    %ebx
+  801336:	5e                   	pop    %esi
+  801337:	5f                   	pop    %edi
+  801338:	5d                   	pop    %ebp
+  801339:	c3                   	ret
+
+0080133a <sys_time_msec>:
+  80133a:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80133f:	85 c0                	test   %eax,%eax
+  801341:	75 06                	jne    801349 <sys_time_msec+0xf>
+  801343:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801348:	c3                   	ret
+  801349:	55                   	push   %ebp
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	57                   	push   %edi
+  80134d:	56                   	push   %esi
+  80134e:	53                   	push   %ebx
+  80134f:	83 ec 0c             	sub    $0xc,%esp
+  801352:	0f 31                	rdtsc
+  801354:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80135a:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801360:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801366:	29 c8                	sub    %ecx,%eax
+  801368:	19 da                	sbb    %ebx,%edx
+  80136a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80136f:	57                   	push   %edi
+  801370:	56                   	push   %esi
+  801371:	52                   	push   %edx
+  801372:	50                   	push   %eax
+  801373:	e8 ae 21 00 00       	call   803526 <__udivdi3>
+  801378:	83 c4 10             	add    $0x10,%esp
+  80137b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137e:	5b                   	pop    %ebx
+  80137f:	5e                   	pop    %esi
+  801380:	5f                   	pop    %edi
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <sys_env_swap>:
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	57                   	push   %edi
+  801387:	56                   	push   %esi
+  801388:	53                   	push   %ebx
+  801389:	83 ec 0c             	sub    $0xc,%esp
+  80138c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801391:	8b 55 08             	mov    0x8(%ebp),%edx
+  801394:	b8 12 00 00 00       	mov    $0x12,%eax
+  801399:	89 cb                	mov    %ecx,%ebx
+  80139b:	89 cf                	mov    %ecx,%edi
+  80139d:	89 ce                	mov    %ecx,%esi
+  80139f:	cd 30                	int    $0x30
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	7f 08                	jg     8013ad <sys_env_swap+0x2a>
+  8013a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a8:	5b                   	pop    %ebx
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5f                   	pop    %edi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+  8013ad:	83 ec 0c             	sub    $0xc,%esp
+  8013b0:	50                   	push   %eax
+  8013b1:	6a 12                	push   $0x12
+  8013b3:	68 2b 3a 80 00       	push   $0x803a2b
+  8013b8:	6a 24                	push   $0x24
+  8013ba:	68 48 3a 80 00       	push   $0x803a48
+  8013bf:	e8 7a ef ff ff       	call   80033e <_panic>
+
+008013c4 <sys_net_try_send>:
+  8013c4:	55                   	push   %ebp
+  8013c5:	89 e5                	mov    %esp,%ebp
+  8013c7:	57                   	push   %edi
+  8013c8:	56                   	push   %esi
+  8013c9:	53                   	push   %ebx
+  8013ca:	83 ec 0c             	sub    $0xc,%esp
+  8013cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013dd:	89 df                	mov    %ebx,%edi
+  8013df:	89 de                	mov    %ebx,%esi
+  8013e1:	cd 30                	int    $0x30
+  8013e3:	85 c0                	test   %eax,%eax
+  8013e5:	7f 08                	jg     8013ef <sys_net_try_send+0x2b>
+  8013e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ea:	5b                   	pop    %ebx
+  8013eb:	5e                   	pop    %esi
+  8013ec:	5f                   	pop    %edi
+  8013ed:	5d                   	pop    %ebp
+  8013ee:	c3                   	ret
+  8013ef:	83 ec 0c             	sub    $0xc,%esp
+  8013f2:	50                   	push   %eax
+  8013f3:	6a 13                	push   $0x13
+  8013f5:	68 2b 3a 80 00       	push   $0x803a2b
+  8013fa:	6a 24                	push   $0x24
+  8013fc:	68 48 3a 80 00       	push   $0x803a48
+  801401:	e8 38 ef ff ff       	call   80033e <_panic>
+
+00801406 <sys_net_try_receive>:
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	57                   	push   %edi
+  80140a:	56                   	push   %esi
+  80140b:	53                   	push   %ebx
+  80140c:	83 ec 0c             	sub    $0xc,%esp
+  80140f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801414:	8b 55 08             	mov    0x8(%ebp),%edx
+  801417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80141f:	89 df                	mov    %ebx,%edi
+  801421:	89 de                	mov    %ebx,%esi
+  801423:	cd 30                	int    $0x30
+  801425:	85 c0                	test   %eax,%eax
+  801427:	7f 08                	jg     801431 <sys_net_try_receive+0x2b>
+  801429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142c:	5b                   	pop    %ebx
+  80142d:	5e                   	pop    %esi
+  80142e:	5f                   	pop    %edi
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+  801431:	83 ec 0c             	sub    $0xc,%esp
+  801434:	50                   	push   %eax
+  801435:	6a 14                	push   $0x14
+  801437:	68 2b 3a 80 00       	push   $0x803a2b
+  80143c:	6a 24                	push   $0x24
+  80143e:	68 48 3a 80 00       	push   $0x803a48
+  801443:	e8 f6 ee ff ff       	call   80033e <_panic>
+
+00801448 <sys_net_recv_page>:
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	57                   	push   %edi
+  80144c:	56                   	push   %esi
+  80144d:	53                   	push   %ebx
+  80144e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801453:	8b 55 08             	mov    0x8(%ebp),%edx
+  801456:	b8 27 00 00 00       	mov    $0x27,%eax
+  80145b:	89 cb                	mov    %ecx,%ebx
+  80145d:	89 cf                	mov    %ecx,%edi
+  80145f:	89 ce                	mov    %ecx,%esi
+  801461:	cd 30                	int    $0x30
+  801463:	5b                   	pop    %ebx
+  801464:	5e                   	pop    %esi
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+
+00801468 <sys_net_wait>:
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	57                   	push   %edi
+  80146c:	56                   	push   %esi
+  80146d:	53                   	push   %ebx
+  80146e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801473:	b8 26 00 00 00       	mov    $0x26,%eax
+  801478:	89 d1                	mov    %edx,%ecx
+  80147a:	89 d3                	mov    %edx,%ebx
+  80147c:	89 d7                	mov    %edx,%edi
+  80147e:	89 d6                	mov    %edx,%esi
+  801480:	cd 30                	int    $0x30
+  801482:	5b                   	pop    %ebx
+  801483:	5e                   	pop    %esi
+  801484:	5f                   	pop    %edi
+  801485:	5d                   	pop    %ebp
+  801486:	c3                   	ret
+
+00801487 <sys_get_mac>:
+  801487:	55                   	push   %ebp
+  801488:	89 e5                	mov    %esp,%ebp
+  80148a:	57                   	push   %edi
+  80148b:	56                   	push   %esi
+  80148c:	53                   	push   %ebx
+  80148d:	83 ec 0c             	sub    $0xc,%esp
+  801490:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	b8 15 00 00 00       	mov    $0x15,%eax
+  8014a0:	89 df                	mov    %ebx,%edi
+  8014a2:	89 de                	mov    %ebx,%esi
+  8014a4:	cd 30                	int    $0x30
+  8014a6:	85 c0                	test   %eax,%eax
+  8014a8:	7f 08                	jg     8014b2 <sys_get_mac+0x2b>
+  8014aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5f                   	pop    %edi
+  8014b0:	5d                   	pop    %ebp
+  8014b1:	c3                   	ret
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	50                   	push   %eax
+  8014b6:	6a 15                	push   $0x15
+  8014b8:	68 2b 3a 80 00       	push   $0x803a2b
+  8014bd:	6a 24                	push   $0x24
+  8014bf:	68 48 3a 80 00       	push   $0x803a48
+  8014c4:	e8 75 ee ff ff       	call   80033e <_panic>
+
+008014c9 <sys_env_lease>:
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	57                   	push   %edi
+  8014cd:	56                   	push   %esi
+  8014ce:	53                   	push   %ebx
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dd:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014e2:	89 df                	mov    %ebx,%edi
+  8014e4:	89 de                	mov    %ebx,%esi
+  8014e6:	cd 30                	int    $0x30
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	7f 08                	jg     8014f4 <sys_env_lease+0x2b>
+  8014ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5f                   	pop    %edi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+  8014f4:	83 ec 0c             	sub    $0xc,%esp
+  8014f7:	50                   	push   %eax
+  8014f8:	6a 16                	push   $0x16
+  8014fa:	68 2b 3a 80 00       	push   $0x803a2b
+  8014ff:	6a 24                	push   $0x24
+  801501:	68 48 3a 80 00       	push   $0x803a48
+  801506:	e8 33 ee ff ff       	call   80033e <_panic>
+
+0080150b <sys_copy_mem>:
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	57                   	push   %edi
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+  801511:	83 ec 0c             	sub    $0xc,%esp
+  801514:	8b 55 08             	mov    0x8(%ebp),%edx
+  801517:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80151f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801522:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801525:	8b 75 18             	mov    0x18(%ebp),%esi
+  801528:	cd 30                	int    $0x30
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	7f 08                	jg     801536 <sys_copy_mem+0x2b>
+  80152e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801531:	5b                   	pop    %ebx
+  801532:	5e                   	pop    %esi
+  801533:	5f                   	pop    %edi
+  801534:	5d                   	pop    %ebp
+  801535:	c3                   	ret
+  801536:	83 ec 0c             	sub    $0xc,%esp
+  801539:	50                   	push   %eax
+  80153a:	6a 17                	push   $0x17
+  80153c:	68 2b 3a 80 00       	push   $0x803a2b
+  801541:	6a 24                	push   $0x24
+  801543:	68 48 3a 80 00       	push   $0x803a48
+  801548:	e8 f1 ed ff ff       	call   80033e <_panic>
+
+0080154d <sys_get_perms>:
+  80154d:	55                   	push   %ebp
+  80154e:	89 e5                	mov    %esp,%ebp
+  801550:	57                   	push   %edi
+  801551:	56                   	push   %esi
+  801552:	53                   	push   %ebx
+  801553:	83 ec 0c             	sub    $0xc,%esp
+  801556:	be 00 00 00 00       	mov    $0x0,%esi
+  80155b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801561:	b8 18 00 00 00       	mov    $0x18,%eax
+  801566:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801569:	89 f7                	mov    %esi,%edi
+  80156b:	cd 30                	int    $0x30
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	7f 08                	jg     801579 <sys_get_perms+0x2c>
+  801571:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801574:	5b                   	pop    %ebx
+  801575:	5e                   	pop    %esi
+  801576:	5f                   	pop    %edi
+  801577:	5d                   	pop    %ebp
+  801578:	c3                   	ret
+  801579:	83 ec 0c             	sub    $0xc,%esp
+  80157c:	50                   	push   %eax
+  80157d:	6a 18                	push   $0x18
+  80157f:	68 2b 3a 80 00       	push   $0x803a2b
+  801584:	6a 24                	push   $0x24
+  801586:	68 48 3a 80 00       	push   $0x803a48
+  80158b:	e8 ae ed ff ff       	call   80033e <_panic>
+
+00801590 <sys_env_unsuspend>:
+  801590:	55                   	push   %ebp
+  801591:	89 e5                	mov    %esp,%ebp
+  801593:	57                   	push   %edi
+  801594:	56                   	push   %esi
+  801595:	53                   	push   %ebx
+  801596:	83 ec 0c             	sub    $0xc,%esp
+  801599:	be 00 00 00 00       	mov    $0x0,%esi
+  80159e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ac:	89 f7                	mov    %esi,%edi
+  8015ae:	cd 30                	int    $0x30
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	7f 08                	jg     8015bc <sys_env_unsuspend+0x2c>
+  8015b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b7:	5b                   	pop    %ebx
+  8015b8:	5e                   	pop    %esi
+  8015b9:	5f                   	pop    %edi
+  8015ba:	5d                   	pop    %ebp
+  8015bb:	c3                   	ret
+  8015bc:	83 ec 0c             	sub    $0xc,%esp
+  8015bf:	50                   	push   %eax
+  8015c0:	6a 19                	push   $0x19
+  8015c2:	68 2b 3a 80 00       	push   $0x803a2b
+  8015c7:	6a 24                	push   $0x24
+  8015c9:	68 48 3a 80 00       	push   $0x803a48
+  8015ce:	e8 6b ed ff ff       	call   80033e <_panic>
+
+008015d3 <sys_migrate>:
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	57                   	push   %edi
+  8015d7:	56                   	push   %esi
+  8015d8:	53                   	push   %ebx
+  8015d9:	83 ec 0c             	sub    $0xc,%esp
+  8015dc:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8015e1:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8015e7:	76 11                	jbe    8015fa <sys_migrate+0x27>
+  8015e9:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8015ee:	0f b6 08             	movzbl (%eax),%ecx
+  8015f1:	05 00 10 00 00       	add    $0x1000,%eax
+  8015f6:	39 d0                	cmp    %edx,%eax
+  8015f8:	72 f4                	jb     8015ee <sys_migrate+0x1b>
+  8015fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801602:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801607:	89 cb                	mov    %ecx,%ebx
+  801609:	89 cf                	mov    %ecx,%edi
+  80160b:	89 ce                	mov    %ecx,%esi
+  80160d:	cd 30                	int    $0x30
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	7f 08                	jg     80161b <sys_migrate+0x48>
+  801613:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801616:	5b                   	pop    %ebx
+  801617:	5e                   	pop    %esi
+  801618:	5f                   	pop    %edi
+  801619:	5d                   	pop    %ebp
+  80161a:	c3                   	ret
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+  80161e:	50                   	push   %eax
+  80161f:	6a 1a                	push   $0x1a
+  801621:	68 2b 3a 80 00       	push   $0x803a2b
+  801626:	6a 24                	push   $0x24
+  801628:	68 48 3a 80 00       	push   $0x803a48
+  80162d:	e8 0c ed ff ff       	call   80033e <_panic>
+
+00801632 <sys_lease_complete>:
+  801632:	55                   	push   %ebp
+  801633:	89 e5                	mov    %esp,%ebp
+  801635:	57                   	push   %edi
+  801636:	56                   	push   %esi
+  801637:	53                   	push   %ebx
+  801638:	83 ec 0c             	sub    $0xc,%esp
+  80163b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801640:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801645:	89 d1                	mov    %edx,%ecx
+  801647:	89 d3                	mov    %edx,%ebx
+  801649:	89 d7                	mov    %edx,%edi
+  80164b:	89 d6                	mov    %edx,%esi
+  80164d:	cd 30                	int    $0x30
+  80164f:	85 c0                	test   %eax,%eax
+  801651:	7f 08                	jg     80165b <sys_lease_complete+0x29>
+  801653:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801656:	5b                   	pop    %ebx
+  801657:	5e                   	pop    %esi
+  801658:	5f                   	pop    %edi
+  801659:	5d                   	pop    %ebp
+  80165a:	c3                   	ret
+  80165b:	83 ec 0c             	sub    $0xc,%esp
+  80165e:	50                   	push   %eax
+  80165f:	6a 1b                	push   $0x1b
+  801661:	68 2b 3a 80 00       	push   $0x803a2b
+  801666:	6a 24                	push   $0x24
+  801668:	68 48 3a 80 00       	push   $0x803a48
+  80166d:	e8 cc ec ff ff       	call   80033e <_panic>
+
+00801672 <sys_env_set_thisenv>:
+  801672:	55                   	push   %ebp
+  801673:	89 e5                	mov    %esp,%ebp
+  801675:	57                   	push   %edi
+  801676:	56                   	push   %esi
+  801677:	53                   	push   %ebx
+  801678:	83 ec 0c             	sub    $0xc,%esp
+  80167b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801680:	8b 55 08             	mov    0x8(%ebp),%edx
+  801683:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801686:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80168b:	89 df                	mov    %ebx,%edi
+  80168d:	89 de                	mov    %ebx,%esi
+  80168f:	cd 30                	int    $0x30
+  801691:	85 c0                	test   %eax,%eax
+  801693:	7f 08                	jg     80169d <sys_env_set_thisenv+0x2b>
+  801695:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801698:	5b                   	pop    %ebx
+  801699:	5e                   	pop    %esi
+  80169a:	5f                   	pop    %edi
+  80169b:	5d                   	pop    %ebp
+  80169c:	c3                   	ret
+  80169d:	83 ec 0c             	sub    $0xc,%esp
+  8016a0:	50                   	push   %eax
+  8016a1:	6a 1c                	push   $0x1c
+  8016a3:	68 2b 3a 80 00       	push   $0x803a2b
+  8016a8:	6a 24                	push   $0x24
+  8016aa:	68 48 3a 80 00       	push   $0x803a48
+  8016af:	e8 8a ec ff ff       	call   80033e <_panic>
+
+008016b4 <sys_env_set_sched>:
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	57                   	push   %edi
+  8016b8:	56                   	push   %esi
+  8016b9:	53                   	push   %ebx
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016d0:	89 f7                	mov    %esi,%edi
+  8016d2:	cd 30                	int    $0x30
+  8016d4:	85 c0                	test   %eax,%eax
+  8016d6:	7f 08                	jg     8016e0 <sys_env_set_sched+0x2c>
+  8016d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016db:	5b                   	pop    %ebx
+  8016dc:	5e                   	pop    %esi
+  8016dd:	5f                   	pop    %edi
+  8016de:	5d                   	pop    %ebp
+  8016df:	c3                   	ret
+  8016e0:	83 ec 0c             	sub    $0xc,%esp
+  8016e3:	50                   	push   %eax
+  8016e4:	6a 1d                	push   $0x1d
+  8016e6:	68 2b 3a 80 00       	push   $0x803a2b
+  8016eb:	6a 24                	push   $0x24
+  8016ed:	68 48 3a 80 00       	push   $0x803a48
+  8016f2:	e8 47 ec ff ff       	call   80033e <_panic>
+
+008016f7 <sys_batch>:
+  8016f7:	55                   	push   %ebp
+  8016f8:	89 e5                	mov    %esp,%ebp
+  8016fa:	57                   	push   %edi
+  8016fb:	56                   	push   %esi
+  8016fc:	53                   	push   %ebx
+  8016fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801702:	8b 55 08             	mov    0x8(%ebp),%edx
+  801705:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801708:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80170d:	89 df                	mov    %ebx,%edi
+  80170f:	89 de                	mov    %ebx,%esi
+  801711:	cd 30                	int    $0x30
+  801713:	5b                   	pop    %ebx
+  801714:	5e                   	pop    %esi
+  801715:	5f                   	pop    %edi
+  801716:	5d                   	pop    %ebp
+  801717:	c3                   	ret
+
+00801718 <sys_env_stats>:
+  801718:	55                   	push   %ebp
+  801719:	89 e5                	mov    %esp,%ebp
+  80171b:	57                   	push   %edi
+  80171c:	56                   	push   %esi
+  80171d:	53                   	push   %ebx
+  80171e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801723:	8b 55 08             	mov    0x8(%ebp),%edx
+  801726:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801729:	b8 23 00 00 00       	mov    $0x23,%eax
+  80172e:	89 df                	mov    %ebx,%edi
+  801730:	89 de                	mov    %ebx,%esi
+  801732:	cd 30                	int    $0x30
+  801734:	5b                   	pop    %ebx
+  801735:	5e                   	pop    %esi
+  801736:	5f                   	pop    %edi
+  801737:	5d                   	pop    %ebp
+  801738:	c3                   	ret
+
+00801739 <sys_trace>:
+  801739:	55                   	push   %ebp
+  80173a:	89 e5                	mov    %esp,%ebp
+  80173c:	57                   	push   %edi
+  80173d:	56                   	push   %esi
+  80173e:	53                   	push   %ebx
+  80173f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801744:	8b 55 08             	mov    0x8(%ebp),%edx
+  801747:	b8 24 00 00 00       	mov    $0x24,%eax
+  80174c:	89 cb                	mov    %ecx,%ebx
+  80174e:	89 cf                	mov    %ecx,%edi
+  801750:	89 ce                	mov    %ecx,%esi
+  801752:	cd 30                	int    $0x30
+  801754:	5b                   	pop    %ebx
+  801755:	5e                   	pop    %esi
+  801756:	5f                   	pop    %edi
+  801757:	5d                   	pop    %ebp
+  801758:	c3                   	ret
+
+00801759 <sys_env_set_pager>:
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	57                   	push   %edi
+  80175d:	56                   	push   %esi
+  80175e:	53                   	push   %ebx
+  80175f:	83 ec 0c             	sub    $0xc,%esp
+  801762:	be 00 00 00 00       	mov    $0x0,%esi
+  801767:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176d:	b8 25 00 00 00       	mov    $0x25,%eax
+  801772:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801775:	89 f7                	mov    %esi,%edi
+  801777:	cd 30                	int    $0x30
+  801779:	85 c0                	test   %eax,%eax
+  80177b:	7f 08                	jg     801785 <sys_env_set_pager+0x2c>
+  80177d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801780:	5b                   	pop    %ebx
+  801781:	5e                   	pop    %esi
+  801782:	5f                   	pop    %edi
+  801783:	5d                   	pop    %ebp
+  801784:	c3                   	ret
+  801785:	83 ec 0c             	sub    $0xc,%esp
+  801788:	50                   	push   %eax
+  801789:	6a 25                	push   $0x25
+  80178b:	68 2b 3a 80 00       	push   $0x803a2b
+  801790:	6a 24                	push   $0x24
+  801792:	68 48 3a 80 00       	push   $0x803a48
+  801797:	e8 a2 eb ff ff       	call   80033e <_panic>
+
+0080179c <sys_pager_retire>:
+  80179c:	55                   	push   %ebp
+  80179d:	89 e5                	mov    %esp,%ebp
+  80179f:	57                   	push   %edi
+  8017a0:	56                   	push   %esi
+  8017a1:	53                   	push   %ebx
+  8017a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017aa:	b8 28 00 00 00       	mov    $0x28,%eax
+  8017af:	89 cb                	mov    %ecx,%ebx
+  8017b1:	89 cf                	mov    %ecx,%edi
+  8017b3:	89 ce                	mov    %ecx,%esi
+  8017b5:	cd 30                	int    $0x30
+  8017b7:	5b                   	pop    %ebx
+  8017b8:	5e                   	pop    %esi
+  8017b9:	5f                   	pop    %edi
+  8017ba:	5d                   	pop    %ebp
+  8017bb:	c3                   	ret
+
+008017bc <sys_prof>:
+  8017bc:	55                   	push   %ebp
+  8017bd:	89 e5                	mov    %esp,%ebp
+  8017bf:	57                   	push   %edi
+  8017c0:	56                   	push   %esi
+  8017c1:	53                   	push   %ebx
+  8017c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cd:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017d5:	89 f7                	mov    %esi,%edi
+  8017d7:	cd 30                	int    $0x30
+  8017d9:	5b                   	pop    %ebx
+  8017da:	5e                   	pop    %esi
+  8017db:	5f                   	pop    %edi
+  8017dc:	5d                   	pop    %ebp
+  8017dd:	c3                   	ret
+
+008017de <argstart>:
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+  8017e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8017ea:	89 10                	mov    %edx,(%eax)
+  8017ec:	89 48 04             	mov    %ecx,0x4(%eax)
+  8017ef:	83 3a 01             	cmpl   $0x1,(%edx)
+  8017f2:	7e 09                	jle    8017fd <argstart+0x1f>
+  8017f4:	ba c8 36 80 00       	mov    $0x8036c8,%edx
+  8017f9:	85 c9                	test   %ecx,%ecx
+  8017fb:	75 05                	jne    801802 <argstart+0x24>
+  8017fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801802:	89 50 08             	mov    %edx,0x8(%eax)
+  801805:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80180c:	5d                   	pop    %ebp
+  80180d:	c3                   	ret
+
+0080180e <argnext>:
+  80180e:	55                   	push   %ebp
+  80180f:	89 e5                	mov    %esp,%ebp
+  801811:	53                   	push   %ebx
+  801812:	83 ec 04             	sub    $0x4,%esp
+  801815:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801818:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  80181f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801822:	85 c0                	test   %eax,%eax
+  801824:	74 74                	je     80189a <argnext+0x8c>
+  801826:	80 38 00             	cmpb   $0x0,(%eax)
+  801829:	75 48                	jne    801873 <argnext+0x65>
+  80182b:	8b 0b                	mov    (%ebx),%ecx
+  80182d:	83 39 01             	cmpl   $0x1,(%ecx)
+  801830:	74 5a                	je     80188c <argnext+0x7e>
+  801832:	8b 53 04             	mov    0x4(%ebx),%edx
+  801835:	8b 42 04             	mov    0x4(%edx),%eax
+  801838:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80183b:	75 4f                	jne    80188c <argnext+0x7e>
+  80183d:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801841:	74 49                	je     80188c <argnext+0x7e>
+  801843:	83 c0 01             	add    $0x1,%eax
+  801846:	89 43 08             	mov    %eax,0x8(%ebx)
+  801849:	83 ec 04             	sub    $0x4,%esp
+  80184c:	8b 01                	mov    (%ecx),%eax
+  80184e:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801855:	50                   	push   %eax
+  801856:	8d 42 08             	lea    0x8(%edx),%eax
+  801859:	50                   	push   %eax
+  80185a:	83 c2 04             	add    $0x4,%edx
+  80185d:	52                   	push   %edx
+  80185e:	e8 5d f4 ff ff       	call   800cc0 <memmove>
+  801863:	8b 03                	mov    (%ebx),%eax
+  801865:	83 28 01             	subl   $0x1,(%eax)
+  801868:	8b 43 08             	mov    0x8(%ebx),%eax
+  80186b:	83 c4 10             	add    $0x10,%esp
+  80186e:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801871:	74 13                	je     801886 <argnext+0x78>
+  801873:	8b 43 08             	mov    0x8(%ebx),%eax
+  801876:	0f b6 10             	movzbl (%eax),%edx
+  801879:	83 c0 01             	add    $0x1,%eax
+  80187c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80187f:	89 d0                	mov    %edx,%eax
+  801881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801884:	c9                   	leave
+  801885:	c3                   	ret
+  801886:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80188a:	75 e7                	jne    801873 <argnext+0x65>
+  80188c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801893:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801898:	eb e5                	jmp    80187f <argnext+0x71>
+  80189a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80189f:	eb de                	jmp    80187f <argnext+0x71>
+
+008018a1 <argnextvalue>:
+  8018a1:	55                   	push   %ebp
+  8018a2:	89 e5                	mov    %esp,%ebp
+  8018a4:	53                   	push   %ebx
+  8018a5:	83 ec 04             	sub    $0x4,%esp
+  8018a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018ab:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	74 12                	je     8018c4 <argnextvalue+0x23>
+  8018b2:	80 38 00             	cmpb   $0x0,(%eax)
+  8018b5:	74 12                	je     8018c9 <argnextvalue+0x28>
+  8018b7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8018ba:	c7 43 08 c8 36 80 00 	movl   $0x8036c8,0x8(%ebx)
+  8018c1:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c7:	c9                   	leave
+  8018c8:	c3                   	ret
+  8018c9:	8b 13                	mov    (%ebx),%edx
+  8018cb:	83 3a 01             	cmpl   $0x1,(%edx)
+  8018ce:	7f 10                	jg     8018e0 <argnextvalue+0x3f>
+  8018d0:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  8018d7:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8018de:	eb e1                	jmp    8018c1 <argnextvalue+0x20>
+  8018e0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8018e3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8018e6:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+  8018e9:	83 ec 04             	sub    $0x4,%esp
+  8018ec:	8b 12                	mov    (%edx),%edx
+  8018ee:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8018f5:	52                   	push   %edx
+  8018f6:	8d 50 08             	lea    0x8(%eax),%edx
+  8018f9:	52                   	push   %edx
+  8018fa:	83 c0 04             	add    $0x4,%eax
+  8018fd:	50                   	push   %eax
+  8018fe:	e8 bd f3 ff ff       	call   800cc0 <memmove>
+  801903:	8b 03                	mov    (%ebx),%eax
+  801905:	83 28 01             	subl   $0x1,(%eax)
+  801908:	83 c4 10             	add    $0x10,%esp
+  80190b:	eb b4                	jmp    8018c1 <argnextvalue+0x20>
+
+0080190d <argvalue>:
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	83 ec 08             	sub    $0x8,%esp
+  801913:	8b 55 08             	mov    0x8(%ebp),%edx
+  801916:	8b 42 0c             	mov    0xc(%edx),%eax
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	74 02                	je     80191f <argvalue+0x12>
+  80191d:	c9                   	leave
+  80191e:	c3                   	ret
+  80191f:	83 ec 0c             	sub    $0xc,%esp
+  801922:	52                   	push   %edx
+  801923:	e8 79 ff ff ff       	call   8018a1 <argnextvalue>
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	eb f0                	jmp    80191d <argvalue+0x10>
+
+0080192d <fd2num>:
+  80192d:	55                   	push   %ebp
+  80192e:	89 e5                	mov    %esp,%ebp
+  801930:	8b 45 08             	mov    0x8(%ebp),%eax
+  801933:	05 00 00 00 30       	add    $0x30000000,%eax
+  801938:	c1 e8 0c             	shr    $0xc,%eax
+  80193b:	5d                   	pop    %ebp
+  80193c:	c3                   	ret
+
+0080193d <fd2data>:
+  80193d:	55                   	push   %ebp
+  80193e:	89 e5                	mov    %esp,%ebp
+  801940:	8b 45 08             	mov    0x8(%ebp),%eax
+  801943:	05 00 00 00 30       	add    $0x30000000,%eax
+  801948:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80194d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801952:	5d                   	pop    %ebp
+  801953:	c3                   	ret
+
+00801954 <fd_alloc>:
+  801954:	55                   	push   %ebp
+  801955:	89 e5                	mov    %esp,%ebp
+  801957:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80195c:	89 c2                	mov    %eax,%edx
+  80195e:	c1 ea 16             	shr    $0x16,%edx
+  801961:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801968:	f6 c2 01             	test   $0x1,%dl
+  80196b:	74 29                	je     801996 <fd_alloc+0x42>
+  80196d:	89 c2                	mov    %eax,%edx
+  80196f:	c1 ea 0c             	shr    $0xc,%edx
+  801972:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801979:	f6 c2 01             	test   $0x1,%dl
+  80197c:	74 18                	je     801996 <fd_alloc+0x42>
+  80197e:	05 00 10 00 00       	add    $0x1000,%eax
+  801983:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801988:	75 d2                	jne    80195c <fd_alloc+0x8>
+  80198a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801994:	eb 05                	jmp    80199b <fd_alloc+0x47>
+  801996:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80199b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199e:	89 02                	mov    %eax,(%edx)
+  8019a0:	89 c8                	mov    %ecx,%eax
+  8019a2:	5d                   	pop    %ebp
+  8019a3:	c3                   	ret
+
+008019a4 <fd_lookup>:
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019aa:	83 f8 1f             	cmp    $0x1f,%eax
+  8019ad:	77 30                	ja     8019df <fd_lookup+0x3b>
+  8019af:	c1 e0 0c             	shl    $0xc,%eax
+  8019b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8019b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019bd:	f6 c2 01             	test   $0x1,%dl
+  8019c0:	74 24                	je     8019e6 <fd_lookup+0x42>
+  8019c2:	89 c2                	mov    %eax,%edx
+  8019c4:	c1 ea 0c             	shr    $0xc,%edx
+  8019c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019ce:	f6 c2 01             	test   $0x1,%dl
+  8019d1:	74 1a                	je     8019ed <fd_lookup+0x49>
+  8019d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019d6:	89 02                	mov    %eax,(%edx)
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	5d                   	pop    %ebp
+  8019de:	c3                   	ret
+  8019df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e4:	eb f7                	jmp    8019dd <fd_lookup+0x39>
+  8019e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019eb:	eb f0                	jmp    8019dd <fd_lookup+0x39>
+  8019ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f2:	eb e9                	jmp    8019dd <fd_lookup+0x39>
+
+008019f4 <dev_lookup>:
+  8019f4:	55                   	push   %ebp
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	53                   	push   %ebx
+  8019f8:	83 ec 04             	sub    $0x4,%esp
+  8019fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a03:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801a08:	39 13                	cmp    %edx,(%ebx)
+  801a0a:	74 37                	je     801a43 <dev_lookup+0x4f>
+  801a0c:	83 c0 01             	add    $0x1,%eax
+  801a0f:	8b 1c 85 d4 3a 80 00 	mov    0x803ad4(,%eax,4),%ebx
+  801a16:	85 db                	test   %ebx,%ebx
+  801a18:	75 ee                	jne    801a08 <dev_lookup+0x14>
+  801a1a:	a1 20 54 80 00       	mov    0x805420,%eax
+  801a1f:	8b 40 48             	mov    0x48(%eax),%eax
+  801a22:	83 ec 04             	sub    $0x4,%esp
+  801a25:	52                   	push   %edx
+  801a26:	50                   	push   %eax
+  801a27:	68 58 3a 80 00       	push   $0x803a58
+  801a2c:	e8 e8 e9 ff ff       	call   800419 <cprintf>
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a3c:	89 1a                	mov    %ebx,(%edx)
+  801a3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a41:	c9                   	leave
+  801a42:	c3                   	ret
+  801a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a48:	eb ef                	jmp    801a39 <dev_lookup+0x45>
+
+00801a4a <fd_close>:
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	57                   	push   %edi
+  801a4e:	56                   	push   %esi
+  801a4f:	53                   	push   %ebx
+  801a50:	83 ec 24             	sub    $0x24,%esp
+  801a53:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a56:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a59:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a5c:	50                   	push   %eax
+  801a5d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a63:	c1 e8 0c             	shr    $0xc,%eax
+  801a66:	50                   	push   %eax
+  801a67:	e8 38 ff ff ff       	call   8019a4 <fd_lookup>
+  801a6c:	89 c3                	mov    %eax,%ebx
+  801a6e:	83 c4 10             	add    $0x10,%esp
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	78 05                	js     801a7a <fd_close+0x30>
+  801a75:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a78:	74 0f                	je     801a89 <fd_close+0x3f>
+  801a7a:	85 ff                	test   %edi,%edi
+  801a7c:	0f 44 df             	cmove  %edi,%ebx
+  801a7f:	89 d8                	mov    %ebx,%eax
+  801a81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a84:	5b                   	pop    %ebx
+  801a85:	5e                   	pop    %esi
+  801a86:	5f                   	pop    %edi
+  801a87:	5d                   	pop    %ebp
+  801a88:	c3                   	ret
+  801a89:	83 ec 08             	sub    $0x8,%esp
+  801a8c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a8f:	50                   	push   %eax
+  801a90:	ff 36                	push   (%esi)
+  801a92:	e8 5d ff ff ff       	call   8019f4 <dev_lookup>
+  801a97:	89 c3                	mov    %eax,%ebx
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 1a                	js     801aba <fd_close+0x70>
+  801aa0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aa3:	8b 40 10             	mov    0x10(%eax),%eax
+  801aa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	74 0b                	je     801aba <fd_close+0x70>
+  801aaf:	83 ec 0c             	sub    $0xc,%esp
+  801ab2:	56                   	push   %esi
+  801ab3:	ff d0                	call   *%eax
+  801ab5:	89 c3                	mov    %eax,%ebx
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	83 ec 08             	sub    $0x8,%esp
+  801abd:	56                   	push   %esi
+  801abe:	6a 00                	push   $0x0
+  801ac0:	e8 7d f5 ff ff       	call   801042 <sys_page_unmap>
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	eb b5                	jmp    801a7f <fd_close+0x35>
+
+00801aca <close>:
+  801aca:	55                   	push   %ebp
+  801acb:	89 e5                	mov    %esp,%ebp
+  801acd:	83 ec 20             	sub    $0x20,%esp
+  801ad0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad3:	50                   	push   %eax
+  801ad4:	ff 75 08             	push   0x8(%ebp)
+  801ad7:	e8 c8 fe ff ff       	call   8019a4 <fd_lookup>
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	85 c0                	test   %eax,%eax
+  801ae1:	79 02                	jns    801ae5 <close+0x1b>
+  801ae3:	c9                   	leave
+  801ae4:	c3                   	ret
+  801ae5:	83 ec 08             	sub    $0x8,%esp
+  801ae8:	6a 01                	push   $0x1
+  801aea:	ff 75 f4             	push   -0xc(%ebp)
+  801aed:	e8 58 ff ff ff       	call   801a4a <fd_close>
+  801af2:	83 c4 10             	add    $0x10,%esp
+  801af5:	eb ec                	jmp    801ae3 <close+0x19>
+
+00801af7 <close_all>:
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 04             	sub    $0x4,%esp
+  801afe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b03:	83 ec 0c             	sub    $0xc,%esp
+  801b06:	53                   	push   %ebx
+  801b07:	e8 be ff ff ff       	call   801aca <close>
+  801b0c:	83 c3 01             	add    $0x1,%ebx
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	83 fb 20             	cmp    $0x20,%ebx
+  801b15:	75 ec                	jne    801b03 <close_all+0xc>
+  801b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1a:	c9                   	leave
+  801b1b:	c3                   	ret
+
+00801b1c <dup>:
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	57                   	push   %edi
+  801b20:	56                   	push   %esi
+  801b21:	53                   	push   %ebx
+  801b22:	83 ec 34             	sub    $0x34,%esp
+  801b25:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b28:	50                   	push   %eax
+  801b29:	ff 75 08             	push   0x8(%ebp)
+  801b2c:	e8 73 fe ff ff       	call   8019a4 <fd_lookup>
+  801b31:	89 c3                	mov    %eax,%ebx
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 7f                	js     801bb9 <dup+0x9d>
+  801b3a:	83 ec 0c             	sub    $0xc,%esp
+  801b3d:	ff 75 0c             	push   0xc(%ebp)
+  801b40:	e8 85 ff ff ff       	call   801aca <close>
+  801b45:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b48:	c1 e6 0c             	shl    $0xc,%esi
+  801b4b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801b51:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b54:	89 3c 24             	mov    %edi,(%esp)
+  801b57:	e8 e1 fd ff ff       	call   80193d <fd2data>
+  801b5c:	89 c3                	mov    %eax,%ebx
+  801b5e:	89 34 24             	mov    %esi,(%esp)
+  801b61:	e8 d7 fd ff ff       	call   80193d <fd2data>
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801b6c:	89 d8                	mov    %ebx,%eax
+  801b6e:	c1 e8 16             	shr    $0x16,%eax
+  801b71:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b78:	a8 01                	test   $0x1,%al
+  801b7a:	74 11                	je     801b8d <dup+0x71>
+  801b7c:	89 d8                	mov    %ebx,%eax
+  801b7e:	c1 e8 0c             	shr    $0xc,%eax
+  801b81:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b88:	f6 c2 01             	test   $0x1,%dl
+  801b8b:	75 36                	jne    801bc3 <dup+0xa7>
+  801b8d:	89 f8                	mov    %edi,%eax
+  801b8f:	c1 e8 0c             	shr    $0xc,%eax
+  801b92:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b99:	83 ec 0c             	sub    $0xc,%esp
+  801b9c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ba1:	50                   	push   %eax
+  801ba2:	56                   	push   %esi
+  801ba3:	6a 00                	push   $0x0
+  801ba5:	57                   	push   %edi
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	e8 06 f4 ff ff       	call   800fb3 <sys_page_map>
+  801bad:	89 c3                	mov    %eax,%ebx
+  801baf:	83 c4 20             	add    $0x20,%esp
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	78 33                	js     801be9 <dup+0xcd>
+  801bb6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bb9:	89 d8                	mov    %ebx,%eax
+  801bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbe:	5b                   	pop    %ebx
+  801bbf:	5e                   	pop    %esi
+  801bc0:	5f                   	pop    %edi
+  801bc1:	5d                   	pop    %ebp
+  801bc2:	c3                   	ret
+  801bc3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bca:	83 ec 0c             	sub    $0xc,%esp
+  801bcd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bd2:	50                   	push   %eax
+  801bd3:	ff 75 d4             	push   -0x2c(%ebp)
+  801bd6:	6a 00                	push   $0x0
+  801bd8:	53                   	push   %ebx
+  801bd9:	6a 00                	push   $0x0
+  801bdb:	e8 d3 f3 ff ff       	call   800fb3 <sys_page_map>
+  801be0:	89 c3                	mov    %eax,%ebx
+  801be2:	83 c4 20             	add    $0x20,%esp
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	79 a4                	jns    801b8d <dup+0x71>
+  801be9:	83 ec 08             	sub    $0x8,%esp
+  801bec:	56                   	push   %esi
+  801bed:	6a 00                	push   $0x0
+  801bef:	e8 4e f4 ff ff       	call   801042 <sys_page_unmap>
+  801bf4:	83 c4 08             	add    $0x8,%esp
+  801bf7:	ff 75 d4             	push   -0x2c(%ebp)
+  801bfa:	6a 00                	push   $0x0
+  801bfc:	e8 41 f4 ff ff       	call   801042 <sys_page_unmap>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	eb b3                	jmp    801bb9 <dup+0x9d>
+
+00801c06 <read>:
+  801c06:	55                   	push   %ebp
+  801c07:	89 e5                	mov    %esp,%ebp
+  801c09:	56                   	push   %esi
+  801c0a:	53                   	push   %ebx
+  801c0b:	83 ec 18             	sub    $0x18,%esp
+  801c0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c14:	50                   	push   %eax
+  801c15:	56                   	push   %esi
+  801c16:	e8 89 fd ff ff       	call   8019a4 <fd_lookup>
+  801c1b:	83 c4 10             	add    $0x10,%esp
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	78 3c                	js     801c5e <read+0x58>
+  801c22:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c25:	83 ec 08             	sub    $0x8,%esp
+  801c28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c2b:	50                   	push   %eax
+  801c2c:	ff 33                	push   (%ebx)
+  801c2e:	e8 c1 fd ff ff       	call   8019f4 <dev_lookup>
+  801c33:	83 c4 10             	add    $0x10,%esp
+  801c36:	85 c0                	test   %eax,%eax
+  801c38:	78 24                	js     801c5e <read+0x58>
+  801c3a:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c3d:	83 e0 03             	and    $0x3,%eax
+  801c40:	83 f8 01             	cmp    $0x1,%eax
+  801c43:	74 20                	je     801c65 <read+0x5f>
+  801c45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c48:	8b 40 08             	mov    0x8(%eax),%eax
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	74 37                	je     801c86 <read+0x80>
+  801c4f:	83 ec 04             	sub    $0x4,%esp
+  801c52:	ff 75 10             	push   0x10(%ebp)
+  801c55:	ff 75 0c             	push   0xc(%ebp)
+  801c58:	53                   	push   %ebx
+  801c59:	ff d0                	call   *%eax
+  801c5b:	83 c4 10             	add    $0x10,%esp
+  801c5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c61:	5b                   	pop    %ebx
+  801c62:	5e                   	pop    %esi
+  801c63:	5d                   	pop    %ebp
+  801c64:	c3                   	ret
+  801c65:	a1 20 54 80 00       	mov    0x805420,%eax
+  801c6a:	8b 40 48             	mov    0x48(%eax),%eax
+  801c6d:	83 ec 04             	sub    $0x4,%esp
+  801c70:	56                   	push   %esi
+  801c71:	50                   	push   %eax
+  801c72:	68 99 3a 80 00       	push   $0x803a99
+  801c77:	e8 9d e7 ff ff       	call   800419 <cprintf>
+  801c7c:	83 c4 10             	add    $0x10,%esp
+  801c7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c84:	eb d8                	jmp    801c5e <read+0x58>
+  801c86:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c8b:	eb d1                	jmp    801c5e <read+0x58>
+
+00801c8d <readn>:
+  801c8d:	55                   	push   %ebp
+  801c8e:	89 e5                	mov    %esp,%ebp
+  801c90:	57                   	push   %edi
+  801c91:	56                   	push   %esi
+  801c92:	53                   	push   %ebx
+  801c93:	83 ec 0c             	sub    $0xc,%esp
+  801c96:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801c99:	8b 75 10             	mov    0x10(%ebp),%esi
+  801c9c:	85 f6                	test   %esi,%esi
+  801c9e:	74 30                	je     801cd0 <readn+0x43>
+  801ca0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caa:	83 ec 04             	sub    $0x4,%esp
+  801cad:	89 f2                	mov    %esi,%edx
+  801caf:	29 c2                	sub    %eax,%edx
+  801cb1:	52                   	push   %edx
+  801cb2:	01 f8                	add    %edi,%eax
+  801cb4:	50                   	push   %eax
+  801cb5:	ff 75 08             	push   0x8(%ebp)
+  801cb8:	e8 49 ff ff ff       	call   801c06 <read>
+  801cbd:	83 c4 10             	add    $0x10,%esp
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	78 15                	js     801cd9 <readn+0x4c>
+  801cc4:	74 11                	je     801cd7 <readn+0x4a>
+  801cc6:	01 c3                	add    %eax,%ebx
+  801cc8:	89 d8                	mov    %ebx,%eax
+  801cca:	39 f3                	cmp    %esi,%ebx
+  801ccc:	72 dc                	jb     801caa <readn+0x1d>
+  801cce:	eb 09                	jmp    801cd9 <readn+0x4c>
+  801cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd5:	eb 02                	jmp    801cd9 <readn+0x4c>
+  801cd7:	89 d8                	mov    %ebx,%eax
+  801cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cdc:	5b                   	pop    %ebx
+  801cdd:	5e                   	pop    %esi
+  801cde:	5f                   	pop    %edi
+  801cdf:	5d                   	pop    %ebp
+  801ce0:	c3                   	ret
+
+00801ce1 <write>:
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	56                   	push   %esi
+  801ce5:	53                   	push   %ebx
+  801ce6:	83 ec 18             	sub    $0x18,%esp
+  801ce9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cef:	50                   	push   %eax
+  801cf0:	53                   	push   %ebx
+  801cf1:	e8 ae fc ff ff       	call   8019a4 <fd_lookup>
+  801cf6:	83 c4 10             	add    $0x10,%esp
+  801cf9:	85 c0                	test   %eax,%eax
+  801cfb:	78 37                	js     801d34 <write+0x53>
+  801cfd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d00:	83 ec 08             	sub    $0x8,%esp
+  801d03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d06:	50                   	push   %eax
+  801d07:	ff 36                	push   (%esi)
+  801d09:	e8 e6 fc ff ff       	call   8019f4 <dev_lookup>
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	78 1f                	js     801d34 <write+0x53>
+  801d15:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d19:	74 20                	je     801d3b <write+0x5a>
+  801d1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	74 37                	je     801d5c <write+0x7b>
+  801d25:	83 ec 04             	sub    $0x4,%esp
+  801d28:	ff 75 10             	push   0x10(%ebp)
+  801d2b:	ff 75 0c             	push   0xc(%ebp)
+  801d2e:	56                   	push   %esi
+  801d2f:	ff d0                	call   *%eax
+  801d31:	83 c4 10             	add    $0x10,%esp
+  801d34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d37:	5b                   	pop    %ebx
+  801d38:	5e                   	pop    %esi
+  801d39:	5d                   	pop    %ebp
+  801d3a:	c3                   	ret
+  801d3b:	a1 20 54 80 00       	mov    0x805420,%eax
+  801d40:	8b 40 48             	mov    0x48(%eax),%eax
+  801d43:	83 ec 04             	sub    $0x4,%esp
+  801d46:	53                   	push   %ebx
+  801d47:	50                   	push   %eax
+  801d48:	68 b5 3a 80 00       	push   $0x803ab5
+  801d4d:	e8 c7 e6 ff ff       	call   800419 <cprintf>
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d5a:	eb d8                	jmp    801d34 <write+0x53>
+  801d5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d61:	eb d1                	jmp    801d34 <write+0x53>
+
+00801d63 <seek>:
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	83 ec 20             	sub    $0x20,%esp
+  801d69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	ff 75 08             	push   0x8(%ebp)
+  801d70:	e8 2f fc ff ff       	call   8019a4 <fd_lookup>
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 0e                	js     801d8a <seek+0x27>
+  801d7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d82:	89 50 04             	mov    %edx,0x4(%eax)
+  801d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+
+00801d8c <ftruncate>:
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 18             	sub    $0x18,%esp
+  801d94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d9a:	50                   	push   %eax
+  801d9b:	53                   	push   %ebx
+  801d9c:	e8 03 fc ff ff       	call   8019a4 <fd_lookup>
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 34                	js     801ddc <ftruncate+0x50>
+  801da8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db1:	50                   	push   %eax
+  801db2:	ff 36                	push   (%esi)
+  801db4:	e8 3b fc ff ff       	call   8019f4 <dev_lookup>
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 1c                	js     801ddc <ftruncate+0x50>
+  801dc0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dc4:	74 1d                	je     801de3 <ftruncate+0x57>
+  801dc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc9:	8b 40 18             	mov    0x18(%eax),%eax
+  801dcc:	85 c0                	test   %eax,%eax
+  801dce:	74 34                	je     801e04 <ftruncate+0x78>
+  801dd0:	83 ec 08             	sub    $0x8,%esp
+  801dd3:	ff 75 0c             	push   0xc(%ebp)
+  801dd6:	56                   	push   %esi
+  801dd7:	ff d0                	call   *%eax
+  801dd9:	83 c4 10             	add    $0x10,%esp
+  801ddc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddf:	5b                   	pop    %ebx
+  801de0:	5e                   	pop    %esi
+  801de1:	5d                   	pop    %ebp
+  801de2:	c3                   	ret
+  801de3:	a1 20 54 80 00       	mov    0x805420,%eax
+  801de8:	8b 40 48             	mov    0x48(%eax),%eax
+  801deb:	83 ec 04             	sub    $0x4,%esp
+  801dee:	53                   	push   %ebx
+  801def:	50                   	push   %eax
+  801df0:	68 78 3a 80 00       	push   $0x803a78
+  801df5:	e8 1f e6 ff ff       	call   800419 <cprintf>
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e02:	eb d8                	jmp    801ddc <ftruncate+0x50>
+  801e04:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e09:	eb d1                	jmp    801ddc <ftruncate+0x50>
+
+00801e0b <fstat>:
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	56                   	push   %esi
+  801e0f:	53                   	push   %ebx
+  801e10:	83 ec 18             	sub    $0x18,%esp
+  801e13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e19:	50                   	push   %eax
+  801e1a:	ff 75 08             	push   0x8(%ebp)
+  801e1d:	e8 82 fb ff ff       	call   8019a4 <fd_lookup>
+  801e22:	83 c4 10             	add    $0x10,%esp
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 49                	js     801e72 <fstat+0x67>
+  801e29:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e2c:	83 ec 08             	sub    $0x8,%esp
+  801e2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e32:	50                   	push   %eax
+  801e33:	ff 36                	push   (%esi)
+  801e35:	e8 ba fb ff ff       	call   8019f4 <dev_lookup>
+  801e3a:	83 c4 10             	add    $0x10,%esp
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 31                	js     801e72 <fstat+0x67>
+  801e41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e44:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e48:	74 2f                	je     801e79 <fstat+0x6e>
+  801e4a:	c6 03 00             	movb   $0x0,(%ebx)
+  801e4d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e54:	00 00 00 
+  801e57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e5e:	00 00 00 
+  801e61:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801e67:	83 ec 08             	sub    $0x8,%esp
+  801e6a:	53                   	push   %ebx
+  801e6b:	56                   	push   %esi
+  801e6c:	ff 50 14             	call   *0x14(%eax)
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+  801e79:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e7e:	eb f2                	jmp    801e72 <fstat+0x67>
+
+00801e80 <stat>:
+  801e80:	55                   	push   %ebp
+  801e81:	89 e5                	mov    %esp,%ebp
+  801e83:	56                   	push   %esi
+  801e84:	53                   	push   %ebx
+  801e85:	83 ec 08             	sub    $0x8,%esp
+  801e88:	6a 00                	push   $0x0
+  801e8a:	ff 75 08             	push   0x8(%ebp)
+  801e8d:	e8 31 05 00 00       	call   8023c3 <open>
+  801e92:	89 c3                	mov    %eax,%ebx
+  801e94:	83 c4 10             	add    $0x10,%esp
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 1b                	js     801eb6 <stat+0x36>
+  801e9b:	83 ec 08             	sub    $0x8,%esp
+  801e9e:	ff 75 0c             	push   0xc(%ebp)
+  801ea1:	50                   	push   %eax
+  801ea2:	e8 64 ff ff ff       	call   801e0b <fstat>
+  801ea7:	89 c6                	mov    %eax,%esi
+  801ea9:	89 1c 24             	mov    %ebx,(%esp)
+  801eac:	e8 19 fc ff ff       	call   801aca <close>
+  801eb1:	83 c4 10             	add    $0x10,%esp
+  801eb4:	89 f3                	mov    %esi,%ebx
+  801eb6:	89 d8                	mov    %ebx,%eax
+  801eb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ebb:	5b                   	pop    %ebx
+  801ebc:	5e                   	pop    %esi
+  801ebd:	5d                   	pop    %ebp
+  801ebe:	c3                   	ret
+
+00801ebf <fsipc>:
+  801ebf:	55                   	push   %ebp
+  801ec0:	89 e5                	mov    %esp,%ebp
+  801ec2:	56                   	push   %esi
+  801ec3:	53                   	push   %ebx
+  801ec4:	89 c3                	mov    %eax,%ebx
+  801ec6:	89 d6                	mov    %edx,%esi
+  801ec8:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801ecf:	74 20                	je     801ef1 <fsipc+0x32>
+  801ed1:	83 ec 08             	sub    $0x8,%esp
+  801ed4:	6a 00                	push   $0x0
+  801ed6:	56                   	push   %esi
+  801ed7:	6a 07                	push   $0x7
+  801ed9:	68 00 60 80 00       	push   $0x806000
+  801ede:	53                   	push   %ebx
+  801edf:	ff 35 08 50 80 00    	push   0x805008
+  801ee5:	e8 6e 13 00 00       	call   803258 <ipc_call>
+  801eea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eed:	5b                   	pop    %ebx
+  801eee:	5e                   	pop    %esi
+  801eef:	5d                   	pop    %ebp
+  801ef0:	c3                   	ret
+  801ef1:	83 ec 0c             	sub    $0xc,%esp
+  801ef4:	6a 02                	push   $0x2
+  801ef6:	e8 f8 14 00 00       	call   8033f3 <ipc_find_env>
+  801efb:	a3 08 50 80 00       	mov    %eax,0x805008
+  801f00:	83 c4 10             	add    $0x10,%esp
+  801f03:	eb cc                	jmp    801ed1 <fsipc+0x12>
+
+00801f05 <devfile_trunc>:
+  801f05:	55                   	push   %ebp
+  801f06:	89 e5                	mov    %esp,%ebp
+  801f08:	83 ec 08             	sub    $0x8,%esp
+  801f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f11:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f19:	a3 04 60 80 00       	mov    %eax,0x806004
+  801f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f23:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f28:	e8 92 ff ff ff       	call   801ebf <fsipc>
+  801f2d:	c9                   	leave
+  801f2e:	c3                   	ret
+
+00801f2f <devfile_flush>:
+  801f2f:	55                   	push   %ebp
+  801f30:	89 e5                	mov    %esp,%ebp
+  801f32:	83 ec 08             	sub    $0x8,%esp
+  801f35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f38:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f3b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f45:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f4a:	e8 70 ff ff ff       	call   801ebf <fsipc>
+  801f4f:	c9                   	leave
+  801f50:	c3                   	ret
+
+00801f51 <devfile_stat>:
+  801f51:	55                   	push   %ebp
+  801f52:	89 e5                	mov    %esp,%ebp
+  801f54:	53                   	push   %ebx
+  801f55:	83 ec 04             	sub    $0x4,%esp
+  801f58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f61:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f70:	e8 4a ff ff ff       	call   801ebf <fsipc>
+  801f75:	85 c0                	test   %eax,%eax
+  801f77:	78 2c                	js     801fa5 <devfile_stat+0x54>
+  801f79:	83 ec 08             	sub    $0x8,%esp
+  801f7c:	68 00 60 80 00       	push   $0x806000
+  801f81:	53                   	push   %ebx
+  801f82:	e8 89 eb ff ff       	call   800b10 <strcpy>
+  801f87:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f8c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801f92:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f97:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa8:	c9                   	leave
+  801fa9:	c3                   	ret
+
+00801faa <fsring_rw>:
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	57                   	push   %edi
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	83 ec 2c             	sub    $0x2c,%esp
+  801fb3:	89 c7                	mov    %eax,%edi
+  801fb5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801fb8:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801fbb:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801fc0:	a8 01                	test   $0x1,%al
+  801fc2:	74 0d                	je     801fd1 <fsring_rw+0x27>
+  801fc4:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801fc9:	a8 01                	test   $0x1,%al
+  801fcb:	0f 85 d5 00 00 00    	jne    8020a6 <fsring_rw+0xfc>
+  801fd1:	a1 20 54 80 00       	mov    0x805420,%eax
+  801fd6:	8b 40 48             	mov    0x48(%eax),%eax
+  801fd9:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801fdf:	0f 84 fc 00 00 00    	je     8020e1 <fsring_rw+0x137>
+  801fe5:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801fec:	0f 84 02 01 00 00    	je     8020f4 <fsring_rw+0x14a>
+  801ff2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ff7:	83 ec 04             	sub    $0x4,%esp
+  801ffa:	68 07 02 00 00       	push   $0x207
+  801fff:	53                   	push   %ebx
+  802000:	6a 00                	push   $0x0
+  802002:	e8 69 ef ff ff       	call   800f70 <sys_page_alloc>
+  802007:	83 c4 10             	add    $0x10,%esp
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	0f 88 f9 00 00 00    	js     80210b <fsring_rw+0x161>
+  802012:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802018:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80201e:	75 d7                	jne    801ff7 <fsring_rw+0x4d>
+  802020:	6a 0e                	push   $0xe
+  802022:	6a 0d                	push   $0xd
+  802024:	ff 35 08 50 80 00    	push   0x805008
+  80202a:	68 00 00 f0 cf       	push   $0xcff00000
+  80202f:	e8 d8 0d 00 00       	call   802e0c <ipcring_init>
+  802034:	83 c4 08             	add    $0x8,%esp
+  802037:	6a 00                	push   $0x0
+  802039:	6a 00                	push   $0x0
+  80203b:	68 07 02 00 00       	push   $0x207
+  802040:	68 00 00 f0 cf       	push   $0xcff00000
+  802045:	6a 0b                	push   $0xb
+  802047:	ff 35 08 50 80 00    	push   0x805008
+  80204d:	e8 06 12 00 00       	call   803258 <ipc_call>
+  802052:	89 c6                	mov    %eax,%esi
+  802054:	83 c4 20             	add    $0x20,%esp
+  802057:	85 c0                	test   %eax,%eax
+  802059:	0f 88 ac 00 00 00    	js     80210b <fsring_rw+0x161>
+  80205f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802064:	89 d9                	mov    %ebx,%ecx
+  802066:	83 c3 01             	add    $0x1,%ebx
+  802069:	89 da                	mov    %ebx,%edx
+  80206b:	c1 e2 0c             	shl    $0xc,%edx
+  80206e:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802074:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80207a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802080:	83 ec 08             	sub    $0x8,%esp
+  802083:	6a 00                	push   $0x0
+  802085:	6a 00                	push   $0x0
+  802087:	68 07 02 00 00       	push   $0x207
+  80208c:	50                   	push   %eax
+  80208d:	6a 0c                	push   $0xc
+  80208f:	ff 35 08 50 80 00    	push   0x805008
+  802095:	e8 be 11 00 00       	call   803258 <ipc_call>
+  80209a:	83 c4 20             	add    $0x20,%esp
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 6a                	js     80210b <fsring_rw+0x161>
+  8020a1:	83 fb 08             	cmp    $0x8,%ebx
+  8020a4:	75 be                	jne    802064 <fsring_rw+0xba>
+  8020a6:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8020aa:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8020af:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8020b4:	0f 45 c2             	cmovne %edx,%eax
+  8020b7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8020ba:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8020c1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8020c8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8020cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8020dc:	e9 4b 01 00 00       	jmp    80222c <fsring_rw+0x282>
+  8020e1:	e8 54 f2 ff ff       	call   80133a <sys_time_msec>
+  8020e6:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8020ec:	0f 89 f3 fe ff ff    	jns    801fe5 <fsring_rw+0x3b>
+  8020f2:	eb 54                	jmp    802148 <fsring_rw+0x19e>
+  8020f4:	83 ec 0c             	sub    $0xc,%esp
+  8020f7:	6a 02                	push   $0x2
+  8020f9:	e8 f5 12 00 00       	call   8033f3 <ipc_find_env>
+  8020fe:	a3 08 50 80 00       	mov    %eax,0x805008
+  802103:	83 c4 10             	add    $0x10,%esp
+  802106:	e9 e7 fe ff ff       	jmp    801ff2 <fsring_rw+0x48>
+  80210b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802110:	83 ec 08             	sub    $0x8,%esp
+  802113:	53                   	push   %ebx
+  802114:	6a 00                	push   $0x0
+  802116:	e8 27 ef ff ff       	call   801042 <sys_page_unmap>
+  80211b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80212a:	75 e4                	jne    802110 <fsring_rw+0x166>
+  80212c:	e8 09 f2 ff ff       	call   80133a <sys_time_msec>
+  802131:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802136:	a3 00 50 80 00       	mov    %eax,0x805000
+  80213b:	a1 20 54 80 00       	mov    0x805420,%eax
+  802140:	8b 40 48             	mov    0x48(%eax),%eax
+  802143:	a3 04 50 80 00       	mov    %eax,0x805004
+  802148:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80214f:	e9 7a 01 00 00       	jmp    8022ce <fsring_rw+0x324>
+  802154:	8b 57 0c             	mov    0xc(%edi),%edx
+  802157:	89 10                	mov    %edx,(%eax)
+  802159:	89 58 04             	mov    %ebx,0x4(%eax)
+  80215c:	89 f2                	mov    %esi,%edx
+  80215e:	03 57 04             	add    0x4(%edi),%edx
+  802161:	89 50 08             	mov    %edx,0x8(%eax)
+  802164:	83 ec 04             	sub    $0x4,%esp
+  802167:	53                   	push   %ebx
+  802168:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80216b:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80216e:	52                   	push   %edx
+  80216f:	83 c0 0c             	add    $0xc,%eax
+  802172:	50                   	push   %eax
+  802173:	e8 48 eb ff ff       	call   800cc0 <memmove>
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80217e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802181:	89 08                	mov    %ecx,(%eax)
+  802183:	83 ec 0c             	sub    $0xc,%esp
+  802186:	68 00 00 f0 cf       	push   $0xcff00000
+  80218b:	e8 da 0c 00 00       	call   802e6a <ipcring_req_push>
+  802190:	01 de                	add    %ebx,%esi
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802198:	73 4c                	jae    8021e6 <fsring_rw+0x23c>
+  80219a:	83 ec 0c             	sub    $0xc,%esp
+  80219d:	68 00 00 f0 cf       	push   $0xcff00000
+  8021a2:	e8 9d 0c 00 00       	call   802e44 <ipcring_req_slot>
+  8021a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021aa:	83 c4 10             	add    $0x10,%esp
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	74 35                	je     8021e6 <fsring_rw+0x23c>
+  8021b1:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8021b6:	83 e0 07             	and    $0x7,%eax
+  8021b9:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8021be:	c1 e0 0c             	shl    $0xc,%eax
+  8021c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021c4:	29 f3                	sub    %esi,%ebx
+  8021c6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8021c9:	39 cb                	cmp    %ecx,%ebx
+  8021cb:	0f 47 d9             	cmova  %ecx,%ebx
+  8021ce:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8021d2:	75 80                	jne    802154 <fsring_rw+0x1aa>
+  8021d4:	8b 57 0c             	mov    0xc(%edi),%edx
+  8021d7:	89 10                	mov    %edx,(%eax)
+  8021d9:	89 58 04             	mov    %ebx,0x4(%eax)
+  8021dc:	89 f2                	mov    %esi,%edx
+  8021de:	03 57 04             	add    0x4(%edi),%edx
+  8021e1:	89 50 08             	mov    %edx,0x8(%eax)
+  8021e4:	eb 95                	jmp    80217b <fsring_rw+0x1d1>
+  8021e6:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8021eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021ee:	83 ec 0c             	sub    $0xc,%esp
+  8021f1:	68 00 00 f0 cf       	push   $0xcff00000
+  8021f6:	e8 a8 0c 00 00       	call   802ea3 <ipcring_rsp_wait>
+  8021fb:	8b 58 04             	mov    0x4(%eax),%ebx
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802205:	75 45                	jne    80224c <fsring_rw+0x2a2>
+  802207:	85 db                	test   %ebx,%ebx
+  802209:	79 41                	jns    80224c <fsring_rw+0x2a2>
+  80220b:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80220e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802215:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  80221c:	83 ec 0c             	sub    $0xc,%esp
+  80221f:	68 00 00 f0 cf       	push   $0xcff00000
+  802224:	e8 e0 0c 00 00       	call   802f09 <ipcring_rsp_pop>
+  802229:	83 c4 10             	add    $0x10,%esp
+  80222c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802232:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802237:	39 c2                	cmp    %eax,%edx
+  802239:	74 75                	je     8022b0 <fsring_rw+0x306>
+  80223b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80223f:	75 a5                	jne    8021e6 <fsring_rw+0x23c>
+  802241:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802244:	0f 82 50 ff ff ff    	jb     80219a <fsring_rw+0x1f0>
+  80224a:	eb 9a                	jmp    8021e6 <fsring_rw+0x23c>
+  80224c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802250:	75 ca                	jne    80221c <fsring_rw+0x272>
+  802252:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802256:	74 31                	je     802289 <fsring_rw+0x2df>
+  802258:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80225e:	29 c8                	sub    %ecx,%eax
+  802260:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802263:	39 d0                	cmp    %edx,%eax
+  802265:	0f 47 c2             	cmova  %edx,%eax
+  802268:	39 d8                	cmp    %ebx,%eax
+  80226a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80226f:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802273:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802276:	b8 01 00 00 00       	mov    $0x1,%eax
+  80227b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80227f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802282:	01 d9                	add    %ebx,%ecx
+  802284:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802287:	eb 93                	jmp    80221c <fsring_rw+0x272>
+  802289:	83 ec 04             	sub    $0x4,%esp
+  80228c:	53                   	push   %ebx
+  80228d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802290:	83 e0 07             	and    $0x7,%eax
+  802293:	c1 e0 0c             	shl    $0xc,%eax
+  802296:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80229c:	50                   	push   %eax
+  80229d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8022a0:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8022a3:	01 c8                	add    %ecx,%eax
+  8022a5:	50                   	push   %eax
+  8022a6:	e8 15 ea ff ff       	call   800cc0 <memmove>
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	eb a8                	jmp    802258 <fsring_rw+0x2ae>
+  8022b0:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8022b4:	75 09                	jne    8022bf <fsring_rw+0x315>
+  8022b6:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8022b9:	0f 82 db fe ff ff    	jb     80219a <fsring_rw+0x1f0>
+  8022bf:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8022c2:	01 57 04             	add    %edx,0x4(%edi)
+  8022c5:	85 d2                	test   %edx,%edx
+  8022c7:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8022cb:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8022ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8022d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d4:	5b                   	pop    %ebx
+  8022d5:	5e                   	pop    %esi
+  8022d6:	5f                   	pop    %edi
+  8022d7:	5d                   	pop    %ebp
+  8022d8:	c3                   	ret
+
+008022d9 <devfile_write>:
+  8022d9:	55                   	push   %ebp
+  8022da:	89 e5                	mov    %esp,%ebp
+  8022dc:	57                   	push   %edi
+  8022dd:	56                   	push   %esi
+  8022de:	53                   	push   %ebx
+  8022df:	83 ec 0c             	sub    $0xc,%esp
+  8022e2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8022e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022eb:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8022f1:	76 1a                	jbe    80230d <devfile_write+0x34>
+  8022f3:	83 ec 0c             	sub    $0xc,%esp
+  8022f6:	53                   	push   %ebx
+  8022f7:	89 f1                	mov    %esi,%ecx
+  8022f9:	ba 06 00 00 00       	mov    $0x6,%edx
+  8022fe:	89 f8                	mov    %edi,%eax
+  802300:	e8 a5 fc ff ff       	call   801faa <fsring_rw>
+  802305:	83 c4 10             	add    $0x10,%esp
+  802308:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80230b:	75 39                	jne    802346 <devfile_write+0x6d>
+  80230d:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802312:	39 c3                	cmp    %eax,%ebx
+  802314:	0f 47 d8             	cmova  %eax,%ebx
+  802317:	8b 47 0c             	mov    0xc(%edi),%eax
+  80231a:	a3 00 60 80 00       	mov    %eax,0x806000
+  80231f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802325:	83 ec 04             	sub    $0x4,%esp
+  802328:	53                   	push   %ebx
+  802329:	56                   	push   %esi
+  80232a:	68 08 60 80 00       	push   $0x806008
+  80232f:	e8 8c e9 ff ff       	call   800cc0 <memmove>
+  802334:	ba 00 00 00 00       	mov    $0x0,%edx
+  802339:	b8 04 00 00 00       	mov    $0x4,%eax
+  80233e:	e8 7c fb ff ff       	call   801ebf <fsipc>
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802349:	5b                   	pop    %ebx
+  80234a:	5e                   	pop    %esi
+  80234b:	5f                   	pop    %edi
+  80234c:	5d                   	pop    %ebp
+  80234d:	c3                   	ret
+
+0080234e <devfile_read>:
+  80234e:	55                   	push   %ebp
+  80234f:	89 e5                	mov    %esp,%ebp
+  802351:	57                   	push   %edi
+  802352:	56                   	push   %esi
+  802353:	53                   	push   %ebx
+  802354:	83 ec 0c             	sub    $0xc,%esp
+  802357:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80235a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80235d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802363:	76 1d                	jbe    802382 <devfile_read+0x34>
+  802365:	83 ec 0c             	sub    $0xc,%esp
+  802368:	56                   	push   %esi
+  802369:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80236c:	ba 05 00 00 00       	mov    $0x5,%edx
+  802371:	89 f8                	mov    %edi,%eax
+  802373:	e8 32 fc ff ff       	call   801faa <fsring_rw>
+  802378:	89 c3                	mov    %eax,%ebx
+  80237a:	83 c4 10             	add    $0x10,%esp
+  80237d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802380:	75 37                	jne    8023b9 <devfile_read+0x6b>
+  802382:	8b 47 0c             	mov    0xc(%edi),%eax
+  802385:	a3 00 60 80 00       	mov    %eax,0x806000
+  80238a:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802390:	ba 00 00 00 00       	mov    $0x0,%edx
+  802395:	b8 03 00 00 00       	mov    $0x3,%eax
+  80239a:	e8 20 fb ff ff       	call   801ebf <fsipc>
+  80239f:	89 c3                	mov    %eax,%ebx
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 14                	js     8023b9 <devfile_read+0x6b>
+  8023a5:	83 ec 04             	sub    $0x4,%esp
+  8023a8:	50                   	push   %eax
+  8023a9:	68 00 60 80 00       	push   $0x806000
+  8023ae:	ff 75 0c             	push   0xc(%ebp)
+  8023b1:	e8 0a e9 ff ff       	call   800cc0 <memmove>
+  8023b6:	83 c4 10             	add    $0x10,%esp
+  8023b9:	89 d8                	mov    %ebx,%eax
+  8023bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023be:	5b                   	pop    %ebx
+  8023bf:	5e                   	pop    %esi
+  8023c0:	5f                   	pop    %edi
+  8023c1:	5d                   	pop    %ebp
+  8023c2:	c3                   	ret
+
+008023c3 <open>:
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	56                   	push   %esi
+  8023c7:	53                   	push   %ebx
+  8023c8:	83 ec 1c             	sub    $0x1c,%esp
+  8023cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023ce:	56                   	push   %esi
+  8023cf:	e8 f0 e6 ff ff       	call   800ac4 <strlen>
+  8023d4:	83 c4 10             	add    $0x10,%esp
+  8023d7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023dc:	7f 6c                	jg     80244a <open+0x87>
+  8023de:	83 ec 0c             	sub    $0xc,%esp
+  8023e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023e4:	50                   	push   %eax
+  8023e5:	e8 6a f5 ff ff       	call   801954 <fd_alloc>
+  8023ea:	89 c3                	mov    %eax,%ebx
+  8023ec:	83 c4 10             	add    $0x10,%esp
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 3c                	js     80242f <open+0x6c>
+  8023f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f6:	a3 00 64 80 00       	mov    %eax,0x806400
+  8023fb:	83 ec 08             	sub    $0x8,%esp
+  8023fe:	56                   	push   %esi
+  8023ff:	68 00 60 80 00       	push   $0x806000
+  802404:	e8 07 e7 ff ff       	call   800b10 <strcpy>
+  802409:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80240c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802411:	e8 a9 fa ff ff       	call   801ebf <fsipc>
+  802416:	89 c3                	mov    %eax,%ebx
+  802418:	83 c4 10             	add    $0x10,%esp
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 19                	js     802438 <open+0x75>
+  80241f:	83 ec 0c             	sub    $0xc,%esp
+  802422:	ff 75 f4             	push   -0xc(%ebp)
+  802425:	e8 03 f5 ff ff       	call   80192d <fd2num>
+  80242a:	89 c3                	mov    %eax,%ebx
+  80242c:	83 c4 10             	add    $0x10,%esp
+  80242f:	89 d8                	mov    %ebx,%eax
+  802431:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802434:	5b                   	pop    %ebx
+  802435:	5e                   	pop    %esi
+  802436:	5d                   	pop    %ebp
+  802437:	c3                   	ret
+  802438:	83 ec 08             	sub    $0x8,%esp
+  80243b:	6a 00                	push   $0x0
+  80243d:	ff 75 f4             	push   -0xc(%ebp)
+  802440:	e8 05 f6 ff ff       	call   801a4a <fd_close>
+  802445:	83 c4 10             	add    $0x10,%esp
+  802448:	eb e5                	jmp    80242f <open+0x6c>
+  80244a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80244f:	eb de                	jmp    80242f <open+0x6c>
+
+00802451 <file_image>:
+  802451:	55                   	push   %ebp
+  802452:	89 e5                	mov    %esp,%ebp
+  802454:	53                   	push   %ebx
+  802455:	83 ec 1c             	sub    $0x1c,%esp
+  802458:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80245b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80245e:	50                   	push   %eax
+  80245f:	ff 75 08             	push   0x8(%ebp)
+  802462:	e8 3d f5 ff ff       	call   8019a4 <fd_lookup>
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	78 58                	js     8024c6 <file_image+0x75>
+  80246e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802471:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802477:	39 08                	cmp    %ecx,(%eax)
+  802479:	75 50                	jne    8024cb <file_image+0x7a>
+  80247b:	83 fb 04             	cmp    $0x4,%ebx
+  80247e:	77 52                	ja     8024d2 <file_image+0x81>
+  802480:	8b 40 0c             	mov    0xc(%eax),%eax
+  802483:	a3 00 60 80 00       	mov    %eax,0x806000
+  802488:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80248e:	83 ec 04             	sub    $0x4,%esp
+  802491:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802494:	c1 e0 02             	shl    $0x2,%eax
+  802497:	50                   	push   %eax
+  802498:	ff 75 0c             	push   0xc(%ebp)
+  80249b:	68 08 60 80 00       	push   $0x806008
+  8024a0:	e8 1b e8 ff ff       	call   800cc0 <memmove>
+  8024a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024aa:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024af:	e8 0b fa ff ff       	call   801ebf <fsipc>
+  8024b4:	83 c4 10             	add    $0x10,%esp
+  8024b7:	85 c0                	test   %eax,%eax
+  8024b9:	78 0b                	js     8024c6 <file_image+0x75>
+  8024bb:	8b 55 14             	mov    0x14(%ebp),%edx
+  8024be:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8024c4:	89 0a                	mov    %ecx,(%edx)
+  8024c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+  8024cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024d0:	eb f4                	jmp    8024c6 <file_image+0x75>
+  8024d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024d7:	eb ed                	jmp    8024c6 <file_image+0x75>
+
+008024d9 <remove>:
+  8024d9:	55                   	push   %ebp
+  8024da:	89 e5                	mov    %esp,%ebp
+  8024dc:	53                   	push   %ebx
+  8024dd:	83 ec 10             	sub    $0x10,%esp
+  8024e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024e3:	53                   	push   %ebx
+  8024e4:	e8 db e5 ff ff       	call   800ac4 <strlen>
+  8024e9:	83 c4 10             	add    $0x10,%esp
+  8024ec:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024f1:	7f 25                	jg     802518 <remove+0x3f>
+  8024f3:	83 ec 08             	sub    $0x8,%esp
+  8024f6:	53                   	push   %ebx
+  8024f7:	68 00 60 80 00       	push   $0x806000
+  8024fc:	e8 0f e6 ff ff       	call   800b10 <strcpy>
+  802501:	ba 00 00 00 00       	mov    $0x0,%edx
+  802506:	b8 09 00 00 00       	mov    $0x9,%eax
+  80250b:	e8 af f9 ff ff       	call   801ebf <fsipc>
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802516:	c9                   	leave
+  802517:	c3                   	ret
+  802518:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80251d:	eb f4                	jmp    802513 <remove+0x3a>
+
+0080251f <sync>:
+  80251f:	55                   	push   %ebp
+  802520:	89 e5                	mov    %esp,%ebp
+  802522:	83 ec 08             	sub    $0x8,%esp
+  802525:	ba 00 00 00 00       	mov    $0x0,%edx
+  80252a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80252f:	e8 8b f9 ff ff       	call   801ebf <fsipc>
+  802534:	c9                   	leave
+  802535:	c3                   	ret
+
+00802536 <writebuf>:
+  802536:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80253a:	7f 01                	jg     80253d <writebuf+0x7>
+  80253c:	c3                   	ret
+  80253d:	55                   	push   %ebp
+  80253e:	89 e5                	mov    %esp,%ebp
+  802540:	53                   	push   %ebx
+  802541:	83 ec 08             	sub    $0x8,%esp
+  802544:	89 c3                	mov    %eax,%ebx
+  802546:	ff 70 04             	push   0x4(%eax)
+  802549:	8d 40 10             	lea    0x10(%eax),%eax
+  80254c:	50                   	push   %eax
+  80254d:	ff 33                	push   (%ebx)
+  80254f:	e8 8d f7 ff ff       	call   801ce1 <write>
+  802554:	83 c4 10             	add    $0x10,%esp
+  802557:	85 c0                	test   %eax,%eax
+  802559:	7e 03                	jle    80255e <writebuf+0x28>
+  80255b:	01 43 08             	add    %eax,0x8(%ebx)
+  80255e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802561:	74 0d                	je     802570 <writebuf+0x3a>
+  802563:	85 c0                	test   %eax,%eax
+  802565:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256a:	0f 4f c2             	cmovg  %edx,%eax
+  80256d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802573:	c9                   	leave
+  802574:	c3                   	ret
+
+00802575 <putch>:
+  802575:	55                   	push   %ebp
+  802576:	89 e5                	mov    %esp,%ebp
+  802578:	53                   	push   %ebx
+  802579:	83 ec 04             	sub    $0x4,%esp
+  80257c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80257f:	8b 53 04             	mov    0x4(%ebx),%edx
+  802582:	8d 42 01             	lea    0x1(%edx),%eax
+  802585:	89 43 04             	mov    %eax,0x4(%ebx)
+  802588:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80258b:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  80258f:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802594:	74 05                	je     80259b <putch+0x26>
+  802596:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802599:	c9                   	leave
+  80259a:	c3                   	ret
+  80259b:	89 d8                	mov    %ebx,%eax
+  80259d:	e8 94 ff ff ff       	call   802536 <writebuf>
+  8025a2:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  8025a9:	eb eb                	jmp    802596 <putch+0x21>
+
+008025ab <vfprintf>:
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8025b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b7:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  8025bd:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8025c4:	00 00 00 
+  8025c7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025ce:	00 00 00 
+  8025d1:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8025d8:	00 00 00 
+  8025db:	ff 75 10             	push   0x10(%ebp)
+  8025de:	ff 75 0c             	push   0xc(%ebp)
+  8025e1:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8025e7:	50                   	push   %eax
+  8025e8:	68 75 25 80 00       	push   $0x802575
+  8025ed:	e8 26 df ff ff       	call   800518 <vprintfmt>
+  8025f2:	83 c4 10             	add    $0x10,%esp
+  8025f5:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8025fc:	7f 12                	jg     802610 <vfprintf+0x65>
+  8025fe:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802604:	85 c0                	test   %eax,%eax
+  802606:	75 06                	jne    80260e <vfprintf+0x63>
+  802608:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+  802610:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802616:	e8 1b ff ff ff       	call   802536 <writebuf>
+  80261b:	eb e1                	jmp    8025fe <vfprintf+0x53>
+
+0080261d <fprintf>:
+  80261d:	55                   	push   %ebp
+  80261e:	89 e5                	mov    %esp,%ebp
+  802620:	83 ec 0c             	sub    $0xc,%esp
+  802623:	8d 45 10             	lea    0x10(%ebp),%eax
+  802626:	50                   	push   %eax
+  802627:	ff 75 0c             	push   0xc(%ebp)
+  80262a:	ff 75 08             	push   0x8(%ebp)
+  80262d:	e8 79 ff ff ff       	call   8025ab <vfprintf>
+  802632:	c9                   	leave
+  802633:	c3                   	ret
+
+00802634 <printf>:
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	83 ec 0c             	sub    $0xc,%esp
+  80263a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80263d:	50                   	push   %eax
+  80263e:	ff 75 08             	push   0x8(%ebp)
+  802641:	6a 01                	push   $0x1
+  802643:	e8 63 ff ff ff       	call   8025ab <vfprintf>
+  802648:	c9                   	leave
+  802649:	c3                   	ret
+
+0080264a <devsock_stat>:
+  80264a:	55                   	push   %ebp
+  80264b:	89 e5                	mov    %esp,%ebp
+  80264d:	83 ec 10             	sub    $0x10,%esp
+  802650:	68 e8 3a 80 00       	push   $0x803ae8
+  802655:	ff 75 0c             	push   0xc(%ebp)
+  802658:	e8 b3 e4 ff ff       	call   800b10 <strcpy>
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+
+00802664 <devsock_close>:
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	53                   	push   %ebx
+  802668:	83 ec 10             	sub    $0x10,%esp
+  80266b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80266e:	53                   	push   %ebx
+  80266f:	e8 99 0d 00 00       	call   80340d <pageref>
+  802674:	89 c2                	mov    %eax,%edx
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267e:	83 fa 01             	cmp    $0x1,%edx
+  802681:	74 05                	je     802688 <devsock_close+0x24>
+  802683:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802686:	c9                   	leave
+  802687:	c3                   	ret
+  802688:	83 ec 0c             	sub    $0xc,%esp
+  80268b:	ff 73 0c             	push   0xc(%ebx)
+  80268e:	e8 aa 02 00 00       	call   80293d <nsipc_close>
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	eb eb                	jmp    802683 <devsock_close+0x1f>
+
+00802698 <devsock_write>:
+  802698:	55                   	push   %ebp
+  802699:	89 e5                	mov    %esp,%ebp
+  80269b:	83 ec 08             	sub    $0x8,%esp
+  80269e:	6a 00                	push   $0x0
+  8026a0:	ff 75 10             	push   0x10(%ebp)
+  8026a3:	ff 75 0c             	push   0xc(%ebp)
+  8026a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a9:	ff 70 0c             	push   0xc(%eax)
+  8026ac:	e8 6c 03 00 00       	call   802a1d <nsipc_send>
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+
+008026b3 <devsock_read>:
+  8026b3:	55                   	push   %ebp
+  8026b4:	89 e5                	mov    %esp,%ebp
+  8026b6:	83 ec 08             	sub    $0x8,%esp
+  8026b9:	6a 00                	push   $0x0
+  8026bb:	ff 75 10             	push   0x10(%ebp)
+  8026be:	ff 75 0c             	push   0xc(%ebp)
+  8026c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c4:	ff 70 0c             	push   0xc(%eax)
+  8026c7:	e8 e2 02 00 00       	call   8029ae <nsipc_recv>
+  8026cc:	c9                   	leave
+  8026cd:	c3                   	ret
+
+008026ce <fd2sockid>:
+  8026ce:	55                   	push   %ebp
+  8026cf:	89 e5                	mov    %esp,%ebp
+  8026d1:	83 ec 20             	sub    $0x20,%esp
+  8026d4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026d7:	52                   	push   %edx
+  8026d8:	50                   	push   %eax
+  8026d9:	e8 c6 f2 ff ff       	call   8019a4 <fd_lookup>
+  8026de:	83 c4 10             	add    $0x10,%esp
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	78 10                	js     8026f5 <fd2sockid+0x27>
+  8026e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026e8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8026ee:	39 08                	cmp    %ecx,(%eax)
+  8026f0:	75 05                	jne    8026f7 <fd2sockid+0x29>
+  8026f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026f5:	c9                   	leave
+  8026f6:	c3                   	ret
+  8026f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026fc:	eb f7                	jmp    8026f5 <fd2sockid+0x27>
+
+008026fe <alloc_sockfd>:
+  8026fe:	55                   	push   %ebp
+  8026ff:	89 e5                	mov    %esp,%ebp
+  802701:	56                   	push   %esi
+  802702:	53                   	push   %ebx
+  802703:	83 ec 1c             	sub    $0x1c,%esp
+  802706:	89 c6                	mov    %eax,%esi
+  802708:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80270b:	50                   	push   %eax
+  80270c:	e8 43 f2 ff ff       	call   801954 <fd_alloc>
+  802711:	89 c3                	mov    %eax,%ebx
+  802713:	83 c4 10             	add    $0x10,%esp
+  802716:	85 c0                	test   %eax,%eax
+  802718:	78 43                	js     80275d <alloc_sockfd+0x5f>
+  80271a:	83 ec 04             	sub    $0x4,%esp
+  80271d:	68 07 04 00 00       	push   $0x407
+  802722:	ff 75 f4             	push   -0xc(%ebp)
+  802725:	6a 00                	push   $0x0
+  802727:	e8 44 e8 ff ff       	call   800f70 <sys_page_alloc>
+  80272c:	89 c3                	mov    %eax,%ebx
+  80272e:	83 c4 10             	add    $0x10,%esp
+  802731:	85 c0                	test   %eax,%eax
+  802733:	78 28                	js     80275d <alloc_sockfd+0x5f>
+  802735:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802738:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80273e:	89 10                	mov    %edx,(%eax)
+  802740:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802743:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80274a:	89 70 0c             	mov    %esi,0xc(%eax)
+  80274d:	83 ec 0c             	sub    $0xc,%esp
+  802750:	50                   	push   %eax
+  802751:	e8 d7 f1 ff ff       	call   80192d <fd2num>
+  802756:	89 c3                	mov    %eax,%ebx
+  802758:	83 c4 10             	add    $0x10,%esp
+  80275b:	eb 0c                	jmp    802769 <alloc_sockfd+0x6b>
+  80275d:	83 ec 0c             	sub    $0xc,%esp
+  802760:	56                   	push   %esi
+  802761:	e8 d7 01 00 00       	call   80293d <nsipc_close>
+  802766:	83 c4 10             	add    $0x10,%esp
+  802769:	89 d8                	mov    %ebx,%eax
+  80276b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80276e:	5b                   	pop    %ebx
+  80276f:	5e                   	pop    %esi
+  802770:	5d                   	pop    %ebp
+  802771:	c3                   	ret
+
+00802772 <accept>:
+  802772:	55                   	push   %ebp
+  802773:	89 e5                	mov    %esp,%ebp
+  802775:	83 ec 08             	sub    $0x8,%esp
+  802778:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277b:	e8 4e ff ff ff       	call   8026ce <fd2sockid>
+  802780:	85 c0                	test   %eax,%eax
+  802782:	78 1b                	js     80279f <accept+0x2d>
+  802784:	83 ec 04             	sub    $0x4,%esp
+  802787:	ff 75 10             	push   0x10(%ebp)
+  80278a:	ff 75 0c             	push   0xc(%ebp)
+  80278d:	50                   	push   %eax
+  80278e:	e8 07 01 00 00       	call   80289a <nsipc_accept>
+  802793:	83 c4 10             	add    $0x10,%esp
+  802796:	85 c0                	test   %eax,%eax
+  802798:	78 05                	js     80279f <accept+0x2d>
+  80279a:	e8 5f ff ff ff       	call   8026fe <alloc_sockfd>
+  80279f:	c9                   	leave
+  8027a0:	c3                   	ret
+
+008027a1 <bind>:
+  8027a1:	55                   	push   %ebp
+  8027a2:	89 e5                	mov    %esp,%ebp
+  8027a4:	83 ec 08             	sub    $0x8,%esp
+  8027a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027aa:	e8 1f ff ff ff       	call   8026ce <fd2sockid>
+  8027af:	85 c0                	test   %eax,%eax
+  8027b1:	78 12                	js     8027c5 <bind+0x24>
+  8027b3:	83 ec 04             	sub    $0x4,%esp
+  8027b6:	ff 75 10             	push   0x10(%ebp)
+  8027b9:	ff 75 0c             	push   0xc(%ebp)
+  8027bc:	50                   	push   %eax
+  8027bd:	e8 24 01 00 00       	call   8028e6 <nsipc_bind>
+  8027c2:	83 c4 10             	add    $0x10,%esp
+  8027c5:	c9                   	leave
+  8027c6:	c3                   	ret
+
+008027c7 <shutdown>:
+  8027c7:	55                   	push   %ebp
+  8027c8:	89 e5                	mov    %esp,%ebp
+  8027ca:	83 ec 08             	sub    $0x8,%esp
+  8027cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d0:	e8 f9 fe ff ff       	call   8026ce <fd2sockid>
+  8027d5:	85 c0                	test   %eax,%eax
+  8027d7:	78 0f                	js     8027e8 <shutdown+0x21>
+  8027d9:	83 ec 08             	sub    $0x8,%esp
+  8027dc:	ff 75 0c             	push   0xc(%ebp)
+  8027df:	50                   	push   %eax
+  8027e0:	e8 36 01 00 00       	call   80291b <nsipc_shutdown>
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	c9                   	leave
+  8027e9:	c3                   	ret
+
+008027ea <connect>:
+  8027ea:	55                   	push   %ebp
+  8027eb:	89 e5                	mov    %esp,%ebp
+  8027ed:	83 ec 08             	sub    $0x8,%esp
+  8027f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f3:	e8 d6 fe ff ff       	call   8026ce <fd2sockid>
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	78 12                	js     80280e <connect+0x24>
+  8027fc:	83 ec 04             	sub    $0x4,%esp
+  8027ff:	ff 75 10             	push   0x10(%ebp)
+  802802:	ff 75 0c             	push   0xc(%ebp)
+  802805:	50                   	push   %eax
+  802806:	e8 4c 01 00 00       	call   802957 <nsipc_connect>
+  80280b:	83 c4 10             	add    $0x10,%esp
+  80280e:	c9                   	leave
+  80280f:	c3                   	ret
+
+00802810 <listen>:
+  802810:	55                   	push   %ebp
+  802811:	89 e5                	mov    %esp,%ebp
+  802813:	83 ec 08             	sub    $0x8,%esp
+  802816:	8b 45 08             	mov    0x8(%ebp),%eax
+  802819:	e8 b0 fe ff ff       	call   8026ce <fd2sockid>
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	78 0f                	js     802831 <listen+0x21>
+  802822:	83 ec 08             	sub    $0x8,%esp
+  802825:	ff 75 0c             	push   0xc(%ebp)
+  802828:	50                   	push   %eax
+  802829:	e8 5e 01 00 00       	call   80298c <nsipc_listen>
+  80282e:	83 c4 10             	add    $0x10,%esp
+  802831:	c9                   	leave
+  802832:	c3                   	ret
+
+00802833 <socket>:
+  802833:	55                   	push   %ebp
+  802834:	89 e5                	mov    %esp,%ebp
+  802836:	83 ec 0c             	sub    $0xc,%esp
+  802839:	ff 75 10             	push   0x10(%ebp)
+  80283c:	ff 75 0c             	push   0xc(%ebp)
+  80283f:	ff 75 08             	push   0x8(%ebp)
+  802842:	e8 34 02 00 00       	call   802a7b <nsipc_socket>
+  802847:	83 c4 10             	add    $0x10,%esp
+  80284a:	85 c0                	test   %eax,%eax
+  80284c:	78 05                	js     802853 <socket+0x20>
+  80284e:	e8 ab fe ff ff       	call   8026fe <alloc_sockfd>
+  802853:	c9                   	leave
+  802854:	c3                   	ret
+
+00802855 <nsipc>:
+  802855:	55                   	push   %ebp
+  802856:	89 e5                	mov    %esp,%ebp
+  802858:	53                   	push   %ebx
+  802859:	83 ec 04             	sub    $0x4,%esp
+  80285c:	89 c3                	mov    %eax,%ebx
+  80285e:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802865:	74 1f                	je     802886 <nsipc+0x31>
+  802867:	83 ec 08             	sub    $0x8,%esp
+  80286a:	6a 00                	push   $0x0
+  80286c:	6a 00                	push   $0x0
+  80286e:	6a 07                	push   $0x7
+  802870:	68 00 70 80 00       	push   $0x807000
+  802875:	53                   	push   %ebx
+  802876:	ff 35 0c 50 80 00    	push   0x80500c
+  80287c:	e8 d7 09 00 00       	call   803258 <ipc_call>
+  802881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802884:	c9                   	leave
+  802885:	c3                   	ret
+  802886:	83 ec 0c             	sub    $0xc,%esp
+  802889:	6a 03                	push   $0x3
+  80288b:	e8 63 0b 00 00       	call   8033f3 <ipc_find_env>
+  802890:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802895:	83 c4 10             	add    $0x10,%esp
+  802898:	eb cd                	jmp    802867 <nsipc+0x12>
+
+0080289a <nsipc_accept>:
+  80289a:	55                   	push   %ebp
+  80289b:	89 e5                	mov    %esp,%ebp
+  80289d:	53                   	push   %ebx
+  80289e:	83 ec 04             	sub    $0x4,%esp
+  8028a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a4:	a3 00 70 80 00       	mov    %eax,0x807000
+  8028a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028ae:	e8 a2 ff ff ff       	call   802855 <nsipc>
+  8028b3:	89 c3                	mov    %eax,%ebx
+  8028b5:	85 c0                	test   %eax,%eax
+  8028b7:	79 07                	jns    8028c0 <nsipc_accept+0x26>
+  8028b9:	89 d8                	mov    %ebx,%eax
+  8028bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028be:	c9                   	leave
+  8028bf:	c3                   	ret
+  8028c0:	83 ec 04             	sub    $0x4,%esp
+  8028c3:	ff 35 10 70 80 00    	push   0x807010
+  8028c9:	68 00 70 80 00       	push   $0x807000
+  8028ce:	ff 75 0c             	push   0xc(%ebp)
+  8028d1:	e8 ea e3 ff ff       	call   800cc0 <memmove>
+  8028d6:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8028dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028df:	89 10                	mov    %edx,(%eax)
+  8028e1:	83 c4 10             	add    $0x10,%esp
+  8028e4:	eb d3                	jmp    8028b9 <nsipc_accept+0x1f>
+
+008028e6 <nsipc_bind>:
+  8028e6:	55                   	push   %ebp
+  8028e7:	89 e5                	mov    %esp,%ebp
+  8028e9:	53                   	push   %ebx
+  8028ea:	83 ec 08             	sub    $0x8,%esp
+  8028ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f3:	a3 00 70 80 00       	mov    %eax,0x807000
+  8028f8:	53                   	push   %ebx
+  8028f9:	ff 75 0c             	push   0xc(%ebp)
+  8028fc:	68 04 70 80 00       	push   $0x807004
+  802901:	e8 ba e3 ff ff       	call   800cc0 <memmove>
+  802906:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80290c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802911:	e8 3f ff ff ff       	call   802855 <nsipc>
+  802916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802919:	c9                   	leave
+  80291a:	c3                   	ret
+
+0080291b <nsipc_shutdown>:
+  80291b:	55                   	push   %ebp
+  80291c:	89 e5                	mov    %esp,%ebp
+  80291e:	83 ec 08             	sub    $0x8,%esp
+  802921:	8b 45 08             	mov    0x8(%ebp),%eax
+  802924:	a3 00 70 80 00       	mov    %eax,0x807000
+  802929:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80292c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802931:	b8 03 00 00 00       	mov    $0x3,%eax
+  802936:	e8 1a ff ff ff       	call   802855 <nsipc>
+  80293b:	c9                   	leave
+  80293c:	c3                   	ret
+
+0080293d <nsipc_close>:
+  80293d:	55                   	push   %ebp
+  80293e:	89 e5                	mov    %esp,%ebp
+  802940:	83 ec 08             	sub    $0x8,%esp
+  802943:	8b 45 08             	mov    0x8(%ebp),%eax
+  802946:	a3 00 70 80 00       	mov    %eax,0x807000
+  80294b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802950:	e8 00 ff ff ff       	call   802855 <nsipc>
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+
+00802957 <nsipc_connect>:
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	53                   	push   %ebx
+  80295b:	83 ec 08             	sub    $0x8,%esp
+  80295e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802961:	8b 45 08             	mov    0x8(%ebp),%eax
+  802964:	a3 00 70 80 00       	mov    %eax,0x807000
+  802969:	53                   	push   %ebx
+  80296a:	ff 75 0c             	push   0xc(%ebp)
+  80296d:	68 04 70 80 00       	push   $0x807004
+  802972:	e8 49 e3 ff ff       	call   800cc0 <memmove>
+  802977:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  80297d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802982:	e8 ce fe ff ff       	call   802855 <nsipc>
+  802987:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <nsipc_listen>:
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	83 ec 08             	sub    $0x8,%esp
+  802992:	8b 45 08             	mov    0x8(%ebp),%eax
+  802995:	a3 00 70 80 00       	mov    %eax,0x807000
+  80299a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80299d:	a3 04 70 80 00       	mov    %eax,0x807004
+  8029a2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8029a7:	e8 a9 fe ff ff       	call   802855 <nsipc>
+  8029ac:	c9                   	leave
+  8029ad:	c3                   	ret
+
+008029ae <nsipc_recv>:
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	56                   	push   %esi
+  8029b2:	53                   	push   %ebx
+  8029b3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8029b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029be:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8029c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029c7:	a3 08 70 80 00       	mov    %eax,0x807008
+  8029cc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029d1:	e8 7f fe ff ff       	call   802855 <nsipc>
+  8029d6:	89 c3                	mov    %eax,%ebx
+  8029d8:	85 c0                	test   %eax,%eax
+  8029da:	78 22                	js     8029fe <nsipc_recv+0x50>
+  8029dc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8029e1:	39 c6                	cmp    %eax,%esi
+  8029e3:	0f 4e c6             	cmovle %esi,%eax
+  8029e6:	39 c3                	cmp    %eax,%ebx
+  8029e8:	7f 1d                	jg     802a07 <nsipc_recv+0x59>
+  8029ea:	83 ec 04             	sub    $0x4,%esp
+  8029ed:	53                   	push   %ebx
+  8029ee:	68 00 70 80 00       	push   $0x807000
+  8029f3:	ff 75 0c             	push   0xc(%ebp)
+  8029f6:	e8 c5 e2 ff ff       	call   800cc0 <memmove>
+  8029fb:	83 c4 10             	add    $0x10,%esp
+  8029fe:	89 d8                	mov    %ebx,%eax
+  802a00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a03:	5b                   	pop    %ebx
+  802a04:	5e                   	pop    %esi
+  802a05:	5d                   	pop    %ebp
+  802a06:	c3                   	ret
+  802a07:	68 f4 3a 80 00       	push   $0x803af4
+  802a0c:	68 09 3b 80 00       	push   $0x803b09
+  802a11:	6a 60                	push   $0x60
+  802a13:	68 1e 3b 80 00       	push   $0x803b1e
+  802a18:	e8 21 d9 ff ff       	call   80033e <_panic>
+
+00802a1d <nsipc_send>:
+  802a1d:	55                   	push   %ebp
+  802a1e:	89 e5                	mov    %esp,%ebp
+  802a20:	53                   	push   %ebx
+  802a21:	83 ec 04             	sub    $0x4,%esp
+  802a24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2a:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a2f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a35:	7f 2e                	jg     802a65 <nsipc_send+0x48>
+  802a37:	83 ec 04             	sub    $0x4,%esp
+  802a3a:	53                   	push   %ebx
+  802a3b:	ff 75 0c             	push   0xc(%ebp)
+  802a3e:	68 0c 70 80 00       	push   $0x80700c
+  802a43:	e8 78 e2 ff ff       	call   800cc0 <memmove>
+  802a48:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802a4e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a51:	a3 08 70 80 00       	mov    %eax,0x807008
+  802a56:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a5b:	e8 f5 fd ff ff       	call   802855 <nsipc>
+  802a60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a63:	c9                   	leave
+  802a64:	c3                   	ret
+  802a65:	68 2a 3b 80 00       	push   $0x803b2a
+  802a6a:	68 09 3b 80 00       	push   $0x803b09
+  802a6f:	6a 6b                	push   $0x6b
+  802a71:	68 1e 3b 80 00       	push   $0x803b1e
+  802a76:	e8 c3 d8 ff ff       	call   80033e <_panic>
+
+00802a7b <nsipc_socket>:
+  802a7b:	55                   	push   %ebp
+  802a7c:	89 e5                	mov    %esp,%ebp
+  802a7e:	83 ec 08             	sub    $0x8,%esp
+  802a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a84:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a89:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a8c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802a91:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a94:	a3 08 70 80 00       	mov    %eax,0x807008
+  802a99:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a9e:	e8 b2 fd ff ff       	call   802855 <nsipc>
+  802aa3:	c9                   	leave
+  802aa4:	c3                   	ret
+
+00802aa5 <devpipe_stat>:
+  802aa5:	55                   	push   %ebp
+  802aa6:	89 e5                	mov    %esp,%ebp
+  802aa8:	56                   	push   %esi
+  802aa9:	53                   	push   %ebx
+  802aaa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802aad:	83 ec 0c             	sub    $0xc,%esp
+  802ab0:	ff 75 08             	push   0x8(%ebp)
+  802ab3:	e8 85 ee ff ff       	call   80193d <fd2data>
+  802ab8:	89 c6                	mov    %eax,%esi
+  802aba:	83 c4 08             	add    $0x8,%esp
+  802abd:	68 36 3b 80 00       	push   $0x803b36
+  802ac2:	53                   	push   %ebx
+  802ac3:	e8 48 e0 ff ff       	call   800b10 <strcpy>
+  802ac8:	8b 46 04             	mov    0x4(%esi),%eax
+  802acb:	2b 06                	sub    (%esi),%eax
+  802acd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802ad3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ada:	00 00 00 
+  802add:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802ae4:	40 80 00 
+  802ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aef:	5b                   	pop    %ebx
+  802af0:	5e                   	pop    %esi
+  802af1:	5d                   	pop    %ebp
+  802af2:	c3                   	ret
+
+00802af3 <devpipe_close>:
+  802af3:	55                   	push   %ebp
+  802af4:	89 e5                	mov    %esp,%ebp
+  802af6:	53                   	push   %ebx
+  802af7:	83 ec 0c             	sub    $0xc,%esp
+  802afa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802afd:	53                   	push   %ebx
+  802afe:	6a 00                	push   $0x0
+  802b00:	e8 3d e5 ff ff       	call   801042 <sys_page_unmap>
+  802b05:	89 1c 24             	mov    %ebx,(%esp)
+  802b08:	e8 30 ee ff ff       	call   80193d <fd2data>
+  802b0d:	83 c4 08             	add    $0x8,%esp
+  802b10:	50                   	push   %eax
+  802b11:	6a 00                	push   $0x0
+  802b13:	e8 2a e5 ff ff       	call   801042 <sys_page_unmap>
+  802b18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <_pipeisclosed>:
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	57                   	push   %edi
+  802b21:	56                   	push   %esi
+  802b22:	53                   	push   %ebx
+  802b23:	83 ec 1c             	sub    $0x1c,%esp
+  802b26:	89 c7                	mov    %eax,%edi
+  802b28:	89 d6                	mov    %edx,%esi
+  802b2a:	a1 20 54 80 00       	mov    0x805420,%eax
+  802b2f:	8b 58 58             	mov    0x58(%eax),%ebx
+  802b32:	83 ec 0c             	sub    $0xc,%esp
+  802b35:	57                   	push   %edi
+  802b36:	e8 d2 08 00 00       	call   80340d <pageref>
+  802b3b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b3e:	89 34 24             	mov    %esi,(%esp)
+  802b41:	e8 c7 08 00 00       	call   80340d <pageref>
+  802b46:	8b 15 20 54 80 00    	mov    0x805420,%edx
+  802b4c:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  802b52:	39 cb                	cmp    %ecx,%ebx
+  802b54:	74 1b                	je     802b71 <_pipeisclosed+0x54>
+  802b56:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b59:	75 cf                	jne    802b2a <_pipeisclosed+0xd>
+  802b5b:	8b 42 58             	mov    0x58(%edx),%eax
+  802b5e:	6a 01                	push   $0x1
+  802b60:	50                   	push   %eax
+  802b61:	53                   	push   %ebx
+  802b62:	68 3d 3b 80 00       	push   $0x803b3d
+  802b67:	e8 ad d8 ff ff       	call   800419 <cprintf>
+  802b6c:	83 c4 10             	add    $0x10,%esp
+  802b6f:	eb b9                	jmp    802b2a <_pipeisclosed+0xd>
+  802b71:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b74:	0f 94 c0             	sete   %al
+  802b77:	0f b6 c0             	movzbl %al,%eax
+  802b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7d:	5b                   	pop    %ebx
+  802b7e:	5e                   	pop    %esi
+  802b7f:	5f                   	pop    %edi
+  802b80:	5d                   	pop    %ebp
+  802b81:	c3                   	ret
+
+00802b82 <devpipe_write>:
+  802b82:	55                   	push   %ebp
+  802b83:	89 e5                	mov    %esp,%ebp
+  802b85:	57                   	push   %edi
+  802b86:	56                   	push   %esi
+  802b87:	53                   	push   %ebx
+  802b88:	83 ec 28             	sub    $0x28,%esp
+  802b8b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b8e:	56                   	push   %esi
+  802b8f:	e8 a9 ed ff ff       	call   80193d <fd2data>
+  802b94:	89 c3                	mov    %eax,%ebx
+  802b96:	83 c4 10             	add    $0x10,%esp
+  802b99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ba2:	74 5c                	je     802c00 <devpipe_write+0x7e>
+  802ba4:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ba7:	8b 0b                	mov    (%ebx),%ecx
+  802ba9:	8d 51 20             	lea    0x20(%ecx),%edx
+  802bac:	39 d0                	cmp    %edx,%eax
+  802bae:	72 1e                	jb     802bce <devpipe_write+0x4c>
+  802bb0:	89 da                	mov    %ebx,%edx
+  802bb2:	89 f0                	mov    %esi,%eax
+  802bb4:	e8 64 ff ff ff       	call   802b1d <_pipeisclosed>
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	75 48                	jne    802c05 <devpipe_write+0x83>
+  802bbd:	e8 63 e3 ff ff       	call   800f25 <sys_yield>
+  802bc2:	8b 43 04             	mov    0x4(%ebx),%eax
+  802bc5:	8b 0b                	mov    (%ebx),%ecx
+  802bc7:	8d 51 20             	lea    0x20(%ecx),%edx
+  802bca:	39 d0                	cmp    %edx,%eax
+  802bcc:	73 e2                	jae    802bb0 <devpipe_write+0x2e>
+  802bce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bd1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802bd5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802bd8:	89 c2                	mov    %eax,%edx
+  802bda:	c1 fa 1f             	sar    $0x1f,%edx
+  802bdd:	89 d1                	mov    %edx,%ecx
+  802bdf:	c1 e9 1b             	shr    $0x1b,%ecx
+  802be2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802be5:	83 e2 1f             	and    $0x1f,%edx
+  802be8:	29 ca                	sub    %ecx,%edx
+  802bea:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802bee:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802bf2:	83 c0 01             	add    $0x1,%eax
+  802bf5:	89 43 04             	mov    %eax,0x4(%ebx)
+  802bf8:	83 c7 01             	add    $0x1,%edi
+  802bfb:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802bfe:	75 a4                	jne    802ba4 <devpipe_write+0x22>
+  802c00:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c03:	eb 05                	jmp    802c0a <devpipe_write+0x88>
+  802c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c0d:	5b                   	pop    %ebx
+  802c0e:	5e                   	pop    %esi
+  802c0f:	5f                   	pop    %edi
+  802c10:	5d                   	pop    %ebp
+  802c11:	c3                   	ret
+
+00802c12 <devpipe_read>:
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	57                   	push   %edi
+  802c16:	56                   	push   %esi
+  802c17:	53                   	push   %ebx
+  802c18:	83 ec 18             	sub    $0x18,%esp
+  802c1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c1e:	56                   	push   %esi
+  802c1f:	e8 19 ed ff ff       	call   80193d <fd2data>
+  802c24:	89 c3                	mov    %eax,%ebx
+  802c26:	83 c4 10             	add    $0x10,%esp
+  802c29:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c32:	74 45                	je     802c79 <devpipe_read+0x67>
+  802c34:	8b 03                	mov    (%ebx),%eax
+  802c36:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c39:	75 1d                	jne    802c58 <devpipe_read+0x46>
+  802c3b:	85 ff                	test   %edi,%edi
+  802c3d:	75 3f                	jne    802c7e <devpipe_read+0x6c>
+  802c3f:	89 da                	mov    %ebx,%edx
+  802c41:	89 f0                	mov    %esi,%eax
+  802c43:	e8 d5 fe ff ff       	call   802b1d <_pipeisclosed>
+  802c48:	85 c0                	test   %eax,%eax
+  802c4a:	75 3c                	jne    802c88 <devpipe_read+0x76>
+  802c4c:	e8 d4 e2 ff ff       	call   800f25 <sys_yield>
+  802c51:	8b 03                	mov    (%ebx),%eax
+  802c53:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c56:	74 e7                	je     802c3f <devpipe_read+0x2d>
+  802c58:	99                   	cltd
+  802c59:	c1 ea 1b             	shr    $0x1b,%edx
+  802c5c:	01 d0                	add    %edx,%eax
+  802c5e:	83 e0 1f             	and    $0x1f,%eax
+  802c61:	29 d0                	sub    %edx,%eax
+  802c63:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c6b:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802c6e:	83 03 01             	addl   $0x1,(%ebx)
+  802c71:	83 c7 01             	add    $0x1,%edi
+  802c74:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802c77:	75 bb                	jne    802c34 <devpipe_read+0x22>
+  802c79:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c7c:	eb 02                	jmp    802c80 <devpipe_read+0x6e>
+  802c7e:	89 f8                	mov    %edi,%eax
+  802c80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c83:	5b                   	pop    %ebx
+  802c84:	5e                   	pop    %esi
+  802c85:	5f                   	pop    %edi
+  802c86:	5d                   	pop    %ebp
+  802c87:	c3                   	ret
+  802c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8d:	eb f1                	jmp    802c80 <devpipe_read+0x6e>
+
+00802c8f <pipe>:
+  802c8f:	55                   	push   %ebp
+  802c90:	89 e5                	mov    %esp,%ebp
+  802c92:	56                   	push   %esi
+  802c93:	53                   	push   %ebx
+  802c94:	83 ec 1c             	sub    $0x1c,%esp
+  802c97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c9a:	50                   	push   %eax
+  802c9b:	e8 b4 ec ff ff       	call   801954 <fd_alloc>
+  802ca0:	89 c3                	mov    %eax,%ebx
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	0f 88 23 01 00 00    	js     802dd0 <pipe+0x141>
+  802cad:	83 ec 04             	sub    $0x4,%esp
+  802cb0:	68 07 04 00 00       	push   $0x407
+  802cb5:	ff 75 f4             	push   -0xc(%ebp)
+  802cb8:	6a 00                	push   $0x0
+  802cba:	e8 b1 e2 ff ff       	call   800f70 <sys_page_alloc>
+  802cbf:	89 c3                	mov    %eax,%ebx
+  802cc1:	83 c4 10             	add    $0x10,%esp
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	0f 88 04 01 00 00    	js     802dd0 <pipe+0x141>
+  802ccc:	83 ec 0c             	sub    $0xc,%esp
+  802ccf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802cd2:	50                   	push   %eax
+  802cd3:	e8 7c ec ff ff       	call   801954 <fd_alloc>
+  802cd8:	89 c3                	mov    %eax,%ebx
+  802cda:	83 c4 10             	add    $0x10,%esp
+  802cdd:	85 c0                	test   %eax,%eax
+  802cdf:	0f 88 db 00 00 00    	js     802dc0 <pipe+0x131>
+  802ce5:	83 ec 04             	sub    $0x4,%esp
+  802ce8:	68 07 04 00 00       	push   $0x407
+  802ced:	ff 75 f0             	push   -0x10(%ebp)
+  802cf0:	6a 00                	push   $0x0
+  802cf2:	e8 79 e2 ff ff       	call   800f70 <sys_page_alloc>
+  802cf7:	89 c3                	mov    %eax,%ebx
+  802cf9:	83 c4 10             	add    $0x10,%esp
+  802cfc:	85 c0                	test   %eax,%eax
+  802cfe:	0f 88 bc 00 00 00    	js     802dc0 <pipe+0x131>
+  802d04:	83 ec 0c             	sub    $0xc,%esp
+  802d07:	ff 75 f4             	push   -0xc(%ebp)
+  802d0a:	e8 2e ec ff ff       	call   80193d <fd2data>
+  802d0f:	89 c6                	mov    %eax,%esi
+  802d11:	83 c4 0c             	add    $0xc,%esp
+  802d14:	68 07 04 00 00       	push   $0x407
+  802d19:	50                   	push   %eax
+  802d1a:	6a 00                	push   $0x0
+  802d1c:	e8 4f e2 ff ff       	call   800f70 <sys_page_alloc>
+  802d21:	89 c3                	mov    %eax,%ebx
+  802d23:	83 c4 10             	add    $0x10,%esp
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	0f 88 82 00 00 00    	js     802db0 <pipe+0x121>
+  802d2e:	83 ec 0c             	sub    $0xc,%esp
+  802d31:	ff 75 f0             	push   -0x10(%ebp)
+  802d34:	e8 04 ec ff ff       	call   80193d <fd2data>
+  802d39:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d40:	50                   	push   %eax
+  802d41:	6a 00                	push   $0x0
+  802d43:	56                   	push   %esi
+  802d44:	6a 00                	push   $0x0
+  802d46:	e8 68 e2 ff ff       	call   800fb3 <sys_page_map>
+  802d4b:	89 c3                	mov    %eax,%ebx
+  802d4d:	83 c4 20             	add    $0x20,%esp
+  802d50:	85 c0                	test   %eax,%eax
+  802d52:	78 4e                	js     802da2 <pipe+0x113>
+  802d54:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802d59:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d5c:	89 02                	mov    %eax,(%edx)
+  802d5e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d61:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802d68:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802d6b:	89 02                	mov    %eax,(%edx)
+  802d6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802d70:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802d77:	83 ec 0c             	sub    $0xc,%esp
+  802d7a:	ff 75 f4             	push   -0xc(%ebp)
+  802d7d:	e8 ab eb ff ff       	call   80192d <fd2num>
+  802d82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d85:	89 01                	mov    %eax,(%ecx)
+  802d87:	83 c4 04             	add    $0x4,%esp
+  802d8a:	ff 75 f0             	push   -0x10(%ebp)
+  802d8d:	e8 9b eb ff ff       	call   80192d <fd2num>
+  802d92:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d95:	89 41 04             	mov    %eax,0x4(%ecx)
+  802d98:	83 c4 10             	add    $0x10,%esp
+  802d9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da0:	eb 2e                	jmp    802dd0 <pipe+0x141>
+  802da2:	83 ec 08             	sub    $0x8,%esp
+  802da5:	56                   	push   %esi
+  802da6:	6a 00                	push   $0x0
+  802da8:	e8 95 e2 ff ff       	call   801042 <sys_page_unmap>
+  802dad:	83 c4 10             	add    $0x10,%esp
+  802db0:	83 ec 08             	sub    $0x8,%esp
+  802db3:	ff 75 f0             	push   -0x10(%ebp)
+  802db6:	6a 00                	push   $0x0
+  802db8:	e8 85 e2 ff ff       	call   801042 <sys_page_unmap>
+  802dbd:	83 c4 10             	add    $0x10,%esp
+  802dc0:	83 ec 08             	sub    $0x8,%esp
+  802dc3:	ff 75 f4             	push   -0xc(%ebp)
+  802dc6:	6a 00                	push   $0x0
+  802dc8:	e8 75 e2 ff ff       	call   801042 <sys_page_unmap>
+  802dcd:	83 c4 10             	add    $0x10,%esp
+  802dd0:	89 d8                	mov    %ebx,%eax
+  802dd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dd5:	5b                   	pop    %ebx
+  802dd6:	5e                   	pop    %esi
+  802dd7:	5d                   	pop    %ebp
+  802dd8:	c3                   	ret
+
+00802dd9 <pipeisclosed>:
+  802dd9:	55                   	push   %ebp
+  802dda:	89 e5                	mov    %esp,%ebp
+  802ddc:	83 ec 20             	sub    $0x20,%esp
+  802ddf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802de2:	50                   	push   %eax
+  802de3:	ff 75 08             	push   0x8(%ebp)
+  802de6:	e8 b9 eb ff ff       	call   8019a4 <fd_lookup>
+  802deb:	83 c4 10             	add    $0x10,%esp
+  802dee:	85 c0                	test   %eax,%eax
+  802df0:	78 18                	js     802e0a <pipeisclosed+0x31>
+  802df2:	83 ec 0c             	sub    $0xc,%esp
+  802df5:	ff 75 f4             	push   -0xc(%ebp)
+  802df8:	e8 40 eb ff ff       	call   80193d <fd2data>
+  802dfd:	89 c2                	mov    %eax,%edx
+  802dff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e02:	e8 16 fd ff ff       	call   802b1d <_pipeisclosed>
+  802e07:	83 c4 10             	add    $0x10,%esp
+  802e0a:	c9                   	leave
+  802e0b:	c3                   	ret
+
+00802e0c <ipcring_init>:
+  802e0c:	55                   	push   %ebp
+  802e0d:	89 e5                	mov    %esp,%ebp
+  802e0f:	53                   	push   %ebx
+  802e10:	83 ec 08             	sub    $0x8,%esp
+  802e13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802e16:	6a 60                	push   $0x60
+  802e18:	6a 00                	push   $0x0
+  802e1a:	53                   	push   %ebx
+  802e1b:	e8 6b de ff ff       	call   800c8b <memset>
+  802e20:	a1 20 54 80 00       	mov    0x805420,%eax
+  802e25:	8b 40 48             	mov    0x48(%eax),%eax
+  802e28:	89 03                	mov    %eax,(%ebx)
+  802e2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e2d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802e30:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e33:	89 43 08             	mov    %eax,0x8(%ebx)
+  802e36:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e39:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e42:	c9                   	leave
+  802e43:	c3                   	ret
+
+00802e44 <ipcring_req_slot>:
+  802e44:	55                   	push   %ebp
+  802e45:	89 e5                	mov    %esp,%ebp
+  802e47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e4a:	8b 50 10             	mov    0x10(%eax),%edx
+  802e4d:	8b 48 18             	mov    0x18(%eax),%ecx
+  802e50:	29 ca                	sub    %ecx,%edx
+  802e52:	83 fa 07             	cmp    $0x7,%edx
+  802e55:	77 0c                	ja     802e63 <ipcring_req_slot+0x1f>
+  802e57:	8b 50 10             	mov    0x10(%eax),%edx
+  802e5a:	83 e2 07             	and    $0x7,%edx
+  802e5d:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802e61:	5d                   	pop    %ebp
+  802e62:	c3                   	ret
+  802e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e68:	eb f7                	jmp    802e61 <ipcring_req_slot+0x1d>
+
+00802e6a <ipcring_req_push>:
+  802e6a:	55                   	push   %ebp
+  802e6b:	89 e5                	mov    %esp,%ebp
+  802e6d:	83 ec 08             	sub    $0x8,%esp
+  802e70:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e73:	8b 42 10             	mov    0x10(%edx),%eax
+  802e76:	83 c0 01             	add    $0x1,%eax
+  802e79:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e82:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802e86:	85 c0                	test   %eax,%eax
+  802e88:	75 02                	jne    802e8c <ipcring_req_push+0x22>
+  802e8a:	c9                   	leave
+  802e8b:	c3                   	ret
+  802e8c:	6a 00                	push   $0x0
+  802e8e:	68 00 00 80 ee       	push   $0xee800000
+  802e93:	ff 72 08             	push   0x8(%edx)
+  802e96:	ff 72 04             	push   0x4(%edx)
+  802e99:	e8 0a e4 ff ff       	call   8012a8 <sys_ipc_send>
+  802e9e:	83 c4 10             	add    $0x10,%esp
+  802ea1:	eb e7                	jmp    802e8a <ipcring_req_push+0x20>
+
+00802ea3 <ipcring_rsp_wait>:
+  802ea3:	55                   	push   %ebp
+  802ea4:	89 e5                	mov    %esp,%ebp
+  802ea6:	53                   	push   %ebx
+  802ea7:	83 ec 04             	sub    $0x4,%esp
+  802eaa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ead:	8b 53 18             	mov    0x18(%ebx),%edx
+  802eb0:	8b 43 10             	mov    0x10(%ebx),%eax
+  802eb3:	39 c2                	cmp    %eax,%edx
+  802eb5:	74 3c                	je     802ef3 <ipcring_rsp_wait+0x50>
+  802eb7:	8b 53 14             	mov    0x14(%ebx),%edx
+  802eba:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ebd:	39 c2                	cmp    %eax,%edx
+  802ebf:	75 23                	jne    802ee4 <ipcring_rsp_wait+0x41>
+  802ec1:	83 ec 08             	sub    $0x8,%esp
+  802ec4:	6a 00                	push   $0x0
+  802ec6:	6a 00                	push   $0x0
+  802ec8:	6a 00                	push   $0x0
+  802eca:	6a 00                	push   $0x0
+  802ecc:	ff 73 0c             	push   0xc(%ebx)
+  802ecf:	ff 73 04             	push   0x4(%ebx)
+  802ed2:	e8 81 03 00 00       	call   803258 <ipc_call>
+  802ed7:	8b 53 14             	mov    0x14(%ebx),%edx
+  802eda:	8b 43 18             	mov    0x18(%ebx),%eax
+  802edd:	83 c4 20             	add    $0x20,%esp
+  802ee0:	39 c2                	cmp    %eax,%edx
+  802ee2:	74 dd                	je     802ec1 <ipcring_rsp_wait+0x1e>
+  802ee4:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ee7:	83 e0 07             	and    $0x7,%eax
+  802eea:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802eee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ef1:	c9                   	leave
+  802ef2:	c3                   	ret
+  802ef3:	68 58 3b 80 00       	push   $0x803b58
+  802ef8:	68 09 3b 80 00       	push   $0x803b09
+  802efd:	6a 3b                	push   $0x3b
+  802eff:	68 79 3b 80 00       	push   $0x803b79
+  802f04:	e8 35 d4 ff ff       	call   80033e <_panic>
+
+00802f09 <ipcring_rsp_pop>:
+  802f09:	55                   	push   %ebp
+  802f0a:	89 e5                	mov    %esp,%ebp
+  802f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f0f:	8b 42 18             	mov    0x18(%edx),%eax
+  802f12:	83 c0 01             	add    $0x1,%eax
+  802f15:	89 42 18             	mov    %eax,0x18(%edx)
+  802f18:	5d                   	pop    %ebp
+  802f19:	c3                   	ret
+
+00802f1a <ipcring_server_init>:
+  802f1a:	55                   	push   %ebp
+  802f1b:	89 e5                	mov    %esp,%ebp
+  802f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f23:	89 10                	mov    %edx,(%eax)
+  802f25:	8b 55 10             	mov    0x10(%ebp),%edx
+  802f28:	89 50 04             	mov    %edx,0x4(%eax)
+  802f2b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802f32:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802f39:	5d                   	pop    %ebp
+  802f3a:	c3                   	ret
+
+00802f3b <ipcring_req_avail>:
+  802f3b:	55                   	push   %ebp
+  802f3c:	89 e5                	mov    %esp,%ebp
+  802f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f41:	8b 02                	mov    (%edx),%eax
+  802f43:	8b 40 10             	mov    0x10(%eax),%eax
+  802f46:	2b 42 08             	sub    0x8(%edx),%eax
+  802f49:	ba 08 00 00 00       	mov    $0x8,%edx
+  802f4e:	39 d0                	cmp    %edx,%eax
+  802f50:	0f 47 c2             	cmova  %edx,%eax
+  802f53:	5d                   	pop    %ebp
+  802f54:	c3                   	ret
+
+00802f55 <ipcring_req_peek>:
+  802f55:	55                   	push   %ebp
+  802f56:	89 e5                	mov    %esp,%ebp
+  802f58:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f5b:	8b 42 08             	mov    0x8(%edx),%eax
+  802f5e:	83 e0 07             	and    $0x7,%eax
+  802f61:	8b 12                	mov    (%edx),%edx
+  802f63:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802f67:	5d                   	pop    %ebp
+  802f68:	c3                   	ret
+
+00802f69 <ipcring_rsp_push>:
+  802f69:	55                   	push   %ebp
+  802f6a:	89 e5                	mov    %esp,%ebp
+  802f6c:	83 ec 08             	sub    $0x8,%esp
+  802f6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f72:	8b 41 08             	mov    0x8(%ecx),%eax
+  802f75:	83 c0 01             	add    $0x1,%eax
+  802f78:	89 41 08             	mov    %eax,0x8(%ecx)
+  802f7b:	8b 11                	mov    (%ecx),%edx
+  802f7d:	83 c2 14             	add    $0x14,%edx
+  802f80:	f0 87 02             	lock xchg %eax,(%edx)
+  802f83:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802f87:	75 02                	jne    802f8b <ipcring_rsp_push+0x22>
+  802f89:	c9                   	leave
+  802f8a:	c3                   	ret
+  802f8b:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802f92:	6a 00                	push   $0x0
+  802f94:	68 00 00 80 ee       	push   $0xee800000
+  802f99:	6a 00                	push   $0x0
+  802f9b:	ff 71 04             	push   0x4(%ecx)
+  802f9e:	e8 28 e2 ff ff       	call   8011cb <sys_ipc_try_send>
+  802fa3:	83 c4 10             	add    $0x10,%esp
+  802fa6:	eb e1                	jmp    802f89 <ipcring_rsp_push+0x20>
+
+00802fa8 <ipcring_client_wait>:
+  802fa8:	55                   	push   %ebp
+  802fa9:	89 e5                	mov    %esp,%ebp
+  802fab:	83 ec 08             	sub    $0x8,%esp
+  802fae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb1:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802fb8:	8b 10                	mov    (%eax),%edx
+  802fba:	8b 52 18             	mov    0x18(%edx),%edx
+  802fbd:	3b 50 08             	cmp    0x8(%eax),%edx
+  802fc0:	75 02                	jne    802fc4 <ipcring_client_wait+0x1c>
+  802fc2:	c9                   	leave
+  802fc3:	c3                   	ret
+  802fc4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802fcb:	6a 00                	push   $0x0
+  802fcd:	68 00 00 80 ee       	push   $0xee800000
+  802fd2:	6a 00                	push   $0x0
+  802fd4:	ff 70 04             	push   0x4(%eax)
+  802fd7:	e8 ef e1 ff ff       	call   8011cb <sys_ipc_try_send>
+  802fdc:	83 c4 10             	add    $0x10,%esp
+  802fdf:	eb e1                	jmp    802fc2 <ipcring_client_wait+0x1a>
+
+00802fe1 <ipcring_server_sleep>:
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	53                   	push   %ebx
+  802fe5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fe8:	8b 01                	mov    (%ecx),%eax
+  802fea:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802fed:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ff2:	f0 87 02             	lock xchg %eax,(%edx)
+  802ff5:	8b 11                	mov    (%ecx),%edx
+  802ff7:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802ffa:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fff:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803002:	74 0e                	je     803012 <ipcring_server_sleep+0x31>
+  803004:	b8 00 00 00 00       	mov    $0x0,%eax
+  803009:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80300d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803012:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803015:	c9                   	leave
+  803016:	c3                   	ret
+
+00803017 <devcons_close>:
+  803017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301c:	c3                   	ret
+
+0080301d <devcons_stat>:
+  80301d:	55                   	push   %ebp
+  80301e:	89 e5                	mov    %esp,%ebp
+  803020:	83 ec 10             	sub    $0x10,%esp
+  803023:	68 87 3b 80 00       	push   $0x803b87
+  803028:	ff 75 0c             	push   0xc(%ebp)
+  80302b:	e8 e0 da ff ff       	call   800b10 <strcpy>
+  803030:	b8 00 00 00 00       	mov    $0x0,%eax
+  803035:	c9                   	leave
+  803036:	c3                   	ret
+
+00803037 <devcons_write>:
+  803037:	55                   	push   %ebp
+  803038:	89 e5                	mov    %esp,%ebp
+  80303a:	57                   	push   %edi
+  80303b:	56                   	push   %esi
+  80303c:	53                   	push   %ebx
+  80303d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803043:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803046:	85 ff                	test   %edi,%edi
+  803048:	74 51                	je     80309b <devcons_write+0x64>
+  80304a:	be 00 00 00 00       	mov    $0x0,%esi
+  80304f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803054:	89 fb                	mov    %edi,%ebx
+  803056:	29 c3                	sub    %eax,%ebx
+  803058:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80305d:	39 d3                	cmp    %edx,%ebx
+  80305f:	0f 47 da             	cmova  %edx,%ebx
+  803062:	83 ec 04             	sub    $0x4,%esp
+  803065:	53                   	push   %ebx
+  803066:	03 45 0c             	add    0xc(%ebp),%eax
+  803069:	50                   	push   %eax
+  80306a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803070:	50                   	push   %eax
+  803071:	e8 4a dc ff ff       	call   800cc0 <memmove>
+  803076:	83 c4 08             	add    $0x8,%esp
+  803079:	53                   	push   %ebx
+  80307a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803080:	50                   	push   %eax
+  803081:	e8 02 de ff ff       	call   800e88 <sys_cputs>
+  803086:	01 de                	add    %ebx,%esi
+  803088:	89 f0                	mov    %esi,%eax
+  80308a:	83 c4 10             	add    $0x10,%esp
+  80308d:	39 fe                	cmp    %edi,%esi
+  80308f:	72 c3                	jb     803054 <devcons_write+0x1d>
+  803091:	89 f0                	mov    %esi,%eax
+  803093:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803096:	5b                   	pop    %ebx
+  803097:	5e                   	pop    %esi
+  803098:	5f                   	pop    %edi
+  803099:	5d                   	pop    %ebp
+  80309a:	c3                   	ret
+  80309b:	be 00 00 00 00       	mov    $0x0,%esi
+  8030a0:	eb ef                	jmp    803091 <devcons_write+0x5a>
+
+008030a2 <devcons_read>:
+  8030a2:	55                   	push   %ebp
+  8030a3:	89 e5                	mov    %esp,%ebp
+  8030a5:	83 ec 08             	sub    $0x8,%esp
+  8030a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ad:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030b1:	75 07                	jne    8030ba <devcons_read+0x18>
+  8030b3:	eb 1f                	jmp    8030d4 <devcons_read+0x32>
+  8030b5:	e8 6b de ff ff       	call   800f25 <sys_yield>
+  8030ba:	e8 e7 dd ff ff       	call   800ea6 <sys_cgetc>
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	74 f2                	je     8030b5 <devcons_read+0x13>
+  8030c3:	78 0f                	js     8030d4 <devcons_read+0x32>
+  8030c5:	83 f8 04             	cmp    $0x4,%eax
+  8030c8:	74 0c                	je     8030d6 <devcons_read+0x34>
+  8030ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030cd:	88 02                	mov    %al,(%edx)
+  8030cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030d4:	c9                   	leave
+  8030d5:	c3                   	ret
+  8030d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030db:	eb f7                	jmp    8030d4 <devcons_read+0x32>
+
+008030dd <cputchar>:
+  8030dd:	55                   	push   %ebp
+  8030de:	89 e5                	mov    %esp,%ebp
+  8030e0:	83 ec 20             	sub    $0x20,%esp
+  8030e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e6:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8030e9:	6a 01                	push   $0x1
+  8030eb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030ee:	50                   	push   %eax
+  8030ef:	e8 94 dd ff ff       	call   800e88 <sys_cputs>
+  8030f4:	83 c4 10             	add    $0x10,%esp
+  8030f7:	c9                   	leave
+  8030f8:	c3                   	ret
+
+008030f9 <getchar>:
+  8030f9:	55                   	push   %ebp
+  8030fa:	89 e5                	mov    %esp,%ebp
+  8030fc:	83 ec 1c             	sub    $0x1c,%esp
+  8030ff:	6a 01                	push   $0x1
+  803101:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803104:	50                   	push   %eax
+  803105:	6a 00                	push   $0x0
+  803107:	e8 fa ea ff ff       	call   801c06 <read>
+  80310c:	83 c4 10             	add    $0x10,%esp
+  80310f:	85 c0                	test   %eax,%eax
+  803111:	78 06                	js     803119 <getchar+0x20>
+  803113:	74 06                	je     80311b <getchar+0x22>
+  803115:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803119:	c9                   	leave
+  80311a:	c3                   	ret
+  80311b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803120:	eb f7                	jmp    803119 <getchar+0x20>
+
+00803122 <iscons>:
+  803122:	55                   	push   %ebp
+  803123:	89 e5                	mov    %esp,%ebp
+  803125:	83 ec 20             	sub    $0x20,%esp
+  803128:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80312b:	50                   	push   %eax
+  80312c:	ff 75 08             	push   0x8(%ebp)
+  80312f:	e8 70 e8 ff ff       	call   8019a4 <fd_lookup>
+  803134:	83 c4 10             	add    $0x10,%esp
+  803137:	85 c0                	test   %eax,%eax
+  803139:	78 11                	js     80314c <iscons+0x2a>
+  80313b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80313e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803144:	39 10                	cmp    %edx,(%eax)
+  803146:	0f 94 c0             	sete   %al
+  803149:	0f b6 c0             	movzbl %al,%eax
+  80314c:	c9                   	leave
+  80314d:	c3                   	ret
+
+0080314e <opencons>:
+  80314e:	55                   	push   %ebp
+  80314f:	89 e5                	mov    %esp,%ebp
+  803151:	83 ec 24             	sub    $0x24,%esp
+  803154:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803157:	50                   	push   %eax
+  803158:	e8 f7 e7 ff ff       	call   801954 <fd_alloc>
+  80315d:	83 c4 10             	add    $0x10,%esp
+  803160:	85 c0                	test   %eax,%eax
+  803162:	78 3a                	js     80319e <opencons+0x50>
+  803164:	83 ec 04             	sub    $0x4,%esp
+  803167:	68 07 04 00 00       	push   $0x407
+  80316c:	ff 75 f4             	push   -0xc(%ebp)
+  80316f:	6a 00                	push   $0x0
+  803171:	e8 fa dd ff ff       	call   800f70 <sys_page_alloc>
+  803176:	83 c4 10             	add    $0x10,%esp
+  803179:	85 c0                	test   %eax,%eax
+  80317b:	78 21                	js     80319e <opencons+0x50>
+  80317d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803180:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803186:	89 10                	mov    %edx,(%eax)
+  803188:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80318b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803192:	83 ec 0c             	sub    $0xc,%esp
+  803195:	50                   	push   %eax
+  803196:	e8 92 e7 ff ff       	call   80192d <fd2num>
+  80319b:	83 c4 10             	add    $0x10,%esp
+  80319e:	c9                   	leave
+  80319f:	c3                   	ret
+
+008031a0 <ipc_recv>:
+  8031a0:	55                   	push   %ebp
+  8031a1:	89 e5                	mov    %esp,%ebp
+  8031a3:	56                   	push   %esi
+  8031a4:	53                   	push   %ebx
+  8031a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031ae:	85 c0                	test   %eax,%eax
+  8031b0:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  8031b5:	0f 44 c2             	cmove  %edx,%eax
+  8031b8:	83 ec 0c             	sub    $0xc,%esp
+  8031bb:	50                   	push   %eax
+  8031bc:	e8 5a e0 ff ff       	call   80121b <sys_ipc_recv>
+  8031c1:	83 c4 10             	add    $0x10,%esp
+  8031c4:	85 c0                	test   %eax,%eax
+  8031c6:	78 2a                	js     8031f2 <ipc_recv+0x52>
+  8031c8:	a1 20 54 80 00       	mov    0x805420,%eax
+  8031cd:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8031d3:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8031d9:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8031df:	85 f6                	test   %esi,%esi
+  8031e1:	74 02                	je     8031e5 <ipc_recv+0x45>
+  8031e3:	89 0e                	mov    %ecx,(%esi)
+  8031e5:	85 db                	test   %ebx,%ebx
+  8031e7:	74 02                	je     8031eb <ipc_recv+0x4b>
+  8031e9:	89 13                	mov    %edx,(%ebx)
+  8031eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031ee:	5b                   	pop    %ebx
+  8031ef:	5e                   	pop    %esi
+  8031f0:	5d                   	pop    %ebp
+  8031f1:	c3                   	ret
+  8031f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031fc:	eb e1                	jmp    8031df <ipc_recv+0x3f>
+
+008031fe <ipc_send>:
+  8031fe:	55                   	push   %ebp
+  8031ff:	89 e5                	mov    %esp,%ebp
+  803201:	57                   	push   %edi
+  803202:	56                   	push   %esi
+  803203:	53                   	push   %ebx
+  803204:	83 ec 0c             	sub    $0xc,%esp
+  803207:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80320a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80320d:	8b 75 14             	mov    0x14(%ebp),%esi
+  803210:	85 db                	test   %ebx,%ebx
+  803212:	74 1e                	je     803232 <ipc_send+0x34>
+  803214:	56                   	push   %esi
+  803215:	53                   	push   %ebx
+  803216:	57                   	push   %edi
+  803217:	ff 75 08             	push   0x8(%ebp)
+  80321a:	e8 89 e0 ff ff       	call   8012a8 <sys_ipc_send>
+  80321f:	83 c4 10             	add    $0x10,%esp
+  803222:	85 c0                	test   %eax,%eax
+  803224:	74 2a                	je     803250 <ipc_send+0x52>
+  803226:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803229:	75 13                	jne    80323e <ipc_send+0x40>
+  80322b:	e8 f5 dc ff ff       	call   800f25 <sys_yield>
+  803230:	eb e2                	jmp    803214 <ipc_send+0x16>
+  803232:	be 00 00 00 00       	mov    $0x0,%esi
+  803237:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80323c:	eb d6                	jmp    803214 <ipc_send+0x16>
+  80323e:	50                   	push   %eax
+  80323f:	68 94 3b 80 00       	push   $0x803b94
+  803244:	6a 4f                	push   $0x4f
+  803246:	68 d7 3b 80 00       	push   $0x803bd7
+  80324b:	e8 ee d0 ff ff       	call   80033e <_panic>
+  803250:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803253:	5b                   	pop    %ebx
+  803254:	5e                   	pop    %esi
+  803255:	5f                   	pop    %edi
+  803256:	5d                   	pop    %ebp
+  803257:	c3                   	ret
+
+00803258 <ipc_call>:
+  803258:	55                   	push   %ebp
+  803259:	89 e5                	mov    %esp,%ebp
+  80325b:	57                   	push   %edi
+  80325c:	56                   	push   %esi
+  80325d:	53                   	push   %ebx
+  80325e:	83 ec 0c             	sub    $0xc,%esp
+  803261:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803265:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  80326a:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  80326e:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803272:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803277:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80327b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80327f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803284:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803288:	eb 05                	jmp    80328f <ipc_call+0x37>
+  80328a:	e8 96 dc ff ff       	call   800f25 <sys_yield>
+  80328f:	83 ec 0c             	sub    $0xc,%esp
+  803292:	56                   	push   %esi
+  803293:	53                   	push   %ebx
+  803294:	57                   	push   %edi
+  803295:	ff 75 0c             	push   0xc(%ebp)
+  803298:	ff 75 08             	push   0x8(%ebp)
+  80329b:	e8 58 e0 ff ff       	call   8012f8 <sys_ipc_call>
+  8032a0:	83 c4 20             	add    $0x20,%esp
+  8032a3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032a6:	74 e2                	je     80328a <ipc_call+0x32>
+  8032a8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8032ab:	74 2d                	je     8032da <ipc_call+0x82>
+  8032ad:	85 c0                	test   %eax,%eax
+  8032af:	78 4f                	js     803300 <ipc_call+0xa8>
+  8032b1:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8032b5:	74 10                	je     8032c7 <ipc_call+0x6f>
+  8032b7:	a1 20 54 80 00       	mov    0x805420,%eax
+  8032bc:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8032c2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8032c5:	89 02                	mov    %eax,(%edx)
+  8032c7:	a1 20 54 80 00       	mov    0x805420,%eax
+  8032cc:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8032d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032d5:	5b                   	pop    %ebx
+  8032d6:	5e                   	pop    %esi
+  8032d7:	5f                   	pop    %edi
+  8032d8:	5d                   	pop    %ebp
+  8032d9:	c3                   	ret
+  8032da:	ff 75 14             	push   0x14(%ebp)
+  8032dd:	ff 75 10             	push   0x10(%ebp)
+  8032e0:	ff 75 0c             	push   0xc(%ebp)
+  8032e3:	ff 75 08             	push   0x8(%ebp)
+  8032e6:	e8 13 ff ff ff       	call   8031fe <ipc_send>
+  8032eb:	83 c4 0c             	add    $0xc,%esp
+  8032ee:	ff 75 1c             	push   0x1c(%ebp)
+  8032f1:	ff 75 18             	push   0x18(%ebp)
+  8032f4:	6a 00                	push   $0x0
+  8032f6:	e8 a5 fe ff ff       	call   8031a0 <ipc_recv>
+  8032fb:	83 c4 10             	add    $0x10,%esp
+  8032fe:	eb d2                	jmp    8032d2 <ipc_call+0x7a>
+  803300:	50                   	push   %eax
+  803301:	68 e1 3b 80 00       	push   $0x803be1
+  803306:	6a 6d                	push   $0x6d
+  803308:	68 d7 3b 80 00       	push   $0x803bd7
+  80330d:	e8 2c d0 ff ff       	call   80033e <_panic>
+
+00803312 <ipc_reply_recv>:
+  803312:	55                   	push   %ebp
+  803313:	89 e5                	mov    %esp,%ebp
+  803315:	57                   	push   %edi
+  803316:	56                   	push   %esi
+  803317:	53                   	push   %ebx
+  803318:	83 ec 0c             	sub    $0xc,%esp
+  80331b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80331e:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803321:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803324:	85 db                	test   %ebx,%ebx
+  803326:	0f 84 ac 00 00 00    	je     8033d8 <ipc_reply_recv+0xc6>
+  80332c:	85 f6                	test   %esi,%esi
+  80332e:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803333:	0f 45 c6             	cmovne %esi,%eax
+  803336:	83 ec 0c             	sub    $0xc,%esp
+  803339:	50                   	push   %eax
+  80333a:	ff 75 14             	push   0x14(%ebp)
+  80333d:	53                   	push   %ebx
+  80333e:	ff 75 0c             	push   0xc(%ebp)
+  803341:	ff 75 08             	push   0x8(%ebp)
+  803344:	e8 d0 df ff ff       	call   801319 <sys_ipc_reply_recv>
+  803349:	83 c4 20             	add    $0x20,%esp
+  80334c:	85 c0                	test   %eax,%eax
+  80334e:	78 3a                	js     80338a <ipc_reply_recv+0x78>
+  803350:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803354:	74 10                	je     803366 <ipc_reply_recv+0x54>
+  803356:	a1 20 54 80 00       	mov    0x805420,%eax
+  80335b:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803361:	8b 55 18             	mov    0x18(%ebp),%edx
+  803364:	89 02                	mov    %eax,(%edx)
+  803366:	85 ff                	test   %edi,%edi
+  803368:	74 0d                	je     803377 <ipc_reply_recv+0x65>
+  80336a:	a1 20 54 80 00       	mov    0x805420,%eax
+  80336f:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803375:	89 07                	mov    %eax,(%edi)
+  803377:	a1 20 54 80 00       	mov    0x805420,%eax
+  80337c:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803382:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803385:	5b                   	pop    %ebx
+  803386:	5e                   	pop    %esi
+  803387:	5f                   	pop    %edi
+  803388:	5d                   	pop    %ebp
+  803389:	c3                   	ret
+  80338a:	ff 75 14             	push   0x14(%ebp)
+  80338d:	53                   	push   %ebx
+  80338e:	ff 75 0c             	push   0xc(%ebp)
+  803391:	ff 75 08             	push   0x8(%ebp)
+  803394:	e8 32 de ff ff       	call   8011cb <sys_ipc_try_send>
+  803399:	89 c2                	mov    %eax,%edx
+  80339b:	c1 ea 1f             	shr    $0x1f,%edx
+  80339e:	83 c4 10             	add    $0x10,%esp
+  8033a1:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8033a4:	0f 95 c1             	setne  %cl
+  8033a7:	84 d1                	test   %dl,%cl
+  8033a9:	74 05                	je     8033b0 <ipc_reply_recv+0x9e>
+  8033ab:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033ae:	75 12                	jne    8033c2 <ipc_reply_recv+0xb0>
+  8033b0:	83 ec 04             	sub    $0x4,%esp
+  8033b3:	57                   	push   %edi
+  8033b4:	56                   	push   %esi
+  8033b5:	ff 75 18             	push   0x18(%ebp)
+  8033b8:	e8 e3 fd ff ff       	call   8031a0 <ipc_recv>
+  8033bd:	83 c4 10             	add    $0x10,%esp
+  8033c0:	eb c0                	jmp    803382 <ipc_reply_recv+0x70>
+  8033c2:	83 ec 04             	sub    $0x4,%esp
+  8033c5:	50                   	push   %eax
+  8033c6:	ff 75 08             	push   0x8(%ebp)
+  8033c9:	68 b4 3b 80 00       	push   $0x803bb4
+  8033ce:	e8 46 d0 ff ff       	call   800419 <cprintf>
+  8033d3:	83 c4 10             	add    $0x10,%esp
+  8033d6:	eb d8                	jmp    8033b0 <ipc_reply_recv+0x9e>
+  8033d8:	85 f6                	test   %esi,%esi
+  8033da:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8033df:	0f 45 c6             	cmovne %esi,%eax
+  8033e2:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8033e7:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8033ee:	e9 43 ff ff ff       	jmp    803336 <ipc_reply_recv+0x24>
+
+008033f3 <ipc_find_env>:
+  8033f3:	55                   	push   %ebp
+  8033f4:	89 e5                	mov    %esp,%ebp
+  8033f6:	83 ec 14             	sub    $0x14,%esp
+  8033f9:	ff 75 08             	push   0x8(%ebp)
+  8033fc:	e8 68 dd ff ff       	call   801169 <sys_env_service>
+  803401:	85 c0                	test   %eax,%eax
+  803403:	ba 00 00 00 00       	mov    $0x0,%edx
+  803408:	0f 48 c2             	cmovs  %edx,%eax
+  80340b:	c9                   	leave
+  80340c:	c3                   	ret
+
+0080340d <pageref>:
+  80340d:	55                   	push   %ebp
+  80340e:	89 e5                	mov    %esp,%ebp
+  803410:	8b 45 08             	mov    0x8(%ebp),%eax
+  803413:	89 c2                	mov    %eax,%edx
+  803415:	c1 ea 16             	shr    $0x16,%edx
+  803418:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80341f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803424:	f6 c1 01             	test   $0x1,%cl
+  803427:	74 22                	je     80344b <pageref+0x3e>
+  803429:	c1 e8 0c             	shr    $0xc,%eax
+  80342c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803433:	a8 01                	test   $0x1,%al
+  803435:	74 14                	je     80344b <pageref+0x3e>
+  803437:	c1 e8 0c             	shr    $0xc,%eax
+  80343a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80343d:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803444:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803448:	0f b7 d2             	movzwl %dx,%edx
+  80344b:	89 d0                	mov    %edx,%eax
+  80344d:	5d                   	pop    %ebp
+  80344e:	c3                   	ret
+
+0080344f <__udivmoddi4>:
+  80344f:	55                   	push   %ebp
+  803450:	57                   	push   %edi
+  803451:	56                   	push   %esi
+  803452:	53                   	push   %ebx
+  803453:	83 ec 24             	sub    $0x24,%esp
+  803456:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80345a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80345e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803462:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803466:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80346a:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80346e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803472:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803476:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80347a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803484:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803489:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803490:	00 
+  803491:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803498:	00 
+  803499:	89 fb                	mov    %edi,%ebx
+  80349b:	eb 08                	jmp    8034a5 <__udivmoddi4+0x56>
+  80349d:	83 e9 01             	sub    $0x1,%ecx
+  8034a0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8034a3:	74 68                	je     80350d <__udivmoddi4+0xbe>
+  8034a5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8034a9:	01 c0                	add    %eax,%eax
+  8034ab:	89 c6                	mov    %eax,%esi
+  8034ad:	89 d7                	mov    %edx,%edi
+  8034af:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8034b3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8034b7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8034ba:	d3 ea                	shr    %cl,%edx
+  8034bc:	f6 c1 20             	test   $0x20,%cl
+  8034bf:	74 04                	je     8034c5 <__udivmoddi4+0x76>
+  8034c1:	89 d0                	mov    %edx,%eax
+  8034c3:	31 d2                	xor    %edx,%edx
+  8034c5:	83 e0 01             	and    $0x1,%eax
+  8034c8:	89 04 24             	mov    %eax,(%esp)
+  8034cb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8034d2:	00 
+  8034d3:	8b 04 24             	mov    (%esp),%eax
+  8034d6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8034da:	09 f0                	or     %esi,%eax
+  8034dc:	09 fa                	or     %edi,%edx
+  8034de:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8034e2:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8034e6:	39 f0                	cmp    %esi,%eax
+  8034e8:	89 d5                	mov    %edx,%ebp
+  8034ea:	19 fd                	sbb    %edi,%ebp
+  8034ec:	72 af                	jb     80349d <__udivmoddi4+0x4e>
+  8034ee:	29 f0                	sub    %esi,%eax
+  8034f0:	19 fa                	sbb    %edi,%edx
+  8034f2:	89 cf                	mov    %ecx,%edi
+  8034f4:	c1 ef 05             	shr    $0x5,%edi
+  8034f7:	83 e7 01             	and    $0x1,%edi
+  8034fa:	89 fe                	mov    %edi,%esi
+  8034fc:	83 f6 01             	xor    $0x1,%esi
+  8034ff:	d3 e6                	shl    %cl,%esi
+  803501:	d3 e7                	shl    %cl,%edi
+  803503:	09 74 24 18          	or     %esi,0x18(%esp)
+  803507:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80350b:	eb 90                	jmp    80349d <__udivmoddi4+0x4e>
+  80350d:	85 db                	test   %ebx,%ebx
+  80350f:	74 05                	je     803516 <__udivmoddi4+0xc7>
+  803511:	89 03                	mov    %eax,(%ebx)
+  803513:	89 53 04             	mov    %edx,0x4(%ebx)
+  803516:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80351a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80351e:	83 c4 24             	add    $0x24,%esp
+  803521:	5b                   	pop    %ebx
+  803522:	5e                   	pop    %esi
+  803523:	5f                   	pop    %edi
+  803524:	5d                   	pop    %ebp
+  803525:	c3                   	ret
+
+00803526 <__udivdi3>:
+  803526:	83 ec 08             	sub    $0x8,%esp
+  803529:	6a 00                	push   $0x0
+  80352b:	ff 74 24 1c          	push   0x1c(%esp)
+  80352f:	ff 74 24 1c          	push   0x1c(%esp)
+  803533:	ff 74 24 1c          	push   0x1c(%esp)
+  803537:	ff 74 24 1c          	push   0x1c(%esp)
+  80353b:	e8 0f ff ff ff       	call   80344f <__udivmoddi4>
+  803540:	83 c4 1c             	add    $0x1c,%esp
+  803543:	c3                   	ret
+
+00803544 <__umoddi3>:
+  803544:	83 ec 18             	sub    $0x18,%esp
+  803547:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80354b:	50                   	push   %eax
+  80354c:	ff 74 24 2c          	push   0x2c(%esp)
+  803550:	ff 74 24 2c          	push   0x2c(%esp)
+  803554:	ff 74 24 2c          	push   0x2c(%esp)
+  803558:	ff 74 24 2c          	push   0x2c(%esp)
+  80355c:	e8 ee fe ff ff       	call   80344f <__udivmoddi4>
+  803561:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803565:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803569:	83 c4 2c             	add    $0x2c,%esp
+  80356c:	c3                   	ret
+
+0080356d <__divdi3>:
+  80356d:	53                   	push   %ebx
+  80356e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803572:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803576:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80357a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80357e:	85 d2                	test   %edx,%edx
+  803580:	78 12                	js     803594 <__divdi3+0x27>
+  803582:	85 db                	test   %ebx,%ebx
+  803584:	78 2e                	js     8035b4 <__divdi3+0x47>
+  803586:	53                   	push   %ebx
+  803587:	51                   	push   %ecx
+  803588:	52                   	push   %edx
+  803589:	50                   	push   %eax
+  80358a:	e8 97 ff ff ff       	call   803526 <__udivdi3>
+  80358f:	83 c4 10             	add    $0x10,%esp
+  803592:	eb 1e                	jmp    8035b2 <__divdi3+0x45>
+  803594:	f7 d8                	neg    %eax
+  803596:	83 d2 00             	adc    $0x0,%edx
+  803599:	f7 da                	neg    %edx
+  80359b:	85 db                	test   %ebx,%ebx
+  80359d:	78 2a                	js     8035c9 <__divdi3+0x5c>
+  80359f:	53                   	push   %ebx
+  8035a0:	51                   	push   %ecx
+  8035a1:	52                   	push   %edx
+  8035a2:	50                   	push   %eax
+  8035a3:	e8 7e ff ff ff       	call   803526 <__udivdi3>
+  8035a8:	83 c4 10             	add    $0x10,%esp
+  8035ab:	f7 d8                	neg    %eax
+  8035ad:	83 d2 00             	adc    $0x0,%edx
+  8035b0:	f7 da                	neg    %edx
+  8035b2:	5b                   	pop    %ebx
+  8035b3:	c3                   	ret
+  8035b4:	f7 d9                	neg    %ecx
+  8035b6:	83 d3 00             	adc    $0x0,%ebx
+  8035b9:	f7 db                	neg    %ebx
+  8035bb:	53                   	push   %ebx
+  8035bc:	51                   	push   %ecx
+  8035bd:	52                   	push   %edx
+  8035be:	50                   	push   %eax
+  8035bf:	e8 62 ff ff ff       	call   803526 <__udivdi3>
+  8035c4:	83 c4 10             	add    $0x10,%esp
+  8035c7:	eb e2                	jmp    8035ab <__divdi3+0x3e>
+  8035c9:	f7 d9                	neg    %ecx
+  8035cb:	83 d3 00             	adc    $0x0,%ebx
+  8035ce:	f7 db                	neg    %ebx
+  8035d0:	53                   	push   %ebx
+  8035d1:	51                   	push   %ecx
+  8035d2:	52                   	push   %edx
+  8035d3:	50                   	push   %eax
+  8035d4:	e8 4d ff ff ff       	call   803526 <__udivdi3>
+  8035d9:	83 c4 10             	add    $0x10,%esp
+  8035dc:	eb d4                	jmp    8035b2 <__divdi3+0x45>
+
+008035de <__moddi3>:
+  8035de:	55                   	push   %ebp
+  8035df:	57                   	push   %edi
+  8035e0:	56                   	push   %esi
+  8035e1:	53                   	push   %ebx
+  8035e2:	83 ec 0c             	sub    $0xc,%esp
+  8035e5:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8035e9:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8035ed:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8035f1:	89 e9                	mov    %ebp,%ecx
+  8035f3:	f7 d9                	neg    %ecx
+  8035f5:	89 d0                	mov    %edx,%eax
+  8035f7:	83 d0 00             	adc    $0x0,%eax
+  8035fa:	f7 d8                	neg    %eax
+  8035fc:	0f 49 e9             	cmovns %ecx,%ebp
+  8035ff:	0f 49 d0             	cmovns %eax,%edx
+  803602:	52                   	push   %edx
+  803603:	55                   	push   %ebp
+  803604:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803608:	f7 da                	neg    %edx
+  80360a:	89 d8                	mov    %ebx,%eax
+  80360c:	83 d0 00             	adc    $0x0,%eax
+  80360f:	f7 d8                	neg    %eax
+  803611:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803616:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80361a:	0f 48 c3             	cmovs  %ebx,%eax
+  80361d:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803621:	ff 74 24 0c          	push   0xc(%esp)
+  803625:	ff 74 24 0c          	push   0xc(%esp)
+  803629:	e8 16 ff ff ff       	call   803544 <__umoddi3>
+  80362e:	83 c4 10             	add    $0x10,%esp
+  803631:	85 db                	test   %ebx,%ebx
+  803633:	78 08                	js     80363d <__moddi3+0x5f>
+  803635:	83 c4 0c             	add    $0xc,%esp
+  803638:	5b                   	pop    %ebx
+  803639:	5e                   	pop    %esi
+  80363a:	5f                   	pop    %edi
+  80363b:	5d                   	pop    %ebp
+  80363c:	c3                   	ret
+  80363d:	f7 d8                	neg    %eax
+  80363f:	83 d2 00             	adc    $0x0,%edx
+  803642:	f7 da                	neg    %edx
+  803644:	eb ef                	jmp    803635 <__moddi3+0x57>
@@ -0,0 +1,5346 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+  800039:	68 a0 34 80 00       	push   $0x8034a0
+  80003e:	e8 dc 01 00 00       	call   80021f <cprintf>
+  800043:	e8 12 01 00 00       	call   80015a <exit>
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 78 15 00 00       	call   8015e4 <argstart>
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 8c 15 00 00       	call   801614 <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 b4 34 80 00       	push   $0x8034b4
+  8000c2:	e8 58 01 00 00       	call   80021f <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 35 1b 00 00       	call   801c11 <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 b4 34 80 00       	push   $0x8034b4
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 1f 23 00 00       	call   802423 <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800119:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80011c:	e8 eb 0b 00 00       	call   800d0c <sys_getenvid>
+  800121:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800126:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80012c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800131:	a3 10 50 80 00       	mov    %eax,0x805010
+  800136:	85 db                	test   %ebx,%ebx
+  800138:	7e 07                	jle    800141 <libmain+0x30>
+  80013a:	8b 06                	mov    (%esi),%eax
+  80013c:	a3 00 40 80 00       	mov    %eax,0x804000
+  800141:	83 ec 08             	sub    $0x8,%esp
+  800144:	56                   	push   %esi
+  800145:	53                   	push   %ebx
+  800146:	e8 02 ff ff ff       	call   80004d <umain>
+  80014b:	e8 0a 00 00 00       	call   80015a <exit>
+  800150:	83 c4 10             	add    $0x10,%esp
+  800153:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800156:	5b                   	pop    %ebx
+  800157:	5e                   	pop    %esi
+  800158:	5d                   	pop    %ebp
+  800159:	c3                   	ret
+
+0080015a <exit>:
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	83 ec 08             	sub    $0x8,%esp
+  800160:	a1 10 50 80 00       	mov    0x805010,%eax
+  800165:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80016b:	85 c0                	test   %eax,%eax
+  80016d:	75 14                	jne    800183 <exit+0x29>
+  80016f:	e8 89 17 00 00       	call   8018fd <close_all>
+  800174:	83 ec 0c             	sub    $0xc,%esp
+  800177:	6a 00                	push   $0x0
+  800179:	e8 4d 0b 00 00       	call   800ccb <sys_env_destroy>
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	c9                   	leave
+  800182:	c3                   	ret
+  800183:	e8 b0 12 00 00       	call   801438 <sys_lease_complete>
+  800188:	eb e5                	jmp    80016f <exit+0x15>
+
+0080018a <putch>:
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	53                   	push   %ebx
+  80018e:	83 ec 04             	sub    $0x4,%esp
+  800191:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800194:	8b 13                	mov    (%ebx),%edx
+  800196:	8d 42 01             	lea    0x1(%edx),%eax
+  800199:	89 03                	mov    %eax,(%ebx)
+  80019b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80019e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001a2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a7:	74 09                	je     8001b2 <putch+0x28>
+  8001a9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b0:	c9                   	leave
+  8001b1:	c3                   	ret
+  8001b2:	83 ec 08             	sub    $0x8,%esp
+  8001b5:	68 ff 00 00 00       	push   $0xff
+  8001ba:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001bd:	50                   	push   %eax
+  8001be:	e8 cb 0a 00 00       	call   800c8e <sys_cputs>
+  8001c3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	eb db                	jmp    8001a9 <putch+0x1f>
+
+008001ce <vcprintf>:
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001d7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001de:	00 00 00 
+  8001e1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e8:	00 00 00 
+  8001eb:	ff 75 0c             	push   0xc(%ebp)
+  8001ee:	ff 75 08             	push   0x8(%ebp)
+  8001f1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f7:	50                   	push   %eax
+  8001f8:	68 8a 01 80 00       	push   $0x80018a
+  8001fd:	e8 1c 01 00 00       	call   80031e <vprintfmt>
+  800202:	83 c4 08             	add    $0x8,%esp
+  800205:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80020b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800211:	50                   	push   %eax
+  800212:	e8 77 0a 00 00       	call   800c8e <sys_cputs>
+  800217:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80021d:	c9                   	leave
+  80021e:	c3                   	ret
+
+0080021f <cprintf>:
+  80021f:	55                   	push   %ebp
+  800220:	89 e5                	mov    %esp,%ebp
+  800222:	83 ec 10             	sub    $0x10,%esp
+  800225:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800228:	50                   	push   %eax
+  800229:	ff 75 08             	push   0x8(%ebp)
+  80022c:	e8 9d ff ff ff       	call   8001ce <vcprintf>
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+00800233 <printnum>:
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	57                   	push   %edi
+  800237:	56                   	push   %esi
+  800238:	53                   	push   %ebx
+  800239:	83 ec 1c             	sub    $0x1c,%esp
+  80023c:	89 c3                	mov    %eax,%ebx
+  80023e:	89 d6                	mov    %edx,%esi
+  800240:	8b 45 08             	mov    0x8(%ebp),%eax
+  800243:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800246:	89 d1                	mov    %edx,%ecx
+  800248:	89 c2                	mov    %eax,%edx
+  80024a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80024d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800250:	8b 45 10             	mov    0x10(%ebp),%eax
+  800253:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800256:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80025d:	39 c2                	cmp    %eax,%edx
+  80025f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800262:	73 4b                	jae    8002af <printnum+0x7c>
+  800264:	8b 45 14             	mov    0x14(%ebp),%eax
+  800267:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80026a:	85 ff                	test   %edi,%edi
+  80026c:	7e 11                	jle    80027f <printnum+0x4c>
+  80026e:	83 ec 08             	sub    $0x8,%esp
+  800271:	56                   	push   %esi
+  800272:	ff 75 18             	push   0x18(%ebp)
+  800275:	ff d3                	call   *%ebx
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	83 ef 01             	sub    $0x1,%edi
+  80027d:	75 ef                	jne    80026e <printnum+0x3b>
+  80027f:	83 ec 08             	sub    $0x8,%esp
+  800282:	56                   	push   %esi
+  800283:	83 ec 04             	sub    $0x4,%esp
+  800286:	ff 75 e4             	push   -0x1c(%ebp)
+  800289:	ff 75 e0             	push   -0x20(%ebp)
+  80028c:	ff 75 dc             	push   -0x24(%ebp)
+  80028f:	ff 75 d8             	push   -0x28(%ebp)
+  800292:	e8 f9 30 00 00       	call   803390 <__umoddi3>
+  800297:	83 c4 14             	add    $0x14,%esp
+  80029a:	0f be 80 e6 34 80 00 	movsbl 0x8034e6(%eax),%eax
+  8002a1:	50                   	push   %eax
+  8002a2:	ff d3                	call   *%ebx
+  8002a4:	83 c4 10             	add    $0x10,%esp
+  8002a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002aa:	5b                   	pop    %ebx
+  8002ab:	5e                   	pop    %esi
+  8002ac:	5f                   	pop    %edi
+  8002ad:	5d                   	pop    %ebp
+  8002ae:	c3                   	ret
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	ff 75 18             	push   0x18(%ebp)
+  8002b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002b8:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002bb:	52                   	push   %edx
+  8002bc:	50                   	push   %eax
+  8002bd:	83 ec 08             	sub    $0x8,%esp
+  8002c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c3:	ff 75 e0             	push   -0x20(%ebp)
+  8002c6:	ff 75 dc             	push   -0x24(%ebp)
+  8002c9:	ff 75 d8             	push   -0x28(%ebp)
+  8002cc:	e8 a1 30 00 00       	call   803372 <__udivdi3>
+  8002d1:	83 c4 18             	add    $0x18,%esp
+  8002d4:	52                   	push   %edx
+  8002d5:	50                   	push   %eax
+  8002d6:	89 f2                	mov    %esi,%edx
+  8002d8:	89 d8                	mov    %ebx,%eax
+  8002da:	e8 54 ff ff ff       	call   800233 <printnum>
+  8002df:	83 c4 20             	add    $0x20,%esp
+  8002e2:	eb 9b                	jmp    80027f <printnum+0x4c>
+
+008002e4 <sprintputch>:
+  8002e4:	55                   	push   %ebp
+  8002e5:	89 e5                	mov    %esp,%ebp
+  8002e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002ea:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002ee:	8b 10                	mov    (%eax),%edx
+  8002f0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f3:	73 0a                	jae    8002ff <sprintputch+0x1b>
+  8002f5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f8:	89 08                	mov    %ecx,(%eax)
+  8002fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fd:	88 02                	mov    %al,(%edx)
+  8002ff:	5d                   	pop    %ebp
+  800300:	c3                   	ret
+
+00800301 <printfmt>:
+  800301:	55                   	push   %ebp
+  800302:	89 e5                	mov    %esp,%ebp
+  800304:	83 ec 08             	sub    $0x8,%esp
+  800307:	8d 45 14             	lea    0x14(%ebp),%eax
+  80030a:	50                   	push   %eax
+  80030b:	ff 75 10             	push   0x10(%ebp)
+  80030e:	ff 75 0c             	push   0xc(%ebp)
+  800311:	ff 75 08             	push   0x8(%ebp)
+  800314:	e8 05 00 00 00       	call   80031e <vprintfmt>
+  800319:	83 c4 10             	add    $0x10,%esp
+  80031c:	c9                   	leave
+  80031d:	c3                   	ret
+
+0080031e <vprintfmt>:
+  80031e:	55                   	push   %ebp
+  80031f:	89 e5                	mov    %esp,%ebp
+  800321:	57                   	push   %edi
+  800322:	56                   	push   %esi
+  800323:	53                   	push   %ebx
+  800324:	83 ec 2c             	sub    $0x2c,%esp
+  800327:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80032a:	89 df                	mov    %ebx,%edi
+  80032c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800332:	8d 70 01             	lea    0x1(%eax),%esi
+  800335:	0f b6 00             	movzbl (%eax),%eax
+  800338:	83 f8 25             	cmp    $0x25,%eax
+  80033b:	74 1e                	je     80035b <vprintfmt+0x3d>
+  80033d:	85 c0                	test   %eax,%eax
+  80033f:	0f 84 15 05 00 00    	je     80085a <vprintfmt+0x53c>
+  800345:	83 ec 08             	sub    $0x8,%esp
+  800348:	53                   	push   %ebx
+  800349:	50                   	push   %eax
+  80034a:	ff d7                	call   *%edi
+  80034c:	83 c6 01             	add    $0x1,%esi
+  80034f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800353:	83 c4 10             	add    $0x10,%esp
+  800356:	83 f8 25             	cmp    $0x25,%eax
+  800359:	75 e2                	jne    80033d <vprintfmt+0x1f>
+  80035b:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80035f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800366:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80036d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800374:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800379:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80037c:	8d 56 01             	lea    0x1(%esi),%edx
+  80037f:	0f b6 0e             	movzbl (%esi),%ecx
+  800382:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800385:	3c 55                	cmp    $0x55,%al
+  800387:	0f 87 3b 04 00 00    	ja     8007c8 <vprintfmt+0x4aa>
+  80038d:	0f b6 c0             	movzbl %al,%eax
+  800390:	ff 24 85 20 36 80 00 	jmp    *0x803620(,%eax,4)
+  800397:	89 75 10             	mov    %esi,0x10(%ebp)
+  80039a:	eb 93                	jmp    80032f <vprintfmt+0x11>
+  80039c:	89 d6                	mov    %edx,%esi
+  80039e:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003a2:	eb d8                	jmp    80037c <vprintfmt+0x5e>
+  8003a4:	89 d6                	mov    %edx,%esi
+  8003a6:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003aa:	eb d0                	jmp    80037c <vprintfmt+0x5e>
+  8003ac:	0f b6 c9             	movzbl %cl,%ecx
+  8003af:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003b2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003b5:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003b9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003bc:	83 f9 09             	cmp    $0x9,%ecx
+  8003bf:	77 6f                	ja     800430 <vprintfmt+0x112>
+  8003c1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003c4:	83 c2 01             	add    $0x1,%edx
+  8003c7:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003ca:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003ce:	0f be 02             	movsbl (%edx),%eax
+  8003d1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003d4:	83 fe 09             	cmp    $0x9,%esi
+  8003d7:	76 eb                	jbe    8003c4 <vprintfmt+0xa6>
+  8003d9:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8003dc:	89 d6                	mov    %edx,%esi
+  8003de:	eb 13                	jmp    8003f3 <vprintfmt+0xd5>
+  8003e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e3:	8b 00                	mov    (%eax),%eax
+  8003e5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003f1:	89 d6                	mov    %edx,%esi
+  8003f3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003f7:	79 83                	jns    80037c <vprintfmt+0x5e>
+  8003f9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ff:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800406:	e9 71 ff ff ff       	jmp    80037c <vprintfmt+0x5e>
+  80040b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040e:	85 c9                	test   %ecx,%ecx
+  800410:	b8 00 00 00 00       	mov    $0x0,%eax
+  800415:	0f 49 c1             	cmovns %ecx,%eax
+  800418:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80041b:	89 d6                	mov    %edx,%esi
+  80041d:	e9 5a ff ff ff       	jmp    80037c <vprintfmt+0x5e>
+  800422:	89 d6                	mov    %edx,%esi
+  800424:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80042b:	e9 4c ff ff ff       	jmp    80037c <vprintfmt+0x5e>
+  800430:	89 d6                	mov    %edx,%esi
+  800432:	eb bf                	jmp    8003f3 <vprintfmt+0xd5>
+  800434:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800438:	89 d6                	mov    %edx,%esi
+  80043a:	e9 3d ff ff ff       	jmp    80037c <vprintfmt+0x5e>
+  80043f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800442:	8b 45 14             	mov    0x14(%ebp),%eax
+  800445:	8d 70 04             	lea    0x4(%eax),%esi
+  800448:	83 ec 08             	sub    $0x8,%esp
+  80044b:	53                   	push   %ebx
+  80044c:	ff 30                	push   (%eax)
+  80044e:	ff d7                	call   *%edi
+  800450:	83 c4 10             	add    $0x10,%esp
+  800453:	89 75 14             	mov    %esi,0x14(%ebp)
+  800456:	e9 d4 fe ff ff       	jmp    80032f <vprintfmt+0x11>
+  80045b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80045e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800461:	8d 70 04             	lea    0x4(%eax),%esi
+  800464:	8b 10                	mov    (%eax),%edx
+  800466:	89 d0                	mov    %edx,%eax
+  800468:	f7 d8                	neg    %eax
+  80046a:	0f 48 c2             	cmovs  %edx,%eax
+  80046d:	83 f8 12             	cmp    $0x12,%eax
+  800470:	7f 23                	jg     800495 <vprintfmt+0x177>
+  800472:	8b 14 85 80 37 80 00 	mov    0x803780(,%eax,4),%edx
+  800479:	85 d2                	test   %edx,%edx
+  80047b:	74 18                	je     800495 <vprintfmt+0x177>
+  80047d:	52                   	push   %edx
+  80047e:	68 db 38 80 00       	push   $0x8038db
+  800483:	53                   	push   %ebx
+  800484:	57                   	push   %edi
+  800485:	e8 77 fe ff ff       	call   800301 <printfmt>
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	89 75 14             	mov    %esi,0x14(%ebp)
+  800490:	e9 9a fe ff ff       	jmp    80032f <vprintfmt+0x11>
+  800495:	50                   	push   %eax
+  800496:	68 fe 34 80 00       	push   $0x8034fe
+  80049b:	53                   	push   %ebx
+  80049c:	57                   	push   %edi
+  80049d:	e8 5f fe ff ff       	call   800301 <printfmt>
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004a8:	e9 82 fe ff ff       	jmp    80032f <vprintfmt+0x11>
+  8004ad:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	83 c0 04             	add    $0x4,%eax
+  8004b6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bc:	8b 00                	mov    (%eax),%eax
+  8004be:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c1:	85 c0                	test   %eax,%eax
+  8004c3:	0f 84 61 03 00 00    	je     80082a <vprintfmt+0x50c>
+  8004c9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004cd:	7e 06                	jle    8004d5 <vprintfmt+0x1b7>
+  8004cf:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004d3:	75 29                	jne    8004fe <vprintfmt+0x1e0>
+  8004d5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004d8:	8d 70 01             	lea    0x1(%eax),%esi
+  8004db:	0f b6 00             	movzbl (%eax),%eax
+  8004de:	0f be d0             	movsbl %al,%edx
+  8004e1:	85 d2                	test   %edx,%edx
+  8004e3:	0f 84 bb 00 00 00    	je     8005a4 <vprintfmt+0x286>
+  8004e9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004ec:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004ef:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004f2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004f5:	eb 7a                	jmp    800571 <vprintfmt+0x253>
+  8004f7:	c7 45 d0 f7 34 80 00 	movl   $0x8034f7,-0x30(%ebp)
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	ff 75 d4             	push   -0x2c(%ebp)
+  800504:	ff 75 d0             	push   -0x30(%ebp)
+  800507:	e8 e0 03 00 00       	call   8008ec <strnlen>
+  80050c:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80050f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800512:	83 c4 10             	add    $0x10,%esp
+  800515:	85 d2                	test   %edx,%edx
+  800517:	0f 8e d6 02 00 00    	jle    8007f3 <vprintfmt+0x4d5>
+  80051d:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800521:	83 ec 08             	sub    $0x8,%esp
+  800524:	53                   	push   %ebx
+  800525:	56                   	push   %esi
+  800526:	ff d7                	call   *%edi
+  800528:	83 c4 10             	add    $0x10,%esp
+  80052b:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80052f:	75 f0                	jne    800521 <vprintfmt+0x203>
+  800531:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800534:	8d 70 01             	lea    0x1(%eax),%esi
+  800537:	0f b6 00             	movzbl (%eax),%eax
+  80053a:	0f be d0             	movsbl %al,%edx
+  80053d:	85 d2                	test   %edx,%edx
+  80053f:	0f 84 da 02 00 00    	je     80081f <vprintfmt+0x501>
+  800545:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800548:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80054b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80054e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800551:	eb 1e                	jmp    800571 <vprintfmt+0x253>
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	ff 75 0c             	push   0xc(%ebp)
+  800559:	52                   	push   %edx
+  80055a:	ff 55 08             	call   *0x8(%ebp)
+  80055d:	83 c4 10             	add    $0x10,%esp
+  800560:	83 eb 01             	sub    $0x1,%ebx
+  800563:	83 c6 01             	add    $0x1,%esi
+  800566:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056a:	0f be d0             	movsbl %al,%edx
+  80056d:	85 d2                	test   %edx,%edx
+  80056f:	74 2a                	je     80059b <vprintfmt+0x27d>
+  800571:	85 ff                	test   %edi,%edi
+  800573:	78 05                	js     80057a <vprintfmt+0x25c>
+  800575:	83 ef 01             	sub    $0x1,%edi
+  800578:	78 59                	js     8005d3 <vprintfmt+0x2b5>
+  80057a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057e:	74 d3                	je     800553 <vprintfmt+0x235>
+  800580:	0f be c0             	movsbl %al,%eax
+  800583:	83 e8 20             	sub    $0x20,%eax
+  800586:	83 f8 5e             	cmp    $0x5e,%eax
+  800589:	76 c8                	jbe    800553 <vprintfmt+0x235>
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	ff 75 0c             	push   0xc(%ebp)
+  800591:	6a 3f                	push   $0x3f
+  800593:	ff 55 08             	call   *0x8(%ebp)
+  800596:	83 c4 10             	add    $0x10,%esp
+  800599:	eb c5                	jmp    800560 <vprintfmt+0x242>
+  80059b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80059e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005a4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005a7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005ab:	7e 1b                	jle    8005c8 <vprintfmt+0x2aa>
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	53                   	push   %ebx
+  8005b1:	6a 20                	push   $0x20
+  8005b3:	ff d7                	call   *%edi
+  8005b5:	83 c4 10             	add    $0x10,%esp
+  8005b8:	83 ee 01             	sub    $0x1,%esi
+  8005bb:	75 f0                	jne    8005ad <vprintfmt+0x28f>
+  8005bd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c3:	e9 67 fd ff ff       	jmp    80032f <vprintfmt+0x11>
+  8005c8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ce:	e9 5c fd ff ff       	jmp    80032f <vprintfmt+0x11>
+  8005d3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005d6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005dc:	eb c6                	jmp    8005a4 <vprintfmt+0x286>
+  8005de:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005e1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e4:	83 f9 01             	cmp    $0x1,%ecx
+  8005e7:	7f 1f                	jg     800608 <vprintfmt+0x2ea>
+  8005e9:	85 c9                	test   %ecx,%ecx
+  8005eb:	74 67                	je     800654 <vprintfmt+0x336>
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8b 30                	mov    (%eax),%esi
+  8005f2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005f5:	89 f0                	mov    %esi,%eax
+  8005f7:	c1 f8 1f             	sar    $0x1f,%eax
+  8005fa:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800600:	8d 40 04             	lea    0x4(%eax),%eax
+  800603:	89 45 14             	mov    %eax,0x14(%ebp)
+  800606:	eb 17                	jmp    80061f <vprintfmt+0x301>
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 50 04             	mov    0x4(%eax),%edx
+  80060e:	8b 00                	mov    (%eax),%eax
+  800610:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800613:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8d 40 08             	lea    0x8(%eax),%eax
+  80061c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800622:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800625:	be 0a 00 00 00       	mov    $0xa,%esi
+  80062a:	85 c9                	test   %ecx,%ecx
+  80062c:	0f 89 12 01 00 00    	jns    800744 <vprintfmt+0x426>
+  800632:	83 ec 08             	sub    $0x8,%esp
+  800635:	53                   	push   %ebx
+  800636:	6a 2d                	push   $0x2d
+  800638:	ff d7                	call   *%edi
+  80063a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800640:	f7 da                	neg    %edx
+  800642:	83 d1 00             	adc    $0x0,%ecx
+  800645:	f7 d9                	neg    %ecx
+  800647:	83 c4 10             	add    $0x10,%esp
+  80064a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80064f:	e9 f0 00 00 00       	jmp    800744 <vprintfmt+0x426>
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 30                	mov    (%eax),%esi
+  800659:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80065c:	89 f0                	mov    %esi,%eax
+  80065e:	c1 f8 1f             	sar    $0x1f,%eax
+  800661:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8d 40 04             	lea    0x4(%eax),%eax
+  80066a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066d:	eb b0                	jmp    80061f <vprintfmt+0x301>
+  80066f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800672:	89 55 10             	mov    %edx,0x10(%ebp)
+  800675:	83 f9 01             	cmp    $0x1,%ecx
+  800678:	7f 1e                	jg     800698 <vprintfmt+0x37a>
+  80067a:	85 c9                	test   %ecx,%ecx
+  80067c:	74 32                	je     8006b0 <vprintfmt+0x392>
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8b 10                	mov    (%eax),%edx
+  800683:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800688:	8d 40 04             	lea    0x4(%eax),%eax
+  80068b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800693:	e9 ac 00 00 00       	jmp    800744 <vprintfmt+0x426>
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006ab:	e9 94 00 00 00       	jmp    800744 <vprintfmt+0x426>
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8b 10                	mov    (%eax),%edx
+  8006b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c0:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006c5:	eb 7d                	jmp    800744 <vprintfmt+0x426>
+  8006c7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006ca:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006cd:	83 f9 01             	cmp    $0x1,%ecx
+  8006d0:	7f 1b                	jg     8006ed <vprintfmt+0x3cf>
+  8006d2:	85 c9                	test   %ecx,%ecx
+  8006d4:	74 2c                	je     800702 <vprintfmt+0x3e4>
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 10                	mov    (%eax),%edx
+  8006db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e6:	be 08 00 00 00       	mov    $0x8,%esi
+  8006eb:	eb 57                	jmp    800744 <vprintfmt+0x426>
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fb:	be 08 00 00 00       	mov    $0x8,%esi
+  800700:	eb 42                	jmp    800744 <vprintfmt+0x426>
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800712:	be 08 00 00 00       	mov    $0x8,%esi
+  800717:	eb 2b                	jmp    800744 <vprintfmt+0x426>
+  800719:	89 55 10             	mov    %edx,0x10(%ebp)
+  80071c:	83 ec 08             	sub    $0x8,%esp
+  80071f:	53                   	push   %ebx
+  800720:	6a 30                	push   $0x30
+  800722:	ff d7                	call   *%edi
+  800724:	83 c4 08             	add    $0x8,%esp
+  800727:	53                   	push   %ebx
+  800728:	6a 78                	push   $0x78
+  80072a:	ff d7                	call   *%edi
+  80072c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072f:	8b 10                	mov    (%eax),%edx
+  800731:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800736:	83 c4 10             	add    $0x10,%esp
+  800739:	8d 40 04             	lea    0x4(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073f:	be 10 00 00 00       	mov    $0x10,%esi
+  800744:	83 ec 0c             	sub    $0xc,%esp
+  800747:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80074b:	50                   	push   %eax
+  80074c:	ff 75 e4             	push   -0x1c(%ebp)
+  80074f:	56                   	push   %esi
+  800750:	51                   	push   %ecx
+  800751:	52                   	push   %edx
+  800752:	89 da                	mov    %ebx,%edx
+  800754:	89 f8                	mov    %edi,%eax
+  800756:	e8 d8 fa ff ff       	call   800233 <printnum>
+  80075b:	83 c4 20             	add    $0x20,%esp
+  80075e:	e9 cc fb ff ff       	jmp    80032f <vprintfmt+0x11>
+  800763:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800766:	89 55 10             	mov    %edx,0x10(%ebp)
+  800769:	83 f9 01             	cmp    $0x1,%ecx
+  80076c:	7f 1b                	jg     800789 <vprintfmt+0x46b>
+  80076e:	85 c9                	test   %ecx,%ecx
+  800770:	74 2c                	je     80079e <vprintfmt+0x480>
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 10                	mov    (%eax),%edx
+  800777:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077c:	8d 40 04             	lea    0x4(%eax),%eax
+  80077f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800782:	be 10 00 00 00       	mov    $0x10,%esi
+  800787:	eb bb                	jmp    800744 <vprintfmt+0x426>
+  800789:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078c:	8b 10                	mov    (%eax),%edx
+  80078e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800791:	8d 40 08             	lea    0x8(%eax),%eax
+  800794:	89 45 14             	mov    %eax,0x14(%ebp)
+  800797:	be 10 00 00 00       	mov    $0x10,%esi
+  80079c:	eb a6                	jmp    800744 <vprintfmt+0x426>
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8b 10                	mov    (%eax),%edx
+  8007a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ae:	be 10 00 00 00       	mov    $0x10,%esi
+  8007b3:	eb 8f                	jmp    800744 <vprintfmt+0x426>
+  8007b5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+  8007bb:	53                   	push   %ebx
+  8007bc:	6a 25                	push   $0x25
+  8007be:	ff d7                	call   *%edi
+  8007c0:	83 c4 10             	add    $0x10,%esp
+  8007c3:	e9 67 fb ff ff       	jmp    80032f <vprintfmt+0x11>
+  8007c8:	83 ec 08             	sub    $0x8,%esp
+  8007cb:	53                   	push   %ebx
+  8007cc:	6a 25                	push   $0x25
+  8007ce:	ff d7                	call   *%edi
+  8007d0:	83 c4 10             	add    $0x10,%esp
+  8007d3:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007d7:	0f 84 ba fb ff ff    	je     800397 <vprintfmt+0x79>
+  8007dd:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007e0:	89 f0                	mov    %esi,%eax
+  8007e2:	83 e8 01             	sub    $0x1,%eax
+  8007e5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007e9:	75 f7                	jne    8007e2 <vprintfmt+0x4c4>
+  8007eb:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007ee:	e9 3c fb ff ff       	jmp    80032f <vprintfmt+0x11>
+  8007f3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007f6:	8d 70 01             	lea    0x1(%eax),%esi
+  8007f9:	0f b6 00             	movzbl (%eax),%eax
+  8007fc:	0f be d0             	movsbl %al,%edx
+  8007ff:	85 d2                	test   %edx,%edx
+  800801:	74 11                	je     800814 <vprintfmt+0x4f6>
+  800803:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800806:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800809:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80080c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80080f:	e9 5d fd ff ff       	jmp    800571 <vprintfmt+0x253>
+  800814:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800817:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081a:	e9 10 fb ff ff       	jmp    80032f <vprintfmt+0x11>
+  80081f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+  800825:	e9 05 fb ff ff       	jmp    80032f <vprintfmt+0x11>
+  80082a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80082e:	7e 0a                	jle    80083a <vprintfmt+0x51c>
+  800830:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800834:	0f 85 bd fc ff ff    	jne    8004f7 <vprintfmt+0x1d9>
+  80083a:	ba 28 00 00 00       	mov    $0x28,%edx
+  80083f:	b8 28 00 00 00       	mov    $0x28,%eax
+  800844:	be f8 34 80 00       	mov    $0x8034f8,%esi
+  800849:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80084c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80084f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800852:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800855:	e9 17 fd ff ff       	jmp    800571 <vprintfmt+0x253>
+  80085a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80085d:	5b                   	pop    %ebx
+  80085e:	5e                   	pop    %esi
+  80085f:	5f                   	pop    %edi
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+
+00800862 <vsnprintf>:
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	83 ec 18             	sub    $0x18,%esp
+  800868:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80086e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800871:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800875:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800878:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80087f:	85 c0                	test   %eax,%eax
+  800881:	74 26                	je     8008a9 <vsnprintf+0x47>
+  800883:	85 d2                	test   %edx,%edx
+  800885:	7e 22                	jle    8008a9 <vsnprintf+0x47>
+  800887:	ff 75 14             	push   0x14(%ebp)
+  80088a:	ff 75 10             	push   0x10(%ebp)
+  80088d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800890:	50                   	push   %eax
+  800891:	68 e4 02 80 00       	push   $0x8002e4
+  800896:	e8 83 fa ff ff       	call   80031e <vprintfmt>
+  80089b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80089e:	c6 00 00             	movb   $0x0,(%eax)
+  8008a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a4:	83 c4 10             	add    $0x10,%esp
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+  8008a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008ae:	eb f7                	jmp    8008a7 <vsnprintf+0x45>
+
+008008b0 <snprintf>:
+  8008b0:	55                   	push   %ebp
+  8008b1:	89 e5                	mov    %esp,%ebp
+  8008b3:	83 ec 08             	sub    $0x8,%esp
+  8008b6:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008b9:	50                   	push   %eax
+  8008ba:	ff 75 10             	push   0x10(%ebp)
+  8008bd:	ff 75 0c             	push   0xc(%ebp)
+  8008c0:	ff 75 08             	push   0x8(%ebp)
+  8008c3:	e8 9a ff ff ff       	call   800862 <vsnprintf>
+  8008c8:	c9                   	leave
+  8008c9:	c3                   	ret
+
+008008ca <strlen>:
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008d0:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008d3:	74 10                	je     8008e5 <strlen+0x1b>
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	83 c0 01             	add    $0x1,%eax
+  8008dd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008e1:	75 f7                	jne    8008da <strlen+0x10>
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+  8008e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ea:	eb f7                	jmp    8008e3 <strlen+0x19>
+
+008008ec <strnlen>:
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f5:	85 d2                	test   %edx,%edx
+  8008f7:	74 16                	je     80090f <strnlen+0x23>
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800902:	74 09                	je     80090d <strnlen+0x21>
+  800904:	83 c0 01             	add    $0x1,%eax
+  800907:	39 d0                	cmp    %edx,%eax
+  800909:	75 f3                	jne    8008fe <strnlen+0x12>
+  80090b:	89 d0                	mov    %edx,%eax
+  80090d:	5d                   	pop    %ebp
+  80090e:	c3                   	ret
+  80090f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800914:	eb f7                	jmp    80090d <strnlen+0x21>
+
+00800916 <strcpy>:
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	53                   	push   %ebx
+  80091a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800920:	b8 00 00 00 00       	mov    $0x0,%eax
+  800925:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800929:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80092c:	83 c0 01             	add    $0x1,%eax
+  80092f:	84 d2                	test   %dl,%dl
+  800931:	75 f2                	jne    800925 <strcpy+0xf>
+  800933:	89 c8                	mov    %ecx,%eax
+  800935:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800938:	c9                   	leave
+  800939:	c3                   	ret
+
+0080093a <strcat>:
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	53                   	push   %ebx
+  80093e:	83 ec 10             	sub    $0x10,%esp
+  800941:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800944:	53                   	push   %ebx
+  800945:	e8 80 ff ff ff       	call   8008ca <strlen>
+  80094a:	83 c4 08             	add    $0x8,%esp
+  80094d:	ff 75 0c             	push   0xc(%ebp)
+  800950:	01 d8                	add    %ebx,%eax
+  800952:	50                   	push   %eax
+  800953:	e8 be ff ff ff       	call   800916 <strcpy>
+  800958:	89 d8                	mov    %ebx,%eax
+  80095a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095d:	c9                   	leave
+  80095e:	c3                   	ret
+
+0080095f <strncpy>:
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	56                   	push   %esi
+  800963:	53                   	push   %ebx
+  800964:	8b 75 08             	mov    0x8(%ebp),%esi
+  800967:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80096a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80096d:	85 db                	test   %ebx,%ebx
+  80096f:	74 17                	je     800988 <strncpy+0x29>
+  800971:	01 f3                	add    %esi,%ebx
+  800973:	89 f0                	mov    %esi,%eax
+  800975:	83 c0 01             	add    $0x1,%eax
+  800978:	0f b6 0a             	movzbl (%edx),%ecx
+  80097b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80097e:	80 f9 01             	cmp    $0x1,%cl
+  800981:	83 da ff             	sbb    $0xffffffff,%edx
+  800984:	39 c3                	cmp    %eax,%ebx
+  800986:	75 ed                	jne    800975 <strncpy+0x16>
+  800988:	89 f0                	mov    %esi,%eax
+  80098a:	5b                   	pop    %ebx
+  80098b:	5e                   	pop    %esi
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <strlcpy>:
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	56                   	push   %esi
+  800992:	53                   	push   %ebx
+  800993:	8b 75 08             	mov    0x8(%ebp),%esi
+  800996:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800999:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80099c:	89 f0                	mov    %esi,%eax
+  80099e:	85 db                	test   %ebx,%ebx
+  8009a0:	74 1e                	je     8009c0 <strlcpy+0x32>
+  8009a2:	83 eb 01             	sub    $0x1,%ebx
+  8009a5:	74 16                	je     8009bd <strlcpy+0x2f>
+  8009a7:	01 f3                	add    %esi,%ebx
+  8009a9:	0f b6 0a             	movzbl (%edx),%ecx
+  8009ac:	84 c9                	test   %cl,%cl
+  8009ae:	74 0d                	je     8009bd <strlcpy+0x2f>
+  8009b0:	83 c2 01             	add    $0x1,%edx
+  8009b3:	83 c0 01             	add    $0x1,%eax
+  8009b6:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009b9:	39 d8                	cmp    %ebx,%eax
+  8009bb:	75 ec                	jne    8009a9 <strlcpy+0x1b>
+  8009bd:	c6 00 00             	movb   $0x0,(%eax)
+  8009c0:	29 f0                	sub    %esi,%eax
+  8009c2:	5b                   	pop    %ebx
+  8009c3:	5e                   	pop    %esi
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <strcmp>:
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009cf:	0f b6 01             	movzbl (%ecx),%eax
+  8009d2:	84 c0                	test   %al,%al
+  8009d4:	74 11                	je     8009e7 <strcmp+0x21>
+  8009d6:	38 02                	cmp    %al,(%edx)
+  8009d8:	75 0d                	jne    8009e7 <strcmp+0x21>
+  8009da:	83 c1 01             	add    $0x1,%ecx
+  8009dd:	83 c2 01             	add    $0x1,%edx
+  8009e0:	0f b6 01             	movzbl (%ecx),%eax
+  8009e3:	84 c0                	test   %al,%al
+  8009e5:	75 ef                	jne    8009d6 <strcmp+0x10>
+  8009e7:	0f b6 c0             	movzbl %al,%eax
+  8009ea:	0f b6 12             	movzbl (%edx),%edx
+  8009ed:	29 d0                	sub    %edx,%eax
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+
+008009f1 <strncmp>:
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	53                   	push   %ebx
+  8009f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009fb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a03:	85 d2                	test   %edx,%edx
+  800a05:	74 2e                	je     800a35 <strncmp+0x44>
+  800a07:	0f b6 01             	movzbl (%ecx),%eax
+  800a0a:	84 c0                	test   %al,%al
+  800a0c:	74 16                	je     800a24 <strncmp+0x33>
+  800a0e:	3a 03                	cmp    (%ebx),%al
+  800a10:	75 12                	jne    800a24 <strncmp+0x33>
+  800a12:	83 c1 01             	add    $0x1,%ecx
+  800a15:	83 c3 01             	add    $0x1,%ebx
+  800a18:	83 ea 01             	sub    $0x1,%edx
+  800a1b:	75 ea                	jne    800a07 <strncmp+0x16>
+  800a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a22:	eb 11                	jmp    800a35 <strncmp+0x44>
+  800a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a29:	85 d2                	test   %edx,%edx
+  800a2b:	74 08                	je     800a35 <strncmp+0x44>
+  800a2d:	0f b6 01             	movzbl (%ecx),%eax
+  800a30:	0f b6 13             	movzbl (%ebx),%edx
+  800a33:	29 d0                	sub    %edx,%eax
+  800a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a38:	c9                   	leave
+  800a39:	c3                   	ret
+
+00800a3a <strchr>:
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a40:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a44:	0f b6 10             	movzbl (%eax),%edx
+  800a47:	84 d2                	test   %dl,%dl
+  800a49:	74 15                	je     800a60 <strchr+0x26>
+  800a4b:	38 d1                	cmp    %dl,%cl
+  800a4d:	74 0f                	je     800a5e <strchr+0x24>
+  800a4f:	83 c0 01             	add    $0x1,%eax
+  800a52:	0f b6 10             	movzbl (%eax),%edx
+  800a55:	84 d2                	test   %dl,%dl
+  800a57:	75 f2                	jne    800a4b <strchr+0x11>
+  800a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5e:	5d                   	pop    %ebp
+  800a5f:	c3                   	ret
+  800a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a65:	eb f7                	jmp    800a5e <strchr+0x24>
+
+00800a67 <strfind>:
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	53                   	push   %ebx
+  800a6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a71:	0f b6 18             	movzbl (%eax),%ebx
+  800a74:	38 d3                	cmp    %dl,%bl
+  800a76:	74 14                	je     800a8c <strfind+0x25>
+  800a78:	89 d1                	mov    %edx,%ecx
+  800a7a:	84 db                	test   %bl,%bl
+  800a7c:	74 0e                	je     800a8c <strfind+0x25>
+  800a7e:	83 c0 01             	add    $0x1,%eax
+  800a81:	0f b6 10             	movzbl (%eax),%edx
+  800a84:	38 ca                	cmp    %cl,%dl
+  800a86:	74 04                	je     800a8c <strfind+0x25>
+  800a88:	84 d2                	test   %dl,%dl
+  800a8a:	75 f2                	jne    800a7e <strfind+0x17>
+  800a8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8f:	c9                   	leave
+  800a90:	c3                   	ret
+
+00800a91 <memset>:
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	57                   	push   %edi
+  800a95:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a98:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a9b:	85 c9                	test   %ecx,%ecx
+  800a9d:	74 20                	je     800abf <memset+0x2e>
+  800a9f:	89 f8                	mov    %edi,%eax
+  800aa1:	09 c8                	or     %ecx,%eax
+  800aa3:	a8 03                	test   $0x3,%al
+  800aa5:	75 12                	jne    800ab9 <memset+0x28>
+  800aa7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aab:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ab1:	c1 e9 02             	shr    $0x2,%ecx
+  800ab4:	fc                   	cld
+  800ab5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ab7:	eb 06                	jmp    800abf <memset+0x2e>
+  800ab9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800abc:	fc                   	cld
+  800abd:	f3 aa                	rep stos %al,%es:(%edi)
+  800abf:	89 f8                	mov    %edi,%eax
+  800ac1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ac4:	c9                   	leave
+  800ac5:	c3                   	ret
+
+00800ac6 <memmove>:
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	57                   	push   %edi
+  800aca:	56                   	push   %esi
+  800acb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ace:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ad1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ad4:	39 c6                	cmp    %eax,%esi
+  800ad6:	73 32                	jae    800b0a <memmove+0x44>
+  800ad8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800adb:	39 d0                	cmp    %edx,%eax
+  800add:	73 2b                	jae    800b0a <memmove+0x44>
+  800adf:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800ae2:	89 d6                	mov    %edx,%esi
+  800ae4:	09 fe                	or     %edi,%esi
+  800ae6:	09 ce                	or     %ecx,%esi
+  800ae8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aee:	75 0e                	jne    800afe <memmove+0x38>
+  800af0:	83 ef 04             	sub    $0x4,%edi
+  800af3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800af6:	c1 e9 02             	shr    $0x2,%ecx
+  800af9:	fd                   	std
+  800afa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800afc:	eb 09                	jmp    800b07 <memmove+0x41>
+  800afe:	83 ef 01             	sub    $0x1,%edi
+  800b01:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b04:	fd                   	std
+  800b05:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b07:	fc                   	cld
+  800b08:	eb 1a                	jmp    800b24 <memmove+0x5e>
+  800b0a:	89 f2                	mov    %esi,%edx
+  800b0c:	09 c2                	or     %eax,%edx
+  800b0e:	09 ca                	or     %ecx,%edx
+  800b10:	f6 c2 03             	test   $0x3,%dl
+  800b13:	75 0a                	jne    800b1f <memmove+0x59>
+  800b15:	c1 e9 02             	shr    $0x2,%ecx
+  800b18:	89 c7                	mov    %eax,%edi
+  800b1a:	fc                   	cld
+  800b1b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b1d:	eb 05                	jmp    800b24 <memmove+0x5e>
+  800b1f:	89 c7                	mov    %eax,%edi
+  800b21:	fc                   	cld
+  800b22:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b24:	5e                   	pop    %esi
+  800b25:	5f                   	pop    %edi
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+
+00800b28 <memcpy>:
+  800b28:	55                   	push   %ebp
+  800b29:	89 e5                	mov    %esp,%ebp
+  800b2b:	83 ec 0c             	sub    $0xc,%esp
+  800b2e:	ff 75 10             	push   0x10(%ebp)
+  800b31:	ff 75 0c             	push   0xc(%ebp)
+  800b34:	ff 75 08             	push   0x8(%ebp)
+  800b37:	e8 8a ff ff ff       	call   800ac6 <memmove>
+  800b3c:	c9                   	leave
+  800b3d:	c3                   	ret
+
+00800b3e <memcmp>:
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	56                   	push   %esi
+  800b42:	53                   	push   %ebx
+  800b43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b49:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b4c:	85 f6                	test   %esi,%esi
+  800b4e:	74 29                	je     800b79 <memcmp+0x3b>
+  800b50:	01 c6                	add    %eax,%esi
+  800b52:	0f b6 08             	movzbl (%eax),%ecx
+  800b55:	0f b6 1a             	movzbl (%edx),%ebx
+  800b58:	38 d9                	cmp    %bl,%cl
+  800b5a:	75 11                	jne    800b6d <memcmp+0x2f>
+  800b5c:	83 c0 01             	add    $0x1,%eax
+  800b5f:	83 c2 01             	add    $0x1,%edx
+  800b62:	39 c6                	cmp    %eax,%esi
+  800b64:	75 ec                	jne    800b52 <memcmp+0x14>
+  800b66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6b:	eb 08                	jmp    800b75 <memcmp+0x37>
+  800b6d:	0f b6 c1             	movzbl %cl,%eax
+  800b70:	0f b6 db             	movzbl %bl,%ebx
+  800b73:	29 d8                	sub    %ebx,%eax
+  800b75:	5b                   	pop    %ebx
+  800b76:	5e                   	pop    %esi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+  800b79:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7e:	eb f5                	jmp    800b75 <memcmp+0x37>
+
+00800b80 <memfind>:
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b89:	89 c2                	mov    %eax,%edx
+  800b8b:	03 55 10             	add    0x10(%ebp),%edx
+  800b8e:	39 d0                	cmp    %edx,%eax
+  800b90:	73 0d                	jae    800b9f <memfind+0x1f>
+  800b92:	38 08                	cmp    %cl,(%eax)
+  800b94:	74 0d                	je     800ba3 <memfind+0x23>
+  800b96:	83 c0 01             	add    $0x1,%eax
+  800b99:	39 c2                	cmp    %eax,%edx
+  800b9b:	75 f5                	jne    800b92 <memfind+0x12>
+  800b9d:	eb 06                	jmp    800ba5 <memfind+0x25>
+  800b9f:	89 c2                	mov    %eax,%edx
+  800ba1:	eb 02                	jmp    800ba5 <memfind+0x25>
+  800ba3:	89 c2                	mov    %eax,%edx
+  800ba5:	89 d0                	mov    %edx,%eax
+  800ba7:	5d                   	pop    %ebp
+  800ba8:	c3                   	ret
+
+00800ba9 <strtol>:
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	57                   	push   %edi
+  800bad:	56                   	push   %esi
+  800bae:	53                   	push   %ebx
+  800baf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb5:	0f b6 02             	movzbl (%edx),%eax
+  800bb8:	3c 20                	cmp    $0x20,%al
+  800bba:	74 04                	je     800bc0 <strtol+0x17>
+  800bbc:	3c 09                	cmp    $0x9,%al
+  800bbe:	75 0e                	jne    800bce <strtol+0x25>
+  800bc0:	83 c2 01             	add    $0x1,%edx
+  800bc3:	0f b6 02             	movzbl (%edx),%eax
+  800bc6:	3c 20                	cmp    $0x20,%al
+  800bc8:	74 f6                	je     800bc0 <strtol+0x17>
+  800bca:	3c 09                	cmp    $0x9,%al
+  800bcc:	74 f2                	je     800bc0 <strtol+0x17>
+  800bce:	3c 2b                	cmp    $0x2b,%al
+  800bd0:	74 2a                	je     800bfc <strtol+0x53>
+  800bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd7:	3c 2d                	cmp    $0x2d,%al
+  800bd9:	74 2b                	je     800c06 <strtol+0x5d>
+  800bdb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800be1:	75 0f                	jne    800bf2 <strtol+0x49>
+  800be3:	80 3a 30             	cmpb   $0x30,(%edx)
+  800be6:	74 28                	je     800c10 <strtol+0x67>
+  800be8:	85 db                	test   %ebx,%ebx
+  800bea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bef:	0f 44 d8             	cmove  %eax,%ebx
+  800bf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bfa:	eb 46                	jmp    800c42 <strtol+0x99>
+  800bfc:	83 c2 01             	add    $0x1,%edx
+  800bff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c04:	eb d5                	jmp    800bdb <strtol+0x32>
+  800c06:	83 c2 01             	add    $0x1,%edx
+  800c09:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c0e:	eb cb                	jmp    800bdb <strtol+0x32>
+  800c10:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c14:	74 0e                	je     800c24 <strtol+0x7b>
+  800c16:	85 db                	test   %ebx,%ebx
+  800c18:	75 d8                	jne    800bf2 <strtol+0x49>
+  800c1a:	83 c2 01             	add    $0x1,%edx
+  800c1d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c22:	eb ce                	jmp    800bf2 <strtol+0x49>
+  800c24:	83 c2 02             	add    $0x2,%edx
+  800c27:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c2c:	eb c4                	jmp    800bf2 <strtol+0x49>
+  800c2e:	0f be c0             	movsbl %al,%eax
+  800c31:	83 e8 30             	sub    $0x30,%eax
+  800c34:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c37:	7d 3a                	jge    800c73 <strtol+0xca>
+  800c39:	83 c2 01             	add    $0x1,%edx
+  800c3c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c40:	01 c1                	add    %eax,%ecx
+  800c42:	0f b6 02             	movzbl (%edx),%eax
+  800c45:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c48:	89 f3                	mov    %esi,%ebx
+  800c4a:	80 fb 09             	cmp    $0x9,%bl
+  800c4d:	76 df                	jbe    800c2e <strtol+0x85>
+  800c4f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c52:	89 f3                	mov    %esi,%ebx
+  800c54:	80 fb 19             	cmp    $0x19,%bl
+  800c57:	77 08                	ja     800c61 <strtol+0xb8>
+  800c59:	0f be c0             	movsbl %al,%eax
+  800c5c:	83 e8 57             	sub    $0x57,%eax
+  800c5f:	eb d3                	jmp    800c34 <strtol+0x8b>
+  800c61:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c64:	89 f3                	mov    %esi,%ebx
+  800c66:	80 fb 19             	cmp    $0x19,%bl
+  800c69:	77 08                	ja     800c73 <strtol+0xca>
+  800c6b:	0f be c0             	movsbl %al,%eax
+  800c6e:	83 e8 37             	sub    $0x37,%eax
+  800c71:	eb c1                	jmp    800c34 <strtol+0x8b>
+  800c73:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c77:	74 05                	je     800c7e <strtol+0xd5>
+  800c79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c7c:	89 10                	mov    %edx,(%eax)
+  800c7e:	89 c8                	mov    %ecx,%eax
+  800c80:	f7 d8                	neg    %eax
+  800c82:	85 ff                	test   %edi,%edi
+  800c84:	0f 45 c8             	cmovne %eax,%ecx
+  800c87:	89 c8                	mov    %ecx,%eax
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+
+00800c8e <sys_cputs>:
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	57                   	push   %edi
+  800c92:	56                   	push   %esi
+  800c93:	53                   	push   %ebx
+  800c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9f:	89 c3                	mov    %eax,%ebx
+  800ca1:	89 c7                	mov    %eax,%edi
+  800ca3:	89 c6                	mov    %eax,%esi
+  800ca5:	cd 30                	int    $0x30
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5e                   	pop    %esi
+  800ca9:	5f                   	pop    %edi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <sys_cgetc>:
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	57                   	push   %edi
+  800cb0:	56                   	push   %esi
+  800cb1:	53                   	push   %ebx
+  800cb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbc:	89 d1                	mov    %edx,%ecx
+  800cbe:	89 d3                	mov    %edx,%ebx
+  800cc0:	89 d7                	mov    %edx,%edi
+  800cc2:	89 d6                	mov    %edx,%esi
+  800cc4:	cd 30                	int    $0x30
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+
+00800ccb <sys_env_destroy>:
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  800cd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce1:	89 cb                	mov    %ecx,%ebx
+  800ce3:	89 cf                	mov    %ecx,%edi
+  800ce5:	89 ce                	mov    %ecx,%esi
+  800ce7:	cd 30                	int    $0x30
+  800ce9:	85 c0                	test   %eax,%eax
+  800ceb:	7f 08                	jg     800cf5 <sys_env_destroy+0x2a>
+  800ced:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf0:	5b                   	pop    %ebx
+  800cf1:	5e                   	pop    %esi
+  800cf2:	5f                   	pop    %edi
+  800cf3:	5d                   	pop    %ebp
+  800cf4:	c3                   	ret
+  800cf5:	83 ec 0c             	sub    $0xc,%esp
+  800cf8:	50                   	push   %eax
+  800cf9:	6a 03                	push   $0x3
+  800cfb:	68 eb 37 80 00       	push   $0x8037eb
+  800d00:	6a 24                	push   $0x24
+  800d02:	68 08 38 80 00       	push   $0x803808
+  800d07:	e8 9a 22 00 00       	call   802fa6 <_panic>
+
+00800d0c <sys_getenvid>:
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	57                   	push   %edi
+  800d10:	56                   	push   %esi
+  800d11:	53                   	push   %ebx
+  800d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d17:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d1c:	89 d1                	mov    %edx,%ecx
+  800d1e:	89 d3                	mov    %edx,%ebx
+  800d20:	89 d7                	mov    %edx,%edi
+  800d22:	89 d6                	mov    %edx,%esi
+  800d24:	cd 30                	int    $0x30
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+
+00800d2b <sys_yield>:
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	57                   	push   %edi
+  800d2f:	56                   	push   %esi
+  800d30:	53                   	push   %ebx
+  800d31:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d38:	74 26                	je     800d60 <sys_yield+0x35>
+  800d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d44:	89 d1                	mov    %edx,%ecx
+  800d46:	89 d3                	mov    %edx,%ebx
+  800d48:	89 d7                	mov    %edx,%edi
+  800d4a:	6a 00                	push   $0x0
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	8d 35 57 0d 80 00    	lea    0x800d57,%esi
+  800d55:	0f 34                	sysenter
+  800d57:	5d                   	pop    %ebp
+  800d58:	83 c4 04             	add    $0x4,%esp
+  800d5b:	5b                   	pop    %ebx
+  800d5c:	5e                   	pop    %esi
+  800d5d:	5f                   	pop    %edi
+  800d5e:	5d                   	pop    %ebp
+  800d5f:	c3                   	ret
+  800d60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d65:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d6a:	89 d1                	mov    %edx,%ecx
+  800d6c:	89 d3                	mov    %edx,%ebx
+  800d6e:	89 d7                	mov    %edx,%edi
+  800d70:	89 d6                	mov    %edx,%esi
+  800d72:	cd 30                	int    $0x30
+  800d74:	eb e5                	jmp    800d5b <sys_yield+0x30>
+
+00800d76 <sys_page_alloc>:
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	57                   	push   %edi
+  800d7a:	56                   	push   %esi
+  800d7b:	53                   	push   %ebx
+  800d7c:	83 ec 0c             	sub    $0xc,%esp
+  800d7f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d92:	89 f7                	mov    %esi,%edi
+  800d94:	cd 30                	int    $0x30
+  800d96:	85 c0                	test   %eax,%eax
+  800d98:	7f 08                	jg     800da2 <sys_page_alloc+0x2c>
+  800d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	50                   	push   %eax
+  800da6:	6a 04                	push   $0x4
+  800da8:	68 eb 37 80 00       	push   $0x8037eb
+  800dad:	6a 24                	push   $0x24
+  800daf:	68 08 38 80 00       	push   $0x803808
+  800db4:	e8 ed 21 00 00       	call   802fa6 <_panic>
+
+00800db9 <sys_page_map>:
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	56                   	push   %esi
+  800dbe:	53                   	push   %ebx
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+  800dc2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800dc9:	74 33                	je     800dfe <sys_page_map+0x45>
+  800dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddc:	ff 75 18             	push   0x18(%ebp)
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	8d 35 ea 0d 80 00    	lea    0x800dea,%esi
+  800de8:	0f 34                	sysenter
+  800dea:	5d                   	pop    %ebp
+  800deb:	83 c4 04             	add    $0x4,%esp
+  800dee:	89 c2                	mov    %eax,%edx
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	7f 3d                	jg     800e31 <sys_page_map+0x78>
+  800df4:	89 d0                	mov    %edx,%eax
+  800df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df9:	5b                   	pop    %ebx
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5f                   	pop    %edi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+  800dfe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e0f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e12:	cd 30                	int    $0x30
+  800e14:	89 c2                	mov    %eax,%edx
+  800e16:	85 c0                	test   %eax,%eax
+  800e18:	7e da                	jle    800df4 <sys_page_map+0x3b>
+  800e1a:	83 ec 0c             	sub    $0xc,%esp
+  800e1d:	50                   	push   %eax
+  800e1e:	6a 05                	push   $0x5
+  800e20:	68 eb 37 80 00       	push   $0x8037eb
+  800e25:	6a 24                	push   $0x24
+  800e27:	68 08 38 80 00       	push   $0x803808
+  800e2c:	e8 75 21 00 00       	call   802fa6 <_panic>
+  800e31:	83 ec 0c             	sub    $0xc,%esp
+  800e34:	50                   	push   %eax
+  800e35:	6a 05                	push   $0x5
+  800e37:	68 eb 37 80 00       	push   $0x8037eb
+  800e3c:	6a 48                	push   $0x48
+  800e3e:	68 08 38 80 00       	push   $0x803808
+  800e43:	e8 5e 21 00 00       	call   802fa6 <_panic>
+
+00800e48 <sys_page_unmap>:
+  800e48:	55                   	push   %ebp
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	57                   	push   %edi
+  800e4c:	56                   	push   %esi
+  800e4d:	53                   	push   %ebx
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+  800e51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e61:	89 df                	mov    %ebx,%edi
+  800e63:	89 de                	mov    %ebx,%esi
+  800e65:	cd 30                	int    $0x30
+  800e67:	85 c0                	test   %eax,%eax
+  800e69:	7f 08                	jg     800e73 <sys_page_unmap+0x2b>
+  800e6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+  800e73:	83 ec 0c             	sub    $0xc,%esp
+  800e76:	50                   	push   %eax
+  800e77:	6a 06                	push   $0x6
+  800e79:	68 eb 37 80 00       	push   $0x8037eb
+  800e7e:	6a 24                	push   $0x24
+  800e80:	68 08 38 80 00       	push   $0x803808
+  800e85:	e8 1c 21 00 00       	call   802fa6 <_panic>
+
+00800e8a <sys_fork>:
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+  800e90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e95:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e9a:	89 d1                	mov    %edx,%ecx
+  800e9c:	89 d3                	mov    %edx,%ebx
+  800e9e:	89 d7                	mov    %edx,%edi
+  800ea0:	89 d6                	mov    %edx,%esi
+  800ea2:	cd 30                	int    $0x30
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5e                   	pop    %esi
+  800ea6:	5f                   	pop    %edi
+  800ea7:	5d                   	pop    %ebp
+  800ea8:	c3                   	ret
+
+00800ea9 <sys_env_set_status>:
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+  800eaf:	83 ec 0c             	sub    $0xc,%esp
+  800eb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec2:	89 df                	mov    %ebx,%edi
+  800ec4:	89 de                	mov    %ebx,%esi
+  800ec6:	cd 30                	int    $0x30
+  800ec8:	85 c0                	test   %eax,%eax
+  800eca:	7f 08                	jg     800ed4 <sys_env_set_status+0x2b>
+  800ecc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  800ed7:	50                   	push   %eax
+  800ed8:	6a 08                	push   $0x8
+  800eda:	68 eb 37 80 00       	push   $0x8037eb
+  800edf:	6a 24                	push   $0x24
+  800ee1:	68 08 38 80 00       	push   $0x803808
+  800ee6:	e8 bb 20 00 00       	call   802fa6 <_panic>
+
+00800eeb <sys_env_set_trapframe>:
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+  800ef1:	83 ec 0c             	sub    $0xc,%esp
+  800ef4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eff:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f04:	89 df                	mov    %ebx,%edi
+  800f06:	89 de                	mov    %ebx,%esi
+  800f08:	cd 30                	int    $0x30
+  800f0a:	85 c0                	test   %eax,%eax
+  800f0c:	7f 08                	jg     800f16 <sys_env_set_trapframe+0x2b>
+  800f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f11:	5b                   	pop    %ebx
+  800f12:	5e                   	pop    %esi
+  800f13:	5f                   	pop    %edi
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+  800f19:	50                   	push   %eax
+  800f1a:	6a 09                	push   $0x9
+  800f1c:	68 eb 37 80 00       	push   $0x8037eb
+  800f21:	6a 24                	push   $0x24
+  800f23:	68 08 38 80 00       	push   $0x803808
+  800f28:	e8 79 20 00 00       	call   802fa6 <_panic>
+
+00800f2d <sys_env_set_cow>:
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	57                   	push   %edi
+  800f31:	56                   	push   %esi
+  800f32:	53                   	push   %ebx
+  800f33:	83 ec 0c             	sub    $0xc,%esp
+  800f36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f41:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f46:	89 df                	mov    %ebx,%edi
+  800f48:	89 de                	mov    %ebx,%esi
+  800f4a:	cd 30                	int    $0x30
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	7f 08                	jg     800f58 <sys_env_set_cow+0x2b>
+  800f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+  800f5b:	50                   	push   %eax
+  800f5c:	6a 20                	push   $0x20
+  800f5e:	68 eb 37 80 00       	push   $0x8037eb
+  800f63:	6a 24                	push   $0x24
+  800f65:	68 08 38 80 00       	push   $0x803808
+  800f6a:	e8 37 20 00 00       	call   802fa6 <_panic>
+
+00800f6f <sys_env_service>:
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	57                   	push   %edi
+  800f73:	56                   	push   %esi
+  800f74:	53                   	push   %ebx
+  800f75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7d:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f82:	89 cb                	mov    %ecx,%ebx
+  800f84:	89 cf                	mov    %ecx,%edi
+  800f86:	89 ce                	mov    %ecx,%esi
+  800f88:	cd 30                	int    $0x30
+  800f8a:	5b                   	pop    %ebx
+  800f8b:	5e                   	pop    %esi
+  800f8c:	5f                   	pop    %edi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	c3                   	ret
+
+00800f8f <sys_env_set_pgfault_upcall>:
+  800f8f:	55                   	push   %ebp
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	57                   	push   %edi
+  800f93:	56                   	push   %esi
+  800f94:	53                   	push   %ebx
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+  800f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa8:	89 df                	mov    %ebx,%edi
+  800faa:	89 de                	mov    %ebx,%esi
+  800fac:	cd 30                	int    $0x30
+  800fae:	85 c0                	test   %eax,%eax
+  800fb0:	7f 08                	jg     800fba <sys_env_set_pgfault_upcall+0x2b>
+  800fb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+  800fbd:	50                   	push   %eax
+  800fbe:	6a 0a                	push   $0xa
+  800fc0:	68 eb 37 80 00       	push   $0x8037eb
+  800fc5:	6a 24                	push   $0x24
+  800fc7:	68 08 38 80 00       	push   $0x803808
+  800fcc:	e8 d5 1f 00 00       	call   802fa6 <_panic>
+
+00800fd1 <sys_ipc_try_send>:
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  800fd7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fde:	74 27                	je     801007 <sys_ipc_try_send+0x36>
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800feb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff1:	6a 00                	push   $0x0
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	8d 35 fe 0f 80 00    	lea    0x800ffe,%esi
+  800ffc:	0f 34                	sysenter
+  800ffe:	5d                   	pop    %ebp
+  800fff:	83 c4 04             	add    $0x4,%esp
+  801002:	5b                   	pop    %ebx
+  801003:	5e                   	pop    %esi
+  801004:	5f                   	pop    %edi
+  801005:	5d                   	pop    %ebp
+  801006:	c3                   	ret
+  801007:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80100c:	be 00 00 00 00       	mov    $0x0,%esi
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101d:	cd 30                	int    $0x30
+  80101f:	eb e1                	jmp    801002 <sys_ipc_try_send+0x31>
+
+00801021 <sys_ipc_recv>:
+  801021:	55                   	push   %ebp
+  801022:	89 e5                	mov    %esp,%ebp
+  801024:	57                   	push   %edi
+  801025:	56                   	push   %esi
+  801026:	53                   	push   %ebx
+  801027:	83 ec 0c             	sub    $0xc,%esp
+  80102a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801031:	74 32                	je     801065 <sys_ipc_recv+0x44>
+  801033:	8b 55 08             	mov    0x8(%ebp),%edx
+  801036:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80103b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801040:	89 cb                	mov    %ecx,%ebx
+  801042:	89 cf                	mov    %ecx,%edi
+  801044:	6a 00                	push   $0x0
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	8d 35 51 10 80 00    	lea    0x801051,%esi
+  80104f:	0f 34                	sysenter
+  801051:	5d                   	pop    %ebp
+  801052:	83 c4 04             	add    $0x4,%esp
+  801055:	89 c2                	mov    %eax,%edx
+  801057:	85 c0                	test   %eax,%eax
+  801059:	7f 3c                	jg     801097 <sys_ipc_recv+0x76>
+  80105b:	89 d0                	mov    %edx,%eax
+  80105d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801060:	5b                   	pop    %ebx
+  801061:	5e                   	pop    %esi
+  801062:	5f                   	pop    %edi
+  801063:	5d                   	pop    %ebp
+  801064:	c3                   	ret
+  801065:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	89 cb                	mov    %ecx,%ebx
+  801074:	89 cf                	mov    %ecx,%edi
+  801076:	89 ce                	mov    %ecx,%esi
+  801078:	cd 30                	int    $0x30
+  80107a:	89 c2                	mov    %eax,%edx
+  80107c:	85 c0                	test   %eax,%eax
+  80107e:	7e db                	jle    80105b <sys_ipc_recv+0x3a>
+  801080:	83 ec 0c             	sub    $0xc,%esp
+  801083:	50                   	push   %eax
+  801084:	6a 0d                	push   $0xd
+  801086:	68 eb 37 80 00       	push   $0x8037eb
+  80108b:	6a 24                	push   $0x24
+  80108d:	68 08 38 80 00       	push   $0x803808
+  801092:	e8 0f 1f 00 00       	call   802fa6 <_panic>
+  801097:	83 ec 0c             	sub    $0xc,%esp
+  80109a:	50                   	push   %eax
+  80109b:	6a 0d                	push   $0xd
+  80109d:	68 eb 37 80 00       	push   $0x8037eb
+  8010a2:	6a 48                	push   $0x48
+  8010a4:	68 08 38 80 00       	push   $0x803808
+  8010a9:	e8 f8 1e 00 00       	call   802fa6 <_panic>
+
+008010ae <sys_ipc_send>:
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	57                   	push   %edi
+  8010b2:	56                   	push   %esi
+  8010b3:	53                   	push   %ebx
+  8010b4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010bb:	74 27                	je     8010e4 <sys_ipc_send+0x36>
+  8010bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010cb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ce:	6a 00                	push   $0x0
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	8d 35 db 10 80 00    	lea    0x8010db,%esi
+  8010d9:	0f 34                	sysenter
+  8010db:	5d                   	pop    %ebp
+  8010dc:	83 c4 04             	add    $0x4,%esp
+  8010df:	5b                   	pop    %ebx
+  8010e0:	5e                   	pop    %esi
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+  8010e4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fa:	cd 30                	int    $0x30
+  8010fc:	eb e1                	jmp    8010df <sys_ipc_send+0x31>
+
+008010fe <sys_ipc_call>:
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  801104:	8b 55 08             	mov    0x8(%ebp),%edx
+  801107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80110f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801112:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801115:	8b 75 18             	mov    0x18(%ebp),%esi
+  801118:	cd 30                	int    $0x30
+  80111a:	5b                   	pop    %ebx
+  80111b:	5e                   	pop    %esi
+  80111c:	5f                   	pop    %edi
+  80111d:	5d                   	pop    %ebp
+  80111e:	c3                   	ret
+
+0080111f <sys_ipc_reply_recv>:
+  80111f:	55                   	push   %ebp
+  801120:	89 e5                	mov    %esp,%ebp
+  801122:	57                   	push   %edi
+  801123:	56                   	push   %esi
+  801124:	53                   	push   %ebx
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801130:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801133:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801136:	8b 75 18             	mov    0x18(%ebp),%esi
+  801139:	cd 30                	int    $0x30
+  80113b:	5b                   	pop    %ebx
+  80113c:	5e                   	pop    %esi
+  80113d:	5f                   	pop    %edi
+  80113e:	5d                   	pop    %ebp
+  80113f:	c3                   	ret
+
+00801140 <sys_time_msec>:
+  801140:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801145:	85 c0                	test   %eax,%eax
+  801147:	75 06                	jne    80114f <sys_time_msec+0xf>
+  801149:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80114e:	c3                   	ret
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	57                   	push   %edi
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+  801155:	83 ec 0c             	sub    $0xc,%esp
+  801158:	0f 31                	rdtsc
+  80115a:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801160:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801166:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80116c:	29 c8                	sub    %ecx,%eax
+  80116e:	19 da                	sbb    %ebx,%edx
+  801170:	bf 00 00 00 00       	mov    $0x0,%edi
+  801175:	57                   	push   %edi
+  801176:	56                   	push   %esi
+  801177:	52                   	push   %edx
+  801178:	50                   	push   %eax
+  801179:	e8 f4 21 00 00       	call   803372 <__udivdi3>
+  80117e:	83 c4 10             	add    $0x10,%esp
+  801181:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_env_swap>:
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+  801192:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801197:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80119f:	89 cb                	mov    %ecx,%ebx
+  8011a1:	89 cf                	mov    %ecx,%edi
+  8011a3:	89 ce                	mov    %ecx,%esi
+  8011a5:	cd 30                	int    $0x30
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	7f 08                	jg     8011b3 <sys_env_swap+0x2a>
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+  8011b6:	50                   	push   %eax
+  8011b7:	6a 12                	push   $0x12
+  8011b9:	68 eb 37 80 00       	push   $0x8037eb
+  8011be:	6a 24                	push   $0x24
+  8011c0:	68 08 38 80 00       	push   $0x803808
+  8011c5:	e8 dc 1d 00 00       	call   802fa6 <_panic>
+
+008011ca <sys_net_try_send>:
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011e3:	89 df                	mov    %ebx,%edi
+  8011e5:	89 de                	mov    %ebx,%esi
+  8011e7:	cd 30                	int    $0x30
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	7f 08                	jg     8011f5 <sys_net_try_send+0x2b>
+  8011ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f0:	5b                   	pop    %ebx
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5f                   	pop    %edi
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	c3                   	ret
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	50                   	push   %eax
+  8011f9:	6a 13                	push   $0x13
+  8011fb:	68 eb 37 80 00       	push   $0x8037eb
+  801200:	6a 24                	push   $0x24
+  801202:	68 08 38 80 00       	push   $0x803808
+  801207:	e8 9a 1d 00 00       	call   802fa6 <_panic>
+
+0080120c <sys_net_try_receive>:
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+  801212:	83 ec 0c             	sub    $0xc,%esp
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801220:	b8 14 00 00 00       	mov    $0x14,%eax
+  801225:	89 df                	mov    %ebx,%edi
+  801227:	89 de                	mov    %ebx,%esi
+  801229:	cd 30                	int    $0x30
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	7f 08                	jg     801237 <sys_net_try_receive+0x2b>
+  80122f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801232:	5b                   	pop    %ebx
+  801233:	5e                   	pop    %esi
+  801234:	5f                   	pop    %edi
+  801235:	5d                   	pop    %ebp
+  801236:	c3                   	ret
+  801237:	83 ec 0c             	sub    $0xc,%esp
+  80123a:	50                   	push   %eax
+  80123b:	6a 14                	push   $0x14
+  80123d:	68 eb 37 80 00       	push   $0x8037eb
+  801242:	6a 24                	push   $0x24
+  801244:	68 08 38 80 00       	push   $0x803808
+  801249:	e8 58 1d 00 00       	call   802fa6 <_panic>
+
+0080124e <sys_net_recv_page>:
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	57                   	push   %edi
+  801252:	56                   	push   %esi
+  801253:	53                   	push   %ebx
+  801254:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	b8 27 00 00 00       	mov    $0x27,%eax
+  801261:	89 cb                	mov    %ecx,%ebx
+  801263:	89 cf                	mov    %ecx,%edi
+  801265:	89 ce                	mov    %ecx,%esi
+  801267:	cd 30                	int    $0x30
+  801269:	5b                   	pop    %ebx
+  80126a:	5e                   	pop    %esi
+  80126b:	5f                   	pop    %edi
+  80126c:	5d                   	pop    %ebp
+  80126d:	c3                   	ret
+
+0080126e <sys_net_wait>:
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+  801274:	ba 00 00 00 00       	mov    $0x0,%edx
+  801279:	b8 26 00 00 00       	mov    $0x26,%eax
+  80127e:	89 d1                	mov    %edx,%ecx
+  801280:	89 d3                	mov    %edx,%ebx
+  801282:	89 d7                	mov    %edx,%edi
+  801284:	89 d6                	mov    %edx,%esi
+  801286:	cd 30                	int    $0x30
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+
+0080128d <sys_get_mac>:
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	57                   	push   %edi
+  801291:	56                   	push   %esi
+  801292:	53                   	push   %ebx
+  801293:	83 ec 0c             	sub    $0xc,%esp
+  801296:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012a6:	89 df                	mov    %ebx,%edi
+  8012a8:	89 de                	mov    %ebx,%esi
+  8012aa:	cd 30                	int    $0x30
+  8012ac:	85 c0                	test   %eax,%eax
+  8012ae:	7f 08                	jg     8012b8 <sys_get_mac+0x2b>
+  8012b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b3:	5b                   	pop    %ebx
+  8012b4:	5e                   	pop    %esi
+  8012b5:	5f                   	pop    %edi
+  8012b6:	5d                   	pop    %ebp
+  8012b7:	c3                   	ret
+  8012b8:	83 ec 0c             	sub    $0xc,%esp
+  8012bb:	50                   	push   %eax
+  8012bc:	6a 15                	push   $0x15
+  8012be:	68 eb 37 80 00       	push   $0x8037eb
+  8012c3:	6a 24                	push   $0x24
+  8012c5:	68 08 38 80 00       	push   $0x803808
+  8012ca:	e8 d7 1c 00 00       	call   802fa6 <_panic>
+
+008012cf <sys_env_lease>:
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	57                   	push   %edi
+  8012d3:	56                   	push   %esi
+  8012d4:	53                   	push   %ebx
+  8012d5:	83 ec 0c             	sub    $0xc,%esp
+  8012d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012e8:	89 df                	mov    %ebx,%edi
+  8012ea:	89 de                	mov    %ebx,%esi
+  8012ec:	cd 30                	int    $0x30
+  8012ee:	85 c0                	test   %eax,%eax
+  8012f0:	7f 08                	jg     8012fa <sys_env_lease+0x2b>
+  8012f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f5:	5b                   	pop    %ebx
+  8012f6:	5e                   	pop    %esi
+  8012f7:	5f                   	pop    %edi
+  8012f8:	5d                   	pop    %ebp
+  8012f9:	c3                   	ret
+  8012fa:	83 ec 0c             	sub    $0xc,%esp
+  8012fd:	50                   	push   %eax
+  8012fe:	6a 16                	push   $0x16
+  801300:	68 eb 37 80 00       	push   $0x8037eb
+  801305:	6a 24                	push   $0x24
+  801307:	68 08 38 80 00       	push   $0x803808
+  80130c:	e8 95 1c 00 00       	call   802fa6 <_panic>
+
+00801311 <sys_copy_mem>:
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	57                   	push   %edi
+  801315:	56                   	push   %esi
+  801316:	53                   	push   %ebx
+  801317:	83 ec 0c             	sub    $0xc,%esp
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	b8 17 00 00 00       	mov    $0x17,%eax
+  801325:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801328:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80132b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80132e:	cd 30                	int    $0x30
+  801330:	85 c0                	test   %eax,%eax
+  801332:	7f 08                	jg     80133c <sys_copy_mem+0x2b>
+  801334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801337:	5b                   	pop    %ebx
+  801338:	5e                   	pop    %esi
+  801339:	5f                   	pop    %edi
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+  80133f:	50                   	push   %eax
+  801340:	6a 17                	push   $0x17
+  801342:	68 eb 37 80 00       	push   $0x8037eb
+  801347:	6a 24                	push   $0x24
+  801349:	68 08 38 80 00       	push   $0x803808
+  80134e:	e8 53 1c 00 00       	call   802fa6 <_panic>
+
+00801353 <sys_get_perms>:
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	57                   	push   %edi
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+  801359:	83 ec 0c             	sub    $0xc,%esp
+  80135c:	be 00 00 00 00       	mov    $0x0,%esi
+  801361:	8b 55 08             	mov    0x8(%ebp),%edx
+  801364:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801367:	b8 18 00 00 00       	mov    $0x18,%eax
+  80136c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136f:	89 f7                	mov    %esi,%edi
+  801371:	cd 30                	int    $0x30
+  801373:	85 c0                	test   %eax,%eax
+  801375:	7f 08                	jg     80137f <sys_get_perms+0x2c>
+  801377:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137a:	5b                   	pop    %ebx
+  80137b:	5e                   	pop    %esi
+  80137c:	5f                   	pop    %edi
+  80137d:	5d                   	pop    %ebp
+  80137e:	c3                   	ret
+  80137f:	83 ec 0c             	sub    $0xc,%esp
+  801382:	50                   	push   %eax
+  801383:	6a 18                	push   $0x18
+  801385:	68 eb 37 80 00       	push   $0x8037eb
+  80138a:	6a 24                	push   $0x24
+  80138c:	68 08 38 80 00       	push   $0x803808
+  801391:	e8 10 1c 00 00       	call   802fa6 <_panic>
+
+00801396 <sys_env_unsuspend>:
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	57                   	push   %edi
+  80139a:	56                   	push   %esi
+  80139b:	53                   	push   %ebx
+  80139c:	83 ec 0c             	sub    $0xc,%esp
+  80139f:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013aa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b2:	89 f7                	mov    %esi,%edi
+  8013b4:	cd 30                	int    $0x30
+  8013b6:	85 c0                	test   %eax,%eax
+  8013b8:	7f 08                	jg     8013c2 <sys_env_unsuspend+0x2c>
+  8013ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5f                   	pop    %edi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+  8013c2:	83 ec 0c             	sub    $0xc,%esp
+  8013c5:	50                   	push   %eax
+  8013c6:	6a 19                	push   $0x19
+  8013c8:	68 eb 37 80 00       	push   $0x8037eb
+  8013cd:	6a 24                	push   $0x24
+  8013cf:	68 08 38 80 00       	push   $0x803808
+  8013d4:	e8 cd 1b 00 00       	call   802fa6 <_panic>
+
+008013d9 <sys_migrate>:
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	57                   	push   %edi
+  8013dd:	56                   	push   %esi
+  8013de:	53                   	push   %ebx
+  8013df:	83 ec 0c             	sub    $0xc,%esp
+  8013e2:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8013e7:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8013ed:	76 11                	jbe    801400 <sys_migrate+0x27>
+  8013ef:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8013f4:	0f b6 08             	movzbl (%eax),%ecx
+  8013f7:	05 00 10 00 00       	add    $0x1000,%eax
+  8013fc:	39 d0                	cmp    %edx,%eax
+  8013fe:	72 f4                	jb     8013f4 <sys_migrate+0x1b>
+  801400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801405:	8b 55 08             	mov    0x8(%ebp),%edx
+  801408:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80140d:	89 cb                	mov    %ecx,%ebx
+  80140f:	89 cf                	mov    %ecx,%edi
+  801411:	89 ce                	mov    %ecx,%esi
+  801413:	cd 30                	int    $0x30
+  801415:	85 c0                	test   %eax,%eax
+  801417:	7f 08                	jg     801421 <sys_migrate+0x48>
+  801419:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141c:	5b                   	pop    %ebx
+  80141d:	5e                   	pop    %esi
+  80141e:	5f                   	pop    %edi
+  80141f:	5d                   	pop    %ebp
+  801420:	c3                   	ret
+  801421:	83 ec 0c             	sub    $0xc,%esp
+  801424:	50                   	push   %eax
+  801425:	6a 1a                	push   $0x1a
+  801427:	68 eb 37 80 00       	push   $0x8037eb
+  80142c:	6a 24                	push   $0x24
+  80142e:	68 08 38 80 00       	push   $0x803808
+  801433:	e8 6e 1b 00 00       	call   802fa6 <_panic>
+
+00801438 <sys_lease_complete>:
+  801438:	55                   	push   %ebp
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	57                   	push   %edi
+  80143c:	56                   	push   %esi
+  80143d:	53                   	push   %ebx
+  80143e:	83 ec 0c             	sub    $0xc,%esp
+  801441:	ba 00 00 00 00       	mov    $0x0,%edx
+  801446:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80144b:	89 d1                	mov    %edx,%ecx
+  80144d:	89 d3                	mov    %edx,%ebx
+  80144f:	89 d7                	mov    %edx,%edi
+  801451:	89 d6                	mov    %edx,%esi
+  801453:	cd 30                	int    $0x30
+  801455:	85 c0                	test   %eax,%eax
+  801457:	7f 08                	jg     801461 <sys_lease_complete+0x29>
+  801459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145c:	5b                   	pop    %ebx
+  80145d:	5e                   	pop    %esi
+  80145e:	5f                   	pop    %edi
+  80145f:	5d                   	pop    %ebp
+  801460:	c3                   	ret
+  801461:	83 ec 0c             	sub    $0xc,%esp
+  801464:	50                   	push   %eax
+  801465:	6a 1b                	push   $0x1b
+  801467:	68 eb 37 80 00       	push   $0x8037eb
+  80146c:	6a 24                	push   $0x24
+  80146e:	68 08 38 80 00       	push   $0x803808
+  801473:	e8 2e 1b 00 00       	call   802fa6 <_panic>
+
+00801478 <sys_env_set_thisenv>:
+  801478:	55                   	push   %ebp
+  801479:	89 e5                	mov    %esp,%ebp
+  80147b:	57                   	push   %edi
+  80147c:	56                   	push   %esi
+  80147d:	53                   	push   %ebx
+  80147e:	83 ec 0c             	sub    $0xc,%esp
+  801481:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801491:	89 df                	mov    %ebx,%edi
+  801493:	89 de                	mov    %ebx,%esi
+  801495:	cd 30                	int    $0x30
+  801497:	85 c0                	test   %eax,%eax
+  801499:	7f 08                	jg     8014a3 <sys_env_set_thisenv+0x2b>
+  80149b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149e:	5b                   	pop    %ebx
+  80149f:	5e                   	pop    %esi
+  8014a0:	5f                   	pop    %edi
+  8014a1:	5d                   	pop    %ebp
+  8014a2:	c3                   	ret
+  8014a3:	83 ec 0c             	sub    $0xc,%esp
+  8014a6:	50                   	push   %eax
+  8014a7:	6a 1c                	push   $0x1c
+  8014a9:	68 eb 37 80 00       	push   $0x8037eb
+  8014ae:	6a 24                	push   $0x24
+  8014b0:	68 08 38 80 00       	push   $0x803808
+  8014b5:	e8 ec 1a 00 00       	call   802fa6 <_panic>
+
+008014ba <sys_env_set_sched>:
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+  8014c0:	83 ec 0c             	sub    $0xc,%esp
+  8014c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ce:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d6:	89 f7                	mov    %esi,%edi
+  8014d8:	cd 30                	int    $0x30
+  8014da:	85 c0                	test   %eax,%eax
+  8014dc:	7f 08                	jg     8014e6 <sys_env_set_sched+0x2c>
+  8014de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e1:	5b                   	pop    %ebx
+  8014e2:	5e                   	pop    %esi
+  8014e3:	5f                   	pop    %edi
+  8014e4:	5d                   	pop    %ebp
+  8014e5:	c3                   	ret
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+  8014e9:	50                   	push   %eax
+  8014ea:	6a 1d                	push   $0x1d
+  8014ec:	68 eb 37 80 00       	push   $0x8037eb
+  8014f1:	6a 24                	push   $0x24
+  8014f3:	68 08 38 80 00       	push   $0x803808
+  8014f8:	e8 a9 1a 00 00       	call   802fa6 <_panic>
+
+008014fd <sys_batch>:
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	57                   	push   %edi
+  801501:	56                   	push   %esi
+  801502:	53                   	push   %ebx
+  801503:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801513:	89 df                	mov    %ebx,%edi
+  801515:	89 de                	mov    %ebx,%esi
+  801517:	cd 30                	int    $0x30
+  801519:	5b                   	pop    %ebx
+  80151a:	5e                   	pop    %esi
+  80151b:	5f                   	pop    %edi
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+
+0080151e <sys_env_stats>:
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	57                   	push   %edi
+  801522:	56                   	push   %esi
+  801523:	53                   	push   %ebx
+  801524:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152f:	b8 23 00 00 00       	mov    $0x23,%eax
+  801534:	89 df                	mov    %ebx,%edi
+  801536:	89 de                	mov    %ebx,%esi
+  801538:	cd 30                	int    $0x30
+  80153a:	5b                   	pop    %ebx
+  80153b:	5e                   	pop    %esi
+  80153c:	5f                   	pop    %edi
+  80153d:	5d                   	pop    %ebp
+  80153e:	c3                   	ret
+
+0080153f <sys_trace>:
+  80153f:	55                   	push   %ebp
+  801540:	89 e5                	mov    %esp,%ebp
+  801542:	57                   	push   %edi
+  801543:	56                   	push   %esi
+  801544:	53                   	push   %ebx
+  801545:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80154a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154d:	b8 24 00 00 00       	mov    $0x24,%eax
+  801552:	89 cb                	mov    %ecx,%ebx
+  801554:	89 cf                	mov    %ecx,%edi
+  801556:	89 ce                	mov    %ecx,%esi
+  801558:	cd 30                	int    $0x30
+  80155a:	5b                   	pop    %ebx
+  80155b:	5e                   	pop    %esi
+  80155c:	5f                   	pop    %edi
+  80155d:	5d                   	pop    %ebp
+  80155e:	c3                   	ret
+
+0080155f <sys_env_set_pager>:
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	57                   	push   %edi
+  801563:	56                   	push   %esi
+  801564:	53                   	push   %ebx
+  801565:	83 ec 0c             	sub    $0xc,%esp
+  801568:	be 00 00 00 00       	mov    $0x0,%esi
+  80156d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801570:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801573:	b8 25 00 00 00       	mov    $0x25,%eax
+  801578:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157b:	89 f7                	mov    %esi,%edi
+  80157d:	cd 30                	int    $0x30
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	7f 08                	jg     80158b <sys_env_set_pager+0x2c>
+  801583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801586:	5b                   	pop    %ebx
+  801587:	5e                   	pop    %esi
+  801588:	5f                   	pop    %edi
+  801589:	5d                   	pop    %ebp
+  80158a:	c3                   	ret
+  80158b:	83 ec 0c             	sub    $0xc,%esp
+  80158e:	50                   	push   %eax
+  80158f:	6a 25                	push   $0x25
+  801591:	68 eb 37 80 00       	push   $0x8037eb
+  801596:	6a 24                	push   $0x24
+  801598:	68 08 38 80 00       	push   $0x803808
+  80159d:	e8 04 1a 00 00       	call   802fa6 <_panic>
+
+008015a2 <sys_pager_retire>:
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	57                   	push   %edi
+  8015a6:	56                   	push   %esi
+  8015a7:	53                   	push   %ebx
+  8015a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b0:	b8 28 00 00 00       	mov    $0x28,%eax
+  8015b5:	89 cb                	mov    %ecx,%ebx
+  8015b7:	89 cf                	mov    %ecx,%edi
+  8015b9:	89 ce                	mov    %ecx,%esi
+  8015bb:	cd 30                	int    $0x30
+  8015bd:	5b                   	pop    %ebx
+  8015be:	5e                   	pop    %esi
+  8015bf:	5f                   	pop    %edi
+  8015c0:	5d                   	pop    %ebp
+  8015c1:	c3                   	ret
+
+008015c2 <sys_prof>:
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	57                   	push   %edi
+  8015c6:	56                   	push   %esi
+  8015c7:	53                   	push   %ebx
+  8015c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d3:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015db:	89 f7                	mov    %esi,%edi
+  8015dd:	cd 30                	int    $0x30
+  8015df:	5b                   	pop    %ebx
+  8015e0:	5e                   	pop    %esi
+  8015e1:	5f                   	pop    %edi
+  8015e2:	5d                   	pop    %ebp
+  8015e3:	c3                   	ret
+
+008015e4 <argstart>:
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ed:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015f0:	89 10                	mov    %edx,(%eax)
+  8015f2:	89 48 04             	mov    %ecx,0x4(%eax)
+  8015f5:	83 3a 01             	cmpl   $0x1,(%edx)
+  8015f8:	7e 09                	jle    801603 <argstart+0x1f>
+  8015fa:	ba b1 34 80 00       	mov    $0x8034b1,%edx
+  8015ff:	85 c9                	test   %ecx,%ecx
+  801601:	75 05                	jne    801608 <argstart+0x24>
+  801603:	ba 00 00 00 00       	mov    $0x0,%edx
+  801608:	89 50 08             	mov    %edx,0x8(%eax)
+  80160b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801612:	5d                   	pop    %ebp
+  801613:	c3                   	ret
+
+00801614 <argnext>:
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	53                   	push   %ebx
+  801618:	83 ec 04             	sub    $0x4,%esp
+  80161b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80161e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  801625:	8b 43 08             	mov    0x8(%ebx),%eax
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	74 74                	je     8016a0 <argnext+0x8c>
+  80162c:	80 38 00             	cmpb   $0x0,(%eax)
+  80162f:	75 48                	jne    801679 <argnext+0x65>
+  801631:	8b 0b                	mov    (%ebx),%ecx
+  801633:	83 39 01             	cmpl   $0x1,(%ecx)
+  801636:	74 5a                	je     801692 <argnext+0x7e>
+  801638:	8b 53 04             	mov    0x4(%ebx),%edx
+  80163b:	8b 42 04             	mov    0x4(%edx),%eax
+  80163e:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801641:	75 4f                	jne    801692 <argnext+0x7e>
+  801643:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801647:	74 49                	je     801692 <argnext+0x7e>
+  801649:	83 c0 01             	add    $0x1,%eax
+  80164c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80164f:	83 ec 04             	sub    $0x4,%esp
+  801652:	8b 01                	mov    (%ecx),%eax
+  801654:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  80165b:	50                   	push   %eax
+  80165c:	8d 42 08             	lea    0x8(%edx),%eax
+  80165f:	50                   	push   %eax
+  801660:	83 c2 04             	add    $0x4,%edx
+  801663:	52                   	push   %edx
+  801664:	e8 5d f4 ff ff       	call   800ac6 <memmove>
+  801669:	8b 03                	mov    (%ebx),%eax
+  80166b:	83 28 01             	subl   $0x1,(%eax)
+  80166e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801677:	74 13                	je     80168c <argnext+0x78>
+  801679:	8b 43 08             	mov    0x8(%ebx),%eax
+  80167c:	0f b6 10             	movzbl (%eax),%edx
+  80167f:	83 c0 01             	add    $0x1,%eax
+  801682:	89 43 08             	mov    %eax,0x8(%ebx)
+  801685:	89 d0                	mov    %edx,%eax
+  801687:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80168a:	c9                   	leave
+  80168b:	c3                   	ret
+  80168c:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801690:	75 e7                	jne    801679 <argnext+0x65>
+  801692:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801699:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80169e:	eb e5                	jmp    801685 <argnext+0x71>
+  8016a0:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8016a5:	eb de                	jmp    801685 <argnext+0x71>
+
+008016a7 <argnextvalue>:
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	53                   	push   %ebx
+  8016ab:	83 ec 04             	sub    $0x4,%esp
+  8016ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8016b1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	74 12                	je     8016ca <argnextvalue+0x23>
+  8016b8:	80 38 00             	cmpb   $0x0,(%eax)
+  8016bb:	74 12                	je     8016cf <argnextvalue+0x28>
+  8016bd:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8016c0:	c7 43 08 b1 34 80 00 	movl   $0x8034b1,0x8(%ebx)
+  8016c7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8016ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+  8016cf:	8b 13                	mov    (%ebx),%edx
+  8016d1:	83 3a 01             	cmpl   $0x1,(%edx)
+  8016d4:	7f 10                	jg     8016e6 <argnextvalue+0x3f>
+  8016d6:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  8016dd:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8016e4:	eb e1                	jmp    8016c7 <argnextvalue+0x20>
+  8016e6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8016e9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8016ec:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+  8016ef:	83 ec 04             	sub    $0x4,%esp
+  8016f2:	8b 12                	mov    (%edx),%edx
+  8016f4:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8016fb:	52                   	push   %edx
+  8016fc:	8d 50 08             	lea    0x8(%eax),%edx
+  8016ff:	52                   	push   %edx
+  801700:	83 c0 04             	add    $0x4,%eax
+  801703:	50                   	push   %eax
+  801704:	e8 bd f3 ff ff       	call   800ac6 <memmove>
+  801709:	8b 03                	mov    (%ebx),%eax
+  80170b:	83 28 01             	subl   $0x1,(%eax)
+  80170e:	83 c4 10             	add    $0x10,%esp
+  801711:	eb b4                	jmp    8016c7 <argnextvalue+0x20>
+
+00801713 <argvalue>:
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	83 ec 08             	sub    $0x8,%esp
+  801719:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171c:	8b 42 0c             	mov    0xc(%edx),%eax
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	74 02                	je     801725 <argvalue+0x12>
+  801723:	c9                   	leave
+  801724:	c3                   	ret
+  801725:	83 ec 0c             	sub    $0xc,%esp
+  801728:	52                   	push   %edx
+  801729:	e8 79 ff ff ff       	call   8016a7 <argnextvalue>
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	eb f0                	jmp    801723 <argvalue+0x10>
+
+00801733 <fd2num>:
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	8b 45 08             	mov    0x8(%ebp),%eax
+  801739:	05 00 00 00 30       	add    $0x30000000,%eax
+  80173e:	c1 e8 0c             	shr    $0xc,%eax
+  801741:	5d                   	pop    %ebp
+  801742:	c3                   	ret
+
+00801743 <fd2data>:
+  801743:	55                   	push   %ebp
+  801744:	89 e5                	mov    %esp,%ebp
+  801746:	8b 45 08             	mov    0x8(%ebp),%eax
+  801749:	05 00 00 00 30       	add    $0x30000000,%eax
+  80174e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801753:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+
+0080175a <fd_alloc>:
+  80175a:	55                   	push   %ebp
+  80175b:	89 e5                	mov    %esp,%ebp
+  80175d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801762:	89 c2                	mov    %eax,%edx
+  801764:	c1 ea 16             	shr    $0x16,%edx
+  801767:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80176e:	f6 c2 01             	test   $0x1,%dl
+  801771:	74 29                	je     80179c <fd_alloc+0x42>
+  801773:	89 c2                	mov    %eax,%edx
+  801775:	c1 ea 0c             	shr    $0xc,%edx
+  801778:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80177f:	f6 c2 01             	test   $0x1,%dl
+  801782:	74 18                	je     80179c <fd_alloc+0x42>
+  801784:	05 00 10 00 00       	add    $0x1000,%eax
+  801789:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80178e:	75 d2                	jne    801762 <fd_alloc+0x8>
+  801790:	b8 00 00 00 00       	mov    $0x0,%eax
+  801795:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80179a:	eb 05                	jmp    8017a1 <fd_alloc+0x47>
+  80179c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a4:	89 02                	mov    %eax,(%edx)
+  8017a6:	89 c8                	mov    %ecx,%eax
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+
+008017aa <fd_lookup>:
+  8017aa:	55                   	push   %ebp
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b0:	83 f8 1f             	cmp    $0x1f,%eax
+  8017b3:	77 30                	ja     8017e5 <fd_lookup+0x3b>
+  8017b5:	c1 e0 0c             	shl    $0xc,%eax
+  8017b8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8017bd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8017c3:	f6 c2 01             	test   $0x1,%dl
+  8017c6:	74 24                	je     8017ec <fd_lookup+0x42>
+  8017c8:	89 c2                	mov    %eax,%edx
+  8017ca:	c1 ea 0c             	shr    $0xc,%edx
+  8017cd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017d4:	f6 c2 01             	test   $0x1,%dl
+  8017d7:	74 1a                	je     8017f3 <fd_lookup+0x49>
+  8017d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017dc:	89 02                	mov    %eax,(%edx)
+  8017de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e3:	5d                   	pop    %ebp
+  8017e4:	c3                   	ret
+  8017e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ea:	eb f7                	jmp    8017e3 <fd_lookup+0x39>
+  8017ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f1:	eb f0                	jmp    8017e3 <fd_lookup+0x39>
+  8017f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f8:	eb e9                	jmp    8017e3 <fd_lookup+0x39>
+
+008017fa <dev_lookup>:
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	53                   	push   %ebx
+  8017fe:	83 ec 04             	sub    $0x4,%esp
+  801801:	8b 55 08             	mov    0x8(%ebp),%edx
+  801804:	b8 00 00 00 00       	mov    $0x0,%eax
+  801809:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  80180e:	39 13                	cmp    %edx,(%ebx)
+  801810:	74 37                	je     801849 <dev_lookup+0x4f>
+  801812:	83 c0 01             	add    $0x1,%eax
+  801815:	8b 1c 85 94 38 80 00 	mov    0x803894(,%eax,4),%ebx
+  80181c:	85 db                	test   %ebx,%ebx
+  80181e:	75 ee                	jne    80180e <dev_lookup+0x14>
+  801820:	a1 10 50 80 00       	mov    0x805010,%eax
+  801825:	8b 40 48             	mov    0x48(%eax),%eax
+  801828:	83 ec 04             	sub    $0x4,%esp
+  80182b:	52                   	push   %edx
+  80182c:	50                   	push   %eax
+  80182d:	68 18 38 80 00       	push   $0x803818
+  801832:	e8 e8 e9 ff ff       	call   80021f <cprintf>
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80183f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801842:	89 1a                	mov    %ebx,(%edx)
+  801844:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801847:	c9                   	leave
+  801848:	c3                   	ret
+  801849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184e:	eb ef                	jmp    80183f <dev_lookup+0x45>
+
+00801850 <fd_close>:
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	57                   	push   %edi
+  801854:	56                   	push   %esi
+  801855:	53                   	push   %ebx
+  801856:	83 ec 24             	sub    $0x24,%esp
+  801859:	8b 75 08             	mov    0x8(%ebp),%esi
+  80185c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80185f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801862:	50                   	push   %eax
+  801863:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801869:	c1 e8 0c             	shr    $0xc,%eax
+  80186c:	50                   	push   %eax
+  80186d:	e8 38 ff ff ff       	call   8017aa <fd_lookup>
+  801872:	89 c3                	mov    %eax,%ebx
+  801874:	83 c4 10             	add    $0x10,%esp
+  801877:	85 c0                	test   %eax,%eax
+  801879:	78 05                	js     801880 <fd_close+0x30>
+  80187b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80187e:	74 0f                	je     80188f <fd_close+0x3f>
+  801880:	85 ff                	test   %edi,%edi
+  801882:	0f 44 df             	cmove  %edi,%ebx
+  801885:	89 d8                	mov    %ebx,%eax
+  801887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188a:	5b                   	pop    %ebx
+  80188b:	5e                   	pop    %esi
+  80188c:	5f                   	pop    %edi
+  80188d:	5d                   	pop    %ebp
+  80188e:	c3                   	ret
+  80188f:	83 ec 08             	sub    $0x8,%esp
+  801892:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801895:	50                   	push   %eax
+  801896:	ff 36                	push   (%esi)
+  801898:	e8 5d ff ff ff       	call   8017fa <dev_lookup>
+  80189d:	89 c3                	mov    %eax,%ebx
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	78 1a                	js     8018c0 <fd_close+0x70>
+  8018a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018a9:	8b 40 10             	mov    0x10(%eax),%eax
+  8018ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	74 0b                	je     8018c0 <fd_close+0x70>
+  8018b5:	83 ec 0c             	sub    $0xc,%esp
+  8018b8:	56                   	push   %esi
+  8018b9:	ff d0                	call   *%eax
+  8018bb:	89 c3                	mov    %eax,%ebx
+  8018bd:	83 c4 10             	add    $0x10,%esp
+  8018c0:	83 ec 08             	sub    $0x8,%esp
+  8018c3:	56                   	push   %esi
+  8018c4:	6a 00                	push   $0x0
+  8018c6:	e8 7d f5 ff ff       	call   800e48 <sys_page_unmap>
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	eb b5                	jmp    801885 <fd_close+0x35>
+
+008018d0 <close>:
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	83 ec 20             	sub    $0x20,%esp
+  8018d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d9:	50                   	push   %eax
+  8018da:	ff 75 08             	push   0x8(%ebp)
+  8018dd:	e8 c8 fe ff ff       	call   8017aa <fd_lookup>
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	85 c0                	test   %eax,%eax
+  8018e7:	79 02                	jns    8018eb <close+0x1b>
+  8018e9:	c9                   	leave
+  8018ea:	c3                   	ret
+  8018eb:	83 ec 08             	sub    $0x8,%esp
+  8018ee:	6a 01                	push   $0x1
+  8018f0:	ff 75 f4             	push   -0xc(%ebp)
+  8018f3:	e8 58 ff ff ff       	call   801850 <fd_close>
+  8018f8:	83 c4 10             	add    $0x10,%esp
+  8018fb:	eb ec                	jmp    8018e9 <close+0x19>
+
+008018fd <close_all>:
+  8018fd:	55                   	push   %ebp
+  8018fe:	89 e5                	mov    %esp,%ebp
+  801900:	53                   	push   %ebx
+  801901:	83 ec 04             	sub    $0x4,%esp
+  801904:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801909:	83 ec 0c             	sub    $0xc,%esp
+  80190c:	53                   	push   %ebx
+  80190d:	e8 be ff ff ff       	call   8018d0 <close>
+  801912:	83 c3 01             	add    $0x1,%ebx
+  801915:	83 c4 10             	add    $0x10,%esp
+  801918:	83 fb 20             	cmp    $0x20,%ebx
+  80191b:	75 ec                	jne    801909 <close_all+0xc>
+  80191d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801920:	c9                   	leave
+  801921:	c3                   	ret
+
+00801922 <dup>:
+  801922:	55                   	push   %ebp
+  801923:	89 e5                	mov    %esp,%ebp
+  801925:	57                   	push   %edi
+  801926:	56                   	push   %esi
+  801927:	53                   	push   %ebx
+  801928:	83 ec 34             	sub    $0x34,%esp
+  80192b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80192e:	50                   	push   %eax
+  80192f:	ff 75 08             	push   0x8(%ebp)
+  801932:	e8 73 fe ff ff       	call   8017aa <fd_lookup>
+  801937:	89 c3                	mov    %eax,%ebx
+  801939:	83 c4 10             	add    $0x10,%esp
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	78 7f                	js     8019bf <dup+0x9d>
+  801940:	83 ec 0c             	sub    $0xc,%esp
+  801943:	ff 75 0c             	push   0xc(%ebp)
+  801946:	e8 85 ff ff ff       	call   8018d0 <close>
+  80194b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80194e:	c1 e6 0c             	shl    $0xc,%esi
+  801951:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801957:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80195a:	89 3c 24             	mov    %edi,(%esp)
+  80195d:	e8 e1 fd ff ff       	call   801743 <fd2data>
+  801962:	89 c3                	mov    %eax,%ebx
+  801964:	89 34 24             	mov    %esi,(%esp)
+  801967:	e8 d7 fd ff ff       	call   801743 <fd2data>
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801972:	89 d8                	mov    %ebx,%eax
+  801974:	c1 e8 16             	shr    $0x16,%eax
+  801977:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80197e:	a8 01                	test   $0x1,%al
+  801980:	74 11                	je     801993 <dup+0x71>
+  801982:	89 d8                	mov    %ebx,%eax
+  801984:	c1 e8 0c             	shr    $0xc,%eax
+  801987:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80198e:	f6 c2 01             	test   $0x1,%dl
+  801991:	75 36                	jne    8019c9 <dup+0xa7>
+  801993:	89 f8                	mov    %edi,%eax
+  801995:	c1 e8 0c             	shr    $0xc,%eax
+  801998:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80199f:	83 ec 0c             	sub    $0xc,%esp
+  8019a2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019a7:	50                   	push   %eax
+  8019a8:	56                   	push   %esi
+  8019a9:	6a 00                	push   $0x0
+  8019ab:	57                   	push   %edi
+  8019ac:	6a 00                	push   $0x0
+  8019ae:	e8 06 f4 ff ff       	call   800db9 <sys_page_map>
+  8019b3:	89 c3                	mov    %eax,%ebx
+  8019b5:	83 c4 20             	add    $0x20,%esp
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 33                	js     8019ef <dup+0xcd>
+  8019bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8019bf:	89 d8                	mov    %ebx,%eax
+  8019c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c4:	5b                   	pop    %ebx
+  8019c5:	5e                   	pop    %esi
+  8019c6:	5f                   	pop    %edi
+  8019c7:	5d                   	pop    %ebp
+  8019c8:	c3                   	ret
+  8019c9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019d0:	83 ec 0c             	sub    $0xc,%esp
+  8019d3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019d8:	50                   	push   %eax
+  8019d9:	ff 75 d4             	push   -0x2c(%ebp)
+  8019dc:	6a 00                	push   $0x0
+  8019de:	53                   	push   %ebx
+  8019df:	6a 00                	push   $0x0
+  8019e1:	e8 d3 f3 ff ff       	call   800db9 <sys_page_map>
+  8019e6:	89 c3                	mov    %eax,%ebx
+  8019e8:	83 c4 20             	add    $0x20,%esp
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	79 a4                	jns    801993 <dup+0x71>
+  8019ef:	83 ec 08             	sub    $0x8,%esp
+  8019f2:	56                   	push   %esi
+  8019f3:	6a 00                	push   $0x0
+  8019f5:	e8 4e f4 ff ff       	call   800e48 <sys_page_unmap>
+  8019fa:	83 c4 08             	add    $0x8,%esp
+  8019fd:	ff 75 d4             	push   -0x2c(%ebp)
+  801a00:	6a 00                	push   $0x0
+  801a02:	e8 41 f4 ff ff       	call   800e48 <sys_page_unmap>
+  801a07:	83 c4 10             	add    $0x10,%esp
+  801a0a:	eb b3                	jmp    8019bf <dup+0x9d>
+
+00801a0c <read>:
+  801a0c:	55                   	push   %ebp
+  801a0d:	89 e5                	mov    %esp,%ebp
+  801a0f:	56                   	push   %esi
+  801a10:	53                   	push   %ebx
+  801a11:	83 ec 18             	sub    $0x18,%esp
+  801a14:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a17:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a1a:	50                   	push   %eax
+  801a1b:	56                   	push   %esi
+  801a1c:	e8 89 fd ff ff       	call   8017aa <fd_lookup>
+  801a21:	83 c4 10             	add    $0x10,%esp
+  801a24:	85 c0                	test   %eax,%eax
+  801a26:	78 3c                	js     801a64 <read+0x58>
+  801a28:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a2b:	83 ec 08             	sub    $0x8,%esp
+  801a2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a31:	50                   	push   %eax
+  801a32:	ff 33                	push   (%ebx)
+  801a34:	e8 c1 fd ff ff       	call   8017fa <dev_lookup>
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	78 24                	js     801a64 <read+0x58>
+  801a40:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a43:	83 e0 03             	and    $0x3,%eax
+  801a46:	83 f8 01             	cmp    $0x1,%eax
+  801a49:	74 20                	je     801a6b <read+0x5f>
+  801a4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4e:	8b 40 08             	mov    0x8(%eax),%eax
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	74 37                	je     801a8c <read+0x80>
+  801a55:	83 ec 04             	sub    $0x4,%esp
+  801a58:	ff 75 10             	push   0x10(%ebp)
+  801a5b:	ff 75 0c             	push   0xc(%ebp)
+  801a5e:	53                   	push   %ebx
+  801a5f:	ff d0                	call   *%eax
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a67:	5b                   	pop    %ebx
+  801a68:	5e                   	pop    %esi
+  801a69:	5d                   	pop    %ebp
+  801a6a:	c3                   	ret
+  801a6b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a70:	8b 40 48             	mov    0x48(%eax),%eax
+  801a73:	83 ec 04             	sub    $0x4,%esp
+  801a76:	56                   	push   %esi
+  801a77:	50                   	push   %eax
+  801a78:	68 59 38 80 00       	push   $0x803859
+  801a7d:	e8 9d e7 ff ff       	call   80021f <cprintf>
+  801a82:	83 c4 10             	add    $0x10,%esp
+  801a85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a8a:	eb d8                	jmp    801a64 <read+0x58>
+  801a8c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a91:	eb d1                	jmp    801a64 <read+0x58>
+
+00801a93 <readn>:
+  801a93:	55                   	push   %ebp
+  801a94:	89 e5                	mov    %esp,%ebp
+  801a96:	57                   	push   %edi
+  801a97:	56                   	push   %esi
+  801a98:	53                   	push   %ebx
+  801a99:	83 ec 0c             	sub    $0xc,%esp
+  801a9c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a9f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801aa2:	85 f6                	test   %esi,%esi
+  801aa4:	74 30                	je     801ad6 <readn+0x43>
+  801aa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab0:	83 ec 04             	sub    $0x4,%esp
+  801ab3:	89 f2                	mov    %esi,%edx
+  801ab5:	29 c2                	sub    %eax,%edx
+  801ab7:	52                   	push   %edx
+  801ab8:	01 f8                	add    %edi,%eax
+  801aba:	50                   	push   %eax
+  801abb:	ff 75 08             	push   0x8(%ebp)
+  801abe:	e8 49 ff ff ff       	call   801a0c <read>
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	78 15                	js     801adf <readn+0x4c>
+  801aca:	74 11                	je     801add <readn+0x4a>
+  801acc:	01 c3                	add    %eax,%ebx
+  801ace:	89 d8                	mov    %ebx,%eax
+  801ad0:	39 f3                	cmp    %esi,%ebx
+  801ad2:	72 dc                	jb     801ab0 <readn+0x1d>
+  801ad4:	eb 09                	jmp    801adf <readn+0x4c>
+  801ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801adb:	eb 02                	jmp    801adf <readn+0x4c>
+  801add:	89 d8                	mov    %ebx,%eax
+  801adf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae2:	5b                   	pop    %ebx
+  801ae3:	5e                   	pop    %esi
+  801ae4:	5f                   	pop    %edi
+  801ae5:	5d                   	pop    %ebp
+  801ae6:	c3                   	ret
+
+00801ae7 <write>:
+  801ae7:	55                   	push   %ebp
+  801ae8:	89 e5                	mov    %esp,%ebp
+  801aea:	56                   	push   %esi
+  801aeb:	53                   	push   %ebx
+  801aec:	83 ec 18             	sub    $0x18,%esp
+  801aef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801af2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801af5:	50                   	push   %eax
+  801af6:	53                   	push   %ebx
+  801af7:	e8 ae fc ff ff       	call   8017aa <fd_lookup>
+  801afc:	83 c4 10             	add    $0x10,%esp
+  801aff:	85 c0                	test   %eax,%eax
+  801b01:	78 37                	js     801b3a <write+0x53>
+  801b03:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b06:	83 ec 08             	sub    $0x8,%esp
+  801b09:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b0c:	50                   	push   %eax
+  801b0d:	ff 36                	push   (%esi)
+  801b0f:	e8 e6 fc ff ff       	call   8017fa <dev_lookup>
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	85 c0                	test   %eax,%eax
+  801b19:	78 1f                	js     801b3a <write+0x53>
+  801b1b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b1f:	74 20                	je     801b41 <write+0x5a>
+  801b21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b24:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b27:	85 c0                	test   %eax,%eax
+  801b29:	74 37                	je     801b62 <write+0x7b>
+  801b2b:	83 ec 04             	sub    $0x4,%esp
+  801b2e:	ff 75 10             	push   0x10(%ebp)
+  801b31:	ff 75 0c             	push   0xc(%ebp)
+  801b34:	56                   	push   %esi
+  801b35:	ff d0                	call   *%eax
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3d:	5b                   	pop    %ebx
+  801b3e:	5e                   	pop    %esi
+  801b3f:	5d                   	pop    %ebp
+  801b40:	c3                   	ret
+  801b41:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b46:	8b 40 48             	mov    0x48(%eax),%eax
+  801b49:	83 ec 04             	sub    $0x4,%esp
+  801b4c:	53                   	push   %ebx
+  801b4d:	50                   	push   %eax
+  801b4e:	68 75 38 80 00       	push   $0x803875
+  801b53:	e8 c7 e6 ff ff       	call   80021f <cprintf>
+  801b58:	83 c4 10             	add    $0x10,%esp
+  801b5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b60:	eb d8                	jmp    801b3a <write+0x53>
+  801b62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b67:	eb d1                	jmp    801b3a <write+0x53>
+
+00801b69 <seek>:
+  801b69:	55                   	push   %ebp
+  801b6a:	89 e5                	mov    %esp,%ebp
+  801b6c:	83 ec 20             	sub    $0x20,%esp
+  801b6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b72:	50                   	push   %eax
+  801b73:	ff 75 08             	push   0x8(%ebp)
+  801b76:	e8 2f fc ff ff       	call   8017aa <fd_lookup>
+  801b7b:	83 c4 10             	add    $0x10,%esp
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	78 0e                	js     801b90 <seek+0x27>
+  801b82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b88:	89 50 04             	mov    %edx,0x4(%eax)
+  801b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b90:	c9                   	leave
+  801b91:	c3                   	ret
+
+00801b92 <ftruncate>:
+  801b92:	55                   	push   %ebp
+  801b93:	89 e5                	mov    %esp,%ebp
+  801b95:	56                   	push   %esi
+  801b96:	53                   	push   %ebx
+  801b97:	83 ec 18             	sub    $0x18,%esp
+  801b9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ba0:	50                   	push   %eax
+  801ba1:	53                   	push   %ebx
+  801ba2:	e8 03 fc ff ff       	call   8017aa <fd_lookup>
+  801ba7:	83 c4 10             	add    $0x10,%esp
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	78 34                	js     801be2 <ftruncate+0x50>
+  801bae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bb1:	83 ec 08             	sub    $0x8,%esp
+  801bb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb7:	50                   	push   %eax
+  801bb8:	ff 36                	push   (%esi)
+  801bba:	e8 3b fc ff ff       	call   8017fa <dev_lookup>
+  801bbf:	83 c4 10             	add    $0x10,%esp
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	78 1c                	js     801be2 <ftruncate+0x50>
+  801bc6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bca:	74 1d                	je     801be9 <ftruncate+0x57>
+  801bcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bcf:	8b 40 18             	mov    0x18(%eax),%eax
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	74 34                	je     801c0a <ftruncate+0x78>
+  801bd6:	83 ec 08             	sub    $0x8,%esp
+  801bd9:	ff 75 0c             	push   0xc(%ebp)
+  801bdc:	56                   	push   %esi
+  801bdd:	ff d0                	call   *%eax
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be5:	5b                   	pop    %ebx
+  801be6:	5e                   	pop    %esi
+  801be7:	5d                   	pop    %ebp
+  801be8:	c3                   	ret
+  801be9:	a1 10 50 80 00       	mov    0x805010,%eax
+  801bee:	8b 40 48             	mov    0x48(%eax),%eax
+  801bf1:	83 ec 04             	sub    $0x4,%esp
+  801bf4:	53                   	push   %ebx
+  801bf5:	50                   	push   %eax
+  801bf6:	68 38 38 80 00       	push   $0x803838
+  801bfb:	e8 1f e6 ff ff       	call   80021f <cprintf>
+  801c00:	83 c4 10             	add    $0x10,%esp
+  801c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c08:	eb d8                	jmp    801be2 <ftruncate+0x50>
+  801c0a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c0f:	eb d1                	jmp    801be2 <ftruncate+0x50>
+
+00801c11 <fstat>:
+  801c11:	55                   	push   %ebp
+  801c12:	89 e5                	mov    %esp,%ebp
+  801c14:	56                   	push   %esi
+  801c15:	53                   	push   %ebx
+  801c16:	83 ec 18             	sub    $0x18,%esp
+  801c19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c1c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c1f:	50                   	push   %eax
+  801c20:	ff 75 08             	push   0x8(%ebp)
+  801c23:	e8 82 fb ff ff       	call   8017aa <fd_lookup>
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 49                	js     801c78 <fstat+0x67>
+  801c2f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c32:	83 ec 08             	sub    $0x8,%esp
+  801c35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c38:	50                   	push   %eax
+  801c39:	ff 36                	push   (%esi)
+  801c3b:	e8 ba fb ff ff       	call   8017fa <dev_lookup>
+  801c40:	83 c4 10             	add    $0x10,%esp
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	78 31                	js     801c78 <fstat+0x67>
+  801c47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c4a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c4e:	74 2f                	je     801c7f <fstat+0x6e>
+  801c50:	c6 03 00             	movb   $0x0,(%ebx)
+  801c53:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c5a:	00 00 00 
+  801c5d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c64:	00 00 00 
+  801c67:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801c6d:	83 ec 08             	sub    $0x8,%esp
+  801c70:	53                   	push   %ebx
+  801c71:	56                   	push   %esi
+  801c72:	ff 50 14             	call   *0x14(%eax)
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c7b:	5b                   	pop    %ebx
+  801c7c:	5e                   	pop    %esi
+  801c7d:	5d                   	pop    %ebp
+  801c7e:	c3                   	ret
+  801c7f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c84:	eb f2                	jmp    801c78 <fstat+0x67>
+
+00801c86 <stat>:
+  801c86:	55                   	push   %ebp
+  801c87:	89 e5                	mov    %esp,%ebp
+  801c89:	56                   	push   %esi
+  801c8a:	53                   	push   %ebx
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	6a 00                	push   $0x0
+  801c90:	ff 75 08             	push   0x8(%ebp)
+  801c93:	e8 31 05 00 00       	call   8021c9 <open>
+  801c98:	89 c3                	mov    %eax,%ebx
+  801c9a:	83 c4 10             	add    $0x10,%esp
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	78 1b                	js     801cbc <stat+0x36>
+  801ca1:	83 ec 08             	sub    $0x8,%esp
+  801ca4:	ff 75 0c             	push   0xc(%ebp)
+  801ca7:	50                   	push   %eax
+  801ca8:	e8 64 ff ff ff       	call   801c11 <fstat>
+  801cad:	89 c6                	mov    %eax,%esi
+  801caf:	89 1c 24             	mov    %ebx,(%esp)
+  801cb2:	e8 19 fc ff ff       	call   8018d0 <close>
+  801cb7:	83 c4 10             	add    $0x10,%esp
+  801cba:	89 f3                	mov    %esi,%ebx
+  801cbc:	89 d8                	mov    %ebx,%eax
+  801cbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cc1:	5b                   	pop    %ebx
+  801cc2:	5e                   	pop    %esi
+  801cc3:	5d                   	pop    %ebp
+  801cc4:	c3                   	ret
+
+00801cc5 <fsipc>:
+  801cc5:	55                   	push   %ebp
+  801cc6:	89 e5                	mov    %esp,%ebp
+  801cc8:	56                   	push   %esi
+  801cc9:	53                   	push   %ebx
+  801cca:	89 c3                	mov    %eax,%ebx
+  801ccc:	89 d6                	mov    %edx,%esi
+  801cce:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801cd5:	74 20                	je     801cf7 <fsipc+0x32>
+  801cd7:	83 ec 08             	sub    $0x8,%esp
+  801cda:	6a 00                	push   $0x0
+  801cdc:	56                   	push   %esi
+  801cdd:	6a 07                	push   $0x7
+  801cdf:	68 00 60 80 00       	push   $0x806000
+  801ce4:	53                   	push   %ebx
+  801ce5:	ff 35 08 50 80 00    	push   0x805008
+  801ceb:	e8 b4 13 00 00       	call   8030a4 <ipc_call>
+  801cf0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf3:	5b                   	pop    %ebx
+  801cf4:	5e                   	pop    %esi
+  801cf5:	5d                   	pop    %ebp
+  801cf6:	c3                   	ret
+  801cf7:	83 ec 0c             	sub    $0xc,%esp
+  801cfa:	6a 02                	push   $0x2
+  801cfc:	e8 3e 15 00 00       	call   80323f <ipc_find_env>
+  801d01:	a3 08 50 80 00       	mov    %eax,0x805008
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	eb cc                	jmp    801cd7 <fsipc+0x12>
+
+00801d0b <devfile_trunc>:
+  801d0b:	55                   	push   %ebp
+  801d0c:	89 e5                	mov    %esp,%ebp
+  801d0e:	83 ec 08             	sub    $0x8,%esp
+  801d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d14:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d17:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d1f:	a3 04 60 80 00       	mov    %eax,0x806004
+  801d24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d29:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d2e:	e8 92 ff ff ff       	call   801cc5 <fsipc>
+  801d33:	c9                   	leave
+  801d34:	c3                   	ret
+
+00801d35 <devfile_flush>:
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	83 ec 08             	sub    $0x8,%esp
+  801d3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d41:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d50:	e8 70 ff ff ff       	call   801cc5 <fsipc>
+  801d55:	c9                   	leave
+  801d56:	c3                   	ret
+
+00801d57 <devfile_stat>:
+  801d57:	55                   	push   %ebp
+  801d58:	89 e5                	mov    %esp,%ebp
+  801d5a:	53                   	push   %ebx
+  801d5b:	83 ec 04             	sub    $0x4,%esp
+  801d5e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d61:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d64:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d67:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d71:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d76:	e8 4a ff ff ff       	call   801cc5 <fsipc>
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	78 2c                	js     801dab <devfile_stat+0x54>
+  801d7f:	83 ec 08             	sub    $0x8,%esp
+  801d82:	68 00 60 80 00       	push   $0x806000
+  801d87:	53                   	push   %ebx
+  801d88:	e8 89 eb ff ff       	call   800916 <strcpy>
+  801d8d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d92:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801d98:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d9d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801da3:	83 c4 10             	add    $0x10,%esp
+  801da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dae:	c9                   	leave
+  801daf:	c3                   	ret
+
+00801db0 <fsring_rw>:
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	57                   	push   %edi
+  801db4:	56                   	push   %esi
+  801db5:	53                   	push   %ebx
+  801db6:	83 ec 2c             	sub    $0x2c,%esp
+  801db9:	89 c7                	mov    %eax,%edi
+  801dbb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801dbe:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801dc1:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801dc6:	a8 01                	test   $0x1,%al
+  801dc8:	74 0d                	je     801dd7 <fsring_rw+0x27>
+  801dca:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801dcf:	a8 01                	test   $0x1,%al
+  801dd1:	0f 85 d5 00 00 00    	jne    801eac <fsring_rw+0xfc>
+  801dd7:	a1 10 50 80 00       	mov    0x805010,%eax
+  801ddc:	8b 40 48             	mov    0x48(%eax),%eax
+  801ddf:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801de5:	0f 84 fc 00 00 00    	je     801ee7 <fsring_rw+0x137>
+  801deb:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801df2:	0f 84 02 01 00 00    	je     801efa <fsring_rw+0x14a>
+  801df8:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dfd:	83 ec 04             	sub    $0x4,%esp
+  801e00:	68 07 02 00 00       	push   $0x207
+  801e05:	53                   	push   %ebx
+  801e06:	6a 00                	push   $0x0
+  801e08:	e8 69 ef ff ff       	call   800d76 <sys_page_alloc>
+  801e0d:	83 c4 10             	add    $0x10,%esp
+  801e10:	85 c0                	test   %eax,%eax
+  801e12:	0f 88 f9 00 00 00    	js     801f11 <fsring_rw+0x161>
+  801e18:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e1e:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e24:	75 d7                	jne    801dfd <fsring_rw+0x4d>
+  801e26:	6a 0e                	push   $0xe
+  801e28:	6a 0d                	push   $0xd
+  801e2a:	ff 35 08 50 80 00    	push   0x805008
+  801e30:	68 00 00 f0 cf       	push   $0xcff00000
+  801e35:	e8 d8 0d 00 00       	call   802c12 <ipcring_init>
+  801e3a:	83 c4 08             	add    $0x8,%esp
+  801e3d:	6a 00                	push   $0x0
+  801e3f:	6a 00                	push   $0x0
+  801e41:	68 07 02 00 00       	push   $0x207
+  801e46:	68 00 00 f0 cf       	push   $0xcff00000
+  801e4b:	6a 0b                	push   $0xb
+  801e4d:	ff 35 08 50 80 00    	push   0x805008
+  801e53:	e8 4c 12 00 00       	call   8030a4 <ipc_call>
+  801e58:	89 c6                	mov    %eax,%esi
+  801e5a:	83 c4 20             	add    $0x20,%esp
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	0f 88 ac 00 00 00    	js     801f11 <fsring_rw+0x161>
+  801e65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e6a:	89 d9                	mov    %ebx,%ecx
+  801e6c:	83 c3 01             	add    $0x1,%ebx
+  801e6f:	89 da                	mov    %ebx,%edx
+  801e71:	c1 e2 0c             	shl    $0xc,%edx
+  801e74:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801e7a:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801e80:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801e86:	83 ec 08             	sub    $0x8,%esp
+  801e89:	6a 00                	push   $0x0
+  801e8b:	6a 00                	push   $0x0
+  801e8d:	68 07 02 00 00       	push   $0x207
+  801e92:	50                   	push   %eax
+  801e93:	6a 0c                	push   $0xc
+  801e95:	ff 35 08 50 80 00    	push   0x805008
+  801e9b:	e8 04 12 00 00       	call   8030a4 <ipc_call>
+  801ea0:	83 c4 20             	add    $0x20,%esp
+  801ea3:	85 c0                	test   %eax,%eax
+  801ea5:	78 6a                	js     801f11 <fsring_rw+0x161>
+  801ea7:	83 fb 08             	cmp    $0x8,%ebx
+  801eaa:	75 be                	jne    801e6a <fsring_rw+0xba>
+  801eac:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801eb0:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801eb5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801eba:	0f 45 c2             	cmovne %edx,%eax
+  801ebd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801ec0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801ec7:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801ece:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eda:	be 00 00 00 00       	mov    $0x0,%esi
+  801edf:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801ee2:	e9 4b 01 00 00       	jmp    802032 <fsring_rw+0x282>
+  801ee7:	e8 54 f2 ff ff       	call   801140 <sys_time_msec>
+  801eec:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801ef2:	0f 89 f3 fe ff ff    	jns    801deb <fsring_rw+0x3b>
+  801ef8:	eb 54                	jmp    801f4e <fsring_rw+0x19e>
+  801efa:	83 ec 0c             	sub    $0xc,%esp
+  801efd:	6a 02                	push   $0x2
+  801eff:	e8 3b 13 00 00       	call   80323f <ipc_find_env>
+  801f04:	a3 08 50 80 00       	mov    %eax,0x805008
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	e9 e7 fe ff ff       	jmp    801df8 <fsring_rw+0x48>
+  801f11:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f16:	83 ec 08             	sub    $0x8,%esp
+  801f19:	53                   	push   %ebx
+  801f1a:	6a 00                	push   $0x0
+  801f1c:	e8 27 ef ff ff       	call   800e48 <sys_page_unmap>
+  801f21:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801f30:	75 e4                	jne    801f16 <fsring_rw+0x166>
+  801f32:	e8 09 f2 ff ff       	call   801140 <sys_time_msec>
+  801f37:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801f3c:	a3 00 50 80 00       	mov    %eax,0x805000
+  801f41:	a1 10 50 80 00       	mov    0x805010,%eax
+  801f46:	8b 40 48             	mov    0x48(%eax),%eax
+  801f49:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f4e:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801f55:	e9 7a 01 00 00       	jmp    8020d4 <fsring_rw+0x324>
+  801f5a:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f5d:	89 10                	mov    %edx,(%eax)
+  801f5f:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f62:	89 f2                	mov    %esi,%edx
+  801f64:	03 57 04             	add    0x4(%edi),%edx
+  801f67:	89 50 08             	mov    %edx,0x8(%eax)
+  801f6a:	83 ec 04             	sub    $0x4,%esp
+  801f6d:	53                   	push   %ebx
+  801f6e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801f71:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801f74:	52                   	push   %edx
+  801f75:	83 c0 0c             	add    $0xc,%eax
+  801f78:	50                   	push   %eax
+  801f79:	e8 48 eb ff ff       	call   800ac6 <memmove>
+  801f7e:	83 c4 10             	add    $0x10,%esp
+  801f81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f84:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f87:	89 08                	mov    %ecx,(%eax)
+  801f89:	83 ec 0c             	sub    $0xc,%esp
+  801f8c:	68 00 00 f0 cf       	push   $0xcff00000
+  801f91:	e8 da 0c 00 00       	call   802c70 <ipcring_req_push>
+  801f96:	01 de                	add    %ebx,%esi
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f9e:	73 4c                	jae    801fec <fsring_rw+0x23c>
+  801fa0:	83 ec 0c             	sub    $0xc,%esp
+  801fa3:	68 00 00 f0 cf       	push   $0xcff00000
+  801fa8:	e8 9d 0c 00 00       	call   802c4a <ipcring_req_slot>
+  801fad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fb0:	83 c4 10             	add    $0x10,%esp
+  801fb3:	85 c0                	test   %eax,%eax
+  801fb5:	74 35                	je     801fec <fsring_rw+0x23c>
+  801fb7:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801fbc:	83 e0 07             	and    $0x7,%eax
+  801fbf:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801fc4:	c1 e0 0c             	shl    $0xc,%eax
+  801fc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801fca:	29 f3                	sub    %esi,%ebx
+  801fcc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801fcf:	39 cb                	cmp    %ecx,%ebx
+  801fd1:	0f 47 d9             	cmova  %ecx,%ebx
+  801fd4:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801fd8:	75 80                	jne    801f5a <fsring_rw+0x1aa>
+  801fda:	8b 57 0c             	mov    0xc(%edi),%edx
+  801fdd:	89 10                	mov    %edx,(%eax)
+  801fdf:	89 58 04             	mov    %ebx,0x4(%eax)
+  801fe2:	89 f2                	mov    %esi,%edx
+  801fe4:	03 57 04             	add    0x4(%edi),%edx
+  801fe7:	89 50 08             	mov    %edx,0x8(%eax)
+  801fea:	eb 95                	jmp    801f81 <fsring_rw+0x1d1>
+  801fec:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801ff1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ff4:	83 ec 0c             	sub    $0xc,%esp
+  801ff7:	68 00 00 f0 cf       	push   $0xcff00000
+  801ffc:	e8 a8 0c 00 00       	call   802ca9 <ipcring_rsp_wait>
+  802001:	8b 58 04             	mov    0x4(%eax),%ebx
+  802004:	83 c4 10             	add    $0x10,%esp
+  802007:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80200b:	75 45                	jne    802052 <fsring_rw+0x2a2>
+  80200d:	85 db                	test   %ebx,%ebx
+  80200f:	79 41                	jns    802052 <fsring_rw+0x2a2>
+  802011:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802014:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80201b:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802022:	83 ec 0c             	sub    $0xc,%esp
+  802025:	68 00 00 f0 cf       	push   $0xcff00000
+  80202a:	e8 e0 0c 00 00       	call   802d0f <ipcring_rsp_pop>
+  80202f:	83 c4 10             	add    $0x10,%esp
+  802032:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802038:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80203d:	39 c2                	cmp    %eax,%edx
+  80203f:	74 75                	je     8020b6 <fsring_rw+0x306>
+  802041:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802045:	75 a5                	jne    801fec <fsring_rw+0x23c>
+  802047:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80204a:	0f 82 50 ff ff ff    	jb     801fa0 <fsring_rw+0x1f0>
+  802050:	eb 9a                	jmp    801fec <fsring_rw+0x23c>
+  802052:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802056:	75 ca                	jne    802022 <fsring_rw+0x272>
+  802058:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80205c:	74 31                	je     80208f <fsring_rw+0x2df>
+  80205e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802061:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802064:	29 c8                	sub    %ecx,%eax
+  802066:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802069:	39 d0                	cmp    %edx,%eax
+  80206b:	0f 47 c2             	cmova  %edx,%eax
+  80206e:	39 d8                	cmp    %ebx,%eax
+  802070:	ba 01 00 00 00       	mov    $0x1,%edx
+  802075:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802079:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80207c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802081:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802085:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802088:	01 d9                	add    %ebx,%ecx
+  80208a:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80208d:	eb 93                	jmp    802022 <fsring_rw+0x272>
+  80208f:	83 ec 04             	sub    $0x4,%esp
+  802092:	53                   	push   %ebx
+  802093:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802096:	83 e0 07             	and    $0x7,%eax
+  802099:	c1 e0 0c             	shl    $0xc,%eax
+  80209c:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8020a2:	50                   	push   %eax
+  8020a3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8020a6:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8020a9:	01 c8                	add    %ecx,%eax
+  8020ab:	50                   	push   %eax
+  8020ac:	e8 15 ea ff ff       	call   800ac6 <memmove>
+  8020b1:	83 c4 10             	add    $0x10,%esp
+  8020b4:	eb a8                	jmp    80205e <fsring_rw+0x2ae>
+  8020b6:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8020ba:	75 09                	jne    8020c5 <fsring_rw+0x315>
+  8020bc:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8020bf:	0f 82 db fe ff ff    	jb     801fa0 <fsring_rw+0x1f0>
+  8020c5:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8020c8:	01 57 04             	add    %edx,0x4(%edi)
+  8020cb:	85 d2                	test   %edx,%edx
+  8020cd:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8020d1:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8020d4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8020d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020da:	5b                   	pop    %ebx
+  8020db:	5e                   	pop    %esi
+  8020dc:	5f                   	pop    %edi
+  8020dd:	5d                   	pop    %ebp
+  8020de:	c3                   	ret
+
+008020df <devfile_write>:
+  8020df:	55                   	push   %ebp
+  8020e0:	89 e5                	mov    %esp,%ebp
+  8020e2:	57                   	push   %edi
+  8020e3:	56                   	push   %esi
+  8020e4:	53                   	push   %ebx
+  8020e5:	83 ec 0c             	sub    $0xc,%esp
+  8020e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020f1:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8020f7:	76 1a                	jbe    802113 <devfile_write+0x34>
+  8020f9:	83 ec 0c             	sub    $0xc,%esp
+  8020fc:	53                   	push   %ebx
+  8020fd:	89 f1                	mov    %esi,%ecx
+  8020ff:	ba 06 00 00 00       	mov    $0x6,%edx
+  802104:	89 f8                	mov    %edi,%eax
+  802106:	e8 a5 fc ff ff       	call   801db0 <fsring_rw>
+  80210b:	83 c4 10             	add    $0x10,%esp
+  80210e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802111:	75 39                	jne    80214c <devfile_write+0x6d>
+  802113:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802118:	39 c3                	cmp    %eax,%ebx
+  80211a:	0f 47 d8             	cmova  %eax,%ebx
+  80211d:	8b 47 0c             	mov    0xc(%edi),%eax
+  802120:	a3 00 60 80 00       	mov    %eax,0x806000
+  802125:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80212b:	83 ec 04             	sub    $0x4,%esp
+  80212e:	53                   	push   %ebx
+  80212f:	56                   	push   %esi
+  802130:	68 08 60 80 00       	push   $0x806008
+  802135:	e8 8c e9 ff ff       	call   800ac6 <memmove>
+  80213a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802144:	e8 7c fb ff ff       	call   801cc5 <fsipc>
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214f:	5b                   	pop    %ebx
+  802150:	5e                   	pop    %esi
+  802151:	5f                   	pop    %edi
+  802152:	5d                   	pop    %ebp
+  802153:	c3                   	ret
+
+00802154 <devfile_read>:
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	57                   	push   %edi
+  802158:	56                   	push   %esi
+  802159:	53                   	push   %ebx
+  80215a:	83 ec 0c             	sub    $0xc,%esp
+  80215d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802160:	8b 75 10             	mov    0x10(%ebp),%esi
+  802163:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802169:	76 1d                	jbe    802188 <devfile_read+0x34>
+  80216b:	83 ec 0c             	sub    $0xc,%esp
+  80216e:	56                   	push   %esi
+  80216f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802172:	ba 05 00 00 00       	mov    $0x5,%edx
+  802177:	89 f8                	mov    %edi,%eax
+  802179:	e8 32 fc ff ff       	call   801db0 <fsring_rw>
+  80217e:	89 c3                	mov    %eax,%ebx
+  802180:	83 c4 10             	add    $0x10,%esp
+  802183:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802186:	75 37                	jne    8021bf <devfile_read+0x6b>
+  802188:	8b 47 0c             	mov    0xc(%edi),%eax
+  80218b:	a3 00 60 80 00       	mov    %eax,0x806000
+  802190:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802196:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219b:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021a0:	e8 20 fb ff ff       	call   801cc5 <fsipc>
+  8021a5:	89 c3                	mov    %eax,%ebx
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	78 14                	js     8021bf <devfile_read+0x6b>
+  8021ab:	83 ec 04             	sub    $0x4,%esp
+  8021ae:	50                   	push   %eax
+  8021af:	68 00 60 80 00       	push   $0x806000
+  8021b4:	ff 75 0c             	push   0xc(%ebp)
+  8021b7:	e8 0a e9 ff ff       	call   800ac6 <memmove>
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	89 d8                	mov    %ebx,%eax
+  8021c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c4:	5b                   	pop    %ebx
+  8021c5:	5e                   	pop    %esi
+  8021c6:	5f                   	pop    %edi
+  8021c7:	5d                   	pop    %ebp
+  8021c8:	c3                   	ret
+
+008021c9 <open>:
+  8021c9:	55                   	push   %ebp
+  8021ca:	89 e5                	mov    %esp,%ebp
+  8021cc:	56                   	push   %esi
+  8021cd:	53                   	push   %ebx
+  8021ce:	83 ec 1c             	sub    $0x1c,%esp
+  8021d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021d4:	56                   	push   %esi
+  8021d5:	e8 f0 e6 ff ff       	call   8008ca <strlen>
+  8021da:	83 c4 10             	add    $0x10,%esp
+  8021dd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021e2:	7f 6c                	jg     802250 <open+0x87>
+  8021e4:	83 ec 0c             	sub    $0xc,%esp
+  8021e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ea:	50                   	push   %eax
+  8021eb:	e8 6a f5 ff ff       	call   80175a <fd_alloc>
+  8021f0:	89 c3                	mov    %eax,%ebx
+  8021f2:	83 c4 10             	add    $0x10,%esp
+  8021f5:	85 c0                	test   %eax,%eax
+  8021f7:	78 3c                	js     802235 <open+0x6c>
+  8021f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021fc:	a3 00 64 80 00       	mov    %eax,0x806400
+  802201:	83 ec 08             	sub    $0x8,%esp
+  802204:	56                   	push   %esi
+  802205:	68 00 60 80 00       	push   $0x806000
+  80220a:	e8 07 e7 ff ff       	call   800916 <strcpy>
+  80220f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802212:	b8 01 00 00 00       	mov    $0x1,%eax
+  802217:	e8 a9 fa ff ff       	call   801cc5 <fsipc>
+  80221c:	89 c3                	mov    %eax,%ebx
+  80221e:	83 c4 10             	add    $0x10,%esp
+  802221:	85 c0                	test   %eax,%eax
+  802223:	78 19                	js     80223e <open+0x75>
+  802225:	83 ec 0c             	sub    $0xc,%esp
+  802228:	ff 75 f4             	push   -0xc(%ebp)
+  80222b:	e8 03 f5 ff ff       	call   801733 <fd2num>
+  802230:	89 c3                	mov    %eax,%ebx
+  802232:	83 c4 10             	add    $0x10,%esp
+  802235:	89 d8                	mov    %ebx,%eax
+  802237:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80223a:	5b                   	pop    %ebx
+  80223b:	5e                   	pop    %esi
+  80223c:	5d                   	pop    %ebp
+  80223d:	c3                   	ret
+  80223e:	83 ec 08             	sub    $0x8,%esp
+  802241:	6a 00                	push   $0x0
+  802243:	ff 75 f4             	push   -0xc(%ebp)
+  802246:	e8 05 f6 ff ff       	call   801850 <fd_close>
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	eb e5                	jmp    802235 <open+0x6c>
+  802250:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802255:	eb de                	jmp    802235 <open+0x6c>
+
+00802257 <file_image>:
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	53                   	push   %ebx
+  80225b:	83 ec 1c             	sub    $0x1c,%esp
+  80225e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802261:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802264:	50                   	push   %eax
+  802265:	ff 75 08             	push   0x8(%ebp)
+  802268:	e8 3d f5 ff ff       	call   8017aa <fd_lookup>
+  80226d:	83 c4 10             	add    $0x10,%esp
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 58                	js     8022cc <file_image+0x75>
+  802274:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802277:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80227d:	39 08                	cmp    %ecx,(%eax)
+  80227f:	75 50                	jne    8022d1 <file_image+0x7a>
+  802281:	83 fb 04             	cmp    $0x4,%ebx
+  802284:	77 52                	ja     8022d8 <file_image+0x81>
+  802286:	8b 40 0c             	mov    0xc(%eax),%eax
+  802289:	a3 00 60 80 00       	mov    %eax,0x806000
+  80228e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802294:	83 ec 04             	sub    $0x4,%esp
+  802297:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80229a:	c1 e0 02             	shl    $0x2,%eax
+  80229d:	50                   	push   %eax
+  80229e:	ff 75 0c             	push   0xc(%ebp)
+  8022a1:	68 08 60 80 00       	push   $0x806008
+  8022a6:	e8 1b e8 ff ff       	call   800ac6 <memmove>
+  8022ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8022b5:	e8 0b fa ff ff       	call   801cc5 <fsipc>
+  8022ba:	83 c4 10             	add    $0x10,%esp
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	78 0b                	js     8022cc <file_image+0x75>
+  8022c1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8022c4:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8022ca:	89 0a                	mov    %ecx,(%edx)
+  8022cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022cf:	c9                   	leave
+  8022d0:	c3                   	ret
+  8022d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022d6:	eb f4                	jmp    8022cc <file_image+0x75>
+  8022d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022dd:	eb ed                	jmp    8022cc <file_image+0x75>
+
+008022df <remove>:
+  8022df:	55                   	push   %ebp
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	53                   	push   %ebx
+  8022e3:	83 ec 10             	sub    $0x10,%esp
+  8022e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022e9:	53                   	push   %ebx
+  8022ea:	e8 db e5 ff ff       	call   8008ca <strlen>
+  8022ef:	83 c4 10             	add    $0x10,%esp
+  8022f2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022f7:	7f 25                	jg     80231e <remove+0x3f>
+  8022f9:	83 ec 08             	sub    $0x8,%esp
+  8022fc:	53                   	push   %ebx
+  8022fd:	68 00 60 80 00       	push   $0x806000
+  802302:	e8 0f e6 ff ff       	call   800916 <strcpy>
+  802307:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802311:	e8 af f9 ff ff       	call   801cc5 <fsipc>
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+  80231e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802323:	eb f4                	jmp    802319 <remove+0x3a>
+
+00802325 <sync>:
+  802325:	55                   	push   %ebp
+  802326:	89 e5                	mov    %esp,%ebp
+  802328:	83 ec 08             	sub    $0x8,%esp
+  80232b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802330:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802335:	e8 8b f9 ff ff       	call   801cc5 <fsipc>
+  80233a:	c9                   	leave
+  80233b:	c3                   	ret
+
+0080233c <writebuf>:
+  80233c:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802340:	7f 01                	jg     802343 <writebuf+0x7>
+  802342:	c3                   	ret
+  802343:	55                   	push   %ebp
+  802344:	89 e5                	mov    %esp,%ebp
+  802346:	53                   	push   %ebx
+  802347:	83 ec 08             	sub    $0x8,%esp
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	ff 70 04             	push   0x4(%eax)
+  80234f:	8d 40 10             	lea    0x10(%eax),%eax
+  802352:	50                   	push   %eax
+  802353:	ff 33                	push   (%ebx)
+  802355:	e8 8d f7 ff ff       	call   801ae7 <write>
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	7e 03                	jle    802364 <writebuf+0x28>
+  802361:	01 43 08             	add    %eax,0x8(%ebx)
+  802364:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802367:	74 0d                	je     802376 <writebuf+0x3a>
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802370:	0f 4f c2             	cmovg  %edx,%eax
+  802373:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802376:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802379:	c9                   	leave
+  80237a:	c3                   	ret
+
+0080237b <putch>:
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	53                   	push   %ebx
+  80237f:	83 ec 04             	sub    $0x4,%esp
+  802382:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802385:	8b 53 04             	mov    0x4(%ebx),%edx
+  802388:	8d 42 01             	lea    0x1(%edx),%eax
+  80238b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80238e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802391:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  802395:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80239a:	74 05                	je     8023a1 <putch+0x26>
+  80239c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239f:	c9                   	leave
+  8023a0:	c3                   	ret
+  8023a1:	89 d8                	mov    %ebx,%eax
+  8023a3:	e8 94 ff ff ff       	call   80233c <writebuf>
+  8023a8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  8023af:	eb eb                	jmp    80239c <putch+0x21>
+
+008023b1 <vfprintf>:
+  8023b1:	55                   	push   %ebp
+  8023b2:	89 e5                	mov    %esp,%ebp
+  8023b4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8023ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bd:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  8023c3:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8023ca:	00 00 00 
+  8023cd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8023d4:	00 00 00 
+  8023d7:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8023de:	00 00 00 
+  8023e1:	ff 75 10             	push   0x10(%ebp)
+  8023e4:	ff 75 0c             	push   0xc(%ebp)
+  8023e7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8023ed:	50                   	push   %eax
+  8023ee:	68 7b 23 80 00       	push   $0x80237b
+  8023f3:	e8 26 df ff ff       	call   80031e <vprintfmt>
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802402:	7f 12                	jg     802416 <vfprintf+0x65>
+  802404:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80240a:	85 c0                	test   %eax,%eax
+  80240c:	75 06                	jne    802414 <vfprintf+0x63>
+  80240e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802414:	c9                   	leave
+  802415:	c3                   	ret
+  802416:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80241c:	e8 1b ff ff ff       	call   80233c <writebuf>
+  802421:	eb e1                	jmp    802404 <vfprintf+0x53>
+
+00802423 <fprintf>:
+  802423:	55                   	push   %ebp
+  802424:	89 e5                	mov    %esp,%ebp
+  802426:	83 ec 0c             	sub    $0xc,%esp
+  802429:	8d 45 10             	lea    0x10(%ebp),%eax
+  80242c:	50                   	push   %eax
+  80242d:	ff 75 0c             	push   0xc(%ebp)
+  802430:	ff 75 08             	push   0x8(%ebp)
+  802433:	e8 79 ff ff ff       	call   8023b1 <vfprintf>
+  802438:	c9                   	leave
+  802439:	c3                   	ret
+
+0080243a <printf>:
+  80243a:	55                   	push   %ebp
+  80243b:	89 e5                	mov    %esp,%ebp
+  80243d:	83 ec 0c             	sub    $0xc,%esp
+  802440:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802443:	50                   	push   %eax
+  802444:	ff 75 08             	push   0x8(%ebp)
+  802447:	6a 01                	push   $0x1
+  802449:	e8 63 ff ff ff       	call   8023b1 <vfprintf>
+  80244e:	c9                   	leave
+  80244f:	c3                   	ret
+
+00802450 <devsock_stat>:
+  802450:	55                   	push   %ebp
+  802451:	89 e5                	mov    %esp,%ebp
+  802453:	83 ec 10             	sub    $0x10,%esp
+  802456:	68 a8 38 80 00       	push   $0x8038a8
+  80245b:	ff 75 0c             	push   0xc(%ebp)
+  80245e:	e8 b3 e4 ff ff       	call   800916 <strcpy>
+  802463:	b8 00 00 00 00       	mov    $0x0,%eax
+  802468:	c9                   	leave
+  802469:	c3                   	ret
+
+0080246a <devsock_close>:
+  80246a:	55                   	push   %ebp
+  80246b:	89 e5                	mov    %esp,%ebp
+  80246d:	53                   	push   %ebx
+  80246e:	83 ec 10             	sub    $0x10,%esp
+  802471:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802474:	53                   	push   %ebx
+  802475:	e8 df 0d 00 00       	call   803259 <pageref>
+  80247a:	89 c2                	mov    %eax,%edx
+  80247c:	83 c4 10             	add    $0x10,%esp
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802484:	83 fa 01             	cmp    $0x1,%edx
+  802487:	74 05                	je     80248e <devsock_close+0x24>
+  802489:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+  80248e:	83 ec 0c             	sub    $0xc,%esp
+  802491:	ff 73 0c             	push   0xc(%ebx)
+  802494:	e8 aa 02 00 00       	call   802743 <nsipc_close>
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	eb eb                	jmp    802489 <devsock_close+0x1f>
+
+0080249e <devsock_write>:
+  80249e:	55                   	push   %ebp
+  80249f:	89 e5                	mov    %esp,%ebp
+  8024a1:	83 ec 08             	sub    $0x8,%esp
+  8024a4:	6a 00                	push   $0x0
+  8024a6:	ff 75 10             	push   0x10(%ebp)
+  8024a9:	ff 75 0c             	push   0xc(%ebp)
+  8024ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024af:	ff 70 0c             	push   0xc(%eax)
+  8024b2:	e8 6c 03 00 00       	call   802823 <nsipc_send>
+  8024b7:	c9                   	leave
+  8024b8:	c3                   	ret
+
+008024b9 <devsock_read>:
+  8024b9:	55                   	push   %ebp
+  8024ba:	89 e5                	mov    %esp,%ebp
+  8024bc:	83 ec 08             	sub    $0x8,%esp
+  8024bf:	6a 00                	push   $0x0
+  8024c1:	ff 75 10             	push   0x10(%ebp)
+  8024c4:	ff 75 0c             	push   0xc(%ebp)
+  8024c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ca:	ff 70 0c             	push   0xc(%eax)
+  8024cd:	e8 e2 02 00 00       	call   8027b4 <nsipc_recv>
+  8024d2:	c9                   	leave
+  8024d3:	c3                   	ret
+
+008024d4 <fd2sockid>:
+  8024d4:	55                   	push   %ebp
+  8024d5:	89 e5                	mov    %esp,%ebp
+  8024d7:	83 ec 20             	sub    $0x20,%esp
+  8024da:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024dd:	52                   	push   %edx
+  8024de:	50                   	push   %eax
+  8024df:	e8 c6 f2 ff ff       	call   8017aa <fd_lookup>
+  8024e4:	83 c4 10             	add    $0x10,%esp
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	78 10                	js     8024fb <fd2sockid+0x27>
+  8024eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ee:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8024f4:	39 08                	cmp    %ecx,(%eax)
+  8024f6:	75 05                	jne    8024fd <fd2sockid+0x29>
+  8024f8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024fb:	c9                   	leave
+  8024fc:	c3                   	ret
+  8024fd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802502:	eb f7                	jmp    8024fb <fd2sockid+0x27>
+
+00802504 <alloc_sockfd>:
+  802504:	55                   	push   %ebp
+  802505:	89 e5                	mov    %esp,%ebp
+  802507:	56                   	push   %esi
+  802508:	53                   	push   %ebx
+  802509:	83 ec 1c             	sub    $0x1c,%esp
+  80250c:	89 c6                	mov    %eax,%esi
+  80250e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802511:	50                   	push   %eax
+  802512:	e8 43 f2 ff ff       	call   80175a <fd_alloc>
+  802517:	89 c3                	mov    %eax,%ebx
+  802519:	83 c4 10             	add    $0x10,%esp
+  80251c:	85 c0                	test   %eax,%eax
+  80251e:	78 43                	js     802563 <alloc_sockfd+0x5f>
+  802520:	83 ec 04             	sub    $0x4,%esp
+  802523:	68 07 04 00 00       	push   $0x407
+  802528:	ff 75 f4             	push   -0xc(%ebp)
+  80252b:	6a 00                	push   $0x0
+  80252d:	e8 44 e8 ff ff       	call   800d76 <sys_page_alloc>
+  802532:	89 c3                	mov    %eax,%ebx
+  802534:	83 c4 10             	add    $0x10,%esp
+  802537:	85 c0                	test   %eax,%eax
+  802539:	78 28                	js     802563 <alloc_sockfd+0x5f>
+  80253b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80253e:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802544:	89 10                	mov    %edx,(%eax)
+  802546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802549:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802550:	89 70 0c             	mov    %esi,0xc(%eax)
+  802553:	83 ec 0c             	sub    $0xc,%esp
+  802556:	50                   	push   %eax
+  802557:	e8 d7 f1 ff ff       	call   801733 <fd2num>
+  80255c:	89 c3                	mov    %eax,%ebx
+  80255e:	83 c4 10             	add    $0x10,%esp
+  802561:	eb 0c                	jmp    80256f <alloc_sockfd+0x6b>
+  802563:	83 ec 0c             	sub    $0xc,%esp
+  802566:	56                   	push   %esi
+  802567:	e8 d7 01 00 00       	call   802743 <nsipc_close>
+  80256c:	83 c4 10             	add    $0x10,%esp
+  80256f:	89 d8                	mov    %ebx,%eax
+  802571:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802574:	5b                   	pop    %ebx
+  802575:	5e                   	pop    %esi
+  802576:	5d                   	pop    %ebp
+  802577:	c3                   	ret
+
+00802578 <accept>:
+  802578:	55                   	push   %ebp
+  802579:	89 e5                	mov    %esp,%ebp
+  80257b:	83 ec 08             	sub    $0x8,%esp
+  80257e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802581:	e8 4e ff ff ff       	call   8024d4 <fd2sockid>
+  802586:	85 c0                	test   %eax,%eax
+  802588:	78 1b                	js     8025a5 <accept+0x2d>
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	ff 75 10             	push   0x10(%ebp)
+  802590:	ff 75 0c             	push   0xc(%ebp)
+  802593:	50                   	push   %eax
+  802594:	e8 07 01 00 00       	call   8026a0 <nsipc_accept>
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 05                	js     8025a5 <accept+0x2d>
+  8025a0:	e8 5f ff ff ff       	call   802504 <alloc_sockfd>
+  8025a5:	c9                   	leave
+  8025a6:	c3                   	ret
+
+008025a7 <bind>:
+  8025a7:	55                   	push   %ebp
+  8025a8:	89 e5                	mov    %esp,%ebp
+  8025aa:	83 ec 08             	sub    $0x8,%esp
+  8025ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b0:	e8 1f ff ff ff       	call   8024d4 <fd2sockid>
+  8025b5:	85 c0                	test   %eax,%eax
+  8025b7:	78 12                	js     8025cb <bind+0x24>
+  8025b9:	83 ec 04             	sub    $0x4,%esp
+  8025bc:	ff 75 10             	push   0x10(%ebp)
+  8025bf:	ff 75 0c             	push   0xc(%ebp)
+  8025c2:	50                   	push   %eax
+  8025c3:	e8 24 01 00 00       	call   8026ec <nsipc_bind>
+  8025c8:	83 c4 10             	add    $0x10,%esp
+  8025cb:	c9                   	leave
+  8025cc:	c3                   	ret
+
+008025cd <shutdown>:
+  8025cd:	55                   	push   %ebp
+  8025ce:	89 e5                	mov    %esp,%ebp
+  8025d0:	83 ec 08             	sub    $0x8,%esp
+  8025d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d6:	e8 f9 fe ff ff       	call   8024d4 <fd2sockid>
+  8025db:	85 c0                	test   %eax,%eax
+  8025dd:	78 0f                	js     8025ee <shutdown+0x21>
+  8025df:	83 ec 08             	sub    $0x8,%esp
+  8025e2:	ff 75 0c             	push   0xc(%ebp)
+  8025e5:	50                   	push   %eax
+  8025e6:	e8 36 01 00 00       	call   802721 <nsipc_shutdown>
+  8025eb:	83 c4 10             	add    $0x10,%esp
+  8025ee:	c9                   	leave
+  8025ef:	c3                   	ret
+
+008025f0 <connect>:
+  8025f0:	55                   	push   %ebp
+  8025f1:	89 e5                	mov    %esp,%ebp
+  8025f3:	83 ec 08             	sub    $0x8,%esp
+  8025f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f9:	e8 d6 fe ff ff       	call   8024d4 <fd2sockid>
+  8025fe:	85 c0                	test   %eax,%eax
+  802600:	78 12                	js     802614 <connect+0x24>
+  802602:	83 ec 04             	sub    $0x4,%esp
+  802605:	ff 75 10             	push   0x10(%ebp)
+  802608:	ff 75 0c             	push   0xc(%ebp)
+  80260b:	50                   	push   %eax
+  80260c:	e8 4c 01 00 00       	call   80275d <nsipc_connect>
+  802611:	83 c4 10             	add    $0x10,%esp
+  802614:	c9                   	leave
+  802615:	c3                   	ret
+
+00802616 <listen>:
+  802616:	55                   	push   %ebp
+  802617:	89 e5                	mov    %esp,%ebp
+  802619:	83 ec 08             	sub    $0x8,%esp
+  80261c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261f:	e8 b0 fe ff ff       	call   8024d4 <fd2sockid>
+  802624:	85 c0                	test   %eax,%eax
+  802626:	78 0f                	js     802637 <listen+0x21>
+  802628:	83 ec 08             	sub    $0x8,%esp
+  80262b:	ff 75 0c             	push   0xc(%ebp)
+  80262e:	50                   	push   %eax
+  80262f:	e8 5e 01 00 00       	call   802792 <nsipc_listen>
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	c9                   	leave
+  802638:	c3                   	ret
+
+00802639 <socket>:
+  802639:	55                   	push   %ebp
+  80263a:	89 e5                	mov    %esp,%ebp
+  80263c:	83 ec 0c             	sub    $0xc,%esp
+  80263f:	ff 75 10             	push   0x10(%ebp)
+  802642:	ff 75 0c             	push   0xc(%ebp)
+  802645:	ff 75 08             	push   0x8(%ebp)
+  802648:	e8 34 02 00 00       	call   802881 <nsipc_socket>
+  80264d:	83 c4 10             	add    $0x10,%esp
+  802650:	85 c0                	test   %eax,%eax
+  802652:	78 05                	js     802659 <socket+0x20>
+  802654:	e8 ab fe ff ff       	call   802504 <alloc_sockfd>
+  802659:	c9                   	leave
+  80265a:	c3                   	ret
+
+0080265b <nsipc>:
+  80265b:	55                   	push   %ebp
+  80265c:	89 e5                	mov    %esp,%ebp
+  80265e:	53                   	push   %ebx
+  80265f:	83 ec 04             	sub    $0x4,%esp
+  802662:	89 c3                	mov    %eax,%ebx
+  802664:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80266b:	74 1f                	je     80268c <nsipc+0x31>
+  80266d:	83 ec 08             	sub    $0x8,%esp
+  802670:	6a 00                	push   $0x0
+  802672:	6a 00                	push   $0x0
+  802674:	6a 07                	push   $0x7
+  802676:	68 00 70 80 00       	push   $0x807000
+  80267b:	53                   	push   %ebx
+  80267c:	ff 35 0c 50 80 00    	push   0x80500c
+  802682:	e8 1d 0a 00 00       	call   8030a4 <ipc_call>
+  802687:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80268a:	c9                   	leave
+  80268b:	c3                   	ret
+  80268c:	83 ec 0c             	sub    $0xc,%esp
+  80268f:	6a 03                	push   $0x3
+  802691:	e8 a9 0b 00 00       	call   80323f <ipc_find_env>
+  802696:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80269b:	83 c4 10             	add    $0x10,%esp
+  80269e:	eb cd                	jmp    80266d <nsipc+0x12>
+
+008026a0 <nsipc_accept>:
+  8026a0:	55                   	push   %ebp
+  8026a1:	89 e5                	mov    %esp,%ebp
+  8026a3:	53                   	push   %ebx
+  8026a4:	83 ec 04             	sub    $0x4,%esp
+  8026a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026aa:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026b4:	e8 a2 ff ff ff       	call   80265b <nsipc>
+  8026b9:	89 c3                	mov    %eax,%ebx
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	79 07                	jns    8026c6 <nsipc_accept+0x26>
+  8026bf:	89 d8                	mov    %ebx,%eax
+  8026c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026c4:	c9                   	leave
+  8026c5:	c3                   	ret
+  8026c6:	83 ec 04             	sub    $0x4,%esp
+  8026c9:	ff 35 10 70 80 00    	push   0x807010
+  8026cf:	68 00 70 80 00       	push   $0x807000
+  8026d4:	ff 75 0c             	push   0xc(%ebp)
+  8026d7:	e8 ea e3 ff ff       	call   800ac6 <memmove>
+  8026dc:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8026e2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026e5:	89 10                	mov    %edx,(%eax)
+  8026e7:	83 c4 10             	add    $0x10,%esp
+  8026ea:	eb d3                	jmp    8026bf <nsipc_accept+0x1f>
+
+008026ec <nsipc_bind>:
+  8026ec:	55                   	push   %ebp
+  8026ed:	89 e5                	mov    %esp,%ebp
+  8026ef:	53                   	push   %ebx
+  8026f0:	83 ec 08             	sub    $0x8,%esp
+  8026f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026fe:	53                   	push   %ebx
+  8026ff:	ff 75 0c             	push   0xc(%ebp)
+  802702:	68 04 70 80 00       	push   $0x807004
+  802707:	e8 ba e3 ff ff       	call   800ac6 <memmove>
+  80270c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802712:	b8 02 00 00 00       	mov    $0x2,%eax
+  802717:	e8 3f ff ff ff       	call   80265b <nsipc>
+  80271c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80271f:	c9                   	leave
+  802720:	c3                   	ret
+
+00802721 <nsipc_shutdown>:
+  802721:	55                   	push   %ebp
+  802722:	89 e5                	mov    %esp,%ebp
+  802724:	83 ec 08             	sub    $0x8,%esp
+  802727:	8b 45 08             	mov    0x8(%ebp),%eax
+  80272a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80272f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802732:	a3 04 70 80 00       	mov    %eax,0x807004
+  802737:	b8 03 00 00 00       	mov    $0x3,%eax
+  80273c:	e8 1a ff ff ff       	call   80265b <nsipc>
+  802741:	c9                   	leave
+  802742:	c3                   	ret
+
+00802743 <nsipc_close>:
+  802743:	55                   	push   %ebp
+  802744:	89 e5                	mov    %esp,%ebp
+  802746:	83 ec 08             	sub    $0x8,%esp
+  802749:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802751:	b8 04 00 00 00       	mov    $0x4,%eax
+  802756:	e8 00 ff ff ff       	call   80265b <nsipc>
+  80275b:	c9                   	leave
+  80275c:	c3                   	ret
+
+0080275d <nsipc_connect>:
+  80275d:	55                   	push   %ebp
+  80275e:	89 e5                	mov    %esp,%ebp
+  802760:	53                   	push   %ebx
+  802761:	83 ec 08             	sub    $0x8,%esp
+  802764:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802767:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80276f:	53                   	push   %ebx
+  802770:	ff 75 0c             	push   0xc(%ebp)
+  802773:	68 04 70 80 00       	push   $0x807004
+  802778:	e8 49 e3 ff ff       	call   800ac6 <memmove>
+  80277d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802783:	b8 05 00 00 00       	mov    $0x5,%eax
+  802788:	e8 ce fe ff ff       	call   80265b <nsipc>
+  80278d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802790:	c9                   	leave
+  802791:	c3                   	ret
+
+00802792 <nsipc_listen>:
+  802792:	55                   	push   %ebp
+  802793:	89 e5                	mov    %esp,%ebp
+  802795:	83 ec 08             	sub    $0x8,%esp
+  802798:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279b:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027a3:	a3 04 70 80 00       	mov    %eax,0x807004
+  8027a8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8027ad:	e8 a9 fe ff ff       	call   80265b <nsipc>
+  8027b2:	c9                   	leave
+  8027b3:	c3                   	ret
+
+008027b4 <nsipc_recv>:
+  8027b4:	55                   	push   %ebp
+  8027b5:	89 e5                	mov    %esp,%ebp
+  8027b7:	56                   	push   %esi
+  8027b8:	53                   	push   %ebx
+  8027b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8027bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027bf:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027c4:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8027ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027cd:	a3 08 70 80 00       	mov    %eax,0x807008
+  8027d2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027d7:	e8 7f fe ff ff       	call   80265b <nsipc>
+  8027dc:	89 c3                	mov    %eax,%ebx
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	78 22                	js     802804 <nsipc_recv+0x50>
+  8027e2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8027e7:	39 c6                	cmp    %eax,%esi
+  8027e9:	0f 4e c6             	cmovle %esi,%eax
+  8027ec:	39 c3                	cmp    %eax,%ebx
+  8027ee:	7f 1d                	jg     80280d <nsipc_recv+0x59>
+  8027f0:	83 ec 04             	sub    $0x4,%esp
+  8027f3:	53                   	push   %ebx
+  8027f4:	68 00 70 80 00       	push   $0x807000
+  8027f9:	ff 75 0c             	push   0xc(%ebp)
+  8027fc:	e8 c5 e2 ff ff       	call   800ac6 <memmove>
+  802801:	83 c4 10             	add    $0x10,%esp
+  802804:	89 d8                	mov    %ebx,%eax
+  802806:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802809:	5b                   	pop    %ebx
+  80280a:	5e                   	pop    %esi
+  80280b:	5d                   	pop    %ebp
+  80280c:	c3                   	ret
+  80280d:	68 b4 38 80 00       	push   $0x8038b4
+  802812:	68 c9 38 80 00       	push   $0x8038c9
+  802817:	6a 60                	push   $0x60
+  802819:	68 de 38 80 00       	push   $0x8038de
+  80281e:	e8 83 07 00 00       	call   802fa6 <_panic>
+
+00802823 <nsipc_send>:
+  802823:	55                   	push   %ebp
+  802824:	89 e5                	mov    %esp,%ebp
+  802826:	53                   	push   %ebx
+  802827:	83 ec 04             	sub    $0x4,%esp
+  80282a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80282d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802830:	a3 00 70 80 00       	mov    %eax,0x807000
+  802835:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80283b:	7f 2e                	jg     80286b <nsipc_send+0x48>
+  80283d:	83 ec 04             	sub    $0x4,%esp
+  802840:	53                   	push   %ebx
+  802841:	ff 75 0c             	push   0xc(%ebp)
+  802844:	68 0c 70 80 00       	push   $0x80700c
+  802849:	e8 78 e2 ff ff       	call   800ac6 <memmove>
+  80284e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802854:	8b 45 14             	mov    0x14(%ebp),%eax
+  802857:	a3 08 70 80 00       	mov    %eax,0x807008
+  80285c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802861:	e8 f5 fd ff ff       	call   80265b <nsipc>
+  802866:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802869:	c9                   	leave
+  80286a:	c3                   	ret
+  80286b:	68 ea 38 80 00       	push   $0x8038ea
+  802870:	68 c9 38 80 00       	push   $0x8038c9
+  802875:	6a 6b                	push   $0x6b
+  802877:	68 de 38 80 00       	push   $0x8038de
+  80287c:	e8 25 07 00 00       	call   802fa6 <_panic>
+
+00802881 <nsipc_socket>:
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	83 ec 08             	sub    $0x8,%esp
+  802887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80288f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802892:	a3 04 70 80 00       	mov    %eax,0x807004
+  802897:	8b 45 10             	mov    0x10(%ebp),%eax
+  80289a:	a3 08 70 80 00       	mov    %eax,0x807008
+  80289f:	b8 09 00 00 00       	mov    $0x9,%eax
+  8028a4:	e8 b2 fd ff ff       	call   80265b <nsipc>
+  8028a9:	c9                   	leave
+  8028aa:	c3                   	ret
+
+008028ab <devpipe_stat>:
+  8028ab:	55                   	push   %ebp
+  8028ac:	89 e5                	mov    %esp,%ebp
+  8028ae:	56                   	push   %esi
+  8028af:	53                   	push   %ebx
+  8028b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8028b3:	83 ec 0c             	sub    $0xc,%esp
+  8028b6:	ff 75 08             	push   0x8(%ebp)
+  8028b9:	e8 85 ee ff ff       	call   801743 <fd2data>
+  8028be:	89 c6                	mov    %eax,%esi
+  8028c0:	83 c4 08             	add    $0x8,%esp
+  8028c3:	68 f6 38 80 00       	push   $0x8038f6
+  8028c8:	53                   	push   %ebx
+  8028c9:	e8 48 e0 ff ff       	call   800916 <strcpy>
+  8028ce:	8b 46 04             	mov    0x4(%esi),%eax
+  8028d1:	2b 06                	sub    (%esi),%eax
+  8028d3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8028d9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8028e0:	00 00 00 
+  8028e3:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8028ea:	40 80 00 
+  8028ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028f5:	5b                   	pop    %ebx
+  8028f6:	5e                   	pop    %esi
+  8028f7:	5d                   	pop    %ebp
+  8028f8:	c3                   	ret
+
+008028f9 <devpipe_close>:
+  8028f9:	55                   	push   %ebp
+  8028fa:	89 e5                	mov    %esp,%ebp
+  8028fc:	53                   	push   %ebx
+  8028fd:	83 ec 0c             	sub    $0xc,%esp
+  802900:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802903:	53                   	push   %ebx
+  802904:	6a 00                	push   $0x0
+  802906:	e8 3d e5 ff ff       	call   800e48 <sys_page_unmap>
+  80290b:	89 1c 24             	mov    %ebx,(%esp)
+  80290e:	e8 30 ee ff ff       	call   801743 <fd2data>
+  802913:	83 c4 08             	add    $0x8,%esp
+  802916:	50                   	push   %eax
+  802917:	6a 00                	push   $0x0
+  802919:	e8 2a e5 ff ff       	call   800e48 <sys_page_unmap>
+  80291e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802921:	c9                   	leave
+  802922:	c3                   	ret
+
+00802923 <_pipeisclosed>:
+  802923:	55                   	push   %ebp
+  802924:	89 e5                	mov    %esp,%ebp
+  802926:	57                   	push   %edi
+  802927:	56                   	push   %esi
+  802928:	53                   	push   %ebx
+  802929:	83 ec 1c             	sub    $0x1c,%esp
+  80292c:	89 c7                	mov    %eax,%edi
+  80292e:	89 d6                	mov    %edx,%esi
+  802930:	a1 10 50 80 00       	mov    0x805010,%eax
+  802935:	8b 58 58             	mov    0x58(%eax),%ebx
+  802938:	83 ec 0c             	sub    $0xc,%esp
+  80293b:	57                   	push   %edi
+  80293c:	e8 18 09 00 00       	call   803259 <pageref>
+  802941:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802944:	89 34 24             	mov    %esi,(%esp)
+  802947:	e8 0d 09 00 00       	call   803259 <pageref>
+  80294c:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  802952:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802955:	83 c4 10             	add    $0x10,%esp
+  802958:	39 cb                	cmp    %ecx,%ebx
+  80295a:	74 1b                	je     802977 <_pipeisclosed+0x54>
+  80295c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80295f:	75 cf                	jne    802930 <_pipeisclosed+0xd>
+  802961:	8b 42 58             	mov    0x58(%edx),%eax
+  802964:	6a 01                	push   $0x1
+  802966:	50                   	push   %eax
+  802967:	53                   	push   %ebx
+  802968:	68 fd 38 80 00       	push   $0x8038fd
+  80296d:	e8 ad d8 ff ff       	call   80021f <cprintf>
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	eb b9                	jmp    802930 <_pipeisclosed+0xd>
+  802977:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80297a:	0f 94 c0             	sete   %al
+  80297d:	0f b6 c0             	movzbl %al,%eax
+  802980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802983:	5b                   	pop    %ebx
+  802984:	5e                   	pop    %esi
+  802985:	5f                   	pop    %edi
+  802986:	5d                   	pop    %ebp
+  802987:	c3                   	ret
+
+00802988 <devpipe_write>:
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	57                   	push   %edi
+  80298c:	56                   	push   %esi
+  80298d:	53                   	push   %ebx
+  80298e:	83 ec 28             	sub    $0x28,%esp
+  802991:	8b 75 08             	mov    0x8(%ebp),%esi
+  802994:	56                   	push   %esi
+  802995:	e8 a9 ed ff ff       	call   801743 <fd2data>
+  80299a:	89 c3                	mov    %eax,%ebx
+  80299c:	83 c4 10             	add    $0x10,%esp
+  80299f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029a4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029a8:	74 5c                	je     802a06 <devpipe_write+0x7e>
+  8029aa:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029ad:	8b 0b                	mov    (%ebx),%ecx
+  8029af:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029b2:	39 d0                	cmp    %edx,%eax
+  8029b4:	72 1e                	jb     8029d4 <devpipe_write+0x4c>
+  8029b6:	89 da                	mov    %ebx,%edx
+  8029b8:	89 f0                	mov    %esi,%eax
+  8029ba:	e8 64 ff ff ff       	call   802923 <_pipeisclosed>
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	75 48                	jne    802a0b <devpipe_write+0x83>
+  8029c3:	e8 63 e3 ff ff       	call   800d2b <sys_yield>
+  8029c8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029cb:	8b 0b                	mov    (%ebx),%ecx
+  8029cd:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029d0:	39 d0                	cmp    %edx,%eax
+  8029d2:	73 e2                	jae    8029b6 <devpipe_write+0x2e>
+  8029d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029d7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8029db:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8029de:	89 c2                	mov    %eax,%edx
+  8029e0:	c1 fa 1f             	sar    $0x1f,%edx
+  8029e3:	89 d1                	mov    %edx,%ecx
+  8029e5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8029e8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8029eb:	83 e2 1f             	and    $0x1f,%edx
+  8029ee:	29 ca                	sub    %ecx,%edx
+  8029f0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8029f4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8029f8:	83 c0 01             	add    $0x1,%eax
+  8029fb:	89 43 04             	mov    %eax,0x4(%ebx)
+  8029fe:	83 c7 01             	add    $0x1,%edi
+  802a01:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802a04:	75 a4                	jne    8029aa <devpipe_write+0x22>
+  802a06:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a09:	eb 05                	jmp    802a10 <devpipe_write+0x88>
+  802a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a13:	5b                   	pop    %ebx
+  802a14:	5e                   	pop    %esi
+  802a15:	5f                   	pop    %edi
+  802a16:	5d                   	pop    %ebp
+  802a17:	c3                   	ret
+
+00802a18 <devpipe_read>:
+  802a18:	55                   	push   %ebp
+  802a19:	89 e5                	mov    %esp,%ebp
+  802a1b:	57                   	push   %edi
+  802a1c:	56                   	push   %esi
+  802a1d:	53                   	push   %ebx
+  802a1e:	83 ec 18             	sub    $0x18,%esp
+  802a21:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a24:	56                   	push   %esi
+  802a25:	e8 19 ed ff ff       	call   801743 <fd2data>
+  802a2a:	89 c3                	mov    %eax,%ebx
+  802a2c:	83 c4 10             	add    $0x10,%esp
+  802a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a34:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a38:	74 45                	je     802a7f <devpipe_read+0x67>
+  802a3a:	8b 03                	mov    (%ebx),%eax
+  802a3c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a3f:	75 1d                	jne    802a5e <devpipe_read+0x46>
+  802a41:	85 ff                	test   %edi,%edi
+  802a43:	75 3f                	jne    802a84 <devpipe_read+0x6c>
+  802a45:	89 da                	mov    %ebx,%edx
+  802a47:	89 f0                	mov    %esi,%eax
+  802a49:	e8 d5 fe ff ff       	call   802923 <_pipeisclosed>
+  802a4e:	85 c0                	test   %eax,%eax
+  802a50:	75 3c                	jne    802a8e <devpipe_read+0x76>
+  802a52:	e8 d4 e2 ff ff       	call   800d2b <sys_yield>
+  802a57:	8b 03                	mov    (%ebx),%eax
+  802a59:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a5c:	74 e7                	je     802a45 <devpipe_read+0x2d>
+  802a5e:	99                   	cltd
+  802a5f:	c1 ea 1b             	shr    $0x1b,%edx
+  802a62:	01 d0                	add    %edx,%eax
+  802a64:	83 e0 1f             	and    $0x1f,%eax
+  802a67:	29 d0                	sub    %edx,%eax
+  802a69:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a71:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802a74:	83 03 01             	addl   $0x1,(%ebx)
+  802a77:	83 c7 01             	add    $0x1,%edi
+  802a7a:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802a7d:	75 bb                	jne    802a3a <devpipe_read+0x22>
+  802a7f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a82:	eb 02                	jmp    802a86 <devpipe_read+0x6e>
+  802a84:	89 f8                	mov    %edi,%eax
+  802a86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a89:	5b                   	pop    %ebx
+  802a8a:	5e                   	pop    %esi
+  802a8b:	5f                   	pop    %edi
+  802a8c:	5d                   	pop    %ebp
+  802a8d:	c3                   	ret
+  802a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a93:	eb f1                	jmp    802a86 <devpipe_read+0x6e>
+
+00802a95 <pipe>:
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+  802a98:	56                   	push   %esi
+  802a99:	53                   	push   %ebx
+  802a9a:	83 ec 1c             	sub    $0x1c,%esp
+  802a9d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa0:	50                   	push   %eax
+  802aa1:	e8 b4 ec ff ff       	call   80175a <fd_alloc>
+  802aa6:	89 c3                	mov    %eax,%ebx
+  802aa8:	83 c4 10             	add    $0x10,%esp
+  802aab:	85 c0                	test   %eax,%eax
+  802aad:	0f 88 23 01 00 00    	js     802bd6 <pipe+0x141>
+  802ab3:	83 ec 04             	sub    $0x4,%esp
+  802ab6:	68 07 04 00 00       	push   $0x407
+  802abb:	ff 75 f4             	push   -0xc(%ebp)
+  802abe:	6a 00                	push   $0x0
+  802ac0:	e8 b1 e2 ff ff       	call   800d76 <sys_page_alloc>
+  802ac5:	89 c3                	mov    %eax,%ebx
+  802ac7:	83 c4 10             	add    $0x10,%esp
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	0f 88 04 01 00 00    	js     802bd6 <pipe+0x141>
+  802ad2:	83 ec 0c             	sub    $0xc,%esp
+  802ad5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ad8:	50                   	push   %eax
+  802ad9:	e8 7c ec ff ff       	call   80175a <fd_alloc>
+  802ade:	89 c3                	mov    %eax,%ebx
+  802ae0:	83 c4 10             	add    $0x10,%esp
+  802ae3:	85 c0                	test   %eax,%eax
+  802ae5:	0f 88 db 00 00 00    	js     802bc6 <pipe+0x131>
+  802aeb:	83 ec 04             	sub    $0x4,%esp
+  802aee:	68 07 04 00 00       	push   $0x407
+  802af3:	ff 75 f0             	push   -0x10(%ebp)
+  802af6:	6a 00                	push   $0x0
+  802af8:	e8 79 e2 ff ff       	call   800d76 <sys_page_alloc>
+  802afd:	89 c3                	mov    %eax,%ebx
+  802aff:	83 c4 10             	add    $0x10,%esp
+  802b02:	85 c0                	test   %eax,%eax
+  802b04:	0f 88 bc 00 00 00    	js     802bc6 <pipe+0x131>
+  802b0a:	83 ec 0c             	sub    $0xc,%esp
+  802b0d:	ff 75 f4             	push   -0xc(%ebp)
+  802b10:	e8 2e ec ff ff       	call   801743 <fd2data>
+  802b15:	89 c6                	mov    %eax,%esi
+  802b17:	83 c4 0c             	add    $0xc,%esp
+  802b1a:	68 07 04 00 00       	push   $0x407
+  802b1f:	50                   	push   %eax
+  802b20:	6a 00                	push   $0x0
+  802b22:	e8 4f e2 ff ff       	call   800d76 <sys_page_alloc>
+  802b27:	89 c3                	mov    %eax,%ebx
+  802b29:	83 c4 10             	add    $0x10,%esp
+  802b2c:	85 c0                	test   %eax,%eax
+  802b2e:	0f 88 82 00 00 00    	js     802bb6 <pipe+0x121>
+  802b34:	83 ec 0c             	sub    $0xc,%esp
+  802b37:	ff 75 f0             	push   -0x10(%ebp)
+  802b3a:	e8 04 ec ff ff       	call   801743 <fd2data>
+  802b3f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b46:	50                   	push   %eax
+  802b47:	6a 00                	push   $0x0
+  802b49:	56                   	push   %esi
+  802b4a:	6a 00                	push   $0x0
+  802b4c:	e8 68 e2 ff ff       	call   800db9 <sys_page_map>
+  802b51:	89 c3                	mov    %eax,%ebx
+  802b53:	83 c4 20             	add    $0x20,%esp
+  802b56:	85 c0                	test   %eax,%eax
+  802b58:	78 4e                	js     802ba8 <pipe+0x113>
+  802b5a:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802b5f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b62:	89 02                	mov    %eax,(%edx)
+  802b64:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b67:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802b6e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b71:	89 02                	mov    %eax,(%edx)
+  802b73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b76:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802b7d:	83 ec 0c             	sub    $0xc,%esp
+  802b80:	ff 75 f4             	push   -0xc(%ebp)
+  802b83:	e8 ab eb ff ff       	call   801733 <fd2num>
+  802b88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b8b:	89 01                	mov    %eax,(%ecx)
+  802b8d:	83 c4 04             	add    $0x4,%esp
+  802b90:	ff 75 f0             	push   -0x10(%ebp)
+  802b93:	e8 9b eb ff ff       	call   801733 <fd2num>
+  802b98:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b9b:	89 41 04             	mov    %eax,0x4(%ecx)
+  802b9e:	83 c4 10             	add    $0x10,%esp
+  802ba1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ba6:	eb 2e                	jmp    802bd6 <pipe+0x141>
+  802ba8:	83 ec 08             	sub    $0x8,%esp
+  802bab:	56                   	push   %esi
+  802bac:	6a 00                	push   $0x0
+  802bae:	e8 95 e2 ff ff       	call   800e48 <sys_page_unmap>
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	83 ec 08             	sub    $0x8,%esp
+  802bb9:	ff 75 f0             	push   -0x10(%ebp)
+  802bbc:	6a 00                	push   $0x0
+  802bbe:	e8 85 e2 ff ff       	call   800e48 <sys_page_unmap>
+  802bc3:	83 c4 10             	add    $0x10,%esp
+  802bc6:	83 ec 08             	sub    $0x8,%esp
+  802bc9:	ff 75 f4             	push   -0xc(%ebp)
+  802bcc:	6a 00                	push   $0x0
+  802bce:	e8 75 e2 ff ff       	call   800e48 <sys_page_unmap>
+  802bd3:	83 c4 10             	add    $0x10,%esp
+  802bd6:	89 d8                	mov    %ebx,%eax
+  802bd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bdb:	5b                   	pop    %ebx
+  802bdc:	5e                   	pop    %esi
+  802bdd:	5d                   	pop    %ebp
+  802bde:	c3                   	ret
+
+00802bdf <pipeisclosed>:
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	83 ec 20             	sub    $0x20,%esp
+  802be5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802be8:	50                   	push   %eax
+  802be9:	ff 75 08             	push   0x8(%ebp)
+  802bec:	e8 b9 eb ff ff       	call   8017aa <fd_lookup>
+  802bf1:	83 c4 10             	add    $0x10,%esp
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	78 18                	js     802c10 <pipeisclosed+0x31>
+  802bf8:	83 ec 0c             	sub    $0xc,%esp
+  802bfb:	ff 75 f4             	push   -0xc(%ebp)
+  802bfe:	e8 40 eb ff ff       	call   801743 <fd2data>
+  802c03:	89 c2                	mov    %eax,%edx
+  802c05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c08:	e8 16 fd ff ff       	call   802923 <_pipeisclosed>
+  802c0d:	83 c4 10             	add    $0x10,%esp
+  802c10:	c9                   	leave
+  802c11:	c3                   	ret
+
+00802c12 <ipcring_init>:
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	53                   	push   %ebx
+  802c16:	83 ec 08             	sub    $0x8,%esp
+  802c19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c1c:	6a 60                	push   $0x60
+  802c1e:	6a 00                	push   $0x0
+  802c20:	53                   	push   %ebx
+  802c21:	e8 6b de ff ff       	call   800a91 <memset>
+  802c26:	a1 10 50 80 00       	mov    0x805010,%eax
+  802c2b:	8b 40 48             	mov    0x48(%eax),%eax
+  802c2e:	89 03                	mov    %eax,(%ebx)
+  802c30:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c33:	89 43 04             	mov    %eax,0x4(%ebx)
+  802c36:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c39:	89 43 08             	mov    %eax,0x8(%ebx)
+  802c3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c3f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802c42:	83 c4 10             	add    $0x10,%esp
+  802c45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c48:	c9                   	leave
+  802c49:	c3                   	ret
+
+00802c4a <ipcring_req_slot>:
+  802c4a:	55                   	push   %ebp
+  802c4b:	89 e5                	mov    %esp,%ebp
+  802c4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c50:	8b 50 10             	mov    0x10(%eax),%edx
+  802c53:	8b 48 18             	mov    0x18(%eax),%ecx
+  802c56:	29 ca                	sub    %ecx,%edx
+  802c58:	83 fa 07             	cmp    $0x7,%edx
+  802c5b:	77 0c                	ja     802c69 <ipcring_req_slot+0x1f>
+  802c5d:	8b 50 10             	mov    0x10(%eax),%edx
+  802c60:	83 e2 07             	and    $0x7,%edx
+  802c63:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802c67:	5d                   	pop    %ebp
+  802c68:	c3                   	ret
+  802c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6e:	eb f7                	jmp    802c67 <ipcring_req_slot+0x1d>
+
+00802c70 <ipcring_req_push>:
+  802c70:	55                   	push   %ebp
+  802c71:	89 e5                	mov    %esp,%ebp
+  802c73:	83 ec 08             	sub    $0x8,%esp
+  802c76:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c79:	8b 42 10             	mov    0x10(%edx),%eax
+  802c7c:	83 c0 01             	add    $0x1,%eax
+  802c7f:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c88:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802c8c:	85 c0                	test   %eax,%eax
+  802c8e:	75 02                	jne    802c92 <ipcring_req_push+0x22>
+  802c90:	c9                   	leave
+  802c91:	c3                   	ret
+  802c92:	6a 00                	push   $0x0
+  802c94:	68 00 00 80 ee       	push   $0xee800000
+  802c99:	ff 72 08             	push   0x8(%edx)
+  802c9c:	ff 72 04             	push   0x4(%edx)
+  802c9f:	e8 0a e4 ff ff       	call   8010ae <sys_ipc_send>
+  802ca4:	83 c4 10             	add    $0x10,%esp
+  802ca7:	eb e7                	jmp    802c90 <ipcring_req_push+0x20>
+
+00802ca9 <ipcring_rsp_wait>:
+  802ca9:	55                   	push   %ebp
+  802caa:	89 e5                	mov    %esp,%ebp
+  802cac:	53                   	push   %ebx
+  802cad:	83 ec 04             	sub    $0x4,%esp
+  802cb0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802cb3:	8b 53 18             	mov    0x18(%ebx),%edx
+  802cb6:	8b 43 10             	mov    0x10(%ebx),%eax
+  802cb9:	39 c2                	cmp    %eax,%edx
+  802cbb:	74 3c                	je     802cf9 <ipcring_rsp_wait+0x50>
+  802cbd:	8b 53 14             	mov    0x14(%ebx),%edx
+  802cc0:	8b 43 18             	mov    0x18(%ebx),%eax
+  802cc3:	39 c2                	cmp    %eax,%edx
+  802cc5:	75 23                	jne    802cea <ipcring_rsp_wait+0x41>
+  802cc7:	83 ec 08             	sub    $0x8,%esp
+  802cca:	6a 00                	push   $0x0
+  802ccc:	6a 00                	push   $0x0
+  802cce:	6a 00                	push   $0x0
+  802cd0:	6a 00                	push   $0x0
+  802cd2:	ff 73 0c             	push   0xc(%ebx)
+  802cd5:	ff 73 04             	push   0x4(%ebx)
+  802cd8:	e8 c7 03 00 00       	call   8030a4 <ipc_call>
+  802cdd:	8b 53 14             	mov    0x14(%ebx),%edx
+  802ce0:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ce3:	83 c4 20             	add    $0x20,%esp
+  802ce6:	39 c2                	cmp    %eax,%edx
+  802ce8:	74 dd                	je     802cc7 <ipcring_rsp_wait+0x1e>
+  802cea:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ced:	83 e0 07             	and    $0x7,%eax
+  802cf0:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802cf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cf7:	c9                   	leave
+  802cf8:	c3                   	ret
+  802cf9:	68 18 39 80 00       	push   $0x803918
+  802cfe:	68 c9 38 80 00       	push   $0x8038c9
+  802d03:	6a 3b                	push   $0x3b
+  802d05:	68 39 39 80 00       	push   $0x803939
+  802d0a:	e8 97 02 00 00       	call   802fa6 <_panic>
+
+00802d0f <ipcring_rsp_pop>:
+  802d0f:	55                   	push   %ebp
+  802d10:	89 e5                	mov    %esp,%ebp
+  802d12:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d15:	8b 42 18             	mov    0x18(%edx),%eax
+  802d18:	83 c0 01             	add    $0x1,%eax
+  802d1b:	89 42 18             	mov    %eax,0x18(%edx)
+  802d1e:	5d                   	pop    %ebp
+  802d1f:	c3                   	ret
+
+00802d20 <ipcring_server_init>:
+  802d20:	55                   	push   %ebp
+  802d21:	89 e5                	mov    %esp,%ebp
+  802d23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d29:	89 10                	mov    %edx,(%eax)
+  802d2b:	8b 55 10             	mov    0x10(%ebp),%edx
+  802d2e:	89 50 04             	mov    %edx,0x4(%eax)
+  802d31:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802d38:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802d3f:	5d                   	pop    %ebp
+  802d40:	c3                   	ret
+
+00802d41 <ipcring_req_avail>:
+  802d41:	55                   	push   %ebp
+  802d42:	89 e5                	mov    %esp,%ebp
+  802d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d47:	8b 02                	mov    (%edx),%eax
+  802d49:	8b 40 10             	mov    0x10(%eax),%eax
+  802d4c:	2b 42 08             	sub    0x8(%edx),%eax
+  802d4f:	ba 08 00 00 00       	mov    $0x8,%edx
+  802d54:	39 d0                	cmp    %edx,%eax
+  802d56:	0f 47 c2             	cmova  %edx,%eax
+  802d59:	5d                   	pop    %ebp
+  802d5a:	c3                   	ret
+
+00802d5b <ipcring_req_peek>:
+  802d5b:	55                   	push   %ebp
+  802d5c:	89 e5                	mov    %esp,%ebp
+  802d5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d61:	8b 42 08             	mov    0x8(%edx),%eax
+  802d64:	83 e0 07             	and    $0x7,%eax
+  802d67:	8b 12                	mov    (%edx),%edx
+  802d69:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802d6d:	5d                   	pop    %ebp
+  802d6e:	c3                   	ret
+
+00802d6f <ipcring_rsp_push>:
+  802d6f:	55                   	push   %ebp
+  802d70:	89 e5                	mov    %esp,%ebp
+  802d72:	83 ec 08             	sub    $0x8,%esp
+  802d75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d78:	8b 41 08             	mov    0x8(%ecx),%eax
+  802d7b:	83 c0 01             	add    $0x1,%eax
+  802d7e:	89 41 08             	mov    %eax,0x8(%ecx)
+  802d81:	8b 11                	mov    (%ecx),%edx
+  802d83:	83 c2 14             	add    $0x14,%edx
+  802d86:	f0 87 02             	lock xchg %eax,(%edx)
+  802d89:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802d8d:	75 02                	jne    802d91 <ipcring_rsp_push+0x22>
+  802d8f:	c9                   	leave
+  802d90:	c3                   	ret
+  802d91:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802d98:	6a 00                	push   $0x0
+  802d9a:	68 00 00 80 ee       	push   $0xee800000
+  802d9f:	6a 00                	push   $0x0
+  802da1:	ff 71 04             	push   0x4(%ecx)
+  802da4:	e8 28 e2 ff ff       	call   800fd1 <sys_ipc_try_send>
+  802da9:	83 c4 10             	add    $0x10,%esp
+  802dac:	eb e1                	jmp    802d8f <ipcring_rsp_push+0x20>
+
+00802dae <ipcring_client_wait>:
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	83 ec 08             	sub    $0x8,%esp
+  802db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db7:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802dbe:	8b 10                	mov    (%eax),%edx
+  802dc0:	8b 52 18             	mov    0x18(%edx),%edx
+  802dc3:	3b 50 08             	cmp    0x8(%eax),%edx
+  802dc6:	75 02                	jne    802dca <ipcring_client_wait+0x1c>
+  802dc8:	c9                   	leave
+  802dc9:	c3                   	ret
+  802dca:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802dd1:	6a 00                	push   $0x0
+  802dd3:	68 00 00 80 ee       	push   $0xee800000
+  802dd8:	6a 00                	push   $0x0
+  802dda:	ff 70 04             	push   0x4(%eax)
+  802ddd:	e8 ef e1 ff ff       	call   800fd1 <sys_ipc_try_send>
+  802de2:	83 c4 10             	add    $0x10,%esp
+  802de5:	eb e1                	jmp    802dc8 <ipcring_client_wait+0x1a>
+
+00802de7 <ipcring_server_sleep>:
+  802de7:	55                   	push   %ebp
+  802de8:	89 e5                	mov    %esp,%ebp
+  802dea:	53                   	push   %ebx
+  802deb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dee:	8b 01                	mov    (%ecx),%eax
+  802df0:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802df3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802df8:	f0 87 02             	lock xchg %eax,(%edx)
+  802dfb:	8b 11                	mov    (%ecx),%edx
+  802dfd:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802e00:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e05:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802e08:	74 0e                	je     802e18 <ipcring_server_sleep+0x31>
+  802e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0f:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e1b:	c9                   	leave
+  802e1c:	c3                   	ret
+
+00802e1d <devcons_close>:
+  802e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e22:	c3                   	ret
+
+00802e23 <devcons_stat>:
+  802e23:	55                   	push   %ebp
+  802e24:	89 e5                	mov    %esp,%ebp
+  802e26:	83 ec 10             	sub    $0x10,%esp
+  802e29:	68 47 39 80 00       	push   $0x803947
+  802e2e:	ff 75 0c             	push   0xc(%ebp)
+  802e31:	e8 e0 da ff ff       	call   800916 <strcpy>
+  802e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3b:	c9                   	leave
+  802e3c:	c3                   	ret
+
+00802e3d <devcons_write>:
+  802e3d:	55                   	push   %ebp
+  802e3e:	89 e5                	mov    %esp,%ebp
+  802e40:	57                   	push   %edi
+  802e41:	56                   	push   %esi
+  802e42:	53                   	push   %ebx
+  802e43:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802e49:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802e4c:	85 ff                	test   %edi,%edi
+  802e4e:	74 51                	je     802ea1 <devcons_write+0x64>
+  802e50:	be 00 00 00 00       	mov    $0x0,%esi
+  802e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5a:	89 fb                	mov    %edi,%ebx
+  802e5c:	29 c3                	sub    %eax,%ebx
+  802e5e:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802e63:	39 d3                	cmp    %edx,%ebx
+  802e65:	0f 47 da             	cmova  %edx,%ebx
+  802e68:	83 ec 04             	sub    $0x4,%esp
+  802e6b:	53                   	push   %ebx
+  802e6c:	03 45 0c             	add    0xc(%ebp),%eax
+  802e6f:	50                   	push   %eax
+  802e70:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802e76:	50                   	push   %eax
+  802e77:	e8 4a dc ff ff       	call   800ac6 <memmove>
+  802e7c:	83 c4 08             	add    $0x8,%esp
+  802e7f:	53                   	push   %ebx
+  802e80:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802e86:	50                   	push   %eax
+  802e87:	e8 02 de ff ff       	call   800c8e <sys_cputs>
+  802e8c:	01 de                	add    %ebx,%esi
+  802e8e:	89 f0                	mov    %esi,%eax
+  802e90:	83 c4 10             	add    $0x10,%esp
+  802e93:	39 fe                	cmp    %edi,%esi
+  802e95:	72 c3                	jb     802e5a <devcons_write+0x1d>
+  802e97:	89 f0                	mov    %esi,%eax
+  802e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e9c:	5b                   	pop    %ebx
+  802e9d:	5e                   	pop    %esi
+  802e9e:	5f                   	pop    %edi
+  802e9f:	5d                   	pop    %ebp
+  802ea0:	c3                   	ret
+  802ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea6:	eb ef                	jmp    802e97 <devcons_write+0x5a>
+
+00802ea8 <devcons_read>:
+  802ea8:	55                   	push   %ebp
+  802ea9:	89 e5                	mov    %esp,%ebp
+  802eab:	83 ec 08             	sub    $0x8,%esp
+  802eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802eb7:	75 07                	jne    802ec0 <devcons_read+0x18>
+  802eb9:	eb 1f                	jmp    802eda <devcons_read+0x32>
+  802ebb:	e8 6b de ff ff       	call   800d2b <sys_yield>
+  802ec0:	e8 e7 dd ff ff       	call   800cac <sys_cgetc>
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	74 f2                	je     802ebb <devcons_read+0x13>
+  802ec9:	78 0f                	js     802eda <devcons_read+0x32>
+  802ecb:	83 f8 04             	cmp    $0x4,%eax
+  802ece:	74 0c                	je     802edc <devcons_read+0x34>
+  802ed0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ed3:	88 02                	mov    %al,(%edx)
+  802ed5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802eda:	c9                   	leave
+  802edb:	c3                   	ret
+  802edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee1:	eb f7                	jmp    802eda <devcons_read+0x32>
+
+00802ee3 <cputchar>:
+  802ee3:	55                   	push   %ebp
+  802ee4:	89 e5                	mov    %esp,%ebp
+  802ee6:	83 ec 20             	sub    $0x20,%esp
+  802ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eec:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802eef:	6a 01                	push   $0x1
+  802ef1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ef4:	50                   	push   %eax
+  802ef5:	e8 94 dd ff ff       	call   800c8e <sys_cputs>
+  802efa:	83 c4 10             	add    $0x10,%esp
+  802efd:	c9                   	leave
+  802efe:	c3                   	ret
+
+00802eff <getchar>:
+  802eff:	55                   	push   %ebp
+  802f00:	89 e5                	mov    %esp,%ebp
+  802f02:	83 ec 1c             	sub    $0x1c,%esp
+  802f05:	6a 01                	push   $0x1
+  802f07:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f0a:	50                   	push   %eax
+  802f0b:	6a 00                	push   $0x0
+  802f0d:	e8 fa ea ff ff       	call   801a0c <read>
+  802f12:	83 c4 10             	add    $0x10,%esp
+  802f15:	85 c0                	test   %eax,%eax
+  802f17:	78 06                	js     802f1f <getchar+0x20>
+  802f19:	74 06                	je     802f21 <getchar+0x22>
+  802f1b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802f1f:	c9                   	leave
+  802f20:	c3                   	ret
+  802f21:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802f26:	eb f7                	jmp    802f1f <getchar+0x20>
+
+00802f28 <iscons>:
+  802f28:	55                   	push   %ebp
+  802f29:	89 e5                	mov    %esp,%ebp
+  802f2b:	83 ec 20             	sub    $0x20,%esp
+  802f2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f31:	50                   	push   %eax
+  802f32:	ff 75 08             	push   0x8(%ebp)
+  802f35:	e8 70 e8 ff ff       	call   8017aa <fd_lookup>
+  802f3a:	83 c4 10             	add    $0x10,%esp
+  802f3d:	85 c0                	test   %eax,%eax
+  802f3f:	78 11                	js     802f52 <iscons+0x2a>
+  802f41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f44:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802f4a:	39 10                	cmp    %edx,(%eax)
+  802f4c:	0f 94 c0             	sete   %al
+  802f4f:	0f b6 c0             	movzbl %al,%eax
+  802f52:	c9                   	leave
+  802f53:	c3                   	ret
+
+00802f54 <opencons>:
+  802f54:	55                   	push   %ebp
+  802f55:	89 e5                	mov    %esp,%ebp
+  802f57:	83 ec 24             	sub    $0x24,%esp
+  802f5a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f5d:	50                   	push   %eax
+  802f5e:	e8 f7 e7 ff ff       	call   80175a <fd_alloc>
+  802f63:	83 c4 10             	add    $0x10,%esp
+  802f66:	85 c0                	test   %eax,%eax
+  802f68:	78 3a                	js     802fa4 <opencons+0x50>
+  802f6a:	83 ec 04             	sub    $0x4,%esp
+  802f6d:	68 07 04 00 00       	push   $0x407
+  802f72:	ff 75 f4             	push   -0xc(%ebp)
+  802f75:	6a 00                	push   $0x0
+  802f77:	e8 fa dd ff ff       	call   800d76 <sys_page_alloc>
+  802f7c:	83 c4 10             	add    $0x10,%esp
+  802f7f:	85 c0                	test   %eax,%eax
+  802f81:	78 21                	js     802fa4 <opencons+0x50>
+  802f83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f86:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802f8c:	89 10                	mov    %edx,(%eax)
+  802f8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f91:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802f98:	83 ec 0c             	sub    $0xc,%esp
+  802f9b:	50                   	push   %eax
+  802f9c:	e8 92 e7 ff ff       	call   801733 <fd2num>
+  802fa1:	83 c4 10             	add    $0x10,%esp
+  802fa4:	c9                   	leave
+  802fa5:	c3                   	ret
+
+00802fa6 <_panic>:
+  802fa6:	55                   	push   %ebp
+  802fa7:	89 e5                	mov    %esp,%ebp
+  802fa9:	56                   	push   %esi
+  802faa:	53                   	push   %ebx
+  802fab:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802fae:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802fb4:	e8 53 dd ff ff       	call   800d0c <sys_getenvid>
+  802fb9:	83 ec 0c             	sub    $0xc,%esp
+  802fbc:	ff 75 0c             	push   0xc(%ebp)
+  802fbf:	ff 75 08             	push   0x8(%ebp)
+  802fc2:	56                   	push   %esi
+  802fc3:	50                   	push   %eax
+  802fc4:	68 54 39 80 00       	push   $0x803954
+  802fc9:	e8 51 d2 ff ff       	call   80021f <cprintf>
+  802fce:	83 c4 18             	add    $0x18,%esp
+  802fd1:	53                   	push   %ebx
+  802fd2:	ff 75 10             	push   0x10(%ebp)
+  802fd5:	e8 f4 d1 ff ff       	call   8001ce <vcprintf>
+  802fda:	c7 04 24 b0 34 80 00 	movl   $0x8034b0,(%esp)
+  802fe1:	e8 39 d2 ff ff       	call   80021f <cprintf>
+  802fe6:	83 c4 10             	add    $0x10,%esp
+  802fe9:	cc                   	int3
+  802fea:	eb fd                	jmp    802fe9 <_panic+0x43>
+
+00802fec <ipc_recv>:
+  802fec:	55                   	push   %ebp
+  802fed:	89 e5                	mov    %esp,%ebp
+  802fef:	56                   	push   %esi
+  802ff0:	53                   	push   %ebx
+  802ff1:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ff4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ff7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ffa:	85 c0                	test   %eax,%eax
+  802ffc:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803001:	0f 44 c2             	cmove  %edx,%eax
+  803004:	83 ec 0c             	sub    $0xc,%esp
+  803007:	50                   	push   %eax
+  803008:	e8 14 e0 ff ff       	call   801021 <sys_ipc_recv>
+  80300d:	83 c4 10             	add    $0x10,%esp
+  803010:	85 c0                	test   %eax,%eax
+  803012:	78 2a                	js     80303e <ipc_recv+0x52>
+  803014:	a1 10 50 80 00       	mov    0x805010,%eax
+  803019:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  80301f:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803025:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80302b:	85 f6                	test   %esi,%esi
+  80302d:	74 02                	je     803031 <ipc_recv+0x45>
+  80302f:	89 0e                	mov    %ecx,(%esi)
+  803031:	85 db                	test   %ebx,%ebx
+  803033:	74 02                	je     803037 <ipc_recv+0x4b>
+  803035:	89 13                	mov    %edx,(%ebx)
+  803037:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80303a:	5b                   	pop    %ebx
+  80303b:	5e                   	pop    %esi
+  80303c:	5d                   	pop    %ebp
+  80303d:	c3                   	ret
+  80303e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803043:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803048:	eb e1                	jmp    80302b <ipc_recv+0x3f>
+
+0080304a <ipc_send>:
+  80304a:	55                   	push   %ebp
+  80304b:	89 e5                	mov    %esp,%ebp
+  80304d:	57                   	push   %edi
+  80304e:	56                   	push   %esi
+  80304f:	53                   	push   %ebx
+  803050:	83 ec 0c             	sub    $0xc,%esp
+  803053:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803056:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803059:	8b 75 14             	mov    0x14(%ebp),%esi
+  80305c:	85 db                	test   %ebx,%ebx
+  80305e:	74 1e                	je     80307e <ipc_send+0x34>
+  803060:	56                   	push   %esi
+  803061:	53                   	push   %ebx
+  803062:	57                   	push   %edi
+  803063:	ff 75 08             	push   0x8(%ebp)
+  803066:	e8 43 e0 ff ff       	call   8010ae <sys_ipc_send>
+  80306b:	83 c4 10             	add    $0x10,%esp
+  80306e:	85 c0                	test   %eax,%eax
+  803070:	74 2a                	je     80309c <ipc_send+0x52>
+  803072:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803075:	75 13                	jne    80308a <ipc_send+0x40>
+  803077:	e8 af dc ff ff       	call   800d2b <sys_yield>
+  80307c:	eb e2                	jmp    803060 <ipc_send+0x16>
+  80307e:	be 00 00 00 00       	mov    $0x0,%esi
+  803083:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803088:	eb d6                	jmp    803060 <ipc_send+0x16>
+  80308a:	50                   	push   %eax
+  80308b:	68 78 39 80 00       	push   $0x803978
+  803090:	6a 4f                	push   $0x4f
+  803092:	68 bb 39 80 00       	push   $0x8039bb
+  803097:	e8 0a ff ff ff       	call   802fa6 <_panic>
+  80309c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80309f:	5b                   	pop    %ebx
+  8030a0:	5e                   	pop    %esi
+  8030a1:	5f                   	pop    %edi
+  8030a2:	5d                   	pop    %ebp
+  8030a3:	c3                   	ret
+
+008030a4 <ipc_call>:
+  8030a4:	55                   	push   %ebp
+  8030a5:	89 e5                	mov    %esp,%ebp
+  8030a7:	57                   	push   %edi
+  8030a8:	56                   	push   %esi
+  8030a9:	53                   	push   %ebx
+  8030aa:	83 ec 0c             	sub    $0xc,%esp
+  8030ad:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030b1:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8030b6:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8030ba:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8030be:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8030c3:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8030c7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030d0:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  8030d4:	eb 05                	jmp    8030db <ipc_call+0x37>
+  8030d6:	e8 50 dc ff ff       	call   800d2b <sys_yield>
+  8030db:	83 ec 0c             	sub    $0xc,%esp
+  8030de:	56                   	push   %esi
+  8030df:	53                   	push   %ebx
+  8030e0:	57                   	push   %edi
+  8030e1:	ff 75 0c             	push   0xc(%ebp)
+  8030e4:	ff 75 08             	push   0x8(%ebp)
+  8030e7:	e8 12 e0 ff ff       	call   8010fe <sys_ipc_call>
+  8030ec:	83 c4 20             	add    $0x20,%esp
+  8030ef:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8030f2:	74 e2                	je     8030d6 <ipc_call+0x32>
+  8030f4:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8030f7:	74 2d                	je     803126 <ipc_call+0x82>
+  8030f9:	85 c0                	test   %eax,%eax
+  8030fb:	78 4f                	js     80314c <ipc_call+0xa8>
+  8030fd:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803101:	74 10                	je     803113 <ipc_call+0x6f>
+  803103:	a1 10 50 80 00       	mov    0x805010,%eax
+  803108:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80310e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803111:	89 02                	mov    %eax,(%edx)
+  803113:	a1 10 50 80 00       	mov    0x805010,%eax
+  803118:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80311e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803121:	5b                   	pop    %ebx
+  803122:	5e                   	pop    %esi
+  803123:	5f                   	pop    %edi
+  803124:	5d                   	pop    %ebp
+  803125:	c3                   	ret
+  803126:	ff 75 14             	push   0x14(%ebp)
+  803129:	ff 75 10             	push   0x10(%ebp)
+  80312c:	ff 75 0c             	push   0xc(%ebp)
+  80312f:	ff 75 08             	push   0x8(%ebp)
+  803132:	e8 13 ff ff ff       	call   80304a <ipc_send>
+  803137:	83 c4 0c             	add    $0xc,%esp
+  80313a:	ff 75 1c             	push   0x1c(%ebp)
+  80313d:	ff 75 18             	push   0x18(%ebp)
+  803140:	6a 00                	push   $0x0
+  803142:	e8 a5 fe ff ff       	call   802fec <ipc_recv>
+  803147:	83 c4 10             	add    $0x10,%esp
+  80314a:	eb d2                	jmp    80311e <ipc_call+0x7a>
+  80314c:	50                   	push   %eax
+  80314d:	68 c5 39 80 00       	push   $0x8039c5
+  803152:	6a 6d                	push   $0x6d
+  803154:	68 bb 39 80 00       	push   $0x8039bb
+  803159:	e8 48 fe ff ff       	call   802fa6 <_panic>
+
+0080315e <ipc_reply_recv>:
+  80315e:	55                   	push   %ebp
+  80315f:	89 e5                	mov    %esp,%ebp
+  803161:	57                   	push   %edi
+  803162:	56                   	push   %esi
+  803163:	53                   	push   %ebx
+  803164:	83 ec 0c             	sub    $0xc,%esp
+  803167:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80316a:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  80316d:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803170:	85 db                	test   %ebx,%ebx
+  803172:	0f 84 ac 00 00 00    	je     803224 <ipc_reply_recv+0xc6>
+  803178:	85 f6                	test   %esi,%esi
+  80317a:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80317f:	0f 45 c6             	cmovne %esi,%eax
+  803182:	83 ec 0c             	sub    $0xc,%esp
+  803185:	50                   	push   %eax
+  803186:	ff 75 14             	push   0x14(%ebp)
+  803189:	53                   	push   %ebx
+  80318a:	ff 75 0c             	push   0xc(%ebp)
+  80318d:	ff 75 08             	push   0x8(%ebp)
+  803190:	e8 8a df ff ff       	call   80111f <sys_ipc_reply_recv>
+  803195:	83 c4 20             	add    $0x20,%esp
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	78 3a                	js     8031d6 <ipc_reply_recv+0x78>
+  80319c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8031a0:	74 10                	je     8031b2 <ipc_reply_recv+0x54>
+  8031a2:	a1 10 50 80 00       	mov    0x805010,%eax
+  8031a7:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8031ad:	8b 55 18             	mov    0x18(%ebp),%edx
+  8031b0:	89 02                	mov    %eax,(%edx)
+  8031b2:	85 ff                	test   %edi,%edi
+  8031b4:	74 0d                	je     8031c3 <ipc_reply_recv+0x65>
+  8031b6:	a1 10 50 80 00       	mov    0x805010,%eax
+  8031bb:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8031c1:	89 07                	mov    %eax,(%edi)
+  8031c3:	a1 10 50 80 00       	mov    0x805010,%eax
+  8031c8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8031ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031d1:	5b                   	pop    %ebx
+  8031d2:	5e                   	pop    %esi
+  8031d3:	5f                   	pop    %edi
+  8031d4:	5d                   	pop    %ebp
+  8031d5:	c3                   	ret
+  8031d6:	ff 75 14             	push   0x14(%ebp)
+  8031d9:	53                   	push   %ebx
+  8031da:	ff 75 0c             	push   0xc(%ebp)
+  8031dd:	ff 75 08             	push   0x8(%ebp)
+  8031e0:	e8 ec dd ff ff       	call   800fd1 <sys_ipc_try_send>
+  8031e5:	89 c2                	mov    %eax,%edx
+  8031e7:	c1 ea 1f             	shr    $0x1f,%edx
+  8031ea:	83 c4 10             	add    $0x10,%esp
+  8031ed:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8031f0:	0f 95 c1             	setne  %cl
+  8031f3:	84 d1                	test   %dl,%cl
+  8031f5:	74 05                	je     8031fc <ipc_reply_recv+0x9e>
+  8031f7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8031fa:	75 12                	jne    80320e <ipc_reply_recv+0xb0>
+  8031fc:	83 ec 04             	sub    $0x4,%esp
+  8031ff:	57                   	push   %edi
+  803200:	56                   	push   %esi
+  803201:	ff 75 18             	push   0x18(%ebp)
+  803204:	e8 e3 fd ff ff       	call   802fec <ipc_recv>
+  803209:	83 c4 10             	add    $0x10,%esp
+  80320c:	eb c0                	jmp    8031ce <ipc_reply_recv+0x70>
+  80320e:	83 ec 04             	sub    $0x4,%esp
+  803211:	50                   	push   %eax
+  803212:	ff 75 08             	push   0x8(%ebp)
+  803215:	68 98 39 80 00       	push   $0x803998
+  80321a:	e8 00 d0 ff ff       	call   80021f <cprintf>
+  80321f:	83 c4 10             	add    $0x10,%esp
+  803222:	eb d8                	jmp    8031fc <ipc_reply_recv+0x9e>
+  803224:	85 f6                	test   %esi,%esi
+  803226:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80322b:	0f 45 c6             	cmovne %esi,%eax
+  80322e:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803233:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80323a:	e9 43 ff ff ff       	jmp    803182 <ipc_reply_recv+0x24>
+
+0080323f <ipc_find_env>:
+  80323f:	55                   	push   %ebp
+  803240:	89 e5                	mov    %esp,%ebp
+  803242:	83 ec 14             	sub    $0x14,%esp
+  803245:	ff 75 08             	push   0x8(%ebp)
+  803248:	e8 22 dd ff ff       	call   800f6f <sys_env_service>
+  80324d:	85 c0                	test   %eax,%eax
+  80324f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803254:	0f 48 c2             	cmovs  %edx,%eax
+  803257:	c9                   	leave
+  803258:	c3                   	ret
+
+00803259 <pageref>:
+  803259:	55                   	push   %ebp
+  80325a:	89 e5                	mov    %esp,%ebp
+  80325c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80325f:	89 c2                	mov    %eax,%edx
+  803261:	c1 ea 16             	shr    $0x16,%edx
+  803264:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80326b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803270:	f6 c1 01             	test   $0x1,%cl
+  803273:	74 22                	je     803297 <pageref+0x3e>
+  803275:	c1 e8 0c             	shr    $0xc,%eax
+  803278:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80327f:	a8 01                	test   $0x1,%al
+  803281:	74 14                	je     803297 <pageref+0x3e>
+  803283:	c1 e8 0c             	shr    $0xc,%eax
+  803286:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803289:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803290:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803294:	0f b7 d2             	movzwl %dx,%edx
+  803297:	89 d0                	mov    %edx,%eax
+  803299:	5d                   	pop    %ebp
+  80329a:	c3                   	ret
+
+0080329b <__udivmoddi4>:
+  80329b:	55                   	push   %ebp
+  80329c:	57                   	push   %edi
+  80329d:	56                   	push   %esi
+  80329e:	53                   	push   %ebx
+  80329f:	83 ec 24             	sub    $0x24,%esp
+  8032a2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8032a6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8032aa:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8032ae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8032b2:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8032b6:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8032ba:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8032be:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8032c2:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8032c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8032d5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8032dc:	00 
+  8032dd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8032e4:	00 
+  8032e5:	89 fb                	mov    %edi,%ebx
+  8032e7:	eb 08                	jmp    8032f1 <__udivmoddi4+0x56>
+  8032e9:	83 e9 01             	sub    $0x1,%ecx
+  8032ec:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8032ef:	74 68                	je     803359 <__udivmoddi4+0xbe>
+  8032f1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8032f5:	01 c0                	add    %eax,%eax
+  8032f7:	89 c6                	mov    %eax,%esi
+  8032f9:	89 d7                	mov    %edx,%edi
+  8032fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8032ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803303:	0f ad d0             	shrd   %cl,%edx,%eax
+  803306:	d3 ea                	shr    %cl,%edx
+  803308:	f6 c1 20             	test   $0x20,%cl
+  80330b:	74 04                	je     803311 <__udivmoddi4+0x76>
+  80330d:	89 d0                	mov    %edx,%eax
+  80330f:	31 d2                	xor    %edx,%edx
+  803311:	83 e0 01             	and    $0x1,%eax
+  803314:	89 04 24             	mov    %eax,(%esp)
+  803317:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80331e:	00 
+  80331f:	8b 04 24             	mov    (%esp),%eax
+  803322:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803326:	09 f0                	or     %esi,%eax
+  803328:	09 fa                	or     %edi,%edx
+  80332a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80332e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803332:	39 f0                	cmp    %esi,%eax
+  803334:	89 d5                	mov    %edx,%ebp
+  803336:	19 fd                	sbb    %edi,%ebp
+  803338:	72 af                	jb     8032e9 <__udivmoddi4+0x4e>
+  80333a:	29 f0                	sub    %esi,%eax
+  80333c:	19 fa                	sbb    %edi,%edx
+  80333e:	89 cf                	mov    %ecx,%edi
+  803340:	c1 ef 05             	shr    $0x5,%edi
+  803343:	83 e7 01             	and    $0x1,%edi
+  803346:	89 fe                	mov    %edi,%esi
+  803348:	83 f6 01             	xor    $0x1,%esi
+  80334b:	d3 e6                	shl    %cl,%esi
+  80334d:	d3 e7                	shl    %cl,%edi
+  80334f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803353:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803357:	eb 90                	jmp    8032e9 <__udivmoddi4+0x4e>
+  803359:	85 db                	test   %ebx,%ebx
+  80335b:	74 05                	je     803362 <__udivmoddi4+0xc7>
+  80335d:	89 03                	mov    %eax,(%ebx)
+  80335f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803362:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803366:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80336a:	83 c4 24             	add    $0x24,%esp
+  80336d:	5b                   	pop    %ebx
+  80336e:	5e                   	pop    %esi
+  80336f:	5f                   	pop    %edi
+  803370:	5d                   	pop    %ebp
+  803371:	c3                   	ret
+
+00803372 <__udivdi3>:
+  803372:	83 ec 08             	sub    $0x8,%esp
+  803375:	6a 00                	push   $0x0
+  803377:	ff 74 24 1c          	push   0x1c(%esp)
+  80337b:	ff 74 24 1c          	push   0x1c(%esp)
+  80337f:	ff 74 24 1c          	push   0x1c(%esp)
+  803383:	ff 74 24 1c          	push   0x1c(%esp)
+  803387:	e8 0f ff ff ff       	call   80329b <__udivmoddi4>
+  80338c:	83 c4 1c             	add    $0x1c,%esp
+  80338f:	c3                   	ret
+
+00803390 <__umoddi3>:
+  803390:	83 ec 18             	sub    $0x18,%esp
+  803393:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803397:	50                   	push   %eax
+  803398:	ff 74 24 2c          	push   0x2c(%esp)
+  80339c:	ff 74 24 2c          	push   0x2c(%esp)
+  8033a0:	ff 74 24 2c          	push   0x2c(%esp)
+  8033a4:	ff 74 24 2c          	push   0x2c(%esp)
+  8033a8:	e8 ee fe ff ff       	call   80329b <__udivmoddi4>
+  8033ad:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8033b1:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8033b5:	83 c4 2c             	add    $0x2c,%esp
+  8033b8:	c3                   	ret
+
+008033b9 <__divdi3>:
+  8033b9:	53                   	push   %ebx
+  8033ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8033be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8033c2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8033c6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8033ca:	85 d2                	test   %edx,%edx
+  8033cc:	78 12                	js     8033e0 <__divdi3+0x27>
+  8033ce:	85 db                	test   %ebx,%ebx
+  8033d0:	78 2e                	js     803400 <__divdi3+0x47>
+  8033d2:	53                   	push   %ebx
+  8033d3:	51                   	push   %ecx
+  8033d4:	52                   	push   %edx
+  8033d5:	50                   	push   %eax
+  8033d6:	e8 97 ff ff ff       	call   803372 <__udivdi3>
+  8033db:	83 c4 10             	add    $0x10,%esp
+  8033de:	eb 1e                	jmp    8033fe <__divdi3+0x45>
+  8033e0:	f7 d8                	neg    %eax
+  8033e2:	83 d2 00             	adc    $0x0,%edx
+  8033e5:	f7 da                	neg    %edx
+  8033e7:	85 db                	test   %ebx,%ebx
+  8033e9:	78 2a                	js     803415 <__divdi3+0x5c>
+  8033eb:	53                   	push   %ebx
+  8033ec:	51                   	push   %ecx
+  8033ed:	52                   	push   %edx
+  8033ee:	50                   	push   %eax
+  8033ef:	e8 7e ff ff ff       	call   803372 <__udivdi3>
+  8033f4:	83 c4 10             	add    $0x10,%esp
+  8033f7:	f7 d8                	neg    %eax
+  8033f9:	83 d2 00             	adc    $0x0,%edx
+  8033fc:	f7 da                	neg    %edx
+  8033fe:	5b                   	pop    %ebx
+  8033ff:	c3                   	ret
+  803400:	f7 d9                	neg    %ecx
+  803402:	83 d3 00             	adc    $0x0,%ebx
+  803405:	f7 db                	neg    %ebx
+  803407:	53                   	push   %ebx
+  803408:	51                   	push   %ecx
+  803409:	52                   	push   %edx
+  80340a:	50                   	push   %eax
+  80340b:	e8 62 ff ff ff       	call   803372 <__udivdi3>
+  803410:	83 c4 10             	add    $0x10,%esp
+  803413:	eb e2                	jmp    8033f7 <__divdi3+0x3e>
+  803415:	f7 d9                	neg    %ecx
+  803417:	83 d3 00             	adc    $0x0,%ebx
+  80341a:	f7 db                	neg    %ebx
+  80341c:	53                   	push   %ebx
+  80341d:	51                   	push   %ecx
+  80341e:	52                   	push   %edx
+  80341f:	50                   	push   %eax
+  803420:	e8 4d ff ff ff       	call   803372 <__udivdi3>
+  803425:	83 c4 10             	add    $0x10,%esp
+  803428:	eb d4                	jmp    8033fe <__divdi3+0x45>
+
+0080342a <__moddi3>:
+  80342a:	55                   	push   %ebp
+  80342b:	57                   	push   %edi
+  80342c:	56                   	push   %esi
+  80342d:	53                   	push   %ebx
+  80342e:	83 ec 0c             	sub    $0xc,%esp
+  803431:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803435:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803439:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80343d:	89 e9                	mov    %ebp,%ecx
+  80343f:	f7 d9                	neg    %ecx
+  803441:	89 d0                	mov    %edx,%eax
+  803443:	83 d0 00             	adc    $0x0,%eax
+  803446:	f7 d8                	neg    %eax
+  803448:	0f 49 e9             	cmovns %ecx,%ebp
+  80344b:	0f 49 d0             	cmovns %eax,%edx
+  80344e:	52                   	push   %edx
+  80344f:	55                   	push   %ebp
+  803450:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803454:	f7 da                	neg    %edx
+  803456:	89 d8                	mov    %ebx,%eax
+  803458:	83 d0 00             	adc    $0x0,%eax
+  80345b:	f7 d8                	neg    %eax
+  80345d:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803462:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803466:	0f 48 c3             	cmovs  %ebx,%eax
+  803469:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80346d:	ff 74 24 0c          	push   0xc(%esp)
+  803471:	ff 74 24 0c          	push   0xc(%esp)
+  803475:	e8 16 ff ff ff       	call   803390 <__umoddi3>
+  80347a:	83 c4 10             	add    $0x10,%esp
+  80347d:	85 db                	test   %ebx,%ebx
+  80347f:	78 08                	js     803489 <__moddi3+0x5f>
+  803481:	83 c4 0c             	add    $0xc,%esp
+  803484:	5b                   	pop    %ebx
+  803485:	5e                   	pop    %esi
+  803486:	5f                   	pop    %edi
+  803487:	5d                   	pop    %ebp
+  803488:	c3                   	ret
+  803489:	f7 d8                	neg    %eax
+  80348b:	83 d2 00             	adc    $0x0,%edx
+  80348e:	f7 da                	neg    %edx
+  803490:	eb ef                	jmp    803481 <__moddi3+0x57>
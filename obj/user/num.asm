@@ -0,0 +1,5253 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 50 01 00 00       	call   800181 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003e:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800041:	eb 1b                	jmp    80005e <num+0x2b>
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 01                	push   $0x1
+  800048:	53                   	push   %ebx
+  800049:	6a 01                	push   $0x1
+  80004b:	e8 fe 19 00 00       	call   801a4e <write>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 01             	cmp    $0x1,%eax
+  800056:	75 4c                	jne    8000a4 <num+0x71>
+  800058:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005c:	74 5e                	je     8000bc <num+0x89>
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 01                	push   $0x1
+  800063:	53                   	push   %ebx
+  800064:	56                   	push   %esi
+  800065:	e8 09 19 00 00       	call   801973 <read>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	7e 57                	jle    8000c8 <num+0x95>
+  800071:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800078:	74 c9                	je     800043 <num+0x10>
+  80007a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80007f:	83 c0 01             	add    $0x1,%eax
+  800082:	a3 00 50 80 00       	mov    %eax,0x805000
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	50                   	push   %eax
+  80008b:	68 c0 33 80 00       	push   $0x8033c0
+  800090:	e8 0c 23 00 00       	call   8023a1 <printf>
+  800095:	c7 05 00 40 80 00 00 	movl   $0x0,0x804000
+  80009c:	00 00 00 
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb 9f                	jmp    800043 <num+0x10>
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	ff 75 0c             	push   0xc(%ebp)
+  8000ab:	68 c5 33 80 00       	push   $0x8033c5
+  8000b0:	6a 13                	push   $0x13
+  8000b2:	68 e0 33 80 00       	push   $0x8033e0
+  8000b7:	e8 3e 01 00 00       	call   8001fa <_panic>
+  8000bc:	c7 05 00 40 80 00 01 	movl   $0x1,0x804000
+  8000c3:	00 00 00 
+  8000c6:	eb 96                	jmp    80005e <num+0x2b>
+  8000c8:	78 07                	js     8000d1 <num+0x9e>
+  8000ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	50                   	push   %eax
+  8000d5:	ff 75 0c             	push   0xc(%ebp)
+  8000d8:	68 eb 33 80 00       	push   $0x8033eb
+  8000dd:	6a 18                	push   $0x18
+  8000df:	68 e0 33 80 00       	push   $0x8033e0
+  8000e4:	e8 11 01 00 00       	call   8001fa <_panic>
+
+008000e9 <umain>:
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	57                   	push   %edi
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  8000f2:	c7 05 04 40 80 00 00 	movl   $0x803400,0x804004
+  8000f9:	34 80 00 
+  8000fc:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800100:	74 54                	je     800156 <umain+0x6d>
+  800102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800105:	8d 70 04             	lea    0x4(%eax),%esi
+  800108:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010d:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800111:	7e 36                	jle    800149 <umain+0x60>
+  800113:	83 ec 08             	sub    $0x8,%esp
+  800116:	6a 00                	push   $0x0
+  800118:	ff 36                	push   (%esi)
+  80011a:	e8 11 20 00 00       	call   802130 <open>
+  80011f:	89 c3                	mov    %eax,%ebx
+  800121:	83 c4 10             	add    $0x10,%esp
+  800124:	85 c0                	test   %eax,%eax
+  800126:	78 42                	js     80016a <umain+0x81>
+  800128:	83 ec 08             	sub    $0x8,%esp
+  80012b:	ff 36                	push   (%esi)
+  80012d:	50                   	push   %eax
+  80012e:	e8 00 ff ff ff       	call   800033 <num>
+  800133:	89 1c 24             	mov    %ebx,(%esp)
+  800136:	e8 fc 16 00 00       	call   801837 <close>
+  80013b:	83 c7 01             	add    $0x1,%edi
+  80013e:	83 c6 04             	add    $0x4,%esi
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	39 7d 08             	cmp    %edi,0x8(%ebp)
+  800147:	75 ca                	jne    800113 <umain+0x2a>
+  800149:	e8 7c 00 00 00       	call   8001ca <exit>
+  80014e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800151:	5b                   	pop    %ebx
+  800152:	5e                   	pop    %esi
+  800153:	5f                   	pop    %edi
+  800154:	5d                   	pop    %ebp
+  800155:	c3                   	ret
+  800156:	83 ec 08             	sub    $0x8,%esp
+  800159:	68 04 34 80 00       	push   $0x803404
+  80015e:	6a 00                	push   $0x0
+  800160:	e8 ce fe ff ff       	call   800033 <num>
+  800165:	83 c4 10             	add    $0x10,%esp
+  800168:	eb df                	jmp    800149 <umain+0x60>
+  80016a:	83 ec 0c             	sub    $0xc,%esp
+  80016d:	50                   	push   %eax
+  80016e:	ff 36                	push   (%esi)
+  800170:	68 0c 34 80 00       	push   $0x80340c
+  800175:	6a 27                	push   $0x27
+  800177:	68 e0 33 80 00       	push   $0x8033e0
+  80017c:	e8 79 00 00 00       	call   8001fa <_panic>
+
+00800181 <libmain>:
+  800181:	55                   	push   %ebp
+  800182:	89 e5                	mov    %esp,%ebp
+  800184:	56                   	push   %esi
+  800185:	53                   	push   %ebx
+  800186:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800189:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80018c:	e8 31 0c 00 00       	call   800dc2 <sys_getenvid>
+  800191:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800196:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80019c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001a1:	a3 14 50 80 00       	mov    %eax,0x805014
+  8001a6:	85 db                	test   %ebx,%ebx
+  8001a8:	7e 07                	jle    8001b1 <libmain+0x30>
+  8001aa:	8b 06                	mov    (%esi),%eax
+  8001ac:	a3 04 40 80 00       	mov    %eax,0x804004
+  8001b1:	83 ec 08             	sub    $0x8,%esp
+  8001b4:	56                   	push   %esi
+  8001b5:	53                   	push   %ebx
+  8001b6:	e8 2e ff ff ff       	call   8000e9 <umain>
+  8001bb:	e8 0a 00 00 00       	call   8001ca <exit>
+  8001c0:	83 c4 10             	add    $0x10,%esp
+  8001c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001c6:	5b                   	pop    %ebx
+  8001c7:	5e                   	pop    %esi
+  8001c8:	5d                   	pop    %ebp
+  8001c9:	c3                   	ret
+
+008001ca <exit>:
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	83 ec 08             	sub    $0x8,%esp
+  8001d0:	a1 14 50 80 00       	mov    0x805014,%eax
+  8001d5:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8001db:	85 c0                	test   %eax,%eax
+  8001dd:	75 14                	jne    8001f3 <exit+0x29>
+  8001df:	e8 80 16 00 00       	call   801864 <close_all>
+  8001e4:	83 ec 0c             	sub    $0xc,%esp
+  8001e7:	6a 00                	push   $0x0
+  8001e9:	e8 93 0b 00 00       	call   800d81 <sys_env_destroy>
+  8001ee:	83 c4 10             	add    $0x10,%esp
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+  8001f3:	e8 f6 12 00 00       	call   8014ee <sys_lease_complete>
+  8001f8:	eb e5                	jmp    8001df <exit+0x15>
+
+008001fa <_panic>:
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	56                   	push   %esi
+  8001fe:	53                   	push   %ebx
+  8001ff:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800202:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  800208:	e8 b5 0b 00 00       	call   800dc2 <sys_getenvid>
+  80020d:	83 ec 0c             	sub    $0xc,%esp
+  800210:	ff 75 0c             	push   0xc(%ebp)
+  800213:	ff 75 08             	push   0x8(%ebp)
+  800216:	56                   	push   %esi
+  800217:	50                   	push   %eax
+  800218:	68 28 34 80 00       	push   $0x803428
+  80021d:	e8 b3 00 00 00       	call   8002d5 <cprintf>
+  800222:	83 c4 18             	add    $0x18,%esp
+  800225:	53                   	push   %ebx
+  800226:	ff 75 10             	push   0x10(%ebp)
+  800229:	e8 56 00 00 00       	call   800284 <vcprintf>
+  80022e:	c7 04 24 6e 38 80 00 	movl   $0x80386e,(%esp)
+  800235:	e8 9b 00 00 00       	call   8002d5 <cprintf>
+  80023a:	83 c4 10             	add    $0x10,%esp
+  80023d:	cc                   	int3
+  80023e:	eb fd                	jmp    80023d <_panic+0x43>
+
+00800240 <putch>:
+  800240:	55                   	push   %ebp
+  800241:	89 e5                	mov    %esp,%ebp
+  800243:	53                   	push   %ebx
+  800244:	83 ec 04             	sub    $0x4,%esp
+  800247:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80024a:	8b 13                	mov    (%ebx),%edx
+  80024c:	8d 42 01             	lea    0x1(%edx),%eax
+  80024f:	89 03                	mov    %eax,(%ebx)
+  800251:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800254:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800258:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80025d:	74 09                	je     800268 <putch+0x28>
+  80025f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800263:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	68 ff 00 00 00       	push   $0xff
+  800270:	8d 43 08             	lea    0x8(%ebx),%eax
+  800273:	50                   	push   %eax
+  800274:	e8 cb 0a 00 00       	call   800d44 <sys_cputs>
+  800279:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80027f:	83 c4 10             	add    $0x10,%esp
+  800282:	eb db                	jmp    80025f <putch+0x1f>
+
+00800284 <vcprintf>:
+  800284:	55                   	push   %ebp
+  800285:	89 e5                	mov    %esp,%ebp
+  800287:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80028d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800294:	00 00 00 
+  800297:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80029e:	00 00 00 
+  8002a1:	ff 75 0c             	push   0xc(%ebp)
+  8002a4:	ff 75 08             	push   0x8(%ebp)
+  8002a7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ad:	50                   	push   %eax
+  8002ae:	68 40 02 80 00       	push   $0x800240
+  8002b3:	e8 1c 01 00 00       	call   8003d4 <vprintfmt>
+  8002b8:	83 c4 08             	add    $0x8,%esp
+  8002bb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002c1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c7:	50                   	push   %eax
+  8002c8:	e8 77 0a 00 00       	call   800d44 <sys_cputs>
+  8002cd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002d3:	c9                   	leave
+  8002d4:	c3                   	ret
+
+008002d5 <cprintf>:
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	83 ec 10             	sub    $0x10,%esp
+  8002db:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	ff 75 08             	push   0x8(%ebp)
+  8002e2:	e8 9d ff ff ff       	call   800284 <vcprintf>
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <printnum>:
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	57                   	push   %edi
+  8002ed:	56                   	push   %esi
+  8002ee:	53                   	push   %ebx
+  8002ef:	83 ec 1c             	sub    $0x1c,%esp
+  8002f2:	89 c3                	mov    %eax,%ebx
+  8002f4:	89 d6                	mov    %edx,%esi
+  8002f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002fc:	89 d1                	mov    %edx,%ecx
+  8002fe:	89 c2                	mov    %eax,%edx
+  800300:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800303:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800306:	8b 45 10             	mov    0x10(%ebp),%eax
+  800309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800313:	39 c2                	cmp    %eax,%edx
+  800315:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800318:	73 4b                	jae    800365 <printnum+0x7c>
+  80031a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80031d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800320:	85 ff                	test   %edi,%edi
+  800322:	7e 11                	jle    800335 <printnum+0x4c>
+  800324:	83 ec 08             	sub    $0x8,%esp
+  800327:	56                   	push   %esi
+  800328:	ff 75 18             	push   0x18(%ebp)
+  80032b:	ff d3                	call   *%ebx
+  80032d:	83 c4 10             	add    $0x10,%esp
+  800330:	83 ef 01             	sub    $0x1,%edi
+  800333:	75 ef                	jne    800324 <printnum+0x3b>
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	56                   	push   %esi
+  800339:	83 ec 04             	sub    $0x4,%esp
+  80033c:	ff 75 e4             	push   -0x1c(%ebp)
+  80033f:	ff 75 e0             	push   -0x20(%ebp)
+  800342:	ff 75 dc             	push   -0x24(%ebp)
+  800345:	ff 75 d8             	push   -0x28(%ebp)
+  800348:	e8 64 2f 00 00       	call   8032b1 <__umoddi3>
+  80034d:	83 c4 14             	add    $0x14,%esp
+  800350:	0f be 80 4b 34 80 00 	movsbl 0x80344b(%eax),%eax
+  800357:	50                   	push   %eax
+  800358:	ff d3                	call   *%ebx
+  80035a:	83 c4 10             	add    $0x10,%esp
+  80035d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800360:	5b                   	pop    %ebx
+  800361:	5e                   	pop    %esi
+  800362:	5f                   	pop    %edi
+  800363:	5d                   	pop    %ebp
+  800364:	c3                   	ret
+  800365:	83 ec 0c             	sub    $0xc,%esp
+  800368:	ff 75 18             	push   0x18(%ebp)
+  80036b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80036e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800371:	52                   	push   %edx
+  800372:	50                   	push   %eax
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	ff 75 e4             	push   -0x1c(%ebp)
+  800379:	ff 75 e0             	push   -0x20(%ebp)
+  80037c:	ff 75 dc             	push   -0x24(%ebp)
+  80037f:	ff 75 d8             	push   -0x28(%ebp)
+  800382:	e8 0c 2f 00 00       	call   803293 <__udivdi3>
+  800387:	83 c4 18             	add    $0x18,%esp
+  80038a:	52                   	push   %edx
+  80038b:	50                   	push   %eax
+  80038c:	89 f2                	mov    %esi,%edx
+  80038e:	89 d8                	mov    %ebx,%eax
+  800390:	e8 54 ff ff ff       	call   8002e9 <printnum>
+  800395:	83 c4 20             	add    $0x20,%esp
+  800398:	eb 9b                	jmp    800335 <printnum+0x4c>
+
+0080039a <sprintputch>:
+  80039a:	55                   	push   %ebp
+  80039b:	89 e5                	mov    %esp,%ebp
+  80039d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003a0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8003a4:	8b 10                	mov    (%eax),%edx
+  8003a6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003a9:	73 0a                	jae    8003b5 <sprintputch+0x1b>
+  8003ab:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003ae:	89 08                	mov    %ecx,(%eax)
+  8003b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003b3:	88 02                	mov    %al,(%edx)
+  8003b5:	5d                   	pop    %ebp
+  8003b6:	c3                   	ret
+
+008003b7 <printfmt>:
+  8003b7:	55                   	push   %ebp
+  8003b8:	89 e5                	mov    %esp,%ebp
+  8003ba:	83 ec 08             	sub    $0x8,%esp
+  8003bd:	8d 45 14             	lea    0x14(%ebp),%eax
+  8003c0:	50                   	push   %eax
+  8003c1:	ff 75 10             	push   0x10(%ebp)
+  8003c4:	ff 75 0c             	push   0xc(%ebp)
+  8003c7:	ff 75 08             	push   0x8(%ebp)
+  8003ca:	e8 05 00 00 00       	call   8003d4 <vprintfmt>
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	c9                   	leave
+  8003d3:	c3                   	ret
+
+008003d4 <vprintfmt>:
+  8003d4:	55                   	push   %ebp
+  8003d5:	89 e5                	mov    %esp,%ebp
+  8003d7:	57                   	push   %edi
+  8003d8:	56                   	push   %esi
+  8003d9:	53                   	push   %ebx
+  8003da:	83 ec 2c             	sub    $0x2c,%esp
+  8003dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003e0:	89 df                	mov    %ebx,%edi
+  8003e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003e5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003e8:	8d 70 01             	lea    0x1(%eax),%esi
+  8003eb:	0f b6 00             	movzbl (%eax),%eax
+  8003ee:	83 f8 25             	cmp    $0x25,%eax
+  8003f1:	74 1e                	je     800411 <vprintfmt+0x3d>
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	0f 84 15 05 00 00    	je     800910 <vprintfmt+0x53c>
+  8003fb:	83 ec 08             	sub    $0x8,%esp
+  8003fe:	53                   	push   %ebx
+  8003ff:	50                   	push   %eax
+  800400:	ff d7                	call   *%edi
+  800402:	83 c6 01             	add    $0x1,%esi
+  800405:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800409:	83 c4 10             	add    $0x10,%esp
+  80040c:	83 f8 25             	cmp    $0x25,%eax
+  80040f:	75 e2                	jne    8003f3 <vprintfmt+0x1f>
+  800411:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800415:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80041c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800423:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80042a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80042f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800432:	8d 56 01             	lea    0x1(%esi),%edx
+  800435:	0f b6 0e             	movzbl (%esi),%ecx
+  800438:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80043b:	3c 55                	cmp    $0x55,%al
+  80043d:	0f 87 3b 04 00 00    	ja     80087e <vprintfmt+0x4aa>
+  800443:	0f b6 c0             	movzbl %al,%eax
+  800446:	ff 24 85 80 35 80 00 	jmp    *0x803580(,%eax,4)
+  80044d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800450:	eb 93                	jmp    8003e5 <vprintfmt+0x11>
+  800452:	89 d6                	mov    %edx,%esi
+  800454:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800458:	eb d8                	jmp    800432 <vprintfmt+0x5e>
+  80045a:	89 d6                	mov    %edx,%esi
+  80045c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800460:	eb d0                	jmp    800432 <vprintfmt+0x5e>
+  800462:	0f b6 c9             	movzbl %cl,%ecx
+  800465:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800468:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80046b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80046f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800472:	83 f9 09             	cmp    $0x9,%ecx
+  800475:	77 6f                	ja     8004e6 <vprintfmt+0x112>
+  800477:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80047a:	83 c2 01             	add    $0x1,%edx
+  80047d:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800480:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800484:	0f be 02             	movsbl (%edx),%eax
+  800487:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80048a:	83 fe 09             	cmp    $0x9,%esi
+  80048d:	76 eb                	jbe    80047a <vprintfmt+0xa6>
+  80048f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800492:	89 d6                	mov    %edx,%esi
+  800494:	eb 13                	jmp    8004a9 <vprintfmt+0xd5>
+  800496:	8b 45 14             	mov    0x14(%ebp),%eax
+  800499:	8b 00                	mov    (%eax),%eax
+  80049b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80049e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004a4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a7:	89 d6                	mov    %edx,%esi
+  8004a9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004ad:	79 83                	jns    800432 <vprintfmt+0x5e>
+  8004af:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004b5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004bc:	e9 71 ff ff ff       	jmp    800432 <vprintfmt+0x5e>
+  8004c1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004c4:	85 c9                	test   %ecx,%ecx
+  8004c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cb:	0f 49 c1             	cmovns %ecx,%eax
+  8004ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004d1:	89 d6                	mov    %edx,%esi
+  8004d3:	e9 5a ff ff ff       	jmp    800432 <vprintfmt+0x5e>
+  8004d8:	89 d6                	mov    %edx,%esi
+  8004da:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8004e1:	e9 4c ff ff ff       	jmp    800432 <vprintfmt+0x5e>
+  8004e6:	89 d6                	mov    %edx,%esi
+  8004e8:	eb bf                	jmp    8004a9 <vprintfmt+0xd5>
+  8004ea:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8004ee:	89 d6                	mov    %edx,%esi
+  8004f0:	e9 3d ff ff ff       	jmp    800432 <vprintfmt+0x5e>
+  8004f5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fb:	8d 70 04             	lea    0x4(%eax),%esi
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	ff 30                	push   (%eax)
+  800504:	ff d7                	call   *%edi
+  800506:	83 c4 10             	add    $0x10,%esp
+  800509:	89 75 14             	mov    %esi,0x14(%ebp)
+  80050c:	e9 d4 fe ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  800511:	89 55 10             	mov    %edx,0x10(%ebp)
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8d 70 04             	lea    0x4(%eax),%esi
+  80051a:	8b 10                	mov    (%eax),%edx
+  80051c:	89 d0                	mov    %edx,%eax
+  80051e:	f7 d8                	neg    %eax
+  800520:	0f 48 c2             	cmovs  %edx,%eax
+  800523:	83 f8 12             	cmp    $0x12,%eax
+  800526:	7f 23                	jg     80054b <vprintfmt+0x177>
+  800528:	8b 14 85 e0 36 80 00 	mov    0x8036e0(,%eax,4),%edx
+  80052f:	85 d2                	test   %edx,%edx
+  800531:	74 18                	je     80054b <vprintfmt+0x177>
+  800533:	52                   	push   %edx
+  800534:	68 3b 38 80 00       	push   $0x80383b
+  800539:	53                   	push   %ebx
+  80053a:	57                   	push   %edi
+  80053b:	e8 77 fe ff ff       	call   8003b7 <printfmt>
+  800540:	83 c4 10             	add    $0x10,%esp
+  800543:	89 75 14             	mov    %esi,0x14(%ebp)
+  800546:	e9 9a fe ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  80054b:	50                   	push   %eax
+  80054c:	68 63 34 80 00       	push   $0x803463
+  800551:	53                   	push   %ebx
+  800552:	57                   	push   %edi
+  800553:	e8 5f fe ff ff       	call   8003b7 <printfmt>
+  800558:	83 c4 10             	add    $0x10,%esp
+  80055b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80055e:	e9 82 fe ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  800563:	89 55 10             	mov    %edx,0x10(%ebp)
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	83 c0 04             	add    $0x4,%eax
+  80056c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80056f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800572:	8b 00                	mov    (%eax),%eax
+  800574:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800577:	85 c0                	test   %eax,%eax
+  800579:	0f 84 61 03 00 00    	je     8008e0 <vprintfmt+0x50c>
+  80057f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800583:	7e 06                	jle    80058b <vprintfmt+0x1b7>
+  800585:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800589:	75 29                	jne    8005b4 <vprintfmt+0x1e0>
+  80058b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80058e:	8d 70 01             	lea    0x1(%eax),%esi
+  800591:	0f b6 00             	movzbl (%eax),%eax
+  800594:	0f be d0             	movsbl %al,%edx
+  800597:	85 d2                	test   %edx,%edx
+  800599:	0f 84 bb 00 00 00    	je     80065a <vprintfmt+0x286>
+  80059f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005a2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005a5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005a8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005ab:	eb 7a                	jmp    800627 <vprintfmt+0x253>
+  8005ad:	c7 45 d0 5c 34 80 00 	movl   $0x80345c,-0x30(%ebp)
+  8005b4:	83 ec 08             	sub    $0x8,%esp
+  8005b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8005ba:	ff 75 d0             	push   -0x30(%ebp)
+  8005bd:	e8 e0 03 00 00       	call   8009a2 <strnlen>
+  8005c2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005c5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005c8:	83 c4 10             	add    $0x10,%esp
+  8005cb:	85 d2                	test   %edx,%edx
+  8005cd:	0f 8e d6 02 00 00    	jle    8008a9 <vprintfmt+0x4d5>
+  8005d3:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	53                   	push   %ebx
+  8005db:	56                   	push   %esi
+  8005dc:	ff d7                	call   *%edi
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8005e5:	75 f0                	jne    8005d7 <vprintfmt+0x203>
+  8005e7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ea:	8d 70 01             	lea    0x1(%eax),%esi
+  8005ed:	0f b6 00             	movzbl (%eax),%eax
+  8005f0:	0f be d0             	movsbl %al,%edx
+  8005f3:	85 d2                	test   %edx,%edx
+  8005f5:	0f 84 da 02 00 00    	je     8008d5 <vprintfmt+0x501>
+  8005fb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005fe:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800601:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800604:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800607:	eb 1e                	jmp    800627 <vprintfmt+0x253>
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	ff 75 0c             	push   0xc(%ebp)
+  80060f:	52                   	push   %edx
+  800610:	ff 55 08             	call   *0x8(%ebp)
+  800613:	83 c4 10             	add    $0x10,%esp
+  800616:	83 eb 01             	sub    $0x1,%ebx
+  800619:	83 c6 01             	add    $0x1,%esi
+  80061c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800620:	0f be d0             	movsbl %al,%edx
+  800623:	85 d2                	test   %edx,%edx
+  800625:	74 2a                	je     800651 <vprintfmt+0x27d>
+  800627:	85 ff                	test   %edi,%edi
+  800629:	78 05                	js     800630 <vprintfmt+0x25c>
+  80062b:	83 ef 01             	sub    $0x1,%edi
+  80062e:	78 59                	js     800689 <vprintfmt+0x2b5>
+  800630:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800634:	74 d3                	je     800609 <vprintfmt+0x235>
+  800636:	0f be c0             	movsbl %al,%eax
+  800639:	83 e8 20             	sub    $0x20,%eax
+  80063c:	83 f8 5e             	cmp    $0x5e,%eax
+  80063f:	76 c8                	jbe    800609 <vprintfmt+0x235>
+  800641:	83 ec 08             	sub    $0x8,%esp
+  800644:	ff 75 0c             	push   0xc(%ebp)
+  800647:	6a 3f                	push   $0x3f
+  800649:	ff 55 08             	call   *0x8(%ebp)
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	eb c5                	jmp    800616 <vprintfmt+0x242>
+  800651:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800654:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800657:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80065a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80065d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800661:	7e 1b                	jle    80067e <vprintfmt+0x2aa>
+  800663:	83 ec 08             	sub    $0x8,%esp
+  800666:	53                   	push   %ebx
+  800667:	6a 20                	push   $0x20
+  800669:	ff d7                	call   *%edi
+  80066b:	83 c4 10             	add    $0x10,%esp
+  80066e:	83 ee 01             	sub    $0x1,%esi
+  800671:	75 f0                	jne    800663 <vprintfmt+0x28f>
+  800673:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800676:	89 45 14             	mov    %eax,0x14(%ebp)
+  800679:	e9 67 fd ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  80067e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+  800684:	e9 5c fd ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  800689:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80068c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80068f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800692:	eb c6                	jmp    80065a <vprintfmt+0x286>
+  800694:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800697:	89 55 10             	mov    %edx,0x10(%ebp)
+  80069a:	83 f9 01             	cmp    $0x1,%ecx
+  80069d:	7f 1f                	jg     8006be <vprintfmt+0x2ea>
+  80069f:	85 c9                	test   %ecx,%ecx
+  8006a1:	74 67                	je     80070a <vprintfmt+0x336>
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 30                	mov    (%eax),%esi
+  8006a8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006ab:	89 f0                	mov    %esi,%eax
+  8006ad:	c1 f8 1f             	sar    $0x1f,%eax
+  8006b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bc:	eb 17                	jmp    8006d5 <vprintfmt+0x301>
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8b 50 04             	mov    0x4(%eax),%edx
+  8006c4:	8b 00                	mov    (%eax),%eax
+  8006c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006db:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006e0:	85 c9                	test   %ecx,%ecx
+  8006e2:	0f 89 12 01 00 00    	jns    8007fa <vprintfmt+0x426>
+  8006e8:	83 ec 08             	sub    $0x8,%esp
+  8006eb:	53                   	push   %ebx
+  8006ec:	6a 2d                	push   $0x2d
+  8006ee:	ff d7                	call   *%edi
+  8006f0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006f3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006f6:	f7 da                	neg    %edx
+  8006f8:	83 d1 00             	adc    $0x0,%ecx
+  8006fb:	f7 d9                	neg    %ecx
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	be 0a 00 00 00       	mov    $0xa,%esi
+  800705:	e9 f0 00 00 00       	jmp    8007fa <vprintfmt+0x426>
+  80070a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070d:	8b 30                	mov    (%eax),%esi
+  80070f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800712:	89 f0                	mov    %esi,%eax
+  800714:	c1 f8 1f             	sar    $0x1f,%eax
+  800717:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8d 40 04             	lea    0x4(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+  800723:	eb b0                	jmp    8006d5 <vprintfmt+0x301>
+  800725:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800728:	89 55 10             	mov    %edx,0x10(%ebp)
+  80072b:	83 f9 01             	cmp    $0x1,%ecx
+  80072e:	7f 1e                	jg     80074e <vprintfmt+0x37a>
+  800730:	85 c9                	test   %ecx,%ecx
+  800732:	74 32                	je     800766 <vprintfmt+0x392>
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073e:	8d 40 04             	lea    0x4(%eax),%eax
+  800741:	89 45 14             	mov    %eax,0x14(%ebp)
+  800744:	be 0a 00 00 00       	mov    $0xa,%esi
+  800749:	e9 ac 00 00 00       	jmp    8007fa <vprintfmt+0x426>
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	8b 48 04             	mov    0x4(%eax),%ecx
+  800756:	8d 40 08             	lea    0x8(%eax),%eax
+  800759:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800761:	e9 94 00 00 00       	jmp    8007fa <vprintfmt+0x426>
+  800766:	8b 45 14             	mov    0x14(%ebp),%eax
+  800769:	8b 10                	mov    (%eax),%edx
+  80076b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800770:	8d 40 04             	lea    0x4(%eax),%eax
+  800773:	89 45 14             	mov    %eax,0x14(%ebp)
+  800776:	be 0a 00 00 00       	mov    $0xa,%esi
+  80077b:	eb 7d                	jmp    8007fa <vprintfmt+0x426>
+  80077d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800780:	89 55 10             	mov    %edx,0x10(%ebp)
+  800783:	83 f9 01             	cmp    $0x1,%ecx
+  800786:	7f 1b                	jg     8007a3 <vprintfmt+0x3cf>
+  800788:	85 c9                	test   %ecx,%ecx
+  80078a:	74 2c                	je     8007b8 <vprintfmt+0x3e4>
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 10                	mov    (%eax),%edx
+  800791:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800796:	8d 40 04             	lea    0x4(%eax),%eax
+  800799:	89 45 14             	mov    %eax,0x14(%ebp)
+  80079c:	be 08 00 00 00       	mov    $0x8,%esi
+  8007a1:	eb 57                	jmp    8007fa <vprintfmt+0x426>
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b1:	be 08 00 00 00       	mov    $0x8,%esi
+  8007b6:	eb 42                	jmp    8007fa <vprintfmt+0x426>
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c8:	be 08 00 00 00       	mov    $0x8,%esi
+  8007cd:	eb 2b                	jmp    8007fa <vprintfmt+0x426>
+  8007cf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d2:	83 ec 08             	sub    $0x8,%esp
+  8007d5:	53                   	push   %ebx
+  8007d6:	6a 30                	push   $0x30
+  8007d8:	ff d7                	call   *%edi
+  8007da:	83 c4 08             	add    $0x8,%esp
+  8007dd:	53                   	push   %ebx
+  8007de:	6a 78                	push   $0x78
+  8007e0:	ff d7                	call   *%edi
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  8007ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f5:	be 10 00 00 00       	mov    $0x10,%esi
+  8007fa:	83 ec 0c             	sub    $0xc,%esp
+  8007fd:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800801:	50                   	push   %eax
+  800802:	ff 75 e4             	push   -0x1c(%ebp)
+  800805:	56                   	push   %esi
+  800806:	51                   	push   %ecx
+  800807:	52                   	push   %edx
+  800808:	89 da                	mov    %ebx,%edx
+  80080a:	89 f8                	mov    %edi,%eax
+  80080c:	e8 d8 fa ff ff       	call   8002e9 <printnum>
+  800811:	83 c4 20             	add    $0x20,%esp
+  800814:	e9 cc fb ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  800819:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80081c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80081f:	83 f9 01             	cmp    $0x1,%ecx
+  800822:	7f 1b                	jg     80083f <vprintfmt+0x46b>
+  800824:	85 c9                	test   %ecx,%ecx
+  800826:	74 2c                	je     800854 <vprintfmt+0x480>
+  800828:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082b:	8b 10                	mov    (%eax),%edx
+  80082d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800832:	8d 40 04             	lea    0x4(%eax),%eax
+  800835:	89 45 14             	mov    %eax,0x14(%ebp)
+  800838:	be 10 00 00 00       	mov    $0x10,%esi
+  80083d:	eb bb                	jmp    8007fa <vprintfmt+0x426>
+  80083f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800842:	8b 10                	mov    (%eax),%edx
+  800844:	8b 48 04             	mov    0x4(%eax),%ecx
+  800847:	8d 40 08             	lea    0x8(%eax),%eax
+  80084a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084d:	be 10 00 00 00       	mov    $0x10,%esi
+  800852:	eb a6                	jmp    8007fa <vprintfmt+0x426>
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8b 10                	mov    (%eax),%edx
+  800859:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085e:	8d 40 04             	lea    0x4(%eax),%eax
+  800861:	89 45 14             	mov    %eax,0x14(%ebp)
+  800864:	be 10 00 00 00       	mov    $0x10,%esi
+  800869:	eb 8f                	jmp    8007fa <vprintfmt+0x426>
+  80086b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80086e:	83 ec 08             	sub    $0x8,%esp
+  800871:	53                   	push   %ebx
+  800872:	6a 25                	push   $0x25
+  800874:	ff d7                	call   *%edi
+  800876:	83 c4 10             	add    $0x10,%esp
+  800879:	e9 67 fb ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	53                   	push   %ebx
+  800882:	6a 25                	push   $0x25
+  800884:	ff d7                	call   *%edi
+  800886:	83 c4 10             	add    $0x10,%esp
+  800889:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80088d:	0f 84 ba fb ff ff    	je     80044d <vprintfmt+0x79>
+  800893:	89 75 10             	mov    %esi,0x10(%ebp)
+  800896:	89 f0                	mov    %esi,%eax
+  800898:	83 e8 01             	sub    $0x1,%eax
+  80089b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80089f:	75 f7                	jne    800898 <vprintfmt+0x4c4>
+  8008a1:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008a4:	e9 3c fb ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  8008a9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008ac:	8d 70 01             	lea    0x1(%eax),%esi
+  8008af:	0f b6 00             	movzbl (%eax),%eax
+  8008b2:	0f be d0             	movsbl %al,%edx
+  8008b5:	85 d2                	test   %edx,%edx
+  8008b7:	74 11                	je     8008ca <vprintfmt+0x4f6>
+  8008b9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008bc:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008bf:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008c2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008c5:	e9 5d fd ff ff       	jmp    800627 <vprintfmt+0x253>
+  8008ca:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008d0:	e9 10 fb ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  8008d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008db:	e9 05 fb ff ff       	jmp    8003e5 <vprintfmt+0x11>
+  8008e0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008e4:	7e 0a                	jle    8008f0 <vprintfmt+0x51c>
+  8008e6:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008ea:	0f 85 bd fc ff ff    	jne    8005ad <vprintfmt+0x1d9>
+  8008f0:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008f5:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008fa:	be 5d 34 80 00       	mov    $0x80345d,%esi
+  8008ff:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800902:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800905:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800908:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80090b:	e9 17 fd ff ff       	jmp    800627 <vprintfmt+0x253>
+  800910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800913:	5b                   	pop    %ebx
+  800914:	5e                   	pop    %esi
+  800915:	5f                   	pop    %edi
+  800916:	5d                   	pop    %ebp
+  800917:	c3                   	ret
+
+00800918 <vsnprintf>:
+  800918:	55                   	push   %ebp
+  800919:	89 e5                	mov    %esp,%ebp
+  80091b:	83 ec 18             	sub    $0x18,%esp
+  80091e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800921:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800924:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800927:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80092b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80092e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800935:	85 c0                	test   %eax,%eax
+  800937:	74 26                	je     80095f <vsnprintf+0x47>
+  800939:	85 d2                	test   %edx,%edx
+  80093b:	7e 22                	jle    80095f <vsnprintf+0x47>
+  80093d:	ff 75 14             	push   0x14(%ebp)
+  800940:	ff 75 10             	push   0x10(%ebp)
+  800943:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800946:	50                   	push   %eax
+  800947:	68 9a 03 80 00       	push   $0x80039a
+  80094c:	e8 83 fa ff ff       	call   8003d4 <vprintfmt>
+  800951:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800954:	c6 00 00             	movb   $0x0,(%eax)
+  800957:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80095a:	83 c4 10             	add    $0x10,%esp
+  80095d:	c9                   	leave
+  80095e:	c3                   	ret
+  80095f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800964:	eb f7                	jmp    80095d <vsnprintf+0x45>
+
+00800966 <snprintf>:
+  800966:	55                   	push   %ebp
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	83 ec 08             	sub    $0x8,%esp
+  80096c:	8d 45 14             	lea    0x14(%ebp),%eax
+  80096f:	50                   	push   %eax
+  800970:	ff 75 10             	push   0x10(%ebp)
+  800973:	ff 75 0c             	push   0xc(%ebp)
+  800976:	ff 75 08             	push   0x8(%ebp)
+  800979:	e8 9a ff ff ff       	call   800918 <vsnprintf>
+  80097e:	c9                   	leave
+  80097f:	c3                   	ret
+
+00800980 <strlen>:
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	8b 55 08             	mov    0x8(%ebp),%edx
+  800986:	80 3a 00             	cmpb   $0x0,(%edx)
+  800989:	74 10                	je     80099b <strlen+0x1b>
+  80098b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800990:	83 c0 01             	add    $0x1,%eax
+  800993:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800997:	75 f7                	jne    800990 <strlen+0x10>
+  800999:	5d                   	pop    %ebp
+  80099a:	c3                   	ret
+  80099b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a0:	eb f7                	jmp    800999 <strlen+0x19>
+
+008009a2 <strnlen>:
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ab:	85 d2                	test   %edx,%edx
+  8009ad:	74 16                	je     8009c5 <strnlen+0x23>
+  8009af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009b8:	74 09                	je     8009c3 <strnlen+0x21>
+  8009ba:	83 c0 01             	add    $0x1,%eax
+  8009bd:	39 d0                	cmp    %edx,%eax
+  8009bf:	75 f3                	jne    8009b4 <strnlen+0x12>
+  8009c1:	89 d0                	mov    %edx,%eax
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+  8009c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ca:	eb f7                	jmp    8009c3 <strnlen+0x21>
+
+008009cc <strcpy>:
+  8009cc:	55                   	push   %ebp
+  8009cd:	89 e5                	mov    %esp,%ebp
+  8009cf:	53                   	push   %ebx
+  8009d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009db:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009df:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009e2:	83 c0 01             	add    $0x1,%eax
+  8009e5:	84 d2                	test   %dl,%dl
+  8009e7:	75 f2                	jne    8009db <strcpy+0xf>
+  8009e9:	89 c8                	mov    %ecx,%eax
+  8009eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ee:	c9                   	leave
+  8009ef:	c3                   	ret
+
+008009f0 <strcat>:
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	53                   	push   %ebx
+  8009f4:	83 ec 10             	sub    $0x10,%esp
+  8009f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009fa:	53                   	push   %ebx
+  8009fb:	e8 80 ff ff ff       	call   800980 <strlen>
+  800a00:	83 c4 08             	add    $0x8,%esp
+  800a03:	ff 75 0c             	push   0xc(%ebp)
+  800a06:	01 d8                	add    %ebx,%eax
+  800a08:	50                   	push   %eax
+  800a09:	e8 be ff ff ff       	call   8009cc <strcpy>
+  800a0e:	89 d8                	mov    %ebx,%eax
+  800a10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+
+00800a15 <strncpy>:
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	56                   	push   %esi
+  800a19:	53                   	push   %ebx
+  800a1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a23:	85 db                	test   %ebx,%ebx
+  800a25:	74 17                	je     800a3e <strncpy+0x29>
+  800a27:	01 f3                	add    %esi,%ebx
+  800a29:	89 f0                	mov    %esi,%eax
+  800a2b:	83 c0 01             	add    $0x1,%eax
+  800a2e:	0f b6 0a             	movzbl (%edx),%ecx
+  800a31:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a34:	80 f9 01             	cmp    $0x1,%cl
+  800a37:	83 da ff             	sbb    $0xffffffff,%edx
+  800a3a:	39 c3                	cmp    %eax,%ebx
+  800a3c:	75 ed                	jne    800a2b <strncpy+0x16>
+  800a3e:	89 f0                	mov    %esi,%eax
+  800a40:	5b                   	pop    %ebx
+  800a41:	5e                   	pop    %esi
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <strlcpy>:
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	56                   	push   %esi
+  800a48:	53                   	push   %ebx
+  800a49:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a52:	89 f0                	mov    %esi,%eax
+  800a54:	85 db                	test   %ebx,%ebx
+  800a56:	74 1e                	je     800a76 <strlcpy+0x32>
+  800a58:	83 eb 01             	sub    $0x1,%ebx
+  800a5b:	74 16                	je     800a73 <strlcpy+0x2f>
+  800a5d:	01 f3                	add    %esi,%ebx
+  800a5f:	0f b6 0a             	movzbl (%edx),%ecx
+  800a62:	84 c9                	test   %cl,%cl
+  800a64:	74 0d                	je     800a73 <strlcpy+0x2f>
+  800a66:	83 c2 01             	add    $0x1,%edx
+  800a69:	83 c0 01             	add    $0x1,%eax
+  800a6c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a6f:	39 d8                	cmp    %ebx,%eax
+  800a71:	75 ec                	jne    800a5f <strlcpy+0x1b>
+  800a73:	c6 00 00             	movb   $0x0,(%eax)
+  800a76:	29 f0                	sub    %esi,%eax
+  800a78:	5b                   	pop    %ebx
+  800a79:	5e                   	pop    %esi
+  800a7a:	5d                   	pop    %ebp
+  800a7b:	c3                   	ret
+
+00800a7c <strcmp>:
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a85:	0f b6 01             	movzbl (%ecx),%eax
+  800a88:	84 c0                	test   %al,%al
+  800a8a:	74 11                	je     800a9d <strcmp+0x21>
+  800a8c:	38 02                	cmp    %al,(%edx)
+  800a8e:	75 0d                	jne    800a9d <strcmp+0x21>
+  800a90:	83 c1 01             	add    $0x1,%ecx
+  800a93:	83 c2 01             	add    $0x1,%edx
+  800a96:	0f b6 01             	movzbl (%ecx),%eax
+  800a99:	84 c0                	test   %al,%al
+  800a9b:	75 ef                	jne    800a8c <strcmp+0x10>
+  800a9d:	0f b6 c0             	movzbl %al,%eax
+  800aa0:	0f b6 12             	movzbl (%edx),%edx
+  800aa3:	29 d0                	sub    %edx,%eax
+  800aa5:	5d                   	pop    %ebp
+  800aa6:	c3                   	ret
+
+00800aa7 <strncmp>:
+  800aa7:	55                   	push   %ebp
+  800aa8:	89 e5                	mov    %esp,%ebp
+  800aaa:	53                   	push   %ebx
+  800aab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ab1:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab9:	85 d2                	test   %edx,%edx
+  800abb:	74 2e                	je     800aeb <strncmp+0x44>
+  800abd:	0f b6 01             	movzbl (%ecx),%eax
+  800ac0:	84 c0                	test   %al,%al
+  800ac2:	74 16                	je     800ada <strncmp+0x33>
+  800ac4:	3a 03                	cmp    (%ebx),%al
+  800ac6:	75 12                	jne    800ada <strncmp+0x33>
+  800ac8:	83 c1 01             	add    $0x1,%ecx
+  800acb:	83 c3 01             	add    $0x1,%ebx
+  800ace:	83 ea 01             	sub    $0x1,%edx
+  800ad1:	75 ea                	jne    800abd <strncmp+0x16>
+  800ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad8:	eb 11                	jmp    800aeb <strncmp+0x44>
+  800ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adf:	85 d2                	test   %edx,%edx
+  800ae1:	74 08                	je     800aeb <strncmp+0x44>
+  800ae3:	0f b6 01             	movzbl (%ecx),%eax
+  800ae6:	0f b6 13             	movzbl (%ebx),%edx
+  800ae9:	29 d0                	sub    %edx,%eax
+  800aeb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aee:	c9                   	leave
+  800aef:	c3                   	ret
+
+00800af0 <strchr>:
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800afa:	0f b6 10             	movzbl (%eax),%edx
+  800afd:	84 d2                	test   %dl,%dl
+  800aff:	74 15                	je     800b16 <strchr+0x26>
+  800b01:	38 d1                	cmp    %dl,%cl
+  800b03:	74 0f                	je     800b14 <strchr+0x24>
+  800b05:	83 c0 01             	add    $0x1,%eax
+  800b08:	0f b6 10             	movzbl (%eax),%edx
+  800b0b:	84 d2                	test   %dl,%dl
+  800b0d:	75 f2                	jne    800b01 <strchr+0x11>
+  800b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+  800b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1b:	eb f7                	jmp    800b14 <strchr+0x24>
+
+00800b1d <strfind>:
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	53                   	push   %ebx
+  800b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b24:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b27:	0f b6 18             	movzbl (%eax),%ebx
+  800b2a:	38 d3                	cmp    %dl,%bl
+  800b2c:	74 14                	je     800b42 <strfind+0x25>
+  800b2e:	89 d1                	mov    %edx,%ecx
+  800b30:	84 db                	test   %bl,%bl
+  800b32:	74 0e                	je     800b42 <strfind+0x25>
+  800b34:	83 c0 01             	add    $0x1,%eax
+  800b37:	0f b6 10             	movzbl (%eax),%edx
+  800b3a:	38 ca                	cmp    %cl,%dl
+  800b3c:	74 04                	je     800b42 <strfind+0x25>
+  800b3e:	84 d2                	test   %dl,%dl
+  800b40:	75 f2                	jne    800b34 <strfind+0x17>
+  800b42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b45:	c9                   	leave
+  800b46:	c3                   	ret
+
+00800b47 <memset>:
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	57                   	push   %edi
+  800b4b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b4e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b51:	85 c9                	test   %ecx,%ecx
+  800b53:	74 20                	je     800b75 <memset+0x2e>
+  800b55:	89 f8                	mov    %edi,%eax
+  800b57:	09 c8                	or     %ecx,%eax
+  800b59:	a8 03                	test   $0x3,%al
+  800b5b:	75 12                	jne    800b6f <memset+0x28>
+  800b5d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b61:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800b67:	c1 e9 02             	shr    $0x2,%ecx
+  800b6a:	fc                   	cld
+  800b6b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b6d:	eb 06                	jmp    800b75 <memset+0x2e>
+  800b6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b72:	fc                   	cld
+  800b73:	f3 aa                	rep stos %al,%es:(%edi)
+  800b75:	89 f8                	mov    %edi,%eax
+  800b77:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b7a:	c9                   	leave
+  800b7b:	c3                   	ret
+
+00800b7c <memmove>:
+  800b7c:	55                   	push   %ebp
+  800b7d:	89 e5                	mov    %esp,%ebp
+  800b7f:	57                   	push   %edi
+  800b80:	56                   	push   %esi
+  800b81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b84:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b8a:	39 c6                	cmp    %eax,%esi
+  800b8c:	73 32                	jae    800bc0 <memmove+0x44>
+  800b8e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b91:	39 d0                	cmp    %edx,%eax
+  800b93:	73 2b                	jae    800bc0 <memmove+0x44>
+  800b95:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800b98:	89 d6                	mov    %edx,%esi
+  800b9a:	09 fe                	or     %edi,%esi
+  800b9c:	09 ce                	or     %ecx,%esi
+  800b9e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ba4:	75 0e                	jne    800bb4 <memmove+0x38>
+  800ba6:	83 ef 04             	sub    $0x4,%edi
+  800ba9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bac:	c1 e9 02             	shr    $0x2,%ecx
+  800baf:	fd                   	std
+  800bb0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb2:	eb 09                	jmp    800bbd <memmove+0x41>
+  800bb4:	83 ef 01             	sub    $0x1,%edi
+  800bb7:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800bba:	fd                   	std
+  800bbb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800bbd:	fc                   	cld
+  800bbe:	eb 1a                	jmp    800bda <memmove+0x5e>
+  800bc0:	89 f2                	mov    %esi,%edx
+  800bc2:	09 c2                	or     %eax,%edx
+  800bc4:	09 ca                	or     %ecx,%edx
+  800bc6:	f6 c2 03             	test   $0x3,%dl
+  800bc9:	75 0a                	jne    800bd5 <memmove+0x59>
+  800bcb:	c1 e9 02             	shr    $0x2,%ecx
+  800bce:	89 c7                	mov    %eax,%edi
+  800bd0:	fc                   	cld
+  800bd1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd3:	eb 05                	jmp    800bda <memmove+0x5e>
+  800bd5:	89 c7                	mov    %eax,%edi
+  800bd7:	fc                   	cld
+  800bd8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800bda:	5e                   	pop    %esi
+  800bdb:	5f                   	pop    %edi
+  800bdc:	5d                   	pop    %ebp
+  800bdd:	c3                   	ret
+
+00800bde <memcpy>:
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	83 ec 0c             	sub    $0xc,%esp
+  800be4:	ff 75 10             	push   0x10(%ebp)
+  800be7:	ff 75 0c             	push   0xc(%ebp)
+  800bea:	ff 75 08             	push   0x8(%ebp)
+  800bed:	e8 8a ff ff ff       	call   800b7c <memmove>
+  800bf2:	c9                   	leave
+  800bf3:	c3                   	ret
+
+00800bf4 <memcmp>:
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	56                   	push   %esi
+  800bf8:	53                   	push   %ebx
+  800bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bff:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c02:	85 f6                	test   %esi,%esi
+  800c04:	74 29                	je     800c2f <memcmp+0x3b>
+  800c06:	01 c6                	add    %eax,%esi
+  800c08:	0f b6 08             	movzbl (%eax),%ecx
+  800c0b:	0f b6 1a             	movzbl (%edx),%ebx
+  800c0e:	38 d9                	cmp    %bl,%cl
+  800c10:	75 11                	jne    800c23 <memcmp+0x2f>
+  800c12:	83 c0 01             	add    $0x1,%eax
+  800c15:	83 c2 01             	add    $0x1,%edx
+  800c18:	39 c6                	cmp    %eax,%esi
+  800c1a:	75 ec                	jne    800c08 <memcmp+0x14>
+  800c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c21:	eb 08                	jmp    800c2b <memcmp+0x37>
+  800c23:	0f b6 c1             	movzbl %cl,%eax
+  800c26:	0f b6 db             	movzbl %bl,%ebx
+  800c29:	29 d8                	sub    %ebx,%eax
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5d                   	pop    %ebp
+  800c2e:	c3                   	ret
+  800c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c34:	eb f5                	jmp    800c2b <memcmp+0x37>
+
+00800c36 <memfind>:
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3f:	89 c2                	mov    %eax,%edx
+  800c41:	03 55 10             	add    0x10(%ebp),%edx
+  800c44:	39 d0                	cmp    %edx,%eax
+  800c46:	73 0d                	jae    800c55 <memfind+0x1f>
+  800c48:	38 08                	cmp    %cl,(%eax)
+  800c4a:	74 0d                	je     800c59 <memfind+0x23>
+  800c4c:	83 c0 01             	add    $0x1,%eax
+  800c4f:	39 c2                	cmp    %eax,%edx
+  800c51:	75 f5                	jne    800c48 <memfind+0x12>
+  800c53:	eb 06                	jmp    800c5b <memfind+0x25>
+  800c55:	89 c2                	mov    %eax,%edx
+  800c57:	eb 02                	jmp    800c5b <memfind+0x25>
+  800c59:	89 c2                	mov    %eax,%edx
+  800c5b:	89 d0                	mov    %edx,%eax
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+
+00800c5f <strtol>:
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+  800c65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6b:	0f b6 02             	movzbl (%edx),%eax
+  800c6e:	3c 20                	cmp    $0x20,%al
+  800c70:	74 04                	je     800c76 <strtol+0x17>
+  800c72:	3c 09                	cmp    $0x9,%al
+  800c74:	75 0e                	jne    800c84 <strtol+0x25>
+  800c76:	83 c2 01             	add    $0x1,%edx
+  800c79:	0f b6 02             	movzbl (%edx),%eax
+  800c7c:	3c 20                	cmp    $0x20,%al
+  800c7e:	74 f6                	je     800c76 <strtol+0x17>
+  800c80:	3c 09                	cmp    $0x9,%al
+  800c82:	74 f2                	je     800c76 <strtol+0x17>
+  800c84:	3c 2b                	cmp    $0x2b,%al
+  800c86:	74 2a                	je     800cb2 <strtol+0x53>
+  800c88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c8d:	3c 2d                	cmp    $0x2d,%al
+  800c8f:	74 2b                	je     800cbc <strtol+0x5d>
+  800c91:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c97:	75 0f                	jne    800ca8 <strtol+0x49>
+  800c99:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c9c:	74 28                	je     800cc6 <strtol+0x67>
+  800c9e:	85 db                	test   %ebx,%ebx
+  800ca0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ca5:	0f 44 d8             	cmove  %eax,%ebx
+  800ca8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cad:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cb0:	eb 46                	jmp    800cf8 <strtol+0x99>
+  800cb2:	83 c2 01             	add    $0x1,%edx
+  800cb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cba:	eb d5                	jmp    800c91 <strtol+0x32>
+  800cbc:	83 c2 01             	add    $0x1,%edx
+  800cbf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cc4:	eb cb                	jmp    800c91 <strtol+0x32>
+  800cc6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cca:	74 0e                	je     800cda <strtol+0x7b>
+  800ccc:	85 db                	test   %ebx,%ebx
+  800cce:	75 d8                	jne    800ca8 <strtol+0x49>
+  800cd0:	83 c2 01             	add    $0x1,%edx
+  800cd3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cd8:	eb ce                	jmp    800ca8 <strtol+0x49>
+  800cda:	83 c2 02             	add    $0x2,%edx
+  800cdd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ce2:	eb c4                	jmp    800ca8 <strtol+0x49>
+  800ce4:	0f be c0             	movsbl %al,%eax
+  800ce7:	83 e8 30             	sub    $0x30,%eax
+  800cea:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ced:	7d 3a                	jge    800d29 <strtol+0xca>
+  800cef:	83 c2 01             	add    $0x1,%edx
+  800cf2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cf6:	01 c1                	add    %eax,%ecx
+  800cf8:	0f b6 02             	movzbl (%edx),%eax
+  800cfb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cfe:	89 f3                	mov    %esi,%ebx
+  800d00:	80 fb 09             	cmp    $0x9,%bl
+  800d03:	76 df                	jbe    800ce4 <strtol+0x85>
+  800d05:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d08:	89 f3                	mov    %esi,%ebx
+  800d0a:	80 fb 19             	cmp    $0x19,%bl
+  800d0d:	77 08                	ja     800d17 <strtol+0xb8>
+  800d0f:	0f be c0             	movsbl %al,%eax
+  800d12:	83 e8 57             	sub    $0x57,%eax
+  800d15:	eb d3                	jmp    800cea <strtol+0x8b>
+  800d17:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d1a:	89 f3                	mov    %esi,%ebx
+  800d1c:	80 fb 19             	cmp    $0x19,%bl
+  800d1f:	77 08                	ja     800d29 <strtol+0xca>
+  800d21:	0f be c0             	movsbl %al,%eax
+  800d24:	83 e8 37             	sub    $0x37,%eax
+  800d27:	eb c1                	jmp    800cea <strtol+0x8b>
+  800d29:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d2d:	74 05                	je     800d34 <strtol+0xd5>
+  800d2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d32:	89 10                	mov    %edx,(%eax)
+  800d34:	89 c8                	mov    %ecx,%eax
+  800d36:	f7 d8                	neg    %eax
+  800d38:	85 ff                	test   %edi,%edi
+  800d3a:	0f 45 c8             	cmovne %eax,%ecx
+  800d3d:	89 c8                	mov    %ecx,%eax
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5f                   	pop    %edi
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+
+00800d44 <sys_cputs>:
+  800d44:	55                   	push   %ebp
+  800d45:	89 e5                	mov    %esp,%ebp
+  800d47:	57                   	push   %edi
+  800d48:	56                   	push   %esi
+  800d49:	53                   	push   %ebx
+  800d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d55:	89 c3                	mov    %eax,%ebx
+  800d57:	89 c7                	mov    %eax,%edi
+  800d59:	89 c6                	mov    %eax,%esi
+  800d5b:	cd 30                	int    $0x30
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <sys_cgetc>:
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	56                   	push   %esi
+  800d67:	53                   	push   %ebx
+  800d68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d72:	89 d1                	mov    %edx,%ecx
+  800d74:	89 d3                	mov    %edx,%ebx
+  800d76:	89 d7                	mov    %edx,%edi
+  800d78:	89 d6                	mov    %edx,%esi
+  800d7a:	cd 30                	int    $0x30
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5e                   	pop    %esi
+  800d7e:	5f                   	pop    %edi
+  800d7f:	5d                   	pop    %ebp
+  800d80:	c3                   	ret
+
+00800d81 <sys_env_destroy>:
+  800d81:	55                   	push   %ebp
+  800d82:	89 e5                	mov    %esp,%ebp
+  800d84:	57                   	push   %edi
+  800d85:	56                   	push   %esi
+  800d86:	53                   	push   %ebx
+  800d87:	83 ec 0c             	sub    $0xc,%esp
+  800d8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d92:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d97:	89 cb                	mov    %ecx,%ebx
+  800d99:	89 cf                	mov    %ecx,%edi
+  800d9b:	89 ce                	mov    %ecx,%esi
+  800d9d:	cd 30                	int    $0x30
+  800d9f:	85 c0                	test   %eax,%eax
+  800da1:	7f 08                	jg     800dab <sys_env_destroy+0x2a>
+  800da3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da6:	5b                   	pop    %ebx
+  800da7:	5e                   	pop    %esi
+  800da8:	5f                   	pop    %edi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+  800dab:	83 ec 0c             	sub    $0xc,%esp
+  800dae:	50                   	push   %eax
+  800daf:	6a 03                	push   $0x3
+  800db1:	68 4b 37 80 00       	push   $0x80374b
+  800db6:	6a 24                	push   $0x24
+  800db8:	68 68 37 80 00       	push   $0x803768
+  800dbd:	e8 38 f4 ff ff       	call   8001fa <_panic>
+
+00800dc2 <sys_getenvid>:
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	57                   	push   %edi
+  800dc6:	56                   	push   %esi
+  800dc7:	53                   	push   %ebx
+  800dc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd2:	89 d1                	mov    %edx,%ecx
+  800dd4:	89 d3                	mov    %edx,%ebx
+  800dd6:	89 d7                	mov    %edx,%edi
+  800dd8:	89 d6                	mov    %edx,%esi
+  800dda:	cd 30                	int    $0x30
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5f                   	pop    %edi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <sys_yield>:
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	57                   	push   %edi
+  800de5:	56                   	push   %esi
+  800de6:	53                   	push   %ebx
+  800de7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800dee:	74 26                	je     800e16 <sys_yield+0x35>
+  800df0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dfa:	89 d1                	mov    %edx,%ecx
+  800dfc:	89 d3                	mov    %edx,%ebx
+  800dfe:	89 d7                	mov    %edx,%edi
+  800e00:	6a 00                	push   $0x0
+  800e02:	55                   	push   %ebp
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	8d 35 0d 0e 80 00    	lea    0x800e0d,%esi
+  800e0b:	0f 34                	sysenter
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	83 c4 04             	add    $0x4,%esp
+  800e11:	5b                   	pop    %ebx
+  800e12:	5e                   	pop    %esi
+  800e13:	5f                   	pop    %edi
+  800e14:	5d                   	pop    %ebp
+  800e15:	c3                   	ret
+  800e16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e20:	89 d1                	mov    %edx,%ecx
+  800e22:	89 d3                	mov    %edx,%ebx
+  800e24:	89 d7                	mov    %edx,%edi
+  800e26:	89 d6                	mov    %edx,%esi
+  800e28:	cd 30                	int    $0x30
+  800e2a:	eb e5                	jmp    800e11 <sys_yield+0x30>
+
+00800e2c <sys_page_alloc>:
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	57                   	push   %edi
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e48:	89 f7                	mov    %esi,%edi
+  800e4a:	cd 30                	int    $0x30
+  800e4c:	85 c0                	test   %eax,%eax
+  800e4e:	7f 08                	jg     800e58 <sys_page_alloc+0x2c>
+  800e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e53:	5b                   	pop    %ebx
+  800e54:	5e                   	pop    %esi
+  800e55:	5f                   	pop    %edi
+  800e56:	5d                   	pop    %ebp
+  800e57:	c3                   	ret
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  800e5b:	50                   	push   %eax
+  800e5c:	6a 04                	push   $0x4
+  800e5e:	68 4b 37 80 00       	push   $0x80374b
+  800e63:	6a 24                	push   $0x24
+  800e65:	68 68 37 80 00       	push   $0x803768
+  800e6a:	e8 8b f3 ff ff       	call   8001fa <_panic>
+
+00800e6f <sys_page_map>:
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	57                   	push   %edi
+  800e73:	56                   	push   %esi
+  800e74:	53                   	push   %ebx
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+  800e78:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e7f:	74 33                	je     800eb4 <sys_page_map+0x45>
+  800e81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e87:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e92:	ff 75 18             	push   0x18(%ebp)
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	8d 35 a0 0e 80 00    	lea    0x800ea0,%esi
+  800e9e:	0f 34                	sysenter
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	83 c4 04             	add    $0x4,%esp
+  800ea4:	89 c2                	mov    %eax,%edx
+  800ea6:	85 c0                	test   %eax,%eax
+  800ea8:	7f 3d                	jg     800ee7 <sys_page_map+0x78>
+  800eaa:	89 d0                	mov    %edx,%eax
+  800eac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eaf:	5b                   	pop    %ebx
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5f                   	pop    %edi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	c3                   	ret
+  800eb4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ec8:	cd 30                	int    $0x30
+  800eca:	89 c2                	mov    %eax,%edx
+  800ecc:	85 c0                	test   %eax,%eax
+  800ece:	7e da                	jle    800eaa <sys_page_map+0x3b>
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  800ed3:	50                   	push   %eax
+  800ed4:	6a 05                	push   $0x5
+  800ed6:	68 4b 37 80 00       	push   $0x80374b
+  800edb:	6a 24                	push   $0x24
+  800edd:	68 68 37 80 00       	push   $0x803768
+  800ee2:	e8 13 f3 ff ff       	call   8001fa <_panic>
+  800ee7:	83 ec 0c             	sub    $0xc,%esp
+  800eea:	50                   	push   %eax
+  800eeb:	6a 05                	push   $0x5
+  800eed:	68 4b 37 80 00       	push   $0x80374b
+  800ef2:	6a 48                	push   $0x48
+  800ef4:	68 68 37 80 00       	push   $0x803768
+  800ef9:	e8 fc f2 ff ff       	call   8001fa <_panic>
+
+00800efe <sys_page_unmap>:
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	57                   	push   %edi
+  800f02:	56                   	push   %esi
+  800f03:	53                   	push   %ebx
+  800f04:	83 ec 0c             	sub    $0xc,%esp
+  800f07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f12:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f17:	89 df                	mov    %ebx,%edi
+  800f19:	89 de                	mov    %ebx,%esi
+  800f1b:	cd 30                	int    $0x30
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	7f 08                	jg     800f29 <sys_page_unmap+0x2b>
+  800f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+  800f2c:	50                   	push   %eax
+  800f2d:	6a 06                	push   $0x6
+  800f2f:	68 4b 37 80 00       	push   $0x80374b
+  800f34:	6a 24                	push   $0x24
+  800f36:	68 68 37 80 00       	push   $0x803768
+  800f3b:	e8 ba f2 ff ff       	call   8001fa <_panic>
+
+00800f40 <sys_fork>:
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  800f46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f50:	89 d1                	mov    %edx,%ecx
+  800f52:	89 d3                	mov    %edx,%ebx
+  800f54:	89 d7                	mov    %edx,%edi
+  800f56:	89 d6                	mov    %edx,%esi
+  800f58:	cd 30                	int    $0x30
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5e                   	pop    %esi
+  800f5c:	5f                   	pop    %edi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	c3                   	ret
+
+00800f5f <sys_env_set_status>:
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	57                   	push   %edi
+  800f63:	56                   	push   %esi
+  800f64:	53                   	push   %ebx
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f73:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f78:	89 df                	mov    %ebx,%edi
+  800f7a:	89 de                	mov    %ebx,%esi
+  800f7c:	cd 30                	int    $0x30
+  800f7e:	85 c0                	test   %eax,%eax
+  800f80:	7f 08                	jg     800f8a <sys_env_set_status+0x2b>
+  800f82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f85:	5b                   	pop    %ebx
+  800f86:	5e                   	pop    %esi
+  800f87:	5f                   	pop    %edi
+  800f88:	5d                   	pop    %ebp
+  800f89:	c3                   	ret
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+  800f8d:	50                   	push   %eax
+  800f8e:	6a 08                	push   $0x8
+  800f90:	68 4b 37 80 00       	push   $0x80374b
+  800f95:	6a 24                	push   $0x24
+  800f97:	68 68 37 80 00       	push   $0x803768
+  800f9c:	e8 59 f2 ff ff       	call   8001fa <_panic>
+
+00800fa1 <sys_env_set_trapframe>:
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	57                   	push   %edi
+  800fa5:	56                   	push   %esi
+  800fa6:	53                   	push   %ebx
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+  800faa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800faf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb5:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fba:	89 df                	mov    %ebx,%edi
+  800fbc:	89 de                	mov    %ebx,%esi
+  800fbe:	cd 30                	int    $0x30
+  800fc0:	85 c0                	test   %eax,%eax
+  800fc2:	7f 08                	jg     800fcc <sys_env_set_trapframe+0x2b>
+  800fc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc7:	5b                   	pop    %ebx
+  800fc8:	5e                   	pop    %esi
+  800fc9:	5f                   	pop    %edi
+  800fca:	5d                   	pop    %ebp
+  800fcb:	c3                   	ret
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+  800fcf:	50                   	push   %eax
+  800fd0:	6a 09                	push   $0x9
+  800fd2:	68 4b 37 80 00       	push   $0x80374b
+  800fd7:	6a 24                	push   $0x24
+  800fd9:	68 68 37 80 00       	push   $0x803768
+  800fde:	e8 17 f2 ff ff       	call   8001fa <_panic>
+
+00800fe3 <sys_env_set_cow>:
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	57                   	push   %edi
+  800fe7:	56                   	push   %esi
+  800fe8:	53                   	push   %ebx
+  800fe9:	83 ec 0c             	sub    $0xc,%esp
+  800fec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff7:	b8 20 00 00 00       	mov    $0x20,%eax
+  800ffc:	89 df                	mov    %ebx,%edi
+  800ffe:	89 de                	mov    %ebx,%esi
+  801000:	cd 30                	int    $0x30
+  801002:	85 c0                	test   %eax,%eax
+  801004:	7f 08                	jg     80100e <sys_env_set_cow+0x2b>
+  801006:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+  801011:	50                   	push   %eax
+  801012:	6a 20                	push   $0x20
+  801014:	68 4b 37 80 00       	push   $0x80374b
+  801019:	6a 24                	push   $0x24
+  80101b:	68 68 37 80 00       	push   $0x803768
+  801020:	e8 d5 f1 ff ff       	call   8001fa <_panic>
+
+00801025 <sys_env_service>:
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	56                   	push   %esi
+  80102a:	53                   	push   %ebx
+  80102b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801030:	8b 55 08             	mov    0x8(%ebp),%edx
+  801033:	b8 21 00 00 00       	mov    $0x21,%eax
+  801038:	89 cb                	mov    %ecx,%ebx
+  80103a:	89 cf                	mov    %ecx,%edi
+  80103c:	89 ce                	mov    %ecx,%esi
+  80103e:	cd 30                	int    $0x30
+  801040:	5b                   	pop    %ebx
+  801041:	5e                   	pop    %esi
+  801042:	5f                   	pop    %edi
+  801043:	5d                   	pop    %ebp
+  801044:	c3                   	ret
+
+00801045 <sys_env_set_pgfault_upcall>:
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	57                   	push   %edi
+  801049:	56                   	push   %esi
+  80104a:	53                   	push   %ebx
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801053:	8b 55 08             	mov    0x8(%ebp),%edx
+  801056:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801059:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80105e:	89 df                	mov    %ebx,%edi
+  801060:	89 de                	mov    %ebx,%esi
+  801062:	cd 30                	int    $0x30
+  801064:	85 c0                	test   %eax,%eax
+  801066:	7f 08                	jg     801070 <sys_env_set_pgfault_upcall+0x2b>
+  801068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+  801070:	83 ec 0c             	sub    $0xc,%esp
+  801073:	50                   	push   %eax
+  801074:	6a 0a                	push   $0xa
+  801076:	68 4b 37 80 00       	push   $0x80374b
+  80107b:	6a 24                	push   $0x24
+  80107d:	68 68 37 80 00       	push   $0x803768
+  801082:	e8 73 f1 ff ff       	call   8001fa <_panic>
+
+00801087 <sys_ipc_try_send>:
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	56                   	push   %esi
+  80108c:	53                   	push   %ebx
+  80108d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801094:	74 27                	je     8010bd <sys_ipc_try_send+0x36>
+  801096:	8b 55 08             	mov    0x8(%ebp),%edx
+  801099:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a7:	6a 00                	push   $0x0
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	8d 35 b4 10 80 00    	lea    0x8010b4,%esi
+  8010b2:	0f 34                	sysenter
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	83 c4 04             	add    $0x4,%esp
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5e                   	pop    %esi
+  8010ba:	5f                   	pop    %edi
+  8010bb:	5d                   	pop    %ebp
+  8010bc:	c3                   	ret
+  8010bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010d3:	cd 30                	int    $0x30
+  8010d5:	eb e1                	jmp    8010b8 <sys_ipc_try_send+0x31>
+
+008010d7 <sys_ipc_recv>:
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010e7:	74 32                	je     80111b <sys_ipc_recv+0x44>
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f6:	89 cb                	mov    %ecx,%ebx
+  8010f8:	89 cf                	mov    %ecx,%edi
+  8010fa:	6a 00                	push   $0x0
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	8d 35 07 11 80 00    	lea    0x801107,%esi
+  801105:	0f 34                	sysenter
+  801107:	5d                   	pop    %ebp
+  801108:	83 c4 04             	add    $0x4,%esp
+  80110b:	89 c2                	mov    %eax,%edx
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	7f 3c                	jg     80114d <sys_ipc_recv+0x76>
+  801111:	89 d0                	mov    %edx,%eax
+  801113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801116:	5b                   	pop    %ebx
+  801117:	5e                   	pop    %esi
+  801118:	5f                   	pop    %edi
+  801119:	5d                   	pop    %ebp
+  80111a:	c3                   	ret
+  80111b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801120:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	89 cb                	mov    %ecx,%ebx
+  80112a:	89 cf                	mov    %ecx,%edi
+  80112c:	89 ce                	mov    %ecx,%esi
+  80112e:	cd 30                	int    $0x30
+  801130:	89 c2                	mov    %eax,%edx
+  801132:	85 c0                	test   %eax,%eax
+  801134:	7e db                	jle    801111 <sys_ipc_recv+0x3a>
+  801136:	83 ec 0c             	sub    $0xc,%esp
+  801139:	50                   	push   %eax
+  80113a:	6a 0d                	push   $0xd
+  80113c:	68 4b 37 80 00       	push   $0x80374b
+  801141:	6a 24                	push   $0x24
+  801143:	68 68 37 80 00       	push   $0x803768
+  801148:	e8 ad f0 ff ff       	call   8001fa <_panic>
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	50                   	push   %eax
+  801151:	6a 0d                	push   $0xd
+  801153:	68 4b 37 80 00       	push   $0x80374b
+  801158:	6a 48                	push   $0x48
+  80115a:	68 68 37 80 00       	push   $0x803768
+  80115f:	e8 96 f0 ff ff       	call   8001fa <_panic>
+
+00801164 <sys_ipc_send>:
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801171:	74 27                	je     80119a <sys_ipc_send+0x36>
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80117e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801181:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801184:	6a 00                	push   $0x0
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	8d 35 91 11 80 00    	lea    0x801191,%esi
+  80118f:	0f 34                	sysenter
+  801191:	5d                   	pop    %ebp
+  801192:	83 c4 04             	add    $0x4,%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+  80119a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80119f:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b0:	cd 30                	int    $0x30
+  8011b2:	eb e1                	jmp    801195 <sys_ipc_send+0x31>
+
+008011b4 <sys_ipc_call>:
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011cb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ce:	cd 30                	int    $0x30
+  8011d0:	5b                   	pop    %ebx
+  8011d1:	5e                   	pop    %esi
+  8011d2:	5f                   	pop    %edi
+  8011d3:	5d                   	pop    %ebp
+  8011d4:	c3                   	ret
+
+008011d5 <sys_ipc_reply_recv>:
+  8011d5:	55                   	push   %ebp
+  8011d6:	89 e5                	mov    %esp,%ebp
+  8011d8:	57                   	push   %edi
+  8011d9:	56                   	push   %esi
+  8011da:	53                   	push   %ebx
+  8011db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ec:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ef:	cd 30                	int    $0x30
+  8011f1:	5b                   	pop    %ebx
+  8011f2:	5e                   	pop    %esi
+  8011f3:	5f                   	pop    %edi
+  8011f4:	5d                   	pop    %ebp
+  8011f5:	c3                   	ret
+
+008011f6 <sys_time_msec>:
+  8011f6:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	75 06                	jne    801205 <sys_time_msec+0xf>
+  8011ff:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801204:	c3                   	ret
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	0f 31                	rdtsc
+  801210:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801216:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80121c:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801222:	29 c8                	sub    %ecx,%eax
+  801224:	19 da                	sbb    %ebx,%edx
+  801226:	bf 00 00 00 00       	mov    $0x0,%edi
+  80122b:	57                   	push   %edi
+  80122c:	56                   	push   %esi
+  80122d:	52                   	push   %edx
+  80122e:	50                   	push   %eax
+  80122f:	e8 5f 20 00 00       	call   803293 <__udivdi3>
+  801234:	83 c4 10             	add    $0x10,%esp
+  801237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123a:	5b                   	pop    %ebx
+  80123b:	5e                   	pop    %esi
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <sys_env_swap>:
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+  801245:	83 ec 0c             	sub    $0xc,%esp
+  801248:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801250:	b8 12 00 00 00       	mov    $0x12,%eax
+  801255:	89 cb                	mov    %ecx,%ebx
+  801257:	89 cf                	mov    %ecx,%edi
+  801259:	89 ce                	mov    %ecx,%esi
+  80125b:	cd 30                	int    $0x30
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	7f 08                	jg     801269 <sys_env_swap+0x2a>
+  801261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  80126c:	50                   	push   %eax
+  80126d:	6a 12                	push   $0x12
+  80126f:	68 4b 37 80 00       	push   $0x80374b
+  801274:	6a 24                	push   $0x24
+  801276:	68 68 37 80 00       	push   $0x803768
+  80127b:	e8 7a ef ff ff       	call   8001fa <_panic>
+
+00801280 <sys_net_try_send>:
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801291:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801294:	b8 13 00 00 00       	mov    $0x13,%eax
+  801299:	89 df                	mov    %ebx,%edi
+  80129b:	89 de                	mov    %ebx,%esi
+  80129d:	cd 30                	int    $0x30
+  80129f:	85 c0                	test   %eax,%eax
+  8012a1:	7f 08                	jg     8012ab <sys_net_try_send+0x2b>
+  8012a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a6:	5b                   	pop    %ebx
+  8012a7:	5e                   	pop    %esi
+  8012a8:	5f                   	pop    %edi
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+  8012ab:	83 ec 0c             	sub    $0xc,%esp
+  8012ae:	50                   	push   %eax
+  8012af:	6a 13                	push   $0x13
+  8012b1:	68 4b 37 80 00       	push   $0x80374b
+  8012b6:	6a 24                	push   $0x24
+  8012b8:	68 68 37 80 00       	push   $0x803768
+  8012bd:	e8 38 ef ff ff       	call   8001fa <_panic>
+
+008012c2 <sys_net_try_receive>:
+  8012c2:	55                   	push   %ebp
+  8012c3:	89 e5                	mov    %esp,%ebp
+  8012c5:	57                   	push   %edi
+  8012c6:	56                   	push   %esi
+  8012c7:	53                   	push   %ebx
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012db:	89 df                	mov    %ebx,%edi
+  8012dd:	89 de                	mov    %ebx,%esi
+  8012df:	cd 30                	int    $0x30
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	7f 08                	jg     8012ed <sys_net_try_receive+0x2b>
+  8012e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e8:	5b                   	pop    %ebx
+  8012e9:	5e                   	pop    %esi
+  8012ea:	5f                   	pop    %edi
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+  8012ed:	83 ec 0c             	sub    $0xc,%esp
+  8012f0:	50                   	push   %eax
+  8012f1:	6a 14                	push   $0x14
+  8012f3:	68 4b 37 80 00       	push   $0x80374b
+  8012f8:	6a 24                	push   $0x24
+  8012fa:	68 68 37 80 00       	push   $0x803768
+  8012ff:	e8 f6 ee ff ff       	call   8001fa <_panic>
+
+00801304 <sys_net_recv_page>:
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	57                   	push   %edi
+  801308:	56                   	push   %esi
+  801309:	53                   	push   %ebx
+  80130a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801312:	b8 27 00 00 00       	mov    $0x27,%eax
+  801317:	89 cb                	mov    %ecx,%ebx
+  801319:	89 cf                	mov    %ecx,%edi
+  80131b:	89 ce                	mov    %ecx,%esi
+  80131d:	cd 30                	int    $0x30
+  80131f:	5b                   	pop    %ebx
+  801320:	5e                   	pop    %esi
+  801321:	5f                   	pop    %edi
+  801322:	5d                   	pop    %ebp
+  801323:	c3                   	ret
+
+00801324 <sys_net_wait>:
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	57                   	push   %edi
+  801328:	56                   	push   %esi
+  801329:	53                   	push   %ebx
+  80132a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132f:	b8 26 00 00 00       	mov    $0x26,%eax
+  801334:	89 d1                	mov    %edx,%ecx
+  801336:	89 d3                	mov    %edx,%ebx
+  801338:	89 d7                	mov    %edx,%edi
+  80133a:	89 d6                	mov    %edx,%esi
+  80133c:	cd 30                	int    $0x30
+  80133e:	5b                   	pop    %ebx
+  80133f:	5e                   	pop    %esi
+  801340:	5f                   	pop    %edi
+  801341:	5d                   	pop    %ebp
+  801342:	c3                   	ret
+
+00801343 <sys_get_mac>:
+  801343:	55                   	push   %ebp
+  801344:	89 e5                	mov    %esp,%ebp
+  801346:	57                   	push   %edi
+  801347:	56                   	push   %esi
+  801348:	53                   	push   %ebx
+  801349:	83 ec 0c             	sub    $0xc,%esp
+  80134c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801351:	8b 55 08             	mov    0x8(%ebp),%edx
+  801354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801357:	b8 15 00 00 00       	mov    $0x15,%eax
+  80135c:	89 df                	mov    %ebx,%edi
+  80135e:	89 de                	mov    %ebx,%esi
+  801360:	cd 30                	int    $0x30
+  801362:	85 c0                	test   %eax,%eax
+  801364:	7f 08                	jg     80136e <sys_get_mac+0x2b>
+  801366:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801369:	5b                   	pop    %ebx
+  80136a:	5e                   	pop    %esi
+  80136b:	5f                   	pop    %edi
+  80136c:	5d                   	pop    %ebp
+  80136d:	c3                   	ret
+  80136e:	83 ec 0c             	sub    $0xc,%esp
+  801371:	50                   	push   %eax
+  801372:	6a 15                	push   $0x15
+  801374:	68 4b 37 80 00       	push   $0x80374b
+  801379:	6a 24                	push   $0x24
+  80137b:	68 68 37 80 00       	push   $0x803768
+  801380:	e8 75 ee ff ff       	call   8001fa <_panic>
+
+00801385 <sys_env_lease>:
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	57                   	push   %edi
+  801389:	56                   	push   %esi
+  80138a:	53                   	push   %ebx
+  80138b:	83 ec 0c             	sub    $0xc,%esp
+  80138e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801393:	8b 55 08             	mov    0x8(%ebp),%edx
+  801396:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801399:	b8 16 00 00 00       	mov    $0x16,%eax
+  80139e:	89 df                	mov    %ebx,%edi
+  8013a0:	89 de                	mov    %ebx,%esi
+  8013a2:	cd 30                	int    $0x30
+  8013a4:	85 c0                	test   %eax,%eax
+  8013a6:	7f 08                	jg     8013b0 <sys_env_lease+0x2b>
+  8013a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ab:	5b                   	pop    %ebx
+  8013ac:	5e                   	pop    %esi
+  8013ad:	5f                   	pop    %edi
+  8013ae:	5d                   	pop    %ebp
+  8013af:	c3                   	ret
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	50                   	push   %eax
+  8013b4:	6a 16                	push   $0x16
+  8013b6:	68 4b 37 80 00       	push   $0x80374b
+  8013bb:	6a 24                	push   $0x24
+  8013bd:	68 68 37 80 00       	push   $0x803768
+  8013c2:	e8 33 ee ff ff       	call   8001fa <_panic>
+
+008013c7 <sys_copy_mem>:
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	57                   	push   %edi
+  8013cb:	56                   	push   %esi
+  8013cc:	53                   	push   %ebx
+  8013cd:	83 ec 0c             	sub    $0xc,%esp
+  8013d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013e1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013e4:	cd 30                	int    $0x30
+  8013e6:	85 c0                	test   %eax,%eax
+  8013e8:	7f 08                	jg     8013f2 <sys_copy_mem+0x2b>
+  8013ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ed:	5b                   	pop    %ebx
+  8013ee:	5e                   	pop    %esi
+  8013ef:	5f                   	pop    %edi
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+  8013f2:	83 ec 0c             	sub    $0xc,%esp
+  8013f5:	50                   	push   %eax
+  8013f6:	6a 17                	push   $0x17
+  8013f8:	68 4b 37 80 00       	push   $0x80374b
+  8013fd:	6a 24                	push   $0x24
+  8013ff:	68 68 37 80 00       	push   $0x803768
+  801404:	e8 f1 ed ff ff       	call   8001fa <_panic>
+
+00801409 <sys_get_perms>:
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	57                   	push   %edi
+  80140d:	56                   	push   %esi
+  80140e:	53                   	push   %ebx
+  80140f:	83 ec 0c             	sub    $0xc,%esp
+  801412:	be 00 00 00 00       	mov    $0x0,%esi
+  801417:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801422:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801425:	89 f7                	mov    %esi,%edi
+  801427:	cd 30                	int    $0x30
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	7f 08                	jg     801435 <sys_get_perms+0x2c>
+  80142d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5f                   	pop    %edi
+  801433:	5d                   	pop    %ebp
+  801434:	c3                   	ret
+  801435:	83 ec 0c             	sub    $0xc,%esp
+  801438:	50                   	push   %eax
+  801439:	6a 18                	push   $0x18
+  80143b:	68 4b 37 80 00       	push   $0x80374b
+  801440:	6a 24                	push   $0x24
+  801442:	68 68 37 80 00       	push   $0x803768
+  801447:	e8 ae ed ff ff       	call   8001fa <_panic>
+
+0080144c <sys_env_unsuspend>:
+  80144c:	55                   	push   %ebp
+  80144d:	89 e5                	mov    %esp,%ebp
+  80144f:	57                   	push   %edi
+  801450:	56                   	push   %esi
+  801451:	53                   	push   %ebx
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+  80145a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801460:	b8 19 00 00 00       	mov    $0x19,%eax
+  801465:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801468:	89 f7                	mov    %esi,%edi
+  80146a:	cd 30                	int    $0x30
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	7f 08                	jg     801478 <sys_env_unsuspend+0x2c>
+  801470:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801473:	5b                   	pop    %ebx
+  801474:	5e                   	pop    %esi
+  801475:	5f                   	pop    %edi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+  801478:	83 ec 0c             	sub    $0xc,%esp
+  80147b:	50                   	push   %eax
+  80147c:	6a 19                	push   $0x19
+  80147e:	68 4b 37 80 00       	push   $0x80374b
+  801483:	6a 24                	push   $0x24
+  801485:	68 68 37 80 00       	push   $0x803768
+  80148a:	e8 6b ed ff ff       	call   8001fa <_panic>
+
+0080148f <sys_migrate>:
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	57                   	push   %edi
+  801493:	56                   	push   %esi
+  801494:	53                   	push   %ebx
+  801495:	83 ec 0c             	sub    $0xc,%esp
+  801498:	ba 00 80 80 00       	mov    $0x808000,%edx
+  80149d:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8014a3:	76 11                	jbe    8014b6 <sys_migrate+0x27>
+  8014a5:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8014aa:	0f b6 08             	movzbl (%eax),%ecx
+  8014ad:	05 00 10 00 00       	add    $0x1000,%eax
+  8014b2:	39 d0                	cmp    %edx,%eax
+  8014b4:	72 f4                	jb     8014aa <sys_migrate+0x1b>
+  8014b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014be:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014c3:	89 cb                	mov    %ecx,%ebx
+  8014c5:	89 cf                	mov    %ecx,%edi
+  8014c7:	89 ce                	mov    %ecx,%esi
+  8014c9:	cd 30                	int    $0x30
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	7f 08                	jg     8014d7 <sys_migrate+0x48>
+  8014cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d2:	5b                   	pop    %ebx
+  8014d3:	5e                   	pop    %esi
+  8014d4:	5f                   	pop    %edi
+  8014d5:	5d                   	pop    %ebp
+  8014d6:	c3                   	ret
+  8014d7:	83 ec 0c             	sub    $0xc,%esp
+  8014da:	50                   	push   %eax
+  8014db:	6a 1a                	push   $0x1a
+  8014dd:	68 4b 37 80 00       	push   $0x80374b
+  8014e2:	6a 24                	push   $0x24
+  8014e4:	68 68 37 80 00       	push   $0x803768
+  8014e9:	e8 0c ed ff ff       	call   8001fa <_panic>
+
+008014ee <sys_lease_complete>:
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	57                   	push   %edi
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 ec 0c             	sub    $0xc,%esp
+  8014f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014fc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801501:	89 d1                	mov    %edx,%ecx
+  801503:	89 d3                	mov    %edx,%ebx
+  801505:	89 d7                	mov    %edx,%edi
+  801507:	89 d6                	mov    %edx,%esi
+  801509:	cd 30                	int    $0x30
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	7f 08                	jg     801517 <sys_lease_complete+0x29>
+  80150f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801512:	5b                   	pop    %ebx
+  801513:	5e                   	pop    %esi
+  801514:	5f                   	pop    %edi
+  801515:	5d                   	pop    %ebp
+  801516:	c3                   	ret
+  801517:	83 ec 0c             	sub    $0xc,%esp
+  80151a:	50                   	push   %eax
+  80151b:	6a 1b                	push   $0x1b
+  80151d:	68 4b 37 80 00       	push   $0x80374b
+  801522:	6a 24                	push   $0x24
+  801524:	68 68 37 80 00       	push   $0x803768
+  801529:	e8 cc ec ff ff       	call   8001fa <_panic>
+
+0080152e <sys_env_set_thisenv>:
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	57                   	push   %edi
+  801532:	56                   	push   %esi
+  801533:	53                   	push   %ebx
+  801534:	83 ec 0c             	sub    $0xc,%esp
+  801537:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801542:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801547:	89 df                	mov    %ebx,%edi
+  801549:	89 de                	mov    %ebx,%esi
+  80154b:	cd 30                	int    $0x30
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	7f 08                	jg     801559 <sys_env_set_thisenv+0x2b>
+  801551:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801554:	5b                   	pop    %ebx
+  801555:	5e                   	pop    %esi
+  801556:	5f                   	pop    %edi
+  801557:	5d                   	pop    %ebp
+  801558:	c3                   	ret
+  801559:	83 ec 0c             	sub    $0xc,%esp
+  80155c:	50                   	push   %eax
+  80155d:	6a 1c                	push   $0x1c
+  80155f:	68 4b 37 80 00       	push   $0x80374b
+  801564:	6a 24                	push   $0x24
+  801566:	68 68 37 80 00       	push   $0x803768
+  80156b:	e8 8a ec ff ff       	call   8001fa <_panic>
+
+00801570 <sys_env_set_sched>:
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	57                   	push   %edi
+  801574:	56                   	push   %esi
+  801575:	53                   	push   %ebx
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	be 00 00 00 00       	mov    $0x0,%esi
+  80157e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801581:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801584:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801589:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158c:	89 f7                	mov    %esi,%edi
+  80158e:	cd 30                	int    $0x30
+  801590:	85 c0                	test   %eax,%eax
+  801592:	7f 08                	jg     80159c <sys_env_set_sched+0x2c>
+  801594:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801597:	5b                   	pop    %ebx
+  801598:	5e                   	pop    %esi
+  801599:	5f                   	pop    %edi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+  80159c:	83 ec 0c             	sub    $0xc,%esp
+  80159f:	50                   	push   %eax
+  8015a0:	6a 1d                	push   $0x1d
+  8015a2:	68 4b 37 80 00       	push   $0x80374b
+  8015a7:	6a 24                	push   $0x24
+  8015a9:	68 68 37 80 00       	push   $0x803768
+  8015ae:	e8 47 ec ff ff       	call   8001fa <_panic>
+
+008015b3 <sys_batch>:
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	57                   	push   %edi
+  8015b7:	56                   	push   %esi
+  8015b8:	53                   	push   %ebx
+  8015b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8015c9:	89 df                	mov    %ebx,%edi
+  8015cb:	89 de                	mov    %ebx,%esi
+  8015cd:	cd 30                	int    $0x30
+  8015cf:	5b                   	pop    %ebx
+  8015d0:	5e                   	pop    %esi
+  8015d1:	5f                   	pop    %edi
+  8015d2:	5d                   	pop    %ebp
+  8015d3:	c3                   	ret
+
+008015d4 <sys_env_stats>:
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	57                   	push   %edi
+  8015d8:	56                   	push   %esi
+  8015d9:	53                   	push   %ebx
+  8015da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e5:	b8 23 00 00 00       	mov    $0x23,%eax
+  8015ea:	89 df                	mov    %ebx,%edi
+  8015ec:	89 de                	mov    %ebx,%esi
+  8015ee:	cd 30                	int    $0x30
+  8015f0:	5b                   	pop    %ebx
+  8015f1:	5e                   	pop    %esi
+  8015f2:	5f                   	pop    %edi
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+
+008015f5 <sys_trace>:
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	57                   	push   %edi
+  8015f9:	56                   	push   %esi
+  8015fa:	53                   	push   %ebx
+  8015fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801600:	8b 55 08             	mov    0x8(%ebp),%edx
+  801603:	b8 24 00 00 00       	mov    $0x24,%eax
+  801608:	89 cb                	mov    %ecx,%ebx
+  80160a:	89 cf                	mov    %ecx,%edi
+  80160c:	89 ce                	mov    %ecx,%esi
+  80160e:	cd 30                	int    $0x30
+  801610:	5b                   	pop    %ebx
+  801611:	5e                   	pop    %esi
+  801612:	5f                   	pop    %edi
+  801613:	5d                   	pop    %ebp
+  801614:	c3                   	ret
+
+00801615 <sys_env_set_pager>:
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	57                   	push   %edi
+  801619:	56                   	push   %esi
+  80161a:	53                   	push   %ebx
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+  80161e:	be 00 00 00 00       	mov    $0x0,%esi
+  801623:	8b 55 08             	mov    0x8(%ebp),%edx
+  801626:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801629:	b8 25 00 00 00       	mov    $0x25,%eax
+  80162e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801631:	89 f7                	mov    %esi,%edi
+  801633:	cd 30                	int    $0x30
+  801635:	85 c0                	test   %eax,%eax
+  801637:	7f 08                	jg     801641 <sys_env_set_pager+0x2c>
+  801639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163c:	5b                   	pop    %ebx
+  80163d:	5e                   	pop    %esi
+  80163e:	5f                   	pop    %edi
+  80163f:	5d                   	pop    %ebp
+  801640:	c3                   	ret
+  801641:	83 ec 0c             	sub    $0xc,%esp
+  801644:	50                   	push   %eax
+  801645:	6a 25                	push   $0x25
+  801647:	68 4b 37 80 00       	push   $0x80374b
+  80164c:	6a 24                	push   $0x24
+  80164e:	68 68 37 80 00       	push   $0x803768
+  801653:	e8 a2 eb ff ff       	call   8001fa <_panic>
+
+00801658 <sys_pager_retire>:
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	57                   	push   %edi
+  80165c:	56                   	push   %esi
+  80165d:	53                   	push   %ebx
+  80165e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801663:	8b 55 08             	mov    0x8(%ebp),%edx
+  801666:	b8 28 00 00 00       	mov    $0x28,%eax
+  80166b:	89 cb                	mov    %ecx,%ebx
+  80166d:	89 cf                	mov    %ecx,%edi
+  80166f:	89 ce                	mov    %ecx,%esi
+  801671:	cd 30                	int    $0x30
+  801673:	5b                   	pop    %ebx
+  801674:	5e                   	pop    %esi
+  801675:	5f                   	pop    %edi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+
+00801678 <sys_prof>:
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  80167b:	57                   	push   %edi
+  80167c:	56                   	push   %esi
+  80167d:	53                   	push   %ebx
+  80167e:	be 00 00 00 00       	mov    $0x0,%esi
+  801683:	8b 55 08             	mov    0x8(%ebp),%edx
+  801686:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801689:	b8 22 00 00 00       	mov    $0x22,%eax
+  80168e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801691:	89 f7                	mov    %esi,%edi
+  801693:	cd 30                	int    $0x30
+  801695:	5b                   	pop    %ebx
+  801696:	5e                   	pop    %esi
+  801697:	5f                   	pop    %edi
+  801698:	5d                   	pop    %ebp
+  801699:	c3                   	ret
+
+0080169a <fd2num>:
+  80169a:	55                   	push   %ebp
+  80169b:	89 e5                	mov    %esp,%ebp
+  80169d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016a0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016a5:	c1 e8 0c             	shr    $0xc,%eax
+  8016a8:	5d                   	pop    %ebp
+  8016a9:	c3                   	ret
+
+008016aa <fd2data>:
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016b0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016b5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016ba:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8016bf:	5d                   	pop    %ebp
+  8016c0:	c3                   	ret
+
+008016c1 <fd_alloc>:
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016c9:	89 c2                	mov    %eax,%edx
+  8016cb:	c1 ea 16             	shr    $0x16,%edx
+  8016ce:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016d5:	f6 c2 01             	test   $0x1,%dl
+  8016d8:	74 29                	je     801703 <fd_alloc+0x42>
+  8016da:	89 c2                	mov    %eax,%edx
+  8016dc:	c1 ea 0c             	shr    $0xc,%edx
+  8016df:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016e6:	f6 c2 01             	test   $0x1,%dl
+  8016e9:	74 18                	je     801703 <fd_alloc+0x42>
+  8016eb:	05 00 10 00 00       	add    $0x1000,%eax
+  8016f0:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8016f5:	75 d2                	jne    8016c9 <fd_alloc+0x8>
+  8016f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801701:	eb 05                	jmp    801708 <fd_alloc+0x47>
+  801703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801708:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170b:	89 02                	mov    %eax,(%edx)
+  80170d:	89 c8                	mov    %ecx,%eax
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+
+00801711 <fd_lookup>:
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	8b 45 08             	mov    0x8(%ebp),%eax
+  801717:	83 f8 1f             	cmp    $0x1f,%eax
+  80171a:	77 30                	ja     80174c <fd_lookup+0x3b>
+  80171c:	c1 e0 0c             	shl    $0xc,%eax
+  80171f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801724:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80172a:	f6 c2 01             	test   $0x1,%dl
+  80172d:	74 24                	je     801753 <fd_lookup+0x42>
+  80172f:	89 c2                	mov    %eax,%edx
+  801731:	c1 ea 0c             	shr    $0xc,%edx
+  801734:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80173b:	f6 c2 01             	test   $0x1,%dl
+  80173e:	74 1a                	je     80175a <fd_lookup+0x49>
+  801740:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801743:	89 02                	mov    %eax,(%edx)
+  801745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174a:	5d                   	pop    %ebp
+  80174b:	c3                   	ret
+  80174c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801751:	eb f7                	jmp    80174a <fd_lookup+0x39>
+  801753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801758:	eb f0                	jmp    80174a <fd_lookup+0x39>
+  80175a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80175f:	eb e9                	jmp    80174a <fd_lookup+0x39>
+
+00801761 <dev_lookup>:
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	53                   	push   %ebx
+  801765:	83 ec 04             	sub    $0x4,%esp
+  801768:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801770:	bb 08 40 80 00       	mov    $0x804008,%ebx
+  801775:	39 13                	cmp    %edx,(%ebx)
+  801777:	74 37                	je     8017b0 <dev_lookup+0x4f>
+  801779:	83 c0 01             	add    $0x1,%eax
+  80177c:	8b 1c 85 f4 37 80 00 	mov    0x8037f4(,%eax,4),%ebx
+  801783:	85 db                	test   %ebx,%ebx
+  801785:	75 ee                	jne    801775 <dev_lookup+0x14>
+  801787:	a1 14 50 80 00       	mov    0x805014,%eax
+  80178c:	8b 40 48             	mov    0x48(%eax),%eax
+  80178f:	83 ec 04             	sub    $0x4,%esp
+  801792:	52                   	push   %edx
+  801793:	50                   	push   %eax
+  801794:	68 78 37 80 00       	push   $0x803778
+  801799:	e8 37 eb ff ff       	call   8002d5 <cprintf>
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017a9:	89 1a                	mov    %ebx,(%edx)
+  8017ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ae:	c9                   	leave
+  8017af:	c3                   	ret
+  8017b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b5:	eb ef                	jmp    8017a6 <dev_lookup+0x45>
+
+008017b7 <fd_close>:
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	57                   	push   %edi
+  8017bb:	56                   	push   %esi
+  8017bc:	53                   	push   %ebx
+  8017bd:	83 ec 24             	sub    $0x24,%esp
+  8017c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017c3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8017c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017c9:	50                   	push   %eax
+  8017ca:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017d0:	c1 e8 0c             	shr    $0xc,%eax
+  8017d3:	50                   	push   %eax
+  8017d4:	e8 38 ff ff ff       	call   801711 <fd_lookup>
+  8017d9:	89 c3                	mov    %eax,%ebx
+  8017db:	83 c4 10             	add    $0x10,%esp
+  8017de:	85 c0                	test   %eax,%eax
+  8017e0:	78 05                	js     8017e7 <fd_close+0x30>
+  8017e2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017e5:	74 0f                	je     8017f6 <fd_close+0x3f>
+  8017e7:	85 ff                	test   %edi,%edi
+  8017e9:	0f 44 df             	cmove  %edi,%ebx
+  8017ec:	89 d8                	mov    %ebx,%eax
+  8017ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f1:	5b                   	pop    %ebx
+  8017f2:	5e                   	pop    %esi
+  8017f3:	5f                   	pop    %edi
+  8017f4:	5d                   	pop    %ebp
+  8017f5:	c3                   	ret
+  8017f6:	83 ec 08             	sub    $0x8,%esp
+  8017f9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017fc:	50                   	push   %eax
+  8017fd:	ff 36                	push   (%esi)
+  8017ff:	e8 5d ff ff ff       	call   801761 <dev_lookup>
+  801804:	89 c3                	mov    %eax,%ebx
+  801806:	83 c4 10             	add    $0x10,%esp
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	78 1a                	js     801827 <fd_close+0x70>
+  80180d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801810:	8b 40 10             	mov    0x10(%eax),%eax
+  801813:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	74 0b                	je     801827 <fd_close+0x70>
+  80181c:	83 ec 0c             	sub    $0xc,%esp
+  80181f:	56                   	push   %esi
+  801820:	ff d0                	call   *%eax
+  801822:	89 c3                	mov    %eax,%ebx
+  801824:	83 c4 10             	add    $0x10,%esp
+  801827:	83 ec 08             	sub    $0x8,%esp
+  80182a:	56                   	push   %esi
+  80182b:	6a 00                	push   $0x0
+  80182d:	e8 cc f6 ff ff       	call   800efe <sys_page_unmap>
+  801832:	83 c4 10             	add    $0x10,%esp
+  801835:	eb b5                	jmp    8017ec <fd_close+0x35>
+
+00801837 <close>:
+  801837:	55                   	push   %ebp
+  801838:	89 e5                	mov    %esp,%ebp
+  80183a:	83 ec 20             	sub    $0x20,%esp
+  80183d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801840:	50                   	push   %eax
+  801841:	ff 75 08             	push   0x8(%ebp)
+  801844:	e8 c8 fe ff ff       	call   801711 <fd_lookup>
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	85 c0                	test   %eax,%eax
+  80184e:	79 02                	jns    801852 <close+0x1b>
+  801850:	c9                   	leave
+  801851:	c3                   	ret
+  801852:	83 ec 08             	sub    $0x8,%esp
+  801855:	6a 01                	push   $0x1
+  801857:	ff 75 f4             	push   -0xc(%ebp)
+  80185a:	e8 58 ff ff ff       	call   8017b7 <fd_close>
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	eb ec                	jmp    801850 <close+0x19>
+
+00801864 <close_all>:
+  801864:	55                   	push   %ebp
+  801865:	89 e5                	mov    %esp,%ebp
+  801867:	53                   	push   %ebx
+  801868:	83 ec 04             	sub    $0x4,%esp
+  80186b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801870:	83 ec 0c             	sub    $0xc,%esp
+  801873:	53                   	push   %ebx
+  801874:	e8 be ff ff ff       	call   801837 <close>
+  801879:	83 c3 01             	add    $0x1,%ebx
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	83 fb 20             	cmp    $0x20,%ebx
+  801882:	75 ec                	jne    801870 <close_all+0xc>
+  801884:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+
+00801889 <dup>:
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+  80188c:	57                   	push   %edi
+  80188d:	56                   	push   %esi
+  80188e:	53                   	push   %ebx
+  80188f:	83 ec 34             	sub    $0x34,%esp
+  801892:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801895:	50                   	push   %eax
+  801896:	ff 75 08             	push   0x8(%ebp)
+  801899:	e8 73 fe ff ff       	call   801711 <fd_lookup>
+  80189e:	89 c3                	mov    %eax,%ebx
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	85 c0                	test   %eax,%eax
+  8018a5:	78 7f                	js     801926 <dup+0x9d>
+  8018a7:	83 ec 0c             	sub    $0xc,%esp
+  8018aa:	ff 75 0c             	push   0xc(%ebp)
+  8018ad:	e8 85 ff ff ff       	call   801837 <close>
+  8018b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018b5:	c1 e6 0c             	shl    $0xc,%esi
+  8018b8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8018be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018c1:	89 3c 24             	mov    %edi,(%esp)
+  8018c4:	e8 e1 fd ff ff       	call   8016aa <fd2data>
+  8018c9:	89 c3                	mov    %eax,%ebx
+  8018cb:	89 34 24             	mov    %esi,(%esp)
+  8018ce:	e8 d7 fd ff ff       	call   8016aa <fd2data>
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8018d9:	89 d8                	mov    %ebx,%eax
+  8018db:	c1 e8 16             	shr    $0x16,%eax
+  8018de:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018e5:	a8 01                	test   $0x1,%al
+  8018e7:	74 11                	je     8018fa <dup+0x71>
+  8018e9:	89 d8                	mov    %ebx,%eax
+  8018eb:	c1 e8 0c             	shr    $0xc,%eax
+  8018ee:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018f5:	f6 c2 01             	test   $0x1,%dl
+  8018f8:	75 36                	jne    801930 <dup+0xa7>
+  8018fa:	89 f8                	mov    %edi,%eax
+  8018fc:	c1 e8 0c             	shr    $0xc,%eax
+  8018ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801906:	83 ec 0c             	sub    $0xc,%esp
+  801909:	25 07 0e 00 00       	and    $0xe07,%eax
+  80190e:	50                   	push   %eax
+  80190f:	56                   	push   %esi
+  801910:	6a 00                	push   $0x0
+  801912:	57                   	push   %edi
+  801913:	6a 00                	push   $0x0
+  801915:	e8 55 f5 ff ff       	call   800e6f <sys_page_map>
+  80191a:	89 c3                	mov    %eax,%ebx
+  80191c:	83 c4 20             	add    $0x20,%esp
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	78 33                	js     801956 <dup+0xcd>
+  801923:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801926:	89 d8                	mov    %ebx,%eax
+  801928:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192b:	5b                   	pop    %ebx
+  80192c:	5e                   	pop    %esi
+  80192d:	5f                   	pop    %edi
+  80192e:	5d                   	pop    %ebp
+  80192f:	c3                   	ret
+  801930:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801937:	83 ec 0c             	sub    $0xc,%esp
+  80193a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80193f:	50                   	push   %eax
+  801940:	ff 75 d4             	push   -0x2c(%ebp)
+  801943:	6a 00                	push   $0x0
+  801945:	53                   	push   %ebx
+  801946:	6a 00                	push   $0x0
+  801948:	e8 22 f5 ff ff       	call   800e6f <sys_page_map>
+  80194d:	89 c3                	mov    %eax,%ebx
+  80194f:	83 c4 20             	add    $0x20,%esp
+  801952:	85 c0                	test   %eax,%eax
+  801954:	79 a4                	jns    8018fa <dup+0x71>
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	56                   	push   %esi
+  80195a:	6a 00                	push   $0x0
+  80195c:	e8 9d f5 ff ff       	call   800efe <sys_page_unmap>
+  801961:	83 c4 08             	add    $0x8,%esp
+  801964:	ff 75 d4             	push   -0x2c(%ebp)
+  801967:	6a 00                	push   $0x0
+  801969:	e8 90 f5 ff ff       	call   800efe <sys_page_unmap>
+  80196e:	83 c4 10             	add    $0x10,%esp
+  801971:	eb b3                	jmp    801926 <dup+0x9d>
+
+00801973 <read>:
+  801973:	55                   	push   %ebp
+  801974:	89 e5                	mov    %esp,%ebp
+  801976:	56                   	push   %esi
+  801977:	53                   	push   %ebx
+  801978:	83 ec 18             	sub    $0x18,%esp
+  80197b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80197e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801981:	50                   	push   %eax
+  801982:	56                   	push   %esi
+  801983:	e8 89 fd ff ff       	call   801711 <fd_lookup>
+  801988:	83 c4 10             	add    $0x10,%esp
+  80198b:	85 c0                	test   %eax,%eax
+  80198d:	78 3c                	js     8019cb <read+0x58>
+  80198f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801992:	83 ec 08             	sub    $0x8,%esp
+  801995:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801998:	50                   	push   %eax
+  801999:	ff 33                	push   (%ebx)
+  80199b:	e8 c1 fd ff ff       	call   801761 <dev_lookup>
+  8019a0:	83 c4 10             	add    $0x10,%esp
+  8019a3:	85 c0                	test   %eax,%eax
+  8019a5:	78 24                	js     8019cb <read+0x58>
+  8019a7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019aa:	83 e0 03             	and    $0x3,%eax
+  8019ad:	83 f8 01             	cmp    $0x1,%eax
+  8019b0:	74 20                	je     8019d2 <read+0x5f>
+  8019b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019b5:	8b 40 08             	mov    0x8(%eax),%eax
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	74 37                	je     8019f3 <read+0x80>
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	ff 75 10             	push   0x10(%ebp)
+  8019c2:	ff 75 0c             	push   0xc(%ebp)
+  8019c5:	53                   	push   %ebx
+  8019c6:	ff d0                	call   *%eax
+  8019c8:	83 c4 10             	add    $0x10,%esp
+  8019cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ce:	5b                   	pop    %ebx
+  8019cf:	5e                   	pop    %esi
+  8019d0:	5d                   	pop    %ebp
+  8019d1:	c3                   	ret
+  8019d2:	a1 14 50 80 00       	mov    0x805014,%eax
+  8019d7:	8b 40 48             	mov    0x48(%eax),%eax
+  8019da:	83 ec 04             	sub    $0x4,%esp
+  8019dd:	56                   	push   %esi
+  8019de:	50                   	push   %eax
+  8019df:	68 b9 37 80 00       	push   $0x8037b9
+  8019e4:	e8 ec e8 ff ff       	call   8002d5 <cprintf>
+  8019e9:	83 c4 10             	add    $0x10,%esp
+  8019ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f1:	eb d8                	jmp    8019cb <read+0x58>
+  8019f3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019f8:	eb d1                	jmp    8019cb <read+0x58>
+
+008019fa <readn>:
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	57                   	push   %edi
+  8019fe:	56                   	push   %esi
+  8019ff:	53                   	push   %ebx
+  801a00:	83 ec 0c             	sub    $0xc,%esp
+  801a03:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a06:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a09:	85 f6                	test   %esi,%esi
+  801a0b:	74 30                	je     801a3d <readn+0x43>
+  801a0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a17:	83 ec 04             	sub    $0x4,%esp
+  801a1a:	89 f2                	mov    %esi,%edx
+  801a1c:	29 c2                	sub    %eax,%edx
+  801a1e:	52                   	push   %edx
+  801a1f:	01 f8                	add    %edi,%eax
+  801a21:	50                   	push   %eax
+  801a22:	ff 75 08             	push   0x8(%ebp)
+  801a25:	e8 49 ff ff ff       	call   801973 <read>
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	78 15                	js     801a46 <readn+0x4c>
+  801a31:	74 11                	je     801a44 <readn+0x4a>
+  801a33:	01 c3                	add    %eax,%ebx
+  801a35:	89 d8                	mov    %ebx,%eax
+  801a37:	39 f3                	cmp    %esi,%ebx
+  801a39:	72 dc                	jb     801a17 <readn+0x1d>
+  801a3b:	eb 09                	jmp    801a46 <readn+0x4c>
+  801a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a42:	eb 02                	jmp    801a46 <readn+0x4c>
+  801a44:	89 d8                	mov    %ebx,%eax
+  801a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a49:	5b                   	pop    %ebx
+  801a4a:	5e                   	pop    %esi
+  801a4b:	5f                   	pop    %edi
+  801a4c:	5d                   	pop    %ebp
+  801a4d:	c3                   	ret
+
+00801a4e <write>:
+  801a4e:	55                   	push   %ebp
+  801a4f:	89 e5                	mov    %esp,%ebp
+  801a51:	56                   	push   %esi
+  801a52:	53                   	push   %ebx
+  801a53:	83 ec 18             	sub    $0x18,%esp
+  801a56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a5c:	50                   	push   %eax
+  801a5d:	53                   	push   %ebx
+  801a5e:	e8 ae fc ff ff       	call   801711 <fd_lookup>
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 37                	js     801aa1 <write+0x53>
+  801a6a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a6d:	83 ec 08             	sub    $0x8,%esp
+  801a70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a73:	50                   	push   %eax
+  801a74:	ff 36                	push   (%esi)
+  801a76:	e8 e6 fc ff ff       	call   801761 <dev_lookup>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	78 1f                	js     801aa1 <write+0x53>
+  801a82:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a86:	74 20                	je     801aa8 <write+0x5a>
+  801a88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a8e:	85 c0                	test   %eax,%eax
+  801a90:	74 37                	je     801ac9 <write+0x7b>
+  801a92:	83 ec 04             	sub    $0x4,%esp
+  801a95:	ff 75 10             	push   0x10(%ebp)
+  801a98:	ff 75 0c             	push   0xc(%ebp)
+  801a9b:	56                   	push   %esi
+  801a9c:	ff d0                	call   *%eax
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5d                   	pop    %ebp
+  801aa7:	c3                   	ret
+  801aa8:	a1 14 50 80 00       	mov    0x805014,%eax
+  801aad:	8b 40 48             	mov    0x48(%eax),%eax
+  801ab0:	83 ec 04             	sub    $0x4,%esp
+  801ab3:	53                   	push   %ebx
+  801ab4:	50                   	push   %eax
+  801ab5:	68 d5 37 80 00       	push   $0x8037d5
+  801aba:	e8 16 e8 ff ff       	call   8002d5 <cprintf>
+  801abf:	83 c4 10             	add    $0x10,%esp
+  801ac2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac7:	eb d8                	jmp    801aa1 <write+0x53>
+  801ac9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ace:	eb d1                	jmp    801aa1 <write+0x53>
+
+00801ad0 <seek>:
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	83 ec 20             	sub    $0x20,%esp
+  801ad6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad9:	50                   	push   %eax
+  801ada:	ff 75 08             	push   0x8(%ebp)
+  801add:	e8 2f fc ff ff       	call   801711 <fd_lookup>
+  801ae2:	83 c4 10             	add    $0x10,%esp
+  801ae5:	85 c0                	test   %eax,%eax
+  801ae7:	78 0e                	js     801af7 <seek+0x27>
+  801ae9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aef:	89 50 04             	mov    %edx,0x4(%eax)
+  801af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af7:	c9                   	leave
+  801af8:	c3                   	ret
+
+00801af9 <ftruncate>:
+  801af9:	55                   	push   %ebp
+  801afa:	89 e5                	mov    %esp,%ebp
+  801afc:	56                   	push   %esi
+  801afd:	53                   	push   %ebx
+  801afe:	83 ec 18             	sub    $0x18,%esp
+  801b01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b04:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b07:	50                   	push   %eax
+  801b08:	53                   	push   %ebx
+  801b09:	e8 03 fc ff ff       	call   801711 <fd_lookup>
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 34                	js     801b49 <ftruncate+0x50>
+  801b15:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b18:	83 ec 08             	sub    $0x8,%esp
+  801b1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b1e:	50                   	push   %eax
+  801b1f:	ff 36                	push   (%esi)
+  801b21:	e8 3b fc ff ff       	call   801761 <dev_lookup>
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 1c                	js     801b49 <ftruncate+0x50>
+  801b2d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b31:	74 1d                	je     801b50 <ftruncate+0x57>
+  801b33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b36:	8b 40 18             	mov    0x18(%eax),%eax
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	74 34                	je     801b71 <ftruncate+0x78>
+  801b3d:	83 ec 08             	sub    $0x8,%esp
+  801b40:	ff 75 0c             	push   0xc(%ebp)
+  801b43:	56                   	push   %esi
+  801b44:	ff d0                	call   *%eax
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b4c:	5b                   	pop    %ebx
+  801b4d:	5e                   	pop    %esi
+  801b4e:	5d                   	pop    %ebp
+  801b4f:	c3                   	ret
+  801b50:	a1 14 50 80 00       	mov    0x805014,%eax
+  801b55:	8b 40 48             	mov    0x48(%eax),%eax
+  801b58:	83 ec 04             	sub    $0x4,%esp
+  801b5b:	53                   	push   %ebx
+  801b5c:	50                   	push   %eax
+  801b5d:	68 98 37 80 00       	push   $0x803798
+  801b62:	e8 6e e7 ff ff       	call   8002d5 <cprintf>
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b6f:	eb d8                	jmp    801b49 <ftruncate+0x50>
+  801b71:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b76:	eb d1                	jmp    801b49 <ftruncate+0x50>
+
+00801b78 <fstat>:
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	56                   	push   %esi
+  801b7c:	53                   	push   %ebx
+  801b7d:	83 ec 18             	sub    $0x18,%esp
+  801b80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b86:	50                   	push   %eax
+  801b87:	ff 75 08             	push   0x8(%ebp)
+  801b8a:	e8 82 fb ff ff       	call   801711 <fd_lookup>
+  801b8f:	83 c4 10             	add    $0x10,%esp
+  801b92:	85 c0                	test   %eax,%eax
+  801b94:	78 49                	js     801bdf <fstat+0x67>
+  801b96:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b99:	83 ec 08             	sub    $0x8,%esp
+  801b9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b9f:	50                   	push   %eax
+  801ba0:	ff 36                	push   (%esi)
+  801ba2:	e8 ba fb ff ff       	call   801761 <dev_lookup>
+  801ba7:	83 c4 10             	add    $0x10,%esp
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	78 31                	js     801bdf <fstat+0x67>
+  801bae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bb1:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bb5:	74 2f                	je     801be6 <fstat+0x6e>
+  801bb7:	c6 03 00             	movb   $0x0,(%ebx)
+  801bba:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bc1:	00 00 00 
+  801bc4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bcb:	00 00 00 
+  801bce:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801bd4:	83 ec 08             	sub    $0x8,%esp
+  801bd7:	53                   	push   %ebx
+  801bd8:	56                   	push   %esi
+  801bd9:	ff 50 14             	call   *0x14(%eax)
+  801bdc:	83 c4 10             	add    $0x10,%esp
+  801bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be2:	5b                   	pop    %ebx
+  801be3:	5e                   	pop    %esi
+  801be4:	5d                   	pop    %ebp
+  801be5:	c3                   	ret
+  801be6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801beb:	eb f2                	jmp    801bdf <fstat+0x67>
+
+00801bed <stat>:
+  801bed:	55                   	push   %ebp
+  801bee:	89 e5                	mov    %esp,%ebp
+  801bf0:	56                   	push   %esi
+  801bf1:	53                   	push   %ebx
+  801bf2:	83 ec 08             	sub    $0x8,%esp
+  801bf5:	6a 00                	push   $0x0
+  801bf7:	ff 75 08             	push   0x8(%ebp)
+  801bfa:	e8 31 05 00 00       	call   802130 <open>
+  801bff:	89 c3                	mov    %eax,%ebx
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	78 1b                	js     801c23 <stat+0x36>
+  801c08:	83 ec 08             	sub    $0x8,%esp
+  801c0b:	ff 75 0c             	push   0xc(%ebp)
+  801c0e:	50                   	push   %eax
+  801c0f:	e8 64 ff ff ff       	call   801b78 <fstat>
+  801c14:	89 c6                	mov    %eax,%esi
+  801c16:	89 1c 24             	mov    %ebx,(%esp)
+  801c19:	e8 19 fc ff ff       	call   801837 <close>
+  801c1e:	83 c4 10             	add    $0x10,%esp
+  801c21:	89 f3                	mov    %esi,%ebx
+  801c23:	89 d8                	mov    %ebx,%eax
+  801c25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c28:	5b                   	pop    %ebx
+  801c29:	5e                   	pop    %esi
+  801c2a:	5d                   	pop    %ebp
+  801c2b:	c3                   	ret
+
+00801c2c <fsipc>:
+  801c2c:	55                   	push   %ebp
+  801c2d:	89 e5                	mov    %esp,%ebp
+  801c2f:	56                   	push   %esi
+  801c30:	53                   	push   %ebx
+  801c31:	89 c3                	mov    %eax,%ebx
+  801c33:	89 d6                	mov    %edx,%esi
+  801c35:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801c3c:	74 20                	je     801c5e <fsipc+0x32>
+  801c3e:	83 ec 08             	sub    $0x8,%esp
+  801c41:	6a 00                	push   $0x0
+  801c43:	56                   	push   %esi
+  801c44:	6a 07                	push   $0x7
+  801c46:	68 00 60 80 00       	push   $0x806000
+  801c4b:	53                   	push   %ebx
+  801c4c:	ff 35 0c 50 80 00    	push   0x80500c
+  801c52:	e8 6e 13 00 00       	call   802fc5 <ipc_call>
+  801c57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c5a:	5b                   	pop    %ebx
+  801c5b:	5e                   	pop    %esi
+  801c5c:	5d                   	pop    %ebp
+  801c5d:	c3                   	ret
+  801c5e:	83 ec 0c             	sub    $0xc,%esp
+  801c61:	6a 02                	push   $0x2
+  801c63:	e8 f8 14 00 00       	call   803160 <ipc_find_env>
+  801c68:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801c6d:	83 c4 10             	add    $0x10,%esp
+  801c70:	eb cc                	jmp    801c3e <fsipc+0x12>
+
+00801c72 <devfile_trunc>:
+  801c72:	55                   	push   %ebp
+  801c73:	89 e5                	mov    %esp,%ebp
+  801c75:	83 ec 08             	sub    $0x8,%esp
+  801c78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7e:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c86:	a3 04 60 80 00       	mov    %eax,0x806004
+  801c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c90:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c95:	e8 92 ff ff ff       	call   801c2c <fsipc>
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+00801c9c <devfile_flush>:
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ca8:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cad:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb2:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cb7:	e8 70 ff ff ff       	call   801c2c <fsipc>
+  801cbc:	c9                   	leave
+  801cbd:	c3                   	ret
+
+00801cbe <devfile_stat>:
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	53                   	push   %ebx
+  801cc2:	83 ec 04             	sub    $0x4,%esp
+  801cc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ccb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cce:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd8:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cdd:	e8 4a ff ff ff       	call   801c2c <fsipc>
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	78 2c                	js     801d12 <devfile_stat+0x54>
+  801ce6:	83 ec 08             	sub    $0x8,%esp
+  801ce9:	68 00 60 80 00       	push   $0x806000
+  801cee:	53                   	push   %ebx
+  801cef:	e8 d8 ec ff ff       	call   8009cc <strcpy>
+  801cf4:	a1 80 60 80 00       	mov    0x806080,%eax
+  801cf9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801cff:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d04:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801d0a:	83 c4 10             	add    $0x10,%esp
+  801d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d15:	c9                   	leave
+  801d16:	c3                   	ret
+
+00801d17 <fsring_rw>:
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	57                   	push   %edi
+  801d1b:	56                   	push   %esi
+  801d1c:	53                   	push   %ebx
+  801d1d:	83 ec 2c             	sub    $0x2c,%esp
+  801d20:	89 c7                	mov    %eax,%edi
+  801d22:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d25:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801d28:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d2d:	a8 01                	test   $0x1,%al
+  801d2f:	74 0d                	je     801d3e <fsring_rw+0x27>
+  801d31:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d36:	a8 01                	test   $0x1,%al
+  801d38:	0f 85 d5 00 00 00    	jne    801e13 <fsring_rw+0xfc>
+  801d3e:	a1 14 50 80 00       	mov    0x805014,%eax
+  801d43:	8b 40 48             	mov    0x48(%eax),%eax
+  801d46:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  801d4c:	0f 84 fc 00 00 00    	je     801e4e <fsring_rw+0x137>
+  801d52:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801d59:	0f 84 02 01 00 00    	je     801e61 <fsring_rw+0x14a>
+  801d5f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d64:	83 ec 04             	sub    $0x4,%esp
+  801d67:	68 07 02 00 00       	push   $0x207
+  801d6c:	53                   	push   %ebx
+  801d6d:	6a 00                	push   $0x0
+  801d6f:	e8 b8 f0 ff ff       	call   800e2c <sys_page_alloc>
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	0f 88 f9 00 00 00    	js     801e78 <fsring_rw+0x161>
+  801d7f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d85:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d8b:	75 d7                	jne    801d64 <fsring_rw+0x4d>
+  801d8d:	6a 0e                	push   $0xe
+  801d8f:	6a 0d                	push   $0xd
+  801d91:	ff 35 0c 50 80 00    	push   0x80500c
+  801d97:	68 00 00 f0 cf       	push   $0xcff00000
+  801d9c:	e8 d8 0d 00 00       	call   802b79 <ipcring_init>
+  801da1:	83 c4 08             	add    $0x8,%esp
+  801da4:	6a 00                	push   $0x0
+  801da6:	6a 00                	push   $0x0
+  801da8:	68 07 02 00 00       	push   $0x207
+  801dad:	68 00 00 f0 cf       	push   $0xcff00000
+  801db2:	6a 0b                	push   $0xb
+  801db4:	ff 35 0c 50 80 00    	push   0x80500c
+  801dba:	e8 06 12 00 00       	call   802fc5 <ipc_call>
+  801dbf:	89 c6                	mov    %eax,%esi
+  801dc1:	83 c4 20             	add    $0x20,%esp
+  801dc4:	85 c0                	test   %eax,%eax
+  801dc6:	0f 88 ac 00 00 00    	js     801e78 <fsring_rw+0x161>
+  801dcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd1:	89 d9                	mov    %ebx,%ecx
+  801dd3:	83 c3 01             	add    $0x1,%ebx
+  801dd6:	89 da                	mov    %ebx,%edx
+  801dd8:	c1 e2 0c             	shl    $0xc,%edx
+  801ddb:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801de1:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801de7:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801ded:	83 ec 08             	sub    $0x8,%esp
+  801df0:	6a 00                	push   $0x0
+  801df2:	6a 00                	push   $0x0
+  801df4:	68 07 02 00 00       	push   $0x207
+  801df9:	50                   	push   %eax
+  801dfa:	6a 0c                	push   $0xc
+  801dfc:	ff 35 0c 50 80 00    	push   0x80500c
+  801e02:	e8 be 11 00 00       	call   802fc5 <ipc_call>
+  801e07:	83 c4 20             	add    $0x20,%esp
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 6a                	js     801e78 <fsring_rw+0x161>
+  801e0e:	83 fb 08             	cmp    $0x8,%ebx
+  801e11:	75 be                	jne    801dd1 <fsring_rw+0xba>
+  801e13:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e17:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801e1c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801e21:	0f 45 c2             	cmovne %edx,%eax
+  801e24:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e27:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e2e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e35:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e41:	be 00 00 00 00       	mov    $0x0,%esi
+  801e46:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801e49:	e9 4b 01 00 00       	jmp    801f99 <fsring_rw+0x282>
+  801e4e:	e8 a3 f3 ff ff       	call   8011f6 <sys_time_msec>
+  801e53:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801e59:	0f 89 f3 fe ff ff    	jns    801d52 <fsring_rw+0x3b>
+  801e5f:	eb 54                	jmp    801eb5 <fsring_rw+0x19e>
+  801e61:	83 ec 0c             	sub    $0xc,%esp
+  801e64:	6a 02                	push   $0x2
+  801e66:	e8 f5 12 00 00       	call   803160 <ipc_find_env>
+  801e6b:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801e70:	83 c4 10             	add    $0x10,%esp
+  801e73:	e9 e7 fe ff ff       	jmp    801d5f <fsring_rw+0x48>
+  801e78:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e7d:	83 ec 08             	sub    $0x8,%esp
+  801e80:	53                   	push   %ebx
+  801e81:	6a 00                	push   $0x0
+  801e83:	e8 76 f0 ff ff       	call   800efe <sys_page_unmap>
+  801e88:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e97:	75 e4                	jne    801e7d <fsring_rw+0x166>
+  801e99:	e8 58 f3 ff ff       	call   8011f6 <sys_time_msec>
+  801e9e:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801ea3:	a3 04 50 80 00       	mov    %eax,0x805004
+  801ea8:	a1 14 50 80 00       	mov    0x805014,%eax
+  801ead:	8b 40 48             	mov    0x48(%eax),%eax
+  801eb0:	a3 08 50 80 00       	mov    %eax,0x805008
+  801eb5:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801ebc:	e9 7a 01 00 00       	jmp    80203b <fsring_rw+0x324>
+  801ec1:	8b 57 0c             	mov    0xc(%edi),%edx
+  801ec4:	89 10                	mov    %edx,(%eax)
+  801ec6:	89 58 04             	mov    %ebx,0x4(%eax)
+  801ec9:	89 f2                	mov    %esi,%edx
+  801ecb:	03 57 04             	add    0x4(%edi),%edx
+  801ece:	89 50 08             	mov    %edx,0x8(%eax)
+  801ed1:	83 ec 04             	sub    $0x4,%esp
+  801ed4:	53                   	push   %ebx
+  801ed5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801ed8:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801edb:	52                   	push   %edx
+  801edc:	83 c0 0c             	add    $0xc,%eax
+  801edf:	50                   	push   %eax
+  801ee0:	e8 97 ec ff ff       	call   800b7c <memmove>
+  801ee5:	83 c4 10             	add    $0x10,%esp
+  801ee8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801eeb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801eee:	89 08                	mov    %ecx,(%eax)
+  801ef0:	83 ec 0c             	sub    $0xc,%esp
+  801ef3:	68 00 00 f0 cf       	push   $0xcff00000
+  801ef8:	e8 da 0c 00 00       	call   802bd7 <ipcring_req_push>
+  801efd:	01 de                	add    %ebx,%esi
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f05:	73 4c                	jae    801f53 <fsring_rw+0x23c>
+  801f07:	83 ec 0c             	sub    $0xc,%esp
+  801f0a:	68 00 00 f0 cf       	push   $0xcff00000
+  801f0f:	e8 9d 0c 00 00       	call   802bb1 <ipcring_req_slot>
+  801f14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f17:	83 c4 10             	add    $0x10,%esp
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	74 35                	je     801f53 <fsring_rw+0x23c>
+  801f1e:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f23:	83 e0 07             	and    $0x7,%eax
+  801f26:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f2b:	c1 e0 0c             	shl    $0xc,%eax
+  801f2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f31:	29 f3                	sub    %esi,%ebx
+  801f33:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f36:	39 cb                	cmp    %ecx,%ebx
+  801f38:	0f 47 d9             	cmova  %ecx,%ebx
+  801f3b:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f3f:	75 80                	jne    801ec1 <fsring_rw+0x1aa>
+  801f41:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f44:	89 10                	mov    %edx,(%eax)
+  801f46:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f49:	89 f2                	mov    %esi,%edx
+  801f4b:	03 57 04             	add    0x4(%edi),%edx
+  801f4e:	89 50 08             	mov    %edx,0x8(%eax)
+  801f51:	eb 95                	jmp    801ee8 <fsring_rw+0x1d1>
+  801f53:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f5b:	83 ec 0c             	sub    $0xc,%esp
+  801f5e:	68 00 00 f0 cf       	push   $0xcff00000
+  801f63:	e8 a8 0c 00 00       	call   802c10 <ipcring_rsp_wait>
+  801f68:	8b 58 04             	mov    0x4(%eax),%ebx
+  801f6b:	83 c4 10             	add    $0x10,%esp
+  801f6e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f72:	75 45                	jne    801fb9 <fsring_rw+0x2a2>
+  801f74:	85 db                	test   %ebx,%ebx
+  801f76:	79 41                	jns    801fb9 <fsring_rw+0x2a2>
+  801f78:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801f7b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801f82:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801f89:	83 ec 0c             	sub    $0xc,%esp
+  801f8c:	68 00 00 f0 cf       	push   $0xcff00000
+  801f91:	e8 e0 0c 00 00       	call   802c76 <ipcring_rsp_pop>
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801f9f:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801fa4:	39 c2                	cmp    %eax,%edx
+  801fa6:	74 75                	je     80201d <fsring_rw+0x306>
+  801fa8:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801fac:	75 a5                	jne    801f53 <fsring_rw+0x23c>
+  801fae:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801fb1:	0f 82 50 ff ff ff    	jb     801f07 <fsring_rw+0x1f0>
+  801fb7:	eb 9a                	jmp    801f53 <fsring_rw+0x23c>
+  801fb9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801fbd:	75 ca                	jne    801f89 <fsring_rw+0x272>
+  801fbf:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801fc3:	74 31                	je     801ff6 <fsring_rw+0x2df>
+  801fc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc8:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801fcb:	29 c8                	sub    %ecx,%eax
+  801fcd:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801fd0:	39 d0                	cmp    %edx,%eax
+  801fd2:	0f 47 c2             	cmova  %edx,%eax
+  801fd5:	39 d8                	cmp    %ebx,%eax
+  801fd7:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fdc:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801fe0:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801fe3:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fe8:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801fec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801fef:	01 d9                	add    %ebx,%ecx
+  801ff1:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801ff4:	eb 93                	jmp    801f89 <fsring_rw+0x272>
+  801ff6:	83 ec 04             	sub    $0x4,%esp
+  801ff9:	53                   	push   %ebx
+  801ffa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ffd:	83 e0 07             	and    $0x7,%eax
+  802000:	c1 e0 0c             	shl    $0xc,%eax
+  802003:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802009:	50                   	push   %eax
+  80200a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80200d:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802010:	01 c8                	add    %ecx,%eax
+  802012:	50                   	push   %eax
+  802013:	e8 64 eb ff ff       	call   800b7c <memmove>
+  802018:	83 c4 10             	add    $0x10,%esp
+  80201b:	eb a8                	jmp    801fc5 <fsring_rw+0x2ae>
+  80201d:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802021:	75 09                	jne    80202c <fsring_rw+0x315>
+  802023:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802026:	0f 82 db fe ff ff    	jb     801f07 <fsring_rw+0x1f0>
+  80202c:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80202f:	01 57 04             	add    %edx,0x4(%edi)
+  802032:	85 d2                	test   %edx,%edx
+  802034:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802038:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80203b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80203e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802041:	5b                   	pop    %ebx
+  802042:	5e                   	pop    %esi
+  802043:	5f                   	pop    %edi
+  802044:	5d                   	pop    %ebp
+  802045:	c3                   	ret
+
+00802046 <devfile_write>:
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	57                   	push   %edi
+  80204a:	56                   	push   %esi
+  80204b:	53                   	push   %ebx
+  80204c:	83 ec 0c             	sub    $0xc,%esp
+  80204f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802052:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802055:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802058:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80205e:	76 1a                	jbe    80207a <devfile_write+0x34>
+  802060:	83 ec 0c             	sub    $0xc,%esp
+  802063:	53                   	push   %ebx
+  802064:	89 f1                	mov    %esi,%ecx
+  802066:	ba 06 00 00 00       	mov    $0x6,%edx
+  80206b:	89 f8                	mov    %edi,%eax
+  80206d:	e8 a5 fc ff ff       	call   801d17 <fsring_rw>
+  802072:	83 c4 10             	add    $0x10,%esp
+  802075:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802078:	75 39                	jne    8020b3 <devfile_write+0x6d>
+  80207a:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80207f:	39 c3                	cmp    %eax,%ebx
+  802081:	0f 47 d8             	cmova  %eax,%ebx
+  802084:	8b 47 0c             	mov    0xc(%edi),%eax
+  802087:	a3 00 60 80 00       	mov    %eax,0x806000
+  80208c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802092:	83 ec 04             	sub    $0x4,%esp
+  802095:	53                   	push   %ebx
+  802096:	56                   	push   %esi
+  802097:	68 08 60 80 00       	push   $0x806008
+  80209c:	e8 db ea ff ff       	call   800b7c <memmove>
+  8020a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020ab:	e8 7c fb ff ff       	call   801c2c <fsipc>
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b6:	5b                   	pop    %ebx
+  8020b7:	5e                   	pop    %esi
+  8020b8:	5f                   	pop    %edi
+  8020b9:	5d                   	pop    %ebp
+  8020ba:	c3                   	ret
+
+008020bb <devfile_read>:
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	57                   	push   %edi
+  8020bf:	56                   	push   %esi
+  8020c0:	53                   	push   %ebx
+  8020c1:	83 ec 0c             	sub    $0xc,%esp
+  8020c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020c7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020ca:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8020d0:	76 1d                	jbe    8020ef <devfile_read+0x34>
+  8020d2:	83 ec 0c             	sub    $0xc,%esp
+  8020d5:	56                   	push   %esi
+  8020d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020d9:	ba 05 00 00 00       	mov    $0x5,%edx
+  8020de:	89 f8                	mov    %edi,%eax
+  8020e0:	e8 32 fc ff ff       	call   801d17 <fsring_rw>
+  8020e5:	89 c3                	mov    %eax,%ebx
+  8020e7:	83 c4 10             	add    $0x10,%esp
+  8020ea:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020ed:	75 37                	jne    802126 <devfile_read+0x6b>
+  8020ef:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020f2:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020f7:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8020fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802102:	b8 03 00 00 00       	mov    $0x3,%eax
+  802107:	e8 20 fb ff ff       	call   801c2c <fsipc>
+  80210c:	89 c3                	mov    %eax,%ebx
+  80210e:	85 c0                	test   %eax,%eax
+  802110:	78 14                	js     802126 <devfile_read+0x6b>
+  802112:	83 ec 04             	sub    $0x4,%esp
+  802115:	50                   	push   %eax
+  802116:	68 00 60 80 00       	push   $0x806000
+  80211b:	ff 75 0c             	push   0xc(%ebp)
+  80211e:	e8 59 ea ff ff       	call   800b7c <memmove>
+  802123:	83 c4 10             	add    $0x10,%esp
+  802126:	89 d8                	mov    %ebx,%eax
+  802128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212b:	5b                   	pop    %ebx
+  80212c:	5e                   	pop    %esi
+  80212d:	5f                   	pop    %edi
+  80212e:	5d                   	pop    %ebp
+  80212f:	c3                   	ret
+
+00802130 <open>:
+  802130:	55                   	push   %ebp
+  802131:	89 e5                	mov    %esp,%ebp
+  802133:	56                   	push   %esi
+  802134:	53                   	push   %ebx
+  802135:	83 ec 1c             	sub    $0x1c,%esp
+  802138:	8b 75 08             	mov    0x8(%ebp),%esi
+  80213b:	56                   	push   %esi
+  80213c:	e8 3f e8 ff ff       	call   800980 <strlen>
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802149:	7f 6c                	jg     8021b7 <open+0x87>
+  80214b:	83 ec 0c             	sub    $0xc,%esp
+  80214e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802151:	50                   	push   %eax
+  802152:	e8 6a f5 ff ff       	call   8016c1 <fd_alloc>
+  802157:	89 c3                	mov    %eax,%ebx
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	78 3c                	js     80219c <open+0x6c>
+  802160:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802163:	a3 00 64 80 00       	mov    %eax,0x806400
+  802168:	83 ec 08             	sub    $0x8,%esp
+  80216b:	56                   	push   %esi
+  80216c:	68 00 60 80 00       	push   $0x806000
+  802171:	e8 56 e8 ff ff       	call   8009cc <strcpy>
+  802176:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802179:	b8 01 00 00 00       	mov    $0x1,%eax
+  80217e:	e8 a9 fa ff ff       	call   801c2c <fsipc>
+  802183:	89 c3                	mov    %eax,%ebx
+  802185:	83 c4 10             	add    $0x10,%esp
+  802188:	85 c0                	test   %eax,%eax
+  80218a:	78 19                	js     8021a5 <open+0x75>
+  80218c:	83 ec 0c             	sub    $0xc,%esp
+  80218f:	ff 75 f4             	push   -0xc(%ebp)
+  802192:	e8 03 f5 ff ff       	call   80169a <fd2num>
+  802197:	89 c3                	mov    %eax,%ebx
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	89 d8                	mov    %ebx,%eax
+  80219e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a1:	5b                   	pop    %ebx
+  8021a2:	5e                   	pop    %esi
+  8021a3:	5d                   	pop    %ebp
+  8021a4:	c3                   	ret
+  8021a5:	83 ec 08             	sub    $0x8,%esp
+  8021a8:	6a 00                	push   $0x0
+  8021aa:	ff 75 f4             	push   -0xc(%ebp)
+  8021ad:	e8 05 f6 ff ff       	call   8017b7 <fd_close>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	eb e5                	jmp    80219c <open+0x6c>
+  8021b7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021bc:	eb de                	jmp    80219c <open+0x6c>
+
+008021be <file_image>:
+  8021be:	55                   	push   %ebp
+  8021bf:	89 e5                	mov    %esp,%ebp
+  8021c1:	53                   	push   %ebx
+  8021c2:	83 ec 1c             	sub    $0x1c,%esp
+  8021c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8021c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021cb:	50                   	push   %eax
+  8021cc:	ff 75 08             	push   0x8(%ebp)
+  8021cf:	e8 3d f5 ff ff       	call   801711 <fd_lookup>
+  8021d4:	83 c4 10             	add    $0x10,%esp
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 58                	js     802233 <file_image+0x75>
+  8021db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021de:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  8021e4:	39 08                	cmp    %ecx,(%eax)
+  8021e6:	75 50                	jne    802238 <file_image+0x7a>
+  8021e8:	83 fb 04             	cmp    $0x4,%ebx
+  8021eb:	77 52                	ja     80223f <file_image+0x81>
+  8021ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021f0:	a3 00 60 80 00       	mov    %eax,0x806000
+  8021f5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8021fb:	83 ec 04             	sub    $0x4,%esp
+  8021fe:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802201:	c1 e0 02             	shl    $0x2,%eax
+  802204:	50                   	push   %eax
+  802205:	ff 75 0c             	push   0xc(%ebp)
+  802208:	68 08 60 80 00       	push   $0x806008
+  80220d:	e8 6a e9 ff ff       	call   800b7c <memmove>
+  802212:	ba 00 00 00 00       	mov    $0x0,%edx
+  802217:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80221c:	e8 0b fa ff ff       	call   801c2c <fsipc>
+  802221:	83 c4 10             	add    $0x10,%esp
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 0b                	js     802233 <file_image+0x75>
+  802228:	8b 55 14             	mov    0x14(%ebp),%edx
+  80222b:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  802231:	89 0a                	mov    %ecx,(%edx)
+  802233:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+  802238:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80223d:	eb f4                	jmp    802233 <file_image+0x75>
+  80223f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802244:	eb ed                	jmp    802233 <file_image+0x75>
+
+00802246 <remove>:
+  802246:	55                   	push   %ebp
+  802247:	89 e5                	mov    %esp,%ebp
+  802249:	53                   	push   %ebx
+  80224a:	83 ec 10             	sub    $0x10,%esp
+  80224d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802250:	53                   	push   %ebx
+  802251:	e8 2a e7 ff ff       	call   800980 <strlen>
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80225e:	7f 25                	jg     802285 <remove+0x3f>
+  802260:	83 ec 08             	sub    $0x8,%esp
+  802263:	53                   	push   %ebx
+  802264:	68 00 60 80 00       	push   $0x806000
+  802269:	e8 5e e7 ff ff       	call   8009cc <strcpy>
+  80226e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802273:	b8 09 00 00 00       	mov    $0x9,%eax
+  802278:	e8 af f9 ff ff       	call   801c2c <fsipc>
+  80227d:	83 c4 10             	add    $0x10,%esp
+  802280:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+  802285:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80228a:	eb f4                	jmp    802280 <remove+0x3a>
+
+0080228c <sync>:
+  80228c:	55                   	push   %ebp
+  80228d:	89 e5                	mov    %esp,%ebp
+  80228f:	83 ec 08             	sub    $0x8,%esp
+  802292:	ba 00 00 00 00       	mov    $0x0,%edx
+  802297:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80229c:	e8 8b f9 ff ff       	call   801c2c <fsipc>
+  8022a1:	c9                   	leave
+  8022a2:	c3                   	ret
+
+008022a3 <writebuf>:
+  8022a3:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8022a7:	7f 01                	jg     8022aa <writebuf+0x7>
+  8022a9:	c3                   	ret
+  8022aa:	55                   	push   %ebp
+  8022ab:	89 e5                	mov    %esp,%ebp
+  8022ad:	53                   	push   %ebx
+  8022ae:	83 ec 08             	sub    $0x8,%esp
+  8022b1:	89 c3                	mov    %eax,%ebx
+  8022b3:	ff 70 04             	push   0x4(%eax)
+  8022b6:	8d 40 10             	lea    0x10(%eax),%eax
+  8022b9:	50                   	push   %eax
+  8022ba:	ff 33                	push   (%ebx)
+  8022bc:	e8 8d f7 ff ff       	call   801a4e <write>
+  8022c1:	83 c4 10             	add    $0x10,%esp
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	7e 03                	jle    8022cb <writebuf+0x28>
+  8022c8:	01 43 08             	add    %eax,0x8(%ebx)
+  8022cb:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8022ce:	74 0d                	je     8022dd <writebuf+0x3a>
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d7:	0f 4f c2             	cmovg  %edx,%eax
+  8022da:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8022dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e0:	c9                   	leave
+  8022e1:	c3                   	ret
+
+008022e2 <putch>:
+  8022e2:	55                   	push   %ebp
+  8022e3:	89 e5                	mov    %esp,%ebp
+  8022e5:	53                   	push   %ebx
+  8022e6:	83 ec 04             	sub    $0x4,%esp
+  8022e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022ec:	8b 53 04             	mov    0x4(%ebx),%edx
+  8022ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8022f2:	89 43 04             	mov    %eax,0x4(%ebx)
+  8022f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022f8:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  8022fc:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802301:	74 05                	je     802308 <putch+0x26>
+  802303:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802306:	c9                   	leave
+  802307:	c3                   	ret
+  802308:	89 d8                	mov    %ebx,%eax
+  80230a:	e8 94 ff ff ff       	call   8022a3 <writebuf>
+  80230f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  802316:	eb eb                	jmp    802303 <putch+0x21>
+
+00802318 <vfprintf>:
+  802318:	55                   	push   %ebp
+  802319:	89 e5                	mov    %esp,%ebp
+  80231b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802321:	8b 45 08             	mov    0x8(%ebp),%eax
+  802324:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  80232a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802331:	00 00 00 
+  802334:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80233b:	00 00 00 
+  80233e:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802345:	00 00 00 
+  802348:	ff 75 10             	push   0x10(%ebp)
+  80234b:	ff 75 0c             	push   0xc(%ebp)
+  80234e:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802354:	50                   	push   %eax
+  802355:	68 e2 22 80 00       	push   $0x8022e2
+  80235a:	e8 75 e0 ff ff       	call   8003d4 <vprintfmt>
+  80235f:	83 c4 10             	add    $0x10,%esp
+  802362:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802369:	7f 12                	jg     80237d <vfprintf+0x65>
+  80236b:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802371:	85 c0                	test   %eax,%eax
+  802373:	75 06                	jne    80237b <vfprintf+0x63>
+  802375:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80237b:	c9                   	leave
+  80237c:	c3                   	ret
+  80237d:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802383:	e8 1b ff ff ff       	call   8022a3 <writebuf>
+  802388:	eb e1                	jmp    80236b <vfprintf+0x53>
+
+0080238a <fprintf>:
+  80238a:	55                   	push   %ebp
+  80238b:	89 e5                	mov    %esp,%ebp
+  80238d:	83 ec 0c             	sub    $0xc,%esp
+  802390:	8d 45 10             	lea    0x10(%ebp),%eax
+  802393:	50                   	push   %eax
+  802394:	ff 75 0c             	push   0xc(%ebp)
+  802397:	ff 75 08             	push   0x8(%ebp)
+  80239a:	e8 79 ff ff ff       	call   802318 <vfprintf>
+  80239f:	c9                   	leave
+  8023a0:	c3                   	ret
+
+008023a1 <printf>:
+  8023a1:	55                   	push   %ebp
+  8023a2:	89 e5                	mov    %esp,%ebp
+  8023a4:	83 ec 0c             	sub    $0xc,%esp
+  8023a7:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8023aa:	50                   	push   %eax
+  8023ab:	ff 75 08             	push   0x8(%ebp)
+  8023ae:	6a 01                	push   $0x1
+  8023b0:	e8 63 ff ff ff       	call   802318 <vfprintf>
+  8023b5:	c9                   	leave
+  8023b6:	c3                   	ret
+
+008023b7 <devsock_stat>:
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	83 ec 10             	sub    $0x10,%esp
+  8023bd:	68 08 38 80 00       	push   $0x803808
+  8023c2:	ff 75 0c             	push   0xc(%ebp)
+  8023c5:	e8 02 e6 ff ff       	call   8009cc <strcpy>
+  8023ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+
+008023d1 <devsock_close>:
+  8023d1:	55                   	push   %ebp
+  8023d2:	89 e5                	mov    %esp,%ebp
+  8023d4:	53                   	push   %ebx
+  8023d5:	83 ec 10             	sub    $0x10,%esp
+  8023d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023db:	53                   	push   %ebx
+  8023dc:	e8 99 0d 00 00       	call   80317a <pageref>
+  8023e1:	89 c2                	mov    %eax,%edx
+  8023e3:	83 c4 10             	add    $0x10,%esp
+  8023e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023eb:	83 fa 01             	cmp    $0x1,%edx
+  8023ee:	74 05                	je     8023f5 <devsock_close+0x24>
+  8023f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f3:	c9                   	leave
+  8023f4:	c3                   	ret
+  8023f5:	83 ec 0c             	sub    $0xc,%esp
+  8023f8:	ff 73 0c             	push   0xc(%ebx)
+  8023fb:	e8 aa 02 00 00       	call   8026aa <nsipc_close>
+  802400:	83 c4 10             	add    $0x10,%esp
+  802403:	eb eb                	jmp    8023f0 <devsock_close+0x1f>
+
+00802405 <devsock_write>:
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	83 ec 08             	sub    $0x8,%esp
+  80240b:	6a 00                	push   $0x0
+  80240d:	ff 75 10             	push   0x10(%ebp)
+  802410:	ff 75 0c             	push   0xc(%ebp)
+  802413:	8b 45 08             	mov    0x8(%ebp),%eax
+  802416:	ff 70 0c             	push   0xc(%eax)
+  802419:	e8 6c 03 00 00       	call   80278a <nsipc_send>
+  80241e:	c9                   	leave
+  80241f:	c3                   	ret
+
+00802420 <devsock_read>:
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	83 ec 08             	sub    $0x8,%esp
+  802426:	6a 00                	push   $0x0
+  802428:	ff 75 10             	push   0x10(%ebp)
+  80242b:	ff 75 0c             	push   0xc(%ebp)
+  80242e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802431:	ff 70 0c             	push   0xc(%eax)
+  802434:	e8 e2 02 00 00       	call   80271b <nsipc_recv>
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+0080243b <fd2sockid>:
+  80243b:	55                   	push   %ebp
+  80243c:	89 e5                	mov    %esp,%ebp
+  80243e:	83 ec 20             	sub    $0x20,%esp
+  802441:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802444:	52                   	push   %edx
+  802445:	50                   	push   %eax
+  802446:	e8 c6 f2 ff ff       	call   801711 <fd_lookup>
+  80244b:	83 c4 10             	add    $0x10,%esp
+  80244e:	85 c0                	test   %eax,%eax
+  802450:	78 10                	js     802462 <fd2sockid+0x27>
+  802452:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802455:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  80245b:	39 08                	cmp    %ecx,(%eax)
+  80245d:	75 05                	jne    802464 <fd2sockid+0x29>
+  80245f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802462:	c9                   	leave
+  802463:	c3                   	ret
+  802464:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802469:	eb f7                	jmp    802462 <fd2sockid+0x27>
+
+0080246b <alloc_sockfd>:
+  80246b:	55                   	push   %ebp
+  80246c:	89 e5                	mov    %esp,%ebp
+  80246e:	56                   	push   %esi
+  80246f:	53                   	push   %ebx
+  802470:	83 ec 1c             	sub    $0x1c,%esp
+  802473:	89 c6                	mov    %eax,%esi
+  802475:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802478:	50                   	push   %eax
+  802479:	e8 43 f2 ff ff       	call   8016c1 <fd_alloc>
+  80247e:	89 c3                	mov    %eax,%ebx
+  802480:	83 c4 10             	add    $0x10,%esp
+  802483:	85 c0                	test   %eax,%eax
+  802485:	78 43                	js     8024ca <alloc_sockfd+0x5f>
+  802487:	83 ec 04             	sub    $0x4,%esp
+  80248a:	68 07 04 00 00       	push   $0x407
+  80248f:	ff 75 f4             	push   -0xc(%ebp)
+  802492:	6a 00                	push   $0x0
+  802494:	e8 93 e9 ff ff       	call   800e2c <sys_page_alloc>
+  802499:	89 c3                	mov    %eax,%ebx
+  80249b:	83 c4 10             	add    $0x10,%esp
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 28                	js     8024ca <alloc_sockfd+0x5f>
+  8024a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a5:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  8024ab:	89 10                	mov    %edx,(%eax)
+  8024ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024b0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8024b7:	89 70 0c             	mov    %esi,0xc(%eax)
+  8024ba:	83 ec 0c             	sub    $0xc,%esp
+  8024bd:	50                   	push   %eax
+  8024be:	e8 d7 f1 ff ff       	call   80169a <fd2num>
+  8024c3:	89 c3                	mov    %eax,%ebx
+  8024c5:	83 c4 10             	add    $0x10,%esp
+  8024c8:	eb 0c                	jmp    8024d6 <alloc_sockfd+0x6b>
+  8024ca:	83 ec 0c             	sub    $0xc,%esp
+  8024cd:	56                   	push   %esi
+  8024ce:	e8 d7 01 00 00       	call   8026aa <nsipc_close>
+  8024d3:	83 c4 10             	add    $0x10,%esp
+  8024d6:	89 d8                	mov    %ebx,%eax
+  8024d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024db:	5b                   	pop    %ebx
+  8024dc:	5e                   	pop    %esi
+  8024dd:	5d                   	pop    %ebp
+  8024de:	c3                   	ret
+
+008024df <accept>:
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	83 ec 08             	sub    $0x8,%esp
+  8024e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e8:	e8 4e ff ff ff       	call   80243b <fd2sockid>
+  8024ed:	85 c0                	test   %eax,%eax
+  8024ef:	78 1b                	js     80250c <accept+0x2d>
+  8024f1:	83 ec 04             	sub    $0x4,%esp
+  8024f4:	ff 75 10             	push   0x10(%ebp)
+  8024f7:	ff 75 0c             	push   0xc(%ebp)
+  8024fa:	50                   	push   %eax
+  8024fb:	e8 07 01 00 00       	call   802607 <nsipc_accept>
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	85 c0                	test   %eax,%eax
+  802505:	78 05                	js     80250c <accept+0x2d>
+  802507:	e8 5f ff ff ff       	call   80246b <alloc_sockfd>
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+
+0080250e <bind>:
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	83 ec 08             	sub    $0x8,%esp
+  802514:	8b 45 08             	mov    0x8(%ebp),%eax
+  802517:	e8 1f ff ff ff       	call   80243b <fd2sockid>
+  80251c:	85 c0                	test   %eax,%eax
+  80251e:	78 12                	js     802532 <bind+0x24>
+  802520:	83 ec 04             	sub    $0x4,%esp
+  802523:	ff 75 10             	push   0x10(%ebp)
+  802526:	ff 75 0c             	push   0xc(%ebp)
+  802529:	50                   	push   %eax
+  80252a:	e8 24 01 00 00       	call   802653 <nsipc_bind>
+  80252f:	83 c4 10             	add    $0x10,%esp
+  802532:	c9                   	leave
+  802533:	c3                   	ret
+
+00802534 <shutdown>:
+  802534:	55                   	push   %ebp
+  802535:	89 e5                	mov    %esp,%ebp
+  802537:	83 ec 08             	sub    $0x8,%esp
+  80253a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253d:	e8 f9 fe ff ff       	call   80243b <fd2sockid>
+  802542:	85 c0                	test   %eax,%eax
+  802544:	78 0f                	js     802555 <shutdown+0x21>
+  802546:	83 ec 08             	sub    $0x8,%esp
+  802549:	ff 75 0c             	push   0xc(%ebp)
+  80254c:	50                   	push   %eax
+  80254d:	e8 36 01 00 00       	call   802688 <nsipc_shutdown>
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+
+00802557 <connect>:
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	83 ec 08             	sub    $0x8,%esp
+  80255d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802560:	e8 d6 fe ff ff       	call   80243b <fd2sockid>
+  802565:	85 c0                	test   %eax,%eax
+  802567:	78 12                	js     80257b <connect+0x24>
+  802569:	83 ec 04             	sub    $0x4,%esp
+  80256c:	ff 75 10             	push   0x10(%ebp)
+  80256f:	ff 75 0c             	push   0xc(%ebp)
+  802572:	50                   	push   %eax
+  802573:	e8 4c 01 00 00       	call   8026c4 <nsipc_connect>
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	c9                   	leave
+  80257c:	c3                   	ret
+
+0080257d <listen>:
+  80257d:	55                   	push   %ebp
+  80257e:	89 e5                	mov    %esp,%ebp
+  802580:	83 ec 08             	sub    $0x8,%esp
+  802583:	8b 45 08             	mov    0x8(%ebp),%eax
+  802586:	e8 b0 fe ff ff       	call   80243b <fd2sockid>
+  80258b:	85 c0                	test   %eax,%eax
+  80258d:	78 0f                	js     80259e <listen+0x21>
+  80258f:	83 ec 08             	sub    $0x8,%esp
+  802592:	ff 75 0c             	push   0xc(%ebp)
+  802595:	50                   	push   %eax
+  802596:	e8 5e 01 00 00       	call   8026f9 <nsipc_listen>
+  80259b:	83 c4 10             	add    $0x10,%esp
+  80259e:	c9                   	leave
+  80259f:	c3                   	ret
+
+008025a0 <socket>:
+  8025a0:	55                   	push   %ebp
+  8025a1:	89 e5                	mov    %esp,%ebp
+  8025a3:	83 ec 0c             	sub    $0xc,%esp
+  8025a6:	ff 75 10             	push   0x10(%ebp)
+  8025a9:	ff 75 0c             	push   0xc(%ebp)
+  8025ac:	ff 75 08             	push   0x8(%ebp)
+  8025af:	e8 34 02 00 00       	call   8027e8 <nsipc_socket>
+  8025b4:	83 c4 10             	add    $0x10,%esp
+  8025b7:	85 c0                	test   %eax,%eax
+  8025b9:	78 05                	js     8025c0 <socket+0x20>
+  8025bb:	e8 ab fe ff ff       	call   80246b <alloc_sockfd>
+  8025c0:	c9                   	leave
+  8025c1:	c3                   	ret
+
+008025c2 <nsipc>:
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+  8025c5:	53                   	push   %ebx
+  8025c6:	83 ec 04             	sub    $0x4,%esp
+  8025c9:	89 c3                	mov    %eax,%ebx
+  8025cb:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  8025d2:	74 1f                	je     8025f3 <nsipc+0x31>
+  8025d4:	83 ec 08             	sub    $0x8,%esp
+  8025d7:	6a 00                	push   $0x0
+  8025d9:	6a 00                	push   $0x0
+  8025db:	6a 07                	push   $0x7
+  8025dd:	68 00 70 80 00       	push   $0x807000
+  8025e2:	53                   	push   %ebx
+  8025e3:	ff 35 10 50 80 00    	push   0x805010
+  8025e9:	e8 d7 09 00 00       	call   802fc5 <ipc_call>
+  8025ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f1:	c9                   	leave
+  8025f2:	c3                   	ret
+  8025f3:	83 ec 0c             	sub    $0xc,%esp
+  8025f6:	6a 03                	push   $0x3
+  8025f8:	e8 63 0b 00 00       	call   803160 <ipc_find_env>
+  8025fd:	a3 10 50 80 00       	mov    %eax,0x805010
+  802602:	83 c4 10             	add    $0x10,%esp
+  802605:	eb cd                	jmp    8025d4 <nsipc+0x12>
+
+00802607 <nsipc_accept>:
+  802607:	55                   	push   %ebp
+  802608:	89 e5                	mov    %esp,%ebp
+  80260a:	53                   	push   %ebx
+  80260b:	83 ec 04             	sub    $0x4,%esp
+  80260e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802611:	a3 00 70 80 00       	mov    %eax,0x807000
+  802616:	b8 01 00 00 00       	mov    $0x1,%eax
+  80261b:	e8 a2 ff ff ff       	call   8025c2 <nsipc>
+  802620:	89 c3                	mov    %eax,%ebx
+  802622:	85 c0                	test   %eax,%eax
+  802624:	79 07                	jns    80262d <nsipc_accept+0x26>
+  802626:	89 d8                	mov    %ebx,%eax
+  802628:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80262b:	c9                   	leave
+  80262c:	c3                   	ret
+  80262d:	83 ec 04             	sub    $0x4,%esp
+  802630:	ff 35 10 70 80 00    	push   0x807010
+  802636:	68 00 70 80 00       	push   $0x807000
+  80263b:	ff 75 0c             	push   0xc(%ebp)
+  80263e:	e8 39 e5 ff ff       	call   800b7c <memmove>
+  802643:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802649:	8b 45 10             	mov    0x10(%ebp),%eax
+  80264c:	89 10                	mov    %edx,(%eax)
+  80264e:	83 c4 10             	add    $0x10,%esp
+  802651:	eb d3                	jmp    802626 <nsipc_accept+0x1f>
+
+00802653 <nsipc_bind>:
+  802653:	55                   	push   %ebp
+  802654:	89 e5                	mov    %esp,%ebp
+  802656:	53                   	push   %ebx
+  802657:	83 ec 08             	sub    $0x8,%esp
+  80265a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80265d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802660:	a3 00 70 80 00       	mov    %eax,0x807000
+  802665:	53                   	push   %ebx
+  802666:	ff 75 0c             	push   0xc(%ebp)
+  802669:	68 04 70 80 00       	push   $0x807004
+  80266e:	e8 09 e5 ff ff       	call   800b7c <memmove>
+  802673:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802679:	b8 02 00 00 00       	mov    $0x2,%eax
+  80267e:	e8 3f ff ff ff       	call   8025c2 <nsipc>
+  802683:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802686:	c9                   	leave
+  802687:	c3                   	ret
+
+00802688 <nsipc_shutdown>:
+  802688:	55                   	push   %ebp
+  802689:	89 e5                	mov    %esp,%ebp
+  80268b:	83 ec 08             	sub    $0x8,%esp
+  80268e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802691:	a3 00 70 80 00       	mov    %eax,0x807000
+  802696:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802699:	a3 04 70 80 00       	mov    %eax,0x807004
+  80269e:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026a3:	e8 1a ff ff ff       	call   8025c2 <nsipc>
+  8026a8:	c9                   	leave
+  8026a9:	c3                   	ret
+
+008026aa <nsipc_close>:
+  8026aa:	55                   	push   %ebp
+  8026ab:	89 e5                	mov    %esp,%ebp
+  8026ad:	83 ec 08             	sub    $0x8,%esp
+  8026b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b3:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026b8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026bd:	e8 00 ff ff ff       	call   8025c2 <nsipc>
+  8026c2:	c9                   	leave
+  8026c3:	c3                   	ret
+
+008026c4 <nsipc_connect>:
+  8026c4:	55                   	push   %ebp
+  8026c5:	89 e5                	mov    %esp,%ebp
+  8026c7:	53                   	push   %ebx
+  8026c8:	83 ec 08             	sub    $0x8,%esp
+  8026cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026d6:	53                   	push   %ebx
+  8026d7:	ff 75 0c             	push   0xc(%ebp)
+  8026da:	68 04 70 80 00       	push   $0x807004
+  8026df:	e8 98 e4 ff ff       	call   800b7c <memmove>
+  8026e4:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8026ea:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026ef:	e8 ce fe ff ff       	call   8025c2 <nsipc>
+  8026f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026f7:	c9                   	leave
+  8026f8:	c3                   	ret
+
+008026f9 <nsipc_listen>:
+  8026f9:	55                   	push   %ebp
+  8026fa:	89 e5                	mov    %esp,%ebp
+  8026fc:	83 ec 08             	sub    $0x8,%esp
+  8026ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802702:	a3 00 70 80 00       	mov    %eax,0x807000
+  802707:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80270a:	a3 04 70 80 00       	mov    %eax,0x807004
+  80270f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802714:	e8 a9 fe ff ff       	call   8025c2 <nsipc>
+  802719:	c9                   	leave
+  80271a:	c3                   	ret
+
+0080271b <nsipc_recv>:
+  80271b:	55                   	push   %ebp
+  80271c:	89 e5                	mov    %esp,%ebp
+  80271e:	56                   	push   %esi
+  80271f:	53                   	push   %ebx
+  802720:	8b 75 10             	mov    0x10(%ebp),%esi
+  802723:	8b 45 08             	mov    0x8(%ebp),%eax
+  802726:	a3 00 70 80 00       	mov    %eax,0x807000
+  80272b:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802731:	8b 45 14             	mov    0x14(%ebp),%eax
+  802734:	a3 08 70 80 00       	mov    %eax,0x807008
+  802739:	b8 07 00 00 00       	mov    $0x7,%eax
+  80273e:	e8 7f fe ff ff       	call   8025c2 <nsipc>
+  802743:	89 c3                	mov    %eax,%ebx
+  802745:	85 c0                	test   %eax,%eax
+  802747:	78 22                	js     80276b <nsipc_recv+0x50>
+  802749:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80274e:	39 c6                	cmp    %eax,%esi
+  802750:	0f 4e c6             	cmovle %esi,%eax
+  802753:	39 c3                	cmp    %eax,%ebx
+  802755:	7f 1d                	jg     802774 <nsipc_recv+0x59>
+  802757:	83 ec 04             	sub    $0x4,%esp
+  80275a:	53                   	push   %ebx
+  80275b:	68 00 70 80 00       	push   $0x807000
+  802760:	ff 75 0c             	push   0xc(%ebp)
+  802763:	e8 14 e4 ff ff       	call   800b7c <memmove>
+  802768:	83 c4 10             	add    $0x10,%esp
+  80276b:	89 d8                	mov    %ebx,%eax
+  80276d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802770:	5b                   	pop    %ebx
+  802771:	5e                   	pop    %esi
+  802772:	5d                   	pop    %ebp
+  802773:	c3                   	ret
+  802774:	68 14 38 80 00       	push   $0x803814
+  802779:	68 29 38 80 00       	push   $0x803829
+  80277e:	6a 60                	push   $0x60
+  802780:	68 3e 38 80 00       	push   $0x80383e
+  802785:	e8 70 da ff ff       	call   8001fa <_panic>
+
+0080278a <nsipc_send>:
+  80278a:	55                   	push   %ebp
+  80278b:	89 e5                	mov    %esp,%ebp
+  80278d:	53                   	push   %ebx
+  80278e:	83 ec 04             	sub    $0x4,%esp
+  802791:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802794:	8b 45 08             	mov    0x8(%ebp),%eax
+  802797:	a3 00 70 80 00       	mov    %eax,0x807000
+  80279c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8027a2:	7f 2e                	jg     8027d2 <nsipc_send+0x48>
+  8027a4:	83 ec 04             	sub    $0x4,%esp
+  8027a7:	53                   	push   %ebx
+  8027a8:	ff 75 0c             	push   0xc(%ebp)
+  8027ab:	68 0c 70 80 00       	push   $0x80700c
+  8027b0:	e8 c7 e3 ff ff       	call   800b7c <memmove>
+  8027b5:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8027bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027be:	a3 08 70 80 00       	mov    %eax,0x807008
+  8027c3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027c8:	e8 f5 fd ff ff       	call   8025c2 <nsipc>
+  8027cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d0:	c9                   	leave
+  8027d1:	c3                   	ret
+  8027d2:	68 4a 38 80 00       	push   $0x80384a
+  8027d7:	68 29 38 80 00       	push   $0x803829
+  8027dc:	6a 6b                	push   $0x6b
+  8027de:	68 3e 38 80 00       	push   $0x80383e
+  8027e3:	e8 12 da ff ff       	call   8001fa <_panic>
+
+008027e8 <nsipc_socket>:
+  8027e8:	55                   	push   %ebp
+  8027e9:	89 e5                	mov    %esp,%ebp
+  8027eb:	83 ec 08             	sub    $0x8,%esp
+  8027ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027f9:	a3 04 70 80 00       	mov    %eax,0x807004
+  8027fe:	8b 45 10             	mov    0x10(%ebp),%eax
+  802801:	a3 08 70 80 00       	mov    %eax,0x807008
+  802806:	b8 09 00 00 00       	mov    $0x9,%eax
+  80280b:	e8 b2 fd ff ff       	call   8025c2 <nsipc>
+  802810:	c9                   	leave
+  802811:	c3                   	ret
+
+00802812 <devpipe_stat>:
+  802812:	55                   	push   %ebp
+  802813:	89 e5                	mov    %esp,%ebp
+  802815:	56                   	push   %esi
+  802816:	53                   	push   %ebx
+  802817:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80281a:	83 ec 0c             	sub    $0xc,%esp
+  80281d:	ff 75 08             	push   0x8(%ebp)
+  802820:	e8 85 ee ff ff       	call   8016aa <fd2data>
+  802825:	89 c6                	mov    %eax,%esi
+  802827:	83 c4 08             	add    $0x8,%esp
+  80282a:	68 56 38 80 00       	push   $0x803856
+  80282f:	53                   	push   %ebx
+  802830:	e8 97 e1 ff ff       	call   8009cc <strcpy>
+  802835:	8b 46 04             	mov    0x4(%esi),%eax
+  802838:	2b 06                	sub    (%esi),%eax
+  80283a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802840:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802847:	00 00 00 
+  80284a:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802851:	40 80 00 
+  802854:	b8 00 00 00 00       	mov    $0x0,%eax
+  802859:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80285c:	5b                   	pop    %ebx
+  80285d:	5e                   	pop    %esi
+  80285e:	5d                   	pop    %ebp
+  80285f:	c3                   	ret
+
+00802860 <devpipe_close>:
+  802860:	55                   	push   %ebp
+  802861:	89 e5                	mov    %esp,%ebp
+  802863:	53                   	push   %ebx
+  802864:	83 ec 0c             	sub    $0xc,%esp
+  802867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80286a:	53                   	push   %ebx
+  80286b:	6a 00                	push   $0x0
+  80286d:	e8 8c e6 ff ff       	call   800efe <sys_page_unmap>
+  802872:	89 1c 24             	mov    %ebx,(%esp)
+  802875:	e8 30 ee ff ff       	call   8016aa <fd2data>
+  80287a:	83 c4 08             	add    $0x8,%esp
+  80287d:	50                   	push   %eax
+  80287e:	6a 00                	push   $0x0
+  802880:	e8 79 e6 ff ff       	call   800efe <sys_page_unmap>
+  802885:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802888:	c9                   	leave
+  802889:	c3                   	ret
+
+0080288a <_pipeisclosed>:
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	57                   	push   %edi
+  80288e:	56                   	push   %esi
+  80288f:	53                   	push   %ebx
+  802890:	83 ec 1c             	sub    $0x1c,%esp
+  802893:	89 c7                	mov    %eax,%edi
+  802895:	89 d6                	mov    %edx,%esi
+  802897:	a1 14 50 80 00       	mov    0x805014,%eax
+  80289c:	8b 58 58             	mov    0x58(%eax),%ebx
+  80289f:	83 ec 0c             	sub    $0xc,%esp
+  8028a2:	57                   	push   %edi
+  8028a3:	e8 d2 08 00 00       	call   80317a <pageref>
+  8028a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028ab:	89 34 24             	mov    %esi,(%esp)
+  8028ae:	e8 c7 08 00 00       	call   80317a <pageref>
+  8028b3:	8b 15 14 50 80 00    	mov    0x805014,%edx
+  8028b9:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8028bc:	83 c4 10             	add    $0x10,%esp
+  8028bf:	39 cb                	cmp    %ecx,%ebx
+  8028c1:	74 1b                	je     8028de <_pipeisclosed+0x54>
+  8028c3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8028c6:	75 cf                	jne    802897 <_pipeisclosed+0xd>
+  8028c8:	8b 42 58             	mov    0x58(%edx),%eax
+  8028cb:	6a 01                	push   $0x1
+  8028cd:	50                   	push   %eax
+  8028ce:	53                   	push   %ebx
+  8028cf:	68 5d 38 80 00       	push   $0x80385d
+  8028d4:	e8 fc d9 ff ff       	call   8002d5 <cprintf>
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	eb b9                	jmp    802897 <_pipeisclosed+0xd>
+  8028de:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8028e1:	0f 94 c0             	sete   %al
+  8028e4:	0f b6 c0             	movzbl %al,%eax
+  8028e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ea:	5b                   	pop    %ebx
+  8028eb:	5e                   	pop    %esi
+  8028ec:	5f                   	pop    %edi
+  8028ed:	5d                   	pop    %ebp
+  8028ee:	c3                   	ret
+
+008028ef <devpipe_write>:
+  8028ef:	55                   	push   %ebp
+  8028f0:	89 e5                	mov    %esp,%ebp
+  8028f2:	57                   	push   %edi
+  8028f3:	56                   	push   %esi
+  8028f4:	53                   	push   %ebx
+  8028f5:	83 ec 28             	sub    $0x28,%esp
+  8028f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028fb:	56                   	push   %esi
+  8028fc:	e8 a9 ed ff ff       	call   8016aa <fd2data>
+  802901:	89 c3                	mov    %eax,%ebx
+  802903:	83 c4 10             	add    $0x10,%esp
+  802906:	bf 00 00 00 00       	mov    $0x0,%edi
+  80290b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80290f:	74 5c                	je     80296d <devpipe_write+0x7e>
+  802911:	8b 43 04             	mov    0x4(%ebx),%eax
+  802914:	8b 0b                	mov    (%ebx),%ecx
+  802916:	8d 51 20             	lea    0x20(%ecx),%edx
+  802919:	39 d0                	cmp    %edx,%eax
+  80291b:	72 1e                	jb     80293b <devpipe_write+0x4c>
+  80291d:	89 da                	mov    %ebx,%edx
+  80291f:	89 f0                	mov    %esi,%eax
+  802921:	e8 64 ff ff ff       	call   80288a <_pipeisclosed>
+  802926:	85 c0                	test   %eax,%eax
+  802928:	75 48                	jne    802972 <devpipe_write+0x83>
+  80292a:	e8 b2 e4 ff ff       	call   800de1 <sys_yield>
+  80292f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802932:	8b 0b                	mov    (%ebx),%ecx
+  802934:	8d 51 20             	lea    0x20(%ecx),%edx
+  802937:	39 d0                	cmp    %edx,%eax
+  802939:	73 e2                	jae    80291d <devpipe_write+0x2e>
+  80293b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80293e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802942:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802945:	89 c2                	mov    %eax,%edx
+  802947:	c1 fa 1f             	sar    $0x1f,%edx
+  80294a:	89 d1                	mov    %edx,%ecx
+  80294c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80294f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802952:	83 e2 1f             	and    $0x1f,%edx
+  802955:	29 ca                	sub    %ecx,%edx
+  802957:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80295b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80295f:	83 c0 01             	add    $0x1,%eax
+  802962:	89 43 04             	mov    %eax,0x4(%ebx)
+  802965:	83 c7 01             	add    $0x1,%edi
+  802968:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80296b:	75 a4                	jne    802911 <devpipe_write+0x22>
+  80296d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802970:	eb 05                	jmp    802977 <devpipe_write+0x88>
+  802972:	b8 00 00 00 00       	mov    $0x0,%eax
+  802977:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80297a:	5b                   	pop    %ebx
+  80297b:	5e                   	pop    %esi
+  80297c:	5f                   	pop    %edi
+  80297d:	5d                   	pop    %ebp
+  80297e:	c3                   	ret
+
+0080297f <devpipe_read>:
+  80297f:	55                   	push   %ebp
+  802980:	89 e5                	mov    %esp,%ebp
+  802982:	57                   	push   %edi
+  802983:	56                   	push   %esi
+  802984:	53                   	push   %ebx
+  802985:	83 ec 18             	sub    $0x18,%esp
+  802988:	8b 75 08             	mov    0x8(%ebp),%esi
+  80298b:	56                   	push   %esi
+  80298c:	e8 19 ed ff ff       	call   8016aa <fd2data>
+  802991:	89 c3                	mov    %eax,%ebx
+  802993:	83 c4 10             	add    $0x10,%esp
+  802996:	bf 00 00 00 00       	mov    $0x0,%edi
+  80299b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80299f:	74 45                	je     8029e6 <devpipe_read+0x67>
+  8029a1:	8b 03                	mov    (%ebx),%eax
+  8029a3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029a6:	75 1d                	jne    8029c5 <devpipe_read+0x46>
+  8029a8:	85 ff                	test   %edi,%edi
+  8029aa:	75 3f                	jne    8029eb <devpipe_read+0x6c>
+  8029ac:	89 da                	mov    %ebx,%edx
+  8029ae:	89 f0                	mov    %esi,%eax
+  8029b0:	e8 d5 fe ff ff       	call   80288a <_pipeisclosed>
+  8029b5:	85 c0                	test   %eax,%eax
+  8029b7:	75 3c                	jne    8029f5 <devpipe_read+0x76>
+  8029b9:	e8 23 e4 ff ff       	call   800de1 <sys_yield>
+  8029be:	8b 03                	mov    (%ebx),%eax
+  8029c0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029c3:	74 e7                	je     8029ac <devpipe_read+0x2d>
+  8029c5:	99                   	cltd
+  8029c6:	c1 ea 1b             	shr    $0x1b,%edx
+  8029c9:	01 d0                	add    %edx,%eax
+  8029cb:	83 e0 1f             	and    $0x1f,%eax
+  8029ce:	29 d0                	sub    %edx,%eax
+  8029d0:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8029d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029d8:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8029db:	83 03 01             	addl   $0x1,(%ebx)
+  8029de:	83 c7 01             	add    $0x1,%edi
+  8029e1:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8029e4:	75 bb                	jne    8029a1 <devpipe_read+0x22>
+  8029e6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029e9:	eb 02                	jmp    8029ed <devpipe_read+0x6e>
+  8029eb:	89 f8                	mov    %edi,%eax
+  8029ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f0:	5b                   	pop    %ebx
+  8029f1:	5e                   	pop    %esi
+  8029f2:	5f                   	pop    %edi
+  8029f3:	5d                   	pop    %ebp
+  8029f4:	c3                   	ret
+  8029f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029fa:	eb f1                	jmp    8029ed <devpipe_read+0x6e>
+
+008029fc <pipe>:
+  8029fc:	55                   	push   %ebp
+  8029fd:	89 e5                	mov    %esp,%ebp
+  8029ff:	56                   	push   %esi
+  802a00:	53                   	push   %ebx
+  802a01:	83 ec 1c             	sub    $0x1c,%esp
+  802a04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a07:	50                   	push   %eax
+  802a08:	e8 b4 ec ff ff       	call   8016c1 <fd_alloc>
+  802a0d:	89 c3                	mov    %eax,%ebx
+  802a0f:	83 c4 10             	add    $0x10,%esp
+  802a12:	85 c0                	test   %eax,%eax
+  802a14:	0f 88 23 01 00 00    	js     802b3d <pipe+0x141>
+  802a1a:	83 ec 04             	sub    $0x4,%esp
+  802a1d:	68 07 04 00 00       	push   $0x407
+  802a22:	ff 75 f4             	push   -0xc(%ebp)
+  802a25:	6a 00                	push   $0x0
+  802a27:	e8 00 e4 ff ff       	call   800e2c <sys_page_alloc>
+  802a2c:	89 c3                	mov    %eax,%ebx
+  802a2e:	83 c4 10             	add    $0x10,%esp
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	0f 88 04 01 00 00    	js     802b3d <pipe+0x141>
+  802a39:	83 ec 0c             	sub    $0xc,%esp
+  802a3c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a3f:	50                   	push   %eax
+  802a40:	e8 7c ec ff ff       	call   8016c1 <fd_alloc>
+  802a45:	89 c3                	mov    %eax,%ebx
+  802a47:	83 c4 10             	add    $0x10,%esp
+  802a4a:	85 c0                	test   %eax,%eax
+  802a4c:	0f 88 db 00 00 00    	js     802b2d <pipe+0x131>
+  802a52:	83 ec 04             	sub    $0x4,%esp
+  802a55:	68 07 04 00 00       	push   $0x407
+  802a5a:	ff 75 f0             	push   -0x10(%ebp)
+  802a5d:	6a 00                	push   $0x0
+  802a5f:	e8 c8 e3 ff ff       	call   800e2c <sys_page_alloc>
+  802a64:	89 c3                	mov    %eax,%ebx
+  802a66:	83 c4 10             	add    $0x10,%esp
+  802a69:	85 c0                	test   %eax,%eax
+  802a6b:	0f 88 bc 00 00 00    	js     802b2d <pipe+0x131>
+  802a71:	83 ec 0c             	sub    $0xc,%esp
+  802a74:	ff 75 f4             	push   -0xc(%ebp)
+  802a77:	e8 2e ec ff ff       	call   8016aa <fd2data>
+  802a7c:	89 c6                	mov    %eax,%esi
+  802a7e:	83 c4 0c             	add    $0xc,%esp
+  802a81:	68 07 04 00 00       	push   $0x407
+  802a86:	50                   	push   %eax
+  802a87:	6a 00                	push   $0x0
+  802a89:	e8 9e e3 ff ff       	call   800e2c <sys_page_alloc>
+  802a8e:	89 c3                	mov    %eax,%ebx
+  802a90:	83 c4 10             	add    $0x10,%esp
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	0f 88 82 00 00 00    	js     802b1d <pipe+0x121>
+  802a9b:	83 ec 0c             	sub    $0xc,%esp
+  802a9e:	ff 75 f0             	push   -0x10(%ebp)
+  802aa1:	e8 04 ec ff ff       	call   8016aa <fd2data>
+  802aa6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802aad:	50                   	push   %eax
+  802aae:	6a 00                	push   $0x0
+  802ab0:	56                   	push   %esi
+  802ab1:	6a 00                	push   $0x0
+  802ab3:	e8 b7 e3 ff ff       	call   800e6f <sys_page_map>
+  802ab8:	89 c3                	mov    %eax,%ebx
+  802aba:	83 c4 20             	add    $0x20,%esp
+  802abd:	85 c0                	test   %eax,%eax
+  802abf:	78 4e                	js     802b0f <pipe+0x113>
+  802ac1:	a1 40 40 80 00       	mov    0x804040,%eax
+  802ac6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ac9:	89 02                	mov    %eax,(%edx)
+  802acb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ace:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802ad5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802ad8:	89 02                	mov    %eax,(%edx)
+  802ada:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802add:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802ae4:	83 ec 0c             	sub    $0xc,%esp
+  802ae7:	ff 75 f4             	push   -0xc(%ebp)
+  802aea:	e8 ab eb ff ff       	call   80169a <fd2num>
+  802aef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802af2:	89 01                	mov    %eax,(%ecx)
+  802af4:	83 c4 04             	add    $0x4,%esp
+  802af7:	ff 75 f0             	push   -0x10(%ebp)
+  802afa:	e8 9b eb ff ff       	call   80169a <fd2num>
+  802aff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b02:	89 41 04             	mov    %eax,0x4(%ecx)
+  802b05:	83 c4 10             	add    $0x10,%esp
+  802b08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b0d:	eb 2e                	jmp    802b3d <pipe+0x141>
+  802b0f:	83 ec 08             	sub    $0x8,%esp
+  802b12:	56                   	push   %esi
+  802b13:	6a 00                	push   $0x0
+  802b15:	e8 e4 e3 ff ff       	call   800efe <sys_page_unmap>
+  802b1a:	83 c4 10             	add    $0x10,%esp
+  802b1d:	83 ec 08             	sub    $0x8,%esp
+  802b20:	ff 75 f0             	push   -0x10(%ebp)
+  802b23:	6a 00                	push   $0x0
+  802b25:	e8 d4 e3 ff ff       	call   800efe <sys_page_unmap>
+  802b2a:	83 c4 10             	add    $0x10,%esp
+  802b2d:	83 ec 08             	sub    $0x8,%esp
+  802b30:	ff 75 f4             	push   -0xc(%ebp)
+  802b33:	6a 00                	push   $0x0
+  802b35:	e8 c4 e3 ff ff       	call   800efe <sys_page_unmap>
+  802b3a:	83 c4 10             	add    $0x10,%esp
+  802b3d:	89 d8                	mov    %ebx,%eax
+  802b3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b42:	5b                   	pop    %ebx
+  802b43:	5e                   	pop    %esi
+  802b44:	5d                   	pop    %ebp
+  802b45:	c3                   	ret
+
+00802b46 <pipeisclosed>:
+  802b46:	55                   	push   %ebp
+  802b47:	89 e5                	mov    %esp,%ebp
+  802b49:	83 ec 20             	sub    $0x20,%esp
+  802b4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b4f:	50                   	push   %eax
+  802b50:	ff 75 08             	push   0x8(%ebp)
+  802b53:	e8 b9 eb ff ff       	call   801711 <fd_lookup>
+  802b58:	83 c4 10             	add    $0x10,%esp
+  802b5b:	85 c0                	test   %eax,%eax
+  802b5d:	78 18                	js     802b77 <pipeisclosed+0x31>
+  802b5f:	83 ec 0c             	sub    $0xc,%esp
+  802b62:	ff 75 f4             	push   -0xc(%ebp)
+  802b65:	e8 40 eb ff ff       	call   8016aa <fd2data>
+  802b6a:	89 c2                	mov    %eax,%edx
+  802b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b6f:	e8 16 fd ff ff       	call   80288a <_pipeisclosed>
+  802b74:	83 c4 10             	add    $0x10,%esp
+  802b77:	c9                   	leave
+  802b78:	c3                   	ret
+
+00802b79 <ipcring_init>:
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	53                   	push   %ebx
+  802b7d:	83 ec 08             	sub    $0x8,%esp
+  802b80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b83:	6a 60                	push   $0x60
+  802b85:	6a 00                	push   $0x0
+  802b87:	53                   	push   %ebx
+  802b88:	e8 ba df ff ff       	call   800b47 <memset>
+  802b8d:	a1 14 50 80 00       	mov    0x805014,%eax
+  802b92:	8b 40 48             	mov    0x48(%eax),%eax
+  802b95:	89 03                	mov    %eax,(%ebx)
+  802b97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b9a:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b9d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ba0:	89 43 08             	mov    %eax,0x8(%ebx)
+  802ba3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ba6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802ba9:	83 c4 10             	add    $0x10,%esp
+  802bac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802baf:	c9                   	leave
+  802bb0:	c3                   	ret
+
+00802bb1 <ipcring_req_slot>:
+  802bb1:	55                   	push   %ebp
+  802bb2:	89 e5                	mov    %esp,%ebp
+  802bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb7:	8b 50 10             	mov    0x10(%eax),%edx
+  802bba:	8b 48 18             	mov    0x18(%eax),%ecx
+  802bbd:	29 ca                	sub    %ecx,%edx
+  802bbf:	83 fa 07             	cmp    $0x7,%edx
+  802bc2:	77 0c                	ja     802bd0 <ipcring_req_slot+0x1f>
+  802bc4:	8b 50 10             	mov    0x10(%eax),%edx
+  802bc7:	83 e2 07             	and    $0x7,%edx
+  802bca:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802bce:	5d                   	pop    %ebp
+  802bcf:	c3                   	ret
+  802bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd5:	eb f7                	jmp    802bce <ipcring_req_slot+0x1d>
+
+00802bd7 <ipcring_req_push>:
+  802bd7:	55                   	push   %ebp
+  802bd8:	89 e5                	mov    %esp,%ebp
+  802bda:	83 ec 08             	sub    $0x8,%esp
+  802bdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  802be0:	8b 42 10             	mov    0x10(%edx),%eax
+  802be3:	83 c0 01             	add    $0x1,%eax
+  802be6:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bef:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802bf3:	85 c0                	test   %eax,%eax
+  802bf5:	75 02                	jne    802bf9 <ipcring_req_push+0x22>
+  802bf7:	c9                   	leave
+  802bf8:	c3                   	ret
+  802bf9:	6a 00                	push   $0x0
+  802bfb:	68 00 00 80 ee       	push   $0xee800000
+  802c00:	ff 72 08             	push   0x8(%edx)
+  802c03:	ff 72 04             	push   0x4(%edx)
+  802c06:	e8 59 e5 ff ff       	call   801164 <sys_ipc_send>
+  802c0b:	83 c4 10             	add    $0x10,%esp
+  802c0e:	eb e7                	jmp    802bf7 <ipcring_req_push+0x20>
+
+00802c10 <ipcring_rsp_wait>:
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	53                   	push   %ebx
+  802c14:	83 ec 04             	sub    $0x4,%esp
+  802c17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c1a:	8b 53 18             	mov    0x18(%ebx),%edx
+  802c1d:	8b 43 10             	mov    0x10(%ebx),%eax
+  802c20:	39 c2                	cmp    %eax,%edx
+  802c22:	74 3c                	je     802c60 <ipcring_rsp_wait+0x50>
+  802c24:	8b 53 14             	mov    0x14(%ebx),%edx
+  802c27:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c2a:	39 c2                	cmp    %eax,%edx
+  802c2c:	75 23                	jne    802c51 <ipcring_rsp_wait+0x41>
+  802c2e:	83 ec 08             	sub    $0x8,%esp
+  802c31:	6a 00                	push   $0x0
+  802c33:	6a 00                	push   $0x0
+  802c35:	6a 00                	push   $0x0
+  802c37:	6a 00                	push   $0x0
+  802c39:	ff 73 0c             	push   0xc(%ebx)
+  802c3c:	ff 73 04             	push   0x4(%ebx)
+  802c3f:	e8 81 03 00 00       	call   802fc5 <ipc_call>
+  802c44:	8b 53 14             	mov    0x14(%ebx),%edx
+  802c47:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c4a:	83 c4 20             	add    $0x20,%esp
+  802c4d:	39 c2                	cmp    %eax,%edx
+  802c4f:	74 dd                	je     802c2e <ipcring_rsp_wait+0x1e>
+  802c51:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c54:	83 e0 07             	and    $0x7,%eax
+  802c57:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802c5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c5e:	c9                   	leave
+  802c5f:	c3                   	ret
+  802c60:	68 78 38 80 00       	push   $0x803878
+  802c65:	68 29 38 80 00       	push   $0x803829
+  802c6a:	6a 3b                	push   $0x3b
+  802c6c:	68 99 38 80 00       	push   $0x803899
+  802c71:	e8 84 d5 ff ff       	call   8001fa <_panic>
+
+00802c76 <ipcring_rsp_pop>:
+  802c76:	55                   	push   %ebp
+  802c77:	89 e5                	mov    %esp,%ebp
+  802c79:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c7c:	8b 42 18             	mov    0x18(%edx),%eax
+  802c7f:	83 c0 01             	add    $0x1,%eax
+  802c82:	89 42 18             	mov    %eax,0x18(%edx)
+  802c85:	5d                   	pop    %ebp
+  802c86:	c3                   	ret
+
+00802c87 <ipcring_server_init>:
+  802c87:	55                   	push   %ebp
+  802c88:	89 e5                	mov    %esp,%ebp
+  802c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c90:	89 10                	mov    %edx,(%eax)
+  802c92:	8b 55 10             	mov    0x10(%ebp),%edx
+  802c95:	89 50 04             	mov    %edx,0x4(%eax)
+  802c98:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802c9f:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802ca6:	5d                   	pop    %ebp
+  802ca7:	c3                   	ret
+
+00802ca8 <ipcring_req_avail>:
+  802ca8:	55                   	push   %ebp
+  802ca9:	89 e5                	mov    %esp,%ebp
+  802cab:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cae:	8b 02                	mov    (%edx),%eax
+  802cb0:	8b 40 10             	mov    0x10(%eax),%eax
+  802cb3:	2b 42 08             	sub    0x8(%edx),%eax
+  802cb6:	ba 08 00 00 00       	mov    $0x8,%edx
+  802cbb:	39 d0                	cmp    %edx,%eax
+  802cbd:	0f 47 c2             	cmova  %edx,%eax
+  802cc0:	5d                   	pop    %ebp
+  802cc1:	c3                   	ret
+
+00802cc2 <ipcring_req_peek>:
+  802cc2:	55                   	push   %ebp
+  802cc3:	89 e5                	mov    %esp,%ebp
+  802cc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cc8:	8b 42 08             	mov    0x8(%edx),%eax
+  802ccb:	83 e0 07             	and    $0x7,%eax
+  802cce:	8b 12                	mov    (%edx),%edx
+  802cd0:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802cd4:	5d                   	pop    %ebp
+  802cd5:	c3                   	ret
+
+00802cd6 <ipcring_rsp_push>:
+  802cd6:	55                   	push   %ebp
+  802cd7:	89 e5                	mov    %esp,%ebp
+  802cd9:	83 ec 08             	sub    $0x8,%esp
+  802cdc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cdf:	8b 41 08             	mov    0x8(%ecx),%eax
+  802ce2:	83 c0 01             	add    $0x1,%eax
+  802ce5:	89 41 08             	mov    %eax,0x8(%ecx)
+  802ce8:	8b 11                	mov    (%ecx),%edx
+  802cea:	83 c2 14             	add    $0x14,%edx
+  802ced:	f0 87 02             	lock xchg %eax,(%edx)
+  802cf0:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802cf4:	75 02                	jne    802cf8 <ipcring_rsp_push+0x22>
+  802cf6:	c9                   	leave
+  802cf7:	c3                   	ret
+  802cf8:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802cff:	6a 00                	push   $0x0
+  802d01:	68 00 00 80 ee       	push   $0xee800000
+  802d06:	6a 00                	push   $0x0
+  802d08:	ff 71 04             	push   0x4(%ecx)
+  802d0b:	e8 77 e3 ff ff       	call   801087 <sys_ipc_try_send>
+  802d10:	83 c4 10             	add    $0x10,%esp
+  802d13:	eb e1                	jmp    802cf6 <ipcring_rsp_push+0x20>
+
+00802d15 <ipcring_client_wait>:
+  802d15:	55                   	push   %ebp
+  802d16:	89 e5                	mov    %esp,%ebp
+  802d18:	83 ec 08             	sub    $0x8,%esp
+  802d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1e:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802d25:	8b 10                	mov    (%eax),%edx
+  802d27:	8b 52 18             	mov    0x18(%edx),%edx
+  802d2a:	3b 50 08             	cmp    0x8(%eax),%edx
+  802d2d:	75 02                	jne    802d31 <ipcring_client_wait+0x1c>
+  802d2f:	c9                   	leave
+  802d30:	c3                   	ret
+  802d31:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802d38:	6a 00                	push   $0x0
+  802d3a:	68 00 00 80 ee       	push   $0xee800000
+  802d3f:	6a 00                	push   $0x0
+  802d41:	ff 70 04             	push   0x4(%eax)
+  802d44:	e8 3e e3 ff ff       	call   801087 <sys_ipc_try_send>
+  802d49:	83 c4 10             	add    $0x10,%esp
+  802d4c:	eb e1                	jmp    802d2f <ipcring_client_wait+0x1a>
+
+00802d4e <ipcring_server_sleep>:
+  802d4e:	55                   	push   %ebp
+  802d4f:	89 e5                	mov    %esp,%ebp
+  802d51:	53                   	push   %ebx
+  802d52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d55:	8b 01                	mov    (%ecx),%eax
+  802d57:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802d5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d5f:	f0 87 02             	lock xchg %eax,(%edx)
+  802d62:	8b 11                	mov    (%ecx),%edx
+  802d64:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802d67:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d6c:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802d6f:	74 0e                	je     802d7f <ipcring_server_sleep+0x31>
+  802d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d76:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d82:	c9                   	leave
+  802d83:	c3                   	ret
+
+00802d84 <devcons_close>:
+  802d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d89:	c3                   	ret
+
+00802d8a <devcons_stat>:
+  802d8a:	55                   	push   %ebp
+  802d8b:	89 e5                	mov    %esp,%ebp
+  802d8d:	83 ec 10             	sub    $0x10,%esp
+  802d90:	68 a7 38 80 00       	push   $0x8038a7
+  802d95:	ff 75 0c             	push   0xc(%ebp)
+  802d98:	e8 2f dc ff ff       	call   8009cc <strcpy>
+  802d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da2:	c9                   	leave
+  802da3:	c3                   	ret
+
+00802da4 <devcons_write>:
+  802da4:	55                   	push   %ebp
+  802da5:	89 e5                	mov    %esp,%ebp
+  802da7:	57                   	push   %edi
+  802da8:	56                   	push   %esi
+  802da9:	53                   	push   %ebx
+  802daa:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802db0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802db3:	85 ff                	test   %edi,%edi
+  802db5:	74 51                	je     802e08 <devcons_write+0x64>
+  802db7:	be 00 00 00 00       	mov    $0x0,%esi
+  802dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc1:	89 fb                	mov    %edi,%ebx
+  802dc3:	29 c3                	sub    %eax,%ebx
+  802dc5:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802dca:	39 d3                	cmp    %edx,%ebx
+  802dcc:	0f 47 da             	cmova  %edx,%ebx
+  802dcf:	83 ec 04             	sub    $0x4,%esp
+  802dd2:	53                   	push   %ebx
+  802dd3:	03 45 0c             	add    0xc(%ebp),%eax
+  802dd6:	50                   	push   %eax
+  802dd7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802ddd:	50                   	push   %eax
+  802dde:	e8 99 dd ff ff       	call   800b7c <memmove>
+  802de3:	83 c4 08             	add    $0x8,%esp
+  802de6:	53                   	push   %ebx
+  802de7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802ded:	50                   	push   %eax
+  802dee:	e8 51 df ff ff       	call   800d44 <sys_cputs>
+  802df3:	01 de                	add    %ebx,%esi
+  802df5:	89 f0                	mov    %esi,%eax
+  802df7:	83 c4 10             	add    $0x10,%esp
+  802dfa:	39 fe                	cmp    %edi,%esi
+  802dfc:	72 c3                	jb     802dc1 <devcons_write+0x1d>
+  802dfe:	89 f0                	mov    %esi,%eax
+  802e00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e03:	5b                   	pop    %ebx
+  802e04:	5e                   	pop    %esi
+  802e05:	5f                   	pop    %edi
+  802e06:	5d                   	pop    %ebp
+  802e07:	c3                   	ret
+  802e08:	be 00 00 00 00       	mov    $0x0,%esi
+  802e0d:	eb ef                	jmp    802dfe <devcons_write+0x5a>
+
+00802e0f <devcons_read>:
+  802e0f:	55                   	push   %ebp
+  802e10:	89 e5                	mov    %esp,%ebp
+  802e12:	83 ec 08             	sub    $0x8,%esp
+  802e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e1a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e1e:	75 07                	jne    802e27 <devcons_read+0x18>
+  802e20:	eb 1f                	jmp    802e41 <devcons_read+0x32>
+  802e22:	e8 ba df ff ff       	call   800de1 <sys_yield>
+  802e27:	e8 36 df ff ff       	call   800d62 <sys_cgetc>
+  802e2c:	85 c0                	test   %eax,%eax
+  802e2e:	74 f2                	je     802e22 <devcons_read+0x13>
+  802e30:	78 0f                	js     802e41 <devcons_read+0x32>
+  802e32:	83 f8 04             	cmp    $0x4,%eax
+  802e35:	74 0c                	je     802e43 <devcons_read+0x34>
+  802e37:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e3a:	88 02                	mov    %al,(%edx)
+  802e3c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e41:	c9                   	leave
+  802e42:	c3                   	ret
+  802e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e48:	eb f7                	jmp    802e41 <devcons_read+0x32>
+
+00802e4a <cputchar>:
+  802e4a:	55                   	push   %ebp
+  802e4b:	89 e5                	mov    %esp,%ebp
+  802e4d:	83 ec 20             	sub    $0x20,%esp
+  802e50:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e53:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802e56:	6a 01                	push   $0x1
+  802e58:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e5b:	50                   	push   %eax
+  802e5c:	e8 e3 de ff ff       	call   800d44 <sys_cputs>
+  802e61:	83 c4 10             	add    $0x10,%esp
+  802e64:	c9                   	leave
+  802e65:	c3                   	ret
+
+00802e66 <getchar>:
+  802e66:	55                   	push   %ebp
+  802e67:	89 e5                	mov    %esp,%ebp
+  802e69:	83 ec 1c             	sub    $0x1c,%esp
+  802e6c:	6a 01                	push   $0x1
+  802e6e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e71:	50                   	push   %eax
+  802e72:	6a 00                	push   $0x0
+  802e74:	e8 fa ea ff ff       	call   801973 <read>
+  802e79:	83 c4 10             	add    $0x10,%esp
+  802e7c:	85 c0                	test   %eax,%eax
+  802e7e:	78 06                	js     802e86 <getchar+0x20>
+  802e80:	74 06                	je     802e88 <getchar+0x22>
+  802e82:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802e86:	c9                   	leave
+  802e87:	c3                   	ret
+  802e88:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802e8d:	eb f7                	jmp    802e86 <getchar+0x20>
+
+00802e8f <iscons>:
+  802e8f:	55                   	push   %ebp
+  802e90:	89 e5                	mov    %esp,%ebp
+  802e92:	83 ec 20             	sub    $0x20,%esp
+  802e95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e98:	50                   	push   %eax
+  802e99:	ff 75 08             	push   0x8(%ebp)
+  802e9c:	e8 70 e8 ff ff       	call   801711 <fd_lookup>
+  802ea1:	83 c4 10             	add    $0x10,%esp
+  802ea4:	85 c0                	test   %eax,%eax
+  802ea6:	78 11                	js     802eb9 <iscons+0x2a>
+  802ea8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eab:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802eb1:	39 10                	cmp    %edx,(%eax)
+  802eb3:	0f 94 c0             	sete   %al
+  802eb6:	0f b6 c0             	movzbl %al,%eax
+  802eb9:	c9                   	leave
+  802eba:	c3                   	ret
+
+00802ebb <opencons>:
+  802ebb:	55                   	push   %ebp
+  802ebc:	89 e5                	mov    %esp,%ebp
+  802ebe:	83 ec 24             	sub    $0x24,%esp
+  802ec1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ec4:	50                   	push   %eax
+  802ec5:	e8 f7 e7 ff ff       	call   8016c1 <fd_alloc>
+  802eca:	83 c4 10             	add    $0x10,%esp
+  802ecd:	85 c0                	test   %eax,%eax
+  802ecf:	78 3a                	js     802f0b <opencons+0x50>
+  802ed1:	83 ec 04             	sub    $0x4,%esp
+  802ed4:	68 07 04 00 00       	push   $0x407
+  802ed9:	ff 75 f4             	push   -0xc(%ebp)
+  802edc:	6a 00                	push   $0x0
+  802ede:	e8 49 df ff ff       	call   800e2c <sys_page_alloc>
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	85 c0                	test   %eax,%eax
+  802ee8:	78 21                	js     802f0b <opencons+0x50>
+  802eea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eed:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802ef3:	89 10                	mov    %edx,(%eax)
+  802ef5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ef8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802eff:	83 ec 0c             	sub    $0xc,%esp
+  802f02:	50                   	push   %eax
+  802f03:	e8 92 e7 ff ff       	call   80169a <fd2num>
+  802f08:	83 c4 10             	add    $0x10,%esp
+  802f0b:	c9                   	leave
+  802f0c:	c3                   	ret
+
+00802f0d <ipc_recv>:
+  802f0d:	55                   	push   %ebp
+  802f0e:	89 e5                	mov    %esp,%ebp
+  802f10:	56                   	push   %esi
+  802f11:	53                   	push   %ebx
+  802f12:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f1b:	85 c0                	test   %eax,%eax
+  802f1d:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802f22:	0f 44 c2             	cmove  %edx,%eax
+  802f25:	83 ec 0c             	sub    $0xc,%esp
+  802f28:	50                   	push   %eax
+  802f29:	e8 a9 e1 ff ff       	call   8010d7 <sys_ipc_recv>
+  802f2e:	83 c4 10             	add    $0x10,%esp
+  802f31:	85 c0                	test   %eax,%eax
+  802f33:	78 2a                	js     802f5f <ipc_recv+0x52>
+  802f35:	a1 14 50 80 00       	mov    0x805014,%eax
+  802f3a:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802f40:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802f46:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f4c:	85 f6                	test   %esi,%esi
+  802f4e:	74 02                	je     802f52 <ipc_recv+0x45>
+  802f50:	89 0e                	mov    %ecx,(%esi)
+  802f52:	85 db                	test   %ebx,%ebx
+  802f54:	74 02                	je     802f58 <ipc_recv+0x4b>
+  802f56:	89 13                	mov    %edx,(%ebx)
+  802f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f5b:	5b                   	pop    %ebx
+  802f5c:	5e                   	pop    %esi
+  802f5d:	5d                   	pop    %ebp
+  802f5e:	c3                   	ret
+  802f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f69:	eb e1                	jmp    802f4c <ipc_recv+0x3f>
+
+00802f6b <ipc_send>:
+  802f6b:	55                   	push   %ebp
+  802f6c:	89 e5                	mov    %esp,%ebp
+  802f6e:	57                   	push   %edi
+  802f6f:	56                   	push   %esi
+  802f70:	53                   	push   %ebx
+  802f71:	83 ec 0c             	sub    $0xc,%esp
+  802f74:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802f77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f7a:	8b 75 14             	mov    0x14(%ebp),%esi
+  802f7d:	85 db                	test   %ebx,%ebx
+  802f7f:	74 1e                	je     802f9f <ipc_send+0x34>
+  802f81:	56                   	push   %esi
+  802f82:	53                   	push   %ebx
+  802f83:	57                   	push   %edi
+  802f84:	ff 75 08             	push   0x8(%ebp)
+  802f87:	e8 d8 e1 ff ff       	call   801164 <sys_ipc_send>
+  802f8c:	83 c4 10             	add    $0x10,%esp
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	74 2a                	je     802fbd <ipc_send+0x52>
+  802f93:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f96:	75 13                	jne    802fab <ipc_send+0x40>
+  802f98:	e8 44 de ff ff       	call   800de1 <sys_yield>
+  802f9d:	eb e2                	jmp    802f81 <ipc_send+0x16>
+  802f9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa4:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802fa9:	eb d6                	jmp    802f81 <ipc_send+0x16>
+  802fab:	50                   	push   %eax
+  802fac:	68 b4 38 80 00       	push   $0x8038b4
+  802fb1:	6a 4f                	push   $0x4f
+  802fb3:	68 f7 38 80 00       	push   $0x8038f7
+  802fb8:	e8 3d d2 ff ff       	call   8001fa <_panic>
+  802fbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fc0:	5b                   	pop    %ebx
+  802fc1:	5e                   	pop    %esi
+  802fc2:	5f                   	pop    %edi
+  802fc3:	5d                   	pop    %ebp
+  802fc4:	c3                   	ret
+
+00802fc5 <ipc_call>:
+  802fc5:	55                   	push   %ebp
+  802fc6:	89 e5                	mov    %esp,%ebp
+  802fc8:	57                   	push   %edi
+  802fc9:	56                   	push   %esi
+  802fca:	53                   	push   %ebx
+  802fcb:	83 ec 0c             	sub    $0xc,%esp
+  802fce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fd2:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802fd7:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802fdb:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802fdf:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802fe4:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802fe8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ff1:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802ff5:	eb 05                	jmp    802ffc <ipc_call+0x37>
+  802ff7:	e8 e5 dd ff ff       	call   800de1 <sys_yield>
+  802ffc:	83 ec 0c             	sub    $0xc,%esp
+  802fff:	56                   	push   %esi
+  803000:	53                   	push   %ebx
+  803001:	57                   	push   %edi
+  803002:	ff 75 0c             	push   0xc(%ebp)
+  803005:	ff 75 08             	push   0x8(%ebp)
+  803008:	e8 a7 e1 ff ff       	call   8011b4 <sys_ipc_call>
+  80300d:	83 c4 20             	add    $0x20,%esp
+  803010:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803013:	74 e2                	je     802ff7 <ipc_call+0x32>
+  803015:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803018:	74 2d                	je     803047 <ipc_call+0x82>
+  80301a:	85 c0                	test   %eax,%eax
+  80301c:	78 4f                	js     80306d <ipc_call+0xa8>
+  80301e:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803022:	74 10                	je     803034 <ipc_call+0x6f>
+  803024:	a1 14 50 80 00       	mov    0x805014,%eax
+  803029:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80302f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803032:	89 02                	mov    %eax,(%edx)
+  803034:	a1 14 50 80 00       	mov    0x805014,%eax
+  803039:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80303f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803042:	5b                   	pop    %ebx
+  803043:	5e                   	pop    %esi
+  803044:	5f                   	pop    %edi
+  803045:	5d                   	pop    %ebp
+  803046:	c3                   	ret
+  803047:	ff 75 14             	push   0x14(%ebp)
+  80304a:	ff 75 10             	push   0x10(%ebp)
+  80304d:	ff 75 0c             	push   0xc(%ebp)
+  803050:	ff 75 08             	push   0x8(%ebp)
+  803053:	e8 13 ff ff ff       	call   802f6b <ipc_send>
+  803058:	83 c4 0c             	add    $0xc,%esp
+  80305b:	ff 75 1c             	push   0x1c(%ebp)
+  80305e:	ff 75 18             	push   0x18(%ebp)
+  803061:	6a 00                	push   $0x0
+  803063:	e8 a5 fe ff ff       	call   802f0d <ipc_recv>
+  803068:	83 c4 10             	add    $0x10,%esp
+  80306b:	eb d2                	jmp    80303f <ipc_call+0x7a>
+  80306d:	50                   	push   %eax
+  80306e:	68 01 39 80 00       	push   $0x803901
+  803073:	6a 6d                	push   $0x6d
+  803075:	68 f7 38 80 00       	push   $0x8038f7
+  80307a:	e8 7b d1 ff ff       	call   8001fa <_panic>
+
+0080307f <ipc_reply_recv>:
+  80307f:	55                   	push   %ebp
+  803080:	89 e5                	mov    %esp,%ebp
+  803082:	57                   	push   %edi
+  803083:	56                   	push   %esi
+  803084:	53                   	push   %ebx
+  803085:	83 ec 0c             	sub    $0xc,%esp
+  803088:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80308b:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  80308e:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803091:	85 db                	test   %ebx,%ebx
+  803093:	0f 84 ac 00 00 00    	je     803145 <ipc_reply_recv+0xc6>
+  803099:	85 f6                	test   %esi,%esi
+  80309b:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8030a0:	0f 45 c6             	cmovne %esi,%eax
+  8030a3:	83 ec 0c             	sub    $0xc,%esp
+  8030a6:	50                   	push   %eax
+  8030a7:	ff 75 14             	push   0x14(%ebp)
+  8030aa:	53                   	push   %ebx
+  8030ab:	ff 75 0c             	push   0xc(%ebp)
+  8030ae:	ff 75 08             	push   0x8(%ebp)
+  8030b1:	e8 1f e1 ff ff       	call   8011d5 <sys_ipc_reply_recv>
+  8030b6:	83 c4 20             	add    $0x20,%esp
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	78 3a                	js     8030f7 <ipc_reply_recv+0x78>
+  8030bd:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8030c1:	74 10                	je     8030d3 <ipc_reply_recv+0x54>
+  8030c3:	a1 14 50 80 00       	mov    0x805014,%eax
+  8030c8:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8030ce:	8b 55 18             	mov    0x18(%ebp),%edx
+  8030d1:	89 02                	mov    %eax,(%edx)
+  8030d3:	85 ff                	test   %edi,%edi
+  8030d5:	74 0d                	je     8030e4 <ipc_reply_recv+0x65>
+  8030d7:	a1 14 50 80 00       	mov    0x805014,%eax
+  8030dc:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8030e2:	89 07                	mov    %eax,(%edi)
+  8030e4:	a1 14 50 80 00       	mov    0x805014,%eax
+  8030e9:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8030ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f2:	5b                   	pop    %ebx
+  8030f3:	5e                   	pop    %esi
+  8030f4:	5f                   	pop    %edi
+  8030f5:	5d                   	pop    %ebp
+  8030f6:	c3                   	ret
+  8030f7:	ff 75 14             	push   0x14(%ebp)
+  8030fa:	53                   	push   %ebx
+  8030fb:	ff 75 0c             	push   0xc(%ebp)
+  8030fe:	ff 75 08             	push   0x8(%ebp)
+  803101:	e8 81 df ff ff       	call   801087 <sys_ipc_try_send>
+  803106:	89 c2                	mov    %eax,%edx
+  803108:	c1 ea 1f             	shr    $0x1f,%edx
+  80310b:	83 c4 10             	add    $0x10,%esp
+  80310e:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803111:	0f 95 c1             	setne  %cl
+  803114:	84 d1                	test   %dl,%cl
+  803116:	74 05                	je     80311d <ipc_reply_recv+0x9e>
+  803118:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80311b:	75 12                	jne    80312f <ipc_reply_recv+0xb0>
+  80311d:	83 ec 04             	sub    $0x4,%esp
+  803120:	57                   	push   %edi
+  803121:	56                   	push   %esi
+  803122:	ff 75 18             	push   0x18(%ebp)
+  803125:	e8 e3 fd ff ff       	call   802f0d <ipc_recv>
+  80312a:	83 c4 10             	add    $0x10,%esp
+  80312d:	eb c0                	jmp    8030ef <ipc_reply_recv+0x70>
+  80312f:	83 ec 04             	sub    $0x4,%esp
+  803132:	50                   	push   %eax
+  803133:	ff 75 08             	push   0x8(%ebp)
+  803136:	68 d4 38 80 00       	push   $0x8038d4
+  80313b:	e8 95 d1 ff ff       	call   8002d5 <cprintf>
+  803140:	83 c4 10             	add    $0x10,%esp
+  803143:	eb d8                	jmp    80311d <ipc_reply_recv+0x9e>
+  803145:	85 f6                	test   %esi,%esi
+  803147:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80314c:	0f 45 c6             	cmovne %esi,%eax
+  80314f:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803154:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80315b:	e9 43 ff ff ff       	jmp    8030a3 <ipc_reply_recv+0x24>
+
+00803160 <ipc_find_env>:
+  803160:	55                   	push   %ebp
+  803161:	89 e5                	mov    %esp,%ebp
+  803163:	83 ec 14             	sub    $0x14,%esp
+  803166:	ff 75 08             	push   0x8(%ebp)
+  803169:	e8 b7 de ff ff       	call   801025 <sys_env_service>
+  80316e:	85 c0                	test   %eax,%eax
+  803170:	ba 00 00 00 00       	mov    $0x0,%edx
+  803175:	0f 48 c2             	cmovs  %edx,%eax
+  803178:	c9                   	leave
+  803179:	c3                   	ret
+
+0080317a <pageref>:
+  80317a:	55                   	push   %ebp
+  80317b:	89 e5                	mov    %esp,%ebp
+  80317d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803180:	89 c2                	mov    %eax,%edx
+  803182:	c1 ea 16             	shr    $0x16,%edx
+  803185:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80318c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803191:	f6 c1 01             	test   $0x1,%cl
+  803194:	74 22                	je     8031b8 <pageref+0x3e>
+  803196:	c1 e8 0c             	shr    $0xc,%eax
+  803199:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031a0:	a8 01                	test   $0x1,%al
+  8031a2:	74 14                	je     8031b8 <pageref+0x3e>
+  8031a4:	c1 e8 0c             	shr    $0xc,%eax
+  8031a7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8031aa:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8031b1:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8031b5:	0f b7 d2             	movzwl %dx,%edx
+  8031b8:	89 d0                	mov    %edx,%eax
+  8031ba:	5d                   	pop    %ebp
+  8031bb:	c3                   	ret
+
+008031bc <__udivmoddi4>:
+  8031bc:	55                   	push   %ebp
+  8031bd:	57                   	push   %edi
+  8031be:	56                   	push   %esi
+  8031bf:	53                   	push   %ebx
+  8031c0:	83 ec 24             	sub    $0x24,%esp
+  8031c3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8031c7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8031cb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8031cf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8031d3:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8031d7:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8031db:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8031df:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8031e3:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8031e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031f1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8031f6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8031fd:	00 
+  8031fe:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803205:	00 
+  803206:	89 fb                	mov    %edi,%ebx
+  803208:	eb 08                	jmp    803212 <__udivmoddi4+0x56>
+  80320a:	83 e9 01             	sub    $0x1,%ecx
+  80320d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803210:	74 68                	je     80327a <__udivmoddi4+0xbe>
+  803212:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803216:	01 c0                	add    %eax,%eax
+  803218:	89 c6                	mov    %eax,%esi
+  80321a:	89 d7                	mov    %edx,%edi
+  80321c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803220:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803224:	0f ad d0             	shrd   %cl,%edx,%eax
+  803227:	d3 ea                	shr    %cl,%edx
+  803229:	f6 c1 20             	test   $0x20,%cl
+  80322c:	74 04                	je     803232 <__udivmoddi4+0x76>
+  80322e:	89 d0                	mov    %edx,%eax
+  803230:	31 d2                	xor    %edx,%edx
+  803232:	83 e0 01             	and    $0x1,%eax
+  803235:	89 04 24             	mov    %eax,(%esp)
+  803238:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80323f:	00 
+  803240:	8b 04 24             	mov    (%esp),%eax
+  803243:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803247:	09 f0                	or     %esi,%eax
+  803249:	09 fa                	or     %edi,%edx
+  80324b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80324f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803253:	39 f0                	cmp    %esi,%eax
+  803255:	89 d5                	mov    %edx,%ebp
+  803257:	19 fd                	sbb    %edi,%ebp
+  803259:	72 af                	jb     80320a <__udivmoddi4+0x4e>
+  80325b:	29 f0                	sub    %esi,%eax
+  80325d:	19 fa                	sbb    %edi,%edx
+  80325f:	89 cf                	mov    %ecx,%edi
+  803261:	c1 ef 05             	shr    $0x5,%edi
+  803264:	83 e7 01             	and    $0x1,%edi
+  803267:	89 fe                	mov    %edi,%esi
+  803269:	83 f6 01             	xor    $0x1,%esi
+  80326c:	d3 e6                	shl    %cl,%esi
+  80326e:	d3 e7                	shl    %cl,%edi
+  803270:	09 74 24 18          	or     %esi,0x18(%esp)
+  803274:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803278:	eb 90                	jmp    80320a <__udivmoddi4+0x4e>
+  80327a:	85 db                	test   %ebx,%ebx
+  80327c:	74 05                	je     803283 <__udivmoddi4+0xc7>
+  80327e:	89 03                	mov    %eax,(%ebx)
+  803280:	89 53 04             	mov    %edx,0x4(%ebx)
+  803283:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803287:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80328b:	83 c4 24             	add    $0x24,%esp
+  80328e:	5b                   	pop    %ebx
+  80328f:	5e                   	pop    %esi
+  803290:	5f                   	pop    %edi
+  803291:	5d                   	pop    %ebp
+  803292:	c3                   	ret
+
+00803293 <__udivdi3>:
+  803293:	83 ec 08             	sub    $0x8,%esp
+  803296:	6a 00                	push   $0x0
+  803298:	ff 74 24 1c          	push   0x1c(%esp)
+  80329c:	ff 74 24 1c          	push   0x1c(%esp)
+  8032a0:	ff 74 24 1c          	push   0x1c(%esp)
+  8032a4:	ff 74 24 1c          	push   0x1c(%esp)
+  8032a8:	e8 0f ff ff ff       	call   8031bc <__udivmoddi4>
+  8032ad:	83 c4 1c             	add    $0x1c,%esp
+  8032b0:	c3                   	ret
+
+008032b1 <__umoddi3>:
+  8032b1:	83 ec 18             	sub    $0x18,%esp
+  8032b4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8032b8:	50                   	push   %eax
+  8032b9:	ff 74 24 2c          	push   0x2c(%esp)
+  8032bd:	ff 74 24 2c          	push   0x2c(%esp)
+  8032c1:	ff 74 24 2c          	push   0x2c(%esp)
+  8032c5:	ff 74 24 2c          	push   0x2c(%esp)
+  8032c9:	e8 ee fe ff ff       	call   8031bc <__udivmoddi4>
+  8032ce:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8032d2:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8032d6:	83 c4 2c             	add    $0x2c,%esp
+  8032d9:	c3                   	ret
+
+008032da <__divdi3>:
+  8032da:	53                   	push   %ebx
+  8032db:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8032df:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8032e3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8032e7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8032eb:	85 d2                	test   %edx,%edx
+  8032ed:	78 12                	js     803301 <__divdi3+0x27>
+  8032ef:	85 db                	test   %ebx,%ebx
+  8032f1:	78 2e                	js     803321 <__divdi3+0x47>
+  8032f3:	53                   	push   %ebx
+  8032f4:	51                   	push   %ecx
+  8032f5:	52                   	push   %edx
+  8032f6:	50                   	push   %eax
+  8032f7:	e8 97 ff ff ff       	call   803293 <__udivdi3>
+  8032fc:	83 c4 10             	add    $0x10,%esp
+  8032ff:	eb 1e                	jmp    80331f <__divdi3+0x45>
+  803301:	f7 d8                	neg    %eax
+  803303:	83 d2 00             	adc    $0x0,%edx
+  803306:	f7 da                	neg    %edx
+  803308:	85 db                	test   %ebx,%ebx
+  80330a:	78 2a                	js     803336 <__divdi3+0x5c>
+  80330c:	53                   	push   %ebx
+  80330d:	51                   	push   %ecx
+  80330e:	52                   	push   %edx
+  80330f:	50                   	push   %eax
+  803310:	e8 7e ff ff ff       	call   803293 <__udivdi3>
+  803315:	83 c4 10             	add    $0x10,%esp
+  803318:	f7 d8                	neg    %eax
+  80331a:	83 d2 00             	adc    $0x0,%edx
+  80331d:	f7 da                	neg    %edx
+  80331f:	5b                   	pop    %ebx
+  803320:	c3                   	ret
+  803321:	f7 d9                	neg    %ecx
+  803323:	83 d3 00             	adc    $0x0,%ebx
+  803326:	f7 db                	neg    %ebx
+  803328:	53                   	push   %ebx
+  803329:	51                   	push   %ecx
+  80332a:	52                   	push   %edx
+  80332b:	50                   	push   %eax
+  80332c:	e8 62 ff ff ff       	call   803293 <__udivdi3>
+  803331:	83 c4 10             	add    $0x10,%esp
+  803334:	eb e2                	jmp    803318 <__divdi3+0x3e>
+  803336:	f7 d9                	neg    %ecx
+  803338:	83 d3 00             	adc    $0x0,%ebx
+  80333b:	f7 db                	neg    %ebx
+  80333d:	53                   	push   %ebx
+  80333e:	51                   	push   %ecx
+  80333f:	52                   	push   %edx
+  803340:	50                   	push   %eax
+  803341:	e8 4d ff ff ff       	call   803293 <__udivdi3>
+  803346:	83 c4 10             	add    $0x10,%esp
+  803349:	eb d4                	jmp    80331f <__divdi3+0x45>
+
+0080334b <__moddi3>:
+  80334b:	55                   	push   %ebp
+  80334c:	57                   	push   %edi
+  80334d:	56                   	push   %esi
+  80334e:	53                   	push   %ebx
+  80334f:	83 ec 0c             	sub    $0xc,%esp
+  803352:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803356:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80335a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80335e:	89 e9                	mov    %ebp,%ecx
+  803360:	f7 d9                	neg    %ecx
+  803362:	89 d0                	mov    %edx,%eax
+  803364:	83 d0 00             	adc    $0x0,%eax
+  803367:	f7 d8                	neg    %eax
+  803369:	0f 49 e9             	cmovns %ecx,%ebp
+  80336c:	0f 49 d0             	cmovns %eax,%edx
+  80336f:	52                   	push   %edx
+  803370:	55                   	push   %ebp
+  803371:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803375:	f7 da                	neg    %edx
+  803377:	89 d8                	mov    %ebx,%eax
+  803379:	83 d0 00             	adc    $0x0,%eax
+  80337c:	f7 d8                	neg    %eax
+  80337e:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803383:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803387:	0f 48 c3             	cmovs  %ebx,%eax
+  80338a:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80338e:	ff 74 24 0c          	push   0xc(%esp)
+  803392:	ff 74 24 0c          	push   0xc(%esp)
+  803396:	e8 16 ff ff ff       	call   8032b1 <__umoddi3>
+  80339b:	83 c4 10             	add    $0x10,%esp
+  80339e:	85 db                	test   %ebx,%ebx
+  8033a0:	78 08                	js     8033aa <__moddi3+0x5f>
+  8033a2:	83 c4 0c             	add    $0xc,%esp
+  8033a5:	5b                   	pop    %ebx
+  8033a6:	5e                   	pop    %esi
+  8033a7:	5f                   	pop    %edi
+  8033a8:	5d                   	pop    %ebp
+  8033a9:	c3                   	ret
+  8033aa:	f7 d8                	neg    %eax
+  8033ac:	83 d2 00             	adc    $0x0,%edx
+  8033af:	f7 da                	neg    %edx
+  8033b1:	eb ef                	jmp    8033a2 <__moddi3+0x57>
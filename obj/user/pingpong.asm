@@ -0,0 +1,5547 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	e8 32 17 00 00       	call   801773 <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 6c 1a 00 00       	call   801ac4 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 59 0c 00 00       	call   800cbb <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 d6 37 80 00       	push   $0x8037d6
+  80006a:	e8 5f 01 00 00       	call   8001ce <cprintf>
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+  800077:	83 c3 01             	add    $0x1,%ebx
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 9b 1a 00 00       	call   801b22 <ipc_send>
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+  800099:	e8 1d 0c 00 00       	call   800cbb <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 c0 37 80 00       	push   $0x8037c0
+  8000a8:	e8 21 01 00 00       	call   8001ce <cprintf>
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 67 1a 00 00       	call   801b22 <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000cb:	e8 eb 0b 00 00       	call   800cbb <sys_getenvid>
+  8000d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d5:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e0:	a3 14 50 80 00       	mov    %eax,0x805014
+  8000e5:	85 db                	test   %ebx,%ebx
+  8000e7:	7e 07                	jle    8000f0 <libmain+0x30>
+  8000e9:	8b 06                	mov    (%esi),%eax
+  8000eb:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	56                   	push   %esi
+  8000f4:	53                   	push   %ebx
+  8000f5:	e8 39 ff ff ff       	call   800033 <umain>
+  8000fa:	e8 0a 00 00 00       	call   800109 <exit>
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5d                   	pop    %ebp
+  800108:	c3                   	ret
+
+00800109 <exit>:
+  800109:	55                   	push   %ebp
+  80010a:	89 e5                	mov    %esp,%ebp
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	a1 14 50 80 00       	mov    0x805014,%eax
+  800114:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	75 14                	jne    800132 <exit+0x29>
+  80011e:	e8 d8 1d 00 00       	call   801efb <close_all>
+  800123:	83 ec 0c             	sub    $0xc,%esp
+  800126:	6a 00                	push   $0x0
+  800128:	e8 4d 0b 00 00       	call   800c7a <sys_env_destroy>
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	c9                   	leave
+  800131:	c3                   	ret
+  800132:	e8 b0 12 00 00       	call   8013e7 <sys_lease_complete>
+  800137:	eb e5                	jmp    80011e <exit+0x15>
+
+00800139 <putch>:
+  800139:	55                   	push   %ebp
+  80013a:	89 e5                	mov    %esp,%ebp
+  80013c:	53                   	push   %ebx
+  80013d:	83 ec 04             	sub    $0x4,%esp
+  800140:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800143:	8b 13                	mov    (%ebx),%edx
+  800145:	8d 42 01             	lea    0x1(%edx),%eax
+  800148:	89 03                	mov    %eax,(%ebx)
+  80014a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80014d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800151:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800156:	74 09                	je     800161 <putch+0x28>
+  800158:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80015c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80015f:	c9                   	leave
+  800160:	c3                   	ret
+  800161:	83 ec 08             	sub    $0x8,%esp
+  800164:	68 ff 00 00 00       	push   $0xff
+  800169:	8d 43 08             	lea    0x8(%ebx),%eax
+  80016c:	50                   	push   %eax
+  80016d:	e8 cb 0a 00 00       	call   800c3d <sys_cputs>
+  800172:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	eb db                	jmp    800158 <putch+0x1f>
+
+0080017d <vcprintf>:
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800186:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80018d:	00 00 00 
+  800190:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800197:	00 00 00 
+  80019a:	ff 75 0c             	push   0xc(%ebp)
+  80019d:	ff 75 08             	push   0x8(%ebp)
+  8001a0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001a6:	50                   	push   %eax
+  8001a7:	68 39 01 80 00       	push   $0x800139
+  8001ac:	e8 1c 01 00 00       	call   8002cd <vprintfmt>
+  8001b1:	83 c4 08             	add    $0x8,%esp
+  8001b4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001ba:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001c0:	50                   	push   %eax
+  8001c1:	e8 77 0a 00 00       	call   800c3d <sys_cputs>
+  8001c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001cc:	c9                   	leave
+  8001cd:	c3                   	ret
+
+008001ce <cprintf>:
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	83 ec 10             	sub    $0x10,%esp
+  8001d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001d7:	50                   	push   %eax
+  8001d8:	ff 75 08             	push   0x8(%ebp)
+  8001db:	e8 9d ff ff ff       	call   80017d <vcprintf>
+  8001e0:	c9                   	leave
+  8001e1:	c3                   	ret
+
+008001e2 <printnum>:
+  8001e2:	55                   	push   %ebp
+  8001e3:	89 e5                	mov    %esp,%ebp
+  8001e5:	57                   	push   %edi
+  8001e6:	56                   	push   %esi
+  8001e7:	53                   	push   %ebx
+  8001e8:	83 ec 1c             	sub    $0x1c,%esp
+  8001eb:	89 c3                	mov    %eax,%ebx
+  8001ed:	89 d6                	mov    %edx,%esi
+  8001ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001f5:	89 d1                	mov    %edx,%ecx
+  8001f7:	89 c2                	mov    %eax,%edx
+  8001f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  800202:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800205:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80020c:	39 c2                	cmp    %eax,%edx
+  80020e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800211:	73 4b                	jae    80025e <printnum+0x7c>
+  800213:	8b 45 14             	mov    0x14(%ebp),%eax
+  800216:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800219:	85 ff                	test   %edi,%edi
+  80021b:	7e 11                	jle    80022e <printnum+0x4c>
+  80021d:	83 ec 08             	sub    $0x8,%esp
+  800220:	56                   	push   %esi
+  800221:	ff 75 18             	push   0x18(%ebp)
+  800224:	ff d3                	call   *%ebx
+  800226:	83 c4 10             	add    $0x10,%esp
+  800229:	83 ef 01             	sub    $0x1,%edi
+  80022c:	75 ef                	jne    80021d <printnum+0x3b>
+  80022e:	83 ec 08             	sub    $0x8,%esp
+  800231:	56                   	push   %esi
+  800232:	83 ec 04             	sub    $0x4,%esp
+  800235:	ff 75 e4             	push   -0x1c(%ebp)
+  800238:	ff 75 e0             	push   -0x20(%ebp)
+  80023b:	ff 75 dc             	push   -0x24(%ebp)
+  80023e:	ff 75 d8             	push   -0x28(%ebp)
+  800241:	e8 6a 34 00 00       	call   8036b0 <__umoddi3>
+  800246:	83 c4 14             	add    $0x14,%esp
+  800249:	0f be 80 f3 37 80 00 	movsbl 0x8037f3(%eax),%eax
+  800250:	50                   	push   %eax
+  800251:	ff d3                	call   *%ebx
+  800253:	83 c4 10             	add    $0x10,%esp
+  800256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800259:	5b                   	pop    %ebx
+  80025a:	5e                   	pop    %esi
+  80025b:	5f                   	pop    %edi
+  80025c:	5d                   	pop    %ebp
+  80025d:	c3                   	ret
+  80025e:	83 ec 0c             	sub    $0xc,%esp
+  800261:	ff 75 18             	push   0x18(%ebp)
+  800264:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800267:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80026a:	52                   	push   %edx
+  80026b:	50                   	push   %eax
+  80026c:	83 ec 08             	sub    $0x8,%esp
+  80026f:	ff 75 e4             	push   -0x1c(%ebp)
+  800272:	ff 75 e0             	push   -0x20(%ebp)
+  800275:	ff 75 dc             	push   -0x24(%ebp)
+  800278:	ff 75 d8             	push   -0x28(%ebp)
+  80027b:	e8 12 34 00 00       	call   803692 <__udivdi3>
+  800280:	83 c4 18             	add    $0x18,%esp
+  800283:	52                   	push   %edx
+  800284:	50                   	push   %eax
+  800285:	89 f2                	mov    %esi,%edx
+  800287:	89 d8                	mov    %ebx,%eax
+  800289:	e8 54 ff ff ff       	call   8001e2 <printnum>
+  80028e:	83 c4 20             	add    $0x20,%esp
+  800291:	eb 9b                	jmp    80022e <printnum+0x4c>
+
+00800293 <sprintputch>:
+  800293:	55                   	push   %ebp
+  800294:	89 e5                	mov    %esp,%ebp
+  800296:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800299:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80029d:	8b 10                	mov    (%eax),%edx
+  80029f:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a2:	73 0a                	jae    8002ae <sprintputch+0x1b>
+  8002a4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002a7:	89 08                	mov    %ecx,(%eax)
+  8002a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ac:	88 02                	mov    %al,(%edx)
+  8002ae:	5d                   	pop    %ebp
+  8002af:	c3                   	ret
+
+008002b0 <printfmt>:
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	83 ec 08             	sub    $0x8,%esp
+  8002b6:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002b9:	50                   	push   %eax
+  8002ba:	ff 75 10             	push   0x10(%ebp)
+  8002bd:	ff 75 0c             	push   0xc(%ebp)
+  8002c0:	ff 75 08             	push   0x8(%ebp)
+  8002c3:	e8 05 00 00 00       	call   8002cd <vprintfmt>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+
+008002cd <vprintfmt>:
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	57                   	push   %edi
+  8002d1:	56                   	push   %esi
+  8002d2:	53                   	push   %ebx
+  8002d3:	83 ec 2c             	sub    $0x2c,%esp
+  8002d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d9:	89 df                	mov    %ebx,%edi
+  8002db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002de:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002e1:	8d 70 01             	lea    0x1(%eax),%esi
+  8002e4:	0f b6 00             	movzbl (%eax),%eax
+  8002e7:	83 f8 25             	cmp    $0x25,%eax
+  8002ea:	74 1e                	je     80030a <vprintfmt+0x3d>
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	0f 84 15 05 00 00    	je     800809 <vprintfmt+0x53c>
+  8002f4:	83 ec 08             	sub    $0x8,%esp
+  8002f7:	53                   	push   %ebx
+  8002f8:	50                   	push   %eax
+  8002f9:	ff d7                	call   *%edi
+  8002fb:	83 c6 01             	add    $0x1,%esi
+  8002fe:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800302:	83 c4 10             	add    $0x10,%esp
+  800305:	83 f8 25             	cmp    $0x25,%eax
+  800308:	75 e2                	jne    8002ec <vprintfmt+0x1f>
+  80030a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80030e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800315:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80031c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800323:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800328:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80032b:	8d 56 01             	lea    0x1(%esi),%edx
+  80032e:	0f b6 0e             	movzbl (%esi),%ecx
+  800331:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800334:	3c 55                	cmp    $0x55,%al
+  800336:	0f 87 3b 04 00 00    	ja     800777 <vprintfmt+0x4aa>
+  80033c:	0f b6 c0             	movzbl %al,%eax
+  80033f:	ff 24 85 40 39 80 00 	jmp    *0x803940(,%eax,4)
+  800346:	89 75 10             	mov    %esi,0x10(%ebp)
+  800349:	eb 93                	jmp    8002de <vprintfmt+0x11>
+  80034b:	89 d6                	mov    %edx,%esi
+  80034d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800351:	eb d8                	jmp    80032b <vprintfmt+0x5e>
+  800353:	89 d6                	mov    %edx,%esi
+  800355:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800359:	eb d0                	jmp    80032b <vprintfmt+0x5e>
+  80035b:	0f b6 c9             	movzbl %cl,%ecx
+  80035e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800361:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800364:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800368:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80036b:	83 f9 09             	cmp    $0x9,%ecx
+  80036e:	77 6f                	ja     8003df <vprintfmt+0x112>
+  800370:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800373:	83 c2 01             	add    $0x1,%edx
+  800376:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800379:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80037d:	0f be 02             	movsbl (%edx),%eax
+  800380:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800383:	83 fe 09             	cmp    $0x9,%esi
+  800386:	76 eb                	jbe    800373 <vprintfmt+0xa6>
+  800388:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80038b:	89 d6                	mov    %edx,%esi
+  80038d:	eb 13                	jmp    8003a2 <vprintfmt+0xd5>
+  80038f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800392:	8b 00                	mov    (%eax),%eax
+  800394:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800397:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039a:	8d 40 04             	lea    0x4(%eax),%eax
+  80039d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003a0:	89 d6                	mov    %edx,%esi
+  8003a2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003a6:	79 83                	jns    80032b <vprintfmt+0x5e>
+  8003a8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ae:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003b5:	e9 71 ff ff ff       	jmp    80032b <vprintfmt+0x5e>
+  8003ba:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003bd:	85 c9                	test   %ecx,%ecx
+  8003bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c4:	0f 49 c1             	cmovns %ecx,%eax
+  8003c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ca:	89 d6                	mov    %edx,%esi
+  8003cc:	e9 5a ff ff ff       	jmp    80032b <vprintfmt+0x5e>
+  8003d1:	89 d6                	mov    %edx,%esi
+  8003d3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003da:	e9 4c ff ff ff       	jmp    80032b <vprintfmt+0x5e>
+  8003df:	89 d6                	mov    %edx,%esi
+  8003e1:	eb bf                	jmp    8003a2 <vprintfmt+0xd5>
+  8003e3:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8003e7:	89 d6                	mov    %edx,%esi
+  8003e9:	e9 3d ff ff ff       	jmp    80032b <vprintfmt+0x5e>
+  8003ee:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f4:	8d 70 04             	lea    0x4(%eax),%esi
+  8003f7:	83 ec 08             	sub    $0x8,%esp
+  8003fa:	53                   	push   %ebx
+  8003fb:	ff 30                	push   (%eax)
+  8003fd:	ff d7                	call   *%edi
+  8003ff:	83 c4 10             	add    $0x10,%esp
+  800402:	89 75 14             	mov    %esi,0x14(%ebp)
+  800405:	e9 d4 fe ff ff       	jmp    8002de <vprintfmt+0x11>
+  80040a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80040d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800410:	8d 70 04             	lea    0x4(%eax),%esi
+  800413:	8b 10                	mov    (%eax),%edx
+  800415:	89 d0                	mov    %edx,%eax
+  800417:	f7 d8                	neg    %eax
+  800419:	0f 48 c2             	cmovs  %edx,%eax
+  80041c:	83 f8 12             	cmp    $0x12,%eax
+  80041f:	7f 23                	jg     800444 <vprintfmt+0x177>
+  800421:	8b 14 85 a0 3a 80 00 	mov    0x803aa0(,%eax,4),%edx
+  800428:	85 d2                	test   %edx,%edx
+  80042a:	74 18                	je     800444 <vprintfmt+0x177>
+  80042c:	52                   	push   %edx
+  80042d:	68 4f 3d 80 00       	push   $0x803d4f
+  800432:	53                   	push   %ebx
+  800433:	57                   	push   %edi
+  800434:	e8 77 fe ff ff       	call   8002b0 <printfmt>
+  800439:	83 c4 10             	add    $0x10,%esp
+  80043c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80043f:	e9 9a fe ff ff       	jmp    8002de <vprintfmt+0x11>
+  800444:	50                   	push   %eax
+  800445:	68 0b 38 80 00       	push   $0x80380b
+  80044a:	53                   	push   %ebx
+  80044b:	57                   	push   %edi
+  80044c:	e8 5f fe ff ff       	call   8002b0 <printfmt>
+  800451:	83 c4 10             	add    $0x10,%esp
+  800454:	89 75 14             	mov    %esi,0x14(%ebp)
+  800457:	e9 82 fe ff ff       	jmp    8002de <vprintfmt+0x11>
+  80045c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80045f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800462:	83 c0 04             	add    $0x4,%eax
+  800465:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800468:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046b:	8b 00                	mov    (%eax),%eax
+  80046d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800470:	85 c0                	test   %eax,%eax
+  800472:	0f 84 61 03 00 00    	je     8007d9 <vprintfmt+0x50c>
+  800478:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80047c:	7e 06                	jle    800484 <vprintfmt+0x1b7>
+  80047e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800482:	75 29                	jne    8004ad <vprintfmt+0x1e0>
+  800484:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800487:	8d 70 01             	lea    0x1(%eax),%esi
+  80048a:	0f b6 00             	movzbl (%eax),%eax
+  80048d:	0f be d0             	movsbl %al,%edx
+  800490:	85 d2                	test   %edx,%edx
+  800492:	0f 84 bb 00 00 00    	je     800553 <vprintfmt+0x286>
+  800498:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80049b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80049e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004a1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004a4:	eb 7a                	jmp    800520 <vprintfmt+0x253>
+  8004a6:	c7 45 d0 04 38 80 00 	movl   $0x803804,-0x30(%ebp)
+  8004ad:	83 ec 08             	sub    $0x8,%esp
+  8004b0:	ff 75 d4             	push   -0x2c(%ebp)
+  8004b3:	ff 75 d0             	push   -0x30(%ebp)
+  8004b6:	e8 e0 03 00 00       	call   80089b <strnlen>
+  8004bb:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004be:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	85 d2                	test   %edx,%edx
+  8004c6:	0f 8e d6 02 00 00    	jle    8007a2 <vprintfmt+0x4d5>
+  8004cc:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004d0:	83 ec 08             	sub    $0x8,%esp
+  8004d3:	53                   	push   %ebx
+  8004d4:	56                   	push   %esi
+  8004d5:	ff d7                	call   *%edi
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004de:	75 f0                	jne    8004d0 <vprintfmt+0x203>
+  8004e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004e3:	8d 70 01             	lea    0x1(%eax),%esi
+  8004e6:	0f b6 00             	movzbl (%eax),%eax
+  8004e9:	0f be d0             	movsbl %al,%edx
+  8004ec:	85 d2                	test   %edx,%edx
+  8004ee:	0f 84 da 02 00 00    	je     8007ce <vprintfmt+0x501>
+  8004f4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004f7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004fa:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004fd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800500:	eb 1e                	jmp    800520 <vprintfmt+0x253>
+  800502:	83 ec 08             	sub    $0x8,%esp
+  800505:	ff 75 0c             	push   0xc(%ebp)
+  800508:	52                   	push   %edx
+  800509:	ff 55 08             	call   *0x8(%ebp)
+  80050c:	83 c4 10             	add    $0x10,%esp
+  80050f:	83 eb 01             	sub    $0x1,%ebx
+  800512:	83 c6 01             	add    $0x1,%esi
+  800515:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800519:	0f be d0             	movsbl %al,%edx
+  80051c:	85 d2                	test   %edx,%edx
+  80051e:	74 2a                	je     80054a <vprintfmt+0x27d>
+  800520:	85 ff                	test   %edi,%edi
+  800522:	78 05                	js     800529 <vprintfmt+0x25c>
+  800524:	83 ef 01             	sub    $0x1,%edi
+  800527:	78 59                	js     800582 <vprintfmt+0x2b5>
+  800529:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80052d:	74 d3                	je     800502 <vprintfmt+0x235>
+  80052f:	0f be c0             	movsbl %al,%eax
+  800532:	83 e8 20             	sub    $0x20,%eax
+  800535:	83 f8 5e             	cmp    $0x5e,%eax
+  800538:	76 c8                	jbe    800502 <vprintfmt+0x235>
+  80053a:	83 ec 08             	sub    $0x8,%esp
+  80053d:	ff 75 0c             	push   0xc(%ebp)
+  800540:	6a 3f                	push   $0x3f
+  800542:	ff 55 08             	call   *0x8(%ebp)
+  800545:	83 c4 10             	add    $0x10,%esp
+  800548:	eb c5                	jmp    80050f <vprintfmt+0x242>
+  80054a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80054d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800550:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800553:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800556:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80055a:	7e 1b                	jle    800577 <vprintfmt+0x2aa>
+  80055c:	83 ec 08             	sub    $0x8,%esp
+  80055f:	53                   	push   %ebx
+  800560:	6a 20                	push   $0x20
+  800562:	ff d7                	call   *%edi
+  800564:	83 c4 10             	add    $0x10,%esp
+  800567:	83 ee 01             	sub    $0x1,%esi
+  80056a:	75 f0                	jne    80055c <vprintfmt+0x28f>
+  80056c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80056f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800572:	e9 67 fd ff ff       	jmp    8002de <vprintfmt+0x11>
+  800577:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80057a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057d:	e9 5c fd ff ff       	jmp    8002de <vprintfmt+0x11>
+  800582:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800585:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800588:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80058b:	eb c6                	jmp    800553 <vprintfmt+0x286>
+  80058d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800590:	89 55 10             	mov    %edx,0x10(%ebp)
+  800593:	83 f9 01             	cmp    $0x1,%ecx
+  800596:	7f 1f                	jg     8005b7 <vprintfmt+0x2ea>
+  800598:	85 c9                	test   %ecx,%ecx
+  80059a:	74 67                	je     800603 <vprintfmt+0x336>
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8b 30                	mov    (%eax),%esi
+  8005a1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005a4:	89 f0                	mov    %esi,%eax
+  8005a6:	c1 f8 1f             	sar    $0x1f,%eax
+  8005a9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b5:	eb 17                	jmp    8005ce <vprintfmt+0x301>
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	8b 50 04             	mov    0x4(%eax),%edx
+  8005bd:	8b 00                	mov    (%eax),%eax
+  8005bf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8005cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ce:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005d9:	85 c9                	test   %ecx,%ecx
+  8005db:	0f 89 12 01 00 00    	jns    8006f3 <vprintfmt+0x426>
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 2d                	push   $0x2d
+  8005e7:	ff d7                	call   *%edi
+  8005e9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ec:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ef:	f7 da                	neg    %edx
+  8005f1:	83 d1 00             	adc    $0x0,%ecx
+  8005f4:	f7 d9                	neg    %ecx
+  8005f6:	83 c4 10             	add    $0x10,%esp
+  8005f9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005fe:	e9 f0 00 00 00       	jmp    8006f3 <vprintfmt+0x426>
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 30                	mov    (%eax),%esi
+  800608:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80060b:	89 f0                	mov    %esi,%eax
+  80060d:	c1 f8 1f             	sar    $0x1f,%eax
+  800610:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8d 40 04             	lea    0x4(%eax),%eax
+  800619:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061c:	eb b0                	jmp    8005ce <vprintfmt+0x301>
+  80061e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800621:	89 55 10             	mov    %edx,0x10(%ebp)
+  800624:	83 f9 01             	cmp    $0x1,%ecx
+  800627:	7f 1e                	jg     800647 <vprintfmt+0x37a>
+  800629:	85 c9                	test   %ecx,%ecx
+  80062b:	74 32                	je     80065f <vprintfmt+0x392>
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800642:	e9 ac 00 00 00       	jmp    8006f3 <vprintfmt+0x426>
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 10                	mov    (%eax),%edx
+  80064c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064f:	8d 40 08             	lea    0x8(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+  800655:	be 0a 00 00 00       	mov    $0xa,%esi
+  80065a:	e9 94 00 00 00       	jmp    8006f3 <vprintfmt+0x426>
+  80065f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800662:	8b 10                	mov    (%eax),%edx
+  800664:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800669:	8d 40 04             	lea    0x4(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800674:	eb 7d                	jmp    8006f3 <vprintfmt+0x426>
+  800676:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800679:	89 55 10             	mov    %edx,0x10(%ebp)
+  80067c:	83 f9 01             	cmp    $0x1,%ecx
+  80067f:	7f 1b                	jg     80069c <vprintfmt+0x3cf>
+  800681:	85 c9                	test   %ecx,%ecx
+  800683:	74 2c                	je     8006b1 <vprintfmt+0x3e4>
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 10                	mov    (%eax),%edx
+  80068a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068f:	8d 40 04             	lea    0x4(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+  800695:	be 08 00 00 00       	mov    $0x8,%esi
+  80069a:	eb 57                	jmp    8006f3 <vprintfmt+0x426>
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006aa:	be 08 00 00 00       	mov    $0x8,%esi
+  8006af:	eb 42                	jmp    8006f3 <vprintfmt+0x426>
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 10                	mov    (%eax),%edx
+  8006b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c1:	be 08 00 00 00       	mov    $0x8,%esi
+  8006c6:	eb 2b                	jmp    8006f3 <vprintfmt+0x426>
+  8006c8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+  8006ce:	53                   	push   %ebx
+  8006cf:	6a 30                	push   $0x30
+  8006d1:	ff d7                	call   *%edi
+  8006d3:	83 c4 08             	add    $0x8,%esp
+  8006d6:	53                   	push   %ebx
+  8006d7:	6a 78                	push   $0x78
+  8006d9:	ff d7                	call   *%edi
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 10                	mov    (%eax),%edx
+  8006e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e5:	83 c4 10             	add    $0x10,%esp
+  8006e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ee:	be 10 00 00 00       	mov    $0x10,%esi
+  8006f3:	83 ec 0c             	sub    $0xc,%esp
+  8006f6:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006fa:	50                   	push   %eax
+  8006fb:	ff 75 e4             	push   -0x1c(%ebp)
+  8006fe:	56                   	push   %esi
+  8006ff:	51                   	push   %ecx
+  800700:	52                   	push   %edx
+  800701:	89 da                	mov    %ebx,%edx
+  800703:	89 f8                	mov    %edi,%eax
+  800705:	e8 d8 fa ff ff       	call   8001e2 <printnum>
+  80070a:	83 c4 20             	add    $0x20,%esp
+  80070d:	e9 cc fb ff ff       	jmp    8002de <vprintfmt+0x11>
+  800712:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800715:	89 55 10             	mov    %edx,0x10(%ebp)
+  800718:	83 f9 01             	cmp    $0x1,%ecx
+  80071b:	7f 1b                	jg     800738 <vprintfmt+0x46b>
+  80071d:	85 c9                	test   %ecx,%ecx
+  80071f:	74 2c                	je     80074d <vprintfmt+0x480>
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072b:	8d 40 04             	lea    0x4(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800731:	be 10 00 00 00       	mov    $0x10,%esi
+  800736:	eb bb                	jmp    8006f3 <vprintfmt+0x426>
+  800738:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073b:	8b 10                	mov    (%eax),%edx
+  80073d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800740:	8d 40 08             	lea    0x8(%eax),%eax
+  800743:	89 45 14             	mov    %eax,0x14(%ebp)
+  800746:	be 10 00 00 00       	mov    $0x10,%esi
+  80074b:	eb a6                	jmp    8006f3 <vprintfmt+0x426>
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 10                	mov    (%eax),%edx
+  800752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800757:	8d 40 04             	lea    0x4(%eax),%eax
+  80075a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075d:	be 10 00 00 00       	mov    $0x10,%esi
+  800762:	eb 8f                	jmp    8006f3 <vprintfmt+0x426>
+  800764:	89 55 10             	mov    %edx,0x10(%ebp)
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	53                   	push   %ebx
+  80076b:	6a 25                	push   $0x25
+  80076d:	ff d7                	call   *%edi
+  80076f:	83 c4 10             	add    $0x10,%esp
+  800772:	e9 67 fb ff ff       	jmp    8002de <vprintfmt+0x11>
+  800777:	83 ec 08             	sub    $0x8,%esp
+  80077a:	53                   	push   %ebx
+  80077b:	6a 25                	push   $0x25
+  80077d:	ff d7                	call   *%edi
+  80077f:	83 c4 10             	add    $0x10,%esp
+  800782:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800786:	0f 84 ba fb ff ff    	je     800346 <vprintfmt+0x79>
+  80078c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80078f:	89 f0                	mov    %esi,%eax
+  800791:	83 e8 01             	sub    $0x1,%eax
+  800794:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800798:	75 f7                	jne    800791 <vprintfmt+0x4c4>
+  80079a:	89 45 10             	mov    %eax,0x10(%ebp)
+  80079d:	e9 3c fb ff ff       	jmp    8002de <vprintfmt+0x11>
+  8007a2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a5:	8d 70 01             	lea    0x1(%eax),%esi
+  8007a8:	0f b6 00             	movzbl (%eax),%eax
+  8007ab:	0f be d0             	movsbl %al,%edx
+  8007ae:	85 d2                	test   %edx,%edx
+  8007b0:	74 11                	je     8007c3 <vprintfmt+0x4f6>
+  8007b2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007b5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007b8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007bb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007be:	e9 5d fd ff ff       	jmp    800520 <vprintfmt+0x253>
+  8007c3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c9:	e9 10 fb ff ff       	jmp    8002de <vprintfmt+0x11>
+  8007ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d4:	e9 05 fb ff ff       	jmp    8002de <vprintfmt+0x11>
+  8007d9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007dd:	7e 0a                	jle    8007e9 <vprintfmt+0x51c>
+  8007df:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007e3:	0f 85 bd fc ff ff    	jne    8004a6 <vprintfmt+0x1d9>
+  8007e9:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007ee:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007f3:	be 05 38 80 00       	mov    $0x803805,%esi
+  8007f8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007fb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007fe:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800801:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800804:	e9 17 fd ff ff       	jmp    800520 <vprintfmt+0x253>
+  800809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80080c:	5b                   	pop    %ebx
+  80080d:	5e                   	pop    %esi
+  80080e:	5f                   	pop    %edi
+  80080f:	5d                   	pop    %ebp
+  800810:	c3                   	ret
+
+00800811 <vsnprintf>:
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	83 ec 18             	sub    $0x18,%esp
+  800817:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80081d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800820:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800824:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800827:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80082e:	85 c0                	test   %eax,%eax
+  800830:	74 26                	je     800858 <vsnprintf+0x47>
+  800832:	85 d2                	test   %edx,%edx
+  800834:	7e 22                	jle    800858 <vsnprintf+0x47>
+  800836:	ff 75 14             	push   0x14(%ebp)
+  800839:	ff 75 10             	push   0x10(%ebp)
+  80083c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80083f:	50                   	push   %eax
+  800840:	68 93 02 80 00       	push   $0x800293
+  800845:	e8 83 fa ff ff       	call   8002cd <vprintfmt>
+  80084a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80084d:	c6 00 00             	movb   $0x0,(%eax)
+  800850:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	c9                   	leave
+  800857:	c3                   	ret
+  800858:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80085d:	eb f7                	jmp    800856 <vsnprintf+0x45>
+
+0080085f <snprintf>:
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	83 ec 08             	sub    $0x8,%esp
+  800865:	8d 45 14             	lea    0x14(%ebp),%eax
+  800868:	50                   	push   %eax
+  800869:	ff 75 10             	push   0x10(%ebp)
+  80086c:	ff 75 0c             	push   0xc(%ebp)
+  80086f:	ff 75 08             	push   0x8(%ebp)
+  800872:	e8 9a ff ff ff       	call   800811 <vsnprintf>
+  800877:	c9                   	leave
+  800878:	c3                   	ret
+
+00800879 <strlen>:
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80087f:	80 3a 00             	cmpb   $0x0,(%edx)
+  800882:	74 10                	je     800894 <strlen+0x1b>
+  800884:	b8 00 00 00 00       	mov    $0x0,%eax
+  800889:	83 c0 01             	add    $0x1,%eax
+  80088c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800890:	75 f7                	jne    800889 <strlen+0x10>
+  800892:	5d                   	pop    %ebp
+  800893:	c3                   	ret
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+  800899:	eb f7                	jmp    800892 <strlen+0x19>
+
+0080089b <strnlen>:
+  80089b:	55                   	push   %ebp
+  80089c:	89 e5                	mov    %esp,%ebp
+  80089e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a4:	85 d2                	test   %edx,%edx
+  8008a6:	74 16                	je     8008be <strnlen+0x23>
+  8008a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ad:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b1:	74 09                	je     8008bc <strnlen+0x21>
+  8008b3:	83 c0 01             	add    $0x1,%eax
+  8008b6:	39 d0                	cmp    %edx,%eax
+  8008b8:	75 f3                	jne    8008ad <strnlen+0x12>
+  8008ba:	89 d0                	mov    %edx,%eax
+  8008bc:	5d                   	pop    %ebp
+  8008bd:	c3                   	ret
+  8008be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c3:	eb f7                	jmp    8008bc <strnlen+0x21>
+
+008008c5 <strcpy>:
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	53                   	push   %ebx
+  8008c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008db:	83 c0 01             	add    $0x1,%eax
+  8008de:	84 d2                	test   %dl,%dl
+  8008e0:	75 f2                	jne    8008d4 <strcpy+0xf>
+  8008e2:	89 c8                	mov    %ecx,%eax
+  8008e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+
+008008e9 <strcat>:
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	53                   	push   %ebx
+  8008ed:	83 ec 10             	sub    $0x10,%esp
+  8008f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008f3:	53                   	push   %ebx
+  8008f4:	e8 80 ff ff ff       	call   800879 <strlen>
+  8008f9:	83 c4 08             	add    $0x8,%esp
+  8008fc:	ff 75 0c             	push   0xc(%ebp)
+  8008ff:	01 d8                	add    %ebx,%eax
+  800901:	50                   	push   %eax
+  800902:	e8 be ff ff ff       	call   8008c5 <strcpy>
+  800907:	89 d8                	mov    %ebx,%eax
+  800909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+0080090e <strncpy>:
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	56                   	push   %esi
+  800912:	53                   	push   %ebx
+  800913:	8b 75 08             	mov    0x8(%ebp),%esi
+  800916:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800919:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80091c:	85 db                	test   %ebx,%ebx
+  80091e:	74 17                	je     800937 <strncpy+0x29>
+  800920:	01 f3                	add    %esi,%ebx
+  800922:	89 f0                	mov    %esi,%eax
+  800924:	83 c0 01             	add    $0x1,%eax
+  800927:	0f b6 0a             	movzbl (%edx),%ecx
+  80092a:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80092d:	80 f9 01             	cmp    $0x1,%cl
+  800930:	83 da ff             	sbb    $0xffffffff,%edx
+  800933:	39 c3                	cmp    %eax,%ebx
+  800935:	75 ed                	jne    800924 <strncpy+0x16>
+  800937:	89 f0                	mov    %esi,%eax
+  800939:	5b                   	pop    %ebx
+  80093a:	5e                   	pop    %esi
+  80093b:	5d                   	pop    %ebp
+  80093c:	c3                   	ret
+
+0080093d <strlcpy>:
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	56                   	push   %esi
+  800941:	53                   	push   %ebx
+  800942:	8b 75 08             	mov    0x8(%ebp),%esi
+  800945:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800948:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80094b:	89 f0                	mov    %esi,%eax
+  80094d:	85 db                	test   %ebx,%ebx
+  80094f:	74 1e                	je     80096f <strlcpy+0x32>
+  800951:	83 eb 01             	sub    $0x1,%ebx
+  800954:	74 16                	je     80096c <strlcpy+0x2f>
+  800956:	01 f3                	add    %esi,%ebx
+  800958:	0f b6 0a             	movzbl (%edx),%ecx
+  80095b:	84 c9                	test   %cl,%cl
+  80095d:	74 0d                	je     80096c <strlcpy+0x2f>
+  80095f:	83 c2 01             	add    $0x1,%edx
+  800962:	83 c0 01             	add    $0x1,%eax
+  800965:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800968:	39 d8                	cmp    %ebx,%eax
+  80096a:	75 ec                	jne    800958 <strlcpy+0x1b>
+  80096c:	c6 00 00             	movb   $0x0,(%eax)
+  80096f:	29 f0                	sub    %esi,%eax
+  800971:	5b                   	pop    %ebx
+  800972:	5e                   	pop    %esi
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+
+00800975 <strcmp>:
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80097b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80097e:	0f b6 01             	movzbl (%ecx),%eax
+  800981:	84 c0                	test   %al,%al
+  800983:	74 11                	je     800996 <strcmp+0x21>
+  800985:	38 02                	cmp    %al,(%edx)
+  800987:	75 0d                	jne    800996 <strcmp+0x21>
+  800989:	83 c1 01             	add    $0x1,%ecx
+  80098c:	83 c2 01             	add    $0x1,%edx
+  80098f:	0f b6 01             	movzbl (%ecx),%eax
+  800992:	84 c0                	test   %al,%al
+  800994:	75 ef                	jne    800985 <strcmp+0x10>
+  800996:	0f b6 c0             	movzbl %al,%eax
+  800999:	0f b6 12             	movzbl (%edx),%edx
+  80099c:	29 d0                	sub    %edx,%eax
+  80099e:	5d                   	pop    %ebp
+  80099f:	c3                   	ret
+
+008009a0 <strncmp>:
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	53                   	push   %ebx
+  8009a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009aa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b2:	85 d2                	test   %edx,%edx
+  8009b4:	74 2e                	je     8009e4 <strncmp+0x44>
+  8009b6:	0f b6 01             	movzbl (%ecx),%eax
+  8009b9:	84 c0                	test   %al,%al
+  8009bb:	74 16                	je     8009d3 <strncmp+0x33>
+  8009bd:	3a 03                	cmp    (%ebx),%al
+  8009bf:	75 12                	jne    8009d3 <strncmp+0x33>
+  8009c1:	83 c1 01             	add    $0x1,%ecx
+  8009c4:	83 c3 01             	add    $0x1,%ebx
+  8009c7:	83 ea 01             	sub    $0x1,%edx
+  8009ca:	75 ea                	jne    8009b6 <strncmp+0x16>
+  8009cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d1:	eb 11                	jmp    8009e4 <strncmp+0x44>
+  8009d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d8:	85 d2                	test   %edx,%edx
+  8009da:	74 08                	je     8009e4 <strncmp+0x44>
+  8009dc:	0f b6 01             	movzbl (%ecx),%eax
+  8009df:	0f b6 13             	movzbl (%ebx),%edx
+  8009e2:	29 d0                	sub    %edx,%eax
+  8009e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009e7:	c9                   	leave
+  8009e8:	c3                   	ret
+
+008009e9 <strchr>:
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ef:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009f3:	0f b6 10             	movzbl (%eax),%edx
+  8009f6:	84 d2                	test   %dl,%dl
+  8009f8:	74 15                	je     800a0f <strchr+0x26>
+  8009fa:	38 d1                	cmp    %dl,%cl
+  8009fc:	74 0f                	je     800a0d <strchr+0x24>
+  8009fe:	83 c0 01             	add    $0x1,%eax
+  800a01:	0f b6 10             	movzbl (%eax),%edx
+  800a04:	84 d2                	test   %dl,%dl
+  800a06:	75 f2                	jne    8009fa <strchr+0x11>
+  800a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0d:	5d                   	pop    %ebp
+  800a0e:	c3                   	ret
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a14:	eb f7                	jmp    800a0d <strchr+0x24>
+
+00800a16 <strfind>:
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	53                   	push   %ebx
+  800a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a20:	0f b6 18             	movzbl (%eax),%ebx
+  800a23:	38 d3                	cmp    %dl,%bl
+  800a25:	74 14                	je     800a3b <strfind+0x25>
+  800a27:	89 d1                	mov    %edx,%ecx
+  800a29:	84 db                	test   %bl,%bl
+  800a2b:	74 0e                	je     800a3b <strfind+0x25>
+  800a2d:	83 c0 01             	add    $0x1,%eax
+  800a30:	0f b6 10             	movzbl (%eax),%edx
+  800a33:	38 ca                	cmp    %cl,%dl
+  800a35:	74 04                	je     800a3b <strfind+0x25>
+  800a37:	84 d2                	test   %dl,%dl
+  800a39:	75 f2                	jne    800a2d <strfind+0x17>
+  800a3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3e:	c9                   	leave
+  800a3f:	c3                   	ret
+
+00800a40 <memset>:
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	57                   	push   %edi
+  800a44:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a47:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a4a:	85 c9                	test   %ecx,%ecx
+  800a4c:	74 20                	je     800a6e <memset+0x2e>
+  800a4e:	89 f8                	mov    %edi,%eax
+  800a50:	09 c8                	or     %ecx,%eax
+  800a52:	a8 03                	test   $0x3,%al
+  800a54:	75 12                	jne    800a68 <memset+0x28>
+  800a56:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a5a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a60:	c1 e9 02             	shr    $0x2,%ecx
+  800a63:	fc                   	cld
+  800a64:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a66:	eb 06                	jmp    800a6e <memset+0x2e>
+  800a68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a6b:	fc                   	cld
+  800a6c:	f3 aa                	rep stos %al,%es:(%edi)
+  800a6e:	89 f8                	mov    %edi,%eax
+  800a70:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a73:	c9                   	leave
+  800a74:	c3                   	ret
+
+00800a75 <memmove>:
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	57                   	push   %edi
+  800a79:	56                   	push   %esi
+  800a7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a80:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a83:	39 c6                	cmp    %eax,%esi
+  800a85:	73 32                	jae    800ab9 <memmove+0x44>
+  800a87:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a8a:	39 d0                	cmp    %edx,%eax
+  800a8c:	73 2b                	jae    800ab9 <memmove+0x44>
+  800a8e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a91:	89 d6                	mov    %edx,%esi
+  800a93:	09 fe                	or     %edi,%esi
+  800a95:	09 ce                	or     %ecx,%esi
+  800a97:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a9d:	75 0e                	jne    800aad <memmove+0x38>
+  800a9f:	83 ef 04             	sub    $0x4,%edi
+  800aa2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aa5:	c1 e9 02             	shr    $0x2,%ecx
+  800aa8:	fd                   	std
+  800aa9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aab:	eb 09                	jmp    800ab6 <memmove+0x41>
+  800aad:	83 ef 01             	sub    $0x1,%edi
+  800ab0:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800ab3:	fd                   	std
+  800ab4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ab6:	fc                   	cld
+  800ab7:	eb 1a                	jmp    800ad3 <memmove+0x5e>
+  800ab9:	89 f2                	mov    %esi,%edx
+  800abb:	09 c2                	or     %eax,%edx
+  800abd:	09 ca                	or     %ecx,%edx
+  800abf:	f6 c2 03             	test   $0x3,%dl
+  800ac2:	75 0a                	jne    800ace <memmove+0x59>
+  800ac4:	c1 e9 02             	shr    $0x2,%ecx
+  800ac7:	89 c7                	mov    %eax,%edi
+  800ac9:	fc                   	cld
+  800aca:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800acc:	eb 05                	jmp    800ad3 <memmove+0x5e>
+  800ace:	89 c7                	mov    %eax,%edi
+  800ad0:	fc                   	cld
+  800ad1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5f                   	pop    %edi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <memcpy>:
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	83 ec 0c             	sub    $0xc,%esp
+  800add:	ff 75 10             	push   0x10(%ebp)
+  800ae0:	ff 75 0c             	push   0xc(%ebp)
+  800ae3:	ff 75 08             	push   0x8(%ebp)
+  800ae6:	e8 8a ff ff ff       	call   800a75 <memmove>
+  800aeb:	c9                   	leave
+  800aec:	c3                   	ret
+
+00800aed <memcmp>:
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	56                   	push   %esi
+  800af1:	53                   	push   %ebx
+  800af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af8:	8b 75 10             	mov    0x10(%ebp),%esi
+  800afb:	85 f6                	test   %esi,%esi
+  800afd:	74 29                	je     800b28 <memcmp+0x3b>
+  800aff:	01 c6                	add    %eax,%esi
+  800b01:	0f b6 08             	movzbl (%eax),%ecx
+  800b04:	0f b6 1a             	movzbl (%edx),%ebx
+  800b07:	38 d9                	cmp    %bl,%cl
+  800b09:	75 11                	jne    800b1c <memcmp+0x2f>
+  800b0b:	83 c0 01             	add    $0x1,%eax
+  800b0e:	83 c2 01             	add    $0x1,%edx
+  800b11:	39 c6                	cmp    %eax,%esi
+  800b13:	75 ec                	jne    800b01 <memcmp+0x14>
+  800b15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1a:	eb 08                	jmp    800b24 <memcmp+0x37>
+  800b1c:	0f b6 c1             	movzbl %cl,%eax
+  800b1f:	0f b6 db             	movzbl %bl,%ebx
+  800b22:	29 d8                	sub    %ebx,%eax
+  800b24:	5b                   	pop    %ebx
+  800b25:	5e                   	pop    %esi
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+  800b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2d:	eb f5                	jmp    800b24 <memcmp+0x37>
+
+00800b2f <memfind>:
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b38:	89 c2                	mov    %eax,%edx
+  800b3a:	03 55 10             	add    0x10(%ebp),%edx
+  800b3d:	39 d0                	cmp    %edx,%eax
+  800b3f:	73 0d                	jae    800b4e <memfind+0x1f>
+  800b41:	38 08                	cmp    %cl,(%eax)
+  800b43:	74 0d                	je     800b52 <memfind+0x23>
+  800b45:	83 c0 01             	add    $0x1,%eax
+  800b48:	39 c2                	cmp    %eax,%edx
+  800b4a:	75 f5                	jne    800b41 <memfind+0x12>
+  800b4c:	eb 06                	jmp    800b54 <memfind+0x25>
+  800b4e:	89 c2                	mov    %eax,%edx
+  800b50:	eb 02                	jmp    800b54 <memfind+0x25>
+  800b52:	89 c2                	mov    %eax,%edx
+  800b54:	89 d0                	mov    %edx,%eax
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+
+00800b58 <strtol>:
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	57                   	push   %edi
+  800b5c:	56                   	push   %esi
+  800b5d:	53                   	push   %ebx
+  800b5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b64:	0f b6 02             	movzbl (%edx),%eax
+  800b67:	3c 20                	cmp    $0x20,%al
+  800b69:	74 04                	je     800b6f <strtol+0x17>
+  800b6b:	3c 09                	cmp    $0x9,%al
+  800b6d:	75 0e                	jne    800b7d <strtol+0x25>
+  800b6f:	83 c2 01             	add    $0x1,%edx
+  800b72:	0f b6 02             	movzbl (%edx),%eax
+  800b75:	3c 20                	cmp    $0x20,%al
+  800b77:	74 f6                	je     800b6f <strtol+0x17>
+  800b79:	3c 09                	cmp    $0x9,%al
+  800b7b:	74 f2                	je     800b6f <strtol+0x17>
+  800b7d:	3c 2b                	cmp    $0x2b,%al
+  800b7f:	74 2a                	je     800bab <strtol+0x53>
+  800b81:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b86:	3c 2d                	cmp    $0x2d,%al
+  800b88:	74 2b                	je     800bb5 <strtol+0x5d>
+  800b8a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b90:	75 0f                	jne    800ba1 <strtol+0x49>
+  800b92:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b95:	74 28                	je     800bbf <strtol+0x67>
+  800b97:	85 db                	test   %ebx,%ebx
+  800b99:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b9e:	0f 44 d8             	cmove  %eax,%ebx
+  800ba1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ba9:	eb 46                	jmp    800bf1 <strtol+0x99>
+  800bab:	83 c2 01             	add    $0x1,%edx
+  800bae:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb3:	eb d5                	jmp    800b8a <strtol+0x32>
+  800bb5:	83 c2 01             	add    $0x1,%edx
+  800bb8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bbd:	eb cb                	jmp    800b8a <strtol+0x32>
+  800bbf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bc3:	74 0e                	je     800bd3 <strtol+0x7b>
+  800bc5:	85 db                	test   %ebx,%ebx
+  800bc7:	75 d8                	jne    800ba1 <strtol+0x49>
+  800bc9:	83 c2 01             	add    $0x1,%edx
+  800bcc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bd1:	eb ce                	jmp    800ba1 <strtol+0x49>
+  800bd3:	83 c2 02             	add    $0x2,%edx
+  800bd6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bdb:	eb c4                	jmp    800ba1 <strtol+0x49>
+  800bdd:	0f be c0             	movsbl %al,%eax
+  800be0:	83 e8 30             	sub    $0x30,%eax
+  800be3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800be6:	7d 3a                	jge    800c22 <strtol+0xca>
+  800be8:	83 c2 01             	add    $0x1,%edx
+  800beb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bef:	01 c1                	add    %eax,%ecx
+  800bf1:	0f b6 02             	movzbl (%edx),%eax
+  800bf4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bf7:	89 f3                	mov    %esi,%ebx
+  800bf9:	80 fb 09             	cmp    $0x9,%bl
+  800bfc:	76 df                	jbe    800bdd <strtol+0x85>
+  800bfe:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c01:	89 f3                	mov    %esi,%ebx
+  800c03:	80 fb 19             	cmp    $0x19,%bl
+  800c06:	77 08                	ja     800c10 <strtol+0xb8>
+  800c08:	0f be c0             	movsbl %al,%eax
+  800c0b:	83 e8 57             	sub    $0x57,%eax
+  800c0e:	eb d3                	jmp    800be3 <strtol+0x8b>
+  800c10:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c13:	89 f3                	mov    %esi,%ebx
+  800c15:	80 fb 19             	cmp    $0x19,%bl
+  800c18:	77 08                	ja     800c22 <strtol+0xca>
+  800c1a:	0f be c0             	movsbl %al,%eax
+  800c1d:	83 e8 37             	sub    $0x37,%eax
+  800c20:	eb c1                	jmp    800be3 <strtol+0x8b>
+  800c22:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c26:	74 05                	je     800c2d <strtol+0xd5>
+  800c28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c2b:	89 10                	mov    %edx,(%eax)
+  800c2d:	89 c8                	mov    %ecx,%eax
+  800c2f:	f7 d8                	neg    %eax
+  800c31:	85 ff                	test   %edi,%edi
+  800c33:	0f 45 c8             	cmovne %eax,%ecx
+  800c36:	89 c8                	mov    %ecx,%eax
+  800c38:	5b                   	pop    %ebx
+  800c39:	5e                   	pop    %esi
+  800c3a:	5f                   	pop    %edi
+  800c3b:	5d                   	pop    %ebp
+  800c3c:	c3                   	ret
+
+00800c3d <sys_cputs>:
+  800c3d:	55                   	push   %ebp
+  800c3e:	89 e5                	mov    %esp,%ebp
+  800c40:	57                   	push   %edi
+  800c41:	56                   	push   %esi
+  800c42:	53                   	push   %ebx
+  800c43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4e:	89 c3                	mov    %eax,%ebx
+  800c50:	89 c7                	mov    %eax,%edi
+  800c52:	89 c6                	mov    %eax,%esi
+  800c54:	cd 30                	int    $0x30
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+
+00800c5b <sys_cgetc>:
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	57                   	push   %edi
+  800c5f:	56                   	push   %esi
+  800c60:	53                   	push   %ebx
+  800c61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c66:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c6b:	89 d1                	mov    %edx,%ecx
+  800c6d:	89 d3                	mov    %edx,%ebx
+  800c6f:	89 d7                	mov    %edx,%edi
+  800c71:	89 d6                	mov    %edx,%esi
+  800c73:	cd 30                	int    $0x30
+  800c75:	5b                   	pop    %ebx
+  800c76:	5e                   	pop    %esi
+  800c77:	5f                   	pop    %edi
+  800c78:	5d                   	pop    %ebp
+  800c79:	c3                   	ret
+
+00800c7a <sys_env_destroy>:
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	57                   	push   %edi
+  800c7e:	56                   	push   %esi
+  800c7f:	53                   	push   %ebx
+  800c80:	83 ec 0c             	sub    $0xc,%esp
+  800c83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c90:	89 cb                	mov    %ecx,%ebx
+  800c92:	89 cf                	mov    %ecx,%edi
+  800c94:	89 ce                	mov    %ecx,%esi
+  800c96:	cd 30                	int    $0x30
+  800c98:	85 c0                	test   %eax,%eax
+  800c9a:	7f 08                	jg     800ca4 <sys_env_destroy+0x2a>
+  800c9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9f:	5b                   	pop    %ebx
+  800ca0:	5e                   	pop    %esi
+  800ca1:	5f                   	pop    %edi
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+  800ca4:	83 ec 0c             	sub    $0xc,%esp
+  800ca7:	50                   	push   %eax
+  800ca8:	6a 03                	push   $0x3
+  800caa:	68 0b 3b 80 00       	push   $0x803b0b
+  800caf:	6a 24                	push   $0x24
+  800cb1:	68 28 3b 80 00       	push   $0x803b28
+  800cb6:	e8 d5 27 00 00       	call   803490 <_panic>
+
+00800cbb <sys_getenvid>:
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	57                   	push   %edi
+  800cbf:	56                   	push   %esi
+  800cc0:	53                   	push   %ebx
+  800cc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ccb:	89 d1                	mov    %edx,%ecx
+  800ccd:	89 d3                	mov    %edx,%ebx
+  800ccf:	89 d7                	mov    %edx,%edi
+  800cd1:	89 d6                	mov    %edx,%esi
+  800cd3:	cd 30                	int    $0x30
+  800cd5:	5b                   	pop    %ebx
+  800cd6:	5e                   	pop    %esi
+  800cd7:	5f                   	pop    %edi
+  800cd8:	5d                   	pop    %ebp
+  800cd9:	c3                   	ret
+
+00800cda <sys_yield>:
+  800cda:	55                   	push   %ebp
+  800cdb:	89 e5                	mov    %esp,%ebp
+  800cdd:	57                   	push   %edi
+  800cde:	56                   	push   %esi
+  800cdf:	53                   	push   %ebx
+  800ce0:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ce7:	74 26                	je     800d0f <sys_yield+0x35>
+  800ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cee:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf3:	89 d1                	mov    %edx,%ecx
+  800cf5:	89 d3                	mov    %edx,%ebx
+  800cf7:	89 d7                	mov    %edx,%edi
+  800cf9:	6a 00                	push   $0x0
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	8d 35 06 0d 80 00    	lea    0x800d06,%esi
+  800d04:	0f 34                	sysenter
+  800d06:	5d                   	pop    %ebp
+  800d07:	83 c4 04             	add    $0x4,%esp
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+  800d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d14:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d19:	89 d1                	mov    %edx,%ecx
+  800d1b:	89 d3                	mov    %edx,%ebx
+  800d1d:	89 d7                	mov    %edx,%edi
+  800d1f:	89 d6                	mov    %edx,%esi
+  800d21:	cd 30                	int    $0x30
+  800d23:	eb e5                	jmp    800d0a <sys_yield+0x30>
+
+00800d25 <sys_page_alloc>:
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	56                   	push   %esi
+  800d2a:	53                   	push   %ebx
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  800d2e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d41:	89 f7                	mov    %esi,%edi
+  800d43:	cd 30                	int    $0x30
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	7f 08                	jg     800d51 <sys_page_alloc+0x2c>
+  800d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+  800d51:	83 ec 0c             	sub    $0xc,%esp
+  800d54:	50                   	push   %eax
+  800d55:	6a 04                	push   $0x4
+  800d57:	68 0b 3b 80 00       	push   $0x803b0b
+  800d5c:	6a 24                	push   $0x24
+  800d5e:	68 28 3b 80 00       	push   $0x803b28
+  800d63:	e8 28 27 00 00       	call   803490 <_panic>
+
+00800d68 <sys_page_map>:
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+  800d71:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d78:	74 33                	je     800dad <sys_page_map+0x45>
+  800d7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d80:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d88:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d8b:	ff 75 18             	push   0x18(%ebp)
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	8d 35 99 0d 80 00    	lea    0x800d99,%esi
+  800d97:	0f 34                	sysenter
+  800d99:	5d                   	pop    %ebp
+  800d9a:	83 c4 04             	add    $0x4,%esp
+  800d9d:	89 c2                	mov    %eax,%edx
+  800d9f:	85 c0                	test   %eax,%eax
+  800da1:	7f 3d                	jg     800de0 <sys_page_map+0x78>
+  800da3:	89 d0                	mov    %edx,%eax
+  800da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da8:	5b                   	pop    %ebx
+  800da9:	5e                   	pop    %esi
+  800daa:	5f                   	pop    %edi
+  800dab:	5d                   	pop    %ebp
+  800dac:	c3                   	ret
+  800dad:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dbe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dc1:	cd 30                	int    $0x30
+  800dc3:	89 c2                	mov    %eax,%edx
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	7e da                	jle    800da3 <sys_page_map+0x3b>
+  800dc9:	83 ec 0c             	sub    $0xc,%esp
+  800dcc:	50                   	push   %eax
+  800dcd:	6a 05                	push   $0x5
+  800dcf:	68 0b 3b 80 00       	push   $0x803b0b
+  800dd4:	6a 24                	push   $0x24
+  800dd6:	68 28 3b 80 00       	push   $0x803b28
+  800ddb:	e8 b0 26 00 00       	call   803490 <_panic>
+  800de0:	83 ec 0c             	sub    $0xc,%esp
+  800de3:	50                   	push   %eax
+  800de4:	6a 05                	push   $0x5
+  800de6:	68 0b 3b 80 00       	push   $0x803b0b
+  800deb:	6a 48                	push   $0x48
+  800ded:	68 28 3b 80 00       	push   $0x803b28
+  800df2:	e8 99 26 00 00       	call   803490 <_panic>
+
+00800df7 <sys_page_unmap>:
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	57                   	push   %edi
+  800dfb:	56                   	push   %esi
+  800dfc:	53                   	push   %ebx
+  800dfd:	83 ec 0c             	sub    $0xc,%esp
+  800e00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e10:	89 df                	mov    %ebx,%edi
+  800e12:	89 de                	mov    %ebx,%esi
+  800e14:	cd 30                	int    $0x30
+  800e16:	85 c0                	test   %eax,%eax
+  800e18:	7f 08                	jg     800e22 <sys_page_unmap+0x2b>
+  800e1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1d:	5b                   	pop    %ebx
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5f                   	pop    %edi
+  800e20:	5d                   	pop    %ebp
+  800e21:	c3                   	ret
+  800e22:	83 ec 0c             	sub    $0xc,%esp
+  800e25:	50                   	push   %eax
+  800e26:	6a 06                	push   $0x6
+  800e28:	68 0b 3b 80 00       	push   $0x803b0b
+  800e2d:	6a 24                	push   $0x24
+  800e2f:	68 28 3b 80 00       	push   $0x803b28
+  800e34:	e8 57 26 00 00       	call   803490 <_panic>
+
+00800e39 <sys_fork>:
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	57                   	push   %edi
+  800e3d:	56                   	push   %esi
+  800e3e:	53                   	push   %ebx
+  800e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e44:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e49:	89 d1                	mov    %edx,%ecx
+  800e4b:	89 d3                	mov    %edx,%ebx
+  800e4d:	89 d7                	mov    %edx,%edi
+  800e4f:	89 d6                	mov    %edx,%esi
+  800e51:	cd 30                	int    $0x30
+  800e53:	5b                   	pop    %ebx
+  800e54:	5e                   	pop    %esi
+  800e55:	5f                   	pop    %edi
+  800e56:	5d                   	pop    %ebp
+  800e57:	c3                   	ret
+
+00800e58 <sys_env_set_status>:
+  800e58:	55                   	push   %ebp
+  800e59:	89 e5                	mov    %esp,%ebp
+  800e5b:	57                   	push   %edi
+  800e5c:	56                   	push   %esi
+  800e5d:	53                   	push   %ebx
+  800e5e:	83 ec 0c             	sub    $0xc,%esp
+  800e61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e71:	89 df                	mov    %ebx,%edi
+  800e73:	89 de                	mov    %ebx,%esi
+  800e75:	cd 30                	int    $0x30
+  800e77:	85 c0                	test   %eax,%eax
+  800e79:	7f 08                	jg     800e83 <sys_env_set_status+0x2b>
+  800e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7e:	5b                   	pop    %ebx
+  800e7f:	5e                   	pop    %esi
+  800e80:	5f                   	pop    %edi
+  800e81:	5d                   	pop    %ebp
+  800e82:	c3                   	ret
+  800e83:	83 ec 0c             	sub    $0xc,%esp
+  800e86:	50                   	push   %eax
+  800e87:	6a 08                	push   $0x8
+  800e89:	68 0b 3b 80 00       	push   $0x803b0b
+  800e8e:	6a 24                	push   $0x24
+  800e90:	68 28 3b 80 00       	push   $0x803b28
+  800e95:	e8 f6 25 00 00       	call   803490 <_panic>
+
+00800e9a <sys_env_set_trapframe>:
+  800e9a:	55                   	push   %ebp
+  800e9b:	89 e5                	mov    %esp,%ebp
+  800e9d:	57                   	push   %edi
+  800e9e:	56                   	push   %esi
+  800e9f:	53                   	push   %ebx
+  800ea0:	83 ec 0c             	sub    $0xc,%esp
+  800ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eae:	b8 09 00 00 00       	mov    $0x9,%eax
+  800eb3:	89 df                	mov    %ebx,%edi
+  800eb5:	89 de                	mov    %ebx,%esi
+  800eb7:	cd 30                	int    $0x30
+  800eb9:	85 c0                	test   %eax,%eax
+  800ebb:	7f 08                	jg     800ec5 <sys_env_set_trapframe+0x2b>
+  800ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+  800ec5:	83 ec 0c             	sub    $0xc,%esp
+  800ec8:	50                   	push   %eax
+  800ec9:	6a 09                	push   $0x9
+  800ecb:	68 0b 3b 80 00       	push   $0x803b0b
+  800ed0:	6a 24                	push   $0x24
+  800ed2:	68 28 3b 80 00       	push   $0x803b28
+  800ed7:	e8 b4 25 00 00       	call   803490 <_panic>
+
+00800edc <sys_env_set_cow>:
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	57                   	push   %edi
+  800ee0:	56                   	push   %esi
+  800ee1:	53                   	push   %ebx
+  800ee2:	83 ec 0c             	sub    $0xc,%esp
+  800ee5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef0:	b8 20 00 00 00       	mov    $0x20,%eax
+  800ef5:	89 df                	mov    %ebx,%edi
+  800ef7:	89 de                	mov    %ebx,%esi
+  800ef9:	cd 30                	int    $0x30
+  800efb:	85 c0                	test   %eax,%eax
+  800efd:	7f 08                	jg     800f07 <sys_env_set_cow+0x2b>
+  800eff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f02:	5b                   	pop    %ebx
+  800f03:	5e                   	pop    %esi
+  800f04:	5f                   	pop    %edi
+  800f05:	5d                   	pop    %ebp
+  800f06:	c3                   	ret
+  800f07:	83 ec 0c             	sub    $0xc,%esp
+  800f0a:	50                   	push   %eax
+  800f0b:	6a 20                	push   $0x20
+  800f0d:	68 0b 3b 80 00       	push   $0x803b0b
+  800f12:	6a 24                	push   $0x24
+  800f14:	68 28 3b 80 00       	push   $0x803b28
+  800f19:	e8 72 25 00 00       	call   803490 <_panic>
+
+00800f1e <sys_env_service>:
+  800f1e:	55                   	push   %ebp
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	57                   	push   %edi
+  800f22:	56                   	push   %esi
+  800f23:	53                   	push   %ebx
+  800f24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2c:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f31:	89 cb                	mov    %ecx,%ebx
+  800f33:	89 cf                	mov    %ecx,%edi
+  800f35:	89 ce                	mov    %ecx,%esi
+  800f37:	cd 30                	int    $0x30
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+
+00800f3e <sys_env_set_pgfault_upcall>:
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+  800f44:	83 ec 0c             	sub    $0xc,%esp
+  800f47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f57:	89 df                	mov    %ebx,%edi
+  800f59:	89 de                	mov    %ebx,%esi
+  800f5b:	cd 30                	int    $0x30
+  800f5d:	85 c0                	test   %eax,%eax
+  800f5f:	7f 08                	jg     800f69 <sys_env_set_pgfault_upcall+0x2b>
+  800f61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+  800f69:	83 ec 0c             	sub    $0xc,%esp
+  800f6c:	50                   	push   %eax
+  800f6d:	6a 0a                	push   $0xa
+  800f6f:	68 0b 3b 80 00       	push   $0x803b0b
+  800f74:	6a 24                	push   $0x24
+  800f76:	68 28 3b 80 00       	push   $0x803b28
+  800f7b:	e8 10 25 00 00       	call   803490 <_panic>
+
+00800f80 <sys_ipc_try_send>:
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	57                   	push   %edi
+  800f84:	56                   	push   %esi
+  800f85:	53                   	push   %ebx
+  800f86:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f8d:	74 27                	je     800fb6 <sys_ipc_try_send+0x36>
+  800f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f95:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f9d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa0:	6a 00                	push   $0x0
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	8d 35 ad 0f 80 00    	lea    0x800fad,%esi
+  800fab:	0f 34                	sysenter
+  800fad:	5d                   	pop    %ebp
+  800fae:	83 c4 04             	add    $0x4,%esp
+  800fb1:	5b                   	pop    %ebx
+  800fb2:	5e                   	pop    %esi
+  800fb3:	5f                   	pop    %edi
+  800fb4:	5d                   	pop    %ebp
+  800fb5:	c3                   	ret
+  800fb6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fcc:	cd 30                	int    $0x30
+  800fce:	eb e1                	jmp    800fb1 <sys_ipc_try_send+0x31>
+
+00800fd0 <sys_ipc_recv>:
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+  800fd6:	83 ec 0c             	sub    $0xc,%esp
+  800fd9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fe0:	74 32                	je     801014 <sys_ipc_recv+0x44>
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fef:	89 cb                	mov    %ecx,%ebx
+  800ff1:	89 cf                	mov    %ecx,%edi
+  800ff3:	6a 00                	push   $0x0
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	8d 35 00 10 80 00    	lea    0x801000,%esi
+  800ffe:	0f 34                	sysenter
+  801000:	5d                   	pop    %ebp
+  801001:	83 c4 04             	add    $0x4,%esp
+  801004:	89 c2                	mov    %eax,%edx
+  801006:	85 c0                	test   %eax,%eax
+  801008:	7f 3c                	jg     801046 <sys_ipc_recv+0x76>
+  80100a:	89 d0                	mov    %edx,%eax
+  80100c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100f:	5b                   	pop    %ebx
+  801010:	5e                   	pop    %esi
+  801011:	5f                   	pop    %edi
+  801012:	5d                   	pop    %ebp
+  801013:	c3                   	ret
+  801014:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801019:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80101e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801021:	89 cb                	mov    %ecx,%ebx
+  801023:	89 cf                	mov    %ecx,%edi
+  801025:	89 ce                	mov    %ecx,%esi
+  801027:	cd 30                	int    $0x30
+  801029:	89 c2                	mov    %eax,%edx
+  80102b:	85 c0                	test   %eax,%eax
+  80102d:	7e db                	jle    80100a <sys_ipc_recv+0x3a>
+  80102f:	83 ec 0c             	sub    $0xc,%esp
+  801032:	50                   	push   %eax
+  801033:	6a 0d                	push   $0xd
+  801035:	68 0b 3b 80 00       	push   $0x803b0b
+  80103a:	6a 24                	push   $0x24
+  80103c:	68 28 3b 80 00       	push   $0x803b28
+  801041:	e8 4a 24 00 00       	call   803490 <_panic>
+  801046:	83 ec 0c             	sub    $0xc,%esp
+  801049:	50                   	push   %eax
+  80104a:	6a 0d                	push   $0xd
+  80104c:	68 0b 3b 80 00       	push   $0x803b0b
+  801051:	6a 48                	push   $0x48
+  801053:	68 28 3b 80 00       	push   $0x803b28
+  801058:	e8 33 24 00 00       	call   803490 <_panic>
+
+0080105d <sys_ipc_send>:
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+  801063:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80106a:	74 27                	je     801093 <sys_ipc_send+0x36>
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801072:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801077:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80107d:	6a 00                	push   $0x0
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	8d 35 8a 10 80 00    	lea    0x80108a,%esi
+  801088:	0f 34                	sysenter
+  80108a:	5d                   	pop    %ebp
+  80108b:	83 c4 04             	add    $0x4,%esp
+  80108e:	5b                   	pop    %ebx
+  80108f:	5e                   	pop    %esi
+  801090:	5f                   	pop    %edi
+  801091:	5d                   	pop    %ebp
+  801092:	c3                   	ret
+  801093:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801098:	be 00 00 00 00       	mov    $0x0,%esi
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a9:	cd 30                	int    $0x30
+  8010ab:	eb e1                	jmp    80108e <sys_ipc_send+0x31>
+
+008010ad <sys_ipc_call>:
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+  8010b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010c7:	cd 30                	int    $0x30
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+
+008010ce <sys_ipc_reply_recv>:
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010da:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010e8:	cd 30                	int    $0x30
+  8010ea:	5b                   	pop    %ebx
+  8010eb:	5e                   	pop    %esi
+  8010ec:	5f                   	pop    %edi
+  8010ed:	5d                   	pop    %ebp
+  8010ee:	c3                   	ret
+
+008010ef <sys_time_msec>:
+  8010ef:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8010f4:	85 c0                	test   %eax,%eax
+  8010f6:	75 06                	jne    8010fe <sys_time_msec+0xf>
+  8010f8:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8010fd:	c3                   	ret
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  801104:	83 ec 0c             	sub    $0xc,%esp
+  801107:	0f 31                	rdtsc
+  801109:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80110f:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801115:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80111b:	29 c8                	sub    %ecx,%eax
+  80111d:	19 da                	sbb    %ebx,%edx
+  80111f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	52                   	push   %edx
+  801127:	50                   	push   %eax
+  801128:	e8 65 25 00 00       	call   803692 <__udivdi3>
+  80112d:	83 c4 10             	add    $0x10,%esp
+  801130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+
+00801138 <sys_env_swap>:
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801146:	8b 55 08             	mov    0x8(%ebp),%edx
+  801149:	b8 12 00 00 00       	mov    $0x12,%eax
+  80114e:	89 cb                	mov    %ecx,%ebx
+  801150:	89 cf                	mov    %ecx,%edi
+  801152:	89 ce                	mov    %ecx,%esi
+  801154:	cd 30                	int    $0x30
+  801156:	85 c0                	test   %eax,%eax
+  801158:	7f 08                	jg     801162 <sys_env_swap+0x2a>
+  80115a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+  801162:	83 ec 0c             	sub    $0xc,%esp
+  801165:	50                   	push   %eax
+  801166:	6a 12                	push   $0x12
+  801168:	68 0b 3b 80 00       	push   $0x803b0b
+  80116d:	6a 24                	push   $0x24
+  80116f:	68 28 3b 80 00       	push   $0x803b28
+  801174:	e8 17 23 00 00       	call   803490 <_panic>
+
+00801179 <sys_net_try_send>:
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+  80117f:	83 ec 0c             	sub    $0xc,%esp
+  801182:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801192:	89 df                	mov    %ebx,%edi
+  801194:	89 de                	mov    %ebx,%esi
+  801196:	cd 30                	int    $0x30
+  801198:	85 c0                	test   %eax,%eax
+  80119a:	7f 08                	jg     8011a4 <sys_net_try_send+0x2b>
+  80119c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5e                   	pop    %esi
+  8011a1:	5f                   	pop    %edi
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+  8011a4:	83 ec 0c             	sub    $0xc,%esp
+  8011a7:	50                   	push   %eax
+  8011a8:	6a 13                	push   $0x13
+  8011aa:	68 0b 3b 80 00       	push   $0x803b0b
+  8011af:	6a 24                	push   $0x24
+  8011b1:	68 28 3b 80 00       	push   $0x803b28
+  8011b6:	e8 d5 22 00 00       	call   803490 <_panic>
+
+008011bb <sys_net_try_receive>:
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+  8011c1:	83 ec 0c             	sub    $0xc,%esp
+  8011c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cf:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011d4:	89 df                	mov    %ebx,%edi
+  8011d6:	89 de                	mov    %ebx,%esi
+  8011d8:	cd 30                	int    $0x30
+  8011da:	85 c0                	test   %eax,%eax
+  8011dc:	7f 08                	jg     8011e6 <sys_net_try_receive+0x2b>
+  8011de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+  8011e6:	83 ec 0c             	sub    $0xc,%esp
+  8011e9:	50                   	push   %eax
+  8011ea:	6a 14                	push   $0x14
+  8011ec:	68 0b 3b 80 00       	push   $0x803b0b
+  8011f1:	6a 24                	push   $0x24
+  8011f3:	68 28 3b 80 00       	push   $0x803b28
+  8011f8:	e8 93 22 00 00       	call   803490 <_panic>
+
+008011fd <sys_net_recv_page>:
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	57                   	push   %edi
+  801201:	56                   	push   %esi
+  801202:	53                   	push   %ebx
+  801203:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120b:	b8 27 00 00 00       	mov    $0x27,%eax
+  801210:	89 cb                	mov    %ecx,%ebx
+  801212:	89 cf                	mov    %ecx,%edi
+  801214:	89 ce                	mov    %ecx,%esi
+  801216:	cd 30                	int    $0x30
+  801218:	5b                   	pop    %ebx
+  801219:	5e                   	pop    %esi
+  80121a:	5f                   	pop    %edi
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+
+0080121d <sys_net_wait>:
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+  801223:	ba 00 00 00 00       	mov    $0x0,%edx
+  801228:	b8 26 00 00 00       	mov    $0x26,%eax
+  80122d:	89 d1                	mov    %edx,%ecx
+  80122f:	89 d3                	mov    %edx,%ebx
+  801231:	89 d7                	mov    %edx,%edi
+  801233:	89 d6                	mov    %edx,%esi
+  801235:	cd 30                	int    $0x30
+  801237:	5b                   	pop    %ebx
+  801238:	5e                   	pop    %esi
+  801239:	5f                   	pop    %edi
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+
+0080123c <sys_get_mac>:
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	53                   	push   %ebx
+  801242:	83 ec 0c             	sub    $0xc,%esp
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801250:	b8 15 00 00 00       	mov    $0x15,%eax
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	cd 30                	int    $0x30
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	7f 08                	jg     801267 <sys_get_mac+0x2b>
+  80125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	50                   	push   %eax
+  80126b:	6a 15                	push   $0x15
+  80126d:	68 0b 3b 80 00       	push   $0x803b0b
+  801272:	6a 24                	push   $0x24
+  801274:	68 28 3b 80 00       	push   $0x803b28
+  801279:	e8 12 22 00 00       	call   803490 <_panic>
+
+0080127e <sys_env_lease>:
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	57                   	push   %edi
+  801282:	56                   	push   %esi
+  801283:	53                   	push   %ebx
+  801284:	83 ec 0c             	sub    $0xc,%esp
+  801287:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	b8 16 00 00 00       	mov    $0x16,%eax
+  801297:	89 df                	mov    %ebx,%edi
+  801299:	89 de                	mov    %ebx,%esi
+  80129b:	cd 30                	int    $0x30
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	7f 08                	jg     8012a9 <sys_env_lease+0x2b>
+  8012a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+  8012a9:	83 ec 0c             	sub    $0xc,%esp
+  8012ac:	50                   	push   %eax
+  8012ad:	6a 16                	push   $0x16
+  8012af:	68 0b 3b 80 00       	push   $0x803b0b
+  8012b4:	6a 24                	push   $0x24
+  8012b6:	68 28 3b 80 00       	push   $0x803b28
+  8012bb:	e8 d0 21 00 00       	call   803490 <_panic>
+
+008012c0 <sys_copy_mem>:
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	57                   	push   %edi
+  8012c4:	56                   	push   %esi
+  8012c5:	53                   	push   %ebx
+  8012c6:	83 ec 0c             	sub    $0xc,%esp
+  8012c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cf:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012da:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012dd:	cd 30                	int    $0x30
+  8012df:	85 c0                	test   %eax,%eax
+  8012e1:	7f 08                	jg     8012eb <sys_copy_mem+0x2b>
+  8012e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e6:	5b                   	pop    %ebx
+  8012e7:	5e                   	pop    %esi
+  8012e8:	5f                   	pop    %edi
+  8012e9:	5d                   	pop    %ebp
+  8012ea:	c3                   	ret
+  8012eb:	83 ec 0c             	sub    $0xc,%esp
+  8012ee:	50                   	push   %eax
+  8012ef:	6a 17                	push   $0x17
+  8012f1:	68 0b 3b 80 00       	push   $0x803b0b
+  8012f6:	6a 24                	push   $0x24
+  8012f8:	68 28 3b 80 00       	push   $0x803b28
+  8012fd:	e8 8e 21 00 00       	call   803490 <_panic>
+
+00801302 <sys_get_perms>:
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	57                   	push   %edi
+  801306:	56                   	push   %esi
+  801307:	53                   	push   %ebx
+  801308:	83 ec 0c             	sub    $0xc,%esp
+  80130b:	be 00 00 00 00       	mov    $0x0,%esi
+  801310:	8b 55 08             	mov    0x8(%ebp),%edx
+  801313:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801316:	b8 18 00 00 00       	mov    $0x18,%eax
+  80131b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131e:	89 f7                	mov    %esi,%edi
+  801320:	cd 30                	int    $0x30
+  801322:	85 c0                	test   %eax,%eax
+  801324:	7f 08                	jg     80132e <sys_get_perms+0x2c>
+  801326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	6a 18                	push   $0x18
+  801334:	68 0b 3b 80 00       	push   $0x803b0b
+  801339:	6a 24                	push   $0x24
+  80133b:	68 28 3b 80 00       	push   $0x803b28
+  801340:	e8 4b 21 00 00       	call   803490 <_panic>
+
+00801345 <sys_env_unsuspend>:
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 19 00 00 00       	mov    $0x19,%eax
+  80135e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801361:	89 f7                	mov    %esi,%edi
+  801363:	cd 30                	int    $0x30
+  801365:	85 c0                	test   %eax,%eax
+  801367:	7f 08                	jg     801371 <sys_env_unsuspend+0x2c>
+  801369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136c:	5b                   	pop    %ebx
+  80136d:	5e                   	pop    %esi
+  80136e:	5f                   	pop    %edi
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+  801371:	83 ec 0c             	sub    $0xc,%esp
+  801374:	50                   	push   %eax
+  801375:	6a 19                	push   $0x19
+  801377:	68 0b 3b 80 00       	push   $0x803b0b
+  80137c:	6a 24                	push   $0x24
+  80137e:	68 28 3b 80 00       	push   $0x803b28
+  801383:	e8 08 21 00 00       	call   803490 <_panic>
+
+00801388 <sys_migrate>:
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	57                   	push   %edi
+  80138c:	56                   	push   %esi
+  80138d:	53                   	push   %ebx
+  80138e:	83 ec 0c             	sub    $0xc,%esp
+  801391:	ba 04 80 80 00       	mov    $0x808004,%edx
+  801396:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80139c:	76 11                	jbe    8013af <sys_migrate+0x27>
+  80139e:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8013a3:	0f b6 08             	movzbl (%eax),%ecx
+  8013a6:	05 00 10 00 00       	add    $0x1000,%eax
+  8013ab:	39 d0                	cmp    %edx,%eax
+  8013ad:	72 f4                	jb     8013a3 <sys_migrate+0x1b>
+  8013af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013bc:	89 cb                	mov    %ecx,%ebx
+  8013be:	89 cf                	mov    %ecx,%edi
+  8013c0:	89 ce                	mov    %ecx,%esi
+  8013c2:	cd 30                	int    $0x30
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	7f 08                	jg     8013d0 <sys_migrate+0x48>
+  8013c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cb:	5b                   	pop    %ebx
+  8013cc:	5e                   	pop    %esi
+  8013cd:	5f                   	pop    %edi
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	c3                   	ret
+  8013d0:	83 ec 0c             	sub    $0xc,%esp
+  8013d3:	50                   	push   %eax
+  8013d4:	6a 1a                	push   $0x1a
+  8013d6:	68 0b 3b 80 00       	push   $0x803b0b
+  8013db:	6a 24                	push   $0x24
+  8013dd:	68 28 3b 80 00       	push   $0x803b28
+  8013e2:	e8 a9 20 00 00       	call   803490 <_panic>
+
+008013e7 <sys_lease_complete>:
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	57                   	push   %edi
+  8013eb:	56                   	push   %esi
+  8013ec:	53                   	push   %ebx
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013fa:	89 d1                	mov    %edx,%ecx
+  8013fc:	89 d3                	mov    %edx,%ebx
+  8013fe:	89 d7                	mov    %edx,%edi
+  801400:	89 d6                	mov    %edx,%esi
+  801402:	cd 30                	int    $0x30
+  801404:	85 c0                	test   %eax,%eax
+  801406:	7f 08                	jg     801410 <sys_lease_complete+0x29>
+  801408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140b:	5b                   	pop    %ebx
+  80140c:	5e                   	pop    %esi
+  80140d:	5f                   	pop    %edi
+  80140e:	5d                   	pop    %ebp
+  80140f:	c3                   	ret
+  801410:	83 ec 0c             	sub    $0xc,%esp
+  801413:	50                   	push   %eax
+  801414:	6a 1b                	push   $0x1b
+  801416:	68 0b 3b 80 00       	push   $0x803b0b
+  80141b:	6a 24                	push   $0x24
+  80141d:	68 28 3b 80 00       	push   $0x803b28
+  801422:	e8 69 20 00 00       	call   803490 <_panic>
+
+00801427 <sys_env_set_thisenv>:
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	57                   	push   %edi
+  80142b:	56                   	push   %esi
+  80142c:	53                   	push   %ebx
+  80142d:	83 ec 0c             	sub    $0xc,%esp
+  801430:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801435:	8b 55 08             	mov    0x8(%ebp),%edx
+  801438:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801440:	89 df                	mov    %ebx,%edi
+  801442:	89 de                	mov    %ebx,%esi
+  801444:	cd 30                	int    $0x30
+  801446:	85 c0                	test   %eax,%eax
+  801448:	7f 08                	jg     801452 <sys_env_set_thisenv+0x2b>
+  80144a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144d:	5b                   	pop    %ebx
+  80144e:	5e                   	pop    %esi
+  80144f:	5f                   	pop    %edi
+  801450:	5d                   	pop    %ebp
+  801451:	c3                   	ret
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	50                   	push   %eax
+  801456:	6a 1c                	push   $0x1c
+  801458:	68 0b 3b 80 00       	push   $0x803b0b
+  80145d:	6a 24                	push   $0x24
+  80145f:	68 28 3b 80 00       	push   $0x803b28
+  801464:	e8 27 20 00 00       	call   803490 <_panic>
+
+00801469 <sys_env_set_sched>:
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	57                   	push   %edi
+  80146d:	56                   	push   %esi
+  80146e:	53                   	push   %ebx
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	be 00 00 00 00       	mov    $0x0,%esi
+  801477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801482:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801485:	89 f7                	mov    %esi,%edi
+  801487:	cd 30                	int    $0x30
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	7f 08                	jg     801495 <sys_env_set_sched+0x2c>
+  80148d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801490:	5b                   	pop    %ebx
+  801491:	5e                   	pop    %esi
+  801492:	5f                   	pop    %edi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+  801495:	83 ec 0c             	sub    $0xc,%esp
+  801498:	50                   	push   %eax
+  801499:	6a 1d                	push   $0x1d
+  80149b:	68 0b 3b 80 00       	push   $0x803b0b
+  8014a0:	6a 24                	push   $0x24
+  8014a2:	68 28 3b 80 00       	push   $0x803b28
+  8014a7:	e8 e4 1f 00 00       	call   803490 <_panic>
+
+008014ac <sys_batch>:
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	57                   	push   %edi
+  8014b0:	56                   	push   %esi
+  8014b1:	53                   	push   %ebx
+  8014b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014c2:	89 df                	mov    %ebx,%edi
+  8014c4:	89 de                	mov    %ebx,%esi
+  8014c6:	cd 30                	int    $0x30
+  8014c8:	5b                   	pop    %ebx
+  8014c9:	5e                   	pop    %esi
+  8014ca:	5f                   	pop    %edi
+  8014cb:	5d                   	pop    %ebp
+  8014cc:	c3                   	ret
+
+008014cd <sys_env_stats>:
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	57                   	push   %edi
+  8014d1:	56                   	push   %esi
+  8014d2:	53                   	push   %ebx
+  8014d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014de:	b8 23 00 00 00       	mov    $0x23,%eax
+  8014e3:	89 df                	mov    %ebx,%edi
+  8014e5:	89 de                	mov    %ebx,%esi
+  8014e7:	cd 30                	int    $0x30
+  8014e9:	5b                   	pop    %ebx
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5f                   	pop    %edi
+  8014ec:	5d                   	pop    %ebp
+  8014ed:	c3                   	ret
+
+008014ee <sys_trace>:
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	57                   	push   %edi
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fc:	b8 24 00 00 00       	mov    $0x24,%eax
+  801501:	89 cb                	mov    %ecx,%ebx
+  801503:	89 cf                	mov    %ecx,%edi
+  801505:	89 ce                	mov    %ecx,%esi
+  801507:	cd 30                	int    $0x30
+  801509:	5b                   	pop    %ebx
+  80150a:	5e                   	pop    %esi
+  80150b:	5f                   	pop    %edi
+  80150c:	5d                   	pop    %ebp
+  80150d:	c3                   	ret
+
+0080150e <sys_env_set_pager>:
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+  801511:	57                   	push   %edi
+  801512:	56                   	push   %esi
+  801513:	53                   	push   %ebx
+  801514:	83 ec 0c             	sub    $0xc,%esp
+  801517:	be 00 00 00 00       	mov    $0x0,%esi
+  80151c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801522:	b8 25 00 00 00       	mov    $0x25,%eax
+  801527:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152a:	89 f7                	mov    %esi,%edi
+  80152c:	cd 30                	int    $0x30
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	7f 08                	jg     80153a <sys_env_set_pager+0x2c>
+  801532:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5f                   	pop    %edi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+  80153a:	83 ec 0c             	sub    $0xc,%esp
+  80153d:	50                   	push   %eax
+  80153e:	6a 25                	push   $0x25
+  801540:	68 0b 3b 80 00       	push   $0x803b0b
+  801545:	6a 24                	push   $0x24
+  801547:	68 28 3b 80 00       	push   $0x803b28
+  80154c:	e8 3f 1f 00 00       	call   803490 <_panic>
+
+00801551 <sys_pager_retire>:
+  801551:	55                   	push   %ebp
+  801552:	89 e5                	mov    %esp,%ebp
+  801554:	57                   	push   %edi
+  801555:	56                   	push   %esi
+  801556:	53                   	push   %ebx
+  801557:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80155c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155f:	b8 28 00 00 00       	mov    $0x28,%eax
+  801564:	89 cb                	mov    %ecx,%ebx
+  801566:	89 cf                	mov    %ecx,%edi
+  801568:	89 ce                	mov    %ecx,%esi
+  80156a:	cd 30                	int    $0x30
+  80156c:	5b                   	pop    %ebx
+  80156d:	5e                   	pop    %esi
+  80156e:	5f                   	pop    %edi
+  80156f:	5d                   	pop    %ebp
+  801570:	c3                   	ret
+
+00801571 <sys_prof>:
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	57                   	push   %edi
+  801575:	56                   	push   %esi
+  801576:	53                   	push   %ebx
+  801577:	be 00 00 00 00       	mov    $0x0,%esi
+  80157c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801582:	b8 22 00 00 00       	mov    $0x22,%eax
+  801587:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158a:	89 f7                	mov    %esi,%edi
+  80158c:	cd 30                	int    $0x30
+  80158e:	5b                   	pop    %ebx
+  80158f:	5e                   	pop    %esi
+  801590:	5f                   	pop    %edi
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+
+00801593 <dupq_flush>:
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	53                   	push   %ebx
+  801597:	83 ec 0c             	sub    $0xc,%esp
+  80159a:	8b 1d 00 50 80 00    	mov    0x805000,%ebx
+  8015a0:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8015a7:	00 00 00 
+  8015aa:	53                   	push   %ebx
+  8015ab:	68 00 00 40 00       	push   $0x400000
+  8015b0:	e8 f7 fe ff ff       	call   8014ac <sys_batch>
+  8015b5:	83 c4 10             	add    $0x10,%esp
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	78 14                	js     8015d0 <dupq_flush+0x3d>
+  8015bc:	39 c3                	cmp    %eax,%ebx
+  8015be:	7e 0b                	jle    8015cb <dupq_flush+0x38>
+  8015c0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8015c3:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8015c9:	eb 05                	jmp    8015d0 <dupq_flush+0x3d>
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015d3:	c9                   	leave
+  8015d4:	c3                   	ret
+
+008015d5 <pgfault>:
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	56                   	push   %esi
+  8015d9:	53                   	push   %ebx
+  8015da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015dd:	8b 30                	mov    (%eax),%esi
+  8015df:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8015e3:	0f 84 83 00 00 00    	je     80166c <pgfault+0x97>
+  8015e9:	89 f0                	mov    %esi,%eax
+  8015eb:	c1 e8 0c             	shr    $0xc,%eax
+  8015ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015f5:	f6 c4 08             	test   $0x8,%ah
+  8015f8:	0f 84 80 00 00 00    	je     80167e <pgfault+0xa9>
+  8015fe:	e8 b8 f6 ff ff       	call   800cbb <sys_getenvid>
+  801603:	89 c3                	mov    %eax,%ebx
+  801605:	83 ec 04             	sub    $0x4,%esp
+  801608:	6a 07                	push   $0x7
+  80160a:	68 00 f0 7f 00       	push   $0x7ff000
+  80160f:	50                   	push   %eax
+  801610:	e8 10 f7 ff ff       	call   800d25 <sys_page_alloc>
+  801615:	83 c4 10             	add    $0x10,%esp
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	78 74                	js     801690 <pgfault+0xbb>
+  80161c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801622:	83 ec 04             	sub    $0x4,%esp
+  801625:	68 00 10 00 00       	push   $0x1000
+  80162a:	56                   	push   %esi
+  80162b:	68 00 f0 7f 00       	push   $0x7ff000
+  801630:	e8 40 f4 ff ff       	call   800a75 <memmove>
+  801635:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80163c:	56                   	push   %esi
+  80163d:	53                   	push   %ebx
+  80163e:	68 00 f0 7f 00       	push   $0x7ff000
+  801643:	53                   	push   %ebx
+  801644:	e8 1f f7 ff ff       	call   800d68 <sys_page_map>
+  801649:	83 c4 20             	add    $0x20,%esp
+  80164c:	85 c0                	test   %eax,%eax
+  80164e:	78 54                	js     8016a4 <pgfault+0xcf>
+  801650:	83 ec 08             	sub    $0x8,%esp
+  801653:	68 00 f0 7f 00       	push   $0x7ff000
+  801658:	53                   	push   %ebx
+  801659:	e8 99 f7 ff ff       	call   800df7 <sys_page_unmap>
+  80165e:	83 c4 10             	add    $0x10,%esp
+  801661:	85 c0                	test   %eax,%eax
+  801663:	78 53                	js     8016b8 <pgfault+0xe3>
+  801665:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801668:	5b                   	pop    %ebx
+  801669:	5e                   	pop    %esi
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+  80166c:	56                   	push   %esi
+  80166d:	68 38 3b 80 00       	push   $0x803b38
+  801672:	6a 19                	push   $0x19
+  801674:	68 14 3c 80 00       	push   $0x803c14
+  801679:	e8 12 1e 00 00       	call   803490 <_panic>
+  80167e:	56                   	push   %esi
+  80167f:	68 6c 3b 80 00       	push   $0x803b6c
+  801684:	6a 1e                	push   $0x1e
+  801686:	68 14 3c 80 00       	push   $0x803c14
+  80168b:	e8 00 1e 00 00       	call   803490 <_panic>
+  801690:	83 ec 04             	sub    $0x4,%esp
+  801693:	68 a0 3b 80 00       	push   $0x803ba0
+  801698:	6a 2e                	push   $0x2e
+  80169a:	68 14 3c 80 00       	push   $0x803c14
+  80169f:	e8 ec 1d 00 00       	call   803490 <_panic>
+  8016a4:	83 ec 04             	sub    $0x4,%esp
+  8016a7:	68 c4 3b 80 00       	push   $0x803bc4
+  8016ac:	6a 37                	push   $0x37
+  8016ae:	68 14 3c 80 00       	push   $0x803c14
+  8016b3:	e8 d8 1d 00 00       	call   803490 <_panic>
+  8016b8:	83 ec 04             	sub    $0x4,%esp
+  8016bb:	68 f0 3b 80 00       	push   $0x803bf0
+  8016c0:	6a 3c                	push   $0x3c
+  8016c2:	68 14 3c 80 00       	push   $0x803c14
+  8016c7:	e8 c4 1d 00 00       	call   803490 <_panic>
+
+008016cc <dupq_begin>:
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	83 ec 0c             	sub    $0xc,%esp
+  8016d2:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8016d9:	00 00 00 
+  8016dc:	6a 07                	push   $0x7
+  8016de:	68 00 00 40 00       	push   $0x400000
+  8016e3:	6a 00                	push   $0x0
+  8016e5:	e8 3b f6 ff ff       	call   800d25 <sys_page_alloc>
+  8016ea:	c9                   	leave
+  8016eb:	c3                   	ret
+
+008016ec <dupq_map>:
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	83 ec 08             	sub    $0x8,%esp
+  8016f2:	81 3d 00 50 80 00 92 	cmpl   $0x92,0x805000
+  8016f9:	00 00 00 
+  8016fc:	74 46                	je     801744 <dupq_map+0x58>
+  8016fe:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  801704:	8d 42 01             	lea    0x1(%edx),%eax
+  801707:	a3 00 50 80 00       	mov    %eax,0x805000
+  80170c:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  80170f:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801715:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  80171c:	00 00 00 
+  80171f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801722:	89 50 04             	mov    %edx,0x4(%eax)
+  801725:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801728:	c1 e2 0c             	shl    $0xc,%edx
+  80172b:	89 50 08             	mov    %edx,0x8(%eax)
+  80172e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801731:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801734:	89 50 10             	mov    %edx,0x10(%eax)
+  801737:	8b 55 14             	mov    0x14(%ebp),%edx
+  80173a:	89 50 14             	mov    %edx,0x14(%eax)
+  80173d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801742:	c9                   	leave
+  801743:	c3                   	ret
+  801744:	e8 4a fe ff ff       	call   801593 <dupq_flush>
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	79 b1                	jns    8016fe <dupq_map+0x12>
+  80174d:	eb f3                	jmp    801742 <dupq_map+0x56>
+
+0080174f <dupq_end>:
+  80174f:	55                   	push   %ebp
+  801750:	89 e5                	mov    %esp,%ebp
+  801752:	53                   	push   %ebx
+  801753:	83 ec 04             	sub    $0x4,%esp
+  801756:	e8 38 fe ff ff       	call   801593 <dupq_flush>
+  80175b:	89 c3                	mov    %eax,%ebx
+  80175d:	83 ec 08             	sub    $0x8,%esp
+  801760:	68 00 00 40 00       	push   $0x400000
+  801765:	6a 00                	push   $0x0
+  801767:	e8 8b f6 ff ff       	call   800df7 <sys_page_unmap>
+  80176c:	89 d8                	mov    %ebx,%eax
+  80176e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801771:	c9                   	leave
+  801772:	c3                   	ret
+
+00801773 <fork>:
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	53                   	push   %ebx
+  801777:	83 ec 10             	sub    $0x10,%esp
+  80177a:	68 d5 15 80 00       	push   $0x8015d5
+  80177f:	e8 52 1d 00 00       	call   8034d6 <set_pgfault_handler>
+  801784:	83 c4 08             	add    $0x8,%esp
+  801787:	6a 01                	push   $0x1
+  801789:	6a 00                	push   $0x0
+  80178b:	e8 4c f7 ff ff       	call   800edc <sys_env_set_cow>
+  801790:	e8 a4 f6 ff ff       	call   800e39 <sys_fork>
+  801795:	89 c3                	mov    %eax,%ebx
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	85 c0                	test   %eax,%eax
+  80179c:	74 07                	je     8017a5 <fork+0x32>
+  80179e:	89 d8                	mov    %ebx,%eax
+  8017a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a3:	c9                   	leave
+  8017a4:	c3                   	ret
+  8017a5:	e8 11 f5 ff ff       	call   800cbb <sys_getenvid>
+  8017aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017af:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8017b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017ba:	a3 14 50 80 00       	mov    %eax,0x805014
+  8017bf:	eb dd                	jmp    80179e <fork+0x2b>
+
+008017c1 <sfork>:
+  8017c1:	55                   	push   %ebp
+  8017c2:	89 e5                	mov    %esp,%ebp
+  8017c4:	57                   	push   %edi
+  8017c5:	56                   	push   %esi
+  8017c6:	53                   	push   %ebx
+  8017c7:	83 ec 1c             	sub    $0x1c,%esp
+  8017ca:	e8 ec f4 ff ff       	call   800cbb <sys_getenvid>
+  8017cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017d2:	83 ec 0c             	sub    $0xc,%esp
+  8017d5:	68 d5 15 80 00       	push   $0x8015d5
+  8017da:	e8 f7 1c 00 00       	call   8034d6 <set_pgfault_handler>
+  8017df:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017e4:	cd 30                	int    $0x30
+  8017e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017e9:	83 c4 10             	add    $0x10,%esp
+  8017ec:	85 c0                	test   %eax,%eax
+  8017ee:	0f 88 45 02 00 00    	js     801a39 <sfork+0x278>
+  8017f4:	89 c6                	mov    %eax,%esi
+  8017f6:	74 17                	je     80180f <sfork+0x4e>
+  8017f8:	e8 cf fe ff ff       	call   8016cc <dupq_begin>
+  8017fd:	85 c0                	test   %eax,%eax
+  8017ff:	0f 88 40 02 00 00    	js     801a45 <sfork+0x284>
+  801805:	bf 02 00 00 00       	mov    $0x2,%edi
+  80180a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80180d:	eb 39                	jmp    801848 <sfork+0x87>
+  80180f:	e8 a7 f4 ff ff       	call   800cbb <sys_getenvid>
+  801814:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801819:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80181f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801824:	a3 14 50 80 00       	mov    %eax,0x805014
+  801829:	e9 23 01 00 00       	jmp    801951 <sfork+0x190>
+  80182e:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801835:	a8 01                	test   $0x1,%al
+  801837:	75 5b                	jne    801894 <sfork+0xd3>
+  801839:	83 c7 01             	add    $0x1,%edi
+  80183c:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801842:	0f 84 40 01 00 00    	je     801988 <sfork+0x1c7>
+  801848:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80184f:	a8 01                	test   $0x1,%al
+  801851:	74 db                	je     80182e <sfork+0x6d>
+  801853:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80185a:	a8 80                	test   $0x80,%al
+  80185c:	74 d0                	je     80182e <sfork+0x6d>
+  80185e:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801865:	25 07 0e 00 00       	and    $0xe07,%eax
+  80186a:	0c 80                	or     $0x80,%al
+  80186c:	50                   	push   %eax
+  80186d:	ff 75 e4             	push   -0x1c(%ebp)
+  801870:	89 f8                	mov    %edi,%eax
+  801872:	c1 e0 16             	shl    $0x16,%eax
+  801875:	c1 e8 0c             	shr    $0xc,%eax
+  801878:	50                   	push   %eax
+  801879:	ff 75 e0             	push   -0x20(%ebp)
+  80187c:	e8 6b fe ff ff       	call   8016ec <dupq_map>
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	85 c0                	test   %eax,%eax
+  801886:	79 b1                	jns    801839 <sfork+0x78>
+  801888:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80188f:	e9 bd 00 00 00       	jmp    801951 <sfork+0x190>
+  801894:	89 fe                	mov    %edi,%esi
+  801896:	c1 e6 16             	shl    $0x16,%esi
+  801899:	89 f0                	mov    %esi,%eax
+  80189b:	c1 e8 0c             	shr    $0xc,%eax
+  80189e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8018a3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8018a6:	eb 57                	jmp    8018ff <sfork+0x13e>
+  8018a8:	e8 0e f4 ff ff       	call   800cbb <sys_getenvid>
+  8018ad:	89 c7                	mov    %eax,%edi
+  8018af:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  8018b4:	f6 c4 04             	test   $0x4,%ah
+  8018b7:	0f 85 9f 00 00 00    	jne    80195c <sfork+0x19b>
+  8018bd:	a9 02 08 00 00       	test   $0x802,%eax
+  8018c2:	0f 85 c5 01 00 00    	jne    801a8d <sfork+0x2cc>
+  8018c8:	6a 05                	push   $0x5
+  8018ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8018cd:	68 fd e7 0e 00       	push   $0xee7fd
+  8018d2:	57                   	push   %edi
+  8018d3:	e8 14 fe ff ff       	call   8016ec <dupq_map>
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8018e1:	0f 84 91 00 00 00    	je     801978 <sfork+0x1b7>
+  8018e7:	89 f0                	mov    %esi,%eax
+  8018e9:	09 d8                	or     %ebx,%eax
+  8018eb:	c1 e8 0c             	shr    $0xc,%eax
+  8018ee:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018f4:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  8018f9:	0f 84 81 00 00 00    	je     801980 <sfork+0x1bf>
+  8018ff:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801904:	74 a2                	je     8018a8 <sfork+0xe7>
+  801906:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80190d:	f6 c2 01             	test   $0x1,%dl
+  801910:	74 c9                	je     8018db <sfork+0x11a>
+  801912:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801919:	f6 c6 02             	test   $0x2,%dh
+  80191c:	75 bd                	jne    8018db <sfork+0x11a>
+  80191e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801925:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80192c:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801932:	f7 d2                	not    %edx
+  801934:	21 ca                	and    %ecx,%edx
+  801936:	52                   	push   %edx
+  801937:	ff 75 e4             	push   -0x1c(%ebp)
+  80193a:	50                   	push   %eax
+  80193b:	ff 75 e0             	push   -0x20(%ebp)
+  80193e:	e8 a9 fd ff ff       	call   8016ec <dupq_map>
+  801943:	83 c4 10             	add    $0x10,%esp
+  801946:	85 c0                	test   %eax,%eax
+  801948:	79 91                	jns    8018db <sfork+0x11a>
+  80194a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801951:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801957:	5b                   	pop    %ebx
+  801958:	5e                   	pop    %esi
+  801959:	5f                   	pop    %edi
+  80195a:	5d                   	pop    %ebp
+  80195b:	c3                   	ret
+  80195c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801961:	50                   	push   %eax
+  801962:	ff 75 e4             	push   -0x1c(%ebp)
+  801965:	68 fd e7 0e 00       	push   $0xee7fd
+  80196a:	57                   	push   %edi
+  80196b:	e8 7c fd ff ff       	call   8016ec <dupq_map>
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	e9 63 ff ff ff       	jmp    8018db <sfork+0x11a>
+  801978:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80197b:	e9 b9 fe ff ff       	jmp    801839 <sfork+0x78>
+  801980:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801983:	e9 b1 fe ff ff       	jmp    801839 <sfork+0x78>
+  801988:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80198b:	e8 bf fd ff ff       	call   80174f <dupq_end>
+  801990:	85 c0                	test   %eax,%eax
+  801992:	0f 88 b9 00 00 00    	js     801a51 <sfork+0x290>
+  801998:	83 ec 04             	sub    $0x4,%esp
+  80199b:	6a 07                	push   $0x7
+  80199d:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019a2:	56                   	push   %esi
+  8019a3:	e8 7d f3 ff ff       	call   800d25 <sys_page_alloc>
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	85 c0                	test   %eax,%eax
+  8019ad:	0f 88 aa 00 00 00    	js     801a5d <sfork+0x29c>
+  8019b3:	83 ec 0c             	sub    $0xc,%esp
+  8019b6:	6a 07                	push   $0x7
+  8019b8:	68 00 f0 7f 00       	push   $0x7ff000
+  8019bd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8019c0:	57                   	push   %edi
+  8019c1:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019c6:	56                   	push   %esi
+  8019c7:	e8 9c f3 ff ff       	call   800d68 <sys_page_map>
+  8019cc:	83 c4 20             	add    $0x20,%esp
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	0f 88 92 00 00 00    	js     801a69 <sfork+0x2a8>
+  8019d7:	83 ec 04             	sub    $0x4,%esp
+  8019da:	68 00 10 00 00       	push   $0x1000
+  8019df:	68 00 f0 7f 00       	push   $0x7ff000
+  8019e4:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019e9:	e8 87 f0 ff ff       	call   800a75 <memmove>
+  8019ee:	83 c4 08             	add    $0x8,%esp
+  8019f1:	68 00 f0 7f 00       	push   $0x7ff000
+  8019f6:	57                   	push   %edi
+  8019f7:	e8 fb f3 ff ff       	call   800df7 <sys_page_unmap>
+  8019fc:	83 c4 10             	add    $0x10,%esp
+  8019ff:	85 c0                	test   %eax,%eax
+  801a01:	78 72                	js     801a75 <sfork+0x2b4>
+  801a03:	83 ec 08             	sub    $0x8,%esp
+  801a06:	68 4e 35 80 00       	push   $0x80354e
+  801a0b:	56                   	push   %esi
+  801a0c:	e8 2d f5 ff ff       	call   800f3e <sys_env_set_pgfault_upcall>
+  801a11:	83 c4 10             	add    $0x10,%esp
+  801a14:	85 c0                	test   %eax,%eax
+  801a16:	78 69                	js     801a81 <sfork+0x2c0>
+  801a18:	83 ec 08             	sub    $0x8,%esp
+  801a1b:	6a 02                	push   $0x2
+  801a1d:	56                   	push   %esi
+  801a1e:	e8 35 f4 ff ff       	call   800e58 <sys_env_set_status>
+  801a23:	83 c4 10             	add    $0x10,%esp
+  801a26:	85 c0                	test   %eax,%eax
+  801a28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a2d:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801a31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a34:	e9 18 ff ff ff       	jmp    801951 <sfork+0x190>
+  801a39:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a40:	e9 0c ff ff ff       	jmp    801951 <sfork+0x190>
+  801a45:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a4c:	e9 00 ff ff ff       	jmp    801951 <sfork+0x190>
+  801a51:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a58:	e9 f4 fe ff ff       	jmp    801951 <sfork+0x190>
+  801a5d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a64:	e9 e8 fe ff ff       	jmp    801951 <sfork+0x190>
+  801a69:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a70:	e9 dc fe ff ff       	jmp    801951 <sfork+0x190>
+  801a75:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a7c:	e9 d0 fe ff ff       	jmp    801951 <sfork+0x190>
+  801a81:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a88:	e9 c4 fe ff ff       	jmp    801951 <sfork+0x190>
+  801a8d:	68 05 08 00 00       	push   $0x805
+  801a92:	ff 75 e4             	push   -0x1c(%ebp)
+  801a95:	68 fd e7 0e 00       	push   $0xee7fd
+  801a9a:	57                   	push   %edi
+  801a9b:	e8 4c fc ff ff       	call   8016ec <dupq_map>
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	0f 88 30 fe ff ff    	js     8018db <sfork+0x11a>
+  801aab:	68 05 08 00 00       	push   $0x805
+  801ab0:	57                   	push   %edi
+  801ab1:	68 fd e7 0e 00       	push   $0xee7fd
+  801ab6:	57                   	push   %edi
+  801ab7:	e8 30 fc ff ff       	call   8016ec <dupq_map>
+  801abc:	83 c4 10             	add    $0x10,%esp
+  801abf:	e9 17 fe ff ff       	jmp    8018db <sfork+0x11a>
+
+00801ac4 <ipc_recv>:
+  801ac4:	55                   	push   %ebp
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	56                   	push   %esi
+  801ac8:	53                   	push   %ebx
+  801ac9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801acc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801acf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801ad9:	0f 44 c2             	cmove  %edx,%eax
+  801adc:	83 ec 0c             	sub    $0xc,%esp
+  801adf:	50                   	push   %eax
+  801ae0:	e8 eb f4 ff ff       	call   800fd0 <sys_ipc_recv>
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 2a                	js     801b16 <ipc_recv+0x52>
+  801aec:	a1 14 50 80 00       	mov    0x805014,%eax
+  801af1:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801af7:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801afd:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801b03:	85 f6                	test   %esi,%esi
+  801b05:	74 02                	je     801b09 <ipc_recv+0x45>
+  801b07:	89 0e                	mov    %ecx,(%esi)
+  801b09:	85 db                	test   %ebx,%ebx
+  801b0b:	74 02                	je     801b0f <ipc_recv+0x4b>
+  801b0d:	89 13                	mov    %edx,(%ebx)
+  801b0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b12:	5b                   	pop    %ebx
+  801b13:	5e                   	pop    %esi
+  801b14:	5d                   	pop    %ebp
+  801b15:	c3                   	ret
+  801b16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b20:	eb e1                	jmp    801b03 <ipc_recv+0x3f>
+
+00801b22 <ipc_send>:
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	57                   	push   %edi
+  801b26:	56                   	push   %esi
+  801b27:	53                   	push   %ebx
+  801b28:	83 ec 0c             	sub    $0xc,%esp
+  801b2b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b31:	8b 75 14             	mov    0x14(%ebp),%esi
+  801b34:	85 db                	test   %ebx,%ebx
+  801b36:	74 1e                	je     801b56 <ipc_send+0x34>
+  801b38:	56                   	push   %esi
+  801b39:	53                   	push   %ebx
+  801b3a:	57                   	push   %edi
+  801b3b:	ff 75 08             	push   0x8(%ebp)
+  801b3e:	e8 1a f5 ff ff       	call   80105d <sys_ipc_send>
+  801b43:	83 c4 10             	add    $0x10,%esp
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	74 2a                	je     801b74 <ipc_send+0x52>
+  801b4a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b4d:	75 13                	jne    801b62 <ipc_send+0x40>
+  801b4f:	e8 86 f1 ff ff       	call   800cda <sys_yield>
+  801b54:	eb e2                	jmp    801b38 <ipc_send+0x16>
+  801b56:	be 00 00 00 00       	mov    $0x0,%esi
+  801b5b:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801b60:	eb d6                	jmp    801b38 <ipc_send+0x16>
+  801b62:	50                   	push   %eax
+  801b63:	68 20 3c 80 00       	push   $0x803c20
+  801b68:	6a 4f                	push   $0x4f
+  801b6a:	68 63 3c 80 00       	push   $0x803c63
+  801b6f:	e8 1c 19 00 00       	call   803490 <_panic>
+  801b74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b77:	5b                   	pop    %ebx
+  801b78:	5e                   	pop    %esi
+  801b79:	5f                   	pop    %edi
+  801b7a:	5d                   	pop    %ebp
+  801b7b:	c3                   	ret
+
+00801b7c <ipc_call>:
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	57                   	push   %edi
+  801b80:	56                   	push   %esi
+  801b81:	53                   	push   %ebx
+  801b82:	83 ec 0c             	sub    $0xc,%esp
+  801b85:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b89:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801b8e:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801b92:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801b96:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801b9b:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801b9f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801ba3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba8:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801bac:	eb 05                	jmp    801bb3 <ipc_call+0x37>
+  801bae:	e8 27 f1 ff ff       	call   800cda <sys_yield>
+  801bb3:	83 ec 0c             	sub    $0xc,%esp
+  801bb6:	56                   	push   %esi
+  801bb7:	53                   	push   %ebx
+  801bb8:	57                   	push   %edi
+  801bb9:	ff 75 0c             	push   0xc(%ebp)
+  801bbc:	ff 75 08             	push   0x8(%ebp)
+  801bbf:	e8 e9 f4 ff ff       	call   8010ad <sys_ipc_call>
+  801bc4:	83 c4 20             	add    $0x20,%esp
+  801bc7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801bca:	74 e2                	je     801bae <ipc_call+0x32>
+  801bcc:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801bcf:	74 2d                	je     801bfe <ipc_call+0x82>
+  801bd1:	85 c0                	test   %eax,%eax
+  801bd3:	78 4f                	js     801c24 <ipc_call+0xa8>
+  801bd5:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801bd9:	74 10                	je     801beb <ipc_call+0x6f>
+  801bdb:	a1 14 50 80 00       	mov    0x805014,%eax
+  801be0:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801be6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801be9:	89 02                	mov    %eax,(%edx)
+  801beb:	a1 14 50 80 00       	mov    0x805014,%eax
+  801bf0:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801bf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf9:	5b                   	pop    %ebx
+  801bfa:	5e                   	pop    %esi
+  801bfb:	5f                   	pop    %edi
+  801bfc:	5d                   	pop    %ebp
+  801bfd:	c3                   	ret
+  801bfe:	ff 75 14             	push   0x14(%ebp)
+  801c01:	ff 75 10             	push   0x10(%ebp)
+  801c04:	ff 75 0c             	push   0xc(%ebp)
+  801c07:	ff 75 08             	push   0x8(%ebp)
+  801c0a:	e8 13 ff ff ff       	call   801b22 <ipc_send>
+  801c0f:	83 c4 0c             	add    $0xc,%esp
+  801c12:	ff 75 1c             	push   0x1c(%ebp)
+  801c15:	ff 75 18             	push   0x18(%ebp)
+  801c18:	6a 00                	push   $0x0
+  801c1a:	e8 a5 fe ff ff       	call   801ac4 <ipc_recv>
+  801c1f:	83 c4 10             	add    $0x10,%esp
+  801c22:	eb d2                	jmp    801bf6 <ipc_call+0x7a>
+  801c24:	50                   	push   %eax
+  801c25:	68 6d 3c 80 00       	push   $0x803c6d
+  801c2a:	6a 6d                	push   $0x6d
+  801c2c:	68 63 3c 80 00       	push   $0x803c63
+  801c31:	e8 5a 18 00 00       	call   803490 <_panic>
+
+00801c36 <ipc_reply_recv>:
+  801c36:	55                   	push   %ebp
+  801c37:	89 e5                	mov    %esp,%ebp
+  801c39:	57                   	push   %edi
+  801c3a:	56                   	push   %esi
+  801c3b:	53                   	push   %ebx
+  801c3c:	83 ec 0c             	sub    $0xc,%esp
+  801c3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c42:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801c45:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801c48:	85 db                	test   %ebx,%ebx
+  801c4a:	0f 84 ac 00 00 00    	je     801cfc <ipc_reply_recv+0xc6>
+  801c50:	85 f6                	test   %esi,%esi
+  801c52:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801c57:	0f 45 c6             	cmovne %esi,%eax
+  801c5a:	83 ec 0c             	sub    $0xc,%esp
+  801c5d:	50                   	push   %eax
+  801c5e:	ff 75 14             	push   0x14(%ebp)
+  801c61:	53                   	push   %ebx
+  801c62:	ff 75 0c             	push   0xc(%ebp)
+  801c65:	ff 75 08             	push   0x8(%ebp)
+  801c68:	e8 61 f4 ff ff       	call   8010ce <sys_ipc_reply_recv>
+  801c6d:	83 c4 20             	add    $0x20,%esp
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	78 3a                	js     801cae <ipc_reply_recv+0x78>
+  801c74:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801c78:	74 10                	je     801c8a <ipc_reply_recv+0x54>
+  801c7a:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c7f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801c85:	8b 55 18             	mov    0x18(%ebp),%edx
+  801c88:	89 02                	mov    %eax,(%edx)
+  801c8a:	85 ff                	test   %edi,%edi
+  801c8c:	74 0d                	je     801c9b <ipc_reply_recv+0x65>
+  801c8e:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c93:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801c99:	89 07                	mov    %eax,(%edi)
+  801c9b:	a1 14 50 80 00       	mov    0x805014,%eax
+  801ca0:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca9:	5b                   	pop    %ebx
+  801caa:	5e                   	pop    %esi
+  801cab:	5f                   	pop    %edi
+  801cac:	5d                   	pop    %ebp
+  801cad:	c3                   	ret
+  801cae:	ff 75 14             	push   0x14(%ebp)
+  801cb1:	53                   	push   %ebx
+  801cb2:	ff 75 0c             	push   0xc(%ebp)
+  801cb5:	ff 75 08             	push   0x8(%ebp)
+  801cb8:	e8 c3 f2 ff ff       	call   800f80 <sys_ipc_try_send>
+  801cbd:	89 c2                	mov    %eax,%edx
+  801cbf:	c1 ea 1f             	shr    $0x1f,%edx
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801cc8:	0f 95 c1             	setne  %cl
+  801ccb:	84 d1                	test   %dl,%cl
+  801ccd:	74 05                	je     801cd4 <ipc_reply_recv+0x9e>
+  801ccf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cd2:	75 12                	jne    801ce6 <ipc_reply_recv+0xb0>
+  801cd4:	83 ec 04             	sub    $0x4,%esp
+  801cd7:	57                   	push   %edi
+  801cd8:	56                   	push   %esi
+  801cd9:	ff 75 18             	push   0x18(%ebp)
+  801cdc:	e8 e3 fd ff ff       	call   801ac4 <ipc_recv>
+  801ce1:	83 c4 10             	add    $0x10,%esp
+  801ce4:	eb c0                	jmp    801ca6 <ipc_reply_recv+0x70>
+  801ce6:	83 ec 04             	sub    $0x4,%esp
+  801ce9:	50                   	push   %eax
+  801cea:	ff 75 08             	push   0x8(%ebp)
+  801ced:	68 40 3c 80 00       	push   $0x803c40
+  801cf2:	e8 d7 e4 ff ff       	call   8001ce <cprintf>
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	eb d8                	jmp    801cd4 <ipc_reply_recv+0x9e>
+  801cfc:	85 f6                	test   %esi,%esi
+  801cfe:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801d03:	0f 45 c6             	cmovne %esi,%eax
+  801d06:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801d0b:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801d12:	e9 43 ff ff ff       	jmp    801c5a <ipc_reply_recv+0x24>
+
+00801d17 <ipc_find_env>:
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	83 ec 14             	sub    $0x14,%esp
+  801d1d:	ff 75 08             	push   0x8(%ebp)
+  801d20:	e8 f9 f1 ff ff       	call   800f1e <sys_env_service>
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2c:	0f 48 c2             	cmovs  %edx,%eax
+  801d2f:	c9                   	leave
+  801d30:	c3                   	ret
+
+00801d31 <fd2num>:
+  801d31:	55                   	push   %ebp
+  801d32:	89 e5                	mov    %esp,%ebp
+  801d34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d37:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d3c:	c1 e8 0c             	shr    $0xc,%eax
+  801d3f:	5d                   	pop    %ebp
+  801d40:	c3                   	ret
+
+00801d41 <fd2data>:
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d47:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d4c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d51:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801d56:	5d                   	pop    %ebp
+  801d57:	c3                   	ret
+
+00801d58 <fd_alloc>:
+  801d58:	55                   	push   %ebp
+  801d59:	89 e5                	mov    %esp,%ebp
+  801d5b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801d60:	89 c2                	mov    %eax,%edx
+  801d62:	c1 ea 16             	shr    $0x16,%edx
+  801d65:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d6c:	f6 c2 01             	test   $0x1,%dl
+  801d6f:	74 29                	je     801d9a <fd_alloc+0x42>
+  801d71:	89 c2                	mov    %eax,%edx
+  801d73:	c1 ea 0c             	shr    $0xc,%edx
+  801d76:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d7d:	f6 c2 01             	test   $0x1,%dl
+  801d80:	74 18                	je     801d9a <fd_alloc+0x42>
+  801d82:	05 00 10 00 00       	add    $0x1000,%eax
+  801d87:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801d8c:	75 d2                	jne    801d60 <fd_alloc+0x8>
+  801d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d93:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d98:	eb 05                	jmp    801d9f <fd_alloc+0x47>
+  801d9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da2:	89 02                	mov    %eax,(%edx)
+  801da4:	89 c8                	mov    %ecx,%eax
+  801da6:	5d                   	pop    %ebp
+  801da7:	c3                   	ret
+
+00801da8 <fd_lookup>:
+  801da8:	55                   	push   %ebp
+  801da9:	89 e5                	mov    %esp,%ebp
+  801dab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dae:	83 f8 1f             	cmp    $0x1f,%eax
+  801db1:	77 30                	ja     801de3 <fd_lookup+0x3b>
+  801db3:	c1 e0 0c             	shl    $0xc,%eax
+  801db6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801dbb:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801dc1:	f6 c2 01             	test   $0x1,%dl
+  801dc4:	74 24                	je     801dea <fd_lookup+0x42>
+  801dc6:	89 c2                	mov    %eax,%edx
+  801dc8:	c1 ea 0c             	shr    $0xc,%edx
+  801dcb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dd2:	f6 c2 01             	test   $0x1,%dl
+  801dd5:	74 1a                	je     801df1 <fd_lookup+0x49>
+  801dd7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dda:	89 02                	mov    %eax,(%edx)
+  801ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de1:	5d                   	pop    %ebp
+  801de2:	c3                   	ret
+  801de3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de8:	eb f7                	jmp    801de1 <fd_lookup+0x39>
+  801dea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801def:	eb f0                	jmp    801de1 <fd_lookup+0x39>
+  801df1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df6:	eb e9                	jmp    801de1 <fd_lookup+0x39>
+
+00801df8 <dev_lookup>:
+  801df8:	55                   	push   %ebp
+  801df9:	89 e5                	mov    %esp,%ebp
+  801dfb:	53                   	push   %ebx
+  801dfc:	83 ec 04             	sub    $0x4,%esp
+  801dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e07:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801e0c:	39 13                	cmp    %edx,(%ebx)
+  801e0e:	74 37                	je     801e47 <dev_lookup+0x4f>
+  801e10:	83 c0 01             	add    $0x1,%eax
+  801e13:	8b 1c 85 08 3d 80 00 	mov    0x803d08(,%eax,4),%ebx
+  801e1a:	85 db                	test   %ebx,%ebx
+  801e1c:	75 ee                	jne    801e0c <dev_lookup+0x14>
+  801e1e:	a1 14 50 80 00       	mov    0x805014,%eax
+  801e23:	8b 40 48             	mov    0x48(%eax),%eax
+  801e26:	83 ec 04             	sub    $0x4,%esp
+  801e29:	52                   	push   %edx
+  801e2a:	50                   	push   %eax
+  801e2b:	68 8c 3c 80 00       	push   $0x803c8c
+  801e30:	e8 99 e3 ff ff       	call   8001ce <cprintf>
+  801e35:	83 c4 10             	add    $0x10,%esp
+  801e38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e40:	89 1a                	mov    %ebx,(%edx)
+  801e42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e45:	c9                   	leave
+  801e46:	c3                   	ret
+  801e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4c:	eb ef                	jmp    801e3d <dev_lookup+0x45>
+
+00801e4e <fd_close>:
+  801e4e:	55                   	push   %ebp
+  801e4f:	89 e5                	mov    %esp,%ebp
+  801e51:	57                   	push   %edi
+  801e52:	56                   	push   %esi
+  801e53:	53                   	push   %ebx
+  801e54:	83 ec 24             	sub    $0x24,%esp
+  801e57:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e5d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e60:	50                   	push   %eax
+  801e61:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e67:	c1 e8 0c             	shr    $0xc,%eax
+  801e6a:	50                   	push   %eax
+  801e6b:	e8 38 ff ff ff       	call   801da8 <fd_lookup>
+  801e70:	89 c3                	mov    %eax,%ebx
+  801e72:	83 c4 10             	add    $0x10,%esp
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	78 05                	js     801e7e <fd_close+0x30>
+  801e79:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e7c:	74 0f                	je     801e8d <fd_close+0x3f>
+  801e7e:	85 ff                	test   %edi,%edi
+  801e80:	0f 44 df             	cmove  %edi,%ebx
+  801e83:	89 d8                	mov    %ebx,%eax
+  801e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e88:	5b                   	pop    %ebx
+  801e89:	5e                   	pop    %esi
+  801e8a:	5f                   	pop    %edi
+  801e8b:	5d                   	pop    %ebp
+  801e8c:	c3                   	ret
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+  801e90:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e93:	50                   	push   %eax
+  801e94:	ff 36                	push   (%esi)
+  801e96:	e8 5d ff ff ff       	call   801df8 <dev_lookup>
+  801e9b:	89 c3                	mov    %eax,%ebx
+  801e9d:	83 c4 10             	add    $0x10,%esp
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	78 1a                	js     801ebe <fd_close+0x70>
+  801ea4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ea7:	8b 40 10             	mov    0x10(%eax),%eax
+  801eaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	74 0b                	je     801ebe <fd_close+0x70>
+  801eb3:	83 ec 0c             	sub    $0xc,%esp
+  801eb6:	56                   	push   %esi
+  801eb7:	ff d0                	call   *%eax
+  801eb9:	89 c3                	mov    %eax,%ebx
+  801ebb:	83 c4 10             	add    $0x10,%esp
+  801ebe:	83 ec 08             	sub    $0x8,%esp
+  801ec1:	56                   	push   %esi
+  801ec2:	6a 00                	push   $0x0
+  801ec4:	e8 2e ef ff ff       	call   800df7 <sys_page_unmap>
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	eb b5                	jmp    801e83 <fd_close+0x35>
+
+00801ece <close>:
+  801ece:	55                   	push   %ebp
+  801ecf:	89 e5                	mov    %esp,%ebp
+  801ed1:	83 ec 20             	sub    $0x20,%esp
+  801ed4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed7:	50                   	push   %eax
+  801ed8:	ff 75 08             	push   0x8(%ebp)
+  801edb:	e8 c8 fe ff ff       	call   801da8 <fd_lookup>
+  801ee0:	83 c4 10             	add    $0x10,%esp
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	79 02                	jns    801ee9 <close+0x1b>
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+  801ee9:	83 ec 08             	sub    $0x8,%esp
+  801eec:	6a 01                	push   $0x1
+  801eee:	ff 75 f4             	push   -0xc(%ebp)
+  801ef1:	e8 58 ff ff ff       	call   801e4e <fd_close>
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	eb ec                	jmp    801ee7 <close+0x19>
+
+00801efb <close_all>:
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	53                   	push   %ebx
+  801eff:	83 ec 04             	sub    $0x4,%esp
+  801f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f07:	83 ec 0c             	sub    $0xc,%esp
+  801f0a:	53                   	push   %ebx
+  801f0b:	e8 be ff ff ff       	call   801ece <close>
+  801f10:	83 c3 01             	add    $0x1,%ebx
+  801f13:	83 c4 10             	add    $0x10,%esp
+  801f16:	83 fb 20             	cmp    $0x20,%ebx
+  801f19:	75 ec                	jne    801f07 <close_all+0xc>
+  801f1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f1e:	c9                   	leave
+  801f1f:	c3                   	ret
+
+00801f20 <dup>:
+  801f20:	55                   	push   %ebp
+  801f21:	89 e5                	mov    %esp,%ebp
+  801f23:	57                   	push   %edi
+  801f24:	56                   	push   %esi
+  801f25:	53                   	push   %ebx
+  801f26:	83 ec 34             	sub    $0x34,%esp
+  801f29:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f2c:	50                   	push   %eax
+  801f2d:	ff 75 08             	push   0x8(%ebp)
+  801f30:	e8 73 fe ff ff       	call   801da8 <fd_lookup>
+  801f35:	89 c3                	mov    %eax,%ebx
+  801f37:	83 c4 10             	add    $0x10,%esp
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	78 7f                	js     801fbd <dup+0x9d>
+  801f3e:	83 ec 0c             	sub    $0xc,%esp
+  801f41:	ff 75 0c             	push   0xc(%ebp)
+  801f44:	e8 85 ff ff ff       	call   801ece <close>
+  801f49:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f4c:	c1 e6 0c             	shl    $0xc,%esi
+  801f4f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801f55:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f58:	89 3c 24             	mov    %edi,(%esp)
+  801f5b:	e8 e1 fd ff ff       	call   801d41 <fd2data>
+  801f60:	89 c3                	mov    %eax,%ebx
+  801f62:	89 34 24             	mov    %esi,(%esp)
+  801f65:	e8 d7 fd ff ff       	call   801d41 <fd2data>
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f70:	89 d8                	mov    %ebx,%eax
+  801f72:	c1 e8 16             	shr    $0x16,%eax
+  801f75:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f7c:	a8 01                	test   $0x1,%al
+  801f7e:	74 11                	je     801f91 <dup+0x71>
+  801f80:	89 d8                	mov    %ebx,%eax
+  801f82:	c1 e8 0c             	shr    $0xc,%eax
+  801f85:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f8c:	f6 c2 01             	test   $0x1,%dl
+  801f8f:	75 36                	jne    801fc7 <dup+0xa7>
+  801f91:	89 f8                	mov    %edi,%eax
+  801f93:	c1 e8 0c             	shr    $0xc,%eax
+  801f96:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f9d:	83 ec 0c             	sub    $0xc,%esp
+  801fa0:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fa5:	50                   	push   %eax
+  801fa6:	56                   	push   %esi
+  801fa7:	6a 00                	push   $0x0
+  801fa9:	57                   	push   %edi
+  801faa:	6a 00                	push   $0x0
+  801fac:	e8 b7 ed ff ff       	call   800d68 <sys_page_map>
+  801fb1:	89 c3                	mov    %eax,%ebx
+  801fb3:	83 c4 20             	add    $0x20,%esp
+  801fb6:	85 c0                	test   %eax,%eax
+  801fb8:	78 33                	js     801fed <dup+0xcd>
+  801fba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fbd:	89 d8                	mov    %ebx,%eax
+  801fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5f                   	pop    %edi
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+  801fc7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fce:	83 ec 0c             	sub    $0xc,%esp
+  801fd1:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fd6:	50                   	push   %eax
+  801fd7:	ff 75 d4             	push   -0x2c(%ebp)
+  801fda:	6a 00                	push   $0x0
+  801fdc:	53                   	push   %ebx
+  801fdd:	6a 00                	push   $0x0
+  801fdf:	e8 84 ed ff ff       	call   800d68 <sys_page_map>
+  801fe4:	89 c3                	mov    %eax,%ebx
+  801fe6:	83 c4 20             	add    $0x20,%esp
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	79 a4                	jns    801f91 <dup+0x71>
+  801fed:	83 ec 08             	sub    $0x8,%esp
+  801ff0:	56                   	push   %esi
+  801ff1:	6a 00                	push   $0x0
+  801ff3:	e8 ff ed ff ff       	call   800df7 <sys_page_unmap>
+  801ff8:	83 c4 08             	add    $0x8,%esp
+  801ffb:	ff 75 d4             	push   -0x2c(%ebp)
+  801ffe:	6a 00                	push   $0x0
+  802000:	e8 f2 ed ff ff       	call   800df7 <sys_page_unmap>
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	eb b3                	jmp    801fbd <dup+0x9d>
+
+0080200a <read>:
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	56                   	push   %esi
+  80200e:	53                   	push   %ebx
+  80200f:	83 ec 18             	sub    $0x18,%esp
+  802012:	8b 75 08             	mov    0x8(%ebp),%esi
+  802015:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802018:	50                   	push   %eax
+  802019:	56                   	push   %esi
+  80201a:	e8 89 fd ff ff       	call   801da8 <fd_lookup>
+  80201f:	83 c4 10             	add    $0x10,%esp
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 3c                	js     802062 <read+0x58>
+  802026:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802029:	83 ec 08             	sub    $0x8,%esp
+  80202c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80202f:	50                   	push   %eax
+  802030:	ff 33                	push   (%ebx)
+  802032:	e8 c1 fd ff ff       	call   801df8 <dev_lookup>
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	78 24                	js     802062 <read+0x58>
+  80203e:	8b 43 08             	mov    0x8(%ebx),%eax
+  802041:	83 e0 03             	and    $0x3,%eax
+  802044:	83 f8 01             	cmp    $0x1,%eax
+  802047:	74 20                	je     802069 <read+0x5f>
+  802049:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204c:	8b 40 08             	mov    0x8(%eax),%eax
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	74 37                	je     80208a <read+0x80>
+  802053:	83 ec 04             	sub    $0x4,%esp
+  802056:	ff 75 10             	push   0x10(%ebp)
+  802059:	ff 75 0c             	push   0xc(%ebp)
+  80205c:	53                   	push   %ebx
+  80205d:	ff d0                	call   *%eax
+  80205f:	83 c4 10             	add    $0x10,%esp
+  802062:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802065:	5b                   	pop    %ebx
+  802066:	5e                   	pop    %esi
+  802067:	5d                   	pop    %ebp
+  802068:	c3                   	ret
+  802069:	a1 14 50 80 00       	mov    0x805014,%eax
+  80206e:	8b 40 48             	mov    0x48(%eax),%eax
+  802071:	83 ec 04             	sub    $0x4,%esp
+  802074:	56                   	push   %esi
+  802075:	50                   	push   %eax
+  802076:	68 cd 3c 80 00       	push   $0x803ccd
+  80207b:	e8 4e e1 ff ff       	call   8001ce <cprintf>
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802088:	eb d8                	jmp    802062 <read+0x58>
+  80208a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80208f:	eb d1                	jmp    802062 <read+0x58>
+
+00802091 <readn>:
+  802091:	55                   	push   %ebp
+  802092:	89 e5                	mov    %esp,%ebp
+  802094:	57                   	push   %edi
+  802095:	56                   	push   %esi
+  802096:	53                   	push   %ebx
+  802097:	83 ec 0c             	sub    $0xc,%esp
+  80209a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80209d:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020a0:	85 f6                	test   %esi,%esi
+  8020a2:	74 30                	je     8020d4 <readn+0x43>
+  8020a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ae:	83 ec 04             	sub    $0x4,%esp
+  8020b1:	89 f2                	mov    %esi,%edx
+  8020b3:	29 c2                	sub    %eax,%edx
+  8020b5:	52                   	push   %edx
+  8020b6:	01 f8                	add    %edi,%eax
+  8020b8:	50                   	push   %eax
+  8020b9:	ff 75 08             	push   0x8(%ebp)
+  8020bc:	e8 49 ff ff ff       	call   80200a <read>
+  8020c1:	83 c4 10             	add    $0x10,%esp
+  8020c4:	85 c0                	test   %eax,%eax
+  8020c6:	78 15                	js     8020dd <readn+0x4c>
+  8020c8:	74 11                	je     8020db <readn+0x4a>
+  8020ca:	01 c3                	add    %eax,%ebx
+  8020cc:	89 d8                	mov    %ebx,%eax
+  8020ce:	39 f3                	cmp    %esi,%ebx
+  8020d0:	72 dc                	jb     8020ae <readn+0x1d>
+  8020d2:	eb 09                	jmp    8020dd <readn+0x4c>
+  8020d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d9:	eb 02                	jmp    8020dd <readn+0x4c>
+  8020db:	89 d8                	mov    %ebx,%eax
+  8020dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e0:	5b                   	pop    %ebx
+  8020e1:	5e                   	pop    %esi
+  8020e2:	5f                   	pop    %edi
+  8020e3:	5d                   	pop    %ebp
+  8020e4:	c3                   	ret
+
+008020e5 <write>:
+  8020e5:	55                   	push   %ebp
+  8020e6:	89 e5                	mov    %esp,%ebp
+  8020e8:	56                   	push   %esi
+  8020e9:	53                   	push   %ebx
+  8020ea:	83 ec 18             	sub    $0x18,%esp
+  8020ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020f3:	50                   	push   %eax
+  8020f4:	53                   	push   %ebx
+  8020f5:	e8 ae fc ff ff       	call   801da8 <fd_lookup>
+  8020fa:	83 c4 10             	add    $0x10,%esp
+  8020fd:	85 c0                	test   %eax,%eax
+  8020ff:	78 37                	js     802138 <write+0x53>
+  802101:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802104:	83 ec 08             	sub    $0x8,%esp
+  802107:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80210a:	50                   	push   %eax
+  80210b:	ff 36                	push   (%esi)
+  80210d:	e8 e6 fc ff ff       	call   801df8 <dev_lookup>
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 1f                	js     802138 <write+0x53>
+  802119:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80211d:	74 20                	je     80213f <write+0x5a>
+  80211f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802122:	8b 40 0c             	mov    0xc(%eax),%eax
+  802125:	85 c0                	test   %eax,%eax
+  802127:	74 37                	je     802160 <write+0x7b>
+  802129:	83 ec 04             	sub    $0x4,%esp
+  80212c:	ff 75 10             	push   0x10(%ebp)
+  80212f:	ff 75 0c             	push   0xc(%ebp)
+  802132:	56                   	push   %esi
+  802133:	ff d0                	call   *%eax
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80213b:	5b                   	pop    %ebx
+  80213c:	5e                   	pop    %esi
+  80213d:	5d                   	pop    %ebp
+  80213e:	c3                   	ret
+  80213f:	a1 14 50 80 00       	mov    0x805014,%eax
+  802144:	8b 40 48             	mov    0x48(%eax),%eax
+  802147:	83 ec 04             	sub    $0x4,%esp
+  80214a:	53                   	push   %ebx
+  80214b:	50                   	push   %eax
+  80214c:	68 e9 3c 80 00       	push   $0x803ce9
+  802151:	e8 78 e0 ff ff       	call   8001ce <cprintf>
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80215e:	eb d8                	jmp    802138 <write+0x53>
+  802160:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802165:	eb d1                	jmp    802138 <write+0x53>
+
+00802167 <seek>:
+  802167:	55                   	push   %ebp
+  802168:	89 e5                	mov    %esp,%ebp
+  80216a:	83 ec 20             	sub    $0x20,%esp
+  80216d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802170:	50                   	push   %eax
+  802171:	ff 75 08             	push   0x8(%ebp)
+  802174:	e8 2f fc ff ff       	call   801da8 <fd_lookup>
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	78 0e                	js     80218e <seek+0x27>
+  802180:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802183:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802186:	89 50 04             	mov    %edx,0x4(%eax)
+  802189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+
+00802190 <ftruncate>:
+  802190:	55                   	push   %ebp
+  802191:	89 e5                	mov    %esp,%ebp
+  802193:	56                   	push   %esi
+  802194:	53                   	push   %ebx
+  802195:	83 ec 18             	sub    $0x18,%esp
+  802198:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80219b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80219e:	50                   	push   %eax
+  80219f:	53                   	push   %ebx
+  8021a0:	e8 03 fc ff ff       	call   801da8 <fd_lookup>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	78 34                	js     8021e0 <ftruncate+0x50>
+  8021ac:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021af:	83 ec 08             	sub    $0x8,%esp
+  8021b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b5:	50                   	push   %eax
+  8021b6:	ff 36                	push   (%esi)
+  8021b8:	e8 3b fc ff ff       	call   801df8 <dev_lookup>
+  8021bd:	83 c4 10             	add    $0x10,%esp
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 1c                	js     8021e0 <ftruncate+0x50>
+  8021c4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021c8:	74 1d                	je     8021e7 <ftruncate+0x57>
+  8021ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021cd:	8b 40 18             	mov    0x18(%eax),%eax
+  8021d0:	85 c0                	test   %eax,%eax
+  8021d2:	74 34                	je     802208 <ftruncate+0x78>
+  8021d4:	83 ec 08             	sub    $0x8,%esp
+  8021d7:	ff 75 0c             	push   0xc(%ebp)
+  8021da:	56                   	push   %esi
+  8021db:	ff d0                	call   *%eax
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e3:	5b                   	pop    %ebx
+  8021e4:	5e                   	pop    %esi
+  8021e5:	5d                   	pop    %ebp
+  8021e6:	c3                   	ret
+  8021e7:	a1 14 50 80 00       	mov    0x805014,%eax
+  8021ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8021ef:	83 ec 04             	sub    $0x4,%esp
+  8021f2:	53                   	push   %ebx
+  8021f3:	50                   	push   %eax
+  8021f4:	68 ac 3c 80 00       	push   $0x803cac
+  8021f9:	e8 d0 df ff ff       	call   8001ce <cprintf>
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802206:	eb d8                	jmp    8021e0 <ftruncate+0x50>
+  802208:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80220d:	eb d1                	jmp    8021e0 <ftruncate+0x50>
+
+0080220f <fstat>:
+  80220f:	55                   	push   %ebp
+  802210:	89 e5                	mov    %esp,%ebp
+  802212:	56                   	push   %esi
+  802213:	53                   	push   %ebx
+  802214:	83 ec 18             	sub    $0x18,%esp
+  802217:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80221a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80221d:	50                   	push   %eax
+  80221e:	ff 75 08             	push   0x8(%ebp)
+  802221:	e8 82 fb ff ff       	call   801da8 <fd_lookup>
+  802226:	83 c4 10             	add    $0x10,%esp
+  802229:	85 c0                	test   %eax,%eax
+  80222b:	78 49                	js     802276 <fstat+0x67>
+  80222d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802230:	83 ec 08             	sub    $0x8,%esp
+  802233:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802236:	50                   	push   %eax
+  802237:	ff 36                	push   (%esi)
+  802239:	e8 ba fb ff ff       	call   801df8 <dev_lookup>
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	85 c0                	test   %eax,%eax
+  802243:	78 31                	js     802276 <fstat+0x67>
+  802245:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802248:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80224c:	74 2f                	je     80227d <fstat+0x6e>
+  80224e:	c6 03 00             	movb   $0x0,(%ebx)
+  802251:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802258:	00 00 00 
+  80225b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802262:	00 00 00 
+  802265:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  80226b:	83 ec 08             	sub    $0x8,%esp
+  80226e:	53                   	push   %ebx
+  80226f:	56                   	push   %esi
+  802270:	ff 50 14             	call   *0x14(%eax)
+  802273:	83 c4 10             	add    $0x10,%esp
+  802276:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802279:	5b                   	pop    %ebx
+  80227a:	5e                   	pop    %esi
+  80227b:	5d                   	pop    %ebp
+  80227c:	c3                   	ret
+  80227d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802282:	eb f2                	jmp    802276 <fstat+0x67>
+
+00802284 <stat>:
+  802284:	55                   	push   %ebp
+  802285:	89 e5                	mov    %esp,%ebp
+  802287:	56                   	push   %esi
+  802288:	53                   	push   %ebx
+  802289:	83 ec 08             	sub    $0x8,%esp
+  80228c:	6a 00                	push   $0x0
+  80228e:	ff 75 08             	push   0x8(%ebp)
+  802291:	e8 31 05 00 00       	call   8027c7 <open>
+  802296:	89 c3                	mov    %eax,%ebx
+  802298:	83 c4 10             	add    $0x10,%esp
+  80229b:	85 c0                	test   %eax,%eax
+  80229d:	78 1b                	js     8022ba <stat+0x36>
+  80229f:	83 ec 08             	sub    $0x8,%esp
+  8022a2:	ff 75 0c             	push   0xc(%ebp)
+  8022a5:	50                   	push   %eax
+  8022a6:	e8 64 ff ff ff       	call   80220f <fstat>
+  8022ab:	89 c6                	mov    %eax,%esi
+  8022ad:	89 1c 24             	mov    %ebx,(%esp)
+  8022b0:	e8 19 fc ff ff       	call   801ece <close>
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	89 f3                	mov    %esi,%ebx
+  8022ba:	89 d8                	mov    %ebx,%eax
+  8022bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bf:	5b                   	pop    %ebx
+  8022c0:	5e                   	pop    %esi
+  8022c1:	5d                   	pop    %ebp
+  8022c2:	c3                   	ret
+
+008022c3 <fsipc>:
+  8022c3:	55                   	push   %ebp
+  8022c4:	89 e5                	mov    %esp,%ebp
+  8022c6:	56                   	push   %esi
+  8022c7:	53                   	push   %ebx
+  8022c8:	89 c3                	mov    %eax,%ebx
+  8022ca:	89 d6                	mov    %edx,%esi
+  8022cc:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8022d3:	74 20                	je     8022f5 <fsipc+0x32>
+  8022d5:	83 ec 08             	sub    $0x8,%esp
+  8022d8:	6a 00                	push   $0x0
+  8022da:	56                   	push   %esi
+  8022db:	6a 07                	push   $0x7
+  8022dd:	68 00 60 80 00       	push   $0x806000
+  8022e2:	53                   	push   %ebx
+  8022e3:	ff 35 0c 50 80 00    	push   0x80500c
+  8022e9:	e8 8e f8 ff ff       	call   801b7c <ipc_call>
+  8022ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f1:	5b                   	pop    %ebx
+  8022f2:	5e                   	pop    %esi
+  8022f3:	5d                   	pop    %ebp
+  8022f4:	c3                   	ret
+  8022f5:	83 ec 0c             	sub    $0xc,%esp
+  8022f8:	6a 02                	push   $0x2
+  8022fa:	e8 18 fa ff ff       	call   801d17 <ipc_find_env>
+  8022ff:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802304:	83 c4 10             	add    $0x10,%esp
+  802307:	eb cc                	jmp    8022d5 <fsipc+0x12>
+
+00802309 <devfile_trunc>:
+  802309:	55                   	push   %ebp
+  80230a:	89 e5                	mov    %esp,%ebp
+  80230c:	83 ec 08             	sub    $0x8,%esp
+  80230f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802312:	8b 40 0c             	mov    0xc(%eax),%eax
+  802315:	a3 00 60 80 00       	mov    %eax,0x806000
+  80231a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231d:	a3 04 60 80 00       	mov    %eax,0x806004
+  802322:	ba 00 00 00 00       	mov    $0x0,%edx
+  802327:	b8 02 00 00 00       	mov    $0x2,%eax
+  80232c:	e8 92 ff ff ff       	call   8022c3 <fsipc>
+  802331:	c9                   	leave
+  802332:	c3                   	ret
+
+00802333 <devfile_flush>:
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	83 ec 08             	sub    $0x8,%esp
+  802339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80233f:	a3 00 60 80 00       	mov    %eax,0x806000
+  802344:	ba 00 00 00 00       	mov    $0x0,%edx
+  802349:	b8 08 00 00 00       	mov    $0x8,%eax
+  80234e:	e8 70 ff ff ff       	call   8022c3 <fsipc>
+  802353:	c9                   	leave
+  802354:	c3                   	ret
+
+00802355 <devfile_stat>:
+  802355:	55                   	push   %ebp
+  802356:	89 e5                	mov    %esp,%ebp
+  802358:	53                   	push   %ebx
+  802359:	83 ec 04             	sub    $0x4,%esp
+  80235c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80235f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802362:	8b 40 0c             	mov    0xc(%eax),%eax
+  802365:	a3 00 60 80 00       	mov    %eax,0x806000
+  80236a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802374:	e8 4a ff ff ff       	call   8022c3 <fsipc>
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	78 2c                	js     8023a9 <devfile_stat+0x54>
+  80237d:	83 ec 08             	sub    $0x8,%esp
+  802380:	68 00 60 80 00       	push   $0x806000
+  802385:	53                   	push   %ebx
+  802386:	e8 3a e5 ff ff       	call   8008c5 <strcpy>
+  80238b:	a1 80 60 80 00       	mov    0x806080,%eax
+  802390:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802396:	a1 84 60 80 00       	mov    0x806084,%eax
+  80239b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ac:	c9                   	leave
+  8023ad:	c3                   	ret
+
+008023ae <fsring_rw>:
+  8023ae:	55                   	push   %ebp
+  8023af:	89 e5                	mov    %esp,%ebp
+  8023b1:	57                   	push   %edi
+  8023b2:	56                   	push   %esi
+  8023b3:	53                   	push   %ebx
+  8023b4:	83 ec 2c             	sub    $0x2c,%esp
+  8023b7:	89 c7                	mov    %eax,%edi
+  8023b9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8023bc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8023bf:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8023c4:	a8 01                	test   $0x1,%al
+  8023c6:	74 0d                	je     8023d5 <fsring_rw+0x27>
+  8023c8:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8023cd:	a8 01                	test   $0x1,%al
+  8023cf:	0f 85 d5 00 00 00    	jne    8024aa <fsring_rw+0xfc>
+  8023d5:	a1 14 50 80 00       	mov    0x805014,%eax
+  8023da:	8b 40 48             	mov    0x48(%eax),%eax
+  8023dd:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  8023e3:	0f 84 fc 00 00 00    	je     8024e5 <fsring_rw+0x137>
+  8023e9:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8023f0:	0f 84 02 01 00 00    	je     8024f8 <fsring_rw+0x14a>
+  8023f6:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8023fb:	83 ec 04             	sub    $0x4,%esp
+  8023fe:	68 07 02 00 00       	push   $0x207
+  802403:	53                   	push   %ebx
+  802404:	6a 00                	push   $0x0
+  802406:	e8 1a e9 ff ff       	call   800d25 <sys_page_alloc>
+  80240b:	83 c4 10             	add    $0x10,%esp
+  80240e:	85 c0                	test   %eax,%eax
+  802410:	0f 88 f9 00 00 00    	js     80250f <fsring_rw+0x161>
+  802416:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80241c:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802422:	75 d7                	jne    8023fb <fsring_rw+0x4d>
+  802424:	6a 0e                	push   $0xe
+  802426:	6a 0d                	push   $0xd
+  802428:	ff 35 0c 50 80 00    	push   0x80500c
+  80242e:	68 00 00 f0 cf       	push   $0xcff00000
+  802433:	e8 c4 0c 00 00       	call   8030fc <ipcring_init>
+  802438:	83 c4 08             	add    $0x8,%esp
+  80243b:	6a 00                	push   $0x0
+  80243d:	6a 00                	push   $0x0
+  80243f:	68 07 02 00 00       	push   $0x207
+  802444:	68 00 00 f0 cf       	push   $0xcff00000
+  802449:	6a 0b                	push   $0xb
+  80244b:	ff 35 0c 50 80 00    	push   0x80500c
+  802451:	e8 26 f7 ff ff       	call   801b7c <ipc_call>
+  802456:	89 c6                	mov    %eax,%esi
+  802458:	83 c4 20             	add    $0x20,%esp
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	0f 88 ac 00 00 00    	js     80250f <fsring_rw+0x161>
+  802463:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802468:	89 d9                	mov    %ebx,%ecx
+  80246a:	83 c3 01             	add    $0x1,%ebx
+  80246d:	89 da                	mov    %ebx,%edx
+  80246f:	c1 e2 0c             	shl    $0xc,%edx
+  802472:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802478:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80247e:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802484:	83 ec 08             	sub    $0x8,%esp
+  802487:	6a 00                	push   $0x0
+  802489:	6a 00                	push   $0x0
+  80248b:	68 07 02 00 00       	push   $0x207
+  802490:	50                   	push   %eax
+  802491:	6a 0c                	push   $0xc
+  802493:	ff 35 0c 50 80 00    	push   0x80500c
+  802499:	e8 de f6 ff ff       	call   801b7c <ipc_call>
+  80249e:	83 c4 20             	add    $0x20,%esp
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	78 6a                	js     80250f <fsring_rw+0x161>
+  8024a5:	83 fb 08             	cmp    $0x8,%ebx
+  8024a8:	75 be                	jne    802468 <fsring_rw+0xba>
+  8024aa:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8024ae:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8024b3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024b8:	0f 45 c2             	cmovne %edx,%eax
+  8024bb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8024be:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8024c5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8024cc:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8024d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024dd:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8024e0:	e9 4b 01 00 00       	jmp    802630 <fsring_rw+0x282>
+  8024e5:	e8 05 ec ff ff       	call   8010ef <sys_time_msec>
+  8024ea:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8024f0:	0f 89 f3 fe ff ff    	jns    8023e9 <fsring_rw+0x3b>
+  8024f6:	eb 54                	jmp    80254c <fsring_rw+0x19e>
+  8024f8:	83 ec 0c             	sub    $0xc,%esp
+  8024fb:	6a 02                	push   $0x2
+  8024fd:	e8 15 f8 ff ff       	call   801d17 <ipc_find_env>
+  802502:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	e9 e7 fe ff ff       	jmp    8023f6 <fsring_rw+0x48>
+  80250f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802514:	83 ec 08             	sub    $0x8,%esp
+  802517:	53                   	push   %ebx
+  802518:	6a 00                	push   $0x0
+  80251a:	e8 d8 e8 ff ff       	call   800df7 <sys_page_unmap>
+  80251f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802525:	83 c4 10             	add    $0x10,%esp
+  802528:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80252e:	75 e4                	jne    802514 <fsring_rw+0x166>
+  802530:	e8 ba eb ff ff       	call   8010ef <sys_time_msec>
+  802535:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80253a:	a3 04 50 80 00       	mov    %eax,0x805004
+  80253f:	a1 14 50 80 00       	mov    0x805014,%eax
+  802544:	8b 40 48             	mov    0x48(%eax),%eax
+  802547:	a3 08 50 80 00       	mov    %eax,0x805008
+  80254c:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802553:	e9 7a 01 00 00       	jmp    8026d2 <fsring_rw+0x324>
+  802558:	8b 57 0c             	mov    0xc(%edi),%edx
+  80255b:	89 10                	mov    %edx,(%eax)
+  80255d:	89 58 04             	mov    %ebx,0x4(%eax)
+  802560:	89 f2                	mov    %esi,%edx
+  802562:	03 57 04             	add    0x4(%edi),%edx
+  802565:	89 50 08             	mov    %edx,0x8(%eax)
+  802568:	83 ec 04             	sub    $0x4,%esp
+  80256b:	53                   	push   %ebx
+  80256c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80256f:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802572:	52                   	push   %edx
+  802573:	83 c0 0c             	add    $0xc,%eax
+  802576:	50                   	push   %eax
+  802577:	e8 f9 e4 ff ff       	call   800a75 <memmove>
+  80257c:	83 c4 10             	add    $0x10,%esp
+  80257f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802582:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802585:	89 08                	mov    %ecx,(%eax)
+  802587:	83 ec 0c             	sub    $0xc,%esp
+  80258a:	68 00 00 f0 cf       	push   $0xcff00000
+  80258f:	e8 c6 0b 00 00       	call   80315a <ipcring_req_push>
+  802594:	01 de                	add    %ebx,%esi
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80259c:	73 4c                	jae    8025ea <fsring_rw+0x23c>
+  80259e:	83 ec 0c             	sub    $0xc,%esp
+  8025a1:	68 00 00 f0 cf       	push   $0xcff00000
+  8025a6:	e8 89 0b 00 00       	call   803134 <ipcring_req_slot>
+  8025ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	74 35                	je     8025ea <fsring_rw+0x23c>
+  8025b5:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8025ba:	83 e0 07             	and    $0x7,%eax
+  8025bd:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8025c2:	c1 e0 0c             	shl    $0xc,%eax
+  8025c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025c8:	29 f3                	sub    %esi,%ebx
+  8025ca:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8025cd:	39 cb                	cmp    %ecx,%ebx
+  8025cf:	0f 47 d9             	cmova  %ecx,%ebx
+  8025d2:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8025d6:	75 80                	jne    802558 <fsring_rw+0x1aa>
+  8025d8:	8b 57 0c             	mov    0xc(%edi),%edx
+  8025db:	89 10                	mov    %edx,(%eax)
+  8025dd:	89 58 04             	mov    %ebx,0x4(%eax)
+  8025e0:	89 f2                	mov    %esi,%edx
+  8025e2:	03 57 04             	add    0x4(%edi),%edx
+  8025e5:	89 50 08             	mov    %edx,0x8(%eax)
+  8025e8:	eb 95                	jmp    80257f <fsring_rw+0x1d1>
+  8025ea:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8025ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025f2:	83 ec 0c             	sub    $0xc,%esp
+  8025f5:	68 00 00 f0 cf       	push   $0xcff00000
+  8025fa:	e8 94 0b 00 00       	call   803193 <ipcring_rsp_wait>
+  8025ff:	8b 58 04             	mov    0x4(%eax),%ebx
+  802602:	83 c4 10             	add    $0x10,%esp
+  802605:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802609:	75 45                	jne    802650 <fsring_rw+0x2a2>
+  80260b:	85 db                	test   %ebx,%ebx
+  80260d:	79 41                	jns    802650 <fsring_rw+0x2a2>
+  80260f:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802612:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802619:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802620:	83 ec 0c             	sub    $0xc,%esp
+  802623:	68 00 00 f0 cf       	push   $0xcff00000
+  802628:	e8 cc 0b 00 00       	call   8031f9 <ipcring_rsp_pop>
+  80262d:	83 c4 10             	add    $0x10,%esp
+  802630:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802636:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80263b:	39 c2                	cmp    %eax,%edx
+  80263d:	74 75                	je     8026b4 <fsring_rw+0x306>
+  80263f:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802643:	75 a5                	jne    8025ea <fsring_rw+0x23c>
+  802645:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802648:	0f 82 50 ff ff ff    	jb     80259e <fsring_rw+0x1f0>
+  80264e:	eb 9a                	jmp    8025ea <fsring_rw+0x23c>
+  802650:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802654:	75 ca                	jne    802620 <fsring_rw+0x272>
+  802656:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80265a:	74 31                	je     80268d <fsring_rw+0x2df>
+  80265c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802662:	29 c8                	sub    %ecx,%eax
+  802664:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802667:	39 d0                	cmp    %edx,%eax
+  802669:	0f 47 c2             	cmova  %edx,%eax
+  80266c:	39 d8                	cmp    %ebx,%eax
+  80266e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802673:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802677:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80267a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80267f:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802683:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802686:	01 d9                	add    %ebx,%ecx
+  802688:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80268b:	eb 93                	jmp    802620 <fsring_rw+0x272>
+  80268d:	83 ec 04             	sub    $0x4,%esp
+  802690:	53                   	push   %ebx
+  802691:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802694:	83 e0 07             	and    $0x7,%eax
+  802697:	c1 e0 0c             	shl    $0xc,%eax
+  80269a:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8026a0:	50                   	push   %eax
+  8026a1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026a4:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8026a7:	01 c8                	add    %ecx,%eax
+  8026a9:	50                   	push   %eax
+  8026aa:	e8 c6 e3 ff ff       	call   800a75 <memmove>
+  8026af:	83 c4 10             	add    $0x10,%esp
+  8026b2:	eb a8                	jmp    80265c <fsring_rw+0x2ae>
+  8026b4:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8026b8:	75 09                	jne    8026c3 <fsring_rw+0x315>
+  8026ba:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8026bd:	0f 82 db fe ff ff    	jb     80259e <fsring_rw+0x1f0>
+  8026c3:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8026c6:	01 57 04             	add    %edx,0x4(%edi)
+  8026c9:	85 d2                	test   %edx,%edx
+  8026cb:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8026cf:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8026d2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8026d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d8:	5b                   	pop    %ebx
+  8026d9:	5e                   	pop    %esi
+  8026da:	5f                   	pop    %edi
+  8026db:	5d                   	pop    %ebp
+  8026dc:	c3                   	ret
+
+008026dd <devfile_write>:
+  8026dd:	55                   	push   %ebp
+  8026de:	89 e5                	mov    %esp,%ebp
+  8026e0:	57                   	push   %edi
+  8026e1:	56                   	push   %esi
+  8026e2:	53                   	push   %ebx
+  8026e3:	83 ec 0c             	sub    $0xc,%esp
+  8026e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8026ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026ef:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8026f5:	76 1a                	jbe    802711 <devfile_write+0x34>
+  8026f7:	83 ec 0c             	sub    $0xc,%esp
+  8026fa:	53                   	push   %ebx
+  8026fb:	89 f1                	mov    %esi,%ecx
+  8026fd:	ba 06 00 00 00       	mov    $0x6,%edx
+  802702:	89 f8                	mov    %edi,%eax
+  802704:	e8 a5 fc ff ff       	call   8023ae <fsring_rw>
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80270f:	75 39                	jne    80274a <devfile_write+0x6d>
+  802711:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802716:	39 c3                	cmp    %eax,%ebx
+  802718:	0f 47 d8             	cmova  %eax,%ebx
+  80271b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80271e:	a3 00 60 80 00       	mov    %eax,0x806000
+  802723:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802729:	83 ec 04             	sub    $0x4,%esp
+  80272c:	53                   	push   %ebx
+  80272d:	56                   	push   %esi
+  80272e:	68 08 60 80 00       	push   $0x806008
+  802733:	e8 3d e3 ff ff       	call   800a75 <memmove>
+  802738:	ba 00 00 00 00       	mov    $0x0,%edx
+  80273d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802742:	e8 7c fb ff ff       	call   8022c3 <fsipc>
+  802747:	83 c4 10             	add    $0x10,%esp
+  80274a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274d:	5b                   	pop    %ebx
+  80274e:	5e                   	pop    %esi
+  80274f:	5f                   	pop    %edi
+  802750:	5d                   	pop    %ebp
+  802751:	c3                   	ret
+
+00802752 <devfile_read>:
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	57                   	push   %edi
+  802756:	56                   	push   %esi
+  802757:	53                   	push   %ebx
+  802758:	83 ec 0c             	sub    $0xc,%esp
+  80275b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80275e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802761:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802767:	76 1d                	jbe    802786 <devfile_read+0x34>
+  802769:	83 ec 0c             	sub    $0xc,%esp
+  80276c:	56                   	push   %esi
+  80276d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802770:	ba 05 00 00 00       	mov    $0x5,%edx
+  802775:	89 f8                	mov    %edi,%eax
+  802777:	e8 32 fc ff ff       	call   8023ae <fsring_rw>
+  80277c:	89 c3                	mov    %eax,%ebx
+  80277e:	83 c4 10             	add    $0x10,%esp
+  802781:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802784:	75 37                	jne    8027bd <devfile_read+0x6b>
+  802786:	8b 47 0c             	mov    0xc(%edi),%eax
+  802789:	a3 00 60 80 00       	mov    %eax,0x806000
+  80278e:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802794:	ba 00 00 00 00       	mov    $0x0,%edx
+  802799:	b8 03 00 00 00       	mov    $0x3,%eax
+  80279e:	e8 20 fb ff ff       	call   8022c3 <fsipc>
+  8027a3:	89 c3                	mov    %eax,%ebx
+  8027a5:	85 c0                	test   %eax,%eax
+  8027a7:	78 14                	js     8027bd <devfile_read+0x6b>
+  8027a9:	83 ec 04             	sub    $0x4,%esp
+  8027ac:	50                   	push   %eax
+  8027ad:	68 00 60 80 00       	push   $0x806000
+  8027b2:	ff 75 0c             	push   0xc(%ebp)
+  8027b5:	e8 bb e2 ff ff       	call   800a75 <memmove>
+  8027ba:	83 c4 10             	add    $0x10,%esp
+  8027bd:	89 d8                	mov    %ebx,%eax
+  8027bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c2:	5b                   	pop    %ebx
+  8027c3:	5e                   	pop    %esi
+  8027c4:	5f                   	pop    %edi
+  8027c5:	5d                   	pop    %ebp
+  8027c6:	c3                   	ret
+
+008027c7 <open>:
+  8027c7:	55                   	push   %ebp
+  8027c8:	89 e5                	mov    %esp,%ebp
+  8027ca:	56                   	push   %esi
+  8027cb:	53                   	push   %ebx
+  8027cc:	83 ec 1c             	sub    $0x1c,%esp
+  8027cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027d2:	56                   	push   %esi
+  8027d3:	e8 a1 e0 ff ff       	call   800879 <strlen>
+  8027d8:	83 c4 10             	add    $0x10,%esp
+  8027db:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027e0:	7f 6c                	jg     80284e <open+0x87>
+  8027e2:	83 ec 0c             	sub    $0xc,%esp
+  8027e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027e8:	50                   	push   %eax
+  8027e9:	e8 6a f5 ff ff       	call   801d58 <fd_alloc>
+  8027ee:	89 c3                	mov    %eax,%ebx
+  8027f0:	83 c4 10             	add    $0x10,%esp
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	78 3c                	js     802833 <open+0x6c>
+  8027f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027fa:	a3 00 64 80 00       	mov    %eax,0x806400
+  8027ff:	83 ec 08             	sub    $0x8,%esp
+  802802:	56                   	push   %esi
+  802803:	68 00 60 80 00       	push   $0x806000
+  802808:	e8 b8 e0 ff ff       	call   8008c5 <strcpy>
+  80280d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802810:	b8 01 00 00 00       	mov    $0x1,%eax
+  802815:	e8 a9 fa ff ff       	call   8022c3 <fsipc>
+  80281a:	89 c3                	mov    %eax,%ebx
+  80281c:	83 c4 10             	add    $0x10,%esp
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	78 19                	js     80283c <open+0x75>
+  802823:	83 ec 0c             	sub    $0xc,%esp
+  802826:	ff 75 f4             	push   -0xc(%ebp)
+  802829:	e8 03 f5 ff ff       	call   801d31 <fd2num>
+  80282e:	89 c3                	mov    %eax,%ebx
+  802830:	83 c4 10             	add    $0x10,%esp
+  802833:	89 d8                	mov    %ebx,%eax
+  802835:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802838:	5b                   	pop    %ebx
+  802839:	5e                   	pop    %esi
+  80283a:	5d                   	pop    %ebp
+  80283b:	c3                   	ret
+  80283c:	83 ec 08             	sub    $0x8,%esp
+  80283f:	6a 00                	push   $0x0
+  802841:	ff 75 f4             	push   -0xc(%ebp)
+  802844:	e8 05 f6 ff ff       	call   801e4e <fd_close>
+  802849:	83 c4 10             	add    $0x10,%esp
+  80284c:	eb e5                	jmp    802833 <open+0x6c>
+  80284e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802853:	eb de                	jmp    802833 <open+0x6c>
+
+00802855 <file_image>:
+  802855:	55                   	push   %ebp
+  802856:	89 e5                	mov    %esp,%ebp
+  802858:	53                   	push   %ebx
+  802859:	83 ec 1c             	sub    $0x1c,%esp
+  80285c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80285f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802862:	50                   	push   %eax
+  802863:	ff 75 08             	push   0x8(%ebp)
+  802866:	e8 3d f5 ff ff       	call   801da8 <fd_lookup>
+  80286b:	83 c4 10             	add    $0x10,%esp
+  80286e:	85 c0                	test   %eax,%eax
+  802870:	78 58                	js     8028ca <file_image+0x75>
+  802872:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802875:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80287b:	39 08                	cmp    %ecx,(%eax)
+  80287d:	75 50                	jne    8028cf <file_image+0x7a>
+  80287f:	83 fb 04             	cmp    $0x4,%ebx
+  802882:	77 52                	ja     8028d6 <file_image+0x81>
+  802884:	8b 40 0c             	mov    0xc(%eax),%eax
+  802887:	a3 00 60 80 00       	mov    %eax,0x806000
+  80288c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802892:	83 ec 04             	sub    $0x4,%esp
+  802895:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802898:	c1 e0 02             	shl    $0x2,%eax
+  80289b:	50                   	push   %eax
+  80289c:	ff 75 0c             	push   0xc(%ebp)
+  80289f:	68 08 60 80 00       	push   $0x806008
+  8028a4:	e8 cc e1 ff ff       	call   800a75 <memmove>
+  8028a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ae:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028b3:	e8 0b fa ff ff       	call   8022c3 <fsipc>
+  8028b8:	83 c4 10             	add    $0x10,%esp
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 0b                	js     8028ca <file_image+0x75>
+  8028bf:	8b 55 14             	mov    0x14(%ebp),%edx
+  8028c2:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  8028c8:	89 0a                	mov    %ecx,(%edx)
+  8028ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028cd:	c9                   	leave
+  8028ce:	c3                   	ret
+  8028cf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028d4:	eb f4                	jmp    8028ca <file_image+0x75>
+  8028d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028db:	eb ed                	jmp    8028ca <file_image+0x75>
+
+008028dd <remove>:
+  8028dd:	55                   	push   %ebp
+  8028de:	89 e5                	mov    %esp,%ebp
+  8028e0:	53                   	push   %ebx
+  8028e1:	83 ec 10             	sub    $0x10,%esp
+  8028e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028e7:	53                   	push   %ebx
+  8028e8:	e8 8c df ff ff       	call   800879 <strlen>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+  8028f0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028f5:	7f 25                	jg     80291c <remove+0x3f>
+  8028f7:	83 ec 08             	sub    $0x8,%esp
+  8028fa:	53                   	push   %ebx
+  8028fb:	68 00 60 80 00       	push   $0x806000
+  802900:	e8 c0 df ff ff       	call   8008c5 <strcpy>
+  802905:	ba 00 00 00 00       	mov    $0x0,%edx
+  80290a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80290f:	e8 af f9 ff ff       	call   8022c3 <fsipc>
+  802914:	83 c4 10             	add    $0x10,%esp
+  802917:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80291a:	c9                   	leave
+  80291b:	c3                   	ret
+  80291c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802921:	eb f4                	jmp    802917 <remove+0x3a>
+
+00802923 <sync>:
+  802923:	55                   	push   %ebp
+  802924:	89 e5                	mov    %esp,%ebp
+  802926:	83 ec 08             	sub    $0x8,%esp
+  802929:	ba 00 00 00 00       	mov    $0x0,%edx
+  80292e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802933:	e8 8b f9 ff ff       	call   8022c3 <fsipc>
+  802938:	c9                   	leave
+  802939:	c3                   	ret
+
+0080293a <devsock_stat>:
+  80293a:	55                   	push   %ebp
+  80293b:	89 e5                	mov    %esp,%ebp
+  80293d:	83 ec 10             	sub    $0x10,%esp
+  802940:	68 1c 3d 80 00       	push   $0x803d1c
+  802945:	ff 75 0c             	push   0xc(%ebp)
+  802948:	e8 78 df ff ff       	call   8008c5 <strcpy>
+  80294d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802952:	c9                   	leave
+  802953:	c3                   	ret
+
+00802954 <devsock_close>:
+  802954:	55                   	push   %ebp
+  802955:	89 e5                	mov    %esp,%ebp
+  802957:	53                   	push   %ebx
+  802958:	83 ec 10             	sub    $0x10,%esp
+  80295b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80295e:	53                   	push   %ebx
+  80295f:	e8 15 0c 00 00       	call   803579 <pageref>
+  802964:	89 c2                	mov    %eax,%edx
+  802966:	83 c4 10             	add    $0x10,%esp
+  802969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296e:	83 fa 01             	cmp    $0x1,%edx
+  802971:	74 05                	je     802978 <devsock_close+0x24>
+  802973:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802976:	c9                   	leave
+  802977:	c3                   	ret
+  802978:	83 ec 0c             	sub    $0xc,%esp
+  80297b:	ff 73 0c             	push   0xc(%ebx)
+  80297e:	e8 aa 02 00 00       	call   802c2d <nsipc_close>
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	eb eb                	jmp    802973 <devsock_close+0x1f>
+
+00802988 <devsock_write>:
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	83 ec 08             	sub    $0x8,%esp
+  80298e:	6a 00                	push   $0x0
+  802990:	ff 75 10             	push   0x10(%ebp)
+  802993:	ff 75 0c             	push   0xc(%ebp)
+  802996:	8b 45 08             	mov    0x8(%ebp),%eax
+  802999:	ff 70 0c             	push   0xc(%eax)
+  80299c:	e8 6c 03 00 00       	call   802d0d <nsipc_send>
+  8029a1:	c9                   	leave
+  8029a2:	c3                   	ret
+
+008029a3 <devsock_read>:
+  8029a3:	55                   	push   %ebp
+  8029a4:	89 e5                	mov    %esp,%ebp
+  8029a6:	83 ec 08             	sub    $0x8,%esp
+  8029a9:	6a 00                	push   $0x0
+  8029ab:	ff 75 10             	push   0x10(%ebp)
+  8029ae:	ff 75 0c             	push   0xc(%ebp)
+  8029b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b4:	ff 70 0c             	push   0xc(%eax)
+  8029b7:	e8 e2 02 00 00       	call   802c9e <nsipc_recv>
+  8029bc:	c9                   	leave
+  8029bd:	c3                   	ret
+
+008029be <fd2sockid>:
+  8029be:	55                   	push   %ebp
+  8029bf:	89 e5                	mov    %esp,%ebp
+  8029c1:	83 ec 20             	sub    $0x20,%esp
+  8029c4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029c7:	52                   	push   %edx
+  8029c8:	50                   	push   %eax
+  8029c9:	e8 da f3 ff ff       	call   801da8 <fd_lookup>
+  8029ce:	83 c4 10             	add    $0x10,%esp
+  8029d1:	85 c0                	test   %eax,%eax
+  8029d3:	78 10                	js     8029e5 <fd2sockid+0x27>
+  8029d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8029de:	39 08                	cmp    %ecx,(%eax)
+  8029e0:	75 05                	jne    8029e7 <fd2sockid+0x29>
+  8029e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+  8029e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029ec:	eb f7                	jmp    8029e5 <fd2sockid+0x27>
+
+008029ee <alloc_sockfd>:
+  8029ee:	55                   	push   %ebp
+  8029ef:	89 e5                	mov    %esp,%ebp
+  8029f1:	56                   	push   %esi
+  8029f2:	53                   	push   %ebx
+  8029f3:	83 ec 1c             	sub    $0x1c,%esp
+  8029f6:	89 c6                	mov    %eax,%esi
+  8029f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029fb:	50                   	push   %eax
+  8029fc:	e8 57 f3 ff ff       	call   801d58 <fd_alloc>
+  802a01:	89 c3                	mov    %eax,%ebx
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 43                	js     802a4d <alloc_sockfd+0x5f>
+  802a0a:	83 ec 04             	sub    $0x4,%esp
+  802a0d:	68 07 04 00 00       	push   $0x407
+  802a12:	ff 75 f4             	push   -0xc(%ebp)
+  802a15:	6a 00                	push   $0x0
+  802a17:	e8 09 e3 ff ff       	call   800d25 <sys_page_alloc>
+  802a1c:	89 c3                	mov    %eax,%ebx
+  802a1e:	83 c4 10             	add    $0x10,%esp
+  802a21:	85 c0                	test   %eax,%eax
+  802a23:	78 28                	js     802a4d <alloc_sockfd+0x5f>
+  802a25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a28:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a2e:	89 10                	mov    %edx,(%eax)
+  802a30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a33:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802a3a:	89 70 0c             	mov    %esi,0xc(%eax)
+  802a3d:	83 ec 0c             	sub    $0xc,%esp
+  802a40:	50                   	push   %eax
+  802a41:	e8 eb f2 ff ff       	call   801d31 <fd2num>
+  802a46:	89 c3                	mov    %eax,%ebx
+  802a48:	83 c4 10             	add    $0x10,%esp
+  802a4b:	eb 0c                	jmp    802a59 <alloc_sockfd+0x6b>
+  802a4d:	83 ec 0c             	sub    $0xc,%esp
+  802a50:	56                   	push   %esi
+  802a51:	e8 d7 01 00 00       	call   802c2d <nsipc_close>
+  802a56:	83 c4 10             	add    $0x10,%esp
+  802a59:	89 d8                	mov    %ebx,%eax
+  802a5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a5e:	5b                   	pop    %ebx
+  802a5f:	5e                   	pop    %esi
+  802a60:	5d                   	pop    %ebp
+  802a61:	c3                   	ret
+
+00802a62 <accept>:
+  802a62:	55                   	push   %ebp
+  802a63:	89 e5                	mov    %esp,%ebp
+  802a65:	83 ec 08             	sub    $0x8,%esp
+  802a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6b:	e8 4e ff ff ff       	call   8029be <fd2sockid>
+  802a70:	85 c0                	test   %eax,%eax
+  802a72:	78 1b                	js     802a8f <accept+0x2d>
+  802a74:	83 ec 04             	sub    $0x4,%esp
+  802a77:	ff 75 10             	push   0x10(%ebp)
+  802a7a:	ff 75 0c             	push   0xc(%ebp)
+  802a7d:	50                   	push   %eax
+  802a7e:	e8 07 01 00 00       	call   802b8a <nsipc_accept>
+  802a83:	83 c4 10             	add    $0x10,%esp
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	78 05                	js     802a8f <accept+0x2d>
+  802a8a:	e8 5f ff ff ff       	call   8029ee <alloc_sockfd>
+  802a8f:	c9                   	leave
+  802a90:	c3                   	ret
+
+00802a91 <bind>:
+  802a91:	55                   	push   %ebp
+  802a92:	89 e5                	mov    %esp,%ebp
+  802a94:	83 ec 08             	sub    $0x8,%esp
+  802a97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9a:	e8 1f ff ff ff       	call   8029be <fd2sockid>
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	78 12                	js     802ab5 <bind+0x24>
+  802aa3:	83 ec 04             	sub    $0x4,%esp
+  802aa6:	ff 75 10             	push   0x10(%ebp)
+  802aa9:	ff 75 0c             	push   0xc(%ebp)
+  802aac:	50                   	push   %eax
+  802aad:	e8 24 01 00 00       	call   802bd6 <nsipc_bind>
+  802ab2:	83 c4 10             	add    $0x10,%esp
+  802ab5:	c9                   	leave
+  802ab6:	c3                   	ret
+
+00802ab7 <shutdown>:
+  802ab7:	55                   	push   %ebp
+  802ab8:	89 e5                	mov    %esp,%ebp
+  802aba:	83 ec 08             	sub    $0x8,%esp
+  802abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac0:	e8 f9 fe ff ff       	call   8029be <fd2sockid>
+  802ac5:	85 c0                	test   %eax,%eax
+  802ac7:	78 0f                	js     802ad8 <shutdown+0x21>
+  802ac9:	83 ec 08             	sub    $0x8,%esp
+  802acc:	ff 75 0c             	push   0xc(%ebp)
+  802acf:	50                   	push   %eax
+  802ad0:	e8 36 01 00 00       	call   802c0b <nsipc_shutdown>
+  802ad5:	83 c4 10             	add    $0x10,%esp
+  802ad8:	c9                   	leave
+  802ad9:	c3                   	ret
+
+00802ada <connect>:
+  802ada:	55                   	push   %ebp
+  802adb:	89 e5                	mov    %esp,%ebp
+  802add:	83 ec 08             	sub    $0x8,%esp
+  802ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae3:	e8 d6 fe ff ff       	call   8029be <fd2sockid>
+  802ae8:	85 c0                	test   %eax,%eax
+  802aea:	78 12                	js     802afe <connect+0x24>
+  802aec:	83 ec 04             	sub    $0x4,%esp
+  802aef:	ff 75 10             	push   0x10(%ebp)
+  802af2:	ff 75 0c             	push   0xc(%ebp)
+  802af5:	50                   	push   %eax
+  802af6:	e8 4c 01 00 00       	call   802c47 <nsipc_connect>
+  802afb:	83 c4 10             	add    $0x10,%esp
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+
+00802b00 <listen>:
+  802b00:	55                   	push   %ebp
+  802b01:	89 e5                	mov    %esp,%ebp
+  802b03:	83 ec 08             	sub    $0x8,%esp
+  802b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b09:	e8 b0 fe ff ff       	call   8029be <fd2sockid>
+  802b0e:	85 c0                	test   %eax,%eax
+  802b10:	78 0f                	js     802b21 <listen+0x21>
+  802b12:	83 ec 08             	sub    $0x8,%esp
+  802b15:	ff 75 0c             	push   0xc(%ebp)
+  802b18:	50                   	push   %eax
+  802b19:	e8 5e 01 00 00       	call   802c7c <nsipc_listen>
+  802b1e:	83 c4 10             	add    $0x10,%esp
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+
+00802b23 <socket>:
+  802b23:	55                   	push   %ebp
+  802b24:	89 e5                	mov    %esp,%ebp
+  802b26:	83 ec 0c             	sub    $0xc,%esp
+  802b29:	ff 75 10             	push   0x10(%ebp)
+  802b2c:	ff 75 0c             	push   0xc(%ebp)
+  802b2f:	ff 75 08             	push   0x8(%ebp)
+  802b32:	e8 34 02 00 00       	call   802d6b <nsipc_socket>
+  802b37:	83 c4 10             	add    $0x10,%esp
+  802b3a:	85 c0                	test   %eax,%eax
+  802b3c:	78 05                	js     802b43 <socket+0x20>
+  802b3e:	e8 ab fe ff ff       	call   8029ee <alloc_sockfd>
+  802b43:	c9                   	leave
+  802b44:	c3                   	ret
+
+00802b45 <nsipc>:
+  802b45:	55                   	push   %ebp
+  802b46:	89 e5                	mov    %esp,%ebp
+  802b48:	53                   	push   %ebx
+  802b49:	83 ec 04             	sub    $0x4,%esp
+  802b4c:	89 c3                	mov    %eax,%ebx
+  802b4e:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  802b55:	74 1f                	je     802b76 <nsipc+0x31>
+  802b57:	83 ec 08             	sub    $0x8,%esp
+  802b5a:	6a 00                	push   $0x0
+  802b5c:	6a 00                	push   $0x0
+  802b5e:	6a 07                	push   $0x7
+  802b60:	68 00 70 80 00       	push   $0x807000
+  802b65:	53                   	push   %ebx
+  802b66:	ff 35 10 50 80 00    	push   0x805010
+  802b6c:	e8 0b f0 ff ff       	call   801b7c <ipc_call>
+  802b71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b74:	c9                   	leave
+  802b75:	c3                   	ret
+  802b76:	83 ec 0c             	sub    $0xc,%esp
+  802b79:	6a 03                	push   $0x3
+  802b7b:	e8 97 f1 ff ff       	call   801d17 <ipc_find_env>
+  802b80:	a3 10 50 80 00       	mov    %eax,0x805010
+  802b85:	83 c4 10             	add    $0x10,%esp
+  802b88:	eb cd                	jmp    802b57 <nsipc+0x12>
+
+00802b8a <nsipc_accept>:
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	53                   	push   %ebx
+  802b8e:	83 ec 04             	sub    $0x4,%esp
+  802b91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b94:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b99:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b9e:	e8 a2 ff ff ff       	call   802b45 <nsipc>
+  802ba3:	89 c3                	mov    %eax,%ebx
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	79 07                	jns    802bb0 <nsipc_accept+0x26>
+  802ba9:	89 d8                	mov    %ebx,%eax
+  802bab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bae:	c9                   	leave
+  802baf:	c3                   	ret
+  802bb0:	83 ec 04             	sub    $0x4,%esp
+  802bb3:	ff 35 10 70 80 00    	push   0x807010
+  802bb9:	68 00 70 80 00       	push   $0x807000
+  802bbe:	ff 75 0c             	push   0xc(%ebp)
+  802bc1:	e8 af de ff ff       	call   800a75 <memmove>
+  802bc6:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802bcc:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bcf:	89 10                	mov    %edx,(%eax)
+  802bd1:	83 c4 10             	add    $0x10,%esp
+  802bd4:	eb d3                	jmp    802ba9 <nsipc_accept+0x1f>
+
+00802bd6 <nsipc_bind>:
+  802bd6:	55                   	push   %ebp
+  802bd7:	89 e5                	mov    %esp,%ebp
+  802bd9:	53                   	push   %ebx
+  802bda:	83 ec 08             	sub    $0x8,%esp
+  802bdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802be0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be3:	a3 00 70 80 00       	mov    %eax,0x807000
+  802be8:	53                   	push   %ebx
+  802be9:	ff 75 0c             	push   0xc(%ebp)
+  802bec:	68 04 70 80 00       	push   $0x807004
+  802bf1:	e8 7f de ff ff       	call   800a75 <memmove>
+  802bf6:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802bfc:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c01:	e8 3f ff ff ff       	call   802b45 <nsipc>
+  802c06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c09:	c9                   	leave
+  802c0a:	c3                   	ret
+
+00802c0b <nsipc_shutdown>:
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	83 ec 08             	sub    $0x8,%esp
+  802c11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c14:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c1c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802c21:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c26:	e8 1a ff ff ff       	call   802b45 <nsipc>
+  802c2b:	c9                   	leave
+  802c2c:	c3                   	ret
+
+00802c2d <nsipc_close>:
+  802c2d:	55                   	push   %ebp
+  802c2e:	89 e5                	mov    %esp,%ebp
+  802c30:	83 ec 08             	sub    $0x8,%esp
+  802c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c36:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c3b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c40:	e8 00 ff ff ff       	call   802b45 <nsipc>
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+
+00802c47 <nsipc_connect>:
+  802c47:	55                   	push   %ebp
+  802c48:	89 e5                	mov    %esp,%ebp
+  802c4a:	53                   	push   %ebx
+  802c4b:	83 ec 08             	sub    $0x8,%esp
+  802c4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c51:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c54:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c59:	53                   	push   %ebx
+  802c5a:	ff 75 0c             	push   0xc(%ebp)
+  802c5d:	68 04 70 80 00       	push   $0x807004
+  802c62:	e8 0e de ff ff       	call   800a75 <memmove>
+  802c67:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802c6d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c72:	e8 ce fe ff ff       	call   802b45 <nsipc>
+  802c77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <nsipc_listen>:
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	83 ec 08             	sub    $0x8,%esp
+  802c82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c85:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c8d:	a3 04 70 80 00       	mov    %eax,0x807004
+  802c92:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c97:	e8 a9 fe ff ff       	call   802b45 <nsipc>
+  802c9c:	c9                   	leave
+  802c9d:	c3                   	ret
+
+00802c9e <nsipc_recv>:
+  802c9e:	55                   	push   %ebp
+  802c9f:	89 e5                	mov    %esp,%ebp
+  802ca1:	56                   	push   %esi
+  802ca2:	53                   	push   %ebx
+  802ca3:	8b 75 10             	mov    0x10(%ebp),%esi
+  802ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca9:	a3 00 70 80 00       	mov    %eax,0x807000
+  802cae:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802cb4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cb7:	a3 08 70 80 00       	mov    %eax,0x807008
+  802cbc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cc1:	e8 7f fe ff ff       	call   802b45 <nsipc>
+  802cc6:	89 c3                	mov    %eax,%ebx
+  802cc8:	85 c0                	test   %eax,%eax
+  802cca:	78 22                	js     802cee <nsipc_recv+0x50>
+  802ccc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802cd1:	39 c6                	cmp    %eax,%esi
+  802cd3:	0f 4e c6             	cmovle %esi,%eax
+  802cd6:	39 c3                	cmp    %eax,%ebx
+  802cd8:	7f 1d                	jg     802cf7 <nsipc_recv+0x59>
+  802cda:	83 ec 04             	sub    $0x4,%esp
+  802cdd:	53                   	push   %ebx
+  802cde:	68 00 70 80 00       	push   $0x807000
+  802ce3:	ff 75 0c             	push   0xc(%ebp)
+  802ce6:	e8 8a dd ff ff       	call   800a75 <memmove>
+  802ceb:	83 c4 10             	add    $0x10,%esp
+  802cee:	89 d8                	mov    %ebx,%eax
+  802cf0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf3:	5b                   	pop    %ebx
+  802cf4:	5e                   	pop    %esi
+  802cf5:	5d                   	pop    %ebp
+  802cf6:	c3                   	ret
+  802cf7:	68 28 3d 80 00       	push   $0x803d28
+  802cfc:	68 3d 3d 80 00       	push   $0x803d3d
+  802d01:	6a 60                	push   $0x60
+  802d03:	68 52 3d 80 00       	push   $0x803d52
+  802d08:	e8 83 07 00 00       	call   803490 <_panic>
+
+00802d0d <nsipc_send>:
+  802d0d:	55                   	push   %ebp
+  802d0e:	89 e5                	mov    %esp,%ebp
+  802d10:	53                   	push   %ebx
+  802d11:	83 ec 04             	sub    $0x4,%esp
+  802d14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1a:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d1f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d25:	7f 2e                	jg     802d55 <nsipc_send+0x48>
+  802d27:	83 ec 04             	sub    $0x4,%esp
+  802d2a:	53                   	push   %ebx
+  802d2b:	ff 75 0c             	push   0xc(%ebp)
+  802d2e:	68 0c 70 80 00       	push   $0x80700c
+  802d33:	e8 3d dd ff ff       	call   800a75 <memmove>
+  802d38:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802d3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d41:	a3 08 70 80 00       	mov    %eax,0x807008
+  802d46:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d4b:	e8 f5 fd ff ff       	call   802b45 <nsipc>
+  802d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+  802d55:	68 5e 3d 80 00       	push   $0x803d5e
+  802d5a:	68 3d 3d 80 00       	push   $0x803d3d
+  802d5f:	6a 6b                	push   $0x6b
+  802d61:	68 52 3d 80 00       	push   $0x803d52
+  802d66:	e8 25 07 00 00       	call   803490 <_panic>
+
+00802d6b <nsipc_socket>:
+  802d6b:	55                   	push   %ebp
+  802d6c:	89 e5                	mov    %esp,%ebp
+  802d6e:	83 ec 08             	sub    $0x8,%esp
+  802d71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d74:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d7c:	a3 04 70 80 00       	mov    %eax,0x807004
+  802d81:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d84:	a3 08 70 80 00       	mov    %eax,0x807008
+  802d89:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d8e:	e8 b2 fd ff ff       	call   802b45 <nsipc>
+  802d93:	c9                   	leave
+  802d94:	c3                   	ret
+
+00802d95 <devpipe_stat>:
+  802d95:	55                   	push   %ebp
+  802d96:	89 e5                	mov    %esp,%ebp
+  802d98:	56                   	push   %esi
+  802d99:	53                   	push   %ebx
+  802d9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802d9d:	83 ec 0c             	sub    $0xc,%esp
+  802da0:	ff 75 08             	push   0x8(%ebp)
+  802da3:	e8 99 ef ff ff       	call   801d41 <fd2data>
+  802da8:	89 c6                	mov    %eax,%esi
+  802daa:	83 c4 08             	add    $0x8,%esp
+  802dad:	68 6a 3d 80 00       	push   $0x803d6a
+  802db2:	53                   	push   %ebx
+  802db3:	e8 0d db ff ff       	call   8008c5 <strcpy>
+  802db8:	8b 46 04             	mov    0x4(%esi),%eax
+  802dbb:	2b 06                	sub    (%esi),%eax
+  802dbd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802dc3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802dca:	00 00 00 
+  802dcd:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802dd4:	40 80 00 
+  802dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ddf:	5b                   	pop    %ebx
+  802de0:	5e                   	pop    %esi
+  802de1:	5d                   	pop    %ebp
+  802de2:	c3                   	ret
+
+00802de3 <devpipe_close>:
+  802de3:	55                   	push   %ebp
+  802de4:	89 e5                	mov    %esp,%ebp
+  802de6:	53                   	push   %ebx
+  802de7:	83 ec 0c             	sub    $0xc,%esp
+  802dea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ded:	53                   	push   %ebx
+  802dee:	6a 00                	push   $0x0
+  802df0:	e8 02 e0 ff ff       	call   800df7 <sys_page_unmap>
+  802df5:	89 1c 24             	mov    %ebx,(%esp)
+  802df8:	e8 44 ef ff ff       	call   801d41 <fd2data>
+  802dfd:	83 c4 08             	add    $0x8,%esp
+  802e00:	50                   	push   %eax
+  802e01:	6a 00                	push   $0x0
+  802e03:	e8 ef df ff ff       	call   800df7 <sys_page_unmap>
+  802e08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e0b:	c9                   	leave
+  802e0c:	c3                   	ret
+
+00802e0d <_pipeisclosed>:
+  802e0d:	55                   	push   %ebp
+  802e0e:	89 e5                	mov    %esp,%ebp
+  802e10:	57                   	push   %edi
+  802e11:	56                   	push   %esi
+  802e12:	53                   	push   %ebx
+  802e13:	83 ec 1c             	sub    $0x1c,%esp
+  802e16:	89 c7                	mov    %eax,%edi
+  802e18:	89 d6                	mov    %edx,%esi
+  802e1a:	a1 14 50 80 00       	mov    0x805014,%eax
+  802e1f:	8b 58 58             	mov    0x58(%eax),%ebx
+  802e22:	83 ec 0c             	sub    $0xc,%esp
+  802e25:	57                   	push   %edi
+  802e26:	e8 4e 07 00 00       	call   803579 <pageref>
+  802e2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e2e:	89 34 24             	mov    %esi,(%esp)
+  802e31:	e8 43 07 00 00       	call   803579 <pageref>
+  802e36:	8b 15 14 50 80 00    	mov    0x805014,%edx
+  802e3c:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802e3f:	83 c4 10             	add    $0x10,%esp
+  802e42:	39 cb                	cmp    %ecx,%ebx
+  802e44:	74 1b                	je     802e61 <_pipeisclosed+0x54>
+  802e46:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e49:	75 cf                	jne    802e1a <_pipeisclosed+0xd>
+  802e4b:	8b 42 58             	mov    0x58(%edx),%eax
+  802e4e:	6a 01                	push   $0x1
+  802e50:	50                   	push   %eax
+  802e51:	53                   	push   %ebx
+  802e52:	68 71 3d 80 00       	push   $0x803d71
+  802e57:	e8 72 d3 ff ff       	call   8001ce <cprintf>
+  802e5c:	83 c4 10             	add    $0x10,%esp
+  802e5f:	eb b9                	jmp    802e1a <_pipeisclosed+0xd>
+  802e61:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e64:	0f 94 c0             	sete   %al
+  802e67:	0f b6 c0             	movzbl %al,%eax
+  802e6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e6d:	5b                   	pop    %ebx
+  802e6e:	5e                   	pop    %esi
+  802e6f:	5f                   	pop    %edi
+  802e70:	5d                   	pop    %ebp
+  802e71:	c3                   	ret
+
+00802e72 <devpipe_write>:
+  802e72:	55                   	push   %ebp
+  802e73:	89 e5                	mov    %esp,%ebp
+  802e75:	57                   	push   %edi
+  802e76:	56                   	push   %esi
+  802e77:	53                   	push   %ebx
+  802e78:	83 ec 28             	sub    $0x28,%esp
+  802e7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e7e:	56                   	push   %esi
+  802e7f:	e8 bd ee ff ff       	call   801d41 <fd2data>
+  802e84:	89 c3                	mov    %eax,%ebx
+  802e86:	83 c4 10             	add    $0x10,%esp
+  802e89:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e8e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e92:	74 5c                	je     802ef0 <devpipe_write+0x7e>
+  802e94:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e97:	8b 0b                	mov    (%ebx),%ecx
+  802e99:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e9c:	39 d0                	cmp    %edx,%eax
+  802e9e:	72 1e                	jb     802ebe <devpipe_write+0x4c>
+  802ea0:	89 da                	mov    %ebx,%edx
+  802ea2:	89 f0                	mov    %esi,%eax
+  802ea4:	e8 64 ff ff ff       	call   802e0d <_pipeisclosed>
+  802ea9:	85 c0                	test   %eax,%eax
+  802eab:	75 48                	jne    802ef5 <devpipe_write+0x83>
+  802ead:	e8 28 de ff ff       	call   800cda <sys_yield>
+  802eb2:	8b 43 04             	mov    0x4(%ebx),%eax
+  802eb5:	8b 0b                	mov    (%ebx),%ecx
+  802eb7:	8d 51 20             	lea    0x20(%ecx),%edx
+  802eba:	39 d0                	cmp    %edx,%eax
+  802ebc:	73 e2                	jae    802ea0 <devpipe_write+0x2e>
+  802ebe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ec1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802ec5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ec8:	89 c2                	mov    %eax,%edx
+  802eca:	c1 fa 1f             	sar    $0x1f,%edx
+  802ecd:	89 d1                	mov    %edx,%ecx
+  802ecf:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ed2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ed5:	83 e2 1f             	and    $0x1f,%edx
+  802ed8:	29 ca                	sub    %ecx,%edx
+  802eda:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ede:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802ee2:	83 c0 01             	add    $0x1,%eax
+  802ee5:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ee8:	83 c7 01             	add    $0x1,%edi
+  802eeb:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802eee:	75 a4                	jne    802e94 <devpipe_write+0x22>
+  802ef0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ef3:	eb 05                	jmp    802efa <devpipe_write+0x88>
+  802ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802efd:	5b                   	pop    %ebx
+  802efe:	5e                   	pop    %esi
+  802eff:	5f                   	pop    %edi
+  802f00:	5d                   	pop    %ebp
+  802f01:	c3                   	ret
+
+00802f02 <devpipe_read>:
+  802f02:	55                   	push   %ebp
+  802f03:	89 e5                	mov    %esp,%ebp
+  802f05:	57                   	push   %edi
+  802f06:	56                   	push   %esi
+  802f07:	53                   	push   %ebx
+  802f08:	83 ec 18             	sub    $0x18,%esp
+  802f0b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f0e:	56                   	push   %esi
+  802f0f:	e8 2d ee ff ff       	call   801d41 <fd2data>
+  802f14:	89 c3                	mov    %eax,%ebx
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f1e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f22:	74 45                	je     802f69 <devpipe_read+0x67>
+  802f24:	8b 03                	mov    (%ebx),%eax
+  802f26:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f29:	75 1d                	jne    802f48 <devpipe_read+0x46>
+  802f2b:	85 ff                	test   %edi,%edi
+  802f2d:	75 3f                	jne    802f6e <devpipe_read+0x6c>
+  802f2f:	89 da                	mov    %ebx,%edx
+  802f31:	89 f0                	mov    %esi,%eax
+  802f33:	e8 d5 fe ff ff       	call   802e0d <_pipeisclosed>
+  802f38:	85 c0                	test   %eax,%eax
+  802f3a:	75 3c                	jne    802f78 <devpipe_read+0x76>
+  802f3c:	e8 99 dd ff ff       	call   800cda <sys_yield>
+  802f41:	8b 03                	mov    (%ebx),%eax
+  802f43:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f46:	74 e7                	je     802f2f <devpipe_read+0x2d>
+  802f48:	99                   	cltd
+  802f49:	c1 ea 1b             	shr    $0x1b,%edx
+  802f4c:	01 d0                	add    %edx,%eax
+  802f4e:	83 e0 1f             	and    $0x1f,%eax
+  802f51:	29 d0                	sub    %edx,%eax
+  802f53:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f5b:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802f5e:	83 03 01             	addl   $0x1,(%ebx)
+  802f61:	83 c7 01             	add    $0x1,%edi
+  802f64:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802f67:	75 bb                	jne    802f24 <devpipe_read+0x22>
+  802f69:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f6c:	eb 02                	jmp    802f70 <devpipe_read+0x6e>
+  802f6e:	89 f8                	mov    %edi,%eax
+  802f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f73:	5b                   	pop    %ebx
+  802f74:	5e                   	pop    %esi
+  802f75:	5f                   	pop    %edi
+  802f76:	5d                   	pop    %ebp
+  802f77:	c3                   	ret
+  802f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7d:	eb f1                	jmp    802f70 <devpipe_read+0x6e>
+
+00802f7f <pipe>:
+  802f7f:	55                   	push   %ebp
+  802f80:	89 e5                	mov    %esp,%ebp
+  802f82:	56                   	push   %esi
+  802f83:	53                   	push   %ebx
+  802f84:	83 ec 1c             	sub    $0x1c,%esp
+  802f87:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f8a:	50                   	push   %eax
+  802f8b:	e8 c8 ed ff ff       	call   801d58 <fd_alloc>
+  802f90:	89 c3                	mov    %eax,%ebx
+  802f92:	83 c4 10             	add    $0x10,%esp
+  802f95:	85 c0                	test   %eax,%eax
+  802f97:	0f 88 23 01 00 00    	js     8030c0 <pipe+0x141>
+  802f9d:	83 ec 04             	sub    $0x4,%esp
+  802fa0:	68 07 04 00 00       	push   $0x407
+  802fa5:	ff 75 f4             	push   -0xc(%ebp)
+  802fa8:	6a 00                	push   $0x0
+  802faa:	e8 76 dd ff ff       	call   800d25 <sys_page_alloc>
+  802faf:	89 c3                	mov    %eax,%ebx
+  802fb1:	83 c4 10             	add    $0x10,%esp
+  802fb4:	85 c0                	test   %eax,%eax
+  802fb6:	0f 88 04 01 00 00    	js     8030c0 <pipe+0x141>
+  802fbc:	83 ec 0c             	sub    $0xc,%esp
+  802fbf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802fc2:	50                   	push   %eax
+  802fc3:	e8 90 ed ff ff       	call   801d58 <fd_alloc>
+  802fc8:	89 c3                	mov    %eax,%ebx
+  802fca:	83 c4 10             	add    $0x10,%esp
+  802fcd:	85 c0                	test   %eax,%eax
+  802fcf:	0f 88 db 00 00 00    	js     8030b0 <pipe+0x131>
+  802fd5:	83 ec 04             	sub    $0x4,%esp
+  802fd8:	68 07 04 00 00       	push   $0x407
+  802fdd:	ff 75 f0             	push   -0x10(%ebp)
+  802fe0:	6a 00                	push   $0x0
+  802fe2:	e8 3e dd ff ff       	call   800d25 <sys_page_alloc>
+  802fe7:	89 c3                	mov    %eax,%ebx
+  802fe9:	83 c4 10             	add    $0x10,%esp
+  802fec:	85 c0                	test   %eax,%eax
+  802fee:	0f 88 bc 00 00 00    	js     8030b0 <pipe+0x131>
+  802ff4:	83 ec 0c             	sub    $0xc,%esp
+  802ff7:	ff 75 f4             	push   -0xc(%ebp)
+  802ffa:	e8 42 ed ff ff       	call   801d41 <fd2data>
+  802fff:	89 c6                	mov    %eax,%esi
+  803001:	83 c4 0c             	add    $0xc,%esp
+  803004:	68 07 04 00 00       	push   $0x407
+  803009:	50                   	push   %eax
+  80300a:	6a 00                	push   $0x0
+  80300c:	e8 14 dd ff ff       	call   800d25 <sys_page_alloc>
+  803011:	89 c3                	mov    %eax,%ebx
+  803013:	83 c4 10             	add    $0x10,%esp
+  803016:	85 c0                	test   %eax,%eax
+  803018:	0f 88 82 00 00 00    	js     8030a0 <pipe+0x121>
+  80301e:	83 ec 0c             	sub    $0xc,%esp
+  803021:	ff 75 f0             	push   -0x10(%ebp)
+  803024:	e8 18 ed ff ff       	call   801d41 <fd2data>
+  803029:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803030:	50                   	push   %eax
+  803031:	6a 00                	push   $0x0
+  803033:	56                   	push   %esi
+  803034:	6a 00                	push   $0x0
+  803036:	e8 2d dd ff ff       	call   800d68 <sys_page_map>
+  80303b:	89 c3                	mov    %eax,%ebx
+  80303d:	83 c4 20             	add    $0x20,%esp
+  803040:	85 c0                	test   %eax,%eax
+  803042:	78 4e                	js     803092 <pipe+0x113>
+  803044:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  803049:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80304c:	89 02                	mov    %eax,(%edx)
+  80304e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803051:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803058:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80305b:	89 02                	mov    %eax,(%edx)
+  80305d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803060:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803067:	83 ec 0c             	sub    $0xc,%esp
+  80306a:	ff 75 f4             	push   -0xc(%ebp)
+  80306d:	e8 bf ec ff ff       	call   801d31 <fd2num>
+  803072:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803075:	89 01                	mov    %eax,(%ecx)
+  803077:	83 c4 04             	add    $0x4,%esp
+  80307a:	ff 75 f0             	push   -0x10(%ebp)
+  80307d:	e8 af ec ff ff       	call   801d31 <fd2num>
+  803082:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803085:	89 41 04             	mov    %eax,0x4(%ecx)
+  803088:	83 c4 10             	add    $0x10,%esp
+  80308b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803090:	eb 2e                	jmp    8030c0 <pipe+0x141>
+  803092:	83 ec 08             	sub    $0x8,%esp
+  803095:	56                   	push   %esi
+  803096:	6a 00                	push   $0x0
+  803098:	e8 5a dd ff ff       	call   800df7 <sys_page_unmap>
+  80309d:	83 c4 10             	add    $0x10,%esp
+  8030a0:	83 ec 08             	sub    $0x8,%esp
+  8030a3:	ff 75 f0             	push   -0x10(%ebp)
+  8030a6:	6a 00                	push   $0x0
+  8030a8:	e8 4a dd ff ff       	call   800df7 <sys_page_unmap>
+  8030ad:	83 c4 10             	add    $0x10,%esp
+  8030b0:	83 ec 08             	sub    $0x8,%esp
+  8030b3:	ff 75 f4             	push   -0xc(%ebp)
+  8030b6:	6a 00                	push   $0x0
+  8030b8:	e8 3a dd ff ff       	call   800df7 <sys_page_unmap>
+  8030bd:	83 c4 10             	add    $0x10,%esp
+  8030c0:	89 d8                	mov    %ebx,%eax
+  8030c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030c5:	5b                   	pop    %ebx
+  8030c6:	5e                   	pop    %esi
+  8030c7:	5d                   	pop    %ebp
+  8030c8:	c3                   	ret
+
+008030c9 <pipeisclosed>:
+  8030c9:	55                   	push   %ebp
+  8030ca:	89 e5                	mov    %esp,%ebp
+  8030cc:	83 ec 20             	sub    $0x20,%esp
+  8030cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030d2:	50                   	push   %eax
+  8030d3:	ff 75 08             	push   0x8(%ebp)
+  8030d6:	e8 cd ec ff ff       	call   801da8 <fd_lookup>
+  8030db:	83 c4 10             	add    $0x10,%esp
+  8030de:	85 c0                	test   %eax,%eax
+  8030e0:	78 18                	js     8030fa <pipeisclosed+0x31>
+  8030e2:	83 ec 0c             	sub    $0xc,%esp
+  8030e5:	ff 75 f4             	push   -0xc(%ebp)
+  8030e8:	e8 54 ec ff ff       	call   801d41 <fd2data>
+  8030ed:	89 c2                	mov    %eax,%edx
+  8030ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030f2:	e8 16 fd ff ff       	call   802e0d <_pipeisclosed>
+  8030f7:	83 c4 10             	add    $0x10,%esp
+  8030fa:	c9                   	leave
+  8030fb:	c3                   	ret
+
+008030fc <ipcring_init>:
+  8030fc:	55                   	push   %ebp
+  8030fd:	89 e5                	mov    %esp,%ebp
+  8030ff:	53                   	push   %ebx
+  803100:	83 ec 08             	sub    $0x8,%esp
+  803103:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803106:	6a 60                	push   $0x60
+  803108:	6a 00                	push   $0x0
+  80310a:	53                   	push   %ebx
+  80310b:	e8 30 d9 ff ff       	call   800a40 <memset>
+  803110:	a1 14 50 80 00       	mov    0x805014,%eax
+  803115:	8b 40 48             	mov    0x48(%eax),%eax
+  803118:	89 03                	mov    %eax,(%ebx)
+  80311a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80311d:	89 43 04             	mov    %eax,0x4(%ebx)
+  803120:	8b 45 10             	mov    0x10(%ebp),%eax
+  803123:	89 43 08             	mov    %eax,0x8(%ebx)
+  803126:	8b 45 14             	mov    0x14(%ebp),%eax
+  803129:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80312c:	83 c4 10             	add    $0x10,%esp
+  80312f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803132:	c9                   	leave
+  803133:	c3                   	ret
+
+00803134 <ipcring_req_slot>:
+  803134:	55                   	push   %ebp
+  803135:	89 e5                	mov    %esp,%ebp
+  803137:	8b 45 08             	mov    0x8(%ebp),%eax
+  80313a:	8b 50 10             	mov    0x10(%eax),%edx
+  80313d:	8b 48 18             	mov    0x18(%eax),%ecx
+  803140:	29 ca                	sub    %ecx,%edx
+  803142:	83 fa 07             	cmp    $0x7,%edx
+  803145:	77 0c                	ja     803153 <ipcring_req_slot+0x1f>
+  803147:	8b 50 10             	mov    0x10(%eax),%edx
+  80314a:	83 e2 07             	and    $0x7,%edx
+  80314d:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803151:	5d                   	pop    %ebp
+  803152:	c3                   	ret
+  803153:	b8 00 00 00 00       	mov    $0x0,%eax
+  803158:	eb f7                	jmp    803151 <ipcring_req_slot+0x1d>
+
+0080315a <ipcring_req_push>:
+  80315a:	55                   	push   %ebp
+  80315b:	89 e5                	mov    %esp,%ebp
+  80315d:	83 ec 08             	sub    $0x8,%esp
+  803160:	8b 55 08             	mov    0x8(%ebp),%edx
+  803163:	8b 42 10             	mov    0x10(%edx),%eax
+  803166:	83 c0 01             	add    $0x1,%eax
+  803169:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80316d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803172:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803176:	85 c0                	test   %eax,%eax
+  803178:	75 02                	jne    80317c <ipcring_req_push+0x22>
+  80317a:	c9                   	leave
+  80317b:	c3                   	ret
+  80317c:	6a 00                	push   $0x0
+  80317e:	68 00 00 80 ee       	push   $0xee800000
+  803183:	ff 72 08             	push   0x8(%edx)
+  803186:	ff 72 04             	push   0x4(%edx)
+  803189:	e8 cf de ff ff       	call   80105d <sys_ipc_send>
+  80318e:	83 c4 10             	add    $0x10,%esp
+  803191:	eb e7                	jmp    80317a <ipcring_req_push+0x20>
+
+00803193 <ipcring_rsp_wait>:
+  803193:	55                   	push   %ebp
+  803194:	89 e5                	mov    %esp,%ebp
+  803196:	53                   	push   %ebx
+  803197:	83 ec 04             	sub    $0x4,%esp
+  80319a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80319d:	8b 53 18             	mov    0x18(%ebx),%edx
+  8031a0:	8b 43 10             	mov    0x10(%ebx),%eax
+  8031a3:	39 c2                	cmp    %eax,%edx
+  8031a5:	74 3c                	je     8031e3 <ipcring_rsp_wait+0x50>
+  8031a7:	8b 53 14             	mov    0x14(%ebx),%edx
+  8031aa:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031ad:	39 c2                	cmp    %eax,%edx
+  8031af:	75 23                	jne    8031d4 <ipcring_rsp_wait+0x41>
+  8031b1:	83 ec 08             	sub    $0x8,%esp
+  8031b4:	6a 00                	push   $0x0
+  8031b6:	6a 00                	push   $0x0
+  8031b8:	6a 00                	push   $0x0
+  8031ba:	6a 00                	push   $0x0
+  8031bc:	ff 73 0c             	push   0xc(%ebx)
+  8031bf:	ff 73 04             	push   0x4(%ebx)
+  8031c2:	e8 b5 e9 ff ff       	call   801b7c <ipc_call>
+  8031c7:	8b 53 14             	mov    0x14(%ebx),%edx
+  8031ca:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031cd:	83 c4 20             	add    $0x20,%esp
+  8031d0:	39 c2                	cmp    %eax,%edx
+  8031d2:	74 dd                	je     8031b1 <ipcring_rsp_wait+0x1e>
+  8031d4:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031d7:	83 e0 07             	and    $0x7,%eax
+  8031da:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8031de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031e1:	c9                   	leave
+  8031e2:	c3                   	ret
+  8031e3:	68 8c 3d 80 00       	push   $0x803d8c
+  8031e8:	68 3d 3d 80 00       	push   $0x803d3d
+  8031ed:	6a 3b                	push   $0x3b
+  8031ef:	68 ad 3d 80 00       	push   $0x803dad
+  8031f4:	e8 97 02 00 00       	call   803490 <_panic>
+
+008031f9 <ipcring_rsp_pop>:
+  8031f9:	55                   	push   %ebp
+  8031fa:	89 e5                	mov    %esp,%ebp
+  8031fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031ff:	8b 42 18             	mov    0x18(%edx),%eax
+  803202:	83 c0 01             	add    $0x1,%eax
+  803205:	89 42 18             	mov    %eax,0x18(%edx)
+  803208:	5d                   	pop    %ebp
+  803209:	c3                   	ret
+
+0080320a <ipcring_server_init>:
+  80320a:	55                   	push   %ebp
+  80320b:	89 e5                	mov    %esp,%ebp
+  80320d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803210:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803213:	89 10                	mov    %edx,(%eax)
+  803215:	8b 55 10             	mov    0x10(%ebp),%edx
+  803218:	89 50 04             	mov    %edx,0x4(%eax)
+  80321b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803222:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803229:	5d                   	pop    %ebp
+  80322a:	c3                   	ret
+
+0080322b <ipcring_req_avail>:
+  80322b:	55                   	push   %ebp
+  80322c:	89 e5                	mov    %esp,%ebp
+  80322e:	8b 55 08             	mov    0x8(%ebp),%edx
+  803231:	8b 02                	mov    (%edx),%eax
+  803233:	8b 40 10             	mov    0x10(%eax),%eax
+  803236:	2b 42 08             	sub    0x8(%edx),%eax
+  803239:	ba 08 00 00 00       	mov    $0x8,%edx
+  80323e:	39 d0                	cmp    %edx,%eax
+  803240:	0f 47 c2             	cmova  %edx,%eax
+  803243:	5d                   	pop    %ebp
+  803244:	c3                   	ret
+
+00803245 <ipcring_req_peek>:
+  803245:	55                   	push   %ebp
+  803246:	89 e5                	mov    %esp,%ebp
+  803248:	8b 55 08             	mov    0x8(%ebp),%edx
+  80324b:	8b 42 08             	mov    0x8(%edx),%eax
+  80324e:	83 e0 07             	and    $0x7,%eax
+  803251:	8b 12                	mov    (%edx),%edx
+  803253:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803257:	5d                   	pop    %ebp
+  803258:	c3                   	ret
+
+00803259 <ipcring_rsp_push>:
+  803259:	55                   	push   %ebp
+  80325a:	89 e5                	mov    %esp,%ebp
+  80325c:	83 ec 08             	sub    $0x8,%esp
+  80325f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803262:	8b 41 08             	mov    0x8(%ecx),%eax
+  803265:	83 c0 01             	add    $0x1,%eax
+  803268:	89 41 08             	mov    %eax,0x8(%ecx)
+  80326b:	8b 11                	mov    (%ecx),%edx
+  80326d:	83 c2 14             	add    $0x14,%edx
+  803270:	f0 87 02             	lock xchg %eax,(%edx)
+  803273:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803277:	75 02                	jne    80327b <ipcring_rsp_push+0x22>
+  803279:	c9                   	leave
+  80327a:	c3                   	ret
+  80327b:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803282:	6a 00                	push   $0x0
+  803284:	68 00 00 80 ee       	push   $0xee800000
+  803289:	6a 00                	push   $0x0
+  80328b:	ff 71 04             	push   0x4(%ecx)
+  80328e:	e8 ed dc ff ff       	call   800f80 <sys_ipc_try_send>
+  803293:	83 c4 10             	add    $0x10,%esp
+  803296:	eb e1                	jmp    803279 <ipcring_rsp_push+0x20>
+
+00803298 <ipcring_client_wait>:
+  803298:	55                   	push   %ebp
+  803299:	89 e5                	mov    %esp,%ebp
+  80329b:	83 ec 08             	sub    $0x8,%esp
+  80329e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a1:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8032a8:	8b 10                	mov    (%eax),%edx
+  8032aa:	8b 52 18             	mov    0x18(%edx),%edx
+  8032ad:	3b 50 08             	cmp    0x8(%eax),%edx
+  8032b0:	75 02                	jne    8032b4 <ipcring_client_wait+0x1c>
+  8032b2:	c9                   	leave
+  8032b3:	c3                   	ret
+  8032b4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8032bb:	6a 00                	push   $0x0
+  8032bd:	68 00 00 80 ee       	push   $0xee800000
+  8032c2:	6a 00                	push   $0x0
+  8032c4:	ff 70 04             	push   0x4(%eax)
+  8032c7:	e8 b4 dc ff ff       	call   800f80 <sys_ipc_try_send>
+  8032cc:	83 c4 10             	add    $0x10,%esp
+  8032cf:	eb e1                	jmp    8032b2 <ipcring_client_wait+0x1a>
+
+008032d1 <ipcring_server_sleep>:
+  8032d1:	55                   	push   %ebp
+  8032d2:	89 e5                	mov    %esp,%ebp
+  8032d4:	53                   	push   %ebx
+  8032d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032d8:	8b 01                	mov    (%ecx),%eax
+  8032da:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8032dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032e2:	f0 87 02             	lock xchg %eax,(%edx)
+  8032e5:	8b 11                	mov    (%ecx),%edx
+  8032e7:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8032ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032ef:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8032f2:	74 0e                	je     803302 <ipcring_server_sleep+0x31>
+  8032f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f9:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8032fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803305:	c9                   	leave
+  803306:	c3                   	ret
+
+00803307 <devcons_close>:
+  803307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330c:	c3                   	ret
+
+0080330d <devcons_stat>:
+  80330d:	55                   	push   %ebp
+  80330e:	89 e5                	mov    %esp,%ebp
+  803310:	83 ec 10             	sub    $0x10,%esp
+  803313:	68 bb 3d 80 00       	push   $0x803dbb
+  803318:	ff 75 0c             	push   0xc(%ebp)
+  80331b:	e8 a5 d5 ff ff       	call   8008c5 <strcpy>
+  803320:	b8 00 00 00 00       	mov    $0x0,%eax
+  803325:	c9                   	leave
+  803326:	c3                   	ret
+
+00803327 <devcons_write>:
+  803327:	55                   	push   %ebp
+  803328:	89 e5                	mov    %esp,%ebp
+  80332a:	57                   	push   %edi
+  80332b:	56                   	push   %esi
+  80332c:	53                   	push   %ebx
+  80332d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803333:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803336:	85 ff                	test   %edi,%edi
+  803338:	74 51                	je     80338b <devcons_write+0x64>
+  80333a:	be 00 00 00 00       	mov    $0x0,%esi
+  80333f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803344:	89 fb                	mov    %edi,%ebx
+  803346:	29 c3                	sub    %eax,%ebx
+  803348:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80334d:	39 d3                	cmp    %edx,%ebx
+  80334f:	0f 47 da             	cmova  %edx,%ebx
+  803352:	83 ec 04             	sub    $0x4,%esp
+  803355:	53                   	push   %ebx
+  803356:	03 45 0c             	add    0xc(%ebp),%eax
+  803359:	50                   	push   %eax
+  80335a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803360:	50                   	push   %eax
+  803361:	e8 0f d7 ff ff       	call   800a75 <memmove>
+  803366:	83 c4 08             	add    $0x8,%esp
+  803369:	53                   	push   %ebx
+  80336a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803370:	50                   	push   %eax
+  803371:	e8 c7 d8 ff ff       	call   800c3d <sys_cputs>
+  803376:	01 de                	add    %ebx,%esi
+  803378:	89 f0                	mov    %esi,%eax
+  80337a:	83 c4 10             	add    $0x10,%esp
+  80337d:	39 fe                	cmp    %edi,%esi
+  80337f:	72 c3                	jb     803344 <devcons_write+0x1d>
+  803381:	89 f0                	mov    %esi,%eax
+  803383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803386:	5b                   	pop    %ebx
+  803387:	5e                   	pop    %esi
+  803388:	5f                   	pop    %edi
+  803389:	5d                   	pop    %ebp
+  80338a:	c3                   	ret
+  80338b:	be 00 00 00 00       	mov    $0x0,%esi
+  803390:	eb ef                	jmp    803381 <devcons_write+0x5a>
+
+00803392 <devcons_read>:
+  803392:	55                   	push   %ebp
+  803393:	89 e5                	mov    %esp,%ebp
+  803395:	83 ec 08             	sub    $0x8,%esp
+  803398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033a1:	75 07                	jne    8033aa <devcons_read+0x18>
+  8033a3:	eb 1f                	jmp    8033c4 <devcons_read+0x32>
+  8033a5:	e8 30 d9 ff ff       	call   800cda <sys_yield>
+  8033aa:	e8 ac d8 ff ff       	call   800c5b <sys_cgetc>
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	74 f2                	je     8033a5 <devcons_read+0x13>
+  8033b3:	78 0f                	js     8033c4 <devcons_read+0x32>
+  8033b5:	83 f8 04             	cmp    $0x4,%eax
+  8033b8:	74 0c                	je     8033c6 <devcons_read+0x34>
+  8033ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033bd:	88 02                	mov    %al,(%edx)
+  8033bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033c4:	c9                   	leave
+  8033c5:	c3                   	ret
+  8033c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cb:	eb f7                	jmp    8033c4 <devcons_read+0x32>
+
+008033cd <cputchar>:
+  8033cd:	55                   	push   %ebp
+  8033ce:	89 e5                	mov    %esp,%ebp
+  8033d0:	83 ec 20             	sub    $0x20,%esp
+  8033d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8033d9:	6a 01                	push   $0x1
+  8033db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033de:	50                   	push   %eax
+  8033df:	e8 59 d8 ff ff       	call   800c3d <sys_cputs>
+  8033e4:	83 c4 10             	add    $0x10,%esp
+  8033e7:	c9                   	leave
+  8033e8:	c3                   	ret
+
+008033e9 <getchar>:
+  8033e9:	55                   	push   %ebp
+  8033ea:	89 e5                	mov    %esp,%ebp
+  8033ec:	83 ec 1c             	sub    $0x1c,%esp
+  8033ef:	6a 01                	push   $0x1
+  8033f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033f4:	50                   	push   %eax
+  8033f5:	6a 00                	push   $0x0
+  8033f7:	e8 0e ec ff ff       	call   80200a <read>
+  8033fc:	83 c4 10             	add    $0x10,%esp
+  8033ff:	85 c0                	test   %eax,%eax
+  803401:	78 06                	js     803409 <getchar+0x20>
+  803403:	74 06                	je     80340b <getchar+0x22>
+  803405:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803409:	c9                   	leave
+  80340a:	c3                   	ret
+  80340b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803410:	eb f7                	jmp    803409 <getchar+0x20>
+
+00803412 <iscons>:
+  803412:	55                   	push   %ebp
+  803413:	89 e5                	mov    %esp,%ebp
+  803415:	83 ec 20             	sub    $0x20,%esp
+  803418:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80341b:	50                   	push   %eax
+  80341c:	ff 75 08             	push   0x8(%ebp)
+  80341f:	e8 84 e9 ff ff       	call   801da8 <fd_lookup>
+  803424:	83 c4 10             	add    $0x10,%esp
+  803427:	85 c0                	test   %eax,%eax
+  803429:	78 11                	js     80343c <iscons+0x2a>
+  80342b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80342e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803434:	39 10                	cmp    %edx,(%eax)
+  803436:	0f 94 c0             	sete   %al
+  803439:	0f b6 c0             	movzbl %al,%eax
+  80343c:	c9                   	leave
+  80343d:	c3                   	ret
+
+0080343e <opencons>:
+  80343e:	55                   	push   %ebp
+  80343f:	89 e5                	mov    %esp,%ebp
+  803441:	83 ec 24             	sub    $0x24,%esp
+  803444:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803447:	50                   	push   %eax
+  803448:	e8 0b e9 ff ff       	call   801d58 <fd_alloc>
+  80344d:	83 c4 10             	add    $0x10,%esp
+  803450:	85 c0                	test   %eax,%eax
+  803452:	78 3a                	js     80348e <opencons+0x50>
+  803454:	83 ec 04             	sub    $0x4,%esp
+  803457:	68 07 04 00 00       	push   $0x407
+  80345c:	ff 75 f4             	push   -0xc(%ebp)
+  80345f:	6a 00                	push   $0x0
+  803461:	e8 bf d8 ff ff       	call   800d25 <sys_page_alloc>
+  803466:	83 c4 10             	add    $0x10,%esp
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	78 21                	js     80348e <opencons+0x50>
+  80346d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803470:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803476:	89 10                	mov    %edx,(%eax)
+  803478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803482:	83 ec 0c             	sub    $0xc,%esp
+  803485:	50                   	push   %eax
+  803486:	e8 a6 e8 ff ff       	call   801d31 <fd2num>
+  80348b:	83 c4 10             	add    $0x10,%esp
+  80348e:	c9                   	leave
+  80348f:	c3                   	ret
+
+00803490 <_panic>:
+  803490:	55                   	push   %ebp
+  803491:	89 e5                	mov    %esp,%ebp
+  803493:	56                   	push   %esi
+  803494:	53                   	push   %ebx
+  803495:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  803498:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80349e:	e8 18 d8 ff ff       	call   800cbb <sys_getenvid>
+  8034a3:	83 ec 0c             	sub    $0xc,%esp
+  8034a6:	ff 75 0c             	push   0xc(%ebp)
+  8034a9:	ff 75 08             	push   0x8(%ebp)
+  8034ac:	56                   	push   %esi
+  8034ad:	50                   	push   %eax
+  8034ae:	68 c8 3d 80 00       	push   $0x803dc8
+  8034b3:	e8 16 cd ff ff       	call   8001ce <cprintf>
+  8034b8:	83 c4 18             	add    $0x18,%esp
+  8034bb:	53                   	push   %ebx
+  8034bc:	ff 75 10             	push   0x10(%ebp)
+  8034bf:	e8 b9 cc ff ff       	call   80017d <vcprintf>
+  8034c4:	c7 04 24 82 3d 80 00 	movl   $0x803d82,(%esp)
+  8034cb:	e8 fe cc ff ff       	call   8001ce <cprintf>
+  8034d0:	83 c4 10             	add    $0x10,%esp
+  8034d3:	cc                   	int3
+  8034d4:	eb fd                	jmp    8034d3 <_panic+0x43>
+
+008034d6 <set_pgfault_handler>:
+  8034d6:	55                   	push   %ebp
+  8034d7:	89 e5                	mov    %esp,%ebp
+  8034d9:	53                   	push   %ebx
+  8034da:	83 ec 04             	sub    $0x4,%esp
+  8034dd:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8034e4:	74 0d                	je     8034f3 <set_pgfault_handler+0x1d>
+  8034e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e9:	a3 00 80 80 00       	mov    %eax,0x808000
+  8034ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034f1:	c9                   	leave
+  8034f2:	c3                   	ret
+  8034f3:	e8 c3 d7 ff ff       	call   800cbb <sys_getenvid>
+  8034f8:	89 c3                	mov    %eax,%ebx
+  8034fa:	83 ec 04             	sub    $0x4,%esp
+  8034fd:	6a 07                	push   $0x7
+  8034ff:	68 00 f0 7f ee       	push   $0xee7ff000
+  803504:	50                   	push   %eax
+  803505:	e8 1b d8 ff ff       	call   800d25 <sys_page_alloc>
+  80350a:	83 c4 10             	add    $0x10,%esp
+  80350d:	85 c0                	test   %eax,%eax
+  80350f:	78 29                	js     80353a <set_pgfault_handler+0x64>
+  803511:	83 ec 08             	sub    $0x8,%esp
+  803514:	68 4e 35 80 00       	push   $0x80354e
+  803519:	53                   	push   %ebx
+  80351a:	e8 1f da ff ff       	call   800f3e <sys_env_set_pgfault_upcall>
+  80351f:	83 c4 10             	add    $0x10,%esp
+  803522:	85 c0                	test   %eax,%eax
+  803524:	79 c0                	jns    8034e6 <set_pgfault_handler+0x10>
+  803526:	83 ec 04             	sub    $0x4,%esp
+  803529:	68 24 3e 80 00       	push   $0x803e24
+  80352e:	6a 27                	push   $0x27
+  803530:	68 56 3e 80 00       	push   $0x803e56
+  803535:	e8 56 ff ff ff       	call   803490 <_panic>
+  80353a:	83 ec 04             	sub    $0x4,%esp
+  80353d:	68 ec 3d 80 00       	push   $0x803dec
+  803542:	6a 23                	push   $0x23
+  803544:	68 56 3e 80 00       	push   $0x803e56
+  803549:	e8 42 ff ff ff       	call   803490 <_panic>
+
+0080354e <_pgfault_upcall>:
+  80354e:	54                   	push   %esp
+  80354f:	a1 00 80 80 00       	mov    0x808000,%eax
+  803554:	ff d0                	call   *%eax
+  803556:	83 c4 04             	add    $0x4,%esp
+  803559:	89 e3                	mov    %esp,%ebx
+  80355b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80355f:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803563:	89 d4                	mov    %edx,%esp
+  803565:	51                   	push   %ecx
+  803566:	89 dc                	mov    %ebx,%esp
+  803568:	83 ea 04             	sub    $0x4,%edx
+  80356b:	89 54 24 30          	mov    %edx,0x30(%esp)
+  80356f:	83 c4 08             	add    $0x8,%esp
+  803572:	61                   	popa
+  803573:	83 c4 04             	add    $0x4,%esp
+  803576:	9d                   	popf
+  803577:	5c                   	pop    %esp
+  803578:	c3                   	ret
+
+00803579 <pageref>:
+  803579:	55                   	push   %ebp
+  80357a:	89 e5                	mov    %esp,%ebp
+  80357c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80357f:	89 c2                	mov    %eax,%edx
+  803581:	c1 ea 16             	shr    $0x16,%edx
+  803584:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80358b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803590:	f6 c1 01             	test   $0x1,%cl
+  803593:	74 22                	je     8035b7 <pageref+0x3e>
+  803595:	c1 e8 0c             	shr    $0xc,%eax
+  803598:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80359f:	a8 01                	test   $0x1,%al
+  8035a1:	74 14                	je     8035b7 <pageref+0x3e>
+  8035a3:	c1 e8 0c             	shr    $0xc,%eax
+  8035a6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035a9:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035b0:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035b4:	0f b7 d2             	movzwl %dx,%edx
+  8035b7:	89 d0                	mov    %edx,%eax
+  8035b9:	5d                   	pop    %ebp
+  8035ba:	c3                   	ret
+
+008035bb <__udivmoddi4>:
+  8035bb:	55                   	push   %ebp
+  8035bc:	57                   	push   %edi
+  8035bd:	56                   	push   %esi
+  8035be:	53                   	push   %ebx
+  8035bf:	83 ec 24             	sub    $0x24,%esp
+  8035c2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035c6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035ca:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035ce:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035d2:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8035d6:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8035da:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035de:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035e2:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8035e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035f5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035fc:	00 
+  8035fd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803604:	00 
+  803605:	89 fb                	mov    %edi,%ebx
+  803607:	eb 08                	jmp    803611 <__udivmoddi4+0x56>
+  803609:	83 e9 01             	sub    $0x1,%ecx
+  80360c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80360f:	74 68                	je     803679 <__udivmoddi4+0xbe>
+  803611:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803615:	01 c0                	add    %eax,%eax
+  803617:	89 c6                	mov    %eax,%esi
+  803619:	89 d7                	mov    %edx,%edi
+  80361b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80361f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803623:	0f ad d0             	shrd   %cl,%edx,%eax
+  803626:	d3 ea                	shr    %cl,%edx
+  803628:	f6 c1 20             	test   $0x20,%cl
+  80362b:	74 04                	je     803631 <__udivmoddi4+0x76>
+  80362d:	89 d0                	mov    %edx,%eax
+  80362f:	31 d2                	xor    %edx,%edx
+  803631:	83 e0 01             	and    $0x1,%eax
+  803634:	89 04 24             	mov    %eax,(%esp)
+  803637:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80363e:	00 
+  80363f:	8b 04 24             	mov    (%esp),%eax
+  803642:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803646:	09 f0                	or     %esi,%eax
+  803648:	09 fa                	or     %edi,%edx
+  80364a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80364e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803652:	39 f0                	cmp    %esi,%eax
+  803654:	89 d5                	mov    %edx,%ebp
+  803656:	19 fd                	sbb    %edi,%ebp
+  803658:	72 af                	jb     803609 <__udivmoddi4+0x4e>
+  80365a:	29 f0                	sub    %esi,%eax
+  80365c:	19 fa                	sbb    %edi,%edx
+  80365e:	89 cf                	mov    %ecx,%edi
+  803660:	c1 ef 05             	shr    $0x5,%edi
+  803663:	83 e7 01             	and    $0x1,%edi
+  803666:	89 fe                	mov    %edi,%esi
+  803668:	83 f6 01             	xor    $0x1,%esi
+  80366b:	d3 e6                	shl    %cl,%esi
+  80366d:	d3 e7                	shl    %cl,%edi
+  80366f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803673:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803677:	eb 90                	jmp    803609 <__udivmoddi4+0x4e>
+  803679:	85 db                	test   %ebx,%ebx
+  80367b:	74 05                	je     803682 <__udivmoddi4+0xc7>
+  80367d:	89 03                	mov    %eax,(%ebx)
+  80367f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803682:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803686:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80368a:	83 c4 24             	add    $0x24,%esp
+  80368d:	5b                   	pop    %ebx
+  80368e:	5e                   	pop    %esi
+  80368f:	5f                   	pop    %edi
+  803690:	5d                   	pop    %ebp
+  803691:	c3                   	ret
+
+00803692 <__udivdi3>:
+  803692:	83 ec 08             	sub    $0x8,%esp
+  803695:	6a 00                	push   $0x0
+  803697:	ff 74 24 1c          	push   0x1c(%esp)
+  80369b:	ff 74 24 1c          	push   0x1c(%esp)
+  80369f:	ff 74 24 1c          	push   0x1c(%esp)
+  8036a3:	ff 74 24 1c          	push   0x1c(%esp)
+  8036a7:	e8 0f ff ff ff       	call   8035bb <__udivmoddi4>
+  8036ac:	83 c4 1c             	add    $0x1c,%esp
+  8036af:	c3                   	ret
+
+008036b0 <__umoddi3>:
+  8036b0:	83 ec 18             	sub    $0x18,%esp
+  8036b3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036b7:	50                   	push   %eax
+  8036b8:	ff 74 24 2c          	push   0x2c(%esp)
+  8036bc:	ff 74 24 2c          	push   0x2c(%esp)
+  8036c0:	ff 74 24 2c          	push   0x2c(%esp)
+  8036c4:	ff 74 24 2c          	push   0x2c(%esp)
+  8036c8:	e8 ee fe ff ff       	call   8035bb <__udivmoddi4>
+  8036cd:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8036d1:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8036d5:	83 c4 2c             	add    $0x2c,%esp
+  8036d8:	c3                   	ret
+
+008036d9 <__divdi3>:
+  8036d9:	53                   	push   %ebx
+  8036da:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036de:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036e2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036e6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036ea:	85 d2                	test   %edx,%edx
+  8036ec:	78 12                	js     803700 <__divdi3+0x27>
+  8036ee:	85 db                	test   %ebx,%ebx
+  8036f0:	78 2e                	js     803720 <__divdi3+0x47>
+  8036f2:	53                   	push   %ebx
+  8036f3:	51                   	push   %ecx
+  8036f4:	52                   	push   %edx
+  8036f5:	50                   	push   %eax
+  8036f6:	e8 97 ff ff ff       	call   803692 <__udivdi3>
+  8036fb:	83 c4 10             	add    $0x10,%esp
+  8036fe:	eb 1e                	jmp    80371e <__divdi3+0x45>
+  803700:	f7 d8                	neg    %eax
+  803702:	83 d2 00             	adc    $0x0,%edx
+  803705:	f7 da                	neg    %edx
+  803707:	85 db                	test   %ebx,%ebx
+  803709:	78 2a                	js     803735 <__divdi3+0x5c>
+  80370b:	53                   	push   %ebx
+  80370c:	51                   	push   %ecx
+  80370d:	52                   	push   %edx
+  80370e:	50                   	push   %eax
+  80370f:	e8 7e ff ff ff       	call   803692 <__udivdi3>
+  803714:	83 c4 10             	add    $0x10,%esp
+  803717:	f7 d8                	neg    %eax
+  803719:	83 d2 00             	adc    $0x0,%edx
+  80371c:	f7 da                	neg    %edx
+  80371e:	5b                   	pop    %ebx
+  80371f:	c3                   	ret
+  803720:	f7 d9                	neg    %ecx
+  803722:	83 d3 00             	adc    $0x0,%ebx
+  803725:	f7 db                	neg    %ebx
+  803727:	53                   	push   %ebx
+  803728:	51                   	push   %ecx
+  803729:	52                   	push   %edx
+  80372a:	50                   	push   %eax
+  80372b:	e8 62 ff ff ff       	call   803692 <__udivdi3>
+  803730:	83 c4 10             	add    $0x10,%esp
+  803733:	eb e2                	jmp    803717 <__divdi3+0x3e>
+  803735:	f7 d9                	neg    %ecx
+  803737:	83 d3 00             	adc    $0x0,%ebx
+  80373a:	f7 db                	neg    %ebx
+  80373c:	53                   	push   %ebx
+  80373d:	51                   	push   %ecx
+  80373e:	52                   	push   %edx
+  80373f:	50                   	push   %eax
+  803740:	e8 4d ff ff ff       	call   803692 <__udivdi3>
+  803745:	83 c4 10             	add    $0x10,%esp
+  803748:	eb d4                	jmp    80371e <__divdi3+0x45>
+
+0080374a <__moddi3>:
+  80374a:	55                   	push   %ebp
+  80374b:	57                   	push   %edi
+  80374c:	56                   	push   %esi
+  80374d:	53                   	push   %ebx
+  80374e:	83 ec 0c             	sub    $0xc,%esp
+  803751:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803755:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803759:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80375d:	89 e9                	mov    %ebp,%ecx
+  80375f:	f7 d9                	neg    %ecx
+  803761:	89 d0                	mov    %edx,%eax
+  803763:	83 d0 00             	adc    $0x0,%eax
+  803766:	f7 d8                	neg    %eax
+  803768:	0f 49 e9             	cmovns %ecx,%ebp
+  80376b:	0f 49 d0             	cmovns %eax,%edx
+  80376e:	52                   	push   %edx
+  80376f:	55                   	push   %ebp
+  803770:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803774:	f7 da                	neg    %edx
+  803776:	89 d8                	mov    %ebx,%eax
+  803778:	83 d0 00             	adc    $0x0,%eax
+  80377b:	f7 d8                	neg    %eax
+  80377d:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803782:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803786:	0f 48 c3             	cmovs  %ebx,%eax
+  803789:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80378d:	ff 74 24 0c          	push   0xc(%esp)
+  803791:	ff 74 24 0c          	push   0xc(%esp)
+  803795:	e8 16 ff ff ff       	call   8036b0 <__umoddi3>
+  80379a:	83 c4 10             	add    $0x10,%esp
+  80379d:	85 db                	test   %ebx,%ebx
+  80379f:	78 08                	js     8037a9 <__moddi3+0x5f>
+  8037a1:	83 c4 0c             	add    $0xc,%esp
+  8037a4:	5b                   	pop    %ebx
+  8037a5:	5e                   	pop    %esi
+  8037a6:	5f                   	pop    %edi
+  8037a7:	5d                   	pop    %ebp
+  8037a8:	c3                   	ret
+  8037a9:	f7 d8                	neg    %eax
+  8037ab:	83 d2 00             	adc    $0x0,%edx
+  8037ae:	f7 da                	neg    %edx
+  8037b0:	eb ef                	jmp    8037a1 <__moddi3+0x57>
@@ -0,0 +1,5562 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  80003c:	e8 c3 17 00 00       	call   801804 <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 af 1a 00 00       	call   801b07 <ipc_recv>
+  800058:	8b 1d 18 50 80 00    	mov    0x805018,%ebx
+  80005e:	8b 7b 48             	mov    0x48(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 14 50 80 00       	mov    0x805014,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 8d 0c 00 00       	call   800cfe <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 30 38 80 00       	push   $0x803830
+  800080:	e8 8c 01 00 00       	call   800211 <cprintf>
+  800085:	a1 14 50 80 00       	mov    0x805014,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 14 50 80 00       	mov    %eax,0x805014
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 bd 1a 00 00       	call   801b65 <ipc_send>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d 14 50 80 00 0a 	cmpl   $0xa,0x805014
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+  8000bc:	8b 1d 18 50 80 00    	mov    0x805018,%ebx
+  8000c2:	e8 37 0c 00 00       	call   800cfe <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 00 38 80 00       	push   $0x803800
+  8000d1:	e8 3b 01 00 00       	call   800211 <cprintf>
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 20 0c 00 00       	call   800cfe <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 1a 38 80 00       	push   $0x80381a
+  8000e8:	e8 24 01 00 00       	call   800211 <cprintf>
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 6a 1a 00 00       	call   801b65 <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80010e:	e8 eb 0b 00 00       	call   800cfe <sys_getenvid>
+  800113:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800118:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80011e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800123:	a3 18 50 80 00       	mov    %eax,0x805018
+  800128:	85 db                	test   %ebx,%ebx
+  80012a:	7e 07                	jle    800133 <libmain+0x30>
+  80012c:	8b 06                	mov    (%esi),%eax
+  80012e:	a3 00 40 80 00       	mov    %eax,0x804000
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	e8 f6 fe ff ff       	call   800033 <umain>
+  80013d:	e8 0a 00 00 00       	call   80014c <exit>
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <exit>:
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	a1 18 50 80 00       	mov    0x805018,%eax
+  800157:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80015d:	85 c0                	test   %eax,%eax
+  80015f:	75 14                	jne    800175 <exit+0x29>
+  800161:	e8 d8 1d 00 00       	call   801f3e <close_all>
+  800166:	83 ec 0c             	sub    $0xc,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	e8 4d 0b 00 00       	call   800cbd <sys_env_destroy>
+  800170:	83 c4 10             	add    $0x10,%esp
+  800173:	c9                   	leave
+  800174:	c3                   	ret
+  800175:	e8 b0 12 00 00       	call   80142a <sys_lease_complete>
+  80017a:	eb e5                	jmp    800161 <exit+0x15>
+
+0080017c <putch>:
+  80017c:	55                   	push   %ebp
+  80017d:	89 e5                	mov    %esp,%ebp
+  80017f:	53                   	push   %ebx
+  800180:	83 ec 04             	sub    $0x4,%esp
+  800183:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800186:	8b 13                	mov    (%ebx),%edx
+  800188:	8d 42 01             	lea    0x1(%edx),%eax
+  80018b:	89 03                	mov    %eax,(%ebx)
+  80018d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800190:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800194:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800199:	74 09                	je     8001a4 <putch+0x28>
+  80019b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80019f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a2:	c9                   	leave
+  8001a3:	c3                   	ret
+  8001a4:	83 ec 08             	sub    $0x8,%esp
+  8001a7:	68 ff 00 00 00       	push   $0xff
+  8001ac:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001af:	50                   	push   %eax
+  8001b0:	e8 cb 0a 00 00       	call   800c80 <sys_cputs>
+  8001b5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001bb:	83 c4 10             	add    $0x10,%esp
+  8001be:	eb db                	jmp    80019b <putch+0x1f>
+
+008001c0 <vcprintf>:
+  8001c0:	55                   	push   %ebp
+  8001c1:	89 e5                	mov    %esp,%ebp
+  8001c3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001c9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d0:	00 00 00 
+  8001d3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001da:	00 00 00 
+  8001dd:	ff 75 0c             	push   0xc(%ebp)
+  8001e0:	ff 75 08             	push   0x8(%ebp)
+  8001e3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e9:	50                   	push   %eax
+  8001ea:	68 7c 01 80 00       	push   $0x80017c
+  8001ef:	e8 1c 01 00 00       	call   800310 <vprintfmt>
+  8001f4:	83 c4 08             	add    $0x8,%esp
+  8001f7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001fd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800203:	50                   	push   %eax
+  800204:	e8 77 0a 00 00       	call   800c80 <sys_cputs>
+  800209:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80020f:	c9                   	leave
+  800210:	c3                   	ret
+
+00800211 <cprintf>:
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	83 ec 10             	sub    $0x10,%esp
+  800217:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80021a:	50                   	push   %eax
+  80021b:	ff 75 08             	push   0x8(%ebp)
+  80021e:	e8 9d ff ff ff       	call   8001c0 <vcprintf>
+  800223:	c9                   	leave
+  800224:	c3                   	ret
+
+00800225 <printnum>:
+  800225:	55                   	push   %ebp
+  800226:	89 e5                	mov    %esp,%ebp
+  800228:	57                   	push   %edi
+  800229:	56                   	push   %esi
+  80022a:	53                   	push   %ebx
+  80022b:	83 ec 1c             	sub    $0x1c,%esp
+  80022e:	89 c3                	mov    %eax,%ebx
+  800230:	89 d6                	mov    %edx,%esi
+  800232:	8b 45 08             	mov    0x8(%ebp),%eax
+  800235:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800238:	89 d1                	mov    %edx,%ecx
+  80023a:	89 c2                	mov    %eax,%edx
+  80023c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80023f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800242:	8b 45 10             	mov    0x10(%ebp),%eax
+  800245:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800248:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80024f:	39 c2                	cmp    %eax,%edx
+  800251:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800254:	73 4b                	jae    8002a1 <printnum+0x7c>
+  800256:	8b 45 14             	mov    0x14(%ebp),%eax
+  800259:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80025c:	85 ff                	test   %edi,%edi
+  80025e:	7e 11                	jle    800271 <printnum+0x4c>
+  800260:	83 ec 08             	sub    $0x8,%esp
+  800263:	56                   	push   %esi
+  800264:	ff 75 18             	push   0x18(%ebp)
+  800267:	ff d3                	call   *%ebx
+  800269:	83 c4 10             	add    $0x10,%esp
+  80026c:	83 ef 01             	sub    $0x1,%edi
+  80026f:	75 ef                	jne    800260 <printnum+0x3b>
+  800271:	83 ec 08             	sub    $0x8,%esp
+  800274:	56                   	push   %esi
+  800275:	83 ec 04             	sub    $0x4,%esp
+  800278:	ff 75 e4             	push   -0x1c(%ebp)
+  80027b:	ff 75 e0             	push   -0x20(%ebp)
+  80027e:	ff 75 dc             	push   -0x24(%ebp)
+  800281:	ff 75 d8             	push   -0x28(%ebp)
+  800284:	e8 6a 34 00 00       	call   8036f3 <__umoddi3>
+  800289:	83 c4 14             	add    $0x14,%esp
+  80028c:	0f be 80 60 38 80 00 	movsbl 0x803860(%eax),%eax
+  800293:	50                   	push   %eax
+  800294:	ff d3                	call   *%ebx
+  800296:	83 c4 10             	add    $0x10,%esp
+  800299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80029c:	5b                   	pop    %ebx
+  80029d:	5e                   	pop    %esi
+  80029e:	5f                   	pop    %edi
+  80029f:	5d                   	pop    %ebp
+  8002a0:	c3                   	ret
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	ff 75 18             	push   0x18(%ebp)
+  8002a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002aa:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002ad:	52                   	push   %edx
+  8002ae:	50                   	push   %eax
+  8002af:	83 ec 08             	sub    $0x8,%esp
+  8002b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b5:	ff 75 e0             	push   -0x20(%ebp)
+  8002b8:	ff 75 dc             	push   -0x24(%ebp)
+  8002bb:	ff 75 d8             	push   -0x28(%ebp)
+  8002be:	e8 12 34 00 00       	call   8036d5 <__udivdi3>
+  8002c3:	83 c4 18             	add    $0x18,%esp
+  8002c6:	52                   	push   %edx
+  8002c7:	50                   	push   %eax
+  8002c8:	89 f2                	mov    %esi,%edx
+  8002ca:	89 d8                	mov    %ebx,%eax
+  8002cc:	e8 54 ff ff ff       	call   800225 <printnum>
+  8002d1:	83 c4 20             	add    $0x20,%esp
+  8002d4:	eb 9b                	jmp    800271 <printnum+0x4c>
+
+008002d6 <sprintputch>:
+  8002d6:	55                   	push   %ebp
+  8002d7:	89 e5                	mov    %esp,%ebp
+  8002d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002dc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002e0:	8b 10                	mov    (%eax),%edx
+  8002e2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002e5:	73 0a                	jae    8002f1 <sprintputch+0x1b>
+  8002e7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ea:	89 08                	mov    %ecx,(%eax)
+  8002ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ef:	88 02                	mov    %al,(%edx)
+  8002f1:	5d                   	pop    %ebp
+  8002f2:	c3                   	ret
+
+008002f3 <printfmt>:
+  8002f3:	55                   	push   %ebp
+  8002f4:	89 e5                	mov    %esp,%ebp
+  8002f6:	83 ec 08             	sub    $0x8,%esp
+  8002f9:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002fc:	50                   	push   %eax
+  8002fd:	ff 75 10             	push   0x10(%ebp)
+  800300:	ff 75 0c             	push   0xc(%ebp)
+  800303:	ff 75 08             	push   0x8(%ebp)
+  800306:	e8 05 00 00 00       	call   800310 <vprintfmt>
+  80030b:	83 c4 10             	add    $0x10,%esp
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+00800310 <vprintfmt>:
+  800310:	55                   	push   %ebp
+  800311:	89 e5                	mov    %esp,%ebp
+  800313:	57                   	push   %edi
+  800314:	56                   	push   %esi
+  800315:	53                   	push   %ebx
+  800316:	83 ec 2c             	sub    $0x2c,%esp
+  800319:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80031c:	89 df                	mov    %ebx,%edi
+  80031e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800321:	8b 45 10             	mov    0x10(%ebp),%eax
+  800324:	8d 70 01             	lea    0x1(%eax),%esi
+  800327:	0f b6 00             	movzbl (%eax),%eax
+  80032a:	83 f8 25             	cmp    $0x25,%eax
+  80032d:	74 1e                	je     80034d <vprintfmt+0x3d>
+  80032f:	85 c0                	test   %eax,%eax
+  800331:	0f 84 15 05 00 00    	je     80084c <vprintfmt+0x53c>
+  800337:	83 ec 08             	sub    $0x8,%esp
+  80033a:	53                   	push   %ebx
+  80033b:	50                   	push   %eax
+  80033c:	ff d7                	call   *%edi
+  80033e:	83 c6 01             	add    $0x1,%esi
+  800341:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800345:	83 c4 10             	add    $0x10,%esp
+  800348:	83 f8 25             	cmp    $0x25,%eax
+  80034b:	75 e2                	jne    80032f <vprintfmt+0x1f>
+  80034d:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800351:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800358:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80035f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800366:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80036b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80036e:	8d 56 01             	lea    0x1(%esi),%edx
+  800371:	0f b6 0e             	movzbl (%esi),%ecx
+  800374:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800377:	3c 55                	cmp    $0x55,%al
+  800379:	0f 87 3b 04 00 00    	ja     8007ba <vprintfmt+0x4aa>
+  80037f:	0f b6 c0             	movzbl %al,%eax
+  800382:	ff 24 85 a0 39 80 00 	jmp    *0x8039a0(,%eax,4)
+  800389:	89 75 10             	mov    %esi,0x10(%ebp)
+  80038c:	eb 93                	jmp    800321 <vprintfmt+0x11>
+  80038e:	89 d6                	mov    %edx,%esi
+  800390:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800394:	eb d8                	jmp    80036e <vprintfmt+0x5e>
+  800396:	89 d6                	mov    %edx,%esi
+  800398:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80039c:	eb d0                	jmp    80036e <vprintfmt+0x5e>
+  80039e:	0f b6 c9             	movzbl %cl,%ecx
+  8003a1:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003a4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003a7:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003ab:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003ae:	83 f9 09             	cmp    $0x9,%ecx
+  8003b1:	77 6f                	ja     800422 <vprintfmt+0x112>
+  8003b3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003b6:	83 c2 01             	add    $0x1,%edx
+  8003b9:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003bc:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003c0:	0f be 02             	movsbl (%edx),%eax
+  8003c3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003c6:	83 fe 09             	cmp    $0x9,%esi
+  8003c9:	76 eb                	jbe    8003b6 <vprintfmt+0xa6>
+  8003cb:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8003ce:	89 d6                	mov    %edx,%esi
+  8003d0:	eb 13                	jmp    8003e5 <vprintfmt+0xd5>
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8b 00                	mov    (%eax),%eax
+  8003d7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8003e3:	89 d6                	mov    %edx,%esi
+  8003e5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003e9:	79 83                	jns    80036e <vprintfmt+0x5e>
+  8003eb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003f1:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003f8:	e9 71 ff ff ff       	jmp    80036e <vprintfmt+0x5e>
+  8003fd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800400:	85 c9                	test   %ecx,%ecx
+  800402:	b8 00 00 00 00       	mov    $0x0,%eax
+  800407:	0f 49 c1             	cmovns %ecx,%eax
+  80040a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80040d:	89 d6                	mov    %edx,%esi
+  80040f:	e9 5a ff ff ff       	jmp    80036e <vprintfmt+0x5e>
+  800414:	89 d6                	mov    %edx,%esi
+  800416:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80041d:	e9 4c ff ff ff       	jmp    80036e <vprintfmt+0x5e>
+  800422:	89 d6                	mov    %edx,%esi
+  800424:	eb bf                	jmp    8003e5 <vprintfmt+0xd5>
+  800426:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80042a:	89 d6                	mov    %edx,%esi
+  80042c:	e9 3d ff ff ff       	jmp    80036e <vprintfmt+0x5e>
+  800431:	89 55 10             	mov    %edx,0x10(%ebp)
+  800434:	8b 45 14             	mov    0x14(%ebp),%eax
+  800437:	8d 70 04             	lea    0x4(%eax),%esi
+  80043a:	83 ec 08             	sub    $0x8,%esp
+  80043d:	53                   	push   %ebx
+  80043e:	ff 30                	push   (%eax)
+  800440:	ff d7                	call   *%edi
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	89 75 14             	mov    %esi,0x14(%ebp)
+  800448:	e9 d4 fe ff ff       	jmp    800321 <vprintfmt+0x11>
+  80044d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800450:	8b 45 14             	mov    0x14(%ebp),%eax
+  800453:	8d 70 04             	lea    0x4(%eax),%esi
+  800456:	8b 10                	mov    (%eax),%edx
+  800458:	89 d0                	mov    %edx,%eax
+  80045a:	f7 d8                	neg    %eax
+  80045c:	0f 48 c2             	cmovs  %edx,%eax
+  80045f:	83 f8 12             	cmp    $0x12,%eax
+  800462:	7f 23                	jg     800487 <vprintfmt+0x177>
+  800464:	8b 14 85 00 3b 80 00 	mov    0x803b00(,%eax,4),%edx
+  80046b:	85 d2                	test   %edx,%edx
+  80046d:	74 18                	je     800487 <vprintfmt+0x177>
+  80046f:	52                   	push   %edx
+  800470:	68 af 3d 80 00       	push   $0x803daf
+  800475:	53                   	push   %ebx
+  800476:	57                   	push   %edi
+  800477:	e8 77 fe ff ff       	call   8002f3 <printfmt>
+  80047c:	83 c4 10             	add    $0x10,%esp
+  80047f:	89 75 14             	mov    %esi,0x14(%ebp)
+  800482:	e9 9a fe ff ff       	jmp    800321 <vprintfmt+0x11>
+  800487:	50                   	push   %eax
+  800488:	68 78 38 80 00       	push   $0x803878
+  80048d:	53                   	push   %ebx
+  80048e:	57                   	push   %edi
+  80048f:	e8 5f fe ff ff       	call   8002f3 <printfmt>
+  800494:	83 c4 10             	add    $0x10,%esp
+  800497:	89 75 14             	mov    %esi,0x14(%ebp)
+  80049a:	e9 82 fe ff ff       	jmp    800321 <vprintfmt+0x11>
+  80049f:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a5:	83 c0 04             	add    $0x4,%eax
+  8004a8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8b 00                	mov    (%eax),%eax
+  8004b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b3:	85 c0                	test   %eax,%eax
+  8004b5:	0f 84 61 03 00 00    	je     80081c <vprintfmt+0x50c>
+  8004bb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004bf:	7e 06                	jle    8004c7 <vprintfmt+0x1b7>
+  8004c1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004c5:	75 29                	jne    8004f0 <vprintfmt+0x1e0>
+  8004c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004ca:	8d 70 01             	lea    0x1(%eax),%esi
+  8004cd:	0f b6 00             	movzbl (%eax),%eax
+  8004d0:	0f be d0             	movsbl %al,%edx
+  8004d3:	85 d2                	test   %edx,%edx
+  8004d5:	0f 84 bb 00 00 00    	je     800596 <vprintfmt+0x286>
+  8004db:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004de:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004e1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004e4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004e7:	eb 7a                	jmp    800563 <vprintfmt+0x253>
+  8004e9:	c7 45 d0 71 38 80 00 	movl   $0x803871,-0x30(%ebp)
+  8004f0:	83 ec 08             	sub    $0x8,%esp
+  8004f3:	ff 75 d4             	push   -0x2c(%ebp)
+  8004f6:	ff 75 d0             	push   -0x30(%ebp)
+  8004f9:	e8 e0 03 00 00       	call   8008de <strnlen>
+  8004fe:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800501:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800504:	83 c4 10             	add    $0x10,%esp
+  800507:	85 d2                	test   %edx,%edx
+  800509:	0f 8e d6 02 00 00    	jle    8007e5 <vprintfmt+0x4d5>
+  80050f:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800513:	83 ec 08             	sub    $0x8,%esp
+  800516:	53                   	push   %ebx
+  800517:	56                   	push   %esi
+  800518:	ff d7                	call   *%edi
+  80051a:	83 c4 10             	add    $0x10,%esp
+  80051d:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800521:	75 f0                	jne    800513 <vprintfmt+0x203>
+  800523:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800526:	8d 70 01             	lea    0x1(%eax),%esi
+  800529:	0f b6 00             	movzbl (%eax),%eax
+  80052c:	0f be d0             	movsbl %al,%edx
+  80052f:	85 d2                	test   %edx,%edx
+  800531:	0f 84 da 02 00 00    	je     800811 <vprintfmt+0x501>
+  800537:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80053a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80053d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800540:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800543:	eb 1e                	jmp    800563 <vprintfmt+0x253>
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	ff 75 0c             	push   0xc(%ebp)
+  80054b:	52                   	push   %edx
+  80054c:	ff 55 08             	call   *0x8(%ebp)
+  80054f:	83 c4 10             	add    $0x10,%esp
+  800552:	83 eb 01             	sub    $0x1,%ebx
+  800555:	83 c6 01             	add    $0x1,%esi
+  800558:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80055c:	0f be d0             	movsbl %al,%edx
+  80055f:	85 d2                	test   %edx,%edx
+  800561:	74 2a                	je     80058d <vprintfmt+0x27d>
+  800563:	85 ff                	test   %edi,%edi
+  800565:	78 05                	js     80056c <vprintfmt+0x25c>
+  800567:	83 ef 01             	sub    $0x1,%edi
+  80056a:	78 59                	js     8005c5 <vprintfmt+0x2b5>
+  80056c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800570:	74 d3                	je     800545 <vprintfmt+0x235>
+  800572:	0f be c0             	movsbl %al,%eax
+  800575:	83 e8 20             	sub    $0x20,%eax
+  800578:	83 f8 5e             	cmp    $0x5e,%eax
+  80057b:	76 c8                	jbe    800545 <vprintfmt+0x235>
+  80057d:	83 ec 08             	sub    $0x8,%esp
+  800580:	ff 75 0c             	push   0xc(%ebp)
+  800583:	6a 3f                	push   $0x3f
+  800585:	ff 55 08             	call   *0x8(%ebp)
+  800588:	83 c4 10             	add    $0x10,%esp
+  80058b:	eb c5                	jmp    800552 <vprintfmt+0x242>
+  80058d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800590:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800593:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800596:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800599:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80059d:	7e 1b                	jle    8005ba <vprintfmt+0x2aa>
+  80059f:	83 ec 08             	sub    $0x8,%esp
+  8005a2:	53                   	push   %ebx
+  8005a3:	6a 20                	push   $0x20
+  8005a5:	ff d7                	call   *%edi
+  8005a7:	83 c4 10             	add    $0x10,%esp
+  8005aa:	83 ee 01             	sub    $0x1,%esi
+  8005ad:	75 f0                	jne    80059f <vprintfmt+0x28f>
+  8005af:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b5:	e9 67 fd ff ff       	jmp    800321 <vprintfmt+0x11>
+  8005ba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c0:	e9 5c fd ff ff       	jmp    800321 <vprintfmt+0x11>
+  8005c5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005c8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005ce:	eb c6                	jmp    800596 <vprintfmt+0x286>
+  8005d0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005d3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005d6:	83 f9 01             	cmp    $0x1,%ecx
+  8005d9:	7f 1f                	jg     8005fa <vprintfmt+0x2ea>
+  8005db:	85 c9                	test   %ecx,%ecx
+  8005dd:	74 67                	je     800646 <vprintfmt+0x336>
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8b 30                	mov    (%eax),%esi
+  8005e4:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005e7:	89 f0                	mov    %esi,%eax
+  8005e9:	c1 f8 1f             	sar    $0x1f,%eax
+  8005ec:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f8:	eb 17                	jmp    800611 <vprintfmt+0x301>
+  8005fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fd:	8b 50 04             	mov    0x4(%eax),%edx
+  800600:	8b 00                	mov    (%eax),%eax
+  800602:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800605:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8d 40 08             	lea    0x8(%eax),%eax
+  80060e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800611:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800614:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800617:	be 0a 00 00 00       	mov    $0xa,%esi
+  80061c:	85 c9                	test   %ecx,%ecx
+  80061e:	0f 89 12 01 00 00    	jns    800736 <vprintfmt+0x426>
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	53                   	push   %ebx
+  800628:	6a 2d                	push   $0x2d
+  80062a:	ff d7                	call   *%edi
+  80062c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80062f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800632:	f7 da                	neg    %edx
+  800634:	83 d1 00             	adc    $0x0,%ecx
+  800637:	f7 d9                	neg    %ecx
+  800639:	83 c4 10             	add    $0x10,%esp
+  80063c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800641:	e9 f0 00 00 00       	jmp    800736 <vprintfmt+0x426>
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 30                	mov    (%eax),%esi
+  80064b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80064e:	89 f0                	mov    %esi,%eax
+  800650:	c1 f8 1f             	sar    $0x1f,%eax
+  800653:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8d 40 04             	lea    0x4(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065f:	eb b0                	jmp    800611 <vprintfmt+0x301>
+  800661:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800664:	89 55 10             	mov    %edx,0x10(%ebp)
+  800667:	83 f9 01             	cmp    $0x1,%ecx
+  80066a:	7f 1e                	jg     80068a <vprintfmt+0x37a>
+  80066c:	85 c9                	test   %ecx,%ecx
+  80066e:	74 32                	je     8006a2 <vprintfmt+0x392>
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 10                	mov    (%eax),%edx
+  800675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067a:	8d 40 04             	lea    0x4(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800680:	be 0a 00 00 00       	mov    $0xa,%esi
+  800685:	e9 ac 00 00 00       	jmp    800736 <vprintfmt+0x426>
+  80068a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068d:	8b 10                	mov    (%eax),%edx
+  80068f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800692:	8d 40 08             	lea    0x8(%eax),%eax
+  800695:	89 45 14             	mov    %eax,0x14(%ebp)
+  800698:	be 0a 00 00 00       	mov    $0xa,%esi
+  80069d:	e9 94 00 00 00       	jmp    800736 <vprintfmt+0x426>
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8b 10                	mov    (%eax),%edx
+  8006a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8006af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006b7:	eb 7d                	jmp    800736 <vprintfmt+0x426>
+  8006b9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006bc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006bf:	83 f9 01             	cmp    $0x1,%ecx
+  8006c2:	7f 1b                	jg     8006df <vprintfmt+0x3cf>
+  8006c4:	85 c9                	test   %ecx,%ecx
+  8006c6:	74 2c                	je     8006f4 <vprintfmt+0x3e4>
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d8:	be 08 00 00 00       	mov    $0x8,%esi
+  8006dd:	eb 57                	jmp    800736 <vprintfmt+0x426>
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8b 10                	mov    (%eax),%edx
+  8006e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ed:	be 08 00 00 00       	mov    $0x8,%esi
+  8006f2:	eb 42                	jmp    800736 <vprintfmt+0x426>
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8b 10                	mov    (%eax),%edx
+  8006f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800701:	89 45 14             	mov    %eax,0x14(%ebp)
+  800704:	be 08 00 00 00       	mov    $0x8,%esi
+  800709:	eb 2b                	jmp    800736 <vprintfmt+0x426>
+  80070b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80070e:	83 ec 08             	sub    $0x8,%esp
+  800711:	53                   	push   %ebx
+  800712:	6a 30                	push   $0x30
+  800714:	ff d7                	call   *%edi
+  800716:	83 c4 08             	add    $0x8,%esp
+  800719:	53                   	push   %ebx
+  80071a:	6a 78                	push   $0x78
+  80071c:	ff d7                	call   *%edi
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	8b 10                	mov    (%eax),%edx
+  800723:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800728:	83 c4 10             	add    $0x10,%esp
+  80072b:	8d 40 04             	lea    0x4(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800731:	be 10 00 00 00       	mov    $0x10,%esi
+  800736:	83 ec 0c             	sub    $0xc,%esp
+  800739:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80073d:	50                   	push   %eax
+  80073e:	ff 75 e4             	push   -0x1c(%ebp)
+  800741:	56                   	push   %esi
+  800742:	51                   	push   %ecx
+  800743:	52                   	push   %edx
+  800744:	89 da                	mov    %ebx,%edx
+  800746:	89 f8                	mov    %edi,%eax
+  800748:	e8 d8 fa ff ff       	call   800225 <printnum>
+  80074d:	83 c4 20             	add    $0x20,%esp
+  800750:	e9 cc fb ff ff       	jmp    800321 <vprintfmt+0x11>
+  800755:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800758:	89 55 10             	mov    %edx,0x10(%ebp)
+  80075b:	83 f9 01             	cmp    $0x1,%ecx
+  80075e:	7f 1b                	jg     80077b <vprintfmt+0x46b>
+  800760:	85 c9                	test   %ecx,%ecx
+  800762:	74 2c                	je     800790 <vprintfmt+0x480>
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 10                	mov    (%eax),%edx
+  800769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+  800774:	be 10 00 00 00       	mov    $0x10,%esi
+  800779:	eb bb                	jmp    800736 <vprintfmt+0x426>
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8b 10                	mov    (%eax),%edx
+  800780:	8b 48 04             	mov    0x4(%eax),%ecx
+  800783:	8d 40 08             	lea    0x8(%eax),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+  800789:	be 10 00 00 00       	mov    $0x10,%esi
+  80078e:	eb a6                	jmp    800736 <vprintfmt+0x426>
+  800790:	8b 45 14             	mov    0x14(%ebp),%eax
+  800793:	8b 10                	mov    (%eax),%edx
+  800795:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80079a:	8d 40 04             	lea    0x4(%eax),%eax
+  80079d:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a0:	be 10 00 00 00       	mov    $0x10,%esi
+  8007a5:	eb 8f                	jmp    800736 <vprintfmt+0x426>
+  8007a7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007aa:	83 ec 08             	sub    $0x8,%esp
+  8007ad:	53                   	push   %ebx
+  8007ae:	6a 25                	push   $0x25
+  8007b0:	ff d7                	call   *%edi
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	e9 67 fb ff ff       	jmp    800321 <vprintfmt+0x11>
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	6a 25                	push   $0x25
+  8007c0:	ff d7                	call   *%edi
+  8007c2:	83 c4 10             	add    $0x10,%esp
+  8007c5:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007c9:	0f 84 ba fb ff ff    	je     800389 <vprintfmt+0x79>
+  8007cf:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007d2:	89 f0                	mov    %esi,%eax
+  8007d4:	83 e8 01             	sub    $0x1,%eax
+  8007d7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007db:	75 f7                	jne    8007d4 <vprintfmt+0x4c4>
+  8007dd:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007e0:	e9 3c fb ff ff       	jmp    800321 <vprintfmt+0x11>
+  8007e5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007e8:	8d 70 01             	lea    0x1(%eax),%esi
+  8007eb:	0f b6 00             	movzbl (%eax),%eax
+  8007ee:	0f be d0             	movsbl %al,%edx
+  8007f1:	85 d2                	test   %edx,%edx
+  8007f3:	74 11                	je     800806 <vprintfmt+0x4f6>
+  8007f5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007f8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007fb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007fe:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800801:	e9 5d fd ff ff       	jmp    800563 <vprintfmt+0x253>
+  800806:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080c:	e9 10 fb ff ff       	jmp    800321 <vprintfmt+0x11>
+  800811:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+  800817:	e9 05 fb ff ff       	jmp    800321 <vprintfmt+0x11>
+  80081c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800820:	7e 0a                	jle    80082c <vprintfmt+0x51c>
+  800822:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800826:	0f 85 bd fc ff ff    	jne    8004e9 <vprintfmt+0x1d9>
+  80082c:	ba 28 00 00 00       	mov    $0x28,%edx
+  800831:	b8 28 00 00 00       	mov    $0x28,%eax
+  800836:	be 72 38 80 00       	mov    $0x803872,%esi
+  80083b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80083e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800841:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800844:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800847:	e9 17 fd ff ff       	jmp    800563 <vprintfmt+0x253>
+  80084c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80084f:	5b                   	pop    %ebx
+  800850:	5e                   	pop    %esi
+  800851:	5f                   	pop    %edi
+  800852:	5d                   	pop    %ebp
+  800853:	c3                   	ret
+
+00800854 <vsnprintf>:
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	83 ec 18             	sub    $0x18,%esp
+  80085a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800860:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800863:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800867:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80086a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800871:	85 c0                	test   %eax,%eax
+  800873:	74 26                	je     80089b <vsnprintf+0x47>
+  800875:	85 d2                	test   %edx,%edx
+  800877:	7e 22                	jle    80089b <vsnprintf+0x47>
+  800879:	ff 75 14             	push   0x14(%ebp)
+  80087c:	ff 75 10             	push   0x10(%ebp)
+  80087f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800882:	50                   	push   %eax
+  800883:	68 d6 02 80 00       	push   $0x8002d6
+  800888:	e8 83 fa ff ff       	call   800310 <vprintfmt>
+  80088d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800890:	c6 00 00             	movb   $0x0,(%eax)
+  800893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800896:	83 c4 10             	add    $0x10,%esp
+  800899:	c9                   	leave
+  80089a:	c3                   	ret
+  80089b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a0:	eb f7                	jmp    800899 <vsnprintf+0x45>
+
+008008a2 <snprintf>:
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	83 ec 08             	sub    $0x8,%esp
+  8008a8:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008ab:	50                   	push   %eax
+  8008ac:	ff 75 10             	push   0x10(%ebp)
+  8008af:	ff 75 0c             	push   0xc(%ebp)
+  8008b2:	ff 75 08             	push   0x8(%ebp)
+  8008b5:	e8 9a ff ff ff       	call   800854 <vsnprintf>
+  8008ba:	c9                   	leave
+  8008bb:	c3                   	ret
+
+008008bc <strlen>:
+  8008bc:	55                   	push   %ebp
+  8008bd:	89 e5                	mov    %esp,%ebp
+  8008bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008c2:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008c5:	74 10                	je     8008d7 <strlen+0x1b>
+  8008c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cc:	83 c0 01             	add    $0x1,%eax
+  8008cf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d3:	75 f7                	jne    8008cc <strlen+0x10>
+  8008d5:	5d                   	pop    %ebp
+  8008d6:	c3                   	ret
+  8008d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dc:	eb f7                	jmp    8008d5 <strlen+0x19>
+
+008008de <strnlen>:
+  8008de:	55                   	push   %ebp
+  8008df:	89 e5                	mov    %esp,%ebp
+  8008e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e7:	85 d2                	test   %edx,%edx
+  8008e9:	74 16                	je     800901 <strnlen+0x23>
+  8008eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f4:	74 09                	je     8008ff <strnlen+0x21>
+  8008f6:	83 c0 01             	add    $0x1,%eax
+  8008f9:	39 d0                	cmp    %edx,%eax
+  8008fb:	75 f3                	jne    8008f0 <strnlen+0x12>
+  8008fd:	89 d0                	mov    %edx,%eax
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	eb f7                	jmp    8008ff <strnlen+0x21>
+
+00800908 <strcpy>:
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	53                   	push   %ebx
+  80090c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800912:	b8 00 00 00 00       	mov    $0x0,%eax
+  800917:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80091b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80091e:	83 c0 01             	add    $0x1,%eax
+  800921:	84 d2                	test   %dl,%dl
+  800923:	75 f2                	jne    800917 <strcpy+0xf>
+  800925:	89 c8                	mov    %ecx,%eax
+  800927:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092a:	c9                   	leave
+  80092b:	c3                   	ret
+
+0080092c <strcat>:
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	53                   	push   %ebx
+  800930:	83 ec 10             	sub    $0x10,%esp
+  800933:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800936:	53                   	push   %ebx
+  800937:	e8 80 ff ff ff       	call   8008bc <strlen>
+  80093c:	83 c4 08             	add    $0x8,%esp
+  80093f:	ff 75 0c             	push   0xc(%ebp)
+  800942:	01 d8                	add    %ebx,%eax
+  800944:	50                   	push   %eax
+  800945:	e8 be ff ff ff       	call   800908 <strcpy>
+  80094a:	89 d8                	mov    %ebx,%eax
+  80094c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80094f:	c9                   	leave
+  800950:	c3                   	ret
+
+00800951 <strncpy>:
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	56                   	push   %esi
+  800955:	53                   	push   %ebx
+  800956:	8b 75 08             	mov    0x8(%ebp),%esi
+  800959:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80095f:	85 db                	test   %ebx,%ebx
+  800961:	74 17                	je     80097a <strncpy+0x29>
+  800963:	01 f3                	add    %esi,%ebx
+  800965:	89 f0                	mov    %esi,%eax
+  800967:	83 c0 01             	add    $0x1,%eax
+  80096a:	0f b6 0a             	movzbl (%edx),%ecx
+  80096d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800970:	80 f9 01             	cmp    $0x1,%cl
+  800973:	83 da ff             	sbb    $0xffffffff,%edx
+  800976:	39 c3                	cmp    %eax,%ebx
+  800978:	75 ed                	jne    800967 <strncpy+0x16>
+  80097a:	89 f0                	mov    %esi,%eax
+  80097c:	5b                   	pop    %ebx
+  80097d:	5e                   	pop    %esi
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+
+00800980 <strlcpy>:
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	56                   	push   %esi
+  800984:	53                   	push   %ebx
+  800985:	8b 75 08             	mov    0x8(%ebp),%esi
+  800988:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80098b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80098e:	89 f0                	mov    %esi,%eax
+  800990:	85 db                	test   %ebx,%ebx
+  800992:	74 1e                	je     8009b2 <strlcpy+0x32>
+  800994:	83 eb 01             	sub    $0x1,%ebx
+  800997:	74 16                	je     8009af <strlcpy+0x2f>
+  800999:	01 f3                	add    %esi,%ebx
+  80099b:	0f b6 0a             	movzbl (%edx),%ecx
+  80099e:	84 c9                	test   %cl,%cl
+  8009a0:	74 0d                	je     8009af <strlcpy+0x2f>
+  8009a2:	83 c2 01             	add    $0x1,%edx
+  8009a5:	83 c0 01             	add    $0x1,%eax
+  8009a8:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009ab:	39 d8                	cmp    %ebx,%eax
+  8009ad:	75 ec                	jne    80099b <strlcpy+0x1b>
+  8009af:	c6 00 00             	movb   $0x0,(%eax)
+  8009b2:	29 f0                	sub    %esi,%eax
+  8009b4:	5b                   	pop    %ebx
+  8009b5:	5e                   	pop    %esi
+  8009b6:	5d                   	pop    %ebp
+  8009b7:	c3                   	ret
+
+008009b8 <strcmp>:
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c1:	0f b6 01             	movzbl (%ecx),%eax
+  8009c4:	84 c0                	test   %al,%al
+  8009c6:	74 11                	je     8009d9 <strcmp+0x21>
+  8009c8:	38 02                	cmp    %al,(%edx)
+  8009ca:	75 0d                	jne    8009d9 <strcmp+0x21>
+  8009cc:	83 c1 01             	add    $0x1,%ecx
+  8009cf:	83 c2 01             	add    $0x1,%edx
+  8009d2:	0f b6 01             	movzbl (%ecx),%eax
+  8009d5:	84 c0                	test   %al,%al
+  8009d7:	75 ef                	jne    8009c8 <strcmp+0x10>
+  8009d9:	0f b6 c0             	movzbl %al,%eax
+  8009dc:	0f b6 12             	movzbl (%edx),%edx
+  8009df:	29 d0                	sub    %edx,%eax
+  8009e1:	5d                   	pop    %ebp
+  8009e2:	c3                   	ret
+
+008009e3 <strncmp>:
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	53                   	push   %ebx
+  8009e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009ed:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f5:	85 d2                	test   %edx,%edx
+  8009f7:	74 2e                	je     800a27 <strncmp+0x44>
+  8009f9:	0f b6 01             	movzbl (%ecx),%eax
+  8009fc:	84 c0                	test   %al,%al
+  8009fe:	74 16                	je     800a16 <strncmp+0x33>
+  800a00:	3a 03                	cmp    (%ebx),%al
+  800a02:	75 12                	jne    800a16 <strncmp+0x33>
+  800a04:	83 c1 01             	add    $0x1,%ecx
+  800a07:	83 c3 01             	add    $0x1,%ebx
+  800a0a:	83 ea 01             	sub    $0x1,%edx
+  800a0d:	75 ea                	jne    8009f9 <strncmp+0x16>
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a14:	eb 11                	jmp    800a27 <strncmp+0x44>
+  800a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1b:	85 d2                	test   %edx,%edx
+  800a1d:	74 08                	je     800a27 <strncmp+0x44>
+  800a1f:	0f b6 01             	movzbl (%ecx),%eax
+  800a22:	0f b6 13             	movzbl (%ebx),%edx
+  800a25:	29 d0                	sub    %edx,%eax
+  800a27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a2a:	c9                   	leave
+  800a2b:	c3                   	ret
+
+00800a2c <strchr>:
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a32:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a36:	0f b6 10             	movzbl (%eax),%edx
+  800a39:	84 d2                	test   %dl,%dl
+  800a3b:	74 15                	je     800a52 <strchr+0x26>
+  800a3d:	38 d1                	cmp    %dl,%cl
+  800a3f:	74 0f                	je     800a50 <strchr+0x24>
+  800a41:	83 c0 01             	add    $0x1,%eax
+  800a44:	0f b6 10             	movzbl (%eax),%edx
+  800a47:	84 d2                	test   %dl,%dl
+  800a49:	75 f2                	jne    800a3d <strchr+0x11>
+  800a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a50:	5d                   	pop    %ebp
+  800a51:	c3                   	ret
+  800a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a57:	eb f7                	jmp    800a50 <strchr+0x24>
+
+00800a59 <strfind>:
+  800a59:	55                   	push   %ebp
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	53                   	push   %ebx
+  800a5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a63:	0f b6 18             	movzbl (%eax),%ebx
+  800a66:	38 d3                	cmp    %dl,%bl
+  800a68:	74 14                	je     800a7e <strfind+0x25>
+  800a6a:	89 d1                	mov    %edx,%ecx
+  800a6c:	84 db                	test   %bl,%bl
+  800a6e:	74 0e                	je     800a7e <strfind+0x25>
+  800a70:	83 c0 01             	add    $0x1,%eax
+  800a73:	0f b6 10             	movzbl (%eax),%edx
+  800a76:	38 ca                	cmp    %cl,%dl
+  800a78:	74 04                	je     800a7e <strfind+0x25>
+  800a7a:	84 d2                	test   %dl,%dl
+  800a7c:	75 f2                	jne    800a70 <strfind+0x17>
+  800a7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+
+00800a83 <memset>:
+  800a83:	55                   	push   %ebp
+  800a84:	89 e5                	mov    %esp,%ebp
+  800a86:	57                   	push   %edi
+  800a87:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a8a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a8d:	85 c9                	test   %ecx,%ecx
+  800a8f:	74 20                	je     800ab1 <memset+0x2e>
+  800a91:	89 f8                	mov    %edi,%eax
+  800a93:	09 c8                	or     %ecx,%eax
+  800a95:	a8 03                	test   $0x3,%al
+  800a97:	75 12                	jne    800aab <memset+0x28>
+  800a99:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a9d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800aa3:	c1 e9 02             	shr    $0x2,%ecx
+  800aa6:	fc                   	cld
+  800aa7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aa9:	eb 06                	jmp    800ab1 <memset+0x2e>
+  800aab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aae:	fc                   	cld
+  800aaf:	f3 aa                	rep stos %al,%es:(%edi)
+  800ab1:	89 f8                	mov    %edi,%eax
+  800ab3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ab6:	c9                   	leave
+  800ab7:	c3                   	ret
+
+00800ab8 <memmove>:
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	57                   	push   %edi
+  800abc:	56                   	push   %esi
+  800abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ac3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ac6:	39 c6                	cmp    %eax,%esi
+  800ac8:	73 32                	jae    800afc <memmove+0x44>
+  800aca:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800acd:	39 d0                	cmp    %edx,%eax
+  800acf:	73 2b                	jae    800afc <memmove+0x44>
+  800ad1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800ad4:	89 d6                	mov    %edx,%esi
+  800ad6:	09 fe                	or     %edi,%esi
+  800ad8:	09 ce                	or     %ecx,%esi
+  800ada:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ae0:	75 0e                	jne    800af0 <memmove+0x38>
+  800ae2:	83 ef 04             	sub    $0x4,%edi
+  800ae5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ae8:	c1 e9 02             	shr    $0x2,%ecx
+  800aeb:	fd                   	std
+  800aec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aee:	eb 09                	jmp    800af9 <memmove+0x41>
+  800af0:	83 ef 01             	sub    $0x1,%edi
+  800af3:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800af6:	fd                   	std
+  800af7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800af9:	fc                   	cld
+  800afa:	eb 1a                	jmp    800b16 <memmove+0x5e>
+  800afc:	89 f2                	mov    %esi,%edx
+  800afe:	09 c2                	or     %eax,%edx
+  800b00:	09 ca                	or     %ecx,%edx
+  800b02:	f6 c2 03             	test   $0x3,%dl
+  800b05:	75 0a                	jne    800b11 <memmove+0x59>
+  800b07:	c1 e9 02             	shr    $0x2,%ecx
+  800b0a:	89 c7                	mov    %eax,%edi
+  800b0c:	fc                   	cld
+  800b0d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b0f:	eb 05                	jmp    800b16 <memmove+0x5e>
+  800b11:	89 c7                	mov    %eax,%edi
+  800b13:	fc                   	cld
+  800b14:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b16:	5e                   	pop    %esi
+  800b17:	5f                   	pop    %edi
+  800b18:	5d                   	pop    %ebp
+  800b19:	c3                   	ret
+
+00800b1a <memcpy>:
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	83 ec 0c             	sub    $0xc,%esp
+  800b20:	ff 75 10             	push   0x10(%ebp)
+  800b23:	ff 75 0c             	push   0xc(%ebp)
+  800b26:	ff 75 08             	push   0x8(%ebp)
+  800b29:	e8 8a ff ff ff       	call   800ab8 <memmove>
+  800b2e:	c9                   	leave
+  800b2f:	c3                   	ret
+
+00800b30 <memcmp>:
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	56                   	push   %esi
+  800b34:	53                   	push   %ebx
+  800b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b3b:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b3e:	85 f6                	test   %esi,%esi
+  800b40:	74 29                	je     800b6b <memcmp+0x3b>
+  800b42:	01 c6                	add    %eax,%esi
+  800b44:	0f b6 08             	movzbl (%eax),%ecx
+  800b47:	0f b6 1a             	movzbl (%edx),%ebx
+  800b4a:	38 d9                	cmp    %bl,%cl
+  800b4c:	75 11                	jne    800b5f <memcmp+0x2f>
+  800b4e:	83 c0 01             	add    $0x1,%eax
+  800b51:	83 c2 01             	add    $0x1,%edx
+  800b54:	39 c6                	cmp    %eax,%esi
+  800b56:	75 ec                	jne    800b44 <memcmp+0x14>
+  800b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5d:	eb 08                	jmp    800b67 <memcmp+0x37>
+  800b5f:	0f b6 c1             	movzbl %cl,%eax
+  800b62:	0f b6 db             	movzbl %bl,%ebx
+  800b65:	29 d8                	sub    %ebx,%eax
+  800b67:	5b                   	pop    %ebx
+  800b68:	5e                   	pop    %esi
+  800b69:	5d                   	pop    %ebp
+  800b6a:	c3                   	ret
+  800b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b70:	eb f5                	jmp    800b67 <memcmp+0x37>
+
+00800b72 <memfind>:
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b7b:	89 c2                	mov    %eax,%edx
+  800b7d:	03 55 10             	add    0x10(%ebp),%edx
+  800b80:	39 d0                	cmp    %edx,%eax
+  800b82:	73 0d                	jae    800b91 <memfind+0x1f>
+  800b84:	38 08                	cmp    %cl,(%eax)
+  800b86:	74 0d                	je     800b95 <memfind+0x23>
+  800b88:	83 c0 01             	add    $0x1,%eax
+  800b8b:	39 c2                	cmp    %eax,%edx
+  800b8d:	75 f5                	jne    800b84 <memfind+0x12>
+  800b8f:	eb 06                	jmp    800b97 <memfind+0x25>
+  800b91:	89 c2                	mov    %eax,%edx
+  800b93:	eb 02                	jmp    800b97 <memfind+0x25>
+  800b95:	89 c2                	mov    %eax,%edx
+  800b97:	89 d0                	mov    %edx,%eax
+  800b99:	5d                   	pop    %ebp
+  800b9a:	c3                   	ret
+
+00800b9b <strtol>:
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	57                   	push   %edi
+  800b9f:	56                   	push   %esi
+  800ba0:	53                   	push   %ebx
+  800ba1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ba7:	0f b6 02             	movzbl (%edx),%eax
+  800baa:	3c 20                	cmp    $0x20,%al
+  800bac:	74 04                	je     800bb2 <strtol+0x17>
+  800bae:	3c 09                	cmp    $0x9,%al
+  800bb0:	75 0e                	jne    800bc0 <strtol+0x25>
+  800bb2:	83 c2 01             	add    $0x1,%edx
+  800bb5:	0f b6 02             	movzbl (%edx),%eax
+  800bb8:	3c 20                	cmp    $0x20,%al
+  800bba:	74 f6                	je     800bb2 <strtol+0x17>
+  800bbc:	3c 09                	cmp    $0x9,%al
+  800bbe:	74 f2                	je     800bb2 <strtol+0x17>
+  800bc0:	3c 2b                	cmp    $0x2b,%al
+  800bc2:	74 2a                	je     800bee <strtol+0x53>
+  800bc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bc9:	3c 2d                	cmp    $0x2d,%al
+  800bcb:	74 2b                	je     800bf8 <strtol+0x5d>
+  800bcd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bd3:	75 0f                	jne    800be4 <strtol+0x49>
+  800bd5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bd8:	74 28                	je     800c02 <strtol+0x67>
+  800bda:	85 db                	test   %ebx,%ebx
+  800bdc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800be1:	0f 44 d8             	cmove  %eax,%ebx
+  800be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bec:	eb 46                	jmp    800c34 <strtol+0x99>
+  800bee:	83 c2 01             	add    $0x1,%edx
+  800bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bf6:	eb d5                	jmp    800bcd <strtol+0x32>
+  800bf8:	83 c2 01             	add    $0x1,%edx
+  800bfb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c00:	eb cb                	jmp    800bcd <strtol+0x32>
+  800c02:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c06:	74 0e                	je     800c16 <strtol+0x7b>
+  800c08:	85 db                	test   %ebx,%ebx
+  800c0a:	75 d8                	jne    800be4 <strtol+0x49>
+  800c0c:	83 c2 01             	add    $0x1,%edx
+  800c0f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c14:	eb ce                	jmp    800be4 <strtol+0x49>
+  800c16:	83 c2 02             	add    $0x2,%edx
+  800c19:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c1e:	eb c4                	jmp    800be4 <strtol+0x49>
+  800c20:	0f be c0             	movsbl %al,%eax
+  800c23:	83 e8 30             	sub    $0x30,%eax
+  800c26:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c29:	7d 3a                	jge    800c65 <strtol+0xca>
+  800c2b:	83 c2 01             	add    $0x1,%edx
+  800c2e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c32:	01 c1                	add    %eax,%ecx
+  800c34:	0f b6 02             	movzbl (%edx),%eax
+  800c37:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c3a:	89 f3                	mov    %esi,%ebx
+  800c3c:	80 fb 09             	cmp    $0x9,%bl
+  800c3f:	76 df                	jbe    800c20 <strtol+0x85>
+  800c41:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c44:	89 f3                	mov    %esi,%ebx
+  800c46:	80 fb 19             	cmp    $0x19,%bl
+  800c49:	77 08                	ja     800c53 <strtol+0xb8>
+  800c4b:	0f be c0             	movsbl %al,%eax
+  800c4e:	83 e8 57             	sub    $0x57,%eax
+  800c51:	eb d3                	jmp    800c26 <strtol+0x8b>
+  800c53:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c56:	89 f3                	mov    %esi,%ebx
+  800c58:	80 fb 19             	cmp    $0x19,%bl
+  800c5b:	77 08                	ja     800c65 <strtol+0xca>
+  800c5d:	0f be c0             	movsbl %al,%eax
+  800c60:	83 e8 37             	sub    $0x37,%eax
+  800c63:	eb c1                	jmp    800c26 <strtol+0x8b>
+  800c65:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c69:	74 05                	je     800c70 <strtol+0xd5>
+  800c6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c6e:	89 10                	mov    %edx,(%eax)
+  800c70:	89 c8                	mov    %ecx,%eax
+  800c72:	f7 d8                	neg    %eax
+  800c74:	85 ff                	test   %edi,%edi
+  800c76:	0f 45 c8             	cmovne %eax,%ecx
+  800c79:	89 c8                	mov    %ecx,%eax
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <sys_cputs>:
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	57                   	push   %edi
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+  800c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c91:	89 c3                	mov    %eax,%ebx
+  800c93:	89 c7                	mov    %eax,%edi
+  800c95:	89 c6                	mov    %eax,%esi
+  800c97:	cd 30                	int    $0x30
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5f                   	pop    %edi
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+
+00800c9e <sys_cgetc>:
+  800c9e:	55                   	push   %ebp
+  800c9f:	89 e5                	mov    %esp,%ebp
+  800ca1:	57                   	push   %edi
+  800ca2:	56                   	push   %esi
+  800ca3:	53                   	push   %ebx
+  800ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cae:	89 d1                	mov    %edx,%ecx
+  800cb0:	89 d3                	mov    %edx,%ebx
+  800cb2:	89 d7                	mov    %edx,%edi
+  800cb4:	89 d6                	mov    %edx,%esi
+  800cb6:	cd 30                	int    $0x30
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5f                   	pop    %edi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+
+00800cbd <sys_env_destroy>:
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	57                   	push   %edi
+  800cc1:	56                   	push   %esi
+  800cc2:	53                   	push   %ebx
+  800cc3:	83 ec 0c             	sub    $0xc,%esp
+  800cc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ccb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cce:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cd3:	89 cb                	mov    %ecx,%ebx
+  800cd5:	89 cf                	mov    %ecx,%edi
+  800cd7:	89 ce                	mov    %ecx,%esi
+  800cd9:	cd 30                	int    $0x30
+  800cdb:	85 c0                	test   %eax,%eax
+  800cdd:	7f 08                	jg     800ce7 <sys_env_destroy+0x2a>
+  800cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce2:	5b                   	pop    %ebx
+  800ce3:	5e                   	pop    %esi
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+  800ce7:	83 ec 0c             	sub    $0xc,%esp
+  800cea:	50                   	push   %eax
+  800ceb:	6a 03                	push   $0x3
+  800ced:	68 6b 3b 80 00       	push   $0x803b6b
+  800cf2:	6a 24                	push   $0x24
+  800cf4:	68 88 3b 80 00       	push   $0x803b88
+  800cf9:	e8 d5 27 00 00       	call   8034d3 <_panic>
+
+00800cfe <sys_getenvid>:
+  800cfe:	55                   	push   %ebp
+  800cff:	89 e5                	mov    %esp,%ebp
+  800d01:	57                   	push   %edi
+  800d02:	56                   	push   %esi
+  800d03:	53                   	push   %ebx
+  800d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d09:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d0e:	89 d1                	mov    %edx,%ecx
+  800d10:	89 d3                	mov    %edx,%ebx
+  800d12:	89 d7                	mov    %edx,%edi
+  800d14:	89 d6                	mov    %edx,%esi
+  800d16:	cd 30                	int    $0x30
+  800d18:	5b                   	pop    %ebx
+  800d19:	5e                   	pop    %esi
+  800d1a:	5f                   	pop    %edi
+  800d1b:	5d                   	pop    %ebp
+  800d1c:	c3                   	ret
+
+00800d1d <sys_yield>:
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+  800d23:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d2a:	74 26                	je     800d52 <sys_yield+0x35>
+  800d2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d31:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d36:	89 d1                	mov    %edx,%ecx
+  800d38:	89 d3                	mov    %edx,%ebx
+  800d3a:	89 d7                	mov    %edx,%edi
+  800d3c:	6a 00                	push   $0x0
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	8d 35 49 0d 80 00    	lea    0x800d49,%esi
+  800d47:	0f 34                	sysenter
+  800d49:	5d                   	pop    %ebp
+  800d4a:	83 c4 04             	add    $0x4,%esp
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+  800d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d57:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d5c:	89 d1                	mov    %edx,%ecx
+  800d5e:	89 d3                	mov    %edx,%ebx
+  800d60:	89 d7                	mov    %edx,%edi
+  800d62:	89 d6                	mov    %edx,%esi
+  800d64:	cd 30                	int    $0x30
+  800d66:	eb e5                	jmp    800d4d <sys_yield+0x30>
+
+00800d68 <sys_page_alloc>:
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+  800d71:	be 00 00 00 00       	mov    $0x0,%esi
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d84:	89 f7                	mov    %esi,%edi
+  800d86:	cd 30                	int    $0x30
+  800d88:	85 c0                	test   %eax,%eax
+  800d8a:	7f 08                	jg     800d94 <sys_page_alloc+0x2c>
+  800d8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+  800d94:	83 ec 0c             	sub    $0xc,%esp
+  800d97:	50                   	push   %eax
+  800d98:	6a 04                	push   $0x4
+  800d9a:	68 6b 3b 80 00       	push   $0x803b6b
+  800d9f:	6a 24                	push   $0x24
+  800da1:	68 88 3b 80 00       	push   $0x803b88
+  800da6:	e8 28 27 00 00       	call   8034d3 <_panic>
+
+00800dab <sys_page_map>:
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+  800db4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800dbb:	74 33                	je     800df0 <sys_page_map+0x45>
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dce:	ff 75 18             	push   0x18(%ebp)
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	8d 35 dc 0d 80 00    	lea    0x800ddc,%esi
+  800dda:	0f 34                	sysenter
+  800ddc:	5d                   	pop    %ebp
+  800ddd:	83 c4 04             	add    $0x4,%esp
+  800de0:	89 c2                	mov    %eax,%edx
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	7f 3d                	jg     800e23 <sys_page_map+0x78>
+  800de6:	89 d0                	mov    %edx,%eax
+  800de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+  800df0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800df5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e01:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e04:	cd 30                	int    $0x30
+  800e06:	89 c2                	mov    %eax,%edx
+  800e08:	85 c0                	test   %eax,%eax
+  800e0a:	7e da                	jle    800de6 <sys_page_map+0x3b>
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+  800e0f:	50                   	push   %eax
+  800e10:	6a 05                	push   $0x5
+  800e12:	68 6b 3b 80 00       	push   $0x803b6b
+  800e17:	6a 24                	push   $0x24
+  800e19:	68 88 3b 80 00       	push   $0x803b88
+  800e1e:	e8 b0 26 00 00       	call   8034d3 <_panic>
+  800e23:	83 ec 0c             	sub    $0xc,%esp
+  800e26:	50                   	push   %eax
+  800e27:	6a 05                	push   $0x5
+  800e29:	68 6b 3b 80 00       	push   $0x803b6b
+  800e2e:	6a 48                	push   $0x48
+  800e30:	68 88 3b 80 00       	push   $0x803b88
+  800e35:	e8 99 26 00 00       	call   8034d3 <_panic>
+
+00800e3a <sys_page_unmap>:
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	57                   	push   %edi
+  800e3e:	56                   	push   %esi
+  800e3f:	53                   	push   %ebx
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+  800e43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e53:	89 df                	mov    %ebx,%edi
+  800e55:	89 de                	mov    %ebx,%esi
+  800e57:	cd 30                	int    $0x30
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	7f 08                	jg     800e65 <sys_page_unmap+0x2b>
+  800e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 06                	push   $0x6
+  800e6b:	68 6b 3b 80 00       	push   $0x803b6b
+  800e70:	6a 24                	push   $0x24
+  800e72:	68 88 3b 80 00       	push   $0x803b88
+  800e77:	e8 57 26 00 00       	call   8034d3 <_panic>
+
+00800e7c <sys_fork>:
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+  800e82:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e87:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e8c:	89 d1                	mov    %edx,%ecx
+  800e8e:	89 d3                	mov    %edx,%ebx
+  800e90:	89 d7                	mov    %edx,%edi
+  800e92:	89 d6                	mov    %edx,%esi
+  800e94:	cd 30                	int    $0x30
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+
+00800e9b <sys_env_set_status>:
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	57                   	push   %edi
+  800e9f:	56                   	push   %esi
+  800ea0:	53                   	push   %ebx
+  800ea1:	83 ec 0c             	sub    $0xc,%esp
+  800ea4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eaf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eb4:	89 df                	mov    %ebx,%edi
+  800eb6:	89 de                	mov    %ebx,%esi
+  800eb8:	cd 30                	int    $0x30
+  800eba:	85 c0                	test   %eax,%eax
+  800ebc:	7f 08                	jg     800ec6 <sys_env_set_status+0x2b>
+  800ebe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec1:	5b                   	pop    %ebx
+  800ec2:	5e                   	pop    %esi
+  800ec3:	5f                   	pop    %edi
+  800ec4:	5d                   	pop    %ebp
+  800ec5:	c3                   	ret
+  800ec6:	83 ec 0c             	sub    $0xc,%esp
+  800ec9:	50                   	push   %eax
+  800eca:	6a 08                	push   $0x8
+  800ecc:	68 6b 3b 80 00       	push   $0x803b6b
+  800ed1:	6a 24                	push   $0x24
+  800ed3:	68 88 3b 80 00       	push   $0x803b88
+  800ed8:	e8 f6 25 00 00       	call   8034d3 <_panic>
+
+00800edd <sys_env_set_trapframe>:
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	57                   	push   %edi
+  800ee1:	56                   	push   %esi
+  800ee2:	53                   	push   %ebx
+  800ee3:	83 ec 0c             	sub    $0xc,%esp
+  800ee6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ef6:	89 df                	mov    %ebx,%edi
+  800ef8:	89 de                	mov    %ebx,%esi
+  800efa:	cd 30                	int    $0x30
+  800efc:	85 c0                	test   %eax,%eax
+  800efe:	7f 08                	jg     800f08 <sys_env_set_trapframe+0x2b>
+  800f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+  800f08:	83 ec 0c             	sub    $0xc,%esp
+  800f0b:	50                   	push   %eax
+  800f0c:	6a 09                	push   $0x9
+  800f0e:	68 6b 3b 80 00       	push   $0x803b6b
+  800f13:	6a 24                	push   $0x24
+  800f15:	68 88 3b 80 00       	push   $0x803b88
+  800f1a:	e8 b4 25 00 00       	call   8034d3 <_panic>
+
+00800f1f <sys_env_set_cow>:
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f38:	89 df                	mov    %ebx,%edi
+  800f3a:	89 de                	mov    %ebx,%esi
+  800f3c:	cd 30                	int    $0x30
+  800f3e:	85 c0                	test   %eax,%eax
+  800f40:	7f 08                	jg     800f4a <sys_env_set_cow+0x2b>
+  800f42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  800f4d:	50                   	push   %eax
+  800f4e:	6a 20                	push   $0x20
+  800f50:	68 6b 3b 80 00       	push   $0x803b6b
+  800f55:	6a 24                	push   $0x24
+  800f57:	68 88 3b 80 00       	push   $0x803b88
+  800f5c:	e8 72 25 00 00       	call   8034d3 <_panic>
+
+00800f61 <sys_env_service>:
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f74:	89 cb                	mov    %ecx,%ebx
+  800f76:	89 cf                	mov    %ecx,%edi
+  800f78:	89 ce                	mov    %ecx,%esi
+  800f7a:	cd 30                	int    $0x30
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+
+00800f81 <sys_env_set_pgfault_upcall>:
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	56                   	push   %esi
+  800f86:	53                   	push   %ebx
+  800f87:	83 ec 0c             	sub    $0xc,%esp
+  800f8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f95:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f9a:	89 df                	mov    %ebx,%edi
+  800f9c:	89 de                	mov    %ebx,%esi
+  800f9e:	cd 30                	int    $0x30
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	7f 08                	jg     800fac <sys_env_set_pgfault_upcall+0x2b>
+  800fa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa7:	5b                   	pop    %ebx
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5f                   	pop    %edi
+  800faa:	5d                   	pop    %ebp
+  800fab:	c3                   	ret
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+  800faf:	50                   	push   %eax
+  800fb0:	6a 0a                	push   $0xa
+  800fb2:	68 6b 3b 80 00       	push   $0x803b6b
+  800fb7:	6a 24                	push   $0x24
+  800fb9:	68 88 3b 80 00       	push   $0x803b88
+  800fbe:	e8 10 25 00 00       	call   8034d3 <_panic>
+
+00800fc3 <sys_ipc_try_send>:
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+  800fc6:	57                   	push   %edi
+  800fc7:	56                   	push   %esi
+  800fc8:	53                   	push   %ebx
+  800fc9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fd0:	74 27                	je     800ff9 <sys_ipc_try_send+0x36>
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe3:	6a 00                	push   $0x0
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	8d 35 f0 0f 80 00    	lea    0x800ff0,%esi
+  800fee:	0f 34                	sysenter
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	83 c4 04             	add    $0x4,%esp
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+  800ff9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ffe:	be 00 00 00 00       	mov    $0x0,%esi
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80100f:	cd 30                	int    $0x30
+  801011:	eb e1                	jmp    800ff4 <sys_ipc_try_send+0x31>
+
+00801013 <sys_ipc_recv>:
+  801013:	55                   	push   %ebp
+  801014:	89 e5                	mov    %esp,%ebp
+  801016:	57                   	push   %edi
+  801017:	56                   	push   %esi
+  801018:	53                   	push   %ebx
+  801019:	83 ec 0c             	sub    $0xc,%esp
+  80101c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801023:	74 32                	je     801057 <sys_ipc_recv+0x44>
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80102d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801032:	89 cb                	mov    %ecx,%ebx
+  801034:	89 cf                	mov    %ecx,%edi
+  801036:	6a 00                	push   $0x0
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	8d 35 43 10 80 00    	lea    0x801043,%esi
+  801041:	0f 34                	sysenter
+  801043:	5d                   	pop    %ebp
+  801044:	83 c4 04             	add    $0x4,%esp
+  801047:	89 c2                	mov    %eax,%edx
+  801049:	85 c0                	test   %eax,%eax
+  80104b:	7f 3c                	jg     801089 <sys_ipc_recv+0x76>
+  80104d:	89 d0                	mov    %edx,%eax
+  80104f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+  801057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80105c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	89 cb                	mov    %ecx,%ebx
+  801066:	89 cf                	mov    %ecx,%edi
+  801068:	89 ce                	mov    %ecx,%esi
+  80106a:	cd 30                	int    $0x30
+  80106c:	89 c2                	mov    %eax,%edx
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	7e db                	jle    80104d <sys_ipc_recv+0x3a>
+  801072:	83 ec 0c             	sub    $0xc,%esp
+  801075:	50                   	push   %eax
+  801076:	6a 0d                	push   $0xd
+  801078:	68 6b 3b 80 00       	push   $0x803b6b
+  80107d:	6a 24                	push   $0x24
+  80107f:	68 88 3b 80 00       	push   $0x803b88
+  801084:	e8 4a 24 00 00       	call   8034d3 <_panic>
+  801089:	83 ec 0c             	sub    $0xc,%esp
+  80108c:	50                   	push   %eax
+  80108d:	6a 0d                	push   $0xd
+  80108f:	68 6b 3b 80 00       	push   $0x803b6b
+  801094:	6a 48                	push   $0x48
+  801096:	68 88 3b 80 00       	push   $0x803b88
+  80109b:	e8 33 24 00 00       	call   8034d3 <_panic>
+
+008010a0 <sys_ipc_send>:
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010ad:	74 27                	je     8010d6 <sys_ipc_send+0x36>
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c0:	6a 00                	push   $0x0
+  8010c2:	55                   	push   %ebp
+  8010c3:	89 e5                	mov    %esp,%ebp
+  8010c5:	8d 35 cd 10 80 00    	lea    0x8010cd,%esi
+  8010cb:	0f 34                	sysenter
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	83 c4 04             	add    $0x4,%esp
+  8010d1:	5b                   	pop    %ebx
+  8010d2:	5e                   	pop    %esi
+  8010d3:	5f                   	pop    %edi
+  8010d4:	5d                   	pop    %ebp
+  8010d5:	c3                   	ret
+  8010d6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010db:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ec:	cd 30                	int    $0x30
+  8010ee:	eb e1                	jmp    8010d1 <sys_ipc_send+0x31>
+
+008010f0 <sys_ipc_call>:
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+  8010f3:	57                   	push   %edi
+  8010f4:	56                   	push   %esi
+  8010f5:	53                   	push   %ebx
+  8010f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801101:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801104:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801107:	8b 75 18             	mov    0x18(%ebp),%esi
+  80110a:	cd 30                	int    $0x30
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+
+00801111 <sys_ipc_reply_recv>:
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	56                   	push   %esi
+  801116:	53                   	push   %ebx
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801122:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801125:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801128:	8b 75 18             	mov    0x18(%ebp),%esi
+  80112b:	cd 30                	int    $0x30
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+
+00801132 <sys_time_msec>:
+  801132:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801137:	85 c0                	test   %eax,%eax
+  801139:	75 06                	jne    801141 <sys_time_msec+0xf>
+  80113b:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801140:	c3                   	ret
+  801141:	55                   	push   %ebp
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	57                   	push   %edi
+  801145:	56                   	push   %esi
+  801146:	53                   	push   %ebx
+  801147:	83 ec 0c             	sub    $0xc,%esp
+  80114a:	0f 31                	rdtsc
+  80114c:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801152:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801158:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80115e:	29 c8                	sub    %ecx,%eax
+  801160:	19 da                	sbb    %ebx,%edx
+  801162:	bf 00 00 00 00       	mov    $0x0,%edi
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	52                   	push   %edx
+  80116a:	50                   	push   %eax
+  80116b:	e8 65 25 00 00       	call   8036d5 <__udivdi3>
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+
+0080117b <sys_env_swap>:
+  80117b:	55                   	push   %ebp
+  80117c:	89 e5                	mov    %esp,%ebp
+  80117e:	57                   	push   %edi
+  80117f:	56                   	push   %esi
+  801180:	53                   	push   %ebx
+  801181:	83 ec 0c             	sub    $0xc,%esp
+  801184:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801191:	89 cb                	mov    %ecx,%ebx
+  801193:	89 cf                	mov    %ecx,%edi
+  801195:	89 ce                	mov    %ecx,%esi
+  801197:	cd 30                	int    $0x30
+  801199:	85 c0                	test   %eax,%eax
+  80119b:	7f 08                	jg     8011a5 <sys_env_swap+0x2a>
+  80119d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5e                   	pop    %esi
+  8011a2:	5f                   	pop    %edi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+  8011a5:	83 ec 0c             	sub    $0xc,%esp
+  8011a8:	50                   	push   %eax
+  8011a9:	6a 12                	push   $0x12
+  8011ab:	68 6b 3b 80 00       	push   $0x803b6b
+  8011b0:	6a 24                	push   $0x24
+  8011b2:	68 88 3b 80 00       	push   $0x803b88
+  8011b7:	e8 17 23 00 00       	call   8034d3 <_panic>
+
+008011bc <sys_net_try_send>:
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+  8011c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011d5:	89 df                	mov    %ebx,%edi
+  8011d7:	89 de                	mov    %ebx,%esi
+  8011d9:	cd 30                	int    $0x30
+  8011db:	85 c0                	test   %eax,%eax
+  8011dd:	7f 08                	jg     8011e7 <sys_net_try_send+0x2b>
+  8011df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5e                   	pop    %esi
+  8011e4:	5f                   	pop    %edi
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+  8011e7:	83 ec 0c             	sub    $0xc,%esp
+  8011ea:	50                   	push   %eax
+  8011eb:	6a 13                	push   $0x13
+  8011ed:	68 6b 3b 80 00       	push   $0x803b6b
+  8011f2:	6a 24                	push   $0x24
+  8011f4:	68 88 3b 80 00       	push   $0x803b88
+  8011f9:	e8 d5 22 00 00       	call   8034d3 <_panic>
+
+008011fe <sys_net_try_receive>:
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 14 00 00 00       	mov    $0x14,%eax
+  801217:	89 df                	mov    %ebx,%edi
+  801219:	89 de                	mov    %ebx,%esi
+  80121b:	cd 30                	int    $0x30
+  80121d:	85 c0                	test   %eax,%eax
+  80121f:	7f 08                	jg     801229 <sys_net_try_receive+0x2b>
+  801221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801224:	5b                   	pop    %ebx
+  801225:	5e                   	pop    %esi
+  801226:	5f                   	pop    %edi
+  801227:	5d                   	pop    %ebp
+  801228:	c3                   	ret
+  801229:	83 ec 0c             	sub    $0xc,%esp
+  80122c:	50                   	push   %eax
+  80122d:	6a 14                	push   $0x14
+  80122f:	68 6b 3b 80 00       	push   $0x803b6b
+  801234:	6a 24                	push   $0x24
+  801236:	68 88 3b 80 00       	push   $0x803b88
+  80123b:	e8 93 22 00 00       	call   8034d3 <_panic>
+
+00801240 <sys_net_recv_page>:
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	57                   	push   %edi
+  801244:	56                   	push   %esi
+  801245:	53                   	push   %ebx
+  801246:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124e:	b8 27 00 00 00       	mov    $0x27,%eax
+  801253:	89 cb                	mov    %ecx,%ebx
+  801255:	89 cf                	mov    %ecx,%edi
+  801257:	89 ce                	mov    %ecx,%esi
+  801259:	cd 30                	int    $0x30
+  80125b:	5b                   	pop    %ebx
+  80125c:	5e                   	pop    %esi
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+
+00801260 <sys_net_wait>:
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	57                   	push   %edi
+  801264:	56                   	push   %esi
+  801265:	53                   	push   %ebx
+  801266:	ba 00 00 00 00       	mov    $0x0,%edx
+  80126b:	b8 26 00 00 00       	mov    $0x26,%eax
+  801270:	89 d1                	mov    %edx,%ecx
+  801272:	89 d3                	mov    %edx,%ebx
+  801274:	89 d7                	mov    %edx,%edi
+  801276:	89 d6                	mov    %edx,%esi
+  801278:	cd 30                	int    $0x30
+  80127a:	5b                   	pop    %ebx
+  80127b:	5e                   	pop    %esi
+  80127c:	5f                   	pop    %edi
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+
+0080127f <sys_get_mac>:
+  80127f:	55                   	push   %ebp
+  801280:	89 e5                	mov    %esp,%ebp
+  801282:	57                   	push   %edi
+  801283:	56                   	push   %esi
+  801284:	53                   	push   %ebx
+  801285:	83 ec 0c             	sub    $0xc,%esp
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	b8 15 00 00 00       	mov    $0x15,%eax
+  801298:	89 df                	mov    %ebx,%edi
+  80129a:	89 de                	mov    %ebx,%esi
+  80129c:	cd 30                	int    $0x30
+  80129e:	85 c0                	test   %eax,%eax
+  8012a0:	7f 08                	jg     8012aa <sys_get_mac+0x2b>
+  8012a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a5:	5b                   	pop    %ebx
+  8012a6:	5e                   	pop    %esi
+  8012a7:	5f                   	pop    %edi
+  8012a8:	5d                   	pop    %ebp
+  8012a9:	c3                   	ret
+  8012aa:	83 ec 0c             	sub    $0xc,%esp
+  8012ad:	50                   	push   %eax
+  8012ae:	6a 15                	push   $0x15
+  8012b0:	68 6b 3b 80 00       	push   $0x803b6b
+  8012b5:	6a 24                	push   $0x24
+  8012b7:	68 88 3b 80 00       	push   $0x803b88
+  8012bc:	e8 12 22 00 00       	call   8034d3 <_panic>
+
+008012c1 <sys_env_lease>:
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	57                   	push   %edi
+  8012c5:	56                   	push   %esi
+  8012c6:	53                   	push   %ebx
+  8012c7:	83 ec 0c             	sub    $0xc,%esp
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012da:	89 df                	mov    %ebx,%edi
+  8012dc:	89 de                	mov    %ebx,%esi
+  8012de:	cd 30                	int    $0x30
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	7f 08                	jg     8012ec <sys_env_lease+0x2b>
+  8012e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e7:	5b                   	pop    %ebx
+  8012e8:	5e                   	pop    %esi
+  8012e9:	5f                   	pop    %edi
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	50                   	push   %eax
+  8012f0:	6a 16                	push   $0x16
+  8012f2:	68 6b 3b 80 00       	push   $0x803b6b
+  8012f7:	6a 24                	push   $0x24
+  8012f9:	68 88 3b 80 00       	push   $0x803b88
+  8012fe:	e8 d0 21 00 00       	call   8034d3 <_panic>
+
+00801303 <sys_copy_mem>:
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	57                   	push   %edi
+  801307:	56                   	push   %esi
+  801308:	53                   	push   %ebx
+  801309:	83 ec 0c             	sub    $0xc,%esp
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801312:	b8 17 00 00 00       	mov    $0x17,%eax
+  801317:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80131d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801320:	cd 30                	int    $0x30
+  801322:	85 c0                	test   %eax,%eax
+  801324:	7f 08                	jg     80132e <sys_copy_mem+0x2b>
+  801326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	6a 17                	push   $0x17
+  801334:	68 6b 3b 80 00       	push   $0x803b6b
+  801339:	6a 24                	push   $0x24
+  80133b:	68 88 3b 80 00       	push   $0x803b88
+  801340:	e8 8e 21 00 00       	call   8034d3 <_panic>
+
+00801345 <sys_get_perms>:
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 18 00 00 00       	mov    $0x18,%eax
+  80135e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801361:	89 f7                	mov    %esi,%edi
+  801363:	cd 30                	int    $0x30
+  801365:	85 c0                	test   %eax,%eax
+  801367:	7f 08                	jg     801371 <sys_get_perms+0x2c>
+  801369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136c:	5b                   	pop    %ebx
+  80136d:	5e                   	pop    %esi
+  80136e:	5f                   	pop    %edi
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+  801371:	83 ec 0c             	sub    $0xc,%esp
+  801374:	50                   	push   %eax
+  801375:	6a 18                	push   $0x18
+  801377:	68 6b 3b 80 00       	push   $0x803b6b
+  80137c:	6a 24                	push   $0x24
+  80137e:	68 88 3b 80 00       	push   $0x803b88
+  801383:	e8 4b 21 00 00       	call   8034d3 <_panic>
+
+00801388 <sys_env_unsuspend>:
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	57                   	push   %edi
+  80138c:	56                   	push   %esi
+  80138d:	53                   	push   %ebx
+  80138e:	83 ec 0c             	sub    $0xc,%esp
+  801391:	be 00 00 00 00       	mov    $0x0,%esi
+  801396:	8b 55 08             	mov    0x8(%ebp),%edx
+  801399:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139c:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a4:	89 f7                	mov    %esi,%edi
+  8013a6:	cd 30                	int    $0x30
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	7f 08                	jg     8013b4 <sys_env_unsuspend+0x2c>
+  8013ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+  8013b4:	83 ec 0c             	sub    $0xc,%esp
+  8013b7:	50                   	push   %eax
+  8013b8:	6a 19                	push   $0x19
+  8013ba:	68 6b 3b 80 00       	push   $0x803b6b
+  8013bf:	6a 24                	push   $0x24
+  8013c1:	68 88 3b 80 00       	push   $0x803b88
+  8013c6:	e8 08 21 00 00       	call   8034d3 <_panic>
+
+008013cb <sys_migrate>:
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	57                   	push   %edi
+  8013cf:	56                   	push   %esi
+  8013d0:	53                   	push   %ebx
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+  8013d4:	ba 04 80 80 00       	mov    $0x808004,%edx
+  8013d9:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8013df:	76 11                	jbe    8013f2 <sys_migrate+0x27>
+  8013e1:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8013e6:	0f b6 08             	movzbl (%eax),%ecx
+  8013e9:	05 00 10 00 00       	add    $0x1000,%eax
+  8013ee:	39 d0                	cmp    %edx,%eax
+  8013f0:	72 f4                	jb     8013e6 <sys_migrate+0x1b>
+  8013f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013ff:	89 cb                	mov    %ecx,%ebx
+  801401:	89 cf                	mov    %ecx,%edi
+  801403:	89 ce                	mov    %ecx,%esi
+  801405:	cd 30                	int    $0x30
+  801407:	85 c0                	test   %eax,%eax
+  801409:	7f 08                	jg     801413 <sys_migrate+0x48>
+  80140b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140e:	5b                   	pop    %ebx
+  80140f:	5e                   	pop    %esi
+  801410:	5f                   	pop    %edi
+  801411:	5d                   	pop    %ebp
+  801412:	c3                   	ret
+  801413:	83 ec 0c             	sub    $0xc,%esp
+  801416:	50                   	push   %eax
+  801417:	6a 1a                	push   $0x1a
+  801419:	68 6b 3b 80 00       	push   $0x803b6b
+  80141e:	6a 24                	push   $0x24
+  801420:	68 88 3b 80 00       	push   $0x803b88
+  801425:	e8 a9 20 00 00       	call   8034d3 <_panic>
+
+0080142a <sys_lease_complete>:
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+  801430:	83 ec 0c             	sub    $0xc,%esp
+  801433:	ba 00 00 00 00       	mov    $0x0,%edx
+  801438:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80143d:	89 d1                	mov    %edx,%ecx
+  80143f:	89 d3                	mov    %edx,%ebx
+  801441:	89 d7                	mov    %edx,%edi
+  801443:	89 d6                	mov    %edx,%esi
+  801445:	cd 30                	int    $0x30
+  801447:	85 c0                	test   %eax,%eax
+  801449:	7f 08                	jg     801453 <sys_lease_complete+0x29>
+  80144b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144e:	5b                   	pop    %ebx
+  80144f:	5e                   	pop    %esi
+  801450:	5f                   	pop    %edi
+  801451:	5d                   	pop    %ebp
+  801452:	c3                   	ret
+  801453:	83 ec 0c             	sub    $0xc,%esp
+  801456:	50                   	push   %eax
+  801457:	6a 1b                	push   $0x1b
+  801459:	68 6b 3b 80 00       	push   $0x803b6b
+  80145e:	6a 24                	push   $0x24
+  801460:	68 88 3b 80 00       	push   $0x803b88
+  801465:	e8 69 20 00 00       	call   8034d3 <_panic>
+
+0080146a <sys_env_set_thisenv>:
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	57                   	push   %edi
+  80146e:	56                   	push   %esi
+  80146f:	53                   	push   %ebx
+  801470:	83 ec 0c             	sub    $0xc,%esp
+  801473:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801478:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801483:	89 df                	mov    %ebx,%edi
+  801485:	89 de                	mov    %ebx,%esi
+  801487:	cd 30                	int    $0x30
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	7f 08                	jg     801495 <sys_env_set_thisenv+0x2b>
+  80148d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801490:	5b                   	pop    %ebx
+  801491:	5e                   	pop    %esi
+  801492:	5f                   	pop    %edi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+  801495:	83 ec 0c             	sub    $0xc,%esp
+  801498:	50                   	push   %eax
+  801499:	6a 1c                	push   $0x1c
+  80149b:	68 6b 3b 80 00       	push   $0x803b6b
+  8014a0:	6a 24                	push   $0x24
+  8014a2:	68 88 3b 80 00       	push   $0x803b88
+  8014a7:	e8 27 20 00 00       	call   8034d3 <_panic>
+
+008014ac <sys_env_set_sched>:
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	57                   	push   %edi
+  8014b0:	56                   	push   %esi
+  8014b1:	53                   	push   %ebx
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c8:	89 f7                	mov    %esi,%edi
+  8014ca:	cd 30                	int    $0x30
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	7f 08                	jg     8014d8 <sys_env_set_sched+0x2c>
+  8014d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d3:	5b                   	pop    %ebx
+  8014d4:	5e                   	pop    %esi
+  8014d5:	5f                   	pop    %edi
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+  8014d8:	83 ec 0c             	sub    $0xc,%esp
+  8014db:	50                   	push   %eax
+  8014dc:	6a 1d                	push   $0x1d
+  8014de:	68 6b 3b 80 00       	push   $0x803b6b
+  8014e3:	6a 24                	push   $0x24
+  8014e5:	68 88 3b 80 00       	push   $0x803b88
+  8014ea:	e8 e4 1f 00 00       	call   8034d3 <_panic>
+
+008014ef <sys_batch>:
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	57                   	push   %edi
+  8014f3:	56                   	push   %esi
+  8014f4:	53                   	push   %ebx
+  8014f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801500:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801505:	89 df                	mov    %ebx,%edi
+  801507:	89 de                	mov    %ebx,%esi
+  801509:	cd 30                	int    $0x30
+  80150b:	5b                   	pop    %ebx
+  80150c:	5e                   	pop    %esi
+  80150d:	5f                   	pop    %edi
+  80150e:	5d                   	pop    %ebp
+  80150f:	c3                   	ret
+
+00801510 <sys_env_stats>:
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	57                   	push   %edi
+  801514:	56                   	push   %esi
+  801515:	53                   	push   %ebx
+  801516:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801521:	b8 23 00 00 00       	mov    $0x23,%eax
+  801526:	89 df                	mov    %ebx,%edi
+  801528:	89 de                	mov    %ebx,%esi
+  80152a:	cd 30                	int    $0x30
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+
+00801531 <sys_trace>:
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+  801537:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153f:	b8 24 00 00 00       	mov    $0x24,%eax
+  801544:	89 cb                	mov    %ecx,%ebx
+  801546:	89 cf                	mov    %ecx,%edi
+  801548:	89 ce                	mov    %ecx,%esi
+  80154a:	cd 30                	int    $0x30
+  80154c:	5b                   	pop    %ebx
+  80154d:	5e                   	pop    %esi
+  80154e:	5f                   	pop    %edi
+  80154f:	5d                   	pop    %ebp
+  801550:	c3                   	ret
+
+00801551 <sys_env_set_pager>:
+  801551:	55                   	push   %ebp
+  801552:	89 e5                	mov    %esp,%ebp
+  801554:	57                   	push   %edi
+  801555:	56                   	push   %esi
+  801556:	53                   	push   %ebx
+  801557:	83 ec 0c             	sub    $0xc,%esp
+  80155a:	be 00 00 00 00       	mov    $0x0,%esi
+  80155f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801562:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801565:	b8 25 00 00 00       	mov    $0x25,%eax
+  80156a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156d:	89 f7                	mov    %esi,%edi
+  80156f:	cd 30                	int    $0x30
+  801571:	85 c0                	test   %eax,%eax
+  801573:	7f 08                	jg     80157d <sys_env_set_pager+0x2c>
+  801575:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801578:	5b                   	pop    %ebx
+  801579:	5e                   	pop    %esi
+  80157a:	5f                   	pop    %edi
+  80157b:	5d                   	pop    %ebp
+  80157c:	c3                   	ret
+  80157d:	83 ec 0c             	sub    $0xc,%esp
+  801580:	50                   	push   %eax
+  801581:	6a 25                	push   $0x25
+  801583:	68 6b 3b 80 00       	push   $0x803b6b
+  801588:	6a 24                	push   $0x24
+  80158a:	68 88 3b 80 00       	push   $0x803b88
+  80158f:	e8 3f 1f 00 00       	call   8034d3 <_panic>
+
+00801594 <sys_pager_retire>:
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	57                   	push   %edi
+  801598:	56                   	push   %esi
+  801599:	53                   	push   %ebx
+  80159a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a2:	b8 28 00 00 00       	mov    $0x28,%eax
+  8015a7:	89 cb                	mov    %ecx,%ebx
+  8015a9:	89 cf                	mov    %ecx,%edi
+  8015ab:	89 ce                	mov    %ecx,%esi
+  8015ad:	cd 30                	int    $0x30
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+
+008015b4 <sys_prof>:
+  8015b4:	55                   	push   %ebp
+  8015b5:	89 e5                	mov    %esp,%ebp
+  8015b7:	57                   	push   %edi
+  8015b8:	56                   	push   %esi
+  8015b9:	53                   	push   %ebx
+  8015ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015cd:	89 f7                	mov    %esi,%edi
+  8015cf:	cd 30                	int    $0x30
+  8015d1:	5b                   	pop    %ebx
+  8015d2:	5e                   	pop    %esi
+  8015d3:	5f                   	pop    %edi
+  8015d4:	5d                   	pop    %ebp
+  8015d5:	c3                   	ret
+
+008015d6 <dupq_flush>:
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	53                   	push   %ebx
+  8015da:	83 ec 0c             	sub    $0xc,%esp
+  8015dd:	8b 1d 00 50 80 00    	mov    0x805000,%ebx
+  8015e3:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8015ea:	00 00 00 
+  8015ed:	53                   	push   %ebx
+  8015ee:	68 00 00 40 00       	push   $0x400000
+  8015f3:	e8 f7 fe ff ff       	call   8014ef <sys_batch>
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	85 c0                	test   %eax,%eax
+  8015fd:	78 14                	js     801613 <dupq_flush+0x3d>
+  8015ff:	39 c3                	cmp    %eax,%ebx
+  801601:	7e 0b                	jle    80160e <dupq_flush+0x38>
+  801603:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801606:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  80160c:	eb 05                	jmp    801613 <dupq_flush+0x3d>
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801613:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801616:	c9                   	leave
+  801617:	c3                   	ret
+
+00801618 <pgfault>:
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	56                   	push   %esi
+  80161c:	53                   	push   %ebx
+  80161d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801620:	8b 30                	mov    (%eax),%esi
+  801622:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801626:	0f 84 83 00 00 00    	je     8016af <pgfault+0x97>
+  80162c:	89 f0                	mov    %esi,%eax
+  80162e:	c1 e8 0c             	shr    $0xc,%eax
+  801631:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801638:	f6 c4 08             	test   $0x8,%ah
+  80163b:	0f 84 80 00 00 00    	je     8016c1 <pgfault+0xa9>
+  801641:	e8 b8 f6 ff ff       	call   800cfe <sys_getenvid>
+  801646:	89 c3                	mov    %eax,%ebx
+  801648:	83 ec 04             	sub    $0x4,%esp
+  80164b:	6a 07                	push   $0x7
+  80164d:	68 00 f0 7f 00       	push   $0x7ff000
+  801652:	50                   	push   %eax
+  801653:	e8 10 f7 ff ff       	call   800d68 <sys_page_alloc>
+  801658:	83 c4 10             	add    $0x10,%esp
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	78 74                	js     8016d3 <pgfault+0xbb>
+  80165f:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801665:	83 ec 04             	sub    $0x4,%esp
+  801668:	68 00 10 00 00       	push   $0x1000
+  80166d:	56                   	push   %esi
+  80166e:	68 00 f0 7f 00       	push   $0x7ff000
+  801673:	e8 40 f4 ff ff       	call   800ab8 <memmove>
+  801678:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80167f:	56                   	push   %esi
+  801680:	53                   	push   %ebx
+  801681:	68 00 f0 7f 00       	push   $0x7ff000
+  801686:	53                   	push   %ebx
+  801687:	e8 1f f7 ff ff       	call   800dab <sys_page_map>
+  80168c:	83 c4 20             	add    $0x20,%esp
+  80168f:	85 c0                	test   %eax,%eax
+  801691:	78 54                	js     8016e7 <pgfault+0xcf>
+  801693:	83 ec 08             	sub    $0x8,%esp
+  801696:	68 00 f0 7f 00       	push   $0x7ff000
+  80169b:	53                   	push   %ebx
+  80169c:	e8 99 f7 ff ff       	call   800e3a <sys_page_unmap>
+  8016a1:	83 c4 10             	add    $0x10,%esp
+  8016a4:	85 c0                	test   %eax,%eax
+  8016a6:	78 53                	js     8016fb <pgfault+0xe3>
+  8016a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ab:	5b                   	pop    %ebx
+  8016ac:	5e                   	pop    %esi
+  8016ad:	5d                   	pop    %ebp
+  8016ae:	c3                   	ret
+  8016af:	56                   	push   %esi
+  8016b0:	68 98 3b 80 00       	push   $0x803b98
+  8016b5:	6a 19                	push   $0x19
+  8016b7:	68 74 3c 80 00       	push   $0x803c74
+  8016bc:	e8 12 1e 00 00       	call   8034d3 <_panic>
+  8016c1:	56                   	push   %esi
+  8016c2:	68 cc 3b 80 00       	push   $0x803bcc
+  8016c7:	6a 1e                	push   $0x1e
+  8016c9:	68 74 3c 80 00       	push   $0x803c74
+  8016ce:	e8 00 1e 00 00       	call   8034d3 <_panic>
+  8016d3:	83 ec 04             	sub    $0x4,%esp
+  8016d6:	68 00 3c 80 00       	push   $0x803c00
+  8016db:	6a 2e                	push   $0x2e
+  8016dd:	68 74 3c 80 00       	push   $0x803c74
+  8016e2:	e8 ec 1d 00 00       	call   8034d3 <_panic>
+  8016e7:	83 ec 04             	sub    $0x4,%esp
+  8016ea:	68 24 3c 80 00       	push   $0x803c24
+  8016ef:	6a 37                	push   $0x37
+  8016f1:	68 74 3c 80 00       	push   $0x803c74
+  8016f6:	e8 d8 1d 00 00       	call   8034d3 <_panic>
+  8016fb:	83 ec 04             	sub    $0x4,%esp
+  8016fe:	68 50 3c 80 00       	push   $0x803c50
+  801703:	6a 3c                	push   $0x3c
+  801705:	68 74 3c 80 00       	push   $0x803c74
+  80170a:	e8 c4 1d 00 00       	call   8034d3 <_panic>
+
+0080170f <dupq_begin>:
+  80170f:	55                   	push   %ebp
+  801710:	89 e5                	mov    %esp,%ebp
+  801712:	83 ec 0c             	sub    $0xc,%esp
+  801715:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80171c:	00 00 00 
+  80171f:	6a 07                	push   $0x7
+  801721:	68 00 00 40 00       	push   $0x400000
+  801726:	6a 00                	push   $0x0
+  801728:	e8 3b f6 ff ff       	call   800d68 <sys_page_alloc>
+  80172d:	c9                   	leave
+  80172e:	c3                   	ret
+
+0080172f <dupq_map>:
+  80172f:	55                   	push   %ebp
+  801730:	89 e5                	mov    %esp,%ebp
+  801732:	83 ec 08             	sub    $0x8,%esp
+  801735:	81 3d 00 50 80 00 92 	cmpl   $0x92,0x805000
+  80173c:	00 00 00 
+  80173f:	74 46                	je     801787 <dupq_map+0x58>
+  801741:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  801747:	8d 42 01             	lea    0x1(%edx),%eax
+  80174a:	a3 00 50 80 00       	mov    %eax,0x805000
+  80174f:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801752:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801758:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  80175f:	00 00 00 
+  801762:	8b 55 08             	mov    0x8(%ebp),%edx
+  801765:	89 50 04             	mov    %edx,0x4(%eax)
+  801768:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80176b:	c1 e2 0c             	shl    $0xc,%edx
+  80176e:	89 50 08             	mov    %edx,0x8(%eax)
+  801771:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801774:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801777:	89 50 10             	mov    %edx,0x10(%eax)
+  80177a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80177d:	89 50 14             	mov    %edx,0x14(%eax)
+  801780:	b8 00 00 00 00       	mov    $0x0,%eax
+  801785:	c9                   	leave
+  801786:	c3                   	ret
+  801787:	e8 4a fe ff ff       	call   8015d6 <dupq_flush>
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	79 b1                	jns    801741 <dupq_map+0x12>
+  801790:	eb f3                	jmp    801785 <dupq_map+0x56>
+
+00801792 <dupq_end>:
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	53                   	push   %ebx
+  801796:	83 ec 04             	sub    $0x4,%esp
+  801799:	e8 38 fe ff ff       	call   8015d6 <dupq_flush>
+  80179e:	89 c3                	mov    %eax,%ebx
+  8017a0:	83 ec 08             	sub    $0x8,%esp
+  8017a3:	68 00 00 40 00       	push   $0x400000
+  8017a8:	6a 00                	push   $0x0
+  8017aa:	e8 8b f6 ff ff       	call   800e3a <sys_page_unmap>
+  8017af:	89 d8                	mov    %ebx,%eax
+  8017b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+008017b6 <fork>:
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	53                   	push   %ebx
+  8017ba:	83 ec 10             	sub    $0x10,%esp
+  8017bd:	68 18 16 80 00       	push   $0x801618
+  8017c2:	e8 52 1d 00 00       	call   803519 <set_pgfault_handler>
+  8017c7:	83 c4 08             	add    $0x8,%esp
+  8017ca:	6a 01                	push   $0x1
+  8017cc:	6a 00                	push   $0x0
+  8017ce:	e8 4c f7 ff ff       	call   800f1f <sys_env_set_cow>
+  8017d3:	e8 a4 f6 ff ff       	call   800e7c <sys_fork>
+  8017d8:	89 c3                	mov    %eax,%ebx
+  8017da:	83 c4 10             	add    $0x10,%esp
+  8017dd:	85 c0                	test   %eax,%eax
+  8017df:	74 07                	je     8017e8 <fork+0x32>
+  8017e1:	89 d8                	mov    %ebx,%eax
+  8017e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+  8017e8:	e8 11 f5 ff ff       	call   800cfe <sys_getenvid>
+  8017ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017f2:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8017f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017fd:	a3 18 50 80 00       	mov    %eax,0x805018
+  801802:	eb dd                	jmp    8017e1 <fork+0x2b>
+
+00801804 <sfork>:
+  801804:	55                   	push   %ebp
+  801805:	89 e5                	mov    %esp,%ebp
+  801807:	57                   	push   %edi
+  801808:	56                   	push   %esi
+  801809:	53                   	push   %ebx
+  80180a:	83 ec 1c             	sub    $0x1c,%esp
+  80180d:	e8 ec f4 ff ff       	call   800cfe <sys_getenvid>
+  801812:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801815:	83 ec 0c             	sub    $0xc,%esp
+  801818:	68 18 16 80 00       	push   $0x801618
+  80181d:	e8 f7 1c 00 00       	call   803519 <set_pgfault_handler>
+  801822:	b8 07 00 00 00       	mov    $0x7,%eax
+  801827:	cd 30                	int    $0x30
+  801829:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80182c:	83 c4 10             	add    $0x10,%esp
+  80182f:	85 c0                	test   %eax,%eax
+  801831:	0f 88 45 02 00 00    	js     801a7c <sfork+0x278>
+  801837:	89 c6                	mov    %eax,%esi
+  801839:	74 17                	je     801852 <sfork+0x4e>
+  80183b:	e8 cf fe ff ff       	call   80170f <dupq_begin>
+  801840:	85 c0                	test   %eax,%eax
+  801842:	0f 88 40 02 00 00    	js     801a88 <sfork+0x284>
+  801848:	bf 02 00 00 00       	mov    $0x2,%edi
+  80184d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801850:	eb 39                	jmp    80188b <sfork+0x87>
+  801852:	e8 a7 f4 ff ff       	call   800cfe <sys_getenvid>
+  801857:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80185c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801862:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801867:	a3 18 50 80 00       	mov    %eax,0x805018
+  80186c:	e9 23 01 00 00       	jmp    801994 <sfork+0x190>
+  801871:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801878:	a8 01                	test   $0x1,%al
+  80187a:	75 5b                	jne    8018d7 <sfork+0xd3>
+  80187c:	83 c7 01             	add    $0x1,%edi
+  80187f:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801885:	0f 84 40 01 00 00    	je     8019cb <sfork+0x1c7>
+  80188b:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801892:	a8 01                	test   $0x1,%al
+  801894:	74 db                	je     801871 <sfork+0x6d>
+  801896:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80189d:	a8 80                	test   $0x80,%al
+  80189f:	74 d0                	je     801871 <sfork+0x6d>
+  8018a1:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018a8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018ad:	0c 80                	or     $0x80,%al
+  8018af:	50                   	push   %eax
+  8018b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8018b3:	89 f8                	mov    %edi,%eax
+  8018b5:	c1 e0 16             	shl    $0x16,%eax
+  8018b8:	c1 e8 0c             	shr    $0xc,%eax
+  8018bb:	50                   	push   %eax
+  8018bc:	ff 75 e0             	push   -0x20(%ebp)
+  8018bf:	e8 6b fe ff ff       	call   80172f <dupq_map>
+  8018c4:	83 c4 10             	add    $0x10,%esp
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	79 b1                	jns    80187c <sfork+0x78>
+  8018cb:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8018d2:	e9 bd 00 00 00       	jmp    801994 <sfork+0x190>
+  8018d7:	89 fe                	mov    %edi,%esi
+  8018d9:	c1 e6 16             	shl    $0x16,%esi
+  8018dc:	89 f0                	mov    %esi,%eax
+  8018de:	c1 e8 0c             	shr    $0xc,%eax
+  8018e1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8018e6:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8018e9:	eb 57                	jmp    801942 <sfork+0x13e>
+  8018eb:	e8 0e f4 ff ff       	call   800cfe <sys_getenvid>
+  8018f0:	89 c7                	mov    %eax,%edi
+  8018f2:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  8018f7:	f6 c4 04             	test   $0x4,%ah
+  8018fa:	0f 85 9f 00 00 00    	jne    80199f <sfork+0x19b>
+  801900:	a9 02 08 00 00       	test   $0x802,%eax
+  801905:	0f 85 c5 01 00 00    	jne    801ad0 <sfork+0x2cc>
+  80190b:	6a 05                	push   $0x5
+  80190d:	ff 75 e4             	push   -0x1c(%ebp)
+  801910:	68 fd e7 0e 00       	push   $0xee7fd
+  801915:	57                   	push   %edi
+  801916:	e8 14 fe ff ff       	call   80172f <dupq_map>
+  80191b:	83 c4 10             	add    $0x10,%esp
+  80191e:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801924:	0f 84 91 00 00 00    	je     8019bb <sfork+0x1b7>
+  80192a:	89 f0                	mov    %esi,%eax
+  80192c:	09 d8                	or     %ebx,%eax
+  80192e:	c1 e8 0c             	shr    $0xc,%eax
+  801931:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801937:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  80193c:	0f 84 81 00 00 00    	je     8019c3 <sfork+0x1bf>
+  801942:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801947:	74 a2                	je     8018eb <sfork+0xe7>
+  801949:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801950:	f6 c2 01             	test   $0x1,%dl
+  801953:	74 c9                	je     80191e <sfork+0x11a>
+  801955:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80195c:	f6 c6 02             	test   $0x2,%dh
+  80195f:	75 bd                	jne    80191e <sfork+0x11a>
+  801961:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801968:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80196f:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801975:	f7 d2                	not    %edx
+  801977:	21 ca                	and    %ecx,%edx
+  801979:	52                   	push   %edx
+  80197a:	ff 75 e4             	push   -0x1c(%ebp)
+  80197d:	50                   	push   %eax
+  80197e:	ff 75 e0             	push   -0x20(%ebp)
+  801981:	e8 a9 fd ff ff       	call   80172f <dupq_map>
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	79 91                	jns    80191e <sfork+0x11a>
+  80198d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801994:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199a:	5b                   	pop    %ebx
+  80199b:	5e                   	pop    %esi
+  80199c:	5f                   	pop    %edi
+  80199d:	5d                   	pop    %ebp
+  80199e:	c3                   	ret
+  80199f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019a4:	50                   	push   %eax
+  8019a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8019a8:	68 fd e7 0e 00       	push   $0xee7fd
+  8019ad:	57                   	push   %edi
+  8019ae:	e8 7c fd ff ff       	call   80172f <dupq_map>
+  8019b3:	83 c4 10             	add    $0x10,%esp
+  8019b6:	e9 63 ff ff ff       	jmp    80191e <sfork+0x11a>
+  8019bb:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8019be:	e9 b9 fe ff ff       	jmp    80187c <sfork+0x78>
+  8019c3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8019c6:	e9 b1 fe ff ff       	jmp    80187c <sfork+0x78>
+  8019cb:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8019ce:	e8 bf fd ff ff       	call   801792 <dupq_end>
+  8019d3:	85 c0                	test   %eax,%eax
+  8019d5:	0f 88 b9 00 00 00    	js     801a94 <sfork+0x290>
+  8019db:	83 ec 04             	sub    $0x4,%esp
+  8019de:	6a 07                	push   $0x7
+  8019e0:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019e5:	56                   	push   %esi
+  8019e6:	e8 7d f3 ff ff       	call   800d68 <sys_page_alloc>
+  8019eb:	83 c4 10             	add    $0x10,%esp
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	0f 88 aa 00 00 00    	js     801aa0 <sfork+0x29c>
+  8019f6:	83 ec 0c             	sub    $0xc,%esp
+  8019f9:	6a 07                	push   $0x7
+  8019fb:	68 00 f0 7f 00       	push   $0x7ff000
+  801a00:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801a03:	57                   	push   %edi
+  801a04:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a09:	56                   	push   %esi
+  801a0a:	e8 9c f3 ff ff       	call   800dab <sys_page_map>
+  801a0f:	83 c4 20             	add    $0x20,%esp
+  801a12:	85 c0                	test   %eax,%eax
+  801a14:	0f 88 92 00 00 00    	js     801aac <sfork+0x2a8>
+  801a1a:	83 ec 04             	sub    $0x4,%esp
+  801a1d:	68 00 10 00 00       	push   $0x1000
+  801a22:	68 00 f0 7f 00       	push   $0x7ff000
+  801a27:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a2c:	e8 87 f0 ff ff       	call   800ab8 <memmove>
+  801a31:	83 c4 08             	add    $0x8,%esp
+  801a34:	68 00 f0 7f 00       	push   $0x7ff000
+  801a39:	57                   	push   %edi
+  801a3a:	e8 fb f3 ff ff       	call   800e3a <sys_page_unmap>
+  801a3f:	83 c4 10             	add    $0x10,%esp
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	78 72                	js     801ab8 <sfork+0x2b4>
+  801a46:	83 ec 08             	sub    $0x8,%esp
+  801a49:	68 91 35 80 00       	push   $0x803591
+  801a4e:	56                   	push   %esi
+  801a4f:	e8 2d f5 ff ff       	call   800f81 <sys_env_set_pgfault_upcall>
+  801a54:	83 c4 10             	add    $0x10,%esp
+  801a57:	85 c0                	test   %eax,%eax
+  801a59:	78 69                	js     801ac4 <sfork+0x2c0>
+  801a5b:	83 ec 08             	sub    $0x8,%esp
+  801a5e:	6a 02                	push   $0x2
+  801a60:	56                   	push   %esi
+  801a61:	e8 35 f4 ff ff       	call   800e9b <sys_env_set_status>
+  801a66:	83 c4 10             	add    $0x10,%esp
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a70:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801a74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a77:	e9 18 ff ff ff       	jmp    801994 <sfork+0x190>
+  801a7c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a83:	e9 0c ff ff ff       	jmp    801994 <sfork+0x190>
+  801a88:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a8f:	e9 00 ff ff ff       	jmp    801994 <sfork+0x190>
+  801a94:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a9b:	e9 f4 fe ff ff       	jmp    801994 <sfork+0x190>
+  801aa0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801aa7:	e9 e8 fe ff ff       	jmp    801994 <sfork+0x190>
+  801aac:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ab3:	e9 dc fe ff ff       	jmp    801994 <sfork+0x190>
+  801ab8:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801abf:	e9 d0 fe ff ff       	jmp    801994 <sfork+0x190>
+  801ac4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801acb:	e9 c4 fe ff ff       	jmp    801994 <sfork+0x190>
+  801ad0:	68 05 08 00 00       	push   $0x805
+  801ad5:	ff 75 e4             	push   -0x1c(%ebp)
+  801ad8:	68 fd e7 0e 00       	push   $0xee7fd
+  801add:	57                   	push   %edi
+  801ade:	e8 4c fc ff ff       	call   80172f <dupq_map>
+  801ae3:	83 c4 10             	add    $0x10,%esp
+  801ae6:	85 c0                	test   %eax,%eax
+  801ae8:	0f 88 30 fe ff ff    	js     80191e <sfork+0x11a>
+  801aee:	68 05 08 00 00       	push   $0x805
+  801af3:	57                   	push   %edi
+  801af4:	68 fd e7 0e 00       	push   $0xee7fd
+  801af9:	57                   	push   %edi
+  801afa:	e8 30 fc ff ff       	call   80172f <dupq_map>
+  801aff:	83 c4 10             	add    $0x10,%esp
+  801b02:	e9 17 fe ff ff       	jmp    80191e <sfork+0x11a>
+
+00801b07 <ipc_recv>:
+  801b07:	55                   	push   %ebp
+  801b08:	89 e5                	mov    %esp,%ebp
+  801b0a:	56                   	push   %esi
+  801b0b:	53                   	push   %ebx
+  801b0c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801b1c:	0f 44 c2             	cmove  %edx,%eax
+  801b1f:	83 ec 0c             	sub    $0xc,%esp
+  801b22:	50                   	push   %eax
+  801b23:	e8 eb f4 ff ff       	call   801013 <sys_ipc_recv>
+  801b28:	83 c4 10             	add    $0x10,%esp
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	78 2a                	js     801b59 <ipc_recv+0x52>
+  801b2f:	a1 18 50 80 00       	mov    0x805018,%eax
+  801b34:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801b3a:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801b40:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801b46:	85 f6                	test   %esi,%esi
+  801b48:	74 02                	je     801b4c <ipc_recv+0x45>
+  801b4a:	89 0e                	mov    %ecx,(%esi)
+  801b4c:	85 db                	test   %ebx,%ebx
+  801b4e:	74 02                	je     801b52 <ipc_recv+0x4b>
+  801b50:	89 13                	mov    %edx,(%ebx)
+  801b52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5d                   	pop    %ebp
+  801b58:	c3                   	ret
+  801b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b63:	eb e1                	jmp    801b46 <ipc_recv+0x3f>
+
+00801b65 <ipc_send>:
+  801b65:	55                   	push   %ebp
+  801b66:	89 e5                	mov    %esp,%ebp
+  801b68:	57                   	push   %edi
+  801b69:	56                   	push   %esi
+  801b6a:	53                   	push   %ebx
+  801b6b:	83 ec 0c             	sub    $0xc,%esp
+  801b6e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b74:	8b 75 14             	mov    0x14(%ebp),%esi
+  801b77:	85 db                	test   %ebx,%ebx
+  801b79:	74 1e                	je     801b99 <ipc_send+0x34>
+  801b7b:	56                   	push   %esi
+  801b7c:	53                   	push   %ebx
+  801b7d:	57                   	push   %edi
+  801b7e:	ff 75 08             	push   0x8(%ebp)
+  801b81:	e8 1a f5 ff ff       	call   8010a0 <sys_ipc_send>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	74 2a                	je     801bb7 <ipc_send+0x52>
+  801b8d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b90:	75 13                	jne    801ba5 <ipc_send+0x40>
+  801b92:	e8 86 f1 ff ff       	call   800d1d <sys_yield>
+  801b97:	eb e2                	jmp    801b7b <ipc_send+0x16>
+  801b99:	be 00 00 00 00       	mov    $0x0,%esi
+  801b9e:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801ba3:	eb d6                	jmp    801b7b <ipc_send+0x16>
+  801ba5:	50                   	push   %eax
+  801ba6:	68 80 3c 80 00       	push   $0x803c80
+  801bab:	6a 4f                	push   $0x4f
+  801bad:	68 c3 3c 80 00       	push   $0x803cc3
+  801bb2:	e8 1c 19 00 00       	call   8034d3 <_panic>
+  801bb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bba:	5b                   	pop    %ebx
+  801bbb:	5e                   	pop    %esi
+  801bbc:	5f                   	pop    %edi
+  801bbd:	5d                   	pop    %ebp
+  801bbe:	c3                   	ret
+
+00801bbf <ipc_call>:
+  801bbf:	55                   	push   %ebp
+  801bc0:	89 e5                	mov    %esp,%ebp
+  801bc2:	57                   	push   %edi
+  801bc3:	56                   	push   %esi
+  801bc4:	53                   	push   %ebx
+  801bc5:	83 ec 0c             	sub    $0xc,%esp
+  801bc8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801bcc:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801bd1:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801bd5:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801bd9:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801bde:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801be2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801be6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801beb:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801bef:	eb 05                	jmp    801bf6 <ipc_call+0x37>
+  801bf1:	e8 27 f1 ff ff       	call   800d1d <sys_yield>
+  801bf6:	83 ec 0c             	sub    $0xc,%esp
+  801bf9:	56                   	push   %esi
+  801bfa:	53                   	push   %ebx
+  801bfb:	57                   	push   %edi
+  801bfc:	ff 75 0c             	push   0xc(%ebp)
+  801bff:	ff 75 08             	push   0x8(%ebp)
+  801c02:	e8 e9 f4 ff ff       	call   8010f0 <sys_ipc_call>
+  801c07:	83 c4 20             	add    $0x20,%esp
+  801c0a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c0d:	74 e2                	je     801bf1 <ipc_call+0x32>
+  801c0f:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801c12:	74 2d                	je     801c41 <ipc_call+0x82>
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	78 4f                	js     801c67 <ipc_call+0xa8>
+  801c18:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801c1c:	74 10                	je     801c2e <ipc_call+0x6f>
+  801c1e:	a1 18 50 80 00       	mov    0x805018,%eax
+  801c23:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801c29:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801c2c:	89 02                	mov    %eax,(%edx)
+  801c2e:	a1 18 50 80 00       	mov    0x805018,%eax
+  801c33:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801c39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3c:	5b                   	pop    %ebx
+  801c3d:	5e                   	pop    %esi
+  801c3e:	5f                   	pop    %edi
+  801c3f:	5d                   	pop    %ebp
+  801c40:	c3                   	ret
+  801c41:	ff 75 14             	push   0x14(%ebp)
+  801c44:	ff 75 10             	push   0x10(%ebp)
+  801c47:	ff 75 0c             	push   0xc(%ebp)
+  801c4a:	ff 75 08             	push   0x8(%ebp)
+  801c4d:	e8 13 ff ff ff       	call   801b65 <ipc_send>
+  801c52:	83 c4 0c             	add    $0xc,%esp
+  801c55:	ff 75 1c             	push   0x1c(%ebp)
+  801c58:	ff 75 18             	push   0x18(%ebp)
+  801c5b:	6a 00                	push   $0x0
+  801c5d:	e8 a5 fe ff ff       	call   801b07 <ipc_recv>
+  801c62:	83 c4 10             	add    $0x10,%esp
+  801c65:	eb d2                	jmp    801c39 <ipc_call+0x7a>
+  801c67:	50                   	push   %eax
+  801c68:	68 cd 3c 80 00       	push   $0x803ccd
+  801c6d:	6a 6d                	push   $0x6d
+  801c6f:	68 c3 3c 80 00       	push   $0x803cc3
+  801c74:	e8 5a 18 00 00       	call   8034d3 <_panic>
+
+00801c79 <ipc_reply_recv>:
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	57                   	push   %edi
+  801c7d:	56                   	push   %esi
+  801c7e:	53                   	push   %ebx
+  801c7f:	83 ec 0c             	sub    $0xc,%esp
+  801c82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c85:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801c88:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801c8b:	85 db                	test   %ebx,%ebx
+  801c8d:	0f 84 ac 00 00 00    	je     801d3f <ipc_reply_recv+0xc6>
+  801c93:	85 f6                	test   %esi,%esi
+  801c95:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801c9a:	0f 45 c6             	cmovne %esi,%eax
+  801c9d:	83 ec 0c             	sub    $0xc,%esp
+  801ca0:	50                   	push   %eax
+  801ca1:	ff 75 14             	push   0x14(%ebp)
+  801ca4:	53                   	push   %ebx
+  801ca5:	ff 75 0c             	push   0xc(%ebp)
+  801ca8:	ff 75 08             	push   0x8(%ebp)
+  801cab:	e8 61 f4 ff ff       	call   801111 <sys_ipc_reply_recv>
+  801cb0:	83 c4 20             	add    $0x20,%esp
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	78 3a                	js     801cf1 <ipc_reply_recv+0x78>
+  801cb7:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801cbb:	74 10                	je     801ccd <ipc_reply_recv+0x54>
+  801cbd:	a1 18 50 80 00       	mov    0x805018,%eax
+  801cc2:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801cc8:	8b 55 18             	mov    0x18(%ebp),%edx
+  801ccb:	89 02                	mov    %eax,(%edx)
+  801ccd:	85 ff                	test   %edi,%edi
+  801ccf:	74 0d                	je     801cde <ipc_reply_recv+0x65>
+  801cd1:	a1 18 50 80 00       	mov    0x805018,%eax
+  801cd6:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801cdc:	89 07                	mov    %eax,(%edi)
+  801cde:	a1 18 50 80 00       	mov    0x805018,%eax
+  801ce3:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cec:	5b                   	pop    %ebx
+  801ced:	5e                   	pop    %esi
+  801cee:	5f                   	pop    %edi
+  801cef:	5d                   	pop    %ebp
+  801cf0:	c3                   	ret
+  801cf1:	ff 75 14             	push   0x14(%ebp)
+  801cf4:	53                   	push   %ebx
+  801cf5:	ff 75 0c             	push   0xc(%ebp)
+  801cf8:	ff 75 08             	push   0x8(%ebp)
+  801cfb:	e8 c3 f2 ff ff       	call   800fc3 <sys_ipc_try_send>
+  801d00:	89 c2                	mov    %eax,%edx
+  801d02:	c1 ea 1f             	shr    $0x1f,%edx
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801d0b:	0f 95 c1             	setne  %cl
+  801d0e:	84 d1                	test   %dl,%cl
+  801d10:	74 05                	je     801d17 <ipc_reply_recv+0x9e>
+  801d12:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d15:	75 12                	jne    801d29 <ipc_reply_recv+0xb0>
+  801d17:	83 ec 04             	sub    $0x4,%esp
+  801d1a:	57                   	push   %edi
+  801d1b:	56                   	push   %esi
+  801d1c:	ff 75 18             	push   0x18(%ebp)
+  801d1f:	e8 e3 fd ff ff       	call   801b07 <ipc_recv>
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	eb c0                	jmp    801ce9 <ipc_reply_recv+0x70>
+  801d29:	83 ec 04             	sub    $0x4,%esp
+  801d2c:	50                   	push   %eax
+  801d2d:	ff 75 08             	push   0x8(%ebp)
+  801d30:	68 a0 3c 80 00       	push   $0x803ca0
+  801d35:	e8 d7 e4 ff ff       	call   800211 <cprintf>
+  801d3a:	83 c4 10             	add    $0x10,%esp
+  801d3d:	eb d8                	jmp    801d17 <ipc_reply_recv+0x9e>
+  801d3f:	85 f6                	test   %esi,%esi
+  801d41:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801d46:	0f 45 c6             	cmovne %esi,%eax
+  801d49:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801d4e:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801d55:	e9 43 ff ff ff       	jmp    801c9d <ipc_reply_recv+0x24>
+
+00801d5a <ipc_find_env>:
+  801d5a:	55                   	push   %ebp
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	83 ec 14             	sub    $0x14,%esp
+  801d60:	ff 75 08             	push   0x8(%ebp)
+  801d63:	e8 f9 f1 ff ff       	call   800f61 <sys_env_service>
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6f:	0f 48 c2             	cmovs  %edx,%eax
+  801d72:	c9                   	leave
+  801d73:	c3                   	ret
+
+00801d74 <fd2num>:
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7a:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d7f:	c1 e8 0c             	shr    $0xc,%eax
+  801d82:	5d                   	pop    %ebp
+  801d83:	c3                   	ret
+
+00801d84 <fd2data>:
+  801d84:	55                   	push   %ebp
+  801d85:	89 e5                	mov    %esp,%ebp
+  801d87:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8a:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d8f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d94:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801d99:	5d                   	pop    %ebp
+  801d9a:	c3                   	ret
+
+00801d9b <fd_alloc>:
+  801d9b:	55                   	push   %ebp
+  801d9c:	89 e5                	mov    %esp,%ebp
+  801d9e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801da3:	89 c2                	mov    %eax,%edx
+  801da5:	c1 ea 16             	shr    $0x16,%edx
+  801da8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801daf:	f6 c2 01             	test   $0x1,%dl
+  801db2:	74 29                	je     801ddd <fd_alloc+0x42>
+  801db4:	89 c2                	mov    %eax,%edx
+  801db6:	c1 ea 0c             	shr    $0xc,%edx
+  801db9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dc0:	f6 c2 01             	test   $0x1,%dl
+  801dc3:	74 18                	je     801ddd <fd_alloc+0x42>
+  801dc5:	05 00 10 00 00       	add    $0x1000,%eax
+  801dca:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801dcf:	75 d2                	jne    801da3 <fd_alloc+0x8>
+  801dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801ddb:	eb 05                	jmp    801de2 <fd_alloc+0x47>
+  801ddd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801de2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de5:	89 02                	mov    %eax,(%edx)
+  801de7:	89 c8                	mov    %ecx,%eax
+  801de9:	5d                   	pop    %ebp
+  801dea:	c3                   	ret
+
+00801deb <fd_lookup>:
+  801deb:	55                   	push   %ebp
+  801dec:	89 e5                	mov    %esp,%ebp
+  801dee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df1:	83 f8 1f             	cmp    $0x1f,%eax
+  801df4:	77 30                	ja     801e26 <fd_lookup+0x3b>
+  801df6:	c1 e0 0c             	shl    $0xc,%eax
+  801df9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801dfe:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e04:	f6 c2 01             	test   $0x1,%dl
+  801e07:	74 24                	je     801e2d <fd_lookup+0x42>
+  801e09:	89 c2                	mov    %eax,%edx
+  801e0b:	c1 ea 0c             	shr    $0xc,%edx
+  801e0e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e15:	f6 c2 01             	test   $0x1,%dl
+  801e18:	74 1a                	je     801e34 <fd_lookup+0x49>
+  801e1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e1d:	89 02                	mov    %eax,(%edx)
+  801e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e24:	5d                   	pop    %ebp
+  801e25:	c3                   	ret
+  801e26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e2b:	eb f7                	jmp    801e24 <fd_lookup+0x39>
+  801e2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e32:	eb f0                	jmp    801e24 <fd_lookup+0x39>
+  801e34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e39:	eb e9                	jmp    801e24 <fd_lookup+0x39>
+
+00801e3b <dev_lookup>:
+  801e3b:	55                   	push   %ebp
+  801e3c:	89 e5                	mov    %esp,%ebp
+  801e3e:	53                   	push   %ebx
+  801e3f:	83 ec 04             	sub    $0x4,%esp
+  801e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4a:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801e4f:	39 13                	cmp    %edx,(%ebx)
+  801e51:	74 37                	je     801e8a <dev_lookup+0x4f>
+  801e53:	83 c0 01             	add    $0x1,%eax
+  801e56:	8b 1c 85 68 3d 80 00 	mov    0x803d68(,%eax,4),%ebx
+  801e5d:	85 db                	test   %ebx,%ebx
+  801e5f:	75 ee                	jne    801e4f <dev_lookup+0x14>
+  801e61:	a1 18 50 80 00       	mov    0x805018,%eax
+  801e66:	8b 40 48             	mov    0x48(%eax),%eax
+  801e69:	83 ec 04             	sub    $0x4,%esp
+  801e6c:	52                   	push   %edx
+  801e6d:	50                   	push   %eax
+  801e6e:	68 ec 3c 80 00       	push   $0x803cec
+  801e73:	e8 99 e3 ff ff       	call   800211 <cprintf>
+  801e78:	83 c4 10             	add    $0x10,%esp
+  801e7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e83:	89 1a                	mov    %ebx,(%edx)
+  801e85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e88:	c9                   	leave
+  801e89:	c3                   	ret
+  801e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8f:	eb ef                	jmp    801e80 <dev_lookup+0x45>
+
+00801e91 <fd_close>:
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	57                   	push   %edi
+  801e95:	56                   	push   %esi
+  801e96:	53                   	push   %ebx
+  801e97:	83 ec 24             	sub    $0x24,%esp
+  801e9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e9d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ea0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ea3:	50                   	push   %eax
+  801ea4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801eaa:	c1 e8 0c             	shr    $0xc,%eax
+  801ead:	50                   	push   %eax
+  801eae:	e8 38 ff ff ff       	call   801deb <fd_lookup>
+  801eb3:	89 c3                	mov    %eax,%ebx
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	78 05                	js     801ec1 <fd_close+0x30>
+  801ebc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ebf:	74 0f                	je     801ed0 <fd_close+0x3f>
+  801ec1:	85 ff                	test   %edi,%edi
+  801ec3:	0f 44 df             	cmove  %edi,%ebx
+  801ec6:	89 d8                	mov    %ebx,%eax
+  801ec8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ecb:	5b                   	pop    %ebx
+  801ecc:	5e                   	pop    %esi
+  801ecd:	5f                   	pop    %edi
+  801ece:	5d                   	pop    %ebp
+  801ecf:	c3                   	ret
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ed6:	50                   	push   %eax
+  801ed7:	ff 36                	push   (%esi)
+  801ed9:	e8 5d ff ff ff       	call   801e3b <dev_lookup>
+  801ede:	89 c3                	mov    %eax,%ebx
+  801ee0:	83 c4 10             	add    $0x10,%esp
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	78 1a                	js     801f01 <fd_close+0x70>
+  801ee7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801eea:	8b 40 10             	mov    0x10(%eax),%eax
+  801eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef2:	85 c0                	test   %eax,%eax
+  801ef4:	74 0b                	je     801f01 <fd_close+0x70>
+  801ef6:	83 ec 0c             	sub    $0xc,%esp
+  801ef9:	56                   	push   %esi
+  801efa:	ff d0                	call   *%eax
+  801efc:	89 c3                	mov    %eax,%ebx
+  801efe:	83 c4 10             	add    $0x10,%esp
+  801f01:	83 ec 08             	sub    $0x8,%esp
+  801f04:	56                   	push   %esi
+  801f05:	6a 00                	push   $0x0
+  801f07:	e8 2e ef ff ff       	call   800e3a <sys_page_unmap>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  801f0f:	eb b5                	jmp    801ec6 <fd_close+0x35>
+
+00801f11 <close>:
+  801f11:	55                   	push   %ebp
+  801f12:	89 e5                	mov    %esp,%ebp
+  801f14:	83 ec 20             	sub    $0x20,%esp
+  801f17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1a:	50                   	push   %eax
+  801f1b:	ff 75 08             	push   0x8(%ebp)
+  801f1e:	e8 c8 fe ff ff       	call   801deb <fd_lookup>
+  801f23:	83 c4 10             	add    $0x10,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	79 02                	jns    801f2c <close+0x1b>
+  801f2a:	c9                   	leave
+  801f2b:	c3                   	ret
+  801f2c:	83 ec 08             	sub    $0x8,%esp
+  801f2f:	6a 01                	push   $0x1
+  801f31:	ff 75 f4             	push   -0xc(%ebp)
+  801f34:	e8 58 ff ff ff       	call   801e91 <fd_close>
+  801f39:	83 c4 10             	add    $0x10,%esp
+  801f3c:	eb ec                	jmp    801f2a <close+0x19>
+
+00801f3e <close_all>:
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	53                   	push   %ebx
+  801f42:	83 ec 04             	sub    $0x4,%esp
+  801f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f4a:	83 ec 0c             	sub    $0xc,%esp
+  801f4d:	53                   	push   %ebx
+  801f4e:	e8 be ff ff ff       	call   801f11 <close>
+  801f53:	83 c3 01             	add    $0x1,%ebx
+  801f56:	83 c4 10             	add    $0x10,%esp
+  801f59:	83 fb 20             	cmp    $0x20,%ebx
+  801f5c:	75 ec                	jne    801f4a <close_all+0xc>
+  801f5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+
+00801f63 <dup>:
+  801f63:	55                   	push   %ebp
+  801f64:	89 e5                	mov    %esp,%ebp
+  801f66:	57                   	push   %edi
+  801f67:	56                   	push   %esi
+  801f68:	53                   	push   %ebx
+  801f69:	83 ec 34             	sub    $0x34,%esp
+  801f6c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f6f:	50                   	push   %eax
+  801f70:	ff 75 08             	push   0x8(%ebp)
+  801f73:	e8 73 fe ff ff       	call   801deb <fd_lookup>
+  801f78:	89 c3                	mov    %eax,%ebx
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	78 7f                	js     802000 <dup+0x9d>
+  801f81:	83 ec 0c             	sub    $0xc,%esp
+  801f84:	ff 75 0c             	push   0xc(%ebp)
+  801f87:	e8 85 ff ff ff       	call   801f11 <close>
+  801f8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f8f:	c1 e6 0c             	shl    $0xc,%esi
+  801f92:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801f98:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f9b:	89 3c 24             	mov    %edi,(%esp)
+  801f9e:	e8 e1 fd ff ff       	call   801d84 <fd2data>
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	89 34 24             	mov    %esi,(%esp)
+  801fa8:	e8 d7 fd ff ff       	call   801d84 <fd2data>
+  801fad:	83 c4 10             	add    $0x10,%esp
+  801fb0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801fb3:	89 d8                	mov    %ebx,%eax
+  801fb5:	c1 e8 16             	shr    $0x16,%eax
+  801fb8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fbf:	a8 01                	test   $0x1,%al
+  801fc1:	74 11                	je     801fd4 <dup+0x71>
+  801fc3:	89 d8                	mov    %ebx,%eax
+  801fc5:	c1 e8 0c             	shr    $0xc,%eax
+  801fc8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801fcf:	f6 c2 01             	test   $0x1,%dl
+  801fd2:	75 36                	jne    80200a <dup+0xa7>
+  801fd4:	89 f8                	mov    %edi,%eax
+  801fd6:	c1 e8 0c             	shr    $0xc,%eax
+  801fd9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fe0:	83 ec 0c             	sub    $0xc,%esp
+  801fe3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fe8:	50                   	push   %eax
+  801fe9:	56                   	push   %esi
+  801fea:	6a 00                	push   $0x0
+  801fec:	57                   	push   %edi
+  801fed:	6a 00                	push   $0x0
+  801fef:	e8 b7 ed ff ff       	call   800dab <sys_page_map>
+  801ff4:	89 c3                	mov    %eax,%ebx
+  801ff6:	83 c4 20             	add    $0x20,%esp
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	78 33                	js     802030 <dup+0xcd>
+  801ffd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802000:	89 d8                	mov    %ebx,%eax
+  802002:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802005:	5b                   	pop    %ebx
+  802006:	5e                   	pop    %esi
+  802007:	5f                   	pop    %edi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+  80200a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802011:	83 ec 0c             	sub    $0xc,%esp
+  802014:	25 07 0e 00 00       	and    $0xe07,%eax
+  802019:	50                   	push   %eax
+  80201a:	ff 75 d4             	push   -0x2c(%ebp)
+  80201d:	6a 00                	push   $0x0
+  80201f:	53                   	push   %ebx
+  802020:	6a 00                	push   $0x0
+  802022:	e8 84 ed ff ff       	call   800dab <sys_page_map>
+  802027:	89 c3                	mov    %eax,%ebx
+  802029:	83 c4 20             	add    $0x20,%esp
+  80202c:	85 c0                	test   %eax,%eax
+  80202e:	79 a4                	jns    801fd4 <dup+0x71>
+  802030:	83 ec 08             	sub    $0x8,%esp
+  802033:	56                   	push   %esi
+  802034:	6a 00                	push   $0x0
+  802036:	e8 ff ed ff ff       	call   800e3a <sys_page_unmap>
+  80203b:	83 c4 08             	add    $0x8,%esp
+  80203e:	ff 75 d4             	push   -0x2c(%ebp)
+  802041:	6a 00                	push   $0x0
+  802043:	e8 f2 ed ff ff       	call   800e3a <sys_page_unmap>
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	eb b3                	jmp    802000 <dup+0x9d>
+
+0080204d <read>:
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	56                   	push   %esi
+  802051:	53                   	push   %ebx
+  802052:	83 ec 18             	sub    $0x18,%esp
+  802055:	8b 75 08             	mov    0x8(%ebp),%esi
+  802058:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80205b:	50                   	push   %eax
+  80205c:	56                   	push   %esi
+  80205d:	e8 89 fd ff ff       	call   801deb <fd_lookup>
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 3c                	js     8020a5 <read+0x58>
+  802069:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80206c:	83 ec 08             	sub    $0x8,%esp
+  80206f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802072:	50                   	push   %eax
+  802073:	ff 33                	push   (%ebx)
+  802075:	e8 c1 fd ff ff       	call   801e3b <dev_lookup>
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	85 c0                	test   %eax,%eax
+  80207f:	78 24                	js     8020a5 <read+0x58>
+  802081:	8b 43 08             	mov    0x8(%ebx),%eax
+  802084:	83 e0 03             	and    $0x3,%eax
+  802087:	83 f8 01             	cmp    $0x1,%eax
+  80208a:	74 20                	je     8020ac <read+0x5f>
+  80208c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80208f:	8b 40 08             	mov    0x8(%eax),%eax
+  802092:	85 c0                	test   %eax,%eax
+  802094:	74 37                	je     8020cd <read+0x80>
+  802096:	83 ec 04             	sub    $0x4,%esp
+  802099:	ff 75 10             	push   0x10(%ebp)
+  80209c:	ff 75 0c             	push   0xc(%ebp)
+  80209f:	53                   	push   %ebx
+  8020a0:	ff d0                	call   *%eax
+  8020a2:	83 c4 10             	add    $0x10,%esp
+  8020a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a8:	5b                   	pop    %ebx
+  8020a9:	5e                   	pop    %esi
+  8020aa:	5d                   	pop    %ebp
+  8020ab:	c3                   	ret
+  8020ac:	a1 18 50 80 00       	mov    0x805018,%eax
+  8020b1:	8b 40 48             	mov    0x48(%eax),%eax
+  8020b4:	83 ec 04             	sub    $0x4,%esp
+  8020b7:	56                   	push   %esi
+  8020b8:	50                   	push   %eax
+  8020b9:	68 2d 3d 80 00       	push   $0x803d2d
+  8020be:	e8 4e e1 ff ff       	call   800211 <cprintf>
+  8020c3:	83 c4 10             	add    $0x10,%esp
+  8020c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020cb:	eb d8                	jmp    8020a5 <read+0x58>
+  8020cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020d2:	eb d1                	jmp    8020a5 <read+0x58>
+
+008020d4 <readn>:
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	57                   	push   %edi
+  8020d8:	56                   	push   %esi
+  8020d9:	53                   	push   %ebx
+  8020da:	83 ec 0c             	sub    $0xc,%esp
+  8020dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020e0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020e3:	85 f6                	test   %esi,%esi
+  8020e5:	74 30                	je     802117 <readn+0x43>
+  8020e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f1:	83 ec 04             	sub    $0x4,%esp
+  8020f4:	89 f2                	mov    %esi,%edx
+  8020f6:	29 c2                	sub    %eax,%edx
+  8020f8:	52                   	push   %edx
+  8020f9:	01 f8                	add    %edi,%eax
+  8020fb:	50                   	push   %eax
+  8020fc:	ff 75 08             	push   0x8(%ebp)
+  8020ff:	e8 49 ff ff ff       	call   80204d <read>
+  802104:	83 c4 10             	add    $0x10,%esp
+  802107:	85 c0                	test   %eax,%eax
+  802109:	78 15                	js     802120 <readn+0x4c>
+  80210b:	74 11                	je     80211e <readn+0x4a>
+  80210d:	01 c3                	add    %eax,%ebx
+  80210f:	89 d8                	mov    %ebx,%eax
+  802111:	39 f3                	cmp    %esi,%ebx
+  802113:	72 dc                	jb     8020f1 <readn+0x1d>
+  802115:	eb 09                	jmp    802120 <readn+0x4c>
+  802117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211c:	eb 02                	jmp    802120 <readn+0x4c>
+  80211e:	89 d8                	mov    %ebx,%eax
+  802120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802123:	5b                   	pop    %ebx
+  802124:	5e                   	pop    %esi
+  802125:	5f                   	pop    %edi
+  802126:	5d                   	pop    %ebp
+  802127:	c3                   	ret
+
+00802128 <write>:
+  802128:	55                   	push   %ebp
+  802129:	89 e5                	mov    %esp,%ebp
+  80212b:	56                   	push   %esi
+  80212c:	53                   	push   %ebx
+  80212d:	83 ec 18             	sub    $0x18,%esp
+  802130:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802133:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802136:	50                   	push   %eax
+  802137:	53                   	push   %ebx
+  802138:	e8 ae fc ff ff       	call   801deb <fd_lookup>
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	85 c0                	test   %eax,%eax
+  802142:	78 37                	js     80217b <write+0x53>
+  802144:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802147:	83 ec 08             	sub    $0x8,%esp
+  80214a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80214d:	50                   	push   %eax
+  80214e:	ff 36                	push   (%esi)
+  802150:	e8 e6 fc ff ff       	call   801e3b <dev_lookup>
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	78 1f                	js     80217b <write+0x53>
+  80215c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802160:	74 20                	je     802182 <write+0x5a>
+  802162:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802165:	8b 40 0c             	mov    0xc(%eax),%eax
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	74 37                	je     8021a3 <write+0x7b>
+  80216c:	83 ec 04             	sub    $0x4,%esp
+  80216f:	ff 75 10             	push   0x10(%ebp)
+  802172:	ff 75 0c             	push   0xc(%ebp)
+  802175:	56                   	push   %esi
+  802176:	ff d0                	call   *%eax
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217e:	5b                   	pop    %ebx
+  80217f:	5e                   	pop    %esi
+  802180:	5d                   	pop    %ebp
+  802181:	c3                   	ret
+  802182:	a1 18 50 80 00       	mov    0x805018,%eax
+  802187:	8b 40 48             	mov    0x48(%eax),%eax
+  80218a:	83 ec 04             	sub    $0x4,%esp
+  80218d:	53                   	push   %ebx
+  80218e:	50                   	push   %eax
+  80218f:	68 49 3d 80 00       	push   $0x803d49
+  802194:	e8 78 e0 ff ff       	call   800211 <cprintf>
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021a1:	eb d8                	jmp    80217b <write+0x53>
+  8021a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021a8:	eb d1                	jmp    80217b <write+0x53>
+
+008021aa <seek>:
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	83 ec 20             	sub    $0x20,%esp
+  8021b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b3:	50                   	push   %eax
+  8021b4:	ff 75 08             	push   0x8(%ebp)
+  8021b7:	e8 2f fc ff ff       	call   801deb <fd_lookup>
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	78 0e                	js     8021d1 <seek+0x27>
+  8021c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c9:	89 50 04             	mov    %edx,0x4(%eax)
+  8021cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d1:	c9                   	leave
+  8021d2:	c3                   	ret
+
+008021d3 <ftruncate>:
+  8021d3:	55                   	push   %ebp
+  8021d4:	89 e5                	mov    %esp,%ebp
+  8021d6:	56                   	push   %esi
+  8021d7:	53                   	push   %ebx
+  8021d8:	83 ec 18             	sub    $0x18,%esp
+  8021db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	53                   	push   %ebx
+  8021e3:	e8 03 fc ff ff       	call   801deb <fd_lookup>
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 34                	js     802223 <ftruncate+0x50>
+  8021ef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021f2:	83 ec 08             	sub    $0x8,%esp
+  8021f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f8:	50                   	push   %eax
+  8021f9:	ff 36                	push   (%esi)
+  8021fb:	e8 3b fc ff ff       	call   801e3b <dev_lookup>
+  802200:	83 c4 10             	add    $0x10,%esp
+  802203:	85 c0                	test   %eax,%eax
+  802205:	78 1c                	js     802223 <ftruncate+0x50>
+  802207:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80220b:	74 1d                	je     80222a <ftruncate+0x57>
+  80220d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802210:	8b 40 18             	mov    0x18(%eax),%eax
+  802213:	85 c0                	test   %eax,%eax
+  802215:	74 34                	je     80224b <ftruncate+0x78>
+  802217:	83 ec 08             	sub    $0x8,%esp
+  80221a:	ff 75 0c             	push   0xc(%ebp)
+  80221d:	56                   	push   %esi
+  80221e:	ff d0                	call   *%eax
+  802220:	83 c4 10             	add    $0x10,%esp
+  802223:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802226:	5b                   	pop    %ebx
+  802227:	5e                   	pop    %esi
+  802228:	5d                   	pop    %ebp
+  802229:	c3                   	ret
+  80222a:	a1 18 50 80 00       	mov    0x805018,%eax
+  80222f:	8b 40 48             	mov    0x48(%eax),%eax
+  802232:	83 ec 04             	sub    $0x4,%esp
+  802235:	53                   	push   %ebx
+  802236:	50                   	push   %eax
+  802237:	68 0c 3d 80 00       	push   $0x803d0c
+  80223c:	e8 d0 df ff ff       	call   800211 <cprintf>
+  802241:	83 c4 10             	add    $0x10,%esp
+  802244:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802249:	eb d8                	jmp    802223 <ftruncate+0x50>
+  80224b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802250:	eb d1                	jmp    802223 <ftruncate+0x50>
+
+00802252 <fstat>:
+  802252:	55                   	push   %ebp
+  802253:	89 e5                	mov    %esp,%ebp
+  802255:	56                   	push   %esi
+  802256:	53                   	push   %ebx
+  802257:	83 ec 18             	sub    $0x18,%esp
+  80225a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80225d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802260:	50                   	push   %eax
+  802261:	ff 75 08             	push   0x8(%ebp)
+  802264:	e8 82 fb ff ff       	call   801deb <fd_lookup>
+  802269:	83 c4 10             	add    $0x10,%esp
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	78 49                	js     8022b9 <fstat+0x67>
+  802270:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802273:	83 ec 08             	sub    $0x8,%esp
+  802276:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802279:	50                   	push   %eax
+  80227a:	ff 36                	push   (%esi)
+  80227c:	e8 ba fb ff ff       	call   801e3b <dev_lookup>
+  802281:	83 c4 10             	add    $0x10,%esp
+  802284:	85 c0                	test   %eax,%eax
+  802286:	78 31                	js     8022b9 <fstat+0x67>
+  802288:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80228b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80228f:	74 2f                	je     8022c0 <fstat+0x6e>
+  802291:	c6 03 00             	movb   $0x0,(%ebx)
+  802294:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80229b:	00 00 00 
+  80229e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022a5:	00 00 00 
+  8022a8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8022ae:	83 ec 08             	sub    $0x8,%esp
+  8022b1:	53                   	push   %ebx
+  8022b2:	56                   	push   %esi
+  8022b3:	ff 50 14             	call   *0x14(%eax)
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bc:	5b                   	pop    %ebx
+  8022bd:	5e                   	pop    %esi
+  8022be:	5d                   	pop    %ebp
+  8022bf:	c3                   	ret
+  8022c0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022c5:	eb f2                	jmp    8022b9 <fstat+0x67>
+
+008022c7 <stat>:
+  8022c7:	55                   	push   %ebp
+  8022c8:	89 e5                	mov    %esp,%ebp
+  8022ca:	56                   	push   %esi
+  8022cb:	53                   	push   %ebx
+  8022cc:	83 ec 08             	sub    $0x8,%esp
+  8022cf:	6a 00                	push   $0x0
+  8022d1:	ff 75 08             	push   0x8(%ebp)
+  8022d4:	e8 31 05 00 00       	call   80280a <open>
+  8022d9:	89 c3                	mov    %eax,%ebx
+  8022db:	83 c4 10             	add    $0x10,%esp
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	78 1b                	js     8022fd <stat+0x36>
+  8022e2:	83 ec 08             	sub    $0x8,%esp
+  8022e5:	ff 75 0c             	push   0xc(%ebp)
+  8022e8:	50                   	push   %eax
+  8022e9:	e8 64 ff ff ff       	call   802252 <fstat>
+  8022ee:	89 c6                	mov    %eax,%esi
+  8022f0:	89 1c 24             	mov    %ebx,(%esp)
+  8022f3:	e8 19 fc ff ff       	call   801f11 <close>
+  8022f8:	83 c4 10             	add    $0x10,%esp
+  8022fb:	89 f3                	mov    %esi,%ebx
+  8022fd:	89 d8                	mov    %ebx,%eax
+  8022ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802302:	5b                   	pop    %ebx
+  802303:	5e                   	pop    %esi
+  802304:	5d                   	pop    %ebp
+  802305:	c3                   	ret
+
+00802306 <fsipc>:
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	56                   	push   %esi
+  80230a:	53                   	push   %ebx
+  80230b:	89 c3                	mov    %eax,%ebx
+  80230d:	89 d6                	mov    %edx,%esi
+  80230f:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802316:	74 20                	je     802338 <fsipc+0x32>
+  802318:	83 ec 08             	sub    $0x8,%esp
+  80231b:	6a 00                	push   $0x0
+  80231d:	56                   	push   %esi
+  80231e:	6a 07                	push   $0x7
+  802320:	68 00 60 80 00       	push   $0x806000
+  802325:	53                   	push   %ebx
+  802326:	ff 35 0c 50 80 00    	push   0x80500c
+  80232c:	e8 8e f8 ff ff       	call   801bbf <ipc_call>
+  802331:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802334:	5b                   	pop    %ebx
+  802335:	5e                   	pop    %esi
+  802336:	5d                   	pop    %ebp
+  802337:	c3                   	ret
+  802338:	83 ec 0c             	sub    $0xc,%esp
+  80233b:	6a 02                	push   $0x2
+  80233d:	e8 18 fa ff ff       	call   801d5a <ipc_find_env>
+  802342:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802347:	83 c4 10             	add    $0x10,%esp
+  80234a:	eb cc                	jmp    802318 <fsipc+0x12>
+
+0080234c <devfile_trunc>:
+  80234c:	55                   	push   %ebp
+  80234d:	89 e5                	mov    %esp,%ebp
+  80234f:	83 ec 08             	sub    $0x8,%esp
+  802352:	8b 45 08             	mov    0x8(%ebp),%eax
+  802355:	8b 40 0c             	mov    0xc(%eax),%eax
+  802358:	a3 00 60 80 00       	mov    %eax,0x806000
+  80235d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802360:	a3 04 60 80 00       	mov    %eax,0x806004
+  802365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80236f:	e8 92 ff ff ff       	call   802306 <fsipc>
+  802374:	c9                   	leave
+  802375:	c3                   	ret
+
+00802376 <devfile_flush>:
+  802376:	55                   	push   %ebp
+  802377:	89 e5                	mov    %esp,%ebp
+  802379:	83 ec 08             	sub    $0x8,%esp
+  80237c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802382:	a3 00 60 80 00       	mov    %eax,0x806000
+  802387:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802391:	e8 70 ff ff ff       	call   802306 <fsipc>
+  802396:	c9                   	leave
+  802397:	c3                   	ret
+
+00802398 <devfile_stat>:
+  802398:	55                   	push   %ebp
+  802399:	89 e5                	mov    %esp,%ebp
+  80239b:	53                   	push   %ebx
+  80239c:	83 ec 04             	sub    $0x4,%esp
+  80239f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023a8:	a3 00 60 80 00       	mov    %eax,0x806000
+  8023ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023b7:	e8 4a ff ff ff       	call   802306 <fsipc>
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	78 2c                	js     8023ec <devfile_stat+0x54>
+  8023c0:	83 ec 08             	sub    $0x8,%esp
+  8023c3:	68 00 60 80 00       	push   $0x806000
+  8023c8:	53                   	push   %ebx
+  8023c9:	e8 3a e5 ff ff       	call   800908 <strcpy>
+  8023ce:	a1 80 60 80 00       	mov    0x806080,%eax
+  8023d3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8023d9:	a1 84 60 80 00       	mov    0x806084,%eax
+  8023de:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8023e4:	83 c4 10             	add    $0x10,%esp
+  8023e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ef:	c9                   	leave
+  8023f0:	c3                   	ret
+
+008023f1 <fsring_rw>:
+  8023f1:	55                   	push   %ebp
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	57                   	push   %edi
+  8023f5:	56                   	push   %esi
+  8023f6:	53                   	push   %ebx
+  8023f7:	83 ec 2c             	sub    $0x2c,%esp
+  8023fa:	89 c7                	mov    %eax,%edi
+  8023fc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8023ff:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802402:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802407:	a8 01                	test   $0x1,%al
+  802409:	74 0d                	je     802418 <fsring_rw+0x27>
+  80240b:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802410:	a8 01                	test   $0x1,%al
+  802412:	0f 85 d5 00 00 00    	jne    8024ed <fsring_rw+0xfc>
+  802418:	a1 18 50 80 00       	mov    0x805018,%eax
+  80241d:	8b 40 48             	mov    0x48(%eax),%eax
+  802420:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  802426:	0f 84 fc 00 00 00    	je     802528 <fsring_rw+0x137>
+  80242c:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802433:	0f 84 02 01 00 00    	je     80253b <fsring_rw+0x14a>
+  802439:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80243e:	83 ec 04             	sub    $0x4,%esp
+  802441:	68 07 02 00 00       	push   $0x207
+  802446:	53                   	push   %ebx
+  802447:	6a 00                	push   $0x0
+  802449:	e8 1a e9 ff ff       	call   800d68 <sys_page_alloc>
+  80244e:	83 c4 10             	add    $0x10,%esp
+  802451:	85 c0                	test   %eax,%eax
+  802453:	0f 88 f9 00 00 00    	js     802552 <fsring_rw+0x161>
+  802459:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80245f:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802465:	75 d7                	jne    80243e <fsring_rw+0x4d>
+  802467:	6a 0e                	push   $0xe
+  802469:	6a 0d                	push   $0xd
+  80246b:	ff 35 0c 50 80 00    	push   0x80500c
+  802471:	68 00 00 f0 cf       	push   $0xcff00000
+  802476:	e8 c4 0c 00 00       	call   80313f <ipcring_init>
+  80247b:	83 c4 08             	add    $0x8,%esp
+  80247e:	6a 00                	push   $0x0
+  802480:	6a 00                	push   $0x0
+  802482:	68 07 02 00 00       	push   $0x207
+  802487:	68 00 00 f0 cf       	push   $0xcff00000
+  80248c:	6a 0b                	push   $0xb
+  80248e:	ff 35 0c 50 80 00    	push   0x80500c
+  802494:	e8 26 f7 ff ff       	call   801bbf <ipc_call>
+  802499:	89 c6                	mov    %eax,%esi
+  80249b:	83 c4 20             	add    $0x20,%esp
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	0f 88 ac 00 00 00    	js     802552 <fsring_rw+0x161>
+  8024a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024ab:	89 d9                	mov    %ebx,%ecx
+  8024ad:	83 c3 01             	add    $0x1,%ebx
+  8024b0:	89 da                	mov    %ebx,%edx
+  8024b2:	c1 e2 0c             	shl    $0xc,%edx
+  8024b5:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8024bb:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8024c1:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8024c7:	83 ec 08             	sub    $0x8,%esp
+  8024ca:	6a 00                	push   $0x0
+  8024cc:	6a 00                	push   $0x0
+  8024ce:	68 07 02 00 00       	push   $0x207
+  8024d3:	50                   	push   %eax
+  8024d4:	6a 0c                	push   $0xc
+  8024d6:	ff 35 0c 50 80 00    	push   0x80500c
+  8024dc:	e8 de f6 ff ff       	call   801bbf <ipc_call>
+  8024e1:	83 c4 20             	add    $0x20,%esp
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	78 6a                	js     802552 <fsring_rw+0x161>
+  8024e8:	83 fb 08             	cmp    $0x8,%ebx
+  8024eb:	75 be                	jne    8024ab <fsring_rw+0xba>
+  8024ed:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8024f1:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8024f6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024fb:	0f 45 c2             	cmovne %edx,%eax
+  8024fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802501:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802508:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  80250f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251b:	be 00 00 00 00       	mov    $0x0,%esi
+  802520:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802523:	e9 4b 01 00 00       	jmp    802673 <fsring_rw+0x282>
+  802528:	e8 05 ec ff ff       	call   801132 <sys_time_msec>
+  80252d:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  802533:	0f 89 f3 fe ff ff    	jns    80242c <fsring_rw+0x3b>
+  802539:	eb 54                	jmp    80258f <fsring_rw+0x19e>
+  80253b:	83 ec 0c             	sub    $0xc,%esp
+  80253e:	6a 02                	push   $0x2
+  802540:	e8 15 f8 ff ff       	call   801d5a <ipc_find_env>
+  802545:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80254a:	83 c4 10             	add    $0x10,%esp
+  80254d:	e9 e7 fe ff ff       	jmp    802439 <fsring_rw+0x48>
+  802552:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802557:	83 ec 08             	sub    $0x8,%esp
+  80255a:	53                   	push   %ebx
+  80255b:	6a 00                	push   $0x0
+  80255d:	e8 d8 e8 ff ff       	call   800e3a <sys_page_unmap>
+  802562:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802571:	75 e4                	jne    802557 <fsring_rw+0x166>
+  802573:	e8 ba eb ff ff       	call   801132 <sys_time_msec>
+  802578:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80257d:	a3 04 50 80 00       	mov    %eax,0x805004
+  802582:	a1 18 50 80 00       	mov    0x805018,%eax
+  802587:	8b 40 48             	mov    0x48(%eax),%eax
+  80258a:	a3 08 50 80 00       	mov    %eax,0x805008
+  80258f:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802596:	e9 7a 01 00 00       	jmp    802715 <fsring_rw+0x324>
+  80259b:	8b 57 0c             	mov    0xc(%edi),%edx
+  80259e:	89 10                	mov    %edx,(%eax)
+  8025a0:	89 58 04             	mov    %ebx,0x4(%eax)
+  8025a3:	89 f2                	mov    %esi,%edx
+  8025a5:	03 57 04             	add    0x4(%edi),%edx
+  8025a8:	89 50 08             	mov    %edx,0x8(%eax)
+  8025ab:	83 ec 04             	sub    $0x4,%esp
+  8025ae:	53                   	push   %ebx
+  8025af:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8025b2:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8025b5:	52                   	push   %edx
+  8025b6:	83 c0 0c             	add    $0xc,%eax
+  8025b9:	50                   	push   %eax
+  8025ba:	e8 f9 e4 ff ff       	call   800ab8 <memmove>
+  8025bf:	83 c4 10             	add    $0x10,%esp
+  8025c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025c5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025c8:	89 08                	mov    %ecx,(%eax)
+  8025ca:	83 ec 0c             	sub    $0xc,%esp
+  8025cd:	68 00 00 f0 cf       	push   $0xcff00000
+  8025d2:	e8 c6 0b 00 00       	call   80319d <ipcring_req_push>
+  8025d7:	01 de                	add    %ebx,%esi
+  8025d9:	83 c4 10             	add    $0x10,%esp
+  8025dc:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8025df:	73 4c                	jae    80262d <fsring_rw+0x23c>
+  8025e1:	83 ec 0c             	sub    $0xc,%esp
+  8025e4:	68 00 00 f0 cf       	push   $0xcff00000
+  8025e9:	e8 89 0b 00 00       	call   803177 <ipcring_req_slot>
+  8025ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025f1:	83 c4 10             	add    $0x10,%esp
+  8025f4:	85 c0                	test   %eax,%eax
+  8025f6:	74 35                	je     80262d <fsring_rw+0x23c>
+  8025f8:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8025fd:	83 e0 07             	and    $0x7,%eax
+  802600:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802605:	c1 e0 0c             	shl    $0xc,%eax
+  802608:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80260b:	29 f3                	sub    %esi,%ebx
+  80260d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802610:	39 cb                	cmp    %ecx,%ebx
+  802612:	0f 47 d9             	cmova  %ecx,%ebx
+  802615:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802619:	75 80                	jne    80259b <fsring_rw+0x1aa>
+  80261b:	8b 57 0c             	mov    0xc(%edi),%edx
+  80261e:	89 10                	mov    %edx,(%eax)
+  802620:	89 58 04             	mov    %ebx,0x4(%eax)
+  802623:	89 f2                	mov    %esi,%edx
+  802625:	03 57 04             	add    0x4(%edi),%edx
+  802628:	89 50 08             	mov    %edx,0x8(%eax)
+  80262b:	eb 95                	jmp    8025c2 <fsring_rw+0x1d1>
+  80262d:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802632:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802635:	83 ec 0c             	sub    $0xc,%esp
+  802638:	68 00 00 f0 cf       	push   $0xcff00000
+  80263d:	e8 94 0b 00 00       	call   8031d6 <ipcring_rsp_wait>
+  802642:	8b 58 04             	mov    0x4(%eax),%ebx
+  802645:	83 c4 10             	add    $0x10,%esp
+  802648:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80264c:	75 45                	jne    802693 <fsring_rw+0x2a2>
+  80264e:	85 db                	test   %ebx,%ebx
+  802650:	79 41                	jns    802693 <fsring_rw+0x2a2>
+  802652:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802655:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80265c:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802663:	83 ec 0c             	sub    $0xc,%esp
+  802666:	68 00 00 f0 cf       	push   $0xcff00000
+  80266b:	e8 cc 0b 00 00       	call   80323c <ipcring_rsp_pop>
+  802670:	83 c4 10             	add    $0x10,%esp
+  802673:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802679:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80267e:	39 c2                	cmp    %eax,%edx
+  802680:	74 75                	je     8026f7 <fsring_rw+0x306>
+  802682:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802686:	75 a5                	jne    80262d <fsring_rw+0x23c>
+  802688:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80268b:	0f 82 50 ff ff ff    	jb     8025e1 <fsring_rw+0x1f0>
+  802691:	eb 9a                	jmp    80262d <fsring_rw+0x23c>
+  802693:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802697:	75 ca                	jne    802663 <fsring_rw+0x272>
+  802699:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80269d:	74 31                	je     8026d0 <fsring_rw+0x2df>
+  80269f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a2:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8026a5:	29 c8                	sub    %ecx,%eax
+  8026a7:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8026aa:	39 d0                	cmp    %edx,%eax
+  8026ac:	0f 47 c2             	cmova  %edx,%eax
+  8026af:	39 d8                	cmp    %ebx,%eax
+  8026b1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8026b6:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8026ba:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8026bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026c2:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8026c6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8026c9:	01 d9                	add    %ebx,%ecx
+  8026cb:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8026ce:	eb 93                	jmp    802663 <fsring_rw+0x272>
+  8026d0:	83 ec 04             	sub    $0x4,%esp
+  8026d3:	53                   	push   %ebx
+  8026d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026d7:	83 e0 07             	and    $0x7,%eax
+  8026da:	c1 e0 0c             	shl    $0xc,%eax
+  8026dd:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8026e3:	50                   	push   %eax
+  8026e4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026e7:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8026ea:	01 c8                	add    %ecx,%eax
+  8026ec:	50                   	push   %eax
+  8026ed:	e8 c6 e3 ff ff       	call   800ab8 <memmove>
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	eb a8                	jmp    80269f <fsring_rw+0x2ae>
+  8026f7:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8026fb:	75 09                	jne    802706 <fsring_rw+0x315>
+  8026fd:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802700:	0f 82 db fe ff ff    	jb     8025e1 <fsring_rw+0x1f0>
+  802706:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802709:	01 57 04             	add    %edx,0x4(%edi)
+  80270c:	85 d2                	test   %edx,%edx
+  80270e:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802712:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802715:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802718:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80271b:	5b                   	pop    %ebx
+  80271c:	5e                   	pop    %esi
+  80271d:	5f                   	pop    %edi
+  80271e:	5d                   	pop    %ebp
+  80271f:	c3                   	ret
+
+00802720 <devfile_write>:
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	57                   	push   %edi
+  802724:	56                   	push   %esi
+  802725:	53                   	push   %ebx
+  802726:	83 ec 0c             	sub    $0xc,%esp
+  802729:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80272c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80272f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802732:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802738:	76 1a                	jbe    802754 <devfile_write+0x34>
+  80273a:	83 ec 0c             	sub    $0xc,%esp
+  80273d:	53                   	push   %ebx
+  80273e:	89 f1                	mov    %esi,%ecx
+  802740:	ba 06 00 00 00       	mov    $0x6,%edx
+  802745:	89 f8                	mov    %edi,%eax
+  802747:	e8 a5 fc ff ff       	call   8023f1 <fsring_rw>
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802752:	75 39                	jne    80278d <devfile_write+0x6d>
+  802754:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802759:	39 c3                	cmp    %eax,%ebx
+  80275b:	0f 47 d8             	cmova  %eax,%ebx
+  80275e:	8b 47 0c             	mov    0xc(%edi),%eax
+  802761:	a3 00 60 80 00       	mov    %eax,0x806000
+  802766:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80276c:	83 ec 04             	sub    $0x4,%esp
+  80276f:	53                   	push   %ebx
+  802770:	56                   	push   %esi
+  802771:	68 08 60 80 00       	push   $0x806008
+  802776:	e8 3d e3 ff ff       	call   800ab8 <memmove>
+  80277b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802780:	b8 04 00 00 00       	mov    $0x4,%eax
+  802785:	e8 7c fb ff ff       	call   802306 <fsipc>
+  80278a:	83 c4 10             	add    $0x10,%esp
+  80278d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802790:	5b                   	pop    %ebx
+  802791:	5e                   	pop    %esi
+  802792:	5f                   	pop    %edi
+  802793:	5d                   	pop    %ebp
+  802794:	c3                   	ret
+
+00802795 <devfile_read>:
+  802795:	55                   	push   %ebp
+  802796:	89 e5                	mov    %esp,%ebp
+  802798:	57                   	push   %edi
+  802799:	56                   	push   %esi
+  80279a:	53                   	push   %ebx
+  80279b:	83 ec 0c             	sub    $0xc,%esp
+  80279e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027a1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8027a4:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8027aa:	76 1d                	jbe    8027c9 <devfile_read+0x34>
+  8027ac:	83 ec 0c             	sub    $0xc,%esp
+  8027af:	56                   	push   %esi
+  8027b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027b3:	ba 05 00 00 00       	mov    $0x5,%edx
+  8027b8:	89 f8                	mov    %edi,%eax
+  8027ba:	e8 32 fc ff ff       	call   8023f1 <fsring_rw>
+  8027bf:	89 c3                	mov    %eax,%ebx
+  8027c1:	83 c4 10             	add    $0x10,%esp
+  8027c4:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8027c7:	75 37                	jne    802800 <devfile_read+0x6b>
+  8027c9:	8b 47 0c             	mov    0xc(%edi),%eax
+  8027cc:	a3 00 60 80 00       	mov    %eax,0x806000
+  8027d1:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8027d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027dc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027e1:	e8 20 fb ff ff       	call   802306 <fsipc>
+  8027e6:	89 c3                	mov    %eax,%ebx
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	78 14                	js     802800 <devfile_read+0x6b>
+  8027ec:	83 ec 04             	sub    $0x4,%esp
+  8027ef:	50                   	push   %eax
+  8027f0:	68 00 60 80 00       	push   $0x806000
+  8027f5:	ff 75 0c             	push   0xc(%ebp)
+  8027f8:	e8 bb e2 ff ff       	call   800ab8 <memmove>
+  8027fd:	83 c4 10             	add    $0x10,%esp
+  802800:	89 d8                	mov    %ebx,%eax
+  802802:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802805:	5b                   	pop    %ebx
+  802806:	5e                   	pop    %esi
+  802807:	5f                   	pop    %edi
+  802808:	5d                   	pop    %ebp
+  802809:	c3                   	ret
+
+0080280a <open>:
+  80280a:	55                   	push   %ebp
+  80280b:	89 e5                	mov    %esp,%ebp
+  80280d:	56                   	push   %esi
+  80280e:	53                   	push   %ebx
+  80280f:	83 ec 1c             	sub    $0x1c,%esp
+  802812:	8b 75 08             	mov    0x8(%ebp),%esi
+  802815:	56                   	push   %esi
+  802816:	e8 a1 e0 ff ff       	call   8008bc <strlen>
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802823:	7f 6c                	jg     802891 <open+0x87>
+  802825:	83 ec 0c             	sub    $0xc,%esp
+  802828:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80282b:	50                   	push   %eax
+  80282c:	e8 6a f5 ff ff       	call   801d9b <fd_alloc>
+  802831:	89 c3                	mov    %eax,%ebx
+  802833:	83 c4 10             	add    $0x10,%esp
+  802836:	85 c0                	test   %eax,%eax
+  802838:	78 3c                	js     802876 <open+0x6c>
+  80283a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80283d:	a3 00 64 80 00       	mov    %eax,0x806400
+  802842:	83 ec 08             	sub    $0x8,%esp
+  802845:	56                   	push   %esi
+  802846:	68 00 60 80 00       	push   $0x806000
+  80284b:	e8 b8 e0 ff ff       	call   800908 <strcpy>
+  802850:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802853:	b8 01 00 00 00       	mov    $0x1,%eax
+  802858:	e8 a9 fa ff ff       	call   802306 <fsipc>
+  80285d:	89 c3                	mov    %eax,%ebx
+  80285f:	83 c4 10             	add    $0x10,%esp
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 19                	js     80287f <open+0x75>
+  802866:	83 ec 0c             	sub    $0xc,%esp
+  802869:	ff 75 f4             	push   -0xc(%ebp)
+  80286c:	e8 03 f5 ff ff       	call   801d74 <fd2num>
+  802871:	89 c3                	mov    %eax,%ebx
+  802873:	83 c4 10             	add    $0x10,%esp
+  802876:	89 d8                	mov    %ebx,%eax
+  802878:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80287b:	5b                   	pop    %ebx
+  80287c:	5e                   	pop    %esi
+  80287d:	5d                   	pop    %ebp
+  80287e:	c3                   	ret
+  80287f:	83 ec 08             	sub    $0x8,%esp
+  802882:	6a 00                	push   $0x0
+  802884:	ff 75 f4             	push   -0xc(%ebp)
+  802887:	e8 05 f6 ff ff       	call   801e91 <fd_close>
+  80288c:	83 c4 10             	add    $0x10,%esp
+  80288f:	eb e5                	jmp    802876 <open+0x6c>
+  802891:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802896:	eb de                	jmp    802876 <open+0x6c>
+
+00802898 <file_image>:
+  802898:	55                   	push   %ebp
+  802899:	89 e5                	mov    %esp,%ebp
+  80289b:	53                   	push   %ebx
+  80289c:	83 ec 1c             	sub    $0x1c,%esp
+  80289f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028a5:	50                   	push   %eax
+  8028a6:	ff 75 08             	push   0x8(%ebp)
+  8028a9:	e8 3d f5 ff ff       	call   801deb <fd_lookup>
+  8028ae:	83 c4 10             	add    $0x10,%esp
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	78 58                	js     80290d <file_image+0x75>
+  8028b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8028be:	39 08                	cmp    %ecx,(%eax)
+  8028c0:	75 50                	jne    802912 <file_image+0x7a>
+  8028c2:	83 fb 04             	cmp    $0x4,%ebx
+  8028c5:	77 52                	ja     802919 <file_image+0x81>
+  8028c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028ca:	a3 00 60 80 00       	mov    %eax,0x806000
+  8028cf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8028d5:	83 ec 04             	sub    $0x4,%esp
+  8028d8:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8028db:	c1 e0 02             	shl    $0x2,%eax
+  8028de:	50                   	push   %eax
+  8028df:	ff 75 0c             	push   0xc(%ebp)
+  8028e2:	68 08 60 80 00       	push   $0x806008
+  8028e7:	e8 cc e1 ff ff       	call   800ab8 <memmove>
+  8028ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028f6:	e8 0b fa ff ff       	call   802306 <fsipc>
+  8028fb:	83 c4 10             	add    $0x10,%esp
+  8028fe:	85 c0                	test   %eax,%eax
+  802900:	78 0b                	js     80290d <file_image+0x75>
+  802902:	8b 55 14             	mov    0x14(%ebp),%edx
+  802905:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  80290b:	89 0a                	mov    %ecx,(%edx)
+  80290d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+  802912:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802917:	eb f4                	jmp    80290d <file_image+0x75>
+  802919:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80291e:	eb ed                	jmp    80290d <file_image+0x75>
+
+00802920 <remove>:
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	53                   	push   %ebx
+  802924:	83 ec 10             	sub    $0x10,%esp
+  802927:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80292a:	53                   	push   %ebx
+  80292b:	e8 8c df ff ff       	call   8008bc <strlen>
+  802930:	83 c4 10             	add    $0x10,%esp
+  802933:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802938:	7f 25                	jg     80295f <remove+0x3f>
+  80293a:	83 ec 08             	sub    $0x8,%esp
+  80293d:	53                   	push   %ebx
+  80293e:	68 00 60 80 00       	push   $0x806000
+  802943:	e8 c0 df ff ff       	call   800908 <strcpy>
+  802948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802952:	e8 af f9 ff ff       	call   802306 <fsipc>
+  802957:	83 c4 10             	add    $0x10,%esp
+  80295a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80295d:	c9                   	leave
+  80295e:	c3                   	ret
+  80295f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802964:	eb f4                	jmp    80295a <remove+0x3a>
+
+00802966 <sync>:
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	83 ec 08             	sub    $0x8,%esp
+  80296c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802971:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802976:	e8 8b f9 ff ff       	call   802306 <fsipc>
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+0080297d <devsock_stat>:
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 10             	sub    $0x10,%esp
+  802983:	68 7c 3d 80 00       	push   $0x803d7c
+  802988:	ff 75 0c             	push   0xc(%ebp)
+  80298b:	e8 78 df ff ff       	call   800908 <strcpy>
+  802990:	b8 00 00 00 00       	mov    $0x0,%eax
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+
+00802997 <devsock_close>:
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	53                   	push   %ebx
+  80299b:	83 ec 10             	sub    $0x10,%esp
+  80299e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029a1:	53                   	push   %ebx
+  8029a2:	e8 15 0c 00 00       	call   8035bc <pageref>
+  8029a7:	89 c2                	mov    %eax,%edx
+  8029a9:	83 c4 10             	add    $0x10,%esp
+  8029ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b1:	83 fa 01             	cmp    $0x1,%edx
+  8029b4:	74 05                	je     8029bb <devsock_close+0x24>
+  8029b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+  8029bb:	83 ec 0c             	sub    $0xc,%esp
+  8029be:	ff 73 0c             	push   0xc(%ebx)
+  8029c1:	e8 aa 02 00 00       	call   802c70 <nsipc_close>
+  8029c6:	83 c4 10             	add    $0x10,%esp
+  8029c9:	eb eb                	jmp    8029b6 <devsock_close+0x1f>
+
+008029cb <devsock_write>:
+  8029cb:	55                   	push   %ebp
+  8029cc:	89 e5                	mov    %esp,%ebp
+  8029ce:	83 ec 08             	sub    $0x8,%esp
+  8029d1:	6a 00                	push   $0x0
+  8029d3:	ff 75 10             	push   0x10(%ebp)
+  8029d6:	ff 75 0c             	push   0xc(%ebp)
+  8029d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029dc:	ff 70 0c             	push   0xc(%eax)
+  8029df:	e8 6c 03 00 00       	call   802d50 <nsipc_send>
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+008029e6 <devsock_read>:
+  8029e6:	55                   	push   %ebp
+  8029e7:	89 e5                	mov    %esp,%ebp
+  8029e9:	83 ec 08             	sub    $0x8,%esp
+  8029ec:	6a 00                	push   $0x0
+  8029ee:	ff 75 10             	push   0x10(%ebp)
+  8029f1:	ff 75 0c             	push   0xc(%ebp)
+  8029f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f7:	ff 70 0c             	push   0xc(%eax)
+  8029fa:	e8 e2 02 00 00       	call   802ce1 <nsipc_recv>
+  8029ff:	c9                   	leave
+  802a00:	c3                   	ret
+
+00802a01 <fd2sockid>:
+  802a01:	55                   	push   %ebp
+  802a02:	89 e5                	mov    %esp,%ebp
+  802a04:	83 ec 20             	sub    $0x20,%esp
+  802a07:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a0a:	52                   	push   %edx
+  802a0b:	50                   	push   %eax
+  802a0c:	e8 da f3 ff ff       	call   801deb <fd_lookup>
+  802a11:	83 c4 10             	add    $0x10,%esp
+  802a14:	85 c0                	test   %eax,%eax
+  802a16:	78 10                	js     802a28 <fd2sockid+0x27>
+  802a18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a1b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a21:	39 08                	cmp    %ecx,(%eax)
+  802a23:	75 05                	jne    802a2a <fd2sockid+0x29>
+  802a25:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a28:	c9                   	leave
+  802a29:	c3                   	ret
+  802a2a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a2f:	eb f7                	jmp    802a28 <fd2sockid+0x27>
+
+00802a31 <alloc_sockfd>:
+  802a31:	55                   	push   %ebp
+  802a32:	89 e5                	mov    %esp,%ebp
+  802a34:	56                   	push   %esi
+  802a35:	53                   	push   %ebx
+  802a36:	83 ec 1c             	sub    $0x1c,%esp
+  802a39:	89 c6                	mov    %eax,%esi
+  802a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a3e:	50                   	push   %eax
+  802a3f:	e8 57 f3 ff ff       	call   801d9b <fd_alloc>
+  802a44:	89 c3                	mov    %eax,%ebx
+  802a46:	83 c4 10             	add    $0x10,%esp
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	78 43                	js     802a90 <alloc_sockfd+0x5f>
+  802a4d:	83 ec 04             	sub    $0x4,%esp
+  802a50:	68 07 04 00 00       	push   $0x407
+  802a55:	ff 75 f4             	push   -0xc(%ebp)
+  802a58:	6a 00                	push   $0x0
+  802a5a:	e8 09 e3 ff ff       	call   800d68 <sys_page_alloc>
+  802a5f:	89 c3                	mov    %eax,%ebx
+  802a61:	83 c4 10             	add    $0x10,%esp
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	78 28                	js     802a90 <alloc_sockfd+0x5f>
+  802a68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a6b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a71:	89 10                	mov    %edx,(%eax)
+  802a73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a76:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802a7d:	89 70 0c             	mov    %esi,0xc(%eax)
+  802a80:	83 ec 0c             	sub    $0xc,%esp
+  802a83:	50                   	push   %eax
+  802a84:	e8 eb f2 ff ff       	call   801d74 <fd2num>
+  802a89:	89 c3                	mov    %eax,%ebx
+  802a8b:	83 c4 10             	add    $0x10,%esp
+  802a8e:	eb 0c                	jmp    802a9c <alloc_sockfd+0x6b>
+  802a90:	83 ec 0c             	sub    $0xc,%esp
+  802a93:	56                   	push   %esi
+  802a94:	e8 d7 01 00 00       	call   802c70 <nsipc_close>
+  802a99:	83 c4 10             	add    $0x10,%esp
+  802a9c:	89 d8                	mov    %ebx,%eax
+  802a9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aa1:	5b                   	pop    %ebx
+  802aa2:	5e                   	pop    %esi
+  802aa3:	5d                   	pop    %ebp
+  802aa4:	c3                   	ret
+
+00802aa5 <accept>:
+  802aa5:	55                   	push   %ebp
+  802aa6:	89 e5                	mov    %esp,%ebp
+  802aa8:	83 ec 08             	sub    $0x8,%esp
+  802aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aae:	e8 4e ff ff ff       	call   802a01 <fd2sockid>
+  802ab3:	85 c0                	test   %eax,%eax
+  802ab5:	78 1b                	js     802ad2 <accept+0x2d>
+  802ab7:	83 ec 04             	sub    $0x4,%esp
+  802aba:	ff 75 10             	push   0x10(%ebp)
+  802abd:	ff 75 0c             	push   0xc(%ebp)
+  802ac0:	50                   	push   %eax
+  802ac1:	e8 07 01 00 00       	call   802bcd <nsipc_accept>
+  802ac6:	83 c4 10             	add    $0x10,%esp
+  802ac9:	85 c0                	test   %eax,%eax
+  802acb:	78 05                	js     802ad2 <accept+0x2d>
+  802acd:	e8 5f ff ff ff       	call   802a31 <alloc_sockfd>
+  802ad2:	c9                   	leave
+  802ad3:	c3                   	ret
+
+00802ad4 <bind>:
+  802ad4:	55                   	push   %ebp
+  802ad5:	89 e5                	mov    %esp,%ebp
+  802ad7:	83 ec 08             	sub    $0x8,%esp
+  802ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  802add:	e8 1f ff ff ff       	call   802a01 <fd2sockid>
+  802ae2:	85 c0                	test   %eax,%eax
+  802ae4:	78 12                	js     802af8 <bind+0x24>
+  802ae6:	83 ec 04             	sub    $0x4,%esp
+  802ae9:	ff 75 10             	push   0x10(%ebp)
+  802aec:	ff 75 0c             	push   0xc(%ebp)
+  802aef:	50                   	push   %eax
+  802af0:	e8 24 01 00 00       	call   802c19 <nsipc_bind>
+  802af5:	83 c4 10             	add    $0x10,%esp
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <shutdown>:
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	83 ec 08             	sub    $0x8,%esp
+  802b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b03:	e8 f9 fe ff ff       	call   802a01 <fd2sockid>
+  802b08:	85 c0                	test   %eax,%eax
+  802b0a:	78 0f                	js     802b1b <shutdown+0x21>
+  802b0c:	83 ec 08             	sub    $0x8,%esp
+  802b0f:	ff 75 0c             	push   0xc(%ebp)
+  802b12:	50                   	push   %eax
+  802b13:	e8 36 01 00 00       	call   802c4e <nsipc_shutdown>
+  802b18:	83 c4 10             	add    $0x10,%esp
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <connect>:
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	83 ec 08             	sub    $0x8,%esp
+  802b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b26:	e8 d6 fe ff ff       	call   802a01 <fd2sockid>
+  802b2b:	85 c0                	test   %eax,%eax
+  802b2d:	78 12                	js     802b41 <connect+0x24>
+  802b2f:	83 ec 04             	sub    $0x4,%esp
+  802b32:	ff 75 10             	push   0x10(%ebp)
+  802b35:	ff 75 0c             	push   0xc(%ebp)
+  802b38:	50                   	push   %eax
+  802b39:	e8 4c 01 00 00       	call   802c8a <nsipc_connect>
+  802b3e:	83 c4 10             	add    $0x10,%esp
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+
+00802b43 <listen>:
+  802b43:	55                   	push   %ebp
+  802b44:	89 e5                	mov    %esp,%ebp
+  802b46:	83 ec 08             	sub    $0x8,%esp
+  802b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4c:	e8 b0 fe ff ff       	call   802a01 <fd2sockid>
+  802b51:	85 c0                	test   %eax,%eax
+  802b53:	78 0f                	js     802b64 <listen+0x21>
+  802b55:	83 ec 08             	sub    $0x8,%esp
+  802b58:	ff 75 0c             	push   0xc(%ebp)
+  802b5b:	50                   	push   %eax
+  802b5c:	e8 5e 01 00 00       	call   802cbf <nsipc_listen>
+  802b61:	83 c4 10             	add    $0x10,%esp
+  802b64:	c9                   	leave
+  802b65:	c3                   	ret
+
+00802b66 <socket>:
+  802b66:	55                   	push   %ebp
+  802b67:	89 e5                	mov    %esp,%ebp
+  802b69:	83 ec 0c             	sub    $0xc,%esp
+  802b6c:	ff 75 10             	push   0x10(%ebp)
+  802b6f:	ff 75 0c             	push   0xc(%ebp)
+  802b72:	ff 75 08             	push   0x8(%ebp)
+  802b75:	e8 34 02 00 00       	call   802dae <nsipc_socket>
+  802b7a:	83 c4 10             	add    $0x10,%esp
+  802b7d:	85 c0                	test   %eax,%eax
+  802b7f:	78 05                	js     802b86 <socket+0x20>
+  802b81:	e8 ab fe ff ff       	call   802a31 <alloc_sockfd>
+  802b86:	c9                   	leave
+  802b87:	c3                   	ret
+
+00802b88 <nsipc>:
+  802b88:	55                   	push   %ebp
+  802b89:	89 e5                	mov    %esp,%ebp
+  802b8b:	53                   	push   %ebx
+  802b8c:	83 ec 04             	sub    $0x4,%esp
+  802b8f:	89 c3                	mov    %eax,%ebx
+  802b91:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  802b98:	74 1f                	je     802bb9 <nsipc+0x31>
+  802b9a:	83 ec 08             	sub    $0x8,%esp
+  802b9d:	6a 00                	push   $0x0
+  802b9f:	6a 00                	push   $0x0
+  802ba1:	6a 07                	push   $0x7
+  802ba3:	68 00 70 80 00       	push   $0x807000
+  802ba8:	53                   	push   %ebx
+  802ba9:	ff 35 10 50 80 00    	push   0x805010
+  802baf:	e8 0b f0 ff ff       	call   801bbf <ipc_call>
+  802bb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb7:	c9                   	leave
+  802bb8:	c3                   	ret
+  802bb9:	83 ec 0c             	sub    $0xc,%esp
+  802bbc:	6a 03                	push   $0x3
+  802bbe:	e8 97 f1 ff ff       	call   801d5a <ipc_find_env>
+  802bc3:	a3 10 50 80 00       	mov    %eax,0x805010
+  802bc8:	83 c4 10             	add    $0x10,%esp
+  802bcb:	eb cd                	jmp    802b9a <nsipc+0x12>
+
+00802bcd <nsipc_accept>:
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	53                   	push   %ebx
+  802bd1:	83 ec 04             	sub    $0x4,%esp
+  802bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd7:	a3 00 70 80 00       	mov    %eax,0x807000
+  802bdc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802be1:	e8 a2 ff ff ff       	call   802b88 <nsipc>
+  802be6:	89 c3                	mov    %eax,%ebx
+  802be8:	85 c0                	test   %eax,%eax
+  802bea:	79 07                	jns    802bf3 <nsipc_accept+0x26>
+  802bec:	89 d8                	mov    %ebx,%eax
+  802bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+  802bf3:	83 ec 04             	sub    $0x4,%esp
+  802bf6:	ff 35 10 70 80 00    	push   0x807010
+  802bfc:	68 00 70 80 00       	push   $0x807000
+  802c01:	ff 75 0c             	push   0xc(%ebp)
+  802c04:	e8 af de ff ff       	call   800ab8 <memmove>
+  802c09:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802c0f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c12:	89 10                	mov    %edx,(%eax)
+  802c14:	83 c4 10             	add    $0x10,%esp
+  802c17:	eb d3                	jmp    802bec <nsipc_accept+0x1f>
+
+00802c19 <nsipc_bind>:
+  802c19:	55                   	push   %ebp
+  802c1a:	89 e5                	mov    %esp,%ebp
+  802c1c:	53                   	push   %ebx
+  802c1d:	83 ec 08             	sub    $0x8,%esp
+  802c20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c26:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c2b:	53                   	push   %ebx
+  802c2c:	ff 75 0c             	push   0xc(%ebp)
+  802c2f:	68 04 70 80 00       	push   $0x807004
+  802c34:	e8 7f de ff ff       	call   800ab8 <memmove>
+  802c39:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802c3f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c44:	e8 3f ff ff ff       	call   802b88 <nsipc>
+  802c49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c4c:	c9                   	leave
+  802c4d:	c3                   	ret
+
+00802c4e <nsipc_shutdown>:
+  802c4e:	55                   	push   %ebp
+  802c4f:	89 e5                	mov    %esp,%ebp
+  802c51:	83 ec 08             	sub    $0x8,%esp
+  802c54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c57:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5f:	a3 04 70 80 00       	mov    %eax,0x807004
+  802c64:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c69:	e8 1a ff ff ff       	call   802b88 <nsipc>
+  802c6e:	c9                   	leave
+  802c6f:	c3                   	ret
+
+00802c70 <nsipc_close>:
+  802c70:	55                   	push   %ebp
+  802c71:	89 e5                	mov    %esp,%ebp
+  802c73:	83 ec 08             	sub    $0x8,%esp
+  802c76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c79:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c7e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c83:	e8 00 ff ff ff       	call   802b88 <nsipc>
+  802c88:	c9                   	leave
+  802c89:	c3                   	ret
+
+00802c8a <nsipc_connect>:
+  802c8a:	55                   	push   %ebp
+  802c8b:	89 e5                	mov    %esp,%ebp
+  802c8d:	53                   	push   %ebx
+  802c8e:	83 ec 08             	sub    $0x8,%esp
+  802c91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c97:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c9c:	53                   	push   %ebx
+  802c9d:	ff 75 0c             	push   0xc(%ebp)
+  802ca0:	68 04 70 80 00       	push   $0x807004
+  802ca5:	e8 0e de ff ff       	call   800ab8 <memmove>
+  802caa:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802cb0:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cb5:	e8 ce fe ff ff       	call   802b88 <nsipc>
+  802cba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cbd:	c9                   	leave
+  802cbe:	c3                   	ret
+
+00802cbf <nsipc_listen>:
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	83 ec 08             	sub    $0x8,%esp
+  802cc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc8:	a3 00 70 80 00       	mov    %eax,0x807000
+  802ccd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cd0:	a3 04 70 80 00       	mov    %eax,0x807004
+  802cd5:	b8 06 00 00 00       	mov    $0x6,%eax
+  802cda:	e8 a9 fe ff ff       	call   802b88 <nsipc>
+  802cdf:	c9                   	leave
+  802ce0:	c3                   	ret
+
+00802ce1 <nsipc_recv>:
+  802ce1:	55                   	push   %ebp
+  802ce2:	89 e5                	mov    %esp,%ebp
+  802ce4:	56                   	push   %esi
+  802ce5:	53                   	push   %ebx
+  802ce6:	8b 75 10             	mov    0x10(%ebp),%esi
+  802ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cec:	a3 00 70 80 00       	mov    %eax,0x807000
+  802cf1:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802cf7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cfa:	a3 08 70 80 00       	mov    %eax,0x807008
+  802cff:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d04:	e8 7f fe ff ff       	call   802b88 <nsipc>
+  802d09:	89 c3                	mov    %eax,%ebx
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	78 22                	js     802d31 <nsipc_recv+0x50>
+  802d0f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d14:	39 c6                	cmp    %eax,%esi
+  802d16:	0f 4e c6             	cmovle %esi,%eax
+  802d19:	39 c3                	cmp    %eax,%ebx
+  802d1b:	7f 1d                	jg     802d3a <nsipc_recv+0x59>
+  802d1d:	83 ec 04             	sub    $0x4,%esp
+  802d20:	53                   	push   %ebx
+  802d21:	68 00 70 80 00       	push   $0x807000
+  802d26:	ff 75 0c             	push   0xc(%ebp)
+  802d29:	e8 8a dd ff ff       	call   800ab8 <memmove>
+  802d2e:	83 c4 10             	add    $0x10,%esp
+  802d31:	89 d8                	mov    %ebx,%eax
+  802d33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d36:	5b                   	pop    %ebx
+  802d37:	5e                   	pop    %esi
+  802d38:	5d                   	pop    %ebp
+  802d39:	c3                   	ret
+  802d3a:	68 88 3d 80 00       	push   $0x803d88
+  802d3f:	68 9d 3d 80 00       	push   $0x803d9d
+  802d44:	6a 60                	push   $0x60
+  802d46:	68 b2 3d 80 00       	push   $0x803db2
+  802d4b:	e8 83 07 00 00       	call   8034d3 <_panic>
+
+00802d50 <nsipc_send>:
+  802d50:	55                   	push   %ebp
+  802d51:	89 e5                	mov    %esp,%ebp
+  802d53:	53                   	push   %ebx
+  802d54:	83 ec 04             	sub    $0x4,%esp
+  802d57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d62:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d68:	7f 2e                	jg     802d98 <nsipc_send+0x48>
+  802d6a:	83 ec 04             	sub    $0x4,%esp
+  802d6d:	53                   	push   %ebx
+  802d6e:	ff 75 0c             	push   0xc(%ebp)
+  802d71:	68 0c 70 80 00       	push   $0x80700c
+  802d76:	e8 3d dd ff ff       	call   800ab8 <memmove>
+  802d7b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802d81:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d84:	a3 08 70 80 00       	mov    %eax,0x807008
+  802d89:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d8e:	e8 f5 fd ff ff       	call   802b88 <nsipc>
+  802d93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+  802d98:	68 be 3d 80 00       	push   $0x803dbe
+  802d9d:	68 9d 3d 80 00       	push   $0x803d9d
+  802da2:	6a 6b                	push   $0x6b
+  802da4:	68 b2 3d 80 00       	push   $0x803db2
+  802da9:	e8 25 07 00 00       	call   8034d3 <_panic>
+
+00802dae <nsipc_socket>:
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	83 ec 08             	sub    $0x8,%esp
+  802db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db7:	a3 00 70 80 00       	mov    %eax,0x807000
+  802dbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dbf:	a3 04 70 80 00       	mov    %eax,0x807004
+  802dc4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dc7:	a3 08 70 80 00       	mov    %eax,0x807008
+  802dcc:	b8 09 00 00 00       	mov    $0x9,%eax
+  802dd1:	e8 b2 fd ff ff       	call   802b88 <nsipc>
+  802dd6:	c9                   	leave
+  802dd7:	c3                   	ret
+
+00802dd8 <devpipe_stat>:
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	56                   	push   %esi
+  802ddc:	53                   	push   %ebx
+  802ddd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802de0:	83 ec 0c             	sub    $0xc,%esp
+  802de3:	ff 75 08             	push   0x8(%ebp)
+  802de6:	e8 99 ef ff ff       	call   801d84 <fd2data>
+  802deb:	89 c6                	mov    %eax,%esi
+  802ded:	83 c4 08             	add    $0x8,%esp
+  802df0:	68 ca 3d 80 00       	push   $0x803dca
+  802df5:	53                   	push   %ebx
+  802df6:	e8 0d db ff ff       	call   800908 <strcpy>
+  802dfb:	8b 46 04             	mov    0x4(%esi),%eax
+  802dfe:	2b 06                	sub    (%esi),%eax
+  802e00:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802e06:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e0d:	00 00 00 
+  802e10:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802e17:	40 80 00 
+  802e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e22:	5b                   	pop    %ebx
+  802e23:	5e                   	pop    %esi
+  802e24:	5d                   	pop    %ebp
+  802e25:	c3                   	ret
+
+00802e26 <devpipe_close>:
+  802e26:	55                   	push   %ebp
+  802e27:	89 e5                	mov    %esp,%ebp
+  802e29:	53                   	push   %ebx
+  802e2a:	83 ec 0c             	sub    $0xc,%esp
+  802e2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802e30:	53                   	push   %ebx
+  802e31:	6a 00                	push   $0x0
+  802e33:	e8 02 e0 ff ff       	call   800e3a <sys_page_unmap>
+  802e38:	89 1c 24             	mov    %ebx,(%esp)
+  802e3b:	e8 44 ef ff ff       	call   801d84 <fd2data>
+  802e40:	83 c4 08             	add    $0x8,%esp
+  802e43:	50                   	push   %eax
+  802e44:	6a 00                	push   $0x0
+  802e46:	e8 ef df ff ff       	call   800e3a <sys_page_unmap>
+  802e4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e4e:	c9                   	leave
+  802e4f:	c3                   	ret
+
+00802e50 <_pipeisclosed>:
+  802e50:	55                   	push   %ebp
+  802e51:	89 e5                	mov    %esp,%ebp
+  802e53:	57                   	push   %edi
+  802e54:	56                   	push   %esi
+  802e55:	53                   	push   %ebx
+  802e56:	83 ec 1c             	sub    $0x1c,%esp
+  802e59:	89 c7                	mov    %eax,%edi
+  802e5b:	89 d6                	mov    %edx,%esi
+  802e5d:	a1 18 50 80 00       	mov    0x805018,%eax
+  802e62:	8b 58 58             	mov    0x58(%eax),%ebx
+  802e65:	83 ec 0c             	sub    $0xc,%esp
+  802e68:	57                   	push   %edi
+  802e69:	e8 4e 07 00 00       	call   8035bc <pageref>
+  802e6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e71:	89 34 24             	mov    %esi,(%esp)
+  802e74:	e8 43 07 00 00       	call   8035bc <pageref>
+  802e79:	8b 15 18 50 80 00    	mov    0x805018,%edx
+  802e7f:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802e82:	83 c4 10             	add    $0x10,%esp
+  802e85:	39 cb                	cmp    %ecx,%ebx
+  802e87:	74 1b                	je     802ea4 <_pipeisclosed+0x54>
+  802e89:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e8c:	75 cf                	jne    802e5d <_pipeisclosed+0xd>
+  802e8e:	8b 42 58             	mov    0x58(%edx),%eax
+  802e91:	6a 01                	push   $0x1
+  802e93:	50                   	push   %eax
+  802e94:	53                   	push   %ebx
+  802e95:	68 d1 3d 80 00       	push   $0x803dd1
+  802e9a:	e8 72 d3 ff ff       	call   800211 <cprintf>
+  802e9f:	83 c4 10             	add    $0x10,%esp
+  802ea2:	eb b9                	jmp    802e5d <_pipeisclosed+0xd>
+  802ea4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ea7:	0f 94 c0             	sete   %al
+  802eaa:	0f b6 c0             	movzbl %al,%eax
+  802ead:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eb0:	5b                   	pop    %ebx
+  802eb1:	5e                   	pop    %esi
+  802eb2:	5f                   	pop    %edi
+  802eb3:	5d                   	pop    %ebp
+  802eb4:	c3                   	ret
+
+00802eb5 <devpipe_write>:
+  802eb5:	55                   	push   %ebp
+  802eb6:	89 e5                	mov    %esp,%ebp
+  802eb8:	57                   	push   %edi
+  802eb9:	56                   	push   %esi
+  802eba:	53                   	push   %ebx
+  802ebb:	83 ec 28             	sub    $0x28,%esp
+  802ebe:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ec1:	56                   	push   %esi
+  802ec2:	e8 bd ee ff ff       	call   801d84 <fd2data>
+  802ec7:	89 c3                	mov    %eax,%ebx
+  802ec9:	83 c4 10             	add    $0x10,%esp
+  802ecc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ed5:	74 5c                	je     802f33 <devpipe_write+0x7e>
+  802ed7:	8b 43 04             	mov    0x4(%ebx),%eax
+  802eda:	8b 0b                	mov    (%ebx),%ecx
+  802edc:	8d 51 20             	lea    0x20(%ecx),%edx
+  802edf:	39 d0                	cmp    %edx,%eax
+  802ee1:	72 1e                	jb     802f01 <devpipe_write+0x4c>
+  802ee3:	89 da                	mov    %ebx,%edx
+  802ee5:	89 f0                	mov    %esi,%eax
+  802ee7:	e8 64 ff ff ff       	call   802e50 <_pipeisclosed>
+  802eec:	85 c0                	test   %eax,%eax
+  802eee:	75 48                	jne    802f38 <devpipe_write+0x83>
+  802ef0:	e8 28 de ff ff       	call   800d1d <sys_yield>
+  802ef5:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ef8:	8b 0b                	mov    (%ebx),%ecx
+  802efa:	8d 51 20             	lea    0x20(%ecx),%edx
+  802efd:	39 d0                	cmp    %edx,%eax
+  802eff:	73 e2                	jae    802ee3 <devpipe_write+0x2e>
+  802f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f04:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f08:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f0b:	89 c2                	mov    %eax,%edx
+  802f0d:	c1 fa 1f             	sar    $0x1f,%edx
+  802f10:	89 d1                	mov    %edx,%ecx
+  802f12:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f15:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f18:	83 e2 1f             	and    $0x1f,%edx
+  802f1b:	29 ca                	sub    %ecx,%edx
+  802f1d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f21:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802f25:	83 c0 01             	add    $0x1,%eax
+  802f28:	89 43 04             	mov    %eax,0x4(%ebx)
+  802f2b:	83 c7 01             	add    $0x1,%edi
+  802f2e:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802f31:	75 a4                	jne    802ed7 <devpipe_write+0x22>
+  802f33:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f36:	eb 05                	jmp    802f3d <devpipe_write+0x88>
+  802f38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f40:	5b                   	pop    %ebx
+  802f41:	5e                   	pop    %esi
+  802f42:	5f                   	pop    %edi
+  802f43:	5d                   	pop    %ebp
+  802f44:	c3                   	ret
+
+00802f45 <devpipe_read>:
+  802f45:	55                   	push   %ebp
+  802f46:	89 e5                	mov    %esp,%ebp
+  802f48:	57                   	push   %edi
+  802f49:	56                   	push   %esi
+  802f4a:	53                   	push   %ebx
+  802f4b:	83 ec 18             	sub    $0x18,%esp
+  802f4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f51:	56                   	push   %esi
+  802f52:	e8 2d ee ff ff       	call   801d84 <fd2data>
+  802f57:	89 c3                	mov    %eax,%ebx
+  802f59:	83 c4 10             	add    $0x10,%esp
+  802f5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f61:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f65:	74 45                	je     802fac <devpipe_read+0x67>
+  802f67:	8b 03                	mov    (%ebx),%eax
+  802f69:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f6c:	75 1d                	jne    802f8b <devpipe_read+0x46>
+  802f6e:	85 ff                	test   %edi,%edi
+  802f70:	75 3f                	jne    802fb1 <devpipe_read+0x6c>
+  802f72:	89 da                	mov    %ebx,%edx
+  802f74:	89 f0                	mov    %esi,%eax
+  802f76:	e8 d5 fe ff ff       	call   802e50 <_pipeisclosed>
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	75 3c                	jne    802fbb <devpipe_read+0x76>
+  802f7f:	e8 99 dd ff ff       	call   800d1d <sys_yield>
+  802f84:	8b 03                	mov    (%ebx),%eax
+  802f86:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f89:	74 e7                	je     802f72 <devpipe_read+0x2d>
+  802f8b:	99                   	cltd
+  802f8c:	c1 ea 1b             	shr    $0x1b,%edx
+  802f8f:	01 d0                	add    %edx,%eax
+  802f91:	83 e0 1f             	and    $0x1f,%eax
+  802f94:	29 d0                	sub    %edx,%eax
+  802f96:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f9e:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802fa1:	83 03 01             	addl   $0x1,(%ebx)
+  802fa4:	83 c7 01             	add    $0x1,%edi
+  802fa7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802faa:	75 bb                	jne    802f67 <devpipe_read+0x22>
+  802fac:	8b 45 10             	mov    0x10(%ebp),%eax
+  802faf:	eb 02                	jmp    802fb3 <devpipe_read+0x6e>
+  802fb1:	89 f8                	mov    %edi,%eax
+  802fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb6:	5b                   	pop    %ebx
+  802fb7:	5e                   	pop    %esi
+  802fb8:	5f                   	pop    %edi
+  802fb9:	5d                   	pop    %ebp
+  802fba:	c3                   	ret
+  802fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc0:	eb f1                	jmp    802fb3 <devpipe_read+0x6e>
+
+00802fc2 <pipe>:
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	56                   	push   %esi
+  802fc6:	53                   	push   %ebx
+  802fc7:	83 ec 1c             	sub    $0x1c,%esp
+  802fca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fcd:	50                   	push   %eax
+  802fce:	e8 c8 ed ff ff       	call   801d9b <fd_alloc>
+  802fd3:	89 c3                	mov    %eax,%ebx
+  802fd5:	83 c4 10             	add    $0x10,%esp
+  802fd8:	85 c0                	test   %eax,%eax
+  802fda:	0f 88 23 01 00 00    	js     803103 <pipe+0x141>
+  802fe0:	83 ec 04             	sub    $0x4,%esp
+  802fe3:	68 07 04 00 00       	push   $0x407
+  802fe8:	ff 75 f4             	push   -0xc(%ebp)
+  802feb:	6a 00                	push   $0x0
+  802fed:	e8 76 dd ff ff       	call   800d68 <sys_page_alloc>
+  802ff2:	89 c3                	mov    %eax,%ebx
+  802ff4:	83 c4 10             	add    $0x10,%esp
+  802ff7:	85 c0                	test   %eax,%eax
+  802ff9:	0f 88 04 01 00 00    	js     803103 <pipe+0x141>
+  802fff:	83 ec 0c             	sub    $0xc,%esp
+  803002:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803005:	50                   	push   %eax
+  803006:	e8 90 ed ff ff       	call   801d9b <fd_alloc>
+  80300b:	89 c3                	mov    %eax,%ebx
+  80300d:	83 c4 10             	add    $0x10,%esp
+  803010:	85 c0                	test   %eax,%eax
+  803012:	0f 88 db 00 00 00    	js     8030f3 <pipe+0x131>
+  803018:	83 ec 04             	sub    $0x4,%esp
+  80301b:	68 07 04 00 00       	push   $0x407
+  803020:	ff 75 f0             	push   -0x10(%ebp)
+  803023:	6a 00                	push   $0x0
+  803025:	e8 3e dd ff ff       	call   800d68 <sys_page_alloc>
+  80302a:	89 c3                	mov    %eax,%ebx
+  80302c:	83 c4 10             	add    $0x10,%esp
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	0f 88 bc 00 00 00    	js     8030f3 <pipe+0x131>
+  803037:	83 ec 0c             	sub    $0xc,%esp
+  80303a:	ff 75 f4             	push   -0xc(%ebp)
+  80303d:	e8 42 ed ff ff       	call   801d84 <fd2data>
+  803042:	89 c6                	mov    %eax,%esi
+  803044:	83 c4 0c             	add    $0xc,%esp
+  803047:	68 07 04 00 00       	push   $0x407
+  80304c:	50                   	push   %eax
+  80304d:	6a 00                	push   $0x0
+  80304f:	e8 14 dd ff ff       	call   800d68 <sys_page_alloc>
+  803054:	89 c3                	mov    %eax,%ebx
+  803056:	83 c4 10             	add    $0x10,%esp
+  803059:	85 c0                	test   %eax,%eax
+  80305b:	0f 88 82 00 00 00    	js     8030e3 <pipe+0x121>
+  803061:	83 ec 0c             	sub    $0xc,%esp
+  803064:	ff 75 f0             	push   -0x10(%ebp)
+  803067:	e8 18 ed ff ff       	call   801d84 <fd2data>
+  80306c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803073:	50                   	push   %eax
+  803074:	6a 00                	push   $0x0
+  803076:	56                   	push   %esi
+  803077:	6a 00                	push   $0x0
+  803079:	e8 2d dd ff ff       	call   800dab <sys_page_map>
+  80307e:	89 c3                	mov    %eax,%ebx
+  803080:	83 c4 20             	add    $0x20,%esp
+  803083:	85 c0                	test   %eax,%eax
+  803085:	78 4e                	js     8030d5 <pipe+0x113>
+  803087:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80308c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80308f:	89 02                	mov    %eax,(%edx)
+  803091:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803094:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80309b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80309e:	89 02                	mov    %eax,(%edx)
+  8030a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030a3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8030aa:	83 ec 0c             	sub    $0xc,%esp
+  8030ad:	ff 75 f4             	push   -0xc(%ebp)
+  8030b0:	e8 bf ec ff ff       	call   801d74 <fd2num>
+  8030b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030b8:	89 01                	mov    %eax,(%ecx)
+  8030ba:	83 c4 04             	add    $0x4,%esp
+  8030bd:	ff 75 f0             	push   -0x10(%ebp)
+  8030c0:	e8 af ec ff ff       	call   801d74 <fd2num>
+  8030c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030c8:	89 41 04             	mov    %eax,0x4(%ecx)
+  8030cb:	83 c4 10             	add    $0x10,%esp
+  8030ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030d3:	eb 2e                	jmp    803103 <pipe+0x141>
+  8030d5:	83 ec 08             	sub    $0x8,%esp
+  8030d8:	56                   	push   %esi
+  8030d9:	6a 00                	push   $0x0
+  8030db:	e8 5a dd ff ff       	call   800e3a <sys_page_unmap>
+  8030e0:	83 c4 10             	add    $0x10,%esp
+  8030e3:	83 ec 08             	sub    $0x8,%esp
+  8030e6:	ff 75 f0             	push   -0x10(%ebp)
+  8030e9:	6a 00                	push   $0x0
+  8030eb:	e8 4a dd ff ff       	call   800e3a <sys_page_unmap>
+  8030f0:	83 c4 10             	add    $0x10,%esp
+  8030f3:	83 ec 08             	sub    $0x8,%esp
+  8030f6:	ff 75 f4             	push   -0xc(%ebp)
+  8030f9:	6a 00                	push   $0x0
+  8030fb:	e8 3a dd ff ff       	call   800e3a <sys_page_unmap>
+  803100:	83 c4 10             	add    $0x10,%esp
+  803103:	89 d8                	mov    %ebx,%eax
+  803105:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803108:	5b                   	pop    %ebx
+  803109:	5e                   	pop    %esi
+  80310a:	5d                   	pop    %ebp
+  80310b:	c3                   	ret
+
+0080310c <pipeisclosed>:
+  80310c:	55                   	push   %ebp
+  80310d:	89 e5                	mov    %esp,%ebp
+  80310f:	83 ec 20             	sub    $0x20,%esp
+  803112:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803115:	50                   	push   %eax
+  803116:	ff 75 08             	push   0x8(%ebp)
+  803119:	e8 cd ec ff ff       	call   801deb <fd_lookup>
+  80311e:	83 c4 10             	add    $0x10,%esp
+  803121:	85 c0                	test   %eax,%eax
+  803123:	78 18                	js     80313d <pipeisclosed+0x31>
+  803125:	83 ec 0c             	sub    $0xc,%esp
+  803128:	ff 75 f4             	push   -0xc(%ebp)
+  80312b:	e8 54 ec ff ff       	call   801d84 <fd2data>
+  803130:	89 c2                	mov    %eax,%edx
+  803132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803135:	e8 16 fd ff ff       	call   802e50 <_pipeisclosed>
+  80313a:	83 c4 10             	add    $0x10,%esp
+  80313d:	c9                   	leave
+  80313e:	c3                   	ret
+
+0080313f <ipcring_init>:
+  80313f:	55                   	push   %ebp
+  803140:	89 e5                	mov    %esp,%ebp
+  803142:	53                   	push   %ebx
+  803143:	83 ec 08             	sub    $0x8,%esp
+  803146:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803149:	6a 60                	push   $0x60
+  80314b:	6a 00                	push   $0x0
+  80314d:	53                   	push   %ebx
+  80314e:	e8 30 d9 ff ff       	call   800a83 <memset>
+  803153:	a1 18 50 80 00       	mov    0x805018,%eax
+  803158:	8b 40 48             	mov    0x48(%eax),%eax
+  80315b:	89 03                	mov    %eax,(%ebx)
+  80315d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803160:	89 43 04             	mov    %eax,0x4(%ebx)
+  803163:	8b 45 10             	mov    0x10(%ebp),%eax
+  803166:	89 43 08             	mov    %eax,0x8(%ebx)
+  803169:	8b 45 14             	mov    0x14(%ebp),%eax
+  80316c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80316f:	83 c4 10             	add    $0x10,%esp
+  803172:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803175:	c9                   	leave
+  803176:	c3                   	ret
+
+00803177 <ipcring_req_slot>:
+  803177:	55                   	push   %ebp
+  803178:	89 e5                	mov    %esp,%ebp
+  80317a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80317d:	8b 50 10             	mov    0x10(%eax),%edx
+  803180:	8b 48 18             	mov    0x18(%eax),%ecx
+  803183:	29 ca                	sub    %ecx,%edx
+  803185:	83 fa 07             	cmp    $0x7,%edx
+  803188:	77 0c                	ja     803196 <ipcring_req_slot+0x1f>
+  80318a:	8b 50 10             	mov    0x10(%eax),%edx
+  80318d:	83 e2 07             	and    $0x7,%edx
+  803190:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803194:	5d                   	pop    %ebp
+  803195:	c3                   	ret
+  803196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319b:	eb f7                	jmp    803194 <ipcring_req_slot+0x1d>
+
+0080319d <ipcring_req_push>:
+  80319d:	55                   	push   %ebp
+  80319e:	89 e5                	mov    %esp,%ebp
+  8031a0:	83 ec 08             	sub    $0x8,%esp
+  8031a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031a6:	8b 42 10             	mov    0x10(%edx),%eax
+  8031a9:	83 c0 01             	add    $0x1,%eax
+  8031ac:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8031b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b5:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8031b9:	85 c0                	test   %eax,%eax
+  8031bb:	75 02                	jne    8031bf <ipcring_req_push+0x22>
+  8031bd:	c9                   	leave
+  8031be:	c3                   	ret
+  8031bf:	6a 00                	push   $0x0
+  8031c1:	68 00 00 80 ee       	push   $0xee800000
+  8031c6:	ff 72 08             	push   0x8(%edx)
+  8031c9:	ff 72 04             	push   0x4(%edx)
+  8031cc:	e8 cf de ff ff       	call   8010a0 <sys_ipc_send>
+  8031d1:	83 c4 10             	add    $0x10,%esp
+  8031d4:	eb e7                	jmp    8031bd <ipcring_req_push+0x20>
+
+008031d6 <ipcring_rsp_wait>:
+  8031d6:	55                   	push   %ebp
+  8031d7:	89 e5                	mov    %esp,%ebp
+  8031d9:	53                   	push   %ebx
+  8031da:	83 ec 04             	sub    $0x4,%esp
+  8031dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8031e0:	8b 53 18             	mov    0x18(%ebx),%edx
+  8031e3:	8b 43 10             	mov    0x10(%ebx),%eax
+  8031e6:	39 c2                	cmp    %eax,%edx
+  8031e8:	74 3c                	je     803226 <ipcring_rsp_wait+0x50>
+  8031ea:	8b 53 14             	mov    0x14(%ebx),%edx
+  8031ed:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031f0:	39 c2                	cmp    %eax,%edx
+  8031f2:	75 23                	jne    803217 <ipcring_rsp_wait+0x41>
+  8031f4:	83 ec 08             	sub    $0x8,%esp
+  8031f7:	6a 00                	push   $0x0
+  8031f9:	6a 00                	push   $0x0
+  8031fb:	6a 00                	push   $0x0
+  8031fd:	6a 00                	push   $0x0
+  8031ff:	ff 73 0c             	push   0xc(%ebx)
+  803202:	ff 73 04             	push   0x4(%ebx)
+  803205:	e8 b5 e9 ff ff       	call   801bbf <ipc_call>
+  80320a:	8b 53 14             	mov    0x14(%ebx),%edx
+  80320d:	8b 43 18             	mov    0x18(%ebx),%eax
+  803210:	83 c4 20             	add    $0x20,%esp
+  803213:	39 c2                	cmp    %eax,%edx
+  803215:	74 dd                	je     8031f4 <ipcring_rsp_wait+0x1e>
+  803217:	8b 43 18             	mov    0x18(%ebx),%eax
+  80321a:	83 e0 07             	and    $0x7,%eax
+  80321d:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+  803226:	68 ec 3d 80 00       	push   $0x803dec
+  80322b:	68 9d 3d 80 00       	push   $0x803d9d
+  803230:	6a 3b                	push   $0x3b
+  803232:	68 0d 3e 80 00       	push   $0x803e0d
+  803237:	e8 97 02 00 00       	call   8034d3 <_panic>
+
+0080323c <ipcring_rsp_pop>:
+  80323c:	55                   	push   %ebp
+  80323d:	89 e5                	mov    %esp,%ebp
+  80323f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803242:	8b 42 18             	mov    0x18(%edx),%eax
+  803245:	83 c0 01             	add    $0x1,%eax
+  803248:	89 42 18             	mov    %eax,0x18(%edx)
+  80324b:	5d                   	pop    %ebp
+  80324c:	c3                   	ret
+
+0080324d <ipcring_server_init>:
+  80324d:	55                   	push   %ebp
+  80324e:	89 e5                	mov    %esp,%ebp
+  803250:	8b 45 08             	mov    0x8(%ebp),%eax
+  803253:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803256:	89 10                	mov    %edx,(%eax)
+  803258:	8b 55 10             	mov    0x10(%ebp),%edx
+  80325b:	89 50 04             	mov    %edx,0x4(%eax)
+  80325e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803265:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80326c:	5d                   	pop    %ebp
+  80326d:	c3                   	ret
+
+0080326e <ipcring_req_avail>:
+  80326e:	55                   	push   %ebp
+  80326f:	89 e5                	mov    %esp,%ebp
+  803271:	8b 55 08             	mov    0x8(%ebp),%edx
+  803274:	8b 02                	mov    (%edx),%eax
+  803276:	8b 40 10             	mov    0x10(%eax),%eax
+  803279:	2b 42 08             	sub    0x8(%edx),%eax
+  80327c:	ba 08 00 00 00       	mov    $0x8,%edx
+  803281:	39 d0                	cmp    %edx,%eax
+  803283:	0f 47 c2             	cmova  %edx,%eax
+  803286:	5d                   	pop    %ebp
+  803287:	c3                   	ret
+
+00803288 <ipcring_req_peek>:
+  803288:	55                   	push   %ebp
+  803289:	89 e5                	mov    %esp,%ebp
+  80328b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80328e:	8b 42 08             	mov    0x8(%edx),%eax
+  803291:	83 e0 07             	and    $0x7,%eax
+  803294:	8b 12                	mov    (%edx),%edx
+  803296:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80329a:	5d                   	pop    %ebp
+  80329b:	c3                   	ret
+
+0080329c <ipcring_rsp_push>:
+  80329c:	55                   	push   %ebp
+  80329d:	89 e5                	mov    %esp,%ebp
+  80329f:	83 ec 08             	sub    $0x8,%esp
+  8032a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032a5:	8b 41 08             	mov    0x8(%ecx),%eax
+  8032a8:	83 c0 01             	add    $0x1,%eax
+  8032ab:	89 41 08             	mov    %eax,0x8(%ecx)
+  8032ae:	8b 11                	mov    (%ecx),%edx
+  8032b0:	83 c2 14             	add    $0x14,%edx
+  8032b3:	f0 87 02             	lock xchg %eax,(%edx)
+  8032b6:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8032ba:	75 02                	jne    8032be <ipcring_rsp_push+0x22>
+  8032bc:	c9                   	leave
+  8032bd:	c3                   	ret
+  8032be:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8032c5:	6a 00                	push   $0x0
+  8032c7:	68 00 00 80 ee       	push   $0xee800000
+  8032cc:	6a 00                	push   $0x0
+  8032ce:	ff 71 04             	push   0x4(%ecx)
+  8032d1:	e8 ed dc ff ff       	call   800fc3 <sys_ipc_try_send>
+  8032d6:	83 c4 10             	add    $0x10,%esp
+  8032d9:	eb e1                	jmp    8032bc <ipcring_rsp_push+0x20>
+
+008032db <ipcring_client_wait>:
+  8032db:	55                   	push   %ebp
+  8032dc:	89 e5                	mov    %esp,%ebp
+  8032de:	83 ec 08             	sub    $0x8,%esp
+  8032e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e4:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8032eb:	8b 10                	mov    (%eax),%edx
+  8032ed:	8b 52 18             	mov    0x18(%edx),%edx
+  8032f0:	3b 50 08             	cmp    0x8(%eax),%edx
+  8032f3:	75 02                	jne    8032f7 <ipcring_client_wait+0x1c>
+  8032f5:	c9                   	leave
+  8032f6:	c3                   	ret
+  8032f7:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8032fe:	6a 00                	push   $0x0
+  803300:	68 00 00 80 ee       	push   $0xee800000
+  803305:	6a 00                	push   $0x0
+  803307:	ff 70 04             	push   0x4(%eax)
+  80330a:	e8 b4 dc ff ff       	call   800fc3 <sys_ipc_try_send>
+  80330f:	83 c4 10             	add    $0x10,%esp
+  803312:	eb e1                	jmp    8032f5 <ipcring_client_wait+0x1a>
+
+00803314 <ipcring_server_sleep>:
+  803314:	55                   	push   %ebp
+  803315:	89 e5                	mov    %esp,%ebp
+  803317:	53                   	push   %ebx
+  803318:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80331b:	8b 01                	mov    (%ecx),%eax
+  80331d:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803320:	b8 01 00 00 00       	mov    $0x1,%eax
+  803325:	f0 87 02             	lock xchg %eax,(%edx)
+  803328:	8b 11                	mov    (%ecx),%edx
+  80332a:	8b 5a 10             	mov    0x10(%edx),%ebx
+  80332d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803332:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803335:	74 0e                	je     803345 <ipcring_server_sleep+0x31>
+  803337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333c:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803340:	b8 00 00 00 00       	mov    $0x0,%eax
+  803345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803348:	c9                   	leave
+  803349:	c3                   	ret
+
+0080334a <devcons_close>:
+  80334a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334f:	c3                   	ret
+
+00803350 <devcons_stat>:
+  803350:	55                   	push   %ebp
+  803351:	89 e5                	mov    %esp,%ebp
+  803353:	83 ec 10             	sub    $0x10,%esp
+  803356:	68 1b 3e 80 00       	push   $0x803e1b
+  80335b:	ff 75 0c             	push   0xc(%ebp)
+  80335e:	e8 a5 d5 ff ff       	call   800908 <strcpy>
+  803363:	b8 00 00 00 00       	mov    $0x0,%eax
+  803368:	c9                   	leave
+  803369:	c3                   	ret
+
+0080336a <devcons_write>:
+  80336a:	55                   	push   %ebp
+  80336b:	89 e5                	mov    %esp,%ebp
+  80336d:	57                   	push   %edi
+  80336e:	56                   	push   %esi
+  80336f:	53                   	push   %ebx
+  803370:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803376:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803379:	85 ff                	test   %edi,%edi
+  80337b:	74 51                	je     8033ce <devcons_write+0x64>
+  80337d:	be 00 00 00 00       	mov    $0x0,%esi
+  803382:	b8 00 00 00 00       	mov    $0x0,%eax
+  803387:	89 fb                	mov    %edi,%ebx
+  803389:	29 c3                	sub    %eax,%ebx
+  80338b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803390:	39 d3                	cmp    %edx,%ebx
+  803392:	0f 47 da             	cmova  %edx,%ebx
+  803395:	83 ec 04             	sub    $0x4,%esp
+  803398:	53                   	push   %ebx
+  803399:	03 45 0c             	add    0xc(%ebp),%eax
+  80339c:	50                   	push   %eax
+  80339d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033a3:	50                   	push   %eax
+  8033a4:	e8 0f d7 ff ff       	call   800ab8 <memmove>
+  8033a9:	83 c4 08             	add    $0x8,%esp
+  8033ac:	53                   	push   %ebx
+  8033ad:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033b3:	50                   	push   %eax
+  8033b4:	e8 c7 d8 ff ff       	call   800c80 <sys_cputs>
+  8033b9:	01 de                	add    %ebx,%esi
+  8033bb:	89 f0                	mov    %esi,%eax
+  8033bd:	83 c4 10             	add    $0x10,%esp
+  8033c0:	39 fe                	cmp    %edi,%esi
+  8033c2:	72 c3                	jb     803387 <devcons_write+0x1d>
+  8033c4:	89 f0                	mov    %esi,%eax
+  8033c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033c9:	5b                   	pop    %ebx
+  8033ca:	5e                   	pop    %esi
+  8033cb:	5f                   	pop    %edi
+  8033cc:	5d                   	pop    %ebp
+  8033cd:	c3                   	ret
+  8033ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8033d3:	eb ef                	jmp    8033c4 <devcons_write+0x5a>
+
+008033d5 <devcons_read>:
+  8033d5:	55                   	push   %ebp
+  8033d6:	89 e5                	mov    %esp,%ebp
+  8033d8:	83 ec 08             	sub    $0x8,%esp
+  8033db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033e4:	75 07                	jne    8033ed <devcons_read+0x18>
+  8033e6:	eb 1f                	jmp    803407 <devcons_read+0x32>
+  8033e8:	e8 30 d9 ff ff       	call   800d1d <sys_yield>
+  8033ed:	e8 ac d8 ff ff       	call   800c9e <sys_cgetc>
+  8033f2:	85 c0                	test   %eax,%eax
+  8033f4:	74 f2                	je     8033e8 <devcons_read+0x13>
+  8033f6:	78 0f                	js     803407 <devcons_read+0x32>
+  8033f8:	83 f8 04             	cmp    $0x4,%eax
+  8033fb:	74 0c                	je     803409 <devcons_read+0x34>
+  8033fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803400:	88 02                	mov    %al,(%edx)
+  803402:	b8 01 00 00 00       	mov    $0x1,%eax
+  803407:	c9                   	leave
+  803408:	c3                   	ret
+  803409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340e:	eb f7                	jmp    803407 <devcons_read+0x32>
+
+00803410 <cputchar>:
+  803410:	55                   	push   %ebp
+  803411:	89 e5                	mov    %esp,%ebp
+  803413:	83 ec 20             	sub    $0x20,%esp
+  803416:	8b 45 08             	mov    0x8(%ebp),%eax
+  803419:	88 45 f7             	mov    %al,-0x9(%ebp)
+  80341c:	6a 01                	push   $0x1
+  80341e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803421:	50                   	push   %eax
+  803422:	e8 59 d8 ff ff       	call   800c80 <sys_cputs>
+  803427:	83 c4 10             	add    $0x10,%esp
+  80342a:	c9                   	leave
+  80342b:	c3                   	ret
+
+0080342c <getchar>:
+  80342c:	55                   	push   %ebp
+  80342d:	89 e5                	mov    %esp,%ebp
+  80342f:	83 ec 1c             	sub    $0x1c,%esp
+  803432:	6a 01                	push   $0x1
+  803434:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803437:	50                   	push   %eax
+  803438:	6a 00                	push   $0x0
+  80343a:	e8 0e ec ff ff       	call   80204d <read>
+  80343f:	83 c4 10             	add    $0x10,%esp
+  803442:	85 c0                	test   %eax,%eax
+  803444:	78 06                	js     80344c <getchar+0x20>
+  803446:	74 06                	je     80344e <getchar+0x22>
+  803448:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  80344c:	c9                   	leave
+  80344d:	c3                   	ret
+  80344e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803453:	eb f7                	jmp    80344c <getchar+0x20>
+
+00803455 <iscons>:
+  803455:	55                   	push   %ebp
+  803456:	89 e5                	mov    %esp,%ebp
+  803458:	83 ec 20             	sub    $0x20,%esp
+  80345b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80345e:	50                   	push   %eax
+  80345f:	ff 75 08             	push   0x8(%ebp)
+  803462:	e8 84 e9 ff ff       	call   801deb <fd_lookup>
+  803467:	83 c4 10             	add    $0x10,%esp
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	78 11                	js     80347f <iscons+0x2a>
+  80346e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803471:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803477:	39 10                	cmp    %edx,(%eax)
+  803479:	0f 94 c0             	sete   %al
+  80347c:	0f b6 c0             	movzbl %al,%eax
+  80347f:	c9                   	leave
+  803480:	c3                   	ret
+
+00803481 <opencons>:
+  803481:	55                   	push   %ebp
+  803482:	89 e5                	mov    %esp,%ebp
+  803484:	83 ec 24             	sub    $0x24,%esp
+  803487:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80348a:	50                   	push   %eax
+  80348b:	e8 0b e9 ff ff       	call   801d9b <fd_alloc>
+  803490:	83 c4 10             	add    $0x10,%esp
+  803493:	85 c0                	test   %eax,%eax
+  803495:	78 3a                	js     8034d1 <opencons+0x50>
+  803497:	83 ec 04             	sub    $0x4,%esp
+  80349a:	68 07 04 00 00       	push   $0x407
+  80349f:	ff 75 f4             	push   -0xc(%ebp)
+  8034a2:	6a 00                	push   $0x0
+  8034a4:	e8 bf d8 ff ff       	call   800d68 <sys_page_alloc>
+  8034a9:	83 c4 10             	add    $0x10,%esp
+  8034ac:	85 c0                	test   %eax,%eax
+  8034ae:	78 21                	js     8034d1 <opencons+0x50>
+  8034b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034b3:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8034b9:	89 10                	mov    %edx,(%eax)
+  8034bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034be:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8034c5:	83 ec 0c             	sub    $0xc,%esp
+  8034c8:	50                   	push   %eax
+  8034c9:	e8 a6 e8 ff ff       	call   801d74 <fd2num>
+  8034ce:	83 c4 10             	add    $0x10,%esp
+  8034d1:	c9                   	leave
+  8034d2:	c3                   	ret
+
+008034d3 <_panic>:
+  8034d3:	55                   	push   %ebp
+  8034d4:	89 e5                	mov    %esp,%ebp
+  8034d6:	56                   	push   %esi
+  8034d7:	53                   	push   %ebx
+  8034d8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8034db:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8034e1:	e8 18 d8 ff ff       	call   800cfe <sys_getenvid>
+  8034e6:	83 ec 0c             	sub    $0xc,%esp
+  8034e9:	ff 75 0c             	push   0xc(%ebp)
+  8034ec:	ff 75 08             	push   0x8(%ebp)
+  8034ef:	56                   	push   %esi
+  8034f0:	50                   	push   %eax
+  8034f1:	68 28 3e 80 00       	push   $0x803e28
+  8034f6:	e8 16 cd ff ff       	call   800211 <cprintf>
+  8034fb:	83 c4 18             	add    $0x18,%esp
+  8034fe:	53                   	push   %ebx
+  8034ff:	ff 75 10             	push   0x10(%ebp)
+  803502:	e8 b9 cc ff ff       	call   8001c0 <vcprintf>
+  803507:	c7 04 24 e2 3d 80 00 	movl   $0x803de2,(%esp)
+  80350e:	e8 fe cc ff ff       	call   800211 <cprintf>
+  803513:	83 c4 10             	add    $0x10,%esp
+  803516:	cc                   	int3
+  803517:	eb fd                	jmp    803516 <_panic+0x43>
+
+00803519 <set_pgfault_handler>:
+  803519:	55                   	push   %ebp
+  80351a:	89 e5                	mov    %esp,%ebp
+  80351c:	53                   	push   %ebx
+  80351d:	83 ec 04             	sub    $0x4,%esp
+  803520:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803527:	74 0d                	je     803536 <set_pgfault_handler+0x1d>
+  803529:	8b 45 08             	mov    0x8(%ebp),%eax
+  80352c:	a3 00 80 80 00       	mov    %eax,0x808000
+  803531:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803534:	c9                   	leave
+  803535:	c3                   	ret
+  803536:	e8 c3 d7 ff ff       	call   800cfe <sys_getenvid>
+  80353b:	89 c3                	mov    %eax,%ebx
+  80353d:	83 ec 04             	sub    $0x4,%esp
+  803540:	6a 07                	push   $0x7
+  803542:	68 00 f0 7f ee       	push   $0xee7ff000
+  803547:	50                   	push   %eax
+  803548:	e8 1b d8 ff ff       	call   800d68 <sys_page_alloc>
+  80354d:	83 c4 10             	add    $0x10,%esp
+  803550:	85 c0                	test   %eax,%eax
+  803552:	78 29                	js     80357d <set_pgfault_handler+0x64>
+  803554:	83 ec 08             	sub    $0x8,%esp
+  803557:	68 91 35 80 00       	push   $0x803591
+  80355c:	53                   	push   %ebx
+  80355d:	e8 1f da ff ff       	call   800f81 <sys_env_set_pgfault_upcall>
+  803562:	83 c4 10             	add    $0x10,%esp
+  803565:	85 c0                	test   %eax,%eax
+  803567:	79 c0                	jns    803529 <set_pgfault_handler+0x10>
+  803569:	83 ec 04             	sub    $0x4,%esp
+  80356c:	68 84 3e 80 00       	push   $0x803e84
+  803571:	6a 27                	push   $0x27
+  803573:	68 b6 3e 80 00       	push   $0x803eb6
+  803578:	e8 56 ff ff ff       	call   8034d3 <_panic>
+  80357d:	83 ec 04             	sub    $0x4,%esp
+  803580:	68 4c 3e 80 00       	push   $0x803e4c
+  803585:	6a 23                	push   $0x23
+  803587:	68 b6 3e 80 00       	push   $0x803eb6
+  80358c:	e8 42 ff ff ff       	call   8034d3 <_panic>
+
+00803591 <_pgfault_upcall>:
+  803591:	54                   	push   %esp
+  803592:	a1 00 80 80 00       	mov    0x808000,%eax
+  803597:	ff d0                	call   *%eax
+  803599:	83 c4 04             	add    $0x4,%esp
+  80359c:	89 e3                	mov    %esp,%ebx
+  80359e:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8035a2:	8b 54 24 30          	mov    0x30(%esp),%edx
+  8035a6:	89 d4                	mov    %edx,%esp
+  8035a8:	51                   	push   %ecx
+  8035a9:	89 dc                	mov    %ebx,%esp
+  8035ab:	83 ea 04             	sub    $0x4,%edx
+  8035ae:	89 54 24 30          	mov    %edx,0x30(%esp)
+  8035b2:	83 c4 08             	add    $0x8,%esp
+  8035b5:	61                   	popa
+  8035b6:	83 c4 04             	add    $0x4,%esp
+  8035b9:	9d                   	popf
+  8035ba:	5c                   	pop    %esp
+  8035bb:	c3                   	ret
+
+008035bc <pageref>:
+  8035bc:	55                   	push   %ebp
+  8035bd:	89 e5                	mov    %esp,%ebp
+  8035bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c2:	89 c2                	mov    %eax,%edx
+  8035c4:	c1 ea 16             	shr    $0x16,%edx
+  8035c7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8035ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d3:	f6 c1 01             	test   $0x1,%cl
+  8035d6:	74 22                	je     8035fa <pageref+0x3e>
+  8035d8:	c1 e8 0c             	shr    $0xc,%eax
+  8035db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035e2:	a8 01                	test   $0x1,%al
+  8035e4:	74 14                	je     8035fa <pageref+0x3e>
+  8035e6:	c1 e8 0c             	shr    $0xc,%eax
+  8035e9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035ec:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035f3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035f7:	0f b7 d2             	movzwl %dx,%edx
+  8035fa:	89 d0                	mov    %edx,%eax
+  8035fc:	5d                   	pop    %ebp
+  8035fd:	c3                   	ret
+
+008035fe <__udivmoddi4>:
+  8035fe:	55                   	push   %ebp
+  8035ff:	57                   	push   %edi
+  803600:	56                   	push   %esi
+  803601:	53                   	push   %ebx
+  803602:	83 ec 24             	sub    $0x24,%esp
+  803605:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803609:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80360d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803611:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803615:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803619:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80361d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803621:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803625:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803633:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803638:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80363f:	00 
+  803640:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803647:	00 
+  803648:	89 fb                	mov    %edi,%ebx
+  80364a:	eb 08                	jmp    803654 <__udivmoddi4+0x56>
+  80364c:	83 e9 01             	sub    $0x1,%ecx
+  80364f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803652:	74 68                	je     8036bc <__udivmoddi4+0xbe>
+  803654:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803658:	01 c0                	add    %eax,%eax
+  80365a:	89 c6                	mov    %eax,%esi
+  80365c:	89 d7                	mov    %edx,%edi
+  80365e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803662:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803666:	0f ad d0             	shrd   %cl,%edx,%eax
+  803669:	d3 ea                	shr    %cl,%edx
+  80366b:	f6 c1 20             	test   $0x20,%cl
+  80366e:	74 04                	je     803674 <__udivmoddi4+0x76>
+  803670:	89 d0                	mov    %edx,%eax
+  803672:	31 d2                	xor    %edx,%edx
+  803674:	83 e0 01             	and    $0x1,%eax
+  803677:	89 04 24             	mov    %eax,(%esp)
+  80367a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803681:	00 
+  803682:	8b 04 24             	mov    (%esp),%eax
+  803685:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803689:	09 f0                	or     %esi,%eax
+  80368b:	09 fa                	or     %edi,%edx
+  80368d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803691:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803695:	39 f0                	cmp    %esi,%eax
+  803697:	89 d5                	mov    %edx,%ebp
+  803699:	19 fd                	sbb    %edi,%ebp
+  80369b:	72 af                	jb     80364c <__udivmoddi4+0x4e>
+  80369d:	29 f0                	sub    %esi,%eax
+  80369f:	19 fa                	sbb    %edi,%edx
+  8036a1:	89 cf                	mov    %ecx,%edi
+  8036a3:	c1 ef 05             	shr    $0x5,%edi
+  8036a6:	83 e7 01             	and    $0x1,%edi
+  8036a9:	89 fe                	mov    %edi,%esi
+  8036ab:	83 f6 01             	xor    $0x1,%esi
+  8036ae:	d3 e6                	shl    %cl,%esi
+  8036b0:	d3 e7                	shl    %cl,%edi
+  8036b2:	09 74 24 18          	or     %esi,0x18(%esp)
+  8036b6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8036ba:	eb 90                	jmp    80364c <__udivmoddi4+0x4e>
+  8036bc:	85 db                	test   %ebx,%ebx
+  8036be:	74 05                	je     8036c5 <__udivmoddi4+0xc7>
+  8036c0:	89 03                	mov    %eax,(%ebx)
+  8036c2:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036c5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036c9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036cd:	83 c4 24             	add    $0x24,%esp
+  8036d0:	5b                   	pop    %ebx
+  8036d1:	5e                   	pop    %esi
+  8036d2:	5f                   	pop    %edi
+  8036d3:	5d                   	pop    %ebp
+  8036d4:	c3                   	ret
+
+008036d5 <__udivdi3>:
+  8036d5:	83 ec 08             	sub    $0x8,%esp
+  8036d8:	6a 00                	push   $0x0
+  8036da:	ff 74 24 1c          	push   0x1c(%esp)
+  8036de:	ff 74 24 1c          	push   0x1c(%esp)
+  8036e2:	ff 74 24 1c          	push   0x1c(%esp)
+  8036e6:	ff 74 24 1c          	push   0x1c(%esp)
+  8036ea:	e8 0f ff ff ff       	call   8035fe <__udivmoddi4>
+  8036ef:	83 c4 1c             	add    $0x1c,%esp
+  8036f2:	c3                   	ret
+
+008036f3 <__umoddi3>:
+  8036f3:	83 ec 18             	sub    $0x18,%esp
+  8036f6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036fa:	50                   	push   %eax
+  8036fb:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ff:	ff 74 24 2c          	push   0x2c(%esp)
+  803703:	ff 74 24 2c          	push   0x2c(%esp)
+  803707:	ff 74 24 2c          	push   0x2c(%esp)
+  80370b:	e8 ee fe ff ff       	call   8035fe <__udivmoddi4>
+  803710:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803714:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803718:	83 c4 2c             	add    $0x2c,%esp
+  80371b:	c3                   	ret
+
+0080371c <__divdi3>:
+  80371c:	53                   	push   %ebx
+  80371d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803721:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803725:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803729:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80372d:	85 d2                	test   %edx,%edx
+  80372f:	78 12                	js     803743 <__divdi3+0x27>
+  803731:	85 db                	test   %ebx,%ebx
+  803733:	78 2e                	js     803763 <__divdi3+0x47>
+  803735:	53                   	push   %ebx
+  803736:	51                   	push   %ecx
+  803737:	52                   	push   %edx
+  803738:	50                   	push   %eax
+  803739:	e8 97 ff ff ff       	call   8036d5 <__udivdi3>
+  80373e:	83 c4 10             	add    $0x10,%esp
+  803741:	eb 1e                	jmp    803761 <__divdi3+0x45>
+  803743:	f7 d8                	neg    %eax
+  803745:	83 d2 00             	adc    $0x0,%edx
+  803748:	f7 da                	neg    %edx
+  80374a:	85 db                	test   %ebx,%ebx
+  80374c:	78 2a                	js     803778 <__divdi3+0x5c>
+  80374e:	53                   	push   %ebx
+  80374f:	51                   	push   %ecx
+  803750:	52                   	push   %edx
+  803751:	50                   	push   %eax
+  803752:	e8 7e ff ff ff       	call   8036d5 <__udivdi3>
+  803757:	83 c4 10             	add    $0x10,%esp
+  80375a:	f7 d8                	neg    %eax
+  80375c:	83 d2 00             	adc    $0x0,%edx
+  80375f:	f7 da                	neg    %edx
+  803761:	5b                   	pop    %ebx
+  803762:	c3                   	ret
+  803763:	f7 d9                	neg    %ecx
+  803765:	83 d3 00             	adc    $0x0,%ebx
+  803768:	f7 db                	neg    %ebx
+  80376a:	53                   	push   %ebx
+  80376b:	51                   	push   %ecx
+  80376c:	52                   	push   %edx
+  80376d:	50                   	push   %eax
+  80376e:	e8 62 ff ff ff       	call   8036d5 <__udivdi3>
+  803773:	83 c4 10             	add    $0x10,%esp
+  803776:	eb e2                	jmp    80375a <__divdi3+0x3e>
+  803778:	f7 d9                	neg    %ecx
+  80377a:	83 d3 00             	adc    $0x0,%ebx
+  80377d:	f7 db                	neg    %ebx
+  80377f:	53                   	push   %ebx
+  803780:	51                   	push   %ecx
+  803781:	52                   	push   %edx
+  803782:	50                   	push   %eax
+  803783:	e8 4d ff ff ff       	call   8036d5 <__udivdi3>
+  803788:	83 c4 10             	add    $0x10,%esp
+  80378b:	eb d4                	jmp    803761 <__divdi3+0x45>
+
+0080378d <__moddi3>:
+  80378d:	55                   	push   %ebp
+  80378e:	57                   	push   %edi
+  80378f:	56                   	push   %esi
+  803790:	53                   	push   %ebx
+  803791:	83 ec 0c             	sub    $0xc,%esp
+  803794:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803798:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80379c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037a0:	89 e9                	mov    %ebp,%ecx
+  8037a2:	f7 d9                	neg    %ecx
+  8037a4:	89 d0                	mov    %edx,%eax
+  8037a6:	83 d0 00             	adc    $0x0,%eax
+  8037a9:	f7 d8                	neg    %eax
+  8037ab:	0f 49 e9             	cmovns %ecx,%ebp
+  8037ae:	0f 49 d0             	cmovns %eax,%edx
+  8037b1:	52                   	push   %edx
+  8037b2:	55                   	push   %ebp
+  8037b3:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8037b7:	f7 da                	neg    %edx
+  8037b9:	89 d8                	mov    %ebx,%eax
+  8037bb:	83 d0 00             	adc    $0x0,%eax
+  8037be:	f7 d8                	neg    %eax
+  8037c0:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8037c5:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8037c9:	0f 48 c3             	cmovs  %ebx,%eax
+  8037cc:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8037d0:	ff 74 24 0c          	push   0xc(%esp)
+  8037d4:	ff 74 24 0c          	push   0xc(%esp)
+  8037d8:	e8 16 ff ff ff       	call   8036f3 <__umoddi3>
+  8037dd:	83 c4 10             	add    $0x10,%esp
+  8037e0:	85 db                	test   %ebx,%ebx
+  8037e2:	78 08                	js     8037ec <__moddi3+0x5f>
+  8037e4:	83 c4 0c             	add    $0xc,%esp
+  8037e7:	5b                   	pop    %ebx
+  8037e8:	5e                   	pop    %esi
+  8037e9:	5f                   	pop    %edi
+  8037ea:	5d                   	pop    %ebp
+  8037eb:	c3                   	ret
+  8037ec:	f7 d8                	neg    %eax
+  8037ee:	83 d2 00             	adc    $0x0,%edx
+  8037f1:	f7 da                	neg    %edx
+  8037f3:	eb ef                	jmp    8037e4 <__moddi3+0x57>
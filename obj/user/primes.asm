@@ -0,0 +1,5567 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 f2 1a 00 00       	call   801b3e <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+  80004e:	a1 14 50 80 00       	mov    0x805014,%eax
+  800053:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 00 38 80 00       	push   $0x803800
+  800060:	e8 e3 01 00 00       	call   800248 <cprintf>
+  800065:	e8 83 17 00 00       	call   8017ed <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 b9 1a 00 00       	call   801b3e <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 00 1b 00 00       	call   801b9c <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+  8000a1:	50                   	push   %eax
+  8000a2:	68 0c 38 80 00       	push   $0x80380c
+  8000a7:	6a 1a                	push   $0x1a
+  8000a9:	68 15 38 80 00       	push   $0x803815
+  8000ae:	e8 ba 00 00 00       	call   80016d <_panic>
+
+008000b3 <umain>:
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+  8000b8:	e8 30 17 00 00       	call   8017ed <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 c7 1a 00 00       	call   801b9c <ipc_send>
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+  8000dd:	50                   	push   %eax
+  8000de:	68 0c 38 80 00       	push   $0x80380c
+  8000e3:	6a 2d                	push   $0x2d
+  8000e5:	68 15 38 80 00       	push   $0x803815
+  8000ea:	e8 7e 00 00 00       	call   80016d <_panic>
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ff:	e8 31 0c 00 00       	call   800d35 <sys_getenvid>
+  800104:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800109:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80010f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800114:	a3 14 50 80 00       	mov    %eax,0x805014
+  800119:	85 db                	test   %ebx,%ebx
+  80011b:	7e 07                	jle    800124 <libmain+0x30>
+  80011d:	8b 06                	mov    (%esi),%eax
+  80011f:	a3 00 40 80 00       	mov    %eax,0x804000
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	e8 85 ff ff ff       	call   8000b3 <umain>
+  80012e:	e8 0a 00 00 00       	call   80013d <exit>
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+
+0080013d <exit>:
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	a1 14 50 80 00       	mov    0x805014,%eax
+  800148:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80014e:	85 c0                	test   %eax,%eax
+  800150:	75 14                	jne    800166 <exit+0x29>
+  800152:	e8 1e 1e 00 00       	call   801f75 <close_all>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	6a 00                	push   $0x0
+  80015c:	e8 93 0b 00 00       	call   800cf4 <sys_env_destroy>
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+  800166:	e8 f6 12 00 00       	call   801461 <sys_lease_complete>
+  80016b:	eb e5                	jmp    800152 <exit+0x15>
+
+0080016d <_panic>:
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	56                   	push   %esi
+  800171:	53                   	push   %ebx
+  800172:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800175:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80017b:	e8 b5 0b 00 00       	call   800d35 <sys_getenvid>
+  800180:	83 ec 0c             	sub    $0xc,%esp
+  800183:	ff 75 0c             	push   0xc(%ebp)
+  800186:	ff 75 08             	push   0x8(%ebp)
+  800189:	56                   	push   %esi
+  80018a:	50                   	push   %eax
+  80018b:	68 30 38 80 00       	push   $0x803830
+  800190:	e8 b3 00 00 00       	call   800248 <cprintf>
+  800195:	83 c4 18             	add    $0x18,%esp
+  800198:	53                   	push   %ebx
+  800199:	ff 75 10             	push   0x10(%ebp)
+  80019c:	e8 56 00 00 00       	call   8001f7 <vcprintf>
+  8001a1:	c7 04 24 e2 3d 80 00 	movl   $0x803de2,(%esp)
+  8001a8:	e8 9b 00 00 00       	call   800248 <cprintf>
+  8001ad:	83 c4 10             	add    $0x10,%esp
+  8001b0:	cc                   	int3
+  8001b1:	eb fd                	jmp    8001b0 <_panic+0x43>
+
+008001b3 <putch>:
+  8001b3:	55                   	push   %ebp
+  8001b4:	89 e5                	mov    %esp,%ebp
+  8001b6:	53                   	push   %ebx
+  8001b7:	83 ec 04             	sub    $0x4,%esp
+  8001ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001bd:	8b 13                	mov    (%ebx),%edx
+  8001bf:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c2:	89 03                	mov    %eax,(%ebx)
+  8001c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001cb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001d0:	74 09                	je     8001db <putch+0x28>
+  8001d2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+  8001db:	83 ec 08             	sub    $0x8,%esp
+  8001de:	68 ff 00 00 00       	push   $0xff
+  8001e3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	e8 cb 0a 00 00       	call   800cb7 <sys_cputs>
+  8001ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f2:	83 c4 10             	add    $0x10,%esp
+  8001f5:	eb db                	jmp    8001d2 <putch+0x1f>
+
+008001f7 <vcprintf>:
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800200:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800207:	00 00 00 
+  80020a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800211:	00 00 00 
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	ff 75 08             	push   0x8(%ebp)
+  80021a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800220:	50                   	push   %eax
+  800221:	68 b3 01 80 00       	push   $0x8001b3
+  800226:	e8 1c 01 00 00       	call   800347 <vprintfmt>
+  80022b:	83 c4 08             	add    $0x8,%esp
+  80022e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800234:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80023a:	50                   	push   %eax
+  80023b:	e8 77 0a 00 00       	call   800cb7 <sys_cputs>
+  800240:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800246:	c9                   	leave
+  800247:	c3                   	ret
+
+00800248 <cprintf>:
+  800248:	55                   	push   %ebp
+  800249:	89 e5                	mov    %esp,%ebp
+  80024b:	83 ec 10             	sub    $0x10,%esp
+  80024e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800251:	50                   	push   %eax
+  800252:	ff 75 08             	push   0x8(%ebp)
+  800255:	e8 9d ff ff ff       	call   8001f7 <vcprintf>
+  80025a:	c9                   	leave
+  80025b:	c3                   	ret
+
+0080025c <printnum>:
+  80025c:	55                   	push   %ebp
+  80025d:	89 e5                	mov    %esp,%ebp
+  80025f:	57                   	push   %edi
+  800260:	56                   	push   %esi
+  800261:	53                   	push   %ebx
+  800262:	83 ec 1c             	sub    $0x1c,%esp
+  800265:	89 c3                	mov    %eax,%ebx
+  800267:	89 d6                	mov    %edx,%esi
+  800269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80026f:	89 d1                	mov    %edx,%ecx
+  800271:	89 c2                	mov    %eax,%edx
+  800273:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800276:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800279:	8b 45 10             	mov    0x10(%ebp),%eax
+  80027c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80027f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800286:	39 c2                	cmp    %eax,%edx
+  800288:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80028b:	73 4b                	jae    8002d8 <printnum+0x7c>
+  80028d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800290:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800293:	85 ff                	test   %edi,%edi
+  800295:	7e 11                	jle    8002a8 <printnum+0x4c>
+  800297:	83 ec 08             	sub    $0x8,%esp
+  80029a:	56                   	push   %esi
+  80029b:	ff 75 18             	push   0x18(%ebp)
+  80029e:	ff d3                	call   *%ebx
+  8002a0:	83 c4 10             	add    $0x10,%esp
+  8002a3:	83 ef 01             	sub    $0x1,%edi
+  8002a6:	75 ef                	jne    800297 <printnum+0x3b>
+  8002a8:	83 ec 08             	sub    $0x8,%esp
+  8002ab:	56                   	push   %esi
+  8002ac:	83 ec 04             	sub    $0x4,%esp
+  8002af:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b2:	ff 75 e0             	push   -0x20(%ebp)
+  8002b5:	ff 75 dc             	push   -0x24(%ebp)
+  8002b8:	ff 75 d8             	push   -0x28(%ebp)
+  8002bb:	e8 24 34 00 00       	call   8036e4 <__umoddi3>
+  8002c0:	83 c4 14             	add    $0x14,%esp
+  8002c3:	0f be 80 53 38 80 00 	movsbl 0x803853(%eax),%eax
+  8002ca:	50                   	push   %eax
+  8002cb:	ff d3                	call   *%ebx
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d3:	5b                   	pop    %ebx
+  8002d4:	5e                   	pop    %esi
+  8002d5:	5f                   	pop    %edi
+  8002d6:	5d                   	pop    %ebp
+  8002d7:	c3                   	ret
+  8002d8:	83 ec 0c             	sub    $0xc,%esp
+  8002db:	ff 75 18             	push   0x18(%ebp)
+  8002de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002e4:	52                   	push   %edx
+  8002e5:	50                   	push   %eax
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+  8002e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ec:	ff 75 e0             	push   -0x20(%ebp)
+  8002ef:	ff 75 dc             	push   -0x24(%ebp)
+  8002f2:	ff 75 d8             	push   -0x28(%ebp)
+  8002f5:	e8 cc 33 00 00       	call   8036c6 <__udivdi3>
+  8002fa:	83 c4 18             	add    $0x18,%esp
+  8002fd:	52                   	push   %edx
+  8002fe:	50                   	push   %eax
+  8002ff:	89 f2                	mov    %esi,%edx
+  800301:	89 d8                	mov    %ebx,%eax
+  800303:	e8 54 ff ff ff       	call   80025c <printnum>
+  800308:	83 c4 20             	add    $0x20,%esp
+  80030b:	eb 9b                	jmp    8002a8 <printnum+0x4c>
+
+0080030d <sprintputch>:
+  80030d:	55                   	push   %ebp
+  80030e:	89 e5                	mov    %esp,%ebp
+  800310:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800313:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800317:	8b 10                	mov    (%eax),%edx
+  800319:	3b 50 04             	cmp    0x4(%eax),%edx
+  80031c:	73 0a                	jae    800328 <sprintputch+0x1b>
+  80031e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800321:	89 08                	mov    %ecx,(%eax)
+  800323:	8b 45 08             	mov    0x8(%ebp),%eax
+  800326:	88 02                	mov    %al,(%edx)
+  800328:	5d                   	pop    %ebp
+  800329:	c3                   	ret
+
+0080032a <printfmt>:
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	83 ec 08             	sub    $0x8,%esp
+  800330:	8d 45 14             	lea    0x14(%ebp),%eax
+  800333:	50                   	push   %eax
+  800334:	ff 75 10             	push   0x10(%ebp)
+  800337:	ff 75 0c             	push   0xc(%ebp)
+  80033a:	ff 75 08             	push   0x8(%ebp)
+  80033d:	e8 05 00 00 00       	call   800347 <vprintfmt>
+  800342:	83 c4 10             	add    $0x10,%esp
+  800345:	c9                   	leave
+  800346:	c3                   	ret
+
+00800347 <vprintfmt>:
+  800347:	55                   	push   %ebp
+  800348:	89 e5                	mov    %esp,%ebp
+  80034a:	57                   	push   %edi
+  80034b:	56                   	push   %esi
+  80034c:	53                   	push   %ebx
+  80034d:	83 ec 2c             	sub    $0x2c,%esp
+  800350:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800353:	89 df                	mov    %ebx,%edi
+  800355:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800358:	8b 45 10             	mov    0x10(%ebp),%eax
+  80035b:	8d 70 01             	lea    0x1(%eax),%esi
+  80035e:	0f b6 00             	movzbl (%eax),%eax
+  800361:	83 f8 25             	cmp    $0x25,%eax
+  800364:	74 1e                	je     800384 <vprintfmt+0x3d>
+  800366:	85 c0                	test   %eax,%eax
+  800368:	0f 84 15 05 00 00    	je     800883 <vprintfmt+0x53c>
+  80036e:	83 ec 08             	sub    $0x8,%esp
+  800371:	53                   	push   %ebx
+  800372:	50                   	push   %eax
+  800373:	ff d7                	call   *%edi
+  800375:	83 c6 01             	add    $0x1,%esi
+  800378:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80037c:	83 c4 10             	add    $0x10,%esp
+  80037f:	83 f8 25             	cmp    $0x25,%eax
+  800382:	75 e2                	jne    800366 <vprintfmt+0x1f>
+  800384:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800388:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80038f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800396:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80039d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8003a5:	8d 56 01             	lea    0x1(%esi),%edx
+  8003a8:	0f b6 0e             	movzbl (%esi),%ecx
+  8003ab:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003ae:	3c 55                	cmp    $0x55,%al
+  8003b0:	0f 87 3b 04 00 00    	ja     8007f1 <vprintfmt+0x4aa>
+  8003b6:	0f b6 c0             	movzbl %al,%eax
+  8003b9:	ff 24 85 a0 39 80 00 	jmp    *0x8039a0(,%eax,4)
+  8003c0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003c3:	eb 93                	jmp    800358 <vprintfmt+0x11>
+  8003c5:	89 d6                	mov    %edx,%esi
+  8003c7:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003cb:	eb d8                	jmp    8003a5 <vprintfmt+0x5e>
+  8003cd:	89 d6                	mov    %edx,%esi
+  8003cf:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003d3:	eb d0                	jmp    8003a5 <vprintfmt+0x5e>
+  8003d5:	0f b6 c9             	movzbl %cl,%ecx
+  8003d8:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003db:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003de:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003e2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003e5:	83 f9 09             	cmp    $0x9,%ecx
+  8003e8:	77 6f                	ja     800459 <vprintfmt+0x112>
+  8003ea:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003ed:	83 c2 01             	add    $0x1,%edx
+  8003f0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003f3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003f7:	0f be 02             	movsbl (%edx),%eax
+  8003fa:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003fd:	83 fe 09             	cmp    $0x9,%esi
+  800400:	76 eb                	jbe    8003ed <vprintfmt+0xa6>
+  800402:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800405:	89 d6                	mov    %edx,%esi
+  800407:	eb 13                	jmp    80041c <vprintfmt+0xd5>
+  800409:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040c:	8b 00                	mov    (%eax),%eax
+  80040e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800411:	8b 45 14             	mov    0x14(%ebp),%eax
+  800414:	8d 40 04             	lea    0x4(%eax),%eax
+  800417:	89 45 14             	mov    %eax,0x14(%ebp)
+  80041a:	89 d6                	mov    %edx,%esi
+  80041c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800420:	79 83                	jns    8003a5 <vprintfmt+0x5e>
+  800422:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800425:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800428:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80042f:	e9 71 ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  800434:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800437:	85 c9                	test   %ecx,%ecx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	0f 49 c1             	cmovns %ecx,%eax
+  800441:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800444:	89 d6                	mov    %edx,%esi
+  800446:	e9 5a ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  80044b:	89 d6                	mov    %edx,%esi
+  80044d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800454:	e9 4c ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  800459:	89 d6                	mov    %edx,%esi
+  80045b:	eb bf                	jmp    80041c <vprintfmt+0xd5>
+  80045d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800461:	89 d6                	mov    %edx,%esi
+  800463:	e9 3d ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  800468:	89 55 10             	mov    %edx,0x10(%ebp)
+  80046b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046e:	8d 70 04             	lea    0x4(%eax),%esi
+  800471:	83 ec 08             	sub    $0x8,%esp
+  800474:	53                   	push   %ebx
+  800475:	ff 30                	push   (%eax)
+  800477:	ff d7                	call   *%edi
+  800479:	83 c4 10             	add    $0x10,%esp
+  80047c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80047f:	e9 d4 fe ff ff       	jmp    800358 <vprintfmt+0x11>
+  800484:	89 55 10             	mov    %edx,0x10(%ebp)
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8d 70 04             	lea    0x4(%eax),%esi
+  80048d:	8b 10                	mov    (%eax),%edx
+  80048f:	89 d0                	mov    %edx,%eax
+  800491:	f7 d8                	neg    %eax
+  800493:	0f 48 c2             	cmovs  %edx,%eax
+  800496:	83 f8 12             	cmp    $0x12,%eax
+  800499:	7f 23                	jg     8004be <vprintfmt+0x177>
+  80049b:	8b 14 85 00 3b 80 00 	mov    0x803b00(,%eax,4),%edx
+  8004a2:	85 d2                	test   %edx,%edx
+  8004a4:	74 18                	je     8004be <vprintfmt+0x177>
+  8004a6:	52                   	push   %edx
+  8004a7:	68 af 3d 80 00       	push   $0x803daf
+  8004ac:	53                   	push   %ebx
+  8004ad:	57                   	push   %edi
+  8004ae:	e8 77 fe ff ff       	call   80032a <printfmt>
+  8004b3:	83 c4 10             	add    $0x10,%esp
+  8004b6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004b9:	e9 9a fe ff ff       	jmp    800358 <vprintfmt+0x11>
+  8004be:	50                   	push   %eax
+  8004bf:	68 6b 38 80 00       	push   $0x80386b
+  8004c4:	53                   	push   %ebx
+  8004c5:	57                   	push   %edi
+  8004c6:	e8 5f fe ff ff       	call   80032a <printfmt>
+  8004cb:	83 c4 10             	add    $0x10,%esp
+  8004ce:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004d1:	e9 82 fe ff ff       	jmp    800358 <vprintfmt+0x11>
+  8004d6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dc:	83 c0 04             	add    $0x4,%eax
+  8004df:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e5:	8b 00                	mov    (%eax),%eax
+  8004e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ea:	85 c0                	test   %eax,%eax
+  8004ec:	0f 84 61 03 00 00    	je     800853 <vprintfmt+0x50c>
+  8004f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004f6:	7e 06                	jle    8004fe <vprintfmt+0x1b7>
+  8004f8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004fc:	75 29                	jne    800527 <vprintfmt+0x1e0>
+  8004fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800501:	8d 70 01             	lea    0x1(%eax),%esi
+  800504:	0f b6 00             	movzbl (%eax),%eax
+  800507:	0f be d0             	movsbl %al,%edx
+  80050a:	85 d2                	test   %edx,%edx
+  80050c:	0f 84 bb 00 00 00    	je     8005cd <vprintfmt+0x286>
+  800512:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800515:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800518:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80051b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80051e:	eb 7a                	jmp    80059a <vprintfmt+0x253>
+  800520:	c7 45 d0 64 38 80 00 	movl   $0x803864,-0x30(%ebp)
+  800527:	83 ec 08             	sub    $0x8,%esp
+  80052a:	ff 75 d4             	push   -0x2c(%ebp)
+  80052d:	ff 75 d0             	push   -0x30(%ebp)
+  800530:	e8 e0 03 00 00       	call   800915 <strnlen>
+  800535:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800538:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80053b:	83 c4 10             	add    $0x10,%esp
+  80053e:	85 d2                	test   %edx,%edx
+  800540:	0f 8e d6 02 00 00    	jle    80081c <vprintfmt+0x4d5>
+  800546:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80054a:	83 ec 08             	sub    $0x8,%esp
+  80054d:	53                   	push   %ebx
+  80054e:	56                   	push   %esi
+  80054f:	ff d7                	call   *%edi
+  800551:	83 c4 10             	add    $0x10,%esp
+  800554:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800558:	75 f0                	jne    80054a <vprintfmt+0x203>
+  80055a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80055d:	8d 70 01             	lea    0x1(%eax),%esi
+  800560:	0f b6 00             	movzbl (%eax),%eax
+  800563:	0f be d0             	movsbl %al,%edx
+  800566:	85 d2                	test   %edx,%edx
+  800568:	0f 84 da 02 00 00    	je     800848 <vprintfmt+0x501>
+  80056e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800571:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800574:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800577:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80057a:	eb 1e                	jmp    80059a <vprintfmt+0x253>
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	ff 75 0c             	push   0xc(%ebp)
+  800582:	52                   	push   %edx
+  800583:	ff 55 08             	call   *0x8(%ebp)
+  800586:	83 c4 10             	add    $0x10,%esp
+  800589:	83 eb 01             	sub    $0x1,%ebx
+  80058c:	83 c6 01             	add    $0x1,%esi
+  80058f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800593:	0f be d0             	movsbl %al,%edx
+  800596:	85 d2                	test   %edx,%edx
+  800598:	74 2a                	je     8005c4 <vprintfmt+0x27d>
+  80059a:	85 ff                	test   %edi,%edi
+  80059c:	78 05                	js     8005a3 <vprintfmt+0x25c>
+  80059e:	83 ef 01             	sub    $0x1,%edi
+  8005a1:	78 59                	js     8005fc <vprintfmt+0x2b5>
+  8005a3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005a7:	74 d3                	je     80057c <vprintfmt+0x235>
+  8005a9:	0f be c0             	movsbl %al,%eax
+  8005ac:	83 e8 20             	sub    $0x20,%eax
+  8005af:	83 f8 5e             	cmp    $0x5e,%eax
+  8005b2:	76 c8                	jbe    80057c <vprintfmt+0x235>
+  8005b4:	83 ec 08             	sub    $0x8,%esp
+  8005b7:	ff 75 0c             	push   0xc(%ebp)
+  8005ba:	6a 3f                	push   $0x3f
+  8005bc:	ff 55 08             	call   *0x8(%ebp)
+  8005bf:	83 c4 10             	add    $0x10,%esp
+  8005c2:	eb c5                	jmp    800589 <vprintfmt+0x242>
+  8005c4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005cd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005d0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005d4:	7e 1b                	jle    8005f1 <vprintfmt+0x2aa>
+  8005d6:	83 ec 08             	sub    $0x8,%esp
+  8005d9:	53                   	push   %ebx
+  8005da:	6a 20                	push   $0x20
+  8005dc:	ff d7                	call   *%edi
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	83 ee 01             	sub    $0x1,%esi
+  8005e4:	75 f0                	jne    8005d6 <vprintfmt+0x28f>
+  8005e6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ec:	e9 67 fd ff ff       	jmp    800358 <vprintfmt+0x11>
+  8005f1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f7:	e9 5c fd ff ff       	jmp    800358 <vprintfmt+0x11>
+  8005fc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800602:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800605:	eb c6                	jmp    8005cd <vprintfmt+0x286>
+  800607:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80060a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80060d:	83 f9 01             	cmp    $0x1,%ecx
+  800610:	7f 1f                	jg     800631 <vprintfmt+0x2ea>
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	74 67                	je     80067d <vprintfmt+0x336>
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 30                	mov    (%eax),%esi
+  80061b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80061e:	89 f0                	mov    %esi,%eax
+  800620:	c1 f8 1f             	sar    $0x1f,%eax
+  800623:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8d 40 04             	lea    0x4(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062f:	eb 17                	jmp    800648 <vprintfmt+0x301>
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8b 50 04             	mov    0x4(%eax),%edx
+  800637:	8b 00                	mov    (%eax),%eax
+  800639:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80063c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8d 40 08             	lea    0x8(%eax),%eax
+  800645:	89 45 14             	mov    %eax,0x14(%ebp)
+  800648:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80064b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80064e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800653:	85 c9                	test   %ecx,%ecx
+  800655:	0f 89 12 01 00 00    	jns    80076d <vprintfmt+0x426>
+  80065b:	83 ec 08             	sub    $0x8,%esp
+  80065e:	53                   	push   %ebx
+  80065f:	6a 2d                	push   $0x2d
+  800661:	ff d7                	call   *%edi
+  800663:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800666:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800669:	f7 da                	neg    %edx
+  80066b:	83 d1 00             	adc    $0x0,%ecx
+  80066e:	f7 d9                	neg    %ecx
+  800670:	83 c4 10             	add    $0x10,%esp
+  800673:	be 0a 00 00 00       	mov    $0xa,%esi
+  800678:	e9 f0 00 00 00       	jmp    80076d <vprintfmt+0x426>
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8b 30                	mov    (%eax),%esi
+  800682:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800685:	89 f0                	mov    %esi,%eax
+  800687:	c1 f8 1f             	sar    $0x1f,%eax
+  80068a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+  800696:	eb b0                	jmp    800648 <vprintfmt+0x301>
+  800698:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80069b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80069e:	83 f9 01             	cmp    $0x1,%ecx
+  8006a1:	7f 1e                	jg     8006c1 <vprintfmt+0x37a>
+  8006a3:	85 c9                	test   %ecx,%ecx
+  8006a5:	74 32                	je     8006d9 <vprintfmt+0x392>
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006bc:	e9 ac 00 00 00       	jmp    80076d <vprintfmt+0x426>
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cf:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006d4:	e9 94 00 00 00       	jmp    80076d <vprintfmt+0x426>
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 10                	mov    (%eax),%edx
+  8006de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006ee:	eb 7d                	jmp    80076d <vprintfmt+0x426>
+  8006f0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006f3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f6:	83 f9 01             	cmp    $0x1,%ecx
+  8006f9:	7f 1b                	jg     800716 <vprintfmt+0x3cf>
+  8006fb:	85 c9                	test   %ecx,%ecx
+  8006fd:	74 2c                	je     80072b <vprintfmt+0x3e4>
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8b 10                	mov    (%eax),%edx
+  800704:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800709:	8d 40 04             	lea    0x4(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070f:	be 08 00 00 00       	mov    $0x8,%esi
+  800714:	eb 57                	jmp    80076d <vprintfmt+0x426>
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 10                	mov    (%eax),%edx
+  80071b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071e:	8d 40 08             	lea    0x8(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+  800724:	be 08 00 00 00       	mov    $0x8,%esi
+  800729:	eb 42                	jmp    80076d <vprintfmt+0x426>
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 10                	mov    (%eax),%edx
+  800730:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800735:	8d 40 04             	lea    0x4(%eax),%eax
+  800738:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073b:	be 08 00 00 00       	mov    $0x8,%esi
+  800740:	eb 2b                	jmp    80076d <vprintfmt+0x426>
+  800742:	89 55 10             	mov    %edx,0x10(%ebp)
+  800745:	83 ec 08             	sub    $0x8,%esp
+  800748:	53                   	push   %ebx
+  800749:	6a 30                	push   $0x30
+  80074b:	ff d7                	call   *%edi
+  80074d:	83 c4 08             	add    $0x8,%esp
+  800750:	53                   	push   %ebx
+  800751:	6a 78                	push   $0x78
+  800753:	ff d7                	call   *%edi
+  800755:	8b 45 14             	mov    0x14(%ebp),%eax
+  800758:	8b 10                	mov    (%eax),%edx
+  80075a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075f:	83 c4 10             	add    $0x10,%esp
+  800762:	8d 40 04             	lea    0x4(%eax),%eax
+  800765:	89 45 14             	mov    %eax,0x14(%ebp)
+  800768:	be 10 00 00 00       	mov    $0x10,%esi
+  80076d:	83 ec 0c             	sub    $0xc,%esp
+  800770:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800774:	50                   	push   %eax
+  800775:	ff 75 e4             	push   -0x1c(%ebp)
+  800778:	56                   	push   %esi
+  800779:	51                   	push   %ecx
+  80077a:	52                   	push   %edx
+  80077b:	89 da                	mov    %ebx,%edx
+  80077d:	89 f8                	mov    %edi,%eax
+  80077f:	e8 d8 fa ff ff       	call   80025c <printnum>
+  800784:	83 c4 20             	add    $0x20,%esp
+  800787:	e9 cc fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  80078c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80078f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800792:	83 f9 01             	cmp    $0x1,%ecx
+  800795:	7f 1b                	jg     8007b2 <vprintfmt+0x46b>
+  800797:	85 c9                	test   %ecx,%ecx
+  800799:	74 2c                	je     8007c7 <vprintfmt+0x480>
+  80079b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079e:	8b 10                	mov    (%eax),%edx
+  8007a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ab:	be 10 00 00 00       	mov    $0x10,%esi
+  8007b0:	eb bb                	jmp    80076d <vprintfmt+0x426>
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 10                	mov    (%eax),%edx
+  8007b7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c0:	be 10 00 00 00       	mov    $0x10,%esi
+  8007c5:	eb a6                	jmp    80076d <vprintfmt+0x426>
+  8007c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ca:	8b 10                	mov    (%eax),%edx
+  8007cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d7:	be 10 00 00 00       	mov    $0x10,%esi
+  8007dc:	eb 8f                	jmp    80076d <vprintfmt+0x426>
+  8007de:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e1:	83 ec 08             	sub    $0x8,%esp
+  8007e4:	53                   	push   %ebx
+  8007e5:	6a 25                	push   $0x25
+  8007e7:	ff d7                	call   *%edi
+  8007e9:	83 c4 10             	add    $0x10,%esp
+  8007ec:	e9 67 fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  8007f1:	83 ec 08             	sub    $0x8,%esp
+  8007f4:	53                   	push   %ebx
+  8007f5:	6a 25                	push   $0x25
+  8007f7:	ff d7                	call   *%edi
+  8007f9:	83 c4 10             	add    $0x10,%esp
+  8007fc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800800:	0f 84 ba fb ff ff    	je     8003c0 <vprintfmt+0x79>
+  800806:	89 75 10             	mov    %esi,0x10(%ebp)
+  800809:	89 f0                	mov    %esi,%eax
+  80080b:	83 e8 01             	sub    $0x1,%eax
+  80080e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800812:	75 f7                	jne    80080b <vprintfmt+0x4c4>
+  800814:	89 45 10             	mov    %eax,0x10(%ebp)
+  800817:	e9 3c fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  80081c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80081f:	8d 70 01             	lea    0x1(%eax),%esi
+  800822:	0f b6 00             	movzbl (%eax),%eax
+  800825:	0f be d0             	movsbl %al,%edx
+  800828:	85 d2                	test   %edx,%edx
+  80082a:	74 11                	je     80083d <vprintfmt+0x4f6>
+  80082c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80082f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800832:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800835:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800838:	e9 5d fd ff ff       	jmp    80059a <vprintfmt+0x253>
+  80083d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800840:	89 45 14             	mov    %eax,0x14(%ebp)
+  800843:	e9 10 fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  800848:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084e:	e9 05 fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  800853:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800857:	7e 0a                	jle    800863 <vprintfmt+0x51c>
+  800859:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80085d:	0f 85 bd fc ff ff    	jne    800520 <vprintfmt+0x1d9>
+  800863:	ba 28 00 00 00       	mov    $0x28,%edx
+  800868:	b8 28 00 00 00       	mov    $0x28,%eax
+  80086d:	be 65 38 80 00       	mov    $0x803865,%esi
+  800872:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800875:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800878:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80087b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80087e:	e9 17 fd ff ff       	jmp    80059a <vprintfmt+0x253>
+  800883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800886:	5b                   	pop    %ebx
+  800887:	5e                   	pop    %esi
+  800888:	5f                   	pop    %edi
+  800889:	5d                   	pop    %ebp
+  80088a:	c3                   	ret
+
+0080088b <vsnprintf>:
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	83 ec 18             	sub    $0x18,%esp
+  800891:	8b 45 08             	mov    0x8(%ebp),%eax
+  800894:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800897:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80089a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80089e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8008a8:	85 c0                	test   %eax,%eax
+  8008aa:	74 26                	je     8008d2 <vsnprintf+0x47>
+  8008ac:	85 d2                	test   %edx,%edx
+  8008ae:	7e 22                	jle    8008d2 <vsnprintf+0x47>
+  8008b0:	ff 75 14             	push   0x14(%ebp)
+  8008b3:	ff 75 10             	push   0x10(%ebp)
+  8008b6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008b9:	50                   	push   %eax
+  8008ba:	68 0d 03 80 00       	push   $0x80030d
+  8008bf:	e8 83 fa ff ff       	call   800347 <vprintfmt>
+  8008c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008c7:	c6 00 00             	movb   $0x0,(%eax)
+  8008ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008cd:	83 c4 10             	add    $0x10,%esp
+  8008d0:	c9                   	leave
+  8008d1:	c3                   	ret
+  8008d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d7:	eb f7                	jmp    8008d0 <vsnprintf+0x45>
+
+008008d9 <snprintf>:
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	83 ec 08             	sub    $0x8,%esp
+  8008df:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008e2:	50                   	push   %eax
+  8008e3:	ff 75 10             	push   0x10(%ebp)
+  8008e6:	ff 75 0c             	push   0xc(%ebp)
+  8008e9:	ff 75 08             	push   0x8(%ebp)
+  8008ec:	e8 9a ff ff ff       	call   80088b <vsnprintf>
+  8008f1:	c9                   	leave
+  8008f2:	c3                   	ret
+
+008008f3 <strlen>:
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f9:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008fc:	74 10                	je     80090e <strlen+0x1b>
+  8008fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800903:	83 c0 01             	add    $0x1,%eax
+  800906:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80090a:	75 f7                	jne    800903 <strlen+0x10>
+  80090c:	5d                   	pop    %ebp
+  80090d:	c3                   	ret
+  80090e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800913:	eb f7                	jmp    80090c <strlen+0x19>
+
+00800915 <strnlen>:
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091e:	85 d2                	test   %edx,%edx
+  800920:	74 16                	je     800938 <strnlen+0x23>
+  800922:	b8 00 00 00 00       	mov    $0x0,%eax
+  800927:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80092b:	74 09                	je     800936 <strnlen+0x21>
+  80092d:	83 c0 01             	add    $0x1,%eax
+  800930:	39 d0                	cmp    %edx,%eax
+  800932:	75 f3                	jne    800927 <strnlen+0x12>
+  800934:	89 d0                	mov    %edx,%eax
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	eb f7                	jmp    800936 <strnlen+0x21>
+
+0080093f <strcpy>:
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	53                   	push   %ebx
+  800943:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800946:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800952:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800955:	83 c0 01             	add    $0x1,%eax
+  800958:	84 d2                	test   %dl,%dl
+  80095a:	75 f2                	jne    80094e <strcpy+0xf>
+  80095c:	89 c8                	mov    %ecx,%eax
+  80095e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800961:	c9                   	leave
+  800962:	c3                   	ret
+
+00800963 <strcat>:
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	53                   	push   %ebx
+  800967:	83 ec 10             	sub    $0x10,%esp
+  80096a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80096d:	53                   	push   %ebx
+  80096e:	e8 80 ff ff ff       	call   8008f3 <strlen>
+  800973:	83 c4 08             	add    $0x8,%esp
+  800976:	ff 75 0c             	push   0xc(%ebp)
+  800979:	01 d8                	add    %ebx,%eax
+  80097b:	50                   	push   %eax
+  80097c:	e8 be ff ff ff       	call   80093f <strcpy>
+  800981:	89 d8                	mov    %ebx,%eax
+  800983:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800986:	c9                   	leave
+  800987:	c3                   	ret
+
+00800988 <strncpy>:
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	56                   	push   %esi
+  80098c:	53                   	push   %ebx
+  80098d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800990:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800993:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800996:	85 db                	test   %ebx,%ebx
+  800998:	74 17                	je     8009b1 <strncpy+0x29>
+  80099a:	01 f3                	add    %esi,%ebx
+  80099c:	89 f0                	mov    %esi,%eax
+  80099e:	83 c0 01             	add    $0x1,%eax
+  8009a1:	0f b6 0a             	movzbl (%edx),%ecx
+  8009a4:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009a7:	80 f9 01             	cmp    $0x1,%cl
+  8009aa:	83 da ff             	sbb    $0xffffffff,%edx
+  8009ad:	39 c3                	cmp    %eax,%ebx
+  8009af:	75 ed                	jne    80099e <strncpy+0x16>
+  8009b1:	89 f0                	mov    %esi,%eax
+  8009b3:	5b                   	pop    %ebx
+  8009b4:	5e                   	pop    %esi
+  8009b5:	5d                   	pop    %ebp
+  8009b6:	c3                   	ret
+
+008009b7 <strlcpy>:
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	56                   	push   %esi
+  8009bb:	53                   	push   %ebx
+  8009bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009c5:	89 f0                	mov    %esi,%eax
+  8009c7:	85 db                	test   %ebx,%ebx
+  8009c9:	74 1e                	je     8009e9 <strlcpy+0x32>
+  8009cb:	83 eb 01             	sub    $0x1,%ebx
+  8009ce:	74 16                	je     8009e6 <strlcpy+0x2f>
+  8009d0:	01 f3                	add    %esi,%ebx
+  8009d2:	0f b6 0a             	movzbl (%edx),%ecx
+  8009d5:	84 c9                	test   %cl,%cl
+  8009d7:	74 0d                	je     8009e6 <strlcpy+0x2f>
+  8009d9:	83 c2 01             	add    $0x1,%edx
+  8009dc:	83 c0 01             	add    $0x1,%eax
+  8009df:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009e2:	39 d8                	cmp    %ebx,%eax
+  8009e4:	75 ec                	jne    8009d2 <strlcpy+0x1b>
+  8009e6:	c6 00 00             	movb   $0x0,(%eax)
+  8009e9:	29 f0                	sub    %esi,%eax
+  8009eb:	5b                   	pop    %ebx
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5d                   	pop    %ebp
+  8009ee:	c3                   	ret
+
+008009ef <strcmp>:
+  8009ef:	55                   	push   %ebp
+  8009f0:	89 e5                	mov    %esp,%ebp
+  8009f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009f8:	0f b6 01             	movzbl (%ecx),%eax
+  8009fb:	84 c0                	test   %al,%al
+  8009fd:	74 11                	je     800a10 <strcmp+0x21>
+  8009ff:	38 02                	cmp    %al,(%edx)
+  800a01:	75 0d                	jne    800a10 <strcmp+0x21>
+  800a03:	83 c1 01             	add    $0x1,%ecx
+  800a06:	83 c2 01             	add    $0x1,%edx
+  800a09:	0f b6 01             	movzbl (%ecx),%eax
+  800a0c:	84 c0                	test   %al,%al
+  800a0e:	75 ef                	jne    8009ff <strcmp+0x10>
+  800a10:	0f b6 c0             	movzbl %al,%eax
+  800a13:	0f b6 12             	movzbl (%edx),%edx
+  800a16:	29 d0                	sub    %edx,%eax
+  800a18:	5d                   	pop    %ebp
+  800a19:	c3                   	ret
+
+00800a1a <strncmp>:
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	53                   	push   %ebx
+  800a1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a24:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2c:	85 d2                	test   %edx,%edx
+  800a2e:	74 2e                	je     800a5e <strncmp+0x44>
+  800a30:	0f b6 01             	movzbl (%ecx),%eax
+  800a33:	84 c0                	test   %al,%al
+  800a35:	74 16                	je     800a4d <strncmp+0x33>
+  800a37:	3a 03                	cmp    (%ebx),%al
+  800a39:	75 12                	jne    800a4d <strncmp+0x33>
+  800a3b:	83 c1 01             	add    $0x1,%ecx
+  800a3e:	83 c3 01             	add    $0x1,%ebx
+  800a41:	83 ea 01             	sub    $0x1,%edx
+  800a44:	75 ea                	jne    800a30 <strncmp+0x16>
+  800a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4b:	eb 11                	jmp    800a5e <strncmp+0x44>
+  800a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a52:	85 d2                	test   %edx,%edx
+  800a54:	74 08                	je     800a5e <strncmp+0x44>
+  800a56:	0f b6 01             	movzbl (%ecx),%eax
+  800a59:	0f b6 13             	movzbl (%ebx),%edx
+  800a5c:	29 d0                	sub    %edx,%eax
+  800a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a61:	c9                   	leave
+  800a62:	c3                   	ret
+
+00800a63 <strchr>:
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a69:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a6d:	0f b6 10             	movzbl (%eax),%edx
+  800a70:	84 d2                	test   %dl,%dl
+  800a72:	74 15                	je     800a89 <strchr+0x26>
+  800a74:	38 d1                	cmp    %dl,%cl
+  800a76:	74 0f                	je     800a87 <strchr+0x24>
+  800a78:	83 c0 01             	add    $0x1,%eax
+  800a7b:	0f b6 10             	movzbl (%eax),%edx
+  800a7e:	84 d2                	test   %dl,%dl
+  800a80:	75 f2                	jne    800a74 <strchr+0x11>
+  800a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a87:	5d                   	pop    %ebp
+  800a88:	c3                   	ret
+  800a89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8e:	eb f7                	jmp    800a87 <strchr+0x24>
+
+00800a90 <strfind>:
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	53                   	push   %ebx
+  800a94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a9a:	0f b6 18             	movzbl (%eax),%ebx
+  800a9d:	38 d3                	cmp    %dl,%bl
+  800a9f:	74 14                	je     800ab5 <strfind+0x25>
+  800aa1:	89 d1                	mov    %edx,%ecx
+  800aa3:	84 db                	test   %bl,%bl
+  800aa5:	74 0e                	je     800ab5 <strfind+0x25>
+  800aa7:	83 c0 01             	add    $0x1,%eax
+  800aaa:	0f b6 10             	movzbl (%eax),%edx
+  800aad:	38 ca                	cmp    %cl,%dl
+  800aaf:	74 04                	je     800ab5 <strfind+0x25>
+  800ab1:	84 d2                	test   %dl,%dl
+  800ab3:	75 f2                	jne    800aa7 <strfind+0x17>
+  800ab5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab8:	c9                   	leave
+  800ab9:	c3                   	ret
+
+00800aba <memset>:
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	57                   	push   %edi
+  800abe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ac4:	85 c9                	test   %ecx,%ecx
+  800ac6:	74 20                	je     800ae8 <memset+0x2e>
+  800ac8:	89 f8                	mov    %edi,%eax
+  800aca:	09 c8                	or     %ecx,%eax
+  800acc:	a8 03                	test   $0x3,%al
+  800ace:	75 12                	jne    800ae2 <memset+0x28>
+  800ad0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ad4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ada:	c1 e9 02             	shr    $0x2,%ecx
+  800add:	fc                   	cld
+  800ade:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ae0:	eb 06                	jmp    800ae8 <memset+0x2e>
+  800ae2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae5:	fc                   	cld
+  800ae6:	f3 aa                	rep stos %al,%es:(%edi)
+  800ae8:	89 f8                	mov    %edi,%eax
+  800aea:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aed:	c9                   	leave
+  800aee:	c3                   	ret
+
+00800aef <memmove>:
+  800aef:	55                   	push   %ebp
+  800af0:	89 e5                	mov    %esp,%ebp
+  800af2:	57                   	push   %edi
+  800af3:	56                   	push   %esi
+  800af4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800afa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800afd:	39 c6                	cmp    %eax,%esi
+  800aff:	73 32                	jae    800b33 <memmove+0x44>
+  800b01:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b04:	39 d0                	cmp    %edx,%eax
+  800b06:	73 2b                	jae    800b33 <memmove+0x44>
+  800b08:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800b0b:	89 d6                	mov    %edx,%esi
+  800b0d:	09 fe                	or     %edi,%esi
+  800b0f:	09 ce                	or     %ecx,%esi
+  800b11:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b17:	75 0e                	jne    800b27 <memmove+0x38>
+  800b19:	83 ef 04             	sub    $0x4,%edi
+  800b1c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b1f:	c1 e9 02             	shr    $0x2,%ecx
+  800b22:	fd                   	std
+  800b23:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b25:	eb 09                	jmp    800b30 <memmove+0x41>
+  800b27:	83 ef 01             	sub    $0x1,%edi
+  800b2a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b2d:	fd                   	std
+  800b2e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b30:	fc                   	cld
+  800b31:	eb 1a                	jmp    800b4d <memmove+0x5e>
+  800b33:	89 f2                	mov    %esi,%edx
+  800b35:	09 c2                	or     %eax,%edx
+  800b37:	09 ca                	or     %ecx,%edx
+  800b39:	f6 c2 03             	test   $0x3,%dl
+  800b3c:	75 0a                	jne    800b48 <memmove+0x59>
+  800b3e:	c1 e9 02             	shr    $0x2,%ecx
+  800b41:	89 c7                	mov    %eax,%edi
+  800b43:	fc                   	cld
+  800b44:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b46:	eb 05                	jmp    800b4d <memmove+0x5e>
+  800b48:	89 c7                	mov    %eax,%edi
+  800b4a:	fc                   	cld
+  800b4b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b4d:	5e                   	pop    %esi
+  800b4e:	5f                   	pop    %edi
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+
+00800b51 <memcpy>:
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	83 ec 0c             	sub    $0xc,%esp
+  800b57:	ff 75 10             	push   0x10(%ebp)
+  800b5a:	ff 75 0c             	push   0xc(%ebp)
+  800b5d:	ff 75 08             	push   0x8(%ebp)
+  800b60:	e8 8a ff ff ff       	call   800aef <memmove>
+  800b65:	c9                   	leave
+  800b66:	c3                   	ret
+
+00800b67 <memcmp>:
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	56                   	push   %esi
+  800b6b:	53                   	push   %ebx
+  800b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b72:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b75:	85 f6                	test   %esi,%esi
+  800b77:	74 29                	je     800ba2 <memcmp+0x3b>
+  800b79:	01 c6                	add    %eax,%esi
+  800b7b:	0f b6 08             	movzbl (%eax),%ecx
+  800b7e:	0f b6 1a             	movzbl (%edx),%ebx
+  800b81:	38 d9                	cmp    %bl,%cl
+  800b83:	75 11                	jne    800b96 <memcmp+0x2f>
+  800b85:	83 c0 01             	add    $0x1,%eax
+  800b88:	83 c2 01             	add    $0x1,%edx
+  800b8b:	39 c6                	cmp    %eax,%esi
+  800b8d:	75 ec                	jne    800b7b <memcmp+0x14>
+  800b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b94:	eb 08                	jmp    800b9e <memcmp+0x37>
+  800b96:	0f b6 c1             	movzbl %cl,%eax
+  800b99:	0f b6 db             	movzbl %bl,%ebx
+  800b9c:	29 d8                	sub    %ebx,%eax
+  800b9e:	5b                   	pop    %ebx
+  800b9f:	5e                   	pop    %esi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+  800ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba7:	eb f5                	jmp    800b9e <memcmp+0x37>
+
+00800ba9 <memfind>:
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	03 55 10             	add    0x10(%ebp),%edx
+  800bb7:	39 d0                	cmp    %edx,%eax
+  800bb9:	73 0d                	jae    800bc8 <memfind+0x1f>
+  800bbb:	38 08                	cmp    %cl,(%eax)
+  800bbd:	74 0d                	je     800bcc <memfind+0x23>
+  800bbf:	83 c0 01             	add    $0x1,%eax
+  800bc2:	39 c2                	cmp    %eax,%edx
+  800bc4:	75 f5                	jne    800bbb <memfind+0x12>
+  800bc6:	eb 06                	jmp    800bce <memfind+0x25>
+  800bc8:	89 c2                	mov    %eax,%edx
+  800bca:	eb 02                	jmp    800bce <memfind+0x25>
+  800bcc:	89 c2                	mov    %eax,%edx
+  800bce:	89 d0                	mov    %edx,%eax
+  800bd0:	5d                   	pop    %ebp
+  800bd1:	c3                   	ret
+
+00800bd2 <strtol>:
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	57                   	push   %edi
+  800bd6:	56                   	push   %esi
+  800bd7:	53                   	push   %ebx
+  800bd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bde:	0f b6 02             	movzbl (%edx),%eax
+  800be1:	3c 20                	cmp    $0x20,%al
+  800be3:	74 04                	je     800be9 <strtol+0x17>
+  800be5:	3c 09                	cmp    $0x9,%al
+  800be7:	75 0e                	jne    800bf7 <strtol+0x25>
+  800be9:	83 c2 01             	add    $0x1,%edx
+  800bec:	0f b6 02             	movzbl (%edx),%eax
+  800bef:	3c 20                	cmp    $0x20,%al
+  800bf1:	74 f6                	je     800be9 <strtol+0x17>
+  800bf3:	3c 09                	cmp    $0x9,%al
+  800bf5:	74 f2                	je     800be9 <strtol+0x17>
+  800bf7:	3c 2b                	cmp    $0x2b,%al
+  800bf9:	74 2a                	je     800c25 <strtol+0x53>
+  800bfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c00:	3c 2d                	cmp    $0x2d,%al
+  800c02:	74 2b                	je     800c2f <strtol+0x5d>
+  800c04:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c0a:	75 0f                	jne    800c1b <strtol+0x49>
+  800c0c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c0f:	74 28                	je     800c39 <strtol+0x67>
+  800c11:	85 db                	test   %ebx,%ebx
+  800c13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c18:	0f 44 d8             	cmove  %eax,%ebx
+  800c1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c20:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c23:	eb 46                	jmp    800c6b <strtol+0x99>
+  800c25:	83 c2 01             	add    $0x1,%edx
+  800c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c2d:	eb d5                	jmp    800c04 <strtol+0x32>
+  800c2f:	83 c2 01             	add    $0x1,%edx
+  800c32:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c37:	eb cb                	jmp    800c04 <strtol+0x32>
+  800c39:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c3d:	74 0e                	je     800c4d <strtol+0x7b>
+  800c3f:	85 db                	test   %ebx,%ebx
+  800c41:	75 d8                	jne    800c1b <strtol+0x49>
+  800c43:	83 c2 01             	add    $0x1,%edx
+  800c46:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c4b:	eb ce                	jmp    800c1b <strtol+0x49>
+  800c4d:	83 c2 02             	add    $0x2,%edx
+  800c50:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c55:	eb c4                	jmp    800c1b <strtol+0x49>
+  800c57:	0f be c0             	movsbl %al,%eax
+  800c5a:	83 e8 30             	sub    $0x30,%eax
+  800c5d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c60:	7d 3a                	jge    800c9c <strtol+0xca>
+  800c62:	83 c2 01             	add    $0x1,%edx
+  800c65:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c69:	01 c1                	add    %eax,%ecx
+  800c6b:	0f b6 02             	movzbl (%edx),%eax
+  800c6e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c71:	89 f3                	mov    %esi,%ebx
+  800c73:	80 fb 09             	cmp    $0x9,%bl
+  800c76:	76 df                	jbe    800c57 <strtol+0x85>
+  800c78:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c7b:	89 f3                	mov    %esi,%ebx
+  800c7d:	80 fb 19             	cmp    $0x19,%bl
+  800c80:	77 08                	ja     800c8a <strtol+0xb8>
+  800c82:	0f be c0             	movsbl %al,%eax
+  800c85:	83 e8 57             	sub    $0x57,%eax
+  800c88:	eb d3                	jmp    800c5d <strtol+0x8b>
+  800c8a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c8d:	89 f3                	mov    %esi,%ebx
+  800c8f:	80 fb 19             	cmp    $0x19,%bl
+  800c92:	77 08                	ja     800c9c <strtol+0xca>
+  800c94:	0f be c0             	movsbl %al,%eax
+  800c97:	83 e8 37             	sub    $0x37,%eax
+  800c9a:	eb c1                	jmp    800c5d <strtol+0x8b>
+  800c9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ca0:	74 05                	je     800ca7 <strtol+0xd5>
+  800ca2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ca5:	89 10                	mov    %edx,(%eax)
+  800ca7:	89 c8                	mov    %ecx,%eax
+  800ca9:	f7 d8                	neg    %eax
+  800cab:	85 ff                	test   %edi,%edi
+  800cad:	0f 45 c8             	cmovne %eax,%ecx
+  800cb0:	89 c8                	mov    %ecx,%eax
+  800cb2:	5b                   	pop    %ebx
+  800cb3:	5e                   	pop    %esi
+  800cb4:	5f                   	pop    %edi
+  800cb5:	5d                   	pop    %ebp
+  800cb6:	c3                   	ret
+
+00800cb7 <sys_cputs>:
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	57                   	push   %edi
+  800cbb:	56                   	push   %esi
+  800cbc:	53                   	push   %ebx
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc8:	89 c3                	mov    %eax,%ebx
+  800cca:	89 c7                	mov    %eax,%edi
+  800ccc:	89 c6                	mov    %eax,%esi
+  800cce:	cd 30                	int    $0x30
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5e                   	pop    %esi
+  800cd2:	5f                   	pop    %edi
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+
+00800cd5 <sys_cgetc>:
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  800cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ce5:	89 d1                	mov    %edx,%ecx
+  800ce7:	89 d3                	mov    %edx,%ebx
+  800ce9:	89 d7                	mov    %edx,%edi
+  800ceb:	89 d6                	mov    %edx,%esi
+  800ced:	cd 30                	int    $0x30
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+
+00800cf4 <sys_env_destroy>:
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+  800cfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d05:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d0a:	89 cb                	mov    %ecx,%ebx
+  800d0c:	89 cf                	mov    %ecx,%edi
+  800d0e:	89 ce                	mov    %ecx,%esi
+  800d10:	cd 30                	int    $0x30
+  800d12:	85 c0                	test   %eax,%eax
+  800d14:	7f 08                	jg     800d1e <sys_env_destroy+0x2a>
+  800d16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+  800d1e:	83 ec 0c             	sub    $0xc,%esp
+  800d21:	50                   	push   %eax
+  800d22:	6a 03                	push   $0x3
+  800d24:	68 6b 3b 80 00       	push   $0x803b6b
+  800d29:	6a 24                	push   $0x24
+  800d2b:	68 88 3b 80 00       	push   $0x803b88
+  800d30:	e8 38 f4 ff ff       	call   80016d <_panic>
+
+00800d35 <sys_getenvid>:
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	57                   	push   %edi
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d40:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d45:	89 d1                	mov    %edx,%ecx
+  800d47:	89 d3                	mov    %edx,%ebx
+  800d49:	89 d7                	mov    %edx,%edi
+  800d4b:	89 d6                	mov    %edx,%esi
+  800d4d:	cd 30                	int    $0x30
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5f                   	pop    %edi
+  800d52:	5d                   	pop    %ebp
+  800d53:	c3                   	ret
+
+00800d54 <sys_yield>:
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	57                   	push   %edi
+  800d58:	56                   	push   %esi
+  800d59:	53                   	push   %ebx
+  800d5a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d61:	74 26                	je     800d89 <sys_yield+0x35>
+  800d63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d68:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d6d:	89 d1                	mov    %edx,%ecx
+  800d6f:	89 d3                	mov    %edx,%ebx
+  800d71:	89 d7                	mov    %edx,%edi
+  800d73:	6a 00                	push   $0x0
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	8d 35 80 0d 80 00    	lea    0x800d80,%esi
+  800d7e:	0f 34                	sysenter
+  800d80:	5d                   	pop    %ebp
+  800d81:	83 c4 04             	add    $0x4,%esp
+  800d84:	5b                   	pop    %ebx
+  800d85:	5e                   	pop    %esi
+  800d86:	5f                   	pop    %edi
+  800d87:	5d                   	pop    %ebp
+  800d88:	c3                   	ret
+  800d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d93:	89 d1                	mov    %edx,%ecx
+  800d95:	89 d3                	mov    %edx,%ebx
+  800d97:	89 d7                	mov    %edx,%edi
+  800d99:	89 d6                	mov    %edx,%esi
+  800d9b:	cd 30                	int    $0x30
+  800d9d:	eb e5                	jmp    800d84 <sys_yield+0x30>
+
+00800d9f <sys_page_alloc>:
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  800da8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbb:	89 f7                	mov    %esi,%edi
+  800dbd:	cd 30                	int    $0x30
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	7f 08                	jg     800dcb <sys_page_alloc+0x2c>
+  800dc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+  800dce:	50                   	push   %eax
+  800dcf:	6a 04                	push   $0x4
+  800dd1:	68 6b 3b 80 00       	push   $0x803b6b
+  800dd6:	6a 24                	push   $0x24
+  800dd8:	68 88 3b 80 00       	push   $0x803b88
+  800ddd:	e8 8b f3 ff ff       	call   80016d <_panic>
+
+00800de2 <sys_page_map>:
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+  800deb:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800df2:	74 33                	je     800e27 <sys_page_map+0x45>
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e02:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e05:	ff 75 18             	push   0x18(%ebp)
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	8d 35 13 0e 80 00    	lea    0x800e13,%esi
+  800e11:	0f 34                	sysenter
+  800e13:	5d                   	pop    %ebp
+  800e14:	83 c4 04             	add    $0x4,%esp
+  800e17:	89 c2                	mov    %eax,%edx
+  800e19:	85 c0                	test   %eax,%eax
+  800e1b:	7f 3d                	jg     800e5a <sys_page_map+0x78>
+  800e1d:	89 d0                	mov    %edx,%eax
+  800e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+  800e27:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e35:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e38:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e3b:	cd 30                	int    $0x30
+  800e3d:	89 c2                	mov    %eax,%edx
+  800e3f:	85 c0                	test   %eax,%eax
+  800e41:	7e da                	jle    800e1d <sys_page_map+0x3b>
+  800e43:	83 ec 0c             	sub    $0xc,%esp
+  800e46:	50                   	push   %eax
+  800e47:	6a 05                	push   $0x5
+  800e49:	68 6b 3b 80 00       	push   $0x803b6b
+  800e4e:	6a 24                	push   $0x24
+  800e50:	68 88 3b 80 00       	push   $0x803b88
+  800e55:	e8 13 f3 ff ff       	call   80016d <_panic>
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	50                   	push   %eax
+  800e5e:	6a 05                	push   $0x5
+  800e60:	68 6b 3b 80 00       	push   $0x803b6b
+  800e65:	6a 48                	push   $0x48
+  800e67:	68 88 3b 80 00       	push   $0x803b88
+  800e6c:	e8 fc f2 ff ff       	call   80016d <_panic>
+
+00800e71 <sys_page_unmap>:
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+  800e7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e85:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e8a:	89 df                	mov    %ebx,%edi
+  800e8c:	89 de                	mov    %ebx,%esi
+  800e8e:	cd 30                	int    $0x30
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	7f 08                	jg     800e9c <sys_page_unmap+0x2b>
+  800e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+  800e9f:	50                   	push   %eax
+  800ea0:	6a 06                	push   $0x6
+  800ea2:	68 6b 3b 80 00       	push   $0x803b6b
+  800ea7:	6a 24                	push   $0x24
+  800ea9:	68 88 3b 80 00       	push   $0x803b88
+  800eae:	e8 ba f2 ff ff       	call   80016d <_panic>
+
+00800eb3 <sys_fork>:
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+  800eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebe:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800ec3:	89 d1                	mov    %edx,%ecx
+  800ec5:	89 d3                	mov    %edx,%ebx
+  800ec7:	89 d7                	mov    %edx,%edi
+  800ec9:	89 d6                	mov    %edx,%esi
+  800ecb:	cd 30                	int    $0x30
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+
+00800ed2 <sys_env_set_status>:
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	57                   	push   %edi
+  800ed6:	56                   	push   %esi
+  800ed7:	53                   	push   %ebx
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eeb:	89 df                	mov    %ebx,%edi
+  800eed:	89 de                	mov    %ebx,%esi
+  800eef:	cd 30                	int    $0x30
+  800ef1:	85 c0                	test   %eax,%eax
+  800ef3:	7f 08                	jg     800efd <sys_env_set_status+0x2b>
+  800ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	50                   	push   %eax
+  800f01:	6a 08                	push   $0x8
+  800f03:	68 6b 3b 80 00       	push   $0x803b6b
+  800f08:	6a 24                	push   $0x24
+  800f0a:	68 88 3b 80 00       	push   $0x803b88
+  800f0f:	e8 59 f2 ff ff       	call   80016d <_panic>
+
+00800f14 <sys_env_set_trapframe>:
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	56                   	push   %esi
+  800f19:	53                   	push   %ebx
+  800f1a:	83 ec 0c             	sub    $0xc,%esp
+  800f1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f28:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f2d:	89 df                	mov    %ebx,%edi
+  800f2f:	89 de                	mov    %ebx,%esi
+  800f31:	cd 30                	int    $0x30
+  800f33:	85 c0                	test   %eax,%eax
+  800f35:	7f 08                	jg     800f3f <sys_env_set_trapframe+0x2b>
+  800f37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  800f42:	50                   	push   %eax
+  800f43:	6a 09                	push   $0x9
+  800f45:	68 6b 3b 80 00       	push   $0x803b6b
+  800f4a:	6a 24                	push   $0x24
+  800f4c:	68 88 3b 80 00       	push   $0x803b88
+  800f51:	e8 17 f2 ff ff       	call   80016d <_panic>
+
+00800f56 <sys_env_set_cow>:
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+  800f5c:	83 ec 0c             	sub    $0xc,%esp
+  800f5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6a:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f6f:	89 df                	mov    %ebx,%edi
+  800f71:	89 de                	mov    %ebx,%esi
+  800f73:	cd 30                	int    $0x30
+  800f75:	85 c0                	test   %eax,%eax
+  800f77:	7f 08                	jg     800f81 <sys_env_set_cow+0x2b>
+  800f79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+  800f84:	50                   	push   %eax
+  800f85:	6a 20                	push   $0x20
+  800f87:	68 6b 3b 80 00       	push   $0x803b6b
+  800f8c:	6a 24                	push   $0x24
+  800f8e:	68 88 3b 80 00       	push   $0x803b88
+  800f93:	e8 d5 f1 ff ff       	call   80016d <_panic>
+
+00800f98 <sys_env_service>:
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  800f9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa6:	b8 21 00 00 00       	mov    $0x21,%eax
+  800fab:	89 cb                	mov    %ecx,%ebx
+  800fad:	89 cf                	mov    %ecx,%edi
+  800faf:	89 ce                	mov    %ecx,%esi
+  800fb1:	cd 30                	int    $0x30
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+
+00800fb8 <sys_env_set_pgfault_upcall>:
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  800fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd1:	89 df                	mov    %ebx,%edi
+  800fd3:	89 de                	mov    %ebx,%esi
+  800fd5:	cd 30                	int    $0x30
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	7f 08                	jg     800fe3 <sys_env_set_pgfault_upcall+0x2b>
+  800fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 0a                	push   $0xa
+  800fe9:	68 6b 3b 80 00       	push   $0x803b6b
+  800fee:	6a 24                	push   $0x24
+  800ff0:	68 88 3b 80 00       	push   $0x803b88
+  800ff5:	e8 73 f1 ff ff       	call   80016d <_panic>
+
+00800ffa <sys_ipc_try_send>:
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+  801000:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801007:	74 27                	je     801030 <sys_ipc_try_send+0x36>
+  801009:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801014:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801017:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101a:	6a 00                	push   $0x0
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	8d 35 27 10 80 00    	lea    0x801027,%esi
+  801025:	0f 34                	sysenter
+  801027:	5d                   	pop    %ebp
+  801028:	83 c4 04             	add    $0x4,%esp
+  80102b:	5b                   	pop    %ebx
+  80102c:	5e                   	pop    %esi
+  80102d:	5f                   	pop    %edi
+  80102e:	5d                   	pop    %ebp
+  80102f:	c3                   	ret
+  801030:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801035:	be 00 00 00 00       	mov    $0x0,%esi
+  80103a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801046:	cd 30                	int    $0x30
+  801048:	eb e1                	jmp    80102b <sys_ipc_try_send+0x31>
+
+0080104a <sys_ipc_recv>:
+  80104a:	55                   	push   %ebp
+  80104b:	89 e5                	mov    %esp,%ebp
+  80104d:	57                   	push   %edi
+  80104e:	56                   	push   %esi
+  80104f:	53                   	push   %ebx
+  801050:	83 ec 0c             	sub    $0xc,%esp
+  801053:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80105a:	74 32                	je     80108e <sys_ipc_recv+0x44>
+  80105c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801064:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801069:	89 cb                	mov    %ecx,%ebx
+  80106b:	89 cf                	mov    %ecx,%edi
+  80106d:	6a 00                	push   $0x0
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	8d 35 7a 10 80 00    	lea    0x80107a,%esi
+  801078:	0f 34                	sysenter
+  80107a:	5d                   	pop    %ebp
+  80107b:	83 c4 04             	add    $0x4,%esp
+  80107e:	89 c2                	mov    %eax,%edx
+  801080:	85 c0                	test   %eax,%eax
+  801082:	7f 3c                	jg     8010c0 <sys_ipc_recv+0x76>
+  801084:	89 d0                	mov    %edx,%eax
+  801086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+  80108e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801093:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	89 cb                	mov    %ecx,%ebx
+  80109d:	89 cf                	mov    %ecx,%edi
+  80109f:	89 ce                	mov    %ecx,%esi
+  8010a1:	cd 30                	int    $0x30
+  8010a3:	89 c2                	mov    %eax,%edx
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	7e db                	jle    801084 <sys_ipc_recv+0x3a>
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 0d                	push   $0xd
+  8010af:	68 6b 3b 80 00       	push   $0x803b6b
+  8010b4:	6a 24                	push   $0x24
+  8010b6:	68 88 3b 80 00       	push   $0x803b88
+  8010bb:	e8 ad f0 ff ff       	call   80016d <_panic>
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+  8010c3:	50                   	push   %eax
+  8010c4:	6a 0d                	push   $0xd
+  8010c6:	68 6b 3b 80 00       	push   $0x803b6b
+  8010cb:	6a 48                	push   $0x48
+  8010cd:	68 88 3b 80 00       	push   $0x803b88
+  8010d2:	e8 96 f0 ff ff       	call   80016d <_panic>
+
+008010d7 <sys_ipc_send>:
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+  8010dd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010e4:	74 27                	je     80110d <sys_ipc_send+0x36>
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f7:	6a 00                	push   $0x0
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+  801104:	5d                   	pop    %ebp
+  801105:	83 c4 04             	add    $0x4,%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+  80110d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801120:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801123:	cd 30                	int    $0x30
+  801125:	eb e1                	jmp    801108 <sys_ipc_send+0x31>
+
+00801127 <sys_ipc_call>:
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	57                   	push   %edi
+  80112b:	56                   	push   %esi
+  80112c:	53                   	push   %ebx
+  80112d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801130:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801133:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801138:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801141:	cd 30                	int    $0x30
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_ipc_reply_recv>:
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	b8 10 00 00 00       	mov    $0x10,%eax
+  801159:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80115f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801162:	cd 30                	int    $0x30
+  801164:	5b                   	pop    %ebx
+  801165:	5e                   	pop    %esi
+  801166:	5f                   	pop    %edi
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+
+00801169 <sys_time_msec>:
+  801169:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	75 06                	jne    801178 <sys_time_msec+0xf>
+  801172:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801177:	c3                   	ret
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+  801181:	0f 31                	rdtsc
+  801183:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801189:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80118f:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801195:	29 c8                	sub    %ecx,%eax
+  801197:	19 da                	sbb    %ebx,%edx
+  801199:	bf 00 00 00 00       	mov    $0x0,%edi
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	52                   	push   %edx
+  8011a1:	50                   	push   %eax
+  8011a2:	e8 1f 25 00 00       	call   8036c6 <__udivdi3>
+  8011a7:	83 c4 10             	add    $0x10,%esp
+  8011aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+
+008011b2 <sys_env_swap>:
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+  8011b8:	83 ec 0c             	sub    $0xc,%esp
+  8011bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011c8:	89 cb                	mov    %ecx,%ebx
+  8011ca:	89 cf                	mov    %ecx,%edi
+  8011cc:	89 ce                	mov    %ecx,%esi
+  8011ce:	cd 30                	int    $0x30
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	7f 08                	jg     8011dc <sys_env_swap+0x2a>
+  8011d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+  8011dc:	83 ec 0c             	sub    $0xc,%esp
+  8011df:	50                   	push   %eax
+  8011e0:	6a 12                	push   $0x12
+  8011e2:	68 6b 3b 80 00       	push   $0x803b6b
+  8011e7:	6a 24                	push   $0x24
+  8011e9:	68 88 3b 80 00       	push   $0x803b88
+  8011ee:	e8 7a ef ff ff       	call   80016d <_panic>
+
+008011f3 <sys_net_try_send>:
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	57                   	push   %edi
+  8011f7:	56                   	push   %esi
+  8011f8:	53                   	push   %ebx
+  8011f9:	83 ec 0c             	sub    $0xc,%esp
+  8011fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801201:	8b 55 08             	mov    0x8(%ebp),%edx
+  801204:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801207:	b8 13 00 00 00       	mov    $0x13,%eax
+  80120c:	89 df                	mov    %ebx,%edi
+  80120e:	89 de                	mov    %ebx,%esi
+  801210:	cd 30                	int    $0x30
+  801212:	85 c0                	test   %eax,%eax
+  801214:	7f 08                	jg     80121e <sys_net_try_send+0x2b>
+  801216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801219:	5b                   	pop    %ebx
+  80121a:	5e                   	pop    %esi
+  80121b:	5f                   	pop    %edi
+  80121c:	5d                   	pop    %ebp
+  80121d:	c3                   	ret
+  80121e:	83 ec 0c             	sub    $0xc,%esp
+  801221:	50                   	push   %eax
+  801222:	6a 13                	push   $0x13
+  801224:	68 6b 3b 80 00       	push   $0x803b6b
+  801229:	6a 24                	push   $0x24
+  80122b:	68 88 3b 80 00       	push   $0x803b88
+  801230:	e8 38 ef ff ff       	call   80016d <_panic>
+
+00801235 <sys_net_try_receive>:
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+  80123b:	83 ec 0c             	sub    $0xc,%esp
+  80123e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+  801246:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801249:	b8 14 00 00 00       	mov    $0x14,%eax
+  80124e:	89 df                	mov    %ebx,%edi
+  801250:	89 de                	mov    %ebx,%esi
+  801252:	cd 30                	int    $0x30
+  801254:	85 c0                	test   %eax,%eax
+  801256:	7f 08                	jg     801260 <sys_net_try_receive+0x2b>
+  801258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125b:	5b                   	pop    %ebx
+  80125c:	5e                   	pop    %esi
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+  801260:	83 ec 0c             	sub    $0xc,%esp
+  801263:	50                   	push   %eax
+  801264:	6a 14                	push   $0x14
+  801266:	68 6b 3b 80 00       	push   $0x803b6b
+  80126b:	6a 24                	push   $0x24
+  80126d:	68 88 3b 80 00       	push   $0x803b88
+  801272:	e8 f6 ee ff ff       	call   80016d <_panic>
+
+00801277 <sys_net_recv_page>:
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	57                   	push   %edi
+  80127b:	56                   	push   %esi
+  80127c:	53                   	push   %ebx
+  80127d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801282:	8b 55 08             	mov    0x8(%ebp),%edx
+  801285:	b8 27 00 00 00       	mov    $0x27,%eax
+  80128a:	89 cb                	mov    %ecx,%ebx
+  80128c:	89 cf                	mov    %ecx,%edi
+  80128e:	89 ce                	mov    %ecx,%esi
+  801290:	cd 30                	int    $0x30
+  801292:	5b                   	pop    %ebx
+  801293:	5e                   	pop    %esi
+  801294:	5f                   	pop    %edi
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+
+00801297 <sys_net_wait>:
+  801297:	55                   	push   %ebp
+  801298:	89 e5                	mov    %esp,%ebp
+  80129a:	57                   	push   %edi
+  80129b:	56                   	push   %esi
+  80129c:	53                   	push   %ebx
+  80129d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a2:	b8 26 00 00 00       	mov    $0x26,%eax
+  8012a7:	89 d1                	mov    %edx,%ecx
+  8012a9:	89 d3                	mov    %edx,%ebx
+  8012ab:	89 d7                	mov    %edx,%edi
+  8012ad:	89 d6                	mov    %edx,%esi
+  8012af:	cd 30                	int    $0x30
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5f                   	pop    %edi
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	c3                   	ret
+
+008012b6 <sys_get_mac>:
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	57                   	push   %edi
+  8012ba:	56                   	push   %esi
+  8012bb:	53                   	push   %ebx
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+  8012bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ca:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012cf:	89 df                	mov    %ebx,%edi
+  8012d1:	89 de                	mov    %ebx,%esi
+  8012d3:	cd 30                	int    $0x30
+  8012d5:	85 c0                	test   %eax,%eax
+  8012d7:	7f 08                	jg     8012e1 <sys_get_mac+0x2b>
+  8012d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012dc:	5b                   	pop    %ebx
+  8012dd:	5e                   	pop    %esi
+  8012de:	5f                   	pop    %edi
+  8012df:	5d                   	pop    %ebp
+  8012e0:	c3                   	ret
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	50                   	push   %eax
+  8012e5:	6a 15                	push   $0x15
+  8012e7:	68 6b 3b 80 00       	push   $0x803b6b
+  8012ec:	6a 24                	push   $0x24
+  8012ee:	68 88 3b 80 00       	push   $0x803b88
+  8012f3:	e8 75 ee ff ff       	call   80016d <_panic>
+
+008012f8 <sys_env_lease>:
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+  8012fe:	83 ec 0c             	sub    $0xc,%esp
+  801301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801306:	8b 55 08             	mov    0x8(%ebp),%edx
+  801309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801311:	89 df                	mov    %ebx,%edi
+  801313:	89 de                	mov    %ebx,%esi
+  801315:	cd 30                	int    $0x30
+  801317:	85 c0                	test   %eax,%eax
+  801319:	7f 08                	jg     801323 <sys_env_lease+0x2b>
+  80131b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131e:	5b                   	pop    %ebx
+  80131f:	5e                   	pop    %esi
+  801320:	5f                   	pop    %edi
+  801321:	5d                   	pop    %ebp
+  801322:	c3                   	ret
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	50                   	push   %eax
+  801327:	6a 16                	push   $0x16
+  801329:	68 6b 3b 80 00       	push   $0x803b6b
+  80132e:	6a 24                	push   $0x24
+  801330:	68 88 3b 80 00       	push   $0x803b88
+  801335:	e8 33 ee ff ff       	call   80016d <_panic>
+
+0080133a <sys_copy_mem>:
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 0c             	sub    $0xc,%esp
+  801343:	8b 55 08             	mov    0x8(%ebp),%edx
+  801346:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801349:	b8 17 00 00 00       	mov    $0x17,%eax
+  80134e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801351:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801354:	8b 75 18             	mov    0x18(%ebp),%esi
+  801357:	cd 30                	int    $0x30
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	7f 08                	jg     801365 <sys_copy_mem+0x2b>
+  80135d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801360:	5b                   	pop    %ebx
+  801361:	5e                   	pop    %esi
+  801362:	5f                   	pop    %edi
+  801363:	5d                   	pop    %ebp
+  801364:	c3                   	ret
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	50                   	push   %eax
+  801369:	6a 17                	push   $0x17
+  80136b:	68 6b 3b 80 00       	push   $0x803b6b
+  801370:	6a 24                	push   $0x24
+  801372:	68 88 3b 80 00       	push   $0x803b88
+  801377:	e8 f1 ed ff ff       	call   80016d <_panic>
+
+0080137c <sys_get_perms>:
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	57                   	push   %edi
+  801380:	56                   	push   %esi
+  801381:	53                   	push   %ebx
+  801382:	83 ec 0c             	sub    $0xc,%esp
+  801385:	be 00 00 00 00       	mov    $0x0,%esi
+  80138a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801390:	b8 18 00 00 00       	mov    $0x18,%eax
+  801395:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801398:	89 f7                	mov    %esi,%edi
+  80139a:	cd 30                	int    $0x30
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	7f 08                	jg     8013a8 <sys_get_perms+0x2c>
+  8013a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5f                   	pop    %edi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	50                   	push   %eax
+  8013ac:	6a 18                	push   $0x18
+  8013ae:	68 6b 3b 80 00       	push   $0x803b6b
+  8013b3:	6a 24                	push   $0x24
+  8013b5:	68 88 3b 80 00       	push   $0x803b88
+  8013ba:	e8 ae ed ff ff       	call   80016d <_panic>
+
+008013bf <sys_env_unsuspend>:
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	57                   	push   %edi
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  8013c5:	83 ec 0c             	sub    $0xc,%esp
+  8013c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d3:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013db:	89 f7                	mov    %esi,%edi
+  8013dd:	cd 30                	int    $0x30
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	7f 08                	jg     8013eb <sys_env_unsuspend+0x2c>
+  8013e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e6:	5b                   	pop    %ebx
+  8013e7:	5e                   	pop    %esi
+  8013e8:	5f                   	pop    %edi
+  8013e9:	5d                   	pop    %ebp
+  8013ea:	c3                   	ret
+  8013eb:	83 ec 0c             	sub    $0xc,%esp
+  8013ee:	50                   	push   %eax
+  8013ef:	6a 19                	push   $0x19
+  8013f1:	68 6b 3b 80 00       	push   $0x803b6b
+  8013f6:	6a 24                	push   $0x24
+  8013f8:	68 88 3b 80 00       	push   $0x803b88
+  8013fd:	e8 6b ed ff ff       	call   80016d <_panic>
+
+00801402 <sys_migrate>:
+  801402:	55                   	push   %ebp
+  801403:	89 e5                	mov    %esp,%ebp
+  801405:	57                   	push   %edi
+  801406:	56                   	push   %esi
+  801407:	53                   	push   %ebx
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	ba 04 80 80 00       	mov    $0x808004,%edx
+  801410:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801416:	76 11                	jbe    801429 <sys_migrate+0x27>
+  801418:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80141d:	0f b6 08             	movzbl (%eax),%ecx
+  801420:	05 00 10 00 00       	add    $0x1000,%eax
+  801425:	39 d0                	cmp    %edx,%eax
+  801427:	72 f4                	jb     80141d <sys_migrate+0x1b>
+  801429:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801436:	89 cb                	mov    %ecx,%ebx
+  801438:	89 cf                	mov    %ecx,%edi
+  80143a:	89 ce                	mov    %ecx,%esi
+  80143c:	cd 30                	int    $0x30
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	7f 08                	jg     80144a <sys_migrate+0x48>
+  801442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801445:	5b                   	pop    %ebx
+  801446:	5e                   	pop    %esi
+  801447:	5f                   	pop    %edi
+  801448:	5d                   	pop    %ebp
+  801449:	c3                   	ret
+  80144a:	83 ec 0c             	sub    $0xc,%esp
+  80144d:	50                   	push   %eax
+  80144e:	6a 1a                	push   $0x1a
+  801450:	68 6b 3b 80 00       	push   $0x803b6b
+  801455:	6a 24                	push   $0x24
+  801457:	68 88 3b 80 00       	push   $0x803b88
+  80145c:	e8 0c ed ff ff       	call   80016d <_panic>
+
+00801461 <sys_lease_complete>:
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	57                   	push   %edi
+  801465:	56                   	push   %esi
+  801466:	53                   	push   %ebx
+  801467:	83 ec 0c             	sub    $0xc,%esp
+  80146a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801474:	89 d1                	mov    %edx,%ecx
+  801476:	89 d3                	mov    %edx,%ebx
+  801478:	89 d7                	mov    %edx,%edi
+  80147a:	89 d6                	mov    %edx,%esi
+  80147c:	cd 30                	int    $0x30
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	7f 08                	jg     80148a <sys_lease_complete+0x29>
+  801482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+  80148a:	83 ec 0c             	sub    $0xc,%esp
+  80148d:	50                   	push   %eax
+  80148e:	6a 1b                	push   $0x1b
+  801490:	68 6b 3b 80 00       	push   $0x803b6b
+  801495:	6a 24                	push   $0x24
+  801497:	68 88 3b 80 00       	push   $0x803b88
+  80149c:	e8 cc ec ff ff       	call   80016d <_panic>
+
+008014a1 <sys_env_set_thisenv>:
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	57                   	push   %edi
+  8014a5:	56                   	push   %esi
+  8014a6:	53                   	push   %ebx
+  8014a7:	83 ec 0c             	sub    $0xc,%esp
+  8014aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014ba:	89 df                	mov    %ebx,%edi
+  8014bc:	89 de                	mov    %ebx,%esi
+  8014be:	cd 30                	int    $0x30
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	7f 08                	jg     8014cc <sys_env_set_thisenv+0x2b>
+  8014c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c7:	5b                   	pop    %ebx
+  8014c8:	5e                   	pop    %esi
+  8014c9:	5f                   	pop    %edi
+  8014ca:	5d                   	pop    %ebp
+  8014cb:	c3                   	ret
+  8014cc:	83 ec 0c             	sub    $0xc,%esp
+  8014cf:	50                   	push   %eax
+  8014d0:	6a 1c                	push   $0x1c
+  8014d2:	68 6b 3b 80 00       	push   $0x803b6b
+  8014d7:	6a 24                	push   $0x24
+  8014d9:	68 88 3b 80 00       	push   $0x803b88
+  8014de:	e8 8a ec ff ff       	call   80016d <_panic>
+
+008014e3 <sys_env_set_sched>:
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	57                   	push   %edi
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 ec 0c             	sub    $0xc,%esp
+  8014ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ff:	89 f7                	mov    %esi,%edi
+  801501:	cd 30                	int    $0x30
+  801503:	85 c0                	test   %eax,%eax
+  801505:	7f 08                	jg     80150f <sys_env_set_sched+0x2c>
+  801507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150a:	5b                   	pop    %ebx
+  80150b:	5e                   	pop    %esi
+  80150c:	5f                   	pop    %edi
+  80150d:	5d                   	pop    %ebp
+  80150e:	c3                   	ret
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	50                   	push   %eax
+  801513:	6a 1d                	push   $0x1d
+  801515:	68 6b 3b 80 00       	push   $0x803b6b
+  80151a:	6a 24                	push   $0x24
+  80151c:	68 88 3b 80 00       	push   $0x803b88
+  801521:	e8 47 ec ff ff       	call   80016d <_panic>
+
+00801526 <sys_batch>:
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+  801529:	57                   	push   %edi
+  80152a:	56                   	push   %esi
+  80152b:	53                   	push   %ebx
+  80152c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801531:	8b 55 08             	mov    0x8(%ebp),%edx
+  801534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801537:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80153c:	89 df                	mov    %ebx,%edi
+  80153e:	89 de                	mov    %ebx,%esi
+  801540:	cd 30                	int    $0x30
+  801542:	5b                   	pop    %ebx
+  801543:	5e                   	pop    %esi
+  801544:	5f                   	pop    %edi
+  801545:	5d                   	pop    %ebp
+  801546:	c3                   	ret
+
+00801547 <sys_env_stats>:
+  801547:	55                   	push   %ebp
+  801548:	89 e5                	mov    %esp,%ebp
+  80154a:	57                   	push   %edi
+  80154b:	56                   	push   %esi
+  80154c:	53                   	push   %ebx
+  80154d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801552:	8b 55 08             	mov    0x8(%ebp),%edx
+  801555:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801558:	b8 23 00 00 00       	mov    $0x23,%eax
+  80155d:	89 df                	mov    %ebx,%edi
+  80155f:	89 de                	mov    %ebx,%esi
+  801561:	cd 30                	int    $0x30
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5f                   	pop    %edi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+
+00801568 <sys_trace>:
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	57                   	push   %edi
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801573:	8b 55 08             	mov    0x8(%ebp),%edx
+  801576:	b8 24 00 00 00       	mov    $0x24,%eax
+  80157b:	89 cb                	mov    %ecx,%ebx
+  80157d:	89 cf                	mov    %ecx,%edi
+  80157f:	89 ce                	mov    %ecx,%esi
+  801581:	cd 30                	int    $0x30
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+
+00801588 <sys_env_set_pager>:
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	57                   	push   %edi
+  80158c:	56                   	push   %esi
+  80158d:	53                   	push   %ebx
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	be 00 00 00 00       	mov    $0x0,%esi
+  801596:	8b 55 08             	mov    0x8(%ebp),%edx
+  801599:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159c:	b8 25 00 00 00       	mov    $0x25,%eax
+  8015a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a4:	89 f7                	mov    %esi,%edi
+  8015a6:	cd 30                	int    $0x30
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	7f 08                	jg     8015b4 <sys_env_set_pager+0x2c>
+  8015ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+  8015b4:	83 ec 0c             	sub    $0xc,%esp
+  8015b7:	50                   	push   %eax
+  8015b8:	6a 25                	push   $0x25
+  8015ba:	68 6b 3b 80 00       	push   $0x803b6b
+  8015bf:	6a 24                	push   $0x24
+  8015c1:	68 88 3b 80 00       	push   $0x803b88
+  8015c6:	e8 a2 eb ff ff       	call   80016d <_panic>
+
+008015cb <sys_pager_retire>:
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8015de:	89 cb                	mov    %ecx,%ebx
+  8015e0:	89 cf                	mov    %ecx,%edi
+  8015e2:	89 ce                	mov    %ecx,%esi
+  8015e4:	cd 30                	int    $0x30
+  8015e6:	5b                   	pop    %ebx
+  8015e7:	5e                   	pop    %esi
+  8015e8:	5f                   	pop    %edi
+  8015e9:	5d                   	pop    %ebp
+  8015ea:	c3                   	ret
+
+008015eb <sys_prof>:
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+  8015f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fc:	b8 22 00 00 00       	mov    $0x22,%eax
+  801601:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801604:	89 f7                	mov    %esi,%edi
+  801606:	cd 30                	int    $0x30
+  801608:	5b                   	pop    %ebx
+  801609:	5e                   	pop    %esi
+  80160a:	5f                   	pop    %edi
+  80160b:	5d                   	pop    %ebp
+  80160c:	c3                   	ret
+
+0080160d <dupq_flush>:
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	53                   	push   %ebx
+  801611:	83 ec 0c             	sub    $0xc,%esp
+  801614:	8b 1d 00 50 80 00    	mov    0x805000,%ebx
+  80161a:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801621:	00 00 00 
+  801624:	53                   	push   %ebx
+  801625:	68 00 00 40 00       	push   $0x400000
+  80162a:	e8 f7 fe ff ff       	call   801526 <sys_batch>
+  80162f:	83 c4 10             	add    $0x10,%esp
+  801632:	85 c0                	test   %eax,%eax
+  801634:	78 14                	js     80164a <dupq_flush+0x3d>
+  801636:	39 c3                	cmp    %eax,%ebx
+  801638:	7e 0b                	jle    801645 <dupq_flush+0x38>
+  80163a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80163d:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801643:	eb 05                	jmp    80164a <dupq_flush+0x3d>
+  801645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80164d:	c9                   	leave
+  80164e:	c3                   	ret
+
+0080164f <pgfault>:
+  80164f:	55                   	push   %ebp
+  801650:	89 e5                	mov    %esp,%ebp
+  801652:	56                   	push   %esi
+  801653:	53                   	push   %ebx
+  801654:	8b 45 08             	mov    0x8(%ebp),%eax
+  801657:	8b 30                	mov    (%eax),%esi
+  801659:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80165d:	0f 84 83 00 00 00    	je     8016e6 <pgfault+0x97>
+  801663:	89 f0                	mov    %esi,%eax
+  801665:	c1 e8 0c             	shr    $0xc,%eax
+  801668:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80166f:	f6 c4 08             	test   $0x8,%ah
+  801672:	0f 84 80 00 00 00    	je     8016f8 <pgfault+0xa9>
+  801678:	e8 b8 f6 ff ff       	call   800d35 <sys_getenvid>
+  80167d:	89 c3                	mov    %eax,%ebx
+  80167f:	83 ec 04             	sub    $0x4,%esp
+  801682:	6a 07                	push   $0x7
+  801684:	68 00 f0 7f 00       	push   $0x7ff000
+  801689:	50                   	push   %eax
+  80168a:	e8 10 f7 ff ff       	call   800d9f <sys_page_alloc>
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	85 c0                	test   %eax,%eax
+  801694:	78 74                	js     80170a <pgfault+0xbb>
+  801696:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80169c:	83 ec 04             	sub    $0x4,%esp
+  80169f:	68 00 10 00 00       	push   $0x1000
+  8016a4:	56                   	push   %esi
+  8016a5:	68 00 f0 7f 00       	push   $0x7ff000
+  8016aa:	e8 40 f4 ff ff       	call   800aef <memmove>
+  8016af:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	68 00 f0 7f 00       	push   $0x7ff000
+  8016bd:	53                   	push   %ebx
+  8016be:	e8 1f f7 ff ff       	call   800de2 <sys_page_map>
+  8016c3:	83 c4 20             	add    $0x20,%esp
+  8016c6:	85 c0                	test   %eax,%eax
+  8016c8:	78 54                	js     80171e <pgfault+0xcf>
+  8016ca:	83 ec 08             	sub    $0x8,%esp
+  8016cd:	68 00 f0 7f 00       	push   $0x7ff000
+  8016d2:	53                   	push   %ebx
+  8016d3:	e8 99 f7 ff ff       	call   800e71 <sys_page_unmap>
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	78 53                	js     801732 <pgfault+0xe3>
+  8016df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e2:	5b                   	pop    %ebx
+  8016e3:	5e                   	pop    %esi
+  8016e4:	5d                   	pop    %ebp
+  8016e5:	c3                   	ret
+  8016e6:	56                   	push   %esi
+  8016e7:	68 98 3b 80 00       	push   $0x803b98
+  8016ec:	6a 19                	push   $0x19
+  8016ee:	68 74 3c 80 00       	push   $0x803c74
+  8016f3:	e8 75 ea ff ff       	call   80016d <_panic>
+  8016f8:	56                   	push   %esi
+  8016f9:	68 cc 3b 80 00       	push   $0x803bcc
+  8016fe:	6a 1e                	push   $0x1e
+  801700:	68 74 3c 80 00       	push   $0x803c74
+  801705:	e8 63 ea ff ff       	call   80016d <_panic>
+  80170a:	83 ec 04             	sub    $0x4,%esp
+  80170d:	68 00 3c 80 00       	push   $0x803c00
+  801712:	6a 2e                	push   $0x2e
+  801714:	68 74 3c 80 00       	push   $0x803c74
+  801719:	e8 4f ea ff ff       	call   80016d <_panic>
+  80171e:	83 ec 04             	sub    $0x4,%esp
+  801721:	68 24 3c 80 00       	push   $0x803c24
+  801726:	6a 37                	push   $0x37
+  801728:	68 74 3c 80 00       	push   $0x803c74
+  80172d:	e8 3b ea ff ff       	call   80016d <_panic>
+  801732:	83 ec 04             	sub    $0x4,%esp
+  801735:	68 50 3c 80 00       	push   $0x803c50
+  80173a:	6a 3c                	push   $0x3c
+  80173c:	68 74 3c 80 00       	push   $0x803c74
+  801741:	e8 27 ea ff ff       	call   80016d <_panic>
+
+00801746 <dupq_begin>:
+  801746:	55                   	push   %ebp
+  801747:	89 e5                	mov    %esp,%ebp
+  801749:	83 ec 0c             	sub    $0xc,%esp
+  80174c:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801753:	00 00 00 
+  801756:	6a 07                	push   $0x7
+  801758:	68 00 00 40 00       	push   $0x400000
+  80175d:	6a 00                	push   $0x0
+  80175f:	e8 3b f6 ff ff       	call   800d9f <sys_page_alloc>
+  801764:	c9                   	leave
+  801765:	c3                   	ret
+
+00801766 <dupq_map>:
+  801766:	55                   	push   %ebp
+  801767:	89 e5                	mov    %esp,%ebp
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	81 3d 00 50 80 00 92 	cmpl   $0x92,0x805000
+  801773:	00 00 00 
+  801776:	74 46                	je     8017be <dupq_map+0x58>
+  801778:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80177e:	8d 42 01             	lea    0x1(%edx),%eax
+  801781:	a3 00 50 80 00       	mov    %eax,0x805000
+  801786:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801789:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80178f:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801796:	00 00 00 
+  801799:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179c:	89 50 04             	mov    %edx,0x4(%eax)
+  80179f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017a2:	c1 e2 0c             	shl    $0xc,%edx
+  8017a5:	89 50 08             	mov    %edx,0x8(%eax)
+  8017a8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8017ab:	89 48 0c             	mov    %ecx,0xc(%eax)
+  8017ae:	89 50 10             	mov    %edx,0x10(%eax)
+  8017b1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8017b4:	89 50 14             	mov    %edx,0x14(%eax)
+  8017b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bc:	c9                   	leave
+  8017bd:	c3                   	ret
+  8017be:	e8 4a fe ff ff       	call   80160d <dupq_flush>
+  8017c3:	85 c0                	test   %eax,%eax
+  8017c5:	79 b1                	jns    801778 <dupq_map+0x12>
+  8017c7:	eb f3                	jmp    8017bc <dupq_map+0x56>
+
+008017c9 <dupq_end>:
+  8017c9:	55                   	push   %ebp
+  8017ca:	89 e5                	mov    %esp,%ebp
+  8017cc:	53                   	push   %ebx
+  8017cd:	83 ec 04             	sub    $0x4,%esp
+  8017d0:	e8 38 fe ff ff       	call   80160d <dupq_flush>
+  8017d5:	89 c3                	mov    %eax,%ebx
+  8017d7:	83 ec 08             	sub    $0x8,%esp
+  8017da:	68 00 00 40 00       	push   $0x400000
+  8017df:	6a 00                	push   $0x0
+  8017e1:	e8 8b f6 ff ff       	call   800e71 <sys_page_unmap>
+  8017e6:	89 d8                	mov    %ebx,%eax
+  8017e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017eb:	c9                   	leave
+  8017ec:	c3                   	ret
+
+008017ed <fork>:
+  8017ed:	55                   	push   %ebp
+  8017ee:	89 e5                	mov    %esp,%ebp
+  8017f0:	53                   	push   %ebx
+  8017f1:	83 ec 10             	sub    $0x10,%esp
+  8017f4:	68 4f 16 80 00       	push   $0x80164f
+  8017f9:	e8 0c 1d 00 00       	call   80350a <set_pgfault_handler>
+  8017fe:	83 c4 08             	add    $0x8,%esp
+  801801:	6a 01                	push   $0x1
+  801803:	6a 00                	push   $0x0
+  801805:	e8 4c f7 ff ff       	call   800f56 <sys_env_set_cow>
+  80180a:	e8 a4 f6 ff ff       	call   800eb3 <sys_fork>
+  80180f:	89 c3                	mov    %eax,%ebx
+  801811:	83 c4 10             	add    $0x10,%esp
+  801814:	85 c0                	test   %eax,%eax
+  801816:	74 07                	je     80181f <fork+0x32>
+  801818:	89 d8                	mov    %ebx,%eax
+  80181a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181d:	c9                   	leave
+  80181e:	c3                   	ret
+  80181f:	e8 11 f5 ff ff       	call   800d35 <sys_getenvid>
+  801824:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801829:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80182f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801834:	a3 14 50 80 00       	mov    %eax,0x805014
+  801839:	eb dd                	jmp    801818 <fork+0x2b>
+
+0080183b <sfork>:
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	57                   	push   %edi
+  80183f:	56                   	push   %esi
+  801840:	53                   	push   %ebx
+  801841:	83 ec 1c             	sub    $0x1c,%esp
+  801844:	e8 ec f4 ff ff       	call   800d35 <sys_getenvid>
+  801849:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80184c:	83 ec 0c             	sub    $0xc,%esp
+  80184f:	68 4f 16 80 00       	push   $0x80164f
+  801854:	e8 b1 1c 00 00       	call   80350a <set_pgfault_handler>
+  801859:	b8 07 00 00 00       	mov    $0x7,%eax
+  80185e:	cd 30                	int    $0x30
+  801860:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801863:	83 c4 10             	add    $0x10,%esp
+  801866:	85 c0                	test   %eax,%eax
+  801868:	0f 88 45 02 00 00    	js     801ab3 <sfork+0x278>
+  80186e:	89 c6                	mov    %eax,%esi
+  801870:	74 17                	je     801889 <sfork+0x4e>
+  801872:	e8 cf fe ff ff       	call   801746 <dupq_begin>
+  801877:	85 c0                	test   %eax,%eax
+  801879:	0f 88 40 02 00 00    	js     801abf <sfork+0x284>
+  80187f:	bf 02 00 00 00       	mov    $0x2,%edi
+  801884:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801887:	eb 39                	jmp    8018c2 <sfork+0x87>
+  801889:	e8 a7 f4 ff ff       	call   800d35 <sys_getenvid>
+  80188e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801893:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801899:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80189e:	a3 14 50 80 00       	mov    %eax,0x805014
+  8018a3:	e9 23 01 00 00       	jmp    8019cb <sfork+0x190>
+  8018a8:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018af:	a8 01                	test   $0x1,%al
+  8018b1:	75 5b                	jne    80190e <sfork+0xd3>
+  8018b3:	83 c7 01             	add    $0x1,%edi
+  8018b6:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  8018bc:	0f 84 40 01 00 00    	je     801a02 <sfork+0x1c7>
+  8018c2:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018c9:	a8 01                	test   $0x1,%al
+  8018cb:	74 db                	je     8018a8 <sfork+0x6d>
+  8018cd:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018d4:	a8 80                	test   $0x80,%al
+  8018d6:	74 d0                	je     8018a8 <sfork+0x6d>
+  8018d8:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018e4:	0c 80                	or     $0x80,%al
+  8018e6:	50                   	push   %eax
+  8018e7:	ff 75 e4             	push   -0x1c(%ebp)
+  8018ea:	89 f8                	mov    %edi,%eax
+  8018ec:	c1 e0 16             	shl    $0x16,%eax
+  8018ef:	c1 e8 0c             	shr    $0xc,%eax
+  8018f2:	50                   	push   %eax
+  8018f3:	ff 75 e0             	push   -0x20(%ebp)
+  8018f6:	e8 6b fe ff ff       	call   801766 <dupq_map>
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	79 b1                	jns    8018b3 <sfork+0x78>
+  801902:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801909:	e9 bd 00 00 00       	jmp    8019cb <sfork+0x190>
+  80190e:	89 fe                	mov    %edi,%esi
+  801910:	c1 e6 16             	shl    $0x16,%esi
+  801913:	89 f0                	mov    %esi,%eax
+  801915:	c1 e8 0c             	shr    $0xc,%eax
+  801918:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80191d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801920:	eb 57                	jmp    801979 <sfork+0x13e>
+  801922:	e8 0e f4 ff ff       	call   800d35 <sys_getenvid>
+  801927:	89 c7                	mov    %eax,%edi
+  801929:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  80192e:	f6 c4 04             	test   $0x4,%ah
+  801931:	0f 85 9f 00 00 00    	jne    8019d6 <sfork+0x19b>
+  801937:	a9 02 08 00 00       	test   $0x802,%eax
+  80193c:	0f 85 c5 01 00 00    	jne    801b07 <sfork+0x2cc>
+  801942:	6a 05                	push   $0x5
+  801944:	ff 75 e4             	push   -0x1c(%ebp)
+  801947:	68 fd e7 0e 00       	push   $0xee7fd
+  80194c:	57                   	push   %edi
+  80194d:	e8 14 fe ff ff       	call   801766 <dupq_map>
+  801952:	83 c4 10             	add    $0x10,%esp
+  801955:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  80195b:	0f 84 91 00 00 00    	je     8019f2 <sfork+0x1b7>
+  801961:	89 f0                	mov    %esi,%eax
+  801963:	09 d8                	or     %ebx,%eax
+  801965:	c1 e8 0c             	shr    $0xc,%eax
+  801968:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80196e:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801973:	0f 84 81 00 00 00    	je     8019fa <sfork+0x1bf>
+  801979:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  80197e:	74 a2                	je     801922 <sfork+0xe7>
+  801980:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801987:	f6 c2 01             	test   $0x1,%dl
+  80198a:	74 c9                	je     801955 <sfork+0x11a>
+  80198c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801993:	f6 c6 02             	test   $0x2,%dh
+  801996:	75 bd                	jne    801955 <sfork+0x11a>
+  801998:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80199f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019a6:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  8019ac:	f7 d2                	not    %edx
+  8019ae:	21 ca                	and    %ecx,%edx
+  8019b0:	52                   	push   %edx
+  8019b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8019b4:	50                   	push   %eax
+  8019b5:	ff 75 e0             	push   -0x20(%ebp)
+  8019b8:	e8 a9 fd ff ff       	call   801766 <dupq_map>
+  8019bd:	83 c4 10             	add    $0x10,%esp
+  8019c0:	85 c0                	test   %eax,%eax
+  8019c2:	79 91                	jns    801955 <sfork+0x11a>
+  8019c4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8019cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d1:	5b                   	pop    %ebx
+  8019d2:	5e                   	pop    %esi
+  8019d3:	5f                   	pop    %edi
+  8019d4:	5d                   	pop    %ebp
+  8019d5:	c3                   	ret
+  8019d6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019db:	50                   	push   %eax
+  8019dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8019df:	68 fd e7 0e 00       	push   $0xee7fd
+  8019e4:	57                   	push   %edi
+  8019e5:	e8 7c fd ff ff       	call   801766 <dupq_map>
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	e9 63 ff ff ff       	jmp    801955 <sfork+0x11a>
+  8019f2:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8019f5:	e9 b9 fe ff ff       	jmp    8018b3 <sfork+0x78>
+  8019fa:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8019fd:	e9 b1 fe ff ff       	jmp    8018b3 <sfork+0x78>
+  801a02:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801a05:	e8 bf fd ff ff       	call   8017c9 <dupq_end>
+  801a0a:	85 c0                	test   %eax,%eax
+  801a0c:	0f 88 b9 00 00 00    	js     801acb <sfork+0x290>
+  801a12:	83 ec 04             	sub    $0x4,%esp
+  801a15:	6a 07                	push   $0x7
+  801a17:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a1c:	56                   	push   %esi
+  801a1d:	e8 7d f3 ff ff       	call   800d9f <sys_page_alloc>
+  801a22:	83 c4 10             	add    $0x10,%esp
+  801a25:	85 c0                	test   %eax,%eax
+  801a27:	0f 88 aa 00 00 00    	js     801ad7 <sfork+0x29c>
+  801a2d:	83 ec 0c             	sub    $0xc,%esp
+  801a30:	6a 07                	push   $0x7
+  801a32:	68 00 f0 7f 00       	push   $0x7ff000
+  801a37:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801a3a:	57                   	push   %edi
+  801a3b:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a40:	56                   	push   %esi
+  801a41:	e8 9c f3 ff ff       	call   800de2 <sys_page_map>
+  801a46:	83 c4 20             	add    $0x20,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	0f 88 92 00 00 00    	js     801ae3 <sfork+0x2a8>
+  801a51:	83 ec 04             	sub    $0x4,%esp
+  801a54:	68 00 10 00 00       	push   $0x1000
+  801a59:	68 00 f0 7f 00       	push   $0x7ff000
+  801a5e:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a63:	e8 87 f0 ff ff       	call   800aef <memmove>
+  801a68:	83 c4 08             	add    $0x8,%esp
+  801a6b:	68 00 f0 7f 00       	push   $0x7ff000
+  801a70:	57                   	push   %edi
+  801a71:	e8 fb f3 ff ff       	call   800e71 <sys_page_unmap>
+  801a76:	83 c4 10             	add    $0x10,%esp
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	78 72                	js     801aef <sfork+0x2b4>
+  801a7d:	83 ec 08             	sub    $0x8,%esp
+  801a80:	68 82 35 80 00       	push   $0x803582
+  801a85:	56                   	push   %esi
+  801a86:	e8 2d f5 ff ff       	call   800fb8 <sys_env_set_pgfault_upcall>
+  801a8b:	83 c4 10             	add    $0x10,%esp
+  801a8e:	85 c0                	test   %eax,%eax
+  801a90:	78 69                	js     801afb <sfork+0x2c0>
+  801a92:	83 ec 08             	sub    $0x8,%esp
+  801a95:	6a 02                	push   $0x2
+  801a97:	56                   	push   %esi
+  801a98:	e8 35 f4 ff ff       	call   800ed2 <sys_env_set_status>
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801aa7:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801aab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801aae:	e9 18 ff ff ff       	jmp    8019cb <sfork+0x190>
+  801ab3:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801aba:	e9 0c ff ff ff       	jmp    8019cb <sfork+0x190>
+  801abf:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ac6:	e9 00 ff ff ff       	jmp    8019cb <sfork+0x190>
+  801acb:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ad2:	e9 f4 fe ff ff       	jmp    8019cb <sfork+0x190>
+  801ad7:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ade:	e9 e8 fe ff ff       	jmp    8019cb <sfork+0x190>
+  801ae3:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801aea:	e9 dc fe ff ff       	jmp    8019cb <sfork+0x190>
+  801aef:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801af6:	e9 d0 fe ff ff       	jmp    8019cb <sfork+0x190>
+  801afb:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b02:	e9 c4 fe ff ff       	jmp    8019cb <sfork+0x190>
+  801b07:	68 05 08 00 00       	push   $0x805
+  801b0c:	ff 75 e4             	push   -0x1c(%ebp)
+  801b0f:	68 fd e7 0e 00       	push   $0xee7fd
+  801b14:	57                   	push   %edi
+  801b15:	e8 4c fc ff ff       	call   801766 <dupq_map>
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	0f 88 30 fe ff ff    	js     801955 <sfork+0x11a>
+  801b25:	68 05 08 00 00       	push   $0x805
+  801b2a:	57                   	push   %edi
+  801b2b:	68 fd e7 0e 00       	push   $0xee7fd
+  801b30:	57                   	push   %edi
+  801b31:	e8 30 fc ff ff       	call   801766 <dupq_map>
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	e9 17 fe ff ff       	jmp    801955 <sfork+0x11a>
+
+00801b3e <ipc_recv>:
+  801b3e:	55                   	push   %ebp
+  801b3f:	89 e5                	mov    %esp,%ebp
+  801b41:	56                   	push   %esi
+  801b42:	53                   	push   %ebx
+  801b43:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801b53:	0f 44 c2             	cmove  %edx,%eax
+  801b56:	83 ec 0c             	sub    $0xc,%esp
+  801b59:	50                   	push   %eax
+  801b5a:	e8 eb f4 ff ff       	call   80104a <sys_ipc_recv>
+  801b5f:	83 c4 10             	add    $0x10,%esp
+  801b62:	85 c0                	test   %eax,%eax
+  801b64:	78 2a                	js     801b90 <ipc_recv+0x52>
+  801b66:	a1 14 50 80 00       	mov    0x805014,%eax
+  801b6b:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801b71:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801b77:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801b7d:	85 f6                	test   %esi,%esi
+  801b7f:	74 02                	je     801b83 <ipc_recv+0x45>
+  801b81:	89 0e                	mov    %ecx,(%esi)
+  801b83:	85 db                	test   %ebx,%ebx
+  801b85:	74 02                	je     801b89 <ipc_recv+0x4b>
+  801b87:	89 13                	mov    %edx,(%ebx)
+  801b89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b8c:	5b                   	pop    %ebx
+  801b8d:	5e                   	pop    %esi
+  801b8e:	5d                   	pop    %ebp
+  801b8f:	c3                   	ret
+  801b90:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b9a:	eb e1                	jmp    801b7d <ipc_recv+0x3f>
+
+00801b9c <ipc_send>:
+  801b9c:	55                   	push   %ebp
+  801b9d:	89 e5                	mov    %esp,%ebp
+  801b9f:	57                   	push   %edi
+  801ba0:	56                   	push   %esi
+  801ba1:	53                   	push   %ebx
+  801ba2:	83 ec 0c             	sub    $0xc,%esp
+  801ba5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ba8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bab:	8b 75 14             	mov    0x14(%ebp),%esi
+  801bae:	85 db                	test   %ebx,%ebx
+  801bb0:	74 1e                	je     801bd0 <ipc_send+0x34>
+  801bb2:	56                   	push   %esi
+  801bb3:	53                   	push   %ebx
+  801bb4:	57                   	push   %edi
+  801bb5:	ff 75 08             	push   0x8(%ebp)
+  801bb8:	e8 1a f5 ff ff       	call   8010d7 <sys_ipc_send>
+  801bbd:	83 c4 10             	add    $0x10,%esp
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	74 2a                	je     801bee <ipc_send+0x52>
+  801bc4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801bc7:	75 13                	jne    801bdc <ipc_send+0x40>
+  801bc9:	e8 86 f1 ff ff       	call   800d54 <sys_yield>
+  801bce:	eb e2                	jmp    801bb2 <ipc_send+0x16>
+  801bd0:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd5:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801bda:	eb d6                	jmp    801bb2 <ipc_send+0x16>
+  801bdc:	50                   	push   %eax
+  801bdd:	68 80 3c 80 00       	push   $0x803c80
+  801be2:	6a 4f                	push   $0x4f
+  801be4:	68 c3 3c 80 00       	push   $0x803cc3
+  801be9:	e8 7f e5 ff ff       	call   80016d <_panic>
+  801bee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf1:	5b                   	pop    %ebx
+  801bf2:	5e                   	pop    %esi
+  801bf3:	5f                   	pop    %edi
+  801bf4:	5d                   	pop    %ebp
+  801bf5:	c3                   	ret
+
+00801bf6 <ipc_call>:
+  801bf6:	55                   	push   %ebp
+  801bf7:	89 e5                	mov    %esp,%ebp
+  801bf9:	57                   	push   %edi
+  801bfa:	56                   	push   %esi
+  801bfb:	53                   	push   %ebx
+  801bfc:	83 ec 0c             	sub    $0xc,%esp
+  801bff:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c03:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801c08:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801c0c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801c10:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801c15:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801c19:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c22:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801c26:	eb 05                	jmp    801c2d <ipc_call+0x37>
+  801c28:	e8 27 f1 ff ff       	call   800d54 <sys_yield>
+  801c2d:	83 ec 0c             	sub    $0xc,%esp
+  801c30:	56                   	push   %esi
+  801c31:	53                   	push   %ebx
+  801c32:	57                   	push   %edi
+  801c33:	ff 75 0c             	push   0xc(%ebp)
+  801c36:	ff 75 08             	push   0x8(%ebp)
+  801c39:	e8 e9 f4 ff ff       	call   801127 <sys_ipc_call>
+  801c3e:	83 c4 20             	add    $0x20,%esp
+  801c41:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c44:	74 e2                	je     801c28 <ipc_call+0x32>
+  801c46:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801c49:	74 2d                	je     801c78 <ipc_call+0x82>
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	78 4f                	js     801c9e <ipc_call+0xa8>
+  801c4f:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801c53:	74 10                	je     801c65 <ipc_call+0x6f>
+  801c55:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c5a:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801c60:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801c63:	89 02                	mov    %eax,(%edx)
+  801c65:	a1 14 50 80 00       	mov    0x805014,%eax
+  801c6a:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801c70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c73:	5b                   	pop    %ebx
+  801c74:	5e                   	pop    %esi
+  801c75:	5f                   	pop    %edi
+  801c76:	5d                   	pop    %ebp
+  801c77:	c3                   	ret
+  801c78:	ff 75 14             	push   0x14(%ebp)
+  801c7b:	ff 75 10             	push   0x10(%ebp)
+  801c7e:	ff 75 0c             	push   0xc(%ebp)
+  801c81:	ff 75 08             	push   0x8(%ebp)
+  801c84:	e8 13 ff ff ff       	call   801b9c <ipc_send>
+  801c89:	83 c4 0c             	add    $0xc,%esp
+  801c8c:	ff 75 1c             	push   0x1c(%ebp)
+  801c8f:	ff 75 18             	push   0x18(%ebp)
+  801c92:	6a 00                	push   $0x0
+  801c94:	e8 a5 fe ff ff       	call   801b3e <ipc_recv>
+  801c99:	83 c4 10             	add    $0x10,%esp
+  801c9c:	eb d2                	jmp    801c70 <ipc_call+0x7a>
+  801c9e:	50                   	push   %eax
+  801c9f:	68 cd 3c 80 00       	push   $0x803ccd
+  801ca4:	6a 6d                	push   $0x6d
+  801ca6:	68 c3 3c 80 00       	push   $0x803cc3
+  801cab:	e8 bd e4 ff ff       	call   80016d <_panic>
+
+00801cb0 <ipc_reply_recv>:
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	57                   	push   %edi
+  801cb4:	56                   	push   %esi
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+  801cb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cbc:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801cbf:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801cc2:	85 db                	test   %ebx,%ebx
+  801cc4:	0f 84 ac 00 00 00    	je     801d76 <ipc_reply_recv+0xc6>
+  801cca:	85 f6                	test   %esi,%esi
+  801ccc:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801cd1:	0f 45 c6             	cmovne %esi,%eax
+  801cd4:	83 ec 0c             	sub    $0xc,%esp
+  801cd7:	50                   	push   %eax
+  801cd8:	ff 75 14             	push   0x14(%ebp)
+  801cdb:	53                   	push   %ebx
+  801cdc:	ff 75 0c             	push   0xc(%ebp)
+  801cdf:	ff 75 08             	push   0x8(%ebp)
+  801ce2:	e8 61 f4 ff ff       	call   801148 <sys_ipc_reply_recv>
+  801ce7:	83 c4 20             	add    $0x20,%esp
+  801cea:	85 c0                	test   %eax,%eax
+  801cec:	78 3a                	js     801d28 <ipc_reply_recv+0x78>
+  801cee:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801cf2:	74 10                	je     801d04 <ipc_reply_recv+0x54>
+  801cf4:	a1 14 50 80 00       	mov    0x805014,%eax
+  801cf9:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801cff:	8b 55 18             	mov    0x18(%ebp),%edx
+  801d02:	89 02                	mov    %eax,(%edx)
+  801d04:	85 ff                	test   %edi,%edi
+  801d06:	74 0d                	je     801d15 <ipc_reply_recv+0x65>
+  801d08:	a1 14 50 80 00       	mov    0x805014,%eax
+  801d0d:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801d13:	89 07                	mov    %eax,(%edi)
+  801d15:	a1 14 50 80 00       	mov    0x805014,%eax
+  801d1a:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801d20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d23:	5b                   	pop    %ebx
+  801d24:	5e                   	pop    %esi
+  801d25:	5f                   	pop    %edi
+  801d26:	5d                   	pop    %ebp
+  801d27:	c3                   	ret
+  801d28:	ff 75 14             	push   0x14(%ebp)
+  801d2b:	53                   	push   %ebx
+  801d2c:	ff 75 0c             	push   0xc(%ebp)
+  801d2f:	ff 75 08             	push   0x8(%ebp)
+  801d32:	e8 c3 f2 ff ff       	call   800ffa <sys_ipc_try_send>
+  801d37:	89 c2                	mov    %eax,%edx
+  801d39:	c1 ea 1f             	shr    $0x1f,%edx
+  801d3c:	83 c4 10             	add    $0x10,%esp
+  801d3f:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801d42:	0f 95 c1             	setne  %cl
+  801d45:	84 d1                	test   %dl,%cl
+  801d47:	74 05                	je     801d4e <ipc_reply_recv+0x9e>
+  801d49:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d4c:	75 12                	jne    801d60 <ipc_reply_recv+0xb0>
+  801d4e:	83 ec 04             	sub    $0x4,%esp
+  801d51:	57                   	push   %edi
+  801d52:	56                   	push   %esi
+  801d53:	ff 75 18             	push   0x18(%ebp)
+  801d56:	e8 e3 fd ff ff       	call   801b3e <ipc_recv>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	eb c0                	jmp    801d20 <ipc_reply_recv+0x70>
+  801d60:	83 ec 04             	sub    $0x4,%esp
+  801d63:	50                   	push   %eax
+  801d64:	ff 75 08             	push   0x8(%ebp)
+  801d67:	68 a0 3c 80 00       	push   $0x803ca0
+  801d6c:	e8 d7 e4 ff ff       	call   800248 <cprintf>
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	eb d8                	jmp    801d4e <ipc_reply_recv+0x9e>
+  801d76:	85 f6                	test   %esi,%esi
+  801d78:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801d7d:	0f 45 c6             	cmovne %esi,%eax
+  801d80:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801d85:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801d8c:	e9 43 ff ff ff       	jmp    801cd4 <ipc_reply_recv+0x24>
+
+00801d91 <ipc_find_env>:
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	83 ec 14             	sub    $0x14,%esp
+  801d97:	ff 75 08             	push   0x8(%ebp)
+  801d9a:	e8 f9 f1 ff ff       	call   800f98 <sys_env_service>
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da6:	0f 48 c2             	cmovs  %edx,%eax
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+
+00801dab <fd2num>:
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db1:	05 00 00 00 30       	add    $0x30000000,%eax
+  801db6:	c1 e8 0c             	shr    $0xc,%eax
+  801db9:	5d                   	pop    %ebp
+  801dba:	c3                   	ret
+
+00801dbb <fd2data>:
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc1:	05 00 00 00 30       	add    $0x30000000,%eax
+  801dc6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801dcb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801dd0:	5d                   	pop    %ebp
+  801dd1:	c3                   	ret
+
+00801dd2 <fd_alloc>:
+  801dd2:	55                   	push   %ebp
+  801dd3:	89 e5                	mov    %esp,%ebp
+  801dd5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801dda:	89 c2                	mov    %eax,%edx
+  801ddc:	c1 ea 16             	shr    $0x16,%edx
+  801ddf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801de6:	f6 c2 01             	test   $0x1,%dl
+  801de9:	74 29                	je     801e14 <fd_alloc+0x42>
+  801deb:	89 c2                	mov    %eax,%edx
+  801ded:	c1 ea 0c             	shr    $0xc,%edx
+  801df0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801df7:	f6 c2 01             	test   $0x1,%dl
+  801dfa:	74 18                	je     801e14 <fd_alloc+0x42>
+  801dfc:	05 00 10 00 00       	add    $0x1000,%eax
+  801e01:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801e06:	75 d2                	jne    801dda <fd_alloc+0x8>
+  801e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801e12:	eb 05                	jmp    801e19 <fd_alloc+0x47>
+  801e14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e19:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e1c:	89 02                	mov    %eax,(%edx)
+  801e1e:	89 c8                	mov    %ecx,%eax
+  801e20:	5d                   	pop    %ebp
+  801e21:	c3                   	ret
+
+00801e22 <fd_lookup>:
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e28:	83 f8 1f             	cmp    $0x1f,%eax
+  801e2b:	77 30                	ja     801e5d <fd_lookup+0x3b>
+  801e2d:	c1 e0 0c             	shl    $0xc,%eax
+  801e30:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801e35:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e3b:	f6 c2 01             	test   $0x1,%dl
+  801e3e:	74 24                	je     801e64 <fd_lookup+0x42>
+  801e40:	89 c2                	mov    %eax,%edx
+  801e42:	c1 ea 0c             	shr    $0xc,%edx
+  801e45:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e4c:	f6 c2 01             	test   $0x1,%dl
+  801e4f:	74 1a                	je     801e6b <fd_lookup+0x49>
+  801e51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e54:	89 02                	mov    %eax,(%edx)
+  801e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5b:	5d                   	pop    %ebp
+  801e5c:	c3                   	ret
+  801e5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e62:	eb f7                	jmp    801e5b <fd_lookup+0x39>
+  801e64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e69:	eb f0                	jmp    801e5b <fd_lookup+0x39>
+  801e6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e70:	eb e9                	jmp    801e5b <fd_lookup+0x39>
+
+00801e72 <dev_lookup>:
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	53                   	push   %ebx
+  801e76:	83 ec 04             	sub    $0x4,%esp
+  801e79:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e81:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801e86:	39 13                	cmp    %edx,(%ebx)
+  801e88:	74 37                	je     801ec1 <dev_lookup+0x4f>
+  801e8a:	83 c0 01             	add    $0x1,%eax
+  801e8d:	8b 1c 85 68 3d 80 00 	mov    0x803d68(,%eax,4),%ebx
+  801e94:	85 db                	test   %ebx,%ebx
+  801e96:	75 ee                	jne    801e86 <dev_lookup+0x14>
+  801e98:	a1 14 50 80 00       	mov    0x805014,%eax
+  801e9d:	8b 40 48             	mov    0x48(%eax),%eax
+  801ea0:	83 ec 04             	sub    $0x4,%esp
+  801ea3:	52                   	push   %edx
+  801ea4:	50                   	push   %eax
+  801ea5:	68 ec 3c 80 00       	push   $0x803cec
+  801eaa:	e8 99 e3 ff ff       	call   800248 <cprintf>
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eba:	89 1a                	mov    %ebx,(%edx)
+  801ebc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebf:	c9                   	leave
+  801ec0:	c3                   	ret
+  801ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec6:	eb ef                	jmp    801eb7 <dev_lookup+0x45>
+
+00801ec8 <fd_close>:
+  801ec8:	55                   	push   %ebp
+  801ec9:	89 e5                	mov    %esp,%ebp
+  801ecb:	57                   	push   %edi
+  801ecc:	56                   	push   %esi
+  801ecd:	53                   	push   %ebx
+  801ece:	83 ec 24             	sub    $0x24,%esp
+  801ed1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ed4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ed7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eda:	50                   	push   %eax
+  801edb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ee1:	c1 e8 0c             	shr    $0xc,%eax
+  801ee4:	50                   	push   %eax
+  801ee5:	e8 38 ff ff ff       	call   801e22 <fd_lookup>
+  801eea:	89 c3                	mov    %eax,%ebx
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	78 05                	js     801ef8 <fd_close+0x30>
+  801ef3:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ef6:	74 0f                	je     801f07 <fd_close+0x3f>
+  801ef8:	85 ff                	test   %edi,%edi
+  801efa:	0f 44 df             	cmove  %edi,%ebx
+  801efd:	89 d8                	mov    %ebx,%eax
+  801eff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f02:	5b                   	pop    %ebx
+  801f03:	5e                   	pop    %esi
+  801f04:	5f                   	pop    %edi
+  801f05:	5d                   	pop    %ebp
+  801f06:	c3                   	ret
+  801f07:	83 ec 08             	sub    $0x8,%esp
+  801f0a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f0d:	50                   	push   %eax
+  801f0e:	ff 36                	push   (%esi)
+  801f10:	e8 5d ff ff ff       	call   801e72 <dev_lookup>
+  801f15:	89 c3                	mov    %eax,%ebx
+  801f17:	83 c4 10             	add    $0x10,%esp
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	78 1a                	js     801f38 <fd_close+0x70>
+  801f1e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f21:	8b 40 10             	mov    0x10(%eax),%eax
+  801f24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	74 0b                	je     801f38 <fd_close+0x70>
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	56                   	push   %esi
+  801f31:	ff d0                	call   *%eax
+  801f33:	89 c3                	mov    %eax,%ebx
+  801f35:	83 c4 10             	add    $0x10,%esp
+  801f38:	83 ec 08             	sub    $0x8,%esp
+  801f3b:	56                   	push   %esi
+  801f3c:	6a 00                	push   $0x0
+  801f3e:	e8 2e ef ff ff       	call   800e71 <sys_page_unmap>
+  801f43:	83 c4 10             	add    $0x10,%esp
+  801f46:	eb b5                	jmp    801efd <fd_close+0x35>
+
+00801f48 <close>:
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	83 ec 20             	sub    $0x20,%esp
+  801f4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f51:	50                   	push   %eax
+  801f52:	ff 75 08             	push   0x8(%ebp)
+  801f55:	e8 c8 fe ff ff       	call   801e22 <fd_lookup>
+  801f5a:	83 c4 10             	add    $0x10,%esp
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	79 02                	jns    801f63 <close+0x1b>
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+  801f63:	83 ec 08             	sub    $0x8,%esp
+  801f66:	6a 01                	push   $0x1
+  801f68:	ff 75 f4             	push   -0xc(%ebp)
+  801f6b:	e8 58 ff ff ff       	call   801ec8 <fd_close>
+  801f70:	83 c4 10             	add    $0x10,%esp
+  801f73:	eb ec                	jmp    801f61 <close+0x19>
+
+00801f75 <close_all>:
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	53                   	push   %ebx
+  801f79:	83 ec 04             	sub    $0x4,%esp
+  801f7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f81:	83 ec 0c             	sub    $0xc,%esp
+  801f84:	53                   	push   %ebx
+  801f85:	e8 be ff ff ff       	call   801f48 <close>
+  801f8a:	83 c3 01             	add    $0x1,%ebx
+  801f8d:	83 c4 10             	add    $0x10,%esp
+  801f90:	83 fb 20             	cmp    $0x20,%ebx
+  801f93:	75 ec                	jne    801f81 <close_all+0xc>
+  801f95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+
+00801f9a <dup>:
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	57                   	push   %edi
+  801f9e:	56                   	push   %esi
+  801f9f:	53                   	push   %ebx
+  801fa0:	83 ec 34             	sub    $0x34,%esp
+  801fa3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fa6:	50                   	push   %eax
+  801fa7:	ff 75 08             	push   0x8(%ebp)
+  801faa:	e8 73 fe ff ff       	call   801e22 <fd_lookup>
+  801faf:	89 c3                	mov    %eax,%ebx
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 7f                	js     802037 <dup+0x9d>
+  801fb8:	83 ec 0c             	sub    $0xc,%esp
+  801fbb:	ff 75 0c             	push   0xc(%ebp)
+  801fbe:	e8 85 ff ff ff       	call   801f48 <close>
+  801fc3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fc6:	c1 e6 0c             	shl    $0xc,%esi
+  801fc9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801fcf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801fd2:	89 3c 24             	mov    %edi,(%esp)
+  801fd5:	e8 e1 fd ff ff       	call   801dbb <fd2data>
+  801fda:	89 c3                	mov    %eax,%ebx
+  801fdc:	89 34 24             	mov    %esi,(%esp)
+  801fdf:	e8 d7 fd ff ff       	call   801dbb <fd2data>
+  801fe4:	83 c4 10             	add    $0x10,%esp
+  801fe7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801fea:	89 d8                	mov    %ebx,%eax
+  801fec:	c1 e8 16             	shr    $0x16,%eax
+  801fef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ff6:	a8 01                	test   $0x1,%al
+  801ff8:	74 11                	je     80200b <dup+0x71>
+  801ffa:	89 d8                	mov    %ebx,%eax
+  801ffc:	c1 e8 0c             	shr    $0xc,%eax
+  801fff:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802006:	f6 c2 01             	test   $0x1,%dl
+  802009:	75 36                	jne    802041 <dup+0xa7>
+  80200b:	89 f8                	mov    %edi,%eax
+  80200d:	c1 e8 0c             	shr    $0xc,%eax
+  802010:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802017:	83 ec 0c             	sub    $0xc,%esp
+  80201a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80201f:	50                   	push   %eax
+  802020:	56                   	push   %esi
+  802021:	6a 00                	push   $0x0
+  802023:	57                   	push   %edi
+  802024:	6a 00                	push   $0x0
+  802026:	e8 b7 ed ff ff       	call   800de2 <sys_page_map>
+  80202b:	89 c3                	mov    %eax,%ebx
+  80202d:	83 c4 20             	add    $0x20,%esp
+  802030:	85 c0                	test   %eax,%eax
+  802032:	78 33                	js     802067 <dup+0xcd>
+  802034:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802037:	89 d8                	mov    %ebx,%eax
+  802039:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80203c:	5b                   	pop    %ebx
+  80203d:	5e                   	pop    %esi
+  80203e:	5f                   	pop    %edi
+  80203f:	5d                   	pop    %ebp
+  802040:	c3                   	ret
+  802041:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802048:	83 ec 0c             	sub    $0xc,%esp
+  80204b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802050:	50                   	push   %eax
+  802051:	ff 75 d4             	push   -0x2c(%ebp)
+  802054:	6a 00                	push   $0x0
+  802056:	53                   	push   %ebx
+  802057:	6a 00                	push   $0x0
+  802059:	e8 84 ed ff ff       	call   800de2 <sys_page_map>
+  80205e:	89 c3                	mov    %eax,%ebx
+  802060:	83 c4 20             	add    $0x20,%esp
+  802063:	85 c0                	test   %eax,%eax
+  802065:	79 a4                	jns    80200b <dup+0x71>
+  802067:	83 ec 08             	sub    $0x8,%esp
+  80206a:	56                   	push   %esi
+  80206b:	6a 00                	push   $0x0
+  80206d:	e8 ff ed ff ff       	call   800e71 <sys_page_unmap>
+  802072:	83 c4 08             	add    $0x8,%esp
+  802075:	ff 75 d4             	push   -0x2c(%ebp)
+  802078:	6a 00                	push   $0x0
+  80207a:	e8 f2 ed ff ff       	call   800e71 <sys_page_unmap>
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	eb b3                	jmp    802037 <dup+0x9d>
+
+00802084 <read>:
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	56                   	push   %esi
+  802088:	53                   	push   %ebx
+  802089:	83 ec 18             	sub    $0x18,%esp
+  80208c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80208f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802092:	50                   	push   %eax
+  802093:	56                   	push   %esi
+  802094:	e8 89 fd ff ff       	call   801e22 <fd_lookup>
+  802099:	83 c4 10             	add    $0x10,%esp
+  80209c:	85 c0                	test   %eax,%eax
+  80209e:	78 3c                	js     8020dc <read+0x58>
+  8020a0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8020a3:	83 ec 08             	sub    $0x8,%esp
+  8020a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020a9:	50                   	push   %eax
+  8020aa:	ff 33                	push   (%ebx)
+  8020ac:	e8 c1 fd ff ff       	call   801e72 <dev_lookup>
+  8020b1:	83 c4 10             	add    $0x10,%esp
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	78 24                	js     8020dc <read+0x58>
+  8020b8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8020bb:	83 e0 03             	and    $0x3,%eax
+  8020be:	83 f8 01             	cmp    $0x1,%eax
+  8020c1:	74 20                	je     8020e3 <read+0x5f>
+  8020c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c6:	8b 40 08             	mov    0x8(%eax),%eax
+  8020c9:	85 c0                	test   %eax,%eax
+  8020cb:	74 37                	je     802104 <read+0x80>
+  8020cd:	83 ec 04             	sub    $0x4,%esp
+  8020d0:	ff 75 10             	push   0x10(%ebp)
+  8020d3:	ff 75 0c             	push   0xc(%ebp)
+  8020d6:	53                   	push   %ebx
+  8020d7:	ff d0                	call   *%eax
+  8020d9:	83 c4 10             	add    $0x10,%esp
+  8020dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020df:	5b                   	pop    %ebx
+  8020e0:	5e                   	pop    %esi
+  8020e1:	5d                   	pop    %ebp
+  8020e2:	c3                   	ret
+  8020e3:	a1 14 50 80 00       	mov    0x805014,%eax
+  8020e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8020eb:	83 ec 04             	sub    $0x4,%esp
+  8020ee:	56                   	push   %esi
+  8020ef:	50                   	push   %eax
+  8020f0:	68 2d 3d 80 00       	push   $0x803d2d
+  8020f5:	e8 4e e1 ff ff       	call   800248 <cprintf>
+  8020fa:	83 c4 10             	add    $0x10,%esp
+  8020fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802102:	eb d8                	jmp    8020dc <read+0x58>
+  802104:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802109:	eb d1                	jmp    8020dc <read+0x58>
+
+0080210b <readn>:
+  80210b:	55                   	push   %ebp
+  80210c:	89 e5                	mov    %esp,%ebp
+  80210e:	57                   	push   %edi
+  80210f:	56                   	push   %esi
+  802110:	53                   	push   %ebx
+  802111:	83 ec 0c             	sub    $0xc,%esp
+  802114:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802117:	8b 75 10             	mov    0x10(%ebp),%esi
+  80211a:	85 f6                	test   %esi,%esi
+  80211c:	74 30                	je     80214e <readn+0x43>
+  80211e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802123:	b8 00 00 00 00       	mov    $0x0,%eax
+  802128:	83 ec 04             	sub    $0x4,%esp
+  80212b:	89 f2                	mov    %esi,%edx
+  80212d:	29 c2                	sub    %eax,%edx
+  80212f:	52                   	push   %edx
+  802130:	01 f8                	add    %edi,%eax
+  802132:	50                   	push   %eax
+  802133:	ff 75 08             	push   0x8(%ebp)
+  802136:	e8 49 ff ff ff       	call   802084 <read>
+  80213b:	83 c4 10             	add    $0x10,%esp
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	78 15                	js     802157 <readn+0x4c>
+  802142:	74 11                	je     802155 <readn+0x4a>
+  802144:	01 c3                	add    %eax,%ebx
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	39 f3                	cmp    %esi,%ebx
+  80214a:	72 dc                	jb     802128 <readn+0x1d>
+  80214c:	eb 09                	jmp    802157 <readn+0x4c>
+  80214e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802153:	eb 02                	jmp    802157 <readn+0x4c>
+  802155:	89 d8                	mov    %ebx,%eax
+  802157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215a:	5b                   	pop    %ebx
+  80215b:	5e                   	pop    %esi
+  80215c:	5f                   	pop    %edi
+  80215d:	5d                   	pop    %ebp
+  80215e:	c3                   	ret
+
+0080215f <write>:
+  80215f:	55                   	push   %ebp
+  802160:	89 e5                	mov    %esp,%ebp
+  802162:	56                   	push   %esi
+  802163:	53                   	push   %ebx
+  802164:	83 ec 18             	sub    $0x18,%esp
+  802167:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80216a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80216d:	50                   	push   %eax
+  80216e:	53                   	push   %ebx
+  80216f:	e8 ae fc ff ff       	call   801e22 <fd_lookup>
+  802174:	83 c4 10             	add    $0x10,%esp
+  802177:	85 c0                	test   %eax,%eax
+  802179:	78 37                	js     8021b2 <write+0x53>
+  80217b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80217e:	83 ec 08             	sub    $0x8,%esp
+  802181:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802184:	50                   	push   %eax
+  802185:	ff 36                	push   (%esi)
+  802187:	e8 e6 fc ff ff       	call   801e72 <dev_lookup>
+  80218c:	83 c4 10             	add    $0x10,%esp
+  80218f:	85 c0                	test   %eax,%eax
+  802191:	78 1f                	js     8021b2 <write+0x53>
+  802193:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802197:	74 20                	je     8021b9 <write+0x5a>
+  802199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80219c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	74 37                	je     8021da <write+0x7b>
+  8021a3:	83 ec 04             	sub    $0x4,%esp
+  8021a6:	ff 75 10             	push   0x10(%ebp)
+  8021a9:	ff 75 0c             	push   0xc(%ebp)
+  8021ac:	56                   	push   %esi
+  8021ad:	ff d0                	call   *%eax
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b5:	5b                   	pop    %ebx
+  8021b6:	5e                   	pop    %esi
+  8021b7:	5d                   	pop    %ebp
+  8021b8:	c3                   	ret
+  8021b9:	a1 14 50 80 00       	mov    0x805014,%eax
+  8021be:	8b 40 48             	mov    0x48(%eax),%eax
+  8021c1:	83 ec 04             	sub    $0x4,%esp
+  8021c4:	53                   	push   %ebx
+  8021c5:	50                   	push   %eax
+  8021c6:	68 49 3d 80 00       	push   $0x803d49
+  8021cb:	e8 78 e0 ff ff       	call   800248 <cprintf>
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021d8:	eb d8                	jmp    8021b2 <write+0x53>
+  8021da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021df:	eb d1                	jmp    8021b2 <write+0x53>
+
+008021e1 <seek>:
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	83 ec 20             	sub    $0x20,%esp
+  8021e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ea:	50                   	push   %eax
+  8021eb:	ff 75 08             	push   0x8(%ebp)
+  8021ee:	e8 2f fc ff ff       	call   801e22 <fd_lookup>
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	85 c0                	test   %eax,%eax
+  8021f8:	78 0e                	js     802208 <seek+0x27>
+  8021fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802200:	89 50 04             	mov    %edx,0x4(%eax)
+  802203:	b8 00 00 00 00       	mov    $0x0,%eax
+  802208:	c9                   	leave
+  802209:	c3                   	ret
+
+0080220a <ftruncate>:
+  80220a:	55                   	push   %ebp
+  80220b:	89 e5                	mov    %esp,%ebp
+  80220d:	56                   	push   %esi
+  80220e:	53                   	push   %ebx
+  80220f:	83 ec 18             	sub    $0x18,%esp
+  802212:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802215:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802218:	50                   	push   %eax
+  802219:	53                   	push   %ebx
+  80221a:	e8 03 fc ff ff       	call   801e22 <fd_lookup>
+  80221f:	83 c4 10             	add    $0x10,%esp
+  802222:	85 c0                	test   %eax,%eax
+  802224:	78 34                	js     80225a <ftruncate+0x50>
+  802226:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802229:	83 ec 08             	sub    $0x8,%esp
+  80222c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222f:	50                   	push   %eax
+  802230:	ff 36                	push   (%esi)
+  802232:	e8 3b fc ff ff       	call   801e72 <dev_lookup>
+  802237:	83 c4 10             	add    $0x10,%esp
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	78 1c                	js     80225a <ftruncate+0x50>
+  80223e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802242:	74 1d                	je     802261 <ftruncate+0x57>
+  802244:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802247:	8b 40 18             	mov    0x18(%eax),%eax
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	74 34                	je     802282 <ftruncate+0x78>
+  80224e:	83 ec 08             	sub    $0x8,%esp
+  802251:	ff 75 0c             	push   0xc(%ebp)
+  802254:	56                   	push   %esi
+  802255:	ff d0                	call   *%eax
+  802257:	83 c4 10             	add    $0x10,%esp
+  80225a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80225d:	5b                   	pop    %ebx
+  80225e:	5e                   	pop    %esi
+  80225f:	5d                   	pop    %ebp
+  802260:	c3                   	ret
+  802261:	a1 14 50 80 00       	mov    0x805014,%eax
+  802266:	8b 40 48             	mov    0x48(%eax),%eax
+  802269:	83 ec 04             	sub    $0x4,%esp
+  80226c:	53                   	push   %ebx
+  80226d:	50                   	push   %eax
+  80226e:	68 0c 3d 80 00       	push   $0x803d0c
+  802273:	e8 d0 df ff ff       	call   800248 <cprintf>
+  802278:	83 c4 10             	add    $0x10,%esp
+  80227b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802280:	eb d8                	jmp    80225a <ftruncate+0x50>
+  802282:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802287:	eb d1                	jmp    80225a <ftruncate+0x50>
+
+00802289 <fstat>:
+  802289:	55                   	push   %ebp
+  80228a:	89 e5                	mov    %esp,%ebp
+  80228c:	56                   	push   %esi
+  80228d:	53                   	push   %ebx
+  80228e:	83 ec 18             	sub    $0x18,%esp
+  802291:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802294:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802297:	50                   	push   %eax
+  802298:	ff 75 08             	push   0x8(%ebp)
+  80229b:	e8 82 fb ff ff       	call   801e22 <fd_lookup>
+  8022a0:	83 c4 10             	add    $0x10,%esp
+  8022a3:	85 c0                	test   %eax,%eax
+  8022a5:	78 49                	js     8022f0 <fstat+0x67>
+  8022a7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022aa:	83 ec 08             	sub    $0x8,%esp
+  8022ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022b0:	50                   	push   %eax
+  8022b1:	ff 36                	push   (%esi)
+  8022b3:	e8 ba fb ff ff       	call   801e72 <dev_lookup>
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	78 31                	js     8022f0 <fstat+0x67>
+  8022bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8022c6:	74 2f                	je     8022f7 <fstat+0x6e>
+  8022c8:	c6 03 00             	movb   $0x0,(%ebx)
+  8022cb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8022d2:	00 00 00 
+  8022d5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022dc:	00 00 00 
+  8022df:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8022e5:	83 ec 08             	sub    $0x8,%esp
+  8022e8:	53                   	push   %ebx
+  8022e9:	56                   	push   %esi
+  8022ea:	ff 50 14             	call   *0x14(%eax)
+  8022ed:	83 c4 10             	add    $0x10,%esp
+  8022f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f3:	5b                   	pop    %ebx
+  8022f4:	5e                   	pop    %esi
+  8022f5:	5d                   	pop    %ebp
+  8022f6:	c3                   	ret
+  8022f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022fc:	eb f2                	jmp    8022f0 <fstat+0x67>
+
+008022fe <stat>:
+  8022fe:	55                   	push   %ebp
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	56                   	push   %esi
+  802302:	53                   	push   %ebx
+  802303:	83 ec 08             	sub    $0x8,%esp
+  802306:	6a 00                	push   $0x0
+  802308:	ff 75 08             	push   0x8(%ebp)
+  80230b:	e8 31 05 00 00       	call   802841 <open>
+  802310:	89 c3                	mov    %eax,%ebx
+  802312:	83 c4 10             	add    $0x10,%esp
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 1b                	js     802334 <stat+0x36>
+  802319:	83 ec 08             	sub    $0x8,%esp
+  80231c:	ff 75 0c             	push   0xc(%ebp)
+  80231f:	50                   	push   %eax
+  802320:	e8 64 ff ff ff       	call   802289 <fstat>
+  802325:	89 c6                	mov    %eax,%esi
+  802327:	89 1c 24             	mov    %ebx,(%esp)
+  80232a:	e8 19 fc ff ff       	call   801f48 <close>
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	89 f3                	mov    %esi,%ebx
+  802334:	89 d8                	mov    %ebx,%eax
+  802336:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802339:	5b                   	pop    %ebx
+  80233a:	5e                   	pop    %esi
+  80233b:	5d                   	pop    %ebp
+  80233c:	c3                   	ret
+
+0080233d <fsipc>:
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	56                   	push   %esi
+  802341:	53                   	push   %ebx
+  802342:	89 c3                	mov    %eax,%ebx
+  802344:	89 d6                	mov    %edx,%esi
+  802346:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80234d:	74 20                	je     80236f <fsipc+0x32>
+  80234f:	83 ec 08             	sub    $0x8,%esp
+  802352:	6a 00                	push   $0x0
+  802354:	56                   	push   %esi
+  802355:	6a 07                	push   $0x7
+  802357:	68 00 60 80 00       	push   $0x806000
+  80235c:	53                   	push   %ebx
+  80235d:	ff 35 0c 50 80 00    	push   0x80500c
+  802363:	e8 8e f8 ff ff       	call   801bf6 <ipc_call>
+  802368:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80236b:	5b                   	pop    %ebx
+  80236c:	5e                   	pop    %esi
+  80236d:	5d                   	pop    %ebp
+  80236e:	c3                   	ret
+  80236f:	83 ec 0c             	sub    $0xc,%esp
+  802372:	6a 02                	push   $0x2
+  802374:	e8 18 fa ff ff       	call   801d91 <ipc_find_env>
+  802379:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80237e:	83 c4 10             	add    $0x10,%esp
+  802381:	eb cc                	jmp    80234f <fsipc+0x12>
+
+00802383 <devfile_trunc>:
+  802383:	55                   	push   %ebp
+  802384:	89 e5                	mov    %esp,%ebp
+  802386:	83 ec 08             	sub    $0x8,%esp
+  802389:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80238f:	a3 00 60 80 00       	mov    %eax,0x806000
+  802394:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802397:	a3 04 60 80 00       	mov    %eax,0x806004
+  80239c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023a6:	e8 92 ff ff ff       	call   80233d <fsipc>
+  8023ab:	c9                   	leave
+  8023ac:	c3                   	ret
+
+008023ad <devfile_flush>:
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	83 ec 08             	sub    $0x8,%esp
+  8023b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023b9:	a3 00 60 80 00       	mov    %eax,0x806000
+  8023be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023c8:	e8 70 ff ff ff       	call   80233d <fsipc>
+  8023cd:	c9                   	leave
+  8023ce:	c3                   	ret
+
+008023cf <devfile_stat>:
+  8023cf:	55                   	push   %ebp
+  8023d0:	89 e5                	mov    %esp,%ebp
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023dc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023df:	a3 00 60 80 00       	mov    %eax,0x806000
+  8023e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023ee:	e8 4a ff ff ff       	call   80233d <fsipc>
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	78 2c                	js     802423 <devfile_stat+0x54>
+  8023f7:	83 ec 08             	sub    $0x8,%esp
+  8023fa:	68 00 60 80 00       	push   $0x806000
+  8023ff:	53                   	push   %ebx
+  802400:	e8 3a e5 ff ff       	call   80093f <strcpy>
+  802405:	a1 80 60 80 00       	mov    0x806080,%eax
+  80240a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802410:	a1 84 60 80 00       	mov    0x806084,%eax
+  802415:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80241b:	83 c4 10             	add    $0x10,%esp
+  80241e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802423:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802426:	c9                   	leave
+  802427:	c3                   	ret
+
+00802428 <fsring_rw>:
+  802428:	55                   	push   %ebp
+  802429:	89 e5                	mov    %esp,%ebp
+  80242b:	57                   	push   %edi
+  80242c:	56                   	push   %esi
+  80242d:	53                   	push   %ebx
+  80242e:	83 ec 2c             	sub    $0x2c,%esp
+  802431:	89 c7                	mov    %eax,%edi
+  802433:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802436:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802439:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80243e:	a8 01                	test   $0x1,%al
+  802440:	74 0d                	je     80244f <fsring_rw+0x27>
+  802442:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802447:	a8 01                	test   $0x1,%al
+  802449:	0f 85 d5 00 00 00    	jne    802524 <fsring_rw+0xfc>
+  80244f:	a1 14 50 80 00       	mov    0x805014,%eax
+  802454:	8b 40 48             	mov    0x48(%eax),%eax
+  802457:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  80245d:	0f 84 fc 00 00 00    	je     80255f <fsring_rw+0x137>
+  802463:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80246a:	0f 84 02 01 00 00    	je     802572 <fsring_rw+0x14a>
+  802470:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802475:	83 ec 04             	sub    $0x4,%esp
+  802478:	68 07 02 00 00       	push   $0x207
+  80247d:	53                   	push   %ebx
+  80247e:	6a 00                	push   $0x0
+  802480:	e8 1a e9 ff ff       	call   800d9f <sys_page_alloc>
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	0f 88 f9 00 00 00    	js     802589 <fsring_rw+0x161>
+  802490:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802496:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80249c:	75 d7                	jne    802475 <fsring_rw+0x4d>
+  80249e:	6a 0e                	push   $0xe
+  8024a0:	6a 0d                	push   $0xd
+  8024a2:	ff 35 0c 50 80 00    	push   0x80500c
+  8024a8:	68 00 00 f0 cf       	push   $0xcff00000
+  8024ad:	e8 c4 0c 00 00       	call   803176 <ipcring_init>
+  8024b2:	83 c4 08             	add    $0x8,%esp
+  8024b5:	6a 00                	push   $0x0
+  8024b7:	6a 00                	push   $0x0
+  8024b9:	68 07 02 00 00       	push   $0x207
+  8024be:	68 00 00 f0 cf       	push   $0xcff00000
+  8024c3:	6a 0b                	push   $0xb
+  8024c5:	ff 35 0c 50 80 00    	push   0x80500c
+  8024cb:	e8 26 f7 ff ff       	call   801bf6 <ipc_call>
+  8024d0:	89 c6                	mov    %eax,%esi
+  8024d2:	83 c4 20             	add    $0x20,%esp
+  8024d5:	85 c0                	test   %eax,%eax
+  8024d7:	0f 88 ac 00 00 00    	js     802589 <fsring_rw+0x161>
+  8024dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024e2:	89 d9                	mov    %ebx,%ecx
+  8024e4:	83 c3 01             	add    $0x1,%ebx
+  8024e7:	89 da                	mov    %ebx,%edx
+  8024e9:	c1 e2 0c             	shl    $0xc,%edx
+  8024ec:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8024f2:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8024f8:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8024fe:	83 ec 08             	sub    $0x8,%esp
+  802501:	6a 00                	push   $0x0
+  802503:	6a 00                	push   $0x0
+  802505:	68 07 02 00 00       	push   $0x207
+  80250a:	50                   	push   %eax
+  80250b:	6a 0c                	push   $0xc
+  80250d:	ff 35 0c 50 80 00    	push   0x80500c
+  802513:	e8 de f6 ff ff       	call   801bf6 <ipc_call>
+  802518:	83 c4 20             	add    $0x20,%esp
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	78 6a                	js     802589 <fsring_rw+0x161>
+  80251f:	83 fb 08             	cmp    $0x8,%ebx
+  802522:	75 be                	jne    8024e2 <fsring_rw+0xba>
+  802524:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802528:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80252d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802532:	0f 45 c2             	cmovne %edx,%eax
+  802535:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802538:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80253f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802546:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  80254d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802552:	be 00 00 00 00       	mov    $0x0,%esi
+  802557:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80255a:	e9 4b 01 00 00       	jmp    8026aa <fsring_rw+0x282>
+  80255f:	e8 05 ec ff ff       	call   801169 <sys_time_msec>
+  802564:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  80256a:	0f 89 f3 fe ff ff    	jns    802463 <fsring_rw+0x3b>
+  802570:	eb 54                	jmp    8025c6 <fsring_rw+0x19e>
+  802572:	83 ec 0c             	sub    $0xc,%esp
+  802575:	6a 02                	push   $0x2
+  802577:	e8 15 f8 ff ff       	call   801d91 <ipc_find_env>
+  80257c:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	e9 e7 fe ff ff       	jmp    802470 <fsring_rw+0x48>
+  802589:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80258e:	83 ec 08             	sub    $0x8,%esp
+  802591:	53                   	push   %ebx
+  802592:	6a 00                	push   $0x0
+  802594:	e8 d8 e8 ff ff       	call   800e71 <sys_page_unmap>
+  802599:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80259f:	83 c4 10             	add    $0x10,%esp
+  8025a2:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8025a8:	75 e4                	jne    80258e <fsring_rw+0x166>
+  8025aa:	e8 ba eb ff ff       	call   801169 <sys_time_msec>
+  8025af:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8025b4:	a3 04 50 80 00       	mov    %eax,0x805004
+  8025b9:	a1 14 50 80 00       	mov    0x805014,%eax
+  8025be:	8b 40 48             	mov    0x48(%eax),%eax
+  8025c1:	a3 08 50 80 00       	mov    %eax,0x805008
+  8025c6:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8025cd:	e9 7a 01 00 00       	jmp    80274c <fsring_rw+0x324>
+  8025d2:	8b 57 0c             	mov    0xc(%edi),%edx
+  8025d5:	89 10                	mov    %edx,(%eax)
+  8025d7:	89 58 04             	mov    %ebx,0x4(%eax)
+  8025da:	89 f2                	mov    %esi,%edx
+  8025dc:	03 57 04             	add    0x4(%edi),%edx
+  8025df:	89 50 08             	mov    %edx,0x8(%eax)
+  8025e2:	83 ec 04             	sub    $0x4,%esp
+  8025e5:	53                   	push   %ebx
+  8025e6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8025e9:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8025ec:	52                   	push   %edx
+  8025ed:	83 c0 0c             	add    $0xc,%eax
+  8025f0:	50                   	push   %eax
+  8025f1:	e8 f9 e4 ff ff       	call   800aef <memmove>
+  8025f6:	83 c4 10             	add    $0x10,%esp
+  8025f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025fc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025ff:	89 08                	mov    %ecx,(%eax)
+  802601:	83 ec 0c             	sub    $0xc,%esp
+  802604:	68 00 00 f0 cf       	push   $0xcff00000
+  802609:	e8 c6 0b 00 00       	call   8031d4 <ipcring_req_push>
+  80260e:	01 de                	add    %ebx,%esi
+  802610:	83 c4 10             	add    $0x10,%esp
+  802613:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802616:	73 4c                	jae    802664 <fsring_rw+0x23c>
+  802618:	83 ec 0c             	sub    $0xc,%esp
+  80261b:	68 00 00 f0 cf       	push   $0xcff00000
+  802620:	e8 89 0b 00 00       	call   8031ae <ipcring_req_slot>
+  802625:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	74 35                	je     802664 <fsring_rw+0x23c>
+  80262f:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802634:	83 e0 07             	and    $0x7,%eax
+  802637:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80263c:	c1 e0 0c             	shl    $0xc,%eax
+  80263f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802642:	29 f3                	sub    %esi,%ebx
+  802644:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802647:	39 cb                	cmp    %ecx,%ebx
+  802649:	0f 47 d9             	cmova  %ecx,%ebx
+  80264c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802650:	75 80                	jne    8025d2 <fsring_rw+0x1aa>
+  802652:	8b 57 0c             	mov    0xc(%edi),%edx
+  802655:	89 10                	mov    %edx,(%eax)
+  802657:	89 58 04             	mov    %ebx,0x4(%eax)
+  80265a:	89 f2                	mov    %esi,%edx
+  80265c:	03 57 04             	add    0x4(%edi),%edx
+  80265f:	89 50 08             	mov    %edx,0x8(%eax)
+  802662:	eb 95                	jmp    8025f9 <fsring_rw+0x1d1>
+  802664:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802669:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80266c:	83 ec 0c             	sub    $0xc,%esp
+  80266f:	68 00 00 f0 cf       	push   $0xcff00000
+  802674:	e8 94 0b 00 00       	call   80320d <ipcring_rsp_wait>
+  802679:	8b 58 04             	mov    0x4(%eax),%ebx
+  80267c:	83 c4 10             	add    $0x10,%esp
+  80267f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802683:	75 45                	jne    8026ca <fsring_rw+0x2a2>
+  802685:	85 db                	test   %ebx,%ebx
+  802687:	79 41                	jns    8026ca <fsring_rw+0x2a2>
+  802689:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80268c:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802693:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  80269a:	83 ec 0c             	sub    $0xc,%esp
+  80269d:	68 00 00 f0 cf       	push   $0xcff00000
+  8026a2:	e8 cc 0b 00 00       	call   803273 <ipcring_rsp_pop>
+  8026a7:	83 c4 10             	add    $0x10,%esp
+  8026aa:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8026b0:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8026b5:	39 c2                	cmp    %eax,%edx
+  8026b7:	74 75                	je     80272e <fsring_rw+0x306>
+  8026b9:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8026bd:	75 a5                	jne    802664 <fsring_rw+0x23c>
+  8026bf:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8026c2:	0f 82 50 ff ff ff    	jb     802618 <fsring_rw+0x1f0>
+  8026c8:	eb 9a                	jmp    802664 <fsring_rw+0x23c>
+  8026ca:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8026ce:	75 ca                	jne    80269a <fsring_rw+0x272>
+  8026d0:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8026d4:	74 31                	je     802707 <fsring_rw+0x2df>
+  8026d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d9:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8026dc:	29 c8                	sub    %ecx,%eax
+  8026de:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8026e1:	39 d0                	cmp    %edx,%eax
+  8026e3:	0f 47 c2             	cmova  %edx,%eax
+  8026e6:	39 d8                	cmp    %ebx,%eax
+  8026e8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8026ed:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8026f1:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8026f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026f9:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8026fd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802700:	01 d9                	add    %ebx,%ecx
+  802702:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802705:	eb 93                	jmp    80269a <fsring_rw+0x272>
+  802707:	83 ec 04             	sub    $0x4,%esp
+  80270a:	53                   	push   %ebx
+  80270b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80270e:	83 e0 07             	and    $0x7,%eax
+  802711:	c1 e0 0c             	shl    $0xc,%eax
+  802714:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80271a:	50                   	push   %eax
+  80271b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80271e:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802721:	01 c8                	add    %ecx,%eax
+  802723:	50                   	push   %eax
+  802724:	e8 c6 e3 ff ff       	call   800aef <memmove>
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	eb a8                	jmp    8026d6 <fsring_rw+0x2ae>
+  80272e:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802732:	75 09                	jne    80273d <fsring_rw+0x315>
+  802734:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802737:	0f 82 db fe ff ff    	jb     802618 <fsring_rw+0x1f0>
+  80273d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802740:	01 57 04             	add    %edx,0x4(%edi)
+  802743:	85 d2                	test   %edx,%edx
+  802745:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802749:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80274c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80274f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802752:	5b                   	pop    %ebx
+  802753:	5e                   	pop    %esi
+  802754:	5f                   	pop    %edi
+  802755:	5d                   	pop    %ebp
+  802756:	c3                   	ret
+
+00802757 <devfile_write>:
+  802757:	55                   	push   %ebp
+  802758:	89 e5                	mov    %esp,%ebp
+  80275a:	57                   	push   %edi
+  80275b:	56                   	push   %esi
+  80275c:	53                   	push   %ebx
+  80275d:	83 ec 0c             	sub    $0xc,%esp
+  802760:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802763:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802766:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802769:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80276f:	76 1a                	jbe    80278b <devfile_write+0x34>
+  802771:	83 ec 0c             	sub    $0xc,%esp
+  802774:	53                   	push   %ebx
+  802775:	89 f1                	mov    %esi,%ecx
+  802777:	ba 06 00 00 00       	mov    $0x6,%edx
+  80277c:	89 f8                	mov    %edi,%eax
+  80277e:	e8 a5 fc ff ff       	call   802428 <fsring_rw>
+  802783:	83 c4 10             	add    $0x10,%esp
+  802786:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802789:	75 39                	jne    8027c4 <devfile_write+0x6d>
+  80278b:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802790:	39 c3                	cmp    %eax,%ebx
+  802792:	0f 47 d8             	cmova  %eax,%ebx
+  802795:	8b 47 0c             	mov    0xc(%edi),%eax
+  802798:	a3 00 60 80 00       	mov    %eax,0x806000
+  80279d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8027a3:	83 ec 04             	sub    $0x4,%esp
+  8027a6:	53                   	push   %ebx
+  8027a7:	56                   	push   %esi
+  8027a8:	68 08 60 80 00       	push   $0x806008
+  8027ad:	e8 3d e3 ff ff       	call   800aef <memmove>
+  8027b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027bc:	e8 7c fb ff ff       	call   80233d <fsipc>
+  8027c1:	83 c4 10             	add    $0x10,%esp
+  8027c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c7:	5b                   	pop    %ebx
+  8027c8:	5e                   	pop    %esi
+  8027c9:	5f                   	pop    %edi
+  8027ca:	5d                   	pop    %ebp
+  8027cb:	c3                   	ret
+
+008027cc <devfile_read>:
+  8027cc:	55                   	push   %ebp
+  8027cd:	89 e5                	mov    %esp,%ebp
+  8027cf:	57                   	push   %edi
+  8027d0:	56                   	push   %esi
+  8027d1:	53                   	push   %ebx
+  8027d2:	83 ec 0c             	sub    $0xc,%esp
+  8027d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027d8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8027db:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8027e1:	76 1d                	jbe    802800 <devfile_read+0x34>
+  8027e3:	83 ec 0c             	sub    $0xc,%esp
+  8027e6:	56                   	push   %esi
+  8027e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027ea:	ba 05 00 00 00       	mov    $0x5,%edx
+  8027ef:	89 f8                	mov    %edi,%eax
+  8027f1:	e8 32 fc ff ff       	call   802428 <fsring_rw>
+  8027f6:	89 c3                	mov    %eax,%ebx
+  8027f8:	83 c4 10             	add    $0x10,%esp
+  8027fb:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8027fe:	75 37                	jne    802837 <devfile_read+0x6b>
+  802800:	8b 47 0c             	mov    0xc(%edi),%eax
+  802803:	a3 00 60 80 00       	mov    %eax,0x806000
+  802808:	89 35 04 60 80 00    	mov    %esi,0x806004
+  80280e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802813:	b8 03 00 00 00       	mov    $0x3,%eax
+  802818:	e8 20 fb ff ff       	call   80233d <fsipc>
+  80281d:	89 c3                	mov    %eax,%ebx
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	78 14                	js     802837 <devfile_read+0x6b>
+  802823:	83 ec 04             	sub    $0x4,%esp
+  802826:	50                   	push   %eax
+  802827:	68 00 60 80 00       	push   $0x806000
+  80282c:	ff 75 0c             	push   0xc(%ebp)
+  80282f:	e8 bb e2 ff ff       	call   800aef <memmove>
+  802834:	83 c4 10             	add    $0x10,%esp
+  802837:	89 d8                	mov    %ebx,%eax
+  802839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283c:	5b                   	pop    %ebx
+  80283d:	5e                   	pop    %esi
+  80283e:	5f                   	pop    %edi
+  80283f:	5d                   	pop    %ebp
+  802840:	c3                   	ret
+
+00802841 <open>:
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	56                   	push   %esi
+  802845:	53                   	push   %ebx
+  802846:	83 ec 1c             	sub    $0x1c,%esp
+  802849:	8b 75 08             	mov    0x8(%ebp),%esi
+  80284c:	56                   	push   %esi
+  80284d:	e8 a1 e0 ff ff       	call   8008f3 <strlen>
+  802852:	83 c4 10             	add    $0x10,%esp
+  802855:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80285a:	7f 6c                	jg     8028c8 <open+0x87>
+  80285c:	83 ec 0c             	sub    $0xc,%esp
+  80285f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802862:	50                   	push   %eax
+  802863:	e8 6a f5 ff ff       	call   801dd2 <fd_alloc>
+  802868:	89 c3                	mov    %eax,%ebx
+  80286a:	83 c4 10             	add    $0x10,%esp
+  80286d:	85 c0                	test   %eax,%eax
+  80286f:	78 3c                	js     8028ad <open+0x6c>
+  802871:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802874:	a3 00 64 80 00       	mov    %eax,0x806400
+  802879:	83 ec 08             	sub    $0x8,%esp
+  80287c:	56                   	push   %esi
+  80287d:	68 00 60 80 00       	push   $0x806000
+  802882:	e8 b8 e0 ff ff       	call   80093f <strcpy>
+  802887:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80288a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80288f:	e8 a9 fa ff ff       	call   80233d <fsipc>
+  802894:	89 c3                	mov    %eax,%ebx
+  802896:	83 c4 10             	add    $0x10,%esp
+  802899:	85 c0                	test   %eax,%eax
+  80289b:	78 19                	js     8028b6 <open+0x75>
+  80289d:	83 ec 0c             	sub    $0xc,%esp
+  8028a0:	ff 75 f4             	push   -0xc(%ebp)
+  8028a3:	e8 03 f5 ff ff       	call   801dab <fd2num>
+  8028a8:	89 c3                	mov    %eax,%ebx
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	89 d8                	mov    %ebx,%eax
+  8028af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028b2:	5b                   	pop    %ebx
+  8028b3:	5e                   	pop    %esi
+  8028b4:	5d                   	pop    %ebp
+  8028b5:	c3                   	ret
+  8028b6:	83 ec 08             	sub    $0x8,%esp
+  8028b9:	6a 00                	push   $0x0
+  8028bb:	ff 75 f4             	push   -0xc(%ebp)
+  8028be:	e8 05 f6 ff ff       	call   801ec8 <fd_close>
+  8028c3:	83 c4 10             	add    $0x10,%esp
+  8028c6:	eb e5                	jmp    8028ad <open+0x6c>
+  8028c8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8028cd:	eb de                	jmp    8028ad <open+0x6c>
+
+008028cf <file_image>:
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	53                   	push   %ebx
+  8028d3:	83 ec 1c             	sub    $0x1c,%esp
+  8028d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028dc:	50                   	push   %eax
+  8028dd:	ff 75 08             	push   0x8(%ebp)
+  8028e0:	e8 3d f5 ff ff       	call   801e22 <fd_lookup>
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	85 c0                	test   %eax,%eax
+  8028ea:	78 58                	js     802944 <file_image+0x75>
+  8028ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028ef:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8028f5:	39 08                	cmp    %ecx,(%eax)
+  8028f7:	75 50                	jne    802949 <file_image+0x7a>
+  8028f9:	83 fb 04             	cmp    $0x4,%ebx
+  8028fc:	77 52                	ja     802950 <file_image+0x81>
+  8028fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  802901:	a3 00 60 80 00       	mov    %eax,0x806000
+  802906:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80290c:	83 ec 04             	sub    $0x4,%esp
+  80290f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802912:	c1 e0 02             	shl    $0x2,%eax
+  802915:	50                   	push   %eax
+  802916:	ff 75 0c             	push   0xc(%ebp)
+  802919:	68 08 60 80 00       	push   $0x806008
+  80291e:	e8 cc e1 ff ff       	call   800aef <memmove>
+  802923:	ba 00 00 00 00       	mov    $0x0,%edx
+  802928:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80292d:	e8 0b fa ff ff       	call   80233d <fsipc>
+  802932:	83 c4 10             	add    $0x10,%esp
+  802935:	85 c0                	test   %eax,%eax
+  802937:	78 0b                	js     802944 <file_image+0x75>
+  802939:	8b 55 14             	mov    0x14(%ebp),%edx
+  80293c:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  802942:	89 0a                	mov    %ecx,(%edx)
+  802944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802947:	c9                   	leave
+  802948:	c3                   	ret
+  802949:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80294e:	eb f4                	jmp    802944 <file_image+0x75>
+  802950:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802955:	eb ed                	jmp    802944 <file_image+0x75>
+
+00802957 <remove>:
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	53                   	push   %ebx
+  80295b:	83 ec 10             	sub    $0x10,%esp
+  80295e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802961:	53                   	push   %ebx
+  802962:	e8 8c df ff ff       	call   8008f3 <strlen>
+  802967:	83 c4 10             	add    $0x10,%esp
+  80296a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80296f:	7f 25                	jg     802996 <remove+0x3f>
+  802971:	83 ec 08             	sub    $0x8,%esp
+  802974:	53                   	push   %ebx
+  802975:	68 00 60 80 00       	push   $0x806000
+  80297a:	e8 c0 df ff ff       	call   80093f <strcpy>
+  80297f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802984:	b8 09 00 00 00       	mov    $0x9,%eax
+  802989:	e8 af f9 ff ff       	call   80233d <fsipc>
+  80298e:	83 c4 10             	add    $0x10,%esp
+  802991:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802994:	c9                   	leave
+  802995:	c3                   	ret
+  802996:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80299b:	eb f4                	jmp    802991 <remove+0x3a>
+
+0080299d <sync>:
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	83 ec 08             	sub    $0x8,%esp
+  8029a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029ad:	e8 8b f9 ff ff       	call   80233d <fsipc>
+  8029b2:	c9                   	leave
+  8029b3:	c3                   	ret
+
+008029b4 <devsock_stat>:
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	83 ec 10             	sub    $0x10,%esp
+  8029ba:	68 7c 3d 80 00       	push   $0x803d7c
+  8029bf:	ff 75 0c             	push   0xc(%ebp)
+  8029c2:	e8 78 df ff ff       	call   80093f <strcpy>
+  8029c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cc:	c9                   	leave
+  8029cd:	c3                   	ret
+
+008029ce <devsock_close>:
+  8029ce:	55                   	push   %ebp
+  8029cf:	89 e5                	mov    %esp,%ebp
+  8029d1:	53                   	push   %ebx
+  8029d2:	83 ec 10             	sub    $0x10,%esp
+  8029d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029d8:	53                   	push   %ebx
+  8029d9:	e8 cf 0b 00 00       	call   8035ad <pageref>
+  8029de:	89 c2                	mov    %eax,%edx
+  8029e0:	83 c4 10             	add    $0x10,%esp
+  8029e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e8:	83 fa 01             	cmp    $0x1,%edx
+  8029eb:	74 05                	je     8029f2 <devsock_close+0x24>
+  8029ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f0:	c9                   	leave
+  8029f1:	c3                   	ret
+  8029f2:	83 ec 0c             	sub    $0xc,%esp
+  8029f5:	ff 73 0c             	push   0xc(%ebx)
+  8029f8:	e8 aa 02 00 00       	call   802ca7 <nsipc_close>
+  8029fd:	83 c4 10             	add    $0x10,%esp
+  802a00:	eb eb                	jmp    8029ed <devsock_close+0x1f>
+
+00802a02 <devsock_write>:
+  802a02:	55                   	push   %ebp
+  802a03:	89 e5                	mov    %esp,%ebp
+  802a05:	83 ec 08             	sub    $0x8,%esp
+  802a08:	6a 00                	push   $0x0
+  802a0a:	ff 75 10             	push   0x10(%ebp)
+  802a0d:	ff 75 0c             	push   0xc(%ebp)
+  802a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a13:	ff 70 0c             	push   0xc(%eax)
+  802a16:	e8 6c 03 00 00       	call   802d87 <nsipc_send>
+  802a1b:	c9                   	leave
+  802a1c:	c3                   	ret
+
+00802a1d <devsock_read>:
+  802a1d:	55                   	push   %ebp
+  802a1e:	89 e5                	mov    %esp,%ebp
+  802a20:	83 ec 08             	sub    $0x8,%esp
+  802a23:	6a 00                	push   $0x0
+  802a25:	ff 75 10             	push   0x10(%ebp)
+  802a28:	ff 75 0c             	push   0xc(%ebp)
+  802a2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2e:	ff 70 0c             	push   0xc(%eax)
+  802a31:	e8 e2 02 00 00       	call   802d18 <nsipc_recv>
+  802a36:	c9                   	leave
+  802a37:	c3                   	ret
+
+00802a38 <fd2sockid>:
+  802a38:	55                   	push   %ebp
+  802a39:	89 e5                	mov    %esp,%ebp
+  802a3b:	83 ec 20             	sub    $0x20,%esp
+  802a3e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a41:	52                   	push   %edx
+  802a42:	50                   	push   %eax
+  802a43:	e8 da f3 ff ff       	call   801e22 <fd_lookup>
+  802a48:	83 c4 10             	add    $0x10,%esp
+  802a4b:	85 c0                	test   %eax,%eax
+  802a4d:	78 10                	js     802a5f <fd2sockid+0x27>
+  802a4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a52:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a58:	39 08                	cmp    %ecx,(%eax)
+  802a5a:	75 05                	jne    802a61 <fd2sockid+0x29>
+  802a5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a5f:	c9                   	leave
+  802a60:	c3                   	ret
+  802a61:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a66:	eb f7                	jmp    802a5f <fd2sockid+0x27>
+
+00802a68 <alloc_sockfd>:
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	56                   	push   %esi
+  802a6c:	53                   	push   %ebx
+  802a6d:	83 ec 1c             	sub    $0x1c,%esp
+  802a70:	89 c6                	mov    %eax,%esi
+  802a72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a75:	50                   	push   %eax
+  802a76:	e8 57 f3 ff ff       	call   801dd2 <fd_alloc>
+  802a7b:	89 c3                	mov    %eax,%ebx
+  802a7d:	83 c4 10             	add    $0x10,%esp
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	78 43                	js     802ac7 <alloc_sockfd+0x5f>
+  802a84:	83 ec 04             	sub    $0x4,%esp
+  802a87:	68 07 04 00 00       	push   $0x407
+  802a8c:	ff 75 f4             	push   -0xc(%ebp)
+  802a8f:	6a 00                	push   $0x0
+  802a91:	e8 09 e3 ff ff       	call   800d9f <sys_page_alloc>
+  802a96:	89 c3                	mov    %eax,%ebx
+  802a98:	83 c4 10             	add    $0x10,%esp
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	78 28                	js     802ac7 <alloc_sockfd+0x5f>
+  802a9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aa2:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802aa8:	89 10                	mov    %edx,(%eax)
+  802aaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aad:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802ab4:	89 70 0c             	mov    %esi,0xc(%eax)
+  802ab7:	83 ec 0c             	sub    $0xc,%esp
+  802aba:	50                   	push   %eax
+  802abb:	e8 eb f2 ff ff       	call   801dab <fd2num>
+  802ac0:	89 c3                	mov    %eax,%ebx
+  802ac2:	83 c4 10             	add    $0x10,%esp
+  802ac5:	eb 0c                	jmp    802ad3 <alloc_sockfd+0x6b>
+  802ac7:	83 ec 0c             	sub    $0xc,%esp
+  802aca:	56                   	push   %esi
+  802acb:	e8 d7 01 00 00       	call   802ca7 <nsipc_close>
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	89 d8                	mov    %ebx,%eax
+  802ad5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ad8:	5b                   	pop    %ebx
+  802ad9:	5e                   	pop    %esi
+  802ada:	5d                   	pop    %ebp
+  802adb:	c3                   	ret
+
+00802adc <accept>:
+  802adc:	55                   	push   %ebp
+  802add:	89 e5                	mov    %esp,%ebp
+  802adf:	83 ec 08             	sub    $0x8,%esp
+  802ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae5:	e8 4e ff ff ff       	call   802a38 <fd2sockid>
+  802aea:	85 c0                	test   %eax,%eax
+  802aec:	78 1b                	js     802b09 <accept+0x2d>
+  802aee:	83 ec 04             	sub    $0x4,%esp
+  802af1:	ff 75 10             	push   0x10(%ebp)
+  802af4:	ff 75 0c             	push   0xc(%ebp)
+  802af7:	50                   	push   %eax
+  802af8:	e8 07 01 00 00       	call   802c04 <nsipc_accept>
+  802afd:	83 c4 10             	add    $0x10,%esp
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	78 05                	js     802b09 <accept+0x2d>
+  802b04:	e8 5f ff ff ff       	call   802a68 <alloc_sockfd>
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+
+00802b0b <bind>:
+  802b0b:	55                   	push   %ebp
+  802b0c:	89 e5                	mov    %esp,%ebp
+  802b0e:	83 ec 08             	sub    $0x8,%esp
+  802b11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b14:	e8 1f ff ff ff       	call   802a38 <fd2sockid>
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	78 12                	js     802b2f <bind+0x24>
+  802b1d:	83 ec 04             	sub    $0x4,%esp
+  802b20:	ff 75 10             	push   0x10(%ebp)
+  802b23:	ff 75 0c             	push   0xc(%ebp)
+  802b26:	50                   	push   %eax
+  802b27:	e8 24 01 00 00       	call   802c50 <nsipc_bind>
+  802b2c:	83 c4 10             	add    $0x10,%esp
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+00802b31 <shutdown>:
+  802b31:	55                   	push   %ebp
+  802b32:	89 e5                	mov    %esp,%ebp
+  802b34:	83 ec 08             	sub    $0x8,%esp
+  802b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3a:	e8 f9 fe ff ff       	call   802a38 <fd2sockid>
+  802b3f:	85 c0                	test   %eax,%eax
+  802b41:	78 0f                	js     802b52 <shutdown+0x21>
+  802b43:	83 ec 08             	sub    $0x8,%esp
+  802b46:	ff 75 0c             	push   0xc(%ebp)
+  802b49:	50                   	push   %eax
+  802b4a:	e8 36 01 00 00       	call   802c85 <nsipc_shutdown>
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  802b52:	c9                   	leave
+  802b53:	c3                   	ret
+
+00802b54 <connect>:
+  802b54:	55                   	push   %ebp
+  802b55:	89 e5                	mov    %esp,%ebp
+  802b57:	83 ec 08             	sub    $0x8,%esp
+  802b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5d:	e8 d6 fe ff ff       	call   802a38 <fd2sockid>
+  802b62:	85 c0                	test   %eax,%eax
+  802b64:	78 12                	js     802b78 <connect+0x24>
+  802b66:	83 ec 04             	sub    $0x4,%esp
+  802b69:	ff 75 10             	push   0x10(%ebp)
+  802b6c:	ff 75 0c             	push   0xc(%ebp)
+  802b6f:	50                   	push   %eax
+  802b70:	e8 4c 01 00 00       	call   802cc1 <nsipc_connect>
+  802b75:	83 c4 10             	add    $0x10,%esp
+  802b78:	c9                   	leave
+  802b79:	c3                   	ret
+
+00802b7a <listen>:
+  802b7a:	55                   	push   %ebp
+  802b7b:	89 e5                	mov    %esp,%ebp
+  802b7d:	83 ec 08             	sub    $0x8,%esp
+  802b80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b83:	e8 b0 fe ff ff       	call   802a38 <fd2sockid>
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	78 0f                	js     802b9b <listen+0x21>
+  802b8c:	83 ec 08             	sub    $0x8,%esp
+  802b8f:	ff 75 0c             	push   0xc(%ebp)
+  802b92:	50                   	push   %eax
+  802b93:	e8 5e 01 00 00       	call   802cf6 <nsipc_listen>
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+
+00802b9d <socket>:
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	83 ec 0c             	sub    $0xc,%esp
+  802ba3:	ff 75 10             	push   0x10(%ebp)
+  802ba6:	ff 75 0c             	push   0xc(%ebp)
+  802ba9:	ff 75 08             	push   0x8(%ebp)
+  802bac:	e8 34 02 00 00       	call   802de5 <nsipc_socket>
+  802bb1:	83 c4 10             	add    $0x10,%esp
+  802bb4:	85 c0                	test   %eax,%eax
+  802bb6:	78 05                	js     802bbd <socket+0x20>
+  802bb8:	e8 ab fe ff ff       	call   802a68 <alloc_sockfd>
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+00802bbf <nsipc>:
+  802bbf:	55                   	push   %ebp
+  802bc0:	89 e5                	mov    %esp,%ebp
+  802bc2:	53                   	push   %ebx
+  802bc3:	83 ec 04             	sub    $0x4,%esp
+  802bc6:	89 c3                	mov    %eax,%ebx
+  802bc8:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  802bcf:	74 1f                	je     802bf0 <nsipc+0x31>
+  802bd1:	83 ec 08             	sub    $0x8,%esp
+  802bd4:	6a 00                	push   $0x0
+  802bd6:	6a 00                	push   $0x0
+  802bd8:	6a 07                	push   $0x7
+  802bda:	68 00 70 80 00       	push   $0x807000
+  802bdf:	53                   	push   %ebx
+  802be0:	ff 35 10 50 80 00    	push   0x805010
+  802be6:	e8 0b f0 ff ff       	call   801bf6 <ipc_call>
+  802beb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bee:	c9                   	leave
+  802bef:	c3                   	ret
+  802bf0:	83 ec 0c             	sub    $0xc,%esp
+  802bf3:	6a 03                	push   $0x3
+  802bf5:	e8 97 f1 ff ff       	call   801d91 <ipc_find_env>
+  802bfa:	a3 10 50 80 00       	mov    %eax,0x805010
+  802bff:	83 c4 10             	add    $0x10,%esp
+  802c02:	eb cd                	jmp    802bd1 <nsipc+0x12>
+
+00802c04 <nsipc_accept>:
+  802c04:	55                   	push   %ebp
+  802c05:	89 e5                	mov    %esp,%ebp
+  802c07:	53                   	push   %ebx
+  802c08:	83 ec 04             	sub    $0x4,%esp
+  802c0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c13:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c18:	e8 a2 ff ff ff       	call   802bbf <nsipc>
+  802c1d:	89 c3                	mov    %eax,%ebx
+  802c1f:	85 c0                	test   %eax,%eax
+  802c21:	79 07                	jns    802c2a <nsipc_accept+0x26>
+  802c23:	89 d8                	mov    %ebx,%eax
+  802c25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c28:	c9                   	leave
+  802c29:	c3                   	ret
+  802c2a:	83 ec 04             	sub    $0x4,%esp
+  802c2d:	ff 35 10 70 80 00    	push   0x807010
+  802c33:	68 00 70 80 00       	push   $0x807000
+  802c38:	ff 75 0c             	push   0xc(%ebp)
+  802c3b:	e8 af de ff ff       	call   800aef <memmove>
+  802c40:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802c46:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c49:	89 10                	mov    %edx,(%eax)
+  802c4b:	83 c4 10             	add    $0x10,%esp
+  802c4e:	eb d3                	jmp    802c23 <nsipc_accept+0x1f>
+
+00802c50 <nsipc_bind>:
+  802c50:	55                   	push   %ebp
+  802c51:	89 e5                	mov    %esp,%ebp
+  802c53:	53                   	push   %ebx
+  802c54:	83 ec 08             	sub    $0x8,%esp
+  802c57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c5d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c62:	53                   	push   %ebx
+  802c63:	ff 75 0c             	push   0xc(%ebp)
+  802c66:	68 04 70 80 00       	push   $0x807004
+  802c6b:	e8 7f de ff ff       	call   800aef <memmove>
+  802c70:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802c76:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c7b:	e8 3f ff ff ff       	call   802bbf <nsipc>
+  802c80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c83:	c9                   	leave
+  802c84:	c3                   	ret
+
+00802c85 <nsipc_shutdown>:
+  802c85:	55                   	push   %ebp
+  802c86:	89 e5                	mov    %esp,%ebp
+  802c88:	83 ec 08             	sub    $0x8,%esp
+  802c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c8e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802c93:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c96:	a3 04 70 80 00       	mov    %eax,0x807004
+  802c9b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ca0:	e8 1a ff ff ff       	call   802bbf <nsipc>
+  802ca5:	c9                   	leave
+  802ca6:	c3                   	ret
+
+00802ca7 <nsipc_close>:
+  802ca7:	55                   	push   %ebp
+  802ca8:	89 e5                	mov    %esp,%ebp
+  802caa:	83 ec 08             	sub    $0x8,%esp
+  802cad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb0:	a3 00 70 80 00       	mov    %eax,0x807000
+  802cb5:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cba:	e8 00 ff ff ff       	call   802bbf <nsipc>
+  802cbf:	c9                   	leave
+  802cc0:	c3                   	ret
+
+00802cc1 <nsipc_connect>:
+  802cc1:	55                   	push   %ebp
+  802cc2:	89 e5                	mov    %esp,%ebp
+  802cc4:	53                   	push   %ebx
+  802cc5:	83 ec 08             	sub    $0x8,%esp
+  802cc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cce:	a3 00 70 80 00       	mov    %eax,0x807000
+  802cd3:	53                   	push   %ebx
+  802cd4:	ff 75 0c             	push   0xc(%ebp)
+  802cd7:	68 04 70 80 00       	push   $0x807004
+  802cdc:	e8 0e de ff ff       	call   800aef <memmove>
+  802ce1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802ce7:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cec:	e8 ce fe ff ff       	call   802bbf <nsipc>
+  802cf1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cf4:	c9                   	leave
+  802cf5:	c3                   	ret
+
+00802cf6 <nsipc_listen>:
+  802cf6:	55                   	push   %ebp
+  802cf7:	89 e5                	mov    %esp,%ebp
+  802cf9:	83 ec 08             	sub    $0x8,%esp
+  802cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cff:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d04:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d07:	a3 04 70 80 00       	mov    %eax,0x807004
+  802d0c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d11:	e8 a9 fe ff ff       	call   802bbf <nsipc>
+  802d16:	c9                   	leave
+  802d17:	c3                   	ret
+
+00802d18 <nsipc_recv>:
+  802d18:	55                   	push   %ebp
+  802d19:	89 e5                	mov    %esp,%ebp
+  802d1b:	56                   	push   %esi
+  802d1c:	53                   	push   %ebx
+  802d1d:	8b 75 10             	mov    0x10(%ebp),%esi
+  802d20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d23:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d28:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802d2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d31:	a3 08 70 80 00       	mov    %eax,0x807008
+  802d36:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d3b:	e8 7f fe ff ff       	call   802bbf <nsipc>
+  802d40:	89 c3                	mov    %eax,%ebx
+  802d42:	85 c0                	test   %eax,%eax
+  802d44:	78 22                	js     802d68 <nsipc_recv+0x50>
+  802d46:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d4b:	39 c6                	cmp    %eax,%esi
+  802d4d:	0f 4e c6             	cmovle %esi,%eax
+  802d50:	39 c3                	cmp    %eax,%ebx
+  802d52:	7f 1d                	jg     802d71 <nsipc_recv+0x59>
+  802d54:	83 ec 04             	sub    $0x4,%esp
+  802d57:	53                   	push   %ebx
+  802d58:	68 00 70 80 00       	push   $0x807000
+  802d5d:	ff 75 0c             	push   0xc(%ebp)
+  802d60:	e8 8a dd ff ff       	call   800aef <memmove>
+  802d65:	83 c4 10             	add    $0x10,%esp
+  802d68:	89 d8                	mov    %ebx,%eax
+  802d6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d6d:	5b                   	pop    %ebx
+  802d6e:	5e                   	pop    %esi
+  802d6f:	5d                   	pop    %ebp
+  802d70:	c3                   	ret
+  802d71:	68 88 3d 80 00       	push   $0x803d88
+  802d76:	68 9d 3d 80 00       	push   $0x803d9d
+  802d7b:	6a 60                	push   $0x60
+  802d7d:	68 b2 3d 80 00       	push   $0x803db2
+  802d82:	e8 e6 d3 ff ff       	call   80016d <_panic>
+
+00802d87 <nsipc_send>:
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	53                   	push   %ebx
+  802d8b:	83 ec 04             	sub    $0x4,%esp
+  802d8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d94:	a3 00 70 80 00       	mov    %eax,0x807000
+  802d99:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d9f:	7f 2e                	jg     802dcf <nsipc_send+0x48>
+  802da1:	83 ec 04             	sub    $0x4,%esp
+  802da4:	53                   	push   %ebx
+  802da5:	ff 75 0c             	push   0xc(%ebp)
+  802da8:	68 0c 70 80 00       	push   $0x80700c
+  802dad:	e8 3d dd ff ff       	call   800aef <memmove>
+  802db2:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802db8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dbb:	a3 08 70 80 00       	mov    %eax,0x807008
+  802dc0:	b8 08 00 00 00       	mov    $0x8,%eax
+  802dc5:	e8 f5 fd ff ff       	call   802bbf <nsipc>
+  802dca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dcd:	c9                   	leave
+  802dce:	c3                   	ret
+  802dcf:	68 be 3d 80 00       	push   $0x803dbe
+  802dd4:	68 9d 3d 80 00       	push   $0x803d9d
+  802dd9:	6a 6b                	push   $0x6b
+  802ddb:	68 b2 3d 80 00       	push   $0x803db2
+  802de0:	e8 88 d3 ff ff       	call   80016d <_panic>
+
+00802de5 <nsipc_socket>:
+  802de5:	55                   	push   %ebp
+  802de6:	89 e5                	mov    %esp,%ebp
+  802de8:	83 ec 08             	sub    $0x8,%esp
+  802deb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dee:	a3 00 70 80 00       	mov    %eax,0x807000
+  802df3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802df6:	a3 04 70 80 00       	mov    %eax,0x807004
+  802dfb:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dfe:	a3 08 70 80 00       	mov    %eax,0x807008
+  802e03:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e08:	e8 b2 fd ff ff       	call   802bbf <nsipc>
+  802e0d:	c9                   	leave
+  802e0e:	c3                   	ret
+
+00802e0f <devpipe_stat>:
+  802e0f:	55                   	push   %ebp
+  802e10:	89 e5                	mov    %esp,%ebp
+  802e12:	56                   	push   %esi
+  802e13:	53                   	push   %ebx
+  802e14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e17:	83 ec 0c             	sub    $0xc,%esp
+  802e1a:	ff 75 08             	push   0x8(%ebp)
+  802e1d:	e8 99 ef ff ff       	call   801dbb <fd2data>
+  802e22:	89 c6                	mov    %eax,%esi
+  802e24:	83 c4 08             	add    $0x8,%esp
+  802e27:	68 ca 3d 80 00       	push   $0x803dca
+  802e2c:	53                   	push   %ebx
+  802e2d:	e8 0d db ff ff       	call   80093f <strcpy>
+  802e32:	8b 46 04             	mov    0x4(%esi),%eax
+  802e35:	2b 06                	sub    (%esi),%eax
+  802e37:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802e3d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e44:	00 00 00 
+  802e47:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802e4e:	40 80 00 
+  802e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e59:	5b                   	pop    %ebx
+  802e5a:	5e                   	pop    %esi
+  802e5b:	5d                   	pop    %ebp
+  802e5c:	c3                   	ret
+
+00802e5d <devpipe_close>:
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	53                   	push   %ebx
+  802e61:	83 ec 0c             	sub    $0xc,%esp
+  802e64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802e67:	53                   	push   %ebx
+  802e68:	6a 00                	push   $0x0
+  802e6a:	e8 02 e0 ff ff       	call   800e71 <sys_page_unmap>
+  802e6f:	89 1c 24             	mov    %ebx,(%esp)
+  802e72:	e8 44 ef ff ff       	call   801dbb <fd2data>
+  802e77:	83 c4 08             	add    $0x8,%esp
+  802e7a:	50                   	push   %eax
+  802e7b:	6a 00                	push   $0x0
+  802e7d:	e8 ef df ff ff       	call   800e71 <sys_page_unmap>
+  802e82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e85:	c9                   	leave
+  802e86:	c3                   	ret
+
+00802e87 <_pipeisclosed>:
+  802e87:	55                   	push   %ebp
+  802e88:	89 e5                	mov    %esp,%ebp
+  802e8a:	57                   	push   %edi
+  802e8b:	56                   	push   %esi
+  802e8c:	53                   	push   %ebx
+  802e8d:	83 ec 1c             	sub    $0x1c,%esp
+  802e90:	89 c7                	mov    %eax,%edi
+  802e92:	89 d6                	mov    %edx,%esi
+  802e94:	a1 14 50 80 00       	mov    0x805014,%eax
+  802e99:	8b 58 58             	mov    0x58(%eax),%ebx
+  802e9c:	83 ec 0c             	sub    $0xc,%esp
+  802e9f:	57                   	push   %edi
+  802ea0:	e8 08 07 00 00       	call   8035ad <pageref>
+  802ea5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ea8:	89 34 24             	mov    %esi,(%esp)
+  802eab:	e8 fd 06 00 00       	call   8035ad <pageref>
+  802eb0:	8b 15 14 50 80 00    	mov    0x805014,%edx
+  802eb6:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802eb9:	83 c4 10             	add    $0x10,%esp
+  802ebc:	39 cb                	cmp    %ecx,%ebx
+  802ebe:	74 1b                	je     802edb <_pipeisclosed+0x54>
+  802ec0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ec3:	75 cf                	jne    802e94 <_pipeisclosed+0xd>
+  802ec5:	8b 42 58             	mov    0x58(%edx),%eax
+  802ec8:	6a 01                	push   $0x1
+  802eca:	50                   	push   %eax
+  802ecb:	53                   	push   %ebx
+  802ecc:	68 d1 3d 80 00       	push   $0x803dd1
+  802ed1:	e8 72 d3 ff ff       	call   800248 <cprintf>
+  802ed6:	83 c4 10             	add    $0x10,%esp
+  802ed9:	eb b9                	jmp    802e94 <_pipeisclosed+0xd>
+  802edb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ede:	0f 94 c0             	sete   %al
+  802ee1:	0f b6 c0             	movzbl %al,%eax
+  802ee4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ee7:	5b                   	pop    %ebx
+  802ee8:	5e                   	pop    %esi
+  802ee9:	5f                   	pop    %edi
+  802eea:	5d                   	pop    %ebp
+  802eeb:	c3                   	ret
+
+00802eec <devpipe_write>:
+  802eec:	55                   	push   %ebp
+  802eed:	89 e5                	mov    %esp,%ebp
+  802eef:	57                   	push   %edi
+  802ef0:	56                   	push   %esi
+  802ef1:	53                   	push   %ebx
+  802ef2:	83 ec 28             	sub    $0x28,%esp
+  802ef5:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ef8:	56                   	push   %esi
+  802ef9:	e8 bd ee ff ff       	call   801dbb <fd2data>
+  802efe:	89 c3                	mov    %eax,%ebx
+  802f00:	83 c4 10             	add    $0x10,%esp
+  802f03:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f08:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f0c:	74 5c                	je     802f6a <devpipe_write+0x7e>
+  802f0e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f11:	8b 0b                	mov    (%ebx),%ecx
+  802f13:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f16:	39 d0                	cmp    %edx,%eax
+  802f18:	72 1e                	jb     802f38 <devpipe_write+0x4c>
+  802f1a:	89 da                	mov    %ebx,%edx
+  802f1c:	89 f0                	mov    %esi,%eax
+  802f1e:	e8 64 ff ff ff       	call   802e87 <_pipeisclosed>
+  802f23:	85 c0                	test   %eax,%eax
+  802f25:	75 48                	jne    802f6f <devpipe_write+0x83>
+  802f27:	e8 28 de ff ff       	call   800d54 <sys_yield>
+  802f2c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f2f:	8b 0b                	mov    (%ebx),%ecx
+  802f31:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f34:	39 d0                	cmp    %edx,%eax
+  802f36:	73 e2                	jae    802f1a <devpipe_write+0x2e>
+  802f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f3b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f3f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f42:	89 c2                	mov    %eax,%edx
+  802f44:	c1 fa 1f             	sar    $0x1f,%edx
+  802f47:	89 d1                	mov    %edx,%ecx
+  802f49:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f4c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f4f:	83 e2 1f             	and    $0x1f,%edx
+  802f52:	29 ca                	sub    %ecx,%edx
+  802f54:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f58:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802f5c:	83 c0 01             	add    $0x1,%eax
+  802f5f:	89 43 04             	mov    %eax,0x4(%ebx)
+  802f62:	83 c7 01             	add    $0x1,%edi
+  802f65:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802f68:	75 a4                	jne    802f0e <devpipe_write+0x22>
+  802f6a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f6d:	eb 05                	jmp    802f74 <devpipe_write+0x88>
+  802f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f77:	5b                   	pop    %ebx
+  802f78:	5e                   	pop    %esi
+  802f79:	5f                   	pop    %edi
+  802f7a:	5d                   	pop    %ebp
+  802f7b:	c3                   	ret
+
+00802f7c <devpipe_read>:
+  802f7c:	55                   	push   %ebp
+  802f7d:	89 e5                	mov    %esp,%ebp
+  802f7f:	57                   	push   %edi
+  802f80:	56                   	push   %esi
+  802f81:	53                   	push   %ebx
+  802f82:	83 ec 18             	sub    $0x18,%esp
+  802f85:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f88:	56                   	push   %esi
+  802f89:	e8 2d ee ff ff       	call   801dbb <fd2data>
+  802f8e:	89 c3                	mov    %eax,%ebx
+  802f90:	83 c4 10             	add    $0x10,%esp
+  802f93:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f98:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f9c:	74 45                	je     802fe3 <devpipe_read+0x67>
+  802f9e:	8b 03                	mov    (%ebx),%eax
+  802fa0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fa3:	75 1d                	jne    802fc2 <devpipe_read+0x46>
+  802fa5:	85 ff                	test   %edi,%edi
+  802fa7:	75 3f                	jne    802fe8 <devpipe_read+0x6c>
+  802fa9:	89 da                	mov    %ebx,%edx
+  802fab:	89 f0                	mov    %esi,%eax
+  802fad:	e8 d5 fe ff ff       	call   802e87 <_pipeisclosed>
+  802fb2:	85 c0                	test   %eax,%eax
+  802fb4:	75 3c                	jne    802ff2 <devpipe_read+0x76>
+  802fb6:	e8 99 dd ff ff       	call   800d54 <sys_yield>
+  802fbb:	8b 03                	mov    (%ebx),%eax
+  802fbd:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fc0:	74 e7                	je     802fa9 <devpipe_read+0x2d>
+  802fc2:	99                   	cltd
+  802fc3:	c1 ea 1b             	shr    $0x1b,%edx
+  802fc6:	01 d0                	add    %edx,%eax
+  802fc8:	83 e0 1f             	and    $0x1f,%eax
+  802fcb:	29 d0                	sub    %edx,%eax
+  802fcd:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802fd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fd5:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802fd8:	83 03 01             	addl   $0x1,(%ebx)
+  802fdb:	83 c7 01             	add    $0x1,%edi
+  802fde:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802fe1:	75 bb                	jne    802f9e <devpipe_read+0x22>
+  802fe3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fe6:	eb 02                	jmp    802fea <devpipe_read+0x6e>
+  802fe8:	89 f8                	mov    %edi,%eax
+  802fea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fed:	5b                   	pop    %ebx
+  802fee:	5e                   	pop    %esi
+  802fef:	5f                   	pop    %edi
+  802ff0:	5d                   	pop    %ebp
+  802ff1:	c3                   	ret
+  802ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff7:	eb f1                	jmp    802fea <devpipe_read+0x6e>
+
+00802ff9 <pipe>:
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	56                   	push   %esi
+  802ffd:	53                   	push   %ebx
+  802ffe:	83 ec 1c             	sub    $0x1c,%esp
+  803001:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803004:	50                   	push   %eax
+  803005:	e8 c8 ed ff ff       	call   801dd2 <fd_alloc>
+  80300a:	89 c3                	mov    %eax,%ebx
+  80300c:	83 c4 10             	add    $0x10,%esp
+  80300f:	85 c0                	test   %eax,%eax
+  803011:	0f 88 23 01 00 00    	js     80313a <pipe+0x141>
+  803017:	83 ec 04             	sub    $0x4,%esp
+  80301a:	68 07 04 00 00       	push   $0x407
+  80301f:	ff 75 f4             	push   -0xc(%ebp)
+  803022:	6a 00                	push   $0x0
+  803024:	e8 76 dd ff ff       	call   800d9f <sys_page_alloc>
+  803029:	89 c3                	mov    %eax,%ebx
+  80302b:	83 c4 10             	add    $0x10,%esp
+  80302e:	85 c0                	test   %eax,%eax
+  803030:	0f 88 04 01 00 00    	js     80313a <pipe+0x141>
+  803036:	83 ec 0c             	sub    $0xc,%esp
+  803039:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80303c:	50                   	push   %eax
+  80303d:	e8 90 ed ff ff       	call   801dd2 <fd_alloc>
+  803042:	89 c3                	mov    %eax,%ebx
+  803044:	83 c4 10             	add    $0x10,%esp
+  803047:	85 c0                	test   %eax,%eax
+  803049:	0f 88 db 00 00 00    	js     80312a <pipe+0x131>
+  80304f:	83 ec 04             	sub    $0x4,%esp
+  803052:	68 07 04 00 00       	push   $0x407
+  803057:	ff 75 f0             	push   -0x10(%ebp)
+  80305a:	6a 00                	push   $0x0
+  80305c:	e8 3e dd ff ff       	call   800d9f <sys_page_alloc>
+  803061:	89 c3                	mov    %eax,%ebx
+  803063:	83 c4 10             	add    $0x10,%esp
+  803066:	85 c0                	test   %eax,%eax
+  803068:	0f 88 bc 00 00 00    	js     80312a <pipe+0x131>
+  80306e:	83 ec 0c             	sub    $0xc,%esp
+  803071:	ff 75 f4             	push   -0xc(%ebp)
+  803074:	e8 42 ed ff ff       	call   801dbb <fd2data>
+  803079:	89 c6                	mov    %eax,%esi
+  80307b:	83 c4 0c             	add    $0xc,%esp
+  80307e:	68 07 04 00 00       	push   $0x407
+  803083:	50                   	push   %eax
+  803084:	6a 00                	push   $0x0
+  803086:	e8 14 dd ff ff       	call   800d9f <sys_page_alloc>
+  80308b:	89 c3                	mov    %eax,%ebx
+  80308d:	83 c4 10             	add    $0x10,%esp
+  803090:	85 c0                	test   %eax,%eax
+  803092:	0f 88 82 00 00 00    	js     80311a <pipe+0x121>
+  803098:	83 ec 0c             	sub    $0xc,%esp
+  80309b:	ff 75 f0             	push   -0x10(%ebp)
+  80309e:	e8 18 ed ff ff       	call   801dbb <fd2data>
+  8030a3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030aa:	50                   	push   %eax
+  8030ab:	6a 00                	push   $0x0
+  8030ad:	56                   	push   %esi
+  8030ae:	6a 00                	push   $0x0
+  8030b0:	e8 2d dd ff ff       	call   800de2 <sys_page_map>
+  8030b5:	89 c3                	mov    %eax,%ebx
+  8030b7:	83 c4 20             	add    $0x20,%esp
+  8030ba:	85 c0                	test   %eax,%eax
+  8030bc:	78 4e                	js     80310c <pipe+0x113>
+  8030be:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8030c3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030c6:	89 02                	mov    %eax,(%edx)
+  8030c8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030cb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8030d2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030d5:	89 02                	mov    %eax,(%edx)
+  8030d7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030da:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8030e1:	83 ec 0c             	sub    $0xc,%esp
+  8030e4:	ff 75 f4             	push   -0xc(%ebp)
+  8030e7:	e8 bf ec ff ff       	call   801dab <fd2num>
+  8030ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030ef:	89 01                	mov    %eax,(%ecx)
+  8030f1:	83 c4 04             	add    $0x4,%esp
+  8030f4:	ff 75 f0             	push   -0x10(%ebp)
+  8030f7:	e8 af ec ff ff       	call   801dab <fd2num>
+  8030fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030ff:	89 41 04             	mov    %eax,0x4(%ecx)
+  803102:	83 c4 10             	add    $0x10,%esp
+  803105:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80310a:	eb 2e                	jmp    80313a <pipe+0x141>
+  80310c:	83 ec 08             	sub    $0x8,%esp
+  80310f:	56                   	push   %esi
+  803110:	6a 00                	push   $0x0
+  803112:	e8 5a dd ff ff       	call   800e71 <sys_page_unmap>
+  803117:	83 c4 10             	add    $0x10,%esp
+  80311a:	83 ec 08             	sub    $0x8,%esp
+  80311d:	ff 75 f0             	push   -0x10(%ebp)
+  803120:	6a 00                	push   $0x0
+  803122:	e8 4a dd ff ff       	call   800e71 <sys_page_unmap>
+  803127:	83 c4 10             	add    $0x10,%esp
+  80312a:	83 ec 08             	sub    $0x8,%esp
+  80312d:	ff 75 f4             	push   -0xc(%ebp)
+  803130:	6a 00                	push   $0x0
+  803132:	e8 3a dd ff ff       	call   800e71 <sys_page_unmap>
+  803137:	83 c4 10             	add    $0x10,%esp
+  80313a:	89 d8                	mov    %ebx,%eax
+  80313c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80313f:	5b                   	pop    %ebx
+  803140:	5e                   	pop    %esi
+  803141:	5d                   	pop    %ebp
+  803142:	c3                   	ret
+
+00803143 <pipeisclosed>:
+  803143:	55                   	push   %ebp
+  803144:	89 e5                	mov    %esp,%ebp
+  803146:	83 ec 20             	sub    $0x20,%esp
+  803149:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80314c:	50                   	push   %eax
+  80314d:	ff 75 08             	push   0x8(%ebp)
+  803150:	e8 cd ec ff ff       	call   801e22 <fd_lookup>
+  803155:	83 c4 10             	add    $0x10,%esp
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	78 18                	js     803174 <pipeisclosed+0x31>
+  80315c:	83 ec 0c             	sub    $0xc,%esp
+  80315f:	ff 75 f4             	push   -0xc(%ebp)
+  803162:	e8 54 ec ff ff       	call   801dbb <fd2data>
+  803167:	89 c2                	mov    %eax,%edx
+  803169:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80316c:	e8 16 fd ff ff       	call   802e87 <_pipeisclosed>
+  803171:	83 c4 10             	add    $0x10,%esp
+  803174:	c9                   	leave
+  803175:	c3                   	ret
+
+00803176 <ipcring_init>:
+  803176:	55                   	push   %ebp
+  803177:	89 e5                	mov    %esp,%ebp
+  803179:	53                   	push   %ebx
+  80317a:	83 ec 08             	sub    $0x8,%esp
+  80317d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803180:	6a 60                	push   $0x60
+  803182:	6a 00                	push   $0x0
+  803184:	53                   	push   %ebx
+  803185:	e8 30 d9 ff ff       	call   800aba <memset>
+  80318a:	a1 14 50 80 00       	mov    0x805014,%eax
+  80318f:	8b 40 48             	mov    0x48(%eax),%eax
+  803192:	89 03                	mov    %eax,(%ebx)
+  803194:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803197:	89 43 04             	mov    %eax,0x4(%ebx)
+  80319a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80319d:	89 43 08             	mov    %eax,0x8(%ebx)
+  8031a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031a3:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8031a6:	83 c4 10             	add    $0x10,%esp
+  8031a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ac:	c9                   	leave
+  8031ad:	c3                   	ret
+
+008031ae <ipcring_req_slot>:
+  8031ae:	55                   	push   %ebp
+  8031af:	89 e5                	mov    %esp,%ebp
+  8031b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b4:	8b 50 10             	mov    0x10(%eax),%edx
+  8031b7:	8b 48 18             	mov    0x18(%eax),%ecx
+  8031ba:	29 ca                	sub    %ecx,%edx
+  8031bc:	83 fa 07             	cmp    $0x7,%edx
+  8031bf:	77 0c                	ja     8031cd <ipcring_req_slot+0x1f>
+  8031c1:	8b 50 10             	mov    0x10(%eax),%edx
+  8031c4:	83 e2 07             	and    $0x7,%edx
+  8031c7:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  8031cb:	5d                   	pop    %ebp
+  8031cc:	c3                   	ret
+  8031cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d2:	eb f7                	jmp    8031cb <ipcring_req_slot+0x1d>
+
+008031d4 <ipcring_req_push>:
+  8031d4:	55                   	push   %ebp
+  8031d5:	89 e5                	mov    %esp,%ebp
+  8031d7:	83 ec 08             	sub    $0x8,%esp
+  8031da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031dd:	8b 42 10             	mov    0x10(%edx),%eax
+  8031e0:	83 c0 01             	add    $0x1,%eax
+  8031e3:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8031e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ec:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8031f0:	85 c0                	test   %eax,%eax
+  8031f2:	75 02                	jne    8031f6 <ipcring_req_push+0x22>
+  8031f4:	c9                   	leave
+  8031f5:	c3                   	ret
+  8031f6:	6a 00                	push   $0x0
+  8031f8:	68 00 00 80 ee       	push   $0xee800000
+  8031fd:	ff 72 08             	push   0x8(%edx)
+  803200:	ff 72 04             	push   0x4(%edx)
+  803203:	e8 cf de ff ff       	call   8010d7 <sys_ipc_send>
+  803208:	83 c4 10             	add    $0x10,%esp
+  80320b:	eb e7                	jmp    8031f4 <ipcring_req_push+0x20>
+
+0080320d <ipcring_rsp_wait>:
+  80320d:	55                   	push   %ebp
+  80320e:	89 e5                	mov    %esp,%ebp
+  803210:	53                   	push   %ebx
+  803211:	83 ec 04             	sub    $0x4,%esp
+  803214:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803217:	8b 53 18             	mov    0x18(%ebx),%edx
+  80321a:	8b 43 10             	mov    0x10(%ebx),%eax
+  80321d:	39 c2                	cmp    %eax,%edx
+  80321f:	74 3c                	je     80325d <ipcring_rsp_wait+0x50>
+  803221:	8b 53 14             	mov    0x14(%ebx),%edx
+  803224:	8b 43 18             	mov    0x18(%ebx),%eax
+  803227:	39 c2                	cmp    %eax,%edx
+  803229:	75 23                	jne    80324e <ipcring_rsp_wait+0x41>
+  80322b:	83 ec 08             	sub    $0x8,%esp
+  80322e:	6a 00                	push   $0x0
+  803230:	6a 00                	push   $0x0
+  803232:	6a 00                	push   $0x0
+  803234:	6a 00                	push   $0x0
+  803236:	ff 73 0c             	push   0xc(%ebx)
+  803239:	ff 73 04             	push   0x4(%ebx)
+  80323c:	e8 b5 e9 ff ff       	call   801bf6 <ipc_call>
+  803241:	8b 53 14             	mov    0x14(%ebx),%edx
+  803244:	8b 43 18             	mov    0x18(%ebx),%eax
+  803247:	83 c4 20             	add    $0x20,%esp
+  80324a:	39 c2                	cmp    %eax,%edx
+  80324c:	74 dd                	je     80322b <ipcring_rsp_wait+0x1e>
+  80324e:	8b 43 18             	mov    0x18(%ebx),%eax
+  803251:	83 e0 07             	and    $0x7,%eax
+  803254:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80325b:	c9                   	leave
+  80325c:	c3                   	ret
+  80325d:	68 ec 3d 80 00       	push   $0x803dec
+  803262:	68 9d 3d 80 00       	push   $0x803d9d
+  803267:	6a 3b                	push   $0x3b
+  803269:	68 0d 3e 80 00       	push   $0x803e0d
+  80326e:	e8 fa ce ff ff       	call   80016d <_panic>
+
+00803273 <ipcring_rsp_pop>:
+  803273:	55                   	push   %ebp
+  803274:	89 e5                	mov    %esp,%ebp
+  803276:	8b 55 08             	mov    0x8(%ebp),%edx
+  803279:	8b 42 18             	mov    0x18(%edx),%eax
+  80327c:	83 c0 01             	add    $0x1,%eax
+  80327f:	89 42 18             	mov    %eax,0x18(%edx)
+  803282:	5d                   	pop    %ebp
+  803283:	c3                   	ret
+
+00803284 <ipcring_server_init>:
+  803284:	55                   	push   %ebp
+  803285:	89 e5                	mov    %esp,%ebp
+  803287:	8b 45 08             	mov    0x8(%ebp),%eax
+  80328a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80328d:	89 10                	mov    %edx,(%eax)
+  80328f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803292:	89 50 04             	mov    %edx,0x4(%eax)
+  803295:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80329c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8032a3:	5d                   	pop    %ebp
+  8032a4:	c3                   	ret
+
+008032a5 <ipcring_req_avail>:
+  8032a5:	55                   	push   %ebp
+  8032a6:	89 e5                	mov    %esp,%ebp
+  8032a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8032ab:	8b 02                	mov    (%edx),%eax
+  8032ad:	8b 40 10             	mov    0x10(%eax),%eax
+  8032b0:	2b 42 08             	sub    0x8(%edx),%eax
+  8032b3:	ba 08 00 00 00       	mov    $0x8,%edx
+  8032b8:	39 d0                	cmp    %edx,%eax
+  8032ba:	0f 47 c2             	cmova  %edx,%eax
+  8032bd:	5d                   	pop    %ebp
+  8032be:	c3                   	ret
+
+008032bf <ipcring_req_peek>:
+  8032bf:	55                   	push   %ebp
+  8032c0:	89 e5                	mov    %esp,%ebp
+  8032c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8032c5:	8b 42 08             	mov    0x8(%edx),%eax
+  8032c8:	83 e0 07             	and    $0x7,%eax
+  8032cb:	8b 12                	mov    (%edx),%edx
+  8032cd:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8032d1:	5d                   	pop    %ebp
+  8032d2:	c3                   	ret
+
+008032d3 <ipcring_rsp_push>:
+  8032d3:	55                   	push   %ebp
+  8032d4:	89 e5                	mov    %esp,%ebp
+  8032d6:	83 ec 08             	sub    $0x8,%esp
+  8032d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032dc:	8b 41 08             	mov    0x8(%ecx),%eax
+  8032df:	83 c0 01             	add    $0x1,%eax
+  8032e2:	89 41 08             	mov    %eax,0x8(%ecx)
+  8032e5:	8b 11                	mov    (%ecx),%edx
+  8032e7:	83 c2 14             	add    $0x14,%edx
+  8032ea:	f0 87 02             	lock xchg %eax,(%edx)
+  8032ed:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8032f1:	75 02                	jne    8032f5 <ipcring_rsp_push+0x22>
+  8032f3:	c9                   	leave
+  8032f4:	c3                   	ret
+  8032f5:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8032fc:	6a 00                	push   $0x0
+  8032fe:	68 00 00 80 ee       	push   $0xee800000
+  803303:	6a 00                	push   $0x0
+  803305:	ff 71 04             	push   0x4(%ecx)
+  803308:	e8 ed dc ff ff       	call   800ffa <sys_ipc_try_send>
+  80330d:	83 c4 10             	add    $0x10,%esp
+  803310:	eb e1                	jmp    8032f3 <ipcring_rsp_push+0x20>
+
+00803312 <ipcring_client_wait>:
+  803312:	55                   	push   %ebp
+  803313:	89 e5                	mov    %esp,%ebp
+  803315:	83 ec 08             	sub    $0x8,%esp
+  803318:	8b 45 08             	mov    0x8(%ebp),%eax
+  80331b:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803322:	8b 10                	mov    (%eax),%edx
+  803324:	8b 52 18             	mov    0x18(%edx),%edx
+  803327:	3b 50 08             	cmp    0x8(%eax),%edx
+  80332a:	75 02                	jne    80332e <ipcring_client_wait+0x1c>
+  80332c:	c9                   	leave
+  80332d:	c3                   	ret
+  80332e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803335:	6a 00                	push   $0x0
+  803337:	68 00 00 80 ee       	push   $0xee800000
+  80333c:	6a 00                	push   $0x0
+  80333e:	ff 70 04             	push   0x4(%eax)
+  803341:	e8 b4 dc ff ff       	call   800ffa <sys_ipc_try_send>
+  803346:	83 c4 10             	add    $0x10,%esp
+  803349:	eb e1                	jmp    80332c <ipcring_client_wait+0x1a>
+
+0080334b <ipcring_server_sleep>:
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	53                   	push   %ebx
+  80334f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803352:	8b 01                	mov    (%ecx),%eax
+  803354:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803357:	b8 01 00 00 00       	mov    $0x1,%eax
+  80335c:	f0 87 02             	lock xchg %eax,(%edx)
+  80335f:	8b 11                	mov    (%ecx),%edx
+  803361:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803364:	b8 01 00 00 00       	mov    $0x1,%eax
+  803369:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80336c:	74 0e                	je     80337c <ipcring_server_sleep+0x31>
+  80336e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803373:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80337c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80337f:	c9                   	leave
+  803380:	c3                   	ret
+
+00803381 <devcons_close>:
+  803381:	b8 00 00 00 00       	mov    $0x0,%eax
+  803386:	c3                   	ret
+
+00803387 <devcons_stat>:
+  803387:	55                   	push   %ebp
+  803388:	89 e5                	mov    %esp,%ebp
+  80338a:	83 ec 10             	sub    $0x10,%esp
+  80338d:	68 1b 3e 80 00       	push   $0x803e1b
+  803392:	ff 75 0c             	push   0xc(%ebp)
+  803395:	e8 a5 d5 ff ff       	call   80093f <strcpy>
+  80339a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339f:	c9                   	leave
+  8033a0:	c3                   	ret
+
+008033a1 <devcons_write>:
+  8033a1:	55                   	push   %ebp
+  8033a2:	89 e5                	mov    %esp,%ebp
+  8033a4:	57                   	push   %edi
+  8033a5:	56                   	push   %esi
+  8033a6:	53                   	push   %ebx
+  8033a7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8033ad:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8033b0:	85 ff                	test   %edi,%edi
+  8033b2:	74 51                	je     803405 <devcons_write+0x64>
+  8033b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033be:	89 fb                	mov    %edi,%ebx
+  8033c0:	29 c3                	sub    %eax,%ebx
+  8033c2:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8033c7:	39 d3                	cmp    %edx,%ebx
+  8033c9:	0f 47 da             	cmova  %edx,%ebx
+  8033cc:	83 ec 04             	sub    $0x4,%esp
+  8033cf:	53                   	push   %ebx
+  8033d0:	03 45 0c             	add    0xc(%ebp),%eax
+  8033d3:	50                   	push   %eax
+  8033d4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033da:	50                   	push   %eax
+  8033db:	e8 0f d7 ff ff       	call   800aef <memmove>
+  8033e0:	83 c4 08             	add    $0x8,%esp
+  8033e3:	53                   	push   %ebx
+  8033e4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033ea:	50                   	push   %eax
+  8033eb:	e8 c7 d8 ff ff       	call   800cb7 <sys_cputs>
+  8033f0:	01 de                	add    %ebx,%esi
+  8033f2:	89 f0                	mov    %esi,%eax
+  8033f4:	83 c4 10             	add    $0x10,%esp
+  8033f7:	39 fe                	cmp    %edi,%esi
+  8033f9:	72 c3                	jb     8033be <devcons_write+0x1d>
+  8033fb:	89 f0                	mov    %esi,%eax
+  8033fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803400:	5b                   	pop    %ebx
+  803401:	5e                   	pop    %esi
+  803402:	5f                   	pop    %edi
+  803403:	5d                   	pop    %ebp
+  803404:	c3                   	ret
+  803405:	be 00 00 00 00       	mov    $0x0,%esi
+  80340a:	eb ef                	jmp    8033fb <devcons_write+0x5a>
+
+0080340c <devcons_read>:
+  80340c:	55                   	push   %ebp
+  80340d:	89 e5                	mov    %esp,%ebp
+  80340f:	83 ec 08             	sub    $0x8,%esp
+  803412:	b8 00 00 00 00       	mov    $0x0,%eax
+  803417:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80341b:	75 07                	jne    803424 <devcons_read+0x18>
+  80341d:	eb 1f                	jmp    80343e <devcons_read+0x32>
+  80341f:	e8 30 d9 ff ff       	call   800d54 <sys_yield>
+  803424:	e8 ac d8 ff ff       	call   800cd5 <sys_cgetc>
+  803429:	85 c0                	test   %eax,%eax
+  80342b:	74 f2                	je     80341f <devcons_read+0x13>
+  80342d:	78 0f                	js     80343e <devcons_read+0x32>
+  80342f:	83 f8 04             	cmp    $0x4,%eax
+  803432:	74 0c                	je     803440 <devcons_read+0x34>
+  803434:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803437:	88 02                	mov    %al,(%edx)
+  803439:	b8 01 00 00 00       	mov    $0x1,%eax
+  80343e:	c9                   	leave
+  80343f:	c3                   	ret
+  803440:	b8 00 00 00 00       	mov    $0x0,%eax
+  803445:	eb f7                	jmp    80343e <devcons_read+0x32>
+
+00803447 <cputchar>:
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	83 ec 20             	sub    $0x20,%esp
+  80344d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803450:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803453:	6a 01                	push   $0x1
+  803455:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803458:	50                   	push   %eax
+  803459:	e8 59 d8 ff ff       	call   800cb7 <sys_cputs>
+  80345e:	83 c4 10             	add    $0x10,%esp
+  803461:	c9                   	leave
+  803462:	c3                   	ret
+
+00803463 <getchar>:
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	83 ec 1c             	sub    $0x1c,%esp
+  803469:	6a 01                	push   $0x1
+  80346b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80346e:	50                   	push   %eax
+  80346f:	6a 00                	push   $0x0
+  803471:	e8 0e ec ff ff       	call   802084 <read>
+  803476:	83 c4 10             	add    $0x10,%esp
+  803479:	85 c0                	test   %eax,%eax
+  80347b:	78 06                	js     803483 <getchar+0x20>
+  80347d:	74 06                	je     803485 <getchar+0x22>
+  80347f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803483:	c9                   	leave
+  803484:	c3                   	ret
+  803485:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80348a:	eb f7                	jmp    803483 <getchar+0x20>
+
+0080348c <iscons>:
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	83 ec 20             	sub    $0x20,%esp
+  803492:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803495:	50                   	push   %eax
+  803496:	ff 75 08             	push   0x8(%ebp)
+  803499:	e8 84 e9 ff ff       	call   801e22 <fd_lookup>
+  80349e:	83 c4 10             	add    $0x10,%esp
+  8034a1:	85 c0                	test   %eax,%eax
+  8034a3:	78 11                	js     8034b6 <iscons+0x2a>
+  8034a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034a8:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8034ae:	39 10                	cmp    %edx,(%eax)
+  8034b0:	0f 94 c0             	sete   %al
+  8034b3:	0f b6 c0             	movzbl %al,%eax
+  8034b6:	c9                   	leave
+  8034b7:	c3                   	ret
+
+008034b8 <opencons>:
+  8034b8:	55                   	push   %ebp
+  8034b9:	89 e5                	mov    %esp,%ebp
+  8034bb:	83 ec 24             	sub    $0x24,%esp
+  8034be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034c1:	50                   	push   %eax
+  8034c2:	e8 0b e9 ff ff       	call   801dd2 <fd_alloc>
+  8034c7:	83 c4 10             	add    $0x10,%esp
+  8034ca:	85 c0                	test   %eax,%eax
+  8034cc:	78 3a                	js     803508 <opencons+0x50>
+  8034ce:	83 ec 04             	sub    $0x4,%esp
+  8034d1:	68 07 04 00 00       	push   $0x407
+  8034d6:	ff 75 f4             	push   -0xc(%ebp)
+  8034d9:	6a 00                	push   $0x0
+  8034db:	e8 bf d8 ff ff       	call   800d9f <sys_page_alloc>
+  8034e0:	83 c4 10             	add    $0x10,%esp
+  8034e3:	85 c0                	test   %eax,%eax
+  8034e5:	78 21                	js     803508 <opencons+0x50>
+  8034e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034ea:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8034f0:	89 10                	mov    %edx,(%eax)
+  8034f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034f5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8034fc:	83 ec 0c             	sub    $0xc,%esp
+  8034ff:	50                   	push   %eax
+  803500:	e8 a6 e8 ff ff       	call   801dab <fd2num>
+  803505:	83 c4 10             	add    $0x10,%esp
+  803508:	c9                   	leave
+  803509:	c3                   	ret
+
+0080350a <set_pgfault_handler>:
+  80350a:	55                   	push   %ebp
+  80350b:	89 e5                	mov    %esp,%ebp
+  80350d:	53                   	push   %ebx
+  80350e:	83 ec 04             	sub    $0x4,%esp
+  803511:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803518:	74 0d                	je     803527 <set_pgfault_handler+0x1d>
+  80351a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80351d:	a3 00 80 80 00       	mov    %eax,0x808000
+  803522:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803525:	c9                   	leave
+  803526:	c3                   	ret
+  803527:	e8 09 d8 ff ff       	call   800d35 <sys_getenvid>
+  80352c:	89 c3                	mov    %eax,%ebx
+  80352e:	83 ec 04             	sub    $0x4,%esp
+  803531:	6a 07                	push   $0x7
+  803533:	68 00 f0 7f ee       	push   $0xee7ff000
+  803538:	50                   	push   %eax
+  803539:	e8 61 d8 ff ff       	call   800d9f <sys_page_alloc>
+  80353e:	83 c4 10             	add    $0x10,%esp
+  803541:	85 c0                	test   %eax,%eax
+  803543:	78 29                	js     80356e <set_pgfault_handler+0x64>
+  803545:	83 ec 08             	sub    $0x8,%esp
+  803548:	68 82 35 80 00       	push   $0x803582
+  80354d:	53                   	push   %ebx
+  80354e:	e8 65 da ff ff       	call   800fb8 <sys_env_set_pgfault_upcall>
+  803553:	83 c4 10             	add    $0x10,%esp
+  803556:	85 c0                	test   %eax,%eax
+  803558:	79 c0                	jns    80351a <set_pgfault_handler+0x10>
+  80355a:	83 ec 04             	sub    $0x4,%esp
+  80355d:	68 60 3e 80 00       	push   $0x803e60
+  803562:	6a 27                	push   $0x27
+  803564:	68 92 3e 80 00       	push   $0x803e92
+  803569:	e8 ff cb ff ff       	call   80016d <_panic>
+  80356e:	83 ec 04             	sub    $0x4,%esp
+  803571:	68 28 3e 80 00       	push   $0x803e28
+  803576:	6a 23                	push   $0x23
+  803578:	68 92 3e 80 00       	push   $0x803e92
+  80357d:	e8 eb cb ff ff       	call   80016d <_panic>
+
+00803582 <_pgfault_upcall>:
+  803582:	54                   	push   %esp
+  803583:	a1 00 80 80 00       	mov    0x808000,%eax
+  803588:	ff d0                	call   *%eax
+  80358a:	83 c4 04             	add    $0x4,%esp
+  80358d:	89 e3                	mov    %esp,%ebx
+  80358f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803593:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803597:	89 d4                	mov    %edx,%esp
+  803599:	51                   	push   %ecx
+  80359a:	89 dc                	mov    %ebx,%esp
+  80359c:	83 ea 04             	sub    $0x4,%edx
+  80359f:	89 54 24 30          	mov    %edx,0x30(%esp)
+  8035a3:	83 c4 08             	add    $0x8,%esp
+  8035a6:	61                   	popa
+  8035a7:	83 c4 04             	add    $0x4,%esp
+  8035aa:	9d                   	popf
+  8035ab:	5c                   	pop    %esp
+  8035ac:	c3                   	ret
+
+008035ad <pageref>:
+  8035ad:	55                   	push   %ebp
+  8035ae:	89 e5                	mov    %esp,%ebp
+  8035b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b3:	89 c2                	mov    %eax,%edx
+  8035b5:	c1 ea 16             	shr    $0x16,%edx
+  8035b8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8035bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c4:	f6 c1 01             	test   $0x1,%cl
+  8035c7:	74 22                	je     8035eb <pageref+0x3e>
+  8035c9:	c1 e8 0c             	shr    $0xc,%eax
+  8035cc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035d3:	a8 01                	test   $0x1,%al
+  8035d5:	74 14                	je     8035eb <pageref+0x3e>
+  8035d7:	c1 e8 0c             	shr    $0xc,%eax
+  8035da:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035dd:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035e4:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035e8:	0f b7 d2             	movzwl %dx,%edx
+  8035eb:	89 d0                	mov    %edx,%eax
+  8035ed:	5d                   	pop    %ebp
+  8035ee:	c3                   	ret
+
+008035ef <__udivmoddi4>:
+  8035ef:	55                   	push   %ebp
+  8035f0:	57                   	push   %edi
+  8035f1:	56                   	push   %esi
+  8035f2:	53                   	push   %ebx
+  8035f3:	83 ec 24             	sub    $0x24,%esp
+  8035f6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035fa:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035fe:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803602:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803606:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80360a:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80360e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803612:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803616:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80361a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803624:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803629:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803630:	00 
+  803631:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803638:	00 
+  803639:	89 fb                	mov    %edi,%ebx
+  80363b:	eb 08                	jmp    803645 <__udivmoddi4+0x56>
+  80363d:	83 e9 01             	sub    $0x1,%ecx
+  803640:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803643:	74 68                	je     8036ad <__udivmoddi4+0xbe>
+  803645:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803649:	01 c0                	add    %eax,%eax
+  80364b:	89 c6                	mov    %eax,%esi
+  80364d:	89 d7                	mov    %edx,%edi
+  80364f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803653:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803657:	0f ad d0             	shrd   %cl,%edx,%eax
+  80365a:	d3 ea                	shr    %cl,%edx
+  80365c:	f6 c1 20             	test   $0x20,%cl
+  80365f:	74 04                	je     803665 <__udivmoddi4+0x76>
+  803661:	89 d0                	mov    %edx,%eax
+  803663:	31 d2                	xor    %edx,%edx
+  803665:	83 e0 01             	and    $0x1,%eax
+  803668:	89 04 24             	mov    %eax,(%esp)
+  80366b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803672:	00 
+  803673:	8b 04 24             	mov    (%esp),%eax
+  803676:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80367a:	09 f0                	or     %esi,%eax
+  80367c:	09 fa                	or     %edi,%edx
+  80367e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803682:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803686:	39 f0                	cmp    %esi,%eax
+  803688:	89 d5                	mov    %edx,%ebp
+  80368a:	19 fd                	sbb    %edi,%ebp
+  80368c:	72 af                	jb     80363d <__udivmoddi4+0x4e>
+  80368e:	29 f0                	sub    %esi,%eax
+  803690:	19 fa                	sbb    %edi,%edx
+  803692:	89 cf                	mov    %ecx,%edi
+  803694:	c1 ef 05             	shr    $0x5,%edi
+  803697:	83 e7 01             	and    $0x1,%edi
+  80369a:	89 fe                	mov    %edi,%esi
+  80369c:	83 f6 01             	xor    $0x1,%esi
+  80369f:	d3 e6                	shl    %cl,%esi
+  8036a1:	d3 e7                	shl    %cl,%edi
+  8036a3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8036a7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8036ab:	eb 90                	jmp    80363d <__udivmoddi4+0x4e>
+  8036ad:	85 db                	test   %ebx,%ebx
+  8036af:	74 05                	je     8036b6 <__udivmoddi4+0xc7>
+  8036b1:	89 03                	mov    %eax,(%ebx)
+  8036b3:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036b6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036ba:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036be:	83 c4 24             	add    $0x24,%esp
+  8036c1:	5b                   	pop    %ebx
+  8036c2:	5e                   	pop    %esi
+  8036c3:	5f                   	pop    %edi
+  8036c4:	5d                   	pop    %ebp
+  8036c5:	c3                   	ret
+
+008036c6 <__udivdi3>:
+  8036c6:	83 ec 08             	sub    $0x8,%esp
+  8036c9:	6a 00                	push   $0x0
+  8036cb:	ff 74 24 1c          	push   0x1c(%esp)
+  8036cf:	ff 74 24 1c          	push   0x1c(%esp)
+  8036d3:	ff 74 24 1c          	push   0x1c(%esp)
+  8036d7:	ff 74 24 1c          	push   0x1c(%esp)
+  8036db:	e8 0f ff ff ff       	call   8035ef <__udivmoddi4>
+  8036e0:	83 c4 1c             	add    $0x1c,%esp
+  8036e3:	c3                   	ret
+
+008036e4 <__umoddi3>:
+  8036e4:	83 ec 18             	sub    $0x18,%esp
+  8036e7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036eb:	50                   	push   %eax
+  8036ec:	ff 74 24 2c          	push   0x2c(%esp)
+  8036f0:	ff 74 24 2c          	push   0x2c(%esp)
+  8036f4:	ff 74 24 2c          	push   0x2c(%esp)
+  8036f8:	ff 74 24 2c          	push   0x2c(%esp)
+  8036fc:	e8 ee fe ff ff       	call   8035ef <__udivmoddi4>
+  803701:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803705:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803709:	83 c4 2c             	add    $0x2c,%esp
+  80370c:	c3                   	ret
+
+0080370d <__divdi3>:
+  80370d:	53                   	push   %ebx
+  80370e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803712:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803716:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80371a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80371e:	85 d2                	test   %edx,%edx
+  803720:	78 12                	js     803734 <__divdi3+0x27>
+  803722:	85 db                	test   %ebx,%ebx
+  803724:	78 2e                	js     803754 <__divdi3+0x47>
+  803726:	53                   	push   %ebx
+  803727:	51                   	push   %ecx
+  803728:	52                   	push   %edx
+  803729:	50                   	push   %eax
+  80372a:	e8 97 ff ff ff       	call   8036c6 <__udivdi3>
+  80372f:	83 c4 10             	add    $0x10,%esp
+  803732:	eb 1e                	jmp    803752 <__divdi3+0x45>
+  803734:	f7 d8                	neg    %eax
+  803736:	83 d2 00             	adc    $0x0,%edx
+  803739:	f7 da                	neg    %edx
+  80373b:	85 db                	test   %ebx,%ebx
+  80373d:	78 2a                	js     803769 <__divdi3+0x5c>
+  80373f:	53                   	push   %ebx
+  803740:	51                   	push   %ecx
+  803741:	52                   	push   %edx
+  803742:	50                   	push   %eax
+  803743:	e8 7e ff ff ff       	call   8036c6 <__udivdi3>
+  803748:	83 c4 10             	add    $0x10,%esp
+  80374b:	f7 d8                	neg    %eax
+  80374d:	83 d2 00             	adc    $0x0,%edx
+  803750:	f7 da                	neg    %edx
+  803752:	5b                   	pop    %ebx
+  803753:	c3                   	ret
+  803754:	f7 d9                	neg    %ecx
+  803756:	83 d3 00             	adc    $0x0,%ebx
+  803759:	f7 db                	neg    %ebx
+  80375b:	53                   	push   %ebx
+  80375c:	51                   	push   %ecx
+  80375d:	52                   	push   %edx
+  80375e:	50                   	push   %eax
+  80375f:	e8 62 ff ff ff       	call   8036c6 <__udivdi3>
+  803764:	83 c4 10             	add    $0x10,%esp
+  803767:	eb e2                	jmp    80374b <__divdi3+0x3e>
+  803769:	f7 d9                	neg    %ecx
+  80376b:	83 d3 00             	adc    $0x0,%ebx
+  80376e:	f7 db                	neg    %ebx
+  803770:	53                   	push   %ebx
+  803771:	51                   	push   %ecx
+  803772:	52                   	push   %edx
+  803773:	50                   	push   %eax
+  803774:	e8 4d ff ff ff       	call   8036c6 <__udivdi3>
+  803779:	83 c4 10             	add    $0x10,%esp
+  80377c:	eb d4                	jmp    803752 <__divdi3+0x45>
+
+0080377e <__moddi3>:
+  80377e:	55                   	push   %ebp
+  80377f:	57                   	push   %edi
+  803780:	56                   	push   %esi
+  803781:	53                   	push   %ebx
+  803782:	83 ec 0c             	sub    $0xc,%esp
+  803785:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803789:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80378d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803791:	89 e9                	mov    %ebp,%ecx
+  803793:	f7 d9                	neg    %ecx
+  803795:	89 d0                	mov    %edx,%eax
+  803797:	83 d0 00             	adc    $0x0,%eax
+  80379a:	f7 d8                	neg    %eax
+  80379c:	0f 49 e9             	cmovns %ecx,%ebp
+  80379f:	0f 49 d0             	cmovns %eax,%edx
+  8037a2:	52                   	push   %edx
+  8037a3:	55                   	push   %ebp
+  8037a4:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8037a8:	f7 da                	neg    %edx
+  8037aa:	89 d8                	mov    %ebx,%eax
+  8037ac:	83 d0 00             	adc    $0x0,%eax
+  8037af:	f7 d8                	neg    %eax
+  8037b1:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8037b6:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8037ba:	0f 48 c3             	cmovs  %ebx,%eax
+  8037bd:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8037c1:	ff 74 24 0c          	push   0xc(%esp)
+  8037c5:	ff 74 24 0c          	push   0xc(%esp)
+  8037c9:	e8 16 ff ff ff       	call   8036e4 <__umoddi3>
+  8037ce:	83 c4 10             	add    $0x10,%esp
+  8037d1:	85 db                	test   %ebx,%ebx
+  8037d3:	78 08                	js     8037dd <__moddi3+0x5f>
+  8037d5:	83 c4 0c             	add    $0xc,%esp
+  8037d8:	5b                   	pop    %ebx
+  8037d9:	5e                   	pop    %esi
+  8037da:	5f                   	pop    %edi
+  8037db:	5d                   	pop    %ebp
+  8037dc:	c3                   	ret
+  8037dd:	f7 d8                	neg    %eax
+  8037df:	83 d2 00             	adc    $0x0,%edx
+  8037e2:	f7 da                	neg    %edx
+  8037e4:	eb ef                	jmp    8037d5 <__moddi3+0x57>
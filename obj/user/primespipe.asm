@@ -0,0 +1,5665 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 90 1f 00 00       	call   801fe1 <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 81 39 80 00       	push   $0x803981
+  800064:	e8 22 03 00 00       	call   80038b <cprintf>
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 5e 2e 00 00       	call   802ecf <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+  80007b:	e8 b0 18 00 00       	call   801930 <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 8f 1d 00 00       	call   801e1e <close>
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 84 1d 00 00       	call   801e1e <close>
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 40 39 80 00       	push   $0x803940
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 6f 39 80 00       	push   $0x80396f
+  8000bd:	e8 ee 01 00 00       	call   8002b0 <_panic>
+  8000c2:	50                   	push   %eax
+  8000c3:	68 85 39 80 00       	push   $0x803985
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 6f 39 80 00       	push   $0x80396f
+  8000cf:	e8 dc 01 00 00       	call   8002b0 <_panic>
+  8000d4:	50                   	push   %eax
+  8000d5:	68 8e 39 80 00       	push   $0x80398e
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 6f 39 80 00       	push   $0x80396f
+  8000e1:	e8 ca 01 00 00       	call   8002b0 <_panic>
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 2d 1d 00 00       	call   801e1e <close>
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 db 1e 00 00       	call   801fe1 <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 0d 1f 00 00       	call   802035 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 b3 39 80 00       	push   $0x8039b3
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 6f 39 80 00       	push   $0x80396f
+  80014e:	e8 5d 01 00 00       	call   8002b0 <_panic>
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 97 39 80 00       	push   $0x803997
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 6f 39 80 00       	push   $0x80396f
+  800172:	e8 39 01 00 00       	call   8002b0 <_panic>
+
+00800177 <umain>:
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+  80017e:	c7 05 00 50 80 00 cd 	movl   $0x8039cd,0x805000
+  800185:	39 80 00 
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 3e 2d 00 00       	call   802ecf <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+  80019b:	e8 90 17 00 00       	call   801930 <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 6d 1c 00 00       	call   801e1e <close>
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+  8001bc:	50                   	push   %eax
+  8001bd:	68 85 39 80 00       	push   $0x803985
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 6f 39 80 00       	push   $0x80396f
+  8001c9:	e8 e2 00 00 00       	call   8002b0 <_panic>
+  8001ce:	50                   	push   %eax
+  8001cf:	68 8e 39 80 00       	push   $0x80398e
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 6f 39 80 00       	push   $0x80396f
+  8001db:	e8 d0 00 00 00       	call   8002b0 <_panic>
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 33 1c 00 00       	call   801e1e <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 26 1e 00 00       	call   802035 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 d8 39 80 00       	push   $0x8039d8
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 6f 39 80 00       	push   $0x80396f
+  800232:	e8 79 00 00 00       	call   8002b0 <_panic>
+
+00800237 <libmain>:
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  80023c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80023f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800242:	e8 31 0c 00 00       	call   800e78 <sys_getenvid>
+  800247:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80024c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800252:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800257:	a3 14 60 80 00       	mov    %eax,0x806014
+  80025c:	85 db                	test   %ebx,%ebx
+  80025e:	7e 07                	jle    800267 <libmain+0x30>
+  800260:	8b 06                	mov    (%esi),%eax
+  800262:	a3 00 50 80 00       	mov    %eax,0x805000
+  800267:	83 ec 08             	sub    $0x8,%esp
+  80026a:	56                   	push   %esi
+  80026b:	53                   	push   %ebx
+  80026c:	e8 06 ff ff ff       	call   800177 <umain>
+  800271:	e8 0a 00 00 00       	call   800280 <exit>
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80027c:	5b                   	pop    %ebx
+  80027d:	5e                   	pop    %esi
+  80027e:	5d                   	pop    %ebp
+  80027f:	c3                   	ret
+
+00800280 <exit>:
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	a1 14 60 80 00       	mov    0x806014,%eax
+  80028b:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800291:	85 c0                	test   %eax,%eax
+  800293:	75 14                	jne    8002a9 <exit+0x29>
+  800295:	e8 b1 1b 00 00       	call   801e4b <close_all>
+  80029a:	83 ec 0c             	sub    $0xc,%esp
+  80029d:	6a 00                	push   $0x0
+  80029f:	e8 93 0b 00 00       	call   800e37 <sys_env_destroy>
+  8002a4:	83 c4 10             	add    $0x10,%esp
+  8002a7:	c9                   	leave
+  8002a8:	c3                   	ret
+  8002a9:	e8 f6 12 00 00       	call   8015a4 <sys_lease_complete>
+  8002ae:	eb e5                	jmp    800295 <exit+0x15>
+
+008002b0 <_panic>:
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8002b8:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002be:	e8 b5 0b 00 00       	call   800e78 <sys_getenvid>
+  8002c3:	83 ec 0c             	sub    $0xc,%esp
+  8002c6:	ff 75 0c             	push   0xc(%ebp)
+  8002c9:	ff 75 08             	push   0x8(%ebp)
+  8002cc:	56                   	push   %esi
+  8002cd:	50                   	push   %eax
+  8002ce:	68 fc 39 80 00       	push   $0x8039fc
+  8002d3:	e8 b3 00 00 00       	call   80038b <cprintf>
+  8002d8:	83 c4 18             	add    $0x18,%esp
+  8002db:	53                   	push   %ebx
+  8002dc:	ff 75 10             	push   0x10(%ebp)
+  8002df:	e8 56 00 00 00       	call   80033a <vcprintf>
+  8002e4:	c7 04 24 83 39 80 00 	movl   $0x803983,(%esp)
+  8002eb:	e8 9b 00 00 00       	call   80038b <cprintf>
+  8002f0:	83 c4 10             	add    $0x10,%esp
+  8002f3:	cc                   	int3
+  8002f4:	eb fd                	jmp    8002f3 <_panic+0x43>
+
+008002f6 <putch>:
+  8002f6:	55                   	push   %ebp
+  8002f7:	89 e5                	mov    %esp,%ebp
+  8002f9:	53                   	push   %ebx
+  8002fa:	83 ec 04             	sub    $0x4,%esp
+  8002fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800300:	8b 13                	mov    (%ebx),%edx
+  800302:	8d 42 01             	lea    0x1(%edx),%eax
+  800305:	89 03                	mov    %eax,(%ebx)
+  800307:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80030a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80030e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800313:	74 09                	je     80031e <putch+0x28>
+  800315:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800319:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80031c:	c9                   	leave
+  80031d:	c3                   	ret
+  80031e:	83 ec 08             	sub    $0x8,%esp
+  800321:	68 ff 00 00 00       	push   $0xff
+  800326:	8d 43 08             	lea    0x8(%ebx),%eax
+  800329:	50                   	push   %eax
+  80032a:	e8 cb 0a 00 00       	call   800dfa <sys_cputs>
+  80032f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800335:	83 c4 10             	add    $0x10,%esp
+  800338:	eb db                	jmp    800315 <putch+0x1f>
+
+0080033a <vcprintf>:
+  80033a:	55                   	push   %ebp
+  80033b:	89 e5                	mov    %esp,%ebp
+  80033d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800343:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80034a:	00 00 00 
+  80034d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800354:	00 00 00 
+  800357:	ff 75 0c             	push   0xc(%ebp)
+  80035a:	ff 75 08             	push   0x8(%ebp)
+  80035d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800363:	50                   	push   %eax
+  800364:	68 f6 02 80 00       	push   $0x8002f6
+  800369:	e8 1c 01 00 00       	call   80048a <vprintfmt>
+  80036e:	83 c4 08             	add    $0x8,%esp
+  800371:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800377:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80037d:	50                   	push   %eax
+  80037e:	e8 77 0a 00 00       	call   800dfa <sys_cputs>
+  800383:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800389:	c9                   	leave
+  80038a:	c3                   	ret
+
+0080038b <cprintf>:
+  80038b:	55                   	push   %ebp
+  80038c:	89 e5                	mov    %esp,%ebp
+  80038e:	83 ec 10             	sub    $0x10,%esp
+  800391:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800394:	50                   	push   %eax
+  800395:	ff 75 08             	push   0x8(%ebp)
+  800398:	e8 9d ff ff ff       	call   80033a <vcprintf>
+  80039d:	c9                   	leave
+  80039e:	c3                   	ret
+
+0080039f <printnum>:
+  80039f:	55                   	push   %ebp
+  8003a0:	89 e5                	mov    %esp,%ebp
+  8003a2:	57                   	push   %edi
+  8003a3:	56                   	push   %esi
+  8003a4:	53                   	push   %ebx
+  8003a5:	83 ec 1c             	sub    $0x1c,%esp
+  8003a8:	89 c3                	mov    %eax,%ebx
+  8003aa:	89 d6                	mov    %edx,%esi
+  8003ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	89 d1                	mov    %edx,%ecx
+  8003b4:	89 c2                	mov    %eax,%edx
+  8003b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003b9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003c9:	39 c2                	cmp    %eax,%edx
+  8003cb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003ce:	73 4b                	jae    80041b <printnum+0x7c>
+  8003d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d3:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003d6:	85 ff                	test   %edi,%edi
+  8003d8:	7e 11                	jle    8003eb <printnum+0x4c>
+  8003da:	83 ec 08             	sub    $0x8,%esp
+  8003dd:	56                   	push   %esi
+  8003de:	ff 75 18             	push   0x18(%ebp)
+  8003e1:	ff d3                	call   *%ebx
+  8003e3:	83 c4 10             	add    $0x10,%esp
+  8003e6:	83 ef 01             	sub    $0x1,%edi
+  8003e9:	75 ef                	jne    8003da <printnum+0x3b>
+  8003eb:	83 ec 08             	sub    $0x8,%esp
+  8003ee:	56                   	push   %esi
+  8003ef:	83 ec 04             	sub    $0x4,%esp
+  8003f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8003f5:	ff 75 e0             	push   -0x20(%ebp)
+  8003f8:	ff 75 dc             	push   -0x24(%ebp)
+  8003fb:	ff 75 d8             	push   -0x28(%ebp)
+  8003fe:	e8 24 34 00 00       	call   803827 <__umoddi3>
+  800403:	83 c4 14             	add    $0x14,%esp
+  800406:	0f be 80 1f 3a 80 00 	movsbl 0x803a1f(%eax),%eax
+  80040d:	50                   	push   %eax
+  80040e:	ff d3                	call   *%ebx
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800416:	5b                   	pop    %ebx
+  800417:	5e                   	pop    %esi
+  800418:	5f                   	pop    %edi
+  800419:	5d                   	pop    %ebp
+  80041a:	c3                   	ret
+  80041b:	83 ec 0c             	sub    $0xc,%esp
+  80041e:	ff 75 18             	push   0x18(%ebp)
+  800421:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800424:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800427:	52                   	push   %edx
+  800428:	50                   	push   %eax
+  800429:	83 ec 08             	sub    $0x8,%esp
+  80042c:	ff 75 e4             	push   -0x1c(%ebp)
+  80042f:	ff 75 e0             	push   -0x20(%ebp)
+  800432:	ff 75 dc             	push   -0x24(%ebp)
+  800435:	ff 75 d8             	push   -0x28(%ebp)
+  800438:	e8 cc 33 00 00       	call   803809 <__udivdi3>
+  80043d:	83 c4 18             	add    $0x18,%esp
+  800440:	52                   	push   %edx
+  800441:	50                   	push   %eax
+  800442:	89 f2                	mov    %esi,%edx
+  800444:	89 d8                	mov    %ebx,%eax
+  800446:	e8 54 ff ff ff       	call   80039f <printnum>
+  80044b:	83 c4 20             	add    $0x20,%esp
+  80044e:	eb 9b                	jmp    8003eb <printnum+0x4c>
+
+00800450 <sprintputch>:
+  800450:	55                   	push   %ebp
+  800451:	89 e5                	mov    %esp,%ebp
+  800453:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800456:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80045a:	8b 10                	mov    (%eax),%edx
+  80045c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80045f:	73 0a                	jae    80046b <sprintputch+0x1b>
+  800461:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800464:	89 08                	mov    %ecx,(%eax)
+  800466:	8b 45 08             	mov    0x8(%ebp),%eax
+  800469:	88 02                	mov    %al,(%edx)
+  80046b:	5d                   	pop    %ebp
+  80046c:	c3                   	ret
+
+0080046d <printfmt>:
+  80046d:	55                   	push   %ebp
+  80046e:	89 e5                	mov    %esp,%ebp
+  800470:	83 ec 08             	sub    $0x8,%esp
+  800473:	8d 45 14             	lea    0x14(%ebp),%eax
+  800476:	50                   	push   %eax
+  800477:	ff 75 10             	push   0x10(%ebp)
+  80047a:	ff 75 0c             	push   0xc(%ebp)
+  80047d:	ff 75 08             	push   0x8(%ebp)
+  800480:	e8 05 00 00 00       	call   80048a <vprintfmt>
+  800485:	83 c4 10             	add    $0x10,%esp
+  800488:	c9                   	leave
+  800489:	c3                   	ret
+
+0080048a <vprintfmt>:
+  80048a:	55                   	push   %ebp
+  80048b:	89 e5                	mov    %esp,%ebp
+  80048d:	57                   	push   %edi
+  80048e:	56                   	push   %esi
+  80048f:	53                   	push   %ebx
+  800490:	83 ec 2c             	sub    $0x2c,%esp
+  800493:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800496:	89 df                	mov    %ebx,%edi
+  800498:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80049b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80049e:	8d 70 01             	lea    0x1(%eax),%esi
+  8004a1:	0f b6 00             	movzbl (%eax),%eax
+  8004a4:	83 f8 25             	cmp    $0x25,%eax
+  8004a7:	74 1e                	je     8004c7 <vprintfmt+0x3d>
+  8004a9:	85 c0                	test   %eax,%eax
+  8004ab:	0f 84 15 05 00 00    	je     8009c6 <vprintfmt+0x53c>
+  8004b1:	83 ec 08             	sub    $0x8,%esp
+  8004b4:	53                   	push   %ebx
+  8004b5:	50                   	push   %eax
+  8004b6:	ff d7                	call   *%edi
+  8004b8:	83 c6 01             	add    $0x1,%esi
+  8004bb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004bf:	83 c4 10             	add    $0x10,%esp
+  8004c2:	83 f8 25             	cmp    $0x25,%eax
+  8004c5:	75 e2                	jne    8004a9 <vprintfmt+0x1f>
+  8004c7:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8004cb:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8004d2:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004d9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8004e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004e5:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8004e8:	8d 56 01             	lea    0x1(%esi),%edx
+  8004eb:	0f b6 0e             	movzbl (%esi),%ecx
+  8004ee:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004f1:	3c 55                	cmp    $0x55,%al
+  8004f3:	0f 87 3b 04 00 00    	ja     800934 <vprintfmt+0x4aa>
+  8004f9:	0f b6 c0             	movzbl %al,%eax
+  8004fc:	ff 24 85 60 3b 80 00 	jmp    *0x803b60(,%eax,4)
+  800503:	89 75 10             	mov    %esi,0x10(%ebp)
+  800506:	eb 93                	jmp    80049b <vprintfmt+0x11>
+  800508:	89 d6                	mov    %edx,%esi
+  80050a:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80050e:	eb d8                	jmp    8004e8 <vprintfmt+0x5e>
+  800510:	89 d6                	mov    %edx,%esi
+  800512:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800516:	eb d0                	jmp    8004e8 <vprintfmt+0x5e>
+  800518:	0f b6 c9             	movzbl %cl,%ecx
+  80051b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80051e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800521:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800525:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800528:	83 f9 09             	cmp    $0x9,%ecx
+  80052b:	77 6f                	ja     80059c <vprintfmt+0x112>
+  80052d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800530:	83 c2 01             	add    $0x1,%edx
+  800533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80053a:	0f be 02             	movsbl (%edx),%eax
+  80053d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800540:	83 fe 09             	cmp    $0x9,%esi
+  800543:	76 eb                	jbe    800530 <vprintfmt+0xa6>
+  800545:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800548:	89 d6                	mov    %edx,%esi
+  80054a:	eb 13                	jmp    80055f <vprintfmt+0xd5>
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8b 00                	mov    (%eax),%eax
+  800551:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800554:	8b 45 14             	mov    0x14(%ebp),%eax
+  800557:	8d 40 04             	lea    0x4(%eax),%eax
+  80055a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055d:	89 d6                	mov    %edx,%esi
+  80055f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800563:	79 83                	jns    8004e8 <vprintfmt+0x5e>
+  800565:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800568:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80056b:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800572:	e9 71 ff ff ff       	jmp    8004e8 <vprintfmt+0x5e>
+  800577:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80057a:	85 c9                	test   %ecx,%ecx
+  80057c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800581:	0f 49 c1             	cmovns %ecx,%eax
+  800584:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800587:	89 d6                	mov    %edx,%esi
+  800589:	e9 5a ff ff ff       	jmp    8004e8 <vprintfmt+0x5e>
+  80058e:	89 d6                	mov    %edx,%esi
+  800590:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800597:	e9 4c ff ff ff       	jmp    8004e8 <vprintfmt+0x5e>
+  80059c:	89 d6                	mov    %edx,%esi
+  80059e:	eb bf                	jmp    80055f <vprintfmt+0xd5>
+  8005a0:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8005a4:	89 d6                	mov    %edx,%esi
+  8005a6:	e9 3d ff ff ff       	jmp    8004e8 <vprintfmt+0x5e>
+  8005ab:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8d 70 04             	lea    0x4(%eax),%esi
+  8005b4:	83 ec 08             	sub    $0x8,%esp
+  8005b7:	53                   	push   %ebx
+  8005b8:	ff 30                	push   (%eax)
+  8005ba:	ff d7                	call   *%edi
+  8005bc:	83 c4 10             	add    $0x10,%esp
+  8005bf:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005c2:	e9 d4 fe ff ff       	jmp    80049b <vprintfmt+0x11>
+  8005c7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8d 70 04             	lea    0x4(%eax),%esi
+  8005d0:	8b 10                	mov    (%eax),%edx
+  8005d2:	89 d0                	mov    %edx,%eax
+  8005d4:	f7 d8                	neg    %eax
+  8005d6:	0f 48 c2             	cmovs  %edx,%eax
+  8005d9:	83 f8 12             	cmp    $0x12,%eax
+  8005dc:	7f 23                	jg     800601 <vprintfmt+0x177>
+  8005de:	8b 14 85 c0 3c 80 00 	mov    0x803cc0(,%eax,4),%edx
+  8005e5:	85 d2                	test   %edx,%edx
+  8005e7:	74 18                	je     800601 <vprintfmt+0x177>
+  8005e9:	52                   	push   %edx
+  8005ea:	68 03 3f 80 00       	push   $0x803f03
+  8005ef:	53                   	push   %ebx
+  8005f0:	57                   	push   %edi
+  8005f1:	e8 77 fe ff ff       	call   80046d <printfmt>
+  8005f6:	83 c4 10             	add    $0x10,%esp
+  8005f9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005fc:	e9 9a fe ff ff       	jmp    80049b <vprintfmt+0x11>
+  800601:	50                   	push   %eax
+  800602:	68 37 3a 80 00       	push   $0x803a37
+  800607:	53                   	push   %ebx
+  800608:	57                   	push   %edi
+  800609:	e8 5f fe ff ff       	call   80046d <printfmt>
+  80060e:	83 c4 10             	add    $0x10,%esp
+  800611:	89 75 14             	mov    %esi,0x14(%ebp)
+  800614:	e9 82 fe ff ff       	jmp    80049b <vprintfmt+0x11>
+  800619:	89 55 10             	mov    %edx,0x10(%ebp)
+  80061c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061f:	83 c0 04             	add    $0x4,%eax
+  800622:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800625:	8b 45 14             	mov    0x14(%ebp),%eax
+  800628:	8b 00                	mov    (%eax),%eax
+  80062a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80062d:	85 c0                	test   %eax,%eax
+  80062f:	0f 84 61 03 00 00    	je     800996 <vprintfmt+0x50c>
+  800635:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800639:	7e 06                	jle    800641 <vprintfmt+0x1b7>
+  80063b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80063f:	75 29                	jne    80066a <vprintfmt+0x1e0>
+  800641:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800644:	8d 70 01             	lea    0x1(%eax),%esi
+  800647:	0f b6 00             	movzbl (%eax),%eax
+  80064a:	0f be d0             	movsbl %al,%edx
+  80064d:	85 d2                	test   %edx,%edx
+  80064f:	0f 84 bb 00 00 00    	je     800710 <vprintfmt+0x286>
+  800655:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800658:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80065b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80065e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800661:	eb 7a                	jmp    8006dd <vprintfmt+0x253>
+  800663:	c7 45 d0 30 3a 80 00 	movl   $0x803a30,-0x30(%ebp)
+  80066a:	83 ec 08             	sub    $0x8,%esp
+  80066d:	ff 75 d4             	push   -0x2c(%ebp)
+  800670:	ff 75 d0             	push   -0x30(%ebp)
+  800673:	e8 e0 03 00 00       	call   800a58 <strnlen>
+  800678:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80067b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80067e:	83 c4 10             	add    $0x10,%esp
+  800681:	85 d2                	test   %edx,%edx
+  800683:	0f 8e d6 02 00 00    	jle    80095f <vprintfmt+0x4d5>
+  800689:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80068d:	83 ec 08             	sub    $0x8,%esp
+  800690:	53                   	push   %ebx
+  800691:	56                   	push   %esi
+  800692:	ff d7                	call   *%edi
+  800694:	83 c4 10             	add    $0x10,%esp
+  800697:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80069b:	75 f0                	jne    80068d <vprintfmt+0x203>
+  80069d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006a0:	8d 70 01             	lea    0x1(%eax),%esi
+  8006a3:	0f b6 00             	movzbl (%eax),%eax
+  8006a6:	0f be d0             	movsbl %al,%edx
+  8006a9:	85 d2                	test   %edx,%edx
+  8006ab:	0f 84 da 02 00 00    	je     80098b <vprintfmt+0x501>
+  8006b1:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006b4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006b7:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006ba:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006bd:	eb 1e                	jmp    8006dd <vprintfmt+0x253>
+  8006bf:	83 ec 08             	sub    $0x8,%esp
+  8006c2:	ff 75 0c             	push   0xc(%ebp)
+  8006c5:	52                   	push   %edx
+  8006c6:	ff 55 08             	call   *0x8(%ebp)
+  8006c9:	83 c4 10             	add    $0x10,%esp
+  8006cc:	83 eb 01             	sub    $0x1,%ebx
+  8006cf:	83 c6 01             	add    $0x1,%esi
+  8006d2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006d6:	0f be d0             	movsbl %al,%edx
+  8006d9:	85 d2                	test   %edx,%edx
+  8006db:	74 2a                	je     800707 <vprintfmt+0x27d>
+  8006dd:	85 ff                	test   %edi,%edi
+  8006df:	78 05                	js     8006e6 <vprintfmt+0x25c>
+  8006e1:	83 ef 01             	sub    $0x1,%edi
+  8006e4:	78 59                	js     80073f <vprintfmt+0x2b5>
+  8006e6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006ea:	74 d3                	je     8006bf <vprintfmt+0x235>
+  8006ec:	0f be c0             	movsbl %al,%eax
+  8006ef:	83 e8 20             	sub    $0x20,%eax
+  8006f2:	83 f8 5e             	cmp    $0x5e,%eax
+  8006f5:	76 c8                	jbe    8006bf <vprintfmt+0x235>
+  8006f7:	83 ec 08             	sub    $0x8,%esp
+  8006fa:	ff 75 0c             	push   0xc(%ebp)
+  8006fd:	6a 3f                	push   $0x3f
+  8006ff:	ff 55 08             	call   *0x8(%ebp)
+  800702:	83 c4 10             	add    $0x10,%esp
+  800705:	eb c5                	jmp    8006cc <vprintfmt+0x242>
+  800707:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80070a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80070d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800710:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800713:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800717:	7e 1b                	jle    800734 <vprintfmt+0x2aa>
+  800719:	83 ec 08             	sub    $0x8,%esp
+  80071c:	53                   	push   %ebx
+  80071d:	6a 20                	push   $0x20
+  80071f:	ff d7                	call   *%edi
+  800721:	83 c4 10             	add    $0x10,%esp
+  800724:	83 ee 01             	sub    $0x1,%esi
+  800727:	75 f0                	jne    800719 <vprintfmt+0x28f>
+  800729:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80072c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072f:	e9 67 fd ff ff       	jmp    80049b <vprintfmt+0x11>
+  800734:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073a:	e9 5c fd ff ff       	jmp    80049b <vprintfmt+0x11>
+  80073f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800742:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800745:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800748:	eb c6                	jmp    800710 <vprintfmt+0x286>
+  80074a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80074d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800750:	83 f9 01             	cmp    $0x1,%ecx
+  800753:	7f 1f                	jg     800774 <vprintfmt+0x2ea>
+  800755:	85 c9                	test   %ecx,%ecx
+  800757:	74 67                	je     8007c0 <vprintfmt+0x336>
+  800759:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075c:	8b 30                	mov    (%eax),%esi
+  80075e:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800761:	89 f0                	mov    %esi,%eax
+  800763:	c1 f8 1f             	sar    $0x1f,%eax
+  800766:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800769:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076c:	8d 40 04             	lea    0x4(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800772:	eb 17                	jmp    80078b <vprintfmt+0x301>
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8b 50 04             	mov    0x4(%eax),%edx
+  80077a:	8b 00                	mov    (%eax),%eax
+  80077c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80077f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800782:	8b 45 14             	mov    0x14(%ebp),%eax
+  800785:	8d 40 08             	lea    0x8(%eax),%eax
+  800788:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80078e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800791:	be 0a 00 00 00       	mov    $0xa,%esi
+  800796:	85 c9                	test   %ecx,%ecx
+  800798:	0f 89 12 01 00 00    	jns    8008b0 <vprintfmt+0x426>
+  80079e:	83 ec 08             	sub    $0x8,%esp
+  8007a1:	53                   	push   %ebx
+  8007a2:	6a 2d                	push   $0x2d
+  8007a4:	ff d7                	call   *%edi
+  8007a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007a9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ac:	f7 da                	neg    %edx
+  8007ae:	83 d1 00             	adc    $0x0,%ecx
+  8007b1:	f7 d9                	neg    %ecx
+  8007b3:	83 c4 10             	add    $0x10,%esp
+  8007b6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007bb:	e9 f0 00 00 00       	jmp    8008b0 <vprintfmt+0x426>
+  8007c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c3:	8b 30                	mov    (%eax),%esi
+  8007c5:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007c8:	89 f0                	mov    %esi,%eax
+  8007ca:	c1 f8 1f             	sar    $0x1f,%eax
+  8007cd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d9:	eb b0                	jmp    80078b <vprintfmt+0x301>
+  8007db:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007de:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e1:	83 f9 01             	cmp    $0x1,%ecx
+  8007e4:	7f 1e                	jg     800804 <vprintfmt+0x37a>
+  8007e6:	85 c9                	test   %ecx,%ecx
+  8007e8:	74 32                	je     80081c <vprintfmt+0x392>
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8b 10                	mov    (%eax),%edx
+  8007ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fa:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007ff:	e9 ac 00 00 00       	jmp    8008b0 <vprintfmt+0x426>
+  800804:	8b 45 14             	mov    0x14(%ebp),%eax
+  800807:	8b 10                	mov    (%eax),%edx
+  800809:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080c:	8d 40 08             	lea    0x8(%eax),%eax
+  80080f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800812:	be 0a 00 00 00       	mov    $0xa,%esi
+  800817:	e9 94 00 00 00       	jmp    8008b0 <vprintfmt+0x426>
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8b 10                	mov    (%eax),%edx
+  800821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800826:	8d 40 04             	lea    0x4(%eax),%eax
+  800829:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800831:	eb 7d                	jmp    8008b0 <vprintfmt+0x426>
+  800833:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800836:	89 55 10             	mov    %edx,0x10(%ebp)
+  800839:	83 f9 01             	cmp    $0x1,%ecx
+  80083c:	7f 1b                	jg     800859 <vprintfmt+0x3cf>
+  80083e:	85 c9                	test   %ecx,%ecx
+  800840:	74 2c                	je     80086e <vprintfmt+0x3e4>
+  800842:	8b 45 14             	mov    0x14(%ebp),%eax
+  800845:	8b 10                	mov    (%eax),%edx
+  800847:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084c:	8d 40 04             	lea    0x4(%eax),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800852:	be 08 00 00 00       	mov    $0x8,%esi
+  800857:	eb 57                	jmp    8008b0 <vprintfmt+0x426>
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8b 10                	mov    (%eax),%edx
+  80085e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800861:	8d 40 08             	lea    0x8(%eax),%eax
+  800864:	89 45 14             	mov    %eax,0x14(%ebp)
+  800867:	be 08 00 00 00       	mov    $0x8,%esi
+  80086c:	eb 42                	jmp    8008b0 <vprintfmt+0x426>
+  80086e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800871:	8b 10                	mov    (%eax),%edx
+  800873:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800878:	8d 40 04             	lea    0x4(%eax),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80087e:	be 08 00 00 00       	mov    $0x8,%esi
+  800883:	eb 2b                	jmp    8008b0 <vprintfmt+0x426>
+  800885:	89 55 10             	mov    %edx,0x10(%ebp)
+  800888:	83 ec 08             	sub    $0x8,%esp
+  80088b:	53                   	push   %ebx
+  80088c:	6a 30                	push   $0x30
+  80088e:	ff d7                	call   *%edi
+  800890:	83 c4 08             	add    $0x8,%esp
+  800893:	53                   	push   %ebx
+  800894:	6a 78                	push   $0x78
+  800896:	ff d7                	call   *%edi
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8b 10                	mov    (%eax),%edx
+  80089d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a2:	83 c4 10             	add    $0x10,%esp
+  8008a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ab:	be 10 00 00 00       	mov    $0x10,%esi
+  8008b0:	83 ec 0c             	sub    $0xc,%esp
+  8008b3:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008b7:	50                   	push   %eax
+  8008b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8008bb:	56                   	push   %esi
+  8008bc:	51                   	push   %ecx
+  8008bd:	52                   	push   %edx
+  8008be:	89 da                	mov    %ebx,%edx
+  8008c0:	89 f8                	mov    %edi,%eax
+  8008c2:	e8 d8 fa ff ff       	call   80039f <printnum>
+  8008c7:	83 c4 20             	add    $0x20,%esp
+  8008ca:	e9 cc fb ff ff       	jmp    80049b <vprintfmt+0x11>
+  8008cf:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008d2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008d5:	83 f9 01             	cmp    $0x1,%ecx
+  8008d8:	7f 1b                	jg     8008f5 <vprintfmt+0x46b>
+  8008da:	85 c9                	test   %ecx,%ecx
+  8008dc:	74 2c                	je     80090a <vprintfmt+0x480>
+  8008de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e1:	8b 10                	mov    (%eax),%edx
+  8008e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ee:	be 10 00 00 00       	mov    $0x10,%esi
+  8008f3:	eb bb                	jmp    8008b0 <vprintfmt+0x426>
+  8008f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f8:	8b 10                	mov    (%eax),%edx
+  8008fa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008fd:	8d 40 08             	lea    0x8(%eax),%eax
+  800900:	89 45 14             	mov    %eax,0x14(%ebp)
+  800903:	be 10 00 00 00       	mov    $0x10,%esi
+  800908:	eb a6                	jmp    8008b0 <vprintfmt+0x426>
+  80090a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090d:	8b 10                	mov    (%eax),%edx
+  80090f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800914:	8d 40 04             	lea    0x4(%eax),%eax
+  800917:	89 45 14             	mov    %eax,0x14(%ebp)
+  80091a:	be 10 00 00 00       	mov    $0x10,%esi
+  80091f:	eb 8f                	jmp    8008b0 <vprintfmt+0x426>
+  800921:	89 55 10             	mov    %edx,0x10(%ebp)
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	53                   	push   %ebx
+  800928:	6a 25                	push   $0x25
+  80092a:	ff d7                	call   *%edi
+  80092c:	83 c4 10             	add    $0x10,%esp
+  80092f:	e9 67 fb ff ff       	jmp    80049b <vprintfmt+0x11>
+  800934:	83 ec 08             	sub    $0x8,%esp
+  800937:	53                   	push   %ebx
+  800938:	6a 25                	push   $0x25
+  80093a:	ff d7                	call   *%edi
+  80093c:	83 c4 10             	add    $0x10,%esp
+  80093f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800943:	0f 84 ba fb ff ff    	je     800503 <vprintfmt+0x79>
+  800949:	89 75 10             	mov    %esi,0x10(%ebp)
+  80094c:	89 f0                	mov    %esi,%eax
+  80094e:	83 e8 01             	sub    $0x1,%eax
+  800951:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800955:	75 f7                	jne    80094e <vprintfmt+0x4c4>
+  800957:	89 45 10             	mov    %eax,0x10(%ebp)
+  80095a:	e9 3c fb ff ff       	jmp    80049b <vprintfmt+0x11>
+  80095f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800962:	8d 70 01             	lea    0x1(%eax),%esi
+  800965:	0f b6 00             	movzbl (%eax),%eax
+  800968:	0f be d0             	movsbl %al,%edx
+  80096b:	85 d2                	test   %edx,%edx
+  80096d:	74 11                	je     800980 <vprintfmt+0x4f6>
+  80096f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800972:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800975:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800978:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80097b:	e9 5d fd ff ff       	jmp    8006dd <vprintfmt+0x253>
+  800980:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800983:	89 45 14             	mov    %eax,0x14(%ebp)
+  800986:	e9 10 fb ff ff       	jmp    80049b <vprintfmt+0x11>
+  80098b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80098e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800991:	e9 05 fb ff ff       	jmp    80049b <vprintfmt+0x11>
+  800996:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80099a:	7e 0a                	jle    8009a6 <vprintfmt+0x51c>
+  80099c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009a0:	0f 85 bd fc ff ff    	jne    800663 <vprintfmt+0x1d9>
+  8009a6:	ba 28 00 00 00       	mov    $0x28,%edx
+  8009ab:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009b0:	be 31 3a 80 00       	mov    $0x803a31,%esi
+  8009b5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009b8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009bb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009be:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009c1:	e9 17 fd ff ff       	jmp    8006dd <vprintfmt+0x253>
+  8009c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c9:	5b                   	pop    %ebx
+  8009ca:	5e                   	pop    %esi
+  8009cb:	5f                   	pop    %edi
+  8009cc:	5d                   	pop    %ebp
+  8009cd:	c3                   	ret
+
+008009ce <vsnprintf>:
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	83 ec 18             	sub    $0x18,%esp
+  8009d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009da:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009dd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009e1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009e4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8009eb:	85 c0                	test   %eax,%eax
+  8009ed:	74 26                	je     800a15 <vsnprintf+0x47>
+  8009ef:	85 d2                	test   %edx,%edx
+  8009f1:	7e 22                	jle    800a15 <vsnprintf+0x47>
+  8009f3:	ff 75 14             	push   0x14(%ebp)
+  8009f6:	ff 75 10             	push   0x10(%ebp)
+  8009f9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009fc:	50                   	push   %eax
+  8009fd:	68 50 04 80 00       	push   $0x800450
+  800a02:	e8 83 fa ff ff       	call   80048a <vprintfmt>
+  800a07:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a0a:	c6 00 00             	movb   $0x0,(%eax)
+  800a0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a10:	83 c4 10             	add    $0x10,%esp
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+  800a15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a1a:	eb f7                	jmp    800a13 <vsnprintf+0x45>
+
+00800a1c <snprintf>:
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	83 ec 08             	sub    $0x8,%esp
+  800a22:	8d 45 14             	lea    0x14(%ebp),%eax
+  800a25:	50                   	push   %eax
+  800a26:	ff 75 10             	push   0x10(%ebp)
+  800a29:	ff 75 0c             	push   0xc(%ebp)
+  800a2c:	ff 75 08             	push   0x8(%ebp)
+  800a2f:	e8 9a ff ff ff       	call   8009ce <vsnprintf>
+  800a34:	c9                   	leave
+  800a35:	c3                   	ret
+
+00800a36 <strlen>:
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3c:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a3f:	74 10                	je     800a51 <strlen+0x1b>
+  800a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a46:	83 c0 01             	add    $0x1,%eax
+  800a49:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a4d:	75 f7                	jne    800a46 <strlen+0x10>
+  800a4f:	5d                   	pop    %ebp
+  800a50:	c3                   	ret
+  800a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a56:	eb f7                	jmp    800a4f <strlen+0x19>
+
+00800a58 <strnlen>:
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a61:	85 d2                	test   %edx,%edx
+  800a63:	74 16                	je     800a7b <strnlen+0x23>
+  800a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a6e:	74 09                	je     800a79 <strnlen+0x21>
+  800a70:	83 c0 01             	add    $0x1,%eax
+  800a73:	39 d0                	cmp    %edx,%eax
+  800a75:	75 f3                	jne    800a6a <strnlen+0x12>
+  800a77:	89 d0                	mov    %edx,%eax
+  800a79:	5d                   	pop    %ebp
+  800a7a:	c3                   	ret
+  800a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a80:	eb f7                	jmp    800a79 <strnlen+0x21>
+
+00800a82 <strcpy>:
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	53                   	push   %ebx
+  800a86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a91:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a95:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a98:	83 c0 01             	add    $0x1,%eax
+  800a9b:	84 d2                	test   %dl,%dl
+  800a9d:	75 f2                	jne    800a91 <strcpy+0xf>
+  800a9f:	89 c8                	mov    %ecx,%eax
+  800aa1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa4:	c9                   	leave
+  800aa5:	c3                   	ret
+
+00800aa6 <strcat>:
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	53                   	push   %ebx
+  800aaa:	83 ec 10             	sub    $0x10,%esp
+  800aad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ab0:	53                   	push   %ebx
+  800ab1:	e8 80 ff ff ff       	call   800a36 <strlen>
+  800ab6:	83 c4 08             	add    $0x8,%esp
+  800ab9:	ff 75 0c             	push   0xc(%ebp)
+  800abc:	01 d8                	add    %ebx,%eax
+  800abe:	50                   	push   %eax
+  800abf:	e8 be ff ff ff       	call   800a82 <strcpy>
+  800ac4:	89 d8                	mov    %ebx,%eax
+  800ac6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac9:	c9                   	leave
+  800aca:	c3                   	ret
+
+00800acb <strncpy>:
+  800acb:	55                   	push   %ebp
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	56                   	push   %esi
+  800acf:	53                   	push   %ebx
+  800ad0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ad3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ad9:	85 db                	test   %ebx,%ebx
+  800adb:	74 17                	je     800af4 <strncpy+0x29>
+  800add:	01 f3                	add    %esi,%ebx
+  800adf:	89 f0                	mov    %esi,%eax
+  800ae1:	83 c0 01             	add    $0x1,%eax
+  800ae4:	0f b6 0a             	movzbl (%edx),%ecx
+  800ae7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800aea:	80 f9 01             	cmp    $0x1,%cl
+  800aed:	83 da ff             	sbb    $0xffffffff,%edx
+  800af0:	39 c3                	cmp    %eax,%ebx
+  800af2:	75 ed                	jne    800ae1 <strncpy+0x16>
+  800af4:	89 f0                	mov    %esi,%eax
+  800af6:	5b                   	pop    %ebx
+  800af7:	5e                   	pop    %esi
+  800af8:	5d                   	pop    %ebp
+  800af9:	c3                   	ret
+
+00800afa <strlcpy>:
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	56                   	push   %esi
+  800afe:	53                   	push   %ebx
+  800aff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b08:	89 f0                	mov    %esi,%eax
+  800b0a:	85 db                	test   %ebx,%ebx
+  800b0c:	74 1e                	je     800b2c <strlcpy+0x32>
+  800b0e:	83 eb 01             	sub    $0x1,%ebx
+  800b11:	74 16                	je     800b29 <strlcpy+0x2f>
+  800b13:	01 f3                	add    %esi,%ebx
+  800b15:	0f b6 0a             	movzbl (%edx),%ecx
+  800b18:	84 c9                	test   %cl,%cl
+  800b1a:	74 0d                	je     800b29 <strlcpy+0x2f>
+  800b1c:	83 c2 01             	add    $0x1,%edx
+  800b1f:	83 c0 01             	add    $0x1,%eax
+  800b22:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b25:	39 d8                	cmp    %ebx,%eax
+  800b27:	75 ec                	jne    800b15 <strlcpy+0x1b>
+  800b29:	c6 00 00             	movb   $0x0,(%eax)
+  800b2c:	29 f0                	sub    %esi,%eax
+  800b2e:	5b                   	pop    %ebx
+  800b2f:	5e                   	pop    %esi
+  800b30:	5d                   	pop    %ebp
+  800b31:	c3                   	ret
+
+00800b32 <strcmp>:
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b3b:	0f b6 01             	movzbl (%ecx),%eax
+  800b3e:	84 c0                	test   %al,%al
+  800b40:	74 11                	je     800b53 <strcmp+0x21>
+  800b42:	38 02                	cmp    %al,(%edx)
+  800b44:	75 0d                	jne    800b53 <strcmp+0x21>
+  800b46:	83 c1 01             	add    $0x1,%ecx
+  800b49:	83 c2 01             	add    $0x1,%edx
+  800b4c:	0f b6 01             	movzbl (%ecx),%eax
+  800b4f:	84 c0                	test   %al,%al
+  800b51:	75 ef                	jne    800b42 <strcmp+0x10>
+  800b53:	0f b6 c0             	movzbl %al,%eax
+  800b56:	0f b6 12             	movzbl (%edx),%edx
+  800b59:	29 d0                	sub    %edx,%eax
+  800b5b:	5d                   	pop    %ebp
+  800b5c:	c3                   	ret
+
+00800b5d <strncmp>:
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	53                   	push   %ebx
+  800b61:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b64:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b67:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6f:	85 d2                	test   %edx,%edx
+  800b71:	74 2e                	je     800ba1 <strncmp+0x44>
+  800b73:	0f b6 01             	movzbl (%ecx),%eax
+  800b76:	84 c0                	test   %al,%al
+  800b78:	74 16                	je     800b90 <strncmp+0x33>
+  800b7a:	3a 03                	cmp    (%ebx),%al
+  800b7c:	75 12                	jne    800b90 <strncmp+0x33>
+  800b7e:	83 c1 01             	add    $0x1,%ecx
+  800b81:	83 c3 01             	add    $0x1,%ebx
+  800b84:	83 ea 01             	sub    $0x1,%edx
+  800b87:	75 ea                	jne    800b73 <strncmp+0x16>
+  800b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8e:	eb 11                	jmp    800ba1 <strncmp+0x44>
+  800b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b95:	85 d2                	test   %edx,%edx
+  800b97:	74 08                	je     800ba1 <strncmp+0x44>
+  800b99:	0f b6 01             	movzbl (%ecx),%eax
+  800b9c:	0f b6 13             	movzbl (%ebx),%edx
+  800b9f:	29 d0                	sub    %edx,%eax
+  800ba1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba4:	c9                   	leave
+  800ba5:	c3                   	ret
+
+00800ba6 <strchr>:
+  800ba6:	55                   	push   %ebp
+  800ba7:	89 e5                	mov    %esp,%ebp
+  800ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800bb0:	0f b6 10             	movzbl (%eax),%edx
+  800bb3:	84 d2                	test   %dl,%dl
+  800bb5:	74 15                	je     800bcc <strchr+0x26>
+  800bb7:	38 d1                	cmp    %dl,%cl
+  800bb9:	74 0f                	je     800bca <strchr+0x24>
+  800bbb:	83 c0 01             	add    $0x1,%eax
+  800bbe:	0f b6 10             	movzbl (%eax),%edx
+  800bc1:	84 d2                	test   %dl,%dl
+  800bc3:	75 f2                	jne    800bb7 <strchr+0x11>
+  800bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bca:	5d                   	pop    %ebp
+  800bcb:	c3                   	ret
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd1:	eb f7                	jmp    800bca <strchr+0x24>
+
+00800bd3 <strfind>:
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	53                   	push   %ebx
+  800bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bda:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bdd:	0f b6 18             	movzbl (%eax),%ebx
+  800be0:	38 d3                	cmp    %dl,%bl
+  800be2:	74 14                	je     800bf8 <strfind+0x25>
+  800be4:	89 d1                	mov    %edx,%ecx
+  800be6:	84 db                	test   %bl,%bl
+  800be8:	74 0e                	je     800bf8 <strfind+0x25>
+  800bea:	83 c0 01             	add    $0x1,%eax
+  800bed:	0f b6 10             	movzbl (%eax),%edx
+  800bf0:	38 ca                	cmp    %cl,%dl
+  800bf2:	74 04                	je     800bf8 <strfind+0x25>
+  800bf4:	84 d2                	test   %dl,%dl
+  800bf6:	75 f2                	jne    800bea <strfind+0x17>
+  800bf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bfb:	c9                   	leave
+  800bfc:	c3                   	ret
+
+00800bfd <memset>:
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c04:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c07:	85 c9                	test   %ecx,%ecx
+  800c09:	74 20                	je     800c2b <memset+0x2e>
+  800c0b:	89 f8                	mov    %edi,%eax
+  800c0d:	09 c8                	or     %ecx,%eax
+  800c0f:	a8 03                	test   $0x3,%al
+  800c11:	75 12                	jne    800c25 <memset+0x28>
+  800c13:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c17:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800c1d:	c1 e9 02             	shr    $0x2,%ecx
+  800c20:	fc                   	cld
+  800c21:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c23:	eb 06                	jmp    800c2b <memset+0x2e>
+  800c25:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c28:	fc                   	cld
+  800c29:	f3 aa                	rep stos %al,%es:(%edi)
+  800c2b:	89 f8                	mov    %edi,%eax
+  800c2d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+
+00800c32 <memmove>:
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	57                   	push   %edi
+  800c36:	56                   	push   %esi
+  800c37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c3d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c40:	39 c6                	cmp    %eax,%esi
+  800c42:	73 32                	jae    800c76 <memmove+0x44>
+  800c44:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c47:	39 d0                	cmp    %edx,%eax
+  800c49:	73 2b                	jae    800c76 <memmove+0x44>
+  800c4b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800c4e:	89 d6                	mov    %edx,%esi
+  800c50:	09 fe                	or     %edi,%esi
+  800c52:	09 ce                	or     %ecx,%esi
+  800c54:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c5a:	75 0e                	jne    800c6a <memmove+0x38>
+  800c5c:	83 ef 04             	sub    $0x4,%edi
+  800c5f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c62:	c1 e9 02             	shr    $0x2,%ecx
+  800c65:	fd                   	std
+  800c66:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c68:	eb 09                	jmp    800c73 <memmove+0x41>
+  800c6a:	83 ef 01             	sub    $0x1,%edi
+  800c6d:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800c70:	fd                   	std
+  800c71:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c73:	fc                   	cld
+  800c74:	eb 1a                	jmp    800c90 <memmove+0x5e>
+  800c76:	89 f2                	mov    %esi,%edx
+  800c78:	09 c2                	or     %eax,%edx
+  800c7a:	09 ca                	or     %ecx,%edx
+  800c7c:	f6 c2 03             	test   $0x3,%dl
+  800c7f:	75 0a                	jne    800c8b <memmove+0x59>
+  800c81:	c1 e9 02             	shr    $0x2,%ecx
+  800c84:	89 c7                	mov    %eax,%edi
+  800c86:	fc                   	cld
+  800c87:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c89:	eb 05                	jmp    800c90 <memmove+0x5e>
+  800c8b:	89 c7                	mov    %eax,%edi
+  800c8d:	fc                   	cld
+  800c8e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+
+00800c94 <memcpy>:
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	83 ec 0c             	sub    $0xc,%esp
+  800c9a:	ff 75 10             	push   0x10(%ebp)
+  800c9d:	ff 75 0c             	push   0xc(%ebp)
+  800ca0:	ff 75 08             	push   0x8(%ebp)
+  800ca3:	e8 8a ff ff ff       	call   800c32 <memmove>
+  800ca8:	c9                   	leave
+  800ca9:	c3                   	ret
+
+00800caa <memcmp>:
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	56                   	push   %esi
+  800cae:	53                   	push   %ebx
+  800caf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cb5:	8b 75 10             	mov    0x10(%ebp),%esi
+  800cb8:	85 f6                	test   %esi,%esi
+  800cba:	74 29                	je     800ce5 <memcmp+0x3b>
+  800cbc:	01 c6                	add    %eax,%esi
+  800cbe:	0f b6 08             	movzbl (%eax),%ecx
+  800cc1:	0f b6 1a             	movzbl (%edx),%ebx
+  800cc4:	38 d9                	cmp    %bl,%cl
+  800cc6:	75 11                	jne    800cd9 <memcmp+0x2f>
+  800cc8:	83 c0 01             	add    $0x1,%eax
+  800ccb:	83 c2 01             	add    $0x1,%edx
+  800cce:	39 c6                	cmp    %eax,%esi
+  800cd0:	75 ec                	jne    800cbe <memcmp+0x14>
+  800cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd7:	eb 08                	jmp    800ce1 <memcmp+0x37>
+  800cd9:	0f b6 c1             	movzbl %cl,%eax
+  800cdc:	0f b6 db             	movzbl %bl,%ebx
+  800cdf:	29 d8                	sub    %ebx,%eax
+  800ce1:	5b                   	pop    %ebx
+  800ce2:	5e                   	pop    %esi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+  800ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cea:	eb f5                	jmp    800ce1 <memcmp+0x37>
+
+00800cec <memfind>:
+  800cec:	55                   	push   %ebp
+  800ced:	89 e5                	mov    %esp,%ebp
+  800cef:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf5:	89 c2                	mov    %eax,%edx
+  800cf7:	03 55 10             	add    0x10(%ebp),%edx
+  800cfa:	39 d0                	cmp    %edx,%eax
+  800cfc:	73 0d                	jae    800d0b <memfind+0x1f>
+  800cfe:	38 08                	cmp    %cl,(%eax)
+  800d00:	74 0d                	je     800d0f <memfind+0x23>
+  800d02:	83 c0 01             	add    $0x1,%eax
+  800d05:	39 c2                	cmp    %eax,%edx
+  800d07:	75 f5                	jne    800cfe <memfind+0x12>
+  800d09:	eb 06                	jmp    800d11 <memfind+0x25>
+  800d0b:	89 c2                	mov    %eax,%edx
+  800d0d:	eb 02                	jmp    800d11 <memfind+0x25>
+  800d0f:	89 c2                	mov    %eax,%edx
+  800d11:	89 d0                	mov    %edx,%eax
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+
+00800d15 <strtol>:
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d21:	0f b6 02             	movzbl (%edx),%eax
+  800d24:	3c 20                	cmp    $0x20,%al
+  800d26:	74 04                	je     800d2c <strtol+0x17>
+  800d28:	3c 09                	cmp    $0x9,%al
+  800d2a:	75 0e                	jne    800d3a <strtol+0x25>
+  800d2c:	83 c2 01             	add    $0x1,%edx
+  800d2f:	0f b6 02             	movzbl (%edx),%eax
+  800d32:	3c 20                	cmp    $0x20,%al
+  800d34:	74 f6                	je     800d2c <strtol+0x17>
+  800d36:	3c 09                	cmp    $0x9,%al
+  800d38:	74 f2                	je     800d2c <strtol+0x17>
+  800d3a:	3c 2b                	cmp    $0x2b,%al
+  800d3c:	74 2a                	je     800d68 <strtol+0x53>
+  800d3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d43:	3c 2d                	cmp    $0x2d,%al
+  800d45:	74 2b                	je     800d72 <strtol+0x5d>
+  800d47:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d4d:	75 0f                	jne    800d5e <strtol+0x49>
+  800d4f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d52:	74 28                	je     800d7c <strtol+0x67>
+  800d54:	85 db                	test   %ebx,%ebx
+  800d56:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d5b:	0f 44 d8             	cmove  %eax,%ebx
+  800d5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d63:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d66:	eb 46                	jmp    800dae <strtol+0x99>
+  800d68:	83 c2 01             	add    $0x1,%edx
+  800d6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d70:	eb d5                	jmp    800d47 <strtol+0x32>
+  800d72:	83 c2 01             	add    $0x1,%edx
+  800d75:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d7a:	eb cb                	jmp    800d47 <strtol+0x32>
+  800d7c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d80:	74 0e                	je     800d90 <strtol+0x7b>
+  800d82:	85 db                	test   %ebx,%ebx
+  800d84:	75 d8                	jne    800d5e <strtol+0x49>
+  800d86:	83 c2 01             	add    $0x1,%edx
+  800d89:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d8e:	eb ce                	jmp    800d5e <strtol+0x49>
+  800d90:	83 c2 02             	add    $0x2,%edx
+  800d93:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d98:	eb c4                	jmp    800d5e <strtol+0x49>
+  800d9a:	0f be c0             	movsbl %al,%eax
+  800d9d:	83 e8 30             	sub    $0x30,%eax
+  800da0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800da3:	7d 3a                	jge    800ddf <strtol+0xca>
+  800da5:	83 c2 01             	add    $0x1,%edx
+  800da8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dac:	01 c1                	add    %eax,%ecx
+  800dae:	0f b6 02             	movzbl (%edx),%eax
+  800db1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800db4:	89 f3                	mov    %esi,%ebx
+  800db6:	80 fb 09             	cmp    $0x9,%bl
+  800db9:	76 df                	jbe    800d9a <strtol+0x85>
+  800dbb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dbe:	89 f3                	mov    %esi,%ebx
+  800dc0:	80 fb 19             	cmp    $0x19,%bl
+  800dc3:	77 08                	ja     800dcd <strtol+0xb8>
+  800dc5:	0f be c0             	movsbl %al,%eax
+  800dc8:	83 e8 57             	sub    $0x57,%eax
+  800dcb:	eb d3                	jmp    800da0 <strtol+0x8b>
+  800dcd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dd0:	89 f3                	mov    %esi,%ebx
+  800dd2:	80 fb 19             	cmp    $0x19,%bl
+  800dd5:	77 08                	ja     800ddf <strtol+0xca>
+  800dd7:	0f be c0             	movsbl %al,%eax
+  800dda:	83 e8 37             	sub    $0x37,%eax
+  800ddd:	eb c1                	jmp    800da0 <strtol+0x8b>
+  800ddf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800de3:	74 05                	je     800dea <strtol+0xd5>
+  800de5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800de8:	89 10                	mov    %edx,(%eax)
+  800dea:	89 c8                	mov    %ecx,%eax
+  800dec:	f7 d8                	neg    %eax
+  800dee:	85 ff                	test   %edi,%edi
+  800df0:	0f 45 c8             	cmovne %eax,%ecx
+  800df3:	89 c8                	mov    %ecx,%eax
+  800df5:	5b                   	pop    %ebx
+  800df6:	5e                   	pop    %esi
+  800df7:	5f                   	pop    %edi
+  800df8:	5d                   	pop    %ebp
+  800df9:	c3                   	ret
+
+00800dfa <sys_cputs>:
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	57                   	push   %edi
+  800dfe:	56                   	push   %esi
+  800dff:	53                   	push   %ebx
+  800e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0b:	89 c3                	mov    %eax,%ebx
+  800e0d:	89 c7                	mov    %eax,%edi
+  800e0f:	89 c6                	mov    %eax,%esi
+  800e11:	cd 30                	int    $0x30
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+
+00800e18 <sys_cgetc>:
+  800e18:	55                   	push   %ebp
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	57                   	push   %edi
+  800e1c:	56                   	push   %esi
+  800e1d:	53                   	push   %ebx
+  800e1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e23:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e28:	89 d1                	mov    %edx,%ecx
+  800e2a:	89 d3                	mov    %edx,%ebx
+  800e2c:	89 d7                	mov    %edx,%edi
+  800e2e:	89 d6                	mov    %edx,%esi
+  800e30:	cd 30                	int    $0x30
+  800e32:	5b                   	pop    %ebx
+  800e33:	5e                   	pop    %esi
+  800e34:	5f                   	pop    %edi
+  800e35:	5d                   	pop    %ebp
+  800e36:	c3                   	ret
+
+00800e37 <sys_env_destroy>:
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	57                   	push   %edi
+  800e3b:	56                   	push   %esi
+  800e3c:	53                   	push   %ebx
+  800e3d:	83 ec 0c             	sub    $0xc,%esp
+  800e40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e48:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e4d:	89 cb                	mov    %ecx,%ebx
+  800e4f:	89 cf                	mov    %ecx,%edi
+  800e51:	89 ce                	mov    %ecx,%esi
+  800e53:	cd 30                	int    $0x30
+  800e55:	85 c0                	test   %eax,%eax
+  800e57:	7f 08                	jg     800e61 <sys_env_destroy+0x2a>
+  800e59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+  800e61:	83 ec 0c             	sub    $0xc,%esp
+  800e64:	50                   	push   %eax
+  800e65:	6a 03                	push   $0x3
+  800e67:	68 2b 3d 80 00       	push   $0x803d2b
+  800e6c:	6a 24                	push   $0x24
+  800e6e:	68 48 3d 80 00       	push   $0x803d48
+  800e73:	e8 38 f4 ff ff       	call   8002b0 <_panic>
+
+00800e78 <sys_getenvid>:
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	57                   	push   %edi
+  800e7c:	56                   	push   %esi
+  800e7d:	53                   	push   %ebx
+  800e7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e83:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e88:	89 d1                	mov    %edx,%ecx
+  800e8a:	89 d3                	mov    %edx,%ebx
+  800e8c:	89 d7                	mov    %edx,%edi
+  800e8e:	89 d6                	mov    %edx,%esi
+  800e90:	cd 30                	int    $0x30
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+
+00800e97 <sys_yield>:
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ea4:	74 26                	je     800ecc <sys_yield+0x35>
+  800ea6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eab:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eb0:	89 d1                	mov    %edx,%ecx
+  800eb2:	89 d3                	mov    %edx,%ebx
+  800eb4:	89 d7                	mov    %edx,%edi
+  800eb6:	6a 00                	push   $0x0
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	8d 35 c3 0e 80 00    	lea    0x800ec3,%esi
+  800ec1:	0f 34                	sysenter
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	83 c4 04             	add    $0x4,%esp
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+  800ecc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ed6:	89 d1                	mov    %edx,%ecx
+  800ed8:	89 d3                	mov    %edx,%ebx
+  800eda:	89 d7                	mov    %edx,%edi
+  800edc:	89 d6                	mov    %edx,%esi
+  800ede:	cd 30                	int    $0x30
+  800ee0:	eb e5                	jmp    800ec7 <sys_yield+0x30>
+
+00800ee2 <sys_page_alloc>:
+  800ee2:	55                   	push   %ebp
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	57                   	push   %edi
+  800ee6:	56                   	push   %esi
+  800ee7:	53                   	push   %ebx
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+  800eeb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800efb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efe:	89 f7                	mov    %esi,%edi
+  800f00:	cd 30                	int    $0x30
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	7f 08                	jg     800f0e <sys_page_alloc+0x2c>
+  800f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+  800f0e:	83 ec 0c             	sub    $0xc,%esp
+  800f11:	50                   	push   %eax
+  800f12:	6a 04                	push   $0x4
+  800f14:	68 2b 3d 80 00       	push   $0x803d2b
+  800f19:	6a 24                	push   $0x24
+  800f1b:	68 48 3d 80 00       	push   $0x803d48
+  800f20:	e8 8b f3 ff ff       	call   8002b0 <_panic>
+
+00800f25 <sys_page_map>:
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	57                   	push   %edi
+  800f29:	56                   	push   %esi
+  800f2a:	53                   	push   %ebx
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+  800f2e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f35:	74 33                	je     800f6a <sys_page_map+0x45>
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f45:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f48:	ff 75 18             	push   0x18(%ebp)
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	8d 35 56 0f 80 00    	lea    0x800f56,%esi
+  800f54:	0f 34                	sysenter
+  800f56:	5d                   	pop    %ebp
+  800f57:	83 c4 04             	add    $0x4,%esp
+  800f5a:	89 c2                	mov    %eax,%edx
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	7f 3d                	jg     800f9d <sys_page_map+0x78>
+  800f60:	89 d0                	mov    %edx,%eax
+  800f62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f65:	5b                   	pop    %ebx
+  800f66:	5e                   	pop    %esi
+  800f67:	5f                   	pop    %edi
+  800f68:	5d                   	pop    %ebp
+  800f69:	c3                   	ret
+  800f6a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f78:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f7b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f7e:	cd 30                	int    $0x30
+  800f80:	89 c2                	mov    %eax,%edx
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	7e da                	jle    800f60 <sys_page_map+0x3b>
+  800f86:	83 ec 0c             	sub    $0xc,%esp
+  800f89:	50                   	push   %eax
+  800f8a:	6a 05                	push   $0x5
+  800f8c:	68 2b 3d 80 00       	push   $0x803d2b
+  800f91:	6a 24                	push   $0x24
+  800f93:	68 48 3d 80 00       	push   $0x803d48
+  800f98:	e8 13 f3 ff ff       	call   8002b0 <_panic>
+  800f9d:	83 ec 0c             	sub    $0xc,%esp
+  800fa0:	50                   	push   %eax
+  800fa1:	6a 05                	push   $0x5
+  800fa3:	68 2b 3d 80 00       	push   $0x803d2b
+  800fa8:	6a 48                	push   $0x48
+  800faa:	68 48 3d 80 00       	push   $0x803d48
+  800faf:	e8 fc f2 ff ff       	call   8002b0 <_panic>
+
+00800fb4 <sys_page_unmap>:
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	57                   	push   %edi
+  800fb8:	56                   	push   %esi
+  800fb9:	53                   	push   %ebx
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+  800fbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fcd:	89 df                	mov    %ebx,%edi
+  800fcf:	89 de                	mov    %ebx,%esi
+  800fd1:	cd 30                	int    $0x30
+  800fd3:	85 c0                	test   %eax,%eax
+  800fd5:	7f 08                	jg     800fdf <sys_page_unmap+0x2b>
+  800fd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5e                   	pop    %esi
+  800fdc:	5f                   	pop    %edi
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+  800fe2:	50                   	push   %eax
+  800fe3:	6a 06                	push   $0x6
+  800fe5:	68 2b 3d 80 00       	push   $0x803d2b
+  800fea:	6a 24                	push   $0x24
+  800fec:	68 48 3d 80 00       	push   $0x803d48
+  800ff1:	e8 ba f2 ff ff       	call   8002b0 <_panic>
+
+00800ff6 <sys_fork>:
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+  800ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801001:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801006:	89 d1                	mov    %edx,%ecx
+  801008:	89 d3                	mov    %edx,%ebx
+  80100a:	89 d7                	mov    %edx,%edi
+  80100c:	89 d6                	mov    %edx,%esi
+  80100e:	cd 30                	int    $0x30
+  801010:	5b                   	pop    %ebx
+  801011:	5e                   	pop    %esi
+  801012:	5f                   	pop    %edi
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+
+00801015 <sys_env_set_status>:
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+  80101b:	83 ec 0c             	sub    $0xc,%esp
+  80101e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801023:	8b 55 08             	mov    0x8(%ebp),%edx
+  801026:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801029:	b8 08 00 00 00       	mov    $0x8,%eax
+  80102e:	89 df                	mov    %ebx,%edi
+  801030:	89 de                	mov    %ebx,%esi
+  801032:	cd 30                	int    $0x30
+  801034:	85 c0                	test   %eax,%eax
+  801036:	7f 08                	jg     801040 <sys_env_set_status+0x2b>
+  801038:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103b:	5b                   	pop    %ebx
+  80103c:	5e                   	pop    %esi
+  80103d:	5f                   	pop    %edi
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+  801040:	83 ec 0c             	sub    $0xc,%esp
+  801043:	50                   	push   %eax
+  801044:	6a 08                	push   $0x8
+  801046:	68 2b 3d 80 00       	push   $0x803d2b
+  80104b:	6a 24                	push   $0x24
+  80104d:	68 48 3d 80 00       	push   $0x803d48
+  801052:	e8 59 f2 ff ff       	call   8002b0 <_panic>
+
+00801057 <sys_env_set_trapframe>:
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	56                   	push   %esi
+  80105c:	53                   	push   %ebx
+  80105d:	83 ec 0c             	sub    $0xc,%esp
+  801060:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801065:	8b 55 08             	mov    0x8(%ebp),%edx
+  801068:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801070:	89 df                	mov    %ebx,%edi
+  801072:	89 de                	mov    %ebx,%esi
+  801074:	cd 30                	int    $0x30
+  801076:	85 c0                	test   %eax,%eax
+  801078:	7f 08                	jg     801082 <sys_env_set_trapframe+0x2b>
+  80107a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107d:	5b                   	pop    %ebx
+  80107e:	5e                   	pop    %esi
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	50                   	push   %eax
+  801086:	6a 09                	push   $0x9
+  801088:	68 2b 3d 80 00       	push   $0x803d2b
+  80108d:	6a 24                	push   $0x24
+  80108f:	68 48 3d 80 00       	push   $0x803d48
+  801094:	e8 17 f2 ff ff       	call   8002b0 <_panic>
+
+00801099 <sys_env_set_cow>:
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+  80109f:	83 ec 0c             	sub    $0xc,%esp
+  8010a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ad:	b8 20 00 00 00       	mov    $0x20,%eax
+  8010b2:	89 df                	mov    %ebx,%edi
+  8010b4:	89 de                	mov    %ebx,%esi
+  8010b6:	cd 30                	int    $0x30
+  8010b8:	85 c0                	test   %eax,%eax
+  8010ba:	7f 08                	jg     8010c4 <sys_env_set_cow+0x2b>
+  8010bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bf:	5b                   	pop    %ebx
+  8010c0:	5e                   	pop    %esi
+  8010c1:	5f                   	pop    %edi
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	c3                   	ret
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+  8010c7:	50                   	push   %eax
+  8010c8:	6a 20                	push   $0x20
+  8010ca:	68 2b 3d 80 00       	push   $0x803d2b
+  8010cf:	6a 24                	push   $0x24
+  8010d1:	68 48 3d 80 00       	push   $0x803d48
+  8010d6:	e8 d5 f1 ff ff       	call   8002b0 <_panic>
+
+008010db <sys_env_service>:
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+  8010e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8010ee:	89 cb                	mov    %ecx,%ebx
+  8010f0:	89 cf                	mov    %ecx,%edi
+  8010f2:	89 ce                	mov    %ecx,%esi
+  8010f4:	cd 30                	int    $0x30
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+
+008010fb <sys_env_set_pgfault_upcall>:
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+  801101:	83 ec 0c             	sub    $0xc,%esp
+  801104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801114:	89 df                	mov    %ebx,%edi
+  801116:	89 de                	mov    %ebx,%esi
+  801118:	cd 30                	int    $0x30
+  80111a:	85 c0                	test   %eax,%eax
+  80111c:	7f 08                	jg     801126 <sys_env_set_pgfault_upcall+0x2b>
+  80111e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801121:	5b                   	pop    %ebx
+  801122:	5e                   	pop    %esi
+  801123:	5f                   	pop    %edi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+  801126:	83 ec 0c             	sub    $0xc,%esp
+  801129:	50                   	push   %eax
+  80112a:	6a 0a                	push   $0xa
+  80112c:	68 2b 3d 80 00       	push   $0x803d2b
+  801131:	6a 24                	push   $0x24
+  801133:	68 48 3d 80 00       	push   $0x803d48
+  801138:	e8 73 f1 ff ff       	call   8002b0 <_panic>
+
+0080113d <sys_ipc_try_send>:
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	57                   	push   %edi
+  801141:	56                   	push   %esi
+  801142:	53                   	push   %ebx
+  801143:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80114a:	74 27                	je     801173 <sys_ipc_try_send+0x36>
+  80114c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801152:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801157:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80115d:	6a 00                	push   $0x0
+  80115f:	55                   	push   %ebp
+  801160:	89 e5                	mov    %esp,%ebp
+  801162:	8d 35 6a 11 80 00    	lea    0x80116a,%esi
+  801168:	0f 34                	sysenter
+  80116a:	5d                   	pop    %ebp
+  80116b:	83 c4 04             	add    $0x4,%esp
+  80116e:	5b                   	pop    %ebx
+  80116f:	5e                   	pop    %esi
+  801170:	5f                   	pop    %edi
+  801171:	5d                   	pop    %ebp
+  801172:	c3                   	ret
+  801173:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801178:	be 00 00 00 00       	mov    $0x0,%esi
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801183:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801186:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801189:	cd 30                	int    $0x30
+  80118b:	eb e1                	jmp    80116e <sys_ipc_try_send+0x31>
+
+0080118d <sys_ipc_recv>:
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+  801193:	83 ec 0c             	sub    $0xc,%esp
+  801196:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80119d:	74 32                	je     8011d1 <sys_ipc_recv+0x44>
+  80119f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ac:	89 cb                	mov    %ecx,%ebx
+  8011ae:	89 cf                	mov    %ecx,%edi
+  8011b0:	6a 00                	push   $0x0
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	8d 35 bd 11 80 00    	lea    0x8011bd,%esi
+  8011bb:	0f 34                	sysenter
+  8011bd:	5d                   	pop    %ebp
+  8011be:	83 c4 04             	add    $0x4,%esp
+  8011c1:	89 c2                	mov    %eax,%edx
+  8011c3:	85 c0                	test   %eax,%eax
+  8011c5:	7f 3c                	jg     801203 <sys_ipc_recv+0x76>
+  8011c7:	89 d0                	mov    %edx,%eax
+  8011c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cc:	5b                   	pop    %ebx
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+  8011d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011de:	89 cb                	mov    %ecx,%ebx
+  8011e0:	89 cf                	mov    %ecx,%edi
+  8011e2:	89 ce                	mov    %ecx,%esi
+  8011e4:	cd 30                	int    $0x30
+  8011e6:	89 c2                	mov    %eax,%edx
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	7e db                	jle    8011c7 <sys_ipc_recv+0x3a>
+  8011ec:	83 ec 0c             	sub    $0xc,%esp
+  8011ef:	50                   	push   %eax
+  8011f0:	6a 0d                	push   $0xd
+  8011f2:	68 2b 3d 80 00       	push   $0x803d2b
+  8011f7:	6a 24                	push   $0x24
+  8011f9:	68 48 3d 80 00       	push   $0x803d48
+  8011fe:	e8 ad f0 ff ff       	call   8002b0 <_panic>
+  801203:	83 ec 0c             	sub    $0xc,%esp
+  801206:	50                   	push   %eax
+  801207:	6a 0d                	push   $0xd
+  801209:	68 2b 3d 80 00       	push   $0x803d2b
+  80120e:	6a 48                	push   $0x48
+  801210:	68 48 3d 80 00       	push   $0x803d48
+  801215:	e8 96 f0 ff ff       	call   8002b0 <_panic>
+
+0080121a <sys_ipc_send>:
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	57                   	push   %edi
+  80121e:	56                   	push   %esi
+  80121f:	53                   	push   %ebx
+  801220:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801227:	74 27                	je     801250 <sys_ipc_send+0x36>
+  801229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801234:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801237:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80123a:	6a 00                	push   $0x0
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	8d 35 47 12 80 00    	lea    0x801247,%esi
+  801245:	0f 34                	sysenter
+  801247:	5d                   	pop    %ebp
+  801248:	83 c4 04             	add    $0x4,%esp
+  80124b:	5b                   	pop    %ebx
+  80124c:	5e                   	pop    %esi
+  80124d:	5f                   	pop    %edi
+  80124e:	5d                   	pop    %ebp
+  80124f:	c3                   	ret
+  801250:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801255:	be 00 00 00 00       	mov    $0x0,%esi
+  80125a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801260:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801263:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801266:	cd 30                	int    $0x30
+  801268:	eb e1                	jmp    80124b <sys_ipc_send+0x31>
+
+0080126a <sys_ipc_call>:
+  80126a:	55                   	push   %ebp
+  80126b:	89 e5                	mov    %esp,%ebp
+  80126d:	57                   	push   %edi
+  80126e:	56                   	push   %esi
+  80126f:	53                   	push   %ebx
+  801270:	8b 55 08             	mov    0x8(%ebp),%edx
+  801273:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801276:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80127b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80127e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801281:	8b 75 18             	mov    0x18(%ebp),%esi
+  801284:	cd 30                	int    $0x30
+  801286:	5b                   	pop    %ebx
+  801287:	5e                   	pop    %esi
+  801288:	5f                   	pop    %edi
+  801289:	5d                   	pop    %ebp
+  80128a:	c3                   	ret
+
+0080128b <sys_ipc_reply_recv>:
+  80128b:	55                   	push   %ebp
+  80128c:	89 e5                	mov    %esp,%ebp
+  80128e:	57                   	push   %edi
+  80128f:	56                   	push   %esi
+  801290:	53                   	push   %ebx
+  801291:	8b 55 08             	mov    0x8(%ebp),%edx
+  801294:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801297:	b8 10 00 00 00       	mov    $0x10,%eax
+  80129c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012a5:	cd 30                	int    $0x30
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+
+008012ac <sys_time_msec>:
+  8012ac:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	75 06                	jne    8012bb <sys_time_msec+0xf>
+  8012b5:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8012ba:	c3                   	ret
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	57                   	push   %edi
+  8012bf:	56                   	push   %esi
+  8012c0:	53                   	push   %ebx
+  8012c1:	83 ec 0c             	sub    $0xc,%esp
+  8012c4:	0f 31                	rdtsc
+  8012c6:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8012cc:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8012d2:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8012d8:	29 c8                	sub    %ecx,%eax
+  8012da:	19 da                	sbb    %ebx,%edx
+  8012dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012e1:	57                   	push   %edi
+  8012e2:	56                   	push   %esi
+  8012e3:	52                   	push   %edx
+  8012e4:	50                   	push   %eax
+  8012e5:	e8 1f 25 00 00       	call   803809 <__udivdi3>
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+
+008012f5 <sys_env_swap>:
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+  8012fb:	83 ec 0c             	sub    $0xc,%esp
+  8012fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801303:	8b 55 08             	mov    0x8(%ebp),%edx
+  801306:	b8 12 00 00 00       	mov    $0x12,%eax
+  80130b:	89 cb                	mov    %ecx,%ebx
+  80130d:	89 cf                	mov    %ecx,%edi
+  80130f:	89 ce                	mov    %ecx,%esi
+  801311:	cd 30                	int    $0x30
+  801313:	85 c0                	test   %eax,%eax
+  801315:	7f 08                	jg     80131f <sys_env_swap+0x2a>
+  801317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131a:	5b                   	pop    %ebx
+  80131b:	5e                   	pop    %esi
+  80131c:	5f                   	pop    %edi
+  80131d:	5d                   	pop    %ebp
+  80131e:	c3                   	ret
+  80131f:	83 ec 0c             	sub    $0xc,%esp
+  801322:	50                   	push   %eax
+  801323:	6a 12                	push   $0x12
+  801325:	68 2b 3d 80 00       	push   $0x803d2b
+  80132a:	6a 24                	push   $0x24
+  80132c:	68 48 3d 80 00       	push   $0x803d48
+  801331:	e8 7a ef ff ff       	call   8002b0 <_panic>
+
+00801336 <sys_net_try_send>:
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+  80133f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801344:	8b 55 08             	mov    0x8(%ebp),%edx
+  801347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80134f:	89 df                	mov    %ebx,%edi
+  801351:	89 de                	mov    %ebx,%esi
+  801353:	cd 30                	int    $0x30
+  801355:	85 c0                	test   %eax,%eax
+  801357:	7f 08                	jg     801361 <sys_net_try_send+0x2b>
+  801359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135c:	5b                   	pop    %ebx
+  80135d:	5e                   	pop    %esi
+  80135e:	5f                   	pop    %edi
+  80135f:	5d                   	pop    %ebp
+  801360:	c3                   	ret
+  801361:	83 ec 0c             	sub    $0xc,%esp
+  801364:	50                   	push   %eax
+  801365:	6a 13                	push   $0x13
+  801367:	68 2b 3d 80 00       	push   $0x803d2b
+  80136c:	6a 24                	push   $0x24
+  80136e:	68 48 3d 80 00       	push   $0x803d48
+  801373:	e8 38 ef ff ff       	call   8002b0 <_panic>
+
+00801378 <sys_net_try_receive>:
+  801378:	55                   	push   %ebp
+  801379:	89 e5                	mov    %esp,%ebp
+  80137b:	57                   	push   %edi
+  80137c:	56                   	push   %esi
+  80137d:	53                   	push   %ebx
+  80137e:	83 ec 0c             	sub    $0xc,%esp
+  801381:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801386:	8b 55 08             	mov    0x8(%ebp),%edx
+  801389:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801391:	89 df                	mov    %ebx,%edi
+  801393:	89 de                	mov    %ebx,%esi
+  801395:	cd 30                	int    $0x30
+  801397:	85 c0                	test   %eax,%eax
+  801399:	7f 08                	jg     8013a3 <sys_net_try_receive+0x2b>
+  80139b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139e:	5b                   	pop    %ebx
+  80139f:	5e                   	pop    %esi
+  8013a0:	5f                   	pop    %edi
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+  8013a3:	83 ec 0c             	sub    $0xc,%esp
+  8013a6:	50                   	push   %eax
+  8013a7:	6a 14                	push   $0x14
+  8013a9:	68 2b 3d 80 00       	push   $0x803d2b
+  8013ae:	6a 24                	push   $0x24
+  8013b0:	68 48 3d 80 00       	push   $0x803d48
+  8013b5:	e8 f6 ee ff ff       	call   8002b0 <_panic>
+
+008013ba <sys_net_recv_page>:
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	57                   	push   %edi
+  8013be:	56                   	push   %esi
+  8013bf:	53                   	push   %ebx
+  8013c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c8:	b8 27 00 00 00       	mov    $0x27,%eax
+  8013cd:	89 cb                	mov    %ecx,%ebx
+  8013cf:	89 cf                	mov    %ecx,%edi
+  8013d1:	89 ce                	mov    %ecx,%esi
+  8013d3:	cd 30                	int    $0x30
+  8013d5:	5b                   	pop    %ebx
+  8013d6:	5e                   	pop    %esi
+  8013d7:	5f                   	pop    %edi
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	c3                   	ret
+
+008013da <sys_net_wait>:
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	57                   	push   %edi
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+  8013e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e5:	b8 26 00 00 00       	mov    $0x26,%eax
+  8013ea:	89 d1                	mov    %edx,%ecx
+  8013ec:	89 d3                	mov    %edx,%ebx
+  8013ee:	89 d7                	mov    %edx,%edi
+  8013f0:	89 d6                	mov    %edx,%esi
+  8013f2:	cd 30                	int    $0x30
+  8013f4:	5b                   	pop    %ebx
+  8013f5:	5e                   	pop    %esi
+  8013f6:	5f                   	pop    %edi
+  8013f7:	5d                   	pop    %ebp
+  8013f8:	c3                   	ret
+
+008013f9 <sys_get_mac>:
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	57                   	push   %edi
+  8013fd:	56                   	push   %esi
+  8013fe:	53                   	push   %ebx
+  8013ff:	83 ec 0c             	sub    $0xc,%esp
+  801402:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801407:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801412:	89 df                	mov    %ebx,%edi
+  801414:	89 de                	mov    %ebx,%esi
+  801416:	cd 30                	int    $0x30
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	7f 08                	jg     801424 <sys_get_mac+0x2b>
+  80141c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+  801424:	83 ec 0c             	sub    $0xc,%esp
+  801427:	50                   	push   %eax
+  801428:	6a 15                	push   $0x15
+  80142a:	68 2b 3d 80 00       	push   $0x803d2b
+  80142f:	6a 24                	push   $0x24
+  801431:	68 48 3d 80 00       	push   $0x803d48
+  801436:	e8 75 ee ff ff       	call   8002b0 <_panic>
+
+0080143b <sys_env_lease>:
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801449:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801454:	89 df                	mov    %ebx,%edi
+  801456:	89 de                	mov    %ebx,%esi
+  801458:	cd 30                	int    $0x30
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	7f 08                	jg     801466 <sys_env_lease+0x2b>
+  80145e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801461:	5b                   	pop    %ebx
+  801462:	5e                   	pop    %esi
+  801463:	5f                   	pop    %edi
+  801464:	5d                   	pop    %ebp
+  801465:	c3                   	ret
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	50                   	push   %eax
+  80146a:	6a 16                	push   $0x16
+  80146c:	68 2b 3d 80 00       	push   $0x803d2b
+  801471:	6a 24                	push   $0x24
+  801473:	68 48 3d 80 00       	push   $0x803d48
+  801478:	e8 33 ee ff ff       	call   8002b0 <_panic>
+
+0080147d <sys_copy_mem>:
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+  801483:	83 ec 0c             	sub    $0xc,%esp
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801491:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801494:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801497:	8b 75 18             	mov    0x18(%ebp),%esi
+  80149a:	cd 30                	int    $0x30
+  80149c:	85 c0                	test   %eax,%eax
+  80149e:	7f 08                	jg     8014a8 <sys_copy_mem+0x2b>
+  8014a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a3:	5b                   	pop    %ebx
+  8014a4:	5e                   	pop    %esi
+  8014a5:	5f                   	pop    %edi
+  8014a6:	5d                   	pop    %ebp
+  8014a7:	c3                   	ret
+  8014a8:	83 ec 0c             	sub    $0xc,%esp
+  8014ab:	50                   	push   %eax
+  8014ac:	6a 17                	push   $0x17
+  8014ae:	68 2b 3d 80 00       	push   $0x803d2b
+  8014b3:	6a 24                	push   $0x24
+  8014b5:	68 48 3d 80 00       	push   $0x803d48
+  8014ba:	e8 f1 ed ff ff       	call   8002b0 <_panic>
+
+008014bf <sys_get_perms>:
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	57                   	push   %edi
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	83 ec 0c             	sub    $0xc,%esp
+  8014c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014db:	89 f7                	mov    %esi,%edi
+  8014dd:	cd 30                	int    $0x30
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	7f 08                	jg     8014eb <sys_get_perms+0x2c>
+  8014e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e6:	5b                   	pop    %ebx
+  8014e7:	5e                   	pop    %esi
+  8014e8:	5f                   	pop    %edi
+  8014e9:	5d                   	pop    %ebp
+  8014ea:	c3                   	ret
+  8014eb:	83 ec 0c             	sub    $0xc,%esp
+  8014ee:	50                   	push   %eax
+  8014ef:	6a 18                	push   $0x18
+  8014f1:	68 2b 3d 80 00       	push   $0x803d2b
+  8014f6:	6a 24                	push   $0x24
+  8014f8:	68 48 3d 80 00       	push   $0x803d48
+  8014fd:	e8 ae ed ff ff       	call   8002b0 <_panic>
+
+00801502 <sys_env_unsuspend>:
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	57                   	push   %edi
+  801506:	56                   	push   %esi
+  801507:	53                   	push   %ebx
+  801508:	83 ec 0c             	sub    $0xc,%esp
+  80150b:	be 00 00 00 00       	mov    $0x0,%esi
+  801510:	8b 55 08             	mov    0x8(%ebp),%edx
+  801513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801516:	b8 19 00 00 00       	mov    $0x19,%eax
+  80151b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151e:	89 f7                	mov    %esi,%edi
+  801520:	cd 30                	int    $0x30
+  801522:	85 c0                	test   %eax,%eax
+  801524:	7f 08                	jg     80152e <sys_env_unsuspend+0x2c>
+  801526:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801529:	5b                   	pop    %ebx
+  80152a:	5e                   	pop    %esi
+  80152b:	5f                   	pop    %edi
+  80152c:	5d                   	pop    %ebp
+  80152d:	c3                   	ret
+  80152e:	83 ec 0c             	sub    $0xc,%esp
+  801531:	50                   	push   %eax
+  801532:	6a 19                	push   $0x19
+  801534:	68 2b 3d 80 00       	push   $0x803d2b
+  801539:	6a 24                	push   $0x24
+  80153b:	68 48 3d 80 00       	push   $0x803d48
+  801540:	e8 6b ed ff ff       	call   8002b0 <_panic>
+
+00801545 <sys_migrate>:
+  801545:	55                   	push   %ebp
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	57                   	push   %edi
+  801549:	56                   	push   %esi
+  80154a:	53                   	push   %ebx
+  80154b:	83 ec 0c             	sub    $0xc,%esp
+  80154e:	ba 04 90 80 00       	mov    $0x809004,%edx
+  801553:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801559:	76 11                	jbe    80156c <sys_migrate+0x27>
+  80155b:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801560:	0f b6 08             	movzbl (%eax),%ecx
+  801563:	05 00 10 00 00       	add    $0x1000,%eax
+  801568:	39 d0                	cmp    %edx,%eax
+  80156a:	72 f4                	jb     801560 <sys_migrate+0x1b>
+  80156c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801579:	89 cb                	mov    %ecx,%ebx
+  80157b:	89 cf                	mov    %ecx,%edi
+  80157d:	89 ce                	mov    %ecx,%esi
+  80157f:	cd 30                	int    $0x30
+  801581:	85 c0                	test   %eax,%eax
+  801583:	7f 08                	jg     80158d <sys_migrate+0x48>
+  801585:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801588:	5b                   	pop    %ebx
+  801589:	5e                   	pop    %esi
+  80158a:	5f                   	pop    %edi
+  80158b:	5d                   	pop    %ebp
+  80158c:	c3                   	ret
+  80158d:	83 ec 0c             	sub    $0xc,%esp
+  801590:	50                   	push   %eax
+  801591:	6a 1a                	push   $0x1a
+  801593:	68 2b 3d 80 00       	push   $0x803d2b
+  801598:	6a 24                	push   $0x24
+  80159a:	68 48 3d 80 00       	push   $0x803d48
+  80159f:	e8 0c ed ff ff       	call   8002b0 <_panic>
+
+008015a4 <sys_lease_complete>:
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	57                   	push   %edi
+  8015a8:	56                   	push   %esi
+  8015a9:	53                   	push   %ebx
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+  8015ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015b7:	89 d1                	mov    %edx,%ecx
+  8015b9:	89 d3                	mov    %edx,%ebx
+  8015bb:	89 d7                	mov    %edx,%edi
+  8015bd:	89 d6                	mov    %edx,%esi
+  8015bf:	cd 30                	int    $0x30
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	7f 08                	jg     8015cd <sys_lease_complete+0x29>
+  8015c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c8:	5b                   	pop    %ebx
+  8015c9:	5e                   	pop    %esi
+  8015ca:	5f                   	pop    %edi
+  8015cb:	5d                   	pop    %ebp
+  8015cc:	c3                   	ret
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	50                   	push   %eax
+  8015d1:	6a 1b                	push   $0x1b
+  8015d3:	68 2b 3d 80 00       	push   $0x803d2b
+  8015d8:	6a 24                	push   $0x24
+  8015da:	68 48 3d 80 00       	push   $0x803d48
+  8015df:	e8 cc ec ff ff       	call   8002b0 <_panic>
+
+008015e4 <sys_env_set_thisenv>:
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	57                   	push   %edi
+  8015e8:	56                   	push   %esi
+  8015e9:	53                   	push   %ebx
+  8015ea:	83 ec 0c             	sub    $0xc,%esp
+  8015ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015fd:	89 df                	mov    %ebx,%edi
+  8015ff:	89 de                	mov    %ebx,%esi
+  801601:	cd 30                	int    $0x30
+  801603:	85 c0                	test   %eax,%eax
+  801605:	7f 08                	jg     80160f <sys_env_set_thisenv+0x2b>
+  801607:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160a:	5b                   	pop    %ebx
+  80160b:	5e                   	pop    %esi
+  80160c:	5f                   	pop    %edi
+  80160d:	5d                   	pop    %ebp
+  80160e:	c3                   	ret
+  80160f:	83 ec 0c             	sub    $0xc,%esp
+  801612:	50                   	push   %eax
+  801613:	6a 1c                	push   $0x1c
+  801615:	68 2b 3d 80 00       	push   $0x803d2b
+  80161a:	6a 24                	push   $0x24
+  80161c:	68 48 3d 80 00       	push   $0x803d48
+  801621:	e8 8a ec ff ff       	call   8002b0 <_panic>
+
+00801626 <sys_env_set_sched>:
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  801629:	57                   	push   %edi
+  80162a:	56                   	push   %esi
+  80162b:	53                   	push   %ebx
+  80162c:	83 ec 0c             	sub    $0xc,%esp
+  80162f:	be 00 00 00 00       	mov    $0x0,%esi
+  801634:	8b 55 08             	mov    0x8(%ebp),%edx
+  801637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80163f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801642:	89 f7                	mov    %esi,%edi
+  801644:	cd 30                	int    $0x30
+  801646:	85 c0                	test   %eax,%eax
+  801648:	7f 08                	jg     801652 <sys_env_set_sched+0x2c>
+  80164a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164d:	5b                   	pop    %ebx
+  80164e:	5e                   	pop    %esi
+  80164f:	5f                   	pop    %edi
+  801650:	5d                   	pop    %ebp
+  801651:	c3                   	ret
+  801652:	83 ec 0c             	sub    $0xc,%esp
+  801655:	50                   	push   %eax
+  801656:	6a 1d                	push   $0x1d
+  801658:	68 2b 3d 80 00       	push   $0x803d2b
+  80165d:	6a 24                	push   $0x24
+  80165f:	68 48 3d 80 00       	push   $0x803d48
+  801664:	e8 47 ec ff ff       	call   8002b0 <_panic>
+
+00801669 <sys_batch>:
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	57                   	push   %edi
+  80166d:	56                   	push   %esi
+  80166e:	53                   	push   %ebx
+  80166f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801674:	8b 55 08             	mov    0x8(%ebp),%edx
+  801677:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80167f:	89 df                	mov    %ebx,%edi
+  801681:	89 de                	mov    %ebx,%esi
+  801683:	cd 30                	int    $0x30
+  801685:	5b                   	pop    %ebx
+  801686:	5e                   	pop    %esi
+  801687:	5f                   	pop    %edi
+  801688:	5d                   	pop    %ebp
+  801689:	c3                   	ret
+
+0080168a <sys_env_stats>:
+  80168a:	55                   	push   %ebp
+  80168b:	89 e5                	mov    %esp,%ebp
+  80168d:	57                   	push   %edi
+  80168e:	56                   	push   %esi
+  80168f:	53                   	push   %ebx
+  801690:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801695:	8b 55 08             	mov    0x8(%ebp),%edx
+  801698:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169b:	b8 23 00 00 00       	mov    $0x23,%eax
+  8016a0:	89 df                	mov    %ebx,%edi
+  8016a2:	89 de                	mov    %ebx,%esi
+  8016a4:	cd 30                	int    $0x30
+  8016a6:	5b                   	pop    %ebx
+  8016a7:	5e                   	pop    %esi
+  8016a8:	5f                   	pop    %edi
+  8016a9:	5d                   	pop    %ebp
+  8016aa:	c3                   	ret
+
+008016ab <sys_trace>:
+  8016ab:	55                   	push   %ebp
+  8016ac:	89 e5                	mov    %esp,%ebp
+  8016ae:	57                   	push   %edi
+  8016af:	56                   	push   %esi
+  8016b0:	53                   	push   %ebx
+  8016b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b9:	b8 24 00 00 00       	mov    $0x24,%eax
+  8016be:	89 cb                	mov    %ecx,%ebx
+  8016c0:	89 cf                	mov    %ecx,%edi
+  8016c2:	89 ce                	mov    %ecx,%esi
+  8016c4:	cd 30                	int    $0x30
+  8016c6:	5b                   	pop    %ebx
+  8016c7:	5e                   	pop    %esi
+  8016c8:	5f                   	pop    %edi
+  8016c9:	5d                   	pop    %ebp
+  8016ca:	c3                   	ret
+
+008016cb <sys_env_set_pager>:
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	57                   	push   %edi
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+  8016d1:	83 ec 0c             	sub    $0xc,%esp
+  8016d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016df:	b8 25 00 00 00       	mov    $0x25,%eax
+  8016e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e7:	89 f7                	mov    %esi,%edi
+  8016e9:	cd 30                	int    $0x30
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	7f 08                	jg     8016f7 <sys_env_set_pager+0x2c>
+  8016ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5f                   	pop    %edi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+  8016f7:	83 ec 0c             	sub    $0xc,%esp
+  8016fa:	50                   	push   %eax
+  8016fb:	6a 25                	push   $0x25
+  8016fd:	68 2b 3d 80 00       	push   $0x803d2b
+  801702:	6a 24                	push   $0x24
+  801704:	68 48 3d 80 00       	push   $0x803d48
+  801709:	e8 a2 eb ff ff       	call   8002b0 <_panic>
+
+0080170e <sys_pager_retire>:
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	57                   	push   %edi
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+  801714:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801719:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171c:	b8 28 00 00 00       	mov    $0x28,%eax
+  801721:	89 cb                	mov    %ecx,%ebx
+  801723:	89 cf                	mov    %ecx,%edi
+  801725:	89 ce                	mov    %ecx,%esi
+  801727:	cd 30                	int    $0x30
+  801729:	5b                   	pop    %ebx
+  80172a:	5e                   	pop    %esi
+  80172b:	5f                   	pop    %edi
+  80172c:	5d                   	pop    %ebp
+  80172d:	c3                   	ret
+
+0080172e <sys_prof>:
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	57                   	push   %edi
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+  801734:	be 00 00 00 00       	mov    $0x0,%esi
+  801739:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173f:	b8 22 00 00 00       	mov    $0x22,%eax
+  801744:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801747:	89 f7                	mov    %esi,%edi
+  801749:	cd 30                	int    $0x30
+  80174b:	5b                   	pop    %ebx
+  80174c:	5e                   	pop    %esi
+  80174d:	5f                   	pop    %edi
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+
+00801750 <dupq_flush>:
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	53                   	push   %ebx
+  801754:	83 ec 0c             	sub    $0xc,%esp
+  801757:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  80175d:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801764:	00 00 00 
+  801767:	53                   	push   %ebx
+  801768:	68 00 00 40 00       	push   $0x400000
+  80176d:	e8 f7 fe ff ff       	call   801669 <sys_batch>
+  801772:	83 c4 10             	add    $0x10,%esp
+  801775:	85 c0                	test   %eax,%eax
+  801777:	78 14                	js     80178d <dupq_flush+0x3d>
+  801779:	39 c3                	cmp    %eax,%ebx
+  80177b:	7e 0b                	jle    801788 <dupq_flush+0x38>
+  80177d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801780:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801786:	eb 05                	jmp    80178d <dupq_flush+0x3d>
+  801788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801790:	c9                   	leave
+  801791:	c3                   	ret
+
+00801792 <pgfault>:
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	56                   	push   %esi
+  801796:	53                   	push   %ebx
+  801797:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179a:	8b 30                	mov    (%eax),%esi
+  80179c:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8017a0:	0f 84 83 00 00 00    	je     801829 <pgfault+0x97>
+  8017a6:	89 f0                	mov    %esi,%eax
+  8017a8:	c1 e8 0c             	shr    $0xc,%eax
+  8017ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017b2:	f6 c4 08             	test   $0x8,%ah
+  8017b5:	0f 84 80 00 00 00    	je     80183b <pgfault+0xa9>
+  8017bb:	e8 b8 f6 ff ff       	call   800e78 <sys_getenvid>
+  8017c0:	89 c3                	mov    %eax,%ebx
+  8017c2:	83 ec 04             	sub    $0x4,%esp
+  8017c5:	6a 07                	push   $0x7
+  8017c7:	68 00 f0 7f 00       	push   $0x7ff000
+  8017cc:	50                   	push   %eax
+  8017cd:	e8 10 f7 ff ff       	call   800ee2 <sys_page_alloc>
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	85 c0                	test   %eax,%eax
+  8017d7:	78 74                	js     80184d <pgfault+0xbb>
+  8017d9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8017df:	83 ec 04             	sub    $0x4,%esp
+  8017e2:	68 00 10 00 00       	push   $0x1000
+  8017e7:	56                   	push   %esi
+  8017e8:	68 00 f0 7f 00       	push   $0x7ff000
+  8017ed:	e8 40 f4 ff ff       	call   800c32 <memmove>
+  8017f2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8017f9:	56                   	push   %esi
+  8017fa:	53                   	push   %ebx
+  8017fb:	68 00 f0 7f 00       	push   $0x7ff000
+  801800:	53                   	push   %ebx
+  801801:	e8 1f f7 ff ff       	call   800f25 <sys_page_map>
+  801806:	83 c4 20             	add    $0x20,%esp
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	78 54                	js     801861 <pgfault+0xcf>
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  801810:	68 00 f0 7f 00       	push   $0x7ff000
+  801815:	53                   	push   %ebx
+  801816:	e8 99 f7 ff ff       	call   800fb4 <sys_page_unmap>
+  80181b:	83 c4 10             	add    $0x10,%esp
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	78 53                	js     801875 <pgfault+0xe3>
+  801822:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801825:	5b                   	pop    %ebx
+  801826:	5e                   	pop    %esi
+  801827:	5d                   	pop    %ebp
+  801828:	c3                   	ret
+  801829:	56                   	push   %esi
+  80182a:	68 58 3d 80 00       	push   $0x803d58
+  80182f:	6a 19                	push   $0x19
+  801831:	68 34 3e 80 00       	push   $0x803e34
+  801836:	e8 75 ea ff ff       	call   8002b0 <_panic>
+  80183b:	56                   	push   %esi
+  80183c:	68 8c 3d 80 00       	push   $0x803d8c
+  801841:	6a 1e                	push   $0x1e
+  801843:	68 34 3e 80 00       	push   $0x803e34
+  801848:	e8 63 ea ff ff       	call   8002b0 <_panic>
+  80184d:	83 ec 04             	sub    $0x4,%esp
+  801850:	68 c0 3d 80 00       	push   $0x803dc0
+  801855:	6a 2e                	push   $0x2e
+  801857:	68 34 3e 80 00       	push   $0x803e34
+  80185c:	e8 4f ea ff ff       	call   8002b0 <_panic>
+  801861:	83 ec 04             	sub    $0x4,%esp
+  801864:	68 e4 3d 80 00       	push   $0x803de4
+  801869:	6a 37                	push   $0x37
+  80186b:	68 34 3e 80 00       	push   $0x803e34
+  801870:	e8 3b ea ff ff       	call   8002b0 <_panic>
+  801875:	83 ec 04             	sub    $0x4,%esp
+  801878:	68 10 3e 80 00       	push   $0x803e10
+  80187d:	6a 3c                	push   $0x3c
+  80187f:	68 34 3e 80 00       	push   $0x803e34
+  801884:	e8 27 ea ff ff       	call   8002b0 <_panic>
+
+00801889 <dupq_begin>:
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+  80188c:	83 ec 0c             	sub    $0xc,%esp
+  80188f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801896:	00 00 00 
+  801899:	6a 07                	push   $0x7
+  80189b:	68 00 00 40 00       	push   $0x400000
+  8018a0:	6a 00                	push   $0x0
+  8018a2:	e8 3b f6 ff ff       	call   800ee2 <sys_page_alloc>
+  8018a7:	c9                   	leave
+  8018a8:	c3                   	ret
+
+008018a9 <dupq_map>:
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+  8018af:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  8018b6:	00 00 00 
+  8018b9:	74 46                	je     801901 <dupq_map+0x58>
+  8018bb:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8018c1:	8d 42 01             	lea    0x1(%edx),%eax
+  8018c4:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018c9:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8018cc:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  8018d2:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  8018d9:	00 00 00 
+  8018dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018df:	89 50 04             	mov    %edx,0x4(%eax)
+  8018e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018e5:	c1 e2 0c             	shl    $0xc,%edx
+  8018e8:	89 50 08             	mov    %edx,0x8(%eax)
+  8018eb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8018ee:	89 48 0c             	mov    %ecx,0xc(%eax)
+  8018f1:	89 50 10             	mov    %edx,0x10(%eax)
+  8018f4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8018f7:	89 50 14             	mov    %edx,0x14(%eax)
+  8018fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ff:	c9                   	leave
+  801900:	c3                   	ret
+  801901:	e8 4a fe ff ff       	call   801750 <dupq_flush>
+  801906:	85 c0                	test   %eax,%eax
+  801908:	79 b1                	jns    8018bb <dupq_map+0x12>
+  80190a:	eb f3                	jmp    8018ff <dupq_map+0x56>
+
+0080190c <dupq_end>:
+  80190c:	55                   	push   %ebp
+  80190d:	89 e5                	mov    %esp,%ebp
+  80190f:	53                   	push   %ebx
+  801910:	83 ec 04             	sub    $0x4,%esp
+  801913:	e8 38 fe ff ff       	call   801750 <dupq_flush>
+  801918:	89 c3                	mov    %eax,%ebx
+  80191a:	83 ec 08             	sub    $0x8,%esp
+  80191d:	68 00 00 40 00       	push   $0x400000
+  801922:	6a 00                	push   $0x0
+  801924:	e8 8b f6 ff ff       	call   800fb4 <sys_page_unmap>
+  801929:	89 d8                	mov    %ebx,%eax
+  80192b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80192e:	c9                   	leave
+  80192f:	c3                   	ret
+
+00801930 <fork>:
+  801930:	55                   	push   %ebp
+  801931:	89 e5                	mov    %esp,%ebp
+  801933:	53                   	push   %ebx
+  801934:	83 ec 10             	sub    $0x10,%esp
+  801937:	68 92 17 80 00       	push   $0x801792
+  80193c:	e8 9f 1a 00 00       	call   8033e0 <set_pgfault_handler>
+  801941:	83 c4 08             	add    $0x8,%esp
+  801944:	6a 01                	push   $0x1
+  801946:	6a 00                	push   $0x0
+  801948:	e8 4c f7 ff ff       	call   801099 <sys_env_set_cow>
+  80194d:	e8 a4 f6 ff ff       	call   800ff6 <sys_fork>
+  801952:	89 c3                	mov    %eax,%ebx
+  801954:	83 c4 10             	add    $0x10,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	74 07                	je     801962 <fork+0x32>
+  80195b:	89 d8                	mov    %ebx,%eax
+  80195d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801960:	c9                   	leave
+  801961:	c3                   	ret
+  801962:	e8 11 f5 ff ff       	call   800e78 <sys_getenvid>
+  801967:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80196c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801972:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801977:	a3 14 60 80 00       	mov    %eax,0x806014
+  80197c:	eb dd                	jmp    80195b <fork+0x2b>
+
+0080197e <sfork>:
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	57                   	push   %edi
+  801982:	56                   	push   %esi
+  801983:	53                   	push   %ebx
+  801984:	83 ec 1c             	sub    $0x1c,%esp
+  801987:	e8 ec f4 ff ff       	call   800e78 <sys_getenvid>
+  80198c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80198f:	83 ec 0c             	sub    $0xc,%esp
+  801992:	68 92 17 80 00       	push   $0x801792
+  801997:	e8 44 1a 00 00       	call   8033e0 <set_pgfault_handler>
+  80199c:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019a1:	cd 30                	int    $0x30
+  8019a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	0f 88 45 02 00 00    	js     801bf6 <sfork+0x278>
+  8019b1:	89 c6                	mov    %eax,%esi
+  8019b3:	74 17                	je     8019cc <sfork+0x4e>
+  8019b5:	e8 cf fe ff ff       	call   801889 <dupq_begin>
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	0f 88 40 02 00 00    	js     801c02 <sfork+0x284>
+  8019c2:	bf 02 00 00 00       	mov    $0x2,%edi
+  8019c7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8019ca:	eb 39                	jmp    801a05 <sfork+0x87>
+  8019cc:	e8 a7 f4 ff ff       	call   800e78 <sys_getenvid>
+  8019d1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019d6:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8019dc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019e1:	a3 14 60 80 00       	mov    %eax,0x806014
+  8019e6:	e9 23 01 00 00       	jmp    801b0e <sfork+0x190>
+  8019eb:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8019f2:	a8 01                	test   $0x1,%al
+  8019f4:	75 5b                	jne    801a51 <sfork+0xd3>
+  8019f6:	83 c7 01             	add    $0x1,%edi
+  8019f9:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  8019ff:	0f 84 40 01 00 00    	je     801b45 <sfork+0x1c7>
+  801a05:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a0c:	a8 01                	test   $0x1,%al
+  801a0e:	74 db                	je     8019eb <sfork+0x6d>
+  801a10:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a17:	a8 80                	test   $0x80,%al
+  801a19:	74 d0                	je     8019eb <sfork+0x6d>
+  801a1b:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a22:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a27:	0c 80                	or     $0x80,%al
+  801a29:	50                   	push   %eax
+  801a2a:	ff 75 e4             	push   -0x1c(%ebp)
+  801a2d:	89 f8                	mov    %edi,%eax
+  801a2f:	c1 e0 16             	shl    $0x16,%eax
+  801a32:	c1 e8 0c             	shr    $0xc,%eax
+  801a35:	50                   	push   %eax
+  801a36:	ff 75 e0             	push   -0x20(%ebp)
+  801a39:	e8 6b fe ff ff       	call   8018a9 <dupq_map>
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	79 b1                	jns    8019f6 <sfork+0x78>
+  801a45:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a4c:	e9 bd 00 00 00       	jmp    801b0e <sfork+0x190>
+  801a51:	89 fe                	mov    %edi,%esi
+  801a53:	c1 e6 16             	shl    $0x16,%esi
+  801a56:	89 f0                	mov    %esi,%eax
+  801a58:	c1 e8 0c             	shr    $0xc,%eax
+  801a5b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801a60:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801a63:	eb 57                	jmp    801abc <sfork+0x13e>
+  801a65:	e8 0e f4 ff ff       	call   800e78 <sys_getenvid>
+  801a6a:	89 c7                	mov    %eax,%edi
+  801a6c:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801a71:	f6 c4 04             	test   $0x4,%ah
+  801a74:	0f 85 9f 00 00 00    	jne    801b19 <sfork+0x19b>
+  801a7a:	a9 02 08 00 00       	test   $0x802,%eax
+  801a7f:	0f 85 c5 01 00 00    	jne    801c4a <sfork+0x2cc>
+  801a85:	6a 05                	push   $0x5
+  801a87:	ff 75 e4             	push   -0x1c(%ebp)
+  801a8a:	68 fd e7 0e 00       	push   $0xee7fd
+  801a8f:	57                   	push   %edi
+  801a90:	e8 14 fe ff ff       	call   8018a9 <dupq_map>
+  801a95:	83 c4 10             	add    $0x10,%esp
+  801a98:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801a9e:	0f 84 91 00 00 00    	je     801b35 <sfork+0x1b7>
+  801aa4:	89 f0                	mov    %esi,%eax
+  801aa6:	09 d8                	or     %ebx,%eax
+  801aa8:	c1 e8 0c             	shr    $0xc,%eax
+  801aab:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ab1:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801ab6:	0f 84 81 00 00 00    	je     801b3d <sfork+0x1bf>
+  801abc:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801ac1:	74 a2                	je     801a65 <sfork+0xe7>
+  801ac3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801aca:	f6 c2 01             	test   $0x1,%dl
+  801acd:	74 c9                	je     801a98 <sfork+0x11a>
+  801acf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ad6:	f6 c6 02             	test   $0x2,%dh
+  801ad9:	75 bd                	jne    801a98 <sfork+0x11a>
+  801adb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801ae2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ae9:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801aef:	f7 d2                	not    %edx
+  801af1:	21 ca                	and    %ecx,%edx
+  801af3:	52                   	push   %edx
+  801af4:	ff 75 e4             	push   -0x1c(%ebp)
+  801af7:	50                   	push   %eax
+  801af8:	ff 75 e0             	push   -0x20(%ebp)
+  801afb:	e8 a9 fd ff ff       	call   8018a9 <dupq_map>
+  801b00:	83 c4 10             	add    $0x10,%esp
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	79 91                	jns    801a98 <sfork+0x11a>
+  801b07:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b0e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b14:	5b                   	pop    %ebx
+  801b15:	5e                   	pop    %esi
+  801b16:	5f                   	pop    %edi
+  801b17:	5d                   	pop    %ebp
+  801b18:	c3                   	ret
+  801b19:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b1e:	50                   	push   %eax
+  801b1f:	ff 75 e4             	push   -0x1c(%ebp)
+  801b22:	68 fd e7 0e 00       	push   $0xee7fd
+  801b27:	57                   	push   %edi
+  801b28:	e8 7c fd ff ff       	call   8018a9 <dupq_map>
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	e9 63 ff ff ff       	jmp    801a98 <sfork+0x11a>
+  801b35:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b38:	e9 b9 fe ff ff       	jmp    8019f6 <sfork+0x78>
+  801b3d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b40:	e9 b1 fe ff ff       	jmp    8019f6 <sfork+0x78>
+  801b45:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801b48:	e8 bf fd ff ff       	call   80190c <dupq_end>
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	0f 88 b9 00 00 00    	js     801c0e <sfork+0x290>
+  801b55:	83 ec 04             	sub    $0x4,%esp
+  801b58:	6a 07                	push   $0x7
+  801b5a:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b5f:	56                   	push   %esi
+  801b60:	e8 7d f3 ff ff       	call   800ee2 <sys_page_alloc>
+  801b65:	83 c4 10             	add    $0x10,%esp
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	0f 88 aa 00 00 00    	js     801c1a <sfork+0x29c>
+  801b70:	83 ec 0c             	sub    $0xc,%esp
+  801b73:	6a 07                	push   $0x7
+  801b75:	68 00 f0 7f 00       	push   $0x7ff000
+  801b7a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801b7d:	57                   	push   %edi
+  801b7e:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b83:	56                   	push   %esi
+  801b84:	e8 9c f3 ff ff       	call   800f25 <sys_page_map>
+  801b89:	83 c4 20             	add    $0x20,%esp
+  801b8c:	85 c0                	test   %eax,%eax
+  801b8e:	0f 88 92 00 00 00    	js     801c26 <sfork+0x2a8>
+  801b94:	83 ec 04             	sub    $0x4,%esp
+  801b97:	68 00 10 00 00       	push   $0x1000
+  801b9c:	68 00 f0 7f 00       	push   $0x7ff000
+  801ba1:	68 00 f0 7f ee       	push   $0xee7ff000
+  801ba6:	e8 87 f0 ff ff       	call   800c32 <memmove>
+  801bab:	83 c4 08             	add    $0x8,%esp
+  801bae:	68 00 f0 7f 00       	push   $0x7ff000
+  801bb3:	57                   	push   %edi
+  801bb4:	e8 fb f3 ff ff       	call   800fb4 <sys_page_unmap>
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 72                	js     801c32 <sfork+0x2b4>
+  801bc0:	83 ec 08             	sub    $0x8,%esp
+  801bc3:	68 58 34 80 00       	push   $0x803458
+  801bc8:	56                   	push   %esi
+  801bc9:	e8 2d f5 ff ff       	call   8010fb <sys_env_set_pgfault_upcall>
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	85 c0                	test   %eax,%eax
+  801bd3:	78 69                	js     801c3e <sfork+0x2c0>
+  801bd5:	83 ec 08             	sub    $0x8,%esp
+  801bd8:	6a 02                	push   $0x2
+  801bda:	56                   	push   %esi
+  801bdb:	e8 35 f4 ff ff       	call   801015 <sys_env_set_status>
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bea:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801bee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bf1:	e9 18 ff ff ff       	jmp    801b0e <sfork+0x190>
+  801bf6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801bfd:	e9 0c ff ff ff       	jmp    801b0e <sfork+0x190>
+  801c02:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c09:	e9 00 ff ff ff       	jmp    801b0e <sfork+0x190>
+  801c0e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c15:	e9 f4 fe ff ff       	jmp    801b0e <sfork+0x190>
+  801c1a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c21:	e9 e8 fe ff ff       	jmp    801b0e <sfork+0x190>
+  801c26:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c2d:	e9 dc fe ff ff       	jmp    801b0e <sfork+0x190>
+  801c32:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c39:	e9 d0 fe ff ff       	jmp    801b0e <sfork+0x190>
+  801c3e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c45:	e9 c4 fe ff ff       	jmp    801b0e <sfork+0x190>
+  801c4a:	68 05 08 00 00       	push   $0x805
+  801c4f:	ff 75 e4             	push   -0x1c(%ebp)
+  801c52:	68 fd e7 0e 00       	push   $0xee7fd
+  801c57:	57                   	push   %edi
+  801c58:	e8 4c fc ff ff       	call   8018a9 <dupq_map>
+  801c5d:	83 c4 10             	add    $0x10,%esp
+  801c60:	85 c0                	test   %eax,%eax
+  801c62:	0f 88 30 fe ff ff    	js     801a98 <sfork+0x11a>
+  801c68:	68 05 08 00 00       	push   $0x805
+  801c6d:	57                   	push   %edi
+  801c6e:	68 fd e7 0e 00       	push   $0xee7fd
+  801c73:	57                   	push   %edi
+  801c74:	e8 30 fc ff ff       	call   8018a9 <dupq_map>
+  801c79:	83 c4 10             	add    $0x10,%esp
+  801c7c:	e9 17 fe ff ff       	jmp    801a98 <sfork+0x11a>
+
+00801c81 <fd2num>:
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c87:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c8c:	c1 e8 0c             	shr    $0xc,%eax
+  801c8f:	5d                   	pop    %ebp
+  801c90:	c3                   	ret
+
+00801c91 <fd2data>:
+  801c91:	55                   	push   %ebp
+  801c92:	89 e5                	mov    %esp,%ebp
+  801c94:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c97:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c9c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ca1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+
+00801ca8 <fd_alloc>:
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801cb0:	89 c2                	mov    %eax,%edx
+  801cb2:	c1 ea 16             	shr    $0x16,%edx
+  801cb5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cbc:	f6 c2 01             	test   $0x1,%dl
+  801cbf:	74 29                	je     801cea <fd_alloc+0x42>
+  801cc1:	89 c2                	mov    %eax,%edx
+  801cc3:	c1 ea 0c             	shr    $0xc,%edx
+  801cc6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ccd:	f6 c2 01             	test   $0x1,%dl
+  801cd0:	74 18                	je     801cea <fd_alloc+0x42>
+  801cd2:	05 00 10 00 00       	add    $0x1000,%eax
+  801cd7:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801cdc:	75 d2                	jne    801cb0 <fd_alloc+0x8>
+  801cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801ce8:	eb 05                	jmp    801cef <fd_alloc+0x47>
+  801cea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cef:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cf2:	89 02                	mov    %eax,(%edx)
+  801cf4:	89 c8                	mov    %ecx,%eax
+  801cf6:	5d                   	pop    %ebp
+  801cf7:	c3                   	ret
+
+00801cf8 <fd_lookup>:
+  801cf8:	55                   	push   %ebp
+  801cf9:	89 e5                	mov    %esp,%ebp
+  801cfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cfe:	83 f8 1f             	cmp    $0x1f,%eax
+  801d01:	77 30                	ja     801d33 <fd_lookup+0x3b>
+  801d03:	c1 e0 0c             	shl    $0xc,%eax
+  801d06:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801d0b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801d11:	f6 c2 01             	test   $0x1,%dl
+  801d14:	74 24                	je     801d3a <fd_lookup+0x42>
+  801d16:	89 c2                	mov    %eax,%edx
+  801d18:	c1 ea 0c             	shr    $0xc,%edx
+  801d1b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d22:	f6 c2 01             	test   $0x1,%dl
+  801d25:	74 1a                	je     801d41 <fd_lookup+0x49>
+  801d27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d2a:	89 02                	mov    %eax,(%edx)
+  801d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+  801d33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d38:	eb f7                	jmp    801d31 <fd_lookup+0x39>
+  801d3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d3f:	eb f0                	jmp    801d31 <fd_lookup+0x39>
+  801d41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d46:	eb e9                	jmp    801d31 <fd_lookup+0x39>
+
+00801d48 <dev_lookup>:
+  801d48:	55                   	push   %ebp
+  801d49:	89 e5                	mov    %esp,%ebp
+  801d4b:	53                   	push   %ebx
+  801d4c:	83 ec 04             	sub    $0x4,%esp
+  801d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d57:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801d5c:	39 13                	cmp    %edx,(%ebx)
+  801d5e:	74 37                	je     801d97 <dev_lookup+0x4f>
+  801d60:	83 c0 01             	add    $0x1,%eax
+  801d63:	8b 1c 85 bc 3e 80 00 	mov    0x803ebc(,%eax,4),%ebx
+  801d6a:	85 db                	test   %ebx,%ebx
+  801d6c:	75 ee                	jne    801d5c <dev_lookup+0x14>
+  801d6e:	a1 14 60 80 00       	mov    0x806014,%eax
+  801d73:	8b 40 48             	mov    0x48(%eax),%eax
+  801d76:	83 ec 04             	sub    $0x4,%esp
+  801d79:	52                   	push   %edx
+  801d7a:	50                   	push   %eax
+  801d7b:	68 40 3e 80 00       	push   $0x803e40
+  801d80:	e8 06 e6 ff ff       	call   80038b <cprintf>
+  801d85:	83 c4 10             	add    $0x10,%esp
+  801d88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d90:	89 1a                	mov    %ebx,(%edx)
+  801d92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d95:	c9                   	leave
+  801d96:	c3                   	ret
+  801d97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9c:	eb ef                	jmp    801d8d <dev_lookup+0x45>
+
+00801d9e <fd_close>:
+  801d9e:	55                   	push   %ebp
+  801d9f:	89 e5                	mov    %esp,%ebp
+  801da1:	57                   	push   %edi
+  801da2:	56                   	push   %esi
+  801da3:	53                   	push   %ebx
+  801da4:	83 ec 24             	sub    $0x24,%esp
+  801da7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801daa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801dad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801db0:	50                   	push   %eax
+  801db1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801db7:	c1 e8 0c             	shr    $0xc,%eax
+  801dba:	50                   	push   %eax
+  801dbb:	e8 38 ff ff ff       	call   801cf8 <fd_lookup>
+  801dc0:	89 c3                	mov    %eax,%ebx
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 05                	js     801dce <fd_close+0x30>
+  801dc9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801dcc:	74 0f                	je     801ddd <fd_close+0x3f>
+  801dce:	85 ff                	test   %edi,%edi
+  801dd0:	0f 44 df             	cmove  %edi,%ebx
+  801dd3:	89 d8                	mov    %ebx,%eax
+  801dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd8:	5b                   	pop    %ebx
+  801dd9:	5e                   	pop    %esi
+  801dda:	5f                   	pop    %edi
+  801ddb:	5d                   	pop    %ebp
+  801ddc:	c3                   	ret
+  801ddd:	83 ec 08             	sub    $0x8,%esp
+  801de0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801de3:	50                   	push   %eax
+  801de4:	ff 36                	push   (%esi)
+  801de6:	e8 5d ff ff ff       	call   801d48 <dev_lookup>
+  801deb:	89 c3                	mov    %eax,%ebx
+  801ded:	83 c4 10             	add    $0x10,%esp
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	78 1a                	js     801e0e <fd_close+0x70>
+  801df4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801df7:	8b 40 10             	mov    0x10(%eax),%eax
+  801dfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	74 0b                	je     801e0e <fd_close+0x70>
+  801e03:	83 ec 0c             	sub    $0xc,%esp
+  801e06:	56                   	push   %esi
+  801e07:	ff d0                	call   *%eax
+  801e09:	89 c3                	mov    %eax,%ebx
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	83 ec 08             	sub    $0x8,%esp
+  801e11:	56                   	push   %esi
+  801e12:	6a 00                	push   $0x0
+  801e14:	e8 9b f1 ff ff       	call   800fb4 <sys_page_unmap>
+  801e19:	83 c4 10             	add    $0x10,%esp
+  801e1c:	eb b5                	jmp    801dd3 <fd_close+0x35>
+
+00801e1e <close>:
+  801e1e:	55                   	push   %ebp
+  801e1f:	89 e5                	mov    %esp,%ebp
+  801e21:	83 ec 20             	sub    $0x20,%esp
+  801e24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e27:	50                   	push   %eax
+  801e28:	ff 75 08             	push   0x8(%ebp)
+  801e2b:	e8 c8 fe ff ff       	call   801cf8 <fd_lookup>
+  801e30:	83 c4 10             	add    $0x10,%esp
+  801e33:	85 c0                	test   %eax,%eax
+  801e35:	79 02                	jns    801e39 <close+0x1b>
+  801e37:	c9                   	leave
+  801e38:	c3                   	ret
+  801e39:	83 ec 08             	sub    $0x8,%esp
+  801e3c:	6a 01                	push   $0x1
+  801e3e:	ff 75 f4             	push   -0xc(%ebp)
+  801e41:	e8 58 ff ff ff       	call   801d9e <fd_close>
+  801e46:	83 c4 10             	add    $0x10,%esp
+  801e49:	eb ec                	jmp    801e37 <close+0x19>
+
+00801e4b <close_all>:
+  801e4b:	55                   	push   %ebp
+  801e4c:	89 e5                	mov    %esp,%ebp
+  801e4e:	53                   	push   %ebx
+  801e4f:	83 ec 04             	sub    $0x4,%esp
+  801e52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e57:	83 ec 0c             	sub    $0xc,%esp
+  801e5a:	53                   	push   %ebx
+  801e5b:	e8 be ff ff ff       	call   801e1e <close>
+  801e60:	83 c3 01             	add    $0x1,%ebx
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	83 fb 20             	cmp    $0x20,%ebx
+  801e69:	75 ec                	jne    801e57 <close_all+0xc>
+  801e6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e6e:	c9                   	leave
+  801e6f:	c3                   	ret
+
+00801e70 <dup>:
+  801e70:	55                   	push   %ebp
+  801e71:	89 e5                	mov    %esp,%ebp
+  801e73:	57                   	push   %edi
+  801e74:	56                   	push   %esi
+  801e75:	53                   	push   %ebx
+  801e76:	83 ec 34             	sub    $0x34,%esp
+  801e79:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e7c:	50                   	push   %eax
+  801e7d:	ff 75 08             	push   0x8(%ebp)
+  801e80:	e8 73 fe ff ff       	call   801cf8 <fd_lookup>
+  801e85:	89 c3                	mov    %eax,%ebx
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	85 c0                	test   %eax,%eax
+  801e8c:	78 7f                	js     801f0d <dup+0x9d>
+  801e8e:	83 ec 0c             	sub    $0xc,%esp
+  801e91:	ff 75 0c             	push   0xc(%ebp)
+  801e94:	e8 85 ff ff ff       	call   801e1e <close>
+  801e99:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e9c:	c1 e6 0c             	shl    $0xc,%esi
+  801e9f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801ea5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ea8:	89 3c 24             	mov    %edi,(%esp)
+  801eab:	e8 e1 fd ff ff       	call   801c91 <fd2data>
+  801eb0:	89 c3                	mov    %eax,%ebx
+  801eb2:	89 34 24             	mov    %esi,(%esp)
+  801eb5:	e8 d7 fd ff ff       	call   801c91 <fd2data>
+  801eba:	83 c4 10             	add    $0x10,%esp
+  801ebd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ec0:	89 d8                	mov    %ebx,%eax
+  801ec2:	c1 e8 16             	shr    $0x16,%eax
+  801ec5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ecc:	a8 01                	test   $0x1,%al
+  801ece:	74 11                	je     801ee1 <dup+0x71>
+  801ed0:	89 d8                	mov    %ebx,%eax
+  801ed2:	c1 e8 0c             	shr    $0xc,%eax
+  801ed5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801edc:	f6 c2 01             	test   $0x1,%dl
+  801edf:	75 36                	jne    801f17 <dup+0xa7>
+  801ee1:	89 f8                	mov    %edi,%eax
+  801ee3:	c1 e8 0c             	shr    $0xc,%eax
+  801ee6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801eed:	83 ec 0c             	sub    $0xc,%esp
+  801ef0:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ef5:	50                   	push   %eax
+  801ef6:	56                   	push   %esi
+  801ef7:	6a 00                	push   $0x0
+  801ef9:	57                   	push   %edi
+  801efa:	6a 00                	push   $0x0
+  801efc:	e8 24 f0 ff ff       	call   800f25 <sys_page_map>
+  801f01:	89 c3                	mov    %eax,%ebx
+  801f03:	83 c4 20             	add    $0x20,%esp
+  801f06:	85 c0                	test   %eax,%eax
+  801f08:	78 33                	js     801f3d <dup+0xcd>
+  801f0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f0d:	89 d8                	mov    %ebx,%eax
+  801f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f12:	5b                   	pop    %ebx
+  801f13:	5e                   	pop    %esi
+  801f14:	5f                   	pop    %edi
+  801f15:	5d                   	pop    %ebp
+  801f16:	c3                   	ret
+  801f17:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f1e:	83 ec 0c             	sub    $0xc,%esp
+  801f21:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f26:	50                   	push   %eax
+  801f27:	ff 75 d4             	push   -0x2c(%ebp)
+  801f2a:	6a 00                	push   $0x0
+  801f2c:	53                   	push   %ebx
+  801f2d:	6a 00                	push   $0x0
+  801f2f:	e8 f1 ef ff ff       	call   800f25 <sys_page_map>
+  801f34:	89 c3                	mov    %eax,%ebx
+  801f36:	83 c4 20             	add    $0x20,%esp
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	79 a4                	jns    801ee1 <dup+0x71>
+  801f3d:	83 ec 08             	sub    $0x8,%esp
+  801f40:	56                   	push   %esi
+  801f41:	6a 00                	push   $0x0
+  801f43:	e8 6c f0 ff ff       	call   800fb4 <sys_page_unmap>
+  801f48:	83 c4 08             	add    $0x8,%esp
+  801f4b:	ff 75 d4             	push   -0x2c(%ebp)
+  801f4e:	6a 00                	push   $0x0
+  801f50:	e8 5f f0 ff ff       	call   800fb4 <sys_page_unmap>
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	eb b3                	jmp    801f0d <dup+0x9d>
+
+00801f5a <read>:
+  801f5a:	55                   	push   %ebp
+  801f5b:	89 e5                	mov    %esp,%ebp
+  801f5d:	56                   	push   %esi
+  801f5e:	53                   	push   %ebx
+  801f5f:	83 ec 18             	sub    $0x18,%esp
+  801f62:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f65:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f68:	50                   	push   %eax
+  801f69:	56                   	push   %esi
+  801f6a:	e8 89 fd ff ff       	call   801cf8 <fd_lookup>
+  801f6f:	83 c4 10             	add    $0x10,%esp
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	78 3c                	js     801fb2 <read+0x58>
+  801f76:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801f79:	83 ec 08             	sub    $0x8,%esp
+  801f7c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f7f:	50                   	push   %eax
+  801f80:	ff 33                	push   (%ebx)
+  801f82:	e8 c1 fd ff ff       	call   801d48 <dev_lookup>
+  801f87:	83 c4 10             	add    $0x10,%esp
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 24                	js     801fb2 <read+0x58>
+  801f8e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801f91:	83 e0 03             	and    $0x3,%eax
+  801f94:	83 f8 01             	cmp    $0x1,%eax
+  801f97:	74 20                	je     801fb9 <read+0x5f>
+  801f99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f9c:	8b 40 08             	mov    0x8(%eax),%eax
+  801f9f:	85 c0                	test   %eax,%eax
+  801fa1:	74 37                	je     801fda <read+0x80>
+  801fa3:	83 ec 04             	sub    $0x4,%esp
+  801fa6:	ff 75 10             	push   0x10(%ebp)
+  801fa9:	ff 75 0c             	push   0xc(%ebp)
+  801fac:	53                   	push   %ebx
+  801fad:	ff d0                	call   *%eax
+  801faf:	83 c4 10             	add    $0x10,%esp
+  801fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb5:	5b                   	pop    %ebx
+  801fb6:	5e                   	pop    %esi
+  801fb7:	5d                   	pop    %ebp
+  801fb8:	c3                   	ret
+  801fb9:	a1 14 60 80 00       	mov    0x806014,%eax
+  801fbe:	8b 40 48             	mov    0x48(%eax),%eax
+  801fc1:	83 ec 04             	sub    $0x4,%esp
+  801fc4:	56                   	push   %esi
+  801fc5:	50                   	push   %eax
+  801fc6:	68 81 3e 80 00       	push   $0x803e81
+  801fcb:	e8 bb e3 ff ff       	call   80038b <cprintf>
+  801fd0:	83 c4 10             	add    $0x10,%esp
+  801fd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd8:	eb d8                	jmp    801fb2 <read+0x58>
+  801fda:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fdf:	eb d1                	jmp    801fb2 <read+0x58>
+
+00801fe1 <readn>:
+  801fe1:	55                   	push   %ebp
+  801fe2:	89 e5                	mov    %esp,%ebp
+  801fe4:	57                   	push   %edi
+  801fe5:	56                   	push   %esi
+  801fe6:	53                   	push   %ebx
+  801fe7:	83 ec 0c             	sub    $0xc,%esp
+  801fea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fed:	8b 75 10             	mov    0x10(%ebp),%esi
+  801ff0:	85 f6                	test   %esi,%esi
+  801ff2:	74 30                	je     802024 <readn+0x43>
+  801ff4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffe:	83 ec 04             	sub    $0x4,%esp
+  802001:	89 f2                	mov    %esi,%edx
+  802003:	29 c2                	sub    %eax,%edx
+  802005:	52                   	push   %edx
+  802006:	01 f8                	add    %edi,%eax
+  802008:	50                   	push   %eax
+  802009:	ff 75 08             	push   0x8(%ebp)
+  80200c:	e8 49 ff ff ff       	call   801f5a <read>
+  802011:	83 c4 10             	add    $0x10,%esp
+  802014:	85 c0                	test   %eax,%eax
+  802016:	78 15                	js     80202d <readn+0x4c>
+  802018:	74 11                	je     80202b <readn+0x4a>
+  80201a:	01 c3                	add    %eax,%ebx
+  80201c:	89 d8                	mov    %ebx,%eax
+  80201e:	39 f3                	cmp    %esi,%ebx
+  802020:	72 dc                	jb     801ffe <readn+0x1d>
+  802022:	eb 09                	jmp    80202d <readn+0x4c>
+  802024:	b8 00 00 00 00       	mov    $0x0,%eax
+  802029:	eb 02                	jmp    80202d <readn+0x4c>
+  80202b:	89 d8                	mov    %ebx,%eax
+  80202d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802030:	5b                   	pop    %ebx
+  802031:	5e                   	pop    %esi
+  802032:	5f                   	pop    %edi
+  802033:	5d                   	pop    %ebp
+  802034:	c3                   	ret
+
+00802035 <write>:
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	56                   	push   %esi
+  802039:	53                   	push   %ebx
+  80203a:	83 ec 18             	sub    $0x18,%esp
+  80203d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802040:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802043:	50                   	push   %eax
+  802044:	53                   	push   %ebx
+  802045:	e8 ae fc ff ff       	call   801cf8 <fd_lookup>
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 37                	js     802088 <write+0x53>
+  802051:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802054:	83 ec 08             	sub    $0x8,%esp
+  802057:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205a:	50                   	push   %eax
+  80205b:	ff 36                	push   (%esi)
+  80205d:	e8 e6 fc ff ff       	call   801d48 <dev_lookup>
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 1f                	js     802088 <write+0x53>
+  802069:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80206d:	74 20                	je     80208f <write+0x5a>
+  80206f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802072:	8b 40 0c             	mov    0xc(%eax),%eax
+  802075:	85 c0                	test   %eax,%eax
+  802077:	74 37                	je     8020b0 <write+0x7b>
+  802079:	83 ec 04             	sub    $0x4,%esp
+  80207c:	ff 75 10             	push   0x10(%ebp)
+  80207f:	ff 75 0c             	push   0xc(%ebp)
+  802082:	56                   	push   %esi
+  802083:	ff d0                	call   *%eax
+  802085:	83 c4 10             	add    $0x10,%esp
+  802088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80208b:	5b                   	pop    %ebx
+  80208c:	5e                   	pop    %esi
+  80208d:	5d                   	pop    %ebp
+  80208e:	c3                   	ret
+  80208f:	a1 14 60 80 00       	mov    0x806014,%eax
+  802094:	8b 40 48             	mov    0x48(%eax),%eax
+  802097:	83 ec 04             	sub    $0x4,%esp
+  80209a:	53                   	push   %ebx
+  80209b:	50                   	push   %eax
+  80209c:	68 9d 3e 80 00       	push   $0x803e9d
+  8020a1:	e8 e5 e2 ff ff       	call   80038b <cprintf>
+  8020a6:	83 c4 10             	add    $0x10,%esp
+  8020a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ae:	eb d8                	jmp    802088 <write+0x53>
+  8020b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020b5:	eb d1                	jmp    802088 <write+0x53>
+
+008020b7 <seek>:
+  8020b7:	55                   	push   %ebp
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	83 ec 20             	sub    $0x20,%esp
+  8020bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c0:	50                   	push   %eax
+  8020c1:	ff 75 08             	push   0x8(%ebp)
+  8020c4:	e8 2f fc ff ff       	call   801cf8 <fd_lookup>
+  8020c9:	83 c4 10             	add    $0x10,%esp
+  8020cc:	85 c0                	test   %eax,%eax
+  8020ce:	78 0e                	js     8020de <seek+0x27>
+  8020d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020d6:	89 50 04             	mov    %edx,0x4(%eax)
+  8020d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020de:	c9                   	leave
+  8020df:	c3                   	ret
+
+008020e0 <ftruncate>:
+  8020e0:	55                   	push   %ebp
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	56                   	push   %esi
+  8020e4:	53                   	push   %ebx
+  8020e5:	83 ec 18             	sub    $0x18,%esp
+  8020e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020ee:	50                   	push   %eax
+  8020ef:	53                   	push   %ebx
+  8020f0:	e8 03 fc ff ff       	call   801cf8 <fd_lookup>
+  8020f5:	83 c4 10             	add    $0x10,%esp
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	78 34                	js     802130 <ftruncate+0x50>
+  8020fc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020ff:	83 ec 08             	sub    $0x8,%esp
+  802102:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802105:	50                   	push   %eax
+  802106:	ff 36                	push   (%esi)
+  802108:	e8 3b fc ff ff       	call   801d48 <dev_lookup>
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	85 c0                	test   %eax,%eax
+  802112:	78 1c                	js     802130 <ftruncate+0x50>
+  802114:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802118:	74 1d                	je     802137 <ftruncate+0x57>
+  80211a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80211d:	8b 40 18             	mov    0x18(%eax),%eax
+  802120:	85 c0                	test   %eax,%eax
+  802122:	74 34                	je     802158 <ftruncate+0x78>
+  802124:	83 ec 08             	sub    $0x8,%esp
+  802127:	ff 75 0c             	push   0xc(%ebp)
+  80212a:	56                   	push   %esi
+  80212b:	ff d0                	call   *%eax
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802133:	5b                   	pop    %ebx
+  802134:	5e                   	pop    %esi
+  802135:	5d                   	pop    %ebp
+  802136:	c3                   	ret
+  802137:	a1 14 60 80 00       	mov    0x806014,%eax
+  80213c:	8b 40 48             	mov    0x48(%eax),%eax
+  80213f:	83 ec 04             	sub    $0x4,%esp
+  802142:	53                   	push   %ebx
+  802143:	50                   	push   %eax
+  802144:	68 60 3e 80 00       	push   $0x803e60
+  802149:	e8 3d e2 ff ff       	call   80038b <cprintf>
+  80214e:	83 c4 10             	add    $0x10,%esp
+  802151:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802156:	eb d8                	jmp    802130 <ftruncate+0x50>
+  802158:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80215d:	eb d1                	jmp    802130 <ftruncate+0x50>
+
+0080215f <fstat>:
+  80215f:	55                   	push   %ebp
+  802160:	89 e5                	mov    %esp,%ebp
+  802162:	56                   	push   %esi
+  802163:	53                   	push   %ebx
+  802164:	83 ec 18             	sub    $0x18,%esp
+  802167:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80216a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80216d:	50                   	push   %eax
+  80216e:	ff 75 08             	push   0x8(%ebp)
+  802171:	e8 82 fb ff ff       	call   801cf8 <fd_lookup>
+  802176:	83 c4 10             	add    $0x10,%esp
+  802179:	85 c0                	test   %eax,%eax
+  80217b:	78 49                	js     8021c6 <fstat+0x67>
+  80217d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802180:	83 ec 08             	sub    $0x8,%esp
+  802183:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802186:	50                   	push   %eax
+  802187:	ff 36                	push   (%esi)
+  802189:	e8 ba fb ff ff       	call   801d48 <dev_lookup>
+  80218e:	83 c4 10             	add    $0x10,%esp
+  802191:	85 c0                	test   %eax,%eax
+  802193:	78 31                	js     8021c6 <fstat+0x67>
+  802195:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802198:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80219c:	74 2f                	je     8021cd <fstat+0x6e>
+  80219e:	c6 03 00             	movb   $0x0,(%ebx)
+  8021a1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021a8:	00 00 00 
+  8021ab:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021b2:	00 00 00 
+  8021b5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	53                   	push   %ebx
+  8021bf:	56                   	push   %esi
+  8021c0:	ff 50 14             	call   *0x14(%eax)
+  8021c3:	83 c4 10             	add    $0x10,%esp
+  8021c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c9:	5b                   	pop    %ebx
+  8021ca:	5e                   	pop    %esi
+  8021cb:	5d                   	pop    %ebp
+  8021cc:	c3                   	ret
+  8021cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021d2:	eb f2                	jmp    8021c6 <fstat+0x67>
+
+008021d4 <stat>:
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	56                   	push   %esi
+  8021d8:	53                   	push   %ebx
+  8021d9:	83 ec 08             	sub    $0x8,%esp
+  8021dc:	6a 00                	push   $0x0
+  8021de:	ff 75 08             	push   0x8(%ebp)
+  8021e1:	e8 31 05 00 00       	call   802717 <open>
+  8021e6:	89 c3                	mov    %eax,%ebx
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 1b                	js     80220a <stat+0x36>
+  8021ef:	83 ec 08             	sub    $0x8,%esp
+  8021f2:	ff 75 0c             	push   0xc(%ebp)
+  8021f5:	50                   	push   %eax
+  8021f6:	e8 64 ff ff ff       	call   80215f <fstat>
+  8021fb:	89 c6                	mov    %eax,%esi
+  8021fd:	89 1c 24             	mov    %ebx,(%esp)
+  802200:	e8 19 fc ff ff       	call   801e1e <close>
+  802205:	83 c4 10             	add    $0x10,%esp
+  802208:	89 f3                	mov    %esi,%ebx
+  80220a:	89 d8                	mov    %ebx,%eax
+  80220c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80220f:	5b                   	pop    %ebx
+  802210:	5e                   	pop    %esi
+  802211:	5d                   	pop    %ebp
+  802212:	c3                   	ret
+
+00802213 <fsipc>:
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	56                   	push   %esi
+  802217:	53                   	push   %ebx
+  802218:	89 c3                	mov    %eax,%ebx
+  80221a:	89 d6                	mov    %edx,%esi
+  80221c:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802223:	74 20                	je     802245 <fsipc+0x32>
+  802225:	83 ec 08             	sub    $0x8,%esp
+  802228:	6a 00                	push   $0x0
+  80222a:	56                   	push   %esi
+  80222b:	6a 07                	push   $0x7
+  80222d:	68 00 70 80 00       	push   $0x807000
+  802232:	53                   	push   %ebx
+  802233:	ff 35 0c 60 80 00    	push   0x80600c
+  802239:	e8 fd 12 00 00       	call   80353b <ipc_call>
+  80223e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802241:	5b                   	pop    %ebx
+  802242:	5e                   	pop    %esi
+  802243:	5d                   	pop    %ebp
+  802244:	c3                   	ret
+  802245:	83 ec 0c             	sub    $0xc,%esp
+  802248:	6a 02                	push   $0x2
+  80224a:	e8 87 14 00 00       	call   8036d6 <ipc_find_env>
+  80224f:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802254:	83 c4 10             	add    $0x10,%esp
+  802257:	eb cc                	jmp    802225 <fsipc+0x12>
+
+00802259 <devfile_trunc>:
+  802259:	55                   	push   %ebp
+  80225a:	89 e5                	mov    %esp,%ebp
+  80225c:	83 ec 08             	sub    $0x8,%esp
+  80225f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802262:	8b 40 0c             	mov    0xc(%eax),%eax
+  802265:	a3 00 70 80 00       	mov    %eax,0x807000
+  80226a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80226d:	a3 04 70 80 00       	mov    %eax,0x807004
+  802272:	ba 00 00 00 00       	mov    $0x0,%edx
+  802277:	b8 02 00 00 00       	mov    $0x2,%eax
+  80227c:	e8 92 ff ff ff       	call   802213 <fsipc>
+  802281:	c9                   	leave
+  802282:	c3                   	ret
+
+00802283 <devfile_flush>:
+  802283:	55                   	push   %ebp
+  802284:	89 e5                	mov    %esp,%ebp
+  802286:	83 ec 08             	sub    $0x8,%esp
+  802289:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80228f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802294:	ba 00 00 00 00       	mov    $0x0,%edx
+  802299:	b8 08 00 00 00       	mov    $0x8,%eax
+  80229e:	e8 70 ff ff ff       	call   802213 <fsipc>
+  8022a3:	c9                   	leave
+  8022a4:	c3                   	ret
+
+008022a5 <devfile_stat>:
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	53                   	push   %ebx
+  8022a9:	83 ec 04             	sub    $0x4,%esp
+  8022ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022b5:	a3 00 70 80 00       	mov    %eax,0x807000
+  8022ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022bf:	b8 07 00 00 00       	mov    $0x7,%eax
+  8022c4:	e8 4a ff ff ff       	call   802213 <fsipc>
+  8022c9:	85 c0                	test   %eax,%eax
+  8022cb:	78 2c                	js     8022f9 <devfile_stat+0x54>
+  8022cd:	83 ec 08             	sub    $0x8,%esp
+  8022d0:	68 00 70 80 00       	push   $0x807000
+  8022d5:	53                   	push   %ebx
+  8022d6:	e8 a7 e7 ff ff       	call   800a82 <strcpy>
+  8022db:	a1 80 70 80 00       	mov    0x807080,%eax
+  8022e0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8022e6:	a1 84 70 80 00       	mov    0x807084,%eax
+  8022eb:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8022f1:	83 c4 10             	add    $0x10,%esp
+  8022f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fc:	c9                   	leave
+  8022fd:	c3                   	ret
+
+008022fe <fsring_rw>:
+  8022fe:	55                   	push   %ebp
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	57                   	push   %edi
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	83 ec 2c             	sub    $0x2c,%esp
+  802307:	89 c7                	mov    %eax,%edi
+  802309:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80230c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80230f:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802314:	a8 01                	test   $0x1,%al
+  802316:	74 0d                	je     802325 <fsring_rw+0x27>
+  802318:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  80231d:	a8 01                	test   $0x1,%al
+  80231f:	0f 85 d5 00 00 00    	jne    8023fa <fsring_rw+0xfc>
+  802325:	a1 14 60 80 00       	mov    0x806014,%eax
+  80232a:	8b 40 48             	mov    0x48(%eax),%eax
+  80232d:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  802333:	0f 84 fc 00 00 00    	je     802435 <fsring_rw+0x137>
+  802339:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802340:	0f 84 02 01 00 00    	je     802448 <fsring_rw+0x14a>
+  802346:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80234b:	83 ec 04             	sub    $0x4,%esp
+  80234e:	68 07 02 00 00       	push   $0x207
+  802353:	53                   	push   %ebx
+  802354:	6a 00                	push   $0x0
+  802356:	e8 87 eb ff ff       	call   800ee2 <sys_page_alloc>
+  80235b:	83 c4 10             	add    $0x10,%esp
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	0f 88 f9 00 00 00    	js     80245f <fsring_rw+0x161>
+  802366:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80236c:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802372:	75 d7                	jne    80234b <fsring_rw+0x4d>
+  802374:	6a 0e                	push   $0xe
+  802376:	6a 0d                	push   $0xd
+  802378:	ff 35 0c 60 80 00    	push   0x80600c
+  80237e:	68 00 00 f0 cf       	push   $0xcff00000
+  802383:	e8 c4 0c 00 00       	call   80304c <ipcring_init>
+  802388:	83 c4 08             	add    $0x8,%esp
+  80238b:	6a 00                	push   $0x0
+  80238d:	6a 00                	push   $0x0
+  80238f:	68 07 02 00 00       	push   $0x207
+  802394:	68 00 00 f0 cf       	push   $0xcff00000
+  802399:	6a 0b                	push   $0xb
+  80239b:	ff 35 0c 60 80 00    	push   0x80600c
+  8023a1:	e8 95 11 00 00       	call   80353b <ipc_call>
+  8023a6:	89 c6                	mov    %eax,%esi
+  8023a8:	83 c4 20             	add    $0x20,%esp
+  8023ab:	85 c0                	test   %eax,%eax
+  8023ad:	0f 88 ac 00 00 00    	js     80245f <fsring_rw+0x161>
+  8023b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023b8:	89 d9                	mov    %ebx,%ecx
+  8023ba:	83 c3 01             	add    $0x1,%ebx
+  8023bd:	89 da                	mov    %ebx,%edx
+  8023bf:	c1 e2 0c             	shl    $0xc,%edx
+  8023c2:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8023c8:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8023ce:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8023d4:	83 ec 08             	sub    $0x8,%esp
+  8023d7:	6a 00                	push   $0x0
+  8023d9:	6a 00                	push   $0x0
+  8023db:	68 07 02 00 00       	push   $0x207
+  8023e0:	50                   	push   %eax
+  8023e1:	6a 0c                	push   $0xc
+  8023e3:	ff 35 0c 60 80 00    	push   0x80600c
+  8023e9:	e8 4d 11 00 00       	call   80353b <ipc_call>
+  8023ee:	83 c4 20             	add    $0x20,%esp
+  8023f1:	85 c0                	test   %eax,%eax
+  8023f3:	78 6a                	js     80245f <fsring_rw+0x161>
+  8023f5:	83 fb 08             	cmp    $0x8,%ebx
+  8023f8:	75 be                	jne    8023b8 <fsring_rw+0xba>
+  8023fa:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8023fe:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802403:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802408:	0f 45 c2             	cmovne %edx,%eax
+  80240b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80240e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802415:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  80241c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802423:	ba 00 00 00 00       	mov    $0x0,%edx
+  802428:	be 00 00 00 00       	mov    $0x0,%esi
+  80242d:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802430:	e9 4b 01 00 00       	jmp    802580 <fsring_rw+0x282>
+  802435:	e8 72 ee ff ff       	call   8012ac <sys_time_msec>
+  80243a:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  802440:	0f 89 f3 fe ff ff    	jns    802339 <fsring_rw+0x3b>
+  802446:	eb 54                	jmp    80249c <fsring_rw+0x19e>
+  802448:	83 ec 0c             	sub    $0xc,%esp
+  80244b:	6a 02                	push   $0x2
+  80244d:	e8 84 12 00 00       	call   8036d6 <ipc_find_env>
+  802452:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802457:	83 c4 10             	add    $0x10,%esp
+  80245a:	e9 e7 fe ff ff       	jmp    802346 <fsring_rw+0x48>
+  80245f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802464:	83 ec 08             	sub    $0x8,%esp
+  802467:	53                   	push   %ebx
+  802468:	6a 00                	push   $0x0
+  80246a:	e8 45 eb ff ff       	call   800fb4 <sys_page_unmap>
+  80246f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802475:	83 c4 10             	add    $0x10,%esp
+  802478:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80247e:	75 e4                	jne    802464 <fsring_rw+0x166>
+  802480:	e8 27 ee ff ff       	call   8012ac <sys_time_msec>
+  802485:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80248a:	a3 04 60 80 00       	mov    %eax,0x806004
+  80248f:	a1 14 60 80 00       	mov    0x806014,%eax
+  802494:	8b 40 48             	mov    0x48(%eax),%eax
+  802497:	a3 08 60 80 00       	mov    %eax,0x806008
+  80249c:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8024a3:	e9 7a 01 00 00       	jmp    802622 <fsring_rw+0x324>
+  8024a8:	8b 57 0c             	mov    0xc(%edi),%edx
+  8024ab:	89 10                	mov    %edx,(%eax)
+  8024ad:	89 58 04             	mov    %ebx,0x4(%eax)
+  8024b0:	89 f2                	mov    %esi,%edx
+  8024b2:	03 57 04             	add    0x4(%edi),%edx
+  8024b5:	89 50 08             	mov    %edx,0x8(%eax)
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	53                   	push   %ebx
+  8024bc:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8024bf:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8024c2:	52                   	push   %edx
+  8024c3:	83 c0 0c             	add    $0xc,%eax
+  8024c6:	50                   	push   %eax
+  8024c7:	e8 66 e7 ff ff       	call   800c32 <memmove>
+  8024cc:	83 c4 10             	add    $0x10,%esp
+  8024cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024d2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024d5:	89 08                	mov    %ecx,(%eax)
+  8024d7:	83 ec 0c             	sub    $0xc,%esp
+  8024da:	68 00 00 f0 cf       	push   $0xcff00000
+  8024df:	e8 c6 0b 00 00       	call   8030aa <ipcring_req_push>
+  8024e4:	01 de                	add    %ebx,%esi
+  8024e6:	83 c4 10             	add    $0x10,%esp
+  8024e9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8024ec:	73 4c                	jae    80253a <fsring_rw+0x23c>
+  8024ee:	83 ec 0c             	sub    $0xc,%esp
+  8024f1:	68 00 00 f0 cf       	push   $0xcff00000
+  8024f6:	e8 89 0b 00 00       	call   803084 <ipcring_req_slot>
+  8024fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024fe:	83 c4 10             	add    $0x10,%esp
+  802501:	85 c0                	test   %eax,%eax
+  802503:	74 35                	je     80253a <fsring_rw+0x23c>
+  802505:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80250a:	83 e0 07             	and    $0x7,%eax
+  80250d:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802512:	c1 e0 0c             	shl    $0xc,%eax
+  802515:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802518:	29 f3                	sub    %esi,%ebx
+  80251a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80251d:	39 cb                	cmp    %ecx,%ebx
+  80251f:	0f 47 d9             	cmova  %ecx,%ebx
+  802522:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802526:	75 80                	jne    8024a8 <fsring_rw+0x1aa>
+  802528:	8b 57 0c             	mov    0xc(%edi),%edx
+  80252b:	89 10                	mov    %edx,(%eax)
+  80252d:	89 58 04             	mov    %ebx,0x4(%eax)
+  802530:	89 f2                	mov    %esi,%edx
+  802532:	03 57 04             	add    0x4(%edi),%edx
+  802535:	89 50 08             	mov    %edx,0x8(%eax)
+  802538:	eb 95                	jmp    8024cf <fsring_rw+0x1d1>
+  80253a:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80253f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802542:	83 ec 0c             	sub    $0xc,%esp
+  802545:	68 00 00 f0 cf       	push   $0xcff00000
+  80254a:	e8 94 0b 00 00       	call   8030e3 <ipcring_rsp_wait>
+  80254f:	8b 58 04             	mov    0x4(%eax),%ebx
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802559:	75 45                	jne    8025a0 <fsring_rw+0x2a2>
+  80255b:	85 db                	test   %ebx,%ebx
+  80255d:	79 41                	jns    8025a0 <fsring_rw+0x2a2>
+  80255f:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802562:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802569:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802570:	83 ec 0c             	sub    $0xc,%esp
+  802573:	68 00 00 f0 cf       	push   $0xcff00000
+  802578:	e8 cc 0b 00 00       	call   803149 <ipcring_rsp_pop>
+  80257d:	83 c4 10             	add    $0x10,%esp
+  802580:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802586:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80258b:	39 c2                	cmp    %eax,%edx
+  80258d:	74 75                	je     802604 <fsring_rw+0x306>
+  80258f:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802593:	75 a5                	jne    80253a <fsring_rw+0x23c>
+  802595:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802598:	0f 82 50 ff ff ff    	jb     8024ee <fsring_rw+0x1f0>
+  80259e:	eb 9a                	jmp    80253a <fsring_rw+0x23c>
+  8025a0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8025a4:	75 ca                	jne    802570 <fsring_rw+0x272>
+  8025a6:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8025aa:	74 31                	je     8025dd <fsring_rw+0x2df>
+  8025ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025af:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8025b2:	29 c8                	sub    %ecx,%eax
+  8025b4:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8025b7:	39 d0                	cmp    %edx,%eax
+  8025b9:	0f 47 c2             	cmova  %edx,%eax
+  8025bc:	39 d8                	cmp    %ebx,%eax
+  8025be:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025c3:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8025c7:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8025ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025cf:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8025d3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8025d6:	01 d9                	add    %ebx,%ecx
+  8025d8:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8025db:	eb 93                	jmp    802570 <fsring_rw+0x272>
+  8025dd:	83 ec 04             	sub    $0x4,%esp
+  8025e0:	53                   	push   %ebx
+  8025e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025e4:	83 e0 07             	and    $0x7,%eax
+  8025e7:	c1 e0 0c             	shl    $0xc,%eax
+  8025ea:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8025f0:	50                   	push   %eax
+  8025f1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025f4:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8025f7:	01 c8                	add    %ecx,%eax
+  8025f9:	50                   	push   %eax
+  8025fa:	e8 33 e6 ff ff       	call   800c32 <memmove>
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	eb a8                	jmp    8025ac <fsring_rw+0x2ae>
+  802604:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802608:	75 09                	jne    802613 <fsring_rw+0x315>
+  80260a:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80260d:	0f 82 db fe ff ff    	jb     8024ee <fsring_rw+0x1f0>
+  802613:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802616:	01 57 04             	add    %edx,0x4(%edi)
+  802619:	85 d2                	test   %edx,%edx
+  80261b:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80261f:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802622:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802628:	5b                   	pop    %ebx
+  802629:	5e                   	pop    %esi
+  80262a:	5f                   	pop    %edi
+  80262b:	5d                   	pop    %ebp
+  80262c:	c3                   	ret
+
+0080262d <devfile_write>:
+  80262d:	55                   	push   %ebp
+  80262e:	89 e5                	mov    %esp,%ebp
+  802630:	57                   	push   %edi
+  802631:	56                   	push   %esi
+  802632:	53                   	push   %ebx
+  802633:	83 ec 0c             	sub    $0xc,%esp
+  802636:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802639:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80263c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80263f:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802645:	76 1a                	jbe    802661 <devfile_write+0x34>
+  802647:	83 ec 0c             	sub    $0xc,%esp
+  80264a:	53                   	push   %ebx
+  80264b:	89 f1                	mov    %esi,%ecx
+  80264d:	ba 06 00 00 00       	mov    $0x6,%edx
+  802652:	89 f8                	mov    %edi,%eax
+  802654:	e8 a5 fc ff ff       	call   8022fe <fsring_rw>
+  802659:	83 c4 10             	add    $0x10,%esp
+  80265c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80265f:	75 39                	jne    80269a <devfile_write+0x6d>
+  802661:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802666:	39 c3                	cmp    %eax,%ebx
+  802668:	0f 47 d8             	cmova  %eax,%ebx
+  80266b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80266e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802673:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802679:	83 ec 04             	sub    $0x4,%esp
+  80267c:	53                   	push   %ebx
+  80267d:	56                   	push   %esi
+  80267e:	68 08 70 80 00       	push   $0x807008
+  802683:	e8 aa e5 ff ff       	call   800c32 <memmove>
+  802688:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802692:	e8 7c fb ff ff       	call   802213 <fsipc>
+  802697:	83 c4 10             	add    $0x10,%esp
+  80269a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80269d:	5b                   	pop    %ebx
+  80269e:	5e                   	pop    %esi
+  80269f:	5f                   	pop    %edi
+  8026a0:	5d                   	pop    %ebp
+  8026a1:	c3                   	ret
+
+008026a2 <devfile_read>:
+  8026a2:	55                   	push   %ebp
+  8026a3:	89 e5                	mov    %esp,%ebp
+  8026a5:	57                   	push   %edi
+  8026a6:	56                   	push   %esi
+  8026a7:	53                   	push   %ebx
+  8026a8:	83 ec 0c             	sub    $0xc,%esp
+  8026ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026ae:	8b 75 10             	mov    0x10(%ebp),%esi
+  8026b1:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8026b7:	76 1d                	jbe    8026d6 <devfile_read+0x34>
+  8026b9:	83 ec 0c             	sub    $0xc,%esp
+  8026bc:	56                   	push   %esi
+  8026bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026c0:	ba 05 00 00 00       	mov    $0x5,%edx
+  8026c5:	89 f8                	mov    %edi,%eax
+  8026c7:	e8 32 fc ff ff       	call   8022fe <fsring_rw>
+  8026cc:	89 c3                	mov    %eax,%ebx
+  8026ce:	83 c4 10             	add    $0x10,%esp
+  8026d1:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8026d4:	75 37                	jne    80270d <devfile_read+0x6b>
+  8026d6:	8b 47 0c             	mov    0xc(%edi),%eax
+  8026d9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026de:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8026e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026ee:	e8 20 fb ff ff       	call   802213 <fsipc>
+  8026f3:	89 c3                	mov    %eax,%ebx
+  8026f5:	85 c0                	test   %eax,%eax
+  8026f7:	78 14                	js     80270d <devfile_read+0x6b>
+  8026f9:	83 ec 04             	sub    $0x4,%esp
+  8026fc:	50                   	push   %eax
+  8026fd:	68 00 70 80 00       	push   $0x807000
+  802702:	ff 75 0c             	push   0xc(%ebp)
+  802705:	e8 28 e5 ff ff       	call   800c32 <memmove>
+  80270a:	83 c4 10             	add    $0x10,%esp
+  80270d:	89 d8                	mov    %ebx,%eax
+  80270f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802712:	5b                   	pop    %ebx
+  802713:	5e                   	pop    %esi
+  802714:	5f                   	pop    %edi
+  802715:	5d                   	pop    %ebp
+  802716:	c3                   	ret
+
+00802717 <open>:
+  802717:	55                   	push   %ebp
+  802718:	89 e5                	mov    %esp,%ebp
+  80271a:	56                   	push   %esi
+  80271b:	53                   	push   %ebx
+  80271c:	83 ec 1c             	sub    $0x1c,%esp
+  80271f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802722:	56                   	push   %esi
+  802723:	e8 0e e3 ff ff       	call   800a36 <strlen>
+  802728:	83 c4 10             	add    $0x10,%esp
+  80272b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802730:	7f 6c                	jg     80279e <open+0x87>
+  802732:	83 ec 0c             	sub    $0xc,%esp
+  802735:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802738:	50                   	push   %eax
+  802739:	e8 6a f5 ff ff       	call   801ca8 <fd_alloc>
+  80273e:	89 c3                	mov    %eax,%ebx
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	85 c0                	test   %eax,%eax
+  802745:	78 3c                	js     802783 <open+0x6c>
+  802747:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80274a:	a3 00 74 80 00       	mov    %eax,0x807400
+  80274f:	83 ec 08             	sub    $0x8,%esp
+  802752:	56                   	push   %esi
+  802753:	68 00 70 80 00       	push   $0x807000
+  802758:	e8 25 e3 ff ff       	call   800a82 <strcpy>
+  80275d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802760:	b8 01 00 00 00       	mov    $0x1,%eax
+  802765:	e8 a9 fa ff ff       	call   802213 <fsipc>
+  80276a:	89 c3                	mov    %eax,%ebx
+  80276c:	83 c4 10             	add    $0x10,%esp
+  80276f:	85 c0                	test   %eax,%eax
+  802771:	78 19                	js     80278c <open+0x75>
+  802773:	83 ec 0c             	sub    $0xc,%esp
+  802776:	ff 75 f4             	push   -0xc(%ebp)
+  802779:	e8 03 f5 ff ff       	call   801c81 <fd2num>
+  80277e:	89 c3                	mov    %eax,%ebx
+  802780:	83 c4 10             	add    $0x10,%esp
+  802783:	89 d8                	mov    %ebx,%eax
+  802785:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802788:	5b                   	pop    %ebx
+  802789:	5e                   	pop    %esi
+  80278a:	5d                   	pop    %ebp
+  80278b:	c3                   	ret
+  80278c:	83 ec 08             	sub    $0x8,%esp
+  80278f:	6a 00                	push   $0x0
+  802791:	ff 75 f4             	push   -0xc(%ebp)
+  802794:	e8 05 f6 ff ff       	call   801d9e <fd_close>
+  802799:	83 c4 10             	add    $0x10,%esp
+  80279c:	eb e5                	jmp    802783 <open+0x6c>
+  80279e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8027a3:	eb de                	jmp    802783 <open+0x6c>
+
+008027a5 <file_image>:
+  8027a5:	55                   	push   %ebp
+  8027a6:	89 e5                	mov    %esp,%ebp
+  8027a8:	53                   	push   %ebx
+  8027a9:	83 ec 1c             	sub    $0x1c,%esp
+  8027ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027b2:	50                   	push   %eax
+  8027b3:	ff 75 08             	push   0x8(%ebp)
+  8027b6:	e8 3d f5 ff ff       	call   801cf8 <fd_lookup>
+  8027bb:	83 c4 10             	add    $0x10,%esp
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	78 58                	js     80281a <file_image+0x75>
+  8027c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027c5:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8027cb:	39 08                	cmp    %ecx,(%eax)
+  8027cd:	75 50                	jne    80281f <file_image+0x7a>
+  8027cf:	83 fb 04             	cmp    $0x4,%ebx
+  8027d2:	77 52                	ja     802826 <file_image+0x81>
+  8027d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027d7:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027dc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8027e2:	83 ec 04             	sub    $0x4,%esp
+  8027e5:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8027e8:	c1 e0 02             	shl    $0x2,%eax
+  8027eb:	50                   	push   %eax
+  8027ec:	ff 75 0c             	push   0xc(%ebp)
+  8027ef:	68 08 70 80 00       	push   $0x807008
+  8027f4:	e8 39 e4 ff ff       	call   800c32 <memmove>
+  8027f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fe:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802803:	e8 0b fa ff ff       	call   802213 <fsipc>
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	78 0b                	js     80281a <file_image+0x75>
+  80280f:	8b 55 14             	mov    0x14(%ebp),%edx
+  802812:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802818:	89 0a                	mov    %ecx,(%edx)
+  80281a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80281d:	c9                   	leave
+  80281e:	c3                   	ret
+  80281f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802824:	eb f4                	jmp    80281a <file_image+0x75>
+  802826:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80282b:	eb ed                	jmp    80281a <file_image+0x75>
+
+0080282d <remove>:
+  80282d:	55                   	push   %ebp
+  80282e:	89 e5                	mov    %esp,%ebp
+  802830:	53                   	push   %ebx
+  802831:	83 ec 10             	sub    $0x10,%esp
+  802834:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802837:	53                   	push   %ebx
+  802838:	e8 f9 e1 ff ff       	call   800a36 <strlen>
+  80283d:	83 c4 10             	add    $0x10,%esp
+  802840:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802845:	7f 25                	jg     80286c <remove+0x3f>
+  802847:	83 ec 08             	sub    $0x8,%esp
+  80284a:	53                   	push   %ebx
+  80284b:	68 00 70 80 00       	push   $0x807000
+  802850:	e8 2d e2 ff ff       	call   800a82 <strcpy>
+  802855:	ba 00 00 00 00       	mov    $0x0,%edx
+  80285a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80285f:	e8 af f9 ff ff       	call   802213 <fsipc>
+  802864:	83 c4 10             	add    $0x10,%esp
+  802867:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80286a:	c9                   	leave
+  80286b:	c3                   	ret
+  80286c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802871:	eb f4                	jmp    802867 <remove+0x3a>
+
+00802873 <sync>:
+  802873:	55                   	push   %ebp
+  802874:	89 e5                	mov    %esp,%ebp
+  802876:	83 ec 08             	sub    $0x8,%esp
+  802879:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802883:	e8 8b f9 ff ff       	call   802213 <fsipc>
+  802888:	c9                   	leave
+  802889:	c3                   	ret
+
+0080288a <devsock_stat>:
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	83 ec 10             	sub    $0x10,%esp
+  802890:	68 d0 3e 80 00       	push   $0x803ed0
+  802895:	ff 75 0c             	push   0xc(%ebp)
+  802898:	e8 e5 e1 ff ff       	call   800a82 <strcpy>
+  80289d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a2:	c9                   	leave
+  8028a3:	c3                   	ret
+
+008028a4 <devsock_close>:
+  8028a4:	55                   	push   %ebp
+  8028a5:	89 e5                	mov    %esp,%ebp
+  8028a7:	53                   	push   %ebx
+  8028a8:	83 ec 10             	sub    $0x10,%esp
+  8028ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028ae:	53                   	push   %ebx
+  8028af:	e8 3c 0e 00 00       	call   8036f0 <pageref>
+  8028b4:	89 c2                	mov    %eax,%edx
+  8028b6:	83 c4 10             	add    $0x10,%esp
+  8028b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028be:	83 fa 01             	cmp    $0x1,%edx
+  8028c1:	74 05                	je     8028c8 <devsock_close+0x24>
+  8028c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028c6:	c9                   	leave
+  8028c7:	c3                   	ret
+  8028c8:	83 ec 0c             	sub    $0xc,%esp
+  8028cb:	ff 73 0c             	push   0xc(%ebx)
+  8028ce:	e8 aa 02 00 00       	call   802b7d <nsipc_close>
+  8028d3:	83 c4 10             	add    $0x10,%esp
+  8028d6:	eb eb                	jmp    8028c3 <devsock_close+0x1f>
+
+008028d8 <devsock_write>:
+  8028d8:	55                   	push   %ebp
+  8028d9:	89 e5                	mov    %esp,%ebp
+  8028db:	83 ec 08             	sub    $0x8,%esp
+  8028de:	6a 00                	push   $0x0
+  8028e0:	ff 75 10             	push   0x10(%ebp)
+  8028e3:	ff 75 0c             	push   0xc(%ebp)
+  8028e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e9:	ff 70 0c             	push   0xc(%eax)
+  8028ec:	e8 6c 03 00 00       	call   802c5d <nsipc_send>
+  8028f1:	c9                   	leave
+  8028f2:	c3                   	ret
+
+008028f3 <devsock_read>:
+  8028f3:	55                   	push   %ebp
+  8028f4:	89 e5                	mov    %esp,%ebp
+  8028f6:	83 ec 08             	sub    $0x8,%esp
+  8028f9:	6a 00                	push   $0x0
+  8028fb:	ff 75 10             	push   0x10(%ebp)
+  8028fe:	ff 75 0c             	push   0xc(%ebp)
+  802901:	8b 45 08             	mov    0x8(%ebp),%eax
+  802904:	ff 70 0c             	push   0xc(%eax)
+  802907:	e8 e2 02 00 00       	call   802bee <nsipc_recv>
+  80290c:	c9                   	leave
+  80290d:	c3                   	ret
+
+0080290e <fd2sockid>:
+  80290e:	55                   	push   %ebp
+  80290f:	89 e5                	mov    %esp,%ebp
+  802911:	83 ec 20             	sub    $0x20,%esp
+  802914:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802917:	52                   	push   %edx
+  802918:	50                   	push   %eax
+  802919:	e8 da f3 ff ff       	call   801cf8 <fd_lookup>
+  80291e:	83 c4 10             	add    $0x10,%esp
+  802921:	85 c0                	test   %eax,%eax
+  802923:	78 10                	js     802935 <fd2sockid+0x27>
+  802925:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802928:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  80292e:	39 08                	cmp    %ecx,(%eax)
+  802930:	75 05                	jne    802937 <fd2sockid+0x29>
+  802932:	8b 40 0c             	mov    0xc(%eax),%eax
+  802935:	c9                   	leave
+  802936:	c3                   	ret
+  802937:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80293c:	eb f7                	jmp    802935 <fd2sockid+0x27>
+
+0080293e <alloc_sockfd>:
+  80293e:	55                   	push   %ebp
+  80293f:	89 e5                	mov    %esp,%ebp
+  802941:	56                   	push   %esi
+  802942:	53                   	push   %ebx
+  802943:	83 ec 1c             	sub    $0x1c,%esp
+  802946:	89 c6                	mov    %eax,%esi
+  802948:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80294b:	50                   	push   %eax
+  80294c:	e8 57 f3 ff ff       	call   801ca8 <fd_alloc>
+  802951:	89 c3                	mov    %eax,%ebx
+  802953:	83 c4 10             	add    $0x10,%esp
+  802956:	85 c0                	test   %eax,%eax
+  802958:	78 43                	js     80299d <alloc_sockfd+0x5f>
+  80295a:	83 ec 04             	sub    $0x4,%esp
+  80295d:	68 07 04 00 00       	push   $0x407
+  802962:	ff 75 f4             	push   -0xc(%ebp)
+  802965:	6a 00                	push   $0x0
+  802967:	e8 76 e5 ff ff       	call   800ee2 <sys_page_alloc>
+  80296c:	89 c3                	mov    %eax,%ebx
+  80296e:	83 c4 10             	add    $0x10,%esp
+  802971:	85 c0                	test   %eax,%eax
+  802973:	78 28                	js     80299d <alloc_sockfd+0x5f>
+  802975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802978:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80297e:	89 10                	mov    %edx,(%eax)
+  802980:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802983:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80298a:	89 70 0c             	mov    %esi,0xc(%eax)
+  80298d:	83 ec 0c             	sub    $0xc,%esp
+  802990:	50                   	push   %eax
+  802991:	e8 eb f2 ff ff       	call   801c81 <fd2num>
+  802996:	89 c3                	mov    %eax,%ebx
+  802998:	83 c4 10             	add    $0x10,%esp
+  80299b:	eb 0c                	jmp    8029a9 <alloc_sockfd+0x6b>
+  80299d:	83 ec 0c             	sub    $0xc,%esp
+  8029a0:	56                   	push   %esi
+  8029a1:	e8 d7 01 00 00       	call   802b7d <nsipc_close>
+  8029a6:	83 c4 10             	add    $0x10,%esp
+  8029a9:	89 d8                	mov    %ebx,%eax
+  8029ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ae:	5b                   	pop    %ebx
+  8029af:	5e                   	pop    %esi
+  8029b0:	5d                   	pop    %ebp
+  8029b1:	c3                   	ret
+
+008029b2 <accept>:
+  8029b2:	55                   	push   %ebp
+  8029b3:	89 e5                	mov    %esp,%ebp
+  8029b5:	83 ec 08             	sub    $0x8,%esp
+  8029b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029bb:	e8 4e ff ff ff       	call   80290e <fd2sockid>
+  8029c0:	85 c0                	test   %eax,%eax
+  8029c2:	78 1b                	js     8029df <accept+0x2d>
+  8029c4:	83 ec 04             	sub    $0x4,%esp
+  8029c7:	ff 75 10             	push   0x10(%ebp)
+  8029ca:	ff 75 0c             	push   0xc(%ebp)
+  8029cd:	50                   	push   %eax
+  8029ce:	e8 07 01 00 00       	call   802ada <nsipc_accept>
+  8029d3:	83 c4 10             	add    $0x10,%esp
+  8029d6:	85 c0                	test   %eax,%eax
+  8029d8:	78 05                	js     8029df <accept+0x2d>
+  8029da:	e8 5f ff ff ff       	call   80293e <alloc_sockfd>
+  8029df:	c9                   	leave
+  8029e0:	c3                   	ret
+
+008029e1 <bind>:
+  8029e1:	55                   	push   %ebp
+  8029e2:	89 e5                	mov    %esp,%ebp
+  8029e4:	83 ec 08             	sub    $0x8,%esp
+  8029e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ea:	e8 1f ff ff ff       	call   80290e <fd2sockid>
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	78 12                	js     802a05 <bind+0x24>
+  8029f3:	83 ec 04             	sub    $0x4,%esp
+  8029f6:	ff 75 10             	push   0x10(%ebp)
+  8029f9:	ff 75 0c             	push   0xc(%ebp)
+  8029fc:	50                   	push   %eax
+  8029fd:	e8 24 01 00 00       	call   802b26 <nsipc_bind>
+  802a02:	83 c4 10             	add    $0x10,%esp
+  802a05:	c9                   	leave
+  802a06:	c3                   	ret
+
+00802a07 <shutdown>:
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	83 ec 08             	sub    $0x8,%esp
+  802a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a10:	e8 f9 fe ff ff       	call   80290e <fd2sockid>
+  802a15:	85 c0                	test   %eax,%eax
+  802a17:	78 0f                	js     802a28 <shutdown+0x21>
+  802a19:	83 ec 08             	sub    $0x8,%esp
+  802a1c:	ff 75 0c             	push   0xc(%ebp)
+  802a1f:	50                   	push   %eax
+  802a20:	e8 36 01 00 00       	call   802b5b <nsipc_shutdown>
+  802a25:	83 c4 10             	add    $0x10,%esp
+  802a28:	c9                   	leave
+  802a29:	c3                   	ret
+
+00802a2a <connect>:
+  802a2a:	55                   	push   %ebp
+  802a2b:	89 e5                	mov    %esp,%ebp
+  802a2d:	83 ec 08             	sub    $0x8,%esp
+  802a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a33:	e8 d6 fe ff ff       	call   80290e <fd2sockid>
+  802a38:	85 c0                	test   %eax,%eax
+  802a3a:	78 12                	js     802a4e <connect+0x24>
+  802a3c:	83 ec 04             	sub    $0x4,%esp
+  802a3f:	ff 75 10             	push   0x10(%ebp)
+  802a42:	ff 75 0c             	push   0xc(%ebp)
+  802a45:	50                   	push   %eax
+  802a46:	e8 4c 01 00 00       	call   802b97 <nsipc_connect>
+  802a4b:	83 c4 10             	add    $0x10,%esp
+  802a4e:	c9                   	leave
+  802a4f:	c3                   	ret
+
+00802a50 <listen>:
+  802a50:	55                   	push   %ebp
+  802a51:	89 e5                	mov    %esp,%ebp
+  802a53:	83 ec 08             	sub    $0x8,%esp
+  802a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a59:	e8 b0 fe ff ff       	call   80290e <fd2sockid>
+  802a5e:	85 c0                	test   %eax,%eax
+  802a60:	78 0f                	js     802a71 <listen+0x21>
+  802a62:	83 ec 08             	sub    $0x8,%esp
+  802a65:	ff 75 0c             	push   0xc(%ebp)
+  802a68:	50                   	push   %eax
+  802a69:	e8 5e 01 00 00       	call   802bcc <nsipc_listen>
+  802a6e:	83 c4 10             	add    $0x10,%esp
+  802a71:	c9                   	leave
+  802a72:	c3                   	ret
+
+00802a73 <socket>:
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	83 ec 0c             	sub    $0xc,%esp
+  802a79:	ff 75 10             	push   0x10(%ebp)
+  802a7c:	ff 75 0c             	push   0xc(%ebp)
+  802a7f:	ff 75 08             	push   0x8(%ebp)
+  802a82:	e8 34 02 00 00       	call   802cbb <nsipc_socket>
+  802a87:	83 c4 10             	add    $0x10,%esp
+  802a8a:	85 c0                	test   %eax,%eax
+  802a8c:	78 05                	js     802a93 <socket+0x20>
+  802a8e:	e8 ab fe ff ff       	call   80293e <alloc_sockfd>
+  802a93:	c9                   	leave
+  802a94:	c3                   	ret
+
+00802a95 <nsipc>:
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+  802a98:	53                   	push   %ebx
+  802a99:	83 ec 04             	sub    $0x4,%esp
+  802a9c:	89 c3                	mov    %eax,%ebx
+  802a9e:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  802aa5:	74 1f                	je     802ac6 <nsipc+0x31>
+  802aa7:	83 ec 08             	sub    $0x8,%esp
+  802aaa:	6a 00                	push   $0x0
+  802aac:	6a 00                	push   $0x0
+  802aae:	6a 07                	push   $0x7
+  802ab0:	68 00 80 80 00       	push   $0x808000
+  802ab5:	53                   	push   %ebx
+  802ab6:	ff 35 10 60 80 00    	push   0x806010
+  802abc:	e8 7a 0a 00 00       	call   80353b <ipc_call>
+  802ac1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac4:	c9                   	leave
+  802ac5:	c3                   	ret
+  802ac6:	83 ec 0c             	sub    $0xc,%esp
+  802ac9:	6a 03                	push   $0x3
+  802acb:	e8 06 0c 00 00       	call   8036d6 <ipc_find_env>
+  802ad0:	a3 10 60 80 00       	mov    %eax,0x806010
+  802ad5:	83 c4 10             	add    $0x10,%esp
+  802ad8:	eb cd                	jmp    802aa7 <nsipc+0x12>
+
+00802ada <nsipc_accept>:
+  802ada:	55                   	push   %ebp
+  802adb:	89 e5                	mov    %esp,%ebp
+  802add:	53                   	push   %ebx
+  802ade:	83 ec 04             	sub    $0x4,%esp
+  802ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae4:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ae9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802aee:	e8 a2 ff ff ff       	call   802a95 <nsipc>
+  802af3:	89 c3                	mov    %eax,%ebx
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	79 07                	jns    802b00 <nsipc_accept+0x26>
+  802af9:	89 d8                	mov    %ebx,%eax
+  802afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+  802b00:	83 ec 04             	sub    $0x4,%esp
+  802b03:	ff 35 10 80 80 00    	push   0x808010
+  802b09:	68 00 80 80 00       	push   $0x808000
+  802b0e:	ff 75 0c             	push   0xc(%ebp)
+  802b11:	e8 1c e1 ff ff       	call   800c32 <memmove>
+  802b16:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b1c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b1f:	89 10                	mov    %edx,(%eax)
+  802b21:	83 c4 10             	add    $0x10,%esp
+  802b24:	eb d3                	jmp    802af9 <nsipc_accept+0x1f>
+
+00802b26 <nsipc_bind>:
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	53                   	push   %ebx
+  802b2a:	83 ec 08             	sub    $0x8,%esp
+  802b2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b33:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b38:	53                   	push   %ebx
+  802b39:	ff 75 0c             	push   0xc(%ebp)
+  802b3c:	68 04 80 80 00       	push   $0x808004
+  802b41:	e8 ec e0 ff ff       	call   800c32 <memmove>
+  802b46:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802b4c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b51:	e8 3f ff ff ff       	call   802a95 <nsipc>
+  802b56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b59:	c9                   	leave
+  802b5a:	c3                   	ret
+
+00802b5b <nsipc_shutdown>:
+  802b5b:	55                   	push   %ebp
+  802b5c:	89 e5                	mov    %esp,%ebp
+  802b5e:	83 ec 08             	sub    $0x8,%esp
+  802b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b64:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b6c:	a3 04 80 80 00       	mov    %eax,0x808004
+  802b71:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b76:	e8 1a ff ff ff       	call   802a95 <nsipc>
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+
+00802b7d <nsipc_close>:
+  802b7d:	55                   	push   %ebp
+  802b7e:	89 e5                	mov    %esp,%ebp
+  802b80:	83 ec 08             	sub    $0x8,%esp
+  802b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b86:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b90:	e8 00 ff ff ff       	call   802a95 <nsipc>
+  802b95:	c9                   	leave
+  802b96:	c3                   	ret
+
+00802b97 <nsipc_connect>:
+  802b97:	55                   	push   %ebp
+  802b98:	89 e5                	mov    %esp,%ebp
+  802b9a:	53                   	push   %ebx
+  802b9b:	83 ec 08             	sub    $0x8,%esp
+  802b9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba4:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ba9:	53                   	push   %ebx
+  802baa:	ff 75 0c             	push   0xc(%ebp)
+  802bad:	68 04 80 80 00       	push   $0x808004
+  802bb2:	e8 7b e0 ff ff       	call   800c32 <memmove>
+  802bb7:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802bbd:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bc2:	e8 ce fe ff ff       	call   802a95 <nsipc>
+  802bc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bca:	c9                   	leave
+  802bcb:	c3                   	ret
+
+00802bcc <nsipc_listen>:
+  802bcc:	55                   	push   %ebp
+  802bcd:	89 e5                	mov    %esp,%ebp
+  802bcf:	83 ec 08             	sub    $0x8,%esp
+  802bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd5:	a3 00 80 80 00       	mov    %eax,0x808000
+  802bda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bdd:	a3 04 80 80 00       	mov    %eax,0x808004
+  802be2:	b8 06 00 00 00       	mov    $0x6,%eax
+  802be7:	e8 a9 fe ff ff       	call   802a95 <nsipc>
+  802bec:	c9                   	leave
+  802bed:	c3                   	ret
+
+00802bee <nsipc_recv>:
+  802bee:	55                   	push   %ebp
+  802bef:	89 e5                	mov    %esp,%ebp
+  802bf1:	56                   	push   %esi
+  802bf2:	53                   	push   %ebx
+  802bf3:	8b 75 10             	mov    0x10(%ebp),%esi
+  802bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf9:	a3 00 80 80 00       	mov    %eax,0x808000
+  802bfe:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802c04:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c07:	a3 08 80 80 00       	mov    %eax,0x808008
+  802c0c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c11:	e8 7f fe ff ff       	call   802a95 <nsipc>
+  802c16:	89 c3                	mov    %eax,%ebx
+  802c18:	85 c0                	test   %eax,%eax
+  802c1a:	78 22                	js     802c3e <nsipc_recv+0x50>
+  802c1c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c21:	39 c6                	cmp    %eax,%esi
+  802c23:	0f 4e c6             	cmovle %esi,%eax
+  802c26:	39 c3                	cmp    %eax,%ebx
+  802c28:	7f 1d                	jg     802c47 <nsipc_recv+0x59>
+  802c2a:	83 ec 04             	sub    $0x4,%esp
+  802c2d:	53                   	push   %ebx
+  802c2e:	68 00 80 80 00       	push   $0x808000
+  802c33:	ff 75 0c             	push   0xc(%ebp)
+  802c36:	e8 f7 df ff ff       	call   800c32 <memmove>
+  802c3b:	83 c4 10             	add    $0x10,%esp
+  802c3e:	89 d8                	mov    %ebx,%eax
+  802c40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c43:	5b                   	pop    %ebx
+  802c44:	5e                   	pop    %esi
+  802c45:	5d                   	pop    %ebp
+  802c46:	c3                   	ret
+  802c47:	68 dc 3e 80 00       	push   $0x803edc
+  802c4c:	68 f1 3e 80 00       	push   $0x803ef1
+  802c51:	6a 60                	push   $0x60
+  802c53:	68 06 3f 80 00       	push   $0x803f06
+  802c58:	e8 53 d6 ff ff       	call   8002b0 <_panic>
+
+00802c5d <nsipc_send>:
+  802c5d:	55                   	push   %ebp
+  802c5e:	89 e5                	mov    %esp,%ebp
+  802c60:	53                   	push   %ebx
+  802c61:	83 ec 04             	sub    $0x4,%esp
+  802c64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6a:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c6f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c75:	7f 2e                	jg     802ca5 <nsipc_send+0x48>
+  802c77:	83 ec 04             	sub    $0x4,%esp
+  802c7a:	53                   	push   %ebx
+  802c7b:	ff 75 0c             	push   0xc(%ebp)
+  802c7e:	68 0c 80 80 00       	push   $0x80800c
+  802c83:	e8 aa df ff ff       	call   800c32 <memmove>
+  802c88:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802c8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c91:	a3 08 80 80 00       	mov    %eax,0x808008
+  802c96:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c9b:	e8 f5 fd ff ff       	call   802a95 <nsipc>
+  802ca0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ca3:	c9                   	leave
+  802ca4:	c3                   	ret
+  802ca5:	68 12 3f 80 00       	push   $0x803f12
+  802caa:	68 f1 3e 80 00       	push   $0x803ef1
+  802caf:	6a 6b                	push   $0x6b
+  802cb1:	68 06 3f 80 00       	push   $0x803f06
+  802cb6:	e8 f5 d5 ff ff       	call   8002b0 <_panic>
+
+00802cbb <nsipc_socket>:
+  802cbb:	55                   	push   %ebp
+  802cbc:	89 e5                	mov    %esp,%ebp
+  802cbe:	83 ec 08             	sub    $0x8,%esp
+  802cc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc4:	a3 00 80 80 00       	mov    %eax,0x808000
+  802cc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ccc:	a3 04 80 80 00       	mov    %eax,0x808004
+  802cd1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cd4:	a3 08 80 80 00       	mov    %eax,0x808008
+  802cd9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802cde:	e8 b2 fd ff ff       	call   802a95 <nsipc>
+  802ce3:	c9                   	leave
+  802ce4:	c3                   	ret
+
+00802ce5 <devpipe_stat>:
+  802ce5:	55                   	push   %ebp
+  802ce6:	89 e5                	mov    %esp,%ebp
+  802ce8:	56                   	push   %esi
+  802ce9:	53                   	push   %ebx
+  802cea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ced:	83 ec 0c             	sub    $0xc,%esp
+  802cf0:	ff 75 08             	push   0x8(%ebp)
+  802cf3:	e8 99 ef ff ff       	call   801c91 <fd2data>
+  802cf8:	89 c6                	mov    %eax,%esi
+  802cfa:	83 c4 08             	add    $0x8,%esp
+  802cfd:	68 1e 3f 80 00       	push   $0x803f1e
+  802d02:	53                   	push   %ebx
+  802d03:	e8 7a dd ff ff       	call   800a82 <strcpy>
+  802d08:	8b 46 04             	mov    0x4(%esi),%eax
+  802d0b:	2b 06                	sub    (%esi),%eax
+  802d0d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802d13:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d1a:	00 00 00 
+  802d1d:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802d24:	50 80 00 
+  802d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d2f:	5b                   	pop    %ebx
+  802d30:	5e                   	pop    %esi
+  802d31:	5d                   	pop    %ebp
+  802d32:	c3                   	ret
+
+00802d33 <devpipe_close>:
+  802d33:	55                   	push   %ebp
+  802d34:	89 e5                	mov    %esp,%ebp
+  802d36:	53                   	push   %ebx
+  802d37:	83 ec 0c             	sub    $0xc,%esp
+  802d3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802d3d:	53                   	push   %ebx
+  802d3e:	6a 00                	push   $0x0
+  802d40:	e8 6f e2 ff ff       	call   800fb4 <sys_page_unmap>
+  802d45:	89 1c 24             	mov    %ebx,(%esp)
+  802d48:	e8 44 ef ff ff       	call   801c91 <fd2data>
+  802d4d:	83 c4 08             	add    $0x8,%esp
+  802d50:	50                   	push   %eax
+  802d51:	6a 00                	push   $0x0
+  802d53:	e8 5c e2 ff ff       	call   800fb4 <sys_page_unmap>
+  802d58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d5b:	c9                   	leave
+  802d5c:	c3                   	ret
+
+00802d5d <_pipeisclosed>:
+  802d5d:	55                   	push   %ebp
+  802d5e:	89 e5                	mov    %esp,%ebp
+  802d60:	57                   	push   %edi
+  802d61:	56                   	push   %esi
+  802d62:	53                   	push   %ebx
+  802d63:	83 ec 1c             	sub    $0x1c,%esp
+  802d66:	89 c7                	mov    %eax,%edi
+  802d68:	89 d6                	mov    %edx,%esi
+  802d6a:	a1 14 60 80 00       	mov    0x806014,%eax
+  802d6f:	8b 58 58             	mov    0x58(%eax),%ebx
+  802d72:	83 ec 0c             	sub    $0xc,%esp
+  802d75:	57                   	push   %edi
+  802d76:	e8 75 09 00 00       	call   8036f0 <pageref>
+  802d7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d7e:	89 34 24             	mov    %esi,(%esp)
+  802d81:	e8 6a 09 00 00       	call   8036f0 <pageref>
+  802d86:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  802d8c:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802d8f:	83 c4 10             	add    $0x10,%esp
+  802d92:	39 cb                	cmp    %ecx,%ebx
+  802d94:	74 1b                	je     802db1 <_pipeisclosed+0x54>
+  802d96:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d99:	75 cf                	jne    802d6a <_pipeisclosed+0xd>
+  802d9b:	8b 42 58             	mov    0x58(%edx),%eax
+  802d9e:	6a 01                	push   $0x1
+  802da0:	50                   	push   %eax
+  802da1:	53                   	push   %ebx
+  802da2:	68 25 3f 80 00       	push   $0x803f25
+  802da7:	e8 df d5 ff ff       	call   80038b <cprintf>
+  802dac:	83 c4 10             	add    $0x10,%esp
+  802daf:	eb b9                	jmp    802d6a <_pipeisclosed+0xd>
+  802db1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802db4:	0f 94 c0             	sete   %al
+  802db7:	0f b6 c0             	movzbl %al,%eax
+  802dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dbd:	5b                   	pop    %ebx
+  802dbe:	5e                   	pop    %esi
+  802dbf:	5f                   	pop    %edi
+  802dc0:	5d                   	pop    %ebp
+  802dc1:	c3                   	ret
+
+00802dc2 <devpipe_write>:
+  802dc2:	55                   	push   %ebp
+  802dc3:	89 e5                	mov    %esp,%ebp
+  802dc5:	57                   	push   %edi
+  802dc6:	56                   	push   %esi
+  802dc7:	53                   	push   %ebx
+  802dc8:	83 ec 28             	sub    $0x28,%esp
+  802dcb:	8b 75 08             	mov    0x8(%ebp),%esi
+  802dce:	56                   	push   %esi
+  802dcf:	e8 bd ee ff ff       	call   801c91 <fd2data>
+  802dd4:	89 c3                	mov    %eax,%ebx
+  802dd6:	83 c4 10             	add    $0x10,%esp
+  802dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dde:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802de2:	74 5c                	je     802e40 <devpipe_write+0x7e>
+  802de4:	8b 43 04             	mov    0x4(%ebx),%eax
+  802de7:	8b 0b                	mov    (%ebx),%ecx
+  802de9:	8d 51 20             	lea    0x20(%ecx),%edx
+  802dec:	39 d0                	cmp    %edx,%eax
+  802dee:	72 1e                	jb     802e0e <devpipe_write+0x4c>
+  802df0:	89 da                	mov    %ebx,%edx
+  802df2:	89 f0                	mov    %esi,%eax
+  802df4:	e8 64 ff ff ff       	call   802d5d <_pipeisclosed>
+  802df9:	85 c0                	test   %eax,%eax
+  802dfb:	75 48                	jne    802e45 <devpipe_write+0x83>
+  802dfd:	e8 95 e0 ff ff       	call   800e97 <sys_yield>
+  802e02:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e05:	8b 0b                	mov    (%ebx),%ecx
+  802e07:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e0a:	39 d0                	cmp    %edx,%eax
+  802e0c:	73 e2                	jae    802df0 <devpipe_write+0x2e>
+  802e0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e11:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e15:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e18:	89 c2                	mov    %eax,%edx
+  802e1a:	c1 fa 1f             	sar    $0x1f,%edx
+  802e1d:	89 d1                	mov    %edx,%ecx
+  802e1f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802e22:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e25:	83 e2 1f             	and    $0x1f,%edx
+  802e28:	29 ca                	sub    %ecx,%edx
+  802e2a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802e2e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802e32:	83 c0 01             	add    $0x1,%eax
+  802e35:	89 43 04             	mov    %eax,0x4(%ebx)
+  802e38:	83 c7 01             	add    $0x1,%edi
+  802e3b:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802e3e:	75 a4                	jne    802de4 <devpipe_write+0x22>
+  802e40:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e43:	eb 05                	jmp    802e4a <devpipe_write+0x88>
+  802e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e4d:	5b                   	pop    %ebx
+  802e4e:	5e                   	pop    %esi
+  802e4f:	5f                   	pop    %edi
+  802e50:	5d                   	pop    %ebp
+  802e51:	c3                   	ret
+
+00802e52 <devpipe_read>:
+  802e52:	55                   	push   %ebp
+  802e53:	89 e5                	mov    %esp,%ebp
+  802e55:	57                   	push   %edi
+  802e56:	56                   	push   %esi
+  802e57:	53                   	push   %ebx
+  802e58:	83 ec 18             	sub    $0x18,%esp
+  802e5b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e5e:	56                   	push   %esi
+  802e5f:	e8 2d ee ff ff       	call   801c91 <fd2data>
+  802e64:	89 c3                	mov    %eax,%ebx
+  802e66:	83 c4 10             	add    $0x10,%esp
+  802e69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e6e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e72:	74 45                	je     802eb9 <devpipe_read+0x67>
+  802e74:	8b 03                	mov    (%ebx),%eax
+  802e76:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e79:	75 1d                	jne    802e98 <devpipe_read+0x46>
+  802e7b:	85 ff                	test   %edi,%edi
+  802e7d:	75 3f                	jne    802ebe <devpipe_read+0x6c>
+  802e7f:	89 da                	mov    %ebx,%edx
+  802e81:	89 f0                	mov    %esi,%eax
+  802e83:	e8 d5 fe ff ff       	call   802d5d <_pipeisclosed>
+  802e88:	85 c0                	test   %eax,%eax
+  802e8a:	75 3c                	jne    802ec8 <devpipe_read+0x76>
+  802e8c:	e8 06 e0 ff ff       	call   800e97 <sys_yield>
+  802e91:	8b 03                	mov    (%ebx),%eax
+  802e93:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e96:	74 e7                	je     802e7f <devpipe_read+0x2d>
+  802e98:	99                   	cltd
+  802e99:	c1 ea 1b             	shr    $0x1b,%edx
+  802e9c:	01 d0                	add    %edx,%eax
+  802e9e:	83 e0 1f             	and    $0x1f,%eax
+  802ea1:	29 d0                	sub    %edx,%eax
+  802ea3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802eab:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802eae:	83 03 01             	addl   $0x1,(%ebx)
+  802eb1:	83 c7 01             	add    $0x1,%edi
+  802eb4:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802eb7:	75 bb                	jne    802e74 <devpipe_read+0x22>
+  802eb9:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ebc:	eb 02                	jmp    802ec0 <devpipe_read+0x6e>
+  802ebe:	89 f8                	mov    %edi,%eax
+  802ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ec3:	5b                   	pop    %ebx
+  802ec4:	5e                   	pop    %esi
+  802ec5:	5f                   	pop    %edi
+  802ec6:	5d                   	pop    %ebp
+  802ec7:	c3                   	ret
+  802ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ecd:	eb f1                	jmp    802ec0 <devpipe_read+0x6e>
+
+00802ecf <pipe>:
+  802ecf:	55                   	push   %ebp
+  802ed0:	89 e5                	mov    %esp,%ebp
+  802ed2:	56                   	push   %esi
+  802ed3:	53                   	push   %ebx
+  802ed4:	83 ec 1c             	sub    $0x1c,%esp
+  802ed7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eda:	50                   	push   %eax
+  802edb:	e8 c8 ed ff ff       	call   801ca8 <fd_alloc>
+  802ee0:	89 c3                	mov    %eax,%ebx
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	0f 88 23 01 00 00    	js     803010 <pipe+0x141>
+  802eed:	83 ec 04             	sub    $0x4,%esp
+  802ef0:	68 07 04 00 00       	push   $0x407
+  802ef5:	ff 75 f4             	push   -0xc(%ebp)
+  802ef8:	6a 00                	push   $0x0
+  802efa:	e8 e3 df ff ff       	call   800ee2 <sys_page_alloc>
+  802eff:	89 c3                	mov    %eax,%ebx
+  802f01:	83 c4 10             	add    $0x10,%esp
+  802f04:	85 c0                	test   %eax,%eax
+  802f06:	0f 88 04 01 00 00    	js     803010 <pipe+0x141>
+  802f0c:	83 ec 0c             	sub    $0xc,%esp
+  802f0f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f12:	50                   	push   %eax
+  802f13:	e8 90 ed ff ff       	call   801ca8 <fd_alloc>
+  802f18:	89 c3                	mov    %eax,%ebx
+  802f1a:	83 c4 10             	add    $0x10,%esp
+  802f1d:	85 c0                	test   %eax,%eax
+  802f1f:	0f 88 db 00 00 00    	js     803000 <pipe+0x131>
+  802f25:	83 ec 04             	sub    $0x4,%esp
+  802f28:	68 07 04 00 00       	push   $0x407
+  802f2d:	ff 75 f0             	push   -0x10(%ebp)
+  802f30:	6a 00                	push   $0x0
+  802f32:	e8 ab df ff ff       	call   800ee2 <sys_page_alloc>
+  802f37:	89 c3                	mov    %eax,%ebx
+  802f39:	83 c4 10             	add    $0x10,%esp
+  802f3c:	85 c0                	test   %eax,%eax
+  802f3e:	0f 88 bc 00 00 00    	js     803000 <pipe+0x131>
+  802f44:	83 ec 0c             	sub    $0xc,%esp
+  802f47:	ff 75 f4             	push   -0xc(%ebp)
+  802f4a:	e8 42 ed ff ff       	call   801c91 <fd2data>
+  802f4f:	89 c6                	mov    %eax,%esi
+  802f51:	83 c4 0c             	add    $0xc,%esp
+  802f54:	68 07 04 00 00       	push   $0x407
+  802f59:	50                   	push   %eax
+  802f5a:	6a 00                	push   $0x0
+  802f5c:	e8 81 df ff ff       	call   800ee2 <sys_page_alloc>
+  802f61:	89 c3                	mov    %eax,%ebx
+  802f63:	83 c4 10             	add    $0x10,%esp
+  802f66:	85 c0                	test   %eax,%eax
+  802f68:	0f 88 82 00 00 00    	js     802ff0 <pipe+0x121>
+  802f6e:	83 ec 0c             	sub    $0xc,%esp
+  802f71:	ff 75 f0             	push   -0x10(%ebp)
+  802f74:	e8 18 ed ff ff       	call   801c91 <fd2data>
+  802f79:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802f80:	50                   	push   %eax
+  802f81:	6a 00                	push   $0x0
+  802f83:	56                   	push   %esi
+  802f84:	6a 00                	push   $0x0
+  802f86:	e8 9a df ff ff       	call   800f25 <sys_page_map>
+  802f8b:	89 c3                	mov    %eax,%ebx
+  802f8d:	83 c4 20             	add    $0x20,%esp
+  802f90:	85 c0                	test   %eax,%eax
+  802f92:	78 4e                	js     802fe2 <pipe+0x113>
+  802f94:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  802f99:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f9c:	89 02                	mov    %eax,(%edx)
+  802f9e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802fa1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802fa8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802fab:	89 02                	mov    %eax,(%edx)
+  802fad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802fb0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802fb7:	83 ec 0c             	sub    $0xc,%esp
+  802fba:	ff 75 f4             	push   -0xc(%ebp)
+  802fbd:	e8 bf ec ff ff       	call   801c81 <fd2num>
+  802fc2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fc5:	89 01                	mov    %eax,(%ecx)
+  802fc7:	83 c4 04             	add    $0x4,%esp
+  802fca:	ff 75 f0             	push   -0x10(%ebp)
+  802fcd:	e8 af ec ff ff       	call   801c81 <fd2num>
+  802fd2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fd5:	89 41 04             	mov    %eax,0x4(%ecx)
+  802fd8:	83 c4 10             	add    $0x10,%esp
+  802fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fe0:	eb 2e                	jmp    803010 <pipe+0x141>
+  802fe2:	83 ec 08             	sub    $0x8,%esp
+  802fe5:	56                   	push   %esi
+  802fe6:	6a 00                	push   $0x0
+  802fe8:	e8 c7 df ff ff       	call   800fb4 <sys_page_unmap>
+  802fed:	83 c4 10             	add    $0x10,%esp
+  802ff0:	83 ec 08             	sub    $0x8,%esp
+  802ff3:	ff 75 f0             	push   -0x10(%ebp)
+  802ff6:	6a 00                	push   $0x0
+  802ff8:	e8 b7 df ff ff       	call   800fb4 <sys_page_unmap>
+  802ffd:	83 c4 10             	add    $0x10,%esp
+  803000:	83 ec 08             	sub    $0x8,%esp
+  803003:	ff 75 f4             	push   -0xc(%ebp)
+  803006:	6a 00                	push   $0x0
+  803008:	e8 a7 df ff ff       	call   800fb4 <sys_page_unmap>
+  80300d:	83 c4 10             	add    $0x10,%esp
+  803010:	89 d8                	mov    %ebx,%eax
+  803012:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803015:	5b                   	pop    %ebx
+  803016:	5e                   	pop    %esi
+  803017:	5d                   	pop    %ebp
+  803018:	c3                   	ret
+
+00803019 <pipeisclosed>:
+  803019:	55                   	push   %ebp
+  80301a:	89 e5                	mov    %esp,%ebp
+  80301c:	83 ec 20             	sub    $0x20,%esp
+  80301f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803022:	50                   	push   %eax
+  803023:	ff 75 08             	push   0x8(%ebp)
+  803026:	e8 cd ec ff ff       	call   801cf8 <fd_lookup>
+  80302b:	83 c4 10             	add    $0x10,%esp
+  80302e:	85 c0                	test   %eax,%eax
+  803030:	78 18                	js     80304a <pipeisclosed+0x31>
+  803032:	83 ec 0c             	sub    $0xc,%esp
+  803035:	ff 75 f4             	push   -0xc(%ebp)
+  803038:	e8 54 ec ff ff       	call   801c91 <fd2data>
+  80303d:	89 c2                	mov    %eax,%edx
+  80303f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803042:	e8 16 fd ff ff       	call   802d5d <_pipeisclosed>
+  803047:	83 c4 10             	add    $0x10,%esp
+  80304a:	c9                   	leave
+  80304b:	c3                   	ret
+
+0080304c <ipcring_init>:
+  80304c:	55                   	push   %ebp
+  80304d:	89 e5                	mov    %esp,%ebp
+  80304f:	53                   	push   %ebx
+  803050:	83 ec 08             	sub    $0x8,%esp
+  803053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803056:	6a 60                	push   $0x60
+  803058:	6a 00                	push   $0x0
+  80305a:	53                   	push   %ebx
+  80305b:	e8 9d db ff ff       	call   800bfd <memset>
+  803060:	a1 14 60 80 00       	mov    0x806014,%eax
+  803065:	8b 40 48             	mov    0x48(%eax),%eax
+  803068:	89 03                	mov    %eax,(%ebx)
+  80306a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80306d:	89 43 04             	mov    %eax,0x4(%ebx)
+  803070:	8b 45 10             	mov    0x10(%ebp),%eax
+  803073:	89 43 08             	mov    %eax,0x8(%ebx)
+  803076:	8b 45 14             	mov    0x14(%ebp),%eax
+  803079:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80307c:	83 c4 10             	add    $0x10,%esp
+  80307f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803082:	c9                   	leave
+  803083:	c3                   	ret
+
+00803084 <ipcring_req_slot>:
+  803084:	55                   	push   %ebp
+  803085:	89 e5                	mov    %esp,%ebp
+  803087:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308a:	8b 50 10             	mov    0x10(%eax),%edx
+  80308d:	8b 48 18             	mov    0x18(%eax),%ecx
+  803090:	29 ca                	sub    %ecx,%edx
+  803092:	83 fa 07             	cmp    $0x7,%edx
+  803095:	77 0c                	ja     8030a3 <ipcring_req_slot+0x1f>
+  803097:	8b 50 10             	mov    0x10(%eax),%edx
+  80309a:	83 e2 07             	and    $0x7,%edx
+  80309d:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  8030a1:	5d                   	pop    %ebp
+  8030a2:	c3                   	ret
+  8030a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a8:	eb f7                	jmp    8030a1 <ipcring_req_slot+0x1d>
+
+008030aa <ipcring_req_push>:
+  8030aa:	55                   	push   %ebp
+  8030ab:	89 e5                	mov    %esp,%ebp
+  8030ad:	83 ec 08             	sub    $0x8,%esp
+  8030b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030b3:	8b 42 10             	mov    0x10(%edx),%eax
+  8030b6:	83 c0 01             	add    $0x1,%eax
+  8030b9:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8030bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c2:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	75 02                	jne    8030cc <ipcring_req_push+0x22>
+  8030ca:	c9                   	leave
+  8030cb:	c3                   	ret
+  8030cc:	6a 00                	push   $0x0
+  8030ce:	68 00 00 80 ee       	push   $0xee800000
+  8030d3:	ff 72 08             	push   0x8(%edx)
+  8030d6:	ff 72 04             	push   0x4(%edx)
+  8030d9:	e8 3c e1 ff ff       	call   80121a <sys_ipc_send>
+  8030de:	83 c4 10             	add    $0x10,%esp
+  8030e1:	eb e7                	jmp    8030ca <ipcring_req_push+0x20>
+
+008030e3 <ipcring_rsp_wait>:
+  8030e3:	55                   	push   %ebp
+  8030e4:	89 e5                	mov    %esp,%ebp
+  8030e6:	53                   	push   %ebx
+  8030e7:	83 ec 04             	sub    $0x4,%esp
+  8030ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8030ed:	8b 53 18             	mov    0x18(%ebx),%edx
+  8030f0:	8b 43 10             	mov    0x10(%ebx),%eax
+  8030f3:	39 c2                	cmp    %eax,%edx
+  8030f5:	74 3c                	je     803133 <ipcring_rsp_wait+0x50>
+  8030f7:	8b 53 14             	mov    0x14(%ebx),%edx
+  8030fa:	8b 43 18             	mov    0x18(%ebx),%eax
+  8030fd:	39 c2                	cmp    %eax,%edx
+  8030ff:	75 23                	jne    803124 <ipcring_rsp_wait+0x41>
+  803101:	83 ec 08             	sub    $0x8,%esp
+  803104:	6a 00                	push   $0x0
+  803106:	6a 00                	push   $0x0
+  803108:	6a 00                	push   $0x0
+  80310a:	6a 00                	push   $0x0
+  80310c:	ff 73 0c             	push   0xc(%ebx)
+  80310f:	ff 73 04             	push   0x4(%ebx)
+  803112:	e8 24 04 00 00       	call   80353b <ipc_call>
+  803117:	8b 53 14             	mov    0x14(%ebx),%edx
+  80311a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80311d:	83 c4 20             	add    $0x20,%esp
+  803120:	39 c2                	cmp    %eax,%edx
+  803122:	74 dd                	je     803101 <ipcring_rsp_wait+0x1e>
+  803124:	8b 43 18             	mov    0x18(%ebx),%eax
+  803127:	83 e0 07             	and    $0x7,%eax
+  80312a:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  80312e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803131:	c9                   	leave
+  803132:	c3                   	ret
+  803133:	68 38 3f 80 00       	push   $0x803f38
+  803138:	68 f1 3e 80 00       	push   $0x803ef1
+  80313d:	6a 3b                	push   $0x3b
+  80313f:	68 59 3f 80 00       	push   $0x803f59
+  803144:	e8 67 d1 ff ff       	call   8002b0 <_panic>
+
+00803149 <ipcring_rsp_pop>:
+  803149:	55                   	push   %ebp
+  80314a:	89 e5                	mov    %esp,%ebp
+  80314c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80314f:	8b 42 18             	mov    0x18(%edx),%eax
+  803152:	83 c0 01             	add    $0x1,%eax
+  803155:	89 42 18             	mov    %eax,0x18(%edx)
+  803158:	5d                   	pop    %ebp
+  803159:	c3                   	ret
+
+0080315a <ipcring_server_init>:
+  80315a:	55                   	push   %ebp
+  80315b:	89 e5                	mov    %esp,%ebp
+  80315d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803160:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803163:	89 10                	mov    %edx,(%eax)
+  803165:	8b 55 10             	mov    0x10(%ebp),%edx
+  803168:	89 50 04             	mov    %edx,0x4(%eax)
+  80316b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803172:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803179:	5d                   	pop    %ebp
+  80317a:	c3                   	ret
+
+0080317b <ipcring_req_avail>:
+  80317b:	55                   	push   %ebp
+  80317c:	89 e5                	mov    %esp,%ebp
+  80317e:	8b 55 08             	mov    0x8(%ebp),%edx
+  803181:	8b 02                	mov    (%edx),%eax
+  803183:	8b 40 10             	mov    0x10(%eax),%eax
+  803186:	2b 42 08             	sub    0x8(%edx),%eax
+  803189:	ba 08 00 00 00       	mov    $0x8,%edx
+  80318e:	39 d0                	cmp    %edx,%eax
+  803190:	0f 47 c2             	cmova  %edx,%eax
+  803193:	5d                   	pop    %ebp
+  803194:	c3                   	ret
+
+00803195 <ipcring_req_peek>:
+  803195:	55                   	push   %ebp
+  803196:	89 e5                	mov    %esp,%ebp
+  803198:	8b 55 08             	mov    0x8(%ebp),%edx
+  80319b:	8b 42 08             	mov    0x8(%edx),%eax
+  80319e:	83 e0 07             	and    $0x7,%eax
+  8031a1:	8b 12                	mov    (%edx),%edx
+  8031a3:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8031a7:	5d                   	pop    %ebp
+  8031a8:	c3                   	ret
+
+008031a9 <ipcring_rsp_push>:
+  8031a9:	55                   	push   %ebp
+  8031aa:	89 e5                	mov    %esp,%ebp
+  8031ac:	83 ec 08             	sub    $0x8,%esp
+  8031af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031b2:	8b 41 08             	mov    0x8(%ecx),%eax
+  8031b5:	83 c0 01             	add    $0x1,%eax
+  8031b8:	89 41 08             	mov    %eax,0x8(%ecx)
+  8031bb:	8b 11                	mov    (%ecx),%edx
+  8031bd:	83 c2 14             	add    $0x14,%edx
+  8031c0:	f0 87 02             	lock xchg %eax,(%edx)
+  8031c3:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8031c7:	75 02                	jne    8031cb <ipcring_rsp_push+0x22>
+  8031c9:	c9                   	leave
+  8031ca:	c3                   	ret
+  8031cb:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8031d2:	6a 00                	push   $0x0
+  8031d4:	68 00 00 80 ee       	push   $0xee800000
+  8031d9:	6a 00                	push   $0x0
+  8031db:	ff 71 04             	push   0x4(%ecx)
+  8031de:	e8 5a df ff ff       	call   80113d <sys_ipc_try_send>
+  8031e3:	83 c4 10             	add    $0x10,%esp
+  8031e6:	eb e1                	jmp    8031c9 <ipcring_rsp_push+0x20>
+
+008031e8 <ipcring_client_wait>:
+  8031e8:	55                   	push   %ebp
+  8031e9:	89 e5                	mov    %esp,%ebp
+  8031eb:	83 ec 08             	sub    $0x8,%esp
+  8031ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f1:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8031f8:	8b 10                	mov    (%eax),%edx
+  8031fa:	8b 52 18             	mov    0x18(%edx),%edx
+  8031fd:	3b 50 08             	cmp    0x8(%eax),%edx
+  803200:	75 02                	jne    803204 <ipcring_client_wait+0x1c>
+  803202:	c9                   	leave
+  803203:	c3                   	ret
+  803204:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80320b:	6a 00                	push   $0x0
+  80320d:	68 00 00 80 ee       	push   $0xee800000
+  803212:	6a 00                	push   $0x0
+  803214:	ff 70 04             	push   0x4(%eax)
+  803217:	e8 21 df ff ff       	call   80113d <sys_ipc_try_send>
+  80321c:	83 c4 10             	add    $0x10,%esp
+  80321f:	eb e1                	jmp    803202 <ipcring_client_wait+0x1a>
+
+00803221 <ipcring_server_sleep>:
+  803221:	55                   	push   %ebp
+  803222:	89 e5                	mov    %esp,%ebp
+  803224:	53                   	push   %ebx
+  803225:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803228:	8b 01                	mov    (%ecx),%eax
+  80322a:	8d 50 1c             	lea    0x1c(%eax),%edx
+  80322d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803232:	f0 87 02             	lock xchg %eax,(%edx)
+  803235:	8b 11                	mov    (%ecx),%edx
+  803237:	8b 5a 10             	mov    0x10(%edx),%ebx
+  80323a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80323f:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803242:	74 0e                	je     803252 <ipcring_server_sleep+0x31>
+  803244:	b8 00 00 00 00       	mov    $0x0,%eax
+  803249:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80324d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803252:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803255:	c9                   	leave
+  803256:	c3                   	ret
+
+00803257 <devcons_close>:
+  803257:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325c:	c3                   	ret
+
+0080325d <devcons_stat>:
+  80325d:	55                   	push   %ebp
+  80325e:	89 e5                	mov    %esp,%ebp
+  803260:	83 ec 10             	sub    $0x10,%esp
+  803263:	68 67 3f 80 00       	push   $0x803f67
+  803268:	ff 75 0c             	push   0xc(%ebp)
+  80326b:	e8 12 d8 ff ff       	call   800a82 <strcpy>
+  803270:	b8 00 00 00 00       	mov    $0x0,%eax
+  803275:	c9                   	leave
+  803276:	c3                   	ret
+
+00803277 <devcons_write>:
+  803277:	55                   	push   %ebp
+  803278:	89 e5                	mov    %esp,%ebp
+  80327a:	57                   	push   %edi
+  80327b:	56                   	push   %esi
+  80327c:	53                   	push   %ebx
+  80327d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803283:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803286:	85 ff                	test   %edi,%edi
+  803288:	74 51                	je     8032db <devcons_write+0x64>
+  80328a:	be 00 00 00 00       	mov    $0x0,%esi
+  80328f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803294:	89 fb                	mov    %edi,%ebx
+  803296:	29 c3                	sub    %eax,%ebx
+  803298:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80329d:	39 d3                	cmp    %edx,%ebx
+  80329f:	0f 47 da             	cmova  %edx,%ebx
+  8032a2:	83 ec 04             	sub    $0x4,%esp
+  8032a5:	53                   	push   %ebx
+  8032a6:	03 45 0c             	add    0xc(%ebp),%eax
+  8032a9:	50                   	push   %eax
+  8032aa:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8032b0:	50                   	push   %eax
+  8032b1:	e8 7c d9 ff ff       	call   800c32 <memmove>
+  8032b6:	83 c4 08             	add    $0x8,%esp
+  8032b9:	53                   	push   %ebx
+  8032ba:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8032c0:	50                   	push   %eax
+  8032c1:	e8 34 db ff ff       	call   800dfa <sys_cputs>
+  8032c6:	01 de                	add    %ebx,%esi
+  8032c8:	89 f0                	mov    %esi,%eax
+  8032ca:	83 c4 10             	add    $0x10,%esp
+  8032cd:	39 fe                	cmp    %edi,%esi
+  8032cf:	72 c3                	jb     803294 <devcons_write+0x1d>
+  8032d1:	89 f0                	mov    %esi,%eax
+  8032d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032d6:	5b                   	pop    %ebx
+  8032d7:	5e                   	pop    %esi
+  8032d8:	5f                   	pop    %edi
+  8032d9:	5d                   	pop    %ebp
+  8032da:	c3                   	ret
+  8032db:	be 00 00 00 00       	mov    $0x0,%esi
+  8032e0:	eb ef                	jmp    8032d1 <devcons_write+0x5a>
+
+008032e2 <devcons_read>:
+  8032e2:	55                   	push   %ebp
+  8032e3:	89 e5                	mov    %esp,%ebp
+  8032e5:	83 ec 08             	sub    $0x8,%esp
+  8032e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ed:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032f1:	75 07                	jne    8032fa <devcons_read+0x18>
+  8032f3:	eb 1f                	jmp    803314 <devcons_read+0x32>
+  8032f5:	e8 9d db ff ff       	call   800e97 <sys_yield>
+  8032fa:	e8 19 db ff ff       	call   800e18 <sys_cgetc>
+  8032ff:	85 c0                	test   %eax,%eax
+  803301:	74 f2                	je     8032f5 <devcons_read+0x13>
+  803303:	78 0f                	js     803314 <devcons_read+0x32>
+  803305:	83 f8 04             	cmp    $0x4,%eax
+  803308:	74 0c                	je     803316 <devcons_read+0x34>
+  80330a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80330d:	88 02                	mov    %al,(%edx)
+  80330f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803314:	c9                   	leave
+  803315:	c3                   	ret
+  803316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331b:	eb f7                	jmp    803314 <devcons_read+0x32>
+
+0080331d <cputchar>:
+  80331d:	55                   	push   %ebp
+  80331e:	89 e5                	mov    %esp,%ebp
+  803320:	83 ec 20             	sub    $0x20,%esp
+  803323:	8b 45 08             	mov    0x8(%ebp),%eax
+  803326:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803329:	6a 01                	push   $0x1
+  80332b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80332e:	50                   	push   %eax
+  80332f:	e8 c6 da ff ff       	call   800dfa <sys_cputs>
+  803334:	83 c4 10             	add    $0x10,%esp
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+
+00803339 <getchar>:
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	83 ec 1c             	sub    $0x1c,%esp
+  80333f:	6a 01                	push   $0x1
+  803341:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803344:	50                   	push   %eax
+  803345:	6a 00                	push   $0x0
+  803347:	e8 0e ec ff ff       	call   801f5a <read>
+  80334c:	83 c4 10             	add    $0x10,%esp
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	78 06                	js     803359 <getchar+0x20>
+  803353:	74 06                	je     80335b <getchar+0x22>
+  803355:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803359:	c9                   	leave
+  80335a:	c3                   	ret
+  80335b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803360:	eb f7                	jmp    803359 <getchar+0x20>
+
+00803362 <iscons>:
+  803362:	55                   	push   %ebp
+  803363:	89 e5                	mov    %esp,%ebp
+  803365:	83 ec 20             	sub    $0x20,%esp
+  803368:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80336b:	50                   	push   %eax
+  80336c:	ff 75 08             	push   0x8(%ebp)
+  80336f:	e8 84 e9 ff ff       	call   801cf8 <fd_lookup>
+  803374:	83 c4 10             	add    $0x10,%esp
+  803377:	85 c0                	test   %eax,%eax
+  803379:	78 11                	js     80338c <iscons+0x2a>
+  80337b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80337e:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803384:	39 10                	cmp    %edx,(%eax)
+  803386:	0f 94 c0             	sete   %al
+  803389:	0f b6 c0             	movzbl %al,%eax
+  80338c:	c9                   	leave
+  80338d:	c3                   	ret
+
+0080338e <opencons>:
+  80338e:	55                   	push   %ebp
+  80338f:	89 e5                	mov    %esp,%ebp
+  803391:	83 ec 24             	sub    $0x24,%esp
+  803394:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803397:	50                   	push   %eax
+  803398:	e8 0b e9 ff ff       	call   801ca8 <fd_alloc>
+  80339d:	83 c4 10             	add    $0x10,%esp
+  8033a0:	85 c0                	test   %eax,%eax
+  8033a2:	78 3a                	js     8033de <opencons+0x50>
+  8033a4:	83 ec 04             	sub    $0x4,%esp
+  8033a7:	68 07 04 00 00       	push   $0x407
+  8033ac:	ff 75 f4             	push   -0xc(%ebp)
+  8033af:	6a 00                	push   $0x0
+  8033b1:	e8 2c db ff ff       	call   800ee2 <sys_page_alloc>
+  8033b6:	83 c4 10             	add    $0x10,%esp
+  8033b9:	85 c0                	test   %eax,%eax
+  8033bb:	78 21                	js     8033de <opencons+0x50>
+  8033bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033c0:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  8033c6:	89 10                	mov    %edx,(%eax)
+  8033c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033cb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8033d2:	83 ec 0c             	sub    $0xc,%esp
+  8033d5:	50                   	push   %eax
+  8033d6:	e8 a6 e8 ff ff       	call   801c81 <fd2num>
+  8033db:	83 c4 10             	add    $0x10,%esp
+  8033de:	c9                   	leave
+  8033df:	c3                   	ret
+
+008033e0 <set_pgfault_handler>:
+  8033e0:	55                   	push   %ebp
+  8033e1:	89 e5                	mov    %esp,%ebp
+  8033e3:	53                   	push   %ebx
+  8033e4:	83 ec 04             	sub    $0x4,%esp
+  8033e7:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8033ee:	74 0d                	je     8033fd <set_pgfault_handler+0x1d>
+  8033f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f3:	a3 00 90 80 00       	mov    %eax,0x809000
+  8033f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033fb:	c9                   	leave
+  8033fc:	c3                   	ret
+  8033fd:	e8 76 da ff ff       	call   800e78 <sys_getenvid>
+  803402:	89 c3                	mov    %eax,%ebx
+  803404:	83 ec 04             	sub    $0x4,%esp
+  803407:	6a 07                	push   $0x7
+  803409:	68 00 f0 7f ee       	push   $0xee7ff000
+  80340e:	50                   	push   %eax
+  80340f:	e8 ce da ff ff       	call   800ee2 <sys_page_alloc>
+  803414:	83 c4 10             	add    $0x10,%esp
+  803417:	85 c0                	test   %eax,%eax
+  803419:	78 29                	js     803444 <set_pgfault_handler+0x64>
+  80341b:	83 ec 08             	sub    $0x8,%esp
+  80341e:	68 58 34 80 00       	push   $0x803458
+  803423:	53                   	push   %ebx
+  803424:	e8 d2 dc ff ff       	call   8010fb <sys_env_set_pgfault_upcall>
+  803429:	83 c4 10             	add    $0x10,%esp
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	79 c0                	jns    8033f0 <set_pgfault_handler+0x10>
+  803430:	83 ec 04             	sub    $0x4,%esp
+  803433:	68 ac 3f 80 00       	push   $0x803fac
+  803438:	6a 27                	push   $0x27
+  80343a:	68 de 3f 80 00       	push   $0x803fde
+  80343f:	e8 6c ce ff ff       	call   8002b0 <_panic>
+  803444:	83 ec 04             	sub    $0x4,%esp
+  803447:	68 74 3f 80 00       	push   $0x803f74
+  80344c:	6a 23                	push   $0x23
+  80344e:	68 de 3f 80 00       	push   $0x803fde
+  803453:	e8 58 ce ff ff       	call   8002b0 <_panic>
+
+00803458 <_pgfault_upcall>:
+  803458:	54                   	push   %esp
+  803459:	a1 00 90 80 00       	mov    0x809000,%eax
+  80345e:	ff d0                	call   *%eax
+  803460:	83 c4 04             	add    $0x4,%esp
+  803463:	89 e3                	mov    %esp,%ebx
+  803465:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803469:	8b 54 24 30          	mov    0x30(%esp),%edx
+  80346d:	89 d4                	mov    %edx,%esp
+  80346f:	51                   	push   %ecx
+  803470:	89 dc                	mov    %ebx,%esp
+  803472:	83 ea 04             	sub    $0x4,%edx
+  803475:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803479:	83 c4 08             	add    $0x8,%esp
+  80347c:	61                   	popa
+  80347d:	83 c4 04             	add    $0x4,%esp
+  803480:	9d                   	popf
+  803481:	5c                   	pop    %esp
+  803482:	c3                   	ret
+
+00803483 <ipc_recv>:
+  803483:	55                   	push   %ebp
+  803484:	89 e5                	mov    %esp,%ebp
+  803486:	56                   	push   %esi
+  803487:	53                   	push   %ebx
+  803488:	8b 75 08             	mov    0x8(%ebp),%esi
+  80348b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80348e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803491:	85 c0                	test   %eax,%eax
+  803493:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803498:	0f 44 c2             	cmove  %edx,%eax
+  80349b:	83 ec 0c             	sub    $0xc,%esp
+  80349e:	50                   	push   %eax
+  80349f:	e8 e9 dc ff ff       	call   80118d <sys_ipc_recv>
+  8034a4:	83 c4 10             	add    $0x10,%esp
+  8034a7:	85 c0                	test   %eax,%eax
+  8034a9:	78 2a                	js     8034d5 <ipc_recv+0x52>
+  8034ab:	a1 14 60 80 00       	mov    0x806014,%eax
+  8034b0:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8034b6:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8034bc:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8034c2:	85 f6                	test   %esi,%esi
+  8034c4:	74 02                	je     8034c8 <ipc_recv+0x45>
+  8034c6:	89 0e                	mov    %ecx,(%esi)
+  8034c8:	85 db                	test   %ebx,%ebx
+  8034ca:	74 02                	je     8034ce <ipc_recv+0x4b>
+  8034cc:	89 13                	mov    %edx,(%ebx)
+  8034ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034d1:	5b                   	pop    %ebx
+  8034d2:	5e                   	pop    %esi
+  8034d3:	5d                   	pop    %ebp
+  8034d4:	c3                   	ret
+  8034d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034df:	eb e1                	jmp    8034c2 <ipc_recv+0x3f>
+
+008034e1 <ipc_send>:
+  8034e1:	55                   	push   %ebp
+  8034e2:	89 e5                	mov    %esp,%ebp
+  8034e4:	57                   	push   %edi
+  8034e5:	56                   	push   %esi
+  8034e6:	53                   	push   %ebx
+  8034e7:	83 ec 0c             	sub    $0xc,%esp
+  8034ea:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8034ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034f0:	8b 75 14             	mov    0x14(%ebp),%esi
+  8034f3:	85 db                	test   %ebx,%ebx
+  8034f5:	74 1e                	je     803515 <ipc_send+0x34>
+  8034f7:	56                   	push   %esi
+  8034f8:	53                   	push   %ebx
+  8034f9:	57                   	push   %edi
+  8034fa:	ff 75 08             	push   0x8(%ebp)
+  8034fd:	e8 18 dd ff ff       	call   80121a <sys_ipc_send>
+  803502:	83 c4 10             	add    $0x10,%esp
+  803505:	85 c0                	test   %eax,%eax
+  803507:	74 2a                	je     803533 <ipc_send+0x52>
+  803509:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80350c:	75 13                	jne    803521 <ipc_send+0x40>
+  80350e:	e8 84 d9 ff ff       	call   800e97 <sys_yield>
+  803513:	eb e2                	jmp    8034f7 <ipc_send+0x16>
+  803515:	be 00 00 00 00       	mov    $0x0,%esi
+  80351a:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80351f:	eb d6                	jmp    8034f7 <ipc_send+0x16>
+  803521:	50                   	push   %eax
+  803522:	68 ec 3f 80 00       	push   $0x803fec
+  803527:	6a 4f                	push   $0x4f
+  803529:	68 2f 40 80 00       	push   $0x80402f
+  80352e:	e8 7d cd ff ff       	call   8002b0 <_panic>
+  803533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803536:	5b                   	pop    %ebx
+  803537:	5e                   	pop    %esi
+  803538:	5f                   	pop    %edi
+  803539:	5d                   	pop    %ebp
+  80353a:	c3                   	ret
+
+0080353b <ipc_call>:
+  80353b:	55                   	push   %ebp
+  80353c:	89 e5                	mov    %esp,%ebp
+  80353e:	57                   	push   %edi
+  80353f:	56                   	push   %esi
+  803540:	53                   	push   %ebx
+  803541:	83 ec 0c             	sub    $0xc,%esp
+  803544:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803548:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  80354d:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803551:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803555:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  80355a:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80355e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803567:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  80356b:	eb 05                	jmp    803572 <ipc_call+0x37>
+  80356d:	e8 25 d9 ff ff       	call   800e97 <sys_yield>
+  803572:	83 ec 0c             	sub    $0xc,%esp
+  803575:	56                   	push   %esi
+  803576:	53                   	push   %ebx
+  803577:	57                   	push   %edi
+  803578:	ff 75 0c             	push   0xc(%ebp)
+  80357b:	ff 75 08             	push   0x8(%ebp)
+  80357e:	e8 e7 dc ff ff       	call   80126a <sys_ipc_call>
+  803583:	83 c4 20             	add    $0x20,%esp
+  803586:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803589:	74 e2                	je     80356d <ipc_call+0x32>
+  80358b:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80358e:	74 2d                	je     8035bd <ipc_call+0x82>
+  803590:	85 c0                	test   %eax,%eax
+  803592:	78 4f                	js     8035e3 <ipc_call+0xa8>
+  803594:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803598:	74 10                	je     8035aa <ipc_call+0x6f>
+  80359a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80359f:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8035a5:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8035a8:	89 02                	mov    %eax,(%edx)
+  8035aa:	a1 14 60 80 00       	mov    0x806014,%eax
+  8035af:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8035b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035b8:	5b                   	pop    %ebx
+  8035b9:	5e                   	pop    %esi
+  8035ba:	5f                   	pop    %edi
+  8035bb:	5d                   	pop    %ebp
+  8035bc:	c3                   	ret
+  8035bd:	ff 75 14             	push   0x14(%ebp)
+  8035c0:	ff 75 10             	push   0x10(%ebp)
+  8035c3:	ff 75 0c             	push   0xc(%ebp)
+  8035c6:	ff 75 08             	push   0x8(%ebp)
+  8035c9:	e8 13 ff ff ff       	call   8034e1 <ipc_send>
+  8035ce:	83 c4 0c             	add    $0xc,%esp
+  8035d1:	ff 75 1c             	push   0x1c(%ebp)
+  8035d4:	ff 75 18             	push   0x18(%ebp)
+  8035d7:	6a 00                	push   $0x0
+  8035d9:	e8 a5 fe ff ff       	call   803483 <ipc_recv>
+  8035de:	83 c4 10             	add    $0x10,%esp
+  8035e1:	eb d2                	jmp    8035b5 <ipc_call+0x7a>
+  8035e3:	50                   	push   %eax
+  8035e4:	68 39 40 80 00       	push   $0x804039
+  8035e9:	6a 6d                	push   $0x6d
+  8035eb:	68 2f 40 80 00       	push   $0x80402f
+  8035f0:	e8 bb cc ff ff       	call   8002b0 <_panic>
+
+008035f5 <ipc_reply_recv>:
+  8035f5:	55                   	push   %ebp
+  8035f6:	89 e5                	mov    %esp,%ebp
+  8035f8:	57                   	push   %edi
+  8035f9:	56                   	push   %esi
+  8035fa:	53                   	push   %ebx
+  8035fb:	83 ec 0c             	sub    $0xc,%esp
+  8035fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803601:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803604:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803607:	85 db                	test   %ebx,%ebx
+  803609:	0f 84 ac 00 00 00    	je     8036bb <ipc_reply_recv+0xc6>
+  80360f:	85 f6                	test   %esi,%esi
+  803611:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803616:	0f 45 c6             	cmovne %esi,%eax
+  803619:	83 ec 0c             	sub    $0xc,%esp
+  80361c:	50                   	push   %eax
+  80361d:	ff 75 14             	push   0x14(%ebp)
+  803620:	53                   	push   %ebx
+  803621:	ff 75 0c             	push   0xc(%ebp)
+  803624:	ff 75 08             	push   0x8(%ebp)
+  803627:	e8 5f dc ff ff       	call   80128b <sys_ipc_reply_recv>
+  80362c:	83 c4 20             	add    $0x20,%esp
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	78 3a                	js     80366d <ipc_reply_recv+0x78>
+  803633:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803637:	74 10                	je     803649 <ipc_reply_recv+0x54>
+  803639:	a1 14 60 80 00       	mov    0x806014,%eax
+  80363e:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803644:	8b 55 18             	mov    0x18(%ebp),%edx
+  803647:	89 02                	mov    %eax,(%edx)
+  803649:	85 ff                	test   %edi,%edi
+  80364b:	74 0d                	je     80365a <ipc_reply_recv+0x65>
+  80364d:	a1 14 60 80 00       	mov    0x806014,%eax
+  803652:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803658:	89 07                	mov    %eax,(%edi)
+  80365a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80365f:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803665:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803668:	5b                   	pop    %ebx
+  803669:	5e                   	pop    %esi
+  80366a:	5f                   	pop    %edi
+  80366b:	5d                   	pop    %ebp
+  80366c:	c3                   	ret
+  80366d:	ff 75 14             	push   0x14(%ebp)
+  803670:	53                   	push   %ebx
+  803671:	ff 75 0c             	push   0xc(%ebp)
+  803674:	ff 75 08             	push   0x8(%ebp)
+  803677:	e8 c1 da ff ff       	call   80113d <sys_ipc_try_send>
+  80367c:	89 c2                	mov    %eax,%edx
+  80367e:	c1 ea 1f             	shr    $0x1f,%edx
+  803681:	83 c4 10             	add    $0x10,%esp
+  803684:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803687:	0f 95 c1             	setne  %cl
+  80368a:	84 d1                	test   %dl,%cl
+  80368c:	74 05                	je     803693 <ipc_reply_recv+0x9e>
+  80368e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803691:	75 12                	jne    8036a5 <ipc_reply_recv+0xb0>
+  803693:	83 ec 04             	sub    $0x4,%esp
+  803696:	57                   	push   %edi
+  803697:	56                   	push   %esi
+  803698:	ff 75 18             	push   0x18(%ebp)
+  80369b:	e8 e3 fd ff ff       	call   803483 <ipc_recv>
+  8036a0:	83 c4 10             	add    $0x10,%esp
+  8036a3:	eb c0                	jmp    803665 <ipc_reply_recv+0x70>
+  8036a5:	83 ec 04             	sub    $0x4,%esp
+  8036a8:	50                   	push   %eax
+  8036a9:	ff 75 08             	push   0x8(%ebp)
+  8036ac:	68 0c 40 80 00       	push   $0x80400c
+  8036b1:	e8 d5 cc ff ff       	call   80038b <cprintf>
+  8036b6:	83 c4 10             	add    $0x10,%esp
+  8036b9:	eb d8                	jmp    803693 <ipc_reply_recv+0x9e>
+  8036bb:	85 f6                	test   %esi,%esi
+  8036bd:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8036c2:	0f 45 c6             	cmovne %esi,%eax
+  8036c5:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8036ca:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8036d1:	e9 43 ff ff ff       	jmp    803619 <ipc_reply_recv+0x24>
+
+008036d6 <ipc_find_env>:
+  8036d6:	55                   	push   %ebp
+  8036d7:	89 e5                	mov    %esp,%ebp
+  8036d9:	83 ec 14             	sub    $0x14,%esp
+  8036dc:	ff 75 08             	push   0x8(%ebp)
+  8036df:	e8 f7 d9 ff ff       	call   8010db <sys_env_service>
+  8036e4:	85 c0                	test   %eax,%eax
+  8036e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036eb:	0f 48 c2             	cmovs  %edx,%eax
+  8036ee:	c9                   	leave
+  8036ef:	c3                   	ret
+
+008036f0 <pageref>:
+  8036f0:	55                   	push   %ebp
+  8036f1:	89 e5                	mov    %esp,%ebp
+  8036f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036f6:	89 c2                	mov    %eax,%edx
+  8036f8:	c1 ea 16             	shr    $0x16,%edx
+  8036fb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803702:	ba 00 00 00 00       	mov    $0x0,%edx
+  803707:	f6 c1 01             	test   $0x1,%cl
+  80370a:	74 22                	je     80372e <pageref+0x3e>
+  80370c:	c1 e8 0c             	shr    $0xc,%eax
+  80370f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803716:	a8 01                	test   $0x1,%al
+  803718:	74 14                	je     80372e <pageref+0x3e>
+  80371a:	c1 e8 0c             	shr    $0xc,%eax
+  80371d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803720:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803727:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80372b:	0f b7 d2             	movzwl %dx,%edx
+  80372e:	89 d0                	mov    %edx,%eax
+  803730:	5d                   	pop    %ebp
+  803731:	c3                   	ret
+
+00803732 <__udivmoddi4>:
+  803732:	55                   	push   %ebp
+  803733:	57                   	push   %edi
+  803734:	56                   	push   %esi
+  803735:	53                   	push   %ebx
+  803736:	83 ec 24             	sub    $0x24,%esp
+  803739:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80373d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803741:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803745:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803749:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80374d:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803751:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803755:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803759:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80375d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803762:	ba 00 00 00 00       	mov    $0x0,%edx
+  803767:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80376c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803773:	00 
+  803774:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80377b:	00 
+  80377c:	89 fb                	mov    %edi,%ebx
+  80377e:	eb 08                	jmp    803788 <__udivmoddi4+0x56>
+  803780:	83 e9 01             	sub    $0x1,%ecx
+  803783:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803786:	74 68                	je     8037f0 <__udivmoddi4+0xbe>
+  803788:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80378c:	01 c0                	add    %eax,%eax
+  80378e:	89 c6                	mov    %eax,%esi
+  803790:	89 d7                	mov    %edx,%edi
+  803792:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803796:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80379a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80379d:	d3 ea                	shr    %cl,%edx
+  80379f:	f6 c1 20             	test   $0x20,%cl
+  8037a2:	74 04                	je     8037a8 <__udivmoddi4+0x76>
+  8037a4:	89 d0                	mov    %edx,%eax
+  8037a6:	31 d2                	xor    %edx,%edx
+  8037a8:	83 e0 01             	and    $0x1,%eax
+  8037ab:	89 04 24             	mov    %eax,(%esp)
+  8037ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8037b5:	00 
+  8037b6:	8b 04 24             	mov    (%esp),%eax
+  8037b9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8037bd:	09 f0                	or     %esi,%eax
+  8037bf:	09 fa                	or     %edi,%edx
+  8037c1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8037c5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8037c9:	39 f0                	cmp    %esi,%eax
+  8037cb:	89 d5                	mov    %edx,%ebp
+  8037cd:	19 fd                	sbb    %edi,%ebp
+  8037cf:	72 af                	jb     803780 <__udivmoddi4+0x4e>
+  8037d1:	29 f0                	sub    %esi,%eax
+  8037d3:	19 fa                	sbb    %edi,%edx
+  8037d5:	89 cf                	mov    %ecx,%edi
+  8037d7:	c1 ef 05             	shr    $0x5,%edi
+  8037da:	83 e7 01             	and    $0x1,%edi
+  8037dd:	89 fe                	mov    %edi,%esi
+  8037df:	83 f6 01             	xor    $0x1,%esi
+  8037e2:	d3 e6                	shl    %cl,%esi
+  8037e4:	d3 e7                	shl    %cl,%edi
+  8037e6:	09 74 24 18          	or     %esi,0x18(%esp)
+  8037ea:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8037ee:	eb 90                	jmp    803780 <__udivmoddi4+0x4e>
+  8037f0:	85 db                	test   %ebx,%ebx
+  8037f2:	74 05                	je     8037f9 <__udivmoddi4+0xc7>
+  8037f4:	89 03                	mov    %eax,(%ebx)
+  8037f6:	89 53 04             	mov    %edx,0x4(%ebx)
+  8037f9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037fd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803801:	83 c4 24             	add    $0x24,%esp
+  803804:	5b                   	pop    %ebx
+  803805:	5e                   	pop    %esi
+  803806:	5f                   	pop    %edi
+  803807:	5d                   	pop    %ebp
+  803808:	c3                   	ret
+
+00803809 <__udivdi3>:
+  803809:	83 ec 08             	sub    $0x8,%esp
+  80380c:	6a 00                	push   $0x0
+  80380e:	ff 74 24 1c          	push   0x1c(%esp)
+  803812:	ff 74 24 1c          	push   0x1c(%esp)
+  803816:	ff 74 24 1c          	push   0x1c(%esp)
+  80381a:	ff 74 24 1c          	push   0x1c(%esp)
+  80381e:	e8 0f ff ff ff       	call   803732 <__udivmoddi4>
+  803823:	83 c4 1c             	add    $0x1c,%esp
+  803826:	c3                   	ret
+
+00803827 <__umoddi3>:
+  803827:	83 ec 18             	sub    $0x18,%esp
+  80382a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80382e:	50                   	push   %eax
+  80382f:	ff 74 24 2c          	push   0x2c(%esp)
+  803833:	ff 74 24 2c          	push   0x2c(%esp)
+  803837:	ff 74 24 2c          	push   0x2c(%esp)
+  80383b:	ff 74 24 2c          	push   0x2c(%esp)
+  80383f:	e8 ee fe ff ff       	call   803732 <__udivmoddi4>
+  803844:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803848:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80384c:	83 c4 2c             	add    $0x2c,%esp
+  80384f:	c3                   	ret
+
+00803850 <__divdi3>:
+  803850:	53                   	push   %ebx
+  803851:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803855:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803859:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80385d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803861:	85 d2                	test   %edx,%edx
+  803863:	78 12                	js     803877 <__divdi3+0x27>
+  803865:	85 db                	test   %ebx,%ebx
+  803867:	78 2e                	js     803897 <__divdi3+0x47>
+  803869:	53                   	push   %ebx
+  80386a:	51                   	push   %ecx
+  80386b:	52                   	push   %edx
+  80386c:	50                   	push   %eax
+  80386d:	e8 97 ff ff ff       	call   803809 <__udivdi3>
+  803872:	83 c4 10             	add    $0x10,%esp
+  803875:	eb 1e                	jmp    803895 <__divdi3+0x45>
+  803877:	f7 d8                	neg    %eax
+  803879:	83 d2 00             	adc    $0x0,%edx
+  80387c:	f7 da                	neg    %edx
+  80387e:	85 db                	test   %ebx,%ebx
+  803880:	78 2a                	js     8038ac <__divdi3+0x5c>
+  803882:	53                   	push   %ebx
+  803883:	51                   	push   %ecx
+  803884:	52                   	push   %edx
+  803885:	50                   	push   %eax
+  803886:	e8 7e ff ff ff       	call   803809 <__udivdi3>
+  80388b:	83 c4 10             	add    $0x10,%esp
+  80388e:	f7 d8                	neg    %eax
+  803890:	83 d2 00             	adc    $0x0,%edx
+  803893:	f7 da                	neg    %edx
+  803895:	5b                   	pop    %ebx
+  803896:	c3                   	ret
+  803897:	f7 d9                	neg    %ecx
+  803899:	83 d3 00             	adc    $0x0,%ebx
+  80389c:	f7 db                	neg    %ebx
+  80389e:	53                   	push   %ebx
+  80389f:	51                   	push   %ecx
+  8038a0:	52                   	push   %edx
+  8038a1:	50                   	push   %eax
+  8038a2:	e8 62 ff ff ff       	call   803809 <__udivdi3>
+  8038a7:	83 c4 10             	add    $0x10,%esp
+  8038aa:	eb e2                	jmp    80388e <__divdi3+0x3e>
+  8038ac:	f7 d9                	neg    %ecx
+  8038ae:	83 d3 00             	adc    $0x0,%ebx
+  8038b1:	f7 db                	neg    %ebx
+  8038b3:	53                   	push   %ebx
+  8038b4:	51                   	push   %ecx
+  8038b5:	52                   	push   %edx
+  8038b6:	50                   	push   %eax
+  8038b7:	e8 4d ff ff ff       	call   803809 <__udivdi3>
+  8038bc:	83 c4 10             	add    $0x10,%esp
+  8038bf:	eb d4                	jmp    803895 <__divdi3+0x45>
+
+008038c1 <__moddi3>:
+  8038c1:	55                   	push   %ebp
+  8038c2:	57                   	push   %edi
+  8038c3:	56                   	push   %esi
+  8038c4:	53                   	push   %ebx
+  8038c5:	83 ec 0c             	sub    $0xc,%esp
+  8038c8:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8038cc:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8038d0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038d4:	89 e9                	mov    %ebp,%ecx
+  8038d6:	f7 d9                	neg    %ecx
+  8038d8:	89 d0                	mov    %edx,%eax
+  8038da:	83 d0 00             	adc    $0x0,%eax
+  8038dd:	f7 d8                	neg    %eax
+  8038df:	0f 49 e9             	cmovns %ecx,%ebp
+  8038e2:	0f 49 d0             	cmovns %eax,%edx
+  8038e5:	52                   	push   %edx
+  8038e6:	55                   	push   %ebp
+  8038e7:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8038eb:	f7 da                	neg    %edx
+  8038ed:	89 d8                	mov    %ebx,%eax
+  8038ef:	83 d0 00             	adc    $0x0,%eax
+  8038f2:	f7 d8                	neg    %eax
+  8038f4:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8038f9:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8038fd:	0f 48 c3             	cmovs  %ebx,%eax
+  803900:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803904:	ff 74 24 0c          	push   0xc(%esp)
+  803908:	ff 74 24 0c          	push   0xc(%esp)
+  80390c:	e8 16 ff ff ff       	call   803827 <__umoddi3>
+  803911:	83 c4 10             	add    $0x10,%esp
+  803914:	85 db                	test   %ebx,%ebx
+  803916:	78 08                	js     803920 <__moddi3+0x5f>
+  803918:	83 c4 0c             	add    $0xc,%esp
+  80391b:	5b                   	pop    %ebx
+  80391c:	5e                   	pop    %esi
+  80391d:	5f                   	pop    %edi
+  80391e:	5d                   	pop    %ebp
+  80391f:	c3                   	ret
+  803920:	f7 d8                	neg    %eax
+  803922:	83 d2 00             	adc    $0x0,%edx
+  803925:	f7 da                	neg    %edx
+  803927:	eb ef                	jmp    803918 <__moddi3+0x57>
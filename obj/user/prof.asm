@@ -0,0 +1,5262 @@
+
+obj/user/prof.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 89 01 00 00       	call   8001ba <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800042:	c7 05 00 40 80 00 00 	movl   $0x803400,0x804000
+  800049:	34 80 00 
+  80004c:	bb 14 00 00 00       	mov    $0x14,%ebx
+  800051:	83 fe 01             	cmp    $0x1,%esi
+  800054:	7f 6b                	jg     8000c1 <umain+0x8e>
+  800056:	83 ec 04             	sub    $0x4,%esp
+  800059:	68 20 50 80 00       	push   $0x805020
+  80005e:	b8 40 00 00 00       	mov    $0x40,%eax
+  800063:	39 c3                	cmp    %eax,%ebx
+  800065:	0f 4f d8             	cmovg  %eax,%ebx
+  800068:	53                   	push   %ebx
+  800069:	6a 03                	push   $0x3
+  80006b:	e8 41 16 00 00       	call   8016b1 <sys_prof>
+  800070:	89 c7                	mov    %eax,%edi
+  800072:	83 c4 10             	add    $0x10,%esp
+  800075:	85 c0                	test   %eax,%eax
+  800077:	0f 88 2b 01 00 00    	js     8001a8 <umain+0x175>
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	68 74 34 80 00       	push   $0x803474
+  800085:	e8 50 23 00 00       	call   8023da <printf>
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 ff                	test   %edi,%edi
+  80008f:	7e 28                	jle    8000b9 <umain+0x86>
+  800091:	bb 2c 50 80 00       	mov    $0x80502c,%ebx
+  800096:	be 00 00 00 00       	mov    $0x0,%esi
+  80009b:	53                   	push   %ebx
+  80009c:	ff 73 f4             	push   -0xc(%ebx)
+  80009f:	ff 73 fc             	push   -0x4(%ebx)
+  8000a2:	68 25 34 80 00       	push   $0x803425
+  8000a7:	e8 2e 23 00 00       	call   8023da <printf>
+  8000ac:	83 c6 01             	add    $0x1,%esi
+  8000af:	83 c3 2c             	add    $0x2c,%ebx
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	39 f7                	cmp    %esi,%edi
+  8000b7:	75 e2                	jne    80009b <umain+0x68>
+  8000b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5f                   	pop    %edi
+  8000bf:	5d                   	pop    %ebp
+  8000c0:	c3                   	ret
+  8000c1:	83 ec 08             	sub    $0x8,%esp
+  8000c4:	68 05 34 80 00       	push   $0x803405
+  8000c9:	ff 77 04             	push   0x4(%edi)
+  8000cc:	e8 e4 09 00 00       	call   800ab5 <strcmp>
+  8000d1:	83 c4 10             	add    $0x10,%esp
+  8000d4:	85 c0                	test   %eax,%eax
+  8000d6:	75 40                	jne    800118 <umain+0xe5>
+  8000d8:	83 fe 02             	cmp    $0x2,%esi
+  8000db:	7f 27                	jg     800104 <umain+0xd1>
+  8000dd:	83 ec 04             	sub    $0x4,%esp
+  8000e0:	6a 00                	push   $0x0
+  8000e2:	50                   	push   %eax
+  8000e3:	6a 00                	push   $0x0
+  8000e5:	e8 c7 15 00 00       	call   8016b1 <sys_prof>
+  8000ea:	83 c4 10             	add    $0x10,%esp
+  8000ed:	85 c0                	test   %eax,%eax
+  8000ef:	79 c8                	jns    8000b9 <umain+0x86>
+  8000f1:	83 ec 08             	sub    $0x8,%esp
+  8000f4:	50                   	push   %eax
+  8000f5:	68 36 34 80 00       	push   $0x803436
+  8000fa:	e8 db 22 00 00       	call   8023da <printf>
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	eb b5                	jmp    8000b9 <umain+0x86>
+  800104:	83 ec 04             	sub    $0x4,%esp
+  800107:	6a 00                	push   $0x0
+  800109:	6a 00                	push   $0x0
+  80010b:	ff 77 08             	push   0x8(%edi)
+  80010e:	e8 85 0b 00 00       	call   800c98 <strtol>
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	eb c5                	jmp    8000dd <umain+0xaa>
+  800118:	83 ec 08             	sub    $0x8,%esp
+  80011b:	68 08 34 80 00       	push   $0x803408
+  800120:	ff 77 04             	push   0x4(%edi)
+  800123:	e8 8d 09 00 00       	call   800ab5 <strcmp>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	85 c0                	test   %eax,%eax
+  80012d:	74 4d                	je     80017c <umain+0x149>
+  80012f:	83 ec 08             	sub    $0x8,%esp
+  800132:	68 40 34 80 00       	push   $0x803440
+  800137:	ff 77 04             	push   0x4(%edi)
+  80013a:	e8 76 09 00 00       	call   800ab5 <strcmp>
+  80013f:	83 c4 10             	add    $0x10,%esp
+  800142:	85 c0                	test   %eax,%eax
+  800144:	74 4c                	je     800192 <umain+0x15f>
+  800146:	83 ec 04             	sub    $0x4,%esp
+  800149:	6a 00                	push   $0x0
+  80014b:	6a 00                	push   $0x0
+  80014d:	ff 77 04             	push   0x4(%edi)
+  800150:	e8 43 0b 00 00       	call   800c98 <strtol>
+  800155:	89 c3                	mov    %eax,%ebx
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	85 c0                	test   %eax,%eax
+  80015c:	0f 8f f4 fe ff ff    	jg     800056 <umain+0x23>
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	68 48 34 80 00       	push   $0x803448
+  80016a:	e8 6b 22 00 00       	call   8023da <printf>
+  80016f:	e8 8f 00 00 00       	call   800203 <exit>
+  800174:	83 c4 10             	add    $0x10,%esp
+  800177:	e9 da fe ff ff       	jmp    800056 <umain+0x23>
+  80017c:	83 ec 04             	sub    $0x4,%esp
+  80017f:	6a 00                	push   $0x0
+  800181:	6a 00                	push   $0x0
+  800183:	6a 01                	push   $0x1
+  800185:	e8 27 15 00 00       	call   8016b1 <sys_prof>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	e9 5b ff ff ff       	jmp    8000ed <umain+0xba>
+  800192:	83 ec 04             	sub    $0x4,%esp
+  800195:	6a 00                	push   $0x0
+  800197:	6a 00                	push   $0x0
+  800199:	6a 02                	push   $0x2
+  80019b:	e8 11 15 00 00       	call   8016b1 <sys_prof>
+  8001a0:	83 c4 10             	add    $0x10,%esp
+  8001a3:	e9 45 ff ff ff       	jmp    8000ed <umain+0xba>
+  8001a8:	50                   	push   %eax
+  8001a9:	68 0c 34 80 00       	push   $0x80340c
+  8001ae:	6a 26                	push   $0x26
+  8001b0:	68 19 34 80 00       	push   $0x803419
+  8001b5:	e8 79 00 00 00       	call   800233 <_panic>
+
+008001ba <libmain>:
+  8001ba:	55                   	push   %ebp
+  8001bb:	89 e5                	mov    %esp,%ebp
+  8001bd:	56                   	push   %esi
+  8001be:	53                   	push   %ebx
+  8001bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001c2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001c5:	e8 31 0c 00 00       	call   800dfb <sys_getenvid>
+  8001ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001cf:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8001d5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001da:	a3 20 5b 80 00       	mov    %eax,0x805b20
+  8001df:	85 db                	test   %ebx,%ebx
+  8001e1:	7e 07                	jle    8001ea <libmain+0x30>
+  8001e3:	8b 06                	mov    (%esi),%eax
+  8001e5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8001ea:	83 ec 08             	sub    $0x8,%esp
+  8001ed:	56                   	push   %esi
+  8001ee:	53                   	push   %ebx
+  8001ef:	e8 3f fe ff ff       	call   800033 <umain>
+  8001f4:	e8 0a 00 00 00       	call   800203 <exit>
+  8001f9:	83 c4 10             	add    $0x10,%esp
+  8001fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ff:	5b                   	pop    %ebx
+  800200:	5e                   	pop    %esi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+
+00800203 <exit>:
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	83 ec 08             	sub    $0x8,%esp
+  800209:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  80020e:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800214:	85 c0                	test   %eax,%eax
+  800216:	75 14                	jne    80022c <exit+0x29>
+  800218:	e8 80 16 00 00       	call   80189d <close_all>
+  80021d:	83 ec 0c             	sub    $0xc,%esp
+  800220:	6a 00                	push   $0x0
+  800222:	e8 93 0b 00 00       	call   800dba <sys_env_destroy>
+  800227:	83 c4 10             	add    $0x10,%esp
+  80022a:	c9                   	leave
+  80022b:	c3                   	ret
+  80022c:	e8 f6 12 00 00       	call   801527 <sys_lease_complete>
+  800231:	eb e5                	jmp    800218 <exit+0x15>
+
+00800233 <_panic>:
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	56                   	push   %esi
+  800237:	53                   	push   %ebx
+  800238:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80023b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800241:	e8 b5 0b 00 00       	call   800dfb <sys_getenvid>
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	ff 75 0c             	push   0xc(%ebp)
+  80024c:	ff 75 08             	push   0x8(%ebp)
+  80024f:	56                   	push   %esi
+  800250:	50                   	push   %eax
+  800251:	68 a0 34 80 00       	push   $0x8034a0
+  800256:	e8 b3 00 00 00       	call   80030e <cprintf>
+  80025b:	83 c4 18             	add    $0x18,%esp
+  80025e:	53                   	push   %ebx
+  80025f:	ff 75 10             	push   0x10(%ebp)
+  800262:	e8 56 00 00 00       	call   8002bd <vcprintf>
+  800267:	c7 04 24 ee 38 80 00 	movl   $0x8038ee,(%esp)
+  80026e:	e8 9b 00 00 00       	call   80030e <cprintf>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	cc                   	int3
+  800277:	eb fd                	jmp    800276 <_panic+0x43>
+
+00800279 <putch>:
+  800279:	55                   	push   %ebp
+  80027a:	89 e5                	mov    %esp,%ebp
+  80027c:	53                   	push   %ebx
+  80027d:	83 ec 04             	sub    $0x4,%esp
+  800280:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800283:	8b 13                	mov    (%ebx),%edx
+  800285:	8d 42 01             	lea    0x1(%edx),%eax
+  800288:	89 03                	mov    %eax,(%ebx)
+  80028a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800291:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800296:	74 09                	je     8002a1 <putch+0x28>
+  800298:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80029c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029f:	c9                   	leave
+  8002a0:	c3                   	ret
+  8002a1:	83 ec 08             	sub    $0x8,%esp
+  8002a4:	68 ff 00 00 00       	push   $0xff
+  8002a9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002ac:	50                   	push   %eax
+  8002ad:	e8 cb 0a 00 00       	call   800d7d <sys_cputs>
+  8002b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b8:	83 c4 10             	add    $0x10,%esp
+  8002bb:	eb db                	jmp    800298 <putch+0x1f>
+
+008002bd <vcprintf>:
+  8002bd:	55                   	push   %ebp
+  8002be:	89 e5                	mov    %esp,%ebp
+  8002c0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002c6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002cd:	00 00 00 
+  8002d0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d7:	00 00 00 
+  8002da:	ff 75 0c             	push   0xc(%ebp)
+  8002dd:	ff 75 08             	push   0x8(%ebp)
+  8002e0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e6:	50                   	push   %eax
+  8002e7:	68 79 02 80 00       	push   $0x800279
+  8002ec:	e8 1c 01 00 00       	call   80040d <vprintfmt>
+  8002f1:	83 c4 08             	add    $0x8,%esp
+  8002f4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002fa:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800300:	50                   	push   %eax
+  800301:	e8 77 0a 00 00       	call   800d7d <sys_cputs>
+  800306:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80030c:	c9                   	leave
+  80030d:	c3                   	ret
+
+0080030e <cprintf>:
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	83 ec 10             	sub    $0x10,%esp
+  800314:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800317:	50                   	push   %eax
+  800318:	ff 75 08             	push   0x8(%ebp)
+  80031b:	e8 9d ff ff ff       	call   8002bd <vcprintf>
+  800320:	c9                   	leave
+  800321:	c3                   	ret
+
+00800322 <printnum>:
+  800322:	55                   	push   %ebp
+  800323:	89 e5                	mov    %esp,%ebp
+  800325:	57                   	push   %edi
+  800326:	56                   	push   %esi
+  800327:	53                   	push   %ebx
+  800328:	83 ec 1c             	sub    $0x1c,%esp
+  80032b:	89 c3                	mov    %eax,%ebx
+  80032d:	89 d6                	mov    %edx,%esi
+  80032f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800332:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800335:	89 d1                	mov    %edx,%ecx
+  800337:	89 c2                	mov    %eax,%edx
+  800339:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80033c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80033f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800342:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800345:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80034c:	39 c2                	cmp    %eax,%edx
+  80034e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800351:	73 4b                	jae    80039e <printnum+0x7c>
+  800353:	8b 45 14             	mov    0x14(%ebp),%eax
+  800356:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800359:	85 ff                	test   %edi,%edi
+  80035b:	7e 11                	jle    80036e <printnum+0x4c>
+  80035d:	83 ec 08             	sub    $0x8,%esp
+  800360:	56                   	push   %esi
+  800361:	ff 75 18             	push   0x18(%ebp)
+  800364:	ff d3                	call   *%ebx
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	83 ef 01             	sub    $0x1,%edi
+  80036c:	75 ef                	jne    80035d <printnum+0x3b>
+  80036e:	83 ec 08             	sub    $0x8,%esp
+  800371:	56                   	push   %esi
+  800372:	83 ec 04             	sub    $0x4,%esp
+  800375:	ff 75 e4             	push   -0x1c(%ebp)
+  800378:	ff 75 e0             	push   -0x20(%ebp)
+  80037b:	ff 75 dc             	push   -0x24(%ebp)
+  80037e:	ff 75 d8             	push   -0x28(%ebp)
+  800381:	e8 64 2f 00 00       	call   8032ea <__umoddi3>
+  800386:	83 c4 14             	add    $0x14,%esp
+  800389:	0f be 80 c3 34 80 00 	movsbl 0x8034c3(%eax),%eax
+  800390:	50                   	push   %eax
+  800391:	ff d3                	call   *%ebx
+  800393:	83 c4 10             	add    $0x10,%esp
+  800396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800399:	5b                   	pop    %ebx
+  80039a:	5e                   	pop    %esi
+  80039b:	5f                   	pop    %edi
+  80039c:	5d                   	pop    %ebp
+  80039d:	c3                   	ret
+  80039e:	83 ec 0c             	sub    $0xc,%esp
+  8003a1:	ff 75 18             	push   0x18(%ebp)
+  8003a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003a7:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003aa:	52                   	push   %edx
+  8003ab:	50                   	push   %eax
+  8003ac:	83 ec 08             	sub    $0x8,%esp
+  8003af:	ff 75 e4             	push   -0x1c(%ebp)
+  8003b2:	ff 75 e0             	push   -0x20(%ebp)
+  8003b5:	ff 75 dc             	push   -0x24(%ebp)
+  8003b8:	ff 75 d8             	push   -0x28(%ebp)
+  8003bb:	e8 0c 2f 00 00       	call   8032cc <__udivdi3>
+  8003c0:	83 c4 18             	add    $0x18,%esp
+  8003c3:	52                   	push   %edx
+  8003c4:	50                   	push   %eax
+  8003c5:	89 f2                	mov    %esi,%edx
+  8003c7:	89 d8                	mov    %ebx,%eax
+  8003c9:	e8 54 ff ff ff       	call   800322 <printnum>
+  8003ce:	83 c4 20             	add    $0x20,%esp
+  8003d1:	eb 9b                	jmp    80036e <printnum+0x4c>
+
+008003d3 <sprintputch>:
+  8003d3:	55                   	push   %ebp
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003d9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8003dd:	8b 10                	mov    (%eax),%edx
+  8003df:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003e2:	73 0a                	jae    8003ee <sprintputch+0x1b>
+  8003e4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e7:	89 08                	mov    %ecx,(%eax)
+  8003e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ec:	88 02                	mov    %al,(%edx)
+  8003ee:	5d                   	pop    %ebp
+  8003ef:	c3                   	ret
+
+008003f0 <printfmt>:
+  8003f0:	55                   	push   %ebp
+  8003f1:	89 e5                	mov    %esp,%ebp
+  8003f3:	83 ec 08             	sub    $0x8,%esp
+  8003f6:	8d 45 14             	lea    0x14(%ebp),%eax
+  8003f9:	50                   	push   %eax
+  8003fa:	ff 75 10             	push   0x10(%ebp)
+  8003fd:	ff 75 0c             	push   0xc(%ebp)
+  800400:	ff 75 08             	push   0x8(%ebp)
+  800403:	e8 05 00 00 00       	call   80040d <vprintfmt>
+  800408:	83 c4 10             	add    $0x10,%esp
+  80040b:	c9                   	leave
+  80040c:	c3                   	ret
+
+0080040d <vprintfmt>:
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	57                   	push   %edi
+  800411:	56                   	push   %esi
+  800412:	53                   	push   %ebx
+  800413:	83 ec 2c             	sub    $0x2c,%esp
+  800416:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800419:	89 df                	mov    %ebx,%edi
+  80041b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80041e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800421:	8d 70 01             	lea    0x1(%eax),%esi
+  800424:	0f b6 00             	movzbl (%eax),%eax
+  800427:	83 f8 25             	cmp    $0x25,%eax
+  80042a:	74 1e                	je     80044a <vprintfmt+0x3d>
+  80042c:	85 c0                	test   %eax,%eax
+  80042e:	0f 84 15 05 00 00    	je     800949 <vprintfmt+0x53c>
+  800434:	83 ec 08             	sub    $0x8,%esp
+  800437:	53                   	push   %ebx
+  800438:	50                   	push   %eax
+  800439:	ff d7                	call   *%edi
+  80043b:	83 c6 01             	add    $0x1,%esi
+  80043e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	83 f8 25             	cmp    $0x25,%eax
+  800448:	75 e2                	jne    80042c <vprintfmt+0x1f>
+  80044a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80044e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800455:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80045c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800463:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800468:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80046b:	8d 56 01             	lea    0x1(%esi),%edx
+  80046e:	0f b6 0e             	movzbl (%esi),%ecx
+  800471:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800474:	3c 55                	cmp    $0x55,%al
+  800476:	0f 87 3b 04 00 00    	ja     8008b7 <vprintfmt+0x4aa>
+  80047c:	0f b6 c0             	movzbl %al,%eax
+  80047f:	ff 24 85 00 36 80 00 	jmp    *0x803600(,%eax,4)
+  800486:	89 75 10             	mov    %esi,0x10(%ebp)
+  800489:	eb 93                	jmp    80041e <vprintfmt+0x11>
+  80048b:	89 d6                	mov    %edx,%esi
+  80048d:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800491:	eb d8                	jmp    80046b <vprintfmt+0x5e>
+  800493:	89 d6                	mov    %edx,%esi
+  800495:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800499:	eb d0                	jmp    80046b <vprintfmt+0x5e>
+  80049b:	0f b6 c9             	movzbl %cl,%ecx
+  80049e:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004a4:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8004a8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004ab:	83 f9 09             	cmp    $0x9,%ecx
+  8004ae:	77 6f                	ja     80051f <vprintfmt+0x112>
+  8004b0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8004b3:	83 c2 01             	add    $0x1,%edx
+  8004b6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004b9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8004bd:	0f be 02             	movsbl (%edx),%eax
+  8004c0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004c3:	83 fe 09             	cmp    $0x9,%esi
+  8004c6:	76 eb                	jbe    8004b3 <vprintfmt+0xa6>
+  8004c8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8004cb:	89 d6                	mov    %edx,%esi
+  8004cd:	eb 13                	jmp    8004e2 <vprintfmt+0xd5>
+  8004cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d2:	8b 00                	mov    (%eax),%eax
+  8004d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004da:	8d 40 04             	lea    0x4(%eax),%eax
+  8004dd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004e0:	89 d6                	mov    %edx,%esi
+  8004e2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004e6:	79 83                	jns    80046b <vprintfmt+0x5e>
+  8004e8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004ee:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004f5:	e9 71 ff ff ff       	jmp    80046b <vprintfmt+0x5e>
+  8004fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fd:	85 c9                	test   %ecx,%ecx
+  8004ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800504:	0f 49 c1             	cmovns %ecx,%eax
+  800507:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80050a:	89 d6                	mov    %edx,%esi
+  80050c:	e9 5a ff ff ff       	jmp    80046b <vprintfmt+0x5e>
+  800511:	89 d6                	mov    %edx,%esi
+  800513:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80051a:	e9 4c ff ff ff       	jmp    80046b <vprintfmt+0x5e>
+  80051f:	89 d6                	mov    %edx,%esi
+  800521:	eb bf                	jmp    8004e2 <vprintfmt+0xd5>
+  800523:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800527:	89 d6                	mov    %edx,%esi
+  800529:	e9 3d ff ff ff       	jmp    80046b <vprintfmt+0x5e>
+  80052e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800531:	8b 45 14             	mov    0x14(%ebp),%eax
+  800534:	8d 70 04             	lea    0x4(%eax),%esi
+  800537:	83 ec 08             	sub    $0x8,%esp
+  80053a:	53                   	push   %ebx
+  80053b:	ff 30                	push   (%eax)
+  80053d:	ff d7                	call   *%edi
+  80053f:	83 c4 10             	add    $0x10,%esp
+  800542:	89 75 14             	mov    %esi,0x14(%ebp)
+  800545:	e9 d4 fe ff ff       	jmp    80041e <vprintfmt+0x11>
+  80054a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80054d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800550:	8d 70 04             	lea    0x4(%eax),%esi
+  800553:	8b 10                	mov    (%eax),%edx
+  800555:	89 d0                	mov    %edx,%eax
+  800557:	f7 d8                	neg    %eax
+  800559:	0f 48 c2             	cmovs  %edx,%eax
+  80055c:	83 f8 12             	cmp    $0x12,%eax
+  80055f:	7f 23                	jg     800584 <vprintfmt+0x177>
+  800561:	8b 14 85 60 37 80 00 	mov    0x803760(,%eax,4),%edx
+  800568:	85 d2                	test   %edx,%edx
+  80056a:	74 18                	je     800584 <vprintfmt+0x177>
+  80056c:	52                   	push   %edx
+  80056d:	68 bb 38 80 00       	push   $0x8038bb
+  800572:	53                   	push   %ebx
+  800573:	57                   	push   %edi
+  800574:	e8 77 fe ff ff       	call   8003f0 <printfmt>
+  800579:	83 c4 10             	add    $0x10,%esp
+  80057c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80057f:	e9 9a fe ff ff       	jmp    80041e <vprintfmt+0x11>
+  800584:	50                   	push   %eax
+  800585:	68 db 34 80 00       	push   $0x8034db
+  80058a:	53                   	push   %ebx
+  80058b:	57                   	push   %edi
+  80058c:	e8 5f fe ff ff       	call   8003f0 <printfmt>
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	89 75 14             	mov    %esi,0x14(%ebp)
+  800597:	e9 82 fe ff ff       	jmp    80041e <vprintfmt+0x11>
+  80059c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	83 c0 04             	add    $0x4,%eax
+  8005a5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ab:	8b 00                	mov    (%eax),%eax
+  8005ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b0:	85 c0                	test   %eax,%eax
+  8005b2:	0f 84 61 03 00 00    	je     800919 <vprintfmt+0x50c>
+  8005b8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005bc:	7e 06                	jle    8005c4 <vprintfmt+0x1b7>
+  8005be:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005c2:	75 29                	jne    8005ed <vprintfmt+0x1e0>
+  8005c4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005c7:	8d 70 01             	lea    0x1(%eax),%esi
+  8005ca:	0f b6 00             	movzbl (%eax),%eax
+  8005cd:	0f be d0             	movsbl %al,%edx
+  8005d0:	85 d2                	test   %edx,%edx
+  8005d2:	0f 84 bb 00 00 00    	je     800693 <vprintfmt+0x286>
+  8005d8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005db:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005de:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005e1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005e4:	eb 7a                	jmp    800660 <vprintfmt+0x253>
+  8005e6:	c7 45 d0 d4 34 80 00 	movl   $0x8034d4,-0x30(%ebp)
+  8005ed:	83 ec 08             	sub    $0x8,%esp
+  8005f0:	ff 75 d4             	push   -0x2c(%ebp)
+  8005f3:	ff 75 d0             	push   -0x30(%ebp)
+  8005f6:	e8 e0 03 00 00       	call   8009db <strnlen>
+  8005fb:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005fe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800601:	83 c4 10             	add    $0x10,%esp
+  800604:	85 d2                	test   %edx,%edx
+  800606:	0f 8e d6 02 00 00    	jle    8008e2 <vprintfmt+0x4d5>
+  80060c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800610:	83 ec 08             	sub    $0x8,%esp
+  800613:	53                   	push   %ebx
+  800614:	56                   	push   %esi
+  800615:	ff d7                	call   *%edi
+  800617:	83 c4 10             	add    $0x10,%esp
+  80061a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80061e:	75 f0                	jne    800610 <vprintfmt+0x203>
+  800620:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800623:	8d 70 01             	lea    0x1(%eax),%esi
+  800626:	0f b6 00             	movzbl (%eax),%eax
+  800629:	0f be d0             	movsbl %al,%edx
+  80062c:	85 d2                	test   %edx,%edx
+  80062e:	0f 84 da 02 00 00    	je     80090e <vprintfmt+0x501>
+  800634:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800637:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80063a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80063d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800640:	eb 1e                	jmp    800660 <vprintfmt+0x253>
+  800642:	83 ec 08             	sub    $0x8,%esp
+  800645:	ff 75 0c             	push   0xc(%ebp)
+  800648:	52                   	push   %edx
+  800649:	ff 55 08             	call   *0x8(%ebp)
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	83 eb 01             	sub    $0x1,%ebx
+  800652:	83 c6 01             	add    $0x1,%esi
+  800655:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800659:	0f be d0             	movsbl %al,%edx
+  80065c:	85 d2                	test   %edx,%edx
+  80065e:	74 2a                	je     80068a <vprintfmt+0x27d>
+  800660:	85 ff                	test   %edi,%edi
+  800662:	78 05                	js     800669 <vprintfmt+0x25c>
+  800664:	83 ef 01             	sub    $0x1,%edi
+  800667:	78 59                	js     8006c2 <vprintfmt+0x2b5>
+  800669:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80066d:	74 d3                	je     800642 <vprintfmt+0x235>
+  80066f:	0f be c0             	movsbl %al,%eax
+  800672:	83 e8 20             	sub    $0x20,%eax
+  800675:	83 f8 5e             	cmp    $0x5e,%eax
+  800678:	76 c8                	jbe    800642 <vprintfmt+0x235>
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	ff 75 0c             	push   0xc(%ebp)
+  800680:	6a 3f                	push   $0x3f
+  800682:	ff 55 08             	call   *0x8(%ebp)
+  800685:	83 c4 10             	add    $0x10,%esp
+  800688:	eb c5                	jmp    80064f <vprintfmt+0x242>
+  80068a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80068d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800690:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800693:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800696:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80069a:	7e 1b                	jle    8006b7 <vprintfmt+0x2aa>
+  80069c:	83 ec 08             	sub    $0x8,%esp
+  80069f:	53                   	push   %ebx
+  8006a0:	6a 20                	push   $0x20
+  8006a2:	ff d7                	call   *%edi
+  8006a4:	83 c4 10             	add    $0x10,%esp
+  8006a7:	83 ee 01             	sub    $0x1,%esi
+  8006aa:	75 f0                	jne    80069c <vprintfmt+0x28f>
+  8006ac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b2:	e9 67 fd ff ff       	jmp    80041e <vprintfmt+0x11>
+  8006b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bd:	e9 5c fd ff ff       	jmp    80041e <vprintfmt+0x11>
+  8006c2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006cb:	eb c6                	jmp    800693 <vprintfmt+0x286>
+  8006cd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006d0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006d3:	83 f9 01             	cmp    $0x1,%ecx
+  8006d6:	7f 1f                	jg     8006f7 <vprintfmt+0x2ea>
+  8006d8:	85 c9                	test   %ecx,%ecx
+  8006da:	74 67                	je     800743 <vprintfmt+0x336>
+  8006dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006df:	8b 30                	mov    (%eax),%esi
+  8006e1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006e4:	89 f0                	mov    %esi,%eax
+  8006e6:	c1 f8 1f             	sar    $0x1f,%eax
+  8006e9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f5:	eb 17                	jmp    80070e <vprintfmt+0x301>
+  8006f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fa:	8b 50 04             	mov    0x4(%eax),%edx
+  8006fd:	8b 00                	mov    (%eax),%eax
+  8006ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800702:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8d 40 08             	lea    0x8(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800711:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800714:	be 0a 00 00 00       	mov    $0xa,%esi
+  800719:	85 c9                	test   %ecx,%ecx
+  80071b:	0f 89 12 01 00 00    	jns    800833 <vprintfmt+0x426>
+  800721:	83 ec 08             	sub    $0x8,%esp
+  800724:	53                   	push   %ebx
+  800725:	6a 2d                	push   $0x2d
+  800727:	ff d7                	call   *%edi
+  800729:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80072c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80072f:	f7 da                	neg    %edx
+  800731:	83 d1 00             	adc    $0x0,%ecx
+  800734:	f7 d9                	neg    %ecx
+  800736:	83 c4 10             	add    $0x10,%esp
+  800739:	be 0a 00 00 00       	mov    $0xa,%esi
+  80073e:	e9 f0 00 00 00       	jmp    800833 <vprintfmt+0x426>
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 30                	mov    (%eax),%esi
+  800748:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80074b:	89 f0                	mov    %esi,%eax
+  80074d:	c1 f8 1f             	sar    $0x1f,%eax
+  800750:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8d 40 04             	lea    0x4(%eax),%eax
+  800759:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075c:	eb b0                	jmp    80070e <vprintfmt+0x301>
+  80075e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800761:	89 55 10             	mov    %edx,0x10(%ebp)
+  800764:	83 f9 01             	cmp    $0x1,%ecx
+  800767:	7f 1e                	jg     800787 <vprintfmt+0x37a>
+  800769:	85 c9                	test   %ecx,%ecx
+  80076b:	74 32                	je     80079f <vprintfmt+0x392>
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8b 10                	mov    (%eax),%edx
+  800772:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80077d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800782:	e9 ac 00 00 00       	jmp    800833 <vprintfmt+0x426>
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8b 10                	mov    (%eax),%edx
+  80078c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078f:	8d 40 08             	lea    0x8(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+  800795:	be 0a 00 00 00       	mov    $0xa,%esi
+  80079a:	e9 94 00 00 00       	jmp    800833 <vprintfmt+0x426>
+  80079f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a2:	8b 10                	mov    (%eax),%edx
+  8007a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007af:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007b4:	eb 7d                	jmp    800833 <vprintfmt+0x426>
+  8007b6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007b9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007bc:	83 f9 01             	cmp    $0x1,%ecx
+  8007bf:	7f 1b                	jg     8007dc <vprintfmt+0x3cf>
+  8007c1:	85 c9                	test   %ecx,%ecx
+  8007c3:	74 2c                	je     8007f1 <vprintfmt+0x3e4>
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8b 10                	mov    (%eax),%edx
+  8007ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d5:	be 08 00 00 00       	mov    $0x8,%esi
+  8007da:	eb 57                	jmp    800833 <vprintfmt+0x426>
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 10                	mov    (%eax),%edx
+  8007e1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ea:	be 08 00 00 00       	mov    $0x8,%esi
+  8007ef:	eb 42                	jmp    800833 <vprintfmt+0x426>
+  8007f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f4:	8b 10                	mov    (%eax),%edx
+  8007f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800801:	be 08 00 00 00       	mov    $0x8,%esi
+  800806:	eb 2b                	jmp    800833 <vprintfmt+0x426>
+  800808:	89 55 10             	mov    %edx,0x10(%ebp)
+  80080b:	83 ec 08             	sub    $0x8,%esp
+  80080e:	53                   	push   %ebx
+  80080f:	6a 30                	push   $0x30
+  800811:	ff d7                	call   *%edi
+  800813:	83 c4 08             	add    $0x8,%esp
+  800816:	53                   	push   %ebx
+  800817:	6a 78                	push   $0x78
+  800819:	ff d7                	call   *%edi
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8b 10                	mov    (%eax),%edx
+  800820:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800825:	83 c4 10             	add    $0x10,%esp
+  800828:	8d 40 04             	lea    0x4(%eax),%eax
+  80082b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082e:	be 10 00 00 00       	mov    $0x10,%esi
+  800833:	83 ec 0c             	sub    $0xc,%esp
+  800836:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80083a:	50                   	push   %eax
+  80083b:	ff 75 e4             	push   -0x1c(%ebp)
+  80083e:	56                   	push   %esi
+  80083f:	51                   	push   %ecx
+  800840:	52                   	push   %edx
+  800841:	89 da                	mov    %ebx,%edx
+  800843:	89 f8                	mov    %edi,%eax
+  800845:	e8 d8 fa ff ff       	call   800322 <printnum>
+  80084a:	83 c4 20             	add    $0x20,%esp
+  80084d:	e9 cc fb ff ff       	jmp    80041e <vprintfmt+0x11>
+  800852:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800855:	89 55 10             	mov    %edx,0x10(%ebp)
+  800858:	83 f9 01             	cmp    $0x1,%ecx
+  80085b:	7f 1b                	jg     800878 <vprintfmt+0x46b>
+  80085d:	85 c9                	test   %ecx,%ecx
+  80085f:	74 2c                	je     80088d <vprintfmt+0x480>
+  800861:	8b 45 14             	mov    0x14(%ebp),%eax
+  800864:	8b 10                	mov    (%eax),%edx
+  800866:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086b:	8d 40 04             	lea    0x4(%eax),%eax
+  80086e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800871:	be 10 00 00 00       	mov    $0x10,%esi
+  800876:	eb bb                	jmp    800833 <vprintfmt+0x426>
+  800878:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087b:	8b 10                	mov    (%eax),%edx
+  80087d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800880:	8d 40 08             	lea    0x8(%eax),%eax
+  800883:	89 45 14             	mov    %eax,0x14(%ebp)
+  800886:	be 10 00 00 00       	mov    $0x10,%esi
+  80088b:	eb a6                	jmp    800833 <vprintfmt+0x426>
+  80088d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800890:	8b 10                	mov    (%eax),%edx
+  800892:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800897:	8d 40 04             	lea    0x4(%eax),%eax
+  80089a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089d:	be 10 00 00 00       	mov    $0x10,%esi
+  8008a2:	eb 8f                	jmp    800833 <vprintfmt+0x426>
+  8008a4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008a7:	83 ec 08             	sub    $0x8,%esp
+  8008aa:	53                   	push   %ebx
+  8008ab:	6a 25                	push   $0x25
+  8008ad:	ff d7                	call   *%edi
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	e9 67 fb ff ff       	jmp    80041e <vprintfmt+0x11>
+  8008b7:	83 ec 08             	sub    $0x8,%esp
+  8008ba:	53                   	push   %ebx
+  8008bb:	6a 25                	push   $0x25
+  8008bd:	ff d7                	call   *%edi
+  8008bf:	83 c4 10             	add    $0x10,%esp
+  8008c2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008c6:	0f 84 ba fb ff ff    	je     800486 <vprintfmt+0x79>
+  8008cc:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008cf:	89 f0                	mov    %esi,%eax
+  8008d1:	83 e8 01             	sub    $0x1,%eax
+  8008d4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008d8:	75 f7                	jne    8008d1 <vprintfmt+0x4c4>
+  8008da:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008dd:	e9 3c fb ff ff       	jmp    80041e <vprintfmt+0x11>
+  8008e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008e5:	8d 70 01             	lea    0x1(%eax),%esi
+  8008e8:	0f b6 00             	movzbl (%eax),%eax
+  8008eb:	0f be d0             	movsbl %al,%edx
+  8008ee:	85 d2                	test   %edx,%edx
+  8008f0:	74 11                	je     800903 <vprintfmt+0x4f6>
+  8008f2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008f5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008f8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008fb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008fe:	e9 5d fd ff ff       	jmp    800660 <vprintfmt+0x253>
+  800903:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800906:	89 45 14             	mov    %eax,0x14(%ebp)
+  800909:	e9 10 fb ff ff       	jmp    80041e <vprintfmt+0x11>
+  80090e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800911:	89 45 14             	mov    %eax,0x14(%ebp)
+  800914:	e9 05 fb ff ff       	jmp    80041e <vprintfmt+0x11>
+  800919:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80091d:	7e 0a                	jle    800929 <vprintfmt+0x51c>
+  80091f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800923:	0f 85 bd fc ff ff    	jne    8005e6 <vprintfmt+0x1d9>
+  800929:	ba 28 00 00 00       	mov    $0x28,%edx
+  80092e:	b8 28 00 00 00       	mov    $0x28,%eax
+  800933:	be d5 34 80 00       	mov    $0x8034d5,%esi
+  800938:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80093b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80093e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800941:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800944:	e9 17 fd ff ff       	jmp    800660 <vprintfmt+0x253>
+  800949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80094c:	5b                   	pop    %ebx
+  80094d:	5e                   	pop    %esi
+  80094e:	5f                   	pop    %edi
+  80094f:	5d                   	pop    %ebp
+  800950:	c3                   	ret
+
+00800951 <vsnprintf>:
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	83 ec 18             	sub    $0x18,%esp
+  800957:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80095d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800960:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800964:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800967:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80096e:	85 c0                	test   %eax,%eax
+  800970:	74 26                	je     800998 <vsnprintf+0x47>
+  800972:	85 d2                	test   %edx,%edx
+  800974:	7e 22                	jle    800998 <vsnprintf+0x47>
+  800976:	ff 75 14             	push   0x14(%ebp)
+  800979:	ff 75 10             	push   0x10(%ebp)
+  80097c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80097f:	50                   	push   %eax
+  800980:	68 d3 03 80 00       	push   $0x8003d3
+  800985:	e8 83 fa ff ff       	call   80040d <vprintfmt>
+  80098a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80098d:	c6 00 00             	movb   $0x0,(%eax)
+  800990:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800993:	83 c4 10             	add    $0x10,%esp
+  800996:	c9                   	leave
+  800997:	c3                   	ret
+  800998:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099d:	eb f7                	jmp    800996 <vsnprintf+0x45>
+
+0080099f <snprintf>:
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	83 ec 08             	sub    $0x8,%esp
+  8009a5:	8d 45 14             	lea    0x14(%ebp),%eax
+  8009a8:	50                   	push   %eax
+  8009a9:	ff 75 10             	push   0x10(%ebp)
+  8009ac:	ff 75 0c             	push   0xc(%ebp)
+  8009af:	ff 75 08             	push   0x8(%ebp)
+  8009b2:	e8 9a ff ff ff       	call   800951 <vsnprintf>
+  8009b7:	c9                   	leave
+  8009b8:	c3                   	ret
+
+008009b9 <strlen>:
+  8009b9:	55                   	push   %ebp
+  8009ba:	89 e5                	mov    %esp,%ebp
+  8009bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009bf:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009c2:	74 10                	je     8009d4 <strlen+0x1b>
+  8009c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c9:	83 c0 01             	add    $0x1,%eax
+  8009cc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009d0:	75 f7                	jne    8009c9 <strlen+0x10>
+  8009d2:	5d                   	pop    %ebp
+  8009d3:	c3                   	ret
+  8009d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d9:	eb f7                	jmp    8009d2 <strlen+0x19>
+
+008009db <strnlen>:
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e4:	85 d2                	test   %edx,%edx
+  8009e6:	74 16                	je     8009fe <strnlen+0x23>
+  8009e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ed:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009f1:	74 09                	je     8009fc <strnlen+0x21>
+  8009f3:	83 c0 01             	add    $0x1,%eax
+  8009f6:	39 d0                	cmp    %edx,%eax
+  8009f8:	75 f3                	jne    8009ed <strnlen+0x12>
+  8009fa:	89 d0                	mov    %edx,%eax
+  8009fc:	5d                   	pop    %ebp
+  8009fd:	c3                   	ret
+  8009fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a03:	eb f7                	jmp    8009fc <strnlen+0x21>
+
+00800a05 <strcpy>:
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	53                   	push   %ebx
+  800a09:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a14:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a18:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a1b:	83 c0 01             	add    $0x1,%eax
+  800a1e:	84 d2                	test   %dl,%dl
+  800a20:	75 f2                	jne    800a14 <strcpy+0xf>
+  800a22:	89 c8                	mov    %ecx,%eax
+  800a24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a27:	c9                   	leave
+  800a28:	c3                   	ret
+
+00800a29 <strcat>:
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	53                   	push   %ebx
+  800a2d:	83 ec 10             	sub    $0x10,%esp
+  800a30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a33:	53                   	push   %ebx
+  800a34:	e8 80 ff ff ff       	call   8009b9 <strlen>
+  800a39:	83 c4 08             	add    $0x8,%esp
+  800a3c:	ff 75 0c             	push   0xc(%ebp)
+  800a3f:	01 d8                	add    %ebx,%eax
+  800a41:	50                   	push   %eax
+  800a42:	e8 be ff ff ff       	call   800a05 <strcpy>
+  800a47:	89 d8                	mov    %ebx,%eax
+  800a49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a4c:	c9                   	leave
+  800a4d:	c3                   	ret
+
+00800a4e <strncpy>:
+  800a4e:	55                   	push   %ebp
+  800a4f:	89 e5                	mov    %esp,%ebp
+  800a51:	56                   	push   %esi
+  800a52:	53                   	push   %ebx
+  800a53:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a5c:	85 db                	test   %ebx,%ebx
+  800a5e:	74 17                	je     800a77 <strncpy+0x29>
+  800a60:	01 f3                	add    %esi,%ebx
+  800a62:	89 f0                	mov    %esi,%eax
+  800a64:	83 c0 01             	add    $0x1,%eax
+  800a67:	0f b6 0a             	movzbl (%edx),%ecx
+  800a6a:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a6d:	80 f9 01             	cmp    $0x1,%cl
+  800a70:	83 da ff             	sbb    $0xffffffff,%edx
+  800a73:	39 c3                	cmp    %eax,%ebx
+  800a75:	75 ed                	jne    800a64 <strncpy+0x16>
+  800a77:	89 f0                	mov    %esi,%eax
+  800a79:	5b                   	pop    %ebx
+  800a7a:	5e                   	pop    %esi
+  800a7b:	5d                   	pop    %ebp
+  800a7c:	c3                   	ret
+
+00800a7d <strlcpy>:
+  800a7d:	55                   	push   %ebp
+  800a7e:	89 e5                	mov    %esp,%ebp
+  800a80:	56                   	push   %esi
+  800a81:	53                   	push   %ebx
+  800a82:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a8b:	89 f0                	mov    %esi,%eax
+  800a8d:	85 db                	test   %ebx,%ebx
+  800a8f:	74 1e                	je     800aaf <strlcpy+0x32>
+  800a91:	83 eb 01             	sub    $0x1,%ebx
+  800a94:	74 16                	je     800aac <strlcpy+0x2f>
+  800a96:	01 f3                	add    %esi,%ebx
+  800a98:	0f b6 0a             	movzbl (%edx),%ecx
+  800a9b:	84 c9                	test   %cl,%cl
+  800a9d:	74 0d                	je     800aac <strlcpy+0x2f>
+  800a9f:	83 c2 01             	add    $0x1,%edx
+  800aa2:	83 c0 01             	add    $0x1,%eax
+  800aa5:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800aa8:	39 d8                	cmp    %ebx,%eax
+  800aaa:	75 ec                	jne    800a98 <strlcpy+0x1b>
+  800aac:	c6 00 00             	movb   $0x0,(%eax)
+  800aaf:	29 f0                	sub    %esi,%eax
+  800ab1:	5b                   	pop    %ebx
+  800ab2:	5e                   	pop    %esi
+  800ab3:	5d                   	pop    %ebp
+  800ab4:	c3                   	ret
+
+00800ab5 <strcmp>:
+  800ab5:	55                   	push   %ebp
+  800ab6:	89 e5                	mov    %esp,%ebp
+  800ab8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800abb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800abe:	0f b6 01             	movzbl (%ecx),%eax
+  800ac1:	84 c0                	test   %al,%al
+  800ac3:	74 11                	je     800ad6 <strcmp+0x21>
+  800ac5:	38 02                	cmp    %al,(%edx)
+  800ac7:	75 0d                	jne    800ad6 <strcmp+0x21>
+  800ac9:	83 c1 01             	add    $0x1,%ecx
+  800acc:	83 c2 01             	add    $0x1,%edx
+  800acf:	0f b6 01             	movzbl (%ecx),%eax
+  800ad2:	84 c0                	test   %al,%al
+  800ad4:	75 ef                	jne    800ac5 <strcmp+0x10>
+  800ad6:	0f b6 c0             	movzbl %al,%eax
+  800ad9:	0f b6 12             	movzbl (%edx),%edx
+  800adc:	29 d0                	sub    %edx,%eax
+  800ade:	5d                   	pop    %ebp
+  800adf:	c3                   	ret
+
+00800ae0 <strncmp>:
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	53                   	push   %ebx
+  800ae4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800aea:	8b 55 10             	mov    0x10(%ebp),%edx
+  800aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af2:	85 d2                	test   %edx,%edx
+  800af4:	74 2e                	je     800b24 <strncmp+0x44>
+  800af6:	0f b6 01             	movzbl (%ecx),%eax
+  800af9:	84 c0                	test   %al,%al
+  800afb:	74 16                	je     800b13 <strncmp+0x33>
+  800afd:	3a 03                	cmp    (%ebx),%al
+  800aff:	75 12                	jne    800b13 <strncmp+0x33>
+  800b01:	83 c1 01             	add    $0x1,%ecx
+  800b04:	83 c3 01             	add    $0x1,%ebx
+  800b07:	83 ea 01             	sub    $0x1,%edx
+  800b0a:	75 ea                	jne    800af6 <strncmp+0x16>
+  800b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b11:	eb 11                	jmp    800b24 <strncmp+0x44>
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b18:	85 d2                	test   %edx,%edx
+  800b1a:	74 08                	je     800b24 <strncmp+0x44>
+  800b1c:	0f b6 01             	movzbl (%ecx),%eax
+  800b1f:	0f b6 13             	movzbl (%ebx),%edx
+  800b22:	29 d0                	sub    %edx,%eax
+  800b24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b27:	c9                   	leave
+  800b28:	c3                   	ret
+
+00800b29 <strchr>:
+  800b29:	55                   	push   %ebp
+  800b2a:	89 e5                	mov    %esp,%ebp
+  800b2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b33:	0f b6 10             	movzbl (%eax),%edx
+  800b36:	84 d2                	test   %dl,%dl
+  800b38:	74 15                	je     800b4f <strchr+0x26>
+  800b3a:	38 d1                	cmp    %dl,%cl
+  800b3c:	74 0f                	je     800b4d <strchr+0x24>
+  800b3e:	83 c0 01             	add    $0x1,%eax
+  800b41:	0f b6 10             	movzbl (%eax),%edx
+  800b44:	84 d2                	test   %dl,%dl
+  800b46:	75 f2                	jne    800b3a <strchr+0x11>
+  800b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+  800b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b54:	eb f7                	jmp    800b4d <strchr+0x24>
+
+00800b56 <strfind>:
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	53                   	push   %ebx
+  800b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b60:	0f b6 18             	movzbl (%eax),%ebx
+  800b63:	38 d3                	cmp    %dl,%bl
+  800b65:	74 14                	je     800b7b <strfind+0x25>
+  800b67:	89 d1                	mov    %edx,%ecx
+  800b69:	84 db                	test   %bl,%bl
+  800b6b:	74 0e                	je     800b7b <strfind+0x25>
+  800b6d:	83 c0 01             	add    $0x1,%eax
+  800b70:	0f b6 10             	movzbl (%eax),%edx
+  800b73:	38 ca                	cmp    %cl,%dl
+  800b75:	74 04                	je     800b7b <strfind+0x25>
+  800b77:	84 d2                	test   %dl,%dl
+  800b79:	75 f2                	jne    800b6d <strfind+0x17>
+  800b7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b7e:	c9                   	leave
+  800b7f:	c3                   	ret
+
+00800b80 <memset>:
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b8a:	85 c9                	test   %ecx,%ecx
+  800b8c:	74 20                	je     800bae <memset+0x2e>
+  800b8e:	89 f8                	mov    %edi,%eax
+  800b90:	09 c8                	or     %ecx,%eax
+  800b92:	a8 03                	test   $0x3,%al
+  800b94:	75 12                	jne    800ba8 <memset+0x28>
+  800b96:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b9a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ba0:	c1 e9 02             	shr    $0x2,%ecx
+  800ba3:	fc                   	cld
+  800ba4:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ba6:	eb 06                	jmp    800bae <memset+0x2e>
+  800ba8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bab:	fc                   	cld
+  800bac:	f3 aa                	rep stos %al,%es:(%edi)
+  800bae:	89 f8                	mov    %edi,%eax
+  800bb0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bb3:	c9                   	leave
+  800bb4:	c3                   	ret
+
+00800bb5 <memmove>:
+  800bb5:	55                   	push   %ebp
+  800bb6:	89 e5                	mov    %esp,%ebp
+  800bb8:	57                   	push   %edi
+  800bb9:	56                   	push   %esi
+  800bba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bc0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800bc3:	39 c6                	cmp    %eax,%esi
+  800bc5:	73 32                	jae    800bf9 <memmove+0x44>
+  800bc7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bca:	39 d0                	cmp    %edx,%eax
+  800bcc:	73 2b                	jae    800bf9 <memmove+0x44>
+  800bce:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800bd1:	89 d6                	mov    %edx,%esi
+  800bd3:	09 fe                	or     %edi,%esi
+  800bd5:	09 ce                	or     %ecx,%esi
+  800bd7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bdd:	75 0e                	jne    800bed <memmove+0x38>
+  800bdf:	83 ef 04             	sub    $0x4,%edi
+  800be2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800be5:	c1 e9 02             	shr    $0x2,%ecx
+  800be8:	fd                   	std
+  800be9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800beb:	eb 09                	jmp    800bf6 <memmove+0x41>
+  800bed:	83 ef 01             	sub    $0x1,%edi
+  800bf0:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800bf3:	fd                   	std
+  800bf4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800bf6:	fc                   	cld
+  800bf7:	eb 1a                	jmp    800c13 <memmove+0x5e>
+  800bf9:	89 f2                	mov    %esi,%edx
+  800bfb:	09 c2                	or     %eax,%edx
+  800bfd:	09 ca                	or     %ecx,%edx
+  800bff:	f6 c2 03             	test   $0x3,%dl
+  800c02:	75 0a                	jne    800c0e <memmove+0x59>
+  800c04:	c1 e9 02             	shr    $0x2,%ecx
+  800c07:	89 c7                	mov    %eax,%edi
+  800c09:	fc                   	cld
+  800c0a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c0c:	eb 05                	jmp    800c13 <memmove+0x5e>
+  800c0e:	89 c7                	mov    %eax,%edi
+  800c10:	fc                   	cld
+  800c11:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c13:	5e                   	pop    %esi
+  800c14:	5f                   	pop    %edi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <memcpy>:
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	83 ec 0c             	sub    $0xc,%esp
+  800c1d:	ff 75 10             	push   0x10(%ebp)
+  800c20:	ff 75 0c             	push   0xc(%ebp)
+  800c23:	ff 75 08             	push   0x8(%ebp)
+  800c26:	e8 8a ff ff ff       	call   800bb5 <memmove>
+  800c2b:	c9                   	leave
+  800c2c:	c3                   	ret
+
+00800c2d <memcmp>:
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	56                   	push   %esi
+  800c31:	53                   	push   %ebx
+  800c32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c38:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c3b:	85 f6                	test   %esi,%esi
+  800c3d:	74 29                	je     800c68 <memcmp+0x3b>
+  800c3f:	01 c6                	add    %eax,%esi
+  800c41:	0f b6 08             	movzbl (%eax),%ecx
+  800c44:	0f b6 1a             	movzbl (%edx),%ebx
+  800c47:	38 d9                	cmp    %bl,%cl
+  800c49:	75 11                	jne    800c5c <memcmp+0x2f>
+  800c4b:	83 c0 01             	add    $0x1,%eax
+  800c4e:	83 c2 01             	add    $0x1,%edx
+  800c51:	39 c6                	cmp    %eax,%esi
+  800c53:	75 ec                	jne    800c41 <memcmp+0x14>
+  800c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5a:	eb 08                	jmp    800c64 <memcmp+0x37>
+  800c5c:	0f b6 c1             	movzbl %cl,%eax
+  800c5f:	0f b6 db             	movzbl %bl,%ebx
+  800c62:	29 d8                	sub    %ebx,%eax
+  800c64:	5b                   	pop    %ebx
+  800c65:	5e                   	pop    %esi
+  800c66:	5d                   	pop    %ebp
+  800c67:	c3                   	ret
+  800c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6d:	eb f5                	jmp    800c64 <memcmp+0x37>
+
+00800c6f <memfind>:
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c78:	89 c2                	mov    %eax,%edx
+  800c7a:	03 55 10             	add    0x10(%ebp),%edx
+  800c7d:	39 d0                	cmp    %edx,%eax
+  800c7f:	73 0d                	jae    800c8e <memfind+0x1f>
+  800c81:	38 08                	cmp    %cl,(%eax)
+  800c83:	74 0d                	je     800c92 <memfind+0x23>
+  800c85:	83 c0 01             	add    $0x1,%eax
+  800c88:	39 c2                	cmp    %eax,%edx
+  800c8a:	75 f5                	jne    800c81 <memfind+0x12>
+  800c8c:	eb 06                	jmp    800c94 <memfind+0x25>
+  800c8e:	89 c2                	mov    %eax,%edx
+  800c90:	eb 02                	jmp    800c94 <memfind+0x25>
+  800c92:	89 c2                	mov    %eax,%edx
+  800c94:	89 d0                	mov    %edx,%eax
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+
+00800c98 <strtol>:
+  800c98:	55                   	push   %ebp
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	57                   	push   %edi
+  800c9c:	56                   	push   %esi
+  800c9d:	53                   	push   %ebx
+  800c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca4:	0f b6 02             	movzbl (%edx),%eax
+  800ca7:	3c 20                	cmp    $0x20,%al
+  800ca9:	74 04                	je     800caf <strtol+0x17>
+  800cab:	3c 09                	cmp    $0x9,%al
+  800cad:	75 0e                	jne    800cbd <strtol+0x25>
+  800caf:	83 c2 01             	add    $0x1,%edx
+  800cb2:	0f b6 02             	movzbl (%edx),%eax
+  800cb5:	3c 20                	cmp    $0x20,%al
+  800cb7:	74 f6                	je     800caf <strtol+0x17>
+  800cb9:	3c 09                	cmp    $0x9,%al
+  800cbb:	74 f2                	je     800caf <strtol+0x17>
+  800cbd:	3c 2b                	cmp    $0x2b,%al
+  800cbf:	74 2a                	je     800ceb <strtol+0x53>
+  800cc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cc6:	3c 2d                	cmp    $0x2d,%al
+  800cc8:	74 2b                	je     800cf5 <strtol+0x5d>
+  800cca:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cd0:	75 0f                	jne    800ce1 <strtol+0x49>
+  800cd2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cd5:	74 28                	je     800cff <strtol+0x67>
+  800cd7:	85 db                	test   %ebx,%ebx
+  800cd9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cde:	0f 44 d8             	cmove  %eax,%ebx
+  800ce1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ce9:	eb 46                	jmp    800d31 <strtol+0x99>
+  800ceb:	83 c2 01             	add    $0x1,%edx
+  800cee:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cf3:	eb d5                	jmp    800cca <strtol+0x32>
+  800cf5:	83 c2 01             	add    $0x1,%edx
+  800cf8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cfd:	eb cb                	jmp    800cca <strtol+0x32>
+  800cff:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d03:	74 0e                	je     800d13 <strtol+0x7b>
+  800d05:	85 db                	test   %ebx,%ebx
+  800d07:	75 d8                	jne    800ce1 <strtol+0x49>
+  800d09:	83 c2 01             	add    $0x1,%edx
+  800d0c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d11:	eb ce                	jmp    800ce1 <strtol+0x49>
+  800d13:	83 c2 02             	add    $0x2,%edx
+  800d16:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d1b:	eb c4                	jmp    800ce1 <strtol+0x49>
+  800d1d:	0f be c0             	movsbl %al,%eax
+  800d20:	83 e8 30             	sub    $0x30,%eax
+  800d23:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d26:	7d 3a                	jge    800d62 <strtol+0xca>
+  800d28:	83 c2 01             	add    $0x1,%edx
+  800d2b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d2f:	01 c1                	add    %eax,%ecx
+  800d31:	0f b6 02             	movzbl (%edx),%eax
+  800d34:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d37:	89 f3                	mov    %esi,%ebx
+  800d39:	80 fb 09             	cmp    $0x9,%bl
+  800d3c:	76 df                	jbe    800d1d <strtol+0x85>
+  800d3e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d41:	89 f3                	mov    %esi,%ebx
+  800d43:	80 fb 19             	cmp    $0x19,%bl
+  800d46:	77 08                	ja     800d50 <strtol+0xb8>
+  800d48:	0f be c0             	movsbl %al,%eax
+  800d4b:	83 e8 57             	sub    $0x57,%eax
+  800d4e:	eb d3                	jmp    800d23 <strtol+0x8b>
+  800d50:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d53:	89 f3                	mov    %esi,%ebx
+  800d55:	80 fb 19             	cmp    $0x19,%bl
+  800d58:	77 08                	ja     800d62 <strtol+0xca>
+  800d5a:	0f be c0             	movsbl %al,%eax
+  800d5d:	83 e8 37             	sub    $0x37,%eax
+  800d60:	eb c1                	jmp    800d23 <strtol+0x8b>
+  800d62:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d66:	74 05                	je     800d6d <strtol+0xd5>
+  800d68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d6b:	89 10                	mov    %edx,(%eax)
+  800d6d:	89 c8                	mov    %ecx,%eax
+  800d6f:	f7 d8                	neg    %eax
+  800d71:	85 ff                	test   %edi,%edi
+  800d73:	0f 45 c8             	cmovne %eax,%ecx
+  800d76:	89 c8                	mov    %ecx,%eax
+  800d78:	5b                   	pop    %ebx
+  800d79:	5e                   	pop    %esi
+  800d7a:	5f                   	pop    %edi
+  800d7b:	5d                   	pop    %ebp
+  800d7c:	c3                   	ret
+
+00800d7d <sys_cputs>:
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	57                   	push   %edi
+  800d81:	56                   	push   %esi
+  800d82:	53                   	push   %ebx
+  800d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8e:	89 c3                	mov    %eax,%ebx
+  800d90:	89 c7                	mov    %eax,%edi
+  800d92:	89 c6                	mov    %eax,%esi
+  800d94:	cd 30                	int    $0x30
+  800d96:	5b                   	pop    %ebx
+  800d97:	5e                   	pop    %esi
+  800d98:	5f                   	pop    %edi
+  800d99:	5d                   	pop    %ebp
+  800d9a:	c3                   	ret
+
+00800d9b <sys_cgetc>:
+  800d9b:	55                   	push   %ebp
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	57                   	push   %edi
+  800d9f:	56                   	push   %esi
+  800da0:	53                   	push   %ebx
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dab:	89 d1                	mov    %edx,%ecx
+  800dad:	89 d3                	mov    %edx,%ebx
+  800daf:	89 d7                	mov    %edx,%edi
+  800db1:	89 d6                	mov    %edx,%esi
+  800db3:	cd 30                	int    $0x30
+  800db5:	5b                   	pop    %ebx
+  800db6:	5e                   	pop    %esi
+  800db7:	5f                   	pop    %edi
+  800db8:	5d                   	pop    %ebp
+  800db9:	c3                   	ret
+
+00800dba <sys_env_destroy>:
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	57                   	push   %edi
+  800dbe:	56                   	push   %esi
+  800dbf:	53                   	push   %ebx
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+  800dc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd0:	89 cb                	mov    %ecx,%ebx
+  800dd2:	89 cf                	mov    %ecx,%edi
+  800dd4:	89 ce                	mov    %ecx,%esi
+  800dd6:	cd 30                	int    $0x30
+  800dd8:	85 c0                	test   %eax,%eax
+  800dda:	7f 08                	jg     800de4 <sys_env_destroy+0x2a>
+  800ddc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ddf:	5b                   	pop    %ebx
+  800de0:	5e                   	pop    %esi
+  800de1:	5f                   	pop    %edi
+  800de2:	5d                   	pop    %ebp
+  800de3:	c3                   	ret
+  800de4:	83 ec 0c             	sub    $0xc,%esp
+  800de7:	50                   	push   %eax
+  800de8:	6a 03                	push   $0x3
+  800dea:	68 cb 37 80 00       	push   $0x8037cb
+  800def:	6a 24                	push   $0x24
+  800df1:	68 e8 37 80 00       	push   $0x8037e8
+  800df6:	e8 38 f4 ff ff       	call   800233 <_panic>
+
+00800dfb <sys_getenvid>:
+  800dfb:	55                   	push   %ebp
+  800dfc:	89 e5                	mov    %esp,%ebp
+  800dfe:	57                   	push   %edi
+  800dff:	56                   	push   %esi
+  800e00:	53                   	push   %ebx
+  800e01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e06:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e0b:	89 d1                	mov    %edx,%ecx
+  800e0d:	89 d3                	mov    %edx,%ebx
+  800e0f:	89 d7                	mov    %edx,%edi
+  800e11:	89 d6                	mov    %edx,%esi
+  800e13:	cd 30                	int    $0x30
+  800e15:	5b                   	pop    %ebx
+  800e16:	5e                   	pop    %esi
+  800e17:	5f                   	pop    %edi
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+
+00800e1a <sys_yield>:
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	53                   	push   %ebx
+  800e20:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e27:	74 26                	je     800e4f <sys_yield+0x35>
+  800e29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e33:	89 d1                	mov    %edx,%ecx
+  800e35:	89 d3                	mov    %edx,%ebx
+  800e37:	89 d7                	mov    %edx,%edi
+  800e39:	6a 00                	push   $0x0
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	8d 35 46 0e 80 00    	lea    0x800e46,%esi
+  800e44:	0f 34                	sysenter
+  800e46:	5d                   	pop    %ebp
+  800e47:	83 c4 04             	add    $0x4,%esp
+  800e4a:	5b                   	pop    %ebx
+  800e4b:	5e                   	pop    %esi
+  800e4c:	5f                   	pop    %edi
+  800e4d:	5d                   	pop    %ebp
+  800e4e:	c3                   	ret
+  800e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e54:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e59:	89 d1                	mov    %edx,%ecx
+  800e5b:	89 d3                	mov    %edx,%ebx
+  800e5d:	89 d7                	mov    %edx,%edi
+  800e5f:	89 d6                	mov    %edx,%esi
+  800e61:	cd 30                	int    $0x30
+  800e63:	eb e5                	jmp    800e4a <sys_yield+0x30>
+
+00800e65 <sys_page_alloc>:
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	56                   	push   %esi
+  800e6a:	53                   	push   %ebx
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  800e6e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e79:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e81:	89 f7                	mov    %esi,%edi
+  800e83:	cd 30                	int    $0x30
+  800e85:	85 c0                	test   %eax,%eax
+  800e87:	7f 08                	jg     800e91 <sys_page_alloc+0x2c>
+  800e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8c:	5b                   	pop    %ebx
+  800e8d:	5e                   	pop    %esi
+  800e8e:	5f                   	pop    %edi
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+  800e91:	83 ec 0c             	sub    $0xc,%esp
+  800e94:	50                   	push   %eax
+  800e95:	6a 04                	push   $0x4
+  800e97:	68 cb 37 80 00       	push   $0x8037cb
+  800e9c:	6a 24                	push   $0x24
+  800e9e:	68 e8 37 80 00       	push   $0x8037e8
+  800ea3:	e8 8b f3 ff ff       	call   800233 <_panic>
+
+00800ea8 <sys_page_map>:
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	57                   	push   %edi
+  800eac:	56                   	push   %esi
+  800ead:	53                   	push   %ebx
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800eb8:	74 33                	je     800eed <sys_page_map+0x45>
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ec5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ecb:	ff 75 18             	push   0x18(%ebp)
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	8d 35 d9 0e 80 00    	lea    0x800ed9,%esi
+  800ed7:	0f 34                	sysenter
+  800ed9:	5d                   	pop    %ebp
+  800eda:	83 c4 04             	add    $0x4,%esp
+  800edd:	89 c2                	mov    %eax,%edx
+  800edf:	85 c0                	test   %eax,%eax
+  800ee1:	7f 3d                	jg     800f20 <sys_page_map+0x78>
+  800ee3:	89 d0                	mov    %edx,%eax
+  800ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+  800eed:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f01:	cd 30                	int    $0x30
+  800f03:	89 c2                	mov    %eax,%edx
+  800f05:	85 c0                	test   %eax,%eax
+  800f07:	7e da                	jle    800ee3 <sys_page_map+0x3b>
+  800f09:	83 ec 0c             	sub    $0xc,%esp
+  800f0c:	50                   	push   %eax
+  800f0d:	6a 05                	push   $0x5
+  800f0f:	68 cb 37 80 00       	push   $0x8037cb
+  800f14:	6a 24                	push   $0x24
+  800f16:	68 e8 37 80 00       	push   $0x8037e8
+  800f1b:	e8 13 f3 ff ff       	call   800233 <_panic>
+  800f20:	83 ec 0c             	sub    $0xc,%esp
+  800f23:	50                   	push   %eax
+  800f24:	6a 05                	push   $0x5
+  800f26:	68 cb 37 80 00       	push   $0x8037cb
+  800f2b:	6a 48                	push   $0x48
+  800f2d:	68 e8 37 80 00       	push   $0x8037e8
+  800f32:	e8 fc f2 ff ff       	call   800233 <_panic>
+
+00800f37 <sys_page_unmap>:
+  800f37:	55                   	push   %ebp
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	57                   	push   %edi
+  800f3b:	56                   	push   %esi
+  800f3c:	53                   	push   %ebx
+  800f3d:	83 ec 0c             	sub    $0xc,%esp
+  800f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f50:	89 df                	mov    %ebx,%edi
+  800f52:	89 de                	mov    %ebx,%esi
+  800f54:	cd 30                	int    $0x30
+  800f56:	85 c0                	test   %eax,%eax
+  800f58:	7f 08                	jg     800f62 <sys_page_unmap+0x2b>
+  800f5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5d:	5b                   	pop    %ebx
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+  800f62:	83 ec 0c             	sub    $0xc,%esp
+  800f65:	50                   	push   %eax
+  800f66:	6a 06                	push   $0x6
+  800f68:	68 cb 37 80 00       	push   $0x8037cb
+  800f6d:	6a 24                	push   $0x24
+  800f6f:	68 e8 37 80 00       	push   $0x8037e8
+  800f74:	e8 ba f2 ff ff       	call   800233 <_panic>
+
+00800f79 <sys_fork>:
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	57                   	push   %edi
+  800f7d:	56                   	push   %esi
+  800f7e:	53                   	push   %ebx
+  800f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f84:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f89:	89 d1                	mov    %edx,%ecx
+  800f8b:	89 d3                	mov    %edx,%ebx
+  800f8d:	89 d7                	mov    %edx,%edi
+  800f8f:	89 d6                	mov    %edx,%esi
+  800f91:	cd 30                	int    $0x30
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+
+00800f98 <sys_env_set_status>:
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  800fa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fac:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fb1:	89 df                	mov    %ebx,%edi
+  800fb3:	89 de                	mov    %ebx,%esi
+  800fb5:	cd 30                	int    $0x30
+  800fb7:	85 c0                	test   %eax,%eax
+  800fb9:	7f 08                	jg     800fc3 <sys_env_set_status+0x2b>
+  800fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5f                   	pop    %edi
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+  800fc6:	50                   	push   %eax
+  800fc7:	6a 08                	push   $0x8
+  800fc9:	68 cb 37 80 00       	push   $0x8037cb
+  800fce:	6a 24                	push   $0x24
+  800fd0:	68 e8 37 80 00       	push   $0x8037e8
+  800fd5:	e8 59 f2 ff ff       	call   800233 <_panic>
+
+00800fda <sys_env_set_trapframe>:
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	57                   	push   %edi
+  800fde:	56                   	push   %esi
+  800fdf:	53                   	push   %ebx
+  800fe0:	83 ec 0c             	sub    $0xc,%esp
+  800fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fee:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ff3:	89 df                	mov    %ebx,%edi
+  800ff5:	89 de                	mov    %ebx,%esi
+  800ff7:	cd 30                	int    $0x30
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	7f 08                	jg     801005 <sys_env_set_trapframe+0x2b>
+  800ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+  801005:	83 ec 0c             	sub    $0xc,%esp
+  801008:	50                   	push   %eax
+  801009:	6a 09                	push   $0x9
+  80100b:	68 cb 37 80 00       	push   $0x8037cb
+  801010:	6a 24                	push   $0x24
+  801012:	68 e8 37 80 00       	push   $0x8037e8
+  801017:	e8 17 f2 ff ff       	call   800233 <_panic>
+
+0080101c <sys_env_set_cow>:
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	83 ec 0c             	sub    $0xc,%esp
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 20 00 00 00       	mov    $0x20,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	89 de                	mov    %ebx,%esi
+  801039:	cd 30                	int    $0x30
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 08                	jg     801047 <sys_env_set_cow+0x2b>
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 20                	push   $0x20
+  80104d:	68 cb 37 80 00       	push   $0x8037cb
+  801052:	6a 24                	push   $0x24
+  801054:	68 e8 37 80 00       	push   $0x8037e8
+  801059:	e8 d5 f1 ff ff       	call   800233 <_panic>
+
+0080105e <sys_env_service>:
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801071:	89 cb                	mov    %ecx,%ebx
+  801073:	89 cf                	mov    %ecx,%edi
+  801075:	89 ce                	mov    %ecx,%esi
+  801077:	cd 30                	int    $0x30
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+
+0080107e <sys_env_set_pgfault_upcall>:
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801097:	89 df                	mov    %ebx,%edi
+  801099:	89 de                	mov    %ebx,%esi
+  80109b:	cd 30                	int    $0x30
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	7f 08                	jg     8010a9 <sys_env_set_pgfault_upcall+0x2b>
+  8010a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a4:	5b                   	pop    %ebx
+  8010a5:	5e                   	pop    %esi
+  8010a6:	5f                   	pop    %edi
+  8010a7:	5d                   	pop    %ebp
+  8010a8:	c3                   	ret
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 0a                	push   $0xa
+  8010af:	68 cb 37 80 00       	push   $0x8037cb
+  8010b4:	6a 24                	push   $0x24
+  8010b6:	68 e8 37 80 00       	push   $0x8037e8
+  8010bb:	e8 73 f1 ff ff       	call   800233 <_panic>
+
+008010c0 <sys_ipc_try_send>:
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010cd:	74 27                	je     8010f6 <sys_ipc_try_send+0x36>
+  8010cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e0:	6a 00                	push   $0x0
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	8d 35 ed 10 80 00    	lea    0x8010ed,%esi
+  8010eb:	0f 34                	sysenter
+  8010ed:	5d                   	pop    %ebp
+  8010ee:	83 c4 04             	add    $0x4,%esp
+  8010f1:	5b                   	pop    %ebx
+  8010f2:	5e                   	pop    %esi
+  8010f3:	5f                   	pop    %edi
+  8010f4:	5d                   	pop    %ebp
+  8010f5:	c3                   	ret
+  8010f6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801100:	8b 55 08             	mov    0x8(%ebp),%edx
+  801103:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801106:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801109:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80110c:	cd 30                	int    $0x30
+  80110e:	eb e1                	jmp    8010f1 <sys_ipc_try_send+0x31>
+
+00801110 <sys_ipc_recv>:
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	57                   	push   %edi
+  801114:	56                   	push   %esi
+  801115:	53                   	push   %ebx
+  801116:	83 ec 0c             	sub    $0xc,%esp
+  801119:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801120:	74 32                	je     801154 <sys_ipc_recv+0x44>
+  801122:	8b 55 08             	mov    0x8(%ebp),%edx
+  801125:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80112a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80112f:	89 cb                	mov    %ecx,%ebx
+  801131:	89 cf                	mov    %ecx,%edi
+  801133:	6a 00                	push   $0x0
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	8d 35 40 11 80 00    	lea    0x801140,%esi
+  80113e:	0f 34                	sysenter
+  801140:	5d                   	pop    %ebp
+  801141:	83 c4 04             	add    $0x4,%esp
+  801144:	89 c2                	mov    %eax,%edx
+  801146:	85 c0                	test   %eax,%eax
+  801148:	7f 3c                	jg     801186 <sys_ipc_recv+0x76>
+  80114a:	89 d0                	mov    %edx,%eax
+  80114c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114f:	5b                   	pop    %ebx
+  801150:	5e                   	pop    %esi
+  801151:	5f                   	pop    %edi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+  801154:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801159:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	89 cb                	mov    %ecx,%ebx
+  801163:	89 cf                	mov    %ecx,%edi
+  801165:	89 ce                	mov    %ecx,%esi
+  801167:	cd 30                	int    $0x30
+  801169:	89 c2                	mov    %eax,%edx
+  80116b:	85 c0                	test   %eax,%eax
+  80116d:	7e db                	jle    80114a <sys_ipc_recv+0x3a>
+  80116f:	83 ec 0c             	sub    $0xc,%esp
+  801172:	50                   	push   %eax
+  801173:	6a 0d                	push   $0xd
+  801175:	68 cb 37 80 00       	push   $0x8037cb
+  80117a:	6a 24                	push   $0x24
+  80117c:	68 e8 37 80 00       	push   $0x8037e8
+  801181:	e8 ad f0 ff ff       	call   800233 <_panic>
+  801186:	83 ec 0c             	sub    $0xc,%esp
+  801189:	50                   	push   %eax
+  80118a:	6a 0d                	push   $0xd
+  80118c:	68 cb 37 80 00       	push   $0x8037cb
+  801191:	6a 48                	push   $0x48
+  801193:	68 e8 37 80 00       	push   $0x8037e8
+  801198:	e8 96 f0 ff ff       	call   800233 <_panic>
+
+0080119d <sys_ipc_send>:
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	57                   	push   %edi
+  8011a1:	56                   	push   %esi
+  8011a2:	53                   	push   %ebx
+  8011a3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011aa:	74 27                	je     8011d3 <sys_ipc_send+0x36>
+  8011ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011bd:	6a 00                	push   $0x0
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	8d 35 ca 11 80 00    	lea    0x8011ca,%esi
+  8011c8:	0f 34                	sysenter
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	83 c4 04             	add    $0x4,%esp
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5e                   	pop    %esi
+  8011d0:	5f                   	pop    %edi
+  8011d1:	5d                   	pop    %ebp
+  8011d2:	c3                   	ret
+  8011d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e9:	cd 30                	int    $0x30
+  8011eb:	eb e1                	jmp    8011ce <sys_ipc_send+0x31>
+
+008011ed <sys_ipc_call>:
+  8011ed:	55                   	push   %ebp
+  8011ee:	89 e5                	mov    %esp,%ebp
+  8011f0:	57                   	push   %edi
+  8011f1:	56                   	push   %esi
+  8011f2:	53                   	push   %ebx
+  8011f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801201:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801204:	8b 75 18             	mov    0x18(%ebp),%esi
+  801207:	cd 30                	int    $0x30
+  801209:	5b                   	pop    %ebx
+  80120a:	5e                   	pop    %esi
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+
+0080120e <sys_ipc_reply_recv>:
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	57                   	push   %edi
+  801212:	56                   	push   %esi
+  801213:	53                   	push   %ebx
+  801214:	8b 55 08             	mov    0x8(%ebp),%edx
+  801217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80121f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801222:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801225:	8b 75 18             	mov    0x18(%ebp),%esi
+  801228:	cd 30                	int    $0x30
+  80122a:	5b                   	pop    %ebx
+  80122b:	5e                   	pop    %esi
+  80122c:	5f                   	pop    %edi
+  80122d:	5d                   	pop    %ebp
+  80122e:	c3                   	ret
+
+0080122f <sys_time_msec>:
+  80122f:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801234:	85 c0                	test   %eax,%eax
+  801236:	75 06                	jne    80123e <sys_time_msec+0xf>
+  801238:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80123d:	c3                   	ret
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	57                   	push   %edi
+  801242:	56                   	push   %esi
+  801243:	53                   	push   %ebx
+  801244:	83 ec 0c             	sub    $0xc,%esp
+  801247:	0f 31                	rdtsc
+  801249:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80124f:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801255:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80125b:	29 c8                	sub    %ecx,%eax
+  80125d:	19 da                	sbb    %ebx,%edx
+  80125f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801264:	57                   	push   %edi
+  801265:	56                   	push   %esi
+  801266:	52                   	push   %edx
+  801267:	50                   	push   %eax
+  801268:	e8 5f 20 00 00       	call   8032cc <__udivdi3>
+  80126d:	83 c4 10             	add    $0x10,%esp
+  801270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801273:	5b                   	pop    %ebx
+  801274:	5e                   	pop    %esi
+  801275:	5f                   	pop    %edi
+  801276:	5d                   	pop    %ebp
+  801277:	c3                   	ret
+
+00801278 <sys_env_swap>:
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	57                   	push   %edi
+  80127c:	56                   	push   %esi
+  80127d:	53                   	push   %ebx
+  80127e:	83 ec 0c             	sub    $0xc,%esp
+  801281:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801286:	8b 55 08             	mov    0x8(%ebp),%edx
+  801289:	b8 12 00 00 00       	mov    $0x12,%eax
+  80128e:	89 cb                	mov    %ecx,%ebx
+  801290:	89 cf                	mov    %ecx,%edi
+  801292:	89 ce                	mov    %ecx,%esi
+  801294:	cd 30                	int    $0x30
+  801296:	85 c0                	test   %eax,%eax
+  801298:	7f 08                	jg     8012a2 <sys_env_swap+0x2a>
+  80129a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+  8012a2:	83 ec 0c             	sub    $0xc,%esp
+  8012a5:	50                   	push   %eax
+  8012a6:	6a 12                	push   $0x12
+  8012a8:	68 cb 37 80 00       	push   $0x8037cb
+  8012ad:	6a 24                	push   $0x24
+  8012af:	68 e8 37 80 00       	push   $0x8037e8
+  8012b4:	e8 7a ef ff ff       	call   800233 <_panic>
+
+008012b9 <sys_net_try_send>:
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	57                   	push   %edi
+  8012bd:	56                   	push   %esi
+  8012be:	53                   	push   %ebx
+  8012bf:	83 ec 0c             	sub    $0xc,%esp
+  8012c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012d2:	89 df                	mov    %ebx,%edi
+  8012d4:	89 de                	mov    %ebx,%esi
+  8012d6:	cd 30                	int    $0x30
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	7f 08                	jg     8012e4 <sys_net_try_send+0x2b>
+  8012dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012df:	5b                   	pop    %ebx
+  8012e0:	5e                   	pop    %esi
+  8012e1:	5f                   	pop    %edi
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+  8012e4:	83 ec 0c             	sub    $0xc,%esp
+  8012e7:	50                   	push   %eax
+  8012e8:	6a 13                	push   $0x13
+  8012ea:	68 cb 37 80 00       	push   $0x8037cb
+  8012ef:	6a 24                	push   $0x24
+  8012f1:	68 e8 37 80 00       	push   $0x8037e8
+  8012f6:	e8 38 ef ff ff       	call   800233 <_panic>
+
+008012fb <sys_net_try_receive>:
+  8012fb:	55                   	push   %ebp
+  8012fc:	89 e5                	mov    %esp,%ebp
+  8012fe:	57                   	push   %edi
+  8012ff:	56                   	push   %esi
+  801300:	53                   	push   %ebx
+  801301:	83 ec 0c             	sub    $0xc,%esp
+  801304:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801309:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801314:	89 df                	mov    %ebx,%edi
+  801316:	89 de                	mov    %ebx,%esi
+  801318:	cd 30                	int    $0x30
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	7f 08                	jg     801326 <sys_net_try_receive+0x2b>
+  80131e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801321:	5b                   	pop    %ebx
+  801322:	5e                   	pop    %esi
+  801323:	5f                   	pop    %edi
+  801324:	5d                   	pop    %ebp
+  801325:	c3                   	ret
+  801326:	83 ec 0c             	sub    $0xc,%esp
+  801329:	50                   	push   %eax
+  80132a:	6a 14                	push   $0x14
+  80132c:	68 cb 37 80 00       	push   $0x8037cb
+  801331:	6a 24                	push   $0x24
+  801333:	68 e8 37 80 00       	push   $0x8037e8
+  801338:	e8 f6 ee ff ff       	call   800233 <_panic>
+
+0080133d <sys_net_recv_page>:
+  80133d:	55                   	push   %ebp
+  80133e:	89 e5                	mov    %esp,%ebp
+  801340:	57                   	push   %edi
+  801341:	56                   	push   %esi
+  801342:	53                   	push   %ebx
+  801343:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134b:	b8 27 00 00 00       	mov    $0x27,%eax
+  801350:	89 cb                	mov    %ecx,%ebx
+  801352:	89 cf                	mov    %ecx,%edi
+  801354:	89 ce                	mov    %ecx,%esi
+  801356:	cd 30                	int    $0x30
+  801358:	5b                   	pop    %ebx
+  801359:	5e                   	pop    %esi
+  80135a:	5f                   	pop    %edi
+  80135b:	5d                   	pop    %ebp
+  80135c:	c3                   	ret
+
+0080135d <sys_net_wait>:
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	57                   	push   %edi
+  801361:	56                   	push   %esi
+  801362:	53                   	push   %ebx
+  801363:	ba 00 00 00 00       	mov    $0x0,%edx
+  801368:	b8 26 00 00 00       	mov    $0x26,%eax
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	89 d3                	mov    %edx,%ebx
+  801371:	89 d7                	mov    %edx,%edi
+  801373:	89 d6                	mov    %edx,%esi
+  801375:	cd 30                	int    $0x30
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5f                   	pop    %edi
+  80137a:	5d                   	pop    %ebp
+  80137b:	c3                   	ret
+
+0080137c <sys_get_mac>:
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	57                   	push   %edi
+  801380:	56                   	push   %esi
+  801381:	53                   	push   %ebx
+  801382:	83 ec 0c             	sub    $0xc,%esp
+  801385:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801390:	b8 15 00 00 00       	mov    $0x15,%eax
+  801395:	89 df                	mov    %ebx,%edi
+  801397:	89 de                	mov    %ebx,%esi
+  801399:	cd 30                	int    $0x30
+  80139b:	85 c0                	test   %eax,%eax
+  80139d:	7f 08                	jg     8013a7 <sys_get_mac+0x2b>
+  80139f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5f                   	pop    %edi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+  8013aa:	50                   	push   %eax
+  8013ab:	6a 15                	push   $0x15
+  8013ad:	68 cb 37 80 00       	push   $0x8037cb
+  8013b2:	6a 24                	push   $0x24
+  8013b4:	68 e8 37 80 00       	push   $0x8037e8
+  8013b9:	e8 75 ee ff ff       	call   800233 <_panic>
+
+008013be <sys_env_lease>:
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	57                   	push   %edi
+  8013c2:	56                   	push   %esi
+  8013c3:	53                   	push   %ebx
+  8013c4:	83 ec 0c             	sub    $0xc,%esp
+  8013c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013d7:	89 df                	mov    %ebx,%edi
+  8013d9:	89 de                	mov    %ebx,%esi
+  8013db:	cd 30                	int    $0x30
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	7f 08                	jg     8013e9 <sys_env_lease+0x2b>
+  8013e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e4:	5b                   	pop    %ebx
+  8013e5:	5e                   	pop    %esi
+  8013e6:	5f                   	pop    %edi
+  8013e7:	5d                   	pop    %ebp
+  8013e8:	c3                   	ret
+  8013e9:	83 ec 0c             	sub    $0xc,%esp
+  8013ec:	50                   	push   %eax
+  8013ed:	6a 16                	push   $0x16
+  8013ef:	68 cb 37 80 00       	push   $0x8037cb
+  8013f4:	6a 24                	push   $0x24
+  8013f6:	68 e8 37 80 00       	push   $0x8037e8
+  8013fb:	e8 33 ee ff ff       	call   800233 <_panic>
+
+00801400 <sys_copy_mem>:
+  801400:	55                   	push   %ebp
+  801401:	89 e5                	mov    %esp,%ebp
+  801403:	57                   	push   %edi
+  801404:	56                   	push   %esi
+  801405:	53                   	push   %ebx
+  801406:	83 ec 0c             	sub    $0xc,%esp
+  801409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801414:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801417:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80141a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80141d:	cd 30                	int    $0x30
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	7f 08                	jg     80142b <sys_copy_mem+0x2b>
+  801423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5f                   	pop    %edi
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+  80142b:	83 ec 0c             	sub    $0xc,%esp
+  80142e:	50                   	push   %eax
+  80142f:	6a 17                	push   $0x17
+  801431:	68 cb 37 80 00       	push   $0x8037cb
+  801436:	6a 24                	push   $0x24
+  801438:	68 e8 37 80 00       	push   $0x8037e8
+  80143d:	e8 f1 ed ff ff       	call   800233 <_panic>
+
+00801442 <sys_get_perms>:
+  801442:	55                   	push   %ebp
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	57                   	push   %edi
+  801446:	56                   	push   %esi
+  801447:	53                   	push   %ebx
+  801448:	83 ec 0c             	sub    $0xc,%esp
+  80144b:	be 00 00 00 00       	mov    $0x0,%esi
+  801450:	8b 55 08             	mov    0x8(%ebp),%edx
+  801453:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801456:	b8 18 00 00 00       	mov    $0x18,%eax
+  80145b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80145e:	89 f7                	mov    %esi,%edi
+  801460:	cd 30                	int    $0x30
+  801462:	85 c0                	test   %eax,%eax
+  801464:	7f 08                	jg     80146e <sys_get_perms+0x2c>
+  801466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801469:	5b                   	pop    %ebx
+  80146a:	5e                   	pop    %esi
+  80146b:	5f                   	pop    %edi
+  80146c:	5d                   	pop    %ebp
+  80146d:	c3                   	ret
+  80146e:	83 ec 0c             	sub    $0xc,%esp
+  801471:	50                   	push   %eax
+  801472:	6a 18                	push   $0x18
+  801474:	68 cb 37 80 00       	push   $0x8037cb
+  801479:	6a 24                	push   $0x24
+  80147b:	68 e8 37 80 00       	push   $0x8037e8
+  801480:	e8 ae ed ff ff       	call   800233 <_panic>
+
+00801485 <sys_env_unsuspend>:
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	57                   	push   %edi
+  801489:	56                   	push   %esi
+  80148a:	53                   	push   %ebx
+  80148b:	83 ec 0c             	sub    $0xc,%esp
+  80148e:	be 00 00 00 00       	mov    $0x0,%esi
+  801493:	8b 55 08             	mov    0x8(%ebp),%edx
+  801496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801499:	b8 19 00 00 00       	mov    $0x19,%eax
+  80149e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a1:	89 f7                	mov    %esi,%edi
+  8014a3:	cd 30                	int    $0x30
+  8014a5:	85 c0                	test   %eax,%eax
+  8014a7:	7f 08                	jg     8014b1 <sys_env_unsuspend+0x2c>
+  8014a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ac:	5b                   	pop    %ebx
+  8014ad:	5e                   	pop    %esi
+  8014ae:	5f                   	pop    %edi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+  8014b1:	83 ec 0c             	sub    $0xc,%esp
+  8014b4:	50                   	push   %eax
+  8014b5:	6a 19                	push   $0x19
+  8014b7:	68 cb 37 80 00       	push   $0x8037cb
+  8014bc:	6a 24                	push   $0x24
+  8014be:	68 e8 37 80 00       	push   $0x8037e8
+  8014c3:	e8 6b ed ff ff       	call   800233 <_panic>
+
+008014c8 <sys_migrate>:
+  8014c8:	55                   	push   %ebp
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	57                   	push   %edi
+  8014cc:	56                   	push   %esi
+  8014cd:	53                   	push   %ebx
+  8014ce:	83 ec 0c             	sub    $0xc,%esp
+  8014d1:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8014d6:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8014dc:	76 11                	jbe    8014ef <sys_migrate+0x27>
+  8014de:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8014e3:	0f b6 08             	movzbl (%eax),%ecx
+  8014e6:	05 00 10 00 00       	add    $0x1000,%eax
+  8014eb:	39 d0                	cmp    %edx,%eax
+  8014ed:	72 f4                	jb     8014e3 <sys_migrate+0x1b>
+  8014ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014fc:	89 cb                	mov    %ecx,%ebx
+  8014fe:	89 cf                	mov    %ecx,%edi
+  801500:	89 ce                	mov    %ecx,%esi
+  801502:	cd 30                	int    $0x30
+  801504:	85 c0                	test   %eax,%eax
+  801506:	7f 08                	jg     801510 <sys_migrate+0x48>
+  801508:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150b:	5b                   	pop    %ebx
+  80150c:	5e                   	pop    %esi
+  80150d:	5f                   	pop    %edi
+  80150e:	5d                   	pop    %ebp
+  80150f:	c3                   	ret
+  801510:	83 ec 0c             	sub    $0xc,%esp
+  801513:	50                   	push   %eax
+  801514:	6a 1a                	push   $0x1a
+  801516:	68 cb 37 80 00       	push   $0x8037cb
+  80151b:	6a 24                	push   $0x24
+  80151d:	68 e8 37 80 00       	push   $0x8037e8
+  801522:	e8 0c ed ff ff       	call   800233 <_panic>
+
+00801527 <sys_lease_complete>:
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	57                   	push   %edi
+  80152b:	56                   	push   %esi
+  80152c:	53                   	push   %ebx
+  80152d:	83 ec 0c             	sub    $0xc,%esp
+  801530:	ba 00 00 00 00       	mov    $0x0,%edx
+  801535:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80153a:	89 d1                	mov    %edx,%ecx
+  80153c:	89 d3                	mov    %edx,%ebx
+  80153e:	89 d7                	mov    %edx,%edi
+  801540:	89 d6                	mov    %edx,%esi
+  801542:	cd 30                	int    $0x30
+  801544:	85 c0                	test   %eax,%eax
+  801546:	7f 08                	jg     801550 <sys_lease_complete+0x29>
+  801548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154b:	5b                   	pop    %ebx
+  80154c:	5e                   	pop    %esi
+  80154d:	5f                   	pop    %edi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+  801550:	83 ec 0c             	sub    $0xc,%esp
+  801553:	50                   	push   %eax
+  801554:	6a 1b                	push   $0x1b
+  801556:	68 cb 37 80 00       	push   $0x8037cb
+  80155b:	6a 24                	push   $0x24
+  80155d:	68 e8 37 80 00       	push   $0x8037e8
+  801562:	e8 cc ec ff ff       	call   800233 <_panic>
+
+00801567 <sys_env_set_thisenv>:
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	57                   	push   %edi
+  80156b:	56                   	push   %esi
+  80156c:	53                   	push   %ebx
+  80156d:	83 ec 0c             	sub    $0xc,%esp
+  801570:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801575:	8b 55 08             	mov    0x8(%ebp),%edx
+  801578:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801580:	89 df                	mov    %ebx,%edi
+  801582:	89 de                	mov    %ebx,%esi
+  801584:	cd 30                	int    $0x30
+  801586:	85 c0                	test   %eax,%eax
+  801588:	7f 08                	jg     801592 <sys_env_set_thisenv+0x2b>
+  80158a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80158d:	5b                   	pop    %ebx
+  80158e:	5e                   	pop    %esi
+  80158f:	5f                   	pop    %edi
+  801590:	5d                   	pop    %ebp
+  801591:	c3                   	ret
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	50                   	push   %eax
+  801596:	6a 1c                	push   $0x1c
+  801598:	68 cb 37 80 00       	push   $0x8037cb
+  80159d:	6a 24                	push   $0x24
+  80159f:	68 e8 37 80 00       	push   $0x8037e8
+  8015a4:	e8 8a ec ff ff       	call   800233 <_panic>
+
+008015a9 <sys_env_set_sched>:
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	57                   	push   %edi
+  8015ad:	56                   	push   %esi
+  8015ae:	53                   	push   %ebx
+  8015af:	83 ec 0c             	sub    $0xc,%esp
+  8015b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c5:	89 f7                	mov    %esi,%edi
+  8015c7:	cd 30                	int    $0x30
+  8015c9:	85 c0                	test   %eax,%eax
+  8015cb:	7f 08                	jg     8015d5 <sys_env_set_sched+0x2c>
+  8015cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d0:	5b                   	pop    %ebx
+  8015d1:	5e                   	pop    %esi
+  8015d2:	5f                   	pop    %edi
+  8015d3:	5d                   	pop    %ebp
+  8015d4:	c3                   	ret
+  8015d5:	83 ec 0c             	sub    $0xc,%esp
+  8015d8:	50                   	push   %eax
+  8015d9:	6a 1d                	push   $0x1d
+  8015db:	68 cb 37 80 00       	push   $0x8037cb
+  8015e0:	6a 24                	push   $0x24
+  8015e2:	68 e8 37 80 00       	push   $0x8037e8
+  8015e7:	e8 47 ec ff ff       	call   800233 <_panic>
+
+008015ec <sys_batch>:
+  8015ec:	55                   	push   %ebp
+  8015ed:	89 e5                	mov    %esp,%ebp
+  8015ef:	57                   	push   %edi
+  8015f0:	56                   	push   %esi
+  8015f1:	53                   	push   %ebx
+  8015f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801602:	89 df                	mov    %ebx,%edi
+  801604:	89 de                	mov    %ebx,%esi
+  801606:	cd 30                	int    $0x30
+  801608:	5b                   	pop    %ebx
+  801609:	5e                   	pop    %esi
+  80160a:	5f                   	pop    %edi
+  80160b:	5d                   	pop    %ebp
+  80160c:	c3                   	ret
+
+0080160d <sys_env_stats>:
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801618:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161e:	b8 23 00 00 00       	mov    $0x23,%eax
+  801623:	89 df                	mov    %ebx,%edi
+  801625:	89 de                	mov    %ebx,%esi
+  801627:	cd 30                	int    $0x30
+  801629:	5b                   	pop    %ebx
+  80162a:	5e                   	pop    %esi
+  80162b:	5f                   	pop    %edi
+  80162c:	5d                   	pop    %ebp
+  80162d:	c3                   	ret
+
+0080162e <sys_trace>:
+  80162e:	55                   	push   %ebp
+  80162f:	89 e5                	mov    %esp,%ebp
+  801631:	57                   	push   %edi
+  801632:	56                   	push   %esi
+  801633:	53                   	push   %ebx
+  801634:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801639:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163c:	b8 24 00 00 00       	mov    $0x24,%eax
+  801641:	89 cb                	mov    %ecx,%ebx
+  801643:	89 cf                	mov    %ecx,%edi
+  801645:	89 ce                	mov    %ecx,%esi
+  801647:	cd 30                	int    $0x30
+  801649:	5b                   	pop    %ebx
+  80164a:	5e                   	pop    %esi
+  80164b:	5f                   	pop    %edi
+  80164c:	5d                   	pop    %ebp
+  80164d:	c3                   	ret
+
+0080164e <sys_env_set_pager>:
+  80164e:	55                   	push   %ebp
+  80164f:	89 e5                	mov    %esp,%ebp
+  801651:	57                   	push   %edi
+  801652:	56                   	push   %esi
+  801653:	53                   	push   %ebx
+  801654:	83 ec 0c             	sub    $0xc,%esp
+  801657:	be 00 00 00 00       	mov    $0x0,%esi
+  80165c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801662:	b8 25 00 00 00       	mov    $0x25,%eax
+  801667:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80166a:	89 f7                	mov    %esi,%edi
+  80166c:	cd 30                	int    $0x30
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	7f 08                	jg     80167a <sys_env_set_pager+0x2c>
+  801672:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801675:	5b                   	pop    %ebx
+  801676:	5e                   	pop    %esi
+  801677:	5f                   	pop    %edi
+  801678:	5d                   	pop    %ebp
+  801679:	c3                   	ret
+  80167a:	83 ec 0c             	sub    $0xc,%esp
+  80167d:	50                   	push   %eax
+  80167e:	6a 25                	push   $0x25
+  801680:	68 cb 37 80 00       	push   $0x8037cb
+  801685:	6a 24                	push   $0x24
+  801687:	68 e8 37 80 00       	push   $0x8037e8
+  80168c:	e8 a2 eb ff ff       	call   800233 <_panic>
+
+00801691 <sys_pager_retire>:
+  801691:	55                   	push   %ebp
+  801692:	89 e5                	mov    %esp,%ebp
+  801694:	57                   	push   %edi
+  801695:	56                   	push   %esi
+  801696:	53                   	push   %ebx
+  801697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169f:	b8 28 00 00 00       	mov    $0x28,%eax
+  8016a4:	89 cb                	mov    %ecx,%ebx
+  8016a6:	89 cf                	mov    %ecx,%edi
+  8016a8:	89 ce                	mov    %ecx,%esi
+  8016aa:	cd 30                	int    $0x30
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5f                   	pop    %edi
+  8016af:	5d                   	pop    %ebp
+  8016b0:	c3                   	ret
+
+008016b1 <sys_prof>:
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	57                   	push   %edi
+  8016b5:	56                   	push   %esi
+  8016b6:	53                   	push   %ebx
+  8016b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c2:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016ca:	89 f7                	mov    %esi,%edi
+  8016cc:	cd 30                	int    $0x30
+  8016ce:	5b                   	pop    %ebx
+  8016cf:	5e                   	pop    %esi
+  8016d0:	5f                   	pop    %edi
+  8016d1:	5d                   	pop    %ebp
+  8016d2:	c3                   	ret
+
+008016d3 <fd2num>:
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016de:	c1 e8 0c             	shr    $0xc,%eax
+  8016e1:	5d                   	pop    %ebp
+  8016e2:	c3                   	ret
+
+008016e3 <fd2data>:
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016ee:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016f3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+
+008016fa <fd_alloc>:
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801702:	89 c2                	mov    %eax,%edx
+  801704:	c1 ea 16             	shr    $0x16,%edx
+  801707:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80170e:	f6 c2 01             	test   $0x1,%dl
+  801711:	74 29                	je     80173c <fd_alloc+0x42>
+  801713:	89 c2                	mov    %eax,%edx
+  801715:	c1 ea 0c             	shr    $0xc,%edx
+  801718:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80171f:	f6 c2 01             	test   $0x1,%dl
+  801722:	74 18                	je     80173c <fd_alloc+0x42>
+  801724:	05 00 10 00 00       	add    $0x1000,%eax
+  801729:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80172e:	75 d2                	jne    801702 <fd_alloc+0x8>
+  801730:	b8 00 00 00 00       	mov    $0x0,%eax
+  801735:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80173a:	eb 05                	jmp    801741 <fd_alloc+0x47>
+  80173c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801741:	8b 55 08             	mov    0x8(%ebp),%edx
+  801744:	89 02                	mov    %eax,(%edx)
+  801746:	89 c8                	mov    %ecx,%eax
+  801748:	5d                   	pop    %ebp
+  801749:	c3                   	ret
+
+0080174a <fd_lookup>:
+  80174a:	55                   	push   %ebp
+  80174b:	89 e5                	mov    %esp,%ebp
+  80174d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801750:	83 f8 1f             	cmp    $0x1f,%eax
+  801753:	77 30                	ja     801785 <fd_lookup+0x3b>
+  801755:	c1 e0 0c             	shl    $0xc,%eax
+  801758:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  80175d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801763:	f6 c2 01             	test   $0x1,%dl
+  801766:	74 24                	je     80178c <fd_lookup+0x42>
+  801768:	89 c2                	mov    %eax,%edx
+  80176a:	c1 ea 0c             	shr    $0xc,%edx
+  80176d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801774:	f6 c2 01             	test   $0x1,%dl
+  801777:	74 1a                	je     801793 <fd_lookup+0x49>
+  801779:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80177c:	89 02                	mov    %eax,(%edx)
+  80177e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801783:	5d                   	pop    %ebp
+  801784:	c3                   	ret
+  801785:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178a:	eb f7                	jmp    801783 <fd_lookup+0x39>
+  80178c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801791:	eb f0                	jmp    801783 <fd_lookup+0x39>
+  801793:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801798:	eb e9                	jmp    801783 <fd_lookup+0x39>
+
+0080179a <dev_lookup>:
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	53                   	push   %ebx
+  80179e:	83 ec 04             	sub    $0x4,%esp
+  8017a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a9:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8017ae:	39 13                	cmp    %edx,(%ebx)
+  8017b0:	74 37                	je     8017e9 <dev_lookup+0x4f>
+  8017b2:	83 c0 01             	add    $0x1,%eax
+  8017b5:	8b 1c 85 74 38 80 00 	mov    0x803874(,%eax,4),%ebx
+  8017bc:	85 db                	test   %ebx,%ebx
+  8017be:	75 ee                	jne    8017ae <dev_lookup+0x14>
+  8017c0:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  8017c5:	8b 40 48             	mov    0x48(%eax),%eax
+  8017c8:	83 ec 04             	sub    $0x4,%esp
+  8017cb:	52                   	push   %edx
+  8017cc:	50                   	push   %eax
+  8017cd:	68 f8 37 80 00       	push   $0x8037f8
+  8017d2:	e8 37 eb ff ff       	call   80030e <cprintf>
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017e2:	89 1a                	mov    %ebx,(%edx)
+  8017e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e7:	c9                   	leave
+  8017e8:	c3                   	ret
+  8017e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ee:	eb ef                	jmp    8017df <dev_lookup+0x45>
+
+008017f0 <fd_close>:
+  8017f0:	55                   	push   %ebp
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	57                   	push   %edi
+  8017f4:	56                   	push   %esi
+  8017f5:	53                   	push   %ebx
+  8017f6:	83 ec 24             	sub    $0x24,%esp
+  8017f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017fc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8017ff:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801802:	50                   	push   %eax
+  801803:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801809:	c1 e8 0c             	shr    $0xc,%eax
+  80180c:	50                   	push   %eax
+  80180d:	e8 38 ff ff ff       	call   80174a <fd_lookup>
+  801812:	89 c3                	mov    %eax,%ebx
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	85 c0                	test   %eax,%eax
+  801819:	78 05                	js     801820 <fd_close+0x30>
+  80181b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80181e:	74 0f                	je     80182f <fd_close+0x3f>
+  801820:	85 ff                	test   %edi,%edi
+  801822:	0f 44 df             	cmove  %edi,%ebx
+  801825:	89 d8                	mov    %ebx,%eax
+  801827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80182a:	5b                   	pop    %ebx
+  80182b:	5e                   	pop    %esi
+  80182c:	5f                   	pop    %edi
+  80182d:	5d                   	pop    %ebp
+  80182e:	c3                   	ret
+  80182f:	83 ec 08             	sub    $0x8,%esp
+  801832:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801835:	50                   	push   %eax
+  801836:	ff 36                	push   (%esi)
+  801838:	e8 5d ff ff ff       	call   80179a <dev_lookup>
+  80183d:	89 c3                	mov    %eax,%ebx
+  80183f:	83 c4 10             	add    $0x10,%esp
+  801842:	85 c0                	test   %eax,%eax
+  801844:	78 1a                	js     801860 <fd_close+0x70>
+  801846:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801849:	8b 40 10             	mov    0x10(%eax),%eax
+  80184c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801851:	85 c0                	test   %eax,%eax
+  801853:	74 0b                	je     801860 <fd_close+0x70>
+  801855:	83 ec 0c             	sub    $0xc,%esp
+  801858:	56                   	push   %esi
+  801859:	ff d0                	call   *%eax
+  80185b:	89 c3                	mov    %eax,%ebx
+  80185d:	83 c4 10             	add    $0x10,%esp
+  801860:	83 ec 08             	sub    $0x8,%esp
+  801863:	56                   	push   %esi
+  801864:	6a 00                	push   $0x0
+  801866:	e8 cc f6 ff ff       	call   800f37 <sys_page_unmap>
+  80186b:	83 c4 10             	add    $0x10,%esp
+  80186e:	eb b5                	jmp    801825 <fd_close+0x35>
+
+00801870 <close>:
+  801870:	55                   	push   %ebp
+  801871:	89 e5                	mov    %esp,%ebp
+  801873:	83 ec 20             	sub    $0x20,%esp
+  801876:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801879:	50                   	push   %eax
+  80187a:	ff 75 08             	push   0x8(%ebp)
+  80187d:	e8 c8 fe ff ff       	call   80174a <fd_lookup>
+  801882:	83 c4 10             	add    $0x10,%esp
+  801885:	85 c0                	test   %eax,%eax
+  801887:	79 02                	jns    80188b <close+0x1b>
+  801889:	c9                   	leave
+  80188a:	c3                   	ret
+  80188b:	83 ec 08             	sub    $0x8,%esp
+  80188e:	6a 01                	push   $0x1
+  801890:	ff 75 f4             	push   -0xc(%ebp)
+  801893:	e8 58 ff ff ff       	call   8017f0 <fd_close>
+  801898:	83 c4 10             	add    $0x10,%esp
+  80189b:	eb ec                	jmp    801889 <close+0x19>
+
+0080189d <close_all>:
+  80189d:	55                   	push   %ebp
+  80189e:	89 e5                	mov    %esp,%ebp
+  8018a0:	53                   	push   %ebx
+  8018a1:	83 ec 04             	sub    $0x4,%esp
+  8018a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a9:	83 ec 0c             	sub    $0xc,%esp
+  8018ac:	53                   	push   %ebx
+  8018ad:	e8 be ff ff ff       	call   801870 <close>
+  8018b2:	83 c3 01             	add    $0x1,%ebx
+  8018b5:	83 c4 10             	add    $0x10,%esp
+  8018b8:	83 fb 20             	cmp    $0x20,%ebx
+  8018bb:	75 ec                	jne    8018a9 <close_all+0xc>
+  8018bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c0:	c9                   	leave
+  8018c1:	c3                   	ret
+
+008018c2 <dup>:
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	57                   	push   %edi
+  8018c6:	56                   	push   %esi
+  8018c7:	53                   	push   %ebx
+  8018c8:	83 ec 34             	sub    $0x34,%esp
+  8018cb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018ce:	50                   	push   %eax
+  8018cf:	ff 75 08             	push   0x8(%ebp)
+  8018d2:	e8 73 fe ff ff       	call   80174a <fd_lookup>
+  8018d7:	89 c3                	mov    %eax,%ebx
+  8018d9:	83 c4 10             	add    $0x10,%esp
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	78 7f                	js     80195f <dup+0x9d>
+  8018e0:	83 ec 0c             	sub    $0xc,%esp
+  8018e3:	ff 75 0c             	push   0xc(%ebp)
+  8018e6:	e8 85 ff ff ff       	call   801870 <close>
+  8018eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018ee:	c1 e6 0c             	shl    $0xc,%esi
+  8018f1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8018f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018fa:	89 3c 24             	mov    %edi,(%esp)
+  8018fd:	e8 e1 fd ff ff       	call   8016e3 <fd2data>
+  801902:	89 c3                	mov    %eax,%ebx
+  801904:	89 34 24             	mov    %esi,(%esp)
+  801907:	e8 d7 fd ff ff       	call   8016e3 <fd2data>
+  80190c:	83 c4 10             	add    $0x10,%esp
+  80190f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801912:	89 d8                	mov    %ebx,%eax
+  801914:	c1 e8 16             	shr    $0x16,%eax
+  801917:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80191e:	a8 01                	test   $0x1,%al
+  801920:	74 11                	je     801933 <dup+0x71>
+  801922:	89 d8                	mov    %ebx,%eax
+  801924:	c1 e8 0c             	shr    $0xc,%eax
+  801927:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80192e:	f6 c2 01             	test   $0x1,%dl
+  801931:	75 36                	jne    801969 <dup+0xa7>
+  801933:	89 f8                	mov    %edi,%eax
+  801935:	c1 e8 0c             	shr    $0xc,%eax
+  801938:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80193f:	83 ec 0c             	sub    $0xc,%esp
+  801942:	25 07 0e 00 00       	and    $0xe07,%eax
+  801947:	50                   	push   %eax
+  801948:	56                   	push   %esi
+  801949:	6a 00                	push   $0x0
+  80194b:	57                   	push   %edi
+  80194c:	6a 00                	push   $0x0
+  80194e:	e8 55 f5 ff ff       	call   800ea8 <sys_page_map>
+  801953:	89 c3                	mov    %eax,%ebx
+  801955:	83 c4 20             	add    $0x20,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 33                	js     80198f <dup+0xcd>
+  80195c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80195f:	89 d8                	mov    %ebx,%eax
+  801961:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801964:	5b                   	pop    %ebx
+  801965:	5e                   	pop    %esi
+  801966:	5f                   	pop    %edi
+  801967:	5d                   	pop    %ebp
+  801968:	c3                   	ret
+  801969:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801970:	83 ec 0c             	sub    $0xc,%esp
+  801973:	25 07 0e 00 00       	and    $0xe07,%eax
+  801978:	50                   	push   %eax
+  801979:	ff 75 d4             	push   -0x2c(%ebp)
+  80197c:	6a 00                	push   $0x0
+  80197e:	53                   	push   %ebx
+  80197f:	6a 00                	push   $0x0
+  801981:	e8 22 f5 ff ff       	call   800ea8 <sys_page_map>
+  801986:	89 c3                	mov    %eax,%ebx
+  801988:	83 c4 20             	add    $0x20,%esp
+  80198b:	85 c0                	test   %eax,%eax
+  80198d:	79 a4                	jns    801933 <dup+0x71>
+  80198f:	83 ec 08             	sub    $0x8,%esp
+  801992:	56                   	push   %esi
+  801993:	6a 00                	push   $0x0
+  801995:	e8 9d f5 ff ff       	call   800f37 <sys_page_unmap>
+  80199a:	83 c4 08             	add    $0x8,%esp
+  80199d:	ff 75 d4             	push   -0x2c(%ebp)
+  8019a0:	6a 00                	push   $0x0
+  8019a2:	e8 90 f5 ff ff       	call   800f37 <sys_page_unmap>
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	eb b3                	jmp    80195f <dup+0x9d>
+
+008019ac <read>:
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	56                   	push   %esi
+  8019b0:	53                   	push   %ebx
+  8019b1:	83 ec 18             	sub    $0x18,%esp
+  8019b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019ba:	50                   	push   %eax
+  8019bb:	56                   	push   %esi
+  8019bc:	e8 89 fd ff ff       	call   80174a <fd_lookup>
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	78 3c                	js     801a04 <read+0x58>
+  8019c8:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019cb:	83 ec 08             	sub    $0x8,%esp
+  8019ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d1:	50                   	push   %eax
+  8019d2:	ff 33                	push   (%ebx)
+  8019d4:	e8 c1 fd ff ff       	call   80179a <dev_lookup>
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	78 24                	js     801a04 <read+0x58>
+  8019e0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019e3:	83 e0 03             	and    $0x3,%eax
+  8019e6:	83 f8 01             	cmp    $0x1,%eax
+  8019e9:	74 20                	je     801a0b <read+0x5f>
+  8019eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ee:	8b 40 08             	mov    0x8(%eax),%eax
+  8019f1:	85 c0                	test   %eax,%eax
+  8019f3:	74 37                	je     801a2c <read+0x80>
+  8019f5:	83 ec 04             	sub    $0x4,%esp
+  8019f8:	ff 75 10             	push   0x10(%ebp)
+  8019fb:	ff 75 0c             	push   0xc(%ebp)
+  8019fe:	53                   	push   %ebx
+  8019ff:	ff d0                	call   *%eax
+  801a01:	83 c4 10             	add    $0x10,%esp
+  801a04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a07:	5b                   	pop    %ebx
+  801a08:	5e                   	pop    %esi
+  801a09:	5d                   	pop    %ebp
+  801a0a:	c3                   	ret
+  801a0b:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  801a10:	8b 40 48             	mov    0x48(%eax),%eax
+  801a13:	83 ec 04             	sub    $0x4,%esp
+  801a16:	56                   	push   %esi
+  801a17:	50                   	push   %eax
+  801a18:	68 39 38 80 00       	push   $0x803839
+  801a1d:	e8 ec e8 ff ff       	call   80030e <cprintf>
+  801a22:	83 c4 10             	add    $0x10,%esp
+  801a25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2a:	eb d8                	jmp    801a04 <read+0x58>
+  801a2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a31:	eb d1                	jmp    801a04 <read+0x58>
+
+00801a33 <readn>:
+  801a33:	55                   	push   %ebp
+  801a34:	89 e5                	mov    %esp,%ebp
+  801a36:	57                   	push   %edi
+  801a37:	56                   	push   %esi
+  801a38:	53                   	push   %ebx
+  801a39:	83 ec 0c             	sub    $0xc,%esp
+  801a3c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a3f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a42:	85 f6                	test   %esi,%esi
+  801a44:	74 30                	je     801a76 <readn+0x43>
+  801a46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a50:	83 ec 04             	sub    $0x4,%esp
+  801a53:	89 f2                	mov    %esi,%edx
+  801a55:	29 c2                	sub    %eax,%edx
+  801a57:	52                   	push   %edx
+  801a58:	01 f8                	add    %edi,%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	ff 75 08             	push   0x8(%ebp)
+  801a5e:	e8 49 ff ff ff       	call   8019ac <read>
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 15                	js     801a7f <readn+0x4c>
+  801a6a:	74 11                	je     801a7d <readn+0x4a>
+  801a6c:	01 c3                	add    %eax,%ebx
+  801a6e:	89 d8                	mov    %ebx,%eax
+  801a70:	39 f3                	cmp    %esi,%ebx
+  801a72:	72 dc                	jb     801a50 <readn+0x1d>
+  801a74:	eb 09                	jmp    801a7f <readn+0x4c>
+  801a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7b:	eb 02                	jmp    801a7f <readn+0x4c>
+  801a7d:	89 d8                	mov    %ebx,%eax
+  801a7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a82:	5b                   	pop    %ebx
+  801a83:	5e                   	pop    %esi
+  801a84:	5f                   	pop    %edi
+  801a85:	5d                   	pop    %ebp
+  801a86:	c3                   	ret
+
+00801a87 <write>:
+  801a87:	55                   	push   %ebp
+  801a88:	89 e5                	mov    %esp,%ebp
+  801a8a:	56                   	push   %esi
+  801a8b:	53                   	push   %ebx
+  801a8c:	83 ec 18             	sub    $0x18,%esp
+  801a8f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a92:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a95:	50                   	push   %eax
+  801a96:	53                   	push   %ebx
+  801a97:	e8 ae fc ff ff       	call   80174a <fd_lookup>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	85 c0                	test   %eax,%eax
+  801aa1:	78 37                	js     801ada <write+0x53>
+  801aa3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aa6:	83 ec 08             	sub    $0x8,%esp
+  801aa9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aac:	50                   	push   %eax
+  801aad:	ff 36                	push   (%esi)
+  801aaf:	e8 e6 fc ff ff       	call   80179a <dev_lookup>
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	85 c0                	test   %eax,%eax
+  801ab9:	78 1f                	js     801ada <write+0x53>
+  801abb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801abf:	74 20                	je     801ae1 <write+0x5a>
+  801ac1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	74 37                	je     801b02 <write+0x7b>
+  801acb:	83 ec 04             	sub    $0x4,%esp
+  801ace:	ff 75 10             	push   0x10(%ebp)
+  801ad1:	ff 75 0c             	push   0xc(%ebp)
+  801ad4:	56                   	push   %esi
+  801ad5:	ff d0                	call   *%eax
+  801ad7:	83 c4 10             	add    $0x10,%esp
+  801ada:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801add:	5b                   	pop    %ebx
+  801ade:	5e                   	pop    %esi
+  801adf:	5d                   	pop    %ebp
+  801ae0:	c3                   	ret
+  801ae1:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  801ae6:	8b 40 48             	mov    0x48(%eax),%eax
+  801ae9:	83 ec 04             	sub    $0x4,%esp
+  801aec:	53                   	push   %ebx
+  801aed:	50                   	push   %eax
+  801aee:	68 55 38 80 00       	push   $0x803855
+  801af3:	e8 16 e8 ff ff       	call   80030e <cprintf>
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b00:	eb d8                	jmp    801ada <write+0x53>
+  801b02:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b07:	eb d1                	jmp    801ada <write+0x53>
+
+00801b09 <seek>:
+  801b09:	55                   	push   %ebp
+  801b0a:	89 e5                	mov    %esp,%ebp
+  801b0c:	83 ec 20             	sub    $0x20,%esp
+  801b0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b12:	50                   	push   %eax
+  801b13:	ff 75 08             	push   0x8(%ebp)
+  801b16:	e8 2f fc ff ff       	call   80174a <fd_lookup>
+  801b1b:	83 c4 10             	add    $0x10,%esp
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	78 0e                	js     801b30 <seek+0x27>
+  801b22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b28:	89 50 04             	mov    %edx,0x4(%eax)
+  801b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b30:	c9                   	leave
+  801b31:	c3                   	ret
+
+00801b32 <ftruncate>:
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	56                   	push   %esi
+  801b36:	53                   	push   %ebx
+  801b37:	83 ec 18             	sub    $0x18,%esp
+  801b3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b3d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b40:	50                   	push   %eax
+  801b41:	53                   	push   %ebx
+  801b42:	e8 03 fc ff ff       	call   80174a <fd_lookup>
+  801b47:	83 c4 10             	add    $0x10,%esp
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 34                	js     801b82 <ftruncate+0x50>
+  801b4e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b51:	83 ec 08             	sub    $0x8,%esp
+  801b54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b57:	50                   	push   %eax
+  801b58:	ff 36                	push   (%esi)
+  801b5a:	e8 3b fc ff ff       	call   80179a <dev_lookup>
+  801b5f:	83 c4 10             	add    $0x10,%esp
+  801b62:	85 c0                	test   %eax,%eax
+  801b64:	78 1c                	js     801b82 <ftruncate+0x50>
+  801b66:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b6a:	74 1d                	je     801b89 <ftruncate+0x57>
+  801b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b6f:	8b 40 18             	mov    0x18(%eax),%eax
+  801b72:	85 c0                	test   %eax,%eax
+  801b74:	74 34                	je     801baa <ftruncate+0x78>
+  801b76:	83 ec 08             	sub    $0x8,%esp
+  801b79:	ff 75 0c             	push   0xc(%ebp)
+  801b7c:	56                   	push   %esi
+  801b7d:	ff d0                	call   *%eax
+  801b7f:	83 c4 10             	add    $0x10,%esp
+  801b82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b85:	5b                   	pop    %ebx
+  801b86:	5e                   	pop    %esi
+  801b87:	5d                   	pop    %ebp
+  801b88:	c3                   	ret
+  801b89:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  801b8e:	8b 40 48             	mov    0x48(%eax),%eax
+  801b91:	83 ec 04             	sub    $0x4,%esp
+  801b94:	53                   	push   %ebx
+  801b95:	50                   	push   %eax
+  801b96:	68 18 38 80 00       	push   $0x803818
+  801b9b:	e8 6e e7 ff ff       	call   80030e <cprintf>
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba8:	eb d8                	jmp    801b82 <ftruncate+0x50>
+  801baa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801baf:	eb d1                	jmp    801b82 <ftruncate+0x50>
+
+00801bb1 <fstat>:
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+  801bb6:	83 ec 18             	sub    $0x18,%esp
+  801bb9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bbc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bbf:	50                   	push   %eax
+  801bc0:	ff 75 08             	push   0x8(%ebp)
+  801bc3:	e8 82 fb ff ff       	call   80174a <fd_lookup>
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	85 c0                	test   %eax,%eax
+  801bcd:	78 49                	js     801c18 <fstat+0x67>
+  801bcf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bd2:	83 ec 08             	sub    $0x8,%esp
+  801bd5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd8:	50                   	push   %eax
+  801bd9:	ff 36                	push   (%esi)
+  801bdb:	e8 ba fb ff ff       	call   80179a <dev_lookup>
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	78 31                	js     801c18 <fstat+0x67>
+  801be7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bea:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bee:	74 2f                	je     801c1f <fstat+0x6e>
+  801bf0:	c6 03 00             	movb   $0x0,(%ebx)
+  801bf3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bfa:	00 00 00 
+  801bfd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c04:	00 00 00 
+  801c07:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801c0d:	83 ec 08             	sub    $0x8,%esp
+  801c10:	53                   	push   %ebx
+  801c11:	56                   	push   %esi
+  801c12:	ff 50 14             	call   *0x14(%eax)
+  801c15:	83 c4 10             	add    $0x10,%esp
+  801c18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1b:	5b                   	pop    %ebx
+  801c1c:	5e                   	pop    %esi
+  801c1d:	5d                   	pop    %ebp
+  801c1e:	c3                   	ret
+  801c1f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c24:	eb f2                	jmp    801c18 <fstat+0x67>
+
+00801c26 <stat>:
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	83 ec 08             	sub    $0x8,%esp
+  801c2e:	6a 00                	push   $0x0
+  801c30:	ff 75 08             	push   0x8(%ebp)
+  801c33:	e8 31 05 00 00       	call   802169 <open>
+  801c38:	89 c3                	mov    %eax,%ebx
+  801c3a:	83 c4 10             	add    $0x10,%esp
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	78 1b                	js     801c5c <stat+0x36>
+  801c41:	83 ec 08             	sub    $0x8,%esp
+  801c44:	ff 75 0c             	push   0xc(%ebp)
+  801c47:	50                   	push   %eax
+  801c48:	e8 64 ff ff ff       	call   801bb1 <fstat>
+  801c4d:	89 c6                	mov    %eax,%esi
+  801c4f:	89 1c 24             	mov    %ebx,(%esp)
+  801c52:	e8 19 fc ff ff       	call   801870 <close>
+  801c57:	83 c4 10             	add    $0x10,%esp
+  801c5a:	89 f3                	mov    %esi,%ebx
+  801c5c:	89 d8                	mov    %ebx,%eax
+  801c5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c61:	5b                   	pop    %ebx
+  801c62:	5e                   	pop    %esi
+  801c63:	5d                   	pop    %ebp
+  801c64:	c3                   	ret
+
+00801c65 <fsipc>:
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	56                   	push   %esi
+  801c69:	53                   	push   %ebx
+  801c6a:	89 c3                	mov    %eax,%ebx
+  801c6c:	89 d6                	mov    %edx,%esi
+  801c6e:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c75:	74 20                	je     801c97 <fsipc+0x32>
+  801c77:	83 ec 08             	sub    $0x8,%esp
+  801c7a:	6a 00                	push   $0x0
+  801c7c:	56                   	push   %esi
+  801c7d:	6a 07                	push   $0x7
+  801c7f:	68 00 60 80 00       	push   $0x806000
+  801c84:	53                   	push   %ebx
+  801c85:	ff 35 08 50 80 00    	push   0x805008
+  801c8b:	e8 6e 13 00 00       	call   802ffe <ipc_call>
+  801c90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c93:	5b                   	pop    %ebx
+  801c94:	5e                   	pop    %esi
+  801c95:	5d                   	pop    %ebp
+  801c96:	c3                   	ret
+  801c97:	83 ec 0c             	sub    $0xc,%esp
+  801c9a:	6a 02                	push   $0x2
+  801c9c:	e8 f8 14 00 00       	call   803199 <ipc_find_env>
+  801ca1:	a3 08 50 80 00       	mov    %eax,0x805008
+  801ca6:	83 c4 10             	add    $0x10,%esp
+  801ca9:	eb cc                	jmp    801c77 <fsipc+0x12>
+
+00801cab <devfile_trunc>:
+  801cab:	55                   	push   %ebp
+  801cac:	89 e5                	mov    %esp,%ebp
+  801cae:	83 ec 08             	sub    $0x8,%esp
+  801cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cb7:	a3 00 60 80 00       	mov    %eax,0x806000
+  801cbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cbf:	a3 04 60 80 00       	mov    %eax,0x806004
+  801cc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc9:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cce:	e8 92 ff ff ff       	call   801c65 <fsipc>
+  801cd3:	c9                   	leave
+  801cd4:	c3                   	ret
+
+00801cd5 <devfile_flush>:
+  801cd5:	55                   	push   %ebp
+  801cd6:	89 e5                	mov    %esp,%ebp
+  801cd8:	83 ec 08             	sub    $0x8,%esp
+  801cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cde:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ce1:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ceb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cf0:	e8 70 ff ff ff       	call   801c65 <fsipc>
+  801cf5:	c9                   	leave
+  801cf6:	c3                   	ret
+
+00801cf7 <devfile_stat>:
+  801cf7:	55                   	push   %ebp
+  801cf8:	89 e5                	mov    %esp,%ebp
+  801cfa:	53                   	push   %ebx
+  801cfb:	83 ec 04             	sub    $0x4,%esp
+  801cfe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d04:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d07:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d11:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d16:	e8 4a ff ff ff       	call   801c65 <fsipc>
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 2c                	js     801d4b <devfile_stat+0x54>
+  801d1f:	83 ec 08             	sub    $0x8,%esp
+  801d22:	68 00 60 80 00       	push   $0x806000
+  801d27:	53                   	push   %ebx
+  801d28:	e8 d8 ec ff ff       	call   800a05 <strcpy>
+  801d2d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d32:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801d38:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d3d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4e:	c9                   	leave
+  801d4f:	c3                   	ret
+
+00801d50 <fsring_rw>:
+  801d50:	55                   	push   %ebp
+  801d51:	89 e5                	mov    %esp,%ebp
+  801d53:	57                   	push   %edi
+  801d54:	56                   	push   %esi
+  801d55:	53                   	push   %ebx
+  801d56:	83 ec 2c             	sub    $0x2c,%esp
+  801d59:	89 c7                	mov    %eax,%edi
+  801d5b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d5e:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801d61:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d66:	a8 01                	test   $0x1,%al
+  801d68:	74 0d                	je     801d77 <fsring_rw+0x27>
+  801d6a:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d6f:	a8 01                	test   $0x1,%al
+  801d71:	0f 85 d5 00 00 00    	jne    801e4c <fsring_rw+0xfc>
+  801d77:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  801d7c:	8b 40 48             	mov    0x48(%eax),%eax
+  801d7f:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801d85:	0f 84 fc 00 00 00    	je     801e87 <fsring_rw+0x137>
+  801d8b:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801d92:	0f 84 02 01 00 00    	je     801e9a <fsring_rw+0x14a>
+  801d98:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d9d:	83 ec 04             	sub    $0x4,%esp
+  801da0:	68 07 02 00 00       	push   $0x207
+  801da5:	53                   	push   %ebx
+  801da6:	6a 00                	push   $0x0
+  801da8:	e8 b8 f0 ff ff       	call   800e65 <sys_page_alloc>
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	0f 88 f9 00 00 00    	js     801eb1 <fsring_rw+0x161>
+  801db8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801dbe:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801dc4:	75 d7                	jne    801d9d <fsring_rw+0x4d>
+  801dc6:	6a 0e                	push   $0xe
+  801dc8:	6a 0d                	push   $0xd
+  801dca:	ff 35 08 50 80 00    	push   0x805008
+  801dd0:	68 00 00 f0 cf       	push   $0xcff00000
+  801dd5:	e8 d8 0d 00 00       	call   802bb2 <ipcring_init>
+  801dda:	83 c4 08             	add    $0x8,%esp
+  801ddd:	6a 00                	push   $0x0
+  801ddf:	6a 00                	push   $0x0
+  801de1:	68 07 02 00 00       	push   $0x207
+  801de6:	68 00 00 f0 cf       	push   $0xcff00000
+  801deb:	6a 0b                	push   $0xb
+  801ded:	ff 35 08 50 80 00    	push   0x805008
+  801df3:	e8 06 12 00 00       	call   802ffe <ipc_call>
+  801df8:	89 c6                	mov    %eax,%esi
+  801dfa:	83 c4 20             	add    $0x20,%esp
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	0f 88 ac 00 00 00    	js     801eb1 <fsring_rw+0x161>
+  801e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e0a:	89 d9                	mov    %ebx,%ecx
+  801e0c:	83 c3 01             	add    $0x1,%ebx
+  801e0f:	89 da                	mov    %ebx,%edx
+  801e11:	c1 e2 0c             	shl    $0xc,%edx
+  801e14:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801e1a:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801e20:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801e26:	83 ec 08             	sub    $0x8,%esp
+  801e29:	6a 00                	push   $0x0
+  801e2b:	6a 00                	push   $0x0
+  801e2d:	68 07 02 00 00       	push   $0x207
+  801e32:	50                   	push   %eax
+  801e33:	6a 0c                	push   $0xc
+  801e35:	ff 35 08 50 80 00    	push   0x805008
+  801e3b:	e8 be 11 00 00       	call   802ffe <ipc_call>
+  801e40:	83 c4 20             	add    $0x20,%esp
+  801e43:	85 c0                	test   %eax,%eax
+  801e45:	78 6a                	js     801eb1 <fsring_rw+0x161>
+  801e47:	83 fb 08             	cmp    $0x8,%ebx
+  801e4a:	75 be                	jne    801e0a <fsring_rw+0xba>
+  801e4c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e50:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801e55:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801e5a:	0f 45 c2             	cmovne %edx,%eax
+  801e5d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e60:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e67:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e6e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7f:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801e82:	e9 4b 01 00 00       	jmp    801fd2 <fsring_rw+0x282>
+  801e87:	e8 a3 f3 ff ff       	call   80122f <sys_time_msec>
+  801e8c:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801e92:	0f 89 f3 fe ff ff    	jns    801d8b <fsring_rw+0x3b>
+  801e98:	eb 54                	jmp    801eee <fsring_rw+0x19e>
+  801e9a:	83 ec 0c             	sub    $0xc,%esp
+  801e9d:	6a 02                	push   $0x2
+  801e9f:	e8 f5 12 00 00       	call   803199 <ipc_find_env>
+  801ea4:	a3 08 50 80 00       	mov    %eax,0x805008
+  801ea9:	83 c4 10             	add    $0x10,%esp
+  801eac:	e9 e7 fe ff ff       	jmp    801d98 <fsring_rw+0x48>
+  801eb1:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801eb6:	83 ec 08             	sub    $0x8,%esp
+  801eb9:	53                   	push   %ebx
+  801eba:	6a 00                	push   $0x0
+  801ebc:	e8 76 f0 ff ff       	call   800f37 <sys_page_unmap>
+  801ec1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ed0:	75 e4                	jne    801eb6 <fsring_rw+0x166>
+  801ed2:	e8 58 f3 ff ff       	call   80122f <sys_time_msec>
+  801ed7:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801edc:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ee1:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  801ee6:	8b 40 48             	mov    0x48(%eax),%eax
+  801ee9:	a3 04 50 80 00       	mov    %eax,0x805004
+  801eee:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801ef5:	e9 7a 01 00 00       	jmp    802074 <fsring_rw+0x324>
+  801efa:	8b 57 0c             	mov    0xc(%edi),%edx
+  801efd:	89 10                	mov    %edx,(%eax)
+  801eff:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f02:	89 f2                	mov    %esi,%edx
+  801f04:	03 57 04             	add    0x4(%edi),%edx
+  801f07:	89 50 08             	mov    %edx,0x8(%eax)
+  801f0a:	83 ec 04             	sub    $0x4,%esp
+  801f0d:	53                   	push   %ebx
+  801f0e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801f11:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801f14:	52                   	push   %edx
+  801f15:	83 c0 0c             	add    $0xc,%eax
+  801f18:	50                   	push   %eax
+  801f19:	e8 97 ec ff ff       	call   800bb5 <memmove>
+  801f1e:	83 c4 10             	add    $0x10,%esp
+  801f21:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f24:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f27:	89 08                	mov    %ecx,(%eax)
+  801f29:	83 ec 0c             	sub    $0xc,%esp
+  801f2c:	68 00 00 f0 cf       	push   $0xcff00000
+  801f31:	e8 da 0c 00 00       	call   802c10 <ipcring_req_push>
+  801f36:	01 de                	add    %ebx,%esi
+  801f38:	83 c4 10             	add    $0x10,%esp
+  801f3b:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f3e:	73 4c                	jae    801f8c <fsring_rw+0x23c>
+  801f40:	83 ec 0c             	sub    $0xc,%esp
+  801f43:	68 00 00 f0 cf       	push   $0xcff00000
+  801f48:	e8 9d 0c 00 00       	call   802bea <ipcring_req_slot>
+  801f4d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f50:	83 c4 10             	add    $0x10,%esp
+  801f53:	85 c0                	test   %eax,%eax
+  801f55:	74 35                	je     801f8c <fsring_rw+0x23c>
+  801f57:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f5c:	83 e0 07             	and    $0x7,%eax
+  801f5f:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f64:	c1 e0 0c             	shl    $0xc,%eax
+  801f67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f6a:	29 f3                	sub    %esi,%ebx
+  801f6c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f6f:	39 cb                	cmp    %ecx,%ebx
+  801f71:	0f 47 d9             	cmova  %ecx,%ebx
+  801f74:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f78:	75 80                	jne    801efa <fsring_rw+0x1aa>
+  801f7a:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f7d:	89 10                	mov    %edx,(%eax)
+  801f7f:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f82:	89 f2                	mov    %esi,%edx
+  801f84:	03 57 04             	add    0x4(%edi),%edx
+  801f87:	89 50 08             	mov    %edx,0x8(%eax)
+  801f8a:	eb 95                	jmp    801f21 <fsring_rw+0x1d1>
+  801f8c:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801f91:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+  801f97:	68 00 00 f0 cf       	push   $0xcff00000
+  801f9c:	e8 a8 0c 00 00       	call   802c49 <ipcring_rsp_wait>
+  801fa1:	8b 58 04             	mov    0x4(%eax),%ebx
+  801fa4:	83 c4 10             	add    $0x10,%esp
+  801fa7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801fab:	75 45                	jne    801ff2 <fsring_rw+0x2a2>
+  801fad:	85 db                	test   %ebx,%ebx
+  801faf:	79 41                	jns    801ff2 <fsring_rw+0x2a2>
+  801fb1:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801fb4:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801fbb:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801fc2:	83 ec 0c             	sub    $0xc,%esp
+  801fc5:	68 00 00 f0 cf       	push   $0xcff00000
+  801fca:	e8 e0 0c 00 00       	call   802caf <ipcring_rsp_pop>
+  801fcf:	83 c4 10             	add    $0x10,%esp
+  801fd2:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801fd8:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801fdd:	39 c2                	cmp    %eax,%edx
+  801fdf:	74 75                	je     802056 <fsring_rw+0x306>
+  801fe1:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801fe5:	75 a5                	jne    801f8c <fsring_rw+0x23c>
+  801fe7:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801fea:	0f 82 50 ff ff ff    	jb     801f40 <fsring_rw+0x1f0>
+  801ff0:	eb 9a                	jmp    801f8c <fsring_rw+0x23c>
+  801ff2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801ff6:	75 ca                	jne    801fc2 <fsring_rw+0x272>
+  801ff8:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801ffc:	74 31                	je     80202f <fsring_rw+0x2df>
+  801ffe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802001:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802004:	29 c8                	sub    %ecx,%eax
+  802006:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802009:	39 d0                	cmp    %edx,%eax
+  80200b:	0f 47 c2             	cmova  %edx,%eax
+  80200e:	39 d8                	cmp    %ebx,%eax
+  802010:	ba 01 00 00 00       	mov    $0x1,%edx
+  802015:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802019:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80201c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802021:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802025:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802028:	01 d9                	add    %ebx,%ecx
+  80202a:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80202d:	eb 93                	jmp    801fc2 <fsring_rw+0x272>
+  80202f:	83 ec 04             	sub    $0x4,%esp
+  802032:	53                   	push   %ebx
+  802033:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802036:	83 e0 07             	and    $0x7,%eax
+  802039:	c1 e0 0c             	shl    $0xc,%eax
+  80203c:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802042:	50                   	push   %eax
+  802043:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802046:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802049:	01 c8                	add    %ecx,%eax
+  80204b:	50                   	push   %eax
+  80204c:	e8 64 eb ff ff       	call   800bb5 <memmove>
+  802051:	83 c4 10             	add    $0x10,%esp
+  802054:	eb a8                	jmp    801ffe <fsring_rw+0x2ae>
+  802056:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80205a:	75 09                	jne    802065 <fsring_rw+0x315>
+  80205c:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80205f:	0f 82 db fe ff ff    	jb     801f40 <fsring_rw+0x1f0>
+  802065:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802068:	01 57 04             	add    %edx,0x4(%edi)
+  80206b:	85 d2                	test   %edx,%edx
+  80206d:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802071:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802074:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802077:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80207a:	5b                   	pop    %ebx
+  80207b:	5e                   	pop    %esi
+  80207c:	5f                   	pop    %edi
+  80207d:	5d                   	pop    %ebp
+  80207e:	c3                   	ret
+
+0080207f <devfile_write>:
+  80207f:	55                   	push   %ebp
+  802080:	89 e5                	mov    %esp,%ebp
+  802082:	57                   	push   %edi
+  802083:	56                   	push   %esi
+  802084:	53                   	push   %ebx
+  802085:	83 ec 0c             	sub    $0xc,%esp
+  802088:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80208b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80208e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802091:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802097:	76 1a                	jbe    8020b3 <devfile_write+0x34>
+  802099:	83 ec 0c             	sub    $0xc,%esp
+  80209c:	53                   	push   %ebx
+  80209d:	89 f1                	mov    %esi,%ecx
+  80209f:	ba 06 00 00 00       	mov    $0x6,%edx
+  8020a4:	89 f8                	mov    %edi,%eax
+  8020a6:	e8 a5 fc ff ff       	call   801d50 <fsring_rw>
+  8020ab:	83 c4 10             	add    $0x10,%esp
+  8020ae:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020b1:	75 39                	jne    8020ec <devfile_write+0x6d>
+  8020b3:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8020b8:	39 c3                	cmp    %eax,%ebx
+  8020ba:	0f 47 d8             	cmova  %eax,%ebx
+  8020bd:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020c0:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020c5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8020cb:	83 ec 04             	sub    $0x4,%esp
+  8020ce:	53                   	push   %ebx
+  8020cf:	56                   	push   %esi
+  8020d0:	68 08 60 80 00       	push   $0x806008
+  8020d5:	e8 db ea ff ff       	call   800bb5 <memmove>
+  8020da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020df:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020e4:	e8 7c fb ff ff       	call   801c65 <fsipc>
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ef:	5b                   	pop    %ebx
+  8020f0:	5e                   	pop    %esi
+  8020f1:	5f                   	pop    %edi
+  8020f2:	5d                   	pop    %ebp
+  8020f3:	c3                   	ret
+
+008020f4 <devfile_read>:
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	57                   	push   %edi
+  8020f8:	56                   	push   %esi
+  8020f9:	53                   	push   %ebx
+  8020fa:	83 ec 0c             	sub    $0xc,%esp
+  8020fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802100:	8b 75 10             	mov    0x10(%ebp),%esi
+  802103:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802109:	76 1d                	jbe    802128 <devfile_read+0x34>
+  80210b:	83 ec 0c             	sub    $0xc,%esp
+  80210e:	56                   	push   %esi
+  80210f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802112:	ba 05 00 00 00       	mov    $0x5,%edx
+  802117:	89 f8                	mov    %edi,%eax
+  802119:	e8 32 fc ff ff       	call   801d50 <fsring_rw>
+  80211e:	89 c3                	mov    %eax,%ebx
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802126:	75 37                	jne    80215f <devfile_read+0x6b>
+  802128:	8b 47 0c             	mov    0xc(%edi),%eax
+  80212b:	a3 00 60 80 00       	mov    %eax,0x806000
+  802130:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802140:	e8 20 fb ff ff       	call   801c65 <fsipc>
+  802145:	89 c3                	mov    %eax,%ebx
+  802147:	85 c0                	test   %eax,%eax
+  802149:	78 14                	js     80215f <devfile_read+0x6b>
+  80214b:	83 ec 04             	sub    $0x4,%esp
+  80214e:	50                   	push   %eax
+  80214f:	68 00 60 80 00       	push   $0x806000
+  802154:	ff 75 0c             	push   0xc(%ebp)
+  802157:	e8 59 ea ff ff       	call   800bb5 <memmove>
+  80215c:	83 c4 10             	add    $0x10,%esp
+  80215f:	89 d8                	mov    %ebx,%eax
+  802161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802164:	5b                   	pop    %ebx
+  802165:	5e                   	pop    %esi
+  802166:	5f                   	pop    %edi
+  802167:	5d                   	pop    %ebp
+  802168:	c3                   	ret
+
+00802169 <open>:
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	56                   	push   %esi
+  80216d:	53                   	push   %ebx
+  80216e:	83 ec 1c             	sub    $0x1c,%esp
+  802171:	8b 75 08             	mov    0x8(%ebp),%esi
+  802174:	56                   	push   %esi
+  802175:	e8 3f e8 ff ff       	call   8009b9 <strlen>
+  80217a:	83 c4 10             	add    $0x10,%esp
+  80217d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802182:	7f 6c                	jg     8021f0 <open+0x87>
+  802184:	83 ec 0c             	sub    $0xc,%esp
+  802187:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80218a:	50                   	push   %eax
+  80218b:	e8 6a f5 ff ff       	call   8016fa <fd_alloc>
+  802190:	89 c3                	mov    %eax,%ebx
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	85 c0                	test   %eax,%eax
+  802197:	78 3c                	js     8021d5 <open+0x6c>
+  802199:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80219c:	a3 00 64 80 00       	mov    %eax,0x806400
+  8021a1:	83 ec 08             	sub    $0x8,%esp
+  8021a4:	56                   	push   %esi
+  8021a5:	68 00 60 80 00       	push   $0x806000
+  8021aa:	e8 56 e8 ff ff       	call   800a05 <strcpy>
+  8021af:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b7:	e8 a9 fa ff ff       	call   801c65 <fsipc>
+  8021bc:	89 c3                	mov    %eax,%ebx
+  8021be:	83 c4 10             	add    $0x10,%esp
+  8021c1:	85 c0                	test   %eax,%eax
+  8021c3:	78 19                	js     8021de <open+0x75>
+  8021c5:	83 ec 0c             	sub    $0xc,%esp
+  8021c8:	ff 75 f4             	push   -0xc(%ebp)
+  8021cb:	e8 03 f5 ff ff       	call   8016d3 <fd2num>
+  8021d0:	89 c3                	mov    %eax,%ebx
+  8021d2:	83 c4 10             	add    $0x10,%esp
+  8021d5:	89 d8                	mov    %ebx,%eax
+  8021d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021da:	5b                   	pop    %ebx
+  8021db:	5e                   	pop    %esi
+  8021dc:	5d                   	pop    %ebp
+  8021dd:	c3                   	ret
+  8021de:	83 ec 08             	sub    $0x8,%esp
+  8021e1:	6a 00                	push   $0x0
+  8021e3:	ff 75 f4             	push   -0xc(%ebp)
+  8021e6:	e8 05 f6 ff ff       	call   8017f0 <fd_close>
+  8021eb:	83 c4 10             	add    $0x10,%esp
+  8021ee:	eb e5                	jmp    8021d5 <open+0x6c>
+  8021f0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021f5:	eb de                	jmp    8021d5 <open+0x6c>
+
+008021f7 <file_image>:
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	53                   	push   %ebx
+  8021fb:	83 ec 1c             	sub    $0x1c,%esp
+  8021fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802201:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802204:	50                   	push   %eax
+  802205:	ff 75 08             	push   0x8(%ebp)
+  802208:	e8 3d f5 ff ff       	call   80174a <fd_lookup>
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	85 c0                	test   %eax,%eax
+  802212:	78 58                	js     80226c <file_image+0x75>
+  802214:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802217:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80221d:	39 08                	cmp    %ecx,(%eax)
+  80221f:	75 50                	jne    802271 <file_image+0x7a>
+  802221:	83 fb 04             	cmp    $0x4,%ebx
+  802224:	77 52                	ja     802278 <file_image+0x81>
+  802226:	8b 40 0c             	mov    0xc(%eax),%eax
+  802229:	a3 00 60 80 00       	mov    %eax,0x806000
+  80222e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802234:	83 ec 04             	sub    $0x4,%esp
+  802237:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80223a:	c1 e0 02             	shl    $0x2,%eax
+  80223d:	50                   	push   %eax
+  80223e:	ff 75 0c             	push   0xc(%ebp)
+  802241:	68 08 60 80 00       	push   $0x806008
+  802246:	e8 6a e9 ff ff       	call   800bb5 <memmove>
+  80224b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802250:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802255:	e8 0b fa ff ff       	call   801c65 <fsipc>
+  80225a:	83 c4 10             	add    $0x10,%esp
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	78 0b                	js     80226c <file_image+0x75>
+  802261:	8b 55 14             	mov    0x14(%ebp),%edx
+  802264:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80226a:	89 0a                	mov    %ecx,(%edx)
+  80226c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80226f:	c9                   	leave
+  802270:	c3                   	ret
+  802271:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802276:	eb f4                	jmp    80226c <file_image+0x75>
+  802278:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80227d:	eb ed                	jmp    80226c <file_image+0x75>
+
+0080227f <remove>:
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	53                   	push   %ebx
+  802283:	83 ec 10             	sub    $0x10,%esp
+  802286:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802289:	53                   	push   %ebx
+  80228a:	e8 2a e7 ff ff       	call   8009b9 <strlen>
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802297:	7f 25                	jg     8022be <remove+0x3f>
+  802299:	83 ec 08             	sub    $0x8,%esp
+  80229c:	53                   	push   %ebx
+  80229d:	68 00 60 80 00       	push   $0x806000
+  8022a2:	e8 5e e7 ff ff       	call   800a05 <strcpy>
+  8022a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022b1:	e8 af f9 ff ff       	call   801c65 <fsipc>
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bc:	c9                   	leave
+  8022bd:	c3                   	ret
+  8022be:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022c3:	eb f4                	jmp    8022b9 <remove+0x3a>
+
+008022c5 <sync>:
+  8022c5:	55                   	push   %ebp
+  8022c6:	89 e5                	mov    %esp,%ebp
+  8022c8:	83 ec 08             	sub    $0x8,%esp
+  8022cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022d5:	e8 8b f9 ff ff       	call   801c65 <fsipc>
+  8022da:	c9                   	leave
+  8022db:	c3                   	ret
+
+008022dc <writebuf>:
+  8022dc:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8022e0:	7f 01                	jg     8022e3 <writebuf+0x7>
+  8022e2:	c3                   	ret
+  8022e3:	55                   	push   %ebp
+  8022e4:	89 e5                	mov    %esp,%ebp
+  8022e6:	53                   	push   %ebx
+  8022e7:	83 ec 08             	sub    $0x8,%esp
+  8022ea:	89 c3                	mov    %eax,%ebx
+  8022ec:	ff 70 04             	push   0x4(%eax)
+  8022ef:	8d 40 10             	lea    0x10(%eax),%eax
+  8022f2:	50                   	push   %eax
+  8022f3:	ff 33                	push   (%ebx)
+  8022f5:	e8 8d f7 ff ff       	call   801a87 <write>
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	7e 03                	jle    802304 <writebuf+0x28>
+  802301:	01 43 08             	add    %eax,0x8(%ebx)
+  802304:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802307:	74 0d                	je     802316 <writebuf+0x3a>
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802310:	0f 4f c2             	cmovg  %edx,%eax
+  802313:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802316:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802319:	c9                   	leave
+  80231a:	c3                   	ret
+
+0080231b <putch>:
+  80231b:	55                   	push   %ebp
+  80231c:	89 e5                	mov    %esp,%ebp
+  80231e:	53                   	push   %ebx
+  80231f:	83 ec 04             	sub    $0x4,%esp
+  802322:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802325:	8b 53 04             	mov    0x4(%ebx),%edx
+  802328:	8d 42 01             	lea    0x1(%edx),%eax
+  80232b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80232e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802331:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  802335:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80233a:	74 05                	je     802341 <putch+0x26>
+  80233c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+  802341:	89 d8                	mov    %ebx,%eax
+  802343:	e8 94 ff ff ff       	call   8022dc <writebuf>
+  802348:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  80234f:	eb eb                	jmp    80233c <putch+0x21>
+
+00802351 <vfprintf>:
+  802351:	55                   	push   %ebp
+  802352:	89 e5                	mov    %esp,%ebp
+  802354:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80235a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235d:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  802363:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80236a:	00 00 00 
+  80236d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802374:	00 00 00 
+  802377:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80237e:	00 00 00 
+  802381:	ff 75 10             	push   0x10(%ebp)
+  802384:	ff 75 0c             	push   0xc(%ebp)
+  802387:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80238d:	50                   	push   %eax
+  80238e:	68 1b 23 80 00       	push   $0x80231b
+  802393:	e8 75 e0 ff ff       	call   80040d <vprintfmt>
+  802398:	83 c4 10             	add    $0x10,%esp
+  80239b:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8023a2:	7f 12                	jg     8023b6 <vfprintf+0x65>
+  8023a4:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	75 06                	jne    8023b4 <vfprintf+0x63>
+  8023ae:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+  8023b6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8023bc:	e8 1b ff ff ff       	call   8022dc <writebuf>
+  8023c1:	eb e1                	jmp    8023a4 <vfprintf+0x53>
+
+008023c3 <fprintf>:
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	83 ec 0c             	sub    $0xc,%esp
+  8023c9:	8d 45 10             	lea    0x10(%ebp),%eax
+  8023cc:	50                   	push   %eax
+  8023cd:	ff 75 0c             	push   0xc(%ebp)
+  8023d0:	ff 75 08             	push   0x8(%ebp)
+  8023d3:	e8 79 ff ff ff       	call   802351 <vfprintf>
+  8023d8:	c9                   	leave
+  8023d9:	c3                   	ret
+
+008023da <printf>:
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	83 ec 0c             	sub    $0xc,%esp
+  8023e0:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8023e3:	50                   	push   %eax
+  8023e4:	ff 75 08             	push   0x8(%ebp)
+  8023e7:	6a 01                	push   $0x1
+  8023e9:	e8 63 ff ff ff       	call   802351 <vfprintf>
+  8023ee:	c9                   	leave
+  8023ef:	c3                   	ret
+
+008023f0 <devsock_stat>:
+  8023f0:	55                   	push   %ebp
+  8023f1:	89 e5                	mov    %esp,%ebp
+  8023f3:	83 ec 10             	sub    $0x10,%esp
+  8023f6:	68 88 38 80 00       	push   $0x803888
+  8023fb:	ff 75 0c             	push   0xc(%ebp)
+  8023fe:	e8 02 e6 ff ff       	call   800a05 <strcpy>
+  802403:	b8 00 00 00 00       	mov    $0x0,%eax
+  802408:	c9                   	leave
+  802409:	c3                   	ret
+
+0080240a <devsock_close>:
+  80240a:	55                   	push   %ebp
+  80240b:	89 e5                	mov    %esp,%ebp
+  80240d:	53                   	push   %ebx
+  80240e:	83 ec 10             	sub    $0x10,%esp
+  802411:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802414:	53                   	push   %ebx
+  802415:	e8 99 0d 00 00       	call   8031b3 <pageref>
+  80241a:	89 c2                	mov    %eax,%edx
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802424:	83 fa 01             	cmp    $0x1,%edx
+  802427:	74 05                	je     80242e <devsock_close+0x24>
+  802429:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80242c:	c9                   	leave
+  80242d:	c3                   	ret
+  80242e:	83 ec 0c             	sub    $0xc,%esp
+  802431:	ff 73 0c             	push   0xc(%ebx)
+  802434:	e8 aa 02 00 00       	call   8026e3 <nsipc_close>
+  802439:	83 c4 10             	add    $0x10,%esp
+  80243c:	eb eb                	jmp    802429 <devsock_close+0x1f>
+
+0080243e <devsock_write>:
+  80243e:	55                   	push   %ebp
+  80243f:	89 e5                	mov    %esp,%ebp
+  802441:	83 ec 08             	sub    $0x8,%esp
+  802444:	6a 00                	push   $0x0
+  802446:	ff 75 10             	push   0x10(%ebp)
+  802449:	ff 75 0c             	push   0xc(%ebp)
+  80244c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244f:	ff 70 0c             	push   0xc(%eax)
+  802452:	e8 6c 03 00 00       	call   8027c3 <nsipc_send>
+  802457:	c9                   	leave
+  802458:	c3                   	ret
+
+00802459 <devsock_read>:
+  802459:	55                   	push   %ebp
+  80245a:	89 e5                	mov    %esp,%ebp
+  80245c:	83 ec 08             	sub    $0x8,%esp
+  80245f:	6a 00                	push   $0x0
+  802461:	ff 75 10             	push   0x10(%ebp)
+  802464:	ff 75 0c             	push   0xc(%ebp)
+  802467:	8b 45 08             	mov    0x8(%ebp),%eax
+  80246a:	ff 70 0c             	push   0xc(%eax)
+  80246d:	e8 e2 02 00 00       	call   802754 <nsipc_recv>
+  802472:	c9                   	leave
+  802473:	c3                   	ret
+
+00802474 <fd2sockid>:
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	83 ec 20             	sub    $0x20,%esp
+  80247a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80247d:	52                   	push   %edx
+  80247e:	50                   	push   %eax
+  80247f:	e8 c6 f2 ff ff       	call   80174a <fd_lookup>
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	85 c0                	test   %eax,%eax
+  802489:	78 10                	js     80249b <fd2sockid+0x27>
+  80248b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80248e:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802494:	39 08                	cmp    %ecx,(%eax)
+  802496:	75 05                	jne    80249d <fd2sockid+0x29>
+  802498:	8b 40 0c             	mov    0xc(%eax),%eax
+  80249b:	c9                   	leave
+  80249c:	c3                   	ret
+  80249d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024a2:	eb f7                	jmp    80249b <fd2sockid+0x27>
+
+008024a4 <alloc_sockfd>:
+  8024a4:	55                   	push   %ebp
+  8024a5:	89 e5                	mov    %esp,%ebp
+  8024a7:	56                   	push   %esi
+  8024a8:	53                   	push   %ebx
+  8024a9:	83 ec 1c             	sub    $0x1c,%esp
+  8024ac:	89 c6                	mov    %eax,%esi
+  8024ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024b1:	50                   	push   %eax
+  8024b2:	e8 43 f2 ff ff       	call   8016fa <fd_alloc>
+  8024b7:	89 c3                	mov    %eax,%ebx
+  8024b9:	83 c4 10             	add    $0x10,%esp
+  8024bc:	85 c0                	test   %eax,%eax
+  8024be:	78 43                	js     802503 <alloc_sockfd+0x5f>
+  8024c0:	83 ec 04             	sub    $0x4,%esp
+  8024c3:	68 07 04 00 00       	push   $0x407
+  8024c8:	ff 75 f4             	push   -0xc(%ebp)
+  8024cb:	6a 00                	push   $0x0
+  8024cd:	e8 93 e9 ff ff       	call   800e65 <sys_page_alloc>
+  8024d2:	89 c3                	mov    %eax,%ebx
+  8024d4:	83 c4 10             	add    $0x10,%esp
+  8024d7:	85 c0                	test   %eax,%eax
+  8024d9:	78 28                	js     802503 <alloc_sockfd+0x5f>
+  8024db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024de:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8024e4:	89 10                	mov    %edx,(%eax)
+  8024e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8024f0:	89 70 0c             	mov    %esi,0xc(%eax)
+  8024f3:	83 ec 0c             	sub    $0xc,%esp
+  8024f6:	50                   	push   %eax
+  8024f7:	e8 d7 f1 ff ff       	call   8016d3 <fd2num>
+  8024fc:	89 c3                	mov    %eax,%ebx
+  8024fe:	83 c4 10             	add    $0x10,%esp
+  802501:	eb 0c                	jmp    80250f <alloc_sockfd+0x6b>
+  802503:	83 ec 0c             	sub    $0xc,%esp
+  802506:	56                   	push   %esi
+  802507:	e8 d7 01 00 00       	call   8026e3 <nsipc_close>
+  80250c:	83 c4 10             	add    $0x10,%esp
+  80250f:	89 d8                	mov    %ebx,%eax
+  802511:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802514:	5b                   	pop    %ebx
+  802515:	5e                   	pop    %esi
+  802516:	5d                   	pop    %ebp
+  802517:	c3                   	ret
+
+00802518 <accept>:
+  802518:	55                   	push   %ebp
+  802519:	89 e5                	mov    %esp,%ebp
+  80251b:	83 ec 08             	sub    $0x8,%esp
+  80251e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802521:	e8 4e ff ff ff       	call   802474 <fd2sockid>
+  802526:	85 c0                	test   %eax,%eax
+  802528:	78 1b                	js     802545 <accept+0x2d>
+  80252a:	83 ec 04             	sub    $0x4,%esp
+  80252d:	ff 75 10             	push   0x10(%ebp)
+  802530:	ff 75 0c             	push   0xc(%ebp)
+  802533:	50                   	push   %eax
+  802534:	e8 07 01 00 00       	call   802640 <nsipc_accept>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	78 05                	js     802545 <accept+0x2d>
+  802540:	e8 5f ff ff ff       	call   8024a4 <alloc_sockfd>
+  802545:	c9                   	leave
+  802546:	c3                   	ret
+
+00802547 <bind>:
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	83 ec 08             	sub    $0x8,%esp
+  80254d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802550:	e8 1f ff ff ff       	call   802474 <fd2sockid>
+  802555:	85 c0                	test   %eax,%eax
+  802557:	78 12                	js     80256b <bind+0x24>
+  802559:	83 ec 04             	sub    $0x4,%esp
+  80255c:	ff 75 10             	push   0x10(%ebp)
+  80255f:	ff 75 0c             	push   0xc(%ebp)
+  802562:	50                   	push   %eax
+  802563:	e8 24 01 00 00       	call   80268c <nsipc_bind>
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	c9                   	leave
+  80256c:	c3                   	ret
+
+0080256d <shutdown>:
+  80256d:	55                   	push   %ebp
+  80256e:	89 e5                	mov    %esp,%ebp
+  802570:	83 ec 08             	sub    $0x8,%esp
+  802573:	8b 45 08             	mov    0x8(%ebp),%eax
+  802576:	e8 f9 fe ff ff       	call   802474 <fd2sockid>
+  80257b:	85 c0                	test   %eax,%eax
+  80257d:	78 0f                	js     80258e <shutdown+0x21>
+  80257f:	83 ec 08             	sub    $0x8,%esp
+  802582:	ff 75 0c             	push   0xc(%ebp)
+  802585:	50                   	push   %eax
+  802586:	e8 36 01 00 00       	call   8026c1 <nsipc_shutdown>
+  80258b:	83 c4 10             	add    $0x10,%esp
+  80258e:	c9                   	leave
+  80258f:	c3                   	ret
+
+00802590 <connect>:
+  802590:	55                   	push   %ebp
+  802591:	89 e5                	mov    %esp,%ebp
+  802593:	83 ec 08             	sub    $0x8,%esp
+  802596:	8b 45 08             	mov    0x8(%ebp),%eax
+  802599:	e8 d6 fe ff ff       	call   802474 <fd2sockid>
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	78 12                	js     8025b4 <connect+0x24>
+  8025a2:	83 ec 04             	sub    $0x4,%esp
+  8025a5:	ff 75 10             	push   0x10(%ebp)
+  8025a8:	ff 75 0c             	push   0xc(%ebp)
+  8025ab:	50                   	push   %eax
+  8025ac:	e8 4c 01 00 00       	call   8026fd <nsipc_connect>
+  8025b1:	83 c4 10             	add    $0x10,%esp
+  8025b4:	c9                   	leave
+  8025b5:	c3                   	ret
+
+008025b6 <listen>:
+  8025b6:	55                   	push   %ebp
+  8025b7:	89 e5                	mov    %esp,%ebp
+  8025b9:	83 ec 08             	sub    $0x8,%esp
+  8025bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025bf:	e8 b0 fe ff ff       	call   802474 <fd2sockid>
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	78 0f                	js     8025d7 <listen+0x21>
+  8025c8:	83 ec 08             	sub    $0x8,%esp
+  8025cb:	ff 75 0c             	push   0xc(%ebp)
+  8025ce:	50                   	push   %eax
+  8025cf:	e8 5e 01 00 00       	call   802732 <nsipc_listen>
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	c9                   	leave
+  8025d8:	c3                   	ret
+
+008025d9 <socket>:
+  8025d9:	55                   	push   %ebp
+  8025da:	89 e5                	mov    %esp,%ebp
+  8025dc:	83 ec 0c             	sub    $0xc,%esp
+  8025df:	ff 75 10             	push   0x10(%ebp)
+  8025e2:	ff 75 0c             	push   0xc(%ebp)
+  8025e5:	ff 75 08             	push   0x8(%ebp)
+  8025e8:	e8 34 02 00 00       	call   802821 <nsipc_socket>
+  8025ed:	83 c4 10             	add    $0x10,%esp
+  8025f0:	85 c0                	test   %eax,%eax
+  8025f2:	78 05                	js     8025f9 <socket+0x20>
+  8025f4:	e8 ab fe ff ff       	call   8024a4 <alloc_sockfd>
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+
+008025fb <nsipc>:
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	53                   	push   %ebx
+  8025ff:	83 ec 04             	sub    $0x4,%esp
+  802602:	89 c3                	mov    %eax,%ebx
+  802604:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80260b:	74 1f                	je     80262c <nsipc+0x31>
+  80260d:	83 ec 08             	sub    $0x8,%esp
+  802610:	6a 00                	push   $0x0
+  802612:	6a 00                	push   $0x0
+  802614:	6a 07                	push   $0x7
+  802616:	68 00 70 80 00       	push   $0x807000
+  80261b:	53                   	push   %ebx
+  80261c:	ff 35 0c 50 80 00    	push   0x80500c
+  802622:	e8 d7 09 00 00       	call   802ffe <ipc_call>
+  802627:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80262a:	c9                   	leave
+  80262b:	c3                   	ret
+  80262c:	83 ec 0c             	sub    $0xc,%esp
+  80262f:	6a 03                	push   $0x3
+  802631:	e8 63 0b 00 00       	call   803199 <ipc_find_env>
+  802636:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80263b:	83 c4 10             	add    $0x10,%esp
+  80263e:	eb cd                	jmp    80260d <nsipc+0x12>
+
+00802640 <nsipc_accept>:
+  802640:	55                   	push   %ebp
+  802641:	89 e5                	mov    %esp,%ebp
+  802643:	53                   	push   %ebx
+  802644:	83 ec 04             	sub    $0x4,%esp
+  802647:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80264f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802654:	e8 a2 ff ff ff       	call   8025fb <nsipc>
+  802659:	89 c3                	mov    %eax,%ebx
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	79 07                	jns    802666 <nsipc_accept+0x26>
+  80265f:	89 d8                	mov    %ebx,%eax
+  802661:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802664:	c9                   	leave
+  802665:	c3                   	ret
+  802666:	83 ec 04             	sub    $0x4,%esp
+  802669:	ff 35 10 70 80 00    	push   0x807010
+  80266f:	68 00 70 80 00       	push   $0x807000
+  802674:	ff 75 0c             	push   0xc(%ebp)
+  802677:	e8 39 e5 ff ff       	call   800bb5 <memmove>
+  80267c:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802682:	8b 45 10             	mov    0x10(%ebp),%eax
+  802685:	89 10                	mov    %edx,(%eax)
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	eb d3                	jmp    80265f <nsipc_accept+0x1f>
+
+0080268c <nsipc_bind>:
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	53                   	push   %ebx
+  802690:	83 ec 08             	sub    $0x8,%esp
+  802693:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802696:	8b 45 08             	mov    0x8(%ebp),%eax
+  802699:	a3 00 70 80 00       	mov    %eax,0x807000
+  80269e:	53                   	push   %ebx
+  80269f:	ff 75 0c             	push   0xc(%ebp)
+  8026a2:	68 04 70 80 00       	push   $0x807004
+  8026a7:	e8 09 e5 ff ff       	call   800bb5 <memmove>
+  8026ac:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8026b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026b7:	e8 3f ff ff ff       	call   8025fb <nsipc>
+  8026bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026bf:	c9                   	leave
+  8026c0:	c3                   	ret
+
+008026c1 <nsipc_shutdown>:
+  8026c1:	55                   	push   %ebp
+  8026c2:	89 e5                	mov    %esp,%ebp
+  8026c4:	83 ec 08             	sub    $0x8,%esp
+  8026c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ca:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026d2:	a3 04 70 80 00       	mov    %eax,0x807004
+  8026d7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026dc:	e8 1a ff ff ff       	call   8025fb <nsipc>
+  8026e1:	c9                   	leave
+  8026e2:	c3                   	ret
+
+008026e3 <nsipc_close>:
+  8026e3:	55                   	push   %ebp
+  8026e4:	89 e5                	mov    %esp,%ebp
+  8026e6:	83 ec 08             	sub    $0x8,%esp
+  8026e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ec:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026f1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026f6:	e8 00 ff ff ff       	call   8025fb <nsipc>
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+
+008026fd <nsipc_connect>:
+  8026fd:	55                   	push   %ebp
+  8026fe:	89 e5                	mov    %esp,%ebp
+  802700:	53                   	push   %ebx
+  802701:	83 ec 08             	sub    $0x8,%esp
+  802704:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802707:	8b 45 08             	mov    0x8(%ebp),%eax
+  80270a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80270f:	53                   	push   %ebx
+  802710:	ff 75 0c             	push   0xc(%ebp)
+  802713:	68 04 70 80 00       	push   $0x807004
+  802718:	e8 98 e4 ff ff       	call   800bb5 <memmove>
+  80271d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802723:	b8 05 00 00 00       	mov    $0x5,%eax
+  802728:	e8 ce fe ff ff       	call   8025fb <nsipc>
+  80272d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802730:	c9                   	leave
+  802731:	c3                   	ret
+
+00802732 <nsipc_listen>:
+  802732:	55                   	push   %ebp
+  802733:	89 e5                	mov    %esp,%ebp
+  802735:	83 ec 08             	sub    $0x8,%esp
+  802738:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802740:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802743:	a3 04 70 80 00       	mov    %eax,0x807004
+  802748:	b8 06 00 00 00       	mov    $0x6,%eax
+  80274d:	e8 a9 fe ff ff       	call   8025fb <nsipc>
+  802752:	c9                   	leave
+  802753:	c3                   	ret
+
+00802754 <nsipc_recv>:
+  802754:	55                   	push   %ebp
+  802755:	89 e5                	mov    %esp,%ebp
+  802757:	56                   	push   %esi
+  802758:	53                   	push   %ebx
+  802759:	8b 75 10             	mov    0x10(%ebp),%esi
+  80275c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802764:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80276a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80276d:	a3 08 70 80 00       	mov    %eax,0x807008
+  802772:	b8 07 00 00 00       	mov    $0x7,%eax
+  802777:	e8 7f fe ff ff       	call   8025fb <nsipc>
+  80277c:	89 c3                	mov    %eax,%ebx
+  80277e:	85 c0                	test   %eax,%eax
+  802780:	78 22                	js     8027a4 <nsipc_recv+0x50>
+  802782:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802787:	39 c6                	cmp    %eax,%esi
+  802789:	0f 4e c6             	cmovle %esi,%eax
+  80278c:	39 c3                	cmp    %eax,%ebx
+  80278e:	7f 1d                	jg     8027ad <nsipc_recv+0x59>
+  802790:	83 ec 04             	sub    $0x4,%esp
+  802793:	53                   	push   %ebx
+  802794:	68 00 70 80 00       	push   $0x807000
+  802799:	ff 75 0c             	push   0xc(%ebp)
+  80279c:	e8 14 e4 ff ff       	call   800bb5 <memmove>
+  8027a1:	83 c4 10             	add    $0x10,%esp
+  8027a4:	89 d8                	mov    %ebx,%eax
+  8027a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a9:	5b                   	pop    %ebx
+  8027aa:	5e                   	pop    %esi
+  8027ab:	5d                   	pop    %ebp
+  8027ac:	c3                   	ret
+  8027ad:	68 94 38 80 00       	push   $0x803894
+  8027b2:	68 a9 38 80 00       	push   $0x8038a9
+  8027b7:	6a 60                	push   $0x60
+  8027b9:	68 be 38 80 00       	push   $0x8038be
+  8027be:	e8 70 da ff ff       	call   800233 <_panic>
+
+008027c3 <nsipc_send>:
+  8027c3:	55                   	push   %ebp
+  8027c4:	89 e5                	mov    %esp,%ebp
+  8027c6:	53                   	push   %ebx
+  8027c7:	83 ec 04             	sub    $0x4,%esp
+  8027ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027d5:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8027db:	7f 2e                	jg     80280b <nsipc_send+0x48>
+  8027dd:	83 ec 04             	sub    $0x4,%esp
+  8027e0:	53                   	push   %ebx
+  8027e1:	ff 75 0c             	push   0xc(%ebp)
+  8027e4:	68 0c 70 80 00       	push   $0x80700c
+  8027e9:	e8 c7 e3 ff ff       	call   800bb5 <memmove>
+  8027ee:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8027f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027f7:	a3 08 70 80 00       	mov    %eax,0x807008
+  8027fc:	b8 08 00 00 00       	mov    $0x8,%eax
+  802801:	e8 f5 fd ff ff       	call   8025fb <nsipc>
+  802806:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802809:	c9                   	leave
+  80280a:	c3                   	ret
+  80280b:	68 ca 38 80 00       	push   $0x8038ca
+  802810:	68 a9 38 80 00       	push   $0x8038a9
+  802815:	6a 6b                	push   $0x6b
+  802817:	68 be 38 80 00       	push   $0x8038be
+  80281c:	e8 12 da ff ff       	call   800233 <_panic>
+
+00802821 <nsipc_socket>:
+  802821:	55                   	push   %ebp
+  802822:	89 e5                	mov    %esp,%ebp
+  802824:	83 ec 08             	sub    $0x8,%esp
+  802827:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80282f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802832:	a3 04 70 80 00       	mov    %eax,0x807004
+  802837:	8b 45 10             	mov    0x10(%ebp),%eax
+  80283a:	a3 08 70 80 00       	mov    %eax,0x807008
+  80283f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802844:	e8 b2 fd ff ff       	call   8025fb <nsipc>
+  802849:	c9                   	leave
+  80284a:	c3                   	ret
+
+0080284b <devpipe_stat>:
+  80284b:	55                   	push   %ebp
+  80284c:	89 e5                	mov    %esp,%ebp
+  80284e:	56                   	push   %esi
+  80284f:	53                   	push   %ebx
+  802850:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802853:	83 ec 0c             	sub    $0xc,%esp
+  802856:	ff 75 08             	push   0x8(%ebp)
+  802859:	e8 85 ee ff ff       	call   8016e3 <fd2data>
+  80285e:	89 c6                	mov    %eax,%esi
+  802860:	83 c4 08             	add    $0x8,%esp
+  802863:	68 d6 38 80 00       	push   $0x8038d6
+  802868:	53                   	push   %ebx
+  802869:	e8 97 e1 ff ff       	call   800a05 <strcpy>
+  80286e:	8b 46 04             	mov    0x4(%esi),%eax
+  802871:	2b 06                	sub    (%esi),%eax
+  802873:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802879:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802880:	00 00 00 
+  802883:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80288a:	40 80 00 
+  80288d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802892:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802895:	5b                   	pop    %ebx
+  802896:	5e                   	pop    %esi
+  802897:	5d                   	pop    %ebp
+  802898:	c3                   	ret
+
+00802899 <devpipe_close>:
+  802899:	55                   	push   %ebp
+  80289a:	89 e5                	mov    %esp,%ebp
+  80289c:	53                   	push   %ebx
+  80289d:	83 ec 0c             	sub    $0xc,%esp
+  8028a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028a3:	53                   	push   %ebx
+  8028a4:	6a 00                	push   $0x0
+  8028a6:	e8 8c e6 ff ff       	call   800f37 <sys_page_unmap>
+  8028ab:	89 1c 24             	mov    %ebx,(%esp)
+  8028ae:	e8 30 ee ff ff       	call   8016e3 <fd2data>
+  8028b3:	83 c4 08             	add    $0x8,%esp
+  8028b6:	50                   	push   %eax
+  8028b7:	6a 00                	push   $0x0
+  8028b9:	e8 79 e6 ff ff       	call   800f37 <sys_page_unmap>
+  8028be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028c1:	c9                   	leave
+  8028c2:	c3                   	ret
+
+008028c3 <_pipeisclosed>:
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	57                   	push   %edi
+  8028c7:	56                   	push   %esi
+  8028c8:	53                   	push   %ebx
+  8028c9:	83 ec 1c             	sub    $0x1c,%esp
+  8028cc:	89 c7                	mov    %eax,%edi
+  8028ce:	89 d6                	mov    %edx,%esi
+  8028d0:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  8028d5:	8b 58 58             	mov    0x58(%eax),%ebx
+  8028d8:	83 ec 0c             	sub    $0xc,%esp
+  8028db:	57                   	push   %edi
+  8028dc:	e8 d2 08 00 00       	call   8031b3 <pageref>
+  8028e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028e4:	89 34 24             	mov    %esi,(%esp)
+  8028e7:	e8 c7 08 00 00       	call   8031b3 <pageref>
+  8028ec:	8b 15 20 5b 80 00    	mov    0x805b20,%edx
+  8028f2:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8028f5:	83 c4 10             	add    $0x10,%esp
+  8028f8:	39 cb                	cmp    %ecx,%ebx
+  8028fa:	74 1b                	je     802917 <_pipeisclosed+0x54>
+  8028fc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8028ff:	75 cf                	jne    8028d0 <_pipeisclosed+0xd>
+  802901:	8b 42 58             	mov    0x58(%edx),%eax
+  802904:	6a 01                	push   $0x1
+  802906:	50                   	push   %eax
+  802907:	53                   	push   %ebx
+  802908:	68 dd 38 80 00       	push   $0x8038dd
+  80290d:	e8 fc d9 ff ff       	call   80030e <cprintf>
+  802912:	83 c4 10             	add    $0x10,%esp
+  802915:	eb b9                	jmp    8028d0 <_pipeisclosed+0xd>
+  802917:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80291a:	0f 94 c0             	sete   %al
+  80291d:	0f b6 c0             	movzbl %al,%eax
+  802920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802923:	5b                   	pop    %ebx
+  802924:	5e                   	pop    %esi
+  802925:	5f                   	pop    %edi
+  802926:	5d                   	pop    %ebp
+  802927:	c3                   	ret
+
+00802928 <devpipe_write>:
+  802928:	55                   	push   %ebp
+  802929:	89 e5                	mov    %esp,%ebp
+  80292b:	57                   	push   %edi
+  80292c:	56                   	push   %esi
+  80292d:	53                   	push   %ebx
+  80292e:	83 ec 28             	sub    $0x28,%esp
+  802931:	8b 75 08             	mov    0x8(%ebp),%esi
+  802934:	56                   	push   %esi
+  802935:	e8 a9 ed ff ff       	call   8016e3 <fd2data>
+  80293a:	89 c3                	mov    %eax,%ebx
+  80293c:	83 c4 10             	add    $0x10,%esp
+  80293f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802944:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802948:	74 5c                	je     8029a6 <devpipe_write+0x7e>
+  80294a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80294d:	8b 0b                	mov    (%ebx),%ecx
+  80294f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802952:	39 d0                	cmp    %edx,%eax
+  802954:	72 1e                	jb     802974 <devpipe_write+0x4c>
+  802956:	89 da                	mov    %ebx,%edx
+  802958:	89 f0                	mov    %esi,%eax
+  80295a:	e8 64 ff ff ff       	call   8028c3 <_pipeisclosed>
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	75 48                	jne    8029ab <devpipe_write+0x83>
+  802963:	e8 b2 e4 ff ff       	call   800e1a <sys_yield>
+  802968:	8b 43 04             	mov    0x4(%ebx),%eax
+  80296b:	8b 0b                	mov    (%ebx),%ecx
+  80296d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802970:	39 d0                	cmp    %edx,%eax
+  802972:	73 e2                	jae    802956 <devpipe_write+0x2e>
+  802974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802977:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80297b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80297e:	89 c2                	mov    %eax,%edx
+  802980:	c1 fa 1f             	sar    $0x1f,%edx
+  802983:	89 d1                	mov    %edx,%ecx
+  802985:	c1 e9 1b             	shr    $0x1b,%ecx
+  802988:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80298b:	83 e2 1f             	and    $0x1f,%edx
+  80298e:	29 ca                	sub    %ecx,%edx
+  802990:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802994:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802998:	83 c0 01             	add    $0x1,%eax
+  80299b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80299e:	83 c7 01             	add    $0x1,%edi
+  8029a1:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8029a4:	75 a4                	jne    80294a <devpipe_write+0x22>
+  8029a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029a9:	eb 05                	jmp    8029b0 <devpipe_write+0x88>
+  8029ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029b3:	5b                   	pop    %ebx
+  8029b4:	5e                   	pop    %esi
+  8029b5:	5f                   	pop    %edi
+  8029b6:	5d                   	pop    %ebp
+  8029b7:	c3                   	ret
+
+008029b8 <devpipe_read>:
+  8029b8:	55                   	push   %ebp
+  8029b9:	89 e5                	mov    %esp,%ebp
+  8029bb:	57                   	push   %edi
+  8029bc:	56                   	push   %esi
+  8029bd:	53                   	push   %ebx
+  8029be:	83 ec 18             	sub    $0x18,%esp
+  8029c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029c4:	56                   	push   %esi
+  8029c5:	e8 19 ed ff ff       	call   8016e3 <fd2data>
+  8029ca:	89 c3                	mov    %eax,%ebx
+  8029cc:	83 c4 10             	add    $0x10,%esp
+  8029cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029d8:	74 45                	je     802a1f <devpipe_read+0x67>
+  8029da:	8b 03                	mov    (%ebx),%eax
+  8029dc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029df:	75 1d                	jne    8029fe <devpipe_read+0x46>
+  8029e1:	85 ff                	test   %edi,%edi
+  8029e3:	75 3f                	jne    802a24 <devpipe_read+0x6c>
+  8029e5:	89 da                	mov    %ebx,%edx
+  8029e7:	89 f0                	mov    %esi,%eax
+  8029e9:	e8 d5 fe ff ff       	call   8028c3 <_pipeisclosed>
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	75 3c                	jne    802a2e <devpipe_read+0x76>
+  8029f2:	e8 23 e4 ff ff       	call   800e1a <sys_yield>
+  8029f7:	8b 03                	mov    (%ebx),%eax
+  8029f9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029fc:	74 e7                	je     8029e5 <devpipe_read+0x2d>
+  8029fe:	99                   	cltd
+  8029ff:	c1 ea 1b             	shr    $0x1b,%edx
+  802a02:	01 d0                	add    %edx,%eax
+  802a04:	83 e0 1f             	and    $0x1f,%eax
+  802a07:	29 d0                	sub    %edx,%eax
+  802a09:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a11:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802a14:	83 03 01             	addl   $0x1,(%ebx)
+  802a17:	83 c7 01             	add    $0x1,%edi
+  802a1a:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802a1d:	75 bb                	jne    8029da <devpipe_read+0x22>
+  802a1f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a22:	eb 02                	jmp    802a26 <devpipe_read+0x6e>
+  802a24:	89 f8                	mov    %edi,%eax
+  802a26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a29:	5b                   	pop    %ebx
+  802a2a:	5e                   	pop    %esi
+  802a2b:	5f                   	pop    %edi
+  802a2c:	5d                   	pop    %ebp
+  802a2d:	c3                   	ret
+  802a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a33:	eb f1                	jmp    802a26 <devpipe_read+0x6e>
+
+00802a35 <pipe>:
+  802a35:	55                   	push   %ebp
+  802a36:	89 e5                	mov    %esp,%ebp
+  802a38:	56                   	push   %esi
+  802a39:	53                   	push   %ebx
+  802a3a:	83 ec 1c             	sub    $0x1c,%esp
+  802a3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a40:	50                   	push   %eax
+  802a41:	e8 b4 ec ff ff       	call   8016fa <fd_alloc>
+  802a46:	89 c3                	mov    %eax,%ebx
+  802a48:	83 c4 10             	add    $0x10,%esp
+  802a4b:	85 c0                	test   %eax,%eax
+  802a4d:	0f 88 23 01 00 00    	js     802b76 <pipe+0x141>
+  802a53:	83 ec 04             	sub    $0x4,%esp
+  802a56:	68 07 04 00 00       	push   $0x407
+  802a5b:	ff 75 f4             	push   -0xc(%ebp)
+  802a5e:	6a 00                	push   $0x0
+  802a60:	e8 00 e4 ff ff       	call   800e65 <sys_page_alloc>
+  802a65:	89 c3                	mov    %eax,%ebx
+  802a67:	83 c4 10             	add    $0x10,%esp
+  802a6a:	85 c0                	test   %eax,%eax
+  802a6c:	0f 88 04 01 00 00    	js     802b76 <pipe+0x141>
+  802a72:	83 ec 0c             	sub    $0xc,%esp
+  802a75:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a78:	50                   	push   %eax
+  802a79:	e8 7c ec ff ff       	call   8016fa <fd_alloc>
+  802a7e:	89 c3                	mov    %eax,%ebx
+  802a80:	83 c4 10             	add    $0x10,%esp
+  802a83:	85 c0                	test   %eax,%eax
+  802a85:	0f 88 db 00 00 00    	js     802b66 <pipe+0x131>
+  802a8b:	83 ec 04             	sub    $0x4,%esp
+  802a8e:	68 07 04 00 00       	push   $0x407
+  802a93:	ff 75 f0             	push   -0x10(%ebp)
+  802a96:	6a 00                	push   $0x0
+  802a98:	e8 c8 e3 ff ff       	call   800e65 <sys_page_alloc>
+  802a9d:	89 c3                	mov    %eax,%ebx
+  802a9f:	83 c4 10             	add    $0x10,%esp
+  802aa2:	85 c0                	test   %eax,%eax
+  802aa4:	0f 88 bc 00 00 00    	js     802b66 <pipe+0x131>
+  802aaa:	83 ec 0c             	sub    $0xc,%esp
+  802aad:	ff 75 f4             	push   -0xc(%ebp)
+  802ab0:	e8 2e ec ff ff       	call   8016e3 <fd2data>
+  802ab5:	89 c6                	mov    %eax,%esi
+  802ab7:	83 c4 0c             	add    $0xc,%esp
+  802aba:	68 07 04 00 00       	push   $0x407
+  802abf:	50                   	push   %eax
+  802ac0:	6a 00                	push   $0x0
+  802ac2:	e8 9e e3 ff ff       	call   800e65 <sys_page_alloc>
+  802ac7:	89 c3                	mov    %eax,%ebx
+  802ac9:	83 c4 10             	add    $0x10,%esp
+  802acc:	85 c0                	test   %eax,%eax
+  802ace:	0f 88 82 00 00 00    	js     802b56 <pipe+0x121>
+  802ad4:	83 ec 0c             	sub    $0xc,%esp
+  802ad7:	ff 75 f0             	push   -0x10(%ebp)
+  802ada:	e8 04 ec ff ff       	call   8016e3 <fd2data>
+  802adf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ae6:	50                   	push   %eax
+  802ae7:	6a 00                	push   $0x0
+  802ae9:	56                   	push   %esi
+  802aea:	6a 00                	push   $0x0
+  802aec:	e8 b7 e3 ff ff       	call   800ea8 <sys_page_map>
+  802af1:	89 c3                	mov    %eax,%ebx
+  802af3:	83 c4 20             	add    $0x20,%esp
+  802af6:	85 c0                	test   %eax,%eax
+  802af8:	78 4e                	js     802b48 <pipe+0x113>
+  802afa:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802aff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b02:	89 02                	mov    %eax,(%edx)
+  802b04:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b07:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802b0e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b11:	89 02                	mov    %eax,(%edx)
+  802b13:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b16:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802b1d:	83 ec 0c             	sub    $0xc,%esp
+  802b20:	ff 75 f4             	push   -0xc(%ebp)
+  802b23:	e8 ab eb ff ff       	call   8016d3 <fd2num>
+  802b28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b2b:	89 01                	mov    %eax,(%ecx)
+  802b2d:	83 c4 04             	add    $0x4,%esp
+  802b30:	ff 75 f0             	push   -0x10(%ebp)
+  802b33:	e8 9b eb ff ff       	call   8016d3 <fd2num>
+  802b38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b3b:	89 41 04             	mov    %eax,0x4(%ecx)
+  802b3e:	83 c4 10             	add    $0x10,%esp
+  802b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b46:	eb 2e                	jmp    802b76 <pipe+0x141>
+  802b48:	83 ec 08             	sub    $0x8,%esp
+  802b4b:	56                   	push   %esi
+  802b4c:	6a 00                	push   $0x0
+  802b4e:	e8 e4 e3 ff ff       	call   800f37 <sys_page_unmap>
+  802b53:	83 c4 10             	add    $0x10,%esp
+  802b56:	83 ec 08             	sub    $0x8,%esp
+  802b59:	ff 75 f0             	push   -0x10(%ebp)
+  802b5c:	6a 00                	push   $0x0
+  802b5e:	e8 d4 e3 ff ff       	call   800f37 <sys_page_unmap>
+  802b63:	83 c4 10             	add    $0x10,%esp
+  802b66:	83 ec 08             	sub    $0x8,%esp
+  802b69:	ff 75 f4             	push   -0xc(%ebp)
+  802b6c:	6a 00                	push   $0x0
+  802b6e:	e8 c4 e3 ff ff       	call   800f37 <sys_page_unmap>
+  802b73:	83 c4 10             	add    $0x10,%esp
+  802b76:	89 d8                	mov    %ebx,%eax
+  802b78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b7b:	5b                   	pop    %ebx
+  802b7c:	5e                   	pop    %esi
+  802b7d:	5d                   	pop    %ebp
+  802b7e:	c3                   	ret
+
+00802b7f <pipeisclosed>:
+  802b7f:	55                   	push   %ebp
+  802b80:	89 e5                	mov    %esp,%ebp
+  802b82:	83 ec 20             	sub    $0x20,%esp
+  802b85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b88:	50                   	push   %eax
+  802b89:	ff 75 08             	push   0x8(%ebp)
+  802b8c:	e8 b9 eb ff ff       	call   80174a <fd_lookup>
+  802b91:	83 c4 10             	add    $0x10,%esp
+  802b94:	85 c0                	test   %eax,%eax
+  802b96:	78 18                	js     802bb0 <pipeisclosed+0x31>
+  802b98:	83 ec 0c             	sub    $0xc,%esp
+  802b9b:	ff 75 f4             	push   -0xc(%ebp)
+  802b9e:	e8 40 eb ff ff       	call   8016e3 <fd2data>
+  802ba3:	89 c2                	mov    %eax,%edx
+  802ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba8:	e8 16 fd ff ff       	call   8028c3 <_pipeisclosed>
+  802bad:	83 c4 10             	add    $0x10,%esp
+  802bb0:	c9                   	leave
+  802bb1:	c3                   	ret
+
+00802bb2 <ipcring_init>:
+  802bb2:	55                   	push   %ebp
+  802bb3:	89 e5                	mov    %esp,%ebp
+  802bb5:	53                   	push   %ebx
+  802bb6:	83 ec 08             	sub    $0x8,%esp
+  802bb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bbc:	6a 60                	push   $0x60
+  802bbe:	6a 00                	push   $0x0
+  802bc0:	53                   	push   %ebx
+  802bc1:	e8 ba df ff ff       	call   800b80 <memset>
+  802bc6:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  802bcb:	8b 40 48             	mov    0x48(%eax),%eax
+  802bce:	89 03                	mov    %eax,(%ebx)
+  802bd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bd3:	89 43 04             	mov    %eax,0x4(%ebx)
+  802bd6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd9:	89 43 08             	mov    %eax,0x8(%ebx)
+  802bdc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bdf:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802be2:	83 c4 10             	add    $0x10,%esp
+  802be5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+00802bea <ipcring_req_slot>:
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf0:	8b 50 10             	mov    0x10(%eax),%edx
+  802bf3:	8b 48 18             	mov    0x18(%eax),%ecx
+  802bf6:	29 ca                	sub    %ecx,%edx
+  802bf8:	83 fa 07             	cmp    $0x7,%edx
+  802bfb:	77 0c                	ja     802c09 <ipcring_req_slot+0x1f>
+  802bfd:	8b 50 10             	mov    0x10(%eax),%edx
+  802c00:	83 e2 07             	and    $0x7,%edx
+  802c03:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802c07:	5d                   	pop    %ebp
+  802c08:	c3                   	ret
+  802c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0e:	eb f7                	jmp    802c07 <ipcring_req_slot+0x1d>
+
+00802c10 <ipcring_req_push>:
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	83 ec 08             	sub    $0x8,%esp
+  802c16:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c19:	8b 42 10             	mov    0x10(%edx),%eax
+  802c1c:	83 c0 01             	add    $0x1,%eax
+  802c1f:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c28:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802c2c:	85 c0                	test   %eax,%eax
+  802c2e:	75 02                	jne    802c32 <ipcring_req_push+0x22>
+  802c30:	c9                   	leave
+  802c31:	c3                   	ret
+  802c32:	6a 00                	push   $0x0
+  802c34:	68 00 00 80 ee       	push   $0xee800000
+  802c39:	ff 72 08             	push   0x8(%edx)
+  802c3c:	ff 72 04             	push   0x4(%edx)
+  802c3f:	e8 59 e5 ff ff       	call   80119d <sys_ipc_send>
+  802c44:	83 c4 10             	add    $0x10,%esp
+  802c47:	eb e7                	jmp    802c30 <ipcring_req_push+0x20>
+
+00802c49 <ipcring_rsp_wait>:
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	53                   	push   %ebx
+  802c4d:	83 ec 04             	sub    $0x4,%esp
+  802c50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c53:	8b 53 18             	mov    0x18(%ebx),%edx
+  802c56:	8b 43 10             	mov    0x10(%ebx),%eax
+  802c59:	39 c2                	cmp    %eax,%edx
+  802c5b:	74 3c                	je     802c99 <ipcring_rsp_wait+0x50>
+  802c5d:	8b 53 14             	mov    0x14(%ebx),%edx
+  802c60:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c63:	39 c2                	cmp    %eax,%edx
+  802c65:	75 23                	jne    802c8a <ipcring_rsp_wait+0x41>
+  802c67:	83 ec 08             	sub    $0x8,%esp
+  802c6a:	6a 00                	push   $0x0
+  802c6c:	6a 00                	push   $0x0
+  802c6e:	6a 00                	push   $0x0
+  802c70:	6a 00                	push   $0x0
+  802c72:	ff 73 0c             	push   0xc(%ebx)
+  802c75:	ff 73 04             	push   0x4(%ebx)
+  802c78:	e8 81 03 00 00       	call   802ffe <ipc_call>
+  802c7d:	8b 53 14             	mov    0x14(%ebx),%edx
+  802c80:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c83:	83 c4 20             	add    $0x20,%esp
+  802c86:	39 c2                	cmp    %eax,%edx
+  802c88:	74 dd                	je     802c67 <ipcring_rsp_wait+0x1e>
+  802c8a:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c8d:	83 e0 07             	and    $0x7,%eax
+  802c90:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802c94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c97:	c9                   	leave
+  802c98:	c3                   	ret
+  802c99:	68 f8 38 80 00       	push   $0x8038f8
+  802c9e:	68 a9 38 80 00       	push   $0x8038a9
+  802ca3:	6a 3b                	push   $0x3b
+  802ca5:	68 19 39 80 00       	push   $0x803919
+  802caa:	e8 84 d5 ff ff       	call   800233 <_panic>
+
+00802caf <ipcring_rsp_pop>:
+  802caf:	55                   	push   %ebp
+  802cb0:	89 e5                	mov    %esp,%ebp
+  802cb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cb5:	8b 42 18             	mov    0x18(%edx),%eax
+  802cb8:	83 c0 01             	add    $0x1,%eax
+  802cbb:	89 42 18             	mov    %eax,0x18(%edx)
+  802cbe:	5d                   	pop    %ebp
+  802cbf:	c3                   	ret
+
+00802cc0 <ipcring_server_init>:
+  802cc0:	55                   	push   %ebp
+  802cc1:	89 e5                	mov    %esp,%ebp
+  802cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802cc9:	89 10                	mov    %edx,(%eax)
+  802ccb:	8b 55 10             	mov    0x10(%ebp),%edx
+  802cce:	89 50 04             	mov    %edx,0x4(%eax)
+  802cd1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802cd8:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802cdf:	5d                   	pop    %ebp
+  802ce0:	c3                   	ret
+
+00802ce1 <ipcring_req_avail>:
+  802ce1:	55                   	push   %ebp
+  802ce2:	89 e5                	mov    %esp,%ebp
+  802ce4:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ce7:	8b 02                	mov    (%edx),%eax
+  802ce9:	8b 40 10             	mov    0x10(%eax),%eax
+  802cec:	2b 42 08             	sub    0x8(%edx),%eax
+  802cef:	ba 08 00 00 00       	mov    $0x8,%edx
+  802cf4:	39 d0                	cmp    %edx,%eax
+  802cf6:	0f 47 c2             	cmova  %edx,%eax
+  802cf9:	5d                   	pop    %ebp
+  802cfa:	c3                   	ret
+
+00802cfb <ipcring_req_peek>:
+  802cfb:	55                   	push   %ebp
+  802cfc:	89 e5                	mov    %esp,%ebp
+  802cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d01:	8b 42 08             	mov    0x8(%edx),%eax
+  802d04:	83 e0 07             	and    $0x7,%eax
+  802d07:	8b 12                	mov    (%edx),%edx
+  802d09:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802d0d:	5d                   	pop    %ebp
+  802d0e:	c3                   	ret
+
+00802d0f <ipcring_rsp_push>:
+  802d0f:	55                   	push   %ebp
+  802d10:	89 e5                	mov    %esp,%ebp
+  802d12:	83 ec 08             	sub    $0x8,%esp
+  802d15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d18:	8b 41 08             	mov    0x8(%ecx),%eax
+  802d1b:	83 c0 01             	add    $0x1,%eax
+  802d1e:	89 41 08             	mov    %eax,0x8(%ecx)
+  802d21:	8b 11                	mov    (%ecx),%edx
+  802d23:	83 c2 14             	add    $0x14,%edx
+  802d26:	f0 87 02             	lock xchg %eax,(%edx)
+  802d29:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802d2d:	75 02                	jne    802d31 <ipcring_rsp_push+0x22>
+  802d2f:	c9                   	leave
+  802d30:	c3                   	ret
+  802d31:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802d38:	6a 00                	push   $0x0
+  802d3a:	68 00 00 80 ee       	push   $0xee800000
+  802d3f:	6a 00                	push   $0x0
+  802d41:	ff 71 04             	push   0x4(%ecx)
+  802d44:	e8 77 e3 ff ff       	call   8010c0 <sys_ipc_try_send>
+  802d49:	83 c4 10             	add    $0x10,%esp
+  802d4c:	eb e1                	jmp    802d2f <ipcring_rsp_push+0x20>
+
+00802d4e <ipcring_client_wait>:
+  802d4e:	55                   	push   %ebp
+  802d4f:	89 e5                	mov    %esp,%ebp
+  802d51:	83 ec 08             	sub    $0x8,%esp
+  802d54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d57:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802d5e:	8b 10                	mov    (%eax),%edx
+  802d60:	8b 52 18             	mov    0x18(%edx),%edx
+  802d63:	3b 50 08             	cmp    0x8(%eax),%edx
+  802d66:	75 02                	jne    802d6a <ipcring_client_wait+0x1c>
+  802d68:	c9                   	leave
+  802d69:	c3                   	ret
+  802d6a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802d71:	6a 00                	push   $0x0
+  802d73:	68 00 00 80 ee       	push   $0xee800000
+  802d78:	6a 00                	push   $0x0
+  802d7a:	ff 70 04             	push   0x4(%eax)
+  802d7d:	e8 3e e3 ff ff       	call   8010c0 <sys_ipc_try_send>
+  802d82:	83 c4 10             	add    $0x10,%esp
+  802d85:	eb e1                	jmp    802d68 <ipcring_client_wait+0x1a>
+
+00802d87 <ipcring_server_sleep>:
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	53                   	push   %ebx
+  802d8b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d8e:	8b 01                	mov    (%ecx),%eax
+  802d90:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802d93:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d98:	f0 87 02             	lock xchg %eax,(%edx)
+  802d9b:	8b 11                	mov    (%ecx),%edx
+  802d9d:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802da0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802da5:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802da8:	74 0e                	je     802db8 <ipcring_server_sleep+0x31>
+  802daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802daf:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dbb:	c9                   	leave
+  802dbc:	c3                   	ret
+
+00802dbd <devcons_close>:
+  802dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc2:	c3                   	ret
+
+00802dc3 <devcons_stat>:
+  802dc3:	55                   	push   %ebp
+  802dc4:	89 e5                	mov    %esp,%ebp
+  802dc6:	83 ec 10             	sub    $0x10,%esp
+  802dc9:	68 27 39 80 00       	push   $0x803927
+  802dce:	ff 75 0c             	push   0xc(%ebp)
+  802dd1:	e8 2f dc ff ff       	call   800a05 <strcpy>
+  802dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddb:	c9                   	leave
+  802ddc:	c3                   	ret
+
+00802ddd <devcons_write>:
+  802ddd:	55                   	push   %ebp
+  802dde:	89 e5                	mov    %esp,%ebp
+  802de0:	57                   	push   %edi
+  802de1:	56                   	push   %esi
+  802de2:	53                   	push   %ebx
+  802de3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802de9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802dec:	85 ff                	test   %edi,%edi
+  802dee:	74 51                	je     802e41 <devcons_write+0x64>
+  802df0:	be 00 00 00 00       	mov    $0x0,%esi
+  802df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfa:	89 fb                	mov    %edi,%ebx
+  802dfc:	29 c3                	sub    %eax,%ebx
+  802dfe:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802e03:	39 d3                	cmp    %edx,%ebx
+  802e05:	0f 47 da             	cmova  %edx,%ebx
+  802e08:	83 ec 04             	sub    $0x4,%esp
+  802e0b:	53                   	push   %ebx
+  802e0c:	03 45 0c             	add    0xc(%ebp),%eax
+  802e0f:	50                   	push   %eax
+  802e10:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802e16:	50                   	push   %eax
+  802e17:	e8 99 dd ff ff       	call   800bb5 <memmove>
+  802e1c:	83 c4 08             	add    $0x8,%esp
+  802e1f:	53                   	push   %ebx
+  802e20:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802e26:	50                   	push   %eax
+  802e27:	e8 51 df ff ff       	call   800d7d <sys_cputs>
+  802e2c:	01 de                	add    %ebx,%esi
+  802e2e:	89 f0                	mov    %esi,%eax
+  802e30:	83 c4 10             	add    $0x10,%esp
+  802e33:	39 fe                	cmp    %edi,%esi
+  802e35:	72 c3                	jb     802dfa <devcons_write+0x1d>
+  802e37:	89 f0                	mov    %esi,%eax
+  802e39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e3c:	5b                   	pop    %ebx
+  802e3d:	5e                   	pop    %esi
+  802e3e:	5f                   	pop    %edi
+  802e3f:	5d                   	pop    %ebp
+  802e40:	c3                   	ret
+  802e41:	be 00 00 00 00       	mov    $0x0,%esi
+  802e46:	eb ef                	jmp    802e37 <devcons_write+0x5a>
+
+00802e48 <devcons_read>:
+  802e48:	55                   	push   %ebp
+  802e49:	89 e5                	mov    %esp,%ebp
+  802e4b:	83 ec 08             	sub    $0x8,%esp
+  802e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e53:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e57:	75 07                	jne    802e60 <devcons_read+0x18>
+  802e59:	eb 1f                	jmp    802e7a <devcons_read+0x32>
+  802e5b:	e8 ba df ff ff       	call   800e1a <sys_yield>
+  802e60:	e8 36 df ff ff       	call   800d9b <sys_cgetc>
+  802e65:	85 c0                	test   %eax,%eax
+  802e67:	74 f2                	je     802e5b <devcons_read+0x13>
+  802e69:	78 0f                	js     802e7a <devcons_read+0x32>
+  802e6b:	83 f8 04             	cmp    $0x4,%eax
+  802e6e:	74 0c                	je     802e7c <devcons_read+0x34>
+  802e70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e73:	88 02                	mov    %al,(%edx)
+  802e75:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+  802e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e81:	eb f7                	jmp    802e7a <devcons_read+0x32>
+
+00802e83 <cputchar>:
+  802e83:	55                   	push   %ebp
+  802e84:	89 e5                	mov    %esp,%ebp
+  802e86:	83 ec 20             	sub    $0x20,%esp
+  802e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8c:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802e8f:	6a 01                	push   $0x1
+  802e91:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e94:	50                   	push   %eax
+  802e95:	e8 e3 de ff ff       	call   800d7d <sys_cputs>
+  802e9a:	83 c4 10             	add    $0x10,%esp
+  802e9d:	c9                   	leave
+  802e9e:	c3                   	ret
+
+00802e9f <getchar>:
+  802e9f:	55                   	push   %ebp
+  802ea0:	89 e5                	mov    %esp,%ebp
+  802ea2:	83 ec 1c             	sub    $0x1c,%esp
+  802ea5:	6a 01                	push   $0x1
+  802ea7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802eaa:	50                   	push   %eax
+  802eab:	6a 00                	push   $0x0
+  802ead:	e8 fa ea ff ff       	call   8019ac <read>
+  802eb2:	83 c4 10             	add    $0x10,%esp
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	78 06                	js     802ebf <getchar+0x20>
+  802eb9:	74 06                	je     802ec1 <getchar+0x22>
+  802ebb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802ebf:	c9                   	leave
+  802ec0:	c3                   	ret
+  802ec1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802ec6:	eb f7                	jmp    802ebf <getchar+0x20>
+
+00802ec8 <iscons>:
+  802ec8:	55                   	push   %ebp
+  802ec9:	89 e5                	mov    %esp,%ebp
+  802ecb:	83 ec 20             	sub    $0x20,%esp
+  802ece:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ed1:	50                   	push   %eax
+  802ed2:	ff 75 08             	push   0x8(%ebp)
+  802ed5:	e8 70 e8 ff ff       	call   80174a <fd_lookup>
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	78 11                	js     802ef2 <iscons+0x2a>
+  802ee1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ee4:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802eea:	39 10                	cmp    %edx,(%eax)
+  802eec:	0f 94 c0             	sete   %al
+  802eef:	0f b6 c0             	movzbl %al,%eax
+  802ef2:	c9                   	leave
+  802ef3:	c3                   	ret
+
+00802ef4 <opencons>:
+  802ef4:	55                   	push   %ebp
+  802ef5:	89 e5                	mov    %esp,%ebp
+  802ef7:	83 ec 24             	sub    $0x24,%esp
+  802efa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802efd:	50                   	push   %eax
+  802efe:	e8 f7 e7 ff ff       	call   8016fa <fd_alloc>
+  802f03:	83 c4 10             	add    $0x10,%esp
+  802f06:	85 c0                	test   %eax,%eax
+  802f08:	78 3a                	js     802f44 <opencons+0x50>
+  802f0a:	83 ec 04             	sub    $0x4,%esp
+  802f0d:	68 07 04 00 00       	push   $0x407
+  802f12:	ff 75 f4             	push   -0xc(%ebp)
+  802f15:	6a 00                	push   $0x0
+  802f17:	e8 49 df ff ff       	call   800e65 <sys_page_alloc>
+  802f1c:	83 c4 10             	add    $0x10,%esp
+  802f1f:	85 c0                	test   %eax,%eax
+  802f21:	78 21                	js     802f44 <opencons+0x50>
+  802f23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f26:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802f2c:	89 10                	mov    %edx,(%eax)
+  802f2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f31:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802f38:	83 ec 0c             	sub    $0xc,%esp
+  802f3b:	50                   	push   %eax
+  802f3c:	e8 92 e7 ff ff       	call   8016d3 <fd2num>
+  802f41:	83 c4 10             	add    $0x10,%esp
+  802f44:	c9                   	leave
+  802f45:	c3                   	ret
+
+00802f46 <ipc_recv>:
+  802f46:	55                   	push   %ebp
+  802f47:	89 e5                	mov    %esp,%ebp
+  802f49:	56                   	push   %esi
+  802f4a:	53                   	push   %ebx
+  802f4b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f54:	85 c0                	test   %eax,%eax
+  802f56:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802f5b:	0f 44 c2             	cmove  %edx,%eax
+  802f5e:	83 ec 0c             	sub    $0xc,%esp
+  802f61:	50                   	push   %eax
+  802f62:	e8 a9 e1 ff ff       	call   801110 <sys_ipc_recv>
+  802f67:	83 c4 10             	add    $0x10,%esp
+  802f6a:	85 c0                	test   %eax,%eax
+  802f6c:	78 2a                	js     802f98 <ipc_recv+0x52>
+  802f6e:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  802f73:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802f79:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802f7f:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f85:	85 f6                	test   %esi,%esi
+  802f87:	74 02                	je     802f8b <ipc_recv+0x45>
+  802f89:	89 0e                	mov    %ecx,(%esi)
+  802f8b:	85 db                	test   %ebx,%ebx
+  802f8d:	74 02                	je     802f91 <ipc_recv+0x4b>
+  802f8f:	89 13                	mov    %edx,(%ebx)
+  802f91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f94:	5b                   	pop    %ebx
+  802f95:	5e                   	pop    %esi
+  802f96:	5d                   	pop    %ebp
+  802f97:	c3                   	ret
+  802f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fa2:	eb e1                	jmp    802f85 <ipc_recv+0x3f>
+
+00802fa4 <ipc_send>:
+  802fa4:	55                   	push   %ebp
+  802fa5:	89 e5                	mov    %esp,%ebp
+  802fa7:	57                   	push   %edi
+  802fa8:	56                   	push   %esi
+  802fa9:	53                   	push   %ebx
+  802faa:	83 ec 0c             	sub    $0xc,%esp
+  802fad:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802fb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fb3:	8b 75 14             	mov    0x14(%ebp),%esi
+  802fb6:	85 db                	test   %ebx,%ebx
+  802fb8:	74 1e                	je     802fd8 <ipc_send+0x34>
+  802fba:	56                   	push   %esi
+  802fbb:	53                   	push   %ebx
+  802fbc:	57                   	push   %edi
+  802fbd:	ff 75 08             	push   0x8(%ebp)
+  802fc0:	e8 d8 e1 ff ff       	call   80119d <sys_ipc_send>
+  802fc5:	83 c4 10             	add    $0x10,%esp
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	74 2a                	je     802ff6 <ipc_send+0x52>
+  802fcc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802fcf:	75 13                	jne    802fe4 <ipc_send+0x40>
+  802fd1:	e8 44 de ff ff       	call   800e1a <sys_yield>
+  802fd6:	eb e2                	jmp    802fba <ipc_send+0x16>
+  802fd8:	be 00 00 00 00       	mov    $0x0,%esi
+  802fdd:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802fe2:	eb d6                	jmp    802fba <ipc_send+0x16>
+  802fe4:	50                   	push   %eax
+  802fe5:	68 34 39 80 00       	push   $0x803934
+  802fea:	6a 4f                	push   $0x4f
+  802fec:	68 77 39 80 00       	push   $0x803977
+  802ff1:	e8 3d d2 ff ff       	call   800233 <_panic>
+  802ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff9:	5b                   	pop    %ebx
+  802ffa:	5e                   	pop    %esi
+  802ffb:	5f                   	pop    %edi
+  802ffc:	5d                   	pop    %ebp
+  802ffd:	c3                   	ret
+
+00802ffe <ipc_call>:
+  802ffe:	55                   	push   %ebp
+  802fff:	89 e5                	mov    %esp,%ebp
+  803001:	57                   	push   %edi
+  803002:	56                   	push   %esi
+  803003:	53                   	push   %ebx
+  803004:	83 ec 0c             	sub    $0xc,%esp
+  803007:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80300b:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803010:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803014:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803018:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  80301d:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803021:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80302a:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  80302e:	eb 05                	jmp    803035 <ipc_call+0x37>
+  803030:	e8 e5 dd ff ff       	call   800e1a <sys_yield>
+  803035:	83 ec 0c             	sub    $0xc,%esp
+  803038:	56                   	push   %esi
+  803039:	53                   	push   %ebx
+  80303a:	57                   	push   %edi
+  80303b:	ff 75 0c             	push   0xc(%ebp)
+  80303e:	ff 75 08             	push   0x8(%ebp)
+  803041:	e8 a7 e1 ff ff       	call   8011ed <sys_ipc_call>
+  803046:	83 c4 20             	add    $0x20,%esp
+  803049:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80304c:	74 e2                	je     803030 <ipc_call+0x32>
+  80304e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803051:	74 2d                	je     803080 <ipc_call+0x82>
+  803053:	85 c0                	test   %eax,%eax
+  803055:	78 4f                	js     8030a6 <ipc_call+0xa8>
+  803057:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80305b:	74 10                	je     80306d <ipc_call+0x6f>
+  80305d:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  803062:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803068:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80306b:	89 02                	mov    %eax,(%edx)
+  80306d:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  803072:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80307b:	5b                   	pop    %ebx
+  80307c:	5e                   	pop    %esi
+  80307d:	5f                   	pop    %edi
+  80307e:	5d                   	pop    %ebp
+  80307f:	c3                   	ret
+  803080:	ff 75 14             	push   0x14(%ebp)
+  803083:	ff 75 10             	push   0x10(%ebp)
+  803086:	ff 75 0c             	push   0xc(%ebp)
+  803089:	ff 75 08             	push   0x8(%ebp)
+  80308c:	e8 13 ff ff ff       	call   802fa4 <ipc_send>
+  803091:	83 c4 0c             	add    $0xc,%esp
+  803094:	ff 75 1c             	push   0x1c(%ebp)
+  803097:	ff 75 18             	push   0x18(%ebp)
+  80309a:	6a 00                	push   $0x0
+  80309c:	e8 a5 fe ff ff       	call   802f46 <ipc_recv>
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	eb d2                	jmp    803078 <ipc_call+0x7a>
+  8030a6:	50                   	push   %eax
+  8030a7:	68 81 39 80 00       	push   $0x803981
+  8030ac:	6a 6d                	push   $0x6d
+  8030ae:	68 77 39 80 00       	push   $0x803977
+  8030b3:	e8 7b d1 ff ff       	call   800233 <_panic>
+
+008030b8 <ipc_reply_recv>:
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	57                   	push   %edi
+  8030bc:	56                   	push   %esi
+  8030bd:	53                   	push   %ebx
+  8030be:	83 ec 0c             	sub    $0xc,%esp
+  8030c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030c4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8030c7:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8030ca:	85 db                	test   %ebx,%ebx
+  8030cc:	0f 84 ac 00 00 00    	je     80317e <ipc_reply_recv+0xc6>
+  8030d2:	85 f6                	test   %esi,%esi
+  8030d4:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8030d9:	0f 45 c6             	cmovne %esi,%eax
+  8030dc:	83 ec 0c             	sub    $0xc,%esp
+  8030df:	50                   	push   %eax
+  8030e0:	ff 75 14             	push   0x14(%ebp)
+  8030e3:	53                   	push   %ebx
+  8030e4:	ff 75 0c             	push   0xc(%ebp)
+  8030e7:	ff 75 08             	push   0x8(%ebp)
+  8030ea:	e8 1f e1 ff ff       	call   80120e <sys_ipc_reply_recv>
+  8030ef:	83 c4 20             	add    $0x20,%esp
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 3a                	js     803130 <ipc_reply_recv+0x78>
+  8030f6:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8030fa:	74 10                	je     80310c <ipc_reply_recv+0x54>
+  8030fc:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  803101:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803107:	8b 55 18             	mov    0x18(%ebp),%edx
+  80310a:	89 02                	mov    %eax,(%edx)
+  80310c:	85 ff                	test   %edi,%edi
+  80310e:	74 0d                	je     80311d <ipc_reply_recv+0x65>
+  803110:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  803115:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80311b:	89 07                	mov    %eax,(%edi)
+  80311d:	a1 20 5b 80 00       	mov    0x805b20,%eax
+  803122:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80312b:	5b                   	pop    %ebx
+  80312c:	5e                   	pop    %esi
+  80312d:	5f                   	pop    %edi
+  80312e:	5d                   	pop    %ebp
+  80312f:	c3                   	ret
+  803130:	ff 75 14             	push   0x14(%ebp)
+  803133:	53                   	push   %ebx
+  803134:	ff 75 0c             	push   0xc(%ebp)
+  803137:	ff 75 08             	push   0x8(%ebp)
+  80313a:	e8 81 df ff ff       	call   8010c0 <sys_ipc_try_send>
+  80313f:	89 c2                	mov    %eax,%edx
+  803141:	c1 ea 1f             	shr    $0x1f,%edx
+  803144:	83 c4 10             	add    $0x10,%esp
+  803147:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80314a:	0f 95 c1             	setne  %cl
+  80314d:	84 d1                	test   %dl,%cl
+  80314f:	74 05                	je     803156 <ipc_reply_recv+0x9e>
+  803151:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803154:	75 12                	jne    803168 <ipc_reply_recv+0xb0>
+  803156:	83 ec 04             	sub    $0x4,%esp
+  803159:	57                   	push   %edi
+  80315a:	56                   	push   %esi
+  80315b:	ff 75 18             	push   0x18(%ebp)
+  80315e:	e8 e3 fd ff ff       	call   802f46 <ipc_recv>
+  803163:	83 c4 10             	add    $0x10,%esp
+  803166:	eb c0                	jmp    803128 <ipc_reply_recv+0x70>
+  803168:	83 ec 04             	sub    $0x4,%esp
+  80316b:	50                   	push   %eax
+  80316c:	ff 75 08             	push   0x8(%ebp)
+  80316f:	68 54 39 80 00       	push   $0x803954
+  803174:	e8 95 d1 ff ff       	call   80030e <cprintf>
+  803179:	83 c4 10             	add    $0x10,%esp
+  80317c:	eb d8                	jmp    803156 <ipc_reply_recv+0x9e>
+  80317e:	85 f6                	test   %esi,%esi
+  803180:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803185:	0f 45 c6             	cmovne %esi,%eax
+  803188:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80318d:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803194:	e9 43 ff ff ff       	jmp    8030dc <ipc_reply_recv+0x24>
+
+00803199 <ipc_find_env>:
+  803199:	55                   	push   %ebp
+  80319a:	89 e5                	mov    %esp,%ebp
+  80319c:	83 ec 14             	sub    $0x14,%esp
+  80319f:	ff 75 08             	push   0x8(%ebp)
+  8031a2:	e8 b7 de ff ff       	call   80105e <sys_env_service>
+  8031a7:	85 c0                	test   %eax,%eax
+  8031a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ae:	0f 48 c2             	cmovs  %edx,%eax
+  8031b1:	c9                   	leave
+  8031b2:	c3                   	ret
+
+008031b3 <pageref>:
+  8031b3:	55                   	push   %ebp
+  8031b4:	89 e5                	mov    %esp,%ebp
+  8031b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b9:	89 c2                	mov    %eax,%edx
+  8031bb:	c1 ea 16             	shr    $0x16,%edx
+  8031be:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8031c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ca:	f6 c1 01             	test   $0x1,%cl
+  8031cd:	74 22                	je     8031f1 <pageref+0x3e>
+  8031cf:	c1 e8 0c             	shr    $0xc,%eax
+  8031d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031d9:	a8 01                	test   $0x1,%al
+  8031db:	74 14                	je     8031f1 <pageref+0x3e>
+  8031dd:	c1 e8 0c             	shr    $0xc,%eax
+  8031e0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8031e3:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8031ea:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8031ee:	0f b7 d2             	movzwl %dx,%edx
+  8031f1:	89 d0                	mov    %edx,%eax
+  8031f3:	5d                   	pop    %ebp
+  8031f4:	c3                   	ret
+
+008031f5 <__udivmoddi4>:
+  8031f5:	55                   	push   %ebp
+  8031f6:	57                   	push   %edi
+  8031f7:	56                   	push   %esi
+  8031f8:	53                   	push   %ebx
+  8031f9:	83 ec 24             	sub    $0x24,%esp
+  8031fc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803200:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803204:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803208:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80320c:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803210:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803214:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803218:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80321c:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803220:	b8 00 00 00 00       	mov    $0x0,%eax
+  803225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80322a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80322f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803236:	00 
+  803237:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80323e:	00 
+  80323f:	89 fb                	mov    %edi,%ebx
+  803241:	eb 08                	jmp    80324b <__udivmoddi4+0x56>
+  803243:	83 e9 01             	sub    $0x1,%ecx
+  803246:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803249:	74 68                	je     8032b3 <__udivmoddi4+0xbe>
+  80324b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80324f:	01 c0                	add    %eax,%eax
+  803251:	89 c6                	mov    %eax,%esi
+  803253:	89 d7                	mov    %edx,%edi
+  803255:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803259:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80325d:	0f ad d0             	shrd   %cl,%edx,%eax
+  803260:	d3 ea                	shr    %cl,%edx
+  803262:	f6 c1 20             	test   $0x20,%cl
+  803265:	74 04                	je     80326b <__udivmoddi4+0x76>
+  803267:	89 d0                	mov    %edx,%eax
+  803269:	31 d2                	xor    %edx,%edx
+  80326b:	83 e0 01             	and    $0x1,%eax
+  80326e:	89 04 24             	mov    %eax,(%esp)
+  803271:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803278:	00 
+  803279:	8b 04 24             	mov    (%esp),%eax
+  80327c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803280:	09 f0                	or     %esi,%eax
+  803282:	09 fa                	or     %edi,%edx
+  803284:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803288:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80328c:	39 f0                	cmp    %esi,%eax
+  80328e:	89 d5                	mov    %edx,%ebp
+  803290:	19 fd                	sbb    %edi,%ebp
+  803292:	72 af                	jb     803243 <__udivmoddi4+0x4e>
+  803294:	29 f0                	sub    %esi,%eax
+  803296:	19 fa                	sbb    %edi,%edx
+  803298:	89 cf                	mov    %ecx,%edi
+  80329a:	c1 ef 05             	shr    $0x5,%edi
+  80329d:	83 e7 01             	and    $0x1,%edi
+  8032a0:	89 fe                	mov    %edi,%esi
+  8032a2:	83 f6 01             	xor    $0x1,%esi
+  8032a5:	d3 e6                	shl    %cl,%esi
+  8032a7:	d3 e7                	shl    %cl,%edi
+  8032a9:	09 74 24 18          	or     %esi,0x18(%esp)
+  8032ad:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8032b1:	eb 90                	jmp    803243 <__udivmoddi4+0x4e>
+  8032b3:	85 db                	test   %ebx,%ebx
+  8032b5:	74 05                	je     8032bc <__udivmoddi4+0xc7>
+  8032b7:	89 03                	mov    %eax,(%ebx)
+  8032b9:	89 53 04             	mov    %edx,0x4(%ebx)
+  8032bc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8032c0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8032c4:	83 c4 24             	add    $0x24,%esp
+  8032c7:	5b                   	pop    %ebx
+  8032c8:	5e                   	pop    %esi
+  8032c9:	5f                   	pop    %edi
+  8032ca:	5d                   	pop    %ebp
+  8032cb:	c3                   	ret
+
+008032cc <__udivdi3>:
+  8032cc:	83 ec 08             	sub    $0x8,%esp
+  8032cf:	6a 00                	push   $0x0
+  8032d1:	ff 74 24 1c          	push   0x1c(%esp)
+  8032d5:	ff 74 24 1c          	push   0x1c(%esp)
+  8032d9:	ff 74 24 1c          	push   0x1c(%esp)
+  8032dd:	ff 74 24 1c          	push   0x1c(%esp)
+  8032e1:	e8 0f ff ff ff       	call   8031f5 <__udivmoddi4>
+  8032e6:	83 c4 1c             	add    $0x1c,%esp
+  8032e9:	c3                   	ret
+
+008032ea <__umoddi3>:
+  8032ea:	83 ec 18             	sub    $0x18,%esp
+  8032ed:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8032f1:	50                   	push   %eax
+  8032f2:	ff 74 24 2c          	push   0x2c(%esp)
+  8032f6:	ff 74 24 2c          	push   0x2c(%esp)
+  8032fa:	ff 74 24 2c          	push   0x2c(%esp)
+  8032fe:	ff 74 24 2c          	push   0x2c(%esp)
+  803302:	e8 ee fe ff ff       	call   8031f5 <__udivmoddi4>
+  803307:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80330b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80330f:	83 c4 2c             	add    $0x2c,%esp
+  803312:	c3                   	ret
+
+00803313 <__divdi3>:
+  803313:	53                   	push   %ebx
+  803314:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803318:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80331c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803320:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803324:	85 d2                	test   %edx,%edx
+  803326:	78 12                	js     80333a <__divdi3+0x27>
+  803328:	85 db                	test   %ebx,%ebx
+  80332a:	78 2e                	js     80335a <__divdi3+0x47>
+  80332c:	53                   	push   %ebx
+  80332d:	51                   	push   %ecx
+  80332e:	52                   	push   %edx
+  80332f:	50                   	push   %eax
+  803330:	e8 97 ff ff ff       	call   8032cc <__udivdi3>
+  803335:	83 c4 10             	add    $0x10,%esp
+  803338:	eb 1e                	jmp    803358 <__divdi3+0x45>
+  80333a:	f7 d8                	neg    %eax
+  80333c:	83 d2 00             	adc    $0x0,%edx
+  80333f:	f7 da                	neg    %edx
+  803341:	85 db                	test   %ebx,%ebx
+  803343:	78 2a                	js     80336f <__divdi3+0x5c>
+  803345:	53                   	push   %ebx
+  803346:	51                   	push   %ecx
+  803347:	52                   	push   %edx
+  803348:	50                   	push   %eax
+  803349:	e8 7e ff ff ff       	call   8032cc <__udivdi3>
+  80334e:	83 c4 10             	add    $0x10,%esp
+  803351:	f7 d8                	neg    %eax
+  803353:	83 d2 00             	adc    $0x0,%edx
+  803356:	f7 da                	neg    %edx
+  803358:	5b                   	pop    %ebx
+  803359:	c3                   	ret
+  80335a:	f7 d9                	neg    %ecx
+  80335c:	83 d3 00             	adc    $0x0,%ebx
+  80335f:	f7 db                	neg    %ebx
+  803361:	53                   	push   %ebx
+  803362:	51                   	push   %ecx
+  803363:	52                   	push   %edx
+  803364:	50                   	push   %eax
+  803365:	e8 62 ff ff ff       	call   8032cc <__udivdi3>
+  80336a:	83 c4 10             	add    $0x10,%esp
+  80336d:	eb e2                	jmp    803351 <__divdi3+0x3e>
+  80336f:	f7 d9                	neg    %ecx
+  803371:	83 d3 00             	adc    $0x0,%ebx
+  803374:	f7 db                	neg    %ebx
+  803376:	53                   	push   %ebx
+  803377:	51                   	push   %ecx
+  803378:	52                   	push   %edx
+  803379:	50                   	push   %eax
+  80337a:	e8 4d ff ff ff       	call   8032cc <__udivdi3>
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	eb d4                	jmp    803358 <__divdi3+0x45>
+
+00803384 <__moddi3>:
+  803384:	55                   	push   %ebp
+  803385:	57                   	push   %edi
+  803386:	56                   	push   %esi
+  803387:	53                   	push   %ebx
+  803388:	83 ec 0c             	sub    $0xc,%esp
+  80338b:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80338f:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803393:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803397:	89 e9                	mov    %ebp,%ecx
+  803399:	f7 d9                	neg    %ecx
+  80339b:	89 d0                	mov    %edx,%eax
+  80339d:	83 d0 00             	adc    $0x0,%eax
+  8033a0:	f7 d8                	neg    %eax
+  8033a2:	0f 49 e9             	cmovns %ecx,%ebp
+  8033a5:	0f 49 d0             	cmovns %eax,%edx
+  8033a8:	52                   	push   %edx
+  8033a9:	55                   	push   %ebp
+  8033aa:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8033ae:	f7 da                	neg    %edx
+  8033b0:	89 d8                	mov    %ebx,%eax
+  8033b2:	83 d0 00             	adc    $0x0,%eax
+  8033b5:	f7 d8                	neg    %eax
+  8033b7:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8033bc:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8033c0:	0f 48 c3             	cmovs  %ebx,%eax
+  8033c3:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8033c7:	ff 74 24 0c          	push   0xc(%esp)
+  8033cb:	ff 74 24 0c          	push   0xc(%esp)
+  8033cf:	e8 16 ff ff ff       	call   8032ea <__umoddi3>
+  8033d4:	83 c4 10             	add    $0x10,%esp
+  8033d7:	85 db                	test   %ebx,%ebx
+  8033d9:	78 08                	js     8033e3 <__moddi3+0x5f>
+  8033db:	83 c4 0c             	add    $0xc,%esp
+  8033de:	5b                   	pop    %ebx
+  8033df:	5e                   	pop    %esi
+  8033e0:	5f                   	pop    %edi
+  8033e1:	5d                   	pop    %ebp
+  8033e2:	c3                   	ret
+  8033e3:	f7 d8                	neg    %eax
+  8033e5:	83 d2 00             	adc    $0x0,%edx
+  8033e8:	f7 da                	neg    %edx
+  8033ea:	eb ef                	jmp    8033db <__moddi3+0x57>
@@ -0,0 +1,5394 @@
+
+obj/user/ps.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 12 04 00 00       	call   800443 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec fc 00 00 00    	sub    $0xfc,%esp
+  80003f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800042:	c7 05 00 40 80 00 82 	movl   $0x803682,0x804000
+  800049:	36 80 00 
+  80004c:	83 f8 02             	cmp    $0x2,%eax
+  80004f:	7f 1c                	jg     80006d <umain+0x3a>
+  800051:	74 32                	je     800085 <umain+0x52>
+  800053:	be 20 60 80 00       	mov    $0x806020,%esi
+  800058:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800062:	89 b5 10 ff ff ff    	mov    %esi,-0xf0(%ebp)
+  800068:	e9 ce 01 00 00       	jmp    80023b <umain+0x208>
+  80006d:	83 ec 0c             	sub    $0xc,%esp
+  800070:	68 85 36 80 00       	push   $0x803685
+  800075:	e8 63 1e 00 00       	call   801edd <printf>
+  80007a:	83 c4 10             	add    $0x10,%esp
+  80007d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800080:	5b                   	pop    %ebx
+  800081:	5e                   	pop    %esi
+  800082:	5f                   	pop    %edi
+  800083:	5d                   	pop    %ebp
+  800084:	c3                   	ret
+  800085:	83 ec 04             	sub    $0x4,%esp
+  800088:	6a 10                	push   $0x10
+  80008a:	6a 00                	push   $0x0
+  80008c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80008f:	ff 70 04             	push   0x4(%eax)
+  800092:	e8 04 07 00 00       	call   80079b <strtol>
+  800097:	89 c3                	mov    %eax,%ebx
+  800099:	83 c4 08             	add    $0x8,%esp
+  80009c:	8d 85 18 ff ff ff    	lea    -0xe8(%ebp),%eax
+  8000a2:	50                   	push   %eax
+  8000a3:	53                   	push   %ebx
+  8000a4:	e8 67 10 00 00       	call   801110 <sys_env_stats>
+  8000a9:	83 c4 10             	add    $0x10,%esp
+  8000ac:	85 c0                	test   %eax,%eax
+  8000ae:	0f 88 f9 00 00 00    	js     8001ad <umain+0x17a>
+  8000b4:	89 d8                	mov    %ebx,%eax
+  8000b6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000bb:	69 d0 ac 01 00 00    	imul   $0x1ac,%eax,%edx
+  8000c1:	8b 8a 58 00 c0 ee    	mov    -0x113fffa8(%edx),%ecx
+  8000c7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000cd:	8b 52 54             	mov    0x54(%edx),%edx
+  8000d0:	bb 80 36 80 00       	mov    $0x803680,%ebx
+  8000d5:	83 fa 06             	cmp    $0x6,%edx
+  8000d8:	0f 86 e6 00 00 00    	jbe    8001c4 <umain+0x191>
+  8000de:	69 d0 ac 01 00 00    	imul   $0x1ac,%eax,%edx
+  8000e4:	8b b2 50 00 c0 ee    	mov    -0x113fffb0(%edx),%esi
+  8000ea:	ba 80 36 80 00       	mov    $0x803680,%edx
+  8000ef:	83 fe 05             	cmp    $0x5,%esi
+  8000f2:	0f 86 d8 00 00 00    	jbe    8001d0 <umain+0x19d>
+  8000f8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000fe:	8b b0 4c 00 c0 ee    	mov    -0x113fffb4(%eax),%esi
+  800104:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800109:	8b 40 48             	mov    0x48(%eax),%eax
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	51                   	push   %ecx
+  800110:	53                   	push   %ebx
+  800111:	52                   	push   %edx
+  800112:	56                   	push   %esi
+  800113:	50                   	push   %eax
+  800114:	68 3c 37 80 00       	push   $0x80373c
+  800119:	e8 bf 1d 00 00       	call   801edd <printf>
+  80011e:	83 c4 1c             	add    $0x1c,%esp
+  800121:	ff b5 24 ff ff ff    	push   -0xdc(%ebp)
+  800127:	ff b5 20 ff ff ff    	push   -0xe0(%ebp)
+  80012d:	68 a6 36 80 00       	push   $0x8036a6
+  800132:	e8 a6 1d 00 00       	call   801edd <printf>
+  800137:	83 c4 0c             	add    $0xc,%esp
+  80013a:	ff 75 d0             	push   -0x30(%ebp)
+  80013d:	ff 75 cc             	push   -0x34(%ebp)
+  800140:	68 64 37 80 00       	push   $0x803764
+  800145:	e8 93 1d 00 00       	call   801edd <printf>
+  80014a:	83 c4 0c             	add    $0xc,%esp
+  80014d:	ff 75 d8             	push   -0x28(%ebp)
+  800150:	ff 75 d4             	push   -0x2c(%ebp)
+  800153:	68 be 36 80 00       	push   $0x8036be
+  800158:	e8 80 1d 00 00       	call   801edd <printf>
+  80015d:	83 c4 0c             	add    $0xc,%esp
+  800160:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800163:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800166:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  80016a:	c1 ea 0a             	shr    $0xa,%edx
+  80016d:	50                   	push   %eax
+  80016e:	ff 75 dc             	push   -0x24(%ebp)
+  800171:	68 90 37 80 00       	push   $0x803790
+  800176:	e8 62 1d 00 00       	call   801edd <printf>
+  80017b:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+  800181:	8d 5d cc             	lea    -0x34(%ebp),%ebx
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80018c:	03 08                	add    (%eax),%ecx
+  80018e:	83 c0 04             	add    $0x4,%eax
+  800191:	39 c3                	cmp    %eax,%ebx
+  800193:	75 f7                	jne    80018c <umain+0x159>
+  800195:	83 ec 08             	sub    $0x8,%esp
+  800198:	51                   	push   %ecx
+  800199:	68 da 36 80 00       	push   $0x8036da
+  80019e:	e8 3a 1d 00 00       	call   801edd <printf>
+  8001a3:	83 c4 10             	add    $0x10,%esp
+  8001a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ab:	eb 3b                	jmp    8001e8 <umain+0x1b5>
+  8001ad:	83 ec 04             	sub    $0x4,%esp
+  8001b0:	50                   	push   %eax
+  8001b1:	53                   	push   %ebx
+  8001b2:	68 98 36 80 00       	push   $0x803698
+  8001b7:	e8 21 1d 00 00       	call   801edd <printf>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	e9 b9 fe ff ff       	jmp    80007d <umain+0x4a>
+  8001c4:	8b 1c 95 50 38 80 00 	mov    0x803850(,%edx,4),%ebx
+  8001cb:	e9 0e ff ff ff       	jmp    8000de <umain+0xab>
+  8001d0:	8b 14 b5 38 38 80 00 	mov    0x803838(,%esi,4),%edx
+  8001d7:	e9 1c ff ff ff       	jmp    8000f8 <umain+0xc5>
+  8001dc:	83 c3 01             	add    $0x1,%ebx
+  8001df:	83 fb 29             	cmp    $0x29,%ebx
+  8001e2:	0f 84 95 fe ff ff    	je     80007d <umain+0x4a>
+  8001e8:	8b 84 9d 28 ff ff ff 	mov    -0xd8(%ebp,%ebx,4),%eax
+  8001ef:	85 c0                	test   %eax,%eax
+  8001f1:	74 e9                	je     8001dc <umain+0x1a9>
+  8001f3:	83 ec 04             	sub    $0x4,%esp
+  8001f6:	50                   	push   %eax
+  8001f7:	53                   	push   %ebx
+  8001f8:	68 ee 36 80 00       	push   $0x8036ee
+  8001fd:	e8 db 1c 00 00       	call   801edd <printf>
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	eb d5                	jmp    8001dc <umain+0x1a9>
+  800207:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+  80020d:	8b 9d 08 ff ff ff    	mov    -0xf8(%ebp),%ebx
+  800213:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+  800219:	89 1c 85 20 50 80 00 	mov    %ebx,0x805020(,%eax,4)
+  800220:	89 d7                	mov    %edx,%edi
+  800222:	83 c3 01             	add    $0x1,%ebx
+  800225:	81 85 10 ff ff ff d0 	addl   $0xd0,-0xf0(%ebp)
+  80022c:	00 00 00 
+  80022f:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  800235:	0f 84 aa 00 00 00    	je     8002e5 <umain+0x2b2>
+  80023b:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  800241:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800246:	8b 40 54             	mov    0x54(%eax),%eax
+  800249:	85 c0                	test   %eax,%eax
+  80024b:	74 d5                	je     800222 <umain+0x1ef>
+  80024d:	8b 8d 10 ff ff ff    	mov    -0xf0(%ebp),%ecx
+  800253:	89 ce                	mov    %ecx,%esi
+  800255:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  80025b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800260:	8b 40 48             	mov    0x48(%eax),%eax
+  800263:	83 ec 08             	sub    $0x8,%esp
+  800266:	51                   	push   %ecx
+  800267:	50                   	push   %eax
+  800268:	e8 a3 0e 00 00       	call   801110 <sys_env_stats>
+  80026d:	83 c4 10             	add    $0x10,%esp
+  800270:	85 c0                	test   %eax,%eax
+  800272:	78 ae                	js     800222 <umain+0x1ef>
+  800274:	8d 57 01             	lea    0x1(%edi),%edx
+  800277:	85 ff                	test   %edi,%edi
+  800279:	7e 5f                	jle    8002da <umain+0x2a7>
+  80027b:	8b 06                	mov    (%esi),%eax
+  80027d:	8b 76 04             	mov    0x4(%esi),%esi
+  800280:	89 95 0c ff ff ff    	mov    %edx,-0xf4(%ebp)
+  800286:	89 9d 08 ff ff ff    	mov    %ebx,-0xf8(%ebp)
+  80028c:	89 c3                	mov    %eax,%ebx
+  80028e:	89 bd 14 ff ff ff    	mov    %edi,-0xec(%ebp)
+  800294:	83 ef 01             	sub    $0x1,%edi
+  800297:	8b 0c bd 20 50 80 00 	mov    0x805020(,%edi,4),%ecx
+  80029e:	69 d1 d0 00 00 00    	imul   $0xd0,%ecx,%edx
+  8002a4:	8b 82 24 60 80 00    	mov    0x806024(%edx),%eax
+  8002aa:	39 9a 20 60 80 00    	cmp    %ebx,0x806020(%edx)
+  8002b0:	19 f0                	sbb    %esi,%eax
+  8002b2:	0f 83 4f ff ff ff    	jae    800207 <umain+0x1d4>
+  8002b8:	89 0c bd 24 50 80 00 	mov    %ecx,0x805024(,%edi,4)
+  8002bf:	85 ff                	test   %edi,%edi
+  8002c1:	75 cb                	jne    80028e <umain+0x25b>
+  8002c3:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+  8002c9:	8b 9d 08 ff ff ff    	mov    -0xf8(%ebp),%ebx
+  8002cf:	89 bd 14 ff ff ff    	mov    %edi,-0xec(%ebp)
+  8002d5:	e9 39 ff ff ff       	jmp    800213 <umain+0x1e0>
+  8002da:	89 bd 14 ff ff ff    	mov    %edi,-0xec(%ebp)
+  8002e0:	e9 2e ff ff ff       	jmp    800213 <umain+0x1e0>
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 b4 37 80 00       	push   $0x8037b4
+  8002ed:	e8 eb 1b 00 00       	call   801edd <printf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	85 ff                	test   %edi,%edi
+  8002f7:	0f 8e 80 fd ff ff    	jle    80007d <umain+0x4a>
+  8002fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800302:	c7 85 00 ff ff ff d4 	movl   $0x8060d4,-0x100(%ebp)
+  800309:	60 80 00 
+  80030c:	89 bd fc fe ff ff    	mov    %edi,-0x104(%ebp)
+  800312:	89 c7                	mov    %eax,%edi
+  800314:	eb 69                	jmp    80037f <umain+0x34c>
+  800316:	8b 1c 95 50 38 80 00 	mov    0x803850(,%edx,4),%ebx
+  80031d:	89 9d 14 ff ff ff    	mov    %ebx,-0xec(%ebp)
+  800323:	e9 f5 00 00 00       	jmp    80041d <umain+0x3ea>
+  800328:	69 f6 ac 01 00 00    	imul   $0x1ac,%esi,%esi
+  80032e:	8b 9e 4c 00 c0 ee    	mov    -0x113fffb4(%esi),%ebx
+  800334:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80033a:	8b 76 48             	mov    0x48(%esi),%esi
+  80033d:	83 ec 04             	sub    $0x4,%esp
+  800340:	ff b5 10 ff ff ff    	push   -0xf0(%ebp)
+  800346:	ff b5 0c ff ff ff    	push   -0xf4(%ebp)
+  80034c:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+  800352:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+  800358:	50                   	push   %eax
+  800359:	51                   	push   %ecx
+  80035a:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+  800360:	52                   	push   %edx
+  800361:	53                   	push   %ebx
+  800362:	56                   	push   %esi
+  800363:	68 08 38 80 00       	push   $0x803808
+  800368:	e8 70 1b 00 00       	call   801edd <printf>
+  80036d:	83 c7 01             	add    $0x1,%edi
+  800370:	83 c4 30             	add    $0x30,%esp
+  800373:	39 bd fc fe ff ff    	cmp    %edi,-0x104(%ebp)
+  800379:	0f 84 fe fc ff ff    	je     80007d <umain+0x4a>
+  80037f:	8b 34 bd 20 50 80 00 	mov    0x805020(,%edi,4),%esi
+  800386:	69 ce d0 00 00 00    	imul   $0xd0,%esi,%ecx
+  80038c:	8b 81 e8 60 80 00    	mov    0x8060e8(%ecx),%eax
+  800392:	8b 91 ec 60 80 00    	mov    0x8060ec(%ecx),%edx
+  800398:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  80039c:	c1 ea 0a             	shr    $0xa,%edx
+  80039f:	89 85 10 ff ff ff    	mov    %eax,-0xf0(%ebp)
+  8003a5:	8b 81 e4 60 80 00    	mov    0x8060e4(%ecx),%eax
+  8003ab:	89 85 0c ff ff ff    	mov    %eax,-0xf4(%ebp)
+  8003b1:	8b 81 e0 60 80 00    	mov    0x8060e0(%ecx),%eax
+  8003b7:	03 81 dc 60 80 00    	add    0x8060dc(%ecx),%eax
+  8003bd:	89 85 08 ff ff ff    	mov    %eax,-0xf8(%ebp)
+  8003c3:	8b 81 d4 60 80 00    	mov    0x8060d4(%ecx),%eax
+  8003c9:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+  8003cf:	8d 91 30 60 80 00    	lea    0x806030(%ecx),%edx
+  8003d5:	8b 85 00 ff ff ff    	mov    -0x100(%ebp),%eax
+  8003db:	01 c1                	add    %eax,%ecx
+  8003dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e2:	89 d8                	mov    %ebx,%eax
+  8003e4:	03 02                	add    (%edx),%eax
+  8003e6:	89 c3                	mov    %eax,%ebx
+  8003e8:	83 c2 04             	add    $0x4,%edx
+  8003eb:	39 ca                	cmp    %ecx,%edx
+  8003ed:	75 f3                	jne    8003e2 <umain+0x3af>
+  8003ef:	69 d6 d0 00 00 00    	imul   $0xd0,%esi,%edx
+  8003f5:	8b 8a 28 60 80 00    	mov    0x806028(%edx),%ecx
+  8003fb:	69 d6 ac 01 00 00    	imul   $0x1ac,%esi,%edx
+  800401:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800407:	8b 52 54             	mov    0x54(%edx),%edx
+  80040a:	c7 85 14 ff ff ff 80 	movl   $0x803680,-0xec(%ebp)
+  800411:	36 80 00 
+  800414:	83 fa 06             	cmp    $0x6,%edx
+  800417:	0f 86 f9 fe ff ff    	jbe    800316 <umain+0x2e3>
+  80041d:	69 d6 ac 01 00 00    	imul   $0x1ac,%esi,%edx
+  800423:	8b 9a 50 00 c0 ee    	mov    -0x113fffb0(%edx),%ebx
+  800429:	ba 80 36 80 00       	mov    $0x803680,%edx
+  80042e:	83 fb 05             	cmp    $0x5,%ebx
+  800431:	0f 87 f1 fe ff ff    	ja     800328 <umain+0x2f5>
+  800437:	8b 14 9d 38 38 80 00 	mov    0x803838(,%ebx,4),%edx
+  80043e:	e9 e5 fe ff ff       	jmp    800328 <umain+0x2f5>
+
+00800443 <libmain>:
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	56                   	push   %esi
+  800447:	53                   	push   %ebx
+  800448:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80044b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80044e:	e8 ab 04 00 00       	call   8008fe <sys_getenvid>
+  800453:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800458:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80045e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800463:	a3 20 a0 83 00       	mov    %eax,0x83a020
+  800468:	85 db                	test   %ebx,%ebx
+  80046a:	7e 07                	jle    800473 <libmain+0x30>
+  80046c:	8b 06                	mov    (%esi),%eax
+  80046e:	a3 00 40 80 00       	mov    %eax,0x804000
+  800473:	83 ec 08             	sub    $0x8,%esp
+  800476:	56                   	push   %esi
+  800477:	53                   	push   %ebx
+  800478:	e8 b6 fb ff ff       	call   800033 <umain>
+  80047d:	e8 0a 00 00 00       	call   80048c <exit>
+  800482:	83 c4 10             	add    $0x10,%esp
+  800485:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800488:	5b                   	pop    %ebx
+  800489:	5e                   	pop    %esi
+  80048a:	5d                   	pop    %ebp
+  80048b:	c3                   	ret
+
+0080048c <exit>:
+  80048c:	55                   	push   %ebp
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	83 ec 08             	sub    $0x8,%esp
+  800492:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  800497:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80049d:	85 c0                	test   %eax,%eax
+  80049f:	75 14                	jne    8004b5 <exit+0x29>
+  8004a1:	e8 fa 0e 00 00       	call   8013a0 <close_all>
+  8004a6:	83 ec 0c             	sub    $0xc,%esp
+  8004a9:	6a 00                	push   $0x0
+  8004ab:	e8 0d 04 00 00       	call   8008bd <sys_env_destroy>
+  8004b0:	83 c4 10             	add    $0x10,%esp
+  8004b3:	c9                   	leave
+  8004b4:	c3                   	ret
+  8004b5:	e8 70 0b 00 00       	call   80102a <sys_lease_complete>
+  8004ba:	eb e5                	jmp    8004a1 <exit+0x15>
+
+008004bc <strlen>:
+  8004bc:	55                   	push   %ebp
+  8004bd:	89 e5                	mov    %esp,%ebp
+  8004bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c2:	80 3a 00             	cmpb   $0x0,(%edx)
+  8004c5:	74 10                	je     8004d7 <strlen+0x1b>
+  8004c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cc:	83 c0 01             	add    $0x1,%eax
+  8004cf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8004d3:	75 f7                	jne    8004cc <strlen+0x10>
+  8004d5:	5d                   	pop    %ebp
+  8004d6:	c3                   	ret
+  8004d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dc:	eb f7                	jmp    8004d5 <strlen+0x19>
+
+008004de <strnlen>:
+  8004de:	55                   	push   %ebp
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004e7:	85 d2                	test   %edx,%edx
+  8004e9:	74 16                	je     800501 <strnlen+0x23>
+  8004eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8004f4:	74 09                	je     8004ff <strnlen+0x21>
+  8004f6:	83 c0 01             	add    $0x1,%eax
+  8004f9:	39 d0                	cmp    %edx,%eax
+  8004fb:	75 f3                	jne    8004f0 <strnlen+0x12>
+  8004fd:	89 d0                	mov    %edx,%eax
+  8004ff:	5d                   	pop    %ebp
+  800500:	c3                   	ret
+  800501:	b8 00 00 00 00       	mov    $0x0,%eax
+  800506:	eb f7                	jmp    8004ff <strnlen+0x21>
+
+00800508 <strcpy>:
+  800508:	55                   	push   %ebp
+  800509:	89 e5                	mov    %esp,%ebp
+  80050b:	53                   	push   %ebx
+  80050c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80050f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800512:	b8 00 00 00 00       	mov    $0x0,%eax
+  800517:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80051b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80051e:	83 c0 01             	add    $0x1,%eax
+  800521:	84 d2                	test   %dl,%dl
+  800523:	75 f2                	jne    800517 <strcpy+0xf>
+  800525:	89 c8                	mov    %ecx,%eax
+  800527:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80052a:	c9                   	leave
+  80052b:	c3                   	ret
+
+0080052c <strcat>:
+  80052c:	55                   	push   %ebp
+  80052d:	89 e5                	mov    %esp,%ebp
+  80052f:	53                   	push   %ebx
+  800530:	83 ec 10             	sub    $0x10,%esp
+  800533:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800536:	53                   	push   %ebx
+  800537:	e8 80 ff ff ff       	call   8004bc <strlen>
+  80053c:	83 c4 08             	add    $0x8,%esp
+  80053f:	ff 75 0c             	push   0xc(%ebp)
+  800542:	01 d8                	add    %ebx,%eax
+  800544:	50                   	push   %eax
+  800545:	e8 be ff ff ff       	call   800508 <strcpy>
+  80054a:	89 d8                	mov    %ebx,%eax
+  80054c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80054f:	c9                   	leave
+  800550:	c3                   	ret
+
+00800551 <strncpy>:
+  800551:	55                   	push   %ebp
+  800552:	89 e5                	mov    %esp,%ebp
+  800554:	56                   	push   %esi
+  800555:	53                   	push   %ebx
+  800556:	8b 75 08             	mov    0x8(%ebp),%esi
+  800559:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80055c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80055f:	85 db                	test   %ebx,%ebx
+  800561:	74 17                	je     80057a <strncpy+0x29>
+  800563:	01 f3                	add    %esi,%ebx
+  800565:	89 f0                	mov    %esi,%eax
+  800567:	83 c0 01             	add    $0x1,%eax
+  80056a:	0f b6 0a             	movzbl (%edx),%ecx
+  80056d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800570:	80 f9 01             	cmp    $0x1,%cl
+  800573:	83 da ff             	sbb    $0xffffffff,%edx
+  800576:	39 c3                	cmp    %eax,%ebx
+  800578:	75 ed                	jne    800567 <strncpy+0x16>
+  80057a:	89 f0                	mov    %esi,%eax
+  80057c:	5b                   	pop    %ebx
+  80057d:	5e                   	pop    %esi
+  80057e:	5d                   	pop    %ebp
+  80057f:	c3                   	ret
+
+00800580 <strlcpy>:
+  800580:	55                   	push   %ebp
+  800581:	89 e5                	mov    %esp,%ebp
+  800583:	56                   	push   %esi
+  800584:	53                   	push   %ebx
+  800585:	8b 75 08             	mov    0x8(%ebp),%esi
+  800588:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80058b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80058e:	89 f0                	mov    %esi,%eax
+  800590:	85 db                	test   %ebx,%ebx
+  800592:	74 1e                	je     8005b2 <strlcpy+0x32>
+  800594:	83 eb 01             	sub    $0x1,%ebx
+  800597:	74 16                	je     8005af <strlcpy+0x2f>
+  800599:	01 f3                	add    %esi,%ebx
+  80059b:	0f b6 0a             	movzbl (%edx),%ecx
+  80059e:	84 c9                	test   %cl,%cl
+  8005a0:	74 0d                	je     8005af <strlcpy+0x2f>
+  8005a2:	83 c2 01             	add    $0x1,%edx
+  8005a5:	83 c0 01             	add    $0x1,%eax
+  8005a8:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8005ab:	39 d8                	cmp    %ebx,%eax
+  8005ad:	75 ec                	jne    80059b <strlcpy+0x1b>
+  8005af:	c6 00 00             	movb   $0x0,(%eax)
+  8005b2:	29 f0                	sub    %esi,%eax
+  8005b4:	5b                   	pop    %ebx
+  8005b5:	5e                   	pop    %esi
+  8005b6:	5d                   	pop    %ebp
+  8005b7:	c3                   	ret
+
+008005b8 <strcmp>:
+  8005b8:	55                   	push   %ebp
+  8005b9:	89 e5                	mov    %esp,%ebp
+  8005bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005c1:	0f b6 01             	movzbl (%ecx),%eax
+  8005c4:	84 c0                	test   %al,%al
+  8005c6:	74 11                	je     8005d9 <strcmp+0x21>
+  8005c8:	38 02                	cmp    %al,(%edx)
+  8005ca:	75 0d                	jne    8005d9 <strcmp+0x21>
+  8005cc:	83 c1 01             	add    $0x1,%ecx
+  8005cf:	83 c2 01             	add    $0x1,%edx
+  8005d2:	0f b6 01             	movzbl (%ecx),%eax
+  8005d5:	84 c0                	test   %al,%al
+  8005d7:	75 ef                	jne    8005c8 <strcmp+0x10>
+  8005d9:	0f b6 c0             	movzbl %al,%eax
+  8005dc:	0f b6 12             	movzbl (%edx),%edx
+  8005df:	29 d0                	sub    %edx,%eax
+  8005e1:	5d                   	pop    %ebp
+  8005e2:	c3                   	ret
+
+008005e3 <strncmp>:
+  8005e3:	55                   	push   %ebp
+  8005e4:	89 e5                	mov    %esp,%ebp
+  8005e6:	53                   	push   %ebx
+  8005e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005ed:	8b 55 10             	mov    0x10(%ebp),%edx
+  8005f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f5:	85 d2                	test   %edx,%edx
+  8005f7:	74 2e                	je     800627 <strncmp+0x44>
+  8005f9:	0f b6 01             	movzbl (%ecx),%eax
+  8005fc:	84 c0                	test   %al,%al
+  8005fe:	74 16                	je     800616 <strncmp+0x33>
+  800600:	3a 03                	cmp    (%ebx),%al
+  800602:	75 12                	jne    800616 <strncmp+0x33>
+  800604:	83 c1 01             	add    $0x1,%ecx
+  800607:	83 c3 01             	add    $0x1,%ebx
+  80060a:	83 ea 01             	sub    $0x1,%edx
+  80060d:	75 ea                	jne    8005f9 <strncmp+0x16>
+  80060f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800614:	eb 11                	jmp    800627 <strncmp+0x44>
+  800616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061b:	85 d2                	test   %edx,%edx
+  80061d:	74 08                	je     800627 <strncmp+0x44>
+  80061f:	0f b6 01             	movzbl (%ecx),%eax
+  800622:	0f b6 13             	movzbl (%ebx),%edx
+  800625:	29 d0                	sub    %edx,%eax
+  800627:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80062a:	c9                   	leave
+  80062b:	c3                   	ret
+
+0080062c <strchr>:
+  80062c:	55                   	push   %ebp
+  80062d:	89 e5                	mov    %esp,%ebp
+  80062f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800632:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800636:	0f b6 10             	movzbl (%eax),%edx
+  800639:	84 d2                	test   %dl,%dl
+  80063b:	74 15                	je     800652 <strchr+0x26>
+  80063d:	38 d1                	cmp    %dl,%cl
+  80063f:	74 0f                	je     800650 <strchr+0x24>
+  800641:	83 c0 01             	add    $0x1,%eax
+  800644:	0f b6 10             	movzbl (%eax),%edx
+  800647:	84 d2                	test   %dl,%dl
+  800649:	75 f2                	jne    80063d <strchr+0x11>
+  80064b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800650:	5d                   	pop    %ebp
+  800651:	c3                   	ret
+  800652:	b8 00 00 00 00       	mov    $0x0,%eax
+  800657:	eb f7                	jmp    800650 <strchr+0x24>
+
+00800659 <strfind>:
+  800659:	55                   	push   %ebp
+  80065a:	89 e5                	mov    %esp,%ebp
+  80065c:	53                   	push   %ebx
+  80065d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800660:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800663:	0f b6 18             	movzbl (%eax),%ebx
+  800666:	38 d3                	cmp    %dl,%bl
+  800668:	74 14                	je     80067e <strfind+0x25>
+  80066a:	89 d1                	mov    %edx,%ecx
+  80066c:	84 db                	test   %bl,%bl
+  80066e:	74 0e                	je     80067e <strfind+0x25>
+  800670:	83 c0 01             	add    $0x1,%eax
+  800673:	0f b6 10             	movzbl (%eax),%edx
+  800676:	38 ca                	cmp    %cl,%dl
+  800678:	74 04                	je     80067e <strfind+0x25>
+  80067a:	84 d2                	test   %dl,%dl
+  80067c:	75 f2                	jne    800670 <strfind+0x17>
+  80067e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800681:	c9                   	leave
+  800682:	c3                   	ret
+
+00800683 <memset>:
+  800683:	55                   	push   %ebp
+  800684:	89 e5                	mov    %esp,%ebp
+  800686:	57                   	push   %edi
+  800687:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80068a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80068d:	85 c9                	test   %ecx,%ecx
+  80068f:	74 20                	je     8006b1 <memset+0x2e>
+  800691:	89 f8                	mov    %edi,%eax
+  800693:	09 c8                	or     %ecx,%eax
+  800695:	a8 03                	test   $0x3,%al
+  800697:	75 12                	jne    8006ab <memset+0x28>
+  800699:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80069d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  8006a3:	c1 e9 02             	shr    $0x2,%ecx
+  8006a6:	fc                   	cld
+  8006a7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8006a9:	eb 06                	jmp    8006b1 <memset+0x2e>
+  8006ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8006ae:	fc                   	cld
+  8006af:	f3 aa                	rep stos %al,%es:(%edi)
+  8006b1:	89 f8                	mov    %edi,%eax
+  8006b3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8006b6:	c9                   	leave
+  8006b7:	c3                   	ret
+
+008006b8 <memmove>:
+  8006b8:	55                   	push   %ebp
+  8006b9:	89 e5                	mov    %esp,%ebp
+  8006bb:	57                   	push   %edi
+  8006bc:	56                   	push   %esi
+  8006bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006c0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8006c3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8006c6:	39 c6                	cmp    %eax,%esi
+  8006c8:	73 32                	jae    8006fc <memmove+0x44>
+  8006ca:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8006cd:	39 d0                	cmp    %edx,%eax
+  8006cf:	73 2b                	jae    8006fc <memmove+0x44>
+  8006d1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  8006d4:	89 d6                	mov    %edx,%esi
+  8006d6:	09 fe                	or     %edi,%esi
+  8006d8:	09 ce                	or     %ecx,%esi
+  8006da:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8006e0:	75 0e                	jne    8006f0 <memmove+0x38>
+  8006e2:	83 ef 04             	sub    $0x4,%edi
+  8006e5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8006e8:	c1 e9 02             	shr    $0x2,%ecx
+  8006eb:	fd                   	std
+  8006ec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8006ee:	eb 09                	jmp    8006f9 <memmove+0x41>
+  8006f0:	83 ef 01             	sub    $0x1,%edi
+  8006f3:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8006f6:	fd                   	std
+  8006f7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8006f9:	fc                   	cld
+  8006fa:	eb 1a                	jmp    800716 <memmove+0x5e>
+  8006fc:	89 f2                	mov    %esi,%edx
+  8006fe:	09 c2                	or     %eax,%edx
+  800700:	09 ca                	or     %ecx,%edx
+  800702:	f6 c2 03             	test   $0x3,%dl
+  800705:	75 0a                	jne    800711 <memmove+0x59>
+  800707:	c1 e9 02             	shr    $0x2,%ecx
+  80070a:	89 c7                	mov    %eax,%edi
+  80070c:	fc                   	cld
+  80070d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80070f:	eb 05                	jmp    800716 <memmove+0x5e>
+  800711:	89 c7                	mov    %eax,%edi
+  800713:	fc                   	cld
+  800714:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800716:	5e                   	pop    %esi
+  800717:	5f                   	pop    %edi
+  800718:	5d                   	pop    %ebp
+  800719:	c3                   	ret
+
+0080071a <memcpy>:
+  80071a:	55                   	push   %ebp
+  80071b:	89 e5                	mov    %esp,%ebp
+  80071d:	83 ec 0c             	sub    $0xc,%esp
+  800720:	ff 75 10             	push   0x10(%ebp)
+  800723:	ff 75 0c             	push   0xc(%ebp)
+  800726:	ff 75 08             	push   0x8(%ebp)
+  800729:	e8 8a ff ff ff       	call   8006b8 <memmove>
+  80072e:	c9                   	leave
+  80072f:	c3                   	ret
+
+00800730 <memcmp>:
+  800730:	55                   	push   %ebp
+  800731:	89 e5                	mov    %esp,%ebp
+  800733:	56                   	push   %esi
+  800734:	53                   	push   %ebx
+  800735:	8b 45 08             	mov    0x8(%ebp),%eax
+  800738:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80073b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80073e:	85 f6                	test   %esi,%esi
+  800740:	74 29                	je     80076b <memcmp+0x3b>
+  800742:	01 c6                	add    %eax,%esi
+  800744:	0f b6 08             	movzbl (%eax),%ecx
+  800747:	0f b6 1a             	movzbl (%edx),%ebx
+  80074a:	38 d9                	cmp    %bl,%cl
+  80074c:	75 11                	jne    80075f <memcmp+0x2f>
+  80074e:	83 c0 01             	add    $0x1,%eax
+  800751:	83 c2 01             	add    $0x1,%edx
+  800754:	39 c6                	cmp    %eax,%esi
+  800756:	75 ec                	jne    800744 <memcmp+0x14>
+  800758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075d:	eb 08                	jmp    800767 <memcmp+0x37>
+  80075f:	0f b6 c1             	movzbl %cl,%eax
+  800762:	0f b6 db             	movzbl %bl,%ebx
+  800765:	29 d8                	sub    %ebx,%eax
+  800767:	5b                   	pop    %ebx
+  800768:	5e                   	pop    %esi
+  800769:	5d                   	pop    %ebp
+  80076a:	c3                   	ret
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	eb f5                	jmp    800767 <memcmp+0x37>
+
+00800772 <memfind>:
+  800772:	55                   	push   %ebp
+  800773:	89 e5                	mov    %esp,%ebp
+  800775:	8b 45 08             	mov    0x8(%ebp),%eax
+  800778:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80077b:	89 c2                	mov    %eax,%edx
+  80077d:	03 55 10             	add    0x10(%ebp),%edx
+  800780:	39 d0                	cmp    %edx,%eax
+  800782:	73 0d                	jae    800791 <memfind+0x1f>
+  800784:	38 08                	cmp    %cl,(%eax)
+  800786:	74 0d                	je     800795 <memfind+0x23>
+  800788:	83 c0 01             	add    $0x1,%eax
+  80078b:	39 c2                	cmp    %eax,%edx
+  80078d:	75 f5                	jne    800784 <memfind+0x12>
+  80078f:	eb 06                	jmp    800797 <memfind+0x25>
+  800791:	89 c2                	mov    %eax,%edx
+  800793:	eb 02                	jmp    800797 <memfind+0x25>
+  800795:	89 c2                	mov    %eax,%edx
+  800797:	89 d0                	mov    %edx,%eax
+  800799:	5d                   	pop    %ebp
+  80079a:	c3                   	ret
+
+0080079b <strtol>:
+  80079b:	55                   	push   %ebp
+  80079c:	89 e5                	mov    %esp,%ebp
+  80079e:	57                   	push   %edi
+  80079f:	56                   	push   %esi
+  8007a0:	53                   	push   %ebx
+  8007a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007a7:	0f b6 02             	movzbl (%edx),%eax
+  8007aa:	3c 20                	cmp    $0x20,%al
+  8007ac:	74 04                	je     8007b2 <strtol+0x17>
+  8007ae:	3c 09                	cmp    $0x9,%al
+  8007b0:	75 0e                	jne    8007c0 <strtol+0x25>
+  8007b2:	83 c2 01             	add    $0x1,%edx
+  8007b5:	0f b6 02             	movzbl (%edx),%eax
+  8007b8:	3c 20                	cmp    $0x20,%al
+  8007ba:	74 f6                	je     8007b2 <strtol+0x17>
+  8007bc:	3c 09                	cmp    $0x9,%al
+  8007be:	74 f2                	je     8007b2 <strtol+0x17>
+  8007c0:	3c 2b                	cmp    $0x2b,%al
+  8007c2:	74 2a                	je     8007ee <strtol+0x53>
+  8007c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007c9:	3c 2d                	cmp    $0x2d,%al
+  8007cb:	74 2b                	je     8007f8 <strtol+0x5d>
+  8007cd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8007d3:	75 0f                	jne    8007e4 <strtol+0x49>
+  8007d5:	80 3a 30             	cmpb   $0x30,(%edx)
+  8007d8:	74 28                	je     800802 <strtol+0x67>
+  8007da:	85 db                	test   %ebx,%ebx
+  8007dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8007e1:	0f 44 d8             	cmove  %eax,%ebx
+  8007e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8007ec:	eb 46                	jmp    800834 <strtol+0x99>
+  8007ee:	83 c2 01             	add    $0x1,%edx
+  8007f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007f6:	eb d5                	jmp    8007cd <strtol+0x32>
+  8007f8:	83 c2 01             	add    $0x1,%edx
+  8007fb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800800:	eb cb                	jmp    8007cd <strtol+0x32>
+  800802:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800806:	74 0e                	je     800816 <strtol+0x7b>
+  800808:	85 db                	test   %ebx,%ebx
+  80080a:	75 d8                	jne    8007e4 <strtol+0x49>
+  80080c:	83 c2 01             	add    $0x1,%edx
+  80080f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800814:	eb ce                	jmp    8007e4 <strtol+0x49>
+  800816:	83 c2 02             	add    $0x2,%edx
+  800819:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80081e:	eb c4                	jmp    8007e4 <strtol+0x49>
+  800820:	0f be c0             	movsbl %al,%eax
+  800823:	83 e8 30             	sub    $0x30,%eax
+  800826:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800829:	7d 3a                	jge    800865 <strtol+0xca>
+  80082b:	83 c2 01             	add    $0x1,%edx
+  80082e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800832:	01 c1                	add    %eax,%ecx
+  800834:	0f b6 02             	movzbl (%edx),%eax
+  800837:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80083a:	89 f3                	mov    %esi,%ebx
+  80083c:	80 fb 09             	cmp    $0x9,%bl
+  80083f:	76 df                	jbe    800820 <strtol+0x85>
+  800841:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800844:	89 f3                	mov    %esi,%ebx
+  800846:	80 fb 19             	cmp    $0x19,%bl
+  800849:	77 08                	ja     800853 <strtol+0xb8>
+  80084b:	0f be c0             	movsbl %al,%eax
+  80084e:	83 e8 57             	sub    $0x57,%eax
+  800851:	eb d3                	jmp    800826 <strtol+0x8b>
+  800853:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800856:	89 f3                	mov    %esi,%ebx
+  800858:	80 fb 19             	cmp    $0x19,%bl
+  80085b:	77 08                	ja     800865 <strtol+0xca>
+  80085d:	0f be c0             	movsbl %al,%eax
+  800860:	83 e8 37             	sub    $0x37,%eax
+  800863:	eb c1                	jmp    800826 <strtol+0x8b>
+  800865:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800869:	74 05                	je     800870 <strtol+0xd5>
+  80086b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80086e:	89 10                	mov    %edx,(%eax)
+  800870:	89 c8                	mov    %ecx,%eax
+  800872:	f7 d8                	neg    %eax
+  800874:	85 ff                	test   %edi,%edi
+  800876:	0f 45 c8             	cmovne %eax,%ecx
+  800879:	89 c8                	mov    %ecx,%eax
+  80087b:	5b                   	pop    %ebx
+  80087c:	5e                   	pop    %esi
+  80087d:	5f                   	pop    %edi
+  80087e:	5d                   	pop    %ebp
+  80087f:	c3                   	ret
+
+00800880 <sys_cputs>:
+  800880:	55                   	push   %ebp
+  800881:	89 e5                	mov    %esp,%ebp
+  800883:	57                   	push   %edi
+  800884:	56                   	push   %esi
+  800885:	53                   	push   %ebx
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80088e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800891:	89 c3                	mov    %eax,%ebx
+  800893:	89 c7                	mov    %eax,%edi
+  800895:	89 c6                	mov    %eax,%esi
+  800897:	cd 30                	int    $0x30
+  800899:	5b                   	pop    %ebx
+  80089a:	5e                   	pop    %esi
+  80089b:	5f                   	pop    %edi
+  80089c:	5d                   	pop    %ebp
+  80089d:	c3                   	ret
+
+0080089e <sys_cgetc>:
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	57                   	push   %edi
+  8008a2:	56                   	push   %esi
+  8008a3:	53                   	push   %ebx
+  8008a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8008ae:	89 d1                	mov    %edx,%ecx
+  8008b0:	89 d3                	mov    %edx,%ebx
+  8008b2:	89 d7                	mov    %edx,%edi
+  8008b4:	89 d6                	mov    %edx,%esi
+  8008b6:	cd 30                	int    $0x30
+  8008b8:	5b                   	pop    %ebx
+  8008b9:	5e                   	pop    %esi
+  8008ba:	5f                   	pop    %edi
+  8008bb:	5d                   	pop    %ebp
+  8008bc:	c3                   	ret
+
+008008bd <sys_env_destroy>:
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	57                   	push   %edi
+  8008c1:	56                   	push   %esi
+  8008c2:	53                   	push   %ebx
+  8008c3:	83 ec 0c             	sub    $0xc,%esp
+  8008c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008ce:	b8 03 00 00 00       	mov    $0x3,%eax
+  8008d3:	89 cb                	mov    %ecx,%ebx
+  8008d5:	89 cf                	mov    %ecx,%edi
+  8008d7:	89 ce                	mov    %ecx,%esi
+  8008d9:	cd 30                	int    $0x30
+  8008db:	85 c0                	test   %eax,%eax
+  8008dd:	7f 08                	jg     8008e7 <sys_env_destroy+0x2a>
+  8008df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008e2:	5b                   	pop    %ebx
+  8008e3:	5e                   	pop    %esi
+  8008e4:	5f                   	pop    %edi
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+  8008e7:	83 ec 0c             	sub    $0xc,%esp
+  8008ea:	50                   	push   %eax
+  8008eb:	6a 03                	push   $0x3
+  8008ed:	68 76 38 80 00       	push   $0x803876
+  8008f2:	6a 24                	push   $0x24
+  8008f4:	68 93 38 80 00       	push   $0x803893
+  8008f9:	e8 4b 21 00 00       	call   802a49 <_panic>
+
+008008fe <sys_getenvid>:
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	57                   	push   %edi
+  800902:	56                   	push   %esi
+  800903:	53                   	push   %ebx
+  800904:	ba 00 00 00 00       	mov    $0x0,%edx
+  800909:	b8 02 00 00 00       	mov    $0x2,%eax
+  80090e:	89 d1                	mov    %edx,%ecx
+  800910:	89 d3                	mov    %edx,%ebx
+  800912:	89 d7                	mov    %edx,%edi
+  800914:	89 d6                	mov    %edx,%esi
+  800916:	cd 30                	int    $0x30
+  800918:	5b                   	pop    %ebx
+  800919:	5e                   	pop    %esi
+  80091a:	5f                   	pop    %edi
+  80091b:	5d                   	pop    %ebp
+  80091c:	c3                   	ret
+
+0080091d <sys_yield>:
+  80091d:	55                   	push   %ebp
+  80091e:	89 e5                	mov    %esp,%ebp
+  800920:	57                   	push   %edi
+  800921:	56                   	push   %esi
+  800922:	53                   	push   %ebx
+  800923:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80092a:	74 26                	je     800952 <sys_yield+0x35>
+  80092c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800931:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800936:	89 d1                	mov    %edx,%ecx
+  800938:	89 d3                	mov    %edx,%ebx
+  80093a:	89 d7                	mov    %edx,%edi
+  80093c:	6a 00                	push   $0x0
+  80093e:	55                   	push   %ebp
+  80093f:	89 e5                	mov    %esp,%ebp
+  800941:	8d 35 49 09 80 00    	lea    0x800949,%esi
+  800947:	0f 34                	sysenter
+  800949:	5d                   	pop    %ebp
+  80094a:	83 c4 04             	add    $0x4,%esp
+  80094d:	5b                   	pop    %ebx
+  80094e:	5e                   	pop    %esi
+  80094f:	5f                   	pop    %edi
+  800950:	5d                   	pop    %ebp
+  800951:	c3                   	ret
+  800952:	ba 00 00 00 00       	mov    $0x0,%edx
+  800957:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80095c:	89 d1                	mov    %edx,%ecx
+  80095e:	89 d3                	mov    %edx,%ebx
+  800960:	89 d7                	mov    %edx,%edi
+  800962:	89 d6                	mov    %edx,%esi
+  800964:	cd 30                	int    $0x30
+  800966:	eb e5                	jmp    80094d <sys_yield+0x30>
+
+00800968 <sys_page_alloc>:
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	57                   	push   %edi
+  80096c:	56                   	push   %esi
+  80096d:	53                   	push   %ebx
+  80096e:	83 ec 0c             	sub    $0xc,%esp
+  800971:	be 00 00 00 00       	mov    $0x0,%esi
+  800976:	8b 55 08             	mov    0x8(%ebp),%edx
+  800979:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800981:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800984:	89 f7                	mov    %esi,%edi
+  800986:	cd 30                	int    $0x30
+  800988:	85 c0                	test   %eax,%eax
+  80098a:	7f 08                	jg     800994 <sys_page_alloc+0x2c>
+  80098c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80098f:	5b                   	pop    %ebx
+  800990:	5e                   	pop    %esi
+  800991:	5f                   	pop    %edi
+  800992:	5d                   	pop    %ebp
+  800993:	c3                   	ret
+  800994:	83 ec 0c             	sub    $0xc,%esp
+  800997:	50                   	push   %eax
+  800998:	6a 04                	push   $0x4
+  80099a:	68 76 38 80 00       	push   $0x803876
+  80099f:	6a 24                	push   $0x24
+  8009a1:	68 93 38 80 00       	push   $0x803893
+  8009a6:	e8 9e 20 00 00       	call   802a49 <_panic>
+
+008009ab <sys_page_map>:
+  8009ab:	55                   	push   %ebp
+  8009ac:	89 e5                	mov    %esp,%ebp
+  8009ae:	57                   	push   %edi
+  8009af:	56                   	push   %esi
+  8009b0:	53                   	push   %ebx
+  8009b1:	83 ec 0c             	sub    $0xc,%esp
+  8009b4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8009bb:	74 33                	je     8009f0 <sys_page_map+0x45>
+  8009bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009c3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8009c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009cb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8009ce:	ff 75 18             	push   0x18(%ebp)
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	8d 35 dc 09 80 00    	lea    0x8009dc,%esi
+  8009da:	0f 34                	sysenter
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	83 c4 04             	add    $0x4,%esp
+  8009e0:	89 c2                	mov    %eax,%edx
+  8009e2:	85 c0                	test   %eax,%eax
+  8009e4:	7f 3d                	jg     800a23 <sys_page_map+0x78>
+  8009e6:	89 d0                	mov    %edx,%eax
+  8009e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009eb:	5b                   	pop    %ebx
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5f                   	pop    %edi
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+  8009f0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8009f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800a01:	8b 75 18             	mov    0x18(%ebp),%esi
+  800a04:	cd 30                	int    $0x30
+  800a06:	89 c2                	mov    %eax,%edx
+  800a08:	85 c0                	test   %eax,%eax
+  800a0a:	7e da                	jle    8009e6 <sys_page_map+0x3b>
+  800a0c:	83 ec 0c             	sub    $0xc,%esp
+  800a0f:	50                   	push   %eax
+  800a10:	6a 05                	push   $0x5
+  800a12:	68 76 38 80 00       	push   $0x803876
+  800a17:	6a 24                	push   $0x24
+  800a19:	68 93 38 80 00       	push   $0x803893
+  800a1e:	e8 26 20 00 00       	call   802a49 <_panic>
+  800a23:	83 ec 0c             	sub    $0xc,%esp
+  800a26:	50                   	push   %eax
+  800a27:	6a 05                	push   $0x5
+  800a29:	68 76 38 80 00       	push   $0x803876
+  800a2e:	6a 48                	push   $0x48
+  800a30:	68 93 38 80 00       	push   $0x803893
+  800a35:	e8 0f 20 00 00       	call   802a49 <_panic>
+
+00800a3a <sys_page_unmap>:
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	57                   	push   %edi
+  800a3e:	56                   	push   %esi
+  800a3f:	53                   	push   %ebx
+  800a40:	83 ec 0c             	sub    $0xc,%esp
+  800a43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a4e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800a53:	89 df                	mov    %ebx,%edi
+  800a55:	89 de                	mov    %ebx,%esi
+  800a57:	cd 30                	int    $0x30
+  800a59:	85 c0                	test   %eax,%eax
+  800a5b:	7f 08                	jg     800a65 <sys_page_unmap+0x2b>
+  800a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a60:	5b                   	pop    %ebx
+  800a61:	5e                   	pop    %esi
+  800a62:	5f                   	pop    %edi
+  800a63:	5d                   	pop    %ebp
+  800a64:	c3                   	ret
+  800a65:	83 ec 0c             	sub    $0xc,%esp
+  800a68:	50                   	push   %eax
+  800a69:	6a 06                	push   $0x6
+  800a6b:	68 76 38 80 00       	push   $0x803876
+  800a70:	6a 24                	push   $0x24
+  800a72:	68 93 38 80 00       	push   $0x803893
+  800a77:	e8 cd 1f 00 00       	call   802a49 <_panic>
+
+00800a7c <sys_fork>:
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	57                   	push   %edi
+  800a80:	56                   	push   %esi
+  800a81:	53                   	push   %ebx
+  800a82:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a87:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800a8c:	89 d1                	mov    %edx,%ecx
+  800a8e:	89 d3                	mov    %edx,%ebx
+  800a90:	89 d7                	mov    %edx,%edi
+  800a92:	89 d6                	mov    %edx,%esi
+  800a94:	cd 30                	int    $0x30
+  800a96:	5b                   	pop    %ebx
+  800a97:	5e                   	pop    %esi
+  800a98:	5f                   	pop    %edi
+  800a99:	5d                   	pop    %ebp
+  800a9a:	c3                   	ret
+
+00800a9b <sys_env_set_status>:
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	57                   	push   %edi
+  800a9f:	56                   	push   %esi
+  800aa0:	53                   	push   %ebx
+  800aa1:	83 ec 0c             	sub    $0xc,%esp
+  800aa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aaf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ab4:	89 df                	mov    %ebx,%edi
+  800ab6:	89 de                	mov    %ebx,%esi
+  800ab8:	cd 30                	int    $0x30
+  800aba:	85 c0                	test   %eax,%eax
+  800abc:	7f 08                	jg     800ac6 <sys_env_set_status+0x2b>
+  800abe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ac1:	5b                   	pop    %ebx
+  800ac2:	5e                   	pop    %esi
+  800ac3:	5f                   	pop    %edi
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+  800ac6:	83 ec 0c             	sub    $0xc,%esp
+  800ac9:	50                   	push   %eax
+  800aca:	6a 08                	push   $0x8
+  800acc:	68 76 38 80 00       	push   $0x803876
+  800ad1:	6a 24                	push   $0x24
+  800ad3:	68 93 38 80 00       	push   $0x803893
+  800ad8:	e8 6c 1f 00 00       	call   802a49 <_panic>
+
+00800add <sys_env_set_trapframe>:
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	57                   	push   %edi
+  800ae1:	56                   	push   %esi
+  800ae2:	53                   	push   %ebx
+  800ae3:	83 ec 0c             	sub    $0xc,%esp
+  800ae6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800aeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800af6:	89 df                	mov    %ebx,%edi
+  800af8:	89 de                	mov    %ebx,%esi
+  800afa:	cd 30                	int    $0x30
+  800afc:	85 c0                	test   %eax,%eax
+  800afe:	7f 08                	jg     800b08 <sys_env_set_trapframe+0x2b>
+  800b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b03:	5b                   	pop    %ebx
+  800b04:	5e                   	pop    %esi
+  800b05:	5f                   	pop    %edi
+  800b06:	5d                   	pop    %ebp
+  800b07:	c3                   	ret
+  800b08:	83 ec 0c             	sub    $0xc,%esp
+  800b0b:	50                   	push   %eax
+  800b0c:	6a 09                	push   $0x9
+  800b0e:	68 76 38 80 00       	push   $0x803876
+  800b13:	6a 24                	push   $0x24
+  800b15:	68 93 38 80 00       	push   $0x803893
+  800b1a:	e8 2a 1f 00 00       	call   802a49 <_panic>
+
+00800b1f <sys_env_set_cow>:
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	53                   	push   %ebx
+  800b25:	83 ec 0c             	sub    $0xc,%esp
+  800b28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b33:	b8 20 00 00 00       	mov    $0x20,%eax
+  800b38:	89 df                	mov    %ebx,%edi
+  800b3a:	89 de                	mov    %ebx,%esi
+  800b3c:	cd 30                	int    $0x30
+  800b3e:	85 c0                	test   %eax,%eax
+  800b40:	7f 08                	jg     800b4a <sys_env_set_cow+0x2b>
+  800b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b45:	5b                   	pop    %ebx
+  800b46:	5e                   	pop    %esi
+  800b47:	5f                   	pop    %edi
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+  800b4a:	83 ec 0c             	sub    $0xc,%esp
+  800b4d:	50                   	push   %eax
+  800b4e:	6a 20                	push   $0x20
+  800b50:	68 76 38 80 00       	push   $0x803876
+  800b55:	6a 24                	push   $0x24
+  800b57:	68 93 38 80 00       	push   $0x803893
+  800b5c:	e8 e8 1e 00 00       	call   802a49 <_panic>
+
+00800b61 <sys_env_service>:
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	57                   	push   %edi
+  800b65:	56                   	push   %esi
+  800b66:	53                   	push   %ebx
+  800b67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6f:	b8 21 00 00 00       	mov    $0x21,%eax
+  800b74:	89 cb                	mov    %ecx,%ebx
+  800b76:	89 cf                	mov    %ecx,%edi
+  800b78:	89 ce                	mov    %ecx,%esi
+  800b7a:	cd 30                	int    $0x30
+  800b7c:	5b                   	pop    %ebx
+  800b7d:	5e                   	pop    %esi
+  800b7e:	5f                   	pop    %edi
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <sys_env_set_pgfault_upcall>:
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+  800b8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b95:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b9a:	89 df                	mov    %ebx,%edi
+  800b9c:	89 de                	mov    %ebx,%esi
+  800b9e:	cd 30                	int    $0x30
+  800ba0:	85 c0                	test   %eax,%eax
+  800ba2:	7f 08                	jg     800bac <sys_env_set_pgfault_upcall+0x2b>
+  800ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba7:	5b                   	pop    %ebx
+  800ba8:	5e                   	pop    %esi
+  800ba9:	5f                   	pop    %edi
+  800baa:	5d                   	pop    %ebp
+  800bab:	c3                   	ret
+  800bac:	83 ec 0c             	sub    $0xc,%esp
+  800baf:	50                   	push   %eax
+  800bb0:	6a 0a                	push   $0xa
+  800bb2:	68 76 38 80 00       	push   $0x803876
+  800bb7:	6a 24                	push   $0x24
+  800bb9:	68 93 38 80 00       	push   $0x803893
+  800bbe:	e8 86 1e 00 00       	call   802a49 <_panic>
+
+00800bc3 <sys_ipc_try_send>:
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	57                   	push   %edi
+  800bc7:	56                   	push   %esi
+  800bc8:	53                   	push   %ebx
+  800bc9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800bd0:	74 27                	je     800bf9 <sys_ipc_try_send+0x36>
+  800bd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800bdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800be0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800be3:	6a 00                	push   $0x0
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	8d 35 f0 0b 80 00    	lea    0x800bf0,%esi
+  800bee:	0f 34                	sysenter
+  800bf0:	5d                   	pop    %ebp
+  800bf1:	83 c4 04             	add    $0x4,%esp
+  800bf4:	5b                   	pop    %ebx
+  800bf5:	5e                   	pop    %esi
+  800bf6:	5f                   	pop    %edi
+  800bf7:	5d                   	pop    %ebp
+  800bf8:	c3                   	ret
+  800bf9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800bfe:	be 00 00 00 00       	mov    $0x0,%esi
+  800c03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c0c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c0f:	cd 30                	int    $0x30
+  800c11:	eb e1                	jmp    800bf4 <sys_ipc_try_send+0x31>
+
+00800c13 <sys_ipc_recv>:
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	57                   	push   %edi
+  800c17:	56                   	push   %esi
+  800c18:	53                   	push   %ebx
+  800c19:	83 ec 0c             	sub    $0xc,%esp
+  800c1c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800c23:	74 32                	je     800c57 <sys_ipc_recv+0x44>
+  800c25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c2d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800c32:	89 cb                	mov    %ecx,%ebx
+  800c34:	89 cf                	mov    %ecx,%edi
+  800c36:	6a 00                	push   $0x0
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	8d 35 43 0c 80 00    	lea    0x800c43,%esi
+  800c41:	0f 34                	sysenter
+  800c43:	5d                   	pop    %ebp
+  800c44:	83 c4 04             	add    $0x4,%esp
+  800c47:	89 c2                	mov    %eax,%edx
+  800c49:	85 c0                	test   %eax,%eax
+  800c4b:	7f 3c                	jg     800c89 <sys_ipc_recv+0x76>
+  800c4d:	89 d0                	mov    %edx,%eax
+  800c4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c52:	5b                   	pop    %ebx
+  800c53:	5e                   	pop    %esi
+  800c54:	5f                   	pop    %edi
+  800c55:	5d                   	pop    %ebp
+  800c56:	c3                   	ret
+  800c57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	89 cb                	mov    %ecx,%ebx
+  800c66:	89 cf                	mov    %ecx,%edi
+  800c68:	89 ce                	mov    %ecx,%esi
+  800c6a:	cd 30                	int    $0x30
+  800c6c:	89 c2                	mov    %eax,%edx
+  800c6e:	85 c0                	test   %eax,%eax
+  800c70:	7e db                	jle    800c4d <sys_ipc_recv+0x3a>
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+  800c75:	50                   	push   %eax
+  800c76:	6a 0d                	push   $0xd
+  800c78:	68 76 38 80 00       	push   $0x803876
+  800c7d:	6a 24                	push   $0x24
+  800c7f:	68 93 38 80 00       	push   $0x803893
+  800c84:	e8 c0 1d 00 00       	call   802a49 <_panic>
+  800c89:	83 ec 0c             	sub    $0xc,%esp
+  800c8c:	50                   	push   %eax
+  800c8d:	6a 0d                	push   $0xd
+  800c8f:	68 76 38 80 00       	push   $0x803876
+  800c94:	6a 48                	push   $0x48
+  800c96:	68 93 38 80 00       	push   $0x803893
+  800c9b:	e8 a9 1d 00 00       	call   802a49 <_panic>
+
+00800ca0 <sys_ipc_send>:
+  800ca0:	55                   	push   %ebp
+  800ca1:	89 e5                	mov    %esp,%ebp
+  800ca3:	57                   	push   %edi
+  800ca4:	56                   	push   %esi
+  800ca5:	53                   	push   %ebx
+  800ca6:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800cad:	74 27                	je     800cd6 <sys_ipc_send+0x36>
+  800caf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800cba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cbd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cc0:	6a 00                	push   $0x0
+  800cc2:	55                   	push   %ebp
+  800cc3:	89 e5                	mov    %esp,%ebp
+  800cc5:	8d 35 cd 0c 80 00    	lea    0x800ccd,%esi
+  800ccb:	0f 34                	sysenter
+  800ccd:	5d                   	pop    %ebp
+  800cce:	83 c4 04             	add    $0x4,%esp
+  800cd1:	5b                   	pop    %ebx
+  800cd2:	5e                   	pop    %esi
+  800cd3:	5f                   	pop    %edi
+  800cd4:	5d                   	pop    %ebp
+  800cd5:	c3                   	ret
+  800cd6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800cdb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cec:	cd 30                	int    $0x30
+  800cee:	eb e1                	jmp    800cd1 <sys_ipc_send+0x31>
+
+00800cf0 <sys_ipc_call>:
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	57                   	push   %edi
+  800cf4:	56                   	push   %esi
+  800cf5:	53                   	push   %ebx
+  800cf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800d01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d04:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d07:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d0a:	cd 30                	int    $0x30
+  800d0c:	5b                   	pop    %ebx
+  800d0d:	5e                   	pop    %esi
+  800d0e:	5f                   	pop    %edi
+  800d0f:	5d                   	pop    %ebp
+  800d10:	c3                   	ret
+
+00800d11 <sys_ipc_reply_recv>:
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	57                   	push   %edi
+  800d15:	56                   	push   %esi
+  800d16:	53                   	push   %ebx
+  800d17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800d22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d25:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d28:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d2b:	cd 30                	int    $0x30
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+
+00800d32 <sys_time_msec>:
+  800d32:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  800d37:	85 c0                	test   %eax,%eax
+  800d39:	75 06                	jne    800d41 <sys_time_msec+0xf>
+  800d3b:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  800d40:	c3                   	ret
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	57                   	push   %edi
+  800d45:	56                   	push   %esi
+  800d46:	53                   	push   %ebx
+  800d47:	83 ec 0c             	sub    $0xc,%esp
+  800d4a:	0f 31                	rdtsc
+  800d4c:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800d52:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  800d58:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  800d5e:	29 c8                	sub    %ecx,%eax
+  800d60:	19 da                	sbb    %ebx,%edx
+  800d62:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	52                   	push   %edx
+  800d6a:	50                   	push   %eax
+  800d6b:	e8 e5 27 00 00       	call   803555 <__udivdi3>
+  800d70:	83 c4 10             	add    $0x10,%esp
+  800d73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d76:	5b                   	pop    %ebx
+  800d77:	5e                   	pop    %esi
+  800d78:	5f                   	pop    %edi
+  800d79:	5d                   	pop    %ebp
+  800d7a:	c3                   	ret
+
+00800d7b <sys_env_swap>:
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	57                   	push   %edi
+  800d7f:	56                   	push   %esi
+  800d80:	53                   	push   %ebx
+  800d81:	83 ec 0c             	sub    $0xc,%esp
+  800d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d91:	89 cb                	mov    %ecx,%ebx
+  800d93:	89 cf                	mov    %ecx,%edi
+  800d95:	89 ce                	mov    %ecx,%esi
+  800d97:	cd 30                	int    $0x30
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	7f 08                	jg     800da5 <sys_env_swap+0x2a>
+  800d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  800da8:	50                   	push   %eax
+  800da9:	6a 12                	push   $0x12
+  800dab:	68 76 38 80 00       	push   $0x803876
+  800db0:	6a 24                	push   $0x24
+  800db2:	68 93 38 80 00       	push   $0x803893
+  800db7:	e8 8d 1c 00 00       	call   802a49 <_panic>
+
+00800dbc <sys_net_try_send>:
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+  800dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd0:	b8 13 00 00 00       	mov    $0x13,%eax
+  800dd5:	89 df                	mov    %ebx,%edi
+  800dd7:	89 de                	mov    %ebx,%esi
+  800dd9:	cd 30                	int    $0x30
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 08                	jg     800de7 <sys_net_try_send+0x2b>
+  800ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	50                   	push   %eax
+  800deb:	6a 13                	push   $0x13
+  800ded:	68 76 38 80 00       	push   $0x803876
+  800df2:	6a 24                	push   $0x24
+  800df4:	68 93 38 80 00       	push   $0x803893
+  800df9:	e8 4b 1c 00 00       	call   802a49 <_panic>
+
+00800dfe <sys_net_try_receive>:
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  800e04:	83 ec 0c             	sub    $0xc,%esp
+  800e07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e12:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e17:	89 df                	mov    %ebx,%edi
+  800e19:	89 de                	mov    %ebx,%esi
+  800e1b:	cd 30                	int    $0x30
+  800e1d:	85 c0                	test   %eax,%eax
+  800e1f:	7f 08                	jg     800e29 <sys_net_try_receive+0x2b>
+  800e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	50                   	push   %eax
+  800e2d:	6a 14                	push   $0x14
+  800e2f:	68 76 38 80 00       	push   $0x803876
+  800e34:	6a 24                	push   $0x24
+  800e36:	68 93 38 80 00       	push   $0x803893
+  800e3b:	e8 09 1c 00 00       	call   802a49 <_panic>
+
+00800e40 <sys_net_recv_page>:
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+  800e46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4e:	b8 27 00 00 00       	mov    $0x27,%eax
+  800e53:	89 cb                	mov    %ecx,%ebx
+  800e55:	89 cf                	mov    %ecx,%edi
+  800e57:	89 ce                	mov    %ecx,%esi
+  800e59:	cd 30                	int    $0x30
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+
+00800e60 <sys_net_wait>:
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	57                   	push   %edi
+  800e64:	56                   	push   %esi
+  800e65:	53                   	push   %ebx
+  800e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6b:	b8 26 00 00 00       	mov    $0x26,%eax
+  800e70:	89 d1                	mov    %edx,%ecx
+  800e72:	89 d3                	mov    %edx,%ebx
+  800e74:	89 d7                	mov    %edx,%edi
+  800e76:	89 d6                	mov    %edx,%esi
+  800e78:	cd 30                	int    $0x30
+  800e7a:	5b                   	pop    %ebx
+  800e7b:	5e                   	pop    %esi
+  800e7c:	5f                   	pop    %edi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+
+00800e7f <sys_get_mac>:
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	56                   	push   %esi
+  800e84:	53                   	push   %ebx
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+  800e88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e93:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e98:	89 df                	mov    %ebx,%edi
+  800e9a:	89 de                	mov    %ebx,%esi
+  800e9c:	cd 30                	int    $0x30
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	7f 08                	jg     800eaa <sys_get_mac+0x2b>
+  800ea2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+  800eaa:	83 ec 0c             	sub    $0xc,%esp
+  800ead:	50                   	push   %eax
+  800eae:	6a 15                	push   $0x15
+  800eb0:	68 76 38 80 00       	push   $0x803876
+  800eb5:	6a 24                	push   $0x24
+  800eb7:	68 93 38 80 00       	push   $0x803893
+  800ebc:	e8 88 1b 00 00       	call   802a49 <_panic>
+
+00800ec1 <sys_env_lease>:
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	56                   	push   %esi
+  800ec6:	53                   	push   %ebx
+  800ec7:	83 ec 0c             	sub    $0xc,%esp
+  800eca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed5:	b8 16 00 00 00       	mov    $0x16,%eax
+  800eda:	89 df                	mov    %ebx,%edi
+  800edc:	89 de                	mov    %ebx,%esi
+  800ede:	cd 30                	int    $0x30
+  800ee0:	85 c0                	test   %eax,%eax
+  800ee2:	7f 08                	jg     800eec <sys_env_lease+0x2b>
+  800ee4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee7:	5b                   	pop    %ebx
+  800ee8:	5e                   	pop    %esi
+  800ee9:	5f                   	pop    %edi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	c3                   	ret
+  800eec:	83 ec 0c             	sub    $0xc,%esp
+  800eef:	50                   	push   %eax
+  800ef0:	6a 16                	push   $0x16
+  800ef2:	68 76 38 80 00       	push   $0x803876
+  800ef7:	6a 24                	push   $0x24
+  800ef9:	68 93 38 80 00       	push   $0x803893
+  800efe:	e8 46 1b 00 00       	call   802a49 <_panic>
+
+00800f03 <sys_copy_mem>:
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	57                   	push   %edi
+  800f07:	56                   	push   %esi
+  800f08:	53                   	push   %ebx
+  800f09:	83 ec 0c             	sub    $0xc,%esp
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f12:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f1d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f20:	cd 30                	int    $0x30
+  800f22:	85 c0                	test   %eax,%eax
+  800f24:	7f 08                	jg     800f2e <sys_copy_mem+0x2b>
+  800f26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f29:	5b                   	pop    %ebx
+  800f2a:	5e                   	pop    %esi
+  800f2b:	5f                   	pop    %edi
+  800f2c:	5d                   	pop    %ebp
+  800f2d:	c3                   	ret
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  800f31:	50                   	push   %eax
+  800f32:	6a 17                	push   $0x17
+  800f34:	68 76 38 80 00       	push   $0x803876
+  800f39:	6a 24                	push   $0x24
+  800f3b:	68 93 38 80 00       	push   $0x803893
+  800f40:	e8 04 1b 00 00       	call   802a49 <_panic>
+
+00800f45 <sys_get_perms>:
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	57                   	push   %edi
+  800f49:	56                   	push   %esi
+  800f4a:	53                   	push   %ebx
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+  800f4e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f59:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f61:	89 f7                	mov    %esi,%edi
+  800f63:	cd 30                	int    $0x30
+  800f65:	85 c0                	test   %eax,%eax
+  800f67:	7f 08                	jg     800f71 <sys_get_perms+0x2c>
+  800f69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+  800f71:	83 ec 0c             	sub    $0xc,%esp
+  800f74:	50                   	push   %eax
+  800f75:	6a 18                	push   $0x18
+  800f77:	68 76 38 80 00       	push   $0x803876
+  800f7c:	6a 24                	push   $0x24
+  800f7e:	68 93 38 80 00       	push   $0x803893
+  800f83:	e8 c1 1a 00 00       	call   802a49 <_panic>
+
+00800f88 <sys_env_unsuspend>:
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+  800f91:	be 00 00 00 00       	mov    $0x0,%esi
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 19 00 00 00       	mov    $0x19,%eax
+  800fa1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa4:	89 f7                	mov    %esi,%edi
+  800fa6:	cd 30                	int    $0x30
+  800fa8:	85 c0                	test   %eax,%eax
+  800faa:	7f 08                	jg     800fb4 <sys_env_unsuspend+0x2c>
+  800fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	50                   	push   %eax
+  800fb8:	6a 19                	push   $0x19
+  800fba:	68 76 38 80 00       	push   $0x803876
+  800fbf:	6a 24                	push   $0x24
+  800fc1:	68 93 38 80 00       	push   $0x803893
+  800fc6:	e8 7e 1a 00 00       	call   802a49 <_panic>
+
+00800fcb <sys_migrate>:
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+  800fd4:	ba 00 d0 83 00       	mov    $0x83d000,%edx
+  800fd9:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  800fdf:	76 11                	jbe    800ff2 <sys_migrate+0x27>
+  800fe1:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800fe6:	0f b6 08             	movzbl (%eax),%ecx
+  800fe9:	05 00 10 00 00       	add    $0x1000,%eax
+  800fee:	39 d0                	cmp    %edx,%eax
+  800ff0:	72 f4                	jb     800fe6 <sys_migrate+0x1b>
+  800ff2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800fff:	89 cb                	mov    %ecx,%ebx
+  801001:	89 cf                	mov    %ecx,%edi
+  801003:	89 ce                	mov    %ecx,%esi
+  801005:	cd 30                	int    $0x30
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7f 08                	jg     801013 <sys_migrate+0x48>
+  80100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5f                   	pop    %edi
+  801011:	5d                   	pop    %ebp
+  801012:	c3                   	ret
+  801013:	83 ec 0c             	sub    $0xc,%esp
+  801016:	50                   	push   %eax
+  801017:	6a 1a                	push   $0x1a
+  801019:	68 76 38 80 00       	push   $0x803876
+  80101e:	6a 24                	push   $0x24
+  801020:	68 93 38 80 00       	push   $0x803893
+  801025:	e8 1f 1a 00 00       	call   802a49 <_panic>
+
+0080102a <sys_lease_complete>:
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	56                   	push   %esi
+  80102f:	53                   	push   %ebx
+  801030:	83 ec 0c             	sub    $0xc,%esp
+  801033:	ba 00 00 00 00       	mov    $0x0,%edx
+  801038:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80103d:	89 d1                	mov    %edx,%ecx
+  80103f:	89 d3                	mov    %edx,%ebx
+  801041:	89 d7                	mov    %edx,%edi
+  801043:	89 d6                	mov    %edx,%esi
+  801045:	cd 30                	int    $0x30
+  801047:	85 c0                	test   %eax,%eax
+  801049:	7f 08                	jg     801053 <sys_lease_complete+0x29>
+  80104b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+  801053:	83 ec 0c             	sub    $0xc,%esp
+  801056:	50                   	push   %eax
+  801057:	6a 1b                	push   $0x1b
+  801059:	68 76 38 80 00       	push   $0x803876
+  80105e:	6a 24                	push   $0x24
+  801060:	68 93 38 80 00       	push   $0x803893
+  801065:	e8 df 19 00 00       	call   802a49 <_panic>
+
+0080106a <sys_env_set_thisenv>:
+  80106a:	55                   	push   %ebp
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	57                   	push   %edi
+  80106e:	56                   	push   %esi
+  80106f:	53                   	push   %ebx
+  801070:	83 ec 0c             	sub    $0xc,%esp
+  801073:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801083:	89 df                	mov    %ebx,%edi
+  801085:	89 de                	mov    %ebx,%esi
+  801087:	cd 30                	int    $0x30
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	7f 08                	jg     801095 <sys_env_set_thisenv+0x2b>
+  80108d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+  801095:	83 ec 0c             	sub    $0xc,%esp
+  801098:	50                   	push   %eax
+  801099:	6a 1c                	push   $0x1c
+  80109b:	68 76 38 80 00       	push   $0x803876
+  8010a0:	6a 24                	push   $0x24
+  8010a2:	68 93 38 80 00       	push   $0x803893
+  8010a7:	e8 9d 19 00 00       	call   802a49 <_panic>
+
+008010ac <sys_env_set_sched>:
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	56                   	push   %esi
+  8010b1:	53                   	push   %ebx
+  8010b2:	83 ec 0c             	sub    $0xc,%esp
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8010c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c8:	89 f7                	mov    %esi,%edi
+  8010ca:	cd 30                	int    $0x30
+  8010cc:	85 c0                	test   %eax,%eax
+  8010ce:	7f 08                	jg     8010d8 <sys_env_set_sched+0x2c>
+  8010d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	50                   	push   %eax
+  8010dc:	6a 1d                	push   $0x1d
+  8010de:	68 76 38 80 00       	push   $0x803876
+  8010e3:	6a 24                	push   $0x24
+  8010e5:	68 93 38 80 00       	push   $0x803893
+  8010ea:	e8 5a 19 00 00       	call   802a49 <_panic>
+
+008010ef <sys_batch>:
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	57                   	push   %edi
+  8010f3:	56                   	push   %esi
+  8010f4:	53                   	push   %ebx
+  8010f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801100:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801105:	89 df                	mov    %ebx,%edi
+  801107:	89 de                	mov    %ebx,%esi
+  801109:	cd 30                	int    $0x30
+  80110b:	5b                   	pop    %ebx
+  80110c:	5e                   	pop    %esi
+  80110d:	5f                   	pop    %edi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+
+00801110 <sys_env_stats>:
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	57                   	push   %edi
+  801114:	56                   	push   %esi
+  801115:	53                   	push   %ebx
+  801116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801121:	b8 23 00 00 00       	mov    $0x23,%eax
+  801126:	89 df                	mov    %ebx,%edi
+  801128:	89 de                	mov    %ebx,%esi
+  80112a:	cd 30                	int    $0x30
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+
+00801131 <sys_trace>:
+  801131:	55                   	push   %ebp
+  801132:	89 e5                	mov    %esp,%ebp
+  801134:	57                   	push   %edi
+  801135:	56                   	push   %esi
+  801136:	53                   	push   %ebx
+  801137:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113f:	b8 24 00 00 00       	mov    $0x24,%eax
+  801144:	89 cb                	mov    %ecx,%ebx
+  801146:	89 cf                	mov    %ecx,%edi
+  801148:	89 ce                	mov    %ecx,%esi
+  80114a:	cd 30                	int    $0x30
+  80114c:	5b                   	pop    %ebx
+  80114d:	5e                   	pop    %esi
+  80114e:	5f                   	pop    %edi
+  80114f:	5d                   	pop    %ebp
+  801150:	c3                   	ret
+
+00801151 <sys_env_set_pager>:
+  801151:	55                   	push   %ebp
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	57                   	push   %edi
+  801155:	56                   	push   %esi
+  801156:	53                   	push   %ebx
+  801157:	83 ec 0c             	sub    $0xc,%esp
+  80115a:	be 00 00 00 00       	mov    $0x0,%esi
+  80115f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801162:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801165:	b8 25 00 00 00       	mov    $0x25,%eax
+  80116a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116d:	89 f7                	mov    %esi,%edi
+  80116f:	cd 30                	int    $0x30
+  801171:	85 c0                	test   %eax,%eax
+  801173:	7f 08                	jg     80117d <sys_env_set_pager+0x2c>
+  801175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+  80117d:	83 ec 0c             	sub    $0xc,%esp
+  801180:	50                   	push   %eax
+  801181:	6a 25                	push   $0x25
+  801183:	68 76 38 80 00       	push   $0x803876
+  801188:	6a 24                	push   $0x24
+  80118a:	68 93 38 80 00       	push   $0x803893
+  80118f:	e8 b5 18 00 00       	call   802a49 <_panic>
+
+00801194 <sys_pager_retire>:
+  801194:	55                   	push   %ebp
+  801195:	89 e5                	mov    %esp,%ebp
+  801197:	57                   	push   %edi
+  801198:	56                   	push   %esi
+  801199:	53                   	push   %ebx
+  80119a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a2:	b8 28 00 00 00       	mov    $0x28,%eax
+  8011a7:	89 cb                	mov    %ecx,%ebx
+  8011a9:	89 cf                	mov    %ecx,%edi
+  8011ab:	89 ce                	mov    %ecx,%esi
+  8011ad:	cd 30                	int    $0x30
+  8011af:	5b                   	pop    %ebx
+  8011b0:	5e                   	pop    %esi
+  8011b1:	5f                   	pop    %edi
+  8011b2:	5d                   	pop    %ebp
+  8011b3:	c3                   	ret
+
+008011b4 <sys_prof>:
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8011ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011cd:	89 f7                	mov    %esi,%edi
+  8011cf:	cd 30                	int    $0x30
+  8011d1:	5b                   	pop    %ebx
+  8011d2:	5e                   	pop    %esi
+  8011d3:	5f                   	pop    %edi
+  8011d4:	5d                   	pop    %ebp
+  8011d5:	c3                   	ret
+
+008011d6 <fd2num>:
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011dc:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011e1:	c1 e8 0c             	shr    $0xc,%eax
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <fd2data>:
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ec:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011f6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+
+008011fd <fd_alloc>:
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801205:	89 c2                	mov    %eax,%edx
+  801207:	c1 ea 16             	shr    $0x16,%edx
+  80120a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801211:	f6 c2 01             	test   $0x1,%dl
+  801214:	74 29                	je     80123f <fd_alloc+0x42>
+  801216:	89 c2                	mov    %eax,%edx
+  801218:	c1 ea 0c             	shr    $0xc,%edx
+  80121b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801222:	f6 c2 01             	test   $0x1,%dl
+  801225:	74 18                	je     80123f <fd_alloc+0x42>
+  801227:	05 00 10 00 00       	add    $0x1000,%eax
+  80122c:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801231:	75 d2                	jne    801205 <fd_alloc+0x8>
+  801233:	b8 00 00 00 00       	mov    $0x0,%eax
+  801238:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80123d:	eb 05                	jmp    801244 <fd_alloc+0x47>
+  80123f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801244:	8b 55 08             	mov    0x8(%ebp),%edx
+  801247:	89 02                	mov    %eax,(%edx)
+  801249:	89 c8                	mov    %ecx,%eax
+  80124b:	5d                   	pop    %ebp
+  80124c:	c3                   	ret
+
+0080124d <fd_lookup>:
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	8b 45 08             	mov    0x8(%ebp),%eax
+  801253:	83 f8 1f             	cmp    $0x1f,%eax
+  801256:	77 30                	ja     801288 <fd_lookup+0x3b>
+  801258:	c1 e0 0c             	shl    $0xc,%eax
+  80125b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801260:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801266:	f6 c2 01             	test   $0x1,%dl
+  801269:	74 24                	je     80128f <fd_lookup+0x42>
+  80126b:	89 c2                	mov    %eax,%edx
+  80126d:	c1 ea 0c             	shr    $0xc,%edx
+  801270:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801277:	f6 c2 01             	test   $0x1,%dl
+  80127a:	74 1a                	je     801296 <fd_lookup+0x49>
+  80127c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80127f:	89 02                	mov    %eax,(%edx)
+  801281:	b8 00 00 00 00       	mov    $0x0,%eax
+  801286:	5d                   	pop    %ebp
+  801287:	c3                   	ret
+  801288:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128d:	eb f7                	jmp    801286 <fd_lookup+0x39>
+  80128f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801294:	eb f0                	jmp    801286 <fd_lookup+0x39>
+  801296:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80129b:	eb e9                	jmp    801286 <fd_lookup+0x39>
+
+0080129d <dev_lookup>:
+  80129d:	55                   	push   %ebp
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	53                   	push   %ebx
+  8012a1:	83 ec 04             	sub    $0x4,%esp
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ac:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8012b1:	39 13                	cmp    %edx,(%ebx)
+  8012b3:	74 37                	je     8012ec <dev_lookup+0x4f>
+  8012b5:	83 c0 01             	add    $0x1,%eax
+  8012b8:	8b 1c 85 20 39 80 00 	mov    0x803920(,%eax,4),%ebx
+  8012bf:	85 db                	test   %ebx,%ebx
+  8012c1:	75 ee                	jne    8012b1 <dev_lookup+0x14>
+  8012c3:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8012c8:	8b 40 48             	mov    0x48(%eax),%eax
+  8012cb:	83 ec 04             	sub    $0x4,%esp
+  8012ce:	52                   	push   %edx
+  8012cf:	50                   	push   %eax
+  8012d0:	68 a4 38 80 00       	push   $0x8038a4
+  8012d5:	e8 4a 18 00 00       	call   802b24 <cprintf>
+  8012da:	83 c4 10             	add    $0x10,%esp
+  8012dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e5:	89 1a                	mov    %ebx,(%edx)
+  8012e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ea:	c9                   	leave
+  8012eb:	c3                   	ret
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	eb ef                	jmp    8012e2 <dev_lookup+0x45>
+
+008012f3 <fd_close>:
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	57                   	push   %edi
+  8012f7:	56                   	push   %esi
+  8012f8:	53                   	push   %ebx
+  8012f9:	83 ec 24             	sub    $0x24,%esp
+  8012fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012ff:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801302:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801305:	50                   	push   %eax
+  801306:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80130c:	c1 e8 0c             	shr    $0xc,%eax
+  80130f:	50                   	push   %eax
+  801310:	e8 38 ff ff ff       	call   80124d <fd_lookup>
+  801315:	89 c3                	mov    %eax,%ebx
+  801317:	83 c4 10             	add    $0x10,%esp
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	78 05                	js     801323 <fd_close+0x30>
+  80131e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801321:	74 0f                	je     801332 <fd_close+0x3f>
+  801323:	85 ff                	test   %edi,%edi
+  801325:	0f 44 df             	cmove  %edi,%ebx
+  801328:	89 d8                	mov    %ebx,%eax
+  80132a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132d:	5b                   	pop    %ebx
+  80132e:	5e                   	pop    %esi
+  80132f:	5f                   	pop    %edi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+  801332:	83 ec 08             	sub    $0x8,%esp
+  801335:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801338:	50                   	push   %eax
+  801339:	ff 36                	push   (%esi)
+  80133b:	e8 5d ff ff ff       	call   80129d <dev_lookup>
+  801340:	89 c3                	mov    %eax,%ebx
+  801342:	83 c4 10             	add    $0x10,%esp
+  801345:	85 c0                	test   %eax,%eax
+  801347:	78 1a                	js     801363 <fd_close+0x70>
+  801349:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80134c:	8b 40 10             	mov    0x10(%eax),%eax
+  80134f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801354:	85 c0                	test   %eax,%eax
+  801356:	74 0b                	je     801363 <fd_close+0x70>
+  801358:	83 ec 0c             	sub    $0xc,%esp
+  80135b:	56                   	push   %esi
+  80135c:	ff d0                	call   *%eax
+  80135e:	89 c3                	mov    %eax,%ebx
+  801360:	83 c4 10             	add    $0x10,%esp
+  801363:	83 ec 08             	sub    $0x8,%esp
+  801366:	56                   	push   %esi
+  801367:	6a 00                	push   $0x0
+  801369:	e8 cc f6 ff ff       	call   800a3a <sys_page_unmap>
+  80136e:	83 c4 10             	add    $0x10,%esp
+  801371:	eb b5                	jmp    801328 <fd_close+0x35>
+
+00801373 <close>:
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	83 ec 20             	sub    $0x20,%esp
+  801379:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80137c:	50                   	push   %eax
+  80137d:	ff 75 08             	push   0x8(%ebp)
+  801380:	e8 c8 fe ff ff       	call   80124d <fd_lookup>
+  801385:	83 c4 10             	add    $0x10,%esp
+  801388:	85 c0                	test   %eax,%eax
+  80138a:	79 02                	jns    80138e <close+0x1b>
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+  80138e:	83 ec 08             	sub    $0x8,%esp
+  801391:	6a 01                	push   $0x1
+  801393:	ff 75 f4             	push   -0xc(%ebp)
+  801396:	e8 58 ff ff ff       	call   8012f3 <fd_close>
+  80139b:	83 c4 10             	add    $0x10,%esp
+  80139e:	eb ec                	jmp    80138c <close+0x19>
+
+008013a0 <close_all>:
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	53                   	push   %ebx
+  8013a4:	83 ec 04             	sub    $0x4,%esp
+  8013a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ac:	83 ec 0c             	sub    $0xc,%esp
+  8013af:	53                   	push   %ebx
+  8013b0:	e8 be ff ff ff       	call   801373 <close>
+  8013b5:	83 c3 01             	add    $0x1,%ebx
+  8013b8:	83 c4 10             	add    $0x10,%esp
+  8013bb:	83 fb 20             	cmp    $0x20,%ebx
+  8013be:	75 ec                	jne    8013ac <close_all+0xc>
+  8013c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+
+008013c5 <dup>:
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	57                   	push   %edi
+  8013c9:	56                   	push   %esi
+  8013ca:	53                   	push   %ebx
+  8013cb:	83 ec 34             	sub    $0x34,%esp
+  8013ce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013d1:	50                   	push   %eax
+  8013d2:	ff 75 08             	push   0x8(%ebp)
+  8013d5:	e8 73 fe ff ff       	call   80124d <fd_lookup>
+  8013da:	89 c3                	mov    %eax,%ebx
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	78 7f                	js     801462 <dup+0x9d>
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	ff 75 0c             	push   0xc(%ebp)
+  8013e9:	e8 85 ff ff ff       	call   801373 <close>
+  8013ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013f1:	c1 e6 0c             	shl    $0xc,%esi
+  8013f4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8013fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013fd:	89 3c 24             	mov    %edi,(%esp)
+  801400:	e8 e1 fd ff ff       	call   8011e6 <fd2data>
+  801405:	89 c3                	mov    %eax,%ebx
+  801407:	89 34 24             	mov    %esi,(%esp)
+  80140a:	e8 d7 fd ff ff       	call   8011e6 <fd2data>
+  80140f:	83 c4 10             	add    $0x10,%esp
+  801412:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801415:	89 d8                	mov    %ebx,%eax
+  801417:	c1 e8 16             	shr    $0x16,%eax
+  80141a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801421:	a8 01                	test   $0x1,%al
+  801423:	74 11                	je     801436 <dup+0x71>
+  801425:	89 d8                	mov    %ebx,%eax
+  801427:	c1 e8 0c             	shr    $0xc,%eax
+  80142a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801431:	f6 c2 01             	test   $0x1,%dl
+  801434:	75 36                	jne    80146c <dup+0xa7>
+  801436:	89 f8                	mov    %edi,%eax
+  801438:	c1 e8 0c             	shr    $0xc,%eax
+  80143b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801442:	83 ec 0c             	sub    $0xc,%esp
+  801445:	25 07 0e 00 00       	and    $0xe07,%eax
+  80144a:	50                   	push   %eax
+  80144b:	56                   	push   %esi
+  80144c:	6a 00                	push   $0x0
+  80144e:	57                   	push   %edi
+  80144f:	6a 00                	push   $0x0
+  801451:	e8 55 f5 ff ff       	call   8009ab <sys_page_map>
+  801456:	89 c3                	mov    %eax,%ebx
+  801458:	83 c4 20             	add    $0x20,%esp
+  80145b:	85 c0                	test   %eax,%eax
+  80145d:	78 33                	js     801492 <dup+0xcd>
+  80145f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801462:	89 d8                	mov    %ebx,%eax
+  801464:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801467:	5b                   	pop    %ebx
+  801468:	5e                   	pop    %esi
+  801469:	5f                   	pop    %edi
+  80146a:	5d                   	pop    %ebp
+  80146b:	c3                   	ret
+  80146c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801473:	83 ec 0c             	sub    $0xc,%esp
+  801476:	25 07 0e 00 00       	and    $0xe07,%eax
+  80147b:	50                   	push   %eax
+  80147c:	ff 75 d4             	push   -0x2c(%ebp)
+  80147f:	6a 00                	push   $0x0
+  801481:	53                   	push   %ebx
+  801482:	6a 00                	push   $0x0
+  801484:	e8 22 f5 ff ff       	call   8009ab <sys_page_map>
+  801489:	89 c3                	mov    %eax,%ebx
+  80148b:	83 c4 20             	add    $0x20,%esp
+  80148e:	85 c0                	test   %eax,%eax
+  801490:	79 a4                	jns    801436 <dup+0x71>
+  801492:	83 ec 08             	sub    $0x8,%esp
+  801495:	56                   	push   %esi
+  801496:	6a 00                	push   $0x0
+  801498:	e8 9d f5 ff ff       	call   800a3a <sys_page_unmap>
+  80149d:	83 c4 08             	add    $0x8,%esp
+  8014a0:	ff 75 d4             	push   -0x2c(%ebp)
+  8014a3:	6a 00                	push   $0x0
+  8014a5:	e8 90 f5 ff ff       	call   800a3a <sys_page_unmap>
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	eb b3                	jmp    801462 <dup+0x9d>
+
+008014af <read>:
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+  8014b4:	83 ec 18             	sub    $0x18,%esp
+  8014b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014bd:	50                   	push   %eax
+  8014be:	56                   	push   %esi
+  8014bf:	e8 89 fd ff ff       	call   80124d <fd_lookup>
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	78 3c                	js     801507 <read+0x58>
+  8014cb:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014ce:	83 ec 08             	sub    $0x8,%esp
+  8014d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d4:	50                   	push   %eax
+  8014d5:	ff 33                	push   (%ebx)
+  8014d7:	e8 c1 fd ff ff       	call   80129d <dev_lookup>
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 24                	js     801507 <read+0x58>
+  8014e3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014e6:	83 e0 03             	and    $0x3,%eax
+  8014e9:	83 f8 01             	cmp    $0x1,%eax
+  8014ec:	74 20                	je     80150e <read+0x5f>
+  8014ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014f1:	8b 40 08             	mov    0x8(%eax),%eax
+  8014f4:	85 c0                	test   %eax,%eax
+  8014f6:	74 37                	je     80152f <read+0x80>
+  8014f8:	83 ec 04             	sub    $0x4,%esp
+  8014fb:	ff 75 10             	push   0x10(%ebp)
+  8014fe:	ff 75 0c             	push   0xc(%ebp)
+  801501:	53                   	push   %ebx
+  801502:	ff d0                	call   *%eax
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150a:	5b                   	pop    %ebx
+  80150b:	5e                   	pop    %esi
+  80150c:	5d                   	pop    %ebp
+  80150d:	c3                   	ret
+  80150e:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  801513:	8b 40 48             	mov    0x48(%eax),%eax
+  801516:	83 ec 04             	sub    $0x4,%esp
+  801519:	56                   	push   %esi
+  80151a:	50                   	push   %eax
+  80151b:	68 e5 38 80 00       	push   $0x8038e5
+  801520:	e8 ff 15 00 00       	call   802b24 <cprintf>
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80152d:	eb d8                	jmp    801507 <read+0x58>
+  80152f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801534:	eb d1                	jmp    801507 <read+0x58>
+
+00801536 <readn>:
+  801536:	55                   	push   %ebp
+  801537:	89 e5                	mov    %esp,%ebp
+  801539:	57                   	push   %edi
+  80153a:	56                   	push   %esi
+  80153b:	53                   	push   %ebx
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+  80153f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801542:	8b 75 10             	mov    0x10(%ebp),%esi
+  801545:	85 f6                	test   %esi,%esi
+  801547:	74 30                	je     801579 <readn+0x43>
+  801549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801553:	83 ec 04             	sub    $0x4,%esp
+  801556:	89 f2                	mov    %esi,%edx
+  801558:	29 c2                	sub    %eax,%edx
+  80155a:	52                   	push   %edx
+  80155b:	01 f8                	add    %edi,%eax
+  80155d:	50                   	push   %eax
+  80155e:	ff 75 08             	push   0x8(%ebp)
+  801561:	e8 49 ff ff ff       	call   8014af <read>
+  801566:	83 c4 10             	add    $0x10,%esp
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	78 15                	js     801582 <readn+0x4c>
+  80156d:	74 11                	je     801580 <readn+0x4a>
+  80156f:	01 c3                	add    %eax,%ebx
+  801571:	89 d8                	mov    %ebx,%eax
+  801573:	39 f3                	cmp    %esi,%ebx
+  801575:	72 dc                	jb     801553 <readn+0x1d>
+  801577:	eb 09                	jmp    801582 <readn+0x4c>
+  801579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157e:	eb 02                	jmp    801582 <readn+0x4c>
+  801580:	89 d8                	mov    %ebx,%eax
+  801582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5f                   	pop    %edi
+  801588:	5d                   	pop    %ebp
+  801589:	c3                   	ret
+
+0080158a <write>:
+  80158a:	55                   	push   %ebp
+  80158b:	89 e5                	mov    %esp,%ebp
+  80158d:	56                   	push   %esi
+  80158e:	53                   	push   %ebx
+  80158f:	83 ec 18             	sub    $0x18,%esp
+  801592:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801595:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801598:	50                   	push   %eax
+  801599:	53                   	push   %ebx
+  80159a:	e8 ae fc ff ff       	call   80124d <fd_lookup>
+  80159f:	83 c4 10             	add    $0x10,%esp
+  8015a2:	85 c0                	test   %eax,%eax
+  8015a4:	78 37                	js     8015dd <write+0x53>
+  8015a6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015a9:	83 ec 08             	sub    $0x8,%esp
+  8015ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015af:	50                   	push   %eax
+  8015b0:	ff 36                	push   (%esi)
+  8015b2:	e8 e6 fc ff ff       	call   80129d <dev_lookup>
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	85 c0                	test   %eax,%eax
+  8015bc:	78 1f                	js     8015dd <write+0x53>
+  8015be:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015c2:	74 20                	je     8015e4 <write+0x5a>
+  8015c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015ca:	85 c0                	test   %eax,%eax
+  8015cc:	74 37                	je     801605 <write+0x7b>
+  8015ce:	83 ec 04             	sub    $0x4,%esp
+  8015d1:	ff 75 10             	push   0x10(%ebp)
+  8015d4:	ff 75 0c             	push   0xc(%ebp)
+  8015d7:	56                   	push   %esi
+  8015d8:	ff d0                	call   *%eax
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e0:	5b                   	pop    %ebx
+  8015e1:	5e                   	pop    %esi
+  8015e2:	5d                   	pop    %ebp
+  8015e3:	c3                   	ret
+  8015e4:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8015e9:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ec:	83 ec 04             	sub    $0x4,%esp
+  8015ef:	53                   	push   %ebx
+  8015f0:	50                   	push   %eax
+  8015f1:	68 01 39 80 00       	push   $0x803901
+  8015f6:	e8 29 15 00 00       	call   802b24 <cprintf>
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801603:	eb d8                	jmp    8015dd <write+0x53>
+  801605:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80160a:	eb d1                	jmp    8015dd <write+0x53>
+
+0080160c <seek>:
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	83 ec 20             	sub    $0x20,%esp
+  801612:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801615:	50                   	push   %eax
+  801616:	ff 75 08             	push   0x8(%ebp)
+  801619:	e8 2f fc ff ff       	call   80124d <fd_lookup>
+  80161e:	83 c4 10             	add    $0x10,%esp
+  801621:	85 c0                	test   %eax,%eax
+  801623:	78 0e                	js     801633 <seek+0x27>
+  801625:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801628:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80162b:	89 50 04             	mov    %edx,0x4(%eax)
+  80162e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+
+00801635 <ftruncate>:
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	83 ec 18             	sub    $0x18,%esp
+  80163d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801640:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801643:	50                   	push   %eax
+  801644:	53                   	push   %ebx
+  801645:	e8 03 fc ff ff       	call   80124d <fd_lookup>
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 34                	js     801685 <ftruncate+0x50>
+  801651:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801654:	83 ec 08             	sub    $0x8,%esp
+  801657:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165a:	50                   	push   %eax
+  80165b:	ff 36                	push   (%esi)
+  80165d:	e8 3b fc ff ff       	call   80129d <dev_lookup>
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 1c                	js     801685 <ftruncate+0x50>
+  801669:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80166d:	74 1d                	je     80168c <ftruncate+0x57>
+  80166f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801672:	8b 40 18             	mov    0x18(%eax),%eax
+  801675:	85 c0                	test   %eax,%eax
+  801677:	74 34                	je     8016ad <ftruncate+0x78>
+  801679:	83 ec 08             	sub    $0x8,%esp
+  80167c:	ff 75 0c             	push   0xc(%ebp)
+  80167f:	56                   	push   %esi
+  801680:	ff d0                	call   *%eax
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801688:	5b                   	pop    %ebx
+  801689:	5e                   	pop    %esi
+  80168a:	5d                   	pop    %ebp
+  80168b:	c3                   	ret
+  80168c:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  801691:	8b 40 48             	mov    0x48(%eax),%eax
+  801694:	83 ec 04             	sub    $0x4,%esp
+  801697:	53                   	push   %ebx
+  801698:	50                   	push   %eax
+  801699:	68 c4 38 80 00       	push   $0x8038c4
+  80169e:	e8 81 14 00 00       	call   802b24 <cprintf>
+  8016a3:	83 c4 10             	add    $0x10,%esp
+  8016a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ab:	eb d8                	jmp    801685 <ftruncate+0x50>
+  8016ad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016b2:	eb d1                	jmp    801685 <ftruncate+0x50>
+
+008016b4 <fstat>:
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	56                   	push   %esi
+  8016b8:	53                   	push   %ebx
+  8016b9:	83 ec 18             	sub    $0x18,%esp
+  8016bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8016bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c2:	50                   	push   %eax
+  8016c3:	ff 75 08             	push   0x8(%ebp)
+  8016c6:	e8 82 fb ff ff       	call   80124d <fd_lookup>
+  8016cb:	83 c4 10             	add    $0x10,%esp
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	78 49                	js     80171b <fstat+0x67>
+  8016d2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016d5:	83 ec 08             	sub    $0x8,%esp
+  8016d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016db:	50                   	push   %eax
+  8016dc:	ff 36                	push   (%esi)
+  8016de:	e8 ba fb ff ff       	call   80129d <dev_lookup>
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	78 31                	js     80171b <fstat+0x67>
+  8016ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ed:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016f1:	74 2f                	je     801722 <fstat+0x6e>
+  8016f3:	c6 03 00             	movb   $0x0,(%ebx)
+  8016f6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016fd:	00 00 00 
+  801700:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801707:	00 00 00 
+  80170a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801710:	83 ec 08             	sub    $0x8,%esp
+  801713:	53                   	push   %ebx
+  801714:	56                   	push   %esi
+  801715:	ff 50 14             	call   *0x14(%eax)
+  801718:	83 c4 10             	add    $0x10,%esp
+  80171b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80171e:	5b                   	pop    %ebx
+  80171f:	5e                   	pop    %esi
+  801720:	5d                   	pop    %ebp
+  801721:	c3                   	ret
+  801722:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801727:	eb f2                	jmp    80171b <fstat+0x67>
+
+00801729 <stat>:
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	56                   	push   %esi
+  80172d:	53                   	push   %ebx
+  80172e:	83 ec 08             	sub    $0x8,%esp
+  801731:	6a 00                	push   $0x0
+  801733:	ff 75 08             	push   0x8(%ebp)
+  801736:	e8 31 05 00 00       	call   801c6c <open>
+  80173b:	89 c3                	mov    %eax,%ebx
+  80173d:	83 c4 10             	add    $0x10,%esp
+  801740:	85 c0                	test   %eax,%eax
+  801742:	78 1b                	js     80175f <stat+0x36>
+  801744:	83 ec 08             	sub    $0x8,%esp
+  801747:	ff 75 0c             	push   0xc(%ebp)
+  80174a:	50                   	push   %eax
+  80174b:	e8 64 ff ff ff       	call   8016b4 <fstat>
+  801750:	89 c6                	mov    %eax,%esi
+  801752:	89 1c 24             	mov    %ebx,(%esp)
+  801755:	e8 19 fc ff ff       	call   801373 <close>
+  80175a:	83 c4 10             	add    $0x10,%esp
+  80175d:	89 f3                	mov    %esi,%ebx
+  80175f:	89 d8                	mov    %ebx,%eax
+  801761:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801764:	5b                   	pop    %ebx
+  801765:	5e                   	pop    %esi
+  801766:	5d                   	pop    %ebp
+  801767:	c3                   	ret
+
+00801768 <fsipc>:
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	56                   	push   %esi
+  80176c:	53                   	push   %ebx
+  80176d:	89 c3                	mov    %eax,%ebx
+  80176f:	89 d6                	mov    %edx,%esi
+  801771:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801778:	74 20                	je     80179a <fsipc+0x32>
+  80177a:	83 ec 08             	sub    $0x8,%esp
+  80177d:	6a 00                	push   $0x0
+  80177f:	56                   	push   %esi
+  801780:	6a 07                	push   $0x7
+  801782:	68 00 b0 83 00       	push   $0x83b000
+  801787:	53                   	push   %ebx
+  801788:	ff 35 08 50 80 00    	push   0x805008
+  80178e:	e8 f4 1a 00 00       	call   803287 <ipc_call>
+  801793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801796:	5b                   	pop    %ebx
+  801797:	5e                   	pop    %esi
+  801798:	5d                   	pop    %ebp
+  801799:	c3                   	ret
+  80179a:	83 ec 0c             	sub    $0xc,%esp
+  80179d:	6a 02                	push   $0x2
+  80179f:	e8 7e 1c 00 00       	call   803422 <ipc_find_env>
+  8017a4:	a3 08 50 80 00       	mov    %eax,0x805008
+  8017a9:	83 c4 10             	add    $0x10,%esp
+  8017ac:	eb cc                	jmp    80177a <fsipc+0x12>
+
+008017ae <devfile_trunc>:
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	83 ec 08             	sub    $0x8,%esp
+  8017b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017ba:	a3 00 b0 83 00       	mov    %eax,0x83b000
+  8017bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017c2:	a3 04 b0 83 00       	mov    %eax,0x83b004
+  8017c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017d1:	e8 92 ff ff ff       	call   801768 <fsipc>
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+
+008017d8 <devfile_flush>:
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e4:	a3 00 b0 83 00       	mov    %eax,0x83b000
+  8017e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ee:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017f3:	e8 70 ff ff ff       	call   801768 <fsipc>
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+
+008017fa <devfile_stat>:
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	53                   	push   %ebx
+  8017fe:	83 ec 04             	sub    $0x4,%esp
+  801801:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801804:	8b 45 08             	mov    0x8(%ebp),%eax
+  801807:	8b 40 0c             	mov    0xc(%eax),%eax
+  80180a:	a3 00 b0 83 00       	mov    %eax,0x83b000
+  80180f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801814:	b8 07 00 00 00       	mov    $0x7,%eax
+  801819:	e8 4a ff ff ff       	call   801768 <fsipc>
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	78 2c                	js     80184e <devfile_stat+0x54>
+  801822:	83 ec 08             	sub    $0x8,%esp
+  801825:	68 00 b0 83 00       	push   $0x83b000
+  80182a:	53                   	push   %ebx
+  80182b:	e8 d8 ec ff ff       	call   800508 <strcpy>
+  801830:	a1 80 b0 83 00       	mov    0x83b080,%eax
+  801835:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80183b:	a1 84 b0 83 00       	mov    0x83b084,%eax
+  801840:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801846:	83 c4 10             	add    $0x10,%esp
+  801849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801851:	c9                   	leave
+  801852:	c3                   	ret
+
+00801853 <fsring_rw>:
+  801853:	55                   	push   %ebp
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	57                   	push   %edi
+  801857:	56                   	push   %esi
+  801858:	53                   	push   %ebx
+  801859:	83 ec 2c             	sub    $0x2c,%esp
+  80185c:	89 c7                	mov    %eax,%edi
+  80185e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801861:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801864:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801869:	a8 01                	test   $0x1,%al
+  80186b:	74 0d                	je     80187a <fsring_rw+0x27>
+  80186d:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801872:	a8 01                	test   $0x1,%al
+  801874:	0f 85 d5 00 00 00    	jne    80194f <fsring_rw+0xfc>
+  80187a:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  80187f:	8b 40 48             	mov    0x48(%eax),%eax
+  801882:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801888:	0f 84 fc 00 00 00    	je     80198a <fsring_rw+0x137>
+  80188e:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801895:	0f 84 02 01 00 00    	je     80199d <fsring_rw+0x14a>
+  80189b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8018a0:	83 ec 04             	sub    $0x4,%esp
+  8018a3:	68 07 02 00 00       	push   $0x207
+  8018a8:	53                   	push   %ebx
+  8018a9:	6a 00                	push   $0x0
+  8018ab:	e8 b8 f0 ff ff       	call   800968 <sys_page_alloc>
+  8018b0:	83 c4 10             	add    $0x10,%esp
+  8018b3:	85 c0                	test   %eax,%eax
+  8018b5:	0f 88 f9 00 00 00    	js     8019b4 <fsring_rw+0x161>
+  8018bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018c1:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8018c7:	75 d7                	jne    8018a0 <fsring_rw+0x4d>
+  8018c9:	6a 0e                	push   $0xe
+  8018cb:	6a 0d                	push   $0xd
+  8018cd:	ff 35 08 50 80 00    	push   0x805008
+  8018d3:	68 00 00 f0 cf       	push   $0xcff00000
+  8018d8:	e8 d8 0d 00 00       	call   8026b5 <ipcring_init>
+  8018dd:	83 c4 08             	add    $0x8,%esp
+  8018e0:	6a 00                	push   $0x0
+  8018e2:	6a 00                	push   $0x0
+  8018e4:	68 07 02 00 00       	push   $0x207
+  8018e9:	68 00 00 f0 cf       	push   $0xcff00000
+  8018ee:	6a 0b                	push   $0xb
+  8018f0:	ff 35 08 50 80 00    	push   0x805008
+  8018f6:	e8 8c 19 00 00       	call   803287 <ipc_call>
+  8018fb:	89 c6                	mov    %eax,%esi
+  8018fd:	83 c4 20             	add    $0x20,%esp
+  801900:	85 c0                	test   %eax,%eax
+  801902:	0f 88 ac 00 00 00    	js     8019b4 <fsring_rw+0x161>
+  801908:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190d:	89 d9                	mov    %ebx,%ecx
+  80190f:	83 c3 01             	add    $0x1,%ebx
+  801912:	89 da                	mov    %ebx,%edx
+  801914:	c1 e2 0c             	shl    $0xc,%edx
+  801917:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80191d:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801923:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801929:	83 ec 08             	sub    $0x8,%esp
+  80192c:	6a 00                	push   $0x0
+  80192e:	6a 00                	push   $0x0
+  801930:	68 07 02 00 00       	push   $0x207
+  801935:	50                   	push   %eax
+  801936:	6a 0c                	push   $0xc
+  801938:	ff 35 08 50 80 00    	push   0x805008
+  80193e:	e8 44 19 00 00       	call   803287 <ipc_call>
+  801943:	83 c4 20             	add    $0x20,%esp
+  801946:	85 c0                	test   %eax,%eax
+  801948:	78 6a                	js     8019b4 <fsring_rw+0x161>
+  80194a:	83 fb 08             	cmp    $0x8,%ebx
+  80194d:	75 be                	jne    80190d <fsring_rw+0xba>
+  80194f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801953:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801958:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80195d:	0f 45 c2             	cmovne %edx,%eax
+  801960:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801963:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80196a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801971:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801978:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197d:	be 00 00 00 00       	mov    $0x0,%esi
+  801982:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801985:	e9 4b 01 00 00       	jmp    801ad5 <fsring_rw+0x282>
+  80198a:	e8 a3 f3 ff ff       	call   800d32 <sys_time_msec>
+  80198f:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801995:	0f 89 f3 fe ff ff    	jns    80188e <fsring_rw+0x3b>
+  80199b:	eb 54                	jmp    8019f1 <fsring_rw+0x19e>
+  80199d:	83 ec 0c             	sub    $0xc,%esp
+  8019a0:	6a 02                	push   $0x2
+  8019a2:	e8 7b 1a 00 00       	call   803422 <ipc_find_env>
+  8019a7:	a3 08 50 80 00       	mov    %eax,0x805008
+  8019ac:	83 c4 10             	add    $0x10,%esp
+  8019af:	e9 e7 fe ff ff       	jmp    80189b <fsring_rw+0x48>
+  8019b4:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8019b9:	83 ec 08             	sub    $0x8,%esp
+  8019bc:	53                   	push   %ebx
+  8019bd:	6a 00                	push   $0x0
+  8019bf:	e8 76 f0 ff ff       	call   800a3a <sys_page_unmap>
+  8019c4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8019d3:	75 e4                	jne    8019b9 <fsring_rw+0x166>
+  8019d5:	e8 58 f3 ff ff       	call   800d32 <sys_time_msec>
+  8019da:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8019df:	a3 00 50 80 00       	mov    %eax,0x805000
+  8019e4:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8019e9:	8b 40 48             	mov    0x48(%eax),%eax
+  8019ec:	a3 04 50 80 00       	mov    %eax,0x805004
+  8019f1:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8019f8:	e9 7a 01 00 00       	jmp    801b77 <fsring_rw+0x324>
+  8019fd:	8b 57 0c             	mov    0xc(%edi),%edx
+  801a00:	89 10                	mov    %edx,(%eax)
+  801a02:	89 58 04             	mov    %ebx,0x4(%eax)
+  801a05:	89 f2                	mov    %esi,%edx
+  801a07:	03 57 04             	add    0x4(%edi),%edx
+  801a0a:	89 50 08             	mov    %edx,0x8(%eax)
+  801a0d:	83 ec 04             	sub    $0x4,%esp
+  801a10:	53                   	push   %ebx
+  801a11:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801a14:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801a17:	52                   	push   %edx
+  801a18:	83 c0 0c             	add    $0xc,%eax
+  801a1b:	50                   	push   %eax
+  801a1c:	e8 97 ec ff ff       	call   8006b8 <memmove>
+  801a21:	83 c4 10             	add    $0x10,%esp
+  801a24:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a27:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a2a:	89 08                	mov    %ecx,(%eax)
+  801a2c:	83 ec 0c             	sub    $0xc,%esp
+  801a2f:	68 00 00 f0 cf       	push   $0xcff00000
+  801a34:	e8 da 0c 00 00       	call   802713 <ipcring_req_push>
+  801a39:	01 de                	add    %ebx,%esi
+  801a3b:	83 c4 10             	add    $0x10,%esp
+  801a3e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801a41:	73 4c                	jae    801a8f <fsring_rw+0x23c>
+  801a43:	83 ec 0c             	sub    $0xc,%esp
+  801a46:	68 00 00 f0 cf       	push   $0xcff00000
+  801a4b:	e8 9d 0c 00 00       	call   8026ed <ipcring_req_slot>
+  801a50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a53:	83 c4 10             	add    $0x10,%esp
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	74 35                	je     801a8f <fsring_rw+0x23c>
+  801a5a:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801a5f:	83 e0 07             	and    $0x7,%eax
+  801a62:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801a67:	c1 e0 0c             	shl    $0xc,%eax
+  801a6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a6d:	29 f3                	sub    %esi,%ebx
+  801a6f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801a72:	39 cb                	cmp    %ecx,%ebx
+  801a74:	0f 47 d9             	cmova  %ecx,%ebx
+  801a77:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801a7b:	75 80                	jne    8019fd <fsring_rw+0x1aa>
+  801a7d:	8b 57 0c             	mov    0xc(%edi),%edx
+  801a80:	89 10                	mov    %edx,(%eax)
+  801a82:	89 58 04             	mov    %ebx,0x4(%eax)
+  801a85:	89 f2                	mov    %esi,%edx
+  801a87:	03 57 04             	add    0x4(%edi),%edx
+  801a8a:	89 50 08             	mov    %edx,0x8(%eax)
+  801a8d:	eb 95                	jmp    801a24 <fsring_rw+0x1d1>
+  801a8f:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801a94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a97:	83 ec 0c             	sub    $0xc,%esp
+  801a9a:	68 00 00 f0 cf       	push   $0xcff00000
+  801a9f:	e8 a8 0c 00 00       	call   80274c <ipcring_rsp_wait>
+  801aa4:	8b 58 04             	mov    0x4(%eax),%ebx
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801aae:	75 45                	jne    801af5 <fsring_rw+0x2a2>
+  801ab0:	85 db                	test   %ebx,%ebx
+  801ab2:	79 41                	jns    801af5 <fsring_rw+0x2a2>
+  801ab4:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801ab7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801abe:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801ac5:	83 ec 0c             	sub    $0xc,%esp
+  801ac8:	68 00 00 f0 cf       	push   $0xcff00000
+  801acd:	e8 e0 0c 00 00       	call   8027b2 <ipcring_rsp_pop>
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801adb:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801ae0:	39 c2                	cmp    %eax,%edx
+  801ae2:	74 75                	je     801b59 <fsring_rw+0x306>
+  801ae4:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801ae8:	75 a5                	jne    801a8f <fsring_rw+0x23c>
+  801aea:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801aed:	0f 82 50 ff ff ff    	jb     801a43 <fsring_rw+0x1f0>
+  801af3:	eb 9a                	jmp    801a8f <fsring_rw+0x23c>
+  801af5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801af9:	75 ca                	jne    801ac5 <fsring_rw+0x272>
+  801afb:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801aff:	74 31                	je     801b32 <fsring_rw+0x2df>
+  801b01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b04:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801b07:	29 c8                	sub    %ecx,%eax
+  801b09:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801b0c:	39 d0                	cmp    %edx,%eax
+  801b0e:	0f 47 c2             	cmova  %edx,%eax
+  801b11:	39 d8                	cmp    %ebx,%eax
+  801b13:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b18:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801b1c:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801b1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b24:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801b28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801b2b:	01 d9                	add    %ebx,%ecx
+  801b2d:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801b30:	eb 93                	jmp    801ac5 <fsring_rw+0x272>
+  801b32:	83 ec 04             	sub    $0x4,%esp
+  801b35:	53                   	push   %ebx
+  801b36:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b39:	83 e0 07             	and    $0x7,%eax
+  801b3c:	c1 e0 0c             	shl    $0xc,%eax
+  801b3f:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801b45:	50                   	push   %eax
+  801b46:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801b49:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801b4c:	01 c8                	add    %ecx,%eax
+  801b4e:	50                   	push   %eax
+  801b4f:	e8 64 eb ff ff       	call   8006b8 <memmove>
+  801b54:	83 c4 10             	add    $0x10,%esp
+  801b57:	eb a8                	jmp    801b01 <fsring_rw+0x2ae>
+  801b59:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801b5d:	75 09                	jne    801b68 <fsring_rw+0x315>
+  801b5f:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801b62:	0f 82 db fe ff ff    	jb     801a43 <fsring_rw+0x1f0>
+  801b68:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801b6b:	01 57 04             	add    %edx,0x4(%edi)
+  801b6e:	85 d2                	test   %edx,%edx
+  801b70:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801b74:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801b77:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7d:	5b                   	pop    %ebx
+  801b7e:	5e                   	pop    %esi
+  801b7f:	5f                   	pop    %edi
+  801b80:	5d                   	pop    %ebp
+  801b81:	c3                   	ret
+
+00801b82 <devfile_write>:
+  801b82:	55                   	push   %ebp
+  801b83:	89 e5                	mov    %esp,%ebp
+  801b85:	57                   	push   %edi
+  801b86:	56                   	push   %esi
+  801b87:	53                   	push   %ebx
+  801b88:	83 ec 0c             	sub    $0xc,%esp
+  801b8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b94:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801b9a:	76 1a                	jbe    801bb6 <devfile_write+0x34>
+  801b9c:	83 ec 0c             	sub    $0xc,%esp
+  801b9f:	53                   	push   %ebx
+  801ba0:	89 f1                	mov    %esi,%ecx
+  801ba2:	ba 06 00 00 00       	mov    $0x6,%edx
+  801ba7:	89 f8                	mov    %edi,%eax
+  801ba9:	e8 a5 fc ff ff       	call   801853 <fsring_rw>
+  801bae:	83 c4 10             	add    $0x10,%esp
+  801bb1:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801bb4:	75 39                	jne    801bef <devfile_write+0x6d>
+  801bb6:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801bbb:	39 c3                	cmp    %eax,%ebx
+  801bbd:	0f 47 d8             	cmova  %eax,%ebx
+  801bc0:	8b 47 0c             	mov    0xc(%edi),%eax
+  801bc3:	a3 00 b0 83 00       	mov    %eax,0x83b000
+  801bc8:	89 1d 04 b0 83 00    	mov    %ebx,0x83b004
+  801bce:	83 ec 04             	sub    $0x4,%esp
+  801bd1:	53                   	push   %ebx
+  801bd2:	56                   	push   %esi
+  801bd3:	68 08 b0 83 00       	push   $0x83b008
+  801bd8:	e8 db ea ff ff       	call   8006b8 <memmove>
+  801bdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801be7:	e8 7c fb ff ff       	call   801768 <fsipc>
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf2:	5b                   	pop    %ebx
+  801bf3:	5e                   	pop    %esi
+  801bf4:	5f                   	pop    %edi
+  801bf5:	5d                   	pop    %ebp
+  801bf6:	c3                   	ret
+
+00801bf7 <devfile_read>:
+  801bf7:	55                   	push   %ebp
+  801bf8:	89 e5                	mov    %esp,%ebp
+  801bfa:	57                   	push   %edi
+  801bfb:	56                   	push   %esi
+  801bfc:	53                   	push   %ebx
+  801bfd:	83 ec 0c             	sub    $0xc,%esp
+  801c00:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c03:	8b 75 10             	mov    0x10(%ebp),%esi
+  801c06:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  801c0c:	76 1d                	jbe    801c2b <devfile_read+0x34>
+  801c0e:	83 ec 0c             	sub    $0xc,%esp
+  801c11:	56                   	push   %esi
+  801c12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c15:	ba 05 00 00 00       	mov    $0x5,%edx
+  801c1a:	89 f8                	mov    %edi,%eax
+  801c1c:	e8 32 fc ff ff       	call   801853 <fsring_rw>
+  801c21:	89 c3                	mov    %eax,%ebx
+  801c23:	83 c4 10             	add    $0x10,%esp
+  801c26:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801c29:	75 37                	jne    801c62 <devfile_read+0x6b>
+  801c2b:	8b 47 0c             	mov    0xc(%edi),%eax
+  801c2e:	a3 00 b0 83 00       	mov    %eax,0x83b000
+  801c33:	89 35 04 b0 83 00    	mov    %esi,0x83b004
+  801c39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c43:	e8 20 fb ff ff       	call   801768 <fsipc>
+  801c48:	89 c3                	mov    %eax,%ebx
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	78 14                	js     801c62 <devfile_read+0x6b>
+  801c4e:	83 ec 04             	sub    $0x4,%esp
+  801c51:	50                   	push   %eax
+  801c52:	68 00 b0 83 00       	push   $0x83b000
+  801c57:	ff 75 0c             	push   0xc(%ebp)
+  801c5a:	e8 59 ea ff ff       	call   8006b8 <memmove>
+  801c5f:	83 c4 10             	add    $0x10,%esp
+  801c62:	89 d8                	mov    %ebx,%eax
+  801c64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c67:	5b                   	pop    %ebx
+  801c68:	5e                   	pop    %esi
+  801c69:	5f                   	pop    %edi
+  801c6a:	5d                   	pop    %ebp
+  801c6b:	c3                   	ret
+
+00801c6c <open>:
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	56                   	push   %esi
+  801c70:	53                   	push   %ebx
+  801c71:	83 ec 1c             	sub    $0x1c,%esp
+  801c74:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c77:	56                   	push   %esi
+  801c78:	e8 3f e8 ff ff       	call   8004bc <strlen>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c85:	7f 6c                	jg     801cf3 <open+0x87>
+  801c87:	83 ec 0c             	sub    $0xc,%esp
+  801c8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8d:	50                   	push   %eax
+  801c8e:	e8 6a f5 ff ff       	call   8011fd <fd_alloc>
+  801c93:	89 c3                	mov    %eax,%ebx
+  801c95:	83 c4 10             	add    $0x10,%esp
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	78 3c                	js     801cd8 <open+0x6c>
+  801c9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c9f:	a3 00 b4 83 00       	mov    %eax,0x83b400
+  801ca4:	83 ec 08             	sub    $0x8,%esp
+  801ca7:	56                   	push   %esi
+  801ca8:	68 00 b0 83 00       	push   $0x83b000
+  801cad:	e8 56 e8 ff ff       	call   800508 <strcpy>
+  801cb2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cba:	e8 a9 fa ff ff       	call   801768 <fsipc>
+  801cbf:	89 c3                	mov    %eax,%ebx
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	78 19                	js     801ce1 <open+0x75>
+  801cc8:	83 ec 0c             	sub    $0xc,%esp
+  801ccb:	ff 75 f4             	push   -0xc(%ebp)
+  801cce:	e8 03 f5 ff ff       	call   8011d6 <fd2num>
+  801cd3:	89 c3                	mov    %eax,%ebx
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	89 d8                	mov    %ebx,%eax
+  801cda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cdd:	5b                   	pop    %ebx
+  801cde:	5e                   	pop    %esi
+  801cdf:	5d                   	pop    %ebp
+  801ce0:	c3                   	ret
+  801ce1:	83 ec 08             	sub    $0x8,%esp
+  801ce4:	6a 00                	push   $0x0
+  801ce6:	ff 75 f4             	push   -0xc(%ebp)
+  801ce9:	e8 05 f6 ff ff       	call   8012f3 <fd_close>
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	eb e5                	jmp    801cd8 <open+0x6c>
+  801cf3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801cf8:	eb de                	jmp    801cd8 <open+0x6c>
+
+00801cfa <file_image>:
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	53                   	push   %ebx
+  801cfe:	83 ec 1c             	sub    $0x1c,%esp
+  801d01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d07:	50                   	push   %eax
+  801d08:	ff 75 08             	push   0x8(%ebp)
+  801d0b:	e8 3d f5 ff ff       	call   80124d <fd_lookup>
+  801d10:	83 c4 10             	add    $0x10,%esp
+  801d13:	85 c0                	test   %eax,%eax
+  801d15:	78 58                	js     801d6f <file_image+0x75>
+  801d17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801d20:	39 08                	cmp    %ecx,(%eax)
+  801d22:	75 50                	jne    801d74 <file_image+0x7a>
+  801d24:	83 fb 04             	cmp    $0x4,%ebx
+  801d27:	77 52                	ja     801d7b <file_image+0x81>
+  801d29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d2c:	a3 00 b0 83 00       	mov    %eax,0x83b000
+  801d31:	89 1d 04 b0 83 00    	mov    %ebx,0x83b004
+  801d37:	83 ec 04             	sub    $0x4,%esp
+  801d3a:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  801d3d:	c1 e0 02             	shl    $0x2,%eax
+  801d40:	50                   	push   %eax
+  801d41:	ff 75 0c             	push   0xc(%ebp)
+  801d44:	68 08 b0 83 00       	push   $0x83b008
+  801d49:	e8 6a e9 ff ff       	call   8006b8 <memmove>
+  801d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d53:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d58:	e8 0b fa ff ff       	call   801768 <fsipc>
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	85 c0                	test   %eax,%eax
+  801d62:	78 0b                	js     801d6f <file_image+0x75>
+  801d64:	8b 55 14             	mov    0x14(%ebp),%edx
+  801d67:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  801d6d:	89 0a                	mov    %ecx,(%edx)
+  801d6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d72:	c9                   	leave
+  801d73:	c3                   	ret
+  801d74:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d79:	eb f4                	jmp    801d6f <file_image+0x75>
+  801d7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d80:	eb ed                	jmp    801d6f <file_image+0x75>
+
+00801d82 <remove>:
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	53                   	push   %ebx
+  801d86:	83 ec 10             	sub    $0x10,%esp
+  801d89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d8c:	53                   	push   %ebx
+  801d8d:	e8 2a e7 ff ff       	call   8004bc <strlen>
+  801d92:	83 c4 10             	add    $0x10,%esp
+  801d95:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d9a:	7f 25                	jg     801dc1 <remove+0x3f>
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+  801d9f:	53                   	push   %ebx
+  801da0:	68 00 b0 83 00       	push   $0x83b000
+  801da5:	e8 5e e7 ff ff       	call   800508 <strcpy>
+  801daa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801daf:	b8 09 00 00 00       	mov    $0x9,%eax
+  801db4:	e8 af f9 ff ff       	call   801768 <fsipc>
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dbf:	c9                   	leave
+  801dc0:	c3                   	ret
+  801dc1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801dc6:	eb f4                	jmp    801dbc <remove+0x3a>
+
+00801dc8 <sync>:
+  801dc8:	55                   	push   %ebp
+  801dc9:	89 e5                	mov    %esp,%ebp
+  801dcb:	83 ec 08             	sub    $0x8,%esp
+  801dce:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801dd8:	e8 8b f9 ff ff       	call   801768 <fsipc>
+  801ddd:	c9                   	leave
+  801dde:	c3                   	ret
+
+00801ddf <writebuf>:
+  801ddf:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801de3:	7f 01                	jg     801de6 <writebuf+0x7>
+  801de5:	c3                   	ret
+  801de6:	55                   	push   %ebp
+  801de7:	89 e5                	mov    %esp,%ebp
+  801de9:	53                   	push   %ebx
+  801dea:	83 ec 08             	sub    $0x8,%esp
+  801ded:	89 c3                	mov    %eax,%ebx
+  801def:	ff 70 04             	push   0x4(%eax)
+  801df2:	8d 40 10             	lea    0x10(%eax),%eax
+  801df5:	50                   	push   %eax
+  801df6:	ff 33                	push   (%ebx)
+  801df8:	e8 8d f7 ff ff       	call   80158a <write>
+  801dfd:	83 c4 10             	add    $0x10,%esp
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	7e 03                	jle    801e07 <writebuf+0x28>
+  801e04:	01 43 08             	add    %eax,0x8(%ebx)
+  801e07:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801e0a:	74 0d                	je     801e19 <writebuf+0x3a>
+  801e0c:	85 c0                	test   %eax,%eax
+  801e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e13:	0f 4f c2             	cmovg  %edx,%eax
+  801e16:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1c:	c9                   	leave
+  801e1d:	c3                   	ret
+
+00801e1e <putch>:
+  801e1e:	55                   	push   %ebp
+  801e1f:	89 e5                	mov    %esp,%ebp
+  801e21:	53                   	push   %ebx
+  801e22:	83 ec 04             	sub    $0x4,%esp
+  801e25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e28:	8b 53 04             	mov    0x4(%ebx),%edx
+  801e2b:	8d 42 01             	lea    0x1(%edx),%eax
+  801e2e:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e34:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  801e38:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801e3d:	74 05                	je     801e44 <putch+0x26>
+  801e3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e42:	c9                   	leave
+  801e43:	c3                   	ret
+  801e44:	89 d8                	mov    %ebx,%eax
+  801e46:	e8 94 ff ff ff       	call   801ddf <writebuf>
+  801e4b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  801e52:	eb eb                	jmp    801e3f <putch+0x21>
+
+00801e54 <vfprintf>:
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  801e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e60:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  801e66:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801e6d:	00 00 00 
+  801e70:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801e77:	00 00 00 
+  801e7a:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801e81:	00 00 00 
+  801e84:	ff 75 10             	push   0x10(%ebp)
+  801e87:	ff 75 0c             	push   0xc(%ebp)
+  801e8a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801e90:	50                   	push   %eax
+  801e91:	68 1e 1e 80 00       	push   $0x801e1e
+  801e96:	e8 88 0d 00 00       	call   802c23 <vprintfmt>
+  801e9b:	83 c4 10             	add    $0x10,%esp
+  801e9e:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801ea5:	7f 12                	jg     801eb9 <vfprintf+0x65>
+  801ea7:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801ead:	85 c0                	test   %eax,%eax
+  801eaf:	75 06                	jne    801eb7 <vfprintf+0x63>
+  801eb1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801eb7:	c9                   	leave
+  801eb8:	c3                   	ret
+  801eb9:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801ebf:	e8 1b ff ff ff       	call   801ddf <writebuf>
+  801ec4:	eb e1                	jmp    801ea7 <vfprintf+0x53>
+
+00801ec6 <fprintf>:
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	83 ec 0c             	sub    $0xc,%esp
+  801ecc:	8d 45 10             	lea    0x10(%ebp),%eax
+  801ecf:	50                   	push   %eax
+  801ed0:	ff 75 0c             	push   0xc(%ebp)
+  801ed3:	ff 75 08             	push   0x8(%ebp)
+  801ed6:	e8 79 ff ff ff       	call   801e54 <vfprintf>
+  801edb:	c9                   	leave
+  801edc:	c3                   	ret
+
+00801edd <printf>:
+  801edd:	55                   	push   %ebp
+  801ede:	89 e5                	mov    %esp,%ebp
+  801ee0:	83 ec 0c             	sub    $0xc,%esp
+  801ee3:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801ee6:	50                   	push   %eax
+  801ee7:	ff 75 08             	push   0x8(%ebp)
+  801eea:	6a 01                	push   $0x1
+  801eec:	e8 63 ff ff ff       	call   801e54 <vfprintf>
+  801ef1:	c9                   	leave
+  801ef2:	c3                   	ret
+
+00801ef3 <devsock_stat>:
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	83 ec 10             	sub    $0x10,%esp
+  801ef9:	68 34 39 80 00       	push   $0x803934
+  801efe:	ff 75 0c             	push   0xc(%ebp)
+  801f01:	e8 02 e6 ff ff       	call   800508 <strcpy>
+  801f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0b:	c9                   	leave
+  801f0c:	c3                   	ret
+
+00801f0d <devsock_close>:
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	53                   	push   %ebx
+  801f11:	83 ec 10             	sub    $0x10,%esp
+  801f14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f17:	53                   	push   %ebx
+  801f18:	e8 1f 15 00 00       	call   80343c <pageref>
+  801f1d:	89 c2                	mov    %eax,%edx
+  801f1f:	83 c4 10             	add    $0x10,%esp
+  801f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f27:	83 fa 01             	cmp    $0x1,%edx
+  801f2a:	74 05                	je     801f31 <devsock_close+0x24>
+  801f2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2f:	c9                   	leave
+  801f30:	c3                   	ret
+  801f31:	83 ec 0c             	sub    $0xc,%esp
+  801f34:	ff 73 0c             	push   0xc(%ebx)
+  801f37:	e8 aa 02 00 00       	call   8021e6 <nsipc_close>
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	eb eb                	jmp    801f2c <devsock_close+0x1f>
+
+00801f41 <devsock_write>:
+  801f41:	55                   	push   %ebp
+  801f42:	89 e5                	mov    %esp,%ebp
+  801f44:	83 ec 08             	sub    $0x8,%esp
+  801f47:	6a 00                	push   $0x0
+  801f49:	ff 75 10             	push   0x10(%ebp)
+  801f4c:	ff 75 0c             	push   0xc(%ebp)
+  801f4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f52:	ff 70 0c             	push   0xc(%eax)
+  801f55:	e8 6c 03 00 00       	call   8022c6 <nsipc_send>
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+
+00801f5c <devsock_read>:
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+  801f62:	6a 00                	push   $0x0
+  801f64:	ff 75 10             	push   0x10(%ebp)
+  801f67:	ff 75 0c             	push   0xc(%ebp)
+  801f6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6d:	ff 70 0c             	push   0xc(%eax)
+  801f70:	e8 e2 02 00 00       	call   802257 <nsipc_recv>
+  801f75:	c9                   	leave
+  801f76:	c3                   	ret
+
+00801f77 <fd2sockid>:
+  801f77:	55                   	push   %ebp
+  801f78:	89 e5                	mov    %esp,%ebp
+  801f7a:	83 ec 20             	sub    $0x20,%esp
+  801f7d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801f80:	52                   	push   %edx
+  801f81:	50                   	push   %eax
+  801f82:	e8 c6 f2 ff ff       	call   80124d <fd_lookup>
+  801f87:	83 c4 10             	add    $0x10,%esp
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 10                	js     801f9e <fd2sockid+0x27>
+  801f8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f91:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801f97:	39 08                	cmp    %ecx,(%eax)
+  801f99:	75 05                	jne    801fa0 <fd2sockid+0x29>
+  801f9b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f9e:	c9                   	leave
+  801f9f:	c3                   	ret
+  801fa0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fa5:	eb f7                	jmp    801f9e <fd2sockid+0x27>
+
+00801fa7 <alloc_sockfd>:
+  801fa7:	55                   	push   %ebp
+  801fa8:	89 e5                	mov    %esp,%ebp
+  801faa:	56                   	push   %esi
+  801fab:	53                   	push   %ebx
+  801fac:	83 ec 1c             	sub    $0x1c,%esp
+  801faf:	89 c6                	mov    %eax,%esi
+  801fb1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb4:	50                   	push   %eax
+  801fb5:	e8 43 f2 ff ff       	call   8011fd <fd_alloc>
+  801fba:	89 c3                	mov    %eax,%ebx
+  801fbc:	83 c4 10             	add    $0x10,%esp
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	78 43                	js     802006 <alloc_sockfd+0x5f>
+  801fc3:	83 ec 04             	sub    $0x4,%esp
+  801fc6:	68 07 04 00 00       	push   $0x407
+  801fcb:	ff 75 f4             	push   -0xc(%ebp)
+  801fce:	6a 00                	push   $0x0
+  801fd0:	e8 93 e9 ff ff       	call   800968 <sys_page_alloc>
+  801fd5:	89 c3                	mov    %eax,%ebx
+  801fd7:	83 c4 10             	add    $0x10,%esp
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 28                	js     802006 <alloc_sockfd+0x5f>
+  801fde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fe1:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801fe7:	89 10                	mov    %edx,(%eax)
+  801fe9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fec:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801ff3:	89 70 0c             	mov    %esi,0xc(%eax)
+  801ff6:	83 ec 0c             	sub    $0xc,%esp
+  801ff9:	50                   	push   %eax
+  801ffa:	e8 d7 f1 ff ff       	call   8011d6 <fd2num>
+  801fff:	89 c3                	mov    %eax,%ebx
+  802001:	83 c4 10             	add    $0x10,%esp
+  802004:	eb 0c                	jmp    802012 <alloc_sockfd+0x6b>
+  802006:	83 ec 0c             	sub    $0xc,%esp
+  802009:	56                   	push   %esi
+  80200a:	e8 d7 01 00 00       	call   8021e6 <nsipc_close>
+  80200f:	83 c4 10             	add    $0x10,%esp
+  802012:	89 d8                	mov    %ebx,%eax
+  802014:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802017:	5b                   	pop    %ebx
+  802018:	5e                   	pop    %esi
+  802019:	5d                   	pop    %ebp
+  80201a:	c3                   	ret
+
+0080201b <accept>:
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	83 ec 08             	sub    $0x8,%esp
+  802021:	8b 45 08             	mov    0x8(%ebp),%eax
+  802024:	e8 4e ff ff ff       	call   801f77 <fd2sockid>
+  802029:	85 c0                	test   %eax,%eax
+  80202b:	78 1b                	js     802048 <accept+0x2d>
+  80202d:	83 ec 04             	sub    $0x4,%esp
+  802030:	ff 75 10             	push   0x10(%ebp)
+  802033:	ff 75 0c             	push   0xc(%ebp)
+  802036:	50                   	push   %eax
+  802037:	e8 07 01 00 00       	call   802143 <nsipc_accept>
+  80203c:	83 c4 10             	add    $0x10,%esp
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	78 05                	js     802048 <accept+0x2d>
+  802043:	e8 5f ff ff ff       	call   801fa7 <alloc_sockfd>
+  802048:	c9                   	leave
+  802049:	c3                   	ret
+
+0080204a <bind>:
+  80204a:	55                   	push   %ebp
+  80204b:	89 e5                	mov    %esp,%ebp
+  80204d:	83 ec 08             	sub    $0x8,%esp
+  802050:	8b 45 08             	mov    0x8(%ebp),%eax
+  802053:	e8 1f ff ff ff       	call   801f77 <fd2sockid>
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 12                	js     80206e <bind+0x24>
+  80205c:	83 ec 04             	sub    $0x4,%esp
+  80205f:	ff 75 10             	push   0x10(%ebp)
+  802062:	ff 75 0c             	push   0xc(%ebp)
+  802065:	50                   	push   %eax
+  802066:	e8 24 01 00 00       	call   80218f <nsipc_bind>
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	c9                   	leave
+  80206f:	c3                   	ret
+
+00802070 <shutdown>:
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	83 ec 08             	sub    $0x8,%esp
+  802076:	8b 45 08             	mov    0x8(%ebp),%eax
+  802079:	e8 f9 fe ff ff       	call   801f77 <fd2sockid>
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	78 0f                	js     802091 <shutdown+0x21>
+  802082:	83 ec 08             	sub    $0x8,%esp
+  802085:	ff 75 0c             	push   0xc(%ebp)
+  802088:	50                   	push   %eax
+  802089:	e8 36 01 00 00       	call   8021c4 <nsipc_shutdown>
+  80208e:	83 c4 10             	add    $0x10,%esp
+  802091:	c9                   	leave
+  802092:	c3                   	ret
+
+00802093 <connect>:
+  802093:	55                   	push   %ebp
+  802094:	89 e5                	mov    %esp,%ebp
+  802096:	83 ec 08             	sub    $0x8,%esp
+  802099:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209c:	e8 d6 fe ff ff       	call   801f77 <fd2sockid>
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	78 12                	js     8020b7 <connect+0x24>
+  8020a5:	83 ec 04             	sub    $0x4,%esp
+  8020a8:	ff 75 10             	push   0x10(%ebp)
+  8020ab:	ff 75 0c             	push   0xc(%ebp)
+  8020ae:	50                   	push   %eax
+  8020af:	e8 4c 01 00 00       	call   802200 <nsipc_connect>
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	c9                   	leave
+  8020b8:	c3                   	ret
+
+008020b9 <listen>:
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	83 ec 08             	sub    $0x8,%esp
+  8020bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c2:	e8 b0 fe ff ff       	call   801f77 <fd2sockid>
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	78 0f                	js     8020da <listen+0x21>
+  8020cb:	83 ec 08             	sub    $0x8,%esp
+  8020ce:	ff 75 0c             	push   0xc(%ebp)
+  8020d1:	50                   	push   %eax
+  8020d2:	e8 5e 01 00 00       	call   802235 <nsipc_listen>
+  8020d7:	83 c4 10             	add    $0x10,%esp
+  8020da:	c9                   	leave
+  8020db:	c3                   	ret
+
+008020dc <socket>:
+  8020dc:	55                   	push   %ebp
+  8020dd:	89 e5                	mov    %esp,%ebp
+  8020df:	83 ec 0c             	sub    $0xc,%esp
+  8020e2:	ff 75 10             	push   0x10(%ebp)
+  8020e5:	ff 75 0c             	push   0xc(%ebp)
+  8020e8:	ff 75 08             	push   0x8(%ebp)
+  8020eb:	e8 34 02 00 00       	call   802324 <nsipc_socket>
+  8020f0:	83 c4 10             	add    $0x10,%esp
+  8020f3:	85 c0                	test   %eax,%eax
+  8020f5:	78 05                	js     8020fc <socket+0x20>
+  8020f7:	e8 ab fe ff ff       	call   801fa7 <alloc_sockfd>
+  8020fc:	c9                   	leave
+  8020fd:	c3                   	ret
+
+008020fe <nsipc>:
+  8020fe:	55                   	push   %ebp
+  8020ff:	89 e5                	mov    %esp,%ebp
+  802101:	53                   	push   %ebx
+  802102:	83 ec 04             	sub    $0x4,%esp
+  802105:	89 c3                	mov    %eax,%ebx
+  802107:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80210e:	74 1f                	je     80212f <nsipc+0x31>
+  802110:	83 ec 08             	sub    $0x8,%esp
+  802113:	6a 00                	push   $0x0
+  802115:	6a 00                	push   $0x0
+  802117:	6a 07                	push   $0x7
+  802119:	68 00 c0 83 00       	push   $0x83c000
+  80211e:	53                   	push   %ebx
+  80211f:	ff 35 0c 50 80 00    	push   0x80500c
+  802125:	e8 5d 11 00 00       	call   803287 <ipc_call>
+  80212a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80212d:	c9                   	leave
+  80212e:	c3                   	ret
+  80212f:	83 ec 0c             	sub    $0xc,%esp
+  802132:	6a 03                	push   $0x3
+  802134:	e8 e9 12 00 00       	call   803422 <ipc_find_env>
+  802139:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	eb cd                	jmp    802110 <nsipc+0x12>
+
+00802143 <nsipc_accept>:
+  802143:	55                   	push   %ebp
+  802144:	89 e5                	mov    %esp,%ebp
+  802146:	53                   	push   %ebx
+  802147:	83 ec 04             	sub    $0x4,%esp
+  80214a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80214d:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  802152:	b8 01 00 00 00       	mov    $0x1,%eax
+  802157:	e8 a2 ff ff ff       	call   8020fe <nsipc>
+  80215c:	89 c3                	mov    %eax,%ebx
+  80215e:	85 c0                	test   %eax,%eax
+  802160:	79 07                	jns    802169 <nsipc_accept+0x26>
+  802162:	89 d8                	mov    %ebx,%eax
+  802164:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+  802169:	83 ec 04             	sub    $0x4,%esp
+  80216c:	ff 35 10 c0 83 00    	push   0x83c010
+  802172:	68 00 c0 83 00       	push   $0x83c000
+  802177:	ff 75 0c             	push   0xc(%ebp)
+  80217a:	e8 39 e5 ff ff       	call   8006b8 <memmove>
+  80217f:	8b 15 10 c0 83 00    	mov    0x83c010,%edx
+  802185:	8b 45 10             	mov    0x10(%ebp),%eax
+  802188:	89 10                	mov    %edx,(%eax)
+  80218a:	83 c4 10             	add    $0x10,%esp
+  80218d:	eb d3                	jmp    802162 <nsipc_accept+0x1f>
+
+0080218f <nsipc_bind>:
+  80218f:	55                   	push   %ebp
+  802190:	89 e5                	mov    %esp,%ebp
+  802192:	53                   	push   %ebx
+  802193:	83 ec 08             	sub    $0x8,%esp
+  802196:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802199:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219c:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  8021a1:	53                   	push   %ebx
+  8021a2:	ff 75 0c             	push   0xc(%ebp)
+  8021a5:	68 04 c0 83 00       	push   $0x83c004
+  8021aa:	e8 09 e5 ff ff       	call   8006b8 <memmove>
+  8021af:	89 1d 14 c0 83 00    	mov    %ebx,0x83c014
+  8021b5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021ba:	e8 3f ff ff ff       	call   8020fe <nsipc>
+  8021bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021c2:	c9                   	leave
+  8021c3:	c3                   	ret
+
+008021c4 <nsipc_shutdown>:
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+  8021ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021cd:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  8021d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021d5:	a3 04 c0 83 00       	mov    %eax,0x83c004
+  8021da:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021df:	e8 1a ff ff ff       	call   8020fe <nsipc>
+  8021e4:	c9                   	leave
+  8021e5:	c3                   	ret
+
+008021e6 <nsipc_close>:
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	83 ec 08             	sub    $0x8,%esp
+  8021ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ef:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  8021f4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021f9:	e8 00 ff ff ff       	call   8020fe <nsipc>
+  8021fe:	c9                   	leave
+  8021ff:	c3                   	ret
+
+00802200 <nsipc_connect>:
+  802200:	55                   	push   %ebp
+  802201:	89 e5                	mov    %esp,%ebp
+  802203:	53                   	push   %ebx
+  802204:	83 ec 08             	sub    $0x8,%esp
+  802207:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80220a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220d:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  802212:	53                   	push   %ebx
+  802213:	ff 75 0c             	push   0xc(%ebp)
+  802216:	68 04 c0 83 00       	push   $0x83c004
+  80221b:	e8 98 e4 ff ff       	call   8006b8 <memmove>
+  802220:	89 1d 14 c0 83 00    	mov    %ebx,0x83c014
+  802226:	b8 05 00 00 00       	mov    $0x5,%eax
+  80222b:	e8 ce fe ff ff       	call   8020fe <nsipc>
+  802230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802233:	c9                   	leave
+  802234:	c3                   	ret
+
+00802235 <nsipc_listen>:
+  802235:	55                   	push   %ebp
+  802236:	89 e5                	mov    %esp,%ebp
+  802238:	83 ec 08             	sub    $0x8,%esp
+  80223b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223e:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  802243:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802246:	a3 04 c0 83 00       	mov    %eax,0x83c004
+  80224b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802250:	e8 a9 fe ff ff       	call   8020fe <nsipc>
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+
+00802257 <nsipc_recv>:
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	56                   	push   %esi
+  80225b:	53                   	push   %ebx
+  80225c:	8b 75 10             	mov    0x10(%ebp),%esi
+  80225f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802262:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  802267:	89 35 04 c0 83 00    	mov    %esi,0x83c004
+  80226d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802270:	a3 08 c0 83 00       	mov    %eax,0x83c008
+  802275:	b8 07 00 00 00       	mov    $0x7,%eax
+  80227a:	e8 7f fe ff ff       	call   8020fe <nsipc>
+  80227f:	89 c3                	mov    %eax,%ebx
+  802281:	85 c0                	test   %eax,%eax
+  802283:	78 22                	js     8022a7 <nsipc_recv+0x50>
+  802285:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80228a:	39 c6                	cmp    %eax,%esi
+  80228c:	0f 4e c6             	cmovle %esi,%eax
+  80228f:	39 c3                	cmp    %eax,%ebx
+  802291:	7f 1d                	jg     8022b0 <nsipc_recv+0x59>
+  802293:	83 ec 04             	sub    $0x4,%esp
+  802296:	53                   	push   %ebx
+  802297:	68 00 c0 83 00       	push   $0x83c000
+  80229c:	ff 75 0c             	push   0xc(%ebp)
+  80229f:	e8 14 e4 ff ff       	call   8006b8 <memmove>
+  8022a4:	83 c4 10             	add    $0x10,%esp
+  8022a7:	89 d8                	mov    %ebx,%eax
+  8022a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ac:	5b                   	pop    %ebx
+  8022ad:	5e                   	pop    %esi
+  8022ae:	5d                   	pop    %ebp
+  8022af:	c3                   	ret
+  8022b0:	68 40 39 80 00       	push   $0x803940
+  8022b5:	68 55 39 80 00       	push   $0x803955
+  8022ba:	6a 60                	push   $0x60
+  8022bc:	68 6a 39 80 00       	push   $0x80396a
+  8022c1:	e8 83 07 00 00       	call   802a49 <_panic>
+
+008022c6 <nsipc_send>:
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	53                   	push   %ebx
+  8022ca:	83 ec 04             	sub    $0x4,%esp
+  8022cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8022d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d3:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  8022d8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8022de:	7f 2e                	jg     80230e <nsipc_send+0x48>
+  8022e0:	83 ec 04             	sub    $0x4,%esp
+  8022e3:	53                   	push   %ebx
+  8022e4:	ff 75 0c             	push   0xc(%ebp)
+  8022e7:	68 0c c0 83 00       	push   $0x83c00c
+  8022ec:	e8 c7 e3 ff ff       	call   8006b8 <memmove>
+  8022f1:	89 1d 04 c0 83 00    	mov    %ebx,0x83c004
+  8022f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022fa:	a3 08 c0 83 00       	mov    %eax,0x83c008
+  8022ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  802304:	e8 f5 fd ff ff       	call   8020fe <nsipc>
+  802309:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80230c:	c9                   	leave
+  80230d:	c3                   	ret
+  80230e:	68 76 39 80 00       	push   $0x803976
+  802313:	68 55 39 80 00       	push   $0x803955
+  802318:	6a 6b                	push   $0x6b
+  80231a:	68 6a 39 80 00       	push   $0x80396a
+  80231f:	e8 25 07 00 00       	call   802a49 <_panic>
+
+00802324 <nsipc_socket>:
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	83 ec 08             	sub    $0x8,%esp
+  80232a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232d:	a3 00 c0 83 00       	mov    %eax,0x83c000
+  802332:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802335:	a3 04 c0 83 00       	mov    %eax,0x83c004
+  80233a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80233d:	a3 08 c0 83 00       	mov    %eax,0x83c008
+  802342:	b8 09 00 00 00       	mov    $0x9,%eax
+  802347:	e8 b2 fd ff ff       	call   8020fe <nsipc>
+  80234c:	c9                   	leave
+  80234d:	c3                   	ret
+
+0080234e <devpipe_stat>:
+  80234e:	55                   	push   %ebp
+  80234f:	89 e5                	mov    %esp,%ebp
+  802351:	56                   	push   %esi
+  802352:	53                   	push   %ebx
+  802353:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802356:	83 ec 0c             	sub    $0xc,%esp
+  802359:	ff 75 08             	push   0x8(%ebp)
+  80235c:	e8 85 ee ff ff       	call   8011e6 <fd2data>
+  802361:	89 c6                	mov    %eax,%esi
+  802363:	83 c4 08             	add    $0x8,%esp
+  802366:	68 82 39 80 00       	push   $0x803982
+  80236b:	53                   	push   %ebx
+  80236c:	e8 97 e1 ff ff       	call   800508 <strcpy>
+  802371:	8b 46 04             	mov    0x4(%esi),%eax
+  802374:	2b 06                	sub    (%esi),%eax
+  802376:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80237c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802383:	00 00 00 
+  802386:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80238d:	40 80 00 
+  802390:	b8 00 00 00 00       	mov    $0x0,%eax
+  802395:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802398:	5b                   	pop    %ebx
+  802399:	5e                   	pop    %esi
+  80239a:	5d                   	pop    %ebp
+  80239b:	c3                   	ret
+
+0080239c <devpipe_close>:
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+  80239f:	53                   	push   %ebx
+  8023a0:	83 ec 0c             	sub    $0xc,%esp
+  8023a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023a6:	53                   	push   %ebx
+  8023a7:	6a 00                	push   $0x0
+  8023a9:	e8 8c e6 ff ff       	call   800a3a <sys_page_unmap>
+  8023ae:	89 1c 24             	mov    %ebx,(%esp)
+  8023b1:	e8 30 ee ff ff       	call   8011e6 <fd2data>
+  8023b6:	83 c4 08             	add    $0x8,%esp
+  8023b9:	50                   	push   %eax
+  8023ba:	6a 00                	push   $0x0
+  8023bc:	e8 79 e6 ff ff       	call   800a3a <sys_page_unmap>
+  8023c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023c4:	c9                   	leave
+  8023c5:	c3                   	ret
+
+008023c6 <_pipeisclosed>:
+  8023c6:	55                   	push   %ebp
+  8023c7:	89 e5                	mov    %esp,%ebp
+  8023c9:	57                   	push   %edi
+  8023ca:	56                   	push   %esi
+  8023cb:	53                   	push   %ebx
+  8023cc:	83 ec 1c             	sub    $0x1c,%esp
+  8023cf:	89 c7                	mov    %eax,%edi
+  8023d1:	89 d6                	mov    %edx,%esi
+  8023d3:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8023d8:	8b 58 58             	mov    0x58(%eax),%ebx
+  8023db:	83 ec 0c             	sub    $0xc,%esp
+  8023de:	57                   	push   %edi
+  8023df:	e8 58 10 00 00       	call   80343c <pageref>
+  8023e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023e7:	89 34 24             	mov    %esi,(%esp)
+  8023ea:	e8 4d 10 00 00       	call   80343c <pageref>
+  8023ef:	8b 15 20 a0 83 00    	mov    0x83a020,%edx
+  8023f5:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	39 cb                	cmp    %ecx,%ebx
+  8023fd:	74 1b                	je     80241a <_pipeisclosed+0x54>
+  8023ff:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802402:	75 cf                	jne    8023d3 <_pipeisclosed+0xd>
+  802404:	8b 42 58             	mov    0x58(%edx),%eax
+  802407:	6a 01                	push   $0x1
+  802409:	50                   	push   %eax
+  80240a:	53                   	push   %ebx
+  80240b:	68 89 39 80 00       	push   $0x803989
+  802410:	e8 0f 07 00 00       	call   802b24 <cprintf>
+  802415:	83 c4 10             	add    $0x10,%esp
+  802418:	eb b9                	jmp    8023d3 <_pipeisclosed+0xd>
+  80241a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80241d:	0f 94 c0             	sete   %al
+  802420:	0f b6 c0             	movzbl %al,%eax
+  802423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802426:	5b                   	pop    %ebx
+  802427:	5e                   	pop    %esi
+  802428:	5f                   	pop    %edi
+  802429:	5d                   	pop    %ebp
+  80242a:	c3                   	ret
+
+0080242b <devpipe_write>:
+  80242b:	55                   	push   %ebp
+  80242c:	89 e5                	mov    %esp,%ebp
+  80242e:	57                   	push   %edi
+  80242f:	56                   	push   %esi
+  802430:	53                   	push   %ebx
+  802431:	83 ec 28             	sub    $0x28,%esp
+  802434:	8b 75 08             	mov    0x8(%ebp),%esi
+  802437:	56                   	push   %esi
+  802438:	e8 a9 ed ff ff       	call   8011e6 <fd2data>
+  80243d:	89 c3                	mov    %eax,%ebx
+  80243f:	83 c4 10             	add    $0x10,%esp
+  802442:	bf 00 00 00 00       	mov    $0x0,%edi
+  802447:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80244b:	74 5c                	je     8024a9 <devpipe_write+0x7e>
+  80244d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802450:	8b 0b                	mov    (%ebx),%ecx
+  802452:	8d 51 20             	lea    0x20(%ecx),%edx
+  802455:	39 d0                	cmp    %edx,%eax
+  802457:	72 1e                	jb     802477 <devpipe_write+0x4c>
+  802459:	89 da                	mov    %ebx,%edx
+  80245b:	89 f0                	mov    %esi,%eax
+  80245d:	e8 64 ff ff ff       	call   8023c6 <_pipeisclosed>
+  802462:	85 c0                	test   %eax,%eax
+  802464:	75 48                	jne    8024ae <devpipe_write+0x83>
+  802466:	e8 b2 e4 ff ff       	call   80091d <sys_yield>
+  80246b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80246e:	8b 0b                	mov    (%ebx),%ecx
+  802470:	8d 51 20             	lea    0x20(%ecx),%edx
+  802473:	39 d0                	cmp    %edx,%eax
+  802475:	73 e2                	jae    802459 <devpipe_write+0x2e>
+  802477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80247a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80247e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802481:	89 c2                	mov    %eax,%edx
+  802483:	c1 fa 1f             	sar    $0x1f,%edx
+  802486:	89 d1                	mov    %edx,%ecx
+  802488:	c1 e9 1b             	shr    $0x1b,%ecx
+  80248b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80248e:	83 e2 1f             	and    $0x1f,%edx
+  802491:	29 ca                	sub    %ecx,%edx
+  802493:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802497:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80249b:	83 c0 01             	add    $0x1,%eax
+  80249e:	89 43 04             	mov    %eax,0x4(%ebx)
+  8024a1:	83 c7 01             	add    $0x1,%edi
+  8024a4:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8024a7:	75 a4                	jne    80244d <devpipe_write+0x22>
+  8024a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024ac:	eb 05                	jmp    8024b3 <devpipe_write+0x88>
+  8024ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024b6:	5b                   	pop    %ebx
+  8024b7:	5e                   	pop    %esi
+  8024b8:	5f                   	pop    %edi
+  8024b9:	5d                   	pop    %ebp
+  8024ba:	c3                   	ret
+
+008024bb <devpipe_read>:
+  8024bb:	55                   	push   %ebp
+  8024bc:	89 e5                	mov    %esp,%ebp
+  8024be:	57                   	push   %edi
+  8024bf:	56                   	push   %esi
+  8024c0:	53                   	push   %ebx
+  8024c1:	83 ec 18             	sub    $0x18,%esp
+  8024c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024c7:	56                   	push   %esi
+  8024c8:	e8 19 ed ff ff       	call   8011e6 <fd2data>
+  8024cd:	89 c3                	mov    %eax,%ebx
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8024db:	74 45                	je     802522 <devpipe_read+0x67>
+  8024dd:	8b 03                	mov    (%ebx),%eax
+  8024df:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8024e2:	75 1d                	jne    802501 <devpipe_read+0x46>
+  8024e4:	85 ff                	test   %edi,%edi
+  8024e6:	75 3f                	jne    802527 <devpipe_read+0x6c>
+  8024e8:	89 da                	mov    %ebx,%edx
+  8024ea:	89 f0                	mov    %esi,%eax
+  8024ec:	e8 d5 fe ff ff       	call   8023c6 <_pipeisclosed>
+  8024f1:	85 c0                	test   %eax,%eax
+  8024f3:	75 3c                	jne    802531 <devpipe_read+0x76>
+  8024f5:	e8 23 e4 ff ff       	call   80091d <sys_yield>
+  8024fa:	8b 03                	mov    (%ebx),%eax
+  8024fc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8024ff:	74 e7                	je     8024e8 <devpipe_read+0x2d>
+  802501:	99                   	cltd
+  802502:	c1 ea 1b             	shr    $0x1b,%edx
+  802505:	01 d0                	add    %edx,%eax
+  802507:	83 e0 1f             	and    $0x1f,%eax
+  80250a:	29 d0                	sub    %edx,%eax
+  80250c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802511:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802514:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802517:	83 03 01             	addl   $0x1,(%ebx)
+  80251a:	83 c7 01             	add    $0x1,%edi
+  80251d:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802520:	75 bb                	jne    8024dd <devpipe_read+0x22>
+  802522:	8b 45 10             	mov    0x10(%ebp),%eax
+  802525:	eb 02                	jmp    802529 <devpipe_read+0x6e>
+  802527:	89 f8                	mov    %edi,%eax
+  802529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80252c:	5b                   	pop    %ebx
+  80252d:	5e                   	pop    %esi
+  80252e:	5f                   	pop    %edi
+  80252f:	5d                   	pop    %ebp
+  802530:	c3                   	ret
+  802531:	b8 00 00 00 00       	mov    $0x0,%eax
+  802536:	eb f1                	jmp    802529 <devpipe_read+0x6e>
+
+00802538 <pipe>:
+  802538:	55                   	push   %ebp
+  802539:	89 e5                	mov    %esp,%ebp
+  80253b:	56                   	push   %esi
+  80253c:	53                   	push   %ebx
+  80253d:	83 ec 1c             	sub    $0x1c,%esp
+  802540:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802543:	50                   	push   %eax
+  802544:	e8 b4 ec ff ff       	call   8011fd <fd_alloc>
+  802549:	89 c3                	mov    %eax,%ebx
+  80254b:	83 c4 10             	add    $0x10,%esp
+  80254e:	85 c0                	test   %eax,%eax
+  802550:	0f 88 23 01 00 00    	js     802679 <pipe+0x141>
+  802556:	83 ec 04             	sub    $0x4,%esp
+  802559:	68 07 04 00 00       	push   $0x407
+  80255e:	ff 75 f4             	push   -0xc(%ebp)
+  802561:	6a 00                	push   $0x0
+  802563:	e8 00 e4 ff ff       	call   800968 <sys_page_alloc>
+  802568:	89 c3                	mov    %eax,%ebx
+  80256a:	83 c4 10             	add    $0x10,%esp
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	0f 88 04 01 00 00    	js     802679 <pipe+0x141>
+  802575:	83 ec 0c             	sub    $0xc,%esp
+  802578:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80257b:	50                   	push   %eax
+  80257c:	e8 7c ec ff ff       	call   8011fd <fd_alloc>
+  802581:	89 c3                	mov    %eax,%ebx
+  802583:	83 c4 10             	add    $0x10,%esp
+  802586:	85 c0                	test   %eax,%eax
+  802588:	0f 88 db 00 00 00    	js     802669 <pipe+0x131>
+  80258e:	83 ec 04             	sub    $0x4,%esp
+  802591:	68 07 04 00 00       	push   $0x407
+  802596:	ff 75 f0             	push   -0x10(%ebp)
+  802599:	6a 00                	push   $0x0
+  80259b:	e8 c8 e3 ff ff       	call   800968 <sys_page_alloc>
+  8025a0:	89 c3                	mov    %eax,%ebx
+  8025a2:	83 c4 10             	add    $0x10,%esp
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	0f 88 bc 00 00 00    	js     802669 <pipe+0x131>
+  8025ad:	83 ec 0c             	sub    $0xc,%esp
+  8025b0:	ff 75 f4             	push   -0xc(%ebp)
+  8025b3:	e8 2e ec ff ff       	call   8011e6 <fd2data>
+  8025b8:	89 c6                	mov    %eax,%esi
+  8025ba:	83 c4 0c             	add    $0xc,%esp
+  8025bd:	68 07 04 00 00       	push   $0x407
+  8025c2:	50                   	push   %eax
+  8025c3:	6a 00                	push   $0x0
+  8025c5:	e8 9e e3 ff ff       	call   800968 <sys_page_alloc>
+  8025ca:	89 c3                	mov    %eax,%ebx
+  8025cc:	83 c4 10             	add    $0x10,%esp
+  8025cf:	85 c0                	test   %eax,%eax
+  8025d1:	0f 88 82 00 00 00    	js     802659 <pipe+0x121>
+  8025d7:	83 ec 0c             	sub    $0xc,%esp
+  8025da:	ff 75 f0             	push   -0x10(%ebp)
+  8025dd:	e8 04 ec ff ff       	call   8011e6 <fd2data>
+  8025e2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025e9:	50                   	push   %eax
+  8025ea:	6a 00                	push   $0x0
+  8025ec:	56                   	push   %esi
+  8025ed:	6a 00                	push   $0x0
+  8025ef:	e8 b7 e3 ff ff       	call   8009ab <sys_page_map>
+  8025f4:	89 c3                	mov    %eax,%ebx
+  8025f6:	83 c4 20             	add    $0x20,%esp
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	78 4e                	js     80264b <pipe+0x113>
+  8025fd:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802602:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802605:	89 02                	mov    %eax,(%edx)
+  802607:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80260a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802611:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802614:	89 02                	mov    %eax,(%edx)
+  802616:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802619:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802620:	83 ec 0c             	sub    $0xc,%esp
+  802623:	ff 75 f4             	push   -0xc(%ebp)
+  802626:	e8 ab eb ff ff       	call   8011d6 <fd2num>
+  80262b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80262e:	89 01                	mov    %eax,(%ecx)
+  802630:	83 c4 04             	add    $0x4,%esp
+  802633:	ff 75 f0             	push   -0x10(%ebp)
+  802636:	e8 9b eb ff ff       	call   8011d6 <fd2num>
+  80263b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80263e:	89 41 04             	mov    %eax,0x4(%ecx)
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802649:	eb 2e                	jmp    802679 <pipe+0x141>
+  80264b:	83 ec 08             	sub    $0x8,%esp
+  80264e:	56                   	push   %esi
+  80264f:	6a 00                	push   $0x0
+  802651:	e8 e4 e3 ff ff       	call   800a3a <sys_page_unmap>
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	83 ec 08             	sub    $0x8,%esp
+  80265c:	ff 75 f0             	push   -0x10(%ebp)
+  80265f:	6a 00                	push   $0x0
+  802661:	e8 d4 e3 ff ff       	call   800a3a <sys_page_unmap>
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	83 ec 08             	sub    $0x8,%esp
+  80266c:	ff 75 f4             	push   -0xc(%ebp)
+  80266f:	6a 00                	push   $0x0
+  802671:	e8 c4 e3 ff ff       	call   800a3a <sys_page_unmap>
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	89 d8                	mov    %ebx,%eax
+  80267b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80267e:	5b                   	pop    %ebx
+  80267f:	5e                   	pop    %esi
+  802680:	5d                   	pop    %ebp
+  802681:	c3                   	ret
+
+00802682 <pipeisclosed>:
+  802682:	55                   	push   %ebp
+  802683:	89 e5                	mov    %esp,%ebp
+  802685:	83 ec 20             	sub    $0x20,%esp
+  802688:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80268b:	50                   	push   %eax
+  80268c:	ff 75 08             	push   0x8(%ebp)
+  80268f:	e8 b9 eb ff ff       	call   80124d <fd_lookup>
+  802694:	83 c4 10             	add    $0x10,%esp
+  802697:	85 c0                	test   %eax,%eax
+  802699:	78 18                	js     8026b3 <pipeisclosed+0x31>
+  80269b:	83 ec 0c             	sub    $0xc,%esp
+  80269e:	ff 75 f4             	push   -0xc(%ebp)
+  8026a1:	e8 40 eb ff ff       	call   8011e6 <fd2data>
+  8026a6:	89 c2                	mov    %eax,%edx
+  8026a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ab:	e8 16 fd ff ff       	call   8023c6 <_pipeisclosed>
+  8026b0:	83 c4 10             	add    $0x10,%esp
+  8026b3:	c9                   	leave
+  8026b4:	c3                   	ret
+
+008026b5 <ipcring_init>:
+  8026b5:	55                   	push   %ebp
+  8026b6:	89 e5                	mov    %esp,%ebp
+  8026b8:	53                   	push   %ebx
+  8026b9:	83 ec 08             	sub    $0x8,%esp
+  8026bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026bf:	6a 60                	push   $0x60
+  8026c1:	6a 00                	push   $0x0
+  8026c3:	53                   	push   %ebx
+  8026c4:	e8 ba df ff ff       	call   800683 <memset>
+  8026c9:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8026ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8026d1:	89 03                	mov    %eax,(%ebx)
+  8026d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026d6:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026dc:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026e2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026eb:	c9                   	leave
+  8026ec:	c3                   	ret
+
+008026ed <ipcring_req_slot>:
+  8026ed:	55                   	push   %ebp
+  8026ee:	89 e5                	mov    %esp,%ebp
+  8026f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f3:	8b 50 10             	mov    0x10(%eax),%edx
+  8026f6:	8b 48 18             	mov    0x18(%eax),%ecx
+  8026f9:	29 ca                	sub    %ecx,%edx
+  8026fb:	83 fa 07             	cmp    $0x7,%edx
+  8026fe:	77 0c                	ja     80270c <ipcring_req_slot+0x1f>
+  802700:	8b 50 10             	mov    0x10(%eax),%edx
+  802703:	83 e2 07             	and    $0x7,%edx
+  802706:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80270a:	5d                   	pop    %ebp
+  80270b:	c3                   	ret
+  80270c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802711:	eb f7                	jmp    80270a <ipcring_req_slot+0x1d>
+
+00802713 <ipcring_req_push>:
+  802713:	55                   	push   %ebp
+  802714:	89 e5                	mov    %esp,%ebp
+  802716:	83 ec 08             	sub    $0x8,%esp
+  802719:	8b 55 08             	mov    0x8(%ebp),%edx
+  80271c:	8b 42 10             	mov    0x10(%edx),%eax
+  80271f:	83 c0 01             	add    $0x1,%eax
+  802722:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272b:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	75 02                	jne    802735 <ipcring_req_push+0x22>
+  802733:	c9                   	leave
+  802734:	c3                   	ret
+  802735:	6a 00                	push   $0x0
+  802737:	68 00 00 80 ee       	push   $0xee800000
+  80273c:	ff 72 08             	push   0x8(%edx)
+  80273f:	ff 72 04             	push   0x4(%edx)
+  802742:	e8 59 e5 ff ff       	call   800ca0 <sys_ipc_send>
+  802747:	83 c4 10             	add    $0x10,%esp
+  80274a:	eb e7                	jmp    802733 <ipcring_req_push+0x20>
+
+0080274c <ipcring_rsp_wait>:
+  80274c:	55                   	push   %ebp
+  80274d:	89 e5                	mov    %esp,%ebp
+  80274f:	53                   	push   %ebx
+  802750:	83 ec 04             	sub    $0x4,%esp
+  802753:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802756:	8b 53 18             	mov    0x18(%ebx),%edx
+  802759:	8b 43 10             	mov    0x10(%ebx),%eax
+  80275c:	39 c2                	cmp    %eax,%edx
+  80275e:	74 3c                	je     80279c <ipcring_rsp_wait+0x50>
+  802760:	8b 53 14             	mov    0x14(%ebx),%edx
+  802763:	8b 43 18             	mov    0x18(%ebx),%eax
+  802766:	39 c2                	cmp    %eax,%edx
+  802768:	75 23                	jne    80278d <ipcring_rsp_wait+0x41>
+  80276a:	83 ec 08             	sub    $0x8,%esp
+  80276d:	6a 00                	push   $0x0
+  80276f:	6a 00                	push   $0x0
+  802771:	6a 00                	push   $0x0
+  802773:	6a 00                	push   $0x0
+  802775:	ff 73 0c             	push   0xc(%ebx)
+  802778:	ff 73 04             	push   0x4(%ebx)
+  80277b:	e8 07 0b 00 00       	call   803287 <ipc_call>
+  802780:	8b 53 14             	mov    0x14(%ebx),%edx
+  802783:	8b 43 18             	mov    0x18(%ebx),%eax
+  802786:	83 c4 20             	add    $0x20,%esp
+  802789:	39 c2                	cmp    %eax,%edx
+  80278b:	74 dd                	je     80276a <ipcring_rsp_wait+0x1e>
+  80278d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802790:	83 e0 07             	and    $0x7,%eax
+  802793:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802797:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+  80279c:	68 a4 39 80 00       	push   $0x8039a4
+  8027a1:	68 55 39 80 00       	push   $0x803955
+  8027a6:	6a 3b                	push   $0x3b
+  8027a8:	68 c5 39 80 00       	push   $0x8039c5
+  8027ad:	e8 97 02 00 00       	call   802a49 <_panic>
+
+008027b2 <ipcring_rsp_pop>:
+  8027b2:	55                   	push   %ebp
+  8027b3:	89 e5                	mov    %esp,%ebp
+  8027b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027b8:	8b 42 18             	mov    0x18(%edx),%eax
+  8027bb:	83 c0 01             	add    $0x1,%eax
+  8027be:	89 42 18             	mov    %eax,0x18(%edx)
+  8027c1:	5d                   	pop    %ebp
+  8027c2:	c3                   	ret
+
+008027c3 <ipcring_server_init>:
+  8027c3:	55                   	push   %ebp
+  8027c4:	89 e5                	mov    %esp,%ebp
+  8027c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027cc:	89 10                	mov    %edx,(%eax)
+  8027ce:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027d1:	89 50 04             	mov    %edx,0x4(%eax)
+  8027d4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  8027db:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8027e2:	5d                   	pop    %ebp
+  8027e3:	c3                   	ret
+
+008027e4 <ipcring_req_avail>:
+  8027e4:	55                   	push   %ebp
+  8027e5:	89 e5                	mov    %esp,%ebp
+  8027e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027ea:	8b 02                	mov    (%edx),%eax
+  8027ec:	8b 40 10             	mov    0x10(%eax),%eax
+  8027ef:	2b 42 08             	sub    0x8(%edx),%eax
+  8027f2:	ba 08 00 00 00       	mov    $0x8,%edx
+  8027f7:	39 d0                	cmp    %edx,%eax
+  8027f9:	0f 47 c2             	cmova  %edx,%eax
+  8027fc:	5d                   	pop    %ebp
+  8027fd:	c3                   	ret
+
+008027fe <ipcring_req_peek>:
+  8027fe:	55                   	push   %ebp
+  8027ff:	89 e5                	mov    %esp,%ebp
+  802801:	8b 55 08             	mov    0x8(%ebp),%edx
+  802804:	8b 42 08             	mov    0x8(%edx),%eax
+  802807:	83 e0 07             	and    $0x7,%eax
+  80280a:	8b 12                	mov    (%edx),%edx
+  80280c:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802810:	5d                   	pop    %ebp
+  802811:	c3                   	ret
+
+00802812 <ipcring_rsp_push>:
+  802812:	55                   	push   %ebp
+  802813:	89 e5                	mov    %esp,%ebp
+  802815:	83 ec 08             	sub    $0x8,%esp
+  802818:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80281b:	8b 41 08             	mov    0x8(%ecx),%eax
+  80281e:	83 c0 01             	add    $0x1,%eax
+  802821:	89 41 08             	mov    %eax,0x8(%ecx)
+  802824:	8b 11                	mov    (%ecx),%edx
+  802826:	83 c2 14             	add    $0x14,%edx
+  802829:	f0 87 02             	lock xchg %eax,(%edx)
+  80282c:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802830:	75 02                	jne    802834 <ipcring_rsp_push+0x22>
+  802832:	c9                   	leave
+  802833:	c3                   	ret
+  802834:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80283b:	6a 00                	push   $0x0
+  80283d:	68 00 00 80 ee       	push   $0xee800000
+  802842:	6a 00                	push   $0x0
+  802844:	ff 71 04             	push   0x4(%ecx)
+  802847:	e8 77 e3 ff ff       	call   800bc3 <sys_ipc_try_send>
+  80284c:	83 c4 10             	add    $0x10,%esp
+  80284f:	eb e1                	jmp    802832 <ipcring_rsp_push+0x20>
+
+00802851 <ipcring_client_wait>:
+  802851:	55                   	push   %ebp
+  802852:	89 e5                	mov    %esp,%ebp
+  802854:	83 ec 08             	sub    $0x8,%esp
+  802857:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285a:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802861:	8b 10                	mov    (%eax),%edx
+  802863:	8b 52 18             	mov    0x18(%edx),%edx
+  802866:	3b 50 08             	cmp    0x8(%eax),%edx
+  802869:	75 02                	jne    80286d <ipcring_client_wait+0x1c>
+  80286b:	c9                   	leave
+  80286c:	c3                   	ret
+  80286d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802874:	6a 00                	push   $0x0
+  802876:	68 00 00 80 ee       	push   $0xee800000
+  80287b:	6a 00                	push   $0x0
+  80287d:	ff 70 04             	push   0x4(%eax)
+  802880:	e8 3e e3 ff ff       	call   800bc3 <sys_ipc_try_send>
+  802885:	83 c4 10             	add    $0x10,%esp
+  802888:	eb e1                	jmp    80286b <ipcring_client_wait+0x1a>
+
+0080288a <ipcring_server_sleep>:
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	53                   	push   %ebx
+  80288e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802891:	8b 01                	mov    (%ecx),%eax
+  802893:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802896:	b8 01 00 00 00       	mov    $0x1,%eax
+  80289b:	f0 87 02             	lock xchg %eax,(%edx)
+  80289e:	8b 11                	mov    (%ecx),%edx
+  8028a0:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8028a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028a8:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8028ab:	74 0e                	je     8028bb <ipcring_server_sleep+0x31>
+  8028ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b2:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8028b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028be:	c9                   	leave
+  8028bf:	c3                   	ret
+
+008028c0 <devcons_close>:
+  8028c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c5:	c3                   	ret
+
+008028c6 <devcons_stat>:
+  8028c6:	55                   	push   %ebp
+  8028c7:	89 e5                	mov    %esp,%ebp
+  8028c9:	83 ec 10             	sub    $0x10,%esp
+  8028cc:	68 d3 39 80 00       	push   $0x8039d3
+  8028d1:	ff 75 0c             	push   0xc(%ebp)
+  8028d4:	e8 2f dc ff ff       	call   800508 <strcpy>
+  8028d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028de:	c9                   	leave
+  8028df:	c3                   	ret
+
+008028e0 <devcons_write>:
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+  8028e3:	57                   	push   %edi
+  8028e4:	56                   	push   %esi
+  8028e5:	53                   	push   %ebx
+  8028e6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8028ec:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8028ef:	85 ff                	test   %edi,%edi
+  8028f1:	74 51                	je     802944 <devcons_write+0x64>
+  8028f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fd:	89 fb                	mov    %edi,%ebx
+  8028ff:	29 c3                	sub    %eax,%ebx
+  802901:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802906:	39 d3                	cmp    %edx,%ebx
+  802908:	0f 47 da             	cmova  %edx,%ebx
+  80290b:	83 ec 04             	sub    $0x4,%esp
+  80290e:	53                   	push   %ebx
+  80290f:	03 45 0c             	add    0xc(%ebp),%eax
+  802912:	50                   	push   %eax
+  802913:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802919:	50                   	push   %eax
+  80291a:	e8 99 dd ff ff       	call   8006b8 <memmove>
+  80291f:	83 c4 08             	add    $0x8,%esp
+  802922:	53                   	push   %ebx
+  802923:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802929:	50                   	push   %eax
+  80292a:	e8 51 df ff ff       	call   800880 <sys_cputs>
+  80292f:	01 de                	add    %ebx,%esi
+  802931:	89 f0                	mov    %esi,%eax
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	39 fe                	cmp    %edi,%esi
+  802938:	72 c3                	jb     8028fd <devcons_write+0x1d>
+  80293a:	89 f0                	mov    %esi,%eax
+  80293c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80293f:	5b                   	pop    %ebx
+  802940:	5e                   	pop    %esi
+  802941:	5f                   	pop    %edi
+  802942:	5d                   	pop    %ebp
+  802943:	c3                   	ret
+  802944:	be 00 00 00 00       	mov    $0x0,%esi
+  802949:	eb ef                	jmp    80293a <devcons_write+0x5a>
+
+0080294b <devcons_read>:
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	83 ec 08             	sub    $0x8,%esp
+  802951:	b8 00 00 00 00       	mov    $0x0,%eax
+  802956:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80295a:	75 07                	jne    802963 <devcons_read+0x18>
+  80295c:	eb 1f                	jmp    80297d <devcons_read+0x32>
+  80295e:	e8 ba df ff ff       	call   80091d <sys_yield>
+  802963:	e8 36 df ff ff       	call   80089e <sys_cgetc>
+  802968:	85 c0                	test   %eax,%eax
+  80296a:	74 f2                	je     80295e <devcons_read+0x13>
+  80296c:	78 0f                	js     80297d <devcons_read+0x32>
+  80296e:	83 f8 04             	cmp    $0x4,%eax
+  802971:	74 0c                	je     80297f <devcons_read+0x34>
+  802973:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802976:	88 02                	mov    %al,(%edx)
+  802978:	b8 01 00 00 00       	mov    $0x1,%eax
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+  80297f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802984:	eb f7                	jmp    80297d <devcons_read+0x32>
+
+00802986 <cputchar>:
+  802986:	55                   	push   %ebp
+  802987:	89 e5                	mov    %esp,%ebp
+  802989:	83 ec 20             	sub    $0x20,%esp
+  80298c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298f:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802992:	6a 01                	push   $0x1
+  802994:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802997:	50                   	push   %eax
+  802998:	e8 e3 de ff ff       	call   800880 <sys_cputs>
+  80299d:	83 c4 10             	add    $0x10,%esp
+  8029a0:	c9                   	leave
+  8029a1:	c3                   	ret
+
+008029a2 <getchar>:
+  8029a2:	55                   	push   %ebp
+  8029a3:	89 e5                	mov    %esp,%ebp
+  8029a5:	83 ec 1c             	sub    $0x1c,%esp
+  8029a8:	6a 01                	push   $0x1
+  8029aa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029ad:	50                   	push   %eax
+  8029ae:	6a 00                	push   $0x0
+  8029b0:	e8 fa ea ff ff       	call   8014af <read>
+  8029b5:	83 c4 10             	add    $0x10,%esp
+  8029b8:	85 c0                	test   %eax,%eax
+  8029ba:	78 06                	js     8029c2 <getchar+0x20>
+  8029bc:	74 06                	je     8029c4 <getchar+0x22>
+  8029be:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+  8029c4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029c9:	eb f7                	jmp    8029c2 <getchar+0x20>
+
+008029cb <iscons>:
+  8029cb:	55                   	push   %ebp
+  8029cc:	89 e5                	mov    %esp,%ebp
+  8029ce:	83 ec 20             	sub    $0x20,%esp
+  8029d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029d4:	50                   	push   %eax
+  8029d5:	ff 75 08             	push   0x8(%ebp)
+  8029d8:	e8 70 e8 ff ff       	call   80124d <fd_lookup>
+  8029dd:	83 c4 10             	add    $0x10,%esp
+  8029e0:	85 c0                	test   %eax,%eax
+  8029e2:	78 11                	js     8029f5 <iscons+0x2a>
+  8029e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029e7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8029ed:	39 10                	cmp    %edx,(%eax)
+  8029ef:	0f 94 c0             	sete   %al
+  8029f2:	0f b6 c0             	movzbl %al,%eax
+  8029f5:	c9                   	leave
+  8029f6:	c3                   	ret
+
+008029f7 <opencons>:
+  8029f7:	55                   	push   %ebp
+  8029f8:	89 e5                	mov    %esp,%ebp
+  8029fa:	83 ec 24             	sub    $0x24,%esp
+  8029fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a00:	50                   	push   %eax
+  802a01:	e8 f7 e7 ff ff       	call   8011fd <fd_alloc>
+  802a06:	83 c4 10             	add    $0x10,%esp
+  802a09:	85 c0                	test   %eax,%eax
+  802a0b:	78 3a                	js     802a47 <opencons+0x50>
+  802a0d:	83 ec 04             	sub    $0x4,%esp
+  802a10:	68 07 04 00 00       	push   $0x407
+  802a15:	ff 75 f4             	push   -0xc(%ebp)
+  802a18:	6a 00                	push   $0x0
+  802a1a:	e8 49 df ff ff       	call   800968 <sys_page_alloc>
+  802a1f:	83 c4 10             	add    $0x10,%esp
+  802a22:	85 c0                	test   %eax,%eax
+  802a24:	78 21                	js     802a47 <opencons+0x50>
+  802a26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a29:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a2f:	89 10                	mov    %edx,(%eax)
+  802a31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a34:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802a3b:	83 ec 0c             	sub    $0xc,%esp
+  802a3e:	50                   	push   %eax
+  802a3f:	e8 92 e7 ff ff       	call   8011d6 <fd2num>
+  802a44:	83 c4 10             	add    $0x10,%esp
+  802a47:	c9                   	leave
+  802a48:	c3                   	ret
+
+00802a49 <_panic>:
+  802a49:	55                   	push   %ebp
+  802a4a:	89 e5                	mov    %esp,%ebp
+  802a4c:	56                   	push   %esi
+  802a4d:	53                   	push   %ebx
+  802a4e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802a51:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a57:	e8 a2 de ff ff       	call   8008fe <sys_getenvid>
+  802a5c:	83 ec 0c             	sub    $0xc,%esp
+  802a5f:	ff 75 0c             	push   0xc(%ebp)
+  802a62:	ff 75 08             	push   0x8(%ebp)
+  802a65:	56                   	push   %esi
+  802a66:	50                   	push   %eax
+  802a67:	68 e0 39 80 00       	push   $0x8039e0
+  802a6c:	e8 b3 00 00 00       	call   802b24 <cprintf>
+  802a71:	83 c4 18             	add    $0x18,%esp
+  802a74:	53                   	push   %ebx
+  802a75:	ff 75 10             	push   0x10(%ebp)
+  802a78:	e8 56 00 00 00       	call   802ad3 <vcprintf>
+  802a7d:	c7 04 24 bc 36 80 00 	movl   $0x8036bc,(%esp)
+  802a84:	e8 9b 00 00 00       	call   802b24 <cprintf>
+  802a89:	83 c4 10             	add    $0x10,%esp
+  802a8c:	cc                   	int3
+  802a8d:	eb fd                	jmp    802a8c <_panic+0x43>
+
+00802a8f <putch>:
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	53                   	push   %ebx
+  802a93:	83 ec 04             	sub    $0x4,%esp
+  802a96:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a99:	8b 13                	mov    (%ebx),%edx
+  802a9b:	8d 42 01             	lea    0x1(%edx),%eax
+  802a9e:	89 03                	mov    %eax,(%ebx)
+  802aa0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802aa3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802aa7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802aac:	74 09                	je     802ab7 <putch+0x28>
+  802aae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  802ab2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab5:	c9                   	leave
+  802ab6:	c3                   	ret
+  802ab7:	83 ec 08             	sub    $0x8,%esp
+  802aba:	68 ff 00 00 00       	push   $0xff
+  802abf:	8d 43 08             	lea    0x8(%ebx),%eax
+  802ac2:	50                   	push   %eax
+  802ac3:	e8 b8 dd ff ff       	call   800880 <sys_cputs>
+  802ac8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	eb db                	jmp    802aae <putch+0x1f>
+
+00802ad3 <vcprintf>:
+  802ad3:	55                   	push   %ebp
+  802ad4:	89 e5                	mov    %esp,%ebp
+  802ad6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802adc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802ae3:	00 00 00 
+  802ae6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802aed:	00 00 00 
+  802af0:	ff 75 0c             	push   0xc(%ebp)
+  802af3:	ff 75 08             	push   0x8(%ebp)
+  802af6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802afc:	50                   	push   %eax
+  802afd:	68 8f 2a 80 00       	push   $0x802a8f
+  802b02:	e8 1c 01 00 00       	call   802c23 <vprintfmt>
+  802b07:	83 c4 08             	add    $0x8,%esp
+  802b0a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802b10:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802b16:	50                   	push   %eax
+  802b17:	e8 64 dd ff ff       	call   800880 <sys_cputs>
+  802b1c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802b22:	c9                   	leave
+  802b23:	c3                   	ret
+
+00802b24 <cprintf>:
+  802b24:	55                   	push   %ebp
+  802b25:	89 e5                	mov    %esp,%ebp
+  802b27:	83 ec 10             	sub    $0x10,%esp
+  802b2a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802b2d:	50                   	push   %eax
+  802b2e:	ff 75 08             	push   0x8(%ebp)
+  802b31:	e8 9d ff ff ff       	call   802ad3 <vcprintf>
+  802b36:	c9                   	leave
+  802b37:	c3                   	ret
+
+00802b38 <printnum>:
+  802b38:	55                   	push   %ebp
+  802b39:	89 e5                	mov    %esp,%ebp
+  802b3b:	57                   	push   %edi
+  802b3c:	56                   	push   %esi
+  802b3d:	53                   	push   %ebx
+  802b3e:	83 ec 1c             	sub    $0x1c,%esp
+  802b41:	89 c3                	mov    %eax,%ebx
+  802b43:	89 d6                	mov    %edx,%esi
+  802b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b4b:	89 d1                	mov    %edx,%ecx
+  802b4d:	89 c2                	mov    %eax,%edx
+  802b4f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802b52:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b55:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b58:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b5b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b62:	39 c2                	cmp    %eax,%edx
+  802b64:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802b67:	73 4b                	jae    802bb4 <printnum+0x7c>
+  802b69:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b6c:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b6f:	85 ff                	test   %edi,%edi
+  802b71:	7e 11                	jle    802b84 <printnum+0x4c>
+  802b73:	83 ec 08             	sub    $0x8,%esp
+  802b76:	56                   	push   %esi
+  802b77:	ff 75 18             	push   0x18(%ebp)
+  802b7a:	ff d3                	call   *%ebx
+  802b7c:	83 c4 10             	add    $0x10,%esp
+  802b7f:	83 ef 01             	sub    $0x1,%edi
+  802b82:	75 ef                	jne    802b73 <printnum+0x3b>
+  802b84:	83 ec 08             	sub    $0x8,%esp
+  802b87:	56                   	push   %esi
+  802b88:	83 ec 04             	sub    $0x4,%esp
+  802b8b:	ff 75 e4             	push   -0x1c(%ebp)
+  802b8e:	ff 75 e0             	push   -0x20(%ebp)
+  802b91:	ff 75 dc             	push   -0x24(%ebp)
+  802b94:	ff 75 d8             	push   -0x28(%ebp)
+  802b97:	e8 d7 09 00 00       	call   803573 <__umoddi3>
+  802b9c:	83 c4 14             	add    $0x14,%esp
+  802b9f:	0f be 80 03 3a 80 00 	movsbl 0x803a03(%eax),%eax
+  802ba6:	50                   	push   %eax
+  802ba7:	ff d3                	call   *%ebx
+  802ba9:	83 c4 10             	add    $0x10,%esp
+  802bac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802baf:	5b                   	pop    %ebx
+  802bb0:	5e                   	pop    %esi
+  802bb1:	5f                   	pop    %edi
+  802bb2:	5d                   	pop    %ebp
+  802bb3:	c3                   	ret
+  802bb4:	83 ec 0c             	sub    $0xc,%esp
+  802bb7:	ff 75 18             	push   0x18(%ebp)
+  802bba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802bbd:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802bc0:	52                   	push   %edx
+  802bc1:	50                   	push   %eax
+  802bc2:	83 ec 08             	sub    $0x8,%esp
+  802bc5:	ff 75 e4             	push   -0x1c(%ebp)
+  802bc8:	ff 75 e0             	push   -0x20(%ebp)
+  802bcb:	ff 75 dc             	push   -0x24(%ebp)
+  802bce:	ff 75 d8             	push   -0x28(%ebp)
+  802bd1:	e8 7f 09 00 00       	call   803555 <__udivdi3>
+  802bd6:	83 c4 18             	add    $0x18,%esp
+  802bd9:	52                   	push   %edx
+  802bda:	50                   	push   %eax
+  802bdb:	89 f2                	mov    %esi,%edx
+  802bdd:	89 d8                	mov    %ebx,%eax
+  802bdf:	e8 54 ff ff ff       	call   802b38 <printnum>
+  802be4:	83 c4 20             	add    $0x20,%esp
+  802be7:	eb 9b                	jmp    802b84 <printnum+0x4c>
+
+00802be9 <sprintputch>:
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bef:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802bf3:	8b 10                	mov    (%eax),%edx
+  802bf5:	3b 50 04             	cmp    0x4(%eax),%edx
+  802bf8:	73 0a                	jae    802c04 <sprintputch+0x1b>
+  802bfa:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802bfd:	89 08                	mov    %ecx,(%eax)
+  802bff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c02:	88 02                	mov    %al,(%edx)
+  802c04:	5d                   	pop    %ebp
+  802c05:	c3                   	ret
+
+00802c06 <printfmt>:
+  802c06:	55                   	push   %ebp
+  802c07:	89 e5                	mov    %esp,%ebp
+  802c09:	83 ec 08             	sub    $0x8,%esp
+  802c0c:	8d 45 14             	lea    0x14(%ebp),%eax
+  802c0f:	50                   	push   %eax
+  802c10:	ff 75 10             	push   0x10(%ebp)
+  802c13:	ff 75 0c             	push   0xc(%ebp)
+  802c16:	ff 75 08             	push   0x8(%ebp)
+  802c19:	e8 05 00 00 00       	call   802c23 <vprintfmt>
+  802c1e:	83 c4 10             	add    $0x10,%esp
+  802c21:	c9                   	leave
+  802c22:	c3                   	ret
+
+00802c23 <vprintfmt>:
+  802c23:	55                   	push   %ebp
+  802c24:	89 e5                	mov    %esp,%ebp
+  802c26:	57                   	push   %edi
+  802c27:	56                   	push   %esi
+  802c28:	53                   	push   %ebx
+  802c29:	83 ec 2c             	sub    $0x2c,%esp
+  802c2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c2f:	89 df                	mov    %ebx,%edi
+  802c31:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802c34:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c37:	8d 70 01             	lea    0x1(%eax),%esi
+  802c3a:	0f b6 00             	movzbl (%eax),%eax
+  802c3d:	83 f8 25             	cmp    $0x25,%eax
+  802c40:	74 1e                	je     802c60 <vprintfmt+0x3d>
+  802c42:	85 c0                	test   %eax,%eax
+  802c44:	0f 84 15 05 00 00    	je     80315f <vprintfmt+0x53c>
+  802c4a:	83 ec 08             	sub    $0x8,%esp
+  802c4d:	53                   	push   %ebx
+  802c4e:	50                   	push   %eax
+  802c4f:	ff d7                	call   *%edi
+  802c51:	83 c6 01             	add    $0x1,%esi
+  802c54:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802c58:	83 c4 10             	add    $0x10,%esp
+  802c5b:	83 f8 25             	cmp    $0x25,%eax
+  802c5e:	75 e2                	jne    802c42 <vprintfmt+0x1f>
+  802c60:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  802c64:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  802c6b:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802c72:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802c79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c7e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  802c81:	8d 56 01             	lea    0x1(%esi),%edx
+  802c84:	0f b6 0e             	movzbl (%esi),%ecx
+  802c87:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c8a:	3c 55                	cmp    $0x55,%al
+  802c8c:	0f 87 3b 04 00 00    	ja     8030cd <vprintfmt+0x4aa>
+  802c92:	0f b6 c0             	movzbl %al,%eax
+  802c95:	ff 24 85 40 3b 80 00 	jmp    *0x803b40(,%eax,4)
+  802c9c:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c9f:	eb 93                	jmp    802c34 <vprintfmt+0x11>
+  802ca1:	89 d6                	mov    %edx,%esi
+  802ca3:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802ca7:	eb d8                	jmp    802c81 <vprintfmt+0x5e>
+  802ca9:	89 d6                	mov    %edx,%esi
+  802cab:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802caf:	eb d0                	jmp    802c81 <vprintfmt+0x5e>
+  802cb1:	0f b6 c9             	movzbl %cl,%ecx
+  802cb4:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802cb7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802cba:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  802cbe:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802cc1:	83 f9 09             	cmp    $0x9,%ecx
+  802cc4:	77 6f                	ja     802d35 <vprintfmt+0x112>
+  802cc6:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  802cc9:	83 c2 01             	add    $0x1,%edx
+  802ccc:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802ccf:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  802cd3:	0f be 02             	movsbl (%edx),%eax
+  802cd6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802cd9:	83 fe 09             	cmp    $0x9,%esi
+  802cdc:	76 eb                	jbe    802cc9 <vprintfmt+0xa6>
+  802cde:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802ce1:	89 d6                	mov    %edx,%esi
+  802ce3:	eb 13                	jmp    802cf8 <vprintfmt+0xd5>
+  802ce5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ce8:	8b 00                	mov    (%eax),%eax
+  802cea:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ced:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cf0:	8d 40 04             	lea    0x4(%eax),%eax
+  802cf3:	89 45 14             	mov    %eax,0x14(%ebp)
+  802cf6:	89 d6                	mov    %edx,%esi
+  802cf8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802cfc:	79 83                	jns    802c81 <vprintfmt+0x5e>
+  802cfe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802d01:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d04:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802d0b:	e9 71 ff ff ff       	jmp    802c81 <vprintfmt+0x5e>
+  802d10:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802d13:	85 c9                	test   %ecx,%ecx
+  802d15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1a:	0f 49 c1             	cmovns %ecx,%eax
+  802d1d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d20:	89 d6                	mov    %edx,%esi
+  802d22:	e9 5a ff ff ff       	jmp    802c81 <vprintfmt+0x5e>
+  802d27:	89 d6                	mov    %edx,%esi
+  802d29:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  802d30:	e9 4c ff ff ff       	jmp    802c81 <vprintfmt+0x5e>
+  802d35:	89 d6                	mov    %edx,%esi
+  802d37:	eb bf                	jmp    802cf8 <vprintfmt+0xd5>
+  802d39:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802d3d:	89 d6                	mov    %edx,%esi
+  802d3f:	e9 3d ff ff ff       	jmp    802c81 <vprintfmt+0x5e>
+  802d44:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d47:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d4a:	8d 70 04             	lea    0x4(%eax),%esi
+  802d4d:	83 ec 08             	sub    $0x8,%esp
+  802d50:	53                   	push   %ebx
+  802d51:	ff 30                	push   (%eax)
+  802d53:	ff d7                	call   *%edi
+  802d55:	83 c4 10             	add    $0x10,%esp
+  802d58:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d5b:	e9 d4 fe ff ff       	jmp    802c34 <vprintfmt+0x11>
+  802d60:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d63:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d66:	8d 70 04             	lea    0x4(%eax),%esi
+  802d69:	8b 10                	mov    (%eax),%edx
+  802d6b:	89 d0                	mov    %edx,%eax
+  802d6d:	f7 d8                	neg    %eax
+  802d6f:	0f 48 c2             	cmovs  %edx,%eax
+  802d72:	83 f8 12             	cmp    $0x12,%eax
+  802d75:	7f 23                	jg     802d9a <vprintfmt+0x177>
+  802d77:	8b 14 85 a0 3c 80 00 	mov    0x803ca0(,%eax,4),%edx
+  802d7e:	85 d2                	test   %edx,%edx
+  802d80:	74 18                	je     802d9a <vprintfmt+0x177>
+  802d82:	52                   	push   %edx
+  802d83:	68 67 39 80 00       	push   $0x803967
+  802d88:	53                   	push   %ebx
+  802d89:	57                   	push   %edi
+  802d8a:	e8 77 fe ff ff       	call   802c06 <printfmt>
+  802d8f:	83 c4 10             	add    $0x10,%esp
+  802d92:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d95:	e9 9a fe ff ff       	jmp    802c34 <vprintfmt+0x11>
+  802d9a:	50                   	push   %eax
+  802d9b:	68 1b 3a 80 00       	push   $0x803a1b
+  802da0:	53                   	push   %ebx
+  802da1:	57                   	push   %edi
+  802da2:	e8 5f fe ff ff       	call   802c06 <printfmt>
+  802da7:	83 c4 10             	add    $0x10,%esp
+  802daa:	89 75 14             	mov    %esi,0x14(%ebp)
+  802dad:	e9 82 fe ff ff       	jmp    802c34 <vprintfmt+0x11>
+  802db2:	89 55 10             	mov    %edx,0x10(%ebp)
+  802db5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802db8:	83 c0 04             	add    $0x4,%eax
+  802dbb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802dbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dc1:	8b 00                	mov    (%eax),%eax
+  802dc3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802dc6:	85 c0                	test   %eax,%eax
+  802dc8:	0f 84 61 03 00 00    	je     80312f <vprintfmt+0x50c>
+  802dce:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802dd2:	7e 06                	jle    802dda <vprintfmt+0x1b7>
+  802dd4:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802dd8:	75 29                	jne    802e03 <vprintfmt+0x1e0>
+  802dda:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802ddd:	8d 70 01             	lea    0x1(%eax),%esi
+  802de0:	0f b6 00             	movzbl (%eax),%eax
+  802de3:	0f be d0             	movsbl %al,%edx
+  802de6:	85 d2                	test   %edx,%edx
+  802de8:	0f 84 bb 00 00 00    	je     802ea9 <vprintfmt+0x286>
+  802dee:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802df1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802df4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802df7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dfa:	eb 7a                	jmp    802e76 <vprintfmt+0x253>
+  802dfc:	c7 45 d0 14 3a 80 00 	movl   $0x803a14,-0x30(%ebp)
+  802e03:	83 ec 08             	sub    $0x8,%esp
+  802e06:	ff 75 d4             	push   -0x2c(%ebp)
+  802e09:	ff 75 d0             	push   -0x30(%ebp)
+  802e0c:	e8 cd d6 ff ff       	call   8004de <strnlen>
+  802e11:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802e14:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e17:	83 c4 10             	add    $0x10,%esp
+  802e1a:	85 d2                	test   %edx,%edx
+  802e1c:	0f 8e d6 02 00 00    	jle    8030f8 <vprintfmt+0x4d5>
+  802e22:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802e26:	83 ec 08             	sub    $0x8,%esp
+  802e29:	53                   	push   %ebx
+  802e2a:	56                   	push   %esi
+  802e2b:	ff d7                	call   *%edi
+  802e2d:	83 c4 10             	add    $0x10,%esp
+  802e30:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802e34:	75 f0                	jne    802e26 <vprintfmt+0x203>
+  802e36:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802e39:	8d 70 01             	lea    0x1(%eax),%esi
+  802e3c:	0f b6 00             	movzbl (%eax),%eax
+  802e3f:	0f be d0             	movsbl %al,%edx
+  802e42:	85 d2                	test   %edx,%edx
+  802e44:	0f 84 da 02 00 00    	je     803124 <vprintfmt+0x501>
+  802e4a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802e4d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802e50:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802e53:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e56:	eb 1e                	jmp    802e76 <vprintfmt+0x253>
+  802e58:	83 ec 08             	sub    $0x8,%esp
+  802e5b:	ff 75 0c             	push   0xc(%ebp)
+  802e5e:	52                   	push   %edx
+  802e5f:	ff 55 08             	call   *0x8(%ebp)
+  802e62:	83 c4 10             	add    $0x10,%esp
+  802e65:	83 eb 01             	sub    $0x1,%ebx
+  802e68:	83 c6 01             	add    $0x1,%esi
+  802e6b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e6f:	0f be d0             	movsbl %al,%edx
+  802e72:	85 d2                	test   %edx,%edx
+  802e74:	74 2a                	je     802ea0 <vprintfmt+0x27d>
+  802e76:	85 ff                	test   %edi,%edi
+  802e78:	78 05                	js     802e7f <vprintfmt+0x25c>
+  802e7a:	83 ef 01             	sub    $0x1,%edi
+  802e7d:	78 59                	js     802ed8 <vprintfmt+0x2b5>
+  802e7f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e83:	74 d3                	je     802e58 <vprintfmt+0x235>
+  802e85:	0f be c0             	movsbl %al,%eax
+  802e88:	83 e8 20             	sub    $0x20,%eax
+  802e8b:	83 f8 5e             	cmp    $0x5e,%eax
+  802e8e:	76 c8                	jbe    802e58 <vprintfmt+0x235>
+  802e90:	83 ec 08             	sub    $0x8,%esp
+  802e93:	ff 75 0c             	push   0xc(%ebp)
+  802e96:	6a 3f                	push   $0x3f
+  802e98:	ff 55 08             	call   *0x8(%ebp)
+  802e9b:	83 c4 10             	add    $0x10,%esp
+  802e9e:	eb c5                	jmp    802e65 <vprintfmt+0x242>
+  802ea0:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802ea3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ea6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ea9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802eac:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802eb0:	7e 1b                	jle    802ecd <vprintfmt+0x2aa>
+  802eb2:	83 ec 08             	sub    $0x8,%esp
+  802eb5:	53                   	push   %ebx
+  802eb6:	6a 20                	push   $0x20
+  802eb8:	ff d7                	call   *%edi
+  802eba:	83 c4 10             	add    $0x10,%esp
+  802ebd:	83 ee 01             	sub    $0x1,%esi
+  802ec0:	75 f0                	jne    802eb2 <vprintfmt+0x28f>
+  802ec2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802ec5:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ec8:	e9 67 fd ff ff       	jmp    802c34 <vprintfmt+0x11>
+  802ecd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802ed0:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ed3:	e9 5c fd ff ff       	jmp    802c34 <vprintfmt+0x11>
+  802ed8:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802edb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ede:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ee1:	eb c6                	jmp    802ea9 <vprintfmt+0x286>
+  802ee3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802ee6:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ee9:	83 f9 01             	cmp    $0x1,%ecx
+  802eec:	7f 1f                	jg     802f0d <vprintfmt+0x2ea>
+  802eee:	85 c9                	test   %ecx,%ecx
+  802ef0:	74 67                	je     802f59 <vprintfmt+0x336>
+  802ef2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ef5:	8b 30                	mov    (%eax),%esi
+  802ef7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802efa:	89 f0                	mov    %esi,%eax
+  802efc:	c1 f8 1f             	sar    $0x1f,%eax
+  802eff:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f02:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f05:	8d 40 04             	lea    0x4(%eax),%eax
+  802f08:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f0b:	eb 17                	jmp    802f24 <vprintfmt+0x301>
+  802f0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f10:	8b 50 04             	mov    0x4(%eax),%edx
+  802f13:	8b 00                	mov    (%eax),%eax
+  802f15:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802f18:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802f1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f1e:	8d 40 08             	lea    0x8(%eax),%eax
+  802f21:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f24:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802f27:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f2a:	be 0a 00 00 00       	mov    $0xa,%esi
+  802f2f:	85 c9                	test   %ecx,%ecx
+  802f31:	0f 89 12 01 00 00    	jns    803049 <vprintfmt+0x426>
+  802f37:	83 ec 08             	sub    $0x8,%esp
+  802f3a:	53                   	push   %ebx
+  802f3b:	6a 2d                	push   $0x2d
+  802f3d:	ff d7                	call   *%edi
+  802f3f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802f42:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f45:	f7 da                	neg    %edx
+  802f47:	83 d1 00             	adc    $0x0,%ecx
+  802f4a:	f7 d9                	neg    %ecx
+  802f4c:	83 c4 10             	add    $0x10,%esp
+  802f4f:	be 0a 00 00 00       	mov    $0xa,%esi
+  802f54:	e9 f0 00 00 00       	jmp    803049 <vprintfmt+0x426>
+  802f59:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f5c:	8b 30                	mov    (%eax),%esi
+  802f5e:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f61:	89 f0                	mov    %esi,%eax
+  802f63:	c1 f8 1f             	sar    $0x1f,%eax
+  802f66:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f69:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f6c:	8d 40 04             	lea    0x4(%eax),%eax
+  802f6f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f72:	eb b0                	jmp    802f24 <vprintfmt+0x301>
+  802f74:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f77:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f7a:	83 f9 01             	cmp    $0x1,%ecx
+  802f7d:	7f 1e                	jg     802f9d <vprintfmt+0x37a>
+  802f7f:	85 c9                	test   %ecx,%ecx
+  802f81:	74 32                	je     802fb5 <vprintfmt+0x392>
+  802f83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f86:	8b 10                	mov    (%eax),%edx
+  802f88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f8d:	8d 40 04             	lea    0x4(%eax),%eax
+  802f90:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f93:	be 0a 00 00 00       	mov    $0xa,%esi
+  802f98:	e9 ac 00 00 00       	jmp    803049 <vprintfmt+0x426>
+  802f9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fa0:	8b 10                	mov    (%eax),%edx
+  802fa2:	8b 48 04             	mov    0x4(%eax),%ecx
+  802fa5:	8d 40 08             	lea    0x8(%eax),%eax
+  802fa8:	89 45 14             	mov    %eax,0x14(%ebp)
+  802fab:	be 0a 00 00 00       	mov    $0xa,%esi
+  802fb0:	e9 94 00 00 00       	jmp    803049 <vprintfmt+0x426>
+  802fb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fb8:	8b 10                	mov    (%eax),%edx
+  802fba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fbf:	8d 40 04             	lea    0x4(%eax),%eax
+  802fc2:	89 45 14             	mov    %eax,0x14(%ebp)
+  802fc5:	be 0a 00 00 00       	mov    $0xa,%esi
+  802fca:	eb 7d                	jmp    803049 <vprintfmt+0x426>
+  802fcc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802fcf:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fd2:	83 f9 01             	cmp    $0x1,%ecx
+  802fd5:	7f 1b                	jg     802ff2 <vprintfmt+0x3cf>
+  802fd7:	85 c9                	test   %ecx,%ecx
+  802fd9:	74 2c                	je     803007 <vprintfmt+0x3e4>
+  802fdb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fde:	8b 10                	mov    (%eax),%edx
+  802fe0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fe5:	8d 40 04             	lea    0x4(%eax),%eax
+  802fe8:	89 45 14             	mov    %eax,0x14(%ebp)
+  802feb:	be 08 00 00 00       	mov    $0x8,%esi
+  802ff0:	eb 57                	jmp    803049 <vprintfmt+0x426>
+  802ff2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ff5:	8b 10                	mov    (%eax),%edx
+  802ff7:	8b 48 04             	mov    0x4(%eax),%ecx
+  802ffa:	8d 40 08             	lea    0x8(%eax),%eax
+  802ffd:	89 45 14             	mov    %eax,0x14(%ebp)
+  803000:	be 08 00 00 00       	mov    $0x8,%esi
+  803005:	eb 42                	jmp    803049 <vprintfmt+0x426>
+  803007:	8b 45 14             	mov    0x14(%ebp),%eax
+  80300a:	8b 10                	mov    (%eax),%edx
+  80300c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803011:	8d 40 04             	lea    0x4(%eax),%eax
+  803014:	89 45 14             	mov    %eax,0x14(%ebp)
+  803017:	be 08 00 00 00       	mov    $0x8,%esi
+  80301c:	eb 2b                	jmp    803049 <vprintfmt+0x426>
+  80301e:	89 55 10             	mov    %edx,0x10(%ebp)
+  803021:	83 ec 08             	sub    $0x8,%esp
+  803024:	53                   	push   %ebx
+  803025:	6a 30                	push   $0x30
+  803027:	ff d7                	call   *%edi
+  803029:	83 c4 08             	add    $0x8,%esp
+  80302c:	53                   	push   %ebx
+  80302d:	6a 78                	push   $0x78
+  80302f:	ff d7                	call   *%edi
+  803031:	8b 45 14             	mov    0x14(%ebp),%eax
+  803034:	8b 10                	mov    (%eax),%edx
+  803036:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	8d 40 04             	lea    0x4(%eax),%eax
+  803041:	89 45 14             	mov    %eax,0x14(%ebp)
+  803044:	be 10 00 00 00       	mov    $0x10,%esi
+  803049:	83 ec 0c             	sub    $0xc,%esp
+  80304c:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  803050:	50                   	push   %eax
+  803051:	ff 75 e4             	push   -0x1c(%ebp)
+  803054:	56                   	push   %esi
+  803055:	51                   	push   %ecx
+  803056:	52                   	push   %edx
+  803057:	89 da                	mov    %ebx,%edx
+  803059:	89 f8                	mov    %edi,%eax
+  80305b:	e8 d8 fa ff ff       	call   802b38 <printnum>
+  803060:	83 c4 20             	add    $0x20,%esp
+  803063:	e9 cc fb ff ff       	jmp    802c34 <vprintfmt+0x11>
+  803068:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80306b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80306e:	83 f9 01             	cmp    $0x1,%ecx
+  803071:	7f 1b                	jg     80308e <vprintfmt+0x46b>
+  803073:	85 c9                	test   %ecx,%ecx
+  803075:	74 2c                	je     8030a3 <vprintfmt+0x480>
+  803077:	8b 45 14             	mov    0x14(%ebp),%eax
+  80307a:	8b 10                	mov    (%eax),%edx
+  80307c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803081:	8d 40 04             	lea    0x4(%eax),%eax
+  803084:	89 45 14             	mov    %eax,0x14(%ebp)
+  803087:	be 10 00 00 00       	mov    $0x10,%esi
+  80308c:	eb bb                	jmp    803049 <vprintfmt+0x426>
+  80308e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803091:	8b 10                	mov    (%eax),%edx
+  803093:	8b 48 04             	mov    0x4(%eax),%ecx
+  803096:	8d 40 08             	lea    0x8(%eax),%eax
+  803099:	89 45 14             	mov    %eax,0x14(%ebp)
+  80309c:	be 10 00 00 00       	mov    $0x10,%esi
+  8030a1:	eb a6                	jmp    803049 <vprintfmt+0x426>
+  8030a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030a6:	8b 10                	mov    (%eax),%edx
+  8030a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8030b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030b3:	be 10 00 00 00       	mov    $0x10,%esi
+  8030b8:	eb 8f                	jmp    803049 <vprintfmt+0x426>
+  8030ba:	89 55 10             	mov    %edx,0x10(%ebp)
+  8030bd:	83 ec 08             	sub    $0x8,%esp
+  8030c0:	53                   	push   %ebx
+  8030c1:	6a 25                	push   $0x25
+  8030c3:	ff d7                	call   *%edi
+  8030c5:	83 c4 10             	add    $0x10,%esp
+  8030c8:	e9 67 fb ff ff       	jmp    802c34 <vprintfmt+0x11>
+  8030cd:	83 ec 08             	sub    $0x8,%esp
+  8030d0:	53                   	push   %ebx
+  8030d1:	6a 25                	push   $0x25
+  8030d3:	ff d7                	call   *%edi
+  8030d5:	83 c4 10             	add    $0x10,%esp
+  8030d8:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8030dc:	0f 84 ba fb ff ff    	je     802c9c <vprintfmt+0x79>
+  8030e2:	89 75 10             	mov    %esi,0x10(%ebp)
+  8030e5:	89 f0                	mov    %esi,%eax
+  8030e7:	83 e8 01             	sub    $0x1,%eax
+  8030ea:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8030ee:	75 f7                	jne    8030e7 <vprintfmt+0x4c4>
+  8030f0:	89 45 10             	mov    %eax,0x10(%ebp)
+  8030f3:	e9 3c fb ff ff       	jmp    802c34 <vprintfmt+0x11>
+  8030f8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8030fb:	8d 70 01             	lea    0x1(%eax),%esi
+  8030fe:	0f b6 00             	movzbl (%eax),%eax
+  803101:	0f be d0             	movsbl %al,%edx
+  803104:	85 d2                	test   %edx,%edx
+  803106:	74 11                	je     803119 <vprintfmt+0x4f6>
+  803108:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80310b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80310e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803111:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803114:	e9 5d fd ff ff       	jmp    802e76 <vprintfmt+0x253>
+  803119:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80311c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80311f:	e9 10 fb ff ff       	jmp    802c34 <vprintfmt+0x11>
+  803124:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803127:	89 45 14             	mov    %eax,0x14(%ebp)
+  80312a:	e9 05 fb ff ff       	jmp    802c34 <vprintfmt+0x11>
+  80312f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  803133:	7e 0a                	jle    80313f <vprintfmt+0x51c>
+  803135:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  803139:	0f 85 bd fc ff ff    	jne    802dfc <vprintfmt+0x1d9>
+  80313f:	ba 28 00 00 00       	mov    $0x28,%edx
+  803144:	b8 28 00 00 00       	mov    $0x28,%eax
+  803149:	be 15 3a 80 00       	mov    $0x803a15,%esi
+  80314e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  803151:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803154:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803157:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80315a:	e9 17 fd ff ff       	jmp    802e76 <vprintfmt+0x253>
+  80315f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803162:	5b                   	pop    %ebx
+  803163:	5e                   	pop    %esi
+  803164:	5f                   	pop    %edi
+  803165:	5d                   	pop    %ebp
+  803166:	c3                   	ret
+
+00803167 <vsnprintf>:
+  803167:	55                   	push   %ebp
+  803168:	89 e5                	mov    %esp,%ebp
+  80316a:	83 ec 18             	sub    $0x18,%esp
+  80316d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803170:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803173:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803176:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80317a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80317d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  803184:	85 c0                	test   %eax,%eax
+  803186:	74 26                	je     8031ae <vsnprintf+0x47>
+  803188:	85 d2                	test   %edx,%edx
+  80318a:	7e 22                	jle    8031ae <vsnprintf+0x47>
+  80318c:	ff 75 14             	push   0x14(%ebp)
+  80318f:	ff 75 10             	push   0x10(%ebp)
+  803192:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803195:	50                   	push   %eax
+  803196:	68 e9 2b 80 00       	push   $0x802be9
+  80319b:	e8 83 fa ff ff       	call   802c23 <vprintfmt>
+  8031a0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8031a3:	c6 00 00             	movb   $0x0,(%eax)
+  8031a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031a9:	83 c4 10             	add    $0x10,%esp
+  8031ac:	c9                   	leave
+  8031ad:	c3                   	ret
+  8031ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031b3:	eb f7                	jmp    8031ac <vsnprintf+0x45>
+
+008031b5 <snprintf>:
+  8031b5:	55                   	push   %ebp
+  8031b6:	89 e5                	mov    %esp,%ebp
+  8031b8:	83 ec 08             	sub    $0x8,%esp
+  8031bb:	8d 45 14             	lea    0x14(%ebp),%eax
+  8031be:	50                   	push   %eax
+  8031bf:	ff 75 10             	push   0x10(%ebp)
+  8031c2:	ff 75 0c             	push   0xc(%ebp)
+  8031c5:	ff 75 08             	push   0x8(%ebp)
+  8031c8:	e8 9a ff ff ff       	call   803167 <vsnprintf>
+  8031cd:	c9                   	leave
+  8031ce:	c3                   	ret
+
+008031cf <ipc_recv>:
+  8031cf:	55                   	push   %ebp
+  8031d0:	89 e5                	mov    %esp,%ebp
+  8031d2:	56                   	push   %esi
+  8031d3:	53                   	push   %ebx
+  8031d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031dd:	85 c0                	test   %eax,%eax
+  8031df:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  8031e4:	0f 44 c2             	cmove  %edx,%eax
+  8031e7:	83 ec 0c             	sub    $0xc,%esp
+  8031ea:	50                   	push   %eax
+  8031eb:	e8 23 da ff ff       	call   800c13 <sys_ipc_recv>
+  8031f0:	83 c4 10             	add    $0x10,%esp
+  8031f3:	85 c0                	test   %eax,%eax
+  8031f5:	78 2a                	js     803221 <ipc_recv+0x52>
+  8031f7:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8031fc:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803202:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803208:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80320e:	85 f6                	test   %esi,%esi
+  803210:	74 02                	je     803214 <ipc_recv+0x45>
+  803212:	89 0e                	mov    %ecx,(%esi)
+  803214:	85 db                	test   %ebx,%ebx
+  803216:	74 02                	je     80321a <ipc_recv+0x4b>
+  803218:	89 13                	mov    %edx,(%ebx)
+  80321a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80321d:	5b                   	pop    %ebx
+  80321e:	5e                   	pop    %esi
+  80321f:	5d                   	pop    %ebp
+  803220:	c3                   	ret
+  803221:	ba 00 00 00 00       	mov    $0x0,%edx
+  803226:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80322b:	eb e1                	jmp    80320e <ipc_recv+0x3f>
+
+0080322d <ipc_send>:
+  80322d:	55                   	push   %ebp
+  80322e:	89 e5                	mov    %esp,%ebp
+  803230:	57                   	push   %edi
+  803231:	56                   	push   %esi
+  803232:	53                   	push   %ebx
+  803233:	83 ec 0c             	sub    $0xc,%esp
+  803236:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803239:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80323c:	8b 75 14             	mov    0x14(%ebp),%esi
+  80323f:	85 db                	test   %ebx,%ebx
+  803241:	74 1e                	je     803261 <ipc_send+0x34>
+  803243:	56                   	push   %esi
+  803244:	53                   	push   %ebx
+  803245:	57                   	push   %edi
+  803246:	ff 75 08             	push   0x8(%ebp)
+  803249:	e8 52 da ff ff       	call   800ca0 <sys_ipc_send>
+  80324e:	83 c4 10             	add    $0x10,%esp
+  803251:	85 c0                	test   %eax,%eax
+  803253:	74 2a                	je     80327f <ipc_send+0x52>
+  803255:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803258:	75 13                	jne    80326d <ipc_send+0x40>
+  80325a:	e8 be d6 ff ff       	call   80091d <sys_yield>
+  80325f:	eb e2                	jmp    803243 <ipc_send+0x16>
+  803261:	be 00 00 00 00       	mov    $0x0,%esi
+  803266:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80326b:	eb d6                	jmp    803243 <ipc_send+0x16>
+  80326d:	50                   	push   %eax
+  80326e:	68 0c 3d 80 00       	push   $0x803d0c
+  803273:	6a 4f                	push   $0x4f
+  803275:	68 4f 3d 80 00       	push   $0x803d4f
+  80327a:	e8 ca f7 ff ff       	call   802a49 <_panic>
+  80327f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803282:	5b                   	pop    %ebx
+  803283:	5e                   	pop    %esi
+  803284:	5f                   	pop    %edi
+  803285:	5d                   	pop    %ebp
+  803286:	c3                   	ret
+
+00803287 <ipc_call>:
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	57                   	push   %edi
+  80328b:	56                   	push   %esi
+  80328c:	53                   	push   %ebx
+  80328d:	83 ec 0c             	sub    $0xc,%esp
+  803290:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803294:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803299:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  80329d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8032a1:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8032a6:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8032aa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032b3:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  8032b7:	eb 05                	jmp    8032be <ipc_call+0x37>
+  8032b9:	e8 5f d6 ff ff       	call   80091d <sys_yield>
+  8032be:	83 ec 0c             	sub    $0xc,%esp
+  8032c1:	56                   	push   %esi
+  8032c2:	53                   	push   %ebx
+  8032c3:	57                   	push   %edi
+  8032c4:	ff 75 0c             	push   0xc(%ebp)
+  8032c7:	ff 75 08             	push   0x8(%ebp)
+  8032ca:	e8 21 da ff ff       	call   800cf0 <sys_ipc_call>
+  8032cf:	83 c4 20             	add    $0x20,%esp
+  8032d2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032d5:	74 e2                	je     8032b9 <ipc_call+0x32>
+  8032d7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8032da:	74 2d                	je     803309 <ipc_call+0x82>
+  8032dc:	85 c0                	test   %eax,%eax
+  8032de:	78 4f                	js     80332f <ipc_call+0xa8>
+  8032e0:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8032e4:	74 10                	je     8032f6 <ipc_call+0x6f>
+  8032e6:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8032eb:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8032f1:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8032f4:	89 02                	mov    %eax,(%edx)
+  8032f6:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8032fb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803304:	5b                   	pop    %ebx
+  803305:	5e                   	pop    %esi
+  803306:	5f                   	pop    %edi
+  803307:	5d                   	pop    %ebp
+  803308:	c3                   	ret
+  803309:	ff 75 14             	push   0x14(%ebp)
+  80330c:	ff 75 10             	push   0x10(%ebp)
+  80330f:	ff 75 0c             	push   0xc(%ebp)
+  803312:	ff 75 08             	push   0x8(%ebp)
+  803315:	e8 13 ff ff ff       	call   80322d <ipc_send>
+  80331a:	83 c4 0c             	add    $0xc,%esp
+  80331d:	ff 75 1c             	push   0x1c(%ebp)
+  803320:	ff 75 18             	push   0x18(%ebp)
+  803323:	6a 00                	push   $0x0
+  803325:	e8 a5 fe ff ff       	call   8031cf <ipc_recv>
+  80332a:	83 c4 10             	add    $0x10,%esp
+  80332d:	eb d2                	jmp    803301 <ipc_call+0x7a>
+  80332f:	50                   	push   %eax
+  803330:	68 59 3d 80 00       	push   $0x803d59
+  803335:	6a 6d                	push   $0x6d
+  803337:	68 4f 3d 80 00       	push   $0x803d4f
+  80333c:	e8 08 f7 ff ff       	call   802a49 <_panic>
+
+00803341 <ipc_reply_recv>:
+  803341:	55                   	push   %ebp
+  803342:	89 e5                	mov    %esp,%ebp
+  803344:	57                   	push   %edi
+  803345:	56                   	push   %esi
+  803346:	53                   	push   %ebx
+  803347:	83 ec 0c             	sub    $0xc,%esp
+  80334a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80334d:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803350:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803353:	85 db                	test   %ebx,%ebx
+  803355:	0f 84 ac 00 00 00    	je     803407 <ipc_reply_recv+0xc6>
+  80335b:	85 f6                	test   %esi,%esi
+  80335d:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803362:	0f 45 c6             	cmovne %esi,%eax
+  803365:	83 ec 0c             	sub    $0xc,%esp
+  803368:	50                   	push   %eax
+  803369:	ff 75 14             	push   0x14(%ebp)
+  80336c:	53                   	push   %ebx
+  80336d:	ff 75 0c             	push   0xc(%ebp)
+  803370:	ff 75 08             	push   0x8(%ebp)
+  803373:	e8 99 d9 ff ff       	call   800d11 <sys_ipc_reply_recv>
+  803378:	83 c4 20             	add    $0x20,%esp
+  80337b:	85 c0                	test   %eax,%eax
+  80337d:	78 3a                	js     8033b9 <ipc_reply_recv+0x78>
+  80337f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803383:	74 10                	je     803395 <ipc_reply_recv+0x54>
+  803385:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  80338a:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803390:	8b 55 18             	mov    0x18(%ebp),%edx
+  803393:	89 02                	mov    %eax,(%edx)
+  803395:	85 ff                	test   %edi,%edi
+  803397:	74 0d                	je     8033a6 <ipc_reply_recv+0x65>
+  803399:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  80339e:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8033a4:	89 07                	mov    %eax,(%edi)
+  8033a6:	a1 20 a0 83 00       	mov    0x83a020,%eax
+  8033ab:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8033b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b4:	5b                   	pop    %ebx
+  8033b5:	5e                   	pop    %esi
+  8033b6:	5f                   	pop    %edi
+  8033b7:	5d                   	pop    %ebp
+  8033b8:	c3                   	ret
+  8033b9:	ff 75 14             	push   0x14(%ebp)
+  8033bc:	53                   	push   %ebx
+  8033bd:	ff 75 0c             	push   0xc(%ebp)
+  8033c0:	ff 75 08             	push   0x8(%ebp)
+  8033c3:	e8 fb d7 ff ff       	call   800bc3 <sys_ipc_try_send>
+  8033c8:	89 c2                	mov    %eax,%edx
+  8033ca:	c1 ea 1f             	shr    $0x1f,%edx
+  8033cd:	83 c4 10             	add    $0x10,%esp
+  8033d0:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8033d3:	0f 95 c1             	setne  %cl
+  8033d6:	84 d1                	test   %dl,%cl
+  8033d8:	74 05                	je     8033df <ipc_reply_recv+0x9e>
+  8033da:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033dd:	75 12                	jne    8033f1 <ipc_reply_recv+0xb0>
+  8033df:	83 ec 04             	sub    $0x4,%esp
+  8033e2:	57                   	push   %edi
+  8033e3:	56                   	push   %esi
+  8033e4:	ff 75 18             	push   0x18(%ebp)
+  8033e7:	e8 e3 fd ff ff       	call   8031cf <ipc_recv>
+  8033ec:	83 c4 10             	add    $0x10,%esp
+  8033ef:	eb c0                	jmp    8033b1 <ipc_reply_recv+0x70>
+  8033f1:	83 ec 04             	sub    $0x4,%esp
+  8033f4:	50                   	push   %eax
+  8033f5:	ff 75 08             	push   0x8(%ebp)
+  8033f8:	68 2c 3d 80 00       	push   $0x803d2c
+  8033fd:	e8 22 f7 ff ff       	call   802b24 <cprintf>
+  803402:	83 c4 10             	add    $0x10,%esp
+  803405:	eb d8                	jmp    8033df <ipc_reply_recv+0x9e>
+  803407:	85 f6                	test   %esi,%esi
+  803409:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80340e:	0f 45 c6             	cmovne %esi,%eax
+  803411:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803416:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80341d:	e9 43 ff ff ff       	jmp    803365 <ipc_reply_recv+0x24>
+
+00803422 <ipc_find_env>:
+  803422:	55                   	push   %ebp
+  803423:	89 e5                	mov    %esp,%ebp
+  803425:	83 ec 14             	sub    $0x14,%esp
+  803428:	ff 75 08             	push   0x8(%ebp)
+  80342b:	e8 31 d7 ff ff       	call   800b61 <sys_env_service>
+  803430:	85 c0                	test   %eax,%eax
+  803432:	ba 00 00 00 00       	mov    $0x0,%edx
+  803437:	0f 48 c2             	cmovs  %edx,%eax
+  80343a:	c9                   	leave
+  80343b:	c3                   	ret
+
+0080343c <pageref>:
+  80343c:	55                   	push   %ebp
+  80343d:	89 e5                	mov    %esp,%ebp
+  80343f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803442:	89 c2                	mov    %eax,%edx
+  803444:	c1 ea 16             	shr    $0x16,%edx
+  803447:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80344e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803453:	f6 c1 01             	test   $0x1,%cl
+  803456:	74 22                	je     80347a <pageref+0x3e>
+  803458:	c1 e8 0c             	shr    $0xc,%eax
+  80345b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803462:	a8 01                	test   $0x1,%al
+  803464:	74 14                	je     80347a <pageref+0x3e>
+  803466:	c1 e8 0c             	shr    $0xc,%eax
+  803469:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80346c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803473:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803477:	0f b7 d2             	movzwl %dx,%edx
+  80347a:	89 d0                	mov    %edx,%eax
+  80347c:	5d                   	pop    %ebp
+  80347d:	c3                   	ret
+
+0080347e <__udivmoddi4>:
+  80347e:	55                   	push   %ebp
+  80347f:	57                   	push   %edi
+  803480:	56                   	push   %esi
+  803481:	53                   	push   %ebx
+  803482:	83 ec 24             	sub    $0x24,%esp
+  803485:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803489:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80348d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803491:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803495:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803499:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80349d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8034a1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8034a5:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8034a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034b3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8034b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8034bf:	00 
+  8034c0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8034c7:	00 
+  8034c8:	89 fb                	mov    %edi,%ebx
+  8034ca:	eb 08                	jmp    8034d4 <__udivmoddi4+0x56>
+  8034cc:	83 e9 01             	sub    $0x1,%ecx
+  8034cf:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8034d2:	74 68                	je     80353c <__udivmoddi4+0xbe>
+  8034d4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8034d8:	01 c0                	add    %eax,%eax
+  8034da:	89 c6                	mov    %eax,%esi
+  8034dc:	89 d7                	mov    %edx,%edi
+  8034de:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8034e2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8034e6:	0f ad d0             	shrd   %cl,%edx,%eax
+  8034e9:	d3 ea                	shr    %cl,%edx
+  8034eb:	f6 c1 20             	test   $0x20,%cl
+  8034ee:	74 04                	je     8034f4 <__udivmoddi4+0x76>
+  8034f0:	89 d0                	mov    %edx,%eax
+  8034f2:	31 d2                	xor    %edx,%edx
+  8034f4:	83 e0 01             	and    $0x1,%eax
+  8034f7:	89 04 24             	mov    %eax,(%esp)
+  8034fa:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803501:	00 
+  803502:	8b 04 24             	mov    (%esp),%eax
+  803505:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803509:	09 f0                	or     %esi,%eax
+  80350b:	09 fa                	or     %edi,%edx
+  80350d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803511:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803515:	39 f0                	cmp    %esi,%eax
+  803517:	89 d5                	mov    %edx,%ebp
+  803519:	19 fd                	sbb    %edi,%ebp
+  80351b:	72 af                	jb     8034cc <__udivmoddi4+0x4e>
+  80351d:	29 f0                	sub    %esi,%eax
+  80351f:	19 fa                	sbb    %edi,%edx
+  803521:	89 cf                	mov    %ecx,%edi
+  803523:	c1 ef 05             	shr    $0x5,%edi
+  803526:	83 e7 01             	and    $0x1,%edi
+  803529:	89 fe                	mov    %edi,%esi
+  80352b:	83 f6 01             	xor    $0x1,%esi
+  80352e:	d3 e6                	shl    %cl,%esi
+  803530:	d3 e7                	shl    %cl,%edi
+  803532:	09 74 24 18          	or     %esi,0x18(%esp)
+  803536:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80353a:	eb 90                	jmp    8034cc <__udivmoddi4+0x4e>
+  80353c:	85 db                	test   %ebx,%ebx
+  80353e:	74 05                	je     803545 <__udivmoddi4+0xc7>
+  803540:	89 03                	mov    %eax,(%ebx)
+  803542:	89 53 04             	mov    %edx,0x4(%ebx)
+  803545:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803549:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80354d:	83 c4 24             	add    $0x24,%esp
+  803550:	5b                   	pop    %ebx
+  803551:	5e                   	pop    %esi
+  803552:	5f                   	pop    %edi
+  803553:	5d                   	pop    %ebp
+  803554:	c3                   	ret
+
+00803555 <__udivdi3>:
+  803555:	83 ec 08             	sub    $0x8,%esp
+  803558:	6a 00                	push   $0x0
+  80355a:	ff 74 24 1c          	push   0x1c(%esp)
+  80355e:	ff 74 24 1c          	push   0x1c(%esp)
+  803562:	ff 74 24 1c          	push   0x1c(%esp)
+  803566:	ff 74 24 1c          	push   0x1c(%esp)
+  80356a:	e8 0f ff ff ff       	call   80347e <__udivmoddi4>
+  80356f:	83 c4 1c             	add    $0x1c,%esp
+  803572:	c3                   	ret
+
+00803573 <__umoddi3>:
+  803573:	83 ec 18             	sub    $0x18,%esp
+  803576:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80357a:	50                   	push   %eax
+  80357b:	ff 74 24 2c          	push   0x2c(%esp)
+  80357f:	ff 74 24 2c          	push   0x2c(%esp)
+  803583:	ff 74 24 2c          	push   0x2c(%esp)
+  803587:	ff 74 24 2c          	push   0x2c(%esp)
+  80358b:	e8 ee fe ff ff       	call   80347e <__udivmoddi4>
+  803590:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803594:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803598:	83 c4 2c             	add    $0x2c,%esp
+  80359b:	c3                   	ret
+
+0080359c <__divdi3>:
+  80359c:	53                   	push   %ebx
+  80359d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035a1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035a5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8035a9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8035ad:	85 d2                	test   %edx,%edx
+  8035af:	78 12                	js     8035c3 <__divdi3+0x27>
+  8035b1:	85 db                	test   %ebx,%ebx
+  8035b3:	78 2e                	js     8035e3 <__divdi3+0x47>
+  8035b5:	53                   	push   %ebx
+  8035b6:	51                   	push   %ecx
+  8035b7:	52                   	push   %edx
+  8035b8:	50                   	push   %eax
+  8035b9:	e8 97 ff ff ff       	call   803555 <__udivdi3>
+  8035be:	83 c4 10             	add    $0x10,%esp
+  8035c1:	eb 1e                	jmp    8035e1 <__divdi3+0x45>
+  8035c3:	f7 d8                	neg    %eax
+  8035c5:	83 d2 00             	adc    $0x0,%edx
+  8035c8:	f7 da                	neg    %edx
+  8035ca:	85 db                	test   %ebx,%ebx
+  8035cc:	78 2a                	js     8035f8 <__divdi3+0x5c>
+  8035ce:	53                   	push   %ebx
+  8035cf:	51                   	push   %ecx
+  8035d0:	52                   	push   %edx
+  8035d1:	50                   	push   %eax
+  8035d2:	e8 7e ff ff ff       	call   803555 <__udivdi3>
+  8035d7:	83 c4 10             	add    $0x10,%esp
+  8035da:	f7 d8                	neg    %eax
+  8035dc:	83 d2 00             	adc    $0x0,%edx
+  8035df:	f7 da                	neg    %edx
+  8035e1:	5b                   	pop    %ebx
+  8035e2:	c3                   	ret
+  8035e3:	f7 d9                	neg    %ecx
+  8035e5:	83 d3 00             	adc    $0x0,%ebx
+  8035e8:	f7 db                	neg    %ebx
+  8035ea:	53                   	push   %ebx
+  8035eb:	51                   	push   %ecx
+  8035ec:	52                   	push   %edx
+  8035ed:	50                   	push   %eax
+  8035ee:	e8 62 ff ff ff       	call   803555 <__udivdi3>
+  8035f3:	83 c4 10             	add    $0x10,%esp
+  8035f6:	eb e2                	jmp    8035da <__divdi3+0x3e>
+  8035f8:	f7 d9                	neg    %ecx
+  8035fa:	83 d3 00             	adc    $0x0,%ebx
+  8035fd:	f7 db                	neg    %ebx
+  8035ff:	53                   	push   %ebx
+  803600:	51                   	push   %ecx
+  803601:	52                   	push   %edx
+  803602:	50                   	push   %eax
+  803603:	e8 4d ff ff ff       	call   803555 <__udivdi3>
+  803608:	83 c4 10             	add    $0x10,%esp
+  80360b:	eb d4                	jmp    8035e1 <__divdi3+0x45>
+
+0080360d <__moddi3>:
+  80360d:	55                   	push   %ebp
+  80360e:	57                   	push   %edi
+  80360f:	56                   	push   %esi
+  803610:	53                   	push   %ebx
+  803611:	83 ec 0c             	sub    $0xc,%esp
+  803614:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803618:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80361c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803620:	89 e9                	mov    %ebp,%ecx
+  803622:	f7 d9                	neg    %ecx
+  803624:	89 d0                	mov    %edx,%eax
+  803626:	83 d0 00             	adc    $0x0,%eax
+  803629:	f7 d8                	neg    %eax
+  80362b:	0f 49 e9             	cmovns %ecx,%ebp
+  80362e:	0f 49 d0             	cmovns %eax,%edx
+  803631:	52                   	push   %edx
+  803632:	55                   	push   %ebp
+  803633:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803637:	f7 da                	neg    %edx
+  803639:	89 d8                	mov    %ebx,%eax
+  80363b:	83 d0 00             	adc    $0x0,%eax
+  80363e:	f7 d8                	neg    %eax
+  803640:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803645:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803649:	0f 48 c3             	cmovs  %ebx,%eax
+  80364c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803650:	ff 74 24 0c          	push   0xc(%esp)
+  803654:	ff 74 24 0c          	push   0xc(%esp)
+  803658:	e8 16 ff ff ff       	call   803573 <__umoddi3>
+  80365d:	83 c4 10             	add    $0x10,%esp
+  803660:	85 db                	test   %ebx,%ebx
+  803662:	78 08                	js     80366c <__moddi3+0x5f>
+  803664:	83 c4 0c             	add    $0xc,%esp
+  803667:	5b                   	pop    %ebx
+  803668:	5e                   	pop    %esi
+  803669:	5f                   	pop    %edi
+  80366a:	5d                   	pop    %ebp
+  80366b:	c3                   	ret
+  80366c:	f7 d8                	neg    %eax
+  80366e:	83 d2 00             	adc    $0x0,%edx
+  803671:	f7 da                	neg    %edx
+  803673:	eb ef                	jmp    803664 <__moddi3+0x57>
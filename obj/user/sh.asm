@@ -0,0 +1,7133 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 11 0a 00 00       	call   800a42 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+  800046:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+  800065:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 40 4c 80 00       	push   $0x804c40
+  800076:	e8 1b 0b 00 00       	call   800b96 <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 4f 4c 80 00       	push   $0x804c4f
+  800089:	e8 08 0b 00 00       	call   800b96 <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 5d 4c 80 00       	push   $0x804c5d
+  8000a6:	e8 f6 13 00 00       	call   8014a1 <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000be:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 62 4c 80 00       	push   $0x804c62
+  8000d9:	e8 b8 0a 00 00       	call   800b96 <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 73 4c 80 00       	push   $0x804c73
+  8000ef:	e8 ad 13 00 00       	call   8014a1 <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+  80010b:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 67 4c 80 00       	push   $0x804c67
+  80011d:	e8 74 0a 00 00       	call   800b96 <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+  800127:	89 1f                	mov    %ebx,(%edi)
+  800129:	0f b6 03             	movzbl (%ebx),%eax
+  80012c:	84 c0                	test   %al,%al
+  80012e:	74 22                	je     800152 <_gettoken+0x11f>
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	0f be c0             	movsbl %al,%eax
+  800136:	50                   	push   %eax
+  800137:	68 6f 4c 80 00       	push   $0x804c6f
+  80013c:	e8 60 13 00 00       	call   8014a1 <strchr>
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	85 c0                	test   %eax,%eax
+  800146:	75 0a                	jne    800152 <_gettoken+0x11f>
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	0f b6 03             	movzbl (%ebx),%eax
+  80014e:	84 c0                	test   %al,%al
+  800150:	75 de                	jne    800130 <_gettoken+0xfd>
+  800152:	8b 45 10             	mov    0x10(%ebp),%eax
+  800155:	89 18                	mov    %ebx,(%eax)
+  800157:	be 77 00 00 00       	mov    $0x77,%esi
+  80015c:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  800163:	0f 8e 5e ff ff ff    	jle    8000c7 <_gettoken+0x94>
+  800169:	0f b6 33             	movzbl (%ebx),%esi
+  80016c:	c6 03 00             	movb   $0x0,(%ebx)
+  80016f:	83 ec 08             	sub    $0x8,%esp
+  800172:	ff 37                	push   (%edi)
+  800174:	68 7b 4c 80 00       	push   $0x804c7b
+  800179:	e8 18 0a 00 00       	call   800b96 <cprintf>
+  80017e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800181:	8b 00                	mov    (%eax),%eax
+  800183:	89 f2                	mov    %esi,%edx
+  800185:	88 10                	mov    %dl,(%eax)
+  800187:	83 c4 10             	add    $0x10,%esp
+  80018a:	be 77 00 00 00       	mov    $0x77,%esi
+  80018f:	e9 33 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+00800194 <gettoken>:
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	83 ec 08             	sub    $0x8,%esp
+  80019a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80019d:	85 c0                	test   %eax,%eax
+  80019f:	74 22                	je     8001c3 <gettoken+0x2f>
+  8001a1:	83 ec 04             	sub    $0x4,%esp
+  8001a4:	68 0c 70 80 00       	push   $0x80700c
+  8001a9:	68 10 70 80 00       	push   $0x807010
+  8001ae:	50                   	push   %eax
+  8001af:	e8 7f fe ff ff       	call   800033 <_gettoken>
+  8001b4:	a3 08 70 80 00       	mov    %eax,0x807008
+  8001b9:	83 c4 10             	add    $0x10,%esp
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+  8001c3:	a1 08 70 80 00       	mov    0x807008,%eax
+  8001c8:	a3 04 70 80 00       	mov    %eax,0x807004
+  8001cd:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8001d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d6:	89 10                	mov    %edx,(%eax)
+  8001d8:	83 ec 04             	sub    $0x4,%esp
+  8001db:	68 0c 70 80 00       	push   $0x80700c
+  8001e0:	68 10 70 80 00       	push   $0x807010
+  8001e5:	ff 35 0c 70 80 00    	push   0x80700c
+  8001eb:	e8 43 fe ff ff       	call   800033 <_gettoken>
+  8001f0:	a3 08 70 80 00       	mov    %eax,0x807008
+  8001f5:	a1 04 70 80 00       	mov    0x807004,%eax
+  8001fa:	83 c4 10             	add    $0x10,%esp
+  8001fd:	eb c2                	jmp    8001c1 <gettoken+0x2d>
+
+008001ff <runcmd>:
+  8001ff:	55                   	push   %ebp
+  800200:	89 e5                	mov    %esp,%ebp
+  800202:	57                   	push   %edi
+  800203:	56                   	push   %esi
+  800204:	53                   	push   %ebx
+  800205:	81 ec 74 04 00 00    	sub    $0x474,%esp
+  80020b:	6a 00                	push   $0x0
+  80020d:	ff 75 08             	push   0x8(%ebp)
+  800210:	e8 7f ff ff ff       	call   800194 <gettoken>
+  800215:	83 c4 10             	add    $0x10,%esp
+  800218:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+  80021b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800220:	83 ec 08             	sub    $0x8,%esp
+  800223:	56                   	push   %esi
+  800224:	6a 00                	push   $0x0
+  800226:	e8 69 ff ff ff       	call   800194 <gettoken>
+  80022b:	89 c7                	mov    %eax,%edi
+  80022d:	83 c4 10             	add    $0x10,%esp
+  800230:	83 f8 3e             	cmp    $0x3e,%eax
+  800233:	0f 84 3f 01 00 00    	je     800378 <runcmd+0x179>
+  800239:	7f 53                	jg     80028e <runcmd+0x8f>
+  80023b:	85 c0                	test   %eax,%eax
+  80023d:	0f 84 36 02 00 00    	je     800479 <runcmd+0x27a>
+  800243:	83 f8 3c             	cmp    $0x3c,%eax
+  800246:	0f 85 09 03 00 00    	jne    800555 <runcmd+0x356>
+  80024c:	83 ec 08             	sub    $0x8,%esp
+  80024f:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800252:	50                   	push   %eax
+  800253:	6a 00                	push   $0x0
+  800255:	e8 3a ff ff ff       	call   800194 <gettoken>
+  80025a:	83 c4 10             	add    $0x10,%esp
+  80025d:	83 f8 77             	cmp    $0x77,%eax
+  800260:	0f 85 c1 00 00 00    	jne    800327 <runcmd+0x128>
+  800266:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800269:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  80026f:	83 ec 08             	sub    $0x8,%esp
+  800272:	6a 00                	push   $0x0
+  800274:	50                   	push   %eax
+  800275:	e8 e7 2e 00 00       	call   803161 <open>
+  80027a:	89 c7                	mov    %eax,%edi
+  80027c:	83 c4 10             	add    $0x10,%esp
+  80027f:	85 c0                	test   %eax,%eax
+  800281:	0f 88 ba 00 00 00    	js     800341 <runcmd+0x142>
+  800287:	74 97                	je     800220 <runcmd+0x21>
+  800289:	e9 cf 00 00 00       	jmp    80035d <runcmd+0x15e>
+  80028e:	83 f8 77             	cmp    $0x77,%eax
+  800291:	74 69                	je     8002fc <runcmd+0xfd>
+  800293:	83 f8 7c             	cmp    $0x7c,%eax
+  800296:	0f 85 b9 02 00 00    	jne    800555 <runcmd+0x356>
+  80029c:	83 ec 0c             	sub    $0xc,%esp
+  80029f:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a5:	50                   	push   %eax
+  8002a6:	e8 57 40 00 00       	call   804302 <pipe>
+  8002ab:	83 c4 10             	add    $0x10,%esp
+  8002ae:	85 c0                	test   %eax,%eax
+  8002b0:	0f 88 51 01 00 00    	js     800407 <runcmd+0x208>
+  8002b6:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8002bd:	0f 85 5f 01 00 00    	jne    800422 <runcmd+0x223>
+  8002c3:	e8 63 1f 00 00       	call   80222b <fork>
+  8002c8:	89 c7                	mov    %eax,%edi
+  8002ca:	85 c0                	test   %eax,%eax
+  8002cc:	0f 88 71 01 00 00    	js     800443 <runcmd+0x244>
+  8002d2:	0f 85 81 01 00 00    	jne    800459 <runcmd+0x25a>
+  8002d8:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002de:	85 c0                	test   %eax,%eax
+  8002e0:	0f 85 2d 02 00 00    	jne    800513 <runcmd+0x314>
+  8002e6:	83 ec 0c             	sub    $0xc,%esp
+  8002e9:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002ef:	e8 74 25 00 00       	call   802868 <close>
+  8002f4:	83 c4 10             	add    $0x10,%esp
+  8002f7:	e9 1f ff ff ff       	jmp    80021b <runcmd+0x1c>
+  8002fc:	83 fb 10             	cmp    $0x10,%ebx
+  8002ff:	74 0f                	je     800310 <runcmd+0x111>
+  800301:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800304:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  800308:	8d 5b 01             	lea    0x1(%ebx),%ebx
+  80030b:	e9 10 ff ff ff       	jmp    800220 <runcmd+0x21>
+  800310:	83 ec 0c             	sub    $0xc,%esp
+  800313:	68 85 4c 80 00       	push   $0x804c85
+  800318:	e8 79 08 00 00       	call   800b96 <cprintf>
+  80031d:	e8 69 07 00 00       	call   800a8b <exit>
+  800322:	83 c4 10             	add    $0x10,%esp
+  800325:	eb da                	jmp    800301 <runcmd+0x102>
+  800327:	83 ec 0c             	sub    $0xc,%esp
+  80032a:	68 d8 4d 80 00       	push   $0x804dd8
+  80032f:	e8 62 08 00 00       	call   800b96 <cprintf>
+  800334:	e8 52 07 00 00       	call   800a8b <exit>
+  800339:	83 c4 10             	add    $0x10,%esp
+  80033c:	e9 25 ff ff ff       	jmp    800266 <runcmd+0x67>
+  800341:	83 ec 04             	sub    $0x4,%esp
+  800344:	50                   	push   %eax
+  800345:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  80034b:	68 99 4c 80 00       	push   $0x804c99
+  800350:	e8 41 08 00 00       	call   800b96 <cprintf>
+  800355:	e8 31 07 00 00       	call   800a8b <exit>
+  80035a:	83 c4 10             	add    $0x10,%esp
+  80035d:	83 ec 08             	sub    $0x8,%esp
+  800360:	6a 00                	push   $0x0
+  800362:	57                   	push   %edi
+  800363:	e8 52 25 00 00       	call   8028ba <dup>
+  800368:	89 3c 24             	mov    %edi,(%esp)
+  80036b:	e8 f8 24 00 00       	call   802868 <close>
+  800370:	83 c4 10             	add    $0x10,%esp
+  800373:	e9 a8 fe ff ff       	jmp    800220 <runcmd+0x21>
+  800378:	83 ec 08             	sub    $0x8,%esp
+  80037b:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80037e:	50                   	push   %eax
+  80037f:	6a 00                	push   $0x0
+  800381:	e8 0e fe ff ff       	call   800194 <gettoken>
+  800386:	83 c4 10             	add    $0x10,%esp
+  800389:	83 f8 77             	cmp    $0x77,%eax
+  80038c:	75 2b                	jne    8003b9 <runcmd+0x1ba>
+  80038e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800391:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800397:	83 ec 08             	sub    $0x8,%esp
+  80039a:	68 01 03 00 00       	push   $0x301
+  80039f:	50                   	push   %eax
+  8003a0:	e8 bc 2d 00 00       	call   803161 <open>
+  8003a5:	89 c7                	mov    %eax,%edi
+  8003a7:	83 c4 10             	add    $0x10,%esp
+  8003aa:	85 c0                	test   %eax,%eax
+  8003ac:	78 22                	js     8003d0 <runcmd+0x1d1>
+  8003ae:	83 f8 01             	cmp    $0x1,%eax
+  8003b1:	0f 84 69 fe ff ff    	je     800220 <runcmd+0x21>
+  8003b7:	eb 33                	jmp    8003ec <runcmd+0x1ed>
+  8003b9:	83 ec 0c             	sub    $0xc,%esp
+  8003bc:	68 00 4e 80 00       	push   $0x804e00
+  8003c1:	e8 d0 07 00 00       	call   800b96 <cprintf>
+  8003c6:	e8 c0 06 00 00       	call   800a8b <exit>
+  8003cb:	83 c4 10             	add    $0x10,%esp
+  8003ce:	eb be                	jmp    80038e <runcmd+0x18f>
+  8003d0:	83 ec 04             	sub    $0x4,%esp
+  8003d3:	50                   	push   %eax
+  8003d4:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003da:	68 ae 4c 80 00       	push   $0x804cae
+  8003df:	e8 b2 07 00 00       	call   800b96 <cprintf>
+  8003e4:	e8 a2 06 00 00       	call   800a8b <exit>
+  8003e9:	83 c4 10             	add    $0x10,%esp
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	6a 01                	push   $0x1
+  8003f1:	57                   	push   %edi
+  8003f2:	e8 c3 24 00 00       	call   8028ba <dup>
+  8003f7:	89 3c 24             	mov    %edi,(%esp)
+  8003fa:	e8 69 24 00 00       	call   802868 <close>
+  8003ff:	83 c4 10             	add    $0x10,%esp
+  800402:	e9 19 fe ff ff       	jmp    800220 <runcmd+0x21>
+  800407:	83 ec 08             	sub    $0x8,%esp
+  80040a:	50                   	push   %eax
+  80040b:	68 c4 4c 80 00       	push   $0x804cc4
+  800410:	e8 81 07 00 00       	call   800b96 <cprintf>
+  800415:	e8 71 06 00 00       	call   800a8b <exit>
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	e9 94 fe ff ff       	jmp    8002b6 <runcmd+0xb7>
+  800422:	83 ec 04             	sub    $0x4,%esp
+  800425:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  80042b:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800431:	68 cd 4c 80 00       	push   $0x804ccd
+  800436:	e8 5b 07 00 00       	call   800b96 <cprintf>
+  80043b:	83 c4 10             	add    $0x10,%esp
+  80043e:	e9 80 fe ff ff       	jmp    8002c3 <runcmd+0xc4>
+  800443:	83 ec 08             	sub    $0x8,%esp
+  800446:	50                   	push   %eax
+  800447:	68 da 4c 80 00       	push   $0x804cda
+  80044c:	e8 45 07 00 00       	call   800b96 <cprintf>
+  800451:	e8 35 06 00 00       	call   800a8b <exit>
+  800456:	83 c4 10             	add    $0x10,%esp
+  800459:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  80045f:	83 f8 01             	cmp    $0x1,%eax
+  800462:	0f 85 cc 00 00 00    	jne    800534 <runcmd+0x335>
+  800468:	83 ec 0c             	sub    $0xc,%esp
+  80046b:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800471:	e8 f2 23 00 00       	call   802868 <close>
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	85 db                	test   %ebx,%ebx
+  80047b:	0f 84 e6 00 00 00    	je     800567 <runcmd+0x368>
+  800481:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  800484:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800487:	0f 85 f5 00 00 00    	jne    800582 <runcmd+0x383>
+  80048d:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  800494:	00 
+  800495:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80049c:	0f 85 08 01 00 00    	jne    8005aa <runcmd+0x3ab>
+  8004a2:	83 ec 08             	sub    $0x8,%esp
+  8004a5:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8004a8:	50                   	push   %eax
+  8004a9:	ff 75 a8             	push   -0x58(%ebp)
+  8004ac:	e8 f2 36 00 00       	call   803ba3 <spawn>
+  8004b1:	89 c3                	mov    %eax,%ebx
+  8004b3:	83 c4 10             	add    $0x10,%esp
+  8004b6:	85 c0                	test   %eax,%eax
+  8004b8:	0f 88 3f 01 00 00    	js     8005fd <runcmd+0x3fe>
+  8004be:	e8 d2 23 00 00       	call   802895 <close_all>
+  8004c3:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8004ca:	0f 85 7a 01 00 00    	jne    80064a <runcmd+0x44b>
+  8004d0:	83 ec 0c             	sub    $0xc,%esp
+  8004d3:	53                   	push   %ebx
+  8004d4:	e8 a6 3f 00 00       	call   80447f <wait>
+  8004d9:	83 c4 10             	add    $0x10,%esp
+  8004dc:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8004e3:	0f 85 80 01 00 00    	jne    800669 <runcmd+0x46a>
+  8004e9:	85 ff                	test   %edi,%edi
+  8004eb:	74 19                	je     800506 <runcmd+0x307>
+  8004ed:	83 ec 0c             	sub    $0xc,%esp
+  8004f0:	57                   	push   %edi
+  8004f1:	e8 89 3f 00 00       	call   80447f <wait>
+  8004f6:	83 c4 10             	add    $0x10,%esp
+  8004f9:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800500:	0f 85 7e 01 00 00    	jne    800684 <runcmd+0x485>
+  800506:	e8 80 05 00 00       	call   800a8b <exit>
+  80050b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80050e:	5b                   	pop    %ebx
+  80050f:	5e                   	pop    %esi
+  800510:	5f                   	pop    %edi
+  800511:	5d                   	pop    %ebp
+  800512:	c3                   	ret
+  800513:	83 ec 08             	sub    $0x8,%esp
+  800516:	6a 00                	push   $0x0
+  800518:	50                   	push   %eax
+  800519:	e8 9c 23 00 00       	call   8028ba <dup>
+  80051e:	83 c4 04             	add    $0x4,%esp
+  800521:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800527:	e8 3c 23 00 00       	call   802868 <close>
+  80052c:	83 c4 10             	add    $0x10,%esp
+  80052f:	e9 b2 fd ff ff       	jmp    8002e6 <runcmd+0xe7>
+  800534:	83 ec 08             	sub    $0x8,%esp
+  800537:	6a 01                	push   $0x1
+  800539:	50                   	push   %eax
+  80053a:	e8 7b 23 00 00       	call   8028ba <dup>
+  80053f:	83 c4 04             	add    $0x4,%esp
+  800542:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800548:	e8 1b 23 00 00       	call   802868 <close>
+  80054d:	83 c4 10             	add    $0x10,%esp
+  800550:	e9 13 ff ff ff       	jmp    800468 <runcmd+0x269>
+  800555:	57                   	push   %edi
+  800556:	68 e3 4c 80 00       	push   $0x804ce3
+  80055b:	6a 6e                	push   $0x6e
+  80055d:	68 ff 4c 80 00       	push   $0x804cff
+  800562:	e8 54 05 00 00       	call   800abb <_panic>
+  800567:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80056e:	74 9b                	je     80050b <runcmd+0x30c>
+  800570:	83 ec 0c             	sub    $0xc,%esp
+  800573:	68 09 4d 80 00       	push   $0x804d09
+  800578:	e8 19 06 00 00       	call   800b96 <cprintf>
+  80057d:	83 c4 10             	add    $0x10,%esp
+  800580:	eb 89                	jmp    80050b <runcmd+0x30c>
+  800582:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+  800589:	83 ec 08             	sub    $0x8,%esp
+  80058c:	50                   	push   %eax
+  80058d:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  800593:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  800599:	50                   	push   %eax
+  80059a:	e8 de 0d 00 00       	call   80137d <strcpy>
+  80059f:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  8005a2:	83 c4 10             	add    $0x10,%esp
+  8005a5:	e9 e3 fe ff ff       	jmp    80048d <runcmd+0x28e>
+  8005aa:	a1 34 74 80 00       	mov    0x807434,%eax
+  8005af:	8b 40 48             	mov    0x48(%eax),%eax
+  8005b2:	83 ec 08             	sub    $0x8,%esp
+  8005b5:	50                   	push   %eax
+  8005b6:	68 18 4d 80 00       	push   $0x804d18
+  8005bb:	e8 d6 05 00 00       	call   800b96 <cprintf>
+  8005c0:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  8005c3:	83 c4 10             	add    $0x10,%esp
+  8005c6:	85 c0                	test   %eax,%eax
+  8005c8:	74 1e                	je     8005e8 <runcmd+0x3e9>
+  8005ca:	8d 5d ac             	lea    -0x54(%ebp),%ebx
+  8005cd:	83 ec 08             	sub    $0x8,%esp
+  8005d0:	50                   	push   %eax
+  8005d1:	68 a0 4d 80 00       	push   $0x804da0
+  8005d6:	e8 bb 05 00 00       	call   800b96 <cprintf>
+  8005db:	83 c3 04             	add    $0x4,%ebx
+  8005de:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  8005e1:	83 c4 10             	add    $0x10,%esp
+  8005e4:	85 c0                	test   %eax,%eax
+  8005e6:	75 e5                	jne    8005cd <runcmd+0x3ce>
+  8005e8:	83 ec 0c             	sub    $0xc,%esp
+  8005eb:	68 60 4c 80 00       	push   $0x804c60
+  8005f0:	e8 a1 05 00 00       	call   800b96 <cprintf>
+  8005f5:	83 c4 10             	add    $0x10,%esp
+  8005f8:	e9 a5 fe ff ff       	jmp    8004a2 <runcmd+0x2a3>
+  8005fd:	83 ec 04             	sub    $0x4,%esp
+  800600:	50                   	push   %eax
+  800601:	ff 75 a8             	push   -0x58(%ebp)
+  800604:	68 26 4d 80 00       	push   $0x804d26
+  800609:	e8 88 05 00 00       	call   800b96 <cprintf>
+  80060e:	e8 82 22 00 00       	call   802895 <close_all>
+  800613:	83 c4 10             	add    $0x10,%esp
+  800616:	85 ff                	test   %edi,%edi
+  800618:	0f 84 e8 fe ff ff    	je     800506 <runcmd+0x307>
+  80061e:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800625:	0f 84 c2 fe ff ff    	je     8004ed <runcmd+0x2ee>
+  80062b:	a1 34 74 80 00       	mov    0x807434,%eax
+  800630:	8b 40 48             	mov    0x48(%eax),%eax
+  800633:	83 ec 04             	sub    $0x4,%esp
+  800636:	57                   	push   %edi
+  800637:	50                   	push   %eax
+  800638:	68 5f 4d 80 00       	push   $0x804d5f
+  80063d:	e8 54 05 00 00       	call   800b96 <cprintf>
+  800642:	83 c4 10             	add    $0x10,%esp
+  800645:	e9 a3 fe ff ff       	jmp    8004ed <runcmd+0x2ee>
+  80064a:	a1 34 74 80 00       	mov    0x807434,%eax
+  80064f:	8b 40 48             	mov    0x48(%eax),%eax
+  800652:	53                   	push   %ebx
+  800653:	ff 75 a8             	push   -0x58(%ebp)
+  800656:	50                   	push   %eax
+  800657:	68 34 4d 80 00       	push   $0x804d34
+  80065c:	e8 35 05 00 00       	call   800b96 <cprintf>
+  800661:	83 c4 10             	add    $0x10,%esp
+  800664:	e9 67 fe ff ff       	jmp    8004d0 <runcmd+0x2d1>
+  800669:	a1 34 74 80 00       	mov    0x807434,%eax
+  80066e:	8b 40 48             	mov    0x48(%eax),%eax
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	50                   	push   %eax
+  800675:	68 49 4d 80 00       	push   $0x804d49
+  80067a:	e8 17 05 00 00       	call   800b96 <cprintf>
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	eb 92                	jmp    800616 <runcmd+0x417>
+  800684:	a1 34 74 80 00       	mov    0x807434,%eax
+  800689:	8b 40 48             	mov    0x48(%eax),%eax
+  80068c:	83 ec 08             	sub    $0x8,%esp
+  80068f:	50                   	push   %eax
+  800690:	68 49 4d 80 00       	push   $0x804d49
+  800695:	e8 fc 04 00 00       	call   800b96 <cprintf>
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	e9 64 fe ff ff       	jmp    800506 <runcmd+0x307>
+
+008006a2 <usage>:
+  8006a2:	55                   	push   %ebp
+  8006a3:	89 e5                	mov    %esp,%ebp
+  8006a5:	83 ec 14             	sub    $0x14,%esp
+  8006a8:	68 28 4e 80 00       	push   $0x804e28
+  8006ad:	e8 e4 04 00 00       	call   800b96 <cprintf>
+  8006b2:	e8 d4 03 00 00       	call   800a8b <exit>
+  8006b7:	83 c4 10             	add    $0x10,%esp
+  8006ba:	c9                   	leave
+  8006bb:	c3                   	ret
+
+008006bc <umain>:
+  8006bc:	55                   	push   %ebp
+  8006bd:	89 e5                	mov    %esp,%ebp
+  8006bf:	57                   	push   %edi
+  8006c0:	56                   	push   %esi
+  8006c1:	53                   	push   %ebx
+  8006c2:	83 ec 30             	sub    $0x30,%esp
+  8006c5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8006c8:	50                   	push   %eax
+  8006c9:	ff 75 0c             	push   0xc(%ebp)
+  8006cc:	8d 45 08             	lea    0x8(%ebp),%eax
+  8006cf:	50                   	push   %eax
+  8006d0:	e8 a7 1e 00 00       	call   80257c <argstart>
+  8006d5:	83 c4 10             	add    $0x10,%esp
+  8006d8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8006df:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006e4:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8006e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8006ec:	eb 10                	jmp    8006fe <umain+0x42>
+  8006ee:	83 05 00 70 80 00 01 	addl   $0x1,0x807000
+  8006f5:	eb 07                	jmp    8006fe <umain+0x42>
+  8006f7:	89 f7                	mov    %esi,%edi
+  8006f9:	eb 03                	jmp    8006fe <umain+0x42>
+  8006fb:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8006fe:	83 ec 0c             	sub    $0xc,%esp
+  800701:	53                   	push   %ebx
+  800702:	e8 a5 1e 00 00       	call   8025ac <argnext>
+  800707:	83 c4 10             	add    $0x10,%esp
+  80070a:	85 c0                	test   %eax,%eax
+  80070c:	78 16                	js     800724 <umain+0x68>
+  80070e:	83 f8 69             	cmp    $0x69,%eax
+  800711:	74 e4                	je     8006f7 <umain+0x3b>
+  800713:	83 f8 78             	cmp    $0x78,%eax
+  800716:	74 e3                	je     8006fb <umain+0x3f>
+  800718:	83 f8 64             	cmp    $0x64,%eax
+  80071b:	74 d1                	je     8006ee <umain+0x32>
+  80071d:	e8 80 ff ff ff       	call   8006a2 <usage>
+  800722:	eb da                	jmp    8006fe <umain+0x42>
+  800724:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  800728:	7f 1f                	jg     800749 <umain+0x8d>
+  80072a:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  80072e:	74 20                	je     800750 <umain+0x94>
+  800730:	83 ff 3f             	cmp    $0x3f,%edi
+  800733:	74 75                	je     8007aa <umain+0xee>
+  800735:	85 ff                	test   %edi,%edi
+  800737:	bf a4 4d 80 00       	mov    $0x804da4,%edi
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	0f 44 f8             	cmove  %eax,%edi
+  800744:	e9 06 01 00 00       	jmp    80084f <umain+0x193>
+  800749:	e8 54 ff ff ff       	call   8006a2 <usage>
+  80074e:	eb da                	jmp    80072a <umain+0x6e>
+  800750:	83 ec 0c             	sub    $0xc,%esp
+  800753:	6a 00                	push   $0x0
+  800755:	e8 0e 21 00 00       	call   802868 <close>
+  80075a:	83 c4 08             	add    $0x8,%esp
+  80075d:	6a 00                	push   $0x0
+  80075f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800762:	ff 70 04             	push   0x4(%eax)
+  800765:	e8 f7 29 00 00       	call   803161 <open>
+  80076a:	83 c4 10             	add    $0x10,%esp
+  80076d:	85 c0                	test   %eax,%eax
+  80076f:	78 1b                	js     80078c <umain+0xd0>
+  800771:	74 bd                	je     800730 <umain+0x74>
+  800773:	68 88 4d 80 00       	push   $0x804d88
+  800778:	68 8f 4d 80 00       	push   $0x804d8f
+  80077d:	68 1f 01 00 00       	push   $0x11f
+  800782:	68 ff 4c 80 00       	push   $0x804cff
+  800787:	e8 2f 03 00 00       	call   800abb <_panic>
+  80078c:	83 ec 0c             	sub    $0xc,%esp
+  80078f:	50                   	push   %eax
+  800790:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800793:	ff 70 04             	push   0x4(%eax)
+  800796:	68 7c 4d 80 00       	push   $0x804d7c
+  80079b:	68 1e 01 00 00       	push   $0x11e
+  8007a0:	68 ff 4c 80 00       	push   $0x804cff
+  8007a5:	e8 11 03 00 00       	call   800abb <_panic>
+  8007aa:	83 ec 0c             	sub    $0xc,%esp
+  8007ad:	6a 00                	push   $0x0
+  8007af:	e8 10 02 00 00       	call   8009c4 <iscons>
+  8007b4:	89 c7                	mov    %eax,%edi
+  8007b6:	83 c4 10             	add    $0x10,%esp
+  8007b9:	e9 77 ff ff ff       	jmp    800735 <umain+0x79>
+  8007be:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8007c5:	75 0a                	jne    8007d1 <umain+0x115>
+  8007c7:	e8 bf 02 00 00       	call   800a8b <exit>
+  8007cc:	e9 94 00 00 00       	jmp    800865 <umain+0x1a9>
+  8007d1:	83 ec 0c             	sub    $0xc,%esp
+  8007d4:	68 a7 4d 80 00       	push   $0x804da7
+  8007d9:	e8 b8 03 00 00       	call   800b96 <cprintf>
+  8007de:	83 c4 10             	add    $0x10,%esp
+  8007e1:	eb e4                	jmp    8007c7 <umain+0x10b>
+  8007e3:	83 ec 08             	sub    $0x8,%esp
+  8007e6:	53                   	push   %ebx
+  8007e7:	68 b0 4d 80 00       	push   $0x804db0
+  8007ec:	e8 a5 03 00 00       	call   800b96 <cprintf>
+  8007f1:	83 c4 10             	add    $0x10,%esp
+  8007f4:	eb 7c                	jmp    800872 <umain+0x1b6>
+  8007f6:	83 ec 08             	sub    $0x8,%esp
+  8007f9:	53                   	push   %ebx
+  8007fa:	68 ba 4d 80 00       	push   $0x804dba
+  8007ff:	e8 ce 2b 00 00       	call   8033d2 <printf>
+  800804:	83 c4 10             	add    $0x10,%esp
+  800807:	eb 78                	jmp    800881 <umain+0x1c5>
+  800809:	83 ec 0c             	sub    $0xc,%esp
+  80080c:	68 c0 4d 80 00       	push   $0x804dc0
+  800811:	e8 80 03 00 00       	call   800b96 <cprintf>
+  800816:	83 c4 10             	add    $0x10,%esp
+  800819:	eb 73                	jmp    80088e <umain+0x1d2>
+  80081b:	50                   	push   %eax
+  80081c:	68 da 4c 80 00       	push   $0x804cda
+  800821:	68 36 01 00 00       	push   $0x136
+  800826:	68 ff 4c 80 00       	push   $0x804cff
+  80082b:	e8 8b 02 00 00       	call   800abb <_panic>
+  800830:	83 ec 08             	sub    $0x8,%esp
+  800833:	50                   	push   %eax
+  800834:	68 cd 4d 80 00       	push   $0x804dcd
+  800839:	e8 58 03 00 00       	call   800b96 <cprintf>
+  80083e:	83 c4 10             	add    $0x10,%esp
+  800841:	eb 5f                	jmp    8008a2 <umain+0x1e6>
+  800843:	83 ec 0c             	sub    $0xc,%esp
+  800846:	56                   	push   %esi
+  800847:	e8 33 3c 00 00       	call   80447f <wait>
+  80084c:	83 c4 10             	add    $0x10,%esp
+  80084f:	83 ec 0c             	sub    $0xc,%esp
+  800852:	57                   	push   %edi
+  800853:	e8 e9 09 00 00       	call   801241 <readline>
+  800858:	89 c3                	mov    %eax,%ebx
+  80085a:	83 c4 10             	add    $0x10,%esp
+  80085d:	85 c0                	test   %eax,%eax
+  80085f:	0f 84 59 ff ff ff    	je     8007be <umain+0x102>
+  800865:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80086c:	0f 85 71 ff ff ff    	jne    8007e3 <umain+0x127>
+  800872:	80 3b 23             	cmpb   $0x23,(%ebx)
+  800875:	74 d8                	je     80084f <umain+0x193>
+  800877:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80087b:	0f 85 75 ff ff ff    	jne    8007f6 <umain+0x13a>
+  800881:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800888:	0f 85 7b ff ff ff    	jne    800809 <umain+0x14d>
+  80088e:	e8 98 19 00 00       	call   80222b <fork>
+  800893:	89 c6                	mov    %eax,%esi
+  800895:	85 c0                	test   %eax,%eax
+  800897:	78 82                	js     80081b <umain+0x15f>
+  800899:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8008a0:	75 8e                	jne    800830 <umain+0x174>
+  8008a2:	85 f6                	test   %esi,%esi
+  8008a4:	75 9d                	jne    800843 <umain+0x187>
+  8008a6:	83 ec 0c             	sub    $0xc,%esp
+  8008a9:	53                   	push   %ebx
+  8008aa:	e8 50 f9 ff ff       	call   8001ff <runcmd>
+  8008af:	e8 d7 01 00 00       	call   800a8b <exit>
+  8008b4:	83 c4 10             	add    $0x10,%esp
+  8008b7:	eb 96                	jmp    80084f <umain+0x193>
+
+008008b9 <devcons_close>:
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008be:	c3                   	ret
+
+008008bf <devcons_stat>:
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	83 ec 10             	sub    $0x10,%esp
+  8008c5:	68 49 4e 80 00       	push   $0x804e49
+  8008ca:	ff 75 0c             	push   0xc(%ebp)
+  8008cd:	e8 ab 0a 00 00       	call   80137d <strcpy>
+  8008d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d7:	c9                   	leave
+  8008d8:	c3                   	ret
+
+008008d9 <devcons_write>:
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	57                   	push   %edi
+  8008dd:	56                   	push   %esi
+  8008de:	53                   	push   %ebx
+  8008df:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8008e5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8008e8:	85 ff                	test   %edi,%edi
+  8008ea:	74 51                	je     80093d <devcons_write+0x64>
+  8008ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f6:	89 fb                	mov    %edi,%ebx
+  8008f8:	29 c3                	sub    %eax,%ebx
+  8008fa:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8008ff:	39 d3                	cmp    %edx,%ebx
+  800901:	0f 47 da             	cmova  %edx,%ebx
+  800904:	83 ec 04             	sub    $0x4,%esp
+  800907:	53                   	push   %ebx
+  800908:	03 45 0c             	add    0xc(%ebp),%eax
+  80090b:	50                   	push   %eax
+  80090c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800912:	50                   	push   %eax
+  800913:	e8 15 0c 00 00       	call   80152d <memmove>
+  800918:	83 c4 08             	add    $0x8,%esp
+  80091b:	53                   	push   %ebx
+  80091c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800922:	50                   	push   %eax
+  800923:	e8 cd 0d 00 00       	call   8016f5 <sys_cputs>
+  800928:	01 de                	add    %ebx,%esi
+  80092a:	89 f0                	mov    %esi,%eax
+  80092c:	83 c4 10             	add    $0x10,%esp
+  80092f:	39 fe                	cmp    %edi,%esi
+  800931:	72 c3                	jb     8008f6 <devcons_write+0x1d>
+  800933:	89 f0                	mov    %esi,%eax
+  800935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800938:	5b                   	pop    %ebx
+  800939:	5e                   	pop    %esi
+  80093a:	5f                   	pop    %edi
+  80093b:	5d                   	pop    %ebp
+  80093c:	c3                   	ret
+  80093d:	be 00 00 00 00       	mov    $0x0,%esi
+  800942:	eb ef                	jmp    800933 <devcons_write+0x5a>
+
+00800944 <devcons_read>:
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	83 ec 08             	sub    $0x8,%esp
+  80094a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800953:	75 07                	jne    80095c <devcons_read+0x18>
+  800955:	eb 1f                	jmp    800976 <devcons_read+0x32>
+  800957:	e8 36 0e 00 00       	call   801792 <sys_yield>
+  80095c:	e8 b2 0d 00 00       	call   801713 <sys_cgetc>
+  800961:	85 c0                	test   %eax,%eax
+  800963:	74 f2                	je     800957 <devcons_read+0x13>
+  800965:	78 0f                	js     800976 <devcons_read+0x32>
+  800967:	83 f8 04             	cmp    $0x4,%eax
+  80096a:	74 0c                	je     800978 <devcons_read+0x34>
+  80096c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80096f:	88 02                	mov    %al,(%edx)
+  800971:	b8 01 00 00 00       	mov    $0x1,%eax
+  800976:	c9                   	leave
+  800977:	c3                   	ret
+  800978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097d:	eb f7                	jmp    800976 <devcons_read+0x32>
+
+0080097f <cputchar>:
+  80097f:	55                   	push   %ebp
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	83 ec 20             	sub    $0x20,%esp
+  800985:	8b 45 08             	mov    0x8(%ebp),%eax
+  800988:	88 45 f7             	mov    %al,-0x9(%ebp)
+  80098b:	6a 01                	push   $0x1
+  80098d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800990:	50                   	push   %eax
+  800991:	e8 5f 0d 00 00       	call   8016f5 <sys_cputs>
+  800996:	83 c4 10             	add    $0x10,%esp
+  800999:	c9                   	leave
+  80099a:	c3                   	ret
+
+0080099b <getchar>:
+  80099b:	55                   	push   %ebp
+  80099c:	89 e5                	mov    %esp,%ebp
+  80099e:	83 ec 1c             	sub    $0x1c,%esp
+  8009a1:	6a 01                	push   $0x1
+  8009a3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8009a6:	50                   	push   %eax
+  8009a7:	6a 00                	push   $0x0
+  8009a9:	e8 f6 1f 00 00       	call   8029a4 <read>
+  8009ae:	83 c4 10             	add    $0x10,%esp
+  8009b1:	85 c0                	test   %eax,%eax
+  8009b3:	78 06                	js     8009bb <getchar+0x20>
+  8009b5:	74 06                	je     8009bd <getchar+0x22>
+  8009b7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8009bb:	c9                   	leave
+  8009bc:	c3                   	ret
+  8009bd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8009c2:	eb f7                	jmp    8009bb <getchar+0x20>
+
+008009c4 <iscons>:
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	83 ec 20             	sub    $0x20,%esp
+  8009ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009cd:	50                   	push   %eax
+  8009ce:	ff 75 08             	push   0x8(%ebp)
+  8009d1:	e8 6c 1d 00 00       	call   802742 <fd_lookup>
+  8009d6:	83 c4 10             	add    $0x10,%esp
+  8009d9:	85 c0                	test   %eax,%eax
+  8009db:	78 11                	js     8009ee <iscons+0x2a>
+  8009dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e0:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8009e6:	39 10                	cmp    %edx,(%eax)
+  8009e8:	0f 94 c0             	sete   %al
+  8009eb:	0f b6 c0             	movzbl %al,%eax
+  8009ee:	c9                   	leave
+  8009ef:	c3                   	ret
+
+008009f0 <opencons>:
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	83 ec 24             	sub    $0x24,%esp
+  8009f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009f9:	50                   	push   %eax
+  8009fa:	e8 f3 1c 00 00       	call   8026f2 <fd_alloc>
+  8009ff:	83 c4 10             	add    $0x10,%esp
+  800a02:	85 c0                	test   %eax,%eax
+  800a04:	78 3a                	js     800a40 <opencons+0x50>
+  800a06:	83 ec 04             	sub    $0x4,%esp
+  800a09:	68 07 04 00 00       	push   $0x407
+  800a0e:	ff 75 f4             	push   -0xc(%ebp)
+  800a11:	6a 00                	push   $0x0
+  800a13:	e8 c5 0d 00 00       	call   8017dd <sys_page_alloc>
+  800a18:	83 c4 10             	add    $0x10,%esp
+  800a1b:	85 c0                	test   %eax,%eax
+  800a1d:	78 21                	js     800a40 <opencons+0x50>
+  800a1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a22:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800a28:	89 10                	mov    %edx,(%eax)
+  800a2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a2d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  800a34:	83 ec 0c             	sub    $0xc,%esp
+  800a37:	50                   	push   %eax
+  800a38:	e8 8e 1c 00 00       	call   8026cb <fd2num>
+  800a3d:	83 c4 10             	add    $0x10,%esp
+  800a40:	c9                   	leave
+  800a41:	c3                   	ret
+
+00800a42 <libmain>:
+  800a42:	55                   	push   %ebp
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	56                   	push   %esi
+  800a46:	53                   	push   %ebx
+  800a47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a4a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a4d:	e8 21 0d 00 00       	call   801773 <sys_getenvid>
+  800a52:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800a57:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800a5d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800a62:	a3 34 74 80 00       	mov    %eax,0x807434
+  800a67:	85 db                	test   %ebx,%ebx
+  800a69:	7e 07                	jle    800a72 <libmain+0x30>
+  800a6b:	8b 06                	mov    (%esi),%eax
+  800a6d:	a3 1c 60 80 00       	mov    %eax,0x80601c
+  800a72:	83 ec 08             	sub    $0x8,%esp
+  800a75:	56                   	push   %esi
+  800a76:	53                   	push   %ebx
+  800a77:	e8 40 fc ff ff       	call   8006bc <umain>
+  800a7c:	e8 0a 00 00 00       	call   800a8b <exit>
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a87:	5b                   	pop    %ebx
+  800a88:	5e                   	pop    %esi
+  800a89:	5d                   	pop    %ebp
+  800a8a:	c3                   	ret
+
+00800a8b <exit>:
+  800a8b:	55                   	push   %ebp
+  800a8c:	89 e5                	mov    %esp,%ebp
+  800a8e:	83 ec 08             	sub    $0x8,%esp
+  800a91:	a1 34 74 80 00       	mov    0x807434,%eax
+  800a96:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800a9c:	85 c0                	test   %eax,%eax
+  800a9e:	75 14                	jne    800ab4 <exit+0x29>
+  800aa0:	e8 f0 1d 00 00       	call   802895 <close_all>
+  800aa5:	83 ec 0c             	sub    $0xc,%esp
+  800aa8:	6a 00                	push   $0x0
+  800aaa:	e8 83 0c 00 00       	call   801732 <sys_env_destroy>
+  800aaf:	83 c4 10             	add    $0x10,%esp
+  800ab2:	c9                   	leave
+  800ab3:	c3                   	ret
+  800ab4:	e8 e6 13 00 00       	call   801e9f <sys_lease_complete>
+  800ab9:	eb e5                	jmp    800aa0 <exit+0x15>
+
+00800abb <_panic>:
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	56                   	push   %esi
+  800abf:	53                   	push   %ebx
+  800ac0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800ac3:	8b 35 1c 60 80 00    	mov    0x80601c,%esi
+  800ac9:	e8 a5 0c 00 00       	call   801773 <sys_getenvid>
+  800ace:	83 ec 0c             	sub    $0xc,%esp
+  800ad1:	ff 75 0c             	push   0xc(%ebp)
+  800ad4:	ff 75 08             	push   0x8(%ebp)
+  800ad7:	56                   	push   %esi
+  800ad8:	50                   	push   %eax
+  800ad9:	68 60 4e 80 00       	push   $0x804e60
+  800ade:	e8 b3 00 00 00       	call   800b96 <cprintf>
+  800ae3:	83 c4 18             	add    $0x18,%esp
+  800ae6:	53                   	push   %ebx
+  800ae7:	ff 75 10             	push   0x10(%ebp)
+  800aea:	e8 56 00 00 00       	call   800b45 <vcprintf>
+  800aef:	c7 04 24 60 4c 80 00 	movl   $0x804c60,(%esp)
+  800af6:	e8 9b 00 00 00       	call   800b96 <cprintf>
+  800afb:	83 c4 10             	add    $0x10,%esp
+  800afe:	cc                   	int3
+  800aff:	eb fd                	jmp    800afe <_panic+0x43>
+
+00800b01 <putch>:
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	53                   	push   %ebx
+  800b05:	83 ec 04             	sub    $0x4,%esp
+  800b08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b0b:	8b 13                	mov    (%ebx),%edx
+  800b0d:	8d 42 01             	lea    0x1(%edx),%eax
+  800b10:	89 03                	mov    %eax,(%ebx)
+  800b12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b15:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800b19:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800b1e:	74 09                	je     800b29 <putch+0x28>
+  800b20:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800b24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b27:	c9                   	leave
+  800b28:	c3                   	ret
+  800b29:	83 ec 08             	sub    $0x8,%esp
+  800b2c:	68 ff 00 00 00       	push   $0xff
+  800b31:	8d 43 08             	lea    0x8(%ebx),%eax
+  800b34:	50                   	push   %eax
+  800b35:	e8 bb 0b 00 00       	call   8016f5 <sys_cputs>
+  800b3a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800b40:	83 c4 10             	add    $0x10,%esp
+  800b43:	eb db                	jmp    800b20 <putch+0x1f>
+
+00800b45 <vcprintf>:
+  800b45:	55                   	push   %ebp
+  800b46:	89 e5                	mov    %esp,%ebp
+  800b48:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800b4e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800b55:	00 00 00 
+  800b58:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800b5f:	00 00 00 
+  800b62:	ff 75 0c             	push   0xc(%ebp)
+  800b65:	ff 75 08             	push   0x8(%ebp)
+  800b68:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800b6e:	50                   	push   %eax
+  800b6f:	68 01 0b 80 00       	push   $0x800b01
+  800b74:	e8 1c 01 00 00       	call   800c95 <vprintfmt>
+  800b79:	83 c4 08             	add    $0x8,%esp
+  800b7c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800b82:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800b88:	50                   	push   %eax
+  800b89:	e8 67 0b 00 00       	call   8016f5 <sys_cputs>
+  800b8e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800b94:	c9                   	leave
+  800b95:	c3                   	ret
+
+00800b96 <cprintf>:
+  800b96:	55                   	push   %ebp
+  800b97:	89 e5                	mov    %esp,%ebp
+  800b99:	83 ec 10             	sub    $0x10,%esp
+  800b9c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800b9f:	50                   	push   %eax
+  800ba0:	ff 75 08             	push   0x8(%ebp)
+  800ba3:	e8 9d ff ff ff       	call   800b45 <vcprintf>
+  800ba8:	c9                   	leave
+  800ba9:	c3                   	ret
+
+00800baa <printnum>:
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	57                   	push   %edi
+  800bae:	56                   	push   %esi
+  800baf:	53                   	push   %ebx
+  800bb0:	83 ec 1c             	sub    $0x1c,%esp
+  800bb3:	89 c3                	mov    %eax,%ebx
+  800bb5:	89 d6                	mov    %edx,%esi
+  800bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bbd:	89 d1                	mov    %edx,%ecx
+  800bbf:	89 c2                	mov    %eax,%edx
+  800bc1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bc4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bc7:	8b 45 10             	mov    0x10(%ebp),%eax
+  800bca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800bcd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800bd4:	39 c2                	cmp    %eax,%edx
+  800bd6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800bd9:	73 4b                	jae    800c26 <printnum+0x7c>
+  800bdb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bde:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800be1:	85 ff                	test   %edi,%edi
+  800be3:	7e 11                	jle    800bf6 <printnum+0x4c>
+  800be5:	83 ec 08             	sub    $0x8,%esp
+  800be8:	56                   	push   %esi
+  800be9:	ff 75 18             	push   0x18(%ebp)
+  800bec:	ff d3                	call   *%ebx
+  800bee:	83 c4 10             	add    $0x10,%esp
+  800bf1:	83 ef 01             	sub    $0x1,%edi
+  800bf4:	75 ef                	jne    800be5 <printnum+0x3b>
+  800bf6:	83 ec 08             	sub    $0x8,%esp
+  800bf9:	56                   	push   %esi
+  800bfa:	83 ec 04             	sub    $0x4,%esp
+  800bfd:	ff 75 e4             	push   -0x1c(%ebp)
+  800c00:	ff 75 e0             	push   -0x20(%ebp)
+  800c03:	ff 75 dc             	push   -0x24(%ebp)
+  800c06:	ff 75 d8             	push   -0x28(%ebp)
+  800c09:	e8 25 3f 00 00       	call   804b33 <__umoddi3>
+  800c0e:	83 c4 14             	add    $0x14,%esp
+  800c11:	0f be 80 83 4e 80 00 	movsbl 0x804e83(%eax),%eax
+  800c18:	50                   	push   %eax
+  800c19:	ff d3                	call   *%ebx
+  800c1b:	83 c4 10             	add    $0x10,%esp
+  800c1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c21:	5b                   	pop    %ebx
+  800c22:	5e                   	pop    %esi
+  800c23:	5f                   	pop    %edi
+  800c24:	5d                   	pop    %ebp
+  800c25:	c3                   	ret
+  800c26:	83 ec 0c             	sub    $0xc,%esp
+  800c29:	ff 75 18             	push   0x18(%ebp)
+  800c2c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c2f:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800c32:	52                   	push   %edx
+  800c33:	50                   	push   %eax
+  800c34:	83 ec 08             	sub    $0x8,%esp
+  800c37:	ff 75 e4             	push   -0x1c(%ebp)
+  800c3a:	ff 75 e0             	push   -0x20(%ebp)
+  800c3d:	ff 75 dc             	push   -0x24(%ebp)
+  800c40:	ff 75 d8             	push   -0x28(%ebp)
+  800c43:	e8 cd 3e 00 00       	call   804b15 <__udivdi3>
+  800c48:	83 c4 18             	add    $0x18,%esp
+  800c4b:	52                   	push   %edx
+  800c4c:	50                   	push   %eax
+  800c4d:	89 f2                	mov    %esi,%edx
+  800c4f:	89 d8                	mov    %ebx,%eax
+  800c51:	e8 54 ff ff ff       	call   800baa <printnum>
+  800c56:	83 c4 20             	add    $0x20,%esp
+  800c59:	eb 9b                	jmp    800bf6 <printnum+0x4c>
+
+00800c5b <sprintputch>:
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c61:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800c65:	8b 10                	mov    (%eax),%edx
+  800c67:	3b 50 04             	cmp    0x4(%eax),%edx
+  800c6a:	73 0a                	jae    800c76 <sprintputch+0x1b>
+  800c6c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800c6f:	89 08                	mov    %ecx,(%eax)
+  800c71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c74:	88 02                	mov    %al,(%edx)
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+
+00800c78 <printfmt>:
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	83 ec 08             	sub    $0x8,%esp
+  800c7e:	8d 45 14             	lea    0x14(%ebp),%eax
+  800c81:	50                   	push   %eax
+  800c82:	ff 75 10             	push   0x10(%ebp)
+  800c85:	ff 75 0c             	push   0xc(%ebp)
+  800c88:	ff 75 08             	push   0x8(%ebp)
+  800c8b:	e8 05 00 00 00       	call   800c95 <vprintfmt>
+  800c90:	83 c4 10             	add    $0x10,%esp
+  800c93:	c9                   	leave
+  800c94:	c3                   	ret
+
+00800c95 <vprintfmt>:
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	57                   	push   %edi
+  800c99:	56                   	push   %esi
+  800c9a:	53                   	push   %ebx
+  800c9b:	83 ec 2c             	sub    $0x2c,%esp
+  800c9e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ca1:	89 df                	mov    %ebx,%edi
+  800ca3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ca6:	8b 45 10             	mov    0x10(%ebp),%eax
+  800ca9:	8d 70 01             	lea    0x1(%eax),%esi
+  800cac:	0f b6 00             	movzbl (%eax),%eax
+  800caf:	83 f8 25             	cmp    $0x25,%eax
+  800cb2:	74 1e                	je     800cd2 <vprintfmt+0x3d>
+  800cb4:	85 c0                	test   %eax,%eax
+  800cb6:	0f 84 15 05 00 00    	je     8011d1 <vprintfmt+0x53c>
+  800cbc:	83 ec 08             	sub    $0x8,%esp
+  800cbf:	53                   	push   %ebx
+  800cc0:	50                   	push   %eax
+  800cc1:	ff d7                	call   *%edi
+  800cc3:	83 c6 01             	add    $0x1,%esi
+  800cc6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800cca:	83 c4 10             	add    $0x10,%esp
+  800ccd:	83 f8 25             	cmp    $0x25,%eax
+  800cd0:	75 e2                	jne    800cb4 <vprintfmt+0x1f>
+  800cd2:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800cd6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800cdd:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800ce4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800ceb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf0:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800cf3:	8d 56 01             	lea    0x1(%esi),%edx
+  800cf6:	0f b6 0e             	movzbl (%esi),%ecx
+  800cf9:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800cfc:	3c 55                	cmp    $0x55,%al
+  800cfe:	0f 87 3b 04 00 00    	ja     80113f <vprintfmt+0x4aa>
+  800d04:	0f b6 c0             	movzbl %al,%eax
+  800d07:	ff 24 85 c0 4f 80 00 	jmp    *0x804fc0(,%eax,4)
+  800d0e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800d11:	eb 93                	jmp    800ca6 <vprintfmt+0x11>
+  800d13:	89 d6                	mov    %edx,%esi
+  800d15:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800d19:	eb d8                	jmp    800cf3 <vprintfmt+0x5e>
+  800d1b:	89 d6                	mov    %edx,%esi
+  800d1d:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800d21:	eb d0                	jmp    800cf3 <vprintfmt+0x5e>
+  800d23:	0f b6 c9             	movzbl %cl,%ecx
+  800d26:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800d29:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800d2c:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800d30:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800d33:	83 f9 09             	cmp    $0x9,%ecx
+  800d36:	77 6f                	ja     800da7 <vprintfmt+0x112>
+  800d38:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800d3b:	83 c2 01             	add    $0x1,%edx
+  800d3e:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800d41:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800d45:	0f be 02             	movsbl (%edx),%eax
+  800d48:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d4b:	83 fe 09             	cmp    $0x9,%esi
+  800d4e:	76 eb                	jbe    800d3b <vprintfmt+0xa6>
+  800d50:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800d53:	89 d6                	mov    %edx,%esi
+  800d55:	eb 13                	jmp    800d6a <vprintfmt+0xd5>
+  800d57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d5a:	8b 00                	mov    (%eax),%eax
+  800d5c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800d5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d62:	8d 40 04             	lea    0x4(%eax),%eax
+  800d65:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d68:	89 d6                	mov    %edx,%esi
+  800d6a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800d6e:	79 83                	jns    800cf3 <vprintfmt+0x5e>
+  800d70:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800d73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800d76:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800d7d:	e9 71 ff ff ff       	jmp    800cf3 <vprintfmt+0x5e>
+  800d82:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800d85:	85 c9                	test   %ecx,%ecx
+  800d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8c:	0f 49 c1             	cmovns %ecx,%eax
+  800d8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800d92:	89 d6                	mov    %edx,%esi
+  800d94:	e9 5a ff ff ff       	jmp    800cf3 <vprintfmt+0x5e>
+  800d99:	89 d6                	mov    %edx,%esi
+  800d9b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800da2:	e9 4c ff ff ff       	jmp    800cf3 <vprintfmt+0x5e>
+  800da7:	89 d6                	mov    %edx,%esi
+  800da9:	eb bf                	jmp    800d6a <vprintfmt+0xd5>
+  800dab:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800daf:	89 d6                	mov    %edx,%esi
+  800db1:	e9 3d ff ff ff       	jmp    800cf3 <vprintfmt+0x5e>
+  800db6:	89 55 10             	mov    %edx,0x10(%ebp)
+  800db9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dbc:	8d 70 04             	lea    0x4(%eax),%esi
+  800dbf:	83 ec 08             	sub    $0x8,%esp
+  800dc2:	53                   	push   %ebx
+  800dc3:	ff 30                	push   (%eax)
+  800dc5:	ff d7                	call   *%edi
+  800dc7:	83 c4 10             	add    $0x10,%esp
+  800dca:	89 75 14             	mov    %esi,0x14(%ebp)
+  800dcd:	e9 d4 fe ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  800dd2:	89 55 10             	mov    %edx,0x10(%ebp)
+  800dd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd8:	8d 70 04             	lea    0x4(%eax),%esi
+  800ddb:	8b 10                	mov    (%eax),%edx
+  800ddd:	89 d0                	mov    %edx,%eax
+  800ddf:	f7 d8                	neg    %eax
+  800de1:	0f 48 c2             	cmovs  %edx,%eax
+  800de4:	83 f8 12             	cmp    $0x12,%eax
+  800de7:	7f 23                	jg     800e0c <vprintfmt+0x177>
+  800de9:	8b 14 85 20 51 80 00 	mov    0x805120(,%eax,4),%edx
+  800df0:	85 d2                	test   %edx,%edx
+  800df2:	74 18                	je     800e0c <vprintfmt+0x177>
+  800df4:	52                   	push   %edx
+  800df5:	68 a1 4d 80 00       	push   $0x804da1
+  800dfa:	53                   	push   %ebx
+  800dfb:	57                   	push   %edi
+  800dfc:	e8 77 fe ff ff       	call   800c78 <printfmt>
+  800e01:	83 c4 10             	add    $0x10,%esp
+  800e04:	89 75 14             	mov    %esi,0x14(%ebp)
+  800e07:	e9 9a fe ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  800e0c:	50                   	push   %eax
+  800e0d:	68 9b 4e 80 00       	push   $0x804e9b
+  800e12:	53                   	push   %ebx
+  800e13:	57                   	push   %edi
+  800e14:	e8 5f fe ff ff       	call   800c78 <printfmt>
+  800e19:	83 c4 10             	add    $0x10,%esp
+  800e1c:	89 75 14             	mov    %esi,0x14(%ebp)
+  800e1f:	e9 82 fe ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  800e24:	89 55 10             	mov    %edx,0x10(%ebp)
+  800e27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e2a:	83 c0 04             	add    $0x4,%eax
+  800e2d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800e30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e33:	8b 00                	mov    (%eax),%eax
+  800e35:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e38:	85 c0                	test   %eax,%eax
+  800e3a:	0f 84 61 03 00 00    	je     8011a1 <vprintfmt+0x50c>
+  800e40:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800e44:	7e 06                	jle    800e4c <vprintfmt+0x1b7>
+  800e46:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800e4a:	75 29                	jne    800e75 <vprintfmt+0x1e0>
+  800e4c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e4f:	8d 70 01             	lea    0x1(%eax),%esi
+  800e52:	0f b6 00             	movzbl (%eax),%eax
+  800e55:	0f be d0             	movsbl %al,%edx
+  800e58:	85 d2                	test   %edx,%edx
+  800e5a:	0f 84 bb 00 00 00    	je     800f1b <vprintfmt+0x286>
+  800e60:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800e63:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800e66:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800e69:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e6c:	eb 7a                	jmp    800ee8 <vprintfmt+0x253>
+  800e6e:	c7 45 d0 94 4e 80 00 	movl   $0x804e94,-0x30(%ebp)
+  800e75:	83 ec 08             	sub    $0x8,%esp
+  800e78:	ff 75 d4             	push   -0x2c(%ebp)
+  800e7b:	ff 75 d0             	push   -0x30(%ebp)
+  800e7e:	e8 d0 04 00 00       	call   801353 <strnlen>
+  800e83:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800e86:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800e89:	83 c4 10             	add    $0x10,%esp
+  800e8c:	85 d2                	test   %edx,%edx
+  800e8e:	0f 8e d6 02 00 00    	jle    80116a <vprintfmt+0x4d5>
+  800e94:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800e98:	83 ec 08             	sub    $0x8,%esp
+  800e9b:	53                   	push   %ebx
+  800e9c:	56                   	push   %esi
+  800e9d:	ff d7                	call   *%edi
+  800e9f:	83 c4 10             	add    $0x10,%esp
+  800ea2:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800ea6:	75 f0                	jne    800e98 <vprintfmt+0x203>
+  800ea8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800eab:	8d 70 01             	lea    0x1(%eax),%esi
+  800eae:	0f b6 00             	movzbl (%eax),%eax
+  800eb1:	0f be d0             	movsbl %al,%edx
+  800eb4:	85 d2                	test   %edx,%edx
+  800eb6:	0f 84 da 02 00 00    	je     801196 <vprintfmt+0x501>
+  800ebc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ebf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ec2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ec5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ec8:	eb 1e                	jmp    800ee8 <vprintfmt+0x253>
+  800eca:	83 ec 08             	sub    $0x8,%esp
+  800ecd:	ff 75 0c             	push   0xc(%ebp)
+  800ed0:	52                   	push   %edx
+  800ed1:	ff 55 08             	call   *0x8(%ebp)
+  800ed4:	83 c4 10             	add    $0x10,%esp
+  800ed7:	83 eb 01             	sub    $0x1,%ebx
+  800eda:	83 c6 01             	add    $0x1,%esi
+  800edd:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800ee1:	0f be d0             	movsbl %al,%edx
+  800ee4:	85 d2                	test   %edx,%edx
+  800ee6:	74 2a                	je     800f12 <vprintfmt+0x27d>
+  800ee8:	85 ff                	test   %edi,%edi
+  800eea:	78 05                	js     800ef1 <vprintfmt+0x25c>
+  800eec:	83 ef 01             	sub    $0x1,%edi
+  800eef:	78 59                	js     800f4a <vprintfmt+0x2b5>
+  800ef1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800ef5:	74 d3                	je     800eca <vprintfmt+0x235>
+  800ef7:	0f be c0             	movsbl %al,%eax
+  800efa:	83 e8 20             	sub    $0x20,%eax
+  800efd:	83 f8 5e             	cmp    $0x5e,%eax
+  800f00:	76 c8                	jbe    800eca <vprintfmt+0x235>
+  800f02:	83 ec 08             	sub    $0x8,%esp
+  800f05:	ff 75 0c             	push   0xc(%ebp)
+  800f08:	6a 3f                	push   $0x3f
+  800f0a:	ff 55 08             	call   *0x8(%ebp)
+  800f0d:	83 c4 10             	add    $0x10,%esp
+  800f10:	eb c5                	jmp    800ed7 <vprintfmt+0x242>
+  800f12:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800f15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f1b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800f1e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800f22:	7e 1b                	jle    800f3f <vprintfmt+0x2aa>
+  800f24:	83 ec 08             	sub    $0x8,%esp
+  800f27:	53                   	push   %ebx
+  800f28:	6a 20                	push   $0x20
+  800f2a:	ff d7                	call   *%edi
+  800f2c:	83 c4 10             	add    $0x10,%esp
+  800f2f:	83 ee 01             	sub    $0x1,%esi
+  800f32:	75 f0                	jne    800f24 <vprintfmt+0x28f>
+  800f34:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800f37:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f3a:	e9 67 fd ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  800f3f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800f42:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f45:	e9 5c fd ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  800f4a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800f4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800f53:	eb c6                	jmp    800f1b <vprintfmt+0x286>
+  800f55:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800f58:	89 55 10             	mov    %edx,0x10(%ebp)
+  800f5b:	83 f9 01             	cmp    $0x1,%ecx
+  800f5e:	7f 1f                	jg     800f7f <vprintfmt+0x2ea>
+  800f60:	85 c9                	test   %ecx,%ecx
+  800f62:	74 67                	je     800fcb <vprintfmt+0x336>
+  800f64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f67:	8b 30                	mov    (%eax),%esi
+  800f69:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800f6c:	89 f0                	mov    %esi,%eax
+  800f6e:	c1 f8 1f             	sar    $0x1f,%eax
+  800f71:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800f74:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f77:	8d 40 04             	lea    0x4(%eax),%eax
+  800f7a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f7d:	eb 17                	jmp    800f96 <vprintfmt+0x301>
+  800f7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f82:	8b 50 04             	mov    0x4(%eax),%edx
+  800f85:	8b 00                	mov    (%eax),%eax
+  800f87:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800f8a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800f8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f90:	8d 40 08             	lea    0x8(%eax),%eax
+  800f93:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f96:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800f99:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f9c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800fa1:	85 c9                	test   %ecx,%ecx
+  800fa3:	0f 89 12 01 00 00    	jns    8010bb <vprintfmt+0x426>
+  800fa9:	83 ec 08             	sub    $0x8,%esp
+  800fac:	53                   	push   %ebx
+  800fad:	6a 2d                	push   $0x2d
+  800faf:	ff d7                	call   *%edi
+  800fb1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800fb4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800fb7:	f7 da                	neg    %edx
+  800fb9:	83 d1 00             	adc    $0x0,%ecx
+  800fbc:	f7 d9                	neg    %ecx
+  800fbe:	83 c4 10             	add    $0x10,%esp
+  800fc1:	be 0a 00 00 00       	mov    $0xa,%esi
+  800fc6:	e9 f0 00 00 00       	jmp    8010bb <vprintfmt+0x426>
+  800fcb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fce:	8b 30                	mov    (%eax),%esi
+  800fd0:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800fd3:	89 f0                	mov    %esi,%eax
+  800fd5:	c1 f8 1f             	sar    $0x1f,%eax
+  800fd8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800fdb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fde:	8d 40 04             	lea    0x4(%eax),%eax
+  800fe1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800fe4:	eb b0                	jmp    800f96 <vprintfmt+0x301>
+  800fe6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800fe9:	89 55 10             	mov    %edx,0x10(%ebp)
+  800fec:	83 f9 01             	cmp    $0x1,%ecx
+  800fef:	7f 1e                	jg     80100f <vprintfmt+0x37a>
+  800ff1:	85 c9                	test   %ecx,%ecx
+  800ff3:	74 32                	je     801027 <vprintfmt+0x392>
+  800ff5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ff8:	8b 10                	mov    (%eax),%edx
+  800ffa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fff:	8d 40 04             	lea    0x4(%eax),%eax
+  801002:	89 45 14             	mov    %eax,0x14(%ebp)
+  801005:	be 0a 00 00 00       	mov    $0xa,%esi
+  80100a:	e9 ac 00 00 00       	jmp    8010bb <vprintfmt+0x426>
+  80100f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801012:	8b 10                	mov    (%eax),%edx
+  801014:	8b 48 04             	mov    0x4(%eax),%ecx
+  801017:	8d 40 08             	lea    0x8(%eax),%eax
+  80101a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80101d:	be 0a 00 00 00       	mov    $0xa,%esi
+  801022:	e9 94 00 00 00       	jmp    8010bb <vprintfmt+0x426>
+  801027:	8b 45 14             	mov    0x14(%ebp),%eax
+  80102a:	8b 10                	mov    (%eax),%edx
+  80102c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801031:	8d 40 04             	lea    0x4(%eax),%eax
+  801034:	89 45 14             	mov    %eax,0x14(%ebp)
+  801037:	be 0a 00 00 00       	mov    $0xa,%esi
+  80103c:	eb 7d                	jmp    8010bb <vprintfmt+0x426>
+  80103e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801041:	89 55 10             	mov    %edx,0x10(%ebp)
+  801044:	83 f9 01             	cmp    $0x1,%ecx
+  801047:	7f 1b                	jg     801064 <vprintfmt+0x3cf>
+  801049:	85 c9                	test   %ecx,%ecx
+  80104b:	74 2c                	je     801079 <vprintfmt+0x3e4>
+  80104d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801050:	8b 10                	mov    (%eax),%edx
+  801052:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801057:	8d 40 04             	lea    0x4(%eax),%eax
+  80105a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80105d:	be 08 00 00 00       	mov    $0x8,%esi
+  801062:	eb 57                	jmp    8010bb <vprintfmt+0x426>
+  801064:	8b 45 14             	mov    0x14(%ebp),%eax
+  801067:	8b 10                	mov    (%eax),%edx
+  801069:	8b 48 04             	mov    0x4(%eax),%ecx
+  80106c:	8d 40 08             	lea    0x8(%eax),%eax
+  80106f:	89 45 14             	mov    %eax,0x14(%ebp)
+  801072:	be 08 00 00 00       	mov    $0x8,%esi
+  801077:	eb 42                	jmp    8010bb <vprintfmt+0x426>
+  801079:	8b 45 14             	mov    0x14(%ebp),%eax
+  80107c:	8b 10                	mov    (%eax),%edx
+  80107e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801083:	8d 40 04             	lea    0x4(%eax),%eax
+  801086:	89 45 14             	mov    %eax,0x14(%ebp)
+  801089:	be 08 00 00 00       	mov    $0x8,%esi
+  80108e:	eb 2b                	jmp    8010bb <vprintfmt+0x426>
+  801090:	89 55 10             	mov    %edx,0x10(%ebp)
+  801093:	83 ec 08             	sub    $0x8,%esp
+  801096:	53                   	push   %ebx
+  801097:	6a 30                	push   $0x30
+  801099:	ff d7                	call   *%edi
+  80109b:	83 c4 08             	add    $0x8,%esp
+  80109e:	53                   	push   %ebx
+  80109f:	6a 78                	push   $0x78
+  8010a1:	ff d7                	call   *%edi
+  8010a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010a6:	8b 10                	mov    (%eax),%edx
+  8010a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ad:	83 c4 10             	add    $0x10,%esp
+  8010b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8010b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010b6:	be 10 00 00 00       	mov    $0x10,%esi
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+  8010be:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8010c2:	50                   	push   %eax
+  8010c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8010c6:	56                   	push   %esi
+  8010c7:	51                   	push   %ecx
+  8010c8:	52                   	push   %edx
+  8010c9:	89 da                	mov    %ebx,%edx
+  8010cb:	89 f8                	mov    %edi,%eax
+  8010cd:	e8 d8 fa ff ff       	call   800baa <printnum>
+  8010d2:	83 c4 20             	add    $0x20,%esp
+  8010d5:	e9 cc fb ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  8010da:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8010dd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8010e0:	83 f9 01             	cmp    $0x1,%ecx
+  8010e3:	7f 1b                	jg     801100 <vprintfmt+0x46b>
+  8010e5:	85 c9                	test   %ecx,%ecx
+  8010e7:	74 2c                	je     801115 <vprintfmt+0x480>
+  8010e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ec:	8b 10                	mov    (%eax),%edx
+  8010ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8010f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010f9:	be 10 00 00 00       	mov    $0x10,%esi
+  8010fe:	eb bb                	jmp    8010bb <vprintfmt+0x426>
+  801100:	8b 45 14             	mov    0x14(%ebp),%eax
+  801103:	8b 10                	mov    (%eax),%edx
+  801105:	8b 48 04             	mov    0x4(%eax),%ecx
+  801108:	8d 40 08             	lea    0x8(%eax),%eax
+  80110b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80110e:	be 10 00 00 00       	mov    $0x10,%esi
+  801113:	eb a6                	jmp    8010bb <vprintfmt+0x426>
+  801115:	8b 45 14             	mov    0x14(%ebp),%eax
+  801118:	8b 10                	mov    (%eax),%edx
+  80111a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111f:	8d 40 04             	lea    0x4(%eax),%eax
+  801122:	89 45 14             	mov    %eax,0x14(%ebp)
+  801125:	be 10 00 00 00       	mov    $0x10,%esi
+  80112a:	eb 8f                	jmp    8010bb <vprintfmt+0x426>
+  80112c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80112f:	83 ec 08             	sub    $0x8,%esp
+  801132:	53                   	push   %ebx
+  801133:	6a 25                	push   $0x25
+  801135:	ff d7                	call   *%edi
+  801137:	83 c4 10             	add    $0x10,%esp
+  80113a:	e9 67 fb ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  80113f:	83 ec 08             	sub    $0x8,%esp
+  801142:	53                   	push   %ebx
+  801143:	6a 25                	push   $0x25
+  801145:	ff d7                	call   *%edi
+  801147:	83 c4 10             	add    $0x10,%esp
+  80114a:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80114e:	0f 84 ba fb ff ff    	je     800d0e <vprintfmt+0x79>
+  801154:	89 75 10             	mov    %esi,0x10(%ebp)
+  801157:	89 f0                	mov    %esi,%eax
+  801159:	83 e8 01             	sub    $0x1,%eax
+  80115c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801160:	75 f7                	jne    801159 <vprintfmt+0x4c4>
+  801162:	89 45 10             	mov    %eax,0x10(%ebp)
+  801165:	e9 3c fb ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  80116a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80116d:	8d 70 01             	lea    0x1(%eax),%esi
+  801170:	0f b6 00             	movzbl (%eax),%eax
+  801173:	0f be d0             	movsbl %al,%edx
+  801176:	85 d2                	test   %edx,%edx
+  801178:	74 11                	je     80118b <vprintfmt+0x4f6>
+  80117a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80117d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801180:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  801183:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801186:	e9 5d fd ff ff       	jmp    800ee8 <vprintfmt+0x253>
+  80118b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80118e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801191:	e9 10 fb ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  801196:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801199:	89 45 14             	mov    %eax,0x14(%ebp)
+  80119c:	e9 05 fb ff ff       	jmp    800ca6 <vprintfmt+0x11>
+  8011a1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8011a5:	7e 0a                	jle    8011b1 <vprintfmt+0x51c>
+  8011a7:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8011ab:	0f 85 bd fc ff ff    	jne    800e6e <vprintfmt+0x1d9>
+  8011b1:	ba 28 00 00 00       	mov    $0x28,%edx
+  8011b6:	b8 28 00 00 00       	mov    $0x28,%eax
+  8011bb:	be 95 4e 80 00       	mov    $0x804e95,%esi
+  8011c0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8011c3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8011c6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8011c9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8011cc:	e9 17 fd ff ff       	jmp    800ee8 <vprintfmt+0x253>
+  8011d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d4:	5b                   	pop    %ebx
+  8011d5:	5e                   	pop    %esi
+  8011d6:	5f                   	pop    %edi
+  8011d7:	5d                   	pop    %ebp
+  8011d8:	c3                   	ret
+
+008011d9 <vsnprintf>:
+  8011d9:	55                   	push   %ebp
+  8011da:	89 e5                	mov    %esp,%ebp
+  8011dc:	83 ec 18             	sub    $0x18,%esp
+  8011df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8011e8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8011ec:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8011ef:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	74 26                	je     801220 <vsnprintf+0x47>
+  8011fa:	85 d2                	test   %edx,%edx
+  8011fc:	7e 22                	jle    801220 <vsnprintf+0x47>
+  8011fe:	ff 75 14             	push   0x14(%ebp)
+  801201:	ff 75 10             	push   0x10(%ebp)
+  801204:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801207:	50                   	push   %eax
+  801208:	68 5b 0c 80 00       	push   $0x800c5b
+  80120d:	e8 83 fa ff ff       	call   800c95 <vprintfmt>
+  801212:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801215:	c6 00 00             	movb   $0x0,(%eax)
+  801218:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80121b:	83 c4 10             	add    $0x10,%esp
+  80121e:	c9                   	leave
+  80121f:	c3                   	ret
+  801220:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801225:	eb f7                	jmp    80121e <vsnprintf+0x45>
+
+00801227 <snprintf>:
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	83 ec 08             	sub    $0x8,%esp
+  80122d:	8d 45 14             	lea    0x14(%ebp),%eax
+  801230:	50                   	push   %eax
+  801231:	ff 75 10             	push   0x10(%ebp)
+  801234:	ff 75 0c             	push   0xc(%ebp)
+  801237:	ff 75 08             	push   0x8(%ebp)
+  80123a:	e8 9a ff ff ff       	call   8011d9 <vsnprintf>
+  80123f:	c9                   	leave
+  801240:	c3                   	ret
+
+00801241 <readline>:
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+  801247:	83 ec 0c             	sub    $0xc,%esp
+  80124a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80124d:	85 c0                	test   %eax,%eax
+  80124f:	74 13                	je     801264 <readline+0x23>
+  801251:	83 ec 04             	sub    $0x4,%esp
+  801254:	50                   	push   %eax
+  801255:	68 a1 4d 80 00       	push   $0x804da1
+  80125a:	6a 01                	push   $0x1
+  80125c:	e8 5a 21 00 00       	call   8033bb <fprintf>
+  801261:	83 c4 10             	add    $0x10,%esp
+  801264:	83 ec 0c             	sub    $0xc,%esp
+  801267:	6a 00                	push   $0x0
+  801269:	e8 56 f7 ff ff       	call   8009c4 <iscons>
+  80126e:	89 c7                	mov    %eax,%edi
+  801270:	83 c4 10             	add    $0x10,%esp
+  801273:	be 00 00 00 00       	mov    $0x0,%esi
+  801278:	eb 4b                	jmp    8012c5 <readline+0x84>
+  80127a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127f:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  801282:	75 08                	jne    80128c <readline+0x4b>
+  801284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+  80128c:	83 ec 08             	sub    $0x8,%esp
+  80128f:	53                   	push   %ebx
+  801290:	68 8b 51 80 00       	push   $0x80518b
+  801295:	e8 fc f8 ff ff       	call   800b96 <cprintf>
+  80129a:	83 c4 10             	add    $0x10,%esp
+  80129d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a2:	eb e0                	jmp    801284 <readline+0x43>
+  8012a4:	85 ff                	test   %edi,%edi
+  8012a6:	75 05                	jne    8012ad <readline+0x6c>
+  8012a8:	83 ee 01             	sub    $0x1,%esi
+  8012ab:	eb 18                	jmp    8012c5 <readline+0x84>
+  8012ad:	83 ec 0c             	sub    $0xc,%esp
+  8012b0:	6a 08                	push   $0x8
+  8012b2:	e8 c8 f6 ff ff       	call   80097f <cputchar>
+  8012b7:	83 c4 10             	add    $0x10,%esp
+  8012ba:	eb ec                	jmp    8012a8 <readline+0x67>
+  8012bc:	88 9e 20 70 80 00    	mov    %bl,0x807020(%esi)
+  8012c2:	8d 76 01             	lea    0x1(%esi),%esi
+  8012c5:	e8 d1 f6 ff ff       	call   80099b <getchar>
+  8012ca:	89 c3                	mov    %eax,%ebx
+  8012cc:	85 c0                	test   %eax,%eax
+  8012ce:	78 aa                	js     80127a <readline+0x39>
+  8012d0:	83 f8 08             	cmp    $0x8,%eax
+  8012d3:	0f 94 c0             	sete   %al
+  8012d6:	83 fb 7f             	cmp    $0x7f,%ebx
+  8012d9:	0f 94 c2             	sete   %dl
+  8012dc:	08 d0                	or     %dl,%al
+  8012de:	74 04                	je     8012e4 <readline+0xa3>
+  8012e0:	85 f6                	test   %esi,%esi
+  8012e2:	7f c0                	jg     8012a4 <readline+0x63>
+  8012e4:	83 fb 1f             	cmp    $0x1f,%ebx
+  8012e7:	7e 1a                	jle    801303 <readline+0xc2>
+  8012e9:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8012ef:	7f 12                	jg     801303 <readline+0xc2>
+  8012f1:	85 ff                	test   %edi,%edi
+  8012f3:	74 c7                	je     8012bc <readline+0x7b>
+  8012f5:	83 ec 0c             	sub    $0xc,%esp
+  8012f8:	53                   	push   %ebx
+  8012f9:	e8 81 f6 ff ff       	call   80097f <cputchar>
+  8012fe:	83 c4 10             	add    $0x10,%esp
+  801301:	eb b9                	jmp    8012bc <readline+0x7b>
+  801303:	83 fb 0a             	cmp    $0xa,%ebx
+  801306:	74 05                	je     80130d <readline+0xcc>
+  801308:	83 fb 0d             	cmp    $0xd,%ebx
+  80130b:	75 b8                	jne    8012c5 <readline+0x84>
+  80130d:	85 ff                	test   %edi,%edi
+  80130f:	75 11                	jne    801322 <readline+0xe1>
+  801311:	c6 86 20 70 80 00 00 	movb   $0x0,0x807020(%esi)
+  801318:	b8 20 70 80 00       	mov    $0x807020,%eax
+  80131d:	e9 62 ff ff ff       	jmp    801284 <readline+0x43>
+  801322:	83 ec 0c             	sub    $0xc,%esp
+  801325:	6a 0a                	push   $0xa
+  801327:	e8 53 f6 ff ff       	call   80097f <cputchar>
+  80132c:	83 c4 10             	add    $0x10,%esp
+  80132f:	eb e0                	jmp    801311 <readline+0xd0>
+
+00801331 <strlen>:
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	8b 55 08             	mov    0x8(%ebp),%edx
+  801337:	80 3a 00             	cmpb   $0x0,(%edx)
+  80133a:	74 10                	je     80134c <strlen+0x1b>
+  80133c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801341:	83 c0 01             	add    $0x1,%eax
+  801344:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801348:	75 f7                	jne    801341 <strlen+0x10>
+  80134a:	5d                   	pop    %ebp
+  80134b:	c3                   	ret
+  80134c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801351:	eb f7                	jmp    80134a <strlen+0x19>
+
+00801353 <strnlen>:
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801359:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80135c:	85 d2                	test   %edx,%edx
+  80135e:	74 16                	je     801376 <strnlen+0x23>
+  801360:	b8 00 00 00 00       	mov    $0x0,%eax
+  801365:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801369:	74 09                	je     801374 <strnlen+0x21>
+  80136b:	83 c0 01             	add    $0x1,%eax
+  80136e:	39 d0                	cmp    %edx,%eax
+  801370:	75 f3                	jne    801365 <strnlen+0x12>
+  801372:	89 d0                	mov    %edx,%eax
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137b:	eb f7                	jmp    801374 <strnlen+0x21>
+
+0080137d <strcpy>:
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+  801380:	53                   	push   %ebx
+  801381:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801384:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801390:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801393:	83 c0 01             	add    $0x1,%eax
+  801396:	84 d2                	test   %dl,%dl
+  801398:	75 f2                	jne    80138c <strcpy+0xf>
+  80139a:	89 c8                	mov    %ecx,%eax
+  80139c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80139f:	c9                   	leave
+  8013a0:	c3                   	ret
+
+008013a1 <strcat>:
+  8013a1:	55                   	push   %ebp
+  8013a2:	89 e5                	mov    %esp,%ebp
+  8013a4:	53                   	push   %ebx
+  8013a5:	83 ec 10             	sub    $0x10,%esp
+  8013a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8013ab:	53                   	push   %ebx
+  8013ac:	e8 80 ff ff ff       	call   801331 <strlen>
+  8013b1:	83 c4 08             	add    $0x8,%esp
+  8013b4:	ff 75 0c             	push   0xc(%ebp)
+  8013b7:	01 d8                	add    %ebx,%eax
+  8013b9:	50                   	push   %eax
+  8013ba:	e8 be ff ff ff       	call   80137d <strcpy>
+  8013bf:	89 d8                	mov    %ebx,%eax
+  8013c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c4:	c9                   	leave
+  8013c5:	c3                   	ret
+
+008013c6 <strncpy>:
+  8013c6:	55                   	push   %ebp
+  8013c7:	89 e5                	mov    %esp,%ebp
+  8013c9:	56                   	push   %esi
+  8013ca:	53                   	push   %ebx
+  8013cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d4:	85 db                	test   %ebx,%ebx
+  8013d6:	74 17                	je     8013ef <strncpy+0x29>
+  8013d8:	01 f3                	add    %esi,%ebx
+  8013da:	89 f0                	mov    %esi,%eax
+  8013dc:	83 c0 01             	add    $0x1,%eax
+  8013df:	0f b6 0a             	movzbl (%edx),%ecx
+  8013e2:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8013e5:	80 f9 01             	cmp    $0x1,%cl
+  8013e8:	83 da ff             	sbb    $0xffffffff,%edx
+  8013eb:	39 c3                	cmp    %eax,%ebx
+  8013ed:	75 ed                	jne    8013dc <strncpy+0x16>
+  8013ef:	89 f0                	mov    %esi,%eax
+  8013f1:	5b                   	pop    %ebx
+  8013f2:	5e                   	pop    %esi
+  8013f3:	5d                   	pop    %ebp
+  8013f4:	c3                   	ret
+
+008013f5 <strlcpy>:
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	56                   	push   %esi
+  8013f9:	53                   	push   %ebx
+  8013fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801400:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801403:	89 f0                	mov    %esi,%eax
+  801405:	85 db                	test   %ebx,%ebx
+  801407:	74 1e                	je     801427 <strlcpy+0x32>
+  801409:	83 eb 01             	sub    $0x1,%ebx
+  80140c:	74 16                	je     801424 <strlcpy+0x2f>
+  80140e:	01 f3                	add    %esi,%ebx
+  801410:	0f b6 0a             	movzbl (%edx),%ecx
+  801413:	84 c9                	test   %cl,%cl
+  801415:	74 0d                	je     801424 <strlcpy+0x2f>
+  801417:	83 c2 01             	add    $0x1,%edx
+  80141a:	83 c0 01             	add    $0x1,%eax
+  80141d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  801420:	39 d8                	cmp    %ebx,%eax
+  801422:	75 ec                	jne    801410 <strlcpy+0x1b>
+  801424:	c6 00 00             	movb   $0x0,(%eax)
+  801427:	29 f0                	sub    %esi,%eax
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5d                   	pop    %ebp
+  80142c:	c3                   	ret
+
+0080142d <strcmp>:
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801433:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801436:	0f b6 01             	movzbl (%ecx),%eax
+  801439:	84 c0                	test   %al,%al
+  80143b:	74 11                	je     80144e <strcmp+0x21>
+  80143d:	38 02                	cmp    %al,(%edx)
+  80143f:	75 0d                	jne    80144e <strcmp+0x21>
+  801441:	83 c1 01             	add    $0x1,%ecx
+  801444:	83 c2 01             	add    $0x1,%edx
+  801447:	0f b6 01             	movzbl (%ecx),%eax
+  80144a:	84 c0                	test   %al,%al
+  80144c:	75 ef                	jne    80143d <strcmp+0x10>
+  80144e:	0f b6 c0             	movzbl %al,%eax
+  801451:	0f b6 12             	movzbl (%edx),%edx
+  801454:	29 d0                	sub    %edx,%eax
+  801456:	5d                   	pop    %ebp
+  801457:	c3                   	ret
+
+00801458 <strncmp>:
+  801458:	55                   	push   %ebp
+  801459:	89 e5                	mov    %esp,%ebp
+  80145b:	53                   	push   %ebx
+  80145c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80145f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801462:	8b 55 10             	mov    0x10(%ebp),%edx
+  801465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146a:	85 d2                	test   %edx,%edx
+  80146c:	74 2e                	je     80149c <strncmp+0x44>
+  80146e:	0f b6 01             	movzbl (%ecx),%eax
+  801471:	84 c0                	test   %al,%al
+  801473:	74 16                	je     80148b <strncmp+0x33>
+  801475:	3a 03                	cmp    (%ebx),%al
+  801477:	75 12                	jne    80148b <strncmp+0x33>
+  801479:	83 c1 01             	add    $0x1,%ecx
+  80147c:	83 c3 01             	add    $0x1,%ebx
+  80147f:	83 ea 01             	sub    $0x1,%edx
+  801482:	75 ea                	jne    80146e <strncmp+0x16>
+  801484:	b8 00 00 00 00       	mov    $0x0,%eax
+  801489:	eb 11                	jmp    80149c <strncmp+0x44>
+  80148b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801490:	85 d2                	test   %edx,%edx
+  801492:	74 08                	je     80149c <strncmp+0x44>
+  801494:	0f b6 01             	movzbl (%ecx),%eax
+  801497:	0f b6 13             	movzbl (%ebx),%edx
+  80149a:	29 d0                	sub    %edx,%eax
+  80149c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80149f:	c9                   	leave
+  8014a0:	c3                   	ret
+
+008014a1 <strchr>:
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8014ab:	0f b6 10             	movzbl (%eax),%edx
+  8014ae:	84 d2                	test   %dl,%dl
+  8014b0:	74 15                	je     8014c7 <strchr+0x26>
+  8014b2:	38 d1                	cmp    %dl,%cl
+  8014b4:	74 0f                	je     8014c5 <strchr+0x24>
+  8014b6:	83 c0 01             	add    $0x1,%eax
+  8014b9:	0f b6 10             	movzbl (%eax),%edx
+  8014bc:	84 d2                	test   %dl,%dl
+  8014be:	75 f2                	jne    8014b2 <strchr+0x11>
+  8014c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+  8014c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cc:	eb f7                	jmp    8014c5 <strchr+0x24>
+
+008014ce <strfind>:
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	53                   	push   %ebx
+  8014d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014d8:	0f b6 18             	movzbl (%eax),%ebx
+  8014db:	38 d3                	cmp    %dl,%bl
+  8014dd:	74 14                	je     8014f3 <strfind+0x25>
+  8014df:	89 d1                	mov    %edx,%ecx
+  8014e1:	84 db                	test   %bl,%bl
+  8014e3:	74 0e                	je     8014f3 <strfind+0x25>
+  8014e5:	83 c0 01             	add    $0x1,%eax
+  8014e8:	0f b6 10             	movzbl (%eax),%edx
+  8014eb:	38 ca                	cmp    %cl,%dl
+  8014ed:	74 04                	je     8014f3 <strfind+0x25>
+  8014ef:	84 d2                	test   %dl,%dl
+  8014f1:	75 f2                	jne    8014e5 <strfind+0x17>
+  8014f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+
+008014f8 <memset>:
+  8014f8:	55                   	push   %ebp
+  8014f9:	89 e5                	mov    %esp,%ebp
+  8014fb:	57                   	push   %edi
+  8014fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014ff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801502:	85 c9                	test   %ecx,%ecx
+  801504:	74 20                	je     801526 <memset+0x2e>
+  801506:	89 f8                	mov    %edi,%eax
+  801508:	09 c8                	or     %ecx,%eax
+  80150a:	a8 03                	test   $0x3,%al
+  80150c:	75 12                	jne    801520 <memset+0x28>
+  80150e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801512:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  801518:	c1 e9 02             	shr    $0x2,%ecx
+  80151b:	fc                   	cld
+  80151c:	f3 ab                	rep stos %eax,%es:(%edi)
+  80151e:	eb 06                	jmp    801526 <memset+0x2e>
+  801520:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801523:	fc                   	cld
+  801524:	f3 aa                	rep stos %al,%es:(%edi)
+  801526:	89 f8                	mov    %edi,%eax
+  801528:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80152b:	c9                   	leave
+  80152c:	c3                   	ret
+
+0080152d <memmove>:
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	57                   	push   %edi
+  801531:	56                   	push   %esi
+  801532:	8b 45 08             	mov    0x8(%ebp),%eax
+  801535:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801538:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80153b:	39 c6                	cmp    %eax,%esi
+  80153d:	73 32                	jae    801571 <memmove+0x44>
+  80153f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801542:	39 d0                	cmp    %edx,%eax
+  801544:	73 2b                	jae    801571 <memmove+0x44>
+  801546:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  801549:	89 d6                	mov    %edx,%esi
+  80154b:	09 fe                	or     %edi,%esi
+  80154d:	09 ce                	or     %ecx,%esi
+  80154f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801555:	75 0e                	jne    801565 <memmove+0x38>
+  801557:	83 ef 04             	sub    $0x4,%edi
+  80155a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80155d:	c1 e9 02             	shr    $0x2,%ecx
+  801560:	fd                   	std
+  801561:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801563:	eb 09                	jmp    80156e <memmove+0x41>
+  801565:	83 ef 01             	sub    $0x1,%edi
+  801568:	8d 72 ff             	lea    -0x1(%edx),%esi
+  80156b:	fd                   	std
+  80156c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80156e:	fc                   	cld
+  80156f:	eb 1a                	jmp    80158b <memmove+0x5e>
+  801571:	89 f2                	mov    %esi,%edx
+  801573:	09 c2                	or     %eax,%edx
+  801575:	09 ca                	or     %ecx,%edx
+  801577:	f6 c2 03             	test   $0x3,%dl
+  80157a:	75 0a                	jne    801586 <memmove+0x59>
+  80157c:	c1 e9 02             	shr    $0x2,%ecx
+  80157f:	89 c7                	mov    %eax,%edi
+  801581:	fc                   	cld
+  801582:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801584:	eb 05                	jmp    80158b <memmove+0x5e>
+  801586:	89 c7                	mov    %eax,%edi
+  801588:	fc                   	cld
+  801589:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  80158b:	5e                   	pop    %esi
+  80158c:	5f                   	pop    %edi
+  80158d:	5d                   	pop    %ebp
+  80158e:	c3                   	ret
+
+0080158f <memcpy>:
+  80158f:	55                   	push   %ebp
+  801590:	89 e5                	mov    %esp,%ebp
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	ff 75 10             	push   0x10(%ebp)
+  801598:	ff 75 0c             	push   0xc(%ebp)
+  80159b:	ff 75 08             	push   0x8(%ebp)
+  80159e:	e8 8a ff ff ff       	call   80152d <memmove>
+  8015a3:	c9                   	leave
+  8015a4:	c3                   	ret
+
+008015a5 <memcmp>:
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	56                   	push   %esi
+  8015a9:	53                   	push   %ebx
+  8015aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015b0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8015b3:	85 f6                	test   %esi,%esi
+  8015b5:	74 29                	je     8015e0 <memcmp+0x3b>
+  8015b7:	01 c6                	add    %eax,%esi
+  8015b9:	0f b6 08             	movzbl (%eax),%ecx
+  8015bc:	0f b6 1a             	movzbl (%edx),%ebx
+  8015bf:	38 d9                	cmp    %bl,%cl
+  8015c1:	75 11                	jne    8015d4 <memcmp+0x2f>
+  8015c3:	83 c0 01             	add    $0x1,%eax
+  8015c6:	83 c2 01             	add    $0x1,%edx
+  8015c9:	39 c6                	cmp    %eax,%esi
+  8015cb:	75 ec                	jne    8015b9 <memcmp+0x14>
+  8015cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d2:	eb 08                	jmp    8015dc <memcmp+0x37>
+  8015d4:	0f b6 c1             	movzbl %cl,%eax
+  8015d7:	0f b6 db             	movzbl %bl,%ebx
+  8015da:	29 d8                	sub    %ebx,%eax
+  8015dc:	5b                   	pop    %ebx
+  8015dd:	5e                   	pop    %esi
+  8015de:	5d                   	pop    %ebp
+  8015df:	c3                   	ret
+  8015e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e5:	eb f5                	jmp    8015dc <memcmp+0x37>
+
+008015e7 <memfind>:
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f0:	89 c2                	mov    %eax,%edx
+  8015f2:	03 55 10             	add    0x10(%ebp),%edx
+  8015f5:	39 d0                	cmp    %edx,%eax
+  8015f7:	73 0d                	jae    801606 <memfind+0x1f>
+  8015f9:	38 08                	cmp    %cl,(%eax)
+  8015fb:	74 0d                	je     80160a <memfind+0x23>
+  8015fd:	83 c0 01             	add    $0x1,%eax
+  801600:	39 c2                	cmp    %eax,%edx
+  801602:	75 f5                	jne    8015f9 <memfind+0x12>
+  801604:	eb 06                	jmp    80160c <memfind+0x25>
+  801606:	89 c2                	mov    %eax,%edx
+  801608:	eb 02                	jmp    80160c <memfind+0x25>
+  80160a:	89 c2                	mov    %eax,%edx
+  80160c:	89 d0                	mov    %edx,%eax
+  80160e:	5d                   	pop    %ebp
+  80160f:	c3                   	ret
+
+00801610 <strtol>:
+  801610:	55                   	push   %ebp
+  801611:	89 e5                	mov    %esp,%ebp
+  801613:	57                   	push   %edi
+  801614:	56                   	push   %esi
+  801615:	53                   	push   %ebx
+  801616:	8b 55 08             	mov    0x8(%ebp),%edx
+  801619:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80161c:	0f b6 02             	movzbl (%edx),%eax
+  80161f:	3c 20                	cmp    $0x20,%al
+  801621:	74 04                	je     801627 <strtol+0x17>
+  801623:	3c 09                	cmp    $0x9,%al
+  801625:	75 0e                	jne    801635 <strtol+0x25>
+  801627:	83 c2 01             	add    $0x1,%edx
+  80162a:	0f b6 02             	movzbl (%edx),%eax
+  80162d:	3c 20                	cmp    $0x20,%al
+  80162f:	74 f6                	je     801627 <strtol+0x17>
+  801631:	3c 09                	cmp    $0x9,%al
+  801633:	74 f2                	je     801627 <strtol+0x17>
+  801635:	3c 2b                	cmp    $0x2b,%al
+  801637:	74 2a                	je     801663 <strtol+0x53>
+  801639:	bf 00 00 00 00       	mov    $0x0,%edi
+  80163e:	3c 2d                	cmp    $0x2d,%al
+  801640:	74 2b                	je     80166d <strtol+0x5d>
+  801642:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801648:	75 0f                	jne    801659 <strtol+0x49>
+  80164a:	80 3a 30             	cmpb   $0x30,(%edx)
+  80164d:	74 28                	je     801677 <strtol+0x67>
+  80164f:	85 db                	test   %ebx,%ebx
+  801651:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801656:	0f 44 d8             	cmove  %eax,%ebx
+  801659:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80165e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801661:	eb 46                	jmp    8016a9 <strtol+0x99>
+  801663:	83 c2 01             	add    $0x1,%edx
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166b:	eb d5                	jmp    801642 <strtol+0x32>
+  80166d:	83 c2 01             	add    $0x1,%edx
+  801670:	bf 01 00 00 00       	mov    $0x1,%edi
+  801675:	eb cb                	jmp    801642 <strtol+0x32>
+  801677:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80167b:	74 0e                	je     80168b <strtol+0x7b>
+  80167d:	85 db                	test   %ebx,%ebx
+  80167f:	75 d8                	jne    801659 <strtol+0x49>
+  801681:	83 c2 01             	add    $0x1,%edx
+  801684:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801689:	eb ce                	jmp    801659 <strtol+0x49>
+  80168b:	83 c2 02             	add    $0x2,%edx
+  80168e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801693:	eb c4                	jmp    801659 <strtol+0x49>
+  801695:	0f be c0             	movsbl %al,%eax
+  801698:	83 e8 30             	sub    $0x30,%eax
+  80169b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80169e:	7d 3a                	jge    8016da <strtol+0xca>
+  8016a0:	83 c2 01             	add    $0x1,%edx
+  8016a3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8016a7:	01 c1                	add    %eax,%ecx
+  8016a9:	0f b6 02             	movzbl (%edx),%eax
+  8016ac:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8016af:	89 f3                	mov    %esi,%ebx
+  8016b1:	80 fb 09             	cmp    $0x9,%bl
+  8016b4:	76 df                	jbe    801695 <strtol+0x85>
+  8016b6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8016b9:	89 f3                	mov    %esi,%ebx
+  8016bb:	80 fb 19             	cmp    $0x19,%bl
+  8016be:	77 08                	ja     8016c8 <strtol+0xb8>
+  8016c0:	0f be c0             	movsbl %al,%eax
+  8016c3:	83 e8 57             	sub    $0x57,%eax
+  8016c6:	eb d3                	jmp    80169b <strtol+0x8b>
+  8016c8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8016cb:	89 f3                	mov    %esi,%ebx
+  8016cd:	80 fb 19             	cmp    $0x19,%bl
+  8016d0:	77 08                	ja     8016da <strtol+0xca>
+  8016d2:	0f be c0             	movsbl %al,%eax
+  8016d5:	83 e8 37             	sub    $0x37,%eax
+  8016d8:	eb c1                	jmp    80169b <strtol+0x8b>
+  8016da:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016de:	74 05                	je     8016e5 <strtol+0xd5>
+  8016e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016e3:	89 10                	mov    %edx,(%eax)
+  8016e5:	89 c8                	mov    %ecx,%eax
+  8016e7:	f7 d8                	neg    %eax
+  8016e9:	85 ff                	test   %edi,%edi
+  8016eb:	0f 45 c8             	cmovne %eax,%ecx
+  8016ee:	89 c8                	mov    %ecx,%eax
+  8016f0:	5b                   	pop    %ebx
+  8016f1:	5e                   	pop    %esi
+  8016f2:	5f                   	pop    %edi
+  8016f3:	5d                   	pop    %ebp
+  8016f4:	c3                   	ret
+
+008016f5 <sys_cputs>:
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	57                   	push   %edi
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+  8016fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801700:	8b 55 08             	mov    0x8(%ebp),%edx
+  801703:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801706:	89 c3                	mov    %eax,%ebx
+  801708:	89 c7                	mov    %eax,%edi
+  80170a:	89 c6                	mov    %eax,%esi
+  80170c:	cd 30                	int    $0x30
+  80170e:	5b                   	pop    %ebx
+  80170f:	5e                   	pop    %esi
+  801710:	5f                   	pop    %edi
+  801711:	5d                   	pop    %ebp
+  801712:	c3                   	ret
+
+00801713 <sys_cgetc>:
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	57                   	push   %edi
+  801717:	56                   	push   %esi
+  801718:	53                   	push   %ebx
+  801719:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801723:	89 d1                	mov    %edx,%ecx
+  801725:	89 d3                	mov    %edx,%ebx
+  801727:	89 d7                	mov    %edx,%edi
+  801729:	89 d6                	mov    %edx,%esi
+  80172b:	cd 30                	int    $0x30
+  80172d:	5b                   	pop    %ebx
+  80172e:	5e                   	pop    %esi
+  80172f:	5f                   	pop    %edi
+  801730:	5d                   	pop    %ebp
+  801731:	c3                   	ret
+
+00801732 <sys_env_destroy>:
+  801732:	55                   	push   %ebp
+  801733:	89 e5                	mov    %esp,%ebp
+  801735:	57                   	push   %edi
+  801736:	56                   	push   %esi
+  801737:	53                   	push   %ebx
+  801738:	83 ec 0c             	sub    $0xc,%esp
+  80173b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801740:	8b 55 08             	mov    0x8(%ebp),%edx
+  801743:	b8 03 00 00 00       	mov    $0x3,%eax
+  801748:	89 cb                	mov    %ecx,%ebx
+  80174a:	89 cf                	mov    %ecx,%edi
+  80174c:	89 ce                	mov    %ecx,%esi
+  80174e:	cd 30                	int    $0x30
+  801750:	85 c0                	test   %eax,%eax
+  801752:	7f 08                	jg     80175c <sys_env_destroy+0x2a>
+  801754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801757:	5b                   	pop    %ebx
+  801758:	5e                   	pop    %esi
+  801759:	5f                   	pop    %edi
+  80175a:	5d                   	pop    %ebp
+  80175b:	c3                   	ret
+  80175c:	83 ec 0c             	sub    $0xc,%esp
+  80175f:	50                   	push   %eax
+  801760:	6a 03                	push   $0x3
+  801762:	68 9b 51 80 00       	push   $0x80519b
+  801767:	6a 24                	push   $0x24
+  801769:	68 b8 51 80 00       	push   $0x8051b8
+  80176e:	e8 48 f3 ff ff       	call   800abb <_panic>
+
+00801773 <sys_getenvid>:
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	57                   	push   %edi
+  801777:	56                   	push   %esi
+  801778:	53                   	push   %ebx
+  801779:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801783:	89 d1                	mov    %edx,%ecx
+  801785:	89 d3                	mov    %edx,%ebx
+  801787:	89 d7                	mov    %edx,%edi
+  801789:	89 d6                	mov    %edx,%esi
+  80178b:	cd 30                	int    $0x30
+  80178d:	5b                   	pop    %ebx
+  80178e:	5e                   	pop    %esi
+  80178f:	5f                   	pop    %edi
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+
+00801792 <sys_yield>:
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	57                   	push   %edi
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80179f:	74 26                	je     8017c7 <sys_yield+0x35>
+  8017a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8017ab:	89 d1                	mov    %edx,%ecx
+  8017ad:	89 d3                	mov    %edx,%ebx
+  8017af:	89 d7                	mov    %edx,%edi
+  8017b1:	6a 00                	push   $0x0
+  8017b3:	55                   	push   %ebp
+  8017b4:	89 e5                	mov    %esp,%ebp
+  8017b6:	8d 35 be 17 80 00    	lea    0x8017be,%esi
+  8017bc:	0f 34                	sysenter
+  8017be:	5d                   	pop    %ebp
+  8017bf:	83 c4 04             	add    $0x4,%esp
+  8017c2:	5b                   	pop    %ebx
+  8017c3:	5e                   	pop    %esi
+  8017c4:	5f                   	pop    %edi
+  8017c5:	5d                   	pop    %ebp
+  8017c6:	c3                   	ret
+  8017c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8017d1:	89 d1                	mov    %edx,%ecx
+  8017d3:	89 d3                	mov    %edx,%ebx
+  8017d5:	89 d7                	mov    %edx,%edi
+  8017d7:	89 d6                	mov    %edx,%esi
+  8017d9:	cd 30                	int    $0x30
+  8017db:	eb e5                	jmp    8017c2 <sys_yield+0x30>
+
+008017dd <sys_page_alloc>:
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	57                   	push   %edi
+  8017e1:	56                   	push   %esi
+  8017e2:	53                   	push   %ebx
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017f9:	89 f7                	mov    %esi,%edi
+  8017fb:	cd 30                	int    $0x30
+  8017fd:	85 c0                	test   %eax,%eax
+  8017ff:	7f 08                	jg     801809 <sys_page_alloc+0x2c>
+  801801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801804:	5b                   	pop    %ebx
+  801805:	5e                   	pop    %esi
+  801806:	5f                   	pop    %edi
+  801807:	5d                   	pop    %ebp
+  801808:	c3                   	ret
+  801809:	83 ec 0c             	sub    $0xc,%esp
+  80180c:	50                   	push   %eax
+  80180d:	6a 04                	push   $0x4
+  80180f:	68 9b 51 80 00       	push   $0x80519b
+  801814:	6a 24                	push   $0x24
+  801816:	68 b8 51 80 00       	push   $0x8051b8
+  80181b:	e8 9b f2 ff ff       	call   800abb <_panic>
+
+00801820 <sys_page_map>:
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	57                   	push   %edi
+  801824:	56                   	push   %esi
+  801825:	53                   	push   %ebx
+  801826:	83 ec 0c             	sub    $0xc,%esp
+  801829:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801830:	74 33                	je     801865 <sys_page_map+0x45>
+  801832:	8b 55 08             	mov    0x8(%ebp),%edx
+  801835:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801838:	b8 05 00 00 00       	mov    $0x5,%eax
+  80183d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801840:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801843:	ff 75 18             	push   0x18(%ebp)
+  801846:	55                   	push   %ebp
+  801847:	89 e5                	mov    %esp,%ebp
+  801849:	8d 35 51 18 80 00    	lea    0x801851,%esi
+  80184f:	0f 34                	sysenter
+  801851:	5d                   	pop    %ebp
+  801852:	83 c4 04             	add    $0x4,%esp
+  801855:	89 c2                	mov    %eax,%edx
+  801857:	85 c0                	test   %eax,%eax
+  801859:	7f 3d                	jg     801898 <sys_page_map+0x78>
+  80185b:	89 d0                	mov    %edx,%eax
+  80185d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5f                   	pop    %edi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+  801865:	b8 05 00 00 00       	mov    $0x5,%eax
+  80186a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801870:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801873:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801876:	8b 75 18             	mov    0x18(%ebp),%esi
+  801879:	cd 30                	int    $0x30
+  80187b:	89 c2                	mov    %eax,%edx
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	7e da                	jle    80185b <sys_page_map+0x3b>
+  801881:	83 ec 0c             	sub    $0xc,%esp
+  801884:	50                   	push   %eax
+  801885:	6a 05                	push   $0x5
+  801887:	68 9b 51 80 00       	push   $0x80519b
+  80188c:	6a 24                	push   $0x24
+  80188e:	68 b8 51 80 00       	push   $0x8051b8
+  801893:	e8 23 f2 ff ff       	call   800abb <_panic>
+  801898:	83 ec 0c             	sub    $0xc,%esp
+  80189b:	50                   	push   %eax
+  80189c:	6a 05                	push   $0x5
+  80189e:	68 9b 51 80 00       	push   $0x80519b
+  8018a3:	6a 48                	push   $0x48
+  8018a5:	68 b8 51 80 00       	push   $0x8051b8
+  8018aa:	e8 0c f2 ff ff       	call   800abb <_panic>
+
+008018af <sys_page_unmap>:
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+  8018b2:	57                   	push   %edi
+  8018b3:	56                   	push   %esi
+  8018b4:	53                   	push   %ebx
+  8018b5:	83 ec 0c             	sub    $0xc,%esp
+  8018b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018c8:	89 df                	mov    %ebx,%edi
+  8018ca:	89 de                	mov    %ebx,%esi
+  8018cc:	cd 30                	int    $0x30
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	7f 08                	jg     8018da <sys_page_unmap+0x2b>
+  8018d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d5:	5b                   	pop    %ebx
+  8018d6:	5e                   	pop    %esi
+  8018d7:	5f                   	pop    %edi
+  8018d8:	5d                   	pop    %ebp
+  8018d9:	c3                   	ret
+  8018da:	83 ec 0c             	sub    $0xc,%esp
+  8018dd:	50                   	push   %eax
+  8018de:	6a 06                	push   $0x6
+  8018e0:	68 9b 51 80 00       	push   $0x80519b
+  8018e5:	6a 24                	push   $0x24
+  8018e7:	68 b8 51 80 00       	push   $0x8051b8
+  8018ec:	e8 ca f1 ff ff       	call   800abb <_panic>
+
+008018f1 <sys_fork>:
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  8018f4:	57                   	push   %edi
+  8018f5:	56                   	push   %esi
+  8018f6:	53                   	push   %ebx
+  8018f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801901:	89 d1                	mov    %edx,%ecx
+  801903:	89 d3                	mov    %edx,%ebx
+  801905:	89 d7                	mov    %edx,%edi
+  801907:	89 d6                	mov    %edx,%esi
+  801909:	cd 30                	int    $0x30
+  80190b:	5b                   	pop    %ebx
+  80190c:	5e                   	pop    %esi
+  80190d:	5f                   	pop    %edi
+  80190e:	5d                   	pop    %ebp
+  80190f:	c3                   	ret
+
+00801910 <sys_env_set_status>:
+  801910:	55                   	push   %ebp
+  801911:	89 e5                	mov    %esp,%ebp
+  801913:	57                   	push   %edi
+  801914:	56                   	push   %esi
+  801915:	53                   	push   %ebx
+  801916:	83 ec 0c             	sub    $0xc,%esp
+  801919:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801921:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801924:	b8 08 00 00 00       	mov    $0x8,%eax
+  801929:	89 df                	mov    %ebx,%edi
+  80192b:	89 de                	mov    %ebx,%esi
+  80192d:	cd 30                	int    $0x30
+  80192f:	85 c0                	test   %eax,%eax
+  801931:	7f 08                	jg     80193b <sys_env_set_status+0x2b>
+  801933:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801936:	5b                   	pop    %ebx
+  801937:	5e                   	pop    %esi
+  801938:	5f                   	pop    %edi
+  801939:	5d                   	pop    %ebp
+  80193a:	c3                   	ret
+  80193b:	83 ec 0c             	sub    $0xc,%esp
+  80193e:	50                   	push   %eax
+  80193f:	6a 08                	push   $0x8
+  801941:	68 9b 51 80 00       	push   $0x80519b
+  801946:	6a 24                	push   $0x24
+  801948:	68 b8 51 80 00       	push   $0x8051b8
+  80194d:	e8 69 f1 ff ff       	call   800abb <_panic>
+
+00801952 <sys_env_set_trapframe>:
+  801952:	55                   	push   %ebp
+  801953:	89 e5                	mov    %esp,%ebp
+  801955:	57                   	push   %edi
+  801956:	56                   	push   %esi
+  801957:	53                   	push   %ebx
+  801958:	83 ec 0c             	sub    $0xc,%esp
+  80195b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801960:	8b 55 08             	mov    0x8(%ebp),%edx
+  801963:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801966:	b8 09 00 00 00       	mov    $0x9,%eax
+  80196b:	89 df                	mov    %ebx,%edi
+  80196d:	89 de                	mov    %ebx,%esi
+  80196f:	cd 30                	int    $0x30
+  801971:	85 c0                	test   %eax,%eax
+  801973:	7f 08                	jg     80197d <sys_env_set_trapframe+0x2b>
+  801975:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801978:	5b                   	pop    %ebx
+  801979:	5e                   	pop    %esi
+  80197a:	5f                   	pop    %edi
+  80197b:	5d                   	pop    %ebp
+  80197c:	c3                   	ret
+  80197d:	83 ec 0c             	sub    $0xc,%esp
+  801980:	50                   	push   %eax
+  801981:	6a 09                	push   $0x9
+  801983:	68 9b 51 80 00       	push   $0x80519b
+  801988:	6a 24                	push   $0x24
+  80198a:	68 b8 51 80 00       	push   $0x8051b8
+  80198f:	e8 27 f1 ff ff       	call   800abb <_panic>
+
+00801994 <sys_env_set_cow>:
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+  801997:	57                   	push   %edi
+  801998:	56                   	push   %esi
+  801999:	53                   	push   %ebx
+  80199a:	83 ec 0c             	sub    $0xc,%esp
+  80199d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8019ad:	89 df                	mov    %ebx,%edi
+  8019af:	89 de                	mov    %ebx,%esi
+  8019b1:	cd 30                	int    $0x30
+  8019b3:	85 c0                	test   %eax,%eax
+  8019b5:	7f 08                	jg     8019bf <sys_env_set_cow+0x2b>
+  8019b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ba:	5b                   	pop    %ebx
+  8019bb:	5e                   	pop    %esi
+  8019bc:	5f                   	pop    %edi
+  8019bd:	5d                   	pop    %ebp
+  8019be:	c3                   	ret
+  8019bf:	83 ec 0c             	sub    $0xc,%esp
+  8019c2:	50                   	push   %eax
+  8019c3:	6a 20                	push   $0x20
+  8019c5:	68 9b 51 80 00       	push   $0x80519b
+  8019ca:	6a 24                	push   $0x24
+  8019cc:	68 b8 51 80 00       	push   $0x8051b8
+  8019d1:	e8 e5 f0 ff ff       	call   800abb <_panic>
+
+008019d6 <sys_env_service>:
+  8019d6:	55                   	push   %ebp
+  8019d7:	89 e5                	mov    %esp,%ebp
+  8019d9:	57                   	push   %edi
+  8019da:	56                   	push   %esi
+  8019db:	53                   	push   %ebx
+  8019dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e4:	b8 21 00 00 00       	mov    $0x21,%eax
+  8019e9:	89 cb                	mov    %ecx,%ebx
+  8019eb:	89 cf                	mov    %ecx,%edi
+  8019ed:	89 ce                	mov    %ecx,%esi
+  8019ef:	cd 30                	int    $0x30
+  8019f1:	5b                   	pop    %ebx
+  8019f2:	5e                   	pop    %esi
+  8019f3:	5f                   	pop    %edi
+  8019f4:	5d                   	pop    %ebp
+  8019f5:	c3                   	ret
+
+008019f6 <sys_env_set_pgfault_upcall>:
+  8019f6:	55                   	push   %ebp
+  8019f7:	89 e5                	mov    %esp,%ebp
+  8019f9:	57                   	push   %edi
+  8019fa:	56                   	push   %esi
+  8019fb:	53                   	push   %ebx
+  8019fc:	83 ec 0c             	sub    $0xc,%esp
+  8019ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a04:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a0f:	89 df                	mov    %ebx,%edi
+  801a11:	89 de                	mov    %ebx,%esi
+  801a13:	cd 30                	int    $0x30
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	7f 08                	jg     801a21 <sys_env_set_pgfault_upcall+0x2b>
+  801a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a1c:	5b                   	pop    %ebx
+  801a1d:	5e                   	pop    %esi
+  801a1e:	5f                   	pop    %edi
+  801a1f:	5d                   	pop    %ebp
+  801a20:	c3                   	ret
+  801a21:	83 ec 0c             	sub    $0xc,%esp
+  801a24:	50                   	push   %eax
+  801a25:	6a 0a                	push   $0xa
+  801a27:	68 9b 51 80 00       	push   $0x80519b
+  801a2c:	6a 24                	push   $0x24
+  801a2e:	68 b8 51 80 00       	push   $0x8051b8
+  801a33:	e8 83 f0 ff ff       	call   800abb <_panic>
+
+00801a38 <sys_ipc_try_send>:
+  801a38:	55                   	push   %ebp
+  801a39:	89 e5                	mov    %esp,%ebp
+  801a3b:	57                   	push   %edi
+  801a3c:	56                   	push   %esi
+  801a3d:	53                   	push   %ebx
+  801a3e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801a45:	74 27                	je     801a6e <sys_ipc_try_send+0x36>
+  801a47:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a4d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a55:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a58:	6a 00                	push   $0x0
+  801a5a:	55                   	push   %ebp
+  801a5b:	89 e5                	mov    %esp,%ebp
+  801a5d:	8d 35 65 1a 80 00    	lea    0x801a65,%esi
+  801a63:	0f 34                	sysenter
+  801a65:	5d                   	pop    %ebp
+  801a66:	83 c4 04             	add    $0x4,%esp
+  801a69:	5b                   	pop    %ebx
+  801a6a:	5e                   	pop    %esi
+  801a6b:	5f                   	pop    %edi
+  801a6c:	5d                   	pop    %ebp
+  801a6d:	c3                   	ret
+  801a6e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a73:	be 00 00 00 00       	mov    $0x0,%esi
+  801a78:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a81:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a84:	cd 30                	int    $0x30
+  801a86:	eb e1                	jmp    801a69 <sys_ipc_try_send+0x31>
+
+00801a88 <sys_ipc_recv>:
+  801a88:	55                   	push   %ebp
+  801a89:	89 e5                	mov    %esp,%ebp
+  801a8b:	57                   	push   %edi
+  801a8c:	56                   	push   %esi
+  801a8d:	53                   	push   %ebx
+  801a8e:	83 ec 0c             	sub    $0xc,%esp
+  801a91:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801a98:	74 32                	je     801acc <sys_ipc_recv+0x44>
+  801a9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aa2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801aa7:	89 cb                	mov    %ecx,%ebx
+  801aa9:	89 cf                	mov    %ecx,%edi
+  801aab:	6a 00                	push   $0x0
+  801aad:	55                   	push   %ebp
+  801aae:	89 e5                	mov    %esp,%ebp
+  801ab0:	8d 35 b8 1a 80 00    	lea    0x801ab8,%esi
+  801ab6:	0f 34                	sysenter
+  801ab8:	5d                   	pop    %ebp
+  801ab9:	83 c4 04             	add    $0x4,%esp
+  801abc:	89 c2                	mov    %eax,%edx
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	7f 3c                	jg     801afe <sys_ipc_recv+0x76>
+  801ac2:	89 d0                	mov    %edx,%eax
+  801ac4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac7:	5b                   	pop    %ebx
+  801ac8:	5e                   	pop    %esi
+  801ac9:	5f                   	pop    %edi
+  801aca:	5d                   	pop    %ebp
+  801acb:	c3                   	ret
+  801acc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ad1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ad6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad9:	89 cb                	mov    %ecx,%ebx
+  801adb:	89 cf                	mov    %ecx,%edi
+  801add:	89 ce                	mov    %ecx,%esi
+  801adf:	cd 30                	int    $0x30
+  801ae1:	89 c2                	mov    %eax,%edx
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	7e db                	jle    801ac2 <sys_ipc_recv+0x3a>
+  801ae7:	83 ec 0c             	sub    $0xc,%esp
+  801aea:	50                   	push   %eax
+  801aeb:	6a 0d                	push   $0xd
+  801aed:	68 9b 51 80 00       	push   $0x80519b
+  801af2:	6a 24                	push   $0x24
+  801af4:	68 b8 51 80 00       	push   $0x8051b8
+  801af9:	e8 bd ef ff ff       	call   800abb <_panic>
+  801afe:	83 ec 0c             	sub    $0xc,%esp
+  801b01:	50                   	push   %eax
+  801b02:	6a 0d                	push   $0xd
+  801b04:	68 9b 51 80 00       	push   $0x80519b
+  801b09:	6a 48                	push   $0x48
+  801b0b:	68 b8 51 80 00       	push   $0x8051b8
+  801b10:	e8 a6 ef ff ff       	call   800abb <_panic>
+
+00801b15 <sys_ipc_send>:
+  801b15:	55                   	push   %ebp
+  801b16:	89 e5                	mov    %esp,%ebp
+  801b18:	57                   	push   %edi
+  801b19:	56                   	push   %esi
+  801b1a:	53                   	push   %ebx
+  801b1b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801b22:	74 27                	je     801b4b <sys_ipc_send+0x36>
+  801b24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b2a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b32:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b35:	6a 00                	push   $0x0
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	8d 35 42 1b 80 00    	lea    0x801b42,%esi
+  801b40:	0f 34                	sysenter
+  801b42:	5d                   	pop    %ebp
+  801b43:	83 c4 04             	add    $0x4,%esp
+  801b46:	5b                   	pop    %ebx
+  801b47:	5e                   	pop    %esi
+  801b48:	5f                   	pop    %edi
+  801b49:	5d                   	pop    %ebp
+  801b4a:	c3                   	ret
+  801b4b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801b50:	be 00 00 00 00       	mov    $0x0,%esi
+  801b55:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b5e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b61:	cd 30                	int    $0x30
+  801b63:	eb e1                	jmp    801b46 <sys_ipc_send+0x31>
+
+00801b65 <sys_ipc_call>:
+  801b65:	55                   	push   %ebp
+  801b66:	89 e5                	mov    %esp,%ebp
+  801b68:	57                   	push   %edi
+  801b69:	56                   	push   %esi
+  801b6a:	53                   	push   %ebx
+  801b6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b71:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801b76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b79:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b7c:	8b 75 18             	mov    0x18(%ebp),%esi
+  801b7f:	cd 30                	int    $0x30
+  801b81:	5b                   	pop    %ebx
+  801b82:	5e                   	pop    %esi
+  801b83:	5f                   	pop    %edi
+  801b84:	5d                   	pop    %ebp
+  801b85:	c3                   	ret
+
+00801b86 <sys_ipc_reply_recv>:
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	57                   	push   %edi
+  801b8a:	56                   	push   %esi
+  801b8b:	53                   	push   %ebx
+  801b8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b92:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801b9d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801ba0:	cd 30                	int    $0x30
+  801ba2:	5b                   	pop    %ebx
+  801ba3:	5e                   	pop    %esi
+  801ba4:	5f                   	pop    %edi
+  801ba5:	5d                   	pop    %ebp
+  801ba6:	c3                   	ret
+
+00801ba7 <sys_time_msec>:
+  801ba7:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	75 06                	jne    801bb6 <sys_time_msec+0xf>
+  801bb0:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801bb5:	c3                   	ret
+  801bb6:	55                   	push   %ebp
+  801bb7:	89 e5                	mov    %esp,%ebp
+  801bb9:	57                   	push   %edi
+  801bba:	56                   	push   %esi
+  801bbb:	53                   	push   %ebx
+  801bbc:	83 ec 0c             	sub    $0xc,%esp
+  801bbf:	0f 31                	rdtsc
+  801bc1:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801bc7:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801bcd:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801bd3:	29 c8                	sub    %ecx,%eax
+  801bd5:	19 da                	sbb    %ebx,%edx
+  801bd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bdc:	57                   	push   %edi
+  801bdd:	56                   	push   %esi
+  801bde:	52                   	push   %edx
+  801bdf:	50                   	push   %eax
+  801be0:	e8 30 2f 00 00       	call   804b15 <__udivdi3>
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801beb:	5b                   	pop    %ebx
+  801bec:	5e                   	pop    %esi
+  801bed:	5f                   	pop    %edi
+  801bee:	5d                   	pop    %ebp
+  801bef:	c3                   	ret
+
+00801bf0 <sys_env_swap>:
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	57                   	push   %edi
+  801bf4:	56                   	push   %esi
+  801bf5:	53                   	push   %ebx
+  801bf6:	83 ec 0c             	sub    $0xc,%esp
+  801bf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c01:	b8 12 00 00 00       	mov    $0x12,%eax
+  801c06:	89 cb                	mov    %ecx,%ebx
+  801c08:	89 cf                	mov    %ecx,%edi
+  801c0a:	89 ce                	mov    %ecx,%esi
+  801c0c:	cd 30                	int    $0x30
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	7f 08                	jg     801c1a <sys_env_swap+0x2a>
+  801c12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c15:	5b                   	pop    %ebx
+  801c16:	5e                   	pop    %esi
+  801c17:	5f                   	pop    %edi
+  801c18:	5d                   	pop    %ebp
+  801c19:	c3                   	ret
+  801c1a:	83 ec 0c             	sub    $0xc,%esp
+  801c1d:	50                   	push   %eax
+  801c1e:	6a 12                	push   $0x12
+  801c20:	68 9b 51 80 00       	push   $0x80519b
+  801c25:	6a 24                	push   $0x24
+  801c27:	68 b8 51 80 00       	push   $0x8051b8
+  801c2c:	e8 8a ee ff ff       	call   800abb <_panic>
+
+00801c31 <sys_net_try_send>:
+  801c31:	55                   	push   %ebp
+  801c32:	89 e5                	mov    %esp,%ebp
+  801c34:	57                   	push   %edi
+  801c35:	56                   	push   %esi
+  801c36:	53                   	push   %ebx
+  801c37:	83 ec 0c             	sub    $0xc,%esp
+  801c3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c45:	b8 13 00 00 00       	mov    $0x13,%eax
+  801c4a:	89 df                	mov    %ebx,%edi
+  801c4c:	89 de                	mov    %ebx,%esi
+  801c4e:	cd 30                	int    $0x30
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	7f 08                	jg     801c5c <sys_net_try_send+0x2b>
+  801c54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c57:	5b                   	pop    %ebx
+  801c58:	5e                   	pop    %esi
+  801c59:	5f                   	pop    %edi
+  801c5a:	5d                   	pop    %ebp
+  801c5b:	c3                   	ret
+  801c5c:	83 ec 0c             	sub    $0xc,%esp
+  801c5f:	50                   	push   %eax
+  801c60:	6a 13                	push   $0x13
+  801c62:	68 9b 51 80 00       	push   $0x80519b
+  801c67:	6a 24                	push   $0x24
+  801c69:	68 b8 51 80 00       	push   $0x8051b8
+  801c6e:	e8 48 ee ff ff       	call   800abb <_panic>
+
+00801c73 <sys_net_try_receive>:
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	57                   	push   %edi
+  801c77:	56                   	push   %esi
+  801c78:	53                   	push   %ebx
+  801c79:	83 ec 0c             	sub    $0xc,%esp
+  801c7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c87:	b8 14 00 00 00       	mov    $0x14,%eax
+  801c8c:	89 df                	mov    %ebx,%edi
+  801c8e:	89 de                	mov    %ebx,%esi
+  801c90:	cd 30                	int    $0x30
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	7f 08                	jg     801c9e <sys_net_try_receive+0x2b>
+  801c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c99:	5b                   	pop    %ebx
+  801c9a:	5e                   	pop    %esi
+  801c9b:	5f                   	pop    %edi
+  801c9c:	5d                   	pop    %ebp
+  801c9d:	c3                   	ret
+  801c9e:	83 ec 0c             	sub    $0xc,%esp
+  801ca1:	50                   	push   %eax
+  801ca2:	6a 14                	push   $0x14
+  801ca4:	68 9b 51 80 00       	push   $0x80519b
+  801ca9:	6a 24                	push   $0x24
+  801cab:	68 b8 51 80 00       	push   $0x8051b8
+  801cb0:	e8 06 ee ff ff       	call   800abb <_panic>
+
+00801cb5 <sys_net_recv_page>:
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	57                   	push   %edi
+  801cb9:	56                   	push   %esi
+  801cba:	53                   	push   %ebx
+  801cbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cc3:	b8 27 00 00 00       	mov    $0x27,%eax
+  801cc8:	89 cb                	mov    %ecx,%ebx
+  801cca:	89 cf                	mov    %ecx,%edi
+  801ccc:	89 ce                	mov    %ecx,%esi
+  801cce:	cd 30                	int    $0x30
+  801cd0:	5b                   	pop    %ebx
+  801cd1:	5e                   	pop    %esi
+  801cd2:	5f                   	pop    %edi
+  801cd3:	5d                   	pop    %ebp
+  801cd4:	c3                   	ret
+
+00801cd5 <sys_net_wait>:
+  801cd5:	55                   	push   %ebp
+  801cd6:	89 e5                	mov    %esp,%ebp
+  801cd8:	57                   	push   %edi
+  801cd9:	56                   	push   %esi
+  801cda:	53                   	push   %ebx
+  801cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce0:	b8 26 00 00 00       	mov    $0x26,%eax
+  801ce5:	89 d1                	mov    %edx,%ecx
+  801ce7:	89 d3                	mov    %edx,%ebx
+  801ce9:	89 d7                	mov    %edx,%edi
+  801ceb:	89 d6                	mov    %edx,%esi
+  801ced:	cd 30                	int    $0x30
+  801cef:	5b                   	pop    %ebx
+  801cf0:	5e                   	pop    %esi
+  801cf1:	5f                   	pop    %edi
+  801cf2:	5d                   	pop    %ebp
+  801cf3:	c3                   	ret
+
+00801cf4 <sys_get_mac>:
+  801cf4:	55                   	push   %ebp
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	57                   	push   %edi
+  801cf8:	56                   	push   %esi
+  801cf9:	53                   	push   %ebx
+  801cfa:	83 ec 0c             	sub    $0xc,%esp
+  801cfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d08:	b8 15 00 00 00       	mov    $0x15,%eax
+  801d0d:	89 df                	mov    %ebx,%edi
+  801d0f:	89 de                	mov    %ebx,%esi
+  801d11:	cd 30                	int    $0x30
+  801d13:	85 c0                	test   %eax,%eax
+  801d15:	7f 08                	jg     801d1f <sys_get_mac+0x2b>
+  801d17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d1a:	5b                   	pop    %ebx
+  801d1b:	5e                   	pop    %esi
+  801d1c:	5f                   	pop    %edi
+  801d1d:	5d                   	pop    %ebp
+  801d1e:	c3                   	ret
+  801d1f:	83 ec 0c             	sub    $0xc,%esp
+  801d22:	50                   	push   %eax
+  801d23:	6a 15                	push   $0x15
+  801d25:	68 9b 51 80 00       	push   $0x80519b
+  801d2a:	6a 24                	push   $0x24
+  801d2c:	68 b8 51 80 00       	push   $0x8051b8
+  801d31:	e8 85 ed ff ff       	call   800abb <_panic>
+
+00801d36 <sys_env_lease>:
+  801d36:	55                   	push   %ebp
+  801d37:	89 e5                	mov    %esp,%ebp
+  801d39:	57                   	push   %edi
+  801d3a:	56                   	push   %esi
+  801d3b:	53                   	push   %ebx
+  801d3c:	83 ec 0c             	sub    $0xc,%esp
+  801d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d4a:	b8 16 00 00 00       	mov    $0x16,%eax
+  801d4f:	89 df                	mov    %ebx,%edi
+  801d51:	89 de                	mov    %ebx,%esi
+  801d53:	cd 30                	int    $0x30
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	7f 08                	jg     801d61 <sys_env_lease+0x2b>
+  801d59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5c:	5b                   	pop    %ebx
+  801d5d:	5e                   	pop    %esi
+  801d5e:	5f                   	pop    %edi
+  801d5f:	5d                   	pop    %ebp
+  801d60:	c3                   	ret
+  801d61:	83 ec 0c             	sub    $0xc,%esp
+  801d64:	50                   	push   %eax
+  801d65:	6a 16                	push   $0x16
+  801d67:	68 9b 51 80 00       	push   $0x80519b
+  801d6c:	6a 24                	push   $0x24
+  801d6e:	68 b8 51 80 00       	push   $0x8051b8
+  801d73:	e8 43 ed ff ff       	call   800abb <_panic>
+
+00801d78 <sys_copy_mem>:
+  801d78:	55                   	push   %ebp
+  801d79:	89 e5                	mov    %esp,%ebp
+  801d7b:	57                   	push   %edi
+  801d7c:	56                   	push   %esi
+  801d7d:	53                   	push   %ebx
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d87:	b8 17 00 00 00       	mov    $0x17,%eax
+  801d8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d8f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801d92:	8b 75 18             	mov    0x18(%ebp),%esi
+  801d95:	cd 30                	int    $0x30
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	7f 08                	jg     801da3 <sys_copy_mem+0x2b>
+  801d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d9e:	5b                   	pop    %ebx
+  801d9f:	5e                   	pop    %esi
+  801da0:	5f                   	pop    %edi
+  801da1:	5d                   	pop    %ebp
+  801da2:	c3                   	ret
+  801da3:	83 ec 0c             	sub    $0xc,%esp
+  801da6:	50                   	push   %eax
+  801da7:	6a 17                	push   $0x17
+  801da9:	68 9b 51 80 00       	push   $0x80519b
+  801dae:	6a 24                	push   $0x24
+  801db0:	68 b8 51 80 00       	push   $0x8051b8
+  801db5:	e8 01 ed ff ff       	call   800abb <_panic>
+
+00801dba <sys_get_perms>:
+  801dba:	55                   	push   %ebp
+  801dbb:	89 e5                	mov    %esp,%ebp
+  801dbd:	57                   	push   %edi
+  801dbe:	56                   	push   %esi
+  801dbf:	53                   	push   %ebx
+  801dc0:	83 ec 0c             	sub    $0xc,%esp
+  801dc3:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dce:	b8 18 00 00 00       	mov    $0x18,%eax
+  801dd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801dd6:	89 f7                	mov    %esi,%edi
+  801dd8:	cd 30                	int    $0x30
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	7f 08                	jg     801de6 <sys_get_perms+0x2c>
+  801dde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801de1:	5b                   	pop    %ebx
+  801de2:	5e                   	pop    %esi
+  801de3:	5f                   	pop    %edi
+  801de4:	5d                   	pop    %ebp
+  801de5:	c3                   	ret
+  801de6:	83 ec 0c             	sub    $0xc,%esp
+  801de9:	50                   	push   %eax
+  801dea:	6a 18                	push   $0x18
+  801dec:	68 9b 51 80 00       	push   $0x80519b
+  801df1:	6a 24                	push   $0x24
+  801df3:	68 b8 51 80 00       	push   $0x8051b8
+  801df8:	e8 be ec ff ff       	call   800abb <_panic>
+
+00801dfd <sys_env_unsuspend>:
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+  801e00:	57                   	push   %edi
+  801e01:	56                   	push   %esi
+  801e02:	53                   	push   %ebx
+  801e03:	83 ec 0c             	sub    $0xc,%esp
+  801e06:	be 00 00 00 00       	mov    $0x0,%esi
+  801e0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e11:	b8 19 00 00 00       	mov    $0x19,%eax
+  801e16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e19:	89 f7                	mov    %esi,%edi
+  801e1b:	cd 30                	int    $0x30
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	7f 08                	jg     801e29 <sys_env_unsuspend+0x2c>
+  801e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e24:	5b                   	pop    %ebx
+  801e25:	5e                   	pop    %esi
+  801e26:	5f                   	pop    %edi
+  801e27:	5d                   	pop    %ebp
+  801e28:	c3                   	ret
+  801e29:	83 ec 0c             	sub    $0xc,%esp
+  801e2c:	50                   	push   %eax
+  801e2d:	6a 19                	push   $0x19
+  801e2f:	68 9b 51 80 00       	push   $0x80519b
+  801e34:	6a 24                	push   $0x24
+  801e36:	68 b8 51 80 00       	push   $0x8051b8
+  801e3b:	e8 7b ec ff ff       	call   800abb <_panic>
+
+00801e40 <sys_migrate>:
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	57                   	push   %edi
+  801e44:	56                   	push   %esi
+  801e45:	53                   	push   %ebx
+  801e46:	83 ec 0c             	sub    $0xc,%esp
+  801e49:	ba 04 a0 80 00       	mov    $0x80a004,%edx
+  801e4e:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801e54:	76 11                	jbe    801e67 <sys_migrate+0x27>
+  801e56:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801e5b:	0f b6 08             	movzbl (%eax),%ecx
+  801e5e:	05 00 10 00 00       	add    $0x1000,%eax
+  801e63:	39 d0                	cmp    %edx,%eax
+  801e65:	72 f4                	jb     801e5b <sys_migrate+0x1b>
+  801e67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e6f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801e74:	89 cb                	mov    %ecx,%ebx
+  801e76:	89 cf                	mov    %ecx,%edi
+  801e78:	89 ce                	mov    %ecx,%esi
+  801e7a:	cd 30                	int    $0x30
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	7f 08                	jg     801e88 <sys_migrate+0x48>
+  801e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e83:	5b                   	pop    %ebx
+  801e84:	5e                   	pop    %esi
+  801e85:	5f                   	pop    %edi
+  801e86:	5d                   	pop    %ebp
+  801e87:	c3                   	ret
+  801e88:	83 ec 0c             	sub    $0xc,%esp
+  801e8b:	50                   	push   %eax
+  801e8c:	6a 1a                	push   $0x1a
+  801e8e:	68 9b 51 80 00       	push   $0x80519b
+  801e93:	6a 24                	push   $0x24
+  801e95:	68 b8 51 80 00       	push   $0x8051b8
+  801e9a:	e8 1c ec ff ff       	call   800abb <_panic>
+
+00801e9f <sys_lease_complete>:
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	57                   	push   %edi
+  801ea3:	56                   	push   %esi
+  801ea4:	53                   	push   %ebx
+  801ea5:	83 ec 0c             	sub    $0xc,%esp
+  801ea8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ead:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801eb2:	89 d1                	mov    %edx,%ecx
+  801eb4:	89 d3                	mov    %edx,%ebx
+  801eb6:	89 d7                	mov    %edx,%edi
+  801eb8:	89 d6                	mov    %edx,%esi
+  801eba:	cd 30                	int    $0x30
+  801ebc:	85 c0                	test   %eax,%eax
+  801ebe:	7f 08                	jg     801ec8 <sys_lease_complete+0x29>
+  801ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ec3:	5b                   	pop    %ebx
+  801ec4:	5e                   	pop    %esi
+  801ec5:	5f                   	pop    %edi
+  801ec6:	5d                   	pop    %ebp
+  801ec7:	c3                   	ret
+  801ec8:	83 ec 0c             	sub    $0xc,%esp
+  801ecb:	50                   	push   %eax
+  801ecc:	6a 1b                	push   $0x1b
+  801ece:	68 9b 51 80 00       	push   $0x80519b
+  801ed3:	6a 24                	push   $0x24
+  801ed5:	68 b8 51 80 00       	push   $0x8051b8
+  801eda:	e8 dc eb ff ff       	call   800abb <_panic>
+
+00801edf <sys_env_set_thisenv>:
+  801edf:	55                   	push   %ebp
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	57                   	push   %edi
+  801ee3:	56                   	push   %esi
+  801ee4:	53                   	push   %ebx
+  801ee5:	83 ec 0c             	sub    $0xc,%esp
+  801ee8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eed:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ef3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801ef8:	89 df                	mov    %ebx,%edi
+  801efa:	89 de                	mov    %ebx,%esi
+  801efc:	cd 30                	int    $0x30
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	7f 08                	jg     801f0a <sys_env_set_thisenv+0x2b>
+  801f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f05:	5b                   	pop    %ebx
+  801f06:	5e                   	pop    %esi
+  801f07:	5f                   	pop    %edi
+  801f08:	5d                   	pop    %ebp
+  801f09:	c3                   	ret
+  801f0a:	83 ec 0c             	sub    $0xc,%esp
+  801f0d:	50                   	push   %eax
+  801f0e:	6a 1c                	push   $0x1c
+  801f10:	68 9b 51 80 00       	push   $0x80519b
+  801f15:	6a 24                	push   $0x24
+  801f17:	68 b8 51 80 00       	push   $0x8051b8
+  801f1c:	e8 9a eb ff ff       	call   800abb <_panic>
+
+00801f21 <sys_env_set_sched>:
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	57                   	push   %edi
+  801f25:	56                   	push   %esi
+  801f26:	53                   	push   %ebx
+  801f27:	83 ec 0c             	sub    $0xc,%esp
+  801f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f35:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801f3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f3d:	89 f7                	mov    %esi,%edi
+  801f3f:	cd 30                	int    $0x30
+  801f41:	85 c0                	test   %eax,%eax
+  801f43:	7f 08                	jg     801f4d <sys_env_set_sched+0x2c>
+  801f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f48:	5b                   	pop    %ebx
+  801f49:	5e                   	pop    %esi
+  801f4a:	5f                   	pop    %edi
+  801f4b:	5d                   	pop    %ebp
+  801f4c:	c3                   	ret
+  801f4d:	83 ec 0c             	sub    $0xc,%esp
+  801f50:	50                   	push   %eax
+  801f51:	6a 1d                	push   $0x1d
+  801f53:	68 9b 51 80 00       	push   $0x80519b
+  801f58:	6a 24                	push   $0x24
+  801f5a:	68 b8 51 80 00       	push   $0x8051b8
+  801f5f:	e8 57 eb ff ff       	call   800abb <_panic>
+
+00801f64 <sys_batch>:
+  801f64:	55                   	push   %ebp
+  801f65:	89 e5                	mov    %esp,%ebp
+  801f67:	57                   	push   %edi
+  801f68:	56                   	push   %esi
+  801f69:	53                   	push   %ebx
+  801f6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f75:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801f7a:	89 df                	mov    %ebx,%edi
+  801f7c:	89 de                	mov    %ebx,%esi
+  801f7e:	cd 30                	int    $0x30
+  801f80:	5b                   	pop    %ebx
+  801f81:	5e                   	pop    %esi
+  801f82:	5f                   	pop    %edi
+  801f83:	5d                   	pop    %ebp
+  801f84:	c3                   	ret
+
+00801f85 <sys_env_stats>:
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	57                   	push   %edi
+  801f89:	56                   	push   %esi
+  801f8a:	53                   	push   %ebx
+  801f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f96:	b8 23 00 00 00       	mov    $0x23,%eax
+  801f9b:	89 df                	mov    %ebx,%edi
+  801f9d:	89 de                	mov    %ebx,%esi
+  801f9f:	cd 30                	int    $0x30
+  801fa1:	5b                   	pop    %ebx
+  801fa2:	5e                   	pop    %esi
+  801fa3:	5f                   	pop    %edi
+  801fa4:	5d                   	pop    %ebp
+  801fa5:	c3                   	ret
+
+00801fa6 <sys_trace>:
+  801fa6:	55                   	push   %ebp
+  801fa7:	89 e5                	mov    %esp,%ebp
+  801fa9:	57                   	push   %edi
+  801faa:	56                   	push   %esi
+  801fab:	53                   	push   %ebx
+  801fac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb4:	b8 24 00 00 00       	mov    $0x24,%eax
+  801fb9:	89 cb                	mov    %ecx,%ebx
+  801fbb:	89 cf                	mov    %ecx,%edi
+  801fbd:	89 ce                	mov    %ecx,%esi
+  801fbf:	cd 30                	int    $0x30
+  801fc1:	5b                   	pop    %ebx
+  801fc2:	5e                   	pop    %esi
+  801fc3:	5f                   	pop    %edi
+  801fc4:	5d                   	pop    %ebp
+  801fc5:	c3                   	ret
+
+00801fc6 <sys_env_set_pager>:
+  801fc6:	55                   	push   %ebp
+  801fc7:	89 e5                	mov    %esp,%ebp
+  801fc9:	57                   	push   %edi
+  801fca:	56                   	push   %esi
+  801fcb:	53                   	push   %ebx
+  801fcc:	83 ec 0c             	sub    $0xc,%esp
+  801fcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fda:	b8 25 00 00 00       	mov    $0x25,%eax
+  801fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fe2:	89 f7                	mov    %esi,%edi
+  801fe4:	cd 30                	int    $0x30
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	7f 08                	jg     801ff2 <sys_env_set_pager+0x2c>
+  801fea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fed:	5b                   	pop    %ebx
+  801fee:	5e                   	pop    %esi
+  801fef:	5f                   	pop    %edi
+  801ff0:	5d                   	pop    %ebp
+  801ff1:	c3                   	ret
+  801ff2:	83 ec 0c             	sub    $0xc,%esp
+  801ff5:	50                   	push   %eax
+  801ff6:	6a 25                	push   $0x25
+  801ff8:	68 9b 51 80 00       	push   $0x80519b
+  801ffd:	6a 24                	push   $0x24
+  801fff:	68 b8 51 80 00       	push   $0x8051b8
+  802004:	e8 b2 ea ff ff       	call   800abb <_panic>
+
+00802009 <sys_pager_retire>:
+  802009:	55                   	push   %ebp
+  80200a:	89 e5                	mov    %esp,%ebp
+  80200c:	57                   	push   %edi
+  80200d:	56                   	push   %esi
+  80200e:	53                   	push   %ebx
+  80200f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802014:	8b 55 08             	mov    0x8(%ebp),%edx
+  802017:	b8 28 00 00 00       	mov    $0x28,%eax
+  80201c:	89 cb                	mov    %ecx,%ebx
+  80201e:	89 cf                	mov    %ecx,%edi
+  802020:	89 ce                	mov    %ecx,%esi
+  802022:	cd 30                	int    $0x30
+  802024:	5b                   	pop    %ebx
+  802025:	5e                   	pop    %esi
+  802026:	5f                   	pop    %edi
+  802027:	5d                   	pop    %ebp
+  802028:	c3                   	ret
+
+00802029 <sys_prof>:
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	57                   	push   %edi
+  80202d:	56                   	push   %esi
+  80202e:	53                   	push   %ebx
+  80202f:	be 00 00 00 00       	mov    $0x0,%esi
+  802034:	8b 55 08             	mov    0x8(%ebp),%edx
+  802037:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80203a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80203f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802042:	89 f7                	mov    %esi,%edi
+  802044:	cd 30                	int    $0x30
+  802046:	5b                   	pop    %ebx
+  802047:	5e                   	pop    %esi
+  802048:	5f                   	pop    %edi
+  802049:	5d                   	pop    %ebp
+  80204a:	c3                   	ret
+
+0080204b <dupq_flush>:
+  80204b:	55                   	push   %ebp
+  80204c:	89 e5                	mov    %esp,%ebp
+  80204e:	53                   	push   %ebx
+  80204f:	83 ec 0c             	sub    $0xc,%esp
+  802052:	8b 1d 20 74 80 00    	mov    0x807420,%ebx
+  802058:	c7 05 20 74 80 00 00 	movl   $0x0,0x807420
+  80205f:	00 00 00 
+  802062:	53                   	push   %ebx
+  802063:	68 00 00 40 00       	push   $0x400000
+  802068:	e8 f7 fe ff ff       	call   801f64 <sys_batch>
+  80206d:	83 c4 10             	add    $0x10,%esp
+  802070:	85 c0                	test   %eax,%eax
+  802072:	78 14                	js     802088 <dupq_flush+0x3d>
+  802074:	39 c3                	cmp    %eax,%ebx
+  802076:	7e 0b                	jle    802083 <dupq_flush+0x38>
+  802078:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80207b:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  802081:	eb 05                	jmp    802088 <dupq_flush+0x3d>
+  802083:	b8 00 00 00 00       	mov    $0x0,%eax
+  802088:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208b:	c9                   	leave
+  80208c:	c3                   	ret
+
+0080208d <pgfault>:
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	56                   	push   %esi
+  802091:	53                   	push   %ebx
+  802092:	8b 45 08             	mov    0x8(%ebp),%eax
+  802095:	8b 30                	mov    (%eax),%esi
+  802097:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80209b:	0f 84 83 00 00 00    	je     802124 <pgfault+0x97>
+  8020a1:	89 f0                	mov    %esi,%eax
+  8020a3:	c1 e8 0c             	shr    $0xc,%eax
+  8020a6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8020ad:	f6 c4 08             	test   $0x8,%ah
+  8020b0:	0f 84 80 00 00 00    	je     802136 <pgfault+0xa9>
+  8020b6:	e8 b8 f6 ff ff       	call   801773 <sys_getenvid>
+  8020bb:	89 c3                	mov    %eax,%ebx
+  8020bd:	83 ec 04             	sub    $0x4,%esp
+  8020c0:	6a 07                	push   $0x7
+  8020c2:	68 00 f0 7f 00       	push   $0x7ff000
+  8020c7:	50                   	push   %eax
+  8020c8:	e8 10 f7 ff ff       	call   8017dd <sys_page_alloc>
+  8020cd:	83 c4 10             	add    $0x10,%esp
+  8020d0:	85 c0                	test   %eax,%eax
+  8020d2:	78 74                	js     802148 <pgfault+0xbb>
+  8020d4:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8020da:	83 ec 04             	sub    $0x4,%esp
+  8020dd:	68 00 10 00 00       	push   $0x1000
+  8020e2:	56                   	push   %esi
+  8020e3:	68 00 f0 7f 00       	push   $0x7ff000
+  8020e8:	e8 40 f4 ff ff       	call   80152d <memmove>
+  8020ed:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8020f4:	56                   	push   %esi
+  8020f5:	53                   	push   %ebx
+  8020f6:	68 00 f0 7f 00       	push   $0x7ff000
+  8020fb:	53                   	push   %ebx
+  8020fc:	e8 1f f7 ff ff       	call   801820 <sys_page_map>
+  802101:	83 c4 20             	add    $0x20,%esp
+  802104:	85 c0                	test   %eax,%eax
+  802106:	78 54                	js     80215c <pgfault+0xcf>
+  802108:	83 ec 08             	sub    $0x8,%esp
+  80210b:	68 00 f0 7f 00       	push   $0x7ff000
+  802110:	53                   	push   %ebx
+  802111:	e8 99 f7 ff ff       	call   8018af <sys_page_unmap>
+  802116:	83 c4 10             	add    $0x10,%esp
+  802119:	85 c0                	test   %eax,%eax
+  80211b:	78 53                	js     802170 <pgfault+0xe3>
+  80211d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802120:	5b                   	pop    %ebx
+  802121:	5e                   	pop    %esi
+  802122:	5d                   	pop    %ebp
+  802123:	c3                   	ret
+  802124:	56                   	push   %esi
+  802125:	68 c8 51 80 00       	push   $0x8051c8
+  80212a:	6a 19                	push   $0x19
+  80212c:	68 a4 52 80 00       	push   $0x8052a4
+  802131:	e8 85 e9 ff ff       	call   800abb <_panic>
+  802136:	56                   	push   %esi
+  802137:	68 fc 51 80 00       	push   $0x8051fc
+  80213c:	6a 1e                	push   $0x1e
+  80213e:	68 a4 52 80 00       	push   $0x8052a4
+  802143:	e8 73 e9 ff ff       	call   800abb <_panic>
+  802148:	83 ec 04             	sub    $0x4,%esp
+  80214b:	68 30 52 80 00       	push   $0x805230
+  802150:	6a 2e                	push   $0x2e
+  802152:	68 a4 52 80 00       	push   $0x8052a4
+  802157:	e8 5f e9 ff ff       	call   800abb <_panic>
+  80215c:	83 ec 04             	sub    $0x4,%esp
+  80215f:	68 54 52 80 00       	push   $0x805254
+  802164:	6a 37                	push   $0x37
+  802166:	68 a4 52 80 00       	push   $0x8052a4
+  80216b:	e8 4b e9 ff ff       	call   800abb <_panic>
+  802170:	83 ec 04             	sub    $0x4,%esp
+  802173:	68 80 52 80 00       	push   $0x805280
+  802178:	6a 3c                	push   $0x3c
+  80217a:	68 a4 52 80 00       	push   $0x8052a4
+  80217f:	e8 37 e9 ff ff       	call   800abb <_panic>
+
+00802184 <dupq_begin>:
+  802184:	55                   	push   %ebp
+  802185:	89 e5                	mov    %esp,%ebp
+  802187:	83 ec 0c             	sub    $0xc,%esp
+  80218a:	c7 05 20 74 80 00 00 	movl   $0x0,0x807420
+  802191:	00 00 00 
+  802194:	6a 07                	push   $0x7
+  802196:	68 00 00 40 00       	push   $0x400000
+  80219b:	6a 00                	push   $0x0
+  80219d:	e8 3b f6 ff ff       	call   8017dd <sys_page_alloc>
+  8021a2:	c9                   	leave
+  8021a3:	c3                   	ret
+
+008021a4 <dupq_map>:
+  8021a4:	55                   	push   %ebp
+  8021a5:	89 e5                	mov    %esp,%ebp
+  8021a7:	83 ec 08             	sub    $0x8,%esp
+  8021aa:	81 3d 20 74 80 00 92 	cmpl   $0x92,0x807420
+  8021b1:	00 00 00 
+  8021b4:	74 46                	je     8021fc <dupq_map+0x58>
+  8021b6:	8b 15 20 74 80 00    	mov    0x807420,%edx
+  8021bc:	8d 42 01             	lea    0x1(%edx),%eax
+  8021bf:	a3 20 74 80 00       	mov    %eax,0x807420
+  8021c4:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8021c7:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  8021cd:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  8021d4:	00 00 00 
+  8021d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021da:	89 50 04             	mov    %edx,0x4(%eax)
+  8021dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021e0:	c1 e2 0c             	shl    $0xc,%edx
+  8021e3:	89 50 08             	mov    %edx,0x8(%eax)
+  8021e6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8021e9:	89 48 0c             	mov    %ecx,0xc(%eax)
+  8021ec:	89 50 10             	mov    %edx,0x10(%eax)
+  8021ef:	8b 55 14             	mov    0x14(%ebp),%edx
+  8021f2:	89 50 14             	mov    %edx,0x14(%eax)
+  8021f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fa:	c9                   	leave
+  8021fb:	c3                   	ret
+  8021fc:	e8 4a fe ff ff       	call   80204b <dupq_flush>
+  802201:	85 c0                	test   %eax,%eax
+  802203:	79 b1                	jns    8021b6 <dupq_map+0x12>
+  802205:	eb f3                	jmp    8021fa <dupq_map+0x56>
+
+00802207 <dupq_end>:
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	53                   	push   %ebx
+  80220b:	83 ec 04             	sub    $0x4,%esp
+  80220e:	e8 38 fe ff ff       	call   80204b <dupq_flush>
+  802213:	89 c3                	mov    %eax,%ebx
+  802215:	83 ec 08             	sub    $0x8,%esp
+  802218:	68 00 00 40 00       	push   $0x400000
+  80221d:	6a 00                	push   $0x0
+  80221f:	e8 8b f6 ff ff       	call   8018af <sys_page_unmap>
+  802224:	89 d8                	mov    %ebx,%eax
+  802226:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802229:	c9                   	leave
+  80222a:	c3                   	ret
+
+0080222b <fork>:
+  80222b:	55                   	push   %ebp
+  80222c:	89 e5                	mov    %esp,%ebp
+  80222e:	53                   	push   %ebx
+  80222f:	83 ec 10             	sub    $0x10,%esp
+  802232:	68 8d 20 80 00       	push   $0x80208d
+  802237:	e8 b0 24 00 00       	call   8046ec <set_pgfault_handler>
+  80223c:	83 c4 08             	add    $0x8,%esp
+  80223f:	6a 01                	push   $0x1
+  802241:	6a 00                	push   $0x0
+  802243:	e8 4c f7 ff ff       	call   801994 <sys_env_set_cow>
+  802248:	e8 a4 f6 ff ff       	call   8018f1 <sys_fork>
+  80224d:	89 c3                	mov    %eax,%ebx
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	85 c0                	test   %eax,%eax
+  802254:	74 07                	je     80225d <fork+0x32>
+  802256:	89 d8                	mov    %ebx,%eax
+  802258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225b:	c9                   	leave
+  80225c:	c3                   	ret
+  80225d:	e8 11 f5 ff ff       	call   801773 <sys_getenvid>
+  802262:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802267:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80226d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802272:	a3 34 74 80 00       	mov    %eax,0x807434
+  802277:	eb dd                	jmp    802256 <fork+0x2b>
+
+00802279 <sfork>:
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	57                   	push   %edi
+  80227d:	56                   	push   %esi
+  80227e:	53                   	push   %ebx
+  80227f:	83 ec 1c             	sub    $0x1c,%esp
+  802282:	e8 ec f4 ff ff       	call   801773 <sys_getenvid>
+  802287:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80228a:	83 ec 0c             	sub    $0xc,%esp
+  80228d:	68 8d 20 80 00       	push   $0x80208d
+  802292:	e8 55 24 00 00       	call   8046ec <set_pgfault_handler>
+  802297:	b8 07 00 00 00       	mov    $0x7,%eax
+  80229c:	cd 30                	int    $0x30
+  80229e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	0f 88 45 02 00 00    	js     8024f1 <sfork+0x278>
+  8022ac:	89 c6                	mov    %eax,%esi
+  8022ae:	74 17                	je     8022c7 <sfork+0x4e>
+  8022b0:	e8 cf fe ff ff       	call   802184 <dupq_begin>
+  8022b5:	85 c0                	test   %eax,%eax
+  8022b7:	0f 88 40 02 00 00    	js     8024fd <sfork+0x284>
+  8022bd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022c2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8022c5:	eb 39                	jmp    802300 <sfork+0x87>
+  8022c7:	e8 a7 f4 ff ff       	call   801773 <sys_getenvid>
+  8022cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8022d1:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8022d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8022dc:	a3 34 74 80 00       	mov    %eax,0x807434
+  8022e1:	e9 23 01 00 00       	jmp    802409 <sfork+0x190>
+  8022e6:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8022ed:	a8 01                	test   $0x1,%al
+  8022ef:	75 5b                	jne    80234c <sfork+0xd3>
+  8022f1:	83 c7 01             	add    $0x1,%edi
+  8022f4:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  8022fa:	0f 84 40 01 00 00    	je     802440 <sfork+0x1c7>
+  802300:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  802307:	a8 01                	test   $0x1,%al
+  802309:	74 db                	je     8022e6 <sfork+0x6d>
+  80230b:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  802312:	a8 80                	test   $0x80,%al
+  802314:	74 d0                	je     8022e6 <sfork+0x6d>
+  802316:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80231d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802322:	0c 80                	or     $0x80,%al
+  802324:	50                   	push   %eax
+  802325:	ff 75 e4             	push   -0x1c(%ebp)
+  802328:	89 f8                	mov    %edi,%eax
+  80232a:	c1 e0 16             	shl    $0x16,%eax
+  80232d:	c1 e8 0c             	shr    $0xc,%eax
+  802330:	50                   	push   %eax
+  802331:	ff 75 e0             	push   -0x20(%ebp)
+  802334:	e8 6b fe ff ff       	call   8021a4 <dupq_map>
+  802339:	83 c4 10             	add    $0x10,%esp
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	79 b1                	jns    8022f1 <sfork+0x78>
+  802340:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802347:	e9 bd 00 00 00       	jmp    802409 <sfork+0x190>
+  80234c:	89 fe                	mov    %edi,%esi
+  80234e:	c1 e6 16             	shl    $0x16,%esi
+  802351:	89 f0                	mov    %esi,%eax
+  802353:	c1 e8 0c             	shr    $0xc,%eax
+  802356:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80235b:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80235e:	eb 57                	jmp    8023b7 <sfork+0x13e>
+  802360:	e8 0e f4 ff ff       	call   801773 <sys_getenvid>
+  802365:	89 c7                	mov    %eax,%edi
+  802367:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  80236c:	f6 c4 04             	test   $0x4,%ah
+  80236f:	0f 85 9f 00 00 00    	jne    802414 <sfork+0x19b>
+  802375:	a9 02 08 00 00       	test   $0x802,%eax
+  80237a:	0f 85 c5 01 00 00    	jne    802545 <sfork+0x2cc>
+  802380:	6a 05                	push   $0x5
+  802382:	ff 75 e4             	push   -0x1c(%ebp)
+  802385:	68 fd e7 0e 00       	push   $0xee7fd
+  80238a:	57                   	push   %edi
+  80238b:	e8 14 fe ff ff       	call   8021a4 <dupq_map>
+  802390:	83 c4 10             	add    $0x10,%esp
+  802393:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802399:	0f 84 91 00 00 00    	je     802430 <sfork+0x1b7>
+  80239f:	89 f0                	mov    %esi,%eax
+  8023a1:	09 d8                	or     %ebx,%eax
+  8023a3:	c1 e8 0c             	shr    $0xc,%eax
+  8023a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023ac:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  8023b1:	0f 84 81 00 00 00    	je     802438 <sfork+0x1bf>
+  8023b7:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  8023bc:	74 a2                	je     802360 <sfork+0xe7>
+  8023be:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8023c5:	f6 c2 01             	test   $0x1,%dl
+  8023c8:	74 c9                	je     802393 <sfork+0x11a>
+  8023ca:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8023d1:	f6 c6 02             	test   $0x2,%dh
+  8023d4:	75 bd                	jne    802393 <sfork+0x11a>
+  8023d6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8023dd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8023e4:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  8023ea:	f7 d2                	not    %edx
+  8023ec:	21 ca                	and    %ecx,%edx
+  8023ee:	52                   	push   %edx
+  8023ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8023f2:	50                   	push   %eax
+  8023f3:	ff 75 e0             	push   -0x20(%ebp)
+  8023f6:	e8 a9 fd ff ff       	call   8021a4 <dupq_map>
+  8023fb:	83 c4 10             	add    $0x10,%esp
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	79 91                	jns    802393 <sfork+0x11a>
+  802402:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802409:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80240c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240f:	5b                   	pop    %ebx
+  802410:	5e                   	pop    %esi
+  802411:	5f                   	pop    %edi
+  802412:	5d                   	pop    %ebp
+  802413:	c3                   	ret
+  802414:	25 07 0e 00 00       	and    $0xe07,%eax
+  802419:	50                   	push   %eax
+  80241a:	ff 75 e4             	push   -0x1c(%ebp)
+  80241d:	68 fd e7 0e 00       	push   $0xee7fd
+  802422:	57                   	push   %edi
+  802423:	e8 7c fd ff ff       	call   8021a4 <dupq_map>
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	e9 63 ff ff ff       	jmp    802393 <sfork+0x11a>
+  802430:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802433:	e9 b9 fe ff ff       	jmp    8022f1 <sfork+0x78>
+  802438:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80243b:	e9 b1 fe ff ff       	jmp    8022f1 <sfork+0x78>
+  802440:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  802443:	e8 bf fd ff ff       	call   802207 <dupq_end>
+  802448:	85 c0                	test   %eax,%eax
+  80244a:	0f 88 b9 00 00 00    	js     802509 <sfork+0x290>
+  802450:	83 ec 04             	sub    $0x4,%esp
+  802453:	6a 07                	push   $0x7
+  802455:	68 00 f0 7f ee       	push   $0xee7ff000
+  80245a:	56                   	push   %esi
+  80245b:	e8 7d f3 ff ff       	call   8017dd <sys_page_alloc>
+  802460:	83 c4 10             	add    $0x10,%esp
+  802463:	85 c0                	test   %eax,%eax
+  802465:	0f 88 aa 00 00 00    	js     802515 <sfork+0x29c>
+  80246b:	83 ec 0c             	sub    $0xc,%esp
+  80246e:	6a 07                	push   $0x7
+  802470:	68 00 f0 7f 00       	push   $0x7ff000
+  802475:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  802478:	57                   	push   %edi
+  802479:	68 00 f0 7f ee       	push   $0xee7ff000
+  80247e:	56                   	push   %esi
+  80247f:	e8 9c f3 ff ff       	call   801820 <sys_page_map>
+  802484:	83 c4 20             	add    $0x20,%esp
+  802487:	85 c0                	test   %eax,%eax
+  802489:	0f 88 92 00 00 00    	js     802521 <sfork+0x2a8>
+  80248f:	83 ec 04             	sub    $0x4,%esp
+  802492:	68 00 10 00 00       	push   $0x1000
+  802497:	68 00 f0 7f 00       	push   $0x7ff000
+  80249c:	68 00 f0 7f ee       	push   $0xee7ff000
+  8024a1:	e8 87 f0 ff ff       	call   80152d <memmove>
+  8024a6:	83 c4 08             	add    $0x8,%esp
+  8024a9:	68 00 f0 7f 00       	push   $0x7ff000
+  8024ae:	57                   	push   %edi
+  8024af:	e8 fb f3 ff ff       	call   8018af <sys_page_unmap>
+  8024b4:	83 c4 10             	add    $0x10,%esp
+  8024b7:	85 c0                	test   %eax,%eax
+  8024b9:	78 72                	js     80252d <sfork+0x2b4>
+  8024bb:	83 ec 08             	sub    $0x8,%esp
+  8024be:	68 64 47 80 00       	push   $0x804764
+  8024c3:	56                   	push   %esi
+  8024c4:	e8 2d f5 ff ff       	call   8019f6 <sys_env_set_pgfault_upcall>
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	85 c0                	test   %eax,%eax
+  8024ce:	78 69                	js     802539 <sfork+0x2c0>
+  8024d0:	83 ec 08             	sub    $0x8,%esp
+  8024d3:	6a 02                	push   $0x2
+  8024d5:	56                   	push   %esi
+  8024d6:	e8 35 f4 ff ff       	call   801910 <sys_env_set_status>
+  8024db:	83 c4 10             	add    $0x10,%esp
+  8024de:	85 c0                	test   %eax,%eax
+  8024e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8024e5:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  8024e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024ec:	e9 18 ff ff ff       	jmp    802409 <sfork+0x190>
+  8024f1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8024f8:	e9 0c ff ff ff       	jmp    802409 <sfork+0x190>
+  8024fd:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802504:	e9 00 ff ff ff       	jmp    802409 <sfork+0x190>
+  802509:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802510:	e9 f4 fe ff ff       	jmp    802409 <sfork+0x190>
+  802515:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80251c:	e9 e8 fe ff ff       	jmp    802409 <sfork+0x190>
+  802521:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802528:	e9 dc fe ff ff       	jmp    802409 <sfork+0x190>
+  80252d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802534:	e9 d0 fe ff ff       	jmp    802409 <sfork+0x190>
+  802539:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802540:	e9 c4 fe ff ff       	jmp    802409 <sfork+0x190>
+  802545:	68 05 08 00 00       	push   $0x805
+  80254a:	ff 75 e4             	push   -0x1c(%ebp)
+  80254d:	68 fd e7 0e 00       	push   $0xee7fd
+  802552:	57                   	push   %edi
+  802553:	e8 4c fc ff ff       	call   8021a4 <dupq_map>
+  802558:	83 c4 10             	add    $0x10,%esp
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	0f 88 30 fe ff ff    	js     802393 <sfork+0x11a>
+  802563:	68 05 08 00 00       	push   $0x805
+  802568:	57                   	push   %edi
+  802569:	68 fd e7 0e 00       	push   $0xee7fd
+  80256e:	57                   	push   %edi
+  80256f:	e8 30 fc ff ff       	call   8021a4 <dupq_map>
+  802574:	83 c4 10             	add    $0x10,%esp
+  802577:	e9 17 fe ff ff       	jmp    802393 <sfork+0x11a>
+
+0080257c <argstart>:
+  80257c:	55                   	push   %ebp
+  80257d:	89 e5                	mov    %esp,%ebp
+  80257f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802582:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802585:	8b 45 10             	mov    0x10(%ebp),%eax
+  802588:	89 10                	mov    %edx,(%eax)
+  80258a:	89 48 04             	mov    %ecx,0x4(%eax)
+  80258d:	83 3a 01             	cmpl   $0x1,(%edx)
+  802590:	7e 09                	jle    80259b <argstart+0x1f>
+  802592:	ba 61 4c 80 00       	mov    $0x804c61,%edx
+  802597:	85 c9                	test   %ecx,%ecx
+  802599:	75 05                	jne    8025a0 <argstart+0x24>
+  80259b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a0:	89 50 08             	mov    %edx,0x8(%eax)
+  8025a3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8025aa:	5d                   	pop    %ebp
+  8025ab:	c3                   	ret
+
+008025ac <argnext>:
+  8025ac:	55                   	push   %ebp
+  8025ad:	89 e5                	mov    %esp,%ebp
+  8025af:	53                   	push   %ebx
+  8025b0:	83 ec 04             	sub    $0x4,%esp
+  8025b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025b6:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  8025bd:	8b 43 08             	mov    0x8(%ebx),%eax
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	74 74                	je     802638 <argnext+0x8c>
+  8025c4:	80 38 00             	cmpb   $0x0,(%eax)
+  8025c7:	75 48                	jne    802611 <argnext+0x65>
+  8025c9:	8b 0b                	mov    (%ebx),%ecx
+  8025cb:	83 39 01             	cmpl   $0x1,(%ecx)
+  8025ce:	74 5a                	je     80262a <argnext+0x7e>
+  8025d0:	8b 53 04             	mov    0x4(%ebx),%edx
+  8025d3:	8b 42 04             	mov    0x4(%edx),%eax
+  8025d6:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8025d9:	75 4f                	jne    80262a <argnext+0x7e>
+  8025db:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8025df:	74 49                	je     80262a <argnext+0x7e>
+  8025e1:	83 c0 01             	add    $0x1,%eax
+  8025e4:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025e7:	83 ec 04             	sub    $0x4,%esp
+  8025ea:	8b 01                	mov    (%ecx),%eax
+  8025ec:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8025f3:	50                   	push   %eax
+  8025f4:	8d 42 08             	lea    0x8(%edx),%eax
+  8025f7:	50                   	push   %eax
+  8025f8:	83 c2 04             	add    $0x4,%edx
+  8025fb:	52                   	push   %edx
+  8025fc:	e8 2c ef ff ff       	call   80152d <memmove>
+  802601:	8b 03                	mov    (%ebx),%eax
+  802603:	83 28 01             	subl   $0x1,(%eax)
+  802606:	8b 43 08             	mov    0x8(%ebx),%eax
+  802609:	83 c4 10             	add    $0x10,%esp
+  80260c:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80260f:	74 13                	je     802624 <argnext+0x78>
+  802611:	8b 43 08             	mov    0x8(%ebx),%eax
+  802614:	0f b6 10             	movzbl (%eax),%edx
+  802617:	83 c0 01             	add    $0x1,%eax
+  80261a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80261d:	89 d0                	mov    %edx,%eax
+  80261f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+  802624:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  802628:	75 e7                	jne    802611 <argnext+0x65>
+  80262a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  802631:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802636:	eb e5                	jmp    80261d <argnext+0x71>
+  802638:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80263d:	eb de                	jmp    80261d <argnext+0x71>
+
+0080263f <argnextvalue>:
+  80263f:	55                   	push   %ebp
+  802640:	89 e5                	mov    %esp,%ebp
+  802642:	53                   	push   %ebx
+  802643:	83 ec 04             	sub    $0x4,%esp
+  802646:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802649:	8b 43 08             	mov    0x8(%ebx),%eax
+  80264c:	85 c0                	test   %eax,%eax
+  80264e:	74 12                	je     802662 <argnextvalue+0x23>
+  802650:	80 38 00             	cmpb   $0x0,(%eax)
+  802653:	74 12                	je     802667 <argnextvalue+0x28>
+  802655:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802658:	c7 43 08 61 4c 80 00 	movl   $0x804c61,0x8(%ebx)
+  80265f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802662:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802665:	c9                   	leave
+  802666:	c3                   	ret
+  802667:	8b 13                	mov    (%ebx),%edx
+  802669:	83 3a 01             	cmpl   $0x1,(%edx)
+  80266c:	7f 10                	jg     80267e <argnextvalue+0x3f>
+  80266e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  802675:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  80267c:	eb e1                	jmp    80265f <argnextvalue+0x20>
+  80267e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802681:	8b 48 04             	mov    0x4(%eax),%ecx
+  802684:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+  802687:	83 ec 04             	sub    $0x4,%esp
+  80268a:	8b 12                	mov    (%edx),%edx
+  80268c:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  802693:	52                   	push   %edx
+  802694:	8d 50 08             	lea    0x8(%eax),%edx
+  802697:	52                   	push   %edx
+  802698:	83 c0 04             	add    $0x4,%eax
+  80269b:	50                   	push   %eax
+  80269c:	e8 8c ee ff ff       	call   80152d <memmove>
+  8026a1:	8b 03                	mov    (%ebx),%eax
+  8026a3:	83 28 01             	subl   $0x1,(%eax)
+  8026a6:	83 c4 10             	add    $0x10,%esp
+  8026a9:	eb b4                	jmp    80265f <argnextvalue+0x20>
+
+008026ab <argvalue>:
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	83 ec 08             	sub    $0x8,%esp
+  8026b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026b4:	8b 42 0c             	mov    0xc(%edx),%eax
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	74 02                	je     8026bd <argvalue+0x12>
+  8026bb:	c9                   	leave
+  8026bc:	c3                   	ret
+  8026bd:	83 ec 0c             	sub    $0xc,%esp
+  8026c0:	52                   	push   %edx
+  8026c1:	e8 79 ff ff ff       	call   80263f <argnextvalue>
+  8026c6:	83 c4 10             	add    $0x10,%esp
+  8026c9:	eb f0                	jmp    8026bb <argvalue+0x10>
+
+008026cb <fd2num>:
+  8026cb:	55                   	push   %ebp
+  8026cc:	89 e5                	mov    %esp,%ebp
+  8026ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8026d6:	c1 e8 0c             	shr    $0xc,%eax
+  8026d9:	5d                   	pop    %ebp
+  8026da:	c3                   	ret
+
+008026db <fd2data>:
+  8026db:	55                   	push   %ebp
+  8026dc:	89 e5                	mov    %esp,%ebp
+  8026de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8026e6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8026eb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  8026f0:	5d                   	pop    %ebp
+  8026f1:	c3                   	ret
+
+008026f2 <fd_alloc>:
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8026fa:	89 c2                	mov    %eax,%edx
+  8026fc:	c1 ea 16             	shr    $0x16,%edx
+  8026ff:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802706:	f6 c2 01             	test   $0x1,%dl
+  802709:	74 29                	je     802734 <fd_alloc+0x42>
+  80270b:	89 c2                	mov    %eax,%edx
+  80270d:	c1 ea 0c             	shr    $0xc,%edx
+  802710:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802717:	f6 c2 01             	test   $0x1,%dl
+  80271a:	74 18                	je     802734 <fd_alloc+0x42>
+  80271c:	05 00 10 00 00       	add    $0x1000,%eax
+  802721:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  802726:	75 d2                	jne    8026fa <fd_alloc+0x8>
+  802728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802732:	eb 05                	jmp    802739 <fd_alloc+0x47>
+  802734:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802739:	8b 55 08             	mov    0x8(%ebp),%edx
+  80273c:	89 02                	mov    %eax,(%edx)
+  80273e:	89 c8                	mov    %ecx,%eax
+  802740:	5d                   	pop    %ebp
+  802741:	c3                   	ret
+
+00802742 <fd_lookup>:
+  802742:	55                   	push   %ebp
+  802743:	89 e5                	mov    %esp,%ebp
+  802745:	8b 45 08             	mov    0x8(%ebp),%eax
+  802748:	83 f8 1f             	cmp    $0x1f,%eax
+  80274b:	77 30                	ja     80277d <fd_lookup+0x3b>
+  80274d:	c1 e0 0c             	shl    $0xc,%eax
+  802750:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  802755:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80275b:	f6 c2 01             	test   $0x1,%dl
+  80275e:	74 24                	je     802784 <fd_lookup+0x42>
+  802760:	89 c2                	mov    %eax,%edx
+  802762:	c1 ea 0c             	shr    $0xc,%edx
+  802765:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80276c:	f6 c2 01             	test   $0x1,%dl
+  80276f:	74 1a                	je     80278b <fd_lookup+0x49>
+  802771:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802774:	89 02                	mov    %eax,(%edx)
+  802776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277b:	5d                   	pop    %ebp
+  80277c:	c3                   	ret
+  80277d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802782:	eb f7                	jmp    80277b <fd_lookup+0x39>
+  802784:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802789:	eb f0                	jmp    80277b <fd_lookup+0x39>
+  80278b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802790:	eb e9                	jmp    80277b <fd_lookup+0x39>
+
+00802792 <dev_lookup>:
+  802792:	55                   	push   %ebp
+  802793:	89 e5                	mov    %esp,%ebp
+  802795:	53                   	push   %ebx
+  802796:	83 ec 04             	sub    $0x4,%esp
+  802799:	8b 55 08             	mov    0x8(%ebp),%edx
+  80279c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a1:	bb 20 60 80 00       	mov    $0x806020,%ebx
+  8027a6:	39 13                	cmp    %edx,(%ebx)
+  8027a8:	74 37                	je     8027e1 <dev_lookup+0x4f>
+  8027aa:	83 c0 01             	add    $0x1,%eax
+  8027ad:	8b 1c 85 2c 53 80 00 	mov    0x80532c(,%eax,4),%ebx
+  8027b4:	85 db                	test   %ebx,%ebx
+  8027b6:	75 ee                	jne    8027a6 <dev_lookup+0x14>
+  8027b8:	a1 34 74 80 00       	mov    0x807434,%eax
+  8027bd:	8b 40 48             	mov    0x48(%eax),%eax
+  8027c0:	83 ec 04             	sub    $0x4,%esp
+  8027c3:	52                   	push   %edx
+  8027c4:	50                   	push   %eax
+  8027c5:	68 b0 52 80 00       	push   $0x8052b0
+  8027ca:	e8 c7 e3 ff ff       	call   800b96 <cprintf>
+  8027cf:	83 c4 10             	add    $0x10,%esp
+  8027d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027da:	89 1a                	mov    %ebx,(%edx)
+  8027dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+  8027e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e6:	eb ef                	jmp    8027d7 <dev_lookup+0x45>
+
+008027e8 <fd_close>:
+  8027e8:	55                   	push   %ebp
+  8027e9:	89 e5                	mov    %esp,%ebp
+  8027eb:	57                   	push   %edi
+  8027ec:	56                   	push   %esi
+  8027ed:	53                   	push   %ebx
+  8027ee:	83 ec 24             	sub    $0x24,%esp
+  8027f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8027f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027fa:	50                   	push   %eax
+  8027fb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802801:	c1 e8 0c             	shr    $0xc,%eax
+  802804:	50                   	push   %eax
+  802805:	e8 38 ff ff ff       	call   802742 <fd_lookup>
+  80280a:	89 c3                	mov    %eax,%ebx
+  80280c:	83 c4 10             	add    $0x10,%esp
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	78 05                	js     802818 <fd_close+0x30>
+  802813:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802816:	74 0f                	je     802827 <fd_close+0x3f>
+  802818:	85 ff                	test   %edi,%edi
+  80281a:	0f 44 df             	cmove  %edi,%ebx
+  80281d:	89 d8                	mov    %ebx,%eax
+  80281f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802822:	5b                   	pop    %ebx
+  802823:	5e                   	pop    %esi
+  802824:	5f                   	pop    %edi
+  802825:	5d                   	pop    %ebp
+  802826:	c3                   	ret
+  802827:	83 ec 08             	sub    $0x8,%esp
+  80282a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80282d:	50                   	push   %eax
+  80282e:	ff 36                	push   (%esi)
+  802830:	e8 5d ff ff ff       	call   802792 <dev_lookup>
+  802835:	89 c3                	mov    %eax,%ebx
+  802837:	83 c4 10             	add    $0x10,%esp
+  80283a:	85 c0                	test   %eax,%eax
+  80283c:	78 1a                	js     802858 <fd_close+0x70>
+  80283e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802841:	8b 40 10             	mov    0x10(%eax),%eax
+  802844:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	74 0b                	je     802858 <fd_close+0x70>
+  80284d:	83 ec 0c             	sub    $0xc,%esp
+  802850:	56                   	push   %esi
+  802851:	ff d0                	call   *%eax
+  802853:	89 c3                	mov    %eax,%ebx
+  802855:	83 c4 10             	add    $0x10,%esp
+  802858:	83 ec 08             	sub    $0x8,%esp
+  80285b:	56                   	push   %esi
+  80285c:	6a 00                	push   $0x0
+  80285e:	e8 4c f0 ff ff       	call   8018af <sys_page_unmap>
+  802863:	83 c4 10             	add    $0x10,%esp
+  802866:	eb b5                	jmp    80281d <fd_close+0x35>
+
+00802868 <close>:
+  802868:	55                   	push   %ebp
+  802869:	89 e5                	mov    %esp,%ebp
+  80286b:	83 ec 20             	sub    $0x20,%esp
+  80286e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802871:	50                   	push   %eax
+  802872:	ff 75 08             	push   0x8(%ebp)
+  802875:	e8 c8 fe ff ff       	call   802742 <fd_lookup>
+  80287a:	83 c4 10             	add    $0x10,%esp
+  80287d:	85 c0                	test   %eax,%eax
+  80287f:	79 02                	jns    802883 <close+0x1b>
+  802881:	c9                   	leave
+  802882:	c3                   	ret
+  802883:	83 ec 08             	sub    $0x8,%esp
+  802886:	6a 01                	push   $0x1
+  802888:	ff 75 f4             	push   -0xc(%ebp)
+  80288b:	e8 58 ff ff ff       	call   8027e8 <fd_close>
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	eb ec                	jmp    802881 <close+0x19>
+
+00802895 <close_all>:
+  802895:	55                   	push   %ebp
+  802896:	89 e5                	mov    %esp,%ebp
+  802898:	53                   	push   %ebx
+  802899:	83 ec 04             	sub    $0x4,%esp
+  80289c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a1:	83 ec 0c             	sub    $0xc,%esp
+  8028a4:	53                   	push   %ebx
+  8028a5:	e8 be ff ff ff       	call   802868 <close>
+  8028aa:	83 c3 01             	add    $0x1,%ebx
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	83 fb 20             	cmp    $0x20,%ebx
+  8028b3:	75 ec                	jne    8028a1 <close_all+0xc>
+  8028b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+008028ba <dup>:
+  8028ba:	55                   	push   %ebp
+  8028bb:	89 e5                	mov    %esp,%ebp
+  8028bd:	57                   	push   %edi
+  8028be:	56                   	push   %esi
+  8028bf:	53                   	push   %ebx
+  8028c0:	83 ec 34             	sub    $0x34,%esp
+  8028c3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8028c6:	50                   	push   %eax
+  8028c7:	ff 75 08             	push   0x8(%ebp)
+  8028ca:	e8 73 fe ff ff       	call   802742 <fd_lookup>
+  8028cf:	89 c3                	mov    %eax,%ebx
+  8028d1:	83 c4 10             	add    $0x10,%esp
+  8028d4:	85 c0                	test   %eax,%eax
+  8028d6:	78 7f                	js     802957 <dup+0x9d>
+  8028d8:	83 ec 0c             	sub    $0xc,%esp
+  8028db:	ff 75 0c             	push   0xc(%ebp)
+  8028de:	e8 85 ff ff ff       	call   802868 <close>
+  8028e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028e6:	c1 e6 0c             	shl    $0xc,%esi
+  8028e9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8028ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8028f2:	89 3c 24             	mov    %edi,(%esp)
+  8028f5:	e8 e1 fd ff ff       	call   8026db <fd2data>
+  8028fa:	89 c3                	mov    %eax,%ebx
+  8028fc:	89 34 24             	mov    %esi,(%esp)
+  8028ff:	e8 d7 fd ff ff       	call   8026db <fd2data>
+  802904:	83 c4 10             	add    $0x10,%esp
+  802907:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80290a:	89 d8                	mov    %ebx,%eax
+  80290c:	c1 e8 16             	shr    $0x16,%eax
+  80290f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802916:	a8 01                	test   $0x1,%al
+  802918:	74 11                	je     80292b <dup+0x71>
+  80291a:	89 d8                	mov    %ebx,%eax
+  80291c:	c1 e8 0c             	shr    $0xc,%eax
+  80291f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802926:	f6 c2 01             	test   $0x1,%dl
+  802929:	75 36                	jne    802961 <dup+0xa7>
+  80292b:	89 f8                	mov    %edi,%eax
+  80292d:	c1 e8 0c             	shr    $0xc,%eax
+  802930:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802937:	83 ec 0c             	sub    $0xc,%esp
+  80293a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80293f:	50                   	push   %eax
+  802940:	56                   	push   %esi
+  802941:	6a 00                	push   $0x0
+  802943:	57                   	push   %edi
+  802944:	6a 00                	push   $0x0
+  802946:	e8 d5 ee ff ff       	call   801820 <sys_page_map>
+  80294b:	89 c3                	mov    %eax,%ebx
+  80294d:	83 c4 20             	add    $0x20,%esp
+  802950:	85 c0                	test   %eax,%eax
+  802952:	78 33                	js     802987 <dup+0xcd>
+  802954:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802957:	89 d8                	mov    %ebx,%eax
+  802959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80295c:	5b                   	pop    %ebx
+  80295d:	5e                   	pop    %esi
+  80295e:	5f                   	pop    %edi
+  80295f:	5d                   	pop    %ebp
+  802960:	c3                   	ret
+  802961:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802968:	83 ec 0c             	sub    $0xc,%esp
+  80296b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802970:	50                   	push   %eax
+  802971:	ff 75 d4             	push   -0x2c(%ebp)
+  802974:	6a 00                	push   $0x0
+  802976:	53                   	push   %ebx
+  802977:	6a 00                	push   $0x0
+  802979:	e8 a2 ee ff ff       	call   801820 <sys_page_map>
+  80297e:	89 c3                	mov    %eax,%ebx
+  802980:	83 c4 20             	add    $0x20,%esp
+  802983:	85 c0                	test   %eax,%eax
+  802985:	79 a4                	jns    80292b <dup+0x71>
+  802987:	83 ec 08             	sub    $0x8,%esp
+  80298a:	56                   	push   %esi
+  80298b:	6a 00                	push   $0x0
+  80298d:	e8 1d ef ff ff       	call   8018af <sys_page_unmap>
+  802992:	83 c4 08             	add    $0x8,%esp
+  802995:	ff 75 d4             	push   -0x2c(%ebp)
+  802998:	6a 00                	push   $0x0
+  80299a:	e8 10 ef ff ff       	call   8018af <sys_page_unmap>
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	eb b3                	jmp    802957 <dup+0x9d>
+
+008029a4 <read>:
+  8029a4:	55                   	push   %ebp
+  8029a5:	89 e5                	mov    %esp,%ebp
+  8029a7:	56                   	push   %esi
+  8029a8:	53                   	push   %ebx
+  8029a9:	83 ec 18             	sub    $0x18,%esp
+  8029ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8029b2:	50                   	push   %eax
+  8029b3:	56                   	push   %esi
+  8029b4:	e8 89 fd ff ff       	call   802742 <fd_lookup>
+  8029b9:	83 c4 10             	add    $0x10,%esp
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	78 3c                	js     8029fc <read+0x58>
+  8029c0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8029c3:	83 ec 08             	sub    $0x8,%esp
+  8029c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029c9:	50                   	push   %eax
+  8029ca:	ff 33                	push   (%ebx)
+  8029cc:	e8 c1 fd ff ff       	call   802792 <dev_lookup>
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	78 24                	js     8029fc <read+0x58>
+  8029d8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8029db:	83 e0 03             	and    $0x3,%eax
+  8029de:	83 f8 01             	cmp    $0x1,%eax
+  8029e1:	74 20                	je     802a03 <read+0x5f>
+  8029e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029e6:	8b 40 08             	mov    0x8(%eax),%eax
+  8029e9:	85 c0                	test   %eax,%eax
+  8029eb:	74 37                	je     802a24 <read+0x80>
+  8029ed:	83 ec 04             	sub    $0x4,%esp
+  8029f0:	ff 75 10             	push   0x10(%ebp)
+  8029f3:	ff 75 0c             	push   0xc(%ebp)
+  8029f6:	53                   	push   %ebx
+  8029f7:	ff d0                	call   *%eax
+  8029f9:	83 c4 10             	add    $0x10,%esp
+  8029fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ff:	5b                   	pop    %ebx
+  802a00:	5e                   	pop    %esi
+  802a01:	5d                   	pop    %ebp
+  802a02:	c3                   	ret
+  802a03:	a1 34 74 80 00       	mov    0x807434,%eax
+  802a08:	8b 40 48             	mov    0x48(%eax),%eax
+  802a0b:	83 ec 04             	sub    $0x4,%esp
+  802a0e:	56                   	push   %esi
+  802a0f:	50                   	push   %eax
+  802a10:	68 f1 52 80 00       	push   $0x8052f1
+  802a15:	e8 7c e1 ff ff       	call   800b96 <cprintf>
+  802a1a:	83 c4 10             	add    $0x10,%esp
+  802a1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a22:	eb d8                	jmp    8029fc <read+0x58>
+  802a24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a29:	eb d1                	jmp    8029fc <read+0x58>
+
+00802a2b <readn>:
+  802a2b:	55                   	push   %ebp
+  802a2c:	89 e5                	mov    %esp,%ebp
+  802a2e:	57                   	push   %edi
+  802a2f:	56                   	push   %esi
+  802a30:	53                   	push   %ebx
+  802a31:	83 ec 0c             	sub    $0xc,%esp
+  802a34:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802a37:	8b 75 10             	mov    0x10(%ebp),%esi
+  802a3a:	85 f6                	test   %esi,%esi
+  802a3c:	74 30                	je     802a6e <readn+0x43>
+  802a3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a48:	83 ec 04             	sub    $0x4,%esp
+  802a4b:	89 f2                	mov    %esi,%edx
+  802a4d:	29 c2                	sub    %eax,%edx
+  802a4f:	52                   	push   %edx
+  802a50:	01 f8                	add    %edi,%eax
+  802a52:	50                   	push   %eax
+  802a53:	ff 75 08             	push   0x8(%ebp)
+  802a56:	e8 49 ff ff ff       	call   8029a4 <read>
+  802a5b:	83 c4 10             	add    $0x10,%esp
+  802a5e:	85 c0                	test   %eax,%eax
+  802a60:	78 15                	js     802a77 <readn+0x4c>
+  802a62:	74 11                	je     802a75 <readn+0x4a>
+  802a64:	01 c3                	add    %eax,%ebx
+  802a66:	89 d8                	mov    %ebx,%eax
+  802a68:	39 f3                	cmp    %esi,%ebx
+  802a6a:	72 dc                	jb     802a48 <readn+0x1d>
+  802a6c:	eb 09                	jmp    802a77 <readn+0x4c>
+  802a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a73:	eb 02                	jmp    802a77 <readn+0x4c>
+  802a75:	89 d8                	mov    %ebx,%eax
+  802a77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a7a:	5b                   	pop    %ebx
+  802a7b:	5e                   	pop    %esi
+  802a7c:	5f                   	pop    %edi
+  802a7d:	5d                   	pop    %ebp
+  802a7e:	c3                   	ret
+
+00802a7f <write>:
+  802a7f:	55                   	push   %ebp
+  802a80:	89 e5                	mov    %esp,%ebp
+  802a82:	56                   	push   %esi
+  802a83:	53                   	push   %ebx
+  802a84:	83 ec 18             	sub    $0x18,%esp
+  802a87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a8a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a8d:	50                   	push   %eax
+  802a8e:	53                   	push   %ebx
+  802a8f:	e8 ae fc ff ff       	call   802742 <fd_lookup>
+  802a94:	83 c4 10             	add    $0x10,%esp
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	78 37                	js     802ad2 <write+0x53>
+  802a9b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802a9e:	83 ec 08             	sub    $0x8,%esp
+  802aa1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa4:	50                   	push   %eax
+  802aa5:	ff 36                	push   (%esi)
+  802aa7:	e8 e6 fc ff ff       	call   802792 <dev_lookup>
+  802aac:	83 c4 10             	add    $0x10,%esp
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	78 1f                	js     802ad2 <write+0x53>
+  802ab3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802ab7:	74 20                	je     802ad9 <write+0x5a>
+  802ab9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802abc:	8b 40 0c             	mov    0xc(%eax),%eax
+  802abf:	85 c0                	test   %eax,%eax
+  802ac1:	74 37                	je     802afa <write+0x7b>
+  802ac3:	83 ec 04             	sub    $0x4,%esp
+  802ac6:	ff 75 10             	push   0x10(%ebp)
+  802ac9:	ff 75 0c             	push   0xc(%ebp)
+  802acc:	56                   	push   %esi
+  802acd:	ff d0                	call   *%eax
+  802acf:	83 c4 10             	add    $0x10,%esp
+  802ad2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ad5:	5b                   	pop    %ebx
+  802ad6:	5e                   	pop    %esi
+  802ad7:	5d                   	pop    %ebp
+  802ad8:	c3                   	ret
+  802ad9:	a1 34 74 80 00       	mov    0x807434,%eax
+  802ade:	8b 40 48             	mov    0x48(%eax),%eax
+  802ae1:	83 ec 04             	sub    $0x4,%esp
+  802ae4:	53                   	push   %ebx
+  802ae5:	50                   	push   %eax
+  802ae6:	68 0d 53 80 00       	push   $0x80530d
+  802aeb:	e8 a6 e0 ff ff       	call   800b96 <cprintf>
+  802af0:	83 c4 10             	add    $0x10,%esp
+  802af3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af8:	eb d8                	jmp    802ad2 <write+0x53>
+  802afa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802aff:	eb d1                	jmp    802ad2 <write+0x53>
+
+00802b01 <seek>:
+  802b01:	55                   	push   %ebp
+  802b02:	89 e5                	mov    %esp,%ebp
+  802b04:	83 ec 20             	sub    $0x20,%esp
+  802b07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b0a:	50                   	push   %eax
+  802b0b:	ff 75 08             	push   0x8(%ebp)
+  802b0e:	e8 2f fc ff ff       	call   802742 <fd_lookup>
+  802b13:	83 c4 10             	add    $0x10,%esp
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	78 0e                	js     802b28 <seek+0x27>
+  802b1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b20:	89 50 04             	mov    %edx,0x4(%eax)
+  802b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+00802b2a <ftruncate>:
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	56                   	push   %esi
+  802b2e:	53                   	push   %ebx
+  802b2f:	83 ec 18             	sub    $0x18,%esp
+  802b32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b35:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802b38:	50                   	push   %eax
+  802b39:	53                   	push   %ebx
+  802b3a:	e8 03 fc ff ff       	call   802742 <fd_lookup>
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  802b42:	85 c0                	test   %eax,%eax
+  802b44:	78 34                	js     802b7a <ftruncate+0x50>
+  802b46:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802b49:	83 ec 08             	sub    $0x8,%esp
+  802b4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b4f:	50                   	push   %eax
+  802b50:	ff 36                	push   (%esi)
+  802b52:	e8 3b fc ff ff       	call   802792 <dev_lookup>
+  802b57:	83 c4 10             	add    $0x10,%esp
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	78 1c                	js     802b7a <ftruncate+0x50>
+  802b5e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802b62:	74 1d                	je     802b81 <ftruncate+0x57>
+  802b64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b67:	8b 40 18             	mov    0x18(%eax),%eax
+  802b6a:	85 c0                	test   %eax,%eax
+  802b6c:	74 34                	je     802ba2 <ftruncate+0x78>
+  802b6e:	83 ec 08             	sub    $0x8,%esp
+  802b71:	ff 75 0c             	push   0xc(%ebp)
+  802b74:	56                   	push   %esi
+  802b75:	ff d0                	call   *%eax
+  802b77:	83 c4 10             	add    $0x10,%esp
+  802b7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b7d:	5b                   	pop    %ebx
+  802b7e:	5e                   	pop    %esi
+  802b7f:	5d                   	pop    %ebp
+  802b80:	c3                   	ret
+  802b81:	a1 34 74 80 00       	mov    0x807434,%eax
+  802b86:	8b 40 48             	mov    0x48(%eax),%eax
+  802b89:	83 ec 04             	sub    $0x4,%esp
+  802b8c:	53                   	push   %ebx
+  802b8d:	50                   	push   %eax
+  802b8e:	68 d0 52 80 00       	push   $0x8052d0
+  802b93:	e8 fe df ff ff       	call   800b96 <cprintf>
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ba0:	eb d8                	jmp    802b7a <ftruncate+0x50>
+  802ba2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ba7:	eb d1                	jmp    802b7a <ftruncate+0x50>
+
+00802ba9 <fstat>:
+  802ba9:	55                   	push   %ebp
+  802baa:	89 e5                	mov    %esp,%ebp
+  802bac:	56                   	push   %esi
+  802bad:	53                   	push   %ebx
+  802bae:	83 ec 18             	sub    $0x18,%esp
+  802bb1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802bb4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802bb7:	50                   	push   %eax
+  802bb8:	ff 75 08             	push   0x8(%ebp)
+  802bbb:	e8 82 fb ff ff       	call   802742 <fd_lookup>
+  802bc0:	83 c4 10             	add    $0x10,%esp
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	78 49                	js     802c10 <fstat+0x67>
+  802bc7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802bca:	83 ec 08             	sub    $0x8,%esp
+  802bcd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bd0:	50                   	push   %eax
+  802bd1:	ff 36                	push   (%esi)
+  802bd3:	e8 ba fb ff ff       	call   802792 <dev_lookup>
+  802bd8:	83 c4 10             	add    $0x10,%esp
+  802bdb:	85 c0                	test   %eax,%eax
+  802bdd:	78 31                	js     802c10 <fstat+0x67>
+  802bdf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802be2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802be6:	74 2f                	je     802c17 <fstat+0x6e>
+  802be8:	c6 03 00             	movb   $0x0,(%ebx)
+  802beb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802bf2:	00 00 00 
+  802bf5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802bfc:	00 00 00 
+  802bff:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802c05:	83 ec 08             	sub    $0x8,%esp
+  802c08:	53                   	push   %ebx
+  802c09:	56                   	push   %esi
+  802c0a:	ff 50 14             	call   *0x14(%eax)
+  802c0d:	83 c4 10             	add    $0x10,%esp
+  802c10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c13:	5b                   	pop    %ebx
+  802c14:	5e                   	pop    %esi
+  802c15:	5d                   	pop    %ebp
+  802c16:	c3                   	ret
+  802c17:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c1c:	eb f2                	jmp    802c10 <fstat+0x67>
+
+00802c1e <stat>:
+  802c1e:	55                   	push   %ebp
+  802c1f:	89 e5                	mov    %esp,%ebp
+  802c21:	56                   	push   %esi
+  802c22:	53                   	push   %ebx
+  802c23:	83 ec 08             	sub    $0x8,%esp
+  802c26:	6a 00                	push   $0x0
+  802c28:	ff 75 08             	push   0x8(%ebp)
+  802c2b:	e8 31 05 00 00       	call   803161 <open>
+  802c30:	89 c3                	mov    %eax,%ebx
+  802c32:	83 c4 10             	add    $0x10,%esp
+  802c35:	85 c0                	test   %eax,%eax
+  802c37:	78 1b                	js     802c54 <stat+0x36>
+  802c39:	83 ec 08             	sub    $0x8,%esp
+  802c3c:	ff 75 0c             	push   0xc(%ebp)
+  802c3f:	50                   	push   %eax
+  802c40:	e8 64 ff ff ff       	call   802ba9 <fstat>
+  802c45:	89 c6                	mov    %eax,%esi
+  802c47:	89 1c 24             	mov    %ebx,(%esp)
+  802c4a:	e8 19 fc ff ff       	call   802868 <close>
+  802c4f:	83 c4 10             	add    $0x10,%esp
+  802c52:	89 f3                	mov    %esi,%ebx
+  802c54:	89 d8                	mov    %ebx,%eax
+  802c56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c59:	5b                   	pop    %ebx
+  802c5a:	5e                   	pop    %esi
+  802c5b:	5d                   	pop    %ebp
+  802c5c:	c3                   	ret
+
+00802c5d <fsipc>:
+  802c5d:	55                   	push   %ebp
+  802c5e:	89 e5                	mov    %esp,%ebp
+  802c60:	56                   	push   %esi
+  802c61:	53                   	push   %ebx
+  802c62:	89 c3                	mov    %eax,%ebx
+  802c64:	89 d6                	mov    %edx,%esi
+  802c66:	83 3d 2c 74 80 00 00 	cmpl   $0x0,0x80742c
+  802c6d:	74 20                	je     802c8f <fsipc+0x32>
+  802c6f:	83 ec 08             	sub    $0x8,%esp
+  802c72:	6a 00                	push   $0x0
+  802c74:	56                   	push   %esi
+  802c75:	6a 07                	push   $0x7
+  802c77:	68 00 80 80 00       	push   $0x808000
+  802c7c:	53                   	push   %ebx
+  802c7d:	ff 35 2c 74 80 00    	push   0x80742c
+  802c83:	e8 bf 1b 00 00       	call   804847 <ipc_call>
+  802c88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c8b:	5b                   	pop    %ebx
+  802c8c:	5e                   	pop    %esi
+  802c8d:	5d                   	pop    %ebp
+  802c8e:	c3                   	ret
+  802c8f:	83 ec 0c             	sub    $0xc,%esp
+  802c92:	6a 02                	push   $0x2
+  802c94:	e8 49 1d 00 00       	call   8049e2 <ipc_find_env>
+  802c99:	a3 2c 74 80 00       	mov    %eax,0x80742c
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  802ca1:	eb cc                	jmp    802c6f <fsipc+0x12>
+
+00802ca3 <devfile_trunc>:
+  802ca3:	55                   	push   %ebp
+  802ca4:	89 e5                	mov    %esp,%ebp
+  802ca6:	83 ec 08             	sub    $0x8,%esp
+  802ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cac:	8b 40 0c             	mov    0xc(%eax),%eax
+  802caf:	a3 00 80 80 00       	mov    %eax,0x808000
+  802cb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb7:	a3 04 80 80 00       	mov    %eax,0x808004
+  802cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc1:	b8 02 00 00 00       	mov    $0x2,%eax
+  802cc6:	e8 92 ff ff ff       	call   802c5d <fsipc>
+  802ccb:	c9                   	leave
+  802ccc:	c3                   	ret
+
+00802ccd <devfile_flush>:
+  802ccd:	55                   	push   %ebp
+  802cce:	89 e5                	mov    %esp,%ebp
+  802cd0:	83 ec 08             	sub    $0x8,%esp
+  802cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd6:	8b 40 0c             	mov    0xc(%eax),%eax
+  802cd9:	a3 00 80 80 00       	mov    %eax,0x808000
+  802cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ce8:	e8 70 ff ff ff       	call   802c5d <fsipc>
+  802ced:	c9                   	leave
+  802cee:	c3                   	ret
+
+00802cef <devfile_stat>:
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	53                   	push   %ebx
+  802cf3:	83 ec 04             	sub    $0x4,%esp
+  802cf6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfc:	8b 40 0c             	mov    0xc(%eax),%eax
+  802cff:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d09:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d0e:	e8 4a ff ff ff       	call   802c5d <fsipc>
+  802d13:	85 c0                	test   %eax,%eax
+  802d15:	78 2c                	js     802d43 <devfile_stat+0x54>
+  802d17:	83 ec 08             	sub    $0x8,%esp
+  802d1a:	68 00 80 80 00       	push   $0x808000
+  802d1f:	53                   	push   %ebx
+  802d20:	e8 58 e6 ff ff       	call   80137d <strcpy>
+  802d25:	a1 80 80 80 00       	mov    0x808080,%eax
+  802d2a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802d30:	a1 84 80 80 00       	mov    0x808084,%eax
+  802d35:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802d3b:	83 c4 10             	add    $0x10,%esp
+  802d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d46:	c9                   	leave
+  802d47:	c3                   	ret
+
+00802d48 <fsring_rw>:
+  802d48:	55                   	push   %ebp
+  802d49:	89 e5                	mov    %esp,%ebp
+  802d4b:	57                   	push   %edi
+  802d4c:	56                   	push   %esi
+  802d4d:	53                   	push   %ebx
+  802d4e:	83 ec 2c             	sub    $0x2c,%esp
+  802d51:	89 c7                	mov    %eax,%edi
+  802d53:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802d56:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d59:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802d5e:	a8 01                	test   $0x1,%al
+  802d60:	74 0d                	je     802d6f <fsring_rw+0x27>
+  802d62:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802d67:	a8 01                	test   $0x1,%al
+  802d69:	0f 85 d5 00 00 00    	jne    802e44 <fsring_rw+0xfc>
+  802d6f:	a1 34 74 80 00       	mov    0x807434,%eax
+  802d74:	8b 40 48             	mov    0x48(%eax),%eax
+  802d77:	3b 05 28 74 80 00    	cmp    0x807428,%eax
+  802d7d:	0f 84 fc 00 00 00    	je     802e7f <fsring_rw+0x137>
+  802d83:	83 3d 2c 74 80 00 00 	cmpl   $0x0,0x80742c
+  802d8a:	0f 84 02 01 00 00    	je     802e92 <fsring_rw+0x14a>
+  802d90:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802d95:	83 ec 04             	sub    $0x4,%esp
+  802d98:	68 07 02 00 00       	push   $0x207
+  802d9d:	53                   	push   %ebx
+  802d9e:	6a 00                	push   $0x0
+  802da0:	e8 38 ea ff ff       	call   8017dd <sys_page_alloc>
+  802da5:	83 c4 10             	add    $0x10,%esp
+  802da8:	85 c0                	test   %eax,%eax
+  802daa:	0f 88 f9 00 00 00    	js     802ea9 <fsring_rw+0x161>
+  802db0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802db6:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802dbc:	75 d7                	jne    802d95 <fsring_rw+0x4d>
+  802dbe:	6a 0e                	push   $0xe
+  802dc0:	6a 0d                	push   $0xd
+  802dc2:	ff 35 2c 74 80 00    	push   0x80742c
+  802dc8:	68 00 00 f0 cf       	push   $0xcff00000
+  802dcd:	e8 0f 17 00 00       	call   8044e1 <ipcring_init>
+  802dd2:	83 c4 08             	add    $0x8,%esp
+  802dd5:	6a 00                	push   $0x0
+  802dd7:	6a 00                	push   $0x0
+  802dd9:	68 07 02 00 00       	push   $0x207
+  802dde:	68 00 00 f0 cf       	push   $0xcff00000
+  802de3:	6a 0b                	push   $0xb
+  802de5:	ff 35 2c 74 80 00    	push   0x80742c
+  802deb:	e8 57 1a 00 00       	call   804847 <ipc_call>
+  802df0:	89 c6                	mov    %eax,%esi
+  802df2:	83 c4 20             	add    $0x20,%esp
+  802df5:	85 c0                	test   %eax,%eax
+  802df7:	0f 88 ac 00 00 00    	js     802ea9 <fsring_rw+0x161>
+  802dfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e02:	89 d9                	mov    %ebx,%ecx
+  802e04:	83 c3 01             	add    $0x1,%ebx
+  802e07:	89 da                	mov    %ebx,%edx
+  802e09:	c1 e2 0c             	shl    $0xc,%edx
+  802e0c:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802e12:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802e18:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802e1e:	83 ec 08             	sub    $0x8,%esp
+  802e21:	6a 00                	push   $0x0
+  802e23:	6a 00                	push   $0x0
+  802e25:	68 07 02 00 00       	push   $0x207
+  802e2a:	50                   	push   %eax
+  802e2b:	6a 0c                	push   $0xc
+  802e2d:	ff 35 2c 74 80 00    	push   0x80742c
+  802e33:	e8 0f 1a 00 00       	call   804847 <ipc_call>
+  802e38:	83 c4 20             	add    $0x20,%esp
+  802e3b:	85 c0                	test   %eax,%eax
+  802e3d:	78 6a                	js     802ea9 <fsring_rw+0x161>
+  802e3f:	83 fb 08             	cmp    $0x8,%ebx
+  802e42:	75 be                	jne    802e02 <fsring_rw+0xba>
+  802e44:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802e48:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802e4d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802e52:	0f 45 c2             	cmovne %edx,%eax
+  802e55:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802e58:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802e5f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802e66:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e72:	be 00 00 00 00       	mov    $0x0,%esi
+  802e77:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802e7a:	e9 4b 01 00 00       	jmp    802fca <fsring_rw+0x282>
+  802e7f:	e8 23 ed ff ff       	call   801ba7 <sys_time_msec>
+  802e84:	3b 05 24 74 80 00    	cmp    0x807424,%eax
+  802e8a:	0f 89 f3 fe ff ff    	jns    802d83 <fsring_rw+0x3b>
+  802e90:	eb 54                	jmp    802ee6 <fsring_rw+0x19e>
+  802e92:	83 ec 0c             	sub    $0xc,%esp
+  802e95:	6a 02                	push   $0x2
+  802e97:	e8 46 1b 00 00       	call   8049e2 <ipc_find_env>
+  802e9c:	a3 2c 74 80 00       	mov    %eax,0x80742c
+  802ea1:	83 c4 10             	add    $0x10,%esp
+  802ea4:	e9 e7 fe ff ff       	jmp    802d90 <fsring_rw+0x48>
+  802ea9:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802eae:	83 ec 08             	sub    $0x8,%esp
+  802eb1:	53                   	push   %ebx
+  802eb2:	6a 00                	push   $0x0
+  802eb4:	e8 f6 e9 ff ff       	call   8018af <sys_page_unmap>
+  802eb9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ebf:	83 c4 10             	add    $0x10,%esp
+  802ec2:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802ec8:	75 e4                	jne    802eae <fsring_rw+0x166>
+  802eca:	e8 d8 ec ff ff       	call   801ba7 <sys_time_msec>
+  802ecf:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802ed4:	a3 24 74 80 00       	mov    %eax,0x807424
+  802ed9:	a1 34 74 80 00       	mov    0x807434,%eax
+  802ede:	8b 40 48             	mov    0x48(%eax),%eax
+  802ee1:	a3 28 74 80 00       	mov    %eax,0x807428
+  802ee6:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802eed:	e9 7a 01 00 00       	jmp    80306c <fsring_rw+0x324>
+  802ef2:	8b 57 0c             	mov    0xc(%edi),%edx
+  802ef5:	89 10                	mov    %edx,(%eax)
+  802ef7:	89 58 04             	mov    %ebx,0x4(%eax)
+  802efa:	89 f2                	mov    %esi,%edx
+  802efc:	03 57 04             	add    0x4(%edi),%edx
+  802eff:	89 50 08             	mov    %edx,0x8(%eax)
+  802f02:	83 ec 04             	sub    $0x4,%esp
+  802f05:	53                   	push   %ebx
+  802f06:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802f09:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802f0c:	52                   	push   %edx
+  802f0d:	83 c0 0c             	add    $0xc,%eax
+  802f10:	50                   	push   %eax
+  802f11:	e8 17 e6 ff ff       	call   80152d <memmove>
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f1c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f1f:	89 08                	mov    %ecx,(%eax)
+  802f21:	83 ec 0c             	sub    $0xc,%esp
+  802f24:	68 00 00 f0 cf       	push   $0xcff00000
+  802f29:	e8 11 16 00 00       	call   80453f <ipcring_req_push>
+  802f2e:	01 de                	add    %ebx,%esi
+  802f30:	83 c4 10             	add    $0x10,%esp
+  802f33:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802f36:	73 4c                	jae    802f84 <fsring_rw+0x23c>
+  802f38:	83 ec 0c             	sub    $0xc,%esp
+  802f3b:	68 00 00 f0 cf       	push   $0xcff00000
+  802f40:	e8 d4 15 00 00       	call   804519 <ipcring_req_slot>
+  802f45:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f48:	83 c4 10             	add    $0x10,%esp
+  802f4b:	85 c0                	test   %eax,%eax
+  802f4d:	74 35                	je     802f84 <fsring_rw+0x23c>
+  802f4f:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802f54:	83 e0 07             	and    $0x7,%eax
+  802f57:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802f5c:	c1 e0 0c             	shl    $0xc,%eax
+  802f5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f62:	29 f3                	sub    %esi,%ebx
+  802f64:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f67:	39 cb                	cmp    %ecx,%ebx
+  802f69:	0f 47 d9             	cmova  %ecx,%ebx
+  802f6c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802f70:	75 80                	jne    802ef2 <fsring_rw+0x1aa>
+  802f72:	8b 57 0c             	mov    0xc(%edi),%edx
+  802f75:	89 10                	mov    %edx,(%eax)
+  802f77:	89 58 04             	mov    %ebx,0x4(%eax)
+  802f7a:	89 f2                	mov    %esi,%edx
+  802f7c:	03 57 04             	add    0x4(%edi),%edx
+  802f7f:	89 50 08             	mov    %edx,0x8(%eax)
+  802f82:	eb 95                	jmp    802f19 <fsring_rw+0x1d1>
+  802f84:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802f89:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f8c:	83 ec 0c             	sub    $0xc,%esp
+  802f8f:	68 00 00 f0 cf       	push   $0xcff00000
+  802f94:	e8 df 15 00 00       	call   804578 <ipcring_rsp_wait>
+  802f99:	8b 58 04             	mov    0x4(%eax),%ebx
+  802f9c:	83 c4 10             	add    $0x10,%esp
+  802f9f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802fa3:	75 45                	jne    802fea <fsring_rw+0x2a2>
+  802fa5:	85 db                	test   %ebx,%ebx
+  802fa7:	79 41                	jns    802fea <fsring_rw+0x2a2>
+  802fa9:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802fac:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802fb3:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802fba:	83 ec 0c             	sub    $0xc,%esp
+  802fbd:	68 00 00 f0 cf       	push   $0xcff00000
+  802fc2:	e8 17 16 00 00       	call   8045de <ipcring_rsp_pop>
+  802fc7:	83 c4 10             	add    $0x10,%esp
+  802fca:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802fd0:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802fd5:	39 c2                	cmp    %eax,%edx
+  802fd7:	74 75                	je     80304e <fsring_rw+0x306>
+  802fd9:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802fdd:	75 a5                	jne    802f84 <fsring_rw+0x23c>
+  802fdf:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802fe2:	0f 82 50 ff ff ff    	jb     802f38 <fsring_rw+0x1f0>
+  802fe8:	eb 9a                	jmp    802f84 <fsring_rw+0x23c>
+  802fea:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802fee:	75 ca                	jne    802fba <fsring_rw+0x272>
+  802ff0:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802ff4:	74 31                	je     803027 <fsring_rw+0x2df>
+  802ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff9:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802ffc:	29 c8                	sub    %ecx,%eax
+  802ffe:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803001:	39 d0                	cmp    %edx,%eax
+  803003:	0f 47 c2             	cmova  %edx,%eax
+  803006:	39 d8                	cmp    %ebx,%eax
+  803008:	ba 01 00 00 00       	mov    $0x1,%edx
+  80300d:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  803011:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  803014:	b8 01 00 00 00       	mov    $0x1,%eax
+  803019:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80301d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803020:	01 d9                	add    %ebx,%ecx
+  803022:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  803025:	eb 93                	jmp    802fba <fsring_rw+0x272>
+  803027:	83 ec 04             	sub    $0x4,%esp
+  80302a:	53                   	push   %ebx
+  80302b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80302e:	83 e0 07             	and    $0x7,%eax
+  803031:	c1 e0 0c             	shl    $0xc,%eax
+  803034:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80303a:	50                   	push   %eax
+  80303b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80303e:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  803041:	01 c8                	add    %ecx,%eax
+  803043:	50                   	push   %eax
+  803044:	e8 e4 e4 ff ff       	call   80152d <memmove>
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	eb a8                	jmp    802ff6 <fsring_rw+0x2ae>
+  80304e:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  803052:	75 09                	jne    80305d <fsring_rw+0x315>
+  803054:	3b 75 08             	cmp    0x8(%ebp),%esi
+  803057:	0f 82 db fe ff ff    	jb     802f38 <fsring_rw+0x1f0>
+  80305d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803060:	01 57 04             	add    %edx,0x4(%edi)
+  803063:	85 d2                	test   %edx,%edx
+  803065:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  803069:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80306c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80306f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803072:	5b                   	pop    %ebx
+  803073:	5e                   	pop    %esi
+  803074:	5f                   	pop    %edi
+  803075:	5d                   	pop    %ebp
+  803076:	c3                   	ret
+
+00803077 <devfile_write>:
+  803077:	55                   	push   %ebp
+  803078:	89 e5                	mov    %esp,%ebp
+  80307a:	57                   	push   %edi
+  80307b:	56                   	push   %esi
+  80307c:	53                   	push   %ebx
+  80307d:	83 ec 0c             	sub    $0xc,%esp
+  803080:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803083:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803086:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803089:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80308f:	76 1a                	jbe    8030ab <devfile_write+0x34>
+  803091:	83 ec 0c             	sub    $0xc,%esp
+  803094:	53                   	push   %ebx
+  803095:	89 f1                	mov    %esi,%ecx
+  803097:	ba 06 00 00 00       	mov    $0x6,%edx
+  80309c:	89 f8                	mov    %edi,%eax
+  80309e:	e8 a5 fc ff ff       	call   802d48 <fsring_rw>
+  8030a3:	83 c4 10             	add    $0x10,%esp
+  8030a6:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8030a9:	75 39                	jne    8030e4 <devfile_write+0x6d>
+  8030ab:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8030b0:	39 c3                	cmp    %eax,%ebx
+  8030b2:	0f 47 d8             	cmova  %eax,%ebx
+  8030b5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8030b8:	a3 00 80 80 00       	mov    %eax,0x808000
+  8030bd:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  8030c3:	83 ec 04             	sub    $0x4,%esp
+  8030c6:	53                   	push   %ebx
+  8030c7:	56                   	push   %esi
+  8030c8:	68 08 80 80 00       	push   $0x808008
+  8030cd:	e8 5b e4 ff ff       	call   80152d <memmove>
+  8030d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8030dc:	e8 7c fb ff ff       	call   802c5d <fsipc>
+  8030e1:	83 c4 10             	add    $0x10,%esp
+  8030e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030e7:	5b                   	pop    %ebx
+  8030e8:	5e                   	pop    %esi
+  8030e9:	5f                   	pop    %edi
+  8030ea:	5d                   	pop    %ebp
+  8030eb:	c3                   	ret
+
+008030ec <devfile_read>:
+  8030ec:	55                   	push   %ebp
+  8030ed:	89 e5                	mov    %esp,%ebp
+  8030ef:	57                   	push   %edi
+  8030f0:	56                   	push   %esi
+  8030f1:	53                   	push   %ebx
+  8030f2:	83 ec 0c             	sub    $0xc,%esp
+  8030f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8030f8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8030fb:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  803101:	76 1d                	jbe    803120 <devfile_read+0x34>
+  803103:	83 ec 0c             	sub    $0xc,%esp
+  803106:	56                   	push   %esi
+  803107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80310a:	ba 05 00 00 00       	mov    $0x5,%edx
+  80310f:	89 f8                	mov    %edi,%eax
+  803111:	e8 32 fc ff ff       	call   802d48 <fsring_rw>
+  803116:	89 c3                	mov    %eax,%ebx
+  803118:	83 c4 10             	add    $0x10,%esp
+  80311b:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80311e:	75 37                	jne    803157 <devfile_read+0x6b>
+  803120:	8b 47 0c             	mov    0xc(%edi),%eax
+  803123:	a3 00 80 80 00       	mov    %eax,0x808000
+  803128:	89 35 04 80 80 00    	mov    %esi,0x808004
+  80312e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803133:	b8 03 00 00 00       	mov    $0x3,%eax
+  803138:	e8 20 fb ff ff       	call   802c5d <fsipc>
+  80313d:	89 c3                	mov    %eax,%ebx
+  80313f:	85 c0                	test   %eax,%eax
+  803141:	78 14                	js     803157 <devfile_read+0x6b>
+  803143:	83 ec 04             	sub    $0x4,%esp
+  803146:	50                   	push   %eax
+  803147:	68 00 80 80 00       	push   $0x808000
+  80314c:	ff 75 0c             	push   0xc(%ebp)
+  80314f:	e8 d9 e3 ff ff       	call   80152d <memmove>
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	89 d8                	mov    %ebx,%eax
+  803159:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80315c:	5b                   	pop    %ebx
+  80315d:	5e                   	pop    %esi
+  80315e:	5f                   	pop    %edi
+  80315f:	5d                   	pop    %ebp
+  803160:	c3                   	ret
+
+00803161 <open>:
+  803161:	55                   	push   %ebp
+  803162:	89 e5                	mov    %esp,%ebp
+  803164:	56                   	push   %esi
+  803165:	53                   	push   %ebx
+  803166:	83 ec 1c             	sub    $0x1c,%esp
+  803169:	8b 75 08             	mov    0x8(%ebp),%esi
+  80316c:	56                   	push   %esi
+  80316d:	e8 bf e1 ff ff       	call   801331 <strlen>
+  803172:	83 c4 10             	add    $0x10,%esp
+  803175:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80317a:	7f 6c                	jg     8031e8 <open+0x87>
+  80317c:	83 ec 0c             	sub    $0xc,%esp
+  80317f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803182:	50                   	push   %eax
+  803183:	e8 6a f5 ff ff       	call   8026f2 <fd_alloc>
+  803188:	89 c3                	mov    %eax,%ebx
+  80318a:	83 c4 10             	add    $0x10,%esp
+  80318d:	85 c0                	test   %eax,%eax
+  80318f:	78 3c                	js     8031cd <open+0x6c>
+  803191:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803194:	a3 00 84 80 00       	mov    %eax,0x808400
+  803199:	83 ec 08             	sub    $0x8,%esp
+  80319c:	56                   	push   %esi
+  80319d:	68 00 80 80 00       	push   $0x808000
+  8031a2:	e8 d6 e1 ff ff       	call   80137d <strcpy>
+  8031a7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031af:	e8 a9 fa ff ff       	call   802c5d <fsipc>
+  8031b4:	89 c3                	mov    %eax,%ebx
+  8031b6:	83 c4 10             	add    $0x10,%esp
+  8031b9:	85 c0                	test   %eax,%eax
+  8031bb:	78 19                	js     8031d6 <open+0x75>
+  8031bd:	83 ec 0c             	sub    $0xc,%esp
+  8031c0:	ff 75 f4             	push   -0xc(%ebp)
+  8031c3:	e8 03 f5 ff ff       	call   8026cb <fd2num>
+  8031c8:	89 c3                	mov    %eax,%ebx
+  8031ca:	83 c4 10             	add    $0x10,%esp
+  8031cd:	89 d8                	mov    %ebx,%eax
+  8031cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031d2:	5b                   	pop    %ebx
+  8031d3:	5e                   	pop    %esi
+  8031d4:	5d                   	pop    %ebp
+  8031d5:	c3                   	ret
+  8031d6:	83 ec 08             	sub    $0x8,%esp
+  8031d9:	6a 00                	push   $0x0
+  8031db:	ff 75 f4             	push   -0xc(%ebp)
+  8031de:	e8 05 f6 ff ff       	call   8027e8 <fd_close>
+  8031e3:	83 c4 10             	add    $0x10,%esp
+  8031e6:	eb e5                	jmp    8031cd <open+0x6c>
+  8031e8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8031ed:	eb de                	jmp    8031cd <open+0x6c>
+
+008031ef <file_image>:
+  8031ef:	55                   	push   %ebp
+  8031f0:	89 e5                	mov    %esp,%ebp
+  8031f2:	53                   	push   %ebx
+  8031f3:	83 ec 1c             	sub    $0x1c,%esp
+  8031f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031fc:	50                   	push   %eax
+  8031fd:	ff 75 08             	push   0x8(%ebp)
+  803200:	e8 3d f5 ff ff       	call   802742 <fd_lookup>
+  803205:	83 c4 10             	add    $0x10,%esp
+  803208:	85 c0                	test   %eax,%eax
+  80320a:	78 58                	js     803264 <file_image+0x75>
+  80320c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80320f:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  803215:	39 08                	cmp    %ecx,(%eax)
+  803217:	75 50                	jne    803269 <file_image+0x7a>
+  803219:	83 fb 04             	cmp    $0x4,%ebx
+  80321c:	77 52                	ja     803270 <file_image+0x81>
+  80321e:	8b 40 0c             	mov    0xc(%eax),%eax
+  803221:	a3 00 80 80 00       	mov    %eax,0x808000
+  803226:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  80322c:	83 ec 04             	sub    $0x4,%esp
+  80322f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803232:	c1 e0 02             	shl    $0x2,%eax
+  803235:	50                   	push   %eax
+  803236:	ff 75 0c             	push   0xc(%ebp)
+  803239:	68 08 80 80 00       	push   $0x808008
+  80323e:	e8 ea e2 ff ff       	call   80152d <memmove>
+  803243:	ba 00 00 00 00       	mov    $0x0,%edx
+  803248:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80324d:	e8 0b fa ff ff       	call   802c5d <fsipc>
+  803252:	83 c4 10             	add    $0x10,%esp
+  803255:	85 c0                	test   %eax,%eax
+  803257:	78 0b                	js     803264 <file_image+0x75>
+  803259:	8b 55 14             	mov    0x14(%ebp),%edx
+  80325c:	8b 0d 2c 74 80 00    	mov    0x80742c,%ecx
+  803262:	89 0a                	mov    %ecx,(%edx)
+  803264:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803267:	c9                   	leave
+  803268:	c3                   	ret
+  803269:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80326e:	eb f4                	jmp    803264 <file_image+0x75>
+  803270:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803275:	eb ed                	jmp    803264 <file_image+0x75>
+
+00803277 <remove>:
+  803277:	55                   	push   %ebp
+  803278:	89 e5                	mov    %esp,%ebp
+  80327a:	53                   	push   %ebx
+  80327b:	83 ec 10             	sub    $0x10,%esp
+  80327e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803281:	53                   	push   %ebx
+  803282:	e8 aa e0 ff ff       	call   801331 <strlen>
+  803287:	83 c4 10             	add    $0x10,%esp
+  80328a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80328f:	7f 25                	jg     8032b6 <remove+0x3f>
+  803291:	83 ec 08             	sub    $0x8,%esp
+  803294:	53                   	push   %ebx
+  803295:	68 00 80 80 00       	push   $0x808000
+  80329a:	e8 de e0 ff ff       	call   80137d <strcpy>
+  80329f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8032a9:	e8 af f9 ff ff       	call   802c5d <fsipc>
+  8032ae:	83 c4 10             	add    $0x10,%esp
+  8032b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032b4:	c9                   	leave
+  8032b5:	c3                   	ret
+  8032b6:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8032bb:	eb f4                	jmp    8032b1 <remove+0x3a>
+
+008032bd <sync>:
+  8032bd:	55                   	push   %ebp
+  8032be:	89 e5                	mov    %esp,%ebp
+  8032c0:	83 ec 08             	sub    $0x8,%esp
+  8032c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8032cd:	e8 8b f9 ff ff       	call   802c5d <fsipc>
+  8032d2:	c9                   	leave
+  8032d3:	c3                   	ret
+
+008032d4 <writebuf>:
+  8032d4:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8032d8:	7f 01                	jg     8032db <writebuf+0x7>
+  8032da:	c3                   	ret
+  8032db:	55                   	push   %ebp
+  8032dc:	89 e5                	mov    %esp,%ebp
+  8032de:	53                   	push   %ebx
+  8032df:	83 ec 08             	sub    $0x8,%esp
+  8032e2:	89 c3                	mov    %eax,%ebx
+  8032e4:	ff 70 04             	push   0x4(%eax)
+  8032e7:	8d 40 10             	lea    0x10(%eax),%eax
+  8032ea:	50                   	push   %eax
+  8032eb:	ff 33                	push   (%ebx)
+  8032ed:	e8 8d f7 ff ff       	call   802a7f <write>
+  8032f2:	83 c4 10             	add    $0x10,%esp
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	7e 03                	jle    8032fc <writebuf+0x28>
+  8032f9:	01 43 08             	add    %eax,0x8(%ebx)
+  8032fc:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8032ff:	74 0d                	je     80330e <writebuf+0x3a>
+  803301:	85 c0                	test   %eax,%eax
+  803303:	ba 00 00 00 00       	mov    $0x0,%edx
+  803308:	0f 4f c2             	cmovg  %edx,%eax
+  80330b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80330e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803311:	c9                   	leave
+  803312:	c3                   	ret
+
+00803313 <putch>:
+  803313:	55                   	push   %ebp
+  803314:	89 e5                	mov    %esp,%ebp
+  803316:	53                   	push   %ebx
+  803317:	83 ec 04             	sub    $0x4,%esp
+  80331a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80331d:	8b 53 04             	mov    0x4(%ebx),%edx
+  803320:	8d 42 01             	lea    0x1(%edx),%eax
+  803323:	89 43 04             	mov    %eax,0x4(%ebx)
+  803326:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803329:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  80332d:	3d 00 01 00 00       	cmp    $0x100,%eax
+  803332:	74 05                	je     803339 <putch+0x26>
+  803334:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+  803339:	89 d8                	mov    %ebx,%eax
+  80333b:	e8 94 ff ff ff       	call   8032d4 <writebuf>
+  803340:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  803347:	eb eb                	jmp    803334 <putch+0x21>
+
+00803349 <vfprintf>:
+  803349:	55                   	push   %ebp
+  80334a:	89 e5                	mov    %esp,%ebp
+  80334c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  803352:	8b 45 08             	mov    0x8(%ebp),%eax
+  803355:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  80335b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  803362:	00 00 00 
+  803365:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80336c:	00 00 00 
+  80336f:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  803376:	00 00 00 
+  803379:	ff 75 10             	push   0x10(%ebp)
+  80337c:	ff 75 0c             	push   0xc(%ebp)
+  80337f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  803385:	50                   	push   %eax
+  803386:	68 13 33 80 00       	push   $0x803313
+  80338b:	e8 05 d9 ff ff       	call   800c95 <vprintfmt>
+  803390:	83 c4 10             	add    $0x10,%esp
+  803393:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80339a:	7f 12                	jg     8033ae <vfprintf+0x65>
+  80339c:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8033a2:	85 c0                	test   %eax,%eax
+  8033a4:	75 06                	jne    8033ac <vfprintf+0x63>
+  8033a6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8033ac:	c9                   	leave
+  8033ad:	c3                   	ret
+  8033ae:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8033b4:	e8 1b ff ff ff       	call   8032d4 <writebuf>
+  8033b9:	eb e1                	jmp    80339c <vfprintf+0x53>
+
+008033bb <fprintf>:
+  8033bb:	55                   	push   %ebp
+  8033bc:	89 e5                	mov    %esp,%ebp
+  8033be:	83 ec 0c             	sub    $0xc,%esp
+  8033c1:	8d 45 10             	lea    0x10(%ebp),%eax
+  8033c4:	50                   	push   %eax
+  8033c5:	ff 75 0c             	push   0xc(%ebp)
+  8033c8:	ff 75 08             	push   0x8(%ebp)
+  8033cb:	e8 79 ff ff ff       	call   803349 <vfprintf>
+  8033d0:	c9                   	leave
+  8033d1:	c3                   	ret
+
+008033d2 <printf>:
+  8033d2:	55                   	push   %ebp
+  8033d3:	89 e5                	mov    %esp,%ebp
+  8033d5:	83 ec 0c             	sub    $0xc,%esp
+  8033d8:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8033db:	50                   	push   %eax
+  8033dc:	ff 75 08             	push   0x8(%ebp)
+  8033df:	6a 01                	push   $0x1
+  8033e1:	e8 63 ff ff ff       	call   803349 <vfprintf>
+  8033e6:	c9                   	leave
+  8033e7:	c3                   	ret
+
+008033e8 <map_segment>:
+  8033e8:	55                   	push   %ebp
+  8033e9:	89 e5                	mov    %esp,%ebp
+  8033eb:	57                   	push   %edi
+  8033ec:	56                   	push   %esi
+  8033ed:	53                   	push   %ebx
+  8033ee:	83 ec 1c             	sub    $0x1c,%esp
+  8033f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8033f4:	89 d7                	mov    %edx,%edi
+  8033f6:	89 d0                	mov    %edx,%eax
+  8033f8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8033fd:	74 0a                	je     803409 <map_segment+0x21>
+  8033ff:	29 c7                	sub    %eax,%edi
+  803401:	01 c1                	add    %eax,%ecx
+  803403:	01 45 0c             	add    %eax,0xc(%ebp)
+  803406:	29 45 10             	sub    %eax,0x10(%ebp)
+  803409:	85 c9                	test   %ecx,%ecx
+  80340b:	0f 84 fb 00 00 00    	je     80350c <map_segment+0x124>
+  803411:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803416:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803419:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80341c:	e9 a6 00 00 00       	jmp    8034c7 <map_segment+0xdf>
+  803421:	83 ec 04             	sub    $0x4,%esp
+  803424:	6a 07                	push   $0x7
+  803426:	68 00 00 40 00       	push   $0x400000
+  80342b:	6a 00                	push   $0x0
+  80342d:	e8 ab e3 ff ff       	call   8017dd <sys_page_alloc>
+  803432:	83 c4 10             	add    $0x10,%esp
+  803435:	85 c0                	test   %eax,%eax
+  803437:	0f 88 c7 00 00 00    	js     803504 <map_segment+0x11c>
+  80343d:	83 ec 08             	sub    $0x8,%esp
+  803440:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803443:	03 45 10             	add    0x10(%ebp),%eax
+  803446:	50                   	push   %eax
+  803447:	ff 75 08             	push   0x8(%ebp)
+  80344a:	e8 b2 f6 ff ff       	call   802b01 <seek>
+  80344f:	83 c4 10             	add    $0x10,%esp
+  803452:	85 c0                	test   %eax,%eax
+  803454:	0f 88 aa 00 00 00    	js     803504 <map_segment+0x11c>
+  80345a:	83 ec 04             	sub    $0x4,%esp
+  80345d:	89 f2                	mov    %esi,%edx
+  80345f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803462:	29 ca                	sub    %ecx,%edx
+  803464:	89 d0                	mov    %edx,%eax
+  803466:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80346b:	39 d0                	cmp    %edx,%eax
+  80346d:	0f 47 c2             	cmova  %edx,%eax
+  803470:	50                   	push   %eax
+  803471:	68 00 00 40 00       	push   $0x400000
+  803476:	ff 75 08             	push   0x8(%ebp)
+  803479:	e8 ad f5 ff ff       	call   802a2b <readn>
+  80347e:	83 c4 10             	add    $0x10,%esp
+  803481:	85 c0                	test   %eax,%eax
+  803483:	78 7f                	js     803504 <map_segment+0x11c>
+  803485:	83 ec 0c             	sub    $0xc,%esp
+  803488:	ff 75 14             	push   0x14(%ebp)
+  80348b:	57                   	push   %edi
+  80348c:	ff 75 e0             	push   -0x20(%ebp)
+  80348f:	68 00 00 40 00       	push   $0x400000
+  803494:	6a 00                	push   $0x0
+  803496:	e8 85 e3 ff ff       	call   801820 <sys_page_map>
+  80349b:	83 c4 20             	add    $0x20,%esp
+  80349e:	85 c0                	test   %eax,%eax
+  8034a0:	78 48                	js     8034ea <map_segment+0x102>
+  8034a2:	83 ec 08             	sub    $0x8,%esp
+  8034a5:	68 00 00 40 00       	push   $0x400000
+  8034aa:	6a 00                	push   $0x0
+  8034ac:	e8 fe e3 ff ff       	call   8018af <sys_page_unmap>
+  8034b1:	83 c4 10             	add    $0x10,%esp
+  8034b4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034ba:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8034c0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8034c3:	39 c3                	cmp    %eax,%ebx
+  8034c5:	73 38                	jae    8034ff <map_segment+0x117>
+  8034c7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8034ca:	39 f3                	cmp    %esi,%ebx
+  8034cc:	0f 82 4f ff ff ff    	jb     803421 <map_segment+0x39>
+  8034d2:	83 ec 04             	sub    $0x4,%esp
+  8034d5:	ff 75 14             	push   0x14(%ebp)
+  8034d8:	57                   	push   %edi
+  8034d9:	ff 75 e0             	push   -0x20(%ebp)
+  8034dc:	e8 fc e2 ff ff       	call   8017dd <sys_page_alloc>
+  8034e1:	83 c4 10             	add    $0x10,%esp
+  8034e4:	85 c0                	test   %eax,%eax
+  8034e6:	79 cc                	jns    8034b4 <map_segment+0xcc>
+  8034e8:	eb 1a                	jmp    803504 <map_segment+0x11c>
+  8034ea:	50                   	push   %eax
+  8034eb:	68 40 53 80 00       	push   $0x805340
+  8034f0:	68 75 01 00 00       	push   $0x175
+  8034f5:	68 5d 53 80 00       	push   $0x80535d
+  8034fa:	e8 bc d5 ff ff       	call   800abb <_panic>
+  8034ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803507:	5b                   	pop    %ebx
+  803508:	5e                   	pop    %esi
+  803509:	5f                   	pop    %edi
+  80350a:	5d                   	pop    %ebp
+  80350b:	c3                   	ret
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803511:	eb f1                	jmp    803504 <map_segment+0x11c>
+
+00803513 <execv>:
+  803513:	55                   	push   %ebp
+  803514:	89 e5                	mov    %esp,%ebp
+  803516:	57                   	push   %edi
+  803517:	56                   	push   %esi
+  803518:	53                   	push   %ebx
+  803519:	81 ec d4 02 00 00    	sub    $0x2d4,%esp
+  80351f:	6a 00                	push   $0x0
+  803521:	ff 75 08             	push   0x8(%ebp)
+  803524:	e8 38 fc ff ff       	call   803161 <open>
+  803529:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80352f:	83 c4 10             	add    $0x10,%esp
+  803532:	85 c0                	test   %eax,%eax
+  803534:	0f 88 ea 05 00 00    	js     803b24 <execv+0x611>
+  80353a:	89 c6                	mov    %eax,%esi
+  80353c:	83 ec 04             	sub    $0x4,%esp
+  80353f:	68 00 02 00 00       	push   $0x200
+  803544:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80354a:	50                   	push   %eax
+  80354b:	56                   	push   %esi
+  80354c:	e8 da f4 ff ff       	call   802a2b <readn>
+  803551:	83 c4 10             	add    $0x10,%esp
+  803554:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803559:	0f 85 e1 01 00 00    	jne    803740 <execv+0x22d>
+  80355f:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  803566:	45 4c 46 
+  803569:	0f 85 d1 01 00 00    	jne    803740 <execv+0x22d>
+  80356f:	b8 07 00 00 00       	mov    $0x7,%eax
+  803574:	cd 30                	int    $0x30
+  803576:	89 85 40 fd ff ff    	mov    %eax,-0x2c0(%ebp)
+  80357c:	85 c0                	test   %eax,%eax
+  80357e:	0f 88 94 05 00 00    	js     803b18 <execv+0x605>
+  803584:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803589:	69 f0 ac 01 00 00    	imul   $0x1ac,%eax,%esi
+  80358f:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803595:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80359b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8035a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8035a2:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8035a8:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8035ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035b1:	8b 00                	mov    (%eax),%eax
+  8035b3:	85 c0                	test   %eax,%eax
+  8035b5:	0f 84 ad 05 00 00    	je     803b68 <execv+0x655>
+  8035bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8035c8:	83 ec 0c             	sub    $0xc,%esp
+  8035cb:	50                   	push   %eax
+  8035cc:	e8 60 dd ff ff       	call   801331 <strlen>
+  8035d1:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  8035d5:	89 d9                	mov    %ebx,%ecx
+  8035d7:	83 c3 01             	add    $0x1,%ebx
+  8035da:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%ebp)
+  8035e0:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  8035e7:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8035ea:	83 c4 10             	add    $0x10,%esp
+  8035ed:	85 c0                	test   %eax,%eax
+  8035ef:	75 d7                	jne    8035c8 <execv+0xb5>
+  8035f1:	89 95 2c fd ff ff    	mov    %edx,-0x2d4(%ebp)
+  8035f7:	89 8d 30 fd ff ff    	mov    %ecx,-0x2d0(%ebp)
+  8035fd:	be 00 10 40 00       	mov    $0x401000,%esi
+  803602:	29 fe                	sub    %edi,%esi
+  803604:	89 f2                	mov    %esi,%edx
+  803606:	83 e2 fc             	and    $0xfffffffc,%edx
+  803609:	8d 04 8d 08 00 00 00 	lea    0x8(,%ecx,4),%eax
+  803610:	89 d7                	mov    %edx,%edi
+  803612:	29 c7                	sub    %eax,%edi
+  803614:	8d 47 f8             	lea    -0x8(%edi),%eax
+  803617:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80361c:	0f 86 1f 05 00 00    	jbe    803b41 <execv+0x62e>
+  803622:	83 ec 04             	sub    $0x4,%esp
+  803625:	6a 07                	push   $0x7
+  803627:	68 00 00 40 00       	push   $0x400000
+  80362c:	6a 00                	push   $0x0
+  80362e:	e8 aa e1 ff ff       	call   8017dd <sys_page_alloc>
+  803633:	83 c4 10             	add    $0x10,%esp
+  803636:	85 c0                	test   %eax,%eax
+  803638:	0f 88 08 05 00 00    	js     803b46 <execv+0x633>
+  80363e:	85 db                	test   %ebx,%ebx
+  803640:	7e 58                	jle    80369a <execv+0x187>
+  803642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803647:	89 bd 34 fd ff ff    	mov    %edi,-0x2cc(%ebp)
+  80364d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803650:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+  803656:	8d 86 00 d0 3f ee    	lea    -0x11c03000(%esi),%eax
+  80365c:	8b 8d 34 fd ff ff    	mov    -0x2cc(%ebp),%ecx
+  803662:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+  803665:	83 ec 08             	sub    $0x8,%esp
+  803668:	ff 34 9f             	push   (%edi,%ebx,4)
+  80366b:	56                   	push   %esi
+  80366c:	e8 0c dd ff ff       	call   80137d <strcpy>
+  803671:	83 c4 04             	add    $0x4,%esp
+  803674:	ff 34 9f             	push   (%edi,%ebx,4)
+  803677:	e8 b5 dc ff ff       	call   801331 <strlen>
+  80367c:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  803680:	83 c3 01             	add    $0x1,%ebx
+  803683:	83 c4 10             	add    $0x10,%esp
+  803686:	8b 8d 3c fd ff ff    	mov    -0x2c4(%ebp),%ecx
+  80368c:	39 8d 30 fd ff ff    	cmp    %ecx,-0x2d0(%ebp)
+  803692:	75 bc                	jne    803650 <execv+0x13d>
+  803694:	8b bd 34 fd ff ff    	mov    -0x2cc(%ebp),%edi
+  80369a:	8b 85 2c fd ff ff    	mov    -0x2d4(%ebp),%eax
+  8036a0:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+  8036a7:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  8036ad:	0f 85 c5 00 00 00    	jne    803778 <execv+0x265>
+  8036b3:	8d 87 00 d0 3f ee    	lea    -0x11c03000(%edi),%eax
+  8036b9:	89 47 fc             	mov    %eax,-0x4(%edi)
+  8036bc:	8b 85 38 fd ff ff    	mov    -0x2c8(%ebp),%eax
+  8036c2:	89 47 f8             	mov    %eax,-0x8(%edi)
+  8036c5:	8d 87 f8 cf 3f ee    	lea    -0x11c03008(%edi),%eax
+  8036cb:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  8036d1:	83 ec 0c             	sub    $0xc,%esp
+  8036d4:	6a 07                	push   $0x7
+  8036d6:	68 00 d0 7f ee       	push   $0xee7fd000
+  8036db:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8036e1:	68 00 00 40 00       	push   $0x400000
+  8036e6:	6a 00                	push   $0x0
+  8036e8:	e8 33 e1 ff ff       	call   801820 <sys_page_map>
+  8036ed:	89 c3                	mov    %eax,%ebx
+  8036ef:	83 c4 20             	add    $0x20,%esp
+  8036f2:	85 c0                	test   %eax,%eax
+  8036f4:	0f 88 54 04 00 00    	js     803b4e <execv+0x63b>
+  8036fa:	83 ec 08             	sub    $0x8,%esp
+  8036fd:	68 00 00 40 00       	push   $0x400000
+  803702:	6a 00                	push   $0x0
+  803704:	e8 a6 e1 ff ff       	call   8018af <sys_page_unmap>
+  803709:	89 c3                	mov    %eax,%ebx
+  80370b:	83 c4 10             	add    $0x10,%esp
+  80370e:	85 c0                	test   %eax,%eax
+  803710:	0f 88 38 04 00 00    	js     803b4e <execv+0x63b>
+  803716:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80371c:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+  803723:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  80372a:	00 
+  80372b:	0f 84 01 04 00 00    	je     803b32 <execv+0x61f>
+  803731:	be 00 00 00 00       	mov    $0x0,%esi
+  803736:	bf 00 00 00 00       	mov    $0x0,%edi
+  80373b:	e9 88 00 00 00       	jmp    8037c8 <execv+0x2b5>
+  803740:	83 ec 0c             	sub    $0xc,%esp
+  803743:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  803749:	e8 1a f1 ff ff       	call   802868 <close>
+  80374e:	83 c4 0c             	add    $0xc,%esp
+  803751:	68 7f 45 4c 46       	push   $0x464c457f
+  803756:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  80375c:	68 69 53 80 00       	push   $0x805369
+  803761:	e8 30 d4 ff ff       	call   800b96 <cprintf>
+  803766:	83 c4 10             	add    $0x10,%esp
+  803769:	c7 85 44 fd ff ff f2 	movl   $0xfffffff2,-0x2bc(%ebp)
+  803770:	ff ff ff 
+  803773:	e9 ac 03 00 00       	jmp    803b24 <execv+0x611>
+  803778:	68 dc 53 80 00       	push   $0x8053dc
+  80377d:	68 8f 4d 80 00       	push   $0x804d8f
+  803782:	68 41 01 00 00       	push   $0x141
+  803787:	68 5d 53 80 00       	push   $0x80535d
+  80378c:	e8 2a d3 ff ff       	call   800abb <_panic>
+  803791:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  803794:	50                   	push   %eax
+  803795:	ff 73 04             	push   0x4(%ebx)
+  803798:	ff 73 10             	push   0x10(%ebx)
+  80379b:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8037a1:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  8037a7:	e8 3c fc ff ff       	call   8033e8 <map_segment>
+  8037ac:	83 c4 10             	add    $0x10,%esp
+  8037af:	85 c0                	test   %eax,%eax
+  8037b1:	0f 88 34 03 00 00    	js     803aeb <execv+0x5d8>
+  8037b7:	83 c7 01             	add    $0x1,%edi
+  8037ba:	83 c3 20             	add    $0x20,%ebx
+  8037bd:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8037c4:	39 f8                	cmp    %edi,%eax
+  8037c6:	7e 5d                	jle    803825 <execv+0x312>
+  8037c8:	83 3b 01             	cmpl   $0x1,(%ebx)
+  8037cb:	75 ea                	jne    8037b7 <execv+0x2a4>
+  8037cd:	8b 43 18             	mov    0x18(%ebx),%eax
+  8037d0:	83 e0 02             	and    $0x2,%eax
+  8037d3:	83 f8 01             	cmp    $0x1,%eax
+  8037d6:	19 c0                	sbb    %eax,%eax
+  8037d8:	83 e0 fe             	and    $0xfffffffe,%eax
+  8037db:	83 c0 07             	add    $0x7,%eax
+  8037de:	8b 53 08             	mov    0x8(%ebx),%edx
+  8037e1:	81 fa ff ff 7f 00    	cmp    $0x7fffff,%edx
+  8037e7:	76 a8                	jbe    803791 <execv+0x27e>
+  8037e9:	83 fe 03             	cmp    $0x3,%esi
+  8037ec:	7f a3                	jg     803791 <execv+0x27e>
+  8037ee:	8d 0c b6             	lea    (%esi,%esi,4),%ecx
+  8037f1:	c1 e1 02             	shl    $0x2,%ecx
+  8037f4:	89 94 0d 54 fd ff ff 	mov    %edx,-0x2ac(%ebp,%ecx,1)
+  8037fb:	8b 53 14             	mov    0x14(%ebx),%edx
+  8037fe:	89 94 0d 58 fd ff ff 	mov    %edx,-0x2a8(%ebp,%ecx,1)
+  803805:	8b 53 10             	mov    0x10(%ebx),%edx
+  803808:	89 94 0d 5c fd ff ff 	mov    %edx,-0x2a4(%ebp,%ecx,1)
+  80380f:	8b 53 04             	mov    0x4(%ebx),%edx
+  803812:	89 94 0d 60 fd ff ff 	mov    %edx,-0x2a0(%ebp,%ecx,1)
+  803819:	89 84 0d 64 fd ff ff 	mov    %eax,-0x29c(%ebp,%ecx,1)
+  803820:	83 c6 01             	add    $0x1,%esi
+  803823:	eb 92                	jmp    8037b7 <execv+0x2a4>
+  803825:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  80382c:	00 00 00 
+  80382f:	85 f6                	test   %esi,%esi
+  803831:	7f 12                	jg     803845 <execv+0x332>
+  803833:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  803839:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  803840:	00 00 00 
+  803843:	eb 7e                	jmp    8038c3 <execv+0x3b0>
+  803845:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  80384b:	50                   	push   %eax
+  80384c:	56                   	push   %esi
+  80384d:	8d 85 54 fd ff ff    	lea    -0x2ac(%ebp),%eax
+  803853:	50                   	push   %eax
+  803854:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  80385a:	e8 90 f9 ff ff       	call   8031ef <file_image>
+  80385f:	89 85 3c fd ff ff    	mov    %eax,-0x2c4(%ebp)
+  803865:	83 c4 10             	add    $0x10,%esp
+  803868:	85 c0                	test   %eax,%eax
+  80386a:	0f 88 9e 00 00 00    	js     80390e <execv+0x3fb>
+  803870:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  803876:	85 c0                	test   %eax,%eax
+  803878:	75 49                	jne    8038c3 <execv+0x3b0>
+  80387a:	8d 9d 54 fd ff ff    	lea    -0x2ac(%ebp),%ebx
+  803880:	bf 00 00 00 00       	mov    $0x0,%edi
+  803885:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  803888:	8b 13                	mov    (%ebx),%edx
+  80388a:	ff 73 10             	push   0x10(%ebx)
+  80388d:	ff 73 0c             	push   0xc(%ebx)
+  803890:	ff 73 08             	push   0x8(%ebx)
+  803893:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  803899:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  80389f:	e8 44 fb ff ff       	call   8033e8 <map_segment>
+  8038a4:	83 c4 10             	add    $0x10,%esp
+  8038a7:	85 c0                	test   %eax,%eax
+  8038a9:	0f 88 65 02 00 00    	js     803b14 <execv+0x601>
+  8038af:	83 c7 01             	add    $0x1,%edi
+  8038b2:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  8038b8:	83 c3 14             	add    $0x14,%ebx
+  8038bb:	39 fe                	cmp    %edi,%esi
+  8038bd:	7e 04                	jle    8038c3 <execv+0x3b0>
+  8038bf:	85 c0                	test   %eax,%eax
+  8038c1:	74 c2                	je     803885 <execv+0x372>
+  8038c3:	83 ec 04             	sub    $0x4,%esp
+  8038c6:	ff b5 3c fd ff ff    	push   -0x2c4(%ebp)
+  8038cc:	50                   	push   %eax
+  8038cd:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8038d3:	e8 ee e6 ff ff       	call   801fc6 <sys_env_set_pager>
+  8038d8:	89 c7                	mov    %eax,%edi
+  8038da:	83 c4 10             	add    $0x10,%esp
+  8038dd:	85 c0                	test   %eax,%eax
+  8038df:	0f 88 08 02 00 00    	js     803aed <execv+0x5da>
+  8038e5:	83 ec 0c             	sub    $0xc,%esp
+  8038e8:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8038ee:	e8 75 ef ff ff       	call   802868 <close>
+  8038f3:	e8 8c e8 ff ff       	call   802184 <dupq_begin>
+  8038f8:	89 c7                	mov    %eax,%edi
+  8038fa:	83 c4 10             	add    $0x10,%esp
+  8038fd:	89 c1                	mov    %eax,%ecx
+  8038ff:	85 c0                	test   %eax,%eax
+  803901:	0f 88 91 00 00 00    	js     803998 <execv+0x485>
+  803907:	be 02 00 00 00       	mov    $0x2,%esi
+  80390c:	eb 33                	jmp    803941 <execv+0x42e>
+  80390e:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  803915:	00 00 00 
+  803918:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  80391f:	00 00 00 
+  803922:	e9 53 ff ff ff       	jmp    80387a <execv+0x367>
+  803927:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80392e:	a8 01                	test   $0x1,%al
+  803930:	75 7b                	jne    8039ad <execv+0x49a>
+  803932:	83 c6 01             	add    $0x1,%esi
+  803935:	81 fe ba 03 00 00    	cmp    $0x3ba,%esi
+  80393b:	0f 84 e5 00 00 00    	je     803a26 <execv+0x513>
+  803941:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803948:	a8 01                	test   $0x1,%al
+  80394a:	74 db                	je     803927 <execv+0x414>
+  80394c:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803953:	a8 80                	test   $0x80,%al
+  803955:	74 d0                	je     803927 <execv+0x414>
+  803957:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80395e:	f6 c4 04             	test   $0x4,%ah
+  803961:	74 cf                	je     803932 <execv+0x41f>
+  803963:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80396a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80396f:	0c 80                	or     $0x80,%al
+  803971:	50                   	push   %eax
+  803972:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803978:	89 f0                	mov    %esi,%eax
+  80397a:	c1 e0 16             	shl    $0x16,%eax
+  80397d:	c1 e8 0c             	shr    $0xc,%eax
+  803980:	50                   	push   %eax
+  803981:	6a 00                	push   $0x0
+  803983:	e8 1c e8 ff ff       	call   8021a4 <dupq_map>
+  803988:	89 c1                	mov    %eax,%ecx
+  80398a:	83 c4 10             	add    $0x10,%esp
+  80398d:	85 c0                	test   %eax,%eax
+  80398f:	79 a1                	jns    803932 <execv+0x41f>
+  803991:	89 c7                	mov    %eax,%edi
+  803993:	e8 6f e8 ff ff       	call   802207 <dupq_end>
+  803998:	57                   	push   %edi
+  803999:	68 83 53 80 00       	push   $0x805383
+  80399e:	68 ac 00 00 00       	push   $0xac
+  8039a3:	68 5d 53 80 00       	push   $0x80535d
+  8039a8:	e8 0e d1 ff ff       	call   800abb <_panic>
+  8039ad:	89 f7                	mov    %esi,%edi
+  8039af:	c1 e7 16             	shl    $0x16,%edi
+  8039b2:	89 f8                	mov    %edi,%eax
+  8039b4:	c1 e8 0c             	shr    $0xc,%eax
+  8039b7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8039bc:	eb 24                	jmp    8039e2 <execv+0x4cf>
+  8039be:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8039c4:	0f 84 68 ff ff ff    	je     803932 <execv+0x41f>
+  8039ca:	89 d8                	mov    %ebx,%eax
+  8039cc:	09 f8                	or     %edi,%eax
+  8039ce:	c1 e8 0c             	shr    $0xc,%eax
+  8039d1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8039d7:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  8039dc:	0f 84 50 ff ff ff    	je     803932 <execv+0x41f>
+  8039e2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8039e9:	f6 c2 01             	test   $0x1,%dl
+  8039ec:	74 d0                	je     8039be <execv+0x4ab>
+  8039ee:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8039f5:	f6 c6 04             	test   $0x4,%dh
+  8039f8:	74 c4                	je     8039be <execv+0x4ab>
+  8039fa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a01:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  803a07:	52                   	push   %edx
+  803a08:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803a0e:	50                   	push   %eax
+  803a0f:	6a 00                	push   $0x0
+  803a11:	e8 8e e7 ff ff       	call   8021a4 <dupq_map>
+  803a16:	89 c1                	mov    %eax,%ecx
+  803a18:	83 c4 10             	add    $0x10,%esp
+  803a1b:	85 c0                	test   %eax,%eax
+  803a1d:	79 9f                	jns    8039be <execv+0x4ab>
+  803a1f:	89 c7                	mov    %eax,%edi
+  803a21:	e9 6d ff ff ff       	jmp    803993 <execv+0x480>
+  803a26:	89 cf                	mov    %ecx,%edi
+  803a28:	85 c9                	test   %ecx,%ecx
+  803a2a:	0f 88 63 ff ff ff    	js     803993 <execv+0x480>
+  803a30:	e8 d2 e7 ff ff       	call   802207 <dupq_end>
+  803a35:	89 c7                	mov    %eax,%edi
+  803a37:	85 c0                	test   %eax,%eax
+  803a39:	0f 88 59 ff ff ff    	js     803998 <execv+0x485>
+  803a3f:	83 ec 08             	sub    $0x8,%esp
+  803a42:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803a48:	50                   	push   %eax
+  803a49:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803a4f:	e8 fe de ff ff       	call   801952 <sys_env_set_trapframe>
+  803a54:	83 c4 10             	add    $0x10,%esp
+  803a57:	85 c0                	test   %eax,%eax
+  803a59:	78 2e                	js     803a89 <execv+0x576>
+  803a5b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a5f:	74 52                	je     803ab3 <execv+0x5a0>
+  803a61:	83 ec 08             	sub    $0x8,%esp
+  803a64:	6a 02                	push   $0x2
+  803a66:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803a6c:	e8 9f de ff ff       	call   801910 <sys_env_set_status>
+  803a71:	83 c4 10             	add    $0x10,%esp
+  803a74:	85 c0                	test   %eax,%eax
+  803a76:	78 26                	js     803a9e <execv+0x58b>
+  803a78:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  803a7e:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  803a84:	e9 9b 00 00 00       	jmp    803b24 <execv+0x611>
+  803a89:	50                   	push   %eax
+  803a8a:	68 99 53 80 00       	push   $0x805399
+  803a8f:	68 af 00 00 00       	push   $0xaf
+  803a94:	68 5d 53 80 00       	push   $0x80535d
+  803a99:	e8 1d d0 ff ff       	call   800abb <_panic>
+  803a9e:	50                   	push   %eax
+  803a9f:	68 b3 53 80 00       	push   $0x8053b3
+  803aa4:	68 b3 00 00 00       	push   $0xb3
+  803aa9:	68 5d 53 80 00       	push   $0x80535d
+  803aae:	e8 08 d0 ff ff       	call   800abb <_panic>
+  803ab3:	83 ec 0c             	sub    $0xc,%esp
+  803ab6:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803abc:	e8 2f e1 ff ff       	call   801bf0 <sys_env_swap>
+  803ac1:	83 c4 10             	add    $0x10,%esp
+  803ac4:	85 c0                	test   %eax,%eax
+  803ac6:	78 0e                	js     803ad6 <execv+0x5c3>
+  803ac8:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  803ace:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  803ad4:	eb 4e                	jmp    803b24 <execv+0x611>
+  803ad6:	50                   	push   %eax
+  803ad7:	68 ca 53 80 00       	push   $0x8053ca
+  803adc:	68 ba 00 00 00       	push   $0xba
+  803ae1:	68 5d 53 80 00       	push   $0x80535d
+  803ae6:	e8 d0 cf ff ff       	call   800abb <_panic>
+  803aeb:	89 c7                	mov    %eax,%edi
+  803aed:	83 ec 0c             	sub    $0xc,%esp
+  803af0:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803af6:	e8 37 dc ff ff       	call   801732 <sys_env_destroy>
+  803afb:	83 c4 04             	add    $0x4,%esp
+  803afe:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  803b04:	e8 5f ed ff ff       	call   802868 <close>
+  803b09:	83 c4 10             	add    $0x10,%esp
+  803b0c:	89 bd 44 fd ff ff    	mov    %edi,-0x2bc(%ebp)
+  803b12:	eb 10                	jmp    803b24 <execv+0x611>
+  803b14:	89 c7                	mov    %eax,%edi
+  803b16:	eb d5                	jmp    803aed <execv+0x5da>
+  803b18:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  803b1e:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  803b24:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  803b2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b2d:	5b                   	pop    %ebx
+  803b2e:	5e                   	pop    %esi
+  803b2f:	5f                   	pop    %edi
+  803b30:	5d                   	pop    %ebp
+  803b31:	c3                   	ret
+  803b32:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  803b39:	00 00 00 
+  803b3c:	e9 f2 fc ff ff       	jmp    803833 <execv+0x320>
+  803b41:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803b46:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  803b4c:	eb d6                	jmp    803b24 <execv+0x611>
+  803b4e:	83 ec 08             	sub    $0x8,%esp
+  803b51:	68 00 00 40 00       	push   $0x400000
+  803b56:	6a 00                	push   $0x0
+  803b58:	e8 52 dd ff ff       	call   8018af <sys_page_unmap>
+  803b5d:	83 c4 10             	add    $0x10,%esp
+  803b60:	89 9d 44 fd ff ff    	mov    %ebx,-0x2bc(%ebp)
+  803b66:	eb bc                	jmp    803b24 <execv+0x611>
+  803b68:	83 ec 04             	sub    $0x4,%esp
+  803b6b:	6a 07                	push   $0x7
+  803b6d:	68 00 00 40 00       	push   $0x400000
+  803b72:	6a 00                	push   $0x0
+  803b74:	e8 64 dc ff ff       	call   8017dd <sys_page_alloc>
+  803b79:	83 c4 10             	add    $0x10,%esp
+  803b7c:	85 c0                	test   %eax,%eax
+  803b7e:	78 c6                	js     803b46 <execv+0x633>
+  803b80:	c7 85 2c fd ff ff 00 	movl   $0x0,-0x2d4(%ebp)
+  803b87:	00 00 00 
+  803b8a:	c7 85 38 fd ff ff 00 	movl   $0x0,-0x2c8(%ebp)
+  803b91:	00 00 00 
+  803b94:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+  803b99:	be 00 10 40 00       	mov    $0x401000,%esi
+  803b9e:	e9 f7 fa ff ff       	jmp    80369a <execv+0x187>
+
+00803ba3 <spawn>:
+  803ba3:	55                   	push   %ebp
+  803ba4:	89 e5                	mov    %esp,%ebp
+  803ba6:	83 ec 0c             	sub    $0xc,%esp
+  803ba9:	6a 01                	push   $0x1
+  803bab:	ff 75 0c             	push   0xc(%ebp)
+  803bae:	ff 75 08             	push   0x8(%ebp)
+  803bb1:	e8 5d f9 ff ff       	call   803513 <execv>
+  803bb6:	c9                   	leave
+  803bb7:	c3                   	ret
+
+00803bb8 <exec>:
+  803bb8:	55                   	push   %ebp
+  803bb9:	89 e5                	mov    %esp,%ebp
+  803bbb:	83 ec 0c             	sub    $0xc,%esp
+  803bbe:	6a 00                	push   $0x0
+  803bc0:	ff 75 0c             	push   0xc(%ebp)
+  803bc3:	ff 75 08             	push   0x8(%ebp)
+  803bc6:	e8 48 f9 ff ff       	call   803513 <execv>
+  803bcb:	c9                   	leave
+  803bcc:	c3                   	ret
+
+00803bcd <spawnl>:
+  803bcd:	55                   	push   %ebp
+  803bce:	89 e5                	mov    %esp,%ebp
+  803bd0:	56                   	push   %esi
+  803bd1:	53                   	push   %ebx
+  803bd2:	8d 45 10             	lea    0x10(%ebp),%eax
+  803bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bda:	eb 05                	jmp    803be1 <spawnl+0x14>
+  803bdc:	83 c1 01             	add    $0x1,%ecx
+  803bdf:	89 d0                	mov    %edx,%eax
+  803be1:	8d 50 04             	lea    0x4(%eax),%edx
+  803be4:	83 38 00             	cmpl   $0x0,(%eax)
+  803be7:	75 f3                	jne    803bdc <spawnl+0xf>
+  803be9:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  803bf0:	83 e0 f0             	and    $0xfffffff0,%eax
+  803bf3:	29 c4                	sub    %eax,%esp
+  803bf5:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803bf9:	89 d8                	mov    %ebx,%eax
+  803bfb:	c1 e8 02             	shr    $0x2,%eax
+  803bfe:	83 e3 fc             	and    $0xfffffffc,%ebx
+  803c01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c04:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  803c0b:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  803c12:	00 
+  803c13:	8d 55 10             	lea    0x10(%ebp),%edx
+  803c16:	89 ce                	mov    %ecx,%esi
+  803c18:	85 c9                	test   %ecx,%ecx
+  803c1a:	74 16                	je     803c32 <spawnl+0x65>
+  803c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c21:	83 c0 01             	add    $0x1,%eax
+  803c24:	89 d1                	mov    %edx,%ecx
+  803c26:	83 c2 04             	add    $0x4,%edx
+  803c29:	8b 09                	mov    (%ecx),%ecx
+  803c2b:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  803c2e:	39 f0                	cmp    %esi,%eax
+  803c30:	75 ef                	jne    803c21 <spawnl+0x54>
+  803c32:	83 ec 08             	sub    $0x8,%esp
+  803c35:	53                   	push   %ebx
+  803c36:	ff 75 08             	push   0x8(%ebp)
+  803c39:	e8 65 ff ff ff       	call   803ba3 <spawn>
+  803c3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c41:	5b                   	pop    %ebx
+  803c42:	5e                   	pop    %esi
+  803c43:	5d                   	pop    %ebp
+  803c44:	c3                   	ret
+
+00803c45 <execl>:
+  803c45:	55                   	push   %ebp
+  803c46:	89 e5                	mov    %esp,%ebp
+  803c48:	56                   	push   %esi
+  803c49:	53                   	push   %ebx
+  803c4a:	8d 45 10             	lea    0x10(%ebp),%eax
+  803c4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c52:	eb 05                	jmp    803c59 <execl+0x14>
+  803c54:	83 c1 01             	add    $0x1,%ecx
+  803c57:	89 d0                	mov    %edx,%eax
+  803c59:	8d 50 04             	lea    0x4(%eax),%edx
+  803c5c:	83 38 00             	cmpl   $0x0,(%eax)
+  803c5f:	75 f3                	jne    803c54 <execl+0xf>
+  803c61:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  803c68:	83 e0 f0             	and    $0xfffffff0,%eax
+  803c6b:	29 c4                	sub    %eax,%esp
+  803c6d:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803c71:	89 d8                	mov    %ebx,%eax
+  803c73:	c1 e8 02             	shr    $0x2,%eax
+  803c76:	83 e3 fc             	and    $0xfffffffc,%ebx
+  803c79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c7c:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  803c83:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  803c8a:	00 
+  803c8b:	8d 55 10             	lea    0x10(%ebp),%edx
+  803c8e:	89 ce                	mov    %ecx,%esi
+  803c90:	85 c9                	test   %ecx,%ecx
+  803c92:	74 16                	je     803caa <execl+0x65>
+  803c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c99:	83 c0 01             	add    $0x1,%eax
+  803c9c:	89 d1                	mov    %edx,%ecx
+  803c9e:	83 c2 04             	add    $0x4,%edx
+  803ca1:	8b 09                	mov    (%ecx),%ecx
+  803ca3:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  803ca6:	39 f0                	cmp    %esi,%eax
+  803ca8:	75 ef                	jne    803c99 <execl+0x54>
+  803caa:	83 ec 08             	sub    $0x8,%esp
+  803cad:	53                   	push   %ebx
+  803cae:	ff 75 08             	push   0x8(%ebp)
+  803cb1:	e8 02 ff ff ff       	call   803bb8 <exec>
+  803cb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cb9:	5b                   	pop    %ebx
+  803cba:	5e                   	pop    %esi
+  803cbb:	5d                   	pop    %ebp
+  803cbc:	c3                   	ret
+
+00803cbd <devsock_stat>:
+  803cbd:	55                   	push   %ebp
+  803cbe:	89 e5                	mov    %esp,%ebp
+  803cc0:	83 ec 10             	sub    $0x10,%esp
+  803cc3:	68 02 54 80 00       	push   $0x805402
+  803cc8:	ff 75 0c             	push   0xc(%ebp)
+  803ccb:	e8 ad d6 ff ff       	call   80137d <strcpy>
+  803cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd5:	c9                   	leave
+  803cd6:	c3                   	ret
+
+00803cd7 <devsock_close>:
+  803cd7:	55                   	push   %ebp
+  803cd8:	89 e5                	mov    %esp,%ebp
+  803cda:	53                   	push   %ebx
+  803cdb:	83 ec 10             	sub    $0x10,%esp
+  803cde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ce1:	53                   	push   %ebx
+  803ce2:	e8 15 0d 00 00       	call   8049fc <pageref>
+  803ce7:	89 c2                	mov    %eax,%edx
+  803ce9:	83 c4 10             	add    $0x10,%esp
+  803cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cf1:	83 fa 01             	cmp    $0x1,%edx
+  803cf4:	74 05                	je     803cfb <devsock_close+0x24>
+  803cf6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cf9:	c9                   	leave
+  803cfa:	c3                   	ret
+  803cfb:	83 ec 0c             	sub    $0xc,%esp
+  803cfe:	ff 73 0c             	push   0xc(%ebx)
+  803d01:	e8 aa 02 00 00       	call   803fb0 <nsipc_close>
+  803d06:	83 c4 10             	add    $0x10,%esp
+  803d09:	eb eb                	jmp    803cf6 <devsock_close+0x1f>
+
+00803d0b <devsock_write>:
+  803d0b:	55                   	push   %ebp
+  803d0c:	89 e5                	mov    %esp,%ebp
+  803d0e:	83 ec 08             	sub    $0x8,%esp
+  803d11:	6a 00                	push   $0x0
+  803d13:	ff 75 10             	push   0x10(%ebp)
+  803d16:	ff 75 0c             	push   0xc(%ebp)
+  803d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d1c:	ff 70 0c             	push   0xc(%eax)
+  803d1f:	e8 6c 03 00 00       	call   804090 <nsipc_send>
+  803d24:	c9                   	leave
+  803d25:	c3                   	ret
+
+00803d26 <devsock_read>:
+  803d26:	55                   	push   %ebp
+  803d27:	89 e5                	mov    %esp,%ebp
+  803d29:	83 ec 08             	sub    $0x8,%esp
+  803d2c:	6a 00                	push   $0x0
+  803d2e:	ff 75 10             	push   0x10(%ebp)
+  803d31:	ff 75 0c             	push   0xc(%ebp)
+  803d34:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d37:	ff 70 0c             	push   0xc(%eax)
+  803d3a:	e8 e2 02 00 00       	call   804021 <nsipc_recv>
+  803d3f:	c9                   	leave
+  803d40:	c3                   	ret
+
+00803d41 <fd2sockid>:
+  803d41:	55                   	push   %ebp
+  803d42:	89 e5                	mov    %esp,%ebp
+  803d44:	83 ec 20             	sub    $0x20,%esp
+  803d47:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d4a:	52                   	push   %edx
+  803d4b:	50                   	push   %eax
+  803d4c:	e8 f1 e9 ff ff       	call   802742 <fd_lookup>
+  803d51:	83 c4 10             	add    $0x10,%esp
+  803d54:	85 c0                	test   %eax,%eax
+  803d56:	78 10                	js     803d68 <fd2sockid+0x27>
+  803d58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d5b:	8b 0d 3c 60 80 00    	mov    0x80603c,%ecx
+  803d61:	39 08                	cmp    %ecx,(%eax)
+  803d63:	75 05                	jne    803d6a <fd2sockid+0x29>
+  803d65:	8b 40 0c             	mov    0xc(%eax),%eax
+  803d68:	c9                   	leave
+  803d69:	c3                   	ret
+  803d6a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803d6f:	eb f7                	jmp    803d68 <fd2sockid+0x27>
+
+00803d71 <alloc_sockfd>:
+  803d71:	55                   	push   %ebp
+  803d72:	89 e5                	mov    %esp,%ebp
+  803d74:	56                   	push   %esi
+  803d75:	53                   	push   %ebx
+  803d76:	83 ec 1c             	sub    $0x1c,%esp
+  803d79:	89 c6                	mov    %eax,%esi
+  803d7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d7e:	50                   	push   %eax
+  803d7f:	e8 6e e9 ff ff       	call   8026f2 <fd_alloc>
+  803d84:	89 c3                	mov    %eax,%ebx
+  803d86:	83 c4 10             	add    $0x10,%esp
+  803d89:	85 c0                	test   %eax,%eax
+  803d8b:	78 43                	js     803dd0 <alloc_sockfd+0x5f>
+  803d8d:	83 ec 04             	sub    $0x4,%esp
+  803d90:	68 07 04 00 00       	push   $0x407
+  803d95:	ff 75 f4             	push   -0xc(%ebp)
+  803d98:	6a 00                	push   $0x0
+  803d9a:	e8 3e da ff ff       	call   8017dd <sys_page_alloc>
+  803d9f:	89 c3                	mov    %eax,%ebx
+  803da1:	83 c4 10             	add    $0x10,%esp
+  803da4:	85 c0                	test   %eax,%eax
+  803da6:	78 28                	js     803dd0 <alloc_sockfd+0x5f>
+  803da8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dab:	8b 15 3c 60 80 00    	mov    0x80603c,%edx
+  803db1:	89 10                	mov    %edx,(%eax)
+  803db3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803db6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803dbd:	89 70 0c             	mov    %esi,0xc(%eax)
+  803dc0:	83 ec 0c             	sub    $0xc,%esp
+  803dc3:	50                   	push   %eax
+  803dc4:	e8 02 e9 ff ff       	call   8026cb <fd2num>
+  803dc9:	89 c3                	mov    %eax,%ebx
+  803dcb:	83 c4 10             	add    $0x10,%esp
+  803dce:	eb 0c                	jmp    803ddc <alloc_sockfd+0x6b>
+  803dd0:	83 ec 0c             	sub    $0xc,%esp
+  803dd3:	56                   	push   %esi
+  803dd4:	e8 d7 01 00 00       	call   803fb0 <nsipc_close>
+  803dd9:	83 c4 10             	add    $0x10,%esp
+  803ddc:	89 d8                	mov    %ebx,%eax
+  803dde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803de1:	5b                   	pop    %ebx
+  803de2:	5e                   	pop    %esi
+  803de3:	5d                   	pop    %ebp
+  803de4:	c3                   	ret
+
+00803de5 <accept>:
+  803de5:	55                   	push   %ebp
+  803de6:	89 e5                	mov    %esp,%ebp
+  803de8:	83 ec 08             	sub    $0x8,%esp
+  803deb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dee:	e8 4e ff ff ff       	call   803d41 <fd2sockid>
+  803df3:	85 c0                	test   %eax,%eax
+  803df5:	78 1b                	js     803e12 <accept+0x2d>
+  803df7:	83 ec 04             	sub    $0x4,%esp
+  803dfa:	ff 75 10             	push   0x10(%ebp)
+  803dfd:	ff 75 0c             	push   0xc(%ebp)
+  803e00:	50                   	push   %eax
+  803e01:	e8 07 01 00 00       	call   803f0d <nsipc_accept>
+  803e06:	83 c4 10             	add    $0x10,%esp
+  803e09:	85 c0                	test   %eax,%eax
+  803e0b:	78 05                	js     803e12 <accept+0x2d>
+  803e0d:	e8 5f ff ff ff       	call   803d71 <alloc_sockfd>
+  803e12:	c9                   	leave
+  803e13:	c3                   	ret
+
+00803e14 <bind>:
+  803e14:	55                   	push   %ebp
+  803e15:	89 e5                	mov    %esp,%ebp
+  803e17:	83 ec 08             	sub    $0x8,%esp
+  803e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e1d:	e8 1f ff ff ff       	call   803d41 <fd2sockid>
+  803e22:	85 c0                	test   %eax,%eax
+  803e24:	78 12                	js     803e38 <bind+0x24>
+  803e26:	83 ec 04             	sub    $0x4,%esp
+  803e29:	ff 75 10             	push   0x10(%ebp)
+  803e2c:	ff 75 0c             	push   0xc(%ebp)
+  803e2f:	50                   	push   %eax
+  803e30:	e8 24 01 00 00       	call   803f59 <nsipc_bind>
+  803e35:	83 c4 10             	add    $0x10,%esp
+  803e38:	c9                   	leave
+  803e39:	c3                   	ret
+
+00803e3a <shutdown>:
+  803e3a:	55                   	push   %ebp
+  803e3b:	89 e5                	mov    %esp,%ebp
+  803e3d:	83 ec 08             	sub    $0x8,%esp
+  803e40:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e43:	e8 f9 fe ff ff       	call   803d41 <fd2sockid>
+  803e48:	85 c0                	test   %eax,%eax
+  803e4a:	78 0f                	js     803e5b <shutdown+0x21>
+  803e4c:	83 ec 08             	sub    $0x8,%esp
+  803e4f:	ff 75 0c             	push   0xc(%ebp)
+  803e52:	50                   	push   %eax
+  803e53:	e8 36 01 00 00       	call   803f8e <nsipc_shutdown>
+  803e58:	83 c4 10             	add    $0x10,%esp
+  803e5b:	c9                   	leave
+  803e5c:	c3                   	ret
+
+00803e5d <connect>:
+  803e5d:	55                   	push   %ebp
+  803e5e:	89 e5                	mov    %esp,%ebp
+  803e60:	83 ec 08             	sub    $0x8,%esp
+  803e63:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e66:	e8 d6 fe ff ff       	call   803d41 <fd2sockid>
+  803e6b:	85 c0                	test   %eax,%eax
+  803e6d:	78 12                	js     803e81 <connect+0x24>
+  803e6f:	83 ec 04             	sub    $0x4,%esp
+  803e72:	ff 75 10             	push   0x10(%ebp)
+  803e75:	ff 75 0c             	push   0xc(%ebp)
+  803e78:	50                   	push   %eax
+  803e79:	e8 4c 01 00 00       	call   803fca <nsipc_connect>
+  803e7e:	83 c4 10             	add    $0x10,%esp
+  803e81:	c9                   	leave
+  803e82:	c3                   	ret
+
+00803e83 <listen>:
+  803e83:	55                   	push   %ebp
+  803e84:	89 e5                	mov    %esp,%ebp
+  803e86:	83 ec 08             	sub    $0x8,%esp
+  803e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e8c:	e8 b0 fe ff ff       	call   803d41 <fd2sockid>
+  803e91:	85 c0                	test   %eax,%eax
+  803e93:	78 0f                	js     803ea4 <listen+0x21>
+  803e95:	83 ec 08             	sub    $0x8,%esp
+  803e98:	ff 75 0c             	push   0xc(%ebp)
+  803e9b:	50                   	push   %eax
+  803e9c:	e8 5e 01 00 00       	call   803fff <nsipc_listen>
+  803ea1:	83 c4 10             	add    $0x10,%esp
+  803ea4:	c9                   	leave
+  803ea5:	c3                   	ret
+
+00803ea6 <socket>:
+  803ea6:	55                   	push   %ebp
+  803ea7:	89 e5                	mov    %esp,%ebp
+  803ea9:	83 ec 0c             	sub    $0xc,%esp
+  803eac:	ff 75 10             	push   0x10(%ebp)
+  803eaf:	ff 75 0c             	push   0xc(%ebp)
+  803eb2:	ff 75 08             	push   0x8(%ebp)
+  803eb5:	e8 34 02 00 00       	call   8040ee <nsipc_socket>
+  803eba:	83 c4 10             	add    $0x10,%esp
+  803ebd:	85 c0                	test   %eax,%eax
+  803ebf:	78 05                	js     803ec6 <socket+0x20>
+  803ec1:	e8 ab fe ff ff       	call   803d71 <alloc_sockfd>
+  803ec6:	c9                   	leave
+  803ec7:	c3                   	ret
+
+00803ec8 <nsipc>:
+  803ec8:	55                   	push   %ebp
+  803ec9:	89 e5                	mov    %esp,%ebp
+  803ecb:	53                   	push   %ebx
+  803ecc:	83 ec 04             	sub    $0x4,%esp
+  803ecf:	89 c3                	mov    %eax,%ebx
+  803ed1:	83 3d 30 74 80 00 00 	cmpl   $0x0,0x807430
+  803ed8:	74 1f                	je     803ef9 <nsipc+0x31>
+  803eda:	83 ec 08             	sub    $0x8,%esp
+  803edd:	6a 00                	push   $0x0
+  803edf:	6a 00                	push   $0x0
+  803ee1:	6a 07                	push   $0x7
+  803ee3:	68 00 90 80 00       	push   $0x809000
+  803ee8:	53                   	push   %ebx
+  803ee9:	ff 35 30 74 80 00    	push   0x807430
+  803eef:	e8 53 09 00 00       	call   804847 <ipc_call>
+  803ef4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ef7:	c9                   	leave
+  803ef8:	c3                   	ret
+  803ef9:	83 ec 0c             	sub    $0xc,%esp
+  803efc:	6a 03                	push   $0x3
+  803efe:	e8 df 0a 00 00       	call   8049e2 <ipc_find_env>
+  803f03:	a3 30 74 80 00       	mov    %eax,0x807430
+  803f08:	83 c4 10             	add    $0x10,%esp
+  803f0b:	eb cd                	jmp    803eda <nsipc+0x12>
+
+00803f0d <nsipc_accept>:
+  803f0d:	55                   	push   %ebp
+  803f0e:	89 e5                	mov    %esp,%ebp
+  803f10:	53                   	push   %ebx
+  803f11:	83 ec 04             	sub    $0x4,%esp
+  803f14:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f17:	a3 00 90 80 00       	mov    %eax,0x809000
+  803f1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f21:	e8 a2 ff ff ff       	call   803ec8 <nsipc>
+  803f26:	89 c3                	mov    %eax,%ebx
+  803f28:	85 c0                	test   %eax,%eax
+  803f2a:	79 07                	jns    803f33 <nsipc_accept+0x26>
+  803f2c:	89 d8                	mov    %ebx,%eax
+  803f2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f31:	c9                   	leave
+  803f32:	c3                   	ret
+  803f33:	83 ec 04             	sub    $0x4,%esp
+  803f36:	ff 35 10 90 80 00    	push   0x809010
+  803f3c:	68 00 90 80 00       	push   $0x809000
+  803f41:	ff 75 0c             	push   0xc(%ebp)
+  803f44:	e8 e4 d5 ff ff       	call   80152d <memmove>
+  803f49:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  803f4f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803f52:	89 10                	mov    %edx,(%eax)
+  803f54:	83 c4 10             	add    $0x10,%esp
+  803f57:	eb d3                	jmp    803f2c <nsipc_accept+0x1f>
+
+00803f59 <nsipc_bind>:
+  803f59:	55                   	push   %ebp
+  803f5a:	89 e5                	mov    %esp,%ebp
+  803f5c:	53                   	push   %ebx
+  803f5d:	83 ec 08             	sub    $0x8,%esp
+  803f60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803f63:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f66:	a3 00 90 80 00       	mov    %eax,0x809000
+  803f6b:	53                   	push   %ebx
+  803f6c:	ff 75 0c             	push   0xc(%ebp)
+  803f6f:	68 04 90 80 00       	push   $0x809004
+  803f74:	e8 b4 d5 ff ff       	call   80152d <memmove>
+  803f79:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+  803f7f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803f84:	e8 3f ff ff ff       	call   803ec8 <nsipc>
+  803f89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f8c:	c9                   	leave
+  803f8d:	c3                   	ret
+
+00803f8e <nsipc_shutdown>:
+  803f8e:	55                   	push   %ebp
+  803f8f:	89 e5                	mov    %esp,%ebp
+  803f91:	83 ec 08             	sub    $0x8,%esp
+  803f94:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f97:	a3 00 90 80 00       	mov    %eax,0x809000
+  803f9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f9f:	a3 04 90 80 00       	mov    %eax,0x809004
+  803fa4:	b8 03 00 00 00       	mov    $0x3,%eax
+  803fa9:	e8 1a ff ff ff       	call   803ec8 <nsipc>
+  803fae:	c9                   	leave
+  803faf:	c3                   	ret
+
+00803fb0 <nsipc_close>:
+  803fb0:	55                   	push   %ebp
+  803fb1:	89 e5                	mov    %esp,%ebp
+  803fb3:	83 ec 08             	sub    $0x8,%esp
+  803fb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fb9:	a3 00 90 80 00       	mov    %eax,0x809000
+  803fbe:	b8 04 00 00 00       	mov    $0x4,%eax
+  803fc3:	e8 00 ff ff ff       	call   803ec8 <nsipc>
+  803fc8:	c9                   	leave
+  803fc9:	c3                   	ret
+
+00803fca <nsipc_connect>:
+  803fca:	55                   	push   %ebp
+  803fcb:	89 e5                	mov    %esp,%ebp
+  803fcd:	53                   	push   %ebx
+  803fce:	83 ec 08             	sub    $0x8,%esp
+  803fd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803fd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fd7:	a3 00 90 80 00       	mov    %eax,0x809000
+  803fdc:	53                   	push   %ebx
+  803fdd:	ff 75 0c             	push   0xc(%ebp)
+  803fe0:	68 04 90 80 00       	push   $0x809004
+  803fe5:	e8 43 d5 ff ff       	call   80152d <memmove>
+  803fea:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+  803ff0:	b8 05 00 00 00       	mov    $0x5,%eax
+  803ff5:	e8 ce fe ff ff       	call   803ec8 <nsipc>
+  803ffa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ffd:	c9                   	leave
+  803ffe:	c3                   	ret
+
+00803fff <nsipc_listen>:
+  803fff:	55                   	push   %ebp
+  804000:	89 e5                	mov    %esp,%ebp
+  804002:	83 ec 08             	sub    $0x8,%esp
+  804005:	8b 45 08             	mov    0x8(%ebp),%eax
+  804008:	a3 00 90 80 00       	mov    %eax,0x809000
+  80400d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804010:	a3 04 90 80 00       	mov    %eax,0x809004
+  804015:	b8 06 00 00 00       	mov    $0x6,%eax
+  80401a:	e8 a9 fe ff ff       	call   803ec8 <nsipc>
+  80401f:	c9                   	leave
+  804020:	c3                   	ret
+
+00804021 <nsipc_recv>:
+  804021:	55                   	push   %ebp
+  804022:	89 e5                	mov    %esp,%ebp
+  804024:	56                   	push   %esi
+  804025:	53                   	push   %ebx
+  804026:	8b 75 10             	mov    0x10(%ebp),%esi
+  804029:	8b 45 08             	mov    0x8(%ebp),%eax
+  80402c:	a3 00 90 80 00       	mov    %eax,0x809000
+  804031:	89 35 04 90 80 00    	mov    %esi,0x809004
+  804037:	8b 45 14             	mov    0x14(%ebp),%eax
+  80403a:	a3 08 90 80 00       	mov    %eax,0x809008
+  80403f:	b8 07 00 00 00       	mov    $0x7,%eax
+  804044:	e8 7f fe ff ff       	call   803ec8 <nsipc>
+  804049:	89 c3                	mov    %eax,%ebx
+  80404b:	85 c0                	test   %eax,%eax
+  80404d:	78 22                	js     804071 <nsipc_recv+0x50>
+  80404f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  804054:	39 c6                	cmp    %eax,%esi
+  804056:	0f 4e c6             	cmovle %esi,%eax
+  804059:	39 c3                	cmp    %eax,%ebx
+  80405b:	7f 1d                	jg     80407a <nsipc_recv+0x59>
+  80405d:	83 ec 04             	sub    $0x4,%esp
+  804060:	53                   	push   %ebx
+  804061:	68 00 90 80 00       	push   $0x809000
+  804066:	ff 75 0c             	push   0xc(%ebp)
+  804069:	e8 bf d4 ff ff       	call   80152d <memmove>
+  80406e:	83 c4 10             	add    $0x10,%esp
+  804071:	89 d8                	mov    %ebx,%eax
+  804073:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804076:	5b                   	pop    %ebx
+  804077:	5e                   	pop    %esi
+  804078:	5d                   	pop    %ebp
+  804079:	c3                   	ret
+  80407a:	68 0e 54 80 00       	push   $0x80540e
+  80407f:	68 8f 4d 80 00       	push   $0x804d8f
+  804084:	6a 60                	push   $0x60
+  804086:	68 23 54 80 00       	push   $0x805423
+  80408b:	e8 2b ca ff ff       	call   800abb <_panic>
+
+00804090 <nsipc_send>:
+  804090:	55                   	push   %ebp
+  804091:	89 e5                	mov    %esp,%ebp
+  804093:	53                   	push   %ebx
+  804094:	83 ec 04             	sub    $0x4,%esp
+  804097:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80409a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80409d:	a3 00 90 80 00       	mov    %eax,0x809000
+  8040a2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8040a8:	7f 2e                	jg     8040d8 <nsipc_send+0x48>
+  8040aa:	83 ec 04             	sub    $0x4,%esp
+  8040ad:	53                   	push   %ebx
+  8040ae:	ff 75 0c             	push   0xc(%ebp)
+  8040b1:	68 0c 90 80 00       	push   $0x80900c
+  8040b6:	e8 72 d4 ff ff       	call   80152d <memmove>
+  8040bb:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  8040c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040c4:	a3 08 90 80 00       	mov    %eax,0x809008
+  8040c9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8040ce:	e8 f5 fd ff ff       	call   803ec8 <nsipc>
+  8040d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040d6:	c9                   	leave
+  8040d7:	c3                   	ret
+  8040d8:	68 2f 54 80 00       	push   $0x80542f
+  8040dd:	68 8f 4d 80 00       	push   $0x804d8f
+  8040e2:	6a 6b                	push   $0x6b
+  8040e4:	68 23 54 80 00       	push   $0x805423
+  8040e9:	e8 cd c9 ff ff       	call   800abb <_panic>
+
+008040ee <nsipc_socket>:
+  8040ee:	55                   	push   %ebp
+  8040ef:	89 e5                	mov    %esp,%ebp
+  8040f1:	83 ec 08             	sub    $0x8,%esp
+  8040f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040f7:	a3 00 90 80 00       	mov    %eax,0x809000
+  8040fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8040ff:	a3 04 90 80 00       	mov    %eax,0x809004
+  804104:	8b 45 10             	mov    0x10(%ebp),%eax
+  804107:	a3 08 90 80 00       	mov    %eax,0x809008
+  80410c:	b8 09 00 00 00       	mov    $0x9,%eax
+  804111:	e8 b2 fd ff ff       	call   803ec8 <nsipc>
+  804116:	c9                   	leave
+  804117:	c3                   	ret
+
+00804118 <devpipe_stat>:
+  804118:	55                   	push   %ebp
+  804119:	89 e5                	mov    %esp,%ebp
+  80411b:	56                   	push   %esi
+  80411c:	53                   	push   %ebx
+  80411d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804120:	83 ec 0c             	sub    $0xc,%esp
+  804123:	ff 75 08             	push   0x8(%ebp)
+  804126:	e8 b0 e5 ff ff       	call   8026db <fd2data>
+  80412b:	89 c6                	mov    %eax,%esi
+  80412d:	83 c4 08             	add    $0x8,%esp
+  804130:	68 3b 54 80 00       	push   $0x80543b
+  804135:	53                   	push   %ebx
+  804136:	e8 42 d2 ff ff       	call   80137d <strcpy>
+  80413b:	8b 46 04             	mov    0x4(%esi),%eax
+  80413e:	2b 06                	sub    (%esi),%eax
+  804140:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  804146:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80414d:	00 00 00 
+  804150:	c7 83 88 00 00 00 58 	movl   $0x806058,0x88(%ebx)
+  804157:	60 80 00 
+  80415a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80415f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804162:	5b                   	pop    %ebx
+  804163:	5e                   	pop    %esi
+  804164:	5d                   	pop    %ebp
+  804165:	c3                   	ret
+
+00804166 <devpipe_close>:
+  804166:	55                   	push   %ebp
+  804167:	89 e5                	mov    %esp,%ebp
+  804169:	53                   	push   %ebx
+  80416a:	83 ec 0c             	sub    $0xc,%esp
+  80416d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804170:	53                   	push   %ebx
+  804171:	6a 00                	push   $0x0
+  804173:	e8 37 d7 ff ff       	call   8018af <sys_page_unmap>
+  804178:	89 1c 24             	mov    %ebx,(%esp)
+  80417b:	e8 5b e5 ff ff       	call   8026db <fd2data>
+  804180:	83 c4 08             	add    $0x8,%esp
+  804183:	50                   	push   %eax
+  804184:	6a 00                	push   $0x0
+  804186:	e8 24 d7 ff ff       	call   8018af <sys_page_unmap>
+  80418b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80418e:	c9                   	leave
+  80418f:	c3                   	ret
+
+00804190 <_pipeisclosed>:
+  804190:	55                   	push   %ebp
+  804191:	89 e5                	mov    %esp,%ebp
+  804193:	57                   	push   %edi
+  804194:	56                   	push   %esi
+  804195:	53                   	push   %ebx
+  804196:	83 ec 1c             	sub    $0x1c,%esp
+  804199:	89 c7                	mov    %eax,%edi
+  80419b:	89 d6                	mov    %edx,%esi
+  80419d:	a1 34 74 80 00       	mov    0x807434,%eax
+  8041a2:	8b 58 58             	mov    0x58(%eax),%ebx
+  8041a5:	83 ec 0c             	sub    $0xc,%esp
+  8041a8:	57                   	push   %edi
+  8041a9:	e8 4e 08 00 00       	call   8049fc <pageref>
+  8041ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8041b1:	89 34 24             	mov    %esi,(%esp)
+  8041b4:	e8 43 08 00 00       	call   8049fc <pageref>
+  8041b9:	8b 15 34 74 80 00    	mov    0x807434,%edx
+  8041bf:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8041c2:	83 c4 10             	add    $0x10,%esp
+  8041c5:	39 cb                	cmp    %ecx,%ebx
+  8041c7:	74 1b                	je     8041e4 <_pipeisclosed+0x54>
+  8041c9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8041cc:	75 cf                	jne    80419d <_pipeisclosed+0xd>
+  8041ce:	8b 42 58             	mov    0x58(%edx),%eax
+  8041d1:	6a 01                	push   $0x1
+  8041d3:	50                   	push   %eax
+  8041d4:	53                   	push   %ebx
+  8041d5:	68 42 54 80 00       	push   $0x805442
+  8041da:	e8 b7 c9 ff ff       	call   800b96 <cprintf>
+  8041df:	83 c4 10             	add    $0x10,%esp
+  8041e2:	eb b9                	jmp    80419d <_pipeisclosed+0xd>
+  8041e4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8041e7:	0f 94 c0             	sete   %al
+  8041ea:	0f b6 c0             	movzbl %al,%eax
+  8041ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041f0:	5b                   	pop    %ebx
+  8041f1:	5e                   	pop    %esi
+  8041f2:	5f                   	pop    %edi
+  8041f3:	5d                   	pop    %ebp
+  8041f4:	c3                   	ret
+
+008041f5 <devpipe_write>:
+  8041f5:	55                   	push   %ebp
+  8041f6:	89 e5                	mov    %esp,%ebp
+  8041f8:	57                   	push   %edi
+  8041f9:	56                   	push   %esi
+  8041fa:	53                   	push   %ebx
+  8041fb:	83 ec 28             	sub    $0x28,%esp
+  8041fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  804201:	56                   	push   %esi
+  804202:	e8 d4 e4 ff ff       	call   8026db <fd2data>
+  804207:	89 c3                	mov    %eax,%ebx
+  804209:	83 c4 10             	add    $0x10,%esp
+  80420c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804211:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804215:	74 5c                	je     804273 <devpipe_write+0x7e>
+  804217:	8b 43 04             	mov    0x4(%ebx),%eax
+  80421a:	8b 0b                	mov    (%ebx),%ecx
+  80421c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80421f:	39 d0                	cmp    %edx,%eax
+  804221:	72 1e                	jb     804241 <devpipe_write+0x4c>
+  804223:	89 da                	mov    %ebx,%edx
+  804225:	89 f0                	mov    %esi,%eax
+  804227:	e8 64 ff ff ff       	call   804190 <_pipeisclosed>
+  80422c:	85 c0                	test   %eax,%eax
+  80422e:	75 48                	jne    804278 <devpipe_write+0x83>
+  804230:	e8 5d d5 ff ff       	call   801792 <sys_yield>
+  804235:	8b 43 04             	mov    0x4(%ebx),%eax
+  804238:	8b 0b                	mov    (%ebx),%ecx
+  80423a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80423d:	39 d0                	cmp    %edx,%eax
+  80423f:	73 e2                	jae    804223 <devpipe_write+0x2e>
+  804241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804244:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  804248:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80424b:	89 c2                	mov    %eax,%edx
+  80424d:	c1 fa 1f             	sar    $0x1f,%edx
+  804250:	89 d1                	mov    %edx,%ecx
+  804252:	c1 e9 1b             	shr    $0x1b,%ecx
+  804255:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  804258:	83 e2 1f             	and    $0x1f,%edx
+  80425b:	29 ca                	sub    %ecx,%edx
+  80425d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  804261:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  804265:	83 c0 01             	add    $0x1,%eax
+  804268:	89 43 04             	mov    %eax,0x4(%ebx)
+  80426b:	83 c7 01             	add    $0x1,%edi
+  80426e:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  804271:	75 a4                	jne    804217 <devpipe_write+0x22>
+  804273:	8b 45 10             	mov    0x10(%ebp),%eax
+  804276:	eb 05                	jmp    80427d <devpipe_write+0x88>
+  804278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804280:	5b                   	pop    %ebx
+  804281:	5e                   	pop    %esi
+  804282:	5f                   	pop    %edi
+  804283:	5d                   	pop    %ebp
+  804284:	c3                   	ret
+
+00804285 <devpipe_read>:
+  804285:	55                   	push   %ebp
+  804286:	89 e5                	mov    %esp,%ebp
+  804288:	57                   	push   %edi
+  804289:	56                   	push   %esi
+  80428a:	53                   	push   %ebx
+  80428b:	83 ec 18             	sub    $0x18,%esp
+  80428e:	8b 75 08             	mov    0x8(%ebp),%esi
+  804291:	56                   	push   %esi
+  804292:	e8 44 e4 ff ff       	call   8026db <fd2data>
+  804297:	89 c3                	mov    %eax,%ebx
+  804299:	83 c4 10             	add    $0x10,%esp
+  80429c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042a1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8042a5:	74 45                	je     8042ec <devpipe_read+0x67>
+  8042a7:	8b 03                	mov    (%ebx),%eax
+  8042a9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8042ac:	75 1d                	jne    8042cb <devpipe_read+0x46>
+  8042ae:	85 ff                	test   %edi,%edi
+  8042b0:	75 3f                	jne    8042f1 <devpipe_read+0x6c>
+  8042b2:	89 da                	mov    %ebx,%edx
+  8042b4:	89 f0                	mov    %esi,%eax
+  8042b6:	e8 d5 fe ff ff       	call   804190 <_pipeisclosed>
+  8042bb:	85 c0                	test   %eax,%eax
+  8042bd:	75 3c                	jne    8042fb <devpipe_read+0x76>
+  8042bf:	e8 ce d4 ff ff       	call   801792 <sys_yield>
+  8042c4:	8b 03                	mov    (%ebx),%eax
+  8042c6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8042c9:	74 e7                	je     8042b2 <devpipe_read+0x2d>
+  8042cb:	99                   	cltd
+  8042cc:	c1 ea 1b             	shr    $0x1b,%edx
+  8042cf:	01 d0                	add    %edx,%eax
+  8042d1:	83 e0 1f             	and    $0x1f,%eax
+  8042d4:	29 d0                	sub    %edx,%eax
+  8042d6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8042db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8042de:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8042e1:	83 03 01             	addl   $0x1,(%ebx)
+  8042e4:	83 c7 01             	add    $0x1,%edi
+  8042e7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8042ea:	75 bb                	jne    8042a7 <devpipe_read+0x22>
+  8042ec:	8b 45 10             	mov    0x10(%ebp),%eax
+  8042ef:	eb 02                	jmp    8042f3 <devpipe_read+0x6e>
+  8042f1:	89 f8                	mov    %edi,%eax
+  8042f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042f6:	5b                   	pop    %ebx
+  8042f7:	5e                   	pop    %esi
+  8042f8:	5f                   	pop    %edi
+  8042f9:	5d                   	pop    %ebp
+  8042fa:	c3                   	ret
+  8042fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804300:	eb f1                	jmp    8042f3 <devpipe_read+0x6e>
+
+00804302 <pipe>:
+  804302:	55                   	push   %ebp
+  804303:	89 e5                	mov    %esp,%ebp
+  804305:	56                   	push   %esi
+  804306:	53                   	push   %ebx
+  804307:	83 ec 1c             	sub    $0x1c,%esp
+  80430a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80430d:	50                   	push   %eax
+  80430e:	e8 df e3 ff ff       	call   8026f2 <fd_alloc>
+  804313:	89 c3                	mov    %eax,%ebx
+  804315:	83 c4 10             	add    $0x10,%esp
+  804318:	85 c0                	test   %eax,%eax
+  80431a:	0f 88 23 01 00 00    	js     804443 <pipe+0x141>
+  804320:	83 ec 04             	sub    $0x4,%esp
+  804323:	68 07 04 00 00       	push   $0x407
+  804328:	ff 75 f4             	push   -0xc(%ebp)
+  80432b:	6a 00                	push   $0x0
+  80432d:	e8 ab d4 ff ff       	call   8017dd <sys_page_alloc>
+  804332:	89 c3                	mov    %eax,%ebx
+  804334:	83 c4 10             	add    $0x10,%esp
+  804337:	85 c0                	test   %eax,%eax
+  804339:	0f 88 04 01 00 00    	js     804443 <pipe+0x141>
+  80433f:	83 ec 0c             	sub    $0xc,%esp
+  804342:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804345:	50                   	push   %eax
+  804346:	e8 a7 e3 ff ff       	call   8026f2 <fd_alloc>
+  80434b:	89 c3                	mov    %eax,%ebx
+  80434d:	83 c4 10             	add    $0x10,%esp
+  804350:	85 c0                	test   %eax,%eax
+  804352:	0f 88 db 00 00 00    	js     804433 <pipe+0x131>
+  804358:	83 ec 04             	sub    $0x4,%esp
+  80435b:	68 07 04 00 00       	push   $0x407
+  804360:	ff 75 f0             	push   -0x10(%ebp)
+  804363:	6a 00                	push   $0x0
+  804365:	e8 73 d4 ff ff       	call   8017dd <sys_page_alloc>
+  80436a:	89 c3                	mov    %eax,%ebx
+  80436c:	83 c4 10             	add    $0x10,%esp
+  80436f:	85 c0                	test   %eax,%eax
+  804371:	0f 88 bc 00 00 00    	js     804433 <pipe+0x131>
+  804377:	83 ec 0c             	sub    $0xc,%esp
+  80437a:	ff 75 f4             	push   -0xc(%ebp)
+  80437d:	e8 59 e3 ff ff       	call   8026db <fd2data>
+  804382:	89 c6                	mov    %eax,%esi
+  804384:	83 c4 0c             	add    $0xc,%esp
+  804387:	68 07 04 00 00       	push   $0x407
+  80438c:	50                   	push   %eax
+  80438d:	6a 00                	push   $0x0
+  80438f:	e8 49 d4 ff ff       	call   8017dd <sys_page_alloc>
+  804394:	89 c3                	mov    %eax,%ebx
+  804396:	83 c4 10             	add    $0x10,%esp
+  804399:	85 c0                	test   %eax,%eax
+  80439b:	0f 88 82 00 00 00    	js     804423 <pipe+0x121>
+  8043a1:	83 ec 0c             	sub    $0xc,%esp
+  8043a4:	ff 75 f0             	push   -0x10(%ebp)
+  8043a7:	e8 2f e3 ff ff       	call   8026db <fd2data>
+  8043ac:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8043b3:	50                   	push   %eax
+  8043b4:	6a 00                	push   $0x0
+  8043b6:	56                   	push   %esi
+  8043b7:	6a 00                	push   $0x0
+  8043b9:	e8 62 d4 ff ff       	call   801820 <sys_page_map>
+  8043be:	89 c3                	mov    %eax,%ebx
+  8043c0:	83 c4 20             	add    $0x20,%esp
+  8043c3:	85 c0                	test   %eax,%eax
+  8043c5:	78 4e                	js     804415 <pipe+0x113>
+  8043c7:	a1 58 60 80 00       	mov    0x806058,%eax
+  8043cc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8043cf:	89 02                	mov    %eax,(%edx)
+  8043d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8043d4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8043db:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8043de:	89 02                	mov    %eax,(%edx)
+  8043e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8043e3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8043ea:	83 ec 0c             	sub    $0xc,%esp
+  8043ed:	ff 75 f4             	push   -0xc(%ebp)
+  8043f0:	e8 d6 e2 ff ff       	call   8026cb <fd2num>
+  8043f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8043f8:	89 01                	mov    %eax,(%ecx)
+  8043fa:	83 c4 04             	add    $0x4,%esp
+  8043fd:	ff 75 f0             	push   -0x10(%ebp)
+  804400:	e8 c6 e2 ff ff       	call   8026cb <fd2num>
+  804405:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804408:	89 41 04             	mov    %eax,0x4(%ecx)
+  80440b:	83 c4 10             	add    $0x10,%esp
+  80440e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804413:	eb 2e                	jmp    804443 <pipe+0x141>
+  804415:	83 ec 08             	sub    $0x8,%esp
+  804418:	56                   	push   %esi
+  804419:	6a 00                	push   $0x0
+  80441b:	e8 8f d4 ff ff       	call   8018af <sys_page_unmap>
+  804420:	83 c4 10             	add    $0x10,%esp
+  804423:	83 ec 08             	sub    $0x8,%esp
+  804426:	ff 75 f0             	push   -0x10(%ebp)
+  804429:	6a 00                	push   $0x0
+  80442b:	e8 7f d4 ff ff       	call   8018af <sys_page_unmap>
+  804430:	83 c4 10             	add    $0x10,%esp
+  804433:	83 ec 08             	sub    $0x8,%esp
+  804436:	ff 75 f4             	push   -0xc(%ebp)
+  804439:	6a 00                	push   $0x0
+  80443b:	e8 6f d4 ff ff       	call   8018af <sys_page_unmap>
+  804440:	83 c4 10             	add    $0x10,%esp
+  804443:	89 d8                	mov    %ebx,%eax
+  804445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804448:	5b                   	pop    %ebx
+  804449:	5e                   	pop    %esi
+  80444a:	5d                   	pop    %ebp
+  80444b:	c3                   	ret
+
+0080444c <pipeisclosed>:
+  80444c:	55                   	push   %ebp
+  80444d:	89 e5                	mov    %esp,%ebp
+  80444f:	83 ec 20             	sub    $0x20,%esp
+  804452:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804455:	50                   	push   %eax
+  804456:	ff 75 08             	push   0x8(%ebp)
+  804459:	e8 e4 e2 ff ff       	call   802742 <fd_lookup>
+  80445e:	83 c4 10             	add    $0x10,%esp
+  804461:	85 c0                	test   %eax,%eax
+  804463:	78 18                	js     80447d <pipeisclosed+0x31>
+  804465:	83 ec 0c             	sub    $0xc,%esp
+  804468:	ff 75 f4             	push   -0xc(%ebp)
+  80446b:	e8 6b e2 ff ff       	call   8026db <fd2data>
+  804470:	89 c2                	mov    %eax,%edx
+  804472:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804475:	e8 16 fd ff ff       	call   804190 <_pipeisclosed>
+  80447a:	83 c4 10             	add    $0x10,%esp
+  80447d:	c9                   	leave
+  80447e:	c3                   	ret
+
+0080447f <wait>:
+  80447f:	55                   	push   %ebp
+  804480:	89 e5                	mov    %esp,%ebp
+  804482:	56                   	push   %esi
+  804483:	53                   	push   %ebx
+  804484:	8b 75 08             	mov    0x8(%ebp),%esi
+  804487:	85 f6                	test   %esi,%esi
+  804489:	74 40                	je     8044cb <wait+0x4c>
+  80448b:	89 f3                	mov    %esi,%ebx
+  80448d:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  804493:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  804499:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80449e:	8b 40 48             	mov    0x48(%eax),%eax
+  8044a1:	39 c6                	cmp    %eax,%esi
+  8044a3:	75 1f                	jne    8044c4 <wait+0x45>
+  8044a5:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  8044ab:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8044b1:	8b 43 54             	mov    0x54(%ebx),%eax
+  8044b4:	85 c0                	test   %eax,%eax
+  8044b6:	74 0c                	je     8044c4 <wait+0x45>
+  8044b8:	e8 d5 d2 ff ff       	call   801792 <sys_yield>
+  8044bd:	8b 43 48             	mov    0x48(%ebx),%eax
+  8044c0:	39 f0                	cmp    %esi,%eax
+  8044c2:	74 ed                	je     8044b1 <wait+0x32>
+  8044c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044c7:	5b                   	pop    %ebx
+  8044c8:	5e                   	pop    %esi
+  8044c9:	5d                   	pop    %ebp
+  8044ca:	c3                   	ret
+  8044cb:	68 5a 54 80 00       	push   $0x80545a
+  8044d0:	68 8f 4d 80 00       	push   $0x804d8f
+  8044d5:	6a 09                	push   $0x9
+  8044d7:	68 65 54 80 00       	push   $0x805465
+  8044dc:	e8 da c5 ff ff       	call   800abb <_panic>
+
+008044e1 <ipcring_init>:
+  8044e1:	55                   	push   %ebp
+  8044e2:	89 e5                	mov    %esp,%ebp
+  8044e4:	53                   	push   %ebx
+  8044e5:	83 ec 08             	sub    $0x8,%esp
+  8044e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8044eb:	6a 60                	push   $0x60
+  8044ed:	6a 00                	push   $0x0
+  8044ef:	53                   	push   %ebx
+  8044f0:	e8 03 d0 ff ff       	call   8014f8 <memset>
+  8044f5:	a1 34 74 80 00       	mov    0x807434,%eax
+  8044fa:	8b 40 48             	mov    0x48(%eax),%eax
+  8044fd:	89 03                	mov    %eax,(%ebx)
+  8044ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804502:	89 43 04             	mov    %eax,0x4(%ebx)
+  804505:	8b 45 10             	mov    0x10(%ebp),%eax
+  804508:	89 43 08             	mov    %eax,0x8(%ebx)
+  80450b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80450e:	89 43 0c             	mov    %eax,0xc(%ebx)
+  804511:	83 c4 10             	add    $0x10,%esp
+  804514:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804517:	c9                   	leave
+  804518:	c3                   	ret
+
+00804519 <ipcring_req_slot>:
+  804519:	55                   	push   %ebp
+  80451a:	89 e5                	mov    %esp,%ebp
+  80451c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80451f:	8b 50 10             	mov    0x10(%eax),%edx
+  804522:	8b 48 18             	mov    0x18(%eax),%ecx
+  804525:	29 ca                	sub    %ecx,%edx
+  804527:	83 fa 07             	cmp    $0x7,%edx
+  80452a:	77 0c                	ja     804538 <ipcring_req_slot+0x1f>
+  80452c:	8b 50 10             	mov    0x10(%eax),%edx
+  80452f:	83 e2 07             	and    $0x7,%edx
+  804532:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  804536:	5d                   	pop    %ebp
+  804537:	c3                   	ret
+  804538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80453d:	eb f7                	jmp    804536 <ipcring_req_slot+0x1d>
+
+0080453f <ipcring_req_push>:
+  80453f:	55                   	push   %ebp
+  804540:	89 e5                	mov    %esp,%ebp
+  804542:	83 ec 08             	sub    $0x8,%esp
+  804545:	8b 55 08             	mov    0x8(%ebp),%edx
+  804548:	8b 42 10             	mov    0x10(%edx),%eax
+  80454b:	83 c0 01             	add    $0x1,%eax
+  80454e:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  804552:	b8 00 00 00 00       	mov    $0x0,%eax
+  804557:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80455b:	85 c0                	test   %eax,%eax
+  80455d:	75 02                	jne    804561 <ipcring_req_push+0x22>
+  80455f:	c9                   	leave
+  804560:	c3                   	ret
+  804561:	6a 00                	push   $0x0
+  804563:	68 00 00 80 ee       	push   $0xee800000
+  804568:	ff 72 08             	push   0x8(%edx)
+  80456b:	ff 72 04             	push   0x4(%edx)
+  80456e:	e8 a2 d5 ff ff       	call   801b15 <sys_ipc_send>
+  804573:	83 c4 10             	add    $0x10,%esp
+  804576:	eb e7                	jmp    80455f <ipcring_req_push+0x20>
+
+00804578 <ipcring_rsp_wait>:
+  804578:	55                   	push   %ebp
+  804579:	89 e5                	mov    %esp,%ebp
+  80457b:	53                   	push   %ebx
+  80457c:	83 ec 04             	sub    $0x4,%esp
+  80457f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804582:	8b 53 18             	mov    0x18(%ebx),%edx
+  804585:	8b 43 10             	mov    0x10(%ebx),%eax
+  804588:	39 c2                	cmp    %eax,%edx
+  80458a:	74 3c                	je     8045c8 <ipcring_rsp_wait+0x50>
+  80458c:	8b 53 14             	mov    0x14(%ebx),%edx
+  80458f:	8b 43 18             	mov    0x18(%ebx),%eax
+  804592:	39 c2                	cmp    %eax,%edx
+  804594:	75 23                	jne    8045b9 <ipcring_rsp_wait+0x41>
+  804596:	83 ec 08             	sub    $0x8,%esp
+  804599:	6a 00                	push   $0x0
+  80459b:	6a 00                	push   $0x0
+  80459d:	6a 00                	push   $0x0
+  80459f:	6a 00                	push   $0x0
+  8045a1:	ff 73 0c             	push   0xc(%ebx)
+  8045a4:	ff 73 04             	push   0x4(%ebx)
+  8045a7:	e8 9b 02 00 00       	call   804847 <ipc_call>
+  8045ac:	8b 53 14             	mov    0x14(%ebx),%edx
+  8045af:	8b 43 18             	mov    0x18(%ebx),%eax
+  8045b2:	83 c4 20             	add    $0x20,%esp
+  8045b5:	39 c2                	cmp    %eax,%edx
+  8045b7:	74 dd                	je     804596 <ipcring_rsp_wait+0x1e>
+  8045b9:	8b 43 18             	mov    0x18(%ebx),%eax
+  8045bc:	83 e0 07             	and    $0x7,%eax
+  8045bf:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8045c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8045c6:	c9                   	leave
+  8045c7:	c3                   	ret
+  8045c8:	68 70 54 80 00       	push   $0x805470
+  8045cd:	68 8f 4d 80 00       	push   $0x804d8f
+  8045d2:	6a 3b                	push   $0x3b
+  8045d4:	68 91 54 80 00       	push   $0x805491
+  8045d9:	e8 dd c4 ff ff       	call   800abb <_panic>
+
+008045de <ipcring_rsp_pop>:
+  8045de:	55                   	push   %ebp
+  8045df:	89 e5                	mov    %esp,%ebp
+  8045e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8045e4:	8b 42 18             	mov    0x18(%edx),%eax
+  8045e7:	83 c0 01             	add    $0x1,%eax
+  8045ea:	89 42 18             	mov    %eax,0x18(%edx)
+  8045ed:	5d                   	pop    %ebp
+  8045ee:	c3                   	ret
+
+008045ef <ipcring_server_init>:
+  8045ef:	55                   	push   %ebp
+  8045f0:	89 e5                	mov    %esp,%ebp
+  8045f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8045f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8045f8:	89 10                	mov    %edx,(%eax)
+  8045fa:	8b 55 10             	mov    0x10(%ebp),%edx
+  8045fd:	89 50 04             	mov    %edx,0x4(%eax)
+  804600:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  804607:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80460e:	5d                   	pop    %ebp
+  80460f:	c3                   	ret
+
+00804610 <ipcring_req_avail>:
+  804610:	55                   	push   %ebp
+  804611:	89 e5                	mov    %esp,%ebp
+  804613:	8b 55 08             	mov    0x8(%ebp),%edx
+  804616:	8b 02                	mov    (%edx),%eax
+  804618:	8b 40 10             	mov    0x10(%eax),%eax
+  80461b:	2b 42 08             	sub    0x8(%edx),%eax
+  80461e:	ba 08 00 00 00       	mov    $0x8,%edx
+  804623:	39 d0                	cmp    %edx,%eax
+  804625:	0f 47 c2             	cmova  %edx,%eax
+  804628:	5d                   	pop    %ebp
+  804629:	c3                   	ret
+
+0080462a <ipcring_req_peek>:
+  80462a:	55                   	push   %ebp
+  80462b:	89 e5                	mov    %esp,%ebp
+  80462d:	8b 55 08             	mov    0x8(%ebp),%edx
+  804630:	8b 42 08             	mov    0x8(%edx),%eax
+  804633:	83 e0 07             	and    $0x7,%eax
+  804636:	8b 12                	mov    (%edx),%edx
+  804638:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80463c:	5d                   	pop    %ebp
+  80463d:	c3                   	ret
+
+0080463e <ipcring_rsp_push>:
+  80463e:	55                   	push   %ebp
+  80463f:	89 e5                	mov    %esp,%ebp
+  804641:	83 ec 08             	sub    $0x8,%esp
+  804644:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804647:	8b 41 08             	mov    0x8(%ecx),%eax
+  80464a:	83 c0 01             	add    $0x1,%eax
+  80464d:	89 41 08             	mov    %eax,0x8(%ecx)
+  804650:	8b 11                	mov    (%ecx),%edx
+  804652:	83 c2 14             	add    $0x14,%edx
+  804655:	f0 87 02             	lock xchg %eax,(%edx)
+  804658:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80465c:	75 02                	jne    804660 <ipcring_rsp_push+0x22>
+  80465e:	c9                   	leave
+  80465f:	c3                   	ret
+  804660:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  804667:	6a 00                	push   $0x0
+  804669:	68 00 00 80 ee       	push   $0xee800000
+  80466e:	6a 00                	push   $0x0
+  804670:	ff 71 04             	push   0x4(%ecx)
+  804673:	e8 c0 d3 ff ff       	call   801a38 <sys_ipc_try_send>
+  804678:	83 c4 10             	add    $0x10,%esp
+  80467b:	eb e1                	jmp    80465e <ipcring_rsp_push+0x20>
+
+0080467d <ipcring_client_wait>:
+  80467d:	55                   	push   %ebp
+  80467e:	89 e5                	mov    %esp,%ebp
+  804680:	83 ec 08             	sub    $0x8,%esp
+  804683:	8b 45 08             	mov    0x8(%ebp),%eax
+  804686:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  80468d:	8b 10                	mov    (%eax),%edx
+  80468f:	8b 52 18             	mov    0x18(%edx),%edx
+  804692:	3b 50 08             	cmp    0x8(%eax),%edx
+  804695:	75 02                	jne    804699 <ipcring_client_wait+0x1c>
+  804697:	c9                   	leave
+  804698:	c3                   	ret
+  804699:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8046a0:	6a 00                	push   $0x0
+  8046a2:	68 00 00 80 ee       	push   $0xee800000
+  8046a7:	6a 00                	push   $0x0
+  8046a9:	ff 70 04             	push   0x4(%eax)
+  8046ac:	e8 87 d3 ff ff       	call   801a38 <sys_ipc_try_send>
+  8046b1:	83 c4 10             	add    $0x10,%esp
+  8046b4:	eb e1                	jmp    804697 <ipcring_client_wait+0x1a>
+
+008046b6 <ipcring_server_sleep>:
+  8046b6:	55                   	push   %ebp
+  8046b7:	89 e5                	mov    %esp,%ebp
+  8046b9:	53                   	push   %ebx
+  8046ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8046bd:	8b 01                	mov    (%ecx),%eax
+  8046bf:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8046c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8046c7:	f0 87 02             	lock xchg %eax,(%edx)
+  8046ca:	8b 11                	mov    (%ecx),%edx
+  8046cc:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8046cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8046d4:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8046d7:	74 0e                	je     8046e7 <ipcring_server_sleep+0x31>
+  8046d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046de:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8046e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8046ea:	c9                   	leave
+  8046eb:	c3                   	ret
+
+008046ec <set_pgfault_handler>:
+  8046ec:	55                   	push   %ebp
+  8046ed:	89 e5                	mov    %esp,%ebp
+  8046ef:	53                   	push   %ebx
+  8046f0:	83 ec 04             	sub    $0x4,%esp
+  8046f3:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8046fa:	74 0d                	je     804709 <set_pgfault_handler+0x1d>
+  8046fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046ff:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  804704:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804707:	c9                   	leave
+  804708:	c3                   	ret
+  804709:	e8 65 d0 ff ff       	call   801773 <sys_getenvid>
+  80470e:	89 c3                	mov    %eax,%ebx
+  804710:	83 ec 04             	sub    $0x4,%esp
+  804713:	6a 07                	push   $0x7
+  804715:	68 00 f0 7f ee       	push   $0xee7ff000
+  80471a:	50                   	push   %eax
+  80471b:	e8 bd d0 ff ff       	call   8017dd <sys_page_alloc>
+  804720:	83 c4 10             	add    $0x10,%esp
+  804723:	85 c0                	test   %eax,%eax
+  804725:	78 29                	js     804750 <set_pgfault_handler+0x64>
+  804727:	83 ec 08             	sub    $0x8,%esp
+  80472a:	68 64 47 80 00       	push   $0x804764
+  80472f:	53                   	push   %ebx
+  804730:	e8 c1 d2 ff ff       	call   8019f6 <sys_env_set_pgfault_upcall>
+  804735:	83 c4 10             	add    $0x10,%esp
+  804738:	85 c0                	test   %eax,%eax
+  80473a:	79 c0                	jns    8046fc <set_pgfault_handler+0x10>
+  80473c:	83 ec 04             	sub    $0x4,%esp
+  80473f:	68 d8 54 80 00       	push   $0x8054d8
+  804744:	6a 27                	push   $0x27
+  804746:	68 0a 55 80 00       	push   $0x80550a
+  80474b:	e8 6b c3 ff ff       	call   800abb <_panic>
+  804750:	83 ec 04             	sub    $0x4,%esp
+  804753:	68 a0 54 80 00       	push   $0x8054a0
+  804758:	6a 23                	push   $0x23
+  80475a:	68 0a 55 80 00       	push   $0x80550a
+  80475f:	e8 57 c3 ff ff       	call   800abb <_panic>
+
+00804764 <_pgfault_upcall>:
+  804764:	54                   	push   %esp
+  804765:	a1 00 a0 80 00       	mov    0x80a000,%eax
+  80476a:	ff d0                	call   *%eax
+  80476c:	83 c4 04             	add    $0x4,%esp
+  80476f:	89 e3                	mov    %esp,%ebx
+  804771:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804775:	8b 54 24 30          	mov    0x30(%esp),%edx
+  804779:	89 d4                	mov    %edx,%esp
+  80477b:	51                   	push   %ecx
+  80477c:	89 dc                	mov    %ebx,%esp
+  80477e:	83 ea 04             	sub    $0x4,%edx
+  804781:	89 54 24 30          	mov    %edx,0x30(%esp)
+  804785:	83 c4 08             	add    $0x8,%esp
+  804788:	61                   	popa
+  804789:	83 c4 04             	add    $0x4,%esp
+  80478c:	9d                   	popf
+  80478d:	5c                   	pop    %esp
+  80478e:	c3                   	ret
+
+0080478f <ipc_recv>:
+  80478f:	55                   	push   %ebp
+  804790:	89 e5                	mov    %esp,%ebp
+  804792:	56                   	push   %esi
+  804793:	53                   	push   %ebx
+  804794:	8b 75 08             	mov    0x8(%ebp),%esi
+  804797:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80479a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80479d:	85 c0                	test   %eax,%eax
+  80479f:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  8047a4:	0f 44 c2             	cmove  %edx,%eax
+  8047a7:	83 ec 0c             	sub    $0xc,%esp
+  8047aa:	50                   	push   %eax
+  8047ab:	e8 d8 d2 ff ff       	call   801a88 <sys_ipc_recv>
+  8047b0:	83 c4 10             	add    $0x10,%esp
+  8047b3:	85 c0                	test   %eax,%eax
+  8047b5:	78 2a                	js     8047e1 <ipc_recv+0x52>
+  8047b7:	a1 34 74 80 00       	mov    0x807434,%eax
+  8047bc:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8047c2:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8047c8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8047ce:	85 f6                	test   %esi,%esi
+  8047d0:	74 02                	je     8047d4 <ipc_recv+0x45>
+  8047d2:	89 0e                	mov    %ecx,(%esi)
+  8047d4:	85 db                	test   %ebx,%ebx
+  8047d6:	74 02                	je     8047da <ipc_recv+0x4b>
+  8047d8:	89 13                	mov    %edx,(%ebx)
+  8047da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8047dd:	5b                   	pop    %ebx
+  8047de:	5e                   	pop    %esi
+  8047df:	5d                   	pop    %ebp
+  8047e0:	c3                   	ret
+  8047e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8047eb:	eb e1                	jmp    8047ce <ipc_recv+0x3f>
+
+008047ed <ipc_send>:
+  8047ed:	55                   	push   %ebp
+  8047ee:	89 e5                	mov    %esp,%ebp
+  8047f0:	57                   	push   %edi
+  8047f1:	56                   	push   %esi
+  8047f2:	53                   	push   %ebx
+  8047f3:	83 ec 0c             	sub    $0xc,%esp
+  8047f6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8047f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8047fc:	8b 75 14             	mov    0x14(%ebp),%esi
+  8047ff:	85 db                	test   %ebx,%ebx
+  804801:	74 1e                	je     804821 <ipc_send+0x34>
+  804803:	56                   	push   %esi
+  804804:	53                   	push   %ebx
+  804805:	57                   	push   %edi
+  804806:	ff 75 08             	push   0x8(%ebp)
+  804809:	e8 07 d3 ff ff       	call   801b15 <sys_ipc_send>
+  80480e:	83 c4 10             	add    $0x10,%esp
+  804811:	85 c0                	test   %eax,%eax
+  804813:	74 2a                	je     80483f <ipc_send+0x52>
+  804815:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804818:	75 13                	jne    80482d <ipc_send+0x40>
+  80481a:	e8 73 cf ff ff       	call   801792 <sys_yield>
+  80481f:	eb e2                	jmp    804803 <ipc_send+0x16>
+  804821:	be 00 00 00 00       	mov    $0x0,%esi
+  804826:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80482b:	eb d6                	jmp    804803 <ipc_send+0x16>
+  80482d:	50                   	push   %eax
+  80482e:	68 18 55 80 00       	push   $0x805518
+  804833:	6a 4f                	push   $0x4f
+  804835:	68 5b 55 80 00       	push   $0x80555b
+  80483a:	e8 7c c2 ff ff       	call   800abb <_panic>
+  80483f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804842:	5b                   	pop    %ebx
+  804843:	5e                   	pop    %esi
+  804844:	5f                   	pop    %edi
+  804845:	5d                   	pop    %ebp
+  804846:	c3                   	ret
+
+00804847 <ipc_call>:
+  804847:	55                   	push   %ebp
+  804848:	89 e5                	mov    %esp,%ebp
+  80484a:	57                   	push   %edi
+  80484b:	56                   	push   %esi
+  80484c:	53                   	push   %ebx
+  80484d:	83 ec 0c             	sub    $0xc,%esp
+  804850:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804854:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  804859:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  80485d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  804861:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  804866:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80486a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80486e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804873:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  804877:	eb 05                	jmp    80487e <ipc_call+0x37>
+  804879:	e8 14 cf ff ff       	call   801792 <sys_yield>
+  80487e:	83 ec 0c             	sub    $0xc,%esp
+  804881:	56                   	push   %esi
+  804882:	53                   	push   %ebx
+  804883:	57                   	push   %edi
+  804884:	ff 75 0c             	push   0xc(%ebp)
+  804887:	ff 75 08             	push   0x8(%ebp)
+  80488a:	e8 d6 d2 ff ff       	call   801b65 <sys_ipc_call>
+  80488f:	83 c4 20             	add    $0x20,%esp
+  804892:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804895:	74 e2                	je     804879 <ipc_call+0x32>
+  804897:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80489a:	74 2d                	je     8048c9 <ipc_call+0x82>
+  80489c:	85 c0                	test   %eax,%eax
+  80489e:	78 4f                	js     8048ef <ipc_call+0xa8>
+  8048a0:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8048a4:	74 10                	je     8048b6 <ipc_call+0x6f>
+  8048a6:	a1 34 74 80 00       	mov    0x807434,%eax
+  8048ab:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8048b1:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8048b4:	89 02                	mov    %eax,(%edx)
+  8048b6:	a1 34 74 80 00       	mov    0x807434,%eax
+  8048bb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8048c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048c4:	5b                   	pop    %ebx
+  8048c5:	5e                   	pop    %esi
+  8048c6:	5f                   	pop    %edi
+  8048c7:	5d                   	pop    %ebp
+  8048c8:	c3                   	ret
+  8048c9:	ff 75 14             	push   0x14(%ebp)
+  8048cc:	ff 75 10             	push   0x10(%ebp)
+  8048cf:	ff 75 0c             	push   0xc(%ebp)
+  8048d2:	ff 75 08             	push   0x8(%ebp)
+  8048d5:	e8 13 ff ff ff       	call   8047ed <ipc_send>
+  8048da:	83 c4 0c             	add    $0xc,%esp
+  8048dd:	ff 75 1c             	push   0x1c(%ebp)
+  8048e0:	ff 75 18             	push   0x18(%ebp)
+  8048e3:	6a 00                	push   $0x0
+  8048e5:	e8 a5 fe ff ff       	call   80478f <ipc_recv>
+  8048ea:	83 c4 10             	add    $0x10,%esp
+  8048ed:	eb d2                	jmp    8048c1 <ipc_call+0x7a>
+  8048ef:	50                   	push   %eax
+  8048f0:	68 65 55 80 00       	push   $0x805565
+  8048f5:	6a 6d                	push   $0x6d
+  8048f7:	68 5b 55 80 00       	push   $0x80555b
+  8048fc:	e8 ba c1 ff ff       	call   800abb <_panic>
+
+00804901 <ipc_reply_recv>:
+  804901:	55                   	push   %ebp
+  804902:	89 e5                	mov    %esp,%ebp
+  804904:	57                   	push   %edi
+  804905:	56                   	push   %esi
+  804906:	53                   	push   %ebx
+  804907:	83 ec 0c             	sub    $0xc,%esp
+  80490a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80490d:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  804910:	8b 7d 20             	mov    0x20(%ebp),%edi
+  804913:	85 db                	test   %ebx,%ebx
+  804915:	0f 84 ac 00 00 00    	je     8049c7 <ipc_reply_recv+0xc6>
+  80491b:	85 f6                	test   %esi,%esi
+  80491d:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  804922:	0f 45 c6             	cmovne %esi,%eax
+  804925:	83 ec 0c             	sub    $0xc,%esp
+  804928:	50                   	push   %eax
+  804929:	ff 75 14             	push   0x14(%ebp)
+  80492c:	53                   	push   %ebx
+  80492d:	ff 75 0c             	push   0xc(%ebp)
+  804930:	ff 75 08             	push   0x8(%ebp)
+  804933:	e8 4e d2 ff ff       	call   801b86 <sys_ipc_reply_recv>
+  804938:	83 c4 20             	add    $0x20,%esp
+  80493b:	85 c0                	test   %eax,%eax
+  80493d:	78 3a                	js     804979 <ipc_reply_recv+0x78>
+  80493f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  804943:	74 10                	je     804955 <ipc_reply_recv+0x54>
+  804945:	a1 34 74 80 00       	mov    0x807434,%eax
+  80494a:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  804950:	8b 55 18             	mov    0x18(%ebp),%edx
+  804953:	89 02                	mov    %eax,(%edx)
+  804955:	85 ff                	test   %edi,%edi
+  804957:	74 0d                	je     804966 <ipc_reply_recv+0x65>
+  804959:	a1 34 74 80 00       	mov    0x807434,%eax
+  80495e:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  804964:	89 07                	mov    %eax,(%edi)
+  804966:	a1 34 74 80 00       	mov    0x807434,%eax
+  80496b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  804971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804974:	5b                   	pop    %ebx
+  804975:	5e                   	pop    %esi
+  804976:	5f                   	pop    %edi
+  804977:	5d                   	pop    %ebp
+  804978:	c3                   	ret
+  804979:	ff 75 14             	push   0x14(%ebp)
+  80497c:	53                   	push   %ebx
+  80497d:	ff 75 0c             	push   0xc(%ebp)
+  804980:	ff 75 08             	push   0x8(%ebp)
+  804983:	e8 b0 d0 ff ff       	call   801a38 <sys_ipc_try_send>
+  804988:	89 c2                	mov    %eax,%edx
+  80498a:	c1 ea 1f             	shr    $0x1f,%edx
+  80498d:	83 c4 10             	add    $0x10,%esp
+  804990:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  804993:	0f 95 c1             	setne  %cl
+  804996:	84 d1                	test   %dl,%cl
+  804998:	74 05                	je     80499f <ipc_reply_recv+0x9e>
+  80499a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80499d:	75 12                	jne    8049b1 <ipc_reply_recv+0xb0>
+  80499f:	83 ec 04             	sub    $0x4,%esp
+  8049a2:	57                   	push   %edi
+  8049a3:	56                   	push   %esi
+  8049a4:	ff 75 18             	push   0x18(%ebp)
+  8049a7:	e8 e3 fd ff ff       	call   80478f <ipc_recv>
+  8049ac:	83 c4 10             	add    $0x10,%esp
+  8049af:	eb c0                	jmp    804971 <ipc_reply_recv+0x70>
+  8049b1:	83 ec 04             	sub    $0x4,%esp
+  8049b4:	50                   	push   %eax
+  8049b5:	ff 75 08             	push   0x8(%ebp)
+  8049b8:	68 38 55 80 00       	push   $0x805538
+  8049bd:	e8 d4 c1 ff ff       	call   800b96 <cprintf>
+  8049c2:	83 c4 10             	add    $0x10,%esp
+  8049c5:	eb d8                	jmp    80499f <ipc_reply_recv+0x9e>
+  8049c7:	85 f6                	test   %esi,%esi
+  8049c9:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8049ce:	0f 45 c6             	cmovne %esi,%eax
+  8049d1:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8049d6:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8049dd:	e9 43 ff ff ff       	jmp    804925 <ipc_reply_recv+0x24>
+
+008049e2 <ipc_find_env>:
+  8049e2:	55                   	push   %ebp
+  8049e3:	89 e5                	mov    %esp,%ebp
+  8049e5:	83 ec 14             	sub    $0x14,%esp
+  8049e8:	ff 75 08             	push   0x8(%ebp)
+  8049eb:	e8 e6 cf ff ff       	call   8019d6 <sys_env_service>
+  8049f0:	85 c0                	test   %eax,%eax
+  8049f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f7:	0f 48 c2             	cmovs  %edx,%eax
+  8049fa:	c9                   	leave
+  8049fb:	c3                   	ret
+
+008049fc <pageref>:
+  8049fc:	55                   	push   %ebp
+  8049fd:	89 e5                	mov    %esp,%ebp
+  8049ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a02:	89 c2                	mov    %eax,%edx
+  804a04:	c1 ea 16             	shr    $0x16,%edx
+  804a07:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  804a0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a13:	f6 c1 01             	test   $0x1,%cl
+  804a16:	74 22                	je     804a3a <pageref+0x3e>
+  804a18:	c1 e8 0c             	shr    $0xc,%eax
+  804a1b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804a22:	a8 01                	test   $0x1,%al
+  804a24:	74 14                	je     804a3a <pageref+0x3e>
+  804a26:	c1 e8 0c             	shr    $0xc,%eax
+  804a29:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  804a2c:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  804a33:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  804a37:	0f b7 d2             	movzwl %dx,%edx
+  804a3a:	89 d0                	mov    %edx,%eax
+  804a3c:	5d                   	pop    %ebp
+  804a3d:	c3                   	ret
+
+00804a3e <__udivmoddi4>:
+  804a3e:	55                   	push   %ebp
+  804a3f:	57                   	push   %edi
+  804a40:	56                   	push   %esi
+  804a41:	53                   	push   %ebx
+  804a42:	83 ec 24             	sub    $0x24,%esp
+  804a45:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804a49:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804a4d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804a51:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804a55:	8b 44 24 40          	mov    0x40(%esp),%eax
+  804a59:	8b 54 24 44          	mov    0x44(%esp),%edx
+  804a5d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804a61:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804a65:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  804a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a73:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804a78:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804a7f:	00 
+  804a80:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804a87:	00 
+  804a88:	89 fb                	mov    %edi,%ebx
+  804a8a:	eb 08                	jmp    804a94 <__udivmoddi4+0x56>
+  804a8c:	83 e9 01             	sub    $0x1,%ecx
+  804a8f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804a92:	74 68                	je     804afc <__udivmoddi4+0xbe>
+  804a94:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804a98:	01 c0                	add    %eax,%eax
+  804a9a:	89 c6                	mov    %eax,%esi
+  804a9c:	89 d7                	mov    %edx,%edi
+  804a9e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804aa2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804aa6:	0f ad d0             	shrd   %cl,%edx,%eax
+  804aa9:	d3 ea                	shr    %cl,%edx
+  804aab:	f6 c1 20             	test   $0x20,%cl
+  804aae:	74 04                	je     804ab4 <__udivmoddi4+0x76>
+  804ab0:	89 d0                	mov    %edx,%eax
+  804ab2:	31 d2                	xor    %edx,%edx
+  804ab4:	83 e0 01             	and    $0x1,%eax
+  804ab7:	89 04 24             	mov    %eax,(%esp)
+  804aba:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804ac1:	00 
+  804ac2:	8b 04 24             	mov    (%esp),%eax
+  804ac5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804ac9:	09 f0                	or     %esi,%eax
+  804acb:	09 fa                	or     %edi,%edx
+  804acd:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804ad1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804ad5:	39 f0                	cmp    %esi,%eax
+  804ad7:	89 d5                	mov    %edx,%ebp
+  804ad9:	19 fd                	sbb    %edi,%ebp
+  804adb:	72 af                	jb     804a8c <__udivmoddi4+0x4e>
+  804add:	29 f0                	sub    %esi,%eax
+  804adf:	19 fa                	sbb    %edi,%edx
+  804ae1:	89 cf                	mov    %ecx,%edi
+  804ae3:	c1 ef 05             	shr    $0x5,%edi
+  804ae6:	83 e7 01             	and    $0x1,%edi
+  804ae9:	89 fe                	mov    %edi,%esi
+  804aeb:	83 f6 01             	xor    $0x1,%esi
+  804aee:	d3 e6                	shl    %cl,%esi
+  804af0:	d3 e7                	shl    %cl,%edi
+  804af2:	09 74 24 18          	or     %esi,0x18(%esp)
+  804af6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804afa:	eb 90                	jmp    804a8c <__udivmoddi4+0x4e>
+  804afc:	85 db                	test   %ebx,%ebx
+  804afe:	74 05                	je     804b05 <__udivmoddi4+0xc7>
+  804b00:	89 03                	mov    %eax,(%ebx)
+  804b02:	89 53 04             	mov    %edx,0x4(%ebx)
+  804b05:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b09:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b0d:	83 c4 24             	add    $0x24,%esp
+  804b10:	5b                   	pop    %ebx
+  804b11:	5e                   	pop    %esi
+  804b12:	5f                   	pop    %edi
+  804b13:	5d                   	pop    %ebp
+  804b14:	c3                   	ret
+
+00804b15 <__udivdi3>:
+  804b15:	83 ec 08             	sub    $0x8,%esp
+  804b18:	6a 00                	push   $0x0
+  804b1a:	ff 74 24 1c          	push   0x1c(%esp)
+  804b1e:	ff 74 24 1c          	push   0x1c(%esp)
+  804b22:	ff 74 24 1c          	push   0x1c(%esp)
+  804b26:	ff 74 24 1c          	push   0x1c(%esp)
+  804b2a:	e8 0f ff ff ff       	call   804a3e <__udivmoddi4>
+  804b2f:	83 c4 1c             	add    $0x1c,%esp
+  804b32:	c3                   	ret
+
+00804b33 <__umoddi3>:
+  804b33:	83 ec 18             	sub    $0x18,%esp
+  804b36:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804b3a:	50                   	push   %eax
+  804b3b:	ff 74 24 2c          	push   0x2c(%esp)
+  804b3f:	ff 74 24 2c          	push   0x2c(%esp)
+  804b43:	ff 74 24 2c          	push   0x2c(%esp)
+  804b47:	ff 74 24 2c          	push   0x2c(%esp)
+  804b4b:	e8 ee fe ff ff       	call   804a3e <__udivmoddi4>
+  804b50:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804b54:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804b58:	83 c4 2c             	add    $0x2c,%esp
+  804b5b:	c3                   	ret
+
+00804b5c <__divdi3>:
+  804b5c:	53                   	push   %ebx
+  804b5d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804b61:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804b65:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804b69:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804b6d:	85 d2                	test   %edx,%edx
+  804b6f:	78 12                	js     804b83 <__divdi3+0x27>
+  804b71:	85 db                	test   %ebx,%ebx
+  804b73:	78 2e                	js     804ba3 <__divdi3+0x47>
+  804b75:	53                   	push   %ebx
+  804b76:	51                   	push   %ecx
+  804b77:	52                   	push   %edx
+  804b78:	50                   	push   %eax
+  804b79:	e8 97 ff ff ff       	call   804b15 <__udivdi3>
+  804b7e:	83 c4 10             	add    $0x10,%esp
+  804b81:	eb 1e                	jmp    804ba1 <__divdi3+0x45>
+  804b83:	f7 d8                	neg    %eax
+  804b85:	83 d2 00             	adc    $0x0,%edx
+  804b88:	f7 da                	neg    %edx
+  804b8a:	85 db                	test   %ebx,%ebx
+  804b8c:	78 2a                	js     804bb8 <__divdi3+0x5c>
+  804b8e:	53                   	push   %ebx
+  804b8f:	51                   	push   %ecx
+  804b90:	52                   	push   %edx
+  804b91:	50                   	push   %eax
+  804b92:	e8 7e ff ff ff       	call   804b15 <__udivdi3>
+  804b97:	83 c4 10             	add    $0x10,%esp
+  804b9a:	f7 d8                	neg    %eax
+  804b9c:	83 d2 00             	adc    $0x0,%edx
+  804b9f:	f7 da                	neg    %edx
+  804ba1:	5b                   	pop    %ebx
+  804ba2:	c3                   	ret
+  804ba3:	f7 d9                	neg    %ecx
+  804ba5:	83 d3 00             	adc    $0x0,%ebx
+  804ba8:	f7 db                	neg    %ebx
+  804baa:	53                   	push   %ebx
+  804bab:	51                   	push   %ecx
+  804bac:	52                   	push   %edx
+  804bad:	50                   	push   %eax
+  804bae:	e8 62 ff ff ff       	call   804b15 <__udivdi3>
+  804bb3:	83 c4 10             	add    $0x10,%esp
+  804bb6:	eb e2                	jmp    804b9a <__divdi3+0x3e>
+  804bb8:	f7 d9                	neg    %ecx
+  804bba:	83 d3 00             	adc    $0x0,%ebx
+  804bbd:	f7 db                	neg    %ebx
+  804bbf:	53                   	push   %ebx
+  804bc0:	51                   	push   %ecx
+  804bc1:	52                   	push   %edx
+  804bc2:	50                   	push   %eax
+  804bc3:	e8 4d ff ff ff       	call   804b15 <__udivdi3>
+  804bc8:	83 c4 10             	add    $0x10,%esp
+  804bcb:	eb d4                	jmp    804ba1 <__divdi3+0x45>
+
+00804bcd <__moddi3>:
+  804bcd:	55                   	push   %ebp
+  804bce:	57                   	push   %edi
+  804bcf:	56                   	push   %esi
+  804bd0:	53                   	push   %ebx
+  804bd1:	83 ec 0c             	sub    $0xc,%esp
+  804bd4:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  804bd8:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  804bdc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804be0:	89 e9                	mov    %ebp,%ecx
+  804be2:	f7 d9                	neg    %ecx
+  804be4:	89 d0                	mov    %edx,%eax
+  804be6:	83 d0 00             	adc    $0x0,%eax
+  804be9:	f7 d8                	neg    %eax
+  804beb:	0f 49 e9             	cmovns %ecx,%ebp
+  804bee:	0f 49 d0             	cmovns %eax,%edx
+  804bf1:	52                   	push   %edx
+  804bf2:	55                   	push   %ebp
+  804bf3:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804bf7:	f7 da                	neg    %edx
+  804bf9:	89 d8                	mov    %ebx,%eax
+  804bfb:	83 d0 00             	adc    $0x0,%eax
+  804bfe:	f7 d8                	neg    %eax
+  804c00:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  804c05:	89 54 24 08          	mov    %edx,0x8(%esp)
+  804c09:	0f 48 c3             	cmovs  %ebx,%eax
+  804c0c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  804c10:	ff 74 24 0c          	push   0xc(%esp)
+  804c14:	ff 74 24 0c          	push   0xc(%esp)
+  804c18:	e8 16 ff ff ff       	call   804b33 <__umoddi3>
+  804c1d:	83 c4 10             	add    $0x10,%esp
+  804c20:	85 db                	test   %ebx,%ebx
+  804c22:	78 08                	js     804c2c <__moddi3+0x5f>
+  804c24:	83 c4 0c             	add    $0xc,%esp
+  804c27:	5b                   	pop    %ebx
+  804c28:	5e                   	pop    %esi
+  804c29:	5f                   	pop    %edi
+  804c2a:	5d                   	pop    %ebp
+  804c2b:	c3                   	ret
+  804c2c:	f7 d8                	neg    %eax
+  804c2e:	83 d2 00             	adc    $0x0,%edx
+  804c31:	f7 da                	neg    %edx
+  804c33:	eb ef                	jmp    804c24 <__moddi3+0x57>
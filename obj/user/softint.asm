@@ -0,0 +1,5033 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	cd 0e                	int    $0xe
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800041:	e8 e7 00 00 00       	call   80012d <sys_getenvid>
+  800046:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004b:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800051:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800056:	a3 10 50 80 00       	mov    %eax,0x805010
+  80005b:	85 db                	test   %ebx,%ebx
+  80005d:	7e 07                	jle    800066 <libmain+0x30>
+  80005f:	8b 06                	mov    (%esi),%eax
+  800061:	a3 00 40 80 00       	mov    %eax,0x804000
+  800066:	83 ec 08             	sub    $0x8,%esp
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	e8 c3 ff ff ff       	call   800033 <umain>
+  800070:	e8 0a 00 00 00       	call   80007f <exit>
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007b:	5b                   	pop    %ebx
+  80007c:	5e                   	pop    %esi
+  80007d:	5d                   	pop    %ebp
+  80007e:	c3                   	ret
+
+0080007f <exit>:
+  80007f:	55                   	push   %ebp
+  800080:	89 e5                	mov    %esp,%ebp
+  800082:	83 ec 08             	sub    $0x8,%esp
+  800085:	a1 10 50 80 00       	mov    0x805010,%eax
+  80008a:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800090:	85 c0                	test   %eax,%eax
+  800092:	75 14                	jne    8000a8 <exit+0x29>
+  800094:	e8 36 0b 00 00       	call   800bcf <close_all>
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	6a 00                	push   $0x0
+  80009e:	e8 49 00 00 00       	call   8000ec <sys_env_destroy>
+  8000a3:	83 c4 10             	add    $0x10,%esp
+  8000a6:	c9                   	leave
+  8000a7:	c3                   	ret
+  8000a8:	e8 ac 07 00 00       	call   800859 <sys_lease_complete>
+  8000ad:	eb e5                	jmp    800094 <exit+0x15>
+
+008000af <sys_cputs>:
+  8000af:	55                   	push   %ebp
+  8000b0:	89 e5                	mov    %esp,%ebp
+  8000b2:	57                   	push   %edi
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c0:	89 c3                	mov    %eax,%ebx
+  8000c2:	89 c7                	mov    %eax,%edi
+  8000c4:	89 c6                	mov    %eax,%esi
+  8000c6:	cd 30                	int    $0x30
+  8000c8:	5b                   	pop    %ebx
+  8000c9:	5e                   	pop    %esi
+  8000ca:	5f                   	pop    %edi
+  8000cb:	5d                   	pop    %ebp
+  8000cc:	c3                   	ret
+
+008000cd <sys_cgetc>:
+  8000cd:	55                   	push   %ebp
+  8000ce:	89 e5                	mov    %esp,%ebp
+  8000d0:	57                   	push   %edi
+  8000d1:	56                   	push   %esi
+  8000d2:	53                   	push   %ebx
+  8000d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000dd:	89 d1                	mov    %edx,%ecx
+  8000df:	89 d3                	mov    %edx,%ebx
+  8000e1:	89 d7                	mov    %edx,%edi
+  8000e3:	89 d6                	mov    %edx,%esi
+  8000e5:	cd 30                	int    $0x30
+  8000e7:	5b                   	pop    %ebx
+  8000e8:	5e                   	pop    %esi
+  8000e9:	5f                   	pop    %edi
+  8000ea:	5d                   	pop    %ebp
+  8000eb:	c3                   	ret
+
+008000ec <sys_env_destroy>:
+  8000ec:	55                   	push   %ebp
+  8000ed:	89 e5                	mov    %esp,%ebp
+  8000ef:	57                   	push   %edi
+  8000f0:	56                   	push   %esi
+  8000f1:	53                   	push   %ebx
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fd:	b8 03 00 00 00       	mov    $0x3,%eax
+  800102:	89 cb                	mov    %ecx,%ebx
+  800104:	89 cf                	mov    %ecx,%edi
+  800106:	89 ce                	mov    %ecx,%esi
+  800108:	cd 30                	int    $0x30
+  80010a:	85 c0                	test   %eax,%eax
+  80010c:	7f 08                	jg     800116 <sys_env_destroy+0x2a>
+  80010e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800111:	5b                   	pop    %ebx
+  800112:	5e                   	pop    %esi
+  800113:	5f                   	pop    %edi
+  800114:	5d                   	pop    %ebp
+  800115:	c3                   	ret
+  800116:	83 ec 0c             	sub    $0xc,%esp
+  800119:	50                   	push   %eax
+  80011a:	6a 03                	push   $0x3
+  80011c:	68 6a 31 80 00       	push   $0x80316a
+  800121:	6a 24                	push   $0x24
+  800123:	68 87 31 80 00       	push   $0x803187
+  800128:	e8 37 20 00 00       	call   802164 <_panic>
+
+0080012d <sys_getenvid>:
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	57                   	push   %edi
+  800131:	56                   	push   %esi
+  800132:	53                   	push   %ebx
+  800133:	ba 00 00 00 00       	mov    $0x0,%edx
+  800138:	b8 02 00 00 00       	mov    $0x2,%eax
+  80013d:	89 d1                	mov    %edx,%ecx
+  80013f:	89 d3                	mov    %edx,%ebx
+  800141:	89 d7                	mov    %edx,%edi
+  800143:	89 d6                	mov    %edx,%esi
+  800145:	cd 30                	int    $0x30
+  800147:	5b                   	pop    %ebx
+  800148:	5e                   	pop    %esi
+  800149:	5f                   	pop    %edi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <sys_yield>:
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	57                   	push   %edi
+  800150:	56                   	push   %esi
+  800151:	53                   	push   %ebx
+  800152:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800159:	74 26                	je     800181 <sys_yield+0x35>
+  80015b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800160:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800165:	89 d1                	mov    %edx,%ecx
+  800167:	89 d3                	mov    %edx,%ebx
+  800169:	89 d7                	mov    %edx,%edi
+  80016b:	6a 00                	push   $0x0
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	8d 35 78 01 80 00    	lea    0x800178,%esi
+  800176:	0f 34                	sysenter
+  800178:	5d                   	pop    %ebp
+  800179:	83 c4 04             	add    $0x4,%esp
+  80017c:	5b                   	pop    %ebx
+  80017d:	5e                   	pop    %esi
+  80017e:	5f                   	pop    %edi
+  80017f:	5d                   	pop    %ebp
+  800180:	c3                   	ret
+  800181:	ba 00 00 00 00       	mov    $0x0,%edx
+  800186:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80018b:	89 d1                	mov    %edx,%ecx
+  80018d:	89 d3                	mov    %edx,%ebx
+  80018f:	89 d7                	mov    %edx,%edi
+  800191:	89 d6                	mov    %edx,%esi
+  800193:	cd 30                	int    $0x30
+  800195:	eb e5                	jmp    80017c <sys_yield+0x30>
+
+00800197 <sys_page_alloc>:
+  800197:	55                   	push   %ebp
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	57                   	push   %edi
+  80019b:	56                   	push   %esi
+  80019c:	53                   	push   %ebx
+  80019d:	83 ec 0c             	sub    $0xc,%esp
+  8001a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ab:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b3:	89 f7                	mov    %esi,%edi
+  8001b5:	cd 30                	int    $0x30
+  8001b7:	85 c0                	test   %eax,%eax
+  8001b9:	7f 08                	jg     8001c3 <sys_page_alloc+0x2c>
+  8001bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001be:	5b                   	pop    %ebx
+  8001bf:	5e                   	pop    %esi
+  8001c0:	5f                   	pop    %edi
+  8001c1:	5d                   	pop    %ebp
+  8001c2:	c3                   	ret
+  8001c3:	83 ec 0c             	sub    $0xc,%esp
+  8001c6:	50                   	push   %eax
+  8001c7:	6a 04                	push   $0x4
+  8001c9:	68 6a 31 80 00       	push   $0x80316a
+  8001ce:	6a 24                	push   $0x24
+  8001d0:	68 87 31 80 00       	push   $0x803187
+  8001d5:	e8 8a 1f 00 00       	call   802164 <_panic>
+
+008001da <sys_page_map>:
+  8001da:	55                   	push   %ebp
+  8001db:	89 e5                	mov    %esp,%ebp
+  8001dd:	57                   	push   %edi
+  8001de:	56                   	push   %esi
+  8001df:	53                   	push   %ebx
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8001ea:	74 33                	je     80021f <sys_page_map+0x45>
+  8001ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001fd:	ff 75 18             	push   0x18(%ebp)
+  800200:	55                   	push   %ebp
+  800201:	89 e5                	mov    %esp,%ebp
+  800203:	8d 35 0b 02 80 00    	lea    0x80020b,%esi
+  800209:	0f 34                	sysenter
+  80020b:	5d                   	pop    %ebp
+  80020c:	83 c4 04             	add    $0x4,%esp
+  80020f:	89 c2                	mov    %eax,%edx
+  800211:	85 c0                	test   %eax,%eax
+  800213:	7f 3d                	jg     800252 <sys_page_map+0x78>
+  800215:	89 d0                	mov    %edx,%eax
+  800217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021a:	5b                   	pop    %ebx
+  80021b:	5e                   	pop    %esi
+  80021c:	5f                   	pop    %edi
+  80021d:	5d                   	pop    %ebp
+  80021e:	c3                   	ret
+  80021f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800224:	8b 55 08             	mov    0x8(%ebp),%edx
+  800227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80022d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800230:	8b 75 18             	mov    0x18(%ebp),%esi
+  800233:	cd 30                	int    $0x30
+  800235:	89 c2                	mov    %eax,%edx
+  800237:	85 c0                	test   %eax,%eax
+  800239:	7e da                	jle    800215 <sys_page_map+0x3b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	50                   	push   %eax
+  80023f:	6a 05                	push   $0x5
+  800241:	68 6a 31 80 00       	push   $0x80316a
+  800246:	6a 24                	push   $0x24
+  800248:	68 87 31 80 00       	push   $0x803187
+  80024d:	e8 12 1f 00 00       	call   802164 <_panic>
+  800252:	83 ec 0c             	sub    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	6a 05                	push   $0x5
+  800258:	68 6a 31 80 00       	push   $0x80316a
+  80025d:	6a 48                	push   $0x48
+  80025f:	68 87 31 80 00       	push   $0x803187
+  800264:	e8 fb 1e 00 00       	call   802164 <_panic>
+
+00800269 <sys_page_unmap>:
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	57                   	push   %edi
+  80026d:	56                   	push   %esi
+  80026e:	53                   	push   %ebx
+  80026f:	83 ec 0c             	sub    $0xc,%esp
+  800272:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800282:	89 df                	mov    %ebx,%edi
+  800284:	89 de                	mov    %ebx,%esi
+  800286:	cd 30                	int    $0x30
+  800288:	85 c0                	test   %eax,%eax
+  80028a:	7f 08                	jg     800294 <sys_page_unmap+0x2b>
+  80028c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028f:	5b                   	pop    %ebx
+  800290:	5e                   	pop    %esi
+  800291:	5f                   	pop    %edi
+  800292:	5d                   	pop    %ebp
+  800293:	c3                   	ret
+  800294:	83 ec 0c             	sub    $0xc,%esp
+  800297:	50                   	push   %eax
+  800298:	6a 06                	push   $0x6
+  80029a:	68 6a 31 80 00       	push   $0x80316a
+  80029f:	6a 24                	push   $0x24
+  8002a1:	68 87 31 80 00       	push   $0x803187
+  8002a6:	e8 b9 1e 00 00       	call   802164 <_panic>
+
+008002ab <sys_fork>:
+  8002ab:	55                   	push   %ebp
+  8002ac:	89 e5                	mov    %esp,%ebp
+  8002ae:	57                   	push   %edi
+  8002af:	56                   	push   %esi
+  8002b0:	53                   	push   %ebx
+  8002b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8002bb:	89 d1                	mov    %edx,%ecx
+  8002bd:	89 d3                	mov    %edx,%ebx
+  8002bf:	89 d7                	mov    %edx,%edi
+  8002c1:	89 d6                	mov    %edx,%esi
+  8002c3:	cd 30                	int    $0x30
+  8002c5:	5b                   	pop    %ebx
+  8002c6:	5e                   	pop    %esi
+  8002c7:	5f                   	pop    %edi
+  8002c8:	5d                   	pop    %ebp
+  8002c9:	c3                   	ret
+
+008002ca <sys_env_set_status>:
+  8002ca:	55                   	push   %ebp
+  8002cb:	89 e5                	mov    %esp,%ebp
+  8002cd:	57                   	push   %edi
+  8002ce:	56                   	push   %esi
+  8002cf:	53                   	push   %ebx
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002de:	b8 08 00 00 00       	mov    $0x8,%eax
+  8002e3:	89 df                	mov    %ebx,%edi
+  8002e5:	89 de                	mov    %ebx,%esi
+  8002e7:	cd 30                	int    $0x30
+  8002e9:	85 c0                	test   %eax,%eax
+  8002eb:	7f 08                	jg     8002f5 <sys_env_set_status+0x2b>
+  8002ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f0:	5b                   	pop    %ebx
+  8002f1:	5e                   	pop    %esi
+  8002f2:	5f                   	pop    %edi
+  8002f3:	5d                   	pop    %ebp
+  8002f4:	c3                   	ret
+  8002f5:	83 ec 0c             	sub    $0xc,%esp
+  8002f8:	50                   	push   %eax
+  8002f9:	6a 08                	push   $0x8
+  8002fb:	68 6a 31 80 00       	push   $0x80316a
+  800300:	6a 24                	push   $0x24
+  800302:	68 87 31 80 00       	push   $0x803187
+  800307:	e8 58 1e 00 00       	call   802164 <_panic>
+
+0080030c <sys_env_set_trapframe>:
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	57                   	push   %edi
+  800310:	56                   	push   %esi
+  800311:	53                   	push   %ebx
+  800312:	83 ec 0c             	sub    $0xc,%esp
+  800315:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80031a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800320:	b8 09 00 00 00       	mov    $0x9,%eax
+  800325:	89 df                	mov    %ebx,%edi
+  800327:	89 de                	mov    %ebx,%esi
+  800329:	cd 30                	int    $0x30
+  80032b:	85 c0                	test   %eax,%eax
+  80032d:	7f 08                	jg     800337 <sys_env_set_trapframe+0x2b>
+  80032f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800332:	5b                   	pop    %ebx
+  800333:	5e                   	pop    %esi
+  800334:	5f                   	pop    %edi
+  800335:	5d                   	pop    %ebp
+  800336:	c3                   	ret
+  800337:	83 ec 0c             	sub    $0xc,%esp
+  80033a:	50                   	push   %eax
+  80033b:	6a 09                	push   $0x9
+  80033d:	68 6a 31 80 00       	push   $0x80316a
+  800342:	6a 24                	push   $0x24
+  800344:	68 87 31 80 00       	push   $0x803187
+  800349:	e8 16 1e 00 00       	call   802164 <_panic>
+
+0080034e <sys_env_set_cow>:
+  80034e:	55                   	push   %ebp
+  80034f:	89 e5                	mov    %esp,%ebp
+  800351:	57                   	push   %edi
+  800352:	56                   	push   %esi
+  800353:	53                   	push   %ebx
+  800354:	83 ec 0c             	sub    $0xc,%esp
+  800357:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80035c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800362:	b8 20 00 00 00       	mov    $0x20,%eax
+  800367:	89 df                	mov    %ebx,%edi
+  800369:	89 de                	mov    %ebx,%esi
+  80036b:	cd 30                	int    $0x30
+  80036d:	85 c0                	test   %eax,%eax
+  80036f:	7f 08                	jg     800379 <sys_env_set_cow+0x2b>
+  800371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800374:	5b                   	pop    %ebx
+  800375:	5e                   	pop    %esi
+  800376:	5f                   	pop    %edi
+  800377:	5d                   	pop    %ebp
+  800378:	c3                   	ret
+  800379:	83 ec 0c             	sub    $0xc,%esp
+  80037c:	50                   	push   %eax
+  80037d:	6a 20                	push   $0x20
+  80037f:	68 6a 31 80 00       	push   $0x80316a
+  800384:	6a 24                	push   $0x24
+  800386:	68 87 31 80 00       	push   $0x803187
+  80038b:	e8 d4 1d 00 00       	call   802164 <_panic>
+
+00800390 <sys_env_service>:
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	57                   	push   %edi
+  800394:	56                   	push   %esi
+  800395:	53                   	push   %ebx
+  800396:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80039b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80039e:	b8 21 00 00 00       	mov    $0x21,%eax
+  8003a3:	89 cb                	mov    %ecx,%ebx
+  8003a5:	89 cf                	mov    %ecx,%edi
+  8003a7:	89 ce                	mov    %ecx,%esi
+  8003a9:	cd 30                	int    $0x30
+  8003ab:	5b                   	pop    %ebx
+  8003ac:	5e                   	pop    %esi
+  8003ad:	5f                   	pop    %edi
+  8003ae:	5d                   	pop    %ebp
+  8003af:	c3                   	ret
+
+008003b0 <sys_env_set_pgfault_upcall>:
+  8003b0:	55                   	push   %ebp
+  8003b1:	89 e5                	mov    %esp,%ebp
+  8003b3:	57                   	push   %edi
+  8003b4:	56                   	push   %esi
+  8003b5:	53                   	push   %ebx
+  8003b6:	83 ec 0c             	sub    $0xc,%esp
+  8003b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8003c9:	89 df                	mov    %ebx,%edi
+  8003cb:	89 de                	mov    %ebx,%esi
+  8003cd:	cd 30                	int    $0x30
+  8003cf:	85 c0                	test   %eax,%eax
+  8003d1:	7f 08                	jg     8003db <sys_env_set_pgfault_upcall+0x2b>
+  8003d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d6:	5b                   	pop    %ebx
+  8003d7:	5e                   	pop    %esi
+  8003d8:	5f                   	pop    %edi
+  8003d9:	5d                   	pop    %ebp
+  8003da:	c3                   	ret
+  8003db:	83 ec 0c             	sub    $0xc,%esp
+  8003de:	50                   	push   %eax
+  8003df:	6a 0a                	push   $0xa
+  8003e1:	68 6a 31 80 00       	push   $0x80316a
+  8003e6:	6a 24                	push   $0x24
+  8003e8:	68 87 31 80 00       	push   $0x803187
+  8003ed:	e8 72 1d 00 00       	call   802164 <_panic>
+
+008003f2 <sys_ipc_try_send>:
+  8003f2:	55                   	push   %ebp
+  8003f3:	89 e5                	mov    %esp,%ebp
+  8003f5:	57                   	push   %edi
+  8003f6:	56                   	push   %esi
+  8003f7:	53                   	push   %ebx
+  8003f8:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8003ff:	74 27                	je     800428 <sys_ipc_try_send+0x36>
+  800401:	8b 55 08             	mov    0x8(%ebp),%edx
+  800404:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800407:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80040c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80040f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800412:	6a 00                	push   $0x0
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	8d 35 1f 04 80 00    	lea    0x80041f,%esi
+  80041d:	0f 34                	sysenter
+  80041f:	5d                   	pop    %ebp
+  800420:	83 c4 04             	add    $0x4,%esp
+  800423:	5b                   	pop    %ebx
+  800424:	5e                   	pop    %esi
+  800425:	5f                   	pop    %edi
+  800426:	5d                   	pop    %ebp
+  800427:	c3                   	ret
+  800428:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80042d:	be 00 00 00 00       	mov    $0x0,%esi
+  800432:	8b 55 08             	mov    0x8(%ebp),%edx
+  800435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800438:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80043b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80043e:	cd 30                	int    $0x30
+  800440:	eb e1                	jmp    800423 <sys_ipc_try_send+0x31>
+
+00800442 <sys_ipc_recv>:
+  800442:	55                   	push   %ebp
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	57                   	push   %edi
+  800446:	56                   	push   %esi
+  800447:	53                   	push   %ebx
+  800448:	83 ec 0c             	sub    $0xc,%esp
+  80044b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800452:	74 32                	je     800486 <sys_ipc_recv+0x44>
+  800454:	8b 55 08             	mov    0x8(%ebp),%edx
+  800457:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80045c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800461:	89 cb                	mov    %ecx,%ebx
+  800463:	89 cf                	mov    %ecx,%edi
+  800465:	6a 00                	push   $0x0
+  800467:	55                   	push   %ebp
+  800468:	89 e5                	mov    %esp,%ebp
+  80046a:	8d 35 72 04 80 00    	lea    0x800472,%esi
+  800470:	0f 34                	sysenter
+  800472:	5d                   	pop    %ebp
+  800473:	83 c4 04             	add    $0x4,%esp
+  800476:	89 c2                	mov    %eax,%edx
+  800478:	85 c0                	test   %eax,%eax
+  80047a:	7f 3c                	jg     8004b8 <sys_ipc_recv+0x76>
+  80047c:	89 d0                	mov    %edx,%eax
+  80047e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800481:	5b                   	pop    %ebx
+  800482:	5e                   	pop    %esi
+  800483:	5f                   	pop    %edi
+  800484:	5d                   	pop    %ebp
+  800485:	c3                   	ret
+  800486:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800490:	8b 55 08             	mov    0x8(%ebp),%edx
+  800493:	89 cb                	mov    %ecx,%ebx
+  800495:	89 cf                	mov    %ecx,%edi
+  800497:	89 ce                	mov    %ecx,%esi
+  800499:	cd 30                	int    $0x30
+  80049b:	89 c2                	mov    %eax,%edx
+  80049d:	85 c0                	test   %eax,%eax
+  80049f:	7e db                	jle    80047c <sys_ipc_recv+0x3a>
+  8004a1:	83 ec 0c             	sub    $0xc,%esp
+  8004a4:	50                   	push   %eax
+  8004a5:	6a 0d                	push   $0xd
+  8004a7:	68 6a 31 80 00       	push   $0x80316a
+  8004ac:	6a 24                	push   $0x24
+  8004ae:	68 87 31 80 00       	push   $0x803187
+  8004b3:	e8 ac 1c 00 00       	call   802164 <_panic>
+  8004b8:	83 ec 0c             	sub    $0xc,%esp
+  8004bb:	50                   	push   %eax
+  8004bc:	6a 0d                	push   $0xd
+  8004be:	68 6a 31 80 00       	push   $0x80316a
+  8004c3:	6a 48                	push   $0x48
+  8004c5:	68 87 31 80 00       	push   $0x803187
+  8004ca:	e8 95 1c 00 00       	call   802164 <_panic>
+
+008004cf <sys_ipc_send>:
+  8004cf:	55                   	push   %ebp
+  8004d0:	89 e5                	mov    %esp,%ebp
+  8004d2:	57                   	push   %edi
+  8004d3:	56                   	push   %esi
+  8004d4:	53                   	push   %ebx
+  8004d5:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8004dc:	74 27                	je     800505 <sys_ipc_send+0x36>
+  8004de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004ec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004ef:	6a 00                	push   $0x0
+  8004f1:	55                   	push   %ebp
+  8004f2:	89 e5                	mov    %esp,%ebp
+  8004f4:	8d 35 fc 04 80 00    	lea    0x8004fc,%esi
+  8004fa:	0f 34                	sysenter
+  8004fc:	5d                   	pop    %ebp
+  8004fd:	83 c4 04             	add    $0x4,%esp
+  800500:	5b                   	pop    %ebx
+  800501:	5e                   	pop    %esi
+  800502:	5f                   	pop    %edi
+  800503:	5d                   	pop    %ebp
+  800504:	c3                   	ret
+  800505:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80050a:	be 00 00 00 00       	mov    $0x0,%esi
+  80050f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800512:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800515:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800518:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80051b:	cd 30                	int    $0x30
+  80051d:	eb e1                	jmp    800500 <sys_ipc_send+0x31>
+
+0080051f <sys_ipc_call>:
+  80051f:	55                   	push   %ebp
+  800520:	89 e5                	mov    %esp,%ebp
+  800522:	57                   	push   %edi
+  800523:	56                   	push   %esi
+  800524:	53                   	push   %ebx
+  800525:	8b 55 08             	mov    0x8(%ebp),%edx
+  800528:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800530:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800533:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800536:	8b 75 18             	mov    0x18(%ebp),%esi
+  800539:	cd 30                	int    $0x30
+  80053b:	5b                   	pop    %ebx
+  80053c:	5e                   	pop    %esi
+  80053d:	5f                   	pop    %edi
+  80053e:	5d                   	pop    %ebp
+  80053f:	c3                   	ret
+
+00800540 <sys_ipc_reply_recv>:
+  800540:	55                   	push   %ebp
+  800541:	89 e5                	mov    %esp,%ebp
+  800543:	57                   	push   %edi
+  800544:	56                   	push   %esi
+  800545:	53                   	push   %ebx
+  800546:	8b 55 08             	mov    0x8(%ebp),%edx
+  800549:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80054c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800551:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800554:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800557:	8b 75 18             	mov    0x18(%ebp),%esi
+  80055a:	cd 30                	int    $0x30
+  80055c:	5b                   	pop    %ebx
+  80055d:	5e                   	pop    %esi
+  80055e:	5f                   	pop    %edi
+  80055f:	5d                   	pop    %ebp
+  800560:	c3                   	ret
+
+00800561 <sys_time_msec>:
+  800561:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  800566:	85 c0                	test   %eax,%eax
+  800568:	75 06                	jne    800570 <sys_time_msec+0xf>
+  80056a:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80056f:	c3                   	ret
+  800570:	55                   	push   %ebp
+  800571:	89 e5                	mov    %esp,%ebp
+  800573:	57                   	push   %edi
+  800574:	56                   	push   %esi
+  800575:	53                   	push   %ebx
+  800576:	83 ec 0c             	sub    $0xc,%esp
+  800579:	0f 31                	rdtsc
+  80057b:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800581:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  800587:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80058d:	29 c8                	sub    %ecx,%eax
+  80058f:	19 da                	sbb    %ebx,%edx
+  800591:	bf 00 00 00 00       	mov    $0x0,%edi
+  800596:	57                   	push   %edi
+  800597:	56                   	push   %esi
+  800598:	52                   	push   %edx
+  800599:	50                   	push   %eax
+  80059a:	e8 95 2a 00 00       	call   803034 <__udivdi3>
+  80059f:	83 c4 10             	add    $0x10,%esp
+  8005a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a5:	5b                   	pop    %ebx
+  8005a6:	5e                   	pop    %esi
+  8005a7:	5f                   	pop    %edi
+  8005a8:	5d                   	pop    %ebp
+  8005a9:	c3                   	ret
+
+008005aa <sys_env_swap>:
+  8005aa:	55                   	push   %ebp
+  8005ab:	89 e5                	mov    %esp,%ebp
+  8005ad:	57                   	push   %edi
+  8005ae:	56                   	push   %esi
+  8005af:	53                   	push   %ebx
+  8005b0:	83 ec 0c             	sub    $0xc,%esp
+  8005b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005bb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8005c0:	89 cb                	mov    %ecx,%ebx
+  8005c2:	89 cf                	mov    %ecx,%edi
+  8005c4:	89 ce                	mov    %ecx,%esi
+  8005c6:	cd 30                	int    $0x30
+  8005c8:	85 c0                	test   %eax,%eax
+  8005ca:	7f 08                	jg     8005d4 <sys_env_swap+0x2a>
+  8005cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005cf:	5b                   	pop    %ebx
+  8005d0:	5e                   	pop    %esi
+  8005d1:	5f                   	pop    %edi
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+  8005d4:	83 ec 0c             	sub    $0xc,%esp
+  8005d7:	50                   	push   %eax
+  8005d8:	6a 12                	push   $0x12
+  8005da:	68 6a 31 80 00       	push   $0x80316a
+  8005df:	6a 24                	push   $0x24
+  8005e1:	68 87 31 80 00       	push   $0x803187
+  8005e6:	e8 79 1b 00 00       	call   802164 <_panic>
+
+008005eb <sys_net_try_send>:
+  8005eb:	55                   	push   %ebp
+  8005ec:	89 e5                	mov    %esp,%ebp
+  8005ee:	57                   	push   %edi
+  8005ef:	56                   	push   %esi
+  8005f0:	53                   	push   %ebx
+  8005f1:	83 ec 0c             	sub    $0xc,%esp
+  8005f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ff:	b8 13 00 00 00       	mov    $0x13,%eax
+  800604:	89 df                	mov    %ebx,%edi
+  800606:	89 de                	mov    %ebx,%esi
+  800608:	cd 30                	int    $0x30
+  80060a:	85 c0                	test   %eax,%eax
+  80060c:	7f 08                	jg     800616 <sys_net_try_send+0x2b>
+  80060e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800611:	5b                   	pop    %ebx
+  800612:	5e                   	pop    %esi
+  800613:	5f                   	pop    %edi
+  800614:	5d                   	pop    %ebp
+  800615:	c3                   	ret
+  800616:	83 ec 0c             	sub    $0xc,%esp
+  800619:	50                   	push   %eax
+  80061a:	6a 13                	push   $0x13
+  80061c:	68 6a 31 80 00       	push   $0x80316a
+  800621:	6a 24                	push   $0x24
+  800623:	68 87 31 80 00       	push   $0x803187
+  800628:	e8 37 1b 00 00       	call   802164 <_panic>
+
+0080062d <sys_net_try_receive>:
+  80062d:	55                   	push   %ebp
+  80062e:	89 e5                	mov    %esp,%ebp
+  800630:	57                   	push   %edi
+  800631:	56                   	push   %esi
+  800632:	53                   	push   %ebx
+  800633:	83 ec 0c             	sub    $0xc,%esp
+  800636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80063b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80063e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800641:	b8 14 00 00 00       	mov    $0x14,%eax
+  800646:	89 df                	mov    %ebx,%edi
+  800648:	89 de                	mov    %ebx,%esi
+  80064a:	cd 30                	int    $0x30
+  80064c:	85 c0                	test   %eax,%eax
+  80064e:	7f 08                	jg     800658 <sys_net_try_receive+0x2b>
+  800650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800653:	5b                   	pop    %ebx
+  800654:	5e                   	pop    %esi
+  800655:	5f                   	pop    %edi
+  800656:	5d                   	pop    %ebp
+  800657:	c3                   	ret
+  800658:	83 ec 0c             	sub    $0xc,%esp
+  80065b:	50                   	push   %eax
+  80065c:	6a 14                	push   $0x14
+  80065e:	68 6a 31 80 00       	push   $0x80316a
+  800663:	6a 24                	push   $0x24
+  800665:	68 87 31 80 00       	push   $0x803187
+  80066a:	e8 f5 1a 00 00       	call   802164 <_panic>
+
+0080066f <sys_net_recv_page>:
+  80066f:	55                   	push   %ebp
+  800670:	89 e5                	mov    %esp,%ebp
+  800672:	57                   	push   %edi
+  800673:	56                   	push   %esi
+  800674:	53                   	push   %ebx
+  800675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80067d:	b8 27 00 00 00       	mov    $0x27,%eax
+  800682:	89 cb                	mov    %ecx,%ebx
+  800684:	89 cf                	mov    %ecx,%edi
+  800686:	89 ce                	mov    %ecx,%esi
+  800688:	cd 30                	int    $0x30
+  80068a:	5b                   	pop    %ebx
+  80068b:	5e                   	pop    %esi
+  80068c:	5f                   	pop    %edi
+  80068d:	5d                   	pop    %ebp
+  80068e:	c3                   	ret
+
+0080068f <sys_net_wait>:
+  80068f:	55                   	push   %ebp
+  800690:	89 e5                	mov    %esp,%ebp
+  800692:	57                   	push   %edi
+  800693:	56                   	push   %esi
+  800694:	53                   	push   %ebx
+  800695:	ba 00 00 00 00       	mov    $0x0,%edx
+  80069a:	b8 26 00 00 00       	mov    $0x26,%eax
+  80069f:	89 d1                	mov    %edx,%ecx
+  8006a1:	89 d3                	mov    %edx,%ebx
+  8006a3:	89 d7                	mov    %edx,%edi
+  8006a5:	89 d6                	mov    %edx,%esi
+  8006a7:	cd 30                	int    $0x30
+  8006a9:	5b                   	pop    %ebx
+  8006aa:	5e                   	pop    %esi
+  8006ab:	5f                   	pop    %edi
+  8006ac:	5d                   	pop    %ebp
+  8006ad:	c3                   	ret
+
+008006ae <sys_get_mac>:
+  8006ae:	55                   	push   %ebp
+  8006af:	89 e5                	mov    %esp,%ebp
+  8006b1:	57                   	push   %edi
+  8006b2:	56                   	push   %esi
+  8006b3:	53                   	push   %ebx
+  8006b4:	83 ec 0c             	sub    $0xc,%esp
+  8006b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8006c7:	89 df                	mov    %ebx,%edi
+  8006c9:	89 de                	mov    %ebx,%esi
+  8006cb:	cd 30                	int    $0x30
+  8006cd:	85 c0                	test   %eax,%eax
+  8006cf:	7f 08                	jg     8006d9 <sys_get_mac+0x2b>
+  8006d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d4:	5b                   	pop    %ebx
+  8006d5:	5e                   	pop    %esi
+  8006d6:	5f                   	pop    %edi
+  8006d7:	5d                   	pop    %ebp
+  8006d8:	c3                   	ret
+  8006d9:	83 ec 0c             	sub    $0xc,%esp
+  8006dc:	50                   	push   %eax
+  8006dd:	6a 15                	push   $0x15
+  8006df:	68 6a 31 80 00       	push   $0x80316a
+  8006e4:	6a 24                	push   $0x24
+  8006e6:	68 87 31 80 00       	push   $0x803187
+  8006eb:	e8 74 1a 00 00       	call   802164 <_panic>
+
+008006f0 <sys_env_lease>:
+  8006f0:	55                   	push   %ebp
+  8006f1:	89 e5                	mov    %esp,%ebp
+  8006f3:	57                   	push   %edi
+  8006f4:	56                   	push   %esi
+  8006f5:	53                   	push   %ebx
+  8006f6:	83 ec 0c             	sub    $0xc,%esp
+  8006f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800701:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800704:	b8 16 00 00 00       	mov    $0x16,%eax
+  800709:	89 df                	mov    %ebx,%edi
+  80070b:	89 de                	mov    %ebx,%esi
+  80070d:	cd 30                	int    $0x30
+  80070f:	85 c0                	test   %eax,%eax
+  800711:	7f 08                	jg     80071b <sys_env_lease+0x2b>
+  800713:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800716:	5b                   	pop    %ebx
+  800717:	5e                   	pop    %esi
+  800718:	5f                   	pop    %edi
+  800719:	5d                   	pop    %ebp
+  80071a:	c3                   	ret
+  80071b:	83 ec 0c             	sub    $0xc,%esp
+  80071e:	50                   	push   %eax
+  80071f:	6a 16                	push   $0x16
+  800721:	68 6a 31 80 00       	push   $0x80316a
+  800726:	6a 24                	push   $0x24
+  800728:	68 87 31 80 00       	push   $0x803187
+  80072d:	e8 32 1a 00 00       	call   802164 <_panic>
+
+00800732 <sys_copy_mem>:
+  800732:	55                   	push   %ebp
+  800733:	89 e5                	mov    %esp,%ebp
+  800735:	57                   	push   %edi
+  800736:	56                   	push   %esi
+  800737:	53                   	push   %ebx
+  800738:	83 ec 0c             	sub    $0xc,%esp
+  80073b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80073e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800741:	b8 17 00 00 00       	mov    $0x17,%eax
+  800746:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800749:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80074c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80074f:	cd 30                	int    $0x30
+  800751:	85 c0                	test   %eax,%eax
+  800753:	7f 08                	jg     80075d <sys_copy_mem+0x2b>
+  800755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800758:	5b                   	pop    %ebx
+  800759:	5e                   	pop    %esi
+  80075a:	5f                   	pop    %edi
+  80075b:	5d                   	pop    %ebp
+  80075c:	c3                   	ret
+  80075d:	83 ec 0c             	sub    $0xc,%esp
+  800760:	50                   	push   %eax
+  800761:	6a 17                	push   $0x17
+  800763:	68 6a 31 80 00       	push   $0x80316a
+  800768:	6a 24                	push   $0x24
+  80076a:	68 87 31 80 00       	push   $0x803187
+  80076f:	e8 f0 19 00 00       	call   802164 <_panic>
+
+00800774 <sys_get_perms>:
+  800774:	55                   	push   %ebp
+  800775:	89 e5                	mov    %esp,%ebp
+  800777:	57                   	push   %edi
+  800778:	56                   	push   %esi
+  800779:	53                   	push   %ebx
+  80077a:	83 ec 0c             	sub    $0xc,%esp
+  80077d:	be 00 00 00 00       	mov    $0x0,%esi
+  800782:	8b 55 08             	mov    0x8(%ebp),%edx
+  800785:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800788:	b8 18 00 00 00       	mov    $0x18,%eax
+  80078d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800790:	89 f7                	mov    %esi,%edi
+  800792:	cd 30                	int    $0x30
+  800794:	85 c0                	test   %eax,%eax
+  800796:	7f 08                	jg     8007a0 <sys_get_perms+0x2c>
+  800798:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80079b:	5b                   	pop    %ebx
+  80079c:	5e                   	pop    %esi
+  80079d:	5f                   	pop    %edi
+  80079e:	5d                   	pop    %ebp
+  80079f:	c3                   	ret
+  8007a0:	83 ec 0c             	sub    $0xc,%esp
+  8007a3:	50                   	push   %eax
+  8007a4:	6a 18                	push   $0x18
+  8007a6:	68 6a 31 80 00       	push   $0x80316a
+  8007ab:	6a 24                	push   $0x24
+  8007ad:	68 87 31 80 00       	push   $0x803187
+  8007b2:	e8 ad 19 00 00       	call   802164 <_panic>
+
+008007b7 <sys_env_unsuspend>:
+  8007b7:	55                   	push   %ebp
+  8007b8:	89 e5                	mov    %esp,%ebp
+  8007ba:	57                   	push   %edi
+  8007bb:	56                   	push   %esi
+  8007bc:	53                   	push   %ebx
+  8007bd:	83 ec 0c             	sub    $0xc,%esp
+  8007c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8007c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007cb:	b8 19 00 00 00       	mov    $0x19,%eax
+  8007d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007d3:	89 f7                	mov    %esi,%edi
+  8007d5:	cd 30                	int    $0x30
+  8007d7:	85 c0                	test   %eax,%eax
+  8007d9:	7f 08                	jg     8007e3 <sys_env_unsuspend+0x2c>
+  8007db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007de:	5b                   	pop    %ebx
+  8007df:	5e                   	pop    %esi
+  8007e0:	5f                   	pop    %edi
+  8007e1:	5d                   	pop    %ebp
+  8007e2:	c3                   	ret
+  8007e3:	83 ec 0c             	sub    $0xc,%esp
+  8007e6:	50                   	push   %eax
+  8007e7:	6a 19                	push   $0x19
+  8007e9:	68 6a 31 80 00       	push   $0x80316a
+  8007ee:	6a 24                	push   $0x24
+  8007f0:	68 87 31 80 00       	push   $0x803187
+  8007f5:	e8 6a 19 00 00       	call   802164 <_panic>
+
+008007fa <sys_migrate>:
+  8007fa:	55                   	push   %ebp
+  8007fb:	89 e5                	mov    %esp,%ebp
+  8007fd:	57                   	push   %edi
+  8007fe:	56                   	push   %esi
+  8007ff:	53                   	push   %ebx
+  800800:	83 ec 0c             	sub    $0xc,%esp
+  800803:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800808:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80080e:	76 11                	jbe    800821 <sys_migrate+0x27>
+  800810:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800815:	0f b6 08             	movzbl (%eax),%ecx
+  800818:	05 00 10 00 00       	add    $0x1000,%eax
+  80081d:	39 d0                	cmp    %edx,%eax
+  80081f:	72 f4                	jb     800815 <sys_migrate+0x1b>
+  800821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800826:	8b 55 08             	mov    0x8(%ebp),%edx
+  800829:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80082e:	89 cb                	mov    %ecx,%ebx
+  800830:	89 cf                	mov    %ecx,%edi
+  800832:	89 ce                	mov    %ecx,%esi
+  800834:	cd 30                	int    $0x30
+  800836:	85 c0                	test   %eax,%eax
+  800838:	7f 08                	jg     800842 <sys_migrate+0x48>
+  80083a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80083d:	5b                   	pop    %ebx
+  80083e:	5e                   	pop    %esi
+  80083f:	5f                   	pop    %edi
+  800840:	5d                   	pop    %ebp
+  800841:	c3                   	ret
+  800842:	83 ec 0c             	sub    $0xc,%esp
+  800845:	50                   	push   %eax
+  800846:	6a 1a                	push   $0x1a
+  800848:	68 6a 31 80 00       	push   $0x80316a
+  80084d:	6a 24                	push   $0x24
+  80084f:	68 87 31 80 00       	push   $0x803187
+  800854:	e8 0b 19 00 00       	call   802164 <_panic>
+
+00800859 <sys_lease_complete>:
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	57                   	push   %edi
+  80085d:	56                   	push   %esi
+  80085e:	53                   	push   %ebx
+  80085f:	83 ec 0c             	sub    $0xc,%esp
+  800862:	ba 00 00 00 00       	mov    $0x0,%edx
+  800867:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80086c:	89 d1                	mov    %edx,%ecx
+  80086e:	89 d3                	mov    %edx,%ebx
+  800870:	89 d7                	mov    %edx,%edi
+  800872:	89 d6                	mov    %edx,%esi
+  800874:	cd 30                	int    $0x30
+  800876:	85 c0                	test   %eax,%eax
+  800878:	7f 08                	jg     800882 <sys_lease_complete+0x29>
+  80087a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80087d:	5b                   	pop    %ebx
+  80087e:	5e                   	pop    %esi
+  80087f:	5f                   	pop    %edi
+  800880:	5d                   	pop    %ebp
+  800881:	c3                   	ret
+  800882:	83 ec 0c             	sub    $0xc,%esp
+  800885:	50                   	push   %eax
+  800886:	6a 1b                	push   $0x1b
+  800888:	68 6a 31 80 00       	push   $0x80316a
+  80088d:	6a 24                	push   $0x24
+  80088f:	68 87 31 80 00       	push   $0x803187
+  800894:	e8 cb 18 00 00       	call   802164 <_panic>
+
+00800899 <sys_env_set_thisenv>:
+  800899:	55                   	push   %ebp
+  80089a:	89 e5                	mov    %esp,%ebp
+  80089c:	57                   	push   %edi
+  80089d:	56                   	push   %esi
+  80089e:	53                   	push   %ebx
+  80089f:	83 ec 0c             	sub    $0xc,%esp
+  8008a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ad:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8008b2:	89 df                	mov    %ebx,%edi
+  8008b4:	89 de                	mov    %ebx,%esi
+  8008b6:	cd 30                	int    $0x30
+  8008b8:	85 c0                	test   %eax,%eax
+  8008ba:	7f 08                	jg     8008c4 <sys_env_set_thisenv+0x2b>
+  8008bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008bf:	5b                   	pop    %ebx
+  8008c0:	5e                   	pop    %esi
+  8008c1:	5f                   	pop    %edi
+  8008c2:	5d                   	pop    %ebp
+  8008c3:	c3                   	ret
+  8008c4:	83 ec 0c             	sub    $0xc,%esp
+  8008c7:	50                   	push   %eax
+  8008c8:	6a 1c                	push   $0x1c
+  8008ca:	68 6a 31 80 00       	push   $0x80316a
+  8008cf:	6a 24                	push   $0x24
+  8008d1:	68 87 31 80 00       	push   $0x803187
+  8008d6:	e8 89 18 00 00       	call   802164 <_panic>
+
+008008db <sys_env_set_sched>:
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	57                   	push   %edi
+  8008df:	56                   	push   %esi
+  8008e0:	53                   	push   %ebx
+  8008e1:	83 ec 0c             	sub    $0xc,%esp
+  8008e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ef:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8008f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008f7:	89 f7                	mov    %esi,%edi
+  8008f9:	cd 30                	int    $0x30
+  8008fb:	85 c0                	test   %eax,%eax
+  8008fd:	7f 08                	jg     800907 <sys_env_set_sched+0x2c>
+  8008ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800902:	5b                   	pop    %ebx
+  800903:	5e                   	pop    %esi
+  800904:	5f                   	pop    %edi
+  800905:	5d                   	pop    %ebp
+  800906:	c3                   	ret
+  800907:	83 ec 0c             	sub    $0xc,%esp
+  80090a:	50                   	push   %eax
+  80090b:	6a 1d                	push   $0x1d
+  80090d:	68 6a 31 80 00       	push   $0x80316a
+  800912:	6a 24                	push   $0x24
+  800914:	68 87 31 80 00       	push   $0x803187
+  800919:	e8 46 18 00 00       	call   802164 <_panic>
+
+0080091e <sys_batch>:
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	57                   	push   %edi
+  800922:	56                   	push   %esi
+  800923:	53                   	push   %ebx
+  800924:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800929:	8b 55 08             	mov    0x8(%ebp),%edx
+  80092c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80092f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800934:	89 df                	mov    %ebx,%edi
+  800936:	89 de                	mov    %ebx,%esi
+  800938:	cd 30                	int    $0x30
+  80093a:	5b                   	pop    %ebx
+  80093b:	5e                   	pop    %esi
+  80093c:	5f                   	pop    %edi
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <sys_env_stats>:
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	57                   	push   %edi
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+  800945:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80094a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80094d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800950:	b8 23 00 00 00       	mov    $0x23,%eax
+  800955:	89 df                	mov    %ebx,%edi
+  800957:	89 de                	mov    %ebx,%esi
+  800959:	cd 30                	int    $0x30
+  80095b:	5b                   	pop    %ebx
+  80095c:	5e                   	pop    %esi
+  80095d:	5f                   	pop    %edi
+  80095e:	5d                   	pop    %ebp
+  80095f:	c3                   	ret
+
+00800960 <sys_trace>:
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	57                   	push   %edi
+  800964:	56                   	push   %esi
+  800965:	53                   	push   %ebx
+  800966:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80096e:	b8 24 00 00 00       	mov    $0x24,%eax
+  800973:	89 cb                	mov    %ecx,%ebx
+  800975:	89 cf                	mov    %ecx,%edi
+  800977:	89 ce                	mov    %ecx,%esi
+  800979:	cd 30                	int    $0x30
+  80097b:	5b                   	pop    %ebx
+  80097c:	5e                   	pop    %esi
+  80097d:	5f                   	pop    %edi
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+
+00800980 <sys_env_set_pager>:
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	57                   	push   %edi
+  800984:	56                   	push   %esi
+  800985:	53                   	push   %ebx
+  800986:	83 ec 0c             	sub    $0xc,%esp
+  800989:	be 00 00 00 00       	mov    $0x0,%esi
+  80098e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800991:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800994:	b8 25 00 00 00       	mov    $0x25,%eax
+  800999:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80099c:	89 f7                	mov    %esi,%edi
+  80099e:	cd 30                	int    $0x30
+  8009a0:	85 c0                	test   %eax,%eax
+  8009a2:	7f 08                	jg     8009ac <sys_env_set_pager+0x2c>
+  8009a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a7:	5b                   	pop    %ebx
+  8009a8:	5e                   	pop    %esi
+  8009a9:	5f                   	pop    %edi
+  8009aa:	5d                   	pop    %ebp
+  8009ab:	c3                   	ret
+  8009ac:	83 ec 0c             	sub    $0xc,%esp
+  8009af:	50                   	push   %eax
+  8009b0:	6a 25                	push   $0x25
+  8009b2:	68 6a 31 80 00       	push   $0x80316a
+  8009b7:	6a 24                	push   $0x24
+  8009b9:	68 87 31 80 00       	push   $0x803187
+  8009be:	e8 a1 17 00 00       	call   802164 <_panic>
+
+008009c3 <sys_pager_retire>:
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	57                   	push   %edi
+  8009c7:	56                   	push   %esi
+  8009c8:	53                   	push   %ebx
+  8009c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d1:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009d6:	89 cb                	mov    %ecx,%ebx
+  8009d8:	89 cf                	mov    %ecx,%edi
+  8009da:	89 ce                	mov    %ecx,%esi
+  8009dc:	cd 30                	int    $0x30
+  8009de:	5b                   	pop    %ebx
+  8009df:	5e                   	pop    %esi
+  8009e0:	5f                   	pop    %edi
+  8009e1:	5d                   	pop    %ebp
+  8009e2:	c3                   	ret
+
+008009e3 <sys_prof>:
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	57                   	push   %edi
+  8009e7:	56                   	push   %esi
+  8009e8:	53                   	push   %ebx
+  8009e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8009ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f4:	b8 22 00 00 00       	mov    $0x22,%eax
+  8009f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009fc:	89 f7                	mov    %esi,%edi
+  8009fe:	cd 30                	int    $0x30
+  800a00:	5b                   	pop    %ebx
+  800a01:	5e                   	pop    %esi
+  800a02:	5f                   	pop    %edi
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <fd2num>:
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a10:	c1 e8 0c             	shr    $0xc,%eax
+  800a13:	5d                   	pop    %ebp
+  800a14:	c3                   	ret
+
+00800a15 <fd2data>:
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a20:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800a25:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800a2a:	5d                   	pop    %ebp
+  800a2b:	c3                   	ret
+
+00800a2c <fd_alloc>:
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a34:	89 c2                	mov    %eax,%edx
+  800a36:	c1 ea 16             	shr    $0x16,%edx
+  800a39:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800a40:	f6 c2 01             	test   $0x1,%dl
+  800a43:	74 29                	je     800a6e <fd_alloc+0x42>
+  800a45:	89 c2                	mov    %eax,%edx
+  800a47:	c1 ea 0c             	shr    $0xc,%edx
+  800a4a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a51:	f6 c2 01             	test   $0x1,%dl
+  800a54:	74 18                	je     800a6e <fd_alloc+0x42>
+  800a56:	05 00 10 00 00       	add    $0x1000,%eax
+  800a5b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800a60:	75 d2                	jne    800a34 <fd_alloc+0x8>
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a67:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800a6c:	eb 05                	jmp    800a73 <fd_alloc+0x47>
+  800a6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a76:	89 02                	mov    %eax,(%edx)
+  800a78:	89 c8                	mov    %ecx,%eax
+  800a7a:	5d                   	pop    %ebp
+  800a7b:	c3                   	ret
+
+00800a7c <fd_lookup>:
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a82:	83 f8 1f             	cmp    $0x1f,%eax
+  800a85:	77 30                	ja     800ab7 <fd_lookup+0x3b>
+  800a87:	c1 e0 0c             	shl    $0xc,%eax
+  800a8a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800a8f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800a95:	f6 c2 01             	test   $0x1,%dl
+  800a98:	74 24                	je     800abe <fd_lookup+0x42>
+  800a9a:	89 c2                	mov    %eax,%edx
+  800a9c:	c1 ea 0c             	shr    $0xc,%edx
+  800a9f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800aa6:	f6 c2 01             	test   $0x1,%dl
+  800aa9:	74 1a                	je     800ac5 <fd_lookup+0x49>
+  800aab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aae:	89 02                	mov    %eax,(%edx)
+  800ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+  800ab7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800abc:	eb f7                	jmp    800ab5 <fd_lookup+0x39>
+  800abe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac3:	eb f0                	jmp    800ab5 <fd_lookup+0x39>
+  800ac5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aca:	eb e9                	jmp    800ab5 <fd_lookup+0x39>
+
+00800acc <dev_lookup>:
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	53                   	push   %ebx
+  800ad0:	83 ec 04             	sub    $0x4,%esp
+  800ad3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adb:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  800ae0:	39 13                	cmp    %edx,(%ebx)
+  800ae2:	74 37                	je     800b1b <dev_lookup+0x4f>
+  800ae4:	83 c0 01             	add    $0x1,%eax
+  800ae7:	8b 1c 85 14 32 80 00 	mov    0x803214(,%eax,4),%ebx
+  800aee:	85 db                	test   %ebx,%ebx
+  800af0:	75 ee                	jne    800ae0 <dev_lookup+0x14>
+  800af2:	a1 10 50 80 00       	mov    0x805010,%eax
+  800af7:	8b 40 48             	mov    0x48(%eax),%eax
+  800afa:	83 ec 04             	sub    $0x4,%esp
+  800afd:	52                   	push   %edx
+  800afe:	50                   	push   %eax
+  800aff:	68 98 31 80 00       	push   $0x803198
+  800b04:	e8 36 17 00 00       	call   80223f <cprintf>
+  800b09:	83 c4 10             	add    $0x10,%esp
+  800b0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b14:	89 1a                	mov    %ebx,(%edx)
+  800b16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b19:	c9                   	leave
+  800b1a:	c3                   	ret
+  800b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b20:	eb ef                	jmp    800b11 <dev_lookup+0x45>
+
+00800b22 <fd_close>:
+  800b22:	55                   	push   %ebp
+  800b23:	89 e5                	mov    %esp,%ebp
+  800b25:	57                   	push   %edi
+  800b26:	56                   	push   %esi
+  800b27:	53                   	push   %ebx
+  800b28:	83 ec 24             	sub    $0x24,%esp
+  800b2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b31:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b34:	50                   	push   %eax
+  800b35:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b3b:	c1 e8 0c             	shr    $0xc,%eax
+  800b3e:	50                   	push   %eax
+  800b3f:	e8 38 ff ff ff       	call   800a7c <fd_lookup>
+  800b44:	89 c3                	mov    %eax,%ebx
+  800b46:	83 c4 10             	add    $0x10,%esp
+  800b49:	85 c0                	test   %eax,%eax
+  800b4b:	78 05                	js     800b52 <fd_close+0x30>
+  800b4d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800b50:	74 0f                	je     800b61 <fd_close+0x3f>
+  800b52:	85 ff                	test   %edi,%edi
+  800b54:	0f 44 df             	cmove  %edi,%ebx
+  800b57:	89 d8                	mov    %ebx,%eax
+  800b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b5c:	5b                   	pop    %ebx
+  800b5d:	5e                   	pop    %esi
+  800b5e:	5f                   	pop    %edi
+  800b5f:	5d                   	pop    %ebp
+  800b60:	c3                   	ret
+  800b61:	83 ec 08             	sub    $0x8,%esp
+  800b64:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800b67:	50                   	push   %eax
+  800b68:	ff 36                	push   (%esi)
+  800b6a:	e8 5d ff ff ff       	call   800acc <dev_lookup>
+  800b6f:	89 c3                	mov    %eax,%ebx
+  800b71:	83 c4 10             	add    $0x10,%esp
+  800b74:	85 c0                	test   %eax,%eax
+  800b76:	78 1a                	js     800b92 <fd_close+0x70>
+  800b78:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b7b:	8b 40 10             	mov    0x10(%eax),%eax
+  800b7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b83:	85 c0                	test   %eax,%eax
+  800b85:	74 0b                	je     800b92 <fd_close+0x70>
+  800b87:	83 ec 0c             	sub    $0xc,%esp
+  800b8a:	56                   	push   %esi
+  800b8b:	ff d0                	call   *%eax
+  800b8d:	89 c3                	mov    %eax,%ebx
+  800b8f:	83 c4 10             	add    $0x10,%esp
+  800b92:	83 ec 08             	sub    $0x8,%esp
+  800b95:	56                   	push   %esi
+  800b96:	6a 00                	push   $0x0
+  800b98:	e8 cc f6 ff ff       	call   800269 <sys_page_unmap>
+  800b9d:	83 c4 10             	add    $0x10,%esp
+  800ba0:	eb b5                	jmp    800b57 <fd_close+0x35>
+
+00800ba2 <close>:
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	83 ec 20             	sub    $0x20,%esp
+  800ba8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bab:	50                   	push   %eax
+  800bac:	ff 75 08             	push   0x8(%ebp)
+  800baf:	e8 c8 fe ff ff       	call   800a7c <fd_lookup>
+  800bb4:	83 c4 10             	add    $0x10,%esp
+  800bb7:	85 c0                	test   %eax,%eax
+  800bb9:	79 02                	jns    800bbd <close+0x1b>
+  800bbb:	c9                   	leave
+  800bbc:	c3                   	ret
+  800bbd:	83 ec 08             	sub    $0x8,%esp
+  800bc0:	6a 01                	push   $0x1
+  800bc2:	ff 75 f4             	push   -0xc(%ebp)
+  800bc5:	e8 58 ff ff ff       	call   800b22 <fd_close>
+  800bca:	83 c4 10             	add    $0x10,%esp
+  800bcd:	eb ec                	jmp    800bbb <close+0x19>
+
+00800bcf <close_all>:
+  800bcf:	55                   	push   %ebp
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	53                   	push   %ebx
+  800bd3:	83 ec 04             	sub    $0x4,%esp
+  800bd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdb:	83 ec 0c             	sub    $0xc,%esp
+  800bde:	53                   	push   %ebx
+  800bdf:	e8 be ff ff ff       	call   800ba2 <close>
+  800be4:	83 c3 01             	add    $0x1,%ebx
+  800be7:	83 c4 10             	add    $0x10,%esp
+  800bea:	83 fb 20             	cmp    $0x20,%ebx
+  800bed:	75 ec                	jne    800bdb <close_all+0xc>
+  800bef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf2:	c9                   	leave
+  800bf3:	c3                   	ret
+
+00800bf4 <dup>:
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	57                   	push   %edi
+  800bf8:	56                   	push   %esi
+  800bf9:	53                   	push   %ebx
+  800bfa:	83 ec 34             	sub    $0x34,%esp
+  800bfd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c00:	50                   	push   %eax
+  800c01:	ff 75 08             	push   0x8(%ebp)
+  800c04:	e8 73 fe ff ff       	call   800a7c <fd_lookup>
+  800c09:	89 c3                	mov    %eax,%ebx
+  800c0b:	83 c4 10             	add    $0x10,%esp
+  800c0e:	85 c0                	test   %eax,%eax
+  800c10:	78 7f                	js     800c91 <dup+0x9d>
+  800c12:	83 ec 0c             	sub    $0xc,%esp
+  800c15:	ff 75 0c             	push   0xc(%ebp)
+  800c18:	e8 85 ff ff ff       	call   800ba2 <close>
+  800c1d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c20:	c1 e6 0c             	shl    $0xc,%esi
+  800c23:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  800c29:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c2c:	89 3c 24             	mov    %edi,(%esp)
+  800c2f:	e8 e1 fd ff ff       	call   800a15 <fd2data>
+  800c34:	89 c3                	mov    %eax,%ebx
+  800c36:	89 34 24             	mov    %esi,(%esp)
+  800c39:	e8 d7 fd ff ff       	call   800a15 <fd2data>
+  800c3e:	83 c4 10             	add    $0x10,%esp
+  800c41:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c44:	89 d8                	mov    %ebx,%eax
+  800c46:	c1 e8 16             	shr    $0x16,%eax
+  800c49:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800c50:	a8 01                	test   $0x1,%al
+  800c52:	74 11                	je     800c65 <dup+0x71>
+  800c54:	89 d8                	mov    %ebx,%eax
+  800c56:	c1 e8 0c             	shr    $0xc,%eax
+  800c59:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800c60:	f6 c2 01             	test   $0x1,%dl
+  800c63:	75 36                	jne    800c9b <dup+0xa7>
+  800c65:	89 f8                	mov    %edi,%eax
+  800c67:	c1 e8 0c             	shr    $0xc,%eax
+  800c6a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c71:	83 ec 0c             	sub    $0xc,%esp
+  800c74:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c79:	50                   	push   %eax
+  800c7a:	56                   	push   %esi
+  800c7b:	6a 00                	push   $0x0
+  800c7d:	57                   	push   %edi
+  800c7e:	6a 00                	push   $0x0
+  800c80:	e8 55 f5 ff ff       	call   8001da <sys_page_map>
+  800c85:	89 c3                	mov    %eax,%ebx
+  800c87:	83 c4 20             	add    $0x20,%esp
+  800c8a:	85 c0                	test   %eax,%eax
+  800c8c:	78 33                	js     800cc1 <dup+0xcd>
+  800c8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c91:	89 d8                	mov    %ebx,%eax
+  800c93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+  800c9b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800ca2:	83 ec 0c             	sub    $0xc,%esp
+  800ca5:	25 07 0e 00 00       	and    $0xe07,%eax
+  800caa:	50                   	push   %eax
+  800cab:	ff 75 d4             	push   -0x2c(%ebp)
+  800cae:	6a 00                	push   $0x0
+  800cb0:	53                   	push   %ebx
+  800cb1:	6a 00                	push   $0x0
+  800cb3:	e8 22 f5 ff ff       	call   8001da <sys_page_map>
+  800cb8:	89 c3                	mov    %eax,%ebx
+  800cba:	83 c4 20             	add    $0x20,%esp
+  800cbd:	85 c0                	test   %eax,%eax
+  800cbf:	79 a4                	jns    800c65 <dup+0x71>
+  800cc1:	83 ec 08             	sub    $0x8,%esp
+  800cc4:	56                   	push   %esi
+  800cc5:	6a 00                	push   $0x0
+  800cc7:	e8 9d f5 ff ff       	call   800269 <sys_page_unmap>
+  800ccc:	83 c4 08             	add    $0x8,%esp
+  800ccf:	ff 75 d4             	push   -0x2c(%ebp)
+  800cd2:	6a 00                	push   $0x0
+  800cd4:	e8 90 f5 ff ff       	call   800269 <sys_page_unmap>
+  800cd9:	83 c4 10             	add    $0x10,%esp
+  800cdc:	eb b3                	jmp    800c91 <dup+0x9d>
+
+00800cde <read>:
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	56                   	push   %esi
+  800ce2:	53                   	push   %ebx
+  800ce3:	83 ec 18             	sub    $0x18,%esp
+  800ce6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ce9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800cec:	50                   	push   %eax
+  800ced:	56                   	push   %esi
+  800cee:	e8 89 fd ff ff       	call   800a7c <fd_lookup>
+  800cf3:	83 c4 10             	add    $0x10,%esp
+  800cf6:	85 c0                	test   %eax,%eax
+  800cf8:	78 3c                	js     800d36 <read+0x58>
+  800cfa:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800cfd:	83 ec 08             	sub    $0x8,%esp
+  800d00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d03:	50                   	push   %eax
+  800d04:	ff 33                	push   (%ebx)
+  800d06:	e8 c1 fd ff ff       	call   800acc <dev_lookup>
+  800d0b:	83 c4 10             	add    $0x10,%esp
+  800d0e:	85 c0                	test   %eax,%eax
+  800d10:	78 24                	js     800d36 <read+0x58>
+  800d12:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d15:	83 e0 03             	and    $0x3,%eax
+  800d18:	83 f8 01             	cmp    $0x1,%eax
+  800d1b:	74 20                	je     800d3d <read+0x5f>
+  800d1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d20:	8b 40 08             	mov    0x8(%eax),%eax
+  800d23:	85 c0                	test   %eax,%eax
+  800d25:	74 37                	je     800d5e <read+0x80>
+  800d27:	83 ec 04             	sub    $0x4,%esp
+  800d2a:	ff 75 10             	push   0x10(%ebp)
+  800d2d:	ff 75 0c             	push   0xc(%ebp)
+  800d30:	53                   	push   %ebx
+  800d31:	ff d0                	call   *%eax
+  800d33:	83 c4 10             	add    $0x10,%esp
+  800d36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5d                   	pop    %ebp
+  800d3c:	c3                   	ret
+  800d3d:	a1 10 50 80 00       	mov    0x805010,%eax
+  800d42:	8b 40 48             	mov    0x48(%eax),%eax
+  800d45:	83 ec 04             	sub    $0x4,%esp
+  800d48:	56                   	push   %esi
+  800d49:	50                   	push   %eax
+  800d4a:	68 d9 31 80 00       	push   $0x8031d9
+  800d4f:	e8 eb 14 00 00       	call   80223f <cprintf>
+  800d54:	83 c4 10             	add    $0x10,%esp
+  800d57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d5c:	eb d8                	jmp    800d36 <read+0x58>
+  800d5e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d63:	eb d1                	jmp    800d36 <read+0x58>
+
+00800d65 <readn>:
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	57                   	push   %edi
+  800d69:	56                   	push   %esi
+  800d6a:	53                   	push   %ebx
+  800d6b:	83 ec 0c             	sub    $0xc,%esp
+  800d6e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d71:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d74:	85 f6                	test   %esi,%esi
+  800d76:	74 30                	je     800da8 <readn+0x43>
+  800d78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d82:	83 ec 04             	sub    $0x4,%esp
+  800d85:	89 f2                	mov    %esi,%edx
+  800d87:	29 c2                	sub    %eax,%edx
+  800d89:	52                   	push   %edx
+  800d8a:	01 f8                	add    %edi,%eax
+  800d8c:	50                   	push   %eax
+  800d8d:	ff 75 08             	push   0x8(%ebp)
+  800d90:	e8 49 ff ff ff       	call   800cde <read>
+  800d95:	83 c4 10             	add    $0x10,%esp
+  800d98:	85 c0                	test   %eax,%eax
+  800d9a:	78 15                	js     800db1 <readn+0x4c>
+  800d9c:	74 11                	je     800daf <readn+0x4a>
+  800d9e:	01 c3                	add    %eax,%ebx
+  800da0:	89 d8                	mov    %ebx,%eax
+  800da2:	39 f3                	cmp    %esi,%ebx
+  800da4:	72 dc                	jb     800d82 <readn+0x1d>
+  800da6:	eb 09                	jmp    800db1 <readn+0x4c>
+  800da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dad:	eb 02                	jmp    800db1 <readn+0x4c>
+  800daf:	89 d8                	mov    %ebx,%eax
+  800db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db4:	5b                   	pop    %ebx
+  800db5:	5e                   	pop    %esi
+  800db6:	5f                   	pop    %edi
+  800db7:	5d                   	pop    %ebp
+  800db8:	c3                   	ret
+
+00800db9 <write>:
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	83 ec 18             	sub    $0x18,%esp
+  800dc1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dc4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dc7:	50                   	push   %eax
+  800dc8:	53                   	push   %ebx
+  800dc9:	e8 ae fc ff ff       	call   800a7c <fd_lookup>
+  800dce:	83 c4 10             	add    $0x10,%esp
+  800dd1:	85 c0                	test   %eax,%eax
+  800dd3:	78 37                	js     800e0c <write+0x53>
+  800dd5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800dd8:	83 ec 08             	sub    $0x8,%esp
+  800ddb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800dde:	50                   	push   %eax
+  800ddf:	ff 36                	push   (%esi)
+  800de1:	e8 e6 fc ff ff       	call   800acc <dev_lookup>
+  800de6:	83 c4 10             	add    $0x10,%esp
+  800de9:	85 c0                	test   %eax,%eax
+  800deb:	78 1f                	js     800e0c <write+0x53>
+  800ded:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800df1:	74 20                	je     800e13 <write+0x5a>
+  800df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800df6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800df9:	85 c0                	test   %eax,%eax
+  800dfb:	74 37                	je     800e34 <write+0x7b>
+  800dfd:	83 ec 04             	sub    $0x4,%esp
+  800e00:	ff 75 10             	push   0x10(%ebp)
+  800e03:	ff 75 0c             	push   0xc(%ebp)
+  800e06:	56                   	push   %esi
+  800e07:	ff d0                	call   *%eax
+  800e09:	83 c4 10             	add    $0x10,%esp
+  800e0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+  800e13:	a1 10 50 80 00       	mov    0x805010,%eax
+  800e18:	8b 40 48             	mov    0x48(%eax),%eax
+  800e1b:	83 ec 04             	sub    $0x4,%esp
+  800e1e:	53                   	push   %ebx
+  800e1f:	50                   	push   %eax
+  800e20:	68 f5 31 80 00       	push   $0x8031f5
+  800e25:	e8 15 14 00 00       	call   80223f <cprintf>
+  800e2a:	83 c4 10             	add    $0x10,%esp
+  800e2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e32:	eb d8                	jmp    800e0c <write+0x53>
+  800e34:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e39:	eb d1                	jmp    800e0c <write+0x53>
+
+00800e3b <seek>:
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	83 ec 20             	sub    $0x20,%esp
+  800e41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e44:	50                   	push   %eax
+  800e45:	ff 75 08             	push   0x8(%ebp)
+  800e48:	e8 2f fc ff ff       	call   800a7c <fd_lookup>
+  800e4d:	83 c4 10             	add    $0x10,%esp
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	78 0e                	js     800e62 <seek+0x27>
+  800e54:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e5a:	89 50 04             	mov    %edx,0x4(%eax)
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e62:	c9                   	leave
+  800e63:	c3                   	ret
+
+00800e64 <ftruncate>:
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+  800e69:	83 ec 18             	sub    $0x18,%esp
+  800e6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e72:	50                   	push   %eax
+  800e73:	53                   	push   %ebx
+  800e74:	e8 03 fc ff ff       	call   800a7c <fd_lookup>
+  800e79:	83 c4 10             	add    $0x10,%esp
+  800e7c:	85 c0                	test   %eax,%eax
+  800e7e:	78 34                	js     800eb4 <ftruncate+0x50>
+  800e80:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e83:	83 ec 08             	sub    $0x8,%esp
+  800e86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e89:	50                   	push   %eax
+  800e8a:	ff 36                	push   (%esi)
+  800e8c:	e8 3b fc ff ff       	call   800acc <dev_lookup>
+  800e91:	83 c4 10             	add    $0x10,%esp
+  800e94:	85 c0                	test   %eax,%eax
+  800e96:	78 1c                	js     800eb4 <ftruncate+0x50>
+  800e98:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e9c:	74 1d                	je     800ebb <ftruncate+0x57>
+  800e9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea1:	8b 40 18             	mov    0x18(%eax),%eax
+  800ea4:	85 c0                	test   %eax,%eax
+  800ea6:	74 34                	je     800edc <ftruncate+0x78>
+  800ea8:	83 ec 08             	sub    $0x8,%esp
+  800eab:	ff 75 0c             	push   0xc(%ebp)
+  800eae:	56                   	push   %esi
+  800eaf:	ff d0                	call   *%eax
+  800eb1:	83 c4 10             	add    $0x10,%esp
+  800eb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eb7:	5b                   	pop    %ebx
+  800eb8:	5e                   	pop    %esi
+  800eb9:	5d                   	pop    %ebp
+  800eba:	c3                   	ret
+  800ebb:	a1 10 50 80 00       	mov    0x805010,%eax
+  800ec0:	8b 40 48             	mov    0x48(%eax),%eax
+  800ec3:	83 ec 04             	sub    $0x4,%esp
+  800ec6:	53                   	push   %ebx
+  800ec7:	50                   	push   %eax
+  800ec8:	68 b8 31 80 00       	push   $0x8031b8
+  800ecd:	e8 6d 13 00 00       	call   80223f <cprintf>
+  800ed2:	83 c4 10             	add    $0x10,%esp
+  800ed5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800eda:	eb d8                	jmp    800eb4 <ftruncate+0x50>
+  800edc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ee1:	eb d1                	jmp    800eb4 <ftruncate+0x50>
+
+00800ee3 <fstat>:
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	56                   	push   %esi
+  800ee7:	53                   	push   %ebx
+  800ee8:	83 ec 18             	sub    $0x18,%esp
+  800eeb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800eee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ef1:	50                   	push   %eax
+  800ef2:	ff 75 08             	push   0x8(%ebp)
+  800ef5:	e8 82 fb ff ff       	call   800a7c <fd_lookup>
+  800efa:	83 c4 10             	add    $0x10,%esp
+  800efd:	85 c0                	test   %eax,%eax
+  800eff:	78 49                	js     800f4a <fstat+0x67>
+  800f01:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f04:	83 ec 08             	sub    $0x8,%esp
+  800f07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f0a:	50                   	push   %eax
+  800f0b:	ff 36                	push   (%esi)
+  800f0d:	e8 ba fb ff ff       	call   800acc <dev_lookup>
+  800f12:	83 c4 10             	add    $0x10,%esp
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	78 31                	js     800f4a <fstat+0x67>
+  800f19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f1c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f20:	74 2f                	je     800f51 <fstat+0x6e>
+  800f22:	c6 03 00             	movb   $0x0,(%ebx)
+  800f25:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f2c:	00 00 00 
+  800f2f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f36:	00 00 00 
+  800f39:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  800f3f:	83 ec 08             	sub    $0x8,%esp
+  800f42:	53                   	push   %ebx
+  800f43:	56                   	push   %esi
+  800f44:	ff 50 14             	call   *0x14(%eax)
+  800f47:	83 c4 10             	add    $0x10,%esp
+  800f4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+  800f51:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f56:	eb f2                	jmp    800f4a <fstat+0x67>
+
+00800f58 <stat>:
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	56                   	push   %esi
+  800f5c:	53                   	push   %ebx
+  800f5d:	83 ec 08             	sub    $0x8,%esp
+  800f60:	6a 00                	push   $0x0
+  800f62:	ff 75 08             	push   0x8(%ebp)
+  800f65:	e8 31 05 00 00       	call   80149b <open>
+  800f6a:	89 c3                	mov    %eax,%ebx
+  800f6c:	83 c4 10             	add    $0x10,%esp
+  800f6f:	85 c0                	test   %eax,%eax
+  800f71:	78 1b                	js     800f8e <stat+0x36>
+  800f73:	83 ec 08             	sub    $0x8,%esp
+  800f76:	ff 75 0c             	push   0xc(%ebp)
+  800f79:	50                   	push   %eax
+  800f7a:	e8 64 ff ff ff       	call   800ee3 <fstat>
+  800f7f:	89 c6                	mov    %eax,%esi
+  800f81:	89 1c 24             	mov    %ebx,(%esp)
+  800f84:	e8 19 fc ff ff       	call   800ba2 <close>
+  800f89:	83 c4 10             	add    $0x10,%esp
+  800f8c:	89 f3                	mov    %esi,%ebx
+  800f8e:	89 d8                	mov    %ebx,%eax
+  800f90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+
+00800f97 <fsipc>:
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	56                   	push   %esi
+  800f9b:	53                   	push   %ebx
+  800f9c:	89 c3                	mov    %eax,%ebx
+  800f9e:	89 d6                	mov    %edx,%esi
+  800fa0:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800fa7:	74 20                	je     800fc9 <fsipc+0x32>
+  800fa9:	83 ec 08             	sub    $0x8,%esp
+  800fac:	6a 00                	push   $0x0
+  800fae:	56                   	push   %esi
+  800faf:	6a 07                	push   $0x7
+  800fb1:	68 00 60 80 00       	push   $0x806000
+  800fb6:	53                   	push   %ebx
+  800fb7:	ff 35 08 50 80 00    	push   0x805008
+  800fbd:	e8 a4 1d 00 00       	call   802d66 <ipc_call>
+  800fc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc5:	5b                   	pop    %ebx
+  800fc6:	5e                   	pop    %esi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+  800fc9:	83 ec 0c             	sub    $0xc,%esp
+  800fcc:	6a 02                	push   $0x2
+  800fce:	e8 2e 1f 00 00       	call   802f01 <ipc_find_env>
+  800fd3:	a3 08 50 80 00       	mov    %eax,0x805008
+  800fd8:	83 c4 10             	add    $0x10,%esp
+  800fdb:	eb cc                	jmp    800fa9 <fsipc+0x12>
+
+00800fdd <devfile_trunc>:
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	83 ec 08             	sub    $0x8,%esp
+  800fe3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe6:	8b 40 0c             	mov    0xc(%eax),%eax
+  800fe9:	a3 00 60 80 00       	mov    %eax,0x806000
+  800fee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff1:	a3 04 60 80 00       	mov    %eax,0x806004
+  800ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801000:	e8 92 ff ff ff       	call   800f97 <fsipc>
+  801005:	c9                   	leave
+  801006:	c3                   	ret
+
+00801007 <devfile_flush>:
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	83 ec 08             	sub    $0x8,%esp
+  80100d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801010:	8b 40 0c             	mov    0xc(%eax),%eax
+  801013:	a3 00 60 80 00       	mov    %eax,0x806000
+  801018:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801022:	e8 70 ff ff ff       	call   800f97 <fsipc>
+  801027:	c9                   	leave
+  801028:	c3                   	ret
+
+00801029 <devfile_stat>:
+  801029:	55                   	push   %ebp
+  80102a:	89 e5                	mov    %esp,%ebp
+  80102c:	53                   	push   %ebx
+  80102d:	83 ec 04             	sub    $0x4,%esp
+  801030:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801033:	8b 45 08             	mov    0x8(%ebp),%eax
+  801036:	8b 40 0c             	mov    0xc(%eax),%eax
+  801039:	a3 00 60 80 00       	mov    %eax,0x806000
+  80103e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801043:	b8 07 00 00 00       	mov    $0x7,%eax
+  801048:	e8 4a ff ff ff       	call   800f97 <fsipc>
+  80104d:	85 c0                	test   %eax,%eax
+  80104f:	78 2c                	js     80107d <devfile_stat+0x54>
+  801051:	83 ec 08             	sub    $0x8,%esp
+  801054:	68 00 60 80 00       	push   $0x806000
+  801059:	53                   	push   %ebx
+  80105a:	e8 d7 18 00 00       	call   802936 <strcpy>
+  80105f:	a1 80 60 80 00       	mov    0x806080,%eax
+  801064:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80106a:	a1 84 60 80 00       	mov    0x806084,%eax
+  80106f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801075:	83 c4 10             	add    $0x10,%esp
+  801078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+00801082 <fsring_rw>:
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	83 ec 2c             	sub    $0x2c,%esp
+  80108b:	89 c7                	mov    %eax,%edi
+  80108d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801090:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801093:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801098:	a8 01                	test   $0x1,%al
+  80109a:	74 0d                	je     8010a9 <fsring_rw+0x27>
+  80109c:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8010a1:	a8 01                	test   $0x1,%al
+  8010a3:	0f 85 d5 00 00 00    	jne    80117e <fsring_rw+0xfc>
+  8010a9:	a1 10 50 80 00       	mov    0x805010,%eax
+  8010ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8010b1:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  8010b7:	0f 84 fc 00 00 00    	je     8011b9 <fsring_rw+0x137>
+  8010bd:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8010c4:	0f 84 02 01 00 00    	je     8011cc <fsring_rw+0x14a>
+  8010ca:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8010cf:	83 ec 04             	sub    $0x4,%esp
+  8010d2:	68 07 02 00 00       	push   $0x207
+  8010d7:	53                   	push   %ebx
+  8010d8:	6a 00                	push   $0x0
+  8010da:	e8 b8 f0 ff ff       	call   800197 <sys_page_alloc>
+  8010df:	83 c4 10             	add    $0x10,%esp
+  8010e2:	85 c0                	test   %eax,%eax
+  8010e4:	0f 88 f9 00 00 00    	js     8011e3 <fsring_rw+0x161>
+  8010ea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010f0:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8010f6:	75 d7                	jne    8010cf <fsring_rw+0x4d>
+  8010f8:	6a 0e                	push   $0xe
+  8010fa:	6a 0d                	push   $0xd
+  8010fc:	ff 35 08 50 80 00    	push   0x805008
+  801102:	68 00 00 f0 cf       	push   $0xcff00000
+  801107:	e8 c4 0c 00 00       	call   801dd0 <ipcring_init>
+  80110c:	83 c4 08             	add    $0x8,%esp
+  80110f:	6a 00                	push   $0x0
+  801111:	6a 00                	push   $0x0
+  801113:	68 07 02 00 00       	push   $0x207
+  801118:	68 00 00 f0 cf       	push   $0xcff00000
+  80111d:	6a 0b                	push   $0xb
+  80111f:	ff 35 08 50 80 00    	push   0x805008
+  801125:	e8 3c 1c 00 00       	call   802d66 <ipc_call>
+  80112a:	89 c6                	mov    %eax,%esi
+  80112c:	83 c4 20             	add    $0x20,%esp
+  80112f:	85 c0                	test   %eax,%eax
+  801131:	0f 88 ac 00 00 00    	js     8011e3 <fsring_rw+0x161>
+  801137:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113c:	89 d9                	mov    %ebx,%ecx
+  80113e:	83 c3 01             	add    $0x1,%ebx
+  801141:	89 da                	mov    %ebx,%edx
+  801143:	c1 e2 0c             	shl    $0xc,%edx
+  801146:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80114c:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801152:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801158:	83 ec 08             	sub    $0x8,%esp
+  80115b:	6a 00                	push   $0x0
+  80115d:	6a 00                	push   $0x0
+  80115f:	68 07 02 00 00       	push   $0x207
+  801164:	50                   	push   %eax
+  801165:	6a 0c                	push   $0xc
+  801167:	ff 35 08 50 80 00    	push   0x805008
+  80116d:	e8 f4 1b 00 00       	call   802d66 <ipc_call>
+  801172:	83 c4 20             	add    $0x20,%esp
+  801175:	85 c0                	test   %eax,%eax
+  801177:	78 6a                	js     8011e3 <fsring_rw+0x161>
+  801179:	83 fb 08             	cmp    $0x8,%ebx
+  80117c:	75 be                	jne    80113c <fsring_rw+0xba>
+  80117e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801182:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801187:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80118c:	0f 45 c2             	cmovne %edx,%eax
+  80118f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801192:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801199:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8011a0:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8011a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b1:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8011b4:	e9 4b 01 00 00       	jmp    801304 <fsring_rw+0x282>
+  8011b9:	e8 a3 f3 ff ff       	call   800561 <sys_time_msec>
+  8011be:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  8011c4:	0f 89 f3 fe ff ff    	jns    8010bd <fsring_rw+0x3b>
+  8011ca:	eb 54                	jmp    801220 <fsring_rw+0x19e>
+  8011cc:	83 ec 0c             	sub    $0xc,%esp
+  8011cf:	6a 02                	push   $0x2
+  8011d1:	e8 2b 1d 00 00       	call   802f01 <ipc_find_env>
+  8011d6:	a3 08 50 80 00       	mov    %eax,0x805008
+  8011db:	83 c4 10             	add    $0x10,%esp
+  8011de:	e9 e7 fe ff ff       	jmp    8010ca <fsring_rw+0x48>
+  8011e3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8011e8:	83 ec 08             	sub    $0x8,%esp
+  8011eb:	53                   	push   %ebx
+  8011ec:	6a 00                	push   $0x0
+  8011ee:	e8 76 f0 ff ff       	call   800269 <sys_page_unmap>
+  8011f3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011f9:	83 c4 10             	add    $0x10,%esp
+  8011fc:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801202:	75 e4                	jne    8011e8 <fsring_rw+0x166>
+  801204:	e8 58 f3 ff ff       	call   800561 <sys_time_msec>
+  801209:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80120e:	a3 00 50 80 00       	mov    %eax,0x805000
+  801213:	a1 10 50 80 00       	mov    0x805010,%eax
+  801218:	8b 40 48             	mov    0x48(%eax),%eax
+  80121b:	a3 04 50 80 00       	mov    %eax,0x805004
+  801220:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801227:	e9 7a 01 00 00       	jmp    8013a6 <fsring_rw+0x324>
+  80122c:	8b 57 0c             	mov    0xc(%edi),%edx
+  80122f:	89 10                	mov    %edx,(%eax)
+  801231:	89 58 04             	mov    %ebx,0x4(%eax)
+  801234:	89 f2                	mov    %esi,%edx
+  801236:	03 57 04             	add    0x4(%edi),%edx
+  801239:	89 50 08             	mov    %edx,0x8(%eax)
+  80123c:	83 ec 04             	sub    $0x4,%esp
+  80123f:	53                   	push   %ebx
+  801240:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801243:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801246:	52                   	push   %edx
+  801247:	83 c0 0c             	add    $0xc,%eax
+  80124a:	50                   	push   %eax
+  80124b:	e8 96 18 00 00       	call   802ae6 <memmove>
+  801250:	83 c4 10             	add    $0x10,%esp
+  801253:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801256:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801259:	89 08                	mov    %ecx,(%eax)
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+  80125e:	68 00 00 f0 cf       	push   $0xcff00000
+  801263:	e8 c6 0b 00 00       	call   801e2e <ipcring_req_push>
+  801268:	01 de                	add    %ebx,%esi
+  80126a:	83 c4 10             	add    $0x10,%esp
+  80126d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801270:	73 4c                	jae    8012be <fsring_rw+0x23c>
+  801272:	83 ec 0c             	sub    $0xc,%esp
+  801275:	68 00 00 f0 cf       	push   $0xcff00000
+  80127a:	e8 89 0b 00 00       	call   801e08 <ipcring_req_slot>
+  80127f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801282:	83 c4 10             	add    $0x10,%esp
+  801285:	85 c0                	test   %eax,%eax
+  801287:	74 35                	je     8012be <fsring_rw+0x23c>
+  801289:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80128e:	83 e0 07             	and    $0x7,%eax
+  801291:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801296:	c1 e0 0c             	shl    $0xc,%eax
+  801299:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80129c:	29 f3                	sub    %esi,%ebx
+  80129e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012a1:	39 cb                	cmp    %ecx,%ebx
+  8012a3:	0f 47 d9             	cmova  %ecx,%ebx
+  8012a6:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8012aa:	75 80                	jne    80122c <fsring_rw+0x1aa>
+  8012ac:	8b 57 0c             	mov    0xc(%edi),%edx
+  8012af:	89 10                	mov    %edx,(%eax)
+  8012b1:	89 58 04             	mov    %ebx,0x4(%eax)
+  8012b4:	89 f2                	mov    %esi,%edx
+  8012b6:	03 57 04             	add    0x4(%edi),%edx
+  8012b9:	89 50 08             	mov    %edx,0x8(%eax)
+  8012bc:	eb 95                	jmp    801253 <fsring_rw+0x1d1>
+  8012be:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8012c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8012c6:	83 ec 0c             	sub    $0xc,%esp
+  8012c9:	68 00 00 f0 cf       	push   $0xcff00000
+  8012ce:	e8 94 0b 00 00       	call   801e67 <ipcring_rsp_wait>
+  8012d3:	8b 58 04             	mov    0x4(%eax),%ebx
+  8012d6:	83 c4 10             	add    $0x10,%esp
+  8012d9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8012dd:	75 45                	jne    801324 <fsring_rw+0x2a2>
+  8012df:	85 db                	test   %ebx,%ebx
+  8012e1:	79 41                	jns    801324 <fsring_rw+0x2a2>
+  8012e3:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8012e6:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8012ed:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	68 00 00 f0 cf       	push   $0xcff00000
+  8012fc:	e8 cc 0b 00 00       	call   801ecd <ipcring_rsp_pop>
+  801301:	83 c4 10             	add    $0x10,%esp
+  801304:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80130a:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80130f:	39 c2                	cmp    %eax,%edx
+  801311:	74 75                	je     801388 <fsring_rw+0x306>
+  801313:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801317:	75 a5                	jne    8012be <fsring_rw+0x23c>
+  801319:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80131c:	0f 82 50 ff ff ff    	jb     801272 <fsring_rw+0x1f0>
+  801322:	eb 9a                	jmp    8012be <fsring_rw+0x23c>
+  801324:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801328:	75 ca                	jne    8012f4 <fsring_rw+0x272>
+  80132a:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80132e:	74 31                	je     801361 <fsring_rw+0x2df>
+  801330:	8b 45 08             	mov    0x8(%ebp),%eax
+  801333:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801336:	29 c8                	sub    %ecx,%eax
+  801338:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80133b:	39 d0                	cmp    %edx,%eax
+  80133d:	0f 47 c2             	cmova  %edx,%eax
+  801340:	39 d8                	cmp    %ebx,%eax
+  801342:	ba 01 00 00 00       	mov    $0x1,%edx
+  801347:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80134b:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80134e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801353:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801357:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80135a:	01 d9                	add    %ebx,%ecx
+  80135c:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80135f:	eb 93                	jmp    8012f4 <fsring_rw+0x272>
+  801361:	83 ec 04             	sub    $0x4,%esp
+  801364:	53                   	push   %ebx
+  801365:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801368:	83 e0 07             	and    $0x7,%eax
+  80136b:	c1 e0 0c             	shl    $0xc,%eax
+  80136e:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801374:	50                   	push   %eax
+  801375:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801378:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80137b:	01 c8                	add    %ecx,%eax
+  80137d:	50                   	push   %eax
+  80137e:	e8 63 17 00 00       	call   802ae6 <memmove>
+  801383:	83 c4 10             	add    $0x10,%esp
+  801386:	eb a8                	jmp    801330 <fsring_rw+0x2ae>
+  801388:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80138c:	75 09                	jne    801397 <fsring_rw+0x315>
+  80138e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801391:	0f 82 db fe ff ff    	jb     801272 <fsring_rw+0x1f0>
+  801397:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80139a:	01 57 04             	add    %edx,0x4(%edi)
+  80139d:	85 d2                	test   %edx,%edx
+  80139f:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8013a3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8013a6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8013a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ac:	5b                   	pop    %ebx
+  8013ad:	5e                   	pop    %esi
+  8013ae:	5f                   	pop    %edi
+  8013af:	5d                   	pop    %ebp
+  8013b0:	c3                   	ret
+
+008013b1 <devfile_write>:
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	57                   	push   %edi
+  8013b5:	56                   	push   %esi
+  8013b6:	53                   	push   %ebx
+  8013b7:	83 ec 0c             	sub    $0xc,%esp
+  8013ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c3:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8013c9:	76 1a                	jbe    8013e5 <devfile_write+0x34>
+  8013cb:	83 ec 0c             	sub    $0xc,%esp
+  8013ce:	53                   	push   %ebx
+  8013cf:	89 f1                	mov    %esi,%ecx
+  8013d1:	ba 06 00 00 00       	mov    $0x6,%edx
+  8013d6:	89 f8                	mov    %edi,%eax
+  8013d8:	e8 a5 fc ff ff       	call   801082 <fsring_rw>
+  8013dd:	83 c4 10             	add    $0x10,%esp
+  8013e0:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8013e3:	75 39                	jne    80141e <devfile_write+0x6d>
+  8013e5:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8013ea:	39 c3                	cmp    %eax,%ebx
+  8013ec:	0f 47 d8             	cmova  %eax,%ebx
+  8013ef:	8b 47 0c             	mov    0xc(%edi),%eax
+  8013f2:	a3 00 60 80 00       	mov    %eax,0x806000
+  8013f7:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8013fd:	83 ec 04             	sub    $0x4,%esp
+  801400:	53                   	push   %ebx
+  801401:	56                   	push   %esi
+  801402:	68 08 60 80 00       	push   $0x806008
+  801407:	e8 da 16 00 00       	call   802ae6 <memmove>
+  80140c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801411:	b8 04 00 00 00       	mov    $0x4,%eax
+  801416:	e8 7c fb ff ff       	call   800f97 <fsipc>
+  80141b:	83 c4 10             	add    $0x10,%esp
+  80141e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801421:	5b                   	pop    %ebx
+  801422:	5e                   	pop    %esi
+  801423:	5f                   	pop    %edi
+  801424:	5d                   	pop    %ebp
+  801425:	c3                   	ret
+
+00801426 <devfile_read>:
+  801426:	55                   	push   %ebp
+  801427:	89 e5                	mov    %esp,%ebp
+  801429:	57                   	push   %edi
+  80142a:	56                   	push   %esi
+  80142b:	53                   	push   %ebx
+  80142c:	83 ec 0c             	sub    $0xc,%esp
+  80142f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801432:	8b 75 10             	mov    0x10(%ebp),%esi
+  801435:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80143b:	76 1d                	jbe    80145a <devfile_read+0x34>
+  80143d:	83 ec 0c             	sub    $0xc,%esp
+  801440:	56                   	push   %esi
+  801441:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801444:	ba 05 00 00 00       	mov    $0x5,%edx
+  801449:	89 f8                	mov    %edi,%eax
+  80144b:	e8 32 fc ff ff       	call   801082 <fsring_rw>
+  801450:	89 c3                	mov    %eax,%ebx
+  801452:	83 c4 10             	add    $0x10,%esp
+  801455:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801458:	75 37                	jne    801491 <devfile_read+0x6b>
+  80145a:	8b 47 0c             	mov    0xc(%edi),%eax
+  80145d:	a3 00 60 80 00       	mov    %eax,0x806000
+  801462:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801472:	e8 20 fb ff ff       	call   800f97 <fsipc>
+  801477:	89 c3                	mov    %eax,%ebx
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	78 14                	js     801491 <devfile_read+0x6b>
+  80147d:	83 ec 04             	sub    $0x4,%esp
+  801480:	50                   	push   %eax
+  801481:	68 00 60 80 00       	push   $0x806000
+  801486:	ff 75 0c             	push   0xc(%ebp)
+  801489:	e8 58 16 00 00       	call   802ae6 <memmove>
+  80148e:	83 c4 10             	add    $0x10,%esp
+  801491:	89 d8                	mov    %ebx,%eax
+  801493:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801496:	5b                   	pop    %ebx
+  801497:	5e                   	pop    %esi
+  801498:	5f                   	pop    %edi
+  801499:	5d                   	pop    %ebp
+  80149a:	c3                   	ret
+
+0080149b <open>:
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	56                   	push   %esi
+  80149f:	53                   	push   %ebx
+  8014a0:	83 ec 1c             	sub    $0x1c,%esp
+  8014a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a6:	56                   	push   %esi
+  8014a7:	e8 3e 14 00 00       	call   8028ea <strlen>
+  8014ac:	83 c4 10             	add    $0x10,%esp
+  8014af:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8014b4:	7f 6c                	jg     801522 <open+0x87>
+  8014b6:	83 ec 0c             	sub    $0xc,%esp
+  8014b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014bc:	50                   	push   %eax
+  8014bd:	e8 6a f5 ff ff       	call   800a2c <fd_alloc>
+  8014c2:	89 c3                	mov    %eax,%ebx
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	78 3c                	js     801507 <open+0x6c>
+  8014cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014ce:	a3 00 64 80 00       	mov    %eax,0x806400
+  8014d3:	83 ec 08             	sub    $0x8,%esp
+  8014d6:	56                   	push   %esi
+  8014d7:	68 00 60 80 00       	push   $0x806000
+  8014dc:	e8 55 14 00 00       	call   802936 <strcpy>
+  8014e1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8014e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014e9:	e8 a9 fa ff ff       	call   800f97 <fsipc>
+  8014ee:	89 c3                	mov    %eax,%ebx
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	78 19                	js     801510 <open+0x75>
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	ff 75 f4             	push   -0xc(%ebp)
+  8014fd:	e8 03 f5 ff ff       	call   800a05 <fd2num>
+  801502:	89 c3                	mov    %eax,%ebx
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	89 d8                	mov    %ebx,%eax
+  801509:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150c:	5b                   	pop    %ebx
+  80150d:	5e                   	pop    %esi
+  80150e:	5d                   	pop    %ebp
+  80150f:	c3                   	ret
+  801510:	83 ec 08             	sub    $0x8,%esp
+  801513:	6a 00                	push   $0x0
+  801515:	ff 75 f4             	push   -0xc(%ebp)
+  801518:	e8 05 f6 ff ff       	call   800b22 <fd_close>
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	eb e5                	jmp    801507 <open+0x6c>
+  801522:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801527:	eb de                	jmp    801507 <open+0x6c>
+
+00801529 <file_image>:
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	53                   	push   %ebx
+  80152d:	83 ec 1c             	sub    $0x1c,%esp
+  801530:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801533:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801536:	50                   	push   %eax
+  801537:	ff 75 08             	push   0x8(%ebp)
+  80153a:	e8 3d f5 ff ff       	call   800a7c <fd_lookup>
+  80153f:	83 c4 10             	add    $0x10,%esp
+  801542:	85 c0                	test   %eax,%eax
+  801544:	78 58                	js     80159e <file_image+0x75>
+  801546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801549:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80154f:	39 08                	cmp    %ecx,(%eax)
+  801551:	75 50                	jne    8015a3 <file_image+0x7a>
+  801553:	83 fb 04             	cmp    $0x4,%ebx
+  801556:	77 52                	ja     8015aa <file_image+0x81>
+  801558:	8b 40 0c             	mov    0xc(%eax),%eax
+  80155b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801560:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801566:	83 ec 04             	sub    $0x4,%esp
+  801569:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80156c:	c1 e0 02             	shl    $0x2,%eax
+  80156f:	50                   	push   %eax
+  801570:	ff 75 0c             	push   0xc(%ebp)
+  801573:	68 08 60 80 00       	push   $0x806008
+  801578:	e8 69 15 00 00       	call   802ae6 <memmove>
+  80157d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801582:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801587:	e8 0b fa ff ff       	call   800f97 <fsipc>
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	78 0b                	js     80159e <file_image+0x75>
+  801593:	8b 55 14             	mov    0x14(%ebp),%edx
+  801596:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80159c:	89 0a                	mov    %ecx,(%edx)
+  80159e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a1:	c9                   	leave
+  8015a2:	c3                   	ret
+  8015a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015a8:	eb f4                	jmp    80159e <file_image+0x75>
+  8015aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015af:	eb ed                	jmp    80159e <file_image+0x75>
+
+008015b1 <remove>:
+  8015b1:	55                   	push   %ebp
+  8015b2:	89 e5                	mov    %esp,%ebp
+  8015b4:	53                   	push   %ebx
+  8015b5:	83 ec 10             	sub    $0x10,%esp
+  8015b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8015bb:	53                   	push   %ebx
+  8015bc:	e8 29 13 00 00       	call   8028ea <strlen>
+  8015c1:	83 c4 10             	add    $0x10,%esp
+  8015c4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015c9:	7f 25                	jg     8015f0 <remove+0x3f>
+  8015cb:	83 ec 08             	sub    $0x8,%esp
+  8015ce:	53                   	push   %ebx
+  8015cf:	68 00 60 80 00       	push   $0x806000
+  8015d4:	e8 5d 13 00 00       	call   802936 <strcpy>
+  8015d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015e3:	e8 af f9 ff ff       	call   800f97 <fsipc>
+  8015e8:	83 c4 10             	add    $0x10,%esp
+  8015eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ee:	c9                   	leave
+  8015ef:	c3                   	ret
+  8015f0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8015f5:	eb f4                	jmp    8015eb <remove+0x3a>
+
+008015f7 <sync>:
+  8015f7:	55                   	push   %ebp
+  8015f8:	89 e5                	mov    %esp,%ebp
+  8015fa:	83 ec 08             	sub    $0x8,%esp
+  8015fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801602:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801607:	e8 8b f9 ff ff       	call   800f97 <fsipc>
+  80160c:	c9                   	leave
+  80160d:	c3                   	ret
+
+0080160e <devsock_stat>:
+  80160e:	55                   	push   %ebp
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	83 ec 10             	sub    $0x10,%esp
+  801614:	68 28 32 80 00       	push   $0x803228
+  801619:	ff 75 0c             	push   0xc(%ebp)
+  80161c:	e8 15 13 00 00       	call   802936 <strcpy>
+  801621:	b8 00 00 00 00       	mov    $0x0,%eax
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+
+00801628 <devsock_close>:
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	53                   	push   %ebx
+  80162c:	83 ec 10             	sub    $0x10,%esp
+  80162f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801632:	53                   	push   %ebx
+  801633:	e8 e3 18 00 00       	call   802f1b <pageref>
+  801638:	89 c2                	mov    %eax,%edx
+  80163a:	83 c4 10             	add    $0x10,%esp
+  80163d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801642:	83 fa 01             	cmp    $0x1,%edx
+  801645:	74 05                	je     80164c <devsock_close+0x24>
+  801647:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80164a:	c9                   	leave
+  80164b:	c3                   	ret
+  80164c:	83 ec 0c             	sub    $0xc,%esp
+  80164f:	ff 73 0c             	push   0xc(%ebx)
+  801652:	e8 aa 02 00 00       	call   801901 <nsipc_close>
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	eb eb                	jmp    801647 <devsock_close+0x1f>
+
+0080165c <devsock_write>:
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  80165f:	83 ec 08             	sub    $0x8,%esp
+  801662:	6a 00                	push   $0x0
+  801664:	ff 75 10             	push   0x10(%ebp)
+  801667:	ff 75 0c             	push   0xc(%ebp)
+  80166a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166d:	ff 70 0c             	push   0xc(%eax)
+  801670:	e8 6c 03 00 00       	call   8019e1 <nsipc_send>
+  801675:	c9                   	leave
+  801676:	c3                   	ret
+
+00801677 <devsock_read>:
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	83 ec 08             	sub    $0x8,%esp
+  80167d:	6a 00                	push   $0x0
+  80167f:	ff 75 10             	push   0x10(%ebp)
+  801682:	ff 75 0c             	push   0xc(%ebp)
+  801685:	8b 45 08             	mov    0x8(%ebp),%eax
+  801688:	ff 70 0c             	push   0xc(%eax)
+  80168b:	e8 e2 02 00 00       	call   801972 <nsipc_recv>
+  801690:	c9                   	leave
+  801691:	c3                   	ret
+
+00801692 <fd2sockid>:
+  801692:	55                   	push   %ebp
+  801693:	89 e5                	mov    %esp,%ebp
+  801695:	83 ec 20             	sub    $0x20,%esp
+  801698:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80169b:	52                   	push   %edx
+  80169c:	50                   	push   %eax
+  80169d:	e8 da f3 ff ff       	call   800a7c <fd_lookup>
+  8016a2:	83 c4 10             	add    $0x10,%esp
+  8016a5:	85 c0                	test   %eax,%eax
+  8016a7:	78 10                	js     8016b9 <fd2sockid+0x27>
+  8016a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ac:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8016b2:	39 08                	cmp    %ecx,(%eax)
+  8016b4:	75 05                	jne    8016bb <fd2sockid+0x29>
+  8016b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016b9:	c9                   	leave
+  8016ba:	c3                   	ret
+  8016bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c0:	eb f7                	jmp    8016b9 <fd2sockid+0x27>
+
+008016c2 <alloc_sockfd>:
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	56                   	push   %esi
+  8016c6:	53                   	push   %ebx
+  8016c7:	83 ec 1c             	sub    $0x1c,%esp
+  8016ca:	89 c6                	mov    %eax,%esi
+  8016cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cf:	50                   	push   %eax
+  8016d0:	e8 57 f3 ff ff       	call   800a2c <fd_alloc>
+  8016d5:	89 c3                	mov    %eax,%ebx
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 43                	js     801721 <alloc_sockfd+0x5f>
+  8016de:	83 ec 04             	sub    $0x4,%esp
+  8016e1:	68 07 04 00 00       	push   $0x407
+  8016e6:	ff 75 f4             	push   -0xc(%ebp)
+  8016e9:	6a 00                	push   $0x0
+  8016eb:	e8 a7 ea ff ff       	call   800197 <sys_page_alloc>
+  8016f0:	89 c3                	mov    %eax,%ebx
+  8016f2:	83 c4 10             	add    $0x10,%esp
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	78 28                	js     801721 <alloc_sockfd+0x5f>
+  8016f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016fc:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801702:	89 10                	mov    %edx,(%eax)
+  801704:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801707:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80170e:	89 70 0c             	mov    %esi,0xc(%eax)
+  801711:	83 ec 0c             	sub    $0xc,%esp
+  801714:	50                   	push   %eax
+  801715:	e8 eb f2 ff ff       	call   800a05 <fd2num>
+  80171a:	89 c3                	mov    %eax,%ebx
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	eb 0c                	jmp    80172d <alloc_sockfd+0x6b>
+  801721:	83 ec 0c             	sub    $0xc,%esp
+  801724:	56                   	push   %esi
+  801725:	e8 d7 01 00 00       	call   801901 <nsipc_close>
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	89 d8                	mov    %ebx,%eax
+  80172f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801732:	5b                   	pop    %ebx
+  801733:	5e                   	pop    %esi
+  801734:	5d                   	pop    %ebp
+  801735:	c3                   	ret
+
+00801736 <accept>:
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	83 ec 08             	sub    $0x8,%esp
+  80173c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80173f:	e8 4e ff ff ff       	call   801692 <fd2sockid>
+  801744:	85 c0                	test   %eax,%eax
+  801746:	78 1b                	js     801763 <accept+0x2d>
+  801748:	83 ec 04             	sub    $0x4,%esp
+  80174b:	ff 75 10             	push   0x10(%ebp)
+  80174e:	ff 75 0c             	push   0xc(%ebp)
+  801751:	50                   	push   %eax
+  801752:	e8 07 01 00 00       	call   80185e <nsipc_accept>
+  801757:	83 c4 10             	add    $0x10,%esp
+  80175a:	85 c0                	test   %eax,%eax
+  80175c:	78 05                	js     801763 <accept+0x2d>
+  80175e:	e8 5f ff ff ff       	call   8016c2 <alloc_sockfd>
+  801763:	c9                   	leave
+  801764:	c3                   	ret
+
+00801765 <bind>:
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+  801768:	83 ec 08             	sub    $0x8,%esp
+  80176b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176e:	e8 1f ff ff ff       	call   801692 <fd2sockid>
+  801773:	85 c0                	test   %eax,%eax
+  801775:	78 12                	js     801789 <bind+0x24>
+  801777:	83 ec 04             	sub    $0x4,%esp
+  80177a:	ff 75 10             	push   0x10(%ebp)
+  80177d:	ff 75 0c             	push   0xc(%ebp)
+  801780:	50                   	push   %eax
+  801781:	e8 24 01 00 00       	call   8018aa <nsipc_bind>
+  801786:	83 c4 10             	add    $0x10,%esp
+  801789:	c9                   	leave
+  80178a:	c3                   	ret
+
+0080178b <shutdown>:
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	83 ec 08             	sub    $0x8,%esp
+  801791:	8b 45 08             	mov    0x8(%ebp),%eax
+  801794:	e8 f9 fe ff ff       	call   801692 <fd2sockid>
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	78 0f                	js     8017ac <shutdown+0x21>
+  80179d:	83 ec 08             	sub    $0x8,%esp
+  8017a0:	ff 75 0c             	push   0xc(%ebp)
+  8017a3:	50                   	push   %eax
+  8017a4:	e8 36 01 00 00       	call   8018df <nsipc_shutdown>
+  8017a9:	83 c4 10             	add    $0x10,%esp
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+008017ae <connect>:
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	83 ec 08             	sub    $0x8,%esp
+  8017b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b7:	e8 d6 fe ff ff       	call   801692 <fd2sockid>
+  8017bc:	85 c0                	test   %eax,%eax
+  8017be:	78 12                	js     8017d2 <connect+0x24>
+  8017c0:	83 ec 04             	sub    $0x4,%esp
+  8017c3:	ff 75 10             	push   0x10(%ebp)
+  8017c6:	ff 75 0c             	push   0xc(%ebp)
+  8017c9:	50                   	push   %eax
+  8017ca:	e8 4c 01 00 00       	call   80191b <nsipc_connect>
+  8017cf:	83 c4 10             	add    $0x10,%esp
+  8017d2:	c9                   	leave
+  8017d3:	c3                   	ret
+
+008017d4 <listen>:
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	83 ec 08             	sub    $0x8,%esp
+  8017da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017dd:	e8 b0 fe ff ff       	call   801692 <fd2sockid>
+  8017e2:	85 c0                	test   %eax,%eax
+  8017e4:	78 0f                	js     8017f5 <listen+0x21>
+  8017e6:	83 ec 08             	sub    $0x8,%esp
+  8017e9:	ff 75 0c             	push   0xc(%ebp)
+  8017ec:	50                   	push   %eax
+  8017ed:	e8 5e 01 00 00       	call   801950 <nsipc_listen>
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	c9                   	leave
+  8017f6:	c3                   	ret
+
+008017f7 <socket>:
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	83 ec 0c             	sub    $0xc,%esp
+  8017fd:	ff 75 10             	push   0x10(%ebp)
+  801800:	ff 75 0c             	push   0xc(%ebp)
+  801803:	ff 75 08             	push   0x8(%ebp)
+  801806:	e8 34 02 00 00       	call   801a3f <nsipc_socket>
+  80180b:	83 c4 10             	add    $0x10,%esp
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	78 05                	js     801817 <socket+0x20>
+  801812:	e8 ab fe ff ff       	call   8016c2 <alloc_sockfd>
+  801817:	c9                   	leave
+  801818:	c3                   	ret
+
+00801819 <nsipc>:
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	53                   	push   %ebx
+  80181d:	83 ec 04             	sub    $0x4,%esp
+  801820:	89 c3                	mov    %eax,%ebx
+  801822:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  801829:	74 1f                	je     80184a <nsipc+0x31>
+  80182b:	83 ec 08             	sub    $0x8,%esp
+  80182e:	6a 00                	push   $0x0
+  801830:	6a 00                	push   $0x0
+  801832:	6a 07                	push   $0x7
+  801834:	68 00 70 80 00       	push   $0x807000
+  801839:	53                   	push   %ebx
+  80183a:	ff 35 0c 50 80 00    	push   0x80500c
+  801840:	e8 21 15 00 00       	call   802d66 <ipc_call>
+  801845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801848:	c9                   	leave
+  801849:	c3                   	ret
+  80184a:	83 ec 0c             	sub    $0xc,%esp
+  80184d:	6a 03                	push   $0x3
+  80184f:	e8 ad 16 00 00       	call   802f01 <ipc_find_env>
+  801854:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  801859:	83 c4 10             	add    $0x10,%esp
+  80185c:	eb cd                	jmp    80182b <nsipc+0x12>
+
+0080185e <nsipc_accept>:
+  80185e:	55                   	push   %ebp
+  80185f:	89 e5                	mov    %esp,%ebp
+  801861:	53                   	push   %ebx
+  801862:	83 ec 04             	sub    $0x4,%esp
+  801865:	8b 45 08             	mov    0x8(%ebp),%eax
+  801868:	a3 00 70 80 00       	mov    %eax,0x807000
+  80186d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801872:	e8 a2 ff ff ff       	call   801819 <nsipc>
+  801877:	89 c3                	mov    %eax,%ebx
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	79 07                	jns    801884 <nsipc_accept+0x26>
+  80187d:	89 d8                	mov    %ebx,%eax
+  80187f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801882:	c9                   	leave
+  801883:	c3                   	ret
+  801884:	83 ec 04             	sub    $0x4,%esp
+  801887:	ff 35 10 70 80 00    	push   0x807010
+  80188d:	68 00 70 80 00       	push   $0x807000
+  801892:	ff 75 0c             	push   0xc(%ebp)
+  801895:	e8 4c 12 00 00       	call   802ae6 <memmove>
+  80189a:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8018a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8018a3:	89 10                	mov    %edx,(%eax)
+  8018a5:	83 c4 10             	add    $0x10,%esp
+  8018a8:	eb d3                	jmp    80187d <nsipc_accept+0x1f>
+
+008018aa <nsipc_bind>:
+  8018aa:	55                   	push   %ebp
+  8018ab:	89 e5                	mov    %esp,%ebp
+  8018ad:	53                   	push   %ebx
+  8018ae:	83 ec 08             	sub    $0x8,%esp
+  8018b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b7:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018bc:	53                   	push   %ebx
+  8018bd:	ff 75 0c             	push   0xc(%ebp)
+  8018c0:	68 04 70 80 00       	push   $0x807004
+  8018c5:	e8 1c 12 00 00       	call   802ae6 <memmove>
+  8018ca:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8018d0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018d5:	e8 3f ff ff ff       	call   801819 <nsipc>
+  8018da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018dd:	c9                   	leave
+  8018de:	c3                   	ret
+
+008018df <nsipc_shutdown>:
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	83 ec 08             	sub    $0x8,%esp
+  8018e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e8:	a3 00 70 80 00       	mov    %eax,0x807000
+  8018ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f0:	a3 04 70 80 00       	mov    %eax,0x807004
+  8018f5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018fa:	e8 1a ff ff ff       	call   801819 <nsipc>
+  8018ff:	c9                   	leave
+  801900:	c3                   	ret
+
+00801901 <nsipc_close>:
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	83 ec 08             	sub    $0x8,%esp
+  801907:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80190f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801914:	e8 00 ff ff ff       	call   801819 <nsipc>
+  801919:	c9                   	leave
+  80191a:	c3                   	ret
+
+0080191b <nsipc_connect>:
+  80191b:	55                   	push   %ebp
+  80191c:	89 e5                	mov    %esp,%ebp
+  80191e:	53                   	push   %ebx
+  80191f:	83 ec 08             	sub    $0x8,%esp
+  801922:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801925:	8b 45 08             	mov    0x8(%ebp),%eax
+  801928:	a3 00 70 80 00       	mov    %eax,0x807000
+  80192d:	53                   	push   %ebx
+  80192e:	ff 75 0c             	push   0xc(%ebp)
+  801931:	68 04 70 80 00       	push   $0x807004
+  801936:	e8 ab 11 00 00       	call   802ae6 <memmove>
+  80193b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801941:	b8 05 00 00 00       	mov    $0x5,%eax
+  801946:	e8 ce fe ff ff       	call   801819 <nsipc>
+  80194b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80194e:	c9                   	leave
+  80194f:	c3                   	ret
+
+00801950 <nsipc_listen>:
+  801950:	55                   	push   %ebp
+  801951:	89 e5                	mov    %esp,%ebp
+  801953:	83 ec 08             	sub    $0x8,%esp
+  801956:	8b 45 08             	mov    0x8(%ebp),%eax
+  801959:	a3 00 70 80 00       	mov    %eax,0x807000
+  80195e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801961:	a3 04 70 80 00       	mov    %eax,0x807004
+  801966:	b8 06 00 00 00       	mov    $0x6,%eax
+  80196b:	e8 a9 fe ff ff       	call   801819 <nsipc>
+  801970:	c9                   	leave
+  801971:	c3                   	ret
+
+00801972 <nsipc_recv>:
+  801972:	55                   	push   %ebp
+  801973:	89 e5                	mov    %esp,%ebp
+  801975:	56                   	push   %esi
+  801976:	53                   	push   %ebx
+  801977:	8b 75 10             	mov    0x10(%ebp),%esi
+  80197a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197d:	a3 00 70 80 00       	mov    %eax,0x807000
+  801982:	89 35 04 70 80 00    	mov    %esi,0x807004
+  801988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80198b:	a3 08 70 80 00       	mov    %eax,0x807008
+  801990:	b8 07 00 00 00       	mov    $0x7,%eax
+  801995:	e8 7f fe ff ff       	call   801819 <nsipc>
+  80199a:	89 c3                	mov    %eax,%ebx
+  80199c:	85 c0                	test   %eax,%eax
+  80199e:	78 22                	js     8019c2 <nsipc_recv+0x50>
+  8019a0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8019a5:	39 c6                	cmp    %eax,%esi
+  8019a7:	0f 4e c6             	cmovle %esi,%eax
+  8019aa:	39 c3                	cmp    %eax,%ebx
+  8019ac:	7f 1d                	jg     8019cb <nsipc_recv+0x59>
+  8019ae:	83 ec 04             	sub    $0x4,%esp
+  8019b1:	53                   	push   %ebx
+  8019b2:	68 00 70 80 00       	push   $0x807000
+  8019b7:	ff 75 0c             	push   0xc(%ebp)
+  8019ba:	e8 27 11 00 00       	call   802ae6 <memmove>
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	89 d8                	mov    %ebx,%eax
+  8019c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c7:	5b                   	pop    %ebx
+  8019c8:	5e                   	pop    %esi
+  8019c9:	5d                   	pop    %ebp
+  8019ca:	c3                   	ret
+  8019cb:	68 34 32 80 00       	push   $0x803234
+  8019d0:	68 49 32 80 00       	push   $0x803249
+  8019d5:	6a 60                	push   $0x60
+  8019d7:	68 5e 32 80 00       	push   $0x80325e
+  8019dc:	e8 83 07 00 00       	call   802164 <_panic>
+
+008019e1 <nsipc_send>:
+  8019e1:	55                   	push   %ebp
+  8019e2:	89 e5                	mov    %esp,%ebp
+  8019e4:	53                   	push   %ebx
+  8019e5:	83 ec 04             	sub    $0x4,%esp
+  8019e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ee:	a3 00 70 80 00       	mov    %eax,0x807000
+  8019f3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8019f9:	7f 2e                	jg     801a29 <nsipc_send+0x48>
+  8019fb:	83 ec 04             	sub    $0x4,%esp
+  8019fe:	53                   	push   %ebx
+  8019ff:	ff 75 0c             	push   0xc(%ebp)
+  801a02:	68 0c 70 80 00       	push   $0x80700c
+  801a07:	e8 da 10 00 00       	call   802ae6 <memmove>
+  801a0c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  801a12:	8b 45 14             	mov    0x14(%ebp),%eax
+  801a15:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a1a:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a1f:	e8 f5 fd ff ff       	call   801819 <nsipc>
+  801a24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a27:	c9                   	leave
+  801a28:	c3                   	ret
+  801a29:	68 6a 32 80 00       	push   $0x80326a
+  801a2e:	68 49 32 80 00       	push   $0x803249
+  801a33:	6a 6b                	push   $0x6b
+  801a35:	68 5e 32 80 00       	push   $0x80325e
+  801a3a:	e8 25 07 00 00       	call   802164 <_panic>
+
+00801a3f <nsipc_socket>:
+  801a3f:	55                   	push   %ebp
+  801a40:	89 e5                	mov    %esp,%ebp
+  801a42:	83 ec 08             	sub    $0x8,%esp
+  801a45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a48:	a3 00 70 80 00       	mov    %eax,0x807000
+  801a4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a50:	a3 04 70 80 00       	mov    %eax,0x807004
+  801a55:	8b 45 10             	mov    0x10(%ebp),%eax
+  801a58:	a3 08 70 80 00       	mov    %eax,0x807008
+  801a5d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a62:	e8 b2 fd ff ff       	call   801819 <nsipc>
+  801a67:	c9                   	leave
+  801a68:	c3                   	ret
+
+00801a69 <devpipe_stat>:
+  801a69:	55                   	push   %ebp
+  801a6a:	89 e5                	mov    %esp,%ebp
+  801a6c:	56                   	push   %esi
+  801a6d:	53                   	push   %ebx
+  801a6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a71:	83 ec 0c             	sub    $0xc,%esp
+  801a74:	ff 75 08             	push   0x8(%ebp)
+  801a77:	e8 99 ef ff ff       	call   800a15 <fd2data>
+  801a7c:	89 c6                	mov    %eax,%esi
+  801a7e:	83 c4 08             	add    $0x8,%esp
+  801a81:	68 76 32 80 00       	push   $0x803276
+  801a86:	53                   	push   %ebx
+  801a87:	e8 aa 0e 00 00       	call   802936 <strcpy>
+  801a8c:	8b 46 04             	mov    0x4(%esi),%eax
+  801a8f:	2b 06                	sub    (%esi),%eax
+  801a91:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801a97:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a9e:	00 00 00 
+  801aa1:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  801aa8:	40 80 00 
+  801aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab3:	5b                   	pop    %ebx
+  801ab4:	5e                   	pop    %esi
+  801ab5:	5d                   	pop    %ebp
+  801ab6:	c3                   	ret
+
+00801ab7 <devpipe_close>:
+  801ab7:	55                   	push   %ebp
+  801ab8:	89 e5                	mov    %esp,%ebp
+  801aba:	53                   	push   %ebx
+  801abb:	83 ec 0c             	sub    $0xc,%esp
+  801abe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ac1:	53                   	push   %ebx
+  801ac2:	6a 00                	push   $0x0
+  801ac4:	e8 a0 e7 ff ff       	call   800269 <sys_page_unmap>
+  801ac9:	89 1c 24             	mov    %ebx,(%esp)
+  801acc:	e8 44 ef ff ff       	call   800a15 <fd2data>
+  801ad1:	83 c4 08             	add    $0x8,%esp
+  801ad4:	50                   	push   %eax
+  801ad5:	6a 00                	push   $0x0
+  801ad7:	e8 8d e7 ff ff       	call   800269 <sys_page_unmap>
+  801adc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801adf:	c9                   	leave
+  801ae0:	c3                   	ret
+
+00801ae1 <_pipeisclosed>:
+  801ae1:	55                   	push   %ebp
+  801ae2:	89 e5                	mov    %esp,%ebp
+  801ae4:	57                   	push   %edi
+  801ae5:	56                   	push   %esi
+  801ae6:	53                   	push   %ebx
+  801ae7:	83 ec 1c             	sub    $0x1c,%esp
+  801aea:	89 c7                	mov    %eax,%edi
+  801aec:	89 d6                	mov    %edx,%esi
+  801aee:	a1 10 50 80 00       	mov    0x805010,%eax
+  801af3:	8b 58 58             	mov    0x58(%eax),%ebx
+  801af6:	83 ec 0c             	sub    $0xc,%esp
+  801af9:	57                   	push   %edi
+  801afa:	e8 1c 14 00 00       	call   802f1b <pageref>
+  801aff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b02:	89 34 24             	mov    %esi,(%esp)
+  801b05:	e8 11 14 00 00       	call   802f1b <pageref>
+  801b0a:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  801b10:	8b 4a 58             	mov    0x58(%edx),%ecx
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	39 cb                	cmp    %ecx,%ebx
+  801b18:	74 1b                	je     801b35 <_pipeisclosed+0x54>
+  801b1a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b1d:	75 cf                	jne    801aee <_pipeisclosed+0xd>
+  801b1f:	8b 42 58             	mov    0x58(%edx),%eax
+  801b22:	6a 01                	push   $0x1
+  801b24:	50                   	push   %eax
+  801b25:	53                   	push   %ebx
+  801b26:	68 7d 32 80 00       	push   $0x80327d
+  801b2b:	e8 0f 07 00 00       	call   80223f <cprintf>
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	eb b9                	jmp    801aee <_pipeisclosed+0xd>
+  801b35:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801b38:	0f 94 c0             	sete   %al
+  801b3b:	0f b6 c0             	movzbl %al,%eax
+  801b3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b41:	5b                   	pop    %ebx
+  801b42:	5e                   	pop    %esi
+  801b43:	5f                   	pop    %edi
+  801b44:	5d                   	pop    %ebp
+  801b45:	c3                   	ret
+
+00801b46 <devpipe_write>:
+  801b46:	55                   	push   %ebp
+  801b47:	89 e5                	mov    %esp,%ebp
+  801b49:	57                   	push   %edi
+  801b4a:	56                   	push   %esi
+  801b4b:	53                   	push   %ebx
+  801b4c:	83 ec 28             	sub    $0x28,%esp
+  801b4f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b52:	56                   	push   %esi
+  801b53:	e8 bd ee ff ff       	call   800a15 <fd2data>
+  801b58:	89 c3                	mov    %eax,%ebx
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b62:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801b66:	74 5c                	je     801bc4 <devpipe_write+0x7e>
+  801b68:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b6b:	8b 0b                	mov    (%ebx),%ecx
+  801b6d:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b70:	39 d0                	cmp    %edx,%eax
+  801b72:	72 1e                	jb     801b92 <devpipe_write+0x4c>
+  801b74:	89 da                	mov    %ebx,%edx
+  801b76:	89 f0                	mov    %esi,%eax
+  801b78:	e8 64 ff ff ff       	call   801ae1 <_pipeisclosed>
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	75 48                	jne    801bc9 <devpipe_write+0x83>
+  801b81:	e8 c6 e5 ff ff       	call   80014c <sys_yield>
+  801b86:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b89:	8b 0b                	mov    (%ebx),%ecx
+  801b8b:	8d 51 20             	lea    0x20(%ecx),%edx
+  801b8e:	39 d0                	cmp    %edx,%eax
+  801b90:	73 e2                	jae    801b74 <devpipe_write+0x2e>
+  801b92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b95:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801b99:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801b9c:	89 c2                	mov    %eax,%edx
+  801b9e:	c1 fa 1f             	sar    $0x1f,%edx
+  801ba1:	89 d1                	mov    %edx,%ecx
+  801ba3:	c1 e9 1b             	shr    $0x1b,%ecx
+  801ba6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801ba9:	83 e2 1f             	and    $0x1f,%edx
+  801bac:	29 ca                	sub    %ecx,%edx
+  801bae:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801bb2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  801bb6:	83 c0 01             	add    $0x1,%eax
+  801bb9:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bbc:	83 c7 01             	add    $0x1,%edi
+  801bbf:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801bc2:	75 a4                	jne    801b68 <devpipe_write+0x22>
+  801bc4:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bc7:	eb 05                	jmp    801bce <devpipe_write+0x88>
+  801bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd1:	5b                   	pop    %ebx
+  801bd2:	5e                   	pop    %esi
+  801bd3:	5f                   	pop    %edi
+  801bd4:	5d                   	pop    %ebp
+  801bd5:	c3                   	ret
+
+00801bd6 <devpipe_read>:
+  801bd6:	55                   	push   %ebp
+  801bd7:	89 e5                	mov    %esp,%ebp
+  801bd9:	57                   	push   %edi
+  801bda:	56                   	push   %esi
+  801bdb:	53                   	push   %ebx
+  801bdc:	83 ec 18             	sub    $0x18,%esp
+  801bdf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801be2:	56                   	push   %esi
+  801be3:	e8 2d ee ff ff       	call   800a15 <fd2data>
+  801be8:	89 c3                	mov    %eax,%ebx
+  801bea:	83 c4 10             	add    $0x10,%esp
+  801bed:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801bf6:	74 45                	je     801c3d <devpipe_read+0x67>
+  801bf8:	8b 03                	mov    (%ebx),%eax
+  801bfa:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801bfd:	75 1d                	jne    801c1c <devpipe_read+0x46>
+  801bff:	85 ff                	test   %edi,%edi
+  801c01:	75 3f                	jne    801c42 <devpipe_read+0x6c>
+  801c03:	89 da                	mov    %ebx,%edx
+  801c05:	89 f0                	mov    %esi,%eax
+  801c07:	e8 d5 fe ff ff       	call   801ae1 <_pipeisclosed>
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	75 3c                	jne    801c4c <devpipe_read+0x76>
+  801c10:	e8 37 e5 ff ff       	call   80014c <sys_yield>
+  801c15:	8b 03                	mov    (%ebx),%eax
+  801c17:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801c1a:	74 e7                	je     801c03 <devpipe_read+0x2d>
+  801c1c:	99                   	cltd
+  801c1d:	c1 ea 1b             	shr    $0x1b,%edx
+  801c20:	01 d0                	add    %edx,%eax
+  801c22:	83 e0 1f             	and    $0x1f,%eax
+  801c25:	29 d0                	sub    %edx,%eax
+  801c27:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c2f:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  801c32:	83 03 01             	addl   $0x1,(%ebx)
+  801c35:	83 c7 01             	add    $0x1,%edi
+  801c38:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  801c3b:	75 bb                	jne    801bf8 <devpipe_read+0x22>
+  801c3d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c40:	eb 02                	jmp    801c44 <devpipe_read+0x6e>
+  801c42:	89 f8                	mov    %edi,%eax
+  801c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c47:	5b                   	pop    %ebx
+  801c48:	5e                   	pop    %esi
+  801c49:	5f                   	pop    %edi
+  801c4a:	5d                   	pop    %ebp
+  801c4b:	c3                   	ret
+  801c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c51:	eb f1                	jmp    801c44 <devpipe_read+0x6e>
+
+00801c53 <pipe>:
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+  801c56:	56                   	push   %esi
+  801c57:	53                   	push   %ebx
+  801c58:	83 ec 1c             	sub    $0x1c,%esp
+  801c5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c5e:	50                   	push   %eax
+  801c5f:	e8 c8 ed ff ff       	call   800a2c <fd_alloc>
+  801c64:	89 c3                	mov    %eax,%ebx
+  801c66:	83 c4 10             	add    $0x10,%esp
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	0f 88 23 01 00 00    	js     801d94 <pipe+0x141>
+  801c71:	83 ec 04             	sub    $0x4,%esp
+  801c74:	68 07 04 00 00       	push   $0x407
+  801c79:	ff 75 f4             	push   -0xc(%ebp)
+  801c7c:	6a 00                	push   $0x0
+  801c7e:	e8 14 e5 ff ff       	call   800197 <sys_page_alloc>
+  801c83:	89 c3                	mov    %eax,%ebx
+  801c85:	83 c4 10             	add    $0x10,%esp
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	0f 88 04 01 00 00    	js     801d94 <pipe+0x141>
+  801c90:	83 ec 0c             	sub    $0xc,%esp
+  801c93:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c96:	50                   	push   %eax
+  801c97:	e8 90 ed ff ff       	call   800a2c <fd_alloc>
+  801c9c:	89 c3                	mov    %eax,%ebx
+  801c9e:	83 c4 10             	add    $0x10,%esp
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	0f 88 db 00 00 00    	js     801d84 <pipe+0x131>
+  801ca9:	83 ec 04             	sub    $0x4,%esp
+  801cac:	68 07 04 00 00       	push   $0x407
+  801cb1:	ff 75 f0             	push   -0x10(%ebp)
+  801cb4:	6a 00                	push   $0x0
+  801cb6:	e8 dc e4 ff ff       	call   800197 <sys_page_alloc>
+  801cbb:	89 c3                	mov    %eax,%ebx
+  801cbd:	83 c4 10             	add    $0x10,%esp
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	0f 88 bc 00 00 00    	js     801d84 <pipe+0x131>
+  801cc8:	83 ec 0c             	sub    $0xc,%esp
+  801ccb:	ff 75 f4             	push   -0xc(%ebp)
+  801cce:	e8 42 ed ff ff       	call   800a15 <fd2data>
+  801cd3:	89 c6                	mov    %eax,%esi
+  801cd5:	83 c4 0c             	add    $0xc,%esp
+  801cd8:	68 07 04 00 00       	push   $0x407
+  801cdd:	50                   	push   %eax
+  801cde:	6a 00                	push   $0x0
+  801ce0:	e8 b2 e4 ff ff       	call   800197 <sys_page_alloc>
+  801ce5:	89 c3                	mov    %eax,%ebx
+  801ce7:	83 c4 10             	add    $0x10,%esp
+  801cea:	85 c0                	test   %eax,%eax
+  801cec:	0f 88 82 00 00 00    	js     801d74 <pipe+0x121>
+  801cf2:	83 ec 0c             	sub    $0xc,%esp
+  801cf5:	ff 75 f0             	push   -0x10(%ebp)
+  801cf8:	e8 18 ed ff ff       	call   800a15 <fd2data>
+  801cfd:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801d04:	50                   	push   %eax
+  801d05:	6a 00                	push   $0x0
+  801d07:	56                   	push   %esi
+  801d08:	6a 00                	push   $0x0
+  801d0a:	e8 cb e4 ff ff       	call   8001da <sys_page_map>
+  801d0f:	89 c3                	mov    %eax,%ebx
+  801d11:	83 c4 20             	add    $0x20,%esp
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	78 4e                	js     801d66 <pipe+0x113>
+  801d18:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  801d1d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d20:	89 02                	mov    %eax,(%edx)
+  801d22:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d25:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  801d2c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801d2f:	89 02                	mov    %eax,(%edx)
+  801d31:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801d34:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  801d3b:	83 ec 0c             	sub    $0xc,%esp
+  801d3e:	ff 75 f4             	push   -0xc(%ebp)
+  801d41:	e8 bf ec ff ff       	call   800a05 <fd2num>
+  801d46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d49:	89 01                	mov    %eax,(%ecx)
+  801d4b:	83 c4 04             	add    $0x4,%esp
+  801d4e:	ff 75 f0             	push   -0x10(%ebp)
+  801d51:	e8 af ec ff ff       	call   800a05 <fd2num>
+  801d56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d59:	89 41 04             	mov    %eax,0x4(%ecx)
+  801d5c:	83 c4 10             	add    $0x10,%esp
+  801d5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d64:	eb 2e                	jmp    801d94 <pipe+0x141>
+  801d66:	83 ec 08             	sub    $0x8,%esp
+  801d69:	56                   	push   %esi
+  801d6a:	6a 00                	push   $0x0
+  801d6c:	e8 f8 e4 ff ff       	call   800269 <sys_page_unmap>
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	83 ec 08             	sub    $0x8,%esp
+  801d77:	ff 75 f0             	push   -0x10(%ebp)
+  801d7a:	6a 00                	push   $0x0
+  801d7c:	e8 e8 e4 ff ff       	call   800269 <sys_page_unmap>
+  801d81:	83 c4 10             	add    $0x10,%esp
+  801d84:	83 ec 08             	sub    $0x8,%esp
+  801d87:	ff 75 f4             	push   -0xc(%ebp)
+  801d8a:	6a 00                	push   $0x0
+  801d8c:	e8 d8 e4 ff ff       	call   800269 <sys_page_unmap>
+  801d91:	83 c4 10             	add    $0x10,%esp
+  801d94:	89 d8                	mov    %ebx,%eax
+  801d96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d99:	5b                   	pop    %ebx
+  801d9a:	5e                   	pop    %esi
+  801d9b:	5d                   	pop    %ebp
+  801d9c:	c3                   	ret
+
+00801d9d <pipeisclosed>:
+  801d9d:	55                   	push   %ebp
+  801d9e:	89 e5                	mov    %esp,%ebp
+  801da0:	83 ec 20             	sub    $0x20,%esp
+  801da3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801da6:	50                   	push   %eax
+  801da7:	ff 75 08             	push   0x8(%ebp)
+  801daa:	e8 cd ec ff ff       	call   800a7c <fd_lookup>
+  801daf:	83 c4 10             	add    $0x10,%esp
+  801db2:	85 c0                	test   %eax,%eax
+  801db4:	78 18                	js     801dce <pipeisclosed+0x31>
+  801db6:	83 ec 0c             	sub    $0xc,%esp
+  801db9:	ff 75 f4             	push   -0xc(%ebp)
+  801dbc:	e8 54 ec ff ff       	call   800a15 <fd2data>
+  801dc1:	89 c2                	mov    %eax,%edx
+  801dc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc6:	e8 16 fd ff ff       	call   801ae1 <_pipeisclosed>
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+00801dd0 <ipcring_init>:
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	53                   	push   %ebx
+  801dd4:	83 ec 08             	sub    $0x8,%esp
+  801dd7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dda:	6a 60                	push   $0x60
+  801ddc:	6a 00                	push   $0x0
+  801dde:	53                   	push   %ebx
+  801ddf:	e8 cd 0c 00 00       	call   802ab1 <memset>
+  801de4:	a1 10 50 80 00       	mov    0x805010,%eax
+  801de9:	8b 40 48             	mov    0x48(%eax),%eax
+  801dec:	89 03                	mov    %eax,(%ebx)
+  801dee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801df1:	89 43 04             	mov    %eax,0x4(%ebx)
+  801df4:	8b 45 10             	mov    0x10(%ebp),%eax
+  801df7:	89 43 08             	mov    %eax,0x8(%ebx)
+  801dfa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dfd:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e00:	83 c4 10             	add    $0x10,%esp
+  801e03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e06:	c9                   	leave
+  801e07:	c3                   	ret
+
+00801e08 <ipcring_req_slot>:
+  801e08:	55                   	push   %ebp
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0e:	8b 50 10             	mov    0x10(%eax),%edx
+  801e11:	8b 48 18             	mov    0x18(%eax),%ecx
+  801e14:	29 ca                	sub    %ecx,%edx
+  801e16:	83 fa 07             	cmp    $0x7,%edx
+  801e19:	77 0c                	ja     801e27 <ipcring_req_slot+0x1f>
+  801e1b:	8b 50 10             	mov    0x10(%eax),%edx
+  801e1e:	83 e2 07             	and    $0x7,%edx
+  801e21:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  801e25:	5d                   	pop    %ebp
+  801e26:	c3                   	ret
+  801e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2c:	eb f7                	jmp    801e25 <ipcring_req_slot+0x1d>
+
+00801e2e <ipcring_req_push>:
+  801e2e:	55                   	push   %ebp
+  801e2f:	89 e5                	mov    %esp,%ebp
+  801e31:	83 ec 08             	sub    $0x8,%esp
+  801e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e37:	8b 42 10             	mov    0x10(%edx),%eax
+  801e3a:	83 c0 01             	add    $0x1,%eax
+  801e3d:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  801e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e46:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801e4a:	85 c0                	test   %eax,%eax
+  801e4c:	75 02                	jne    801e50 <ipcring_req_push+0x22>
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+  801e50:	6a 00                	push   $0x0
+  801e52:	68 00 00 80 ee       	push   $0xee800000
+  801e57:	ff 72 08             	push   0x8(%edx)
+  801e5a:	ff 72 04             	push   0x4(%edx)
+  801e5d:	e8 6d e6 ff ff       	call   8004cf <sys_ipc_send>
+  801e62:	83 c4 10             	add    $0x10,%esp
+  801e65:	eb e7                	jmp    801e4e <ipcring_req_push+0x20>
+
+00801e67 <ipcring_rsp_wait>:
+  801e67:	55                   	push   %ebp
+  801e68:	89 e5                	mov    %esp,%ebp
+  801e6a:	53                   	push   %ebx
+  801e6b:	83 ec 04             	sub    $0x4,%esp
+  801e6e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e71:	8b 53 18             	mov    0x18(%ebx),%edx
+  801e74:	8b 43 10             	mov    0x10(%ebx),%eax
+  801e77:	39 c2                	cmp    %eax,%edx
+  801e79:	74 3c                	je     801eb7 <ipcring_rsp_wait+0x50>
+  801e7b:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e7e:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e81:	39 c2                	cmp    %eax,%edx
+  801e83:	75 23                	jne    801ea8 <ipcring_rsp_wait+0x41>
+  801e85:	83 ec 08             	sub    $0x8,%esp
+  801e88:	6a 00                	push   $0x0
+  801e8a:	6a 00                	push   $0x0
+  801e8c:	6a 00                	push   $0x0
+  801e8e:	6a 00                	push   $0x0
+  801e90:	ff 73 0c             	push   0xc(%ebx)
+  801e93:	ff 73 04             	push   0x4(%ebx)
+  801e96:	e8 cb 0e 00 00       	call   802d66 <ipc_call>
+  801e9b:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e9e:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ea1:	83 c4 20             	add    $0x20,%esp
+  801ea4:	39 c2                	cmp    %eax,%edx
+  801ea6:	74 dd                	je     801e85 <ipcring_rsp_wait+0x1e>
+  801ea8:	8b 43 18             	mov    0x18(%ebx),%eax
+  801eab:	83 e0 07             	and    $0x7,%eax
+  801eae:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  801eb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb5:	c9                   	leave
+  801eb6:	c3                   	ret
+  801eb7:	68 98 32 80 00       	push   $0x803298
+  801ebc:	68 49 32 80 00       	push   $0x803249
+  801ec1:	6a 3b                	push   $0x3b
+  801ec3:	68 b9 32 80 00       	push   $0x8032b9
+  801ec8:	e8 97 02 00 00       	call   802164 <_panic>
+
+00801ecd <ipcring_rsp_pop>:
+  801ecd:	55                   	push   %ebp
+  801ece:	89 e5                	mov    %esp,%ebp
+  801ed0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ed3:	8b 42 18             	mov    0x18(%edx),%eax
+  801ed6:	83 c0 01             	add    $0x1,%eax
+  801ed9:	89 42 18             	mov    %eax,0x18(%edx)
+  801edc:	5d                   	pop    %ebp
+  801edd:	c3                   	ret
+
+00801ede <ipcring_server_init>:
+  801ede:	55                   	push   %ebp
+  801edf:	89 e5                	mov    %esp,%ebp
+  801ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ee7:	89 10                	mov    %edx,(%eax)
+  801ee9:	8b 55 10             	mov    0x10(%ebp),%edx
+  801eec:	89 50 04             	mov    %edx,0x4(%eax)
+  801eef:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  801ef6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801efd:	5d                   	pop    %ebp
+  801efe:	c3                   	ret
+
+00801eff <ipcring_req_avail>:
+  801eff:	55                   	push   %ebp
+  801f00:	89 e5                	mov    %esp,%ebp
+  801f02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f05:	8b 02                	mov    (%edx),%eax
+  801f07:	8b 40 10             	mov    0x10(%eax),%eax
+  801f0a:	2b 42 08             	sub    0x8(%edx),%eax
+  801f0d:	ba 08 00 00 00       	mov    $0x8,%edx
+  801f12:	39 d0                	cmp    %edx,%eax
+  801f14:	0f 47 c2             	cmova  %edx,%eax
+  801f17:	5d                   	pop    %ebp
+  801f18:	c3                   	ret
+
+00801f19 <ipcring_req_peek>:
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1f:	8b 42 08             	mov    0x8(%edx),%eax
+  801f22:	83 e0 07             	and    $0x7,%eax
+  801f25:	8b 12                	mov    (%edx),%edx
+  801f27:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  801f2b:	5d                   	pop    %ebp
+  801f2c:	c3                   	ret
+
+00801f2d <ipcring_rsp_push>:
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	83 ec 08             	sub    $0x8,%esp
+  801f33:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f36:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f39:	83 c0 01             	add    $0x1,%eax
+  801f3c:	89 41 08             	mov    %eax,0x8(%ecx)
+  801f3f:	8b 11                	mov    (%ecx),%edx
+  801f41:	83 c2 14             	add    $0x14,%edx
+  801f44:	f0 87 02             	lock xchg %eax,(%edx)
+  801f47:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  801f4b:	75 02                	jne    801f4f <ipcring_rsp_push+0x22>
+  801f4d:	c9                   	leave
+  801f4e:	c3                   	ret
+  801f4f:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  801f56:	6a 00                	push   $0x0
+  801f58:	68 00 00 80 ee       	push   $0xee800000
+  801f5d:	6a 00                	push   $0x0
+  801f5f:	ff 71 04             	push   0x4(%ecx)
+  801f62:	e8 8b e4 ff ff       	call   8003f2 <sys_ipc_try_send>
+  801f67:	83 c4 10             	add    $0x10,%esp
+  801f6a:	eb e1                	jmp    801f4d <ipcring_rsp_push+0x20>
+
+00801f6c <ipcring_client_wait>:
+  801f6c:	55                   	push   %ebp
+  801f6d:	89 e5                	mov    %esp,%ebp
+  801f6f:	83 ec 08             	sub    $0x8,%esp
+  801f72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f75:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  801f7c:	8b 10                	mov    (%eax),%edx
+  801f7e:	8b 52 18             	mov    0x18(%edx),%edx
+  801f81:	3b 50 08             	cmp    0x8(%eax),%edx
+  801f84:	75 02                	jne    801f88 <ipcring_client_wait+0x1c>
+  801f86:	c9                   	leave
+  801f87:	c3                   	ret
+  801f88:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  801f8f:	6a 00                	push   $0x0
+  801f91:	68 00 00 80 ee       	push   $0xee800000
+  801f96:	6a 00                	push   $0x0
+  801f98:	ff 70 04             	push   0x4(%eax)
+  801f9b:	e8 52 e4 ff ff       	call   8003f2 <sys_ipc_try_send>
+  801fa0:	83 c4 10             	add    $0x10,%esp
+  801fa3:	eb e1                	jmp    801f86 <ipcring_client_wait+0x1a>
+
+00801fa5 <ipcring_server_sleep>:
+  801fa5:	55                   	push   %ebp
+  801fa6:	89 e5                	mov    %esp,%ebp
+  801fa8:	53                   	push   %ebx
+  801fa9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fac:	8b 01                	mov    (%ecx),%eax
+  801fae:	8d 50 1c             	lea    0x1c(%eax),%edx
+  801fb1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb6:	f0 87 02             	lock xchg %eax,(%edx)
+  801fb9:	8b 11                	mov    (%ecx),%edx
+  801fbb:	8b 5a 10             	mov    0x10(%edx),%ebx
+  801fbe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fc3:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  801fc6:	74 0e                	je     801fd6 <ipcring_server_sleep+0x31>
+  801fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcd:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  801fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd9:	c9                   	leave
+  801fda:	c3                   	ret
+
+00801fdb <devcons_close>:
+  801fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe0:	c3                   	ret
+
+00801fe1 <devcons_stat>:
+  801fe1:	55                   	push   %ebp
+  801fe2:	89 e5                	mov    %esp,%ebp
+  801fe4:	83 ec 10             	sub    $0x10,%esp
+  801fe7:	68 c7 32 80 00       	push   $0x8032c7
+  801fec:	ff 75 0c             	push   0xc(%ebp)
+  801fef:	e8 42 09 00 00       	call   802936 <strcpy>
+  801ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff9:	c9                   	leave
+  801ffa:	c3                   	ret
+
+00801ffb <devcons_write>:
+  801ffb:	55                   	push   %ebp
+  801ffc:	89 e5                	mov    %esp,%ebp
+  801ffe:	57                   	push   %edi
+  801fff:	56                   	push   %esi
+  802000:	53                   	push   %ebx
+  802001:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802007:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80200a:	85 ff                	test   %edi,%edi
+  80200c:	74 51                	je     80205f <devcons_write+0x64>
+  80200e:	be 00 00 00 00       	mov    $0x0,%esi
+  802013:	b8 00 00 00 00       	mov    $0x0,%eax
+  802018:	89 fb                	mov    %edi,%ebx
+  80201a:	29 c3                	sub    %eax,%ebx
+  80201c:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802021:	39 d3                	cmp    %edx,%ebx
+  802023:	0f 47 da             	cmova  %edx,%ebx
+  802026:	83 ec 04             	sub    $0x4,%esp
+  802029:	53                   	push   %ebx
+  80202a:	03 45 0c             	add    0xc(%ebp),%eax
+  80202d:	50                   	push   %eax
+  80202e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802034:	50                   	push   %eax
+  802035:	e8 ac 0a 00 00       	call   802ae6 <memmove>
+  80203a:	83 c4 08             	add    $0x8,%esp
+  80203d:	53                   	push   %ebx
+  80203e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802044:	50                   	push   %eax
+  802045:	e8 65 e0 ff ff       	call   8000af <sys_cputs>
+  80204a:	01 de                	add    %ebx,%esi
+  80204c:	89 f0                	mov    %esi,%eax
+  80204e:	83 c4 10             	add    $0x10,%esp
+  802051:	39 fe                	cmp    %edi,%esi
+  802053:	72 c3                	jb     802018 <devcons_write+0x1d>
+  802055:	89 f0                	mov    %esi,%eax
+  802057:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205a:	5b                   	pop    %ebx
+  80205b:	5e                   	pop    %esi
+  80205c:	5f                   	pop    %edi
+  80205d:	5d                   	pop    %ebp
+  80205e:	c3                   	ret
+  80205f:	be 00 00 00 00       	mov    $0x0,%esi
+  802064:	eb ef                	jmp    802055 <devcons_write+0x5a>
+
+00802066 <devcons_read>:
+  802066:	55                   	push   %ebp
+  802067:	89 e5                	mov    %esp,%ebp
+  802069:	83 ec 08             	sub    $0x8,%esp
+  80206c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802071:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802075:	75 07                	jne    80207e <devcons_read+0x18>
+  802077:	eb 1f                	jmp    802098 <devcons_read+0x32>
+  802079:	e8 ce e0 ff ff       	call   80014c <sys_yield>
+  80207e:	e8 4a e0 ff ff       	call   8000cd <sys_cgetc>
+  802083:	85 c0                	test   %eax,%eax
+  802085:	74 f2                	je     802079 <devcons_read+0x13>
+  802087:	78 0f                	js     802098 <devcons_read+0x32>
+  802089:	83 f8 04             	cmp    $0x4,%eax
+  80208c:	74 0c                	je     80209a <devcons_read+0x34>
+  80208e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802091:	88 02                	mov    %al,(%edx)
+  802093:	b8 01 00 00 00       	mov    $0x1,%eax
+  802098:	c9                   	leave
+  802099:	c3                   	ret
+  80209a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209f:	eb f7                	jmp    802098 <devcons_read+0x32>
+
+008020a1 <cputchar>:
+  8020a1:	55                   	push   %ebp
+  8020a2:	89 e5                	mov    %esp,%ebp
+  8020a4:	83 ec 20             	sub    $0x20,%esp
+  8020a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020aa:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8020ad:	6a 01                	push   $0x1
+  8020af:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020b2:	50                   	push   %eax
+  8020b3:	e8 f7 df ff ff       	call   8000af <sys_cputs>
+  8020b8:	83 c4 10             	add    $0x10,%esp
+  8020bb:	c9                   	leave
+  8020bc:	c3                   	ret
+
+008020bd <getchar>:
+  8020bd:	55                   	push   %ebp
+  8020be:	89 e5                	mov    %esp,%ebp
+  8020c0:	83 ec 1c             	sub    $0x1c,%esp
+  8020c3:	6a 01                	push   $0x1
+  8020c5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8020c8:	50                   	push   %eax
+  8020c9:	6a 00                	push   $0x0
+  8020cb:	e8 0e ec ff ff       	call   800cde <read>
+  8020d0:	83 c4 10             	add    $0x10,%esp
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 06                	js     8020dd <getchar+0x20>
+  8020d7:	74 06                	je     8020df <getchar+0x22>
+  8020d9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8020dd:	c9                   	leave
+  8020de:	c3                   	ret
+  8020df:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8020e4:	eb f7                	jmp    8020dd <getchar+0x20>
+
+008020e6 <iscons>:
+  8020e6:	55                   	push   %ebp
+  8020e7:	89 e5                	mov    %esp,%ebp
+  8020e9:	83 ec 20             	sub    $0x20,%esp
+  8020ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ef:	50                   	push   %eax
+  8020f0:	ff 75 08             	push   0x8(%ebp)
+  8020f3:	e8 84 e9 ff ff       	call   800a7c <fd_lookup>
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	78 11                	js     802110 <iscons+0x2a>
+  8020ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802102:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802108:	39 10                	cmp    %edx,(%eax)
+  80210a:	0f 94 c0             	sete   %al
+  80210d:	0f b6 c0             	movzbl %al,%eax
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+
+00802112 <opencons>:
+  802112:	55                   	push   %ebp
+  802113:	89 e5                	mov    %esp,%ebp
+  802115:	83 ec 24             	sub    $0x24,%esp
+  802118:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80211b:	50                   	push   %eax
+  80211c:	e8 0b e9 ff ff       	call   800a2c <fd_alloc>
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	85 c0                	test   %eax,%eax
+  802126:	78 3a                	js     802162 <opencons+0x50>
+  802128:	83 ec 04             	sub    $0x4,%esp
+  80212b:	68 07 04 00 00       	push   $0x407
+  802130:	ff 75 f4             	push   -0xc(%ebp)
+  802133:	6a 00                	push   $0x0
+  802135:	e8 5d e0 ff ff       	call   800197 <sys_page_alloc>
+  80213a:	83 c4 10             	add    $0x10,%esp
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 21                	js     802162 <opencons+0x50>
+  802141:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802144:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80214a:	89 10                	mov    %edx,(%eax)
+  80214c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802156:	83 ec 0c             	sub    $0xc,%esp
+  802159:	50                   	push   %eax
+  80215a:	e8 a6 e8 ff ff       	call   800a05 <fd2num>
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+
+00802164 <_panic>:
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	56                   	push   %esi
+  802168:	53                   	push   %ebx
+  802169:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80216c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802172:	e8 b6 df ff ff       	call   80012d <sys_getenvid>
+  802177:	83 ec 0c             	sub    $0xc,%esp
+  80217a:	ff 75 0c             	push   0xc(%ebp)
+  80217d:	ff 75 08             	push   0x8(%ebp)
+  802180:	56                   	push   %esi
+  802181:	50                   	push   %eax
+  802182:	68 d4 32 80 00       	push   $0x8032d4
+  802187:	e8 b3 00 00 00       	call   80223f <cprintf>
+  80218c:	83 c4 18             	add    $0x18,%esp
+  80218f:	53                   	push   %ebx
+  802190:	ff 75 10             	push   0x10(%ebp)
+  802193:	e8 56 00 00 00       	call   8021ee <vcprintf>
+  802198:	c7 04 24 8e 32 80 00 	movl   $0x80328e,(%esp)
+  80219f:	e8 9b 00 00 00       	call   80223f <cprintf>
+  8021a4:	83 c4 10             	add    $0x10,%esp
+  8021a7:	cc                   	int3
+  8021a8:	eb fd                	jmp    8021a7 <_panic+0x43>
+
+008021aa <putch>:
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	53                   	push   %ebx
+  8021ae:	83 ec 04             	sub    $0x4,%esp
+  8021b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021b4:	8b 13                	mov    (%ebx),%edx
+  8021b6:	8d 42 01             	lea    0x1(%edx),%eax
+  8021b9:	89 03                	mov    %eax,(%ebx)
+  8021bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021be:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8021c2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8021c7:	74 09                	je     8021d2 <putch+0x28>
+  8021c9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8021cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021d0:	c9                   	leave
+  8021d1:	c3                   	ret
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	68 ff 00 00 00       	push   $0xff
+  8021da:	8d 43 08             	lea    0x8(%ebx),%eax
+  8021dd:	50                   	push   %eax
+  8021de:	e8 cc de ff ff       	call   8000af <sys_cputs>
+  8021e3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8021e9:	83 c4 10             	add    $0x10,%esp
+  8021ec:	eb db                	jmp    8021c9 <putch+0x1f>
+
+008021ee <vcprintf>:
+  8021ee:	55                   	push   %ebp
+  8021ef:	89 e5                	mov    %esp,%ebp
+  8021f1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8021f7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8021fe:	00 00 00 
+  802201:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802208:	00 00 00 
+  80220b:	ff 75 0c             	push   0xc(%ebp)
+  80220e:	ff 75 08             	push   0x8(%ebp)
+  802211:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802217:	50                   	push   %eax
+  802218:	68 aa 21 80 00       	push   $0x8021aa
+  80221d:	e8 1c 01 00 00       	call   80233e <vprintfmt>
+  802222:	83 c4 08             	add    $0x8,%esp
+  802225:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80222b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802231:	50                   	push   %eax
+  802232:	e8 78 de ff ff       	call   8000af <sys_cputs>
+  802237:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80223d:	c9                   	leave
+  80223e:	c3                   	ret
+
+0080223f <cprintf>:
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	83 ec 10             	sub    $0x10,%esp
+  802245:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802248:	50                   	push   %eax
+  802249:	ff 75 08             	push   0x8(%ebp)
+  80224c:	e8 9d ff ff ff       	call   8021ee <vcprintf>
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+
+00802253 <printnum>:
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	57                   	push   %edi
+  802257:	56                   	push   %esi
+  802258:	53                   	push   %ebx
+  802259:	83 ec 1c             	sub    $0x1c,%esp
+  80225c:	89 c3                	mov    %eax,%ebx
+  80225e:	89 d6                	mov    %edx,%esi
+  802260:	8b 45 08             	mov    0x8(%ebp),%eax
+  802263:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802266:	89 d1                	mov    %edx,%ecx
+  802268:	89 c2                	mov    %eax,%edx
+  80226a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80226d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802270:	8b 45 10             	mov    0x10(%ebp),%eax
+  802273:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802276:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80227d:	39 c2                	cmp    %eax,%edx
+  80227f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802282:	73 4b                	jae    8022cf <printnum+0x7c>
+  802284:	8b 45 14             	mov    0x14(%ebp),%eax
+  802287:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80228a:	85 ff                	test   %edi,%edi
+  80228c:	7e 11                	jle    80229f <printnum+0x4c>
+  80228e:	83 ec 08             	sub    $0x8,%esp
+  802291:	56                   	push   %esi
+  802292:	ff 75 18             	push   0x18(%ebp)
+  802295:	ff d3                	call   *%ebx
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	83 ef 01             	sub    $0x1,%edi
+  80229d:	75 ef                	jne    80228e <printnum+0x3b>
+  80229f:	83 ec 08             	sub    $0x8,%esp
+  8022a2:	56                   	push   %esi
+  8022a3:	83 ec 04             	sub    $0x4,%esp
+  8022a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8022a9:	ff 75 e0             	push   -0x20(%ebp)
+  8022ac:	ff 75 dc             	push   -0x24(%ebp)
+  8022af:	ff 75 d8             	push   -0x28(%ebp)
+  8022b2:	e8 9b 0d 00 00       	call   803052 <__umoddi3>
+  8022b7:	83 c4 14             	add    $0x14,%esp
+  8022ba:	0f be 80 f7 32 80 00 	movsbl 0x8032f7(%eax),%eax
+  8022c1:	50                   	push   %eax
+  8022c2:	ff d3                	call   *%ebx
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5f                   	pop    %edi
+  8022cd:	5d                   	pop    %ebp
+  8022ce:	c3                   	ret
+  8022cf:	83 ec 0c             	sub    $0xc,%esp
+  8022d2:	ff 75 18             	push   0x18(%ebp)
+  8022d5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8022d8:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8022db:	52                   	push   %edx
+  8022dc:	50                   	push   %eax
+  8022dd:	83 ec 08             	sub    $0x8,%esp
+  8022e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8022e3:	ff 75 e0             	push   -0x20(%ebp)
+  8022e6:	ff 75 dc             	push   -0x24(%ebp)
+  8022e9:	ff 75 d8             	push   -0x28(%ebp)
+  8022ec:	e8 43 0d 00 00       	call   803034 <__udivdi3>
+  8022f1:	83 c4 18             	add    $0x18,%esp
+  8022f4:	52                   	push   %edx
+  8022f5:	50                   	push   %eax
+  8022f6:	89 f2                	mov    %esi,%edx
+  8022f8:	89 d8                	mov    %ebx,%eax
+  8022fa:	e8 54 ff ff ff       	call   802253 <printnum>
+  8022ff:	83 c4 20             	add    $0x20,%esp
+  802302:	eb 9b                	jmp    80229f <printnum+0x4c>
+
+00802304 <sprintputch>:
+  802304:	55                   	push   %ebp
+  802305:	89 e5                	mov    %esp,%ebp
+  802307:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80230a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80230e:	8b 10                	mov    (%eax),%edx
+  802310:	3b 50 04             	cmp    0x4(%eax),%edx
+  802313:	73 0a                	jae    80231f <sprintputch+0x1b>
+  802315:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802318:	89 08                	mov    %ecx,(%eax)
+  80231a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231d:	88 02                	mov    %al,(%edx)
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+
+00802321 <printfmt>:
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	83 ec 08             	sub    $0x8,%esp
+  802327:	8d 45 14             	lea    0x14(%ebp),%eax
+  80232a:	50                   	push   %eax
+  80232b:	ff 75 10             	push   0x10(%ebp)
+  80232e:	ff 75 0c             	push   0xc(%ebp)
+  802331:	ff 75 08             	push   0x8(%ebp)
+  802334:	e8 05 00 00 00       	call   80233e <vprintfmt>
+  802339:	83 c4 10             	add    $0x10,%esp
+  80233c:	c9                   	leave
+  80233d:	c3                   	ret
+
+0080233e <vprintfmt>:
+  80233e:	55                   	push   %ebp
+  80233f:	89 e5                	mov    %esp,%ebp
+  802341:	57                   	push   %edi
+  802342:	56                   	push   %esi
+  802343:	53                   	push   %ebx
+  802344:	83 ec 2c             	sub    $0x2c,%esp
+  802347:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80234a:	89 df                	mov    %ebx,%edi
+  80234c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80234f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802352:	8d 70 01             	lea    0x1(%eax),%esi
+  802355:	0f b6 00             	movzbl (%eax),%eax
+  802358:	83 f8 25             	cmp    $0x25,%eax
+  80235b:	74 1e                	je     80237b <vprintfmt+0x3d>
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	0f 84 15 05 00 00    	je     80287a <vprintfmt+0x53c>
+  802365:	83 ec 08             	sub    $0x8,%esp
+  802368:	53                   	push   %ebx
+  802369:	50                   	push   %eax
+  80236a:	ff d7                	call   *%edi
+  80236c:	83 c6 01             	add    $0x1,%esi
+  80236f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	83 f8 25             	cmp    $0x25,%eax
+  802379:	75 e2                	jne    80235d <vprintfmt+0x1f>
+  80237b:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80237f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  802386:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80238d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802394:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802399:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80239c:	8d 56 01             	lea    0x1(%esi),%edx
+  80239f:	0f b6 0e             	movzbl (%esi),%ecx
+  8023a2:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8023a5:	3c 55                	cmp    $0x55,%al
+  8023a7:	0f 87 3b 04 00 00    	ja     8027e8 <vprintfmt+0x4aa>
+  8023ad:	0f b6 c0             	movzbl %al,%eax
+  8023b0:	ff 24 85 40 34 80 00 	jmp    *0x803440(,%eax,4)
+  8023b7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8023ba:	eb 93                	jmp    80234f <vprintfmt+0x11>
+  8023bc:	89 d6                	mov    %edx,%esi
+  8023be:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8023c2:	eb d8                	jmp    80239c <vprintfmt+0x5e>
+  8023c4:	89 d6                	mov    %edx,%esi
+  8023c6:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8023ca:	eb d0                	jmp    80239c <vprintfmt+0x5e>
+  8023cc:	0f b6 c9             	movzbl %cl,%ecx
+  8023cf:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8023d2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023d5:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8023d9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8023dc:	83 f9 09             	cmp    $0x9,%ecx
+  8023df:	77 6f                	ja     802450 <vprintfmt+0x112>
+  8023e1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8023e4:	83 c2 01             	add    $0x1,%edx
+  8023e7:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8023ea:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8023ee:	0f be 02             	movsbl (%edx),%eax
+  8023f1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8023f4:	83 fe 09             	cmp    $0x9,%esi
+  8023f7:	76 eb                	jbe    8023e4 <vprintfmt+0xa6>
+  8023f9:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8023fc:	89 d6                	mov    %edx,%esi
+  8023fe:	eb 13                	jmp    802413 <vprintfmt+0xd5>
+  802400:	8b 45 14             	mov    0x14(%ebp),%eax
+  802403:	8b 00                	mov    (%eax),%eax
+  802405:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802408:	8b 45 14             	mov    0x14(%ebp),%eax
+  80240b:	8d 40 04             	lea    0x4(%eax),%eax
+  80240e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802411:	89 d6                	mov    %edx,%esi
+  802413:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802417:	79 83                	jns    80239c <vprintfmt+0x5e>
+  802419:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80241c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80241f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802426:	e9 71 ff ff ff       	jmp    80239c <vprintfmt+0x5e>
+  80242b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80242e:	85 c9                	test   %ecx,%ecx
+  802430:	b8 00 00 00 00       	mov    $0x0,%eax
+  802435:	0f 49 c1             	cmovns %ecx,%eax
+  802438:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80243b:	89 d6                	mov    %edx,%esi
+  80243d:	e9 5a ff ff ff       	jmp    80239c <vprintfmt+0x5e>
+  802442:	89 d6                	mov    %edx,%esi
+  802444:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80244b:	e9 4c ff ff ff       	jmp    80239c <vprintfmt+0x5e>
+  802450:	89 d6                	mov    %edx,%esi
+  802452:	eb bf                	jmp    802413 <vprintfmt+0xd5>
+  802454:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802458:	89 d6                	mov    %edx,%esi
+  80245a:	e9 3d ff ff ff       	jmp    80239c <vprintfmt+0x5e>
+  80245f:	89 55 10             	mov    %edx,0x10(%ebp)
+  802462:	8b 45 14             	mov    0x14(%ebp),%eax
+  802465:	8d 70 04             	lea    0x4(%eax),%esi
+  802468:	83 ec 08             	sub    $0x8,%esp
+  80246b:	53                   	push   %ebx
+  80246c:	ff 30                	push   (%eax)
+  80246e:	ff d7                	call   *%edi
+  802470:	83 c4 10             	add    $0x10,%esp
+  802473:	89 75 14             	mov    %esi,0x14(%ebp)
+  802476:	e9 d4 fe ff ff       	jmp    80234f <vprintfmt+0x11>
+  80247b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80247e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802481:	8d 70 04             	lea    0x4(%eax),%esi
+  802484:	8b 10                	mov    (%eax),%edx
+  802486:	89 d0                	mov    %edx,%eax
+  802488:	f7 d8                	neg    %eax
+  80248a:	0f 48 c2             	cmovs  %edx,%eax
+  80248d:	83 f8 12             	cmp    $0x12,%eax
+  802490:	7f 23                	jg     8024b5 <vprintfmt+0x177>
+  802492:	8b 14 85 a0 35 80 00 	mov    0x8035a0(,%eax,4),%edx
+  802499:	85 d2                	test   %edx,%edx
+  80249b:	74 18                	je     8024b5 <vprintfmt+0x177>
+  80249d:	52                   	push   %edx
+  80249e:	68 5b 32 80 00       	push   $0x80325b
+  8024a3:	53                   	push   %ebx
+  8024a4:	57                   	push   %edi
+  8024a5:	e8 77 fe ff ff       	call   802321 <printfmt>
+  8024aa:	83 c4 10             	add    $0x10,%esp
+  8024ad:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024b0:	e9 9a fe ff ff       	jmp    80234f <vprintfmt+0x11>
+  8024b5:	50                   	push   %eax
+  8024b6:	68 0f 33 80 00       	push   $0x80330f
+  8024bb:	53                   	push   %ebx
+  8024bc:	57                   	push   %edi
+  8024bd:	e8 5f fe ff ff       	call   802321 <printfmt>
+  8024c2:	83 c4 10             	add    $0x10,%esp
+  8024c5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8024c8:	e9 82 fe ff ff       	jmp    80234f <vprintfmt+0x11>
+  8024cd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8024d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d3:	83 c0 04             	add    $0x4,%eax
+  8024d6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8024d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024dc:	8b 00                	mov    (%eax),%eax
+  8024de:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	0f 84 61 03 00 00    	je     80284a <vprintfmt+0x50c>
+  8024e9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8024ed:	7e 06                	jle    8024f5 <vprintfmt+0x1b7>
+  8024ef:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8024f3:	75 29                	jne    80251e <vprintfmt+0x1e0>
+  8024f5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8024f8:	8d 70 01             	lea    0x1(%eax),%esi
+  8024fb:	0f b6 00             	movzbl (%eax),%eax
+  8024fe:	0f be d0             	movsbl %al,%edx
+  802501:	85 d2                	test   %edx,%edx
+  802503:	0f 84 bb 00 00 00    	je     8025c4 <vprintfmt+0x286>
+  802509:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80250c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80250f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802512:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802515:	eb 7a                	jmp    802591 <vprintfmt+0x253>
+  802517:	c7 45 d0 08 33 80 00 	movl   $0x803308,-0x30(%ebp)
+  80251e:	83 ec 08             	sub    $0x8,%esp
+  802521:	ff 75 d4             	push   -0x2c(%ebp)
+  802524:	ff 75 d0             	push   -0x30(%ebp)
+  802527:	e8 e0 03 00 00       	call   80290c <strnlen>
+  80252c:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80252f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802532:	83 c4 10             	add    $0x10,%esp
+  802535:	85 d2                	test   %edx,%edx
+  802537:	0f 8e d6 02 00 00    	jle    802813 <vprintfmt+0x4d5>
+  80253d:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802541:	83 ec 08             	sub    $0x8,%esp
+  802544:	53                   	push   %ebx
+  802545:	56                   	push   %esi
+  802546:	ff d7                	call   *%edi
+  802548:	83 c4 10             	add    $0x10,%esp
+  80254b:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80254f:	75 f0                	jne    802541 <vprintfmt+0x203>
+  802551:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802554:	8d 70 01             	lea    0x1(%eax),%esi
+  802557:	0f b6 00             	movzbl (%eax),%eax
+  80255a:	0f be d0             	movsbl %al,%edx
+  80255d:	85 d2                	test   %edx,%edx
+  80255f:	0f 84 da 02 00 00    	je     80283f <vprintfmt+0x501>
+  802565:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802568:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80256b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80256e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802571:	eb 1e                	jmp    802591 <vprintfmt+0x253>
+  802573:	83 ec 08             	sub    $0x8,%esp
+  802576:	ff 75 0c             	push   0xc(%ebp)
+  802579:	52                   	push   %edx
+  80257a:	ff 55 08             	call   *0x8(%ebp)
+  80257d:	83 c4 10             	add    $0x10,%esp
+  802580:	83 eb 01             	sub    $0x1,%ebx
+  802583:	83 c6 01             	add    $0x1,%esi
+  802586:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80258a:	0f be d0             	movsbl %al,%edx
+  80258d:	85 d2                	test   %edx,%edx
+  80258f:	74 2a                	je     8025bb <vprintfmt+0x27d>
+  802591:	85 ff                	test   %edi,%edi
+  802593:	78 05                	js     80259a <vprintfmt+0x25c>
+  802595:	83 ef 01             	sub    $0x1,%edi
+  802598:	78 59                	js     8025f3 <vprintfmt+0x2b5>
+  80259a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80259e:	74 d3                	je     802573 <vprintfmt+0x235>
+  8025a0:	0f be c0             	movsbl %al,%eax
+  8025a3:	83 e8 20             	sub    $0x20,%eax
+  8025a6:	83 f8 5e             	cmp    $0x5e,%eax
+  8025a9:	76 c8                	jbe    802573 <vprintfmt+0x235>
+  8025ab:	83 ec 08             	sub    $0x8,%esp
+  8025ae:	ff 75 0c             	push   0xc(%ebp)
+  8025b1:	6a 3f                	push   $0x3f
+  8025b3:	ff 55 08             	call   *0x8(%ebp)
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	eb c5                	jmp    802580 <vprintfmt+0x242>
+  8025bb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025c4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8025c7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8025cb:	7e 1b                	jle    8025e8 <vprintfmt+0x2aa>
+  8025cd:	83 ec 08             	sub    $0x8,%esp
+  8025d0:	53                   	push   %ebx
+  8025d1:	6a 20                	push   $0x20
+  8025d3:	ff d7                	call   *%edi
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	83 ee 01             	sub    $0x1,%esi
+  8025db:	75 f0                	jne    8025cd <vprintfmt+0x28f>
+  8025dd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025e3:	e9 67 fd ff ff       	jmp    80234f <vprintfmt+0x11>
+  8025e8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8025ee:	e9 5c fd ff ff       	jmp    80234f <vprintfmt+0x11>
+  8025f3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8025f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025fc:	eb c6                	jmp    8025c4 <vprintfmt+0x286>
+  8025fe:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802601:	89 55 10             	mov    %edx,0x10(%ebp)
+  802604:	83 f9 01             	cmp    $0x1,%ecx
+  802607:	7f 1f                	jg     802628 <vprintfmt+0x2ea>
+  802609:	85 c9                	test   %ecx,%ecx
+  80260b:	74 67                	je     802674 <vprintfmt+0x336>
+  80260d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802610:	8b 30                	mov    (%eax),%esi
+  802612:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802615:	89 f0                	mov    %esi,%eax
+  802617:	c1 f8 1f             	sar    $0x1f,%eax
+  80261a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80261d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802620:	8d 40 04             	lea    0x4(%eax),%eax
+  802623:	89 45 14             	mov    %eax,0x14(%ebp)
+  802626:	eb 17                	jmp    80263f <vprintfmt+0x301>
+  802628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80262b:	8b 50 04             	mov    0x4(%eax),%edx
+  80262e:	8b 00                	mov    (%eax),%eax
+  802630:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802633:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802636:	8b 45 14             	mov    0x14(%ebp),%eax
+  802639:	8d 40 08             	lea    0x8(%eax),%eax
+  80263c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80263f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802642:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802645:	be 0a 00 00 00       	mov    $0xa,%esi
+  80264a:	85 c9                	test   %ecx,%ecx
+  80264c:	0f 89 12 01 00 00    	jns    802764 <vprintfmt+0x426>
+  802652:	83 ec 08             	sub    $0x8,%esp
+  802655:	53                   	push   %ebx
+  802656:	6a 2d                	push   $0x2d
+  802658:	ff d7                	call   *%edi
+  80265a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80265d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802660:	f7 da                	neg    %edx
+  802662:	83 d1 00             	adc    $0x0,%ecx
+  802665:	f7 d9                	neg    %ecx
+  802667:	83 c4 10             	add    $0x10,%esp
+  80266a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80266f:	e9 f0 00 00 00       	jmp    802764 <vprintfmt+0x426>
+  802674:	8b 45 14             	mov    0x14(%ebp),%eax
+  802677:	8b 30                	mov    (%eax),%esi
+  802679:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80267c:	89 f0                	mov    %esi,%eax
+  80267e:	c1 f8 1f             	sar    $0x1f,%eax
+  802681:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802684:	8b 45 14             	mov    0x14(%ebp),%eax
+  802687:	8d 40 04             	lea    0x4(%eax),%eax
+  80268a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80268d:	eb b0                	jmp    80263f <vprintfmt+0x301>
+  80268f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802692:	89 55 10             	mov    %edx,0x10(%ebp)
+  802695:	83 f9 01             	cmp    $0x1,%ecx
+  802698:	7f 1e                	jg     8026b8 <vprintfmt+0x37a>
+  80269a:	85 c9                	test   %ecx,%ecx
+  80269c:	74 32                	je     8026d0 <vprintfmt+0x392>
+  80269e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a1:	8b 10                	mov    (%eax),%edx
+  8026a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8026ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026ae:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026b3:	e9 ac 00 00 00       	jmp    802764 <vprintfmt+0x426>
+  8026b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026bb:	8b 10                	mov    (%eax),%edx
+  8026bd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8026c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8026c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026c6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026cb:	e9 94 00 00 00       	jmp    802764 <vprintfmt+0x426>
+  8026d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026d3:	8b 10                	mov    (%eax),%edx
+  8026d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026da:	8d 40 04             	lea    0x4(%eax),%eax
+  8026dd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8026e0:	be 0a 00 00 00       	mov    $0xa,%esi
+  8026e5:	eb 7d                	jmp    802764 <vprintfmt+0x426>
+  8026e7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8026ea:	89 55 10             	mov    %edx,0x10(%ebp)
+  8026ed:	83 f9 01             	cmp    $0x1,%ecx
+  8026f0:	7f 1b                	jg     80270d <vprintfmt+0x3cf>
+  8026f2:	85 c9                	test   %ecx,%ecx
+  8026f4:	74 2c                	je     802722 <vprintfmt+0x3e4>
+  8026f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026f9:	8b 10                	mov    (%eax),%edx
+  8026fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802700:	8d 40 04             	lea    0x4(%eax),%eax
+  802703:	89 45 14             	mov    %eax,0x14(%ebp)
+  802706:	be 08 00 00 00       	mov    $0x8,%esi
+  80270b:	eb 57                	jmp    802764 <vprintfmt+0x426>
+  80270d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802710:	8b 10                	mov    (%eax),%edx
+  802712:	8b 48 04             	mov    0x4(%eax),%ecx
+  802715:	8d 40 08             	lea    0x8(%eax),%eax
+  802718:	89 45 14             	mov    %eax,0x14(%ebp)
+  80271b:	be 08 00 00 00       	mov    $0x8,%esi
+  802720:	eb 42                	jmp    802764 <vprintfmt+0x426>
+  802722:	8b 45 14             	mov    0x14(%ebp),%eax
+  802725:	8b 10                	mov    (%eax),%edx
+  802727:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80272c:	8d 40 04             	lea    0x4(%eax),%eax
+  80272f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802732:	be 08 00 00 00       	mov    $0x8,%esi
+  802737:	eb 2b                	jmp    802764 <vprintfmt+0x426>
+  802739:	89 55 10             	mov    %edx,0x10(%ebp)
+  80273c:	83 ec 08             	sub    $0x8,%esp
+  80273f:	53                   	push   %ebx
+  802740:	6a 30                	push   $0x30
+  802742:	ff d7                	call   *%edi
+  802744:	83 c4 08             	add    $0x8,%esp
+  802747:	53                   	push   %ebx
+  802748:	6a 78                	push   $0x78
+  80274a:	ff d7                	call   *%edi
+  80274c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80274f:	8b 10                	mov    (%eax),%edx
+  802751:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802756:	83 c4 10             	add    $0x10,%esp
+  802759:	8d 40 04             	lea    0x4(%eax),%eax
+  80275c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80275f:	be 10 00 00 00       	mov    $0x10,%esi
+  802764:	83 ec 0c             	sub    $0xc,%esp
+  802767:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80276b:	50                   	push   %eax
+  80276c:	ff 75 e4             	push   -0x1c(%ebp)
+  80276f:	56                   	push   %esi
+  802770:	51                   	push   %ecx
+  802771:	52                   	push   %edx
+  802772:	89 da                	mov    %ebx,%edx
+  802774:	89 f8                	mov    %edi,%eax
+  802776:	e8 d8 fa ff ff       	call   802253 <printnum>
+  80277b:	83 c4 20             	add    $0x20,%esp
+  80277e:	e9 cc fb ff ff       	jmp    80234f <vprintfmt+0x11>
+  802783:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802786:	89 55 10             	mov    %edx,0x10(%ebp)
+  802789:	83 f9 01             	cmp    $0x1,%ecx
+  80278c:	7f 1b                	jg     8027a9 <vprintfmt+0x46b>
+  80278e:	85 c9                	test   %ecx,%ecx
+  802790:	74 2c                	je     8027be <vprintfmt+0x480>
+  802792:	8b 45 14             	mov    0x14(%ebp),%eax
+  802795:	8b 10                	mov    (%eax),%edx
+  802797:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80279c:	8d 40 04             	lea    0x4(%eax),%eax
+  80279f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027a2:	be 10 00 00 00       	mov    $0x10,%esi
+  8027a7:	eb bb                	jmp    802764 <vprintfmt+0x426>
+  8027a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027ac:	8b 10                	mov    (%eax),%edx
+  8027ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8027b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8027b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027b7:	be 10 00 00 00       	mov    $0x10,%esi
+  8027bc:	eb a6                	jmp    802764 <vprintfmt+0x426>
+  8027be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c1:	8b 10                	mov    (%eax),%edx
+  8027c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8027cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8027ce:	be 10 00 00 00       	mov    $0x10,%esi
+  8027d3:	eb 8f                	jmp    802764 <vprintfmt+0x426>
+  8027d5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8027d8:	83 ec 08             	sub    $0x8,%esp
+  8027db:	53                   	push   %ebx
+  8027dc:	6a 25                	push   $0x25
+  8027de:	ff d7                	call   *%edi
+  8027e0:	83 c4 10             	add    $0x10,%esp
+  8027e3:	e9 67 fb ff ff       	jmp    80234f <vprintfmt+0x11>
+  8027e8:	83 ec 08             	sub    $0x8,%esp
+  8027eb:	53                   	push   %ebx
+  8027ec:	6a 25                	push   $0x25
+  8027ee:	ff d7                	call   *%edi
+  8027f0:	83 c4 10             	add    $0x10,%esp
+  8027f3:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8027f7:	0f 84 ba fb ff ff    	je     8023b7 <vprintfmt+0x79>
+  8027fd:	89 75 10             	mov    %esi,0x10(%ebp)
+  802800:	89 f0                	mov    %esi,%eax
+  802802:	83 e8 01             	sub    $0x1,%eax
+  802805:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802809:	75 f7                	jne    802802 <vprintfmt+0x4c4>
+  80280b:	89 45 10             	mov    %eax,0x10(%ebp)
+  80280e:	e9 3c fb ff ff       	jmp    80234f <vprintfmt+0x11>
+  802813:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802816:	8d 70 01             	lea    0x1(%eax),%esi
+  802819:	0f b6 00             	movzbl (%eax),%eax
+  80281c:	0f be d0             	movsbl %al,%edx
+  80281f:	85 d2                	test   %edx,%edx
+  802821:	74 11                	je     802834 <vprintfmt+0x4f6>
+  802823:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802826:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802829:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80282c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80282f:	e9 5d fd ff ff       	jmp    802591 <vprintfmt+0x253>
+  802834:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802837:	89 45 14             	mov    %eax,0x14(%ebp)
+  80283a:	e9 10 fb ff ff       	jmp    80234f <vprintfmt+0x11>
+  80283f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802842:	89 45 14             	mov    %eax,0x14(%ebp)
+  802845:	e9 05 fb ff ff       	jmp    80234f <vprintfmt+0x11>
+  80284a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80284e:	7e 0a                	jle    80285a <vprintfmt+0x51c>
+  802850:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802854:	0f 85 bd fc ff ff    	jne    802517 <vprintfmt+0x1d9>
+  80285a:	ba 28 00 00 00       	mov    $0x28,%edx
+  80285f:	b8 28 00 00 00       	mov    $0x28,%eax
+  802864:	be 09 33 80 00       	mov    $0x803309,%esi
+  802869:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80286c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80286f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802872:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802875:	e9 17 fd ff ff       	jmp    802591 <vprintfmt+0x253>
+  80287a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80287d:	5b                   	pop    %ebx
+  80287e:	5e                   	pop    %esi
+  80287f:	5f                   	pop    %edi
+  802880:	5d                   	pop    %ebp
+  802881:	c3                   	ret
+
+00802882 <vsnprintf>:
+  802882:	55                   	push   %ebp
+  802883:	89 e5                	mov    %esp,%ebp
+  802885:	83 ec 18             	sub    $0x18,%esp
+  802888:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80288e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802891:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802895:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802898:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	74 26                	je     8028c9 <vsnprintf+0x47>
+  8028a3:	85 d2                	test   %edx,%edx
+  8028a5:	7e 22                	jle    8028c9 <vsnprintf+0x47>
+  8028a7:	ff 75 14             	push   0x14(%ebp)
+  8028aa:	ff 75 10             	push   0x10(%ebp)
+  8028ad:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8028b0:	50                   	push   %eax
+  8028b1:	68 04 23 80 00       	push   $0x802304
+  8028b6:	e8 83 fa ff ff       	call   80233e <vprintfmt>
+  8028bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8028be:	c6 00 00             	movb   $0x0,(%eax)
+  8028c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c4:	83 c4 10             	add    $0x10,%esp
+  8028c7:	c9                   	leave
+  8028c8:	c3                   	ret
+  8028c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028ce:	eb f7                	jmp    8028c7 <vsnprintf+0x45>
+
+008028d0 <snprintf>:
+  8028d0:	55                   	push   %ebp
+  8028d1:	89 e5                	mov    %esp,%ebp
+  8028d3:	83 ec 08             	sub    $0x8,%esp
+  8028d6:	8d 45 14             	lea    0x14(%ebp),%eax
+  8028d9:	50                   	push   %eax
+  8028da:	ff 75 10             	push   0x10(%ebp)
+  8028dd:	ff 75 0c             	push   0xc(%ebp)
+  8028e0:	ff 75 08             	push   0x8(%ebp)
+  8028e3:	e8 9a ff ff ff       	call   802882 <vsnprintf>
+  8028e8:	c9                   	leave
+  8028e9:	c3                   	ret
+
+008028ea <strlen>:
+  8028ea:	55                   	push   %ebp
+  8028eb:	89 e5                	mov    %esp,%ebp
+  8028ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028f0:	80 3a 00             	cmpb   $0x0,(%edx)
+  8028f3:	74 10                	je     802905 <strlen+0x1b>
+  8028f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fa:	83 c0 01             	add    $0x1,%eax
+  8028fd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802901:	75 f7                	jne    8028fa <strlen+0x10>
+  802903:	5d                   	pop    %ebp
+  802904:	c3                   	ret
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	eb f7                	jmp    802903 <strlen+0x19>
+
+0080290c <strnlen>:
+  80290c:	55                   	push   %ebp
+  80290d:	89 e5                	mov    %esp,%ebp
+  80290f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802912:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802915:	85 d2                	test   %edx,%edx
+  802917:	74 16                	je     80292f <strnlen+0x23>
+  802919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802922:	74 09                	je     80292d <strnlen+0x21>
+  802924:	83 c0 01             	add    $0x1,%eax
+  802927:	39 d0                	cmp    %edx,%eax
+  802929:	75 f3                	jne    80291e <strnlen+0x12>
+  80292b:	89 d0                	mov    %edx,%eax
+  80292d:	5d                   	pop    %ebp
+  80292e:	c3                   	ret
+  80292f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802934:	eb f7                	jmp    80292d <strnlen+0x21>
+
+00802936 <strcpy>:
+  802936:	55                   	push   %ebp
+  802937:	89 e5                	mov    %esp,%ebp
+  802939:	53                   	push   %ebx
+  80293a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80293d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802940:	b8 00 00 00 00       	mov    $0x0,%eax
+  802945:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802949:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80294c:	83 c0 01             	add    $0x1,%eax
+  80294f:	84 d2                	test   %dl,%dl
+  802951:	75 f2                	jne    802945 <strcpy+0xf>
+  802953:	89 c8                	mov    %ecx,%eax
+  802955:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802958:	c9                   	leave
+  802959:	c3                   	ret
+
+0080295a <strcat>:
+  80295a:	55                   	push   %ebp
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	53                   	push   %ebx
+  80295e:	83 ec 10             	sub    $0x10,%esp
+  802961:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802964:	53                   	push   %ebx
+  802965:	e8 80 ff ff ff       	call   8028ea <strlen>
+  80296a:	83 c4 08             	add    $0x8,%esp
+  80296d:	ff 75 0c             	push   0xc(%ebp)
+  802970:	01 d8                	add    %ebx,%eax
+  802972:	50                   	push   %eax
+  802973:	e8 be ff ff ff       	call   802936 <strcpy>
+  802978:	89 d8                	mov    %ebx,%eax
+  80297a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+
+0080297f <strncpy>:
+  80297f:	55                   	push   %ebp
+  802980:	89 e5                	mov    %esp,%ebp
+  802982:	56                   	push   %esi
+  802983:	53                   	push   %ebx
+  802984:	8b 75 08             	mov    0x8(%ebp),%esi
+  802987:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80298a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80298d:	85 db                	test   %ebx,%ebx
+  80298f:	74 17                	je     8029a8 <strncpy+0x29>
+  802991:	01 f3                	add    %esi,%ebx
+  802993:	89 f0                	mov    %esi,%eax
+  802995:	83 c0 01             	add    $0x1,%eax
+  802998:	0f b6 0a             	movzbl (%edx),%ecx
+  80299b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80299e:	80 f9 01             	cmp    $0x1,%cl
+  8029a1:	83 da ff             	sbb    $0xffffffff,%edx
+  8029a4:	39 c3                	cmp    %eax,%ebx
+  8029a6:	75 ed                	jne    802995 <strncpy+0x16>
+  8029a8:	89 f0                	mov    %esi,%eax
+  8029aa:	5b                   	pop    %ebx
+  8029ab:	5e                   	pop    %esi
+  8029ac:	5d                   	pop    %ebp
+  8029ad:	c3                   	ret
+
+008029ae <strlcpy>:
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	56                   	push   %esi
+  8029b2:	53                   	push   %ebx
+  8029b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029bc:	89 f0                	mov    %esi,%eax
+  8029be:	85 db                	test   %ebx,%ebx
+  8029c0:	74 1e                	je     8029e0 <strlcpy+0x32>
+  8029c2:	83 eb 01             	sub    $0x1,%ebx
+  8029c5:	74 16                	je     8029dd <strlcpy+0x2f>
+  8029c7:	01 f3                	add    %esi,%ebx
+  8029c9:	0f b6 0a             	movzbl (%edx),%ecx
+  8029cc:	84 c9                	test   %cl,%cl
+  8029ce:	74 0d                	je     8029dd <strlcpy+0x2f>
+  8029d0:	83 c2 01             	add    $0x1,%edx
+  8029d3:	83 c0 01             	add    $0x1,%eax
+  8029d6:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8029d9:	39 d8                	cmp    %ebx,%eax
+  8029db:	75 ec                	jne    8029c9 <strlcpy+0x1b>
+  8029dd:	c6 00 00             	movb   $0x0,(%eax)
+  8029e0:	29 f0                	sub    %esi,%eax
+  8029e2:	5b                   	pop    %ebx
+  8029e3:	5e                   	pop    %esi
+  8029e4:	5d                   	pop    %ebp
+  8029e5:	c3                   	ret
+
+008029e6 <strcmp>:
+  8029e6:	55                   	push   %ebp
+  8029e7:	89 e5                	mov    %esp,%ebp
+  8029e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029ef:	0f b6 01             	movzbl (%ecx),%eax
+  8029f2:	84 c0                	test   %al,%al
+  8029f4:	74 11                	je     802a07 <strcmp+0x21>
+  8029f6:	38 02                	cmp    %al,(%edx)
+  8029f8:	75 0d                	jne    802a07 <strcmp+0x21>
+  8029fa:	83 c1 01             	add    $0x1,%ecx
+  8029fd:	83 c2 01             	add    $0x1,%edx
+  802a00:	0f b6 01             	movzbl (%ecx),%eax
+  802a03:	84 c0                	test   %al,%al
+  802a05:	75 ef                	jne    8029f6 <strcmp+0x10>
+  802a07:	0f b6 c0             	movzbl %al,%eax
+  802a0a:	0f b6 12             	movzbl (%edx),%edx
+  802a0d:	29 d0                	sub    %edx,%eax
+  802a0f:	5d                   	pop    %ebp
+  802a10:	c3                   	ret
+
+00802a11 <strncmp>:
+  802a11:	55                   	push   %ebp
+  802a12:	89 e5                	mov    %esp,%ebp
+  802a14:	53                   	push   %ebx
+  802a15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a1b:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a23:	85 d2                	test   %edx,%edx
+  802a25:	74 2e                	je     802a55 <strncmp+0x44>
+  802a27:	0f b6 01             	movzbl (%ecx),%eax
+  802a2a:	84 c0                	test   %al,%al
+  802a2c:	74 16                	je     802a44 <strncmp+0x33>
+  802a2e:	3a 03                	cmp    (%ebx),%al
+  802a30:	75 12                	jne    802a44 <strncmp+0x33>
+  802a32:	83 c1 01             	add    $0x1,%ecx
+  802a35:	83 c3 01             	add    $0x1,%ebx
+  802a38:	83 ea 01             	sub    $0x1,%edx
+  802a3b:	75 ea                	jne    802a27 <strncmp+0x16>
+  802a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a42:	eb 11                	jmp    802a55 <strncmp+0x44>
+  802a44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a49:	85 d2                	test   %edx,%edx
+  802a4b:	74 08                	je     802a55 <strncmp+0x44>
+  802a4d:	0f b6 01             	movzbl (%ecx),%eax
+  802a50:	0f b6 13             	movzbl (%ebx),%edx
+  802a53:	29 d0                	sub    %edx,%eax
+  802a55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a58:	c9                   	leave
+  802a59:	c3                   	ret
+
+00802a5a <strchr>:
+  802a5a:	55                   	push   %ebp
+  802a5b:	89 e5                	mov    %esp,%ebp
+  802a5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a60:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  802a64:	0f b6 10             	movzbl (%eax),%edx
+  802a67:	84 d2                	test   %dl,%dl
+  802a69:	74 15                	je     802a80 <strchr+0x26>
+  802a6b:	38 d1                	cmp    %dl,%cl
+  802a6d:	74 0f                	je     802a7e <strchr+0x24>
+  802a6f:	83 c0 01             	add    $0x1,%eax
+  802a72:	0f b6 10             	movzbl (%eax),%edx
+  802a75:	84 d2                	test   %dl,%dl
+  802a77:	75 f2                	jne    802a6b <strchr+0x11>
+  802a79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7e:	5d                   	pop    %ebp
+  802a7f:	c3                   	ret
+  802a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a85:	eb f7                	jmp    802a7e <strchr+0x24>
+
+00802a87 <strfind>:
+  802a87:	55                   	push   %ebp
+  802a88:	89 e5                	mov    %esp,%ebp
+  802a8a:	53                   	push   %ebx
+  802a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a91:	0f b6 18             	movzbl (%eax),%ebx
+  802a94:	38 d3                	cmp    %dl,%bl
+  802a96:	74 14                	je     802aac <strfind+0x25>
+  802a98:	89 d1                	mov    %edx,%ecx
+  802a9a:	84 db                	test   %bl,%bl
+  802a9c:	74 0e                	je     802aac <strfind+0x25>
+  802a9e:	83 c0 01             	add    $0x1,%eax
+  802aa1:	0f b6 10             	movzbl (%eax),%edx
+  802aa4:	38 ca                	cmp    %cl,%dl
+  802aa6:	74 04                	je     802aac <strfind+0x25>
+  802aa8:	84 d2                	test   %dl,%dl
+  802aaa:	75 f2                	jne    802a9e <strfind+0x17>
+  802aac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aaf:	c9                   	leave
+  802ab0:	c3                   	ret
+
+00802ab1 <memset>:
+  802ab1:	55                   	push   %ebp
+  802ab2:	89 e5                	mov    %esp,%ebp
+  802ab4:	57                   	push   %edi
+  802ab5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ab8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802abb:	85 c9                	test   %ecx,%ecx
+  802abd:	74 20                	je     802adf <memset+0x2e>
+  802abf:	89 f8                	mov    %edi,%eax
+  802ac1:	09 c8                	or     %ecx,%eax
+  802ac3:	a8 03                	test   $0x3,%al
+  802ac5:	75 12                	jne    802ad9 <memset+0x28>
+  802ac7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802acb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  802ad1:	c1 e9 02             	shr    $0x2,%ecx
+  802ad4:	fc                   	cld
+  802ad5:	f3 ab                	rep stos %eax,%es:(%edi)
+  802ad7:	eb 06                	jmp    802adf <memset+0x2e>
+  802ad9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802adc:	fc                   	cld
+  802add:	f3 aa                	rep stos %al,%es:(%edi)
+  802adf:	89 f8                	mov    %edi,%eax
+  802ae1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802ae4:	c9                   	leave
+  802ae5:	c3                   	ret
+
+00802ae6 <memmove>:
+  802ae6:	55                   	push   %ebp
+  802ae7:	89 e5                	mov    %esp,%ebp
+  802ae9:	57                   	push   %edi
+  802aea:	56                   	push   %esi
+  802aeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802af1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802af4:	39 c6                	cmp    %eax,%esi
+  802af6:	73 32                	jae    802b2a <memmove+0x44>
+  802af8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802afb:	39 d0                	cmp    %edx,%eax
+  802afd:	73 2b                	jae    802b2a <memmove+0x44>
+  802aff:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  802b02:	89 d6                	mov    %edx,%esi
+  802b04:	09 fe                	or     %edi,%esi
+  802b06:	09 ce                	or     %ecx,%esi
+  802b08:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802b0e:	75 0e                	jne    802b1e <memmove+0x38>
+  802b10:	83 ef 04             	sub    $0x4,%edi
+  802b13:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802b16:	c1 e9 02             	shr    $0x2,%ecx
+  802b19:	fd                   	std
+  802b1a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b1c:	eb 09                	jmp    802b27 <memmove+0x41>
+  802b1e:	83 ef 01             	sub    $0x1,%edi
+  802b21:	8d 72 ff             	lea    -0x1(%edx),%esi
+  802b24:	fd                   	std
+  802b25:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b27:	fc                   	cld
+  802b28:	eb 1a                	jmp    802b44 <memmove+0x5e>
+  802b2a:	89 f2                	mov    %esi,%edx
+  802b2c:	09 c2                	or     %eax,%edx
+  802b2e:	09 ca                	or     %ecx,%edx
+  802b30:	f6 c2 03             	test   $0x3,%dl
+  802b33:	75 0a                	jne    802b3f <memmove+0x59>
+  802b35:	c1 e9 02             	shr    $0x2,%ecx
+  802b38:	89 c7                	mov    %eax,%edi
+  802b3a:	fc                   	cld
+  802b3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802b3d:	eb 05                	jmp    802b44 <memmove+0x5e>
+  802b3f:	89 c7                	mov    %eax,%edi
+  802b41:	fc                   	cld
+  802b42:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  802b44:	5e                   	pop    %esi
+  802b45:	5f                   	pop    %edi
+  802b46:	5d                   	pop    %ebp
+  802b47:	c3                   	ret
+
+00802b48 <memcpy>:
+  802b48:	55                   	push   %ebp
+  802b49:	89 e5                	mov    %esp,%ebp
+  802b4b:	83 ec 0c             	sub    $0xc,%esp
+  802b4e:	ff 75 10             	push   0x10(%ebp)
+  802b51:	ff 75 0c             	push   0xc(%ebp)
+  802b54:	ff 75 08             	push   0x8(%ebp)
+  802b57:	e8 8a ff ff ff       	call   802ae6 <memmove>
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+
+00802b5e <memcmp>:
+  802b5e:	55                   	push   %ebp
+  802b5f:	89 e5                	mov    %esp,%ebp
+  802b61:	56                   	push   %esi
+  802b62:	53                   	push   %ebx
+  802b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b69:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b6c:	85 f6                	test   %esi,%esi
+  802b6e:	74 29                	je     802b99 <memcmp+0x3b>
+  802b70:	01 c6                	add    %eax,%esi
+  802b72:	0f b6 08             	movzbl (%eax),%ecx
+  802b75:	0f b6 1a             	movzbl (%edx),%ebx
+  802b78:	38 d9                	cmp    %bl,%cl
+  802b7a:	75 11                	jne    802b8d <memcmp+0x2f>
+  802b7c:	83 c0 01             	add    $0x1,%eax
+  802b7f:	83 c2 01             	add    $0x1,%edx
+  802b82:	39 c6                	cmp    %eax,%esi
+  802b84:	75 ec                	jne    802b72 <memcmp+0x14>
+  802b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8b:	eb 08                	jmp    802b95 <memcmp+0x37>
+  802b8d:	0f b6 c1             	movzbl %cl,%eax
+  802b90:	0f b6 db             	movzbl %bl,%ebx
+  802b93:	29 d8                	sub    %ebx,%eax
+  802b95:	5b                   	pop    %ebx
+  802b96:	5e                   	pop    %esi
+  802b97:	5d                   	pop    %ebp
+  802b98:	c3                   	ret
+  802b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9e:	eb f5                	jmp    802b95 <memcmp+0x37>
+
+00802ba0 <memfind>:
+  802ba0:	55                   	push   %ebp
+  802ba1:	89 e5                	mov    %esp,%ebp
+  802ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ba9:	89 c2                	mov    %eax,%edx
+  802bab:	03 55 10             	add    0x10(%ebp),%edx
+  802bae:	39 d0                	cmp    %edx,%eax
+  802bb0:	73 0d                	jae    802bbf <memfind+0x1f>
+  802bb2:	38 08                	cmp    %cl,(%eax)
+  802bb4:	74 0d                	je     802bc3 <memfind+0x23>
+  802bb6:	83 c0 01             	add    $0x1,%eax
+  802bb9:	39 c2                	cmp    %eax,%edx
+  802bbb:	75 f5                	jne    802bb2 <memfind+0x12>
+  802bbd:	eb 06                	jmp    802bc5 <memfind+0x25>
+  802bbf:	89 c2                	mov    %eax,%edx
+  802bc1:	eb 02                	jmp    802bc5 <memfind+0x25>
+  802bc3:	89 c2                	mov    %eax,%edx
+  802bc5:	89 d0                	mov    %edx,%eax
+  802bc7:	5d                   	pop    %ebp
+  802bc8:	c3                   	ret
+
+00802bc9 <strtol>:
+  802bc9:	55                   	push   %ebp
+  802bca:	89 e5                	mov    %esp,%ebp
+  802bcc:	57                   	push   %edi
+  802bcd:	56                   	push   %esi
+  802bce:	53                   	push   %ebx
+  802bcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bd5:	0f b6 02             	movzbl (%edx),%eax
+  802bd8:	3c 20                	cmp    $0x20,%al
+  802bda:	74 04                	je     802be0 <strtol+0x17>
+  802bdc:	3c 09                	cmp    $0x9,%al
+  802bde:	75 0e                	jne    802bee <strtol+0x25>
+  802be0:	83 c2 01             	add    $0x1,%edx
+  802be3:	0f b6 02             	movzbl (%edx),%eax
+  802be6:	3c 20                	cmp    $0x20,%al
+  802be8:	74 f6                	je     802be0 <strtol+0x17>
+  802bea:	3c 09                	cmp    $0x9,%al
+  802bec:	74 f2                	je     802be0 <strtol+0x17>
+  802bee:	3c 2b                	cmp    $0x2b,%al
+  802bf0:	74 2a                	je     802c1c <strtol+0x53>
+  802bf2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf7:	3c 2d                	cmp    $0x2d,%al
+  802bf9:	74 2b                	je     802c26 <strtol+0x5d>
+  802bfb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802c01:	75 0f                	jne    802c12 <strtol+0x49>
+  802c03:	80 3a 30             	cmpb   $0x30,(%edx)
+  802c06:	74 28                	je     802c30 <strtol+0x67>
+  802c08:	85 db                	test   %ebx,%ebx
+  802c0a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c0f:	0f 44 d8             	cmove  %eax,%ebx
+  802c12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c17:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802c1a:	eb 46                	jmp    802c62 <strtol+0x99>
+  802c1c:	83 c2 01             	add    $0x1,%edx
+  802c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c24:	eb d5                	jmp    802bfb <strtol+0x32>
+  802c26:	83 c2 01             	add    $0x1,%edx
+  802c29:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c2e:	eb cb                	jmp    802bfb <strtol+0x32>
+  802c30:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802c34:	74 0e                	je     802c44 <strtol+0x7b>
+  802c36:	85 db                	test   %ebx,%ebx
+  802c38:	75 d8                	jne    802c12 <strtol+0x49>
+  802c3a:	83 c2 01             	add    $0x1,%edx
+  802c3d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802c42:	eb ce                	jmp    802c12 <strtol+0x49>
+  802c44:	83 c2 02             	add    $0x2,%edx
+  802c47:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802c4c:	eb c4                	jmp    802c12 <strtol+0x49>
+  802c4e:	0f be c0             	movsbl %al,%eax
+  802c51:	83 e8 30             	sub    $0x30,%eax
+  802c54:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c57:	7d 3a                	jge    802c93 <strtol+0xca>
+  802c59:	83 c2 01             	add    $0x1,%edx
+  802c5c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802c60:	01 c1                	add    %eax,%ecx
+  802c62:	0f b6 02             	movzbl (%edx),%eax
+  802c65:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c68:	89 f3                	mov    %esi,%ebx
+  802c6a:	80 fb 09             	cmp    $0x9,%bl
+  802c6d:	76 df                	jbe    802c4e <strtol+0x85>
+  802c6f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802c72:	89 f3                	mov    %esi,%ebx
+  802c74:	80 fb 19             	cmp    $0x19,%bl
+  802c77:	77 08                	ja     802c81 <strtol+0xb8>
+  802c79:	0f be c0             	movsbl %al,%eax
+  802c7c:	83 e8 57             	sub    $0x57,%eax
+  802c7f:	eb d3                	jmp    802c54 <strtol+0x8b>
+  802c81:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802c84:	89 f3                	mov    %esi,%ebx
+  802c86:	80 fb 19             	cmp    $0x19,%bl
+  802c89:	77 08                	ja     802c93 <strtol+0xca>
+  802c8b:	0f be c0             	movsbl %al,%eax
+  802c8e:	83 e8 37             	sub    $0x37,%eax
+  802c91:	eb c1                	jmp    802c54 <strtol+0x8b>
+  802c93:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802c97:	74 05                	je     802c9e <strtol+0xd5>
+  802c99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c9c:	89 10                	mov    %edx,(%eax)
+  802c9e:	89 c8                	mov    %ecx,%eax
+  802ca0:	f7 d8                	neg    %eax
+  802ca2:	85 ff                	test   %edi,%edi
+  802ca4:	0f 45 c8             	cmovne %eax,%ecx
+  802ca7:	89 c8                	mov    %ecx,%eax
+  802ca9:	5b                   	pop    %ebx
+  802caa:	5e                   	pop    %esi
+  802cab:	5f                   	pop    %edi
+  802cac:	5d                   	pop    %ebp
+  802cad:	c3                   	ret
+
+00802cae <ipc_recv>:
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	56                   	push   %esi
+  802cb2:	53                   	push   %ebx
+  802cb3:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cb6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802cc3:	0f 44 c2             	cmove  %edx,%eax
+  802cc6:	83 ec 0c             	sub    $0xc,%esp
+  802cc9:	50                   	push   %eax
+  802cca:	e8 73 d7 ff ff       	call   800442 <sys_ipc_recv>
+  802ccf:	83 c4 10             	add    $0x10,%esp
+  802cd2:	85 c0                	test   %eax,%eax
+  802cd4:	78 2a                	js     802d00 <ipc_recv+0x52>
+  802cd6:	a1 10 50 80 00       	mov    0x805010,%eax
+  802cdb:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802ce1:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802ce7:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ced:	85 f6                	test   %esi,%esi
+  802cef:	74 02                	je     802cf3 <ipc_recv+0x45>
+  802cf1:	89 0e                	mov    %ecx,(%esi)
+  802cf3:	85 db                	test   %ebx,%ebx
+  802cf5:	74 02                	je     802cf9 <ipc_recv+0x4b>
+  802cf7:	89 13                	mov    %edx,(%ebx)
+  802cf9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cfc:	5b                   	pop    %ebx
+  802cfd:	5e                   	pop    %esi
+  802cfe:	5d                   	pop    %ebp
+  802cff:	c3                   	ret
+  802d00:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d0a:	eb e1                	jmp    802ced <ipc_recv+0x3f>
+
+00802d0c <ipc_send>:
+  802d0c:	55                   	push   %ebp
+  802d0d:	89 e5                	mov    %esp,%ebp
+  802d0f:	57                   	push   %edi
+  802d10:	56                   	push   %esi
+  802d11:	53                   	push   %ebx
+  802d12:	83 ec 0c             	sub    $0xc,%esp
+  802d15:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d1b:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d1e:	85 db                	test   %ebx,%ebx
+  802d20:	74 1e                	je     802d40 <ipc_send+0x34>
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	57                   	push   %edi
+  802d25:	ff 75 08             	push   0x8(%ebp)
+  802d28:	e8 a2 d7 ff ff       	call   8004cf <sys_ipc_send>
+  802d2d:	83 c4 10             	add    $0x10,%esp
+  802d30:	85 c0                	test   %eax,%eax
+  802d32:	74 2a                	je     802d5e <ipc_send+0x52>
+  802d34:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d37:	75 13                	jne    802d4c <ipc_send+0x40>
+  802d39:	e8 0e d4 ff ff       	call   80014c <sys_yield>
+  802d3e:	eb e2                	jmp    802d22 <ipc_send+0x16>
+  802d40:	be 00 00 00 00       	mov    $0x0,%esi
+  802d45:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802d4a:	eb d6                	jmp    802d22 <ipc_send+0x16>
+  802d4c:	50                   	push   %eax
+  802d4d:	68 0c 36 80 00       	push   $0x80360c
+  802d52:	6a 4f                	push   $0x4f
+  802d54:	68 4f 36 80 00       	push   $0x80364f
+  802d59:	e8 06 f4 ff ff       	call   802164 <_panic>
+  802d5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d61:	5b                   	pop    %ebx
+  802d62:	5e                   	pop    %esi
+  802d63:	5f                   	pop    %edi
+  802d64:	5d                   	pop    %ebp
+  802d65:	c3                   	ret
+
+00802d66 <ipc_call>:
+  802d66:	55                   	push   %ebp
+  802d67:	89 e5                	mov    %esp,%ebp
+  802d69:	57                   	push   %edi
+  802d6a:	56                   	push   %esi
+  802d6b:	53                   	push   %ebx
+  802d6c:	83 ec 0c             	sub    $0xc,%esp
+  802d6f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d73:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802d78:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802d7c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802d80:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802d85:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802d89:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d92:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802d96:	eb 05                	jmp    802d9d <ipc_call+0x37>
+  802d98:	e8 af d3 ff ff       	call   80014c <sys_yield>
+  802d9d:	83 ec 0c             	sub    $0xc,%esp
+  802da0:	56                   	push   %esi
+  802da1:	53                   	push   %ebx
+  802da2:	57                   	push   %edi
+  802da3:	ff 75 0c             	push   0xc(%ebp)
+  802da6:	ff 75 08             	push   0x8(%ebp)
+  802da9:	e8 71 d7 ff ff       	call   80051f <sys_ipc_call>
+  802dae:	83 c4 20             	add    $0x20,%esp
+  802db1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802db4:	74 e2                	je     802d98 <ipc_call+0x32>
+  802db6:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802db9:	74 2d                	je     802de8 <ipc_call+0x82>
+  802dbb:	85 c0                	test   %eax,%eax
+  802dbd:	78 4f                	js     802e0e <ipc_call+0xa8>
+  802dbf:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802dc3:	74 10                	je     802dd5 <ipc_call+0x6f>
+  802dc5:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dca:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802dd0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802dd3:	89 02                	mov    %eax,(%edx)
+  802dd5:	a1 10 50 80 00       	mov    0x805010,%eax
+  802dda:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de3:	5b                   	pop    %ebx
+  802de4:	5e                   	pop    %esi
+  802de5:	5f                   	pop    %edi
+  802de6:	5d                   	pop    %ebp
+  802de7:	c3                   	ret
+  802de8:	ff 75 14             	push   0x14(%ebp)
+  802deb:	ff 75 10             	push   0x10(%ebp)
+  802dee:	ff 75 0c             	push   0xc(%ebp)
+  802df1:	ff 75 08             	push   0x8(%ebp)
+  802df4:	e8 13 ff ff ff       	call   802d0c <ipc_send>
+  802df9:	83 c4 0c             	add    $0xc,%esp
+  802dfc:	ff 75 1c             	push   0x1c(%ebp)
+  802dff:	ff 75 18             	push   0x18(%ebp)
+  802e02:	6a 00                	push   $0x0
+  802e04:	e8 a5 fe ff ff       	call   802cae <ipc_recv>
+  802e09:	83 c4 10             	add    $0x10,%esp
+  802e0c:	eb d2                	jmp    802de0 <ipc_call+0x7a>
+  802e0e:	50                   	push   %eax
+  802e0f:	68 59 36 80 00       	push   $0x803659
+  802e14:	6a 6d                	push   $0x6d
+  802e16:	68 4f 36 80 00       	push   $0x80364f
+  802e1b:	e8 44 f3 ff ff       	call   802164 <_panic>
+
+00802e20 <ipc_reply_recv>:
+  802e20:	55                   	push   %ebp
+  802e21:	89 e5                	mov    %esp,%ebp
+  802e23:	57                   	push   %edi
+  802e24:	56                   	push   %esi
+  802e25:	53                   	push   %ebx
+  802e26:	83 ec 0c             	sub    $0xc,%esp
+  802e29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e2c:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e2f:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e32:	85 db                	test   %ebx,%ebx
+  802e34:	0f 84 ac 00 00 00    	je     802ee6 <ipc_reply_recv+0xc6>
+  802e3a:	85 f6                	test   %esi,%esi
+  802e3c:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802e41:	0f 45 c6             	cmovne %esi,%eax
+  802e44:	83 ec 0c             	sub    $0xc,%esp
+  802e47:	50                   	push   %eax
+  802e48:	ff 75 14             	push   0x14(%ebp)
+  802e4b:	53                   	push   %ebx
+  802e4c:	ff 75 0c             	push   0xc(%ebp)
+  802e4f:	ff 75 08             	push   0x8(%ebp)
+  802e52:	e8 e9 d6 ff ff       	call   800540 <sys_ipc_reply_recv>
+  802e57:	83 c4 20             	add    $0x20,%esp
+  802e5a:	85 c0                	test   %eax,%eax
+  802e5c:	78 3a                	js     802e98 <ipc_reply_recv+0x78>
+  802e5e:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e62:	74 10                	je     802e74 <ipc_reply_recv+0x54>
+  802e64:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e69:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802e6f:	8b 55 18             	mov    0x18(%ebp),%edx
+  802e72:	89 02                	mov    %eax,(%edx)
+  802e74:	85 ff                	test   %edi,%edi
+  802e76:	74 0d                	je     802e85 <ipc_reply_recv+0x65>
+  802e78:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e7d:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e83:	89 07                	mov    %eax,(%edi)
+  802e85:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e8a:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e93:	5b                   	pop    %ebx
+  802e94:	5e                   	pop    %esi
+  802e95:	5f                   	pop    %edi
+  802e96:	5d                   	pop    %ebp
+  802e97:	c3                   	ret
+  802e98:	ff 75 14             	push   0x14(%ebp)
+  802e9b:	53                   	push   %ebx
+  802e9c:	ff 75 0c             	push   0xc(%ebp)
+  802e9f:	ff 75 08             	push   0x8(%ebp)
+  802ea2:	e8 4b d5 ff ff       	call   8003f2 <sys_ipc_try_send>
+  802ea7:	89 c2                	mov    %eax,%edx
+  802ea9:	c1 ea 1f             	shr    $0x1f,%edx
+  802eac:	83 c4 10             	add    $0x10,%esp
+  802eaf:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802eb2:	0f 95 c1             	setne  %cl
+  802eb5:	84 d1                	test   %dl,%cl
+  802eb7:	74 05                	je     802ebe <ipc_reply_recv+0x9e>
+  802eb9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ebc:	75 12                	jne    802ed0 <ipc_reply_recv+0xb0>
+  802ebe:	83 ec 04             	sub    $0x4,%esp
+  802ec1:	57                   	push   %edi
+  802ec2:	56                   	push   %esi
+  802ec3:	ff 75 18             	push   0x18(%ebp)
+  802ec6:	e8 e3 fd ff ff       	call   802cae <ipc_recv>
+  802ecb:	83 c4 10             	add    $0x10,%esp
+  802ece:	eb c0                	jmp    802e90 <ipc_reply_recv+0x70>
+  802ed0:	83 ec 04             	sub    $0x4,%esp
+  802ed3:	50                   	push   %eax
+  802ed4:	ff 75 08             	push   0x8(%ebp)
+  802ed7:	68 2c 36 80 00       	push   $0x80362c
+  802edc:	e8 5e f3 ff ff       	call   80223f <cprintf>
+  802ee1:	83 c4 10             	add    $0x10,%esp
+  802ee4:	eb d8                	jmp    802ebe <ipc_reply_recv+0x9e>
+  802ee6:	85 f6                	test   %esi,%esi
+  802ee8:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802eed:	0f 45 c6             	cmovne %esi,%eax
+  802ef0:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802ef5:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802efc:	e9 43 ff ff ff       	jmp    802e44 <ipc_reply_recv+0x24>
+
+00802f01 <ipc_find_env>:
+  802f01:	55                   	push   %ebp
+  802f02:	89 e5                	mov    %esp,%ebp
+  802f04:	83 ec 14             	sub    $0x14,%esp
+  802f07:	ff 75 08             	push   0x8(%ebp)
+  802f0a:	e8 81 d4 ff ff       	call   800390 <sys_env_service>
+  802f0f:	85 c0                	test   %eax,%eax
+  802f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f16:	0f 48 c2             	cmovs  %edx,%eax
+  802f19:	c9                   	leave
+  802f1a:	c3                   	ret
+
+00802f1b <pageref>:
+  802f1b:	55                   	push   %ebp
+  802f1c:	89 e5                	mov    %esp,%ebp
+  802f1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f21:	89 c2                	mov    %eax,%edx
+  802f23:	c1 ea 16             	shr    $0x16,%edx
+  802f26:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f32:	f6 c1 01             	test   $0x1,%cl
+  802f35:	74 22                	je     802f59 <pageref+0x3e>
+  802f37:	c1 e8 0c             	shr    $0xc,%eax
+  802f3a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f41:	a8 01                	test   $0x1,%al
+  802f43:	74 14                	je     802f59 <pageref+0x3e>
+  802f45:	c1 e8 0c             	shr    $0xc,%eax
+  802f48:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802f4b:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802f52:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802f56:	0f b7 d2             	movzwl %dx,%edx
+  802f59:	89 d0                	mov    %edx,%eax
+  802f5b:	5d                   	pop    %ebp
+  802f5c:	c3                   	ret
+
+00802f5d <__udivmoddi4>:
+  802f5d:	55                   	push   %ebp
+  802f5e:	57                   	push   %edi
+  802f5f:	56                   	push   %esi
+  802f60:	53                   	push   %ebx
+  802f61:	83 ec 24             	sub    $0x24,%esp
+  802f64:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f68:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f6c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802f70:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802f74:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802f78:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802f7c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802f80:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802f84:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f92:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f97:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802f9e:	00 
+  802f9f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802fa6:	00 
+  802fa7:	89 fb                	mov    %edi,%ebx
+  802fa9:	eb 08                	jmp    802fb3 <__udivmoddi4+0x56>
+  802fab:	83 e9 01             	sub    $0x1,%ecx
+  802fae:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802fb1:	74 68                	je     80301b <__udivmoddi4+0xbe>
+  802fb3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802fb7:	01 c0                	add    %eax,%eax
+  802fb9:	89 c6                	mov    %eax,%esi
+  802fbb:	89 d7                	mov    %edx,%edi
+  802fbd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fc1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fc5:	0f ad d0             	shrd   %cl,%edx,%eax
+  802fc8:	d3 ea                	shr    %cl,%edx
+  802fca:	f6 c1 20             	test   $0x20,%cl
+  802fcd:	74 04                	je     802fd3 <__udivmoddi4+0x76>
+  802fcf:	89 d0                	mov    %edx,%eax
+  802fd1:	31 d2                	xor    %edx,%edx
+  802fd3:	83 e0 01             	and    $0x1,%eax
+  802fd6:	89 04 24             	mov    %eax,(%esp)
+  802fd9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802fe0:	00 
+  802fe1:	8b 04 24             	mov    (%esp),%eax
+  802fe4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802fe8:	09 f0                	or     %esi,%eax
+  802fea:	09 fa                	or     %edi,%edx
+  802fec:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802ff0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802ff4:	39 f0                	cmp    %esi,%eax
+  802ff6:	89 d5                	mov    %edx,%ebp
+  802ff8:	19 fd                	sbb    %edi,%ebp
+  802ffa:	72 af                	jb     802fab <__udivmoddi4+0x4e>
+  802ffc:	29 f0                	sub    %esi,%eax
+  802ffe:	19 fa                	sbb    %edi,%edx
+  803000:	89 cf                	mov    %ecx,%edi
+  803002:	c1 ef 05             	shr    $0x5,%edi
+  803005:	83 e7 01             	and    $0x1,%edi
+  803008:	89 fe                	mov    %edi,%esi
+  80300a:	83 f6 01             	xor    $0x1,%esi
+  80300d:	d3 e6                	shl    %cl,%esi
+  80300f:	d3 e7                	shl    %cl,%edi
+  803011:	09 74 24 18          	or     %esi,0x18(%esp)
+  803015:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803019:	eb 90                	jmp    802fab <__udivmoddi4+0x4e>
+  80301b:	85 db                	test   %ebx,%ebx
+  80301d:	74 05                	je     803024 <__udivmoddi4+0xc7>
+  80301f:	89 03                	mov    %eax,(%ebx)
+  803021:	89 53 04             	mov    %edx,0x4(%ebx)
+  803024:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803028:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80302c:	83 c4 24             	add    $0x24,%esp
+  80302f:	5b                   	pop    %ebx
+  803030:	5e                   	pop    %esi
+  803031:	5f                   	pop    %edi
+  803032:	5d                   	pop    %ebp
+  803033:	c3                   	ret
+
+00803034 <__udivdi3>:
+  803034:	83 ec 08             	sub    $0x8,%esp
+  803037:	6a 00                	push   $0x0
+  803039:	ff 74 24 1c          	push   0x1c(%esp)
+  80303d:	ff 74 24 1c          	push   0x1c(%esp)
+  803041:	ff 74 24 1c          	push   0x1c(%esp)
+  803045:	ff 74 24 1c          	push   0x1c(%esp)
+  803049:	e8 0f ff ff ff       	call   802f5d <__udivmoddi4>
+  80304e:	83 c4 1c             	add    $0x1c,%esp
+  803051:	c3                   	ret
+
+00803052 <__umoddi3>:
+  803052:	83 ec 18             	sub    $0x18,%esp
+  803055:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803059:	50                   	push   %eax
+  80305a:	ff 74 24 2c          	push   0x2c(%esp)
+  80305e:	ff 74 24 2c          	push   0x2c(%esp)
+  803062:	ff 74 24 2c          	push   0x2c(%esp)
+  803066:	ff 74 24 2c          	push   0x2c(%esp)
+  80306a:	e8 ee fe ff ff       	call   802f5d <__udivmoddi4>
+  80306f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803073:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803077:	83 c4 2c             	add    $0x2c,%esp
+  80307a:	c3                   	ret
+
+0080307b <__divdi3>:
+  80307b:	53                   	push   %ebx
+  80307c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803080:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803084:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803088:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80308c:	85 d2                	test   %edx,%edx
+  80308e:	78 12                	js     8030a2 <__divdi3+0x27>
+  803090:	85 db                	test   %ebx,%ebx
+  803092:	78 2e                	js     8030c2 <__divdi3+0x47>
+  803094:	53                   	push   %ebx
+  803095:	51                   	push   %ecx
+  803096:	52                   	push   %edx
+  803097:	50                   	push   %eax
+  803098:	e8 97 ff ff ff       	call   803034 <__udivdi3>
+  80309d:	83 c4 10             	add    $0x10,%esp
+  8030a0:	eb 1e                	jmp    8030c0 <__divdi3+0x45>
+  8030a2:	f7 d8                	neg    %eax
+  8030a4:	83 d2 00             	adc    $0x0,%edx
+  8030a7:	f7 da                	neg    %edx
+  8030a9:	85 db                	test   %ebx,%ebx
+  8030ab:	78 2a                	js     8030d7 <__divdi3+0x5c>
+  8030ad:	53                   	push   %ebx
+  8030ae:	51                   	push   %ecx
+  8030af:	52                   	push   %edx
+  8030b0:	50                   	push   %eax
+  8030b1:	e8 7e ff ff ff       	call   803034 <__udivdi3>
+  8030b6:	83 c4 10             	add    $0x10,%esp
+  8030b9:	f7 d8                	neg    %eax
+  8030bb:	83 d2 00             	adc    $0x0,%edx
+  8030be:	f7 da                	neg    %edx
+  8030c0:	5b                   	pop    %ebx
+  8030c1:	c3                   	ret
+  8030c2:	f7 d9                	neg    %ecx
+  8030c4:	83 d3 00             	adc    $0x0,%ebx
+  8030c7:	f7 db                	neg    %ebx
+  8030c9:	53                   	push   %ebx
+  8030ca:	51                   	push   %ecx
+  8030cb:	52                   	push   %edx
+  8030cc:	50                   	push   %eax
+  8030cd:	e8 62 ff ff ff       	call   803034 <__udivdi3>
+  8030d2:	83 c4 10             	add    $0x10,%esp
+  8030d5:	eb e2                	jmp    8030b9 <__divdi3+0x3e>
+  8030d7:	f7 d9                	neg    %ecx
+  8030d9:	83 d3 00             	adc    $0x0,%ebx
+  8030dc:	f7 db                	neg    %ebx
+  8030de:	53                   	push   %ebx
+  8030df:	51                   	push   %ecx
+  8030e0:	52                   	push   %edx
+  8030e1:	50                   	push   %eax
+  8030e2:	e8 4d ff ff ff       	call   803034 <__udivdi3>
+  8030e7:	83 c4 10             	add    $0x10,%esp
+  8030ea:	eb d4                	jmp    8030c0 <__divdi3+0x45>
+
+008030ec <__moddi3>:
+  8030ec:	55                   	push   %ebp
+  8030ed:	57                   	push   %edi
+  8030ee:	56                   	push   %esi
+  8030ef:	53                   	push   %ebx
+  8030f0:	83 ec 0c             	sub    $0xc,%esp
+  8030f3:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8030f7:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8030fb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030ff:	89 e9                	mov    %ebp,%ecx
+  803101:	f7 d9                	neg    %ecx
+  803103:	89 d0                	mov    %edx,%eax
+  803105:	83 d0 00             	adc    $0x0,%eax
+  803108:	f7 d8                	neg    %eax
+  80310a:	0f 49 e9             	cmovns %ecx,%ebp
+  80310d:	0f 49 d0             	cmovns %eax,%edx
+  803110:	52                   	push   %edx
+  803111:	55                   	push   %ebp
+  803112:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803116:	f7 da                	neg    %edx
+  803118:	89 d8                	mov    %ebx,%eax
+  80311a:	83 d0 00             	adc    $0x0,%eax
+  80311d:	f7 d8                	neg    %eax
+  80311f:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803124:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803128:	0f 48 c3             	cmovs  %ebx,%eax
+  80312b:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80312f:	ff 74 24 0c          	push   0xc(%esp)
+  803133:	ff 74 24 0c          	push   0xc(%esp)
+  803137:	e8 16 ff ff ff       	call   803052 <__umoddi3>
+  80313c:	83 c4 10             	add    $0x10,%esp
+  80313f:	85 db                	test   %ebx,%ebx
+  803141:	78 08                	js     80314b <__moddi3+0x5f>
+  803143:	83 c4 0c             	add    $0xc,%esp
+  803146:	5b                   	pop    %ebx
+  803147:	5e                   	pop    %esi
+  803148:	5f                   	pop    %edi
+  803149:	5d                   	pop    %ebp
+  80314a:	c3                   	ret
+  80314b:	f7 d8                	neg    %eax
+  80314d:	83 d2 00             	adc    $0x0,%edx
+  803150:	f7 da                	neg    %edx
+  803152:	eb ef                	jmp    803143 <__moddi3+0x57>
@@ -0,0 +1,5526 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+  80003a:	68 c0 37 80 00       	push   $0x8037c0
+  80003f:	e8 7f 01 00 00       	call   8001c3 <cprintf>
+  800044:	e8 1f 17 00 00       	call   801768 <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 38 38 80 00       	push   $0x803838
+  800058:	e8 66 01 00 00       	call   8001c3 <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 e8 37 80 00       	push   $0x8037e8
+  80006c:	e8 52 01 00 00       	call   8001c3 <cprintf>
+  800071:	e8 59 0c 00 00       	call   800ccf <sys_yield>
+  800076:	e8 54 0c 00 00       	call   800ccf <sys_yield>
+  80007b:	e8 4f 0c 00 00       	call   800ccf <sys_yield>
+  800080:	e8 4a 0c 00 00       	call   800ccf <sys_yield>
+  800085:	e8 45 0c 00 00       	call   800ccf <sys_yield>
+  80008a:	e8 40 0c 00 00       	call   800ccf <sys_yield>
+  80008f:	e8 3b 0c 00 00       	call   800ccf <sys_yield>
+  800094:	e8 36 0c 00 00       	call   800ccf <sys_yield>
+  800099:	c7 04 24 10 38 80 00 	movl   $0x803810,(%esp)
+  8000a0:	e8 1e 01 00 00       	call   8001c3 <cprintf>
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 c2 0b 00 00       	call   800c6f <sys_env_destroy>
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000c0:	e8 eb 0b 00 00       	call   800cb0 <sys_getenvid>
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 14 50 80 00       	mov    %eax,0x805014
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 44 ff ff ff       	call   800033 <umain>
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+  800104:	a1 14 50 80 00       	mov    0x805014,%eax
+  800109:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	75 14                	jne    800127 <exit+0x29>
+  800113:	e8 6b 1b 00 00       	call   801c83 <close_all>
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	6a 00                	push   $0x0
+  80011d:	e8 4d 0b 00 00       	call   800c6f <sys_env_destroy>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	c9                   	leave
+  800126:	c3                   	ret
+  800127:	e8 b0 12 00 00       	call   8013dc <sys_lease_complete>
+  80012c:	eb e5                	jmp    800113 <exit+0x15>
+
+0080012e <putch>:
+  80012e:	55                   	push   %ebp
+  80012f:	89 e5                	mov    %esp,%ebp
+  800131:	53                   	push   %ebx
+  800132:	83 ec 04             	sub    $0x4,%esp
+  800135:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800138:	8b 13                	mov    (%ebx),%edx
+  80013a:	8d 42 01             	lea    0x1(%edx),%eax
+  80013d:	89 03                	mov    %eax,(%ebx)
+  80013f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800142:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800146:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80014b:	74 09                	je     800156 <putch+0x28>
+  80014d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+  800156:	83 ec 08             	sub    $0x8,%esp
+  800159:	68 ff 00 00 00       	push   $0xff
+  80015e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800161:	50                   	push   %eax
+  800162:	e8 cb 0a 00 00       	call   800c32 <sys_cputs>
+  800167:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	eb db                	jmp    80014d <putch+0x1f>
+
+00800172 <vcprintf>:
+  800172:	55                   	push   %ebp
+  800173:	89 e5                	mov    %esp,%ebp
+  800175:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80017b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800182:	00 00 00 
+  800185:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80018c:	00 00 00 
+  80018f:	ff 75 0c             	push   0xc(%ebp)
+  800192:	ff 75 08             	push   0x8(%ebp)
+  800195:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80019b:	50                   	push   %eax
+  80019c:	68 2e 01 80 00       	push   $0x80012e
+  8001a1:	e8 1c 01 00 00       	call   8002c2 <vprintfmt>
+  8001a6:	83 c4 08             	add    $0x8,%esp
+  8001a9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001af:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001b5:	50                   	push   %eax
+  8001b6:	e8 77 0a 00 00       	call   800c32 <sys_cputs>
+  8001bb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+
+008001c3 <cprintf>:
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	83 ec 10             	sub    $0x10,%esp
+  8001c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001cc:	50                   	push   %eax
+  8001cd:	ff 75 08             	push   0x8(%ebp)
+  8001d0:	e8 9d ff ff ff       	call   800172 <vcprintf>
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+
+008001d7 <printnum>:
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  8001e0:	89 c3                	mov    %eax,%ebx
+  8001e2:	89 d6                	mov    %edx,%esi
+  8001e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ea:	89 d1                	mov    %edx,%ecx
+  8001ec:	89 c2                	mov    %eax,%edx
+  8001ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001fa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800201:	39 c2                	cmp    %eax,%edx
+  800203:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800206:	73 4b                	jae    800253 <printnum+0x7c>
+  800208:	8b 45 14             	mov    0x14(%ebp),%eax
+  80020b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80020e:	85 ff                	test   %edi,%edi
+  800210:	7e 11                	jle    800223 <printnum+0x4c>
+  800212:	83 ec 08             	sub    $0x8,%esp
+  800215:	56                   	push   %esi
+  800216:	ff 75 18             	push   0x18(%ebp)
+  800219:	ff d3                	call   *%ebx
+  80021b:	83 c4 10             	add    $0x10,%esp
+  80021e:	83 ef 01             	sub    $0x1,%edi
+  800221:	75 ef                	jne    800212 <printnum+0x3b>
+  800223:	83 ec 08             	sub    $0x8,%esp
+  800226:	56                   	push   %esi
+  800227:	83 ec 04             	sub    $0x4,%esp
+  80022a:	ff 75 e4             	push   -0x1c(%ebp)
+  80022d:	ff 75 e0             	push   -0x20(%ebp)
+  800230:	ff 75 dc             	push   -0x24(%ebp)
+  800233:	ff 75 d8             	push   -0x28(%ebp)
+  800236:	e8 6a 34 00 00       	call   8036a5 <__umoddi3>
+  80023b:	83 c4 14             	add    $0x14,%esp
+  80023e:	0f be 80 60 38 80 00 	movsbl 0x803860(%eax),%eax
+  800245:	50                   	push   %eax
+  800246:	ff d3                	call   *%ebx
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024e:	5b                   	pop    %ebx
+  80024f:	5e                   	pop    %esi
+  800250:	5f                   	pop    %edi
+  800251:	5d                   	pop    %ebp
+  800252:	c3                   	ret
+  800253:	83 ec 0c             	sub    $0xc,%esp
+  800256:	ff 75 18             	push   0x18(%ebp)
+  800259:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80025c:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80025f:	52                   	push   %edx
+  800260:	50                   	push   %eax
+  800261:	83 ec 08             	sub    $0x8,%esp
+  800264:	ff 75 e4             	push   -0x1c(%ebp)
+  800267:	ff 75 e0             	push   -0x20(%ebp)
+  80026a:	ff 75 dc             	push   -0x24(%ebp)
+  80026d:	ff 75 d8             	push   -0x28(%ebp)
+  800270:	e8 12 34 00 00       	call   803687 <__udivdi3>
+  800275:	83 c4 18             	add    $0x18,%esp
+  800278:	52                   	push   %edx
+  800279:	50                   	push   %eax
+  80027a:	89 f2                	mov    %esi,%edx
+  80027c:	89 d8                	mov    %ebx,%eax
+  80027e:	e8 54 ff ff ff       	call   8001d7 <printnum>
+  800283:	83 c4 20             	add    $0x20,%esp
+  800286:	eb 9b                	jmp    800223 <printnum+0x4c>
+
+00800288 <sprintputch>:
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80028e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800292:	8b 10                	mov    (%eax),%edx
+  800294:	3b 50 04             	cmp    0x4(%eax),%edx
+  800297:	73 0a                	jae    8002a3 <sprintputch+0x1b>
+  800299:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80029c:	89 08                	mov    %ecx,(%eax)
+  80029e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a1:	88 02                	mov    %al,(%edx)
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+
+008002a5 <printfmt>:
+  8002a5:	55                   	push   %ebp
+  8002a6:	89 e5                	mov    %esp,%ebp
+  8002a8:	83 ec 08             	sub    $0x8,%esp
+  8002ab:	8d 45 14             	lea    0x14(%ebp),%eax
+  8002ae:	50                   	push   %eax
+  8002af:	ff 75 10             	push   0x10(%ebp)
+  8002b2:	ff 75 0c             	push   0xc(%ebp)
+  8002b5:	ff 75 08             	push   0x8(%ebp)
+  8002b8:	e8 05 00 00 00       	call   8002c2 <vprintfmt>
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	c9                   	leave
+  8002c1:	c3                   	ret
+
+008002c2 <vprintfmt>:
+  8002c2:	55                   	push   %ebp
+  8002c3:	89 e5                	mov    %esp,%ebp
+  8002c5:	57                   	push   %edi
+  8002c6:	56                   	push   %esi
+  8002c7:	53                   	push   %ebx
+  8002c8:	83 ec 2c             	sub    $0x2c,%esp
+  8002cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002ce:	89 df                	mov    %ebx,%edi
+  8002d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002d6:	8d 70 01             	lea    0x1(%eax),%esi
+  8002d9:	0f b6 00             	movzbl (%eax),%eax
+  8002dc:	83 f8 25             	cmp    $0x25,%eax
+  8002df:	74 1e                	je     8002ff <vprintfmt+0x3d>
+  8002e1:	85 c0                	test   %eax,%eax
+  8002e3:	0f 84 15 05 00 00    	je     8007fe <vprintfmt+0x53c>
+  8002e9:	83 ec 08             	sub    $0x8,%esp
+  8002ec:	53                   	push   %ebx
+  8002ed:	50                   	push   %eax
+  8002ee:	ff d7                	call   *%edi
+  8002f0:	83 c6 01             	add    $0x1,%esi
+  8002f3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002f7:	83 c4 10             	add    $0x10,%esp
+  8002fa:	83 f8 25             	cmp    $0x25,%eax
+  8002fd:	75 e2                	jne    8002e1 <vprintfmt+0x1f>
+  8002ff:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800303:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80030a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800311:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800318:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80031d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800320:	8d 56 01             	lea    0x1(%esi),%edx
+  800323:	0f b6 0e             	movzbl (%esi),%ecx
+  800326:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800329:	3c 55                	cmp    $0x55,%al
+  80032b:	0f 87 3b 04 00 00    	ja     80076c <vprintfmt+0x4aa>
+  800331:	0f b6 c0             	movzbl %al,%eax
+  800334:	ff 24 85 a0 39 80 00 	jmp    *0x8039a0(,%eax,4)
+  80033b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80033e:	eb 93                	jmp    8002d3 <vprintfmt+0x11>
+  800340:	89 d6                	mov    %edx,%esi
+  800342:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800346:	eb d8                	jmp    800320 <vprintfmt+0x5e>
+  800348:	89 d6                	mov    %edx,%esi
+  80034a:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80034e:	eb d0                	jmp    800320 <vprintfmt+0x5e>
+  800350:	0f b6 c9             	movzbl %cl,%ecx
+  800353:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800356:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800359:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80035d:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800360:	83 f9 09             	cmp    $0x9,%ecx
+  800363:	77 6f                	ja     8003d4 <vprintfmt+0x112>
+  800365:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800368:	83 c2 01             	add    $0x1,%edx
+  80036b:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80036e:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800372:	0f be 02             	movsbl (%edx),%eax
+  800375:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800378:	83 fe 09             	cmp    $0x9,%esi
+  80037b:	76 eb                	jbe    800368 <vprintfmt+0xa6>
+  80037d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800380:	89 d6                	mov    %edx,%esi
+  800382:	eb 13                	jmp    800397 <vprintfmt+0xd5>
+  800384:	8b 45 14             	mov    0x14(%ebp),%eax
+  800387:	8b 00                	mov    (%eax),%eax
+  800389:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80038c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80038f:	8d 40 04             	lea    0x4(%eax),%eax
+  800392:	89 45 14             	mov    %eax,0x14(%ebp)
+  800395:	89 d6                	mov    %edx,%esi
+  800397:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80039b:	79 83                	jns    800320 <vprintfmt+0x5e>
+  80039d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003a3:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003aa:	e9 71 ff ff ff       	jmp    800320 <vprintfmt+0x5e>
+  8003af:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003b2:	85 c9                	test   %ecx,%ecx
+  8003b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b9:	0f 49 c1             	cmovns %ecx,%eax
+  8003bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003bf:	89 d6                	mov    %edx,%esi
+  8003c1:	e9 5a ff ff ff       	jmp    800320 <vprintfmt+0x5e>
+  8003c6:	89 d6                	mov    %edx,%esi
+  8003c8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003cf:	e9 4c ff ff ff       	jmp    800320 <vprintfmt+0x5e>
+  8003d4:	89 d6                	mov    %edx,%esi
+  8003d6:	eb bf                	jmp    800397 <vprintfmt+0xd5>
+  8003d8:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8003dc:	89 d6                	mov    %edx,%esi
+  8003de:	e9 3d ff ff ff       	jmp    800320 <vprintfmt+0x5e>
+  8003e3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e9:	8d 70 04             	lea    0x4(%eax),%esi
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	53                   	push   %ebx
+  8003f0:	ff 30                	push   (%eax)
+  8003f2:	ff d7                	call   *%edi
+  8003f4:	83 c4 10             	add    $0x10,%esp
+  8003f7:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003fa:	e9 d4 fe ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  8003ff:	89 55 10             	mov    %edx,0x10(%ebp)
+  800402:	8b 45 14             	mov    0x14(%ebp),%eax
+  800405:	8d 70 04             	lea    0x4(%eax),%esi
+  800408:	8b 10                	mov    (%eax),%edx
+  80040a:	89 d0                	mov    %edx,%eax
+  80040c:	f7 d8                	neg    %eax
+  80040e:	0f 48 c2             	cmovs  %edx,%eax
+  800411:	83 f8 12             	cmp    $0x12,%eax
+  800414:	7f 23                	jg     800439 <vprintfmt+0x177>
+  800416:	8b 14 85 00 3b 80 00 	mov    0x803b00(,%eax,4),%edx
+  80041d:	85 d2                	test   %edx,%edx
+  80041f:	74 18                	je     800439 <vprintfmt+0x177>
+  800421:	52                   	push   %edx
+  800422:	68 43 3d 80 00       	push   $0x803d43
+  800427:	53                   	push   %ebx
+  800428:	57                   	push   %edi
+  800429:	e8 77 fe ff ff       	call   8002a5 <printfmt>
+  80042e:	83 c4 10             	add    $0x10,%esp
+  800431:	89 75 14             	mov    %esi,0x14(%ebp)
+  800434:	e9 9a fe ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  800439:	50                   	push   %eax
+  80043a:	68 78 38 80 00       	push   $0x803878
+  80043f:	53                   	push   %ebx
+  800440:	57                   	push   %edi
+  800441:	e8 5f fe ff ff       	call   8002a5 <printfmt>
+  800446:	83 c4 10             	add    $0x10,%esp
+  800449:	89 75 14             	mov    %esi,0x14(%ebp)
+  80044c:	e9 82 fe ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  800451:	89 55 10             	mov    %edx,0x10(%ebp)
+  800454:	8b 45 14             	mov    0x14(%ebp),%eax
+  800457:	83 c0 04             	add    $0x4,%eax
+  80045a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80045d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800460:	8b 00                	mov    (%eax),%eax
+  800462:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800465:	85 c0                	test   %eax,%eax
+  800467:	0f 84 61 03 00 00    	je     8007ce <vprintfmt+0x50c>
+  80046d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800471:	7e 06                	jle    800479 <vprintfmt+0x1b7>
+  800473:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800477:	75 29                	jne    8004a2 <vprintfmt+0x1e0>
+  800479:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80047c:	8d 70 01             	lea    0x1(%eax),%esi
+  80047f:	0f b6 00             	movzbl (%eax),%eax
+  800482:	0f be d0             	movsbl %al,%edx
+  800485:	85 d2                	test   %edx,%edx
+  800487:	0f 84 bb 00 00 00    	je     800548 <vprintfmt+0x286>
+  80048d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800490:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800493:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800496:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800499:	eb 7a                	jmp    800515 <vprintfmt+0x253>
+  80049b:	c7 45 d0 71 38 80 00 	movl   $0x803871,-0x30(%ebp)
+  8004a2:	83 ec 08             	sub    $0x8,%esp
+  8004a5:	ff 75 d4             	push   -0x2c(%ebp)
+  8004a8:	ff 75 d0             	push   -0x30(%ebp)
+  8004ab:	e8 e0 03 00 00       	call   800890 <strnlen>
+  8004b0:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004b3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004b6:	83 c4 10             	add    $0x10,%esp
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	0f 8e d6 02 00 00    	jle    800797 <vprintfmt+0x4d5>
+  8004c1:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004c5:	83 ec 08             	sub    $0x8,%esp
+  8004c8:	53                   	push   %ebx
+  8004c9:	56                   	push   %esi
+  8004ca:	ff d7                	call   *%edi
+  8004cc:	83 c4 10             	add    $0x10,%esp
+  8004cf:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004d3:	75 f0                	jne    8004c5 <vprintfmt+0x203>
+  8004d5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004d8:	8d 70 01             	lea    0x1(%eax),%esi
+  8004db:	0f b6 00             	movzbl (%eax),%eax
+  8004de:	0f be d0             	movsbl %al,%edx
+  8004e1:	85 d2                	test   %edx,%edx
+  8004e3:	0f 84 da 02 00 00    	je     8007c3 <vprintfmt+0x501>
+  8004e9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004ec:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004ef:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004f2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004f5:	eb 1e                	jmp    800515 <vprintfmt+0x253>
+  8004f7:	83 ec 08             	sub    $0x8,%esp
+  8004fa:	ff 75 0c             	push   0xc(%ebp)
+  8004fd:	52                   	push   %edx
+  8004fe:	ff 55 08             	call   *0x8(%ebp)
+  800501:	83 c4 10             	add    $0x10,%esp
+  800504:	83 eb 01             	sub    $0x1,%ebx
+  800507:	83 c6 01             	add    $0x1,%esi
+  80050a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80050e:	0f be d0             	movsbl %al,%edx
+  800511:	85 d2                	test   %edx,%edx
+  800513:	74 2a                	je     80053f <vprintfmt+0x27d>
+  800515:	85 ff                	test   %edi,%edi
+  800517:	78 05                	js     80051e <vprintfmt+0x25c>
+  800519:	83 ef 01             	sub    $0x1,%edi
+  80051c:	78 59                	js     800577 <vprintfmt+0x2b5>
+  80051e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800522:	74 d3                	je     8004f7 <vprintfmt+0x235>
+  800524:	0f be c0             	movsbl %al,%eax
+  800527:	83 e8 20             	sub    $0x20,%eax
+  80052a:	83 f8 5e             	cmp    $0x5e,%eax
+  80052d:	76 c8                	jbe    8004f7 <vprintfmt+0x235>
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	ff 75 0c             	push   0xc(%ebp)
+  800535:	6a 3f                	push   $0x3f
+  800537:	ff 55 08             	call   *0x8(%ebp)
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	eb c5                	jmp    800504 <vprintfmt+0x242>
+  80053f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800542:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800545:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800548:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80054b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80054f:	7e 1b                	jle    80056c <vprintfmt+0x2aa>
+  800551:	83 ec 08             	sub    $0x8,%esp
+  800554:	53                   	push   %ebx
+  800555:	6a 20                	push   $0x20
+  800557:	ff d7                	call   *%edi
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	83 ee 01             	sub    $0x1,%esi
+  80055f:	75 f0                	jne    800551 <vprintfmt+0x28f>
+  800561:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800564:	89 45 14             	mov    %eax,0x14(%ebp)
+  800567:	e9 67 fd ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  80056c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80056f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800572:	e9 5c fd ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  800577:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80057a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80057d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800580:	eb c6                	jmp    800548 <vprintfmt+0x286>
+  800582:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800585:	89 55 10             	mov    %edx,0x10(%ebp)
+  800588:	83 f9 01             	cmp    $0x1,%ecx
+  80058b:	7f 1f                	jg     8005ac <vprintfmt+0x2ea>
+  80058d:	85 c9                	test   %ecx,%ecx
+  80058f:	74 67                	je     8005f8 <vprintfmt+0x336>
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8b 30                	mov    (%eax),%esi
+  800596:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800599:	89 f0                	mov    %esi,%eax
+  80059b:	c1 f8 1f             	sar    $0x1f,%eax
+  80059e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005aa:	eb 17                	jmp    8005c3 <vprintfmt+0x301>
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b2:	8b 00                	mov    (%eax),%eax
+  8005b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005ce:	85 c9                	test   %ecx,%ecx
+  8005d0:	0f 89 12 01 00 00    	jns    8006e8 <vprintfmt+0x426>
+  8005d6:	83 ec 08             	sub    $0x8,%esp
+  8005d9:	53                   	push   %ebx
+  8005da:	6a 2d                	push   $0x2d
+  8005dc:	ff d7                	call   *%edi
+  8005de:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e4:	f7 da                	neg    %edx
+  8005e6:	83 d1 00             	adc    $0x0,%ecx
+  8005e9:	f7 d9                	neg    %ecx
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005f3:	e9 f0 00 00 00       	jmp    8006e8 <vprintfmt+0x426>
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 30                	mov    (%eax),%esi
+  8005fd:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800600:	89 f0                	mov    %esi,%eax
+  800602:	c1 f8 1f             	sar    $0x1f,%eax
+  800605:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8d 40 04             	lea    0x4(%eax),%eax
+  80060e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800611:	eb b0                	jmp    8005c3 <vprintfmt+0x301>
+  800613:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800616:	89 55 10             	mov    %edx,0x10(%ebp)
+  800619:	83 f9 01             	cmp    $0x1,%ecx
+  80061c:	7f 1e                	jg     80063c <vprintfmt+0x37a>
+  80061e:	85 c9                	test   %ecx,%ecx
+  800620:	74 32                	je     800654 <vprintfmt+0x392>
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062c:	8d 40 04             	lea    0x4(%eax),%eax
+  80062f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800632:	be 0a 00 00 00       	mov    $0xa,%esi
+  800637:	e9 ac 00 00 00       	jmp    8006e8 <vprintfmt+0x426>
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 10                	mov    (%eax),%edx
+  800641:	8b 48 04             	mov    0x4(%eax),%ecx
+  800644:	8d 40 08             	lea    0x8(%eax),%eax
+  800647:	89 45 14             	mov    %eax,0x14(%ebp)
+  80064a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80064f:	e9 94 00 00 00       	jmp    8006e8 <vprintfmt+0x426>
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 10                	mov    (%eax),%edx
+  800659:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065e:	8d 40 04             	lea    0x4(%eax),%eax
+  800661:	89 45 14             	mov    %eax,0x14(%ebp)
+  800664:	be 0a 00 00 00       	mov    $0xa,%esi
+  800669:	eb 7d                	jmp    8006e8 <vprintfmt+0x426>
+  80066b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80066e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800671:	83 f9 01             	cmp    $0x1,%ecx
+  800674:	7f 1b                	jg     800691 <vprintfmt+0x3cf>
+  800676:	85 c9                	test   %ecx,%ecx
+  800678:	74 2c                	je     8006a6 <vprintfmt+0x3e4>
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 10                	mov    (%eax),%edx
+  80067f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800684:	8d 40 04             	lea    0x4(%eax),%eax
+  800687:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068a:	be 08 00 00 00       	mov    $0x8,%esi
+  80068f:	eb 57                	jmp    8006e8 <vprintfmt+0x426>
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8b 10                	mov    (%eax),%edx
+  800696:	8b 48 04             	mov    0x4(%eax),%ecx
+  800699:	8d 40 08             	lea    0x8(%eax),%eax
+  80069c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069f:	be 08 00 00 00       	mov    $0x8,%esi
+  8006a4:	eb 42                	jmp    8006e8 <vprintfmt+0x426>
+  8006a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a9:	8b 10                	mov    (%eax),%edx
+  8006ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b6:	be 08 00 00 00       	mov    $0x8,%esi
+  8006bb:	eb 2b                	jmp    8006e8 <vprintfmt+0x426>
+  8006bd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006c0:	83 ec 08             	sub    $0x8,%esp
+  8006c3:	53                   	push   %ebx
+  8006c4:	6a 30                	push   $0x30
+  8006c6:	ff d7                	call   *%edi
+  8006c8:	83 c4 08             	add    $0x8,%esp
+  8006cb:	53                   	push   %ebx
+  8006cc:	6a 78                	push   $0x78
+  8006ce:	ff d7                	call   *%edi
+  8006d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d3:	8b 10                	mov    (%eax),%edx
+  8006d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006da:	83 c4 10             	add    $0x10,%esp
+  8006dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e3:	be 10 00 00 00       	mov    $0x10,%esi
+  8006e8:	83 ec 0c             	sub    $0xc,%esp
+  8006eb:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006ef:	50                   	push   %eax
+  8006f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8006f3:	56                   	push   %esi
+  8006f4:	51                   	push   %ecx
+  8006f5:	52                   	push   %edx
+  8006f6:	89 da                	mov    %ebx,%edx
+  8006f8:	89 f8                	mov    %edi,%eax
+  8006fa:	e8 d8 fa ff ff       	call   8001d7 <printnum>
+  8006ff:	83 c4 20             	add    $0x20,%esp
+  800702:	e9 cc fb ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  800707:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80070a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80070d:	83 f9 01             	cmp    $0x1,%ecx
+  800710:	7f 1b                	jg     80072d <vprintfmt+0x46b>
+  800712:	85 c9                	test   %ecx,%ecx
+  800714:	74 2c                	je     800742 <vprintfmt+0x480>
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 10                	mov    (%eax),%edx
+  80071b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800720:	8d 40 04             	lea    0x4(%eax),%eax
+  800723:	89 45 14             	mov    %eax,0x14(%ebp)
+  800726:	be 10 00 00 00       	mov    $0x10,%esi
+  80072b:	eb bb                	jmp    8006e8 <vprintfmt+0x426>
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8b 10                	mov    (%eax),%edx
+  800732:	8b 48 04             	mov    0x4(%eax),%ecx
+  800735:	8d 40 08             	lea    0x8(%eax),%eax
+  800738:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073b:	be 10 00 00 00       	mov    $0x10,%esi
+  800740:	eb a6                	jmp    8006e8 <vprintfmt+0x426>
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 10                	mov    (%eax),%edx
+  800747:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074c:	8d 40 04             	lea    0x4(%eax),%eax
+  80074f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800752:	be 10 00 00 00       	mov    $0x10,%esi
+  800757:	eb 8f                	jmp    8006e8 <vprintfmt+0x426>
+  800759:	89 55 10             	mov    %edx,0x10(%ebp)
+  80075c:	83 ec 08             	sub    $0x8,%esp
+  80075f:	53                   	push   %ebx
+  800760:	6a 25                	push   $0x25
+  800762:	ff d7                	call   *%edi
+  800764:	83 c4 10             	add    $0x10,%esp
+  800767:	e9 67 fb ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  80076c:	83 ec 08             	sub    $0x8,%esp
+  80076f:	53                   	push   %ebx
+  800770:	6a 25                	push   $0x25
+  800772:	ff d7                	call   *%edi
+  800774:	83 c4 10             	add    $0x10,%esp
+  800777:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80077b:	0f 84 ba fb ff ff    	je     80033b <vprintfmt+0x79>
+  800781:	89 75 10             	mov    %esi,0x10(%ebp)
+  800784:	89 f0                	mov    %esi,%eax
+  800786:	83 e8 01             	sub    $0x1,%eax
+  800789:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80078d:	75 f7                	jne    800786 <vprintfmt+0x4c4>
+  80078f:	89 45 10             	mov    %eax,0x10(%ebp)
+  800792:	e9 3c fb ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  800797:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80079a:	8d 70 01             	lea    0x1(%eax),%esi
+  80079d:	0f b6 00             	movzbl (%eax),%eax
+  8007a0:	0f be d0             	movsbl %al,%edx
+  8007a3:	85 d2                	test   %edx,%edx
+  8007a5:	74 11                	je     8007b8 <vprintfmt+0x4f6>
+  8007a7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007aa:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007ad:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007b0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007b3:	e9 5d fd ff ff       	jmp    800515 <vprintfmt+0x253>
+  8007b8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007be:	e9 10 fb ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  8007c3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c9:	e9 05 fb ff ff       	jmp    8002d3 <vprintfmt+0x11>
+  8007ce:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007d2:	7e 0a                	jle    8007de <vprintfmt+0x51c>
+  8007d4:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007d8:	0f 85 bd fc ff ff    	jne    80049b <vprintfmt+0x1d9>
+  8007de:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007e3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007e8:	be 72 38 80 00       	mov    $0x803872,%esi
+  8007ed:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007f0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007f3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007f6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007f9:	e9 17 fd ff ff       	jmp    800515 <vprintfmt+0x253>
+  8007fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800801:	5b                   	pop    %ebx
+  800802:	5e                   	pop    %esi
+  800803:	5f                   	pop    %edi
+  800804:	5d                   	pop    %ebp
+  800805:	c3                   	ret
+
+00800806 <vsnprintf>:
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	83 ec 18             	sub    $0x18,%esp
+  80080c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800812:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800815:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800819:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80081c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800823:	85 c0                	test   %eax,%eax
+  800825:	74 26                	je     80084d <vsnprintf+0x47>
+  800827:	85 d2                	test   %edx,%edx
+  800829:	7e 22                	jle    80084d <vsnprintf+0x47>
+  80082b:	ff 75 14             	push   0x14(%ebp)
+  80082e:	ff 75 10             	push   0x10(%ebp)
+  800831:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800834:	50                   	push   %eax
+  800835:	68 88 02 80 00       	push   $0x800288
+  80083a:	e8 83 fa ff ff       	call   8002c2 <vprintfmt>
+  80083f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800842:	c6 00 00             	movb   $0x0,(%eax)
+  800845:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800848:	83 c4 10             	add    $0x10,%esp
+  80084b:	c9                   	leave
+  80084c:	c3                   	ret
+  80084d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800852:	eb f7                	jmp    80084b <vsnprintf+0x45>
+
+00800854 <snprintf>:
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	83 ec 08             	sub    $0x8,%esp
+  80085a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80085d:	50                   	push   %eax
+  80085e:	ff 75 10             	push   0x10(%ebp)
+  800861:	ff 75 0c             	push   0xc(%ebp)
+  800864:	ff 75 08             	push   0x8(%ebp)
+  800867:	e8 9a ff ff ff       	call   800806 <vsnprintf>
+  80086c:	c9                   	leave
+  80086d:	c3                   	ret
+
+0080086e <strlen>:
+  80086e:	55                   	push   %ebp
+  80086f:	89 e5                	mov    %esp,%ebp
+  800871:	8b 55 08             	mov    0x8(%ebp),%edx
+  800874:	80 3a 00             	cmpb   $0x0,(%edx)
+  800877:	74 10                	je     800889 <strlen+0x1b>
+  800879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087e:	83 c0 01             	add    $0x1,%eax
+  800881:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800885:	75 f7                	jne    80087e <strlen+0x10>
+  800887:	5d                   	pop    %ebp
+  800888:	c3                   	ret
+  800889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088e:	eb f7                	jmp    800887 <strlen+0x19>
+
+00800890 <strnlen>:
+  800890:	55                   	push   %ebp
+  800891:	89 e5                	mov    %esp,%ebp
+  800893:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800896:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800899:	85 d2                	test   %edx,%edx
+  80089b:	74 16                	je     8008b3 <strnlen+0x23>
+  80089d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008a6:	74 09                	je     8008b1 <strnlen+0x21>
+  8008a8:	83 c0 01             	add    $0x1,%eax
+  8008ab:	39 d0                	cmp    %edx,%eax
+  8008ad:	75 f3                	jne    8008a2 <strnlen+0x12>
+  8008af:	89 d0                	mov    %edx,%eax
+  8008b1:	5d                   	pop    %ebp
+  8008b2:	c3                   	ret
+  8008b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b8:	eb f7                	jmp    8008b1 <strnlen+0x21>
+
+008008ba <strcpy>:
+  8008ba:	55                   	push   %ebp
+  8008bb:	89 e5                	mov    %esp,%ebp
+  8008bd:	53                   	push   %ebx
+  8008be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008cd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d0:	83 c0 01             	add    $0x1,%eax
+  8008d3:	84 d2                	test   %dl,%dl
+  8008d5:	75 f2                	jne    8008c9 <strcpy+0xf>
+  8008d7:	89 c8                	mov    %ecx,%eax
+  8008d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008dc:	c9                   	leave
+  8008dd:	c3                   	ret
+
+008008de <strcat>:
+  8008de:	55                   	push   %ebp
+  8008df:	89 e5                	mov    %esp,%ebp
+  8008e1:	53                   	push   %ebx
+  8008e2:	83 ec 10             	sub    $0x10,%esp
+  8008e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008e8:	53                   	push   %ebx
+  8008e9:	e8 80 ff ff ff       	call   80086e <strlen>
+  8008ee:	83 c4 08             	add    $0x8,%esp
+  8008f1:	ff 75 0c             	push   0xc(%ebp)
+  8008f4:	01 d8                	add    %ebx,%eax
+  8008f6:	50                   	push   %eax
+  8008f7:	e8 be ff ff ff       	call   8008ba <strcpy>
+  8008fc:	89 d8                	mov    %ebx,%eax
+  8008fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800901:	c9                   	leave
+  800902:	c3                   	ret
+
+00800903 <strncpy>:
+  800903:	55                   	push   %ebp
+  800904:	89 e5                	mov    %esp,%ebp
+  800906:	56                   	push   %esi
+  800907:	53                   	push   %ebx
+  800908:	8b 75 08             	mov    0x8(%ebp),%esi
+  80090b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80090e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800911:	85 db                	test   %ebx,%ebx
+  800913:	74 17                	je     80092c <strncpy+0x29>
+  800915:	01 f3                	add    %esi,%ebx
+  800917:	89 f0                	mov    %esi,%eax
+  800919:	83 c0 01             	add    $0x1,%eax
+  80091c:	0f b6 0a             	movzbl (%edx),%ecx
+  80091f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800922:	80 f9 01             	cmp    $0x1,%cl
+  800925:	83 da ff             	sbb    $0xffffffff,%edx
+  800928:	39 c3                	cmp    %eax,%ebx
+  80092a:	75 ed                	jne    800919 <strncpy+0x16>
+  80092c:	89 f0                	mov    %esi,%eax
+  80092e:	5b                   	pop    %ebx
+  80092f:	5e                   	pop    %esi
+  800930:	5d                   	pop    %ebp
+  800931:	c3                   	ret
+
+00800932 <strlcpy>:
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	56                   	push   %esi
+  800936:	53                   	push   %ebx
+  800937:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80093d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800940:	89 f0                	mov    %esi,%eax
+  800942:	85 db                	test   %ebx,%ebx
+  800944:	74 1e                	je     800964 <strlcpy+0x32>
+  800946:	83 eb 01             	sub    $0x1,%ebx
+  800949:	74 16                	je     800961 <strlcpy+0x2f>
+  80094b:	01 f3                	add    %esi,%ebx
+  80094d:	0f b6 0a             	movzbl (%edx),%ecx
+  800950:	84 c9                	test   %cl,%cl
+  800952:	74 0d                	je     800961 <strlcpy+0x2f>
+  800954:	83 c2 01             	add    $0x1,%edx
+  800957:	83 c0 01             	add    $0x1,%eax
+  80095a:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80095d:	39 d8                	cmp    %ebx,%eax
+  80095f:	75 ec                	jne    80094d <strlcpy+0x1b>
+  800961:	c6 00 00             	movb   $0x0,(%eax)
+  800964:	29 f0                	sub    %esi,%eax
+  800966:	5b                   	pop    %ebx
+  800967:	5e                   	pop    %esi
+  800968:	5d                   	pop    %ebp
+  800969:	c3                   	ret
+
+0080096a <strcmp>:
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800970:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800973:	0f b6 01             	movzbl (%ecx),%eax
+  800976:	84 c0                	test   %al,%al
+  800978:	74 11                	je     80098b <strcmp+0x21>
+  80097a:	38 02                	cmp    %al,(%edx)
+  80097c:	75 0d                	jne    80098b <strcmp+0x21>
+  80097e:	83 c1 01             	add    $0x1,%ecx
+  800981:	83 c2 01             	add    $0x1,%edx
+  800984:	0f b6 01             	movzbl (%ecx),%eax
+  800987:	84 c0                	test   %al,%al
+  800989:	75 ef                	jne    80097a <strcmp+0x10>
+  80098b:	0f b6 c0             	movzbl %al,%eax
+  80098e:	0f b6 12             	movzbl (%edx),%edx
+  800991:	29 d0                	sub    %edx,%eax
+  800993:	5d                   	pop    %ebp
+  800994:	c3                   	ret
+
+00800995 <strncmp>:
+  800995:	55                   	push   %ebp
+  800996:	89 e5                	mov    %esp,%ebp
+  800998:	53                   	push   %ebx
+  800999:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80099c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80099f:	8b 55 10             	mov    0x10(%ebp),%edx
+  8009a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a7:	85 d2                	test   %edx,%edx
+  8009a9:	74 2e                	je     8009d9 <strncmp+0x44>
+  8009ab:	0f b6 01             	movzbl (%ecx),%eax
+  8009ae:	84 c0                	test   %al,%al
+  8009b0:	74 16                	je     8009c8 <strncmp+0x33>
+  8009b2:	3a 03                	cmp    (%ebx),%al
+  8009b4:	75 12                	jne    8009c8 <strncmp+0x33>
+  8009b6:	83 c1 01             	add    $0x1,%ecx
+  8009b9:	83 c3 01             	add    $0x1,%ebx
+  8009bc:	83 ea 01             	sub    $0x1,%edx
+  8009bf:	75 ea                	jne    8009ab <strncmp+0x16>
+  8009c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c6:	eb 11                	jmp    8009d9 <strncmp+0x44>
+  8009c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cd:	85 d2                	test   %edx,%edx
+  8009cf:	74 08                	je     8009d9 <strncmp+0x44>
+  8009d1:	0f b6 01             	movzbl (%ecx),%eax
+  8009d4:	0f b6 13             	movzbl (%ebx),%edx
+  8009d7:	29 d0                	sub    %edx,%eax
+  8009d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009dc:	c9                   	leave
+  8009dd:	c3                   	ret
+
+008009de <strchr>:
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009e8:	0f b6 10             	movzbl (%eax),%edx
+  8009eb:	84 d2                	test   %dl,%dl
+  8009ed:	74 15                	je     800a04 <strchr+0x26>
+  8009ef:	38 d1                	cmp    %dl,%cl
+  8009f1:	74 0f                	je     800a02 <strchr+0x24>
+  8009f3:	83 c0 01             	add    $0x1,%eax
+  8009f6:	0f b6 10             	movzbl (%eax),%edx
+  8009f9:	84 d2                	test   %dl,%dl
+  8009fb:	75 f2                	jne    8009ef <strchr+0x11>
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+  800a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a09:	eb f7                	jmp    800a02 <strchr+0x24>
+
+00800a0b <strfind>:
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	53                   	push   %ebx
+  800a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a15:	0f b6 18             	movzbl (%eax),%ebx
+  800a18:	38 d3                	cmp    %dl,%bl
+  800a1a:	74 14                	je     800a30 <strfind+0x25>
+  800a1c:	89 d1                	mov    %edx,%ecx
+  800a1e:	84 db                	test   %bl,%bl
+  800a20:	74 0e                	je     800a30 <strfind+0x25>
+  800a22:	83 c0 01             	add    $0x1,%eax
+  800a25:	0f b6 10             	movzbl (%eax),%edx
+  800a28:	38 ca                	cmp    %cl,%dl
+  800a2a:	74 04                	je     800a30 <strfind+0x25>
+  800a2c:	84 d2                	test   %dl,%dl
+  800a2e:	75 f2                	jne    800a22 <strfind+0x17>
+  800a30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a33:	c9                   	leave
+  800a34:	c3                   	ret
+
+00800a35 <memset>:
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	57                   	push   %edi
+  800a39:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a3c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a3f:	85 c9                	test   %ecx,%ecx
+  800a41:	74 20                	je     800a63 <memset+0x2e>
+  800a43:	89 f8                	mov    %edi,%eax
+  800a45:	09 c8                	or     %ecx,%eax
+  800a47:	a8 03                	test   $0x3,%al
+  800a49:	75 12                	jne    800a5d <memset+0x28>
+  800a4b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a4f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a55:	c1 e9 02             	shr    $0x2,%ecx
+  800a58:	fc                   	cld
+  800a59:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a5b:	eb 06                	jmp    800a63 <memset+0x2e>
+  800a5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a60:	fc                   	cld
+  800a61:	f3 aa                	rep stos %al,%es:(%edi)
+  800a63:	89 f8                	mov    %edi,%eax
+  800a65:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a68:	c9                   	leave
+  800a69:	c3                   	ret
+
+00800a6a <memmove>:
+  800a6a:	55                   	push   %ebp
+  800a6b:	89 e5                	mov    %esp,%ebp
+  800a6d:	57                   	push   %edi
+  800a6e:	56                   	push   %esi
+  800a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a72:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a75:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a78:	39 c6                	cmp    %eax,%esi
+  800a7a:	73 32                	jae    800aae <memmove+0x44>
+  800a7c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a7f:	39 d0                	cmp    %edx,%eax
+  800a81:	73 2b                	jae    800aae <memmove+0x44>
+  800a83:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a86:	89 d6                	mov    %edx,%esi
+  800a88:	09 fe                	or     %edi,%esi
+  800a8a:	09 ce                	or     %ecx,%esi
+  800a8c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a92:	75 0e                	jne    800aa2 <memmove+0x38>
+  800a94:	83 ef 04             	sub    $0x4,%edi
+  800a97:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a9a:	c1 e9 02             	shr    $0x2,%ecx
+  800a9d:	fd                   	std
+  800a9e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa0:	eb 09                	jmp    800aab <memmove+0x41>
+  800aa2:	83 ef 01             	sub    $0x1,%edi
+  800aa5:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800aa8:	fd                   	std
+  800aa9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800aab:	fc                   	cld
+  800aac:	eb 1a                	jmp    800ac8 <memmove+0x5e>
+  800aae:	89 f2                	mov    %esi,%edx
+  800ab0:	09 c2                	or     %eax,%edx
+  800ab2:	09 ca                	or     %ecx,%edx
+  800ab4:	f6 c2 03             	test   $0x3,%dl
+  800ab7:	75 0a                	jne    800ac3 <memmove+0x59>
+  800ab9:	c1 e9 02             	shr    $0x2,%ecx
+  800abc:	89 c7                	mov    %eax,%edi
+  800abe:	fc                   	cld
+  800abf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac1:	eb 05                	jmp    800ac8 <memmove+0x5e>
+  800ac3:	89 c7                	mov    %eax,%edi
+  800ac5:	fc                   	cld
+  800ac6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ac8:	5e                   	pop    %esi
+  800ac9:	5f                   	pop    %edi
+  800aca:	5d                   	pop    %ebp
+  800acb:	c3                   	ret
+
+00800acc <memcpy>:
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	83 ec 0c             	sub    $0xc,%esp
+  800ad2:	ff 75 10             	push   0x10(%ebp)
+  800ad5:	ff 75 0c             	push   0xc(%ebp)
+  800ad8:	ff 75 08             	push   0x8(%ebp)
+  800adb:	e8 8a ff ff ff       	call   800a6a <memmove>
+  800ae0:	c9                   	leave
+  800ae1:	c3                   	ret
+
+00800ae2 <memcmp>:
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	56                   	push   %esi
+  800ae6:	53                   	push   %ebx
+  800ae7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aed:	8b 75 10             	mov    0x10(%ebp),%esi
+  800af0:	85 f6                	test   %esi,%esi
+  800af2:	74 29                	je     800b1d <memcmp+0x3b>
+  800af4:	01 c6                	add    %eax,%esi
+  800af6:	0f b6 08             	movzbl (%eax),%ecx
+  800af9:	0f b6 1a             	movzbl (%edx),%ebx
+  800afc:	38 d9                	cmp    %bl,%cl
+  800afe:	75 11                	jne    800b11 <memcmp+0x2f>
+  800b00:	83 c0 01             	add    $0x1,%eax
+  800b03:	83 c2 01             	add    $0x1,%edx
+  800b06:	39 c6                	cmp    %eax,%esi
+  800b08:	75 ec                	jne    800af6 <memcmp+0x14>
+  800b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0f:	eb 08                	jmp    800b19 <memcmp+0x37>
+  800b11:	0f b6 c1             	movzbl %cl,%eax
+  800b14:	0f b6 db             	movzbl %bl,%ebx
+  800b17:	29 d8                	sub    %ebx,%eax
+  800b19:	5b                   	pop    %ebx
+  800b1a:	5e                   	pop    %esi
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+  800b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b22:	eb f5                	jmp    800b19 <memcmp+0x37>
+
+00800b24 <memfind>:
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2d:	89 c2                	mov    %eax,%edx
+  800b2f:	03 55 10             	add    0x10(%ebp),%edx
+  800b32:	39 d0                	cmp    %edx,%eax
+  800b34:	73 0d                	jae    800b43 <memfind+0x1f>
+  800b36:	38 08                	cmp    %cl,(%eax)
+  800b38:	74 0d                	je     800b47 <memfind+0x23>
+  800b3a:	83 c0 01             	add    $0x1,%eax
+  800b3d:	39 c2                	cmp    %eax,%edx
+  800b3f:	75 f5                	jne    800b36 <memfind+0x12>
+  800b41:	eb 06                	jmp    800b49 <memfind+0x25>
+  800b43:	89 c2                	mov    %eax,%edx
+  800b45:	eb 02                	jmp    800b49 <memfind+0x25>
+  800b47:	89 c2                	mov    %eax,%edx
+  800b49:	89 d0                	mov    %edx,%eax
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+
+00800b4d <strtol>:
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	57                   	push   %edi
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+  800b53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b59:	0f b6 02             	movzbl (%edx),%eax
+  800b5c:	3c 20                	cmp    $0x20,%al
+  800b5e:	74 04                	je     800b64 <strtol+0x17>
+  800b60:	3c 09                	cmp    $0x9,%al
+  800b62:	75 0e                	jne    800b72 <strtol+0x25>
+  800b64:	83 c2 01             	add    $0x1,%edx
+  800b67:	0f b6 02             	movzbl (%edx),%eax
+  800b6a:	3c 20                	cmp    $0x20,%al
+  800b6c:	74 f6                	je     800b64 <strtol+0x17>
+  800b6e:	3c 09                	cmp    $0x9,%al
+  800b70:	74 f2                	je     800b64 <strtol+0x17>
+  800b72:	3c 2b                	cmp    $0x2b,%al
+  800b74:	74 2a                	je     800ba0 <strtol+0x53>
+  800b76:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b7b:	3c 2d                	cmp    $0x2d,%al
+  800b7d:	74 2b                	je     800baa <strtol+0x5d>
+  800b7f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b85:	75 0f                	jne    800b96 <strtol+0x49>
+  800b87:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b8a:	74 28                	je     800bb4 <strtol+0x67>
+  800b8c:	85 db                	test   %ebx,%ebx
+  800b8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b93:	0f 44 d8             	cmove  %eax,%ebx
+  800b96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b9b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b9e:	eb 46                	jmp    800be6 <strtol+0x99>
+  800ba0:	83 c2 01             	add    $0x1,%edx
+  800ba3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba8:	eb d5                	jmp    800b7f <strtol+0x32>
+  800baa:	83 c2 01             	add    $0x1,%edx
+  800bad:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bb2:	eb cb                	jmp    800b7f <strtol+0x32>
+  800bb4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bb8:	74 0e                	je     800bc8 <strtol+0x7b>
+  800bba:	85 db                	test   %ebx,%ebx
+  800bbc:	75 d8                	jne    800b96 <strtol+0x49>
+  800bbe:	83 c2 01             	add    $0x1,%edx
+  800bc1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bc6:	eb ce                	jmp    800b96 <strtol+0x49>
+  800bc8:	83 c2 02             	add    $0x2,%edx
+  800bcb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bd0:	eb c4                	jmp    800b96 <strtol+0x49>
+  800bd2:	0f be c0             	movsbl %al,%eax
+  800bd5:	83 e8 30             	sub    $0x30,%eax
+  800bd8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bdb:	7d 3a                	jge    800c17 <strtol+0xca>
+  800bdd:	83 c2 01             	add    $0x1,%edx
+  800be0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800be4:	01 c1                	add    %eax,%ecx
+  800be6:	0f b6 02             	movzbl (%edx),%eax
+  800be9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bec:	89 f3                	mov    %esi,%ebx
+  800bee:	80 fb 09             	cmp    $0x9,%bl
+  800bf1:	76 df                	jbe    800bd2 <strtol+0x85>
+  800bf3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bf6:	89 f3                	mov    %esi,%ebx
+  800bf8:	80 fb 19             	cmp    $0x19,%bl
+  800bfb:	77 08                	ja     800c05 <strtol+0xb8>
+  800bfd:	0f be c0             	movsbl %al,%eax
+  800c00:	83 e8 57             	sub    $0x57,%eax
+  800c03:	eb d3                	jmp    800bd8 <strtol+0x8b>
+  800c05:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c08:	89 f3                	mov    %esi,%ebx
+  800c0a:	80 fb 19             	cmp    $0x19,%bl
+  800c0d:	77 08                	ja     800c17 <strtol+0xca>
+  800c0f:	0f be c0             	movsbl %al,%eax
+  800c12:	83 e8 37             	sub    $0x37,%eax
+  800c15:	eb c1                	jmp    800bd8 <strtol+0x8b>
+  800c17:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c1b:	74 05                	je     800c22 <strtol+0xd5>
+  800c1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c20:	89 10                	mov    %edx,(%eax)
+  800c22:	89 c8                	mov    %ecx,%eax
+  800c24:	f7 d8                	neg    %eax
+  800c26:	85 ff                	test   %edi,%edi
+  800c28:	0f 45 c8             	cmovne %eax,%ecx
+  800c2b:	89 c8                	mov    %ecx,%eax
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5f                   	pop    %edi
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+
+00800c32 <sys_cputs>:
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	57                   	push   %edi
+  800c36:	56                   	push   %esi
+  800c37:	53                   	push   %ebx
+  800c38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c43:	89 c3                	mov    %eax,%ebx
+  800c45:	89 c7                	mov    %eax,%edi
+  800c47:	89 c6                	mov    %eax,%esi
+  800c49:	cd 30                	int    $0x30
+  800c4b:	5b                   	pop    %ebx
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <sys_cgetc>:
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+  800c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c60:	89 d1                	mov    %edx,%ecx
+  800c62:	89 d3                	mov    %edx,%ebx
+  800c64:	89 d7                	mov    %edx,%edi
+  800c66:	89 d6                	mov    %edx,%esi
+  800c68:	cd 30                	int    $0x30
+  800c6a:	5b                   	pop    %ebx
+  800c6b:	5e                   	pop    %esi
+  800c6c:	5f                   	pop    %edi
+  800c6d:	5d                   	pop    %ebp
+  800c6e:	c3                   	ret
+
+00800c6f <sys_env_destroy>:
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	57                   	push   %edi
+  800c73:	56                   	push   %esi
+  800c74:	53                   	push   %ebx
+  800c75:	83 ec 0c             	sub    $0xc,%esp
+  800c78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c80:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c85:	89 cb                	mov    %ecx,%ebx
+  800c87:	89 cf                	mov    %ecx,%edi
+  800c89:	89 ce                	mov    %ecx,%esi
+  800c8b:	cd 30                	int    $0x30
+  800c8d:	85 c0                	test   %eax,%eax
+  800c8f:	7f 08                	jg     800c99 <sys_env_destroy+0x2a>
+  800c91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c94:	5b                   	pop    %ebx
+  800c95:	5e                   	pop    %esi
+  800c96:	5f                   	pop    %edi
+  800c97:	5d                   	pop    %ebp
+  800c98:	c3                   	ret
+  800c99:	83 ec 0c             	sub    $0xc,%esp
+  800c9c:	50                   	push   %eax
+  800c9d:	6a 03                	push   $0x3
+  800c9f:	68 6b 3b 80 00       	push   $0x803b6b
+  800ca4:	6a 24                	push   $0x24
+  800ca6:	68 88 3b 80 00       	push   $0x803b88
+  800cab:	e8 68 25 00 00       	call   803218 <_panic>
+
+00800cb0 <sys_getenvid>:
+  800cb0:	55                   	push   %ebp
+  800cb1:	89 e5                	mov    %esp,%ebp
+  800cb3:	57                   	push   %edi
+  800cb4:	56                   	push   %esi
+  800cb5:	53                   	push   %ebx
+  800cb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cc0:	89 d1                	mov    %edx,%ecx
+  800cc2:	89 d3                	mov    %edx,%ebx
+  800cc4:	89 d7                	mov    %edx,%edi
+  800cc6:	89 d6                	mov    %edx,%esi
+  800cc8:	cd 30                	int    $0x30
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+
+00800ccf <sys_yield>:
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+  800cd5:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800cdc:	74 26                	je     800d04 <sys_yield+0x35>
+  800cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ce8:	89 d1                	mov    %edx,%ecx
+  800cea:	89 d3                	mov    %edx,%ebx
+  800cec:	89 d7                	mov    %edx,%edi
+  800cee:	6a 00                	push   $0x0
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	8d 35 fb 0c 80 00    	lea    0x800cfb,%esi
+  800cf9:	0f 34                	sysenter
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	83 c4 04             	add    $0x4,%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+  800d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d09:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d0e:	89 d1                	mov    %edx,%ecx
+  800d10:	89 d3                	mov    %edx,%ebx
+  800d12:	89 d7                	mov    %edx,%edi
+  800d14:	89 d6                	mov    %edx,%esi
+  800d16:	cd 30                	int    $0x30
+  800d18:	eb e5                	jmp    800cff <sys_yield+0x30>
+
+00800d1a <sys_page_alloc>:
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	57                   	push   %edi
+  800d1e:	56                   	push   %esi
+  800d1f:	53                   	push   %ebx
+  800d20:	83 ec 0c             	sub    $0xc,%esp
+  800d23:	be 00 00 00 00       	mov    $0x0,%esi
+  800d28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d36:	89 f7                	mov    %esi,%edi
+  800d38:	cd 30                	int    $0x30
+  800d3a:	85 c0                	test   %eax,%eax
+  800d3c:	7f 08                	jg     800d46 <sys_page_alloc+0x2c>
+  800d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+  800d49:	50                   	push   %eax
+  800d4a:	6a 04                	push   $0x4
+  800d4c:	68 6b 3b 80 00       	push   $0x803b6b
+  800d51:	6a 24                	push   $0x24
+  800d53:	68 88 3b 80 00       	push   $0x803b88
+  800d58:	e8 bb 24 00 00       	call   803218 <_panic>
+
+00800d5d <sys_page_map>:
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	57                   	push   %edi
+  800d61:	56                   	push   %esi
+  800d62:	53                   	push   %ebx
+  800d63:	83 ec 0c             	sub    $0xc,%esp
+  800d66:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d6d:	74 33                	je     800da2 <sys_page_map+0x45>
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d75:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d80:	ff 75 18             	push   0x18(%ebp)
+  800d83:	55                   	push   %ebp
+  800d84:	89 e5                	mov    %esp,%ebp
+  800d86:	8d 35 8e 0d 80 00    	lea    0x800d8e,%esi
+  800d8c:	0f 34                	sysenter
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	83 c4 04             	add    $0x4,%esp
+  800d92:	89 c2                	mov    %eax,%edx
+  800d94:	85 c0                	test   %eax,%eax
+  800d96:	7f 3d                	jg     800dd5 <sys_page_map+0x78>
+  800d98:	89 d0                	mov    %edx,%eax
+  800d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+  800da2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db3:	8b 75 18             	mov    0x18(%ebp),%esi
+  800db6:	cd 30                	int    $0x30
+  800db8:	89 c2                	mov    %eax,%edx
+  800dba:	85 c0                	test   %eax,%eax
+  800dbc:	7e da                	jle    800d98 <sys_page_map+0x3b>
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  800dc1:	50                   	push   %eax
+  800dc2:	6a 05                	push   $0x5
+  800dc4:	68 6b 3b 80 00       	push   $0x803b6b
+  800dc9:	6a 24                	push   $0x24
+  800dcb:	68 88 3b 80 00       	push   $0x803b88
+  800dd0:	e8 43 24 00 00       	call   803218 <_panic>
+  800dd5:	83 ec 0c             	sub    $0xc,%esp
+  800dd8:	50                   	push   %eax
+  800dd9:	6a 05                	push   $0x5
+  800ddb:	68 6b 3b 80 00       	push   $0x803b6b
+  800de0:	6a 48                	push   $0x48
+  800de2:	68 88 3b 80 00       	push   $0x803b88
+  800de7:	e8 2c 24 00 00       	call   803218 <_panic>
+
+00800dec <sys_page_unmap>:
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  800df2:	83 ec 0c             	sub    $0xc,%esp
+  800df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e00:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e05:	89 df                	mov    %ebx,%edi
+  800e07:	89 de                	mov    %ebx,%esi
+  800e09:	cd 30                	int    $0x30
+  800e0b:	85 c0                	test   %eax,%eax
+  800e0d:	7f 08                	jg     800e17 <sys_page_unmap+0x2b>
+  800e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+  800e17:	83 ec 0c             	sub    $0xc,%esp
+  800e1a:	50                   	push   %eax
+  800e1b:	6a 06                	push   $0x6
+  800e1d:	68 6b 3b 80 00       	push   $0x803b6b
+  800e22:	6a 24                	push   $0x24
+  800e24:	68 88 3b 80 00       	push   $0x803b88
+  800e29:	e8 ea 23 00 00       	call   803218 <_panic>
+
+00800e2e <sys_fork>:
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+  800e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e39:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e3e:	89 d1                	mov    %edx,%ecx
+  800e40:	89 d3                	mov    %edx,%ebx
+  800e42:	89 d7                	mov    %edx,%edi
+  800e44:	89 d6                	mov    %edx,%esi
+  800e46:	cd 30                	int    $0x30
+  800e48:	5b                   	pop    %ebx
+  800e49:	5e                   	pop    %esi
+  800e4a:	5f                   	pop    %edi
+  800e4b:	5d                   	pop    %ebp
+  800e4c:	c3                   	ret
+
+00800e4d <sys_env_set_status>:
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	57                   	push   %edi
+  800e51:	56                   	push   %esi
+  800e52:	53                   	push   %ebx
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e61:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e66:	89 df                	mov    %ebx,%edi
+  800e68:	89 de                	mov    %ebx,%esi
+  800e6a:	cd 30                	int    $0x30
+  800e6c:	85 c0                	test   %eax,%eax
+  800e6e:	7f 08                	jg     800e78 <sys_env_set_status+0x2b>
+  800e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e73:	5b                   	pop    %ebx
+  800e74:	5e                   	pop    %esi
+  800e75:	5f                   	pop    %edi
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+  800e78:	83 ec 0c             	sub    $0xc,%esp
+  800e7b:	50                   	push   %eax
+  800e7c:	6a 08                	push   $0x8
+  800e7e:	68 6b 3b 80 00       	push   $0x803b6b
+  800e83:	6a 24                	push   $0x24
+  800e85:	68 88 3b 80 00       	push   $0x803b88
+  800e8a:	e8 89 23 00 00       	call   803218 <_panic>
+
+00800e8f <sys_env_set_trapframe>:
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	56                   	push   %esi
+  800e94:	53                   	push   %ebx
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ea8:	89 df                	mov    %ebx,%edi
+  800eaa:	89 de                	mov    %ebx,%esi
+  800eac:	cd 30                	int    $0x30
+  800eae:	85 c0                	test   %eax,%eax
+  800eb0:	7f 08                	jg     800eba <sys_env_set_trapframe+0x2b>
+  800eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb5:	5b                   	pop    %ebx
+  800eb6:	5e                   	pop    %esi
+  800eb7:	5f                   	pop    %edi
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+  800eba:	83 ec 0c             	sub    $0xc,%esp
+  800ebd:	50                   	push   %eax
+  800ebe:	6a 09                	push   $0x9
+  800ec0:	68 6b 3b 80 00       	push   $0x803b6b
+  800ec5:	6a 24                	push   $0x24
+  800ec7:	68 88 3b 80 00       	push   $0x803b88
+  800ecc:	e8 47 23 00 00       	call   803218 <_panic>
+
+00800ed1 <sys_env_set_cow>:
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 20 00 00 00       	mov    $0x20,%eax
+  800eea:	89 df                	mov    %ebx,%edi
+  800eec:	89 de                	mov    %ebx,%esi
+  800eee:	cd 30                	int    $0x30
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_env_set_cow+0x2b>
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 20                	push   $0x20
+  800f02:	68 6b 3b 80 00       	push   $0x803b6b
+  800f07:	6a 24                	push   $0x24
+  800f09:	68 88 3b 80 00       	push   $0x803b88
+  800f0e:	e8 05 23 00 00       	call   803218 <_panic>
+
+00800f13 <sys_env_service>:
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f26:	89 cb                	mov    %ecx,%ebx
+  800f28:	89 cf                	mov    %ecx,%edi
+  800f2a:	89 ce                	mov    %ecx,%esi
+  800f2c:	cd 30                	int    $0x30
+  800f2e:	5b                   	pop    %ebx
+  800f2f:	5e                   	pop    %esi
+  800f30:	5f                   	pop    %edi
+  800f31:	5d                   	pop    %ebp
+  800f32:	c3                   	ret
+
+00800f33 <sys_env_set_pgfault_upcall>:
+  800f33:	55                   	push   %ebp
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	57                   	push   %edi
+  800f37:	56                   	push   %esi
+  800f38:	53                   	push   %ebx
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+  800f3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f4c:	89 df                	mov    %ebx,%edi
+  800f4e:	89 de                	mov    %ebx,%esi
+  800f50:	cd 30                	int    $0x30
+  800f52:	85 c0                	test   %eax,%eax
+  800f54:	7f 08                	jg     800f5e <sys_env_set_pgfault_upcall+0x2b>
+  800f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+  800f5e:	83 ec 0c             	sub    $0xc,%esp
+  800f61:	50                   	push   %eax
+  800f62:	6a 0a                	push   $0xa
+  800f64:	68 6b 3b 80 00       	push   $0x803b6b
+  800f69:	6a 24                	push   $0x24
+  800f6b:	68 88 3b 80 00       	push   $0x803b88
+  800f70:	e8 a3 22 00 00       	call   803218 <_panic>
+
+00800f75 <sys_ipc_try_send>:
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	57                   	push   %edi
+  800f79:	56                   	push   %esi
+  800f7a:	53                   	push   %ebx
+  800f7b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f82:	74 27                	je     800fab <sys_ipc_try_send+0x36>
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f92:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f95:	6a 00                	push   $0x0
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	8d 35 a2 0f 80 00    	lea    0x800fa2,%esi
+  800fa0:	0f 34                	sysenter
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	83 c4 04             	add    $0x4,%esp
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5e                   	pop    %esi
+  800fa8:	5f                   	pop    %edi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+  800fab:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fb0:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc1:	cd 30                	int    $0x30
+  800fc3:	eb e1                	jmp    800fa6 <sys_ipc_try_send+0x31>
+
+00800fc5 <sys_ipc_recv>:
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	57                   	push   %edi
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+  800fce:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fd5:	74 32                	je     801009 <sys_ipc_recv+0x44>
+  800fd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fdf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fe4:	89 cb                	mov    %ecx,%ebx
+  800fe6:	89 cf                	mov    %ecx,%edi
+  800fe8:	6a 00                	push   $0x0
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	8d 35 f5 0f 80 00    	lea    0x800ff5,%esi
+  800ff3:	0f 34                	sysenter
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	83 c4 04             	add    $0x4,%esp
+  800ff9:	89 c2                	mov    %eax,%edx
+  800ffb:	85 c0                	test   %eax,%eax
+  800ffd:	7f 3c                	jg     80103b <sys_ipc_recv+0x76>
+  800fff:	89 d0                	mov    %edx,%eax
+  801001:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801004:	5b                   	pop    %ebx
+  801005:	5e                   	pop    %esi
+  801006:	5f                   	pop    %edi
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+  801009:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80100e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801013:	8b 55 08             	mov    0x8(%ebp),%edx
+  801016:	89 cb                	mov    %ecx,%ebx
+  801018:	89 cf                	mov    %ecx,%edi
+  80101a:	89 ce                	mov    %ecx,%esi
+  80101c:	cd 30                	int    $0x30
+  80101e:	89 c2                	mov    %eax,%edx
+  801020:	85 c0                	test   %eax,%eax
+  801022:	7e db                	jle    800fff <sys_ipc_recv+0x3a>
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  801027:	50                   	push   %eax
+  801028:	6a 0d                	push   $0xd
+  80102a:	68 6b 3b 80 00       	push   $0x803b6b
+  80102f:	6a 24                	push   $0x24
+  801031:	68 88 3b 80 00       	push   $0x803b88
+  801036:	e8 dd 21 00 00       	call   803218 <_panic>
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+  80103e:	50                   	push   %eax
+  80103f:	6a 0d                	push   $0xd
+  801041:	68 6b 3b 80 00       	push   $0x803b6b
+  801046:	6a 48                	push   $0x48
+  801048:	68 88 3b 80 00       	push   $0x803b88
+  80104d:	e8 c6 21 00 00       	call   803218 <_panic>
+
+00801052 <sys_ipc_send>:
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	57                   	push   %edi
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+  801058:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80105f:	74 27                	je     801088 <sys_ipc_send+0x36>
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80106c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801072:	6a 00                	push   $0x0
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	8d 35 7f 10 80 00    	lea    0x80107f,%esi
+  80107d:	0f 34                	sysenter
+  80107f:	5d                   	pop    %ebp
+  801080:	83 c4 04             	add    $0x4,%esp
+  801083:	5b                   	pop    %ebx
+  801084:	5e                   	pop    %esi
+  801085:	5f                   	pop    %edi
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+  801088:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80108d:	be 00 00 00 00       	mov    $0x0,%esi
+  801092:	8b 55 08             	mov    0x8(%ebp),%edx
+  801095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801098:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109e:	cd 30                	int    $0x30
+  8010a0:	eb e1                	jmp    801083 <sys_ipc_send+0x31>
+
+008010a2 <sys_ipc_call>:
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	57                   	push   %edi
+  8010a6:	56                   	push   %esi
+  8010a7:	53                   	push   %ebx
+  8010a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ae:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010bc:	cd 30                	int    $0x30
+  8010be:	5b                   	pop    %ebx
+  8010bf:	5e                   	pop    %esi
+  8010c0:	5f                   	pop    %edi
+  8010c1:	5d                   	pop    %ebp
+  8010c2:	c3                   	ret
+
+008010c3 <sys_ipc_reply_recv>:
+  8010c3:	55                   	push   %ebp
+  8010c4:	89 e5                	mov    %esp,%ebp
+  8010c6:	57                   	push   %edi
+  8010c7:	56                   	push   %esi
+  8010c8:	53                   	push   %ebx
+  8010c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cf:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010da:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010dd:	cd 30                	int    $0x30
+  8010df:	5b                   	pop    %ebx
+  8010e0:	5e                   	pop    %esi
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+
+008010e4 <sys_time_msec>:
+  8010e4:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8010e9:	85 c0                	test   %eax,%eax
+  8010eb:	75 06                	jne    8010f3 <sys_time_msec+0xf>
+  8010ed:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8010f2:	c3                   	ret
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+  8010f9:	83 ec 0c             	sub    $0xc,%esp
+  8010fc:	0f 31                	rdtsc
+  8010fe:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801104:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80110a:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801110:	29 c8                	sub    %ecx,%eax
+  801112:	19 da                	sbb    %ebx,%edx
+  801114:	bf 00 00 00 00       	mov    $0x0,%edi
+  801119:	57                   	push   %edi
+  80111a:	56                   	push   %esi
+  80111b:	52                   	push   %edx
+  80111c:	50                   	push   %eax
+  80111d:	e8 65 25 00 00       	call   803687 <__udivdi3>
+  801122:	83 c4 10             	add    $0x10,%esp
+  801125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <sys_env_swap>:
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+  801133:	83 ec 0c             	sub    $0xc,%esp
+  801136:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801143:	89 cb                	mov    %ecx,%ebx
+  801145:	89 cf                	mov    %ecx,%edi
+  801147:	89 ce                	mov    %ecx,%esi
+  801149:	cd 30                	int    $0x30
+  80114b:	85 c0                	test   %eax,%eax
+  80114d:	7f 08                	jg     801157 <sys_env_swap+0x2a>
+  80114f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801152:	5b                   	pop    %ebx
+  801153:	5e                   	pop    %esi
+  801154:	5f                   	pop    %edi
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+  801157:	83 ec 0c             	sub    $0xc,%esp
+  80115a:	50                   	push   %eax
+  80115b:	6a 12                	push   $0x12
+  80115d:	68 6b 3b 80 00       	push   $0x803b6b
+  801162:	6a 24                	push   $0x24
+  801164:	68 88 3b 80 00       	push   $0x803b88
+  801169:	e8 aa 20 00 00       	call   803218 <_panic>
+
+0080116e <sys_net_try_send>:
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	57                   	push   %edi
+  801172:	56                   	push   %esi
+  801173:	53                   	push   %ebx
+  801174:	83 ec 0c             	sub    $0xc,%esp
+  801177:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801182:	b8 13 00 00 00       	mov    $0x13,%eax
+  801187:	89 df                	mov    %ebx,%edi
+  801189:	89 de                	mov    %ebx,%esi
+  80118b:	cd 30                	int    $0x30
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	7f 08                	jg     801199 <sys_net_try_send+0x2b>
+  801191:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801194:	5b                   	pop    %ebx
+  801195:	5e                   	pop    %esi
+  801196:	5f                   	pop    %edi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+  801199:	83 ec 0c             	sub    $0xc,%esp
+  80119c:	50                   	push   %eax
+  80119d:	6a 13                	push   $0x13
+  80119f:	68 6b 3b 80 00       	push   $0x803b6b
+  8011a4:	6a 24                	push   $0x24
+  8011a6:	68 88 3b 80 00       	push   $0x803b88
+  8011ab:	e8 68 20 00 00       	call   803218 <_panic>
+
+008011b0 <sys_net_try_receive>:
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	57                   	push   %edi
+  8011b4:	56                   	push   %esi
+  8011b5:	53                   	push   %ebx
+  8011b6:	83 ec 0c             	sub    $0xc,%esp
+  8011b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011c9:	89 df                	mov    %ebx,%edi
+  8011cb:	89 de                	mov    %ebx,%esi
+  8011cd:	cd 30                	int    $0x30
+  8011cf:	85 c0                	test   %eax,%eax
+  8011d1:	7f 08                	jg     8011db <sys_net_try_receive+0x2b>
+  8011d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d6:	5b                   	pop    %ebx
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5f                   	pop    %edi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+  8011db:	83 ec 0c             	sub    $0xc,%esp
+  8011de:	50                   	push   %eax
+  8011df:	6a 14                	push   $0x14
+  8011e1:	68 6b 3b 80 00       	push   $0x803b6b
+  8011e6:	6a 24                	push   $0x24
+  8011e8:	68 88 3b 80 00       	push   $0x803b88
+  8011ed:	e8 26 20 00 00       	call   803218 <_panic>
+
+008011f2 <sys_net_recv_page>:
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	57                   	push   %edi
+  8011f6:	56                   	push   %esi
+  8011f7:	53                   	push   %ebx
+  8011f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801200:	b8 27 00 00 00       	mov    $0x27,%eax
+  801205:	89 cb                	mov    %ecx,%ebx
+  801207:	89 cf                	mov    %ecx,%edi
+  801209:	89 ce                	mov    %ecx,%esi
+  80120b:	cd 30                	int    $0x30
+  80120d:	5b                   	pop    %ebx
+  80120e:	5e                   	pop    %esi
+  80120f:	5f                   	pop    %edi
+  801210:	5d                   	pop    %ebp
+  801211:	c3                   	ret
+
+00801212 <sys_net_wait>:
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	57                   	push   %edi
+  801216:	56                   	push   %esi
+  801217:	53                   	push   %ebx
+  801218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121d:	b8 26 00 00 00       	mov    $0x26,%eax
+  801222:	89 d1                	mov    %edx,%ecx
+  801224:	89 d3                	mov    %edx,%ebx
+  801226:	89 d7                	mov    %edx,%edi
+  801228:	89 d6                	mov    %edx,%esi
+  80122a:	cd 30                	int    $0x30
+  80122c:	5b                   	pop    %ebx
+  80122d:	5e                   	pop    %esi
+  80122e:	5f                   	pop    %edi
+  80122f:	5d                   	pop    %ebp
+  801230:	c3                   	ret
+
+00801231 <sys_get_mac>:
+  801231:	55                   	push   %ebp
+  801232:	89 e5                	mov    %esp,%ebp
+  801234:	57                   	push   %edi
+  801235:	56                   	push   %esi
+  801236:	53                   	push   %ebx
+  801237:	83 ec 0c             	sub    $0xc,%esp
+  80123a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801242:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801245:	b8 15 00 00 00       	mov    $0x15,%eax
+  80124a:	89 df                	mov    %ebx,%edi
+  80124c:	89 de                	mov    %ebx,%esi
+  80124e:	cd 30                	int    $0x30
+  801250:	85 c0                	test   %eax,%eax
+  801252:	7f 08                	jg     80125c <sys_get_mac+0x2b>
+  801254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801257:	5b                   	pop    %ebx
+  801258:	5e                   	pop    %esi
+  801259:	5f                   	pop    %edi
+  80125a:	5d                   	pop    %ebp
+  80125b:	c3                   	ret
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	50                   	push   %eax
+  801260:	6a 15                	push   $0x15
+  801262:	68 6b 3b 80 00       	push   $0x803b6b
+  801267:	6a 24                	push   $0x24
+  801269:	68 88 3b 80 00       	push   $0x803b88
+  80126e:	e8 a5 1f 00 00       	call   803218 <_panic>
+
+00801273 <sys_env_lease>:
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+  801279:	83 ec 0c             	sub    $0xc,%esp
+  80127c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	b8 16 00 00 00       	mov    $0x16,%eax
+  80128c:	89 df                	mov    %ebx,%edi
+  80128e:	89 de                	mov    %ebx,%esi
+  801290:	cd 30                	int    $0x30
+  801292:	85 c0                	test   %eax,%eax
+  801294:	7f 08                	jg     80129e <sys_env_lease+0x2b>
+  801296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+  80129e:	83 ec 0c             	sub    $0xc,%esp
+  8012a1:	50                   	push   %eax
+  8012a2:	6a 16                	push   $0x16
+  8012a4:	68 6b 3b 80 00       	push   $0x803b6b
+  8012a9:	6a 24                	push   $0x24
+  8012ab:	68 88 3b 80 00       	push   $0x803b88
+  8012b0:	e8 63 1f 00 00       	call   803218 <_panic>
+
+008012b5 <sys_copy_mem>:
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	57                   	push   %edi
+  8012b9:	56                   	push   %esi
+  8012ba:	53                   	push   %ebx
+  8012bb:	83 ec 0c             	sub    $0xc,%esp
+  8012be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012cc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012cf:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012d2:	cd 30                	int    $0x30
+  8012d4:	85 c0                	test   %eax,%eax
+  8012d6:	7f 08                	jg     8012e0 <sys_copy_mem+0x2b>
+  8012d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012db:	5b                   	pop    %ebx
+  8012dc:	5e                   	pop    %esi
+  8012dd:	5f                   	pop    %edi
+  8012de:	5d                   	pop    %ebp
+  8012df:	c3                   	ret
+  8012e0:	83 ec 0c             	sub    $0xc,%esp
+  8012e3:	50                   	push   %eax
+  8012e4:	6a 17                	push   $0x17
+  8012e6:	68 6b 3b 80 00       	push   $0x803b6b
+  8012eb:	6a 24                	push   $0x24
+  8012ed:	68 88 3b 80 00       	push   $0x803b88
+  8012f2:	e8 21 1f 00 00       	call   803218 <_panic>
+
+008012f7 <sys_get_perms>:
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	57                   	push   %edi
+  8012fb:	56                   	push   %esi
+  8012fc:	53                   	push   %ebx
+  8012fd:	83 ec 0c             	sub    $0xc,%esp
+  801300:	be 00 00 00 00       	mov    $0x0,%esi
+  801305:	8b 55 08             	mov    0x8(%ebp),%edx
+  801308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801310:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801313:	89 f7                	mov    %esi,%edi
+  801315:	cd 30                	int    $0x30
+  801317:	85 c0                	test   %eax,%eax
+  801319:	7f 08                	jg     801323 <sys_get_perms+0x2c>
+  80131b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131e:	5b                   	pop    %ebx
+  80131f:	5e                   	pop    %esi
+  801320:	5f                   	pop    %edi
+  801321:	5d                   	pop    %ebp
+  801322:	c3                   	ret
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	50                   	push   %eax
+  801327:	6a 18                	push   $0x18
+  801329:	68 6b 3b 80 00       	push   $0x803b6b
+  80132e:	6a 24                	push   $0x24
+  801330:	68 88 3b 80 00       	push   $0x803b88
+  801335:	e8 de 1e 00 00       	call   803218 <_panic>
+
+0080133a <sys_env_unsuspend>:
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 0c             	sub    $0xc,%esp
+  801343:	be 00 00 00 00       	mov    $0x0,%esi
+  801348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801353:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801356:	89 f7                	mov    %esi,%edi
+  801358:	cd 30                	int    $0x30
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	7f 08                	jg     801366 <sys_env_unsuspend+0x2c>
+  80135e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801361:	5b                   	pop    %ebx
+  801362:	5e                   	pop    %esi
+  801363:	5f                   	pop    %edi
+  801364:	5d                   	pop    %ebp
+  801365:	c3                   	ret
+  801366:	83 ec 0c             	sub    $0xc,%esp
+  801369:	50                   	push   %eax
+  80136a:	6a 19                	push   $0x19
+  80136c:	68 6b 3b 80 00       	push   $0x803b6b
+  801371:	6a 24                	push   $0x24
+  801373:	68 88 3b 80 00       	push   $0x803b88
+  801378:	e8 9b 1e 00 00       	call   803218 <_panic>
+
+0080137d <sys_migrate>:
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+  801380:	57                   	push   %edi
+  801381:	56                   	push   %esi
+  801382:	53                   	push   %ebx
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  801386:	ba 04 80 80 00       	mov    $0x808004,%edx
+  80138b:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801391:	76 11                	jbe    8013a4 <sys_migrate+0x27>
+  801393:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801398:	0f b6 08             	movzbl (%eax),%ecx
+  80139b:	05 00 10 00 00       	add    $0x1000,%eax
+  8013a0:	39 d0                	cmp    %edx,%eax
+  8013a2:	72 f4                	jb     801398 <sys_migrate+0x1b>
+  8013a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ac:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013b1:	89 cb                	mov    %ecx,%ebx
+  8013b3:	89 cf                	mov    %ecx,%edi
+  8013b5:	89 ce                	mov    %ecx,%esi
+  8013b7:	cd 30                	int    $0x30
+  8013b9:	85 c0                	test   %eax,%eax
+  8013bb:	7f 08                	jg     8013c5 <sys_migrate+0x48>
+  8013bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c0:	5b                   	pop    %ebx
+  8013c1:	5e                   	pop    %esi
+  8013c2:	5f                   	pop    %edi
+  8013c3:	5d                   	pop    %ebp
+  8013c4:	c3                   	ret
+  8013c5:	83 ec 0c             	sub    $0xc,%esp
+  8013c8:	50                   	push   %eax
+  8013c9:	6a 1a                	push   $0x1a
+  8013cb:	68 6b 3b 80 00       	push   $0x803b6b
+  8013d0:	6a 24                	push   $0x24
+  8013d2:	68 88 3b 80 00       	push   $0x803b88
+  8013d7:	e8 3c 1e 00 00       	call   803218 <_panic>
+
+008013dc <sys_lease_complete>:
+  8013dc:	55                   	push   %ebp
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	57                   	push   %edi
+  8013e0:	56                   	push   %esi
+  8013e1:	53                   	push   %ebx
+  8013e2:	83 ec 0c             	sub    $0xc,%esp
+  8013e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ea:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013ef:	89 d1                	mov    %edx,%ecx
+  8013f1:	89 d3                	mov    %edx,%ebx
+  8013f3:	89 d7                	mov    %edx,%edi
+  8013f5:	89 d6                	mov    %edx,%esi
+  8013f7:	cd 30                	int    $0x30
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	7f 08                	jg     801405 <sys_lease_complete+0x29>
+  8013fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+  801405:	83 ec 0c             	sub    $0xc,%esp
+  801408:	50                   	push   %eax
+  801409:	6a 1b                	push   $0x1b
+  80140b:	68 6b 3b 80 00       	push   $0x803b6b
+  801410:	6a 24                	push   $0x24
+  801412:	68 88 3b 80 00       	push   $0x803b88
+  801417:	e8 fc 1d 00 00       	call   803218 <_panic>
+
+0080141c <sys_env_set_thisenv>:
+  80141c:	55                   	push   %ebp
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	57                   	push   %edi
+  801420:	56                   	push   %esi
+  801421:	53                   	push   %ebx
+  801422:	83 ec 0c             	sub    $0xc,%esp
+  801425:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801430:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801435:	89 df                	mov    %ebx,%edi
+  801437:	89 de                	mov    %ebx,%esi
+  801439:	cd 30                	int    $0x30
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	7f 08                	jg     801447 <sys_env_set_thisenv+0x2b>
+  80143f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801442:	5b                   	pop    %ebx
+  801443:	5e                   	pop    %esi
+  801444:	5f                   	pop    %edi
+  801445:	5d                   	pop    %ebp
+  801446:	c3                   	ret
+  801447:	83 ec 0c             	sub    $0xc,%esp
+  80144a:	50                   	push   %eax
+  80144b:	6a 1c                	push   $0x1c
+  80144d:	68 6b 3b 80 00       	push   $0x803b6b
+  801452:	6a 24                	push   $0x24
+  801454:	68 88 3b 80 00       	push   $0x803b88
+  801459:	e8 ba 1d 00 00       	call   803218 <_panic>
+
+0080145e <sys_env_set_sched>:
+  80145e:	55                   	push   %ebp
+  80145f:	89 e5                	mov    %esp,%ebp
+  801461:	57                   	push   %edi
+  801462:	56                   	push   %esi
+  801463:	53                   	push   %ebx
+  801464:	83 ec 0c             	sub    $0xc,%esp
+  801467:	be 00 00 00 00       	mov    $0x0,%esi
+  80146c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801472:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801477:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147a:	89 f7                	mov    %esi,%edi
+  80147c:	cd 30                	int    $0x30
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	7f 08                	jg     80148a <sys_env_set_sched+0x2c>
+  801482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+  80148a:	83 ec 0c             	sub    $0xc,%esp
+  80148d:	50                   	push   %eax
+  80148e:	6a 1d                	push   $0x1d
+  801490:	68 6b 3b 80 00       	push   $0x803b6b
+  801495:	6a 24                	push   $0x24
+  801497:	68 88 3b 80 00       	push   $0x803b88
+  80149c:	e8 77 1d 00 00       	call   803218 <_panic>
+
+008014a1 <sys_batch>:
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	57                   	push   %edi
+  8014a5:	56                   	push   %esi
+  8014a6:	53                   	push   %ebx
+  8014a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014b7:	89 df                	mov    %ebx,%edi
+  8014b9:	89 de                	mov    %ebx,%esi
+  8014bb:	cd 30                	int    $0x30
+  8014bd:	5b                   	pop    %ebx
+  8014be:	5e                   	pop    %esi
+  8014bf:	5f                   	pop    %edi
+  8014c0:	5d                   	pop    %ebp
+  8014c1:	c3                   	ret
+
+008014c2 <sys_env_stats>:
+  8014c2:	55                   	push   %ebp
+  8014c3:	89 e5                	mov    %esp,%ebp
+  8014c5:	57                   	push   %edi
+  8014c6:	56                   	push   %esi
+  8014c7:	53                   	push   %ebx
+  8014c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d3:	b8 23 00 00 00       	mov    $0x23,%eax
+  8014d8:	89 df                	mov    %ebx,%edi
+  8014da:	89 de                	mov    %ebx,%esi
+  8014dc:	cd 30                	int    $0x30
+  8014de:	5b                   	pop    %ebx
+  8014df:	5e                   	pop    %esi
+  8014e0:	5f                   	pop    %edi
+  8014e1:	5d                   	pop    %ebp
+  8014e2:	c3                   	ret
+
+008014e3 <sys_trace>:
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	57                   	push   %edi
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f1:	b8 24 00 00 00       	mov    $0x24,%eax
+  8014f6:	89 cb                	mov    %ecx,%ebx
+  8014f8:	89 cf                	mov    %ecx,%edi
+  8014fa:	89 ce                	mov    %ecx,%esi
+  8014fc:	cd 30                	int    $0x30
+  8014fe:	5b                   	pop    %ebx
+  8014ff:	5e                   	pop    %esi
+  801500:	5f                   	pop    %edi
+  801501:	5d                   	pop    %ebp
+  801502:	c3                   	ret
+
+00801503 <sys_env_set_pager>:
+  801503:	55                   	push   %ebp
+  801504:	89 e5                	mov    %esp,%ebp
+  801506:	57                   	push   %edi
+  801507:	56                   	push   %esi
+  801508:	53                   	push   %ebx
+  801509:	83 ec 0c             	sub    $0xc,%esp
+  80150c:	be 00 00 00 00       	mov    $0x0,%esi
+  801511:	8b 55 08             	mov    0x8(%ebp),%edx
+  801514:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801517:	b8 25 00 00 00       	mov    $0x25,%eax
+  80151c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151f:	89 f7                	mov    %esi,%edi
+  801521:	cd 30                	int    $0x30
+  801523:	85 c0                	test   %eax,%eax
+  801525:	7f 08                	jg     80152f <sys_env_set_pager+0x2c>
+  801527:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152a:	5b                   	pop    %ebx
+  80152b:	5e                   	pop    %esi
+  80152c:	5f                   	pop    %edi
+  80152d:	5d                   	pop    %ebp
+  80152e:	c3                   	ret
+  80152f:	83 ec 0c             	sub    $0xc,%esp
+  801532:	50                   	push   %eax
+  801533:	6a 25                	push   $0x25
+  801535:	68 6b 3b 80 00       	push   $0x803b6b
+  80153a:	6a 24                	push   $0x24
+  80153c:	68 88 3b 80 00       	push   $0x803b88
+  801541:	e8 d2 1c 00 00       	call   803218 <_panic>
+
+00801546 <sys_pager_retire>:
+  801546:	55                   	push   %ebp
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	57                   	push   %edi
+  80154a:	56                   	push   %esi
+  80154b:	53                   	push   %ebx
+  80154c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801551:	8b 55 08             	mov    0x8(%ebp),%edx
+  801554:	b8 28 00 00 00       	mov    $0x28,%eax
+  801559:	89 cb                	mov    %ecx,%ebx
+  80155b:	89 cf                	mov    %ecx,%edi
+  80155d:	89 ce                	mov    %ecx,%esi
+  80155f:	cd 30                	int    $0x30
+  801561:	5b                   	pop    %ebx
+  801562:	5e                   	pop    %esi
+  801563:	5f                   	pop    %edi
+  801564:	5d                   	pop    %ebp
+  801565:	c3                   	ret
+
+00801566 <sys_prof>:
+  801566:	55                   	push   %ebp
+  801567:	89 e5                	mov    %esp,%ebp
+  801569:	57                   	push   %edi
+  80156a:	56                   	push   %esi
+  80156b:	53                   	push   %ebx
+  80156c:	be 00 00 00 00       	mov    $0x0,%esi
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801577:	b8 22 00 00 00       	mov    $0x22,%eax
+  80157c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157f:	89 f7                	mov    %esi,%edi
+  801581:	cd 30                	int    $0x30
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+
+00801588 <dupq_flush>:
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	53                   	push   %ebx
+  80158c:	83 ec 0c             	sub    $0xc,%esp
+  80158f:	8b 1d 00 50 80 00    	mov    0x805000,%ebx
+  801595:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80159c:	00 00 00 
+  80159f:	53                   	push   %ebx
+  8015a0:	68 00 00 40 00       	push   $0x400000
+  8015a5:	e8 f7 fe ff ff       	call   8014a1 <sys_batch>
+  8015aa:	83 c4 10             	add    $0x10,%esp
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	78 14                	js     8015c5 <dupq_flush+0x3d>
+  8015b1:	39 c3                	cmp    %eax,%ebx
+  8015b3:	7e 0b                	jle    8015c0 <dupq_flush+0x38>
+  8015b5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8015b8:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8015be:	eb 05                	jmp    8015c5 <dupq_flush+0x3d>
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c8:	c9                   	leave
+  8015c9:	c3                   	ret
+
+008015ca <pgfault>:
+  8015ca:	55                   	push   %ebp
+  8015cb:	89 e5                	mov    %esp,%ebp
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+  8015cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015d2:	8b 30                	mov    (%eax),%esi
+  8015d4:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8015d8:	0f 84 83 00 00 00    	je     801661 <pgfault+0x97>
+  8015de:	89 f0                	mov    %esi,%eax
+  8015e0:	c1 e8 0c             	shr    $0xc,%eax
+  8015e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ea:	f6 c4 08             	test   $0x8,%ah
+  8015ed:	0f 84 80 00 00 00    	je     801673 <pgfault+0xa9>
+  8015f3:	e8 b8 f6 ff ff       	call   800cb0 <sys_getenvid>
+  8015f8:	89 c3                	mov    %eax,%ebx
+  8015fa:	83 ec 04             	sub    $0x4,%esp
+  8015fd:	6a 07                	push   $0x7
+  8015ff:	68 00 f0 7f 00       	push   $0x7ff000
+  801604:	50                   	push   %eax
+  801605:	e8 10 f7 ff ff       	call   800d1a <sys_page_alloc>
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	78 74                	js     801685 <pgfault+0xbb>
+  801611:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801617:	83 ec 04             	sub    $0x4,%esp
+  80161a:	68 00 10 00 00       	push   $0x1000
+  80161f:	56                   	push   %esi
+  801620:	68 00 f0 7f 00       	push   $0x7ff000
+  801625:	e8 40 f4 ff ff       	call   800a6a <memmove>
+  80162a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801631:	56                   	push   %esi
+  801632:	53                   	push   %ebx
+  801633:	68 00 f0 7f 00       	push   $0x7ff000
+  801638:	53                   	push   %ebx
+  801639:	e8 1f f7 ff ff       	call   800d5d <sys_page_map>
+  80163e:	83 c4 20             	add    $0x20,%esp
+  801641:	85 c0                	test   %eax,%eax
+  801643:	78 54                	js     801699 <pgfault+0xcf>
+  801645:	83 ec 08             	sub    $0x8,%esp
+  801648:	68 00 f0 7f 00       	push   $0x7ff000
+  80164d:	53                   	push   %ebx
+  80164e:	e8 99 f7 ff ff       	call   800dec <sys_page_unmap>
+  801653:	83 c4 10             	add    $0x10,%esp
+  801656:	85 c0                	test   %eax,%eax
+  801658:	78 53                	js     8016ad <pgfault+0xe3>
+  80165a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80165d:	5b                   	pop    %ebx
+  80165e:	5e                   	pop    %esi
+  80165f:	5d                   	pop    %ebp
+  801660:	c3                   	ret
+  801661:	56                   	push   %esi
+  801662:	68 98 3b 80 00       	push   $0x803b98
+  801667:	6a 19                	push   $0x19
+  801669:	68 74 3c 80 00       	push   $0x803c74
+  80166e:	e8 a5 1b 00 00       	call   803218 <_panic>
+  801673:	56                   	push   %esi
+  801674:	68 cc 3b 80 00       	push   $0x803bcc
+  801679:	6a 1e                	push   $0x1e
+  80167b:	68 74 3c 80 00       	push   $0x803c74
+  801680:	e8 93 1b 00 00       	call   803218 <_panic>
+  801685:	83 ec 04             	sub    $0x4,%esp
+  801688:	68 00 3c 80 00       	push   $0x803c00
+  80168d:	6a 2e                	push   $0x2e
+  80168f:	68 74 3c 80 00       	push   $0x803c74
+  801694:	e8 7f 1b 00 00       	call   803218 <_panic>
+  801699:	83 ec 04             	sub    $0x4,%esp
+  80169c:	68 24 3c 80 00       	push   $0x803c24
+  8016a1:	6a 37                	push   $0x37
+  8016a3:	68 74 3c 80 00       	push   $0x803c74
+  8016a8:	e8 6b 1b 00 00       	call   803218 <_panic>
+  8016ad:	83 ec 04             	sub    $0x4,%esp
+  8016b0:	68 50 3c 80 00       	push   $0x803c50
+  8016b5:	6a 3c                	push   $0x3c
+  8016b7:	68 74 3c 80 00       	push   $0x803c74
+  8016bc:	e8 57 1b 00 00       	call   803218 <_panic>
+
+008016c1 <dupq_begin>:
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	83 ec 0c             	sub    $0xc,%esp
+  8016c7:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8016ce:	00 00 00 
+  8016d1:	6a 07                	push   $0x7
+  8016d3:	68 00 00 40 00       	push   $0x400000
+  8016d8:	6a 00                	push   $0x0
+  8016da:	e8 3b f6 ff ff       	call   800d1a <sys_page_alloc>
+  8016df:	c9                   	leave
+  8016e0:	c3                   	ret
+
+008016e1 <dupq_map>:
+  8016e1:	55                   	push   %ebp
+  8016e2:	89 e5                	mov    %esp,%ebp
+  8016e4:	83 ec 08             	sub    $0x8,%esp
+  8016e7:	81 3d 00 50 80 00 92 	cmpl   $0x92,0x805000
+  8016ee:	00 00 00 
+  8016f1:	74 46                	je     801739 <dupq_map+0x58>
+  8016f3:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8016f9:	8d 42 01             	lea    0x1(%edx),%eax
+  8016fc:	a3 00 50 80 00       	mov    %eax,0x805000
+  801701:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801704:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80170a:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801711:	00 00 00 
+  801714:	8b 55 08             	mov    0x8(%ebp),%edx
+  801717:	89 50 04             	mov    %edx,0x4(%eax)
+  80171a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171d:	c1 e2 0c             	shl    $0xc,%edx
+  801720:	89 50 08             	mov    %edx,0x8(%eax)
+  801723:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801726:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801729:	89 50 10             	mov    %edx,0x10(%eax)
+  80172c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80172f:	89 50 14             	mov    %edx,0x14(%eax)
+  801732:	b8 00 00 00 00       	mov    $0x0,%eax
+  801737:	c9                   	leave
+  801738:	c3                   	ret
+  801739:	e8 4a fe ff ff       	call   801588 <dupq_flush>
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	79 b1                	jns    8016f3 <dupq_map+0x12>
+  801742:	eb f3                	jmp    801737 <dupq_map+0x56>
+
+00801744 <dupq_end>:
+  801744:	55                   	push   %ebp
+  801745:	89 e5                	mov    %esp,%ebp
+  801747:	53                   	push   %ebx
+  801748:	83 ec 04             	sub    $0x4,%esp
+  80174b:	e8 38 fe ff ff       	call   801588 <dupq_flush>
+  801750:	89 c3                	mov    %eax,%ebx
+  801752:	83 ec 08             	sub    $0x8,%esp
+  801755:	68 00 00 40 00       	push   $0x400000
+  80175a:	6a 00                	push   $0x0
+  80175c:	e8 8b f6 ff ff       	call   800dec <sys_page_unmap>
+  801761:	89 d8                	mov    %ebx,%eax
+  801763:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+00801768 <fork>:
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	53                   	push   %ebx
+  80176c:	83 ec 10             	sub    $0x10,%esp
+  80176f:	68 ca 15 80 00       	push   $0x8015ca
+  801774:	e8 e5 1a 00 00       	call   80325e <set_pgfault_handler>
+  801779:	83 c4 08             	add    $0x8,%esp
+  80177c:	6a 01                	push   $0x1
+  80177e:	6a 00                	push   $0x0
+  801780:	e8 4c f7 ff ff       	call   800ed1 <sys_env_set_cow>
+  801785:	e8 a4 f6 ff ff       	call   800e2e <sys_fork>
+  80178a:	89 c3                	mov    %eax,%ebx
+  80178c:	83 c4 10             	add    $0x10,%esp
+  80178f:	85 c0                	test   %eax,%eax
+  801791:	74 07                	je     80179a <fork+0x32>
+  801793:	89 d8                	mov    %ebx,%eax
+  801795:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801798:	c9                   	leave
+  801799:	c3                   	ret
+  80179a:	e8 11 f5 ff ff       	call   800cb0 <sys_getenvid>
+  80179f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017a4:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8017aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017af:	a3 14 50 80 00       	mov    %eax,0x805014
+  8017b4:	eb dd                	jmp    801793 <fork+0x2b>
+
+008017b6 <sfork>:
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	57                   	push   %edi
+  8017ba:	56                   	push   %esi
+  8017bb:	53                   	push   %ebx
+  8017bc:	83 ec 1c             	sub    $0x1c,%esp
+  8017bf:	e8 ec f4 ff ff       	call   800cb0 <sys_getenvid>
+  8017c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017c7:	83 ec 0c             	sub    $0xc,%esp
+  8017ca:	68 ca 15 80 00       	push   $0x8015ca
+  8017cf:	e8 8a 1a 00 00       	call   80325e <set_pgfault_handler>
+  8017d4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017d9:	cd 30                	int    $0x30
+  8017db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	0f 88 45 02 00 00    	js     801a2e <sfork+0x278>
+  8017e9:	89 c6                	mov    %eax,%esi
+  8017eb:	74 17                	je     801804 <sfork+0x4e>
+  8017ed:	e8 cf fe ff ff       	call   8016c1 <dupq_begin>
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	0f 88 40 02 00 00    	js     801a3a <sfork+0x284>
+  8017fa:	bf 02 00 00 00       	mov    $0x2,%edi
+  8017ff:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801802:	eb 39                	jmp    80183d <sfork+0x87>
+  801804:	e8 a7 f4 ff ff       	call   800cb0 <sys_getenvid>
+  801809:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80180e:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801814:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801819:	a3 14 50 80 00       	mov    %eax,0x805014
+  80181e:	e9 23 01 00 00       	jmp    801946 <sfork+0x190>
+  801823:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80182a:	a8 01                	test   $0x1,%al
+  80182c:	75 5b                	jne    801889 <sfork+0xd3>
+  80182e:	83 c7 01             	add    $0x1,%edi
+  801831:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801837:	0f 84 40 01 00 00    	je     80197d <sfork+0x1c7>
+  80183d:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801844:	a8 01                	test   $0x1,%al
+  801846:	74 db                	je     801823 <sfork+0x6d>
+  801848:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80184f:	a8 80                	test   $0x80,%al
+  801851:	74 d0                	je     801823 <sfork+0x6d>
+  801853:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80185a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80185f:	0c 80                	or     $0x80,%al
+  801861:	50                   	push   %eax
+  801862:	ff 75 e4             	push   -0x1c(%ebp)
+  801865:	89 f8                	mov    %edi,%eax
+  801867:	c1 e0 16             	shl    $0x16,%eax
+  80186a:	c1 e8 0c             	shr    $0xc,%eax
+  80186d:	50                   	push   %eax
+  80186e:	ff 75 e0             	push   -0x20(%ebp)
+  801871:	e8 6b fe ff ff       	call   8016e1 <dupq_map>
+  801876:	83 c4 10             	add    $0x10,%esp
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	79 b1                	jns    80182e <sfork+0x78>
+  80187d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801884:	e9 bd 00 00 00       	jmp    801946 <sfork+0x190>
+  801889:	89 fe                	mov    %edi,%esi
+  80188b:	c1 e6 16             	shl    $0x16,%esi
+  80188e:	89 f0                	mov    %esi,%eax
+  801890:	c1 e8 0c             	shr    $0xc,%eax
+  801893:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801898:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80189b:	eb 57                	jmp    8018f4 <sfork+0x13e>
+  80189d:	e8 0e f4 ff ff       	call   800cb0 <sys_getenvid>
+  8018a2:	89 c7                	mov    %eax,%edi
+  8018a4:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  8018a9:	f6 c4 04             	test   $0x4,%ah
+  8018ac:	0f 85 9f 00 00 00    	jne    801951 <sfork+0x19b>
+  8018b2:	a9 02 08 00 00       	test   $0x802,%eax
+  8018b7:	0f 85 c5 01 00 00    	jne    801a82 <sfork+0x2cc>
+  8018bd:	6a 05                	push   $0x5
+  8018bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8018c2:	68 fd e7 0e 00       	push   $0xee7fd
+  8018c7:	57                   	push   %edi
+  8018c8:	e8 14 fe ff ff       	call   8016e1 <dupq_map>
+  8018cd:	83 c4 10             	add    $0x10,%esp
+  8018d0:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8018d6:	0f 84 91 00 00 00    	je     80196d <sfork+0x1b7>
+  8018dc:	89 f0                	mov    %esi,%eax
+  8018de:	09 d8                	or     %ebx,%eax
+  8018e0:	c1 e8 0c             	shr    $0xc,%eax
+  8018e3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018e9:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  8018ee:	0f 84 81 00 00 00    	je     801975 <sfork+0x1bf>
+  8018f4:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  8018f9:	74 a2                	je     80189d <sfork+0xe7>
+  8018fb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801902:	f6 c2 01             	test   $0x1,%dl
+  801905:	74 c9                	je     8018d0 <sfork+0x11a>
+  801907:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80190e:	f6 c6 02             	test   $0x2,%dh
+  801911:	75 bd                	jne    8018d0 <sfork+0x11a>
+  801913:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80191a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801921:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801927:	f7 d2                	not    %edx
+  801929:	21 ca                	and    %ecx,%edx
+  80192b:	52                   	push   %edx
+  80192c:	ff 75 e4             	push   -0x1c(%ebp)
+  80192f:	50                   	push   %eax
+  801930:	ff 75 e0             	push   -0x20(%ebp)
+  801933:	e8 a9 fd ff ff       	call   8016e1 <dupq_map>
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	79 91                	jns    8018d0 <sfork+0x11a>
+  80193f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801946:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194c:	5b                   	pop    %ebx
+  80194d:	5e                   	pop    %esi
+  80194e:	5f                   	pop    %edi
+  80194f:	5d                   	pop    %ebp
+  801950:	c3                   	ret
+  801951:	25 07 0e 00 00       	and    $0xe07,%eax
+  801956:	50                   	push   %eax
+  801957:	ff 75 e4             	push   -0x1c(%ebp)
+  80195a:	68 fd e7 0e 00       	push   $0xee7fd
+  80195f:	57                   	push   %edi
+  801960:	e8 7c fd ff ff       	call   8016e1 <dupq_map>
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	e9 63 ff ff ff       	jmp    8018d0 <sfork+0x11a>
+  80196d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801970:	e9 b9 fe ff ff       	jmp    80182e <sfork+0x78>
+  801975:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801978:	e9 b1 fe ff ff       	jmp    80182e <sfork+0x78>
+  80197d:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801980:	e8 bf fd ff ff       	call   801744 <dupq_end>
+  801985:	85 c0                	test   %eax,%eax
+  801987:	0f 88 b9 00 00 00    	js     801a46 <sfork+0x290>
+  80198d:	83 ec 04             	sub    $0x4,%esp
+  801990:	6a 07                	push   $0x7
+  801992:	68 00 f0 7f ee       	push   $0xee7ff000
+  801997:	56                   	push   %esi
+  801998:	e8 7d f3 ff ff       	call   800d1a <sys_page_alloc>
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	0f 88 aa 00 00 00    	js     801a52 <sfork+0x29c>
+  8019a8:	83 ec 0c             	sub    $0xc,%esp
+  8019ab:	6a 07                	push   $0x7
+  8019ad:	68 00 f0 7f 00       	push   $0x7ff000
+  8019b2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8019b5:	57                   	push   %edi
+  8019b6:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019bb:	56                   	push   %esi
+  8019bc:	e8 9c f3 ff ff       	call   800d5d <sys_page_map>
+  8019c1:	83 c4 20             	add    $0x20,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	0f 88 92 00 00 00    	js     801a5e <sfork+0x2a8>
+  8019cc:	83 ec 04             	sub    $0x4,%esp
+  8019cf:	68 00 10 00 00       	push   $0x1000
+  8019d4:	68 00 f0 7f 00       	push   $0x7ff000
+  8019d9:	68 00 f0 7f ee       	push   $0xee7ff000
+  8019de:	e8 87 f0 ff ff       	call   800a6a <memmove>
+  8019e3:	83 c4 08             	add    $0x8,%esp
+  8019e6:	68 00 f0 7f 00       	push   $0x7ff000
+  8019eb:	57                   	push   %edi
+  8019ec:	e8 fb f3 ff ff       	call   800dec <sys_page_unmap>
+  8019f1:	83 c4 10             	add    $0x10,%esp
+  8019f4:	85 c0                	test   %eax,%eax
+  8019f6:	78 72                	js     801a6a <sfork+0x2b4>
+  8019f8:	83 ec 08             	sub    $0x8,%esp
+  8019fb:	68 d6 32 80 00       	push   $0x8032d6
+  801a00:	56                   	push   %esi
+  801a01:	e8 2d f5 ff ff       	call   800f33 <sys_env_set_pgfault_upcall>
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	78 69                	js     801a76 <sfork+0x2c0>
+  801a0d:	83 ec 08             	sub    $0x8,%esp
+  801a10:	6a 02                	push   $0x2
+  801a12:	56                   	push   %esi
+  801a13:	e8 35 f4 ff ff       	call   800e4d <sys_env_set_status>
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a22:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801a26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a29:	e9 18 ff ff ff       	jmp    801946 <sfork+0x190>
+  801a2e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a35:	e9 0c ff ff ff       	jmp    801946 <sfork+0x190>
+  801a3a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a41:	e9 00 ff ff ff       	jmp    801946 <sfork+0x190>
+  801a46:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a4d:	e9 f4 fe ff ff       	jmp    801946 <sfork+0x190>
+  801a52:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a59:	e9 e8 fe ff ff       	jmp    801946 <sfork+0x190>
+  801a5e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a65:	e9 dc fe ff ff       	jmp    801946 <sfork+0x190>
+  801a6a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a71:	e9 d0 fe ff ff       	jmp    801946 <sfork+0x190>
+  801a76:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a7d:	e9 c4 fe ff ff       	jmp    801946 <sfork+0x190>
+  801a82:	68 05 08 00 00       	push   $0x805
+  801a87:	ff 75 e4             	push   -0x1c(%ebp)
+  801a8a:	68 fd e7 0e 00       	push   $0xee7fd
+  801a8f:	57                   	push   %edi
+  801a90:	e8 4c fc ff ff       	call   8016e1 <dupq_map>
+  801a95:	83 c4 10             	add    $0x10,%esp
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	0f 88 30 fe ff ff    	js     8018d0 <sfork+0x11a>
+  801aa0:	68 05 08 00 00       	push   $0x805
+  801aa5:	57                   	push   %edi
+  801aa6:	68 fd e7 0e 00       	push   $0xee7fd
+  801aab:	57                   	push   %edi
+  801aac:	e8 30 fc ff ff       	call   8016e1 <dupq_map>
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  801ab4:	e9 17 fe ff ff       	jmp    8018d0 <sfork+0x11a>
+
+00801ab9 <fd2num>:
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abf:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ac4:	c1 e8 0c             	shr    $0xc,%eax
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+
+00801ac9 <fd2data>:
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801acf:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ad4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ad9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801ade:	5d                   	pop    %ebp
+  801adf:	c3                   	ret
+
+00801ae0 <fd_alloc>:
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801ae8:	89 c2                	mov    %eax,%edx
+  801aea:	c1 ea 16             	shr    $0x16,%edx
+  801aed:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801af4:	f6 c2 01             	test   $0x1,%dl
+  801af7:	74 29                	je     801b22 <fd_alloc+0x42>
+  801af9:	89 c2                	mov    %eax,%edx
+  801afb:	c1 ea 0c             	shr    $0xc,%edx
+  801afe:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b05:	f6 c2 01             	test   $0x1,%dl
+  801b08:	74 18                	je     801b22 <fd_alloc+0x42>
+  801b0a:	05 00 10 00 00       	add    $0x1000,%eax
+  801b0f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801b14:	75 d2                	jne    801ae8 <fd_alloc+0x8>
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b20:	eb 05                	jmp    801b27 <fd_alloc+0x47>
+  801b22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b2a:	89 02                	mov    %eax,(%edx)
+  801b2c:	89 c8                	mov    %ecx,%eax
+  801b2e:	5d                   	pop    %ebp
+  801b2f:	c3                   	ret
+
+00801b30 <fd_lookup>:
+  801b30:	55                   	push   %ebp
+  801b31:	89 e5                	mov    %esp,%ebp
+  801b33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b36:	83 f8 1f             	cmp    $0x1f,%eax
+  801b39:	77 30                	ja     801b6b <fd_lookup+0x3b>
+  801b3b:	c1 e0 0c             	shl    $0xc,%eax
+  801b3e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801b43:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b49:	f6 c2 01             	test   $0x1,%dl
+  801b4c:	74 24                	je     801b72 <fd_lookup+0x42>
+  801b4e:	89 c2                	mov    %eax,%edx
+  801b50:	c1 ea 0c             	shr    $0xc,%edx
+  801b53:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b5a:	f6 c2 01             	test   $0x1,%dl
+  801b5d:	74 1a                	je     801b79 <fd_lookup+0x49>
+  801b5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b62:	89 02                	mov    %eax,(%edx)
+  801b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b69:	5d                   	pop    %ebp
+  801b6a:	c3                   	ret
+  801b6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b70:	eb f7                	jmp    801b69 <fd_lookup+0x39>
+  801b72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b77:	eb f0                	jmp    801b69 <fd_lookup+0x39>
+  801b79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7e:	eb e9                	jmp    801b69 <fd_lookup+0x39>
+
+00801b80 <dev_lookup>:
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	53                   	push   %ebx
+  801b84:	83 ec 04             	sub    $0x4,%esp
+  801b87:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8f:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801b94:	39 13                	cmp    %edx,(%ebx)
+  801b96:	74 37                	je     801bcf <dev_lookup+0x4f>
+  801b98:	83 c0 01             	add    $0x1,%eax
+  801b9b:	8b 1c 85 fc 3c 80 00 	mov    0x803cfc(,%eax,4),%ebx
+  801ba2:	85 db                	test   %ebx,%ebx
+  801ba4:	75 ee                	jne    801b94 <dev_lookup+0x14>
+  801ba6:	a1 14 50 80 00       	mov    0x805014,%eax
+  801bab:	8b 40 48             	mov    0x48(%eax),%eax
+  801bae:	83 ec 04             	sub    $0x4,%esp
+  801bb1:	52                   	push   %edx
+  801bb2:	50                   	push   %eax
+  801bb3:	68 80 3c 80 00       	push   $0x803c80
+  801bb8:	e8 06 e6 ff ff       	call   8001c3 <cprintf>
+  801bbd:	83 c4 10             	add    $0x10,%esp
+  801bc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bc8:	89 1a                	mov    %ebx,(%edx)
+  801bca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bcd:	c9                   	leave
+  801bce:	c3                   	ret
+  801bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd4:	eb ef                	jmp    801bc5 <dev_lookup+0x45>
+
+00801bd6 <fd_close>:
+  801bd6:	55                   	push   %ebp
+  801bd7:	89 e5                	mov    %esp,%ebp
+  801bd9:	57                   	push   %edi
+  801bda:	56                   	push   %esi
+  801bdb:	53                   	push   %ebx
+  801bdc:	83 ec 24             	sub    $0x24,%esp
+  801bdf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801be2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801be5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801be8:	50                   	push   %eax
+  801be9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801bef:	c1 e8 0c             	shr    $0xc,%eax
+  801bf2:	50                   	push   %eax
+  801bf3:	e8 38 ff ff ff       	call   801b30 <fd_lookup>
+  801bf8:	89 c3                	mov    %eax,%ebx
+  801bfa:	83 c4 10             	add    $0x10,%esp
+  801bfd:	85 c0                	test   %eax,%eax
+  801bff:	78 05                	js     801c06 <fd_close+0x30>
+  801c01:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c04:	74 0f                	je     801c15 <fd_close+0x3f>
+  801c06:	85 ff                	test   %edi,%edi
+  801c08:	0f 44 df             	cmove  %edi,%ebx
+  801c0b:	89 d8                	mov    %ebx,%eax
+  801c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c10:	5b                   	pop    %ebx
+  801c11:	5e                   	pop    %esi
+  801c12:	5f                   	pop    %edi
+  801c13:	5d                   	pop    %ebp
+  801c14:	c3                   	ret
+  801c15:	83 ec 08             	sub    $0x8,%esp
+  801c18:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c1b:	50                   	push   %eax
+  801c1c:	ff 36                	push   (%esi)
+  801c1e:	e8 5d ff ff ff       	call   801b80 <dev_lookup>
+  801c23:	89 c3                	mov    %eax,%ebx
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	78 1a                	js     801c46 <fd_close+0x70>
+  801c2c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c2f:	8b 40 10             	mov    0x10(%eax),%eax
+  801c32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	74 0b                	je     801c46 <fd_close+0x70>
+  801c3b:	83 ec 0c             	sub    $0xc,%esp
+  801c3e:	56                   	push   %esi
+  801c3f:	ff d0                	call   *%eax
+  801c41:	89 c3                	mov    %eax,%ebx
+  801c43:	83 c4 10             	add    $0x10,%esp
+  801c46:	83 ec 08             	sub    $0x8,%esp
+  801c49:	56                   	push   %esi
+  801c4a:	6a 00                	push   $0x0
+  801c4c:	e8 9b f1 ff ff       	call   800dec <sys_page_unmap>
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	eb b5                	jmp    801c0b <fd_close+0x35>
+
+00801c56 <close>:
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	83 ec 20             	sub    $0x20,%esp
+  801c5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c5f:	50                   	push   %eax
+  801c60:	ff 75 08             	push   0x8(%ebp)
+  801c63:	e8 c8 fe ff ff       	call   801b30 <fd_lookup>
+  801c68:	83 c4 10             	add    $0x10,%esp
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	79 02                	jns    801c71 <close+0x1b>
+  801c6f:	c9                   	leave
+  801c70:	c3                   	ret
+  801c71:	83 ec 08             	sub    $0x8,%esp
+  801c74:	6a 01                	push   $0x1
+  801c76:	ff 75 f4             	push   -0xc(%ebp)
+  801c79:	e8 58 ff ff ff       	call   801bd6 <fd_close>
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	eb ec                	jmp    801c6f <close+0x19>
+
+00801c83 <close_all>:
+  801c83:	55                   	push   %ebp
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	53                   	push   %ebx
+  801c87:	83 ec 04             	sub    $0x4,%esp
+  801c8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+  801c92:	53                   	push   %ebx
+  801c93:	e8 be ff ff ff       	call   801c56 <close>
+  801c98:	83 c3 01             	add    $0x1,%ebx
+  801c9b:	83 c4 10             	add    $0x10,%esp
+  801c9e:	83 fb 20             	cmp    $0x20,%ebx
+  801ca1:	75 ec                	jne    801c8f <close_all+0xc>
+  801ca3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca6:	c9                   	leave
+  801ca7:	c3                   	ret
+
+00801ca8 <dup>:
+  801ca8:	55                   	push   %ebp
+  801ca9:	89 e5                	mov    %esp,%ebp
+  801cab:	57                   	push   %edi
+  801cac:	56                   	push   %esi
+  801cad:	53                   	push   %ebx
+  801cae:	83 ec 34             	sub    $0x34,%esp
+  801cb1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cb4:	50                   	push   %eax
+  801cb5:	ff 75 08             	push   0x8(%ebp)
+  801cb8:	e8 73 fe ff ff       	call   801b30 <fd_lookup>
+  801cbd:	89 c3                	mov    %eax,%ebx
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 7f                	js     801d45 <dup+0x9d>
+  801cc6:	83 ec 0c             	sub    $0xc,%esp
+  801cc9:	ff 75 0c             	push   0xc(%ebp)
+  801ccc:	e8 85 ff ff ff       	call   801c56 <close>
+  801cd1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801cd4:	c1 e6 0c             	shl    $0xc,%esi
+  801cd7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801cdd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ce0:	89 3c 24             	mov    %edi,(%esp)
+  801ce3:	e8 e1 fd ff ff       	call   801ac9 <fd2data>
+  801ce8:	89 c3                	mov    %eax,%ebx
+  801cea:	89 34 24             	mov    %esi,(%esp)
+  801ced:	e8 d7 fd ff ff       	call   801ac9 <fd2data>
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801cf8:	89 d8                	mov    %ebx,%eax
+  801cfa:	c1 e8 16             	shr    $0x16,%eax
+  801cfd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d04:	a8 01                	test   $0x1,%al
+  801d06:	74 11                	je     801d19 <dup+0x71>
+  801d08:	89 d8                	mov    %ebx,%eax
+  801d0a:	c1 e8 0c             	shr    $0xc,%eax
+  801d0d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d14:	f6 c2 01             	test   $0x1,%dl
+  801d17:	75 36                	jne    801d4f <dup+0xa7>
+  801d19:	89 f8                	mov    %edi,%eax
+  801d1b:	c1 e8 0c             	shr    $0xc,%eax
+  801d1e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d25:	83 ec 0c             	sub    $0xc,%esp
+  801d28:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d2d:	50                   	push   %eax
+  801d2e:	56                   	push   %esi
+  801d2f:	6a 00                	push   $0x0
+  801d31:	57                   	push   %edi
+  801d32:	6a 00                	push   $0x0
+  801d34:	e8 24 f0 ff ff       	call   800d5d <sys_page_map>
+  801d39:	89 c3                	mov    %eax,%ebx
+  801d3b:	83 c4 20             	add    $0x20,%esp
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 33                	js     801d75 <dup+0xcd>
+  801d42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d45:	89 d8                	mov    %ebx,%eax
+  801d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d4a:	5b                   	pop    %ebx
+  801d4b:	5e                   	pop    %esi
+  801d4c:	5f                   	pop    %edi
+  801d4d:	5d                   	pop    %ebp
+  801d4e:	c3                   	ret
+  801d4f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d56:	83 ec 0c             	sub    $0xc,%esp
+  801d59:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d5e:	50                   	push   %eax
+  801d5f:	ff 75 d4             	push   -0x2c(%ebp)
+  801d62:	6a 00                	push   $0x0
+  801d64:	53                   	push   %ebx
+  801d65:	6a 00                	push   $0x0
+  801d67:	e8 f1 ef ff ff       	call   800d5d <sys_page_map>
+  801d6c:	89 c3                	mov    %eax,%ebx
+  801d6e:	83 c4 20             	add    $0x20,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	79 a4                	jns    801d19 <dup+0x71>
+  801d75:	83 ec 08             	sub    $0x8,%esp
+  801d78:	56                   	push   %esi
+  801d79:	6a 00                	push   $0x0
+  801d7b:	e8 6c f0 ff ff       	call   800dec <sys_page_unmap>
+  801d80:	83 c4 08             	add    $0x8,%esp
+  801d83:	ff 75 d4             	push   -0x2c(%ebp)
+  801d86:	6a 00                	push   $0x0
+  801d88:	e8 5f f0 ff ff       	call   800dec <sys_page_unmap>
+  801d8d:	83 c4 10             	add    $0x10,%esp
+  801d90:	eb b3                	jmp    801d45 <dup+0x9d>
+
+00801d92 <read>:
+  801d92:	55                   	push   %ebp
+  801d93:	89 e5                	mov    %esp,%ebp
+  801d95:	56                   	push   %esi
+  801d96:	53                   	push   %ebx
+  801d97:	83 ec 18             	sub    $0x18,%esp
+  801d9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801da0:	50                   	push   %eax
+  801da1:	56                   	push   %esi
+  801da2:	e8 89 fd ff ff       	call   801b30 <fd_lookup>
+  801da7:	83 c4 10             	add    $0x10,%esp
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 3c                	js     801dea <read+0x58>
+  801dae:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801db1:	83 ec 08             	sub    $0x8,%esp
+  801db4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db7:	50                   	push   %eax
+  801db8:	ff 33                	push   (%ebx)
+  801dba:	e8 c1 fd ff ff       	call   801b80 <dev_lookup>
+  801dbf:	83 c4 10             	add    $0x10,%esp
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	78 24                	js     801dea <read+0x58>
+  801dc6:	8b 43 08             	mov    0x8(%ebx),%eax
+  801dc9:	83 e0 03             	and    $0x3,%eax
+  801dcc:	83 f8 01             	cmp    $0x1,%eax
+  801dcf:	74 20                	je     801df1 <read+0x5f>
+  801dd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd4:	8b 40 08             	mov    0x8(%eax),%eax
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	74 37                	je     801e12 <read+0x80>
+  801ddb:	83 ec 04             	sub    $0x4,%esp
+  801dde:	ff 75 10             	push   0x10(%ebp)
+  801de1:	ff 75 0c             	push   0xc(%ebp)
+  801de4:	53                   	push   %ebx
+  801de5:	ff d0                	call   *%eax
+  801de7:	83 c4 10             	add    $0x10,%esp
+  801dea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ded:	5b                   	pop    %ebx
+  801dee:	5e                   	pop    %esi
+  801def:	5d                   	pop    %ebp
+  801df0:	c3                   	ret
+  801df1:	a1 14 50 80 00       	mov    0x805014,%eax
+  801df6:	8b 40 48             	mov    0x48(%eax),%eax
+  801df9:	83 ec 04             	sub    $0x4,%esp
+  801dfc:	56                   	push   %esi
+  801dfd:	50                   	push   %eax
+  801dfe:	68 c1 3c 80 00       	push   $0x803cc1
+  801e03:	e8 bb e3 ff ff       	call   8001c3 <cprintf>
+  801e08:	83 c4 10             	add    $0x10,%esp
+  801e0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e10:	eb d8                	jmp    801dea <read+0x58>
+  801e12:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e17:	eb d1                	jmp    801dea <read+0x58>
+
+00801e19 <readn>:
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	57                   	push   %edi
+  801e1d:	56                   	push   %esi
+  801e1e:	53                   	push   %ebx
+  801e1f:	83 ec 0c             	sub    $0xc,%esp
+  801e22:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e25:	8b 75 10             	mov    0x10(%ebp),%esi
+  801e28:	85 f6                	test   %esi,%esi
+  801e2a:	74 30                	je     801e5c <readn+0x43>
+  801e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e36:	83 ec 04             	sub    $0x4,%esp
+  801e39:	89 f2                	mov    %esi,%edx
+  801e3b:	29 c2                	sub    %eax,%edx
+  801e3d:	52                   	push   %edx
+  801e3e:	01 f8                	add    %edi,%eax
+  801e40:	50                   	push   %eax
+  801e41:	ff 75 08             	push   0x8(%ebp)
+  801e44:	e8 49 ff ff ff       	call   801d92 <read>
+  801e49:	83 c4 10             	add    $0x10,%esp
+  801e4c:	85 c0                	test   %eax,%eax
+  801e4e:	78 15                	js     801e65 <readn+0x4c>
+  801e50:	74 11                	je     801e63 <readn+0x4a>
+  801e52:	01 c3                	add    %eax,%ebx
+  801e54:	89 d8                	mov    %ebx,%eax
+  801e56:	39 f3                	cmp    %esi,%ebx
+  801e58:	72 dc                	jb     801e36 <readn+0x1d>
+  801e5a:	eb 09                	jmp    801e65 <readn+0x4c>
+  801e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e61:	eb 02                	jmp    801e65 <readn+0x4c>
+  801e63:	89 d8                	mov    %ebx,%eax
+  801e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e68:	5b                   	pop    %ebx
+  801e69:	5e                   	pop    %esi
+  801e6a:	5f                   	pop    %edi
+  801e6b:	5d                   	pop    %ebp
+  801e6c:	c3                   	ret
+
+00801e6d <write>:
+  801e6d:	55                   	push   %ebp
+  801e6e:	89 e5                	mov    %esp,%ebp
+  801e70:	56                   	push   %esi
+  801e71:	53                   	push   %ebx
+  801e72:	83 ec 18             	sub    $0x18,%esp
+  801e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e7b:	50                   	push   %eax
+  801e7c:	53                   	push   %ebx
+  801e7d:	e8 ae fc ff ff       	call   801b30 <fd_lookup>
+  801e82:	83 c4 10             	add    $0x10,%esp
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	78 37                	js     801ec0 <write+0x53>
+  801e89:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e8c:	83 ec 08             	sub    $0x8,%esp
+  801e8f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e92:	50                   	push   %eax
+  801e93:	ff 36                	push   (%esi)
+  801e95:	e8 e6 fc ff ff       	call   801b80 <dev_lookup>
+  801e9a:	83 c4 10             	add    $0x10,%esp
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 1f                	js     801ec0 <write+0x53>
+  801ea1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ea5:	74 20                	je     801ec7 <write+0x5a>
+  801ea7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eaa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ead:	85 c0                	test   %eax,%eax
+  801eaf:	74 37                	je     801ee8 <write+0x7b>
+  801eb1:	83 ec 04             	sub    $0x4,%esp
+  801eb4:	ff 75 10             	push   0x10(%ebp)
+  801eb7:	ff 75 0c             	push   0xc(%ebp)
+  801eba:	56                   	push   %esi
+  801ebb:	ff d0                	call   *%eax
+  801ebd:	83 c4 10             	add    $0x10,%esp
+  801ec0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec3:	5b                   	pop    %ebx
+  801ec4:	5e                   	pop    %esi
+  801ec5:	5d                   	pop    %ebp
+  801ec6:	c3                   	ret
+  801ec7:	a1 14 50 80 00       	mov    0x805014,%eax
+  801ecc:	8b 40 48             	mov    0x48(%eax),%eax
+  801ecf:	83 ec 04             	sub    $0x4,%esp
+  801ed2:	53                   	push   %ebx
+  801ed3:	50                   	push   %eax
+  801ed4:	68 dd 3c 80 00       	push   $0x803cdd
+  801ed9:	e8 e5 e2 ff ff       	call   8001c3 <cprintf>
+  801ede:	83 c4 10             	add    $0x10,%esp
+  801ee1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee6:	eb d8                	jmp    801ec0 <write+0x53>
+  801ee8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eed:	eb d1                	jmp    801ec0 <write+0x53>
+
+00801eef <seek>:
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	83 ec 20             	sub    $0x20,%esp
+  801ef5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef8:	50                   	push   %eax
+  801ef9:	ff 75 08             	push   0x8(%ebp)
+  801efc:	e8 2f fc ff ff       	call   801b30 <fd_lookup>
+  801f01:	83 c4 10             	add    $0x10,%esp
+  801f04:	85 c0                	test   %eax,%eax
+  801f06:	78 0e                	js     801f16 <seek+0x27>
+  801f08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f0e:	89 50 04             	mov    %edx,0x4(%eax)
+  801f11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+
+00801f18 <ftruncate>:
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	56                   	push   %esi
+  801f1c:	53                   	push   %ebx
+  801f1d:	83 ec 18             	sub    $0x18,%esp
+  801f20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f23:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f26:	50                   	push   %eax
+  801f27:	53                   	push   %ebx
+  801f28:	e8 03 fc ff ff       	call   801b30 <fd_lookup>
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	78 34                	js     801f68 <ftruncate+0x50>
+  801f34:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f37:	83 ec 08             	sub    $0x8,%esp
+  801f3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f3d:	50                   	push   %eax
+  801f3e:	ff 36                	push   (%esi)
+  801f40:	e8 3b fc ff ff       	call   801b80 <dev_lookup>
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 1c                	js     801f68 <ftruncate+0x50>
+  801f4c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f50:	74 1d                	je     801f6f <ftruncate+0x57>
+  801f52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f55:	8b 40 18             	mov    0x18(%eax),%eax
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	74 34                	je     801f90 <ftruncate+0x78>
+  801f5c:	83 ec 08             	sub    $0x8,%esp
+  801f5f:	ff 75 0c             	push   0xc(%ebp)
+  801f62:	56                   	push   %esi
+  801f63:	ff d0                	call   *%eax
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f6b:	5b                   	pop    %ebx
+  801f6c:	5e                   	pop    %esi
+  801f6d:	5d                   	pop    %ebp
+  801f6e:	c3                   	ret
+  801f6f:	a1 14 50 80 00       	mov    0x805014,%eax
+  801f74:	8b 40 48             	mov    0x48(%eax),%eax
+  801f77:	83 ec 04             	sub    $0x4,%esp
+  801f7a:	53                   	push   %ebx
+  801f7b:	50                   	push   %eax
+  801f7c:	68 a0 3c 80 00       	push   $0x803ca0
+  801f81:	e8 3d e2 ff ff       	call   8001c3 <cprintf>
+  801f86:	83 c4 10             	add    $0x10,%esp
+  801f89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f8e:	eb d8                	jmp    801f68 <ftruncate+0x50>
+  801f90:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f95:	eb d1                	jmp    801f68 <ftruncate+0x50>
+
+00801f97 <fstat>:
+  801f97:	55                   	push   %ebp
+  801f98:	89 e5                	mov    %esp,%ebp
+  801f9a:	56                   	push   %esi
+  801f9b:	53                   	push   %ebx
+  801f9c:	83 ec 18             	sub    $0x18,%esp
+  801f9f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fa2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fa5:	50                   	push   %eax
+  801fa6:	ff 75 08             	push   0x8(%ebp)
+  801fa9:	e8 82 fb ff ff       	call   801b30 <fd_lookup>
+  801fae:	83 c4 10             	add    $0x10,%esp
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	78 49                	js     801ffe <fstat+0x67>
+  801fb5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fb8:	83 ec 08             	sub    $0x8,%esp
+  801fbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fbe:	50                   	push   %eax
+  801fbf:	ff 36                	push   (%esi)
+  801fc1:	e8 ba fb ff ff       	call   801b80 <dev_lookup>
+  801fc6:	83 c4 10             	add    $0x10,%esp
+  801fc9:	85 c0                	test   %eax,%eax
+  801fcb:	78 31                	js     801ffe <fstat+0x67>
+  801fcd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fd0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801fd4:	74 2f                	je     802005 <fstat+0x6e>
+  801fd6:	c6 03 00             	movb   $0x0,(%ebx)
+  801fd9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801fe0:	00 00 00 
+  801fe3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fea:	00 00 00 
+  801fed:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801ff3:	83 ec 08             	sub    $0x8,%esp
+  801ff6:	53                   	push   %ebx
+  801ff7:	56                   	push   %esi
+  801ff8:	ff 50 14             	call   *0x14(%eax)
+  801ffb:	83 c4 10             	add    $0x10,%esp
+  801ffe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802001:	5b                   	pop    %ebx
+  802002:	5e                   	pop    %esi
+  802003:	5d                   	pop    %ebp
+  802004:	c3                   	ret
+  802005:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80200a:	eb f2                	jmp    801ffe <fstat+0x67>
+
+0080200c <stat>:
+  80200c:	55                   	push   %ebp
+  80200d:	89 e5                	mov    %esp,%ebp
+  80200f:	56                   	push   %esi
+  802010:	53                   	push   %ebx
+  802011:	83 ec 08             	sub    $0x8,%esp
+  802014:	6a 00                	push   $0x0
+  802016:	ff 75 08             	push   0x8(%ebp)
+  802019:	e8 31 05 00 00       	call   80254f <open>
+  80201e:	89 c3                	mov    %eax,%ebx
+  802020:	83 c4 10             	add    $0x10,%esp
+  802023:	85 c0                	test   %eax,%eax
+  802025:	78 1b                	js     802042 <stat+0x36>
+  802027:	83 ec 08             	sub    $0x8,%esp
+  80202a:	ff 75 0c             	push   0xc(%ebp)
+  80202d:	50                   	push   %eax
+  80202e:	e8 64 ff ff ff       	call   801f97 <fstat>
+  802033:	89 c6                	mov    %eax,%esi
+  802035:	89 1c 24             	mov    %ebx,(%esp)
+  802038:	e8 19 fc ff ff       	call   801c56 <close>
+  80203d:	83 c4 10             	add    $0x10,%esp
+  802040:	89 f3                	mov    %esi,%ebx
+  802042:	89 d8                	mov    %ebx,%eax
+  802044:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802047:	5b                   	pop    %ebx
+  802048:	5e                   	pop    %esi
+  802049:	5d                   	pop    %ebp
+  80204a:	c3                   	ret
+
+0080204b <fsipc>:
+  80204b:	55                   	push   %ebp
+  80204c:	89 e5                	mov    %esp,%ebp
+  80204e:	56                   	push   %esi
+  80204f:	53                   	push   %ebx
+  802050:	89 c3                	mov    %eax,%ebx
+  802052:	89 d6                	mov    %edx,%esi
+  802054:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  80205b:	74 20                	je     80207d <fsipc+0x32>
+  80205d:	83 ec 08             	sub    $0x8,%esp
+  802060:	6a 00                	push   $0x0
+  802062:	56                   	push   %esi
+  802063:	6a 07                	push   $0x7
+  802065:	68 00 60 80 00       	push   $0x806000
+  80206a:	53                   	push   %ebx
+  80206b:	ff 35 0c 50 80 00    	push   0x80500c
+  802071:	e8 43 13 00 00       	call   8033b9 <ipc_call>
+  802076:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802079:	5b                   	pop    %ebx
+  80207a:	5e                   	pop    %esi
+  80207b:	5d                   	pop    %ebp
+  80207c:	c3                   	ret
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	6a 02                	push   $0x2
+  802082:	e8 cd 14 00 00       	call   803554 <ipc_find_env>
+  802087:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80208c:	83 c4 10             	add    $0x10,%esp
+  80208f:	eb cc                	jmp    80205d <fsipc+0x12>
+
+00802091 <devfile_trunc>:
+  802091:	55                   	push   %ebp
+  802092:	89 e5                	mov    %esp,%ebp
+  802094:	83 ec 08             	sub    $0x8,%esp
+  802097:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80209d:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a5:	a3 04 60 80 00       	mov    %eax,0x806004
+  8020aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020af:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020b4:	e8 92 ff ff ff       	call   80204b <fsipc>
+  8020b9:	c9                   	leave
+  8020ba:	c3                   	ret
+
+008020bb <devfile_flush>:
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	83 ec 08             	sub    $0x8,%esp
+  8020c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020c7:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020d6:	e8 70 ff ff ff       	call   80204b <fsipc>
+  8020db:	c9                   	leave
+  8020dc:	c3                   	ret
+
+008020dd <devfile_stat>:
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	53                   	push   %ebx
+  8020e1:	83 ec 04             	sub    $0x4,%esp
+  8020e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ea:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020ed:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020fc:	e8 4a ff ff ff       	call   80204b <fsipc>
+  802101:	85 c0                	test   %eax,%eax
+  802103:	78 2c                	js     802131 <devfile_stat+0x54>
+  802105:	83 ec 08             	sub    $0x8,%esp
+  802108:	68 00 60 80 00       	push   $0x806000
+  80210d:	53                   	push   %ebx
+  80210e:	e8 a7 e7 ff ff       	call   8008ba <strcpy>
+  802113:	a1 80 60 80 00       	mov    0x806080,%eax
+  802118:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80211e:	a1 84 60 80 00       	mov    0x806084,%eax
+  802123:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802134:	c9                   	leave
+  802135:	c3                   	ret
+
+00802136 <fsring_rw>:
+  802136:	55                   	push   %ebp
+  802137:	89 e5                	mov    %esp,%ebp
+  802139:	57                   	push   %edi
+  80213a:	56                   	push   %esi
+  80213b:	53                   	push   %ebx
+  80213c:	83 ec 2c             	sub    $0x2c,%esp
+  80213f:	89 c7                	mov    %eax,%edi
+  802141:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802144:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802147:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80214c:	a8 01                	test   $0x1,%al
+  80214e:	74 0d                	je     80215d <fsring_rw+0x27>
+  802150:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802155:	a8 01                	test   $0x1,%al
+  802157:	0f 85 d5 00 00 00    	jne    802232 <fsring_rw+0xfc>
+  80215d:	a1 14 50 80 00       	mov    0x805014,%eax
+  802162:	8b 40 48             	mov    0x48(%eax),%eax
+  802165:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  80216b:	0f 84 fc 00 00 00    	je     80226d <fsring_rw+0x137>
+  802171:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802178:	0f 84 02 01 00 00    	je     802280 <fsring_rw+0x14a>
+  80217e:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802183:	83 ec 04             	sub    $0x4,%esp
+  802186:	68 07 02 00 00       	push   $0x207
+  80218b:	53                   	push   %ebx
+  80218c:	6a 00                	push   $0x0
+  80218e:	e8 87 eb ff ff       	call   800d1a <sys_page_alloc>
+  802193:	83 c4 10             	add    $0x10,%esp
+  802196:	85 c0                	test   %eax,%eax
+  802198:	0f 88 f9 00 00 00    	js     802297 <fsring_rw+0x161>
+  80219e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021a4:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8021aa:	75 d7                	jne    802183 <fsring_rw+0x4d>
+  8021ac:	6a 0e                	push   $0xe
+  8021ae:	6a 0d                	push   $0xd
+  8021b0:	ff 35 0c 50 80 00    	push   0x80500c
+  8021b6:	68 00 00 f0 cf       	push   $0xcff00000
+  8021bb:	e8 c4 0c 00 00       	call   802e84 <ipcring_init>
+  8021c0:	83 c4 08             	add    $0x8,%esp
+  8021c3:	6a 00                	push   $0x0
+  8021c5:	6a 00                	push   $0x0
+  8021c7:	68 07 02 00 00       	push   $0x207
+  8021cc:	68 00 00 f0 cf       	push   $0xcff00000
+  8021d1:	6a 0b                	push   $0xb
+  8021d3:	ff 35 0c 50 80 00    	push   0x80500c
+  8021d9:	e8 db 11 00 00       	call   8033b9 <ipc_call>
+  8021de:	89 c6                	mov    %eax,%esi
+  8021e0:	83 c4 20             	add    $0x20,%esp
+  8021e3:	85 c0                	test   %eax,%eax
+  8021e5:	0f 88 ac 00 00 00    	js     802297 <fsring_rw+0x161>
+  8021eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021f0:	89 d9                	mov    %ebx,%ecx
+  8021f2:	83 c3 01             	add    $0x1,%ebx
+  8021f5:	89 da                	mov    %ebx,%edx
+  8021f7:	c1 e2 0c             	shl    $0xc,%edx
+  8021fa:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802200:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802206:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80220c:	83 ec 08             	sub    $0x8,%esp
+  80220f:	6a 00                	push   $0x0
+  802211:	6a 00                	push   $0x0
+  802213:	68 07 02 00 00       	push   $0x207
+  802218:	50                   	push   %eax
+  802219:	6a 0c                	push   $0xc
+  80221b:	ff 35 0c 50 80 00    	push   0x80500c
+  802221:	e8 93 11 00 00       	call   8033b9 <ipc_call>
+  802226:	83 c4 20             	add    $0x20,%esp
+  802229:	85 c0                	test   %eax,%eax
+  80222b:	78 6a                	js     802297 <fsring_rw+0x161>
+  80222d:	83 fb 08             	cmp    $0x8,%ebx
+  802230:	75 be                	jne    8021f0 <fsring_rw+0xba>
+  802232:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802236:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80223b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802240:	0f 45 c2             	cmovne %edx,%eax
+  802243:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802246:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80224d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802254:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  80225b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802260:	be 00 00 00 00       	mov    $0x0,%esi
+  802265:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802268:	e9 4b 01 00 00       	jmp    8023b8 <fsring_rw+0x282>
+  80226d:	e8 72 ee ff ff       	call   8010e4 <sys_time_msec>
+  802272:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  802278:	0f 89 f3 fe ff ff    	jns    802171 <fsring_rw+0x3b>
+  80227e:	eb 54                	jmp    8022d4 <fsring_rw+0x19e>
+  802280:	83 ec 0c             	sub    $0xc,%esp
+  802283:	6a 02                	push   $0x2
+  802285:	e8 ca 12 00 00       	call   803554 <ipc_find_env>
+  80228a:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	e9 e7 fe ff ff       	jmp    80217e <fsring_rw+0x48>
+  802297:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80229c:	83 ec 08             	sub    $0x8,%esp
+  80229f:	53                   	push   %ebx
+  8022a0:	6a 00                	push   $0x0
+  8022a2:	e8 45 eb ff ff       	call   800dec <sys_page_unmap>
+  8022a7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022ad:	83 c4 10             	add    $0x10,%esp
+  8022b0:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8022b6:	75 e4                	jne    80229c <fsring_rw+0x166>
+  8022b8:	e8 27 ee ff ff       	call   8010e4 <sys_time_msec>
+  8022bd:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8022c2:	a3 04 50 80 00       	mov    %eax,0x805004
+  8022c7:	a1 14 50 80 00       	mov    0x805014,%eax
+  8022cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8022cf:	a3 08 50 80 00       	mov    %eax,0x805008
+  8022d4:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8022db:	e9 7a 01 00 00       	jmp    80245a <fsring_rw+0x324>
+  8022e0:	8b 57 0c             	mov    0xc(%edi),%edx
+  8022e3:	89 10                	mov    %edx,(%eax)
+  8022e5:	89 58 04             	mov    %ebx,0x4(%eax)
+  8022e8:	89 f2                	mov    %esi,%edx
+  8022ea:	03 57 04             	add    0x4(%edi),%edx
+  8022ed:	89 50 08             	mov    %edx,0x8(%eax)
+  8022f0:	83 ec 04             	sub    $0x4,%esp
+  8022f3:	53                   	push   %ebx
+  8022f4:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8022f7:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8022fa:	52                   	push   %edx
+  8022fb:	83 c0 0c             	add    $0xc,%eax
+  8022fe:	50                   	push   %eax
+  8022ff:	e8 66 e7 ff ff       	call   800a6a <memmove>
+  802304:	83 c4 10             	add    $0x10,%esp
+  802307:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80230a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80230d:	89 08                	mov    %ecx,(%eax)
+  80230f:	83 ec 0c             	sub    $0xc,%esp
+  802312:	68 00 00 f0 cf       	push   $0xcff00000
+  802317:	e8 c6 0b 00 00       	call   802ee2 <ipcring_req_push>
+  80231c:	01 de                	add    %ebx,%esi
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802324:	73 4c                	jae    802372 <fsring_rw+0x23c>
+  802326:	83 ec 0c             	sub    $0xc,%esp
+  802329:	68 00 00 f0 cf       	push   $0xcff00000
+  80232e:	e8 89 0b 00 00       	call   802ebc <ipcring_req_slot>
+  802333:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	74 35                	je     802372 <fsring_rw+0x23c>
+  80233d:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802342:	83 e0 07             	and    $0x7,%eax
+  802345:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80234a:	c1 e0 0c             	shl    $0xc,%eax
+  80234d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802350:	29 f3                	sub    %esi,%ebx
+  802352:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802355:	39 cb                	cmp    %ecx,%ebx
+  802357:	0f 47 d9             	cmova  %ecx,%ebx
+  80235a:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80235e:	75 80                	jne    8022e0 <fsring_rw+0x1aa>
+  802360:	8b 57 0c             	mov    0xc(%edi),%edx
+  802363:	89 10                	mov    %edx,(%eax)
+  802365:	89 58 04             	mov    %ebx,0x4(%eax)
+  802368:	89 f2                	mov    %esi,%edx
+  80236a:	03 57 04             	add    0x4(%edi),%edx
+  80236d:	89 50 08             	mov    %edx,0x8(%eax)
+  802370:	eb 95                	jmp    802307 <fsring_rw+0x1d1>
+  802372:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802377:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+  80237d:	68 00 00 f0 cf       	push   $0xcff00000
+  802382:	e8 94 0b 00 00       	call   802f1b <ipcring_rsp_wait>
+  802387:	8b 58 04             	mov    0x4(%eax),%ebx
+  80238a:	83 c4 10             	add    $0x10,%esp
+  80238d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802391:	75 45                	jne    8023d8 <fsring_rw+0x2a2>
+  802393:	85 db                	test   %ebx,%ebx
+  802395:	79 41                	jns    8023d8 <fsring_rw+0x2a2>
+  802397:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80239a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8023a1:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8023a8:	83 ec 0c             	sub    $0xc,%esp
+  8023ab:	68 00 00 f0 cf       	push   $0xcff00000
+  8023b0:	e8 cc 0b 00 00       	call   802f81 <ipcring_rsp_pop>
+  8023b5:	83 c4 10             	add    $0x10,%esp
+  8023b8:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8023be:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8023c3:	39 c2                	cmp    %eax,%edx
+  8023c5:	74 75                	je     80243c <fsring_rw+0x306>
+  8023c7:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8023cb:	75 a5                	jne    802372 <fsring_rw+0x23c>
+  8023cd:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8023d0:	0f 82 50 ff ff ff    	jb     802326 <fsring_rw+0x1f0>
+  8023d6:	eb 9a                	jmp    802372 <fsring_rw+0x23c>
+  8023d8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8023dc:	75 ca                	jne    8023a8 <fsring_rw+0x272>
+  8023de:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8023e2:	74 31                	je     802415 <fsring_rw+0x2df>
+  8023e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e7:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8023ea:	29 c8                	sub    %ecx,%eax
+  8023ec:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8023ef:	39 d0                	cmp    %edx,%eax
+  8023f1:	0f 47 c2             	cmova  %edx,%eax
+  8023f4:	39 d8                	cmp    %ebx,%eax
+  8023f6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8023fb:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8023ff:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802402:	b8 01 00 00 00       	mov    $0x1,%eax
+  802407:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80240b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80240e:	01 d9                	add    %ebx,%ecx
+  802410:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802413:	eb 93                	jmp    8023a8 <fsring_rw+0x272>
+  802415:	83 ec 04             	sub    $0x4,%esp
+  802418:	53                   	push   %ebx
+  802419:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80241c:	83 e0 07             	and    $0x7,%eax
+  80241f:	c1 e0 0c             	shl    $0xc,%eax
+  802422:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802428:	50                   	push   %eax
+  802429:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80242c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80242f:	01 c8                	add    %ecx,%eax
+  802431:	50                   	push   %eax
+  802432:	e8 33 e6 ff ff       	call   800a6a <memmove>
+  802437:	83 c4 10             	add    $0x10,%esp
+  80243a:	eb a8                	jmp    8023e4 <fsring_rw+0x2ae>
+  80243c:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802440:	75 09                	jne    80244b <fsring_rw+0x315>
+  802442:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802445:	0f 82 db fe ff ff    	jb     802326 <fsring_rw+0x1f0>
+  80244b:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80244e:	01 57 04             	add    %edx,0x4(%edi)
+  802451:	85 d2                	test   %edx,%edx
+  802453:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802457:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80245a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80245d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802460:	5b                   	pop    %ebx
+  802461:	5e                   	pop    %esi
+  802462:	5f                   	pop    %edi
+  802463:	5d                   	pop    %ebp
+  802464:	c3                   	ret
+
+00802465 <devfile_write>:
+  802465:	55                   	push   %ebp
+  802466:	89 e5                	mov    %esp,%ebp
+  802468:	57                   	push   %edi
+  802469:	56                   	push   %esi
+  80246a:	53                   	push   %ebx
+  80246b:	83 ec 0c             	sub    $0xc,%esp
+  80246e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802471:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802474:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802477:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80247d:	76 1a                	jbe    802499 <devfile_write+0x34>
+  80247f:	83 ec 0c             	sub    $0xc,%esp
+  802482:	53                   	push   %ebx
+  802483:	89 f1                	mov    %esi,%ecx
+  802485:	ba 06 00 00 00       	mov    $0x6,%edx
+  80248a:	89 f8                	mov    %edi,%eax
+  80248c:	e8 a5 fc ff ff       	call   802136 <fsring_rw>
+  802491:	83 c4 10             	add    $0x10,%esp
+  802494:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802497:	75 39                	jne    8024d2 <devfile_write+0x6d>
+  802499:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80249e:	39 c3                	cmp    %eax,%ebx
+  8024a0:	0f 47 d8             	cmova  %eax,%ebx
+  8024a3:	8b 47 0c             	mov    0xc(%edi),%eax
+  8024a6:	a3 00 60 80 00       	mov    %eax,0x806000
+  8024ab:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8024b1:	83 ec 04             	sub    $0x4,%esp
+  8024b4:	53                   	push   %ebx
+  8024b5:	56                   	push   %esi
+  8024b6:	68 08 60 80 00       	push   $0x806008
+  8024bb:	e8 aa e5 ff ff       	call   800a6a <memmove>
+  8024c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024ca:	e8 7c fb ff ff       	call   80204b <fsipc>
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d5:	5b                   	pop    %ebx
+  8024d6:	5e                   	pop    %esi
+  8024d7:	5f                   	pop    %edi
+  8024d8:	5d                   	pop    %ebp
+  8024d9:	c3                   	ret
+
+008024da <devfile_read>:
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	57                   	push   %edi
+  8024de:	56                   	push   %esi
+  8024df:	53                   	push   %ebx
+  8024e0:	83 ec 0c             	sub    $0xc,%esp
+  8024e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024e6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8024e9:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8024ef:	76 1d                	jbe    80250e <devfile_read+0x34>
+  8024f1:	83 ec 0c             	sub    $0xc,%esp
+  8024f4:	56                   	push   %esi
+  8024f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024f8:	ba 05 00 00 00       	mov    $0x5,%edx
+  8024fd:	89 f8                	mov    %edi,%eax
+  8024ff:	e8 32 fc ff ff       	call   802136 <fsring_rw>
+  802504:	89 c3                	mov    %eax,%ebx
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80250c:	75 37                	jne    802545 <devfile_read+0x6b>
+  80250e:	8b 47 0c             	mov    0xc(%edi),%eax
+  802511:	a3 00 60 80 00       	mov    %eax,0x806000
+  802516:	89 35 04 60 80 00    	mov    %esi,0x806004
+  80251c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802521:	b8 03 00 00 00       	mov    $0x3,%eax
+  802526:	e8 20 fb ff ff       	call   80204b <fsipc>
+  80252b:	89 c3                	mov    %eax,%ebx
+  80252d:	85 c0                	test   %eax,%eax
+  80252f:	78 14                	js     802545 <devfile_read+0x6b>
+  802531:	83 ec 04             	sub    $0x4,%esp
+  802534:	50                   	push   %eax
+  802535:	68 00 60 80 00       	push   $0x806000
+  80253a:	ff 75 0c             	push   0xc(%ebp)
+  80253d:	e8 28 e5 ff ff       	call   800a6a <memmove>
+  802542:	83 c4 10             	add    $0x10,%esp
+  802545:	89 d8                	mov    %ebx,%eax
+  802547:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254a:	5b                   	pop    %ebx
+  80254b:	5e                   	pop    %esi
+  80254c:	5f                   	pop    %edi
+  80254d:	5d                   	pop    %ebp
+  80254e:	c3                   	ret
+
+0080254f <open>:
+  80254f:	55                   	push   %ebp
+  802550:	89 e5                	mov    %esp,%ebp
+  802552:	56                   	push   %esi
+  802553:	53                   	push   %ebx
+  802554:	83 ec 1c             	sub    $0x1c,%esp
+  802557:	8b 75 08             	mov    0x8(%ebp),%esi
+  80255a:	56                   	push   %esi
+  80255b:	e8 0e e3 ff ff       	call   80086e <strlen>
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802568:	7f 6c                	jg     8025d6 <open+0x87>
+  80256a:	83 ec 0c             	sub    $0xc,%esp
+  80256d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802570:	50                   	push   %eax
+  802571:	e8 6a f5 ff ff       	call   801ae0 <fd_alloc>
+  802576:	89 c3                	mov    %eax,%ebx
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	85 c0                	test   %eax,%eax
+  80257d:	78 3c                	js     8025bb <open+0x6c>
+  80257f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802582:	a3 00 64 80 00       	mov    %eax,0x806400
+  802587:	83 ec 08             	sub    $0x8,%esp
+  80258a:	56                   	push   %esi
+  80258b:	68 00 60 80 00       	push   $0x806000
+  802590:	e8 25 e3 ff ff       	call   8008ba <strcpy>
+  802595:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802598:	b8 01 00 00 00       	mov    $0x1,%eax
+  80259d:	e8 a9 fa ff ff       	call   80204b <fsipc>
+  8025a2:	89 c3                	mov    %eax,%ebx
+  8025a4:	83 c4 10             	add    $0x10,%esp
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	78 19                	js     8025c4 <open+0x75>
+  8025ab:	83 ec 0c             	sub    $0xc,%esp
+  8025ae:	ff 75 f4             	push   -0xc(%ebp)
+  8025b1:	e8 03 f5 ff ff       	call   801ab9 <fd2num>
+  8025b6:	89 c3                	mov    %eax,%ebx
+  8025b8:	83 c4 10             	add    $0x10,%esp
+  8025bb:	89 d8                	mov    %ebx,%eax
+  8025bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c0:	5b                   	pop    %ebx
+  8025c1:	5e                   	pop    %esi
+  8025c2:	5d                   	pop    %ebp
+  8025c3:	c3                   	ret
+  8025c4:	83 ec 08             	sub    $0x8,%esp
+  8025c7:	6a 00                	push   $0x0
+  8025c9:	ff 75 f4             	push   -0xc(%ebp)
+  8025cc:	e8 05 f6 ff ff       	call   801bd6 <fd_close>
+  8025d1:	83 c4 10             	add    $0x10,%esp
+  8025d4:	eb e5                	jmp    8025bb <open+0x6c>
+  8025d6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8025db:	eb de                	jmp    8025bb <open+0x6c>
+
+008025dd <file_image>:
+  8025dd:	55                   	push   %ebp
+  8025de:	89 e5                	mov    %esp,%ebp
+  8025e0:	53                   	push   %ebx
+  8025e1:	83 ec 1c             	sub    $0x1c,%esp
+  8025e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ea:	50                   	push   %eax
+  8025eb:	ff 75 08             	push   0x8(%ebp)
+  8025ee:	e8 3d f5 ff ff       	call   801b30 <fd_lookup>
+  8025f3:	83 c4 10             	add    $0x10,%esp
+  8025f6:	85 c0                	test   %eax,%eax
+  8025f8:	78 58                	js     802652 <file_image+0x75>
+  8025fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025fd:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802603:	39 08                	cmp    %ecx,(%eax)
+  802605:	75 50                	jne    802657 <file_image+0x7a>
+  802607:	83 fb 04             	cmp    $0x4,%ebx
+  80260a:	77 52                	ja     80265e <file_image+0x81>
+  80260c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80260f:	a3 00 60 80 00       	mov    %eax,0x806000
+  802614:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80261a:	83 ec 04             	sub    $0x4,%esp
+  80261d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802620:	c1 e0 02             	shl    $0x2,%eax
+  802623:	50                   	push   %eax
+  802624:	ff 75 0c             	push   0xc(%ebp)
+  802627:	68 08 60 80 00       	push   $0x806008
+  80262c:	e8 39 e4 ff ff       	call   800a6a <memmove>
+  802631:	ba 00 00 00 00       	mov    $0x0,%edx
+  802636:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80263b:	e8 0b fa ff ff       	call   80204b <fsipc>
+  802640:	83 c4 10             	add    $0x10,%esp
+  802643:	85 c0                	test   %eax,%eax
+  802645:	78 0b                	js     802652 <file_image+0x75>
+  802647:	8b 55 14             	mov    0x14(%ebp),%edx
+  80264a:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  802650:	89 0a                	mov    %ecx,(%edx)
+  802652:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802655:	c9                   	leave
+  802656:	c3                   	ret
+  802657:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80265c:	eb f4                	jmp    802652 <file_image+0x75>
+  80265e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802663:	eb ed                	jmp    802652 <file_image+0x75>
+
+00802665 <remove>:
+  802665:	55                   	push   %ebp
+  802666:	89 e5                	mov    %esp,%ebp
+  802668:	53                   	push   %ebx
+  802669:	83 ec 10             	sub    $0x10,%esp
+  80266c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80266f:	53                   	push   %ebx
+  802670:	e8 f9 e1 ff ff       	call   80086e <strlen>
+  802675:	83 c4 10             	add    $0x10,%esp
+  802678:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80267d:	7f 25                	jg     8026a4 <remove+0x3f>
+  80267f:	83 ec 08             	sub    $0x8,%esp
+  802682:	53                   	push   %ebx
+  802683:	68 00 60 80 00       	push   $0x806000
+  802688:	e8 2d e2 ff ff       	call   8008ba <strcpy>
+  80268d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802692:	b8 09 00 00 00       	mov    $0x9,%eax
+  802697:	e8 af f9 ff ff       	call   80204b <fsipc>
+  80269c:	83 c4 10             	add    $0x10,%esp
+  80269f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a2:	c9                   	leave
+  8026a3:	c3                   	ret
+  8026a4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026a9:	eb f4                	jmp    80269f <remove+0x3a>
+
+008026ab <sync>:
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	83 ec 08             	sub    $0x8,%esp
+  8026b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026bb:	e8 8b f9 ff ff       	call   80204b <fsipc>
+  8026c0:	c9                   	leave
+  8026c1:	c3                   	ret
+
+008026c2 <devsock_stat>:
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	83 ec 10             	sub    $0x10,%esp
+  8026c8:	68 10 3d 80 00       	push   $0x803d10
+  8026cd:	ff 75 0c             	push   0xc(%ebp)
+  8026d0:	e8 e5 e1 ff ff       	call   8008ba <strcpy>
+  8026d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026da:	c9                   	leave
+  8026db:	c3                   	ret
+
+008026dc <devsock_close>:
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	53                   	push   %ebx
+  8026e0:	83 ec 10             	sub    $0x10,%esp
+  8026e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026e6:	53                   	push   %ebx
+  8026e7:	e8 82 0e 00 00       	call   80356e <pageref>
+  8026ec:	89 c2                	mov    %eax,%edx
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f6:	83 fa 01             	cmp    $0x1,%edx
+  8026f9:	74 05                	je     802700 <devsock_close+0x24>
+  8026fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026fe:	c9                   	leave
+  8026ff:	c3                   	ret
+  802700:	83 ec 0c             	sub    $0xc,%esp
+  802703:	ff 73 0c             	push   0xc(%ebx)
+  802706:	e8 aa 02 00 00       	call   8029b5 <nsipc_close>
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	eb eb                	jmp    8026fb <devsock_close+0x1f>
+
+00802710 <devsock_write>:
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	83 ec 08             	sub    $0x8,%esp
+  802716:	6a 00                	push   $0x0
+  802718:	ff 75 10             	push   0x10(%ebp)
+  80271b:	ff 75 0c             	push   0xc(%ebp)
+  80271e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802721:	ff 70 0c             	push   0xc(%eax)
+  802724:	e8 6c 03 00 00       	call   802a95 <nsipc_send>
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+
+0080272b <devsock_read>:
+  80272b:	55                   	push   %ebp
+  80272c:	89 e5                	mov    %esp,%ebp
+  80272e:	83 ec 08             	sub    $0x8,%esp
+  802731:	6a 00                	push   $0x0
+  802733:	ff 75 10             	push   0x10(%ebp)
+  802736:	ff 75 0c             	push   0xc(%ebp)
+  802739:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273c:	ff 70 0c             	push   0xc(%eax)
+  80273f:	e8 e2 02 00 00       	call   802a26 <nsipc_recv>
+  802744:	c9                   	leave
+  802745:	c3                   	ret
+
+00802746 <fd2sockid>:
+  802746:	55                   	push   %ebp
+  802747:	89 e5                	mov    %esp,%ebp
+  802749:	83 ec 20             	sub    $0x20,%esp
+  80274c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80274f:	52                   	push   %edx
+  802750:	50                   	push   %eax
+  802751:	e8 da f3 ff ff       	call   801b30 <fd_lookup>
+  802756:	83 c4 10             	add    $0x10,%esp
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	78 10                	js     80276d <fd2sockid+0x27>
+  80275d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802760:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802766:	39 08                	cmp    %ecx,(%eax)
+  802768:	75 05                	jne    80276f <fd2sockid+0x29>
+  80276a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80276d:	c9                   	leave
+  80276e:	c3                   	ret
+  80276f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802774:	eb f7                	jmp    80276d <fd2sockid+0x27>
+
+00802776 <alloc_sockfd>:
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	56                   	push   %esi
+  80277a:	53                   	push   %ebx
+  80277b:	83 ec 1c             	sub    $0x1c,%esp
+  80277e:	89 c6                	mov    %eax,%esi
+  802780:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802783:	50                   	push   %eax
+  802784:	e8 57 f3 ff ff       	call   801ae0 <fd_alloc>
+  802789:	89 c3                	mov    %eax,%ebx
+  80278b:	83 c4 10             	add    $0x10,%esp
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	78 43                	js     8027d5 <alloc_sockfd+0x5f>
+  802792:	83 ec 04             	sub    $0x4,%esp
+  802795:	68 07 04 00 00       	push   $0x407
+  80279a:	ff 75 f4             	push   -0xc(%ebp)
+  80279d:	6a 00                	push   $0x0
+  80279f:	e8 76 e5 ff ff       	call   800d1a <sys_page_alloc>
+  8027a4:	89 c3                	mov    %eax,%ebx
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	78 28                	js     8027d5 <alloc_sockfd+0x5f>
+  8027ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b0:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8027b6:	89 10                	mov    %edx,(%eax)
+  8027b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027bb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8027c2:	89 70 0c             	mov    %esi,0xc(%eax)
+  8027c5:	83 ec 0c             	sub    $0xc,%esp
+  8027c8:	50                   	push   %eax
+  8027c9:	e8 eb f2 ff ff       	call   801ab9 <fd2num>
+  8027ce:	89 c3                	mov    %eax,%ebx
+  8027d0:	83 c4 10             	add    $0x10,%esp
+  8027d3:	eb 0c                	jmp    8027e1 <alloc_sockfd+0x6b>
+  8027d5:	83 ec 0c             	sub    $0xc,%esp
+  8027d8:	56                   	push   %esi
+  8027d9:	e8 d7 01 00 00       	call   8029b5 <nsipc_close>
+  8027de:	83 c4 10             	add    $0x10,%esp
+  8027e1:	89 d8                	mov    %ebx,%eax
+  8027e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e6:	5b                   	pop    %ebx
+  8027e7:	5e                   	pop    %esi
+  8027e8:	5d                   	pop    %ebp
+  8027e9:	c3                   	ret
+
+008027ea <accept>:
+  8027ea:	55                   	push   %ebp
+  8027eb:	89 e5                	mov    %esp,%ebp
+  8027ed:	83 ec 08             	sub    $0x8,%esp
+  8027f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f3:	e8 4e ff ff ff       	call   802746 <fd2sockid>
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	78 1b                	js     802817 <accept+0x2d>
+  8027fc:	83 ec 04             	sub    $0x4,%esp
+  8027ff:	ff 75 10             	push   0x10(%ebp)
+  802802:	ff 75 0c             	push   0xc(%ebp)
+  802805:	50                   	push   %eax
+  802806:	e8 07 01 00 00       	call   802912 <nsipc_accept>
+  80280b:	83 c4 10             	add    $0x10,%esp
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	78 05                	js     802817 <accept+0x2d>
+  802812:	e8 5f ff ff ff       	call   802776 <alloc_sockfd>
+  802817:	c9                   	leave
+  802818:	c3                   	ret
+
+00802819 <bind>:
+  802819:	55                   	push   %ebp
+  80281a:	89 e5                	mov    %esp,%ebp
+  80281c:	83 ec 08             	sub    $0x8,%esp
+  80281f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802822:	e8 1f ff ff ff       	call   802746 <fd2sockid>
+  802827:	85 c0                	test   %eax,%eax
+  802829:	78 12                	js     80283d <bind+0x24>
+  80282b:	83 ec 04             	sub    $0x4,%esp
+  80282e:	ff 75 10             	push   0x10(%ebp)
+  802831:	ff 75 0c             	push   0xc(%ebp)
+  802834:	50                   	push   %eax
+  802835:	e8 24 01 00 00       	call   80295e <nsipc_bind>
+  80283a:	83 c4 10             	add    $0x10,%esp
+  80283d:	c9                   	leave
+  80283e:	c3                   	ret
+
+0080283f <shutdown>:
+  80283f:	55                   	push   %ebp
+  802840:	89 e5                	mov    %esp,%ebp
+  802842:	83 ec 08             	sub    $0x8,%esp
+  802845:	8b 45 08             	mov    0x8(%ebp),%eax
+  802848:	e8 f9 fe ff ff       	call   802746 <fd2sockid>
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	78 0f                	js     802860 <shutdown+0x21>
+  802851:	83 ec 08             	sub    $0x8,%esp
+  802854:	ff 75 0c             	push   0xc(%ebp)
+  802857:	50                   	push   %eax
+  802858:	e8 36 01 00 00       	call   802993 <nsipc_shutdown>
+  80285d:	83 c4 10             	add    $0x10,%esp
+  802860:	c9                   	leave
+  802861:	c3                   	ret
+
+00802862 <connect>:
+  802862:	55                   	push   %ebp
+  802863:	89 e5                	mov    %esp,%ebp
+  802865:	83 ec 08             	sub    $0x8,%esp
+  802868:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286b:	e8 d6 fe ff ff       	call   802746 <fd2sockid>
+  802870:	85 c0                	test   %eax,%eax
+  802872:	78 12                	js     802886 <connect+0x24>
+  802874:	83 ec 04             	sub    $0x4,%esp
+  802877:	ff 75 10             	push   0x10(%ebp)
+  80287a:	ff 75 0c             	push   0xc(%ebp)
+  80287d:	50                   	push   %eax
+  80287e:	e8 4c 01 00 00       	call   8029cf <nsipc_connect>
+  802883:	83 c4 10             	add    $0x10,%esp
+  802886:	c9                   	leave
+  802887:	c3                   	ret
+
+00802888 <listen>:
+  802888:	55                   	push   %ebp
+  802889:	89 e5                	mov    %esp,%ebp
+  80288b:	83 ec 08             	sub    $0x8,%esp
+  80288e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802891:	e8 b0 fe ff ff       	call   802746 <fd2sockid>
+  802896:	85 c0                	test   %eax,%eax
+  802898:	78 0f                	js     8028a9 <listen+0x21>
+  80289a:	83 ec 08             	sub    $0x8,%esp
+  80289d:	ff 75 0c             	push   0xc(%ebp)
+  8028a0:	50                   	push   %eax
+  8028a1:	e8 5e 01 00 00       	call   802a04 <nsipc_listen>
+  8028a6:	83 c4 10             	add    $0x10,%esp
+  8028a9:	c9                   	leave
+  8028aa:	c3                   	ret
+
+008028ab <socket>:
+  8028ab:	55                   	push   %ebp
+  8028ac:	89 e5                	mov    %esp,%ebp
+  8028ae:	83 ec 0c             	sub    $0xc,%esp
+  8028b1:	ff 75 10             	push   0x10(%ebp)
+  8028b4:	ff 75 0c             	push   0xc(%ebp)
+  8028b7:	ff 75 08             	push   0x8(%ebp)
+  8028ba:	e8 34 02 00 00       	call   802af3 <nsipc_socket>
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  8028c2:	85 c0                	test   %eax,%eax
+  8028c4:	78 05                	js     8028cb <socket+0x20>
+  8028c6:	e8 ab fe ff ff       	call   802776 <alloc_sockfd>
+  8028cb:	c9                   	leave
+  8028cc:	c3                   	ret
+
+008028cd <nsipc>:
+  8028cd:	55                   	push   %ebp
+  8028ce:	89 e5                	mov    %esp,%ebp
+  8028d0:	53                   	push   %ebx
+  8028d1:	83 ec 04             	sub    $0x4,%esp
+  8028d4:	89 c3                	mov    %eax,%ebx
+  8028d6:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  8028dd:	74 1f                	je     8028fe <nsipc+0x31>
+  8028df:	83 ec 08             	sub    $0x8,%esp
+  8028e2:	6a 00                	push   $0x0
+  8028e4:	6a 00                	push   $0x0
+  8028e6:	6a 07                	push   $0x7
+  8028e8:	68 00 70 80 00       	push   $0x807000
+  8028ed:	53                   	push   %ebx
+  8028ee:	ff 35 10 50 80 00    	push   0x805010
+  8028f4:	e8 c0 0a 00 00       	call   8033b9 <ipc_call>
+  8028f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028fc:	c9                   	leave
+  8028fd:	c3                   	ret
+  8028fe:	83 ec 0c             	sub    $0xc,%esp
+  802901:	6a 03                	push   $0x3
+  802903:	e8 4c 0c 00 00       	call   803554 <ipc_find_env>
+  802908:	a3 10 50 80 00       	mov    %eax,0x805010
+  80290d:	83 c4 10             	add    $0x10,%esp
+  802910:	eb cd                	jmp    8028df <nsipc+0x12>
+
+00802912 <nsipc_accept>:
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	53                   	push   %ebx
+  802916:	83 ec 04             	sub    $0x4,%esp
+  802919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802921:	b8 01 00 00 00       	mov    $0x1,%eax
+  802926:	e8 a2 ff ff ff       	call   8028cd <nsipc>
+  80292b:	89 c3                	mov    %eax,%ebx
+  80292d:	85 c0                	test   %eax,%eax
+  80292f:	79 07                	jns    802938 <nsipc_accept+0x26>
+  802931:	89 d8                	mov    %ebx,%eax
+  802933:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802936:	c9                   	leave
+  802937:	c3                   	ret
+  802938:	83 ec 04             	sub    $0x4,%esp
+  80293b:	ff 35 10 70 80 00    	push   0x807010
+  802941:	68 00 70 80 00       	push   $0x807000
+  802946:	ff 75 0c             	push   0xc(%ebp)
+  802949:	e8 1c e1 ff ff       	call   800a6a <memmove>
+  80294e:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802954:	8b 45 10             	mov    0x10(%ebp),%eax
+  802957:	89 10                	mov    %edx,(%eax)
+  802959:	83 c4 10             	add    $0x10,%esp
+  80295c:	eb d3                	jmp    802931 <nsipc_accept+0x1f>
+
+0080295e <nsipc_bind>:
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	53                   	push   %ebx
+  802962:	83 ec 08             	sub    $0x8,%esp
+  802965:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802968:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802970:	53                   	push   %ebx
+  802971:	ff 75 0c             	push   0xc(%ebp)
+  802974:	68 04 70 80 00       	push   $0x807004
+  802979:	e8 ec e0 ff ff       	call   800a6a <memmove>
+  80297e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802984:	b8 02 00 00 00       	mov    $0x2,%eax
+  802989:	e8 3f ff ff ff       	call   8028cd <nsipc>
+  80298e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+
+00802993 <nsipc_shutdown>:
+  802993:	55                   	push   %ebp
+  802994:	89 e5                	mov    %esp,%ebp
+  802996:	83 ec 08             	sub    $0x8,%esp
+  802999:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299c:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029a4:	a3 04 70 80 00       	mov    %eax,0x807004
+  8029a9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029ae:	e8 1a ff ff ff       	call   8028cd <nsipc>
+  8029b3:	c9                   	leave
+  8029b4:	c3                   	ret
+
+008029b5 <nsipc_close>:
+  8029b5:	55                   	push   %ebp
+  8029b6:	89 e5                	mov    %esp,%ebp
+  8029b8:	83 ec 08             	sub    $0x8,%esp
+  8029bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029be:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029c3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029c8:	e8 00 ff ff ff       	call   8028cd <nsipc>
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+
+008029cf <nsipc_connect>:
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	53                   	push   %ebx
+  8029d3:	83 ec 08             	sub    $0x8,%esp
+  8029d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029dc:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029e1:	53                   	push   %ebx
+  8029e2:	ff 75 0c             	push   0xc(%ebp)
+  8029e5:	68 04 70 80 00       	push   $0x807004
+  8029ea:	e8 7b e0 ff ff       	call   800a6a <memmove>
+  8029ef:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8029f5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8029fa:	e8 ce fe ff ff       	call   8028cd <nsipc>
+  8029ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a02:	c9                   	leave
+  802a03:	c3                   	ret
+
+00802a04 <nsipc_listen>:
+  802a04:	55                   	push   %ebp
+  802a05:	89 e5                	mov    %esp,%ebp
+  802a07:	83 ec 08             	sub    $0x8,%esp
+  802a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a15:	a3 04 70 80 00       	mov    %eax,0x807004
+  802a1a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a1f:	e8 a9 fe ff ff       	call   8028cd <nsipc>
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+00802a26 <nsipc_recv>:
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	56                   	push   %esi
+  802a2a:	53                   	push   %ebx
+  802a2b:	8b 75 10             	mov    0x10(%ebp),%esi
+  802a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a31:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a36:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802a3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a3f:	a3 08 70 80 00       	mov    %eax,0x807008
+  802a44:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a49:	e8 7f fe ff ff       	call   8028cd <nsipc>
+  802a4e:	89 c3                	mov    %eax,%ebx
+  802a50:	85 c0                	test   %eax,%eax
+  802a52:	78 22                	js     802a76 <nsipc_recv+0x50>
+  802a54:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a59:	39 c6                	cmp    %eax,%esi
+  802a5b:	0f 4e c6             	cmovle %esi,%eax
+  802a5e:	39 c3                	cmp    %eax,%ebx
+  802a60:	7f 1d                	jg     802a7f <nsipc_recv+0x59>
+  802a62:	83 ec 04             	sub    $0x4,%esp
+  802a65:	53                   	push   %ebx
+  802a66:	68 00 70 80 00       	push   $0x807000
+  802a6b:	ff 75 0c             	push   0xc(%ebp)
+  802a6e:	e8 f7 df ff ff       	call   800a6a <memmove>
+  802a73:	83 c4 10             	add    $0x10,%esp
+  802a76:	89 d8                	mov    %ebx,%eax
+  802a78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a7b:	5b                   	pop    %ebx
+  802a7c:	5e                   	pop    %esi
+  802a7d:	5d                   	pop    %ebp
+  802a7e:	c3                   	ret
+  802a7f:	68 1c 3d 80 00       	push   $0x803d1c
+  802a84:	68 31 3d 80 00       	push   $0x803d31
+  802a89:	6a 60                	push   $0x60
+  802a8b:	68 46 3d 80 00       	push   $0x803d46
+  802a90:	e8 83 07 00 00       	call   803218 <_panic>
+
+00802a95 <nsipc_send>:
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+  802a98:	53                   	push   %ebx
+  802a99:	83 ec 04             	sub    $0x4,%esp
+  802a9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa2:	a3 00 70 80 00       	mov    %eax,0x807000
+  802aa7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802aad:	7f 2e                	jg     802add <nsipc_send+0x48>
+  802aaf:	83 ec 04             	sub    $0x4,%esp
+  802ab2:	53                   	push   %ebx
+  802ab3:	ff 75 0c             	push   0xc(%ebp)
+  802ab6:	68 0c 70 80 00       	push   $0x80700c
+  802abb:	e8 aa df ff ff       	call   800a6a <memmove>
+  802ac0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802ac6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ac9:	a3 08 70 80 00       	mov    %eax,0x807008
+  802ace:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ad3:	e8 f5 fd ff ff       	call   8028cd <nsipc>
+  802ad8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802adb:	c9                   	leave
+  802adc:	c3                   	ret
+  802add:	68 52 3d 80 00       	push   $0x803d52
+  802ae2:	68 31 3d 80 00       	push   $0x803d31
+  802ae7:	6a 6b                	push   $0x6b
+  802ae9:	68 46 3d 80 00       	push   $0x803d46
+  802aee:	e8 25 07 00 00       	call   803218 <_panic>
+
+00802af3 <nsipc_socket>:
+  802af3:	55                   	push   %ebp
+  802af4:	89 e5                	mov    %esp,%ebp
+  802af6:	83 ec 08             	sub    $0x8,%esp
+  802af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afc:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b04:	a3 04 70 80 00       	mov    %eax,0x807004
+  802b09:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b0c:	a3 08 70 80 00       	mov    %eax,0x807008
+  802b11:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b16:	e8 b2 fd ff ff       	call   8028cd <nsipc>
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <devpipe_stat>:
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	56                   	push   %esi
+  802b21:	53                   	push   %ebx
+  802b22:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802b25:	83 ec 0c             	sub    $0xc,%esp
+  802b28:	ff 75 08             	push   0x8(%ebp)
+  802b2b:	e8 99 ef ff ff       	call   801ac9 <fd2data>
+  802b30:	89 c6                	mov    %eax,%esi
+  802b32:	83 c4 08             	add    $0x8,%esp
+  802b35:	68 5e 3d 80 00       	push   $0x803d5e
+  802b3a:	53                   	push   %ebx
+  802b3b:	e8 7a dd ff ff       	call   8008ba <strcpy>
+  802b40:	8b 46 04             	mov    0x4(%esi),%eax
+  802b43:	2b 06                	sub    (%esi),%eax
+  802b45:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802b4b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802b52:	00 00 00 
+  802b55:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802b5c:	40 80 00 
+  802b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b67:	5b                   	pop    %ebx
+  802b68:	5e                   	pop    %esi
+  802b69:	5d                   	pop    %ebp
+  802b6a:	c3                   	ret
+
+00802b6b <devpipe_close>:
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	53                   	push   %ebx
+  802b6f:	83 ec 0c             	sub    $0xc,%esp
+  802b72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b75:	53                   	push   %ebx
+  802b76:	6a 00                	push   $0x0
+  802b78:	e8 6f e2 ff ff       	call   800dec <sys_page_unmap>
+  802b7d:	89 1c 24             	mov    %ebx,(%esp)
+  802b80:	e8 44 ef ff ff       	call   801ac9 <fd2data>
+  802b85:	83 c4 08             	add    $0x8,%esp
+  802b88:	50                   	push   %eax
+  802b89:	6a 00                	push   $0x0
+  802b8b:	e8 5c e2 ff ff       	call   800dec <sys_page_unmap>
+  802b90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b93:	c9                   	leave
+  802b94:	c3                   	ret
+
+00802b95 <_pipeisclosed>:
+  802b95:	55                   	push   %ebp
+  802b96:	89 e5                	mov    %esp,%ebp
+  802b98:	57                   	push   %edi
+  802b99:	56                   	push   %esi
+  802b9a:	53                   	push   %ebx
+  802b9b:	83 ec 1c             	sub    $0x1c,%esp
+  802b9e:	89 c7                	mov    %eax,%edi
+  802ba0:	89 d6                	mov    %edx,%esi
+  802ba2:	a1 14 50 80 00       	mov    0x805014,%eax
+  802ba7:	8b 58 58             	mov    0x58(%eax),%ebx
+  802baa:	83 ec 0c             	sub    $0xc,%esp
+  802bad:	57                   	push   %edi
+  802bae:	e8 bb 09 00 00       	call   80356e <pageref>
+  802bb3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bb6:	89 34 24             	mov    %esi,(%esp)
+  802bb9:	e8 b0 09 00 00       	call   80356e <pageref>
+  802bbe:	8b 15 14 50 80 00    	mov    0x805014,%edx
+  802bc4:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802bc7:	83 c4 10             	add    $0x10,%esp
+  802bca:	39 cb                	cmp    %ecx,%ebx
+  802bcc:	74 1b                	je     802be9 <_pipeisclosed+0x54>
+  802bce:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bd1:	75 cf                	jne    802ba2 <_pipeisclosed+0xd>
+  802bd3:	8b 42 58             	mov    0x58(%edx),%eax
+  802bd6:	6a 01                	push   $0x1
+  802bd8:	50                   	push   %eax
+  802bd9:	53                   	push   %ebx
+  802bda:	68 65 3d 80 00       	push   $0x803d65
+  802bdf:	e8 df d5 ff ff       	call   8001c3 <cprintf>
+  802be4:	83 c4 10             	add    $0x10,%esp
+  802be7:	eb b9                	jmp    802ba2 <_pipeisclosed+0xd>
+  802be9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bec:	0f 94 c0             	sete   %al
+  802bef:	0f b6 c0             	movzbl %al,%eax
+  802bf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bf5:	5b                   	pop    %ebx
+  802bf6:	5e                   	pop    %esi
+  802bf7:	5f                   	pop    %edi
+  802bf8:	5d                   	pop    %ebp
+  802bf9:	c3                   	ret
+
+00802bfa <devpipe_write>:
+  802bfa:	55                   	push   %ebp
+  802bfb:	89 e5                	mov    %esp,%ebp
+  802bfd:	57                   	push   %edi
+  802bfe:	56                   	push   %esi
+  802bff:	53                   	push   %ebx
+  802c00:	83 ec 28             	sub    $0x28,%esp
+  802c03:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c06:	56                   	push   %esi
+  802c07:	e8 bd ee ff ff       	call   801ac9 <fd2data>
+  802c0c:	89 c3                	mov    %eax,%ebx
+  802c0e:	83 c4 10             	add    $0x10,%esp
+  802c11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c16:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c1a:	74 5c                	je     802c78 <devpipe_write+0x7e>
+  802c1c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c1f:	8b 0b                	mov    (%ebx),%ecx
+  802c21:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c24:	39 d0                	cmp    %edx,%eax
+  802c26:	72 1e                	jb     802c46 <devpipe_write+0x4c>
+  802c28:	89 da                	mov    %ebx,%edx
+  802c2a:	89 f0                	mov    %esi,%eax
+  802c2c:	e8 64 ff ff ff       	call   802b95 <_pipeisclosed>
+  802c31:	85 c0                	test   %eax,%eax
+  802c33:	75 48                	jne    802c7d <devpipe_write+0x83>
+  802c35:	e8 95 e0 ff ff       	call   800ccf <sys_yield>
+  802c3a:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c3d:	8b 0b                	mov    (%ebx),%ecx
+  802c3f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c42:	39 d0                	cmp    %edx,%eax
+  802c44:	73 e2                	jae    802c28 <devpipe_write+0x2e>
+  802c46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c49:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802c4d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802c50:	89 c2                	mov    %eax,%edx
+  802c52:	c1 fa 1f             	sar    $0x1f,%edx
+  802c55:	89 d1                	mov    %edx,%ecx
+  802c57:	c1 e9 1b             	shr    $0x1b,%ecx
+  802c5a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c5d:	83 e2 1f             	and    $0x1f,%edx
+  802c60:	29 ca                	sub    %ecx,%edx
+  802c62:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802c66:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802c6a:	83 c0 01             	add    $0x1,%eax
+  802c6d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802c70:	83 c7 01             	add    $0x1,%edi
+  802c73:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802c76:	75 a4                	jne    802c1c <devpipe_write+0x22>
+  802c78:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c7b:	eb 05                	jmp    802c82 <devpipe_write+0x88>
+  802c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c85:	5b                   	pop    %ebx
+  802c86:	5e                   	pop    %esi
+  802c87:	5f                   	pop    %edi
+  802c88:	5d                   	pop    %ebp
+  802c89:	c3                   	ret
+
+00802c8a <devpipe_read>:
+  802c8a:	55                   	push   %ebp
+  802c8b:	89 e5                	mov    %esp,%ebp
+  802c8d:	57                   	push   %edi
+  802c8e:	56                   	push   %esi
+  802c8f:	53                   	push   %ebx
+  802c90:	83 ec 18             	sub    $0x18,%esp
+  802c93:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c96:	56                   	push   %esi
+  802c97:	e8 2d ee ff ff       	call   801ac9 <fd2data>
+  802c9c:	89 c3                	mov    %eax,%ebx
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  802ca1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802caa:	74 45                	je     802cf1 <devpipe_read+0x67>
+  802cac:	8b 03                	mov    (%ebx),%eax
+  802cae:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802cb1:	75 1d                	jne    802cd0 <devpipe_read+0x46>
+  802cb3:	85 ff                	test   %edi,%edi
+  802cb5:	75 3f                	jne    802cf6 <devpipe_read+0x6c>
+  802cb7:	89 da                	mov    %ebx,%edx
+  802cb9:	89 f0                	mov    %esi,%eax
+  802cbb:	e8 d5 fe ff ff       	call   802b95 <_pipeisclosed>
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	75 3c                	jne    802d00 <devpipe_read+0x76>
+  802cc4:	e8 06 e0 ff ff       	call   800ccf <sys_yield>
+  802cc9:	8b 03                	mov    (%ebx),%eax
+  802ccb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802cce:	74 e7                	je     802cb7 <devpipe_read+0x2d>
+  802cd0:	99                   	cltd
+  802cd1:	c1 ea 1b             	shr    $0x1b,%edx
+  802cd4:	01 d0                	add    %edx,%eax
+  802cd6:	83 e0 1f             	and    $0x1f,%eax
+  802cd9:	29 d0                	sub    %edx,%eax
+  802cdb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ce0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ce3:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802ce6:	83 03 01             	addl   $0x1,(%ebx)
+  802ce9:	83 c7 01             	add    $0x1,%edi
+  802cec:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802cef:	75 bb                	jne    802cac <devpipe_read+0x22>
+  802cf1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cf4:	eb 02                	jmp    802cf8 <devpipe_read+0x6e>
+  802cf6:	89 f8                	mov    %edi,%eax
+  802cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cfb:	5b                   	pop    %ebx
+  802cfc:	5e                   	pop    %esi
+  802cfd:	5f                   	pop    %edi
+  802cfe:	5d                   	pop    %ebp
+  802cff:	c3                   	ret
+  802d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d05:	eb f1                	jmp    802cf8 <devpipe_read+0x6e>
+
+00802d07 <pipe>:
+  802d07:	55                   	push   %ebp
+  802d08:	89 e5                	mov    %esp,%ebp
+  802d0a:	56                   	push   %esi
+  802d0b:	53                   	push   %ebx
+  802d0c:	83 ec 1c             	sub    $0x1c,%esp
+  802d0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d12:	50                   	push   %eax
+  802d13:	e8 c8 ed ff ff       	call   801ae0 <fd_alloc>
+  802d18:	89 c3                	mov    %eax,%ebx
+  802d1a:	83 c4 10             	add    $0x10,%esp
+  802d1d:	85 c0                	test   %eax,%eax
+  802d1f:	0f 88 23 01 00 00    	js     802e48 <pipe+0x141>
+  802d25:	83 ec 04             	sub    $0x4,%esp
+  802d28:	68 07 04 00 00       	push   $0x407
+  802d2d:	ff 75 f4             	push   -0xc(%ebp)
+  802d30:	6a 00                	push   $0x0
+  802d32:	e8 e3 df ff ff       	call   800d1a <sys_page_alloc>
+  802d37:	89 c3                	mov    %eax,%ebx
+  802d39:	83 c4 10             	add    $0x10,%esp
+  802d3c:	85 c0                	test   %eax,%eax
+  802d3e:	0f 88 04 01 00 00    	js     802e48 <pipe+0x141>
+  802d44:	83 ec 0c             	sub    $0xc,%esp
+  802d47:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d4a:	50                   	push   %eax
+  802d4b:	e8 90 ed ff ff       	call   801ae0 <fd_alloc>
+  802d50:	89 c3                	mov    %eax,%ebx
+  802d52:	83 c4 10             	add    $0x10,%esp
+  802d55:	85 c0                	test   %eax,%eax
+  802d57:	0f 88 db 00 00 00    	js     802e38 <pipe+0x131>
+  802d5d:	83 ec 04             	sub    $0x4,%esp
+  802d60:	68 07 04 00 00       	push   $0x407
+  802d65:	ff 75 f0             	push   -0x10(%ebp)
+  802d68:	6a 00                	push   $0x0
+  802d6a:	e8 ab df ff ff       	call   800d1a <sys_page_alloc>
+  802d6f:	89 c3                	mov    %eax,%ebx
+  802d71:	83 c4 10             	add    $0x10,%esp
+  802d74:	85 c0                	test   %eax,%eax
+  802d76:	0f 88 bc 00 00 00    	js     802e38 <pipe+0x131>
+  802d7c:	83 ec 0c             	sub    $0xc,%esp
+  802d7f:	ff 75 f4             	push   -0xc(%ebp)
+  802d82:	e8 42 ed ff ff       	call   801ac9 <fd2data>
+  802d87:	89 c6                	mov    %eax,%esi
+  802d89:	83 c4 0c             	add    $0xc,%esp
+  802d8c:	68 07 04 00 00       	push   $0x407
+  802d91:	50                   	push   %eax
+  802d92:	6a 00                	push   $0x0
+  802d94:	e8 81 df ff ff       	call   800d1a <sys_page_alloc>
+  802d99:	89 c3                	mov    %eax,%ebx
+  802d9b:	83 c4 10             	add    $0x10,%esp
+  802d9e:	85 c0                	test   %eax,%eax
+  802da0:	0f 88 82 00 00 00    	js     802e28 <pipe+0x121>
+  802da6:	83 ec 0c             	sub    $0xc,%esp
+  802da9:	ff 75 f0             	push   -0x10(%ebp)
+  802dac:	e8 18 ed ff ff       	call   801ac9 <fd2data>
+  802db1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802db8:	50                   	push   %eax
+  802db9:	6a 00                	push   $0x0
+  802dbb:	56                   	push   %esi
+  802dbc:	6a 00                	push   $0x0
+  802dbe:	e8 9a df ff ff       	call   800d5d <sys_page_map>
+  802dc3:	89 c3                	mov    %eax,%ebx
+  802dc5:	83 c4 20             	add    $0x20,%esp
+  802dc8:	85 c0                	test   %eax,%eax
+  802dca:	78 4e                	js     802e1a <pipe+0x113>
+  802dcc:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802dd1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802dd4:	89 02                	mov    %eax,(%edx)
+  802dd6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802dd9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802de0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802de3:	89 02                	mov    %eax,(%edx)
+  802de5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802de8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802def:	83 ec 0c             	sub    $0xc,%esp
+  802df2:	ff 75 f4             	push   -0xc(%ebp)
+  802df5:	e8 bf ec ff ff       	call   801ab9 <fd2num>
+  802dfa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dfd:	89 01                	mov    %eax,(%ecx)
+  802dff:	83 c4 04             	add    $0x4,%esp
+  802e02:	ff 75 f0             	push   -0x10(%ebp)
+  802e05:	e8 af ec ff ff       	call   801ab9 <fd2num>
+  802e0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e0d:	89 41 04             	mov    %eax,0x4(%ecx)
+  802e10:	83 c4 10             	add    $0x10,%esp
+  802e13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e18:	eb 2e                	jmp    802e48 <pipe+0x141>
+  802e1a:	83 ec 08             	sub    $0x8,%esp
+  802e1d:	56                   	push   %esi
+  802e1e:	6a 00                	push   $0x0
+  802e20:	e8 c7 df ff ff       	call   800dec <sys_page_unmap>
+  802e25:	83 c4 10             	add    $0x10,%esp
+  802e28:	83 ec 08             	sub    $0x8,%esp
+  802e2b:	ff 75 f0             	push   -0x10(%ebp)
+  802e2e:	6a 00                	push   $0x0
+  802e30:	e8 b7 df ff ff       	call   800dec <sys_page_unmap>
+  802e35:	83 c4 10             	add    $0x10,%esp
+  802e38:	83 ec 08             	sub    $0x8,%esp
+  802e3b:	ff 75 f4             	push   -0xc(%ebp)
+  802e3e:	6a 00                	push   $0x0
+  802e40:	e8 a7 df ff ff       	call   800dec <sys_page_unmap>
+  802e45:	83 c4 10             	add    $0x10,%esp
+  802e48:	89 d8                	mov    %ebx,%eax
+  802e4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e4d:	5b                   	pop    %ebx
+  802e4e:	5e                   	pop    %esi
+  802e4f:	5d                   	pop    %ebp
+  802e50:	c3                   	ret
+
+00802e51 <pipeisclosed>:
+  802e51:	55                   	push   %ebp
+  802e52:	89 e5                	mov    %esp,%ebp
+  802e54:	83 ec 20             	sub    $0x20,%esp
+  802e57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e5a:	50                   	push   %eax
+  802e5b:	ff 75 08             	push   0x8(%ebp)
+  802e5e:	e8 cd ec ff ff       	call   801b30 <fd_lookup>
+  802e63:	83 c4 10             	add    $0x10,%esp
+  802e66:	85 c0                	test   %eax,%eax
+  802e68:	78 18                	js     802e82 <pipeisclosed+0x31>
+  802e6a:	83 ec 0c             	sub    $0xc,%esp
+  802e6d:	ff 75 f4             	push   -0xc(%ebp)
+  802e70:	e8 54 ec ff ff       	call   801ac9 <fd2data>
+  802e75:	89 c2                	mov    %eax,%edx
+  802e77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e7a:	e8 16 fd ff ff       	call   802b95 <_pipeisclosed>
+  802e7f:	83 c4 10             	add    $0x10,%esp
+  802e82:	c9                   	leave
+  802e83:	c3                   	ret
+
+00802e84 <ipcring_init>:
+  802e84:	55                   	push   %ebp
+  802e85:	89 e5                	mov    %esp,%ebp
+  802e87:	53                   	push   %ebx
+  802e88:	83 ec 08             	sub    $0x8,%esp
+  802e8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802e8e:	6a 60                	push   $0x60
+  802e90:	6a 00                	push   $0x0
+  802e92:	53                   	push   %ebx
+  802e93:	e8 9d db ff ff       	call   800a35 <memset>
+  802e98:	a1 14 50 80 00       	mov    0x805014,%eax
+  802e9d:	8b 40 48             	mov    0x48(%eax),%eax
+  802ea0:	89 03                	mov    %eax,(%ebx)
+  802ea2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ea5:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ea8:	8b 45 10             	mov    0x10(%ebp),%eax
+  802eab:	89 43 08             	mov    %eax,0x8(%ebx)
+  802eae:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eb1:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802eb4:	83 c4 10             	add    $0x10,%esp
+  802eb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eba:	c9                   	leave
+  802ebb:	c3                   	ret
+
+00802ebc <ipcring_req_slot>:
+  802ebc:	55                   	push   %ebp
+  802ebd:	89 e5                	mov    %esp,%ebp
+  802ebf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec2:	8b 50 10             	mov    0x10(%eax),%edx
+  802ec5:	8b 48 18             	mov    0x18(%eax),%ecx
+  802ec8:	29 ca                	sub    %ecx,%edx
+  802eca:	83 fa 07             	cmp    $0x7,%edx
+  802ecd:	77 0c                	ja     802edb <ipcring_req_slot+0x1f>
+  802ecf:	8b 50 10             	mov    0x10(%eax),%edx
+  802ed2:	83 e2 07             	and    $0x7,%edx
+  802ed5:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802ed9:	5d                   	pop    %ebp
+  802eda:	c3                   	ret
+  802edb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee0:	eb f7                	jmp    802ed9 <ipcring_req_slot+0x1d>
+
+00802ee2 <ipcring_req_push>:
+  802ee2:	55                   	push   %ebp
+  802ee3:	89 e5                	mov    %esp,%ebp
+  802ee5:	83 ec 08             	sub    $0x8,%esp
+  802ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  802eeb:	8b 42 10             	mov    0x10(%edx),%eax
+  802eee:	83 c0 01             	add    $0x1,%eax
+  802ef1:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802efa:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802efe:	85 c0                	test   %eax,%eax
+  802f00:	75 02                	jne    802f04 <ipcring_req_push+0x22>
+  802f02:	c9                   	leave
+  802f03:	c3                   	ret
+  802f04:	6a 00                	push   $0x0
+  802f06:	68 00 00 80 ee       	push   $0xee800000
+  802f0b:	ff 72 08             	push   0x8(%edx)
+  802f0e:	ff 72 04             	push   0x4(%edx)
+  802f11:	e8 3c e1 ff ff       	call   801052 <sys_ipc_send>
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	eb e7                	jmp    802f02 <ipcring_req_push+0x20>
+
+00802f1b <ipcring_rsp_wait>:
+  802f1b:	55                   	push   %ebp
+  802f1c:	89 e5                	mov    %esp,%ebp
+  802f1e:	53                   	push   %ebx
+  802f1f:	83 ec 04             	sub    $0x4,%esp
+  802f22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f25:	8b 53 18             	mov    0x18(%ebx),%edx
+  802f28:	8b 43 10             	mov    0x10(%ebx),%eax
+  802f2b:	39 c2                	cmp    %eax,%edx
+  802f2d:	74 3c                	je     802f6b <ipcring_rsp_wait+0x50>
+  802f2f:	8b 53 14             	mov    0x14(%ebx),%edx
+  802f32:	8b 43 18             	mov    0x18(%ebx),%eax
+  802f35:	39 c2                	cmp    %eax,%edx
+  802f37:	75 23                	jne    802f5c <ipcring_rsp_wait+0x41>
+  802f39:	83 ec 08             	sub    $0x8,%esp
+  802f3c:	6a 00                	push   $0x0
+  802f3e:	6a 00                	push   $0x0
+  802f40:	6a 00                	push   $0x0
+  802f42:	6a 00                	push   $0x0
+  802f44:	ff 73 0c             	push   0xc(%ebx)
+  802f47:	ff 73 04             	push   0x4(%ebx)
+  802f4a:	e8 6a 04 00 00       	call   8033b9 <ipc_call>
+  802f4f:	8b 53 14             	mov    0x14(%ebx),%edx
+  802f52:	8b 43 18             	mov    0x18(%ebx),%eax
+  802f55:	83 c4 20             	add    $0x20,%esp
+  802f58:	39 c2                	cmp    %eax,%edx
+  802f5a:	74 dd                	je     802f39 <ipcring_rsp_wait+0x1e>
+  802f5c:	8b 43 18             	mov    0x18(%ebx),%eax
+  802f5f:	83 e0 07             	and    $0x7,%eax
+  802f62:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802f66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f69:	c9                   	leave
+  802f6a:	c3                   	ret
+  802f6b:	68 80 3d 80 00       	push   $0x803d80
+  802f70:	68 31 3d 80 00       	push   $0x803d31
+  802f75:	6a 3b                	push   $0x3b
+  802f77:	68 a1 3d 80 00       	push   $0x803da1
+  802f7c:	e8 97 02 00 00       	call   803218 <_panic>
+
+00802f81 <ipcring_rsp_pop>:
+  802f81:	55                   	push   %ebp
+  802f82:	89 e5                	mov    %esp,%ebp
+  802f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f87:	8b 42 18             	mov    0x18(%edx),%eax
+  802f8a:	83 c0 01             	add    $0x1,%eax
+  802f8d:	89 42 18             	mov    %eax,0x18(%edx)
+  802f90:	5d                   	pop    %ebp
+  802f91:	c3                   	ret
+
+00802f92 <ipcring_server_init>:
+  802f92:	55                   	push   %ebp
+  802f93:	89 e5                	mov    %esp,%ebp
+  802f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f9b:	89 10                	mov    %edx,(%eax)
+  802f9d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802fa0:	89 50 04             	mov    %edx,0x4(%eax)
+  802fa3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802faa:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802fb1:	5d                   	pop    %ebp
+  802fb2:	c3                   	ret
+
+00802fb3 <ipcring_req_avail>:
+  802fb3:	55                   	push   %ebp
+  802fb4:	89 e5                	mov    %esp,%ebp
+  802fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fb9:	8b 02                	mov    (%edx),%eax
+  802fbb:	8b 40 10             	mov    0x10(%eax),%eax
+  802fbe:	2b 42 08             	sub    0x8(%edx),%eax
+  802fc1:	ba 08 00 00 00       	mov    $0x8,%edx
+  802fc6:	39 d0                	cmp    %edx,%eax
+  802fc8:	0f 47 c2             	cmova  %edx,%eax
+  802fcb:	5d                   	pop    %ebp
+  802fcc:	c3                   	ret
+
+00802fcd <ipcring_req_peek>:
+  802fcd:	55                   	push   %ebp
+  802fce:	89 e5                	mov    %esp,%ebp
+  802fd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fd3:	8b 42 08             	mov    0x8(%edx),%eax
+  802fd6:	83 e0 07             	and    $0x7,%eax
+  802fd9:	8b 12                	mov    (%edx),%edx
+  802fdb:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802fdf:	5d                   	pop    %ebp
+  802fe0:	c3                   	ret
+
+00802fe1 <ipcring_rsp_push>:
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	83 ec 08             	sub    $0x8,%esp
+  802fe7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fea:	8b 41 08             	mov    0x8(%ecx),%eax
+  802fed:	83 c0 01             	add    $0x1,%eax
+  802ff0:	89 41 08             	mov    %eax,0x8(%ecx)
+  802ff3:	8b 11                	mov    (%ecx),%edx
+  802ff5:	83 c2 14             	add    $0x14,%edx
+  802ff8:	f0 87 02             	lock xchg %eax,(%edx)
+  802ffb:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802fff:	75 02                	jne    803003 <ipcring_rsp_push+0x22>
+  803001:	c9                   	leave
+  803002:	c3                   	ret
+  803003:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80300a:	6a 00                	push   $0x0
+  80300c:	68 00 00 80 ee       	push   $0xee800000
+  803011:	6a 00                	push   $0x0
+  803013:	ff 71 04             	push   0x4(%ecx)
+  803016:	e8 5a df ff ff       	call   800f75 <sys_ipc_try_send>
+  80301b:	83 c4 10             	add    $0x10,%esp
+  80301e:	eb e1                	jmp    803001 <ipcring_rsp_push+0x20>
+
+00803020 <ipcring_client_wait>:
+  803020:	55                   	push   %ebp
+  803021:	89 e5                	mov    %esp,%ebp
+  803023:	83 ec 08             	sub    $0x8,%esp
+  803026:	8b 45 08             	mov    0x8(%ebp),%eax
+  803029:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803030:	8b 10                	mov    (%eax),%edx
+  803032:	8b 52 18             	mov    0x18(%edx),%edx
+  803035:	3b 50 08             	cmp    0x8(%eax),%edx
+  803038:	75 02                	jne    80303c <ipcring_client_wait+0x1c>
+  80303a:	c9                   	leave
+  80303b:	c3                   	ret
+  80303c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803043:	6a 00                	push   $0x0
+  803045:	68 00 00 80 ee       	push   $0xee800000
+  80304a:	6a 00                	push   $0x0
+  80304c:	ff 70 04             	push   0x4(%eax)
+  80304f:	e8 21 df ff ff       	call   800f75 <sys_ipc_try_send>
+  803054:	83 c4 10             	add    $0x10,%esp
+  803057:	eb e1                	jmp    80303a <ipcring_client_wait+0x1a>
+
+00803059 <ipcring_server_sleep>:
+  803059:	55                   	push   %ebp
+  80305a:	89 e5                	mov    %esp,%ebp
+  80305c:	53                   	push   %ebx
+  80305d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803060:	8b 01                	mov    (%ecx),%eax
+  803062:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803065:	b8 01 00 00 00       	mov    $0x1,%eax
+  80306a:	f0 87 02             	lock xchg %eax,(%edx)
+  80306d:	8b 11                	mov    (%ecx),%edx
+  80306f:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803072:	b8 01 00 00 00       	mov    $0x1,%eax
+  803077:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80307a:	74 0e                	je     80308a <ipcring_server_sleep+0x31>
+  80307c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803081:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80308d:	c9                   	leave
+  80308e:	c3                   	ret
+
+0080308f <devcons_close>:
+  80308f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803094:	c3                   	ret
+
+00803095 <devcons_stat>:
+  803095:	55                   	push   %ebp
+  803096:	89 e5                	mov    %esp,%ebp
+  803098:	83 ec 10             	sub    $0x10,%esp
+  80309b:	68 af 3d 80 00       	push   $0x803daf
+  8030a0:	ff 75 0c             	push   0xc(%ebp)
+  8030a3:	e8 12 d8 ff ff       	call   8008ba <strcpy>
+  8030a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ad:	c9                   	leave
+  8030ae:	c3                   	ret
+
+008030af <devcons_write>:
+  8030af:	55                   	push   %ebp
+  8030b0:	89 e5                	mov    %esp,%ebp
+  8030b2:	57                   	push   %edi
+  8030b3:	56                   	push   %esi
+  8030b4:	53                   	push   %ebx
+  8030b5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8030bb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8030be:	85 ff                	test   %edi,%edi
+  8030c0:	74 51                	je     803113 <devcons_write+0x64>
+  8030c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8030c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cc:	89 fb                	mov    %edi,%ebx
+  8030ce:	29 c3                	sub    %eax,%ebx
+  8030d0:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8030d5:	39 d3                	cmp    %edx,%ebx
+  8030d7:	0f 47 da             	cmova  %edx,%ebx
+  8030da:	83 ec 04             	sub    $0x4,%esp
+  8030dd:	53                   	push   %ebx
+  8030de:	03 45 0c             	add    0xc(%ebp),%eax
+  8030e1:	50                   	push   %eax
+  8030e2:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8030e8:	50                   	push   %eax
+  8030e9:	e8 7c d9 ff ff       	call   800a6a <memmove>
+  8030ee:	83 c4 08             	add    $0x8,%esp
+  8030f1:	53                   	push   %ebx
+  8030f2:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8030f8:	50                   	push   %eax
+  8030f9:	e8 34 db ff ff       	call   800c32 <sys_cputs>
+  8030fe:	01 de                	add    %ebx,%esi
+  803100:	89 f0                	mov    %esi,%eax
+  803102:	83 c4 10             	add    $0x10,%esp
+  803105:	39 fe                	cmp    %edi,%esi
+  803107:	72 c3                	jb     8030cc <devcons_write+0x1d>
+  803109:	89 f0                	mov    %esi,%eax
+  80310b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80310e:	5b                   	pop    %ebx
+  80310f:	5e                   	pop    %esi
+  803110:	5f                   	pop    %edi
+  803111:	5d                   	pop    %ebp
+  803112:	c3                   	ret
+  803113:	be 00 00 00 00       	mov    $0x0,%esi
+  803118:	eb ef                	jmp    803109 <devcons_write+0x5a>
+
+0080311a <devcons_read>:
+  80311a:	55                   	push   %ebp
+  80311b:	89 e5                	mov    %esp,%ebp
+  80311d:	83 ec 08             	sub    $0x8,%esp
+  803120:	b8 00 00 00 00       	mov    $0x0,%eax
+  803125:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803129:	75 07                	jne    803132 <devcons_read+0x18>
+  80312b:	eb 1f                	jmp    80314c <devcons_read+0x32>
+  80312d:	e8 9d db ff ff       	call   800ccf <sys_yield>
+  803132:	e8 19 db ff ff       	call   800c50 <sys_cgetc>
+  803137:	85 c0                	test   %eax,%eax
+  803139:	74 f2                	je     80312d <devcons_read+0x13>
+  80313b:	78 0f                	js     80314c <devcons_read+0x32>
+  80313d:	83 f8 04             	cmp    $0x4,%eax
+  803140:	74 0c                	je     80314e <devcons_read+0x34>
+  803142:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803145:	88 02                	mov    %al,(%edx)
+  803147:	b8 01 00 00 00       	mov    $0x1,%eax
+  80314c:	c9                   	leave
+  80314d:	c3                   	ret
+  80314e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803153:	eb f7                	jmp    80314c <devcons_read+0x32>
+
+00803155 <cputchar>:
+  803155:	55                   	push   %ebp
+  803156:	89 e5                	mov    %esp,%ebp
+  803158:	83 ec 20             	sub    $0x20,%esp
+  80315b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80315e:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803161:	6a 01                	push   $0x1
+  803163:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803166:	50                   	push   %eax
+  803167:	e8 c6 da ff ff       	call   800c32 <sys_cputs>
+  80316c:	83 c4 10             	add    $0x10,%esp
+  80316f:	c9                   	leave
+  803170:	c3                   	ret
+
+00803171 <getchar>:
+  803171:	55                   	push   %ebp
+  803172:	89 e5                	mov    %esp,%ebp
+  803174:	83 ec 1c             	sub    $0x1c,%esp
+  803177:	6a 01                	push   $0x1
+  803179:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80317c:	50                   	push   %eax
+  80317d:	6a 00                	push   $0x0
+  80317f:	e8 0e ec ff ff       	call   801d92 <read>
+  803184:	83 c4 10             	add    $0x10,%esp
+  803187:	85 c0                	test   %eax,%eax
+  803189:	78 06                	js     803191 <getchar+0x20>
+  80318b:	74 06                	je     803193 <getchar+0x22>
+  80318d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803191:	c9                   	leave
+  803192:	c3                   	ret
+  803193:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803198:	eb f7                	jmp    803191 <getchar+0x20>
+
+0080319a <iscons>:
+  80319a:	55                   	push   %ebp
+  80319b:	89 e5                	mov    %esp,%ebp
+  80319d:	83 ec 20             	sub    $0x20,%esp
+  8031a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031a3:	50                   	push   %eax
+  8031a4:	ff 75 08             	push   0x8(%ebp)
+  8031a7:	e8 84 e9 ff ff       	call   801b30 <fd_lookup>
+  8031ac:	83 c4 10             	add    $0x10,%esp
+  8031af:	85 c0                	test   %eax,%eax
+  8031b1:	78 11                	js     8031c4 <iscons+0x2a>
+  8031b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031b6:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8031bc:	39 10                	cmp    %edx,(%eax)
+  8031be:	0f 94 c0             	sete   %al
+  8031c1:	0f b6 c0             	movzbl %al,%eax
+  8031c4:	c9                   	leave
+  8031c5:	c3                   	ret
+
+008031c6 <opencons>:
+  8031c6:	55                   	push   %ebp
+  8031c7:	89 e5                	mov    %esp,%ebp
+  8031c9:	83 ec 24             	sub    $0x24,%esp
+  8031cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031cf:	50                   	push   %eax
+  8031d0:	e8 0b e9 ff ff       	call   801ae0 <fd_alloc>
+  8031d5:	83 c4 10             	add    $0x10,%esp
+  8031d8:	85 c0                	test   %eax,%eax
+  8031da:	78 3a                	js     803216 <opencons+0x50>
+  8031dc:	83 ec 04             	sub    $0x4,%esp
+  8031df:	68 07 04 00 00       	push   $0x407
+  8031e4:	ff 75 f4             	push   -0xc(%ebp)
+  8031e7:	6a 00                	push   $0x0
+  8031e9:	e8 2c db ff ff       	call   800d1a <sys_page_alloc>
+  8031ee:	83 c4 10             	add    $0x10,%esp
+  8031f1:	85 c0                	test   %eax,%eax
+  8031f3:	78 21                	js     803216 <opencons+0x50>
+  8031f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031f8:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8031fe:	89 10                	mov    %edx,(%eax)
+  803200:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803203:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80320a:	83 ec 0c             	sub    $0xc,%esp
+  80320d:	50                   	push   %eax
+  80320e:	e8 a6 e8 ff ff       	call   801ab9 <fd2num>
+  803213:	83 c4 10             	add    $0x10,%esp
+  803216:	c9                   	leave
+  803217:	c3                   	ret
+
+00803218 <_panic>:
+  803218:	55                   	push   %ebp
+  803219:	89 e5                	mov    %esp,%ebp
+  80321b:	56                   	push   %esi
+  80321c:	53                   	push   %ebx
+  80321d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  803220:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803226:	e8 85 da ff ff       	call   800cb0 <sys_getenvid>
+  80322b:	83 ec 0c             	sub    $0xc,%esp
+  80322e:	ff 75 0c             	push   0xc(%ebp)
+  803231:	ff 75 08             	push   0x8(%ebp)
+  803234:	56                   	push   %esi
+  803235:	50                   	push   %eax
+  803236:	68 bc 3d 80 00       	push   $0x803dbc
+  80323b:	e8 83 cf ff ff       	call   8001c3 <cprintf>
+  803240:	83 c4 18             	add    $0x18,%esp
+  803243:	53                   	push   %ebx
+  803244:	ff 75 10             	push   0x10(%ebp)
+  803247:	e8 26 cf ff ff       	call   800172 <vcprintf>
+  80324c:	c7 04 24 54 38 80 00 	movl   $0x803854,(%esp)
+  803253:	e8 6b cf ff ff       	call   8001c3 <cprintf>
+  803258:	83 c4 10             	add    $0x10,%esp
+  80325b:	cc                   	int3
+  80325c:	eb fd                	jmp    80325b <_panic+0x43>
+
+0080325e <set_pgfault_handler>:
+  80325e:	55                   	push   %ebp
+  80325f:	89 e5                	mov    %esp,%ebp
+  803261:	53                   	push   %ebx
+  803262:	83 ec 04             	sub    $0x4,%esp
+  803265:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80326c:	74 0d                	je     80327b <set_pgfault_handler+0x1d>
+  80326e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803271:	a3 00 80 80 00       	mov    %eax,0x808000
+  803276:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803279:	c9                   	leave
+  80327a:	c3                   	ret
+  80327b:	e8 30 da ff ff       	call   800cb0 <sys_getenvid>
+  803280:	89 c3                	mov    %eax,%ebx
+  803282:	83 ec 04             	sub    $0x4,%esp
+  803285:	6a 07                	push   $0x7
+  803287:	68 00 f0 7f ee       	push   $0xee7ff000
+  80328c:	50                   	push   %eax
+  80328d:	e8 88 da ff ff       	call   800d1a <sys_page_alloc>
+  803292:	83 c4 10             	add    $0x10,%esp
+  803295:	85 c0                	test   %eax,%eax
+  803297:	78 29                	js     8032c2 <set_pgfault_handler+0x64>
+  803299:	83 ec 08             	sub    $0x8,%esp
+  80329c:	68 d6 32 80 00       	push   $0x8032d6
+  8032a1:	53                   	push   %ebx
+  8032a2:	e8 8c dc ff ff       	call   800f33 <sys_env_set_pgfault_upcall>
+  8032a7:	83 c4 10             	add    $0x10,%esp
+  8032aa:	85 c0                	test   %eax,%eax
+  8032ac:	79 c0                	jns    80326e <set_pgfault_handler+0x10>
+  8032ae:	83 ec 04             	sub    $0x4,%esp
+  8032b1:	68 18 3e 80 00       	push   $0x803e18
+  8032b6:	6a 27                	push   $0x27
+  8032b8:	68 4a 3e 80 00       	push   $0x803e4a
+  8032bd:	e8 56 ff ff ff       	call   803218 <_panic>
+  8032c2:	83 ec 04             	sub    $0x4,%esp
+  8032c5:	68 e0 3d 80 00       	push   $0x803de0
+  8032ca:	6a 23                	push   $0x23
+  8032cc:	68 4a 3e 80 00       	push   $0x803e4a
+  8032d1:	e8 42 ff ff ff       	call   803218 <_panic>
+
+008032d6 <_pgfault_upcall>:
+  8032d6:	54                   	push   %esp
+  8032d7:	a1 00 80 80 00       	mov    0x808000,%eax
+  8032dc:	ff d0                	call   *%eax
+  8032de:	83 c4 04             	add    $0x4,%esp
+  8032e1:	89 e3                	mov    %esp,%ebx
+  8032e3:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8032e7:	8b 54 24 30          	mov    0x30(%esp),%edx
+  8032eb:	89 d4                	mov    %edx,%esp
+  8032ed:	51                   	push   %ecx
+  8032ee:	89 dc                	mov    %ebx,%esp
+  8032f0:	83 ea 04             	sub    $0x4,%edx
+  8032f3:	89 54 24 30          	mov    %edx,0x30(%esp)
+  8032f7:	83 c4 08             	add    $0x8,%esp
+  8032fa:	61                   	popa
+  8032fb:	83 c4 04             	add    $0x4,%esp
+  8032fe:	9d                   	popf
+  8032ff:	5c                   	pop    %esp
+  803300:	c3                   	ret
+
+00803301 <ipc_recv>:
+  803301:	55                   	push   %ebp
+  803302:	89 e5                	mov    %esp,%ebp
+  803304:	56                   	push   %esi
+  803305:	53                   	push   %ebx
+  803306:	8b 75 08             	mov    0x8(%ebp),%esi
+  803309:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80330c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80330f:	85 c0                	test   %eax,%eax
+  803311:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803316:	0f 44 c2             	cmove  %edx,%eax
+  803319:	83 ec 0c             	sub    $0xc,%esp
+  80331c:	50                   	push   %eax
+  80331d:	e8 a3 dc ff ff       	call   800fc5 <sys_ipc_recv>
+  803322:	83 c4 10             	add    $0x10,%esp
+  803325:	85 c0                	test   %eax,%eax
+  803327:	78 2a                	js     803353 <ipc_recv+0x52>
+  803329:	a1 14 50 80 00       	mov    0x805014,%eax
+  80332e:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803334:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  80333a:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803340:	85 f6                	test   %esi,%esi
+  803342:	74 02                	je     803346 <ipc_recv+0x45>
+  803344:	89 0e                	mov    %ecx,(%esi)
+  803346:	85 db                	test   %ebx,%ebx
+  803348:	74 02                	je     80334c <ipc_recv+0x4b>
+  80334a:	89 13                	mov    %edx,(%ebx)
+  80334c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80334f:	5b                   	pop    %ebx
+  803350:	5e                   	pop    %esi
+  803351:	5d                   	pop    %ebp
+  803352:	c3                   	ret
+  803353:	ba 00 00 00 00       	mov    $0x0,%edx
+  803358:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80335d:	eb e1                	jmp    803340 <ipc_recv+0x3f>
+
+0080335f <ipc_send>:
+  80335f:	55                   	push   %ebp
+  803360:	89 e5                	mov    %esp,%ebp
+  803362:	57                   	push   %edi
+  803363:	56                   	push   %esi
+  803364:	53                   	push   %ebx
+  803365:	83 ec 0c             	sub    $0xc,%esp
+  803368:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80336b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80336e:	8b 75 14             	mov    0x14(%ebp),%esi
+  803371:	85 db                	test   %ebx,%ebx
+  803373:	74 1e                	je     803393 <ipc_send+0x34>
+  803375:	56                   	push   %esi
+  803376:	53                   	push   %ebx
+  803377:	57                   	push   %edi
+  803378:	ff 75 08             	push   0x8(%ebp)
+  80337b:	e8 d2 dc ff ff       	call   801052 <sys_ipc_send>
+  803380:	83 c4 10             	add    $0x10,%esp
+  803383:	85 c0                	test   %eax,%eax
+  803385:	74 2a                	je     8033b1 <ipc_send+0x52>
+  803387:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80338a:	75 13                	jne    80339f <ipc_send+0x40>
+  80338c:	e8 3e d9 ff ff       	call   800ccf <sys_yield>
+  803391:	eb e2                	jmp    803375 <ipc_send+0x16>
+  803393:	be 00 00 00 00       	mov    $0x0,%esi
+  803398:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80339d:	eb d6                	jmp    803375 <ipc_send+0x16>
+  80339f:	50                   	push   %eax
+  8033a0:	68 58 3e 80 00       	push   $0x803e58
+  8033a5:	6a 4f                	push   $0x4f
+  8033a7:	68 9b 3e 80 00       	push   $0x803e9b
+  8033ac:	e8 67 fe ff ff       	call   803218 <_panic>
+  8033b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b4:	5b                   	pop    %ebx
+  8033b5:	5e                   	pop    %esi
+  8033b6:	5f                   	pop    %edi
+  8033b7:	5d                   	pop    %ebp
+  8033b8:	c3                   	ret
+
+008033b9 <ipc_call>:
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	57                   	push   %edi
+  8033bd:	56                   	push   %esi
+  8033be:	53                   	push   %ebx
+  8033bf:	83 ec 0c             	sub    $0xc,%esp
+  8033c2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033c6:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8033cb:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8033cf:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8033d3:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8033d8:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8033dc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033e5:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  8033e9:	eb 05                	jmp    8033f0 <ipc_call+0x37>
+  8033eb:	e8 df d8 ff ff       	call   800ccf <sys_yield>
+  8033f0:	83 ec 0c             	sub    $0xc,%esp
+  8033f3:	56                   	push   %esi
+  8033f4:	53                   	push   %ebx
+  8033f5:	57                   	push   %edi
+  8033f6:	ff 75 0c             	push   0xc(%ebp)
+  8033f9:	ff 75 08             	push   0x8(%ebp)
+  8033fc:	e8 a1 dc ff ff       	call   8010a2 <sys_ipc_call>
+  803401:	83 c4 20             	add    $0x20,%esp
+  803404:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803407:	74 e2                	je     8033eb <ipc_call+0x32>
+  803409:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80340c:	74 2d                	je     80343b <ipc_call+0x82>
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	78 4f                	js     803461 <ipc_call+0xa8>
+  803412:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803416:	74 10                	je     803428 <ipc_call+0x6f>
+  803418:	a1 14 50 80 00       	mov    0x805014,%eax
+  80341d:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803423:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803426:	89 02                	mov    %eax,(%edx)
+  803428:	a1 14 50 80 00       	mov    0x805014,%eax
+  80342d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803436:	5b                   	pop    %ebx
+  803437:	5e                   	pop    %esi
+  803438:	5f                   	pop    %edi
+  803439:	5d                   	pop    %ebp
+  80343a:	c3                   	ret
+  80343b:	ff 75 14             	push   0x14(%ebp)
+  80343e:	ff 75 10             	push   0x10(%ebp)
+  803441:	ff 75 0c             	push   0xc(%ebp)
+  803444:	ff 75 08             	push   0x8(%ebp)
+  803447:	e8 13 ff ff ff       	call   80335f <ipc_send>
+  80344c:	83 c4 0c             	add    $0xc,%esp
+  80344f:	ff 75 1c             	push   0x1c(%ebp)
+  803452:	ff 75 18             	push   0x18(%ebp)
+  803455:	6a 00                	push   $0x0
+  803457:	e8 a5 fe ff ff       	call   803301 <ipc_recv>
+  80345c:	83 c4 10             	add    $0x10,%esp
+  80345f:	eb d2                	jmp    803433 <ipc_call+0x7a>
+  803461:	50                   	push   %eax
+  803462:	68 a5 3e 80 00       	push   $0x803ea5
+  803467:	6a 6d                	push   $0x6d
+  803469:	68 9b 3e 80 00       	push   $0x803e9b
+  80346e:	e8 a5 fd ff ff       	call   803218 <_panic>
+
+00803473 <ipc_reply_recv>:
+  803473:	55                   	push   %ebp
+  803474:	89 e5                	mov    %esp,%ebp
+  803476:	57                   	push   %edi
+  803477:	56                   	push   %esi
+  803478:	53                   	push   %ebx
+  803479:	83 ec 0c             	sub    $0xc,%esp
+  80347c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80347f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803482:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803485:	85 db                	test   %ebx,%ebx
+  803487:	0f 84 ac 00 00 00    	je     803539 <ipc_reply_recv+0xc6>
+  80348d:	85 f6                	test   %esi,%esi
+  80348f:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803494:	0f 45 c6             	cmovne %esi,%eax
+  803497:	83 ec 0c             	sub    $0xc,%esp
+  80349a:	50                   	push   %eax
+  80349b:	ff 75 14             	push   0x14(%ebp)
+  80349e:	53                   	push   %ebx
+  80349f:	ff 75 0c             	push   0xc(%ebp)
+  8034a2:	ff 75 08             	push   0x8(%ebp)
+  8034a5:	e8 19 dc ff ff       	call   8010c3 <sys_ipc_reply_recv>
+  8034aa:	83 c4 20             	add    $0x20,%esp
+  8034ad:	85 c0                	test   %eax,%eax
+  8034af:	78 3a                	js     8034eb <ipc_reply_recv+0x78>
+  8034b1:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8034b5:	74 10                	je     8034c7 <ipc_reply_recv+0x54>
+  8034b7:	a1 14 50 80 00       	mov    0x805014,%eax
+  8034bc:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8034c2:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034c5:	89 02                	mov    %eax,(%edx)
+  8034c7:	85 ff                	test   %edi,%edi
+  8034c9:	74 0d                	je     8034d8 <ipc_reply_recv+0x65>
+  8034cb:	a1 14 50 80 00       	mov    0x805014,%eax
+  8034d0:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8034d6:	89 07                	mov    %eax,(%edi)
+  8034d8:	a1 14 50 80 00       	mov    0x805014,%eax
+  8034dd:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8034e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034e6:	5b                   	pop    %ebx
+  8034e7:	5e                   	pop    %esi
+  8034e8:	5f                   	pop    %edi
+  8034e9:	5d                   	pop    %ebp
+  8034ea:	c3                   	ret
+  8034eb:	ff 75 14             	push   0x14(%ebp)
+  8034ee:	53                   	push   %ebx
+  8034ef:	ff 75 0c             	push   0xc(%ebp)
+  8034f2:	ff 75 08             	push   0x8(%ebp)
+  8034f5:	e8 7b da ff ff       	call   800f75 <sys_ipc_try_send>
+  8034fa:	89 c2                	mov    %eax,%edx
+  8034fc:	c1 ea 1f             	shr    $0x1f,%edx
+  8034ff:	83 c4 10             	add    $0x10,%esp
+  803502:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803505:	0f 95 c1             	setne  %cl
+  803508:	84 d1                	test   %dl,%cl
+  80350a:	74 05                	je     803511 <ipc_reply_recv+0x9e>
+  80350c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80350f:	75 12                	jne    803523 <ipc_reply_recv+0xb0>
+  803511:	83 ec 04             	sub    $0x4,%esp
+  803514:	57                   	push   %edi
+  803515:	56                   	push   %esi
+  803516:	ff 75 18             	push   0x18(%ebp)
+  803519:	e8 e3 fd ff ff       	call   803301 <ipc_recv>
+  80351e:	83 c4 10             	add    $0x10,%esp
+  803521:	eb c0                	jmp    8034e3 <ipc_reply_recv+0x70>
+  803523:	83 ec 04             	sub    $0x4,%esp
+  803526:	50                   	push   %eax
+  803527:	ff 75 08             	push   0x8(%ebp)
+  80352a:	68 78 3e 80 00       	push   $0x803e78
+  80352f:	e8 8f cc ff ff       	call   8001c3 <cprintf>
+  803534:	83 c4 10             	add    $0x10,%esp
+  803537:	eb d8                	jmp    803511 <ipc_reply_recv+0x9e>
+  803539:	85 f6                	test   %esi,%esi
+  80353b:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803540:	0f 45 c6             	cmovne %esi,%eax
+  803543:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803548:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80354f:	e9 43 ff ff ff       	jmp    803497 <ipc_reply_recv+0x24>
+
+00803554 <ipc_find_env>:
+  803554:	55                   	push   %ebp
+  803555:	89 e5                	mov    %esp,%ebp
+  803557:	83 ec 14             	sub    $0x14,%esp
+  80355a:	ff 75 08             	push   0x8(%ebp)
+  80355d:	e8 b1 d9 ff ff       	call   800f13 <sys_env_service>
+  803562:	85 c0                	test   %eax,%eax
+  803564:	ba 00 00 00 00       	mov    $0x0,%edx
+  803569:	0f 48 c2             	cmovs  %edx,%eax
+  80356c:	c9                   	leave
+  80356d:	c3                   	ret
+
+0080356e <pageref>:
+  80356e:	55                   	push   %ebp
+  80356f:	89 e5                	mov    %esp,%ebp
+  803571:	8b 45 08             	mov    0x8(%ebp),%eax
+  803574:	89 c2                	mov    %eax,%edx
+  803576:	c1 ea 16             	shr    $0x16,%edx
+  803579:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803580:	ba 00 00 00 00       	mov    $0x0,%edx
+  803585:	f6 c1 01             	test   $0x1,%cl
+  803588:	74 22                	je     8035ac <pageref+0x3e>
+  80358a:	c1 e8 0c             	shr    $0xc,%eax
+  80358d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803594:	a8 01                	test   $0x1,%al
+  803596:	74 14                	je     8035ac <pageref+0x3e>
+  803598:	c1 e8 0c             	shr    $0xc,%eax
+  80359b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80359e:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035a5:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035a9:	0f b7 d2             	movzwl %dx,%edx
+  8035ac:	89 d0                	mov    %edx,%eax
+  8035ae:	5d                   	pop    %ebp
+  8035af:	c3                   	ret
+
+008035b0 <__udivmoddi4>:
+  8035b0:	55                   	push   %ebp
+  8035b1:	57                   	push   %edi
+  8035b2:	56                   	push   %esi
+  8035b3:	53                   	push   %ebx
+  8035b4:	83 ec 24             	sub    $0x24,%esp
+  8035b7:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035bb:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035bf:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035c3:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035c7:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8035cb:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8035cf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035d3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035d7:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8035db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035e5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035ea:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035f1:	00 
+  8035f2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035f9:	00 
+  8035fa:	89 fb                	mov    %edi,%ebx
+  8035fc:	eb 08                	jmp    803606 <__udivmoddi4+0x56>
+  8035fe:	83 e9 01             	sub    $0x1,%ecx
+  803601:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803604:	74 68                	je     80366e <__udivmoddi4+0xbe>
+  803606:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80360a:	01 c0                	add    %eax,%eax
+  80360c:	89 c6                	mov    %eax,%esi
+  80360e:	89 d7                	mov    %edx,%edi
+  803610:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803614:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803618:	0f ad d0             	shrd   %cl,%edx,%eax
+  80361b:	d3 ea                	shr    %cl,%edx
+  80361d:	f6 c1 20             	test   $0x20,%cl
+  803620:	74 04                	je     803626 <__udivmoddi4+0x76>
+  803622:	89 d0                	mov    %edx,%eax
+  803624:	31 d2                	xor    %edx,%edx
+  803626:	83 e0 01             	and    $0x1,%eax
+  803629:	89 04 24             	mov    %eax,(%esp)
+  80362c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803633:	00 
+  803634:	8b 04 24             	mov    (%esp),%eax
+  803637:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80363b:	09 f0                	or     %esi,%eax
+  80363d:	09 fa                	or     %edi,%edx
+  80363f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803643:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803647:	39 f0                	cmp    %esi,%eax
+  803649:	89 d5                	mov    %edx,%ebp
+  80364b:	19 fd                	sbb    %edi,%ebp
+  80364d:	72 af                	jb     8035fe <__udivmoddi4+0x4e>
+  80364f:	29 f0                	sub    %esi,%eax
+  803651:	19 fa                	sbb    %edi,%edx
+  803653:	89 cf                	mov    %ecx,%edi
+  803655:	c1 ef 05             	shr    $0x5,%edi
+  803658:	83 e7 01             	and    $0x1,%edi
+  80365b:	89 fe                	mov    %edi,%esi
+  80365d:	83 f6 01             	xor    $0x1,%esi
+  803660:	d3 e6                	shl    %cl,%esi
+  803662:	d3 e7                	shl    %cl,%edi
+  803664:	09 74 24 18          	or     %esi,0x18(%esp)
+  803668:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80366c:	eb 90                	jmp    8035fe <__udivmoddi4+0x4e>
+  80366e:	85 db                	test   %ebx,%ebx
+  803670:	74 05                	je     803677 <__udivmoddi4+0xc7>
+  803672:	89 03                	mov    %eax,(%ebx)
+  803674:	89 53 04             	mov    %edx,0x4(%ebx)
+  803677:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80367b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80367f:	83 c4 24             	add    $0x24,%esp
+  803682:	5b                   	pop    %ebx
+  803683:	5e                   	pop    %esi
+  803684:	5f                   	pop    %edi
+  803685:	5d                   	pop    %ebp
+  803686:	c3                   	ret
+
+00803687 <__udivdi3>:
+  803687:	83 ec 08             	sub    $0x8,%esp
+  80368a:	6a 00                	push   $0x0
+  80368c:	ff 74 24 1c          	push   0x1c(%esp)
+  803690:	ff 74 24 1c          	push   0x1c(%esp)
+  803694:	ff 74 24 1c          	push   0x1c(%esp)
+  803698:	ff 74 24 1c          	push   0x1c(%esp)
+  80369c:	e8 0f ff ff ff       	call   8035b0 <__udivmoddi4>
+  8036a1:	83 c4 1c             	add    $0x1c,%esp
+  8036a4:	c3                   	ret
+
+008036a5 <__umoddi3>:
+  8036a5:	83 ec 18             	sub    $0x18,%esp
+  8036a8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036ac:	50                   	push   %eax
+  8036ad:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b1:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b5:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b9:	ff 74 24 2c          	push   0x2c(%esp)
+  8036bd:	e8 ee fe ff ff       	call   8035b0 <__udivmoddi4>
+  8036c2:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8036c6:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8036ca:	83 c4 2c             	add    $0x2c,%esp
+  8036cd:	c3                   	ret
+
+008036ce <__divdi3>:
+  8036ce:	53                   	push   %ebx
+  8036cf:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036d3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036d7:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036db:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036df:	85 d2                	test   %edx,%edx
+  8036e1:	78 12                	js     8036f5 <__divdi3+0x27>
+  8036e3:	85 db                	test   %ebx,%ebx
+  8036e5:	78 2e                	js     803715 <__divdi3+0x47>
+  8036e7:	53                   	push   %ebx
+  8036e8:	51                   	push   %ecx
+  8036e9:	52                   	push   %edx
+  8036ea:	50                   	push   %eax
+  8036eb:	e8 97 ff ff ff       	call   803687 <__udivdi3>
+  8036f0:	83 c4 10             	add    $0x10,%esp
+  8036f3:	eb 1e                	jmp    803713 <__divdi3+0x45>
+  8036f5:	f7 d8                	neg    %eax
+  8036f7:	83 d2 00             	adc    $0x0,%edx
+  8036fa:	f7 da                	neg    %edx
+  8036fc:	85 db                	test   %ebx,%ebx
+  8036fe:	78 2a                	js     80372a <__divdi3+0x5c>
+  803700:	53                   	push   %ebx
+  803701:	51                   	push   %ecx
+  803702:	52                   	push   %edx
+  803703:	50                   	push   %eax
+  803704:	e8 7e ff ff ff       	call   803687 <__udivdi3>
+  803709:	83 c4 10             	add    $0x10,%esp
+  80370c:	f7 d8                	neg    %eax
+  80370e:	83 d2 00             	adc    $0x0,%edx
+  803711:	f7 da                	neg    %edx
+  803713:	5b                   	pop    %ebx
+  803714:	c3                   	ret
+  803715:	f7 d9                	neg    %ecx
+  803717:	83 d3 00             	adc    $0x0,%ebx
+  80371a:	f7 db                	neg    %ebx
+  80371c:	53                   	push   %ebx
+  80371d:	51                   	push   %ecx
+  80371e:	52                   	push   %edx
+  80371f:	50                   	push   %eax
+  803720:	e8 62 ff ff ff       	call   803687 <__udivdi3>
+  803725:	83 c4 10             	add    $0x10,%esp
+  803728:	eb e2                	jmp    80370c <__divdi3+0x3e>
+  80372a:	f7 d9                	neg    %ecx
+  80372c:	83 d3 00             	adc    $0x0,%ebx
+  80372f:	f7 db                	neg    %ebx
+  803731:	53                   	push   %ebx
+  803732:	51                   	push   %ecx
+  803733:	52                   	push   %edx
+  803734:	50                   	push   %eax
+  803735:	e8 4d ff ff ff       	call   803687 <__udivdi3>
+  80373a:	83 c4 10             	add    $0x10,%esp
+  80373d:	eb d4                	jmp    803713 <__divdi3+0x45>
+
+0080373f <__moddi3>:
+  80373f:	55                   	push   %ebp
+  803740:	57                   	push   %edi
+  803741:	56                   	push   %esi
+  803742:	53                   	push   %ebx
+  803743:	83 ec 0c             	sub    $0xc,%esp
+  803746:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80374a:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80374e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803752:	89 e9                	mov    %ebp,%ecx
+  803754:	f7 d9                	neg    %ecx
+  803756:	89 d0                	mov    %edx,%eax
+  803758:	83 d0 00             	adc    $0x0,%eax
+  80375b:	f7 d8                	neg    %eax
+  80375d:	0f 49 e9             	cmovns %ecx,%ebp
+  803760:	0f 49 d0             	cmovns %eax,%edx
+  803763:	52                   	push   %edx
+  803764:	55                   	push   %ebp
+  803765:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803769:	f7 da                	neg    %edx
+  80376b:	89 d8                	mov    %ebx,%eax
+  80376d:	83 d0 00             	adc    $0x0,%eax
+  803770:	f7 d8                	neg    %eax
+  803772:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803777:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80377b:	0f 48 c3             	cmovs  %ebx,%eax
+  80377e:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803782:	ff 74 24 0c          	push   0xc(%esp)
+  803786:	ff 74 24 0c          	push   0xc(%esp)
+  80378a:	e8 16 ff ff ff       	call   8036a5 <__umoddi3>
+  80378f:	83 c4 10             	add    $0x10,%esp
+  803792:	85 db                	test   %ebx,%ebx
+  803794:	78 08                	js     80379e <__moddi3+0x5f>
+  803796:	83 c4 0c             	add    $0xc,%esp
+  803799:	5b                   	pop    %ebx
+  80379a:	5e                   	pop    %esi
+  80379b:	5f                   	pop    %edi
+  80379c:	5d                   	pop    %ebp
+  80379d:	c3                   	ret
+  80379e:	f7 d8                	neg    %eax
+  8037a0:	83 d2 00             	adc    $0x0,%edx
+  8037a3:	f7 da                	neg    %edx
+  8037a5:	eb ef                	jmp    803796 <__moddi3+0x57>
@@ -0,0 +1,5554 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 ce 00 00 00       	call   8000ff <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	e8 03 0d 00 00       	call   800d40 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800044:	e8 af 17 00 00       	call   8017f8 <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 12                	je     80005f <umain+0x2c>
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+  800055:	e8 05 0d 00 00       	call   800d5f <sys_yield>
+  80005a:	e9 82 00 00 00       	jmp    8000e1 <umain+0xae>
+  80005f:	83 fb 14             	cmp    $0x14,%ebx
+  800062:	74 f1                	je     800055 <umain+0x22>
+  800064:	89 f0                	mov    %esi,%eax
+  800066:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80006b:	69 d0 ac 01 00 00    	imul   $0x1ac,%eax,%edx
+  800071:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800077:	8b 52 54             	mov    0x54(%edx),%edx
+  80007a:	85 d2                	test   %edx,%edx
+  80007c:	74 14                	je     800092 <umain+0x5f>
+  80007e:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800084:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800089:	f3 90                	pause
+  80008b:	8b 50 54             	mov    0x54(%eax),%edx
+  80008e:	85 d2                	test   %edx,%edx
+  800090:	75 f7                	jne    800089 <umain+0x56>
+  800092:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  800097:	e8 c3 0c 00 00       	call   800d5f <sys_yield>
+  80009c:	ba 10 27 00 00       	mov    $0x2710,%edx
+  8000a1:	a1 14 50 80 00       	mov    0x805014,%eax
+  8000a6:	83 c0 01             	add    $0x1,%eax
+  8000a9:	a3 14 50 80 00       	mov    %eax,0x805014
+  8000ae:	83 ea 01             	sub    $0x1,%edx
+  8000b1:	75 ee                	jne    8000a1 <umain+0x6e>
+  8000b3:	83 eb 01             	sub    $0x1,%ebx
+  8000b6:	75 df                	jne    800097 <umain+0x64>
+  8000b8:	a1 14 50 80 00       	mov    0x805014,%eax
+  8000bd:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000c2:	75 24                	jne    8000e8 <umain+0xb5>
+  8000c4:	a1 18 50 80 00       	mov    0x805018,%eax
+  8000c9:	8b 50 5c             	mov    0x5c(%eax),%edx
+  8000cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8000cf:	83 ec 04             	sub    $0x4,%esp
+  8000d2:	52                   	push   %edx
+  8000d3:	50                   	push   %eax
+  8000d4:	68 3b 38 80 00       	push   $0x80383b
+  8000d9:	e8 75 01 00 00       	call   800253 <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e4:	5b                   	pop    %ebx
+  8000e5:	5e                   	pop    %esi
+  8000e6:	5d                   	pop    %ebp
+  8000e7:	c3                   	ret
+  8000e8:	a1 14 50 80 00       	mov    0x805014,%eax
+  8000ed:	50                   	push   %eax
+  8000ee:	68 00 38 80 00       	push   $0x803800
+  8000f3:	6a 20                	push   $0x20
+  8000f5:	68 28 38 80 00       	push   $0x803828
+  8000fa:	e8 79 00 00 00       	call   800178 <_panic>
+
+008000ff <libmain>:
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	56                   	push   %esi
+  800103:	53                   	push   %ebx
+  800104:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800107:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80010a:	e8 31 0c 00 00       	call   800d40 <sys_getenvid>
+  80010f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800114:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80011a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80011f:	a3 18 50 80 00       	mov    %eax,0x805018
+  800124:	85 db                	test   %ebx,%ebx
+  800126:	7e 07                	jle    80012f <libmain+0x30>
+  800128:	8b 06                	mov    (%esi),%eax
+  80012a:	a3 00 40 80 00       	mov    %eax,0x804000
+  80012f:	83 ec 08             	sub    $0x8,%esp
+  800132:	56                   	push   %esi
+  800133:	53                   	push   %ebx
+  800134:	e8 fa fe ff ff       	call   800033 <umain>
+  800139:	e8 0a 00 00 00       	call   800148 <exit>
+  80013e:	83 c4 10             	add    $0x10,%esp
+  800141:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800144:	5b                   	pop    %ebx
+  800145:	5e                   	pop    %esi
+  800146:	5d                   	pop    %ebp
+  800147:	c3                   	ret
+
+00800148 <exit>:
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	83 ec 08             	sub    $0x8,%esp
+  80014e:	a1 18 50 80 00       	mov    0x805018,%eax
+  800153:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800159:	85 c0                	test   %eax,%eax
+  80015b:	75 14                	jne    800171 <exit+0x29>
+  80015d:	e8 b1 1b 00 00       	call   801d13 <close_all>
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	6a 00                	push   $0x0
+  800167:	e8 93 0b 00 00       	call   800cff <sys_env_destroy>
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	c9                   	leave
+  800170:	c3                   	ret
+  800171:	e8 f6 12 00 00       	call   80146c <sys_lease_complete>
+  800176:	eb e5                	jmp    80015d <exit+0x15>
+
+00800178 <_panic>:
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	56                   	push   %esi
+  80017c:	53                   	push   %ebx
+  80017d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800180:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800186:	e8 b5 0b 00 00       	call   800d40 <sys_getenvid>
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	ff 75 0c             	push   0xc(%ebp)
+  800191:	ff 75 08             	push   0x8(%ebp)
+  800194:	56                   	push   %esi
+  800195:	50                   	push   %eax
+  800196:	68 64 38 80 00       	push   $0x803864
+  80019b:	e8 b3 00 00 00       	call   800253 <cprintf>
+  8001a0:	83 c4 18             	add    $0x18,%esp
+  8001a3:	53                   	push   %ebx
+  8001a4:	ff 75 10             	push   0x10(%ebp)
+  8001a7:	e8 56 00 00 00       	call   800202 <vcprintf>
+  8001ac:	c7 04 24 57 38 80 00 	movl   $0x803857,(%esp)
+  8001b3:	e8 9b 00 00 00       	call   800253 <cprintf>
+  8001b8:	83 c4 10             	add    $0x10,%esp
+  8001bb:	cc                   	int3
+  8001bc:	eb fd                	jmp    8001bb <_panic+0x43>
+
+008001be <putch>:
+  8001be:	55                   	push   %ebp
+  8001bf:	89 e5                	mov    %esp,%ebp
+  8001c1:	53                   	push   %ebx
+  8001c2:	83 ec 04             	sub    $0x4,%esp
+  8001c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001c8:	8b 13                	mov    (%ebx),%edx
+  8001ca:	8d 42 01             	lea    0x1(%edx),%eax
+  8001cd:	89 03                	mov    %eax,(%ebx)
+  8001cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001d2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001d6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001db:	74 09                	je     8001e6 <putch+0x28>
+  8001dd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001e4:	c9                   	leave
+  8001e5:	c3                   	ret
+  8001e6:	83 ec 08             	sub    $0x8,%esp
+  8001e9:	68 ff 00 00 00       	push   $0xff
+  8001ee:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001f1:	50                   	push   %eax
+  8001f2:	e8 cb 0a 00 00       	call   800cc2 <sys_cputs>
+  8001f7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001fd:	83 c4 10             	add    $0x10,%esp
+  800200:	eb db                	jmp    8001dd <putch+0x1f>
+
+00800202 <vcprintf>:
+  800202:	55                   	push   %ebp
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80020b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800212:	00 00 00 
+  800215:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80021c:	00 00 00 
+  80021f:	ff 75 0c             	push   0xc(%ebp)
+  800222:	ff 75 08             	push   0x8(%ebp)
+  800225:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80022b:	50                   	push   %eax
+  80022c:	68 be 01 80 00       	push   $0x8001be
+  800231:	e8 1c 01 00 00       	call   800352 <vprintfmt>
+  800236:	83 c4 08             	add    $0x8,%esp
+  800239:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80023f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800245:	50                   	push   %eax
+  800246:	e8 77 0a 00 00       	call   800cc2 <sys_cputs>
+  80024b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800251:	c9                   	leave
+  800252:	c3                   	ret
+
+00800253 <cprintf>:
+  800253:	55                   	push   %ebp
+  800254:	89 e5                	mov    %esp,%ebp
+  800256:	83 ec 10             	sub    $0x10,%esp
+  800259:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80025c:	50                   	push   %eax
+  80025d:	ff 75 08             	push   0x8(%ebp)
+  800260:	e8 9d ff ff ff       	call   800202 <vcprintf>
+  800265:	c9                   	leave
+  800266:	c3                   	ret
+
+00800267 <printnum>:
+  800267:	55                   	push   %ebp
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	57                   	push   %edi
+  80026b:	56                   	push   %esi
+  80026c:	53                   	push   %ebx
+  80026d:	83 ec 1c             	sub    $0x1c,%esp
+  800270:	89 c3                	mov    %eax,%ebx
+  800272:	89 d6                	mov    %edx,%esi
+  800274:	8b 45 08             	mov    0x8(%ebp),%eax
+  800277:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80027a:	89 d1                	mov    %edx,%ecx
+  80027c:	89 c2                	mov    %eax,%edx
+  80027e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800281:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800284:	8b 45 10             	mov    0x10(%ebp),%eax
+  800287:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80028a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800291:	39 c2                	cmp    %eax,%edx
+  800293:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800296:	73 4b                	jae    8002e3 <printnum+0x7c>
+  800298:	8b 45 14             	mov    0x14(%ebp),%eax
+  80029b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80029e:	85 ff                	test   %edi,%edi
+  8002a0:	7e 11                	jle    8002b3 <printnum+0x4c>
+  8002a2:	83 ec 08             	sub    $0x8,%esp
+  8002a5:	56                   	push   %esi
+  8002a6:	ff 75 18             	push   0x18(%ebp)
+  8002a9:	ff d3                	call   *%ebx
+  8002ab:	83 c4 10             	add    $0x10,%esp
+  8002ae:	83 ef 01             	sub    $0x1,%edi
+  8002b1:	75 ef                	jne    8002a2 <printnum+0x3b>
+  8002b3:	83 ec 08             	sub    $0x8,%esp
+  8002b6:	56                   	push   %esi
+  8002b7:	83 ec 04             	sub    $0x4,%esp
+  8002ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8002bd:	ff 75 e0             	push   -0x20(%ebp)
+  8002c0:	ff 75 dc             	push   -0x24(%ebp)
+  8002c3:	ff 75 d8             	push   -0x28(%ebp)
+  8002c6:	e8 24 34 00 00       	call   8036ef <__umoddi3>
+  8002cb:	83 c4 14             	add    $0x14,%esp
+  8002ce:	0f be 80 87 38 80 00 	movsbl 0x803887(%eax),%eax
+  8002d5:	50                   	push   %eax
+  8002d6:	ff d3                	call   *%ebx
+  8002d8:	83 c4 10             	add    $0x10,%esp
+  8002db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002de:	5b                   	pop    %ebx
+  8002df:	5e                   	pop    %esi
+  8002e0:	5f                   	pop    %edi
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+  8002e3:	83 ec 0c             	sub    $0xc,%esp
+  8002e6:	ff 75 18             	push   0x18(%ebp)
+  8002e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002ec:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002ef:	52                   	push   %edx
+  8002f0:	50                   	push   %eax
+  8002f1:	83 ec 08             	sub    $0x8,%esp
+  8002f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f7:	ff 75 e0             	push   -0x20(%ebp)
+  8002fa:	ff 75 dc             	push   -0x24(%ebp)
+  8002fd:	ff 75 d8             	push   -0x28(%ebp)
+  800300:	e8 cc 33 00 00       	call   8036d1 <__udivdi3>
+  800305:	83 c4 18             	add    $0x18,%esp
+  800308:	52                   	push   %edx
+  800309:	50                   	push   %eax
+  80030a:	89 f2                	mov    %esi,%edx
+  80030c:	89 d8                	mov    %ebx,%eax
+  80030e:	e8 54 ff ff ff       	call   800267 <printnum>
+  800313:	83 c4 20             	add    $0x20,%esp
+  800316:	eb 9b                	jmp    8002b3 <printnum+0x4c>
+
+00800318 <sprintputch>:
+  800318:	55                   	push   %ebp
+  800319:	89 e5                	mov    %esp,%ebp
+  80031b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80031e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800322:	8b 10                	mov    (%eax),%edx
+  800324:	3b 50 04             	cmp    0x4(%eax),%edx
+  800327:	73 0a                	jae    800333 <sprintputch+0x1b>
+  800329:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80032c:	89 08                	mov    %ecx,(%eax)
+  80032e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800331:	88 02                	mov    %al,(%edx)
+  800333:	5d                   	pop    %ebp
+  800334:	c3                   	ret
+
+00800335 <printfmt>:
+  800335:	55                   	push   %ebp
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	83 ec 08             	sub    $0x8,%esp
+  80033b:	8d 45 14             	lea    0x14(%ebp),%eax
+  80033e:	50                   	push   %eax
+  80033f:	ff 75 10             	push   0x10(%ebp)
+  800342:	ff 75 0c             	push   0xc(%ebp)
+  800345:	ff 75 08             	push   0x8(%ebp)
+  800348:	e8 05 00 00 00       	call   800352 <vprintfmt>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	c9                   	leave
+  800351:	c3                   	ret
+
+00800352 <vprintfmt>:
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	57                   	push   %edi
+  800356:	56                   	push   %esi
+  800357:	53                   	push   %ebx
+  800358:	83 ec 2c             	sub    $0x2c,%esp
+  80035b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80035e:	89 df                	mov    %ebx,%edi
+  800360:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800363:	8b 45 10             	mov    0x10(%ebp),%eax
+  800366:	8d 70 01             	lea    0x1(%eax),%esi
+  800369:	0f b6 00             	movzbl (%eax),%eax
+  80036c:	83 f8 25             	cmp    $0x25,%eax
+  80036f:	74 1e                	je     80038f <vprintfmt+0x3d>
+  800371:	85 c0                	test   %eax,%eax
+  800373:	0f 84 15 05 00 00    	je     80088e <vprintfmt+0x53c>
+  800379:	83 ec 08             	sub    $0x8,%esp
+  80037c:	53                   	push   %ebx
+  80037d:	50                   	push   %eax
+  80037e:	ff d7                	call   *%edi
+  800380:	83 c6 01             	add    $0x1,%esi
+  800383:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800387:	83 c4 10             	add    $0x10,%esp
+  80038a:	83 f8 25             	cmp    $0x25,%eax
+  80038d:	75 e2                	jne    800371 <vprintfmt+0x1f>
+  80038f:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800393:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80039a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003a1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8003a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ad:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8003b0:	8d 56 01             	lea    0x1(%esi),%edx
+  8003b3:	0f b6 0e             	movzbl (%esi),%ecx
+  8003b6:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003b9:	3c 55                	cmp    $0x55,%al
+  8003bb:	0f 87 3b 04 00 00    	ja     8007fc <vprintfmt+0x4aa>
+  8003c1:	0f b6 c0             	movzbl %al,%eax
+  8003c4:	ff 24 85 c0 39 80 00 	jmp    *0x8039c0(,%eax,4)
+  8003cb:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003ce:	eb 93                	jmp    800363 <vprintfmt+0x11>
+  8003d0:	89 d6                	mov    %edx,%esi
+  8003d2:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003d6:	eb d8                	jmp    8003b0 <vprintfmt+0x5e>
+  8003d8:	89 d6                	mov    %edx,%esi
+  8003da:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003de:	eb d0                	jmp    8003b0 <vprintfmt+0x5e>
+  8003e0:	0f b6 c9             	movzbl %cl,%ecx
+  8003e3:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003e6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003e9:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003ed:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003f0:	83 f9 09             	cmp    $0x9,%ecx
+  8003f3:	77 6f                	ja     800464 <vprintfmt+0x112>
+  8003f5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003f8:	83 c2 01             	add    $0x1,%edx
+  8003fb:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003fe:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800402:	0f be 02             	movsbl (%edx),%eax
+  800405:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800408:	83 fe 09             	cmp    $0x9,%esi
+  80040b:	76 eb                	jbe    8003f8 <vprintfmt+0xa6>
+  80040d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800410:	89 d6                	mov    %edx,%esi
+  800412:	eb 13                	jmp    800427 <vprintfmt+0xd5>
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8b 00                	mov    (%eax),%eax
+  800419:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80041c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041f:	8d 40 04             	lea    0x4(%eax),%eax
+  800422:	89 45 14             	mov    %eax,0x14(%ebp)
+  800425:	89 d6                	mov    %edx,%esi
+  800427:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80042b:	79 83                	jns    8003b0 <vprintfmt+0x5e>
+  80042d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800430:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800433:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80043a:	e9 71 ff ff ff       	jmp    8003b0 <vprintfmt+0x5e>
+  80043f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800442:	85 c9                	test   %ecx,%ecx
+  800444:	b8 00 00 00 00       	mov    $0x0,%eax
+  800449:	0f 49 c1             	cmovns %ecx,%eax
+  80044c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80044f:	89 d6                	mov    %edx,%esi
+  800451:	e9 5a ff ff ff       	jmp    8003b0 <vprintfmt+0x5e>
+  800456:	89 d6                	mov    %edx,%esi
+  800458:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80045f:	e9 4c ff ff ff       	jmp    8003b0 <vprintfmt+0x5e>
+  800464:	89 d6                	mov    %edx,%esi
+  800466:	eb bf                	jmp    800427 <vprintfmt+0xd5>
+  800468:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80046c:	89 d6                	mov    %edx,%esi
+  80046e:	e9 3d ff ff ff       	jmp    8003b0 <vprintfmt+0x5e>
+  800473:	89 55 10             	mov    %edx,0x10(%ebp)
+  800476:	8b 45 14             	mov    0x14(%ebp),%eax
+  800479:	8d 70 04             	lea    0x4(%eax),%esi
+  80047c:	83 ec 08             	sub    $0x8,%esp
+  80047f:	53                   	push   %ebx
+  800480:	ff 30                	push   (%eax)
+  800482:	ff d7                	call   *%edi
+  800484:	83 c4 10             	add    $0x10,%esp
+  800487:	89 75 14             	mov    %esi,0x14(%ebp)
+  80048a:	e9 d4 fe ff ff       	jmp    800363 <vprintfmt+0x11>
+  80048f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800492:	8b 45 14             	mov    0x14(%ebp),%eax
+  800495:	8d 70 04             	lea    0x4(%eax),%esi
+  800498:	8b 10                	mov    (%eax),%edx
+  80049a:	89 d0                	mov    %edx,%eax
+  80049c:	f7 d8                	neg    %eax
+  80049e:	0f 48 c2             	cmovs  %edx,%eax
+  8004a1:	83 f8 12             	cmp    $0x12,%eax
+  8004a4:	7f 23                	jg     8004c9 <vprintfmt+0x177>
+  8004a6:	8b 14 85 20 3b 80 00 	mov    0x803b20(,%eax,4),%edx
+  8004ad:	85 d2                	test   %edx,%edx
+  8004af:	74 18                	je     8004c9 <vprintfmt+0x177>
+  8004b1:	52                   	push   %edx
+  8004b2:	68 63 3d 80 00       	push   $0x803d63
+  8004b7:	53                   	push   %ebx
+  8004b8:	57                   	push   %edi
+  8004b9:	e8 77 fe ff ff       	call   800335 <printfmt>
+  8004be:	83 c4 10             	add    $0x10,%esp
+  8004c1:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004c4:	e9 9a fe ff ff       	jmp    800363 <vprintfmt+0x11>
+  8004c9:	50                   	push   %eax
+  8004ca:	68 9f 38 80 00       	push   $0x80389f
+  8004cf:	53                   	push   %ebx
+  8004d0:	57                   	push   %edi
+  8004d1:	e8 5f fe ff ff       	call   800335 <printfmt>
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004dc:	e9 82 fe ff ff       	jmp    800363 <vprintfmt+0x11>
+  8004e1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e7:	83 c0 04             	add    $0x4,%eax
+  8004ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f0:	8b 00                	mov    (%eax),%eax
+  8004f2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004f5:	85 c0                	test   %eax,%eax
+  8004f7:	0f 84 61 03 00 00    	je     80085e <vprintfmt+0x50c>
+  8004fd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800501:	7e 06                	jle    800509 <vprintfmt+0x1b7>
+  800503:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800507:	75 29                	jne    800532 <vprintfmt+0x1e0>
+  800509:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80050c:	8d 70 01             	lea    0x1(%eax),%esi
+  80050f:	0f b6 00             	movzbl (%eax),%eax
+  800512:	0f be d0             	movsbl %al,%edx
+  800515:	85 d2                	test   %edx,%edx
+  800517:	0f 84 bb 00 00 00    	je     8005d8 <vprintfmt+0x286>
+  80051d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800520:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800523:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800526:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800529:	eb 7a                	jmp    8005a5 <vprintfmt+0x253>
+  80052b:	c7 45 d0 98 38 80 00 	movl   $0x803898,-0x30(%ebp)
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	ff 75 d4             	push   -0x2c(%ebp)
+  800538:	ff 75 d0             	push   -0x30(%ebp)
+  80053b:	e8 e0 03 00 00       	call   800920 <strnlen>
+  800540:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800543:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800546:	83 c4 10             	add    $0x10,%esp
+  800549:	85 d2                	test   %edx,%edx
+  80054b:	0f 8e d6 02 00 00    	jle    800827 <vprintfmt+0x4d5>
+  800551:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800555:	83 ec 08             	sub    $0x8,%esp
+  800558:	53                   	push   %ebx
+  800559:	56                   	push   %esi
+  80055a:	ff d7                	call   *%edi
+  80055c:	83 c4 10             	add    $0x10,%esp
+  80055f:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800563:	75 f0                	jne    800555 <vprintfmt+0x203>
+  800565:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800568:	8d 70 01             	lea    0x1(%eax),%esi
+  80056b:	0f b6 00             	movzbl (%eax),%eax
+  80056e:	0f be d0             	movsbl %al,%edx
+  800571:	85 d2                	test   %edx,%edx
+  800573:	0f 84 da 02 00 00    	je     800853 <vprintfmt+0x501>
+  800579:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80057c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80057f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800582:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800585:	eb 1e                	jmp    8005a5 <vprintfmt+0x253>
+  800587:	83 ec 08             	sub    $0x8,%esp
+  80058a:	ff 75 0c             	push   0xc(%ebp)
+  80058d:	52                   	push   %edx
+  80058e:	ff 55 08             	call   *0x8(%ebp)
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	83 eb 01             	sub    $0x1,%ebx
+  800597:	83 c6 01             	add    $0x1,%esi
+  80059a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80059e:	0f be d0             	movsbl %al,%edx
+  8005a1:	85 d2                	test   %edx,%edx
+  8005a3:	74 2a                	je     8005cf <vprintfmt+0x27d>
+  8005a5:	85 ff                	test   %edi,%edi
+  8005a7:	78 05                	js     8005ae <vprintfmt+0x25c>
+  8005a9:	83 ef 01             	sub    $0x1,%edi
+  8005ac:	78 59                	js     800607 <vprintfmt+0x2b5>
+  8005ae:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005b2:	74 d3                	je     800587 <vprintfmt+0x235>
+  8005b4:	0f be c0             	movsbl %al,%eax
+  8005b7:	83 e8 20             	sub    $0x20,%eax
+  8005ba:	83 f8 5e             	cmp    $0x5e,%eax
+  8005bd:	76 c8                	jbe    800587 <vprintfmt+0x235>
+  8005bf:	83 ec 08             	sub    $0x8,%esp
+  8005c2:	ff 75 0c             	push   0xc(%ebp)
+  8005c5:	6a 3f                	push   $0x3f
+  8005c7:	ff 55 08             	call   *0x8(%ebp)
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	eb c5                	jmp    800594 <vprintfmt+0x242>
+  8005cf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005db:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005df:	7e 1b                	jle    8005fc <vprintfmt+0x2aa>
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 20                	push   $0x20
+  8005e7:	ff d7                	call   *%edi
+  8005e9:	83 c4 10             	add    $0x10,%esp
+  8005ec:	83 ee 01             	sub    $0x1,%esi
+  8005ef:	75 f0                	jne    8005e1 <vprintfmt+0x28f>
+  8005f1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f7:	e9 67 fd ff ff       	jmp    800363 <vprintfmt+0x11>
+  8005fc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  800602:	e9 5c fd ff ff       	jmp    800363 <vprintfmt+0x11>
+  800607:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80060a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80060d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800610:	eb c6                	jmp    8005d8 <vprintfmt+0x286>
+  800612:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800615:	89 55 10             	mov    %edx,0x10(%ebp)
+  800618:	83 f9 01             	cmp    $0x1,%ecx
+  80061b:	7f 1f                	jg     80063c <vprintfmt+0x2ea>
+  80061d:	85 c9                	test   %ecx,%ecx
+  80061f:	74 67                	je     800688 <vprintfmt+0x336>
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 30                	mov    (%eax),%esi
+  800626:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800629:	89 f0                	mov    %esi,%eax
+  80062b:	c1 f8 1f             	sar    $0x1f,%eax
+  80062e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063a:	eb 17                	jmp    800653 <vprintfmt+0x301>
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 50 04             	mov    0x4(%eax),%edx
+  800642:	8b 00                	mov    (%eax),%eax
+  800644:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800647:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8d 40 08             	lea    0x8(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+  800653:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800656:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800659:	be 0a 00 00 00       	mov    $0xa,%esi
+  80065e:	85 c9                	test   %ecx,%ecx
+  800660:	0f 89 12 01 00 00    	jns    800778 <vprintfmt+0x426>
+  800666:	83 ec 08             	sub    $0x8,%esp
+  800669:	53                   	push   %ebx
+  80066a:	6a 2d                	push   $0x2d
+  80066c:	ff d7                	call   *%edi
+  80066e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800671:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800674:	f7 da                	neg    %edx
+  800676:	83 d1 00             	adc    $0x0,%ecx
+  800679:	f7 d9                	neg    %ecx
+  80067b:	83 c4 10             	add    $0x10,%esp
+  80067e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800683:	e9 f0 00 00 00       	jmp    800778 <vprintfmt+0x426>
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 30                	mov    (%eax),%esi
+  80068d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800690:	89 f0                	mov    %esi,%eax
+  800692:	c1 f8 1f             	sar    $0x1f,%eax
+  800695:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a1:	eb b0                	jmp    800653 <vprintfmt+0x301>
+  8006a3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006a6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ac:	7f 1e                	jg     8006cc <vprintfmt+0x37a>
+  8006ae:	85 c9                	test   %ecx,%ecx
+  8006b0:	74 32                	je     8006e4 <vprintfmt+0x392>
+  8006b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b5:	8b 10                	mov    (%eax),%edx
+  8006b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006c7:	e9 ac 00 00 00       	jmp    800778 <vprintfmt+0x426>
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 10                	mov    (%eax),%edx
+  8006d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006da:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006df:	e9 94 00 00 00       	jmp    800778 <vprintfmt+0x426>
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 10                	mov    (%eax),%edx
+  8006e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006f9:	eb 7d                	jmp    800778 <vprintfmt+0x426>
+  8006fb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006fe:	89 55 10             	mov    %edx,0x10(%ebp)
+  800701:	83 f9 01             	cmp    $0x1,%ecx
+  800704:	7f 1b                	jg     800721 <vprintfmt+0x3cf>
+  800706:	85 c9                	test   %ecx,%ecx
+  800708:	74 2c                	je     800736 <vprintfmt+0x3e4>
+  80070a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070d:	8b 10                	mov    (%eax),%edx
+  80070f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800714:	8d 40 04             	lea    0x4(%eax),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071a:	be 08 00 00 00       	mov    $0x8,%esi
+  80071f:	eb 57                	jmp    800778 <vprintfmt+0x426>
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	8b 48 04             	mov    0x4(%eax),%ecx
+  800729:	8d 40 08             	lea    0x8(%eax),%eax
+  80072c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072f:	be 08 00 00 00       	mov    $0x8,%esi
+  800734:	eb 42                	jmp    800778 <vprintfmt+0x426>
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	8b 10                	mov    (%eax),%edx
+  80073b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800740:	8d 40 04             	lea    0x4(%eax),%eax
+  800743:	89 45 14             	mov    %eax,0x14(%ebp)
+  800746:	be 08 00 00 00       	mov    $0x8,%esi
+  80074b:	eb 2b                	jmp    800778 <vprintfmt+0x426>
+  80074d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	53                   	push   %ebx
+  800754:	6a 30                	push   $0x30
+  800756:	ff d7                	call   *%edi
+  800758:	83 c4 08             	add    $0x8,%esp
+  80075b:	53                   	push   %ebx
+  80075c:	6a 78                	push   $0x78
+  80075e:	ff d7                	call   *%edi
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 10                	mov    (%eax),%edx
+  800765:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076a:	83 c4 10             	add    $0x10,%esp
+  80076d:	8d 40 04             	lea    0x4(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+  800773:	be 10 00 00 00       	mov    $0x10,%esi
+  800778:	83 ec 0c             	sub    $0xc,%esp
+  80077b:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80077f:	50                   	push   %eax
+  800780:	ff 75 e4             	push   -0x1c(%ebp)
+  800783:	56                   	push   %esi
+  800784:	51                   	push   %ecx
+  800785:	52                   	push   %edx
+  800786:	89 da                	mov    %ebx,%edx
+  800788:	89 f8                	mov    %edi,%eax
+  80078a:	e8 d8 fa ff ff       	call   800267 <printnum>
+  80078f:	83 c4 20             	add    $0x20,%esp
+  800792:	e9 cc fb ff ff       	jmp    800363 <vprintfmt+0x11>
+  800797:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80079a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80079d:	83 f9 01             	cmp    $0x1,%ecx
+  8007a0:	7f 1b                	jg     8007bd <vprintfmt+0x46b>
+  8007a2:	85 c9                	test   %ecx,%ecx
+  8007a4:	74 2c                	je     8007d2 <vprintfmt+0x480>
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b6:	be 10 00 00 00       	mov    $0x10,%esi
+  8007bb:	eb bb                	jmp    800778 <vprintfmt+0x426>
+  8007bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c0:	8b 10                	mov    (%eax),%edx
+  8007c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007cb:	be 10 00 00 00       	mov    $0x10,%esi
+  8007d0:	eb a6                	jmp    800778 <vprintfmt+0x426>
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8b 10                	mov    (%eax),%edx
+  8007d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8007df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e2:	be 10 00 00 00       	mov    $0x10,%esi
+  8007e7:	eb 8f                	jmp    800778 <vprintfmt+0x426>
+  8007e9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	53                   	push   %ebx
+  8007f0:	6a 25                	push   $0x25
+  8007f2:	ff d7                	call   *%edi
+  8007f4:	83 c4 10             	add    $0x10,%esp
+  8007f7:	e9 67 fb ff ff       	jmp    800363 <vprintfmt+0x11>
+  8007fc:	83 ec 08             	sub    $0x8,%esp
+  8007ff:	53                   	push   %ebx
+  800800:	6a 25                	push   $0x25
+  800802:	ff d7                	call   *%edi
+  800804:	83 c4 10             	add    $0x10,%esp
+  800807:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80080b:	0f 84 ba fb ff ff    	je     8003cb <vprintfmt+0x79>
+  800811:	89 75 10             	mov    %esi,0x10(%ebp)
+  800814:	89 f0                	mov    %esi,%eax
+  800816:	83 e8 01             	sub    $0x1,%eax
+  800819:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80081d:	75 f7                	jne    800816 <vprintfmt+0x4c4>
+  80081f:	89 45 10             	mov    %eax,0x10(%ebp)
+  800822:	e9 3c fb ff ff       	jmp    800363 <vprintfmt+0x11>
+  800827:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80082a:	8d 70 01             	lea    0x1(%eax),%esi
+  80082d:	0f b6 00             	movzbl (%eax),%eax
+  800830:	0f be d0             	movsbl %al,%edx
+  800833:	85 d2                	test   %edx,%edx
+  800835:	74 11                	je     800848 <vprintfmt+0x4f6>
+  800837:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80083a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80083d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800840:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800843:	e9 5d fd ff ff       	jmp    8005a5 <vprintfmt+0x253>
+  800848:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084e:	e9 10 fb ff ff       	jmp    800363 <vprintfmt+0x11>
+  800853:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800856:	89 45 14             	mov    %eax,0x14(%ebp)
+  800859:	e9 05 fb ff ff       	jmp    800363 <vprintfmt+0x11>
+  80085e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800862:	7e 0a                	jle    80086e <vprintfmt+0x51c>
+  800864:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800868:	0f 85 bd fc ff ff    	jne    80052b <vprintfmt+0x1d9>
+  80086e:	ba 28 00 00 00       	mov    $0x28,%edx
+  800873:	b8 28 00 00 00       	mov    $0x28,%eax
+  800878:	be 99 38 80 00       	mov    $0x803899,%esi
+  80087d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800880:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800883:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800886:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800889:	e9 17 fd ff ff       	jmp    8005a5 <vprintfmt+0x253>
+  80088e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800891:	5b                   	pop    %ebx
+  800892:	5e                   	pop    %esi
+  800893:	5f                   	pop    %edi
+  800894:	5d                   	pop    %ebp
+  800895:	c3                   	ret
+
+00800896 <vsnprintf>:
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	83 ec 18             	sub    $0x18,%esp
+  80089c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008a5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008a9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8008b3:	85 c0                	test   %eax,%eax
+  8008b5:	74 26                	je     8008dd <vsnprintf+0x47>
+  8008b7:	85 d2                	test   %edx,%edx
+  8008b9:	7e 22                	jle    8008dd <vsnprintf+0x47>
+  8008bb:	ff 75 14             	push   0x14(%ebp)
+  8008be:	ff 75 10             	push   0x10(%ebp)
+  8008c1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008c4:	50                   	push   %eax
+  8008c5:	68 18 03 80 00       	push   $0x800318
+  8008ca:	e8 83 fa ff ff       	call   800352 <vprintfmt>
+  8008cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008d2:	c6 00 00             	movb   $0x0,(%eax)
+  8008d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d8:	83 c4 10             	add    $0x10,%esp
+  8008db:	c9                   	leave
+  8008dc:	c3                   	ret
+  8008dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008e2:	eb f7                	jmp    8008db <vsnprintf+0x45>
+
+008008e4 <snprintf>:
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	83 ec 08             	sub    $0x8,%esp
+  8008ea:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008ed:	50                   	push   %eax
+  8008ee:	ff 75 10             	push   0x10(%ebp)
+  8008f1:	ff 75 0c             	push   0xc(%ebp)
+  8008f4:	ff 75 08             	push   0x8(%ebp)
+  8008f7:	e8 9a ff ff ff       	call   800896 <vsnprintf>
+  8008fc:	c9                   	leave
+  8008fd:	c3                   	ret
+
+008008fe <strlen>:
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	8b 55 08             	mov    0x8(%ebp),%edx
+  800904:	80 3a 00             	cmpb   $0x0,(%edx)
+  800907:	74 10                	je     800919 <strlen+0x1b>
+  800909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090e:	83 c0 01             	add    $0x1,%eax
+  800911:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800915:	75 f7                	jne    80090e <strlen+0x10>
+  800917:	5d                   	pop    %ebp
+  800918:	c3                   	ret
+  800919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091e:	eb f7                	jmp    800917 <strlen+0x19>
+
+00800920 <strnlen>:
+  800920:	55                   	push   %ebp
+  800921:	89 e5                	mov    %esp,%ebp
+  800923:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800926:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800929:	85 d2                	test   %edx,%edx
+  80092b:	74 16                	je     800943 <strnlen+0x23>
+  80092d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800932:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800936:	74 09                	je     800941 <strnlen+0x21>
+  800938:	83 c0 01             	add    $0x1,%eax
+  80093b:	39 d0                	cmp    %edx,%eax
+  80093d:	75 f3                	jne    800932 <strnlen+0x12>
+  80093f:	89 d0                	mov    %edx,%eax
+  800941:	5d                   	pop    %ebp
+  800942:	c3                   	ret
+  800943:	b8 00 00 00 00       	mov    $0x0,%eax
+  800948:	eb f7                	jmp    800941 <strnlen+0x21>
+
+0080094a <strcpy>:
+  80094a:	55                   	push   %ebp
+  80094b:	89 e5                	mov    %esp,%ebp
+  80094d:	53                   	push   %ebx
+  80094e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800951:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800954:	b8 00 00 00 00       	mov    $0x0,%eax
+  800959:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80095d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800960:	83 c0 01             	add    $0x1,%eax
+  800963:	84 d2                	test   %dl,%dl
+  800965:	75 f2                	jne    800959 <strcpy+0xf>
+  800967:	89 c8                	mov    %ecx,%eax
+  800969:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80096c:	c9                   	leave
+  80096d:	c3                   	ret
+
+0080096e <strcat>:
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	53                   	push   %ebx
+  800972:	83 ec 10             	sub    $0x10,%esp
+  800975:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800978:	53                   	push   %ebx
+  800979:	e8 80 ff ff ff       	call   8008fe <strlen>
+  80097e:	83 c4 08             	add    $0x8,%esp
+  800981:	ff 75 0c             	push   0xc(%ebp)
+  800984:	01 d8                	add    %ebx,%eax
+  800986:	50                   	push   %eax
+  800987:	e8 be ff ff ff       	call   80094a <strcpy>
+  80098c:	89 d8                	mov    %ebx,%eax
+  80098e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800991:	c9                   	leave
+  800992:	c3                   	ret
+
+00800993 <strncpy>:
+  800993:	55                   	push   %ebp
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	56                   	push   %esi
+  800997:	53                   	push   %ebx
+  800998:	8b 75 08             	mov    0x8(%ebp),%esi
+  80099b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009a1:	85 db                	test   %ebx,%ebx
+  8009a3:	74 17                	je     8009bc <strncpy+0x29>
+  8009a5:	01 f3                	add    %esi,%ebx
+  8009a7:	89 f0                	mov    %esi,%eax
+  8009a9:	83 c0 01             	add    $0x1,%eax
+  8009ac:	0f b6 0a             	movzbl (%edx),%ecx
+  8009af:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009b2:	80 f9 01             	cmp    $0x1,%cl
+  8009b5:	83 da ff             	sbb    $0xffffffff,%edx
+  8009b8:	39 c3                	cmp    %eax,%ebx
+  8009ba:	75 ed                	jne    8009a9 <strncpy+0x16>
+  8009bc:	89 f0                	mov    %esi,%eax
+  8009be:	5b                   	pop    %ebx
+  8009bf:	5e                   	pop    %esi
+  8009c0:	5d                   	pop    %ebp
+  8009c1:	c3                   	ret
+
+008009c2 <strlcpy>:
+  8009c2:	55                   	push   %ebp
+  8009c3:	89 e5                	mov    %esp,%ebp
+  8009c5:	56                   	push   %esi
+  8009c6:	53                   	push   %ebx
+  8009c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009d0:	89 f0                	mov    %esi,%eax
+  8009d2:	85 db                	test   %ebx,%ebx
+  8009d4:	74 1e                	je     8009f4 <strlcpy+0x32>
+  8009d6:	83 eb 01             	sub    $0x1,%ebx
+  8009d9:	74 16                	je     8009f1 <strlcpy+0x2f>
+  8009db:	01 f3                	add    %esi,%ebx
+  8009dd:	0f b6 0a             	movzbl (%edx),%ecx
+  8009e0:	84 c9                	test   %cl,%cl
+  8009e2:	74 0d                	je     8009f1 <strlcpy+0x2f>
+  8009e4:	83 c2 01             	add    $0x1,%edx
+  8009e7:	83 c0 01             	add    $0x1,%eax
+  8009ea:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009ed:	39 d8                	cmp    %ebx,%eax
+  8009ef:	75 ec                	jne    8009dd <strlcpy+0x1b>
+  8009f1:	c6 00 00             	movb   $0x0,(%eax)
+  8009f4:	29 f0                	sub    %esi,%eax
+  8009f6:	5b                   	pop    %ebx
+  8009f7:	5e                   	pop    %esi
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <strcmp>:
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a03:	0f b6 01             	movzbl (%ecx),%eax
+  800a06:	84 c0                	test   %al,%al
+  800a08:	74 11                	je     800a1b <strcmp+0x21>
+  800a0a:	38 02                	cmp    %al,(%edx)
+  800a0c:	75 0d                	jne    800a1b <strcmp+0x21>
+  800a0e:	83 c1 01             	add    $0x1,%ecx
+  800a11:	83 c2 01             	add    $0x1,%edx
+  800a14:	0f b6 01             	movzbl (%ecx),%eax
+  800a17:	84 c0                	test   %al,%al
+  800a19:	75 ef                	jne    800a0a <strcmp+0x10>
+  800a1b:	0f b6 c0             	movzbl %al,%eax
+  800a1e:	0f b6 12             	movzbl (%edx),%edx
+  800a21:	29 d0                	sub    %edx,%eax
+  800a23:	5d                   	pop    %ebp
+  800a24:	c3                   	ret
+
+00800a25 <strncmp>:
+  800a25:	55                   	push   %ebp
+  800a26:	89 e5                	mov    %esp,%ebp
+  800a28:	53                   	push   %ebx
+  800a29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a2f:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a37:	85 d2                	test   %edx,%edx
+  800a39:	74 2e                	je     800a69 <strncmp+0x44>
+  800a3b:	0f b6 01             	movzbl (%ecx),%eax
+  800a3e:	84 c0                	test   %al,%al
+  800a40:	74 16                	je     800a58 <strncmp+0x33>
+  800a42:	3a 03                	cmp    (%ebx),%al
+  800a44:	75 12                	jne    800a58 <strncmp+0x33>
+  800a46:	83 c1 01             	add    $0x1,%ecx
+  800a49:	83 c3 01             	add    $0x1,%ebx
+  800a4c:	83 ea 01             	sub    $0x1,%edx
+  800a4f:	75 ea                	jne    800a3b <strncmp+0x16>
+  800a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a56:	eb 11                	jmp    800a69 <strncmp+0x44>
+  800a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5d:	85 d2                	test   %edx,%edx
+  800a5f:	74 08                	je     800a69 <strncmp+0x44>
+  800a61:	0f b6 01             	movzbl (%ecx),%eax
+  800a64:	0f b6 13             	movzbl (%ebx),%edx
+  800a67:	29 d0                	sub    %edx,%eax
+  800a69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6c:	c9                   	leave
+  800a6d:	c3                   	ret
+
+00800a6e <strchr>:
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a74:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a78:	0f b6 10             	movzbl (%eax),%edx
+  800a7b:	84 d2                	test   %dl,%dl
+  800a7d:	74 15                	je     800a94 <strchr+0x26>
+  800a7f:	38 d1                	cmp    %dl,%cl
+  800a81:	74 0f                	je     800a92 <strchr+0x24>
+  800a83:	83 c0 01             	add    $0x1,%eax
+  800a86:	0f b6 10             	movzbl (%eax),%edx
+  800a89:	84 d2                	test   %dl,%dl
+  800a8b:	75 f2                	jne    800a7f <strchr+0x11>
+  800a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a92:	5d                   	pop    %ebp
+  800a93:	c3                   	ret
+  800a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a99:	eb f7                	jmp    800a92 <strchr+0x24>
+
+00800a9b <strfind>:
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	53                   	push   %ebx
+  800a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa5:	0f b6 18             	movzbl (%eax),%ebx
+  800aa8:	38 d3                	cmp    %dl,%bl
+  800aaa:	74 14                	je     800ac0 <strfind+0x25>
+  800aac:	89 d1                	mov    %edx,%ecx
+  800aae:	84 db                	test   %bl,%bl
+  800ab0:	74 0e                	je     800ac0 <strfind+0x25>
+  800ab2:	83 c0 01             	add    $0x1,%eax
+  800ab5:	0f b6 10             	movzbl (%eax),%edx
+  800ab8:	38 ca                	cmp    %cl,%dl
+  800aba:	74 04                	je     800ac0 <strfind+0x25>
+  800abc:	84 d2                	test   %dl,%dl
+  800abe:	75 f2                	jne    800ab2 <strfind+0x17>
+  800ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac3:	c9                   	leave
+  800ac4:	c3                   	ret
+
+00800ac5 <memset>:
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	57                   	push   %edi
+  800ac9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800acc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800acf:	85 c9                	test   %ecx,%ecx
+  800ad1:	74 20                	je     800af3 <memset+0x2e>
+  800ad3:	89 f8                	mov    %edi,%eax
+  800ad5:	09 c8                	or     %ecx,%eax
+  800ad7:	a8 03                	test   $0x3,%al
+  800ad9:	75 12                	jne    800aed <memset+0x28>
+  800adb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800adf:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ae5:	c1 e9 02             	shr    $0x2,%ecx
+  800ae8:	fc                   	cld
+  800ae9:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aeb:	eb 06                	jmp    800af3 <memset+0x2e>
+  800aed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800af0:	fc                   	cld
+  800af1:	f3 aa                	rep stos %al,%es:(%edi)
+  800af3:	89 f8                	mov    %edi,%eax
+  800af5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800af8:	c9                   	leave
+  800af9:	c3                   	ret
+
+00800afa <memmove>:
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	57                   	push   %edi
+  800afe:	56                   	push   %esi
+  800aff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b02:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b05:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b08:	39 c6                	cmp    %eax,%esi
+  800b0a:	73 32                	jae    800b3e <memmove+0x44>
+  800b0c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b0f:	39 d0                	cmp    %edx,%eax
+  800b11:	73 2b                	jae    800b3e <memmove+0x44>
+  800b13:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800b16:	89 d6                	mov    %edx,%esi
+  800b18:	09 fe                	or     %edi,%esi
+  800b1a:	09 ce                	or     %ecx,%esi
+  800b1c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b22:	75 0e                	jne    800b32 <memmove+0x38>
+  800b24:	83 ef 04             	sub    $0x4,%edi
+  800b27:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b2a:	c1 e9 02             	shr    $0x2,%ecx
+  800b2d:	fd                   	std
+  800b2e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b30:	eb 09                	jmp    800b3b <memmove+0x41>
+  800b32:	83 ef 01             	sub    $0x1,%edi
+  800b35:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b38:	fd                   	std
+  800b39:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b3b:	fc                   	cld
+  800b3c:	eb 1a                	jmp    800b58 <memmove+0x5e>
+  800b3e:	89 f2                	mov    %esi,%edx
+  800b40:	09 c2                	or     %eax,%edx
+  800b42:	09 ca                	or     %ecx,%edx
+  800b44:	f6 c2 03             	test   $0x3,%dl
+  800b47:	75 0a                	jne    800b53 <memmove+0x59>
+  800b49:	c1 e9 02             	shr    $0x2,%ecx
+  800b4c:	89 c7                	mov    %eax,%edi
+  800b4e:	fc                   	cld
+  800b4f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b51:	eb 05                	jmp    800b58 <memmove+0x5e>
+  800b53:	89 c7                	mov    %eax,%edi
+  800b55:	fc                   	cld
+  800b56:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b58:	5e                   	pop    %esi
+  800b59:	5f                   	pop    %edi
+  800b5a:	5d                   	pop    %ebp
+  800b5b:	c3                   	ret
+
+00800b5c <memcpy>:
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	83 ec 0c             	sub    $0xc,%esp
+  800b62:	ff 75 10             	push   0x10(%ebp)
+  800b65:	ff 75 0c             	push   0xc(%ebp)
+  800b68:	ff 75 08             	push   0x8(%ebp)
+  800b6b:	e8 8a ff ff ff       	call   800afa <memmove>
+  800b70:	c9                   	leave
+  800b71:	c3                   	ret
+
+00800b72 <memcmp>:
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	56                   	push   %esi
+  800b76:	53                   	push   %ebx
+  800b77:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b7d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b80:	85 f6                	test   %esi,%esi
+  800b82:	74 29                	je     800bad <memcmp+0x3b>
+  800b84:	01 c6                	add    %eax,%esi
+  800b86:	0f b6 08             	movzbl (%eax),%ecx
+  800b89:	0f b6 1a             	movzbl (%edx),%ebx
+  800b8c:	38 d9                	cmp    %bl,%cl
+  800b8e:	75 11                	jne    800ba1 <memcmp+0x2f>
+  800b90:	83 c0 01             	add    $0x1,%eax
+  800b93:	83 c2 01             	add    $0x1,%edx
+  800b96:	39 c6                	cmp    %eax,%esi
+  800b98:	75 ec                	jne    800b86 <memcmp+0x14>
+  800b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9f:	eb 08                	jmp    800ba9 <memcmp+0x37>
+  800ba1:	0f b6 c1             	movzbl %cl,%eax
+  800ba4:	0f b6 db             	movzbl %bl,%ebx
+  800ba7:	29 d8                	sub    %ebx,%eax
+  800ba9:	5b                   	pop    %ebx
+  800baa:	5e                   	pop    %esi
+  800bab:	5d                   	pop    %ebp
+  800bac:	c3                   	ret
+  800bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb2:	eb f5                	jmp    800ba9 <memcmp+0x37>
+
+00800bb4 <memfind>:
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbd:	89 c2                	mov    %eax,%edx
+  800bbf:	03 55 10             	add    0x10(%ebp),%edx
+  800bc2:	39 d0                	cmp    %edx,%eax
+  800bc4:	73 0d                	jae    800bd3 <memfind+0x1f>
+  800bc6:	38 08                	cmp    %cl,(%eax)
+  800bc8:	74 0d                	je     800bd7 <memfind+0x23>
+  800bca:	83 c0 01             	add    $0x1,%eax
+  800bcd:	39 c2                	cmp    %eax,%edx
+  800bcf:	75 f5                	jne    800bc6 <memfind+0x12>
+  800bd1:	eb 06                	jmp    800bd9 <memfind+0x25>
+  800bd3:	89 c2                	mov    %eax,%edx
+  800bd5:	eb 02                	jmp    800bd9 <memfind+0x25>
+  800bd7:	89 c2                	mov    %eax,%edx
+  800bd9:	89 d0                	mov    %edx,%eax
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+
+00800bdd <strtol>:
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	57                   	push   %edi
+  800be1:	56                   	push   %esi
+  800be2:	53                   	push   %ebx
+  800be3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800be9:	0f b6 02             	movzbl (%edx),%eax
+  800bec:	3c 20                	cmp    $0x20,%al
+  800bee:	74 04                	je     800bf4 <strtol+0x17>
+  800bf0:	3c 09                	cmp    $0x9,%al
+  800bf2:	75 0e                	jne    800c02 <strtol+0x25>
+  800bf4:	83 c2 01             	add    $0x1,%edx
+  800bf7:	0f b6 02             	movzbl (%edx),%eax
+  800bfa:	3c 20                	cmp    $0x20,%al
+  800bfc:	74 f6                	je     800bf4 <strtol+0x17>
+  800bfe:	3c 09                	cmp    $0x9,%al
+  800c00:	74 f2                	je     800bf4 <strtol+0x17>
+  800c02:	3c 2b                	cmp    $0x2b,%al
+  800c04:	74 2a                	je     800c30 <strtol+0x53>
+  800c06:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c0b:	3c 2d                	cmp    $0x2d,%al
+  800c0d:	74 2b                	je     800c3a <strtol+0x5d>
+  800c0f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c15:	75 0f                	jne    800c26 <strtol+0x49>
+  800c17:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c1a:	74 28                	je     800c44 <strtol+0x67>
+  800c1c:	85 db                	test   %ebx,%ebx
+  800c1e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c23:	0f 44 d8             	cmove  %eax,%ebx
+  800c26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c2b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c2e:	eb 46                	jmp    800c76 <strtol+0x99>
+  800c30:	83 c2 01             	add    $0x1,%edx
+  800c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c38:	eb d5                	jmp    800c0f <strtol+0x32>
+  800c3a:	83 c2 01             	add    $0x1,%edx
+  800c3d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c42:	eb cb                	jmp    800c0f <strtol+0x32>
+  800c44:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c48:	74 0e                	je     800c58 <strtol+0x7b>
+  800c4a:	85 db                	test   %ebx,%ebx
+  800c4c:	75 d8                	jne    800c26 <strtol+0x49>
+  800c4e:	83 c2 01             	add    $0x1,%edx
+  800c51:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c56:	eb ce                	jmp    800c26 <strtol+0x49>
+  800c58:	83 c2 02             	add    $0x2,%edx
+  800c5b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c60:	eb c4                	jmp    800c26 <strtol+0x49>
+  800c62:	0f be c0             	movsbl %al,%eax
+  800c65:	83 e8 30             	sub    $0x30,%eax
+  800c68:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c6b:	7d 3a                	jge    800ca7 <strtol+0xca>
+  800c6d:	83 c2 01             	add    $0x1,%edx
+  800c70:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c74:	01 c1                	add    %eax,%ecx
+  800c76:	0f b6 02             	movzbl (%edx),%eax
+  800c79:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c7c:	89 f3                	mov    %esi,%ebx
+  800c7e:	80 fb 09             	cmp    $0x9,%bl
+  800c81:	76 df                	jbe    800c62 <strtol+0x85>
+  800c83:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c86:	89 f3                	mov    %esi,%ebx
+  800c88:	80 fb 19             	cmp    $0x19,%bl
+  800c8b:	77 08                	ja     800c95 <strtol+0xb8>
+  800c8d:	0f be c0             	movsbl %al,%eax
+  800c90:	83 e8 57             	sub    $0x57,%eax
+  800c93:	eb d3                	jmp    800c68 <strtol+0x8b>
+  800c95:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c98:	89 f3                	mov    %esi,%ebx
+  800c9a:	80 fb 19             	cmp    $0x19,%bl
+  800c9d:	77 08                	ja     800ca7 <strtol+0xca>
+  800c9f:	0f be c0             	movsbl %al,%eax
+  800ca2:	83 e8 37             	sub    $0x37,%eax
+  800ca5:	eb c1                	jmp    800c68 <strtol+0x8b>
+  800ca7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cab:	74 05                	je     800cb2 <strtol+0xd5>
+  800cad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cb0:	89 10                	mov    %edx,(%eax)
+  800cb2:	89 c8                	mov    %ecx,%eax
+  800cb4:	f7 d8                	neg    %eax
+  800cb6:	85 ff                	test   %edi,%edi
+  800cb8:	0f 45 c8             	cmovne %eax,%ecx
+  800cbb:	89 c8                	mov    %ecx,%eax
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+
+00800cc2 <sys_cputs>:
+  800cc2:	55                   	push   %ebp
+  800cc3:	89 e5                	mov    %esp,%ebp
+  800cc5:	57                   	push   %edi
+  800cc6:	56                   	push   %esi
+  800cc7:	53                   	push   %ebx
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd3:	89 c3                	mov    %eax,%ebx
+  800cd5:	89 c7                	mov    %eax,%edi
+  800cd7:	89 c6                	mov    %eax,%esi
+  800cd9:	cd 30                	int    $0x30
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+
+00800ce0 <sys_cgetc>:
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+  800ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ceb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cf0:	89 d1                	mov    %edx,%ecx
+  800cf2:	89 d3                	mov    %edx,%ebx
+  800cf4:	89 d7                	mov    %edx,%edi
+  800cf6:	89 d6                	mov    %edx,%esi
+  800cf8:	cd 30                	int    $0x30
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+
+00800cff <sys_env_destroy>:
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	57                   	push   %edi
+  800d03:	56                   	push   %esi
+  800d04:	53                   	push   %ebx
+  800d05:	83 ec 0c             	sub    $0xc,%esp
+  800d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d10:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d15:	89 cb                	mov    %ecx,%ebx
+  800d17:	89 cf                	mov    %ecx,%edi
+  800d19:	89 ce                	mov    %ecx,%esi
+  800d1b:	cd 30                	int    $0x30
+  800d1d:	85 c0                	test   %eax,%eax
+  800d1f:	7f 08                	jg     800d29 <sys_env_destroy+0x2a>
+  800d21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d24:	5b                   	pop    %ebx
+  800d25:	5e                   	pop    %esi
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+  800d2c:	50                   	push   %eax
+  800d2d:	6a 03                	push   $0x3
+  800d2f:	68 8b 3b 80 00       	push   $0x803b8b
+  800d34:	6a 24                	push   $0x24
+  800d36:	68 a8 3b 80 00       	push   $0x803ba8
+  800d3b:	e8 38 f4 ff ff       	call   800178 <_panic>
+
+00800d40 <sys_getenvid>:
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	57                   	push   %edi
+  800d44:	56                   	push   %esi
+  800d45:	53                   	push   %ebx
+  800d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d50:	89 d1                	mov    %edx,%ecx
+  800d52:	89 d3                	mov    %edx,%ebx
+  800d54:	89 d7                	mov    %edx,%edi
+  800d56:	89 d6                	mov    %edx,%esi
+  800d58:	cd 30                	int    $0x30
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+
+00800d5f <sys_yield>:
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	57                   	push   %edi
+  800d63:	56                   	push   %esi
+  800d64:	53                   	push   %ebx
+  800d65:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d6c:	74 26                	je     800d94 <sys_yield+0x35>
+  800d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d73:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d78:	89 d1                	mov    %edx,%ecx
+  800d7a:	89 d3                	mov    %edx,%ebx
+  800d7c:	89 d7                	mov    %edx,%edi
+  800d7e:	6a 00                	push   $0x0
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	8d 35 8b 0d 80 00    	lea    0x800d8b,%esi
+  800d89:	0f 34                	sysenter
+  800d8b:	5d                   	pop    %ebp
+  800d8c:	83 c4 04             	add    $0x4,%esp
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+  800d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d99:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d9e:	89 d1                	mov    %edx,%ecx
+  800da0:	89 d3                	mov    %edx,%ebx
+  800da2:	89 d7                	mov    %edx,%edi
+  800da4:	89 d6                	mov    %edx,%esi
+  800da6:	cd 30                	int    $0x30
+  800da8:	eb e5                	jmp    800d8f <sys_yield+0x30>
+
+00800daa <sys_page_alloc>:
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+  800db0:	83 ec 0c             	sub    $0xc,%esp
+  800db3:	be 00 00 00 00       	mov    $0x0,%esi
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc6:	89 f7                	mov    %esi,%edi
+  800dc8:	cd 30                	int    $0x30
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	7f 08                	jg     800dd6 <sys_page_alloc+0x2c>
+  800dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+  800dd9:	50                   	push   %eax
+  800dda:	6a 04                	push   $0x4
+  800ddc:	68 8b 3b 80 00       	push   $0x803b8b
+  800de1:	6a 24                	push   $0x24
+  800de3:	68 a8 3b 80 00       	push   $0x803ba8
+  800de8:	e8 8b f3 ff ff       	call   800178 <_panic>
+
+00800ded <sys_page_map>:
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	57                   	push   %edi
+  800df1:	56                   	push   %esi
+  800df2:	53                   	push   %ebx
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+  800df6:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800dfd:	74 33                	je     800e32 <sys_page_map+0x45>
+  800dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e05:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e10:	ff 75 18             	push   0x18(%ebp)
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	8d 35 1e 0e 80 00    	lea    0x800e1e,%esi
+  800e1c:	0f 34                	sysenter
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	83 c4 04             	add    $0x4,%esp
+  800e22:	89 c2                	mov    %eax,%edx
+  800e24:	85 c0                	test   %eax,%eax
+  800e26:	7f 3d                	jg     800e65 <sys_page_map+0x78>
+  800e28:	89 d0                	mov    %edx,%eax
+  800e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+  800e32:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e40:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e43:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e46:	cd 30                	int    $0x30
+  800e48:	89 c2                	mov    %eax,%edx
+  800e4a:	85 c0                	test   %eax,%eax
+  800e4c:	7e da                	jle    800e28 <sys_page_map+0x3b>
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+  800e51:	50                   	push   %eax
+  800e52:	6a 05                	push   $0x5
+  800e54:	68 8b 3b 80 00       	push   $0x803b8b
+  800e59:	6a 24                	push   $0x24
+  800e5b:	68 a8 3b 80 00       	push   $0x803ba8
+  800e60:	e8 13 f3 ff ff       	call   800178 <_panic>
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 05                	push   $0x5
+  800e6b:	68 8b 3b 80 00       	push   $0x803b8b
+  800e70:	6a 48                	push   $0x48
+  800e72:	68 a8 3b 80 00       	push   $0x803ba8
+  800e77:	e8 fc f2 ff ff       	call   800178 <_panic>
+
+00800e7c <sys_page_unmap>:
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+  800e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e90:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e95:	89 df                	mov    %ebx,%edi
+  800e97:	89 de                	mov    %ebx,%esi
+  800e99:	cd 30                	int    $0x30
+  800e9b:	85 c0                	test   %eax,%eax
+  800e9d:	7f 08                	jg     800ea7 <sys_page_unmap+0x2b>
+  800e9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+  800ea7:	83 ec 0c             	sub    $0xc,%esp
+  800eaa:	50                   	push   %eax
+  800eab:	6a 06                	push   $0x6
+  800ead:	68 8b 3b 80 00       	push   $0x803b8b
+  800eb2:	6a 24                	push   $0x24
+  800eb4:	68 a8 3b 80 00       	push   $0x803ba8
+  800eb9:	e8 ba f2 ff ff       	call   800178 <_panic>
+
+00800ebe <sys_fork>:
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	57                   	push   %edi
+  800ec2:	56                   	push   %esi
+  800ec3:	53                   	push   %ebx
+  800ec4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800ece:	89 d1                	mov    %edx,%ecx
+  800ed0:	89 d3                	mov    %edx,%ebx
+  800ed2:	89 d7                	mov    %edx,%edi
+  800ed4:	89 d6                	mov    %edx,%esi
+  800ed6:	cd 30                	int    $0x30
+  800ed8:	5b                   	pop    %ebx
+  800ed9:	5e                   	pop    %esi
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+
+00800edd <sys_env_set_status>:
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	57                   	push   %edi
+  800ee1:	56                   	push   %esi
+  800ee2:	53                   	push   %ebx
+  800ee3:	83 ec 0c             	sub    $0xc,%esp
+  800ee6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ef6:	89 df                	mov    %ebx,%edi
+  800ef8:	89 de                	mov    %ebx,%esi
+  800efa:	cd 30                	int    $0x30
+  800efc:	85 c0                	test   %eax,%eax
+  800efe:	7f 08                	jg     800f08 <sys_env_set_status+0x2b>
+  800f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+  800f08:	83 ec 0c             	sub    $0xc,%esp
+  800f0b:	50                   	push   %eax
+  800f0c:	6a 08                	push   $0x8
+  800f0e:	68 8b 3b 80 00       	push   $0x803b8b
+  800f13:	6a 24                	push   $0x24
+  800f15:	68 a8 3b 80 00       	push   $0x803ba8
+  800f1a:	e8 59 f2 ff ff       	call   800178 <_panic>
+
+00800f1f <sys_env_set_trapframe>:
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f38:	89 df                	mov    %ebx,%edi
+  800f3a:	89 de                	mov    %ebx,%esi
+  800f3c:	cd 30                	int    $0x30
+  800f3e:	85 c0                	test   %eax,%eax
+  800f40:	7f 08                	jg     800f4a <sys_env_set_trapframe+0x2b>
+  800f42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  800f4d:	50                   	push   %eax
+  800f4e:	6a 09                	push   $0x9
+  800f50:	68 8b 3b 80 00       	push   $0x803b8b
+  800f55:	6a 24                	push   $0x24
+  800f57:	68 a8 3b 80 00       	push   $0x803ba8
+  800f5c:	e8 17 f2 ff ff       	call   800178 <_panic>
+
+00800f61 <sys_env_set_cow>:
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+  800f6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f7a:	89 df                	mov    %ebx,%edi
+  800f7c:	89 de                	mov    %ebx,%esi
+  800f7e:	cd 30                	int    $0x30
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	7f 08                	jg     800f8c <sys_env_set_cow+0x2b>
+  800f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+  800f8c:	83 ec 0c             	sub    $0xc,%esp
+  800f8f:	50                   	push   %eax
+  800f90:	6a 20                	push   $0x20
+  800f92:	68 8b 3b 80 00       	push   $0x803b8b
+  800f97:	6a 24                	push   $0x24
+  800f99:	68 a8 3b 80 00       	push   $0x803ba8
+  800f9e:	e8 d5 f1 ff ff       	call   800178 <_panic>
+
+00800fa3 <sys_env_service>:
+  800fa3:	55                   	push   %ebp
+  800fa4:	89 e5                	mov    %esp,%ebp
+  800fa6:	57                   	push   %edi
+  800fa7:	56                   	push   %esi
+  800fa8:	53                   	push   %ebx
+  800fa9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb1:	b8 21 00 00 00       	mov    $0x21,%eax
+  800fb6:	89 cb                	mov    %ecx,%ebx
+  800fb8:	89 cf                	mov    %ecx,%edi
+  800fba:	89 ce                	mov    %ecx,%esi
+  800fbc:	cd 30                	int    $0x30
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5f                   	pop    %edi
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+
+00800fc3 <sys_env_set_pgfault_upcall>:
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+  800fc6:	57                   	push   %edi
+  800fc7:	56                   	push   %esi
+  800fc8:	53                   	push   %ebx
+  800fc9:	83 ec 0c             	sub    $0xc,%esp
+  800fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fdc:	89 df                	mov    %ebx,%edi
+  800fde:	89 de                	mov    %ebx,%esi
+  800fe0:	cd 30                	int    $0x30
+  800fe2:	85 c0                	test   %eax,%eax
+  800fe4:	7f 08                	jg     800fee <sys_env_set_pgfault_upcall+0x2b>
+  800fe6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+  800ff1:	50                   	push   %eax
+  800ff2:	6a 0a                	push   $0xa
+  800ff4:	68 8b 3b 80 00       	push   $0x803b8b
+  800ff9:	6a 24                	push   $0x24
+  800ffb:	68 a8 3b 80 00       	push   $0x803ba8
+  801000:	e8 73 f1 ff ff       	call   800178 <_panic>
+
+00801005 <sys_ipc_try_send>:
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	57                   	push   %edi
+  801009:	56                   	push   %esi
+  80100a:	53                   	push   %ebx
+  80100b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801012:	74 27                	je     80103b <sys_ipc_try_send+0x36>
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80101f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801022:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801025:	6a 00                	push   $0x0
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	8d 35 32 10 80 00    	lea    0x801032,%esi
+  801030:	0f 34                	sysenter
+  801032:	5d                   	pop    %ebp
+  801033:	83 c4 04             	add    $0x4,%esp
+  801036:	5b                   	pop    %ebx
+  801037:	5e                   	pop    %esi
+  801038:	5f                   	pop    %edi
+  801039:	5d                   	pop    %ebp
+  80103a:	c3                   	ret
+  80103b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801040:	be 00 00 00 00       	mov    $0x0,%esi
+  801045:	8b 55 08             	mov    0x8(%ebp),%edx
+  801048:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801051:	cd 30                	int    $0x30
+  801053:	eb e1                	jmp    801036 <sys_ipc_try_send+0x31>
+
+00801055 <sys_ipc_recv>:
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801065:	74 32                	je     801099 <sys_ipc_recv+0x44>
+  801067:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801074:	89 cb                	mov    %ecx,%ebx
+  801076:	89 cf                	mov    %ecx,%edi
+  801078:	6a 00                	push   $0x0
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+  801085:	5d                   	pop    %ebp
+  801086:	83 c4 04             	add    $0x4,%esp
+  801089:	89 c2                	mov    %eax,%edx
+  80108b:	85 c0                	test   %eax,%eax
+  80108d:	7f 3c                	jg     8010cb <sys_ipc_recv+0x76>
+  80108f:	89 d0                	mov    %edx,%eax
+  801091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+  801099:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80109e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	89 cb                	mov    %ecx,%ebx
+  8010a8:	89 cf                	mov    %ecx,%edi
+  8010aa:	89 ce                	mov    %ecx,%esi
+  8010ac:	cd 30                	int    $0x30
+  8010ae:	89 c2                	mov    %eax,%edx
+  8010b0:	85 c0                	test   %eax,%eax
+  8010b2:	7e db                	jle    80108f <sys_ipc_recv+0x3a>
+  8010b4:	83 ec 0c             	sub    $0xc,%esp
+  8010b7:	50                   	push   %eax
+  8010b8:	6a 0d                	push   $0xd
+  8010ba:	68 8b 3b 80 00       	push   $0x803b8b
+  8010bf:	6a 24                	push   $0x24
+  8010c1:	68 a8 3b 80 00       	push   $0x803ba8
+  8010c6:	e8 ad f0 ff ff       	call   800178 <_panic>
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 0d                	push   $0xd
+  8010d1:	68 8b 3b 80 00       	push   $0x803b8b
+  8010d6:	6a 48                	push   $0x48
+  8010d8:	68 a8 3b 80 00       	push   $0x803ba8
+  8010dd:	e8 96 f0 ff ff       	call   800178 <_panic>
+
+008010e2 <sys_ipc_send>:
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  8010e8:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010ef:	74 27                	je     801118 <sys_ipc_send+0x36>
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801102:	6a 00                	push   $0x0
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	8d 35 0f 11 80 00    	lea    0x80110f,%esi
+  80110d:	0f 34                	sysenter
+  80110f:	5d                   	pop    %ebp
+  801110:	83 c4 04             	add    $0x4,%esp
+  801113:	5b                   	pop    %ebx
+  801114:	5e                   	pop    %esi
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+  801118:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80111d:	be 00 00 00 00       	mov    $0x0,%esi
+  801122:	8b 55 08             	mov    0x8(%ebp),%edx
+  801125:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801128:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80112e:	cd 30                	int    $0x30
+  801130:	eb e1                	jmp    801113 <sys_ipc_send+0x31>
+
+00801132 <sys_ipc_call>:
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	57                   	push   %edi
+  801136:	56                   	push   %esi
+  801137:	53                   	push   %ebx
+  801138:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801143:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801146:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801149:	8b 75 18             	mov    0x18(%ebp),%esi
+  80114c:	cd 30                	int    $0x30
+  80114e:	5b                   	pop    %ebx
+  80114f:	5e                   	pop    %esi
+  801150:	5f                   	pop    %edi
+  801151:	5d                   	pop    %ebp
+  801152:	c3                   	ret
+
+00801153 <sys_ipc_reply_recv>:
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	57                   	push   %edi
+  801157:	56                   	push   %esi
+  801158:	53                   	push   %ebx
+  801159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801164:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801167:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80116a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80116d:	cd 30                	int    $0x30
+  80116f:	5b                   	pop    %ebx
+  801170:	5e                   	pop    %esi
+  801171:	5f                   	pop    %edi
+  801172:	5d                   	pop    %ebp
+  801173:	c3                   	ret
+
+00801174 <sys_time_msec>:
+  801174:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801179:	85 c0                	test   %eax,%eax
+  80117b:	75 06                	jne    801183 <sys_time_msec+0xf>
+  80117d:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801182:	c3                   	ret
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	57                   	push   %edi
+  801187:	56                   	push   %esi
+  801188:	53                   	push   %ebx
+  801189:	83 ec 0c             	sub    $0xc,%esp
+  80118c:	0f 31                	rdtsc
+  80118e:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801194:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80119a:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8011a0:	29 c8                	sub    %ecx,%eax
+  8011a2:	19 da                	sbb    %ebx,%edx
+  8011a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	52                   	push   %edx
+  8011ac:	50                   	push   %eax
+  8011ad:	e8 1f 25 00 00       	call   8036d1 <__udivdi3>
+  8011b2:	83 c4 10             	add    $0x10,%esp
+  8011b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b8:	5b                   	pop    %ebx
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5f                   	pop    %edi
+  8011bb:	5d                   	pop    %ebp
+  8011bc:	c3                   	ret
+
+008011bd <sys_env_swap>:
+  8011bd:	55                   	push   %ebp
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	57                   	push   %edi
+  8011c1:	56                   	push   %esi
+  8011c2:	53                   	push   %ebx
+  8011c3:	83 ec 0c             	sub    $0xc,%esp
+  8011c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ce:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011d3:	89 cb                	mov    %ecx,%ebx
+  8011d5:	89 cf                	mov    %ecx,%edi
+  8011d7:	89 ce                	mov    %ecx,%esi
+  8011d9:	cd 30                	int    $0x30
+  8011db:	85 c0                	test   %eax,%eax
+  8011dd:	7f 08                	jg     8011e7 <sys_env_swap+0x2a>
+  8011df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5e                   	pop    %esi
+  8011e4:	5f                   	pop    %edi
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+  8011e7:	83 ec 0c             	sub    $0xc,%esp
+  8011ea:	50                   	push   %eax
+  8011eb:	6a 12                	push   $0x12
+  8011ed:	68 8b 3b 80 00       	push   $0x803b8b
+  8011f2:	6a 24                	push   $0x24
+  8011f4:	68 a8 3b 80 00       	push   $0x803ba8
+  8011f9:	e8 7a ef ff ff       	call   800178 <_panic>
+
+008011fe <sys_net_try_send>:
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 13 00 00 00       	mov    $0x13,%eax
+  801217:	89 df                	mov    %ebx,%edi
+  801219:	89 de                	mov    %ebx,%esi
+  80121b:	cd 30                	int    $0x30
+  80121d:	85 c0                	test   %eax,%eax
+  80121f:	7f 08                	jg     801229 <sys_net_try_send+0x2b>
+  801221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801224:	5b                   	pop    %ebx
+  801225:	5e                   	pop    %esi
+  801226:	5f                   	pop    %edi
+  801227:	5d                   	pop    %ebp
+  801228:	c3                   	ret
+  801229:	83 ec 0c             	sub    $0xc,%esp
+  80122c:	50                   	push   %eax
+  80122d:	6a 13                	push   $0x13
+  80122f:	68 8b 3b 80 00       	push   $0x803b8b
+  801234:	6a 24                	push   $0x24
+  801236:	68 a8 3b 80 00       	push   $0x803ba8
+  80123b:	e8 38 ef ff ff       	call   800178 <_panic>
+
+00801240 <sys_net_try_receive>:
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	57                   	push   %edi
+  801244:	56                   	push   %esi
+  801245:	53                   	push   %ebx
+  801246:	83 ec 0c             	sub    $0xc,%esp
+  801249:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801251:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801254:	b8 14 00 00 00       	mov    $0x14,%eax
+  801259:	89 df                	mov    %ebx,%edi
+  80125b:	89 de                	mov    %ebx,%esi
+  80125d:	cd 30                	int    $0x30
+  80125f:	85 c0                	test   %eax,%eax
+  801261:	7f 08                	jg     80126b <sys_net_try_receive+0x2b>
+  801263:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+  80126b:	83 ec 0c             	sub    $0xc,%esp
+  80126e:	50                   	push   %eax
+  80126f:	6a 14                	push   $0x14
+  801271:	68 8b 3b 80 00       	push   $0x803b8b
+  801276:	6a 24                	push   $0x24
+  801278:	68 a8 3b 80 00       	push   $0x803ba8
+  80127d:	e8 f6 ee ff ff       	call   800178 <_panic>
+
+00801282 <sys_net_recv_page>:
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	b8 27 00 00 00       	mov    $0x27,%eax
+  801295:	89 cb                	mov    %ecx,%ebx
+  801297:	89 cf                	mov    %ecx,%edi
+  801299:	89 ce                	mov    %ecx,%esi
+  80129b:	cd 30                	int    $0x30
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+
+008012a2 <sys_net_wait>:
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	57                   	push   %edi
+  8012a6:	56                   	push   %esi
+  8012a7:	53                   	push   %ebx
+  8012a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ad:	b8 26 00 00 00       	mov    $0x26,%eax
+  8012b2:	89 d1                	mov    %edx,%ecx
+  8012b4:	89 d3                	mov    %edx,%ebx
+  8012b6:	89 d7                	mov    %edx,%edi
+  8012b8:	89 d6                	mov    %edx,%esi
+  8012ba:	cd 30                	int    $0x30
+  8012bc:	5b                   	pop    %ebx
+  8012bd:	5e                   	pop    %esi
+  8012be:	5f                   	pop    %edi
+  8012bf:	5d                   	pop    %ebp
+  8012c0:	c3                   	ret
+
+008012c1 <sys_get_mac>:
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	57                   	push   %edi
+  8012c5:	56                   	push   %esi
+  8012c6:	53                   	push   %ebx
+  8012c7:	83 ec 0c             	sub    $0xc,%esp
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012da:	89 df                	mov    %ebx,%edi
+  8012dc:	89 de                	mov    %ebx,%esi
+  8012de:	cd 30                	int    $0x30
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	7f 08                	jg     8012ec <sys_get_mac+0x2b>
+  8012e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e7:	5b                   	pop    %ebx
+  8012e8:	5e                   	pop    %esi
+  8012e9:	5f                   	pop    %edi
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	50                   	push   %eax
+  8012f0:	6a 15                	push   $0x15
+  8012f2:	68 8b 3b 80 00       	push   $0x803b8b
+  8012f7:	6a 24                	push   $0x24
+  8012f9:	68 a8 3b 80 00       	push   $0x803ba8
+  8012fe:	e8 75 ee ff ff       	call   800178 <_panic>
+
+00801303 <sys_env_lease>:
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	57                   	push   %edi
+  801307:	56                   	push   %esi
+  801308:	53                   	push   %ebx
+  801309:	83 ec 0c             	sub    $0xc,%esp
+  80130c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801311:	8b 55 08             	mov    0x8(%ebp),%edx
+  801314:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801317:	b8 16 00 00 00       	mov    $0x16,%eax
+  80131c:	89 df                	mov    %ebx,%edi
+  80131e:	89 de                	mov    %ebx,%esi
+  801320:	cd 30                	int    $0x30
+  801322:	85 c0                	test   %eax,%eax
+  801324:	7f 08                	jg     80132e <sys_env_lease+0x2b>
+  801326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	6a 16                	push   $0x16
+  801334:	68 8b 3b 80 00       	push   $0x803b8b
+  801339:	6a 24                	push   $0x24
+  80133b:	68 a8 3b 80 00       	push   $0x803ba8
+  801340:	e8 33 ee ff ff       	call   800178 <_panic>
+
+00801345 <sys_copy_mem>:
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+  80134e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	b8 17 00 00 00       	mov    $0x17,%eax
+  801359:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80135f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801362:	cd 30                	int    $0x30
+  801364:	85 c0                	test   %eax,%eax
+  801366:	7f 08                	jg     801370 <sys_copy_mem+0x2b>
+  801368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136b:	5b                   	pop    %ebx
+  80136c:	5e                   	pop    %esi
+  80136d:	5f                   	pop    %edi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	50                   	push   %eax
+  801374:	6a 17                	push   $0x17
+  801376:	68 8b 3b 80 00       	push   $0x803b8b
+  80137b:	6a 24                	push   $0x24
+  80137d:	68 a8 3b 80 00       	push   $0x803ba8
+  801382:	e8 f1 ed ff ff       	call   800178 <_panic>
+
+00801387 <sys_get_perms>:
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+  80138d:	83 ec 0c             	sub    $0xc,%esp
+  801390:	be 00 00 00 00       	mov    $0x0,%esi
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a3:	89 f7                	mov    %esi,%edi
+  8013a5:	cd 30                	int    $0x30
+  8013a7:	85 c0                	test   %eax,%eax
+  8013a9:	7f 08                	jg     8013b3 <sys_get_perms+0x2c>
+  8013ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ae:	5b                   	pop    %ebx
+  8013af:	5e                   	pop    %esi
+  8013b0:	5f                   	pop    %edi
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	c3                   	ret
+  8013b3:	83 ec 0c             	sub    $0xc,%esp
+  8013b6:	50                   	push   %eax
+  8013b7:	6a 18                	push   $0x18
+  8013b9:	68 8b 3b 80 00       	push   $0x803b8b
+  8013be:	6a 24                	push   $0x24
+  8013c0:	68 a8 3b 80 00       	push   $0x803ba8
+  8013c5:	e8 ae ed ff ff       	call   800178 <_panic>
+
+008013ca <sys_env_unsuspend>:
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	57                   	push   %edi
+  8013ce:	56                   	push   %esi
+  8013cf:	53                   	push   %ebx
+  8013d0:	83 ec 0c             	sub    $0xc,%esp
+  8013d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013de:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e6:	89 f7                	mov    %esi,%edi
+  8013e8:	cd 30                	int    $0x30
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	7f 08                	jg     8013f6 <sys_env_unsuspend+0x2c>
+  8013ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f1:	5b                   	pop    %ebx
+  8013f2:	5e                   	pop    %esi
+  8013f3:	5f                   	pop    %edi
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+  8013f6:	83 ec 0c             	sub    $0xc,%esp
+  8013f9:	50                   	push   %eax
+  8013fa:	6a 19                	push   $0x19
+  8013fc:	68 8b 3b 80 00       	push   $0x803b8b
+  801401:	6a 24                	push   $0x24
+  801403:	68 a8 3b 80 00       	push   $0x803ba8
+  801408:	e8 6b ed ff ff       	call   800178 <_panic>
+
+0080140d <sys_migrate>:
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	57                   	push   %edi
+  801411:	56                   	push   %esi
+  801412:	53                   	push   %ebx
+  801413:	83 ec 0c             	sub    $0xc,%esp
+  801416:	ba 04 80 80 00       	mov    $0x808004,%edx
+  80141b:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801421:	76 11                	jbe    801434 <sys_migrate+0x27>
+  801423:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801428:	0f b6 08             	movzbl (%eax),%ecx
+  80142b:	05 00 10 00 00       	add    $0x1000,%eax
+  801430:	39 d0                	cmp    %edx,%eax
+  801432:	72 f4                	jb     801428 <sys_migrate+0x1b>
+  801434:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801441:	89 cb                	mov    %ecx,%ebx
+  801443:	89 cf                	mov    %ecx,%edi
+  801445:	89 ce                	mov    %ecx,%esi
+  801447:	cd 30                	int    $0x30
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	7f 08                	jg     801455 <sys_migrate+0x48>
+  80144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	50                   	push   %eax
+  801459:	6a 1a                	push   $0x1a
+  80145b:	68 8b 3b 80 00       	push   $0x803b8b
+  801460:	6a 24                	push   $0x24
+  801462:	68 a8 3b 80 00       	push   $0x803ba8
+  801467:	e8 0c ed ff ff       	call   800178 <_panic>
+
+0080146c <sys_lease_complete>:
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	57                   	push   %edi
+  801470:	56                   	push   %esi
+  801471:	53                   	push   %ebx
+  801472:	83 ec 0c             	sub    $0xc,%esp
+  801475:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80147f:	89 d1                	mov    %edx,%ecx
+  801481:	89 d3                	mov    %edx,%ebx
+  801483:	89 d7                	mov    %edx,%edi
+  801485:	89 d6                	mov    %edx,%esi
+  801487:	cd 30                	int    $0x30
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	7f 08                	jg     801495 <sys_lease_complete+0x29>
+  80148d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801490:	5b                   	pop    %ebx
+  801491:	5e                   	pop    %esi
+  801492:	5f                   	pop    %edi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+  801495:	83 ec 0c             	sub    $0xc,%esp
+  801498:	50                   	push   %eax
+  801499:	6a 1b                	push   $0x1b
+  80149b:	68 8b 3b 80 00       	push   $0x803b8b
+  8014a0:	6a 24                	push   $0x24
+  8014a2:	68 a8 3b 80 00       	push   $0x803ba8
+  8014a7:	e8 cc ec ff ff       	call   800178 <_panic>
+
+008014ac <sys_env_set_thisenv>:
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	57                   	push   %edi
+  8014b0:	56                   	push   %esi
+  8014b1:	53                   	push   %ebx
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014c5:	89 df                	mov    %ebx,%edi
+  8014c7:	89 de                	mov    %ebx,%esi
+  8014c9:	cd 30                	int    $0x30
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	7f 08                	jg     8014d7 <sys_env_set_thisenv+0x2b>
+  8014cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d2:	5b                   	pop    %ebx
+  8014d3:	5e                   	pop    %esi
+  8014d4:	5f                   	pop    %edi
+  8014d5:	5d                   	pop    %ebp
+  8014d6:	c3                   	ret
+  8014d7:	83 ec 0c             	sub    $0xc,%esp
+  8014da:	50                   	push   %eax
+  8014db:	6a 1c                	push   $0x1c
+  8014dd:	68 8b 3b 80 00       	push   $0x803b8b
+  8014e2:	6a 24                	push   $0x24
+  8014e4:	68 a8 3b 80 00       	push   $0x803ba8
+  8014e9:	e8 8a ec ff ff       	call   800178 <_panic>
+
+008014ee <sys_env_set_sched>:
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	57                   	push   %edi
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 ec 0c             	sub    $0xc,%esp
+  8014f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801502:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801507:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150a:	89 f7                	mov    %esi,%edi
+  80150c:	cd 30                	int    $0x30
+  80150e:	85 c0                	test   %eax,%eax
+  801510:	7f 08                	jg     80151a <sys_env_set_sched+0x2c>
+  801512:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801515:	5b                   	pop    %ebx
+  801516:	5e                   	pop    %esi
+  801517:	5f                   	pop    %edi
+  801518:	5d                   	pop    %ebp
+  801519:	c3                   	ret
+  80151a:	83 ec 0c             	sub    $0xc,%esp
+  80151d:	50                   	push   %eax
+  80151e:	6a 1d                	push   $0x1d
+  801520:	68 8b 3b 80 00       	push   $0x803b8b
+  801525:	6a 24                	push   $0x24
+  801527:	68 a8 3b 80 00       	push   $0x803ba8
+  80152c:	e8 47 ec ff ff       	call   800178 <_panic>
+
+00801531 <sys_batch>:
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+  801537:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801542:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801547:	89 df                	mov    %ebx,%edi
+  801549:	89 de                	mov    %ebx,%esi
+  80154b:	cd 30                	int    $0x30
+  80154d:	5b                   	pop    %ebx
+  80154e:	5e                   	pop    %esi
+  80154f:	5f                   	pop    %edi
+  801550:	5d                   	pop    %ebp
+  801551:	c3                   	ret
+
+00801552 <sys_env_stats>:
+  801552:	55                   	push   %ebp
+  801553:	89 e5                	mov    %esp,%ebp
+  801555:	57                   	push   %edi
+  801556:	56                   	push   %esi
+  801557:	53                   	push   %ebx
+  801558:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801560:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801563:	b8 23 00 00 00       	mov    $0x23,%eax
+  801568:	89 df                	mov    %ebx,%edi
+  80156a:	89 de                	mov    %ebx,%esi
+  80156c:	cd 30                	int    $0x30
+  80156e:	5b                   	pop    %ebx
+  80156f:	5e                   	pop    %esi
+  801570:	5f                   	pop    %edi
+  801571:	5d                   	pop    %ebp
+  801572:	c3                   	ret
+
+00801573 <sys_trace>:
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	57                   	push   %edi
+  801577:	56                   	push   %esi
+  801578:	53                   	push   %ebx
+  801579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801581:	b8 24 00 00 00       	mov    $0x24,%eax
+  801586:	89 cb                	mov    %ecx,%ebx
+  801588:	89 cf                	mov    %ecx,%edi
+  80158a:	89 ce                	mov    %ecx,%esi
+  80158c:	cd 30                	int    $0x30
+  80158e:	5b                   	pop    %ebx
+  80158f:	5e                   	pop    %esi
+  801590:	5f                   	pop    %edi
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+
+00801593 <sys_env_set_pager>:
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	57                   	push   %edi
+  801597:	56                   	push   %esi
+  801598:	53                   	push   %ebx
+  801599:	83 ec 0c             	sub    $0xc,%esp
+  80159c:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a7:	b8 25 00 00 00       	mov    $0x25,%eax
+  8015ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015af:	89 f7                	mov    %esi,%edi
+  8015b1:	cd 30                	int    $0x30
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	7f 08                	jg     8015bf <sys_env_set_pager+0x2c>
+  8015b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ba:	5b                   	pop    %ebx
+  8015bb:	5e                   	pop    %esi
+  8015bc:	5f                   	pop    %edi
+  8015bd:	5d                   	pop    %ebp
+  8015be:	c3                   	ret
+  8015bf:	83 ec 0c             	sub    $0xc,%esp
+  8015c2:	50                   	push   %eax
+  8015c3:	6a 25                	push   $0x25
+  8015c5:	68 8b 3b 80 00       	push   $0x803b8b
+  8015ca:	6a 24                	push   $0x24
+  8015cc:	68 a8 3b 80 00       	push   $0x803ba8
+  8015d1:	e8 a2 eb ff ff       	call   800178 <_panic>
+
+008015d6 <sys_pager_retire>:
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	57                   	push   %edi
+  8015da:	56                   	push   %esi
+  8015db:	53                   	push   %ebx
+  8015dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e4:	b8 28 00 00 00       	mov    $0x28,%eax
+  8015e9:	89 cb                	mov    %ecx,%ebx
+  8015eb:	89 cf                	mov    %ecx,%edi
+  8015ed:	89 ce                	mov    %ecx,%esi
+  8015ef:	cd 30                	int    $0x30
+  8015f1:	5b                   	pop    %ebx
+  8015f2:	5e                   	pop    %esi
+  8015f3:	5f                   	pop    %edi
+  8015f4:	5d                   	pop    %ebp
+  8015f5:	c3                   	ret
+
+008015f6 <sys_prof>:
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	57                   	push   %edi
+  8015fa:	56                   	push   %esi
+  8015fb:	53                   	push   %ebx
+  8015fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801601:	8b 55 08             	mov    0x8(%ebp),%edx
+  801604:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801607:	b8 22 00 00 00       	mov    $0x22,%eax
+  80160c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80160f:	89 f7                	mov    %esi,%edi
+  801611:	cd 30                	int    $0x30
+  801613:	5b                   	pop    %ebx
+  801614:	5e                   	pop    %esi
+  801615:	5f                   	pop    %edi
+  801616:	5d                   	pop    %ebp
+  801617:	c3                   	ret
+
+00801618 <dupq_flush>:
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	53                   	push   %ebx
+  80161c:	83 ec 0c             	sub    $0xc,%esp
+  80161f:	8b 1d 00 50 80 00    	mov    0x805000,%ebx
+  801625:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80162c:	00 00 00 
+  80162f:	53                   	push   %ebx
+  801630:	68 00 00 40 00       	push   $0x400000
+  801635:	e8 f7 fe ff ff       	call   801531 <sys_batch>
+  80163a:	83 c4 10             	add    $0x10,%esp
+  80163d:	85 c0                	test   %eax,%eax
+  80163f:	78 14                	js     801655 <dupq_flush+0x3d>
+  801641:	39 c3                	cmp    %eax,%ebx
+  801643:	7e 0b                	jle    801650 <dupq_flush+0x38>
+  801645:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801648:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  80164e:	eb 05                	jmp    801655 <dupq_flush+0x3d>
+  801650:	b8 00 00 00 00       	mov    $0x0,%eax
+  801655:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801658:	c9                   	leave
+  801659:	c3                   	ret
+
+0080165a <pgfault>:
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	56                   	push   %esi
+  80165e:	53                   	push   %ebx
+  80165f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801662:	8b 30                	mov    (%eax),%esi
+  801664:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801668:	0f 84 83 00 00 00    	je     8016f1 <pgfault+0x97>
+  80166e:	89 f0                	mov    %esi,%eax
+  801670:	c1 e8 0c             	shr    $0xc,%eax
+  801673:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80167a:	f6 c4 08             	test   $0x8,%ah
+  80167d:	0f 84 80 00 00 00    	je     801703 <pgfault+0xa9>
+  801683:	e8 b8 f6 ff ff       	call   800d40 <sys_getenvid>
+  801688:	89 c3                	mov    %eax,%ebx
+  80168a:	83 ec 04             	sub    $0x4,%esp
+  80168d:	6a 07                	push   $0x7
+  80168f:	68 00 f0 7f 00       	push   $0x7ff000
+  801694:	50                   	push   %eax
+  801695:	e8 10 f7 ff ff       	call   800daa <sys_page_alloc>
+  80169a:	83 c4 10             	add    $0x10,%esp
+  80169d:	85 c0                	test   %eax,%eax
+  80169f:	78 74                	js     801715 <pgfault+0xbb>
+  8016a1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8016a7:	83 ec 04             	sub    $0x4,%esp
+  8016aa:	68 00 10 00 00       	push   $0x1000
+  8016af:	56                   	push   %esi
+  8016b0:	68 00 f0 7f 00       	push   $0x7ff000
+  8016b5:	e8 40 f4 ff ff       	call   800afa <memmove>
+  8016ba:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016c1:	56                   	push   %esi
+  8016c2:	53                   	push   %ebx
+  8016c3:	68 00 f0 7f 00       	push   $0x7ff000
+  8016c8:	53                   	push   %ebx
+  8016c9:	e8 1f f7 ff ff       	call   800ded <sys_page_map>
+  8016ce:	83 c4 20             	add    $0x20,%esp
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	78 54                	js     801729 <pgfault+0xcf>
+  8016d5:	83 ec 08             	sub    $0x8,%esp
+  8016d8:	68 00 f0 7f 00       	push   $0x7ff000
+  8016dd:	53                   	push   %ebx
+  8016de:	e8 99 f7 ff ff       	call   800e7c <sys_page_unmap>
+  8016e3:	83 c4 10             	add    $0x10,%esp
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	78 53                	js     80173d <pgfault+0xe3>
+  8016ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ed:	5b                   	pop    %ebx
+  8016ee:	5e                   	pop    %esi
+  8016ef:	5d                   	pop    %ebp
+  8016f0:	c3                   	ret
+  8016f1:	56                   	push   %esi
+  8016f2:	68 b8 3b 80 00       	push   $0x803bb8
+  8016f7:	6a 19                	push   $0x19
+  8016f9:	68 94 3c 80 00       	push   $0x803c94
+  8016fe:	e8 75 ea ff ff       	call   800178 <_panic>
+  801703:	56                   	push   %esi
+  801704:	68 ec 3b 80 00       	push   $0x803bec
+  801709:	6a 1e                	push   $0x1e
+  80170b:	68 94 3c 80 00       	push   $0x803c94
+  801710:	e8 63 ea ff ff       	call   800178 <_panic>
+  801715:	83 ec 04             	sub    $0x4,%esp
+  801718:	68 20 3c 80 00       	push   $0x803c20
+  80171d:	6a 2e                	push   $0x2e
+  80171f:	68 94 3c 80 00       	push   $0x803c94
+  801724:	e8 4f ea ff ff       	call   800178 <_panic>
+  801729:	83 ec 04             	sub    $0x4,%esp
+  80172c:	68 44 3c 80 00       	push   $0x803c44
+  801731:	6a 37                	push   $0x37
+  801733:	68 94 3c 80 00       	push   $0x803c94
+  801738:	e8 3b ea ff ff       	call   800178 <_panic>
+  80173d:	83 ec 04             	sub    $0x4,%esp
+  801740:	68 70 3c 80 00       	push   $0x803c70
+  801745:	6a 3c                	push   $0x3c
+  801747:	68 94 3c 80 00       	push   $0x803c94
+  80174c:	e8 27 ea ff ff       	call   800178 <_panic>
+
+00801751 <dupq_begin>:
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+  801754:	83 ec 0c             	sub    $0xc,%esp
+  801757:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80175e:	00 00 00 
+  801761:	6a 07                	push   $0x7
+  801763:	68 00 00 40 00       	push   $0x400000
+  801768:	6a 00                	push   $0x0
+  80176a:	e8 3b f6 ff ff       	call   800daa <sys_page_alloc>
+  80176f:	c9                   	leave
+  801770:	c3                   	ret
+
+00801771 <dupq_map>:
+  801771:	55                   	push   %ebp
+  801772:	89 e5                	mov    %esp,%ebp
+  801774:	83 ec 08             	sub    $0x8,%esp
+  801777:	81 3d 00 50 80 00 92 	cmpl   $0x92,0x805000
+  80177e:	00 00 00 
+  801781:	74 46                	je     8017c9 <dupq_map+0x58>
+  801783:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  801789:	8d 42 01             	lea    0x1(%edx),%eax
+  80178c:	a3 00 50 80 00       	mov    %eax,0x805000
+  801791:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801794:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80179a:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  8017a1:	00 00 00 
+  8017a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a7:	89 50 04             	mov    %edx,0x4(%eax)
+  8017aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017ad:	c1 e2 0c             	shl    $0xc,%edx
+  8017b0:	89 50 08             	mov    %edx,0x8(%eax)
+  8017b3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8017b6:	89 48 0c             	mov    %ecx,0xc(%eax)
+  8017b9:	89 50 10             	mov    %edx,0x10(%eax)
+  8017bc:	8b 55 14             	mov    0x14(%ebp),%edx
+  8017bf:	89 50 14             	mov    %edx,0x14(%eax)
+  8017c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c7:	c9                   	leave
+  8017c8:	c3                   	ret
+  8017c9:	e8 4a fe ff ff       	call   801618 <dupq_flush>
+  8017ce:	85 c0                	test   %eax,%eax
+  8017d0:	79 b1                	jns    801783 <dupq_map+0x12>
+  8017d2:	eb f3                	jmp    8017c7 <dupq_map+0x56>
+
+008017d4 <dupq_end>:
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	53                   	push   %ebx
+  8017d8:	83 ec 04             	sub    $0x4,%esp
+  8017db:	e8 38 fe ff ff       	call   801618 <dupq_flush>
+  8017e0:	89 c3                	mov    %eax,%ebx
+  8017e2:	83 ec 08             	sub    $0x8,%esp
+  8017e5:	68 00 00 40 00       	push   $0x400000
+  8017ea:	6a 00                	push   $0x0
+  8017ec:	e8 8b f6 ff ff       	call   800e7c <sys_page_unmap>
+  8017f1:	89 d8                	mov    %ebx,%eax
+  8017f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f6:	c9                   	leave
+  8017f7:	c3                   	ret
+
+008017f8 <fork>:
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 10             	sub    $0x10,%esp
+  8017ff:	68 5a 16 80 00       	push   $0x80165a
+  801804:	e8 9f 1a 00 00       	call   8032a8 <set_pgfault_handler>
+  801809:	83 c4 08             	add    $0x8,%esp
+  80180c:	6a 01                	push   $0x1
+  80180e:	6a 00                	push   $0x0
+  801810:	e8 4c f7 ff ff       	call   800f61 <sys_env_set_cow>
+  801815:	e8 a4 f6 ff ff       	call   800ebe <sys_fork>
+  80181a:	89 c3                	mov    %eax,%ebx
+  80181c:	83 c4 10             	add    $0x10,%esp
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	74 07                	je     80182a <fork+0x32>
+  801823:	89 d8                	mov    %ebx,%eax
+  801825:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801828:	c9                   	leave
+  801829:	c3                   	ret
+  80182a:	e8 11 f5 ff ff       	call   800d40 <sys_getenvid>
+  80182f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801834:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80183a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80183f:	a3 18 50 80 00       	mov    %eax,0x805018
+  801844:	eb dd                	jmp    801823 <fork+0x2b>
+
+00801846 <sfork>:
+  801846:	55                   	push   %ebp
+  801847:	89 e5                	mov    %esp,%ebp
+  801849:	57                   	push   %edi
+  80184a:	56                   	push   %esi
+  80184b:	53                   	push   %ebx
+  80184c:	83 ec 1c             	sub    $0x1c,%esp
+  80184f:	e8 ec f4 ff ff       	call   800d40 <sys_getenvid>
+  801854:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801857:	83 ec 0c             	sub    $0xc,%esp
+  80185a:	68 5a 16 80 00       	push   $0x80165a
+  80185f:	e8 44 1a 00 00       	call   8032a8 <set_pgfault_handler>
+  801864:	b8 07 00 00 00       	mov    $0x7,%eax
+  801869:	cd 30                	int    $0x30
+  80186b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80186e:	83 c4 10             	add    $0x10,%esp
+  801871:	85 c0                	test   %eax,%eax
+  801873:	0f 88 45 02 00 00    	js     801abe <sfork+0x278>
+  801879:	89 c6                	mov    %eax,%esi
+  80187b:	74 17                	je     801894 <sfork+0x4e>
+  80187d:	e8 cf fe ff ff       	call   801751 <dupq_begin>
+  801882:	85 c0                	test   %eax,%eax
+  801884:	0f 88 40 02 00 00    	js     801aca <sfork+0x284>
+  80188a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80188f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801892:	eb 39                	jmp    8018cd <sfork+0x87>
+  801894:	e8 a7 f4 ff ff       	call   800d40 <sys_getenvid>
+  801899:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80189e:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8018a4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018a9:	a3 18 50 80 00       	mov    %eax,0x805018
+  8018ae:	e9 23 01 00 00       	jmp    8019d6 <sfork+0x190>
+  8018b3:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018ba:	a8 01                	test   $0x1,%al
+  8018bc:	75 5b                	jne    801919 <sfork+0xd3>
+  8018be:	83 c7 01             	add    $0x1,%edi
+  8018c1:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  8018c7:	0f 84 40 01 00 00    	je     801a0d <sfork+0x1c7>
+  8018cd:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018d4:	a8 01                	test   $0x1,%al
+  8018d6:	74 db                	je     8018b3 <sfork+0x6d>
+  8018d8:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018df:	a8 80                	test   $0x80,%al
+  8018e1:	74 d0                	je     8018b3 <sfork+0x6d>
+  8018e3:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8018ea:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018ef:	0c 80                	or     $0x80,%al
+  8018f1:	50                   	push   %eax
+  8018f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8018f5:	89 f8                	mov    %edi,%eax
+  8018f7:	c1 e0 16             	shl    $0x16,%eax
+  8018fa:	c1 e8 0c             	shr    $0xc,%eax
+  8018fd:	50                   	push   %eax
+  8018fe:	ff 75 e0             	push   -0x20(%ebp)
+  801901:	e8 6b fe ff ff       	call   801771 <dupq_map>
+  801906:	83 c4 10             	add    $0x10,%esp
+  801909:	85 c0                	test   %eax,%eax
+  80190b:	79 b1                	jns    8018be <sfork+0x78>
+  80190d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801914:	e9 bd 00 00 00       	jmp    8019d6 <sfork+0x190>
+  801919:	89 fe                	mov    %edi,%esi
+  80191b:	c1 e6 16             	shl    $0x16,%esi
+  80191e:	89 f0                	mov    %esi,%eax
+  801920:	c1 e8 0c             	shr    $0xc,%eax
+  801923:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801928:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80192b:	eb 57                	jmp    801984 <sfork+0x13e>
+  80192d:	e8 0e f4 ff ff       	call   800d40 <sys_getenvid>
+  801932:	89 c7                	mov    %eax,%edi
+  801934:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801939:	f6 c4 04             	test   $0x4,%ah
+  80193c:	0f 85 9f 00 00 00    	jne    8019e1 <sfork+0x19b>
+  801942:	a9 02 08 00 00       	test   $0x802,%eax
+  801947:	0f 85 c5 01 00 00    	jne    801b12 <sfork+0x2cc>
+  80194d:	6a 05                	push   $0x5
+  80194f:	ff 75 e4             	push   -0x1c(%ebp)
+  801952:	68 fd e7 0e 00       	push   $0xee7fd
+  801957:	57                   	push   %edi
+  801958:	e8 14 fe ff ff       	call   801771 <dupq_map>
+  80195d:	83 c4 10             	add    $0x10,%esp
+  801960:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801966:	0f 84 91 00 00 00    	je     8019fd <sfork+0x1b7>
+  80196c:	89 f0                	mov    %esi,%eax
+  80196e:	09 d8                	or     %ebx,%eax
+  801970:	c1 e8 0c             	shr    $0xc,%eax
+  801973:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801979:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  80197e:	0f 84 81 00 00 00    	je     801a05 <sfork+0x1bf>
+  801984:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801989:	74 a2                	je     80192d <sfork+0xe7>
+  80198b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801992:	f6 c2 01             	test   $0x1,%dl
+  801995:	74 c9                	je     801960 <sfork+0x11a>
+  801997:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80199e:	f6 c6 02             	test   $0x2,%dh
+  8019a1:	75 bd                	jne    801960 <sfork+0x11a>
+  8019a3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8019aa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019b1:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  8019b7:	f7 d2                	not    %edx
+  8019b9:	21 ca                	and    %ecx,%edx
+  8019bb:	52                   	push   %edx
+  8019bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8019bf:	50                   	push   %eax
+  8019c0:	ff 75 e0             	push   -0x20(%ebp)
+  8019c3:	e8 a9 fd ff ff       	call   801771 <dupq_map>
+  8019c8:	83 c4 10             	add    $0x10,%esp
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	79 91                	jns    801960 <sfork+0x11a>
+  8019cf:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8019d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019dc:	5b                   	pop    %ebx
+  8019dd:	5e                   	pop    %esi
+  8019de:	5f                   	pop    %edi
+  8019df:	5d                   	pop    %ebp
+  8019e0:	c3                   	ret
+  8019e1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019e6:	50                   	push   %eax
+  8019e7:	ff 75 e4             	push   -0x1c(%ebp)
+  8019ea:	68 fd e7 0e 00       	push   $0xee7fd
+  8019ef:	57                   	push   %edi
+  8019f0:	e8 7c fd ff ff       	call   801771 <dupq_map>
+  8019f5:	83 c4 10             	add    $0x10,%esp
+  8019f8:	e9 63 ff ff ff       	jmp    801960 <sfork+0x11a>
+  8019fd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801a00:	e9 b9 fe ff ff       	jmp    8018be <sfork+0x78>
+  801a05:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801a08:	e9 b1 fe ff ff       	jmp    8018be <sfork+0x78>
+  801a0d:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801a10:	e8 bf fd ff ff       	call   8017d4 <dupq_end>
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	0f 88 b9 00 00 00    	js     801ad6 <sfork+0x290>
+  801a1d:	83 ec 04             	sub    $0x4,%esp
+  801a20:	6a 07                	push   $0x7
+  801a22:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a27:	56                   	push   %esi
+  801a28:	e8 7d f3 ff ff       	call   800daa <sys_page_alloc>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	0f 88 aa 00 00 00    	js     801ae2 <sfork+0x29c>
+  801a38:	83 ec 0c             	sub    $0xc,%esp
+  801a3b:	6a 07                	push   $0x7
+  801a3d:	68 00 f0 7f 00       	push   $0x7ff000
+  801a42:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801a45:	57                   	push   %edi
+  801a46:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a4b:	56                   	push   %esi
+  801a4c:	e8 9c f3 ff ff       	call   800ded <sys_page_map>
+  801a51:	83 c4 20             	add    $0x20,%esp
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	0f 88 92 00 00 00    	js     801aee <sfork+0x2a8>
+  801a5c:	83 ec 04             	sub    $0x4,%esp
+  801a5f:	68 00 10 00 00       	push   $0x1000
+  801a64:	68 00 f0 7f 00       	push   $0x7ff000
+  801a69:	68 00 f0 7f ee       	push   $0xee7ff000
+  801a6e:	e8 87 f0 ff ff       	call   800afa <memmove>
+  801a73:	83 c4 08             	add    $0x8,%esp
+  801a76:	68 00 f0 7f 00       	push   $0x7ff000
+  801a7b:	57                   	push   %edi
+  801a7c:	e8 fb f3 ff ff       	call   800e7c <sys_page_unmap>
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 72                	js     801afa <sfork+0x2b4>
+  801a88:	83 ec 08             	sub    $0x8,%esp
+  801a8b:	68 20 33 80 00       	push   $0x803320
+  801a90:	56                   	push   %esi
+  801a91:	e8 2d f5 ff ff       	call   800fc3 <sys_env_set_pgfault_upcall>
+  801a96:	83 c4 10             	add    $0x10,%esp
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	78 69                	js     801b06 <sfork+0x2c0>
+  801a9d:	83 ec 08             	sub    $0x8,%esp
+  801aa0:	6a 02                	push   $0x2
+  801aa2:	56                   	push   %esi
+  801aa3:	e8 35 f4 ff ff       	call   800edd <sys_env_set_status>
+  801aa8:	83 c4 10             	add    $0x10,%esp
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801ab2:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801ab6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ab9:	e9 18 ff ff ff       	jmp    8019d6 <sfork+0x190>
+  801abe:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ac5:	e9 0c ff ff ff       	jmp    8019d6 <sfork+0x190>
+  801aca:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ad1:	e9 00 ff ff ff       	jmp    8019d6 <sfork+0x190>
+  801ad6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801add:	e9 f4 fe ff ff       	jmp    8019d6 <sfork+0x190>
+  801ae2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ae9:	e9 e8 fe ff ff       	jmp    8019d6 <sfork+0x190>
+  801aee:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801af5:	e9 dc fe ff ff       	jmp    8019d6 <sfork+0x190>
+  801afa:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b01:	e9 d0 fe ff ff       	jmp    8019d6 <sfork+0x190>
+  801b06:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b0d:	e9 c4 fe ff ff       	jmp    8019d6 <sfork+0x190>
+  801b12:	68 05 08 00 00       	push   $0x805
+  801b17:	ff 75 e4             	push   -0x1c(%ebp)
+  801b1a:	68 fd e7 0e 00       	push   $0xee7fd
+  801b1f:	57                   	push   %edi
+  801b20:	e8 4c fc ff ff       	call   801771 <dupq_map>
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	85 c0                	test   %eax,%eax
+  801b2a:	0f 88 30 fe ff ff    	js     801960 <sfork+0x11a>
+  801b30:	68 05 08 00 00       	push   $0x805
+  801b35:	57                   	push   %edi
+  801b36:	68 fd e7 0e 00       	push   $0xee7fd
+  801b3b:	57                   	push   %edi
+  801b3c:	e8 30 fc ff ff       	call   801771 <dupq_map>
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	e9 17 fe ff ff       	jmp    801960 <sfork+0x11a>
+
+00801b49 <fd2num>:
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b54:	c1 e8 0c             	shr    $0xc,%eax
+  801b57:	5d                   	pop    %ebp
+  801b58:	c3                   	ret
+
+00801b59 <fd2data>:
+  801b59:	55                   	push   %ebp
+  801b5a:	89 e5                	mov    %esp,%ebp
+  801b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b64:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b69:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801b6e:	5d                   	pop    %ebp
+  801b6f:	c3                   	ret
+
+00801b70 <fd_alloc>:
+  801b70:	55                   	push   %ebp
+  801b71:	89 e5                	mov    %esp,%ebp
+  801b73:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801b78:	89 c2                	mov    %eax,%edx
+  801b7a:	c1 ea 16             	shr    $0x16,%edx
+  801b7d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b84:	f6 c2 01             	test   $0x1,%dl
+  801b87:	74 29                	je     801bb2 <fd_alloc+0x42>
+  801b89:	89 c2                	mov    %eax,%edx
+  801b8b:	c1 ea 0c             	shr    $0xc,%edx
+  801b8e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b95:	f6 c2 01             	test   $0x1,%dl
+  801b98:	74 18                	je     801bb2 <fd_alloc+0x42>
+  801b9a:	05 00 10 00 00       	add    $0x1000,%eax
+  801b9f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801ba4:	75 d2                	jne    801b78 <fd_alloc+0x8>
+  801ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bab:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801bb0:	eb 05                	jmp    801bb7 <fd_alloc+0x47>
+  801bb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bba:	89 02                	mov    %eax,(%edx)
+  801bbc:	89 c8                	mov    %ecx,%eax
+  801bbe:	5d                   	pop    %ebp
+  801bbf:	c3                   	ret
+
+00801bc0 <fd_lookup>:
+  801bc0:	55                   	push   %ebp
+  801bc1:	89 e5                	mov    %esp,%ebp
+  801bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc6:	83 f8 1f             	cmp    $0x1f,%eax
+  801bc9:	77 30                	ja     801bfb <fd_lookup+0x3b>
+  801bcb:	c1 e0 0c             	shl    $0xc,%eax
+  801bce:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801bd3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801bd9:	f6 c2 01             	test   $0x1,%dl
+  801bdc:	74 24                	je     801c02 <fd_lookup+0x42>
+  801bde:	89 c2                	mov    %eax,%edx
+  801be0:	c1 ea 0c             	shr    $0xc,%edx
+  801be3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801bea:	f6 c2 01             	test   $0x1,%dl
+  801bed:	74 1a                	je     801c09 <fd_lookup+0x49>
+  801bef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bf2:	89 02                	mov    %eax,(%edx)
+  801bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf9:	5d                   	pop    %ebp
+  801bfa:	c3                   	ret
+  801bfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c00:	eb f7                	jmp    801bf9 <fd_lookup+0x39>
+  801c02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c07:	eb f0                	jmp    801bf9 <fd_lookup+0x39>
+  801c09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c0e:	eb e9                	jmp    801bf9 <fd_lookup+0x39>
+
+00801c10 <dev_lookup>:
+  801c10:	55                   	push   %ebp
+  801c11:	89 e5                	mov    %esp,%ebp
+  801c13:	53                   	push   %ebx
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1f:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801c24:	39 13                	cmp    %edx,(%ebx)
+  801c26:	74 37                	je     801c5f <dev_lookup+0x4f>
+  801c28:	83 c0 01             	add    $0x1,%eax
+  801c2b:	8b 1c 85 1c 3d 80 00 	mov    0x803d1c(,%eax,4),%ebx
+  801c32:	85 db                	test   %ebx,%ebx
+  801c34:	75 ee                	jne    801c24 <dev_lookup+0x14>
+  801c36:	a1 18 50 80 00       	mov    0x805018,%eax
+  801c3b:	8b 40 48             	mov    0x48(%eax),%eax
+  801c3e:	83 ec 04             	sub    $0x4,%esp
+  801c41:	52                   	push   %edx
+  801c42:	50                   	push   %eax
+  801c43:	68 a0 3c 80 00       	push   $0x803ca0
+  801c48:	e8 06 e6 ff ff       	call   800253 <cprintf>
+  801c4d:	83 c4 10             	add    $0x10,%esp
+  801c50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c55:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c58:	89 1a                	mov    %ebx,(%edx)
+  801c5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+  801c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c64:	eb ef                	jmp    801c55 <dev_lookup+0x45>
+
+00801c66 <fd_close>:
+  801c66:	55                   	push   %ebp
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	57                   	push   %edi
+  801c6a:	56                   	push   %esi
+  801c6b:	53                   	push   %ebx
+  801c6c:	83 ec 24             	sub    $0x24,%esp
+  801c6f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c72:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801c75:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c78:	50                   	push   %eax
+  801c79:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c7f:	c1 e8 0c             	shr    $0xc,%eax
+  801c82:	50                   	push   %eax
+  801c83:	e8 38 ff ff ff       	call   801bc0 <fd_lookup>
+  801c88:	89 c3                	mov    %eax,%ebx
+  801c8a:	83 c4 10             	add    $0x10,%esp
+  801c8d:	85 c0                	test   %eax,%eax
+  801c8f:	78 05                	js     801c96 <fd_close+0x30>
+  801c91:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c94:	74 0f                	je     801ca5 <fd_close+0x3f>
+  801c96:	85 ff                	test   %edi,%edi
+  801c98:	0f 44 df             	cmove  %edi,%ebx
+  801c9b:	89 d8                	mov    %ebx,%eax
+  801c9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca0:	5b                   	pop    %ebx
+  801ca1:	5e                   	pop    %esi
+  801ca2:	5f                   	pop    %edi
+  801ca3:	5d                   	pop    %ebp
+  801ca4:	c3                   	ret
+  801ca5:	83 ec 08             	sub    $0x8,%esp
+  801ca8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801cab:	50                   	push   %eax
+  801cac:	ff 36                	push   (%esi)
+  801cae:	e8 5d ff ff ff       	call   801c10 <dev_lookup>
+  801cb3:	89 c3                	mov    %eax,%ebx
+  801cb5:	83 c4 10             	add    $0x10,%esp
+  801cb8:	85 c0                	test   %eax,%eax
+  801cba:	78 1a                	js     801cd6 <fd_close+0x70>
+  801cbc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cbf:	8b 40 10             	mov    0x10(%eax),%eax
+  801cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	74 0b                	je     801cd6 <fd_close+0x70>
+  801ccb:	83 ec 0c             	sub    $0xc,%esp
+  801cce:	56                   	push   %esi
+  801ccf:	ff d0                	call   *%eax
+  801cd1:	89 c3                	mov    %eax,%ebx
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	83 ec 08             	sub    $0x8,%esp
+  801cd9:	56                   	push   %esi
+  801cda:	6a 00                	push   $0x0
+  801cdc:	e8 9b f1 ff ff       	call   800e7c <sys_page_unmap>
+  801ce1:	83 c4 10             	add    $0x10,%esp
+  801ce4:	eb b5                	jmp    801c9b <fd_close+0x35>
+
+00801ce6 <close>:
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	83 ec 20             	sub    $0x20,%esp
+  801cec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cef:	50                   	push   %eax
+  801cf0:	ff 75 08             	push   0x8(%ebp)
+  801cf3:	e8 c8 fe ff ff       	call   801bc0 <fd_lookup>
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	79 02                	jns    801d01 <close+0x1b>
+  801cff:	c9                   	leave
+  801d00:	c3                   	ret
+  801d01:	83 ec 08             	sub    $0x8,%esp
+  801d04:	6a 01                	push   $0x1
+  801d06:	ff 75 f4             	push   -0xc(%ebp)
+  801d09:	e8 58 ff ff ff       	call   801c66 <fd_close>
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	eb ec                	jmp    801cff <close+0x19>
+
+00801d13 <close_all>:
+  801d13:	55                   	push   %ebp
+  801d14:	89 e5                	mov    %esp,%ebp
+  801d16:	53                   	push   %ebx
+  801d17:	83 ec 04             	sub    $0x4,%esp
+  801d1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d1f:	83 ec 0c             	sub    $0xc,%esp
+  801d22:	53                   	push   %ebx
+  801d23:	e8 be ff ff ff       	call   801ce6 <close>
+  801d28:	83 c3 01             	add    $0x1,%ebx
+  801d2b:	83 c4 10             	add    $0x10,%esp
+  801d2e:	83 fb 20             	cmp    $0x20,%ebx
+  801d31:	75 ec                	jne    801d1f <close_all+0xc>
+  801d33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d36:	c9                   	leave
+  801d37:	c3                   	ret
+
+00801d38 <dup>:
+  801d38:	55                   	push   %ebp
+  801d39:	89 e5                	mov    %esp,%ebp
+  801d3b:	57                   	push   %edi
+  801d3c:	56                   	push   %esi
+  801d3d:	53                   	push   %ebx
+  801d3e:	83 ec 34             	sub    $0x34,%esp
+  801d41:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d44:	50                   	push   %eax
+  801d45:	ff 75 08             	push   0x8(%ebp)
+  801d48:	e8 73 fe ff ff       	call   801bc0 <fd_lookup>
+  801d4d:	89 c3                	mov    %eax,%ebx
+  801d4f:	83 c4 10             	add    $0x10,%esp
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 7f                	js     801dd5 <dup+0x9d>
+  801d56:	83 ec 0c             	sub    $0xc,%esp
+  801d59:	ff 75 0c             	push   0xc(%ebp)
+  801d5c:	e8 85 ff ff ff       	call   801ce6 <close>
+  801d61:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d64:	c1 e6 0c             	shl    $0xc,%esi
+  801d67:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801d6d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d70:	89 3c 24             	mov    %edi,(%esp)
+  801d73:	e8 e1 fd ff ff       	call   801b59 <fd2data>
+  801d78:	89 c3                	mov    %eax,%ebx
+  801d7a:	89 34 24             	mov    %esi,(%esp)
+  801d7d:	e8 d7 fd ff ff       	call   801b59 <fd2data>
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d88:	89 d8                	mov    %ebx,%eax
+  801d8a:	c1 e8 16             	shr    $0x16,%eax
+  801d8d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d94:	a8 01                	test   $0x1,%al
+  801d96:	74 11                	je     801da9 <dup+0x71>
+  801d98:	89 d8                	mov    %ebx,%eax
+  801d9a:	c1 e8 0c             	shr    $0xc,%eax
+  801d9d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801da4:	f6 c2 01             	test   $0x1,%dl
+  801da7:	75 36                	jne    801ddf <dup+0xa7>
+  801da9:	89 f8                	mov    %edi,%eax
+  801dab:	c1 e8 0c             	shr    $0xc,%eax
+  801dae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801db5:	83 ec 0c             	sub    $0xc,%esp
+  801db8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801dbd:	50                   	push   %eax
+  801dbe:	56                   	push   %esi
+  801dbf:	6a 00                	push   $0x0
+  801dc1:	57                   	push   %edi
+  801dc2:	6a 00                	push   $0x0
+  801dc4:	e8 24 f0 ff ff       	call   800ded <sys_page_map>
+  801dc9:	89 c3                	mov    %eax,%ebx
+  801dcb:	83 c4 20             	add    $0x20,%esp
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	78 33                	js     801e05 <dup+0xcd>
+  801dd2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801dd5:	89 d8                	mov    %ebx,%eax
+  801dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dda:	5b                   	pop    %ebx
+  801ddb:	5e                   	pop    %esi
+  801ddc:	5f                   	pop    %edi
+  801ddd:	5d                   	pop    %ebp
+  801dde:	c3                   	ret
+  801ddf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801de6:	83 ec 0c             	sub    $0xc,%esp
+  801de9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801dee:	50                   	push   %eax
+  801def:	ff 75 d4             	push   -0x2c(%ebp)
+  801df2:	6a 00                	push   $0x0
+  801df4:	53                   	push   %ebx
+  801df5:	6a 00                	push   $0x0
+  801df7:	e8 f1 ef ff ff       	call   800ded <sys_page_map>
+  801dfc:	89 c3                	mov    %eax,%ebx
+  801dfe:	83 c4 20             	add    $0x20,%esp
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	79 a4                	jns    801da9 <dup+0x71>
+  801e05:	83 ec 08             	sub    $0x8,%esp
+  801e08:	56                   	push   %esi
+  801e09:	6a 00                	push   $0x0
+  801e0b:	e8 6c f0 ff ff       	call   800e7c <sys_page_unmap>
+  801e10:	83 c4 08             	add    $0x8,%esp
+  801e13:	ff 75 d4             	push   -0x2c(%ebp)
+  801e16:	6a 00                	push   $0x0
+  801e18:	e8 5f f0 ff ff       	call   800e7c <sys_page_unmap>
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	eb b3                	jmp    801dd5 <dup+0x9d>
+
+00801e22 <read>:
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	56                   	push   %esi
+  801e26:	53                   	push   %ebx
+  801e27:	83 ec 18             	sub    $0x18,%esp
+  801e2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e2d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e30:	50                   	push   %eax
+  801e31:	56                   	push   %esi
+  801e32:	e8 89 fd ff ff       	call   801bc0 <fd_lookup>
+  801e37:	83 c4 10             	add    $0x10,%esp
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 3c                	js     801e7a <read+0x58>
+  801e3e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801e41:	83 ec 08             	sub    $0x8,%esp
+  801e44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e47:	50                   	push   %eax
+  801e48:	ff 33                	push   (%ebx)
+  801e4a:	e8 c1 fd ff ff       	call   801c10 <dev_lookup>
+  801e4f:	83 c4 10             	add    $0x10,%esp
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	78 24                	js     801e7a <read+0x58>
+  801e56:	8b 43 08             	mov    0x8(%ebx),%eax
+  801e59:	83 e0 03             	and    $0x3,%eax
+  801e5c:	83 f8 01             	cmp    $0x1,%eax
+  801e5f:	74 20                	je     801e81 <read+0x5f>
+  801e61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e64:	8b 40 08             	mov    0x8(%eax),%eax
+  801e67:	85 c0                	test   %eax,%eax
+  801e69:	74 37                	je     801ea2 <read+0x80>
+  801e6b:	83 ec 04             	sub    $0x4,%esp
+  801e6e:	ff 75 10             	push   0x10(%ebp)
+  801e71:	ff 75 0c             	push   0xc(%ebp)
+  801e74:	53                   	push   %ebx
+  801e75:	ff d0                	call   *%eax
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7d:	5b                   	pop    %ebx
+  801e7e:	5e                   	pop    %esi
+  801e7f:	5d                   	pop    %ebp
+  801e80:	c3                   	ret
+  801e81:	a1 18 50 80 00       	mov    0x805018,%eax
+  801e86:	8b 40 48             	mov    0x48(%eax),%eax
+  801e89:	83 ec 04             	sub    $0x4,%esp
+  801e8c:	56                   	push   %esi
+  801e8d:	50                   	push   %eax
+  801e8e:	68 e1 3c 80 00       	push   $0x803ce1
+  801e93:	e8 bb e3 ff ff       	call   800253 <cprintf>
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ea0:	eb d8                	jmp    801e7a <read+0x58>
+  801ea2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ea7:	eb d1                	jmp    801e7a <read+0x58>
+
+00801ea9 <readn>:
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	57                   	push   %edi
+  801ead:	56                   	push   %esi
+  801eae:	53                   	push   %ebx
+  801eaf:	83 ec 0c             	sub    $0xc,%esp
+  801eb2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801eb5:	8b 75 10             	mov    0x10(%ebp),%esi
+  801eb8:	85 f6                	test   %esi,%esi
+  801eba:	74 30                	je     801eec <readn+0x43>
+  801ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec6:	83 ec 04             	sub    $0x4,%esp
+  801ec9:	89 f2                	mov    %esi,%edx
+  801ecb:	29 c2                	sub    %eax,%edx
+  801ecd:	52                   	push   %edx
+  801ece:	01 f8                	add    %edi,%eax
+  801ed0:	50                   	push   %eax
+  801ed1:	ff 75 08             	push   0x8(%ebp)
+  801ed4:	e8 49 ff ff ff       	call   801e22 <read>
+  801ed9:	83 c4 10             	add    $0x10,%esp
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	78 15                	js     801ef5 <readn+0x4c>
+  801ee0:	74 11                	je     801ef3 <readn+0x4a>
+  801ee2:	01 c3                	add    %eax,%ebx
+  801ee4:	89 d8                	mov    %ebx,%eax
+  801ee6:	39 f3                	cmp    %esi,%ebx
+  801ee8:	72 dc                	jb     801ec6 <readn+0x1d>
+  801eea:	eb 09                	jmp    801ef5 <readn+0x4c>
+  801eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef1:	eb 02                	jmp    801ef5 <readn+0x4c>
+  801ef3:	89 d8                	mov    %ebx,%eax
+  801ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef8:	5b                   	pop    %ebx
+  801ef9:	5e                   	pop    %esi
+  801efa:	5f                   	pop    %edi
+  801efb:	5d                   	pop    %ebp
+  801efc:	c3                   	ret
+
+00801efd <write>:
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	56                   	push   %esi
+  801f01:	53                   	push   %ebx
+  801f02:	83 ec 18             	sub    $0x18,%esp
+  801f05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f0b:	50                   	push   %eax
+  801f0c:	53                   	push   %ebx
+  801f0d:	e8 ae fc ff ff       	call   801bc0 <fd_lookup>
+  801f12:	83 c4 10             	add    $0x10,%esp
+  801f15:	85 c0                	test   %eax,%eax
+  801f17:	78 37                	js     801f50 <write+0x53>
+  801f19:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f1c:	83 ec 08             	sub    $0x8,%esp
+  801f1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f22:	50                   	push   %eax
+  801f23:	ff 36                	push   (%esi)
+  801f25:	e8 e6 fc ff ff       	call   801c10 <dev_lookup>
+  801f2a:	83 c4 10             	add    $0x10,%esp
+  801f2d:	85 c0                	test   %eax,%eax
+  801f2f:	78 1f                	js     801f50 <write+0x53>
+  801f31:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f35:	74 20                	je     801f57 <write+0x5a>
+  801f37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f3a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	74 37                	je     801f78 <write+0x7b>
+  801f41:	83 ec 04             	sub    $0x4,%esp
+  801f44:	ff 75 10             	push   0x10(%ebp)
+  801f47:	ff 75 0c             	push   0xc(%ebp)
+  801f4a:	56                   	push   %esi
+  801f4b:	ff d0                	call   *%eax
+  801f4d:	83 c4 10             	add    $0x10,%esp
+  801f50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f53:	5b                   	pop    %ebx
+  801f54:	5e                   	pop    %esi
+  801f55:	5d                   	pop    %ebp
+  801f56:	c3                   	ret
+  801f57:	a1 18 50 80 00       	mov    0x805018,%eax
+  801f5c:	8b 40 48             	mov    0x48(%eax),%eax
+  801f5f:	83 ec 04             	sub    $0x4,%esp
+  801f62:	53                   	push   %ebx
+  801f63:	50                   	push   %eax
+  801f64:	68 fd 3c 80 00       	push   $0x803cfd
+  801f69:	e8 e5 e2 ff ff       	call   800253 <cprintf>
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f76:	eb d8                	jmp    801f50 <write+0x53>
+  801f78:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f7d:	eb d1                	jmp    801f50 <write+0x53>
+
+00801f7f <seek>:
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	83 ec 20             	sub    $0x20,%esp
+  801f85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f88:	50                   	push   %eax
+  801f89:	ff 75 08             	push   0x8(%ebp)
+  801f8c:	e8 2f fc ff ff       	call   801bc0 <fd_lookup>
+  801f91:	83 c4 10             	add    $0x10,%esp
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	78 0e                	js     801fa6 <seek+0x27>
+  801f98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f9e:	89 50 04             	mov    %edx,0x4(%eax)
+  801fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa6:	c9                   	leave
+  801fa7:	c3                   	ret
+
+00801fa8 <ftruncate>:
+  801fa8:	55                   	push   %ebp
+  801fa9:	89 e5                	mov    %esp,%ebp
+  801fab:	56                   	push   %esi
+  801fac:	53                   	push   %ebx
+  801fad:	83 ec 18             	sub    $0x18,%esp
+  801fb0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801fb3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fb6:	50                   	push   %eax
+  801fb7:	53                   	push   %ebx
+  801fb8:	e8 03 fc ff ff       	call   801bc0 <fd_lookup>
+  801fbd:	83 c4 10             	add    $0x10,%esp
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	78 34                	js     801ff8 <ftruncate+0x50>
+  801fc4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fc7:	83 ec 08             	sub    $0x8,%esp
+  801fca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fcd:	50                   	push   %eax
+  801fce:	ff 36                	push   (%esi)
+  801fd0:	e8 3b fc ff ff       	call   801c10 <dev_lookup>
+  801fd5:	83 c4 10             	add    $0x10,%esp
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	78 1c                	js     801ff8 <ftruncate+0x50>
+  801fdc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fe0:	74 1d                	je     801fff <ftruncate+0x57>
+  801fe2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fe5:	8b 40 18             	mov    0x18(%eax),%eax
+  801fe8:	85 c0                	test   %eax,%eax
+  801fea:	74 34                	je     802020 <ftruncate+0x78>
+  801fec:	83 ec 08             	sub    $0x8,%esp
+  801fef:	ff 75 0c             	push   0xc(%ebp)
+  801ff2:	56                   	push   %esi
+  801ff3:	ff d0                	call   *%eax
+  801ff5:	83 c4 10             	add    $0x10,%esp
+  801ff8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffb:	5b                   	pop    %ebx
+  801ffc:	5e                   	pop    %esi
+  801ffd:	5d                   	pop    %ebp
+  801ffe:	c3                   	ret
+  801fff:	a1 18 50 80 00       	mov    0x805018,%eax
+  802004:	8b 40 48             	mov    0x48(%eax),%eax
+  802007:	83 ec 04             	sub    $0x4,%esp
+  80200a:	53                   	push   %ebx
+  80200b:	50                   	push   %eax
+  80200c:	68 c0 3c 80 00       	push   $0x803cc0
+  802011:	e8 3d e2 ff ff       	call   800253 <cprintf>
+  802016:	83 c4 10             	add    $0x10,%esp
+  802019:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80201e:	eb d8                	jmp    801ff8 <ftruncate+0x50>
+  802020:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802025:	eb d1                	jmp    801ff8 <ftruncate+0x50>
+
+00802027 <fstat>:
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	56                   	push   %esi
+  80202b:	53                   	push   %ebx
+  80202c:	83 ec 18             	sub    $0x18,%esp
+  80202f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802032:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802035:	50                   	push   %eax
+  802036:	ff 75 08             	push   0x8(%ebp)
+  802039:	e8 82 fb ff ff       	call   801bc0 <fd_lookup>
+  80203e:	83 c4 10             	add    $0x10,%esp
+  802041:	85 c0                	test   %eax,%eax
+  802043:	78 49                	js     80208e <fstat+0x67>
+  802045:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802048:	83 ec 08             	sub    $0x8,%esp
+  80204b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80204e:	50                   	push   %eax
+  80204f:	ff 36                	push   (%esi)
+  802051:	e8 ba fb ff ff       	call   801c10 <dev_lookup>
+  802056:	83 c4 10             	add    $0x10,%esp
+  802059:	85 c0                	test   %eax,%eax
+  80205b:	78 31                	js     80208e <fstat+0x67>
+  80205d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802060:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802064:	74 2f                	je     802095 <fstat+0x6e>
+  802066:	c6 03 00             	movb   $0x0,(%ebx)
+  802069:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802070:	00 00 00 
+  802073:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80207a:	00 00 00 
+  80207d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802083:	83 ec 08             	sub    $0x8,%esp
+  802086:	53                   	push   %ebx
+  802087:	56                   	push   %esi
+  802088:	ff 50 14             	call   *0x14(%eax)
+  80208b:	83 c4 10             	add    $0x10,%esp
+  80208e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802091:	5b                   	pop    %ebx
+  802092:	5e                   	pop    %esi
+  802093:	5d                   	pop    %ebp
+  802094:	c3                   	ret
+  802095:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80209a:	eb f2                	jmp    80208e <fstat+0x67>
+
+0080209c <stat>:
+  80209c:	55                   	push   %ebp
+  80209d:	89 e5                	mov    %esp,%ebp
+  80209f:	56                   	push   %esi
+  8020a0:	53                   	push   %ebx
+  8020a1:	83 ec 08             	sub    $0x8,%esp
+  8020a4:	6a 00                	push   $0x0
+  8020a6:	ff 75 08             	push   0x8(%ebp)
+  8020a9:	e8 31 05 00 00       	call   8025df <open>
+  8020ae:	89 c3                	mov    %eax,%ebx
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	85 c0                	test   %eax,%eax
+  8020b5:	78 1b                	js     8020d2 <stat+0x36>
+  8020b7:	83 ec 08             	sub    $0x8,%esp
+  8020ba:	ff 75 0c             	push   0xc(%ebp)
+  8020bd:	50                   	push   %eax
+  8020be:	e8 64 ff ff ff       	call   802027 <fstat>
+  8020c3:	89 c6                	mov    %eax,%esi
+  8020c5:	89 1c 24             	mov    %ebx,(%esp)
+  8020c8:	e8 19 fc ff ff       	call   801ce6 <close>
+  8020cd:	83 c4 10             	add    $0x10,%esp
+  8020d0:	89 f3                	mov    %esi,%ebx
+  8020d2:	89 d8                	mov    %ebx,%eax
+  8020d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d7:	5b                   	pop    %ebx
+  8020d8:	5e                   	pop    %esi
+  8020d9:	5d                   	pop    %ebp
+  8020da:	c3                   	ret
+
+008020db <fsipc>:
+  8020db:	55                   	push   %ebp
+  8020dc:	89 e5                	mov    %esp,%ebp
+  8020de:	56                   	push   %esi
+  8020df:	53                   	push   %ebx
+  8020e0:	89 c3                	mov    %eax,%ebx
+  8020e2:	89 d6                	mov    %edx,%esi
+  8020e4:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8020eb:	74 20                	je     80210d <fsipc+0x32>
+  8020ed:	83 ec 08             	sub    $0x8,%esp
+  8020f0:	6a 00                	push   $0x0
+  8020f2:	56                   	push   %esi
+  8020f3:	6a 07                	push   $0x7
+  8020f5:	68 00 60 80 00       	push   $0x806000
+  8020fa:	53                   	push   %ebx
+  8020fb:	ff 35 0c 50 80 00    	push   0x80500c
+  802101:	e8 fd 12 00 00       	call   803403 <ipc_call>
+  802106:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802109:	5b                   	pop    %ebx
+  80210a:	5e                   	pop    %esi
+  80210b:	5d                   	pop    %ebp
+  80210c:	c3                   	ret
+  80210d:	83 ec 0c             	sub    $0xc,%esp
+  802110:	6a 02                	push   $0x2
+  802112:	e8 87 14 00 00       	call   80359e <ipc_find_env>
+  802117:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80211c:	83 c4 10             	add    $0x10,%esp
+  80211f:	eb cc                	jmp    8020ed <fsipc+0x12>
+
+00802121 <devfile_trunc>:
+  802121:	55                   	push   %ebp
+  802122:	89 e5                	mov    %esp,%ebp
+  802124:	83 ec 08             	sub    $0x8,%esp
+  802127:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80212d:	a3 00 60 80 00       	mov    %eax,0x806000
+  802132:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802135:	a3 04 60 80 00       	mov    %eax,0x806004
+  80213a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802144:	e8 92 ff ff ff       	call   8020db <fsipc>
+  802149:	c9                   	leave
+  80214a:	c3                   	ret
+
+0080214b <devfile_flush>:
+  80214b:	55                   	push   %ebp
+  80214c:	89 e5                	mov    %esp,%ebp
+  80214e:	83 ec 08             	sub    $0x8,%esp
+  802151:	8b 45 08             	mov    0x8(%ebp),%eax
+  802154:	8b 40 0c             	mov    0xc(%eax),%eax
+  802157:	a3 00 60 80 00       	mov    %eax,0x806000
+  80215c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802161:	b8 08 00 00 00       	mov    $0x8,%eax
+  802166:	e8 70 ff ff ff       	call   8020db <fsipc>
+  80216b:	c9                   	leave
+  80216c:	c3                   	ret
+
+0080216d <devfile_stat>:
+  80216d:	55                   	push   %ebp
+  80216e:	89 e5                	mov    %esp,%ebp
+  802170:	53                   	push   %ebx
+  802171:	83 ec 04             	sub    $0x4,%esp
+  802174:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80217d:	a3 00 60 80 00       	mov    %eax,0x806000
+  802182:	ba 00 00 00 00       	mov    $0x0,%edx
+  802187:	b8 07 00 00 00       	mov    $0x7,%eax
+  80218c:	e8 4a ff ff ff       	call   8020db <fsipc>
+  802191:	85 c0                	test   %eax,%eax
+  802193:	78 2c                	js     8021c1 <devfile_stat+0x54>
+  802195:	83 ec 08             	sub    $0x8,%esp
+  802198:	68 00 60 80 00       	push   $0x806000
+  80219d:	53                   	push   %ebx
+  80219e:	e8 a7 e7 ff ff       	call   80094a <strcpy>
+  8021a3:	a1 80 60 80 00       	mov    0x806080,%eax
+  8021a8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8021ae:	a1 84 60 80 00       	mov    0x806084,%eax
+  8021b3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021c4:	c9                   	leave
+  8021c5:	c3                   	ret
+
+008021c6 <fsring_rw>:
+  8021c6:	55                   	push   %ebp
+  8021c7:	89 e5                	mov    %esp,%ebp
+  8021c9:	57                   	push   %edi
+  8021ca:	56                   	push   %esi
+  8021cb:	53                   	push   %ebx
+  8021cc:	83 ec 2c             	sub    $0x2c,%esp
+  8021cf:	89 c7                	mov    %eax,%edi
+  8021d1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8021d4:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8021d7:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8021dc:	a8 01                	test   $0x1,%al
+  8021de:	74 0d                	je     8021ed <fsring_rw+0x27>
+  8021e0:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8021e5:	a8 01                	test   $0x1,%al
+  8021e7:	0f 85 d5 00 00 00    	jne    8022c2 <fsring_rw+0xfc>
+  8021ed:	a1 18 50 80 00       	mov    0x805018,%eax
+  8021f2:	8b 40 48             	mov    0x48(%eax),%eax
+  8021f5:	3b 05 08 50 80 00    	cmp    0x805008,%eax
+  8021fb:	0f 84 fc 00 00 00    	je     8022fd <fsring_rw+0x137>
+  802201:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802208:	0f 84 02 01 00 00    	je     802310 <fsring_rw+0x14a>
+  80220e:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802213:	83 ec 04             	sub    $0x4,%esp
+  802216:	68 07 02 00 00       	push   $0x207
+  80221b:	53                   	push   %ebx
+  80221c:	6a 00                	push   $0x0
+  80221e:	e8 87 eb ff ff       	call   800daa <sys_page_alloc>
+  802223:	83 c4 10             	add    $0x10,%esp
+  802226:	85 c0                	test   %eax,%eax
+  802228:	0f 88 f9 00 00 00    	js     802327 <fsring_rw+0x161>
+  80222e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802234:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80223a:	75 d7                	jne    802213 <fsring_rw+0x4d>
+  80223c:	6a 0e                	push   $0xe
+  80223e:	6a 0d                	push   $0xd
+  802240:	ff 35 0c 50 80 00    	push   0x80500c
+  802246:	68 00 00 f0 cf       	push   $0xcff00000
+  80224b:	e8 c4 0c 00 00       	call   802f14 <ipcring_init>
+  802250:	83 c4 08             	add    $0x8,%esp
+  802253:	6a 00                	push   $0x0
+  802255:	6a 00                	push   $0x0
+  802257:	68 07 02 00 00       	push   $0x207
+  80225c:	68 00 00 f0 cf       	push   $0xcff00000
+  802261:	6a 0b                	push   $0xb
+  802263:	ff 35 0c 50 80 00    	push   0x80500c
+  802269:	e8 95 11 00 00       	call   803403 <ipc_call>
+  80226e:	89 c6                	mov    %eax,%esi
+  802270:	83 c4 20             	add    $0x20,%esp
+  802273:	85 c0                	test   %eax,%eax
+  802275:	0f 88 ac 00 00 00    	js     802327 <fsring_rw+0x161>
+  80227b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802280:	89 d9                	mov    %ebx,%ecx
+  802282:	83 c3 01             	add    $0x1,%ebx
+  802285:	89 da                	mov    %ebx,%edx
+  802287:	c1 e2 0c             	shl    $0xc,%edx
+  80228a:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802290:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802296:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80229c:	83 ec 08             	sub    $0x8,%esp
+  80229f:	6a 00                	push   $0x0
+  8022a1:	6a 00                	push   $0x0
+  8022a3:	68 07 02 00 00       	push   $0x207
+  8022a8:	50                   	push   %eax
+  8022a9:	6a 0c                	push   $0xc
+  8022ab:	ff 35 0c 50 80 00    	push   0x80500c
+  8022b1:	e8 4d 11 00 00       	call   803403 <ipc_call>
+  8022b6:	83 c4 20             	add    $0x20,%esp
+  8022b9:	85 c0                	test   %eax,%eax
+  8022bb:	78 6a                	js     802327 <fsring_rw+0x161>
+  8022bd:	83 fb 08             	cmp    $0x8,%ebx
+  8022c0:	75 be                	jne    802280 <fsring_rw+0xba>
+  8022c2:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8022c6:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8022cb:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8022d0:	0f 45 c2             	cmovne %edx,%eax
+  8022d3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8022d6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8022dd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8022e4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8022eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f5:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8022f8:	e9 4b 01 00 00       	jmp    802448 <fsring_rw+0x282>
+  8022fd:	e8 72 ee ff ff       	call   801174 <sys_time_msec>
+  802302:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  802308:	0f 89 f3 fe ff ff    	jns    802201 <fsring_rw+0x3b>
+  80230e:	eb 54                	jmp    802364 <fsring_rw+0x19e>
+  802310:	83 ec 0c             	sub    $0xc,%esp
+  802313:	6a 02                	push   $0x2
+  802315:	e8 84 12 00 00       	call   80359e <ipc_find_env>
+  80231a:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  80231f:	83 c4 10             	add    $0x10,%esp
+  802322:	e9 e7 fe ff ff       	jmp    80220e <fsring_rw+0x48>
+  802327:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80232c:	83 ec 08             	sub    $0x8,%esp
+  80232f:	53                   	push   %ebx
+  802330:	6a 00                	push   $0x0
+  802332:	e8 45 eb ff ff       	call   800e7c <sys_page_unmap>
+  802337:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802346:	75 e4                	jne    80232c <fsring_rw+0x166>
+  802348:	e8 27 ee ff ff       	call   801174 <sys_time_msec>
+  80234d:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802352:	a3 04 50 80 00       	mov    %eax,0x805004
+  802357:	a1 18 50 80 00       	mov    0x805018,%eax
+  80235c:	8b 40 48             	mov    0x48(%eax),%eax
+  80235f:	a3 08 50 80 00       	mov    %eax,0x805008
+  802364:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80236b:	e9 7a 01 00 00       	jmp    8024ea <fsring_rw+0x324>
+  802370:	8b 57 0c             	mov    0xc(%edi),%edx
+  802373:	89 10                	mov    %edx,(%eax)
+  802375:	89 58 04             	mov    %ebx,0x4(%eax)
+  802378:	89 f2                	mov    %esi,%edx
+  80237a:	03 57 04             	add    0x4(%edi),%edx
+  80237d:	89 50 08             	mov    %edx,0x8(%eax)
+  802380:	83 ec 04             	sub    $0x4,%esp
+  802383:	53                   	push   %ebx
+  802384:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802387:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80238a:	52                   	push   %edx
+  80238b:	83 c0 0c             	add    $0xc,%eax
+  80238e:	50                   	push   %eax
+  80238f:	e8 66 e7 ff ff       	call   800afa <memmove>
+  802394:	83 c4 10             	add    $0x10,%esp
+  802397:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80239a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80239d:	89 08                	mov    %ecx,(%eax)
+  80239f:	83 ec 0c             	sub    $0xc,%esp
+  8023a2:	68 00 00 f0 cf       	push   $0xcff00000
+  8023a7:	e8 c6 0b 00 00       	call   802f72 <ipcring_req_push>
+  8023ac:	01 de                	add    %ebx,%esi
+  8023ae:	83 c4 10             	add    $0x10,%esp
+  8023b1:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8023b4:	73 4c                	jae    802402 <fsring_rw+0x23c>
+  8023b6:	83 ec 0c             	sub    $0xc,%esp
+  8023b9:	68 00 00 f0 cf       	push   $0xcff00000
+  8023be:	e8 89 0b 00 00       	call   802f4c <ipcring_req_slot>
+  8023c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023c6:	83 c4 10             	add    $0x10,%esp
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	74 35                	je     802402 <fsring_rw+0x23c>
+  8023cd:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8023d2:	83 e0 07             	and    $0x7,%eax
+  8023d5:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8023da:	c1 e0 0c             	shl    $0xc,%eax
+  8023dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023e0:	29 f3                	sub    %esi,%ebx
+  8023e2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8023e5:	39 cb                	cmp    %ecx,%ebx
+  8023e7:	0f 47 d9             	cmova  %ecx,%ebx
+  8023ea:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8023ee:	75 80                	jne    802370 <fsring_rw+0x1aa>
+  8023f0:	8b 57 0c             	mov    0xc(%edi),%edx
+  8023f3:	89 10                	mov    %edx,(%eax)
+  8023f5:	89 58 04             	mov    %ebx,0x4(%eax)
+  8023f8:	89 f2                	mov    %esi,%edx
+  8023fa:	03 57 04             	add    0x4(%edi),%edx
+  8023fd:	89 50 08             	mov    %edx,0x8(%eax)
+  802400:	eb 95                	jmp    802397 <fsring_rw+0x1d1>
+  802402:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802407:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80240a:	83 ec 0c             	sub    $0xc,%esp
+  80240d:	68 00 00 f0 cf       	push   $0xcff00000
+  802412:	e8 94 0b 00 00       	call   802fab <ipcring_rsp_wait>
+  802417:	8b 58 04             	mov    0x4(%eax),%ebx
+  80241a:	83 c4 10             	add    $0x10,%esp
+  80241d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802421:	75 45                	jne    802468 <fsring_rw+0x2a2>
+  802423:	85 db                	test   %ebx,%ebx
+  802425:	79 41                	jns    802468 <fsring_rw+0x2a2>
+  802427:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80242a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802431:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802438:	83 ec 0c             	sub    $0xc,%esp
+  80243b:	68 00 00 f0 cf       	push   $0xcff00000
+  802440:	e8 cc 0b 00 00       	call   803011 <ipcring_rsp_pop>
+  802445:	83 c4 10             	add    $0x10,%esp
+  802448:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80244e:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802453:	39 c2                	cmp    %eax,%edx
+  802455:	74 75                	je     8024cc <fsring_rw+0x306>
+  802457:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80245b:	75 a5                	jne    802402 <fsring_rw+0x23c>
+  80245d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802460:	0f 82 50 ff ff ff    	jb     8023b6 <fsring_rw+0x1f0>
+  802466:	eb 9a                	jmp    802402 <fsring_rw+0x23c>
+  802468:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80246c:	75 ca                	jne    802438 <fsring_rw+0x272>
+  80246e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802472:	74 31                	je     8024a5 <fsring_rw+0x2df>
+  802474:	8b 45 08             	mov    0x8(%ebp),%eax
+  802477:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80247a:	29 c8                	sub    %ecx,%eax
+  80247c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80247f:	39 d0                	cmp    %edx,%eax
+  802481:	0f 47 c2             	cmova  %edx,%eax
+  802484:	39 d8                	cmp    %ebx,%eax
+  802486:	ba 01 00 00 00       	mov    $0x1,%edx
+  80248b:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80248f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802492:	b8 01 00 00 00       	mov    $0x1,%eax
+  802497:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80249b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80249e:	01 d9                	add    %ebx,%ecx
+  8024a0:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8024a3:	eb 93                	jmp    802438 <fsring_rw+0x272>
+  8024a5:	83 ec 04             	sub    $0x4,%esp
+  8024a8:	53                   	push   %ebx
+  8024a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024ac:	83 e0 07             	and    $0x7,%eax
+  8024af:	c1 e0 0c             	shl    $0xc,%eax
+  8024b2:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8024b8:	50                   	push   %eax
+  8024b9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024bc:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8024bf:	01 c8                	add    %ecx,%eax
+  8024c1:	50                   	push   %eax
+  8024c2:	e8 33 e6 ff ff       	call   800afa <memmove>
+  8024c7:	83 c4 10             	add    $0x10,%esp
+  8024ca:	eb a8                	jmp    802474 <fsring_rw+0x2ae>
+  8024cc:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8024d0:	75 09                	jne    8024db <fsring_rw+0x315>
+  8024d2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8024d5:	0f 82 db fe ff ff    	jb     8023b6 <fsring_rw+0x1f0>
+  8024db:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8024de:	01 57 04             	add    %edx,0x4(%edi)
+  8024e1:	85 d2                	test   %edx,%edx
+  8024e3:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8024e7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8024ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8024ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024f0:	5b                   	pop    %ebx
+  8024f1:	5e                   	pop    %esi
+  8024f2:	5f                   	pop    %edi
+  8024f3:	5d                   	pop    %ebp
+  8024f4:	c3                   	ret
+
+008024f5 <devfile_write>:
+  8024f5:	55                   	push   %ebp
+  8024f6:	89 e5                	mov    %esp,%ebp
+  8024f8:	57                   	push   %edi
+  8024f9:	56                   	push   %esi
+  8024fa:	53                   	push   %ebx
+  8024fb:	83 ec 0c             	sub    $0xc,%esp
+  8024fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802501:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802504:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802507:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80250d:	76 1a                	jbe    802529 <devfile_write+0x34>
+  80250f:	83 ec 0c             	sub    $0xc,%esp
+  802512:	53                   	push   %ebx
+  802513:	89 f1                	mov    %esi,%ecx
+  802515:	ba 06 00 00 00       	mov    $0x6,%edx
+  80251a:	89 f8                	mov    %edi,%eax
+  80251c:	e8 a5 fc ff ff       	call   8021c6 <fsring_rw>
+  802521:	83 c4 10             	add    $0x10,%esp
+  802524:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802527:	75 39                	jne    802562 <devfile_write+0x6d>
+  802529:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80252e:	39 c3                	cmp    %eax,%ebx
+  802530:	0f 47 d8             	cmova  %eax,%ebx
+  802533:	8b 47 0c             	mov    0xc(%edi),%eax
+  802536:	a3 00 60 80 00       	mov    %eax,0x806000
+  80253b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802541:	83 ec 04             	sub    $0x4,%esp
+  802544:	53                   	push   %ebx
+  802545:	56                   	push   %esi
+  802546:	68 08 60 80 00       	push   $0x806008
+  80254b:	e8 aa e5 ff ff       	call   800afa <memmove>
+  802550:	ba 00 00 00 00       	mov    $0x0,%edx
+  802555:	b8 04 00 00 00       	mov    $0x4,%eax
+  80255a:	e8 7c fb ff ff       	call   8020db <fsipc>
+  80255f:	83 c4 10             	add    $0x10,%esp
+  802562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802565:	5b                   	pop    %ebx
+  802566:	5e                   	pop    %esi
+  802567:	5f                   	pop    %edi
+  802568:	5d                   	pop    %ebp
+  802569:	c3                   	ret
+
+0080256a <devfile_read>:
+  80256a:	55                   	push   %ebp
+  80256b:	89 e5                	mov    %esp,%ebp
+  80256d:	57                   	push   %edi
+  80256e:	56                   	push   %esi
+  80256f:	53                   	push   %ebx
+  802570:	83 ec 0c             	sub    $0xc,%esp
+  802573:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802576:	8b 75 10             	mov    0x10(%ebp),%esi
+  802579:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80257f:	76 1d                	jbe    80259e <devfile_read+0x34>
+  802581:	83 ec 0c             	sub    $0xc,%esp
+  802584:	56                   	push   %esi
+  802585:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802588:	ba 05 00 00 00       	mov    $0x5,%edx
+  80258d:	89 f8                	mov    %edi,%eax
+  80258f:	e8 32 fc ff ff       	call   8021c6 <fsring_rw>
+  802594:	89 c3                	mov    %eax,%ebx
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80259c:	75 37                	jne    8025d5 <devfile_read+0x6b>
+  80259e:	8b 47 0c             	mov    0xc(%edi),%eax
+  8025a1:	a3 00 60 80 00       	mov    %eax,0x806000
+  8025a6:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8025ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025b6:	e8 20 fb ff ff       	call   8020db <fsipc>
+  8025bb:	89 c3                	mov    %eax,%ebx
+  8025bd:	85 c0                	test   %eax,%eax
+  8025bf:	78 14                	js     8025d5 <devfile_read+0x6b>
+  8025c1:	83 ec 04             	sub    $0x4,%esp
+  8025c4:	50                   	push   %eax
+  8025c5:	68 00 60 80 00       	push   $0x806000
+  8025ca:	ff 75 0c             	push   0xc(%ebp)
+  8025cd:	e8 28 e5 ff ff       	call   800afa <memmove>
+  8025d2:	83 c4 10             	add    $0x10,%esp
+  8025d5:	89 d8                	mov    %ebx,%eax
+  8025d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025da:	5b                   	pop    %ebx
+  8025db:	5e                   	pop    %esi
+  8025dc:	5f                   	pop    %edi
+  8025dd:	5d                   	pop    %ebp
+  8025de:	c3                   	ret
+
+008025df <open>:
+  8025df:	55                   	push   %ebp
+  8025e0:	89 e5                	mov    %esp,%ebp
+  8025e2:	56                   	push   %esi
+  8025e3:	53                   	push   %ebx
+  8025e4:	83 ec 1c             	sub    $0x1c,%esp
+  8025e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025ea:	56                   	push   %esi
+  8025eb:	e8 0e e3 ff ff       	call   8008fe <strlen>
+  8025f0:	83 c4 10             	add    $0x10,%esp
+  8025f3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025f8:	7f 6c                	jg     802666 <open+0x87>
+  8025fa:	83 ec 0c             	sub    $0xc,%esp
+  8025fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802600:	50                   	push   %eax
+  802601:	e8 6a f5 ff ff       	call   801b70 <fd_alloc>
+  802606:	89 c3                	mov    %eax,%ebx
+  802608:	83 c4 10             	add    $0x10,%esp
+  80260b:	85 c0                	test   %eax,%eax
+  80260d:	78 3c                	js     80264b <open+0x6c>
+  80260f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802612:	a3 00 64 80 00       	mov    %eax,0x806400
+  802617:	83 ec 08             	sub    $0x8,%esp
+  80261a:	56                   	push   %esi
+  80261b:	68 00 60 80 00       	push   $0x806000
+  802620:	e8 25 e3 ff ff       	call   80094a <strcpy>
+  802625:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802628:	b8 01 00 00 00       	mov    $0x1,%eax
+  80262d:	e8 a9 fa ff ff       	call   8020db <fsipc>
+  802632:	89 c3                	mov    %eax,%ebx
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	85 c0                	test   %eax,%eax
+  802639:	78 19                	js     802654 <open+0x75>
+  80263b:	83 ec 0c             	sub    $0xc,%esp
+  80263e:	ff 75 f4             	push   -0xc(%ebp)
+  802641:	e8 03 f5 ff ff       	call   801b49 <fd2num>
+  802646:	89 c3                	mov    %eax,%ebx
+  802648:	83 c4 10             	add    $0x10,%esp
+  80264b:	89 d8                	mov    %ebx,%eax
+  80264d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802650:	5b                   	pop    %ebx
+  802651:	5e                   	pop    %esi
+  802652:	5d                   	pop    %ebp
+  802653:	c3                   	ret
+  802654:	83 ec 08             	sub    $0x8,%esp
+  802657:	6a 00                	push   $0x0
+  802659:	ff 75 f4             	push   -0xc(%ebp)
+  80265c:	e8 05 f6 ff ff       	call   801c66 <fd_close>
+  802661:	83 c4 10             	add    $0x10,%esp
+  802664:	eb e5                	jmp    80264b <open+0x6c>
+  802666:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80266b:	eb de                	jmp    80264b <open+0x6c>
+
+0080266d <file_image>:
+  80266d:	55                   	push   %ebp
+  80266e:	89 e5                	mov    %esp,%ebp
+  802670:	53                   	push   %ebx
+  802671:	83 ec 1c             	sub    $0x1c,%esp
+  802674:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802677:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80267a:	50                   	push   %eax
+  80267b:	ff 75 08             	push   0x8(%ebp)
+  80267e:	e8 3d f5 ff ff       	call   801bc0 <fd_lookup>
+  802683:	83 c4 10             	add    $0x10,%esp
+  802686:	85 c0                	test   %eax,%eax
+  802688:	78 58                	js     8026e2 <file_image+0x75>
+  80268a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80268d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802693:	39 08                	cmp    %ecx,(%eax)
+  802695:	75 50                	jne    8026e7 <file_image+0x7a>
+  802697:	83 fb 04             	cmp    $0x4,%ebx
+  80269a:	77 52                	ja     8026ee <file_image+0x81>
+  80269c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80269f:	a3 00 60 80 00       	mov    %eax,0x806000
+  8026a4:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8026aa:	83 ec 04             	sub    $0x4,%esp
+  8026ad:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8026b0:	c1 e0 02             	shl    $0x2,%eax
+  8026b3:	50                   	push   %eax
+  8026b4:	ff 75 0c             	push   0xc(%ebp)
+  8026b7:	68 08 60 80 00       	push   $0x806008
+  8026bc:	e8 39 e4 ff ff       	call   800afa <memmove>
+  8026c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8026cb:	e8 0b fa ff ff       	call   8020db <fsipc>
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	78 0b                	js     8026e2 <file_image+0x75>
+  8026d7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8026da:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  8026e0:	89 0a                	mov    %ecx,(%edx)
+  8026e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e5:	c9                   	leave
+  8026e6:	c3                   	ret
+  8026e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026ec:	eb f4                	jmp    8026e2 <file_image+0x75>
+  8026ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026f3:	eb ed                	jmp    8026e2 <file_image+0x75>
+
+008026f5 <remove>:
+  8026f5:	55                   	push   %ebp
+  8026f6:	89 e5                	mov    %esp,%ebp
+  8026f8:	53                   	push   %ebx
+  8026f9:	83 ec 10             	sub    $0x10,%esp
+  8026fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026ff:	53                   	push   %ebx
+  802700:	e8 f9 e1 ff ff       	call   8008fe <strlen>
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80270d:	7f 25                	jg     802734 <remove+0x3f>
+  80270f:	83 ec 08             	sub    $0x8,%esp
+  802712:	53                   	push   %ebx
+  802713:	68 00 60 80 00       	push   $0x806000
+  802718:	e8 2d e2 ff ff       	call   80094a <strcpy>
+  80271d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802722:	b8 09 00 00 00       	mov    $0x9,%eax
+  802727:	e8 af f9 ff ff       	call   8020db <fsipc>
+  80272c:	83 c4 10             	add    $0x10,%esp
+  80272f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802732:	c9                   	leave
+  802733:	c3                   	ret
+  802734:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802739:	eb f4                	jmp    80272f <remove+0x3a>
+
+0080273b <sync>:
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	83 ec 08             	sub    $0x8,%esp
+  802741:	ba 00 00 00 00       	mov    $0x0,%edx
+  802746:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80274b:	e8 8b f9 ff ff       	call   8020db <fsipc>
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+
+00802752 <devsock_stat>:
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	83 ec 10             	sub    $0x10,%esp
+  802758:	68 30 3d 80 00       	push   $0x803d30
+  80275d:	ff 75 0c             	push   0xc(%ebp)
+  802760:	e8 e5 e1 ff ff       	call   80094a <strcpy>
+  802765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276a:	c9                   	leave
+  80276b:	c3                   	ret
+
+0080276c <devsock_close>:
+  80276c:	55                   	push   %ebp
+  80276d:	89 e5                	mov    %esp,%ebp
+  80276f:	53                   	push   %ebx
+  802770:	83 ec 10             	sub    $0x10,%esp
+  802773:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802776:	53                   	push   %ebx
+  802777:	e8 3c 0e 00 00       	call   8035b8 <pageref>
+  80277c:	89 c2                	mov    %eax,%edx
+  80277e:	83 c4 10             	add    $0x10,%esp
+  802781:	b8 00 00 00 00       	mov    $0x0,%eax
+  802786:	83 fa 01             	cmp    $0x1,%edx
+  802789:	74 05                	je     802790 <devsock_close+0x24>
+  80278b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80278e:	c9                   	leave
+  80278f:	c3                   	ret
+  802790:	83 ec 0c             	sub    $0xc,%esp
+  802793:	ff 73 0c             	push   0xc(%ebx)
+  802796:	e8 aa 02 00 00       	call   802a45 <nsipc_close>
+  80279b:	83 c4 10             	add    $0x10,%esp
+  80279e:	eb eb                	jmp    80278b <devsock_close+0x1f>
+
+008027a0 <devsock_write>:
+  8027a0:	55                   	push   %ebp
+  8027a1:	89 e5                	mov    %esp,%ebp
+  8027a3:	83 ec 08             	sub    $0x8,%esp
+  8027a6:	6a 00                	push   $0x0
+  8027a8:	ff 75 10             	push   0x10(%ebp)
+  8027ab:	ff 75 0c             	push   0xc(%ebp)
+  8027ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b1:	ff 70 0c             	push   0xc(%eax)
+  8027b4:	e8 6c 03 00 00       	call   802b25 <nsipc_send>
+  8027b9:	c9                   	leave
+  8027ba:	c3                   	ret
+
+008027bb <devsock_read>:
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	83 ec 08             	sub    $0x8,%esp
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	ff 75 10             	push   0x10(%ebp)
+  8027c6:	ff 75 0c             	push   0xc(%ebp)
+  8027c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027cc:	ff 70 0c             	push   0xc(%eax)
+  8027cf:	e8 e2 02 00 00       	call   802ab6 <nsipc_recv>
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+
+008027d6 <fd2sockid>:
+  8027d6:	55                   	push   %ebp
+  8027d7:	89 e5                	mov    %esp,%ebp
+  8027d9:	83 ec 20             	sub    $0x20,%esp
+  8027dc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027df:	52                   	push   %edx
+  8027e0:	50                   	push   %eax
+  8027e1:	e8 da f3 ff ff       	call   801bc0 <fd_lookup>
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	78 10                	js     8027fd <fd2sockid+0x27>
+  8027ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027f0:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8027f6:	39 08                	cmp    %ecx,(%eax)
+  8027f8:	75 05                	jne    8027ff <fd2sockid+0x29>
+  8027fa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027fd:	c9                   	leave
+  8027fe:	c3                   	ret
+  8027ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802804:	eb f7                	jmp    8027fd <fd2sockid+0x27>
+
+00802806 <alloc_sockfd>:
+  802806:	55                   	push   %ebp
+  802807:	89 e5                	mov    %esp,%ebp
+  802809:	56                   	push   %esi
+  80280a:	53                   	push   %ebx
+  80280b:	83 ec 1c             	sub    $0x1c,%esp
+  80280e:	89 c6                	mov    %eax,%esi
+  802810:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802813:	50                   	push   %eax
+  802814:	e8 57 f3 ff ff       	call   801b70 <fd_alloc>
+  802819:	89 c3                	mov    %eax,%ebx
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	78 43                	js     802865 <alloc_sockfd+0x5f>
+  802822:	83 ec 04             	sub    $0x4,%esp
+  802825:	68 07 04 00 00       	push   $0x407
+  80282a:	ff 75 f4             	push   -0xc(%ebp)
+  80282d:	6a 00                	push   $0x0
+  80282f:	e8 76 e5 ff ff       	call   800daa <sys_page_alloc>
+  802834:	89 c3                	mov    %eax,%ebx
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	85 c0                	test   %eax,%eax
+  80283b:	78 28                	js     802865 <alloc_sockfd+0x5f>
+  80283d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802840:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802846:	89 10                	mov    %edx,(%eax)
+  802848:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80284b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802852:	89 70 0c             	mov    %esi,0xc(%eax)
+  802855:	83 ec 0c             	sub    $0xc,%esp
+  802858:	50                   	push   %eax
+  802859:	e8 eb f2 ff ff       	call   801b49 <fd2num>
+  80285e:	89 c3                	mov    %eax,%ebx
+  802860:	83 c4 10             	add    $0x10,%esp
+  802863:	eb 0c                	jmp    802871 <alloc_sockfd+0x6b>
+  802865:	83 ec 0c             	sub    $0xc,%esp
+  802868:	56                   	push   %esi
+  802869:	e8 d7 01 00 00       	call   802a45 <nsipc_close>
+  80286e:	83 c4 10             	add    $0x10,%esp
+  802871:	89 d8                	mov    %ebx,%eax
+  802873:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802876:	5b                   	pop    %ebx
+  802877:	5e                   	pop    %esi
+  802878:	5d                   	pop    %ebp
+  802879:	c3                   	ret
+
+0080287a <accept>:
+  80287a:	55                   	push   %ebp
+  80287b:	89 e5                	mov    %esp,%ebp
+  80287d:	83 ec 08             	sub    $0x8,%esp
+  802880:	8b 45 08             	mov    0x8(%ebp),%eax
+  802883:	e8 4e ff ff ff       	call   8027d6 <fd2sockid>
+  802888:	85 c0                	test   %eax,%eax
+  80288a:	78 1b                	js     8028a7 <accept+0x2d>
+  80288c:	83 ec 04             	sub    $0x4,%esp
+  80288f:	ff 75 10             	push   0x10(%ebp)
+  802892:	ff 75 0c             	push   0xc(%ebp)
+  802895:	50                   	push   %eax
+  802896:	e8 07 01 00 00       	call   8029a2 <nsipc_accept>
+  80289b:	83 c4 10             	add    $0x10,%esp
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	78 05                	js     8028a7 <accept+0x2d>
+  8028a2:	e8 5f ff ff ff       	call   802806 <alloc_sockfd>
+  8028a7:	c9                   	leave
+  8028a8:	c3                   	ret
+
+008028a9 <bind>:
+  8028a9:	55                   	push   %ebp
+  8028aa:	89 e5                	mov    %esp,%ebp
+  8028ac:	83 ec 08             	sub    $0x8,%esp
+  8028af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b2:	e8 1f ff ff ff       	call   8027d6 <fd2sockid>
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	78 12                	js     8028cd <bind+0x24>
+  8028bb:	83 ec 04             	sub    $0x4,%esp
+  8028be:	ff 75 10             	push   0x10(%ebp)
+  8028c1:	ff 75 0c             	push   0xc(%ebp)
+  8028c4:	50                   	push   %eax
+  8028c5:	e8 24 01 00 00       	call   8029ee <nsipc_bind>
+  8028ca:	83 c4 10             	add    $0x10,%esp
+  8028cd:	c9                   	leave
+  8028ce:	c3                   	ret
+
+008028cf <shutdown>:
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	83 ec 08             	sub    $0x8,%esp
+  8028d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d8:	e8 f9 fe ff ff       	call   8027d6 <fd2sockid>
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	78 0f                	js     8028f0 <shutdown+0x21>
+  8028e1:	83 ec 08             	sub    $0x8,%esp
+  8028e4:	ff 75 0c             	push   0xc(%ebp)
+  8028e7:	50                   	push   %eax
+  8028e8:	e8 36 01 00 00       	call   802a23 <nsipc_shutdown>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+  8028f0:	c9                   	leave
+  8028f1:	c3                   	ret
+
+008028f2 <connect>:
+  8028f2:	55                   	push   %ebp
+  8028f3:	89 e5                	mov    %esp,%ebp
+  8028f5:	83 ec 08             	sub    $0x8,%esp
+  8028f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fb:	e8 d6 fe ff ff       	call   8027d6 <fd2sockid>
+  802900:	85 c0                	test   %eax,%eax
+  802902:	78 12                	js     802916 <connect+0x24>
+  802904:	83 ec 04             	sub    $0x4,%esp
+  802907:	ff 75 10             	push   0x10(%ebp)
+  80290a:	ff 75 0c             	push   0xc(%ebp)
+  80290d:	50                   	push   %eax
+  80290e:	e8 4c 01 00 00       	call   802a5f <nsipc_connect>
+  802913:	83 c4 10             	add    $0x10,%esp
+  802916:	c9                   	leave
+  802917:	c3                   	ret
+
+00802918 <listen>:
+  802918:	55                   	push   %ebp
+  802919:	89 e5                	mov    %esp,%ebp
+  80291b:	83 ec 08             	sub    $0x8,%esp
+  80291e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802921:	e8 b0 fe ff ff       	call   8027d6 <fd2sockid>
+  802926:	85 c0                	test   %eax,%eax
+  802928:	78 0f                	js     802939 <listen+0x21>
+  80292a:	83 ec 08             	sub    $0x8,%esp
+  80292d:	ff 75 0c             	push   0xc(%ebp)
+  802930:	50                   	push   %eax
+  802931:	e8 5e 01 00 00       	call   802a94 <nsipc_listen>
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	c9                   	leave
+  80293a:	c3                   	ret
+
+0080293b <socket>:
+  80293b:	55                   	push   %ebp
+  80293c:	89 e5                	mov    %esp,%ebp
+  80293e:	83 ec 0c             	sub    $0xc,%esp
+  802941:	ff 75 10             	push   0x10(%ebp)
+  802944:	ff 75 0c             	push   0xc(%ebp)
+  802947:	ff 75 08             	push   0x8(%ebp)
+  80294a:	e8 34 02 00 00       	call   802b83 <nsipc_socket>
+  80294f:	83 c4 10             	add    $0x10,%esp
+  802952:	85 c0                	test   %eax,%eax
+  802954:	78 05                	js     80295b <socket+0x20>
+  802956:	e8 ab fe ff ff       	call   802806 <alloc_sockfd>
+  80295b:	c9                   	leave
+  80295c:	c3                   	ret
+
+0080295d <nsipc>:
+  80295d:	55                   	push   %ebp
+  80295e:	89 e5                	mov    %esp,%ebp
+  802960:	53                   	push   %ebx
+  802961:	83 ec 04             	sub    $0x4,%esp
+  802964:	89 c3                	mov    %eax,%ebx
+  802966:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  80296d:	74 1f                	je     80298e <nsipc+0x31>
+  80296f:	83 ec 08             	sub    $0x8,%esp
+  802972:	6a 00                	push   $0x0
+  802974:	6a 00                	push   $0x0
+  802976:	6a 07                	push   $0x7
+  802978:	68 00 70 80 00       	push   $0x807000
+  80297d:	53                   	push   %ebx
+  80297e:	ff 35 10 50 80 00    	push   0x805010
+  802984:	e8 7a 0a 00 00       	call   803403 <ipc_call>
+  802989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298c:	c9                   	leave
+  80298d:	c3                   	ret
+  80298e:	83 ec 0c             	sub    $0xc,%esp
+  802991:	6a 03                	push   $0x3
+  802993:	e8 06 0c 00 00       	call   80359e <ipc_find_env>
+  802998:	a3 10 50 80 00       	mov    %eax,0x805010
+  80299d:	83 c4 10             	add    $0x10,%esp
+  8029a0:	eb cd                	jmp    80296f <nsipc+0x12>
+
+008029a2 <nsipc_accept>:
+  8029a2:	55                   	push   %ebp
+  8029a3:	89 e5                	mov    %esp,%ebp
+  8029a5:	53                   	push   %ebx
+  8029a6:	83 ec 04             	sub    $0x4,%esp
+  8029a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ac:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029b6:	e8 a2 ff ff ff       	call   80295d <nsipc>
+  8029bb:	89 c3                	mov    %eax,%ebx
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	79 07                	jns    8029c8 <nsipc_accept+0x26>
+  8029c1:	89 d8                	mov    %ebx,%eax
+  8029c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+  8029c8:	83 ec 04             	sub    $0x4,%esp
+  8029cb:	ff 35 10 70 80 00    	push   0x807010
+  8029d1:	68 00 70 80 00       	push   $0x807000
+  8029d6:	ff 75 0c             	push   0xc(%ebp)
+  8029d9:	e8 1c e1 ff ff       	call   800afa <memmove>
+  8029de:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8029e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029e7:	89 10                	mov    %edx,(%eax)
+  8029e9:	83 c4 10             	add    $0x10,%esp
+  8029ec:	eb d3                	jmp    8029c1 <nsipc_accept+0x1f>
+
+008029ee <nsipc_bind>:
+  8029ee:	55                   	push   %ebp
+  8029ef:	89 e5                	mov    %esp,%ebp
+  8029f1:	53                   	push   %ebx
+  8029f2:	83 ec 08             	sub    $0x8,%esp
+  8029f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fb:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a00:	53                   	push   %ebx
+  802a01:	ff 75 0c             	push   0xc(%ebp)
+  802a04:	68 04 70 80 00       	push   $0x807004
+  802a09:	e8 ec e0 ff ff       	call   800afa <memmove>
+  802a0e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802a14:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a19:	e8 3f ff ff ff       	call   80295d <nsipc>
+  802a1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a21:	c9                   	leave
+  802a22:	c3                   	ret
+
+00802a23 <nsipc_shutdown>:
+  802a23:	55                   	push   %ebp
+  802a24:	89 e5                	mov    %esp,%ebp
+  802a26:	83 ec 08             	sub    $0x8,%esp
+  802a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a34:	a3 04 70 80 00       	mov    %eax,0x807004
+  802a39:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a3e:	e8 1a ff ff ff       	call   80295d <nsipc>
+  802a43:	c9                   	leave
+  802a44:	c3                   	ret
+
+00802a45 <nsipc_close>:
+  802a45:	55                   	push   %ebp
+  802a46:	89 e5                	mov    %esp,%ebp
+  802a48:	83 ec 08             	sub    $0x8,%esp
+  802a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a4e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a53:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a58:	e8 00 ff ff ff       	call   80295d <nsipc>
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+00802a5f <nsipc_connect>:
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	53                   	push   %ebx
+  802a63:	83 ec 08             	sub    $0x8,%esp
+  802a66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a71:	53                   	push   %ebx
+  802a72:	ff 75 0c             	push   0xc(%ebp)
+  802a75:	68 04 70 80 00       	push   $0x807004
+  802a7a:	e8 7b e0 ff ff       	call   800afa <memmove>
+  802a7f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802a85:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a8a:	e8 ce fe ff ff       	call   80295d <nsipc>
+  802a8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a92:	c9                   	leave
+  802a93:	c3                   	ret
+
+00802a94 <nsipc_listen>:
+  802a94:	55                   	push   %ebp
+  802a95:	89 e5                	mov    %esp,%ebp
+  802a97:	83 ec 08             	sub    $0x8,%esp
+  802a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802aa2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aa5:	a3 04 70 80 00       	mov    %eax,0x807004
+  802aaa:	b8 06 00 00 00       	mov    $0x6,%eax
+  802aaf:	e8 a9 fe ff ff       	call   80295d <nsipc>
+  802ab4:	c9                   	leave
+  802ab5:	c3                   	ret
+
+00802ab6 <nsipc_recv>:
+  802ab6:	55                   	push   %ebp
+  802ab7:	89 e5                	mov    %esp,%ebp
+  802ab9:	56                   	push   %esi
+  802aba:	53                   	push   %ebx
+  802abb:	8b 75 10             	mov    0x10(%ebp),%esi
+  802abe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac1:	a3 00 70 80 00       	mov    %eax,0x807000
+  802ac6:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802acc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802acf:	a3 08 70 80 00       	mov    %eax,0x807008
+  802ad4:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ad9:	e8 7f fe ff ff       	call   80295d <nsipc>
+  802ade:	89 c3                	mov    %eax,%ebx
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	78 22                	js     802b06 <nsipc_recv+0x50>
+  802ae4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ae9:	39 c6                	cmp    %eax,%esi
+  802aeb:	0f 4e c6             	cmovle %esi,%eax
+  802aee:	39 c3                	cmp    %eax,%ebx
+  802af0:	7f 1d                	jg     802b0f <nsipc_recv+0x59>
+  802af2:	83 ec 04             	sub    $0x4,%esp
+  802af5:	53                   	push   %ebx
+  802af6:	68 00 70 80 00       	push   $0x807000
+  802afb:	ff 75 0c             	push   0xc(%ebp)
+  802afe:	e8 f7 df ff ff       	call   800afa <memmove>
+  802b03:	83 c4 10             	add    $0x10,%esp
+  802b06:	89 d8                	mov    %ebx,%eax
+  802b08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b0b:	5b                   	pop    %ebx
+  802b0c:	5e                   	pop    %esi
+  802b0d:	5d                   	pop    %ebp
+  802b0e:	c3                   	ret
+  802b0f:	68 3c 3d 80 00       	push   $0x803d3c
+  802b14:	68 51 3d 80 00       	push   $0x803d51
+  802b19:	6a 60                	push   $0x60
+  802b1b:	68 66 3d 80 00       	push   $0x803d66
+  802b20:	e8 53 d6 ff ff       	call   800178 <_panic>
+
+00802b25 <nsipc_send>:
+  802b25:	55                   	push   %ebp
+  802b26:	89 e5                	mov    %esp,%ebp
+  802b28:	53                   	push   %ebx
+  802b29:	83 ec 04             	sub    $0x4,%esp
+  802b2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b32:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b37:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b3d:	7f 2e                	jg     802b6d <nsipc_send+0x48>
+  802b3f:	83 ec 04             	sub    $0x4,%esp
+  802b42:	53                   	push   %ebx
+  802b43:	ff 75 0c             	push   0xc(%ebp)
+  802b46:	68 0c 70 80 00       	push   $0x80700c
+  802b4b:	e8 aa df ff ff       	call   800afa <memmove>
+  802b50:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802b56:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b59:	a3 08 70 80 00       	mov    %eax,0x807008
+  802b5e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b63:	e8 f5 fd ff ff       	call   80295d <nsipc>
+  802b68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b6b:	c9                   	leave
+  802b6c:	c3                   	ret
+  802b6d:	68 72 3d 80 00       	push   $0x803d72
+  802b72:	68 51 3d 80 00       	push   $0x803d51
+  802b77:	6a 6b                	push   $0x6b
+  802b79:	68 66 3d 80 00       	push   $0x803d66
+  802b7e:	e8 f5 d5 ff ff       	call   800178 <_panic>
+
+00802b83 <nsipc_socket>:
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	83 ec 08             	sub    $0x8,%esp
+  802b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802b91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b94:	a3 04 70 80 00       	mov    %eax,0x807004
+  802b99:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b9c:	a3 08 70 80 00       	mov    %eax,0x807008
+  802ba1:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ba6:	e8 b2 fd ff ff       	call   80295d <nsipc>
+  802bab:	c9                   	leave
+  802bac:	c3                   	ret
+
+00802bad <devpipe_stat>:
+  802bad:	55                   	push   %ebp
+  802bae:	89 e5                	mov    %esp,%ebp
+  802bb0:	56                   	push   %esi
+  802bb1:	53                   	push   %ebx
+  802bb2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802bb5:	83 ec 0c             	sub    $0xc,%esp
+  802bb8:	ff 75 08             	push   0x8(%ebp)
+  802bbb:	e8 99 ef ff ff       	call   801b59 <fd2data>
+  802bc0:	89 c6                	mov    %eax,%esi
+  802bc2:	83 c4 08             	add    $0x8,%esp
+  802bc5:	68 7e 3d 80 00       	push   $0x803d7e
+  802bca:	53                   	push   %ebx
+  802bcb:	e8 7a dd ff ff       	call   80094a <strcpy>
+  802bd0:	8b 46 04             	mov    0x4(%esi),%eax
+  802bd3:	2b 06                	sub    (%esi),%eax
+  802bd5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802bdb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802be2:	00 00 00 
+  802be5:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802bec:	40 80 00 
+  802bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bf7:	5b                   	pop    %ebx
+  802bf8:	5e                   	pop    %esi
+  802bf9:	5d                   	pop    %ebp
+  802bfa:	c3                   	ret
+
+00802bfb <devpipe_close>:
+  802bfb:	55                   	push   %ebp
+  802bfc:	89 e5                	mov    %esp,%ebp
+  802bfe:	53                   	push   %ebx
+  802bff:	83 ec 0c             	sub    $0xc,%esp
+  802c02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c05:	53                   	push   %ebx
+  802c06:	6a 00                	push   $0x0
+  802c08:	e8 6f e2 ff ff       	call   800e7c <sys_page_unmap>
+  802c0d:	89 1c 24             	mov    %ebx,(%esp)
+  802c10:	e8 44 ef ff ff       	call   801b59 <fd2data>
+  802c15:	83 c4 08             	add    $0x8,%esp
+  802c18:	50                   	push   %eax
+  802c19:	6a 00                	push   $0x0
+  802c1b:	e8 5c e2 ff ff       	call   800e7c <sys_page_unmap>
+  802c20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+00802c25 <_pipeisclosed>:
+  802c25:	55                   	push   %ebp
+  802c26:	89 e5                	mov    %esp,%ebp
+  802c28:	57                   	push   %edi
+  802c29:	56                   	push   %esi
+  802c2a:	53                   	push   %ebx
+  802c2b:	83 ec 1c             	sub    $0x1c,%esp
+  802c2e:	89 c7                	mov    %eax,%edi
+  802c30:	89 d6                	mov    %edx,%esi
+  802c32:	a1 18 50 80 00       	mov    0x805018,%eax
+  802c37:	8b 58 58             	mov    0x58(%eax),%ebx
+  802c3a:	83 ec 0c             	sub    $0xc,%esp
+  802c3d:	57                   	push   %edi
+  802c3e:	e8 75 09 00 00       	call   8035b8 <pageref>
+  802c43:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c46:	89 34 24             	mov    %esi,(%esp)
+  802c49:	e8 6a 09 00 00       	call   8035b8 <pageref>
+  802c4e:	8b 15 18 50 80 00    	mov    0x805018,%edx
+  802c54:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802c57:	83 c4 10             	add    $0x10,%esp
+  802c5a:	39 cb                	cmp    %ecx,%ebx
+  802c5c:	74 1b                	je     802c79 <_pipeisclosed+0x54>
+  802c5e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c61:	75 cf                	jne    802c32 <_pipeisclosed+0xd>
+  802c63:	8b 42 58             	mov    0x58(%edx),%eax
+  802c66:	6a 01                	push   $0x1
+  802c68:	50                   	push   %eax
+  802c69:	53                   	push   %ebx
+  802c6a:	68 85 3d 80 00       	push   $0x803d85
+  802c6f:	e8 df d5 ff ff       	call   800253 <cprintf>
+  802c74:	83 c4 10             	add    $0x10,%esp
+  802c77:	eb b9                	jmp    802c32 <_pipeisclosed+0xd>
+  802c79:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c7c:	0f 94 c0             	sete   %al
+  802c7f:	0f b6 c0             	movzbl %al,%eax
+  802c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c85:	5b                   	pop    %ebx
+  802c86:	5e                   	pop    %esi
+  802c87:	5f                   	pop    %edi
+  802c88:	5d                   	pop    %ebp
+  802c89:	c3                   	ret
+
+00802c8a <devpipe_write>:
+  802c8a:	55                   	push   %ebp
+  802c8b:	89 e5                	mov    %esp,%ebp
+  802c8d:	57                   	push   %edi
+  802c8e:	56                   	push   %esi
+  802c8f:	53                   	push   %ebx
+  802c90:	83 ec 28             	sub    $0x28,%esp
+  802c93:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c96:	56                   	push   %esi
+  802c97:	e8 bd ee ff ff       	call   801b59 <fd2data>
+  802c9c:	89 c3                	mov    %eax,%ebx
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  802ca1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802caa:	74 5c                	je     802d08 <devpipe_write+0x7e>
+  802cac:	8b 43 04             	mov    0x4(%ebx),%eax
+  802caf:	8b 0b                	mov    (%ebx),%ecx
+  802cb1:	8d 51 20             	lea    0x20(%ecx),%edx
+  802cb4:	39 d0                	cmp    %edx,%eax
+  802cb6:	72 1e                	jb     802cd6 <devpipe_write+0x4c>
+  802cb8:	89 da                	mov    %ebx,%edx
+  802cba:	89 f0                	mov    %esi,%eax
+  802cbc:	e8 64 ff ff ff       	call   802c25 <_pipeisclosed>
+  802cc1:	85 c0                	test   %eax,%eax
+  802cc3:	75 48                	jne    802d0d <devpipe_write+0x83>
+  802cc5:	e8 95 e0 ff ff       	call   800d5f <sys_yield>
+  802cca:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ccd:	8b 0b                	mov    (%ebx),%ecx
+  802ccf:	8d 51 20             	lea    0x20(%ecx),%edx
+  802cd2:	39 d0                	cmp    %edx,%eax
+  802cd4:	73 e2                	jae    802cb8 <devpipe_write+0x2e>
+  802cd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cd9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802cdd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ce0:	89 c2                	mov    %eax,%edx
+  802ce2:	c1 fa 1f             	sar    $0x1f,%edx
+  802ce5:	89 d1                	mov    %edx,%ecx
+  802ce7:	c1 e9 1b             	shr    $0x1b,%ecx
+  802cea:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ced:	83 e2 1f             	and    $0x1f,%edx
+  802cf0:	29 ca                	sub    %ecx,%edx
+  802cf2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802cf6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802cfa:	83 c0 01             	add    $0x1,%eax
+  802cfd:	89 43 04             	mov    %eax,0x4(%ebx)
+  802d00:	83 c7 01             	add    $0x1,%edi
+  802d03:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802d06:	75 a4                	jne    802cac <devpipe_write+0x22>
+  802d08:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d0b:	eb 05                	jmp    802d12 <devpipe_write+0x88>
+  802d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d15:	5b                   	pop    %ebx
+  802d16:	5e                   	pop    %esi
+  802d17:	5f                   	pop    %edi
+  802d18:	5d                   	pop    %ebp
+  802d19:	c3                   	ret
+
+00802d1a <devpipe_read>:
+  802d1a:	55                   	push   %ebp
+  802d1b:	89 e5                	mov    %esp,%ebp
+  802d1d:	57                   	push   %edi
+  802d1e:	56                   	push   %esi
+  802d1f:	53                   	push   %ebx
+  802d20:	83 ec 18             	sub    $0x18,%esp
+  802d23:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d26:	56                   	push   %esi
+  802d27:	e8 2d ee ff ff       	call   801b59 <fd2data>
+  802d2c:	89 c3                	mov    %eax,%ebx
+  802d2e:	83 c4 10             	add    $0x10,%esp
+  802d31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d36:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d3a:	74 45                	je     802d81 <devpipe_read+0x67>
+  802d3c:	8b 03                	mov    (%ebx),%eax
+  802d3e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d41:	75 1d                	jne    802d60 <devpipe_read+0x46>
+  802d43:	85 ff                	test   %edi,%edi
+  802d45:	75 3f                	jne    802d86 <devpipe_read+0x6c>
+  802d47:	89 da                	mov    %ebx,%edx
+  802d49:	89 f0                	mov    %esi,%eax
+  802d4b:	e8 d5 fe ff ff       	call   802c25 <_pipeisclosed>
+  802d50:	85 c0                	test   %eax,%eax
+  802d52:	75 3c                	jne    802d90 <devpipe_read+0x76>
+  802d54:	e8 06 e0 ff ff       	call   800d5f <sys_yield>
+  802d59:	8b 03                	mov    (%ebx),%eax
+  802d5b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d5e:	74 e7                	je     802d47 <devpipe_read+0x2d>
+  802d60:	99                   	cltd
+  802d61:	c1 ea 1b             	shr    $0x1b,%edx
+  802d64:	01 d0                	add    %edx,%eax
+  802d66:	83 e0 1f             	and    $0x1f,%eax
+  802d69:	29 d0                	sub    %edx,%eax
+  802d6b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802d70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d73:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802d76:	83 03 01             	addl   $0x1,(%ebx)
+  802d79:	83 c7 01             	add    $0x1,%edi
+  802d7c:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802d7f:	75 bb                	jne    802d3c <devpipe_read+0x22>
+  802d81:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d84:	eb 02                	jmp    802d88 <devpipe_read+0x6e>
+  802d86:	89 f8                	mov    %edi,%eax
+  802d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d8b:	5b                   	pop    %ebx
+  802d8c:	5e                   	pop    %esi
+  802d8d:	5f                   	pop    %edi
+  802d8e:	5d                   	pop    %ebp
+  802d8f:	c3                   	ret
+  802d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d95:	eb f1                	jmp    802d88 <devpipe_read+0x6e>
+
+00802d97 <pipe>:
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	56                   	push   %esi
+  802d9b:	53                   	push   %ebx
+  802d9c:	83 ec 1c             	sub    $0x1c,%esp
+  802d9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802da2:	50                   	push   %eax
+  802da3:	e8 c8 ed ff ff       	call   801b70 <fd_alloc>
+  802da8:	89 c3                	mov    %eax,%ebx
+  802daa:	83 c4 10             	add    $0x10,%esp
+  802dad:	85 c0                	test   %eax,%eax
+  802daf:	0f 88 23 01 00 00    	js     802ed8 <pipe+0x141>
+  802db5:	83 ec 04             	sub    $0x4,%esp
+  802db8:	68 07 04 00 00       	push   $0x407
+  802dbd:	ff 75 f4             	push   -0xc(%ebp)
+  802dc0:	6a 00                	push   $0x0
+  802dc2:	e8 e3 df ff ff       	call   800daa <sys_page_alloc>
+  802dc7:	89 c3                	mov    %eax,%ebx
+  802dc9:	83 c4 10             	add    $0x10,%esp
+  802dcc:	85 c0                	test   %eax,%eax
+  802dce:	0f 88 04 01 00 00    	js     802ed8 <pipe+0x141>
+  802dd4:	83 ec 0c             	sub    $0xc,%esp
+  802dd7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802dda:	50                   	push   %eax
+  802ddb:	e8 90 ed ff ff       	call   801b70 <fd_alloc>
+  802de0:	89 c3                	mov    %eax,%ebx
+  802de2:	83 c4 10             	add    $0x10,%esp
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	0f 88 db 00 00 00    	js     802ec8 <pipe+0x131>
+  802ded:	83 ec 04             	sub    $0x4,%esp
+  802df0:	68 07 04 00 00       	push   $0x407
+  802df5:	ff 75 f0             	push   -0x10(%ebp)
+  802df8:	6a 00                	push   $0x0
+  802dfa:	e8 ab df ff ff       	call   800daa <sys_page_alloc>
+  802dff:	89 c3                	mov    %eax,%ebx
+  802e01:	83 c4 10             	add    $0x10,%esp
+  802e04:	85 c0                	test   %eax,%eax
+  802e06:	0f 88 bc 00 00 00    	js     802ec8 <pipe+0x131>
+  802e0c:	83 ec 0c             	sub    $0xc,%esp
+  802e0f:	ff 75 f4             	push   -0xc(%ebp)
+  802e12:	e8 42 ed ff ff       	call   801b59 <fd2data>
+  802e17:	89 c6                	mov    %eax,%esi
+  802e19:	83 c4 0c             	add    $0xc,%esp
+  802e1c:	68 07 04 00 00       	push   $0x407
+  802e21:	50                   	push   %eax
+  802e22:	6a 00                	push   $0x0
+  802e24:	e8 81 df ff ff       	call   800daa <sys_page_alloc>
+  802e29:	89 c3                	mov    %eax,%ebx
+  802e2b:	83 c4 10             	add    $0x10,%esp
+  802e2e:	85 c0                	test   %eax,%eax
+  802e30:	0f 88 82 00 00 00    	js     802eb8 <pipe+0x121>
+  802e36:	83 ec 0c             	sub    $0xc,%esp
+  802e39:	ff 75 f0             	push   -0x10(%ebp)
+  802e3c:	e8 18 ed ff ff       	call   801b59 <fd2data>
+  802e41:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e48:	50                   	push   %eax
+  802e49:	6a 00                	push   $0x0
+  802e4b:	56                   	push   %esi
+  802e4c:	6a 00                	push   $0x0
+  802e4e:	e8 9a df ff ff       	call   800ded <sys_page_map>
+  802e53:	89 c3                	mov    %eax,%ebx
+  802e55:	83 c4 20             	add    $0x20,%esp
+  802e58:	85 c0                	test   %eax,%eax
+  802e5a:	78 4e                	js     802eaa <pipe+0x113>
+  802e5c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802e61:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e64:	89 02                	mov    %eax,(%edx)
+  802e66:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e69:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802e70:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802e73:	89 02                	mov    %eax,(%edx)
+  802e75:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802e78:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802e7f:	83 ec 0c             	sub    $0xc,%esp
+  802e82:	ff 75 f4             	push   -0xc(%ebp)
+  802e85:	e8 bf ec ff ff       	call   801b49 <fd2num>
+  802e8a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e8d:	89 01                	mov    %eax,(%ecx)
+  802e8f:	83 c4 04             	add    $0x4,%esp
+  802e92:	ff 75 f0             	push   -0x10(%ebp)
+  802e95:	e8 af ec ff ff       	call   801b49 <fd2num>
+  802e9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e9d:	89 41 04             	mov    %eax,0x4(%ecx)
+  802ea0:	83 c4 10             	add    $0x10,%esp
+  802ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ea8:	eb 2e                	jmp    802ed8 <pipe+0x141>
+  802eaa:	83 ec 08             	sub    $0x8,%esp
+  802ead:	56                   	push   %esi
+  802eae:	6a 00                	push   $0x0
+  802eb0:	e8 c7 df ff ff       	call   800e7c <sys_page_unmap>
+  802eb5:	83 c4 10             	add    $0x10,%esp
+  802eb8:	83 ec 08             	sub    $0x8,%esp
+  802ebb:	ff 75 f0             	push   -0x10(%ebp)
+  802ebe:	6a 00                	push   $0x0
+  802ec0:	e8 b7 df ff ff       	call   800e7c <sys_page_unmap>
+  802ec5:	83 c4 10             	add    $0x10,%esp
+  802ec8:	83 ec 08             	sub    $0x8,%esp
+  802ecb:	ff 75 f4             	push   -0xc(%ebp)
+  802ece:	6a 00                	push   $0x0
+  802ed0:	e8 a7 df ff ff       	call   800e7c <sys_page_unmap>
+  802ed5:	83 c4 10             	add    $0x10,%esp
+  802ed8:	89 d8                	mov    %ebx,%eax
+  802eda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802edd:	5b                   	pop    %ebx
+  802ede:	5e                   	pop    %esi
+  802edf:	5d                   	pop    %ebp
+  802ee0:	c3                   	ret
+
+00802ee1 <pipeisclosed>:
+  802ee1:	55                   	push   %ebp
+  802ee2:	89 e5                	mov    %esp,%ebp
+  802ee4:	83 ec 20             	sub    $0x20,%esp
+  802ee7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eea:	50                   	push   %eax
+  802eeb:	ff 75 08             	push   0x8(%ebp)
+  802eee:	e8 cd ec ff ff       	call   801bc0 <fd_lookup>
+  802ef3:	83 c4 10             	add    $0x10,%esp
+  802ef6:	85 c0                	test   %eax,%eax
+  802ef8:	78 18                	js     802f12 <pipeisclosed+0x31>
+  802efa:	83 ec 0c             	sub    $0xc,%esp
+  802efd:	ff 75 f4             	push   -0xc(%ebp)
+  802f00:	e8 54 ec ff ff       	call   801b59 <fd2data>
+  802f05:	89 c2                	mov    %eax,%edx
+  802f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f0a:	e8 16 fd ff ff       	call   802c25 <_pipeisclosed>
+  802f0f:	83 c4 10             	add    $0x10,%esp
+  802f12:	c9                   	leave
+  802f13:	c3                   	ret
+
+00802f14 <ipcring_init>:
+  802f14:	55                   	push   %ebp
+  802f15:	89 e5                	mov    %esp,%ebp
+  802f17:	53                   	push   %ebx
+  802f18:	83 ec 08             	sub    $0x8,%esp
+  802f1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f1e:	6a 60                	push   $0x60
+  802f20:	6a 00                	push   $0x0
+  802f22:	53                   	push   %ebx
+  802f23:	e8 9d db ff ff       	call   800ac5 <memset>
+  802f28:	a1 18 50 80 00       	mov    0x805018,%eax
+  802f2d:	8b 40 48             	mov    0x48(%eax),%eax
+  802f30:	89 03                	mov    %eax,(%ebx)
+  802f32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f35:	89 43 04             	mov    %eax,0x4(%ebx)
+  802f38:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f3b:	89 43 08             	mov    %eax,0x8(%ebx)
+  802f3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f41:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802f44:	83 c4 10             	add    $0x10,%esp
+  802f47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f4a:	c9                   	leave
+  802f4b:	c3                   	ret
+
+00802f4c <ipcring_req_slot>:
+  802f4c:	55                   	push   %ebp
+  802f4d:	89 e5                	mov    %esp,%ebp
+  802f4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f52:	8b 50 10             	mov    0x10(%eax),%edx
+  802f55:	8b 48 18             	mov    0x18(%eax),%ecx
+  802f58:	29 ca                	sub    %ecx,%edx
+  802f5a:	83 fa 07             	cmp    $0x7,%edx
+  802f5d:	77 0c                	ja     802f6b <ipcring_req_slot+0x1f>
+  802f5f:	8b 50 10             	mov    0x10(%eax),%edx
+  802f62:	83 e2 07             	and    $0x7,%edx
+  802f65:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802f69:	5d                   	pop    %ebp
+  802f6a:	c3                   	ret
+  802f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f70:	eb f7                	jmp    802f69 <ipcring_req_slot+0x1d>
+
+00802f72 <ipcring_req_push>:
+  802f72:	55                   	push   %ebp
+  802f73:	89 e5                	mov    %esp,%ebp
+  802f75:	83 ec 08             	sub    $0x8,%esp
+  802f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f7b:	8b 42 10             	mov    0x10(%edx),%eax
+  802f7e:	83 c0 01             	add    $0x1,%eax
+  802f81:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8a:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802f8e:	85 c0                	test   %eax,%eax
+  802f90:	75 02                	jne    802f94 <ipcring_req_push+0x22>
+  802f92:	c9                   	leave
+  802f93:	c3                   	ret
+  802f94:	6a 00                	push   $0x0
+  802f96:	68 00 00 80 ee       	push   $0xee800000
+  802f9b:	ff 72 08             	push   0x8(%edx)
+  802f9e:	ff 72 04             	push   0x4(%edx)
+  802fa1:	e8 3c e1 ff ff       	call   8010e2 <sys_ipc_send>
+  802fa6:	83 c4 10             	add    $0x10,%esp
+  802fa9:	eb e7                	jmp    802f92 <ipcring_req_push+0x20>
+
+00802fab <ipcring_rsp_wait>:
+  802fab:	55                   	push   %ebp
+  802fac:	89 e5                	mov    %esp,%ebp
+  802fae:	53                   	push   %ebx
+  802faf:	83 ec 04             	sub    $0x4,%esp
+  802fb2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fb5:	8b 53 18             	mov    0x18(%ebx),%edx
+  802fb8:	8b 43 10             	mov    0x10(%ebx),%eax
+  802fbb:	39 c2                	cmp    %eax,%edx
+  802fbd:	74 3c                	je     802ffb <ipcring_rsp_wait+0x50>
+  802fbf:	8b 53 14             	mov    0x14(%ebx),%edx
+  802fc2:	8b 43 18             	mov    0x18(%ebx),%eax
+  802fc5:	39 c2                	cmp    %eax,%edx
+  802fc7:	75 23                	jne    802fec <ipcring_rsp_wait+0x41>
+  802fc9:	83 ec 08             	sub    $0x8,%esp
+  802fcc:	6a 00                	push   $0x0
+  802fce:	6a 00                	push   $0x0
+  802fd0:	6a 00                	push   $0x0
+  802fd2:	6a 00                	push   $0x0
+  802fd4:	ff 73 0c             	push   0xc(%ebx)
+  802fd7:	ff 73 04             	push   0x4(%ebx)
+  802fda:	e8 24 04 00 00       	call   803403 <ipc_call>
+  802fdf:	8b 53 14             	mov    0x14(%ebx),%edx
+  802fe2:	8b 43 18             	mov    0x18(%ebx),%eax
+  802fe5:	83 c4 20             	add    $0x20,%esp
+  802fe8:	39 c2                	cmp    %eax,%edx
+  802fea:	74 dd                	je     802fc9 <ipcring_rsp_wait+0x1e>
+  802fec:	8b 43 18             	mov    0x18(%ebx),%eax
+  802fef:	83 e0 07             	and    $0x7,%eax
+  802ff2:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802ff6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+  802ffb:	68 a0 3d 80 00       	push   $0x803da0
+  803000:	68 51 3d 80 00       	push   $0x803d51
+  803005:	6a 3b                	push   $0x3b
+  803007:	68 c1 3d 80 00       	push   $0x803dc1
+  80300c:	e8 67 d1 ff ff       	call   800178 <_panic>
+
+00803011 <ipcring_rsp_pop>:
+  803011:	55                   	push   %ebp
+  803012:	89 e5                	mov    %esp,%ebp
+  803014:	8b 55 08             	mov    0x8(%ebp),%edx
+  803017:	8b 42 18             	mov    0x18(%edx),%eax
+  80301a:	83 c0 01             	add    $0x1,%eax
+  80301d:	89 42 18             	mov    %eax,0x18(%edx)
+  803020:	5d                   	pop    %ebp
+  803021:	c3                   	ret
+
+00803022 <ipcring_server_init>:
+  803022:	55                   	push   %ebp
+  803023:	89 e5                	mov    %esp,%ebp
+  803025:	8b 45 08             	mov    0x8(%ebp),%eax
+  803028:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80302b:	89 10                	mov    %edx,(%eax)
+  80302d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803030:	89 50 04             	mov    %edx,0x4(%eax)
+  803033:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80303a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803041:	5d                   	pop    %ebp
+  803042:	c3                   	ret
+
+00803043 <ipcring_req_avail>:
+  803043:	55                   	push   %ebp
+  803044:	89 e5                	mov    %esp,%ebp
+  803046:	8b 55 08             	mov    0x8(%ebp),%edx
+  803049:	8b 02                	mov    (%edx),%eax
+  80304b:	8b 40 10             	mov    0x10(%eax),%eax
+  80304e:	2b 42 08             	sub    0x8(%edx),%eax
+  803051:	ba 08 00 00 00       	mov    $0x8,%edx
+  803056:	39 d0                	cmp    %edx,%eax
+  803058:	0f 47 c2             	cmova  %edx,%eax
+  80305b:	5d                   	pop    %ebp
+  80305c:	c3                   	ret
+
+0080305d <ipcring_req_peek>:
+  80305d:	55                   	push   %ebp
+  80305e:	89 e5                	mov    %esp,%ebp
+  803060:	8b 55 08             	mov    0x8(%ebp),%edx
+  803063:	8b 42 08             	mov    0x8(%edx),%eax
+  803066:	83 e0 07             	and    $0x7,%eax
+  803069:	8b 12                	mov    (%edx),%edx
+  80306b:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80306f:	5d                   	pop    %ebp
+  803070:	c3                   	ret
+
+00803071 <ipcring_rsp_push>:
+  803071:	55                   	push   %ebp
+  803072:	89 e5                	mov    %esp,%ebp
+  803074:	83 ec 08             	sub    $0x8,%esp
+  803077:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80307a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80307d:	83 c0 01             	add    $0x1,%eax
+  803080:	89 41 08             	mov    %eax,0x8(%ecx)
+  803083:	8b 11                	mov    (%ecx),%edx
+  803085:	83 c2 14             	add    $0x14,%edx
+  803088:	f0 87 02             	lock xchg %eax,(%edx)
+  80308b:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80308f:	75 02                	jne    803093 <ipcring_rsp_push+0x22>
+  803091:	c9                   	leave
+  803092:	c3                   	ret
+  803093:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80309a:	6a 00                	push   $0x0
+  80309c:	68 00 00 80 ee       	push   $0xee800000
+  8030a1:	6a 00                	push   $0x0
+  8030a3:	ff 71 04             	push   0x4(%ecx)
+  8030a6:	e8 5a df ff ff       	call   801005 <sys_ipc_try_send>
+  8030ab:	83 c4 10             	add    $0x10,%esp
+  8030ae:	eb e1                	jmp    803091 <ipcring_rsp_push+0x20>
+
+008030b0 <ipcring_client_wait>:
+  8030b0:	55                   	push   %ebp
+  8030b1:	89 e5                	mov    %esp,%ebp
+  8030b3:	83 ec 08             	sub    $0x8,%esp
+  8030b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b9:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8030c0:	8b 10                	mov    (%eax),%edx
+  8030c2:	8b 52 18             	mov    0x18(%edx),%edx
+  8030c5:	3b 50 08             	cmp    0x8(%eax),%edx
+  8030c8:	75 02                	jne    8030cc <ipcring_client_wait+0x1c>
+  8030ca:	c9                   	leave
+  8030cb:	c3                   	ret
+  8030cc:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8030d3:	6a 00                	push   $0x0
+  8030d5:	68 00 00 80 ee       	push   $0xee800000
+  8030da:	6a 00                	push   $0x0
+  8030dc:	ff 70 04             	push   0x4(%eax)
+  8030df:	e8 21 df ff ff       	call   801005 <sys_ipc_try_send>
+  8030e4:	83 c4 10             	add    $0x10,%esp
+  8030e7:	eb e1                	jmp    8030ca <ipcring_client_wait+0x1a>
+
+008030e9 <ipcring_server_sleep>:
+  8030e9:	55                   	push   %ebp
+  8030ea:	89 e5                	mov    %esp,%ebp
+  8030ec:	53                   	push   %ebx
+  8030ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030f0:	8b 01                	mov    (%ecx),%eax
+  8030f2:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8030f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030fa:	f0 87 02             	lock xchg %eax,(%edx)
+  8030fd:	8b 11                	mov    (%ecx),%edx
+  8030ff:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803102:	b8 01 00 00 00       	mov    $0x1,%eax
+  803107:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80310a:	74 0e                	je     80311a <ipcring_server_sleep+0x31>
+  80310c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803111:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80311d:	c9                   	leave
+  80311e:	c3                   	ret
+
+0080311f <devcons_close>:
+  80311f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803124:	c3                   	ret
+
+00803125 <devcons_stat>:
+  803125:	55                   	push   %ebp
+  803126:	89 e5                	mov    %esp,%ebp
+  803128:	83 ec 10             	sub    $0x10,%esp
+  80312b:	68 cf 3d 80 00       	push   $0x803dcf
+  803130:	ff 75 0c             	push   0xc(%ebp)
+  803133:	e8 12 d8 ff ff       	call   80094a <strcpy>
+  803138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313d:	c9                   	leave
+  80313e:	c3                   	ret
+
+0080313f <devcons_write>:
+  80313f:	55                   	push   %ebp
+  803140:	89 e5                	mov    %esp,%ebp
+  803142:	57                   	push   %edi
+  803143:	56                   	push   %esi
+  803144:	53                   	push   %ebx
+  803145:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80314b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80314e:	85 ff                	test   %edi,%edi
+  803150:	74 51                	je     8031a3 <devcons_write+0x64>
+  803152:	be 00 00 00 00       	mov    $0x0,%esi
+  803157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315c:	89 fb                	mov    %edi,%ebx
+  80315e:	29 c3                	sub    %eax,%ebx
+  803160:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803165:	39 d3                	cmp    %edx,%ebx
+  803167:	0f 47 da             	cmova  %edx,%ebx
+  80316a:	83 ec 04             	sub    $0x4,%esp
+  80316d:	53                   	push   %ebx
+  80316e:	03 45 0c             	add    0xc(%ebp),%eax
+  803171:	50                   	push   %eax
+  803172:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803178:	50                   	push   %eax
+  803179:	e8 7c d9 ff ff       	call   800afa <memmove>
+  80317e:	83 c4 08             	add    $0x8,%esp
+  803181:	53                   	push   %ebx
+  803182:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803188:	50                   	push   %eax
+  803189:	e8 34 db ff ff       	call   800cc2 <sys_cputs>
+  80318e:	01 de                	add    %ebx,%esi
+  803190:	89 f0                	mov    %esi,%eax
+  803192:	83 c4 10             	add    $0x10,%esp
+  803195:	39 fe                	cmp    %edi,%esi
+  803197:	72 c3                	jb     80315c <devcons_write+0x1d>
+  803199:	89 f0                	mov    %esi,%eax
+  80319b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80319e:	5b                   	pop    %ebx
+  80319f:	5e                   	pop    %esi
+  8031a0:	5f                   	pop    %edi
+  8031a1:	5d                   	pop    %ebp
+  8031a2:	c3                   	ret
+  8031a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8031a8:	eb ef                	jmp    803199 <devcons_write+0x5a>
+
+008031aa <devcons_read>:
+  8031aa:	55                   	push   %ebp
+  8031ab:	89 e5                	mov    %esp,%ebp
+  8031ad:	83 ec 08             	sub    $0x8,%esp
+  8031b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8031b9:	75 07                	jne    8031c2 <devcons_read+0x18>
+  8031bb:	eb 1f                	jmp    8031dc <devcons_read+0x32>
+  8031bd:	e8 9d db ff ff       	call   800d5f <sys_yield>
+  8031c2:	e8 19 db ff ff       	call   800ce0 <sys_cgetc>
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	74 f2                	je     8031bd <devcons_read+0x13>
+  8031cb:	78 0f                	js     8031dc <devcons_read+0x32>
+  8031cd:	83 f8 04             	cmp    $0x4,%eax
+  8031d0:	74 0c                	je     8031de <devcons_read+0x34>
+  8031d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031d5:	88 02                	mov    %al,(%edx)
+  8031d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031dc:	c9                   	leave
+  8031dd:	c3                   	ret
+  8031de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e3:	eb f7                	jmp    8031dc <devcons_read+0x32>
+
+008031e5 <cputchar>:
+  8031e5:	55                   	push   %ebp
+  8031e6:	89 e5                	mov    %esp,%ebp
+  8031e8:	83 ec 20             	sub    $0x20,%esp
+  8031eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ee:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8031f1:	6a 01                	push   $0x1
+  8031f3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031f6:	50                   	push   %eax
+  8031f7:	e8 c6 da ff ff       	call   800cc2 <sys_cputs>
+  8031fc:	83 c4 10             	add    $0x10,%esp
+  8031ff:	c9                   	leave
+  803200:	c3                   	ret
+
+00803201 <getchar>:
+  803201:	55                   	push   %ebp
+  803202:	89 e5                	mov    %esp,%ebp
+  803204:	83 ec 1c             	sub    $0x1c,%esp
+  803207:	6a 01                	push   $0x1
+  803209:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80320c:	50                   	push   %eax
+  80320d:	6a 00                	push   $0x0
+  80320f:	e8 0e ec ff ff       	call   801e22 <read>
+  803214:	83 c4 10             	add    $0x10,%esp
+  803217:	85 c0                	test   %eax,%eax
+  803219:	78 06                	js     803221 <getchar+0x20>
+  80321b:	74 06                	je     803223 <getchar+0x22>
+  80321d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803221:	c9                   	leave
+  803222:	c3                   	ret
+  803223:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803228:	eb f7                	jmp    803221 <getchar+0x20>
+
+0080322a <iscons>:
+  80322a:	55                   	push   %ebp
+  80322b:	89 e5                	mov    %esp,%ebp
+  80322d:	83 ec 20             	sub    $0x20,%esp
+  803230:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803233:	50                   	push   %eax
+  803234:	ff 75 08             	push   0x8(%ebp)
+  803237:	e8 84 e9 ff ff       	call   801bc0 <fd_lookup>
+  80323c:	83 c4 10             	add    $0x10,%esp
+  80323f:	85 c0                	test   %eax,%eax
+  803241:	78 11                	js     803254 <iscons+0x2a>
+  803243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803246:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80324c:	39 10                	cmp    %edx,(%eax)
+  80324e:	0f 94 c0             	sete   %al
+  803251:	0f b6 c0             	movzbl %al,%eax
+  803254:	c9                   	leave
+  803255:	c3                   	ret
+
+00803256 <opencons>:
+  803256:	55                   	push   %ebp
+  803257:	89 e5                	mov    %esp,%ebp
+  803259:	83 ec 24             	sub    $0x24,%esp
+  80325c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80325f:	50                   	push   %eax
+  803260:	e8 0b e9 ff ff       	call   801b70 <fd_alloc>
+  803265:	83 c4 10             	add    $0x10,%esp
+  803268:	85 c0                	test   %eax,%eax
+  80326a:	78 3a                	js     8032a6 <opencons+0x50>
+  80326c:	83 ec 04             	sub    $0x4,%esp
+  80326f:	68 07 04 00 00       	push   $0x407
+  803274:	ff 75 f4             	push   -0xc(%ebp)
+  803277:	6a 00                	push   $0x0
+  803279:	e8 2c db ff ff       	call   800daa <sys_page_alloc>
+  80327e:	83 c4 10             	add    $0x10,%esp
+  803281:	85 c0                	test   %eax,%eax
+  803283:	78 21                	js     8032a6 <opencons+0x50>
+  803285:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803288:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80328e:	89 10                	mov    %edx,(%eax)
+  803290:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803293:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80329a:	83 ec 0c             	sub    $0xc,%esp
+  80329d:	50                   	push   %eax
+  80329e:	e8 a6 e8 ff ff       	call   801b49 <fd2num>
+  8032a3:	83 c4 10             	add    $0x10,%esp
+  8032a6:	c9                   	leave
+  8032a7:	c3                   	ret
+
+008032a8 <set_pgfault_handler>:
+  8032a8:	55                   	push   %ebp
+  8032a9:	89 e5                	mov    %esp,%ebp
+  8032ab:	53                   	push   %ebx
+  8032ac:	83 ec 04             	sub    $0x4,%esp
+  8032af:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8032b6:	74 0d                	je     8032c5 <set_pgfault_handler+0x1d>
+  8032b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032bb:	a3 00 80 80 00       	mov    %eax,0x808000
+  8032c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032c3:	c9                   	leave
+  8032c4:	c3                   	ret
+  8032c5:	e8 76 da ff ff       	call   800d40 <sys_getenvid>
+  8032ca:	89 c3                	mov    %eax,%ebx
+  8032cc:	83 ec 04             	sub    $0x4,%esp
+  8032cf:	6a 07                	push   $0x7
+  8032d1:	68 00 f0 7f ee       	push   $0xee7ff000
+  8032d6:	50                   	push   %eax
+  8032d7:	e8 ce da ff ff       	call   800daa <sys_page_alloc>
+  8032dc:	83 c4 10             	add    $0x10,%esp
+  8032df:	85 c0                	test   %eax,%eax
+  8032e1:	78 29                	js     80330c <set_pgfault_handler+0x64>
+  8032e3:	83 ec 08             	sub    $0x8,%esp
+  8032e6:	68 20 33 80 00       	push   $0x803320
+  8032eb:	53                   	push   %ebx
+  8032ec:	e8 d2 dc ff ff       	call   800fc3 <sys_env_set_pgfault_upcall>
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	85 c0                	test   %eax,%eax
+  8032f6:	79 c0                	jns    8032b8 <set_pgfault_handler+0x10>
+  8032f8:	83 ec 04             	sub    $0x4,%esp
+  8032fb:	68 14 3e 80 00       	push   $0x803e14
+  803300:	6a 27                	push   $0x27
+  803302:	68 46 3e 80 00       	push   $0x803e46
+  803307:	e8 6c ce ff ff       	call   800178 <_panic>
+  80330c:	83 ec 04             	sub    $0x4,%esp
+  80330f:	68 dc 3d 80 00       	push   $0x803ddc
+  803314:	6a 23                	push   $0x23
+  803316:	68 46 3e 80 00       	push   $0x803e46
+  80331b:	e8 58 ce ff ff       	call   800178 <_panic>
+
+00803320 <_pgfault_upcall>:
+  803320:	54                   	push   %esp
+  803321:	a1 00 80 80 00       	mov    0x808000,%eax
+  803326:	ff d0                	call   *%eax
+  803328:	83 c4 04             	add    $0x4,%esp
+  80332b:	89 e3                	mov    %esp,%ebx
+  80332d:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803331:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803335:	89 d4                	mov    %edx,%esp
+  803337:	51                   	push   %ecx
+  803338:	89 dc                	mov    %ebx,%esp
+  80333a:	83 ea 04             	sub    $0x4,%edx
+  80333d:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803341:	83 c4 08             	add    $0x8,%esp
+  803344:	61                   	popa
+  803345:	83 c4 04             	add    $0x4,%esp
+  803348:	9d                   	popf
+  803349:	5c                   	pop    %esp
+  80334a:	c3                   	ret
+
+0080334b <ipc_recv>:
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	56                   	push   %esi
+  80334f:	53                   	push   %ebx
+  803350:	8b 75 08             	mov    0x8(%ebp),%esi
+  803353:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803359:	85 c0                	test   %eax,%eax
+  80335b:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803360:	0f 44 c2             	cmove  %edx,%eax
+  803363:	83 ec 0c             	sub    $0xc,%esp
+  803366:	50                   	push   %eax
+  803367:	e8 e9 dc ff ff       	call   801055 <sys_ipc_recv>
+  80336c:	83 c4 10             	add    $0x10,%esp
+  80336f:	85 c0                	test   %eax,%eax
+  803371:	78 2a                	js     80339d <ipc_recv+0x52>
+  803373:	a1 18 50 80 00       	mov    0x805018,%eax
+  803378:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  80337e:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803384:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80338a:	85 f6                	test   %esi,%esi
+  80338c:	74 02                	je     803390 <ipc_recv+0x45>
+  80338e:	89 0e                	mov    %ecx,(%esi)
+  803390:	85 db                	test   %ebx,%ebx
+  803392:	74 02                	je     803396 <ipc_recv+0x4b>
+  803394:	89 13                	mov    %edx,(%ebx)
+  803396:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803399:	5b                   	pop    %ebx
+  80339a:	5e                   	pop    %esi
+  80339b:	5d                   	pop    %ebp
+  80339c:	c3                   	ret
+  80339d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033a7:	eb e1                	jmp    80338a <ipc_recv+0x3f>
+
+008033a9 <ipc_send>:
+  8033a9:	55                   	push   %ebp
+  8033aa:	89 e5                	mov    %esp,%ebp
+  8033ac:	57                   	push   %edi
+  8033ad:	56                   	push   %esi
+  8033ae:	53                   	push   %ebx
+  8033af:	83 ec 0c             	sub    $0xc,%esp
+  8033b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8033b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033b8:	8b 75 14             	mov    0x14(%ebp),%esi
+  8033bb:	85 db                	test   %ebx,%ebx
+  8033bd:	74 1e                	je     8033dd <ipc_send+0x34>
+  8033bf:	56                   	push   %esi
+  8033c0:	53                   	push   %ebx
+  8033c1:	57                   	push   %edi
+  8033c2:	ff 75 08             	push   0x8(%ebp)
+  8033c5:	e8 18 dd ff ff       	call   8010e2 <sys_ipc_send>
+  8033ca:	83 c4 10             	add    $0x10,%esp
+  8033cd:	85 c0                	test   %eax,%eax
+  8033cf:	74 2a                	je     8033fb <ipc_send+0x52>
+  8033d1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033d4:	75 13                	jne    8033e9 <ipc_send+0x40>
+  8033d6:	e8 84 d9 ff ff       	call   800d5f <sys_yield>
+  8033db:	eb e2                	jmp    8033bf <ipc_send+0x16>
+  8033dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e2:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8033e7:	eb d6                	jmp    8033bf <ipc_send+0x16>
+  8033e9:	50                   	push   %eax
+  8033ea:	68 54 3e 80 00       	push   $0x803e54
+  8033ef:	6a 4f                	push   $0x4f
+  8033f1:	68 97 3e 80 00       	push   $0x803e97
+  8033f6:	e8 7d cd ff ff       	call   800178 <_panic>
+  8033fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033fe:	5b                   	pop    %ebx
+  8033ff:	5e                   	pop    %esi
+  803400:	5f                   	pop    %edi
+  803401:	5d                   	pop    %ebp
+  803402:	c3                   	ret
+
+00803403 <ipc_call>:
+  803403:	55                   	push   %ebp
+  803404:	89 e5                	mov    %esp,%ebp
+  803406:	57                   	push   %edi
+  803407:	56                   	push   %esi
+  803408:	53                   	push   %ebx
+  803409:	83 ec 0c             	sub    $0xc,%esp
+  80340c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803410:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803415:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803419:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80341d:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803422:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803426:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80342a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80342f:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803433:	eb 05                	jmp    80343a <ipc_call+0x37>
+  803435:	e8 25 d9 ff ff       	call   800d5f <sys_yield>
+  80343a:	83 ec 0c             	sub    $0xc,%esp
+  80343d:	56                   	push   %esi
+  80343e:	53                   	push   %ebx
+  80343f:	57                   	push   %edi
+  803440:	ff 75 0c             	push   0xc(%ebp)
+  803443:	ff 75 08             	push   0x8(%ebp)
+  803446:	e8 e7 dc ff ff       	call   801132 <sys_ipc_call>
+  80344b:	83 c4 20             	add    $0x20,%esp
+  80344e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803451:	74 e2                	je     803435 <ipc_call+0x32>
+  803453:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803456:	74 2d                	je     803485 <ipc_call+0x82>
+  803458:	85 c0                	test   %eax,%eax
+  80345a:	78 4f                	js     8034ab <ipc_call+0xa8>
+  80345c:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803460:	74 10                	je     803472 <ipc_call+0x6f>
+  803462:	a1 18 50 80 00       	mov    0x805018,%eax
+  803467:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80346d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803470:	89 02                	mov    %eax,(%edx)
+  803472:	a1 18 50 80 00       	mov    0x805018,%eax
+  803477:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80347d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803480:	5b                   	pop    %ebx
+  803481:	5e                   	pop    %esi
+  803482:	5f                   	pop    %edi
+  803483:	5d                   	pop    %ebp
+  803484:	c3                   	ret
+  803485:	ff 75 14             	push   0x14(%ebp)
+  803488:	ff 75 10             	push   0x10(%ebp)
+  80348b:	ff 75 0c             	push   0xc(%ebp)
+  80348e:	ff 75 08             	push   0x8(%ebp)
+  803491:	e8 13 ff ff ff       	call   8033a9 <ipc_send>
+  803496:	83 c4 0c             	add    $0xc,%esp
+  803499:	ff 75 1c             	push   0x1c(%ebp)
+  80349c:	ff 75 18             	push   0x18(%ebp)
+  80349f:	6a 00                	push   $0x0
+  8034a1:	e8 a5 fe ff ff       	call   80334b <ipc_recv>
+  8034a6:	83 c4 10             	add    $0x10,%esp
+  8034a9:	eb d2                	jmp    80347d <ipc_call+0x7a>
+  8034ab:	50                   	push   %eax
+  8034ac:	68 a1 3e 80 00       	push   $0x803ea1
+  8034b1:	6a 6d                	push   $0x6d
+  8034b3:	68 97 3e 80 00       	push   $0x803e97
+  8034b8:	e8 bb cc ff ff       	call   800178 <_panic>
+
+008034bd <ipc_reply_recv>:
+  8034bd:	55                   	push   %ebp
+  8034be:	89 e5                	mov    %esp,%ebp
+  8034c0:	57                   	push   %edi
+  8034c1:	56                   	push   %esi
+  8034c2:	53                   	push   %ebx
+  8034c3:	83 ec 0c             	sub    $0xc,%esp
+  8034c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034c9:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8034cc:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8034cf:	85 db                	test   %ebx,%ebx
+  8034d1:	0f 84 ac 00 00 00    	je     803583 <ipc_reply_recv+0xc6>
+  8034d7:	85 f6                	test   %esi,%esi
+  8034d9:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8034de:	0f 45 c6             	cmovne %esi,%eax
+  8034e1:	83 ec 0c             	sub    $0xc,%esp
+  8034e4:	50                   	push   %eax
+  8034e5:	ff 75 14             	push   0x14(%ebp)
+  8034e8:	53                   	push   %ebx
+  8034e9:	ff 75 0c             	push   0xc(%ebp)
+  8034ec:	ff 75 08             	push   0x8(%ebp)
+  8034ef:	e8 5f dc ff ff       	call   801153 <sys_ipc_reply_recv>
+  8034f4:	83 c4 20             	add    $0x20,%esp
+  8034f7:	85 c0                	test   %eax,%eax
+  8034f9:	78 3a                	js     803535 <ipc_reply_recv+0x78>
+  8034fb:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8034ff:	74 10                	je     803511 <ipc_reply_recv+0x54>
+  803501:	a1 18 50 80 00       	mov    0x805018,%eax
+  803506:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  80350c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80350f:	89 02                	mov    %eax,(%edx)
+  803511:	85 ff                	test   %edi,%edi
+  803513:	74 0d                	je     803522 <ipc_reply_recv+0x65>
+  803515:	a1 18 50 80 00       	mov    0x805018,%eax
+  80351a:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803520:	89 07                	mov    %eax,(%edi)
+  803522:	a1 18 50 80 00       	mov    0x805018,%eax
+  803527:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80352d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803530:	5b                   	pop    %ebx
+  803531:	5e                   	pop    %esi
+  803532:	5f                   	pop    %edi
+  803533:	5d                   	pop    %ebp
+  803534:	c3                   	ret
+  803535:	ff 75 14             	push   0x14(%ebp)
+  803538:	53                   	push   %ebx
+  803539:	ff 75 0c             	push   0xc(%ebp)
+  80353c:	ff 75 08             	push   0x8(%ebp)
+  80353f:	e8 c1 da ff ff       	call   801005 <sys_ipc_try_send>
+  803544:	89 c2                	mov    %eax,%edx
+  803546:	c1 ea 1f             	shr    $0x1f,%edx
+  803549:	83 c4 10             	add    $0x10,%esp
+  80354c:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80354f:	0f 95 c1             	setne  %cl
+  803552:	84 d1                	test   %dl,%cl
+  803554:	74 05                	je     80355b <ipc_reply_recv+0x9e>
+  803556:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803559:	75 12                	jne    80356d <ipc_reply_recv+0xb0>
+  80355b:	83 ec 04             	sub    $0x4,%esp
+  80355e:	57                   	push   %edi
+  80355f:	56                   	push   %esi
+  803560:	ff 75 18             	push   0x18(%ebp)
+  803563:	e8 e3 fd ff ff       	call   80334b <ipc_recv>
+  803568:	83 c4 10             	add    $0x10,%esp
+  80356b:	eb c0                	jmp    80352d <ipc_reply_recv+0x70>
+  80356d:	83 ec 04             	sub    $0x4,%esp
+  803570:	50                   	push   %eax
+  803571:	ff 75 08             	push   0x8(%ebp)
+  803574:	68 74 3e 80 00       	push   $0x803e74
+  803579:	e8 d5 cc ff ff       	call   800253 <cprintf>
+  80357e:	83 c4 10             	add    $0x10,%esp
+  803581:	eb d8                	jmp    80355b <ipc_reply_recv+0x9e>
+  803583:	85 f6                	test   %esi,%esi
+  803585:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80358a:	0f 45 c6             	cmovne %esi,%eax
+  80358d:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803592:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803599:	e9 43 ff ff ff       	jmp    8034e1 <ipc_reply_recv+0x24>
+
+0080359e <ipc_find_env>:
+  80359e:	55                   	push   %ebp
+  80359f:	89 e5                	mov    %esp,%ebp
+  8035a1:	83 ec 14             	sub    $0x14,%esp
+  8035a4:	ff 75 08             	push   0x8(%ebp)
+  8035a7:	e8 f7 d9 ff ff       	call   800fa3 <sys_env_service>
+  8035ac:	85 c0                	test   %eax,%eax
+  8035ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b3:	0f 48 c2             	cmovs  %edx,%eax
+  8035b6:	c9                   	leave
+  8035b7:	c3                   	ret
+
+008035b8 <pageref>:
+  8035b8:	55                   	push   %ebp
+  8035b9:	89 e5                	mov    %esp,%ebp
+  8035bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035be:	89 c2                	mov    %eax,%edx
+  8035c0:	c1 ea 16             	shr    $0x16,%edx
+  8035c3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8035ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035cf:	f6 c1 01             	test   $0x1,%cl
+  8035d2:	74 22                	je     8035f6 <pageref+0x3e>
+  8035d4:	c1 e8 0c             	shr    $0xc,%eax
+  8035d7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035de:	a8 01                	test   $0x1,%al
+  8035e0:	74 14                	je     8035f6 <pageref+0x3e>
+  8035e2:	c1 e8 0c             	shr    $0xc,%eax
+  8035e5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035e8:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035ef:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035f3:	0f b7 d2             	movzwl %dx,%edx
+  8035f6:	89 d0                	mov    %edx,%eax
+  8035f8:	5d                   	pop    %ebp
+  8035f9:	c3                   	ret
+
+008035fa <__udivmoddi4>:
+  8035fa:	55                   	push   %ebp
+  8035fb:	57                   	push   %edi
+  8035fc:	56                   	push   %esi
+  8035fd:	53                   	push   %ebx
+  8035fe:	83 ec 24             	sub    $0x24,%esp
+  803601:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803605:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803609:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80360d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803611:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803615:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803619:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80361d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803621:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80362f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803634:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80363b:	00 
+  80363c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803643:	00 
+  803644:	89 fb                	mov    %edi,%ebx
+  803646:	eb 08                	jmp    803650 <__udivmoddi4+0x56>
+  803648:	83 e9 01             	sub    $0x1,%ecx
+  80364b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80364e:	74 68                	je     8036b8 <__udivmoddi4+0xbe>
+  803650:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803654:	01 c0                	add    %eax,%eax
+  803656:	89 c6                	mov    %eax,%esi
+  803658:	89 d7                	mov    %edx,%edi
+  80365a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80365e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803662:	0f ad d0             	shrd   %cl,%edx,%eax
+  803665:	d3 ea                	shr    %cl,%edx
+  803667:	f6 c1 20             	test   $0x20,%cl
+  80366a:	74 04                	je     803670 <__udivmoddi4+0x76>
+  80366c:	89 d0                	mov    %edx,%eax
+  80366e:	31 d2                	xor    %edx,%edx
+  803670:	83 e0 01             	and    $0x1,%eax
+  803673:	89 04 24             	mov    %eax,(%esp)
+  803676:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80367d:	00 
+  80367e:	8b 04 24             	mov    (%esp),%eax
+  803681:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803685:	09 f0                	or     %esi,%eax
+  803687:	09 fa                	or     %edi,%edx
+  803689:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80368d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803691:	39 f0                	cmp    %esi,%eax
+  803693:	89 d5                	mov    %edx,%ebp
+  803695:	19 fd                	sbb    %edi,%ebp
+  803697:	72 af                	jb     803648 <__udivmoddi4+0x4e>
+  803699:	29 f0                	sub    %esi,%eax
+  80369b:	19 fa                	sbb    %edi,%edx
+  80369d:	89 cf                	mov    %ecx,%edi
+  80369f:	c1 ef 05             	shr    $0x5,%edi
+  8036a2:	83 e7 01             	and    $0x1,%edi
+  8036a5:	89 fe                	mov    %edi,%esi
+  8036a7:	83 f6 01             	xor    $0x1,%esi
+  8036aa:	d3 e6                	shl    %cl,%esi
+  8036ac:	d3 e7                	shl    %cl,%edi
+  8036ae:	09 74 24 18          	or     %esi,0x18(%esp)
+  8036b2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8036b6:	eb 90                	jmp    803648 <__udivmoddi4+0x4e>
+  8036b8:	85 db                	test   %ebx,%ebx
+  8036ba:	74 05                	je     8036c1 <__udivmoddi4+0xc7>
+  8036bc:	89 03                	mov    %eax,(%ebx)
+  8036be:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036c1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036c5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036c9:	83 c4 24             	add    $0x24,%esp
+  8036cc:	5b                   	pop    %ebx
+  8036cd:	5e                   	pop    %esi
+  8036ce:	5f                   	pop    %edi
+  8036cf:	5d                   	pop    %ebp
+  8036d0:	c3                   	ret
+
+008036d1 <__udivdi3>:
+  8036d1:	83 ec 08             	sub    $0x8,%esp
+  8036d4:	6a 00                	push   $0x0
+  8036d6:	ff 74 24 1c          	push   0x1c(%esp)
+  8036da:	ff 74 24 1c          	push   0x1c(%esp)
+  8036de:	ff 74 24 1c          	push   0x1c(%esp)
+  8036e2:	ff 74 24 1c          	push   0x1c(%esp)
+  8036e6:	e8 0f ff ff ff       	call   8035fa <__udivmoddi4>
+  8036eb:	83 c4 1c             	add    $0x1c,%esp
+  8036ee:	c3                   	ret
+
+008036ef <__umoddi3>:
+  8036ef:	83 ec 18             	sub    $0x18,%esp
+  8036f2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036f6:	50                   	push   %eax
+  8036f7:	ff 74 24 2c          	push   0x2c(%esp)
+  8036fb:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ff:	ff 74 24 2c          	push   0x2c(%esp)
+  803703:	ff 74 24 2c          	push   0x2c(%esp)
+  803707:	e8 ee fe ff ff       	call   8035fa <__udivmoddi4>
+  80370c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803710:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803714:	83 c4 2c             	add    $0x2c,%esp
+  803717:	c3                   	ret
+
+00803718 <__divdi3>:
+  803718:	53                   	push   %ebx
+  803719:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80371d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803721:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803725:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803729:	85 d2                	test   %edx,%edx
+  80372b:	78 12                	js     80373f <__divdi3+0x27>
+  80372d:	85 db                	test   %ebx,%ebx
+  80372f:	78 2e                	js     80375f <__divdi3+0x47>
+  803731:	53                   	push   %ebx
+  803732:	51                   	push   %ecx
+  803733:	52                   	push   %edx
+  803734:	50                   	push   %eax
+  803735:	e8 97 ff ff ff       	call   8036d1 <__udivdi3>
+  80373a:	83 c4 10             	add    $0x10,%esp
+  80373d:	eb 1e                	jmp    80375d <__divdi3+0x45>
+  80373f:	f7 d8                	neg    %eax
+  803741:	83 d2 00             	adc    $0x0,%edx
+  803744:	f7 da                	neg    %edx
+  803746:	85 db                	test   %ebx,%ebx
+  803748:	78 2a                	js     803774 <__divdi3+0x5c>
+  80374a:	53                   	push   %ebx
+  80374b:	51                   	push   %ecx
+  80374c:	52                   	push   %edx
+  80374d:	50                   	push   %eax
+  80374e:	e8 7e ff ff ff       	call   8036d1 <__udivdi3>
+  803753:	83 c4 10             	add    $0x10,%esp
+  803756:	f7 d8                	neg    %eax
+  803758:	83 d2 00             	adc    $0x0,%edx
+  80375b:	f7 da                	neg    %edx
+  80375d:	5b                   	pop    %ebx
+  80375e:	c3                   	ret
+  80375f:	f7 d9                	neg    %ecx
+  803761:	83 d3 00             	adc    $0x0,%ebx
+  803764:	f7 db                	neg    %ebx
+  803766:	53                   	push   %ebx
+  803767:	51                   	push   %ecx
+  803768:	52                   	push   %edx
+  803769:	50                   	push   %eax
+  80376a:	e8 62 ff ff ff       	call   8036d1 <__udivdi3>
+  80376f:	83 c4 10             	add    $0x10,%esp
+  803772:	eb e2                	jmp    803756 <__divdi3+0x3e>
+  803774:	f7 d9                	neg    %ecx
+  803776:	83 d3 00             	adc    $0x0,%ebx
+  803779:	f7 db                	neg    %ebx
+  80377b:	53                   	push   %ebx
+  80377c:	51                   	push   %ecx
+  80377d:	52                   	push   %edx
+  80377e:	50                   	push   %eax
+  80377f:	e8 4d ff ff ff       	call   8036d1 <__udivdi3>
+  803784:	83 c4 10             	add    $0x10,%esp
+  803787:	eb d4                	jmp    80375d <__divdi3+0x45>
+
+00803789 <__moddi3>:
+  803789:	55                   	push   %ebp
+  80378a:	57                   	push   %edi
+  80378b:	56                   	push   %esi
+  80378c:	53                   	push   %ebx
+  80378d:	83 ec 0c             	sub    $0xc,%esp
+  803790:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803794:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803798:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80379c:	89 e9                	mov    %ebp,%ecx
+  80379e:	f7 d9                	neg    %ecx
+  8037a0:	89 d0                	mov    %edx,%eax
+  8037a2:	83 d0 00             	adc    $0x0,%eax
+  8037a5:	f7 d8                	neg    %eax
+  8037a7:	0f 49 e9             	cmovns %ecx,%ebp
+  8037aa:	0f 49 d0             	cmovns %eax,%edx
+  8037ad:	52                   	push   %edx
+  8037ae:	55                   	push   %ebp
+  8037af:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8037b3:	f7 da                	neg    %edx
+  8037b5:	89 d8                	mov    %ebx,%eax
+  8037b7:	83 d0 00             	adc    $0x0,%eax
+  8037ba:	f7 d8                	neg    %eax
+  8037bc:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8037c1:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8037c5:	0f 48 c3             	cmovs  %ebx,%eax
+  8037c8:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8037cc:	ff 74 24 0c          	push   0xc(%esp)
+  8037d0:	ff 74 24 0c          	push   0xc(%esp)
+  8037d4:	e8 16 ff ff ff       	call   8036ef <__umoddi3>
+  8037d9:	83 c4 10             	add    $0x10,%esp
+  8037dc:	85 db                	test   %ebx,%ebx
+  8037de:	78 08                	js     8037e8 <__moddi3+0x5f>
+  8037e0:	83 c4 0c             	add    $0xc,%esp
+  8037e3:	5b                   	pop    %ebx
+  8037e4:	5e                   	pop    %esi
+  8037e5:	5f                   	pop    %edi
+  8037e6:	5d                   	pop    %ebp
+  8037e7:	c3                   	ret
+  8037e8:	f7 d8                	neg    %eax
+  8037ea:	83 d2 00             	adc    $0x0,%edx
+  8037ed:	f7 da                	neg    %edx
+  8037ef:	eb ef                	jmp    8037e0 <__moddi3+0x57>
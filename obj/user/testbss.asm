@@ -0,0 +1,5075 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+  800039:	68 00 32 80 00       	push   $0x803200
+  80003e:	e8 ed 01 00 00       	call   800230 <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004b:	83 3c 85 20 50 80 00 	cmpl   $0x0,0x805020(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800064:	89 04 85 20 50 80 00 	mov    %eax,0x805020(,%eax,4)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	39 04 85 20 50 80 00 	cmp    %eax,0x805020(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 48 32 80 00       	push   $0x803248
+  800095:	e8 96 01 00 00       	call   800230 <cprintf>
+  80009a:	c7 05 20 60 c0 00 00 	movl   $0x0,0xc06020
+  8000a1:	00 00 00 
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 a7 32 80 00       	push   $0x8032a7
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 98 32 80 00       	push   $0x803298
+  8000b3:	e8 9d 00 00 00       	call   800155 <_panic>
+  8000b8:	50                   	push   %eax
+  8000b9:	68 7b 32 80 00       	push   $0x80327b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 98 32 80 00       	push   $0x803298
+  8000c5:	e8 8b 00 00 00       	call   800155 <_panic>
+  8000ca:	50                   	push   %eax
+  8000cb:	68 20 32 80 00       	push   $0x803220
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 98 32 80 00       	push   $0x803298
+  8000d7:	e8 79 00 00 00       	call   800155 <_panic>
+
+008000dc <libmain>:
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000e7:	e8 31 0c 00 00       	call   800d1d <sys_getenvid>
+  8000ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f1:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fc:	a3 20 50 c0 00       	mov    %eax,0xc05020
+  800101:	85 db                	test   %ebx,%ebx
+  800103:	7e 07                	jle    80010c <libmain+0x30>
+  800105:	8b 06                	mov    (%esi),%eax
+  800107:	a3 00 40 80 00       	mov    %eax,0x804000
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	56                   	push   %esi
+  800110:	53                   	push   %ebx
+  800111:	e8 1d ff ff ff       	call   800033 <umain>
+  800116:	e8 0a 00 00 00       	call   800125 <exit>
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800121:	5b                   	pop    %ebx
+  800122:	5e                   	pop    %esi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+
+00800125 <exit>:
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	83 ec 08             	sub    $0x8,%esp
+  80012b:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  800130:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800136:	85 c0                	test   %eax,%eax
+  800138:	75 14                	jne    80014e <exit+0x29>
+  80013a:	e8 80 16 00 00       	call   8017bf <close_all>
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	6a 00                	push   $0x0
+  800144:	e8 93 0b 00 00       	call   800cdc <sys_env_destroy>
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+  80014e:	e8 f6 12 00 00       	call   801449 <sys_lease_complete>
+  800153:	eb e5                	jmp    80013a <exit+0x15>
+
+00800155 <_panic>:
+  800155:	55                   	push   %ebp
+  800156:	89 e5                	mov    %esp,%ebp
+  800158:	56                   	push   %esi
+  800159:	53                   	push   %ebx
+  80015a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80015d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800163:	e8 b5 0b 00 00       	call   800d1d <sys_getenvid>
+  800168:	83 ec 0c             	sub    $0xc,%esp
+  80016b:	ff 75 0c             	push   0xc(%ebp)
+  80016e:	ff 75 08             	push   0x8(%ebp)
+  800171:	56                   	push   %esi
+  800172:	50                   	push   %eax
+  800173:	68 c8 32 80 00       	push   $0x8032c8
+  800178:	e8 b3 00 00 00       	call   800230 <cprintf>
+  80017d:	83 c4 18             	add    $0x18,%esp
+  800180:	53                   	push   %ebx
+  800181:	ff 75 10             	push   0x10(%ebp)
+  800184:	e8 56 00 00 00       	call   8001df <vcprintf>
+  800189:	c7 04 24 96 32 80 00 	movl   $0x803296,(%esp)
+  800190:	e8 9b 00 00 00       	call   800230 <cprintf>
+  800195:	83 c4 10             	add    $0x10,%esp
+  800198:	cc                   	int3
+  800199:	eb fd                	jmp    800198 <_panic+0x43>
+
+0080019b <putch>:
+  80019b:	55                   	push   %ebp
+  80019c:	89 e5                	mov    %esp,%ebp
+  80019e:	53                   	push   %ebx
+  80019f:	83 ec 04             	sub    $0x4,%esp
+  8001a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001a5:	8b 13                	mov    (%ebx),%edx
+  8001a7:	8d 42 01             	lea    0x1(%edx),%eax
+  8001aa:	89 03                	mov    %eax,(%ebx)
+  8001ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001af:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001b3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b8:	74 09                	je     8001c3 <putch+0x28>
+  8001ba:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+  8001c3:	83 ec 08             	sub    $0x8,%esp
+  8001c6:	68 ff 00 00 00       	push   $0xff
+  8001cb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001ce:	50                   	push   %eax
+  8001cf:	e8 cb 0a 00 00       	call   800c9f <sys_cputs>
+  8001d4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001da:	83 c4 10             	add    $0x10,%esp
+  8001dd:	eb db                	jmp    8001ba <putch+0x1f>
+
+008001df <vcprintf>:
+  8001df:	55                   	push   %ebp
+  8001e0:	89 e5                	mov    %esp,%ebp
+  8001e2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8001e8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ef:	00 00 00 
+  8001f2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001f9:	00 00 00 
+  8001fc:	ff 75 0c             	push   0xc(%ebp)
+  8001ff:	ff 75 08             	push   0x8(%ebp)
+  800202:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800208:	50                   	push   %eax
+  800209:	68 9b 01 80 00       	push   $0x80019b
+  80020e:	e8 1c 01 00 00       	call   80032f <vprintfmt>
+  800213:	83 c4 08             	add    $0x8,%esp
+  800216:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800222:	50                   	push   %eax
+  800223:	e8 77 0a 00 00       	call   800c9f <sys_cputs>
+  800228:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80022e:	c9                   	leave
+  80022f:	c3                   	ret
+
+00800230 <cprintf>:
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	83 ec 10             	sub    $0x10,%esp
+  800236:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800239:	50                   	push   %eax
+  80023a:	ff 75 08             	push   0x8(%ebp)
+  80023d:	e8 9d ff ff ff       	call   8001df <vcprintf>
+  800242:	c9                   	leave
+  800243:	c3                   	ret
+
+00800244 <printnum>:
+  800244:	55                   	push   %ebp
+  800245:	89 e5                	mov    %esp,%ebp
+  800247:	57                   	push   %edi
+  800248:	56                   	push   %esi
+  800249:	53                   	push   %ebx
+  80024a:	83 ec 1c             	sub    $0x1c,%esp
+  80024d:	89 c3                	mov    %eax,%ebx
+  80024f:	89 d6                	mov    %edx,%esi
+  800251:	8b 45 08             	mov    0x8(%ebp),%eax
+  800254:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800257:	89 d1                	mov    %edx,%ecx
+  800259:	89 c2                	mov    %eax,%edx
+  80025b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80025e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800261:	8b 45 10             	mov    0x10(%ebp),%eax
+  800264:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800267:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80026e:	39 c2                	cmp    %eax,%edx
+  800270:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800273:	73 4b                	jae    8002c0 <printnum+0x7c>
+  800275:	8b 45 14             	mov    0x14(%ebp),%eax
+  800278:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80027b:	85 ff                	test   %edi,%edi
+  80027d:	7e 11                	jle    800290 <printnum+0x4c>
+  80027f:	83 ec 08             	sub    $0x8,%esp
+  800282:	56                   	push   %esi
+  800283:	ff 75 18             	push   0x18(%ebp)
+  800286:	ff d3                	call   *%ebx
+  800288:	83 c4 10             	add    $0x10,%esp
+  80028b:	83 ef 01             	sub    $0x1,%edi
+  80028e:	75 ef                	jne    80027f <printnum+0x3b>
+  800290:	83 ec 08             	sub    $0x8,%esp
+  800293:	56                   	push   %esi
+  800294:	83 ec 04             	sub    $0x4,%esp
+  800297:	ff 75 e4             	push   -0x1c(%ebp)
+  80029a:	ff 75 e0             	push   -0x20(%ebp)
+  80029d:	ff 75 dc             	push   -0x24(%ebp)
+  8002a0:	ff 75 d8             	push   -0x28(%ebp)
+  8002a3:	e8 50 2e 00 00       	call   8030f8 <__umoddi3>
+  8002a8:	83 c4 14             	add    $0x14,%esp
+  8002ab:	0f be 80 eb 32 80 00 	movsbl 0x8032eb(%eax),%eax
+  8002b2:	50                   	push   %eax
+  8002b3:	ff d3                	call   *%ebx
+  8002b5:	83 c4 10             	add    $0x10,%esp
+  8002b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002bb:	5b                   	pop    %ebx
+  8002bc:	5e                   	pop    %esi
+  8002bd:	5f                   	pop    %edi
+  8002be:	5d                   	pop    %ebp
+  8002bf:	c3                   	ret
+  8002c0:	83 ec 0c             	sub    $0xc,%esp
+  8002c3:	ff 75 18             	push   0x18(%ebp)
+  8002c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002c9:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002cc:	52                   	push   %edx
+  8002cd:	50                   	push   %eax
+  8002ce:	83 ec 08             	sub    $0x8,%esp
+  8002d1:	ff 75 e4             	push   -0x1c(%ebp)
+  8002d4:	ff 75 e0             	push   -0x20(%ebp)
+  8002d7:	ff 75 dc             	push   -0x24(%ebp)
+  8002da:	ff 75 d8             	push   -0x28(%ebp)
+  8002dd:	e8 f8 2d 00 00       	call   8030da <__udivdi3>
+  8002e2:	83 c4 18             	add    $0x18,%esp
+  8002e5:	52                   	push   %edx
+  8002e6:	50                   	push   %eax
+  8002e7:	89 f2                	mov    %esi,%edx
+  8002e9:	89 d8                	mov    %ebx,%eax
+  8002eb:	e8 54 ff ff ff       	call   800244 <printnum>
+  8002f0:	83 c4 20             	add    $0x20,%esp
+  8002f3:	eb 9b                	jmp    800290 <printnum+0x4c>
+
+008002f5 <sprintputch>:
+  8002f5:	55                   	push   %ebp
+  8002f6:	89 e5                	mov    %esp,%ebp
+  8002f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002fb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8002ff:	8b 10                	mov    (%eax),%edx
+  800301:	3b 50 04             	cmp    0x4(%eax),%edx
+  800304:	73 0a                	jae    800310 <sprintputch+0x1b>
+  800306:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800309:	89 08                	mov    %ecx,(%eax)
+  80030b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030e:	88 02                	mov    %al,(%edx)
+  800310:	5d                   	pop    %ebp
+  800311:	c3                   	ret
+
+00800312 <printfmt>:
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 08             	sub    $0x8,%esp
+  800318:	8d 45 14             	lea    0x14(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 10             	push   0x10(%ebp)
+  80031f:	ff 75 0c             	push   0xc(%ebp)
+  800322:	ff 75 08             	push   0x8(%ebp)
+  800325:	e8 05 00 00 00       	call   80032f <vprintfmt>
+  80032a:	83 c4 10             	add    $0x10,%esp
+  80032d:	c9                   	leave
+  80032e:	c3                   	ret
+
+0080032f <vprintfmt>:
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	57                   	push   %edi
+  800333:	56                   	push   %esi
+  800334:	53                   	push   %ebx
+  800335:	83 ec 2c             	sub    $0x2c,%esp
+  800338:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80033b:	89 df                	mov    %ebx,%edi
+  80033d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800340:	8b 45 10             	mov    0x10(%ebp),%eax
+  800343:	8d 70 01             	lea    0x1(%eax),%esi
+  800346:	0f b6 00             	movzbl (%eax),%eax
+  800349:	83 f8 25             	cmp    $0x25,%eax
+  80034c:	74 1e                	je     80036c <vprintfmt+0x3d>
+  80034e:	85 c0                	test   %eax,%eax
+  800350:	0f 84 15 05 00 00    	je     80086b <vprintfmt+0x53c>
+  800356:	83 ec 08             	sub    $0x8,%esp
+  800359:	53                   	push   %ebx
+  80035a:	50                   	push   %eax
+  80035b:	ff d7                	call   *%edi
+  80035d:	83 c6 01             	add    $0x1,%esi
+  800360:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	83 f8 25             	cmp    $0x25,%eax
+  80036a:	75 e2                	jne    80034e <vprintfmt+0x1f>
+  80036c:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800370:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800377:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80037e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800385:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80038a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80038d:	8d 56 01             	lea    0x1(%esi),%edx
+  800390:	0f b6 0e             	movzbl (%esi),%ecx
+  800393:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800396:	3c 55                	cmp    $0x55,%al
+  800398:	0f 87 3b 04 00 00    	ja     8007d9 <vprintfmt+0x4aa>
+  80039e:	0f b6 c0             	movzbl %al,%eax
+  8003a1:	ff 24 85 20 34 80 00 	jmp    *0x803420(,%eax,4)
+  8003a8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003ab:	eb 93                	jmp    800340 <vprintfmt+0x11>
+  8003ad:	89 d6                	mov    %edx,%esi
+  8003af:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003b3:	eb d8                	jmp    80038d <vprintfmt+0x5e>
+  8003b5:	89 d6                	mov    %edx,%esi
+  8003b7:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003bb:	eb d0                	jmp    80038d <vprintfmt+0x5e>
+  8003bd:	0f b6 c9             	movzbl %cl,%ecx
+  8003c0:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003c3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003c6:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003cd:	83 f9 09             	cmp    $0x9,%ecx
+  8003d0:	77 6f                	ja     800441 <vprintfmt+0x112>
+  8003d2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003d5:	83 c2 01             	add    $0x1,%edx
+  8003d8:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003db:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003df:	0f be 02             	movsbl (%edx),%eax
+  8003e2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003e5:	83 fe 09             	cmp    $0x9,%esi
+  8003e8:	76 eb                	jbe    8003d5 <vprintfmt+0xa6>
+  8003ea:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8003ed:	89 d6                	mov    %edx,%esi
+  8003ef:	eb 13                	jmp    800404 <vprintfmt+0xd5>
+  8003f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f4:	8b 00                	mov    (%eax),%eax
+  8003f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  800402:	89 d6                	mov    %edx,%esi
+  800404:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800408:	79 83                	jns    80038d <vprintfmt+0x5e>
+  80040a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80040d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800410:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800417:	e9 71 ff ff ff       	jmp    80038d <vprintfmt+0x5e>
+  80041c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80041f:	85 c9                	test   %ecx,%ecx
+  800421:	b8 00 00 00 00       	mov    $0x0,%eax
+  800426:	0f 49 c1             	cmovns %ecx,%eax
+  800429:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80042c:	89 d6                	mov    %edx,%esi
+  80042e:	e9 5a ff ff ff       	jmp    80038d <vprintfmt+0x5e>
+  800433:	89 d6                	mov    %edx,%esi
+  800435:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80043c:	e9 4c ff ff ff       	jmp    80038d <vprintfmt+0x5e>
+  800441:	89 d6                	mov    %edx,%esi
+  800443:	eb bf                	jmp    800404 <vprintfmt+0xd5>
+  800445:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800449:	89 d6                	mov    %edx,%esi
+  80044b:	e9 3d ff ff ff       	jmp    80038d <vprintfmt+0x5e>
+  800450:	89 55 10             	mov    %edx,0x10(%ebp)
+  800453:	8b 45 14             	mov    0x14(%ebp),%eax
+  800456:	8d 70 04             	lea    0x4(%eax),%esi
+  800459:	83 ec 08             	sub    $0x8,%esp
+  80045c:	53                   	push   %ebx
+  80045d:	ff 30                	push   (%eax)
+  80045f:	ff d7                	call   *%edi
+  800461:	83 c4 10             	add    $0x10,%esp
+  800464:	89 75 14             	mov    %esi,0x14(%ebp)
+  800467:	e9 d4 fe ff ff       	jmp    800340 <vprintfmt+0x11>
+  80046c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80046f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800472:	8d 70 04             	lea    0x4(%eax),%esi
+  800475:	8b 10                	mov    (%eax),%edx
+  800477:	89 d0                	mov    %edx,%eax
+  800479:	f7 d8                	neg    %eax
+  80047b:	0f 48 c2             	cmovs  %edx,%eax
+  80047e:	83 f8 12             	cmp    $0x12,%eax
+  800481:	7f 23                	jg     8004a6 <vprintfmt+0x177>
+  800483:	8b 14 85 80 35 80 00 	mov    0x803580(,%eax,4),%edx
+  80048a:	85 d2                	test   %edx,%edx
+  80048c:	74 18                	je     8004a6 <vprintfmt+0x177>
+  80048e:	52                   	push   %edx
+  80048f:	68 db 36 80 00       	push   $0x8036db
+  800494:	53                   	push   %ebx
+  800495:	57                   	push   %edi
+  800496:	e8 77 fe ff ff       	call   800312 <printfmt>
+  80049b:	83 c4 10             	add    $0x10,%esp
+  80049e:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004a1:	e9 9a fe ff ff       	jmp    800340 <vprintfmt+0x11>
+  8004a6:	50                   	push   %eax
+  8004a7:	68 03 33 80 00       	push   $0x803303
+  8004ac:	53                   	push   %ebx
+  8004ad:	57                   	push   %edi
+  8004ae:	e8 5f fe ff ff       	call   800312 <printfmt>
+  8004b3:	83 c4 10             	add    $0x10,%esp
+  8004b6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004b9:	e9 82 fe ff ff       	jmp    800340 <vprintfmt+0x11>
+  8004be:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	83 c0 04             	add    $0x4,%eax
+  8004c7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cd:	8b 00                	mov    (%eax),%eax
+  8004cf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004d2:	85 c0                	test   %eax,%eax
+  8004d4:	0f 84 61 03 00 00    	je     80083b <vprintfmt+0x50c>
+  8004da:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004de:	7e 06                	jle    8004e6 <vprintfmt+0x1b7>
+  8004e0:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004e4:	75 29                	jne    80050f <vprintfmt+0x1e0>
+  8004e6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004e9:	8d 70 01             	lea    0x1(%eax),%esi
+  8004ec:	0f b6 00             	movzbl (%eax),%eax
+  8004ef:	0f be d0             	movsbl %al,%edx
+  8004f2:	85 d2                	test   %edx,%edx
+  8004f4:	0f 84 bb 00 00 00    	je     8005b5 <vprintfmt+0x286>
+  8004fa:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004fd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800500:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800503:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800506:	eb 7a                	jmp    800582 <vprintfmt+0x253>
+  800508:	c7 45 d0 fc 32 80 00 	movl   $0x8032fc,-0x30(%ebp)
+  80050f:	83 ec 08             	sub    $0x8,%esp
+  800512:	ff 75 d4             	push   -0x2c(%ebp)
+  800515:	ff 75 d0             	push   -0x30(%ebp)
+  800518:	e8 e0 03 00 00       	call   8008fd <strnlen>
+  80051d:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800520:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800523:	83 c4 10             	add    $0x10,%esp
+  800526:	85 d2                	test   %edx,%edx
+  800528:	0f 8e d6 02 00 00    	jle    800804 <vprintfmt+0x4d5>
+  80052e:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	53                   	push   %ebx
+  800536:	56                   	push   %esi
+  800537:	ff d7                	call   *%edi
+  800539:	83 c4 10             	add    $0x10,%esp
+  80053c:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800540:	75 f0                	jne    800532 <vprintfmt+0x203>
+  800542:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800545:	8d 70 01             	lea    0x1(%eax),%esi
+  800548:	0f b6 00             	movzbl (%eax),%eax
+  80054b:	0f be d0             	movsbl %al,%edx
+  80054e:	85 d2                	test   %edx,%edx
+  800550:	0f 84 da 02 00 00    	je     800830 <vprintfmt+0x501>
+  800556:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800559:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80055c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80055f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800562:	eb 1e                	jmp    800582 <vprintfmt+0x253>
+  800564:	83 ec 08             	sub    $0x8,%esp
+  800567:	ff 75 0c             	push   0xc(%ebp)
+  80056a:	52                   	push   %edx
+  80056b:	ff 55 08             	call   *0x8(%ebp)
+  80056e:	83 c4 10             	add    $0x10,%esp
+  800571:	83 eb 01             	sub    $0x1,%ebx
+  800574:	83 c6 01             	add    $0x1,%esi
+  800577:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80057b:	0f be d0             	movsbl %al,%edx
+  80057e:	85 d2                	test   %edx,%edx
+  800580:	74 2a                	je     8005ac <vprintfmt+0x27d>
+  800582:	85 ff                	test   %edi,%edi
+  800584:	78 05                	js     80058b <vprintfmt+0x25c>
+  800586:	83 ef 01             	sub    $0x1,%edi
+  800589:	78 59                	js     8005e4 <vprintfmt+0x2b5>
+  80058b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80058f:	74 d3                	je     800564 <vprintfmt+0x235>
+  800591:	0f be c0             	movsbl %al,%eax
+  800594:	83 e8 20             	sub    $0x20,%eax
+  800597:	83 f8 5e             	cmp    $0x5e,%eax
+  80059a:	76 c8                	jbe    800564 <vprintfmt+0x235>
+  80059c:	83 ec 08             	sub    $0x8,%esp
+  80059f:	ff 75 0c             	push   0xc(%ebp)
+  8005a2:	6a 3f                	push   $0x3f
+  8005a4:	ff 55 08             	call   *0x8(%ebp)
+  8005a7:	83 c4 10             	add    $0x10,%esp
+  8005aa:	eb c5                	jmp    800571 <vprintfmt+0x242>
+  8005ac:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005b5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005b8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005bc:	7e 1b                	jle    8005d9 <vprintfmt+0x2aa>
+  8005be:	83 ec 08             	sub    $0x8,%esp
+  8005c1:	53                   	push   %ebx
+  8005c2:	6a 20                	push   $0x20
+  8005c4:	ff d7                	call   *%edi
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	83 ee 01             	sub    $0x1,%esi
+  8005cc:	75 f0                	jne    8005be <vprintfmt+0x28f>
+  8005ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d4:	e9 67 fd ff ff       	jmp    800340 <vprintfmt+0x11>
+  8005d9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005df:	e9 5c fd ff ff       	jmp    800340 <vprintfmt+0x11>
+  8005e4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005ed:	eb c6                	jmp    8005b5 <vprintfmt+0x286>
+  8005ef:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005f2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005f5:	83 f9 01             	cmp    $0x1,%ecx
+  8005f8:	7f 1f                	jg     800619 <vprintfmt+0x2ea>
+  8005fa:	85 c9                	test   %ecx,%ecx
+  8005fc:	74 67                	je     800665 <vprintfmt+0x336>
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 30                	mov    (%eax),%esi
+  800603:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800606:	89 f0                	mov    %esi,%eax
+  800608:	c1 f8 1f             	sar    $0x1f,%eax
+  80060b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8d 40 04             	lea    0x4(%eax),%eax
+  800614:	89 45 14             	mov    %eax,0x14(%ebp)
+  800617:	eb 17                	jmp    800630 <vprintfmt+0x301>
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8b 50 04             	mov    0x4(%eax),%edx
+  80061f:	8b 00                	mov    (%eax),%eax
+  800621:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800624:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800627:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062a:	8d 40 08             	lea    0x8(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800630:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800633:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800636:	be 0a 00 00 00       	mov    $0xa,%esi
+  80063b:	85 c9                	test   %ecx,%ecx
+  80063d:	0f 89 12 01 00 00    	jns    800755 <vprintfmt+0x426>
+  800643:	83 ec 08             	sub    $0x8,%esp
+  800646:	53                   	push   %ebx
+  800647:	6a 2d                	push   $0x2d
+  800649:	ff d7                	call   *%edi
+  80064b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80064e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800651:	f7 da                	neg    %edx
+  800653:	83 d1 00             	adc    $0x0,%ecx
+  800656:	f7 d9                	neg    %ecx
+  800658:	83 c4 10             	add    $0x10,%esp
+  80065b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800660:	e9 f0 00 00 00       	jmp    800755 <vprintfmt+0x426>
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8b 30                	mov    (%eax),%esi
+  80066a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80066d:	89 f0                	mov    %esi,%eax
+  80066f:	c1 f8 1f             	sar    $0x1f,%eax
+  800672:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800675:	8b 45 14             	mov    0x14(%ebp),%eax
+  800678:	8d 40 04             	lea    0x4(%eax),%eax
+  80067b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067e:	eb b0                	jmp    800630 <vprintfmt+0x301>
+  800680:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800683:	89 55 10             	mov    %edx,0x10(%ebp)
+  800686:	83 f9 01             	cmp    $0x1,%ecx
+  800689:	7f 1e                	jg     8006a9 <vprintfmt+0x37a>
+  80068b:	85 c9                	test   %ecx,%ecx
+  80068d:	74 32                	je     8006c1 <vprintfmt+0x392>
+  80068f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800692:	8b 10                	mov    (%eax),%edx
+  800694:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800699:	8d 40 04             	lea    0x4(%eax),%eax
+  80069c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069f:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006a4:	e9 ac 00 00 00       	jmp    800755 <vprintfmt+0x426>
+  8006a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ac:	8b 10                	mov    (%eax),%edx
+  8006ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006bc:	e9 94 00 00 00       	jmp    800755 <vprintfmt+0x426>
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006d6:	eb 7d                	jmp    800755 <vprintfmt+0x426>
+  8006d8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006db:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006de:	83 f9 01             	cmp    $0x1,%ecx
+  8006e1:	7f 1b                	jg     8006fe <vprintfmt+0x3cf>
+  8006e3:	85 c9                	test   %ecx,%ecx
+  8006e5:	74 2c                	je     800713 <vprintfmt+0x3e4>
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8b 10                	mov    (%eax),%edx
+  8006ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f7:	be 08 00 00 00       	mov    $0x8,%esi
+  8006fc:	eb 57                	jmp    800755 <vprintfmt+0x426>
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	8b 48 04             	mov    0x4(%eax),%ecx
+  800706:	8d 40 08             	lea    0x8(%eax),%eax
+  800709:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070c:	be 08 00 00 00       	mov    $0x8,%esi
+  800711:	eb 42                	jmp    800755 <vprintfmt+0x426>
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 10                	mov    (%eax),%edx
+  800718:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071d:	8d 40 04             	lea    0x4(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+  800723:	be 08 00 00 00       	mov    $0x8,%esi
+  800728:	eb 2b                	jmp    800755 <vprintfmt+0x426>
+  80072a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80072d:	83 ec 08             	sub    $0x8,%esp
+  800730:	53                   	push   %ebx
+  800731:	6a 30                	push   $0x30
+  800733:	ff d7                	call   *%edi
+  800735:	83 c4 08             	add    $0x8,%esp
+  800738:	53                   	push   %ebx
+  800739:	6a 78                	push   $0x78
+  80073b:	ff d7                	call   *%edi
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	8b 10                	mov    (%eax),%edx
+  800742:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800747:	83 c4 10             	add    $0x10,%esp
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800750:	be 10 00 00 00       	mov    $0x10,%esi
+  800755:	83 ec 0c             	sub    $0xc,%esp
+  800758:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80075c:	50                   	push   %eax
+  80075d:	ff 75 e4             	push   -0x1c(%ebp)
+  800760:	56                   	push   %esi
+  800761:	51                   	push   %ecx
+  800762:	52                   	push   %edx
+  800763:	89 da                	mov    %ebx,%edx
+  800765:	89 f8                	mov    %edi,%eax
+  800767:	e8 d8 fa ff ff       	call   800244 <printnum>
+  80076c:	83 c4 20             	add    $0x20,%esp
+  80076f:	e9 cc fb ff ff       	jmp    800340 <vprintfmt+0x11>
+  800774:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800777:	89 55 10             	mov    %edx,0x10(%ebp)
+  80077a:	83 f9 01             	cmp    $0x1,%ecx
+  80077d:	7f 1b                	jg     80079a <vprintfmt+0x46b>
+  80077f:	85 c9                	test   %ecx,%ecx
+  800781:	74 2c                	je     8007af <vprintfmt+0x480>
+  800783:	8b 45 14             	mov    0x14(%ebp),%eax
+  800786:	8b 10                	mov    (%eax),%edx
+  800788:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078d:	8d 40 04             	lea    0x4(%eax),%eax
+  800790:	89 45 14             	mov    %eax,0x14(%ebp)
+  800793:	be 10 00 00 00       	mov    $0x10,%esi
+  800798:	eb bb                	jmp    800755 <vprintfmt+0x426>
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 10                	mov    (%eax),%edx
+  80079f:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a8:	be 10 00 00 00       	mov    $0x10,%esi
+  8007ad:	eb a6                	jmp    800755 <vprintfmt+0x426>
+  8007af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b2:	8b 10                	mov    (%eax),%edx
+  8007b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bf:	be 10 00 00 00       	mov    $0x10,%esi
+  8007c4:	eb 8f                	jmp    800755 <vprintfmt+0x426>
+  8007c6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007c9:	83 ec 08             	sub    $0x8,%esp
+  8007cc:	53                   	push   %ebx
+  8007cd:	6a 25                	push   $0x25
+  8007cf:	ff d7                	call   *%edi
+  8007d1:	83 c4 10             	add    $0x10,%esp
+  8007d4:	e9 67 fb ff ff       	jmp    800340 <vprintfmt+0x11>
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	53                   	push   %ebx
+  8007dd:	6a 25                	push   $0x25
+  8007df:	ff d7                	call   *%edi
+  8007e1:	83 c4 10             	add    $0x10,%esp
+  8007e4:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007e8:	0f 84 ba fb ff ff    	je     8003a8 <vprintfmt+0x79>
+  8007ee:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007f1:	89 f0                	mov    %esi,%eax
+  8007f3:	83 e8 01             	sub    $0x1,%eax
+  8007f6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007fa:	75 f7                	jne    8007f3 <vprintfmt+0x4c4>
+  8007fc:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007ff:	e9 3c fb ff ff       	jmp    800340 <vprintfmt+0x11>
+  800804:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800807:	8d 70 01             	lea    0x1(%eax),%esi
+  80080a:	0f b6 00             	movzbl (%eax),%eax
+  80080d:	0f be d0             	movsbl %al,%edx
+  800810:	85 d2                	test   %edx,%edx
+  800812:	74 11                	je     800825 <vprintfmt+0x4f6>
+  800814:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800817:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80081a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80081d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800820:	e9 5d fd ff ff       	jmp    800582 <vprintfmt+0x253>
+  800825:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082b:	e9 10 fb ff ff       	jmp    800340 <vprintfmt+0x11>
+  800830:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800833:	89 45 14             	mov    %eax,0x14(%ebp)
+  800836:	e9 05 fb ff ff       	jmp    800340 <vprintfmt+0x11>
+  80083b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80083f:	7e 0a                	jle    80084b <vprintfmt+0x51c>
+  800841:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800845:	0f 85 bd fc ff ff    	jne    800508 <vprintfmt+0x1d9>
+  80084b:	ba 28 00 00 00       	mov    $0x28,%edx
+  800850:	b8 28 00 00 00       	mov    $0x28,%eax
+  800855:	be fd 32 80 00       	mov    $0x8032fd,%esi
+  80085a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80085d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800860:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800863:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800866:	e9 17 fd ff ff       	jmp    800582 <vprintfmt+0x253>
+  80086b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80086e:	5b                   	pop    %ebx
+  80086f:	5e                   	pop    %esi
+  800870:	5f                   	pop    %edi
+  800871:	5d                   	pop    %ebp
+  800872:	c3                   	ret
+
+00800873 <vsnprintf>:
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	83 ec 18             	sub    $0x18,%esp
+  800879:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800882:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800886:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800889:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800890:	85 c0                	test   %eax,%eax
+  800892:	74 26                	je     8008ba <vsnprintf+0x47>
+  800894:	85 d2                	test   %edx,%edx
+  800896:	7e 22                	jle    8008ba <vsnprintf+0x47>
+  800898:	ff 75 14             	push   0x14(%ebp)
+  80089b:	ff 75 10             	push   0x10(%ebp)
+  80089e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008a1:	50                   	push   %eax
+  8008a2:	68 f5 02 80 00       	push   $0x8002f5
+  8008a7:	e8 83 fa ff ff       	call   80032f <vprintfmt>
+  8008ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008af:	c6 00 00             	movb   $0x0,(%eax)
+  8008b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	c9                   	leave
+  8008b9:	c3                   	ret
+  8008ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008bf:	eb f7                	jmp    8008b8 <vsnprintf+0x45>
+
+008008c1 <snprintf>:
+  8008c1:	55                   	push   %ebp
+  8008c2:	89 e5                	mov    %esp,%ebp
+  8008c4:	83 ec 08             	sub    $0x8,%esp
+  8008c7:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008ca:	50                   	push   %eax
+  8008cb:	ff 75 10             	push   0x10(%ebp)
+  8008ce:	ff 75 0c             	push   0xc(%ebp)
+  8008d1:	ff 75 08             	push   0x8(%ebp)
+  8008d4:	e8 9a ff ff ff       	call   800873 <vsnprintf>
+  8008d9:	c9                   	leave
+  8008da:	c3                   	ret
+
+008008db <strlen>:
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008e1:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008e4:	74 10                	je     8008f6 <strlen+0x1b>
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	83 c0 01             	add    $0x1,%eax
+  8008ee:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008f2:	75 f7                	jne    8008eb <strlen+0x10>
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+  8008f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fb:	eb f7                	jmp    8008f4 <strlen+0x19>
+
+008008fd <strnlen>:
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800903:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800906:	85 d2                	test   %edx,%edx
+  800908:	74 16                	je     800920 <strnlen+0x23>
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800913:	74 09                	je     80091e <strnlen+0x21>
+  800915:	83 c0 01             	add    $0x1,%eax
+  800918:	39 d0                	cmp    %edx,%eax
+  80091a:	75 f3                	jne    80090f <strnlen+0x12>
+  80091c:	89 d0                	mov    %edx,%eax
+  80091e:	5d                   	pop    %ebp
+  80091f:	c3                   	ret
+  800920:	b8 00 00 00 00       	mov    $0x0,%eax
+  800925:	eb f7                	jmp    80091e <strnlen+0x21>
+
+00800927 <strcpy>:
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	53                   	push   %ebx
+  80092b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80092e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800931:	b8 00 00 00 00       	mov    $0x0,%eax
+  800936:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80093a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80093d:	83 c0 01             	add    $0x1,%eax
+  800940:	84 d2                	test   %dl,%dl
+  800942:	75 f2                	jne    800936 <strcpy+0xf>
+  800944:	89 c8                	mov    %ecx,%eax
+  800946:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800949:	c9                   	leave
+  80094a:	c3                   	ret
+
+0080094b <strcat>:
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	53                   	push   %ebx
+  80094f:	83 ec 10             	sub    $0x10,%esp
+  800952:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800955:	53                   	push   %ebx
+  800956:	e8 80 ff ff ff       	call   8008db <strlen>
+  80095b:	83 c4 08             	add    $0x8,%esp
+  80095e:	ff 75 0c             	push   0xc(%ebp)
+  800961:	01 d8                	add    %ebx,%eax
+  800963:	50                   	push   %eax
+  800964:	e8 be ff ff ff       	call   800927 <strcpy>
+  800969:	89 d8                	mov    %ebx,%eax
+  80096b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80096e:	c9                   	leave
+  80096f:	c3                   	ret
+
+00800970 <strncpy>:
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	56                   	push   %esi
+  800974:	53                   	push   %ebx
+  800975:	8b 75 08             	mov    0x8(%ebp),%esi
+  800978:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80097b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80097e:	85 db                	test   %ebx,%ebx
+  800980:	74 17                	je     800999 <strncpy+0x29>
+  800982:	01 f3                	add    %esi,%ebx
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	83 c0 01             	add    $0x1,%eax
+  800989:	0f b6 0a             	movzbl (%edx),%ecx
+  80098c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80098f:	80 f9 01             	cmp    $0x1,%cl
+  800992:	83 da ff             	sbb    $0xffffffff,%edx
+  800995:	39 c3                	cmp    %eax,%ebx
+  800997:	75 ed                	jne    800986 <strncpy+0x16>
+  800999:	89 f0                	mov    %esi,%eax
+  80099b:	5b                   	pop    %ebx
+  80099c:	5e                   	pop    %esi
+  80099d:	5d                   	pop    %ebp
+  80099e:	c3                   	ret
+
+0080099f <strlcpy>:
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	56                   	push   %esi
+  8009a3:	53                   	push   %ebx
+  8009a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009ad:	89 f0                	mov    %esi,%eax
+  8009af:	85 db                	test   %ebx,%ebx
+  8009b1:	74 1e                	je     8009d1 <strlcpy+0x32>
+  8009b3:	83 eb 01             	sub    $0x1,%ebx
+  8009b6:	74 16                	je     8009ce <strlcpy+0x2f>
+  8009b8:	01 f3                	add    %esi,%ebx
+  8009ba:	0f b6 0a             	movzbl (%edx),%ecx
+  8009bd:	84 c9                	test   %cl,%cl
+  8009bf:	74 0d                	je     8009ce <strlcpy+0x2f>
+  8009c1:	83 c2 01             	add    $0x1,%edx
+  8009c4:	83 c0 01             	add    $0x1,%eax
+  8009c7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009ca:	39 d8                	cmp    %ebx,%eax
+  8009cc:	75 ec                	jne    8009ba <strlcpy+0x1b>
+  8009ce:	c6 00 00             	movb   $0x0,(%eax)
+  8009d1:	29 f0                	sub    %esi,%eax
+  8009d3:	5b                   	pop    %ebx
+  8009d4:	5e                   	pop    %esi
+  8009d5:	5d                   	pop    %ebp
+  8009d6:	c3                   	ret
+
+008009d7 <strcmp>:
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e0:	0f b6 01             	movzbl (%ecx),%eax
+  8009e3:	84 c0                	test   %al,%al
+  8009e5:	74 11                	je     8009f8 <strcmp+0x21>
+  8009e7:	38 02                	cmp    %al,(%edx)
+  8009e9:	75 0d                	jne    8009f8 <strcmp+0x21>
+  8009eb:	83 c1 01             	add    $0x1,%ecx
+  8009ee:	83 c2 01             	add    $0x1,%edx
+  8009f1:	0f b6 01             	movzbl (%ecx),%eax
+  8009f4:	84 c0                	test   %al,%al
+  8009f6:	75 ef                	jne    8009e7 <strcmp+0x10>
+  8009f8:	0f b6 c0             	movzbl %al,%eax
+  8009fb:	0f b6 12             	movzbl (%edx),%edx
+  8009fe:	29 d0                	sub    %edx,%eax
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <strncmp>:
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	53                   	push   %ebx
+  800a06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a0c:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a14:	85 d2                	test   %edx,%edx
+  800a16:	74 2e                	je     800a46 <strncmp+0x44>
+  800a18:	0f b6 01             	movzbl (%ecx),%eax
+  800a1b:	84 c0                	test   %al,%al
+  800a1d:	74 16                	je     800a35 <strncmp+0x33>
+  800a1f:	3a 03                	cmp    (%ebx),%al
+  800a21:	75 12                	jne    800a35 <strncmp+0x33>
+  800a23:	83 c1 01             	add    $0x1,%ecx
+  800a26:	83 c3 01             	add    $0x1,%ebx
+  800a29:	83 ea 01             	sub    $0x1,%edx
+  800a2c:	75 ea                	jne    800a18 <strncmp+0x16>
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a33:	eb 11                	jmp    800a46 <strncmp+0x44>
+  800a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3a:	85 d2                	test   %edx,%edx
+  800a3c:	74 08                	je     800a46 <strncmp+0x44>
+  800a3e:	0f b6 01             	movzbl (%ecx),%eax
+  800a41:	0f b6 13             	movzbl (%ebx),%edx
+  800a44:	29 d0                	sub    %edx,%eax
+  800a46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a49:	c9                   	leave
+  800a4a:	c3                   	ret
+
+00800a4b <strchr>:
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a51:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a55:	0f b6 10             	movzbl (%eax),%edx
+  800a58:	84 d2                	test   %dl,%dl
+  800a5a:	74 15                	je     800a71 <strchr+0x26>
+  800a5c:	38 d1                	cmp    %dl,%cl
+  800a5e:	74 0f                	je     800a6f <strchr+0x24>
+  800a60:	83 c0 01             	add    $0x1,%eax
+  800a63:	0f b6 10             	movzbl (%eax),%edx
+  800a66:	84 d2                	test   %dl,%dl
+  800a68:	75 f2                	jne    800a5c <strchr+0x11>
+  800a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+  800a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a76:	eb f7                	jmp    800a6f <strchr+0x24>
+
+00800a78 <strfind>:
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	53                   	push   %ebx
+  800a7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a82:	0f b6 18             	movzbl (%eax),%ebx
+  800a85:	38 d3                	cmp    %dl,%bl
+  800a87:	74 14                	je     800a9d <strfind+0x25>
+  800a89:	89 d1                	mov    %edx,%ecx
+  800a8b:	84 db                	test   %bl,%bl
+  800a8d:	74 0e                	je     800a9d <strfind+0x25>
+  800a8f:	83 c0 01             	add    $0x1,%eax
+  800a92:	0f b6 10             	movzbl (%eax),%edx
+  800a95:	38 ca                	cmp    %cl,%dl
+  800a97:	74 04                	je     800a9d <strfind+0x25>
+  800a99:	84 d2                	test   %dl,%dl
+  800a9b:	75 f2                	jne    800a8f <strfind+0x17>
+  800a9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa0:	c9                   	leave
+  800aa1:	c3                   	ret
+
+00800aa2 <memset>:
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	57                   	push   %edi
+  800aa6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aa9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800aac:	85 c9                	test   %ecx,%ecx
+  800aae:	74 20                	je     800ad0 <memset+0x2e>
+  800ab0:	89 f8                	mov    %edi,%eax
+  800ab2:	09 c8                	or     %ecx,%eax
+  800ab4:	a8 03                	test   $0x3,%al
+  800ab6:	75 12                	jne    800aca <memset+0x28>
+  800ab8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800abc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ac2:	c1 e9 02             	shr    $0x2,%ecx
+  800ac5:	fc                   	cld
+  800ac6:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ac8:	eb 06                	jmp    800ad0 <memset+0x2e>
+  800aca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800acd:	fc                   	cld
+  800ace:	f3 aa                	rep stos %al,%es:(%edi)
+  800ad0:	89 f8                	mov    %edi,%eax
+  800ad2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ad5:	c9                   	leave
+  800ad6:	c3                   	ret
+
+00800ad7 <memmove>:
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	57                   	push   %edi
+  800adb:	56                   	push   %esi
+  800adc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800adf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ae2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ae5:	39 c6                	cmp    %eax,%esi
+  800ae7:	73 32                	jae    800b1b <memmove+0x44>
+  800ae9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aec:	39 d0                	cmp    %edx,%eax
+  800aee:	73 2b                	jae    800b1b <memmove+0x44>
+  800af0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800af3:	89 d6                	mov    %edx,%esi
+  800af5:	09 fe                	or     %edi,%esi
+  800af7:	09 ce                	or     %ecx,%esi
+  800af9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aff:	75 0e                	jne    800b0f <memmove+0x38>
+  800b01:	83 ef 04             	sub    $0x4,%edi
+  800b04:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b07:	c1 e9 02             	shr    $0x2,%ecx
+  800b0a:	fd                   	std
+  800b0b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b0d:	eb 09                	jmp    800b18 <memmove+0x41>
+  800b0f:	83 ef 01             	sub    $0x1,%edi
+  800b12:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b15:	fd                   	std
+  800b16:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b18:	fc                   	cld
+  800b19:	eb 1a                	jmp    800b35 <memmove+0x5e>
+  800b1b:	89 f2                	mov    %esi,%edx
+  800b1d:	09 c2                	or     %eax,%edx
+  800b1f:	09 ca                	or     %ecx,%edx
+  800b21:	f6 c2 03             	test   $0x3,%dl
+  800b24:	75 0a                	jne    800b30 <memmove+0x59>
+  800b26:	c1 e9 02             	shr    $0x2,%ecx
+  800b29:	89 c7                	mov    %eax,%edi
+  800b2b:	fc                   	cld
+  800b2c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b2e:	eb 05                	jmp    800b35 <memmove+0x5e>
+  800b30:	89 c7                	mov    %eax,%edi
+  800b32:	fc                   	cld
+  800b33:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b35:	5e                   	pop    %esi
+  800b36:	5f                   	pop    %edi
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+
+00800b39 <memcpy>:
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	83 ec 0c             	sub    $0xc,%esp
+  800b3f:	ff 75 10             	push   0x10(%ebp)
+  800b42:	ff 75 0c             	push   0xc(%ebp)
+  800b45:	ff 75 08             	push   0x8(%ebp)
+  800b48:	e8 8a ff ff ff       	call   800ad7 <memmove>
+  800b4d:	c9                   	leave
+  800b4e:	c3                   	ret
+
+00800b4f <memcmp>:
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	56                   	push   %esi
+  800b53:	53                   	push   %ebx
+  800b54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5a:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b5d:	85 f6                	test   %esi,%esi
+  800b5f:	74 29                	je     800b8a <memcmp+0x3b>
+  800b61:	01 c6                	add    %eax,%esi
+  800b63:	0f b6 08             	movzbl (%eax),%ecx
+  800b66:	0f b6 1a             	movzbl (%edx),%ebx
+  800b69:	38 d9                	cmp    %bl,%cl
+  800b6b:	75 11                	jne    800b7e <memcmp+0x2f>
+  800b6d:	83 c0 01             	add    $0x1,%eax
+  800b70:	83 c2 01             	add    $0x1,%edx
+  800b73:	39 c6                	cmp    %eax,%esi
+  800b75:	75 ec                	jne    800b63 <memcmp+0x14>
+  800b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7c:	eb 08                	jmp    800b86 <memcmp+0x37>
+  800b7e:	0f b6 c1             	movzbl %cl,%eax
+  800b81:	0f b6 db             	movzbl %bl,%ebx
+  800b84:	29 d8                	sub    %ebx,%eax
+  800b86:	5b                   	pop    %ebx
+  800b87:	5e                   	pop    %esi
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+  800b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8f:	eb f5                	jmp    800b86 <memcmp+0x37>
+
+00800b91 <memfind>:
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9a:	89 c2                	mov    %eax,%edx
+  800b9c:	03 55 10             	add    0x10(%ebp),%edx
+  800b9f:	39 d0                	cmp    %edx,%eax
+  800ba1:	73 0d                	jae    800bb0 <memfind+0x1f>
+  800ba3:	38 08                	cmp    %cl,(%eax)
+  800ba5:	74 0d                	je     800bb4 <memfind+0x23>
+  800ba7:	83 c0 01             	add    $0x1,%eax
+  800baa:	39 c2                	cmp    %eax,%edx
+  800bac:	75 f5                	jne    800ba3 <memfind+0x12>
+  800bae:	eb 06                	jmp    800bb6 <memfind+0x25>
+  800bb0:	89 c2                	mov    %eax,%edx
+  800bb2:	eb 02                	jmp    800bb6 <memfind+0x25>
+  800bb4:	89 c2                	mov    %eax,%edx
+  800bb6:	89 d0                	mov    %edx,%eax
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+
+00800bba <strtol>:
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	57                   	push   %edi
+  800bbe:	56                   	push   %esi
+  800bbf:	53                   	push   %ebx
+  800bc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc6:	0f b6 02             	movzbl (%edx),%eax
+  800bc9:	3c 20                	cmp    $0x20,%al
+  800bcb:	74 04                	je     800bd1 <strtol+0x17>
+  800bcd:	3c 09                	cmp    $0x9,%al
+  800bcf:	75 0e                	jne    800bdf <strtol+0x25>
+  800bd1:	83 c2 01             	add    $0x1,%edx
+  800bd4:	0f b6 02             	movzbl (%edx),%eax
+  800bd7:	3c 20                	cmp    $0x20,%al
+  800bd9:	74 f6                	je     800bd1 <strtol+0x17>
+  800bdb:	3c 09                	cmp    $0x9,%al
+  800bdd:	74 f2                	je     800bd1 <strtol+0x17>
+  800bdf:	3c 2b                	cmp    $0x2b,%al
+  800be1:	74 2a                	je     800c0d <strtol+0x53>
+  800be3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be8:	3c 2d                	cmp    $0x2d,%al
+  800bea:	74 2b                	je     800c17 <strtol+0x5d>
+  800bec:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bf2:	75 0f                	jne    800c03 <strtol+0x49>
+  800bf4:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bf7:	74 28                	je     800c21 <strtol+0x67>
+  800bf9:	85 db                	test   %ebx,%ebx
+  800bfb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c00:	0f 44 d8             	cmove  %eax,%ebx
+  800c03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c08:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c0b:	eb 46                	jmp    800c53 <strtol+0x99>
+  800c0d:	83 c2 01             	add    $0x1,%edx
+  800c10:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c15:	eb d5                	jmp    800bec <strtol+0x32>
+  800c17:	83 c2 01             	add    $0x1,%edx
+  800c1a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c1f:	eb cb                	jmp    800bec <strtol+0x32>
+  800c21:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c25:	74 0e                	je     800c35 <strtol+0x7b>
+  800c27:	85 db                	test   %ebx,%ebx
+  800c29:	75 d8                	jne    800c03 <strtol+0x49>
+  800c2b:	83 c2 01             	add    $0x1,%edx
+  800c2e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c33:	eb ce                	jmp    800c03 <strtol+0x49>
+  800c35:	83 c2 02             	add    $0x2,%edx
+  800c38:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c3d:	eb c4                	jmp    800c03 <strtol+0x49>
+  800c3f:	0f be c0             	movsbl %al,%eax
+  800c42:	83 e8 30             	sub    $0x30,%eax
+  800c45:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c48:	7d 3a                	jge    800c84 <strtol+0xca>
+  800c4a:	83 c2 01             	add    $0x1,%edx
+  800c4d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c51:	01 c1                	add    %eax,%ecx
+  800c53:	0f b6 02             	movzbl (%edx),%eax
+  800c56:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c59:	89 f3                	mov    %esi,%ebx
+  800c5b:	80 fb 09             	cmp    $0x9,%bl
+  800c5e:	76 df                	jbe    800c3f <strtol+0x85>
+  800c60:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c63:	89 f3                	mov    %esi,%ebx
+  800c65:	80 fb 19             	cmp    $0x19,%bl
+  800c68:	77 08                	ja     800c72 <strtol+0xb8>
+  800c6a:	0f be c0             	movsbl %al,%eax
+  800c6d:	83 e8 57             	sub    $0x57,%eax
+  800c70:	eb d3                	jmp    800c45 <strtol+0x8b>
+  800c72:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c75:	89 f3                	mov    %esi,%ebx
+  800c77:	80 fb 19             	cmp    $0x19,%bl
+  800c7a:	77 08                	ja     800c84 <strtol+0xca>
+  800c7c:	0f be c0             	movsbl %al,%eax
+  800c7f:	83 e8 37             	sub    $0x37,%eax
+  800c82:	eb c1                	jmp    800c45 <strtol+0x8b>
+  800c84:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c88:	74 05                	je     800c8f <strtol+0xd5>
+  800c8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c8d:	89 10                	mov    %edx,(%eax)
+  800c8f:	89 c8                	mov    %ecx,%eax
+  800c91:	f7 d8                	neg    %eax
+  800c93:	85 ff                	test   %edi,%edi
+  800c95:	0f 45 c8             	cmovne %eax,%ecx
+  800c98:	89 c8                	mov    %ecx,%eax
+  800c9a:	5b                   	pop    %ebx
+  800c9b:	5e                   	pop    %esi
+  800c9c:	5f                   	pop    %edi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+
+00800c9f <sys_cputs>:
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	57                   	push   %edi
+  800ca3:	56                   	push   %esi
+  800ca4:	53                   	push   %ebx
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb0:	89 c3                	mov    %eax,%ebx
+  800cb2:	89 c7                	mov    %eax,%edi
+  800cb4:	89 c6                	mov    %eax,%esi
+  800cb6:	cd 30                	int    $0x30
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5f                   	pop    %edi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+
+00800cbd <sys_cgetc>:
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	57                   	push   %edi
+  800cc1:	56                   	push   %esi
+  800cc2:	53                   	push   %ebx
+  800cc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ccd:	89 d1                	mov    %edx,%ecx
+  800ccf:	89 d3                	mov    %edx,%ebx
+  800cd1:	89 d7                	mov    %edx,%edi
+  800cd3:	89 d6                	mov    %edx,%esi
+  800cd5:	cd 30                	int    $0x30
+  800cd7:	5b                   	pop    %ebx
+  800cd8:	5e                   	pop    %esi
+  800cd9:	5f                   	pop    %edi
+  800cda:	5d                   	pop    %ebp
+  800cdb:	c3                   	ret
+
+00800cdc <sys_env_destroy>:
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	57                   	push   %edi
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+  800ce2:	83 ec 0c             	sub    $0xc,%esp
+  800ce5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ced:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf2:	89 cb                	mov    %ecx,%ebx
+  800cf4:	89 cf                	mov    %ecx,%edi
+  800cf6:	89 ce                	mov    %ecx,%esi
+  800cf8:	cd 30                	int    $0x30
+  800cfa:	85 c0                	test   %eax,%eax
+  800cfc:	7f 08                	jg     800d06 <sys_env_destroy+0x2a>
+  800cfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d01:	5b                   	pop    %ebx
+  800d02:	5e                   	pop    %esi
+  800d03:	5f                   	pop    %edi
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+  800d09:	50                   	push   %eax
+  800d0a:	6a 03                	push   $0x3
+  800d0c:	68 eb 35 80 00       	push   $0x8035eb
+  800d11:	6a 24                	push   $0x24
+  800d13:	68 08 36 80 00       	push   $0x803608
+  800d18:	e8 38 f4 ff ff       	call   800155 <_panic>
+
+00800d1d <sys_getenvid>:
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+  800d23:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d28:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d2d:	89 d1                	mov    %edx,%ecx
+  800d2f:	89 d3                	mov    %edx,%ebx
+  800d31:	89 d7                	mov    %edx,%edi
+  800d33:	89 d6                	mov    %edx,%esi
+  800d35:	cd 30                	int    $0x30
+  800d37:	5b                   	pop    %ebx
+  800d38:	5e                   	pop    %esi
+  800d39:	5f                   	pop    %edi
+  800d3a:	5d                   	pop    %ebp
+  800d3b:	c3                   	ret
+
+00800d3c <sys_yield>:
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d49:	74 26                	je     800d71 <sys_yield+0x35>
+  800d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d50:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d55:	89 d1                	mov    %edx,%ecx
+  800d57:	89 d3                	mov    %edx,%ebx
+  800d59:	89 d7                	mov    %edx,%edi
+  800d5b:	6a 00                	push   $0x0
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	8d 35 68 0d 80 00    	lea    0x800d68,%esi
+  800d66:	0f 34                	sysenter
+  800d68:	5d                   	pop    %ebp
+  800d69:	83 c4 04             	add    $0x4,%esp
+  800d6c:	5b                   	pop    %ebx
+  800d6d:	5e                   	pop    %esi
+  800d6e:	5f                   	pop    %edi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+  800d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d76:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d7b:	89 d1                	mov    %edx,%ecx
+  800d7d:	89 d3                	mov    %edx,%ebx
+  800d7f:	89 d7                	mov    %edx,%edi
+  800d81:	89 d6                	mov    %edx,%esi
+  800d83:	cd 30                	int    $0x30
+  800d85:	eb e5                	jmp    800d6c <sys_yield+0x30>
+
+00800d87 <sys_page_alloc>:
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  800d90:	be 00 00 00 00       	mov    $0x0,%esi
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da3:	89 f7                	mov    %esi,%edi
+  800da5:	cd 30                	int    $0x30
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	7f 08                	jg     800db3 <sys_page_alloc+0x2c>
+  800dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+  800db3:	83 ec 0c             	sub    $0xc,%esp
+  800db6:	50                   	push   %eax
+  800db7:	6a 04                	push   $0x4
+  800db9:	68 eb 35 80 00       	push   $0x8035eb
+  800dbe:	6a 24                	push   $0x24
+  800dc0:	68 08 36 80 00       	push   $0x803608
+  800dc5:	e8 8b f3 ff ff       	call   800155 <_panic>
+
+00800dca <sys_page_map>:
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800dda:	74 33                	je     800e0f <sys_page_map+0x45>
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800de7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ded:	ff 75 18             	push   0x18(%ebp)
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	8d 35 fb 0d 80 00    	lea    0x800dfb,%esi
+  800df9:	0f 34                	sysenter
+  800dfb:	5d                   	pop    %ebp
+  800dfc:	83 c4 04             	add    $0x4,%esp
+  800dff:	89 c2                	mov    %eax,%edx
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	7f 3d                	jg     800e42 <sys_page_map+0x78>
+  800e05:	89 d0                	mov    %edx,%eax
+  800e07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0a:	5b                   	pop    %ebx
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5f                   	pop    %edi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+  800e0f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e20:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e23:	cd 30                	int    $0x30
+  800e25:	89 c2                	mov    %eax,%edx
+  800e27:	85 c0                	test   %eax,%eax
+  800e29:	7e da                	jle    800e05 <sys_page_map+0x3b>
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+  800e2e:	50                   	push   %eax
+  800e2f:	6a 05                	push   $0x5
+  800e31:	68 eb 35 80 00       	push   $0x8035eb
+  800e36:	6a 24                	push   $0x24
+  800e38:	68 08 36 80 00       	push   $0x803608
+  800e3d:	e8 13 f3 ff ff       	call   800155 <_panic>
+  800e42:	83 ec 0c             	sub    $0xc,%esp
+  800e45:	50                   	push   %eax
+  800e46:	6a 05                	push   $0x5
+  800e48:	68 eb 35 80 00       	push   $0x8035eb
+  800e4d:	6a 48                	push   $0x48
+  800e4f:	68 08 36 80 00       	push   $0x803608
+  800e54:	e8 fc f2 ff ff       	call   800155 <_panic>
+
+00800e59 <sys_page_unmap>:
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	57                   	push   %edi
+  800e5d:	56                   	push   %esi
+  800e5e:	53                   	push   %ebx
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e72:	89 df                	mov    %ebx,%edi
+  800e74:	89 de                	mov    %ebx,%esi
+  800e76:	cd 30                	int    $0x30
+  800e78:	85 c0                	test   %eax,%eax
+  800e7a:	7f 08                	jg     800e84 <sys_page_unmap+0x2b>
+  800e7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7f:	5b                   	pop    %ebx
+  800e80:	5e                   	pop    %esi
+  800e81:	5f                   	pop    %edi
+  800e82:	5d                   	pop    %ebp
+  800e83:	c3                   	ret
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+  800e87:	50                   	push   %eax
+  800e88:	6a 06                	push   $0x6
+  800e8a:	68 eb 35 80 00       	push   $0x8035eb
+  800e8f:	6a 24                	push   $0x24
+  800e91:	68 08 36 80 00       	push   $0x803608
+  800e96:	e8 ba f2 ff ff       	call   800155 <_panic>
+
+00800e9b <sys_fork>:
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	57                   	push   %edi
+  800e9f:	56                   	push   %esi
+  800ea0:	53                   	push   %ebx
+  800ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800eab:	89 d1                	mov    %edx,%ecx
+  800ead:	89 d3                	mov    %edx,%ebx
+  800eaf:	89 d7                	mov    %edx,%edi
+  800eb1:	89 d6                	mov    %edx,%esi
+  800eb3:	cd 30                	int    $0x30
+  800eb5:	5b                   	pop    %ebx
+  800eb6:	5e                   	pop    %esi
+  800eb7:	5f                   	pop    %edi
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+
+00800eba <sys_env_set_status>:
+  800eba:	55                   	push   %ebp
+  800ebb:	89 e5                	mov    %esp,%ebp
+  800ebd:	57                   	push   %edi
+  800ebe:	56                   	push   %esi
+  800ebf:	53                   	push   %ebx
+  800ec0:	83 ec 0c             	sub    $0xc,%esp
+  800ec3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ece:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ed3:	89 df                	mov    %ebx,%edi
+  800ed5:	89 de                	mov    %ebx,%esi
+  800ed7:	cd 30                	int    $0x30
+  800ed9:	85 c0                	test   %eax,%eax
+  800edb:	7f 08                	jg     800ee5 <sys_env_set_status+0x2b>
+  800edd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee0:	5b                   	pop    %ebx
+  800ee1:	5e                   	pop    %esi
+  800ee2:	5f                   	pop    %edi
+  800ee3:	5d                   	pop    %ebp
+  800ee4:	c3                   	ret
+  800ee5:	83 ec 0c             	sub    $0xc,%esp
+  800ee8:	50                   	push   %eax
+  800ee9:	6a 08                	push   $0x8
+  800eeb:	68 eb 35 80 00       	push   $0x8035eb
+  800ef0:	6a 24                	push   $0x24
+  800ef2:	68 08 36 80 00       	push   $0x803608
+  800ef7:	e8 59 f2 ff ff       	call   800155 <_panic>
+
+00800efc <sys_env_set_trapframe>:
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	57                   	push   %edi
+  800f00:	56                   	push   %esi
+  800f01:	53                   	push   %ebx
+  800f02:	83 ec 0c             	sub    $0xc,%esp
+  800f05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f10:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f15:	89 df                	mov    %ebx,%edi
+  800f17:	89 de                	mov    %ebx,%esi
+  800f19:	cd 30                	int    $0x30
+  800f1b:	85 c0                	test   %eax,%eax
+  800f1d:	7f 08                	jg     800f27 <sys_env_set_trapframe+0x2b>
+  800f1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f22:	5b                   	pop    %ebx
+  800f23:	5e                   	pop    %esi
+  800f24:	5f                   	pop    %edi
+  800f25:	5d                   	pop    %ebp
+  800f26:	c3                   	ret
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+  800f2a:	50                   	push   %eax
+  800f2b:	6a 09                	push   $0x9
+  800f2d:	68 eb 35 80 00       	push   $0x8035eb
+  800f32:	6a 24                	push   $0x24
+  800f34:	68 08 36 80 00       	push   $0x803608
+  800f39:	e8 17 f2 ff ff       	call   800155 <_panic>
+
+00800f3e <sys_env_set_cow>:
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+  800f44:	83 ec 0c             	sub    $0xc,%esp
+  800f47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f52:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f57:	89 df                	mov    %ebx,%edi
+  800f59:	89 de                	mov    %ebx,%esi
+  800f5b:	cd 30                	int    $0x30
+  800f5d:	85 c0                	test   %eax,%eax
+  800f5f:	7f 08                	jg     800f69 <sys_env_set_cow+0x2b>
+  800f61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+  800f69:	83 ec 0c             	sub    $0xc,%esp
+  800f6c:	50                   	push   %eax
+  800f6d:	6a 20                	push   $0x20
+  800f6f:	68 eb 35 80 00       	push   $0x8035eb
+  800f74:	6a 24                	push   $0x24
+  800f76:	68 08 36 80 00       	push   $0x803608
+  800f7b:	e8 d5 f1 ff ff       	call   800155 <_panic>
+
+00800f80 <sys_env_service>:
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	57                   	push   %edi
+  800f84:	56                   	push   %esi
+  800f85:	53                   	push   %ebx
+  800f86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8e:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f93:	89 cb                	mov    %ecx,%ebx
+  800f95:	89 cf                	mov    %ecx,%edi
+  800f97:	89 ce                	mov    %ecx,%esi
+  800f99:	cd 30                	int    $0x30
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+
+00800fa0 <sys_env_set_pgfault_upcall>:
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  800fa6:	83 ec 0c             	sub    $0xc,%esp
+  800fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fb9:	89 df                	mov    %ebx,%edi
+  800fbb:	89 de                	mov    %ebx,%esi
+  800fbd:	cd 30                	int    $0x30
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	7f 08                	jg     800fcb <sys_env_set_pgfault_upcall+0x2b>
+  800fc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc6:	5b                   	pop    %ebx
+  800fc7:	5e                   	pop    %esi
+  800fc8:	5f                   	pop    %edi
+  800fc9:	5d                   	pop    %ebp
+  800fca:	c3                   	ret
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+  800fce:	50                   	push   %eax
+  800fcf:	6a 0a                	push   $0xa
+  800fd1:	68 eb 35 80 00       	push   $0x8035eb
+  800fd6:	6a 24                	push   $0x24
+  800fd8:	68 08 36 80 00       	push   $0x803608
+  800fdd:	e8 73 f1 ff ff       	call   800155 <_panic>
+
+00800fe2 <sys_ipc_try_send>:
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	57                   	push   %edi
+  800fe6:	56                   	push   %esi
+  800fe7:	53                   	push   %ebx
+  800fe8:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fef:	74 27                	je     801018 <sys_ipc_try_send+0x36>
+  800ff1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ffc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801002:	6a 00                	push   $0x0
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	8d 35 0f 10 80 00    	lea    0x80100f,%esi
+  80100d:	0f 34                	sysenter
+  80100f:	5d                   	pop    %ebp
+  801010:	83 c4 04             	add    $0x4,%esp
+  801013:	5b                   	pop    %ebx
+  801014:	5e                   	pop    %esi
+  801015:	5f                   	pop    %edi
+  801016:	5d                   	pop    %ebp
+  801017:	c3                   	ret
+  801018:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80101d:	be 00 00 00 00       	mov    $0x0,%esi
+  801022:	8b 55 08             	mov    0x8(%ebp),%edx
+  801025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801028:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80102e:	cd 30                	int    $0x30
+  801030:	eb e1                	jmp    801013 <sys_ipc_try_send+0x31>
+
+00801032 <sys_ipc_recv>:
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	57                   	push   %edi
+  801036:	56                   	push   %esi
+  801037:	53                   	push   %ebx
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801042:	74 32                	je     801076 <sys_ipc_recv+0x44>
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801051:	89 cb                	mov    %ecx,%ebx
+  801053:	89 cf                	mov    %ecx,%edi
+  801055:	6a 00                	push   $0x0
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	8d 35 62 10 80 00    	lea    0x801062,%esi
+  801060:	0f 34                	sysenter
+  801062:	5d                   	pop    %ebp
+  801063:	83 c4 04             	add    $0x4,%esp
+  801066:	89 c2                	mov    %eax,%edx
+  801068:	85 c0                	test   %eax,%eax
+  80106a:	7f 3c                	jg     8010a8 <sys_ipc_recv+0x76>
+  80106c:	89 d0                	mov    %edx,%eax
+  80106e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801071:	5b                   	pop    %ebx
+  801072:	5e                   	pop    %esi
+  801073:	5f                   	pop    %edi
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+  801076:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80107b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	89 cb                	mov    %ecx,%ebx
+  801085:	89 cf                	mov    %ecx,%edi
+  801087:	89 ce                	mov    %ecx,%esi
+  801089:	cd 30                	int    $0x30
+  80108b:	89 c2                	mov    %eax,%edx
+  80108d:	85 c0                	test   %eax,%eax
+  80108f:	7e db                	jle    80106c <sys_ipc_recv+0x3a>
+  801091:	83 ec 0c             	sub    $0xc,%esp
+  801094:	50                   	push   %eax
+  801095:	6a 0d                	push   $0xd
+  801097:	68 eb 35 80 00       	push   $0x8035eb
+  80109c:	6a 24                	push   $0x24
+  80109e:	68 08 36 80 00       	push   $0x803608
+  8010a3:	e8 ad f0 ff ff       	call   800155 <_panic>
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	50                   	push   %eax
+  8010ac:	6a 0d                	push   $0xd
+  8010ae:	68 eb 35 80 00       	push   $0x8035eb
+  8010b3:	6a 48                	push   $0x48
+  8010b5:	68 08 36 80 00       	push   $0x803608
+  8010ba:	e8 96 f0 ff ff       	call   800155 <_panic>
+
+008010bf <sys_ipc_send>:
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	57                   	push   %edi
+  8010c3:	56                   	push   %esi
+  8010c4:	53                   	push   %ebx
+  8010c5:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010cc:	74 27                	je     8010f5 <sys_ipc_send+0x36>
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010df:	6a 00                	push   $0x0
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	8d 35 ec 10 80 00    	lea    0x8010ec,%esi
+  8010ea:	0f 34                	sysenter
+  8010ec:	5d                   	pop    %ebp
+  8010ed:	83 c4 04             	add    $0x4,%esp
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5e                   	pop    %esi
+  8010f2:	5f                   	pop    %edi
+  8010f3:	5d                   	pop    %ebp
+  8010f4:	c3                   	ret
+  8010f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801102:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801105:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801108:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80110b:	cd 30                	int    $0x30
+  80110d:	eb e1                	jmp    8010f0 <sys_ipc_send+0x31>
+
+0080110f <sys_ipc_call>:
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+  801112:	57                   	push   %edi
+  801113:	56                   	push   %esi
+  801114:	53                   	push   %ebx
+  801115:	8b 55 08             	mov    0x8(%ebp),%edx
+  801118:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801123:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801126:	8b 75 18             	mov    0x18(%ebp),%esi
+  801129:	cd 30                	int    $0x30
+  80112b:	5b                   	pop    %ebx
+  80112c:	5e                   	pop    %esi
+  80112d:	5f                   	pop    %edi
+  80112e:	5d                   	pop    %ebp
+  80112f:	c3                   	ret
+
+00801130 <sys_ipc_reply_recv>:
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	57                   	push   %edi
+  801134:	56                   	push   %esi
+  801135:	53                   	push   %ebx
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801141:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801144:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801147:	8b 75 18             	mov    0x18(%ebp),%esi
+  80114a:	cd 30                	int    $0x30
+  80114c:	5b                   	pop    %ebx
+  80114d:	5e                   	pop    %esi
+  80114e:	5f                   	pop    %edi
+  80114f:	5d                   	pop    %ebp
+  801150:	c3                   	ret
+
+00801151 <sys_time_msec>:
+  801151:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801156:	85 c0                	test   %eax,%eax
+  801158:	75 06                	jne    801160 <sys_time_msec+0xf>
+  80115a:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80115f:	c3                   	ret
+  801160:	55                   	push   %ebp
+  801161:	89 e5                	mov    %esp,%ebp
+  801163:	57                   	push   %edi
+  801164:	56                   	push   %esi
+  801165:	53                   	push   %ebx
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  801169:	0f 31                	rdtsc
+  80116b:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801171:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801177:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80117d:	29 c8                	sub    %ecx,%eax
+  80117f:	19 da                	sbb    %ebx,%edx
+  801181:	bf 00 00 00 00       	mov    $0x0,%edi
+  801186:	57                   	push   %edi
+  801187:	56                   	push   %esi
+  801188:	52                   	push   %edx
+  801189:	50                   	push   %eax
+  80118a:	e8 4b 1f 00 00       	call   8030da <__udivdi3>
+  80118f:	83 c4 10             	add    $0x10,%esp
+  801192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_env_swap>:
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  8011a0:	83 ec 0c             	sub    $0xc,%esp
+  8011a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011b0:	89 cb                	mov    %ecx,%ebx
+  8011b2:	89 cf                	mov    %ecx,%edi
+  8011b4:	89 ce                	mov    %ecx,%esi
+  8011b6:	cd 30                	int    $0x30
+  8011b8:	85 c0                	test   %eax,%eax
+  8011ba:	7f 08                	jg     8011c4 <sys_env_swap+0x2a>
+  8011bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bf:	5b                   	pop    %ebx
+  8011c0:	5e                   	pop    %esi
+  8011c1:	5f                   	pop    %edi
+  8011c2:	5d                   	pop    %ebp
+  8011c3:	c3                   	ret
+  8011c4:	83 ec 0c             	sub    $0xc,%esp
+  8011c7:	50                   	push   %eax
+  8011c8:	6a 12                	push   $0x12
+  8011ca:	68 eb 35 80 00       	push   $0x8035eb
+  8011cf:	6a 24                	push   $0x24
+  8011d1:	68 08 36 80 00       	push   $0x803608
+  8011d6:	e8 7a ef ff ff       	call   800155 <_panic>
+
+008011db <sys_net_try_send>:
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  8011e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ef:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011f4:	89 df                	mov    %ebx,%edi
+  8011f6:	89 de                	mov    %ebx,%esi
+  8011f8:	cd 30                	int    $0x30
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	7f 08                	jg     801206 <sys_net_try_send+0x2b>
+  8011fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	50                   	push   %eax
+  80120a:	6a 13                	push   $0x13
+  80120c:	68 eb 35 80 00       	push   $0x8035eb
+  801211:	6a 24                	push   $0x24
+  801213:	68 08 36 80 00       	push   $0x803608
+  801218:	e8 38 ef ff ff       	call   800155 <_panic>
+
+0080121d <sys_net_try_receive>:
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+  801223:	83 ec 0c             	sub    $0xc,%esp
+  801226:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801231:	b8 14 00 00 00       	mov    $0x14,%eax
+  801236:	89 df                	mov    %ebx,%edi
+  801238:	89 de                	mov    %ebx,%esi
+  80123a:	cd 30                	int    $0x30
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	7f 08                	jg     801248 <sys_net_try_receive+0x2b>
+  801240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	50                   	push   %eax
+  80124c:	6a 14                	push   $0x14
+  80124e:	68 eb 35 80 00       	push   $0x8035eb
+  801253:	6a 24                	push   $0x24
+  801255:	68 08 36 80 00       	push   $0x803608
+  80125a:	e8 f6 ee ff ff       	call   800155 <_panic>
+
+0080125f <sys_net_recv_page>:
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	57                   	push   %edi
+  801263:	56                   	push   %esi
+  801264:	53                   	push   %ebx
+  801265:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126d:	b8 27 00 00 00       	mov    $0x27,%eax
+  801272:	89 cb                	mov    %ecx,%ebx
+  801274:	89 cf                	mov    %ecx,%edi
+  801276:	89 ce                	mov    %ecx,%esi
+  801278:	cd 30                	int    $0x30
+  80127a:	5b                   	pop    %ebx
+  80127b:	5e                   	pop    %esi
+  80127c:	5f                   	pop    %edi
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+
+0080127f <sys_net_wait>:
+  80127f:	55                   	push   %ebp
+  801280:	89 e5                	mov    %esp,%ebp
+  801282:	57                   	push   %edi
+  801283:	56                   	push   %esi
+  801284:	53                   	push   %ebx
+  801285:	ba 00 00 00 00       	mov    $0x0,%edx
+  80128a:	b8 26 00 00 00       	mov    $0x26,%eax
+  80128f:	89 d1                	mov    %edx,%ecx
+  801291:	89 d3                	mov    %edx,%ebx
+  801293:	89 d7                	mov    %edx,%edi
+  801295:	89 d6                	mov    %edx,%esi
+  801297:	cd 30                	int    $0x30
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5f                   	pop    %edi
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+
+0080129e <sys_get_mac>:
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	57                   	push   %edi
+  8012a2:	56                   	push   %esi
+  8012a3:	53                   	push   %ebx
+  8012a4:	83 ec 0c             	sub    $0xc,%esp
+  8012a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012b7:	89 df                	mov    %ebx,%edi
+  8012b9:	89 de                	mov    %ebx,%esi
+  8012bb:	cd 30                	int    $0x30
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	7f 08                	jg     8012c9 <sys_get_mac+0x2b>
+  8012c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c4:	5b                   	pop    %ebx
+  8012c5:	5e                   	pop    %esi
+  8012c6:	5f                   	pop    %edi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	c3                   	ret
+  8012c9:	83 ec 0c             	sub    $0xc,%esp
+  8012cc:	50                   	push   %eax
+  8012cd:	6a 15                	push   $0x15
+  8012cf:	68 eb 35 80 00       	push   $0x8035eb
+  8012d4:	6a 24                	push   $0x24
+  8012d6:	68 08 36 80 00       	push   $0x803608
+  8012db:	e8 75 ee ff ff       	call   800155 <_panic>
+
+008012e0 <sys_env_lease>:
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	57                   	push   %edi
+  8012e4:	56                   	push   %esi
+  8012e5:	53                   	push   %ebx
+  8012e6:	83 ec 0c             	sub    $0xc,%esp
+  8012e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012f9:	89 df                	mov    %ebx,%edi
+  8012fb:	89 de                	mov    %ebx,%esi
+  8012fd:	cd 30                	int    $0x30
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	7f 08                	jg     80130b <sys_env_lease+0x2b>
+  801303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+  80130b:	83 ec 0c             	sub    $0xc,%esp
+  80130e:	50                   	push   %eax
+  80130f:	6a 16                	push   $0x16
+  801311:	68 eb 35 80 00       	push   $0x8035eb
+  801316:	6a 24                	push   $0x24
+  801318:	68 08 36 80 00       	push   $0x803608
+  80131d:	e8 33 ee ff ff       	call   800155 <_panic>
+
+00801322 <sys_copy_mem>:
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	57                   	push   %edi
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+  801328:	83 ec 0c             	sub    $0xc,%esp
+  80132b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801331:	b8 17 00 00 00       	mov    $0x17,%eax
+  801336:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801339:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80133f:	cd 30                	int    $0x30
+  801341:	85 c0                	test   %eax,%eax
+  801343:	7f 08                	jg     80134d <sys_copy_mem+0x2b>
+  801345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5f                   	pop    %edi
+  80134b:	5d                   	pop    %ebp
+  80134c:	c3                   	ret
+  80134d:	83 ec 0c             	sub    $0xc,%esp
+  801350:	50                   	push   %eax
+  801351:	6a 17                	push   $0x17
+  801353:	68 eb 35 80 00       	push   $0x8035eb
+  801358:	6a 24                	push   $0x24
+  80135a:	68 08 36 80 00       	push   $0x803608
+  80135f:	e8 f1 ed ff ff       	call   800155 <_panic>
+
+00801364 <sys_get_perms>:
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	57                   	push   %edi
+  801368:	56                   	push   %esi
+  801369:	53                   	push   %ebx
+  80136a:	83 ec 0c             	sub    $0xc,%esp
+  80136d:	be 00 00 00 00       	mov    $0x0,%esi
+  801372:	8b 55 08             	mov    0x8(%ebp),%edx
+  801375:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801378:	b8 18 00 00 00       	mov    $0x18,%eax
+  80137d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801380:	89 f7                	mov    %esi,%edi
+  801382:	cd 30                	int    $0x30
+  801384:	85 c0                	test   %eax,%eax
+  801386:	7f 08                	jg     801390 <sys_get_perms+0x2c>
+  801388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+  801390:	83 ec 0c             	sub    $0xc,%esp
+  801393:	50                   	push   %eax
+  801394:	6a 18                	push   $0x18
+  801396:	68 eb 35 80 00       	push   $0x8035eb
+  80139b:	6a 24                	push   $0x24
+  80139d:	68 08 36 80 00       	push   $0x803608
+  8013a2:	e8 ae ed ff ff       	call   800155 <_panic>
+
+008013a7 <sys_env_unsuspend>:
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	57                   	push   %edi
+  8013ab:	56                   	push   %esi
+  8013ac:	53                   	push   %ebx
+  8013ad:	83 ec 0c             	sub    $0xc,%esp
+  8013b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bb:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c3:	89 f7                	mov    %esi,%edi
+  8013c5:	cd 30                	int    $0x30
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	7f 08                	jg     8013d3 <sys_env_unsuspend+0x2c>
+  8013cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5e                   	pop    %esi
+  8013d0:	5f                   	pop    %edi
+  8013d1:	5d                   	pop    %ebp
+  8013d2:	c3                   	ret
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	50                   	push   %eax
+  8013d7:	6a 19                	push   $0x19
+  8013d9:	68 eb 35 80 00       	push   $0x8035eb
+  8013de:	6a 24                	push   $0x24
+  8013e0:	68 08 36 80 00       	push   $0x803608
+  8013e5:	e8 6b ed ff ff       	call   800155 <_panic>
+
+008013ea <sys_migrate>:
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	57                   	push   %edi
+  8013ee:	56                   	push   %esi
+  8013ef:	53                   	push   %ebx
+  8013f0:	83 ec 0c             	sub    $0xc,%esp
+  8013f3:	ba 00 80 c0 00       	mov    $0xc08000,%edx
+  8013f8:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8013fe:	76 11                	jbe    801411 <sys_migrate+0x27>
+  801400:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801405:	0f b6 08             	movzbl (%eax),%ecx
+  801408:	05 00 10 00 00       	add    $0x1000,%eax
+  80140d:	39 d0                	cmp    %edx,%eax
+  80140f:	72 f4                	jb     801405 <sys_migrate+0x1b>
+  801411:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801416:	8b 55 08             	mov    0x8(%ebp),%edx
+  801419:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80141e:	89 cb                	mov    %ecx,%ebx
+  801420:	89 cf                	mov    %ecx,%edi
+  801422:	89 ce                	mov    %ecx,%esi
+  801424:	cd 30                	int    $0x30
+  801426:	85 c0                	test   %eax,%eax
+  801428:	7f 08                	jg     801432 <sys_migrate+0x48>
+  80142a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142d:	5b                   	pop    %ebx
+  80142e:	5e                   	pop    %esi
+  80142f:	5f                   	pop    %edi
+  801430:	5d                   	pop    %ebp
+  801431:	c3                   	ret
+  801432:	83 ec 0c             	sub    $0xc,%esp
+  801435:	50                   	push   %eax
+  801436:	6a 1a                	push   $0x1a
+  801438:	68 eb 35 80 00       	push   $0x8035eb
+  80143d:	6a 24                	push   $0x24
+  80143f:	68 08 36 80 00       	push   $0x803608
+  801444:	e8 0c ed ff ff       	call   800155 <_panic>
+
+00801449 <sys_lease_complete>:
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	57                   	push   %edi
+  80144d:	56                   	push   %esi
+  80144e:	53                   	push   %ebx
+  80144f:	83 ec 0c             	sub    $0xc,%esp
+  801452:	ba 00 00 00 00       	mov    $0x0,%edx
+  801457:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80145c:	89 d1                	mov    %edx,%ecx
+  80145e:	89 d3                	mov    %edx,%ebx
+  801460:	89 d7                	mov    %edx,%edi
+  801462:	89 d6                	mov    %edx,%esi
+  801464:	cd 30                	int    $0x30
+  801466:	85 c0                	test   %eax,%eax
+  801468:	7f 08                	jg     801472 <sys_lease_complete+0x29>
+  80146a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146d:	5b                   	pop    %ebx
+  80146e:	5e                   	pop    %esi
+  80146f:	5f                   	pop    %edi
+  801470:	5d                   	pop    %ebp
+  801471:	c3                   	ret
+  801472:	83 ec 0c             	sub    $0xc,%esp
+  801475:	50                   	push   %eax
+  801476:	6a 1b                	push   $0x1b
+  801478:	68 eb 35 80 00       	push   $0x8035eb
+  80147d:	6a 24                	push   $0x24
+  80147f:	68 08 36 80 00       	push   $0x803608
+  801484:	e8 cc ec ff ff       	call   800155 <_panic>
+
+00801489 <sys_env_set_thisenv>:
+  801489:	55                   	push   %ebp
+  80148a:	89 e5                	mov    %esp,%ebp
+  80148c:	57                   	push   %edi
+  80148d:	56                   	push   %esi
+  80148e:	53                   	push   %ebx
+  80148f:	83 ec 0c             	sub    $0xc,%esp
+  801492:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801497:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014a2:	89 df                	mov    %ebx,%edi
+  8014a4:	89 de                	mov    %ebx,%esi
+  8014a6:	cd 30                	int    $0x30
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	7f 08                	jg     8014b4 <sys_env_set_thisenv+0x2b>
+  8014ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014af:	5b                   	pop    %ebx
+  8014b0:	5e                   	pop    %esi
+  8014b1:	5f                   	pop    %edi
+  8014b2:	5d                   	pop    %ebp
+  8014b3:	c3                   	ret
+  8014b4:	83 ec 0c             	sub    $0xc,%esp
+  8014b7:	50                   	push   %eax
+  8014b8:	6a 1c                	push   $0x1c
+  8014ba:	68 eb 35 80 00       	push   $0x8035eb
+  8014bf:	6a 24                	push   $0x24
+  8014c1:	68 08 36 80 00       	push   $0x803608
+  8014c6:	e8 8a ec ff ff       	call   800155 <_panic>
+
+008014cb <sys_env_set_sched>:
+  8014cb:	55                   	push   %ebp
+  8014cc:	89 e5                	mov    %esp,%ebp
+  8014ce:	57                   	push   %edi
+  8014cf:	56                   	push   %esi
+  8014d0:	53                   	push   %ebx
+  8014d1:	83 ec 0c             	sub    $0xc,%esp
+  8014d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014df:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e7:	89 f7                	mov    %esi,%edi
+  8014e9:	cd 30                	int    $0x30
+  8014eb:	85 c0                	test   %eax,%eax
+  8014ed:	7f 08                	jg     8014f7 <sys_env_set_sched+0x2c>
+  8014ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f2:	5b                   	pop    %ebx
+  8014f3:	5e                   	pop    %esi
+  8014f4:	5f                   	pop    %edi
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	50                   	push   %eax
+  8014fb:	6a 1d                	push   $0x1d
+  8014fd:	68 eb 35 80 00       	push   $0x8035eb
+  801502:	6a 24                	push   $0x24
+  801504:	68 08 36 80 00       	push   $0x803608
+  801509:	e8 47 ec ff ff       	call   800155 <_panic>
+
+0080150e <sys_batch>:
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+  801511:	57                   	push   %edi
+  801512:	56                   	push   %esi
+  801513:	53                   	push   %ebx
+  801514:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801519:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801524:	89 df                	mov    %ebx,%edi
+  801526:	89 de                	mov    %ebx,%esi
+  801528:	cd 30                	int    $0x30
+  80152a:	5b                   	pop    %ebx
+  80152b:	5e                   	pop    %esi
+  80152c:	5f                   	pop    %edi
+  80152d:	5d                   	pop    %ebp
+  80152e:	c3                   	ret
+
+0080152f <sys_env_stats>:
+  80152f:	55                   	push   %ebp
+  801530:	89 e5                	mov    %esp,%ebp
+  801532:	57                   	push   %edi
+  801533:	56                   	push   %esi
+  801534:	53                   	push   %ebx
+  801535:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801540:	b8 23 00 00 00       	mov    $0x23,%eax
+  801545:	89 df                	mov    %ebx,%edi
+  801547:	89 de                	mov    %ebx,%esi
+  801549:	cd 30                	int    $0x30
+  80154b:	5b                   	pop    %ebx
+  80154c:	5e                   	pop    %esi
+  80154d:	5f                   	pop    %edi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+
+00801550 <sys_trace>:
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	57                   	push   %edi
+  801554:	56                   	push   %esi
+  801555:	53                   	push   %ebx
+  801556:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80155b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155e:	b8 24 00 00 00       	mov    $0x24,%eax
+  801563:	89 cb                	mov    %ecx,%ebx
+  801565:	89 cf                	mov    %ecx,%edi
+  801567:	89 ce                	mov    %ecx,%esi
+  801569:	cd 30                	int    $0x30
+  80156b:	5b                   	pop    %ebx
+  80156c:	5e                   	pop    %esi
+  80156d:	5f                   	pop    %edi
+  80156e:	5d                   	pop    %ebp
+  80156f:	c3                   	ret
+
+00801570 <sys_env_set_pager>:
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	57                   	push   %edi
+  801574:	56                   	push   %esi
+  801575:	53                   	push   %ebx
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	be 00 00 00 00       	mov    $0x0,%esi
+  80157e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801581:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801584:	b8 25 00 00 00       	mov    $0x25,%eax
+  801589:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158c:	89 f7                	mov    %esi,%edi
+  80158e:	cd 30                	int    $0x30
+  801590:	85 c0                	test   %eax,%eax
+  801592:	7f 08                	jg     80159c <sys_env_set_pager+0x2c>
+  801594:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801597:	5b                   	pop    %ebx
+  801598:	5e                   	pop    %esi
+  801599:	5f                   	pop    %edi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+  80159c:	83 ec 0c             	sub    $0xc,%esp
+  80159f:	50                   	push   %eax
+  8015a0:	6a 25                	push   $0x25
+  8015a2:	68 eb 35 80 00       	push   $0x8035eb
+  8015a7:	6a 24                	push   $0x24
+  8015a9:	68 08 36 80 00       	push   $0x803608
+  8015ae:	e8 a2 eb ff ff       	call   800155 <_panic>
+
+008015b3 <sys_pager_retire>:
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	57                   	push   %edi
+  8015b7:	56                   	push   %esi
+  8015b8:	53                   	push   %ebx
+  8015b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c1:	b8 28 00 00 00       	mov    $0x28,%eax
+  8015c6:	89 cb                	mov    %ecx,%ebx
+  8015c8:	89 cf                	mov    %ecx,%edi
+  8015ca:	89 ce                	mov    %ecx,%esi
+  8015cc:	cd 30                	int    $0x30
+  8015ce:	5b                   	pop    %ebx
+  8015cf:	5e                   	pop    %esi
+  8015d0:	5f                   	pop    %edi
+  8015d1:	5d                   	pop    %ebp
+  8015d2:	c3                   	ret
+
+008015d3 <sys_prof>:
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	57                   	push   %edi
+  8015d7:	56                   	push   %esi
+  8015d8:	53                   	push   %ebx
+  8015d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e4:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ec:	89 f7                	mov    %esi,%edi
+  8015ee:	cd 30                	int    $0x30
+  8015f0:	5b                   	pop    %ebx
+  8015f1:	5e                   	pop    %esi
+  8015f2:	5f                   	pop    %edi
+  8015f3:	5d                   	pop    %ebp
+  8015f4:	c3                   	ret
+
+008015f5 <fd2num>:
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015fb:	05 00 00 00 30       	add    $0x30000000,%eax
+  801600:	c1 e8 0c             	shr    $0xc,%eax
+  801603:	5d                   	pop    %ebp
+  801604:	c3                   	ret
+
+00801605 <fd2data>:
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	8b 45 08             	mov    0x8(%ebp),%eax
+  80160b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801610:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801615:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  80161a:	5d                   	pop    %ebp
+  80161b:	c3                   	ret
+
+0080161c <fd_alloc>:
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801624:	89 c2                	mov    %eax,%edx
+  801626:	c1 ea 16             	shr    $0x16,%edx
+  801629:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801630:	f6 c2 01             	test   $0x1,%dl
+  801633:	74 29                	je     80165e <fd_alloc+0x42>
+  801635:	89 c2                	mov    %eax,%edx
+  801637:	c1 ea 0c             	shr    $0xc,%edx
+  80163a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801641:	f6 c2 01             	test   $0x1,%dl
+  801644:	74 18                	je     80165e <fd_alloc+0x42>
+  801646:	05 00 10 00 00       	add    $0x1000,%eax
+  80164b:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801650:	75 d2                	jne    801624 <fd_alloc+0x8>
+  801652:	b8 00 00 00 00       	mov    $0x0,%eax
+  801657:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80165c:	eb 05                	jmp    801663 <fd_alloc+0x47>
+  80165e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801663:	8b 55 08             	mov    0x8(%ebp),%edx
+  801666:	89 02                	mov    %eax,(%edx)
+  801668:	89 c8                	mov    %ecx,%eax
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+
+0080166c <fd_lookup>:
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  80166f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801672:	83 f8 1f             	cmp    $0x1f,%eax
+  801675:	77 30                	ja     8016a7 <fd_lookup+0x3b>
+  801677:	c1 e0 0c             	shl    $0xc,%eax
+  80167a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  80167f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801685:	f6 c2 01             	test   $0x1,%dl
+  801688:	74 24                	je     8016ae <fd_lookup+0x42>
+  80168a:	89 c2                	mov    %eax,%edx
+  80168c:	c1 ea 0c             	shr    $0xc,%edx
+  80168f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801696:	f6 c2 01             	test   $0x1,%dl
+  801699:	74 1a                	je     8016b5 <fd_lookup+0x49>
+  80169b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80169e:	89 02                	mov    %eax,(%edx)
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+  8016a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ac:	eb f7                	jmp    8016a5 <fd_lookup+0x39>
+  8016ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b3:	eb f0                	jmp    8016a5 <fd_lookup+0x39>
+  8016b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ba:	eb e9                	jmp    8016a5 <fd_lookup+0x39>
+
+008016bc <dev_lookup>:
+  8016bc:	55                   	push   %ebp
+  8016bd:	89 e5                	mov    %esp,%ebp
+  8016bf:	53                   	push   %ebx
+  8016c0:	83 ec 04             	sub    $0x4,%esp
+  8016c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cb:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8016d0:	39 13                	cmp    %edx,(%ebx)
+  8016d2:	74 37                	je     80170b <dev_lookup+0x4f>
+  8016d4:	83 c0 01             	add    $0x1,%eax
+  8016d7:	8b 1c 85 94 36 80 00 	mov    0x803694(,%eax,4),%ebx
+  8016de:	85 db                	test   %ebx,%ebx
+  8016e0:	75 ee                	jne    8016d0 <dev_lookup+0x14>
+  8016e2:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  8016e7:	8b 40 48             	mov    0x48(%eax),%eax
+  8016ea:	83 ec 04             	sub    $0x4,%esp
+  8016ed:	52                   	push   %edx
+  8016ee:	50                   	push   %eax
+  8016ef:	68 18 36 80 00       	push   $0x803618
+  8016f4:	e8 37 eb ff ff       	call   800230 <cprintf>
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801701:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801704:	89 1a                	mov    %ebx,(%edx)
+  801706:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801709:	c9                   	leave
+  80170a:	c3                   	ret
+  80170b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801710:	eb ef                	jmp    801701 <dev_lookup+0x45>
+
+00801712 <fd_close>:
+  801712:	55                   	push   %ebp
+  801713:	89 e5                	mov    %esp,%ebp
+  801715:	57                   	push   %edi
+  801716:	56                   	push   %esi
+  801717:	53                   	push   %ebx
+  801718:	83 ec 24             	sub    $0x24,%esp
+  80171b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80171e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801721:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801724:	50                   	push   %eax
+  801725:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80172b:	c1 e8 0c             	shr    $0xc,%eax
+  80172e:	50                   	push   %eax
+  80172f:	e8 38 ff ff ff       	call   80166c <fd_lookup>
+  801734:	89 c3                	mov    %eax,%ebx
+  801736:	83 c4 10             	add    $0x10,%esp
+  801739:	85 c0                	test   %eax,%eax
+  80173b:	78 05                	js     801742 <fd_close+0x30>
+  80173d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801740:	74 0f                	je     801751 <fd_close+0x3f>
+  801742:	85 ff                	test   %edi,%edi
+  801744:	0f 44 df             	cmove  %edi,%ebx
+  801747:	89 d8                	mov    %ebx,%eax
+  801749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5f                   	pop    %edi
+  80174f:	5d                   	pop    %ebp
+  801750:	c3                   	ret
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801757:	50                   	push   %eax
+  801758:	ff 36                	push   (%esi)
+  80175a:	e8 5d ff ff ff       	call   8016bc <dev_lookup>
+  80175f:	89 c3                	mov    %eax,%ebx
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	85 c0                	test   %eax,%eax
+  801766:	78 1a                	js     801782 <fd_close+0x70>
+  801768:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80176b:	8b 40 10             	mov    0x10(%eax),%eax
+  80176e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801773:	85 c0                	test   %eax,%eax
+  801775:	74 0b                	je     801782 <fd_close+0x70>
+  801777:	83 ec 0c             	sub    $0xc,%esp
+  80177a:	56                   	push   %esi
+  80177b:	ff d0                	call   *%eax
+  80177d:	89 c3                	mov    %eax,%ebx
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	83 ec 08             	sub    $0x8,%esp
+  801785:	56                   	push   %esi
+  801786:	6a 00                	push   $0x0
+  801788:	e8 cc f6 ff ff       	call   800e59 <sys_page_unmap>
+  80178d:	83 c4 10             	add    $0x10,%esp
+  801790:	eb b5                	jmp    801747 <fd_close+0x35>
+
+00801792 <close>:
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	83 ec 20             	sub    $0x20,%esp
+  801798:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179b:	50                   	push   %eax
+  80179c:	ff 75 08             	push   0x8(%ebp)
+  80179f:	e8 c8 fe ff ff       	call   80166c <fd_lookup>
+  8017a4:	83 c4 10             	add    $0x10,%esp
+  8017a7:	85 c0                	test   %eax,%eax
+  8017a9:	79 02                	jns    8017ad <close+0x1b>
+  8017ab:	c9                   	leave
+  8017ac:	c3                   	ret
+  8017ad:	83 ec 08             	sub    $0x8,%esp
+  8017b0:	6a 01                	push   $0x1
+  8017b2:	ff 75 f4             	push   -0xc(%ebp)
+  8017b5:	e8 58 ff ff ff       	call   801712 <fd_close>
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	eb ec                	jmp    8017ab <close+0x19>
+
+008017bf <close_all>:
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	53                   	push   %ebx
+  8017c3:	83 ec 04             	sub    $0x4,%esp
+  8017c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cb:	83 ec 0c             	sub    $0xc,%esp
+  8017ce:	53                   	push   %ebx
+  8017cf:	e8 be ff ff ff       	call   801792 <close>
+  8017d4:	83 c3 01             	add    $0x1,%ebx
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	83 fb 20             	cmp    $0x20,%ebx
+  8017dd:	75 ec                	jne    8017cb <close_all+0xc>
+  8017df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017e2:	c9                   	leave
+  8017e3:	c3                   	ret
+
+008017e4 <dup>:
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	57                   	push   %edi
+  8017e8:	56                   	push   %esi
+  8017e9:	53                   	push   %ebx
+  8017ea:	83 ec 34             	sub    $0x34,%esp
+  8017ed:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017f0:	50                   	push   %eax
+  8017f1:	ff 75 08             	push   0x8(%ebp)
+  8017f4:	e8 73 fe ff ff       	call   80166c <fd_lookup>
+  8017f9:	89 c3                	mov    %eax,%ebx
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	78 7f                	js     801881 <dup+0x9d>
+  801802:	83 ec 0c             	sub    $0xc,%esp
+  801805:	ff 75 0c             	push   0xc(%ebp)
+  801808:	e8 85 ff ff ff       	call   801792 <close>
+  80180d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801810:	c1 e6 0c             	shl    $0xc,%esi
+  801813:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801819:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80181c:	89 3c 24             	mov    %edi,(%esp)
+  80181f:	e8 e1 fd ff ff       	call   801605 <fd2data>
+  801824:	89 c3                	mov    %eax,%ebx
+  801826:	89 34 24             	mov    %esi,(%esp)
+  801829:	e8 d7 fd ff ff       	call   801605 <fd2data>
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801834:	89 d8                	mov    %ebx,%eax
+  801836:	c1 e8 16             	shr    $0x16,%eax
+  801839:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801840:	a8 01                	test   $0x1,%al
+  801842:	74 11                	je     801855 <dup+0x71>
+  801844:	89 d8                	mov    %ebx,%eax
+  801846:	c1 e8 0c             	shr    $0xc,%eax
+  801849:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801850:	f6 c2 01             	test   $0x1,%dl
+  801853:	75 36                	jne    80188b <dup+0xa7>
+  801855:	89 f8                	mov    %edi,%eax
+  801857:	c1 e8 0c             	shr    $0xc,%eax
+  80185a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801861:	83 ec 0c             	sub    $0xc,%esp
+  801864:	25 07 0e 00 00       	and    $0xe07,%eax
+  801869:	50                   	push   %eax
+  80186a:	56                   	push   %esi
+  80186b:	6a 00                	push   $0x0
+  80186d:	57                   	push   %edi
+  80186e:	6a 00                	push   $0x0
+  801870:	e8 55 f5 ff ff       	call   800dca <sys_page_map>
+  801875:	89 c3                	mov    %eax,%ebx
+  801877:	83 c4 20             	add    $0x20,%esp
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	78 33                	js     8018b1 <dup+0xcd>
+  80187e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801881:	89 d8                	mov    %ebx,%eax
+  801883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801886:	5b                   	pop    %ebx
+  801887:	5e                   	pop    %esi
+  801888:	5f                   	pop    %edi
+  801889:	5d                   	pop    %ebp
+  80188a:	c3                   	ret
+  80188b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801892:	83 ec 0c             	sub    $0xc,%esp
+  801895:	25 07 0e 00 00       	and    $0xe07,%eax
+  80189a:	50                   	push   %eax
+  80189b:	ff 75 d4             	push   -0x2c(%ebp)
+  80189e:	6a 00                	push   $0x0
+  8018a0:	53                   	push   %ebx
+  8018a1:	6a 00                	push   $0x0
+  8018a3:	e8 22 f5 ff ff       	call   800dca <sys_page_map>
+  8018a8:	89 c3                	mov    %eax,%ebx
+  8018aa:	83 c4 20             	add    $0x20,%esp
+  8018ad:	85 c0                	test   %eax,%eax
+  8018af:	79 a4                	jns    801855 <dup+0x71>
+  8018b1:	83 ec 08             	sub    $0x8,%esp
+  8018b4:	56                   	push   %esi
+  8018b5:	6a 00                	push   $0x0
+  8018b7:	e8 9d f5 ff ff       	call   800e59 <sys_page_unmap>
+  8018bc:	83 c4 08             	add    $0x8,%esp
+  8018bf:	ff 75 d4             	push   -0x2c(%ebp)
+  8018c2:	6a 00                	push   $0x0
+  8018c4:	e8 90 f5 ff ff       	call   800e59 <sys_page_unmap>
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	eb b3                	jmp    801881 <dup+0x9d>
+
+008018ce <read>:
+  8018ce:	55                   	push   %ebp
+  8018cf:	89 e5                	mov    %esp,%ebp
+  8018d1:	56                   	push   %esi
+  8018d2:	53                   	push   %ebx
+  8018d3:	83 ec 18             	sub    $0x18,%esp
+  8018d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018d9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018dc:	50                   	push   %eax
+  8018dd:	56                   	push   %esi
+  8018de:	e8 89 fd ff ff       	call   80166c <fd_lookup>
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	78 3c                	js     801926 <read+0x58>
+  8018ea:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018ed:	83 ec 08             	sub    $0x8,%esp
+  8018f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f3:	50                   	push   %eax
+  8018f4:	ff 33                	push   (%ebx)
+  8018f6:	e8 c1 fd ff ff       	call   8016bc <dev_lookup>
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	78 24                	js     801926 <read+0x58>
+  801902:	8b 43 08             	mov    0x8(%ebx),%eax
+  801905:	83 e0 03             	and    $0x3,%eax
+  801908:	83 f8 01             	cmp    $0x1,%eax
+  80190b:	74 20                	je     80192d <read+0x5f>
+  80190d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801910:	8b 40 08             	mov    0x8(%eax),%eax
+  801913:	85 c0                	test   %eax,%eax
+  801915:	74 37                	je     80194e <read+0x80>
+  801917:	83 ec 04             	sub    $0x4,%esp
+  80191a:	ff 75 10             	push   0x10(%ebp)
+  80191d:	ff 75 0c             	push   0xc(%ebp)
+  801920:	53                   	push   %ebx
+  801921:	ff d0                	call   *%eax
+  801923:	83 c4 10             	add    $0x10,%esp
+  801926:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801929:	5b                   	pop    %ebx
+  80192a:	5e                   	pop    %esi
+  80192b:	5d                   	pop    %ebp
+  80192c:	c3                   	ret
+  80192d:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  801932:	8b 40 48             	mov    0x48(%eax),%eax
+  801935:	83 ec 04             	sub    $0x4,%esp
+  801938:	56                   	push   %esi
+  801939:	50                   	push   %eax
+  80193a:	68 59 36 80 00       	push   $0x803659
+  80193f:	e8 ec e8 ff ff       	call   800230 <cprintf>
+  801944:	83 c4 10             	add    $0x10,%esp
+  801947:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194c:	eb d8                	jmp    801926 <read+0x58>
+  80194e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801953:	eb d1                	jmp    801926 <read+0x58>
+
+00801955 <readn>:
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	57                   	push   %edi
+  801959:	56                   	push   %esi
+  80195a:	53                   	push   %ebx
+  80195b:	83 ec 0c             	sub    $0xc,%esp
+  80195e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801961:	8b 75 10             	mov    0x10(%ebp),%esi
+  801964:	85 f6                	test   %esi,%esi
+  801966:	74 30                	je     801998 <readn+0x43>
+  801968:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801972:	83 ec 04             	sub    $0x4,%esp
+  801975:	89 f2                	mov    %esi,%edx
+  801977:	29 c2                	sub    %eax,%edx
+  801979:	52                   	push   %edx
+  80197a:	01 f8                	add    %edi,%eax
+  80197c:	50                   	push   %eax
+  80197d:	ff 75 08             	push   0x8(%ebp)
+  801980:	e8 49 ff ff ff       	call   8018ce <read>
+  801985:	83 c4 10             	add    $0x10,%esp
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	78 15                	js     8019a1 <readn+0x4c>
+  80198c:	74 11                	je     80199f <readn+0x4a>
+  80198e:	01 c3                	add    %eax,%ebx
+  801990:	89 d8                	mov    %ebx,%eax
+  801992:	39 f3                	cmp    %esi,%ebx
+  801994:	72 dc                	jb     801972 <readn+0x1d>
+  801996:	eb 09                	jmp    8019a1 <readn+0x4c>
+  801998:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199d:	eb 02                	jmp    8019a1 <readn+0x4c>
+  80199f:	89 d8                	mov    %ebx,%eax
+  8019a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a4:	5b                   	pop    %ebx
+  8019a5:	5e                   	pop    %esi
+  8019a6:	5f                   	pop    %edi
+  8019a7:	5d                   	pop    %ebp
+  8019a8:	c3                   	ret
+
+008019a9 <write>:
+  8019a9:	55                   	push   %ebp
+  8019aa:	89 e5                	mov    %esp,%ebp
+  8019ac:	56                   	push   %esi
+  8019ad:	53                   	push   %ebx
+  8019ae:	83 ec 18             	sub    $0x18,%esp
+  8019b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019b7:	50                   	push   %eax
+  8019b8:	53                   	push   %ebx
+  8019b9:	e8 ae fc ff ff       	call   80166c <fd_lookup>
+  8019be:	83 c4 10             	add    $0x10,%esp
+  8019c1:	85 c0                	test   %eax,%eax
+  8019c3:	78 37                	js     8019fc <write+0x53>
+  8019c5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019c8:	83 ec 08             	sub    $0x8,%esp
+  8019cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ce:	50                   	push   %eax
+  8019cf:	ff 36                	push   (%esi)
+  8019d1:	e8 e6 fc ff ff       	call   8016bc <dev_lookup>
+  8019d6:	83 c4 10             	add    $0x10,%esp
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	78 1f                	js     8019fc <write+0x53>
+  8019dd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019e1:	74 20                	je     801a03 <write+0x5a>
+  8019e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	74 37                	je     801a24 <write+0x7b>
+  8019ed:	83 ec 04             	sub    $0x4,%esp
+  8019f0:	ff 75 10             	push   0x10(%ebp)
+  8019f3:	ff 75 0c             	push   0xc(%ebp)
+  8019f6:	56                   	push   %esi
+  8019f7:	ff d0                	call   *%eax
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ff:	5b                   	pop    %ebx
+  801a00:	5e                   	pop    %esi
+  801a01:	5d                   	pop    %ebp
+  801a02:	c3                   	ret
+  801a03:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  801a08:	8b 40 48             	mov    0x48(%eax),%eax
+  801a0b:	83 ec 04             	sub    $0x4,%esp
+  801a0e:	53                   	push   %ebx
+  801a0f:	50                   	push   %eax
+  801a10:	68 75 36 80 00       	push   $0x803675
+  801a15:	e8 16 e8 ff ff       	call   800230 <cprintf>
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a22:	eb d8                	jmp    8019fc <write+0x53>
+  801a24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a29:	eb d1                	jmp    8019fc <write+0x53>
+
+00801a2b <seek>:
+  801a2b:	55                   	push   %ebp
+  801a2c:	89 e5                	mov    %esp,%ebp
+  801a2e:	83 ec 20             	sub    $0x20,%esp
+  801a31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a34:	50                   	push   %eax
+  801a35:	ff 75 08             	push   0x8(%ebp)
+  801a38:	e8 2f fc ff ff       	call   80166c <fd_lookup>
+  801a3d:	83 c4 10             	add    $0x10,%esp
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	78 0e                	js     801a52 <seek+0x27>
+  801a44:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4a:	89 50 04             	mov    %edx,0x4(%eax)
+  801a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a52:	c9                   	leave
+  801a53:	c3                   	ret
+
+00801a54 <ftruncate>:
+  801a54:	55                   	push   %ebp
+  801a55:	89 e5                	mov    %esp,%ebp
+  801a57:	56                   	push   %esi
+  801a58:	53                   	push   %ebx
+  801a59:	83 ec 18             	sub    $0x18,%esp
+  801a5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a5f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a62:	50                   	push   %eax
+  801a63:	53                   	push   %ebx
+  801a64:	e8 03 fc ff ff       	call   80166c <fd_lookup>
+  801a69:	83 c4 10             	add    $0x10,%esp
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	78 34                	js     801aa4 <ftruncate+0x50>
+  801a70:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a73:	83 ec 08             	sub    $0x8,%esp
+  801a76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a79:	50                   	push   %eax
+  801a7a:	ff 36                	push   (%esi)
+  801a7c:	e8 3b fc ff ff       	call   8016bc <dev_lookup>
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 1c                	js     801aa4 <ftruncate+0x50>
+  801a88:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a8c:	74 1d                	je     801aab <ftruncate+0x57>
+  801a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a91:	8b 40 18             	mov    0x18(%eax),%eax
+  801a94:	85 c0                	test   %eax,%eax
+  801a96:	74 34                	je     801acc <ftruncate+0x78>
+  801a98:	83 ec 08             	sub    $0x8,%esp
+  801a9b:	ff 75 0c             	push   0xc(%ebp)
+  801a9e:	56                   	push   %esi
+  801a9f:	ff d0                	call   *%eax
+  801aa1:	83 c4 10             	add    $0x10,%esp
+  801aa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa7:	5b                   	pop    %ebx
+  801aa8:	5e                   	pop    %esi
+  801aa9:	5d                   	pop    %ebp
+  801aaa:	c3                   	ret
+  801aab:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  801ab0:	8b 40 48             	mov    0x48(%eax),%eax
+  801ab3:	83 ec 04             	sub    $0x4,%esp
+  801ab6:	53                   	push   %ebx
+  801ab7:	50                   	push   %eax
+  801ab8:	68 38 36 80 00       	push   $0x803638
+  801abd:	e8 6e e7 ff ff       	call   800230 <cprintf>
+  801ac2:	83 c4 10             	add    $0x10,%esp
+  801ac5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aca:	eb d8                	jmp    801aa4 <ftruncate+0x50>
+  801acc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ad1:	eb d1                	jmp    801aa4 <ftruncate+0x50>
+
+00801ad3 <fstat>:
+  801ad3:	55                   	push   %ebp
+  801ad4:	89 e5                	mov    %esp,%ebp
+  801ad6:	56                   	push   %esi
+  801ad7:	53                   	push   %ebx
+  801ad8:	83 ec 18             	sub    $0x18,%esp
+  801adb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801ade:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ae1:	50                   	push   %eax
+  801ae2:	ff 75 08             	push   0x8(%ebp)
+  801ae5:	e8 82 fb ff ff       	call   80166c <fd_lookup>
+  801aea:	83 c4 10             	add    $0x10,%esp
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	78 49                	js     801b3a <fstat+0x67>
+  801af1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801af4:	83 ec 08             	sub    $0x8,%esp
+  801af7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801afa:	50                   	push   %eax
+  801afb:	ff 36                	push   (%esi)
+  801afd:	e8 ba fb ff ff       	call   8016bc <dev_lookup>
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 31                	js     801b3a <fstat+0x67>
+  801b09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b0c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b10:	74 2f                	je     801b41 <fstat+0x6e>
+  801b12:	c6 03 00             	movb   $0x0,(%ebx)
+  801b15:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b1c:	00 00 00 
+  801b1f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b26:	00 00 00 
+  801b29:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801b2f:	83 ec 08             	sub    $0x8,%esp
+  801b32:	53                   	push   %ebx
+  801b33:	56                   	push   %esi
+  801b34:	ff 50 14             	call   *0x14(%eax)
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3d:	5b                   	pop    %ebx
+  801b3e:	5e                   	pop    %esi
+  801b3f:	5d                   	pop    %ebp
+  801b40:	c3                   	ret
+  801b41:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b46:	eb f2                	jmp    801b3a <fstat+0x67>
+
+00801b48 <stat>:
+  801b48:	55                   	push   %ebp
+  801b49:	89 e5                	mov    %esp,%ebp
+  801b4b:	56                   	push   %esi
+  801b4c:	53                   	push   %ebx
+  801b4d:	83 ec 08             	sub    $0x8,%esp
+  801b50:	6a 00                	push   $0x0
+  801b52:	ff 75 08             	push   0x8(%ebp)
+  801b55:	e8 31 05 00 00       	call   80208b <open>
+  801b5a:	89 c3                	mov    %eax,%ebx
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	78 1b                	js     801b7e <stat+0x36>
+  801b63:	83 ec 08             	sub    $0x8,%esp
+  801b66:	ff 75 0c             	push   0xc(%ebp)
+  801b69:	50                   	push   %eax
+  801b6a:	e8 64 ff ff ff       	call   801ad3 <fstat>
+  801b6f:	89 c6                	mov    %eax,%esi
+  801b71:	89 1c 24             	mov    %ebx,(%esp)
+  801b74:	e8 19 fc ff ff       	call   801792 <close>
+  801b79:	83 c4 10             	add    $0x10,%esp
+  801b7c:	89 f3                	mov    %esi,%ebx
+  801b7e:	89 d8                	mov    %ebx,%eax
+  801b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b83:	5b                   	pop    %ebx
+  801b84:	5e                   	pop    %esi
+  801b85:	5d                   	pop    %ebp
+  801b86:	c3                   	ret
+
+00801b87 <fsipc>:
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+  801b8a:	56                   	push   %esi
+  801b8b:	53                   	push   %ebx
+  801b8c:	89 c3                	mov    %eax,%ebx
+  801b8e:	89 d6                	mov    %edx,%esi
+  801b90:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801b97:	74 20                	je     801bb9 <fsipc+0x32>
+  801b99:	83 ec 08             	sub    $0x8,%esp
+  801b9c:	6a 00                	push   $0x0
+  801b9e:	56                   	push   %esi
+  801b9f:	6a 07                	push   $0x7
+  801ba1:	68 00 60 c0 00       	push   $0xc06000
+  801ba6:	53                   	push   %ebx
+  801ba7:	ff 35 08 50 80 00    	push   0x805008
+  801bad:	e8 5a 12 00 00       	call   802e0c <ipc_call>
+  801bb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb5:	5b                   	pop    %ebx
+  801bb6:	5e                   	pop    %esi
+  801bb7:	5d                   	pop    %ebp
+  801bb8:	c3                   	ret
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	6a 02                	push   $0x2
+  801bbe:	e8 e4 13 00 00       	call   802fa7 <ipc_find_env>
+  801bc3:	a3 08 50 80 00       	mov    %eax,0x805008
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	eb cc                	jmp    801b99 <fsipc+0x12>
+
+00801bcd <devfile_trunc>:
+  801bcd:	55                   	push   %ebp
+  801bce:	89 e5                	mov    %esp,%ebp
+  801bd0:	83 ec 08             	sub    $0x8,%esp
+  801bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd9:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  801bde:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be1:	a3 04 60 c0 00       	mov    %eax,0xc06004
+  801be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801beb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bf0:	e8 92 ff ff ff       	call   801b87 <fsipc>
+  801bf5:	c9                   	leave
+  801bf6:	c3                   	ret
+
+00801bf7 <devfile_flush>:
+  801bf7:	55                   	push   %ebp
+  801bf8:	89 e5                	mov    %esp,%ebp
+  801bfa:	83 ec 08             	sub    $0x8,%esp
+  801bfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c00:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c03:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  801c08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c12:	e8 70 ff ff ff       	call   801b87 <fsipc>
+  801c17:	c9                   	leave
+  801c18:	c3                   	ret
+
+00801c19 <devfile_stat>:
+  801c19:	55                   	push   %ebp
+  801c1a:	89 e5                	mov    %esp,%ebp
+  801c1c:	53                   	push   %ebx
+  801c1d:	83 ec 04             	sub    $0x4,%esp
+  801c20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c26:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c29:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  801c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c33:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c38:	e8 4a ff ff ff       	call   801b87 <fsipc>
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	78 2c                	js     801c6d <devfile_stat+0x54>
+  801c41:	83 ec 08             	sub    $0x8,%esp
+  801c44:	68 00 60 c0 00       	push   $0xc06000
+  801c49:	53                   	push   %ebx
+  801c4a:	e8 d8 ec ff ff       	call   800927 <strcpy>
+  801c4f:	a1 80 60 c0 00       	mov    0xc06080,%eax
+  801c54:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801c5a:	a1 84 60 c0 00       	mov    0xc06084,%eax
+  801c5f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801c65:	83 c4 10             	add    $0x10,%esp
+  801c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c70:	c9                   	leave
+  801c71:	c3                   	ret
+
+00801c72 <fsring_rw>:
+  801c72:	55                   	push   %ebp
+  801c73:	89 e5                	mov    %esp,%ebp
+  801c75:	57                   	push   %edi
+  801c76:	56                   	push   %esi
+  801c77:	53                   	push   %ebx
+  801c78:	83 ec 2c             	sub    $0x2c,%esp
+  801c7b:	89 c7                	mov    %eax,%edi
+  801c7d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801c80:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801c83:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801c88:	a8 01                	test   $0x1,%al
+  801c8a:	74 0d                	je     801c99 <fsring_rw+0x27>
+  801c8c:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801c91:	a8 01                	test   $0x1,%al
+  801c93:	0f 85 d5 00 00 00    	jne    801d6e <fsring_rw+0xfc>
+  801c99:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  801c9e:	8b 40 48             	mov    0x48(%eax),%eax
+  801ca1:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801ca7:	0f 84 fc 00 00 00    	je     801da9 <fsring_rw+0x137>
+  801cad:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801cb4:	0f 84 02 01 00 00    	je     801dbc <fsring_rw+0x14a>
+  801cba:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801cbf:	83 ec 04             	sub    $0x4,%esp
+  801cc2:	68 07 02 00 00       	push   $0x207
+  801cc7:	53                   	push   %ebx
+  801cc8:	6a 00                	push   $0x0
+  801cca:	e8 b8 f0 ff ff       	call   800d87 <sys_page_alloc>
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	0f 88 f9 00 00 00    	js     801dd3 <fsring_rw+0x161>
+  801cda:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ce0:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ce6:	75 d7                	jne    801cbf <fsring_rw+0x4d>
+  801ce8:	6a 0e                	push   $0xe
+  801cea:	6a 0d                	push   $0xd
+  801cec:	ff 35 08 50 80 00    	push   0x805008
+  801cf2:	68 00 00 f0 cf       	push   $0xcff00000
+  801cf7:	e8 c4 0c 00 00       	call   8029c0 <ipcring_init>
+  801cfc:	83 c4 08             	add    $0x8,%esp
+  801cff:	6a 00                	push   $0x0
+  801d01:	6a 00                	push   $0x0
+  801d03:	68 07 02 00 00       	push   $0x207
+  801d08:	68 00 00 f0 cf       	push   $0xcff00000
+  801d0d:	6a 0b                	push   $0xb
+  801d0f:	ff 35 08 50 80 00    	push   0x805008
+  801d15:	e8 f2 10 00 00       	call   802e0c <ipc_call>
+  801d1a:	89 c6                	mov    %eax,%esi
+  801d1c:	83 c4 20             	add    $0x20,%esp
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	0f 88 ac 00 00 00    	js     801dd3 <fsring_rw+0x161>
+  801d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d2c:	89 d9                	mov    %ebx,%ecx
+  801d2e:	83 c3 01             	add    $0x1,%ebx
+  801d31:	89 da                	mov    %ebx,%edx
+  801d33:	c1 e2 0c             	shl    $0xc,%edx
+  801d36:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801d3c:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801d42:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801d48:	83 ec 08             	sub    $0x8,%esp
+  801d4b:	6a 00                	push   $0x0
+  801d4d:	6a 00                	push   $0x0
+  801d4f:	68 07 02 00 00       	push   $0x207
+  801d54:	50                   	push   %eax
+  801d55:	6a 0c                	push   $0xc
+  801d57:	ff 35 08 50 80 00    	push   0x805008
+  801d5d:	e8 aa 10 00 00       	call   802e0c <ipc_call>
+  801d62:	83 c4 20             	add    $0x20,%esp
+  801d65:	85 c0                	test   %eax,%eax
+  801d67:	78 6a                	js     801dd3 <fsring_rw+0x161>
+  801d69:	83 fb 08             	cmp    $0x8,%ebx
+  801d6c:	75 be                	jne    801d2c <fsring_rw+0xba>
+  801d6e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801d72:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801d77:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801d7c:	0f 45 c2             	cmovne %edx,%eax
+  801d7f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801d82:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801d89:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801d90:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801da1:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801da4:	e9 4b 01 00 00       	jmp    801ef4 <fsring_rw+0x282>
+  801da9:	e8 a3 f3 ff ff       	call   801151 <sys_time_msec>
+  801dae:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801db4:	0f 89 f3 fe ff ff    	jns    801cad <fsring_rw+0x3b>
+  801dba:	eb 54                	jmp    801e10 <fsring_rw+0x19e>
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+  801dbf:	6a 02                	push   $0x2
+  801dc1:	e8 e1 11 00 00       	call   802fa7 <ipc_find_env>
+  801dc6:	a3 08 50 80 00       	mov    %eax,0x805008
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	e9 e7 fe ff ff       	jmp    801cba <fsring_rw+0x48>
+  801dd3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dd8:	83 ec 08             	sub    $0x8,%esp
+  801ddb:	53                   	push   %ebx
+  801ddc:	6a 00                	push   $0x0
+  801dde:	e8 76 f0 ff ff       	call   800e59 <sys_page_unmap>
+  801de3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801de9:	83 c4 10             	add    $0x10,%esp
+  801dec:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801df2:	75 e4                	jne    801dd8 <fsring_rw+0x166>
+  801df4:	e8 58 f3 ff ff       	call   801151 <sys_time_msec>
+  801df9:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801dfe:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e03:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  801e08:	8b 40 48             	mov    0x48(%eax),%eax
+  801e0b:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e10:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801e17:	e9 7a 01 00 00       	jmp    801f96 <fsring_rw+0x324>
+  801e1c:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e1f:	89 10                	mov    %edx,(%eax)
+  801e21:	89 58 04             	mov    %ebx,0x4(%eax)
+  801e24:	89 f2                	mov    %esi,%edx
+  801e26:	03 57 04             	add    0x4(%edi),%edx
+  801e29:	89 50 08             	mov    %edx,0x8(%eax)
+  801e2c:	83 ec 04             	sub    $0x4,%esp
+  801e2f:	53                   	push   %ebx
+  801e30:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801e33:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801e36:	52                   	push   %edx
+  801e37:	83 c0 0c             	add    $0xc,%eax
+  801e3a:	50                   	push   %eax
+  801e3b:	e8 97 ec ff ff       	call   800ad7 <memmove>
+  801e40:	83 c4 10             	add    $0x10,%esp
+  801e43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e46:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e49:	89 08                	mov    %ecx,(%eax)
+  801e4b:	83 ec 0c             	sub    $0xc,%esp
+  801e4e:	68 00 00 f0 cf       	push   $0xcff00000
+  801e53:	e8 c6 0b 00 00       	call   802a1e <ipcring_req_push>
+  801e58:	01 de                	add    %ebx,%esi
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801e60:	73 4c                	jae    801eae <fsring_rw+0x23c>
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	68 00 00 f0 cf       	push   $0xcff00000
+  801e6a:	e8 89 0b 00 00       	call   8029f8 <ipcring_req_slot>
+  801e6f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e72:	83 c4 10             	add    $0x10,%esp
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	74 35                	je     801eae <fsring_rw+0x23c>
+  801e79:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801e7e:	83 e0 07             	and    $0x7,%eax
+  801e81:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801e86:	c1 e0 0c             	shl    $0xc,%eax
+  801e89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e8c:	29 f3                	sub    %esi,%ebx
+  801e8e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801e91:	39 cb                	cmp    %ecx,%ebx
+  801e93:	0f 47 d9             	cmova  %ecx,%ebx
+  801e96:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e9a:	75 80                	jne    801e1c <fsring_rw+0x1aa>
+  801e9c:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e9f:	89 10                	mov    %edx,(%eax)
+  801ea1:	89 58 04             	mov    %ebx,0x4(%eax)
+  801ea4:	89 f2                	mov    %esi,%edx
+  801ea6:	03 57 04             	add    0x4(%edi),%edx
+  801ea9:	89 50 08             	mov    %edx,0x8(%eax)
+  801eac:	eb 95                	jmp    801e43 <fsring_rw+0x1d1>
+  801eae:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801eb3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801eb6:	83 ec 0c             	sub    $0xc,%esp
+  801eb9:	68 00 00 f0 cf       	push   $0xcff00000
+  801ebe:	e8 94 0b 00 00       	call   802a57 <ipcring_rsp_wait>
+  801ec3:	8b 58 04             	mov    0x4(%eax),%ebx
+  801ec6:	83 c4 10             	add    $0x10,%esp
+  801ec9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801ecd:	75 45                	jne    801f14 <fsring_rw+0x2a2>
+  801ecf:	85 db                	test   %ebx,%ebx
+  801ed1:	79 41                	jns    801f14 <fsring_rw+0x2a2>
+  801ed3:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801ed6:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801edd:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801ee4:	83 ec 0c             	sub    $0xc,%esp
+  801ee7:	68 00 00 f0 cf       	push   $0xcff00000
+  801eec:	e8 cc 0b 00 00       	call   802abd <ipcring_rsp_pop>
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801efa:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801eff:	39 c2                	cmp    %eax,%edx
+  801f01:	74 75                	je     801f78 <fsring_rw+0x306>
+  801f03:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f07:	75 a5                	jne    801eae <fsring_rw+0x23c>
+  801f09:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f0c:	0f 82 50 ff ff ff    	jb     801e62 <fsring_rw+0x1f0>
+  801f12:	eb 9a                	jmp    801eae <fsring_rw+0x23c>
+  801f14:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f18:	75 ca                	jne    801ee4 <fsring_rw+0x272>
+  801f1a:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f1e:	74 31                	je     801f51 <fsring_rw+0x2df>
+  801f20:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f23:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f26:	29 c8                	sub    %ecx,%eax
+  801f28:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801f2b:	39 d0                	cmp    %edx,%eax
+  801f2d:	0f 47 c2             	cmova  %edx,%eax
+  801f30:	39 d8                	cmp    %ebx,%eax
+  801f32:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f37:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801f3b:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801f3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f43:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801f47:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f4a:	01 d9                	add    %ebx,%ecx
+  801f4c:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801f4f:	eb 93                	jmp    801ee4 <fsring_rw+0x272>
+  801f51:	83 ec 04             	sub    $0x4,%esp
+  801f54:	53                   	push   %ebx
+  801f55:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f58:	83 e0 07             	and    $0x7,%eax
+  801f5b:	c1 e0 0c             	shl    $0xc,%eax
+  801f5e:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801f64:	50                   	push   %eax
+  801f65:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801f68:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f6b:	01 c8                	add    %ecx,%eax
+  801f6d:	50                   	push   %eax
+  801f6e:	e8 64 eb ff ff       	call   800ad7 <memmove>
+  801f73:	83 c4 10             	add    $0x10,%esp
+  801f76:	eb a8                	jmp    801f20 <fsring_rw+0x2ae>
+  801f78:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f7c:	75 09                	jne    801f87 <fsring_rw+0x315>
+  801f7e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f81:	0f 82 db fe ff ff    	jb     801e62 <fsring_rw+0x1f0>
+  801f87:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801f8a:	01 57 04             	add    %edx,0x4(%edi)
+  801f8d:	85 d2                	test   %edx,%edx
+  801f8f:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801f93:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801f96:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801f99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f9c:	5b                   	pop    %ebx
+  801f9d:	5e                   	pop    %esi
+  801f9e:	5f                   	pop    %edi
+  801f9f:	5d                   	pop    %ebp
+  801fa0:	c3                   	ret
+
+00801fa1 <devfile_write>:
+  801fa1:	55                   	push   %ebp
+  801fa2:	89 e5                	mov    %esp,%ebp
+  801fa4:	57                   	push   %edi
+  801fa5:	56                   	push   %esi
+  801fa6:	53                   	push   %ebx
+  801fa7:	83 ec 0c             	sub    $0xc,%esp
+  801faa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fb3:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801fb9:	76 1a                	jbe    801fd5 <devfile_write+0x34>
+  801fbb:	83 ec 0c             	sub    $0xc,%esp
+  801fbe:	53                   	push   %ebx
+  801fbf:	89 f1                	mov    %esi,%ecx
+  801fc1:	ba 06 00 00 00       	mov    $0x6,%edx
+  801fc6:	89 f8                	mov    %edi,%eax
+  801fc8:	e8 a5 fc ff ff       	call   801c72 <fsring_rw>
+  801fcd:	83 c4 10             	add    $0x10,%esp
+  801fd0:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801fd3:	75 39                	jne    80200e <devfile_write+0x6d>
+  801fd5:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801fda:	39 c3                	cmp    %eax,%ebx
+  801fdc:	0f 47 d8             	cmova  %eax,%ebx
+  801fdf:	8b 47 0c             	mov    0xc(%edi),%eax
+  801fe2:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  801fe7:	89 1d 04 60 c0 00    	mov    %ebx,0xc06004
+  801fed:	83 ec 04             	sub    $0x4,%esp
+  801ff0:	53                   	push   %ebx
+  801ff1:	56                   	push   %esi
+  801ff2:	68 08 60 c0 00       	push   $0xc06008
+  801ff7:	e8 db ea ff ff       	call   800ad7 <memmove>
+  801ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802001:	b8 04 00 00 00       	mov    $0x4,%eax
+  802006:	e8 7c fb ff ff       	call   801b87 <fsipc>
+  80200b:	83 c4 10             	add    $0x10,%esp
+  80200e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5f                   	pop    %edi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+
+00802016 <devfile_read>:
+  802016:	55                   	push   %ebp
+  802017:	89 e5                	mov    %esp,%ebp
+  802019:	57                   	push   %edi
+  80201a:	56                   	push   %esi
+  80201b:	53                   	push   %ebx
+  80201c:	83 ec 0c             	sub    $0xc,%esp
+  80201f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802022:	8b 75 10             	mov    0x10(%ebp),%esi
+  802025:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80202b:	76 1d                	jbe    80204a <devfile_read+0x34>
+  80202d:	83 ec 0c             	sub    $0xc,%esp
+  802030:	56                   	push   %esi
+  802031:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802034:	ba 05 00 00 00       	mov    $0x5,%edx
+  802039:	89 f8                	mov    %edi,%eax
+  80203b:	e8 32 fc ff ff       	call   801c72 <fsring_rw>
+  802040:	89 c3                	mov    %eax,%ebx
+  802042:	83 c4 10             	add    $0x10,%esp
+  802045:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802048:	75 37                	jne    802081 <devfile_read+0x6b>
+  80204a:	8b 47 0c             	mov    0xc(%edi),%eax
+  80204d:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  802052:	89 35 04 60 c0 00    	mov    %esi,0xc06004
+  802058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802062:	e8 20 fb ff ff       	call   801b87 <fsipc>
+  802067:	89 c3                	mov    %eax,%ebx
+  802069:	85 c0                	test   %eax,%eax
+  80206b:	78 14                	js     802081 <devfile_read+0x6b>
+  80206d:	83 ec 04             	sub    $0x4,%esp
+  802070:	50                   	push   %eax
+  802071:	68 00 60 c0 00       	push   $0xc06000
+  802076:	ff 75 0c             	push   0xc(%ebp)
+  802079:	e8 59 ea ff ff       	call   800ad7 <memmove>
+  80207e:	83 c4 10             	add    $0x10,%esp
+  802081:	89 d8                	mov    %ebx,%eax
+  802083:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802086:	5b                   	pop    %ebx
+  802087:	5e                   	pop    %esi
+  802088:	5f                   	pop    %edi
+  802089:	5d                   	pop    %ebp
+  80208a:	c3                   	ret
+
+0080208b <open>:
+  80208b:	55                   	push   %ebp
+  80208c:	89 e5                	mov    %esp,%ebp
+  80208e:	56                   	push   %esi
+  80208f:	53                   	push   %ebx
+  802090:	83 ec 1c             	sub    $0x1c,%esp
+  802093:	8b 75 08             	mov    0x8(%ebp),%esi
+  802096:	56                   	push   %esi
+  802097:	e8 3f e8 ff ff       	call   8008db <strlen>
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020a4:	7f 6c                	jg     802112 <open+0x87>
+  8020a6:	83 ec 0c             	sub    $0xc,%esp
+  8020a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ac:	50                   	push   %eax
+  8020ad:	e8 6a f5 ff ff       	call   80161c <fd_alloc>
+  8020b2:	89 c3                	mov    %eax,%ebx
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	78 3c                	js     8020f7 <open+0x6c>
+  8020bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020be:	a3 00 64 c0 00       	mov    %eax,0xc06400
+  8020c3:	83 ec 08             	sub    $0x8,%esp
+  8020c6:	56                   	push   %esi
+  8020c7:	68 00 60 c0 00       	push   $0xc06000
+  8020cc:	e8 56 e8 ff ff       	call   800927 <strcpy>
+  8020d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020d9:	e8 a9 fa ff ff       	call   801b87 <fsipc>
+  8020de:	89 c3                	mov    %eax,%ebx
+  8020e0:	83 c4 10             	add    $0x10,%esp
+  8020e3:	85 c0                	test   %eax,%eax
+  8020e5:	78 19                	js     802100 <open+0x75>
+  8020e7:	83 ec 0c             	sub    $0xc,%esp
+  8020ea:	ff 75 f4             	push   -0xc(%ebp)
+  8020ed:	e8 03 f5 ff ff       	call   8015f5 <fd2num>
+  8020f2:	89 c3                	mov    %eax,%ebx
+  8020f4:	83 c4 10             	add    $0x10,%esp
+  8020f7:	89 d8                	mov    %ebx,%eax
+  8020f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fc:	5b                   	pop    %ebx
+  8020fd:	5e                   	pop    %esi
+  8020fe:	5d                   	pop    %ebp
+  8020ff:	c3                   	ret
+  802100:	83 ec 08             	sub    $0x8,%esp
+  802103:	6a 00                	push   $0x0
+  802105:	ff 75 f4             	push   -0xc(%ebp)
+  802108:	e8 05 f6 ff ff       	call   801712 <fd_close>
+  80210d:	83 c4 10             	add    $0x10,%esp
+  802110:	eb e5                	jmp    8020f7 <open+0x6c>
+  802112:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802117:	eb de                	jmp    8020f7 <open+0x6c>
+
+00802119 <file_image>:
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+  80211c:	53                   	push   %ebx
+  80211d:	83 ec 1c             	sub    $0x1c,%esp
+  802120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802123:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802126:	50                   	push   %eax
+  802127:	ff 75 08             	push   0x8(%ebp)
+  80212a:	e8 3d f5 ff ff       	call   80166c <fd_lookup>
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	85 c0                	test   %eax,%eax
+  802134:	78 58                	js     80218e <file_image+0x75>
+  802136:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802139:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80213f:	39 08                	cmp    %ecx,(%eax)
+  802141:	75 50                	jne    802193 <file_image+0x7a>
+  802143:	83 fb 04             	cmp    $0x4,%ebx
+  802146:	77 52                	ja     80219a <file_image+0x81>
+  802148:	8b 40 0c             	mov    0xc(%eax),%eax
+  80214b:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  802150:	89 1d 04 60 c0 00    	mov    %ebx,0xc06004
+  802156:	83 ec 04             	sub    $0x4,%esp
+  802159:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80215c:	c1 e0 02             	shl    $0x2,%eax
+  80215f:	50                   	push   %eax
+  802160:	ff 75 0c             	push   0xc(%ebp)
+  802163:	68 08 60 c0 00       	push   $0xc06008
+  802168:	e8 6a e9 ff ff       	call   800ad7 <memmove>
+  80216d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802172:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802177:	e8 0b fa ff ff       	call   801b87 <fsipc>
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	78 0b                	js     80218e <file_image+0x75>
+  802183:	8b 55 14             	mov    0x14(%ebp),%edx
+  802186:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  80218c:	89 0a                	mov    %ecx,(%edx)
+  80218e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+  802193:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802198:	eb f4                	jmp    80218e <file_image+0x75>
+  80219a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80219f:	eb ed                	jmp    80218e <file_image+0x75>
+
+008021a1 <remove>:
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	53                   	push   %ebx
+  8021a5:	83 ec 10             	sub    $0x10,%esp
+  8021a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021ab:	53                   	push   %ebx
+  8021ac:	e8 2a e7 ff ff       	call   8008db <strlen>
+  8021b1:	83 c4 10             	add    $0x10,%esp
+  8021b4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021b9:	7f 25                	jg     8021e0 <remove+0x3f>
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	53                   	push   %ebx
+  8021bf:	68 00 60 c0 00       	push   $0xc06000
+  8021c4:	e8 5e e7 ff ff       	call   800927 <strcpy>
+  8021c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ce:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021d3:	e8 af f9 ff ff       	call   801b87 <fsipc>
+  8021d8:	83 c4 10             	add    $0x10,%esp
+  8021db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021de:	c9                   	leave
+  8021df:	c3                   	ret
+  8021e0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8021e5:	eb f4                	jmp    8021db <remove+0x3a>
+
+008021e7 <sync>:
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	83 ec 08             	sub    $0x8,%esp
+  8021ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021f7:	e8 8b f9 ff ff       	call   801b87 <fsipc>
+  8021fc:	c9                   	leave
+  8021fd:	c3                   	ret
+
+008021fe <devsock_stat>:
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	83 ec 10             	sub    $0x10,%esp
+  802204:	68 a8 36 80 00       	push   $0x8036a8
+  802209:	ff 75 0c             	push   0xc(%ebp)
+  80220c:	e8 16 e7 ff ff       	call   800927 <strcpy>
+  802211:	b8 00 00 00 00       	mov    $0x0,%eax
+  802216:	c9                   	leave
+  802217:	c3                   	ret
+
+00802218 <devsock_close>:
+  802218:	55                   	push   %ebp
+  802219:	89 e5                	mov    %esp,%ebp
+  80221b:	53                   	push   %ebx
+  80221c:	83 ec 10             	sub    $0x10,%esp
+  80221f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802222:	53                   	push   %ebx
+  802223:	e8 99 0d 00 00       	call   802fc1 <pageref>
+  802228:	89 c2                	mov    %eax,%edx
+  80222a:	83 c4 10             	add    $0x10,%esp
+  80222d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802232:	83 fa 01             	cmp    $0x1,%edx
+  802235:	74 05                	je     80223c <devsock_close+0x24>
+  802237:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+  80223c:	83 ec 0c             	sub    $0xc,%esp
+  80223f:	ff 73 0c             	push   0xc(%ebx)
+  802242:	e8 aa 02 00 00       	call   8024f1 <nsipc_close>
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	eb eb                	jmp    802237 <devsock_close+0x1f>
+
+0080224c <devsock_write>:
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	83 ec 08             	sub    $0x8,%esp
+  802252:	6a 00                	push   $0x0
+  802254:	ff 75 10             	push   0x10(%ebp)
+  802257:	ff 75 0c             	push   0xc(%ebp)
+  80225a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225d:	ff 70 0c             	push   0xc(%eax)
+  802260:	e8 6c 03 00 00       	call   8025d1 <nsipc_send>
+  802265:	c9                   	leave
+  802266:	c3                   	ret
+
+00802267 <devsock_read>:
+  802267:	55                   	push   %ebp
+  802268:	89 e5                	mov    %esp,%ebp
+  80226a:	83 ec 08             	sub    $0x8,%esp
+  80226d:	6a 00                	push   $0x0
+  80226f:	ff 75 10             	push   0x10(%ebp)
+  802272:	ff 75 0c             	push   0xc(%ebp)
+  802275:	8b 45 08             	mov    0x8(%ebp),%eax
+  802278:	ff 70 0c             	push   0xc(%eax)
+  80227b:	e8 e2 02 00 00       	call   802562 <nsipc_recv>
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+00802282 <fd2sockid>:
+  802282:	55                   	push   %ebp
+  802283:	89 e5                	mov    %esp,%ebp
+  802285:	83 ec 20             	sub    $0x20,%esp
+  802288:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80228b:	52                   	push   %edx
+  80228c:	50                   	push   %eax
+  80228d:	e8 da f3 ff ff       	call   80166c <fd_lookup>
+  802292:	83 c4 10             	add    $0x10,%esp
+  802295:	85 c0                	test   %eax,%eax
+  802297:	78 10                	js     8022a9 <fd2sockid+0x27>
+  802299:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80229c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022a2:	39 08                	cmp    %ecx,(%eax)
+  8022a4:	75 05                	jne    8022ab <fd2sockid+0x29>
+  8022a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022a9:	c9                   	leave
+  8022aa:	c3                   	ret
+  8022ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022b0:	eb f7                	jmp    8022a9 <fd2sockid+0x27>
+
+008022b2 <alloc_sockfd>:
+  8022b2:	55                   	push   %ebp
+  8022b3:	89 e5                	mov    %esp,%ebp
+  8022b5:	56                   	push   %esi
+  8022b6:	53                   	push   %ebx
+  8022b7:	83 ec 1c             	sub    $0x1c,%esp
+  8022ba:	89 c6                	mov    %eax,%esi
+  8022bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022bf:	50                   	push   %eax
+  8022c0:	e8 57 f3 ff ff       	call   80161c <fd_alloc>
+  8022c5:	89 c3                	mov    %eax,%ebx
+  8022c7:	83 c4 10             	add    $0x10,%esp
+  8022ca:	85 c0                	test   %eax,%eax
+  8022cc:	78 43                	js     802311 <alloc_sockfd+0x5f>
+  8022ce:	83 ec 04             	sub    $0x4,%esp
+  8022d1:	68 07 04 00 00       	push   $0x407
+  8022d6:	ff 75 f4             	push   -0xc(%ebp)
+  8022d9:	6a 00                	push   $0x0
+  8022db:	e8 a7 ea ff ff       	call   800d87 <sys_page_alloc>
+  8022e0:	89 c3                	mov    %eax,%ebx
+  8022e2:	83 c4 10             	add    $0x10,%esp
+  8022e5:	85 c0                	test   %eax,%eax
+  8022e7:	78 28                	js     802311 <alloc_sockfd+0x5f>
+  8022e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ec:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8022f2:	89 10                	mov    %edx,(%eax)
+  8022f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8022fe:	89 70 0c             	mov    %esi,0xc(%eax)
+  802301:	83 ec 0c             	sub    $0xc,%esp
+  802304:	50                   	push   %eax
+  802305:	e8 eb f2 ff ff       	call   8015f5 <fd2num>
+  80230a:	89 c3                	mov    %eax,%ebx
+  80230c:	83 c4 10             	add    $0x10,%esp
+  80230f:	eb 0c                	jmp    80231d <alloc_sockfd+0x6b>
+  802311:	83 ec 0c             	sub    $0xc,%esp
+  802314:	56                   	push   %esi
+  802315:	e8 d7 01 00 00       	call   8024f1 <nsipc_close>
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	89 d8                	mov    %ebx,%eax
+  80231f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802322:	5b                   	pop    %ebx
+  802323:	5e                   	pop    %esi
+  802324:	5d                   	pop    %ebp
+  802325:	c3                   	ret
+
+00802326 <accept>:
+  802326:	55                   	push   %ebp
+  802327:	89 e5                	mov    %esp,%ebp
+  802329:	83 ec 08             	sub    $0x8,%esp
+  80232c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232f:	e8 4e ff ff ff       	call   802282 <fd2sockid>
+  802334:	85 c0                	test   %eax,%eax
+  802336:	78 1b                	js     802353 <accept+0x2d>
+  802338:	83 ec 04             	sub    $0x4,%esp
+  80233b:	ff 75 10             	push   0x10(%ebp)
+  80233e:	ff 75 0c             	push   0xc(%ebp)
+  802341:	50                   	push   %eax
+  802342:	e8 07 01 00 00       	call   80244e <nsipc_accept>
+  802347:	83 c4 10             	add    $0x10,%esp
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	78 05                	js     802353 <accept+0x2d>
+  80234e:	e8 5f ff ff ff       	call   8022b2 <alloc_sockfd>
+  802353:	c9                   	leave
+  802354:	c3                   	ret
+
+00802355 <bind>:
+  802355:	55                   	push   %ebp
+  802356:	89 e5                	mov    %esp,%ebp
+  802358:	83 ec 08             	sub    $0x8,%esp
+  80235b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235e:	e8 1f ff ff ff       	call   802282 <fd2sockid>
+  802363:	85 c0                	test   %eax,%eax
+  802365:	78 12                	js     802379 <bind+0x24>
+  802367:	83 ec 04             	sub    $0x4,%esp
+  80236a:	ff 75 10             	push   0x10(%ebp)
+  80236d:	ff 75 0c             	push   0xc(%ebp)
+  802370:	50                   	push   %eax
+  802371:	e8 24 01 00 00       	call   80249a <nsipc_bind>
+  802376:	83 c4 10             	add    $0x10,%esp
+  802379:	c9                   	leave
+  80237a:	c3                   	ret
+
+0080237b <shutdown>:
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	83 ec 08             	sub    $0x8,%esp
+  802381:	8b 45 08             	mov    0x8(%ebp),%eax
+  802384:	e8 f9 fe ff ff       	call   802282 <fd2sockid>
+  802389:	85 c0                	test   %eax,%eax
+  80238b:	78 0f                	js     80239c <shutdown+0x21>
+  80238d:	83 ec 08             	sub    $0x8,%esp
+  802390:	ff 75 0c             	push   0xc(%ebp)
+  802393:	50                   	push   %eax
+  802394:	e8 36 01 00 00       	call   8024cf <nsipc_shutdown>
+  802399:	83 c4 10             	add    $0x10,%esp
+  80239c:	c9                   	leave
+  80239d:	c3                   	ret
+
+0080239e <connect>:
+  80239e:	55                   	push   %ebp
+  80239f:	89 e5                	mov    %esp,%ebp
+  8023a1:	83 ec 08             	sub    $0x8,%esp
+  8023a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a7:	e8 d6 fe ff ff       	call   802282 <fd2sockid>
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 12                	js     8023c2 <connect+0x24>
+  8023b0:	83 ec 04             	sub    $0x4,%esp
+  8023b3:	ff 75 10             	push   0x10(%ebp)
+  8023b6:	ff 75 0c             	push   0xc(%ebp)
+  8023b9:	50                   	push   %eax
+  8023ba:	e8 4c 01 00 00       	call   80250b <nsipc_connect>
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	c9                   	leave
+  8023c3:	c3                   	ret
+
+008023c4 <listen>:
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	83 ec 08             	sub    $0x8,%esp
+  8023ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023cd:	e8 b0 fe ff ff       	call   802282 <fd2sockid>
+  8023d2:	85 c0                	test   %eax,%eax
+  8023d4:	78 0f                	js     8023e5 <listen+0x21>
+  8023d6:	83 ec 08             	sub    $0x8,%esp
+  8023d9:	ff 75 0c             	push   0xc(%ebp)
+  8023dc:	50                   	push   %eax
+  8023dd:	e8 5e 01 00 00       	call   802540 <nsipc_listen>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+  8023e5:	c9                   	leave
+  8023e6:	c3                   	ret
+
+008023e7 <socket>:
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	83 ec 0c             	sub    $0xc,%esp
+  8023ed:	ff 75 10             	push   0x10(%ebp)
+  8023f0:	ff 75 0c             	push   0xc(%ebp)
+  8023f3:	ff 75 08             	push   0x8(%ebp)
+  8023f6:	e8 34 02 00 00       	call   80262f <nsipc_socket>
+  8023fb:	83 c4 10             	add    $0x10,%esp
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	78 05                	js     802407 <socket+0x20>
+  802402:	e8 ab fe ff ff       	call   8022b2 <alloc_sockfd>
+  802407:	c9                   	leave
+  802408:	c3                   	ret
+
+00802409 <nsipc>:
+  802409:	55                   	push   %ebp
+  80240a:	89 e5                	mov    %esp,%ebp
+  80240c:	53                   	push   %ebx
+  80240d:	83 ec 04             	sub    $0x4,%esp
+  802410:	89 c3                	mov    %eax,%ebx
+  802412:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802419:	74 1f                	je     80243a <nsipc+0x31>
+  80241b:	83 ec 08             	sub    $0x8,%esp
+  80241e:	6a 00                	push   $0x0
+  802420:	6a 00                	push   $0x0
+  802422:	6a 07                	push   $0x7
+  802424:	68 00 70 c0 00       	push   $0xc07000
+  802429:	53                   	push   %ebx
+  80242a:	ff 35 0c 50 80 00    	push   0x80500c
+  802430:	e8 d7 09 00 00       	call   802e0c <ipc_call>
+  802435:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802438:	c9                   	leave
+  802439:	c3                   	ret
+  80243a:	83 ec 0c             	sub    $0xc,%esp
+  80243d:	6a 03                	push   $0x3
+  80243f:	e8 63 0b 00 00       	call   802fa7 <ipc_find_env>
+  802444:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	eb cd                	jmp    80241b <nsipc+0x12>
+
+0080244e <nsipc_accept>:
+  80244e:	55                   	push   %ebp
+  80244f:	89 e5                	mov    %esp,%ebp
+  802451:	53                   	push   %ebx
+  802452:	83 ec 04             	sub    $0x4,%esp
+  802455:	8b 45 08             	mov    0x8(%ebp),%eax
+  802458:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  80245d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802462:	e8 a2 ff ff ff       	call   802409 <nsipc>
+  802467:	89 c3                	mov    %eax,%ebx
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	79 07                	jns    802474 <nsipc_accept+0x26>
+  80246d:	89 d8                	mov    %ebx,%eax
+  80246f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802472:	c9                   	leave
+  802473:	c3                   	ret
+  802474:	83 ec 04             	sub    $0x4,%esp
+  802477:	ff 35 10 70 c0 00    	push   0xc07010
+  80247d:	68 00 70 c0 00       	push   $0xc07000
+  802482:	ff 75 0c             	push   0xc(%ebp)
+  802485:	e8 4d e6 ff ff       	call   800ad7 <memmove>
+  80248a:	8b 15 10 70 c0 00    	mov    0xc07010,%edx
+  802490:	8b 45 10             	mov    0x10(%ebp),%eax
+  802493:	89 10                	mov    %edx,(%eax)
+  802495:	83 c4 10             	add    $0x10,%esp
+  802498:	eb d3                	jmp    80246d <nsipc_accept+0x1f>
+
+0080249a <nsipc_bind>:
+  80249a:	55                   	push   %ebp
+  80249b:	89 e5                	mov    %esp,%ebp
+  80249d:	53                   	push   %ebx
+  80249e:	83 ec 08             	sub    $0x8,%esp
+  8024a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a7:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  8024ac:	53                   	push   %ebx
+  8024ad:	ff 75 0c             	push   0xc(%ebp)
+  8024b0:	68 04 70 c0 00       	push   $0xc07004
+  8024b5:	e8 1d e6 ff ff       	call   800ad7 <memmove>
+  8024ba:	89 1d 14 70 c0 00    	mov    %ebx,0xc07014
+  8024c0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024c5:	e8 3f ff ff ff       	call   802409 <nsipc>
+  8024ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024cd:	c9                   	leave
+  8024ce:	c3                   	ret
+
+008024cf <nsipc_shutdown>:
+  8024cf:	55                   	push   %ebp
+  8024d0:	89 e5                	mov    %esp,%ebp
+  8024d2:	83 ec 08             	sub    $0x8,%esp
+  8024d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d8:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  8024dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024e0:	a3 04 70 c0 00       	mov    %eax,0xc07004
+  8024e5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024ea:	e8 1a ff ff ff       	call   802409 <nsipc>
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+
+008024f1 <nsipc_close>:
+  8024f1:	55                   	push   %ebp
+  8024f2:	89 e5                	mov    %esp,%ebp
+  8024f4:	83 ec 08             	sub    $0x8,%esp
+  8024f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024fa:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  8024ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  802504:	e8 00 ff ff ff       	call   802409 <nsipc>
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+
+0080250b <nsipc_connect>:
+  80250b:	55                   	push   %ebp
+  80250c:	89 e5                	mov    %esp,%ebp
+  80250e:	53                   	push   %ebx
+  80250f:	83 ec 08             	sub    $0x8,%esp
+  802512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802515:	8b 45 08             	mov    0x8(%ebp),%eax
+  802518:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  80251d:	53                   	push   %ebx
+  80251e:	ff 75 0c             	push   0xc(%ebp)
+  802521:	68 04 70 c0 00       	push   $0xc07004
+  802526:	e8 ac e5 ff ff       	call   800ad7 <memmove>
+  80252b:	89 1d 14 70 c0 00    	mov    %ebx,0xc07014
+  802531:	b8 05 00 00 00       	mov    $0x5,%eax
+  802536:	e8 ce fe ff ff       	call   802409 <nsipc>
+  80253b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80253e:	c9                   	leave
+  80253f:	c3                   	ret
+
+00802540 <nsipc_listen>:
+  802540:	55                   	push   %ebp
+  802541:	89 e5                	mov    %esp,%ebp
+  802543:	83 ec 08             	sub    $0x8,%esp
+  802546:	8b 45 08             	mov    0x8(%ebp),%eax
+  802549:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  80254e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802551:	a3 04 70 c0 00       	mov    %eax,0xc07004
+  802556:	b8 06 00 00 00       	mov    $0x6,%eax
+  80255b:	e8 a9 fe ff ff       	call   802409 <nsipc>
+  802560:	c9                   	leave
+  802561:	c3                   	ret
+
+00802562 <nsipc_recv>:
+  802562:	55                   	push   %ebp
+  802563:	89 e5                	mov    %esp,%ebp
+  802565:	56                   	push   %esi
+  802566:	53                   	push   %ebx
+  802567:	8b 75 10             	mov    0x10(%ebp),%esi
+  80256a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80256d:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  802572:	89 35 04 70 c0 00    	mov    %esi,0xc07004
+  802578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80257b:	a3 08 70 c0 00       	mov    %eax,0xc07008
+  802580:	b8 07 00 00 00       	mov    $0x7,%eax
+  802585:	e8 7f fe ff ff       	call   802409 <nsipc>
+  80258a:	89 c3                	mov    %eax,%ebx
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	78 22                	js     8025b2 <nsipc_recv+0x50>
+  802590:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802595:	39 c6                	cmp    %eax,%esi
+  802597:	0f 4e c6             	cmovle %esi,%eax
+  80259a:	39 c3                	cmp    %eax,%ebx
+  80259c:	7f 1d                	jg     8025bb <nsipc_recv+0x59>
+  80259e:	83 ec 04             	sub    $0x4,%esp
+  8025a1:	53                   	push   %ebx
+  8025a2:	68 00 70 c0 00       	push   $0xc07000
+  8025a7:	ff 75 0c             	push   0xc(%ebp)
+  8025aa:	e8 28 e5 ff ff       	call   800ad7 <memmove>
+  8025af:	83 c4 10             	add    $0x10,%esp
+  8025b2:	89 d8                	mov    %ebx,%eax
+  8025b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025b7:	5b                   	pop    %ebx
+  8025b8:	5e                   	pop    %esi
+  8025b9:	5d                   	pop    %ebp
+  8025ba:	c3                   	ret
+  8025bb:	68 b4 36 80 00       	push   $0x8036b4
+  8025c0:	68 c9 36 80 00       	push   $0x8036c9
+  8025c5:	6a 60                	push   $0x60
+  8025c7:	68 de 36 80 00       	push   $0x8036de
+  8025cc:	e8 84 db ff ff       	call   800155 <_panic>
+
+008025d1 <nsipc_send>:
+  8025d1:	55                   	push   %ebp
+  8025d2:	89 e5                	mov    %esp,%ebp
+  8025d4:	53                   	push   %ebx
+  8025d5:	83 ec 04             	sub    $0x4,%esp
+  8025d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025de:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  8025e3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8025e9:	7f 2e                	jg     802619 <nsipc_send+0x48>
+  8025eb:	83 ec 04             	sub    $0x4,%esp
+  8025ee:	53                   	push   %ebx
+  8025ef:	ff 75 0c             	push   0xc(%ebp)
+  8025f2:	68 0c 70 c0 00       	push   $0xc0700c
+  8025f7:	e8 db e4 ff ff       	call   800ad7 <memmove>
+  8025fc:	89 1d 04 70 c0 00    	mov    %ebx,0xc07004
+  802602:	8b 45 14             	mov    0x14(%ebp),%eax
+  802605:	a3 08 70 c0 00       	mov    %eax,0xc07008
+  80260a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80260f:	e8 f5 fd ff ff       	call   802409 <nsipc>
+  802614:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802617:	c9                   	leave
+  802618:	c3                   	ret
+  802619:	68 ea 36 80 00       	push   $0x8036ea
+  80261e:	68 c9 36 80 00       	push   $0x8036c9
+  802623:	6a 6b                	push   $0x6b
+  802625:	68 de 36 80 00       	push   $0x8036de
+  80262a:	e8 26 db ff ff       	call   800155 <_panic>
+
+0080262f <nsipc_socket>:
+  80262f:	55                   	push   %ebp
+  802630:	89 e5                	mov    %esp,%ebp
+  802632:	83 ec 08             	sub    $0x8,%esp
+  802635:	8b 45 08             	mov    0x8(%ebp),%eax
+  802638:	a3 00 70 c0 00       	mov    %eax,0xc07000
+  80263d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802640:	a3 04 70 c0 00       	mov    %eax,0xc07004
+  802645:	8b 45 10             	mov    0x10(%ebp),%eax
+  802648:	a3 08 70 c0 00       	mov    %eax,0xc07008
+  80264d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802652:	e8 b2 fd ff ff       	call   802409 <nsipc>
+  802657:	c9                   	leave
+  802658:	c3                   	ret
+
+00802659 <devpipe_stat>:
+  802659:	55                   	push   %ebp
+  80265a:	89 e5                	mov    %esp,%ebp
+  80265c:	56                   	push   %esi
+  80265d:	53                   	push   %ebx
+  80265e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802661:	83 ec 0c             	sub    $0xc,%esp
+  802664:	ff 75 08             	push   0x8(%ebp)
+  802667:	e8 99 ef ff ff       	call   801605 <fd2data>
+  80266c:	89 c6                	mov    %eax,%esi
+  80266e:	83 c4 08             	add    $0x8,%esp
+  802671:	68 f6 36 80 00       	push   $0x8036f6
+  802676:	53                   	push   %ebx
+  802677:	e8 ab e2 ff ff       	call   800927 <strcpy>
+  80267c:	8b 46 04             	mov    0x4(%esi),%eax
+  80267f:	2b 06                	sub    (%esi),%eax
+  802681:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802687:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80268e:	00 00 00 
+  802691:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802698:	40 80 00 
+  80269b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a3:	5b                   	pop    %ebx
+  8026a4:	5e                   	pop    %esi
+  8026a5:	5d                   	pop    %ebp
+  8026a6:	c3                   	ret
+
+008026a7 <devpipe_close>:
+  8026a7:	55                   	push   %ebp
+  8026a8:	89 e5                	mov    %esp,%ebp
+  8026aa:	53                   	push   %ebx
+  8026ab:	83 ec 0c             	sub    $0xc,%esp
+  8026ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026b1:	53                   	push   %ebx
+  8026b2:	6a 00                	push   $0x0
+  8026b4:	e8 a0 e7 ff ff       	call   800e59 <sys_page_unmap>
+  8026b9:	89 1c 24             	mov    %ebx,(%esp)
+  8026bc:	e8 44 ef ff ff       	call   801605 <fd2data>
+  8026c1:	83 c4 08             	add    $0x8,%esp
+  8026c4:	50                   	push   %eax
+  8026c5:	6a 00                	push   $0x0
+  8026c7:	e8 8d e7 ff ff       	call   800e59 <sys_page_unmap>
+  8026cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026cf:	c9                   	leave
+  8026d0:	c3                   	ret
+
+008026d1 <_pipeisclosed>:
+  8026d1:	55                   	push   %ebp
+  8026d2:	89 e5                	mov    %esp,%ebp
+  8026d4:	57                   	push   %edi
+  8026d5:	56                   	push   %esi
+  8026d6:	53                   	push   %ebx
+  8026d7:	83 ec 1c             	sub    $0x1c,%esp
+  8026da:	89 c7                	mov    %eax,%edi
+  8026dc:	89 d6                	mov    %edx,%esi
+  8026de:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  8026e3:	8b 58 58             	mov    0x58(%eax),%ebx
+  8026e6:	83 ec 0c             	sub    $0xc,%esp
+  8026e9:	57                   	push   %edi
+  8026ea:	e8 d2 08 00 00       	call   802fc1 <pageref>
+  8026ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026f2:	89 34 24             	mov    %esi,(%esp)
+  8026f5:	e8 c7 08 00 00       	call   802fc1 <pageref>
+  8026fa:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+  802700:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802703:	83 c4 10             	add    $0x10,%esp
+  802706:	39 cb                	cmp    %ecx,%ebx
+  802708:	74 1b                	je     802725 <_pipeisclosed+0x54>
+  80270a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80270d:	75 cf                	jne    8026de <_pipeisclosed+0xd>
+  80270f:	8b 42 58             	mov    0x58(%edx),%eax
+  802712:	6a 01                	push   $0x1
+  802714:	50                   	push   %eax
+  802715:	53                   	push   %ebx
+  802716:	68 fd 36 80 00       	push   $0x8036fd
+  80271b:	e8 10 db ff ff       	call   800230 <cprintf>
+  802720:	83 c4 10             	add    $0x10,%esp
+  802723:	eb b9                	jmp    8026de <_pipeisclosed+0xd>
+  802725:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802728:	0f 94 c0             	sete   %al
+  80272b:	0f b6 c0             	movzbl %al,%eax
+  80272e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802731:	5b                   	pop    %ebx
+  802732:	5e                   	pop    %esi
+  802733:	5f                   	pop    %edi
+  802734:	5d                   	pop    %ebp
+  802735:	c3                   	ret
+
+00802736 <devpipe_write>:
+  802736:	55                   	push   %ebp
+  802737:	89 e5                	mov    %esp,%ebp
+  802739:	57                   	push   %edi
+  80273a:	56                   	push   %esi
+  80273b:	53                   	push   %ebx
+  80273c:	83 ec 28             	sub    $0x28,%esp
+  80273f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802742:	56                   	push   %esi
+  802743:	e8 bd ee ff ff       	call   801605 <fd2data>
+  802748:	89 c3                	mov    %eax,%ebx
+  80274a:	83 c4 10             	add    $0x10,%esp
+  80274d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802752:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802756:	74 5c                	je     8027b4 <devpipe_write+0x7e>
+  802758:	8b 43 04             	mov    0x4(%ebx),%eax
+  80275b:	8b 0b                	mov    (%ebx),%ecx
+  80275d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802760:	39 d0                	cmp    %edx,%eax
+  802762:	72 1e                	jb     802782 <devpipe_write+0x4c>
+  802764:	89 da                	mov    %ebx,%edx
+  802766:	89 f0                	mov    %esi,%eax
+  802768:	e8 64 ff ff ff       	call   8026d1 <_pipeisclosed>
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	75 48                	jne    8027b9 <devpipe_write+0x83>
+  802771:	e8 c6 e5 ff ff       	call   800d3c <sys_yield>
+  802776:	8b 43 04             	mov    0x4(%ebx),%eax
+  802779:	8b 0b                	mov    (%ebx),%ecx
+  80277b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80277e:	39 d0                	cmp    %edx,%eax
+  802780:	73 e2                	jae    802764 <devpipe_write+0x2e>
+  802782:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802785:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802789:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80278c:	89 c2                	mov    %eax,%edx
+  80278e:	c1 fa 1f             	sar    $0x1f,%edx
+  802791:	89 d1                	mov    %edx,%ecx
+  802793:	c1 e9 1b             	shr    $0x1b,%ecx
+  802796:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802799:	83 e2 1f             	and    $0x1f,%edx
+  80279c:	29 ca                	sub    %ecx,%edx
+  80279e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8027a2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8027a6:	83 c0 01             	add    $0x1,%eax
+  8027a9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8027ac:	83 c7 01             	add    $0x1,%edi
+  8027af:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8027b2:	75 a4                	jne    802758 <devpipe_write+0x22>
+  8027b4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027b7:	eb 05                	jmp    8027be <devpipe_write+0x88>
+  8027b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c1:	5b                   	pop    %ebx
+  8027c2:	5e                   	pop    %esi
+  8027c3:	5f                   	pop    %edi
+  8027c4:	5d                   	pop    %ebp
+  8027c5:	c3                   	ret
+
+008027c6 <devpipe_read>:
+  8027c6:	55                   	push   %ebp
+  8027c7:	89 e5                	mov    %esp,%ebp
+  8027c9:	57                   	push   %edi
+  8027ca:	56                   	push   %esi
+  8027cb:	53                   	push   %ebx
+  8027cc:	83 ec 18             	sub    $0x18,%esp
+  8027cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027d2:	56                   	push   %esi
+  8027d3:	e8 2d ee ff ff       	call   801605 <fd2data>
+  8027d8:	89 c3                	mov    %eax,%ebx
+  8027da:	83 c4 10             	add    $0x10,%esp
+  8027dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027e6:	74 45                	je     80282d <devpipe_read+0x67>
+  8027e8:	8b 03                	mov    (%ebx),%eax
+  8027ea:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027ed:	75 1d                	jne    80280c <devpipe_read+0x46>
+  8027ef:	85 ff                	test   %edi,%edi
+  8027f1:	75 3f                	jne    802832 <devpipe_read+0x6c>
+  8027f3:	89 da                	mov    %ebx,%edx
+  8027f5:	89 f0                	mov    %esi,%eax
+  8027f7:	e8 d5 fe ff ff       	call   8026d1 <_pipeisclosed>
+  8027fc:	85 c0                	test   %eax,%eax
+  8027fe:	75 3c                	jne    80283c <devpipe_read+0x76>
+  802800:	e8 37 e5 ff ff       	call   800d3c <sys_yield>
+  802805:	8b 03                	mov    (%ebx),%eax
+  802807:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80280a:	74 e7                	je     8027f3 <devpipe_read+0x2d>
+  80280c:	99                   	cltd
+  80280d:	c1 ea 1b             	shr    $0x1b,%edx
+  802810:	01 d0                	add    %edx,%eax
+  802812:	83 e0 1f             	and    $0x1f,%eax
+  802815:	29 d0                	sub    %edx,%eax
+  802817:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80281c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80281f:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802822:	83 03 01             	addl   $0x1,(%ebx)
+  802825:	83 c7 01             	add    $0x1,%edi
+  802828:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80282b:	75 bb                	jne    8027e8 <devpipe_read+0x22>
+  80282d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802830:	eb 02                	jmp    802834 <devpipe_read+0x6e>
+  802832:	89 f8                	mov    %edi,%eax
+  802834:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802837:	5b                   	pop    %ebx
+  802838:	5e                   	pop    %esi
+  802839:	5f                   	pop    %edi
+  80283a:	5d                   	pop    %ebp
+  80283b:	c3                   	ret
+  80283c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802841:	eb f1                	jmp    802834 <devpipe_read+0x6e>
+
+00802843 <pipe>:
+  802843:	55                   	push   %ebp
+  802844:	89 e5                	mov    %esp,%ebp
+  802846:	56                   	push   %esi
+  802847:	53                   	push   %ebx
+  802848:	83 ec 1c             	sub    $0x1c,%esp
+  80284b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80284e:	50                   	push   %eax
+  80284f:	e8 c8 ed ff ff       	call   80161c <fd_alloc>
+  802854:	89 c3                	mov    %eax,%ebx
+  802856:	83 c4 10             	add    $0x10,%esp
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	0f 88 23 01 00 00    	js     802984 <pipe+0x141>
+  802861:	83 ec 04             	sub    $0x4,%esp
+  802864:	68 07 04 00 00       	push   $0x407
+  802869:	ff 75 f4             	push   -0xc(%ebp)
+  80286c:	6a 00                	push   $0x0
+  80286e:	e8 14 e5 ff ff       	call   800d87 <sys_page_alloc>
+  802873:	89 c3                	mov    %eax,%ebx
+  802875:	83 c4 10             	add    $0x10,%esp
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	0f 88 04 01 00 00    	js     802984 <pipe+0x141>
+  802880:	83 ec 0c             	sub    $0xc,%esp
+  802883:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802886:	50                   	push   %eax
+  802887:	e8 90 ed ff ff       	call   80161c <fd_alloc>
+  80288c:	89 c3                	mov    %eax,%ebx
+  80288e:	83 c4 10             	add    $0x10,%esp
+  802891:	85 c0                	test   %eax,%eax
+  802893:	0f 88 db 00 00 00    	js     802974 <pipe+0x131>
+  802899:	83 ec 04             	sub    $0x4,%esp
+  80289c:	68 07 04 00 00       	push   $0x407
+  8028a1:	ff 75 f0             	push   -0x10(%ebp)
+  8028a4:	6a 00                	push   $0x0
+  8028a6:	e8 dc e4 ff ff       	call   800d87 <sys_page_alloc>
+  8028ab:	89 c3                	mov    %eax,%ebx
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	0f 88 bc 00 00 00    	js     802974 <pipe+0x131>
+  8028b8:	83 ec 0c             	sub    $0xc,%esp
+  8028bb:	ff 75 f4             	push   -0xc(%ebp)
+  8028be:	e8 42 ed ff ff       	call   801605 <fd2data>
+  8028c3:	89 c6                	mov    %eax,%esi
+  8028c5:	83 c4 0c             	add    $0xc,%esp
+  8028c8:	68 07 04 00 00       	push   $0x407
+  8028cd:	50                   	push   %eax
+  8028ce:	6a 00                	push   $0x0
+  8028d0:	e8 b2 e4 ff ff       	call   800d87 <sys_page_alloc>
+  8028d5:	89 c3                	mov    %eax,%ebx
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	0f 88 82 00 00 00    	js     802964 <pipe+0x121>
+  8028e2:	83 ec 0c             	sub    $0xc,%esp
+  8028e5:	ff 75 f0             	push   -0x10(%ebp)
+  8028e8:	e8 18 ed ff ff       	call   801605 <fd2data>
+  8028ed:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028f4:	50                   	push   %eax
+  8028f5:	6a 00                	push   $0x0
+  8028f7:	56                   	push   %esi
+  8028f8:	6a 00                	push   $0x0
+  8028fa:	e8 cb e4 ff ff       	call   800dca <sys_page_map>
+  8028ff:	89 c3                	mov    %eax,%ebx
+  802901:	83 c4 20             	add    $0x20,%esp
+  802904:	85 c0                	test   %eax,%eax
+  802906:	78 4e                	js     802956 <pipe+0x113>
+  802908:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80290d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802910:	89 02                	mov    %eax,(%edx)
+  802912:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802915:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80291c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80291f:	89 02                	mov    %eax,(%edx)
+  802921:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802924:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80292b:	83 ec 0c             	sub    $0xc,%esp
+  80292e:	ff 75 f4             	push   -0xc(%ebp)
+  802931:	e8 bf ec ff ff       	call   8015f5 <fd2num>
+  802936:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802939:	89 01                	mov    %eax,(%ecx)
+  80293b:	83 c4 04             	add    $0x4,%esp
+  80293e:	ff 75 f0             	push   -0x10(%ebp)
+  802941:	e8 af ec ff ff       	call   8015f5 <fd2num>
+  802946:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802949:	89 41 04             	mov    %eax,0x4(%ecx)
+  80294c:	83 c4 10             	add    $0x10,%esp
+  80294f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802954:	eb 2e                	jmp    802984 <pipe+0x141>
+  802956:	83 ec 08             	sub    $0x8,%esp
+  802959:	56                   	push   %esi
+  80295a:	6a 00                	push   $0x0
+  80295c:	e8 f8 e4 ff ff       	call   800e59 <sys_page_unmap>
+  802961:	83 c4 10             	add    $0x10,%esp
+  802964:	83 ec 08             	sub    $0x8,%esp
+  802967:	ff 75 f0             	push   -0x10(%ebp)
+  80296a:	6a 00                	push   $0x0
+  80296c:	e8 e8 e4 ff ff       	call   800e59 <sys_page_unmap>
+  802971:	83 c4 10             	add    $0x10,%esp
+  802974:	83 ec 08             	sub    $0x8,%esp
+  802977:	ff 75 f4             	push   -0xc(%ebp)
+  80297a:	6a 00                	push   $0x0
+  80297c:	e8 d8 e4 ff ff       	call   800e59 <sys_page_unmap>
+  802981:	83 c4 10             	add    $0x10,%esp
+  802984:	89 d8                	mov    %ebx,%eax
+  802986:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802989:	5b                   	pop    %ebx
+  80298a:	5e                   	pop    %esi
+  80298b:	5d                   	pop    %ebp
+  80298c:	c3                   	ret
+
+0080298d <pipeisclosed>:
+  80298d:	55                   	push   %ebp
+  80298e:	89 e5                	mov    %esp,%ebp
+  802990:	83 ec 20             	sub    $0x20,%esp
+  802993:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802996:	50                   	push   %eax
+  802997:	ff 75 08             	push   0x8(%ebp)
+  80299a:	e8 cd ec ff ff       	call   80166c <fd_lookup>
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	78 18                	js     8029be <pipeisclosed+0x31>
+  8029a6:	83 ec 0c             	sub    $0xc,%esp
+  8029a9:	ff 75 f4             	push   -0xc(%ebp)
+  8029ac:	e8 54 ec ff ff       	call   801605 <fd2data>
+  8029b1:	89 c2                	mov    %eax,%edx
+  8029b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029b6:	e8 16 fd ff ff       	call   8026d1 <_pipeisclosed>
+  8029bb:	83 c4 10             	add    $0x10,%esp
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+
+008029c0 <ipcring_init>:
+  8029c0:	55                   	push   %ebp
+  8029c1:	89 e5                	mov    %esp,%ebp
+  8029c3:	53                   	push   %ebx
+  8029c4:	83 ec 08             	sub    $0x8,%esp
+  8029c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029ca:	6a 60                	push   $0x60
+  8029cc:	6a 00                	push   $0x0
+  8029ce:	53                   	push   %ebx
+  8029cf:	e8 ce e0 ff ff       	call   800aa2 <memset>
+  8029d4:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  8029d9:	8b 40 48             	mov    0x48(%eax),%eax
+  8029dc:	89 03                	mov    %eax,(%ebx)
+  8029de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029e1:	89 43 04             	mov    %eax,0x4(%ebx)
+  8029e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029e7:	89 43 08             	mov    %eax,0x8(%ebx)
+  8029ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ed:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8029f0:	83 c4 10             	add    $0x10,%esp
+  8029f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f6:	c9                   	leave
+  8029f7:	c3                   	ret
+
+008029f8 <ipcring_req_slot>:
+  8029f8:	55                   	push   %ebp
+  8029f9:	89 e5                	mov    %esp,%ebp
+  8029fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fe:	8b 50 10             	mov    0x10(%eax),%edx
+  802a01:	8b 48 18             	mov    0x18(%eax),%ecx
+  802a04:	29 ca                	sub    %ecx,%edx
+  802a06:	83 fa 07             	cmp    $0x7,%edx
+  802a09:	77 0c                	ja     802a17 <ipcring_req_slot+0x1f>
+  802a0b:	8b 50 10             	mov    0x10(%eax),%edx
+  802a0e:	83 e2 07             	and    $0x7,%edx
+  802a11:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802a15:	5d                   	pop    %ebp
+  802a16:	c3                   	ret
+  802a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1c:	eb f7                	jmp    802a15 <ipcring_req_slot+0x1d>
+
+00802a1e <ipcring_req_push>:
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	83 ec 08             	sub    $0x8,%esp
+  802a24:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a27:	8b 42 10             	mov    0x10(%edx),%eax
+  802a2a:	83 c0 01             	add    $0x1,%eax
+  802a2d:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a36:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802a3a:	85 c0                	test   %eax,%eax
+  802a3c:	75 02                	jne    802a40 <ipcring_req_push+0x22>
+  802a3e:	c9                   	leave
+  802a3f:	c3                   	ret
+  802a40:	6a 00                	push   $0x0
+  802a42:	68 00 00 80 ee       	push   $0xee800000
+  802a47:	ff 72 08             	push   0x8(%edx)
+  802a4a:	ff 72 04             	push   0x4(%edx)
+  802a4d:	e8 6d e6 ff ff       	call   8010bf <sys_ipc_send>
+  802a52:	83 c4 10             	add    $0x10,%esp
+  802a55:	eb e7                	jmp    802a3e <ipcring_req_push+0x20>
+
+00802a57 <ipcring_rsp_wait>:
+  802a57:	55                   	push   %ebp
+  802a58:	89 e5                	mov    %esp,%ebp
+  802a5a:	53                   	push   %ebx
+  802a5b:	83 ec 04             	sub    $0x4,%esp
+  802a5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a61:	8b 53 18             	mov    0x18(%ebx),%edx
+  802a64:	8b 43 10             	mov    0x10(%ebx),%eax
+  802a67:	39 c2                	cmp    %eax,%edx
+  802a69:	74 3c                	je     802aa7 <ipcring_rsp_wait+0x50>
+  802a6b:	8b 53 14             	mov    0x14(%ebx),%edx
+  802a6e:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a71:	39 c2                	cmp    %eax,%edx
+  802a73:	75 23                	jne    802a98 <ipcring_rsp_wait+0x41>
+  802a75:	83 ec 08             	sub    $0x8,%esp
+  802a78:	6a 00                	push   $0x0
+  802a7a:	6a 00                	push   $0x0
+  802a7c:	6a 00                	push   $0x0
+  802a7e:	6a 00                	push   $0x0
+  802a80:	ff 73 0c             	push   0xc(%ebx)
+  802a83:	ff 73 04             	push   0x4(%ebx)
+  802a86:	e8 81 03 00 00       	call   802e0c <ipc_call>
+  802a8b:	8b 53 14             	mov    0x14(%ebx),%edx
+  802a8e:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a91:	83 c4 20             	add    $0x20,%esp
+  802a94:	39 c2                	cmp    %eax,%edx
+  802a96:	74 dd                	je     802a75 <ipcring_rsp_wait+0x1e>
+  802a98:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a9b:	83 e0 07             	and    $0x7,%eax
+  802a9e:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802aa2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa5:	c9                   	leave
+  802aa6:	c3                   	ret
+  802aa7:	68 18 37 80 00       	push   $0x803718
+  802aac:	68 c9 36 80 00       	push   $0x8036c9
+  802ab1:	6a 3b                	push   $0x3b
+  802ab3:	68 39 37 80 00       	push   $0x803739
+  802ab8:	e8 98 d6 ff ff       	call   800155 <_panic>
+
+00802abd <ipcring_rsp_pop>:
+  802abd:	55                   	push   %ebp
+  802abe:	89 e5                	mov    %esp,%ebp
+  802ac0:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ac3:	8b 42 18             	mov    0x18(%edx),%eax
+  802ac6:	83 c0 01             	add    $0x1,%eax
+  802ac9:	89 42 18             	mov    %eax,0x18(%edx)
+  802acc:	5d                   	pop    %ebp
+  802acd:	c3                   	ret
+
+00802ace <ipcring_server_init>:
+  802ace:	55                   	push   %ebp
+  802acf:	89 e5                	mov    %esp,%ebp
+  802ad1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ad7:	89 10                	mov    %edx,(%eax)
+  802ad9:	8b 55 10             	mov    0x10(%ebp),%edx
+  802adc:	89 50 04             	mov    %edx,0x4(%eax)
+  802adf:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802ae6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802aed:	5d                   	pop    %ebp
+  802aee:	c3                   	ret
+
+00802aef <ipcring_req_avail>:
+  802aef:	55                   	push   %ebp
+  802af0:	89 e5                	mov    %esp,%ebp
+  802af2:	8b 55 08             	mov    0x8(%ebp),%edx
+  802af5:	8b 02                	mov    (%edx),%eax
+  802af7:	8b 40 10             	mov    0x10(%eax),%eax
+  802afa:	2b 42 08             	sub    0x8(%edx),%eax
+  802afd:	ba 08 00 00 00       	mov    $0x8,%edx
+  802b02:	39 d0                	cmp    %edx,%eax
+  802b04:	0f 47 c2             	cmova  %edx,%eax
+  802b07:	5d                   	pop    %ebp
+  802b08:	c3                   	ret
+
+00802b09 <ipcring_req_peek>:
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b0f:	8b 42 08             	mov    0x8(%edx),%eax
+  802b12:	83 e0 07             	and    $0x7,%eax
+  802b15:	8b 12                	mov    (%edx),%edx
+  802b17:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802b1b:	5d                   	pop    %ebp
+  802b1c:	c3                   	ret
+
+00802b1d <ipcring_rsp_push>:
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	83 ec 08             	sub    $0x8,%esp
+  802b23:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b26:	8b 41 08             	mov    0x8(%ecx),%eax
+  802b29:	83 c0 01             	add    $0x1,%eax
+  802b2c:	89 41 08             	mov    %eax,0x8(%ecx)
+  802b2f:	8b 11                	mov    (%ecx),%edx
+  802b31:	83 c2 14             	add    $0x14,%edx
+  802b34:	f0 87 02             	lock xchg %eax,(%edx)
+  802b37:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802b3b:	75 02                	jne    802b3f <ipcring_rsp_push+0x22>
+  802b3d:	c9                   	leave
+  802b3e:	c3                   	ret
+  802b3f:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802b46:	6a 00                	push   $0x0
+  802b48:	68 00 00 80 ee       	push   $0xee800000
+  802b4d:	6a 00                	push   $0x0
+  802b4f:	ff 71 04             	push   0x4(%ecx)
+  802b52:	e8 8b e4 ff ff       	call   800fe2 <sys_ipc_try_send>
+  802b57:	83 c4 10             	add    $0x10,%esp
+  802b5a:	eb e1                	jmp    802b3d <ipcring_rsp_push+0x20>
+
+00802b5c <ipcring_client_wait>:
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	83 ec 08             	sub    $0x8,%esp
+  802b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b65:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802b6c:	8b 10                	mov    (%eax),%edx
+  802b6e:	8b 52 18             	mov    0x18(%edx),%edx
+  802b71:	3b 50 08             	cmp    0x8(%eax),%edx
+  802b74:	75 02                	jne    802b78 <ipcring_client_wait+0x1c>
+  802b76:	c9                   	leave
+  802b77:	c3                   	ret
+  802b78:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802b7f:	6a 00                	push   $0x0
+  802b81:	68 00 00 80 ee       	push   $0xee800000
+  802b86:	6a 00                	push   $0x0
+  802b88:	ff 70 04             	push   0x4(%eax)
+  802b8b:	e8 52 e4 ff ff       	call   800fe2 <sys_ipc_try_send>
+  802b90:	83 c4 10             	add    $0x10,%esp
+  802b93:	eb e1                	jmp    802b76 <ipcring_client_wait+0x1a>
+
+00802b95 <ipcring_server_sleep>:
+  802b95:	55                   	push   %ebp
+  802b96:	89 e5                	mov    %esp,%ebp
+  802b98:	53                   	push   %ebx
+  802b99:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b9c:	8b 01                	mov    (%ecx),%eax
+  802b9e:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802ba1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ba6:	f0 87 02             	lock xchg %eax,(%edx)
+  802ba9:	8b 11                	mov    (%ecx),%edx
+  802bab:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802bae:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bb3:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802bb6:	74 0e                	je     802bc6 <ipcring_server_sleep+0x31>
+  802bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbd:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc9:	c9                   	leave
+  802bca:	c3                   	ret
+
+00802bcb <devcons_close>:
+  802bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd0:	c3                   	ret
+
+00802bd1 <devcons_stat>:
+  802bd1:	55                   	push   %ebp
+  802bd2:	89 e5                	mov    %esp,%ebp
+  802bd4:	83 ec 10             	sub    $0x10,%esp
+  802bd7:	68 47 37 80 00       	push   $0x803747
+  802bdc:	ff 75 0c             	push   0xc(%ebp)
+  802bdf:	e8 43 dd ff ff       	call   800927 <strcpy>
+  802be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be9:	c9                   	leave
+  802bea:	c3                   	ret
+
+00802beb <devcons_write>:
+  802beb:	55                   	push   %ebp
+  802bec:	89 e5                	mov    %esp,%ebp
+  802bee:	57                   	push   %edi
+  802bef:	56                   	push   %esi
+  802bf0:	53                   	push   %ebx
+  802bf1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802bf7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802bfa:	85 ff                	test   %edi,%edi
+  802bfc:	74 51                	je     802c4f <devcons_write+0x64>
+  802bfe:	be 00 00 00 00       	mov    $0x0,%esi
+  802c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c08:	89 fb                	mov    %edi,%ebx
+  802c0a:	29 c3                	sub    %eax,%ebx
+  802c0c:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802c11:	39 d3                	cmp    %edx,%ebx
+  802c13:	0f 47 da             	cmova  %edx,%ebx
+  802c16:	83 ec 04             	sub    $0x4,%esp
+  802c19:	53                   	push   %ebx
+  802c1a:	03 45 0c             	add    0xc(%ebp),%eax
+  802c1d:	50                   	push   %eax
+  802c1e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802c24:	50                   	push   %eax
+  802c25:	e8 ad de ff ff       	call   800ad7 <memmove>
+  802c2a:	83 c4 08             	add    $0x8,%esp
+  802c2d:	53                   	push   %ebx
+  802c2e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802c34:	50                   	push   %eax
+  802c35:	e8 65 e0 ff ff       	call   800c9f <sys_cputs>
+  802c3a:	01 de                	add    %ebx,%esi
+  802c3c:	89 f0                	mov    %esi,%eax
+  802c3e:	83 c4 10             	add    $0x10,%esp
+  802c41:	39 fe                	cmp    %edi,%esi
+  802c43:	72 c3                	jb     802c08 <devcons_write+0x1d>
+  802c45:	89 f0                	mov    %esi,%eax
+  802c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c4a:	5b                   	pop    %ebx
+  802c4b:	5e                   	pop    %esi
+  802c4c:	5f                   	pop    %edi
+  802c4d:	5d                   	pop    %ebp
+  802c4e:	c3                   	ret
+  802c4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c54:	eb ef                	jmp    802c45 <devcons_write+0x5a>
+
+00802c56 <devcons_read>:
+  802c56:	55                   	push   %ebp
+  802c57:	89 e5                	mov    %esp,%ebp
+  802c59:	83 ec 08             	sub    $0x8,%esp
+  802c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c61:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c65:	75 07                	jne    802c6e <devcons_read+0x18>
+  802c67:	eb 1f                	jmp    802c88 <devcons_read+0x32>
+  802c69:	e8 ce e0 ff ff       	call   800d3c <sys_yield>
+  802c6e:	e8 4a e0 ff ff       	call   800cbd <sys_cgetc>
+  802c73:	85 c0                	test   %eax,%eax
+  802c75:	74 f2                	je     802c69 <devcons_read+0x13>
+  802c77:	78 0f                	js     802c88 <devcons_read+0x32>
+  802c79:	83 f8 04             	cmp    $0x4,%eax
+  802c7c:	74 0c                	je     802c8a <devcons_read+0x34>
+  802c7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c81:	88 02                	mov    %al,(%edx)
+  802c83:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c88:	c9                   	leave
+  802c89:	c3                   	ret
+  802c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8f:	eb f7                	jmp    802c88 <devcons_read+0x32>
+
+00802c91 <cputchar>:
+  802c91:	55                   	push   %ebp
+  802c92:	89 e5                	mov    %esp,%ebp
+  802c94:	83 ec 20             	sub    $0x20,%esp
+  802c97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9a:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802c9d:	6a 01                	push   $0x1
+  802c9f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ca2:	50                   	push   %eax
+  802ca3:	e8 f7 df ff ff       	call   800c9f <sys_cputs>
+  802ca8:	83 c4 10             	add    $0x10,%esp
+  802cab:	c9                   	leave
+  802cac:	c3                   	ret
+
+00802cad <getchar>:
+  802cad:	55                   	push   %ebp
+  802cae:	89 e5                	mov    %esp,%ebp
+  802cb0:	83 ec 1c             	sub    $0x1c,%esp
+  802cb3:	6a 01                	push   $0x1
+  802cb5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cb8:	50                   	push   %eax
+  802cb9:	6a 00                	push   $0x0
+  802cbb:	e8 0e ec ff ff       	call   8018ce <read>
+  802cc0:	83 c4 10             	add    $0x10,%esp
+  802cc3:	85 c0                	test   %eax,%eax
+  802cc5:	78 06                	js     802ccd <getchar+0x20>
+  802cc7:	74 06                	je     802ccf <getchar+0x22>
+  802cc9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802ccd:	c9                   	leave
+  802cce:	c3                   	ret
+  802ccf:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cd4:	eb f7                	jmp    802ccd <getchar+0x20>
+
+00802cd6 <iscons>:
+  802cd6:	55                   	push   %ebp
+  802cd7:	89 e5                	mov    %esp,%ebp
+  802cd9:	83 ec 20             	sub    $0x20,%esp
+  802cdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cdf:	50                   	push   %eax
+  802ce0:	ff 75 08             	push   0x8(%ebp)
+  802ce3:	e8 84 e9 ff ff       	call   80166c <fd_lookup>
+  802ce8:	83 c4 10             	add    $0x10,%esp
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	78 11                	js     802d00 <iscons+0x2a>
+  802cef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cf2:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802cf8:	39 10                	cmp    %edx,(%eax)
+  802cfa:	0f 94 c0             	sete   %al
+  802cfd:	0f b6 c0             	movzbl %al,%eax
+  802d00:	c9                   	leave
+  802d01:	c3                   	ret
+
+00802d02 <opencons>:
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	83 ec 24             	sub    $0x24,%esp
+  802d08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d0b:	50                   	push   %eax
+  802d0c:	e8 0b e9 ff ff       	call   80161c <fd_alloc>
+  802d11:	83 c4 10             	add    $0x10,%esp
+  802d14:	85 c0                	test   %eax,%eax
+  802d16:	78 3a                	js     802d52 <opencons+0x50>
+  802d18:	83 ec 04             	sub    $0x4,%esp
+  802d1b:	68 07 04 00 00       	push   $0x407
+  802d20:	ff 75 f4             	push   -0xc(%ebp)
+  802d23:	6a 00                	push   $0x0
+  802d25:	e8 5d e0 ff ff       	call   800d87 <sys_page_alloc>
+  802d2a:	83 c4 10             	add    $0x10,%esp
+  802d2d:	85 c0                	test   %eax,%eax
+  802d2f:	78 21                	js     802d52 <opencons+0x50>
+  802d31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d34:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802d3a:	89 10                	mov    %edx,(%eax)
+  802d3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d3f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802d46:	83 ec 0c             	sub    $0xc,%esp
+  802d49:	50                   	push   %eax
+  802d4a:	e8 a6 e8 ff ff       	call   8015f5 <fd2num>
+  802d4f:	83 c4 10             	add    $0x10,%esp
+  802d52:	c9                   	leave
+  802d53:	c3                   	ret
+
+00802d54 <ipc_recv>:
+  802d54:	55                   	push   %ebp
+  802d55:	89 e5                	mov    %esp,%ebp
+  802d57:	56                   	push   %esi
+  802d58:	53                   	push   %ebx
+  802d59:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d62:	85 c0                	test   %eax,%eax
+  802d64:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802d69:	0f 44 c2             	cmove  %edx,%eax
+  802d6c:	83 ec 0c             	sub    $0xc,%esp
+  802d6f:	50                   	push   %eax
+  802d70:	e8 bd e2 ff ff       	call   801032 <sys_ipc_recv>
+  802d75:	83 c4 10             	add    $0x10,%esp
+  802d78:	85 c0                	test   %eax,%eax
+  802d7a:	78 2a                	js     802da6 <ipc_recv+0x52>
+  802d7c:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  802d81:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802d87:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802d8d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d93:	85 f6                	test   %esi,%esi
+  802d95:	74 02                	je     802d99 <ipc_recv+0x45>
+  802d97:	89 0e                	mov    %ecx,(%esi)
+  802d99:	85 db                	test   %ebx,%ebx
+  802d9b:	74 02                	je     802d9f <ipc_recv+0x4b>
+  802d9d:	89 13                	mov    %edx,(%ebx)
+  802d9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802da2:	5b                   	pop    %ebx
+  802da3:	5e                   	pop    %esi
+  802da4:	5d                   	pop    %ebp
+  802da5:	c3                   	ret
+  802da6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802db0:	eb e1                	jmp    802d93 <ipc_recv+0x3f>
+
+00802db2 <ipc_send>:
+  802db2:	55                   	push   %ebp
+  802db3:	89 e5                	mov    %esp,%ebp
+  802db5:	57                   	push   %edi
+  802db6:	56                   	push   %esi
+  802db7:	53                   	push   %ebx
+  802db8:	83 ec 0c             	sub    $0xc,%esp
+  802dbb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802dbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dc1:	8b 75 14             	mov    0x14(%ebp),%esi
+  802dc4:	85 db                	test   %ebx,%ebx
+  802dc6:	74 1e                	je     802de6 <ipc_send+0x34>
+  802dc8:	56                   	push   %esi
+  802dc9:	53                   	push   %ebx
+  802dca:	57                   	push   %edi
+  802dcb:	ff 75 08             	push   0x8(%ebp)
+  802dce:	e8 ec e2 ff ff       	call   8010bf <sys_ipc_send>
+  802dd3:	83 c4 10             	add    $0x10,%esp
+  802dd6:	85 c0                	test   %eax,%eax
+  802dd8:	74 2a                	je     802e04 <ipc_send+0x52>
+  802dda:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ddd:	75 13                	jne    802df2 <ipc_send+0x40>
+  802ddf:	e8 58 df ff ff       	call   800d3c <sys_yield>
+  802de4:	eb e2                	jmp    802dc8 <ipc_send+0x16>
+  802de6:	be 00 00 00 00       	mov    $0x0,%esi
+  802deb:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802df0:	eb d6                	jmp    802dc8 <ipc_send+0x16>
+  802df2:	50                   	push   %eax
+  802df3:	68 54 37 80 00       	push   $0x803754
+  802df8:	6a 4f                	push   $0x4f
+  802dfa:	68 97 37 80 00       	push   $0x803797
+  802dff:	e8 51 d3 ff ff       	call   800155 <_panic>
+  802e04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e07:	5b                   	pop    %ebx
+  802e08:	5e                   	pop    %esi
+  802e09:	5f                   	pop    %edi
+  802e0a:	5d                   	pop    %ebp
+  802e0b:	c3                   	ret
+
+00802e0c <ipc_call>:
+  802e0c:	55                   	push   %ebp
+  802e0d:	89 e5                	mov    %esp,%ebp
+  802e0f:	57                   	push   %edi
+  802e10:	56                   	push   %esi
+  802e11:	53                   	push   %ebx
+  802e12:	83 ec 0c             	sub    $0xc,%esp
+  802e15:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e19:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802e1e:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802e22:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e26:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802e2b:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802e2f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e38:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802e3c:	eb 05                	jmp    802e43 <ipc_call+0x37>
+  802e3e:	e8 f9 de ff ff       	call   800d3c <sys_yield>
+  802e43:	83 ec 0c             	sub    $0xc,%esp
+  802e46:	56                   	push   %esi
+  802e47:	53                   	push   %ebx
+  802e48:	57                   	push   %edi
+  802e49:	ff 75 0c             	push   0xc(%ebp)
+  802e4c:	ff 75 08             	push   0x8(%ebp)
+  802e4f:	e8 bb e2 ff ff       	call   80110f <sys_ipc_call>
+  802e54:	83 c4 20             	add    $0x20,%esp
+  802e57:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e5a:	74 e2                	je     802e3e <ipc_call+0x32>
+  802e5c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802e5f:	74 2d                	je     802e8e <ipc_call+0x82>
+  802e61:	85 c0                	test   %eax,%eax
+  802e63:	78 4f                	js     802eb4 <ipc_call+0xa8>
+  802e65:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802e69:	74 10                	je     802e7b <ipc_call+0x6f>
+  802e6b:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  802e70:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e76:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802e79:	89 02                	mov    %eax,(%edx)
+  802e7b:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  802e80:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e89:	5b                   	pop    %ebx
+  802e8a:	5e                   	pop    %esi
+  802e8b:	5f                   	pop    %edi
+  802e8c:	5d                   	pop    %ebp
+  802e8d:	c3                   	ret
+  802e8e:	ff 75 14             	push   0x14(%ebp)
+  802e91:	ff 75 10             	push   0x10(%ebp)
+  802e94:	ff 75 0c             	push   0xc(%ebp)
+  802e97:	ff 75 08             	push   0x8(%ebp)
+  802e9a:	e8 13 ff ff ff       	call   802db2 <ipc_send>
+  802e9f:	83 c4 0c             	add    $0xc,%esp
+  802ea2:	ff 75 1c             	push   0x1c(%ebp)
+  802ea5:	ff 75 18             	push   0x18(%ebp)
+  802ea8:	6a 00                	push   $0x0
+  802eaa:	e8 a5 fe ff ff       	call   802d54 <ipc_recv>
+  802eaf:	83 c4 10             	add    $0x10,%esp
+  802eb2:	eb d2                	jmp    802e86 <ipc_call+0x7a>
+  802eb4:	50                   	push   %eax
+  802eb5:	68 a1 37 80 00       	push   $0x8037a1
+  802eba:	6a 6d                	push   $0x6d
+  802ebc:	68 97 37 80 00       	push   $0x803797
+  802ec1:	e8 8f d2 ff ff       	call   800155 <_panic>
+
+00802ec6 <ipc_reply_recv>:
+  802ec6:	55                   	push   %ebp
+  802ec7:	89 e5                	mov    %esp,%ebp
+  802ec9:	57                   	push   %edi
+  802eca:	56                   	push   %esi
+  802ecb:	53                   	push   %ebx
+  802ecc:	83 ec 0c             	sub    $0xc,%esp
+  802ecf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ed2:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802ed5:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802ed8:	85 db                	test   %ebx,%ebx
+  802eda:	0f 84 ac 00 00 00    	je     802f8c <ipc_reply_recv+0xc6>
+  802ee0:	85 f6                	test   %esi,%esi
+  802ee2:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802ee7:	0f 45 c6             	cmovne %esi,%eax
+  802eea:	83 ec 0c             	sub    $0xc,%esp
+  802eed:	50                   	push   %eax
+  802eee:	ff 75 14             	push   0x14(%ebp)
+  802ef1:	53                   	push   %ebx
+  802ef2:	ff 75 0c             	push   0xc(%ebp)
+  802ef5:	ff 75 08             	push   0x8(%ebp)
+  802ef8:	e8 33 e2 ff ff       	call   801130 <sys_ipc_reply_recv>
+  802efd:	83 c4 20             	add    $0x20,%esp
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	78 3a                	js     802f3e <ipc_reply_recv+0x78>
+  802f04:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f08:	74 10                	je     802f1a <ipc_reply_recv+0x54>
+  802f0a:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  802f0f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802f15:	8b 55 18             	mov    0x18(%ebp),%edx
+  802f18:	89 02                	mov    %eax,(%edx)
+  802f1a:	85 ff                	test   %edi,%edi
+  802f1c:	74 0d                	je     802f2b <ipc_reply_recv+0x65>
+  802f1e:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  802f23:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f29:	89 07                	mov    %eax,(%edi)
+  802f2b:	a1 20 50 c0 00       	mov    0xc05020,%eax
+  802f30:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f39:	5b                   	pop    %ebx
+  802f3a:	5e                   	pop    %esi
+  802f3b:	5f                   	pop    %edi
+  802f3c:	5d                   	pop    %ebp
+  802f3d:	c3                   	ret
+  802f3e:	ff 75 14             	push   0x14(%ebp)
+  802f41:	53                   	push   %ebx
+  802f42:	ff 75 0c             	push   0xc(%ebp)
+  802f45:	ff 75 08             	push   0x8(%ebp)
+  802f48:	e8 95 e0 ff ff       	call   800fe2 <sys_ipc_try_send>
+  802f4d:	89 c2                	mov    %eax,%edx
+  802f4f:	c1 ea 1f             	shr    $0x1f,%edx
+  802f52:	83 c4 10             	add    $0x10,%esp
+  802f55:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802f58:	0f 95 c1             	setne  %cl
+  802f5b:	84 d1                	test   %dl,%cl
+  802f5d:	74 05                	je     802f64 <ipc_reply_recv+0x9e>
+  802f5f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f62:	75 12                	jne    802f76 <ipc_reply_recv+0xb0>
+  802f64:	83 ec 04             	sub    $0x4,%esp
+  802f67:	57                   	push   %edi
+  802f68:	56                   	push   %esi
+  802f69:	ff 75 18             	push   0x18(%ebp)
+  802f6c:	e8 e3 fd ff ff       	call   802d54 <ipc_recv>
+  802f71:	83 c4 10             	add    $0x10,%esp
+  802f74:	eb c0                	jmp    802f36 <ipc_reply_recv+0x70>
+  802f76:	83 ec 04             	sub    $0x4,%esp
+  802f79:	50                   	push   %eax
+  802f7a:	ff 75 08             	push   0x8(%ebp)
+  802f7d:	68 74 37 80 00       	push   $0x803774
+  802f82:	e8 a9 d2 ff ff       	call   800230 <cprintf>
+  802f87:	83 c4 10             	add    $0x10,%esp
+  802f8a:	eb d8                	jmp    802f64 <ipc_reply_recv+0x9e>
+  802f8c:	85 f6                	test   %esi,%esi
+  802f8e:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f93:	0f 45 c6             	cmovne %esi,%eax
+  802f96:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f9b:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802fa2:	e9 43 ff ff ff       	jmp    802eea <ipc_reply_recv+0x24>
+
+00802fa7 <ipc_find_env>:
+  802fa7:	55                   	push   %ebp
+  802fa8:	89 e5                	mov    %esp,%ebp
+  802faa:	83 ec 14             	sub    $0x14,%esp
+  802fad:	ff 75 08             	push   0x8(%ebp)
+  802fb0:	e8 cb df ff ff       	call   800f80 <sys_env_service>
+  802fb5:	85 c0                	test   %eax,%eax
+  802fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fbc:	0f 48 c2             	cmovs  %edx,%eax
+  802fbf:	c9                   	leave
+  802fc0:	c3                   	ret
+
+00802fc1 <pageref>:
+  802fc1:	55                   	push   %ebp
+  802fc2:	89 e5                	mov    %esp,%ebp
+  802fc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc7:	89 c2                	mov    %eax,%edx
+  802fc9:	c1 ea 16             	shr    $0x16,%edx
+  802fcc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd8:	f6 c1 01             	test   $0x1,%cl
+  802fdb:	74 22                	je     802fff <pageref+0x3e>
+  802fdd:	c1 e8 0c             	shr    $0xc,%eax
+  802fe0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fe7:	a8 01                	test   $0x1,%al
+  802fe9:	74 14                	je     802fff <pageref+0x3e>
+  802feb:	c1 e8 0c             	shr    $0xc,%eax
+  802fee:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802ff1:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802ff8:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802ffc:	0f b7 d2             	movzwl %dx,%edx
+  802fff:	89 d0                	mov    %edx,%eax
+  803001:	5d                   	pop    %ebp
+  803002:	c3                   	ret
+
+00803003 <__udivmoddi4>:
+  803003:	55                   	push   %ebp
+  803004:	57                   	push   %edi
+  803005:	56                   	push   %esi
+  803006:	53                   	push   %ebx
+  803007:	83 ec 24             	sub    $0x24,%esp
+  80300a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80300e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803012:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803016:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80301a:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80301e:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803022:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803026:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80302a:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80302e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803033:	ba 00 00 00 00       	mov    $0x0,%edx
+  803038:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80303d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803044:	00 
+  803045:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80304c:	00 
+  80304d:	89 fb                	mov    %edi,%ebx
+  80304f:	eb 08                	jmp    803059 <__udivmoddi4+0x56>
+  803051:	83 e9 01             	sub    $0x1,%ecx
+  803054:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803057:	74 68                	je     8030c1 <__udivmoddi4+0xbe>
+  803059:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80305d:	01 c0                	add    %eax,%eax
+  80305f:	89 c6                	mov    %eax,%esi
+  803061:	89 d7                	mov    %edx,%edi
+  803063:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803067:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80306b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80306e:	d3 ea                	shr    %cl,%edx
+  803070:	f6 c1 20             	test   $0x20,%cl
+  803073:	74 04                	je     803079 <__udivmoddi4+0x76>
+  803075:	89 d0                	mov    %edx,%eax
+  803077:	31 d2                	xor    %edx,%edx
+  803079:	83 e0 01             	and    $0x1,%eax
+  80307c:	89 04 24             	mov    %eax,(%esp)
+  80307f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803086:	00 
+  803087:	8b 04 24             	mov    (%esp),%eax
+  80308a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80308e:	09 f0                	or     %esi,%eax
+  803090:	09 fa                	or     %edi,%edx
+  803092:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803096:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80309a:	39 f0                	cmp    %esi,%eax
+  80309c:	89 d5                	mov    %edx,%ebp
+  80309e:	19 fd                	sbb    %edi,%ebp
+  8030a0:	72 af                	jb     803051 <__udivmoddi4+0x4e>
+  8030a2:	29 f0                	sub    %esi,%eax
+  8030a4:	19 fa                	sbb    %edi,%edx
+  8030a6:	89 cf                	mov    %ecx,%edi
+  8030a8:	c1 ef 05             	shr    $0x5,%edi
+  8030ab:	83 e7 01             	and    $0x1,%edi
+  8030ae:	89 fe                	mov    %edi,%esi
+  8030b0:	83 f6 01             	xor    $0x1,%esi
+  8030b3:	d3 e6                	shl    %cl,%esi
+  8030b5:	d3 e7                	shl    %cl,%edi
+  8030b7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8030bb:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8030bf:	eb 90                	jmp    803051 <__udivmoddi4+0x4e>
+  8030c1:	85 db                	test   %ebx,%ebx
+  8030c3:	74 05                	je     8030ca <__udivmoddi4+0xc7>
+  8030c5:	89 03                	mov    %eax,(%ebx)
+  8030c7:	89 53 04             	mov    %edx,0x4(%ebx)
+  8030ca:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8030ce:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8030d2:	83 c4 24             	add    $0x24,%esp
+  8030d5:	5b                   	pop    %ebx
+  8030d6:	5e                   	pop    %esi
+  8030d7:	5f                   	pop    %edi
+  8030d8:	5d                   	pop    %ebp
+  8030d9:	c3                   	ret
+
+008030da <__udivdi3>:
+  8030da:	83 ec 08             	sub    $0x8,%esp
+  8030dd:	6a 00                	push   $0x0
+  8030df:	ff 74 24 1c          	push   0x1c(%esp)
+  8030e3:	ff 74 24 1c          	push   0x1c(%esp)
+  8030e7:	ff 74 24 1c          	push   0x1c(%esp)
+  8030eb:	ff 74 24 1c          	push   0x1c(%esp)
+  8030ef:	e8 0f ff ff ff       	call   803003 <__udivmoddi4>
+  8030f4:	83 c4 1c             	add    $0x1c,%esp
+  8030f7:	c3                   	ret
+
+008030f8 <__umoddi3>:
+  8030f8:	83 ec 18             	sub    $0x18,%esp
+  8030fb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030ff:	50                   	push   %eax
+  803100:	ff 74 24 2c          	push   0x2c(%esp)
+  803104:	ff 74 24 2c          	push   0x2c(%esp)
+  803108:	ff 74 24 2c          	push   0x2c(%esp)
+  80310c:	ff 74 24 2c          	push   0x2c(%esp)
+  803110:	e8 ee fe ff ff       	call   803003 <__udivmoddi4>
+  803115:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803119:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80311d:	83 c4 2c             	add    $0x2c,%esp
+  803120:	c3                   	ret
+
+00803121 <__divdi3>:
+  803121:	53                   	push   %ebx
+  803122:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803126:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80312a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80312e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803132:	85 d2                	test   %edx,%edx
+  803134:	78 12                	js     803148 <__divdi3+0x27>
+  803136:	85 db                	test   %ebx,%ebx
+  803138:	78 2e                	js     803168 <__divdi3+0x47>
+  80313a:	53                   	push   %ebx
+  80313b:	51                   	push   %ecx
+  80313c:	52                   	push   %edx
+  80313d:	50                   	push   %eax
+  80313e:	e8 97 ff ff ff       	call   8030da <__udivdi3>
+  803143:	83 c4 10             	add    $0x10,%esp
+  803146:	eb 1e                	jmp    803166 <__divdi3+0x45>
+  803148:	f7 d8                	neg    %eax
+  80314a:	83 d2 00             	adc    $0x0,%edx
+  80314d:	f7 da                	neg    %edx
+  80314f:	85 db                	test   %ebx,%ebx
+  803151:	78 2a                	js     80317d <__divdi3+0x5c>
+  803153:	53                   	push   %ebx
+  803154:	51                   	push   %ecx
+  803155:	52                   	push   %edx
+  803156:	50                   	push   %eax
+  803157:	e8 7e ff ff ff       	call   8030da <__udivdi3>
+  80315c:	83 c4 10             	add    $0x10,%esp
+  80315f:	f7 d8                	neg    %eax
+  803161:	83 d2 00             	adc    $0x0,%edx
+  803164:	f7 da                	neg    %edx
+  803166:	5b                   	pop    %ebx
+  803167:	c3                   	ret
+  803168:	f7 d9                	neg    %ecx
+  80316a:	83 d3 00             	adc    $0x0,%ebx
+  80316d:	f7 db                	neg    %ebx
+  80316f:	53                   	push   %ebx
+  803170:	51                   	push   %ecx
+  803171:	52                   	push   %edx
+  803172:	50                   	push   %eax
+  803173:	e8 62 ff ff ff       	call   8030da <__udivdi3>
+  803178:	83 c4 10             	add    $0x10,%esp
+  80317b:	eb e2                	jmp    80315f <__divdi3+0x3e>
+  80317d:	f7 d9                	neg    %ecx
+  80317f:	83 d3 00             	adc    $0x0,%ebx
+  803182:	f7 db                	neg    %ebx
+  803184:	53                   	push   %ebx
+  803185:	51                   	push   %ecx
+  803186:	52                   	push   %edx
+  803187:	50                   	push   %eax
+  803188:	e8 4d ff ff ff       	call   8030da <__udivdi3>
+  80318d:	83 c4 10             	add    $0x10,%esp
+  803190:	eb d4                	jmp    803166 <__divdi3+0x45>
+
+00803192 <__moddi3>:
+  803192:	55                   	push   %ebp
+  803193:	57                   	push   %edi
+  803194:	56                   	push   %esi
+  803195:	53                   	push   %ebx
+  803196:	83 ec 0c             	sub    $0xc,%esp
+  803199:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80319d:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8031a1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031a5:	89 e9                	mov    %ebp,%ecx
+  8031a7:	f7 d9                	neg    %ecx
+  8031a9:	89 d0                	mov    %edx,%eax
+  8031ab:	83 d0 00             	adc    $0x0,%eax
+  8031ae:	f7 d8                	neg    %eax
+  8031b0:	0f 49 e9             	cmovns %ecx,%ebp
+  8031b3:	0f 49 d0             	cmovns %eax,%edx
+  8031b6:	52                   	push   %edx
+  8031b7:	55                   	push   %ebp
+  8031b8:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8031bc:	f7 da                	neg    %edx
+  8031be:	89 d8                	mov    %ebx,%eax
+  8031c0:	83 d0 00             	adc    $0x0,%eax
+  8031c3:	f7 d8                	neg    %eax
+  8031c5:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8031ca:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8031ce:	0f 48 c3             	cmovs  %ebx,%eax
+  8031d1:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8031d5:	ff 74 24 0c          	push   0xc(%esp)
+  8031d9:	ff 74 24 0c          	push   0xc(%esp)
+  8031dd:	e8 16 ff ff ff       	call   8030f8 <__umoddi3>
+  8031e2:	83 c4 10             	add    $0x10,%esp
+  8031e5:	85 db                	test   %ebx,%ebx
+  8031e7:	78 08                	js     8031f1 <__moddi3+0x5f>
+  8031e9:	83 c4 0c             	add    $0xc,%esp
+  8031ec:	5b                   	pop    %ebx
+  8031ed:	5e                   	pop    %esi
+  8031ee:	5f                   	pop    %edi
+  8031ef:	5d                   	pop    %ebp
+  8031f0:	c3                   	ret
+  8031f1:	f7 d8                	neg    %eax
+  8031f3:	83 d2 00             	adc    $0x0,%edx
+  8031f6:	f7 da                	neg    %edx
+  8031f8:	eb ef                	jmp    8031e9 <__moddi3+0x57>
@@ -0,0 +1,6354 @@
+
+obj/user/testdemand.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 62 02 00 00       	call   800293 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <mapped>:
+  800033:	89 c2                	mov    %eax,%edx
+  800035:	c1 ea 16             	shr    $0x16,%edx
+  800038:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80003f:	f6 c2 01             	test   $0x1,%dl
+  800042:	74 0e                	je     800052 <mapped+0x1f>
+  800044:	c1 e8 0c             	shr    $0xc,%eax
+  800047:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80004e:	83 e0 01             	and    $0x1,%eax
+  800051:	c3                   	ret
+  800052:	b8 00 00 00 00       	mov    $0x0,%eax
+  800057:	c3                   	ret
+
+00800058 <childofspawn>:
+  800058:	55                   	push   %ebp
+  800059:	89 e5                	mov    %esp,%ebp
+  80005b:	83 ec 08             	sub    $0x8,%esp
+  80005e:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800063:	e8 cb ff ff ff       	call   800033 <mapped>
+  800068:	89 c2                	mov    %eax,%edx
+  80006a:	b8 c6 42 80 00       	mov    $0x8042c6,%eax
+  80006f:	85 d2                	test   %edx,%edx
+  800071:	0f 84 1d 01 00 00    	je     800194 <childofspawn+0x13c>
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	50                   	push   %eax
+  80007b:	68 58 43 80 00       	push   $0x804358
+  800080:	e8 62 03 00 00       	call   8003e7 <cprintf>
+  800085:	83 c4 08             	add    $0x8,%esp
+  800088:	68 cc 42 80 00       	push   $0x8042cc
+  80008d:	68 00 50 80 00       	push   $0x805000
+  800092:	e8 f7 0a 00 00       	call   800b8e <strcmp>
+  800097:	89 c2                	mov    %eax,%edx
+  800099:	83 c4 10             	add    $0x10,%esp
+  80009c:	b8 c6 42 80 00       	mov    $0x8042c6,%eax
+  8000a1:	85 d2                	test   %edx,%edx
+  8000a3:	75 14                	jne    8000b9 <childofspawn+0x61>
+  8000a5:	80 3d 00 60 80 00 00 	cmpb   $0x0,0x806000
+  8000ac:	b8 c0 42 80 00       	mov    $0x8042c0,%eax
+  8000b1:	ba c6 42 80 00       	mov    $0x8042c6,%edx
+  8000b6:	0f 45 c2             	cmovne %edx,%eax
+  8000b9:	83 ec 08             	sub    $0x8,%esp
+  8000bc:	50                   	push   %eax
+  8000bd:	68 dd 42 80 00       	push   $0x8042dd
+  8000c2:	e8 20 03 00 00       	call   8003e7 <cprintf>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000d9:	80 b8 00 90 80 00 00 	cmpb   $0x0,0x809000(%eax)
+  8000e0:	0f 45 d1             	cmovne %ecx,%edx
+  8000e3:	83 c0 01             	add    $0x1,%eax
+  8000e6:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  8000eb:	75 ec                	jne    8000d9 <childofspawn+0x81>
+  8000ed:	c6 05 00 a0 80 00 01 	movb   $0x1,0x80a000
+  8000f4:	85 d2                	test   %edx,%edx
+  8000f6:	b8 c6 42 80 00       	mov    $0x8042c6,%eax
+  8000fb:	ba c0 42 80 00       	mov    $0x8042c0,%edx
+  800100:	0f 45 c2             	cmovne %edx,%eax
+  800103:	83 ec 08             	sub    $0x8,%esp
+  800106:	50                   	push   %eax
+  800107:	68 fa 42 80 00       	push   $0x8042fa
+  80010c:	e8 d6 02 00 00       	call   8003e7 <cprintf>
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	68 00 b0 80 00       	push   $0x80b000
+  800119:	6a 00                	push   $0x0
+  80011b:	e8 c6 15 00 00       	call   8016e6 <sys_env_stats>
+  800120:	83 c4 10             	add    $0x10,%esp
+  800123:	85 c0                	test   %eax,%eax
+  800125:	0f 88 a0 00 00 00    	js     8001cb <childofspawn+0x173>
+  80012b:	b8 00 b0 80 00       	mov    $0x80b000,%eax
+  800130:	e8 fe fe ff ff       	call   800033 <mapped>
+  800135:	89 c2                	mov    %eax,%edx
+  800137:	b8 c6 42 80 00       	mov    $0x8042c6,%eax
+  80013c:	85 d2                	test   %edx,%edx
+  80013e:	74 14                	je     800154 <childofspawn+0xfc>
+  800140:	83 3d c4 b0 80 00 00 	cmpl   $0x0,0x80b0c4
+  800147:	b8 c0 42 80 00       	mov    $0x8042c0,%eax
+  80014c:	ba c6 42 80 00       	mov    $0x8042c6,%edx
+  800151:	0f 44 c2             	cmove  %edx,%eax
+  800154:	83 ec 08             	sub    $0x8,%esp
+  800157:	50                   	push   %eax
+  800158:	68 78 43 80 00       	push   $0x804378
+  80015d:	e8 85 02 00 00       	call   8003e7 <cprintf>
+  800162:	b8 dd 01 80 00       	mov    $0x8001dd,%eax
+  800167:	c1 e8 0c             	shr    $0xc,%eax
+  80016a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800171:	8b 15 00 c0 80 00    	mov    0x80c000,%edx
+  800177:	8b 52 4c             	mov    0x4c(%edx),%edx
+  80017a:	6a 00                	push   $0x0
+  80017c:	6a 00                	push   $0x0
+  80017e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800183:	50                   	push   %eax
+  800184:	52                   	push   %edx
+  800185:	e8 80 16 00 00       	call   80180a <ipc_send>
+  80018a:	83 c4 20             	add    $0x20,%esp
+  80018d:	e8 4a 01 00 00       	call   8002dc <exit>
+  800192:	c9                   	leave
+  800193:	c3                   	ret
+  800194:	b8 00 90 80 00       	mov    $0x809000,%eax
+  800199:	e8 95 fe ff ff       	call   800033 <mapped>
+  80019e:	89 c2                	mov    %eax,%edx
+  8001a0:	b8 c6 42 80 00       	mov    $0x8042c6,%eax
+  8001a5:	85 d2                	test   %edx,%edx
+  8001a7:	0f 85 ca fe ff ff    	jne    800077 <childofspawn+0x1f>
+  8001ad:	b8 00 b0 80 00       	mov    $0x80b000,%eax
+  8001b2:	e8 7c fe ff ff       	call   800033 <mapped>
+  8001b7:	85 c0                	test   %eax,%eax
+  8001b9:	b8 c6 42 80 00       	mov    $0x8042c6,%eax
+  8001be:	ba c0 42 80 00       	mov    $0x8042c0,%edx
+  8001c3:	0f 44 c2             	cmove  %edx,%eax
+  8001c6:	e9 ac fe ff ff       	jmp    800077 <childofspawn+0x1f>
+  8001cb:	50                   	push   %eax
+  8001cc:	68 17 43 80 00       	push   $0x804317
+  8001d1:	6a 48                	push   $0x48
+  8001d3:	68 29 43 80 00       	push   $0x804329
+  8001d8:	e8 2f 01 00 00       	call   80030c <_panic>
+
+008001dd <umain>:
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	57                   	push   %edi
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+  8001e3:	83 ec 1c             	sub    $0x1c,%esp
+  8001e6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8001ea:	0f 85 87 00 00 00    	jne    800277 <umain+0x9a>
+  8001f0:	8d 75 e0             	lea    -0x20(%ebp),%esi
+  8001f3:	8d 7d dc             	lea    -0x24(%ebp),%edi
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 3b 43 80 00       	push   $0x80433b
+  8001fd:	68 40 43 80 00       	push   $0x804340
+  800202:	68 3f 43 80 00       	push   $0x80433f
+  800207:	e8 fb 2b 00 00       	call   802e07 <spawnl>
+  80020c:	89 c3                	mov    %eax,%ebx
+  80020e:	83 c4 10             	add    $0x10,%esp
+  800211:	85 c0                	test   %eax,%eax
+  800213:	78 6c                	js     800281 <umain+0xa4>
+  800215:	83 ec 04             	sub    $0x4,%esp
+  800218:	6a 00                	push   $0x0
+  80021a:	6a 00                	push   $0x0
+  80021c:	57                   	push   %edi
+  80021d:	e8 8a 15 00 00       	call   8017ac <ipc_recv>
+  800222:	89 06                	mov    %eax,(%esi)
+  800224:	83 c4 10             	add    $0x10,%esp
+  800227:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+  80022a:	75 e9                	jne    800215 <umain+0x38>
+  80022c:	83 ec 0c             	sub    $0xc,%esp
+  80022f:	53                   	push   %ebx
+  800230:	e8 84 34 00 00       	call   8036b9 <wait>
+  800235:	83 c6 04             	add    $0x4,%esi
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80023e:	39 c6                	cmp    %eax,%esi
+  800240:	75 b4                	jne    8001f6 <umain+0x19>
+  800242:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800245:	b8 c6 42 80 00       	mov    $0x8042c6,%eax
+  80024a:	85 d2                	test   %edx,%edx
+  80024c:	74 10                	je     80025e <umain+0x81>
+  80024e:	3b 55 e4             	cmp    -0x1c(%ebp),%edx
+  800251:	b8 c0 42 80 00       	mov    $0x8042c0,%eax
+  800256:	ba c6 42 80 00       	mov    $0x8042c6,%edx
+  80025b:	0f 45 c2             	cmovne %edx,%eax
+  80025e:	83 ec 08             	sub    $0x8,%esp
+  800261:	50                   	push   %eax
+  800262:	68 a0 43 80 00       	push   $0x8043a0
+  800267:	e8 7b 01 00 00       	call   8003e7 <cprintf>
+  80026c:	83 c4 10             	add    $0x10,%esp
+  80026f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800272:	5b                   	pop    %ebx
+  800273:	5e                   	pop    %esi
+  800274:	5f                   	pop    %edi
+  800275:	5d                   	pop    %ebp
+  800276:	c3                   	ret
+  800277:	e8 dc fd ff ff       	call   800058 <childofspawn>
+  80027c:	e9 6f ff ff ff       	jmp    8001f0 <umain+0x13>
+  800281:	50                   	push   %eax
+  800282:	68 4b 43 80 00       	push   $0x80434b
+  800287:	6a 21                	push   $0x21
+  800289:	68 29 43 80 00       	push   $0x804329
+  80028e:	e8 79 00 00 00       	call   80030c <_panic>
+
+00800293 <libmain>:
+  800293:	55                   	push   %ebp
+  800294:	89 e5                	mov    %esp,%ebp
+  800296:	56                   	push   %esi
+  800297:	53                   	push   %ebx
+  800298:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80029b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80029e:	e8 31 0c 00 00       	call   800ed4 <sys_getenvid>
+  8002a3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002a8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8002ae:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002b3:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  8002b8:	85 db                	test   %ebx,%ebx
+  8002ba:	7e 07                	jle    8002c3 <libmain+0x30>
+  8002bc:	8b 06                	mov    (%esi),%eax
+  8002be:	a3 00 70 80 00       	mov    %eax,0x807000
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	56                   	push   %esi
+  8002c7:	53                   	push   %ebx
+  8002c8:	e8 10 ff ff ff       	call   8001dd <umain>
+  8002cd:	e8 0a 00 00 00       	call   8002dc <exit>
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002d8:	5b                   	pop    %ebx
+  8002d9:	5e                   	pop    %esi
+  8002da:	5d                   	pop    %ebp
+  8002db:	c3                   	ret
+
+008002dc <exit>:
+  8002dc:	55                   	push   %ebp
+  8002dd:	89 e5                	mov    %esp,%ebp
+  8002df:	83 ec 08             	sub    $0x8,%esp
+  8002e2:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  8002e7:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8002ed:	85 c0                	test   %eax,%eax
+  8002ef:	75 14                	jne    800305 <exit+0x29>
+  8002f1:	e8 ed 18 00 00       	call   801be3 <close_all>
+  8002f6:	83 ec 0c             	sub    $0xc,%esp
+  8002f9:	6a 00                	push   $0x0
+  8002fb:	e8 93 0b 00 00       	call   800e93 <sys_env_destroy>
+  800300:	83 c4 10             	add    $0x10,%esp
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+  800305:	e8 f6 12 00 00       	call   801600 <sys_lease_complete>
+  80030a:	eb e5                	jmp    8002f1 <exit+0x15>
+
+0080030c <_panic>:
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	56                   	push   %esi
+  800310:	53                   	push   %ebx
+  800311:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800314:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  80031a:	e8 b5 0b 00 00       	call   800ed4 <sys_getenvid>
+  80031f:	83 ec 0c             	sub    $0xc,%esp
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	ff 75 08             	push   0x8(%ebp)
+  800328:	56                   	push   %esi
+  800329:	50                   	push   %eax
+  80032a:	68 d0 43 80 00       	push   $0x8043d0
+  80032f:	e8 b3 00 00 00       	call   8003e7 <cprintf>
+  800334:	83 c4 18             	add    $0x18,%esp
+  800337:	53                   	push   %ebx
+  800338:	ff 75 10             	push   0x10(%ebp)
+  80033b:	e8 56 00 00 00       	call   800396 <vcprintf>
+  800340:	c7 04 24 5b 49 80 00 	movl   $0x80495b,(%esp)
+  800347:	e8 9b 00 00 00       	call   8003e7 <cprintf>
+  80034c:	83 c4 10             	add    $0x10,%esp
+  80034f:	cc                   	int3
+  800350:	eb fd                	jmp    80034f <_panic+0x43>
+
+00800352 <putch>:
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	53                   	push   %ebx
+  800356:	83 ec 04             	sub    $0x4,%esp
+  800359:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80035c:	8b 13                	mov    (%ebx),%edx
+  80035e:	8d 42 01             	lea    0x1(%edx),%eax
+  800361:	89 03                	mov    %eax,(%ebx)
+  800363:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800366:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80036a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80036f:	74 09                	je     80037a <putch+0x28>
+  800371:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800378:	c9                   	leave
+  800379:	c3                   	ret
+  80037a:	83 ec 08             	sub    $0x8,%esp
+  80037d:	68 ff 00 00 00       	push   $0xff
+  800382:	8d 43 08             	lea    0x8(%ebx),%eax
+  800385:	50                   	push   %eax
+  800386:	e8 cb 0a 00 00       	call   800e56 <sys_cputs>
+  80038b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800391:	83 c4 10             	add    $0x10,%esp
+  800394:	eb db                	jmp    800371 <putch+0x1f>
+
+00800396 <vcprintf>:
+  800396:	55                   	push   %ebp
+  800397:	89 e5                	mov    %esp,%ebp
+  800399:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80039f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003a6:	00 00 00 
+  8003a9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003b0:	00 00 00 
+  8003b3:	ff 75 0c             	push   0xc(%ebp)
+  8003b6:	ff 75 08             	push   0x8(%ebp)
+  8003b9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003bf:	50                   	push   %eax
+  8003c0:	68 52 03 80 00       	push   $0x800352
+  8003c5:	e8 1c 01 00 00       	call   8004e6 <vprintfmt>
+  8003ca:	83 c4 08             	add    $0x8,%esp
+  8003cd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003d3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003d9:	50                   	push   %eax
+  8003da:	e8 77 0a 00 00       	call   800e56 <sys_cputs>
+  8003df:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003e5:	c9                   	leave
+  8003e6:	c3                   	ret
+
+008003e7 <cprintf>:
+  8003e7:	55                   	push   %ebp
+  8003e8:	89 e5                	mov    %esp,%ebp
+  8003ea:	83 ec 10             	sub    $0x10,%esp
+  8003ed:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8003f0:	50                   	push   %eax
+  8003f1:	ff 75 08             	push   0x8(%ebp)
+  8003f4:	e8 9d ff ff ff       	call   800396 <vcprintf>
+  8003f9:	c9                   	leave
+  8003fa:	c3                   	ret
+
+008003fb <printnum>:
+  8003fb:	55                   	push   %ebp
+  8003fc:	89 e5                	mov    %esp,%ebp
+  8003fe:	57                   	push   %edi
+  8003ff:	56                   	push   %esi
+  800400:	53                   	push   %ebx
+  800401:	83 ec 1c             	sub    $0x1c,%esp
+  800404:	89 c3                	mov    %eax,%ebx
+  800406:	89 d6                	mov    %edx,%esi
+  800408:	8b 45 08             	mov    0x8(%ebp),%eax
+  80040b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80040e:	89 d1                	mov    %edx,%ecx
+  800410:	89 c2                	mov    %eax,%edx
+  800412:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800415:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800418:	8b 45 10             	mov    0x10(%ebp),%eax
+  80041b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80041e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800425:	39 c2                	cmp    %eax,%edx
+  800427:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80042a:	73 4b                	jae    800477 <printnum+0x7c>
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800432:	85 ff                	test   %edi,%edi
+  800434:	7e 11                	jle    800447 <printnum+0x4c>
+  800436:	83 ec 08             	sub    $0x8,%esp
+  800439:	56                   	push   %esi
+  80043a:	ff 75 18             	push   0x18(%ebp)
+  80043d:	ff d3                	call   *%ebx
+  80043f:	83 c4 10             	add    $0x10,%esp
+  800442:	83 ef 01             	sub    $0x1,%edi
+  800445:	75 ef                	jne    800436 <printnum+0x3b>
+  800447:	83 ec 08             	sub    $0x8,%esp
+  80044a:	56                   	push   %esi
+  80044b:	83 ec 04             	sub    $0x4,%esp
+  80044e:	ff 75 e4             	push   -0x1c(%ebp)
+  800451:	ff 75 e0             	push   -0x20(%ebp)
+  800454:	ff 75 dc             	push   -0x24(%ebp)
+  800457:	ff 75 d8             	push   -0x28(%ebp)
+  80045a:	e8 5b 3d 00 00       	call   8041ba <__umoddi3>
+  80045f:	83 c4 14             	add    $0x14,%esp
+  800462:	0f be 80 f3 43 80 00 	movsbl 0x8043f3(%eax),%eax
+  800469:	50                   	push   %eax
+  80046a:	ff d3                	call   *%ebx
+  80046c:	83 c4 10             	add    $0x10,%esp
+  80046f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800472:	5b                   	pop    %ebx
+  800473:	5e                   	pop    %esi
+  800474:	5f                   	pop    %edi
+  800475:	5d                   	pop    %ebp
+  800476:	c3                   	ret
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	ff 75 18             	push   0x18(%ebp)
+  80047d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800480:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800483:	52                   	push   %edx
+  800484:	50                   	push   %eax
+  800485:	83 ec 08             	sub    $0x8,%esp
+  800488:	ff 75 e4             	push   -0x1c(%ebp)
+  80048b:	ff 75 e0             	push   -0x20(%ebp)
+  80048e:	ff 75 dc             	push   -0x24(%ebp)
+  800491:	ff 75 d8             	push   -0x28(%ebp)
+  800494:	e8 03 3d 00 00       	call   80419c <__udivdi3>
+  800499:	83 c4 18             	add    $0x18,%esp
+  80049c:	52                   	push   %edx
+  80049d:	50                   	push   %eax
+  80049e:	89 f2                	mov    %esi,%edx
+  8004a0:	89 d8                	mov    %ebx,%eax
+  8004a2:	e8 54 ff ff ff       	call   8003fb <printnum>
+  8004a7:	83 c4 20             	add    $0x20,%esp
+  8004aa:	eb 9b                	jmp    800447 <printnum+0x4c>
+
+008004ac <sprintputch>:
+  8004ac:	55                   	push   %ebp
+  8004ad:	89 e5                	mov    %esp,%ebp
+  8004af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004b2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8004b6:	8b 10                	mov    (%eax),%edx
+  8004b8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004bb:	73 0a                	jae    8004c7 <sprintputch+0x1b>
+  8004bd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004c0:	89 08                	mov    %ecx,(%eax)
+  8004c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004c5:	88 02                	mov    %al,(%edx)
+  8004c7:	5d                   	pop    %ebp
+  8004c8:	c3                   	ret
+
+008004c9 <printfmt>:
+  8004c9:	55                   	push   %ebp
+  8004ca:	89 e5                	mov    %esp,%ebp
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	8d 45 14             	lea    0x14(%ebp),%eax
+  8004d2:	50                   	push   %eax
+  8004d3:	ff 75 10             	push   0x10(%ebp)
+  8004d6:	ff 75 0c             	push   0xc(%ebp)
+  8004d9:	ff 75 08             	push   0x8(%ebp)
+  8004dc:	e8 05 00 00 00       	call   8004e6 <vprintfmt>
+  8004e1:	83 c4 10             	add    $0x10,%esp
+  8004e4:	c9                   	leave
+  8004e5:	c3                   	ret
+
+008004e6 <vprintfmt>:
+  8004e6:	55                   	push   %ebp
+  8004e7:	89 e5                	mov    %esp,%ebp
+  8004e9:	57                   	push   %edi
+  8004ea:	56                   	push   %esi
+  8004eb:	53                   	push   %ebx
+  8004ec:	83 ec 2c             	sub    $0x2c,%esp
+  8004ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004f2:	89 df                	mov    %ebx,%edi
+  8004f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004f7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004fa:	8d 70 01             	lea    0x1(%eax),%esi
+  8004fd:	0f b6 00             	movzbl (%eax),%eax
+  800500:	83 f8 25             	cmp    $0x25,%eax
+  800503:	74 1e                	je     800523 <vprintfmt+0x3d>
+  800505:	85 c0                	test   %eax,%eax
+  800507:	0f 84 15 05 00 00    	je     800a22 <vprintfmt+0x53c>
+  80050d:	83 ec 08             	sub    $0x8,%esp
+  800510:	53                   	push   %ebx
+  800511:	50                   	push   %eax
+  800512:	ff d7                	call   *%edi
+  800514:	83 c6 01             	add    $0x1,%esi
+  800517:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051b:	83 c4 10             	add    $0x10,%esp
+  80051e:	83 f8 25             	cmp    $0x25,%eax
+  800521:	75 e2                	jne    800505 <vprintfmt+0x1f>
+  800523:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800527:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80052e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800535:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80053c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800541:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800544:	8d 56 01             	lea    0x1(%esi),%edx
+  800547:	0f b6 0e             	movzbl (%esi),%ecx
+  80054a:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80054d:	3c 55                	cmp    $0x55,%al
+  80054f:	0f 87 3b 04 00 00    	ja     800990 <vprintfmt+0x4aa>
+  800555:	0f b6 c0             	movzbl %al,%eax
+  800558:	ff 24 85 40 45 80 00 	jmp    *0x804540(,%eax,4)
+  80055f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800562:	eb 93                	jmp    8004f7 <vprintfmt+0x11>
+  800564:	89 d6                	mov    %edx,%esi
+  800566:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80056a:	eb d8                	jmp    800544 <vprintfmt+0x5e>
+  80056c:	89 d6                	mov    %edx,%esi
+  80056e:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800572:	eb d0                	jmp    800544 <vprintfmt+0x5e>
+  800574:	0f b6 c9             	movzbl %cl,%ecx
+  800577:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80057a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80057d:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800581:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800584:	83 f9 09             	cmp    $0x9,%ecx
+  800587:	77 6f                	ja     8005f8 <vprintfmt+0x112>
+  800589:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80058c:	83 c2 01             	add    $0x1,%edx
+  80058f:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800592:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800596:	0f be 02             	movsbl (%edx),%eax
+  800599:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80059c:	83 fe 09             	cmp    $0x9,%esi
+  80059f:	76 eb                	jbe    80058c <vprintfmt+0xa6>
+  8005a1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8005a4:	89 d6                	mov    %edx,%esi
+  8005a6:	eb 13                	jmp    8005bb <vprintfmt+0xd5>
+  8005a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ab:	8b 00                	mov    (%eax),%eax
+  8005ad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b9:	89 d6                	mov    %edx,%esi
+  8005bb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005bf:	79 83                	jns    800544 <vprintfmt+0x5e>
+  8005c1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005c7:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8005ce:	e9 71 ff ff ff       	jmp    800544 <vprintfmt+0x5e>
+  8005d3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005d6:	85 c9                	test   %ecx,%ecx
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	0f 49 c1             	cmovns %ecx,%eax
+  8005e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005e3:	89 d6                	mov    %edx,%esi
+  8005e5:	e9 5a ff ff ff       	jmp    800544 <vprintfmt+0x5e>
+  8005ea:	89 d6                	mov    %edx,%esi
+  8005ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8005f3:	e9 4c ff ff ff       	jmp    800544 <vprintfmt+0x5e>
+  8005f8:	89 d6                	mov    %edx,%esi
+  8005fa:	eb bf                	jmp    8005bb <vprintfmt+0xd5>
+  8005fc:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800600:	89 d6                	mov    %edx,%esi
+  800602:	e9 3d ff ff ff       	jmp    800544 <vprintfmt+0x5e>
+  800607:	89 55 10             	mov    %edx,0x10(%ebp)
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8d 70 04             	lea    0x4(%eax),%esi
+  800610:	83 ec 08             	sub    $0x8,%esp
+  800613:	53                   	push   %ebx
+  800614:	ff 30                	push   (%eax)
+  800616:	ff d7                	call   *%edi
+  800618:	83 c4 10             	add    $0x10,%esp
+  80061b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80061e:	e9 d4 fe ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  800623:	89 55 10             	mov    %edx,0x10(%ebp)
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8d 70 04             	lea    0x4(%eax),%esi
+  80062c:	8b 10                	mov    (%eax),%edx
+  80062e:	89 d0                	mov    %edx,%eax
+  800630:	f7 d8                	neg    %eax
+  800632:	0f 48 c2             	cmovs  %edx,%eax
+  800635:	83 f8 12             	cmp    $0x12,%eax
+  800638:	7f 23                	jg     80065d <vprintfmt+0x177>
+  80063a:	8b 14 85 a0 46 80 00 	mov    0x8046a0(,%eax,4),%edx
+  800641:	85 d2                	test   %edx,%edx
+  800643:	74 18                	je     80065d <vprintfmt+0x177>
+  800645:	52                   	push   %edx
+  800646:	68 89 48 80 00       	push   $0x804889
+  80064b:	53                   	push   %ebx
+  80064c:	57                   	push   %edi
+  80064d:	e8 77 fe ff ff       	call   8004c9 <printfmt>
+  800652:	83 c4 10             	add    $0x10,%esp
+  800655:	89 75 14             	mov    %esi,0x14(%ebp)
+  800658:	e9 9a fe ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  80065d:	50                   	push   %eax
+  80065e:	68 0b 44 80 00       	push   $0x80440b
+  800663:	53                   	push   %ebx
+  800664:	57                   	push   %edi
+  800665:	e8 5f fe ff ff       	call   8004c9 <printfmt>
+  80066a:	83 c4 10             	add    $0x10,%esp
+  80066d:	89 75 14             	mov    %esi,0x14(%ebp)
+  800670:	e9 82 fe ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  800675:	89 55 10             	mov    %edx,0x10(%ebp)
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	83 c0 04             	add    $0x4,%eax
+  80067e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 00                	mov    (%eax),%eax
+  800686:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800689:	85 c0                	test   %eax,%eax
+  80068b:	0f 84 61 03 00 00    	je     8009f2 <vprintfmt+0x50c>
+  800691:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800695:	7e 06                	jle    80069d <vprintfmt+0x1b7>
+  800697:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80069b:	75 29                	jne    8006c6 <vprintfmt+0x1e0>
+  80069d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006a0:	8d 70 01             	lea    0x1(%eax),%esi
+  8006a3:	0f b6 00             	movzbl (%eax),%eax
+  8006a6:	0f be d0             	movsbl %al,%edx
+  8006a9:	85 d2                	test   %edx,%edx
+  8006ab:	0f 84 bb 00 00 00    	je     80076c <vprintfmt+0x286>
+  8006b1:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006b4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006b7:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006ba:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006bd:	eb 7a                	jmp    800739 <vprintfmt+0x253>
+  8006bf:	c7 45 d0 04 44 80 00 	movl   $0x804404,-0x30(%ebp)
+  8006c6:	83 ec 08             	sub    $0x8,%esp
+  8006c9:	ff 75 d4             	push   -0x2c(%ebp)
+  8006cc:	ff 75 d0             	push   -0x30(%ebp)
+  8006cf:	e8 e0 03 00 00       	call   800ab4 <strnlen>
+  8006d4:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8006d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8006da:	83 c4 10             	add    $0x10,%esp
+  8006dd:	85 d2                	test   %edx,%edx
+  8006df:	0f 8e d6 02 00 00    	jle    8009bb <vprintfmt+0x4d5>
+  8006e5:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8006e9:	83 ec 08             	sub    $0x8,%esp
+  8006ec:	53                   	push   %ebx
+  8006ed:	56                   	push   %esi
+  8006ee:	ff d7                	call   *%edi
+  8006f0:	83 c4 10             	add    $0x10,%esp
+  8006f3:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8006f7:	75 f0                	jne    8006e9 <vprintfmt+0x203>
+  8006f9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006fc:	8d 70 01             	lea    0x1(%eax),%esi
+  8006ff:	0f b6 00             	movzbl (%eax),%eax
+  800702:	0f be d0             	movsbl %al,%edx
+  800705:	85 d2                	test   %edx,%edx
+  800707:	0f 84 da 02 00 00    	je     8009e7 <vprintfmt+0x501>
+  80070d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800710:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800713:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800716:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800719:	eb 1e                	jmp    800739 <vprintfmt+0x253>
+  80071b:	83 ec 08             	sub    $0x8,%esp
+  80071e:	ff 75 0c             	push   0xc(%ebp)
+  800721:	52                   	push   %edx
+  800722:	ff 55 08             	call   *0x8(%ebp)
+  800725:	83 c4 10             	add    $0x10,%esp
+  800728:	83 eb 01             	sub    $0x1,%ebx
+  80072b:	83 c6 01             	add    $0x1,%esi
+  80072e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800732:	0f be d0             	movsbl %al,%edx
+  800735:	85 d2                	test   %edx,%edx
+  800737:	74 2a                	je     800763 <vprintfmt+0x27d>
+  800739:	85 ff                	test   %edi,%edi
+  80073b:	78 05                	js     800742 <vprintfmt+0x25c>
+  80073d:	83 ef 01             	sub    $0x1,%edi
+  800740:	78 59                	js     80079b <vprintfmt+0x2b5>
+  800742:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800746:	74 d3                	je     80071b <vprintfmt+0x235>
+  800748:	0f be c0             	movsbl %al,%eax
+  80074b:	83 e8 20             	sub    $0x20,%eax
+  80074e:	83 f8 5e             	cmp    $0x5e,%eax
+  800751:	76 c8                	jbe    80071b <vprintfmt+0x235>
+  800753:	83 ec 08             	sub    $0x8,%esp
+  800756:	ff 75 0c             	push   0xc(%ebp)
+  800759:	6a 3f                	push   $0x3f
+  80075b:	ff 55 08             	call   *0x8(%ebp)
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	eb c5                	jmp    800728 <vprintfmt+0x242>
+  800763:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800766:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800769:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80076c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80076f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800773:	7e 1b                	jle    800790 <vprintfmt+0x2aa>
+  800775:	83 ec 08             	sub    $0x8,%esp
+  800778:	53                   	push   %ebx
+  800779:	6a 20                	push   $0x20
+  80077b:	ff d7                	call   *%edi
+  80077d:	83 c4 10             	add    $0x10,%esp
+  800780:	83 ee 01             	sub    $0x1,%esi
+  800783:	75 f0                	jne    800775 <vprintfmt+0x28f>
+  800785:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800788:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078b:	e9 67 fd ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  800790:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+  800796:	e9 5c fd ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  80079b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80079e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007a4:	eb c6                	jmp    80076c <vprintfmt+0x286>
+  8007a6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007ac:	83 f9 01             	cmp    $0x1,%ecx
+  8007af:	7f 1f                	jg     8007d0 <vprintfmt+0x2ea>
+  8007b1:	85 c9                	test   %ecx,%ecx
+  8007b3:	74 67                	je     80081c <vprintfmt+0x336>
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 30                	mov    (%eax),%esi
+  8007ba:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007bd:	89 f0                	mov    %esi,%eax
+  8007bf:	c1 f8 1f             	sar    $0x1f,%eax
+  8007c2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ce:	eb 17                	jmp    8007e7 <vprintfmt+0x301>
+  8007d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d3:	8b 50 04             	mov    0x4(%eax),%edx
+  8007d6:	8b 00                	mov    (%eax),%eax
+  8007d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007db:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ea:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ed:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007f2:	85 c9                	test   %ecx,%ecx
+  8007f4:	0f 89 12 01 00 00    	jns    80090c <vprintfmt+0x426>
+  8007fa:	83 ec 08             	sub    $0x8,%esp
+  8007fd:	53                   	push   %ebx
+  8007fe:	6a 2d                	push   $0x2d
+  800800:	ff d7                	call   *%edi
+  800802:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800805:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800808:	f7 da                	neg    %edx
+  80080a:	83 d1 00             	adc    $0x0,%ecx
+  80080d:	f7 d9                	neg    %ecx
+  80080f:	83 c4 10             	add    $0x10,%esp
+  800812:	be 0a 00 00 00       	mov    $0xa,%esi
+  800817:	e9 f0 00 00 00       	jmp    80090c <vprintfmt+0x426>
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8b 30                	mov    (%eax),%esi
+  800821:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800824:	89 f0                	mov    %esi,%eax
+  800826:	c1 f8 1f             	sar    $0x1f,%eax
+  800829:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80082c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082f:	8d 40 04             	lea    0x4(%eax),%eax
+  800832:	89 45 14             	mov    %eax,0x14(%ebp)
+  800835:	eb b0                	jmp    8007e7 <vprintfmt+0x301>
+  800837:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80083a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80083d:	83 f9 01             	cmp    $0x1,%ecx
+  800840:	7f 1e                	jg     800860 <vprintfmt+0x37a>
+  800842:	85 c9                	test   %ecx,%ecx
+  800844:	74 32                	je     800878 <vprintfmt+0x392>
+  800846:	8b 45 14             	mov    0x14(%ebp),%eax
+  800849:	8b 10                	mov    (%eax),%edx
+  80084b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800850:	8d 40 04             	lea    0x4(%eax),%eax
+  800853:	89 45 14             	mov    %eax,0x14(%ebp)
+  800856:	be 0a 00 00 00       	mov    $0xa,%esi
+  80085b:	e9 ac 00 00 00       	jmp    80090c <vprintfmt+0x426>
+  800860:	8b 45 14             	mov    0x14(%ebp),%eax
+  800863:	8b 10                	mov    (%eax),%edx
+  800865:	8b 48 04             	mov    0x4(%eax),%ecx
+  800868:	8d 40 08             	lea    0x8(%eax),%eax
+  80086b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80086e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800873:	e9 94 00 00 00       	jmp    80090c <vprintfmt+0x426>
+  800878:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087b:	8b 10                	mov    (%eax),%edx
+  80087d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800882:	8d 40 04             	lea    0x4(%eax),%eax
+  800885:	89 45 14             	mov    %eax,0x14(%ebp)
+  800888:	be 0a 00 00 00       	mov    $0xa,%esi
+  80088d:	eb 7d                	jmp    80090c <vprintfmt+0x426>
+  80088f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800892:	89 55 10             	mov    %edx,0x10(%ebp)
+  800895:	83 f9 01             	cmp    $0x1,%ecx
+  800898:	7f 1b                	jg     8008b5 <vprintfmt+0x3cf>
+  80089a:	85 c9                	test   %ecx,%ecx
+  80089c:	74 2c                	je     8008ca <vprintfmt+0x3e4>
+  80089e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a1:	8b 10                	mov    (%eax),%edx
+  8008a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ae:	be 08 00 00 00       	mov    $0x8,%esi
+  8008b3:	eb 57                	jmp    80090c <vprintfmt+0x426>
+  8008b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b8:	8b 10                	mov    (%eax),%edx
+  8008ba:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c3:	be 08 00 00 00       	mov    $0x8,%esi
+  8008c8:	eb 42                	jmp    80090c <vprintfmt+0x426>
+  8008ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cd:	8b 10                	mov    (%eax),%edx
+  8008cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008da:	be 08 00 00 00       	mov    $0x8,%esi
+  8008df:	eb 2b                	jmp    80090c <vprintfmt+0x426>
+  8008e1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008e4:	83 ec 08             	sub    $0x8,%esp
+  8008e7:	53                   	push   %ebx
+  8008e8:	6a 30                	push   $0x30
+  8008ea:	ff d7                	call   *%edi
+  8008ec:	83 c4 08             	add    $0x8,%esp
+  8008ef:	53                   	push   %ebx
+  8008f0:	6a 78                	push   $0x78
+  8008f2:	ff d7                	call   *%edi
+  8008f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f7:	8b 10                	mov    (%eax),%edx
+  8008f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fe:	83 c4 10             	add    $0x10,%esp
+  800901:	8d 40 04             	lea    0x4(%eax),%eax
+  800904:	89 45 14             	mov    %eax,0x14(%ebp)
+  800907:	be 10 00 00 00       	mov    $0x10,%esi
+  80090c:	83 ec 0c             	sub    $0xc,%esp
+  80090f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800913:	50                   	push   %eax
+  800914:	ff 75 e4             	push   -0x1c(%ebp)
+  800917:	56                   	push   %esi
+  800918:	51                   	push   %ecx
+  800919:	52                   	push   %edx
+  80091a:	89 da                	mov    %ebx,%edx
+  80091c:	89 f8                	mov    %edi,%eax
+  80091e:	e8 d8 fa ff ff       	call   8003fb <printnum>
+  800923:	83 c4 20             	add    $0x20,%esp
+  800926:	e9 cc fb ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  80092b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80092e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800931:	83 f9 01             	cmp    $0x1,%ecx
+  800934:	7f 1b                	jg     800951 <vprintfmt+0x46b>
+  800936:	85 c9                	test   %ecx,%ecx
+  800938:	74 2c                	je     800966 <vprintfmt+0x480>
+  80093a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093d:	8b 10                	mov    (%eax),%edx
+  80093f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800944:	8d 40 04             	lea    0x4(%eax),%eax
+  800947:	89 45 14             	mov    %eax,0x14(%ebp)
+  80094a:	be 10 00 00 00       	mov    $0x10,%esi
+  80094f:	eb bb                	jmp    80090c <vprintfmt+0x426>
+  800951:	8b 45 14             	mov    0x14(%ebp),%eax
+  800954:	8b 10                	mov    (%eax),%edx
+  800956:	8b 48 04             	mov    0x4(%eax),%ecx
+  800959:	8d 40 08             	lea    0x8(%eax),%eax
+  80095c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80095f:	be 10 00 00 00       	mov    $0x10,%esi
+  800964:	eb a6                	jmp    80090c <vprintfmt+0x426>
+  800966:	8b 45 14             	mov    0x14(%ebp),%eax
+  800969:	8b 10                	mov    (%eax),%edx
+  80096b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800970:	8d 40 04             	lea    0x4(%eax),%eax
+  800973:	89 45 14             	mov    %eax,0x14(%ebp)
+  800976:	be 10 00 00 00       	mov    $0x10,%esi
+  80097b:	eb 8f                	jmp    80090c <vprintfmt+0x426>
+  80097d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800980:	83 ec 08             	sub    $0x8,%esp
+  800983:	53                   	push   %ebx
+  800984:	6a 25                	push   $0x25
+  800986:	ff d7                	call   *%edi
+  800988:	83 c4 10             	add    $0x10,%esp
+  80098b:	e9 67 fb ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  800990:	83 ec 08             	sub    $0x8,%esp
+  800993:	53                   	push   %ebx
+  800994:	6a 25                	push   $0x25
+  800996:	ff d7                	call   *%edi
+  800998:	83 c4 10             	add    $0x10,%esp
+  80099b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80099f:	0f 84 ba fb ff ff    	je     80055f <vprintfmt+0x79>
+  8009a5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8009a8:	89 f0                	mov    %esi,%eax
+  8009aa:	83 e8 01             	sub    $0x1,%eax
+  8009ad:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009b1:	75 f7                	jne    8009aa <vprintfmt+0x4c4>
+  8009b3:	89 45 10             	mov    %eax,0x10(%ebp)
+  8009b6:	e9 3c fb ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  8009bb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009be:	8d 70 01             	lea    0x1(%eax),%esi
+  8009c1:	0f b6 00             	movzbl (%eax),%eax
+  8009c4:	0f be d0             	movsbl %al,%edx
+  8009c7:	85 d2                	test   %edx,%edx
+  8009c9:	74 11                	je     8009dc <vprintfmt+0x4f6>
+  8009cb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009ce:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009d1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009d4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009d7:	e9 5d fd ff ff       	jmp    800739 <vprintfmt+0x253>
+  8009dc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009e2:	e9 10 fb ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  8009e7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ed:	e9 05 fb ff ff       	jmp    8004f7 <vprintfmt+0x11>
+  8009f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009f6:	7e 0a                	jle    800a02 <vprintfmt+0x51c>
+  8009f8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009fc:	0f 85 bd fc ff ff    	jne    8006bf <vprintfmt+0x1d9>
+  800a02:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a07:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a0c:	be 05 44 80 00       	mov    $0x804405,%esi
+  800a11:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a14:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a17:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a1a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a1d:	e9 17 fd ff ff       	jmp    800739 <vprintfmt+0x253>
+  800a22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a25:	5b                   	pop    %ebx
+  800a26:	5e                   	pop    %esi
+  800a27:	5f                   	pop    %edi
+  800a28:	5d                   	pop    %ebp
+  800a29:	c3                   	ret
+
+00800a2a <vsnprintf>:
+  800a2a:	55                   	push   %ebp
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	83 ec 18             	sub    $0x18,%esp
+  800a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a36:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a39:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a3d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a40:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a47:	85 c0                	test   %eax,%eax
+  800a49:	74 26                	je     800a71 <vsnprintf+0x47>
+  800a4b:	85 d2                	test   %edx,%edx
+  800a4d:	7e 22                	jle    800a71 <vsnprintf+0x47>
+  800a4f:	ff 75 14             	push   0x14(%ebp)
+  800a52:	ff 75 10             	push   0x10(%ebp)
+  800a55:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a58:	50                   	push   %eax
+  800a59:	68 ac 04 80 00       	push   $0x8004ac
+  800a5e:	e8 83 fa ff ff       	call   8004e6 <vprintfmt>
+  800a63:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a66:	c6 00 00             	movb   $0x0,(%eax)
+  800a69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a6c:	83 c4 10             	add    $0x10,%esp
+  800a6f:	c9                   	leave
+  800a70:	c3                   	ret
+  800a71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a76:	eb f7                	jmp    800a6f <vsnprintf+0x45>
+
+00800a78 <snprintf>:
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	83 ec 08             	sub    $0x8,%esp
+  800a7e:	8d 45 14             	lea    0x14(%ebp),%eax
+  800a81:	50                   	push   %eax
+  800a82:	ff 75 10             	push   0x10(%ebp)
+  800a85:	ff 75 0c             	push   0xc(%ebp)
+  800a88:	ff 75 08             	push   0x8(%ebp)
+  800a8b:	e8 9a ff ff ff       	call   800a2a <vsnprintf>
+  800a90:	c9                   	leave
+  800a91:	c3                   	ret
+
+00800a92 <strlen>:
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a98:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a9b:	74 10                	je     800aad <strlen+0x1b>
+  800a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa2:	83 c0 01             	add    $0x1,%eax
+  800aa5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800aa9:	75 f7                	jne    800aa2 <strlen+0x10>
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+  800aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab2:	eb f7                	jmp    800aab <strlen+0x19>
+
+00800ab4 <strnlen>:
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800abd:	85 d2                	test   %edx,%edx
+  800abf:	74 16                	je     800ad7 <strnlen+0x23>
+  800ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800aca:	74 09                	je     800ad5 <strnlen+0x21>
+  800acc:	83 c0 01             	add    $0x1,%eax
+  800acf:	39 d0                	cmp    %edx,%eax
+  800ad1:	75 f3                	jne    800ac6 <strnlen+0x12>
+  800ad3:	89 d0                	mov    %edx,%eax
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+  800ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adc:	eb f7                	jmp    800ad5 <strnlen+0x21>
+
+00800ade <strcpy>:
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	53                   	push   %ebx
+  800ae2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aed:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800af1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800af4:	83 c0 01             	add    $0x1,%eax
+  800af7:	84 d2                	test   %dl,%dl
+  800af9:	75 f2                	jne    800aed <strcpy+0xf>
+  800afb:	89 c8                	mov    %ecx,%eax
+  800afd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b00:	c9                   	leave
+  800b01:	c3                   	ret
+
+00800b02 <strcat>:
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	53                   	push   %ebx
+  800b06:	83 ec 10             	sub    $0x10,%esp
+  800b09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b0c:	53                   	push   %ebx
+  800b0d:	e8 80 ff ff ff       	call   800a92 <strlen>
+  800b12:	83 c4 08             	add    $0x8,%esp
+  800b15:	ff 75 0c             	push   0xc(%ebp)
+  800b18:	01 d8                	add    %ebx,%eax
+  800b1a:	50                   	push   %eax
+  800b1b:	e8 be ff ff ff       	call   800ade <strcpy>
+  800b20:	89 d8                	mov    %ebx,%eax
+  800b22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b25:	c9                   	leave
+  800b26:	c3                   	ret
+
+00800b27 <strncpy>:
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	56                   	push   %esi
+  800b2b:	53                   	push   %ebx
+  800b2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b35:	85 db                	test   %ebx,%ebx
+  800b37:	74 17                	je     800b50 <strncpy+0x29>
+  800b39:	01 f3                	add    %esi,%ebx
+  800b3b:	89 f0                	mov    %esi,%eax
+  800b3d:	83 c0 01             	add    $0x1,%eax
+  800b40:	0f b6 0a             	movzbl (%edx),%ecx
+  800b43:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b46:	80 f9 01             	cmp    $0x1,%cl
+  800b49:	83 da ff             	sbb    $0xffffffff,%edx
+  800b4c:	39 c3                	cmp    %eax,%ebx
+  800b4e:	75 ed                	jne    800b3d <strncpy+0x16>
+  800b50:	89 f0                	mov    %esi,%eax
+  800b52:	5b                   	pop    %ebx
+  800b53:	5e                   	pop    %esi
+  800b54:	5d                   	pop    %ebp
+  800b55:	c3                   	ret
+
+00800b56 <strlcpy>:
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	56                   	push   %esi
+  800b5a:	53                   	push   %ebx
+  800b5b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b64:	89 f0                	mov    %esi,%eax
+  800b66:	85 db                	test   %ebx,%ebx
+  800b68:	74 1e                	je     800b88 <strlcpy+0x32>
+  800b6a:	83 eb 01             	sub    $0x1,%ebx
+  800b6d:	74 16                	je     800b85 <strlcpy+0x2f>
+  800b6f:	01 f3                	add    %esi,%ebx
+  800b71:	0f b6 0a             	movzbl (%edx),%ecx
+  800b74:	84 c9                	test   %cl,%cl
+  800b76:	74 0d                	je     800b85 <strlcpy+0x2f>
+  800b78:	83 c2 01             	add    $0x1,%edx
+  800b7b:	83 c0 01             	add    $0x1,%eax
+  800b7e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b81:	39 d8                	cmp    %ebx,%eax
+  800b83:	75 ec                	jne    800b71 <strlcpy+0x1b>
+  800b85:	c6 00 00             	movb   $0x0,(%eax)
+  800b88:	29 f0                	sub    %esi,%eax
+  800b8a:	5b                   	pop    %ebx
+  800b8b:	5e                   	pop    %esi
+  800b8c:	5d                   	pop    %ebp
+  800b8d:	c3                   	ret
+
+00800b8e <strcmp>:
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b94:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b97:	0f b6 01             	movzbl (%ecx),%eax
+  800b9a:	84 c0                	test   %al,%al
+  800b9c:	74 11                	je     800baf <strcmp+0x21>
+  800b9e:	38 02                	cmp    %al,(%edx)
+  800ba0:	75 0d                	jne    800baf <strcmp+0x21>
+  800ba2:	83 c1 01             	add    $0x1,%ecx
+  800ba5:	83 c2 01             	add    $0x1,%edx
+  800ba8:	0f b6 01             	movzbl (%ecx),%eax
+  800bab:	84 c0                	test   %al,%al
+  800bad:	75 ef                	jne    800b9e <strcmp+0x10>
+  800baf:	0f b6 c0             	movzbl %al,%eax
+  800bb2:	0f b6 12             	movzbl (%edx),%edx
+  800bb5:	29 d0                	sub    %edx,%eax
+  800bb7:	5d                   	pop    %ebp
+  800bb8:	c3                   	ret
+
+00800bb9 <strncmp>:
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	53                   	push   %ebx
+  800bbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bc3:	8b 55 10             	mov    0x10(%ebp),%edx
+  800bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcb:	85 d2                	test   %edx,%edx
+  800bcd:	74 2e                	je     800bfd <strncmp+0x44>
+  800bcf:	0f b6 01             	movzbl (%ecx),%eax
+  800bd2:	84 c0                	test   %al,%al
+  800bd4:	74 16                	je     800bec <strncmp+0x33>
+  800bd6:	3a 03                	cmp    (%ebx),%al
+  800bd8:	75 12                	jne    800bec <strncmp+0x33>
+  800bda:	83 c1 01             	add    $0x1,%ecx
+  800bdd:	83 c3 01             	add    $0x1,%ebx
+  800be0:	83 ea 01             	sub    $0x1,%edx
+  800be3:	75 ea                	jne    800bcf <strncmp+0x16>
+  800be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bea:	eb 11                	jmp    800bfd <strncmp+0x44>
+  800bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf1:	85 d2                	test   %edx,%edx
+  800bf3:	74 08                	je     800bfd <strncmp+0x44>
+  800bf5:	0f b6 01             	movzbl (%ecx),%eax
+  800bf8:	0f b6 13             	movzbl (%ebx),%edx
+  800bfb:	29 d0                	sub    %edx,%eax
+  800bfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c00:	c9                   	leave
+  800c01:	c3                   	ret
+
+00800c02 <strchr>:
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c08:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800c0c:	0f b6 10             	movzbl (%eax),%edx
+  800c0f:	84 d2                	test   %dl,%dl
+  800c11:	74 15                	je     800c28 <strchr+0x26>
+  800c13:	38 d1                	cmp    %dl,%cl
+  800c15:	74 0f                	je     800c26 <strchr+0x24>
+  800c17:	83 c0 01             	add    $0x1,%eax
+  800c1a:	0f b6 10             	movzbl (%eax),%edx
+  800c1d:	84 d2                	test   %dl,%dl
+  800c1f:	75 f2                	jne    800c13 <strchr+0x11>
+  800c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c26:	5d                   	pop    %ebp
+  800c27:	c3                   	ret
+  800c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2d:	eb f7                	jmp    800c26 <strchr+0x24>
+
+00800c2f <strfind>:
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	53                   	push   %ebx
+  800c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c39:	0f b6 18             	movzbl (%eax),%ebx
+  800c3c:	38 d3                	cmp    %dl,%bl
+  800c3e:	74 14                	je     800c54 <strfind+0x25>
+  800c40:	89 d1                	mov    %edx,%ecx
+  800c42:	84 db                	test   %bl,%bl
+  800c44:	74 0e                	je     800c54 <strfind+0x25>
+  800c46:	83 c0 01             	add    $0x1,%eax
+  800c49:	0f b6 10             	movzbl (%eax),%edx
+  800c4c:	38 ca                	cmp    %cl,%dl
+  800c4e:	74 04                	je     800c54 <strfind+0x25>
+  800c50:	84 d2                	test   %dl,%dl
+  800c52:	75 f2                	jne    800c46 <strfind+0x17>
+  800c54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c57:	c9                   	leave
+  800c58:	c3                   	ret
+
+00800c59 <memset>:
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c60:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c63:	85 c9                	test   %ecx,%ecx
+  800c65:	74 20                	je     800c87 <memset+0x2e>
+  800c67:	89 f8                	mov    %edi,%eax
+  800c69:	09 c8                	or     %ecx,%eax
+  800c6b:	a8 03                	test   $0x3,%al
+  800c6d:	75 12                	jne    800c81 <memset+0x28>
+  800c6f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c73:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800c79:	c1 e9 02             	shr    $0x2,%ecx
+  800c7c:	fc                   	cld
+  800c7d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c7f:	eb 06                	jmp    800c87 <memset+0x2e>
+  800c81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c84:	fc                   	cld
+  800c85:	f3 aa                	rep stos %al,%es:(%edi)
+  800c87:	89 f8                	mov    %edi,%eax
+  800c89:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c8c:	c9                   	leave
+  800c8d:	c3                   	ret
+
+00800c8e <memmove>:
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	57                   	push   %edi
+  800c92:	56                   	push   %esi
+  800c93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c99:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c9c:	39 c6                	cmp    %eax,%esi
+  800c9e:	73 32                	jae    800cd2 <memmove+0x44>
+  800ca0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ca3:	39 d0                	cmp    %edx,%eax
+  800ca5:	73 2b                	jae    800cd2 <memmove+0x44>
+  800ca7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800caa:	89 d6                	mov    %edx,%esi
+  800cac:	09 fe                	or     %edi,%esi
+  800cae:	09 ce                	or     %ecx,%esi
+  800cb0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800cb6:	75 0e                	jne    800cc6 <memmove+0x38>
+  800cb8:	83 ef 04             	sub    $0x4,%edi
+  800cbb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800cbe:	c1 e9 02             	shr    $0x2,%ecx
+  800cc1:	fd                   	std
+  800cc2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cc4:	eb 09                	jmp    800ccf <memmove+0x41>
+  800cc6:	83 ef 01             	sub    $0x1,%edi
+  800cc9:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800ccc:	fd                   	std
+  800ccd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ccf:	fc                   	cld
+  800cd0:	eb 1a                	jmp    800cec <memmove+0x5e>
+  800cd2:	89 f2                	mov    %esi,%edx
+  800cd4:	09 c2                	or     %eax,%edx
+  800cd6:	09 ca                	or     %ecx,%edx
+  800cd8:	f6 c2 03             	test   $0x3,%dl
+  800cdb:	75 0a                	jne    800ce7 <memmove+0x59>
+  800cdd:	c1 e9 02             	shr    $0x2,%ecx
+  800ce0:	89 c7                	mov    %eax,%edi
+  800ce2:	fc                   	cld
+  800ce3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ce5:	eb 05                	jmp    800cec <memmove+0x5e>
+  800ce7:	89 c7                	mov    %eax,%edi
+  800ce9:	fc                   	cld
+  800cea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800cec:	5e                   	pop    %esi
+  800ced:	5f                   	pop    %edi
+  800cee:	5d                   	pop    %ebp
+  800cef:	c3                   	ret
+
+00800cf0 <memcpy>:
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	83 ec 0c             	sub    $0xc,%esp
+  800cf6:	ff 75 10             	push   0x10(%ebp)
+  800cf9:	ff 75 0c             	push   0xc(%ebp)
+  800cfc:	ff 75 08             	push   0x8(%ebp)
+  800cff:	e8 8a ff ff ff       	call   800c8e <memmove>
+  800d04:	c9                   	leave
+  800d05:	c3                   	ret
+
+00800d06 <memcmp>:
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+  800d0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d11:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d14:	85 f6                	test   %esi,%esi
+  800d16:	74 29                	je     800d41 <memcmp+0x3b>
+  800d18:	01 c6                	add    %eax,%esi
+  800d1a:	0f b6 08             	movzbl (%eax),%ecx
+  800d1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800d20:	38 d9                	cmp    %bl,%cl
+  800d22:	75 11                	jne    800d35 <memcmp+0x2f>
+  800d24:	83 c0 01             	add    $0x1,%eax
+  800d27:	83 c2 01             	add    $0x1,%edx
+  800d2a:	39 c6                	cmp    %eax,%esi
+  800d2c:	75 ec                	jne    800d1a <memcmp+0x14>
+  800d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d33:	eb 08                	jmp    800d3d <memcmp+0x37>
+  800d35:	0f b6 c1             	movzbl %cl,%eax
+  800d38:	0f b6 db             	movzbl %bl,%ebx
+  800d3b:	29 d8                	sub    %ebx,%eax
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+  800d41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d46:	eb f5                	jmp    800d3d <memcmp+0x37>
+
+00800d48 <memfind>:
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d51:	89 c2                	mov    %eax,%edx
+  800d53:	03 55 10             	add    0x10(%ebp),%edx
+  800d56:	39 d0                	cmp    %edx,%eax
+  800d58:	73 0d                	jae    800d67 <memfind+0x1f>
+  800d5a:	38 08                	cmp    %cl,(%eax)
+  800d5c:	74 0d                	je     800d6b <memfind+0x23>
+  800d5e:	83 c0 01             	add    $0x1,%eax
+  800d61:	39 c2                	cmp    %eax,%edx
+  800d63:	75 f5                	jne    800d5a <memfind+0x12>
+  800d65:	eb 06                	jmp    800d6d <memfind+0x25>
+  800d67:	89 c2                	mov    %eax,%edx
+  800d69:	eb 02                	jmp    800d6d <memfind+0x25>
+  800d6b:	89 c2                	mov    %eax,%edx
+  800d6d:	89 d0                	mov    %edx,%eax
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+
+00800d71 <strtol>:
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7d:	0f b6 02             	movzbl (%edx),%eax
+  800d80:	3c 20                	cmp    $0x20,%al
+  800d82:	74 04                	je     800d88 <strtol+0x17>
+  800d84:	3c 09                	cmp    $0x9,%al
+  800d86:	75 0e                	jne    800d96 <strtol+0x25>
+  800d88:	83 c2 01             	add    $0x1,%edx
+  800d8b:	0f b6 02             	movzbl (%edx),%eax
+  800d8e:	3c 20                	cmp    $0x20,%al
+  800d90:	74 f6                	je     800d88 <strtol+0x17>
+  800d92:	3c 09                	cmp    $0x9,%al
+  800d94:	74 f2                	je     800d88 <strtol+0x17>
+  800d96:	3c 2b                	cmp    $0x2b,%al
+  800d98:	74 2a                	je     800dc4 <strtol+0x53>
+  800d9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d9f:	3c 2d                	cmp    $0x2d,%al
+  800da1:	74 2b                	je     800dce <strtol+0x5d>
+  800da3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800da9:	75 0f                	jne    800dba <strtol+0x49>
+  800dab:	80 3a 30             	cmpb   $0x30,(%edx)
+  800dae:	74 28                	je     800dd8 <strtol+0x67>
+  800db0:	85 db                	test   %ebx,%ebx
+  800db2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db7:	0f 44 d8             	cmove  %eax,%ebx
+  800dba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dbf:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800dc2:	eb 46                	jmp    800e0a <strtol+0x99>
+  800dc4:	83 c2 01             	add    $0x1,%edx
+  800dc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dcc:	eb d5                	jmp    800da3 <strtol+0x32>
+  800dce:	83 c2 01             	add    $0x1,%edx
+  800dd1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800dd6:	eb cb                	jmp    800da3 <strtol+0x32>
+  800dd8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ddc:	74 0e                	je     800dec <strtol+0x7b>
+  800dde:	85 db                	test   %ebx,%ebx
+  800de0:	75 d8                	jne    800dba <strtol+0x49>
+  800de2:	83 c2 01             	add    $0x1,%edx
+  800de5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800dea:	eb ce                	jmp    800dba <strtol+0x49>
+  800dec:	83 c2 02             	add    $0x2,%edx
+  800def:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800df4:	eb c4                	jmp    800dba <strtol+0x49>
+  800df6:	0f be c0             	movsbl %al,%eax
+  800df9:	83 e8 30             	sub    $0x30,%eax
+  800dfc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dff:	7d 3a                	jge    800e3b <strtol+0xca>
+  800e01:	83 c2 01             	add    $0x1,%edx
+  800e04:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e08:	01 c1                	add    %eax,%ecx
+  800e0a:	0f b6 02             	movzbl (%edx),%eax
+  800e0d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e10:	89 f3                	mov    %esi,%ebx
+  800e12:	80 fb 09             	cmp    $0x9,%bl
+  800e15:	76 df                	jbe    800df6 <strtol+0x85>
+  800e17:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e1a:	89 f3                	mov    %esi,%ebx
+  800e1c:	80 fb 19             	cmp    $0x19,%bl
+  800e1f:	77 08                	ja     800e29 <strtol+0xb8>
+  800e21:	0f be c0             	movsbl %al,%eax
+  800e24:	83 e8 57             	sub    $0x57,%eax
+  800e27:	eb d3                	jmp    800dfc <strtol+0x8b>
+  800e29:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e2c:	89 f3                	mov    %esi,%ebx
+  800e2e:	80 fb 19             	cmp    $0x19,%bl
+  800e31:	77 08                	ja     800e3b <strtol+0xca>
+  800e33:	0f be c0             	movsbl %al,%eax
+  800e36:	83 e8 37             	sub    $0x37,%eax
+  800e39:	eb c1                	jmp    800dfc <strtol+0x8b>
+  800e3b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e3f:	74 05                	je     800e46 <strtol+0xd5>
+  800e41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e44:	89 10                	mov    %edx,(%eax)
+  800e46:	89 c8                	mov    %ecx,%eax
+  800e48:	f7 d8                	neg    %eax
+  800e4a:	85 ff                	test   %edi,%edi
+  800e4c:	0f 45 c8             	cmovne %eax,%ecx
+  800e4f:	89 c8                	mov    %ecx,%eax
+  800e51:	5b                   	pop    %ebx
+  800e52:	5e                   	pop    %esi
+  800e53:	5f                   	pop    %edi
+  800e54:	5d                   	pop    %ebp
+  800e55:	c3                   	ret
+
+00800e56 <sys_cputs>:
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	57                   	push   %edi
+  800e5a:	56                   	push   %esi
+  800e5b:	53                   	push   %ebx
+  800e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e67:	89 c3                	mov    %eax,%ebx
+  800e69:	89 c7                	mov    %eax,%edi
+  800e6b:	89 c6                	mov    %eax,%esi
+  800e6d:	cd 30                	int    $0x30
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5f                   	pop    %edi
+  800e72:	5d                   	pop    %ebp
+  800e73:	c3                   	ret
+
+00800e74 <sys_cgetc>:
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e84:	89 d1                	mov    %edx,%ecx
+  800e86:	89 d3                	mov    %edx,%ebx
+  800e88:	89 d7                	mov    %edx,%edi
+  800e8a:	89 d6                	mov    %edx,%esi
+  800e8c:	cd 30                	int    $0x30
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+
+00800e93 <sys_env_destroy>:
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ea9:	89 cb                	mov    %ecx,%ebx
+  800eab:	89 cf                	mov    %ecx,%edi
+  800ead:	89 ce                	mov    %ecx,%esi
+  800eaf:	cd 30                	int    $0x30
+  800eb1:	85 c0                	test   %eax,%eax
+  800eb3:	7f 08                	jg     800ebd <sys_env_destroy+0x2a>
+  800eb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb8:	5b                   	pop    %ebx
+  800eb9:	5e                   	pop    %esi
+  800eba:	5f                   	pop    %edi
+  800ebb:	5d                   	pop    %ebp
+  800ebc:	c3                   	ret
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  800ec0:	50                   	push   %eax
+  800ec1:	6a 03                	push   $0x3
+  800ec3:	68 0b 47 80 00       	push   $0x80470b
+  800ec8:	6a 24                	push   $0x24
+  800eca:	68 28 47 80 00       	push   $0x804728
+  800ecf:	e8 38 f4 ff ff       	call   80030c <_panic>
+
+00800ed4 <sys_getenvid>:
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  800eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee4:	89 d1                	mov    %edx,%ecx
+  800ee6:	89 d3                	mov    %edx,%ebx
+  800ee8:	89 d7                	mov    %edx,%edi
+  800eea:	89 d6                	mov    %edx,%esi
+  800eec:	cd 30                	int    $0x30
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+
+00800ef3 <sys_yield>:
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  800ef9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f00:	74 26                	je     800f28 <sys_yield+0x35>
+  800f02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f07:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f0c:	89 d1                	mov    %edx,%ecx
+  800f0e:	89 d3                	mov    %edx,%ebx
+  800f10:	89 d7                	mov    %edx,%edi
+  800f12:	6a 00                	push   $0x0
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	8d 35 1f 0f 80 00    	lea    0x800f1f,%esi
+  800f1d:	0f 34                	sysenter
+  800f1f:	5d                   	pop    %ebp
+  800f20:	83 c4 04             	add    $0x4,%esp
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+  800f28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f32:	89 d1                	mov    %edx,%ecx
+  800f34:	89 d3                	mov    %edx,%ebx
+  800f36:	89 d7                	mov    %edx,%edi
+  800f38:	89 d6                	mov    %edx,%esi
+  800f3a:	cd 30                	int    $0x30
+  800f3c:	eb e5                	jmp    800f23 <sys_yield+0x30>
+
+00800f3e <sys_page_alloc>:
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+  800f44:	83 ec 0c             	sub    $0xc,%esp
+  800f47:	be 00 00 00 00       	mov    $0x0,%esi
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f52:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5a:	89 f7                	mov    %esi,%edi
+  800f5c:	cd 30                	int    $0x30
+  800f5e:	85 c0                	test   %eax,%eax
+  800f60:	7f 08                	jg     800f6a <sys_page_alloc+0x2c>
+  800f62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f65:	5b                   	pop    %ebx
+  800f66:	5e                   	pop    %esi
+  800f67:	5f                   	pop    %edi
+  800f68:	5d                   	pop    %ebp
+  800f69:	c3                   	ret
+  800f6a:	83 ec 0c             	sub    $0xc,%esp
+  800f6d:	50                   	push   %eax
+  800f6e:	6a 04                	push   $0x4
+  800f70:	68 0b 47 80 00       	push   $0x80470b
+  800f75:	6a 24                	push   $0x24
+  800f77:	68 28 47 80 00       	push   $0x804728
+  800f7c:	e8 8b f3 ff ff       	call   80030c <_panic>
+
+00800f81 <sys_page_map>:
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	56                   	push   %esi
+  800f86:	53                   	push   %ebx
+  800f87:	83 ec 0c             	sub    $0xc,%esp
+  800f8a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f91:	74 33                	je     800fc6 <sys_page_map+0x45>
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f99:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa4:	ff 75 18             	push   0x18(%ebp)
+  800fa7:	55                   	push   %ebp
+  800fa8:	89 e5                	mov    %esp,%ebp
+  800faa:	8d 35 b2 0f 80 00    	lea    0x800fb2,%esi
+  800fb0:	0f 34                	sysenter
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	83 c4 04             	add    $0x4,%esp
+  800fb6:	89 c2                	mov    %eax,%edx
+  800fb8:	85 c0                	test   %eax,%eax
+  800fba:	7f 3d                	jg     800ff9 <sys_page_map+0x78>
+  800fbc:	89 d0                	mov    %edx,%eax
+  800fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+  800fc6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fda:	cd 30                	int    $0x30
+  800fdc:	89 c2                	mov    %eax,%edx
+  800fde:	85 c0                	test   %eax,%eax
+  800fe0:	7e da                	jle    800fbc <sys_page_map+0x3b>
+  800fe2:	83 ec 0c             	sub    $0xc,%esp
+  800fe5:	50                   	push   %eax
+  800fe6:	6a 05                	push   $0x5
+  800fe8:	68 0b 47 80 00       	push   $0x80470b
+  800fed:	6a 24                	push   $0x24
+  800fef:	68 28 47 80 00       	push   $0x804728
+  800ff4:	e8 13 f3 ff ff       	call   80030c <_panic>
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+  800ffc:	50                   	push   %eax
+  800ffd:	6a 05                	push   $0x5
+  800fff:	68 0b 47 80 00       	push   $0x80470b
+  801004:	6a 48                	push   $0x48
+  801006:	68 28 47 80 00       	push   $0x804728
+  80100b:	e8 fc f2 ff ff       	call   80030c <_panic>
+
+00801010 <sys_page_unmap>:
+  801010:	55                   	push   %ebp
+  801011:	89 e5                	mov    %esp,%ebp
+  801013:	57                   	push   %edi
+  801014:	56                   	push   %esi
+  801015:	53                   	push   %ebx
+  801016:	83 ec 0c             	sub    $0xc,%esp
+  801019:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801021:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801024:	b8 06 00 00 00       	mov    $0x6,%eax
+  801029:	89 df                	mov    %ebx,%edi
+  80102b:	89 de                	mov    %ebx,%esi
+  80102d:	cd 30                	int    $0x30
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	7f 08                	jg     80103b <sys_page_unmap+0x2b>
+  801033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801036:	5b                   	pop    %ebx
+  801037:	5e                   	pop    %esi
+  801038:	5f                   	pop    %edi
+  801039:	5d                   	pop    %ebp
+  80103a:	c3                   	ret
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+  80103e:	50                   	push   %eax
+  80103f:	6a 06                	push   $0x6
+  801041:	68 0b 47 80 00       	push   $0x80470b
+  801046:	6a 24                	push   $0x24
+  801048:	68 28 47 80 00       	push   $0x804728
+  80104d:	e8 ba f2 ff ff       	call   80030c <_panic>
+
+00801052 <sys_fork>:
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	57                   	push   %edi
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+  801058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801062:	89 d1                	mov    %edx,%ecx
+  801064:	89 d3                	mov    %edx,%ebx
+  801066:	89 d7                	mov    %edx,%edi
+  801068:	89 d6                	mov    %edx,%esi
+  80106a:	cd 30                	int    $0x30
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5f                   	pop    %edi
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+
+00801071 <sys_env_set_status>:
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	57                   	push   %edi
+  801075:	56                   	push   %esi
+  801076:	53                   	push   %ebx
+  801077:	83 ec 0c             	sub    $0xc,%esp
+  80107a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801082:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801085:	b8 08 00 00 00       	mov    $0x8,%eax
+  80108a:	89 df                	mov    %ebx,%edi
+  80108c:	89 de                	mov    %ebx,%esi
+  80108e:	cd 30                	int    $0x30
+  801090:	85 c0                	test   %eax,%eax
+  801092:	7f 08                	jg     80109c <sys_env_set_status+0x2b>
+  801094:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801097:	5b                   	pop    %ebx
+  801098:	5e                   	pop    %esi
+  801099:	5f                   	pop    %edi
+  80109a:	5d                   	pop    %ebp
+  80109b:	c3                   	ret
+  80109c:	83 ec 0c             	sub    $0xc,%esp
+  80109f:	50                   	push   %eax
+  8010a0:	6a 08                	push   $0x8
+  8010a2:	68 0b 47 80 00       	push   $0x80470b
+  8010a7:	6a 24                	push   $0x24
+  8010a9:	68 28 47 80 00       	push   $0x804728
+  8010ae:	e8 59 f2 ff ff       	call   80030c <_panic>
+
+008010b3 <sys_env_set_trapframe>:
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	57                   	push   %edi
+  8010b7:	56                   	push   %esi
+  8010b8:	53                   	push   %ebx
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+  8010bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010cc:	89 df                	mov    %ebx,%edi
+  8010ce:	89 de                	mov    %ebx,%esi
+  8010d0:	cd 30                	int    $0x30
+  8010d2:	85 c0                	test   %eax,%eax
+  8010d4:	7f 08                	jg     8010de <sys_env_set_trapframe+0x2b>
+  8010d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	50                   	push   %eax
+  8010e2:	6a 09                	push   $0x9
+  8010e4:	68 0b 47 80 00       	push   $0x80470b
+  8010e9:	6a 24                	push   $0x24
+  8010eb:	68 28 47 80 00       	push   $0x804728
+  8010f0:	e8 17 f2 ff ff       	call   80030c <_panic>
+
+008010f5 <sys_env_set_cow>:
+  8010f5:	55                   	push   %ebp
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	57                   	push   %edi
+  8010f9:	56                   	push   %esi
+  8010fa:	53                   	push   %ebx
+  8010fb:	83 ec 0c             	sub    $0xc,%esp
+  8010fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801109:	b8 20 00 00 00       	mov    $0x20,%eax
+  80110e:	89 df                	mov    %ebx,%edi
+  801110:	89 de                	mov    %ebx,%esi
+  801112:	cd 30                	int    $0x30
+  801114:	85 c0                	test   %eax,%eax
+  801116:	7f 08                	jg     801120 <sys_env_set_cow+0x2b>
+  801118:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111b:	5b                   	pop    %ebx
+  80111c:	5e                   	pop    %esi
+  80111d:	5f                   	pop    %edi
+  80111e:	5d                   	pop    %ebp
+  80111f:	c3                   	ret
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  801123:	50                   	push   %eax
+  801124:	6a 20                	push   $0x20
+  801126:	68 0b 47 80 00       	push   $0x80470b
+  80112b:	6a 24                	push   $0x24
+  80112d:	68 28 47 80 00       	push   $0x804728
+  801132:	e8 d5 f1 ff ff       	call   80030c <_panic>
+
+00801137 <sys_env_service>:
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	56                   	push   %esi
+  80113c:	53                   	push   %ebx
+  80113d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801142:	8b 55 08             	mov    0x8(%ebp),%edx
+  801145:	b8 21 00 00 00       	mov    $0x21,%eax
+  80114a:	89 cb                	mov    %ecx,%ebx
+  80114c:	89 cf                	mov    %ecx,%edi
+  80114e:	89 ce                	mov    %ecx,%esi
+  801150:	cd 30                	int    $0x30
+  801152:	5b                   	pop    %ebx
+  801153:	5e                   	pop    %esi
+  801154:	5f                   	pop    %edi
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+
+00801157 <sys_env_set_pgfault_upcall>:
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	57                   	push   %edi
+  80115b:	56                   	push   %esi
+  80115c:	53                   	push   %ebx
+  80115d:	83 ec 0c             	sub    $0xc,%esp
+  801160:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801165:	8b 55 08             	mov    0x8(%ebp),%edx
+  801168:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801170:	89 df                	mov    %ebx,%edi
+  801172:	89 de                	mov    %ebx,%esi
+  801174:	cd 30                	int    $0x30
+  801176:	85 c0                	test   %eax,%eax
+  801178:	7f 08                	jg     801182 <sys_env_set_pgfault_upcall+0x2b>
+  80117a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117d:	5b                   	pop    %ebx
+  80117e:	5e                   	pop    %esi
+  80117f:	5f                   	pop    %edi
+  801180:	5d                   	pop    %ebp
+  801181:	c3                   	ret
+  801182:	83 ec 0c             	sub    $0xc,%esp
+  801185:	50                   	push   %eax
+  801186:	6a 0a                	push   $0xa
+  801188:	68 0b 47 80 00       	push   $0x80470b
+  80118d:	6a 24                	push   $0x24
+  80118f:	68 28 47 80 00       	push   $0x804728
+  801194:	e8 73 f1 ff ff       	call   80030c <_panic>
+
+00801199 <sys_ipc_try_send>:
+  801199:	55                   	push   %ebp
+  80119a:	89 e5                	mov    %esp,%ebp
+  80119c:	57                   	push   %edi
+  80119d:	56                   	push   %esi
+  80119e:	53                   	push   %ebx
+  80119f:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011a6:	74 27                	je     8011cf <sys_ipc_try_send+0x36>
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b9:	6a 00                	push   $0x0
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	8d 35 c6 11 80 00    	lea    0x8011c6,%esi
+  8011c4:	0f 34                	sysenter
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	83 c4 04             	add    $0x4,%esp
+  8011ca:	5b                   	pop    %ebx
+  8011cb:	5e                   	pop    %esi
+  8011cc:	5f                   	pop    %edi
+  8011cd:	5d                   	pop    %ebp
+  8011ce:	c3                   	ret
+  8011cf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e5:	cd 30                	int    $0x30
+  8011e7:	eb e1                	jmp    8011ca <sys_ipc_try_send+0x31>
+
+008011e9 <sys_ipc_recv>:
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011f9:	74 32                	je     80122d <sys_ipc_recv+0x44>
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801203:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801208:	89 cb                	mov    %ecx,%ebx
+  80120a:	89 cf                	mov    %ecx,%edi
+  80120c:	6a 00                	push   $0x0
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	8d 35 19 12 80 00    	lea    0x801219,%esi
+  801217:	0f 34                	sysenter
+  801219:	5d                   	pop    %ebp
+  80121a:	83 c4 04             	add    $0x4,%esp
+  80121d:	89 c2                	mov    %eax,%edx
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	7f 3c                	jg     80125f <sys_ipc_recv+0x76>
+  801223:	89 d0                	mov    %edx,%eax
+  801225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801228:	5b                   	pop    %ebx
+  801229:	5e                   	pop    %esi
+  80122a:	5f                   	pop    %edi
+  80122b:	5d                   	pop    %ebp
+  80122c:	c3                   	ret
+  80122d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801232:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	89 cb                	mov    %ecx,%ebx
+  80123c:	89 cf                	mov    %ecx,%edi
+  80123e:	89 ce                	mov    %ecx,%esi
+  801240:	cd 30                	int    $0x30
+  801242:	89 c2                	mov    %eax,%edx
+  801244:	85 c0                	test   %eax,%eax
+  801246:	7e db                	jle    801223 <sys_ipc_recv+0x3a>
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	50                   	push   %eax
+  80124c:	6a 0d                	push   $0xd
+  80124e:	68 0b 47 80 00       	push   $0x80470b
+  801253:	6a 24                	push   $0x24
+  801255:	68 28 47 80 00       	push   $0x804728
+  80125a:	e8 ad f0 ff ff       	call   80030c <_panic>
+  80125f:	83 ec 0c             	sub    $0xc,%esp
+  801262:	50                   	push   %eax
+  801263:	6a 0d                	push   $0xd
+  801265:	68 0b 47 80 00       	push   $0x80470b
+  80126a:	6a 48                	push   $0x48
+  80126c:	68 28 47 80 00       	push   $0x804728
+  801271:	e8 96 f0 ff ff       	call   80030c <_panic>
+
+00801276 <sys_ipc_send>:
+  801276:	55                   	push   %ebp
+  801277:	89 e5                	mov    %esp,%ebp
+  801279:	57                   	push   %edi
+  80127a:	56                   	push   %esi
+  80127b:	53                   	push   %ebx
+  80127c:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801283:	74 27                	je     8012ac <sys_ipc_send+0x36>
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801290:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801293:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801296:	6a 00                	push   $0x0
+  801298:	55                   	push   %ebp
+  801299:	89 e5                	mov    %esp,%ebp
+  80129b:	8d 35 a3 12 80 00    	lea    0x8012a3,%esi
+  8012a1:	0f 34                	sysenter
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	83 c4 04             	add    $0x4,%esp
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+  8012ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c2:	cd 30                	int    $0x30
+  8012c4:	eb e1                	jmp    8012a7 <sys_ipc_send+0x31>
+
+008012c6 <sys_ipc_call>:
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	57                   	push   %edi
+  8012ca:	56                   	push   %esi
+  8012cb:	53                   	push   %ebx
+  8012cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012dd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012e0:	cd 30                	int    $0x30
+  8012e2:	5b                   	pop    %ebx
+  8012e3:	5e                   	pop    %esi
+  8012e4:	5f                   	pop    %edi
+  8012e5:	5d                   	pop    %ebp
+  8012e6:	c3                   	ret
+
+008012e7 <sys_ipc_reply_recv>:
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	57                   	push   %edi
+  8012eb:	56                   	push   %esi
+  8012ec:	53                   	push   %ebx
+  8012ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fe:	8b 75 18             	mov    0x18(%ebp),%esi
+  801301:	cd 30                	int    $0x30
+  801303:	5b                   	pop    %ebx
+  801304:	5e                   	pop    %esi
+  801305:	5f                   	pop    %edi
+  801306:	5d                   	pop    %ebp
+  801307:	c3                   	ret
+
+00801308 <sys_time_msec>:
+  801308:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	75 06                	jne    801317 <sys_time_msec+0xf>
+  801311:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801316:	c3                   	ret
+  801317:	55                   	push   %ebp
+  801318:	89 e5                	mov    %esp,%ebp
+  80131a:	57                   	push   %edi
+  80131b:	56                   	push   %esi
+  80131c:	53                   	push   %ebx
+  80131d:	83 ec 0c             	sub    $0xc,%esp
+  801320:	0f 31                	rdtsc
+  801322:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801328:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80132e:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801334:	29 c8                	sub    %ecx,%eax
+  801336:	19 da                	sbb    %ebx,%edx
+  801338:	bf 00 00 00 00       	mov    $0x0,%edi
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	52                   	push   %edx
+  801340:	50                   	push   %eax
+  801341:	e8 56 2e 00 00       	call   80419c <__udivdi3>
+  801346:	83 c4 10             	add    $0x10,%esp
+  801349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+
+00801351 <sys_env_swap>:
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	57                   	push   %edi
+  801355:	56                   	push   %esi
+  801356:	53                   	push   %ebx
+  801357:	83 ec 0c             	sub    $0xc,%esp
+  80135a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801362:	b8 12 00 00 00       	mov    $0x12,%eax
+  801367:	89 cb                	mov    %ecx,%ebx
+  801369:	89 cf                	mov    %ecx,%edi
+  80136b:	89 ce                	mov    %ecx,%esi
+  80136d:	cd 30                	int    $0x30
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	7f 08                	jg     80137b <sys_env_swap+0x2a>
+  801373:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801376:	5b                   	pop    %ebx
+  801377:	5e                   	pop    %esi
+  801378:	5f                   	pop    %edi
+  801379:	5d                   	pop    %ebp
+  80137a:	c3                   	ret
+  80137b:	83 ec 0c             	sub    $0xc,%esp
+  80137e:	50                   	push   %eax
+  80137f:	6a 12                	push   $0x12
+  801381:	68 0b 47 80 00       	push   $0x80470b
+  801386:	6a 24                	push   $0x24
+  801388:	68 28 47 80 00       	push   $0x804728
+  80138d:	e8 7a ef ff ff       	call   80030c <_panic>
+
+00801392 <sys_net_try_send>:
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+  801398:	83 ec 0c             	sub    $0xc,%esp
+  80139b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013ab:	89 df                	mov    %ebx,%edi
+  8013ad:	89 de                	mov    %ebx,%esi
+  8013af:	cd 30                	int    $0x30
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	7f 08                	jg     8013bd <sys_net_try_send+0x2b>
+  8013b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5f                   	pop    %edi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+  8013bd:	83 ec 0c             	sub    $0xc,%esp
+  8013c0:	50                   	push   %eax
+  8013c1:	6a 13                	push   $0x13
+  8013c3:	68 0b 47 80 00       	push   $0x80470b
+  8013c8:	6a 24                	push   $0x24
+  8013ca:	68 28 47 80 00       	push   $0x804728
+  8013cf:	e8 38 ef ff ff       	call   80030c <_panic>
+
+008013d4 <sys_net_try_receive>:
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	57                   	push   %edi
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013ed:	89 df                	mov    %ebx,%edi
+  8013ef:	89 de                	mov    %ebx,%esi
+  8013f1:	cd 30                	int    $0x30
+  8013f3:	85 c0                	test   %eax,%eax
+  8013f5:	7f 08                	jg     8013ff <sys_net_try_receive+0x2b>
+  8013f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fa:	5b                   	pop    %ebx
+  8013fb:	5e                   	pop    %esi
+  8013fc:	5f                   	pop    %edi
+  8013fd:	5d                   	pop    %ebp
+  8013fe:	c3                   	ret
+  8013ff:	83 ec 0c             	sub    $0xc,%esp
+  801402:	50                   	push   %eax
+  801403:	6a 14                	push   $0x14
+  801405:	68 0b 47 80 00       	push   $0x80470b
+  80140a:	6a 24                	push   $0x24
+  80140c:	68 28 47 80 00       	push   $0x804728
+  801411:	e8 f6 ee ff ff       	call   80030c <_panic>
+
+00801416 <sys_net_recv_page>:
+  801416:	55                   	push   %ebp
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	57                   	push   %edi
+  80141a:	56                   	push   %esi
+  80141b:	53                   	push   %ebx
+  80141c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801421:	8b 55 08             	mov    0x8(%ebp),%edx
+  801424:	b8 27 00 00 00       	mov    $0x27,%eax
+  801429:	89 cb                	mov    %ecx,%ebx
+  80142b:	89 cf                	mov    %ecx,%edi
+  80142d:	89 ce                	mov    %ecx,%esi
+  80142f:	cd 30                	int    $0x30
+  801431:	5b                   	pop    %ebx
+  801432:	5e                   	pop    %esi
+  801433:	5f                   	pop    %edi
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+
+00801436 <sys_net_wait>:
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	57                   	push   %edi
+  80143a:	56                   	push   %esi
+  80143b:	53                   	push   %ebx
+  80143c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801441:	b8 26 00 00 00       	mov    $0x26,%eax
+  801446:	89 d1                	mov    %edx,%ecx
+  801448:	89 d3                	mov    %edx,%ebx
+  80144a:	89 d7                	mov    %edx,%edi
+  80144c:	89 d6                	mov    %edx,%esi
+  80144e:	cd 30                	int    $0x30
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+
+00801455 <sys_get_mac>:
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	57                   	push   %edi
+  801459:	56                   	push   %esi
+  80145a:	53                   	push   %ebx
+  80145b:	83 ec 0c             	sub    $0xc,%esp
+  80145e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801463:	8b 55 08             	mov    0x8(%ebp),%edx
+  801466:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801469:	b8 15 00 00 00       	mov    $0x15,%eax
+  80146e:	89 df                	mov    %ebx,%edi
+  801470:	89 de                	mov    %ebx,%esi
+  801472:	cd 30                	int    $0x30
+  801474:	85 c0                	test   %eax,%eax
+  801476:	7f 08                	jg     801480 <sys_get_mac+0x2b>
+  801478:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147b:	5b                   	pop    %ebx
+  80147c:	5e                   	pop    %esi
+  80147d:	5f                   	pop    %edi
+  80147e:	5d                   	pop    %ebp
+  80147f:	c3                   	ret
+  801480:	83 ec 0c             	sub    $0xc,%esp
+  801483:	50                   	push   %eax
+  801484:	6a 15                	push   $0x15
+  801486:	68 0b 47 80 00       	push   $0x80470b
+  80148b:	6a 24                	push   $0x24
+  80148d:	68 28 47 80 00       	push   $0x804728
+  801492:	e8 75 ee ff ff       	call   80030c <_panic>
+
+00801497 <sys_env_lease>:
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	57                   	push   %edi
+  80149b:	56                   	push   %esi
+  80149c:	53                   	push   %ebx
+  80149d:	83 ec 0c             	sub    $0xc,%esp
+  8014a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ab:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014b0:	89 df                	mov    %ebx,%edi
+  8014b2:	89 de                	mov    %ebx,%esi
+  8014b4:	cd 30                	int    $0x30
+  8014b6:	85 c0                	test   %eax,%eax
+  8014b8:	7f 08                	jg     8014c2 <sys_env_lease+0x2b>
+  8014ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014bd:	5b                   	pop    %ebx
+  8014be:	5e                   	pop    %esi
+  8014bf:	5f                   	pop    %edi
+  8014c0:	5d                   	pop    %ebp
+  8014c1:	c3                   	ret
+  8014c2:	83 ec 0c             	sub    $0xc,%esp
+  8014c5:	50                   	push   %eax
+  8014c6:	6a 16                	push   $0x16
+  8014c8:	68 0b 47 80 00       	push   $0x80470b
+  8014cd:	6a 24                	push   $0x24
+  8014cf:	68 28 47 80 00       	push   $0x804728
+  8014d4:	e8 33 ee ff ff       	call   80030c <_panic>
+
+008014d9 <sys_copy_mem>:
+  8014d9:	55                   	push   %ebp
+  8014da:	89 e5                	mov    %esp,%ebp
+  8014dc:	57                   	push   %edi
+  8014dd:	56                   	push   %esi
+  8014de:	53                   	push   %ebx
+  8014df:	83 ec 0c             	sub    $0xc,%esp
+  8014e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014f3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014f6:	cd 30                	int    $0x30
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	7f 08                	jg     801504 <sys_copy_mem+0x2b>
+  8014fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ff:	5b                   	pop    %ebx
+  801500:	5e                   	pop    %esi
+  801501:	5f                   	pop    %edi
+  801502:	5d                   	pop    %ebp
+  801503:	c3                   	ret
+  801504:	83 ec 0c             	sub    $0xc,%esp
+  801507:	50                   	push   %eax
+  801508:	6a 17                	push   $0x17
+  80150a:	68 0b 47 80 00       	push   $0x80470b
+  80150f:	6a 24                	push   $0x24
+  801511:	68 28 47 80 00       	push   $0x804728
+  801516:	e8 f1 ed ff ff       	call   80030c <_panic>
+
+0080151b <sys_get_perms>:
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	57                   	push   %edi
+  80151f:	56                   	push   %esi
+  801520:	53                   	push   %ebx
+  801521:	83 ec 0c             	sub    $0xc,%esp
+  801524:	be 00 00 00 00       	mov    $0x0,%esi
+  801529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801534:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801537:	89 f7                	mov    %esi,%edi
+  801539:	cd 30                	int    $0x30
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	7f 08                	jg     801547 <sys_get_perms+0x2c>
+  80153f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801542:	5b                   	pop    %ebx
+  801543:	5e                   	pop    %esi
+  801544:	5f                   	pop    %edi
+  801545:	5d                   	pop    %ebp
+  801546:	c3                   	ret
+  801547:	83 ec 0c             	sub    $0xc,%esp
+  80154a:	50                   	push   %eax
+  80154b:	6a 18                	push   $0x18
+  80154d:	68 0b 47 80 00       	push   $0x80470b
+  801552:	6a 24                	push   $0x24
+  801554:	68 28 47 80 00       	push   $0x804728
+  801559:	e8 ae ed ff ff       	call   80030c <_panic>
+
+0080155e <sys_env_unsuspend>:
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	57                   	push   %edi
+  801562:	56                   	push   %esi
+  801563:	53                   	push   %ebx
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+  80156c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801572:	b8 19 00 00 00       	mov    $0x19,%eax
+  801577:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157a:	89 f7                	mov    %esi,%edi
+  80157c:	cd 30                	int    $0x30
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	7f 08                	jg     80158a <sys_env_unsuspend+0x2c>
+  801582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5f                   	pop    %edi
+  801588:	5d                   	pop    %ebp
+  801589:	c3                   	ret
+  80158a:	83 ec 0c             	sub    $0xc,%esp
+  80158d:	50                   	push   %eax
+  80158e:	6a 19                	push   $0x19
+  801590:	68 0b 47 80 00       	push   $0x80470b
+  801595:	6a 24                	push   $0x24
+  801597:	68 28 47 80 00       	push   $0x804728
+  80159c:	e8 6b ed ff ff       	call   80030c <_panic>
+
+008015a1 <sys_migrate>:
+  8015a1:	55                   	push   %ebp
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	57                   	push   %edi
+  8015a5:	56                   	push   %esi
+  8015a6:	53                   	push   %ebx
+  8015a7:	83 ec 0c             	sub    $0xc,%esp
+  8015aa:	ba 04 f0 80 00       	mov    $0x80f004,%edx
+  8015af:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8015b5:	76 11                	jbe    8015c8 <sys_migrate+0x27>
+  8015b7:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8015bc:	0f b6 08             	movzbl (%eax),%ecx
+  8015bf:	05 00 10 00 00       	add    $0x1000,%eax
+  8015c4:	39 d0                	cmp    %edx,%eax
+  8015c6:	72 f4                	jb     8015bc <sys_migrate+0x1b>
+  8015c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015d5:	89 cb                	mov    %ecx,%ebx
+  8015d7:	89 cf                	mov    %ecx,%edi
+  8015d9:	89 ce                	mov    %ecx,%esi
+  8015db:	cd 30                	int    $0x30
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	7f 08                	jg     8015e9 <sys_migrate+0x48>
+  8015e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e4:	5b                   	pop    %ebx
+  8015e5:	5e                   	pop    %esi
+  8015e6:	5f                   	pop    %edi
+  8015e7:	5d                   	pop    %ebp
+  8015e8:	c3                   	ret
+  8015e9:	83 ec 0c             	sub    $0xc,%esp
+  8015ec:	50                   	push   %eax
+  8015ed:	6a 1a                	push   $0x1a
+  8015ef:	68 0b 47 80 00       	push   $0x80470b
+  8015f4:	6a 24                	push   $0x24
+  8015f6:	68 28 47 80 00       	push   $0x804728
+  8015fb:	e8 0c ed ff ff       	call   80030c <_panic>
+
+00801600 <sys_lease_complete>:
+  801600:	55                   	push   %ebp
+  801601:	89 e5                	mov    %esp,%ebp
+  801603:	57                   	push   %edi
+  801604:	56                   	push   %esi
+  801605:	53                   	push   %ebx
+  801606:	83 ec 0c             	sub    $0xc,%esp
+  801609:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801613:	89 d1                	mov    %edx,%ecx
+  801615:	89 d3                	mov    %edx,%ebx
+  801617:	89 d7                	mov    %edx,%edi
+  801619:	89 d6                	mov    %edx,%esi
+  80161b:	cd 30                	int    $0x30
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	7f 08                	jg     801629 <sys_lease_complete+0x29>
+  801621:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801624:	5b                   	pop    %ebx
+  801625:	5e                   	pop    %esi
+  801626:	5f                   	pop    %edi
+  801627:	5d                   	pop    %ebp
+  801628:	c3                   	ret
+  801629:	83 ec 0c             	sub    $0xc,%esp
+  80162c:	50                   	push   %eax
+  80162d:	6a 1b                	push   $0x1b
+  80162f:	68 0b 47 80 00       	push   $0x80470b
+  801634:	6a 24                	push   $0x24
+  801636:	68 28 47 80 00       	push   $0x804728
+  80163b:	e8 cc ec ff ff       	call   80030c <_panic>
+
+00801640 <sys_env_set_thisenv>:
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	57                   	push   %edi
+  801644:	56                   	push   %esi
+  801645:	53                   	push   %ebx
+  801646:	83 ec 0c             	sub    $0xc,%esp
+  801649:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801651:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801654:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801659:	89 df                	mov    %ebx,%edi
+  80165b:	89 de                	mov    %ebx,%esi
+  80165d:	cd 30                	int    $0x30
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	7f 08                	jg     80166b <sys_env_set_thisenv+0x2b>
+  801663:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801666:	5b                   	pop    %ebx
+  801667:	5e                   	pop    %esi
+  801668:	5f                   	pop    %edi
+  801669:	5d                   	pop    %ebp
+  80166a:	c3                   	ret
+  80166b:	83 ec 0c             	sub    $0xc,%esp
+  80166e:	50                   	push   %eax
+  80166f:	6a 1c                	push   $0x1c
+  801671:	68 0b 47 80 00       	push   $0x80470b
+  801676:	6a 24                	push   $0x24
+  801678:	68 28 47 80 00       	push   $0x804728
+  80167d:	e8 8a ec ff ff       	call   80030c <_panic>
+
+00801682 <sys_env_set_sched>:
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	57                   	push   %edi
+  801686:	56                   	push   %esi
+  801687:	53                   	push   %ebx
+  801688:	83 ec 0c             	sub    $0xc,%esp
+  80168b:	be 00 00 00 00       	mov    $0x0,%esi
+  801690:	8b 55 08             	mov    0x8(%ebp),%edx
+  801693:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801696:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80169b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80169e:	89 f7                	mov    %esi,%edi
+  8016a0:	cd 30                	int    $0x30
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	7f 08                	jg     8016ae <sys_env_set_sched+0x2c>
+  8016a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a9:	5b                   	pop    %ebx
+  8016aa:	5e                   	pop    %esi
+  8016ab:	5f                   	pop    %edi
+  8016ac:	5d                   	pop    %ebp
+  8016ad:	c3                   	ret
+  8016ae:	83 ec 0c             	sub    $0xc,%esp
+  8016b1:	50                   	push   %eax
+  8016b2:	6a 1d                	push   $0x1d
+  8016b4:	68 0b 47 80 00       	push   $0x80470b
+  8016b9:	6a 24                	push   $0x24
+  8016bb:	68 28 47 80 00       	push   $0x804728
+  8016c0:	e8 47 ec ff ff       	call   80030c <_panic>
+
+008016c5 <sys_batch>:
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	57                   	push   %edi
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8016db:	89 df                	mov    %ebx,%edi
+  8016dd:	89 de                	mov    %ebx,%esi
+  8016df:	cd 30                	int    $0x30
+  8016e1:	5b                   	pop    %ebx
+  8016e2:	5e                   	pop    %esi
+  8016e3:	5f                   	pop    %edi
+  8016e4:	5d                   	pop    %ebp
+  8016e5:	c3                   	ret
+
+008016e6 <sys_env_stats>:
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	57                   	push   %edi
+  8016ea:	56                   	push   %esi
+  8016eb:	53                   	push   %ebx
+  8016ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f7:	b8 23 00 00 00       	mov    $0x23,%eax
+  8016fc:	89 df                	mov    %ebx,%edi
+  8016fe:	89 de                	mov    %ebx,%esi
+  801700:	cd 30                	int    $0x30
+  801702:	5b                   	pop    %ebx
+  801703:	5e                   	pop    %esi
+  801704:	5f                   	pop    %edi
+  801705:	5d                   	pop    %ebp
+  801706:	c3                   	ret
+
+00801707 <sys_trace>:
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	57                   	push   %edi
+  80170b:	56                   	push   %esi
+  80170c:	53                   	push   %ebx
+  80170d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801712:	8b 55 08             	mov    0x8(%ebp),%edx
+  801715:	b8 24 00 00 00       	mov    $0x24,%eax
+  80171a:	89 cb                	mov    %ecx,%ebx
+  80171c:	89 cf                	mov    %ecx,%edi
+  80171e:	89 ce                	mov    %ecx,%esi
+  801720:	cd 30                	int    $0x30
+  801722:	5b                   	pop    %ebx
+  801723:	5e                   	pop    %esi
+  801724:	5f                   	pop    %edi
+  801725:	5d                   	pop    %ebp
+  801726:	c3                   	ret
+
+00801727 <sys_env_set_pager>:
+  801727:	55                   	push   %ebp
+  801728:	89 e5                	mov    %esp,%ebp
+  80172a:	57                   	push   %edi
+  80172b:	56                   	push   %esi
+  80172c:	53                   	push   %ebx
+  80172d:	83 ec 0c             	sub    $0xc,%esp
+  801730:	be 00 00 00 00       	mov    $0x0,%esi
+  801735:	8b 55 08             	mov    0x8(%ebp),%edx
+  801738:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173b:	b8 25 00 00 00       	mov    $0x25,%eax
+  801740:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801743:	89 f7                	mov    %esi,%edi
+  801745:	cd 30                	int    $0x30
+  801747:	85 c0                	test   %eax,%eax
+  801749:	7f 08                	jg     801753 <sys_env_set_pager+0x2c>
+  80174b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174e:	5b                   	pop    %ebx
+  80174f:	5e                   	pop    %esi
+  801750:	5f                   	pop    %edi
+  801751:	5d                   	pop    %ebp
+  801752:	c3                   	ret
+  801753:	83 ec 0c             	sub    $0xc,%esp
+  801756:	50                   	push   %eax
+  801757:	6a 25                	push   $0x25
+  801759:	68 0b 47 80 00       	push   $0x80470b
+  80175e:	6a 24                	push   $0x24
+  801760:	68 28 47 80 00       	push   $0x804728
+  801765:	e8 a2 eb ff ff       	call   80030c <_panic>
+
+0080176a <sys_pager_retire>:
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	57                   	push   %edi
+  80176e:	56                   	push   %esi
+  80176f:	53                   	push   %ebx
+  801770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801775:	8b 55 08             	mov    0x8(%ebp),%edx
+  801778:	b8 28 00 00 00       	mov    $0x28,%eax
+  80177d:	89 cb                	mov    %ecx,%ebx
+  80177f:	89 cf                	mov    %ecx,%edi
+  801781:	89 ce                	mov    %ecx,%esi
+  801783:	cd 30                	int    $0x30
+  801785:	5b                   	pop    %ebx
+  801786:	5e                   	pop    %esi
+  801787:	5f                   	pop    %edi
+  801788:	5d                   	pop    %ebp
+  801789:	c3                   	ret
+
+0080178a <sys_prof>:
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	57                   	push   %edi
+  80178e:	56                   	push   %esi
+  80178f:	53                   	push   %ebx
+  801790:	be 00 00 00 00       	mov    $0x0,%esi
+  801795:	8b 55 08             	mov    0x8(%ebp),%edx
+  801798:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80179b:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017a3:	89 f7                	mov    %esi,%edi
+  8017a5:	cd 30                	int    $0x30
+  8017a7:	5b                   	pop    %ebx
+  8017a8:	5e                   	pop    %esi
+  8017a9:	5f                   	pop    %edi
+  8017aa:	5d                   	pop    %ebp
+  8017ab:	c3                   	ret
+
+008017ac <ipc_recv>:
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	56                   	push   %esi
+  8017b0:	53                   	push   %ebx
+  8017b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  8017c1:	0f 44 c2             	cmove  %edx,%eax
+  8017c4:	83 ec 0c             	sub    $0xc,%esp
+  8017c7:	50                   	push   %eax
+  8017c8:	e8 1c fa ff ff       	call   8011e9 <sys_ipc_recv>
+  8017cd:	83 c4 10             	add    $0x10,%esp
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	78 2a                	js     8017fe <ipc_recv+0x52>
+  8017d4:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  8017d9:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8017df:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8017e5:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8017eb:	85 f6                	test   %esi,%esi
+  8017ed:	74 02                	je     8017f1 <ipc_recv+0x45>
+  8017ef:	89 0e                	mov    %ecx,(%esi)
+  8017f1:	85 db                	test   %ebx,%ebx
+  8017f3:	74 02                	je     8017f7 <ipc_recv+0x4b>
+  8017f5:	89 13                	mov    %edx,(%ebx)
+  8017f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017fa:	5b                   	pop    %ebx
+  8017fb:	5e                   	pop    %esi
+  8017fc:	5d                   	pop    %ebp
+  8017fd:	c3                   	ret
+  8017fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801803:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801808:	eb e1                	jmp    8017eb <ipc_recv+0x3f>
+
+0080180a <ipc_send>:
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	57                   	push   %edi
+  80180e:	56                   	push   %esi
+  80180f:	53                   	push   %ebx
+  801810:	83 ec 0c             	sub    $0xc,%esp
+  801813:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801816:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801819:	8b 75 14             	mov    0x14(%ebp),%esi
+  80181c:	85 db                	test   %ebx,%ebx
+  80181e:	74 1e                	je     80183e <ipc_send+0x34>
+  801820:	56                   	push   %esi
+  801821:	53                   	push   %ebx
+  801822:	57                   	push   %edi
+  801823:	ff 75 08             	push   0x8(%ebp)
+  801826:	e8 4b fa ff ff       	call   801276 <sys_ipc_send>
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	74 2a                	je     80185c <ipc_send+0x52>
+  801832:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801835:	75 13                	jne    80184a <ipc_send+0x40>
+  801837:	e8 b7 f6 ff ff       	call   800ef3 <sys_yield>
+  80183c:	eb e2                	jmp    801820 <ipc_send+0x16>
+  80183e:	be 00 00 00 00       	mov    $0x0,%esi
+  801843:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801848:	eb d6                	jmp    801820 <ipc_send+0x16>
+  80184a:	50                   	push   %eax
+  80184b:	68 38 47 80 00       	push   $0x804738
+  801850:	6a 4f                	push   $0x4f
+  801852:	68 7b 47 80 00       	push   $0x80477b
+  801857:	e8 b0 ea ff ff       	call   80030c <_panic>
+  80185c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80185f:	5b                   	pop    %ebx
+  801860:	5e                   	pop    %esi
+  801861:	5f                   	pop    %edi
+  801862:	5d                   	pop    %ebp
+  801863:	c3                   	ret
+
+00801864 <ipc_call>:
+  801864:	55                   	push   %ebp
+  801865:	89 e5                	mov    %esp,%ebp
+  801867:	57                   	push   %edi
+  801868:	56                   	push   %esi
+  801869:	53                   	push   %ebx
+  80186a:	83 ec 0c             	sub    $0xc,%esp
+  80186d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801871:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801876:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  80187a:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80187e:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801883:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801887:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80188b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801890:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801894:	eb 05                	jmp    80189b <ipc_call+0x37>
+  801896:	e8 58 f6 ff ff       	call   800ef3 <sys_yield>
+  80189b:	83 ec 0c             	sub    $0xc,%esp
+  80189e:	56                   	push   %esi
+  80189f:	53                   	push   %ebx
+  8018a0:	57                   	push   %edi
+  8018a1:	ff 75 0c             	push   0xc(%ebp)
+  8018a4:	ff 75 08             	push   0x8(%ebp)
+  8018a7:	e8 1a fa ff ff       	call   8012c6 <sys_ipc_call>
+  8018ac:	83 c4 20             	add    $0x20,%esp
+  8018af:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8018b2:	74 e2                	je     801896 <ipc_call+0x32>
+  8018b4:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8018b7:	74 2d                	je     8018e6 <ipc_call+0x82>
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 4f                	js     80190c <ipc_call+0xa8>
+  8018bd:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8018c1:	74 10                	je     8018d3 <ipc_call+0x6f>
+  8018c3:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  8018c8:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8018ce:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8018d1:	89 02                	mov    %eax,(%edx)
+  8018d3:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  8018d8:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8018de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e1:	5b                   	pop    %ebx
+  8018e2:	5e                   	pop    %esi
+  8018e3:	5f                   	pop    %edi
+  8018e4:	5d                   	pop    %ebp
+  8018e5:	c3                   	ret
+  8018e6:	ff 75 14             	push   0x14(%ebp)
+  8018e9:	ff 75 10             	push   0x10(%ebp)
+  8018ec:	ff 75 0c             	push   0xc(%ebp)
+  8018ef:	ff 75 08             	push   0x8(%ebp)
+  8018f2:	e8 13 ff ff ff       	call   80180a <ipc_send>
+  8018f7:	83 c4 0c             	add    $0xc,%esp
+  8018fa:	ff 75 1c             	push   0x1c(%ebp)
+  8018fd:	ff 75 18             	push   0x18(%ebp)
+  801900:	6a 00                	push   $0x0
+  801902:	e8 a5 fe ff ff       	call   8017ac <ipc_recv>
+  801907:	83 c4 10             	add    $0x10,%esp
+  80190a:	eb d2                	jmp    8018de <ipc_call+0x7a>
+  80190c:	50                   	push   %eax
+  80190d:	68 85 47 80 00       	push   $0x804785
+  801912:	6a 6d                	push   $0x6d
+  801914:	68 7b 47 80 00       	push   $0x80477b
+  801919:	e8 ee e9 ff ff       	call   80030c <_panic>
+
+0080191e <ipc_reply_recv>:
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	57                   	push   %edi
+  801922:	56                   	push   %esi
+  801923:	53                   	push   %ebx
+  801924:	83 ec 0c             	sub    $0xc,%esp
+  801927:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80192a:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  80192d:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801930:	85 db                	test   %ebx,%ebx
+  801932:	0f 84 ac 00 00 00    	je     8019e4 <ipc_reply_recv+0xc6>
+  801938:	85 f6                	test   %esi,%esi
+  80193a:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80193f:	0f 45 c6             	cmovne %esi,%eax
+  801942:	83 ec 0c             	sub    $0xc,%esp
+  801945:	50                   	push   %eax
+  801946:	ff 75 14             	push   0x14(%ebp)
+  801949:	53                   	push   %ebx
+  80194a:	ff 75 0c             	push   0xc(%ebp)
+  80194d:	ff 75 08             	push   0x8(%ebp)
+  801950:	e8 92 f9 ff ff       	call   8012e7 <sys_ipc_reply_recv>
+  801955:	83 c4 20             	add    $0x20,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 3a                	js     801996 <ipc_reply_recv+0x78>
+  80195c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801960:	74 10                	je     801972 <ipc_reply_recv+0x54>
+  801962:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  801967:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  80196d:	8b 55 18             	mov    0x18(%ebp),%edx
+  801970:	89 02                	mov    %eax,(%edx)
+  801972:	85 ff                	test   %edi,%edi
+  801974:	74 0d                	je     801983 <ipc_reply_recv+0x65>
+  801976:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  80197b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801981:	89 07                	mov    %eax,(%edi)
+  801983:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  801988:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80198e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801991:	5b                   	pop    %ebx
+  801992:	5e                   	pop    %esi
+  801993:	5f                   	pop    %edi
+  801994:	5d                   	pop    %ebp
+  801995:	c3                   	ret
+  801996:	ff 75 14             	push   0x14(%ebp)
+  801999:	53                   	push   %ebx
+  80199a:	ff 75 0c             	push   0xc(%ebp)
+  80199d:	ff 75 08             	push   0x8(%ebp)
+  8019a0:	e8 f4 f7 ff ff       	call   801199 <sys_ipc_try_send>
+  8019a5:	89 c2                	mov    %eax,%edx
+  8019a7:	c1 ea 1f             	shr    $0x1f,%edx
+  8019aa:	83 c4 10             	add    $0x10,%esp
+  8019ad:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8019b0:	0f 95 c1             	setne  %cl
+  8019b3:	84 d1                	test   %dl,%cl
+  8019b5:	74 05                	je     8019bc <ipc_reply_recv+0x9e>
+  8019b7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8019ba:	75 12                	jne    8019ce <ipc_reply_recv+0xb0>
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	57                   	push   %edi
+  8019c0:	56                   	push   %esi
+  8019c1:	ff 75 18             	push   0x18(%ebp)
+  8019c4:	e8 e3 fd ff ff       	call   8017ac <ipc_recv>
+  8019c9:	83 c4 10             	add    $0x10,%esp
+  8019cc:	eb c0                	jmp    80198e <ipc_reply_recv+0x70>
+  8019ce:	83 ec 04             	sub    $0x4,%esp
+  8019d1:	50                   	push   %eax
+  8019d2:	ff 75 08             	push   0x8(%ebp)
+  8019d5:	68 58 47 80 00       	push   $0x804758
+  8019da:	e8 08 ea ff ff       	call   8003e7 <cprintf>
+  8019df:	83 c4 10             	add    $0x10,%esp
+  8019e2:	eb d8                	jmp    8019bc <ipc_reply_recv+0x9e>
+  8019e4:	85 f6                	test   %esi,%esi
+  8019e6:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8019eb:	0f 45 c6             	cmovne %esi,%eax
+  8019ee:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8019f3:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8019fa:	e9 43 ff ff ff       	jmp    801942 <ipc_reply_recv+0x24>
+
+008019ff <ipc_find_env>:
+  8019ff:	55                   	push   %ebp
+  801a00:	89 e5                	mov    %esp,%ebp
+  801a02:	83 ec 14             	sub    $0x14,%esp
+  801a05:	ff 75 08             	push   0x8(%ebp)
+  801a08:	e8 2a f7 ff ff       	call   801137 <sys_env_service>
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a14:	0f 48 c2             	cmovs  %edx,%eax
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+
+00801a19 <fd2num>:
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a24:	c1 e8 0c             	shr    $0xc,%eax
+  801a27:	5d                   	pop    %ebp
+  801a28:	c3                   	ret
+
+00801a29 <fd2data>:
+  801a29:	55                   	push   %ebp
+  801a2a:	89 e5                	mov    %esp,%ebp
+  801a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a2f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a34:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a39:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801a3e:	5d                   	pop    %ebp
+  801a3f:	c3                   	ret
+
+00801a40 <fd_alloc>:
+  801a40:	55                   	push   %ebp
+  801a41:	89 e5                	mov    %esp,%ebp
+  801a43:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801a48:	89 c2                	mov    %eax,%edx
+  801a4a:	c1 ea 16             	shr    $0x16,%edx
+  801a4d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a54:	f6 c2 01             	test   $0x1,%dl
+  801a57:	74 29                	je     801a82 <fd_alloc+0x42>
+  801a59:	89 c2                	mov    %eax,%edx
+  801a5b:	c1 ea 0c             	shr    $0xc,%edx
+  801a5e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a65:	f6 c2 01             	test   $0x1,%dl
+  801a68:	74 18                	je     801a82 <fd_alloc+0x42>
+  801a6a:	05 00 10 00 00       	add    $0x1000,%eax
+  801a6f:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801a74:	75 d2                	jne    801a48 <fd_alloc+0x8>
+  801a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a80:	eb 05                	jmp    801a87 <fd_alloc+0x47>
+  801a82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a87:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8a:	89 02                	mov    %eax,(%edx)
+  801a8c:	89 c8                	mov    %ecx,%eax
+  801a8e:	5d                   	pop    %ebp
+  801a8f:	c3                   	ret
+
+00801a90 <fd_lookup>:
+  801a90:	55                   	push   %ebp
+  801a91:	89 e5                	mov    %esp,%ebp
+  801a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a96:	83 f8 1f             	cmp    $0x1f,%eax
+  801a99:	77 30                	ja     801acb <fd_lookup+0x3b>
+  801a9b:	c1 e0 0c             	shl    $0xc,%eax
+  801a9e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801aa3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801aa9:	f6 c2 01             	test   $0x1,%dl
+  801aac:	74 24                	je     801ad2 <fd_lookup+0x42>
+  801aae:	89 c2                	mov    %eax,%edx
+  801ab0:	c1 ea 0c             	shr    $0xc,%edx
+  801ab3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801aba:	f6 c2 01             	test   $0x1,%dl
+  801abd:	74 1a                	je     801ad9 <fd_lookup+0x49>
+  801abf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ac2:	89 02                	mov    %eax,(%edx)
+  801ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac9:	5d                   	pop    %ebp
+  801aca:	c3                   	ret
+  801acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad0:	eb f7                	jmp    801ac9 <fd_lookup+0x39>
+  801ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad7:	eb f0                	jmp    801ac9 <fd_lookup+0x39>
+  801ad9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ade:	eb e9                	jmp    801ac9 <fd_lookup+0x39>
+
+00801ae0 <dev_lookup>:
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	53                   	push   %ebx
+  801ae4:	83 ec 04             	sub    $0x4,%esp
+  801ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aef:	bb 04 70 80 00       	mov    $0x807004,%ebx
+  801af4:	39 13                	cmp    %edx,(%ebx)
+  801af6:	74 37                	je     801b2f <dev_lookup+0x4f>
+  801af8:	83 c0 01             	add    $0x1,%eax
+  801afb:	8b 1c 85 20 48 80 00 	mov    0x804820(,%eax,4),%ebx
+  801b02:	85 db                	test   %ebx,%ebx
+  801b04:	75 ee                	jne    801af4 <dev_lookup+0x14>
+  801b06:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  801b0b:	8b 40 48             	mov    0x48(%eax),%eax
+  801b0e:	83 ec 04             	sub    $0x4,%esp
+  801b11:	52                   	push   %edx
+  801b12:	50                   	push   %eax
+  801b13:	68 a4 47 80 00       	push   $0x8047a4
+  801b18:	e8 ca e8 ff ff       	call   8003e7 <cprintf>
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b25:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b28:	89 1a                	mov    %ebx,(%edx)
+  801b2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+  801b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b34:	eb ef                	jmp    801b25 <dev_lookup+0x45>
+
+00801b36 <fd_close>:
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	57                   	push   %edi
+  801b3a:	56                   	push   %esi
+  801b3b:	53                   	push   %ebx
+  801b3c:	83 ec 24             	sub    $0x24,%esp
+  801b3f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b42:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b45:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b48:	50                   	push   %eax
+  801b49:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b4f:	c1 e8 0c             	shr    $0xc,%eax
+  801b52:	50                   	push   %eax
+  801b53:	e8 38 ff ff ff       	call   801a90 <fd_lookup>
+  801b58:	89 c3                	mov    %eax,%ebx
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 05                	js     801b66 <fd_close+0x30>
+  801b61:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b64:	74 0f                	je     801b75 <fd_close+0x3f>
+  801b66:	85 ff                	test   %edi,%edi
+  801b68:	0f 44 df             	cmove  %edi,%ebx
+  801b6b:	89 d8                	mov    %ebx,%eax
+  801b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b70:	5b                   	pop    %ebx
+  801b71:	5e                   	pop    %esi
+  801b72:	5f                   	pop    %edi
+  801b73:	5d                   	pop    %ebp
+  801b74:	c3                   	ret
+  801b75:	83 ec 08             	sub    $0x8,%esp
+  801b78:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b7b:	50                   	push   %eax
+  801b7c:	ff 36                	push   (%esi)
+  801b7e:	e8 5d ff ff ff       	call   801ae0 <dev_lookup>
+  801b83:	89 c3                	mov    %eax,%ebx
+  801b85:	83 c4 10             	add    $0x10,%esp
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 1a                	js     801ba6 <fd_close+0x70>
+  801b8c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b8f:	8b 40 10             	mov    0x10(%eax),%eax
+  801b92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	74 0b                	je     801ba6 <fd_close+0x70>
+  801b9b:	83 ec 0c             	sub    $0xc,%esp
+  801b9e:	56                   	push   %esi
+  801b9f:	ff d0                	call   *%eax
+  801ba1:	89 c3                	mov    %eax,%ebx
+  801ba3:	83 c4 10             	add    $0x10,%esp
+  801ba6:	83 ec 08             	sub    $0x8,%esp
+  801ba9:	56                   	push   %esi
+  801baa:	6a 00                	push   $0x0
+  801bac:	e8 5f f4 ff ff       	call   801010 <sys_page_unmap>
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	eb b5                	jmp    801b6b <fd_close+0x35>
+
+00801bb6 <close>:
+  801bb6:	55                   	push   %ebp
+  801bb7:	89 e5                	mov    %esp,%ebp
+  801bb9:	83 ec 20             	sub    $0x20,%esp
+  801bbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bbf:	50                   	push   %eax
+  801bc0:	ff 75 08             	push   0x8(%ebp)
+  801bc3:	e8 c8 fe ff ff       	call   801a90 <fd_lookup>
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	85 c0                	test   %eax,%eax
+  801bcd:	79 02                	jns    801bd1 <close+0x1b>
+  801bcf:	c9                   	leave
+  801bd0:	c3                   	ret
+  801bd1:	83 ec 08             	sub    $0x8,%esp
+  801bd4:	6a 01                	push   $0x1
+  801bd6:	ff 75 f4             	push   -0xc(%ebp)
+  801bd9:	e8 58 ff ff ff       	call   801b36 <fd_close>
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	eb ec                	jmp    801bcf <close+0x19>
+
+00801be3 <close_all>:
+  801be3:	55                   	push   %ebp
+  801be4:	89 e5                	mov    %esp,%ebp
+  801be6:	53                   	push   %ebx
+  801be7:	83 ec 04             	sub    $0x4,%esp
+  801bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bef:	83 ec 0c             	sub    $0xc,%esp
+  801bf2:	53                   	push   %ebx
+  801bf3:	e8 be ff ff ff       	call   801bb6 <close>
+  801bf8:	83 c3 01             	add    $0x1,%ebx
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	83 fb 20             	cmp    $0x20,%ebx
+  801c01:	75 ec                	jne    801bef <close_all+0xc>
+  801c03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c06:	c9                   	leave
+  801c07:	c3                   	ret
+
+00801c08 <dup>:
+  801c08:	55                   	push   %ebp
+  801c09:	89 e5                	mov    %esp,%ebp
+  801c0b:	57                   	push   %edi
+  801c0c:	56                   	push   %esi
+  801c0d:	53                   	push   %ebx
+  801c0e:	83 ec 34             	sub    $0x34,%esp
+  801c11:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c14:	50                   	push   %eax
+  801c15:	ff 75 08             	push   0x8(%ebp)
+  801c18:	e8 73 fe ff ff       	call   801a90 <fd_lookup>
+  801c1d:	89 c3                	mov    %eax,%ebx
+  801c1f:	83 c4 10             	add    $0x10,%esp
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 7f                	js     801ca5 <dup+0x9d>
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+  801c29:	ff 75 0c             	push   0xc(%ebp)
+  801c2c:	e8 85 ff ff ff       	call   801bb6 <close>
+  801c31:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c34:	c1 e6 0c             	shl    $0xc,%esi
+  801c37:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801c3d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c40:	89 3c 24             	mov    %edi,(%esp)
+  801c43:	e8 e1 fd ff ff       	call   801a29 <fd2data>
+  801c48:	89 c3                	mov    %eax,%ebx
+  801c4a:	89 34 24             	mov    %esi,(%esp)
+  801c4d:	e8 d7 fd ff ff       	call   801a29 <fd2data>
+  801c52:	83 c4 10             	add    $0x10,%esp
+  801c55:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c58:	89 d8                	mov    %ebx,%eax
+  801c5a:	c1 e8 16             	shr    $0x16,%eax
+  801c5d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c64:	a8 01                	test   $0x1,%al
+  801c66:	74 11                	je     801c79 <dup+0x71>
+  801c68:	89 d8                	mov    %ebx,%eax
+  801c6a:	c1 e8 0c             	shr    $0xc,%eax
+  801c6d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c74:	f6 c2 01             	test   $0x1,%dl
+  801c77:	75 36                	jne    801caf <dup+0xa7>
+  801c79:	89 f8                	mov    %edi,%eax
+  801c7b:	c1 e8 0c             	shr    $0xc,%eax
+  801c7e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c85:	83 ec 0c             	sub    $0xc,%esp
+  801c88:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c8d:	50                   	push   %eax
+  801c8e:	56                   	push   %esi
+  801c8f:	6a 00                	push   $0x0
+  801c91:	57                   	push   %edi
+  801c92:	6a 00                	push   $0x0
+  801c94:	e8 e8 f2 ff ff       	call   800f81 <sys_page_map>
+  801c99:	89 c3                	mov    %eax,%ebx
+  801c9b:	83 c4 20             	add    $0x20,%esp
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	78 33                	js     801cd5 <dup+0xcd>
+  801ca2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801ca5:	89 d8                	mov    %ebx,%eax
+  801ca7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801caa:	5b                   	pop    %ebx
+  801cab:	5e                   	pop    %esi
+  801cac:	5f                   	pop    %edi
+  801cad:	5d                   	pop    %ebp
+  801cae:	c3                   	ret
+  801caf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+  801cb9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cbe:	50                   	push   %eax
+  801cbf:	ff 75 d4             	push   -0x2c(%ebp)
+  801cc2:	6a 00                	push   $0x0
+  801cc4:	53                   	push   %ebx
+  801cc5:	6a 00                	push   $0x0
+  801cc7:	e8 b5 f2 ff ff       	call   800f81 <sys_page_map>
+  801ccc:	89 c3                	mov    %eax,%ebx
+  801cce:	83 c4 20             	add    $0x20,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	79 a4                	jns    801c79 <dup+0x71>
+  801cd5:	83 ec 08             	sub    $0x8,%esp
+  801cd8:	56                   	push   %esi
+  801cd9:	6a 00                	push   $0x0
+  801cdb:	e8 30 f3 ff ff       	call   801010 <sys_page_unmap>
+  801ce0:	83 c4 08             	add    $0x8,%esp
+  801ce3:	ff 75 d4             	push   -0x2c(%ebp)
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	e8 23 f3 ff ff       	call   801010 <sys_page_unmap>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	eb b3                	jmp    801ca5 <dup+0x9d>
+
+00801cf2 <read>:
+  801cf2:	55                   	push   %ebp
+  801cf3:	89 e5                	mov    %esp,%ebp
+  801cf5:	56                   	push   %esi
+  801cf6:	53                   	push   %ebx
+  801cf7:	83 ec 18             	sub    $0x18,%esp
+  801cfa:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cfd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d00:	50                   	push   %eax
+  801d01:	56                   	push   %esi
+  801d02:	e8 89 fd ff ff       	call   801a90 <fd_lookup>
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 3c                	js     801d4a <read+0x58>
+  801d0e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801d11:	83 ec 08             	sub    $0x8,%esp
+  801d14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d17:	50                   	push   %eax
+  801d18:	ff 33                	push   (%ebx)
+  801d1a:	e8 c1 fd ff ff       	call   801ae0 <dev_lookup>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 24                	js     801d4a <read+0x58>
+  801d26:	8b 43 08             	mov    0x8(%ebx),%eax
+  801d29:	83 e0 03             	and    $0x3,%eax
+  801d2c:	83 f8 01             	cmp    $0x1,%eax
+  801d2f:	74 20                	je     801d51 <read+0x5f>
+  801d31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d34:	8b 40 08             	mov    0x8(%eax),%eax
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	74 37                	je     801d72 <read+0x80>
+  801d3b:	83 ec 04             	sub    $0x4,%esp
+  801d3e:	ff 75 10             	push   0x10(%ebp)
+  801d41:	ff 75 0c             	push   0xc(%ebp)
+  801d44:	53                   	push   %ebx
+  801d45:	ff d0                	call   *%eax
+  801d47:	83 c4 10             	add    $0x10,%esp
+  801d4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d4d:	5b                   	pop    %ebx
+  801d4e:	5e                   	pop    %esi
+  801d4f:	5d                   	pop    %ebp
+  801d50:	c3                   	ret
+  801d51:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  801d56:	8b 40 48             	mov    0x48(%eax),%eax
+  801d59:	83 ec 04             	sub    $0x4,%esp
+  801d5c:	56                   	push   %esi
+  801d5d:	50                   	push   %eax
+  801d5e:	68 e5 47 80 00       	push   $0x8047e5
+  801d63:	e8 7f e6 ff ff       	call   8003e7 <cprintf>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d70:	eb d8                	jmp    801d4a <read+0x58>
+  801d72:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d77:	eb d1                	jmp    801d4a <read+0x58>
+
+00801d79 <readn>:
+  801d79:	55                   	push   %ebp
+  801d7a:	89 e5                	mov    %esp,%ebp
+  801d7c:	57                   	push   %edi
+  801d7d:	56                   	push   %esi
+  801d7e:	53                   	push   %ebx
+  801d7f:	83 ec 0c             	sub    $0xc,%esp
+  801d82:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801d85:	8b 75 10             	mov    0x10(%ebp),%esi
+  801d88:	85 f6                	test   %esi,%esi
+  801d8a:	74 30                	je     801dbc <readn+0x43>
+  801d8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d96:	83 ec 04             	sub    $0x4,%esp
+  801d99:	89 f2                	mov    %esi,%edx
+  801d9b:	29 c2                	sub    %eax,%edx
+  801d9d:	52                   	push   %edx
+  801d9e:	01 f8                	add    %edi,%eax
+  801da0:	50                   	push   %eax
+  801da1:	ff 75 08             	push   0x8(%ebp)
+  801da4:	e8 49 ff ff ff       	call   801cf2 <read>
+  801da9:	83 c4 10             	add    $0x10,%esp
+  801dac:	85 c0                	test   %eax,%eax
+  801dae:	78 15                	js     801dc5 <readn+0x4c>
+  801db0:	74 11                	je     801dc3 <readn+0x4a>
+  801db2:	01 c3                	add    %eax,%ebx
+  801db4:	89 d8                	mov    %ebx,%eax
+  801db6:	39 f3                	cmp    %esi,%ebx
+  801db8:	72 dc                	jb     801d96 <readn+0x1d>
+  801dba:	eb 09                	jmp    801dc5 <readn+0x4c>
+  801dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc1:	eb 02                	jmp    801dc5 <readn+0x4c>
+  801dc3:	89 d8                	mov    %ebx,%eax
+  801dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc8:	5b                   	pop    %ebx
+  801dc9:	5e                   	pop    %esi
+  801dca:	5f                   	pop    %edi
+  801dcb:	5d                   	pop    %ebp
+  801dcc:	c3                   	ret
+
+00801dcd <write>:
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	56                   	push   %esi
+  801dd1:	53                   	push   %ebx
+  801dd2:	83 ec 18             	sub    $0x18,%esp
+  801dd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dd8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ddb:	50                   	push   %eax
+  801ddc:	53                   	push   %ebx
+  801ddd:	e8 ae fc ff ff       	call   801a90 <fd_lookup>
+  801de2:	83 c4 10             	add    $0x10,%esp
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 37                	js     801e20 <write+0x53>
+  801de9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dec:	83 ec 08             	sub    $0x8,%esp
+  801def:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df2:	50                   	push   %eax
+  801df3:	ff 36                	push   (%esi)
+  801df5:	e8 e6 fc ff ff       	call   801ae0 <dev_lookup>
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	78 1f                	js     801e20 <write+0x53>
+  801e01:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e05:	74 20                	je     801e27 <write+0x5a>
+  801e07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e0a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	74 37                	je     801e48 <write+0x7b>
+  801e11:	83 ec 04             	sub    $0x4,%esp
+  801e14:	ff 75 10             	push   0x10(%ebp)
+  801e17:	ff 75 0c             	push   0xc(%ebp)
+  801e1a:	56                   	push   %esi
+  801e1b:	ff d0                	call   *%eax
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e23:	5b                   	pop    %ebx
+  801e24:	5e                   	pop    %esi
+  801e25:	5d                   	pop    %ebp
+  801e26:	c3                   	ret
+  801e27:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  801e2c:	8b 40 48             	mov    0x48(%eax),%eax
+  801e2f:	83 ec 04             	sub    $0x4,%esp
+  801e32:	53                   	push   %ebx
+  801e33:	50                   	push   %eax
+  801e34:	68 01 48 80 00       	push   $0x804801
+  801e39:	e8 a9 e5 ff ff       	call   8003e7 <cprintf>
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e46:	eb d8                	jmp    801e20 <write+0x53>
+  801e48:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e4d:	eb d1                	jmp    801e20 <write+0x53>
+
+00801e4f <seek>:
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	83 ec 20             	sub    $0x20,%esp
+  801e55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e58:	50                   	push   %eax
+  801e59:	ff 75 08             	push   0x8(%ebp)
+  801e5c:	e8 2f fc ff ff       	call   801a90 <fd_lookup>
+  801e61:	83 c4 10             	add    $0x10,%esp
+  801e64:	85 c0                	test   %eax,%eax
+  801e66:	78 0e                	js     801e76 <seek+0x27>
+  801e68:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e6e:	89 50 04             	mov    %edx,0x4(%eax)
+  801e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e76:	c9                   	leave
+  801e77:	c3                   	ret
+
+00801e78 <ftruncate>:
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	56                   	push   %esi
+  801e7c:	53                   	push   %ebx
+  801e7d:	83 ec 18             	sub    $0x18,%esp
+  801e80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e86:	50                   	push   %eax
+  801e87:	53                   	push   %ebx
+  801e88:	e8 03 fc ff ff       	call   801a90 <fd_lookup>
+  801e8d:	83 c4 10             	add    $0x10,%esp
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 34                	js     801ec8 <ftruncate+0x50>
+  801e94:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e97:	83 ec 08             	sub    $0x8,%esp
+  801e9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e9d:	50                   	push   %eax
+  801e9e:	ff 36                	push   (%esi)
+  801ea0:	e8 3b fc ff ff       	call   801ae0 <dev_lookup>
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	85 c0                	test   %eax,%eax
+  801eaa:	78 1c                	js     801ec8 <ftruncate+0x50>
+  801eac:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801eb0:	74 1d                	je     801ecf <ftruncate+0x57>
+  801eb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb5:	8b 40 18             	mov    0x18(%eax),%eax
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	74 34                	je     801ef0 <ftruncate+0x78>
+  801ebc:	83 ec 08             	sub    $0x8,%esp
+  801ebf:	ff 75 0c             	push   0xc(%ebp)
+  801ec2:	56                   	push   %esi
+  801ec3:	ff d0                	call   *%eax
+  801ec5:	83 c4 10             	add    $0x10,%esp
+  801ec8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ecb:	5b                   	pop    %ebx
+  801ecc:	5e                   	pop    %esi
+  801ecd:	5d                   	pop    %ebp
+  801ece:	c3                   	ret
+  801ecf:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  801ed4:	8b 40 48             	mov    0x48(%eax),%eax
+  801ed7:	83 ec 04             	sub    $0x4,%esp
+  801eda:	53                   	push   %ebx
+  801edb:	50                   	push   %eax
+  801edc:	68 c4 47 80 00       	push   $0x8047c4
+  801ee1:	e8 01 e5 ff ff       	call   8003e7 <cprintf>
+  801ee6:	83 c4 10             	add    $0x10,%esp
+  801ee9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eee:	eb d8                	jmp    801ec8 <ftruncate+0x50>
+  801ef0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef5:	eb d1                	jmp    801ec8 <ftruncate+0x50>
+
+00801ef7 <fstat>:
+  801ef7:	55                   	push   %ebp
+  801ef8:	89 e5                	mov    %esp,%ebp
+  801efa:	56                   	push   %esi
+  801efb:	53                   	push   %ebx
+  801efc:	83 ec 18             	sub    $0x18,%esp
+  801eff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f02:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f05:	50                   	push   %eax
+  801f06:	ff 75 08             	push   0x8(%ebp)
+  801f09:	e8 82 fb ff ff       	call   801a90 <fd_lookup>
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	78 49                	js     801f5e <fstat+0x67>
+  801f15:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f18:	83 ec 08             	sub    $0x8,%esp
+  801f1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1e:	50                   	push   %eax
+  801f1f:	ff 36                	push   (%esi)
+  801f21:	e8 ba fb ff ff       	call   801ae0 <dev_lookup>
+  801f26:	83 c4 10             	add    $0x10,%esp
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 31                	js     801f5e <fstat+0x67>
+  801f2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f30:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f34:	74 2f                	je     801f65 <fstat+0x6e>
+  801f36:	c6 03 00             	movb   $0x0,(%ebx)
+  801f39:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f40:	00 00 00 
+  801f43:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f4a:	00 00 00 
+  801f4d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801f53:	83 ec 08             	sub    $0x8,%esp
+  801f56:	53                   	push   %ebx
+  801f57:	56                   	push   %esi
+  801f58:	ff 50 14             	call   *0x14(%eax)
+  801f5b:	83 c4 10             	add    $0x10,%esp
+  801f5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f61:	5b                   	pop    %ebx
+  801f62:	5e                   	pop    %esi
+  801f63:	5d                   	pop    %ebp
+  801f64:	c3                   	ret
+  801f65:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f6a:	eb f2                	jmp    801f5e <fstat+0x67>
+
+00801f6c <stat>:
+  801f6c:	55                   	push   %ebp
+  801f6d:	89 e5                	mov    %esp,%ebp
+  801f6f:	56                   	push   %esi
+  801f70:	53                   	push   %ebx
+  801f71:	83 ec 08             	sub    $0x8,%esp
+  801f74:	6a 00                	push   $0x0
+  801f76:	ff 75 08             	push   0x8(%ebp)
+  801f79:	e8 31 05 00 00       	call   8024af <open>
+  801f7e:	89 c3                	mov    %eax,%ebx
+  801f80:	83 c4 10             	add    $0x10,%esp
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	78 1b                	js     801fa2 <stat+0x36>
+  801f87:	83 ec 08             	sub    $0x8,%esp
+  801f8a:	ff 75 0c             	push   0xc(%ebp)
+  801f8d:	50                   	push   %eax
+  801f8e:	e8 64 ff ff ff       	call   801ef7 <fstat>
+  801f93:	89 c6                	mov    %eax,%esi
+  801f95:	89 1c 24             	mov    %ebx,(%esp)
+  801f98:	e8 19 fc ff ff       	call   801bb6 <close>
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	89 f3                	mov    %esi,%ebx
+  801fa2:	89 d8                	mov    %ebx,%eax
+  801fa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa7:	5b                   	pop    %ebx
+  801fa8:	5e                   	pop    %esi
+  801fa9:	5d                   	pop    %ebp
+  801faa:	c3                   	ret
+
+00801fab <fsipc>:
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	89 c3                	mov    %eax,%ebx
+  801fb2:	89 d6                	mov    %edx,%esi
+  801fb4:	83 3d 08 80 80 00 00 	cmpl   $0x0,0x808008
+  801fbb:	74 20                	je     801fdd <fsipc+0x32>
+  801fbd:	83 ec 08             	sub    $0x8,%esp
+  801fc0:	6a 00                	push   $0x0
+  801fc2:	56                   	push   %esi
+  801fc3:	6a 07                	push   $0x7
+  801fc5:	68 00 d0 80 00       	push   $0x80d000
+  801fca:	53                   	push   %ebx
+  801fcb:	ff 35 08 80 80 00    	push   0x808008
+  801fd1:	e8 8e f8 ff ff       	call   801864 <ipc_call>
+  801fd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd9:	5b                   	pop    %ebx
+  801fda:	5e                   	pop    %esi
+  801fdb:	5d                   	pop    %ebp
+  801fdc:	c3                   	ret
+  801fdd:	83 ec 0c             	sub    $0xc,%esp
+  801fe0:	6a 02                	push   $0x2
+  801fe2:	e8 18 fa ff ff       	call   8019ff <ipc_find_env>
+  801fe7:	a3 08 80 80 00       	mov    %eax,0x808008
+  801fec:	83 c4 10             	add    $0x10,%esp
+  801fef:	eb cc                	jmp    801fbd <fsipc+0x12>
+
+00801ff1 <devfile_trunc>:
+  801ff1:	55                   	push   %ebp
+  801ff2:	89 e5                	mov    %esp,%ebp
+  801ff4:	83 ec 08             	sub    $0x8,%esp
+  801ff7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ffd:	a3 00 d0 80 00       	mov    %eax,0x80d000
+  802002:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802005:	a3 04 d0 80 00       	mov    %eax,0x80d004
+  80200a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80200f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802014:	e8 92 ff ff ff       	call   801fab <fsipc>
+  802019:	c9                   	leave
+  80201a:	c3                   	ret
+
+0080201b <devfile_flush>:
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	83 ec 08             	sub    $0x8,%esp
+  802021:	8b 45 08             	mov    0x8(%ebp),%eax
+  802024:	8b 40 0c             	mov    0xc(%eax),%eax
+  802027:	a3 00 d0 80 00       	mov    %eax,0x80d000
+  80202c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802031:	b8 08 00 00 00       	mov    $0x8,%eax
+  802036:	e8 70 ff ff ff       	call   801fab <fsipc>
+  80203b:	c9                   	leave
+  80203c:	c3                   	ret
+
+0080203d <devfile_stat>:
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	53                   	push   %ebx
+  802041:	83 ec 04             	sub    $0x4,%esp
+  802044:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802047:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80204d:	a3 00 d0 80 00       	mov    %eax,0x80d000
+  802052:	ba 00 00 00 00       	mov    $0x0,%edx
+  802057:	b8 07 00 00 00       	mov    $0x7,%eax
+  80205c:	e8 4a ff ff ff       	call   801fab <fsipc>
+  802061:	85 c0                	test   %eax,%eax
+  802063:	78 2c                	js     802091 <devfile_stat+0x54>
+  802065:	83 ec 08             	sub    $0x8,%esp
+  802068:	68 00 d0 80 00       	push   $0x80d000
+  80206d:	53                   	push   %ebx
+  80206e:	e8 6b ea ff ff       	call   800ade <strcpy>
+  802073:	a1 80 d0 80 00       	mov    0x80d080,%eax
+  802078:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80207e:	a1 84 d0 80 00       	mov    0x80d084,%eax
+  802083:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802094:	c9                   	leave
+  802095:	c3                   	ret
+
+00802096 <fsring_rw>:
+  802096:	55                   	push   %ebp
+  802097:	89 e5                	mov    %esp,%ebp
+  802099:	57                   	push   %edi
+  80209a:	56                   	push   %esi
+  80209b:	53                   	push   %ebx
+  80209c:	83 ec 2c             	sub    $0x2c,%esp
+  80209f:	89 c7                	mov    %eax,%edi
+  8020a1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8020a4:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8020a7:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8020ac:	a8 01                	test   $0x1,%al
+  8020ae:	74 0d                	je     8020bd <fsring_rw+0x27>
+  8020b0:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8020b5:	a8 01                	test   $0x1,%al
+  8020b7:	0f 85 d5 00 00 00    	jne    802192 <fsring_rw+0xfc>
+  8020bd:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  8020c2:	8b 40 48             	mov    0x48(%eax),%eax
+  8020c5:	3b 05 04 80 80 00    	cmp    0x808004,%eax
+  8020cb:	0f 84 fc 00 00 00    	je     8021cd <fsring_rw+0x137>
+  8020d1:	83 3d 08 80 80 00 00 	cmpl   $0x0,0x808008
+  8020d8:	0f 84 02 01 00 00    	je     8021e0 <fsring_rw+0x14a>
+  8020de:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020e3:	83 ec 04             	sub    $0x4,%esp
+  8020e6:	68 07 02 00 00       	push   $0x207
+  8020eb:	53                   	push   %ebx
+  8020ec:	6a 00                	push   $0x0
+  8020ee:	e8 4b ee ff ff       	call   800f3e <sys_page_alloc>
+  8020f3:	83 c4 10             	add    $0x10,%esp
+  8020f6:	85 c0                	test   %eax,%eax
+  8020f8:	0f 88 f9 00 00 00    	js     8021f7 <fsring_rw+0x161>
+  8020fe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802104:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80210a:	75 d7                	jne    8020e3 <fsring_rw+0x4d>
+  80210c:	6a 0e                	push   $0xe
+  80210e:	6a 0d                	push   $0xd
+  802110:	ff 35 08 80 80 00    	push   0x808008
+  802116:	68 00 00 f0 cf       	push   $0xcff00000
+  80211b:	e8 fb 15 00 00       	call   80371b <ipcring_init>
+  802120:	83 c4 08             	add    $0x8,%esp
+  802123:	6a 00                	push   $0x0
+  802125:	6a 00                	push   $0x0
+  802127:	68 07 02 00 00       	push   $0x207
+  80212c:	68 00 00 f0 cf       	push   $0xcff00000
+  802131:	6a 0b                	push   $0xb
+  802133:	ff 35 08 80 80 00    	push   0x808008
+  802139:	e8 26 f7 ff ff       	call   801864 <ipc_call>
+  80213e:	89 c6                	mov    %eax,%esi
+  802140:	83 c4 20             	add    $0x20,%esp
+  802143:	85 c0                	test   %eax,%eax
+  802145:	0f 88 ac 00 00 00    	js     8021f7 <fsring_rw+0x161>
+  80214b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802150:	89 d9                	mov    %ebx,%ecx
+  802152:	83 c3 01             	add    $0x1,%ebx
+  802155:	89 da                	mov    %ebx,%edx
+  802157:	c1 e2 0c             	shl    $0xc,%edx
+  80215a:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802160:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802166:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80216c:	83 ec 08             	sub    $0x8,%esp
+  80216f:	6a 00                	push   $0x0
+  802171:	6a 00                	push   $0x0
+  802173:	68 07 02 00 00       	push   $0x207
+  802178:	50                   	push   %eax
+  802179:	6a 0c                	push   $0xc
+  80217b:	ff 35 08 80 80 00    	push   0x808008
+  802181:	e8 de f6 ff ff       	call   801864 <ipc_call>
+  802186:	83 c4 20             	add    $0x20,%esp
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	78 6a                	js     8021f7 <fsring_rw+0x161>
+  80218d:	83 fb 08             	cmp    $0x8,%ebx
+  802190:	75 be                	jne    802150 <fsring_rw+0xba>
+  802192:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802196:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80219b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021a0:	0f 45 c2             	cmovne %edx,%eax
+  8021a3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8021a6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8021ad:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8021b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8021bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c5:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8021c8:	e9 4b 01 00 00       	jmp    802318 <fsring_rw+0x282>
+  8021cd:	e8 36 f1 ff ff       	call   801308 <sys_time_msec>
+  8021d2:	3b 05 00 80 80 00    	cmp    0x808000,%eax
+  8021d8:	0f 89 f3 fe ff ff    	jns    8020d1 <fsring_rw+0x3b>
+  8021de:	eb 54                	jmp    802234 <fsring_rw+0x19e>
+  8021e0:	83 ec 0c             	sub    $0xc,%esp
+  8021e3:	6a 02                	push   $0x2
+  8021e5:	e8 15 f8 ff ff       	call   8019ff <ipc_find_env>
+  8021ea:	a3 08 80 80 00       	mov    %eax,0x808008
+  8021ef:	83 c4 10             	add    $0x10,%esp
+  8021f2:	e9 e7 fe ff ff       	jmp    8020de <fsring_rw+0x48>
+  8021f7:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8021fc:	83 ec 08             	sub    $0x8,%esp
+  8021ff:	53                   	push   %ebx
+  802200:	6a 00                	push   $0x0
+  802202:	e8 09 ee ff ff       	call   801010 <sys_page_unmap>
+  802207:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802216:	75 e4                	jne    8021fc <fsring_rw+0x166>
+  802218:	e8 eb f0 ff ff       	call   801308 <sys_time_msec>
+  80221d:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802222:	a3 00 80 80 00       	mov    %eax,0x808000
+  802227:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  80222c:	8b 40 48             	mov    0x48(%eax),%eax
+  80222f:	a3 04 80 80 00       	mov    %eax,0x808004
+  802234:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80223b:	e9 7a 01 00 00       	jmp    8023ba <fsring_rw+0x324>
+  802240:	8b 57 0c             	mov    0xc(%edi),%edx
+  802243:	89 10                	mov    %edx,(%eax)
+  802245:	89 58 04             	mov    %ebx,0x4(%eax)
+  802248:	89 f2                	mov    %esi,%edx
+  80224a:	03 57 04             	add    0x4(%edi),%edx
+  80224d:	89 50 08             	mov    %edx,0x8(%eax)
+  802250:	83 ec 04             	sub    $0x4,%esp
+  802253:	53                   	push   %ebx
+  802254:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802257:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80225a:	52                   	push   %edx
+  80225b:	83 c0 0c             	add    $0xc,%eax
+  80225e:	50                   	push   %eax
+  80225f:	e8 2a ea ff ff       	call   800c8e <memmove>
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80226a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80226d:	89 08                	mov    %ecx,(%eax)
+  80226f:	83 ec 0c             	sub    $0xc,%esp
+  802272:	68 00 00 f0 cf       	push   $0xcff00000
+  802277:	e8 fd 14 00 00       	call   803779 <ipcring_req_push>
+  80227c:	01 de                	add    %ebx,%esi
+  80227e:	83 c4 10             	add    $0x10,%esp
+  802281:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802284:	73 4c                	jae    8022d2 <fsring_rw+0x23c>
+  802286:	83 ec 0c             	sub    $0xc,%esp
+  802289:	68 00 00 f0 cf       	push   $0xcff00000
+  80228e:	e8 c0 14 00 00       	call   803753 <ipcring_req_slot>
+  802293:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802296:	83 c4 10             	add    $0x10,%esp
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	74 35                	je     8022d2 <fsring_rw+0x23c>
+  80229d:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8022a2:	83 e0 07             	and    $0x7,%eax
+  8022a5:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8022aa:	c1 e0 0c             	shl    $0xc,%eax
+  8022ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022b0:	29 f3                	sub    %esi,%ebx
+  8022b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8022b5:	39 cb                	cmp    %ecx,%ebx
+  8022b7:	0f 47 d9             	cmova  %ecx,%ebx
+  8022ba:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8022be:	75 80                	jne    802240 <fsring_rw+0x1aa>
+  8022c0:	8b 57 0c             	mov    0xc(%edi),%edx
+  8022c3:	89 10                	mov    %edx,(%eax)
+  8022c5:	89 58 04             	mov    %ebx,0x4(%eax)
+  8022c8:	89 f2                	mov    %esi,%edx
+  8022ca:	03 57 04             	add    0x4(%edi),%edx
+  8022cd:	89 50 08             	mov    %edx,0x8(%eax)
+  8022d0:	eb 95                	jmp    802267 <fsring_rw+0x1d1>
+  8022d2:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8022d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022da:	83 ec 0c             	sub    $0xc,%esp
+  8022dd:	68 00 00 f0 cf       	push   $0xcff00000
+  8022e2:	e8 cb 14 00 00       	call   8037b2 <ipcring_rsp_wait>
+  8022e7:	8b 58 04             	mov    0x4(%eax),%ebx
+  8022ea:	83 c4 10             	add    $0x10,%esp
+  8022ed:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8022f1:	75 45                	jne    802338 <fsring_rw+0x2a2>
+  8022f3:	85 db                	test   %ebx,%ebx
+  8022f5:	79 41                	jns    802338 <fsring_rw+0x2a2>
+  8022f7:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8022fa:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802301:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802308:	83 ec 0c             	sub    $0xc,%esp
+  80230b:	68 00 00 f0 cf       	push   $0xcff00000
+  802310:	e8 03 15 00 00       	call   803818 <ipcring_rsp_pop>
+  802315:	83 c4 10             	add    $0x10,%esp
+  802318:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80231e:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802323:	39 c2                	cmp    %eax,%edx
+  802325:	74 75                	je     80239c <fsring_rw+0x306>
+  802327:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80232b:	75 a5                	jne    8022d2 <fsring_rw+0x23c>
+  80232d:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802330:	0f 82 50 ff ff ff    	jb     802286 <fsring_rw+0x1f0>
+  802336:	eb 9a                	jmp    8022d2 <fsring_rw+0x23c>
+  802338:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80233c:	75 ca                	jne    802308 <fsring_rw+0x272>
+  80233e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802342:	74 31                	je     802375 <fsring_rw+0x2df>
+  802344:	8b 45 08             	mov    0x8(%ebp),%eax
+  802347:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80234a:	29 c8                	sub    %ecx,%eax
+  80234c:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80234f:	39 d0                	cmp    %edx,%eax
+  802351:	0f 47 c2             	cmova  %edx,%eax
+  802354:	39 d8                	cmp    %ebx,%eax
+  802356:	ba 01 00 00 00       	mov    $0x1,%edx
+  80235b:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80235f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802362:	b8 01 00 00 00       	mov    $0x1,%eax
+  802367:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80236b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80236e:	01 d9                	add    %ebx,%ecx
+  802370:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802373:	eb 93                	jmp    802308 <fsring_rw+0x272>
+  802375:	83 ec 04             	sub    $0x4,%esp
+  802378:	53                   	push   %ebx
+  802379:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80237c:	83 e0 07             	and    $0x7,%eax
+  80237f:	c1 e0 0c             	shl    $0xc,%eax
+  802382:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802388:	50                   	push   %eax
+  802389:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80238c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80238f:	01 c8                	add    %ecx,%eax
+  802391:	50                   	push   %eax
+  802392:	e8 f7 e8 ff ff       	call   800c8e <memmove>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	eb a8                	jmp    802344 <fsring_rw+0x2ae>
+  80239c:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8023a0:	75 09                	jne    8023ab <fsring_rw+0x315>
+  8023a2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8023a5:	0f 82 db fe ff ff    	jb     802286 <fsring_rw+0x1f0>
+  8023ab:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8023ae:	01 57 04             	add    %edx,0x4(%edi)
+  8023b1:	85 d2                	test   %edx,%edx
+  8023b3:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8023b7:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8023ba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8023bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c0:	5b                   	pop    %ebx
+  8023c1:	5e                   	pop    %esi
+  8023c2:	5f                   	pop    %edi
+  8023c3:	5d                   	pop    %ebp
+  8023c4:	c3                   	ret
+
+008023c5 <devfile_write>:
+  8023c5:	55                   	push   %ebp
+  8023c6:	89 e5                	mov    %esp,%ebp
+  8023c8:	57                   	push   %edi
+  8023c9:	56                   	push   %esi
+  8023ca:	53                   	push   %ebx
+  8023cb:	83 ec 0c             	sub    $0xc,%esp
+  8023ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023d7:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8023dd:	76 1a                	jbe    8023f9 <devfile_write+0x34>
+  8023df:	83 ec 0c             	sub    $0xc,%esp
+  8023e2:	53                   	push   %ebx
+  8023e3:	89 f1                	mov    %esi,%ecx
+  8023e5:	ba 06 00 00 00       	mov    $0x6,%edx
+  8023ea:	89 f8                	mov    %edi,%eax
+  8023ec:	e8 a5 fc ff ff       	call   802096 <fsring_rw>
+  8023f1:	83 c4 10             	add    $0x10,%esp
+  8023f4:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8023f7:	75 39                	jne    802432 <devfile_write+0x6d>
+  8023f9:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8023fe:	39 c3                	cmp    %eax,%ebx
+  802400:	0f 47 d8             	cmova  %eax,%ebx
+  802403:	8b 47 0c             	mov    0xc(%edi),%eax
+  802406:	a3 00 d0 80 00       	mov    %eax,0x80d000
+  80240b:	89 1d 04 d0 80 00    	mov    %ebx,0x80d004
+  802411:	83 ec 04             	sub    $0x4,%esp
+  802414:	53                   	push   %ebx
+  802415:	56                   	push   %esi
+  802416:	68 08 d0 80 00       	push   $0x80d008
+  80241b:	e8 6e e8 ff ff       	call   800c8e <memmove>
+  802420:	ba 00 00 00 00       	mov    $0x0,%edx
+  802425:	b8 04 00 00 00       	mov    $0x4,%eax
+  80242a:	e8 7c fb ff ff       	call   801fab <fsipc>
+  80242f:	83 c4 10             	add    $0x10,%esp
+  802432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802435:	5b                   	pop    %ebx
+  802436:	5e                   	pop    %esi
+  802437:	5f                   	pop    %edi
+  802438:	5d                   	pop    %ebp
+  802439:	c3                   	ret
+
+0080243a <devfile_read>:
+  80243a:	55                   	push   %ebp
+  80243b:	89 e5                	mov    %esp,%ebp
+  80243d:	57                   	push   %edi
+  80243e:	56                   	push   %esi
+  80243f:	53                   	push   %ebx
+  802440:	83 ec 0c             	sub    $0xc,%esp
+  802443:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802446:	8b 75 10             	mov    0x10(%ebp),%esi
+  802449:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80244f:	76 1d                	jbe    80246e <devfile_read+0x34>
+  802451:	83 ec 0c             	sub    $0xc,%esp
+  802454:	56                   	push   %esi
+  802455:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802458:	ba 05 00 00 00       	mov    $0x5,%edx
+  80245d:	89 f8                	mov    %edi,%eax
+  80245f:	e8 32 fc ff ff       	call   802096 <fsring_rw>
+  802464:	89 c3                	mov    %eax,%ebx
+  802466:	83 c4 10             	add    $0x10,%esp
+  802469:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80246c:	75 37                	jne    8024a5 <devfile_read+0x6b>
+  80246e:	8b 47 0c             	mov    0xc(%edi),%eax
+  802471:	a3 00 d0 80 00       	mov    %eax,0x80d000
+  802476:	89 35 04 d0 80 00    	mov    %esi,0x80d004
+  80247c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802481:	b8 03 00 00 00       	mov    $0x3,%eax
+  802486:	e8 20 fb ff ff       	call   801fab <fsipc>
+  80248b:	89 c3                	mov    %eax,%ebx
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	78 14                	js     8024a5 <devfile_read+0x6b>
+  802491:	83 ec 04             	sub    $0x4,%esp
+  802494:	50                   	push   %eax
+  802495:	68 00 d0 80 00       	push   $0x80d000
+  80249a:	ff 75 0c             	push   0xc(%ebp)
+  80249d:	e8 ec e7 ff ff       	call   800c8e <memmove>
+  8024a2:	83 c4 10             	add    $0x10,%esp
+  8024a5:	89 d8                	mov    %ebx,%eax
+  8024a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024aa:	5b                   	pop    %ebx
+  8024ab:	5e                   	pop    %esi
+  8024ac:	5f                   	pop    %edi
+  8024ad:	5d                   	pop    %ebp
+  8024ae:	c3                   	ret
+
+008024af <open>:
+  8024af:	55                   	push   %ebp
+  8024b0:	89 e5                	mov    %esp,%ebp
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 1c             	sub    $0x1c,%esp
+  8024b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024ba:	56                   	push   %esi
+  8024bb:	e8 d2 e5 ff ff       	call   800a92 <strlen>
+  8024c0:	83 c4 10             	add    $0x10,%esp
+  8024c3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024c8:	7f 6c                	jg     802536 <open+0x87>
+  8024ca:	83 ec 0c             	sub    $0xc,%esp
+  8024cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d0:	50                   	push   %eax
+  8024d1:	e8 6a f5 ff ff       	call   801a40 <fd_alloc>
+  8024d6:	89 c3                	mov    %eax,%ebx
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	78 3c                	js     80251b <open+0x6c>
+  8024df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024e2:	a3 00 d4 80 00       	mov    %eax,0x80d400
+  8024e7:	83 ec 08             	sub    $0x8,%esp
+  8024ea:	56                   	push   %esi
+  8024eb:	68 00 d0 80 00       	push   $0x80d000
+  8024f0:	e8 e9 e5 ff ff       	call   800ade <strcpy>
+  8024f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024fd:	e8 a9 fa ff ff       	call   801fab <fsipc>
+  802502:	89 c3                	mov    %eax,%ebx
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	85 c0                	test   %eax,%eax
+  802509:	78 19                	js     802524 <open+0x75>
+  80250b:	83 ec 0c             	sub    $0xc,%esp
+  80250e:	ff 75 f4             	push   -0xc(%ebp)
+  802511:	e8 03 f5 ff ff       	call   801a19 <fd2num>
+  802516:	89 c3                	mov    %eax,%ebx
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	89 d8                	mov    %ebx,%eax
+  80251d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802520:	5b                   	pop    %ebx
+  802521:	5e                   	pop    %esi
+  802522:	5d                   	pop    %ebp
+  802523:	c3                   	ret
+  802524:	83 ec 08             	sub    $0x8,%esp
+  802527:	6a 00                	push   $0x0
+  802529:	ff 75 f4             	push   -0xc(%ebp)
+  80252c:	e8 05 f6 ff ff       	call   801b36 <fd_close>
+  802531:	83 c4 10             	add    $0x10,%esp
+  802534:	eb e5                	jmp    80251b <open+0x6c>
+  802536:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80253b:	eb de                	jmp    80251b <open+0x6c>
+
+0080253d <file_image>:
+  80253d:	55                   	push   %ebp
+  80253e:	89 e5                	mov    %esp,%ebp
+  802540:	53                   	push   %ebx
+  802541:	83 ec 1c             	sub    $0x1c,%esp
+  802544:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802547:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80254a:	50                   	push   %eax
+  80254b:	ff 75 08             	push   0x8(%ebp)
+  80254e:	e8 3d f5 ff ff       	call   801a90 <fd_lookup>
+  802553:	83 c4 10             	add    $0x10,%esp
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 58                	js     8025b2 <file_image+0x75>
+  80255a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80255d:	8b 0d 04 70 80 00    	mov    0x807004,%ecx
+  802563:	39 08                	cmp    %ecx,(%eax)
+  802565:	75 50                	jne    8025b7 <file_image+0x7a>
+  802567:	83 fb 04             	cmp    $0x4,%ebx
+  80256a:	77 52                	ja     8025be <file_image+0x81>
+  80256c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80256f:	a3 00 d0 80 00       	mov    %eax,0x80d000
+  802574:	89 1d 04 d0 80 00    	mov    %ebx,0x80d004
+  80257a:	83 ec 04             	sub    $0x4,%esp
+  80257d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802580:	c1 e0 02             	shl    $0x2,%eax
+  802583:	50                   	push   %eax
+  802584:	ff 75 0c             	push   0xc(%ebp)
+  802587:	68 08 d0 80 00       	push   $0x80d008
+  80258c:	e8 fd e6 ff ff       	call   800c8e <memmove>
+  802591:	ba 00 00 00 00       	mov    $0x0,%edx
+  802596:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80259b:	e8 0b fa ff ff       	call   801fab <fsipc>
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	78 0b                	js     8025b2 <file_image+0x75>
+  8025a7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8025aa:	8b 0d 08 80 80 00    	mov    0x808008,%ecx
+  8025b0:	89 0a                	mov    %ecx,(%edx)
+  8025b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b5:	c9                   	leave
+  8025b6:	c3                   	ret
+  8025b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025bc:	eb f4                	jmp    8025b2 <file_image+0x75>
+  8025be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025c3:	eb ed                	jmp    8025b2 <file_image+0x75>
+
+008025c5 <remove>:
+  8025c5:	55                   	push   %ebp
+  8025c6:	89 e5                	mov    %esp,%ebp
+  8025c8:	53                   	push   %ebx
+  8025c9:	83 ec 10             	sub    $0x10,%esp
+  8025cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025cf:	53                   	push   %ebx
+  8025d0:	e8 bd e4 ff ff       	call   800a92 <strlen>
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025dd:	7f 25                	jg     802604 <remove+0x3f>
+  8025df:	83 ec 08             	sub    $0x8,%esp
+  8025e2:	53                   	push   %ebx
+  8025e3:	68 00 d0 80 00       	push   $0x80d000
+  8025e8:	e8 f1 e4 ff ff       	call   800ade <strcpy>
+  8025ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025f7:	e8 af f9 ff ff       	call   801fab <fsipc>
+  8025fc:	83 c4 10             	add    $0x10,%esp
+  8025ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802602:	c9                   	leave
+  802603:	c3                   	ret
+  802604:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802609:	eb f4                	jmp    8025ff <remove+0x3a>
+
+0080260b <sync>:
+  80260b:	55                   	push   %ebp
+  80260c:	89 e5                	mov    %esp,%ebp
+  80260e:	83 ec 08             	sub    $0x8,%esp
+  802611:	ba 00 00 00 00       	mov    $0x0,%edx
+  802616:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80261b:	e8 8b f9 ff ff       	call   801fab <fsipc>
+  802620:	c9                   	leave
+  802621:	c3                   	ret
+
+00802622 <map_segment>:
+  802622:	55                   	push   %ebp
+  802623:	89 e5                	mov    %esp,%ebp
+  802625:	57                   	push   %edi
+  802626:	56                   	push   %esi
+  802627:	53                   	push   %ebx
+  802628:	83 ec 1c             	sub    $0x1c,%esp
+  80262b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80262e:	89 d7                	mov    %edx,%edi
+  802630:	89 d0                	mov    %edx,%eax
+  802632:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802637:	74 0a                	je     802643 <map_segment+0x21>
+  802639:	29 c7                	sub    %eax,%edi
+  80263b:	01 c1                	add    %eax,%ecx
+  80263d:	01 45 0c             	add    %eax,0xc(%ebp)
+  802640:	29 45 10             	sub    %eax,0x10(%ebp)
+  802643:	85 c9                	test   %ecx,%ecx
+  802645:	0f 84 fb 00 00 00    	je     802746 <map_segment+0x124>
+  80264b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802650:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802653:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802656:	e9 a6 00 00 00       	jmp    802701 <map_segment+0xdf>
+  80265b:	83 ec 04             	sub    $0x4,%esp
+  80265e:	6a 07                	push   $0x7
+  802660:	68 00 00 40 00       	push   $0x400000
+  802665:	6a 00                	push   $0x0
+  802667:	e8 d2 e8 ff ff       	call   800f3e <sys_page_alloc>
+  80266c:	83 c4 10             	add    $0x10,%esp
+  80266f:	85 c0                	test   %eax,%eax
+  802671:	0f 88 c7 00 00 00    	js     80273e <map_segment+0x11c>
+  802677:	83 ec 08             	sub    $0x8,%esp
+  80267a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80267d:	03 45 10             	add    0x10(%ebp),%eax
+  802680:	50                   	push   %eax
+  802681:	ff 75 08             	push   0x8(%ebp)
+  802684:	e8 c6 f7 ff ff       	call   801e4f <seek>
+  802689:	83 c4 10             	add    $0x10,%esp
+  80268c:	85 c0                	test   %eax,%eax
+  80268e:	0f 88 aa 00 00 00    	js     80273e <map_segment+0x11c>
+  802694:	83 ec 04             	sub    $0x4,%esp
+  802697:	89 f2                	mov    %esi,%edx
+  802699:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80269c:	29 ca                	sub    %ecx,%edx
+  80269e:	89 d0                	mov    %edx,%eax
+  8026a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026a5:	39 d0                	cmp    %edx,%eax
+  8026a7:	0f 47 c2             	cmova  %edx,%eax
+  8026aa:	50                   	push   %eax
+  8026ab:	68 00 00 40 00       	push   $0x400000
+  8026b0:	ff 75 08             	push   0x8(%ebp)
+  8026b3:	e8 c1 f6 ff ff       	call   801d79 <readn>
+  8026b8:	83 c4 10             	add    $0x10,%esp
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	78 7f                	js     80273e <map_segment+0x11c>
+  8026bf:	83 ec 0c             	sub    $0xc,%esp
+  8026c2:	ff 75 14             	push   0x14(%ebp)
+  8026c5:	57                   	push   %edi
+  8026c6:	ff 75 e0             	push   -0x20(%ebp)
+  8026c9:	68 00 00 40 00       	push   $0x400000
+  8026ce:	6a 00                	push   $0x0
+  8026d0:	e8 ac e8 ff ff       	call   800f81 <sys_page_map>
+  8026d5:	83 c4 20             	add    $0x20,%esp
+  8026d8:	85 c0                	test   %eax,%eax
+  8026da:	78 48                	js     802724 <map_segment+0x102>
+  8026dc:	83 ec 08             	sub    $0x8,%esp
+  8026df:	68 00 00 40 00       	push   $0x400000
+  8026e4:	6a 00                	push   $0x0
+  8026e6:	e8 25 e9 ff ff       	call   801010 <sys_page_unmap>
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026f4:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8026fa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026fd:	39 c3                	cmp    %eax,%ebx
+  8026ff:	73 38                	jae    802739 <map_segment+0x117>
+  802701:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802704:	39 f3                	cmp    %esi,%ebx
+  802706:	0f 82 4f ff ff ff    	jb     80265b <map_segment+0x39>
+  80270c:	83 ec 04             	sub    $0x4,%esp
+  80270f:	ff 75 14             	push   0x14(%ebp)
+  802712:	57                   	push   %edi
+  802713:	ff 75 e0             	push   -0x20(%ebp)
+  802716:	e8 23 e8 ff ff       	call   800f3e <sys_page_alloc>
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	79 cc                	jns    8026ee <map_segment+0xcc>
+  802722:	eb 1a                	jmp    80273e <map_segment+0x11c>
+  802724:	50                   	push   %eax
+  802725:	68 34 48 80 00       	push   $0x804834
+  80272a:	68 75 01 00 00       	push   $0x175
+  80272f:	68 51 48 80 00       	push   $0x804851
+  802734:	e8 d3 db ff ff       	call   80030c <_panic>
+  802739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802741:	5b                   	pop    %ebx
+  802742:	5e                   	pop    %esi
+  802743:	5f                   	pop    %edi
+  802744:	5d                   	pop    %ebp
+  802745:	c3                   	ret
+  802746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274b:	eb f1                	jmp    80273e <map_segment+0x11c>
+
+0080274d <execv>:
+  80274d:	55                   	push   %ebp
+  80274e:	89 e5                	mov    %esp,%ebp
+  802750:	57                   	push   %edi
+  802751:	56                   	push   %esi
+  802752:	53                   	push   %ebx
+  802753:	81 ec d4 02 00 00    	sub    $0x2d4,%esp
+  802759:	6a 00                	push   $0x0
+  80275b:	ff 75 08             	push   0x8(%ebp)
+  80275e:	e8 4c fd ff ff       	call   8024af <open>
+  802763:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802769:	83 c4 10             	add    $0x10,%esp
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	0f 88 ea 05 00 00    	js     802d5e <execv+0x611>
+  802774:	89 c6                	mov    %eax,%esi
+  802776:	83 ec 04             	sub    $0x4,%esp
+  802779:	68 00 02 00 00       	push   $0x200
+  80277e:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802784:	50                   	push   %eax
+  802785:	56                   	push   %esi
+  802786:	e8 ee f5 ff ff       	call   801d79 <readn>
+  80278b:	83 c4 10             	add    $0x10,%esp
+  80278e:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802793:	0f 85 e1 01 00 00    	jne    80297a <execv+0x22d>
+  802799:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8027a0:	45 4c 46 
+  8027a3:	0f 85 d1 01 00 00    	jne    80297a <execv+0x22d>
+  8027a9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027ae:	cd 30                	int    $0x30
+  8027b0:	89 85 40 fd ff ff    	mov    %eax,-0x2c0(%ebp)
+  8027b6:	85 c0                	test   %eax,%eax
+  8027b8:	0f 88 94 05 00 00    	js     802d52 <execv+0x605>
+  8027be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027c3:	69 f0 ac 01 00 00    	imul   $0x1ac,%eax,%esi
+  8027c9:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8027cf:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8027d5:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8027da:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8027dc:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8027e2:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8027e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027eb:	8b 00                	mov    (%eax),%eax
+  8027ed:	85 c0                	test   %eax,%eax
+  8027ef:	0f 84 ad 05 00 00    	je     802da2 <execv+0x655>
+  8027f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802802:	83 ec 0c             	sub    $0xc,%esp
+  802805:	50                   	push   %eax
+  802806:	e8 87 e2 ff ff       	call   800a92 <strlen>
+  80280b:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  80280f:	89 d9                	mov    %ebx,%ecx
+  802811:	83 c3 01             	add    $0x1,%ebx
+  802814:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%ebp)
+  80281a:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  802821:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  802824:	83 c4 10             	add    $0x10,%esp
+  802827:	85 c0                	test   %eax,%eax
+  802829:	75 d7                	jne    802802 <execv+0xb5>
+  80282b:	89 95 2c fd ff ff    	mov    %edx,-0x2d4(%ebp)
+  802831:	89 8d 30 fd ff ff    	mov    %ecx,-0x2d0(%ebp)
+  802837:	be 00 10 40 00       	mov    $0x401000,%esi
+  80283c:	29 fe                	sub    %edi,%esi
+  80283e:	89 f2                	mov    %esi,%edx
+  802840:	83 e2 fc             	and    $0xfffffffc,%edx
+  802843:	8d 04 8d 08 00 00 00 	lea    0x8(,%ecx,4),%eax
+  80284a:	89 d7                	mov    %edx,%edi
+  80284c:	29 c7                	sub    %eax,%edi
+  80284e:	8d 47 f8             	lea    -0x8(%edi),%eax
+  802851:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802856:	0f 86 1f 05 00 00    	jbe    802d7b <execv+0x62e>
+  80285c:	83 ec 04             	sub    $0x4,%esp
+  80285f:	6a 07                	push   $0x7
+  802861:	68 00 00 40 00       	push   $0x400000
+  802866:	6a 00                	push   $0x0
+  802868:	e8 d1 e6 ff ff       	call   800f3e <sys_page_alloc>
+  80286d:	83 c4 10             	add    $0x10,%esp
+  802870:	85 c0                	test   %eax,%eax
+  802872:	0f 88 08 05 00 00    	js     802d80 <execv+0x633>
+  802878:	85 db                	test   %ebx,%ebx
+  80287a:	7e 58                	jle    8028d4 <execv+0x187>
+  80287c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802881:	89 bd 34 fd ff ff    	mov    %edi,-0x2cc(%ebp)
+  802887:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80288a:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+  802890:	8d 86 00 d0 3f ee    	lea    -0x11c03000(%esi),%eax
+  802896:	8b 8d 34 fd ff ff    	mov    -0x2cc(%ebp),%ecx
+  80289c:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+  80289f:	83 ec 08             	sub    $0x8,%esp
+  8028a2:	ff 34 9f             	push   (%edi,%ebx,4)
+  8028a5:	56                   	push   %esi
+  8028a6:	e8 33 e2 ff ff       	call   800ade <strcpy>
+  8028ab:	83 c4 04             	add    $0x4,%esp
+  8028ae:	ff 34 9f             	push   (%edi,%ebx,4)
+  8028b1:	e8 dc e1 ff ff       	call   800a92 <strlen>
+  8028b6:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  8028ba:	83 c3 01             	add    $0x1,%ebx
+  8028bd:	83 c4 10             	add    $0x10,%esp
+  8028c0:	8b 8d 3c fd ff ff    	mov    -0x2c4(%ebp),%ecx
+  8028c6:	39 8d 30 fd ff ff    	cmp    %ecx,-0x2d0(%ebp)
+  8028cc:	75 bc                	jne    80288a <execv+0x13d>
+  8028ce:	8b bd 34 fd ff ff    	mov    -0x2cc(%ebp),%edi
+  8028d4:	8b 85 2c fd ff ff    	mov    -0x2d4(%ebp),%eax
+  8028da:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+  8028e1:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  8028e7:	0f 85 c5 00 00 00    	jne    8029b2 <execv+0x265>
+  8028ed:	8d 87 00 d0 3f ee    	lea    -0x11c03000(%edi),%eax
+  8028f3:	89 47 fc             	mov    %eax,-0x4(%edi)
+  8028f6:	8b 85 38 fd ff ff    	mov    -0x2c8(%ebp),%eax
+  8028fc:	89 47 f8             	mov    %eax,-0x8(%edi)
+  8028ff:	8d 87 f8 cf 3f ee    	lea    -0x11c03008(%edi),%eax
+  802905:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  80290b:	83 ec 0c             	sub    $0xc,%esp
+  80290e:	6a 07                	push   $0x7
+  802910:	68 00 d0 7f ee       	push   $0xee7fd000
+  802915:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80291b:	68 00 00 40 00       	push   $0x400000
+  802920:	6a 00                	push   $0x0
+  802922:	e8 5a e6 ff ff       	call   800f81 <sys_page_map>
+  802927:	89 c3                	mov    %eax,%ebx
+  802929:	83 c4 20             	add    $0x20,%esp
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	0f 88 54 04 00 00    	js     802d88 <execv+0x63b>
+  802934:	83 ec 08             	sub    $0x8,%esp
+  802937:	68 00 00 40 00       	push   $0x400000
+  80293c:	6a 00                	push   $0x0
+  80293e:	e8 cd e6 ff ff       	call   801010 <sys_page_unmap>
+  802943:	89 c3                	mov    %eax,%ebx
+  802945:	83 c4 10             	add    $0x10,%esp
+  802948:	85 c0                	test   %eax,%eax
+  80294a:	0f 88 38 04 00 00    	js     802d88 <execv+0x63b>
+  802950:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802956:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+  80295d:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  802964:	00 
+  802965:	0f 84 01 04 00 00    	je     802d6c <execv+0x61f>
+  80296b:	be 00 00 00 00       	mov    $0x0,%esi
+  802970:	bf 00 00 00 00       	mov    $0x0,%edi
+  802975:	e9 88 00 00 00       	jmp    802a02 <execv+0x2b5>
+  80297a:	83 ec 0c             	sub    $0xc,%esp
+  80297d:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802983:	e8 2e f2 ff ff       	call   801bb6 <close>
+  802988:	83 c4 0c             	add    $0xc,%esp
+  80298b:	68 7f 45 4c 46       	push   $0x464c457f
+  802990:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802996:	68 5d 48 80 00       	push   $0x80485d
+  80299b:	e8 47 da ff ff       	call   8003e7 <cprintf>
+  8029a0:	83 c4 10             	add    $0x10,%esp
+  8029a3:	c7 85 44 fd ff ff f2 	movl   $0xfffffff2,-0x2bc(%ebp)
+  8029aa:	ff ff ff 
+  8029ad:	e9 ac 03 00 00       	jmp    802d5e <execv+0x611>
+  8029b2:	68 e4 48 80 00       	push   $0x8048e4
+  8029b7:	68 77 48 80 00       	push   $0x804877
+  8029bc:	68 41 01 00 00       	push   $0x141
+  8029c1:	68 51 48 80 00       	push   $0x804851
+  8029c6:	e8 41 d9 ff ff       	call   80030c <_panic>
+  8029cb:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  8029ce:	50                   	push   %eax
+  8029cf:	ff 73 04             	push   0x4(%ebx)
+  8029d2:	ff 73 10             	push   0x10(%ebx)
+  8029d5:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  8029db:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  8029e1:	e8 3c fc ff ff       	call   802622 <map_segment>
+  8029e6:	83 c4 10             	add    $0x10,%esp
+  8029e9:	85 c0                	test   %eax,%eax
+  8029eb:	0f 88 34 03 00 00    	js     802d25 <execv+0x5d8>
+  8029f1:	83 c7 01             	add    $0x1,%edi
+  8029f4:	83 c3 20             	add    $0x20,%ebx
+  8029f7:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8029fe:	39 f8                	cmp    %edi,%eax
+  802a00:	7e 5d                	jle    802a5f <execv+0x312>
+  802a02:	83 3b 01             	cmpl   $0x1,(%ebx)
+  802a05:	75 ea                	jne    8029f1 <execv+0x2a4>
+  802a07:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a0a:	83 e0 02             	and    $0x2,%eax
+  802a0d:	83 f8 01             	cmp    $0x1,%eax
+  802a10:	19 c0                	sbb    %eax,%eax
+  802a12:	83 e0 fe             	and    $0xfffffffe,%eax
+  802a15:	83 c0 07             	add    $0x7,%eax
+  802a18:	8b 53 08             	mov    0x8(%ebx),%edx
+  802a1b:	81 fa ff ff 7f 00    	cmp    $0x7fffff,%edx
+  802a21:	76 a8                	jbe    8029cb <execv+0x27e>
+  802a23:	83 fe 03             	cmp    $0x3,%esi
+  802a26:	7f a3                	jg     8029cb <execv+0x27e>
+  802a28:	8d 0c b6             	lea    (%esi,%esi,4),%ecx
+  802a2b:	c1 e1 02             	shl    $0x2,%ecx
+  802a2e:	89 94 0d 54 fd ff ff 	mov    %edx,-0x2ac(%ebp,%ecx,1)
+  802a35:	8b 53 14             	mov    0x14(%ebx),%edx
+  802a38:	89 94 0d 58 fd ff ff 	mov    %edx,-0x2a8(%ebp,%ecx,1)
+  802a3f:	8b 53 10             	mov    0x10(%ebx),%edx
+  802a42:	89 94 0d 5c fd ff ff 	mov    %edx,-0x2a4(%ebp,%ecx,1)
+  802a49:	8b 53 04             	mov    0x4(%ebx),%edx
+  802a4c:	89 94 0d 60 fd ff ff 	mov    %edx,-0x2a0(%ebp,%ecx,1)
+  802a53:	89 84 0d 64 fd ff ff 	mov    %eax,-0x29c(%ebp,%ecx,1)
+  802a5a:	83 c6 01             	add    $0x1,%esi
+  802a5d:	eb 92                	jmp    8029f1 <execv+0x2a4>
+  802a5f:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802a66:	00 00 00 
+  802a69:	85 f6                	test   %esi,%esi
+  802a6b:	7f 12                	jg     802a7f <execv+0x332>
+  802a6d:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802a73:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  802a7a:	00 00 00 
+  802a7d:	eb 7e                	jmp    802afd <execv+0x3b0>
+  802a7f:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  802a85:	50                   	push   %eax
+  802a86:	56                   	push   %esi
+  802a87:	8d 85 54 fd ff ff    	lea    -0x2ac(%ebp),%eax
+  802a8d:	50                   	push   %eax
+  802a8e:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802a94:	e8 a4 fa ff ff       	call   80253d <file_image>
+  802a99:	89 85 3c fd ff ff    	mov    %eax,-0x2c4(%ebp)
+  802a9f:	83 c4 10             	add    $0x10,%esp
+  802aa2:	85 c0                	test   %eax,%eax
+  802aa4:	0f 88 9e 00 00 00    	js     802b48 <execv+0x3fb>
+  802aaa:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	75 49                	jne    802afd <execv+0x3b0>
+  802ab4:	8d 9d 54 fd ff ff    	lea    -0x2ac(%ebp),%ebx
+  802aba:	bf 00 00 00 00       	mov    $0x0,%edi
+  802abf:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  802ac2:	8b 13                	mov    (%ebx),%edx
+  802ac4:	ff 73 10             	push   0x10(%ebx)
+  802ac7:	ff 73 0c             	push   0xc(%ebx)
+  802aca:	ff 73 08             	push   0x8(%ebx)
+  802acd:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802ad3:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802ad9:	e8 44 fb ff ff       	call   802622 <map_segment>
+  802ade:	83 c4 10             	add    $0x10,%esp
+  802ae1:	85 c0                	test   %eax,%eax
+  802ae3:	0f 88 65 02 00 00    	js     802d4e <execv+0x601>
+  802ae9:	83 c7 01             	add    $0x1,%edi
+  802aec:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802af2:	83 c3 14             	add    $0x14,%ebx
+  802af5:	39 fe                	cmp    %edi,%esi
+  802af7:	7e 04                	jle    802afd <execv+0x3b0>
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	74 c2                	je     802abf <execv+0x372>
+  802afd:	83 ec 04             	sub    $0x4,%esp
+  802b00:	ff b5 3c fd ff ff    	push   -0x2c4(%ebp)
+  802b06:	50                   	push   %eax
+  802b07:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802b0d:	e8 15 ec ff ff       	call   801727 <sys_env_set_pager>
+  802b12:	89 c7                	mov    %eax,%edi
+  802b14:	83 c4 10             	add    $0x10,%esp
+  802b17:	85 c0                	test   %eax,%eax
+  802b19:	0f 88 08 02 00 00    	js     802d27 <execv+0x5da>
+  802b1f:	83 ec 0c             	sub    $0xc,%esp
+  802b22:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802b28:	e8 89 f0 ff ff       	call   801bb6 <close>
+  802b2d:	e8 b6 10 00 00       	call   803be8 <dupq_begin>
+  802b32:	89 c7                	mov    %eax,%edi
+  802b34:	83 c4 10             	add    $0x10,%esp
+  802b37:	89 c1                	mov    %eax,%ecx
+  802b39:	85 c0                	test   %eax,%eax
+  802b3b:	0f 88 91 00 00 00    	js     802bd2 <execv+0x485>
+  802b41:	be 02 00 00 00       	mov    $0x2,%esi
+  802b46:	eb 33                	jmp    802b7b <execv+0x42e>
+  802b48:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802b4f:	00 00 00 
+  802b52:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  802b59:	00 00 00 
+  802b5c:	e9 53 ff ff ff       	jmp    802ab4 <execv+0x367>
+  802b61:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802b68:	a8 01                	test   $0x1,%al
+  802b6a:	75 7b                	jne    802be7 <execv+0x49a>
+  802b6c:	83 c6 01             	add    $0x1,%esi
+  802b6f:	81 fe ba 03 00 00    	cmp    $0x3ba,%esi
+  802b75:	0f 84 e5 00 00 00    	je     802c60 <execv+0x513>
+  802b7b:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802b82:	a8 01                	test   $0x1,%al
+  802b84:	74 db                	je     802b61 <execv+0x414>
+  802b86:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802b8d:	a8 80                	test   $0x80,%al
+  802b8f:	74 d0                	je     802b61 <execv+0x414>
+  802b91:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802b98:	f6 c4 04             	test   $0x4,%ah
+  802b9b:	74 cf                	je     802b6c <execv+0x41f>
+  802b9d:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ba4:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ba9:	0c 80                	or     $0x80,%al
+  802bab:	50                   	push   %eax
+  802bac:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802bb2:	89 f0                	mov    %esi,%eax
+  802bb4:	c1 e0 16             	shl    $0x16,%eax
+  802bb7:	c1 e8 0c             	shr    $0xc,%eax
+  802bba:	50                   	push   %eax
+  802bbb:	6a 00                	push   $0x0
+  802bbd:	e8 46 10 00 00       	call   803c08 <dupq_map>
+  802bc2:	89 c1                	mov    %eax,%ecx
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	79 a1                	jns    802b6c <execv+0x41f>
+  802bcb:	89 c7                	mov    %eax,%edi
+  802bcd:	e8 99 10 00 00       	call   803c6b <dupq_end>
+  802bd2:	57                   	push   %edi
+  802bd3:	68 8c 48 80 00       	push   $0x80488c
+  802bd8:	68 ac 00 00 00       	push   $0xac
+  802bdd:	68 51 48 80 00       	push   $0x804851
+  802be2:	e8 25 d7 ff ff       	call   80030c <_panic>
+  802be7:	89 f7                	mov    %esi,%edi
+  802be9:	c1 e7 16             	shl    $0x16,%edi
+  802bec:	89 f8                	mov    %edi,%eax
+  802bee:	c1 e8 0c             	shr    $0xc,%eax
+  802bf1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802bf6:	eb 24                	jmp    802c1c <execv+0x4cf>
+  802bf8:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802bfe:	0f 84 68 ff ff ff    	je     802b6c <execv+0x41f>
+  802c04:	89 d8                	mov    %ebx,%eax
+  802c06:	09 f8                	or     %edi,%eax
+  802c08:	c1 e8 0c             	shr    $0xc,%eax
+  802c0b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c11:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  802c16:	0f 84 50 ff ff ff    	je     802b6c <execv+0x41f>
+  802c1c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802c23:	f6 c2 01             	test   $0x1,%dl
+  802c26:	74 d0                	je     802bf8 <execv+0x4ab>
+  802c28:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802c2f:	f6 c6 04             	test   $0x4,%dh
+  802c32:	74 c4                	je     802bf8 <execv+0x4ab>
+  802c34:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802c3b:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802c41:	52                   	push   %edx
+  802c42:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802c48:	50                   	push   %eax
+  802c49:	6a 00                	push   $0x0
+  802c4b:	e8 b8 0f 00 00       	call   803c08 <dupq_map>
+  802c50:	89 c1                	mov    %eax,%ecx
+  802c52:	83 c4 10             	add    $0x10,%esp
+  802c55:	85 c0                	test   %eax,%eax
+  802c57:	79 9f                	jns    802bf8 <execv+0x4ab>
+  802c59:	89 c7                	mov    %eax,%edi
+  802c5b:	e9 6d ff ff ff       	jmp    802bcd <execv+0x480>
+  802c60:	89 cf                	mov    %ecx,%edi
+  802c62:	85 c9                	test   %ecx,%ecx
+  802c64:	0f 88 63 ff ff ff    	js     802bcd <execv+0x480>
+  802c6a:	e8 fc 0f 00 00       	call   803c6b <dupq_end>
+  802c6f:	89 c7                	mov    %eax,%edi
+  802c71:	85 c0                	test   %eax,%eax
+  802c73:	0f 88 59 ff ff ff    	js     802bd2 <execv+0x485>
+  802c79:	83 ec 08             	sub    $0x8,%esp
+  802c7c:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802c82:	50                   	push   %eax
+  802c83:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802c89:	e8 25 e4 ff ff       	call   8010b3 <sys_env_set_trapframe>
+  802c8e:	83 c4 10             	add    $0x10,%esp
+  802c91:	85 c0                	test   %eax,%eax
+  802c93:	78 2e                	js     802cc3 <execv+0x576>
+  802c95:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c99:	74 52                	je     802ced <execv+0x5a0>
+  802c9b:	83 ec 08             	sub    $0x8,%esp
+  802c9e:	6a 02                	push   $0x2
+  802ca0:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802ca6:	e8 c6 e3 ff ff       	call   801071 <sys_env_set_status>
+  802cab:	83 c4 10             	add    $0x10,%esp
+  802cae:	85 c0                	test   %eax,%eax
+  802cb0:	78 26                	js     802cd8 <execv+0x58b>
+  802cb2:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802cb8:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802cbe:	e9 9b 00 00 00       	jmp    802d5e <execv+0x611>
+  802cc3:	50                   	push   %eax
+  802cc4:	68 a2 48 80 00       	push   $0x8048a2
+  802cc9:	68 af 00 00 00       	push   $0xaf
+  802cce:	68 51 48 80 00       	push   $0x804851
+  802cd3:	e8 34 d6 ff ff       	call   80030c <_panic>
+  802cd8:	50                   	push   %eax
+  802cd9:	68 bc 48 80 00       	push   $0x8048bc
+  802cde:	68 b3 00 00 00       	push   $0xb3
+  802ce3:	68 51 48 80 00       	push   $0x804851
+  802ce8:	e8 1f d6 ff ff       	call   80030c <_panic>
+  802ced:	83 ec 0c             	sub    $0xc,%esp
+  802cf0:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802cf6:	e8 56 e6 ff ff       	call   801351 <sys_env_swap>
+  802cfb:	83 c4 10             	add    $0x10,%esp
+  802cfe:	85 c0                	test   %eax,%eax
+  802d00:	78 0e                	js     802d10 <execv+0x5c3>
+  802d02:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802d08:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802d0e:	eb 4e                	jmp    802d5e <execv+0x611>
+  802d10:	50                   	push   %eax
+  802d11:	68 d3 48 80 00       	push   $0x8048d3
+  802d16:	68 ba 00 00 00       	push   $0xba
+  802d1b:	68 51 48 80 00       	push   $0x804851
+  802d20:	e8 e7 d5 ff ff       	call   80030c <_panic>
+  802d25:	89 c7                	mov    %eax,%edi
+  802d27:	83 ec 0c             	sub    $0xc,%esp
+  802d2a:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802d30:	e8 5e e1 ff ff       	call   800e93 <sys_env_destroy>
+  802d35:	83 c4 04             	add    $0x4,%esp
+  802d38:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802d3e:	e8 73 ee ff ff       	call   801bb6 <close>
+  802d43:	83 c4 10             	add    $0x10,%esp
+  802d46:	89 bd 44 fd ff ff    	mov    %edi,-0x2bc(%ebp)
+  802d4c:	eb 10                	jmp    802d5e <execv+0x611>
+  802d4e:	89 c7                	mov    %eax,%edi
+  802d50:	eb d5                	jmp    802d27 <execv+0x5da>
+  802d52:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802d58:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802d5e:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  802d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d67:	5b                   	pop    %ebx
+  802d68:	5e                   	pop    %esi
+  802d69:	5f                   	pop    %edi
+  802d6a:	5d                   	pop    %ebp
+  802d6b:	c3                   	ret
+  802d6c:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802d73:	00 00 00 
+  802d76:	e9 f2 fc ff ff       	jmp    802a6d <execv+0x320>
+  802d7b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802d80:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802d86:	eb d6                	jmp    802d5e <execv+0x611>
+  802d88:	83 ec 08             	sub    $0x8,%esp
+  802d8b:	68 00 00 40 00       	push   $0x400000
+  802d90:	6a 00                	push   $0x0
+  802d92:	e8 79 e2 ff ff       	call   801010 <sys_page_unmap>
+  802d97:	83 c4 10             	add    $0x10,%esp
+  802d9a:	89 9d 44 fd ff ff    	mov    %ebx,-0x2bc(%ebp)
+  802da0:	eb bc                	jmp    802d5e <execv+0x611>
+  802da2:	83 ec 04             	sub    $0x4,%esp
+  802da5:	6a 07                	push   $0x7
+  802da7:	68 00 00 40 00       	push   $0x400000
+  802dac:	6a 00                	push   $0x0
+  802dae:	e8 8b e1 ff ff       	call   800f3e <sys_page_alloc>
+  802db3:	83 c4 10             	add    $0x10,%esp
+  802db6:	85 c0                	test   %eax,%eax
+  802db8:	78 c6                	js     802d80 <execv+0x633>
+  802dba:	c7 85 2c fd ff ff 00 	movl   $0x0,-0x2d4(%ebp)
+  802dc1:	00 00 00 
+  802dc4:	c7 85 38 fd ff ff 00 	movl   $0x0,-0x2c8(%ebp)
+  802dcb:	00 00 00 
+  802dce:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+  802dd3:	be 00 10 40 00       	mov    $0x401000,%esi
+  802dd8:	e9 f7 fa ff ff       	jmp    8028d4 <execv+0x187>
+
+00802ddd <spawn>:
+  802ddd:	55                   	push   %ebp
+  802dde:	89 e5                	mov    %esp,%ebp
+  802de0:	83 ec 0c             	sub    $0xc,%esp
+  802de3:	6a 01                	push   $0x1
+  802de5:	ff 75 0c             	push   0xc(%ebp)
+  802de8:	ff 75 08             	push   0x8(%ebp)
+  802deb:	e8 5d f9 ff ff       	call   80274d <execv>
+  802df0:	c9                   	leave
+  802df1:	c3                   	ret
+
+00802df2 <exec>:
+  802df2:	55                   	push   %ebp
+  802df3:	89 e5                	mov    %esp,%ebp
+  802df5:	83 ec 0c             	sub    $0xc,%esp
+  802df8:	6a 00                	push   $0x0
+  802dfa:	ff 75 0c             	push   0xc(%ebp)
+  802dfd:	ff 75 08             	push   0x8(%ebp)
+  802e00:	e8 48 f9 ff ff       	call   80274d <execv>
+  802e05:	c9                   	leave
+  802e06:	c3                   	ret
+
+00802e07 <spawnl>:
+  802e07:	55                   	push   %ebp
+  802e08:	89 e5                	mov    %esp,%ebp
+  802e0a:	56                   	push   %esi
+  802e0b:	53                   	push   %ebx
+  802e0c:	8d 45 10             	lea    0x10(%ebp),%eax
+  802e0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e14:	eb 05                	jmp    802e1b <spawnl+0x14>
+  802e16:	83 c1 01             	add    $0x1,%ecx
+  802e19:	89 d0                	mov    %edx,%eax
+  802e1b:	8d 50 04             	lea    0x4(%eax),%edx
+  802e1e:	83 38 00             	cmpl   $0x0,(%eax)
+  802e21:	75 f3                	jne    802e16 <spawnl+0xf>
+  802e23:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802e2a:	83 e0 f0             	and    $0xfffffff0,%eax
+  802e2d:	29 c4                	sub    %eax,%esp
+  802e2f:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802e33:	89 d8                	mov    %ebx,%eax
+  802e35:	c1 e8 02             	shr    $0x2,%eax
+  802e38:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802e3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e3e:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802e45:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802e4c:	00 
+  802e4d:	8d 55 10             	lea    0x10(%ebp),%edx
+  802e50:	89 ce                	mov    %ecx,%esi
+  802e52:	85 c9                	test   %ecx,%ecx
+  802e54:	74 16                	je     802e6c <spawnl+0x65>
+  802e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5b:	83 c0 01             	add    $0x1,%eax
+  802e5e:	89 d1                	mov    %edx,%ecx
+  802e60:	83 c2 04             	add    $0x4,%edx
+  802e63:	8b 09                	mov    (%ecx),%ecx
+  802e65:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802e68:	39 f0                	cmp    %esi,%eax
+  802e6a:	75 ef                	jne    802e5b <spawnl+0x54>
+  802e6c:	83 ec 08             	sub    $0x8,%esp
+  802e6f:	53                   	push   %ebx
+  802e70:	ff 75 08             	push   0x8(%ebp)
+  802e73:	e8 65 ff ff ff       	call   802ddd <spawn>
+  802e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e7b:	5b                   	pop    %ebx
+  802e7c:	5e                   	pop    %esi
+  802e7d:	5d                   	pop    %ebp
+  802e7e:	c3                   	ret
+
+00802e7f <execl>:
+  802e7f:	55                   	push   %ebp
+  802e80:	89 e5                	mov    %esp,%ebp
+  802e82:	56                   	push   %esi
+  802e83:	53                   	push   %ebx
+  802e84:	8d 45 10             	lea    0x10(%ebp),%eax
+  802e87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e8c:	eb 05                	jmp    802e93 <execl+0x14>
+  802e8e:	83 c1 01             	add    $0x1,%ecx
+  802e91:	89 d0                	mov    %edx,%eax
+  802e93:	8d 50 04             	lea    0x4(%eax),%edx
+  802e96:	83 38 00             	cmpl   $0x0,(%eax)
+  802e99:	75 f3                	jne    802e8e <execl+0xf>
+  802e9b:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802ea2:	83 e0 f0             	and    $0xfffffff0,%eax
+  802ea5:	29 c4                	sub    %eax,%esp
+  802ea7:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802eab:	89 d8                	mov    %ebx,%eax
+  802ead:	c1 e8 02             	shr    $0x2,%eax
+  802eb0:	83 e3 fc             	and    $0xfffffffc,%ebx
+  802eb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802eb6:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  802ebd:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802ec4:	00 
+  802ec5:	8d 55 10             	lea    0x10(%ebp),%edx
+  802ec8:	89 ce                	mov    %ecx,%esi
+  802eca:	85 c9                	test   %ecx,%ecx
+  802ecc:	74 16                	je     802ee4 <execl+0x65>
+  802ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed3:	83 c0 01             	add    $0x1,%eax
+  802ed6:	89 d1                	mov    %edx,%ecx
+  802ed8:	83 c2 04             	add    $0x4,%edx
+  802edb:	8b 09                	mov    (%ecx),%ecx
+  802edd:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802ee0:	39 f0                	cmp    %esi,%eax
+  802ee2:	75 ef                	jne    802ed3 <execl+0x54>
+  802ee4:	83 ec 08             	sub    $0x8,%esp
+  802ee7:	53                   	push   %ebx
+  802ee8:	ff 75 08             	push   0x8(%ebp)
+  802eeb:	e8 02 ff ff ff       	call   802df2 <exec>
+  802ef0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ef3:	5b                   	pop    %ebx
+  802ef4:	5e                   	pop    %esi
+  802ef5:	5d                   	pop    %ebp
+  802ef6:	c3                   	ret
+
+00802ef7 <devsock_stat>:
+  802ef7:	55                   	push   %ebp
+  802ef8:	89 e5                	mov    %esp,%ebp
+  802efa:	83 ec 10             	sub    $0x10,%esp
+  802efd:	68 0a 49 80 00       	push   $0x80490a
+  802f02:	ff 75 0c             	push   0xc(%ebp)
+  802f05:	e8 d4 db ff ff       	call   800ade <strcpy>
+  802f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0f:	c9                   	leave
+  802f10:	c3                   	ret
+
+00802f11 <devsock_close>:
+  802f11:	55                   	push   %ebp
+  802f12:	89 e5                	mov    %esp,%ebp
+  802f14:	53                   	push   %ebx
+  802f15:	83 ec 10             	sub    $0x10,%esp
+  802f18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f1b:	53                   	push   %ebx
+  802f1c:	e8 bf 10 00 00       	call   803fe0 <pageref>
+  802f21:	89 c2                	mov    %eax,%edx
+  802f23:	83 c4 10             	add    $0x10,%esp
+  802f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2b:	83 fa 01             	cmp    $0x1,%edx
+  802f2e:	74 05                	je     802f35 <devsock_close+0x24>
+  802f30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f33:	c9                   	leave
+  802f34:	c3                   	ret
+  802f35:	83 ec 0c             	sub    $0xc,%esp
+  802f38:	ff 73 0c             	push   0xc(%ebx)
+  802f3b:	e8 aa 02 00 00       	call   8031ea <nsipc_close>
+  802f40:	83 c4 10             	add    $0x10,%esp
+  802f43:	eb eb                	jmp    802f30 <devsock_close+0x1f>
+
+00802f45 <devsock_write>:
+  802f45:	55                   	push   %ebp
+  802f46:	89 e5                	mov    %esp,%ebp
+  802f48:	83 ec 08             	sub    $0x8,%esp
+  802f4b:	6a 00                	push   $0x0
+  802f4d:	ff 75 10             	push   0x10(%ebp)
+  802f50:	ff 75 0c             	push   0xc(%ebp)
+  802f53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f56:	ff 70 0c             	push   0xc(%eax)
+  802f59:	e8 6c 03 00 00       	call   8032ca <nsipc_send>
+  802f5e:	c9                   	leave
+  802f5f:	c3                   	ret
+
+00802f60 <devsock_read>:
+  802f60:	55                   	push   %ebp
+  802f61:	89 e5                	mov    %esp,%ebp
+  802f63:	83 ec 08             	sub    $0x8,%esp
+  802f66:	6a 00                	push   $0x0
+  802f68:	ff 75 10             	push   0x10(%ebp)
+  802f6b:	ff 75 0c             	push   0xc(%ebp)
+  802f6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f71:	ff 70 0c             	push   0xc(%eax)
+  802f74:	e8 e2 02 00 00       	call   80325b <nsipc_recv>
+  802f79:	c9                   	leave
+  802f7a:	c3                   	ret
+
+00802f7b <fd2sockid>:
+  802f7b:	55                   	push   %ebp
+  802f7c:	89 e5                	mov    %esp,%ebp
+  802f7e:	83 ec 20             	sub    $0x20,%esp
+  802f81:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f84:	52                   	push   %edx
+  802f85:	50                   	push   %eax
+  802f86:	e8 05 eb ff ff       	call   801a90 <fd_lookup>
+  802f8b:	83 c4 10             	add    $0x10,%esp
+  802f8e:	85 c0                	test   %eax,%eax
+  802f90:	78 10                	js     802fa2 <fd2sockid+0x27>
+  802f92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f95:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+  802f9b:	39 08                	cmp    %ecx,(%eax)
+  802f9d:	75 05                	jne    802fa4 <fd2sockid+0x29>
+  802f9f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802fa2:	c9                   	leave
+  802fa3:	c3                   	ret
+  802fa4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802fa9:	eb f7                	jmp    802fa2 <fd2sockid+0x27>
+
+00802fab <alloc_sockfd>:
+  802fab:	55                   	push   %ebp
+  802fac:	89 e5                	mov    %esp,%ebp
+  802fae:	56                   	push   %esi
+  802faf:	53                   	push   %ebx
+  802fb0:	83 ec 1c             	sub    $0x1c,%esp
+  802fb3:	89 c6                	mov    %eax,%esi
+  802fb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fb8:	50                   	push   %eax
+  802fb9:	e8 82 ea ff ff       	call   801a40 <fd_alloc>
+  802fbe:	89 c3                	mov    %eax,%ebx
+  802fc0:	83 c4 10             	add    $0x10,%esp
+  802fc3:	85 c0                	test   %eax,%eax
+  802fc5:	78 43                	js     80300a <alloc_sockfd+0x5f>
+  802fc7:	83 ec 04             	sub    $0x4,%esp
+  802fca:	68 07 04 00 00       	push   $0x407
+  802fcf:	ff 75 f4             	push   -0xc(%ebp)
+  802fd2:	6a 00                	push   $0x0
+  802fd4:	e8 65 df ff ff       	call   800f3e <sys_page_alloc>
+  802fd9:	89 c3                	mov    %eax,%ebx
+  802fdb:	83 c4 10             	add    $0x10,%esp
+  802fde:	85 c0                	test   %eax,%eax
+  802fe0:	78 28                	js     80300a <alloc_sockfd+0x5f>
+  802fe2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fe5:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  802feb:	89 10                	mov    %edx,(%eax)
+  802fed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ff0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802ff7:	89 70 0c             	mov    %esi,0xc(%eax)
+  802ffa:	83 ec 0c             	sub    $0xc,%esp
+  802ffd:	50                   	push   %eax
+  802ffe:	e8 16 ea ff ff       	call   801a19 <fd2num>
+  803003:	89 c3                	mov    %eax,%ebx
+  803005:	83 c4 10             	add    $0x10,%esp
+  803008:	eb 0c                	jmp    803016 <alloc_sockfd+0x6b>
+  80300a:	83 ec 0c             	sub    $0xc,%esp
+  80300d:	56                   	push   %esi
+  80300e:	e8 d7 01 00 00       	call   8031ea <nsipc_close>
+  803013:	83 c4 10             	add    $0x10,%esp
+  803016:	89 d8                	mov    %ebx,%eax
+  803018:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80301b:	5b                   	pop    %ebx
+  80301c:	5e                   	pop    %esi
+  80301d:	5d                   	pop    %ebp
+  80301e:	c3                   	ret
+
+0080301f <accept>:
+  80301f:	55                   	push   %ebp
+  803020:	89 e5                	mov    %esp,%ebp
+  803022:	83 ec 08             	sub    $0x8,%esp
+  803025:	8b 45 08             	mov    0x8(%ebp),%eax
+  803028:	e8 4e ff ff ff       	call   802f7b <fd2sockid>
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	78 1b                	js     80304c <accept+0x2d>
+  803031:	83 ec 04             	sub    $0x4,%esp
+  803034:	ff 75 10             	push   0x10(%ebp)
+  803037:	ff 75 0c             	push   0xc(%ebp)
+  80303a:	50                   	push   %eax
+  80303b:	e8 07 01 00 00       	call   803147 <nsipc_accept>
+  803040:	83 c4 10             	add    $0x10,%esp
+  803043:	85 c0                	test   %eax,%eax
+  803045:	78 05                	js     80304c <accept+0x2d>
+  803047:	e8 5f ff ff ff       	call   802fab <alloc_sockfd>
+  80304c:	c9                   	leave
+  80304d:	c3                   	ret
+
+0080304e <bind>:
+  80304e:	55                   	push   %ebp
+  80304f:	89 e5                	mov    %esp,%ebp
+  803051:	83 ec 08             	sub    $0x8,%esp
+  803054:	8b 45 08             	mov    0x8(%ebp),%eax
+  803057:	e8 1f ff ff ff       	call   802f7b <fd2sockid>
+  80305c:	85 c0                	test   %eax,%eax
+  80305e:	78 12                	js     803072 <bind+0x24>
+  803060:	83 ec 04             	sub    $0x4,%esp
+  803063:	ff 75 10             	push   0x10(%ebp)
+  803066:	ff 75 0c             	push   0xc(%ebp)
+  803069:	50                   	push   %eax
+  80306a:	e8 24 01 00 00       	call   803193 <nsipc_bind>
+  80306f:	83 c4 10             	add    $0x10,%esp
+  803072:	c9                   	leave
+  803073:	c3                   	ret
+
+00803074 <shutdown>:
+  803074:	55                   	push   %ebp
+  803075:	89 e5                	mov    %esp,%ebp
+  803077:	83 ec 08             	sub    $0x8,%esp
+  80307a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307d:	e8 f9 fe ff ff       	call   802f7b <fd2sockid>
+  803082:	85 c0                	test   %eax,%eax
+  803084:	78 0f                	js     803095 <shutdown+0x21>
+  803086:	83 ec 08             	sub    $0x8,%esp
+  803089:	ff 75 0c             	push   0xc(%ebp)
+  80308c:	50                   	push   %eax
+  80308d:	e8 36 01 00 00       	call   8031c8 <nsipc_shutdown>
+  803092:	83 c4 10             	add    $0x10,%esp
+  803095:	c9                   	leave
+  803096:	c3                   	ret
+
+00803097 <connect>:
+  803097:	55                   	push   %ebp
+  803098:	89 e5                	mov    %esp,%ebp
+  80309a:	83 ec 08             	sub    $0x8,%esp
+  80309d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030a0:	e8 d6 fe ff ff       	call   802f7b <fd2sockid>
+  8030a5:	85 c0                	test   %eax,%eax
+  8030a7:	78 12                	js     8030bb <connect+0x24>
+  8030a9:	83 ec 04             	sub    $0x4,%esp
+  8030ac:	ff 75 10             	push   0x10(%ebp)
+  8030af:	ff 75 0c             	push   0xc(%ebp)
+  8030b2:	50                   	push   %eax
+  8030b3:	e8 4c 01 00 00       	call   803204 <nsipc_connect>
+  8030b8:	83 c4 10             	add    $0x10,%esp
+  8030bb:	c9                   	leave
+  8030bc:	c3                   	ret
+
+008030bd <listen>:
+  8030bd:	55                   	push   %ebp
+  8030be:	89 e5                	mov    %esp,%ebp
+  8030c0:	83 ec 08             	sub    $0x8,%esp
+  8030c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c6:	e8 b0 fe ff ff       	call   802f7b <fd2sockid>
+  8030cb:	85 c0                	test   %eax,%eax
+  8030cd:	78 0f                	js     8030de <listen+0x21>
+  8030cf:	83 ec 08             	sub    $0x8,%esp
+  8030d2:	ff 75 0c             	push   0xc(%ebp)
+  8030d5:	50                   	push   %eax
+  8030d6:	e8 5e 01 00 00       	call   803239 <nsipc_listen>
+  8030db:	83 c4 10             	add    $0x10,%esp
+  8030de:	c9                   	leave
+  8030df:	c3                   	ret
+
+008030e0 <socket>:
+  8030e0:	55                   	push   %ebp
+  8030e1:	89 e5                	mov    %esp,%ebp
+  8030e3:	83 ec 0c             	sub    $0xc,%esp
+  8030e6:	ff 75 10             	push   0x10(%ebp)
+  8030e9:	ff 75 0c             	push   0xc(%ebp)
+  8030ec:	ff 75 08             	push   0x8(%ebp)
+  8030ef:	e8 34 02 00 00       	call   803328 <nsipc_socket>
+  8030f4:	83 c4 10             	add    $0x10,%esp
+  8030f7:	85 c0                	test   %eax,%eax
+  8030f9:	78 05                	js     803100 <socket+0x20>
+  8030fb:	e8 ab fe ff ff       	call   802fab <alloc_sockfd>
+  803100:	c9                   	leave
+  803101:	c3                   	ret
+
+00803102 <nsipc>:
+  803102:	55                   	push   %ebp
+  803103:	89 e5                	mov    %esp,%ebp
+  803105:	53                   	push   %ebx
+  803106:	83 ec 04             	sub    $0x4,%esp
+  803109:	89 c3                	mov    %eax,%ebx
+  80310b:	83 3d 0c 80 80 00 00 	cmpl   $0x0,0x80800c
+  803112:	74 1f                	je     803133 <nsipc+0x31>
+  803114:	83 ec 08             	sub    $0x8,%esp
+  803117:	6a 00                	push   $0x0
+  803119:	6a 00                	push   $0x0
+  80311b:	6a 07                	push   $0x7
+  80311d:	68 00 e0 80 00       	push   $0x80e000
+  803122:	53                   	push   %ebx
+  803123:	ff 35 0c 80 80 00    	push   0x80800c
+  803129:	e8 36 e7 ff ff       	call   801864 <ipc_call>
+  80312e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803131:	c9                   	leave
+  803132:	c3                   	ret
+  803133:	83 ec 0c             	sub    $0xc,%esp
+  803136:	6a 03                	push   $0x3
+  803138:	e8 c2 e8 ff ff       	call   8019ff <ipc_find_env>
+  80313d:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  803142:	83 c4 10             	add    $0x10,%esp
+  803145:	eb cd                	jmp    803114 <nsipc+0x12>
+
+00803147 <nsipc_accept>:
+  803147:	55                   	push   %ebp
+  803148:	89 e5                	mov    %esp,%ebp
+  80314a:	53                   	push   %ebx
+  80314b:	83 ec 04             	sub    $0x4,%esp
+  80314e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803151:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  803156:	b8 01 00 00 00       	mov    $0x1,%eax
+  80315b:	e8 a2 ff ff ff       	call   803102 <nsipc>
+  803160:	89 c3                	mov    %eax,%ebx
+  803162:	85 c0                	test   %eax,%eax
+  803164:	79 07                	jns    80316d <nsipc_accept+0x26>
+  803166:	89 d8                	mov    %ebx,%eax
+  803168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80316b:	c9                   	leave
+  80316c:	c3                   	ret
+  80316d:	83 ec 04             	sub    $0x4,%esp
+  803170:	ff 35 10 e0 80 00    	push   0x80e010
+  803176:	68 00 e0 80 00       	push   $0x80e000
+  80317b:	ff 75 0c             	push   0xc(%ebp)
+  80317e:	e8 0b db ff ff       	call   800c8e <memmove>
+  803183:	8b 15 10 e0 80 00    	mov    0x80e010,%edx
+  803189:	8b 45 10             	mov    0x10(%ebp),%eax
+  80318c:	89 10                	mov    %edx,(%eax)
+  80318e:	83 c4 10             	add    $0x10,%esp
+  803191:	eb d3                	jmp    803166 <nsipc_accept+0x1f>
+
+00803193 <nsipc_bind>:
+  803193:	55                   	push   %ebp
+  803194:	89 e5                	mov    %esp,%ebp
+  803196:	53                   	push   %ebx
+  803197:	83 ec 08             	sub    $0x8,%esp
+  80319a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80319d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a0:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  8031a5:	53                   	push   %ebx
+  8031a6:	ff 75 0c             	push   0xc(%ebp)
+  8031a9:	68 04 e0 80 00       	push   $0x80e004
+  8031ae:	e8 db da ff ff       	call   800c8e <memmove>
+  8031b3:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+  8031b9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8031be:	e8 3f ff ff ff       	call   803102 <nsipc>
+  8031c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031c6:	c9                   	leave
+  8031c7:	c3                   	ret
+
+008031c8 <nsipc_shutdown>:
+  8031c8:	55                   	push   %ebp
+  8031c9:	89 e5                	mov    %esp,%ebp
+  8031cb:	83 ec 08             	sub    $0x8,%esp
+  8031ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d1:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  8031d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031d9:	a3 04 e0 80 00       	mov    %eax,0x80e004
+  8031de:	b8 03 00 00 00       	mov    $0x3,%eax
+  8031e3:	e8 1a ff ff ff       	call   803102 <nsipc>
+  8031e8:	c9                   	leave
+  8031e9:	c3                   	ret
+
+008031ea <nsipc_close>:
+  8031ea:	55                   	push   %ebp
+  8031eb:	89 e5                	mov    %esp,%ebp
+  8031ed:	83 ec 08             	sub    $0x8,%esp
+  8031f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f3:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  8031f8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8031fd:	e8 00 ff ff ff       	call   803102 <nsipc>
+  803202:	c9                   	leave
+  803203:	c3                   	ret
+
+00803204 <nsipc_connect>:
+  803204:	55                   	push   %ebp
+  803205:	89 e5                	mov    %esp,%ebp
+  803207:	53                   	push   %ebx
+  803208:	83 ec 08             	sub    $0x8,%esp
+  80320b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80320e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803211:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  803216:	53                   	push   %ebx
+  803217:	ff 75 0c             	push   0xc(%ebp)
+  80321a:	68 04 e0 80 00       	push   $0x80e004
+  80321f:	e8 6a da ff ff       	call   800c8e <memmove>
+  803224:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+  80322a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80322f:	e8 ce fe ff ff       	call   803102 <nsipc>
+  803234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803237:	c9                   	leave
+  803238:	c3                   	ret
+
+00803239 <nsipc_listen>:
+  803239:	55                   	push   %ebp
+  80323a:	89 e5                	mov    %esp,%ebp
+  80323c:	83 ec 08             	sub    $0x8,%esp
+  80323f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803242:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  803247:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80324a:	a3 04 e0 80 00       	mov    %eax,0x80e004
+  80324f:	b8 06 00 00 00       	mov    $0x6,%eax
+  803254:	e8 a9 fe ff ff       	call   803102 <nsipc>
+  803259:	c9                   	leave
+  80325a:	c3                   	ret
+
+0080325b <nsipc_recv>:
+  80325b:	55                   	push   %ebp
+  80325c:	89 e5                	mov    %esp,%ebp
+  80325e:	56                   	push   %esi
+  80325f:	53                   	push   %ebx
+  803260:	8b 75 10             	mov    0x10(%ebp),%esi
+  803263:	8b 45 08             	mov    0x8(%ebp),%eax
+  803266:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  80326b:	89 35 04 e0 80 00    	mov    %esi,0x80e004
+  803271:	8b 45 14             	mov    0x14(%ebp),%eax
+  803274:	a3 08 e0 80 00       	mov    %eax,0x80e008
+  803279:	b8 07 00 00 00       	mov    $0x7,%eax
+  80327e:	e8 7f fe ff ff       	call   803102 <nsipc>
+  803283:	89 c3                	mov    %eax,%ebx
+  803285:	85 c0                	test   %eax,%eax
+  803287:	78 22                	js     8032ab <nsipc_recv+0x50>
+  803289:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80328e:	39 c6                	cmp    %eax,%esi
+  803290:	0f 4e c6             	cmovle %esi,%eax
+  803293:	39 c3                	cmp    %eax,%ebx
+  803295:	7f 1d                	jg     8032b4 <nsipc_recv+0x59>
+  803297:	83 ec 04             	sub    $0x4,%esp
+  80329a:	53                   	push   %ebx
+  80329b:	68 00 e0 80 00       	push   $0x80e000
+  8032a0:	ff 75 0c             	push   0xc(%ebp)
+  8032a3:	e8 e6 d9 ff ff       	call   800c8e <memmove>
+  8032a8:	83 c4 10             	add    $0x10,%esp
+  8032ab:	89 d8                	mov    %ebx,%eax
+  8032ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b0:	5b                   	pop    %ebx
+  8032b1:	5e                   	pop    %esi
+  8032b2:	5d                   	pop    %ebp
+  8032b3:	c3                   	ret
+  8032b4:	68 16 49 80 00       	push   $0x804916
+  8032b9:	68 77 48 80 00       	push   $0x804877
+  8032be:	6a 60                	push   $0x60
+  8032c0:	68 2b 49 80 00       	push   $0x80492b
+  8032c5:	e8 42 d0 ff ff       	call   80030c <_panic>
+
+008032ca <nsipc_send>:
+  8032ca:	55                   	push   %ebp
+  8032cb:	89 e5                	mov    %esp,%ebp
+  8032cd:	53                   	push   %ebx
+  8032ce:	83 ec 04             	sub    $0x4,%esp
+  8032d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8032d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d7:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  8032dc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8032e2:	7f 2e                	jg     803312 <nsipc_send+0x48>
+  8032e4:	83 ec 04             	sub    $0x4,%esp
+  8032e7:	53                   	push   %ebx
+  8032e8:	ff 75 0c             	push   0xc(%ebp)
+  8032eb:	68 0c e0 80 00       	push   $0x80e00c
+  8032f0:	e8 99 d9 ff ff       	call   800c8e <memmove>
+  8032f5:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+  8032fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032fe:	a3 08 e0 80 00       	mov    %eax,0x80e008
+  803303:	b8 08 00 00 00       	mov    $0x8,%eax
+  803308:	e8 f5 fd ff ff       	call   803102 <nsipc>
+  80330d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803310:	c9                   	leave
+  803311:	c3                   	ret
+  803312:	68 37 49 80 00       	push   $0x804937
+  803317:	68 77 48 80 00       	push   $0x804877
+  80331c:	6a 6b                	push   $0x6b
+  80331e:	68 2b 49 80 00       	push   $0x80492b
+  803323:	e8 e4 cf ff ff       	call   80030c <_panic>
+
+00803328 <nsipc_socket>:
+  803328:	55                   	push   %ebp
+  803329:	89 e5                	mov    %esp,%ebp
+  80332b:	83 ec 08             	sub    $0x8,%esp
+  80332e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803331:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  803336:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803339:	a3 04 e0 80 00       	mov    %eax,0x80e004
+  80333e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803341:	a3 08 e0 80 00       	mov    %eax,0x80e008
+  803346:	b8 09 00 00 00       	mov    $0x9,%eax
+  80334b:	e8 b2 fd ff ff       	call   803102 <nsipc>
+  803350:	c9                   	leave
+  803351:	c3                   	ret
+
+00803352 <devpipe_stat>:
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	56                   	push   %esi
+  803356:	53                   	push   %ebx
+  803357:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80335a:	83 ec 0c             	sub    $0xc,%esp
+  80335d:	ff 75 08             	push   0x8(%ebp)
+  803360:	e8 c4 e6 ff ff       	call   801a29 <fd2data>
+  803365:	89 c6                	mov    %eax,%esi
+  803367:	83 c4 08             	add    $0x8,%esp
+  80336a:	68 43 49 80 00       	push   $0x804943
+  80336f:	53                   	push   %ebx
+  803370:	e8 69 d7 ff ff       	call   800ade <strcpy>
+  803375:	8b 46 04             	mov    0x4(%esi),%eax
+  803378:	2b 06                	sub    (%esi),%eax
+  80337a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  803380:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803387:	00 00 00 
+  80338a:	c7 83 88 00 00 00 3c 	movl   $0x80703c,0x88(%ebx)
+  803391:	70 80 00 
+  803394:	b8 00 00 00 00       	mov    $0x0,%eax
+  803399:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80339c:	5b                   	pop    %ebx
+  80339d:	5e                   	pop    %esi
+  80339e:	5d                   	pop    %ebp
+  80339f:	c3                   	ret
+
+008033a0 <devpipe_close>:
+  8033a0:	55                   	push   %ebp
+  8033a1:	89 e5                	mov    %esp,%ebp
+  8033a3:	53                   	push   %ebx
+  8033a4:	83 ec 0c             	sub    $0xc,%esp
+  8033a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8033aa:	53                   	push   %ebx
+  8033ab:	6a 00                	push   $0x0
+  8033ad:	e8 5e dc ff ff       	call   801010 <sys_page_unmap>
+  8033b2:	89 1c 24             	mov    %ebx,(%esp)
+  8033b5:	e8 6f e6 ff ff       	call   801a29 <fd2data>
+  8033ba:	83 c4 08             	add    $0x8,%esp
+  8033bd:	50                   	push   %eax
+  8033be:	6a 00                	push   $0x0
+  8033c0:	e8 4b dc ff ff       	call   801010 <sys_page_unmap>
+  8033c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033c8:	c9                   	leave
+  8033c9:	c3                   	ret
+
+008033ca <_pipeisclosed>:
+  8033ca:	55                   	push   %ebp
+  8033cb:	89 e5                	mov    %esp,%ebp
+  8033cd:	57                   	push   %edi
+  8033ce:	56                   	push   %esi
+  8033cf:	53                   	push   %ebx
+  8033d0:	83 ec 1c             	sub    $0x1c,%esp
+  8033d3:	89 c7                	mov    %eax,%edi
+  8033d5:	89 d6                	mov    %edx,%esi
+  8033d7:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  8033dc:	8b 58 58             	mov    0x58(%eax),%ebx
+  8033df:	83 ec 0c             	sub    $0xc,%esp
+  8033e2:	57                   	push   %edi
+  8033e3:	e8 f8 0b 00 00       	call   803fe0 <pageref>
+  8033e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033eb:	89 34 24             	mov    %esi,(%esp)
+  8033ee:	e8 ed 0b 00 00       	call   803fe0 <pageref>
+  8033f3:	8b 15 00 c0 80 00    	mov    0x80c000,%edx
+  8033f9:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8033fc:	83 c4 10             	add    $0x10,%esp
+  8033ff:	39 cb                	cmp    %ecx,%ebx
+  803401:	74 1b                	je     80341e <_pipeisclosed+0x54>
+  803403:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803406:	75 cf                	jne    8033d7 <_pipeisclosed+0xd>
+  803408:	8b 42 58             	mov    0x58(%edx),%eax
+  80340b:	6a 01                	push   $0x1
+  80340d:	50                   	push   %eax
+  80340e:	53                   	push   %ebx
+  80340f:	68 4a 49 80 00       	push   $0x80494a
+  803414:	e8 ce cf ff ff       	call   8003e7 <cprintf>
+  803419:	83 c4 10             	add    $0x10,%esp
+  80341c:	eb b9                	jmp    8033d7 <_pipeisclosed+0xd>
+  80341e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803421:	0f 94 c0             	sete   %al
+  803424:	0f b6 c0             	movzbl %al,%eax
+  803427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80342a:	5b                   	pop    %ebx
+  80342b:	5e                   	pop    %esi
+  80342c:	5f                   	pop    %edi
+  80342d:	5d                   	pop    %ebp
+  80342e:	c3                   	ret
+
+0080342f <devpipe_write>:
+  80342f:	55                   	push   %ebp
+  803430:	89 e5                	mov    %esp,%ebp
+  803432:	57                   	push   %edi
+  803433:	56                   	push   %esi
+  803434:	53                   	push   %ebx
+  803435:	83 ec 28             	sub    $0x28,%esp
+  803438:	8b 75 08             	mov    0x8(%ebp),%esi
+  80343b:	56                   	push   %esi
+  80343c:	e8 e8 e5 ff ff       	call   801a29 <fd2data>
+  803441:	89 c3                	mov    %eax,%ebx
+  803443:	83 c4 10             	add    $0x10,%esp
+  803446:	bf 00 00 00 00       	mov    $0x0,%edi
+  80344b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80344f:	74 5c                	je     8034ad <devpipe_write+0x7e>
+  803451:	8b 43 04             	mov    0x4(%ebx),%eax
+  803454:	8b 0b                	mov    (%ebx),%ecx
+  803456:	8d 51 20             	lea    0x20(%ecx),%edx
+  803459:	39 d0                	cmp    %edx,%eax
+  80345b:	72 1e                	jb     80347b <devpipe_write+0x4c>
+  80345d:	89 da                	mov    %ebx,%edx
+  80345f:	89 f0                	mov    %esi,%eax
+  803461:	e8 64 ff ff ff       	call   8033ca <_pipeisclosed>
+  803466:	85 c0                	test   %eax,%eax
+  803468:	75 48                	jne    8034b2 <devpipe_write+0x83>
+  80346a:	e8 84 da ff ff       	call   800ef3 <sys_yield>
+  80346f:	8b 43 04             	mov    0x4(%ebx),%eax
+  803472:	8b 0b                	mov    (%ebx),%ecx
+  803474:	8d 51 20             	lea    0x20(%ecx),%edx
+  803477:	39 d0                	cmp    %edx,%eax
+  803479:	73 e2                	jae    80345d <devpipe_write+0x2e>
+  80347b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80347e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803482:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803485:	89 c2                	mov    %eax,%edx
+  803487:	c1 fa 1f             	sar    $0x1f,%edx
+  80348a:	89 d1                	mov    %edx,%ecx
+  80348c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80348f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803492:	83 e2 1f             	and    $0x1f,%edx
+  803495:	29 ca                	sub    %ecx,%edx
+  803497:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80349b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80349f:	83 c0 01             	add    $0x1,%eax
+  8034a2:	89 43 04             	mov    %eax,0x4(%ebx)
+  8034a5:	83 c7 01             	add    $0x1,%edi
+  8034a8:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8034ab:	75 a4                	jne    803451 <devpipe_write+0x22>
+  8034ad:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034b0:	eb 05                	jmp    8034b7 <devpipe_write+0x88>
+  8034b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034ba:	5b                   	pop    %ebx
+  8034bb:	5e                   	pop    %esi
+  8034bc:	5f                   	pop    %edi
+  8034bd:	5d                   	pop    %ebp
+  8034be:	c3                   	ret
+
+008034bf <devpipe_read>:
+  8034bf:	55                   	push   %ebp
+  8034c0:	89 e5                	mov    %esp,%ebp
+  8034c2:	57                   	push   %edi
+  8034c3:	56                   	push   %esi
+  8034c4:	53                   	push   %ebx
+  8034c5:	83 ec 18             	sub    $0x18,%esp
+  8034c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034cb:	56                   	push   %esi
+  8034cc:	e8 58 e5 ff ff       	call   801a29 <fd2data>
+  8034d1:	89 c3                	mov    %eax,%ebx
+  8034d3:	83 c4 10             	add    $0x10,%esp
+  8034d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034db:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034df:	74 45                	je     803526 <devpipe_read+0x67>
+  8034e1:	8b 03                	mov    (%ebx),%eax
+  8034e3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8034e6:	75 1d                	jne    803505 <devpipe_read+0x46>
+  8034e8:	85 ff                	test   %edi,%edi
+  8034ea:	75 3f                	jne    80352b <devpipe_read+0x6c>
+  8034ec:	89 da                	mov    %ebx,%edx
+  8034ee:	89 f0                	mov    %esi,%eax
+  8034f0:	e8 d5 fe ff ff       	call   8033ca <_pipeisclosed>
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	75 3c                	jne    803535 <devpipe_read+0x76>
+  8034f9:	e8 f5 d9 ff ff       	call   800ef3 <sys_yield>
+  8034fe:	8b 03                	mov    (%ebx),%eax
+  803500:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803503:	74 e7                	je     8034ec <devpipe_read+0x2d>
+  803505:	99                   	cltd
+  803506:	c1 ea 1b             	shr    $0x1b,%edx
+  803509:	01 d0                	add    %edx,%eax
+  80350b:	83 e0 1f             	and    $0x1f,%eax
+  80350e:	29 d0                	sub    %edx,%eax
+  803510:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803515:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803518:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80351b:	83 03 01             	addl   $0x1,(%ebx)
+  80351e:	83 c7 01             	add    $0x1,%edi
+  803521:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803524:	75 bb                	jne    8034e1 <devpipe_read+0x22>
+  803526:	8b 45 10             	mov    0x10(%ebp),%eax
+  803529:	eb 02                	jmp    80352d <devpipe_read+0x6e>
+  80352b:	89 f8                	mov    %edi,%eax
+  80352d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803530:	5b                   	pop    %ebx
+  803531:	5e                   	pop    %esi
+  803532:	5f                   	pop    %edi
+  803533:	5d                   	pop    %ebp
+  803534:	c3                   	ret
+  803535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353a:	eb f1                	jmp    80352d <devpipe_read+0x6e>
+
+0080353c <pipe>:
+  80353c:	55                   	push   %ebp
+  80353d:	89 e5                	mov    %esp,%ebp
+  80353f:	56                   	push   %esi
+  803540:	53                   	push   %ebx
+  803541:	83 ec 1c             	sub    $0x1c,%esp
+  803544:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803547:	50                   	push   %eax
+  803548:	e8 f3 e4 ff ff       	call   801a40 <fd_alloc>
+  80354d:	89 c3                	mov    %eax,%ebx
+  80354f:	83 c4 10             	add    $0x10,%esp
+  803552:	85 c0                	test   %eax,%eax
+  803554:	0f 88 23 01 00 00    	js     80367d <pipe+0x141>
+  80355a:	83 ec 04             	sub    $0x4,%esp
+  80355d:	68 07 04 00 00       	push   $0x407
+  803562:	ff 75 f4             	push   -0xc(%ebp)
+  803565:	6a 00                	push   $0x0
+  803567:	e8 d2 d9 ff ff       	call   800f3e <sys_page_alloc>
+  80356c:	89 c3                	mov    %eax,%ebx
+  80356e:	83 c4 10             	add    $0x10,%esp
+  803571:	85 c0                	test   %eax,%eax
+  803573:	0f 88 04 01 00 00    	js     80367d <pipe+0x141>
+  803579:	83 ec 0c             	sub    $0xc,%esp
+  80357c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80357f:	50                   	push   %eax
+  803580:	e8 bb e4 ff ff       	call   801a40 <fd_alloc>
+  803585:	89 c3                	mov    %eax,%ebx
+  803587:	83 c4 10             	add    $0x10,%esp
+  80358a:	85 c0                	test   %eax,%eax
+  80358c:	0f 88 db 00 00 00    	js     80366d <pipe+0x131>
+  803592:	83 ec 04             	sub    $0x4,%esp
+  803595:	68 07 04 00 00       	push   $0x407
+  80359a:	ff 75 f0             	push   -0x10(%ebp)
+  80359d:	6a 00                	push   $0x0
+  80359f:	e8 9a d9 ff ff       	call   800f3e <sys_page_alloc>
+  8035a4:	89 c3                	mov    %eax,%ebx
+  8035a6:	83 c4 10             	add    $0x10,%esp
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	0f 88 bc 00 00 00    	js     80366d <pipe+0x131>
+  8035b1:	83 ec 0c             	sub    $0xc,%esp
+  8035b4:	ff 75 f4             	push   -0xc(%ebp)
+  8035b7:	e8 6d e4 ff ff       	call   801a29 <fd2data>
+  8035bc:	89 c6                	mov    %eax,%esi
+  8035be:	83 c4 0c             	add    $0xc,%esp
+  8035c1:	68 07 04 00 00       	push   $0x407
+  8035c6:	50                   	push   %eax
+  8035c7:	6a 00                	push   $0x0
+  8035c9:	e8 70 d9 ff ff       	call   800f3e <sys_page_alloc>
+  8035ce:	89 c3                	mov    %eax,%ebx
+  8035d0:	83 c4 10             	add    $0x10,%esp
+  8035d3:	85 c0                	test   %eax,%eax
+  8035d5:	0f 88 82 00 00 00    	js     80365d <pipe+0x121>
+  8035db:	83 ec 0c             	sub    $0xc,%esp
+  8035de:	ff 75 f0             	push   -0x10(%ebp)
+  8035e1:	e8 43 e4 ff ff       	call   801a29 <fd2data>
+  8035e6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8035ed:	50                   	push   %eax
+  8035ee:	6a 00                	push   $0x0
+  8035f0:	56                   	push   %esi
+  8035f1:	6a 00                	push   $0x0
+  8035f3:	e8 89 d9 ff ff       	call   800f81 <sys_page_map>
+  8035f8:	89 c3                	mov    %eax,%ebx
+  8035fa:	83 c4 20             	add    $0x20,%esp
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	78 4e                	js     80364f <pipe+0x113>
+  803601:	a1 3c 70 80 00       	mov    0x80703c,%eax
+  803606:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803609:	89 02                	mov    %eax,(%edx)
+  80360b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80360e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803615:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803618:	89 02                	mov    %eax,(%edx)
+  80361a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80361d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803624:	83 ec 0c             	sub    $0xc,%esp
+  803627:	ff 75 f4             	push   -0xc(%ebp)
+  80362a:	e8 ea e3 ff ff       	call   801a19 <fd2num>
+  80362f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803632:	89 01                	mov    %eax,(%ecx)
+  803634:	83 c4 04             	add    $0x4,%esp
+  803637:	ff 75 f0             	push   -0x10(%ebp)
+  80363a:	e8 da e3 ff ff       	call   801a19 <fd2num>
+  80363f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803642:	89 41 04             	mov    %eax,0x4(%ecx)
+  803645:	83 c4 10             	add    $0x10,%esp
+  803648:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80364d:	eb 2e                	jmp    80367d <pipe+0x141>
+  80364f:	83 ec 08             	sub    $0x8,%esp
+  803652:	56                   	push   %esi
+  803653:	6a 00                	push   $0x0
+  803655:	e8 b6 d9 ff ff       	call   801010 <sys_page_unmap>
+  80365a:	83 c4 10             	add    $0x10,%esp
+  80365d:	83 ec 08             	sub    $0x8,%esp
+  803660:	ff 75 f0             	push   -0x10(%ebp)
+  803663:	6a 00                	push   $0x0
+  803665:	e8 a6 d9 ff ff       	call   801010 <sys_page_unmap>
+  80366a:	83 c4 10             	add    $0x10,%esp
+  80366d:	83 ec 08             	sub    $0x8,%esp
+  803670:	ff 75 f4             	push   -0xc(%ebp)
+  803673:	6a 00                	push   $0x0
+  803675:	e8 96 d9 ff ff       	call   801010 <sys_page_unmap>
+  80367a:	83 c4 10             	add    $0x10,%esp
+  80367d:	89 d8                	mov    %ebx,%eax
+  80367f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803682:	5b                   	pop    %ebx
+  803683:	5e                   	pop    %esi
+  803684:	5d                   	pop    %ebp
+  803685:	c3                   	ret
+
+00803686 <pipeisclosed>:
+  803686:	55                   	push   %ebp
+  803687:	89 e5                	mov    %esp,%ebp
+  803689:	83 ec 20             	sub    $0x20,%esp
+  80368c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80368f:	50                   	push   %eax
+  803690:	ff 75 08             	push   0x8(%ebp)
+  803693:	e8 f8 e3 ff ff       	call   801a90 <fd_lookup>
+  803698:	83 c4 10             	add    $0x10,%esp
+  80369b:	85 c0                	test   %eax,%eax
+  80369d:	78 18                	js     8036b7 <pipeisclosed+0x31>
+  80369f:	83 ec 0c             	sub    $0xc,%esp
+  8036a2:	ff 75 f4             	push   -0xc(%ebp)
+  8036a5:	e8 7f e3 ff ff       	call   801a29 <fd2data>
+  8036aa:	89 c2                	mov    %eax,%edx
+  8036ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036af:	e8 16 fd ff ff       	call   8033ca <_pipeisclosed>
+  8036b4:	83 c4 10             	add    $0x10,%esp
+  8036b7:	c9                   	leave
+  8036b8:	c3                   	ret
+
+008036b9 <wait>:
+  8036b9:	55                   	push   %ebp
+  8036ba:	89 e5                	mov    %esp,%ebp
+  8036bc:	56                   	push   %esi
+  8036bd:	53                   	push   %ebx
+  8036be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036c1:	85 f6                	test   %esi,%esi
+  8036c3:	74 40                	je     803705 <wait+0x4c>
+  8036c5:	89 f3                	mov    %esi,%ebx
+  8036c7:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8036cd:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  8036d3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8036db:	39 c6                	cmp    %eax,%esi
+  8036dd:	75 1f                	jne    8036fe <wait+0x45>
+  8036df:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  8036e5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8036eb:	8b 43 54             	mov    0x54(%ebx),%eax
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	74 0c                	je     8036fe <wait+0x45>
+  8036f2:	e8 fc d7 ff ff       	call   800ef3 <sys_yield>
+  8036f7:	8b 43 48             	mov    0x48(%ebx),%eax
+  8036fa:	39 f0                	cmp    %esi,%eax
+  8036fc:	74 ed                	je     8036eb <wait+0x32>
+  8036fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803701:	5b                   	pop    %ebx
+  803702:	5e                   	pop    %esi
+  803703:	5d                   	pop    %ebp
+  803704:	c3                   	ret
+  803705:	68 62 49 80 00       	push   $0x804962
+  80370a:	68 77 48 80 00       	push   $0x804877
+  80370f:	6a 09                	push   $0x9
+  803711:	68 6d 49 80 00       	push   $0x80496d
+  803716:	e8 f1 cb ff ff       	call   80030c <_panic>
+
+0080371b <ipcring_init>:
+  80371b:	55                   	push   %ebp
+  80371c:	89 e5                	mov    %esp,%ebp
+  80371e:	53                   	push   %ebx
+  80371f:	83 ec 08             	sub    $0x8,%esp
+  803722:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803725:	6a 60                	push   $0x60
+  803727:	6a 00                	push   $0x0
+  803729:	53                   	push   %ebx
+  80372a:	e8 2a d5 ff ff       	call   800c59 <memset>
+  80372f:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  803734:	8b 40 48             	mov    0x48(%eax),%eax
+  803737:	89 03                	mov    %eax,(%ebx)
+  803739:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80373c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80373f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803742:	89 43 08             	mov    %eax,0x8(%ebx)
+  803745:	8b 45 14             	mov    0x14(%ebp),%eax
+  803748:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80374b:	83 c4 10             	add    $0x10,%esp
+  80374e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803751:	c9                   	leave
+  803752:	c3                   	ret
+
+00803753 <ipcring_req_slot>:
+  803753:	55                   	push   %ebp
+  803754:	89 e5                	mov    %esp,%ebp
+  803756:	8b 45 08             	mov    0x8(%ebp),%eax
+  803759:	8b 50 10             	mov    0x10(%eax),%edx
+  80375c:	8b 48 18             	mov    0x18(%eax),%ecx
+  80375f:	29 ca                	sub    %ecx,%edx
+  803761:	83 fa 07             	cmp    $0x7,%edx
+  803764:	77 0c                	ja     803772 <ipcring_req_slot+0x1f>
+  803766:	8b 50 10             	mov    0x10(%eax),%edx
+  803769:	83 e2 07             	and    $0x7,%edx
+  80376c:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803770:	5d                   	pop    %ebp
+  803771:	c3                   	ret
+  803772:	b8 00 00 00 00       	mov    $0x0,%eax
+  803777:	eb f7                	jmp    803770 <ipcring_req_slot+0x1d>
+
+00803779 <ipcring_req_push>:
+  803779:	55                   	push   %ebp
+  80377a:	89 e5                	mov    %esp,%ebp
+  80377c:	83 ec 08             	sub    $0x8,%esp
+  80377f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803782:	8b 42 10             	mov    0x10(%edx),%eax
+  803785:	83 c0 01             	add    $0x1,%eax
+  803788:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803791:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803795:	85 c0                	test   %eax,%eax
+  803797:	75 02                	jne    80379b <ipcring_req_push+0x22>
+  803799:	c9                   	leave
+  80379a:	c3                   	ret
+  80379b:	6a 00                	push   $0x0
+  80379d:	68 00 00 80 ee       	push   $0xee800000
+  8037a2:	ff 72 08             	push   0x8(%edx)
+  8037a5:	ff 72 04             	push   0x4(%edx)
+  8037a8:	e8 c9 da ff ff       	call   801276 <sys_ipc_send>
+  8037ad:	83 c4 10             	add    $0x10,%esp
+  8037b0:	eb e7                	jmp    803799 <ipcring_req_push+0x20>
+
+008037b2 <ipcring_rsp_wait>:
+  8037b2:	55                   	push   %ebp
+  8037b3:	89 e5                	mov    %esp,%ebp
+  8037b5:	53                   	push   %ebx
+  8037b6:	83 ec 04             	sub    $0x4,%esp
+  8037b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8037bc:	8b 53 18             	mov    0x18(%ebx),%edx
+  8037bf:	8b 43 10             	mov    0x10(%ebx),%eax
+  8037c2:	39 c2                	cmp    %eax,%edx
+  8037c4:	74 3c                	je     803802 <ipcring_rsp_wait+0x50>
+  8037c6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8037c9:	8b 43 18             	mov    0x18(%ebx),%eax
+  8037cc:	39 c2                	cmp    %eax,%edx
+  8037ce:	75 23                	jne    8037f3 <ipcring_rsp_wait+0x41>
+  8037d0:	83 ec 08             	sub    $0x8,%esp
+  8037d3:	6a 00                	push   $0x0
+  8037d5:	6a 00                	push   $0x0
+  8037d7:	6a 00                	push   $0x0
+  8037d9:	6a 00                	push   $0x0
+  8037db:	ff 73 0c             	push   0xc(%ebx)
+  8037de:	ff 73 04             	push   0x4(%ebx)
+  8037e1:	e8 7e e0 ff ff       	call   801864 <ipc_call>
+  8037e6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8037e9:	8b 43 18             	mov    0x18(%ebx),%eax
+  8037ec:	83 c4 20             	add    $0x20,%esp
+  8037ef:	39 c2                	cmp    %eax,%edx
+  8037f1:	74 dd                	je     8037d0 <ipcring_rsp_wait+0x1e>
+  8037f3:	8b 43 18             	mov    0x18(%ebx),%eax
+  8037f6:	83 e0 07             	and    $0x7,%eax
+  8037f9:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8037fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803800:	c9                   	leave
+  803801:	c3                   	ret
+  803802:	68 78 49 80 00       	push   $0x804978
+  803807:	68 77 48 80 00       	push   $0x804877
+  80380c:	6a 3b                	push   $0x3b
+  80380e:	68 99 49 80 00       	push   $0x804999
+  803813:	e8 f4 ca ff ff       	call   80030c <_panic>
+
+00803818 <ipcring_rsp_pop>:
+  803818:	55                   	push   %ebp
+  803819:	89 e5                	mov    %esp,%ebp
+  80381b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80381e:	8b 42 18             	mov    0x18(%edx),%eax
+  803821:	83 c0 01             	add    $0x1,%eax
+  803824:	89 42 18             	mov    %eax,0x18(%edx)
+  803827:	5d                   	pop    %ebp
+  803828:	c3                   	ret
+
+00803829 <ipcring_server_init>:
+  803829:	55                   	push   %ebp
+  80382a:	89 e5                	mov    %esp,%ebp
+  80382c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80382f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803832:	89 10                	mov    %edx,(%eax)
+  803834:	8b 55 10             	mov    0x10(%ebp),%edx
+  803837:	89 50 04             	mov    %edx,0x4(%eax)
+  80383a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803841:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803848:	5d                   	pop    %ebp
+  803849:	c3                   	ret
+
+0080384a <ipcring_req_avail>:
+  80384a:	55                   	push   %ebp
+  80384b:	89 e5                	mov    %esp,%ebp
+  80384d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803850:	8b 02                	mov    (%edx),%eax
+  803852:	8b 40 10             	mov    0x10(%eax),%eax
+  803855:	2b 42 08             	sub    0x8(%edx),%eax
+  803858:	ba 08 00 00 00       	mov    $0x8,%edx
+  80385d:	39 d0                	cmp    %edx,%eax
+  80385f:	0f 47 c2             	cmova  %edx,%eax
+  803862:	5d                   	pop    %ebp
+  803863:	c3                   	ret
+
+00803864 <ipcring_req_peek>:
+  803864:	55                   	push   %ebp
+  803865:	89 e5                	mov    %esp,%ebp
+  803867:	8b 55 08             	mov    0x8(%ebp),%edx
+  80386a:	8b 42 08             	mov    0x8(%edx),%eax
+  80386d:	83 e0 07             	and    $0x7,%eax
+  803870:	8b 12                	mov    (%edx),%edx
+  803872:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803876:	5d                   	pop    %ebp
+  803877:	c3                   	ret
+
+00803878 <ipcring_rsp_push>:
+  803878:	55                   	push   %ebp
+  803879:	89 e5                	mov    %esp,%ebp
+  80387b:	83 ec 08             	sub    $0x8,%esp
+  80387e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803881:	8b 41 08             	mov    0x8(%ecx),%eax
+  803884:	83 c0 01             	add    $0x1,%eax
+  803887:	89 41 08             	mov    %eax,0x8(%ecx)
+  80388a:	8b 11                	mov    (%ecx),%edx
+  80388c:	83 c2 14             	add    $0x14,%edx
+  80388f:	f0 87 02             	lock xchg %eax,(%edx)
+  803892:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803896:	75 02                	jne    80389a <ipcring_rsp_push+0x22>
+  803898:	c9                   	leave
+  803899:	c3                   	ret
+  80389a:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8038a1:	6a 00                	push   $0x0
+  8038a3:	68 00 00 80 ee       	push   $0xee800000
+  8038a8:	6a 00                	push   $0x0
+  8038aa:	ff 71 04             	push   0x4(%ecx)
+  8038ad:	e8 e7 d8 ff ff       	call   801199 <sys_ipc_try_send>
+  8038b2:	83 c4 10             	add    $0x10,%esp
+  8038b5:	eb e1                	jmp    803898 <ipcring_rsp_push+0x20>
+
+008038b7 <ipcring_client_wait>:
+  8038b7:	55                   	push   %ebp
+  8038b8:	89 e5                	mov    %esp,%ebp
+  8038ba:	83 ec 08             	sub    $0x8,%esp
+  8038bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038c0:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8038c7:	8b 10                	mov    (%eax),%edx
+  8038c9:	8b 52 18             	mov    0x18(%edx),%edx
+  8038cc:	3b 50 08             	cmp    0x8(%eax),%edx
+  8038cf:	75 02                	jne    8038d3 <ipcring_client_wait+0x1c>
+  8038d1:	c9                   	leave
+  8038d2:	c3                   	ret
+  8038d3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8038da:	6a 00                	push   $0x0
+  8038dc:	68 00 00 80 ee       	push   $0xee800000
+  8038e1:	6a 00                	push   $0x0
+  8038e3:	ff 70 04             	push   0x4(%eax)
+  8038e6:	e8 ae d8 ff ff       	call   801199 <sys_ipc_try_send>
+  8038eb:	83 c4 10             	add    $0x10,%esp
+  8038ee:	eb e1                	jmp    8038d1 <ipcring_client_wait+0x1a>
+
+008038f0 <ipcring_server_sleep>:
+  8038f0:	55                   	push   %ebp
+  8038f1:	89 e5                	mov    %esp,%ebp
+  8038f3:	53                   	push   %ebx
+  8038f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038f7:	8b 01                	mov    (%ecx),%eax
+  8038f9:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8038fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  803901:	f0 87 02             	lock xchg %eax,(%edx)
+  803904:	8b 11                	mov    (%ecx),%edx
+  803906:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803909:	b8 01 00 00 00       	mov    $0x1,%eax
+  80390e:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803911:	74 0e                	je     803921 <ipcring_server_sleep+0x31>
+  803913:	b8 00 00 00 00       	mov    $0x0,%eax
+  803918:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80391c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803921:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803924:	c9                   	leave
+  803925:	c3                   	ret
+
+00803926 <devcons_close>:
+  803926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392b:	c3                   	ret
+
+0080392c <devcons_stat>:
+  80392c:	55                   	push   %ebp
+  80392d:	89 e5                	mov    %esp,%ebp
+  80392f:	83 ec 10             	sub    $0x10,%esp
+  803932:	68 a7 49 80 00       	push   $0x8049a7
+  803937:	ff 75 0c             	push   0xc(%ebp)
+  80393a:	e8 9f d1 ff ff       	call   800ade <strcpy>
+  80393f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803944:	c9                   	leave
+  803945:	c3                   	ret
+
+00803946 <devcons_write>:
+  803946:	55                   	push   %ebp
+  803947:	89 e5                	mov    %esp,%ebp
+  803949:	57                   	push   %edi
+  80394a:	56                   	push   %esi
+  80394b:	53                   	push   %ebx
+  80394c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803952:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803955:	85 ff                	test   %edi,%edi
+  803957:	74 51                	je     8039aa <devcons_write+0x64>
+  803959:	be 00 00 00 00       	mov    $0x0,%esi
+  80395e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803963:	89 fb                	mov    %edi,%ebx
+  803965:	29 c3                	sub    %eax,%ebx
+  803967:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80396c:	39 d3                	cmp    %edx,%ebx
+  80396e:	0f 47 da             	cmova  %edx,%ebx
+  803971:	83 ec 04             	sub    $0x4,%esp
+  803974:	53                   	push   %ebx
+  803975:	03 45 0c             	add    0xc(%ebp),%eax
+  803978:	50                   	push   %eax
+  803979:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80397f:	50                   	push   %eax
+  803980:	e8 09 d3 ff ff       	call   800c8e <memmove>
+  803985:	83 c4 08             	add    $0x8,%esp
+  803988:	53                   	push   %ebx
+  803989:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80398f:	50                   	push   %eax
+  803990:	e8 c1 d4 ff ff       	call   800e56 <sys_cputs>
+  803995:	01 de                	add    %ebx,%esi
+  803997:	89 f0                	mov    %esi,%eax
+  803999:	83 c4 10             	add    $0x10,%esp
+  80399c:	39 fe                	cmp    %edi,%esi
+  80399e:	72 c3                	jb     803963 <devcons_write+0x1d>
+  8039a0:	89 f0                	mov    %esi,%eax
+  8039a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039a5:	5b                   	pop    %ebx
+  8039a6:	5e                   	pop    %esi
+  8039a7:	5f                   	pop    %edi
+  8039a8:	5d                   	pop    %ebp
+  8039a9:	c3                   	ret
+  8039aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8039af:	eb ef                	jmp    8039a0 <devcons_write+0x5a>
+
+008039b1 <devcons_read>:
+  8039b1:	55                   	push   %ebp
+  8039b2:	89 e5                	mov    %esp,%ebp
+  8039b4:	83 ec 08             	sub    $0x8,%esp
+  8039b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039bc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039c0:	75 07                	jne    8039c9 <devcons_read+0x18>
+  8039c2:	eb 1f                	jmp    8039e3 <devcons_read+0x32>
+  8039c4:	e8 2a d5 ff ff       	call   800ef3 <sys_yield>
+  8039c9:	e8 a6 d4 ff ff       	call   800e74 <sys_cgetc>
+  8039ce:	85 c0                	test   %eax,%eax
+  8039d0:	74 f2                	je     8039c4 <devcons_read+0x13>
+  8039d2:	78 0f                	js     8039e3 <devcons_read+0x32>
+  8039d4:	83 f8 04             	cmp    $0x4,%eax
+  8039d7:	74 0c                	je     8039e5 <devcons_read+0x34>
+  8039d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039dc:	88 02                	mov    %al,(%edx)
+  8039de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039e3:	c9                   	leave
+  8039e4:	c3                   	ret
+  8039e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ea:	eb f7                	jmp    8039e3 <devcons_read+0x32>
+
+008039ec <cputchar>:
+  8039ec:	55                   	push   %ebp
+  8039ed:	89 e5                	mov    %esp,%ebp
+  8039ef:	83 ec 20             	sub    $0x20,%esp
+  8039f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039f5:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8039f8:	6a 01                	push   $0x1
+  8039fa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8039fd:	50                   	push   %eax
+  8039fe:	e8 53 d4 ff ff       	call   800e56 <sys_cputs>
+  803a03:	83 c4 10             	add    $0x10,%esp
+  803a06:	c9                   	leave
+  803a07:	c3                   	ret
+
+00803a08 <getchar>:
+  803a08:	55                   	push   %ebp
+  803a09:	89 e5                	mov    %esp,%ebp
+  803a0b:	83 ec 1c             	sub    $0x1c,%esp
+  803a0e:	6a 01                	push   $0x1
+  803a10:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a13:	50                   	push   %eax
+  803a14:	6a 00                	push   $0x0
+  803a16:	e8 d7 e2 ff ff       	call   801cf2 <read>
+  803a1b:	83 c4 10             	add    $0x10,%esp
+  803a1e:	85 c0                	test   %eax,%eax
+  803a20:	78 06                	js     803a28 <getchar+0x20>
+  803a22:	74 06                	je     803a2a <getchar+0x22>
+  803a24:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803a28:	c9                   	leave
+  803a29:	c3                   	ret
+  803a2a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803a2f:	eb f7                	jmp    803a28 <getchar+0x20>
+
+00803a31 <iscons>:
+  803a31:	55                   	push   %ebp
+  803a32:	89 e5                	mov    %esp,%ebp
+  803a34:	83 ec 20             	sub    $0x20,%esp
+  803a37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a3a:	50                   	push   %eax
+  803a3b:	ff 75 08             	push   0x8(%ebp)
+  803a3e:	e8 4d e0 ff ff       	call   801a90 <fd_lookup>
+  803a43:	83 c4 10             	add    $0x10,%esp
+  803a46:	85 c0                	test   %eax,%eax
+  803a48:	78 11                	js     803a5b <iscons+0x2a>
+  803a4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a4d:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  803a53:	39 10                	cmp    %edx,(%eax)
+  803a55:	0f 94 c0             	sete   %al
+  803a58:	0f b6 c0             	movzbl %al,%eax
+  803a5b:	c9                   	leave
+  803a5c:	c3                   	ret
+
+00803a5d <opencons>:
+  803a5d:	55                   	push   %ebp
+  803a5e:	89 e5                	mov    %esp,%ebp
+  803a60:	83 ec 24             	sub    $0x24,%esp
+  803a63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a66:	50                   	push   %eax
+  803a67:	e8 d4 df ff ff       	call   801a40 <fd_alloc>
+  803a6c:	83 c4 10             	add    $0x10,%esp
+  803a6f:	85 c0                	test   %eax,%eax
+  803a71:	78 3a                	js     803aad <opencons+0x50>
+  803a73:	83 ec 04             	sub    $0x4,%esp
+  803a76:	68 07 04 00 00       	push   $0x407
+  803a7b:	ff 75 f4             	push   -0xc(%ebp)
+  803a7e:	6a 00                	push   $0x0
+  803a80:	e8 b9 d4 ff ff       	call   800f3e <sys_page_alloc>
+  803a85:	83 c4 10             	add    $0x10,%esp
+  803a88:	85 c0                	test   %eax,%eax
+  803a8a:	78 21                	js     803aad <opencons+0x50>
+  803a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a8f:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  803a95:	89 10                	mov    %edx,(%eax)
+  803a97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a9a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803aa1:	83 ec 0c             	sub    $0xc,%esp
+  803aa4:	50                   	push   %eax
+  803aa5:	e8 6f df ff ff       	call   801a19 <fd2num>
+  803aaa:	83 c4 10             	add    $0x10,%esp
+  803aad:	c9                   	leave
+  803aae:	c3                   	ret
+
+00803aaf <dupq_flush>:
+  803aaf:	55                   	push   %ebp
+  803ab0:	89 e5                	mov    %esp,%ebp
+  803ab2:	53                   	push   %ebx
+  803ab3:	83 ec 0c             	sub    $0xc,%esp
+  803ab6:	8b 1d 10 80 80 00    	mov    0x808010,%ebx
+  803abc:	c7 05 10 80 80 00 00 	movl   $0x0,0x808010
+  803ac3:	00 00 00 
+  803ac6:	53                   	push   %ebx
+  803ac7:	68 00 00 40 00       	push   $0x400000
+  803acc:	e8 f4 db ff ff       	call   8016c5 <sys_batch>
+  803ad1:	83 c4 10             	add    $0x10,%esp
+  803ad4:	85 c0                	test   %eax,%eax
+  803ad6:	78 14                	js     803aec <dupq_flush+0x3d>
+  803ad8:	39 c3                	cmp    %eax,%ebx
+  803ada:	7e 0b                	jle    803ae7 <dupq_flush+0x38>
+  803adc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803adf:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  803ae5:	eb 05                	jmp    803aec <dupq_flush+0x3d>
+  803ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803aef:	c9                   	leave
+  803af0:	c3                   	ret
+
+00803af1 <pgfault>:
+  803af1:	55                   	push   %ebp
+  803af2:	89 e5                	mov    %esp,%ebp
+  803af4:	56                   	push   %esi
+  803af5:	53                   	push   %ebx
+  803af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803af9:	8b 30                	mov    (%eax),%esi
+  803afb:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  803aff:	0f 84 83 00 00 00    	je     803b88 <pgfault+0x97>
+  803b05:	89 f0                	mov    %esi,%eax
+  803b07:	c1 e8 0c             	shr    $0xc,%eax
+  803b0a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b11:	f6 c4 08             	test   $0x8,%ah
+  803b14:	0f 84 80 00 00 00    	je     803b9a <pgfault+0xa9>
+  803b1a:	e8 b5 d3 ff ff       	call   800ed4 <sys_getenvid>
+  803b1f:	89 c3                	mov    %eax,%ebx
+  803b21:	83 ec 04             	sub    $0x4,%esp
+  803b24:	6a 07                	push   $0x7
+  803b26:	68 00 f0 7f 00       	push   $0x7ff000
+  803b2b:	50                   	push   %eax
+  803b2c:	e8 0d d4 ff ff       	call   800f3e <sys_page_alloc>
+  803b31:	83 c4 10             	add    $0x10,%esp
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	78 74                	js     803bac <pgfault+0xbb>
+  803b38:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803b3e:	83 ec 04             	sub    $0x4,%esp
+  803b41:	68 00 10 00 00       	push   $0x1000
+  803b46:	56                   	push   %esi
+  803b47:	68 00 f0 7f 00       	push   $0x7ff000
+  803b4c:	e8 3d d1 ff ff       	call   800c8e <memmove>
+  803b51:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803b58:	56                   	push   %esi
+  803b59:	53                   	push   %ebx
+  803b5a:	68 00 f0 7f 00       	push   $0x7ff000
+  803b5f:	53                   	push   %ebx
+  803b60:	e8 1c d4 ff ff       	call   800f81 <sys_page_map>
+  803b65:	83 c4 20             	add    $0x20,%esp
+  803b68:	85 c0                	test   %eax,%eax
+  803b6a:	78 54                	js     803bc0 <pgfault+0xcf>
+  803b6c:	83 ec 08             	sub    $0x8,%esp
+  803b6f:	68 00 f0 7f 00       	push   $0x7ff000
+  803b74:	53                   	push   %ebx
+  803b75:	e8 96 d4 ff ff       	call   801010 <sys_page_unmap>
+  803b7a:	83 c4 10             	add    $0x10,%esp
+  803b7d:	85 c0                	test   %eax,%eax
+  803b7f:	78 53                	js     803bd4 <pgfault+0xe3>
+  803b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b84:	5b                   	pop    %ebx
+  803b85:	5e                   	pop    %esi
+  803b86:	5d                   	pop    %ebp
+  803b87:	c3                   	ret
+  803b88:	56                   	push   %esi
+  803b89:	68 b4 49 80 00       	push   $0x8049b4
+  803b8e:	6a 19                	push   $0x19
+  803b90:	68 90 4a 80 00       	push   $0x804a90
+  803b95:	e8 72 c7 ff ff       	call   80030c <_panic>
+  803b9a:	56                   	push   %esi
+  803b9b:	68 e8 49 80 00       	push   $0x8049e8
+  803ba0:	6a 1e                	push   $0x1e
+  803ba2:	68 90 4a 80 00       	push   $0x804a90
+  803ba7:	e8 60 c7 ff ff       	call   80030c <_panic>
+  803bac:	83 ec 04             	sub    $0x4,%esp
+  803baf:	68 1c 4a 80 00       	push   $0x804a1c
+  803bb4:	6a 2e                	push   $0x2e
+  803bb6:	68 90 4a 80 00       	push   $0x804a90
+  803bbb:	e8 4c c7 ff ff       	call   80030c <_panic>
+  803bc0:	83 ec 04             	sub    $0x4,%esp
+  803bc3:	68 40 4a 80 00       	push   $0x804a40
+  803bc8:	6a 37                	push   $0x37
+  803bca:	68 90 4a 80 00       	push   $0x804a90
+  803bcf:	e8 38 c7 ff ff       	call   80030c <_panic>
+  803bd4:	83 ec 04             	sub    $0x4,%esp
+  803bd7:	68 6c 4a 80 00       	push   $0x804a6c
+  803bdc:	6a 3c                	push   $0x3c
+  803bde:	68 90 4a 80 00       	push   $0x804a90
+  803be3:	e8 24 c7 ff ff       	call   80030c <_panic>
+
+00803be8 <dupq_begin>:
+  803be8:	55                   	push   %ebp
+  803be9:	89 e5                	mov    %esp,%ebp
+  803beb:	83 ec 0c             	sub    $0xc,%esp
+  803bee:	c7 05 10 80 80 00 00 	movl   $0x0,0x808010
+  803bf5:	00 00 00 
+  803bf8:	6a 07                	push   $0x7
+  803bfa:	68 00 00 40 00       	push   $0x400000
+  803bff:	6a 00                	push   $0x0
+  803c01:	e8 38 d3 ff ff       	call   800f3e <sys_page_alloc>
+  803c06:	c9                   	leave
+  803c07:	c3                   	ret
+
+00803c08 <dupq_map>:
+  803c08:	55                   	push   %ebp
+  803c09:	89 e5                	mov    %esp,%ebp
+  803c0b:	83 ec 08             	sub    $0x8,%esp
+  803c0e:	81 3d 10 80 80 00 92 	cmpl   $0x92,0x808010
+  803c15:	00 00 00 
+  803c18:	74 46                	je     803c60 <dupq_map+0x58>
+  803c1a:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803c20:	8d 42 01             	lea    0x1(%edx),%eax
+  803c23:	a3 10 80 80 00       	mov    %eax,0x808010
+  803c28:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803c2b:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  803c31:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  803c38:	00 00 00 
+  803c3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  803c3e:	89 50 04             	mov    %edx,0x4(%eax)
+  803c41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c44:	c1 e2 0c             	shl    $0xc,%edx
+  803c47:	89 50 08             	mov    %edx,0x8(%eax)
+  803c4a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  803c4d:	89 48 0c             	mov    %ecx,0xc(%eax)
+  803c50:	89 50 10             	mov    %edx,0x10(%eax)
+  803c53:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c56:	89 50 14             	mov    %edx,0x14(%eax)
+  803c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5e:	c9                   	leave
+  803c5f:	c3                   	ret
+  803c60:	e8 4a fe ff ff       	call   803aaf <dupq_flush>
+  803c65:	85 c0                	test   %eax,%eax
+  803c67:	79 b1                	jns    803c1a <dupq_map+0x12>
+  803c69:	eb f3                	jmp    803c5e <dupq_map+0x56>
+
+00803c6b <dupq_end>:
+  803c6b:	55                   	push   %ebp
+  803c6c:	89 e5                	mov    %esp,%ebp
+  803c6e:	53                   	push   %ebx
+  803c6f:	83 ec 04             	sub    $0x4,%esp
+  803c72:	e8 38 fe ff ff       	call   803aaf <dupq_flush>
+  803c77:	89 c3                	mov    %eax,%ebx
+  803c79:	83 ec 08             	sub    $0x8,%esp
+  803c7c:	68 00 00 40 00       	push   $0x400000
+  803c81:	6a 00                	push   $0x0
+  803c83:	e8 88 d3 ff ff       	call   801010 <sys_page_unmap>
+  803c88:	89 d8                	mov    %ebx,%eax
+  803c8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c8d:	c9                   	leave
+  803c8e:	c3                   	ret
+
+00803c8f <fork>:
+  803c8f:	55                   	push   %ebp
+  803c90:	89 e5                	mov    %esp,%ebp
+  803c92:	53                   	push   %ebx
+  803c93:	83 ec 10             	sub    $0x10,%esp
+  803c96:	68 f1 3a 80 00       	push   $0x803af1
+  803c9b:	e8 82 03 00 00       	call   804022 <set_pgfault_handler>
+  803ca0:	83 c4 08             	add    $0x8,%esp
+  803ca3:	6a 01                	push   $0x1
+  803ca5:	6a 00                	push   $0x0
+  803ca7:	e8 49 d4 ff ff       	call   8010f5 <sys_env_set_cow>
+  803cac:	e8 a1 d3 ff ff       	call   801052 <sys_fork>
+  803cb1:	89 c3                	mov    %eax,%ebx
+  803cb3:	83 c4 10             	add    $0x10,%esp
+  803cb6:	85 c0                	test   %eax,%eax
+  803cb8:	74 07                	je     803cc1 <fork+0x32>
+  803cba:	89 d8                	mov    %ebx,%eax
+  803cbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cbf:	c9                   	leave
+  803cc0:	c3                   	ret
+  803cc1:	e8 0e d2 ff ff       	call   800ed4 <sys_getenvid>
+  803cc6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ccb:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  803cd1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803cd6:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  803cdb:	eb dd                	jmp    803cba <fork+0x2b>
+
+00803cdd <sfork>:
+  803cdd:	55                   	push   %ebp
+  803cde:	89 e5                	mov    %esp,%ebp
+  803ce0:	57                   	push   %edi
+  803ce1:	56                   	push   %esi
+  803ce2:	53                   	push   %ebx
+  803ce3:	83 ec 1c             	sub    $0x1c,%esp
+  803ce6:	e8 e9 d1 ff ff       	call   800ed4 <sys_getenvid>
+  803ceb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803cee:	83 ec 0c             	sub    $0xc,%esp
+  803cf1:	68 f1 3a 80 00       	push   $0x803af1
+  803cf6:	e8 27 03 00 00       	call   804022 <set_pgfault_handler>
+  803cfb:	b8 07 00 00 00       	mov    $0x7,%eax
+  803d00:	cd 30                	int    $0x30
+  803d02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803d05:	83 c4 10             	add    $0x10,%esp
+  803d08:	85 c0                	test   %eax,%eax
+  803d0a:	0f 88 45 02 00 00    	js     803f55 <sfork+0x278>
+  803d10:	89 c6                	mov    %eax,%esi
+  803d12:	74 17                	je     803d2b <sfork+0x4e>
+  803d14:	e8 cf fe ff ff       	call   803be8 <dupq_begin>
+  803d19:	85 c0                	test   %eax,%eax
+  803d1b:	0f 88 40 02 00 00    	js     803f61 <sfork+0x284>
+  803d21:	bf 02 00 00 00       	mov    $0x2,%edi
+  803d26:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  803d29:	eb 39                	jmp    803d64 <sfork+0x87>
+  803d2b:	e8 a4 d1 ff ff       	call   800ed4 <sys_getenvid>
+  803d30:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803d35:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  803d3b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d40:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  803d45:	e9 23 01 00 00       	jmp    803e6d <sfork+0x190>
+  803d4a:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803d51:	a8 01                	test   $0x1,%al
+  803d53:	75 5b                	jne    803db0 <sfork+0xd3>
+  803d55:	83 c7 01             	add    $0x1,%edi
+  803d58:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  803d5e:	0f 84 40 01 00 00    	je     803ea4 <sfork+0x1c7>
+  803d64:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803d6b:	a8 01                	test   $0x1,%al
+  803d6d:	74 db                	je     803d4a <sfork+0x6d>
+  803d6f:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803d76:	a8 80                	test   $0x80,%al
+  803d78:	74 d0                	je     803d4a <sfork+0x6d>
+  803d7a:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  803d81:	25 07 0e 00 00       	and    $0xe07,%eax
+  803d86:	0c 80                	or     $0x80,%al
+  803d88:	50                   	push   %eax
+  803d89:	ff 75 e4             	push   -0x1c(%ebp)
+  803d8c:	89 f8                	mov    %edi,%eax
+  803d8e:	c1 e0 16             	shl    $0x16,%eax
+  803d91:	c1 e8 0c             	shr    $0xc,%eax
+  803d94:	50                   	push   %eax
+  803d95:	ff 75 e0             	push   -0x20(%ebp)
+  803d98:	e8 6b fe ff ff       	call   803c08 <dupq_map>
+  803d9d:	83 c4 10             	add    $0x10,%esp
+  803da0:	85 c0                	test   %eax,%eax
+  803da2:	79 b1                	jns    803d55 <sfork+0x78>
+  803da4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803dab:	e9 bd 00 00 00       	jmp    803e6d <sfork+0x190>
+  803db0:	89 fe                	mov    %edi,%esi
+  803db2:	c1 e6 16             	shl    $0x16,%esi
+  803db5:	89 f0                	mov    %esi,%eax
+  803db7:	c1 e8 0c             	shr    $0xc,%eax
+  803dba:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  803dbf:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803dc2:	eb 57                	jmp    803e1b <sfork+0x13e>
+  803dc4:	e8 0b d1 ff ff       	call   800ed4 <sys_getenvid>
+  803dc9:	89 c7                	mov    %eax,%edi
+  803dcb:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  803dd0:	f6 c4 04             	test   $0x4,%ah
+  803dd3:	0f 85 9f 00 00 00    	jne    803e78 <sfork+0x19b>
+  803dd9:	a9 02 08 00 00       	test   $0x802,%eax
+  803dde:	0f 85 c5 01 00 00    	jne    803fa9 <sfork+0x2cc>
+  803de4:	6a 05                	push   $0x5
+  803de6:	ff 75 e4             	push   -0x1c(%ebp)
+  803de9:	68 fd e7 0e 00       	push   $0xee7fd
+  803dee:	57                   	push   %edi
+  803def:	e8 14 fe ff ff       	call   803c08 <dupq_map>
+  803df4:	83 c4 10             	add    $0x10,%esp
+  803df7:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  803dfd:	0f 84 91 00 00 00    	je     803e94 <sfork+0x1b7>
+  803e03:	89 f0                	mov    %esi,%eax
+  803e05:	09 d8                	or     %ebx,%eax
+  803e07:	c1 e8 0c             	shr    $0xc,%eax
+  803e0a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803e10:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  803e15:	0f 84 81 00 00 00    	je     803e9c <sfork+0x1bf>
+  803e1b:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  803e20:	74 a2                	je     803dc4 <sfork+0xe7>
+  803e22:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803e29:	f6 c2 01             	test   $0x1,%dl
+  803e2c:	74 c9                	je     803df7 <sfork+0x11a>
+  803e2e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803e35:	f6 c6 02             	test   $0x2,%dh
+  803e38:	75 bd                	jne    803df7 <sfork+0x11a>
+  803e3a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803e41:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803e48:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  803e4e:	f7 d2                	not    %edx
+  803e50:	21 ca                	and    %ecx,%edx
+  803e52:	52                   	push   %edx
+  803e53:	ff 75 e4             	push   -0x1c(%ebp)
+  803e56:	50                   	push   %eax
+  803e57:	ff 75 e0             	push   -0x20(%ebp)
+  803e5a:	e8 a9 fd ff ff       	call   803c08 <dupq_map>
+  803e5f:	83 c4 10             	add    $0x10,%esp
+  803e62:	85 c0                	test   %eax,%eax
+  803e64:	79 91                	jns    803df7 <sfork+0x11a>
+  803e66:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803e6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e73:	5b                   	pop    %ebx
+  803e74:	5e                   	pop    %esi
+  803e75:	5f                   	pop    %edi
+  803e76:	5d                   	pop    %ebp
+  803e77:	c3                   	ret
+  803e78:	25 07 0e 00 00       	and    $0xe07,%eax
+  803e7d:	50                   	push   %eax
+  803e7e:	ff 75 e4             	push   -0x1c(%ebp)
+  803e81:	68 fd e7 0e 00       	push   $0xee7fd
+  803e86:	57                   	push   %edi
+  803e87:	e8 7c fd ff ff       	call   803c08 <dupq_map>
+  803e8c:	83 c4 10             	add    $0x10,%esp
+  803e8f:	e9 63 ff ff ff       	jmp    803df7 <sfork+0x11a>
+  803e94:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803e97:	e9 b9 fe ff ff       	jmp    803d55 <sfork+0x78>
+  803e9c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803e9f:	e9 b1 fe ff ff       	jmp    803d55 <sfork+0x78>
+  803ea4:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803ea7:	e8 bf fd ff ff       	call   803c6b <dupq_end>
+  803eac:	85 c0                	test   %eax,%eax
+  803eae:	0f 88 b9 00 00 00    	js     803f6d <sfork+0x290>
+  803eb4:	83 ec 04             	sub    $0x4,%esp
+  803eb7:	6a 07                	push   $0x7
+  803eb9:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ebe:	56                   	push   %esi
+  803ebf:	e8 7a d0 ff ff       	call   800f3e <sys_page_alloc>
+  803ec4:	83 c4 10             	add    $0x10,%esp
+  803ec7:	85 c0                	test   %eax,%eax
+  803ec9:	0f 88 aa 00 00 00    	js     803f79 <sfork+0x29c>
+  803ecf:	83 ec 0c             	sub    $0xc,%esp
+  803ed2:	6a 07                	push   $0x7
+  803ed4:	68 00 f0 7f 00       	push   $0x7ff000
+  803ed9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803edc:	57                   	push   %edi
+  803edd:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ee2:	56                   	push   %esi
+  803ee3:	e8 99 d0 ff ff       	call   800f81 <sys_page_map>
+  803ee8:	83 c4 20             	add    $0x20,%esp
+  803eeb:	85 c0                	test   %eax,%eax
+  803eed:	0f 88 92 00 00 00    	js     803f85 <sfork+0x2a8>
+  803ef3:	83 ec 04             	sub    $0x4,%esp
+  803ef6:	68 00 10 00 00       	push   $0x1000
+  803efb:	68 00 f0 7f 00       	push   $0x7ff000
+  803f00:	68 00 f0 7f ee       	push   $0xee7ff000
+  803f05:	e8 84 cd ff ff       	call   800c8e <memmove>
+  803f0a:	83 c4 08             	add    $0x8,%esp
+  803f0d:	68 00 f0 7f 00       	push   $0x7ff000
+  803f12:	57                   	push   %edi
+  803f13:	e8 f8 d0 ff ff       	call   801010 <sys_page_unmap>
+  803f18:	83 c4 10             	add    $0x10,%esp
+  803f1b:	85 c0                	test   %eax,%eax
+  803f1d:	78 72                	js     803f91 <sfork+0x2b4>
+  803f1f:	83 ec 08             	sub    $0x8,%esp
+  803f22:	68 9a 40 80 00       	push   $0x80409a
+  803f27:	56                   	push   %esi
+  803f28:	e8 2a d2 ff ff       	call   801157 <sys_env_set_pgfault_upcall>
+  803f2d:	83 c4 10             	add    $0x10,%esp
+  803f30:	85 c0                	test   %eax,%eax
+  803f32:	78 69                	js     803f9d <sfork+0x2c0>
+  803f34:	83 ec 08             	sub    $0x8,%esp
+  803f37:	6a 02                	push   $0x2
+  803f39:	56                   	push   %esi
+  803f3a:	e8 32 d1 ff ff       	call   801071 <sys_env_set_status>
+  803f3f:	83 c4 10             	add    $0x10,%esp
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803f49:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  803f4d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803f50:	e9 18 ff ff ff       	jmp    803e6d <sfork+0x190>
+  803f55:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803f5c:	e9 0c ff ff ff       	jmp    803e6d <sfork+0x190>
+  803f61:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803f68:	e9 00 ff ff ff       	jmp    803e6d <sfork+0x190>
+  803f6d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803f74:	e9 f4 fe ff ff       	jmp    803e6d <sfork+0x190>
+  803f79:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803f80:	e9 e8 fe ff ff       	jmp    803e6d <sfork+0x190>
+  803f85:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803f8c:	e9 dc fe ff ff       	jmp    803e6d <sfork+0x190>
+  803f91:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803f98:	e9 d0 fe ff ff       	jmp    803e6d <sfork+0x190>
+  803f9d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  803fa4:	e9 c4 fe ff ff       	jmp    803e6d <sfork+0x190>
+  803fa9:	68 05 08 00 00       	push   $0x805
+  803fae:	ff 75 e4             	push   -0x1c(%ebp)
+  803fb1:	68 fd e7 0e 00       	push   $0xee7fd
+  803fb6:	57                   	push   %edi
+  803fb7:	e8 4c fc ff ff       	call   803c08 <dupq_map>
+  803fbc:	83 c4 10             	add    $0x10,%esp
+  803fbf:	85 c0                	test   %eax,%eax
+  803fc1:	0f 88 30 fe ff ff    	js     803df7 <sfork+0x11a>
+  803fc7:	68 05 08 00 00       	push   $0x805
+  803fcc:	57                   	push   %edi
+  803fcd:	68 fd e7 0e 00       	push   $0xee7fd
+  803fd2:	57                   	push   %edi
+  803fd3:	e8 30 fc ff ff       	call   803c08 <dupq_map>
+  803fd8:	83 c4 10             	add    $0x10,%esp
+  803fdb:	e9 17 fe ff ff       	jmp    803df7 <sfork+0x11a>
+
+00803fe0 <pageref>:
+  803fe0:	55                   	push   %ebp
+  803fe1:	89 e5                	mov    %esp,%ebp
+  803fe3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fe6:	89 c2                	mov    %eax,%edx
+  803fe8:	c1 ea 16             	shr    $0x16,%edx
+  803feb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803ff2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ff7:	f6 c1 01             	test   $0x1,%cl
+  803ffa:	74 22                	je     80401e <pageref+0x3e>
+  803ffc:	c1 e8 0c             	shr    $0xc,%eax
+  803fff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804006:	a8 01                	test   $0x1,%al
+  804008:	74 14                	je     80401e <pageref+0x3e>
+  80400a:	c1 e8 0c             	shr    $0xc,%eax
+  80400d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  804010:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  804017:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80401b:	0f b7 d2             	movzwl %dx,%edx
+  80401e:	89 d0                	mov    %edx,%eax
+  804020:	5d                   	pop    %ebp
+  804021:	c3                   	ret
+
+00804022 <set_pgfault_handler>:
+  804022:	55                   	push   %ebp
+  804023:	89 e5                	mov    %esp,%ebp
+  804025:	53                   	push   %ebx
+  804026:	83 ec 04             	sub    $0x4,%esp
+  804029:	83 3d 00 f0 80 00 00 	cmpl   $0x0,0x80f000
+  804030:	74 0d                	je     80403f <set_pgfault_handler+0x1d>
+  804032:	8b 45 08             	mov    0x8(%ebp),%eax
+  804035:	a3 00 f0 80 00       	mov    %eax,0x80f000
+  80403a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80403d:	c9                   	leave
+  80403e:	c3                   	ret
+  80403f:	e8 90 ce ff ff       	call   800ed4 <sys_getenvid>
+  804044:	89 c3                	mov    %eax,%ebx
+  804046:	83 ec 04             	sub    $0x4,%esp
+  804049:	6a 07                	push   $0x7
+  80404b:	68 00 f0 7f ee       	push   $0xee7ff000
+  804050:	50                   	push   %eax
+  804051:	e8 e8 ce ff ff       	call   800f3e <sys_page_alloc>
+  804056:	83 c4 10             	add    $0x10,%esp
+  804059:	85 c0                	test   %eax,%eax
+  80405b:	78 29                	js     804086 <set_pgfault_handler+0x64>
+  80405d:	83 ec 08             	sub    $0x8,%esp
+  804060:	68 9a 40 80 00       	push   $0x80409a
+  804065:	53                   	push   %ebx
+  804066:	e8 ec d0 ff ff       	call   801157 <sys_env_set_pgfault_upcall>
+  80406b:	83 c4 10             	add    $0x10,%esp
+  80406e:	85 c0                	test   %eax,%eax
+  804070:	79 c0                	jns    804032 <set_pgfault_handler+0x10>
+  804072:	83 ec 04             	sub    $0x4,%esp
+  804075:	68 d4 4a 80 00       	push   $0x804ad4
+  80407a:	6a 27                	push   $0x27
+  80407c:	68 06 4b 80 00       	push   $0x804b06
+  804081:	e8 86 c2 ff ff       	call   80030c <_panic>
+  804086:	83 ec 04             	sub    $0x4,%esp
+  804089:	68 9c 4a 80 00       	push   $0x804a9c
+  80408e:	6a 23                	push   $0x23
+  804090:	68 06 4b 80 00       	push   $0x804b06
+  804095:	e8 72 c2 ff ff       	call   80030c <_panic>
+
+0080409a <_pgfault_upcall>:
+  80409a:	54                   	push   %esp
+  80409b:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  8040a0:	ff d0                	call   *%eax
+  8040a2:	83 c4 04             	add    $0x4,%esp
+  8040a5:	89 e3                	mov    %esp,%ebx
+  8040a7:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8040ab:	8b 54 24 30          	mov    0x30(%esp),%edx
+  8040af:	89 d4                	mov    %edx,%esp
+  8040b1:	51                   	push   %ecx
+  8040b2:	89 dc                	mov    %ebx,%esp
+  8040b4:	83 ea 04             	sub    $0x4,%edx
+  8040b7:	89 54 24 30          	mov    %edx,0x30(%esp)
+  8040bb:	83 c4 08             	add    $0x8,%esp
+  8040be:	61                   	popa
+  8040bf:	83 c4 04             	add    $0x4,%esp
+  8040c2:	9d                   	popf
+  8040c3:	5c                   	pop    %esp
+  8040c4:	c3                   	ret
+
+008040c5 <__udivmoddi4>:
+  8040c5:	55                   	push   %ebp
+  8040c6:	57                   	push   %edi
+  8040c7:	56                   	push   %esi
+  8040c8:	53                   	push   %ebx
+  8040c9:	83 ec 24             	sub    $0x24,%esp
+  8040cc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8040d0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8040d4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8040d8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8040dc:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8040e0:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8040e4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8040e8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8040ec:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8040f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040fa:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8040ff:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804106:	00 
+  804107:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80410e:	00 
+  80410f:	89 fb                	mov    %edi,%ebx
+  804111:	eb 08                	jmp    80411b <__udivmoddi4+0x56>
+  804113:	83 e9 01             	sub    $0x1,%ecx
+  804116:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804119:	74 68                	je     804183 <__udivmoddi4+0xbe>
+  80411b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80411f:	01 c0                	add    %eax,%eax
+  804121:	89 c6                	mov    %eax,%esi
+  804123:	89 d7                	mov    %edx,%edi
+  804125:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804129:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80412d:	0f ad d0             	shrd   %cl,%edx,%eax
+  804130:	d3 ea                	shr    %cl,%edx
+  804132:	f6 c1 20             	test   $0x20,%cl
+  804135:	74 04                	je     80413b <__udivmoddi4+0x76>
+  804137:	89 d0                	mov    %edx,%eax
+  804139:	31 d2                	xor    %edx,%edx
+  80413b:	83 e0 01             	and    $0x1,%eax
+  80413e:	89 04 24             	mov    %eax,(%esp)
+  804141:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804148:	00 
+  804149:	8b 04 24             	mov    (%esp),%eax
+  80414c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804150:	09 f0                	or     %esi,%eax
+  804152:	09 fa                	or     %edi,%edx
+  804154:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804158:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80415c:	39 f0                	cmp    %esi,%eax
+  80415e:	89 d5                	mov    %edx,%ebp
+  804160:	19 fd                	sbb    %edi,%ebp
+  804162:	72 af                	jb     804113 <__udivmoddi4+0x4e>
+  804164:	29 f0                	sub    %esi,%eax
+  804166:	19 fa                	sbb    %edi,%edx
+  804168:	89 cf                	mov    %ecx,%edi
+  80416a:	c1 ef 05             	shr    $0x5,%edi
+  80416d:	83 e7 01             	and    $0x1,%edi
+  804170:	89 fe                	mov    %edi,%esi
+  804172:	83 f6 01             	xor    $0x1,%esi
+  804175:	d3 e6                	shl    %cl,%esi
+  804177:	d3 e7                	shl    %cl,%edi
+  804179:	09 74 24 18          	or     %esi,0x18(%esp)
+  80417d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804181:	eb 90                	jmp    804113 <__udivmoddi4+0x4e>
+  804183:	85 db                	test   %ebx,%ebx
+  804185:	74 05                	je     80418c <__udivmoddi4+0xc7>
+  804187:	89 03                	mov    %eax,(%ebx)
+  804189:	89 53 04             	mov    %edx,0x4(%ebx)
+  80418c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804190:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804194:	83 c4 24             	add    $0x24,%esp
+  804197:	5b                   	pop    %ebx
+  804198:	5e                   	pop    %esi
+  804199:	5f                   	pop    %edi
+  80419a:	5d                   	pop    %ebp
+  80419b:	c3                   	ret
+
+0080419c <__udivdi3>:
+  80419c:	83 ec 08             	sub    $0x8,%esp
+  80419f:	6a 00                	push   $0x0
+  8041a1:	ff 74 24 1c          	push   0x1c(%esp)
+  8041a5:	ff 74 24 1c          	push   0x1c(%esp)
+  8041a9:	ff 74 24 1c          	push   0x1c(%esp)
+  8041ad:	ff 74 24 1c          	push   0x1c(%esp)
+  8041b1:	e8 0f ff ff ff       	call   8040c5 <__udivmoddi4>
+  8041b6:	83 c4 1c             	add    $0x1c,%esp
+  8041b9:	c3                   	ret
+
+008041ba <__umoddi3>:
+  8041ba:	83 ec 18             	sub    $0x18,%esp
+  8041bd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8041c1:	50                   	push   %eax
+  8041c2:	ff 74 24 2c          	push   0x2c(%esp)
+  8041c6:	ff 74 24 2c          	push   0x2c(%esp)
+  8041ca:	ff 74 24 2c          	push   0x2c(%esp)
+  8041ce:	ff 74 24 2c          	push   0x2c(%esp)
+  8041d2:	e8 ee fe ff ff       	call   8040c5 <__udivmoddi4>
+  8041d7:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8041db:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8041df:	83 c4 2c             	add    $0x2c,%esp
+  8041e2:	c3                   	ret
+
+008041e3 <__divdi3>:
+  8041e3:	53                   	push   %ebx
+  8041e4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8041e8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8041ec:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8041f0:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8041f4:	85 d2                	test   %edx,%edx
+  8041f6:	78 12                	js     80420a <__divdi3+0x27>
+  8041f8:	85 db                	test   %ebx,%ebx
+  8041fa:	78 2e                	js     80422a <__divdi3+0x47>
+  8041fc:	53                   	push   %ebx
+  8041fd:	51                   	push   %ecx
+  8041fe:	52                   	push   %edx
+  8041ff:	50                   	push   %eax
+  804200:	e8 97 ff ff ff       	call   80419c <__udivdi3>
+  804205:	83 c4 10             	add    $0x10,%esp
+  804208:	eb 1e                	jmp    804228 <__divdi3+0x45>
+  80420a:	f7 d8                	neg    %eax
+  80420c:	83 d2 00             	adc    $0x0,%edx
+  80420f:	f7 da                	neg    %edx
+  804211:	85 db                	test   %ebx,%ebx
+  804213:	78 2a                	js     80423f <__divdi3+0x5c>
+  804215:	53                   	push   %ebx
+  804216:	51                   	push   %ecx
+  804217:	52                   	push   %edx
+  804218:	50                   	push   %eax
+  804219:	e8 7e ff ff ff       	call   80419c <__udivdi3>
+  80421e:	83 c4 10             	add    $0x10,%esp
+  804221:	f7 d8                	neg    %eax
+  804223:	83 d2 00             	adc    $0x0,%edx
+  804226:	f7 da                	neg    %edx
+  804228:	5b                   	pop    %ebx
+  804229:	c3                   	ret
+  80422a:	f7 d9                	neg    %ecx
+  80422c:	83 d3 00             	adc    $0x0,%ebx
+  80422f:	f7 db                	neg    %ebx
+  804231:	53                   	push   %ebx
+  804232:	51                   	push   %ecx
+  804233:	52                   	push   %edx
+  804234:	50                   	push   %eax
+  804235:	e8 62 ff ff ff       	call   80419c <__udivdi3>
+  80423a:	83 c4 10             	add    $0x10,%esp
+  80423d:	eb e2                	jmp    804221 <__divdi3+0x3e>
+  80423f:	f7 d9                	neg    %ecx
+  804241:	83 d3 00             	adc    $0x0,%ebx
+  804244:	f7 db                	neg    %ebx
+  804246:	53                   	push   %ebx
+  804247:	51                   	push   %ecx
+  804248:	52                   	push   %edx
+  804249:	50                   	push   %eax
+  80424a:	e8 4d ff ff ff       	call   80419c <__udivdi3>
+  80424f:	83 c4 10             	add    $0x10,%esp
+  804252:	eb d4                	jmp    804228 <__divdi3+0x45>
+
+00804254 <__moddi3>:
+  804254:	55                   	push   %ebp
+  804255:	57                   	push   %edi
+  804256:	56                   	push   %esi
+  804257:	53                   	push   %ebx
+  804258:	83 ec 0c             	sub    $0xc,%esp
+  80425b:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80425f:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  804263:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804267:	89 e9                	mov    %ebp,%ecx
+  804269:	f7 d9                	neg    %ecx
+  80426b:	89 d0                	mov    %edx,%eax
+  80426d:	83 d0 00             	adc    $0x0,%eax
+  804270:	f7 d8                	neg    %eax
+  804272:	0f 49 e9             	cmovns %ecx,%ebp
+  804275:	0f 49 d0             	cmovns %eax,%edx
+  804278:	52                   	push   %edx
+  804279:	55                   	push   %ebp
+  80427a:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80427e:	f7 da                	neg    %edx
+  804280:	89 d8                	mov    %ebx,%eax
+  804282:	83 d0 00             	adc    $0x0,%eax
+  804285:	f7 d8                	neg    %eax
+  804287:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80428c:	89 54 24 08          	mov    %edx,0x8(%esp)
+  804290:	0f 48 c3             	cmovs  %ebx,%eax
+  804293:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  804297:	ff 74 24 0c          	push   0xc(%esp)
+  80429b:	ff 74 24 0c          	push   0xc(%esp)
+  80429f:	e8 16 ff ff ff       	call   8041ba <__umoddi3>
+  8042a4:	83 c4 10             	add    $0x10,%esp
+  8042a7:	85 db                	test   %ebx,%ebx
+  8042a9:	78 08                	js     8042b3 <__moddi3+0x5f>
+  8042ab:	83 c4 0c             	add    $0xc,%esp
+  8042ae:	5b                   	pop    %ebx
+  8042af:	5e                   	pop    %esi
+  8042b0:	5f                   	pop    %edi
+  8042b1:	5d                   	pop    %ebp
+  8042b2:	c3                   	ret
+  8042b3:	f7 d8                	neg    %eax
+  8042b5:	83 d2 00             	adc    $0x0,%edx
+  8042b8:	f7 da                	neg    %edx
+  8042ba:	eb ef                	jmp    8042ab <__moddi3+0x57>
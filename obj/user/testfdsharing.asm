@@ -0,0 +1,5763 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 40 03 00 00       	call   800371 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 4c 3b 80 00       	push   $0x803b4c
+  800043:	e8 09 28 00 00       	call   802851 <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 04 02 00 00    	js     800259 <umain+0x226>
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 91 21 00 00       	call   8021f1 <seek>
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 20 62 80 00       	push   $0x806220
+  80006d:	53                   	push   %ebx
+  80006e:	e8 a8 20 00 00       	call   80211b <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e eb 01 00 00    	jle    80026b <umain+0x238>
+  800080:	e8 e5 19 00 00       	call   801a6a <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 ee 01 00 00    	js     80027d <umain+0x24a>
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 55 21 00 00       	call   8021f1 <seek>
+  80009c:	c7 04 24 f4 3b 80 00 	movl   $0x803bf4,(%esp)
+  8000a3:	e8 1d 04 00 00       	call   8004c5 <cprintf>
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 20 60 80 00       	push   $0x806020
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 60 20 00 00       	call   80211b <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c9 01 00 00    	jne    80028f <umain+0x25c>
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 20 60 80 00       	push   $0x806020
+  8000cf:	68 20 62 80 00       	push   $0x806220
+  8000d4:	e8 0b 0d 00 00       	call   800de4 <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 c1 01 00 00    	jne    8002a5 <umain+0x272>
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 16 3b 80 00       	push   $0x803b16
+  8000ec:	e8 d4 03 00 00       	call   8004c5 <cprintf>
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 f5 20 00 00       	call   8021f1 <seek>
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 54 1e 00 00       	call   801f58 <close>
+  800104:	e8 b1 02 00 00       	call   8003ba <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 71 30 00 00       	call   803186 <wait>
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 20 60 80 00       	push   $0x806020
+  800122:	53                   	push   %ebx
+  800123:	e8 f3 1f 00 00       	call   80211b <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 86 01 00 00    	jne    8002b9 <umain+0x286>
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 2f 3b 80 00       	push   $0x803b2f
+  80013b:	e8 85 03 00 00       	call   8004c5 <cprintf>
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 10 1e 00 00       	call   801f58 <close>
+  800148:	83 c4 08             	add    $0x8,%esp
+  80014b:	6a 02                	push   $0x2
+  80014d:	68 49 3b 80 00       	push   $0x803b49
+  800152:	e8 fa 26 00 00       	call   802851 <open>
+  800157:	89 c3                	mov    %eax,%ebx
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 6b 01 00 00    	js     8002cf <umain+0x29c>
+  800164:	83 ec 08             	sub    $0x8,%esp
+  800167:	6a 00                	push   $0x0
+  800169:	50                   	push   %eax
+  80016a:	e8 82 20 00 00       	call   8021f1 <seek>
+  80016f:	83 c4 0c             	add    $0xc,%esp
+  800172:	6a 05                	push   $0x5
+  800174:	68 62 3b 80 00       	push   $0x803b62
+  800179:	53                   	push   %ebx
+  80017a:	e8 f0 1f 00 00       	call   80216f <write>
+  80017f:	83 c4 10             	add    $0x10,%esp
+  800182:	83 f8 05             	cmp    $0x5,%eax
+  800185:	0f 85 56 01 00 00    	jne    8002e1 <umain+0x2ae>
+  80018b:	e8 da 18 00 00       	call   801a6a <fork>
+  800190:	89 c6                	mov    %eax,%esi
+  800192:	85 c0                	test   %eax,%eax
+  800194:	0f 88 59 01 00 00    	js     8002f3 <umain+0x2c0>
+  80019a:	75 50                	jne    8001ec <umain+0x1b9>
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	6a 00                	push   $0x0
+  8001a1:	53                   	push   %ebx
+  8001a2:	e8 4a 20 00 00       	call   8021f1 <seek>
+  8001a7:	c7 04 24 72 3b 80 00 	movl   $0x803b72,(%esp)
+  8001ae:	e8 12 03 00 00       	call   8004c5 <cprintf>
+  8001b3:	83 c4 0c             	add    $0xc,%esp
+  8001b6:	6a 05                	push   $0x5
+  8001b8:	68 8b 3b 80 00       	push   $0x803b8b
+  8001bd:	53                   	push   %ebx
+  8001be:	e8 ac 1f 00 00       	call   80216f <write>
+  8001c3:	83 c4 10             	add    $0x10,%esp
+  8001c6:	83 f8 05             	cmp    $0x5,%eax
+  8001c9:	0f 85 36 01 00 00    	jne    800305 <umain+0x2d2>
+  8001cf:	83 ec 0c             	sub    $0xc,%esp
+  8001d2:	68 a4 3b 80 00       	push   $0x803ba4
+  8001d7:	e8 e9 02 00 00       	call   8004c5 <cprintf>
+  8001dc:	89 1c 24             	mov    %ebx,(%esp)
+  8001df:	e8 74 1d 00 00       	call   801f58 <close>
+  8001e4:	e8 d1 01 00 00       	call   8003ba <exit>
+  8001e9:	83 c4 10             	add    $0x10,%esp
+  8001ec:	83 ec 0c             	sub    $0xc,%esp
+  8001ef:	56                   	push   %esi
+  8001f0:	e8 91 2f 00 00       	call   803186 <wait>
+  8001f5:	83 c4 08             	add    $0x8,%esp
+  8001f8:	6a 00                	push   $0x0
+  8001fa:	53                   	push   %ebx
+  8001fb:	e8 f1 1f 00 00       	call   8021f1 <seek>
+  800200:	83 c4 0c             	add    $0xc,%esp
+  800203:	6a 05                	push   $0x5
+  800205:	68 20 62 80 00       	push   $0x806220
+  80020a:	53                   	push   %ebx
+  80020b:	e8 0b 1f 00 00       	call   80211b <readn>
+  800210:	83 c4 10             	add    $0x10,%esp
+  800213:	83 f8 05             	cmp    $0x5,%eax
+  800216:	0f 85 fb 00 00 00    	jne    800317 <umain+0x2e4>
+  80021c:	c6 05 25 62 80 00 00 	movb   $0x0,0x806225
+  800223:	83 ec 08             	sub    $0x8,%esp
+  800226:	68 62 3b 80 00       	push   $0x803b62
+  80022b:	68 20 62 80 00       	push   $0x806220
+  800230:	e8 37 0a 00 00       	call   800c6c <strcmp>
+  800235:	83 c4 10             	add    $0x10,%esp
+  800238:	85 c0                	test   %eax,%eax
+  80023a:	0f 85 e9 00 00 00    	jne    800329 <umain+0x2f6>
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	68 c0 3c 80 00       	push   $0x803cc0
+  800248:	e8 78 02 00 00       	call   8004c5 <cprintf>
+  80024d:	83 c4 10             	add    $0x10,%esp
+  800250:	cc                   	int3
+  800251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800254:	5b                   	pop    %ebx
+  800255:	5e                   	pop    %esi
+  800256:	5f                   	pop    %edi
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+  800259:	50                   	push   %eax
+  80025a:	68 e0 3a 80 00       	push   $0x803ae0
+  80025f:	6a 0c                	push   $0xc
+  800261:	68 ee 3a 80 00       	push   $0x803aee
+  800266:	e8 7f 01 00 00       	call   8003ea <_panic>
+  80026b:	50                   	push   %eax
+  80026c:	68 03 3b 80 00       	push   $0x803b03
+  800271:	6a 0f                	push   $0xf
+  800273:	68 ee 3a 80 00       	push   $0x803aee
+  800278:	e8 6d 01 00 00       	call   8003ea <_panic>
+  80027d:	50                   	push   %eax
+  80027e:	68 0d 3b 80 00       	push   $0x803b0d
+  800283:	6a 12                	push   $0x12
+  800285:	68 ee 3a 80 00       	push   $0x803aee
+  80028a:	e8 5b 01 00 00       	call   8003ea <_panic>
+  80028f:	83 ec 0c             	sub    $0xc,%esp
+  800292:	50                   	push   %eax
+  800293:	56                   	push   %esi
+  800294:	68 38 3c 80 00       	push   $0x803c38
+  800299:	6a 17                	push   $0x17
+  80029b:	68 ee 3a 80 00       	push   $0x803aee
+  8002a0:	e8 45 01 00 00       	call   8003ea <_panic>
+  8002a5:	83 ec 04             	sub    $0x4,%esp
+  8002a8:	68 64 3c 80 00       	push   $0x803c64
+  8002ad:	6a 19                	push   $0x19
+  8002af:	68 ee 3a 80 00       	push   $0x803aee
+  8002b4:	e8 31 01 00 00       	call   8003ea <_panic>
+  8002b9:	83 ec 0c             	sub    $0xc,%esp
+  8002bc:	50                   	push   %eax
+  8002bd:	56                   	push   %esi
+  8002be:	68 9c 3c 80 00       	push   $0x803c9c
+  8002c3:	6a 21                	push   $0x21
+  8002c5:	68 ee 3a 80 00       	push   $0x803aee
+  8002ca:	e8 1b 01 00 00       	call   8003ea <_panic>
+  8002cf:	50                   	push   %eax
+  8002d0:	68 51 3b 80 00       	push   $0x803b51
+  8002d5:	6a 26                	push   $0x26
+  8002d7:	68 ee 3a 80 00       	push   $0x803aee
+  8002dc:	e8 09 01 00 00       	call   8003ea <_panic>
+  8002e1:	50                   	push   %eax
+  8002e2:	68 68 3b 80 00       	push   $0x803b68
+  8002e7:	6a 29                	push   $0x29
+  8002e9:	68 ee 3a 80 00       	push   $0x803aee
+  8002ee:	e8 f7 00 00 00       	call   8003ea <_panic>
+  8002f3:	50                   	push   %eax
+  8002f4:	68 0d 3b 80 00       	push   $0x803b0d
+  8002f9:	6a 2c                	push   $0x2c
+  8002fb:	68 ee 3a 80 00       	push   $0x803aee
+  800300:	e8 e5 00 00 00       	call   8003ea <_panic>
+  800305:	50                   	push   %eax
+  800306:	68 91 3b 80 00       	push   $0x803b91
+  80030b:	6a 31                	push   $0x31
+  80030d:	68 ee 3a 80 00       	push   $0x803aee
+  800312:	e8 d3 00 00 00       	call   8003ea <_panic>
+  800317:	50                   	push   %eax
+  800318:	68 03 3b 80 00       	push   $0x803b03
+  80031d:	6a 39                	push   $0x39
+  80031f:	68 ee 3a 80 00       	push   $0x803aee
+  800324:	e8 c1 00 00 00       	call   8003ea <_panic>
+  800329:	83 ec 08             	sub    $0x8,%esp
+  80032c:	68 8b 3b 80 00       	push   $0x803b8b
+  800331:	68 20 62 80 00       	push   $0x806220
+  800336:	e8 31 09 00 00       	call   800c6c <strcmp>
+  80033b:	83 c4 10             	add    $0x10,%esp
+  80033e:	85 c0                	test   %eax,%eax
+  800340:	75 15                	jne    800357 <umain+0x324>
+  800342:	83 ec 0c             	sub    $0xc,%esp
+  800345:	68 bd 3b 80 00       	push   $0x803bbd
+  80034a:	e8 76 01 00 00       	call   8004c5 <cprintf>
+  80034f:	83 c4 10             	add    $0x10,%esp
+  800352:	e9 f9 fe ff ff       	jmp    800250 <umain+0x21d>
+  800357:	83 ec 08             	sub    $0x8,%esp
+  80035a:	68 20 62 80 00       	push   $0x806220
+  80035f:	68 d6 3b 80 00       	push   $0x803bd6
+  800364:	e8 5c 01 00 00       	call   8004c5 <cprintf>
+  800369:	83 c4 10             	add    $0x10,%esp
+  80036c:	e9 df fe ff ff       	jmp    800250 <umain+0x21d>
+
+00800371 <libmain>:
+  800371:	55                   	push   %ebp
+  800372:	89 e5                	mov    %esp,%ebp
+  800374:	56                   	push   %esi
+  800375:	53                   	push   %ebx
+  800376:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800379:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80037c:	e8 31 0c 00 00       	call   800fb2 <sys_getenvid>
+  800381:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800386:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80038c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800391:	a3 20 64 80 00       	mov    %eax,0x806420
+  800396:	85 db                	test   %ebx,%ebx
+  800398:	7e 07                	jle    8003a1 <libmain+0x30>
+  80039a:	8b 06                	mov    (%esi),%eax
+  80039c:	a3 00 50 80 00       	mov    %eax,0x805000
+  8003a1:	83 ec 08             	sub    $0x8,%esp
+  8003a4:	56                   	push   %esi
+  8003a5:	53                   	push   %ebx
+  8003a6:	e8 88 fc ff ff       	call   800033 <umain>
+  8003ab:	e8 0a 00 00 00       	call   8003ba <exit>
+  8003b0:	83 c4 10             	add    $0x10,%esp
+  8003b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003b6:	5b                   	pop    %ebx
+  8003b7:	5e                   	pop    %esi
+  8003b8:	5d                   	pop    %ebp
+  8003b9:	c3                   	ret
+
+008003ba <exit>:
+  8003ba:	55                   	push   %ebp
+  8003bb:	89 e5                	mov    %esp,%ebp
+  8003bd:	83 ec 08             	sub    $0x8,%esp
+  8003c0:	a1 20 64 80 00       	mov    0x806420,%eax
+  8003c5:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8003cb:	85 c0                	test   %eax,%eax
+  8003cd:	75 14                	jne    8003e3 <exit+0x29>
+  8003cf:	e8 b1 1b 00 00       	call   801f85 <close_all>
+  8003d4:	83 ec 0c             	sub    $0xc,%esp
+  8003d7:	6a 00                	push   $0x0
+  8003d9:	e8 93 0b 00 00       	call   800f71 <sys_env_destroy>
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	c9                   	leave
+  8003e2:	c3                   	ret
+  8003e3:	e8 f6 12 00 00       	call   8016de <sys_lease_complete>
+  8003e8:	eb e5                	jmp    8003cf <exit+0x15>
+
+008003ea <_panic>:
+  8003ea:	55                   	push   %ebp
+  8003eb:	89 e5                	mov    %esp,%ebp
+  8003ed:	56                   	push   %esi
+  8003ee:	53                   	push   %ebx
+  8003ef:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8003f2:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8003f8:	e8 b5 0b 00 00       	call   800fb2 <sys_getenvid>
+  8003fd:	83 ec 0c             	sub    $0xc,%esp
+  800400:	ff 75 0c             	push   0xc(%ebp)
+  800403:	ff 75 08             	push   0x8(%ebp)
+  800406:	56                   	push   %esi
+  800407:	50                   	push   %eax
+  800408:	68 f0 3c 80 00       	push   $0x803cf0
+  80040d:	e8 b3 00 00 00       	call   8004c5 <cprintf>
+  800412:	83 c4 18             	add    $0x18,%esp
+  800415:	53                   	push   %ebx
+  800416:	ff 75 10             	push   0x10(%ebp)
+  800419:	e8 56 00 00 00       	call   800474 <vcprintf>
+  80041e:	c7 04 24 2d 3b 80 00 	movl   $0x803b2d,(%esp)
+  800425:	e8 9b 00 00 00       	call   8004c5 <cprintf>
+  80042a:	83 c4 10             	add    $0x10,%esp
+  80042d:	cc                   	int3
+  80042e:	eb fd                	jmp    80042d <_panic+0x43>
+
+00800430 <putch>:
+  800430:	55                   	push   %ebp
+  800431:	89 e5                	mov    %esp,%ebp
+  800433:	53                   	push   %ebx
+  800434:	83 ec 04             	sub    $0x4,%esp
+  800437:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80043a:	8b 13                	mov    (%ebx),%edx
+  80043c:	8d 42 01             	lea    0x1(%edx),%eax
+  80043f:	89 03                	mov    %eax,(%ebx)
+  800441:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800444:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800448:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80044d:	74 09                	je     800458 <putch+0x28>
+  80044f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800453:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800456:	c9                   	leave
+  800457:	c3                   	ret
+  800458:	83 ec 08             	sub    $0x8,%esp
+  80045b:	68 ff 00 00 00       	push   $0xff
+  800460:	8d 43 08             	lea    0x8(%ebx),%eax
+  800463:	50                   	push   %eax
+  800464:	e8 cb 0a 00 00       	call   800f34 <sys_cputs>
+  800469:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80046f:	83 c4 10             	add    $0x10,%esp
+  800472:	eb db                	jmp    80044f <putch+0x1f>
+
+00800474 <vcprintf>:
+  800474:	55                   	push   %ebp
+  800475:	89 e5                	mov    %esp,%ebp
+  800477:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80047d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800484:	00 00 00 
+  800487:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80048e:	00 00 00 
+  800491:	ff 75 0c             	push   0xc(%ebp)
+  800494:	ff 75 08             	push   0x8(%ebp)
+  800497:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80049d:	50                   	push   %eax
+  80049e:	68 30 04 80 00       	push   $0x800430
+  8004a3:	e8 1c 01 00 00       	call   8005c4 <vprintfmt>
+  8004a8:	83 c4 08             	add    $0x8,%esp
+  8004ab:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004b1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004b7:	50                   	push   %eax
+  8004b8:	e8 77 0a 00 00       	call   800f34 <sys_cputs>
+  8004bd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004c3:	c9                   	leave
+  8004c4:	c3                   	ret
+
+008004c5 <cprintf>:
+  8004c5:	55                   	push   %ebp
+  8004c6:	89 e5                	mov    %esp,%ebp
+  8004c8:	83 ec 10             	sub    $0x10,%esp
+  8004cb:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8004ce:	50                   	push   %eax
+  8004cf:	ff 75 08             	push   0x8(%ebp)
+  8004d2:	e8 9d ff ff ff       	call   800474 <vcprintf>
+  8004d7:	c9                   	leave
+  8004d8:	c3                   	ret
+
+008004d9 <printnum>:
+  8004d9:	55                   	push   %ebp
+  8004da:	89 e5                	mov    %esp,%ebp
+  8004dc:	57                   	push   %edi
+  8004dd:	56                   	push   %esi
+  8004de:	53                   	push   %ebx
+  8004df:	83 ec 1c             	sub    $0x1c,%esp
+  8004e2:	89 c3                	mov    %eax,%ebx
+  8004e4:	89 d6                	mov    %edx,%esi
+  8004e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004ec:	89 d1                	mov    %edx,%ecx
+  8004ee:	89 c2                	mov    %eax,%edx
+  8004f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004f6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800503:	39 c2                	cmp    %eax,%edx
+  800505:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800508:	73 4b                	jae    800555 <printnum+0x7c>
+  80050a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800510:	85 ff                	test   %edi,%edi
+  800512:	7e 11                	jle    800525 <printnum+0x4c>
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	56                   	push   %esi
+  800518:	ff 75 18             	push   0x18(%ebp)
+  80051b:	ff d3                	call   *%ebx
+  80051d:	83 c4 10             	add    $0x10,%esp
+  800520:	83 ef 01             	sub    $0x1,%edi
+  800523:	75 ef                	jne    800514 <printnum+0x3b>
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	56                   	push   %esi
+  800529:	83 ec 04             	sub    $0x4,%esp
+  80052c:	ff 75 e4             	push   -0x1c(%ebp)
+  80052f:	ff 75 e0             	push   -0x20(%ebp)
+  800532:	ff 75 dc             	push   -0x24(%ebp)
+  800535:	ff 75 d8             	push   -0x28(%ebp)
+  800538:	e8 86 34 00 00       	call   8039c3 <__umoddi3>
+  80053d:	83 c4 14             	add    $0x14,%esp
+  800540:	0f be 80 13 3d 80 00 	movsbl 0x803d13(%eax),%eax
+  800547:	50                   	push   %eax
+  800548:	ff d3                	call   *%ebx
+  80054a:	83 c4 10             	add    $0x10,%esp
+  80054d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800550:	5b                   	pop    %ebx
+  800551:	5e                   	pop    %esi
+  800552:	5f                   	pop    %edi
+  800553:	5d                   	pop    %ebp
+  800554:	c3                   	ret
+  800555:	83 ec 0c             	sub    $0xc,%esp
+  800558:	ff 75 18             	push   0x18(%ebp)
+  80055b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80055e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800561:	52                   	push   %edx
+  800562:	50                   	push   %eax
+  800563:	83 ec 08             	sub    $0x8,%esp
+  800566:	ff 75 e4             	push   -0x1c(%ebp)
+  800569:	ff 75 e0             	push   -0x20(%ebp)
+  80056c:	ff 75 dc             	push   -0x24(%ebp)
+  80056f:	ff 75 d8             	push   -0x28(%ebp)
+  800572:	e8 2e 34 00 00       	call   8039a5 <__udivdi3>
+  800577:	83 c4 18             	add    $0x18,%esp
+  80057a:	52                   	push   %edx
+  80057b:	50                   	push   %eax
+  80057c:	89 f2                	mov    %esi,%edx
+  80057e:	89 d8                	mov    %ebx,%eax
+  800580:	e8 54 ff ff ff       	call   8004d9 <printnum>
+  800585:	83 c4 20             	add    $0x20,%esp
+  800588:	eb 9b                	jmp    800525 <printnum+0x4c>
+
+0080058a <sprintputch>:
+  80058a:	55                   	push   %ebp
+  80058b:	89 e5                	mov    %esp,%ebp
+  80058d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800590:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800594:	8b 10                	mov    (%eax),%edx
+  800596:	3b 50 04             	cmp    0x4(%eax),%edx
+  800599:	73 0a                	jae    8005a5 <sprintputch+0x1b>
+  80059b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80059e:	89 08                	mov    %ecx,(%eax)
+  8005a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a3:	88 02                	mov    %al,(%edx)
+  8005a5:	5d                   	pop    %ebp
+  8005a6:	c3                   	ret
+
+008005a7 <printfmt>:
+  8005a7:	55                   	push   %ebp
+  8005a8:	89 e5                	mov    %esp,%ebp
+  8005aa:	83 ec 08             	sub    $0x8,%esp
+  8005ad:	8d 45 14             	lea    0x14(%ebp),%eax
+  8005b0:	50                   	push   %eax
+  8005b1:	ff 75 10             	push   0x10(%ebp)
+  8005b4:	ff 75 0c             	push   0xc(%ebp)
+  8005b7:	ff 75 08             	push   0x8(%ebp)
+  8005ba:	e8 05 00 00 00       	call   8005c4 <vprintfmt>
+  8005bf:	83 c4 10             	add    $0x10,%esp
+  8005c2:	c9                   	leave
+  8005c3:	c3                   	ret
+
+008005c4 <vprintfmt>:
+  8005c4:	55                   	push   %ebp
+  8005c5:	89 e5                	mov    %esp,%ebp
+  8005c7:	57                   	push   %edi
+  8005c8:	56                   	push   %esi
+  8005c9:	53                   	push   %ebx
+  8005ca:	83 ec 2c             	sub    $0x2c,%esp
+  8005cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005d0:	89 df                	mov    %ebx,%edi
+  8005d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005d8:	8d 70 01             	lea    0x1(%eax),%esi
+  8005db:	0f b6 00             	movzbl (%eax),%eax
+  8005de:	83 f8 25             	cmp    $0x25,%eax
+  8005e1:	74 1e                	je     800601 <vprintfmt+0x3d>
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	0f 84 15 05 00 00    	je     800b00 <vprintfmt+0x53c>
+  8005eb:	83 ec 08             	sub    $0x8,%esp
+  8005ee:	53                   	push   %ebx
+  8005ef:	50                   	push   %eax
+  8005f0:	ff d7                	call   *%edi
+  8005f2:	83 c6 01             	add    $0x1,%esi
+  8005f5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	83 f8 25             	cmp    $0x25,%eax
+  8005ff:	75 e2                	jne    8005e3 <vprintfmt+0x1f>
+  800601:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800605:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80060c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800613:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80061a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800622:	8d 56 01             	lea    0x1(%esi),%edx
+  800625:	0f b6 0e             	movzbl (%esi),%ecx
+  800628:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80062b:	3c 55                	cmp    $0x55,%al
+  80062d:	0f 87 3b 04 00 00    	ja     800a6e <vprintfmt+0x4aa>
+  800633:	0f b6 c0             	movzbl %al,%eax
+  800636:	ff 24 85 60 3e 80 00 	jmp    *0x803e60(,%eax,4)
+  80063d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800640:	eb 93                	jmp    8005d5 <vprintfmt+0x11>
+  800642:	89 d6                	mov    %edx,%esi
+  800644:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800648:	eb d8                	jmp    800622 <vprintfmt+0x5e>
+  80064a:	89 d6                	mov    %edx,%esi
+  80064c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800650:	eb d0                	jmp    800622 <vprintfmt+0x5e>
+  800652:	0f b6 c9             	movzbl %cl,%ecx
+  800655:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800658:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80065b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80065f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800662:	83 f9 09             	cmp    $0x9,%ecx
+  800665:	77 6f                	ja     8006d6 <vprintfmt+0x112>
+  800667:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80066a:	83 c2 01             	add    $0x1,%edx
+  80066d:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800670:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800674:	0f be 02             	movsbl (%edx),%eax
+  800677:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80067a:	83 fe 09             	cmp    $0x9,%esi
+  80067d:	76 eb                	jbe    80066a <vprintfmt+0xa6>
+  80067f:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800682:	89 d6                	mov    %edx,%esi
+  800684:	eb 13                	jmp    800699 <vprintfmt+0xd5>
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 00                	mov    (%eax),%eax
+  80068b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8d 40 04             	lea    0x4(%eax),%eax
+  800694:	89 45 14             	mov    %eax,0x14(%ebp)
+  800697:	89 d6                	mov    %edx,%esi
+  800699:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80069d:	79 83                	jns    800622 <vprintfmt+0x5e>
+  80069f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006a2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006a5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8006ac:	e9 71 ff ff ff       	jmp    800622 <vprintfmt+0x5e>
+  8006b1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006b4:	85 c9                	test   %ecx,%ecx
+  8006b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006bb:	0f 49 c1             	cmovns %ecx,%eax
+  8006be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006c1:	89 d6                	mov    %edx,%esi
+  8006c3:	e9 5a ff ff ff       	jmp    800622 <vprintfmt+0x5e>
+  8006c8:	89 d6                	mov    %edx,%esi
+  8006ca:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8006d1:	e9 4c ff ff ff       	jmp    800622 <vprintfmt+0x5e>
+  8006d6:	89 d6                	mov    %edx,%esi
+  8006d8:	eb bf                	jmp    800699 <vprintfmt+0xd5>
+  8006da:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8006de:	89 d6                	mov    %edx,%esi
+  8006e0:	e9 3d ff ff ff       	jmp    800622 <vprintfmt+0x5e>
+  8006e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8d 70 04             	lea    0x4(%eax),%esi
+  8006ee:	83 ec 08             	sub    $0x8,%esp
+  8006f1:	53                   	push   %ebx
+  8006f2:	ff 30                	push   (%eax)
+  8006f4:	ff d7                	call   *%edi
+  8006f6:	83 c4 10             	add    $0x10,%esp
+  8006f9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006fc:	e9 d4 fe ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800701:	89 55 10             	mov    %edx,0x10(%ebp)
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8d 70 04             	lea    0x4(%eax),%esi
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	89 d0                	mov    %edx,%eax
+  80070e:	f7 d8                	neg    %eax
+  800710:	0f 48 c2             	cmovs  %edx,%eax
+  800713:	83 f8 12             	cmp    $0x12,%eax
+  800716:	7f 23                	jg     80073b <vprintfmt+0x177>
+  800718:	8b 14 85 c0 3f 80 00 	mov    0x803fc0(,%eax,4),%edx
+  80071f:	85 d2                	test   %edx,%edx
+  800721:	74 18                	je     80073b <vprintfmt+0x177>
+  800723:	52                   	push   %edx
+  800724:	68 03 42 80 00       	push   $0x804203
+  800729:	53                   	push   %ebx
+  80072a:	57                   	push   %edi
+  80072b:	e8 77 fe ff ff       	call   8005a7 <printfmt>
+  800730:	83 c4 10             	add    $0x10,%esp
+  800733:	89 75 14             	mov    %esi,0x14(%ebp)
+  800736:	e9 9a fe ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  80073b:	50                   	push   %eax
+  80073c:	68 2b 3d 80 00       	push   $0x803d2b
+  800741:	53                   	push   %ebx
+  800742:	57                   	push   %edi
+  800743:	e8 5f fe ff ff       	call   8005a7 <printfmt>
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80074e:	e9 82 fe ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800753:	89 55 10             	mov    %edx,0x10(%ebp)
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	83 c0 04             	add    $0x4,%eax
+  80075c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8b 00                	mov    (%eax),%eax
+  800764:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800767:	85 c0                	test   %eax,%eax
+  800769:	0f 84 61 03 00 00    	je     800ad0 <vprintfmt+0x50c>
+  80076f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800773:	7e 06                	jle    80077b <vprintfmt+0x1b7>
+  800775:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800779:	75 29                	jne    8007a4 <vprintfmt+0x1e0>
+  80077b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80077e:	8d 70 01             	lea    0x1(%eax),%esi
+  800781:	0f b6 00             	movzbl (%eax),%eax
+  800784:	0f be d0             	movsbl %al,%edx
+  800787:	85 d2                	test   %edx,%edx
+  800789:	0f 84 bb 00 00 00    	je     80084a <vprintfmt+0x286>
+  80078f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800792:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800795:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800798:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80079b:	eb 7a                	jmp    800817 <vprintfmt+0x253>
+  80079d:	c7 45 d0 24 3d 80 00 	movl   $0x803d24,-0x30(%ebp)
+  8007a4:	83 ec 08             	sub    $0x8,%esp
+  8007a7:	ff 75 d4             	push   -0x2c(%ebp)
+  8007aa:	ff 75 d0             	push   -0x30(%ebp)
+  8007ad:	e8 e0 03 00 00       	call   800b92 <strnlen>
+  8007b2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8007b5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	85 d2                	test   %edx,%edx
+  8007bd:	0f 8e d6 02 00 00    	jle    800a99 <vprintfmt+0x4d5>
+  8007c3:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8007c7:	83 ec 08             	sub    $0x8,%esp
+  8007ca:	53                   	push   %ebx
+  8007cb:	56                   	push   %esi
+  8007cc:	ff d7                	call   *%edi
+  8007ce:	83 c4 10             	add    $0x10,%esp
+  8007d1:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8007d5:	75 f0                	jne    8007c7 <vprintfmt+0x203>
+  8007d7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007da:	8d 70 01             	lea    0x1(%eax),%esi
+  8007dd:	0f b6 00             	movzbl (%eax),%eax
+  8007e0:	0f be d0             	movsbl %al,%edx
+  8007e3:	85 d2                	test   %edx,%edx
+  8007e5:	0f 84 da 02 00 00    	je     800ac5 <vprintfmt+0x501>
+  8007eb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007ee:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007f1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007f4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007f7:	eb 1e                	jmp    800817 <vprintfmt+0x253>
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+  8007fc:	ff 75 0c             	push   0xc(%ebp)
+  8007ff:	52                   	push   %edx
+  800800:	ff 55 08             	call   *0x8(%ebp)
+  800803:	83 c4 10             	add    $0x10,%esp
+  800806:	83 eb 01             	sub    $0x1,%ebx
+  800809:	83 c6 01             	add    $0x1,%esi
+  80080c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800810:	0f be d0             	movsbl %al,%edx
+  800813:	85 d2                	test   %edx,%edx
+  800815:	74 2a                	je     800841 <vprintfmt+0x27d>
+  800817:	85 ff                	test   %edi,%edi
+  800819:	78 05                	js     800820 <vprintfmt+0x25c>
+  80081b:	83 ef 01             	sub    $0x1,%edi
+  80081e:	78 59                	js     800879 <vprintfmt+0x2b5>
+  800820:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800824:	74 d3                	je     8007f9 <vprintfmt+0x235>
+  800826:	0f be c0             	movsbl %al,%eax
+  800829:	83 e8 20             	sub    $0x20,%eax
+  80082c:	83 f8 5e             	cmp    $0x5e,%eax
+  80082f:	76 c8                	jbe    8007f9 <vprintfmt+0x235>
+  800831:	83 ec 08             	sub    $0x8,%esp
+  800834:	ff 75 0c             	push   0xc(%ebp)
+  800837:	6a 3f                	push   $0x3f
+  800839:	ff 55 08             	call   *0x8(%ebp)
+  80083c:	83 c4 10             	add    $0x10,%esp
+  80083f:	eb c5                	jmp    800806 <vprintfmt+0x242>
+  800841:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800844:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800847:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80084a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80084d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800851:	7e 1b                	jle    80086e <vprintfmt+0x2aa>
+  800853:	83 ec 08             	sub    $0x8,%esp
+  800856:	53                   	push   %ebx
+  800857:	6a 20                	push   $0x20
+  800859:	ff d7                	call   *%edi
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	83 ee 01             	sub    $0x1,%esi
+  800861:	75 f0                	jne    800853 <vprintfmt+0x28f>
+  800863:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800866:	89 45 14             	mov    %eax,0x14(%ebp)
+  800869:	e9 67 fd ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  80086e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+  800874:	e9 5c fd ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800879:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80087c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80087f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800882:	eb c6                	jmp    80084a <vprintfmt+0x286>
+  800884:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800887:	89 55 10             	mov    %edx,0x10(%ebp)
+  80088a:	83 f9 01             	cmp    $0x1,%ecx
+  80088d:	7f 1f                	jg     8008ae <vprintfmt+0x2ea>
+  80088f:	85 c9                	test   %ecx,%ecx
+  800891:	74 67                	je     8008fa <vprintfmt+0x336>
+  800893:	8b 45 14             	mov    0x14(%ebp),%eax
+  800896:	8b 30                	mov    (%eax),%esi
+  800898:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80089b:	89 f0                	mov    %esi,%eax
+  80089d:	c1 f8 1f             	sar    $0x1f,%eax
+  8008a0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ac:	eb 17                	jmp    8008c5 <vprintfmt+0x301>
+  8008ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b1:	8b 50 04             	mov    0x4(%eax),%edx
+  8008b4:	8b 00                	mov    (%eax),%eax
+  8008b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008b9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bf:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008c8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008cb:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008d0:	85 c9                	test   %ecx,%ecx
+  8008d2:	0f 89 12 01 00 00    	jns    8009ea <vprintfmt+0x426>
+  8008d8:	83 ec 08             	sub    $0x8,%esp
+  8008db:	53                   	push   %ebx
+  8008dc:	6a 2d                	push   $0x2d
+  8008de:	ff d7                	call   *%edi
+  8008e0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008e3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008e6:	f7 da                	neg    %edx
+  8008e8:	83 d1 00             	adc    $0x0,%ecx
+  8008eb:	f7 d9                	neg    %ecx
+  8008ed:	83 c4 10             	add    $0x10,%esp
+  8008f0:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008f5:	e9 f0 00 00 00       	jmp    8009ea <vprintfmt+0x426>
+  8008fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fd:	8b 30                	mov    (%eax),%esi
+  8008ff:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800902:	89 f0                	mov    %esi,%eax
+  800904:	c1 f8 1f             	sar    $0x1f,%eax
+  800907:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80090a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090d:	8d 40 04             	lea    0x4(%eax),%eax
+  800910:	89 45 14             	mov    %eax,0x14(%ebp)
+  800913:	eb b0                	jmp    8008c5 <vprintfmt+0x301>
+  800915:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800918:	89 55 10             	mov    %edx,0x10(%ebp)
+  80091b:	83 f9 01             	cmp    $0x1,%ecx
+  80091e:	7f 1e                	jg     80093e <vprintfmt+0x37a>
+  800920:	85 c9                	test   %ecx,%ecx
+  800922:	74 32                	je     800956 <vprintfmt+0x392>
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8b 10                	mov    (%eax),%edx
+  800929:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092e:	8d 40 04             	lea    0x4(%eax),%eax
+  800931:	89 45 14             	mov    %eax,0x14(%ebp)
+  800934:	be 0a 00 00 00       	mov    $0xa,%esi
+  800939:	e9 ac 00 00 00       	jmp    8009ea <vprintfmt+0x426>
+  80093e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800941:	8b 10                	mov    (%eax),%edx
+  800943:	8b 48 04             	mov    0x4(%eax),%ecx
+  800946:	8d 40 08             	lea    0x8(%eax),%eax
+  800949:	89 45 14             	mov    %eax,0x14(%ebp)
+  80094c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800951:	e9 94 00 00 00       	jmp    8009ea <vprintfmt+0x426>
+  800956:	8b 45 14             	mov    0x14(%ebp),%eax
+  800959:	8b 10                	mov    (%eax),%edx
+  80095b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800960:	8d 40 04             	lea    0x4(%eax),%eax
+  800963:	89 45 14             	mov    %eax,0x14(%ebp)
+  800966:	be 0a 00 00 00       	mov    $0xa,%esi
+  80096b:	eb 7d                	jmp    8009ea <vprintfmt+0x426>
+  80096d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800970:	89 55 10             	mov    %edx,0x10(%ebp)
+  800973:	83 f9 01             	cmp    $0x1,%ecx
+  800976:	7f 1b                	jg     800993 <vprintfmt+0x3cf>
+  800978:	85 c9                	test   %ecx,%ecx
+  80097a:	74 2c                	je     8009a8 <vprintfmt+0x3e4>
+  80097c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097f:	8b 10                	mov    (%eax),%edx
+  800981:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800986:	8d 40 04             	lea    0x4(%eax),%eax
+  800989:	89 45 14             	mov    %eax,0x14(%ebp)
+  80098c:	be 08 00 00 00       	mov    $0x8,%esi
+  800991:	eb 57                	jmp    8009ea <vprintfmt+0x426>
+  800993:	8b 45 14             	mov    0x14(%ebp),%eax
+  800996:	8b 10                	mov    (%eax),%edx
+  800998:	8b 48 04             	mov    0x4(%eax),%ecx
+  80099b:	8d 40 08             	lea    0x8(%eax),%eax
+  80099e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a1:	be 08 00 00 00       	mov    $0x8,%esi
+  8009a6:	eb 42                	jmp    8009ea <vprintfmt+0x426>
+  8009a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ab:	8b 10                	mov    (%eax),%edx
+  8009ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009b8:	be 08 00 00 00       	mov    $0x8,%esi
+  8009bd:	eb 2b                	jmp    8009ea <vprintfmt+0x426>
+  8009bf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009c2:	83 ec 08             	sub    $0x8,%esp
+  8009c5:	53                   	push   %ebx
+  8009c6:	6a 30                	push   $0x30
+  8009c8:	ff d7                	call   *%edi
+  8009ca:	83 c4 08             	add    $0x8,%esp
+  8009cd:	53                   	push   %ebx
+  8009ce:	6a 78                	push   $0x78
+  8009d0:	ff d7                	call   *%edi
+  8009d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d5:	8b 10                	mov    (%eax),%edx
+  8009d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009dc:	83 c4 10             	add    $0x10,%esp
+  8009df:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009e5:	be 10 00 00 00       	mov    $0x10,%esi
+  8009ea:	83 ec 0c             	sub    $0xc,%esp
+  8009ed:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8009f1:	50                   	push   %eax
+  8009f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8009f5:	56                   	push   %esi
+  8009f6:	51                   	push   %ecx
+  8009f7:	52                   	push   %edx
+  8009f8:	89 da                	mov    %ebx,%edx
+  8009fa:	89 f8                	mov    %edi,%eax
+  8009fc:	e8 d8 fa ff ff       	call   8004d9 <printnum>
+  800a01:	83 c4 20             	add    $0x20,%esp
+  800a04:	e9 cc fb ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800a09:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a0c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a0f:	83 f9 01             	cmp    $0x1,%ecx
+  800a12:	7f 1b                	jg     800a2f <vprintfmt+0x46b>
+  800a14:	85 c9                	test   %ecx,%ecx
+  800a16:	74 2c                	je     800a44 <vprintfmt+0x480>
+  800a18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1b:	8b 10                	mov    (%eax),%edx
+  800a1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a22:	8d 40 04             	lea    0x4(%eax),%eax
+  800a25:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a28:	be 10 00 00 00       	mov    $0x10,%esi
+  800a2d:	eb bb                	jmp    8009ea <vprintfmt+0x426>
+  800a2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a32:	8b 10                	mov    (%eax),%edx
+  800a34:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a37:	8d 40 08             	lea    0x8(%eax),%eax
+  800a3a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a3d:	be 10 00 00 00       	mov    $0x10,%esi
+  800a42:	eb a6                	jmp    8009ea <vprintfmt+0x426>
+  800a44:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a47:	8b 10                	mov    (%eax),%edx
+  800a49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4e:	8d 40 04             	lea    0x4(%eax),%eax
+  800a51:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a54:	be 10 00 00 00       	mov    $0x10,%esi
+  800a59:	eb 8f                	jmp    8009ea <vprintfmt+0x426>
+  800a5b:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a5e:	83 ec 08             	sub    $0x8,%esp
+  800a61:	53                   	push   %ebx
+  800a62:	6a 25                	push   $0x25
+  800a64:	ff d7                	call   *%edi
+  800a66:	83 c4 10             	add    $0x10,%esp
+  800a69:	e9 67 fb ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800a6e:	83 ec 08             	sub    $0x8,%esp
+  800a71:	53                   	push   %ebx
+  800a72:	6a 25                	push   $0x25
+  800a74:	ff d7                	call   *%edi
+  800a76:	83 c4 10             	add    $0x10,%esp
+  800a79:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a7d:	0f 84 ba fb ff ff    	je     80063d <vprintfmt+0x79>
+  800a83:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a86:	89 f0                	mov    %esi,%eax
+  800a88:	83 e8 01             	sub    $0x1,%eax
+  800a8b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a8f:	75 f7                	jne    800a88 <vprintfmt+0x4c4>
+  800a91:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a94:	e9 3c fb ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800a99:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a9c:	8d 70 01             	lea    0x1(%eax),%esi
+  800a9f:	0f b6 00             	movzbl (%eax),%eax
+  800aa2:	0f be d0             	movsbl %al,%edx
+  800aa5:	85 d2                	test   %edx,%edx
+  800aa7:	74 11                	je     800aba <vprintfmt+0x4f6>
+  800aa9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800aac:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800aaf:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ab2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ab5:	e9 5d fd ff ff       	jmp    800817 <vprintfmt+0x253>
+  800aba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800abd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac0:	e9 10 fb ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800ac5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ac8:	89 45 14             	mov    %eax,0x14(%ebp)
+  800acb:	e9 05 fb ff ff       	jmp    8005d5 <vprintfmt+0x11>
+  800ad0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800ad4:	7e 0a                	jle    800ae0 <vprintfmt+0x51c>
+  800ad6:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800ada:	0f 85 bd fc ff ff    	jne    80079d <vprintfmt+0x1d9>
+  800ae0:	ba 28 00 00 00       	mov    $0x28,%edx
+  800ae5:	b8 28 00 00 00       	mov    $0x28,%eax
+  800aea:	be 25 3d 80 00       	mov    $0x803d25,%esi
+  800aef:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800af2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800af5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800af8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800afb:	e9 17 fd ff ff       	jmp    800817 <vprintfmt+0x253>
+  800b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b03:	5b                   	pop    %ebx
+  800b04:	5e                   	pop    %esi
+  800b05:	5f                   	pop    %edi
+  800b06:	5d                   	pop    %ebp
+  800b07:	c3                   	ret
+
+00800b08 <vsnprintf>:
+  800b08:	55                   	push   %ebp
+  800b09:	89 e5                	mov    %esp,%ebp
+  800b0b:	83 ec 18             	sub    $0x18,%esp
+  800b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b14:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b17:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b1b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b1e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800b25:	85 c0                	test   %eax,%eax
+  800b27:	74 26                	je     800b4f <vsnprintf+0x47>
+  800b29:	85 d2                	test   %edx,%edx
+  800b2b:	7e 22                	jle    800b4f <vsnprintf+0x47>
+  800b2d:	ff 75 14             	push   0x14(%ebp)
+  800b30:	ff 75 10             	push   0x10(%ebp)
+  800b33:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b36:	50                   	push   %eax
+  800b37:	68 8a 05 80 00       	push   $0x80058a
+  800b3c:	e8 83 fa ff ff       	call   8005c4 <vprintfmt>
+  800b41:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b44:	c6 00 00             	movb   $0x0,(%eax)
+  800b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4a:	83 c4 10             	add    $0x10,%esp
+  800b4d:	c9                   	leave
+  800b4e:	c3                   	ret
+  800b4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b54:	eb f7                	jmp    800b4d <vsnprintf+0x45>
+
+00800b56 <snprintf>:
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	83 ec 08             	sub    $0x8,%esp
+  800b5c:	8d 45 14             	lea    0x14(%ebp),%eax
+  800b5f:	50                   	push   %eax
+  800b60:	ff 75 10             	push   0x10(%ebp)
+  800b63:	ff 75 0c             	push   0xc(%ebp)
+  800b66:	ff 75 08             	push   0x8(%ebp)
+  800b69:	e8 9a ff ff ff       	call   800b08 <vsnprintf>
+  800b6e:	c9                   	leave
+  800b6f:	c3                   	ret
+
+00800b70 <strlen>:
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b76:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b79:	74 10                	je     800b8b <strlen+0x1b>
+  800b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b80:	83 c0 01             	add    $0x1,%eax
+  800b83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b87:	75 f7                	jne    800b80 <strlen+0x10>
+  800b89:	5d                   	pop    %ebp
+  800b8a:	c3                   	ret
+  800b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b90:	eb f7                	jmp    800b89 <strlen+0x19>
+
+00800b92 <strnlen>:
+  800b92:	55                   	push   %ebp
+  800b93:	89 e5                	mov    %esp,%ebp
+  800b95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b9b:	85 d2                	test   %edx,%edx
+  800b9d:	74 16                	je     800bb5 <strnlen+0x23>
+  800b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ba8:	74 09                	je     800bb3 <strnlen+0x21>
+  800baa:	83 c0 01             	add    $0x1,%eax
+  800bad:	39 d0                	cmp    %edx,%eax
+  800baf:	75 f3                	jne    800ba4 <strnlen+0x12>
+  800bb1:	89 d0                	mov    %edx,%eax
+  800bb3:	5d                   	pop    %ebp
+  800bb4:	c3                   	ret
+  800bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bba:	eb f7                	jmp    800bb3 <strnlen+0x21>
+
+00800bbc <strcpy>:
+  800bbc:	55                   	push   %ebp
+  800bbd:	89 e5                	mov    %esp,%ebp
+  800bbf:	53                   	push   %ebx
+  800bc0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bcf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bd2:	83 c0 01             	add    $0x1,%eax
+  800bd5:	84 d2                	test   %dl,%dl
+  800bd7:	75 f2                	jne    800bcb <strcpy+0xf>
+  800bd9:	89 c8                	mov    %ecx,%eax
+  800bdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bde:	c9                   	leave
+  800bdf:	c3                   	ret
+
+00800be0 <strcat>:
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	53                   	push   %ebx
+  800be4:	83 ec 10             	sub    $0x10,%esp
+  800be7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bea:	53                   	push   %ebx
+  800beb:	e8 80 ff ff ff       	call   800b70 <strlen>
+  800bf0:	83 c4 08             	add    $0x8,%esp
+  800bf3:	ff 75 0c             	push   0xc(%ebp)
+  800bf6:	01 d8                	add    %ebx,%eax
+  800bf8:	50                   	push   %eax
+  800bf9:	e8 be ff ff ff       	call   800bbc <strcpy>
+  800bfe:	89 d8                	mov    %ebx,%eax
+  800c00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c03:	c9                   	leave
+  800c04:	c3                   	ret
+
+00800c05 <strncpy>:
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	56                   	push   %esi
+  800c09:	53                   	push   %ebx
+  800c0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c13:	85 db                	test   %ebx,%ebx
+  800c15:	74 17                	je     800c2e <strncpy+0x29>
+  800c17:	01 f3                	add    %esi,%ebx
+  800c19:	89 f0                	mov    %esi,%eax
+  800c1b:	83 c0 01             	add    $0x1,%eax
+  800c1e:	0f b6 0a             	movzbl (%edx),%ecx
+  800c21:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800c24:	80 f9 01             	cmp    $0x1,%cl
+  800c27:	83 da ff             	sbb    $0xffffffff,%edx
+  800c2a:	39 c3                	cmp    %eax,%ebx
+  800c2c:	75 ed                	jne    800c1b <strncpy+0x16>
+  800c2e:	89 f0                	mov    %esi,%eax
+  800c30:	5b                   	pop    %ebx
+  800c31:	5e                   	pop    %esi
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+
+00800c34 <strlcpy>:
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	56                   	push   %esi
+  800c38:	53                   	push   %ebx
+  800c39:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c42:	89 f0                	mov    %esi,%eax
+  800c44:	85 db                	test   %ebx,%ebx
+  800c46:	74 1e                	je     800c66 <strlcpy+0x32>
+  800c48:	83 eb 01             	sub    $0x1,%ebx
+  800c4b:	74 16                	je     800c63 <strlcpy+0x2f>
+  800c4d:	01 f3                	add    %esi,%ebx
+  800c4f:	0f b6 0a             	movzbl (%edx),%ecx
+  800c52:	84 c9                	test   %cl,%cl
+  800c54:	74 0d                	je     800c63 <strlcpy+0x2f>
+  800c56:	83 c2 01             	add    $0x1,%edx
+  800c59:	83 c0 01             	add    $0x1,%eax
+  800c5c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800c5f:	39 d8                	cmp    %ebx,%eax
+  800c61:	75 ec                	jne    800c4f <strlcpy+0x1b>
+  800c63:	c6 00 00             	movb   $0x0,(%eax)
+  800c66:	29 f0                	sub    %esi,%eax
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5d                   	pop    %ebp
+  800c6b:	c3                   	ret
+
+00800c6c <strcmp>:
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c75:	0f b6 01             	movzbl (%ecx),%eax
+  800c78:	84 c0                	test   %al,%al
+  800c7a:	74 11                	je     800c8d <strcmp+0x21>
+  800c7c:	38 02                	cmp    %al,(%edx)
+  800c7e:	75 0d                	jne    800c8d <strcmp+0x21>
+  800c80:	83 c1 01             	add    $0x1,%ecx
+  800c83:	83 c2 01             	add    $0x1,%edx
+  800c86:	0f b6 01             	movzbl (%ecx),%eax
+  800c89:	84 c0                	test   %al,%al
+  800c8b:	75 ef                	jne    800c7c <strcmp+0x10>
+  800c8d:	0f b6 c0             	movzbl %al,%eax
+  800c90:	0f b6 12             	movzbl (%edx),%edx
+  800c93:	29 d0                	sub    %edx,%eax
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+
+00800c97 <strncmp>:
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	53                   	push   %ebx
+  800c9b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c9e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ca1:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca9:	85 d2                	test   %edx,%edx
+  800cab:	74 2e                	je     800cdb <strncmp+0x44>
+  800cad:	0f b6 01             	movzbl (%ecx),%eax
+  800cb0:	84 c0                	test   %al,%al
+  800cb2:	74 16                	je     800cca <strncmp+0x33>
+  800cb4:	3a 03                	cmp    (%ebx),%al
+  800cb6:	75 12                	jne    800cca <strncmp+0x33>
+  800cb8:	83 c1 01             	add    $0x1,%ecx
+  800cbb:	83 c3 01             	add    $0x1,%ebx
+  800cbe:	83 ea 01             	sub    $0x1,%edx
+  800cc1:	75 ea                	jne    800cad <strncmp+0x16>
+  800cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc8:	eb 11                	jmp    800cdb <strncmp+0x44>
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	85 d2                	test   %edx,%edx
+  800cd1:	74 08                	je     800cdb <strncmp+0x44>
+  800cd3:	0f b6 01             	movzbl (%ecx),%eax
+  800cd6:	0f b6 13             	movzbl (%ebx),%edx
+  800cd9:	29 d0                	sub    %edx,%eax
+  800cdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cde:	c9                   	leave
+  800cdf:	c3                   	ret
+
+00800ce0 <strchr>:
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800cea:	0f b6 10             	movzbl (%eax),%edx
+  800ced:	84 d2                	test   %dl,%dl
+  800cef:	74 15                	je     800d06 <strchr+0x26>
+  800cf1:	38 d1                	cmp    %dl,%cl
+  800cf3:	74 0f                	je     800d04 <strchr+0x24>
+  800cf5:	83 c0 01             	add    $0x1,%eax
+  800cf8:	0f b6 10             	movzbl (%eax),%edx
+  800cfb:	84 d2                	test   %dl,%dl
+  800cfd:	75 f2                	jne    800cf1 <strchr+0x11>
+  800cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+  800d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0b:	eb f7                	jmp    800d04 <strchr+0x24>
+
+00800d0d <strfind>:
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	53                   	push   %ebx
+  800d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d14:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d17:	0f b6 18             	movzbl (%eax),%ebx
+  800d1a:	38 d3                	cmp    %dl,%bl
+  800d1c:	74 14                	je     800d32 <strfind+0x25>
+  800d1e:	89 d1                	mov    %edx,%ecx
+  800d20:	84 db                	test   %bl,%bl
+  800d22:	74 0e                	je     800d32 <strfind+0x25>
+  800d24:	83 c0 01             	add    $0x1,%eax
+  800d27:	0f b6 10             	movzbl (%eax),%edx
+  800d2a:	38 ca                	cmp    %cl,%dl
+  800d2c:	74 04                	je     800d32 <strfind+0x25>
+  800d2e:	84 d2                	test   %dl,%dl
+  800d30:	75 f2                	jne    800d24 <strfind+0x17>
+  800d32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d35:	c9                   	leave
+  800d36:	c3                   	ret
+
+00800d37 <memset>:
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d3e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800d41:	85 c9                	test   %ecx,%ecx
+  800d43:	74 20                	je     800d65 <memset+0x2e>
+  800d45:	89 f8                	mov    %edi,%eax
+  800d47:	09 c8                	or     %ecx,%eax
+  800d49:	a8 03                	test   $0x3,%al
+  800d4b:	75 12                	jne    800d5f <memset+0x28>
+  800d4d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d51:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800d57:	c1 e9 02             	shr    $0x2,%ecx
+  800d5a:	fc                   	cld
+  800d5b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d5d:	eb 06                	jmp    800d65 <memset+0x2e>
+  800d5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d62:	fc                   	cld
+  800d63:	f3 aa                	rep stos %al,%es:(%edi)
+  800d65:	89 f8                	mov    %edi,%eax
+  800d67:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d6a:	c9                   	leave
+  800d6b:	c3                   	ret
+
+00800d6c <memmove>:
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	57                   	push   %edi
+  800d70:	56                   	push   %esi
+  800d71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d74:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d77:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800d7a:	39 c6                	cmp    %eax,%esi
+  800d7c:	73 32                	jae    800db0 <memmove+0x44>
+  800d7e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d81:	39 d0                	cmp    %edx,%eax
+  800d83:	73 2b                	jae    800db0 <memmove+0x44>
+  800d85:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800d88:	89 d6                	mov    %edx,%esi
+  800d8a:	09 fe                	or     %edi,%esi
+  800d8c:	09 ce                	or     %ecx,%esi
+  800d8e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d94:	75 0e                	jne    800da4 <memmove+0x38>
+  800d96:	83 ef 04             	sub    $0x4,%edi
+  800d99:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d9c:	c1 e9 02             	shr    $0x2,%ecx
+  800d9f:	fd                   	std
+  800da0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800da2:	eb 09                	jmp    800dad <memmove+0x41>
+  800da4:	83 ef 01             	sub    $0x1,%edi
+  800da7:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800daa:	fd                   	std
+  800dab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800dad:	fc                   	cld
+  800dae:	eb 1a                	jmp    800dca <memmove+0x5e>
+  800db0:	89 f2                	mov    %esi,%edx
+  800db2:	09 c2                	or     %eax,%edx
+  800db4:	09 ca                	or     %ecx,%edx
+  800db6:	f6 c2 03             	test   $0x3,%dl
+  800db9:	75 0a                	jne    800dc5 <memmove+0x59>
+  800dbb:	c1 e9 02             	shr    $0x2,%ecx
+  800dbe:	89 c7                	mov    %eax,%edi
+  800dc0:	fc                   	cld
+  800dc1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dc3:	eb 05                	jmp    800dca <memmove+0x5e>
+  800dc5:	89 c7                	mov    %eax,%edi
+  800dc7:	fc                   	cld
+  800dc8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+
+00800dce <memcpy>:
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	83 ec 0c             	sub    $0xc,%esp
+  800dd4:	ff 75 10             	push   0x10(%ebp)
+  800dd7:	ff 75 0c             	push   0xc(%ebp)
+  800dda:	ff 75 08             	push   0x8(%ebp)
+  800ddd:	e8 8a ff ff ff       	call   800d6c <memmove>
+  800de2:	c9                   	leave
+  800de3:	c3                   	ret
+
+00800de4 <memcmp>:
+  800de4:	55                   	push   %ebp
+  800de5:	89 e5                	mov    %esp,%ebp
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800def:	8b 75 10             	mov    0x10(%ebp),%esi
+  800df2:	85 f6                	test   %esi,%esi
+  800df4:	74 29                	je     800e1f <memcmp+0x3b>
+  800df6:	01 c6                	add    %eax,%esi
+  800df8:	0f b6 08             	movzbl (%eax),%ecx
+  800dfb:	0f b6 1a             	movzbl (%edx),%ebx
+  800dfe:	38 d9                	cmp    %bl,%cl
+  800e00:	75 11                	jne    800e13 <memcmp+0x2f>
+  800e02:	83 c0 01             	add    $0x1,%eax
+  800e05:	83 c2 01             	add    $0x1,%edx
+  800e08:	39 c6                	cmp    %eax,%esi
+  800e0a:	75 ec                	jne    800df8 <memcmp+0x14>
+  800e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e11:	eb 08                	jmp    800e1b <memcmp+0x37>
+  800e13:	0f b6 c1             	movzbl %cl,%eax
+  800e16:	0f b6 db             	movzbl %bl,%ebx
+  800e19:	29 d8                	sub    %ebx,%eax
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+  800e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e24:	eb f5                	jmp    800e1b <memcmp+0x37>
+
+00800e26 <memfind>:
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2f:	89 c2                	mov    %eax,%edx
+  800e31:	03 55 10             	add    0x10(%ebp),%edx
+  800e34:	39 d0                	cmp    %edx,%eax
+  800e36:	73 0d                	jae    800e45 <memfind+0x1f>
+  800e38:	38 08                	cmp    %cl,(%eax)
+  800e3a:	74 0d                	je     800e49 <memfind+0x23>
+  800e3c:	83 c0 01             	add    $0x1,%eax
+  800e3f:	39 c2                	cmp    %eax,%edx
+  800e41:	75 f5                	jne    800e38 <memfind+0x12>
+  800e43:	eb 06                	jmp    800e4b <memfind+0x25>
+  800e45:	89 c2                	mov    %eax,%edx
+  800e47:	eb 02                	jmp    800e4b <memfind+0x25>
+  800e49:	89 c2                	mov    %eax,%edx
+  800e4b:	89 d0                	mov    %edx,%eax
+  800e4d:	5d                   	pop    %ebp
+  800e4e:	c3                   	ret
+
+00800e4f <strtol>:
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	56                   	push   %esi
+  800e54:	53                   	push   %ebx
+  800e55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5b:	0f b6 02             	movzbl (%edx),%eax
+  800e5e:	3c 20                	cmp    $0x20,%al
+  800e60:	74 04                	je     800e66 <strtol+0x17>
+  800e62:	3c 09                	cmp    $0x9,%al
+  800e64:	75 0e                	jne    800e74 <strtol+0x25>
+  800e66:	83 c2 01             	add    $0x1,%edx
+  800e69:	0f b6 02             	movzbl (%edx),%eax
+  800e6c:	3c 20                	cmp    $0x20,%al
+  800e6e:	74 f6                	je     800e66 <strtol+0x17>
+  800e70:	3c 09                	cmp    $0x9,%al
+  800e72:	74 f2                	je     800e66 <strtol+0x17>
+  800e74:	3c 2b                	cmp    $0x2b,%al
+  800e76:	74 2a                	je     800ea2 <strtol+0x53>
+  800e78:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e7d:	3c 2d                	cmp    $0x2d,%al
+  800e7f:	74 2b                	je     800eac <strtol+0x5d>
+  800e81:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e87:	75 0f                	jne    800e98 <strtol+0x49>
+  800e89:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e8c:	74 28                	je     800eb6 <strtol+0x67>
+  800e8e:	85 db                	test   %ebx,%ebx
+  800e90:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e95:	0f 44 d8             	cmove  %eax,%ebx
+  800e98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ea0:	eb 46                	jmp    800ee8 <strtol+0x99>
+  800ea2:	83 c2 01             	add    $0x1,%edx
+  800ea5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eaa:	eb d5                	jmp    800e81 <strtol+0x32>
+  800eac:	83 c2 01             	add    $0x1,%edx
+  800eaf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800eb4:	eb cb                	jmp    800e81 <strtol+0x32>
+  800eb6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800eba:	74 0e                	je     800eca <strtol+0x7b>
+  800ebc:	85 db                	test   %ebx,%ebx
+  800ebe:	75 d8                	jne    800e98 <strtol+0x49>
+  800ec0:	83 c2 01             	add    $0x1,%edx
+  800ec3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ec8:	eb ce                	jmp    800e98 <strtol+0x49>
+  800eca:	83 c2 02             	add    $0x2,%edx
+  800ecd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ed2:	eb c4                	jmp    800e98 <strtol+0x49>
+  800ed4:	0f be c0             	movsbl %al,%eax
+  800ed7:	83 e8 30             	sub    $0x30,%eax
+  800eda:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800edd:	7d 3a                	jge    800f19 <strtol+0xca>
+  800edf:	83 c2 01             	add    $0x1,%edx
+  800ee2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ee6:	01 c1                	add    %eax,%ecx
+  800ee8:	0f b6 02             	movzbl (%edx),%eax
+  800eeb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800eee:	89 f3                	mov    %esi,%ebx
+  800ef0:	80 fb 09             	cmp    $0x9,%bl
+  800ef3:	76 df                	jbe    800ed4 <strtol+0x85>
+  800ef5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ef8:	89 f3                	mov    %esi,%ebx
+  800efa:	80 fb 19             	cmp    $0x19,%bl
+  800efd:	77 08                	ja     800f07 <strtol+0xb8>
+  800eff:	0f be c0             	movsbl %al,%eax
+  800f02:	83 e8 57             	sub    $0x57,%eax
+  800f05:	eb d3                	jmp    800eda <strtol+0x8b>
+  800f07:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f0a:	89 f3                	mov    %esi,%ebx
+  800f0c:	80 fb 19             	cmp    $0x19,%bl
+  800f0f:	77 08                	ja     800f19 <strtol+0xca>
+  800f11:	0f be c0             	movsbl %al,%eax
+  800f14:	83 e8 37             	sub    $0x37,%eax
+  800f17:	eb c1                	jmp    800eda <strtol+0x8b>
+  800f19:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f1d:	74 05                	je     800f24 <strtol+0xd5>
+  800f1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f22:	89 10                	mov    %edx,(%eax)
+  800f24:	89 c8                	mov    %ecx,%eax
+  800f26:	f7 d8                	neg    %eax
+  800f28:	85 ff                	test   %edi,%edi
+  800f2a:	0f 45 c8             	cmovne %eax,%ecx
+  800f2d:	89 c8                	mov    %ecx,%eax
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+
+00800f34 <sys_cputs>:
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	57                   	push   %edi
+  800f38:	56                   	push   %esi
+  800f39:	53                   	push   %ebx
+  800f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f45:	89 c3                	mov    %eax,%ebx
+  800f47:	89 c7                	mov    %eax,%edi
+  800f49:	89 c6                	mov    %eax,%esi
+  800f4b:	cd 30                	int    $0x30
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+
+00800f52 <sys_cgetc>:
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+  800f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f62:	89 d1                	mov    %edx,%ecx
+  800f64:	89 d3                	mov    %edx,%ebx
+  800f66:	89 d7                	mov    %edx,%edi
+  800f68:	89 d6                	mov    %edx,%esi
+  800f6a:	cd 30                	int    $0x30
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+
+00800f71 <sys_env_destroy>:
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+  800f7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f82:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f87:	89 cb                	mov    %ecx,%ebx
+  800f89:	89 cf                	mov    %ecx,%edi
+  800f8b:	89 ce                	mov    %ecx,%esi
+  800f8d:	cd 30                	int    $0x30
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	7f 08                	jg     800f9b <sys_env_destroy+0x2a>
+  800f93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	50                   	push   %eax
+  800f9f:	6a 03                	push   $0x3
+  800fa1:	68 2b 40 80 00       	push   $0x80402b
+  800fa6:	6a 24                	push   $0x24
+  800fa8:	68 48 40 80 00       	push   $0x804048
+  800fad:	e8 38 f4 ff ff       	call   8003ea <_panic>
+
+00800fb2 <sys_getenvid>:
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+  800fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fc2:	89 d1                	mov    %edx,%ecx
+  800fc4:	89 d3                	mov    %edx,%ebx
+  800fc6:	89 d7                	mov    %edx,%edi
+  800fc8:	89 d6                	mov    %edx,%esi
+  800fca:	cd 30                	int    $0x30
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+
+00800fd1 <sys_yield>:
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  800fd7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fde:	74 26                	je     801006 <sys_yield+0x35>
+  800fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fea:	89 d1                	mov    %edx,%ecx
+  800fec:	89 d3                	mov    %edx,%ebx
+  800fee:	89 d7                	mov    %edx,%edi
+  800ff0:	6a 00                	push   $0x0
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	8d 35 fd 0f 80 00    	lea    0x800ffd,%esi
+  800ffb:	0f 34                	sysenter
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	83 c4 04             	add    $0x4,%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+  801006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801010:	89 d1                	mov    %edx,%ecx
+  801012:	89 d3                	mov    %edx,%ebx
+  801014:	89 d7                	mov    %edx,%edi
+  801016:	89 d6                	mov    %edx,%esi
+  801018:	cd 30                	int    $0x30
+  80101a:	eb e5                	jmp    801001 <sys_yield+0x30>
+
+0080101c <sys_page_alloc>:
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	83 ec 0c             	sub    $0xc,%esp
+  801025:	be 00 00 00 00       	mov    $0x0,%esi
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 04 00 00 00       	mov    $0x4,%eax
+  801035:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801038:	89 f7                	mov    %esi,%edi
+  80103a:	cd 30                	int    $0x30
+  80103c:	85 c0                	test   %eax,%eax
+  80103e:	7f 08                	jg     801048 <sys_page_alloc+0x2c>
+  801040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+  801048:	83 ec 0c             	sub    $0xc,%esp
+  80104b:	50                   	push   %eax
+  80104c:	6a 04                	push   $0x4
+  80104e:	68 2b 40 80 00       	push   $0x80402b
+  801053:	6a 24                	push   $0x24
+  801055:	68 48 40 80 00       	push   $0x804048
+  80105a:	e8 8b f3 ff ff       	call   8003ea <_panic>
+
+0080105f <sys_page_map>:
+  80105f:	55                   	push   %ebp
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	57                   	push   %edi
+  801063:	56                   	push   %esi
+  801064:	53                   	push   %ebx
+  801065:	83 ec 0c             	sub    $0xc,%esp
+  801068:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80106f:	74 33                	je     8010a4 <sys_page_map+0x45>
+  801071:	8b 55 08             	mov    0x8(%ebp),%edx
+  801074:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801077:	b8 05 00 00 00       	mov    $0x5,%eax
+  80107c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801082:	ff 75 18             	push   0x18(%ebp)
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	8d 35 90 10 80 00    	lea    0x801090,%esi
+  80108e:	0f 34                	sysenter
+  801090:	5d                   	pop    %ebp
+  801091:	83 c4 04             	add    $0x4,%esp
+  801094:	89 c2                	mov    %eax,%edx
+  801096:	85 c0                	test   %eax,%eax
+  801098:	7f 3d                	jg     8010d7 <sys_page_map+0x78>
+  80109a:	89 d0                	mov    %edx,%eax
+  80109c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5f                   	pop    %edi
+  8010a2:	5d                   	pop    %ebp
+  8010a3:	c3                   	ret
+  8010a4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010b8:	cd 30                	int    $0x30
+  8010ba:	89 c2                	mov    %eax,%edx
+  8010bc:	85 c0                	test   %eax,%eax
+  8010be:	7e da                	jle    80109a <sys_page_map+0x3b>
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+  8010c3:	50                   	push   %eax
+  8010c4:	6a 05                	push   $0x5
+  8010c6:	68 2b 40 80 00       	push   $0x80402b
+  8010cb:	6a 24                	push   $0x24
+  8010cd:	68 48 40 80 00       	push   $0x804048
+  8010d2:	e8 13 f3 ff ff       	call   8003ea <_panic>
+  8010d7:	83 ec 0c             	sub    $0xc,%esp
+  8010da:	50                   	push   %eax
+  8010db:	6a 05                	push   $0x5
+  8010dd:	68 2b 40 80 00       	push   $0x80402b
+  8010e2:	6a 48                	push   $0x48
+  8010e4:	68 48 40 80 00       	push   $0x804048
+  8010e9:	e8 fc f2 ff ff       	call   8003ea <_panic>
+
+008010ee <sys_page_unmap>:
+  8010ee:	55                   	push   %ebp
+  8010ef:	89 e5                	mov    %esp,%ebp
+  8010f1:	57                   	push   %edi
+  8010f2:	56                   	push   %esi
+  8010f3:	53                   	push   %ebx
+  8010f4:	83 ec 0c             	sub    $0xc,%esp
+  8010f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801102:	b8 06 00 00 00       	mov    $0x6,%eax
+  801107:	89 df                	mov    %ebx,%edi
+  801109:	89 de                	mov    %ebx,%esi
+  80110b:	cd 30                	int    $0x30
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	7f 08                	jg     801119 <sys_page_unmap+0x2b>
+  801111:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801114:	5b                   	pop    %ebx
+  801115:	5e                   	pop    %esi
+  801116:	5f                   	pop    %edi
+  801117:	5d                   	pop    %ebp
+  801118:	c3                   	ret
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	50                   	push   %eax
+  80111d:	6a 06                	push   $0x6
+  80111f:	68 2b 40 80 00       	push   $0x80402b
+  801124:	6a 24                	push   $0x24
+  801126:	68 48 40 80 00       	push   $0x804048
+  80112b:	e8 ba f2 ff ff       	call   8003ea <_panic>
+
+00801130 <sys_fork>:
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	57                   	push   %edi
+  801134:	56                   	push   %esi
+  801135:	53                   	push   %ebx
+  801136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801140:	89 d1                	mov    %edx,%ecx
+  801142:	89 d3                	mov    %edx,%ebx
+  801144:	89 d7                	mov    %edx,%edi
+  801146:	89 d6                	mov    %edx,%esi
+  801148:	cd 30                	int    $0x30
+  80114a:	5b                   	pop    %ebx
+  80114b:	5e                   	pop    %esi
+  80114c:	5f                   	pop    %edi
+  80114d:	5d                   	pop    %ebp
+  80114e:	c3                   	ret
+
+0080114f <sys_env_set_status>:
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	57                   	push   %edi
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+  801155:	83 ec 0c             	sub    $0xc,%esp
+  801158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	b8 08 00 00 00       	mov    $0x8,%eax
+  801168:	89 df                	mov    %ebx,%edi
+  80116a:	89 de                	mov    %ebx,%esi
+  80116c:	cd 30                	int    $0x30
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 08                	jg     80117a <sys_env_set_status+0x2b>
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	50                   	push   %eax
+  80117e:	6a 08                	push   $0x8
+  801180:	68 2b 40 80 00       	push   $0x80402b
+  801185:	6a 24                	push   $0x24
+  801187:	68 48 40 80 00       	push   $0x804048
+  80118c:	e8 59 f2 ff ff       	call   8003ea <_panic>
+
+00801191 <sys_env_set_trapframe>:
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+  801197:	83 ec 0c             	sub    $0xc,%esp
+  80119a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011aa:	89 df                	mov    %ebx,%edi
+  8011ac:	89 de                	mov    %ebx,%esi
+  8011ae:	cd 30                	int    $0x30
+  8011b0:	85 c0                	test   %eax,%eax
+  8011b2:	7f 08                	jg     8011bc <sys_env_set_trapframe+0x2b>
+  8011b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+  8011bf:	50                   	push   %eax
+  8011c0:	6a 09                	push   $0x9
+  8011c2:	68 2b 40 80 00       	push   $0x80402b
+  8011c7:	6a 24                	push   $0x24
+  8011c9:	68 48 40 80 00       	push   $0x804048
+  8011ce:	e8 17 f2 ff ff       	call   8003ea <_panic>
+
+008011d3 <sys_env_set_cow>:
+  8011d3:	55                   	push   %ebp
+  8011d4:	89 e5                	mov    %esp,%ebp
+  8011d6:	57                   	push   %edi
+  8011d7:	56                   	push   %esi
+  8011d8:	53                   	push   %ebx
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+  8011dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8011ec:	89 df                	mov    %ebx,%edi
+  8011ee:	89 de                	mov    %ebx,%esi
+  8011f0:	cd 30                	int    $0x30
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	7f 08                	jg     8011fe <sys_env_set_cow+0x2b>
+  8011f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+  8011fe:	83 ec 0c             	sub    $0xc,%esp
+  801201:	50                   	push   %eax
+  801202:	6a 20                	push   $0x20
+  801204:	68 2b 40 80 00       	push   $0x80402b
+  801209:	6a 24                	push   $0x24
+  80120b:	68 48 40 80 00       	push   $0x804048
+  801210:	e8 d5 f1 ff ff       	call   8003ea <_panic>
+
+00801215 <sys_env_service>:
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	57                   	push   %edi
+  801219:	56                   	push   %esi
+  80121a:	53                   	push   %ebx
+  80121b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801220:	8b 55 08             	mov    0x8(%ebp),%edx
+  801223:	b8 21 00 00 00       	mov    $0x21,%eax
+  801228:	89 cb                	mov    %ecx,%ebx
+  80122a:	89 cf                	mov    %ecx,%edi
+  80122c:	89 ce                	mov    %ecx,%esi
+  80122e:	cd 30                	int    $0x30
+  801230:	5b                   	pop    %ebx
+  801231:	5e                   	pop    %esi
+  801232:	5f                   	pop    %edi
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+
+00801235 <sys_env_set_pgfault_upcall>:
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+  80123b:	83 ec 0c             	sub    $0xc,%esp
+  80123e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+  801246:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801249:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80124e:	89 df                	mov    %ebx,%edi
+  801250:	89 de                	mov    %ebx,%esi
+  801252:	cd 30                	int    $0x30
+  801254:	85 c0                	test   %eax,%eax
+  801256:	7f 08                	jg     801260 <sys_env_set_pgfault_upcall+0x2b>
+  801258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125b:	5b                   	pop    %ebx
+  80125c:	5e                   	pop    %esi
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+  801260:	83 ec 0c             	sub    $0xc,%esp
+  801263:	50                   	push   %eax
+  801264:	6a 0a                	push   $0xa
+  801266:	68 2b 40 80 00       	push   $0x80402b
+  80126b:	6a 24                	push   $0x24
+  80126d:	68 48 40 80 00       	push   $0x804048
+  801272:	e8 73 f1 ff ff       	call   8003ea <_panic>
+
+00801277 <sys_ipc_try_send>:
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	57                   	push   %edi
+  80127b:	56                   	push   %esi
+  80127c:	53                   	push   %ebx
+  80127d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801284:	74 27                	je     8012ad <sys_ipc_try_send+0x36>
+  801286:	8b 55 08             	mov    0x8(%ebp),%edx
+  801289:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801291:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801294:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801297:	6a 00                	push   $0x0
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	8d 35 a4 12 80 00    	lea    0x8012a4,%esi
+  8012a2:	0f 34                	sysenter
+  8012a4:	5d                   	pop    %ebp
+  8012a5:	83 c4 04             	add    $0x4,%esp
+  8012a8:	5b                   	pop    %ebx
+  8012a9:	5e                   	pop    %esi
+  8012aa:	5f                   	pop    %edi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+  8012ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c3:	cd 30                	int    $0x30
+  8012c5:	eb e1                	jmp    8012a8 <sys_ipc_try_send+0x31>
+
+008012c7 <sys_ipc_recv>:
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	57                   	push   %edi
+  8012cb:	56                   	push   %esi
+  8012cc:	53                   	push   %ebx
+  8012cd:	83 ec 0c             	sub    $0xc,%esp
+  8012d0:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012d7:	74 32                	je     80130b <sys_ipc_recv+0x44>
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012e6:	89 cb                	mov    %ecx,%ebx
+  8012e8:	89 cf                	mov    %ecx,%edi
+  8012ea:	6a 00                	push   $0x0
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	8d 35 f7 12 80 00    	lea    0x8012f7,%esi
+  8012f5:	0f 34                	sysenter
+  8012f7:	5d                   	pop    %ebp
+  8012f8:	83 c4 04             	add    $0x4,%esp
+  8012fb:	89 c2                	mov    %eax,%edx
+  8012fd:	85 c0                	test   %eax,%eax
+  8012ff:	7f 3c                	jg     80133d <sys_ipc_recv+0x76>
+  801301:	89 d0                	mov    %edx,%eax
+  801303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+  80130b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801310:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801315:	8b 55 08             	mov    0x8(%ebp),%edx
+  801318:	89 cb                	mov    %ecx,%ebx
+  80131a:	89 cf                	mov    %ecx,%edi
+  80131c:	89 ce                	mov    %ecx,%esi
+  80131e:	cd 30                	int    $0x30
+  801320:	89 c2                	mov    %eax,%edx
+  801322:	85 c0                	test   %eax,%eax
+  801324:	7e db                	jle    801301 <sys_ipc_recv+0x3a>
+  801326:	83 ec 0c             	sub    $0xc,%esp
+  801329:	50                   	push   %eax
+  80132a:	6a 0d                	push   $0xd
+  80132c:	68 2b 40 80 00       	push   $0x80402b
+  801331:	6a 24                	push   $0x24
+  801333:	68 48 40 80 00       	push   $0x804048
+  801338:	e8 ad f0 ff ff       	call   8003ea <_panic>
+  80133d:	83 ec 0c             	sub    $0xc,%esp
+  801340:	50                   	push   %eax
+  801341:	6a 0d                	push   $0xd
+  801343:	68 2b 40 80 00       	push   $0x80402b
+  801348:	6a 48                	push   $0x48
+  80134a:	68 48 40 80 00       	push   $0x804048
+  80134f:	e8 96 f0 ff ff       	call   8003ea <_panic>
+
+00801354 <sys_ipc_send>:
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  801357:	57                   	push   %edi
+  801358:	56                   	push   %esi
+  801359:	53                   	push   %ebx
+  80135a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801361:	74 27                	je     80138a <sys_ipc_send+0x36>
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+  801366:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801369:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80136e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801371:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801374:	6a 00                	push   $0x0
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	8d 35 81 13 80 00    	lea    0x801381,%esi
+  80137f:	0f 34                	sysenter
+  801381:	5d                   	pop    %ebp
+  801382:	83 c4 04             	add    $0x4,%esp
+  801385:	5b                   	pop    %ebx
+  801386:	5e                   	pop    %esi
+  801387:	5f                   	pop    %edi
+  801388:	5d                   	pop    %ebp
+  801389:	c3                   	ret
+  80138a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80138f:	be 00 00 00 00       	mov    $0x0,%esi
+  801394:	8b 55 08             	mov    0x8(%ebp),%edx
+  801397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013a0:	cd 30                	int    $0x30
+  8013a2:	eb e1                	jmp    801385 <sys_ipc_send+0x31>
+
+008013a4 <sys_ipc_call>:
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  8013a7:	57                   	push   %edi
+  8013a8:	56                   	push   %esi
+  8013a9:	53                   	push   %ebx
+  8013aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013bb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013be:	cd 30                	int    $0x30
+  8013c0:	5b                   	pop    %ebx
+  8013c1:	5e                   	pop    %esi
+  8013c2:	5f                   	pop    %edi
+  8013c3:	5d                   	pop    %ebp
+  8013c4:	c3                   	ret
+
+008013c5 <sys_ipc_reply_recv>:
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	57                   	push   %edi
+  8013c9:	56                   	push   %esi
+  8013ca:	53                   	push   %ebx
+  8013cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013dc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013df:	cd 30                	int    $0x30
+  8013e1:	5b                   	pop    %ebx
+  8013e2:	5e                   	pop    %esi
+  8013e3:	5f                   	pop    %edi
+  8013e4:	5d                   	pop    %ebp
+  8013e5:	c3                   	ret
+
+008013e6 <sys_time_msec>:
+  8013e6:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8013eb:	85 c0                	test   %eax,%eax
+  8013ed:	75 06                	jne    8013f5 <sys_time_msec+0xf>
+  8013ef:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8013f4:	c3                   	ret
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	57                   	push   %edi
+  8013f9:	56                   	push   %esi
+  8013fa:	53                   	push   %ebx
+  8013fb:	83 ec 0c             	sub    $0xc,%esp
+  8013fe:	0f 31                	rdtsc
+  801400:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801406:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80140c:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801412:	29 c8                	sub    %ecx,%eax
+  801414:	19 da                	sbb    %ebx,%edx
+  801416:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141b:	57                   	push   %edi
+  80141c:	56                   	push   %esi
+  80141d:	52                   	push   %edx
+  80141e:	50                   	push   %eax
+  80141f:	e8 81 25 00 00       	call   8039a5 <__udivdi3>
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142a:	5b                   	pop    %ebx
+  80142b:	5e                   	pop    %esi
+  80142c:	5f                   	pop    %edi
+  80142d:	5d                   	pop    %ebp
+  80142e:	c3                   	ret
+
+0080142f <sys_env_swap>:
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  801432:	57                   	push   %edi
+  801433:	56                   	push   %esi
+  801434:	53                   	push   %ebx
+  801435:	83 ec 0c             	sub    $0xc,%esp
+  801438:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80143d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801440:	b8 12 00 00 00       	mov    $0x12,%eax
+  801445:	89 cb                	mov    %ecx,%ebx
+  801447:	89 cf                	mov    %ecx,%edi
+  801449:	89 ce                	mov    %ecx,%esi
+  80144b:	cd 30                	int    $0x30
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	7f 08                	jg     801459 <sys_env_swap+0x2a>
+  801451:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5f                   	pop    %edi
+  801457:	5d                   	pop    %ebp
+  801458:	c3                   	ret
+  801459:	83 ec 0c             	sub    $0xc,%esp
+  80145c:	50                   	push   %eax
+  80145d:	6a 12                	push   $0x12
+  80145f:	68 2b 40 80 00       	push   $0x80402b
+  801464:	6a 24                	push   $0x24
+  801466:	68 48 40 80 00       	push   $0x804048
+  80146b:	e8 7a ef ff ff       	call   8003ea <_panic>
+
+00801470 <sys_net_try_send>:
+  801470:	55                   	push   %ebp
+  801471:	89 e5                	mov    %esp,%ebp
+  801473:	57                   	push   %edi
+  801474:	56                   	push   %esi
+  801475:	53                   	push   %ebx
+  801476:	83 ec 0c             	sub    $0xc,%esp
+  801479:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801481:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801484:	b8 13 00 00 00       	mov    $0x13,%eax
+  801489:	89 df                	mov    %ebx,%edi
+  80148b:	89 de                	mov    %ebx,%esi
+  80148d:	cd 30                	int    $0x30
+  80148f:	85 c0                	test   %eax,%eax
+  801491:	7f 08                	jg     80149b <sys_net_try_send+0x2b>
+  801493:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801496:	5b                   	pop    %ebx
+  801497:	5e                   	pop    %esi
+  801498:	5f                   	pop    %edi
+  801499:	5d                   	pop    %ebp
+  80149a:	c3                   	ret
+  80149b:	83 ec 0c             	sub    $0xc,%esp
+  80149e:	50                   	push   %eax
+  80149f:	6a 13                	push   $0x13
+  8014a1:	68 2b 40 80 00       	push   $0x80402b
+  8014a6:	6a 24                	push   $0x24
+  8014a8:	68 48 40 80 00       	push   $0x804048
+  8014ad:	e8 38 ef ff ff       	call   8003ea <_panic>
+
+008014b2 <sys_net_try_receive>:
+  8014b2:	55                   	push   %ebp
+  8014b3:	89 e5                	mov    %esp,%ebp
+  8014b5:	57                   	push   %edi
+  8014b6:	56                   	push   %esi
+  8014b7:	53                   	push   %ebx
+  8014b8:	83 ec 0c             	sub    $0xc,%esp
+  8014bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8014cb:	89 df                	mov    %ebx,%edi
+  8014cd:	89 de                	mov    %ebx,%esi
+  8014cf:	cd 30                	int    $0x30
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	7f 08                	jg     8014dd <sys_net_try_receive+0x2b>
+  8014d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5f                   	pop    %edi
+  8014db:	5d                   	pop    %ebp
+  8014dc:	c3                   	ret
+  8014dd:	83 ec 0c             	sub    $0xc,%esp
+  8014e0:	50                   	push   %eax
+  8014e1:	6a 14                	push   $0x14
+  8014e3:	68 2b 40 80 00       	push   $0x80402b
+  8014e8:	6a 24                	push   $0x24
+  8014ea:	68 48 40 80 00       	push   $0x804048
+  8014ef:	e8 f6 ee ff ff       	call   8003ea <_panic>
+
+008014f4 <sys_net_recv_page>:
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	57                   	push   %edi
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+  8014fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801502:	b8 27 00 00 00       	mov    $0x27,%eax
+  801507:	89 cb                	mov    %ecx,%ebx
+  801509:	89 cf                	mov    %ecx,%edi
+  80150b:	89 ce                	mov    %ecx,%esi
+  80150d:	cd 30                	int    $0x30
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5f                   	pop    %edi
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+
+00801514 <sys_net_wait>:
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+  801517:	57                   	push   %edi
+  801518:	56                   	push   %esi
+  801519:	53                   	push   %ebx
+  80151a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151f:	b8 26 00 00 00       	mov    $0x26,%eax
+  801524:	89 d1                	mov    %edx,%ecx
+  801526:	89 d3                	mov    %edx,%ebx
+  801528:	89 d7                	mov    %edx,%edi
+  80152a:	89 d6                	mov    %edx,%esi
+  80152c:	cd 30                	int    $0x30
+  80152e:	5b                   	pop    %ebx
+  80152f:	5e                   	pop    %esi
+  801530:	5f                   	pop    %edi
+  801531:	5d                   	pop    %ebp
+  801532:	c3                   	ret
+
+00801533 <sys_get_mac>:
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	57                   	push   %edi
+  801537:	56                   	push   %esi
+  801538:	53                   	push   %ebx
+  801539:	83 ec 0c             	sub    $0xc,%esp
+  80153c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801541:	8b 55 08             	mov    0x8(%ebp),%edx
+  801544:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801547:	b8 15 00 00 00       	mov    $0x15,%eax
+  80154c:	89 df                	mov    %ebx,%edi
+  80154e:	89 de                	mov    %ebx,%esi
+  801550:	cd 30                	int    $0x30
+  801552:	85 c0                	test   %eax,%eax
+  801554:	7f 08                	jg     80155e <sys_get_mac+0x2b>
+  801556:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801559:	5b                   	pop    %ebx
+  80155a:	5e                   	pop    %esi
+  80155b:	5f                   	pop    %edi
+  80155c:	5d                   	pop    %ebp
+  80155d:	c3                   	ret
+  80155e:	83 ec 0c             	sub    $0xc,%esp
+  801561:	50                   	push   %eax
+  801562:	6a 15                	push   $0x15
+  801564:	68 2b 40 80 00       	push   $0x80402b
+  801569:	6a 24                	push   $0x24
+  80156b:	68 48 40 80 00       	push   $0x804048
+  801570:	e8 75 ee ff ff       	call   8003ea <_panic>
+
+00801575 <sys_env_lease>:
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	57                   	push   %edi
+  801579:	56                   	push   %esi
+  80157a:	53                   	push   %ebx
+  80157b:	83 ec 0c             	sub    $0xc,%esp
+  80157e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801583:	8b 55 08             	mov    0x8(%ebp),%edx
+  801586:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801589:	b8 16 00 00 00       	mov    $0x16,%eax
+  80158e:	89 df                	mov    %ebx,%edi
+  801590:	89 de                	mov    %ebx,%esi
+  801592:	cd 30                	int    $0x30
+  801594:	85 c0                	test   %eax,%eax
+  801596:	7f 08                	jg     8015a0 <sys_env_lease+0x2b>
+  801598:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159b:	5b                   	pop    %ebx
+  80159c:	5e                   	pop    %esi
+  80159d:	5f                   	pop    %edi
+  80159e:	5d                   	pop    %ebp
+  80159f:	c3                   	ret
+  8015a0:	83 ec 0c             	sub    $0xc,%esp
+  8015a3:	50                   	push   %eax
+  8015a4:	6a 16                	push   $0x16
+  8015a6:	68 2b 40 80 00       	push   $0x80402b
+  8015ab:	6a 24                	push   $0x24
+  8015ad:	68 48 40 80 00       	push   $0x804048
+  8015b2:	e8 33 ee ff ff       	call   8003ea <_panic>
+
+008015b7 <sys_copy_mem>:
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	57                   	push   %edi
+  8015bb:	56                   	push   %esi
+  8015bc:	53                   	push   %ebx
+  8015bd:	83 ec 0c             	sub    $0xc,%esp
+  8015c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015d1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015d4:	cd 30                	int    $0x30
+  8015d6:	85 c0                	test   %eax,%eax
+  8015d8:	7f 08                	jg     8015e2 <sys_copy_mem+0x2b>
+  8015da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015dd:	5b                   	pop    %ebx
+  8015de:	5e                   	pop    %esi
+  8015df:	5f                   	pop    %edi
+  8015e0:	5d                   	pop    %ebp
+  8015e1:	c3                   	ret
+  8015e2:	83 ec 0c             	sub    $0xc,%esp
+  8015e5:	50                   	push   %eax
+  8015e6:	6a 17                	push   $0x17
+  8015e8:	68 2b 40 80 00       	push   $0x80402b
+  8015ed:	6a 24                	push   $0x24
+  8015ef:	68 48 40 80 00       	push   $0x804048
+  8015f4:	e8 f1 ed ff ff       	call   8003ea <_panic>
+
+008015f9 <sys_get_perms>:
+  8015f9:	55                   	push   %ebp
+  8015fa:	89 e5                	mov    %esp,%ebp
+  8015fc:	57                   	push   %edi
+  8015fd:	56                   	push   %esi
+  8015fe:	53                   	push   %ebx
+  8015ff:	83 ec 0c             	sub    $0xc,%esp
+  801602:	be 00 00 00 00       	mov    $0x0,%esi
+  801607:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801612:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801615:	89 f7                	mov    %esi,%edi
+  801617:	cd 30                	int    $0x30
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	7f 08                	jg     801625 <sys_get_perms+0x2c>
+  80161d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801620:	5b                   	pop    %ebx
+  801621:	5e                   	pop    %esi
+  801622:	5f                   	pop    %edi
+  801623:	5d                   	pop    %ebp
+  801624:	c3                   	ret
+  801625:	83 ec 0c             	sub    $0xc,%esp
+  801628:	50                   	push   %eax
+  801629:	6a 18                	push   $0x18
+  80162b:	68 2b 40 80 00       	push   $0x80402b
+  801630:	6a 24                	push   $0x24
+  801632:	68 48 40 80 00       	push   $0x804048
+  801637:	e8 ae ed ff ff       	call   8003ea <_panic>
+
+0080163c <sys_env_unsuspend>:
+  80163c:	55                   	push   %ebp
+  80163d:	89 e5                	mov    %esp,%ebp
+  80163f:	57                   	push   %edi
+  801640:	56                   	push   %esi
+  801641:	53                   	push   %ebx
+  801642:	83 ec 0c             	sub    $0xc,%esp
+  801645:	be 00 00 00 00       	mov    $0x0,%esi
+  80164a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801650:	b8 19 00 00 00       	mov    $0x19,%eax
+  801655:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801658:	89 f7                	mov    %esi,%edi
+  80165a:	cd 30                	int    $0x30
+  80165c:	85 c0                	test   %eax,%eax
+  80165e:	7f 08                	jg     801668 <sys_env_unsuspend+0x2c>
+  801660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801663:	5b                   	pop    %ebx
+  801664:	5e                   	pop    %esi
+  801665:	5f                   	pop    %edi
+  801666:	5d                   	pop    %ebp
+  801667:	c3                   	ret
+  801668:	83 ec 0c             	sub    $0xc,%esp
+  80166b:	50                   	push   %eax
+  80166c:	6a 19                	push   $0x19
+  80166e:	68 2b 40 80 00       	push   $0x80402b
+  801673:	6a 24                	push   $0x24
+  801675:	68 48 40 80 00       	push   $0x804048
+  80167a:	e8 6b ed ff ff       	call   8003ea <_panic>
+
+0080167f <sys_migrate>:
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	57                   	push   %edi
+  801683:	56                   	push   %esi
+  801684:	53                   	push   %ebx
+  801685:	83 ec 0c             	sub    $0xc,%esp
+  801688:	ba 04 90 80 00       	mov    $0x809004,%edx
+  80168d:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801693:	76 11                	jbe    8016a6 <sys_migrate+0x27>
+  801695:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80169a:	0f b6 08             	movzbl (%eax),%ecx
+  80169d:	05 00 10 00 00       	add    $0x1000,%eax
+  8016a2:	39 d0                	cmp    %edx,%eax
+  8016a4:	72 f4                	jb     80169a <sys_migrate+0x1b>
+  8016a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ae:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8016b3:	89 cb                	mov    %ecx,%ebx
+  8016b5:	89 cf                	mov    %ecx,%edi
+  8016b7:	89 ce                	mov    %ecx,%esi
+  8016b9:	cd 30                	int    $0x30
+  8016bb:	85 c0                	test   %eax,%eax
+  8016bd:	7f 08                	jg     8016c7 <sys_migrate+0x48>
+  8016bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c2:	5b                   	pop    %ebx
+  8016c3:	5e                   	pop    %esi
+  8016c4:	5f                   	pop    %edi
+  8016c5:	5d                   	pop    %ebp
+  8016c6:	c3                   	ret
+  8016c7:	83 ec 0c             	sub    $0xc,%esp
+  8016ca:	50                   	push   %eax
+  8016cb:	6a 1a                	push   $0x1a
+  8016cd:	68 2b 40 80 00       	push   $0x80402b
+  8016d2:	6a 24                	push   $0x24
+  8016d4:	68 48 40 80 00       	push   $0x804048
+  8016d9:	e8 0c ed ff ff       	call   8003ea <_panic>
+
+008016de <sys_lease_complete>:
+  8016de:	55                   	push   %ebp
+  8016df:	89 e5                	mov    %esp,%ebp
+  8016e1:	57                   	push   %edi
+  8016e2:	56                   	push   %esi
+  8016e3:	53                   	push   %ebx
+  8016e4:	83 ec 0c             	sub    $0xc,%esp
+  8016e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ec:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8016f1:	89 d1                	mov    %edx,%ecx
+  8016f3:	89 d3                	mov    %edx,%ebx
+  8016f5:	89 d7                	mov    %edx,%edi
+  8016f7:	89 d6                	mov    %edx,%esi
+  8016f9:	cd 30                	int    $0x30
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	7f 08                	jg     801707 <sys_lease_complete+0x29>
+  8016ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801702:	5b                   	pop    %ebx
+  801703:	5e                   	pop    %esi
+  801704:	5f                   	pop    %edi
+  801705:	5d                   	pop    %ebp
+  801706:	c3                   	ret
+  801707:	83 ec 0c             	sub    $0xc,%esp
+  80170a:	50                   	push   %eax
+  80170b:	6a 1b                	push   $0x1b
+  80170d:	68 2b 40 80 00       	push   $0x80402b
+  801712:	6a 24                	push   $0x24
+  801714:	68 48 40 80 00       	push   $0x804048
+  801719:	e8 cc ec ff ff       	call   8003ea <_panic>
+
+0080171e <sys_env_set_thisenv>:
+  80171e:	55                   	push   %ebp
+  80171f:	89 e5                	mov    %esp,%ebp
+  801721:	57                   	push   %edi
+  801722:	56                   	push   %esi
+  801723:	53                   	push   %ebx
+  801724:	83 ec 0c             	sub    $0xc,%esp
+  801727:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801732:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801737:	89 df                	mov    %ebx,%edi
+  801739:	89 de                	mov    %ebx,%esi
+  80173b:	cd 30                	int    $0x30
+  80173d:	85 c0                	test   %eax,%eax
+  80173f:	7f 08                	jg     801749 <sys_env_set_thisenv+0x2b>
+  801741:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801744:	5b                   	pop    %ebx
+  801745:	5e                   	pop    %esi
+  801746:	5f                   	pop    %edi
+  801747:	5d                   	pop    %ebp
+  801748:	c3                   	ret
+  801749:	83 ec 0c             	sub    $0xc,%esp
+  80174c:	50                   	push   %eax
+  80174d:	6a 1c                	push   $0x1c
+  80174f:	68 2b 40 80 00       	push   $0x80402b
+  801754:	6a 24                	push   $0x24
+  801756:	68 48 40 80 00       	push   $0x804048
+  80175b:	e8 8a ec ff ff       	call   8003ea <_panic>
+
+00801760 <sys_env_set_sched>:
+  801760:	55                   	push   %ebp
+  801761:	89 e5                	mov    %esp,%ebp
+  801763:	57                   	push   %edi
+  801764:	56                   	push   %esi
+  801765:	53                   	push   %ebx
+  801766:	83 ec 0c             	sub    $0xc,%esp
+  801769:	be 00 00 00 00       	mov    $0x0,%esi
+  80176e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801771:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801774:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801779:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80177c:	89 f7                	mov    %esi,%edi
+  80177e:	cd 30                	int    $0x30
+  801780:	85 c0                	test   %eax,%eax
+  801782:	7f 08                	jg     80178c <sys_env_set_sched+0x2c>
+  801784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5f                   	pop    %edi
+  80178a:	5d                   	pop    %ebp
+  80178b:	c3                   	ret
+  80178c:	83 ec 0c             	sub    $0xc,%esp
+  80178f:	50                   	push   %eax
+  801790:	6a 1d                	push   $0x1d
+  801792:	68 2b 40 80 00       	push   $0x80402b
+  801797:	6a 24                	push   $0x24
+  801799:	68 48 40 80 00       	push   $0x804048
+  80179e:	e8 47 ec ff ff       	call   8003ea <_panic>
+
+008017a3 <sys_batch>:
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	57                   	push   %edi
+  8017a7:	56                   	push   %esi
+  8017a8:	53                   	push   %ebx
+  8017a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8017b9:	89 df                	mov    %ebx,%edi
+  8017bb:	89 de                	mov    %ebx,%esi
+  8017bd:	cd 30                	int    $0x30
+  8017bf:	5b                   	pop    %ebx
+  8017c0:	5e                   	pop    %esi
+  8017c1:	5f                   	pop    %edi
+  8017c2:	5d                   	pop    %ebp
+  8017c3:	c3                   	ret
+
+008017c4 <sys_env_stats>:
+  8017c4:	55                   	push   %ebp
+  8017c5:	89 e5                	mov    %esp,%ebp
+  8017c7:	57                   	push   %edi
+  8017c8:	56                   	push   %esi
+  8017c9:	53                   	push   %ebx
+  8017ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d5:	b8 23 00 00 00       	mov    $0x23,%eax
+  8017da:	89 df                	mov    %ebx,%edi
+  8017dc:	89 de                	mov    %ebx,%esi
+  8017de:	cd 30                	int    $0x30
+  8017e0:	5b                   	pop    %ebx
+  8017e1:	5e                   	pop    %esi
+  8017e2:	5f                   	pop    %edi
+  8017e3:	5d                   	pop    %ebp
+  8017e4:	c3                   	ret
+
+008017e5 <sys_trace>:
+  8017e5:	55                   	push   %ebp
+  8017e6:	89 e5                	mov    %esp,%ebp
+  8017e8:	57                   	push   %edi
+  8017e9:	56                   	push   %esi
+  8017ea:	53                   	push   %ebx
+  8017eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f3:	b8 24 00 00 00       	mov    $0x24,%eax
+  8017f8:	89 cb                	mov    %ecx,%ebx
+  8017fa:	89 cf                	mov    %ecx,%edi
+  8017fc:	89 ce                	mov    %ecx,%esi
+  8017fe:	cd 30                	int    $0x30
+  801800:	5b                   	pop    %ebx
+  801801:	5e                   	pop    %esi
+  801802:	5f                   	pop    %edi
+  801803:	5d                   	pop    %ebp
+  801804:	c3                   	ret
+
+00801805 <sys_env_set_pager>:
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	57                   	push   %edi
+  801809:	56                   	push   %esi
+  80180a:	53                   	push   %ebx
+  80180b:	83 ec 0c             	sub    $0xc,%esp
+  80180e:	be 00 00 00 00       	mov    $0x0,%esi
+  801813:	8b 55 08             	mov    0x8(%ebp),%edx
+  801816:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801819:	b8 25 00 00 00       	mov    $0x25,%eax
+  80181e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801821:	89 f7                	mov    %esi,%edi
+  801823:	cd 30                	int    $0x30
+  801825:	85 c0                	test   %eax,%eax
+  801827:	7f 08                	jg     801831 <sys_env_set_pager+0x2c>
+  801829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80182c:	5b                   	pop    %ebx
+  80182d:	5e                   	pop    %esi
+  80182e:	5f                   	pop    %edi
+  80182f:	5d                   	pop    %ebp
+  801830:	c3                   	ret
+  801831:	83 ec 0c             	sub    $0xc,%esp
+  801834:	50                   	push   %eax
+  801835:	6a 25                	push   $0x25
+  801837:	68 2b 40 80 00       	push   $0x80402b
+  80183c:	6a 24                	push   $0x24
+  80183e:	68 48 40 80 00       	push   $0x804048
+  801843:	e8 a2 eb ff ff       	call   8003ea <_panic>
+
+00801848 <sys_pager_retire>:
+  801848:	55                   	push   %ebp
+  801849:	89 e5                	mov    %esp,%ebp
+  80184b:	57                   	push   %edi
+  80184c:	56                   	push   %esi
+  80184d:	53                   	push   %ebx
+  80184e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801853:	8b 55 08             	mov    0x8(%ebp),%edx
+  801856:	b8 28 00 00 00       	mov    $0x28,%eax
+  80185b:	89 cb                	mov    %ecx,%ebx
+  80185d:	89 cf                	mov    %ecx,%edi
+  80185f:	89 ce                	mov    %ecx,%esi
+  801861:	cd 30                	int    $0x30
+  801863:	5b                   	pop    %ebx
+  801864:	5e                   	pop    %esi
+  801865:	5f                   	pop    %edi
+  801866:	5d                   	pop    %ebp
+  801867:	c3                   	ret
+
+00801868 <sys_prof>:
+  801868:	55                   	push   %ebp
+  801869:	89 e5                	mov    %esp,%ebp
+  80186b:	57                   	push   %edi
+  80186c:	56                   	push   %esi
+  80186d:	53                   	push   %ebx
+  80186e:	be 00 00 00 00       	mov    $0x0,%esi
+  801873:	8b 55 08             	mov    0x8(%ebp),%edx
+  801876:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801879:	b8 22 00 00 00       	mov    $0x22,%eax
+  80187e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801881:	89 f7                	mov    %esi,%edi
+  801883:	cd 30                	int    $0x30
+  801885:	5b                   	pop    %ebx
+  801886:	5e                   	pop    %esi
+  801887:	5f                   	pop    %edi
+  801888:	5d                   	pop    %ebp
+  801889:	c3                   	ret
+
+0080188a <dupq_flush>:
+  80188a:	55                   	push   %ebp
+  80188b:	89 e5                	mov    %esp,%ebp
+  80188d:	53                   	push   %ebx
+  80188e:	83 ec 0c             	sub    $0xc,%esp
+  801891:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  801897:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80189e:	00 00 00 
+  8018a1:	53                   	push   %ebx
+  8018a2:	68 00 00 40 00       	push   $0x400000
+  8018a7:	e8 f7 fe ff ff       	call   8017a3 <sys_batch>
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	78 14                	js     8018c7 <dupq_flush+0x3d>
+  8018b3:	39 c3                	cmp    %eax,%ebx
+  8018b5:	7e 0b                	jle    8018c2 <dupq_flush+0x38>
+  8018b7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8018ba:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8018c0:	eb 05                	jmp    8018c7 <dupq_flush+0x3d>
+  8018c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ca:	c9                   	leave
+  8018cb:	c3                   	ret
+
+008018cc <pgfault>:
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	56                   	push   %esi
+  8018d0:	53                   	push   %ebx
+  8018d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d4:	8b 30                	mov    (%eax),%esi
+  8018d6:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8018da:	0f 84 83 00 00 00    	je     801963 <pgfault+0x97>
+  8018e0:	89 f0                	mov    %esi,%eax
+  8018e2:	c1 e8 0c             	shr    $0xc,%eax
+  8018e5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ec:	f6 c4 08             	test   $0x8,%ah
+  8018ef:	0f 84 80 00 00 00    	je     801975 <pgfault+0xa9>
+  8018f5:	e8 b8 f6 ff ff       	call   800fb2 <sys_getenvid>
+  8018fa:	89 c3                	mov    %eax,%ebx
+  8018fc:	83 ec 04             	sub    $0x4,%esp
+  8018ff:	6a 07                	push   $0x7
+  801901:	68 00 f0 7f 00       	push   $0x7ff000
+  801906:	50                   	push   %eax
+  801907:	e8 10 f7 ff ff       	call   80101c <sys_page_alloc>
+  80190c:	83 c4 10             	add    $0x10,%esp
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	78 74                	js     801987 <pgfault+0xbb>
+  801913:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801919:	83 ec 04             	sub    $0x4,%esp
+  80191c:	68 00 10 00 00       	push   $0x1000
+  801921:	56                   	push   %esi
+  801922:	68 00 f0 7f 00       	push   $0x7ff000
+  801927:	e8 40 f4 ff ff       	call   800d6c <memmove>
+  80192c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801933:	56                   	push   %esi
+  801934:	53                   	push   %ebx
+  801935:	68 00 f0 7f 00       	push   $0x7ff000
+  80193a:	53                   	push   %ebx
+  80193b:	e8 1f f7 ff ff       	call   80105f <sys_page_map>
+  801940:	83 c4 20             	add    $0x20,%esp
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 54                	js     80199b <pgfault+0xcf>
+  801947:	83 ec 08             	sub    $0x8,%esp
+  80194a:	68 00 f0 7f 00       	push   $0x7ff000
+  80194f:	53                   	push   %ebx
+  801950:	e8 99 f7 ff ff       	call   8010ee <sys_page_unmap>
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 53                	js     8019af <pgfault+0xe3>
+  80195c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80195f:	5b                   	pop    %ebx
+  801960:	5e                   	pop    %esi
+  801961:	5d                   	pop    %ebp
+  801962:	c3                   	ret
+  801963:	56                   	push   %esi
+  801964:	68 58 40 80 00       	push   $0x804058
+  801969:	6a 19                	push   $0x19
+  80196b:	68 34 41 80 00       	push   $0x804134
+  801970:	e8 75 ea ff ff       	call   8003ea <_panic>
+  801975:	56                   	push   %esi
+  801976:	68 8c 40 80 00       	push   $0x80408c
+  80197b:	6a 1e                	push   $0x1e
+  80197d:	68 34 41 80 00       	push   $0x804134
+  801982:	e8 63 ea ff ff       	call   8003ea <_panic>
+  801987:	83 ec 04             	sub    $0x4,%esp
+  80198a:	68 c0 40 80 00       	push   $0x8040c0
+  80198f:	6a 2e                	push   $0x2e
+  801991:	68 34 41 80 00       	push   $0x804134
+  801996:	e8 4f ea ff ff       	call   8003ea <_panic>
+  80199b:	83 ec 04             	sub    $0x4,%esp
+  80199e:	68 e4 40 80 00       	push   $0x8040e4
+  8019a3:	6a 37                	push   $0x37
+  8019a5:	68 34 41 80 00       	push   $0x804134
+  8019aa:	e8 3b ea ff ff       	call   8003ea <_panic>
+  8019af:	83 ec 04             	sub    $0x4,%esp
+  8019b2:	68 10 41 80 00       	push   $0x804110
+  8019b7:	6a 3c                	push   $0x3c
+  8019b9:	68 34 41 80 00       	push   $0x804134
+  8019be:	e8 27 ea ff ff       	call   8003ea <_panic>
+
+008019c3 <dupq_begin>:
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	83 ec 0c             	sub    $0xc,%esp
+  8019c9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8019d0:	00 00 00 
+  8019d3:	6a 07                	push   $0x7
+  8019d5:	68 00 00 40 00       	push   $0x400000
+  8019da:	6a 00                	push   $0x0
+  8019dc:	e8 3b f6 ff ff       	call   80101c <sys_page_alloc>
+  8019e1:	c9                   	leave
+  8019e2:	c3                   	ret
+
+008019e3 <dupq_map>:
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	83 ec 08             	sub    $0x8,%esp
+  8019e9:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  8019f0:	00 00 00 
+  8019f3:	74 46                	je     801a3b <dupq_map+0x58>
+  8019f5:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8019fb:	8d 42 01             	lea    0x1(%edx),%eax
+  8019fe:	a3 00 60 80 00       	mov    %eax,0x806000
+  801a03:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801a06:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801a0c:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801a13:	00 00 00 
+  801a16:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a19:	89 50 04             	mov    %edx,0x4(%eax)
+  801a1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a1f:	c1 e2 0c             	shl    $0xc,%edx
+  801a22:	89 50 08             	mov    %edx,0x8(%eax)
+  801a25:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801a28:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801a2b:	89 50 10             	mov    %edx,0x10(%eax)
+  801a2e:	8b 55 14             	mov    0x14(%ebp),%edx
+  801a31:	89 50 14             	mov    %edx,0x14(%eax)
+  801a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a39:	c9                   	leave
+  801a3a:	c3                   	ret
+  801a3b:	e8 4a fe ff ff       	call   80188a <dupq_flush>
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	79 b1                	jns    8019f5 <dupq_map+0x12>
+  801a44:	eb f3                	jmp    801a39 <dupq_map+0x56>
+
+00801a46 <dupq_end>:
+  801a46:	55                   	push   %ebp
+  801a47:	89 e5                	mov    %esp,%ebp
+  801a49:	53                   	push   %ebx
+  801a4a:	83 ec 04             	sub    $0x4,%esp
+  801a4d:	e8 38 fe ff ff       	call   80188a <dupq_flush>
+  801a52:	89 c3                	mov    %eax,%ebx
+  801a54:	83 ec 08             	sub    $0x8,%esp
+  801a57:	68 00 00 40 00       	push   $0x400000
+  801a5c:	6a 00                	push   $0x0
+  801a5e:	e8 8b f6 ff ff       	call   8010ee <sys_page_unmap>
+  801a63:	89 d8                	mov    %ebx,%eax
+  801a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a68:	c9                   	leave
+  801a69:	c3                   	ret
+
+00801a6a <fork>:
+  801a6a:	55                   	push   %ebp
+  801a6b:	89 e5                	mov    %esp,%ebp
+  801a6d:	53                   	push   %ebx
+  801a6e:	83 ec 10             	sub    $0x10,%esp
+  801a71:	68 cc 18 80 00       	push   $0x8018cc
+  801a76:	e8 01 1b 00 00       	call   80357c <set_pgfault_handler>
+  801a7b:	83 c4 08             	add    $0x8,%esp
+  801a7e:	6a 01                	push   $0x1
+  801a80:	6a 00                	push   $0x0
+  801a82:	e8 4c f7 ff ff       	call   8011d3 <sys_env_set_cow>
+  801a87:	e8 a4 f6 ff ff       	call   801130 <sys_fork>
+  801a8c:	89 c3                	mov    %eax,%ebx
+  801a8e:	83 c4 10             	add    $0x10,%esp
+  801a91:	85 c0                	test   %eax,%eax
+  801a93:	74 07                	je     801a9c <fork+0x32>
+  801a95:	89 d8                	mov    %ebx,%eax
+  801a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a9a:	c9                   	leave
+  801a9b:	c3                   	ret
+  801a9c:	e8 11 f5 ff ff       	call   800fb2 <sys_getenvid>
+  801aa1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801aa6:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801aac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ab1:	a3 20 64 80 00       	mov    %eax,0x806420
+  801ab6:	eb dd                	jmp    801a95 <fork+0x2b>
+
+00801ab8 <sfork>:
+  801ab8:	55                   	push   %ebp
+  801ab9:	89 e5                	mov    %esp,%ebp
+  801abb:	57                   	push   %edi
+  801abc:	56                   	push   %esi
+  801abd:	53                   	push   %ebx
+  801abe:	83 ec 1c             	sub    $0x1c,%esp
+  801ac1:	e8 ec f4 ff ff       	call   800fb2 <sys_getenvid>
+  801ac6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ac9:	83 ec 0c             	sub    $0xc,%esp
+  801acc:	68 cc 18 80 00       	push   $0x8018cc
+  801ad1:	e8 a6 1a 00 00       	call   80357c <set_pgfault_handler>
+  801ad6:	b8 07 00 00 00       	mov    $0x7,%eax
+  801adb:	cd 30                	int    $0x30
+  801add:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ae0:	83 c4 10             	add    $0x10,%esp
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	0f 88 45 02 00 00    	js     801d30 <sfork+0x278>
+  801aeb:	89 c6                	mov    %eax,%esi
+  801aed:	74 17                	je     801b06 <sfork+0x4e>
+  801aef:	e8 cf fe ff ff       	call   8019c3 <dupq_begin>
+  801af4:	85 c0                	test   %eax,%eax
+  801af6:	0f 88 40 02 00 00    	js     801d3c <sfork+0x284>
+  801afc:	bf 02 00 00 00       	mov    $0x2,%edi
+  801b01:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801b04:	eb 39                	jmp    801b3f <sfork+0x87>
+  801b06:	e8 a7 f4 ff ff       	call   800fb2 <sys_getenvid>
+  801b0b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b10:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801b16:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b1b:	a3 20 64 80 00       	mov    %eax,0x806420
+  801b20:	e9 23 01 00 00       	jmp    801c48 <sfork+0x190>
+  801b25:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801b2c:	a8 01                	test   $0x1,%al
+  801b2e:	75 5b                	jne    801b8b <sfork+0xd3>
+  801b30:	83 c7 01             	add    $0x1,%edi
+  801b33:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801b39:	0f 84 40 01 00 00    	je     801c7f <sfork+0x1c7>
+  801b3f:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801b46:	a8 01                	test   $0x1,%al
+  801b48:	74 db                	je     801b25 <sfork+0x6d>
+  801b4a:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801b51:	a8 80                	test   $0x80,%al
+  801b53:	74 d0                	je     801b25 <sfork+0x6d>
+  801b55:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801b5c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b61:	0c 80                	or     $0x80,%al
+  801b63:	50                   	push   %eax
+  801b64:	ff 75 e4             	push   -0x1c(%ebp)
+  801b67:	89 f8                	mov    %edi,%eax
+  801b69:	c1 e0 16             	shl    $0x16,%eax
+  801b6c:	c1 e8 0c             	shr    $0xc,%eax
+  801b6f:	50                   	push   %eax
+  801b70:	ff 75 e0             	push   -0x20(%ebp)
+  801b73:	e8 6b fe ff ff       	call   8019e3 <dupq_map>
+  801b78:	83 c4 10             	add    $0x10,%esp
+  801b7b:	85 c0                	test   %eax,%eax
+  801b7d:	79 b1                	jns    801b30 <sfork+0x78>
+  801b7f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b86:	e9 bd 00 00 00       	jmp    801c48 <sfork+0x190>
+  801b8b:	89 fe                	mov    %edi,%esi
+  801b8d:	c1 e6 16             	shl    $0x16,%esi
+  801b90:	89 f0                	mov    %esi,%eax
+  801b92:	c1 e8 0c             	shr    $0xc,%eax
+  801b95:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801b9a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801b9d:	eb 57                	jmp    801bf6 <sfork+0x13e>
+  801b9f:	e8 0e f4 ff ff       	call   800fb2 <sys_getenvid>
+  801ba4:	89 c7                	mov    %eax,%edi
+  801ba6:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801bab:	f6 c4 04             	test   $0x4,%ah
+  801bae:	0f 85 9f 00 00 00    	jne    801c53 <sfork+0x19b>
+  801bb4:	a9 02 08 00 00       	test   $0x802,%eax
+  801bb9:	0f 85 c5 01 00 00    	jne    801d84 <sfork+0x2cc>
+  801bbf:	6a 05                	push   $0x5
+  801bc1:	ff 75 e4             	push   -0x1c(%ebp)
+  801bc4:	68 fd e7 0e 00       	push   $0xee7fd
+  801bc9:	57                   	push   %edi
+  801bca:	e8 14 fe ff ff       	call   8019e3 <dupq_map>
+  801bcf:	83 c4 10             	add    $0x10,%esp
+  801bd2:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801bd8:	0f 84 91 00 00 00    	je     801c6f <sfork+0x1b7>
+  801bde:	89 f0                	mov    %esi,%eax
+  801be0:	09 d8                	or     %ebx,%eax
+  801be2:	c1 e8 0c             	shr    $0xc,%eax
+  801be5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801beb:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801bf0:	0f 84 81 00 00 00    	je     801c77 <sfork+0x1bf>
+  801bf6:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801bfb:	74 a2                	je     801b9f <sfork+0xe7>
+  801bfd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c04:	f6 c2 01             	test   $0x1,%dl
+  801c07:	74 c9                	je     801bd2 <sfork+0x11a>
+  801c09:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c10:	f6 c6 02             	test   $0x2,%dh
+  801c13:	75 bd                	jne    801bd2 <sfork+0x11a>
+  801c15:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801c1c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c23:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801c29:	f7 d2                	not    %edx
+  801c2b:	21 ca                	and    %ecx,%edx
+  801c2d:	52                   	push   %edx
+  801c2e:	ff 75 e4             	push   -0x1c(%ebp)
+  801c31:	50                   	push   %eax
+  801c32:	ff 75 e0             	push   -0x20(%ebp)
+  801c35:	e8 a9 fd ff ff       	call   8019e3 <dupq_map>
+  801c3a:	83 c4 10             	add    $0x10,%esp
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	79 91                	jns    801bd2 <sfork+0x11a>
+  801c41:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c48:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c4e:	5b                   	pop    %ebx
+  801c4f:	5e                   	pop    %esi
+  801c50:	5f                   	pop    %edi
+  801c51:	5d                   	pop    %ebp
+  801c52:	c3                   	ret
+  801c53:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c58:	50                   	push   %eax
+  801c59:	ff 75 e4             	push   -0x1c(%ebp)
+  801c5c:	68 fd e7 0e 00       	push   $0xee7fd
+  801c61:	57                   	push   %edi
+  801c62:	e8 7c fd ff ff       	call   8019e3 <dupq_map>
+  801c67:	83 c4 10             	add    $0x10,%esp
+  801c6a:	e9 63 ff ff ff       	jmp    801bd2 <sfork+0x11a>
+  801c6f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801c72:	e9 b9 fe ff ff       	jmp    801b30 <sfork+0x78>
+  801c77:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801c7a:	e9 b1 fe ff ff       	jmp    801b30 <sfork+0x78>
+  801c7f:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801c82:	e8 bf fd ff ff       	call   801a46 <dupq_end>
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	0f 88 b9 00 00 00    	js     801d48 <sfork+0x290>
+  801c8f:	83 ec 04             	sub    $0x4,%esp
+  801c92:	6a 07                	push   $0x7
+  801c94:	68 00 f0 7f ee       	push   $0xee7ff000
+  801c99:	56                   	push   %esi
+  801c9a:	e8 7d f3 ff ff       	call   80101c <sys_page_alloc>
+  801c9f:	83 c4 10             	add    $0x10,%esp
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	0f 88 aa 00 00 00    	js     801d54 <sfork+0x29c>
+  801caa:	83 ec 0c             	sub    $0xc,%esp
+  801cad:	6a 07                	push   $0x7
+  801caf:	68 00 f0 7f 00       	push   $0x7ff000
+  801cb4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801cb7:	57                   	push   %edi
+  801cb8:	68 00 f0 7f ee       	push   $0xee7ff000
+  801cbd:	56                   	push   %esi
+  801cbe:	e8 9c f3 ff ff       	call   80105f <sys_page_map>
+  801cc3:	83 c4 20             	add    $0x20,%esp
+  801cc6:	85 c0                	test   %eax,%eax
+  801cc8:	0f 88 92 00 00 00    	js     801d60 <sfork+0x2a8>
+  801cce:	83 ec 04             	sub    $0x4,%esp
+  801cd1:	68 00 10 00 00       	push   $0x1000
+  801cd6:	68 00 f0 7f 00       	push   $0x7ff000
+  801cdb:	68 00 f0 7f ee       	push   $0xee7ff000
+  801ce0:	e8 87 f0 ff ff       	call   800d6c <memmove>
+  801ce5:	83 c4 08             	add    $0x8,%esp
+  801ce8:	68 00 f0 7f 00       	push   $0x7ff000
+  801ced:	57                   	push   %edi
+  801cee:	e8 fb f3 ff ff       	call   8010ee <sys_page_unmap>
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 72                	js     801d6c <sfork+0x2b4>
+  801cfa:	83 ec 08             	sub    $0x8,%esp
+  801cfd:	68 f4 35 80 00       	push   $0x8035f4
+  801d02:	56                   	push   %esi
+  801d03:	e8 2d f5 ff ff       	call   801235 <sys_env_set_pgfault_upcall>
+  801d08:	83 c4 10             	add    $0x10,%esp
+  801d0b:	85 c0                	test   %eax,%eax
+  801d0d:	78 69                	js     801d78 <sfork+0x2c0>
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	6a 02                	push   $0x2
+  801d14:	56                   	push   %esi
+  801d15:	e8 35 f4 ff ff       	call   80114f <sys_env_set_status>
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801d24:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801d28:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d2b:	e9 18 ff ff ff       	jmp    801c48 <sfork+0x190>
+  801d30:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801d37:	e9 0c ff ff ff       	jmp    801c48 <sfork+0x190>
+  801d3c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801d43:	e9 00 ff ff ff       	jmp    801c48 <sfork+0x190>
+  801d48:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801d4f:	e9 f4 fe ff ff       	jmp    801c48 <sfork+0x190>
+  801d54:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801d5b:	e9 e8 fe ff ff       	jmp    801c48 <sfork+0x190>
+  801d60:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801d67:	e9 dc fe ff ff       	jmp    801c48 <sfork+0x190>
+  801d6c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801d73:	e9 d0 fe ff ff       	jmp    801c48 <sfork+0x190>
+  801d78:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801d7f:	e9 c4 fe ff ff       	jmp    801c48 <sfork+0x190>
+  801d84:	68 05 08 00 00       	push   $0x805
+  801d89:	ff 75 e4             	push   -0x1c(%ebp)
+  801d8c:	68 fd e7 0e 00       	push   $0xee7fd
+  801d91:	57                   	push   %edi
+  801d92:	e8 4c fc ff ff       	call   8019e3 <dupq_map>
+  801d97:	83 c4 10             	add    $0x10,%esp
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	0f 88 30 fe ff ff    	js     801bd2 <sfork+0x11a>
+  801da2:	68 05 08 00 00       	push   $0x805
+  801da7:	57                   	push   %edi
+  801da8:	68 fd e7 0e 00       	push   $0xee7fd
+  801dad:	57                   	push   %edi
+  801dae:	e8 30 fc ff ff       	call   8019e3 <dupq_map>
+  801db3:	83 c4 10             	add    $0x10,%esp
+  801db6:	e9 17 fe ff ff       	jmp    801bd2 <sfork+0x11a>
+
+00801dbb <fd2num>:
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc1:	05 00 00 00 30       	add    $0x30000000,%eax
+  801dc6:	c1 e8 0c             	shr    $0xc,%eax
+  801dc9:	5d                   	pop    %ebp
+  801dca:	c3                   	ret
+
+00801dcb <fd2data>:
+  801dcb:	55                   	push   %ebp
+  801dcc:	89 e5                	mov    %esp,%ebp
+  801dce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd1:	05 00 00 00 30       	add    $0x30000000,%eax
+  801dd6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ddb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801de0:	5d                   	pop    %ebp
+  801de1:	c3                   	ret
+
+00801de2 <fd_alloc>:
+  801de2:	55                   	push   %ebp
+  801de3:	89 e5                	mov    %esp,%ebp
+  801de5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801dea:	89 c2                	mov    %eax,%edx
+  801dec:	c1 ea 16             	shr    $0x16,%edx
+  801def:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801df6:	f6 c2 01             	test   $0x1,%dl
+  801df9:	74 29                	je     801e24 <fd_alloc+0x42>
+  801dfb:	89 c2                	mov    %eax,%edx
+  801dfd:	c1 ea 0c             	shr    $0xc,%edx
+  801e00:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e07:	f6 c2 01             	test   $0x1,%dl
+  801e0a:	74 18                	je     801e24 <fd_alloc+0x42>
+  801e0c:	05 00 10 00 00       	add    $0x1000,%eax
+  801e11:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801e16:	75 d2                	jne    801dea <fd_alloc+0x8>
+  801e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801e22:	eb 05                	jmp    801e29 <fd_alloc+0x47>
+  801e24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e2c:	89 02                	mov    %eax,(%edx)
+  801e2e:	89 c8                	mov    %ecx,%eax
+  801e30:	5d                   	pop    %ebp
+  801e31:	c3                   	ret
+
+00801e32 <fd_lookup>:
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e38:	83 f8 1f             	cmp    $0x1f,%eax
+  801e3b:	77 30                	ja     801e6d <fd_lookup+0x3b>
+  801e3d:	c1 e0 0c             	shl    $0xc,%eax
+  801e40:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801e45:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e4b:	f6 c2 01             	test   $0x1,%dl
+  801e4e:	74 24                	je     801e74 <fd_lookup+0x42>
+  801e50:	89 c2                	mov    %eax,%edx
+  801e52:	c1 ea 0c             	shr    $0xc,%edx
+  801e55:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e5c:	f6 c2 01             	test   $0x1,%dl
+  801e5f:	74 1a                	je     801e7b <fd_lookup+0x49>
+  801e61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e64:	89 02                	mov    %eax,(%edx)
+  801e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6b:	5d                   	pop    %ebp
+  801e6c:	c3                   	ret
+  801e6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e72:	eb f7                	jmp    801e6b <fd_lookup+0x39>
+  801e74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e79:	eb f0                	jmp    801e6b <fd_lookup+0x39>
+  801e7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e80:	eb e9                	jmp    801e6b <fd_lookup+0x39>
+
+00801e82 <dev_lookup>:
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	53                   	push   %ebx
+  801e86:	83 ec 04             	sub    $0x4,%esp
+  801e89:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e91:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801e96:	39 13                	cmp    %edx,(%ebx)
+  801e98:	74 37                	je     801ed1 <dev_lookup+0x4f>
+  801e9a:	83 c0 01             	add    $0x1,%eax
+  801e9d:	8b 1c 85 bc 41 80 00 	mov    0x8041bc(,%eax,4),%ebx
+  801ea4:	85 db                	test   %ebx,%ebx
+  801ea6:	75 ee                	jne    801e96 <dev_lookup+0x14>
+  801ea8:	a1 20 64 80 00       	mov    0x806420,%eax
+  801ead:	8b 40 48             	mov    0x48(%eax),%eax
+  801eb0:	83 ec 04             	sub    $0x4,%esp
+  801eb3:	52                   	push   %edx
+  801eb4:	50                   	push   %eax
+  801eb5:	68 40 41 80 00       	push   $0x804140
+  801eba:	e8 06 e6 ff ff       	call   8004c5 <cprintf>
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eca:	89 1a                	mov    %ebx,(%edx)
+  801ecc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ecf:	c9                   	leave
+  801ed0:	c3                   	ret
+  801ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed6:	eb ef                	jmp    801ec7 <dev_lookup+0x45>
+
+00801ed8 <fd_close>:
+  801ed8:	55                   	push   %ebp
+  801ed9:	89 e5                	mov    %esp,%ebp
+  801edb:	57                   	push   %edi
+  801edc:	56                   	push   %esi
+  801edd:	53                   	push   %ebx
+  801ede:	83 ec 24             	sub    $0x24,%esp
+  801ee1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ee4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ee7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eea:	50                   	push   %eax
+  801eeb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ef1:	c1 e8 0c             	shr    $0xc,%eax
+  801ef4:	50                   	push   %eax
+  801ef5:	e8 38 ff ff ff       	call   801e32 <fd_lookup>
+  801efa:	89 c3                	mov    %eax,%ebx
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	78 05                	js     801f08 <fd_close+0x30>
+  801f03:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801f06:	74 0f                	je     801f17 <fd_close+0x3f>
+  801f08:	85 ff                	test   %edi,%edi
+  801f0a:	0f 44 df             	cmove  %edi,%ebx
+  801f0d:	89 d8                	mov    %ebx,%eax
+  801f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f12:	5b                   	pop    %ebx
+  801f13:	5e                   	pop    %esi
+  801f14:	5f                   	pop    %edi
+  801f15:	5d                   	pop    %ebp
+  801f16:	c3                   	ret
+  801f17:	83 ec 08             	sub    $0x8,%esp
+  801f1a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f1d:	50                   	push   %eax
+  801f1e:	ff 36                	push   (%esi)
+  801f20:	e8 5d ff ff ff       	call   801e82 <dev_lookup>
+  801f25:	89 c3                	mov    %eax,%ebx
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	78 1a                	js     801f48 <fd_close+0x70>
+  801f2e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f31:	8b 40 10             	mov    0x10(%eax),%eax
+  801f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	74 0b                	je     801f48 <fd_close+0x70>
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+  801f40:	56                   	push   %esi
+  801f41:	ff d0                	call   *%eax
+  801f43:	89 c3                	mov    %eax,%ebx
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	83 ec 08             	sub    $0x8,%esp
+  801f4b:	56                   	push   %esi
+  801f4c:	6a 00                	push   $0x0
+  801f4e:	e8 9b f1 ff ff       	call   8010ee <sys_page_unmap>
+  801f53:	83 c4 10             	add    $0x10,%esp
+  801f56:	eb b5                	jmp    801f0d <fd_close+0x35>
+
+00801f58 <close>:
+  801f58:	55                   	push   %ebp
+  801f59:	89 e5                	mov    %esp,%ebp
+  801f5b:	83 ec 20             	sub    $0x20,%esp
+  801f5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f61:	50                   	push   %eax
+  801f62:	ff 75 08             	push   0x8(%ebp)
+  801f65:	e8 c8 fe ff ff       	call   801e32 <fd_lookup>
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	79 02                	jns    801f73 <close+0x1b>
+  801f71:	c9                   	leave
+  801f72:	c3                   	ret
+  801f73:	83 ec 08             	sub    $0x8,%esp
+  801f76:	6a 01                	push   $0x1
+  801f78:	ff 75 f4             	push   -0xc(%ebp)
+  801f7b:	e8 58 ff ff ff       	call   801ed8 <fd_close>
+  801f80:	83 c4 10             	add    $0x10,%esp
+  801f83:	eb ec                	jmp    801f71 <close+0x19>
+
+00801f85 <close_all>:
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	53                   	push   %ebx
+  801f89:	83 ec 04             	sub    $0x4,%esp
+  801f8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f91:	83 ec 0c             	sub    $0xc,%esp
+  801f94:	53                   	push   %ebx
+  801f95:	e8 be ff ff ff       	call   801f58 <close>
+  801f9a:	83 c3 01             	add    $0x1,%ebx
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	83 fb 20             	cmp    $0x20,%ebx
+  801fa3:	75 ec                	jne    801f91 <close_all+0xc>
+  801fa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa8:	c9                   	leave
+  801fa9:	c3                   	ret
+
+00801faa <dup>:
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	57                   	push   %edi
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	83 ec 34             	sub    $0x34,%esp
+  801fb3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fb6:	50                   	push   %eax
+  801fb7:	ff 75 08             	push   0x8(%ebp)
+  801fba:	e8 73 fe ff ff       	call   801e32 <fd_lookup>
+  801fbf:	89 c3                	mov    %eax,%ebx
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	78 7f                	js     802047 <dup+0x9d>
+  801fc8:	83 ec 0c             	sub    $0xc,%esp
+  801fcb:	ff 75 0c             	push   0xc(%ebp)
+  801fce:	e8 85 ff ff ff       	call   801f58 <close>
+  801fd3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fd6:	c1 e6 0c             	shl    $0xc,%esi
+  801fd9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801fdf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801fe2:	89 3c 24             	mov    %edi,(%esp)
+  801fe5:	e8 e1 fd ff ff       	call   801dcb <fd2data>
+  801fea:	89 c3                	mov    %eax,%ebx
+  801fec:	89 34 24             	mov    %esi,(%esp)
+  801fef:	e8 d7 fd ff ff       	call   801dcb <fd2data>
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ffa:	89 d8                	mov    %ebx,%eax
+  801ffc:	c1 e8 16             	shr    $0x16,%eax
+  801fff:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802006:	a8 01                	test   $0x1,%al
+  802008:	74 11                	je     80201b <dup+0x71>
+  80200a:	89 d8                	mov    %ebx,%eax
+  80200c:	c1 e8 0c             	shr    $0xc,%eax
+  80200f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802016:	f6 c2 01             	test   $0x1,%dl
+  802019:	75 36                	jne    802051 <dup+0xa7>
+  80201b:	89 f8                	mov    %edi,%eax
+  80201d:	c1 e8 0c             	shr    $0xc,%eax
+  802020:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802027:	83 ec 0c             	sub    $0xc,%esp
+  80202a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80202f:	50                   	push   %eax
+  802030:	56                   	push   %esi
+  802031:	6a 00                	push   $0x0
+  802033:	57                   	push   %edi
+  802034:	6a 00                	push   $0x0
+  802036:	e8 24 f0 ff ff       	call   80105f <sys_page_map>
+  80203b:	89 c3                	mov    %eax,%ebx
+  80203d:	83 c4 20             	add    $0x20,%esp
+  802040:	85 c0                	test   %eax,%eax
+  802042:	78 33                	js     802077 <dup+0xcd>
+  802044:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802047:	89 d8                	mov    %ebx,%eax
+  802049:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80204c:	5b                   	pop    %ebx
+  80204d:	5e                   	pop    %esi
+  80204e:	5f                   	pop    %edi
+  80204f:	5d                   	pop    %ebp
+  802050:	c3                   	ret
+  802051:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802058:	83 ec 0c             	sub    $0xc,%esp
+  80205b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802060:	50                   	push   %eax
+  802061:	ff 75 d4             	push   -0x2c(%ebp)
+  802064:	6a 00                	push   $0x0
+  802066:	53                   	push   %ebx
+  802067:	6a 00                	push   $0x0
+  802069:	e8 f1 ef ff ff       	call   80105f <sys_page_map>
+  80206e:	89 c3                	mov    %eax,%ebx
+  802070:	83 c4 20             	add    $0x20,%esp
+  802073:	85 c0                	test   %eax,%eax
+  802075:	79 a4                	jns    80201b <dup+0x71>
+  802077:	83 ec 08             	sub    $0x8,%esp
+  80207a:	56                   	push   %esi
+  80207b:	6a 00                	push   $0x0
+  80207d:	e8 6c f0 ff ff       	call   8010ee <sys_page_unmap>
+  802082:	83 c4 08             	add    $0x8,%esp
+  802085:	ff 75 d4             	push   -0x2c(%ebp)
+  802088:	6a 00                	push   $0x0
+  80208a:	e8 5f f0 ff ff       	call   8010ee <sys_page_unmap>
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	eb b3                	jmp    802047 <dup+0x9d>
+
+00802094 <read>:
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+  802097:	56                   	push   %esi
+  802098:	53                   	push   %ebx
+  802099:	83 ec 18             	sub    $0x18,%esp
+  80209c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80209f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020a2:	50                   	push   %eax
+  8020a3:	56                   	push   %esi
+  8020a4:	e8 89 fd ff ff       	call   801e32 <fd_lookup>
+  8020a9:	83 c4 10             	add    $0x10,%esp
+  8020ac:	85 c0                	test   %eax,%eax
+  8020ae:	78 3c                	js     8020ec <read+0x58>
+  8020b0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8020b3:	83 ec 08             	sub    $0x8,%esp
+  8020b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b9:	50                   	push   %eax
+  8020ba:	ff 33                	push   (%ebx)
+  8020bc:	e8 c1 fd ff ff       	call   801e82 <dev_lookup>
+  8020c1:	83 c4 10             	add    $0x10,%esp
+  8020c4:	85 c0                	test   %eax,%eax
+  8020c6:	78 24                	js     8020ec <read+0x58>
+  8020c8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8020cb:	83 e0 03             	and    $0x3,%eax
+  8020ce:	83 f8 01             	cmp    $0x1,%eax
+  8020d1:	74 20                	je     8020f3 <read+0x5f>
+  8020d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020d6:	8b 40 08             	mov    0x8(%eax),%eax
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	74 37                	je     802114 <read+0x80>
+  8020dd:	83 ec 04             	sub    $0x4,%esp
+  8020e0:	ff 75 10             	push   0x10(%ebp)
+  8020e3:	ff 75 0c             	push   0xc(%ebp)
+  8020e6:	53                   	push   %ebx
+  8020e7:	ff d0                	call   *%eax
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ef:	5b                   	pop    %ebx
+  8020f0:	5e                   	pop    %esi
+  8020f1:	5d                   	pop    %ebp
+  8020f2:	c3                   	ret
+  8020f3:	a1 20 64 80 00       	mov    0x806420,%eax
+  8020f8:	8b 40 48             	mov    0x48(%eax),%eax
+  8020fb:	83 ec 04             	sub    $0x4,%esp
+  8020fe:	56                   	push   %esi
+  8020ff:	50                   	push   %eax
+  802100:	68 81 41 80 00       	push   $0x804181
+  802105:	e8 bb e3 ff ff       	call   8004c5 <cprintf>
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802112:	eb d8                	jmp    8020ec <read+0x58>
+  802114:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802119:	eb d1                	jmp    8020ec <read+0x58>
+
+0080211b <readn>:
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	57                   	push   %edi
+  80211f:	56                   	push   %esi
+  802120:	53                   	push   %ebx
+  802121:	83 ec 0c             	sub    $0xc,%esp
+  802124:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802127:	8b 75 10             	mov    0x10(%ebp),%esi
+  80212a:	85 f6                	test   %esi,%esi
+  80212c:	74 30                	je     80215e <readn+0x43>
+  80212e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802133:	b8 00 00 00 00       	mov    $0x0,%eax
+  802138:	83 ec 04             	sub    $0x4,%esp
+  80213b:	89 f2                	mov    %esi,%edx
+  80213d:	29 c2                	sub    %eax,%edx
+  80213f:	52                   	push   %edx
+  802140:	01 f8                	add    %edi,%eax
+  802142:	50                   	push   %eax
+  802143:	ff 75 08             	push   0x8(%ebp)
+  802146:	e8 49 ff ff ff       	call   802094 <read>
+  80214b:	83 c4 10             	add    $0x10,%esp
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 15                	js     802167 <readn+0x4c>
+  802152:	74 11                	je     802165 <readn+0x4a>
+  802154:	01 c3                	add    %eax,%ebx
+  802156:	89 d8                	mov    %ebx,%eax
+  802158:	39 f3                	cmp    %esi,%ebx
+  80215a:	72 dc                	jb     802138 <readn+0x1d>
+  80215c:	eb 09                	jmp    802167 <readn+0x4c>
+  80215e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802163:	eb 02                	jmp    802167 <readn+0x4c>
+  802165:	89 d8                	mov    %ebx,%eax
+  802167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80216a:	5b                   	pop    %ebx
+  80216b:	5e                   	pop    %esi
+  80216c:	5f                   	pop    %edi
+  80216d:	5d                   	pop    %ebp
+  80216e:	c3                   	ret
+
+0080216f <write>:
+  80216f:	55                   	push   %ebp
+  802170:	89 e5                	mov    %esp,%ebp
+  802172:	56                   	push   %esi
+  802173:	53                   	push   %ebx
+  802174:	83 ec 18             	sub    $0x18,%esp
+  802177:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80217a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80217d:	50                   	push   %eax
+  80217e:	53                   	push   %ebx
+  80217f:	e8 ae fc ff ff       	call   801e32 <fd_lookup>
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	85 c0                	test   %eax,%eax
+  802189:	78 37                	js     8021c2 <write+0x53>
+  80218b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80218e:	83 ec 08             	sub    $0x8,%esp
+  802191:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802194:	50                   	push   %eax
+  802195:	ff 36                	push   (%esi)
+  802197:	e8 e6 fc ff ff       	call   801e82 <dev_lookup>
+  80219c:	83 c4 10             	add    $0x10,%esp
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	78 1f                	js     8021c2 <write+0x53>
+  8021a3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021a7:	74 20                	je     8021c9 <write+0x5a>
+  8021a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ac:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	74 37                	je     8021ea <write+0x7b>
+  8021b3:	83 ec 04             	sub    $0x4,%esp
+  8021b6:	ff 75 10             	push   0x10(%ebp)
+  8021b9:	ff 75 0c             	push   0xc(%ebp)
+  8021bc:	56                   	push   %esi
+  8021bd:	ff d0                	call   *%eax
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c5:	5b                   	pop    %ebx
+  8021c6:	5e                   	pop    %esi
+  8021c7:	5d                   	pop    %ebp
+  8021c8:	c3                   	ret
+  8021c9:	a1 20 64 80 00       	mov    0x806420,%eax
+  8021ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8021d1:	83 ec 04             	sub    $0x4,%esp
+  8021d4:	53                   	push   %ebx
+  8021d5:	50                   	push   %eax
+  8021d6:	68 9d 41 80 00       	push   $0x80419d
+  8021db:	e8 e5 e2 ff ff       	call   8004c5 <cprintf>
+  8021e0:	83 c4 10             	add    $0x10,%esp
+  8021e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021e8:	eb d8                	jmp    8021c2 <write+0x53>
+  8021ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021ef:	eb d1                	jmp    8021c2 <write+0x53>
+
+008021f1 <seek>:
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	83 ec 20             	sub    $0x20,%esp
+  8021f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021fa:	50                   	push   %eax
+  8021fb:	ff 75 08             	push   0x8(%ebp)
+  8021fe:	e8 2f fc ff ff       	call   801e32 <fd_lookup>
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	85 c0                	test   %eax,%eax
+  802208:	78 0e                	js     802218 <seek+0x27>
+  80220a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80220d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802210:	89 50 04             	mov    %edx,0x4(%eax)
+  802213:	b8 00 00 00 00       	mov    $0x0,%eax
+  802218:	c9                   	leave
+  802219:	c3                   	ret
+
+0080221a <ftruncate>:
+  80221a:	55                   	push   %ebp
+  80221b:	89 e5                	mov    %esp,%ebp
+  80221d:	56                   	push   %esi
+  80221e:	53                   	push   %ebx
+  80221f:	83 ec 18             	sub    $0x18,%esp
+  802222:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802225:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802228:	50                   	push   %eax
+  802229:	53                   	push   %ebx
+  80222a:	e8 03 fc ff ff       	call   801e32 <fd_lookup>
+  80222f:	83 c4 10             	add    $0x10,%esp
+  802232:	85 c0                	test   %eax,%eax
+  802234:	78 34                	js     80226a <ftruncate+0x50>
+  802236:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802239:	83 ec 08             	sub    $0x8,%esp
+  80223c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80223f:	50                   	push   %eax
+  802240:	ff 36                	push   (%esi)
+  802242:	e8 3b fc ff ff       	call   801e82 <dev_lookup>
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	78 1c                	js     80226a <ftruncate+0x50>
+  80224e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802252:	74 1d                	je     802271 <ftruncate+0x57>
+  802254:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802257:	8b 40 18             	mov    0x18(%eax),%eax
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	74 34                	je     802292 <ftruncate+0x78>
+  80225e:	83 ec 08             	sub    $0x8,%esp
+  802261:	ff 75 0c             	push   0xc(%ebp)
+  802264:	56                   	push   %esi
+  802265:	ff d0                	call   *%eax
+  802267:	83 c4 10             	add    $0x10,%esp
+  80226a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80226d:	5b                   	pop    %ebx
+  80226e:	5e                   	pop    %esi
+  80226f:	5d                   	pop    %ebp
+  802270:	c3                   	ret
+  802271:	a1 20 64 80 00       	mov    0x806420,%eax
+  802276:	8b 40 48             	mov    0x48(%eax),%eax
+  802279:	83 ec 04             	sub    $0x4,%esp
+  80227c:	53                   	push   %ebx
+  80227d:	50                   	push   %eax
+  80227e:	68 60 41 80 00       	push   $0x804160
+  802283:	e8 3d e2 ff ff       	call   8004c5 <cprintf>
+  802288:	83 c4 10             	add    $0x10,%esp
+  80228b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802290:	eb d8                	jmp    80226a <ftruncate+0x50>
+  802292:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802297:	eb d1                	jmp    80226a <ftruncate+0x50>
+
+00802299 <fstat>:
+  802299:	55                   	push   %ebp
+  80229a:	89 e5                	mov    %esp,%ebp
+  80229c:	56                   	push   %esi
+  80229d:	53                   	push   %ebx
+  80229e:	83 ec 18             	sub    $0x18,%esp
+  8022a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022a4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022a7:	50                   	push   %eax
+  8022a8:	ff 75 08             	push   0x8(%ebp)
+  8022ab:	e8 82 fb ff ff       	call   801e32 <fd_lookup>
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	85 c0                	test   %eax,%eax
+  8022b5:	78 49                	js     802300 <fstat+0x67>
+  8022b7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022ba:	83 ec 08             	sub    $0x8,%esp
+  8022bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c0:	50                   	push   %eax
+  8022c1:	ff 36                	push   (%esi)
+  8022c3:	e8 ba fb ff ff       	call   801e82 <dev_lookup>
+  8022c8:	83 c4 10             	add    $0x10,%esp
+  8022cb:	85 c0                	test   %eax,%eax
+  8022cd:	78 31                	js     802300 <fstat+0x67>
+  8022cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8022d6:	74 2f                	je     802307 <fstat+0x6e>
+  8022d8:	c6 03 00             	movb   $0x0,(%ebx)
+  8022db:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8022e2:	00 00 00 
+  8022e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022ec:	00 00 00 
+  8022ef:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8022f5:	83 ec 08             	sub    $0x8,%esp
+  8022f8:	53                   	push   %ebx
+  8022f9:	56                   	push   %esi
+  8022fa:	ff 50 14             	call   *0x14(%eax)
+  8022fd:	83 c4 10             	add    $0x10,%esp
+  802300:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802303:	5b                   	pop    %ebx
+  802304:	5e                   	pop    %esi
+  802305:	5d                   	pop    %ebp
+  802306:	c3                   	ret
+  802307:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80230c:	eb f2                	jmp    802300 <fstat+0x67>
+
+0080230e <stat>:
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	56                   	push   %esi
+  802312:	53                   	push   %ebx
+  802313:	83 ec 08             	sub    $0x8,%esp
+  802316:	6a 00                	push   $0x0
+  802318:	ff 75 08             	push   0x8(%ebp)
+  80231b:	e8 31 05 00 00       	call   802851 <open>
+  802320:	89 c3                	mov    %eax,%ebx
+  802322:	83 c4 10             	add    $0x10,%esp
+  802325:	85 c0                	test   %eax,%eax
+  802327:	78 1b                	js     802344 <stat+0x36>
+  802329:	83 ec 08             	sub    $0x8,%esp
+  80232c:	ff 75 0c             	push   0xc(%ebp)
+  80232f:	50                   	push   %eax
+  802330:	e8 64 ff ff ff       	call   802299 <fstat>
+  802335:	89 c6                	mov    %eax,%esi
+  802337:	89 1c 24             	mov    %ebx,(%esp)
+  80233a:	e8 19 fc ff ff       	call   801f58 <close>
+  80233f:	83 c4 10             	add    $0x10,%esp
+  802342:	89 f3                	mov    %esi,%ebx
+  802344:	89 d8                	mov    %ebx,%eax
+  802346:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802349:	5b                   	pop    %ebx
+  80234a:	5e                   	pop    %esi
+  80234b:	5d                   	pop    %ebp
+  80234c:	c3                   	ret
+
+0080234d <fsipc>:
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	56                   	push   %esi
+  802351:	53                   	push   %ebx
+  802352:	89 c3                	mov    %eax,%ebx
+  802354:	89 d6                	mov    %edx,%esi
+  802356:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  80235d:	74 20                	je     80237f <fsipc+0x32>
+  80235f:	83 ec 08             	sub    $0x8,%esp
+  802362:	6a 00                	push   $0x0
+  802364:	56                   	push   %esi
+  802365:	6a 07                	push   $0x7
+  802367:	68 00 70 80 00       	push   $0x807000
+  80236c:	53                   	push   %ebx
+  80236d:	ff 35 0c 60 80 00    	push   0x80600c
+  802373:	e8 5f 13 00 00       	call   8036d7 <ipc_call>
+  802378:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80237b:	5b                   	pop    %ebx
+  80237c:	5e                   	pop    %esi
+  80237d:	5d                   	pop    %ebp
+  80237e:	c3                   	ret
+  80237f:	83 ec 0c             	sub    $0xc,%esp
+  802382:	6a 02                	push   $0x2
+  802384:	e8 e9 14 00 00       	call   803872 <ipc_find_env>
+  802389:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	eb cc                	jmp    80235f <fsipc+0x12>
+
+00802393 <devfile_trunc>:
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	83 ec 08             	sub    $0x8,%esp
+  802399:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80239f:	a3 00 70 80 00       	mov    %eax,0x807000
+  8023a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a7:	a3 04 70 80 00       	mov    %eax,0x807004
+  8023ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023b6:	e8 92 ff ff ff       	call   80234d <fsipc>
+  8023bb:	c9                   	leave
+  8023bc:	c3                   	ret
+
+008023bd <devfile_flush>:
+  8023bd:	55                   	push   %ebp
+  8023be:	89 e5                	mov    %esp,%ebp
+  8023c0:	83 ec 08             	sub    $0x8,%esp
+  8023c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c9:	a3 00 70 80 00       	mov    %eax,0x807000
+  8023ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023d8:	e8 70 ff ff ff       	call   80234d <fsipc>
+  8023dd:	c9                   	leave
+  8023de:	c3                   	ret
+
+008023df <devfile_stat>:
+  8023df:	55                   	push   %ebp
+  8023e0:	89 e5                	mov    %esp,%ebp
+  8023e2:	53                   	push   %ebx
+  8023e3:	83 ec 04             	sub    $0x4,%esp
+  8023e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ec:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023ef:	a3 00 70 80 00       	mov    %eax,0x807000
+  8023f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023fe:	e8 4a ff ff ff       	call   80234d <fsipc>
+  802403:	85 c0                	test   %eax,%eax
+  802405:	78 2c                	js     802433 <devfile_stat+0x54>
+  802407:	83 ec 08             	sub    $0x8,%esp
+  80240a:	68 00 70 80 00       	push   $0x807000
+  80240f:	53                   	push   %ebx
+  802410:	e8 a7 e7 ff ff       	call   800bbc <strcpy>
+  802415:	a1 80 70 80 00       	mov    0x807080,%eax
+  80241a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802420:	a1 84 70 80 00       	mov    0x807084,%eax
+  802425:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80242b:	83 c4 10             	add    $0x10,%esp
+  80242e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802433:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802436:	c9                   	leave
+  802437:	c3                   	ret
+
+00802438 <fsring_rw>:
+  802438:	55                   	push   %ebp
+  802439:	89 e5                	mov    %esp,%ebp
+  80243b:	57                   	push   %edi
+  80243c:	56                   	push   %esi
+  80243d:	53                   	push   %ebx
+  80243e:	83 ec 2c             	sub    $0x2c,%esp
+  802441:	89 c7                	mov    %eax,%edi
+  802443:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802446:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802449:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80244e:	a8 01                	test   $0x1,%al
+  802450:	74 0d                	je     80245f <fsring_rw+0x27>
+  802452:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802457:	a8 01                	test   $0x1,%al
+  802459:	0f 85 d5 00 00 00    	jne    802534 <fsring_rw+0xfc>
+  80245f:	a1 20 64 80 00       	mov    0x806420,%eax
+  802464:	8b 40 48             	mov    0x48(%eax),%eax
+  802467:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  80246d:	0f 84 fc 00 00 00    	je     80256f <fsring_rw+0x137>
+  802473:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  80247a:	0f 84 02 01 00 00    	je     802582 <fsring_rw+0x14a>
+  802480:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802485:	83 ec 04             	sub    $0x4,%esp
+  802488:	68 07 02 00 00       	push   $0x207
+  80248d:	53                   	push   %ebx
+  80248e:	6a 00                	push   $0x0
+  802490:	e8 87 eb ff ff       	call   80101c <sys_page_alloc>
+  802495:	83 c4 10             	add    $0x10,%esp
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	0f 88 f9 00 00 00    	js     802599 <fsring_rw+0x161>
+  8024a0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024a6:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8024ac:	75 d7                	jne    802485 <fsring_rw+0x4d>
+  8024ae:	6a 0e                	push   $0xe
+  8024b0:	6a 0d                	push   $0xd
+  8024b2:	ff 35 0c 60 80 00    	push   0x80600c
+  8024b8:	68 00 00 f0 cf       	push   $0xcff00000
+  8024bd:	e8 26 0d 00 00       	call   8031e8 <ipcring_init>
+  8024c2:	83 c4 08             	add    $0x8,%esp
+  8024c5:	6a 00                	push   $0x0
+  8024c7:	6a 00                	push   $0x0
+  8024c9:	68 07 02 00 00       	push   $0x207
+  8024ce:	68 00 00 f0 cf       	push   $0xcff00000
+  8024d3:	6a 0b                	push   $0xb
+  8024d5:	ff 35 0c 60 80 00    	push   0x80600c
+  8024db:	e8 f7 11 00 00       	call   8036d7 <ipc_call>
+  8024e0:	89 c6                	mov    %eax,%esi
+  8024e2:	83 c4 20             	add    $0x20,%esp
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	0f 88 ac 00 00 00    	js     802599 <fsring_rw+0x161>
+  8024ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024f2:	89 d9                	mov    %ebx,%ecx
+  8024f4:	83 c3 01             	add    $0x1,%ebx
+  8024f7:	89 da                	mov    %ebx,%edx
+  8024f9:	c1 e2 0c             	shl    $0xc,%edx
+  8024fc:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802502:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802508:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80250e:	83 ec 08             	sub    $0x8,%esp
+  802511:	6a 00                	push   $0x0
+  802513:	6a 00                	push   $0x0
+  802515:	68 07 02 00 00       	push   $0x207
+  80251a:	50                   	push   %eax
+  80251b:	6a 0c                	push   $0xc
+  80251d:	ff 35 0c 60 80 00    	push   0x80600c
+  802523:	e8 af 11 00 00       	call   8036d7 <ipc_call>
+  802528:	83 c4 20             	add    $0x20,%esp
+  80252b:	85 c0                	test   %eax,%eax
+  80252d:	78 6a                	js     802599 <fsring_rw+0x161>
+  80252f:	83 fb 08             	cmp    $0x8,%ebx
+  802532:	75 be                	jne    8024f2 <fsring_rw+0xba>
+  802534:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802538:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80253d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802542:	0f 45 c2             	cmovne %edx,%eax
+  802545:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802548:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80254f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802556:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  80255d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802562:	be 00 00 00 00       	mov    $0x0,%esi
+  802567:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80256a:	e9 4b 01 00 00       	jmp    8026ba <fsring_rw+0x282>
+  80256f:	e8 72 ee ff ff       	call   8013e6 <sys_time_msec>
+  802574:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  80257a:	0f 89 f3 fe ff ff    	jns    802473 <fsring_rw+0x3b>
+  802580:	eb 54                	jmp    8025d6 <fsring_rw+0x19e>
+  802582:	83 ec 0c             	sub    $0xc,%esp
+  802585:	6a 02                	push   $0x2
+  802587:	e8 e6 12 00 00       	call   803872 <ipc_find_env>
+  80258c:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802591:	83 c4 10             	add    $0x10,%esp
+  802594:	e9 e7 fe ff ff       	jmp    802480 <fsring_rw+0x48>
+  802599:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80259e:	83 ec 08             	sub    $0x8,%esp
+  8025a1:	53                   	push   %ebx
+  8025a2:	6a 00                	push   $0x0
+  8025a4:	e8 45 eb ff ff       	call   8010ee <sys_page_unmap>
+  8025a9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025af:	83 c4 10             	add    $0x10,%esp
+  8025b2:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8025b8:	75 e4                	jne    80259e <fsring_rw+0x166>
+  8025ba:	e8 27 ee ff ff       	call   8013e6 <sys_time_msec>
+  8025bf:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8025c4:	a3 04 60 80 00       	mov    %eax,0x806004
+  8025c9:	a1 20 64 80 00       	mov    0x806420,%eax
+  8025ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8025d1:	a3 08 60 80 00       	mov    %eax,0x806008
+  8025d6:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8025dd:	e9 7a 01 00 00       	jmp    80275c <fsring_rw+0x324>
+  8025e2:	8b 57 0c             	mov    0xc(%edi),%edx
+  8025e5:	89 10                	mov    %edx,(%eax)
+  8025e7:	89 58 04             	mov    %ebx,0x4(%eax)
+  8025ea:	89 f2                	mov    %esi,%edx
+  8025ec:	03 57 04             	add    0x4(%edi),%edx
+  8025ef:	89 50 08             	mov    %edx,0x8(%eax)
+  8025f2:	83 ec 04             	sub    $0x4,%esp
+  8025f5:	53                   	push   %ebx
+  8025f6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8025f9:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8025fc:	52                   	push   %edx
+  8025fd:	83 c0 0c             	add    $0xc,%eax
+  802600:	50                   	push   %eax
+  802601:	e8 66 e7 ff ff       	call   800d6c <memmove>
+  802606:	83 c4 10             	add    $0x10,%esp
+  802609:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80260c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80260f:	89 08                	mov    %ecx,(%eax)
+  802611:	83 ec 0c             	sub    $0xc,%esp
+  802614:	68 00 00 f0 cf       	push   $0xcff00000
+  802619:	e8 28 0c 00 00       	call   803246 <ipcring_req_push>
+  80261e:	01 de                	add    %ebx,%esi
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802626:	73 4c                	jae    802674 <fsring_rw+0x23c>
+  802628:	83 ec 0c             	sub    $0xc,%esp
+  80262b:	68 00 00 f0 cf       	push   $0xcff00000
+  802630:	e8 eb 0b 00 00       	call   803220 <ipcring_req_slot>
+  802635:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802638:	83 c4 10             	add    $0x10,%esp
+  80263b:	85 c0                	test   %eax,%eax
+  80263d:	74 35                	je     802674 <fsring_rw+0x23c>
+  80263f:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802644:	83 e0 07             	and    $0x7,%eax
+  802647:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80264c:	c1 e0 0c             	shl    $0xc,%eax
+  80264f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802652:	29 f3                	sub    %esi,%ebx
+  802654:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802657:	39 cb                	cmp    %ecx,%ebx
+  802659:	0f 47 d9             	cmova  %ecx,%ebx
+  80265c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802660:	75 80                	jne    8025e2 <fsring_rw+0x1aa>
+  802662:	8b 57 0c             	mov    0xc(%edi),%edx
+  802665:	89 10                	mov    %edx,(%eax)
+  802667:	89 58 04             	mov    %ebx,0x4(%eax)
+  80266a:	89 f2                	mov    %esi,%edx
+  80266c:	03 57 04             	add    0x4(%edi),%edx
+  80266f:	89 50 08             	mov    %edx,0x8(%eax)
+  802672:	eb 95                	jmp    802609 <fsring_rw+0x1d1>
+  802674:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802679:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80267c:	83 ec 0c             	sub    $0xc,%esp
+  80267f:	68 00 00 f0 cf       	push   $0xcff00000
+  802684:	e8 f6 0b 00 00       	call   80327f <ipcring_rsp_wait>
+  802689:	8b 58 04             	mov    0x4(%eax),%ebx
+  80268c:	83 c4 10             	add    $0x10,%esp
+  80268f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802693:	75 45                	jne    8026da <fsring_rw+0x2a2>
+  802695:	85 db                	test   %ebx,%ebx
+  802697:	79 41                	jns    8026da <fsring_rw+0x2a2>
+  802699:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80269c:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8026a3:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8026aa:	83 ec 0c             	sub    $0xc,%esp
+  8026ad:	68 00 00 f0 cf       	push   $0xcff00000
+  8026b2:	e8 2e 0c 00 00       	call   8032e5 <ipcring_rsp_pop>
+  8026b7:	83 c4 10             	add    $0x10,%esp
+  8026ba:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8026c0:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8026c5:	39 c2                	cmp    %eax,%edx
+  8026c7:	74 75                	je     80273e <fsring_rw+0x306>
+  8026c9:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8026cd:	75 a5                	jne    802674 <fsring_rw+0x23c>
+  8026cf:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8026d2:	0f 82 50 ff ff ff    	jb     802628 <fsring_rw+0x1f0>
+  8026d8:	eb 9a                	jmp    802674 <fsring_rw+0x23c>
+  8026da:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8026de:	75 ca                	jne    8026aa <fsring_rw+0x272>
+  8026e0:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8026e4:	74 31                	je     802717 <fsring_rw+0x2df>
+  8026e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e9:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8026ec:	29 c8                	sub    %ecx,%eax
+  8026ee:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8026f1:	39 d0                	cmp    %edx,%eax
+  8026f3:	0f 47 c2             	cmova  %edx,%eax
+  8026f6:	39 d8                	cmp    %ebx,%eax
+  8026f8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8026fd:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802701:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802704:	b8 01 00 00 00       	mov    $0x1,%eax
+  802709:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80270d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802710:	01 d9                	add    %ebx,%ecx
+  802712:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802715:	eb 93                	jmp    8026aa <fsring_rw+0x272>
+  802717:	83 ec 04             	sub    $0x4,%esp
+  80271a:	53                   	push   %ebx
+  80271b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80271e:	83 e0 07             	and    $0x7,%eax
+  802721:	c1 e0 0c             	shl    $0xc,%eax
+  802724:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80272a:	50                   	push   %eax
+  80272b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80272e:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802731:	01 c8                	add    %ecx,%eax
+  802733:	50                   	push   %eax
+  802734:	e8 33 e6 ff ff       	call   800d6c <memmove>
+  802739:	83 c4 10             	add    $0x10,%esp
+  80273c:	eb a8                	jmp    8026e6 <fsring_rw+0x2ae>
+  80273e:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802742:	75 09                	jne    80274d <fsring_rw+0x315>
+  802744:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802747:	0f 82 db fe ff ff    	jb     802628 <fsring_rw+0x1f0>
+  80274d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802750:	01 57 04             	add    %edx,0x4(%edi)
+  802753:	85 d2                	test   %edx,%edx
+  802755:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802759:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80275c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80275f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802762:	5b                   	pop    %ebx
+  802763:	5e                   	pop    %esi
+  802764:	5f                   	pop    %edi
+  802765:	5d                   	pop    %ebp
+  802766:	c3                   	ret
+
+00802767 <devfile_write>:
+  802767:	55                   	push   %ebp
+  802768:	89 e5                	mov    %esp,%ebp
+  80276a:	57                   	push   %edi
+  80276b:	56                   	push   %esi
+  80276c:	53                   	push   %ebx
+  80276d:	83 ec 0c             	sub    $0xc,%esp
+  802770:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802773:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802776:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802779:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80277f:	76 1a                	jbe    80279b <devfile_write+0x34>
+  802781:	83 ec 0c             	sub    $0xc,%esp
+  802784:	53                   	push   %ebx
+  802785:	89 f1                	mov    %esi,%ecx
+  802787:	ba 06 00 00 00       	mov    $0x6,%edx
+  80278c:	89 f8                	mov    %edi,%eax
+  80278e:	e8 a5 fc ff ff       	call   802438 <fsring_rw>
+  802793:	83 c4 10             	add    $0x10,%esp
+  802796:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802799:	75 39                	jne    8027d4 <devfile_write+0x6d>
+  80279b:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8027a0:	39 c3                	cmp    %eax,%ebx
+  8027a2:	0f 47 d8             	cmova  %eax,%ebx
+  8027a5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8027a8:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027ad:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8027b3:	83 ec 04             	sub    $0x4,%esp
+  8027b6:	53                   	push   %ebx
+  8027b7:	56                   	push   %esi
+  8027b8:	68 08 70 80 00       	push   $0x807008
+  8027bd:	e8 aa e5 ff ff       	call   800d6c <memmove>
+  8027c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027cc:	e8 7c fb ff ff       	call   80234d <fsipc>
+  8027d1:	83 c4 10             	add    $0x10,%esp
+  8027d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d7:	5b                   	pop    %ebx
+  8027d8:	5e                   	pop    %esi
+  8027d9:	5f                   	pop    %edi
+  8027da:	5d                   	pop    %ebp
+  8027db:	c3                   	ret
+
+008027dc <devfile_read>:
+  8027dc:	55                   	push   %ebp
+  8027dd:	89 e5                	mov    %esp,%ebp
+  8027df:	57                   	push   %edi
+  8027e0:	56                   	push   %esi
+  8027e1:	53                   	push   %ebx
+  8027e2:	83 ec 0c             	sub    $0xc,%esp
+  8027e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027e8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8027eb:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8027f1:	76 1d                	jbe    802810 <devfile_read+0x34>
+  8027f3:	83 ec 0c             	sub    $0xc,%esp
+  8027f6:	56                   	push   %esi
+  8027f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027fa:	ba 05 00 00 00       	mov    $0x5,%edx
+  8027ff:	89 f8                	mov    %edi,%eax
+  802801:	e8 32 fc ff ff       	call   802438 <fsring_rw>
+  802806:	89 c3                	mov    %eax,%ebx
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80280e:	75 37                	jne    802847 <devfile_read+0x6b>
+  802810:	8b 47 0c             	mov    0xc(%edi),%eax
+  802813:	a3 00 70 80 00       	mov    %eax,0x807000
+  802818:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80281e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802823:	b8 03 00 00 00       	mov    $0x3,%eax
+  802828:	e8 20 fb ff ff       	call   80234d <fsipc>
+  80282d:	89 c3                	mov    %eax,%ebx
+  80282f:	85 c0                	test   %eax,%eax
+  802831:	78 14                	js     802847 <devfile_read+0x6b>
+  802833:	83 ec 04             	sub    $0x4,%esp
+  802836:	50                   	push   %eax
+  802837:	68 00 70 80 00       	push   $0x807000
+  80283c:	ff 75 0c             	push   0xc(%ebp)
+  80283f:	e8 28 e5 ff ff       	call   800d6c <memmove>
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	89 d8                	mov    %ebx,%eax
+  802849:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80284c:	5b                   	pop    %ebx
+  80284d:	5e                   	pop    %esi
+  80284e:	5f                   	pop    %edi
+  80284f:	5d                   	pop    %ebp
+  802850:	c3                   	ret
+
+00802851 <open>:
+  802851:	55                   	push   %ebp
+  802852:	89 e5                	mov    %esp,%ebp
+  802854:	56                   	push   %esi
+  802855:	53                   	push   %ebx
+  802856:	83 ec 1c             	sub    $0x1c,%esp
+  802859:	8b 75 08             	mov    0x8(%ebp),%esi
+  80285c:	56                   	push   %esi
+  80285d:	e8 0e e3 ff ff       	call   800b70 <strlen>
+  802862:	83 c4 10             	add    $0x10,%esp
+  802865:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80286a:	7f 6c                	jg     8028d8 <open+0x87>
+  80286c:	83 ec 0c             	sub    $0xc,%esp
+  80286f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802872:	50                   	push   %eax
+  802873:	e8 6a f5 ff ff       	call   801de2 <fd_alloc>
+  802878:	89 c3                	mov    %eax,%ebx
+  80287a:	83 c4 10             	add    $0x10,%esp
+  80287d:	85 c0                	test   %eax,%eax
+  80287f:	78 3c                	js     8028bd <open+0x6c>
+  802881:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802884:	a3 00 74 80 00       	mov    %eax,0x807400
+  802889:	83 ec 08             	sub    $0x8,%esp
+  80288c:	56                   	push   %esi
+  80288d:	68 00 70 80 00       	push   $0x807000
+  802892:	e8 25 e3 ff ff       	call   800bbc <strcpy>
+  802897:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80289a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80289f:	e8 a9 fa ff ff       	call   80234d <fsipc>
+  8028a4:	89 c3                	mov    %eax,%ebx
+  8028a6:	83 c4 10             	add    $0x10,%esp
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	78 19                	js     8028c6 <open+0x75>
+  8028ad:	83 ec 0c             	sub    $0xc,%esp
+  8028b0:	ff 75 f4             	push   -0xc(%ebp)
+  8028b3:	e8 03 f5 ff ff       	call   801dbb <fd2num>
+  8028b8:	89 c3                	mov    %eax,%ebx
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	89 d8                	mov    %ebx,%eax
+  8028bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c2:	5b                   	pop    %ebx
+  8028c3:	5e                   	pop    %esi
+  8028c4:	5d                   	pop    %ebp
+  8028c5:	c3                   	ret
+  8028c6:	83 ec 08             	sub    $0x8,%esp
+  8028c9:	6a 00                	push   $0x0
+  8028cb:	ff 75 f4             	push   -0xc(%ebp)
+  8028ce:	e8 05 f6 ff ff       	call   801ed8 <fd_close>
+  8028d3:	83 c4 10             	add    $0x10,%esp
+  8028d6:	eb e5                	jmp    8028bd <open+0x6c>
+  8028d8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8028dd:	eb de                	jmp    8028bd <open+0x6c>
+
+008028df <file_image>:
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	53                   	push   %ebx
+  8028e3:	83 ec 1c             	sub    $0x1c,%esp
+  8028e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ec:	50                   	push   %eax
+  8028ed:	ff 75 08             	push   0x8(%ebp)
+  8028f0:	e8 3d f5 ff ff       	call   801e32 <fd_lookup>
+  8028f5:	83 c4 10             	add    $0x10,%esp
+  8028f8:	85 c0                	test   %eax,%eax
+  8028fa:	78 58                	js     802954 <file_image+0x75>
+  8028fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028ff:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802905:	39 08                	cmp    %ecx,(%eax)
+  802907:	75 50                	jne    802959 <file_image+0x7a>
+  802909:	83 fb 04             	cmp    $0x4,%ebx
+  80290c:	77 52                	ja     802960 <file_image+0x81>
+  80290e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802911:	a3 00 70 80 00       	mov    %eax,0x807000
+  802916:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80291c:	83 ec 04             	sub    $0x4,%esp
+  80291f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802922:	c1 e0 02             	shl    $0x2,%eax
+  802925:	50                   	push   %eax
+  802926:	ff 75 0c             	push   0xc(%ebp)
+  802929:	68 08 70 80 00       	push   $0x807008
+  80292e:	e8 39 e4 ff ff       	call   800d6c <memmove>
+  802933:	ba 00 00 00 00       	mov    $0x0,%edx
+  802938:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80293d:	e8 0b fa ff ff       	call   80234d <fsipc>
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 0b                	js     802954 <file_image+0x75>
+  802949:	8b 55 14             	mov    0x14(%ebp),%edx
+  80294c:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802952:	89 0a                	mov    %ecx,(%edx)
+  802954:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802957:	c9                   	leave
+  802958:	c3                   	ret
+  802959:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80295e:	eb f4                	jmp    802954 <file_image+0x75>
+  802960:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802965:	eb ed                	jmp    802954 <file_image+0x75>
+
+00802967 <remove>:
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	53                   	push   %ebx
+  80296b:	83 ec 10             	sub    $0x10,%esp
+  80296e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802971:	53                   	push   %ebx
+  802972:	e8 f9 e1 ff ff       	call   800b70 <strlen>
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80297f:	7f 25                	jg     8029a6 <remove+0x3f>
+  802981:	83 ec 08             	sub    $0x8,%esp
+  802984:	53                   	push   %ebx
+  802985:	68 00 70 80 00       	push   $0x807000
+  80298a:	e8 2d e2 ff ff       	call   800bbc <strcpy>
+  80298f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802994:	b8 09 00 00 00       	mov    $0x9,%eax
+  802999:	e8 af f9 ff ff       	call   80234d <fsipc>
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029a4:	c9                   	leave
+  8029a5:	c3                   	ret
+  8029a6:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8029ab:	eb f4                	jmp    8029a1 <remove+0x3a>
+
+008029ad <sync>:
+  8029ad:	55                   	push   %ebp
+  8029ae:	89 e5                	mov    %esp,%ebp
+  8029b0:	83 ec 08             	sub    $0x8,%esp
+  8029b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029bd:	e8 8b f9 ff ff       	call   80234d <fsipc>
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+
+008029c4 <devsock_stat>:
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	83 ec 10             	sub    $0x10,%esp
+  8029ca:	68 d0 41 80 00       	push   $0x8041d0
+  8029cf:	ff 75 0c             	push   0xc(%ebp)
+  8029d2:	e8 e5 e1 ff ff       	call   800bbc <strcpy>
+  8029d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029dc:	c9                   	leave
+  8029dd:	c3                   	ret
+
+008029de <devsock_close>:
+  8029de:	55                   	push   %ebp
+  8029df:	89 e5                	mov    %esp,%ebp
+  8029e1:	53                   	push   %ebx
+  8029e2:	83 ec 10             	sub    $0x10,%esp
+  8029e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029e8:	53                   	push   %ebx
+  8029e9:	e8 9e 0e 00 00       	call   80388c <pageref>
+  8029ee:	89 c2                	mov    %eax,%edx
+  8029f0:	83 c4 10             	add    $0x10,%esp
+  8029f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f8:	83 fa 01             	cmp    $0x1,%edx
+  8029fb:	74 05                	je     802a02 <devsock_close+0x24>
+  8029fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+  802a02:	83 ec 0c             	sub    $0xc,%esp
+  802a05:	ff 73 0c             	push   0xc(%ebx)
+  802a08:	e8 aa 02 00 00       	call   802cb7 <nsipc_close>
+  802a0d:	83 c4 10             	add    $0x10,%esp
+  802a10:	eb eb                	jmp    8029fd <devsock_close+0x1f>
+
+00802a12 <devsock_write>:
+  802a12:	55                   	push   %ebp
+  802a13:	89 e5                	mov    %esp,%ebp
+  802a15:	83 ec 08             	sub    $0x8,%esp
+  802a18:	6a 00                	push   $0x0
+  802a1a:	ff 75 10             	push   0x10(%ebp)
+  802a1d:	ff 75 0c             	push   0xc(%ebp)
+  802a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a23:	ff 70 0c             	push   0xc(%eax)
+  802a26:	e8 6c 03 00 00       	call   802d97 <nsipc_send>
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+
+00802a2d <devsock_read>:
+  802a2d:	55                   	push   %ebp
+  802a2e:	89 e5                	mov    %esp,%ebp
+  802a30:	83 ec 08             	sub    $0x8,%esp
+  802a33:	6a 00                	push   $0x0
+  802a35:	ff 75 10             	push   0x10(%ebp)
+  802a38:	ff 75 0c             	push   0xc(%ebp)
+  802a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3e:	ff 70 0c             	push   0xc(%eax)
+  802a41:	e8 e2 02 00 00       	call   802d28 <nsipc_recv>
+  802a46:	c9                   	leave
+  802a47:	c3                   	ret
+
+00802a48 <fd2sockid>:
+  802a48:	55                   	push   %ebp
+  802a49:	89 e5                	mov    %esp,%ebp
+  802a4b:	83 ec 20             	sub    $0x20,%esp
+  802a4e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a51:	52                   	push   %edx
+  802a52:	50                   	push   %eax
+  802a53:	e8 da f3 ff ff       	call   801e32 <fd_lookup>
+  802a58:	83 c4 10             	add    $0x10,%esp
+  802a5b:	85 c0                	test   %eax,%eax
+  802a5d:	78 10                	js     802a6f <fd2sockid+0x27>
+  802a5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a62:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802a68:	39 08                	cmp    %ecx,(%eax)
+  802a6a:	75 05                	jne    802a71 <fd2sockid+0x29>
+  802a6c:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+  802a71:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a76:	eb f7                	jmp    802a6f <fd2sockid+0x27>
+
+00802a78 <alloc_sockfd>:
+  802a78:	55                   	push   %ebp
+  802a79:	89 e5                	mov    %esp,%ebp
+  802a7b:	56                   	push   %esi
+  802a7c:	53                   	push   %ebx
+  802a7d:	83 ec 1c             	sub    $0x1c,%esp
+  802a80:	89 c6                	mov    %eax,%esi
+  802a82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a85:	50                   	push   %eax
+  802a86:	e8 57 f3 ff ff       	call   801de2 <fd_alloc>
+  802a8b:	89 c3                	mov    %eax,%ebx
+  802a8d:	83 c4 10             	add    $0x10,%esp
+  802a90:	85 c0                	test   %eax,%eax
+  802a92:	78 43                	js     802ad7 <alloc_sockfd+0x5f>
+  802a94:	83 ec 04             	sub    $0x4,%esp
+  802a97:	68 07 04 00 00       	push   $0x407
+  802a9c:	ff 75 f4             	push   -0xc(%ebp)
+  802a9f:	6a 00                	push   $0x0
+  802aa1:	e8 76 e5 ff ff       	call   80101c <sys_page_alloc>
+  802aa6:	89 c3                	mov    %eax,%ebx
+  802aa8:	83 c4 10             	add    $0x10,%esp
+  802aab:	85 c0                	test   %eax,%eax
+  802aad:	78 28                	js     802ad7 <alloc_sockfd+0x5f>
+  802aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ab2:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802ab8:	89 10                	mov    %edx,(%eax)
+  802aba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802abd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802ac4:	89 70 0c             	mov    %esi,0xc(%eax)
+  802ac7:	83 ec 0c             	sub    $0xc,%esp
+  802aca:	50                   	push   %eax
+  802acb:	e8 eb f2 ff ff       	call   801dbb <fd2num>
+  802ad0:	89 c3                	mov    %eax,%ebx
+  802ad2:	83 c4 10             	add    $0x10,%esp
+  802ad5:	eb 0c                	jmp    802ae3 <alloc_sockfd+0x6b>
+  802ad7:	83 ec 0c             	sub    $0xc,%esp
+  802ada:	56                   	push   %esi
+  802adb:	e8 d7 01 00 00       	call   802cb7 <nsipc_close>
+  802ae0:	83 c4 10             	add    $0x10,%esp
+  802ae3:	89 d8                	mov    %ebx,%eax
+  802ae5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae8:	5b                   	pop    %ebx
+  802ae9:	5e                   	pop    %esi
+  802aea:	5d                   	pop    %ebp
+  802aeb:	c3                   	ret
+
+00802aec <accept>:
+  802aec:	55                   	push   %ebp
+  802aed:	89 e5                	mov    %esp,%ebp
+  802aef:	83 ec 08             	sub    $0x8,%esp
+  802af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af5:	e8 4e ff ff ff       	call   802a48 <fd2sockid>
+  802afa:	85 c0                	test   %eax,%eax
+  802afc:	78 1b                	js     802b19 <accept+0x2d>
+  802afe:	83 ec 04             	sub    $0x4,%esp
+  802b01:	ff 75 10             	push   0x10(%ebp)
+  802b04:	ff 75 0c             	push   0xc(%ebp)
+  802b07:	50                   	push   %eax
+  802b08:	e8 07 01 00 00       	call   802c14 <nsipc_accept>
+  802b0d:	83 c4 10             	add    $0x10,%esp
+  802b10:	85 c0                	test   %eax,%eax
+  802b12:	78 05                	js     802b19 <accept+0x2d>
+  802b14:	e8 5f ff ff ff       	call   802a78 <alloc_sockfd>
+  802b19:	c9                   	leave
+  802b1a:	c3                   	ret
+
+00802b1b <bind>:
+  802b1b:	55                   	push   %ebp
+  802b1c:	89 e5                	mov    %esp,%ebp
+  802b1e:	83 ec 08             	sub    $0x8,%esp
+  802b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b24:	e8 1f ff ff ff       	call   802a48 <fd2sockid>
+  802b29:	85 c0                	test   %eax,%eax
+  802b2b:	78 12                	js     802b3f <bind+0x24>
+  802b2d:	83 ec 04             	sub    $0x4,%esp
+  802b30:	ff 75 10             	push   0x10(%ebp)
+  802b33:	ff 75 0c             	push   0xc(%ebp)
+  802b36:	50                   	push   %eax
+  802b37:	e8 24 01 00 00       	call   802c60 <nsipc_bind>
+  802b3c:	83 c4 10             	add    $0x10,%esp
+  802b3f:	c9                   	leave
+  802b40:	c3                   	ret
+
+00802b41 <shutdown>:
+  802b41:	55                   	push   %ebp
+  802b42:	89 e5                	mov    %esp,%ebp
+  802b44:	83 ec 08             	sub    $0x8,%esp
+  802b47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4a:	e8 f9 fe ff ff       	call   802a48 <fd2sockid>
+  802b4f:	85 c0                	test   %eax,%eax
+  802b51:	78 0f                	js     802b62 <shutdown+0x21>
+  802b53:	83 ec 08             	sub    $0x8,%esp
+  802b56:	ff 75 0c             	push   0xc(%ebp)
+  802b59:	50                   	push   %eax
+  802b5a:	e8 36 01 00 00       	call   802c95 <nsipc_shutdown>
+  802b5f:	83 c4 10             	add    $0x10,%esp
+  802b62:	c9                   	leave
+  802b63:	c3                   	ret
+
+00802b64 <connect>:
+  802b64:	55                   	push   %ebp
+  802b65:	89 e5                	mov    %esp,%ebp
+  802b67:	83 ec 08             	sub    $0x8,%esp
+  802b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6d:	e8 d6 fe ff ff       	call   802a48 <fd2sockid>
+  802b72:	85 c0                	test   %eax,%eax
+  802b74:	78 12                	js     802b88 <connect+0x24>
+  802b76:	83 ec 04             	sub    $0x4,%esp
+  802b79:	ff 75 10             	push   0x10(%ebp)
+  802b7c:	ff 75 0c             	push   0xc(%ebp)
+  802b7f:	50                   	push   %eax
+  802b80:	e8 4c 01 00 00       	call   802cd1 <nsipc_connect>
+  802b85:	83 c4 10             	add    $0x10,%esp
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+00802b8a <listen>:
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	83 ec 08             	sub    $0x8,%esp
+  802b90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b93:	e8 b0 fe ff ff       	call   802a48 <fd2sockid>
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	78 0f                	js     802bab <listen+0x21>
+  802b9c:	83 ec 08             	sub    $0x8,%esp
+  802b9f:	ff 75 0c             	push   0xc(%ebp)
+  802ba2:	50                   	push   %eax
+  802ba3:	e8 5e 01 00 00       	call   802d06 <nsipc_listen>
+  802ba8:	83 c4 10             	add    $0x10,%esp
+  802bab:	c9                   	leave
+  802bac:	c3                   	ret
+
+00802bad <socket>:
+  802bad:	55                   	push   %ebp
+  802bae:	89 e5                	mov    %esp,%ebp
+  802bb0:	83 ec 0c             	sub    $0xc,%esp
+  802bb3:	ff 75 10             	push   0x10(%ebp)
+  802bb6:	ff 75 0c             	push   0xc(%ebp)
+  802bb9:	ff 75 08             	push   0x8(%ebp)
+  802bbc:	e8 34 02 00 00       	call   802df5 <nsipc_socket>
+  802bc1:	83 c4 10             	add    $0x10,%esp
+  802bc4:	85 c0                	test   %eax,%eax
+  802bc6:	78 05                	js     802bcd <socket+0x20>
+  802bc8:	e8 ab fe ff ff       	call   802a78 <alloc_sockfd>
+  802bcd:	c9                   	leave
+  802bce:	c3                   	ret
+
+00802bcf <nsipc>:
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	53                   	push   %ebx
+  802bd3:	83 ec 04             	sub    $0x4,%esp
+  802bd6:	89 c3                	mov    %eax,%ebx
+  802bd8:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  802bdf:	74 1f                	je     802c00 <nsipc+0x31>
+  802be1:	83 ec 08             	sub    $0x8,%esp
+  802be4:	6a 00                	push   $0x0
+  802be6:	6a 00                	push   $0x0
+  802be8:	6a 07                	push   $0x7
+  802bea:	68 00 80 80 00       	push   $0x808000
+  802bef:	53                   	push   %ebx
+  802bf0:	ff 35 10 60 80 00    	push   0x806010
+  802bf6:	e8 dc 0a 00 00       	call   8036d7 <ipc_call>
+  802bfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bfe:	c9                   	leave
+  802bff:	c3                   	ret
+  802c00:	83 ec 0c             	sub    $0xc,%esp
+  802c03:	6a 03                	push   $0x3
+  802c05:	e8 68 0c 00 00       	call   803872 <ipc_find_env>
+  802c0a:	a3 10 60 80 00       	mov    %eax,0x806010
+  802c0f:	83 c4 10             	add    $0x10,%esp
+  802c12:	eb cd                	jmp    802be1 <nsipc+0x12>
+
+00802c14 <nsipc_accept>:
+  802c14:	55                   	push   %ebp
+  802c15:	89 e5                	mov    %esp,%ebp
+  802c17:	53                   	push   %ebx
+  802c18:	83 ec 04             	sub    $0x4,%esp
+  802c1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1e:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c23:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c28:	e8 a2 ff ff ff       	call   802bcf <nsipc>
+  802c2d:	89 c3                	mov    %eax,%ebx
+  802c2f:	85 c0                	test   %eax,%eax
+  802c31:	79 07                	jns    802c3a <nsipc_accept+0x26>
+  802c33:	89 d8                	mov    %ebx,%eax
+  802c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c38:	c9                   	leave
+  802c39:	c3                   	ret
+  802c3a:	83 ec 04             	sub    $0x4,%esp
+  802c3d:	ff 35 10 80 80 00    	push   0x808010
+  802c43:	68 00 80 80 00       	push   $0x808000
+  802c48:	ff 75 0c             	push   0xc(%ebp)
+  802c4b:	e8 1c e1 ff ff       	call   800d6c <memmove>
+  802c50:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802c56:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c59:	89 10                	mov    %edx,(%eax)
+  802c5b:	83 c4 10             	add    $0x10,%esp
+  802c5e:	eb d3                	jmp    802c33 <nsipc_accept+0x1f>
+
+00802c60 <nsipc_bind>:
+  802c60:	55                   	push   %ebp
+  802c61:	89 e5                	mov    %esp,%ebp
+  802c63:	53                   	push   %ebx
+  802c64:	83 ec 08             	sub    $0x8,%esp
+  802c67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6d:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c72:	53                   	push   %ebx
+  802c73:	ff 75 0c             	push   0xc(%ebp)
+  802c76:	68 04 80 80 00       	push   $0x808004
+  802c7b:	e8 ec e0 ff ff       	call   800d6c <memmove>
+  802c80:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802c86:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c8b:	e8 3f ff ff ff       	call   802bcf <nsipc>
+  802c90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c93:	c9                   	leave
+  802c94:	c3                   	ret
+
+00802c95 <nsipc_shutdown>:
+  802c95:	55                   	push   %ebp
+  802c96:	89 e5                	mov    %esp,%ebp
+  802c98:	83 ec 08             	sub    $0x8,%esp
+  802c9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9e:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ca3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ca6:	a3 04 80 80 00       	mov    %eax,0x808004
+  802cab:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cb0:	e8 1a ff ff ff       	call   802bcf <nsipc>
+  802cb5:	c9                   	leave
+  802cb6:	c3                   	ret
+
+00802cb7 <nsipc_close>:
+  802cb7:	55                   	push   %ebp
+  802cb8:	89 e5                	mov    %esp,%ebp
+  802cba:	83 ec 08             	sub    $0x8,%esp
+  802cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc0:	a3 00 80 80 00       	mov    %eax,0x808000
+  802cc5:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cca:	e8 00 ff ff ff       	call   802bcf <nsipc>
+  802ccf:	c9                   	leave
+  802cd0:	c3                   	ret
+
+00802cd1 <nsipc_connect>:
+  802cd1:	55                   	push   %ebp
+  802cd2:	89 e5                	mov    %esp,%ebp
+  802cd4:	53                   	push   %ebx
+  802cd5:	83 ec 08             	sub    $0x8,%esp
+  802cd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cde:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ce3:	53                   	push   %ebx
+  802ce4:	ff 75 0c             	push   0xc(%ebp)
+  802ce7:	68 04 80 80 00       	push   $0x808004
+  802cec:	e8 7b e0 ff ff       	call   800d6c <memmove>
+  802cf1:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802cf7:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cfc:	e8 ce fe ff ff       	call   802bcf <nsipc>
+  802d01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+
+00802d06 <nsipc_listen>:
+  802d06:	55                   	push   %ebp
+  802d07:	89 e5                	mov    %esp,%ebp
+  802d09:	83 ec 08             	sub    $0x8,%esp
+  802d0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d0f:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d17:	a3 04 80 80 00       	mov    %eax,0x808004
+  802d1c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d21:	e8 a9 fe ff ff       	call   802bcf <nsipc>
+  802d26:	c9                   	leave
+  802d27:	c3                   	ret
+
+00802d28 <nsipc_recv>:
+  802d28:	55                   	push   %ebp
+  802d29:	89 e5                	mov    %esp,%ebp
+  802d2b:	56                   	push   %esi
+  802d2c:	53                   	push   %ebx
+  802d2d:	8b 75 10             	mov    0x10(%ebp),%esi
+  802d30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d33:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d38:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802d3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d41:	a3 08 80 80 00       	mov    %eax,0x808008
+  802d46:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d4b:	e8 7f fe ff ff       	call   802bcf <nsipc>
+  802d50:	89 c3                	mov    %eax,%ebx
+  802d52:	85 c0                	test   %eax,%eax
+  802d54:	78 22                	js     802d78 <nsipc_recv+0x50>
+  802d56:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d5b:	39 c6                	cmp    %eax,%esi
+  802d5d:	0f 4e c6             	cmovle %esi,%eax
+  802d60:	39 c3                	cmp    %eax,%ebx
+  802d62:	7f 1d                	jg     802d81 <nsipc_recv+0x59>
+  802d64:	83 ec 04             	sub    $0x4,%esp
+  802d67:	53                   	push   %ebx
+  802d68:	68 00 80 80 00       	push   $0x808000
+  802d6d:	ff 75 0c             	push   0xc(%ebp)
+  802d70:	e8 f7 df ff ff       	call   800d6c <memmove>
+  802d75:	83 c4 10             	add    $0x10,%esp
+  802d78:	89 d8                	mov    %ebx,%eax
+  802d7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d7d:	5b                   	pop    %ebx
+  802d7e:	5e                   	pop    %esi
+  802d7f:	5d                   	pop    %ebp
+  802d80:	c3                   	ret
+  802d81:	68 dc 41 80 00       	push   $0x8041dc
+  802d86:	68 f1 41 80 00       	push   $0x8041f1
+  802d8b:	6a 60                	push   $0x60
+  802d8d:	68 06 42 80 00       	push   $0x804206
+  802d92:	e8 53 d6 ff ff       	call   8003ea <_panic>
+
+00802d97 <nsipc_send>:
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	53                   	push   %ebx
+  802d9b:	83 ec 04             	sub    $0x4,%esp
+  802d9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802da1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da4:	a3 00 80 80 00       	mov    %eax,0x808000
+  802da9:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802daf:	7f 2e                	jg     802ddf <nsipc_send+0x48>
+  802db1:	83 ec 04             	sub    $0x4,%esp
+  802db4:	53                   	push   %ebx
+  802db5:	ff 75 0c             	push   0xc(%ebp)
+  802db8:	68 0c 80 80 00       	push   $0x80800c
+  802dbd:	e8 aa df ff ff       	call   800d6c <memmove>
+  802dc2:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802dc8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dcb:	a3 08 80 80 00       	mov    %eax,0x808008
+  802dd0:	b8 08 00 00 00       	mov    $0x8,%eax
+  802dd5:	e8 f5 fd ff ff       	call   802bcf <nsipc>
+  802dda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ddd:	c9                   	leave
+  802dde:	c3                   	ret
+  802ddf:	68 12 42 80 00       	push   $0x804212
+  802de4:	68 f1 41 80 00       	push   $0x8041f1
+  802de9:	6a 6b                	push   $0x6b
+  802deb:	68 06 42 80 00       	push   $0x804206
+  802df0:	e8 f5 d5 ff ff       	call   8003ea <_panic>
+
+00802df5 <nsipc_socket>:
+  802df5:	55                   	push   %ebp
+  802df6:	89 e5                	mov    %esp,%ebp
+  802df8:	83 ec 08             	sub    $0x8,%esp
+  802dfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dfe:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e06:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e0b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e0e:	a3 08 80 80 00       	mov    %eax,0x808008
+  802e13:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e18:	e8 b2 fd ff ff       	call   802bcf <nsipc>
+  802e1d:	c9                   	leave
+  802e1e:	c3                   	ret
+
+00802e1f <devpipe_stat>:
+  802e1f:	55                   	push   %ebp
+  802e20:	89 e5                	mov    %esp,%ebp
+  802e22:	56                   	push   %esi
+  802e23:	53                   	push   %ebx
+  802e24:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e27:	83 ec 0c             	sub    $0xc,%esp
+  802e2a:	ff 75 08             	push   0x8(%ebp)
+  802e2d:	e8 99 ef ff ff       	call   801dcb <fd2data>
+  802e32:	89 c6                	mov    %eax,%esi
+  802e34:	83 c4 08             	add    $0x8,%esp
+  802e37:	68 1e 42 80 00       	push   $0x80421e
+  802e3c:	53                   	push   %ebx
+  802e3d:	e8 7a dd ff ff       	call   800bbc <strcpy>
+  802e42:	8b 46 04             	mov    0x4(%esi),%eax
+  802e45:	2b 06                	sub    (%esi),%eax
+  802e47:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802e4d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e54:	00 00 00 
+  802e57:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802e5e:	50 80 00 
+  802e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e69:	5b                   	pop    %ebx
+  802e6a:	5e                   	pop    %esi
+  802e6b:	5d                   	pop    %ebp
+  802e6c:	c3                   	ret
+
+00802e6d <devpipe_close>:
+  802e6d:	55                   	push   %ebp
+  802e6e:	89 e5                	mov    %esp,%ebp
+  802e70:	53                   	push   %ebx
+  802e71:	83 ec 0c             	sub    $0xc,%esp
+  802e74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802e77:	53                   	push   %ebx
+  802e78:	6a 00                	push   $0x0
+  802e7a:	e8 6f e2 ff ff       	call   8010ee <sys_page_unmap>
+  802e7f:	89 1c 24             	mov    %ebx,(%esp)
+  802e82:	e8 44 ef ff ff       	call   801dcb <fd2data>
+  802e87:	83 c4 08             	add    $0x8,%esp
+  802e8a:	50                   	push   %eax
+  802e8b:	6a 00                	push   $0x0
+  802e8d:	e8 5c e2 ff ff       	call   8010ee <sys_page_unmap>
+  802e92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e95:	c9                   	leave
+  802e96:	c3                   	ret
+
+00802e97 <_pipeisclosed>:
+  802e97:	55                   	push   %ebp
+  802e98:	89 e5                	mov    %esp,%ebp
+  802e9a:	57                   	push   %edi
+  802e9b:	56                   	push   %esi
+  802e9c:	53                   	push   %ebx
+  802e9d:	83 ec 1c             	sub    $0x1c,%esp
+  802ea0:	89 c7                	mov    %eax,%edi
+  802ea2:	89 d6                	mov    %edx,%esi
+  802ea4:	a1 20 64 80 00       	mov    0x806420,%eax
+  802ea9:	8b 58 58             	mov    0x58(%eax),%ebx
+  802eac:	83 ec 0c             	sub    $0xc,%esp
+  802eaf:	57                   	push   %edi
+  802eb0:	e8 d7 09 00 00       	call   80388c <pageref>
+  802eb5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802eb8:	89 34 24             	mov    %esi,(%esp)
+  802ebb:	e8 cc 09 00 00       	call   80388c <pageref>
+  802ec0:	8b 15 20 64 80 00    	mov    0x806420,%edx
+  802ec6:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802ec9:	83 c4 10             	add    $0x10,%esp
+  802ecc:	39 cb                	cmp    %ecx,%ebx
+  802ece:	74 1b                	je     802eeb <_pipeisclosed+0x54>
+  802ed0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ed3:	75 cf                	jne    802ea4 <_pipeisclosed+0xd>
+  802ed5:	8b 42 58             	mov    0x58(%edx),%eax
+  802ed8:	6a 01                	push   $0x1
+  802eda:	50                   	push   %eax
+  802edb:	53                   	push   %ebx
+  802edc:	68 25 42 80 00       	push   $0x804225
+  802ee1:	e8 df d5 ff ff       	call   8004c5 <cprintf>
+  802ee6:	83 c4 10             	add    $0x10,%esp
+  802ee9:	eb b9                	jmp    802ea4 <_pipeisclosed+0xd>
+  802eeb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802eee:	0f 94 c0             	sete   %al
+  802ef1:	0f b6 c0             	movzbl %al,%eax
+  802ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef7:	5b                   	pop    %ebx
+  802ef8:	5e                   	pop    %esi
+  802ef9:	5f                   	pop    %edi
+  802efa:	5d                   	pop    %ebp
+  802efb:	c3                   	ret
+
+00802efc <devpipe_write>:
+  802efc:	55                   	push   %ebp
+  802efd:	89 e5                	mov    %esp,%ebp
+  802eff:	57                   	push   %edi
+  802f00:	56                   	push   %esi
+  802f01:	53                   	push   %ebx
+  802f02:	83 ec 28             	sub    $0x28,%esp
+  802f05:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f08:	56                   	push   %esi
+  802f09:	e8 bd ee ff ff       	call   801dcb <fd2data>
+  802f0e:	89 c3                	mov    %eax,%ebx
+  802f10:	83 c4 10             	add    $0x10,%esp
+  802f13:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f18:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f1c:	74 5c                	je     802f7a <devpipe_write+0x7e>
+  802f1e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f21:	8b 0b                	mov    (%ebx),%ecx
+  802f23:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f26:	39 d0                	cmp    %edx,%eax
+  802f28:	72 1e                	jb     802f48 <devpipe_write+0x4c>
+  802f2a:	89 da                	mov    %ebx,%edx
+  802f2c:	89 f0                	mov    %esi,%eax
+  802f2e:	e8 64 ff ff ff       	call   802e97 <_pipeisclosed>
+  802f33:	85 c0                	test   %eax,%eax
+  802f35:	75 48                	jne    802f7f <devpipe_write+0x83>
+  802f37:	e8 95 e0 ff ff       	call   800fd1 <sys_yield>
+  802f3c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f3f:	8b 0b                	mov    (%ebx),%ecx
+  802f41:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f44:	39 d0                	cmp    %edx,%eax
+  802f46:	73 e2                	jae    802f2a <devpipe_write+0x2e>
+  802f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f4b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f4f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f52:	89 c2                	mov    %eax,%edx
+  802f54:	c1 fa 1f             	sar    $0x1f,%edx
+  802f57:	89 d1                	mov    %edx,%ecx
+  802f59:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f5c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f5f:	83 e2 1f             	and    $0x1f,%edx
+  802f62:	29 ca                	sub    %ecx,%edx
+  802f64:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f68:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802f6c:	83 c0 01             	add    $0x1,%eax
+  802f6f:	89 43 04             	mov    %eax,0x4(%ebx)
+  802f72:	83 c7 01             	add    $0x1,%edi
+  802f75:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802f78:	75 a4                	jne    802f1e <devpipe_write+0x22>
+  802f7a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f7d:	eb 05                	jmp    802f84 <devpipe_write+0x88>
+  802f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f87:	5b                   	pop    %ebx
+  802f88:	5e                   	pop    %esi
+  802f89:	5f                   	pop    %edi
+  802f8a:	5d                   	pop    %ebp
+  802f8b:	c3                   	ret
+
+00802f8c <devpipe_read>:
+  802f8c:	55                   	push   %ebp
+  802f8d:	89 e5                	mov    %esp,%ebp
+  802f8f:	57                   	push   %edi
+  802f90:	56                   	push   %esi
+  802f91:	53                   	push   %ebx
+  802f92:	83 ec 18             	sub    $0x18,%esp
+  802f95:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f98:	56                   	push   %esi
+  802f99:	e8 2d ee ff ff       	call   801dcb <fd2data>
+  802f9e:	89 c3                	mov    %eax,%ebx
+  802fa0:	83 c4 10             	add    $0x10,%esp
+  802fa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fac:	74 45                	je     802ff3 <devpipe_read+0x67>
+  802fae:	8b 03                	mov    (%ebx),%eax
+  802fb0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fb3:	75 1d                	jne    802fd2 <devpipe_read+0x46>
+  802fb5:	85 ff                	test   %edi,%edi
+  802fb7:	75 3f                	jne    802ff8 <devpipe_read+0x6c>
+  802fb9:	89 da                	mov    %ebx,%edx
+  802fbb:	89 f0                	mov    %esi,%eax
+  802fbd:	e8 d5 fe ff ff       	call   802e97 <_pipeisclosed>
+  802fc2:	85 c0                	test   %eax,%eax
+  802fc4:	75 3c                	jne    803002 <devpipe_read+0x76>
+  802fc6:	e8 06 e0 ff ff       	call   800fd1 <sys_yield>
+  802fcb:	8b 03                	mov    (%ebx),%eax
+  802fcd:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fd0:	74 e7                	je     802fb9 <devpipe_read+0x2d>
+  802fd2:	99                   	cltd
+  802fd3:	c1 ea 1b             	shr    $0x1b,%edx
+  802fd6:	01 d0                	add    %edx,%eax
+  802fd8:	83 e0 1f             	and    $0x1f,%eax
+  802fdb:	29 d0                	sub    %edx,%eax
+  802fdd:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fe5:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802fe8:	83 03 01             	addl   $0x1,(%ebx)
+  802feb:	83 c7 01             	add    $0x1,%edi
+  802fee:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802ff1:	75 bb                	jne    802fae <devpipe_read+0x22>
+  802ff3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ff6:	eb 02                	jmp    802ffa <devpipe_read+0x6e>
+  802ff8:	89 f8                	mov    %edi,%eax
+  802ffa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ffd:	5b                   	pop    %ebx
+  802ffe:	5e                   	pop    %esi
+  802fff:	5f                   	pop    %edi
+  803000:	5d                   	pop    %ebp
+  803001:	c3                   	ret
+  803002:	b8 00 00 00 00       	mov    $0x0,%eax
+  803007:	eb f1                	jmp    802ffa <devpipe_read+0x6e>
+
+00803009 <pipe>:
+  803009:	55                   	push   %ebp
+  80300a:	89 e5                	mov    %esp,%ebp
+  80300c:	56                   	push   %esi
+  80300d:	53                   	push   %ebx
+  80300e:	83 ec 1c             	sub    $0x1c,%esp
+  803011:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803014:	50                   	push   %eax
+  803015:	e8 c8 ed ff ff       	call   801de2 <fd_alloc>
+  80301a:	89 c3                	mov    %eax,%ebx
+  80301c:	83 c4 10             	add    $0x10,%esp
+  80301f:	85 c0                	test   %eax,%eax
+  803021:	0f 88 23 01 00 00    	js     80314a <pipe+0x141>
+  803027:	83 ec 04             	sub    $0x4,%esp
+  80302a:	68 07 04 00 00       	push   $0x407
+  80302f:	ff 75 f4             	push   -0xc(%ebp)
+  803032:	6a 00                	push   $0x0
+  803034:	e8 e3 df ff ff       	call   80101c <sys_page_alloc>
+  803039:	89 c3                	mov    %eax,%ebx
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	85 c0                	test   %eax,%eax
+  803040:	0f 88 04 01 00 00    	js     80314a <pipe+0x141>
+  803046:	83 ec 0c             	sub    $0xc,%esp
+  803049:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80304c:	50                   	push   %eax
+  80304d:	e8 90 ed ff ff       	call   801de2 <fd_alloc>
+  803052:	89 c3                	mov    %eax,%ebx
+  803054:	83 c4 10             	add    $0x10,%esp
+  803057:	85 c0                	test   %eax,%eax
+  803059:	0f 88 db 00 00 00    	js     80313a <pipe+0x131>
+  80305f:	83 ec 04             	sub    $0x4,%esp
+  803062:	68 07 04 00 00       	push   $0x407
+  803067:	ff 75 f0             	push   -0x10(%ebp)
+  80306a:	6a 00                	push   $0x0
+  80306c:	e8 ab df ff ff       	call   80101c <sys_page_alloc>
+  803071:	89 c3                	mov    %eax,%ebx
+  803073:	83 c4 10             	add    $0x10,%esp
+  803076:	85 c0                	test   %eax,%eax
+  803078:	0f 88 bc 00 00 00    	js     80313a <pipe+0x131>
+  80307e:	83 ec 0c             	sub    $0xc,%esp
+  803081:	ff 75 f4             	push   -0xc(%ebp)
+  803084:	e8 42 ed ff ff       	call   801dcb <fd2data>
+  803089:	89 c6                	mov    %eax,%esi
+  80308b:	83 c4 0c             	add    $0xc,%esp
+  80308e:	68 07 04 00 00       	push   $0x407
+  803093:	50                   	push   %eax
+  803094:	6a 00                	push   $0x0
+  803096:	e8 81 df ff ff       	call   80101c <sys_page_alloc>
+  80309b:	89 c3                	mov    %eax,%ebx
+  80309d:	83 c4 10             	add    $0x10,%esp
+  8030a0:	85 c0                	test   %eax,%eax
+  8030a2:	0f 88 82 00 00 00    	js     80312a <pipe+0x121>
+  8030a8:	83 ec 0c             	sub    $0xc,%esp
+  8030ab:	ff 75 f0             	push   -0x10(%ebp)
+  8030ae:	e8 18 ed ff ff       	call   801dcb <fd2data>
+  8030b3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030ba:	50                   	push   %eax
+  8030bb:	6a 00                	push   $0x0
+  8030bd:	56                   	push   %esi
+  8030be:	6a 00                	push   $0x0
+  8030c0:	e8 9a df ff ff       	call   80105f <sys_page_map>
+  8030c5:	89 c3                	mov    %eax,%ebx
+  8030c7:	83 c4 20             	add    $0x20,%esp
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	78 4e                	js     80311c <pipe+0x113>
+  8030ce:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  8030d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030d6:	89 02                	mov    %eax,(%edx)
+  8030d8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030db:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8030e2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030e5:	89 02                	mov    %eax,(%edx)
+  8030e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030ea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8030f1:	83 ec 0c             	sub    $0xc,%esp
+  8030f4:	ff 75 f4             	push   -0xc(%ebp)
+  8030f7:	e8 bf ec ff ff       	call   801dbb <fd2num>
+  8030fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030ff:	89 01                	mov    %eax,(%ecx)
+  803101:	83 c4 04             	add    $0x4,%esp
+  803104:	ff 75 f0             	push   -0x10(%ebp)
+  803107:	e8 af ec ff ff       	call   801dbb <fd2num>
+  80310c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80310f:	89 41 04             	mov    %eax,0x4(%ecx)
+  803112:	83 c4 10             	add    $0x10,%esp
+  803115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80311a:	eb 2e                	jmp    80314a <pipe+0x141>
+  80311c:	83 ec 08             	sub    $0x8,%esp
+  80311f:	56                   	push   %esi
+  803120:	6a 00                	push   $0x0
+  803122:	e8 c7 df ff ff       	call   8010ee <sys_page_unmap>
+  803127:	83 c4 10             	add    $0x10,%esp
+  80312a:	83 ec 08             	sub    $0x8,%esp
+  80312d:	ff 75 f0             	push   -0x10(%ebp)
+  803130:	6a 00                	push   $0x0
+  803132:	e8 b7 df ff ff       	call   8010ee <sys_page_unmap>
+  803137:	83 c4 10             	add    $0x10,%esp
+  80313a:	83 ec 08             	sub    $0x8,%esp
+  80313d:	ff 75 f4             	push   -0xc(%ebp)
+  803140:	6a 00                	push   $0x0
+  803142:	e8 a7 df ff ff       	call   8010ee <sys_page_unmap>
+  803147:	83 c4 10             	add    $0x10,%esp
+  80314a:	89 d8                	mov    %ebx,%eax
+  80314c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80314f:	5b                   	pop    %ebx
+  803150:	5e                   	pop    %esi
+  803151:	5d                   	pop    %ebp
+  803152:	c3                   	ret
+
+00803153 <pipeisclosed>:
+  803153:	55                   	push   %ebp
+  803154:	89 e5                	mov    %esp,%ebp
+  803156:	83 ec 20             	sub    $0x20,%esp
+  803159:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80315c:	50                   	push   %eax
+  80315d:	ff 75 08             	push   0x8(%ebp)
+  803160:	e8 cd ec ff ff       	call   801e32 <fd_lookup>
+  803165:	83 c4 10             	add    $0x10,%esp
+  803168:	85 c0                	test   %eax,%eax
+  80316a:	78 18                	js     803184 <pipeisclosed+0x31>
+  80316c:	83 ec 0c             	sub    $0xc,%esp
+  80316f:	ff 75 f4             	push   -0xc(%ebp)
+  803172:	e8 54 ec ff ff       	call   801dcb <fd2data>
+  803177:	89 c2                	mov    %eax,%edx
+  803179:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80317c:	e8 16 fd ff ff       	call   802e97 <_pipeisclosed>
+  803181:	83 c4 10             	add    $0x10,%esp
+  803184:	c9                   	leave
+  803185:	c3                   	ret
+
+00803186 <wait>:
+  803186:	55                   	push   %ebp
+  803187:	89 e5                	mov    %esp,%ebp
+  803189:	56                   	push   %esi
+  80318a:	53                   	push   %ebx
+  80318b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80318e:	85 f6                	test   %esi,%esi
+  803190:	74 40                	je     8031d2 <wait+0x4c>
+  803192:	89 f3                	mov    %esi,%ebx
+  803194:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80319a:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  8031a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8031a5:	8b 40 48             	mov    0x48(%eax),%eax
+  8031a8:	39 c6                	cmp    %eax,%esi
+  8031aa:	75 1f                	jne    8031cb <wait+0x45>
+  8031ac:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  8031b2:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8031b8:	8b 43 54             	mov    0x54(%ebx),%eax
+  8031bb:	85 c0                	test   %eax,%eax
+  8031bd:	74 0c                	je     8031cb <wait+0x45>
+  8031bf:	e8 0d de ff ff       	call   800fd1 <sys_yield>
+  8031c4:	8b 43 48             	mov    0x48(%ebx),%eax
+  8031c7:	39 f0                	cmp    %esi,%eax
+  8031c9:	74 ed                	je     8031b8 <wait+0x32>
+  8031cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031ce:	5b                   	pop    %ebx
+  8031cf:	5e                   	pop    %esi
+  8031d0:	5d                   	pop    %ebp
+  8031d1:	c3                   	ret
+  8031d2:	68 3d 42 80 00       	push   $0x80423d
+  8031d7:	68 f1 41 80 00       	push   $0x8041f1
+  8031dc:	6a 09                	push   $0x9
+  8031de:	68 48 42 80 00       	push   $0x804248
+  8031e3:	e8 02 d2 ff ff       	call   8003ea <_panic>
+
+008031e8 <ipcring_init>:
+  8031e8:	55                   	push   %ebp
+  8031e9:	89 e5                	mov    %esp,%ebp
+  8031eb:	53                   	push   %ebx
+  8031ec:	83 ec 08             	sub    $0x8,%esp
+  8031ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8031f2:	6a 60                	push   $0x60
+  8031f4:	6a 00                	push   $0x0
+  8031f6:	53                   	push   %ebx
+  8031f7:	e8 3b db ff ff       	call   800d37 <memset>
+  8031fc:	a1 20 64 80 00       	mov    0x806420,%eax
+  803201:	8b 40 48             	mov    0x48(%eax),%eax
+  803204:	89 03                	mov    %eax,(%ebx)
+  803206:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803209:	89 43 04             	mov    %eax,0x4(%ebx)
+  80320c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80320f:	89 43 08             	mov    %eax,0x8(%ebx)
+  803212:	8b 45 14             	mov    0x14(%ebp),%eax
+  803215:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803218:	83 c4 10             	add    $0x10,%esp
+  80321b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+
+00803220 <ipcring_req_slot>:
+  803220:	55                   	push   %ebp
+  803221:	89 e5                	mov    %esp,%ebp
+  803223:	8b 45 08             	mov    0x8(%ebp),%eax
+  803226:	8b 50 10             	mov    0x10(%eax),%edx
+  803229:	8b 48 18             	mov    0x18(%eax),%ecx
+  80322c:	29 ca                	sub    %ecx,%edx
+  80322e:	83 fa 07             	cmp    $0x7,%edx
+  803231:	77 0c                	ja     80323f <ipcring_req_slot+0x1f>
+  803233:	8b 50 10             	mov    0x10(%eax),%edx
+  803236:	83 e2 07             	and    $0x7,%edx
+  803239:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80323d:	5d                   	pop    %ebp
+  80323e:	c3                   	ret
+  80323f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803244:	eb f7                	jmp    80323d <ipcring_req_slot+0x1d>
+
+00803246 <ipcring_req_push>:
+  803246:	55                   	push   %ebp
+  803247:	89 e5                	mov    %esp,%ebp
+  803249:	83 ec 08             	sub    $0x8,%esp
+  80324c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80324f:	8b 42 10             	mov    0x10(%edx),%eax
+  803252:	83 c0 01             	add    $0x1,%eax
+  803255:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325e:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803262:	85 c0                	test   %eax,%eax
+  803264:	75 02                	jne    803268 <ipcring_req_push+0x22>
+  803266:	c9                   	leave
+  803267:	c3                   	ret
+  803268:	6a 00                	push   $0x0
+  80326a:	68 00 00 80 ee       	push   $0xee800000
+  80326f:	ff 72 08             	push   0x8(%edx)
+  803272:	ff 72 04             	push   0x4(%edx)
+  803275:	e8 da e0 ff ff       	call   801354 <sys_ipc_send>
+  80327a:	83 c4 10             	add    $0x10,%esp
+  80327d:	eb e7                	jmp    803266 <ipcring_req_push+0x20>
+
+0080327f <ipcring_rsp_wait>:
+  80327f:	55                   	push   %ebp
+  803280:	89 e5                	mov    %esp,%ebp
+  803282:	53                   	push   %ebx
+  803283:	83 ec 04             	sub    $0x4,%esp
+  803286:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803289:	8b 53 18             	mov    0x18(%ebx),%edx
+  80328c:	8b 43 10             	mov    0x10(%ebx),%eax
+  80328f:	39 c2                	cmp    %eax,%edx
+  803291:	74 3c                	je     8032cf <ipcring_rsp_wait+0x50>
+  803293:	8b 53 14             	mov    0x14(%ebx),%edx
+  803296:	8b 43 18             	mov    0x18(%ebx),%eax
+  803299:	39 c2                	cmp    %eax,%edx
+  80329b:	75 23                	jne    8032c0 <ipcring_rsp_wait+0x41>
+  80329d:	83 ec 08             	sub    $0x8,%esp
+  8032a0:	6a 00                	push   $0x0
+  8032a2:	6a 00                	push   $0x0
+  8032a4:	6a 00                	push   $0x0
+  8032a6:	6a 00                	push   $0x0
+  8032a8:	ff 73 0c             	push   0xc(%ebx)
+  8032ab:	ff 73 04             	push   0x4(%ebx)
+  8032ae:	e8 24 04 00 00       	call   8036d7 <ipc_call>
+  8032b3:	8b 53 14             	mov    0x14(%ebx),%edx
+  8032b6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032b9:	83 c4 20             	add    $0x20,%esp
+  8032bc:	39 c2                	cmp    %eax,%edx
+  8032be:	74 dd                	je     80329d <ipcring_rsp_wait+0x1e>
+  8032c0:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032c3:	83 e0 07             	and    $0x7,%eax
+  8032c6:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8032ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032cd:	c9                   	leave
+  8032ce:	c3                   	ret
+  8032cf:	68 54 42 80 00       	push   $0x804254
+  8032d4:	68 f1 41 80 00       	push   $0x8041f1
+  8032d9:	6a 3b                	push   $0x3b
+  8032db:	68 75 42 80 00       	push   $0x804275
+  8032e0:	e8 05 d1 ff ff       	call   8003ea <_panic>
+
+008032e5 <ipcring_rsp_pop>:
+  8032e5:	55                   	push   %ebp
+  8032e6:	89 e5                	mov    %esp,%ebp
+  8032e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8032eb:	8b 42 18             	mov    0x18(%edx),%eax
+  8032ee:	83 c0 01             	add    $0x1,%eax
+  8032f1:	89 42 18             	mov    %eax,0x18(%edx)
+  8032f4:	5d                   	pop    %ebp
+  8032f5:	c3                   	ret
+
+008032f6 <ipcring_server_init>:
+  8032f6:	55                   	push   %ebp
+  8032f7:	89 e5                	mov    %esp,%ebp
+  8032f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032ff:	89 10                	mov    %edx,(%eax)
+  803301:	8b 55 10             	mov    0x10(%ebp),%edx
+  803304:	89 50 04             	mov    %edx,0x4(%eax)
+  803307:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80330e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803315:	5d                   	pop    %ebp
+  803316:	c3                   	ret
+
+00803317 <ipcring_req_avail>:
+  803317:	55                   	push   %ebp
+  803318:	89 e5                	mov    %esp,%ebp
+  80331a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80331d:	8b 02                	mov    (%edx),%eax
+  80331f:	8b 40 10             	mov    0x10(%eax),%eax
+  803322:	2b 42 08             	sub    0x8(%edx),%eax
+  803325:	ba 08 00 00 00       	mov    $0x8,%edx
+  80332a:	39 d0                	cmp    %edx,%eax
+  80332c:	0f 47 c2             	cmova  %edx,%eax
+  80332f:	5d                   	pop    %ebp
+  803330:	c3                   	ret
+
+00803331 <ipcring_req_peek>:
+  803331:	55                   	push   %ebp
+  803332:	89 e5                	mov    %esp,%ebp
+  803334:	8b 55 08             	mov    0x8(%ebp),%edx
+  803337:	8b 42 08             	mov    0x8(%edx),%eax
+  80333a:	83 e0 07             	and    $0x7,%eax
+  80333d:	8b 12                	mov    (%edx),%edx
+  80333f:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803343:	5d                   	pop    %ebp
+  803344:	c3                   	ret
+
+00803345 <ipcring_rsp_push>:
+  803345:	55                   	push   %ebp
+  803346:	89 e5                	mov    %esp,%ebp
+  803348:	83 ec 08             	sub    $0x8,%esp
+  80334b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80334e:	8b 41 08             	mov    0x8(%ecx),%eax
+  803351:	83 c0 01             	add    $0x1,%eax
+  803354:	89 41 08             	mov    %eax,0x8(%ecx)
+  803357:	8b 11                	mov    (%ecx),%edx
+  803359:	83 c2 14             	add    $0x14,%edx
+  80335c:	f0 87 02             	lock xchg %eax,(%edx)
+  80335f:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803363:	75 02                	jne    803367 <ipcring_rsp_push+0x22>
+  803365:	c9                   	leave
+  803366:	c3                   	ret
+  803367:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80336e:	6a 00                	push   $0x0
+  803370:	68 00 00 80 ee       	push   $0xee800000
+  803375:	6a 00                	push   $0x0
+  803377:	ff 71 04             	push   0x4(%ecx)
+  80337a:	e8 f8 de ff ff       	call   801277 <sys_ipc_try_send>
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	eb e1                	jmp    803365 <ipcring_rsp_push+0x20>
+
+00803384 <ipcring_client_wait>:
+  803384:	55                   	push   %ebp
+  803385:	89 e5                	mov    %esp,%ebp
+  803387:	83 ec 08             	sub    $0x8,%esp
+  80338a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80338d:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803394:	8b 10                	mov    (%eax),%edx
+  803396:	8b 52 18             	mov    0x18(%edx),%edx
+  803399:	3b 50 08             	cmp    0x8(%eax),%edx
+  80339c:	75 02                	jne    8033a0 <ipcring_client_wait+0x1c>
+  80339e:	c9                   	leave
+  80339f:	c3                   	ret
+  8033a0:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8033a7:	6a 00                	push   $0x0
+  8033a9:	68 00 00 80 ee       	push   $0xee800000
+  8033ae:	6a 00                	push   $0x0
+  8033b0:	ff 70 04             	push   0x4(%eax)
+  8033b3:	e8 bf de ff ff       	call   801277 <sys_ipc_try_send>
+  8033b8:	83 c4 10             	add    $0x10,%esp
+  8033bb:	eb e1                	jmp    80339e <ipcring_client_wait+0x1a>
+
+008033bd <ipcring_server_sleep>:
+  8033bd:	55                   	push   %ebp
+  8033be:	89 e5                	mov    %esp,%ebp
+  8033c0:	53                   	push   %ebx
+  8033c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033c4:	8b 01                	mov    (%ecx),%eax
+  8033c6:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8033c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033ce:	f0 87 02             	lock xchg %eax,(%edx)
+  8033d1:	8b 11                	mov    (%ecx),%edx
+  8033d3:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8033d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033db:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8033de:	74 0e                	je     8033ee <ipcring_server_sleep+0x31>
+  8033e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e5:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8033e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033f1:	c9                   	leave
+  8033f2:	c3                   	ret
+
+008033f3 <devcons_close>:
+  8033f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f8:	c3                   	ret
+
+008033f9 <devcons_stat>:
+  8033f9:	55                   	push   %ebp
+  8033fa:	89 e5                	mov    %esp,%ebp
+  8033fc:	83 ec 10             	sub    $0x10,%esp
+  8033ff:	68 83 42 80 00       	push   $0x804283
+  803404:	ff 75 0c             	push   0xc(%ebp)
+  803407:	e8 b0 d7 ff ff       	call   800bbc <strcpy>
+  80340c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803411:	c9                   	leave
+  803412:	c3                   	ret
+
+00803413 <devcons_write>:
+  803413:	55                   	push   %ebp
+  803414:	89 e5                	mov    %esp,%ebp
+  803416:	57                   	push   %edi
+  803417:	56                   	push   %esi
+  803418:	53                   	push   %ebx
+  803419:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80341f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803422:	85 ff                	test   %edi,%edi
+  803424:	74 51                	je     803477 <devcons_write+0x64>
+  803426:	be 00 00 00 00       	mov    $0x0,%esi
+  80342b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803430:	89 fb                	mov    %edi,%ebx
+  803432:	29 c3                	sub    %eax,%ebx
+  803434:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803439:	39 d3                	cmp    %edx,%ebx
+  80343b:	0f 47 da             	cmova  %edx,%ebx
+  80343e:	83 ec 04             	sub    $0x4,%esp
+  803441:	53                   	push   %ebx
+  803442:	03 45 0c             	add    0xc(%ebp),%eax
+  803445:	50                   	push   %eax
+  803446:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80344c:	50                   	push   %eax
+  80344d:	e8 1a d9 ff ff       	call   800d6c <memmove>
+  803452:	83 c4 08             	add    $0x8,%esp
+  803455:	53                   	push   %ebx
+  803456:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80345c:	50                   	push   %eax
+  80345d:	e8 d2 da ff ff       	call   800f34 <sys_cputs>
+  803462:	01 de                	add    %ebx,%esi
+  803464:	89 f0                	mov    %esi,%eax
+  803466:	83 c4 10             	add    $0x10,%esp
+  803469:	39 fe                	cmp    %edi,%esi
+  80346b:	72 c3                	jb     803430 <devcons_write+0x1d>
+  80346d:	89 f0                	mov    %esi,%eax
+  80346f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803472:	5b                   	pop    %ebx
+  803473:	5e                   	pop    %esi
+  803474:	5f                   	pop    %edi
+  803475:	5d                   	pop    %ebp
+  803476:	c3                   	ret
+  803477:	be 00 00 00 00       	mov    $0x0,%esi
+  80347c:	eb ef                	jmp    80346d <devcons_write+0x5a>
+
+0080347e <devcons_read>:
+  80347e:	55                   	push   %ebp
+  80347f:	89 e5                	mov    %esp,%ebp
+  803481:	83 ec 08             	sub    $0x8,%esp
+  803484:	b8 00 00 00 00       	mov    $0x0,%eax
+  803489:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80348d:	75 07                	jne    803496 <devcons_read+0x18>
+  80348f:	eb 1f                	jmp    8034b0 <devcons_read+0x32>
+  803491:	e8 3b db ff ff       	call   800fd1 <sys_yield>
+  803496:	e8 b7 da ff ff       	call   800f52 <sys_cgetc>
+  80349b:	85 c0                	test   %eax,%eax
+  80349d:	74 f2                	je     803491 <devcons_read+0x13>
+  80349f:	78 0f                	js     8034b0 <devcons_read+0x32>
+  8034a1:	83 f8 04             	cmp    $0x4,%eax
+  8034a4:	74 0c                	je     8034b2 <devcons_read+0x34>
+  8034a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034a9:	88 02                	mov    %al,(%edx)
+  8034ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034b0:	c9                   	leave
+  8034b1:	c3                   	ret
+  8034b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b7:	eb f7                	jmp    8034b0 <devcons_read+0x32>
+
+008034b9 <cputchar>:
+  8034b9:	55                   	push   %ebp
+  8034ba:	89 e5                	mov    %esp,%ebp
+  8034bc:	83 ec 20             	sub    $0x20,%esp
+  8034bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c2:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8034c5:	6a 01                	push   $0x1
+  8034c7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034ca:	50                   	push   %eax
+  8034cb:	e8 64 da ff ff       	call   800f34 <sys_cputs>
+  8034d0:	83 c4 10             	add    $0x10,%esp
+  8034d3:	c9                   	leave
+  8034d4:	c3                   	ret
+
+008034d5 <getchar>:
+  8034d5:	55                   	push   %ebp
+  8034d6:	89 e5                	mov    %esp,%ebp
+  8034d8:	83 ec 1c             	sub    $0x1c,%esp
+  8034db:	6a 01                	push   $0x1
+  8034dd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034e0:	50                   	push   %eax
+  8034e1:	6a 00                	push   $0x0
+  8034e3:	e8 ac eb ff ff       	call   802094 <read>
+  8034e8:	83 c4 10             	add    $0x10,%esp
+  8034eb:	85 c0                	test   %eax,%eax
+  8034ed:	78 06                	js     8034f5 <getchar+0x20>
+  8034ef:	74 06                	je     8034f7 <getchar+0x22>
+  8034f1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8034f5:	c9                   	leave
+  8034f6:	c3                   	ret
+  8034f7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8034fc:	eb f7                	jmp    8034f5 <getchar+0x20>
+
+008034fe <iscons>:
+  8034fe:	55                   	push   %ebp
+  8034ff:	89 e5                	mov    %esp,%ebp
+  803501:	83 ec 20             	sub    $0x20,%esp
+  803504:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803507:	50                   	push   %eax
+  803508:	ff 75 08             	push   0x8(%ebp)
+  80350b:	e8 22 e9 ff ff       	call   801e32 <fd_lookup>
+  803510:	83 c4 10             	add    $0x10,%esp
+  803513:	85 c0                	test   %eax,%eax
+  803515:	78 11                	js     803528 <iscons+0x2a>
+  803517:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80351a:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803520:	39 10                	cmp    %edx,(%eax)
+  803522:	0f 94 c0             	sete   %al
+  803525:	0f b6 c0             	movzbl %al,%eax
+  803528:	c9                   	leave
+  803529:	c3                   	ret
+
+0080352a <opencons>:
+  80352a:	55                   	push   %ebp
+  80352b:	89 e5                	mov    %esp,%ebp
+  80352d:	83 ec 24             	sub    $0x24,%esp
+  803530:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803533:	50                   	push   %eax
+  803534:	e8 a9 e8 ff ff       	call   801de2 <fd_alloc>
+  803539:	83 c4 10             	add    $0x10,%esp
+  80353c:	85 c0                	test   %eax,%eax
+  80353e:	78 3a                	js     80357a <opencons+0x50>
+  803540:	83 ec 04             	sub    $0x4,%esp
+  803543:	68 07 04 00 00       	push   $0x407
+  803548:	ff 75 f4             	push   -0xc(%ebp)
+  80354b:	6a 00                	push   $0x0
+  80354d:	e8 ca da ff ff       	call   80101c <sys_page_alloc>
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	85 c0                	test   %eax,%eax
+  803557:	78 21                	js     80357a <opencons+0x50>
+  803559:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80355c:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803562:	89 10                	mov    %edx,(%eax)
+  803564:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803567:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80356e:	83 ec 0c             	sub    $0xc,%esp
+  803571:	50                   	push   %eax
+  803572:	e8 44 e8 ff ff       	call   801dbb <fd2num>
+  803577:	83 c4 10             	add    $0x10,%esp
+  80357a:	c9                   	leave
+  80357b:	c3                   	ret
+
+0080357c <set_pgfault_handler>:
+  80357c:	55                   	push   %ebp
+  80357d:	89 e5                	mov    %esp,%ebp
+  80357f:	53                   	push   %ebx
+  803580:	83 ec 04             	sub    $0x4,%esp
+  803583:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80358a:	74 0d                	je     803599 <set_pgfault_handler+0x1d>
+  80358c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80358f:	a3 00 90 80 00       	mov    %eax,0x809000
+  803594:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803597:	c9                   	leave
+  803598:	c3                   	ret
+  803599:	e8 14 da ff ff       	call   800fb2 <sys_getenvid>
+  80359e:	89 c3                	mov    %eax,%ebx
+  8035a0:	83 ec 04             	sub    $0x4,%esp
+  8035a3:	6a 07                	push   $0x7
+  8035a5:	68 00 f0 7f ee       	push   $0xee7ff000
+  8035aa:	50                   	push   %eax
+  8035ab:	e8 6c da ff ff       	call   80101c <sys_page_alloc>
+  8035b0:	83 c4 10             	add    $0x10,%esp
+  8035b3:	85 c0                	test   %eax,%eax
+  8035b5:	78 29                	js     8035e0 <set_pgfault_handler+0x64>
+  8035b7:	83 ec 08             	sub    $0x8,%esp
+  8035ba:	68 f4 35 80 00       	push   $0x8035f4
+  8035bf:	53                   	push   %ebx
+  8035c0:	e8 70 dc ff ff       	call   801235 <sys_env_set_pgfault_upcall>
+  8035c5:	83 c4 10             	add    $0x10,%esp
+  8035c8:	85 c0                	test   %eax,%eax
+  8035ca:	79 c0                	jns    80358c <set_pgfault_handler+0x10>
+  8035cc:	83 ec 04             	sub    $0x4,%esp
+  8035cf:	68 c8 42 80 00       	push   $0x8042c8
+  8035d4:	6a 27                	push   $0x27
+  8035d6:	68 fa 42 80 00       	push   $0x8042fa
+  8035db:	e8 0a ce ff ff       	call   8003ea <_panic>
+  8035e0:	83 ec 04             	sub    $0x4,%esp
+  8035e3:	68 90 42 80 00       	push   $0x804290
+  8035e8:	6a 23                	push   $0x23
+  8035ea:	68 fa 42 80 00       	push   $0x8042fa
+  8035ef:	e8 f6 cd ff ff       	call   8003ea <_panic>
+
+008035f4 <_pgfault_upcall>:
+  8035f4:	54                   	push   %esp
+  8035f5:	a1 00 90 80 00       	mov    0x809000,%eax
+  8035fa:	ff d0                	call   *%eax
+  8035fc:	83 c4 04             	add    $0x4,%esp
+  8035ff:	89 e3                	mov    %esp,%ebx
+  803601:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803605:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803609:	89 d4                	mov    %edx,%esp
+  80360b:	51                   	push   %ecx
+  80360c:	89 dc                	mov    %ebx,%esp
+  80360e:	83 ea 04             	sub    $0x4,%edx
+  803611:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803615:	83 c4 08             	add    $0x8,%esp
+  803618:	61                   	popa
+  803619:	83 c4 04             	add    $0x4,%esp
+  80361c:	9d                   	popf
+  80361d:	5c                   	pop    %esp
+  80361e:	c3                   	ret
+
+0080361f <ipc_recv>:
+  80361f:	55                   	push   %ebp
+  803620:	89 e5                	mov    %esp,%ebp
+  803622:	56                   	push   %esi
+  803623:	53                   	push   %ebx
+  803624:	8b 75 08             	mov    0x8(%ebp),%esi
+  803627:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80362a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80362d:	85 c0                	test   %eax,%eax
+  80362f:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803634:	0f 44 c2             	cmove  %edx,%eax
+  803637:	83 ec 0c             	sub    $0xc,%esp
+  80363a:	50                   	push   %eax
+  80363b:	e8 87 dc ff ff       	call   8012c7 <sys_ipc_recv>
+  803640:	83 c4 10             	add    $0x10,%esp
+  803643:	85 c0                	test   %eax,%eax
+  803645:	78 2a                	js     803671 <ipc_recv+0x52>
+  803647:	a1 20 64 80 00       	mov    0x806420,%eax
+  80364c:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803652:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803658:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80365e:	85 f6                	test   %esi,%esi
+  803660:	74 02                	je     803664 <ipc_recv+0x45>
+  803662:	89 0e                	mov    %ecx,(%esi)
+  803664:	85 db                	test   %ebx,%ebx
+  803666:	74 02                	je     80366a <ipc_recv+0x4b>
+  803668:	89 13                	mov    %edx,(%ebx)
+  80366a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80366d:	5b                   	pop    %ebx
+  80366e:	5e                   	pop    %esi
+  80366f:	5d                   	pop    %ebp
+  803670:	c3                   	ret
+  803671:	ba 00 00 00 00       	mov    $0x0,%edx
+  803676:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80367b:	eb e1                	jmp    80365e <ipc_recv+0x3f>
+
+0080367d <ipc_send>:
+  80367d:	55                   	push   %ebp
+  80367e:	89 e5                	mov    %esp,%ebp
+  803680:	57                   	push   %edi
+  803681:	56                   	push   %esi
+  803682:	53                   	push   %ebx
+  803683:	83 ec 0c             	sub    $0xc,%esp
+  803686:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803689:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80368c:	8b 75 14             	mov    0x14(%ebp),%esi
+  80368f:	85 db                	test   %ebx,%ebx
+  803691:	74 1e                	je     8036b1 <ipc_send+0x34>
+  803693:	56                   	push   %esi
+  803694:	53                   	push   %ebx
+  803695:	57                   	push   %edi
+  803696:	ff 75 08             	push   0x8(%ebp)
+  803699:	e8 b6 dc ff ff       	call   801354 <sys_ipc_send>
+  80369e:	83 c4 10             	add    $0x10,%esp
+  8036a1:	85 c0                	test   %eax,%eax
+  8036a3:	74 2a                	je     8036cf <ipc_send+0x52>
+  8036a5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8036a8:	75 13                	jne    8036bd <ipc_send+0x40>
+  8036aa:	e8 22 d9 ff ff       	call   800fd1 <sys_yield>
+  8036af:	eb e2                	jmp    803693 <ipc_send+0x16>
+  8036b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b6:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8036bb:	eb d6                	jmp    803693 <ipc_send+0x16>
+  8036bd:	50                   	push   %eax
+  8036be:	68 08 43 80 00       	push   $0x804308
+  8036c3:	6a 4f                	push   $0x4f
+  8036c5:	68 4b 43 80 00       	push   $0x80434b
+  8036ca:	e8 1b cd ff ff       	call   8003ea <_panic>
+  8036cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d2:	5b                   	pop    %ebx
+  8036d3:	5e                   	pop    %esi
+  8036d4:	5f                   	pop    %edi
+  8036d5:	5d                   	pop    %ebp
+  8036d6:	c3                   	ret
+
+008036d7 <ipc_call>:
+  8036d7:	55                   	push   %ebp
+  8036d8:	89 e5                	mov    %esp,%ebp
+  8036da:	57                   	push   %edi
+  8036db:	56                   	push   %esi
+  8036dc:	53                   	push   %ebx
+  8036dd:	83 ec 0c             	sub    $0xc,%esp
+  8036e0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036e4:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8036e9:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8036ed:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8036f1:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8036f6:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8036fa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803703:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803707:	eb 05                	jmp    80370e <ipc_call+0x37>
+  803709:	e8 c3 d8 ff ff       	call   800fd1 <sys_yield>
+  80370e:	83 ec 0c             	sub    $0xc,%esp
+  803711:	56                   	push   %esi
+  803712:	53                   	push   %ebx
+  803713:	57                   	push   %edi
+  803714:	ff 75 0c             	push   0xc(%ebp)
+  803717:	ff 75 08             	push   0x8(%ebp)
+  80371a:	e8 85 dc ff ff       	call   8013a4 <sys_ipc_call>
+  80371f:	83 c4 20             	add    $0x20,%esp
+  803722:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803725:	74 e2                	je     803709 <ipc_call+0x32>
+  803727:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80372a:	74 2d                	je     803759 <ipc_call+0x82>
+  80372c:	85 c0                	test   %eax,%eax
+  80372e:	78 4f                	js     80377f <ipc_call+0xa8>
+  803730:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803734:	74 10                	je     803746 <ipc_call+0x6f>
+  803736:	a1 20 64 80 00       	mov    0x806420,%eax
+  80373b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803741:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803744:	89 02                	mov    %eax,(%edx)
+  803746:	a1 20 64 80 00       	mov    0x806420,%eax
+  80374b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803751:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803754:	5b                   	pop    %ebx
+  803755:	5e                   	pop    %esi
+  803756:	5f                   	pop    %edi
+  803757:	5d                   	pop    %ebp
+  803758:	c3                   	ret
+  803759:	ff 75 14             	push   0x14(%ebp)
+  80375c:	ff 75 10             	push   0x10(%ebp)
+  80375f:	ff 75 0c             	push   0xc(%ebp)
+  803762:	ff 75 08             	push   0x8(%ebp)
+  803765:	e8 13 ff ff ff       	call   80367d <ipc_send>
+  80376a:	83 c4 0c             	add    $0xc,%esp
+  80376d:	ff 75 1c             	push   0x1c(%ebp)
+  803770:	ff 75 18             	push   0x18(%ebp)
+  803773:	6a 00                	push   $0x0
+  803775:	e8 a5 fe ff ff       	call   80361f <ipc_recv>
+  80377a:	83 c4 10             	add    $0x10,%esp
+  80377d:	eb d2                	jmp    803751 <ipc_call+0x7a>
+  80377f:	50                   	push   %eax
+  803780:	68 55 43 80 00       	push   $0x804355
+  803785:	6a 6d                	push   $0x6d
+  803787:	68 4b 43 80 00       	push   $0x80434b
+  80378c:	e8 59 cc ff ff       	call   8003ea <_panic>
+
+00803791 <ipc_reply_recv>:
+  803791:	55                   	push   %ebp
+  803792:	89 e5                	mov    %esp,%ebp
+  803794:	57                   	push   %edi
+  803795:	56                   	push   %esi
+  803796:	53                   	push   %ebx
+  803797:	83 ec 0c             	sub    $0xc,%esp
+  80379a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80379d:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8037a0:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8037a3:	85 db                	test   %ebx,%ebx
+  8037a5:	0f 84 ac 00 00 00    	je     803857 <ipc_reply_recv+0xc6>
+  8037ab:	85 f6                	test   %esi,%esi
+  8037ad:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8037b2:	0f 45 c6             	cmovne %esi,%eax
+  8037b5:	83 ec 0c             	sub    $0xc,%esp
+  8037b8:	50                   	push   %eax
+  8037b9:	ff 75 14             	push   0x14(%ebp)
+  8037bc:	53                   	push   %ebx
+  8037bd:	ff 75 0c             	push   0xc(%ebp)
+  8037c0:	ff 75 08             	push   0x8(%ebp)
+  8037c3:	e8 fd db ff ff       	call   8013c5 <sys_ipc_reply_recv>
+  8037c8:	83 c4 20             	add    $0x20,%esp
+  8037cb:	85 c0                	test   %eax,%eax
+  8037cd:	78 3a                	js     803809 <ipc_reply_recv+0x78>
+  8037cf:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8037d3:	74 10                	je     8037e5 <ipc_reply_recv+0x54>
+  8037d5:	a1 20 64 80 00       	mov    0x806420,%eax
+  8037da:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8037e0:	8b 55 18             	mov    0x18(%ebp),%edx
+  8037e3:	89 02                	mov    %eax,(%edx)
+  8037e5:	85 ff                	test   %edi,%edi
+  8037e7:	74 0d                	je     8037f6 <ipc_reply_recv+0x65>
+  8037e9:	a1 20 64 80 00       	mov    0x806420,%eax
+  8037ee:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8037f4:	89 07                	mov    %eax,(%edi)
+  8037f6:	a1 20 64 80 00       	mov    0x806420,%eax
+  8037fb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803804:	5b                   	pop    %ebx
+  803805:	5e                   	pop    %esi
+  803806:	5f                   	pop    %edi
+  803807:	5d                   	pop    %ebp
+  803808:	c3                   	ret
+  803809:	ff 75 14             	push   0x14(%ebp)
+  80380c:	53                   	push   %ebx
+  80380d:	ff 75 0c             	push   0xc(%ebp)
+  803810:	ff 75 08             	push   0x8(%ebp)
+  803813:	e8 5f da ff ff       	call   801277 <sys_ipc_try_send>
+  803818:	89 c2                	mov    %eax,%edx
+  80381a:	c1 ea 1f             	shr    $0x1f,%edx
+  80381d:	83 c4 10             	add    $0x10,%esp
+  803820:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803823:	0f 95 c1             	setne  %cl
+  803826:	84 d1                	test   %dl,%cl
+  803828:	74 05                	je     80382f <ipc_reply_recv+0x9e>
+  80382a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80382d:	75 12                	jne    803841 <ipc_reply_recv+0xb0>
+  80382f:	83 ec 04             	sub    $0x4,%esp
+  803832:	57                   	push   %edi
+  803833:	56                   	push   %esi
+  803834:	ff 75 18             	push   0x18(%ebp)
+  803837:	e8 e3 fd ff ff       	call   80361f <ipc_recv>
+  80383c:	83 c4 10             	add    $0x10,%esp
+  80383f:	eb c0                	jmp    803801 <ipc_reply_recv+0x70>
+  803841:	83 ec 04             	sub    $0x4,%esp
+  803844:	50                   	push   %eax
+  803845:	ff 75 08             	push   0x8(%ebp)
+  803848:	68 28 43 80 00       	push   $0x804328
+  80384d:	e8 73 cc ff ff       	call   8004c5 <cprintf>
+  803852:	83 c4 10             	add    $0x10,%esp
+  803855:	eb d8                	jmp    80382f <ipc_reply_recv+0x9e>
+  803857:	85 f6                	test   %esi,%esi
+  803859:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80385e:	0f 45 c6             	cmovne %esi,%eax
+  803861:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803866:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80386d:	e9 43 ff ff ff       	jmp    8037b5 <ipc_reply_recv+0x24>
+
+00803872 <ipc_find_env>:
+  803872:	55                   	push   %ebp
+  803873:	89 e5                	mov    %esp,%ebp
+  803875:	83 ec 14             	sub    $0x14,%esp
+  803878:	ff 75 08             	push   0x8(%ebp)
+  80387b:	e8 95 d9 ff ff       	call   801215 <sys_env_service>
+  803880:	85 c0                	test   %eax,%eax
+  803882:	ba 00 00 00 00       	mov    $0x0,%edx
+  803887:	0f 48 c2             	cmovs  %edx,%eax
+  80388a:	c9                   	leave
+  80388b:	c3                   	ret
+
+0080388c <pageref>:
+  80388c:	55                   	push   %ebp
+  80388d:	89 e5                	mov    %esp,%ebp
+  80388f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803892:	89 c2                	mov    %eax,%edx
+  803894:	c1 ea 16             	shr    $0x16,%edx
+  803897:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80389e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a3:	f6 c1 01             	test   $0x1,%cl
+  8038a6:	74 22                	je     8038ca <pageref+0x3e>
+  8038a8:	c1 e8 0c             	shr    $0xc,%eax
+  8038ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8038b2:	a8 01                	test   $0x1,%al
+  8038b4:	74 14                	je     8038ca <pageref+0x3e>
+  8038b6:	c1 e8 0c             	shr    $0xc,%eax
+  8038b9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8038bc:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8038c3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8038c7:	0f b7 d2             	movzwl %dx,%edx
+  8038ca:	89 d0                	mov    %edx,%eax
+  8038cc:	5d                   	pop    %ebp
+  8038cd:	c3                   	ret
+
+008038ce <__udivmoddi4>:
+  8038ce:	55                   	push   %ebp
+  8038cf:	57                   	push   %edi
+  8038d0:	56                   	push   %esi
+  8038d1:	53                   	push   %ebx
+  8038d2:	83 ec 24             	sub    $0x24,%esp
+  8038d5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038d9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038dd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038e1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038e5:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8038e9:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8038ed:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038f1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038f5:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8038f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803903:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803908:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80390f:	00 
+  803910:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803917:	00 
+  803918:	89 fb                	mov    %edi,%ebx
+  80391a:	eb 08                	jmp    803924 <__udivmoddi4+0x56>
+  80391c:	83 e9 01             	sub    $0x1,%ecx
+  80391f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803922:	74 68                	je     80398c <__udivmoddi4+0xbe>
+  803924:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803928:	01 c0                	add    %eax,%eax
+  80392a:	89 c6                	mov    %eax,%esi
+  80392c:	89 d7                	mov    %edx,%edi
+  80392e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803932:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803936:	0f ad d0             	shrd   %cl,%edx,%eax
+  803939:	d3 ea                	shr    %cl,%edx
+  80393b:	f6 c1 20             	test   $0x20,%cl
+  80393e:	74 04                	je     803944 <__udivmoddi4+0x76>
+  803940:	89 d0                	mov    %edx,%eax
+  803942:	31 d2                	xor    %edx,%edx
+  803944:	83 e0 01             	and    $0x1,%eax
+  803947:	89 04 24             	mov    %eax,(%esp)
+  80394a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803951:	00 
+  803952:	8b 04 24             	mov    (%esp),%eax
+  803955:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803959:	09 f0                	or     %esi,%eax
+  80395b:	09 fa                	or     %edi,%edx
+  80395d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803961:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803965:	39 f0                	cmp    %esi,%eax
+  803967:	89 d5                	mov    %edx,%ebp
+  803969:	19 fd                	sbb    %edi,%ebp
+  80396b:	72 af                	jb     80391c <__udivmoddi4+0x4e>
+  80396d:	29 f0                	sub    %esi,%eax
+  80396f:	19 fa                	sbb    %edi,%edx
+  803971:	89 cf                	mov    %ecx,%edi
+  803973:	c1 ef 05             	shr    $0x5,%edi
+  803976:	83 e7 01             	and    $0x1,%edi
+  803979:	89 fe                	mov    %edi,%esi
+  80397b:	83 f6 01             	xor    $0x1,%esi
+  80397e:	d3 e6                	shl    %cl,%esi
+  803980:	d3 e7                	shl    %cl,%edi
+  803982:	09 74 24 18          	or     %esi,0x18(%esp)
+  803986:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80398a:	eb 90                	jmp    80391c <__udivmoddi4+0x4e>
+  80398c:	85 db                	test   %ebx,%ebx
+  80398e:	74 05                	je     803995 <__udivmoddi4+0xc7>
+  803990:	89 03                	mov    %eax,(%ebx)
+  803992:	89 53 04             	mov    %edx,0x4(%ebx)
+  803995:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803999:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80399d:	83 c4 24             	add    $0x24,%esp
+  8039a0:	5b                   	pop    %ebx
+  8039a1:	5e                   	pop    %esi
+  8039a2:	5f                   	pop    %edi
+  8039a3:	5d                   	pop    %ebp
+  8039a4:	c3                   	ret
+
+008039a5 <__udivdi3>:
+  8039a5:	83 ec 08             	sub    $0x8,%esp
+  8039a8:	6a 00                	push   $0x0
+  8039aa:	ff 74 24 1c          	push   0x1c(%esp)
+  8039ae:	ff 74 24 1c          	push   0x1c(%esp)
+  8039b2:	ff 74 24 1c          	push   0x1c(%esp)
+  8039b6:	ff 74 24 1c          	push   0x1c(%esp)
+  8039ba:	e8 0f ff ff ff       	call   8038ce <__udivmoddi4>
+  8039bf:	83 c4 1c             	add    $0x1c,%esp
+  8039c2:	c3                   	ret
+
+008039c3 <__umoddi3>:
+  8039c3:	83 ec 18             	sub    $0x18,%esp
+  8039c6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8039ca:	50                   	push   %eax
+  8039cb:	ff 74 24 2c          	push   0x2c(%esp)
+  8039cf:	ff 74 24 2c          	push   0x2c(%esp)
+  8039d3:	ff 74 24 2c          	push   0x2c(%esp)
+  8039d7:	ff 74 24 2c          	push   0x2c(%esp)
+  8039db:	e8 ee fe ff ff       	call   8038ce <__udivmoddi4>
+  8039e0:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8039e4:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8039e8:	83 c4 2c             	add    $0x2c,%esp
+  8039eb:	c3                   	ret
+
+008039ec <__divdi3>:
+  8039ec:	53                   	push   %ebx
+  8039ed:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039f1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039f5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039f9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039fd:	85 d2                	test   %edx,%edx
+  8039ff:	78 12                	js     803a13 <__divdi3+0x27>
+  803a01:	85 db                	test   %ebx,%ebx
+  803a03:	78 2e                	js     803a33 <__divdi3+0x47>
+  803a05:	53                   	push   %ebx
+  803a06:	51                   	push   %ecx
+  803a07:	52                   	push   %edx
+  803a08:	50                   	push   %eax
+  803a09:	e8 97 ff ff ff       	call   8039a5 <__udivdi3>
+  803a0e:	83 c4 10             	add    $0x10,%esp
+  803a11:	eb 1e                	jmp    803a31 <__divdi3+0x45>
+  803a13:	f7 d8                	neg    %eax
+  803a15:	83 d2 00             	adc    $0x0,%edx
+  803a18:	f7 da                	neg    %edx
+  803a1a:	85 db                	test   %ebx,%ebx
+  803a1c:	78 2a                	js     803a48 <__divdi3+0x5c>
+  803a1e:	53                   	push   %ebx
+  803a1f:	51                   	push   %ecx
+  803a20:	52                   	push   %edx
+  803a21:	50                   	push   %eax
+  803a22:	e8 7e ff ff ff       	call   8039a5 <__udivdi3>
+  803a27:	83 c4 10             	add    $0x10,%esp
+  803a2a:	f7 d8                	neg    %eax
+  803a2c:	83 d2 00             	adc    $0x0,%edx
+  803a2f:	f7 da                	neg    %edx
+  803a31:	5b                   	pop    %ebx
+  803a32:	c3                   	ret
+  803a33:	f7 d9                	neg    %ecx
+  803a35:	83 d3 00             	adc    $0x0,%ebx
+  803a38:	f7 db                	neg    %ebx
+  803a3a:	53                   	push   %ebx
+  803a3b:	51                   	push   %ecx
+  803a3c:	52                   	push   %edx
+  803a3d:	50                   	push   %eax
+  803a3e:	e8 62 ff ff ff       	call   8039a5 <__udivdi3>
+  803a43:	83 c4 10             	add    $0x10,%esp
+  803a46:	eb e2                	jmp    803a2a <__divdi3+0x3e>
+  803a48:	f7 d9                	neg    %ecx
+  803a4a:	83 d3 00             	adc    $0x0,%ebx
+  803a4d:	f7 db                	neg    %ebx
+  803a4f:	53                   	push   %ebx
+  803a50:	51                   	push   %ecx
+  803a51:	52                   	push   %edx
+  803a52:	50                   	push   %eax
+  803a53:	e8 4d ff ff ff       	call   8039a5 <__udivdi3>
+  803a58:	83 c4 10             	add    $0x10,%esp
+  803a5b:	eb d4                	jmp    803a31 <__divdi3+0x45>
+
+00803a5d <__moddi3>:
+  803a5d:	55                   	push   %ebp
+  803a5e:	57                   	push   %edi
+  803a5f:	56                   	push   %esi
+  803a60:	53                   	push   %ebx
+  803a61:	83 ec 0c             	sub    $0xc,%esp
+  803a64:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803a68:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803a6c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a70:	89 e9                	mov    %ebp,%ecx
+  803a72:	f7 d9                	neg    %ecx
+  803a74:	89 d0                	mov    %edx,%eax
+  803a76:	83 d0 00             	adc    $0x0,%eax
+  803a79:	f7 d8                	neg    %eax
+  803a7b:	0f 49 e9             	cmovns %ecx,%ebp
+  803a7e:	0f 49 d0             	cmovns %eax,%edx
+  803a81:	52                   	push   %edx
+  803a82:	55                   	push   %ebp
+  803a83:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803a87:	f7 da                	neg    %edx
+  803a89:	89 d8                	mov    %ebx,%eax
+  803a8b:	83 d0 00             	adc    $0x0,%eax
+  803a8e:	f7 d8                	neg    %eax
+  803a90:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803a95:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803a99:	0f 48 c3             	cmovs  %ebx,%eax
+  803a9c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803aa0:	ff 74 24 0c          	push   0xc(%esp)
+  803aa4:	ff 74 24 0c          	push   0xc(%esp)
+  803aa8:	e8 16 ff ff ff       	call   8039c3 <__umoddi3>
+  803aad:	83 c4 10             	add    $0x10,%esp
+  803ab0:	85 db                	test   %ebx,%ebx
+  803ab2:	78 08                	js     803abc <__moddi3+0x5f>
+  803ab4:	83 c4 0c             	add    $0xc,%esp
+  803ab7:	5b                   	pop    %ebx
+  803ab8:	5e                   	pop    %esi
+  803ab9:	5f                   	pop    %edi
+  803aba:	5d                   	pop    %ebp
+  803abb:	c3                   	ret
+  803abc:	f7 d8                	neg    %eax
+  803abe:	83 d2 00             	adc    $0x0,%edx
+  803ac1:	f7 da                	neg    %edx
+  803ac3:	eb ef                	jmp    803ab4 <__moddi3+0x57>
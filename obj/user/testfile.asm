@@ -0,0 +1,5453 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 47 06 00 00       	call   800678 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+  80003c:	50                   	push   %eax
+  80003d:	68 00 70 80 00       	push   $0x807000
+  800042:	e8 7c 0e 00 00       	call   800ec3 <strcpy>
+  800047:	89 1d 00 74 80 00    	mov    %ebx,0x807400
+  80004d:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  800054:	e8 8b 1d 00 00       	call   801de4 <ipc_find_env>
+  800059:	83 c4 08             	add    $0x8,%esp
+  80005c:	6a 00                	push   $0x0
+  80005e:	68 00 c0 cc cc       	push   $0xccccc000
+  800063:	6a 07                	push   $0x7
+  800065:	68 00 70 80 00       	push   $0x807000
+  80006a:	6a 01                	push   $0x1
+  80006c:	50                   	push   %eax
+  80006d:	e8 d7 1b 00 00       	call   801c49 <ipc_call>
+  800072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800075:	c9                   	leave
+  800076:	c3                   	ret
+
+00800077 <umain>:
+  800077:	55                   	push   %ebp
+  800078:	89 e5                	mov    %esp,%ebp
+  80007a:	57                   	push   %edi
+  80007b:	56                   	push   %esi
+  80007c:	53                   	push   %ebx
+  80007d:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+  800083:	ba 00 00 00 00       	mov    $0x0,%edx
+  800088:	b8 a0 37 80 00       	mov    $0x8037a0,%eax
+  80008d:	e8 a1 ff ff ff       	call   800033 <xopen>
+  800092:	85 c0                	test   %eax,%eax
+  800094:	0f 89 fa 03 00 00    	jns    800494 <umain+0x41d>
+  80009a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80009d:	0f 85 df 03 00 00    	jne    800482 <umain+0x40b>
+  8000a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a8:	b8 d5 37 80 00       	mov    $0x8037d5,%eax
+  8000ad:	e8 81 ff ff ff       	call   800033 <xopen>
+  8000b2:	85 c0                	test   %eax,%eax
+  8000b4:	0f 88 ee 03 00 00    	js     8004a8 <umain+0x431>
+  8000ba:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c1:	0f 85 f3 03 00 00    	jne    8004ba <umain+0x443>
+  8000c7:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000ce:	0f 85 e6 03 00 00    	jne    8004ba <umain+0x443>
+  8000d4:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000db:	0f 85 d9 03 00 00    	jne    8004ba <umain+0x443>
+  8000e1:	83 ec 0c             	sub    $0xc,%esp
+  8000e4:	68 f6 37 80 00       	push   $0x8037f6
+  8000e9:	e8 de 06 00 00       	call   8007cc <cprintf>
+  8000ee:	83 c4 08             	add    $0x8,%esp
+  8000f1:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8000f7:	50                   	push   %eax
+  8000f8:	68 00 c0 cc cc       	push   $0xccccc000
+  8000fd:	ff 15 1c 50 80 00    	call   *0x80501c
+  800103:	83 c4 10             	add    $0x10,%esp
+  800106:	85 c0                	test   %eax,%eax
+  800108:	0f 88 c0 03 00 00    	js     8004ce <umain+0x457>
+  80010e:	83 ec 0c             	sub    $0xc,%esp
+  800111:	ff 35 00 50 80 00    	push   0x805000
+  800117:	e8 5b 0d 00 00       	call   800e77 <strlen>
+  80011c:	83 c4 10             	add    $0x10,%esp
+  80011f:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  800122:	0f 85 b8 03 00 00    	jne    8004e0 <umain+0x469>
+  800128:	83 ec 0c             	sub    $0xc,%esp
+  80012b:	68 18 38 80 00       	push   $0x803818
+  800130:	e8 97 06 00 00       	call   8007cc <cprintf>
+  800135:	83 c4 0c             	add    $0xc,%esp
+  800138:	68 00 02 00 00       	push   $0x200
+  80013d:	6a 00                	push   $0x0
+  80013f:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  800145:	53                   	push   %ebx
+  800146:	e8 f3 0e 00 00       	call   80103e <memset>
+  80014b:	83 c4 0c             	add    $0xc,%esp
+  80014e:	68 00 02 00 00       	push   $0x200
+  800153:	53                   	push   %ebx
+  800154:	68 00 c0 cc cc       	push   $0xccccc000
+  800159:	ff 15 10 50 80 00    	call   *0x805010
+  80015f:	83 c4 10             	add    $0x10,%esp
+  800162:	85 c0                	test   %eax,%eax
+  800164:	0f 88 9b 03 00 00    	js     800505 <umain+0x48e>
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 35 00 50 80 00    	push   0x805000
+  800173:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800179:	50                   	push   %eax
+  80017a:	e8 f4 0d 00 00       	call   800f73 <strcmp>
+  80017f:	83 c4 10             	add    $0x10,%esp
+  800182:	85 c0                	test   %eax,%eax
+  800184:	0f 85 8d 03 00 00    	jne    800517 <umain+0x4a0>
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	68 57 38 80 00       	push   $0x803857
+  800192:	e8 35 06 00 00       	call   8007cc <cprintf>
+  800197:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  80019e:	ff 15 18 50 80 00    	call   *0x805018
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 7c 03 00 00    	js     80052b <umain+0x4b4>
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	68 79 38 80 00       	push   $0x803879
+  8001b7:	e8 10 06 00 00       	call   8007cc <cprintf>
+  8001bc:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c4:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001cc:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d4:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001dc:	83 c4 08             	add    $0x8,%esp
+  8001df:	68 00 c0 cc cc       	push   $0xccccc000
+  8001e4:	6a 00                	push   $0x0
+  8001e6:	e8 0a 12 00 00       	call   8013f5 <sys_page_unmap>
+  8001eb:	83 c4 0c             	add    $0xc,%esp
+  8001ee:	68 00 02 00 00       	push   $0x200
+  8001f3:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8001f9:	50                   	push   %eax
+  8001fa:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8001fd:	50                   	push   %eax
+  8001fe:	ff 15 10 50 80 00    	call   *0x805010
+  800204:	83 c4 10             	add    $0x10,%esp
+  800207:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80020a:	0f 85 2d 03 00 00    	jne    80053d <umain+0x4c6>
+  800210:	83 ec 0c             	sub    $0xc,%esp
+  800213:	68 8d 38 80 00       	push   $0x80388d
+  800218:	e8 af 05 00 00       	call   8007cc <cprintf>
+  80021d:	ba 02 01 00 00       	mov    $0x102,%edx
+  800222:	b8 a3 38 80 00       	mov    $0x8038a3,%eax
+  800227:	e8 07 fe ff ff       	call   800033 <xopen>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	85 c0                	test   %eax,%eax
+  800231:	0f 88 18 03 00 00    	js     80054f <umain+0x4d8>
+  800237:	8b 1d 14 50 80 00    	mov    0x805014,%ebx
+  80023d:	83 ec 0c             	sub    $0xc,%esp
+  800240:	ff 35 00 50 80 00    	push   0x805000
+  800246:	e8 2c 0c 00 00       	call   800e77 <strlen>
+  80024b:	83 c4 0c             	add    $0xc,%esp
+  80024e:	50                   	push   %eax
+  80024f:	ff 35 00 50 80 00    	push   0x805000
+  800255:	68 00 c0 cc cc       	push   $0xccccc000
+  80025a:	ff d3                	call   *%ebx
+  80025c:	89 c3                	mov    %eax,%ebx
+  80025e:	83 c4 04             	add    $0x4,%esp
+  800261:	ff 35 00 50 80 00    	push   0x805000
+  800267:	e8 0b 0c 00 00       	call   800e77 <strlen>
+  80026c:	83 c4 10             	add    $0x10,%esp
+  80026f:	39 d8                	cmp    %ebx,%eax
+  800271:	0f 85 ea 02 00 00    	jne    800561 <umain+0x4ea>
+  800277:	83 ec 0c             	sub    $0xc,%esp
+  80027a:	68 d5 38 80 00       	push   $0x8038d5
+  80027f:	e8 48 05 00 00       	call   8007cc <cprintf>
+  800284:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  80028b:	00 00 00 
+  80028e:	83 c4 0c             	add    $0xc,%esp
+  800291:	68 00 02 00 00       	push   $0x200
+  800296:	6a 00                	push   $0x0
+  800298:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  80029e:	53                   	push   %ebx
+  80029f:	e8 9a 0d 00 00       	call   80103e <memset>
+  8002a4:	83 c4 0c             	add    $0xc,%esp
+  8002a7:	68 00 02 00 00       	push   $0x200
+  8002ac:	53                   	push   %ebx
+  8002ad:	68 00 c0 cc cc       	push   $0xccccc000
+  8002b2:	ff 15 10 50 80 00    	call   *0x805010
+  8002b8:	89 c3                	mov    %eax,%ebx
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	85 c0                	test   %eax,%eax
+  8002bf:	0f 88 ae 02 00 00    	js     800573 <umain+0x4fc>
+  8002c5:	83 ec 0c             	sub    $0xc,%esp
+  8002c8:	ff 35 00 50 80 00    	push   0x805000
+  8002ce:	e8 a4 0b 00 00       	call   800e77 <strlen>
+  8002d3:	83 c4 10             	add    $0x10,%esp
+  8002d6:	39 d8                	cmp    %ebx,%eax
+  8002d8:	0f 85 a7 02 00 00    	jne    800585 <umain+0x50e>
+  8002de:	83 ec 08             	sub    $0x8,%esp
+  8002e1:	ff 35 00 50 80 00    	push   0x805000
+  8002e7:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8002ed:	50                   	push   %eax
+  8002ee:	e8 80 0c 00 00       	call   800f73 <strcmp>
+  8002f3:	83 c4 10             	add    $0x10,%esp
+  8002f6:	85 c0                	test   %eax,%eax
+  8002f8:	0f 85 99 02 00 00    	jne    800597 <umain+0x520>
+  8002fe:	83 ec 0c             	sub    $0xc,%esp
+  800301:	68 9c 3a 80 00       	push   $0x803a9c
+  800306:	e8 c1 04 00 00       	call   8007cc <cprintf>
+  80030b:	83 c4 08             	add    $0x8,%esp
+  80030e:	6a 00                	push   $0x0
+  800310:	68 a0 37 80 00       	push   $0x8037a0
+  800315:	e8 7a 25 00 00       	call   802894 <open>
+  80031a:	83 c4 10             	add    $0x10,%esp
+  80031d:	85 c0                	test   %eax,%eax
+  80031f:	0f 89 98 02 00 00    	jns    8005bd <umain+0x546>
+  800325:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  800328:	0f 85 7d 02 00 00    	jne    8005ab <umain+0x534>
+  80032e:	83 ec 08             	sub    $0x8,%esp
+  800331:	6a 00                	push   $0x0
+  800333:	68 d5 37 80 00       	push   $0x8037d5
+  800338:	e8 57 25 00 00       	call   802894 <open>
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	85 c0                	test   %eax,%eax
+  800342:	0f 88 89 02 00 00    	js     8005d1 <umain+0x55a>
+  800348:	c1 e0 0c             	shl    $0xc,%eax
+  80034b:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  800352:	0f 85 8b 02 00 00    	jne    8005e3 <umain+0x56c>
+  800358:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  80035f:	0f 85 7e 02 00 00    	jne    8005e3 <umain+0x56c>
+  800365:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  80036b:	85 db                	test   %ebx,%ebx
+  80036d:	0f 85 70 02 00 00    	jne    8005e3 <umain+0x56c>
+  800373:	83 ec 0c             	sub    $0xc,%esp
+  800376:	68 fc 37 80 00       	push   $0x8037fc
+  80037b:	e8 4c 04 00 00       	call   8007cc <cprintf>
+  800380:	83 c4 08             	add    $0x8,%esp
+  800383:	68 01 01 00 00       	push   $0x101
+  800388:	68 04 39 80 00       	push   $0x803904
+  80038d:	e8 02 25 00 00       	call   802894 <open>
+  800392:	89 c7                	mov    %eax,%edi
+  800394:	83 c4 10             	add    $0x10,%esp
+  800397:	85 c0                	test   %eax,%eax
+  800399:	0f 88 58 02 00 00    	js     8005f7 <umain+0x580>
+  80039f:	83 ec 04             	sub    $0x4,%esp
+  8003a2:	68 00 02 00 00       	push   $0x200
+  8003a7:	6a 00                	push   $0x0
+  8003a9:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003af:	50                   	push   %eax
+  8003b0:	e8 89 0c 00 00       	call   80103e <memset>
+  8003b5:	83 c4 10             	add    $0x10,%esp
+  8003b8:	89 de                	mov    %ebx,%esi
+  8003ba:	89 b5 4c fd ff ff    	mov    %esi,-0x2b4(%ebp)
+  8003c0:	83 ec 04             	sub    $0x4,%esp
+  8003c3:	68 00 02 00 00       	push   $0x200
+  8003c8:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003ce:	50                   	push   %eax
+  8003cf:	57                   	push   %edi
+  8003d0:	e8 dd 1d 00 00       	call   8021b2 <write>
+  8003d5:	83 c4 10             	add    $0x10,%esp
+  8003d8:	85 c0                	test   %eax,%eax
+  8003da:	0f 88 29 02 00 00    	js     800609 <umain+0x592>
+  8003e0:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  8003e6:	89 c6                	mov    %eax,%esi
+  8003e8:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8003ed:	75 cb                	jne    8003ba <umain+0x343>
+  8003ef:	83 ec 0c             	sub    $0xc,%esp
+  8003f2:	57                   	push   %edi
+  8003f3:	e8 a3 1b 00 00       	call   801f9b <close>
+  8003f8:	83 c4 08             	add    $0x8,%esp
+  8003fb:	6a 00                	push   $0x0
+  8003fd:	68 04 39 80 00       	push   $0x803904
+  800402:	e8 8d 24 00 00       	call   802894 <open>
+  800407:	89 c6                	mov    %eax,%esi
+  800409:	83 c4 10             	add    $0x10,%esp
+  80040c:	85 c0                	test   %eax,%eax
+  80040e:	0f 88 0b 02 00 00    	js     80061f <umain+0x5a8>
+  800414:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+  80041a:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+  800420:	83 ec 04             	sub    $0x4,%esp
+  800423:	68 00 02 00 00       	push   $0x200
+  800428:	57                   	push   %edi
+  800429:	56                   	push   %esi
+  80042a:	e8 2f 1d 00 00       	call   80215e <readn>
+  80042f:	83 c4 10             	add    $0x10,%esp
+  800432:	85 c0                	test   %eax,%eax
+  800434:	0f 88 f7 01 00 00    	js     800631 <umain+0x5ba>
+  80043a:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80043f:	0f 85 02 02 00 00    	jne    800647 <umain+0x5d0>
+  800445:	8b 85 4c fd ff ff    	mov    -0x2b4(%ebp),%eax
+  80044b:	39 d8                	cmp    %ebx,%eax
+  80044d:	0f 85 0f 02 00 00    	jne    800662 <umain+0x5eb>
+  800453:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800459:	89 c3                	mov    %eax,%ebx
+  80045b:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800460:	75 b8                	jne    80041a <umain+0x3a3>
+  800462:	83 ec 0c             	sub    $0xc,%esp
+  800465:	56                   	push   %esi
+  800466:	e8 30 1b 00 00       	call   801f9b <close>
+  80046b:	c7 04 24 49 39 80 00 	movl   $0x803949,(%esp)
+  800472:	e8 55 03 00 00       	call   8007cc <cprintf>
+  800477:	83 c4 10             	add    $0x10,%esp
+  80047a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80047d:	5b                   	pop    %ebx
+  80047e:	5e                   	pop    %esi
+  80047f:	5f                   	pop    %edi
+  800480:	5d                   	pop    %ebp
+  800481:	c3                   	ret
+  800482:	50                   	push   %eax
+  800483:	68 ab 37 80 00       	push   $0x8037ab
+  800488:	6a 20                	push   $0x20
+  80048a:	68 c5 37 80 00       	push   $0x8037c5
+  80048f:	e8 5d 02 00 00       	call   8006f1 <_panic>
+  800494:	83 ec 04             	sub    $0x4,%esp
+  800497:	68 60 39 80 00       	push   $0x803960
+  80049c:	6a 22                	push   $0x22
+  80049e:	68 c5 37 80 00       	push   $0x8037c5
+  8004a3:	e8 49 02 00 00       	call   8006f1 <_panic>
+  8004a8:	50                   	push   %eax
+  8004a9:	68 de 37 80 00       	push   $0x8037de
+  8004ae:	6a 25                	push   $0x25
+  8004b0:	68 c5 37 80 00       	push   $0x8037c5
+  8004b5:	e8 37 02 00 00       	call   8006f1 <_panic>
+  8004ba:	83 ec 04             	sub    $0x4,%esp
+  8004bd:	68 84 39 80 00       	push   $0x803984
+  8004c2:	6a 27                	push   $0x27
+  8004c4:	68 c5 37 80 00       	push   $0x8037c5
+  8004c9:	e8 23 02 00 00       	call   8006f1 <_panic>
+  8004ce:	50                   	push   %eax
+  8004cf:	68 0a 38 80 00       	push   $0x80380a
+  8004d4:	6a 2b                	push   $0x2b
+  8004d6:	68 c5 37 80 00       	push   $0x8037c5
+  8004db:	e8 11 02 00 00       	call   8006f1 <_panic>
+  8004e0:	83 ec 0c             	sub    $0xc,%esp
+  8004e3:	ff 35 00 50 80 00    	push   0x805000
+  8004e9:	e8 89 09 00 00       	call   800e77 <strlen>
+  8004ee:	89 04 24             	mov    %eax,(%esp)
+  8004f1:	ff 75 cc             	push   -0x34(%ebp)
+  8004f4:	68 b4 39 80 00       	push   $0x8039b4
+  8004f9:	6a 2d                	push   $0x2d
+  8004fb:	68 c5 37 80 00       	push   $0x8037c5
+  800500:	e8 ec 01 00 00       	call   8006f1 <_panic>
+  800505:	50                   	push   %eax
+  800506:	68 2b 38 80 00       	push   $0x80382b
+  80050b:	6a 32                	push   $0x32
+  80050d:	68 c5 37 80 00       	push   $0x8037c5
+  800512:	e8 da 01 00 00       	call   8006f1 <_panic>
+  800517:	83 ec 04             	sub    $0x4,%esp
+  80051a:	68 39 38 80 00       	push   $0x803839
+  80051f:	6a 34                	push   $0x34
+  800521:	68 c5 37 80 00       	push   $0x8037c5
+  800526:	e8 c6 01 00 00       	call   8006f1 <_panic>
+  80052b:	50                   	push   %eax
+  80052c:	68 6a 38 80 00       	push   $0x80386a
+  800531:	6a 38                	push   $0x38
+  800533:	68 c5 37 80 00       	push   $0x8037c5
+  800538:	e8 b4 01 00 00       	call   8006f1 <_panic>
+  80053d:	50                   	push   %eax
+  80053e:	68 dc 39 80 00       	push   $0x8039dc
+  800543:	6a 43                	push   $0x43
+  800545:	68 c5 37 80 00       	push   $0x8037c5
+  80054a:	e8 a2 01 00 00       	call   8006f1 <_panic>
+  80054f:	50                   	push   %eax
+  800550:	68 ad 38 80 00       	push   $0x8038ad
+  800555:	6a 48                	push   $0x48
+  800557:	68 c5 37 80 00       	push   $0x8037c5
+  80055c:	e8 90 01 00 00       	call   8006f1 <_panic>
+  800561:	53                   	push   %ebx
+  800562:	68 c6 38 80 00       	push   $0x8038c6
+  800567:	6a 4b                	push   $0x4b
+  800569:	68 c5 37 80 00       	push   $0x8037c5
+  80056e:	e8 7e 01 00 00       	call   8006f1 <_panic>
+  800573:	50                   	push   %eax
+  800574:	68 14 3a 80 00       	push   $0x803a14
+  800579:	6a 51                	push   $0x51
+  80057b:	68 c5 37 80 00       	push   $0x8037c5
+  800580:	e8 6c 01 00 00       	call   8006f1 <_panic>
+  800585:	53                   	push   %ebx
+  800586:	68 34 3a 80 00       	push   $0x803a34
+  80058b:	6a 53                	push   $0x53
+  80058d:	68 c5 37 80 00       	push   $0x8037c5
+  800592:	e8 5a 01 00 00       	call   8006f1 <_panic>
+  800597:	83 ec 04             	sub    $0x4,%esp
+  80059a:	68 6c 3a 80 00       	push   $0x803a6c
+  80059f:	6a 55                	push   $0x55
+  8005a1:	68 c5 37 80 00       	push   $0x8037c5
+  8005a6:	e8 46 01 00 00       	call   8006f1 <_panic>
+  8005ab:	50                   	push   %eax
+  8005ac:	68 b1 37 80 00       	push   $0x8037b1
+  8005b1:	6a 5a                	push   $0x5a
+  8005b3:	68 c5 37 80 00       	push   $0x8037c5
+  8005b8:	e8 34 01 00 00       	call   8006f1 <_panic>
+  8005bd:	83 ec 04             	sub    $0x4,%esp
+  8005c0:	68 e9 38 80 00       	push   $0x8038e9
+  8005c5:	6a 5c                	push   $0x5c
+  8005c7:	68 c5 37 80 00       	push   $0x8037c5
+  8005cc:	e8 20 01 00 00       	call   8006f1 <_panic>
+  8005d1:	50                   	push   %eax
+  8005d2:	68 e4 37 80 00       	push   $0x8037e4
+  8005d7:	6a 5f                	push   $0x5f
+  8005d9:	68 c5 37 80 00       	push   $0x8037c5
+  8005de:	e8 0e 01 00 00       	call   8006f1 <_panic>
+  8005e3:	83 ec 04             	sub    $0x4,%esp
+  8005e6:	68 c0 3a 80 00       	push   $0x803ac0
+  8005eb:	6a 62                	push   $0x62
+  8005ed:	68 c5 37 80 00       	push   $0x8037c5
+  8005f2:	e8 fa 00 00 00       	call   8006f1 <_panic>
+  8005f7:	50                   	push   %eax
+  8005f8:	68 09 39 80 00       	push   $0x803909
+  8005fd:	6a 67                	push   $0x67
+  8005ff:	68 c5 37 80 00       	push   $0x8037c5
+  800604:	e8 e8 00 00 00       	call   8006f1 <_panic>
+  800609:	83 ec 0c             	sub    $0xc,%esp
+  80060c:	50                   	push   %eax
+  80060d:	56                   	push   %esi
+  80060e:	68 18 39 80 00       	push   $0x803918
+  800613:	6a 6c                	push   $0x6c
+  800615:	68 c5 37 80 00       	push   $0x8037c5
+  80061a:	e8 d2 00 00 00       	call   8006f1 <_panic>
+  80061f:	50                   	push   %eax
+  800620:	68 2a 39 80 00       	push   $0x80392a
+  800625:	6a 71                	push   $0x71
+  800627:	68 c5 37 80 00       	push   $0x8037c5
+  80062c:	e8 c0 00 00 00       	call   8006f1 <_panic>
+  800631:	83 ec 0c             	sub    $0xc,%esp
+  800634:	50                   	push   %eax
+  800635:	53                   	push   %ebx
+  800636:	68 38 39 80 00       	push   $0x803938
+  80063b:	6a 75                	push   $0x75
+  80063d:	68 c5 37 80 00       	push   $0x8037c5
+  800642:	e8 aa 00 00 00       	call   8006f1 <_panic>
+  800647:	83 ec 08             	sub    $0x8,%esp
+  80064a:	68 00 02 00 00       	push   $0x200
+  80064f:	50                   	push   %eax
+  800650:	53                   	push   %ebx
+  800651:	68 e8 3a 80 00       	push   $0x803ae8
+  800656:	6a 77                	push   $0x77
+  800658:	68 c5 37 80 00       	push   $0x8037c5
+  80065d:	e8 8f 00 00 00       	call   8006f1 <_panic>
+  800662:	83 ec 0c             	sub    $0xc,%esp
+  800665:	50                   	push   %eax
+  800666:	53                   	push   %ebx
+  800667:	68 14 3b 80 00       	push   $0x803b14
+  80066c:	6a 7a                	push   $0x7a
+  80066e:	68 c5 37 80 00       	push   $0x8037c5
+  800673:	e8 79 00 00 00       	call   8006f1 <_panic>
+
+00800678 <libmain>:
+  800678:	55                   	push   %ebp
+  800679:	89 e5                	mov    %esp,%ebp
+  80067b:	56                   	push   %esi
+  80067c:	53                   	push   %ebx
+  80067d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800680:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800683:	e8 31 0c 00 00       	call   8012b9 <sys_getenvid>
+  800688:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80068d:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800693:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800698:	a3 10 60 80 00       	mov    %eax,0x806010
+  80069d:	85 db                	test   %ebx,%ebx
+  80069f:	7e 07                	jle    8006a8 <libmain+0x30>
+  8006a1:	8b 06                	mov    (%esi),%eax
+  8006a3:	a3 04 50 80 00       	mov    %eax,0x805004
+  8006a8:	83 ec 08             	sub    $0x8,%esp
+  8006ab:	56                   	push   %esi
+  8006ac:	53                   	push   %ebx
+  8006ad:	e8 c5 f9 ff ff       	call   800077 <umain>
+  8006b2:	e8 0a 00 00 00       	call   8006c1 <exit>
+  8006b7:	83 c4 10             	add    $0x10,%esp
+  8006ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006bd:	5b                   	pop    %ebx
+  8006be:	5e                   	pop    %esi
+  8006bf:	5d                   	pop    %ebp
+  8006c0:	c3                   	ret
+
+008006c1 <exit>:
+  8006c1:	55                   	push   %ebp
+  8006c2:	89 e5                	mov    %esp,%ebp
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	a1 10 60 80 00       	mov    0x806010,%eax
+  8006cc:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8006d2:	85 c0                	test   %eax,%eax
+  8006d4:	75 14                	jne    8006ea <exit+0x29>
+  8006d6:	e8 ed 18 00 00       	call   801fc8 <close_all>
+  8006db:	83 ec 0c             	sub    $0xc,%esp
+  8006de:	6a 00                	push   $0x0
+  8006e0:	e8 93 0b 00 00       	call   801278 <sys_env_destroy>
+  8006e5:	83 c4 10             	add    $0x10,%esp
+  8006e8:	c9                   	leave
+  8006e9:	c3                   	ret
+  8006ea:	e8 f6 12 00 00       	call   8019e5 <sys_lease_complete>
+  8006ef:	eb e5                	jmp    8006d6 <exit+0x15>
+
+008006f1 <_panic>:
+  8006f1:	55                   	push   %ebp
+  8006f2:	89 e5                	mov    %esp,%ebp
+  8006f4:	56                   	push   %esi
+  8006f5:	53                   	push   %ebx
+  8006f6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8006f9:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  8006ff:	e8 b5 0b 00 00       	call   8012b9 <sys_getenvid>
+  800704:	83 ec 0c             	sub    $0xc,%esp
+  800707:	ff 75 0c             	push   0xc(%ebp)
+  80070a:	ff 75 08             	push   0x8(%ebp)
+  80070d:	56                   	push   %esi
+  80070e:	50                   	push   %eax
+  80070f:	68 6c 3b 80 00       	push   $0x803b6c
+  800714:	e8 b3 00 00 00       	call   8007cc <cprintf>
+  800719:	83 c4 18             	add    $0x18,%esp
+  80071c:	53                   	push   %ebx
+  80071d:	ff 75 10             	push   0x10(%ebp)
+  800720:	e8 56 00 00 00       	call   80077b <vcprintf>
+  800725:	c7 04 24 3a 40 80 00 	movl   $0x80403a,(%esp)
+  80072c:	e8 9b 00 00 00       	call   8007cc <cprintf>
+  800731:	83 c4 10             	add    $0x10,%esp
+  800734:	cc                   	int3
+  800735:	eb fd                	jmp    800734 <_panic+0x43>
+
+00800737 <putch>:
+  800737:	55                   	push   %ebp
+  800738:	89 e5                	mov    %esp,%ebp
+  80073a:	53                   	push   %ebx
+  80073b:	83 ec 04             	sub    $0x4,%esp
+  80073e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800741:	8b 13                	mov    (%ebx),%edx
+  800743:	8d 42 01             	lea    0x1(%edx),%eax
+  800746:	89 03                	mov    %eax,(%ebx)
+  800748:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80074b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80074f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800754:	74 09                	je     80075f <putch+0x28>
+  800756:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80075a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80075d:	c9                   	leave
+  80075e:	c3                   	ret
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	68 ff 00 00 00       	push   $0xff
+  800767:	8d 43 08             	lea    0x8(%ebx),%eax
+  80076a:	50                   	push   %eax
+  80076b:	e8 cb 0a 00 00       	call   80123b <sys_cputs>
+  800770:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800776:	83 c4 10             	add    $0x10,%esp
+  800779:	eb db                	jmp    800756 <putch+0x1f>
+
+0080077b <vcprintf>:
+  80077b:	55                   	push   %ebp
+  80077c:	89 e5                	mov    %esp,%ebp
+  80077e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800784:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80078b:	00 00 00 
+  80078e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800795:	00 00 00 
+  800798:	ff 75 0c             	push   0xc(%ebp)
+  80079b:	ff 75 08             	push   0x8(%ebp)
+  80079e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8007a4:	50                   	push   %eax
+  8007a5:	68 37 07 80 00       	push   $0x800737
+  8007aa:	e8 1c 01 00 00       	call   8008cb <vprintfmt>
+  8007af:	83 c4 08             	add    $0x8,%esp
+  8007b2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007b8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007be:	50                   	push   %eax
+  8007bf:	e8 77 0a 00 00       	call   80123b <sys_cputs>
+  8007c4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8007ca:	c9                   	leave
+  8007cb:	c3                   	ret
+
+008007cc <cprintf>:
+  8007cc:	55                   	push   %ebp
+  8007cd:	89 e5                	mov    %esp,%ebp
+  8007cf:	83 ec 10             	sub    $0x10,%esp
+  8007d2:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8007d5:	50                   	push   %eax
+  8007d6:	ff 75 08             	push   0x8(%ebp)
+  8007d9:	e8 9d ff ff ff       	call   80077b <vcprintf>
+  8007de:	c9                   	leave
+  8007df:	c3                   	ret
+
+008007e0 <printnum>:
+  8007e0:	55                   	push   %ebp
+  8007e1:	89 e5                	mov    %esp,%ebp
+  8007e3:	57                   	push   %edi
+  8007e4:	56                   	push   %esi
+  8007e5:	53                   	push   %ebx
+  8007e6:	83 ec 1c             	sub    $0x1c,%esp
+  8007e9:	89 c3                	mov    %eax,%ebx
+  8007eb:	89 d6                	mov    %edx,%esi
+  8007ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f3:	89 d1                	mov    %edx,%ecx
+  8007f5:	89 c2                	mov    %eax,%edx
+  8007f7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007fa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  800800:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800803:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80080a:	39 c2                	cmp    %eax,%edx
+  80080c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80080f:	73 4b                	jae    80085c <printnum+0x7c>
+  800811:	8b 45 14             	mov    0x14(%ebp),%eax
+  800814:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800817:	85 ff                	test   %edi,%edi
+  800819:	7e 11                	jle    80082c <printnum+0x4c>
+  80081b:	83 ec 08             	sub    $0x8,%esp
+  80081e:	56                   	push   %esi
+  80081f:	ff 75 18             	push   0x18(%ebp)
+  800822:	ff d3                	call   *%ebx
+  800824:	83 c4 10             	add    $0x10,%esp
+  800827:	83 ef 01             	sub    $0x1,%edi
+  80082a:	75 ef                	jne    80081b <printnum+0x3b>
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  80082f:	56                   	push   %esi
+  800830:	83 ec 04             	sub    $0x4,%esp
+  800833:	ff 75 e4             	push   -0x1c(%ebp)
+  800836:	ff 75 e0             	push   -0x20(%ebp)
+  800839:	ff 75 dc             	push   -0x24(%ebp)
+  80083c:	ff 75 d8             	push   -0x28(%ebp)
+  80083f:	e8 50 2e 00 00       	call   803694 <__umoddi3>
+  800844:	83 c4 14             	add    $0x14,%esp
+  800847:	0f be 80 8f 3b 80 00 	movsbl 0x803b8f(%eax),%eax
+  80084e:	50                   	push   %eax
+  80084f:	ff d3                	call   *%ebx
+  800851:	83 c4 10             	add    $0x10,%esp
+  800854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800857:	5b                   	pop    %ebx
+  800858:	5e                   	pop    %esi
+  800859:	5f                   	pop    %edi
+  80085a:	5d                   	pop    %ebp
+  80085b:	c3                   	ret
+  80085c:	83 ec 0c             	sub    $0xc,%esp
+  80085f:	ff 75 18             	push   0x18(%ebp)
+  800862:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800865:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800868:	52                   	push   %edx
+  800869:	50                   	push   %eax
+  80086a:	83 ec 08             	sub    $0x8,%esp
+  80086d:	ff 75 e4             	push   -0x1c(%ebp)
+  800870:	ff 75 e0             	push   -0x20(%ebp)
+  800873:	ff 75 dc             	push   -0x24(%ebp)
+  800876:	ff 75 d8             	push   -0x28(%ebp)
+  800879:	e8 f8 2d 00 00       	call   803676 <__udivdi3>
+  80087e:	83 c4 18             	add    $0x18,%esp
+  800881:	52                   	push   %edx
+  800882:	50                   	push   %eax
+  800883:	89 f2                	mov    %esi,%edx
+  800885:	89 d8                	mov    %ebx,%eax
+  800887:	e8 54 ff ff ff       	call   8007e0 <printnum>
+  80088c:	83 c4 20             	add    $0x20,%esp
+  80088f:	eb 9b                	jmp    80082c <printnum+0x4c>
+
+00800891 <sprintputch>:
+  800891:	55                   	push   %ebp
+  800892:	89 e5                	mov    %esp,%ebp
+  800894:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800897:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80089b:	8b 10                	mov    (%eax),%edx
+  80089d:	3b 50 04             	cmp    0x4(%eax),%edx
+  8008a0:	73 0a                	jae    8008ac <sprintputch+0x1b>
+  8008a2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8008a5:	89 08                	mov    %ecx,(%eax)
+  8008a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008aa:	88 02                	mov    %al,(%edx)
+  8008ac:	5d                   	pop    %ebp
+  8008ad:	c3                   	ret
+
+008008ae <printfmt>:
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	83 ec 08             	sub    $0x8,%esp
+  8008b4:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008b7:	50                   	push   %eax
+  8008b8:	ff 75 10             	push   0x10(%ebp)
+  8008bb:	ff 75 0c             	push   0xc(%ebp)
+  8008be:	ff 75 08             	push   0x8(%ebp)
+  8008c1:	e8 05 00 00 00       	call   8008cb <vprintfmt>
+  8008c6:	83 c4 10             	add    $0x10,%esp
+  8008c9:	c9                   	leave
+  8008ca:	c3                   	ret
+
+008008cb <vprintfmt>:
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	57                   	push   %edi
+  8008cf:	56                   	push   %esi
+  8008d0:	53                   	push   %ebx
+  8008d1:	83 ec 2c             	sub    $0x2c,%esp
+  8008d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008d7:	89 df                	mov    %ebx,%edi
+  8008d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8008df:	8d 70 01             	lea    0x1(%eax),%esi
+  8008e2:	0f b6 00             	movzbl (%eax),%eax
+  8008e5:	83 f8 25             	cmp    $0x25,%eax
+  8008e8:	74 1e                	je     800908 <vprintfmt+0x3d>
+  8008ea:	85 c0                	test   %eax,%eax
+  8008ec:	0f 84 15 05 00 00    	je     800e07 <vprintfmt+0x53c>
+  8008f2:	83 ec 08             	sub    $0x8,%esp
+  8008f5:	53                   	push   %ebx
+  8008f6:	50                   	push   %eax
+  8008f7:	ff d7                	call   *%edi
+  8008f9:	83 c6 01             	add    $0x1,%esi
+  8008fc:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800900:	83 c4 10             	add    $0x10,%esp
+  800903:	83 f8 25             	cmp    $0x25,%eax
+  800906:	75 e2                	jne    8008ea <vprintfmt+0x1f>
+  800908:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80090c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800913:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80091a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800921:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800926:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800929:	8d 56 01             	lea    0x1(%esi),%edx
+  80092c:	0f b6 0e             	movzbl (%esi),%ecx
+  80092f:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800932:	3c 55                	cmp    $0x55,%al
+  800934:	0f 87 3b 04 00 00    	ja     800d75 <vprintfmt+0x4aa>
+  80093a:	0f b6 c0             	movzbl %al,%eax
+  80093d:	ff 24 85 e0 3c 80 00 	jmp    *0x803ce0(,%eax,4)
+  800944:	89 75 10             	mov    %esi,0x10(%ebp)
+  800947:	eb 93                	jmp    8008dc <vprintfmt+0x11>
+  800949:	89 d6                	mov    %edx,%esi
+  80094b:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80094f:	eb d8                	jmp    800929 <vprintfmt+0x5e>
+  800951:	89 d6                	mov    %edx,%esi
+  800953:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800957:	eb d0                	jmp    800929 <vprintfmt+0x5e>
+  800959:	0f b6 c9             	movzbl %cl,%ecx
+  80095c:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80095f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800962:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800966:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800969:	83 f9 09             	cmp    $0x9,%ecx
+  80096c:	77 6f                	ja     8009dd <vprintfmt+0x112>
+  80096e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800971:	83 c2 01             	add    $0x1,%edx
+  800974:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800977:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80097b:	0f be 02             	movsbl (%edx),%eax
+  80097e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800981:	83 fe 09             	cmp    $0x9,%esi
+  800984:	76 eb                	jbe    800971 <vprintfmt+0xa6>
+  800986:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800989:	89 d6                	mov    %edx,%esi
+  80098b:	eb 13                	jmp    8009a0 <vprintfmt+0xd5>
+  80098d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800990:	8b 00                	mov    (%eax),%eax
+  800992:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800995:	8b 45 14             	mov    0x14(%ebp),%eax
+  800998:	8d 40 04             	lea    0x4(%eax),%eax
+  80099b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80099e:	89 d6                	mov    %edx,%esi
+  8009a0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009a4:	79 83                	jns    800929 <vprintfmt+0x5e>
+  8009a6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8009a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009ac:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8009b3:	e9 71 ff ff ff       	jmp    800929 <vprintfmt+0x5e>
+  8009b8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009bb:	85 c9                	test   %ecx,%ecx
+  8009bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c2:	0f 49 c1             	cmovns %ecx,%eax
+  8009c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009c8:	89 d6                	mov    %edx,%esi
+  8009ca:	e9 5a ff ff ff       	jmp    800929 <vprintfmt+0x5e>
+  8009cf:	89 d6                	mov    %edx,%esi
+  8009d1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8009d8:	e9 4c ff ff ff       	jmp    800929 <vprintfmt+0x5e>
+  8009dd:	89 d6                	mov    %edx,%esi
+  8009df:	eb bf                	jmp    8009a0 <vprintfmt+0xd5>
+  8009e1:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8009e5:	89 d6                	mov    %edx,%esi
+  8009e7:	e9 3d ff ff ff       	jmp    800929 <vprintfmt+0x5e>
+  8009ec:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f2:	8d 70 04             	lea    0x4(%eax),%esi
+  8009f5:	83 ec 08             	sub    $0x8,%esp
+  8009f8:	53                   	push   %ebx
+  8009f9:	ff 30                	push   (%eax)
+  8009fb:	ff d7                	call   *%edi
+  8009fd:	83 c4 10             	add    $0x10,%esp
+  800a00:	89 75 14             	mov    %esi,0x14(%ebp)
+  800a03:	e9 d4 fe ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800a08:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0e:	8d 70 04             	lea    0x4(%eax),%esi
+  800a11:	8b 10                	mov    (%eax),%edx
+  800a13:	89 d0                	mov    %edx,%eax
+  800a15:	f7 d8                	neg    %eax
+  800a17:	0f 48 c2             	cmovs  %edx,%eax
+  800a1a:	83 f8 12             	cmp    $0x12,%eax
+  800a1d:	7f 23                	jg     800a42 <vprintfmt+0x177>
+  800a1f:	8b 14 85 40 3e 80 00 	mov    0x803e40(,%eax,4),%edx
+  800a26:	85 d2                	test   %edx,%edx
+  800a28:	74 18                	je     800a42 <vprintfmt+0x177>
+  800a2a:	52                   	push   %edx
+  800a2b:	68 07 40 80 00       	push   $0x804007
+  800a30:	53                   	push   %ebx
+  800a31:	57                   	push   %edi
+  800a32:	e8 77 fe ff ff       	call   8008ae <printfmt>
+  800a37:	83 c4 10             	add    $0x10,%esp
+  800a3a:	89 75 14             	mov    %esi,0x14(%ebp)
+  800a3d:	e9 9a fe ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800a42:	50                   	push   %eax
+  800a43:	68 a7 3b 80 00       	push   $0x803ba7
+  800a48:	53                   	push   %ebx
+  800a49:	57                   	push   %edi
+  800a4a:	e8 5f fe ff ff       	call   8008ae <printfmt>
+  800a4f:	83 c4 10             	add    $0x10,%esp
+  800a52:	89 75 14             	mov    %esi,0x14(%ebp)
+  800a55:	e9 82 fe ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800a5a:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a60:	83 c0 04             	add    $0x4,%eax
+  800a63:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800a66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a69:	8b 00                	mov    (%eax),%eax
+  800a6b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800a6e:	85 c0                	test   %eax,%eax
+  800a70:	0f 84 61 03 00 00    	je     800dd7 <vprintfmt+0x50c>
+  800a76:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a7a:	7e 06                	jle    800a82 <vprintfmt+0x1b7>
+  800a7c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a80:	75 29                	jne    800aab <vprintfmt+0x1e0>
+  800a82:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a85:	8d 70 01             	lea    0x1(%eax),%esi
+  800a88:	0f b6 00             	movzbl (%eax),%eax
+  800a8b:	0f be d0             	movsbl %al,%edx
+  800a8e:	85 d2                	test   %edx,%edx
+  800a90:	0f 84 bb 00 00 00    	je     800b51 <vprintfmt+0x286>
+  800a96:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a99:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a9c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a9f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800aa2:	eb 7a                	jmp    800b1e <vprintfmt+0x253>
+  800aa4:	c7 45 d0 a0 3b 80 00 	movl   $0x803ba0,-0x30(%ebp)
+  800aab:	83 ec 08             	sub    $0x8,%esp
+  800aae:	ff 75 d4             	push   -0x2c(%ebp)
+  800ab1:	ff 75 d0             	push   -0x30(%ebp)
+  800ab4:	e8 e0 03 00 00       	call   800e99 <strnlen>
+  800ab9:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800abc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800abf:	83 c4 10             	add    $0x10,%esp
+  800ac2:	85 d2                	test   %edx,%edx
+  800ac4:	0f 8e d6 02 00 00    	jle    800da0 <vprintfmt+0x4d5>
+  800aca:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800ace:	83 ec 08             	sub    $0x8,%esp
+  800ad1:	53                   	push   %ebx
+  800ad2:	56                   	push   %esi
+  800ad3:	ff d7                	call   *%edi
+  800ad5:	83 c4 10             	add    $0x10,%esp
+  800ad8:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800adc:	75 f0                	jne    800ace <vprintfmt+0x203>
+  800ade:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ae1:	8d 70 01             	lea    0x1(%eax),%esi
+  800ae4:	0f b6 00             	movzbl (%eax),%eax
+  800ae7:	0f be d0             	movsbl %al,%edx
+  800aea:	85 d2                	test   %edx,%edx
+  800aec:	0f 84 da 02 00 00    	je     800dcc <vprintfmt+0x501>
+  800af2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800af5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800af8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800afb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800afe:	eb 1e                	jmp    800b1e <vprintfmt+0x253>
+  800b00:	83 ec 08             	sub    $0x8,%esp
+  800b03:	ff 75 0c             	push   0xc(%ebp)
+  800b06:	52                   	push   %edx
+  800b07:	ff 55 08             	call   *0x8(%ebp)
+  800b0a:	83 c4 10             	add    $0x10,%esp
+  800b0d:	83 eb 01             	sub    $0x1,%ebx
+  800b10:	83 c6 01             	add    $0x1,%esi
+  800b13:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800b17:	0f be d0             	movsbl %al,%edx
+  800b1a:	85 d2                	test   %edx,%edx
+  800b1c:	74 2a                	je     800b48 <vprintfmt+0x27d>
+  800b1e:	85 ff                	test   %edi,%edi
+  800b20:	78 05                	js     800b27 <vprintfmt+0x25c>
+  800b22:	83 ef 01             	sub    $0x1,%edi
+  800b25:	78 59                	js     800b80 <vprintfmt+0x2b5>
+  800b27:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800b2b:	74 d3                	je     800b00 <vprintfmt+0x235>
+  800b2d:	0f be c0             	movsbl %al,%eax
+  800b30:	83 e8 20             	sub    $0x20,%eax
+  800b33:	83 f8 5e             	cmp    $0x5e,%eax
+  800b36:	76 c8                	jbe    800b00 <vprintfmt+0x235>
+  800b38:	83 ec 08             	sub    $0x8,%esp
+  800b3b:	ff 75 0c             	push   0xc(%ebp)
+  800b3e:	6a 3f                	push   $0x3f
+  800b40:	ff 55 08             	call   *0x8(%ebp)
+  800b43:	83 c4 10             	add    $0x10,%esp
+  800b46:	eb c5                	jmp    800b0d <vprintfmt+0x242>
+  800b48:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b4b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b4e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b51:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800b54:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b58:	7e 1b                	jle    800b75 <vprintfmt+0x2aa>
+  800b5a:	83 ec 08             	sub    $0x8,%esp
+  800b5d:	53                   	push   %ebx
+  800b5e:	6a 20                	push   $0x20
+  800b60:	ff d7                	call   *%edi
+  800b62:	83 c4 10             	add    $0x10,%esp
+  800b65:	83 ee 01             	sub    $0x1,%esi
+  800b68:	75 f0                	jne    800b5a <vprintfmt+0x28f>
+  800b6a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b6d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b70:	e9 67 fd ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800b75:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b78:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b7b:	e9 5c fd ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800b80:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b89:	eb c6                	jmp    800b51 <vprintfmt+0x286>
+  800b8b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b8e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b91:	83 f9 01             	cmp    $0x1,%ecx
+  800b94:	7f 1f                	jg     800bb5 <vprintfmt+0x2ea>
+  800b96:	85 c9                	test   %ecx,%ecx
+  800b98:	74 67                	je     800c01 <vprintfmt+0x336>
+  800b9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9d:	8b 30                	mov    (%eax),%esi
+  800b9f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800ba2:	89 f0                	mov    %esi,%eax
+  800ba4:	c1 f8 1f             	sar    $0x1f,%eax
+  800ba7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800baa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bad:	8d 40 04             	lea    0x4(%eax),%eax
+  800bb0:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bb3:	eb 17                	jmp    800bcc <vprintfmt+0x301>
+  800bb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb8:	8b 50 04             	mov    0x4(%eax),%edx
+  800bbb:	8b 00                	mov    (%eax),%eax
+  800bbd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bc0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800bc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc6:	8d 40 08             	lea    0x8(%eax),%eax
+  800bc9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bcc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800bcf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bd2:	be 0a 00 00 00       	mov    $0xa,%esi
+  800bd7:	85 c9                	test   %ecx,%ecx
+  800bd9:	0f 89 12 01 00 00    	jns    800cf1 <vprintfmt+0x426>
+  800bdf:	83 ec 08             	sub    $0x8,%esp
+  800be2:	53                   	push   %ebx
+  800be3:	6a 2d                	push   $0x2d
+  800be5:	ff d7                	call   *%edi
+  800be7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800bea:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bed:	f7 da                	neg    %edx
+  800bef:	83 d1 00             	adc    $0x0,%ecx
+  800bf2:	f7 d9                	neg    %ecx
+  800bf4:	83 c4 10             	add    $0x10,%esp
+  800bf7:	be 0a 00 00 00       	mov    $0xa,%esi
+  800bfc:	e9 f0 00 00 00       	jmp    800cf1 <vprintfmt+0x426>
+  800c01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c04:	8b 30                	mov    (%eax),%esi
+  800c06:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800c09:	89 f0                	mov    %esi,%eax
+  800c0b:	c1 f8 1f             	sar    $0x1f,%eax
+  800c0e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800c11:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c14:	8d 40 04             	lea    0x4(%eax),%eax
+  800c17:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c1a:	eb b0                	jmp    800bcc <vprintfmt+0x301>
+  800c1c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c1f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c22:	83 f9 01             	cmp    $0x1,%ecx
+  800c25:	7f 1e                	jg     800c45 <vprintfmt+0x37a>
+  800c27:	85 c9                	test   %ecx,%ecx
+  800c29:	74 32                	je     800c5d <vprintfmt+0x392>
+  800c2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c2e:	8b 10                	mov    (%eax),%edx
+  800c30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c35:	8d 40 04             	lea    0x4(%eax),%eax
+  800c38:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c3b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800c40:	e9 ac 00 00 00       	jmp    800cf1 <vprintfmt+0x426>
+  800c45:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c48:	8b 10                	mov    (%eax),%edx
+  800c4a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c4d:	8d 40 08             	lea    0x8(%eax),%eax
+  800c50:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c53:	be 0a 00 00 00       	mov    $0xa,%esi
+  800c58:	e9 94 00 00 00       	jmp    800cf1 <vprintfmt+0x426>
+  800c5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c60:	8b 10                	mov    (%eax),%edx
+  800c62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c67:	8d 40 04             	lea    0x4(%eax),%eax
+  800c6a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c6d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800c72:	eb 7d                	jmp    800cf1 <vprintfmt+0x426>
+  800c74:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c77:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c7a:	83 f9 01             	cmp    $0x1,%ecx
+  800c7d:	7f 1b                	jg     800c9a <vprintfmt+0x3cf>
+  800c7f:	85 c9                	test   %ecx,%ecx
+  800c81:	74 2c                	je     800caf <vprintfmt+0x3e4>
+  800c83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c86:	8b 10                	mov    (%eax),%edx
+  800c88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8d:	8d 40 04             	lea    0x4(%eax),%eax
+  800c90:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c93:	be 08 00 00 00       	mov    $0x8,%esi
+  800c98:	eb 57                	jmp    800cf1 <vprintfmt+0x426>
+  800c9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c9d:	8b 10                	mov    (%eax),%edx
+  800c9f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ca2:	8d 40 08             	lea    0x8(%eax),%eax
+  800ca5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ca8:	be 08 00 00 00       	mov    $0x8,%esi
+  800cad:	eb 42                	jmp    800cf1 <vprintfmt+0x426>
+  800caf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cb2:	8b 10                	mov    (%eax),%edx
+  800cb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb9:	8d 40 04             	lea    0x4(%eax),%eax
+  800cbc:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cbf:	be 08 00 00 00       	mov    $0x8,%esi
+  800cc4:	eb 2b                	jmp    800cf1 <vprintfmt+0x426>
+  800cc6:	89 55 10             	mov    %edx,0x10(%ebp)
+  800cc9:	83 ec 08             	sub    $0x8,%esp
+  800ccc:	53                   	push   %ebx
+  800ccd:	6a 30                	push   $0x30
+  800ccf:	ff d7                	call   *%edi
+  800cd1:	83 c4 08             	add    $0x8,%esp
+  800cd4:	53                   	push   %ebx
+  800cd5:	6a 78                	push   $0x78
+  800cd7:	ff d7                	call   *%edi
+  800cd9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cdc:	8b 10                	mov    (%eax),%edx
+  800cde:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce3:	83 c4 10             	add    $0x10,%esp
+  800ce6:	8d 40 04             	lea    0x4(%eax),%eax
+  800ce9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cec:	be 10 00 00 00       	mov    $0x10,%esi
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  800cf4:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800cf8:	50                   	push   %eax
+  800cf9:	ff 75 e4             	push   -0x1c(%ebp)
+  800cfc:	56                   	push   %esi
+  800cfd:	51                   	push   %ecx
+  800cfe:	52                   	push   %edx
+  800cff:	89 da                	mov    %ebx,%edx
+  800d01:	89 f8                	mov    %edi,%eax
+  800d03:	e8 d8 fa ff ff       	call   8007e0 <printnum>
+  800d08:	83 c4 20             	add    $0x20,%esp
+  800d0b:	e9 cc fb ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800d10:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800d13:	89 55 10             	mov    %edx,0x10(%ebp)
+  800d16:	83 f9 01             	cmp    $0x1,%ecx
+  800d19:	7f 1b                	jg     800d36 <vprintfmt+0x46b>
+  800d1b:	85 c9                	test   %ecx,%ecx
+  800d1d:	74 2c                	je     800d4b <vprintfmt+0x480>
+  800d1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d22:	8b 10                	mov    (%eax),%edx
+  800d24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d29:	8d 40 04             	lea    0x4(%eax),%eax
+  800d2c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d2f:	be 10 00 00 00       	mov    $0x10,%esi
+  800d34:	eb bb                	jmp    800cf1 <vprintfmt+0x426>
+  800d36:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d39:	8b 10                	mov    (%eax),%edx
+  800d3b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d3e:	8d 40 08             	lea    0x8(%eax),%eax
+  800d41:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d44:	be 10 00 00 00       	mov    $0x10,%esi
+  800d49:	eb a6                	jmp    800cf1 <vprintfmt+0x426>
+  800d4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d4e:	8b 10                	mov    (%eax),%edx
+  800d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d55:	8d 40 04             	lea    0x4(%eax),%eax
+  800d58:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d5b:	be 10 00 00 00       	mov    $0x10,%esi
+  800d60:	eb 8f                	jmp    800cf1 <vprintfmt+0x426>
+  800d62:	89 55 10             	mov    %edx,0x10(%ebp)
+  800d65:	83 ec 08             	sub    $0x8,%esp
+  800d68:	53                   	push   %ebx
+  800d69:	6a 25                	push   $0x25
+  800d6b:	ff d7                	call   *%edi
+  800d6d:	83 c4 10             	add    $0x10,%esp
+  800d70:	e9 67 fb ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800d75:	83 ec 08             	sub    $0x8,%esp
+  800d78:	53                   	push   %ebx
+  800d79:	6a 25                	push   $0x25
+  800d7b:	ff d7                	call   *%edi
+  800d7d:	83 c4 10             	add    $0x10,%esp
+  800d80:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800d84:	0f 84 ba fb ff ff    	je     800944 <vprintfmt+0x79>
+  800d8a:	89 75 10             	mov    %esi,0x10(%ebp)
+  800d8d:	89 f0                	mov    %esi,%eax
+  800d8f:	83 e8 01             	sub    $0x1,%eax
+  800d92:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d96:	75 f7                	jne    800d8f <vprintfmt+0x4c4>
+  800d98:	89 45 10             	mov    %eax,0x10(%ebp)
+  800d9b:	e9 3c fb ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800da0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800da3:	8d 70 01             	lea    0x1(%eax),%esi
+  800da6:	0f b6 00             	movzbl (%eax),%eax
+  800da9:	0f be d0             	movsbl %al,%edx
+  800dac:	85 d2                	test   %edx,%edx
+  800dae:	74 11                	je     800dc1 <vprintfmt+0x4f6>
+  800db0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800db3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800db6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800db9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800dbc:	e9 5d fd ff ff       	jmp    800b1e <vprintfmt+0x253>
+  800dc1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800dc4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800dc7:	e9 10 fb ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800dcc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800dcf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800dd2:	e9 05 fb ff ff       	jmp    8008dc <vprintfmt+0x11>
+  800dd7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800ddb:	7e 0a                	jle    800de7 <vprintfmt+0x51c>
+  800ddd:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800de1:	0f 85 bd fc ff ff    	jne    800aa4 <vprintfmt+0x1d9>
+  800de7:	ba 28 00 00 00       	mov    $0x28,%edx
+  800dec:	b8 28 00 00 00       	mov    $0x28,%eax
+  800df1:	be a1 3b 80 00       	mov    $0x803ba1,%esi
+  800df6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800df9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800dfc:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800dff:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e02:	e9 17 fd ff ff       	jmp    800b1e <vprintfmt+0x253>
+  800e07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0a:	5b                   	pop    %ebx
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5f                   	pop    %edi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+
+00800e0f <vsnprintf>:
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	83 ec 18             	sub    $0x18,%esp
+  800e15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e18:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e1b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800e1e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800e22:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800e25:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800e2c:	85 c0                	test   %eax,%eax
+  800e2e:	74 26                	je     800e56 <vsnprintf+0x47>
+  800e30:	85 d2                	test   %edx,%edx
+  800e32:	7e 22                	jle    800e56 <vsnprintf+0x47>
+  800e34:	ff 75 14             	push   0x14(%ebp)
+  800e37:	ff 75 10             	push   0x10(%ebp)
+  800e3a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800e3d:	50                   	push   %eax
+  800e3e:	68 91 08 80 00       	push   $0x800891
+  800e43:	e8 83 fa ff ff       	call   8008cb <vprintfmt>
+  800e48:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800e4b:	c6 00 00             	movb   $0x0,(%eax)
+  800e4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e51:	83 c4 10             	add    $0x10,%esp
+  800e54:	c9                   	leave
+  800e55:	c3                   	ret
+  800e56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e5b:	eb f7                	jmp    800e54 <vsnprintf+0x45>
+
+00800e5d <snprintf>:
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	83 ec 08             	sub    $0x8,%esp
+  800e63:	8d 45 14             	lea    0x14(%ebp),%eax
+  800e66:	50                   	push   %eax
+  800e67:	ff 75 10             	push   0x10(%ebp)
+  800e6a:	ff 75 0c             	push   0xc(%ebp)
+  800e6d:	ff 75 08             	push   0x8(%ebp)
+  800e70:	e8 9a ff ff ff       	call   800e0f <vsnprintf>
+  800e75:	c9                   	leave
+  800e76:	c3                   	ret
+
+00800e77 <strlen>:
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7d:	80 3a 00             	cmpb   $0x0,(%edx)
+  800e80:	74 10                	je     800e92 <strlen+0x1b>
+  800e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e87:	83 c0 01             	add    $0x1,%eax
+  800e8a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800e8e:	75 f7                	jne    800e87 <strlen+0x10>
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+  800e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e97:	eb f7                	jmp    800e90 <strlen+0x19>
+
+00800e99 <strnlen>:
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ea2:	85 d2                	test   %edx,%edx
+  800ea4:	74 16                	je     800ebc <strnlen+0x23>
+  800ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eab:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800eaf:	74 09                	je     800eba <strnlen+0x21>
+  800eb1:	83 c0 01             	add    $0x1,%eax
+  800eb4:	39 d0                	cmp    %edx,%eax
+  800eb6:	75 f3                	jne    800eab <strnlen+0x12>
+  800eb8:	89 d0                	mov    %edx,%eax
+  800eba:	5d                   	pop    %ebp
+  800ebb:	c3                   	ret
+  800ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec1:	eb f7                	jmp    800eba <strnlen+0x21>
+
+00800ec3 <strcpy>:
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	53                   	push   %ebx
+  800ec7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800eca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ed6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ed9:	83 c0 01             	add    $0x1,%eax
+  800edc:	84 d2                	test   %dl,%dl
+  800ede:	75 f2                	jne    800ed2 <strcpy+0xf>
+  800ee0:	89 c8                	mov    %ecx,%eax
+  800ee2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ee5:	c9                   	leave
+  800ee6:	c3                   	ret
+
+00800ee7 <strcat>:
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	53                   	push   %ebx
+  800eeb:	83 ec 10             	sub    $0x10,%esp
+  800eee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ef1:	53                   	push   %ebx
+  800ef2:	e8 80 ff ff ff       	call   800e77 <strlen>
+  800ef7:	83 c4 08             	add    $0x8,%esp
+  800efa:	ff 75 0c             	push   0xc(%ebp)
+  800efd:	01 d8                	add    %ebx,%eax
+  800eff:	50                   	push   %eax
+  800f00:	e8 be ff ff ff       	call   800ec3 <strcpy>
+  800f05:	89 d8                	mov    %ebx,%eax
+  800f07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f0a:	c9                   	leave
+  800f0b:	c3                   	ret
+
+00800f0c <strncpy>:
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	56                   	push   %esi
+  800f10:	53                   	push   %ebx
+  800f11:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f14:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1a:	85 db                	test   %ebx,%ebx
+  800f1c:	74 17                	je     800f35 <strncpy+0x29>
+  800f1e:	01 f3                	add    %esi,%ebx
+  800f20:	89 f0                	mov    %esi,%eax
+  800f22:	83 c0 01             	add    $0x1,%eax
+  800f25:	0f b6 0a             	movzbl (%edx),%ecx
+  800f28:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800f2b:	80 f9 01             	cmp    $0x1,%cl
+  800f2e:	83 da ff             	sbb    $0xffffffff,%edx
+  800f31:	39 c3                	cmp    %eax,%ebx
+  800f33:	75 ed                	jne    800f22 <strncpy+0x16>
+  800f35:	89 f0                	mov    %esi,%eax
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <strlcpy>:
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+  800f40:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f49:	89 f0                	mov    %esi,%eax
+  800f4b:	85 db                	test   %ebx,%ebx
+  800f4d:	74 1e                	je     800f6d <strlcpy+0x32>
+  800f4f:	83 eb 01             	sub    $0x1,%ebx
+  800f52:	74 16                	je     800f6a <strlcpy+0x2f>
+  800f54:	01 f3                	add    %esi,%ebx
+  800f56:	0f b6 0a             	movzbl (%edx),%ecx
+  800f59:	84 c9                	test   %cl,%cl
+  800f5b:	74 0d                	je     800f6a <strlcpy+0x2f>
+  800f5d:	83 c2 01             	add    $0x1,%edx
+  800f60:	83 c0 01             	add    $0x1,%eax
+  800f63:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800f66:	39 d8                	cmp    %ebx,%eax
+  800f68:	75 ec                	jne    800f56 <strlcpy+0x1b>
+  800f6a:	c6 00 00             	movb   $0x0,(%eax)
+  800f6d:	29 f0                	sub    %esi,%eax
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5d                   	pop    %ebp
+  800f72:	c3                   	ret
+
+00800f73 <strcmp>:
+  800f73:	55                   	push   %ebp
+  800f74:	89 e5                	mov    %esp,%ebp
+  800f76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f7c:	0f b6 01             	movzbl (%ecx),%eax
+  800f7f:	84 c0                	test   %al,%al
+  800f81:	74 11                	je     800f94 <strcmp+0x21>
+  800f83:	38 02                	cmp    %al,(%edx)
+  800f85:	75 0d                	jne    800f94 <strcmp+0x21>
+  800f87:	83 c1 01             	add    $0x1,%ecx
+  800f8a:	83 c2 01             	add    $0x1,%edx
+  800f8d:	0f b6 01             	movzbl (%ecx),%eax
+  800f90:	84 c0                	test   %al,%al
+  800f92:	75 ef                	jne    800f83 <strcmp+0x10>
+  800f94:	0f b6 c0             	movzbl %al,%eax
+  800f97:	0f b6 12             	movzbl (%edx),%edx
+  800f9a:	29 d0                	sub    %edx,%eax
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+
+00800f9e <strncmp>:
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	53                   	push   %ebx
+  800fa2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fa5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fa8:	8b 55 10             	mov    0x10(%ebp),%edx
+  800fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb0:	85 d2                	test   %edx,%edx
+  800fb2:	74 2e                	je     800fe2 <strncmp+0x44>
+  800fb4:	0f b6 01             	movzbl (%ecx),%eax
+  800fb7:	84 c0                	test   %al,%al
+  800fb9:	74 16                	je     800fd1 <strncmp+0x33>
+  800fbb:	3a 03                	cmp    (%ebx),%al
+  800fbd:	75 12                	jne    800fd1 <strncmp+0x33>
+  800fbf:	83 c1 01             	add    $0x1,%ecx
+  800fc2:	83 c3 01             	add    $0x1,%ebx
+  800fc5:	83 ea 01             	sub    $0x1,%edx
+  800fc8:	75 ea                	jne    800fb4 <strncmp+0x16>
+  800fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcf:	eb 11                	jmp    800fe2 <strncmp+0x44>
+  800fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd6:	85 d2                	test   %edx,%edx
+  800fd8:	74 08                	je     800fe2 <strncmp+0x44>
+  800fda:	0f b6 01             	movzbl (%ecx),%eax
+  800fdd:	0f b6 13             	movzbl (%ebx),%edx
+  800fe0:	29 d0                	sub    %edx,%eax
+  800fe2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fe5:	c9                   	leave
+  800fe6:	c3                   	ret
+
+00800fe7 <strchr>:
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800ff1:	0f b6 10             	movzbl (%eax),%edx
+  800ff4:	84 d2                	test   %dl,%dl
+  800ff6:	74 15                	je     80100d <strchr+0x26>
+  800ff8:	38 d1                	cmp    %dl,%cl
+  800ffa:	74 0f                	je     80100b <strchr+0x24>
+  800ffc:	83 c0 01             	add    $0x1,%eax
+  800fff:	0f b6 10             	movzbl (%eax),%edx
+  801002:	84 d2                	test   %dl,%dl
+  801004:	75 f2                	jne    800ff8 <strchr+0x11>
+  801006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100b:	5d                   	pop    %ebp
+  80100c:	c3                   	ret
+  80100d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801012:	eb f7                	jmp    80100b <strchr+0x24>
+
+00801014 <strfind>:
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	53                   	push   %ebx
+  801018:	8b 45 08             	mov    0x8(%ebp),%eax
+  80101b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80101e:	0f b6 18             	movzbl (%eax),%ebx
+  801021:	38 d3                	cmp    %dl,%bl
+  801023:	74 14                	je     801039 <strfind+0x25>
+  801025:	89 d1                	mov    %edx,%ecx
+  801027:	84 db                	test   %bl,%bl
+  801029:	74 0e                	je     801039 <strfind+0x25>
+  80102b:	83 c0 01             	add    $0x1,%eax
+  80102e:	0f b6 10             	movzbl (%eax),%edx
+  801031:	38 ca                	cmp    %cl,%dl
+  801033:	74 04                	je     801039 <strfind+0x25>
+  801035:	84 d2                	test   %dl,%dl
+  801037:	75 f2                	jne    80102b <strfind+0x17>
+  801039:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80103c:	c9                   	leave
+  80103d:	c3                   	ret
+
+0080103e <memset>:
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	57                   	push   %edi
+  801042:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801045:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801048:	85 c9                	test   %ecx,%ecx
+  80104a:	74 20                	je     80106c <memset+0x2e>
+  80104c:	89 f8                	mov    %edi,%eax
+  80104e:	09 c8                	or     %ecx,%eax
+  801050:	a8 03                	test   $0x3,%al
+  801052:	75 12                	jne    801066 <memset+0x28>
+  801054:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801058:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  80105e:	c1 e9 02             	shr    $0x2,%ecx
+  801061:	fc                   	cld
+  801062:	f3 ab                	rep stos %eax,%es:(%edi)
+  801064:	eb 06                	jmp    80106c <memset+0x2e>
+  801066:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801069:	fc                   	cld
+  80106a:	f3 aa                	rep stos %al,%es:(%edi)
+  80106c:	89 f8                	mov    %edi,%eax
+  80106e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801071:	c9                   	leave
+  801072:	c3                   	ret
+
+00801073 <memmove>:
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	8b 45 08             	mov    0x8(%ebp),%eax
+  80107b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80107e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801081:	39 c6                	cmp    %eax,%esi
+  801083:	73 32                	jae    8010b7 <memmove+0x44>
+  801085:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801088:	39 d0                	cmp    %edx,%eax
+  80108a:	73 2b                	jae    8010b7 <memmove+0x44>
+  80108c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  80108f:	89 d6                	mov    %edx,%esi
+  801091:	09 fe                	or     %edi,%esi
+  801093:	09 ce                	or     %ecx,%esi
+  801095:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80109b:	75 0e                	jne    8010ab <memmove+0x38>
+  80109d:	83 ef 04             	sub    $0x4,%edi
+  8010a0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8010a3:	c1 e9 02             	shr    $0x2,%ecx
+  8010a6:	fd                   	std
+  8010a7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010a9:	eb 09                	jmp    8010b4 <memmove+0x41>
+  8010ab:	83 ef 01             	sub    $0x1,%edi
+  8010ae:	8d 72 ff             	lea    -0x1(%edx),%esi
+  8010b1:	fd                   	std
+  8010b2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8010b4:	fc                   	cld
+  8010b5:	eb 1a                	jmp    8010d1 <memmove+0x5e>
+  8010b7:	89 f2                	mov    %esi,%edx
+  8010b9:	09 c2                	or     %eax,%edx
+  8010bb:	09 ca                	or     %ecx,%edx
+  8010bd:	f6 c2 03             	test   $0x3,%dl
+  8010c0:	75 0a                	jne    8010cc <memmove+0x59>
+  8010c2:	c1 e9 02             	shr    $0x2,%ecx
+  8010c5:	89 c7                	mov    %eax,%edi
+  8010c7:	fc                   	cld
+  8010c8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010ca:	eb 05                	jmp    8010d1 <memmove+0x5e>
+  8010cc:	89 c7                	mov    %eax,%edi
+  8010ce:	fc                   	cld
+  8010cf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8010d1:	5e                   	pop    %esi
+  8010d2:	5f                   	pop    %edi
+  8010d3:	5d                   	pop    %ebp
+  8010d4:	c3                   	ret
+
+008010d5 <memcpy>:
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	ff 75 10             	push   0x10(%ebp)
+  8010de:	ff 75 0c             	push   0xc(%ebp)
+  8010e1:	ff 75 08             	push   0x8(%ebp)
+  8010e4:	e8 8a ff ff ff       	call   801073 <memmove>
+  8010e9:	c9                   	leave
+  8010ea:	c3                   	ret
+
+008010eb <memcmp>:
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	56                   	push   %esi
+  8010ef:	53                   	push   %ebx
+  8010f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010f6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8010f9:	85 f6                	test   %esi,%esi
+  8010fb:	74 29                	je     801126 <memcmp+0x3b>
+  8010fd:	01 c6                	add    %eax,%esi
+  8010ff:	0f b6 08             	movzbl (%eax),%ecx
+  801102:	0f b6 1a             	movzbl (%edx),%ebx
+  801105:	38 d9                	cmp    %bl,%cl
+  801107:	75 11                	jne    80111a <memcmp+0x2f>
+  801109:	83 c0 01             	add    $0x1,%eax
+  80110c:	83 c2 01             	add    $0x1,%edx
+  80110f:	39 c6                	cmp    %eax,%esi
+  801111:	75 ec                	jne    8010ff <memcmp+0x14>
+  801113:	b8 00 00 00 00       	mov    $0x0,%eax
+  801118:	eb 08                	jmp    801122 <memcmp+0x37>
+  80111a:	0f b6 c1             	movzbl %cl,%eax
+  80111d:	0f b6 db             	movzbl %bl,%ebx
+  801120:	29 d8                	sub    %ebx,%eax
+  801122:	5b                   	pop    %ebx
+  801123:	5e                   	pop    %esi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+  801126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112b:	eb f5                	jmp    801122 <memcmp+0x37>
+
+0080112d <memfind>:
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	8b 45 08             	mov    0x8(%ebp),%eax
+  801133:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801136:	89 c2                	mov    %eax,%edx
+  801138:	03 55 10             	add    0x10(%ebp),%edx
+  80113b:	39 d0                	cmp    %edx,%eax
+  80113d:	73 0d                	jae    80114c <memfind+0x1f>
+  80113f:	38 08                	cmp    %cl,(%eax)
+  801141:	74 0d                	je     801150 <memfind+0x23>
+  801143:	83 c0 01             	add    $0x1,%eax
+  801146:	39 c2                	cmp    %eax,%edx
+  801148:	75 f5                	jne    80113f <memfind+0x12>
+  80114a:	eb 06                	jmp    801152 <memfind+0x25>
+  80114c:	89 c2                	mov    %eax,%edx
+  80114e:	eb 02                	jmp    801152 <memfind+0x25>
+  801150:	89 c2                	mov    %eax,%edx
+  801152:	89 d0                	mov    %edx,%eax
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+
+00801156 <strtol>:
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	57                   	push   %edi
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+  80115c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801162:	0f b6 02             	movzbl (%edx),%eax
+  801165:	3c 20                	cmp    $0x20,%al
+  801167:	74 04                	je     80116d <strtol+0x17>
+  801169:	3c 09                	cmp    $0x9,%al
+  80116b:	75 0e                	jne    80117b <strtol+0x25>
+  80116d:	83 c2 01             	add    $0x1,%edx
+  801170:	0f b6 02             	movzbl (%edx),%eax
+  801173:	3c 20                	cmp    $0x20,%al
+  801175:	74 f6                	je     80116d <strtol+0x17>
+  801177:	3c 09                	cmp    $0x9,%al
+  801179:	74 f2                	je     80116d <strtol+0x17>
+  80117b:	3c 2b                	cmp    $0x2b,%al
+  80117d:	74 2a                	je     8011a9 <strtol+0x53>
+  80117f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801184:	3c 2d                	cmp    $0x2d,%al
+  801186:	74 2b                	je     8011b3 <strtol+0x5d>
+  801188:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80118e:	75 0f                	jne    80119f <strtol+0x49>
+  801190:	80 3a 30             	cmpb   $0x30,(%edx)
+  801193:	74 28                	je     8011bd <strtol+0x67>
+  801195:	85 db                	test   %ebx,%ebx
+  801197:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80119c:	0f 44 d8             	cmove  %eax,%ebx
+  80119f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8011a7:	eb 46                	jmp    8011ef <strtol+0x99>
+  8011a9:	83 c2 01             	add    $0x1,%edx
+  8011ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011b1:	eb d5                	jmp    801188 <strtol+0x32>
+  8011b3:	83 c2 01             	add    $0x1,%edx
+  8011b6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011bb:	eb cb                	jmp    801188 <strtol+0x32>
+  8011bd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8011c1:	74 0e                	je     8011d1 <strtol+0x7b>
+  8011c3:	85 db                	test   %ebx,%ebx
+  8011c5:	75 d8                	jne    80119f <strtol+0x49>
+  8011c7:	83 c2 01             	add    $0x1,%edx
+  8011ca:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8011cf:	eb ce                	jmp    80119f <strtol+0x49>
+  8011d1:	83 c2 02             	add    $0x2,%edx
+  8011d4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8011d9:	eb c4                	jmp    80119f <strtol+0x49>
+  8011db:	0f be c0             	movsbl %al,%eax
+  8011de:	83 e8 30             	sub    $0x30,%eax
+  8011e1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8011e4:	7d 3a                	jge    801220 <strtol+0xca>
+  8011e6:	83 c2 01             	add    $0x1,%edx
+  8011e9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8011ed:	01 c1                	add    %eax,%ecx
+  8011ef:	0f b6 02             	movzbl (%edx),%eax
+  8011f2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8011f5:	89 f3                	mov    %esi,%ebx
+  8011f7:	80 fb 09             	cmp    $0x9,%bl
+  8011fa:	76 df                	jbe    8011db <strtol+0x85>
+  8011fc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8011ff:	89 f3                	mov    %esi,%ebx
+  801201:	80 fb 19             	cmp    $0x19,%bl
+  801204:	77 08                	ja     80120e <strtol+0xb8>
+  801206:	0f be c0             	movsbl %al,%eax
+  801209:	83 e8 57             	sub    $0x57,%eax
+  80120c:	eb d3                	jmp    8011e1 <strtol+0x8b>
+  80120e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801211:	89 f3                	mov    %esi,%ebx
+  801213:	80 fb 19             	cmp    $0x19,%bl
+  801216:	77 08                	ja     801220 <strtol+0xca>
+  801218:	0f be c0             	movsbl %al,%eax
+  80121b:	83 e8 37             	sub    $0x37,%eax
+  80121e:	eb c1                	jmp    8011e1 <strtol+0x8b>
+  801220:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801224:	74 05                	je     80122b <strtol+0xd5>
+  801226:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801229:	89 10                	mov    %edx,(%eax)
+  80122b:	89 c8                	mov    %ecx,%eax
+  80122d:	f7 d8                	neg    %eax
+  80122f:	85 ff                	test   %edi,%edi
+  801231:	0f 45 c8             	cmovne %eax,%ecx
+  801234:	89 c8                	mov    %ecx,%eax
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5f                   	pop    %edi
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+
+0080123b <sys_cputs>:
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	57                   	push   %edi
+  80123f:	56                   	push   %esi
+  801240:	53                   	push   %ebx
+  801241:	b8 00 00 00 00       	mov    $0x0,%eax
+  801246:	8b 55 08             	mov    0x8(%ebp),%edx
+  801249:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124c:	89 c3                	mov    %eax,%ebx
+  80124e:	89 c7                	mov    %eax,%edi
+  801250:	89 c6                	mov    %eax,%esi
+  801252:	cd 30                	int    $0x30
+  801254:	5b                   	pop    %ebx
+  801255:	5e                   	pop    %esi
+  801256:	5f                   	pop    %edi
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+
+00801259 <sys_cgetc>:
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	57                   	push   %edi
+  80125d:	56                   	push   %esi
+  80125e:	53                   	push   %ebx
+  80125f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801264:	b8 01 00 00 00       	mov    $0x1,%eax
+  801269:	89 d1                	mov    %edx,%ecx
+  80126b:	89 d3                	mov    %edx,%ebx
+  80126d:	89 d7                	mov    %edx,%edi
+  80126f:	89 d6                	mov    %edx,%esi
+  801271:	cd 30                	int    $0x30
+  801273:	5b                   	pop    %ebx
+  801274:	5e                   	pop    %esi
+  801275:	5f                   	pop    %edi
+  801276:	5d                   	pop    %ebp
+  801277:	c3                   	ret
+
+00801278 <sys_env_destroy>:
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	57                   	push   %edi
+  80127c:	56                   	push   %esi
+  80127d:	53                   	push   %ebx
+  80127e:	83 ec 0c             	sub    $0xc,%esp
+  801281:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801286:	8b 55 08             	mov    0x8(%ebp),%edx
+  801289:	b8 03 00 00 00       	mov    $0x3,%eax
+  80128e:	89 cb                	mov    %ecx,%ebx
+  801290:	89 cf                	mov    %ecx,%edi
+  801292:	89 ce                	mov    %ecx,%esi
+  801294:	cd 30                	int    $0x30
+  801296:	85 c0                	test   %eax,%eax
+  801298:	7f 08                	jg     8012a2 <sys_env_destroy+0x2a>
+  80129a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+  8012a2:	83 ec 0c             	sub    $0xc,%esp
+  8012a5:	50                   	push   %eax
+  8012a6:	6a 03                	push   $0x3
+  8012a8:	68 ab 3e 80 00       	push   $0x803eab
+  8012ad:	6a 24                	push   $0x24
+  8012af:	68 c8 3e 80 00       	push   $0x803ec8
+  8012b4:	e8 38 f4 ff ff       	call   8006f1 <_panic>
+
+008012b9 <sys_getenvid>:
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	57                   	push   %edi
+  8012bd:	56                   	push   %esi
+  8012be:	53                   	push   %ebx
+  8012bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012c9:	89 d1                	mov    %edx,%ecx
+  8012cb:	89 d3                	mov    %edx,%ebx
+  8012cd:	89 d7                	mov    %edx,%edi
+  8012cf:	89 d6                	mov    %edx,%esi
+  8012d1:	cd 30                	int    $0x30
+  8012d3:	5b                   	pop    %ebx
+  8012d4:	5e                   	pop    %esi
+  8012d5:	5f                   	pop    %edi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	c3                   	ret
+
+008012d8 <sys_yield>:
+  8012d8:	55                   	push   %ebp
+  8012d9:	89 e5                	mov    %esp,%ebp
+  8012db:	57                   	push   %edi
+  8012dc:	56                   	push   %esi
+  8012dd:	53                   	push   %ebx
+  8012de:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012e5:	74 26                	je     80130d <sys_yield+0x35>
+  8012e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ec:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8012f1:	89 d1                	mov    %edx,%ecx
+  8012f3:	89 d3                	mov    %edx,%ebx
+  8012f5:	89 d7                	mov    %edx,%edi
+  8012f7:	6a 00                	push   $0x0
+  8012f9:	55                   	push   %ebp
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	8d 35 04 13 80 00    	lea    0x801304,%esi
+  801302:	0f 34                	sysenter
+  801304:	5d                   	pop    %ebp
+  801305:	83 c4 04             	add    $0x4,%esp
+  801308:	5b                   	pop    %ebx
+  801309:	5e                   	pop    %esi
+  80130a:	5f                   	pop    %edi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+  80130d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801312:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801317:	89 d1                	mov    %edx,%ecx
+  801319:	89 d3                	mov    %edx,%ebx
+  80131b:	89 d7                	mov    %edx,%edi
+  80131d:	89 d6                	mov    %edx,%esi
+  80131f:	cd 30                	int    $0x30
+  801321:	eb e5                	jmp    801308 <sys_yield+0x30>
+
+00801323 <sys_page_alloc>:
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	57                   	push   %edi
+  801327:	56                   	push   %esi
+  801328:	53                   	push   %ebx
+  801329:	83 ec 0c             	sub    $0xc,%esp
+  80132c:	be 00 00 00 00       	mov    $0x0,%esi
+  801331:	8b 55 08             	mov    0x8(%ebp),%edx
+  801334:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801337:	b8 04 00 00 00       	mov    $0x4,%eax
+  80133c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133f:	89 f7                	mov    %esi,%edi
+  801341:	cd 30                	int    $0x30
+  801343:	85 c0                	test   %eax,%eax
+  801345:	7f 08                	jg     80134f <sys_page_alloc+0x2c>
+  801347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134a:	5b                   	pop    %ebx
+  80134b:	5e                   	pop    %esi
+  80134c:	5f                   	pop    %edi
+  80134d:	5d                   	pop    %ebp
+  80134e:	c3                   	ret
+  80134f:	83 ec 0c             	sub    $0xc,%esp
+  801352:	50                   	push   %eax
+  801353:	6a 04                	push   $0x4
+  801355:	68 ab 3e 80 00       	push   $0x803eab
+  80135a:	6a 24                	push   $0x24
+  80135c:	68 c8 3e 80 00       	push   $0x803ec8
+  801361:	e8 8b f3 ff ff       	call   8006f1 <_panic>
+
+00801366 <sys_page_map>:
+  801366:	55                   	push   %ebp
+  801367:	89 e5                	mov    %esp,%ebp
+  801369:	57                   	push   %edi
+  80136a:	56                   	push   %esi
+  80136b:	53                   	push   %ebx
+  80136c:	83 ec 0c             	sub    $0xc,%esp
+  80136f:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801376:	74 33                	je     8013ab <sys_page_map+0x45>
+  801378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801383:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801386:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801389:	ff 75 18             	push   0x18(%ebp)
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	8d 35 97 13 80 00    	lea    0x801397,%esi
+  801395:	0f 34                	sysenter
+  801397:	5d                   	pop    %ebp
+  801398:	83 c4 04             	add    $0x4,%esp
+  80139b:	89 c2                	mov    %eax,%edx
+  80139d:	85 c0                	test   %eax,%eax
+  80139f:	7f 3d                	jg     8013de <sys_page_map+0x78>
+  8013a1:	89 d0                	mov    %edx,%eax
+  8013a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a6:	5b                   	pop    %ebx
+  8013a7:	5e                   	pop    %esi
+  8013a8:	5f                   	pop    %edi
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+  8013ab:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013bc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013bf:	cd 30                	int    $0x30
+  8013c1:	89 c2                	mov    %eax,%edx
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	7e da                	jle    8013a1 <sys_page_map+0x3b>
+  8013c7:	83 ec 0c             	sub    $0xc,%esp
+  8013ca:	50                   	push   %eax
+  8013cb:	6a 05                	push   $0x5
+  8013cd:	68 ab 3e 80 00       	push   $0x803eab
+  8013d2:	6a 24                	push   $0x24
+  8013d4:	68 c8 3e 80 00       	push   $0x803ec8
+  8013d9:	e8 13 f3 ff ff       	call   8006f1 <_panic>
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+  8013e1:	50                   	push   %eax
+  8013e2:	6a 05                	push   $0x5
+  8013e4:	68 ab 3e 80 00       	push   $0x803eab
+  8013e9:	6a 48                	push   $0x48
+  8013eb:	68 c8 3e 80 00       	push   $0x803ec8
+  8013f0:	e8 fc f2 ff ff       	call   8006f1 <_panic>
+
+008013f5 <sys_page_unmap>:
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	57                   	push   %edi
+  8013f9:	56                   	push   %esi
+  8013fa:	53                   	push   %ebx
+  8013fb:	83 ec 0c             	sub    $0xc,%esp
+  8013fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801403:	8b 55 08             	mov    0x8(%ebp),%edx
+  801406:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801409:	b8 06 00 00 00       	mov    $0x6,%eax
+  80140e:	89 df                	mov    %ebx,%edi
+  801410:	89 de                	mov    %ebx,%esi
+  801412:	cd 30                	int    $0x30
+  801414:	85 c0                	test   %eax,%eax
+  801416:	7f 08                	jg     801420 <sys_page_unmap+0x2b>
+  801418:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141b:	5b                   	pop    %ebx
+  80141c:	5e                   	pop    %esi
+  80141d:	5f                   	pop    %edi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+  801420:	83 ec 0c             	sub    $0xc,%esp
+  801423:	50                   	push   %eax
+  801424:	6a 06                	push   $0x6
+  801426:	68 ab 3e 80 00       	push   $0x803eab
+  80142b:	6a 24                	push   $0x24
+  80142d:	68 c8 3e 80 00       	push   $0x803ec8
+  801432:	e8 ba f2 ff ff       	call   8006f1 <_panic>
+
+00801437 <sys_fork>:
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+  80143d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801442:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801447:	89 d1                	mov    %edx,%ecx
+  801449:	89 d3                	mov    %edx,%ebx
+  80144b:	89 d7                	mov    %edx,%edi
+  80144d:	89 d6                	mov    %edx,%esi
+  80144f:	cd 30                	int    $0x30
+  801451:	5b                   	pop    %ebx
+  801452:	5e                   	pop    %esi
+  801453:	5f                   	pop    %edi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+
+00801456 <sys_env_set_status>:
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	57                   	push   %edi
+  80145a:	56                   	push   %esi
+  80145b:	53                   	push   %ebx
+  80145c:	83 ec 0c             	sub    $0xc,%esp
+  80145f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801464:	8b 55 08             	mov    0x8(%ebp),%edx
+  801467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80146f:	89 df                	mov    %ebx,%edi
+  801471:	89 de                	mov    %ebx,%esi
+  801473:	cd 30                	int    $0x30
+  801475:	85 c0                	test   %eax,%eax
+  801477:	7f 08                	jg     801481 <sys_env_set_status+0x2b>
+  801479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147c:	5b                   	pop    %ebx
+  80147d:	5e                   	pop    %esi
+  80147e:	5f                   	pop    %edi
+  80147f:	5d                   	pop    %ebp
+  801480:	c3                   	ret
+  801481:	83 ec 0c             	sub    $0xc,%esp
+  801484:	50                   	push   %eax
+  801485:	6a 08                	push   $0x8
+  801487:	68 ab 3e 80 00       	push   $0x803eab
+  80148c:	6a 24                	push   $0x24
+  80148e:	68 c8 3e 80 00       	push   $0x803ec8
+  801493:	e8 59 f2 ff ff       	call   8006f1 <_panic>
+
+00801498 <sys_env_set_trapframe>:
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	57                   	push   %edi
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014b1:	89 df                	mov    %ebx,%edi
+  8014b3:	89 de                	mov    %ebx,%esi
+  8014b5:	cd 30                	int    $0x30
+  8014b7:	85 c0                	test   %eax,%eax
+  8014b9:	7f 08                	jg     8014c3 <sys_env_set_trapframe+0x2b>
+  8014bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014be:	5b                   	pop    %ebx
+  8014bf:	5e                   	pop    %esi
+  8014c0:	5f                   	pop    %edi
+  8014c1:	5d                   	pop    %ebp
+  8014c2:	c3                   	ret
+  8014c3:	83 ec 0c             	sub    $0xc,%esp
+  8014c6:	50                   	push   %eax
+  8014c7:	6a 09                	push   $0x9
+  8014c9:	68 ab 3e 80 00       	push   $0x803eab
+  8014ce:	6a 24                	push   $0x24
+  8014d0:	68 c8 3e 80 00       	push   $0x803ec8
+  8014d5:	e8 17 f2 ff ff       	call   8006f1 <_panic>
+
+008014da <sys_env_set_cow>:
+  8014da:	55                   	push   %ebp
+  8014db:	89 e5                	mov    %esp,%ebp
+  8014dd:	57                   	push   %edi
+  8014de:	56                   	push   %esi
+  8014df:	53                   	push   %ebx
+  8014e0:	83 ec 0c             	sub    $0xc,%esp
+  8014e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ee:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014f3:	89 df                	mov    %ebx,%edi
+  8014f5:	89 de                	mov    %ebx,%esi
+  8014f7:	cd 30                	int    $0x30
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	7f 08                	jg     801505 <sys_env_set_cow+0x2b>
+  8014fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5f                   	pop    %edi
+  801503:	5d                   	pop    %ebp
+  801504:	c3                   	ret
+  801505:	83 ec 0c             	sub    $0xc,%esp
+  801508:	50                   	push   %eax
+  801509:	6a 20                	push   $0x20
+  80150b:	68 ab 3e 80 00       	push   $0x803eab
+  801510:	6a 24                	push   $0x24
+  801512:	68 c8 3e 80 00       	push   $0x803ec8
+  801517:	e8 d5 f1 ff ff       	call   8006f1 <_panic>
+
+0080151c <sys_env_service>:
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	57                   	push   %edi
+  801520:	56                   	push   %esi
+  801521:	53                   	push   %ebx
+  801522:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80152f:	89 cb                	mov    %ecx,%ebx
+  801531:	89 cf                	mov    %ecx,%edi
+  801533:	89 ce                	mov    %ecx,%esi
+  801535:	cd 30                	int    $0x30
+  801537:	5b                   	pop    %ebx
+  801538:	5e                   	pop    %esi
+  801539:	5f                   	pop    %edi
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+
+0080153c <sys_env_set_pgfault_upcall>:
+  80153c:	55                   	push   %ebp
+  80153d:	89 e5                	mov    %esp,%ebp
+  80153f:	57                   	push   %edi
+  801540:	56                   	push   %esi
+  801541:	53                   	push   %ebx
+  801542:	83 ec 0c             	sub    $0xc,%esp
+  801545:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801550:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801555:	89 df                	mov    %ebx,%edi
+  801557:	89 de                	mov    %ebx,%esi
+  801559:	cd 30                	int    $0x30
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	7f 08                	jg     801567 <sys_env_set_pgfault_upcall+0x2b>
+  80155f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801562:	5b                   	pop    %ebx
+  801563:	5e                   	pop    %esi
+  801564:	5f                   	pop    %edi
+  801565:	5d                   	pop    %ebp
+  801566:	c3                   	ret
+  801567:	83 ec 0c             	sub    $0xc,%esp
+  80156a:	50                   	push   %eax
+  80156b:	6a 0a                	push   $0xa
+  80156d:	68 ab 3e 80 00       	push   $0x803eab
+  801572:	6a 24                	push   $0x24
+  801574:	68 c8 3e 80 00       	push   $0x803ec8
+  801579:	e8 73 f1 ff ff       	call   8006f1 <_panic>
+
+0080157e <sys_ipc_try_send>:
+  80157e:	55                   	push   %ebp
+  80157f:	89 e5                	mov    %esp,%ebp
+  801581:	57                   	push   %edi
+  801582:	56                   	push   %esi
+  801583:	53                   	push   %ebx
+  801584:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80158b:	74 27                	je     8015b4 <sys_ipc_try_send+0x36>
+  80158d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801590:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801593:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801598:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80159b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80159e:	6a 00                	push   $0x0
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	8d 35 ab 15 80 00    	lea    0x8015ab,%esi
+  8015a9:	0f 34                	sysenter
+  8015ab:	5d                   	pop    %ebp
+  8015ac:	83 c4 04             	add    $0x4,%esp
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+  8015b4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8015b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015ca:	cd 30                	int    $0x30
+  8015cc:	eb e1                	jmp    8015af <sys_ipc_try_send+0x31>
+
+008015ce <sys_ipc_recv>:
+  8015ce:	55                   	push   %ebp
+  8015cf:	89 e5                	mov    %esp,%ebp
+  8015d1:	57                   	push   %edi
+  8015d2:	56                   	push   %esi
+  8015d3:	53                   	push   %ebx
+  8015d4:	83 ec 0c             	sub    $0xc,%esp
+  8015d7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8015de:	74 32                	je     801612 <sys_ipc_recv+0x44>
+  8015e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015ed:	89 cb                	mov    %ecx,%ebx
+  8015ef:	89 cf                	mov    %ecx,%edi
+  8015f1:	6a 00                	push   $0x0
+  8015f3:	55                   	push   %ebp
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	8d 35 fe 15 80 00    	lea    0x8015fe,%esi
+  8015fc:	0f 34                	sysenter
+  8015fe:	5d                   	pop    %ebp
+  8015ff:	83 c4 04             	add    $0x4,%esp
+  801602:	89 c2                	mov    %eax,%edx
+  801604:	85 c0                	test   %eax,%eax
+  801606:	7f 3c                	jg     801644 <sys_ipc_recv+0x76>
+  801608:	89 d0                	mov    %edx,%eax
+  80160a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5f                   	pop    %edi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+  801612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801617:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80161c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161f:	89 cb                	mov    %ecx,%ebx
+  801621:	89 cf                	mov    %ecx,%edi
+  801623:	89 ce                	mov    %ecx,%esi
+  801625:	cd 30                	int    $0x30
+  801627:	89 c2                	mov    %eax,%edx
+  801629:	85 c0                	test   %eax,%eax
+  80162b:	7e db                	jle    801608 <sys_ipc_recv+0x3a>
+  80162d:	83 ec 0c             	sub    $0xc,%esp
+  801630:	50                   	push   %eax
+  801631:	6a 0d                	push   $0xd
+  801633:	68 ab 3e 80 00       	push   $0x803eab
+  801638:	6a 24                	push   $0x24
+  80163a:	68 c8 3e 80 00       	push   $0x803ec8
+  80163f:	e8 ad f0 ff ff       	call   8006f1 <_panic>
+  801644:	83 ec 0c             	sub    $0xc,%esp
+  801647:	50                   	push   %eax
+  801648:	6a 0d                	push   $0xd
+  80164a:	68 ab 3e 80 00       	push   $0x803eab
+  80164f:	6a 48                	push   $0x48
+  801651:	68 c8 3e 80 00       	push   $0x803ec8
+  801656:	e8 96 f0 ff ff       	call   8006f1 <_panic>
+
+0080165b <sys_ipc_send>:
+  80165b:	55                   	push   %ebp
+  80165c:	89 e5                	mov    %esp,%ebp
+  80165e:	57                   	push   %edi
+  80165f:	56                   	push   %esi
+  801660:	53                   	push   %ebx
+  801661:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801668:	74 27                	je     801691 <sys_ipc_send+0x36>
+  80166a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801670:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801675:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801678:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80167b:	6a 00                	push   $0x0
+  80167d:	55                   	push   %ebp
+  80167e:	89 e5                	mov    %esp,%ebp
+  801680:	8d 35 88 16 80 00    	lea    0x801688,%esi
+  801686:	0f 34                	sysenter
+  801688:	5d                   	pop    %ebp
+  801689:	83 c4 04             	add    $0x4,%esp
+  80168c:	5b                   	pop    %ebx
+  80168d:	5e                   	pop    %esi
+  80168e:	5f                   	pop    %edi
+  80168f:	5d                   	pop    %ebp
+  801690:	c3                   	ret
+  801691:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801696:	be 00 00 00 00       	mov    $0x0,%esi
+  80169b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016a7:	cd 30                	int    $0x30
+  8016a9:	eb e1                	jmp    80168c <sys_ipc_send+0x31>
+
+008016ab <sys_ipc_call>:
+  8016ab:	55                   	push   %ebp
+  8016ac:	89 e5                	mov    %esp,%ebp
+  8016ae:	57                   	push   %edi
+  8016af:	56                   	push   %esi
+  8016b0:	53                   	push   %ebx
+  8016b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016c5:	cd 30                	int    $0x30
+  8016c7:	5b                   	pop    %ebx
+  8016c8:	5e                   	pop    %esi
+  8016c9:	5f                   	pop    %edi
+  8016ca:	5d                   	pop    %ebp
+  8016cb:	c3                   	ret
+
+008016cc <sys_ipc_reply_recv>:
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	57                   	push   %edi
+  8016d0:	56                   	push   %esi
+  8016d1:	53                   	push   %ebx
+  8016d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8016dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016e3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016e6:	cd 30                	int    $0x30
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+
+008016ed <sys_time_msec>:
+  8016ed:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8016f2:	85 c0                	test   %eax,%eax
+  8016f4:	75 06                	jne    8016fc <sys_time_msec+0xf>
+  8016f6:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8016fb:	c3                   	ret
+  8016fc:	55                   	push   %ebp
+  8016fd:	89 e5                	mov    %esp,%ebp
+  8016ff:	57                   	push   %edi
+  801700:	56                   	push   %esi
+  801701:	53                   	push   %ebx
+  801702:	83 ec 0c             	sub    $0xc,%esp
+  801705:	0f 31                	rdtsc
+  801707:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80170d:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801713:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801719:	29 c8                	sub    %ecx,%eax
+  80171b:	19 da                	sbb    %ebx,%edx
+  80171d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801722:	57                   	push   %edi
+  801723:	56                   	push   %esi
+  801724:	52                   	push   %edx
+  801725:	50                   	push   %eax
+  801726:	e8 4b 1f 00 00       	call   803676 <__udivdi3>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801731:	5b                   	pop    %ebx
+  801732:	5e                   	pop    %esi
+  801733:	5f                   	pop    %edi
+  801734:	5d                   	pop    %ebp
+  801735:	c3                   	ret
+
+00801736 <sys_env_swap>:
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	57                   	push   %edi
+  80173a:	56                   	push   %esi
+  80173b:	53                   	push   %ebx
+  80173c:	83 ec 0c             	sub    $0xc,%esp
+  80173f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801744:	8b 55 08             	mov    0x8(%ebp),%edx
+  801747:	b8 12 00 00 00       	mov    $0x12,%eax
+  80174c:	89 cb                	mov    %ecx,%ebx
+  80174e:	89 cf                	mov    %ecx,%edi
+  801750:	89 ce                	mov    %ecx,%esi
+  801752:	cd 30                	int    $0x30
+  801754:	85 c0                	test   %eax,%eax
+  801756:	7f 08                	jg     801760 <sys_env_swap+0x2a>
+  801758:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80175b:	5b                   	pop    %ebx
+  80175c:	5e                   	pop    %esi
+  80175d:	5f                   	pop    %edi
+  80175e:	5d                   	pop    %ebp
+  80175f:	c3                   	ret
+  801760:	83 ec 0c             	sub    $0xc,%esp
+  801763:	50                   	push   %eax
+  801764:	6a 12                	push   $0x12
+  801766:	68 ab 3e 80 00       	push   $0x803eab
+  80176b:	6a 24                	push   $0x24
+  80176d:	68 c8 3e 80 00       	push   $0x803ec8
+  801772:	e8 7a ef ff ff       	call   8006f1 <_panic>
+
+00801777 <sys_net_try_send>:
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	57                   	push   %edi
+  80177b:	56                   	push   %esi
+  80177c:	53                   	push   %ebx
+  80177d:	83 ec 0c             	sub    $0xc,%esp
+  801780:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801785:	8b 55 08             	mov    0x8(%ebp),%edx
+  801788:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801790:	89 df                	mov    %ebx,%edi
+  801792:	89 de                	mov    %ebx,%esi
+  801794:	cd 30                	int    $0x30
+  801796:	85 c0                	test   %eax,%eax
+  801798:	7f 08                	jg     8017a2 <sys_net_try_send+0x2b>
+  80179a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80179d:	5b                   	pop    %ebx
+  80179e:	5e                   	pop    %esi
+  80179f:	5f                   	pop    %edi
+  8017a0:	5d                   	pop    %ebp
+  8017a1:	c3                   	ret
+  8017a2:	83 ec 0c             	sub    $0xc,%esp
+  8017a5:	50                   	push   %eax
+  8017a6:	6a 13                	push   $0x13
+  8017a8:	68 ab 3e 80 00       	push   $0x803eab
+  8017ad:	6a 24                	push   $0x24
+  8017af:	68 c8 3e 80 00       	push   $0x803ec8
+  8017b4:	e8 38 ef ff ff       	call   8006f1 <_panic>
+
+008017b9 <sys_net_try_receive>:
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+  8017bc:	57                   	push   %edi
+  8017bd:	56                   	push   %esi
+  8017be:	53                   	push   %ebx
+  8017bf:	83 ec 0c             	sub    $0xc,%esp
+  8017c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cd:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017d2:	89 df                	mov    %ebx,%edi
+  8017d4:	89 de                	mov    %ebx,%esi
+  8017d6:	cd 30                	int    $0x30
+  8017d8:	85 c0                	test   %eax,%eax
+  8017da:	7f 08                	jg     8017e4 <sys_net_try_receive+0x2b>
+  8017dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017df:	5b                   	pop    %ebx
+  8017e0:	5e                   	pop    %esi
+  8017e1:	5f                   	pop    %edi
+  8017e2:	5d                   	pop    %ebp
+  8017e3:	c3                   	ret
+  8017e4:	83 ec 0c             	sub    $0xc,%esp
+  8017e7:	50                   	push   %eax
+  8017e8:	6a 14                	push   $0x14
+  8017ea:	68 ab 3e 80 00       	push   $0x803eab
+  8017ef:	6a 24                	push   $0x24
+  8017f1:	68 c8 3e 80 00       	push   $0x803ec8
+  8017f6:	e8 f6 ee ff ff       	call   8006f1 <_panic>
+
+008017fb <sys_net_recv_page>:
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	57                   	push   %edi
+  8017ff:	56                   	push   %esi
+  801800:	53                   	push   %ebx
+  801801:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801806:	8b 55 08             	mov    0x8(%ebp),%edx
+  801809:	b8 27 00 00 00       	mov    $0x27,%eax
+  80180e:	89 cb                	mov    %ecx,%ebx
+  801810:	89 cf                	mov    %ecx,%edi
+  801812:	89 ce                	mov    %ecx,%esi
+  801814:	cd 30                	int    $0x30
+  801816:	5b                   	pop    %ebx
+  801817:	5e                   	pop    %esi
+  801818:	5f                   	pop    %edi
+  801819:	5d                   	pop    %ebp
+  80181a:	c3                   	ret
+
+0080181b <sys_net_wait>:
+  80181b:	55                   	push   %ebp
+  80181c:	89 e5                	mov    %esp,%ebp
+  80181e:	57                   	push   %edi
+  80181f:	56                   	push   %esi
+  801820:	53                   	push   %ebx
+  801821:	ba 00 00 00 00       	mov    $0x0,%edx
+  801826:	b8 26 00 00 00       	mov    $0x26,%eax
+  80182b:	89 d1                	mov    %edx,%ecx
+  80182d:	89 d3                	mov    %edx,%ebx
+  80182f:	89 d7                	mov    %edx,%edi
+  801831:	89 d6                	mov    %edx,%esi
+  801833:	cd 30                	int    $0x30
+  801835:	5b                   	pop    %ebx
+  801836:	5e                   	pop    %esi
+  801837:	5f                   	pop    %edi
+  801838:	5d                   	pop    %ebp
+  801839:	c3                   	ret
+
+0080183a <sys_get_mac>:
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	57                   	push   %edi
+  80183e:	56                   	push   %esi
+  80183f:	53                   	push   %ebx
+  801840:	83 ec 0c             	sub    $0xc,%esp
+  801843:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801848:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80184e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801853:	89 df                	mov    %ebx,%edi
+  801855:	89 de                	mov    %ebx,%esi
+  801857:	cd 30                	int    $0x30
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	7f 08                	jg     801865 <sys_get_mac+0x2b>
+  80185d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5f                   	pop    %edi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+  801865:	83 ec 0c             	sub    $0xc,%esp
+  801868:	50                   	push   %eax
+  801869:	6a 15                	push   $0x15
+  80186b:	68 ab 3e 80 00       	push   $0x803eab
+  801870:	6a 24                	push   $0x24
+  801872:	68 c8 3e 80 00       	push   $0x803ec8
+  801877:	e8 75 ee ff ff       	call   8006f1 <_panic>
+
+0080187c <sys_env_lease>:
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	57                   	push   %edi
+  801880:	56                   	push   %esi
+  801881:	53                   	push   %ebx
+  801882:	83 ec 0c             	sub    $0xc,%esp
+  801885:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801890:	b8 16 00 00 00       	mov    $0x16,%eax
+  801895:	89 df                	mov    %ebx,%edi
+  801897:	89 de                	mov    %ebx,%esi
+  801899:	cd 30                	int    $0x30
+  80189b:	85 c0                	test   %eax,%eax
+  80189d:	7f 08                	jg     8018a7 <sys_env_lease+0x2b>
+  80189f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a2:	5b                   	pop    %ebx
+  8018a3:	5e                   	pop    %esi
+  8018a4:	5f                   	pop    %edi
+  8018a5:	5d                   	pop    %ebp
+  8018a6:	c3                   	ret
+  8018a7:	83 ec 0c             	sub    $0xc,%esp
+  8018aa:	50                   	push   %eax
+  8018ab:	6a 16                	push   $0x16
+  8018ad:	68 ab 3e 80 00       	push   $0x803eab
+  8018b2:	6a 24                	push   $0x24
+  8018b4:	68 c8 3e 80 00       	push   $0x803ec8
+  8018b9:	e8 33 ee ff ff       	call   8006f1 <_panic>
+
+008018be <sys_copy_mem>:
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	57                   	push   %edi
+  8018c2:	56                   	push   %esi
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 0c             	sub    $0xc,%esp
+  8018c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018cd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8018d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018d5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018d8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8018db:	cd 30                	int    $0x30
+  8018dd:	85 c0                	test   %eax,%eax
+  8018df:	7f 08                	jg     8018e9 <sys_copy_mem+0x2b>
+  8018e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e4:	5b                   	pop    %ebx
+  8018e5:	5e                   	pop    %esi
+  8018e6:	5f                   	pop    %edi
+  8018e7:	5d                   	pop    %ebp
+  8018e8:	c3                   	ret
+  8018e9:	83 ec 0c             	sub    $0xc,%esp
+  8018ec:	50                   	push   %eax
+  8018ed:	6a 17                	push   $0x17
+  8018ef:	68 ab 3e 80 00       	push   $0x803eab
+  8018f4:	6a 24                	push   $0x24
+  8018f6:	68 c8 3e 80 00       	push   $0x803ec8
+  8018fb:	e8 f1 ed ff ff       	call   8006f1 <_panic>
+
+00801900 <sys_get_perms>:
+  801900:	55                   	push   %ebp
+  801901:	89 e5                	mov    %esp,%ebp
+  801903:	57                   	push   %edi
+  801904:	56                   	push   %esi
+  801905:	53                   	push   %ebx
+  801906:	83 ec 0c             	sub    $0xc,%esp
+  801909:	be 00 00 00 00       	mov    $0x0,%esi
+  80190e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801911:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801914:	b8 18 00 00 00       	mov    $0x18,%eax
+  801919:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80191c:	89 f7                	mov    %esi,%edi
+  80191e:	cd 30                	int    $0x30
+  801920:	85 c0                	test   %eax,%eax
+  801922:	7f 08                	jg     80192c <sys_get_perms+0x2c>
+  801924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801927:	5b                   	pop    %ebx
+  801928:	5e                   	pop    %esi
+  801929:	5f                   	pop    %edi
+  80192a:	5d                   	pop    %ebp
+  80192b:	c3                   	ret
+  80192c:	83 ec 0c             	sub    $0xc,%esp
+  80192f:	50                   	push   %eax
+  801930:	6a 18                	push   $0x18
+  801932:	68 ab 3e 80 00       	push   $0x803eab
+  801937:	6a 24                	push   $0x24
+  801939:	68 c8 3e 80 00       	push   $0x803ec8
+  80193e:	e8 ae ed ff ff       	call   8006f1 <_panic>
+
+00801943 <sys_env_unsuspend>:
+  801943:	55                   	push   %ebp
+  801944:	89 e5                	mov    %esp,%ebp
+  801946:	57                   	push   %edi
+  801947:	56                   	push   %esi
+  801948:	53                   	push   %ebx
+  801949:	83 ec 0c             	sub    $0xc,%esp
+  80194c:	be 00 00 00 00       	mov    $0x0,%esi
+  801951:	8b 55 08             	mov    0x8(%ebp),%edx
+  801954:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801957:	b8 19 00 00 00       	mov    $0x19,%eax
+  80195c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80195f:	89 f7                	mov    %esi,%edi
+  801961:	cd 30                	int    $0x30
+  801963:	85 c0                	test   %eax,%eax
+  801965:	7f 08                	jg     80196f <sys_env_unsuspend+0x2c>
+  801967:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196a:	5b                   	pop    %ebx
+  80196b:	5e                   	pop    %esi
+  80196c:	5f                   	pop    %edi
+  80196d:	5d                   	pop    %ebp
+  80196e:	c3                   	ret
+  80196f:	83 ec 0c             	sub    $0xc,%esp
+  801972:	50                   	push   %eax
+  801973:	6a 19                	push   $0x19
+  801975:	68 ab 3e 80 00       	push   $0x803eab
+  80197a:	6a 24                	push   $0x24
+  80197c:	68 c8 3e 80 00       	push   $0x803ec8
+  801981:	e8 6b ed ff ff       	call   8006f1 <_panic>
+
+00801986 <sys_migrate>:
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	57                   	push   %edi
+  80198a:	56                   	push   %esi
+  80198b:	53                   	push   %ebx
+  80198c:	83 ec 0c             	sub    $0xc,%esp
+  80198f:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801994:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80199a:	76 11                	jbe    8019ad <sys_migrate+0x27>
+  80199c:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8019a1:	0f b6 08             	movzbl (%eax),%ecx
+  8019a4:	05 00 10 00 00       	add    $0x1000,%eax
+  8019a9:	39 d0                	cmp    %edx,%eax
+  8019ab:	72 f4                	jb     8019a1 <sys_migrate+0x1b>
+  8019ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8019ba:	89 cb                	mov    %ecx,%ebx
+  8019bc:	89 cf                	mov    %ecx,%edi
+  8019be:	89 ce                	mov    %ecx,%esi
+  8019c0:	cd 30                	int    $0x30
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	7f 08                	jg     8019ce <sys_migrate+0x48>
+  8019c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c9:	5b                   	pop    %ebx
+  8019ca:	5e                   	pop    %esi
+  8019cb:	5f                   	pop    %edi
+  8019cc:	5d                   	pop    %ebp
+  8019cd:	c3                   	ret
+  8019ce:	83 ec 0c             	sub    $0xc,%esp
+  8019d1:	50                   	push   %eax
+  8019d2:	6a 1a                	push   $0x1a
+  8019d4:	68 ab 3e 80 00       	push   $0x803eab
+  8019d9:	6a 24                	push   $0x24
+  8019db:	68 c8 3e 80 00       	push   $0x803ec8
+  8019e0:	e8 0c ed ff ff       	call   8006f1 <_panic>
+
+008019e5 <sys_lease_complete>:
+  8019e5:	55                   	push   %ebp
+  8019e6:	89 e5                	mov    %esp,%ebp
+  8019e8:	57                   	push   %edi
+  8019e9:	56                   	push   %esi
+  8019ea:	53                   	push   %ebx
+  8019eb:	83 ec 0c             	sub    $0xc,%esp
+  8019ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8019f8:	89 d1                	mov    %edx,%ecx
+  8019fa:	89 d3                	mov    %edx,%ebx
+  8019fc:	89 d7                	mov    %edx,%edi
+  8019fe:	89 d6                	mov    %edx,%esi
+  801a00:	cd 30                	int    $0x30
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	7f 08                	jg     801a0e <sys_lease_complete+0x29>
+  801a06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a09:	5b                   	pop    %ebx
+  801a0a:	5e                   	pop    %esi
+  801a0b:	5f                   	pop    %edi
+  801a0c:	5d                   	pop    %ebp
+  801a0d:	c3                   	ret
+  801a0e:	83 ec 0c             	sub    $0xc,%esp
+  801a11:	50                   	push   %eax
+  801a12:	6a 1b                	push   $0x1b
+  801a14:	68 ab 3e 80 00       	push   $0x803eab
+  801a19:	6a 24                	push   $0x24
+  801a1b:	68 c8 3e 80 00       	push   $0x803ec8
+  801a20:	e8 cc ec ff ff       	call   8006f1 <_panic>
+
+00801a25 <sys_env_set_thisenv>:
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	57                   	push   %edi
+  801a29:	56                   	push   %esi
+  801a2a:	53                   	push   %ebx
+  801a2b:	83 ec 0c             	sub    $0xc,%esp
+  801a2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a39:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801a3e:	89 df                	mov    %ebx,%edi
+  801a40:	89 de                	mov    %ebx,%esi
+  801a42:	cd 30                	int    $0x30
+  801a44:	85 c0                	test   %eax,%eax
+  801a46:	7f 08                	jg     801a50 <sys_env_set_thisenv+0x2b>
+  801a48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4b:	5b                   	pop    %ebx
+  801a4c:	5e                   	pop    %esi
+  801a4d:	5f                   	pop    %edi
+  801a4e:	5d                   	pop    %ebp
+  801a4f:	c3                   	ret
+  801a50:	83 ec 0c             	sub    $0xc,%esp
+  801a53:	50                   	push   %eax
+  801a54:	6a 1c                	push   $0x1c
+  801a56:	68 ab 3e 80 00       	push   $0x803eab
+  801a5b:	6a 24                	push   $0x24
+  801a5d:	68 c8 3e 80 00       	push   $0x803ec8
+  801a62:	e8 8a ec ff ff       	call   8006f1 <_panic>
+
+00801a67 <sys_env_set_sched>:
+  801a67:	55                   	push   %ebp
+  801a68:	89 e5                	mov    %esp,%ebp
+  801a6a:	57                   	push   %edi
+  801a6b:	56                   	push   %esi
+  801a6c:	53                   	push   %ebx
+  801a6d:	83 ec 0c             	sub    $0xc,%esp
+  801a70:	be 00 00 00 00       	mov    $0x0,%esi
+  801a75:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a7b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801a80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a83:	89 f7                	mov    %esi,%edi
+  801a85:	cd 30                	int    $0x30
+  801a87:	85 c0                	test   %eax,%eax
+  801a89:	7f 08                	jg     801a93 <sys_env_set_sched+0x2c>
+  801a8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a8e:	5b                   	pop    %ebx
+  801a8f:	5e                   	pop    %esi
+  801a90:	5f                   	pop    %edi
+  801a91:	5d                   	pop    %ebp
+  801a92:	c3                   	ret
+  801a93:	83 ec 0c             	sub    $0xc,%esp
+  801a96:	50                   	push   %eax
+  801a97:	6a 1d                	push   $0x1d
+  801a99:	68 ab 3e 80 00       	push   $0x803eab
+  801a9e:	6a 24                	push   $0x24
+  801aa0:	68 c8 3e 80 00       	push   $0x803ec8
+  801aa5:	e8 47 ec ff ff       	call   8006f1 <_panic>
+
+00801aaa <sys_batch>:
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	57                   	push   %edi
+  801aae:	56                   	push   %esi
+  801aaf:	53                   	push   %ebx
+  801ab0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801abb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801ac0:	89 df                	mov    %ebx,%edi
+  801ac2:	89 de                	mov    %ebx,%esi
+  801ac4:	cd 30                	int    $0x30
+  801ac6:	5b                   	pop    %ebx
+  801ac7:	5e                   	pop    %esi
+  801ac8:	5f                   	pop    %edi
+  801ac9:	5d                   	pop    %ebp
+  801aca:	c3                   	ret
+
+00801acb <sys_env_stats>:
+  801acb:	55                   	push   %ebp
+  801acc:	89 e5                	mov    %esp,%ebp
+  801ace:	57                   	push   %edi
+  801acf:	56                   	push   %esi
+  801ad0:	53                   	push   %ebx
+  801ad1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801adc:	b8 23 00 00 00       	mov    $0x23,%eax
+  801ae1:	89 df                	mov    %ebx,%edi
+  801ae3:	89 de                	mov    %ebx,%esi
+  801ae5:	cd 30                	int    $0x30
+  801ae7:	5b                   	pop    %ebx
+  801ae8:	5e                   	pop    %esi
+  801ae9:	5f                   	pop    %edi
+  801aea:	5d                   	pop    %ebp
+  801aeb:	c3                   	ret
+
+00801aec <sys_trace>:
+  801aec:	55                   	push   %ebp
+  801aed:	89 e5                	mov    %esp,%ebp
+  801aef:	57                   	push   %edi
+  801af0:	56                   	push   %esi
+  801af1:	53                   	push   %ebx
+  801af2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afa:	b8 24 00 00 00       	mov    $0x24,%eax
+  801aff:	89 cb                	mov    %ecx,%ebx
+  801b01:	89 cf                	mov    %ecx,%edi
+  801b03:	89 ce                	mov    %ecx,%esi
+  801b05:	cd 30                	int    $0x30
+  801b07:	5b                   	pop    %ebx
+  801b08:	5e                   	pop    %esi
+  801b09:	5f                   	pop    %edi
+  801b0a:	5d                   	pop    %ebp
+  801b0b:	c3                   	ret
+
+00801b0c <sys_env_set_pager>:
+  801b0c:	55                   	push   %ebp
+  801b0d:	89 e5                	mov    %esp,%ebp
+  801b0f:	57                   	push   %edi
+  801b10:	56                   	push   %esi
+  801b11:	53                   	push   %ebx
+  801b12:	83 ec 0c             	sub    $0xc,%esp
+  801b15:	be 00 00 00 00       	mov    $0x0,%esi
+  801b1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b20:	b8 25 00 00 00       	mov    $0x25,%eax
+  801b25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b28:	89 f7                	mov    %esi,%edi
+  801b2a:	cd 30                	int    $0x30
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	7f 08                	jg     801b38 <sys_env_set_pager+0x2c>
+  801b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b33:	5b                   	pop    %ebx
+  801b34:	5e                   	pop    %esi
+  801b35:	5f                   	pop    %edi
+  801b36:	5d                   	pop    %ebp
+  801b37:	c3                   	ret
+  801b38:	83 ec 0c             	sub    $0xc,%esp
+  801b3b:	50                   	push   %eax
+  801b3c:	6a 25                	push   $0x25
+  801b3e:	68 ab 3e 80 00       	push   $0x803eab
+  801b43:	6a 24                	push   $0x24
+  801b45:	68 c8 3e 80 00       	push   $0x803ec8
+  801b4a:	e8 a2 eb ff ff       	call   8006f1 <_panic>
+
+00801b4f <sys_pager_retire>:
+  801b4f:	55                   	push   %ebp
+  801b50:	89 e5                	mov    %esp,%ebp
+  801b52:	57                   	push   %edi
+  801b53:	56                   	push   %esi
+  801b54:	53                   	push   %ebx
+  801b55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5d:	b8 28 00 00 00       	mov    $0x28,%eax
+  801b62:	89 cb                	mov    %ecx,%ebx
+  801b64:	89 cf                	mov    %ecx,%edi
+  801b66:	89 ce                	mov    %ecx,%esi
+  801b68:	cd 30                	int    $0x30
+  801b6a:	5b                   	pop    %ebx
+  801b6b:	5e                   	pop    %esi
+  801b6c:	5f                   	pop    %edi
+  801b6d:	5d                   	pop    %ebp
+  801b6e:	c3                   	ret
+
+00801b6f <sys_prof>:
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	57                   	push   %edi
+  801b73:	56                   	push   %esi
+  801b74:	53                   	push   %ebx
+  801b75:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b80:	b8 22 00 00 00       	mov    $0x22,%eax
+  801b85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b88:	89 f7                	mov    %esi,%edi
+  801b8a:	cd 30                	int    $0x30
+  801b8c:	5b                   	pop    %ebx
+  801b8d:	5e                   	pop    %esi
+  801b8e:	5f                   	pop    %edi
+  801b8f:	5d                   	pop    %ebp
+  801b90:	c3                   	ret
+
+00801b91 <ipc_recv>:
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	56                   	push   %esi
+  801b95:	53                   	push   %ebx
+  801b96:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b9f:	85 c0                	test   %eax,%eax
+  801ba1:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801ba6:	0f 44 c2             	cmove  %edx,%eax
+  801ba9:	83 ec 0c             	sub    $0xc,%esp
+  801bac:	50                   	push   %eax
+  801bad:	e8 1c fa ff ff       	call   8015ce <sys_ipc_recv>
+  801bb2:	83 c4 10             	add    $0x10,%esp
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 2a                	js     801be3 <ipc_recv+0x52>
+  801bb9:	a1 10 60 80 00       	mov    0x806010,%eax
+  801bbe:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801bc4:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801bca:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801bd0:	85 f6                	test   %esi,%esi
+  801bd2:	74 02                	je     801bd6 <ipc_recv+0x45>
+  801bd4:	89 0e                	mov    %ecx,(%esi)
+  801bd6:	85 db                	test   %ebx,%ebx
+  801bd8:	74 02                	je     801bdc <ipc_recv+0x4b>
+  801bda:	89 13                	mov    %edx,(%ebx)
+  801bdc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bdf:	5b                   	pop    %ebx
+  801be0:	5e                   	pop    %esi
+  801be1:	5d                   	pop    %ebp
+  801be2:	c3                   	ret
+  801be3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bed:	eb e1                	jmp    801bd0 <ipc_recv+0x3f>
+
+00801bef <ipc_send>:
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	57                   	push   %edi
+  801bf3:	56                   	push   %esi
+  801bf4:	53                   	push   %ebx
+  801bf5:	83 ec 0c             	sub    $0xc,%esp
+  801bf8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801bfb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bfe:	8b 75 14             	mov    0x14(%ebp),%esi
+  801c01:	85 db                	test   %ebx,%ebx
+  801c03:	74 1e                	je     801c23 <ipc_send+0x34>
+  801c05:	56                   	push   %esi
+  801c06:	53                   	push   %ebx
+  801c07:	57                   	push   %edi
+  801c08:	ff 75 08             	push   0x8(%ebp)
+  801c0b:	e8 4b fa ff ff       	call   80165b <sys_ipc_send>
+  801c10:	83 c4 10             	add    $0x10,%esp
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	74 2a                	je     801c41 <ipc_send+0x52>
+  801c17:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c1a:	75 13                	jne    801c2f <ipc_send+0x40>
+  801c1c:	e8 b7 f6 ff ff       	call   8012d8 <sys_yield>
+  801c21:	eb e2                	jmp    801c05 <ipc_send+0x16>
+  801c23:	be 00 00 00 00       	mov    $0x0,%esi
+  801c28:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801c2d:	eb d6                	jmp    801c05 <ipc_send+0x16>
+  801c2f:	50                   	push   %eax
+  801c30:	68 d8 3e 80 00       	push   $0x803ed8
+  801c35:	6a 4f                	push   $0x4f
+  801c37:	68 1b 3f 80 00       	push   $0x803f1b
+  801c3c:	e8 b0 ea ff ff       	call   8006f1 <_panic>
+  801c41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c44:	5b                   	pop    %ebx
+  801c45:	5e                   	pop    %esi
+  801c46:	5f                   	pop    %edi
+  801c47:	5d                   	pop    %ebp
+  801c48:	c3                   	ret
+
+00801c49 <ipc_call>:
+  801c49:	55                   	push   %ebp
+  801c4a:	89 e5                	mov    %esp,%ebp
+  801c4c:	57                   	push   %edi
+  801c4d:	56                   	push   %esi
+  801c4e:	53                   	push   %ebx
+  801c4f:	83 ec 0c             	sub    $0xc,%esp
+  801c52:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c56:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801c5b:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801c5f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801c63:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801c68:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801c6c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801c70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c75:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801c79:	eb 05                	jmp    801c80 <ipc_call+0x37>
+  801c7b:	e8 58 f6 ff ff       	call   8012d8 <sys_yield>
+  801c80:	83 ec 0c             	sub    $0xc,%esp
+  801c83:	56                   	push   %esi
+  801c84:	53                   	push   %ebx
+  801c85:	57                   	push   %edi
+  801c86:	ff 75 0c             	push   0xc(%ebp)
+  801c89:	ff 75 08             	push   0x8(%ebp)
+  801c8c:	e8 1a fa ff ff       	call   8016ab <sys_ipc_call>
+  801c91:	83 c4 20             	add    $0x20,%esp
+  801c94:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c97:	74 e2                	je     801c7b <ipc_call+0x32>
+  801c99:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801c9c:	74 2d                	je     801ccb <ipc_call+0x82>
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	78 4f                	js     801cf1 <ipc_call+0xa8>
+  801ca2:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801ca6:	74 10                	je     801cb8 <ipc_call+0x6f>
+  801ca8:	a1 10 60 80 00       	mov    0x806010,%eax
+  801cad:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801cb3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801cb6:	89 02                	mov    %eax,(%edx)
+  801cb8:	a1 10 60 80 00       	mov    0x806010,%eax
+  801cbd:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cc6:	5b                   	pop    %ebx
+  801cc7:	5e                   	pop    %esi
+  801cc8:	5f                   	pop    %edi
+  801cc9:	5d                   	pop    %ebp
+  801cca:	c3                   	ret
+  801ccb:	ff 75 14             	push   0x14(%ebp)
+  801cce:	ff 75 10             	push   0x10(%ebp)
+  801cd1:	ff 75 0c             	push   0xc(%ebp)
+  801cd4:	ff 75 08             	push   0x8(%ebp)
+  801cd7:	e8 13 ff ff ff       	call   801bef <ipc_send>
+  801cdc:	83 c4 0c             	add    $0xc,%esp
+  801cdf:	ff 75 1c             	push   0x1c(%ebp)
+  801ce2:	ff 75 18             	push   0x18(%ebp)
+  801ce5:	6a 00                	push   $0x0
+  801ce7:	e8 a5 fe ff ff       	call   801b91 <ipc_recv>
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	eb d2                	jmp    801cc3 <ipc_call+0x7a>
+  801cf1:	50                   	push   %eax
+  801cf2:	68 25 3f 80 00       	push   $0x803f25
+  801cf7:	6a 6d                	push   $0x6d
+  801cf9:	68 1b 3f 80 00       	push   $0x803f1b
+  801cfe:	e8 ee e9 ff ff       	call   8006f1 <_panic>
+
+00801d03 <ipc_reply_recv>:
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	57                   	push   %edi
+  801d07:	56                   	push   %esi
+  801d08:	53                   	push   %ebx
+  801d09:	83 ec 0c             	sub    $0xc,%esp
+  801d0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d0f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801d12:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801d15:	85 db                	test   %ebx,%ebx
+  801d17:	0f 84 ac 00 00 00    	je     801dc9 <ipc_reply_recv+0xc6>
+  801d1d:	85 f6                	test   %esi,%esi
+  801d1f:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801d24:	0f 45 c6             	cmovne %esi,%eax
+  801d27:	83 ec 0c             	sub    $0xc,%esp
+  801d2a:	50                   	push   %eax
+  801d2b:	ff 75 14             	push   0x14(%ebp)
+  801d2e:	53                   	push   %ebx
+  801d2f:	ff 75 0c             	push   0xc(%ebp)
+  801d32:	ff 75 08             	push   0x8(%ebp)
+  801d35:	e8 92 f9 ff ff       	call   8016cc <sys_ipc_reply_recv>
+  801d3a:	83 c4 20             	add    $0x20,%esp
+  801d3d:	85 c0                	test   %eax,%eax
+  801d3f:	78 3a                	js     801d7b <ipc_reply_recv+0x78>
+  801d41:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801d45:	74 10                	je     801d57 <ipc_reply_recv+0x54>
+  801d47:	a1 10 60 80 00       	mov    0x806010,%eax
+  801d4c:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801d52:	8b 55 18             	mov    0x18(%ebp),%edx
+  801d55:	89 02                	mov    %eax,(%edx)
+  801d57:	85 ff                	test   %edi,%edi
+  801d59:	74 0d                	je     801d68 <ipc_reply_recv+0x65>
+  801d5b:	a1 10 60 80 00       	mov    0x806010,%eax
+  801d60:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801d66:	89 07                	mov    %eax,(%edi)
+  801d68:	a1 10 60 80 00       	mov    0x806010,%eax
+  801d6d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801d73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d76:	5b                   	pop    %ebx
+  801d77:	5e                   	pop    %esi
+  801d78:	5f                   	pop    %edi
+  801d79:	5d                   	pop    %ebp
+  801d7a:	c3                   	ret
+  801d7b:	ff 75 14             	push   0x14(%ebp)
+  801d7e:	53                   	push   %ebx
+  801d7f:	ff 75 0c             	push   0xc(%ebp)
+  801d82:	ff 75 08             	push   0x8(%ebp)
+  801d85:	e8 f4 f7 ff ff       	call   80157e <sys_ipc_try_send>
+  801d8a:	89 c2                	mov    %eax,%edx
+  801d8c:	c1 ea 1f             	shr    $0x1f,%edx
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801d95:	0f 95 c1             	setne  %cl
+  801d98:	84 d1                	test   %dl,%cl
+  801d9a:	74 05                	je     801da1 <ipc_reply_recv+0x9e>
+  801d9c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d9f:	75 12                	jne    801db3 <ipc_reply_recv+0xb0>
+  801da1:	83 ec 04             	sub    $0x4,%esp
+  801da4:	57                   	push   %edi
+  801da5:	56                   	push   %esi
+  801da6:	ff 75 18             	push   0x18(%ebp)
+  801da9:	e8 e3 fd ff ff       	call   801b91 <ipc_recv>
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	eb c0                	jmp    801d73 <ipc_reply_recv+0x70>
+  801db3:	83 ec 04             	sub    $0x4,%esp
+  801db6:	50                   	push   %eax
+  801db7:	ff 75 08             	push   0x8(%ebp)
+  801dba:	68 f8 3e 80 00       	push   $0x803ef8
+  801dbf:	e8 08 ea ff ff       	call   8007cc <cprintf>
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	eb d8                	jmp    801da1 <ipc_reply_recv+0x9e>
+  801dc9:	85 f6                	test   %esi,%esi
+  801dcb:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801dd0:	0f 45 c6             	cmovne %esi,%eax
+  801dd3:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801dd8:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801ddf:	e9 43 ff ff ff       	jmp    801d27 <ipc_reply_recv+0x24>
+
+00801de4 <ipc_find_env>:
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	83 ec 14             	sub    $0x14,%esp
+  801dea:	ff 75 08             	push   0x8(%ebp)
+  801ded:	e8 2a f7 ff ff       	call   80151c <sys_env_service>
+  801df2:	85 c0                	test   %eax,%eax
+  801df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df9:	0f 48 c2             	cmovs  %edx,%eax
+  801dfc:	c9                   	leave
+  801dfd:	c3                   	ret
+
+00801dfe <fd2num>:
+  801dfe:	55                   	push   %ebp
+  801dff:	89 e5                	mov    %esp,%ebp
+  801e01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e04:	05 00 00 00 30       	add    $0x30000000,%eax
+  801e09:	c1 e8 0c             	shr    $0xc,%eax
+  801e0c:	5d                   	pop    %ebp
+  801e0d:	c3                   	ret
+
+00801e0e <fd2data>:
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e14:	05 00 00 00 30       	add    $0x30000000,%eax
+  801e19:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801e1e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801e23:	5d                   	pop    %ebp
+  801e24:	c3                   	ret
+
+00801e25 <fd_alloc>:
+  801e25:	55                   	push   %ebp
+  801e26:	89 e5                	mov    %esp,%ebp
+  801e28:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801e2d:	89 c2                	mov    %eax,%edx
+  801e2f:	c1 ea 16             	shr    $0x16,%edx
+  801e32:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e39:	f6 c2 01             	test   $0x1,%dl
+  801e3c:	74 29                	je     801e67 <fd_alloc+0x42>
+  801e3e:	89 c2                	mov    %eax,%edx
+  801e40:	c1 ea 0c             	shr    $0xc,%edx
+  801e43:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e4a:	f6 c2 01             	test   $0x1,%dl
+  801e4d:	74 18                	je     801e67 <fd_alloc+0x42>
+  801e4f:	05 00 10 00 00       	add    $0x1000,%eax
+  801e54:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801e59:	75 d2                	jne    801e2d <fd_alloc+0x8>
+  801e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e60:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801e65:	eb 05                	jmp    801e6c <fd_alloc+0x47>
+  801e67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e6f:	89 02                	mov    %eax,(%edx)
+  801e71:	89 c8                	mov    %ecx,%eax
+  801e73:	5d                   	pop    %ebp
+  801e74:	c3                   	ret
+
+00801e75 <fd_lookup>:
+  801e75:	55                   	push   %ebp
+  801e76:	89 e5                	mov    %esp,%ebp
+  801e78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7b:	83 f8 1f             	cmp    $0x1f,%eax
+  801e7e:	77 30                	ja     801eb0 <fd_lookup+0x3b>
+  801e80:	c1 e0 0c             	shl    $0xc,%eax
+  801e83:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801e88:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e8e:	f6 c2 01             	test   $0x1,%dl
+  801e91:	74 24                	je     801eb7 <fd_lookup+0x42>
+  801e93:	89 c2                	mov    %eax,%edx
+  801e95:	c1 ea 0c             	shr    $0xc,%edx
+  801e98:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e9f:	f6 c2 01             	test   $0x1,%dl
+  801ea2:	74 1a                	je     801ebe <fd_lookup+0x49>
+  801ea4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ea7:	89 02                	mov    %eax,(%edx)
+  801ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eae:	5d                   	pop    %ebp
+  801eaf:	c3                   	ret
+  801eb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb5:	eb f7                	jmp    801eae <fd_lookup+0x39>
+  801eb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ebc:	eb f0                	jmp    801eae <fd_lookup+0x39>
+  801ebe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec3:	eb e9                	jmp    801eae <fd_lookup+0x39>
+
+00801ec5 <dev_lookup>:
+  801ec5:	55                   	push   %ebp
+  801ec6:	89 e5                	mov    %esp,%ebp
+  801ec8:	53                   	push   %ebx
+  801ec9:	83 ec 04             	sub    $0x4,%esp
+  801ecc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed4:	bb 08 50 80 00       	mov    $0x805008,%ebx
+  801ed9:	39 13                	cmp    %edx,(%ebx)
+  801edb:	74 37                	je     801f14 <dev_lookup+0x4f>
+  801edd:	83 c0 01             	add    $0x1,%eax
+  801ee0:	8b 1c 85 c0 3f 80 00 	mov    0x803fc0(,%eax,4),%ebx
+  801ee7:	85 db                	test   %ebx,%ebx
+  801ee9:	75 ee                	jne    801ed9 <dev_lookup+0x14>
+  801eeb:	a1 10 60 80 00       	mov    0x806010,%eax
+  801ef0:	8b 40 48             	mov    0x48(%eax),%eax
+  801ef3:	83 ec 04             	sub    $0x4,%esp
+  801ef6:	52                   	push   %edx
+  801ef7:	50                   	push   %eax
+  801ef8:	68 44 3f 80 00       	push   $0x803f44
+  801efd:	e8 ca e8 ff ff       	call   8007cc <cprintf>
+  801f02:	83 c4 10             	add    $0x10,%esp
+  801f05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f0d:	89 1a                	mov    %ebx,(%edx)
+  801f0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f12:	c9                   	leave
+  801f13:	c3                   	ret
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f19:	eb ef                	jmp    801f0a <dev_lookup+0x45>
+
+00801f1b <fd_close>:
+  801f1b:	55                   	push   %ebp
+  801f1c:	89 e5                	mov    %esp,%ebp
+  801f1e:	57                   	push   %edi
+  801f1f:	56                   	push   %esi
+  801f20:	53                   	push   %ebx
+  801f21:	83 ec 24             	sub    $0x24,%esp
+  801f24:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f27:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f2a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f2d:	50                   	push   %eax
+  801f2e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801f34:	c1 e8 0c             	shr    $0xc,%eax
+  801f37:	50                   	push   %eax
+  801f38:	e8 38 ff ff ff       	call   801e75 <fd_lookup>
+  801f3d:	89 c3                	mov    %eax,%ebx
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 05                	js     801f4b <fd_close+0x30>
+  801f46:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801f49:	74 0f                	je     801f5a <fd_close+0x3f>
+  801f4b:	85 ff                	test   %edi,%edi
+  801f4d:	0f 44 df             	cmove  %edi,%ebx
+  801f50:	89 d8                	mov    %ebx,%eax
+  801f52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5f                   	pop    %edi
+  801f58:	5d                   	pop    %ebp
+  801f59:	c3                   	ret
+  801f5a:	83 ec 08             	sub    $0x8,%esp
+  801f5d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f60:	50                   	push   %eax
+  801f61:	ff 36                	push   (%esi)
+  801f63:	e8 5d ff ff ff       	call   801ec5 <dev_lookup>
+  801f68:	89 c3                	mov    %eax,%ebx
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	78 1a                	js     801f8b <fd_close+0x70>
+  801f71:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f74:	8b 40 10             	mov    0x10(%eax),%eax
+  801f77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	74 0b                	je     801f8b <fd_close+0x70>
+  801f80:	83 ec 0c             	sub    $0xc,%esp
+  801f83:	56                   	push   %esi
+  801f84:	ff d0                	call   *%eax
+  801f86:	89 c3                	mov    %eax,%ebx
+  801f88:	83 c4 10             	add    $0x10,%esp
+  801f8b:	83 ec 08             	sub    $0x8,%esp
+  801f8e:	56                   	push   %esi
+  801f8f:	6a 00                	push   $0x0
+  801f91:	e8 5f f4 ff ff       	call   8013f5 <sys_page_unmap>
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	eb b5                	jmp    801f50 <fd_close+0x35>
+
+00801f9b <close>:
+  801f9b:	55                   	push   %ebp
+  801f9c:	89 e5                	mov    %esp,%ebp
+  801f9e:	83 ec 20             	sub    $0x20,%esp
+  801fa1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fa4:	50                   	push   %eax
+  801fa5:	ff 75 08             	push   0x8(%ebp)
+  801fa8:	e8 c8 fe ff ff       	call   801e75 <fd_lookup>
+  801fad:	83 c4 10             	add    $0x10,%esp
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	79 02                	jns    801fb6 <close+0x1b>
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+  801fb6:	83 ec 08             	sub    $0x8,%esp
+  801fb9:	6a 01                	push   $0x1
+  801fbb:	ff 75 f4             	push   -0xc(%ebp)
+  801fbe:	e8 58 ff ff ff       	call   801f1b <fd_close>
+  801fc3:	83 c4 10             	add    $0x10,%esp
+  801fc6:	eb ec                	jmp    801fb4 <close+0x19>
+
+00801fc8 <close_all>:
+  801fc8:	55                   	push   %ebp
+  801fc9:	89 e5                	mov    %esp,%ebp
+  801fcb:	53                   	push   %ebx
+  801fcc:	83 ec 04             	sub    $0x4,%esp
+  801fcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fd4:	83 ec 0c             	sub    $0xc,%esp
+  801fd7:	53                   	push   %ebx
+  801fd8:	e8 be ff ff ff       	call   801f9b <close>
+  801fdd:	83 c3 01             	add    $0x1,%ebx
+  801fe0:	83 c4 10             	add    $0x10,%esp
+  801fe3:	83 fb 20             	cmp    $0x20,%ebx
+  801fe6:	75 ec                	jne    801fd4 <close_all+0xc>
+  801fe8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801feb:	c9                   	leave
+  801fec:	c3                   	ret
+
+00801fed <dup>:
+  801fed:	55                   	push   %ebp
+  801fee:	89 e5                	mov    %esp,%ebp
+  801ff0:	57                   	push   %edi
+  801ff1:	56                   	push   %esi
+  801ff2:	53                   	push   %ebx
+  801ff3:	83 ec 34             	sub    $0x34,%esp
+  801ff6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ff9:	50                   	push   %eax
+  801ffa:	ff 75 08             	push   0x8(%ebp)
+  801ffd:	e8 73 fe ff ff       	call   801e75 <fd_lookup>
+  802002:	89 c3                	mov    %eax,%ebx
+  802004:	83 c4 10             	add    $0x10,%esp
+  802007:	85 c0                	test   %eax,%eax
+  802009:	78 7f                	js     80208a <dup+0x9d>
+  80200b:	83 ec 0c             	sub    $0xc,%esp
+  80200e:	ff 75 0c             	push   0xc(%ebp)
+  802011:	e8 85 ff ff ff       	call   801f9b <close>
+  802016:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802019:	c1 e6 0c             	shl    $0xc,%esi
+  80201c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  802022:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802025:	89 3c 24             	mov    %edi,(%esp)
+  802028:	e8 e1 fd ff ff       	call   801e0e <fd2data>
+  80202d:	89 c3                	mov    %eax,%ebx
+  80202f:	89 34 24             	mov    %esi,(%esp)
+  802032:	e8 d7 fd ff ff       	call   801e0e <fd2data>
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80203d:	89 d8                	mov    %ebx,%eax
+  80203f:	c1 e8 16             	shr    $0x16,%eax
+  802042:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802049:	a8 01                	test   $0x1,%al
+  80204b:	74 11                	je     80205e <dup+0x71>
+  80204d:	89 d8                	mov    %ebx,%eax
+  80204f:	c1 e8 0c             	shr    $0xc,%eax
+  802052:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802059:	f6 c2 01             	test   $0x1,%dl
+  80205c:	75 36                	jne    802094 <dup+0xa7>
+  80205e:	89 f8                	mov    %edi,%eax
+  802060:	c1 e8 0c             	shr    $0xc,%eax
+  802063:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80206a:	83 ec 0c             	sub    $0xc,%esp
+  80206d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802072:	50                   	push   %eax
+  802073:	56                   	push   %esi
+  802074:	6a 00                	push   $0x0
+  802076:	57                   	push   %edi
+  802077:	6a 00                	push   $0x0
+  802079:	e8 e8 f2 ff ff       	call   801366 <sys_page_map>
+  80207e:	89 c3                	mov    %eax,%ebx
+  802080:	83 c4 20             	add    $0x20,%esp
+  802083:	85 c0                	test   %eax,%eax
+  802085:	78 33                	js     8020ba <dup+0xcd>
+  802087:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80208a:	89 d8                	mov    %ebx,%eax
+  80208c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80208f:	5b                   	pop    %ebx
+  802090:	5e                   	pop    %esi
+  802091:	5f                   	pop    %edi
+  802092:	5d                   	pop    %ebp
+  802093:	c3                   	ret
+  802094:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80209b:	83 ec 0c             	sub    $0xc,%esp
+  80209e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8020a3:	50                   	push   %eax
+  8020a4:	ff 75 d4             	push   -0x2c(%ebp)
+  8020a7:	6a 00                	push   $0x0
+  8020a9:	53                   	push   %ebx
+  8020aa:	6a 00                	push   $0x0
+  8020ac:	e8 b5 f2 ff ff       	call   801366 <sys_page_map>
+  8020b1:	89 c3                	mov    %eax,%ebx
+  8020b3:	83 c4 20             	add    $0x20,%esp
+  8020b6:	85 c0                	test   %eax,%eax
+  8020b8:	79 a4                	jns    80205e <dup+0x71>
+  8020ba:	83 ec 08             	sub    $0x8,%esp
+  8020bd:	56                   	push   %esi
+  8020be:	6a 00                	push   $0x0
+  8020c0:	e8 30 f3 ff ff       	call   8013f5 <sys_page_unmap>
+  8020c5:	83 c4 08             	add    $0x8,%esp
+  8020c8:	ff 75 d4             	push   -0x2c(%ebp)
+  8020cb:	6a 00                	push   $0x0
+  8020cd:	e8 23 f3 ff ff       	call   8013f5 <sys_page_unmap>
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	eb b3                	jmp    80208a <dup+0x9d>
+
+008020d7 <read>:
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	56                   	push   %esi
+  8020db:	53                   	push   %ebx
+  8020dc:	83 ec 18             	sub    $0x18,%esp
+  8020df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020e5:	50                   	push   %eax
+  8020e6:	56                   	push   %esi
+  8020e7:	e8 89 fd ff ff       	call   801e75 <fd_lookup>
+  8020ec:	83 c4 10             	add    $0x10,%esp
+  8020ef:	85 c0                	test   %eax,%eax
+  8020f1:	78 3c                	js     80212f <read+0x58>
+  8020f3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8020f6:	83 ec 08             	sub    $0x8,%esp
+  8020f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020fc:	50                   	push   %eax
+  8020fd:	ff 33                	push   (%ebx)
+  8020ff:	e8 c1 fd ff ff       	call   801ec5 <dev_lookup>
+  802104:	83 c4 10             	add    $0x10,%esp
+  802107:	85 c0                	test   %eax,%eax
+  802109:	78 24                	js     80212f <read+0x58>
+  80210b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80210e:	83 e0 03             	and    $0x3,%eax
+  802111:	83 f8 01             	cmp    $0x1,%eax
+  802114:	74 20                	je     802136 <read+0x5f>
+  802116:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802119:	8b 40 08             	mov    0x8(%eax),%eax
+  80211c:	85 c0                	test   %eax,%eax
+  80211e:	74 37                	je     802157 <read+0x80>
+  802120:	83 ec 04             	sub    $0x4,%esp
+  802123:	ff 75 10             	push   0x10(%ebp)
+  802126:	ff 75 0c             	push   0xc(%ebp)
+  802129:	53                   	push   %ebx
+  80212a:	ff d0                	call   *%eax
+  80212c:	83 c4 10             	add    $0x10,%esp
+  80212f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802132:	5b                   	pop    %ebx
+  802133:	5e                   	pop    %esi
+  802134:	5d                   	pop    %ebp
+  802135:	c3                   	ret
+  802136:	a1 10 60 80 00       	mov    0x806010,%eax
+  80213b:	8b 40 48             	mov    0x48(%eax),%eax
+  80213e:	83 ec 04             	sub    $0x4,%esp
+  802141:	56                   	push   %esi
+  802142:	50                   	push   %eax
+  802143:	68 85 3f 80 00       	push   $0x803f85
+  802148:	e8 7f e6 ff ff       	call   8007cc <cprintf>
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802155:	eb d8                	jmp    80212f <read+0x58>
+  802157:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80215c:	eb d1                	jmp    80212f <read+0x58>
+
+0080215e <readn>:
+  80215e:	55                   	push   %ebp
+  80215f:	89 e5                	mov    %esp,%ebp
+  802161:	57                   	push   %edi
+  802162:	56                   	push   %esi
+  802163:	53                   	push   %ebx
+  802164:	83 ec 0c             	sub    $0xc,%esp
+  802167:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80216a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80216d:	85 f6                	test   %esi,%esi
+  80216f:	74 30                	je     8021a1 <readn+0x43>
+  802171:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217b:	83 ec 04             	sub    $0x4,%esp
+  80217e:	89 f2                	mov    %esi,%edx
+  802180:	29 c2                	sub    %eax,%edx
+  802182:	52                   	push   %edx
+  802183:	01 f8                	add    %edi,%eax
+  802185:	50                   	push   %eax
+  802186:	ff 75 08             	push   0x8(%ebp)
+  802189:	e8 49 ff ff ff       	call   8020d7 <read>
+  80218e:	83 c4 10             	add    $0x10,%esp
+  802191:	85 c0                	test   %eax,%eax
+  802193:	78 15                	js     8021aa <readn+0x4c>
+  802195:	74 11                	je     8021a8 <readn+0x4a>
+  802197:	01 c3                	add    %eax,%ebx
+  802199:	89 d8                	mov    %ebx,%eax
+  80219b:	39 f3                	cmp    %esi,%ebx
+  80219d:	72 dc                	jb     80217b <readn+0x1d>
+  80219f:	eb 09                	jmp    8021aa <readn+0x4c>
+  8021a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a6:	eb 02                	jmp    8021aa <readn+0x4c>
+  8021a8:	89 d8                	mov    %ebx,%eax
+  8021aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ad:	5b                   	pop    %ebx
+  8021ae:	5e                   	pop    %esi
+  8021af:	5f                   	pop    %edi
+  8021b0:	5d                   	pop    %ebp
+  8021b1:	c3                   	ret
+
+008021b2 <write>:
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	56                   	push   %esi
+  8021b6:	53                   	push   %ebx
+  8021b7:	83 ec 18             	sub    $0x18,%esp
+  8021ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021c0:	50                   	push   %eax
+  8021c1:	53                   	push   %ebx
+  8021c2:	e8 ae fc ff ff       	call   801e75 <fd_lookup>
+  8021c7:	83 c4 10             	add    $0x10,%esp
+  8021ca:	85 c0                	test   %eax,%eax
+  8021cc:	78 37                	js     802205 <write+0x53>
+  8021ce:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021d1:	83 ec 08             	sub    $0x8,%esp
+  8021d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d7:	50                   	push   %eax
+  8021d8:	ff 36                	push   (%esi)
+  8021da:	e8 e6 fc ff ff       	call   801ec5 <dev_lookup>
+  8021df:	83 c4 10             	add    $0x10,%esp
+  8021e2:	85 c0                	test   %eax,%eax
+  8021e4:	78 1f                	js     802205 <write+0x53>
+  8021e6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021ea:	74 20                	je     80220c <write+0x5a>
+  8021ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021f2:	85 c0                	test   %eax,%eax
+  8021f4:	74 37                	je     80222d <write+0x7b>
+  8021f6:	83 ec 04             	sub    $0x4,%esp
+  8021f9:	ff 75 10             	push   0x10(%ebp)
+  8021fc:	ff 75 0c             	push   0xc(%ebp)
+  8021ff:	56                   	push   %esi
+  802200:	ff d0                	call   *%eax
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802208:	5b                   	pop    %ebx
+  802209:	5e                   	pop    %esi
+  80220a:	5d                   	pop    %ebp
+  80220b:	c3                   	ret
+  80220c:	a1 10 60 80 00       	mov    0x806010,%eax
+  802211:	8b 40 48             	mov    0x48(%eax),%eax
+  802214:	83 ec 04             	sub    $0x4,%esp
+  802217:	53                   	push   %ebx
+  802218:	50                   	push   %eax
+  802219:	68 a1 3f 80 00       	push   $0x803fa1
+  80221e:	e8 a9 e5 ff ff       	call   8007cc <cprintf>
+  802223:	83 c4 10             	add    $0x10,%esp
+  802226:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80222b:	eb d8                	jmp    802205 <write+0x53>
+  80222d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802232:	eb d1                	jmp    802205 <write+0x53>
+
+00802234 <seek>:
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	83 ec 20             	sub    $0x20,%esp
+  80223a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80223d:	50                   	push   %eax
+  80223e:	ff 75 08             	push   0x8(%ebp)
+  802241:	e8 2f fc ff ff       	call   801e75 <fd_lookup>
+  802246:	83 c4 10             	add    $0x10,%esp
+  802249:	85 c0                	test   %eax,%eax
+  80224b:	78 0e                	js     80225b <seek+0x27>
+  80224d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802250:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802253:	89 50 04             	mov    %edx,0x4(%eax)
+  802256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225b:	c9                   	leave
+  80225c:	c3                   	ret
+
+0080225d <ftruncate>:
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	56                   	push   %esi
+  802261:	53                   	push   %ebx
+  802262:	83 ec 18             	sub    $0x18,%esp
+  802265:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802268:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80226b:	50                   	push   %eax
+  80226c:	53                   	push   %ebx
+  80226d:	e8 03 fc ff ff       	call   801e75 <fd_lookup>
+  802272:	83 c4 10             	add    $0x10,%esp
+  802275:	85 c0                	test   %eax,%eax
+  802277:	78 34                	js     8022ad <ftruncate+0x50>
+  802279:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80227c:	83 ec 08             	sub    $0x8,%esp
+  80227f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802282:	50                   	push   %eax
+  802283:	ff 36                	push   (%esi)
+  802285:	e8 3b fc ff ff       	call   801ec5 <dev_lookup>
+  80228a:	83 c4 10             	add    $0x10,%esp
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	78 1c                	js     8022ad <ftruncate+0x50>
+  802291:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802295:	74 1d                	je     8022b4 <ftruncate+0x57>
+  802297:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80229a:	8b 40 18             	mov    0x18(%eax),%eax
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	74 34                	je     8022d5 <ftruncate+0x78>
+  8022a1:	83 ec 08             	sub    $0x8,%esp
+  8022a4:	ff 75 0c             	push   0xc(%ebp)
+  8022a7:	56                   	push   %esi
+  8022a8:	ff d0                	call   *%eax
+  8022aa:	83 c4 10             	add    $0x10,%esp
+  8022ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022b0:	5b                   	pop    %ebx
+  8022b1:	5e                   	pop    %esi
+  8022b2:	5d                   	pop    %ebp
+  8022b3:	c3                   	ret
+  8022b4:	a1 10 60 80 00       	mov    0x806010,%eax
+  8022b9:	8b 40 48             	mov    0x48(%eax),%eax
+  8022bc:	83 ec 04             	sub    $0x4,%esp
+  8022bf:	53                   	push   %ebx
+  8022c0:	50                   	push   %eax
+  8022c1:	68 64 3f 80 00       	push   $0x803f64
+  8022c6:	e8 01 e5 ff ff       	call   8007cc <cprintf>
+  8022cb:	83 c4 10             	add    $0x10,%esp
+  8022ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022d3:	eb d8                	jmp    8022ad <ftruncate+0x50>
+  8022d5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022da:	eb d1                	jmp    8022ad <ftruncate+0x50>
+
+008022dc <fstat>:
+  8022dc:	55                   	push   %ebp
+  8022dd:	89 e5                	mov    %esp,%ebp
+  8022df:	56                   	push   %esi
+  8022e0:	53                   	push   %ebx
+  8022e1:	83 ec 18             	sub    $0x18,%esp
+  8022e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022ea:	50                   	push   %eax
+  8022eb:	ff 75 08             	push   0x8(%ebp)
+  8022ee:	e8 82 fb ff ff       	call   801e75 <fd_lookup>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	78 49                	js     802343 <fstat+0x67>
+  8022fa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022fd:	83 ec 08             	sub    $0x8,%esp
+  802300:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802303:	50                   	push   %eax
+  802304:	ff 36                	push   (%esi)
+  802306:	e8 ba fb ff ff       	call   801ec5 <dev_lookup>
+  80230b:	83 c4 10             	add    $0x10,%esp
+  80230e:	85 c0                	test   %eax,%eax
+  802310:	78 31                	js     802343 <fstat+0x67>
+  802312:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802315:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802319:	74 2f                	je     80234a <fstat+0x6e>
+  80231b:	c6 03 00             	movb   $0x0,(%ebx)
+  80231e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802325:	00 00 00 
+  802328:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80232f:	00 00 00 
+  802332:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802338:	83 ec 08             	sub    $0x8,%esp
+  80233b:	53                   	push   %ebx
+  80233c:	56                   	push   %esi
+  80233d:	ff 50 14             	call   *0x14(%eax)
+  802340:	83 c4 10             	add    $0x10,%esp
+  802343:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802346:	5b                   	pop    %ebx
+  802347:	5e                   	pop    %esi
+  802348:	5d                   	pop    %ebp
+  802349:	c3                   	ret
+  80234a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80234f:	eb f2                	jmp    802343 <fstat+0x67>
+
+00802351 <stat>:
+  802351:	55                   	push   %ebp
+  802352:	89 e5                	mov    %esp,%ebp
+  802354:	56                   	push   %esi
+  802355:	53                   	push   %ebx
+  802356:	83 ec 08             	sub    $0x8,%esp
+  802359:	6a 00                	push   $0x0
+  80235b:	ff 75 08             	push   0x8(%ebp)
+  80235e:	e8 31 05 00 00       	call   802894 <open>
+  802363:	89 c3                	mov    %eax,%ebx
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	85 c0                	test   %eax,%eax
+  80236a:	78 1b                	js     802387 <stat+0x36>
+  80236c:	83 ec 08             	sub    $0x8,%esp
+  80236f:	ff 75 0c             	push   0xc(%ebp)
+  802372:	50                   	push   %eax
+  802373:	e8 64 ff ff ff       	call   8022dc <fstat>
+  802378:	89 c6                	mov    %eax,%esi
+  80237a:	89 1c 24             	mov    %ebx,(%esp)
+  80237d:	e8 19 fc ff ff       	call   801f9b <close>
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	89 f3                	mov    %esi,%ebx
+  802387:	89 d8                	mov    %ebx,%eax
+  802389:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80238c:	5b                   	pop    %ebx
+  80238d:	5e                   	pop    %esi
+  80238e:	5d                   	pop    %ebp
+  80238f:	c3                   	ret
+
+00802390 <fsipc>:
+  802390:	55                   	push   %ebp
+  802391:	89 e5                	mov    %esp,%ebp
+  802393:	56                   	push   %esi
+  802394:	53                   	push   %ebx
+  802395:	89 c3                	mov    %eax,%ebx
+  802397:	89 d6                	mov    %edx,%esi
+  802399:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8023a0:	74 20                	je     8023c2 <fsipc+0x32>
+  8023a2:	83 ec 08             	sub    $0x8,%esp
+  8023a5:	6a 00                	push   $0x0
+  8023a7:	56                   	push   %esi
+  8023a8:	6a 07                	push   $0x7
+  8023aa:	68 00 70 80 00       	push   $0x807000
+  8023af:	53                   	push   %ebx
+  8023b0:	ff 35 08 60 80 00    	push   0x806008
+  8023b6:	e8 8e f8 ff ff       	call   801c49 <ipc_call>
+  8023bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023be:	5b                   	pop    %ebx
+  8023bf:	5e                   	pop    %esi
+  8023c0:	5d                   	pop    %ebp
+  8023c1:	c3                   	ret
+  8023c2:	83 ec 0c             	sub    $0xc,%esp
+  8023c5:	6a 02                	push   $0x2
+  8023c7:	e8 18 fa ff ff       	call   801de4 <ipc_find_env>
+  8023cc:	a3 08 60 80 00       	mov    %eax,0x806008
+  8023d1:	83 c4 10             	add    $0x10,%esp
+  8023d4:	eb cc                	jmp    8023a2 <fsipc+0x12>
+
+008023d6 <devfile_trunc>:
+  8023d6:	55                   	push   %ebp
+  8023d7:	89 e5                	mov    %esp,%ebp
+  8023d9:	83 ec 08             	sub    $0x8,%esp
+  8023dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023e2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8023e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023ea:	a3 04 70 80 00       	mov    %eax,0x807004
+  8023ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023f9:	e8 92 ff ff ff       	call   802390 <fsipc>
+  8023fe:	c9                   	leave
+  8023ff:	c3                   	ret
+
+00802400 <devfile_flush>:
+  802400:	55                   	push   %ebp
+  802401:	89 e5                	mov    %esp,%ebp
+  802403:	83 ec 08             	sub    $0x8,%esp
+  802406:	8b 45 08             	mov    0x8(%ebp),%eax
+  802409:	8b 40 0c             	mov    0xc(%eax),%eax
+  80240c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802411:	ba 00 00 00 00       	mov    $0x0,%edx
+  802416:	b8 08 00 00 00       	mov    $0x8,%eax
+  80241b:	e8 70 ff ff ff       	call   802390 <fsipc>
+  802420:	c9                   	leave
+  802421:	c3                   	ret
+
+00802422 <devfile_stat>:
+  802422:	55                   	push   %ebp
+  802423:	89 e5                	mov    %esp,%ebp
+  802425:	53                   	push   %ebx
+  802426:	83 ec 04             	sub    $0x4,%esp
+  802429:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80242c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802432:	a3 00 70 80 00       	mov    %eax,0x807000
+  802437:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802441:	e8 4a ff ff ff       	call   802390 <fsipc>
+  802446:	85 c0                	test   %eax,%eax
+  802448:	78 2c                	js     802476 <devfile_stat+0x54>
+  80244a:	83 ec 08             	sub    $0x8,%esp
+  80244d:	68 00 70 80 00       	push   $0x807000
+  802452:	53                   	push   %ebx
+  802453:	e8 6b ea ff ff       	call   800ec3 <strcpy>
+  802458:	a1 80 70 80 00       	mov    0x807080,%eax
+  80245d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802463:	a1 84 70 80 00       	mov    0x807084,%eax
+  802468:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80246e:	83 c4 10             	add    $0x10,%esp
+  802471:	b8 00 00 00 00       	mov    $0x0,%eax
+  802476:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+
+0080247b <fsring_rw>:
+  80247b:	55                   	push   %ebp
+  80247c:	89 e5                	mov    %esp,%ebp
+  80247e:	57                   	push   %edi
+  80247f:	56                   	push   %esi
+  802480:	53                   	push   %ebx
+  802481:	83 ec 2c             	sub    $0x2c,%esp
+  802484:	89 c7                	mov    %eax,%edi
+  802486:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802489:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80248c:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802491:	a8 01                	test   $0x1,%al
+  802493:	74 0d                	je     8024a2 <fsring_rw+0x27>
+  802495:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  80249a:	a8 01                	test   $0x1,%al
+  80249c:	0f 85 d5 00 00 00    	jne    802577 <fsring_rw+0xfc>
+  8024a2:	a1 10 60 80 00       	mov    0x806010,%eax
+  8024a7:	8b 40 48             	mov    0x48(%eax),%eax
+  8024aa:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  8024b0:	0f 84 fc 00 00 00    	je     8025b2 <fsring_rw+0x137>
+  8024b6:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8024bd:	0f 84 02 01 00 00    	je     8025c5 <fsring_rw+0x14a>
+  8024c3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8024c8:	83 ec 04             	sub    $0x4,%esp
+  8024cb:	68 07 02 00 00       	push   $0x207
+  8024d0:	53                   	push   %ebx
+  8024d1:	6a 00                	push   $0x0
+  8024d3:	e8 4b ee ff ff       	call   801323 <sys_page_alloc>
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	0f 88 f9 00 00 00    	js     8025dc <fsring_rw+0x161>
+  8024e3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024e9:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8024ef:	75 d7                	jne    8024c8 <fsring_rw+0x4d>
+  8024f1:	6a 0e                	push   $0xe
+  8024f3:	6a 0d                	push   $0xd
+  8024f5:	ff 35 08 60 80 00    	push   0x806008
+  8024fb:	68 00 00 f0 cf       	push   $0xcff00000
+  802500:	e8 c4 0c 00 00       	call   8031c9 <ipcring_init>
+  802505:	83 c4 08             	add    $0x8,%esp
+  802508:	6a 00                	push   $0x0
+  80250a:	6a 00                	push   $0x0
+  80250c:	68 07 02 00 00       	push   $0x207
+  802511:	68 00 00 f0 cf       	push   $0xcff00000
+  802516:	6a 0b                	push   $0xb
+  802518:	ff 35 08 60 80 00    	push   0x806008
+  80251e:	e8 26 f7 ff ff       	call   801c49 <ipc_call>
+  802523:	89 c6                	mov    %eax,%esi
+  802525:	83 c4 20             	add    $0x20,%esp
+  802528:	85 c0                	test   %eax,%eax
+  80252a:	0f 88 ac 00 00 00    	js     8025dc <fsring_rw+0x161>
+  802530:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802535:	89 d9                	mov    %ebx,%ecx
+  802537:	83 c3 01             	add    $0x1,%ebx
+  80253a:	89 da                	mov    %ebx,%edx
+  80253c:	c1 e2 0c             	shl    $0xc,%edx
+  80253f:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802545:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80254b:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802551:	83 ec 08             	sub    $0x8,%esp
+  802554:	6a 00                	push   $0x0
+  802556:	6a 00                	push   $0x0
+  802558:	68 07 02 00 00       	push   $0x207
+  80255d:	50                   	push   %eax
+  80255e:	6a 0c                	push   $0xc
+  802560:	ff 35 08 60 80 00    	push   0x806008
+  802566:	e8 de f6 ff ff       	call   801c49 <ipc_call>
+  80256b:	83 c4 20             	add    $0x20,%esp
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	78 6a                	js     8025dc <fsring_rw+0x161>
+  802572:	83 fb 08             	cmp    $0x8,%ebx
+  802575:	75 be                	jne    802535 <fsring_rw+0xba>
+  802577:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80257b:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802580:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802585:	0f 45 c2             	cmovne %edx,%eax
+  802588:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80258b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802592:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802599:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8025a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025aa:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8025ad:	e9 4b 01 00 00       	jmp    8026fd <fsring_rw+0x282>
+  8025b2:	e8 36 f1 ff ff       	call   8016ed <sys_time_msec>
+  8025b7:	3b 05 00 60 80 00    	cmp    0x806000,%eax
+  8025bd:	0f 89 f3 fe ff ff    	jns    8024b6 <fsring_rw+0x3b>
+  8025c3:	eb 54                	jmp    802619 <fsring_rw+0x19e>
+  8025c5:	83 ec 0c             	sub    $0xc,%esp
+  8025c8:	6a 02                	push   $0x2
+  8025ca:	e8 15 f8 ff ff       	call   801de4 <ipc_find_env>
+  8025cf:	a3 08 60 80 00       	mov    %eax,0x806008
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	e9 e7 fe ff ff       	jmp    8024c3 <fsring_rw+0x48>
+  8025dc:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8025e1:	83 ec 08             	sub    $0x8,%esp
+  8025e4:	53                   	push   %ebx
+  8025e5:	6a 00                	push   $0x0
+  8025e7:	e8 09 ee ff ff       	call   8013f5 <sys_page_unmap>
+  8025ec:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025f2:	83 c4 10             	add    $0x10,%esp
+  8025f5:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8025fb:	75 e4                	jne    8025e1 <fsring_rw+0x166>
+  8025fd:	e8 eb f0 ff ff       	call   8016ed <sys_time_msec>
+  802602:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802607:	a3 00 60 80 00       	mov    %eax,0x806000
+  80260c:	a1 10 60 80 00       	mov    0x806010,%eax
+  802611:	8b 40 48             	mov    0x48(%eax),%eax
+  802614:	a3 04 60 80 00       	mov    %eax,0x806004
+  802619:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802620:	e9 7a 01 00 00       	jmp    80279f <fsring_rw+0x324>
+  802625:	8b 57 0c             	mov    0xc(%edi),%edx
+  802628:	89 10                	mov    %edx,(%eax)
+  80262a:	89 58 04             	mov    %ebx,0x4(%eax)
+  80262d:	89 f2                	mov    %esi,%edx
+  80262f:	03 57 04             	add    0x4(%edi),%edx
+  802632:	89 50 08             	mov    %edx,0x8(%eax)
+  802635:	83 ec 04             	sub    $0x4,%esp
+  802638:	53                   	push   %ebx
+  802639:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80263c:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80263f:	52                   	push   %edx
+  802640:	83 c0 0c             	add    $0xc,%eax
+  802643:	50                   	push   %eax
+  802644:	e8 2a ea ff ff       	call   801073 <memmove>
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80264f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802652:	89 08                	mov    %ecx,(%eax)
+  802654:	83 ec 0c             	sub    $0xc,%esp
+  802657:	68 00 00 f0 cf       	push   $0xcff00000
+  80265c:	e8 c6 0b 00 00       	call   803227 <ipcring_req_push>
+  802661:	01 de                	add    %ebx,%esi
+  802663:	83 c4 10             	add    $0x10,%esp
+  802666:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802669:	73 4c                	jae    8026b7 <fsring_rw+0x23c>
+  80266b:	83 ec 0c             	sub    $0xc,%esp
+  80266e:	68 00 00 f0 cf       	push   $0xcff00000
+  802673:	e8 89 0b 00 00       	call   803201 <ipcring_req_slot>
+  802678:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	85 c0                	test   %eax,%eax
+  802680:	74 35                	je     8026b7 <fsring_rw+0x23c>
+  802682:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802687:	83 e0 07             	and    $0x7,%eax
+  80268a:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80268f:	c1 e0 0c             	shl    $0xc,%eax
+  802692:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802695:	29 f3                	sub    %esi,%ebx
+  802697:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80269a:	39 cb                	cmp    %ecx,%ebx
+  80269c:	0f 47 d9             	cmova  %ecx,%ebx
+  80269f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8026a3:	75 80                	jne    802625 <fsring_rw+0x1aa>
+  8026a5:	8b 57 0c             	mov    0xc(%edi),%edx
+  8026a8:	89 10                	mov    %edx,(%eax)
+  8026aa:	89 58 04             	mov    %ebx,0x4(%eax)
+  8026ad:	89 f2                	mov    %esi,%edx
+  8026af:	03 57 04             	add    0x4(%edi),%edx
+  8026b2:	89 50 08             	mov    %edx,0x8(%eax)
+  8026b5:	eb 95                	jmp    80264c <fsring_rw+0x1d1>
+  8026b7:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8026bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026bf:	83 ec 0c             	sub    $0xc,%esp
+  8026c2:	68 00 00 f0 cf       	push   $0xcff00000
+  8026c7:	e8 94 0b 00 00       	call   803260 <ipcring_rsp_wait>
+  8026cc:	8b 58 04             	mov    0x4(%eax),%ebx
+  8026cf:	83 c4 10             	add    $0x10,%esp
+  8026d2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8026d6:	75 45                	jne    80271d <fsring_rw+0x2a2>
+  8026d8:	85 db                	test   %ebx,%ebx
+  8026da:	79 41                	jns    80271d <fsring_rw+0x2a2>
+  8026dc:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8026df:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8026e6:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8026ed:	83 ec 0c             	sub    $0xc,%esp
+  8026f0:	68 00 00 f0 cf       	push   $0xcff00000
+  8026f5:	e8 cc 0b 00 00       	call   8032c6 <ipcring_rsp_pop>
+  8026fa:	83 c4 10             	add    $0x10,%esp
+  8026fd:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802703:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802708:	39 c2                	cmp    %eax,%edx
+  80270a:	74 75                	je     802781 <fsring_rw+0x306>
+  80270c:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802710:	75 a5                	jne    8026b7 <fsring_rw+0x23c>
+  802712:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802715:	0f 82 50 ff ff ff    	jb     80266b <fsring_rw+0x1f0>
+  80271b:	eb 9a                	jmp    8026b7 <fsring_rw+0x23c>
+  80271d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802721:	75 ca                	jne    8026ed <fsring_rw+0x272>
+  802723:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802727:	74 31                	je     80275a <fsring_rw+0x2df>
+  802729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80272c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80272f:	29 c8                	sub    %ecx,%eax
+  802731:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802734:	39 d0                	cmp    %edx,%eax
+  802736:	0f 47 c2             	cmova  %edx,%eax
+  802739:	39 d8                	cmp    %ebx,%eax
+  80273b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802740:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802744:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802747:	b8 01 00 00 00       	mov    $0x1,%eax
+  80274c:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802750:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802753:	01 d9                	add    %ebx,%ecx
+  802755:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802758:	eb 93                	jmp    8026ed <fsring_rw+0x272>
+  80275a:	83 ec 04             	sub    $0x4,%esp
+  80275d:	53                   	push   %ebx
+  80275e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802761:	83 e0 07             	and    $0x7,%eax
+  802764:	c1 e0 0c             	shl    $0xc,%eax
+  802767:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80276d:	50                   	push   %eax
+  80276e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802771:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802774:	01 c8                	add    %ecx,%eax
+  802776:	50                   	push   %eax
+  802777:	e8 f7 e8 ff ff       	call   801073 <memmove>
+  80277c:	83 c4 10             	add    $0x10,%esp
+  80277f:	eb a8                	jmp    802729 <fsring_rw+0x2ae>
+  802781:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802785:	75 09                	jne    802790 <fsring_rw+0x315>
+  802787:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80278a:	0f 82 db fe ff ff    	jb     80266b <fsring_rw+0x1f0>
+  802790:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802793:	01 57 04             	add    %edx,0x4(%edi)
+  802796:	85 d2                	test   %edx,%edx
+  802798:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80279c:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80279f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8027a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a5:	5b                   	pop    %ebx
+  8027a6:	5e                   	pop    %esi
+  8027a7:	5f                   	pop    %edi
+  8027a8:	5d                   	pop    %ebp
+  8027a9:	c3                   	ret
+
+008027aa <devfile_write>:
+  8027aa:	55                   	push   %ebp
+  8027ab:	89 e5                	mov    %esp,%ebp
+  8027ad:	57                   	push   %edi
+  8027ae:	56                   	push   %esi
+  8027af:	53                   	push   %ebx
+  8027b0:	83 ec 0c             	sub    $0xc,%esp
+  8027b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027b6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8027b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027bc:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8027c2:	76 1a                	jbe    8027de <devfile_write+0x34>
+  8027c4:	83 ec 0c             	sub    $0xc,%esp
+  8027c7:	53                   	push   %ebx
+  8027c8:	89 f1                	mov    %esi,%ecx
+  8027ca:	ba 06 00 00 00       	mov    $0x6,%edx
+  8027cf:	89 f8                	mov    %edi,%eax
+  8027d1:	e8 a5 fc ff ff       	call   80247b <fsring_rw>
+  8027d6:	83 c4 10             	add    $0x10,%esp
+  8027d9:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8027dc:	75 39                	jne    802817 <devfile_write+0x6d>
+  8027de:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8027e3:	39 c3                	cmp    %eax,%ebx
+  8027e5:	0f 47 d8             	cmova  %eax,%ebx
+  8027e8:	8b 47 0c             	mov    0xc(%edi),%eax
+  8027eb:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027f0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8027f6:	83 ec 04             	sub    $0x4,%esp
+  8027f9:	53                   	push   %ebx
+  8027fa:	56                   	push   %esi
+  8027fb:	68 08 70 80 00       	push   $0x807008
+  802800:	e8 6e e8 ff ff       	call   801073 <memmove>
+  802805:	ba 00 00 00 00       	mov    $0x0,%edx
+  80280a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80280f:	e8 7c fb ff ff       	call   802390 <fsipc>
+  802814:	83 c4 10             	add    $0x10,%esp
+  802817:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80281a:	5b                   	pop    %ebx
+  80281b:	5e                   	pop    %esi
+  80281c:	5f                   	pop    %edi
+  80281d:	5d                   	pop    %ebp
+  80281e:	c3                   	ret
+
+0080281f <devfile_read>:
+  80281f:	55                   	push   %ebp
+  802820:	89 e5                	mov    %esp,%ebp
+  802822:	57                   	push   %edi
+  802823:	56                   	push   %esi
+  802824:	53                   	push   %ebx
+  802825:	83 ec 0c             	sub    $0xc,%esp
+  802828:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80282b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80282e:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802834:	76 1d                	jbe    802853 <devfile_read+0x34>
+  802836:	83 ec 0c             	sub    $0xc,%esp
+  802839:	56                   	push   %esi
+  80283a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80283d:	ba 05 00 00 00       	mov    $0x5,%edx
+  802842:	89 f8                	mov    %edi,%eax
+  802844:	e8 32 fc ff ff       	call   80247b <fsring_rw>
+  802849:	89 c3                	mov    %eax,%ebx
+  80284b:	83 c4 10             	add    $0x10,%esp
+  80284e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802851:	75 37                	jne    80288a <devfile_read+0x6b>
+  802853:	8b 47 0c             	mov    0xc(%edi),%eax
+  802856:	a3 00 70 80 00       	mov    %eax,0x807000
+  80285b:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802861:	ba 00 00 00 00       	mov    $0x0,%edx
+  802866:	b8 03 00 00 00       	mov    $0x3,%eax
+  80286b:	e8 20 fb ff ff       	call   802390 <fsipc>
+  802870:	89 c3                	mov    %eax,%ebx
+  802872:	85 c0                	test   %eax,%eax
+  802874:	78 14                	js     80288a <devfile_read+0x6b>
+  802876:	83 ec 04             	sub    $0x4,%esp
+  802879:	50                   	push   %eax
+  80287a:	68 00 70 80 00       	push   $0x807000
+  80287f:	ff 75 0c             	push   0xc(%ebp)
+  802882:	e8 ec e7 ff ff       	call   801073 <memmove>
+  802887:	83 c4 10             	add    $0x10,%esp
+  80288a:	89 d8                	mov    %ebx,%eax
+  80288c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288f:	5b                   	pop    %ebx
+  802890:	5e                   	pop    %esi
+  802891:	5f                   	pop    %edi
+  802892:	5d                   	pop    %ebp
+  802893:	c3                   	ret
+
+00802894 <open>:
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	56                   	push   %esi
+  802898:	53                   	push   %ebx
+  802899:	83 ec 1c             	sub    $0x1c,%esp
+  80289c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80289f:	56                   	push   %esi
+  8028a0:	e8 d2 e5 ff ff       	call   800e77 <strlen>
+  8028a5:	83 c4 10             	add    $0x10,%esp
+  8028a8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028ad:	7f 6c                	jg     80291b <open+0x87>
+  8028af:	83 ec 0c             	sub    $0xc,%esp
+  8028b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028b5:	50                   	push   %eax
+  8028b6:	e8 6a f5 ff ff       	call   801e25 <fd_alloc>
+  8028bb:	89 c3                	mov    %eax,%ebx
+  8028bd:	83 c4 10             	add    $0x10,%esp
+  8028c0:	85 c0                	test   %eax,%eax
+  8028c2:	78 3c                	js     802900 <open+0x6c>
+  8028c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028c7:	a3 00 74 80 00       	mov    %eax,0x807400
+  8028cc:	83 ec 08             	sub    $0x8,%esp
+  8028cf:	56                   	push   %esi
+  8028d0:	68 00 70 80 00       	push   $0x807000
+  8028d5:	e8 e9 e5 ff ff       	call   800ec3 <strcpy>
+  8028da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028e2:	e8 a9 fa ff ff       	call   802390 <fsipc>
+  8028e7:	89 c3                	mov    %eax,%ebx
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	78 19                	js     802909 <open+0x75>
+  8028f0:	83 ec 0c             	sub    $0xc,%esp
+  8028f3:	ff 75 f4             	push   -0xc(%ebp)
+  8028f6:	e8 03 f5 ff ff       	call   801dfe <fd2num>
+  8028fb:	89 c3                	mov    %eax,%ebx
+  8028fd:	83 c4 10             	add    $0x10,%esp
+  802900:	89 d8                	mov    %ebx,%eax
+  802902:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802905:	5b                   	pop    %ebx
+  802906:	5e                   	pop    %esi
+  802907:	5d                   	pop    %ebp
+  802908:	c3                   	ret
+  802909:	83 ec 08             	sub    $0x8,%esp
+  80290c:	6a 00                	push   $0x0
+  80290e:	ff 75 f4             	push   -0xc(%ebp)
+  802911:	e8 05 f6 ff ff       	call   801f1b <fd_close>
+  802916:	83 c4 10             	add    $0x10,%esp
+  802919:	eb e5                	jmp    802900 <open+0x6c>
+  80291b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802920:	eb de                	jmp    802900 <open+0x6c>
+
+00802922 <file_image>:
+  802922:	55                   	push   %ebp
+  802923:	89 e5                	mov    %esp,%ebp
+  802925:	53                   	push   %ebx
+  802926:	83 ec 1c             	sub    $0x1c,%esp
+  802929:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80292c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80292f:	50                   	push   %eax
+  802930:	ff 75 08             	push   0x8(%ebp)
+  802933:	e8 3d f5 ff ff       	call   801e75 <fd_lookup>
+  802938:	83 c4 10             	add    $0x10,%esp
+  80293b:	85 c0                	test   %eax,%eax
+  80293d:	78 58                	js     802997 <file_image+0x75>
+  80293f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802942:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802948:	39 08                	cmp    %ecx,(%eax)
+  80294a:	75 50                	jne    80299c <file_image+0x7a>
+  80294c:	83 fb 04             	cmp    $0x4,%ebx
+  80294f:	77 52                	ja     8029a3 <file_image+0x81>
+  802951:	8b 40 0c             	mov    0xc(%eax),%eax
+  802954:	a3 00 70 80 00       	mov    %eax,0x807000
+  802959:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80295f:	83 ec 04             	sub    $0x4,%esp
+  802962:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802965:	c1 e0 02             	shl    $0x2,%eax
+  802968:	50                   	push   %eax
+  802969:	ff 75 0c             	push   0xc(%ebp)
+  80296c:	68 08 70 80 00       	push   $0x807008
+  802971:	e8 fd e6 ff ff       	call   801073 <memmove>
+  802976:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802980:	e8 0b fa ff ff       	call   802390 <fsipc>
+  802985:	83 c4 10             	add    $0x10,%esp
+  802988:	85 c0                	test   %eax,%eax
+  80298a:	78 0b                	js     802997 <file_image+0x75>
+  80298c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80298f:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+  802995:	89 0a                	mov    %ecx,(%edx)
+  802997:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80299a:	c9                   	leave
+  80299b:	c3                   	ret
+  80299c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029a1:	eb f4                	jmp    802997 <file_image+0x75>
+  8029a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a8:	eb ed                	jmp    802997 <file_image+0x75>
+
+008029aa <remove>:
+  8029aa:	55                   	push   %ebp
+  8029ab:	89 e5                	mov    %esp,%ebp
+  8029ad:	53                   	push   %ebx
+  8029ae:	83 ec 10             	sub    $0x10,%esp
+  8029b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029b4:	53                   	push   %ebx
+  8029b5:	e8 bd e4 ff ff       	call   800e77 <strlen>
+  8029ba:	83 c4 10             	add    $0x10,%esp
+  8029bd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029c2:	7f 25                	jg     8029e9 <remove+0x3f>
+  8029c4:	83 ec 08             	sub    $0x8,%esp
+  8029c7:	53                   	push   %ebx
+  8029c8:	68 00 70 80 00       	push   $0x807000
+  8029cd:	e8 f1 e4 ff ff       	call   800ec3 <strcpy>
+  8029d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8029dc:	e8 af f9 ff ff       	call   802390 <fsipc>
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029e7:	c9                   	leave
+  8029e8:	c3                   	ret
+  8029e9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8029ee:	eb f4                	jmp    8029e4 <remove+0x3a>
+
+008029f0 <sync>:
+  8029f0:	55                   	push   %ebp
+  8029f1:	89 e5                	mov    %esp,%ebp
+  8029f3:	83 ec 08             	sub    $0x8,%esp
+  8029f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a00:	e8 8b f9 ff ff       	call   802390 <fsipc>
+  802a05:	c9                   	leave
+  802a06:	c3                   	ret
+
+00802a07 <devsock_stat>:
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	83 ec 10             	sub    $0x10,%esp
+  802a0d:	68 d4 3f 80 00       	push   $0x803fd4
+  802a12:	ff 75 0c             	push   0xc(%ebp)
+  802a15:	e8 a9 e4 ff ff       	call   800ec3 <strcpy>
+  802a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+
+00802a21 <devsock_close>:
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	53                   	push   %ebx
+  802a25:	83 ec 10             	sub    $0x10,%esp
+  802a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a2b:	53                   	push   %ebx
+  802a2c:	e8 2c 0b 00 00       	call   80355d <pageref>
+  802a31:	89 c2                	mov    %eax,%edx
+  802a33:	83 c4 10             	add    $0x10,%esp
+  802a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3b:	83 fa 01             	cmp    $0x1,%edx
+  802a3e:	74 05                	je     802a45 <devsock_close+0x24>
+  802a40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a43:	c9                   	leave
+  802a44:	c3                   	ret
+  802a45:	83 ec 0c             	sub    $0xc,%esp
+  802a48:	ff 73 0c             	push   0xc(%ebx)
+  802a4b:	e8 aa 02 00 00       	call   802cfa <nsipc_close>
+  802a50:	83 c4 10             	add    $0x10,%esp
+  802a53:	eb eb                	jmp    802a40 <devsock_close+0x1f>
+
+00802a55 <devsock_write>:
+  802a55:	55                   	push   %ebp
+  802a56:	89 e5                	mov    %esp,%ebp
+  802a58:	83 ec 08             	sub    $0x8,%esp
+  802a5b:	6a 00                	push   $0x0
+  802a5d:	ff 75 10             	push   0x10(%ebp)
+  802a60:	ff 75 0c             	push   0xc(%ebp)
+  802a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a66:	ff 70 0c             	push   0xc(%eax)
+  802a69:	e8 6c 03 00 00       	call   802dda <nsipc_send>
+  802a6e:	c9                   	leave
+  802a6f:	c3                   	ret
+
+00802a70 <devsock_read>:
+  802a70:	55                   	push   %ebp
+  802a71:	89 e5                	mov    %esp,%ebp
+  802a73:	83 ec 08             	sub    $0x8,%esp
+  802a76:	6a 00                	push   $0x0
+  802a78:	ff 75 10             	push   0x10(%ebp)
+  802a7b:	ff 75 0c             	push   0xc(%ebp)
+  802a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a81:	ff 70 0c             	push   0xc(%eax)
+  802a84:	e8 e2 02 00 00       	call   802d6b <nsipc_recv>
+  802a89:	c9                   	leave
+  802a8a:	c3                   	ret
+
+00802a8b <fd2sockid>:
+  802a8b:	55                   	push   %ebp
+  802a8c:	89 e5                	mov    %esp,%ebp
+  802a8e:	83 ec 20             	sub    $0x20,%esp
+  802a91:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a94:	52                   	push   %edx
+  802a95:	50                   	push   %eax
+  802a96:	e8 da f3 ff ff       	call   801e75 <fd_lookup>
+  802a9b:	83 c4 10             	add    $0x10,%esp
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	78 10                	js     802ab2 <fd2sockid+0x27>
+  802aa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aa5:	8b 0d 24 50 80 00    	mov    0x805024,%ecx
+  802aab:	39 08                	cmp    %ecx,(%eax)
+  802aad:	75 05                	jne    802ab4 <fd2sockid+0x29>
+  802aaf:	8b 40 0c             	mov    0xc(%eax),%eax
+  802ab2:	c9                   	leave
+  802ab3:	c3                   	ret
+  802ab4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ab9:	eb f7                	jmp    802ab2 <fd2sockid+0x27>
+
+00802abb <alloc_sockfd>:
+  802abb:	55                   	push   %ebp
+  802abc:	89 e5                	mov    %esp,%ebp
+  802abe:	56                   	push   %esi
+  802abf:	53                   	push   %ebx
+  802ac0:	83 ec 1c             	sub    $0x1c,%esp
+  802ac3:	89 c6                	mov    %eax,%esi
+  802ac5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ac8:	50                   	push   %eax
+  802ac9:	e8 57 f3 ff ff       	call   801e25 <fd_alloc>
+  802ace:	89 c3                	mov    %eax,%ebx
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	78 43                	js     802b1a <alloc_sockfd+0x5f>
+  802ad7:	83 ec 04             	sub    $0x4,%esp
+  802ada:	68 07 04 00 00       	push   $0x407
+  802adf:	ff 75 f4             	push   -0xc(%ebp)
+  802ae2:	6a 00                	push   $0x0
+  802ae4:	e8 3a e8 ff ff       	call   801323 <sys_page_alloc>
+  802ae9:	89 c3                	mov    %eax,%ebx
+  802aeb:	83 c4 10             	add    $0x10,%esp
+  802aee:	85 c0                	test   %eax,%eax
+  802af0:	78 28                	js     802b1a <alloc_sockfd+0x5f>
+  802af2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802af5:	8b 15 24 50 80 00    	mov    0x805024,%edx
+  802afb:	89 10                	mov    %edx,(%eax)
+  802afd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b00:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802b07:	89 70 0c             	mov    %esi,0xc(%eax)
+  802b0a:	83 ec 0c             	sub    $0xc,%esp
+  802b0d:	50                   	push   %eax
+  802b0e:	e8 eb f2 ff ff       	call   801dfe <fd2num>
+  802b13:	89 c3                	mov    %eax,%ebx
+  802b15:	83 c4 10             	add    $0x10,%esp
+  802b18:	eb 0c                	jmp    802b26 <alloc_sockfd+0x6b>
+  802b1a:	83 ec 0c             	sub    $0xc,%esp
+  802b1d:	56                   	push   %esi
+  802b1e:	e8 d7 01 00 00       	call   802cfa <nsipc_close>
+  802b23:	83 c4 10             	add    $0x10,%esp
+  802b26:	89 d8                	mov    %ebx,%eax
+  802b28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b2b:	5b                   	pop    %ebx
+  802b2c:	5e                   	pop    %esi
+  802b2d:	5d                   	pop    %ebp
+  802b2e:	c3                   	ret
+
+00802b2f <accept>:
+  802b2f:	55                   	push   %ebp
+  802b30:	89 e5                	mov    %esp,%ebp
+  802b32:	83 ec 08             	sub    $0x8,%esp
+  802b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b38:	e8 4e ff ff ff       	call   802a8b <fd2sockid>
+  802b3d:	85 c0                	test   %eax,%eax
+  802b3f:	78 1b                	js     802b5c <accept+0x2d>
+  802b41:	83 ec 04             	sub    $0x4,%esp
+  802b44:	ff 75 10             	push   0x10(%ebp)
+  802b47:	ff 75 0c             	push   0xc(%ebp)
+  802b4a:	50                   	push   %eax
+  802b4b:	e8 07 01 00 00       	call   802c57 <nsipc_accept>
+  802b50:	83 c4 10             	add    $0x10,%esp
+  802b53:	85 c0                	test   %eax,%eax
+  802b55:	78 05                	js     802b5c <accept+0x2d>
+  802b57:	e8 5f ff ff ff       	call   802abb <alloc_sockfd>
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+
+00802b5e <bind>:
+  802b5e:	55                   	push   %ebp
+  802b5f:	89 e5                	mov    %esp,%ebp
+  802b61:	83 ec 08             	sub    $0x8,%esp
+  802b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b67:	e8 1f ff ff ff       	call   802a8b <fd2sockid>
+  802b6c:	85 c0                	test   %eax,%eax
+  802b6e:	78 12                	js     802b82 <bind+0x24>
+  802b70:	83 ec 04             	sub    $0x4,%esp
+  802b73:	ff 75 10             	push   0x10(%ebp)
+  802b76:	ff 75 0c             	push   0xc(%ebp)
+  802b79:	50                   	push   %eax
+  802b7a:	e8 24 01 00 00       	call   802ca3 <nsipc_bind>
+  802b7f:	83 c4 10             	add    $0x10,%esp
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+
+00802b84 <shutdown>:
+  802b84:	55                   	push   %ebp
+  802b85:	89 e5                	mov    %esp,%ebp
+  802b87:	83 ec 08             	sub    $0x8,%esp
+  802b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8d:	e8 f9 fe ff ff       	call   802a8b <fd2sockid>
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	78 0f                	js     802ba5 <shutdown+0x21>
+  802b96:	83 ec 08             	sub    $0x8,%esp
+  802b99:	ff 75 0c             	push   0xc(%ebp)
+  802b9c:	50                   	push   %eax
+  802b9d:	e8 36 01 00 00       	call   802cd8 <nsipc_shutdown>
+  802ba2:	83 c4 10             	add    $0x10,%esp
+  802ba5:	c9                   	leave
+  802ba6:	c3                   	ret
+
+00802ba7 <connect>:
+  802ba7:	55                   	push   %ebp
+  802ba8:	89 e5                	mov    %esp,%ebp
+  802baa:	83 ec 08             	sub    $0x8,%esp
+  802bad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb0:	e8 d6 fe ff ff       	call   802a8b <fd2sockid>
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	78 12                	js     802bcb <connect+0x24>
+  802bb9:	83 ec 04             	sub    $0x4,%esp
+  802bbc:	ff 75 10             	push   0x10(%ebp)
+  802bbf:	ff 75 0c             	push   0xc(%ebp)
+  802bc2:	50                   	push   %eax
+  802bc3:	e8 4c 01 00 00       	call   802d14 <nsipc_connect>
+  802bc8:	83 c4 10             	add    $0x10,%esp
+  802bcb:	c9                   	leave
+  802bcc:	c3                   	ret
+
+00802bcd <listen>:
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	83 ec 08             	sub    $0x8,%esp
+  802bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd6:	e8 b0 fe ff ff       	call   802a8b <fd2sockid>
+  802bdb:	85 c0                	test   %eax,%eax
+  802bdd:	78 0f                	js     802bee <listen+0x21>
+  802bdf:	83 ec 08             	sub    $0x8,%esp
+  802be2:	ff 75 0c             	push   0xc(%ebp)
+  802be5:	50                   	push   %eax
+  802be6:	e8 5e 01 00 00       	call   802d49 <nsipc_listen>
+  802beb:	83 c4 10             	add    $0x10,%esp
+  802bee:	c9                   	leave
+  802bef:	c3                   	ret
+
+00802bf0 <socket>:
+  802bf0:	55                   	push   %ebp
+  802bf1:	89 e5                	mov    %esp,%ebp
+  802bf3:	83 ec 0c             	sub    $0xc,%esp
+  802bf6:	ff 75 10             	push   0x10(%ebp)
+  802bf9:	ff 75 0c             	push   0xc(%ebp)
+  802bfc:	ff 75 08             	push   0x8(%ebp)
+  802bff:	e8 34 02 00 00       	call   802e38 <nsipc_socket>
+  802c04:	83 c4 10             	add    $0x10,%esp
+  802c07:	85 c0                	test   %eax,%eax
+  802c09:	78 05                	js     802c10 <socket+0x20>
+  802c0b:	e8 ab fe ff ff       	call   802abb <alloc_sockfd>
+  802c10:	c9                   	leave
+  802c11:	c3                   	ret
+
+00802c12 <nsipc>:
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	53                   	push   %ebx
+  802c16:	83 ec 04             	sub    $0x4,%esp
+  802c19:	89 c3                	mov    %eax,%ebx
+  802c1b:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802c22:	74 1f                	je     802c43 <nsipc+0x31>
+  802c24:	83 ec 08             	sub    $0x8,%esp
+  802c27:	6a 00                	push   $0x0
+  802c29:	6a 00                	push   $0x0
+  802c2b:	6a 07                	push   $0x7
+  802c2d:	68 00 80 80 00       	push   $0x808000
+  802c32:	53                   	push   %ebx
+  802c33:	ff 35 0c 60 80 00    	push   0x80600c
+  802c39:	e8 0b f0 ff ff       	call   801c49 <ipc_call>
+  802c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c41:	c9                   	leave
+  802c42:	c3                   	ret
+  802c43:	83 ec 0c             	sub    $0xc,%esp
+  802c46:	6a 03                	push   $0x3
+  802c48:	e8 97 f1 ff ff       	call   801de4 <ipc_find_env>
+  802c4d:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802c52:	83 c4 10             	add    $0x10,%esp
+  802c55:	eb cd                	jmp    802c24 <nsipc+0x12>
+
+00802c57 <nsipc_accept>:
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	53                   	push   %ebx
+  802c5b:	83 ec 04             	sub    $0x4,%esp
+  802c5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c61:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c66:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c6b:	e8 a2 ff ff ff       	call   802c12 <nsipc>
+  802c70:	89 c3                	mov    %eax,%ebx
+  802c72:	85 c0                	test   %eax,%eax
+  802c74:	79 07                	jns    802c7d <nsipc_accept+0x26>
+  802c76:	89 d8                	mov    %ebx,%eax
+  802c78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c7b:	c9                   	leave
+  802c7c:	c3                   	ret
+  802c7d:	83 ec 04             	sub    $0x4,%esp
+  802c80:	ff 35 10 80 80 00    	push   0x808010
+  802c86:	68 00 80 80 00       	push   $0x808000
+  802c8b:	ff 75 0c             	push   0xc(%ebp)
+  802c8e:	e8 e0 e3 ff ff       	call   801073 <memmove>
+  802c93:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802c99:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c9c:	89 10                	mov    %edx,(%eax)
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  802ca1:	eb d3                	jmp    802c76 <nsipc_accept+0x1f>
+
+00802ca3 <nsipc_bind>:
+  802ca3:	55                   	push   %ebp
+  802ca4:	89 e5                	mov    %esp,%ebp
+  802ca6:	53                   	push   %ebx
+  802ca7:	83 ec 08             	sub    $0x8,%esp
+  802caa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb0:	a3 00 80 80 00       	mov    %eax,0x808000
+  802cb5:	53                   	push   %ebx
+  802cb6:	ff 75 0c             	push   0xc(%ebp)
+  802cb9:	68 04 80 80 00       	push   $0x808004
+  802cbe:	e8 b0 e3 ff ff       	call   801073 <memmove>
+  802cc3:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802cc9:	b8 02 00 00 00       	mov    $0x2,%eax
+  802cce:	e8 3f ff ff ff       	call   802c12 <nsipc>
+  802cd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd6:	c9                   	leave
+  802cd7:	c3                   	ret
+
+00802cd8 <nsipc_shutdown>:
+  802cd8:	55                   	push   %ebp
+  802cd9:	89 e5                	mov    %esp,%ebp
+  802cdb:	83 ec 08             	sub    $0x8,%esp
+  802cde:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce1:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ce6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ce9:	a3 04 80 80 00       	mov    %eax,0x808004
+  802cee:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cf3:	e8 1a ff ff ff       	call   802c12 <nsipc>
+  802cf8:	c9                   	leave
+  802cf9:	c3                   	ret
+
+00802cfa <nsipc_close>:
+  802cfa:	55                   	push   %ebp
+  802cfb:	89 e5                	mov    %esp,%ebp
+  802cfd:	83 ec 08             	sub    $0x8,%esp
+  802d00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d03:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d08:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d0d:	e8 00 ff ff ff       	call   802c12 <nsipc>
+  802d12:	c9                   	leave
+  802d13:	c3                   	ret
+
+00802d14 <nsipc_connect>:
+  802d14:	55                   	push   %ebp
+  802d15:	89 e5                	mov    %esp,%ebp
+  802d17:	53                   	push   %ebx
+  802d18:	83 ec 08             	sub    $0x8,%esp
+  802d1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d21:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d26:	53                   	push   %ebx
+  802d27:	ff 75 0c             	push   0xc(%ebp)
+  802d2a:	68 04 80 80 00       	push   $0x808004
+  802d2f:	e8 3f e3 ff ff       	call   801073 <memmove>
+  802d34:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802d3a:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d3f:	e8 ce fe ff ff       	call   802c12 <nsipc>
+  802d44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+
+00802d49 <nsipc_listen>:
+  802d49:	55                   	push   %ebp
+  802d4a:	89 e5                	mov    %esp,%ebp
+  802d4c:	83 ec 08             	sub    $0x8,%esp
+  802d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d52:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d5a:	a3 04 80 80 00       	mov    %eax,0x808004
+  802d5f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d64:	e8 a9 fe ff ff       	call   802c12 <nsipc>
+  802d69:	c9                   	leave
+  802d6a:	c3                   	ret
+
+00802d6b <nsipc_recv>:
+  802d6b:	55                   	push   %ebp
+  802d6c:	89 e5                	mov    %esp,%ebp
+  802d6e:	56                   	push   %esi
+  802d6f:	53                   	push   %ebx
+  802d70:	8b 75 10             	mov    0x10(%ebp),%esi
+  802d73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d76:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d7b:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802d81:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d84:	a3 08 80 80 00       	mov    %eax,0x808008
+  802d89:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d8e:	e8 7f fe ff ff       	call   802c12 <nsipc>
+  802d93:	89 c3                	mov    %eax,%ebx
+  802d95:	85 c0                	test   %eax,%eax
+  802d97:	78 22                	js     802dbb <nsipc_recv+0x50>
+  802d99:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d9e:	39 c6                	cmp    %eax,%esi
+  802da0:	0f 4e c6             	cmovle %esi,%eax
+  802da3:	39 c3                	cmp    %eax,%ebx
+  802da5:	7f 1d                	jg     802dc4 <nsipc_recv+0x59>
+  802da7:	83 ec 04             	sub    $0x4,%esp
+  802daa:	53                   	push   %ebx
+  802dab:	68 00 80 80 00       	push   $0x808000
+  802db0:	ff 75 0c             	push   0xc(%ebp)
+  802db3:	e8 bb e2 ff ff       	call   801073 <memmove>
+  802db8:	83 c4 10             	add    $0x10,%esp
+  802dbb:	89 d8                	mov    %ebx,%eax
+  802dbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dc0:	5b                   	pop    %ebx
+  802dc1:	5e                   	pop    %esi
+  802dc2:	5d                   	pop    %ebp
+  802dc3:	c3                   	ret
+  802dc4:	68 e0 3f 80 00       	push   $0x803fe0
+  802dc9:	68 f5 3f 80 00       	push   $0x803ff5
+  802dce:	6a 60                	push   $0x60
+  802dd0:	68 0a 40 80 00       	push   $0x80400a
+  802dd5:	e8 17 d9 ff ff       	call   8006f1 <_panic>
+
+00802dda <nsipc_send>:
+  802dda:	55                   	push   %ebp
+  802ddb:	89 e5                	mov    %esp,%ebp
+  802ddd:	53                   	push   %ebx
+  802dde:	83 ec 04             	sub    $0x4,%esp
+  802de1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802de4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de7:	a3 00 80 80 00       	mov    %eax,0x808000
+  802dec:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802df2:	7f 2e                	jg     802e22 <nsipc_send+0x48>
+  802df4:	83 ec 04             	sub    $0x4,%esp
+  802df7:	53                   	push   %ebx
+  802df8:	ff 75 0c             	push   0xc(%ebp)
+  802dfb:	68 0c 80 80 00       	push   $0x80800c
+  802e00:	e8 6e e2 ff ff       	call   801073 <memmove>
+  802e05:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802e0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e0e:	a3 08 80 80 00       	mov    %eax,0x808008
+  802e13:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e18:	e8 f5 fd ff ff       	call   802c12 <nsipc>
+  802e1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e20:	c9                   	leave
+  802e21:	c3                   	ret
+  802e22:	68 16 40 80 00       	push   $0x804016
+  802e27:	68 f5 3f 80 00       	push   $0x803ff5
+  802e2c:	6a 6b                	push   $0x6b
+  802e2e:	68 0a 40 80 00       	push   $0x80400a
+  802e33:	e8 b9 d8 ff ff       	call   8006f1 <_panic>
+
+00802e38 <nsipc_socket>:
+  802e38:	55                   	push   %ebp
+  802e39:	89 e5                	mov    %esp,%ebp
+  802e3b:	83 ec 08             	sub    $0x8,%esp
+  802e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e41:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e49:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e4e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e51:	a3 08 80 80 00       	mov    %eax,0x808008
+  802e56:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e5b:	e8 b2 fd ff ff       	call   802c12 <nsipc>
+  802e60:	c9                   	leave
+  802e61:	c3                   	ret
+
+00802e62 <devpipe_stat>:
+  802e62:	55                   	push   %ebp
+  802e63:	89 e5                	mov    %esp,%ebp
+  802e65:	56                   	push   %esi
+  802e66:	53                   	push   %ebx
+  802e67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e6a:	83 ec 0c             	sub    $0xc,%esp
+  802e6d:	ff 75 08             	push   0x8(%ebp)
+  802e70:	e8 99 ef ff ff       	call   801e0e <fd2data>
+  802e75:	89 c6                	mov    %eax,%esi
+  802e77:	83 c4 08             	add    $0x8,%esp
+  802e7a:	68 22 40 80 00       	push   $0x804022
+  802e7f:	53                   	push   %ebx
+  802e80:	e8 3e e0 ff ff       	call   800ec3 <strcpy>
+  802e85:	8b 46 04             	mov    0x4(%esi),%eax
+  802e88:	2b 06                	sub    (%esi),%eax
+  802e8a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802e90:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e97:	00 00 00 
+  802e9a:	c7 83 88 00 00 00 40 	movl   $0x805040,0x88(%ebx)
+  802ea1:	50 80 00 
+  802ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eac:	5b                   	pop    %ebx
+  802ead:	5e                   	pop    %esi
+  802eae:	5d                   	pop    %ebp
+  802eaf:	c3                   	ret
+
+00802eb0 <devpipe_close>:
+  802eb0:	55                   	push   %ebp
+  802eb1:	89 e5                	mov    %esp,%ebp
+  802eb3:	53                   	push   %ebx
+  802eb4:	83 ec 0c             	sub    $0xc,%esp
+  802eb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802eba:	53                   	push   %ebx
+  802ebb:	6a 00                	push   $0x0
+  802ebd:	e8 33 e5 ff ff       	call   8013f5 <sys_page_unmap>
+  802ec2:	89 1c 24             	mov    %ebx,(%esp)
+  802ec5:	e8 44 ef ff ff       	call   801e0e <fd2data>
+  802eca:	83 c4 08             	add    $0x8,%esp
+  802ecd:	50                   	push   %eax
+  802ece:	6a 00                	push   $0x0
+  802ed0:	e8 20 e5 ff ff       	call   8013f5 <sys_page_unmap>
+  802ed5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ed8:	c9                   	leave
+  802ed9:	c3                   	ret
+
+00802eda <_pipeisclosed>:
+  802eda:	55                   	push   %ebp
+  802edb:	89 e5                	mov    %esp,%ebp
+  802edd:	57                   	push   %edi
+  802ede:	56                   	push   %esi
+  802edf:	53                   	push   %ebx
+  802ee0:	83 ec 1c             	sub    $0x1c,%esp
+  802ee3:	89 c7                	mov    %eax,%edi
+  802ee5:	89 d6                	mov    %edx,%esi
+  802ee7:	a1 10 60 80 00       	mov    0x806010,%eax
+  802eec:	8b 58 58             	mov    0x58(%eax),%ebx
+  802eef:	83 ec 0c             	sub    $0xc,%esp
+  802ef2:	57                   	push   %edi
+  802ef3:	e8 65 06 00 00       	call   80355d <pageref>
+  802ef8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802efb:	89 34 24             	mov    %esi,(%esp)
+  802efe:	e8 5a 06 00 00       	call   80355d <pageref>
+  802f03:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  802f09:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802f0c:	83 c4 10             	add    $0x10,%esp
+  802f0f:	39 cb                	cmp    %ecx,%ebx
+  802f11:	74 1b                	je     802f2e <_pipeisclosed+0x54>
+  802f13:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f16:	75 cf                	jne    802ee7 <_pipeisclosed+0xd>
+  802f18:	8b 42 58             	mov    0x58(%edx),%eax
+  802f1b:	6a 01                	push   $0x1
+  802f1d:	50                   	push   %eax
+  802f1e:	53                   	push   %ebx
+  802f1f:	68 29 40 80 00       	push   $0x804029
+  802f24:	e8 a3 d8 ff ff       	call   8007cc <cprintf>
+  802f29:	83 c4 10             	add    $0x10,%esp
+  802f2c:	eb b9                	jmp    802ee7 <_pipeisclosed+0xd>
+  802f2e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f31:	0f 94 c0             	sete   %al
+  802f34:	0f b6 c0             	movzbl %al,%eax
+  802f37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f3a:	5b                   	pop    %ebx
+  802f3b:	5e                   	pop    %esi
+  802f3c:	5f                   	pop    %edi
+  802f3d:	5d                   	pop    %ebp
+  802f3e:	c3                   	ret
+
+00802f3f <devpipe_write>:
+  802f3f:	55                   	push   %ebp
+  802f40:	89 e5                	mov    %esp,%ebp
+  802f42:	57                   	push   %edi
+  802f43:	56                   	push   %esi
+  802f44:	53                   	push   %ebx
+  802f45:	83 ec 28             	sub    $0x28,%esp
+  802f48:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f4b:	56                   	push   %esi
+  802f4c:	e8 bd ee ff ff       	call   801e0e <fd2data>
+  802f51:	89 c3                	mov    %eax,%ebx
+  802f53:	83 c4 10             	add    $0x10,%esp
+  802f56:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f5f:	74 5c                	je     802fbd <devpipe_write+0x7e>
+  802f61:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f64:	8b 0b                	mov    (%ebx),%ecx
+  802f66:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f69:	39 d0                	cmp    %edx,%eax
+  802f6b:	72 1e                	jb     802f8b <devpipe_write+0x4c>
+  802f6d:	89 da                	mov    %ebx,%edx
+  802f6f:	89 f0                	mov    %esi,%eax
+  802f71:	e8 64 ff ff ff       	call   802eda <_pipeisclosed>
+  802f76:	85 c0                	test   %eax,%eax
+  802f78:	75 48                	jne    802fc2 <devpipe_write+0x83>
+  802f7a:	e8 59 e3 ff ff       	call   8012d8 <sys_yield>
+  802f7f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f82:	8b 0b                	mov    (%ebx),%ecx
+  802f84:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f87:	39 d0                	cmp    %edx,%eax
+  802f89:	73 e2                	jae    802f6d <devpipe_write+0x2e>
+  802f8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f8e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f92:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f95:	89 c2                	mov    %eax,%edx
+  802f97:	c1 fa 1f             	sar    $0x1f,%edx
+  802f9a:	89 d1                	mov    %edx,%ecx
+  802f9c:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f9f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fa2:	83 e2 1f             	and    $0x1f,%edx
+  802fa5:	29 ca                	sub    %ecx,%edx
+  802fa7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802fab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802faf:	83 c0 01             	add    $0x1,%eax
+  802fb2:	89 43 04             	mov    %eax,0x4(%ebx)
+  802fb5:	83 c7 01             	add    $0x1,%edi
+  802fb8:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802fbb:	75 a4                	jne    802f61 <devpipe_write+0x22>
+  802fbd:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fc0:	eb 05                	jmp    802fc7 <devpipe_write+0x88>
+  802fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fca:	5b                   	pop    %ebx
+  802fcb:	5e                   	pop    %esi
+  802fcc:	5f                   	pop    %edi
+  802fcd:	5d                   	pop    %ebp
+  802fce:	c3                   	ret
+
+00802fcf <devpipe_read>:
+  802fcf:	55                   	push   %ebp
+  802fd0:	89 e5                	mov    %esp,%ebp
+  802fd2:	57                   	push   %edi
+  802fd3:	56                   	push   %esi
+  802fd4:	53                   	push   %ebx
+  802fd5:	83 ec 18             	sub    $0x18,%esp
+  802fd8:	8b 75 08             	mov    0x8(%ebp),%esi
+  802fdb:	56                   	push   %esi
+  802fdc:	e8 2d ee ff ff       	call   801e0e <fd2data>
+  802fe1:	89 c3                	mov    %eax,%ebx
+  802fe3:	83 c4 10             	add    $0x10,%esp
+  802fe6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802feb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fef:	74 45                	je     803036 <devpipe_read+0x67>
+  802ff1:	8b 03                	mov    (%ebx),%eax
+  802ff3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ff6:	75 1d                	jne    803015 <devpipe_read+0x46>
+  802ff8:	85 ff                	test   %edi,%edi
+  802ffa:	75 3f                	jne    80303b <devpipe_read+0x6c>
+  802ffc:	89 da                	mov    %ebx,%edx
+  802ffe:	89 f0                	mov    %esi,%eax
+  803000:	e8 d5 fe ff ff       	call   802eda <_pipeisclosed>
+  803005:	85 c0                	test   %eax,%eax
+  803007:	75 3c                	jne    803045 <devpipe_read+0x76>
+  803009:	e8 ca e2 ff ff       	call   8012d8 <sys_yield>
+  80300e:	8b 03                	mov    (%ebx),%eax
+  803010:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803013:	74 e7                	je     802ffc <devpipe_read+0x2d>
+  803015:	99                   	cltd
+  803016:	c1 ea 1b             	shr    $0x1b,%edx
+  803019:	01 d0                	add    %edx,%eax
+  80301b:	83 e0 1f             	and    $0x1f,%eax
+  80301e:	29 d0                	sub    %edx,%eax
+  803020:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803028:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80302b:	83 03 01             	addl   $0x1,(%ebx)
+  80302e:	83 c7 01             	add    $0x1,%edi
+  803031:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803034:	75 bb                	jne    802ff1 <devpipe_read+0x22>
+  803036:	8b 45 10             	mov    0x10(%ebp),%eax
+  803039:	eb 02                	jmp    80303d <devpipe_read+0x6e>
+  80303b:	89 f8                	mov    %edi,%eax
+  80303d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803040:	5b                   	pop    %ebx
+  803041:	5e                   	pop    %esi
+  803042:	5f                   	pop    %edi
+  803043:	5d                   	pop    %ebp
+  803044:	c3                   	ret
+  803045:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304a:	eb f1                	jmp    80303d <devpipe_read+0x6e>
+
+0080304c <pipe>:
+  80304c:	55                   	push   %ebp
+  80304d:	89 e5                	mov    %esp,%ebp
+  80304f:	56                   	push   %esi
+  803050:	53                   	push   %ebx
+  803051:	83 ec 1c             	sub    $0x1c,%esp
+  803054:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803057:	50                   	push   %eax
+  803058:	e8 c8 ed ff ff       	call   801e25 <fd_alloc>
+  80305d:	89 c3                	mov    %eax,%ebx
+  80305f:	83 c4 10             	add    $0x10,%esp
+  803062:	85 c0                	test   %eax,%eax
+  803064:	0f 88 23 01 00 00    	js     80318d <pipe+0x141>
+  80306a:	83 ec 04             	sub    $0x4,%esp
+  80306d:	68 07 04 00 00       	push   $0x407
+  803072:	ff 75 f4             	push   -0xc(%ebp)
+  803075:	6a 00                	push   $0x0
+  803077:	e8 a7 e2 ff ff       	call   801323 <sys_page_alloc>
+  80307c:	89 c3                	mov    %eax,%ebx
+  80307e:	83 c4 10             	add    $0x10,%esp
+  803081:	85 c0                	test   %eax,%eax
+  803083:	0f 88 04 01 00 00    	js     80318d <pipe+0x141>
+  803089:	83 ec 0c             	sub    $0xc,%esp
+  80308c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80308f:	50                   	push   %eax
+  803090:	e8 90 ed ff ff       	call   801e25 <fd_alloc>
+  803095:	89 c3                	mov    %eax,%ebx
+  803097:	83 c4 10             	add    $0x10,%esp
+  80309a:	85 c0                	test   %eax,%eax
+  80309c:	0f 88 db 00 00 00    	js     80317d <pipe+0x131>
+  8030a2:	83 ec 04             	sub    $0x4,%esp
+  8030a5:	68 07 04 00 00       	push   $0x407
+  8030aa:	ff 75 f0             	push   -0x10(%ebp)
+  8030ad:	6a 00                	push   $0x0
+  8030af:	e8 6f e2 ff ff       	call   801323 <sys_page_alloc>
+  8030b4:	89 c3                	mov    %eax,%ebx
+  8030b6:	83 c4 10             	add    $0x10,%esp
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	0f 88 bc 00 00 00    	js     80317d <pipe+0x131>
+  8030c1:	83 ec 0c             	sub    $0xc,%esp
+  8030c4:	ff 75 f4             	push   -0xc(%ebp)
+  8030c7:	e8 42 ed ff ff       	call   801e0e <fd2data>
+  8030cc:	89 c6                	mov    %eax,%esi
+  8030ce:	83 c4 0c             	add    $0xc,%esp
+  8030d1:	68 07 04 00 00       	push   $0x407
+  8030d6:	50                   	push   %eax
+  8030d7:	6a 00                	push   $0x0
+  8030d9:	e8 45 e2 ff ff       	call   801323 <sys_page_alloc>
+  8030de:	89 c3                	mov    %eax,%ebx
+  8030e0:	83 c4 10             	add    $0x10,%esp
+  8030e3:	85 c0                	test   %eax,%eax
+  8030e5:	0f 88 82 00 00 00    	js     80316d <pipe+0x121>
+  8030eb:	83 ec 0c             	sub    $0xc,%esp
+  8030ee:	ff 75 f0             	push   -0x10(%ebp)
+  8030f1:	e8 18 ed ff ff       	call   801e0e <fd2data>
+  8030f6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030fd:	50                   	push   %eax
+  8030fe:	6a 00                	push   $0x0
+  803100:	56                   	push   %esi
+  803101:	6a 00                	push   $0x0
+  803103:	e8 5e e2 ff ff       	call   801366 <sys_page_map>
+  803108:	89 c3                	mov    %eax,%ebx
+  80310a:	83 c4 20             	add    $0x20,%esp
+  80310d:	85 c0                	test   %eax,%eax
+  80310f:	78 4e                	js     80315f <pipe+0x113>
+  803111:	a1 40 50 80 00       	mov    0x805040,%eax
+  803116:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803119:	89 02                	mov    %eax,(%edx)
+  80311b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80311e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803125:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803128:	89 02                	mov    %eax,(%edx)
+  80312a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80312d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803134:	83 ec 0c             	sub    $0xc,%esp
+  803137:	ff 75 f4             	push   -0xc(%ebp)
+  80313a:	e8 bf ec ff ff       	call   801dfe <fd2num>
+  80313f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803142:	89 01                	mov    %eax,(%ecx)
+  803144:	83 c4 04             	add    $0x4,%esp
+  803147:	ff 75 f0             	push   -0x10(%ebp)
+  80314a:	e8 af ec ff ff       	call   801dfe <fd2num>
+  80314f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803152:	89 41 04             	mov    %eax,0x4(%ecx)
+  803155:	83 c4 10             	add    $0x10,%esp
+  803158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80315d:	eb 2e                	jmp    80318d <pipe+0x141>
+  80315f:	83 ec 08             	sub    $0x8,%esp
+  803162:	56                   	push   %esi
+  803163:	6a 00                	push   $0x0
+  803165:	e8 8b e2 ff ff       	call   8013f5 <sys_page_unmap>
+  80316a:	83 c4 10             	add    $0x10,%esp
+  80316d:	83 ec 08             	sub    $0x8,%esp
+  803170:	ff 75 f0             	push   -0x10(%ebp)
+  803173:	6a 00                	push   $0x0
+  803175:	e8 7b e2 ff ff       	call   8013f5 <sys_page_unmap>
+  80317a:	83 c4 10             	add    $0x10,%esp
+  80317d:	83 ec 08             	sub    $0x8,%esp
+  803180:	ff 75 f4             	push   -0xc(%ebp)
+  803183:	6a 00                	push   $0x0
+  803185:	e8 6b e2 ff ff       	call   8013f5 <sys_page_unmap>
+  80318a:	83 c4 10             	add    $0x10,%esp
+  80318d:	89 d8                	mov    %ebx,%eax
+  80318f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803192:	5b                   	pop    %ebx
+  803193:	5e                   	pop    %esi
+  803194:	5d                   	pop    %ebp
+  803195:	c3                   	ret
+
+00803196 <pipeisclosed>:
+  803196:	55                   	push   %ebp
+  803197:	89 e5                	mov    %esp,%ebp
+  803199:	83 ec 20             	sub    $0x20,%esp
+  80319c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80319f:	50                   	push   %eax
+  8031a0:	ff 75 08             	push   0x8(%ebp)
+  8031a3:	e8 cd ec ff ff       	call   801e75 <fd_lookup>
+  8031a8:	83 c4 10             	add    $0x10,%esp
+  8031ab:	85 c0                	test   %eax,%eax
+  8031ad:	78 18                	js     8031c7 <pipeisclosed+0x31>
+  8031af:	83 ec 0c             	sub    $0xc,%esp
+  8031b2:	ff 75 f4             	push   -0xc(%ebp)
+  8031b5:	e8 54 ec ff ff       	call   801e0e <fd2data>
+  8031ba:	89 c2                	mov    %eax,%edx
+  8031bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031bf:	e8 16 fd ff ff       	call   802eda <_pipeisclosed>
+  8031c4:	83 c4 10             	add    $0x10,%esp
+  8031c7:	c9                   	leave
+  8031c8:	c3                   	ret
+
+008031c9 <ipcring_init>:
+  8031c9:	55                   	push   %ebp
+  8031ca:	89 e5                	mov    %esp,%ebp
+  8031cc:	53                   	push   %ebx
+  8031cd:	83 ec 08             	sub    $0x8,%esp
+  8031d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8031d3:	6a 60                	push   $0x60
+  8031d5:	6a 00                	push   $0x0
+  8031d7:	53                   	push   %ebx
+  8031d8:	e8 61 de ff ff       	call   80103e <memset>
+  8031dd:	a1 10 60 80 00       	mov    0x806010,%eax
+  8031e2:	8b 40 48             	mov    0x48(%eax),%eax
+  8031e5:	89 03                	mov    %eax,(%ebx)
+  8031e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031ea:	89 43 04             	mov    %eax,0x4(%ebx)
+  8031ed:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031f0:	89 43 08             	mov    %eax,0x8(%ebx)
+  8031f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031f6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8031f9:	83 c4 10             	add    $0x10,%esp
+  8031fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ff:	c9                   	leave
+  803200:	c3                   	ret
+
+00803201 <ipcring_req_slot>:
+  803201:	55                   	push   %ebp
+  803202:	89 e5                	mov    %esp,%ebp
+  803204:	8b 45 08             	mov    0x8(%ebp),%eax
+  803207:	8b 50 10             	mov    0x10(%eax),%edx
+  80320a:	8b 48 18             	mov    0x18(%eax),%ecx
+  80320d:	29 ca                	sub    %ecx,%edx
+  80320f:	83 fa 07             	cmp    $0x7,%edx
+  803212:	77 0c                	ja     803220 <ipcring_req_slot+0x1f>
+  803214:	8b 50 10             	mov    0x10(%eax),%edx
+  803217:	83 e2 07             	and    $0x7,%edx
+  80321a:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80321e:	5d                   	pop    %ebp
+  80321f:	c3                   	ret
+  803220:	b8 00 00 00 00       	mov    $0x0,%eax
+  803225:	eb f7                	jmp    80321e <ipcring_req_slot+0x1d>
+
+00803227 <ipcring_req_push>:
+  803227:	55                   	push   %ebp
+  803228:	89 e5                	mov    %esp,%ebp
+  80322a:	83 ec 08             	sub    $0x8,%esp
+  80322d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803230:	8b 42 10             	mov    0x10(%edx),%eax
+  803233:	83 c0 01             	add    $0x1,%eax
+  803236:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80323a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80323f:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803243:	85 c0                	test   %eax,%eax
+  803245:	75 02                	jne    803249 <ipcring_req_push+0x22>
+  803247:	c9                   	leave
+  803248:	c3                   	ret
+  803249:	6a 00                	push   $0x0
+  80324b:	68 00 00 80 ee       	push   $0xee800000
+  803250:	ff 72 08             	push   0x8(%edx)
+  803253:	ff 72 04             	push   0x4(%edx)
+  803256:	e8 00 e4 ff ff       	call   80165b <sys_ipc_send>
+  80325b:	83 c4 10             	add    $0x10,%esp
+  80325e:	eb e7                	jmp    803247 <ipcring_req_push+0x20>
+
+00803260 <ipcring_rsp_wait>:
+  803260:	55                   	push   %ebp
+  803261:	89 e5                	mov    %esp,%ebp
+  803263:	53                   	push   %ebx
+  803264:	83 ec 04             	sub    $0x4,%esp
+  803267:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80326a:	8b 53 18             	mov    0x18(%ebx),%edx
+  80326d:	8b 43 10             	mov    0x10(%ebx),%eax
+  803270:	39 c2                	cmp    %eax,%edx
+  803272:	74 3c                	je     8032b0 <ipcring_rsp_wait+0x50>
+  803274:	8b 53 14             	mov    0x14(%ebx),%edx
+  803277:	8b 43 18             	mov    0x18(%ebx),%eax
+  80327a:	39 c2                	cmp    %eax,%edx
+  80327c:	75 23                	jne    8032a1 <ipcring_rsp_wait+0x41>
+  80327e:	83 ec 08             	sub    $0x8,%esp
+  803281:	6a 00                	push   $0x0
+  803283:	6a 00                	push   $0x0
+  803285:	6a 00                	push   $0x0
+  803287:	6a 00                	push   $0x0
+  803289:	ff 73 0c             	push   0xc(%ebx)
+  80328c:	ff 73 04             	push   0x4(%ebx)
+  80328f:	e8 b5 e9 ff ff       	call   801c49 <ipc_call>
+  803294:	8b 53 14             	mov    0x14(%ebx),%edx
+  803297:	8b 43 18             	mov    0x18(%ebx),%eax
+  80329a:	83 c4 20             	add    $0x20,%esp
+  80329d:	39 c2                	cmp    %eax,%edx
+  80329f:	74 dd                	je     80327e <ipcring_rsp_wait+0x1e>
+  8032a1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032a4:	83 e0 07             	and    $0x7,%eax
+  8032a7:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8032ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032ae:	c9                   	leave
+  8032af:	c3                   	ret
+  8032b0:	68 44 40 80 00       	push   $0x804044
+  8032b5:	68 f5 3f 80 00       	push   $0x803ff5
+  8032ba:	6a 3b                	push   $0x3b
+  8032bc:	68 65 40 80 00       	push   $0x804065
+  8032c1:	e8 2b d4 ff ff       	call   8006f1 <_panic>
+
+008032c6 <ipcring_rsp_pop>:
+  8032c6:	55                   	push   %ebp
+  8032c7:	89 e5                	mov    %esp,%ebp
+  8032c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8032cc:	8b 42 18             	mov    0x18(%edx),%eax
+  8032cf:	83 c0 01             	add    $0x1,%eax
+  8032d2:	89 42 18             	mov    %eax,0x18(%edx)
+  8032d5:	5d                   	pop    %ebp
+  8032d6:	c3                   	ret
+
+008032d7 <ipcring_server_init>:
+  8032d7:	55                   	push   %ebp
+  8032d8:	89 e5                	mov    %esp,%ebp
+  8032da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032e0:	89 10                	mov    %edx,(%eax)
+  8032e2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032e5:	89 50 04             	mov    %edx,0x4(%eax)
+  8032e8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  8032ef:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8032f6:	5d                   	pop    %ebp
+  8032f7:	c3                   	ret
+
+008032f8 <ipcring_req_avail>:
+  8032f8:	55                   	push   %ebp
+  8032f9:	89 e5                	mov    %esp,%ebp
+  8032fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8032fe:	8b 02                	mov    (%edx),%eax
+  803300:	8b 40 10             	mov    0x10(%eax),%eax
+  803303:	2b 42 08             	sub    0x8(%edx),%eax
+  803306:	ba 08 00 00 00       	mov    $0x8,%edx
+  80330b:	39 d0                	cmp    %edx,%eax
+  80330d:	0f 47 c2             	cmova  %edx,%eax
+  803310:	5d                   	pop    %ebp
+  803311:	c3                   	ret
+
+00803312 <ipcring_req_peek>:
+  803312:	55                   	push   %ebp
+  803313:	89 e5                	mov    %esp,%ebp
+  803315:	8b 55 08             	mov    0x8(%ebp),%edx
+  803318:	8b 42 08             	mov    0x8(%edx),%eax
+  80331b:	83 e0 07             	and    $0x7,%eax
+  80331e:	8b 12                	mov    (%edx),%edx
+  803320:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803324:	5d                   	pop    %ebp
+  803325:	c3                   	ret
+
+00803326 <ipcring_rsp_push>:
+  803326:	55                   	push   %ebp
+  803327:	89 e5                	mov    %esp,%ebp
+  803329:	83 ec 08             	sub    $0x8,%esp
+  80332c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80332f:	8b 41 08             	mov    0x8(%ecx),%eax
+  803332:	83 c0 01             	add    $0x1,%eax
+  803335:	89 41 08             	mov    %eax,0x8(%ecx)
+  803338:	8b 11                	mov    (%ecx),%edx
+  80333a:	83 c2 14             	add    $0x14,%edx
+  80333d:	f0 87 02             	lock xchg %eax,(%edx)
+  803340:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803344:	75 02                	jne    803348 <ipcring_rsp_push+0x22>
+  803346:	c9                   	leave
+  803347:	c3                   	ret
+  803348:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80334f:	6a 00                	push   $0x0
+  803351:	68 00 00 80 ee       	push   $0xee800000
+  803356:	6a 00                	push   $0x0
+  803358:	ff 71 04             	push   0x4(%ecx)
+  80335b:	e8 1e e2 ff ff       	call   80157e <sys_ipc_try_send>
+  803360:	83 c4 10             	add    $0x10,%esp
+  803363:	eb e1                	jmp    803346 <ipcring_rsp_push+0x20>
+
+00803365 <ipcring_client_wait>:
+  803365:	55                   	push   %ebp
+  803366:	89 e5                	mov    %esp,%ebp
+  803368:	83 ec 08             	sub    $0x8,%esp
+  80336b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80336e:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803375:	8b 10                	mov    (%eax),%edx
+  803377:	8b 52 18             	mov    0x18(%edx),%edx
+  80337a:	3b 50 08             	cmp    0x8(%eax),%edx
+  80337d:	75 02                	jne    803381 <ipcring_client_wait+0x1c>
+  80337f:	c9                   	leave
+  803380:	c3                   	ret
+  803381:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803388:	6a 00                	push   $0x0
+  80338a:	68 00 00 80 ee       	push   $0xee800000
+  80338f:	6a 00                	push   $0x0
+  803391:	ff 70 04             	push   0x4(%eax)
+  803394:	e8 e5 e1 ff ff       	call   80157e <sys_ipc_try_send>
+  803399:	83 c4 10             	add    $0x10,%esp
+  80339c:	eb e1                	jmp    80337f <ipcring_client_wait+0x1a>
+
+0080339e <ipcring_server_sleep>:
+  80339e:	55                   	push   %ebp
+  80339f:	89 e5                	mov    %esp,%ebp
+  8033a1:	53                   	push   %ebx
+  8033a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033a5:	8b 01                	mov    (%ecx),%eax
+  8033a7:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8033aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033af:	f0 87 02             	lock xchg %eax,(%edx)
+  8033b2:	8b 11                	mov    (%ecx),%edx
+  8033b4:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8033b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033bc:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8033bf:	74 0e                	je     8033cf <ipcring_server_sleep+0x31>
+  8033c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c6:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8033ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033d2:	c9                   	leave
+  8033d3:	c3                   	ret
+
+008033d4 <devcons_close>:
+  8033d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d9:	c3                   	ret
+
+008033da <devcons_stat>:
+  8033da:	55                   	push   %ebp
+  8033db:	89 e5                	mov    %esp,%ebp
+  8033dd:	83 ec 10             	sub    $0x10,%esp
+  8033e0:	68 73 40 80 00       	push   $0x804073
+  8033e5:	ff 75 0c             	push   0xc(%ebp)
+  8033e8:	e8 d6 da ff ff       	call   800ec3 <strcpy>
+  8033ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f2:	c9                   	leave
+  8033f3:	c3                   	ret
+
+008033f4 <devcons_write>:
+  8033f4:	55                   	push   %ebp
+  8033f5:	89 e5                	mov    %esp,%ebp
+  8033f7:	57                   	push   %edi
+  8033f8:	56                   	push   %esi
+  8033f9:	53                   	push   %ebx
+  8033fa:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803400:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803403:	85 ff                	test   %edi,%edi
+  803405:	74 51                	je     803458 <devcons_write+0x64>
+  803407:	be 00 00 00 00       	mov    $0x0,%esi
+  80340c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803411:	89 fb                	mov    %edi,%ebx
+  803413:	29 c3                	sub    %eax,%ebx
+  803415:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80341a:	39 d3                	cmp    %edx,%ebx
+  80341c:	0f 47 da             	cmova  %edx,%ebx
+  80341f:	83 ec 04             	sub    $0x4,%esp
+  803422:	53                   	push   %ebx
+  803423:	03 45 0c             	add    0xc(%ebp),%eax
+  803426:	50                   	push   %eax
+  803427:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80342d:	50                   	push   %eax
+  80342e:	e8 40 dc ff ff       	call   801073 <memmove>
+  803433:	83 c4 08             	add    $0x8,%esp
+  803436:	53                   	push   %ebx
+  803437:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80343d:	50                   	push   %eax
+  80343e:	e8 f8 dd ff ff       	call   80123b <sys_cputs>
+  803443:	01 de                	add    %ebx,%esi
+  803445:	89 f0                	mov    %esi,%eax
+  803447:	83 c4 10             	add    $0x10,%esp
+  80344a:	39 fe                	cmp    %edi,%esi
+  80344c:	72 c3                	jb     803411 <devcons_write+0x1d>
+  80344e:	89 f0                	mov    %esi,%eax
+  803450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803453:	5b                   	pop    %ebx
+  803454:	5e                   	pop    %esi
+  803455:	5f                   	pop    %edi
+  803456:	5d                   	pop    %ebp
+  803457:	c3                   	ret
+  803458:	be 00 00 00 00       	mov    $0x0,%esi
+  80345d:	eb ef                	jmp    80344e <devcons_write+0x5a>
+
+0080345f <devcons_read>:
+  80345f:	55                   	push   %ebp
+  803460:	89 e5                	mov    %esp,%ebp
+  803462:	83 ec 08             	sub    $0x8,%esp
+  803465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80346e:	75 07                	jne    803477 <devcons_read+0x18>
+  803470:	eb 1f                	jmp    803491 <devcons_read+0x32>
+  803472:	e8 61 de ff ff       	call   8012d8 <sys_yield>
+  803477:	e8 dd dd ff ff       	call   801259 <sys_cgetc>
+  80347c:	85 c0                	test   %eax,%eax
+  80347e:	74 f2                	je     803472 <devcons_read+0x13>
+  803480:	78 0f                	js     803491 <devcons_read+0x32>
+  803482:	83 f8 04             	cmp    $0x4,%eax
+  803485:	74 0c                	je     803493 <devcons_read+0x34>
+  803487:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80348a:	88 02                	mov    %al,(%edx)
+  80348c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803491:	c9                   	leave
+  803492:	c3                   	ret
+  803493:	b8 00 00 00 00       	mov    $0x0,%eax
+  803498:	eb f7                	jmp    803491 <devcons_read+0x32>
+
+0080349a <cputchar>:
+  80349a:	55                   	push   %ebp
+  80349b:	89 e5                	mov    %esp,%ebp
+  80349d:	83 ec 20             	sub    $0x20,%esp
+  8034a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a3:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8034a6:	6a 01                	push   $0x1
+  8034a8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034ab:	50                   	push   %eax
+  8034ac:	e8 8a dd ff ff       	call   80123b <sys_cputs>
+  8034b1:	83 c4 10             	add    $0x10,%esp
+  8034b4:	c9                   	leave
+  8034b5:	c3                   	ret
+
+008034b6 <getchar>:
+  8034b6:	55                   	push   %ebp
+  8034b7:	89 e5                	mov    %esp,%ebp
+  8034b9:	83 ec 1c             	sub    $0x1c,%esp
+  8034bc:	6a 01                	push   $0x1
+  8034be:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034c1:	50                   	push   %eax
+  8034c2:	6a 00                	push   $0x0
+  8034c4:	e8 0e ec ff ff       	call   8020d7 <read>
+  8034c9:	83 c4 10             	add    $0x10,%esp
+  8034cc:	85 c0                	test   %eax,%eax
+  8034ce:	78 06                	js     8034d6 <getchar+0x20>
+  8034d0:	74 06                	je     8034d8 <getchar+0x22>
+  8034d2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8034d6:	c9                   	leave
+  8034d7:	c3                   	ret
+  8034d8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8034dd:	eb f7                	jmp    8034d6 <getchar+0x20>
+
+008034df <iscons>:
+  8034df:	55                   	push   %ebp
+  8034e0:	89 e5                	mov    %esp,%ebp
+  8034e2:	83 ec 20             	sub    $0x20,%esp
+  8034e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034e8:	50                   	push   %eax
+  8034e9:	ff 75 08             	push   0x8(%ebp)
+  8034ec:	e8 84 e9 ff ff       	call   801e75 <fd_lookup>
+  8034f1:	83 c4 10             	add    $0x10,%esp
+  8034f4:	85 c0                	test   %eax,%eax
+  8034f6:	78 11                	js     803509 <iscons+0x2a>
+  8034f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034fb:	8b 15 5c 50 80 00    	mov    0x80505c,%edx
+  803501:	39 10                	cmp    %edx,(%eax)
+  803503:	0f 94 c0             	sete   %al
+  803506:	0f b6 c0             	movzbl %al,%eax
+  803509:	c9                   	leave
+  80350a:	c3                   	ret
+
+0080350b <opencons>:
+  80350b:	55                   	push   %ebp
+  80350c:	89 e5                	mov    %esp,%ebp
+  80350e:	83 ec 24             	sub    $0x24,%esp
+  803511:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803514:	50                   	push   %eax
+  803515:	e8 0b e9 ff ff       	call   801e25 <fd_alloc>
+  80351a:	83 c4 10             	add    $0x10,%esp
+  80351d:	85 c0                	test   %eax,%eax
+  80351f:	78 3a                	js     80355b <opencons+0x50>
+  803521:	83 ec 04             	sub    $0x4,%esp
+  803524:	68 07 04 00 00       	push   $0x407
+  803529:	ff 75 f4             	push   -0xc(%ebp)
+  80352c:	6a 00                	push   $0x0
+  80352e:	e8 f0 dd ff ff       	call   801323 <sys_page_alloc>
+  803533:	83 c4 10             	add    $0x10,%esp
+  803536:	85 c0                	test   %eax,%eax
+  803538:	78 21                	js     80355b <opencons+0x50>
+  80353a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80353d:	8b 15 5c 50 80 00    	mov    0x80505c,%edx
+  803543:	89 10                	mov    %edx,(%eax)
+  803545:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803548:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80354f:	83 ec 0c             	sub    $0xc,%esp
+  803552:	50                   	push   %eax
+  803553:	e8 a6 e8 ff ff       	call   801dfe <fd2num>
+  803558:	83 c4 10             	add    $0x10,%esp
+  80355b:	c9                   	leave
+  80355c:	c3                   	ret
+
+0080355d <pageref>:
+  80355d:	55                   	push   %ebp
+  80355e:	89 e5                	mov    %esp,%ebp
+  803560:	8b 45 08             	mov    0x8(%ebp),%eax
+  803563:	89 c2                	mov    %eax,%edx
+  803565:	c1 ea 16             	shr    $0x16,%edx
+  803568:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80356f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803574:	f6 c1 01             	test   $0x1,%cl
+  803577:	74 22                	je     80359b <pageref+0x3e>
+  803579:	c1 e8 0c             	shr    $0xc,%eax
+  80357c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803583:	a8 01                	test   $0x1,%al
+  803585:	74 14                	je     80359b <pageref+0x3e>
+  803587:	c1 e8 0c             	shr    $0xc,%eax
+  80358a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80358d:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803594:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803598:	0f b7 d2             	movzwl %dx,%edx
+  80359b:	89 d0                	mov    %edx,%eax
+  80359d:	5d                   	pop    %ebp
+  80359e:	c3                   	ret
+
+0080359f <__udivmoddi4>:
+  80359f:	55                   	push   %ebp
+  8035a0:	57                   	push   %edi
+  8035a1:	56                   	push   %esi
+  8035a2:	53                   	push   %ebx
+  8035a3:	83 ec 24             	sub    $0x24,%esp
+  8035a6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035aa:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035ae:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035b2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035b6:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8035ba:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8035be:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035c2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035c6:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8035ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035d9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035e0:	00 
+  8035e1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035e8:	00 
+  8035e9:	89 fb                	mov    %edi,%ebx
+  8035eb:	eb 08                	jmp    8035f5 <__udivmoddi4+0x56>
+  8035ed:	83 e9 01             	sub    $0x1,%ecx
+  8035f0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035f3:	74 68                	je     80365d <__udivmoddi4+0xbe>
+  8035f5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035f9:	01 c0                	add    %eax,%eax
+  8035fb:	89 c6                	mov    %eax,%esi
+  8035fd:	89 d7                	mov    %edx,%edi
+  8035ff:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803603:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803607:	0f ad d0             	shrd   %cl,%edx,%eax
+  80360a:	d3 ea                	shr    %cl,%edx
+  80360c:	f6 c1 20             	test   $0x20,%cl
+  80360f:	74 04                	je     803615 <__udivmoddi4+0x76>
+  803611:	89 d0                	mov    %edx,%eax
+  803613:	31 d2                	xor    %edx,%edx
+  803615:	83 e0 01             	and    $0x1,%eax
+  803618:	89 04 24             	mov    %eax,(%esp)
+  80361b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803622:	00 
+  803623:	8b 04 24             	mov    (%esp),%eax
+  803626:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80362a:	09 f0                	or     %esi,%eax
+  80362c:	09 fa                	or     %edi,%edx
+  80362e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803632:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803636:	39 f0                	cmp    %esi,%eax
+  803638:	89 d5                	mov    %edx,%ebp
+  80363a:	19 fd                	sbb    %edi,%ebp
+  80363c:	72 af                	jb     8035ed <__udivmoddi4+0x4e>
+  80363e:	29 f0                	sub    %esi,%eax
+  803640:	19 fa                	sbb    %edi,%edx
+  803642:	89 cf                	mov    %ecx,%edi
+  803644:	c1 ef 05             	shr    $0x5,%edi
+  803647:	83 e7 01             	and    $0x1,%edi
+  80364a:	89 fe                	mov    %edi,%esi
+  80364c:	83 f6 01             	xor    $0x1,%esi
+  80364f:	d3 e6                	shl    %cl,%esi
+  803651:	d3 e7                	shl    %cl,%edi
+  803653:	09 74 24 18          	or     %esi,0x18(%esp)
+  803657:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80365b:	eb 90                	jmp    8035ed <__udivmoddi4+0x4e>
+  80365d:	85 db                	test   %ebx,%ebx
+  80365f:	74 05                	je     803666 <__udivmoddi4+0xc7>
+  803661:	89 03                	mov    %eax,(%ebx)
+  803663:	89 53 04             	mov    %edx,0x4(%ebx)
+  803666:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80366a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80366e:	83 c4 24             	add    $0x24,%esp
+  803671:	5b                   	pop    %ebx
+  803672:	5e                   	pop    %esi
+  803673:	5f                   	pop    %edi
+  803674:	5d                   	pop    %ebp
+  803675:	c3                   	ret
+
+00803676 <__udivdi3>:
+  803676:	83 ec 08             	sub    $0x8,%esp
+  803679:	6a 00                	push   $0x0
+  80367b:	ff 74 24 1c          	push   0x1c(%esp)
+  80367f:	ff 74 24 1c          	push   0x1c(%esp)
+  803683:	ff 74 24 1c          	push   0x1c(%esp)
+  803687:	ff 74 24 1c          	push   0x1c(%esp)
+  80368b:	e8 0f ff ff ff       	call   80359f <__udivmoddi4>
+  803690:	83 c4 1c             	add    $0x1c,%esp
+  803693:	c3                   	ret
+
+00803694 <__umoddi3>:
+  803694:	83 ec 18             	sub    $0x18,%esp
+  803697:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80369b:	50                   	push   %eax
+  80369c:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a0:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a4:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a8:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ac:	e8 ee fe ff ff       	call   80359f <__udivmoddi4>
+  8036b1:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8036b5:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8036b9:	83 c4 2c             	add    $0x2c,%esp
+  8036bc:	c3                   	ret
+
+008036bd <__divdi3>:
+  8036bd:	53                   	push   %ebx
+  8036be:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036c2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036c6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036ca:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036ce:	85 d2                	test   %edx,%edx
+  8036d0:	78 12                	js     8036e4 <__divdi3+0x27>
+  8036d2:	85 db                	test   %ebx,%ebx
+  8036d4:	78 2e                	js     803704 <__divdi3+0x47>
+  8036d6:	53                   	push   %ebx
+  8036d7:	51                   	push   %ecx
+  8036d8:	52                   	push   %edx
+  8036d9:	50                   	push   %eax
+  8036da:	e8 97 ff ff ff       	call   803676 <__udivdi3>
+  8036df:	83 c4 10             	add    $0x10,%esp
+  8036e2:	eb 1e                	jmp    803702 <__divdi3+0x45>
+  8036e4:	f7 d8                	neg    %eax
+  8036e6:	83 d2 00             	adc    $0x0,%edx
+  8036e9:	f7 da                	neg    %edx
+  8036eb:	85 db                	test   %ebx,%ebx
+  8036ed:	78 2a                	js     803719 <__divdi3+0x5c>
+  8036ef:	53                   	push   %ebx
+  8036f0:	51                   	push   %ecx
+  8036f1:	52                   	push   %edx
+  8036f2:	50                   	push   %eax
+  8036f3:	e8 7e ff ff ff       	call   803676 <__udivdi3>
+  8036f8:	83 c4 10             	add    $0x10,%esp
+  8036fb:	f7 d8                	neg    %eax
+  8036fd:	83 d2 00             	adc    $0x0,%edx
+  803700:	f7 da                	neg    %edx
+  803702:	5b                   	pop    %ebx
+  803703:	c3                   	ret
+  803704:	f7 d9                	neg    %ecx
+  803706:	83 d3 00             	adc    $0x0,%ebx
+  803709:	f7 db                	neg    %ebx
+  80370b:	53                   	push   %ebx
+  80370c:	51                   	push   %ecx
+  80370d:	52                   	push   %edx
+  80370e:	50                   	push   %eax
+  80370f:	e8 62 ff ff ff       	call   803676 <__udivdi3>
+  803714:	83 c4 10             	add    $0x10,%esp
+  803717:	eb e2                	jmp    8036fb <__divdi3+0x3e>
+  803719:	f7 d9                	neg    %ecx
+  80371b:	83 d3 00             	adc    $0x0,%ebx
+  80371e:	f7 db                	neg    %ebx
+  803720:	53                   	push   %ebx
+  803721:	51                   	push   %ecx
+  803722:	52                   	push   %edx
+  803723:	50                   	push   %eax
+  803724:	e8 4d ff ff ff       	call   803676 <__udivdi3>
+  803729:	83 c4 10             	add    $0x10,%esp
+  80372c:	eb d4                	jmp    803702 <__divdi3+0x45>
+
+0080372e <__moddi3>:
+  80372e:	55                   	push   %ebp
+  80372f:	57                   	push   %edi
+  803730:	56                   	push   %esi
+  803731:	53                   	push   %ebx
+  803732:	83 ec 0c             	sub    $0xc,%esp
+  803735:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803739:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80373d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803741:	89 e9                	mov    %ebp,%ecx
+  803743:	f7 d9                	neg    %ecx
+  803745:	89 d0                	mov    %edx,%eax
+  803747:	83 d0 00             	adc    $0x0,%eax
+  80374a:	f7 d8                	neg    %eax
+  80374c:	0f 49 e9             	cmovns %ecx,%ebp
+  80374f:	0f 49 d0             	cmovns %eax,%edx
+  803752:	52                   	push   %edx
+  803753:	55                   	push   %ebp
+  803754:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803758:	f7 da                	neg    %edx
+  80375a:	89 d8                	mov    %ebx,%eax
+  80375c:	83 d0 00             	adc    $0x0,%eax
+  80375f:	f7 d8                	neg    %eax
+  803761:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803766:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80376a:	0f 48 c3             	cmovs  %ebx,%eax
+  80376d:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803771:	ff 74 24 0c          	push   0xc(%esp)
+  803775:	ff 74 24 0c          	push   0xc(%esp)
+  803779:	e8 16 ff ff ff       	call   803694 <__umoddi3>
+  80377e:	83 c4 10             	add    $0x10,%esp
+  803781:	85 db                	test   %ebx,%ebx
+  803783:	78 08                	js     80378d <__moddi3+0x5f>
+  803785:	83 c4 0c             	add    $0xc,%esp
+  803788:	5b                   	pop    %ebx
+  803789:	5e                   	pop    %esi
+  80378a:	5f                   	pop    %edi
+  80378b:	5d                   	pop    %ebp
+  80378c:	c3                   	ret
+  80378d:	f7 d8                	neg    %eax
+  80378f:	83 d2 00             	adc    $0x0,%edx
+  803792:	f7 da                	neg    %edx
+  803794:	eb ef                	jmp    803785 <__moddi3+0x57>
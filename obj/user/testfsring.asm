@@ -0,0 +1,5807 @@
+
+obj/user/testfsring.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 c8 03 00 00       	call   8003f9 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <count_nofork>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80003c:	b8 00 08 00 00       	mov    $0x800,%eax
+  800041:	eb 16                	jmp    800059 <count_nofork+0x26>
+  800043:	89 c2                	mov    %eax,%edx
+  800045:	f7 d2                	not    %edx
+  800047:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80004d:	01 d0                	add    %edx,%eax
+  80004f:	83 c0 01             	add    $0x1,%eax
+  800052:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  800057:	77 3a                	ja     800093 <count_nofork+0x60>
+  800059:	89 c2                	mov    %eax,%edx
+  80005b:	c1 ea 0a             	shr    $0xa,%edx
+  80005e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  800065:	f6 c1 01             	test   $0x1,%cl
+  800068:	74 d9                	je     800043 <count_nofork+0x10>
+  80006a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800071:	f6 c2 80             	test   $0x80,%dl
+  800074:	75 d9                	jne    80004f <count_nofork+0x1c>
+  800076:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80007d:	81 e2 01 02 00 00    	and    $0x201,%edx
+  800083:	81 fa 01 02 00 00    	cmp    $0x201,%edx
+  800089:	0f 94 c2             	sete   %dl
+  80008c:	0f b6 d2             	movzbl %dl,%edx
+  80008f:	01 d3                	add    %edx,%ebx
+  800091:	eb bc                	jmp    80004f <count_nofork+0x1c>
+  800093:	89 d8                	mov    %ebx,%eax
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <check_range>:
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	57                   	push   %edi
+  80009e:	56                   	push   %esi
+  80009f:	53                   	push   %ebx
+  8000a0:	83 ec 24             	sub    $0x24,%esp
+  8000a3:	89 c7                	mov    %eax,%edi
+  8000a5:	89 d6                	mov    %edx,%esi
+  8000a7:	6a 00                	push   $0x0
+  8000a9:	68 60 3b 80 00       	push   $0x803b60
+  8000ae:	e8 26 28 00 00       	call   8028d9 <open>
+  8000b3:	89 c3                	mov    %eax,%ebx
+  8000b5:	83 c4 10             	add    $0x10,%esp
+  8000b8:	85 c0                	test   %eax,%eax
+  8000ba:	78 52                	js     80010e <check_range+0x74>
+  8000bc:	83 ec 08             	sub    $0x8,%esp
+  8000bf:	57                   	push   %edi
+  8000c0:	50                   	push   %eax
+  8000c1:	e8 b3 21 00 00       	call   802279 <seek>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	78 5b                	js     800128 <check_range+0x8e>
+  8000cd:	83 ec 04             	sub    $0x4,%esp
+  8000d0:	56                   	push   %esi
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 00 60 80 00       	push   $0x806000
+  8000d8:	e8 e2 0c 00 00       	call   800dbf <memset>
+  8000dd:	83 c4 0c             	add    $0xc,%esp
+  8000e0:	56                   	push   %esi
+  8000e1:	68 00 60 80 00       	push   $0x806000
+  8000e6:	53                   	push   %ebx
+  8000e7:	e8 b7 20 00 00       	call   8021a3 <readn>
+  8000ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8000ef:	89 1c 24             	mov    %ebx,(%esp)
+  8000f2:	e8 e9 1e 00 00       	call   801fe0 <close>
+  8000f7:	83 c4 10             	add    $0x10,%esp
+  8000fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ff:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800102:	39 ce                	cmp    %ecx,%esi
+  800104:	74 34                	je     80013a <check_range+0xa0>
+  800106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800109:	5b                   	pop    %ebx
+  80010a:	5e                   	pop    %esi
+  80010b:	5f                   	pop    %edi
+  80010c:	5d                   	pop    %ebp
+  80010d:	c3                   	ret
+  80010e:	83 ec 0c             	sub    $0xc,%esp
+  800111:	50                   	push   %eax
+  800112:	68 60 3b 80 00       	push   $0x803b60
+  800117:	68 6c 3b 80 00       	push   $0x803b6c
+  80011c:	6a 28                	push   $0x28
+  80011e:	68 78 3b 80 00       	push   $0x803b78
+  800123:	e8 4a 03 00 00       	call   800472 <_panic>
+  800128:	50                   	push   %eax
+  800129:	68 8a 3b 80 00       	push   $0x803b8a
+  80012e:	6a 2a                	push   $0x2a
+  800130:	68 78 3b 80 00       	push   $0x803b78
+  800135:	e8 38 03 00 00       	call   800472 <_panic>
+  80013a:	83 ec 04             	sub    $0x4,%esp
+  80013d:	56                   	push   %esi
+  80013e:	81 c7 80 b0 80 00    	add    $0x80b080,%edi
+  800144:	57                   	push   %edi
+  800145:	68 00 60 80 00       	push   $0x806000
+  80014a:	e8 1d 0d 00 00       	call   800e6c <memcmp>
+  80014f:	83 c4 10             	add    $0x10,%esp
+  800152:	85 c0                	test   %eax,%eax
+  800154:	0f 94 c0             	sete   %al
+  800157:	0f b6 c0             	movzbl %al,%eax
+  80015a:	eb aa                	jmp    800106 <check_range+0x6c>
+
+0080015c <umain>:
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	53                   	push   %ebx
+  800160:	81 ec 94 00 00 00    	sub    $0x94,%esp
+  800166:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80016b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800170:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  800176:	85 d2                	test   %edx,%edx
+  800178:	0f 49 c2             	cmovns %edx,%eax
+  80017b:	c1 f8 0c             	sar    $0xc,%eax
+  80017e:	01 c8                	add    %ecx,%eax
+  800180:	88 82 80 b0 80 00    	mov    %al,0x80b080(%edx)
+  800186:	83 c2 01             	add    $0x1,%edx
+  800189:	83 c1 07             	add    $0x7,%ecx
+  80018c:	81 fa 64 50 00 00    	cmp    $0x5064,%edx
+  800192:	75 dc                	jne    800170 <umain+0x14>
+  800194:	83 ec 08             	sub    $0x8,%esp
+  800197:	68 02 03 00 00       	push   $0x302
+  80019c:	68 60 3b 80 00       	push   $0x803b60
+  8001a1:	e8 33 27 00 00       	call   8028d9 <open>
+  8001a6:	89 c3                	mov    %eax,%ebx
+  8001a8:	83 c4 10             	add    $0x10,%esp
+  8001ab:	85 c0                	test   %eax,%eax
+  8001ad:	0f 88 71 01 00 00    	js     800324 <umain+0x1c8>
+  8001b3:	83 ec 04             	sub    $0x4,%esp
+  8001b6:	68 64 50 00 00       	push   $0x5064
+  8001bb:	68 80 b0 80 00       	push   $0x80b080
+  8001c0:	50                   	push   %eax
+  8001c1:	e8 31 20 00 00       	call   8021f7 <write>
+  8001c6:	83 c4 10             	add    $0x10,%esp
+  8001c9:	3d 64 50 00 00       	cmp    $0x5064,%eax
+  8001ce:	0f 85 6a 01 00 00    	jne    80033e <umain+0x1e2>
+  8001d4:	83 ec 08             	sub    $0x8,%esp
+  8001d7:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	53                   	push   %ebx
+  8001df:	e8 3d 21 00 00       	call   802321 <fstat>
+  8001e4:	83 c4 10             	add    $0x10,%esp
+  8001e7:	85 c0                	test   %eax,%eax
+  8001e9:	0f 88 69 01 00 00    	js     800358 <umain+0x1fc>
+  8001ef:	81 7d ec 64 50 00 00 	cmpl   $0x5064,-0x14(%ebp)
+  8001f6:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  8001fb:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  800200:	0f 44 c2             	cmove  %edx,%eax
+  800203:	83 ec 08             	sub    $0x8,%esp
+  800206:	50                   	push   %eax
+  800207:	68 c0 3b 80 00       	push   $0x803bc0
+  80020c:	e8 3c 03 00 00       	call   80054d <cprintf>
+  800211:	83 c4 0c             	add    $0xc,%esp
+  800214:	68 00 10 00 00       	push   $0x1000
+  800219:	68 00 60 80 00       	push   $0x806000
+  80021e:	53                   	push   %ebx
+  80021f:	e8 f8 1e 00 00       	call   80211c <read>
+  800224:	83 c4 08             	add    $0x8,%esp
+  800227:	85 c0                	test   %eax,%eax
+  800229:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  80022e:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  800233:	0f 44 c2             	cmove  %edx,%eax
+  800236:	50                   	push   %eax
+  800237:	68 d4 3b 80 00       	push   $0x803bd4
+  80023c:	e8 0c 03 00 00       	call   80054d <cprintf>
+  800241:	89 1c 24             	mov    %ebx,(%esp)
+  800244:	e8 97 1d 00 00       	call   801fe0 <close>
+  800249:	ba 64 50 00 00       	mov    $0x5064,%edx
+  80024e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800253:	e8 42 fe ff ff       	call   80009a <check_range>
+  800258:	83 c4 08             	add    $0x8,%esp
+  80025b:	85 c0                	test   %eax,%eax
+  80025d:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  800262:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  800267:	0f 45 c2             	cmovne %edx,%eax
+  80026a:	50                   	push   %eax
+  80026b:	68 42 3c 80 00       	push   $0x803c42
+  800270:	e8 d8 02 00 00       	call   80054d <cprintf>
+  800275:	ba 00 30 00 00       	mov    $0x3000,%edx
+  80027a:	b8 b8 0b 00 00       	mov    $0xbb8,%eax
+  80027f:	e8 16 fe ff ff       	call   80009a <check_range>
+  800284:	83 c4 08             	add    $0x8,%esp
+  800287:	85 c0                	test   %eax,%eax
+  800289:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  80028e:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  800293:	0f 45 c2             	cmovne %edx,%eax
+  800296:	50                   	push   %eax
+  800297:	68 ea 3b 80 00       	push   $0x803bea
+  80029c:	e8 ac 02 00 00       	call   80054d <cprintf>
+  8002a1:	e8 8d fd ff ff       	call   800033 <count_nofork>
+  8002a6:	83 c4 08             	add    $0x8,%esp
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  8002b0:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  8002b5:	0f 45 c2             	cmovne %edx,%eax
+  8002b8:	50                   	push   %eax
+  8002b9:	68 02 3c 80 00       	push   $0x803c02
+  8002be:	e8 8a 02 00 00       	call   80054d <cprintf>
+  8002c3:	e8 2a 18 00 00       	call   801af2 <fork>
+  8002c8:	89 c3                	mov    %eax,%ebx
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	85 c0                	test   %eax,%eax
+  8002cf:	0f 88 95 00 00 00    	js     80036a <umain+0x20e>
+  8002d5:	0f 84 a1 00 00 00    	je     80037c <umain+0x220>
+  8002db:	83 ec 0c             	sub    $0xc,%esp
+  8002de:	53                   	push   %ebx
+  8002df:	e8 2a 2f 00 00       	call   80320e <wait>
+  8002e4:	ba 64 50 00 00       	mov    $0x5064,%edx
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	e8 a7 fd ff ff       	call   80009a <check_range>
+  8002f3:	83 c4 08             	add    $0x8,%esp
+  8002f6:	85 c0                	test   %eax,%eax
+  8002f8:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  8002fd:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  800302:	0f 45 c2             	cmovne %edx,%eax
+  800305:	50                   	push   %eax
+  800306:	68 68 3c 80 00       	push   $0x803c68
+  80030b:	e8 3d 02 00 00       	call   80054d <cprintf>
+  800310:	c7 04 24 60 3b 80 00 	movl   $0x803b60,(%esp)
+  800317:	e8 d3 26 00 00       	call   8029ef <remove>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	50                   	push   %eax
+  800328:	68 60 3b 80 00       	push   $0x803b60
+  80032d:	68 6c 3b 80 00       	push   $0x803b6c
+  800332:	6a 3c                	push   $0x3c
+  800334:	68 78 3b 80 00       	push   $0x803b78
+  800339:	e8 34 01 00 00       	call   800472 <_panic>
+  80033e:	83 ec 0c             	sub    $0xc,%esp
+  800341:	68 64 50 00 00       	push   $0x5064
+  800346:	50                   	push   %eax
+  800347:	68 9f 3b 80 00       	push   $0x803b9f
+  80034c:	6a 3e                	push   $0x3e
+  80034e:	68 78 3b 80 00       	push   $0x803b78
+  800353:	e8 1a 01 00 00       	call   800472 <_panic>
+  800358:	50                   	push   %eax
+  800359:	68 b6 3b 80 00       	push   $0x803bb6
+  80035e:	6a 40                	push   $0x40
+  800360:	68 78 3b 80 00       	push   $0x803b78
+  800365:	e8 08 01 00 00       	call   800472 <_panic>
+  80036a:	50                   	push   %eax
+  80036b:	68 18 3c 80 00       	push   $0x803c18
+  800370:	6a 4e                	push   $0x4e
+  800372:	68 78 3b 80 00       	push   $0x803b78
+  800377:	e8 f6 00 00 00       	call   800472 <_panic>
+  80037c:	e8 b2 fc ff ff       	call   800033 <count_nofork>
+  800381:	85 c0                	test   %eax,%eax
+  800383:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  800388:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  80038d:	0f 44 c2             	cmove  %edx,%eax
+  800390:	83 ec 08             	sub    $0x8,%esp
+  800393:	50                   	push   %eax
+  800394:	68 21 3c 80 00       	push   $0x803c21
+  800399:	e8 af 01 00 00       	call   80054d <cprintf>
+  80039e:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8003a3:	b8 01 10 00 00       	mov    $0x1001,%eax
+  8003a8:	e8 ed fc ff ff       	call   80009a <check_range>
+  8003ad:	83 c4 08             	add    $0x8,%esp
+  8003b0:	85 c0                	test   %eax,%eax
+  8003b2:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  8003b7:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  8003bc:	0f 45 c2             	cmovne %edx,%eax
+  8003bf:	50                   	push   %eax
+  8003c0:	68 3c 3c 80 00       	push   $0x803c3c
+  8003c5:	e8 83 01 00 00       	call   80054d <cprintf>
+  8003ca:	e8 64 fc ff ff       	call   800033 <count_nofork>
+  8003cf:	83 c4 08             	add    $0x8,%esp
+  8003d2:	85 c0                	test   %eax,%eax
+  8003d4:	b8 99 3b 80 00       	mov    $0x803b99,%eax
+  8003d9:	ba 93 3b 80 00       	mov    $0x803b93,%edx
+  8003de:	0f 45 c2             	cmovne %edx,%eax
+  8003e1:	50                   	push   %eax
+  8003e2:	68 50 3c 80 00       	push   $0x803c50
+  8003e7:	e8 61 01 00 00       	call   80054d <cprintf>
+  8003ec:	e8 51 00 00 00       	call   800442 <exit>
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	e9 e2 fe ff ff       	jmp    8002db <umain+0x17f>
+
+008003f9 <libmain>:
+  8003f9:	55                   	push   %ebp
+  8003fa:	89 e5                	mov    %esp,%ebp
+  8003fc:	56                   	push   %esi
+  8003fd:	53                   	push   %ebx
+  8003fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800401:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800404:	e8 31 0c 00 00       	call   80103a <sys_getenvid>
+  800409:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80040e:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800414:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800419:	a3 f8 00 81 00       	mov    %eax,0x8100f8
+  80041e:	85 db                	test   %ebx,%ebx
+  800420:	7e 07                	jle    800429 <libmain+0x30>
+  800422:	8b 06                	mov    (%esi),%eax
+  800424:	a3 00 50 80 00       	mov    %eax,0x805000
+  800429:	83 ec 08             	sub    $0x8,%esp
+  80042c:	56                   	push   %esi
+  80042d:	53                   	push   %ebx
+  80042e:	e8 29 fd ff ff       	call   80015c <umain>
+  800433:	e8 0a 00 00 00       	call   800442 <exit>
+  800438:	83 c4 10             	add    $0x10,%esp
+  80043b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80043e:	5b                   	pop    %ebx
+  80043f:	5e                   	pop    %esi
+  800440:	5d                   	pop    %ebp
+  800441:	c3                   	ret
+
+00800442 <exit>:
+  800442:	55                   	push   %ebp
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  80044d:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800453:	85 c0                	test   %eax,%eax
+  800455:	75 14                	jne    80046b <exit+0x29>
+  800457:	e8 b1 1b 00 00       	call   80200d <close_all>
+  80045c:	83 ec 0c             	sub    $0xc,%esp
+  80045f:	6a 00                	push   $0x0
+  800461:	e8 93 0b 00 00       	call   800ff9 <sys_env_destroy>
+  800466:	83 c4 10             	add    $0x10,%esp
+  800469:	c9                   	leave
+  80046a:	c3                   	ret
+  80046b:	e8 f6 12 00 00       	call   801766 <sys_lease_complete>
+  800470:	eb e5                	jmp    800457 <exit+0x15>
+
+00800472 <_panic>:
+  800472:	55                   	push   %ebp
+  800473:	89 e5                	mov    %esp,%ebp
+  800475:	56                   	push   %esi
+  800476:	53                   	push   %ebx
+  800477:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80047a:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800480:	e8 b5 0b 00 00       	call   80103a <sys_getenvid>
+  800485:	83 ec 0c             	sub    $0xc,%esp
+  800488:	ff 75 0c             	push   0xc(%ebp)
+  80048b:	ff 75 08             	push   0x8(%ebp)
+  80048e:	56                   	push   %esi
+  80048f:	50                   	push   %eax
+  800490:	68 94 3c 80 00       	push   $0x803c94
+  800495:	e8 b3 00 00 00       	call   80054d <cprintf>
+  80049a:	83 c4 18             	add    $0x18,%esp
+  80049d:	53                   	push   %ebx
+  80049e:	ff 75 10             	push   0x10(%ebp)
+  8004a1:	e8 56 00 00 00       	call   8004fc <vcprintf>
+  8004a6:	c7 04 24 d6 41 80 00 	movl   $0x8041d6,(%esp)
+  8004ad:	e8 9b 00 00 00       	call   80054d <cprintf>
+  8004b2:	83 c4 10             	add    $0x10,%esp
+  8004b5:	cc                   	int3
+  8004b6:	eb fd                	jmp    8004b5 <_panic+0x43>
+
+008004b8 <putch>:
+  8004b8:	55                   	push   %ebp
+  8004b9:	89 e5                	mov    %esp,%ebp
+  8004bb:	53                   	push   %ebx
+  8004bc:	83 ec 04             	sub    $0x4,%esp
+  8004bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004c2:	8b 13                	mov    (%ebx),%edx
+  8004c4:	8d 42 01             	lea    0x1(%edx),%eax
+  8004c7:	89 03                	mov    %eax,(%ebx)
+  8004c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004cc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8004d0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004d5:	74 09                	je     8004e0 <putch+0x28>
+  8004d7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8004db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004de:	c9                   	leave
+  8004df:	c3                   	ret
+  8004e0:	83 ec 08             	sub    $0x8,%esp
+  8004e3:	68 ff 00 00 00       	push   $0xff
+  8004e8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004eb:	50                   	push   %eax
+  8004ec:	e8 cb 0a 00 00       	call   800fbc <sys_cputs>
+  8004f1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004f7:	83 c4 10             	add    $0x10,%esp
+  8004fa:	eb db                	jmp    8004d7 <putch+0x1f>
+
+008004fc <vcprintf>:
+  8004fc:	55                   	push   %ebp
+  8004fd:	89 e5                	mov    %esp,%ebp
+  8004ff:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800505:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80050c:	00 00 00 
+  80050f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800516:	00 00 00 
+  800519:	ff 75 0c             	push   0xc(%ebp)
+  80051c:	ff 75 08             	push   0x8(%ebp)
+  80051f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800525:	50                   	push   %eax
+  800526:	68 b8 04 80 00       	push   $0x8004b8
+  80052b:	e8 1c 01 00 00       	call   80064c <vprintfmt>
+  800530:	83 c4 08             	add    $0x8,%esp
+  800533:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800539:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80053f:	50                   	push   %eax
+  800540:	e8 77 0a 00 00       	call   800fbc <sys_cputs>
+  800545:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80054b:	c9                   	leave
+  80054c:	c3                   	ret
+
+0080054d <cprintf>:
+  80054d:	55                   	push   %ebp
+  80054e:	89 e5                	mov    %esp,%ebp
+  800550:	83 ec 10             	sub    $0x10,%esp
+  800553:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800556:	50                   	push   %eax
+  800557:	ff 75 08             	push   0x8(%ebp)
+  80055a:	e8 9d ff ff ff       	call   8004fc <vcprintf>
+  80055f:	c9                   	leave
+  800560:	c3                   	ret
+
+00800561 <printnum>:
+  800561:	55                   	push   %ebp
+  800562:	89 e5                	mov    %esp,%ebp
+  800564:	57                   	push   %edi
+  800565:	56                   	push   %esi
+  800566:	53                   	push   %ebx
+  800567:	83 ec 1c             	sub    $0x1c,%esp
+  80056a:	89 c3                	mov    %eax,%ebx
+  80056c:	89 d6                	mov    %edx,%esi
+  80056e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800571:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800574:	89 d1                	mov    %edx,%ecx
+  800576:	89 c2                	mov    %eax,%edx
+  800578:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80057e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800581:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800584:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80058b:	39 c2                	cmp    %eax,%edx
+  80058d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800590:	73 4b                	jae    8005dd <printnum+0x7c>
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800598:	85 ff                	test   %edi,%edi
+  80059a:	7e 11                	jle    8005ad <printnum+0x4c>
+  80059c:	83 ec 08             	sub    $0x8,%esp
+  80059f:	56                   	push   %esi
+  8005a0:	ff 75 18             	push   0x18(%ebp)
+  8005a3:	ff d3                	call   *%ebx
+  8005a5:	83 c4 10             	add    $0x10,%esp
+  8005a8:	83 ef 01             	sub    $0x1,%edi
+  8005ab:	75 ef                	jne    80059c <printnum+0x3b>
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	56                   	push   %esi
+  8005b1:	83 ec 04             	sub    $0x4,%esp
+  8005b4:	ff 75 e4             	push   -0x1c(%ebp)
+  8005b7:	ff 75 e0             	push   -0x20(%ebp)
+  8005ba:	ff 75 dc             	push   -0x24(%ebp)
+  8005bd:	ff 75 d8             	push   -0x28(%ebp)
+  8005c0:	e8 86 34 00 00       	call   803a4b <__umoddi3>
+  8005c5:	83 c4 14             	add    $0x14,%esp
+  8005c8:	0f be 80 b7 3c 80 00 	movsbl 0x803cb7(%eax),%eax
+  8005cf:	50                   	push   %eax
+  8005d0:	ff d3                	call   *%ebx
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005d8:	5b                   	pop    %ebx
+  8005d9:	5e                   	pop    %esi
+  8005da:	5f                   	pop    %edi
+  8005db:	5d                   	pop    %ebp
+  8005dc:	c3                   	ret
+  8005dd:	83 ec 0c             	sub    $0xc,%esp
+  8005e0:	ff 75 18             	push   0x18(%ebp)
+  8005e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005e6:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8005e9:	52                   	push   %edx
+  8005ea:	50                   	push   %eax
+  8005eb:	83 ec 08             	sub    $0x8,%esp
+  8005ee:	ff 75 e4             	push   -0x1c(%ebp)
+  8005f1:	ff 75 e0             	push   -0x20(%ebp)
+  8005f4:	ff 75 dc             	push   -0x24(%ebp)
+  8005f7:	ff 75 d8             	push   -0x28(%ebp)
+  8005fa:	e8 2e 34 00 00       	call   803a2d <__udivdi3>
+  8005ff:	83 c4 18             	add    $0x18,%esp
+  800602:	52                   	push   %edx
+  800603:	50                   	push   %eax
+  800604:	89 f2                	mov    %esi,%edx
+  800606:	89 d8                	mov    %ebx,%eax
+  800608:	e8 54 ff ff ff       	call   800561 <printnum>
+  80060d:	83 c4 20             	add    $0x20,%esp
+  800610:	eb 9b                	jmp    8005ad <printnum+0x4c>
+
+00800612 <sprintputch>:
+  800612:	55                   	push   %ebp
+  800613:	89 e5                	mov    %esp,%ebp
+  800615:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800618:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80061c:	8b 10                	mov    (%eax),%edx
+  80061e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800621:	73 0a                	jae    80062d <sprintputch+0x1b>
+  800623:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800626:	89 08                	mov    %ecx,(%eax)
+  800628:	8b 45 08             	mov    0x8(%ebp),%eax
+  80062b:	88 02                	mov    %al,(%edx)
+  80062d:	5d                   	pop    %ebp
+  80062e:	c3                   	ret
+
+0080062f <printfmt>:
+  80062f:	55                   	push   %ebp
+  800630:	89 e5                	mov    %esp,%ebp
+  800632:	83 ec 08             	sub    $0x8,%esp
+  800635:	8d 45 14             	lea    0x14(%ebp),%eax
+  800638:	50                   	push   %eax
+  800639:	ff 75 10             	push   0x10(%ebp)
+  80063c:	ff 75 0c             	push   0xc(%ebp)
+  80063f:	ff 75 08             	push   0x8(%ebp)
+  800642:	e8 05 00 00 00       	call   80064c <vprintfmt>
+  800647:	83 c4 10             	add    $0x10,%esp
+  80064a:	c9                   	leave
+  80064b:	c3                   	ret
+
+0080064c <vprintfmt>:
+  80064c:	55                   	push   %ebp
+  80064d:	89 e5                	mov    %esp,%ebp
+  80064f:	57                   	push   %edi
+  800650:	56                   	push   %esi
+  800651:	53                   	push   %ebx
+  800652:	83 ec 2c             	sub    $0x2c,%esp
+  800655:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800658:	89 df                	mov    %ebx,%edi
+  80065a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80065d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800660:	8d 70 01             	lea    0x1(%eax),%esi
+  800663:	0f b6 00             	movzbl (%eax),%eax
+  800666:	83 f8 25             	cmp    $0x25,%eax
+  800669:	74 1e                	je     800689 <vprintfmt+0x3d>
+  80066b:	85 c0                	test   %eax,%eax
+  80066d:	0f 84 15 05 00 00    	je     800b88 <vprintfmt+0x53c>
+  800673:	83 ec 08             	sub    $0x8,%esp
+  800676:	53                   	push   %ebx
+  800677:	50                   	push   %eax
+  800678:	ff d7                	call   *%edi
+  80067a:	83 c6 01             	add    $0x1,%esi
+  80067d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800681:	83 c4 10             	add    $0x10,%esp
+  800684:	83 f8 25             	cmp    $0x25,%eax
+  800687:	75 e2                	jne    80066b <vprintfmt+0x1f>
+  800689:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  80068d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800694:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80069b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8006a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a7:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8006aa:	8d 56 01             	lea    0x1(%esi),%edx
+  8006ad:	0f b6 0e             	movzbl (%esi),%ecx
+  8006b0:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8006b3:	3c 55                	cmp    $0x55,%al
+  8006b5:	0f 87 3b 04 00 00    	ja     800af6 <vprintfmt+0x4aa>
+  8006bb:	0f b6 c0             	movzbl %al,%eax
+  8006be:	ff 24 85 00 3e 80 00 	jmp    *0x803e00(,%eax,4)
+  8006c5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006c8:	eb 93                	jmp    80065d <vprintfmt+0x11>
+  8006ca:	89 d6                	mov    %edx,%esi
+  8006cc:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8006d0:	eb d8                	jmp    8006aa <vprintfmt+0x5e>
+  8006d2:	89 d6                	mov    %edx,%esi
+  8006d4:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8006d8:	eb d0                	jmp    8006aa <vprintfmt+0x5e>
+  8006da:	0f b6 c9             	movzbl %cl,%ecx
+  8006dd:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8006e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8006e3:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8006e7:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006ea:	83 f9 09             	cmp    $0x9,%ecx
+  8006ed:	77 6f                	ja     80075e <vprintfmt+0x112>
+  8006ef:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8006f2:	83 c2 01             	add    $0x1,%edx
+  8006f5:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8006f8:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8006fc:	0f be 02             	movsbl (%edx),%eax
+  8006ff:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800702:	83 fe 09             	cmp    $0x9,%esi
+  800705:	76 eb                	jbe    8006f2 <vprintfmt+0xa6>
+  800707:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80070a:	89 d6                	mov    %edx,%esi
+  80070c:	eb 13                	jmp    800721 <vprintfmt+0xd5>
+  80070e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800711:	8b 00                	mov    (%eax),%eax
+  800713:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8d 40 04             	lea    0x4(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071f:	89 d6                	mov    %edx,%esi
+  800721:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800725:	79 83                	jns    8006aa <vprintfmt+0x5e>
+  800727:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80072a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80072d:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800734:	e9 71 ff ff ff       	jmp    8006aa <vprintfmt+0x5e>
+  800739:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80073c:	85 c9                	test   %ecx,%ecx
+  80073e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800743:	0f 49 c1             	cmovns %ecx,%eax
+  800746:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800749:	89 d6                	mov    %edx,%esi
+  80074b:	e9 5a ff ff ff       	jmp    8006aa <vprintfmt+0x5e>
+  800750:	89 d6                	mov    %edx,%esi
+  800752:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800759:	e9 4c ff ff ff       	jmp    8006aa <vprintfmt+0x5e>
+  80075e:	89 d6                	mov    %edx,%esi
+  800760:	eb bf                	jmp    800721 <vprintfmt+0xd5>
+  800762:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800766:	89 d6                	mov    %edx,%esi
+  800768:	e9 3d ff ff ff       	jmp    8006aa <vprintfmt+0x5e>
+  80076d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8d 70 04             	lea    0x4(%eax),%esi
+  800776:	83 ec 08             	sub    $0x8,%esp
+  800779:	53                   	push   %ebx
+  80077a:	ff 30                	push   (%eax)
+  80077c:	ff d7                	call   *%edi
+  80077e:	83 c4 10             	add    $0x10,%esp
+  800781:	89 75 14             	mov    %esi,0x14(%ebp)
+  800784:	e9 d4 fe ff ff       	jmp    80065d <vprintfmt+0x11>
+  800789:	89 55 10             	mov    %edx,0x10(%ebp)
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8d 70 04             	lea    0x4(%eax),%esi
+  800792:	8b 10                	mov    (%eax),%edx
+  800794:	89 d0                	mov    %edx,%eax
+  800796:	f7 d8                	neg    %eax
+  800798:	0f 48 c2             	cmovs  %edx,%eax
+  80079b:	83 f8 12             	cmp    $0x12,%eax
+  80079e:	7f 23                	jg     8007c3 <vprintfmt+0x177>
+  8007a0:	8b 14 85 60 3f 80 00 	mov    0x803f60(,%eax,4),%edx
+  8007a7:	85 d2                	test   %edx,%edx
+  8007a9:	74 18                	je     8007c3 <vprintfmt+0x177>
+  8007ab:	52                   	push   %edx
+  8007ac:	68 a3 41 80 00       	push   $0x8041a3
+  8007b1:	53                   	push   %ebx
+  8007b2:	57                   	push   %edi
+  8007b3:	e8 77 fe ff ff       	call   80062f <printfmt>
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	89 75 14             	mov    %esi,0x14(%ebp)
+  8007be:	e9 9a fe ff ff       	jmp    80065d <vprintfmt+0x11>
+  8007c3:	50                   	push   %eax
+  8007c4:	68 cf 3c 80 00       	push   $0x803ccf
+  8007c9:	53                   	push   %ebx
+  8007ca:	57                   	push   %edi
+  8007cb:	e8 5f fe ff ff       	call   80062f <printfmt>
+  8007d0:	83 c4 10             	add    $0x10,%esp
+  8007d3:	89 75 14             	mov    %esi,0x14(%ebp)
+  8007d6:	e9 82 fe ff ff       	jmp    80065d <vprintfmt+0x11>
+  8007db:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	83 c0 04             	add    $0x4,%eax
+  8007e4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ea:	8b 00                	mov    (%eax),%eax
+  8007ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007ef:	85 c0                	test   %eax,%eax
+  8007f1:	0f 84 61 03 00 00    	je     800b58 <vprintfmt+0x50c>
+  8007f7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007fb:	7e 06                	jle    800803 <vprintfmt+0x1b7>
+  8007fd:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800801:	75 29                	jne    80082c <vprintfmt+0x1e0>
+  800803:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800806:	8d 70 01             	lea    0x1(%eax),%esi
+  800809:	0f b6 00             	movzbl (%eax),%eax
+  80080c:	0f be d0             	movsbl %al,%edx
+  80080f:	85 d2                	test   %edx,%edx
+  800811:	0f 84 bb 00 00 00    	je     8008d2 <vprintfmt+0x286>
+  800817:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80081a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80081d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800820:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800823:	eb 7a                	jmp    80089f <vprintfmt+0x253>
+  800825:	c7 45 d0 c8 3c 80 00 	movl   $0x803cc8,-0x30(%ebp)
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  80082f:	ff 75 d4             	push   -0x2c(%ebp)
+  800832:	ff 75 d0             	push   -0x30(%ebp)
+  800835:	e8 e0 03 00 00       	call   800c1a <strnlen>
+  80083a:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80083d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800840:	83 c4 10             	add    $0x10,%esp
+  800843:	85 d2                	test   %edx,%edx
+  800845:	0f 8e d6 02 00 00    	jle    800b21 <vprintfmt+0x4d5>
+  80084b:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80084f:	83 ec 08             	sub    $0x8,%esp
+  800852:	53                   	push   %ebx
+  800853:	56                   	push   %esi
+  800854:	ff d7                	call   *%edi
+  800856:	83 c4 10             	add    $0x10,%esp
+  800859:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80085d:	75 f0                	jne    80084f <vprintfmt+0x203>
+  80085f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800862:	8d 70 01             	lea    0x1(%eax),%esi
+  800865:	0f b6 00             	movzbl (%eax),%eax
+  800868:	0f be d0             	movsbl %al,%edx
+  80086b:	85 d2                	test   %edx,%edx
+  80086d:	0f 84 da 02 00 00    	je     800b4d <vprintfmt+0x501>
+  800873:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800876:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800879:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80087c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80087f:	eb 1e                	jmp    80089f <vprintfmt+0x253>
+  800881:	83 ec 08             	sub    $0x8,%esp
+  800884:	ff 75 0c             	push   0xc(%ebp)
+  800887:	52                   	push   %edx
+  800888:	ff 55 08             	call   *0x8(%ebp)
+  80088b:	83 c4 10             	add    $0x10,%esp
+  80088e:	83 eb 01             	sub    $0x1,%ebx
+  800891:	83 c6 01             	add    $0x1,%esi
+  800894:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800898:	0f be d0             	movsbl %al,%edx
+  80089b:	85 d2                	test   %edx,%edx
+  80089d:	74 2a                	je     8008c9 <vprintfmt+0x27d>
+  80089f:	85 ff                	test   %edi,%edi
+  8008a1:	78 05                	js     8008a8 <vprintfmt+0x25c>
+  8008a3:	83 ef 01             	sub    $0x1,%edi
+  8008a6:	78 59                	js     800901 <vprintfmt+0x2b5>
+  8008a8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008ac:	74 d3                	je     800881 <vprintfmt+0x235>
+  8008ae:	0f be c0             	movsbl %al,%eax
+  8008b1:	83 e8 20             	sub    $0x20,%eax
+  8008b4:	83 f8 5e             	cmp    $0x5e,%eax
+  8008b7:	76 c8                	jbe    800881 <vprintfmt+0x235>
+  8008b9:	83 ec 08             	sub    $0x8,%esp
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	6a 3f                	push   $0x3f
+  8008c1:	ff 55 08             	call   *0x8(%ebp)
+  8008c4:	83 c4 10             	add    $0x10,%esp
+  8008c7:	eb c5                	jmp    80088e <vprintfmt+0x242>
+  8008c9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8008cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008d2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8008d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008d9:	7e 1b                	jle    8008f6 <vprintfmt+0x2aa>
+  8008db:	83 ec 08             	sub    $0x8,%esp
+  8008de:	53                   	push   %ebx
+  8008df:	6a 20                	push   $0x20
+  8008e1:	ff d7                	call   *%edi
+  8008e3:	83 c4 10             	add    $0x10,%esp
+  8008e6:	83 ee 01             	sub    $0x1,%esi
+  8008e9:	75 f0                	jne    8008db <vprintfmt+0x28f>
+  8008eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f1:	e9 67 fd ff ff       	jmp    80065d <vprintfmt+0x11>
+  8008f6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008fc:	e9 5c fd ff ff       	jmp    80065d <vprintfmt+0x11>
+  800901:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800904:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800907:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80090a:	eb c6                	jmp    8008d2 <vprintfmt+0x286>
+  80090c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80090f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800912:	83 f9 01             	cmp    $0x1,%ecx
+  800915:	7f 1f                	jg     800936 <vprintfmt+0x2ea>
+  800917:	85 c9                	test   %ecx,%ecx
+  800919:	74 67                	je     800982 <vprintfmt+0x336>
+  80091b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091e:	8b 30                	mov    (%eax),%esi
+  800920:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800923:	89 f0                	mov    %esi,%eax
+  800925:	c1 f8 1f             	sar    $0x1f,%eax
+  800928:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80092b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092e:	8d 40 04             	lea    0x4(%eax),%eax
+  800931:	89 45 14             	mov    %eax,0x14(%ebp)
+  800934:	eb 17                	jmp    80094d <vprintfmt+0x301>
+  800936:	8b 45 14             	mov    0x14(%ebp),%eax
+  800939:	8b 50 04             	mov    0x4(%eax),%edx
+  80093c:	8b 00                	mov    (%eax),%eax
+  80093e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800941:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800944:	8b 45 14             	mov    0x14(%ebp),%eax
+  800947:	8d 40 08             	lea    0x8(%eax),%eax
+  80094a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80094d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800950:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800953:	be 0a 00 00 00       	mov    $0xa,%esi
+  800958:	85 c9                	test   %ecx,%ecx
+  80095a:	0f 89 12 01 00 00    	jns    800a72 <vprintfmt+0x426>
+  800960:	83 ec 08             	sub    $0x8,%esp
+  800963:	53                   	push   %ebx
+  800964:	6a 2d                	push   $0x2d
+  800966:	ff d7                	call   *%edi
+  800968:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80096b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80096e:	f7 da                	neg    %edx
+  800970:	83 d1 00             	adc    $0x0,%ecx
+  800973:	f7 d9                	neg    %ecx
+  800975:	83 c4 10             	add    $0x10,%esp
+  800978:	be 0a 00 00 00       	mov    $0xa,%esi
+  80097d:	e9 f0 00 00 00       	jmp    800a72 <vprintfmt+0x426>
+  800982:	8b 45 14             	mov    0x14(%ebp),%eax
+  800985:	8b 30                	mov    (%eax),%esi
+  800987:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80098a:	89 f0                	mov    %esi,%eax
+  80098c:	c1 f8 1f             	sar    $0x1f,%eax
+  80098f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800992:	8b 45 14             	mov    0x14(%ebp),%eax
+  800995:	8d 40 04             	lea    0x4(%eax),%eax
+  800998:	89 45 14             	mov    %eax,0x14(%ebp)
+  80099b:	eb b0                	jmp    80094d <vprintfmt+0x301>
+  80099d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009a0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009a3:	83 f9 01             	cmp    $0x1,%ecx
+  8009a6:	7f 1e                	jg     8009c6 <vprintfmt+0x37a>
+  8009a8:	85 c9                	test   %ecx,%ecx
+  8009aa:	74 32                	je     8009de <vprintfmt+0x392>
+  8009ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009af:	8b 10                	mov    (%eax),%edx
+  8009b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009bc:	be 0a 00 00 00       	mov    $0xa,%esi
+  8009c1:	e9 ac 00 00 00       	jmp    800a72 <vprintfmt+0x426>
+  8009c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c9:	8b 10                	mov    (%eax),%edx
+  8009cb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8009d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8009d9:	e9 94 00 00 00       	jmp    800a72 <vprintfmt+0x426>
+  8009de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e1:	8b 10                	mov    (%eax),%edx
+  8009e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ee:	be 0a 00 00 00       	mov    $0xa,%esi
+  8009f3:	eb 7d                	jmp    800a72 <vprintfmt+0x426>
+  8009f5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009f8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009fb:	83 f9 01             	cmp    $0x1,%ecx
+  8009fe:	7f 1b                	jg     800a1b <vprintfmt+0x3cf>
+  800a00:	85 c9                	test   %ecx,%ecx
+  800a02:	74 2c                	je     800a30 <vprintfmt+0x3e4>
+  800a04:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a07:	8b 10                	mov    (%eax),%edx
+  800a09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a0e:	8d 40 04             	lea    0x4(%eax),%eax
+  800a11:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a14:	be 08 00 00 00       	mov    $0x8,%esi
+  800a19:	eb 57                	jmp    800a72 <vprintfmt+0x426>
+  800a1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1e:	8b 10                	mov    (%eax),%edx
+  800a20:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a23:	8d 40 08             	lea    0x8(%eax),%eax
+  800a26:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a29:	be 08 00 00 00       	mov    $0x8,%esi
+  800a2e:	eb 42                	jmp    800a72 <vprintfmt+0x426>
+  800a30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a33:	8b 10                	mov    (%eax),%edx
+  800a35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a40:	be 08 00 00 00       	mov    $0x8,%esi
+  800a45:	eb 2b                	jmp    800a72 <vprintfmt+0x426>
+  800a47:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a4a:	83 ec 08             	sub    $0x8,%esp
+  800a4d:	53                   	push   %ebx
+  800a4e:	6a 30                	push   $0x30
+  800a50:	ff d7                	call   *%edi
+  800a52:	83 c4 08             	add    $0x8,%esp
+  800a55:	53                   	push   %ebx
+  800a56:	6a 78                	push   $0x78
+  800a58:	ff d7                	call   *%edi
+  800a5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5d:	8b 10                	mov    (%eax),%edx
+  800a5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a64:	83 c4 10             	add    $0x10,%esp
+  800a67:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a6d:	be 10 00 00 00       	mov    $0x10,%esi
+  800a72:	83 ec 0c             	sub    $0xc,%esp
+  800a75:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800a79:	50                   	push   %eax
+  800a7a:	ff 75 e4             	push   -0x1c(%ebp)
+  800a7d:	56                   	push   %esi
+  800a7e:	51                   	push   %ecx
+  800a7f:	52                   	push   %edx
+  800a80:	89 da                	mov    %ebx,%edx
+  800a82:	89 f8                	mov    %edi,%eax
+  800a84:	e8 d8 fa ff ff       	call   800561 <printnum>
+  800a89:	83 c4 20             	add    $0x20,%esp
+  800a8c:	e9 cc fb ff ff       	jmp    80065d <vprintfmt+0x11>
+  800a91:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a94:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a97:	83 f9 01             	cmp    $0x1,%ecx
+  800a9a:	7f 1b                	jg     800ab7 <vprintfmt+0x46b>
+  800a9c:	85 c9                	test   %ecx,%ecx
+  800a9e:	74 2c                	je     800acc <vprintfmt+0x480>
+  800aa0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa3:	8b 10                	mov    (%eax),%edx
+  800aa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aaa:	8d 40 04             	lea    0x4(%eax),%eax
+  800aad:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ab0:	be 10 00 00 00       	mov    $0x10,%esi
+  800ab5:	eb bb                	jmp    800a72 <vprintfmt+0x426>
+  800ab7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aba:	8b 10                	mov    (%eax),%edx
+  800abc:	8b 48 04             	mov    0x4(%eax),%ecx
+  800abf:	8d 40 08             	lea    0x8(%eax),%eax
+  800ac2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac5:	be 10 00 00 00       	mov    $0x10,%esi
+  800aca:	eb a6                	jmp    800a72 <vprintfmt+0x426>
+  800acc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800acf:	8b 10                	mov    (%eax),%edx
+  800ad1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad6:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800adc:	be 10 00 00 00       	mov    $0x10,%esi
+  800ae1:	eb 8f                	jmp    800a72 <vprintfmt+0x426>
+  800ae3:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ae6:	83 ec 08             	sub    $0x8,%esp
+  800ae9:	53                   	push   %ebx
+  800aea:	6a 25                	push   $0x25
+  800aec:	ff d7                	call   *%edi
+  800aee:	83 c4 10             	add    $0x10,%esp
+  800af1:	e9 67 fb ff ff       	jmp    80065d <vprintfmt+0x11>
+  800af6:	83 ec 08             	sub    $0x8,%esp
+  800af9:	53                   	push   %ebx
+  800afa:	6a 25                	push   $0x25
+  800afc:	ff d7                	call   *%edi
+  800afe:	83 c4 10             	add    $0x10,%esp
+  800b01:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800b05:	0f 84 ba fb ff ff    	je     8006c5 <vprintfmt+0x79>
+  800b0b:	89 75 10             	mov    %esi,0x10(%ebp)
+  800b0e:	89 f0                	mov    %esi,%eax
+  800b10:	83 e8 01             	sub    $0x1,%eax
+  800b13:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b17:	75 f7                	jne    800b10 <vprintfmt+0x4c4>
+  800b19:	89 45 10             	mov    %eax,0x10(%ebp)
+  800b1c:	e9 3c fb ff ff       	jmp    80065d <vprintfmt+0x11>
+  800b21:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b24:	8d 70 01             	lea    0x1(%eax),%esi
+  800b27:	0f b6 00             	movzbl (%eax),%eax
+  800b2a:	0f be d0             	movsbl %al,%edx
+  800b2d:	85 d2                	test   %edx,%edx
+  800b2f:	74 11                	je     800b42 <vprintfmt+0x4f6>
+  800b31:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b34:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b37:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b3a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b3d:	e9 5d fd ff ff       	jmp    80089f <vprintfmt+0x253>
+  800b42:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b45:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b48:	e9 10 fb ff ff       	jmp    80065d <vprintfmt+0x11>
+  800b4d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b50:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b53:	e9 05 fb ff ff       	jmp    80065d <vprintfmt+0x11>
+  800b58:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b5c:	7e 0a                	jle    800b68 <vprintfmt+0x51c>
+  800b5e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800b62:	0f 85 bd fc ff ff    	jne    800825 <vprintfmt+0x1d9>
+  800b68:	ba 28 00 00 00       	mov    $0x28,%edx
+  800b6d:	b8 28 00 00 00       	mov    $0x28,%eax
+  800b72:	be c9 3c 80 00       	mov    $0x803cc9,%esi
+  800b77:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b7a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b7d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b80:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b83:	e9 17 fd ff ff       	jmp    80089f <vprintfmt+0x253>
+  800b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5f                   	pop    %edi
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+
+00800b90 <vsnprintf>:
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	83 ec 18             	sub    $0x18,%esp
+  800b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b9c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b9f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ba3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ba6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800bad:	85 c0                	test   %eax,%eax
+  800baf:	74 26                	je     800bd7 <vsnprintf+0x47>
+  800bb1:	85 d2                	test   %edx,%edx
+  800bb3:	7e 22                	jle    800bd7 <vsnprintf+0x47>
+  800bb5:	ff 75 14             	push   0x14(%ebp)
+  800bb8:	ff 75 10             	push   0x10(%ebp)
+  800bbb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800bbe:	50                   	push   %eax
+  800bbf:	68 12 06 80 00       	push   $0x800612
+  800bc4:	e8 83 fa ff ff       	call   80064c <vprintfmt>
+  800bc9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800bcc:	c6 00 00             	movb   $0x0,(%eax)
+  800bcf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bd2:	83 c4 10             	add    $0x10,%esp
+  800bd5:	c9                   	leave
+  800bd6:	c3                   	ret
+  800bd7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bdc:	eb f7                	jmp    800bd5 <vsnprintf+0x45>
+
+00800bde <snprintf>:
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	83 ec 08             	sub    $0x8,%esp
+  800be4:	8d 45 14             	lea    0x14(%ebp),%eax
+  800be7:	50                   	push   %eax
+  800be8:	ff 75 10             	push   0x10(%ebp)
+  800beb:	ff 75 0c             	push   0xc(%ebp)
+  800bee:	ff 75 08             	push   0x8(%ebp)
+  800bf1:	e8 9a ff ff ff       	call   800b90 <vsnprintf>
+  800bf6:	c9                   	leave
+  800bf7:	c3                   	ret
+
+00800bf8 <strlen>:
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfe:	80 3a 00             	cmpb   $0x0,(%edx)
+  800c01:	74 10                	je     800c13 <strlen+0x1b>
+  800c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c08:	83 c0 01             	add    $0x1,%eax
+  800c0b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c0f:	75 f7                	jne    800c08 <strlen+0x10>
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	eb f7                	jmp    800c11 <strlen+0x19>
+
+00800c1a <strnlen>:
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c23:	85 d2                	test   %edx,%edx
+  800c25:	74 16                	je     800c3d <strnlen+0x23>
+  800c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c30:	74 09                	je     800c3b <strnlen+0x21>
+  800c32:	83 c0 01             	add    $0x1,%eax
+  800c35:	39 d0                	cmp    %edx,%eax
+  800c37:	75 f3                	jne    800c2c <strnlen+0x12>
+  800c39:	89 d0                	mov    %edx,%eax
+  800c3b:	5d                   	pop    %ebp
+  800c3c:	c3                   	ret
+  800c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c42:	eb f7                	jmp    800c3b <strnlen+0x21>
+
+00800c44 <strcpy>:
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	53                   	push   %ebx
+  800c48:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c53:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c57:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c5a:	83 c0 01             	add    $0x1,%eax
+  800c5d:	84 d2                	test   %dl,%dl
+  800c5f:	75 f2                	jne    800c53 <strcpy+0xf>
+  800c61:	89 c8                	mov    %ecx,%eax
+  800c63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c66:	c9                   	leave
+  800c67:	c3                   	ret
+
+00800c68 <strcat>:
+  800c68:	55                   	push   %ebp
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	53                   	push   %ebx
+  800c6c:	83 ec 10             	sub    $0x10,%esp
+  800c6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c72:	53                   	push   %ebx
+  800c73:	e8 80 ff ff ff       	call   800bf8 <strlen>
+  800c78:	83 c4 08             	add    $0x8,%esp
+  800c7b:	ff 75 0c             	push   0xc(%ebp)
+  800c7e:	01 d8                	add    %ebx,%eax
+  800c80:	50                   	push   %eax
+  800c81:	e8 be ff ff ff       	call   800c44 <strcpy>
+  800c86:	89 d8                	mov    %ebx,%eax
+  800c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c8b:	c9                   	leave
+  800c8c:	c3                   	ret
+
+00800c8d <strncpy>:
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	56                   	push   %esi
+  800c91:	53                   	push   %ebx
+  800c92:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c9b:	85 db                	test   %ebx,%ebx
+  800c9d:	74 17                	je     800cb6 <strncpy+0x29>
+  800c9f:	01 f3                	add    %esi,%ebx
+  800ca1:	89 f0                	mov    %esi,%eax
+  800ca3:	83 c0 01             	add    $0x1,%eax
+  800ca6:	0f b6 0a             	movzbl (%edx),%ecx
+  800ca9:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800cac:	80 f9 01             	cmp    $0x1,%cl
+  800caf:	83 da ff             	sbb    $0xffffffff,%edx
+  800cb2:	39 c3                	cmp    %eax,%ebx
+  800cb4:	75 ed                	jne    800ca3 <strncpy+0x16>
+  800cb6:	89 f0                	mov    %esi,%eax
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5d                   	pop    %ebp
+  800cbb:	c3                   	ret
+
+00800cbc <strlcpy>:
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	56                   	push   %esi
+  800cc0:	53                   	push   %ebx
+  800cc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cca:	89 f0                	mov    %esi,%eax
+  800ccc:	85 db                	test   %ebx,%ebx
+  800cce:	74 1e                	je     800cee <strlcpy+0x32>
+  800cd0:	83 eb 01             	sub    $0x1,%ebx
+  800cd3:	74 16                	je     800ceb <strlcpy+0x2f>
+  800cd5:	01 f3                	add    %esi,%ebx
+  800cd7:	0f b6 0a             	movzbl (%edx),%ecx
+  800cda:	84 c9                	test   %cl,%cl
+  800cdc:	74 0d                	je     800ceb <strlcpy+0x2f>
+  800cde:	83 c2 01             	add    $0x1,%edx
+  800ce1:	83 c0 01             	add    $0x1,%eax
+  800ce4:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800ce7:	39 d8                	cmp    %ebx,%eax
+  800ce9:	75 ec                	jne    800cd7 <strlcpy+0x1b>
+  800ceb:	c6 00 00             	movb   $0x0,(%eax)
+  800cee:	29 f0                	sub    %esi,%eax
+  800cf0:	5b                   	pop    %ebx
+  800cf1:	5e                   	pop    %esi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+
+00800cf4 <strcmp>:
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cfa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cfd:	0f b6 01             	movzbl (%ecx),%eax
+  800d00:	84 c0                	test   %al,%al
+  800d02:	74 11                	je     800d15 <strcmp+0x21>
+  800d04:	38 02                	cmp    %al,(%edx)
+  800d06:	75 0d                	jne    800d15 <strcmp+0x21>
+  800d08:	83 c1 01             	add    $0x1,%ecx
+  800d0b:	83 c2 01             	add    $0x1,%edx
+  800d0e:	0f b6 01             	movzbl (%ecx),%eax
+  800d11:	84 c0                	test   %al,%al
+  800d13:	75 ef                	jne    800d04 <strcmp+0x10>
+  800d15:	0f b6 c0             	movzbl %al,%eax
+  800d18:	0f b6 12             	movzbl (%edx),%edx
+  800d1b:	29 d0                	sub    %edx,%eax
+  800d1d:	5d                   	pop    %ebp
+  800d1e:	c3                   	ret
+
+00800d1f <strncmp>:
+  800d1f:	55                   	push   %ebp
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	53                   	push   %ebx
+  800d23:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d26:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d29:	8b 55 10             	mov    0x10(%ebp),%edx
+  800d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d31:	85 d2                	test   %edx,%edx
+  800d33:	74 2e                	je     800d63 <strncmp+0x44>
+  800d35:	0f b6 01             	movzbl (%ecx),%eax
+  800d38:	84 c0                	test   %al,%al
+  800d3a:	74 16                	je     800d52 <strncmp+0x33>
+  800d3c:	3a 03                	cmp    (%ebx),%al
+  800d3e:	75 12                	jne    800d52 <strncmp+0x33>
+  800d40:	83 c1 01             	add    $0x1,%ecx
+  800d43:	83 c3 01             	add    $0x1,%ebx
+  800d46:	83 ea 01             	sub    $0x1,%edx
+  800d49:	75 ea                	jne    800d35 <strncmp+0x16>
+  800d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d50:	eb 11                	jmp    800d63 <strncmp+0x44>
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	85 d2                	test   %edx,%edx
+  800d59:	74 08                	je     800d63 <strncmp+0x44>
+  800d5b:	0f b6 01             	movzbl (%ecx),%eax
+  800d5e:	0f b6 13             	movzbl (%ebx),%edx
+  800d61:	29 d0                	sub    %edx,%eax
+  800d63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+00800d68 <strchr>:
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800d72:	0f b6 10             	movzbl (%eax),%edx
+  800d75:	84 d2                	test   %dl,%dl
+  800d77:	74 15                	je     800d8e <strchr+0x26>
+  800d79:	38 d1                	cmp    %dl,%cl
+  800d7b:	74 0f                	je     800d8c <strchr+0x24>
+  800d7d:	83 c0 01             	add    $0x1,%eax
+  800d80:	0f b6 10             	movzbl (%eax),%edx
+  800d83:	84 d2                	test   %dl,%dl
+  800d85:	75 f2                	jne    800d79 <strchr+0x11>
+  800d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+  800d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d93:	eb f7                	jmp    800d8c <strchr+0x24>
+
+00800d95 <strfind>:
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	53                   	push   %ebx
+  800d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d9f:	0f b6 18             	movzbl (%eax),%ebx
+  800da2:	38 d3                	cmp    %dl,%bl
+  800da4:	74 14                	je     800dba <strfind+0x25>
+  800da6:	89 d1                	mov    %edx,%ecx
+  800da8:	84 db                	test   %bl,%bl
+  800daa:	74 0e                	je     800dba <strfind+0x25>
+  800dac:	83 c0 01             	add    $0x1,%eax
+  800daf:	0f b6 10             	movzbl (%eax),%edx
+  800db2:	38 ca                	cmp    %cl,%dl
+  800db4:	74 04                	je     800dba <strfind+0x25>
+  800db6:	84 d2                	test   %dl,%dl
+  800db8:	75 f2                	jne    800dac <strfind+0x17>
+  800dba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dbd:	c9                   	leave
+  800dbe:	c3                   	ret
+
+00800dbf <memset>:
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800dc6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800dc9:	85 c9                	test   %ecx,%ecx
+  800dcb:	74 20                	je     800ded <memset+0x2e>
+  800dcd:	89 f8                	mov    %edi,%eax
+  800dcf:	09 c8                	or     %ecx,%eax
+  800dd1:	a8 03                	test   $0x3,%al
+  800dd3:	75 12                	jne    800de7 <memset+0x28>
+  800dd5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800dd9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ddf:	c1 e9 02             	shr    $0x2,%ecx
+  800de2:	fc                   	cld
+  800de3:	f3 ab                	rep stos %eax,%es:(%edi)
+  800de5:	eb 06                	jmp    800ded <memset+0x2e>
+  800de7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dea:	fc                   	cld
+  800deb:	f3 aa                	rep stos %al,%es:(%edi)
+  800ded:	89 f8                	mov    %edi,%eax
+  800def:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800df2:	c9                   	leave
+  800df3:	c3                   	ret
+
+00800df4 <memmove>:
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dfc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800dff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800e02:	39 c6                	cmp    %eax,%esi
+  800e04:	73 32                	jae    800e38 <memmove+0x44>
+  800e06:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e09:	39 d0                	cmp    %edx,%eax
+  800e0b:	73 2b                	jae    800e38 <memmove+0x44>
+  800e0d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800e10:	89 d6                	mov    %edx,%esi
+  800e12:	09 fe                	or     %edi,%esi
+  800e14:	09 ce                	or     %ecx,%esi
+  800e16:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e1c:	75 0e                	jne    800e2c <memmove+0x38>
+  800e1e:	83 ef 04             	sub    $0x4,%edi
+  800e21:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e24:	c1 e9 02             	shr    $0x2,%ecx
+  800e27:	fd                   	std
+  800e28:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e2a:	eb 09                	jmp    800e35 <memmove+0x41>
+  800e2c:	83 ef 01             	sub    $0x1,%edi
+  800e2f:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800e32:	fd                   	std
+  800e33:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800e35:	fc                   	cld
+  800e36:	eb 1a                	jmp    800e52 <memmove+0x5e>
+  800e38:	89 f2                	mov    %esi,%edx
+  800e3a:	09 c2                	or     %eax,%edx
+  800e3c:	09 ca                	or     %ecx,%edx
+  800e3e:	f6 c2 03             	test   $0x3,%dl
+  800e41:	75 0a                	jne    800e4d <memmove+0x59>
+  800e43:	c1 e9 02             	shr    $0x2,%ecx
+  800e46:	89 c7                	mov    %eax,%edi
+  800e48:	fc                   	cld
+  800e49:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e4b:	eb 05                	jmp    800e52 <memmove+0x5e>
+  800e4d:	89 c7                	mov    %eax,%edi
+  800e4f:	fc                   	cld
+  800e50:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800e52:	5e                   	pop    %esi
+  800e53:	5f                   	pop    %edi
+  800e54:	5d                   	pop    %ebp
+  800e55:	c3                   	ret
+
+00800e56 <memcpy>:
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	ff 75 10             	push   0x10(%ebp)
+  800e5f:	ff 75 0c             	push   0xc(%ebp)
+  800e62:	ff 75 08             	push   0x8(%ebp)
+  800e65:	e8 8a ff ff ff       	call   800df4 <memmove>
+  800e6a:	c9                   	leave
+  800e6b:	c3                   	ret
+
+00800e6c <memcmp>:
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  800e71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e77:	8b 75 10             	mov    0x10(%ebp),%esi
+  800e7a:	85 f6                	test   %esi,%esi
+  800e7c:	74 29                	je     800ea7 <memcmp+0x3b>
+  800e7e:	01 c6                	add    %eax,%esi
+  800e80:	0f b6 08             	movzbl (%eax),%ecx
+  800e83:	0f b6 1a             	movzbl (%edx),%ebx
+  800e86:	38 d9                	cmp    %bl,%cl
+  800e88:	75 11                	jne    800e9b <memcmp+0x2f>
+  800e8a:	83 c0 01             	add    $0x1,%eax
+  800e8d:	83 c2 01             	add    $0x1,%edx
+  800e90:	39 c6                	cmp    %eax,%esi
+  800e92:	75 ec                	jne    800e80 <memcmp+0x14>
+  800e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e99:	eb 08                	jmp    800ea3 <memcmp+0x37>
+  800e9b:	0f b6 c1             	movzbl %cl,%eax
+  800e9e:	0f b6 db             	movzbl %bl,%ebx
+  800ea1:	29 d8                	sub    %ebx,%eax
+  800ea3:	5b                   	pop    %ebx
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eac:	eb f5                	jmp    800ea3 <memcmp+0x37>
+
+00800eae <memfind>:
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	89 c2                	mov    %eax,%edx
+  800eb9:	03 55 10             	add    0x10(%ebp),%edx
+  800ebc:	39 d0                	cmp    %edx,%eax
+  800ebe:	73 0d                	jae    800ecd <memfind+0x1f>
+  800ec0:	38 08                	cmp    %cl,(%eax)
+  800ec2:	74 0d                	je     800ed1 <memfind+0x23>
+  800ec4:	83 c0 01             	add    $0x1,%eax
+  800ec7:	39 c2                	cmp    %eax,%edx
+  800ec9:	75 f5                	jne    800ec0 <memfind+0x12>
+  800ecb:	eb 06                	jmp    800ed3 <memfind+0x25>
+  800ecd:	89 c2                	mov    %eax,%edx
+  800ecf:	eb 02                	jmp    800ed3 <memfind+0x25>
+  800ed1:	89 c2                	mov    %eax,%edx
+  800ed3:	89 d0                	mov    %edx,%eax
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+
+00800ed7 <strtol>:
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	57                   	push   %edi
+  800edb:	56                   	push   %esi
+  800edc:	53                   	push   %ebx
+  800edd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee3:	0f b6 02             	movzbl (%edx),%eax
+  800ee6:	3c 20                	cmp    $0x20,%al
+  800ee8:	74 04                	je     800eee <strtol+0x17>
+  800eea:	3c 09                	cmp    $0x9,%al
+  800eec:	75 0e                	jne    800efc <strtol+0x25>
+  800eee:	83 c2 01             	add    $0x1,%edx
+  800ef1:	0f b6 02             	movzbl (%edx),%eax
+  800ef4:	3c 20                	cmp    $0x20,%al
+  800ef6:	74 f6                	je     800eee <strtol+0x17>
+  800ef8:	3c 09                	cmp    $0x9,%al
+  800efa:	74 f2                	je     800eee <strtol+0x17>
+  800efc:	3c 2b                	cmp    $0x2b,%al
+  800efe:	74 2a                	je     800f2a <strtol+0x53>
+  800f00:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f05:	3c 2d                	cmp    $0x2d,%al
+  800f07:	74 2b                	je     800f34 <strtol+0x5d>
+  800f09:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f0f:	75 0f                	jne    800f20 <strtol+0x49>
+  800f11:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f14:	74 28                	je     800f3e <strtol+0x67>
+  800f16:	85 db                	test   %ebx,%ebx
+  800f18:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f1d:	0f 44 d8             	cmove  %eax,%ebx
+  800f20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f25:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f28:	eb 46                	jmp    800f70 <strtol+0x99>
+  800f2a:	83 c2 01             	add    $0x1,%edx
+  800f2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f32:	eb d5                	jmp    800f09 <strtol+0x32>
+  800f34:	83 c2 01             	add    $0x1,%edx
+  800f37:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f3c:	eb cb                	jmp    800f09 <strtol+0x32>
+  800f3e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f42:	74 0e                	je     800f52 <strtol+0x7b>
+  800f44:	85 db                	test   %ebx,%ebx
+  800f46:	75 d8                	jne    800f20 <strtol+0x49>
+  800f48:	83 c2 01             	add    $0x1,%edx
+  800f4b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f50:	eb ce                	jmp    800f20 <strtol+0x49>
+  800f52:	83 c2 02             	add    $0x2,%edx
+  800f55:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f5a:	eb c4                	jmp    800f20 <strtol+0x49>
+  800f5c:	0f be c0             	movsbl %al,%eax
+  800f5f:	83 e8 30             	sub    $0x30,%eax
+  800f62:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f65:	7d 3a                	jge    800fa1 <strtol+0xca>
+  800f67:	83 c2 01             	add    $0x1,%edx
+  800f6a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f6e:	01 c1                	add    %eax,%ecx
+  800f70:	0f b6 02             	movzbl (%edx),%eax
+  800f73:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f76:	89 f3                	mov    %esi,%ebx
+  800f78:	80 fb 09             	cmp    $0x9,%bl
+  800f7b:	76 df                	jbe    800f5c <strtol+0x85>
+  800f7d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f80:	89 f3                	mov    %esi,%ebx
+  800f82:	80 fb 19             	cmp    $0x19,%bl
+  800f85:	77 08                	ja     800f8f <strtol+0xb8>
+  800f87:	0f be c0             	movsbl %al,%eax
+  800f8a:	83 e8 57             	sub    $0x57,%eax
+  800f8d:	eb d3                	jmp    800f62 <strtol+0x8b>
+  800f8f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f92:	89 f3                	mov    %esi,%ebx
+  800f94:	80 fb 19             	cmp    $0x19,%bl
+  800f97:	77 08                	ja     800fa1 <strtol+0xca>
+  800f99:	0f be c0             	movsbl %al,%eax
+  800f9c:	83 e8 37             	sub    $0x37,%eax
+  800f9f:	eb c1                	jmp    800f62 <strtol+0x8b>
+  800fa1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800fa5:	74 05                	je     800fac <strtol+0xd5>
+  800fa7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800faa:	89 10                	mov    %edx,(%eax)
+  800fac:	89 c8                	mov    %ecx,%eax
+  800fae:	f7 d8                	neg    %eax
+  800fb0:	85 ff                	test   %edi,%edi
+  800fb2:	0f 45 c8             	cmovne %eax,%ecx
+  800fb5:	89 c8                	mov    %ecx,%eax
+  800fb7:	5b                   	pop    %ebx
+  800fb8:	5e                   	pop    %esi
+  800fb9:	5f                   	pop    %edi
+  800fba:	5d                   	pop    %ebp
+  800fbb:	c3                   	ret
+
+00800fbc <sys_cputs>:
+  800fbc:	55                   	push   %ebp
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	57                   	push   %edi
+  800fc0:	56                   	push   %esi
+  800fc1:	53                   	push   %ebx
+  800fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcd:	89 c3                	mov    %eax,%ebx
+  800fcf:	89 c7                	mov    %eax,%edi
+  800fd1:	89 c6                	mov    %eax,%esi
+  800fd3:	cd 30                	int    $0x30
+  800fd5:	5b                   	pop    %ebx
+  800fd6:	5e                   	pop    %esi
+  800fd7:	5f                   	pop    %edi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+
+00800fda <sys_cgetc>:
+  800fda:	55                   	push   %ebp
+  800fdb:	89 e5                	mov    %esp,%ebp
+  800fdd:	57                   	push   %edi
+  800fde:	56                   	push   %esi
+  800fdf:	53                   	push   %ebx
+  800fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fea:	89 d1                	mov    %edx,%ecx
+  800fec:	89 d3                	mov    %edx,%ebx
+  800fee:	89 d7                	mov    %edx,%edi
+  800ff0:	89 d6                	mov    %edx,%esi
+  800ff2:	cd 30                	int    $0x30
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <sys_env_destroy>:
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  800fff:	83 ec 0c             	sub    $0xc,%esp
+  801002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80100f:	89 cb                	mov    %ecx,%ebx
+  801011:	89 cf                	mov    %ecx,%edi
+  801013:	89 ce                	mov    %ecx,%esi
+  801015:	cd 30                	int    $0x30
+  801017:	85 c0                	test   %eax,%eax
+  801019:	7f 08                	jg     801023 <sys_env_destroy+0x2a>
+  80101b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+  801023:	83 ec 0c             	sub    $0xc,%esp
+  801026:	50                   	push   %eax
+  801027:	6a 03                	push   $0x3
+  801029:	68 cb 3f 80 00       	push   $0x803fcb
+  80102e:	6a 24                	push   $0x24
+  801030:	68 e8 3f 80 00       	push   $0x803fe8
+  801035:	e8 38 f4 ff ff       	call   800472 <_panic>
+
+0080103a <sys_getenvid>:
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	57                   	push   %edi
+  80103e:	56                   	push   %esi
+  80103f:	53                   	push   %ebx
+  801040:	ba 00 00 00 00       	mov    $0x0,%edx
+  801045:	b8 02 00 00 00       	mov    $0x2,%eax
+  80104a:	89 d1                	mov    %edx,%ecx
+  80104c:	89 d3                	mov    %edx,%ebx
+  80104e:	89 d7                	mov    %edx,%edi
+  801050:	89 d6                	mov    %edx,%esi
+  801052:	cd 30                	int    $0x30
+  801054:	5b                   	pop    %ebx
+  801055:	5e                   	pop    %esi
+  801056:	5f                   	pop    %edi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+
+00801059 <sys_yield>:
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	56                   	push   %esi
+  80105e:	53                   	push   %ebx
+  80105f:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801066:	74 26                	je     80108e <sys_yield+0x35>
+  801068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801072:	89 d1                	mov    %edx,%ecx
+  801074:	89 d3                	mov    %edx,%ebx
+  801076:	89 d7                	mov    %edx,%edi
+  801078:	6a 00                	push   $0x0
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+  801085:	5d                   	pop    %ebp
+  801086:	83 c4 04             	add    $0x4,%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+  80108e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801093:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801098:	89 d1                	mov    %edx,%ecx
+  80109a:	89 d3                	mov    %edx,%ebx
+  80109c:	89 d7                	mov    %edx,%edi
+  80109e:	89 d6                	mov    %edx,%esi
+  8010a0:	cd 30                	int    $0x30
+  8010a2:	eb e5                	jmp    801089 <sys_yield+0x30>
+
+008010a4 <sys_page_alloc>:
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	57                   	push   %edi
+  8010a8:	56                   	push   %esi
+  8010a9:	53                   	push   %ebx
+  8010aa:	83 ec 0c             	sub    $0xc,%esp
+  8010ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c0:	89 f7                	mov    %esi,%edi
+  8010c2:	cd 30                	int    $0x30
+  8010c4:	85 c0                	test   %eax,%eax
+  8010c6:	7f 08                	jg     8010d0 <sys_page_alloc+0x2c>
+  8010c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+  8010d0:	83 ec 0c             	sub    $0xc,%esp
+  8010d3:	50                   	push   %eax
+  8010d4:	6a 04                	push   $0x4
+  8010d6:	68 cb 3f 80 00       	push   $0x803fcb
+  8010db:	6a 24                	push   $0x24
+  8010dd:	68 e8 3f 80 00       	push   $0x803fe8
+  8010e2:	e8 8b f3 ff ff       	call   800472 <_panic>
+
+008010e7 <sys_page_map>:
+  8010e7:	55                   	push   %ebp
+  8010e8:	89 e5                	mov    %esp,%ebp
+  8010ea:	57                   	push   %edi
+  8010eb:	56                   	push   %esi
+  8010ec:	53                   	push   %ebx
+  8010ed:	83 ec 0c             	sub    $0xc,%esp
+  8010f0:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010f7:	74 33                	je     80112c <sys_page_map+0x45>
+  8010f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ff:	b8 05 00 00 00       	mov    $0x5,%eax
+  801104:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801107:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80110a:	ff 75 18             	push   0x18(%ebp)
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	8d 35 18 11 80 00    	lea    0x801118,%esi
+  801116:	0f 34                	sysenter
+  801118:	5d                   	pop    %ebp
+  801119:	83 c4 04             	add    $0x4,%esp
+  80111c:	89 c2                	mov    %eax,%edx
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	7f 3d                	jg     80115f <sys_page_map+0x78>
+  801122:	89 d0                	mov    %edx,%eax
+  801124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801127:	5b                   	pop    %ebx
+  801128:	5e                   	pop    %esi
+  801129:	5f                   	pop    %edi
+  80112a:	5d                   	pop    %ebp
+  80112b:	c3                   	ret
+  80112c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801137:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801140:	cd 30                	int    $0x30
+  801142:	89 c2                	mov    %eax,%edx
+  801144:	85 c0                	test   %eax,%eax
+  801146:	7e da                	jle    801122 <sys_page_map+0x3b>
+  801148:	83 ec 0c             	sub    $0xc,%esp
+  80114b:	50                   	push   %eax
+  80114c:	6a 05                	push   $0x5
+  80114e:	68 cb 3f 80 00       	push   $0x803fcb
+  801153:	6a 24                	push   $0x24
+  801155:	68 e8 3f 80 00       	push   $0x803fe8
+  80115a:	e8 13 f3 ff ff       	call   800472 <_panic>
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	50                   	push   %eax
+  801163:	6a 05                	push   $0x5
+  801165:	68 cb 3f 80 00       	push   $0x803fcb
+  80116a:	6a 48                	push   $0x48
+  80116c:	68 e8 3f 80 00       	push   $0x803fe8
+  801171:	e8 fc f2 ff ff       	call   800472 <_panic>
+
+00801176 <sys_page_unmap>:
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	57                   	push   %edi
+  80117a:	56                   	push   %esi
+  80117b:	53                   	push   %ebx
+  80117c:	83 ec 0c             	sub    $0xc,%esp
+  80117f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80118f:	89 df                	mov    %ebx,%edi
+  801191:	89 de                	mov    %ebx,%esi
+  801193:	cd 30                	int    $0x30
+  801195:	85 c0                	test   %eax,%eax
+  801197:	7f 08                	jg     8011a1 <sys_page_unmap+0x2b>
+  801199:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5f                   	pop    %edi
+  80119f:	5d                   	pop    %ebp
+  8011a0:	c3                   	ret
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+  8011a4:	50                   	push   %eax
+  8011a5:	6a 06                	push   $0x6
+  8011a7:	68 cb 3f 80 00       	push   $0x803fcb
+  8011ac:	6a 24                	push   $0x24
+  8011ae:	68 e8 3f 80 00       	push   $0x803fe8
+  8011b3:	e8 ba f2 ff ff       	call   800472 <_panic>
+
+008011b8 <sys_fork>:
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	57                   	push   %edi
+  8011bc:	56                   	push   %esi
+  8011bd:	53                   	push   %ebx
+  8011be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8011c8:	89 d1                	mov    %edx,%ecx
+  8011ca:	89 d3                	mov    %edx,%ebx
+  8011cc:	89 d7                	mov    %edx,%edi
+  8011ce:	89 d6                	mov    %edx,%esi
+  8011d0:	cd 30                	int    $0x30
+  8011d2:	5b                   	pop    %ebx
+  8011d3:	5e                   	pop    %esi
+  8011d4:	5f                   	pop    %edi
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+
+008011d7 <sys_env_set_status>:
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	57                   	push   %edi
+  8011db:	56                   	push   %esi
+  8011dc:	53                   	push   %ebx
+  8011dd:	83 ec 0c             	sub    $0xc,%esp
+  8011e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011eb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011f0:	89 df                	mov    %ebx,%edi
+  8011f2:	89 de                	mov    %ebx,%esi
+  8011f4:	cd 30                	int    $0x30
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	7f 08                	jg     801202 <sys_env_set_status+0x2b>
+  8011fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5f                   	pop    %edi
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+  801202:	83 ec 0c             	sub    $0xc,%esp
+  801205:	50                   	push   %eax
+  801206:	6a 08                	push   $0x8
+  801208:	68 cb 3f 80 00       	push   $0x803fcb
+  80120d:	6a 24                	push   $0x24
+  80120f:	68 e8 3f 80 00       	push   $0x803fe8
+  801214:	e8 59 f2 ff ff       	call   800472 <_panic>
+
+00801219 <sys_env_set_trapframe>:
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	57                   	push   %edi
+  80121d:	56                   	push   %esi
+  80121e:	53                   	push   %ebx
+  80121f:	83 ec 0c             	sub    $0xc,%esp
+  801222:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801232:	89 df                	mov    %ebx,%edi
+  801234:	89 de                	mov    %ebx,%esi
+  801236:	cd 30                	int    $0x30
+  801238:	85 c0                	test   %eax,%eax
+  80123a:	7f 08                	jg     801244 <sys_env_set_trapframe+0x2b>
+  80123c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123f:	5b                   	pop    %ebx
+  801240:	5e                   	pop    %esi
+  801241:	5f                   	pop    %edi
+  801242:	5d                   	pop    %ebp
+  801243:	c3                   	ret
+  801244:	83 ec 0c             	sub    $0xc,%esp
+  801247:	50                   	push   %eax
+  801248:	6a 09                	push   $0x9
+  80124a:	68 cb 3f 80 00       	push   $0x803fcb
+  80124f:	6a 24                	push   $0x24
+  801251:	68 e8 3f 80 00       	push   $0x803fe8
+  801256:	e8 17 f2 ff ff       	call   800472 <_panic>
+
+0080125b <sys_env_set_cow>:
+  80125b:	55                   	push   %ebp
+  80125c:	89 e5                	mov    %esp,%ebp
+  80125e:	57                   	push   %edi
+  80125f:	56                   	push   %esi
+  801260:	53                   	push   %ebx
+  801261:	83 ec 0c             	sub    $0xc,%esp
+  801264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126f:	b8 20 00 00 00       	mov    $0x20,%eax
+  801274:	89 df                	mov    %ebx,%edi
+  801276:	89 de                	mov    %ebx,%esi
+  801278:	cd 30                	int    $0x30
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	7f 08                	jg     801286 <sys_env_set_cow+0x2b>
+  80127e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801281:	5b                   	pop    %ebx
+  801282:	5e                   	pop    %esi
+  801283:	5f                   	pop    %edi
+  801284:	5d                   	pop    %ebp
+  801285:	c3                   	ret
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	50                   	push   %eax
+  80128a:	6a 20                	push   $0x20
+  80128c:	68 cb 3f 80 00       	push   $0x803fcb
+  801291:	6a 24                	push   $0x24
+  801293:	68 e8 3f 80 00       	push   $0x803fe8
+  801298:	e8 d5 f1 ff ff       	call   800472 <_panic>
+
+0080129d <sys_env_service>:
+  80129d:	55                   	push   %ebp
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	57                   	push   %edi
+  8012a1:	56                   	push   %esi
+  8012a2:	53                   	push   %ebx
+  8012a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ab:	b8 21 00 00 00       	mov    $0x21,%eax
+  8012b0:	89 cb                	mov    %ecx,%ebx
+  8012b2:	89 cf                	mov    %ecx,%edi
+  8012b4:	89 ce                	mov    %ecx,%esi
+  8012b6:	cd 30                	int    $0x30
+  8012b8:	5b                   	pop    %ebx
+  8012b9:	5e                   	pop    %esi
+  8012ba:	5f                   	pop    %edi
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+
+008012bd <sys_env_set_pgfault_upcall>:
+  8012bd:	55                   	push   %ebp
+  8012be:	89 e5                	mov    %esp,%ebp
+  8012c0:	57                   	push   %edi
+  8012c1:	56                   	push   %esi
+  8012c2:	53                   	push   %ebx
+  8012c3:	83 ec 0c             	sub    $0xc,%esp
+  8012c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012d6:	89 df                	mov    %ebx,%edi
+  8012d8:	89 de                	mov    %ebx,%esi
+  8012da:	cd 30                	int    $0x30
+  8012dc:	85 c0                	test   %eax,%eax
+  8012de:	7f 08                	jg     8012e8 <sys_env_set_pgfault_upcall+0x2b>
+  8012e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e3:	5b                   	pop    %ebx
+  8012e4:	5e                   	pop    %esi
+  8012e5:	5f                   	pop    %edi
+  8012e6:	5d                   	pop    %ebp
+  8012e7:	c3                   	ret
+  8012e8:	83 ec 0c             	sub    $0xc,%esp
+  8012eb:	50                   	push   %eax
+  8012ec:	6a 0a                	push   $0xa
+  8012ee:	68 cb 3f 80 00       	push   $0x803fcb
+  8012f3:	6a 24                	push   $0x24
+  8012f5:	68 e8 3f 80 00       	push   $0x803fe8
+  8012fa:	e8 73 f1 ff ff       	call   800472 <_panic>
+
+008012ff <sys_ipc_try_send>:
+  8012ff:	55                   	push   %ebp
+  801300:	89 e5                	mov    %esp,%ebp
+  801302:	57                   	push   %edi
+  801303:	56                   	push   %esi
+  801304:	53                   	push   %ebx
+  801305:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80130c:	74 27                	je     801335 <sys_ipc_try_send+0x36>
+  80130e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801311:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801314:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801319:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80131f:	6a 00                	push   $0x0
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	8d 35 2c 13 80 00    	lea    0x80132c,%esi
+  80132a:	0f 34                	sysenter
+  80132c:	5d                   	pop    %ebp
+  80132d:	83 c4 04             	add    $0x4,%esp
+  801330:	5b                   	pop    %ebx
+  801331:	5e                   	pop    %esi
+  801332:	5f                   	pop    %edi
+  801333:	5d                   	pop    %ebp
+  801334:	c3                   	ret
+  801335:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80133a:	be 00 00 00 00       	mov    $0x0,%esi
+  80133f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801342:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801345:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801348:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80134b:	cd 30                	int    $0x30
+  80134d:	eb e1                	jmp    801330 <sys_ipc_try_send+0x31>
+
+0080134f <sys_ipc_recv>:
+  80134f:	55                   	push   %ebp
+  801350:	89 e5                	mov    %esp,%ebp
+  801352:	57                   	push   %edi
+  801353:	56                   	push   %esi
+  801354:	53                   	push   %ebx
+  801355:	83 ec 0c             	sub    $0xc,%esp
+  801358:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80135f:	74 32                	je     801393 <sys_ipc_recv+0x44>
+  801361:	8b 55 08             	mov    0x8(%ebp),%edx
+  801364:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801369:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80136e:	89 cb                	mov    %ecx,%ebx
+  801370:	89 cf                	mov    %ecx,%edi
+  801372:	6a 00                	push   $0x0
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	8d 35 7f 13 80 00    	lea    0x80137f,%esi
+  80137d:	0f 34                	sysenter
+  80137f:	5d                   	pop    %ebp
+  801380:	83 c4 04             	add    $0x4,%esp
+  801383:	89 c2                	mov    %eax,%edx
+  801385:	85 c0                	test   %eax,%eax
+  801387:	7f 3c                	jg     8013c5 <sys_ipc_recv+0x76>
+  801389:	89 d0                	mov    %edx,%eax
+  80138b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138e:	5b                   	pop    %ebx
+  80138f:	5e                   	pop    %esi
+  801390:	5f                   	pop    %edi
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+  801393:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801398:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a0:	89 cb                	mov    %ecx,%ebx
+  8013a2:	89 cf                	mov    %ecx,%edi
+  8013a4:	89 ce                	mov    %ecx,%esi
+  8013a6:	cd 30                	int    $0x30
+  8013a8:	89 c2                	mov    %eax,%edx
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	7e db                	jle    801389 <sys_ipc_recv+0x3a>
+  8013ae:	83 ec 0c             	sub    $0xc,%esp
+  8013b1:	50                   	push   %eax
+  8013b2:	6a 0d                	push   $0xd
+  8013b4:	68 cb 3f 80 00       	push   $0x803fcb
+  8013b9:	6a 24                	push   $0x24
+  8013bb:	68 e8 3f 80 00       	push   $0x803fe8
+  8013c0:	e8 ad f0 ff ff       	call   800472 <_panic>
+  8013c5:	83 ec 0c             	sub    $0xc,%esp
+  8013c8:	50                   	push   %eax
+  8013c9:	6a 0d                	push   $0xd
+  8013cb:	68 cb 3f 80 00       	push   $0x803fcb
+  8013d0:	6a 48                	push   $0x48
+  8013d2:	68 e8 3f 80 00       	push   $0x803fe8
+  8013d7:	e8 96 f0 ff ff       	call   800472 <_panic>
+
+008013dc <sys_ipc_send>:
+  8013dc:	55                   	push   %ebp
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	57                   	push   %edi
+  8013e0:	56                   	push   %esi
+  8013e1:	53                   	push   %ebx
+  8013e2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8013e9:	74 27                	je     801412 <sys_ipc_send+0x36>
+  8013eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013fc:	6a 00                	push   $0x0
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	8d 35 09 14 80 00    	lea    0x801409,%esi
+  801407:	0f 34                	sysenter
+  801409:	5d                   	pop    %ebp
+  80140a:	83 c4 04             	add    $0x4,%esp
+  80140d:	5b                   	pop    %ebx
+  80140e:	5e                   	pop    %esi
+  80140f:	5f                   	pop    %edi
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+  801412:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801417:	be 00 00 00 00       	mov    $0x0,%esi
+  80141c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801422:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801425:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801428:	cd 30                	int    $0x30
+  80142a:	eb e1                	jmp    80140d <sys_ipc_send+0x31>
+
+0080142c <sys_ipc_call>:
+  80142c:	55                   	push   %ebp
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	57                   	push   %edi
+  801430:	56                   	push   %esi
+  801431:	53                   	push   %ebx
+  801432:	8b 55 08             	mov    0x8(%ebp),%edx
+  801435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801438:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80143d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801440:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801443:	8b 75 18             	mov    0x18(%ebp),%esi
+  801446:	cd 30                	int    $0x30
+  801448:	5b                   	pop    %ebx
+  801449:	5e                   	pop    %esi
+  80144a:	5f                   	pop    %edi
+  80144b:	5d                   	pop    %ebp
+  80144c:	c3                   	ret
+
+0080144d <sys_ipc_reply_recv>:
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	57                   	push   %edi
+  801451:	56                   	push   %esi
+  801452:	53                   	push   %ebx
+  801453:	8b 55 08             	mov    0x8(%ebp),%edx
+  801456:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801459:	b8 10 00 00 00       	mov    $0x10,%eax
+  80145e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801461:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801464:	8b 75 18             	mov    0x18(%ebp),%esi
+  801467:	cd 30                	int    $0x30
+  801469:	5b                   	pop    %ebx
+  80146a:	5e                   	pop    %esi
+  80146b:	5f                   	pop    %edi
+  80146c:	5d                   	pop    %ebp
+  80146d:	c3                   	ret
+
+0080146e <sys_time_msec>:
+  80146e:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801473:	85 c0                	test   %eax,%eax
+  801475:	75 06                	jne    80147d <sys_time_msec+0xf>
+  801477:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80147c:	c3                   	ret
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+  801483:	83 ec 0c             	sub    $0xc,%esp
+  801486:	0f 31                	rdtsc
+  801488:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  80148e:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801494:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80149a:	29 c8                	sub    %ecx,%eax
+  80149c:	19 da                	sbb    %ebx,%edx
+  80149e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a3:	57                   	push   %edi
+  8014a4:	56                   	push   %esi
+  8014a5:	52                   	push   %edx
+  8014a6:	50                   	push   %eax
+  8014a7:	e8 81 25 00 00       	call   803a2d <__udivdi3>
+  8014ac:	83 c4 10             	add    $0x10,%esp
+  8014af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b2:	5b                   	pop    %ebx
+  8014b3:	5e                   	pop    %esi
+  8014b4:	5f                   	pop    %edi
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	c3                   	ret
+
+008014b7 <sys_env_swap>:
+  8014b7:	55                   	push   %ebp
+  8014b8:	89 e5                	mov    %esp,%ebp
+  8014ba:	57                   	push   %edi
+  8014bb:	56                   	push   %esi
+  8014bc:	53                   	push   %ebx
+  8014bd:	83 ec 0c             	sub    $0xc,%esp
+  8014c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c8:	b8 12 00 00 00       	mov    $0x12,%eax
+  8014cd:	89 cb                	mov    %ecx,%ebx
+  8014cf:	89 cf                	mov    %ecx,%edi
+  8014d1:	89 ce                	mov    %ecx,%esi
+  8014d3:	cd 30                	int    $0x30
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	7f 08                	jg     8014e1 <sys_env_swap+0x2a>
+  8014d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5f                   	pop    %edi
+  8014df:	5d                   	pop    %ebp
+  8014e0:	c3                   	ret
+  8014e1:	83 ec 0c             	sub    $0xc,%esp
+  8014e4:	50                   	push   %eax
+  8014e5:	6a 12                	push   $0x12
+  8014e7:	68 cb 3f 80 00       	push   $0x803fcb
+  8014ec:	6a 24                	push   $0x24
+  8014ee:	68 e8 3f 80 00       	push   $0x803fe8
+  8014f3:	e8 7a ef ff ff       	call   800472 <_panic>
+
+008014f8 <sys_net_try_send>:
+  8014f8:	55                   	push   %ebp
+  8014f9:	89 e5                	mov    %esp,%ebp
+  8014fb:	57                   	push   %edi
+  8014fc:	56                   	push   %esi
+  8014fd:	53                   	push   %ebx
+  8014fe:	83 ec 0c             	sub    $0xc,%esp
+  801501:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801506:	8b 55 08             	mov    0x8(%ebp),%edx
+  801509:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801511:	89 df                	mov    %ebx,%edi
+  801513:	89 de                	mov    %ebx,%esi
+  801515:	cd 30                	int    $0x30
+  801517:	85 c0                	test   %eax,%eax
+  801519:	7f 08                	jg     801523 <sys_net_try_send+0x2b>
+  80151b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80151e:	5b                   	pop    %ebx
+  80151f:	5e                   	pop    %esi
+  801520:	5f                   	pop    %edi
+  801521:	5d                   	pop    %ebp
+  801522:	c3                   	ret
+  801523:	83 ec 0c             	sub    $0xc,%esp
+  801526:	50                   	push   %eax
+  801527:	6a 13                	push   $0x13
+  801529:	68 cb 3f 80 00       	push   $0x803fcb
+  80152e:	6a 24                	push   $0x24
+  801530:	68 e8 3f 80 00       	push   $0x803fe8
+  801535:	e8 38 ef ff ff       	call   800472 <_panic>
+
+0080153a <sys_net_try_receive>:
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	57                   	push   %edi
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  801540:	83 ec 0c             	sub    $0xc,%esp
+  801543:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801548:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801553:	89 df                	mov    %ebx,%edi
+  801555:	89 de                	mov    %ebx,%esi
+  801557:	cd 30                	int    $0x30
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	7f 08                	jg     801565 <sys_net_try_receive+0x2b>
+  80155d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5f                   	pop    %edi
+  801563:	5d                   	pop    %ebp
+  801564:	c3                   	ret
+  801565:	83 ec 0c             	sub    $0xc,%esp
+  801568:	50                   	push   %eax
+  801569:	6a 14                	push   $0x14
+  80156b:	68 cb 3f 80 00       	push   $0x803fcb
+  801570:	6a 24                	push   $0x24
+  801572:	68 e8 3f 80 00       	push   $0x803fe8
+  801577:	e8 f6 ee ff ff       	call   800472 <_panic>
+
+0080157c <sys_net_recv_page>:
+  80157c:	55                   	push   %ebp
+  80157d:	89 e5                	mov    %esp,%ebp
+  80157f:	57                   	push   %edi
+  801580:	56                   	push   %esi
+  801581:	53                   	push   %ebx
+  801582:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801587:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158a:	b8 27 00 00 00       	mov    $0x27,%eax
+  80158f:	89 cb                	mov    %ecx,%ebx
+  801591:	89 cf                	mov    %ecx,%edi
+  801593:	89 ce                	mov    %ecx,%esi
+  801595:	cd 30                	int    $0x30
+  801597:	5b                   	pop    %ebx
+  801598:	5e                   	pop    %esi
+  801599:	5f                   	pop    %edi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+
+0080159c <sys_net_wait>:
+  80159c:	55                   	push   %ebp
+  80159d:	89 e5                	mov    %esp,%ebp
+  80159f:	57                   	push   %edi
+  8015a0:	56                   	push   %esi
+  8015a1:	53                   	push   %ebx
+  8015a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a7:	b8 26 00 00 00       	mov    $0x26,%eax
+  8015ac:	89 d1                	mov    %edx,%ecx
+  8015ae:	89 d3                	mov    %edx,%ebx
+  8015b0:	89 d7                	mov    %edx,%edi
+  8015b2:	89 d6                	mov    %edx,%esi
+  8015b4:	cd 30                	int    $0x30
+  8015b6:	5b                   	pop    %ebx
+  8015b7:	5e                   	pop    %esi
+  8015b8:	5f                   	pop    %edi
+  8015b9:	5d                   	pop    %ebp
+  8015ba:	c3                   	ret
+
+008015bb <sys_get_mac>:
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	57                   	push   %edi
+  8015bf:	56                   	push   %esi
+  8015c0:	53                   	push   %ebx
+  8015c1:	83 ec 0c             	sub    $0xc,%esp
+  8015c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015cf:	b8 15 00 00 00       	mov    $0x15,%eax
+  8015d4:	89 df                	mov    %ebx,%edi
+  8015d6:	89 de                	mov    %ebx,%esi
+  8015d8:	cd 30                	int    $0x30
+  8015da:	85 c0                	test   %eax,%eax
+  8015dc:	7f 08                	jg     8015e6 <sys_get_mac+0x2b>
+  8015de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e1:	5b                   	pop    %ebx
+  8015e2:	5e                   	pop    %esi
+  8015e3:	5f                   	pop    %edi
+  8015e4:	5d                   	pop    %ebp
+  8015e5:	c3                   	ret
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	50                   	push   %eax
+  8015ea:	6a 15                	push   $0x15
+  8015ec:	68 cb 3f 80 00       	push   $0x803fcb
+  8015f1:	6a 24                	push   $0x24
+  8015f3:	68 e8 3f 80 00       	push   $0x803fe8
+  8015f8:	e8 75 ee ff ff       	call   800472 <_panic>
+
+008015fd <sys_env_lease>:
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	57                   	push   %edi
+  801601:	56                   	push   %esi
+  801602:	53                   	push   %ebx
+  801603:	83 ec 0c             	sub    $0xc,%esp
+  801606:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801611:	b8 16 00 00 00       	mov    $0x16,%eax
+  801616:	89 df                	mov    %ebx,%edi
+  801618:	89 de                	mov    %ebx,%esi
+  80161a:	cd 30                	int    $0x30
+  80161c:	85 c0                	test   %eax,%eax
+  80161e:	7f 08                	jg     801628 <sys_env_lease+0x2b>
+  801620:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801623:	5b                   	pop    %ebx
+  801624:	5e                   	pop    %esi
+  801625:	5f                   	pop    %edi
+  801626:	5d                   	pop    %ebp
+  801627:	c3                   	ret
+  801628:	83 ec 0c             	sub    $0xc,%esp
+  80162b:	50                   	push   %eax
+  80162c:	6a 16                	push   $0x16
+  80162e:	68 cb 3f 80 00       	push   $0x803fcb
+  801633:	6a 24                	push   $0x24
+  801635:	68 e8 3f 80 00       	push   $0x803fe8
+  80163a:	e8 33 ee ff ff       	call   800472 <_panic>
+
+0080163f <sys_copy_mem>:
+  80163f:	55                   	push   %ebp
+  801640:	89 e5                	mov    %esp,%ebp
+  801642:	57                   	push   %edi
+  801643:	56                   	push   %esi
+  801644:	53                   	push   %ebx
+  801645:	83 ec 0c             	sub    $0xc,%esp
+  801648:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801653:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801656:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801659:	8b 75 18             	mov    0x18(%ebp),%esi
+  80165c:	cd 30                	int    $0x30
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	7f 08                	jg     80166a <sys_copy_mem+0x2b>
+  801662:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801665:	5b                   	pop    %ebx
+  801666:	5e                   	pop    %esi
+  801667:	5f                   	pop    %edi
+  801668:	5d                   	pop    %ebp
+  801669:	c3                   	ret
+  80166a:	83 ec 0c             	sub    $0xc,%esp
+  80166d:	50                   	push   %eax
+  80166e:	6a 17                	push   $0x17
+  801670:	68 cb 3f 80 00       	push   $0x803fcb
+  801675:	6a 24                	push   $0x24
+  801677:	68 e8 3f 80 00       	push   $0x803fe8
+  80167c:	e8 f1 ed ff ff       	call   800472 <_panic>
+
+00801681 <sys_get_perms>:
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	57                   	push   %edi
+  801685:	56                   	push   %esi
+  801686:	53                   	push   %ebx
+  801687:	83 ec 0c             	sub    $0xc,%esp
+  80168a:	be 00 00 00 00       	mov    $0x0,%esi
+  80168f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801692:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801695:	b8 18 00 00 00       	mov    $0x18,%eax
+  80169a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80169d:	89 f7                	mov    %esi,%edi
+  80169f:	cd 30                	int    $0x30
+  8016a1:	85 c0                	test   %eax,%eax
+  8016a3:	7f 08                	jg     8016ad <sys_get_perms+0x2c>
+  8016a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a8:	5b                   	pop    %ebx
+  8016a9:	5e                   	pop    %esi
+  8016aa:	5f                   	pop    %edi
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+  8016ad:	83 ec 0c             	sub    $0xc,%esp
+  8016b0:	50                   	push   %eax
+  8016b1:	6a 18                	push   $0x18
+  8016b3:	68 cb 3f 80 00       	push   $0x803fcb
+  8016b8:	6a 24                	push   $0x24
+  8016ba:	68 e8 3f 80 00       	push   $0x803fe8
+  8016bf:	e8 ae ed ff ff       	call   800472 <_panic>
+
+008016c4 <sys_env_unsuspend>:
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	57                   	push   %edi
+  8016c8:	56                   	push   %esi
+  8016c9:	53                   	push   %ebx
+  8016ca:	83 ec 0c             	sub    $0xc,%esp
+  8016cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d8:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e0:	89 f7                	mov    %esi,%edi
+  8016e2:	cd 30                	int    $0x30
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	7f 08                	jg     8016f0 <sys_env_unsuspend+0x2c>
+  8016e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016eb:	5b                   	pop    %ebx
+  8016ec:	5e                   	pop    %esi
+  8016ed:	5f                   	pop    %edi
+  8016ee:	5d                   	pop    %ebp
+  8016ef:	c3                   	ret
+  8016f0:	83 ec 0c             	sub    $0xc,%esp
+  8016f3:	50                   	push   %eax
+  8016f4:	6a 19                	push   $0x19
+  8016f6:	68 cb 3f 80 00       	push   $0x803fcb
+  8016fb:	6a 24                	push   $0x24
+  8016fd:	68 e8 3f 80 00       	push   $0x803fe8
+  801702:	e8 6b ed ff ff       	call   800472 <_panic>
+
+00801707 <sys_migrate>:
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	57                   	push   %edi
+  80170b:	56                   	push   %esi
+  80170c:	53                   	push   %ebx
+  80170d:	83 ec 0c             	sub    $0xc,%esp
+  801710:	ba 04 30 81 00       	mov    $0x813004,%edx
+  801715:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80171b:	76 11                	jbe    80172e <sys_migrate+0x27>
+  80171d:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801722:	0f b6 08             	movzbl (%eax),%ecx
+  801725:	05 00 10 00 00       	add    $0x1000,%eax
+  80172a:	39 d0                	cmp    %edx,%eax
+  80172c:	72 f4                	jb     801722 <sys_migrate+0x1b>
+  80172e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801733:	8b 55 08             	mov    0x8(%ebp),%edx
+  801736:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80173b:	89 cb                	mov    %ecx,%ebx
+  80173d:	89 cf                	mov    %ecx,%edi
+  80173f:	89 ce                	mov    %ecx,%esi
+  801741:	cd 30                	int    $0x30
+  801743:	85 c0                	test   %eax,%eax
+  801745:	7f 08                	jg     80174f <sys_migrate+0x48>
+  801747:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174a:	5b                   	pop    %ebx
+  80174b:	5e                   	pop    %esi
+  80174c:	5f                   	pop    %edi
+  80174d:	5d                   	pop    %ebp
+  80174e:	c3                   	ret
+  80174f:	83 ec 0c             	sub    $0xc,%esp
+  801752:	50                   	push   %eax
+  801753:	6a 1a                	push   $0x1a
+  801755:	68 cb 3f 80 00       	push   $0x803fcb
+  80175a:	6a 24                	push   $0x24
+  80175c:	68 e8 3f 80 00       	push   $0x803fe8
+  801761:	e8 0c ed ff ff       	call   800472 <_panic>
+
+00801766 <sys_lease_complete>:
+  801766:	55                   	push   %ebp
+  801767:	89 e5                	mov    %esp,%ebp
+  801769:	57                   	push   %edi
+  80176a:	56                   	push   %esi
+  80176b:	53                   	push   %ebx
+  80176c:	83 ec 0c             	sub    $0xc,%esp
+  80176f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801774:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801779:	89 d1                	mov    %edx,%ecx
+  80177b:	89 d3                	mov    %edx,%ebx
+  80177d:	89 d7                	mov    %edx,%edi
+  80177f:	89 d6                	mov    %edx,%esi
+  801781:	cd 30                	int    $0x30
+  801783:	85 c0                	test   %eax,%eax
+  801785:	7f 08                	jg     80178f <sys_lease_complete+0x29>
+  801787:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178a:	5b                   	pop    %ebx
+  80178b:	5e                   	pop    %esi
+  80178c:	5f                   	pop    %edi
+  80178d:	5d                   	pop    %ebp
+  80178e:	c3                   	ret
+  80178f:	83 ec 0c             	sub    $0xc,%esp
+  801792:	50                   	push   %eax
+  801793:	6a 1b                	push   $0x1b
+  801795:	68 cb 3f 80 00       	push   $0x803fcb
+  80179a:	6a 24                	push   $0x24
+  80179c:	68 e8 3f 80 00       	push   $0x803fe8
+  8017a1:	e8 cc ec ff ff       	call   800472 <_panic>
+
+008017a6 <sys_env_set_thisenv>:
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	57                   	push   %edi
+  8017aa:	56                   	push   %esi
+  8017ab:	53                   	push   %ebx
+  8017ac:	83 ec 0c             	sub    $0xc,%esp
+  8017af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ba:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8017bf:	89 df                	mov    %ebx,%edi
+  8017c1:	89 de                	mov    %ebx,%esi
+  8017c3:	cd 30                	int    $0x30
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	7f 08                	jg     8017d1 <sys_env_set_thisenv+0x2b>
+  8017c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017cc:	5b                   	pop    %ebx
+  8017cd:	5e                   	pop    %esi
+  8017ce:	5f                   	pop    %edi
+  8017cf:	5d                   	pop    %ebp
+  8017d0:	c3                   	ret
+  8017d1:	83 ec 0c             	sub    $0xc,%esp
+  8017d4:	50                   	push   %eax
+  8017d5:	6a 1c                	push   $0x1c
+  8017d7:	68 cb 3f 80 00       	push   $0x803fcb
+  8017dc:	6a 24                	push   $0x24
+  8017de:	68 e8 3f 80 00       	push   $0x803fe8
+  8017e3:	e8 8a ec ff ff       	call   800472 <_panic>
+
+008017e8 <sys_env_set_sched>:
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	57                   	push   %edi
+  8017ec:	56                   	push   %esi
+  8017ed:	53                   	push   %ebx
+  8017ee:	83 ec 0c             	sub    $0xc,%esp
+  8017f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801801:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801804:	89 f7                	mov    %esi,%edi
+  801806:	cd 30                	int    $0x30
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	7f 08                	jg     801814 <sys_env_set_sched+0x2c>
+  80180c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180f:	5b                   	pop    %ebx
+  801810:	5e                   	pop    %esi
+  801811:	5f                   	pop    %edi
+  801812:	5d                   	pop    %ebp
+  801813:	c3                   	ret
+  801814:	83 ec 0c             	sub    $0xc,%esp
+  801817:	50                   	push   %eax
+  801818:	6a 1d                	push   $0x1d
+  80181a:	68 cb 3f 80 00       	push   $0x803fcb
+  80181f:	6a 24                	push   $0x24
+  801821:	68 e8 3f 80 00       	push   $0x803fe8
+  801826:	e8 47 ec ff ff       	call   800472 <_panic>
+
+0080182b <sys_batch>:
+  80182b:	55                   	push   %ebp
+  80182c:	89 e5                	mov    %esp,%ebp
+  80182e:	57                   	push   %edi
+  80182f:	56                   	push   %esi
+  801830:	53                   	push   %ebx
+  801831:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801836:	8b 55 08             	mov    0x8(%ebp),%edx
+  801839:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80183c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801841:	89 df                	mov    %ebx,%edi
+  801843:	89 de                	mov    %ebx,%esi
+  801845:	cd 30                	int    $0x30
+  801847:	5b                   	pop    %ebx
+  801848:	5e                   	pop    %esi
+  801849:	5f                   	pop    %edi
+  80184a:	5d                   	pop    %ebp
+  80184b:	c3                   	ret
+
+0080184c <sys_env_stats>:
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+  80184f:	57                   	push   %edi
+  801850:	56                   	push   %esi
+  801851:	53                   	push   %ebx
+  801852:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801857:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185d:	b8 23 00 00 00       	mov    $0x23,%eax
+  801862:	89 df                	mov    %ebx,%edi
+  801864:	89 de                	mov    %ebx,%esi
+  801866:	cd 30                	int    $0x30
+  801868:	5b                   	pop    %ebx
+  801869:	5e                   	pop    %esi
+  80186a:	5f                   	pop    %edi
+  80186b:	5d                   	pop    %ebp
+  80186c:	c3                   	ret
+
+0080186d <sys_trace>:
+  80186d:	55                   	push   %ebp
+  80186e:	89 e5                	mov    %esp,%ebp
+  801870:	57                   	push   %edi
+  801871:	56                   	push   %esi
+  801872:	53                   	push   %ebx
+  801873:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801878:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187b:	b8 24 00 00 00       	mov    $0x24,%eax
+  801880:	89 cb                	mov    %ecx,%ebx
+  801882:	89 cf                	mov    %ecx,%edi
+  801884:	89 ce                	mov    %ecx,%esi
+  801886:	cd 30                	int    $0x30
+  801888:	5b                   	pop    %ebx
+  801889:	5e                   	pop    %esi
+  80188a:	5f                   	pop    %edi
+  80188b:	5d                   	pop    %ebp
+  80188c:	c3                   	ret
+
+0080188d <sys_env_set_pager>:
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	57                   	push   %edi
+  801891:	56                   	push   %esi
+  801892:	53                   	push   %ebx
+  801893:	83 ec 0c             	sub    $0xc,%esp
+  801896:	be 00 00 00 00       	mov    $0x0,%esi
+  80189b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a1:	b8 25 00 00 00       	mov    $0x25,%eax
+  8018a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018a9:	89 f7                	mov    %esi,%edi
+  8018ab:	cd 30                	int    $0x30
+  8018ad:	85 c0                	test   %eax,%eax
+  8018af:	7f 08                	jg     8018b9 <sys_env_set_pager+0x2c>
+  8018b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b4:	5b                   	pop    %ebx
+  8018b5:	5e                   	pop    %esi
+  8018b6:	5f                   	pop    %edi
+  8018b7:	5d                   	pop    %ebp
+  8018b8:	c3                   	ret
+  8018b9:	83 ec 0c             	sub    $0xc,%esp
+  8018bc:	50                   	push   %eax
+  8018bd:	6a 25                	push   $0x25
+  8018bf:	68 cb 3f 80 00       	push   $0x803fcb
+  8018c4:	6a 24                	push   $0x24
+  8018c6:	68 e8 3f 80 00       	push   $0x803fe8
+  8018cb:	e8 a2 eb ff ff       	call   800472 <_panic>
+
+008018d0 <sys_pager_retire>:
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	57                   	push   %edi
+  8018d4:	56                   	push   %esi
+  8018d5:	53                   	push   %ebx
+  8018d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018de:	b8 28 00 00 00       	mov    $0x28,%eax
+  8018e3:	89 cb                	mov    %ecx,%ebx
+  8018e5:	89 cf                	mov    %ecx,%edi
+  8018e7:	89 ce                	mov    %ecx,%esi
+  8018e9:	cd 30                	int    $0x30
+  8018eb:	5b                   	pop    %ebx
+  8018ec:	5e                   	pop    %esi
+  8018ed:	5f                   	pop    %edi
+  8018ee:	5d                   	pop    %ebp
+  8018ef:	c3                   	ret
+
+008018f0 <sys_prof>:
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	57                   	push   %edi
+  8018f4:	56                   	push   %esi
+  8018f5:	53                   	push   %ebx
+  8018f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801901:	b8 22 00 00 00       	mov    $0x22,%eax
+  801906:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801909:	89 f7                	mov    %esi,%edi
+  80190b:	cd 30                	int    $0x30
+  80190d:	5b                   	pop    %ebx
+  80190e:	5e                   	pop    %esi
+  80190f:	5f                   	pop    %edi
+  801910:	5d                   	pop    %ebp
+  801911:	c3                   	ret
+
+00801912 <dupq_flush>:
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	53                   	push   %ebx
+  801916:	83 ec 0c             	sub    $0xc,%esp
+  801919:	8b 1d e4 00 81 00    	mov    0x8100e4,%ebx
+  80191f:	c7 05 e4 00 81 00 00 	movl   $0x0,0x8100e4
+  801926:	00 00 00 
+  801929:	53                   	push   %ebx
+  80192a:	68 00 00 40 00       	push   $0x400000
+  80192f:	e8 f7 fe ff ff       	call   80182b <sys_batch>
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	85 c0                	test   %eax,%eax
+  801939:	78 14                	js     80194f <dupq_flush+0x3d>
+  80193b:	39 c3                	cmp    %eax,%ebx
+  80193d:	7e 0b                	jle    80194a <dupq_flush+0x38>
+  80193f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801942:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801948:	eb 05                	jmp    80194f <dupq_flush+0x3d>
+  80194a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801952:	c9                   	leave
+  801953:	c3                   	ret
+
+00801954 <pgfault>:
+  801954:	55                   	push   %ebp
+  801955:	89 e5                	mov    %esp,%ebp
+  801957:	56                   	push   %esi
+  801958:	53                   	push   %ebx
+  801959:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195c:	8b 30                	mov    (%eax),%esi
+  80195e:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801962:	0f 84 83 00 00 00    	je     8019eb <pgfault+0x97>
+  801968:	89 f0                	mov    %esi,%eax
+  80196a:	c1 e8 0c             	shr    $0xc,%eax
+  80196d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801974:	f6 c4 08             	test   $0x8,%ah
+  801977:	0f 84 80 00 00 00    	je     8019fd <pgfault+0xa9>
+  80197d:	e8 b8 f6 ff ff       	call   80103a <sys_getenvid>
+  801982:	89 c3                	mov    %eax,%ebx
+  801984:	83 ec 04             	sub    $0x4,%esp
+  801987:	6a 07                	push   $0x7
+  801989:	68 00 f0 7f 00       	push   $0x7ff000
+  80198e:	50                   	push   %eax
+  80198f:	e8 10 f7 ff ff       	call   8010a4 <sys_page_alloc>
+  801994:	83 c4 10             	add    $0x10,%esp
+  801997:	85 c0                	test   %eax,%eax
+  801999:	78 74                	js     801a0f <pgfault+0xbb>
+  80199b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8019a1:	83 ec 04             	sub    $0x4,%esp
+  8019a4:	68 00 10 00 00       	push   $0x1000
+  8019a9:	56                   	push   %esi
+  8019aa:	68 00 f0 7f 00       	push   $0x7ff000
+  8019af:	e8 40 f4 ff ff       	call   800df4 <memmove>
+  8019b4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8019bb:	56                   	push   %esi
+  8019bc:	53                   	push   %ebx
+  8019bd:	68 00 f0 7f 00       	push   $0x7ff000
+  8019c2:	53                   	push   %ebx
+  8019c3:	e8 1f f7 ff ff       	call   8010e7 <sys_page_map>
+  8019c8:	83 c4 20             	add    $0x20,%esp
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	78 54                	js     801a23 <pgfault+0xcf>
+  8019cf:	83 ec 08             	sub    $0x8,%esp
+  8019d2:	68 00 f0 7f 00       	push   $0x7ff000
+  8019d7:	53                   	push   %ebx
+  8019d8:	e8 99 f7 ff ff       	call   801176 <sys_page_unmap>
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 53                	js     801a37 <pgfault+0xe3>
+  8019e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e7:	5b                   	pop    %ebx
+  8019e8:	5e                   	pop    %esi
+  8019e9:	5d                   	pop    %ebp
+  8019ea:	c3                   	ret
+  8019eb:	56                   	push   %esi
+  8019ec:	68 f8 3f 80 00       	push   $0x803ff8
+  8019f1:	6a 19                	push   $0x19
+  8019f3:	68 d4 40 80 00       	push   $0x8040d4
+  8019f8:	e8 75 ea ff ff       	call   800472 <_panic>
+  8019fd:	56                   	push   %esi
+  8019fe:	68 2c 40 80 00       	push   $0x80402c
+  801a03:	6a 1e                	push   $0x1e
+  801a05:	68 d4 40 80 00       	push   $0x8040d4
+  801a0a:	e8 63 ea ff ff       	call   800472 <_panic>
+  801a0f:	83 ec 04             	sub    $0x4,%esp
+  801a12:	68 60 40 80 00       	push   $0x804060
+  801a17:	6a 2e                	push   $0x2e
+  801a19:	68 d4 40 80 00       	push   $0x8040d4
+  801a1e:	e8 4f ea ff ff       	call   800472 <_panic>
+  801a23:	83 ec 04             	sub    $0x4,%esp
+  801a26:	68 84 40 80 00       	push   $0x804084
+  801a2b:	6a 37                	push   $0x37
+  801a2d:	68 d4 40 80 00       	push   $0x8040d4
+  801a32:	e8 3b ea ff ff       	call   800472 <_panic>
+  801a37:	83 ec 04             	sub    $0x4,%esp
+  801a3a:	68 b0 40 80 00       	push   $0x8040b0
+  801a3f:	6a 3c                	push   $0x3c
+  801a41:	68 d4 40 80 00       	push   $0x8040d4
+  801a46:	e8 27 ea ff ff       	call   800472 <_panic>
+
+00801a4b <dupq_begin>:
+  801a4b:	55                   	push   %ebp
+  801a4c:	89 e5                	mov    %esp,%ebp
+  801a4e:	83 ec 0c             	sub    $0xc,%esp
+  801a51:	c7 05 e4 00 81 00 00 	movl   $0x0,0x8100e4
+  801a58:	00 00 00 
+  801a5b:	6a 07                	push   $0x7
+  801a5d:	68 00 00 40 00       	push   $0x400000
+  801a62:	6a 00                	push   $0x0
+  801a64:	e8 3b f6 ff ff       	call   8010a4 <sys_page_alloc>
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+00801a6b <dupq_map>:
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  801a71:	81 3d e4 00 81 00 92 	cmpl   $0x92,0x8100e4
+  801a78:	00 00 00 
+  801a7b:	74 46                	je     801ac3 <dupq_map+0x58>
+  801a7d:	8b 15 e4 00 81 00    	mov    0x8100e4,%edx
+  801a83:	8d 42 01             	lea    0x1(%edx),%eax
+  801a86:	a3 e4 00 81 00       	mov    %eax,0x8100e4
+  801a8b:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801a8e:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801a94:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801a9b:	00 00 00 
+  801a9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa1:	89 50 04             	mov    %edx,0x4(%eax)
+  801aa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aa7:	c1 e2 0c             	shl    $0xc,%edx
+  801aaa:	89 50 08             	mov    %edx,0x8(%eax)
+  801aad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801ab0:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801ab3:	89 50 10             	mov    %edx,0x10(%eax)
+  801ab6:	8b 55 14             	mov    0x14(%ebp),%edx
+  801ab9:	89 50 14             	mov    %edx,0x14(%eax)
+  801abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac1:	c9                   	leave
+  801ac2:	c3                   	ret
+  801ac3:	e8 4a fe ff ff       	call   801912 <dupq_flush>
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	79 b1                	jns    801a7d <dupq_map+0x12>
+  801acc:	eb f3                	jmp    801ac1 <dupq_map+0x56>
+
+00801ace <dupq_end>:
+  801ace:	55                   	push   %ebp
+  801acf:	89 e5                	mov    %esp,%ebp
+  801ad1:	53                   	push   %ebx
+  801ad2:	83 ec 04             	sub    $0x4,%esp
+  801ad5:	e8 38 fe ff ff       	call   801912 <dupq_flush>
+  801ada:	89 c3                	mov    %eax,%ebx
+  801adc:	83 ec 08             	sub    $0x8,%esp
+  801adf:	68 00 00 40 00       	push   $0x400000
+  801ae4:	6a 00                	push   $0x0
+  801ae6:	e8 8b f6 ff ff       	call   801176 <sys_page_unmap>
+  801aeb:	89 d8                	mov    %ebx,%eax
+  801aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af0:	c9                   	leave
+  801af1:	c3                   	ret
+
+00801af2 <fork>:
+  801af2:	55                   	push   %ebp
+  801af3:	89 e5                	mov    %esp,%ebp
+  801af5:	53                   	push   %ebx
+  801af6:	83 ec 10             	sub    $0x10,%esp
+  801af9:	68 54 19 80 00       	push   $0x801954
+  801afe:	e8 01 1b 00 00       	call   803604 <set_pgfault_handler>
+  801b03:	83 c4 08             	add    $0x8,%esp
+  801b06:	6a 01                	push   $0x1
+  801b08:	6a 00                	push   $0x0
+  801b0a:	e8 4c f7 ff ff       	call   80125b <sys_env_set_cow>
+  801b0f:	e8 a4 f6 ff ff       	call   8011b8 <sys_fork>
+  801b14:	89 c3                	mov    %eax,%ebx
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	74 07                	je     801b24 <fork+0x32>
+  801b1d:	89 d8                	mov    %ebx,%eax
+  801b1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b22:	c9                   	leave
+  801b23:	c3                   	ret
+  801b24:	e8 11 f5 ff ff       	call   80103a <sys_getenvid>
+  801b29:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b2e:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801b34:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b39:	a3 f8 00 81 00       	mov    %eax,0x8100f8
+  801b3e:	eb dd                	jmp    801b1d <fork+0x2b>
+
+00801b40 <sfork>:
+  801b40:	55                   	push   %ebp
+  801b41:	89 e5                	mov    %esp,%ebp
+  801b43:	57                   	push   %edi
+  801b44:	56                   	push   %esi
+  801b45:	53                   	push   %ebx
+  801b46:	83 ec 1c             	sub    $0x1c,%esp
+  801b49:	e8 ec f4 ff ff       	call   80103a <sys_getenvid>
+  801b4e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801b51:	83 ec 0c             	sub    $0xc,%esp
+  801b54:	68 54 19 80 00       	push   $0x801954
+  801b59:	e8 a6 1a 00 00       	call   803604 <set_pgfault_handler>
+  801b5e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b63:	cd 30                	int    $0x30
+  801b65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b68:	83 c4 10             	add    $0x10,%esp
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	0f 88 45 02 00 00    	js     801db8 <sfork+0x278>
+  801b73:	89 c6                	mov    %eax,%esi
+  801b75:	74 17                	je     801b8e <sfork+0x4e>
+  801b77:	e8 cf fe ff ff       	call   801a4b <dupq_begin>
+  801b7c:	85 c0                	test   %eax,%eax
+  801b7e:	0f 88 40 02 00 00    	js     801dc4 <sfork+0x284>
+  801b84:	bf 02 00 00 00       	mov    $0x2,%edi
+  801b89:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801b8c:	eb 39                	jmp    801bc7 <sfork+0x87>
+  801b8e:	e8 a7 f4 ff ff       	call   80103a <sys_getenvid>
+  801b93:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b98:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801b9e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ba3:	a3 f8 00 81 00       	mov    %eax,0x8100f8
+  801ba8:	e9 23 01 00 00       	jmp    801cd0 <sfork+0x190>
+  801bad:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801bb4:	a8 01                	test   $0x1,%al
+  801bb6:	75 5b                	jne    801c13 <sfork+0xd3>
+  801bb8:	83 c7 01             	add    $0x1,%edi
+  801bbb:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801bc1:	0f 84 40 01 00 00    	je     801d07 <sfork+0x1c7>
+  801bc7:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801bce:	a8 01                	test   $0x1,%al
+  801bd0:	74 db                	je     801bad <sfork+0x6d>
+  801bd2:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801bd9:	a8 80                	test   $0x80,%al
+  801bdb:	74 d0                	je     801bad <sfork+0x6d>
+  801bdd:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801be4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801be9:	0c 80                	or     $0x80,%al
+  801beb:	50                   	push   %eax
+  801bec:	ff 75 e4             	push   -0x1c(%ebp)
+  801bef:	89 f8                	mov    %edi,%eax
+  801bf1:	c1 e0 16             	shl    $0x16,%eax
+  801bf4:	c1 e8 0c             	shr    $0xc,%eax
+  801bf7:	50                   	push   %eax
+  801bf8:	ff 75 e0             	push   -0x20(%ebp)
+  801bfb:	e8 6b fe ff ff       	call   801a6b <dupq_map>
+  801c00:	83 c4 10             	add    $0x10,%esp
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	79 b1                	jns    801bb8 <sfork+0x78>
+  801c07:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c0e:	e9 bd 00 00 00       	jmp    801cd0 <sfork+0x190>
+  801c13:	89 fe                	mov    %edi,%esi
+  801c15:	c1 e6 16             	shl    $0x16,%esi
+  801c18:	89 f0                	mov    %esi,%eax
+  801c1a:	c1 e8 0c             	shr    $0xc,%eax
+  801c1d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801c22:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801c25:	eb 57                	jmp    801c7e <sfork+0x13e>
+  801c27:	e8 0e f4 ff ff       	call   80103a <sys_getenvid>
+  801c2c:	89 c7                	mov    %eax,%edi
+  801c2e:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801c33:	f6 c4 04             	test   $0x4,%ah
+  801c36:	0f 85 9f 00 00 00    	jne    801cdb <sfork+0x19b>
+  801c3c:	a9 02 08 00 00       	test   $0x802,%eax
+  801c41:	0f 85 c5 01 00 00    	jne    801e0c <sfork+0x2cc>
+  801c47:	6a 05                	push   $0x5
+  801c49:	ff 75 e4             	push   -0x1c(%ebp)
+  801c4c:	68 fd e7 0e 00       	push   $0xee7fd
+  801c51:	57                   	push   %edi
+  801c52:	e8 14 fe ff ff       	call   801a6b <dupq_map>
+  801c57:	83 c4 10             	add    $0x10,%esp
+  801c5a:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801c60:	0f 84 91 00 00 00    	je     801cf7 <sfork+0x1b7>
+  801c66:	89 f0                	mov    %esi,%eax
+  801c68:	09 d8                	or     %ebx,%eax
+  801c6a:	c1 e8 0c             	shr    $0xc,%eax
+  801c6d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c73:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801c78:	0f 84 81 00 00 00    	je     801cff <sfork+0x1bf>
+  801c7e:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801c83:	74 a2                	je     801c27 <sfork+0xe7>
+  801c85:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c8c:	f6 c2 01             	test   $0x1,%dl
+  801c8f:	74 c9                	je     801c5a <sfork+0x11a>
+  801c91:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c98:	f6 c6 02             	test   $0x2,%dh
+  801c9b:	75 bd                	jne    801c5a <sfork+0x11a>
+  801c9d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801ca4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cab:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801cb1:	f7 d2                	not    %edx
+  801cb3:	21 ca                	and    %ecx,%edx
+  801cb5:	52                   	push   %edx
+  801cb6:	ff 75 e4             	push   -0x1c(%ebp)
+  801cb9:	50                   	push   %eax
+  801cba:	ff 75 e0             	push   -0x20(%ebp)
+  801cbd:	e8 a9 fd ff ff       	call   801a6b <dupq_map>
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	79 91                	jns    801c5a <sfork+0x11a>
+  801cc9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801cd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd6:	5b                   	pop    %ebx
+  801cd7:	5e                   	pop    %esi
+  801cd8:	5f                   	pop    %edi
+  801cd9:	5d                   	pop    %ebp
+  801cda:	c3                   	ret
+  801cdb:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ce0:	50                   	push   %eax
+  801ce1:	ff 75 e4             	push   -0x1c(%ebp)
+  801ce4:	68 fd e7 0e 00       	push   $0xee7fd
+  801ce9:	57                   	push   %edi
+  801cea:	e8 7c fd ff ff       	call   801a6b <dupq_map>
+  801cef:	83 c4 10             	add    $0x10,%esp
+  801cf2:	e9 63 ff ff ff       	jmp    801c5a <sfork+0x11a>
+  801cf7:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801cfa:	e9 b9 fe ff ff       	jmp    801bb8 <sfork+0x78>
+  801cff:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801d02:	e9 b1 fe ff ff       	jmp    801bb8 <sfork+0x78>
+  801d07:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801d0a:	e8 bf fd ff ff       	call   801ace <dupq_end>
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	0f 88 b9 00 00 00    	js     801dd0 <sfork+0x290>
+  801d17:	83 ec 04             	sub    $0x4,%esp
+  801d1a:	6a 07                	push   $0x7
+  801d1c:	68 00 f0 7f ee       	push   $0xee7ff000
+  801d21:	56                   	push   %esi
+  801d22:	e8 7d f3 ff ff       	call   8010a4 <sys_page_alloc>
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	0f 88 aa 00 00 00    	js     801ddc <sfork+0x29c>
+  801d32:	83 ec 0c             	sub    $0xc,%esp
+  801d35:	6a 07                	push   $0x7
+  801d37:	68 00 f0 7f 00       	push   $0x7ff000
+  801d3c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801d3f:	57                   	push   %edi
+  801d40:	68 00 f0 7f ee       	push   $0xee7ff000
+  801d45:	56                   	push   %esi
+  801d46:	e8 9c f3 ff ff       	call   8010e7 <sys_page_map>
+  801d4b:	83 c4 20             	add    $0x20,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	0f 88 92 00 00 00    	js     801de8 <sfork+0x2a8>
+  801d56:	83 ec 04             	sub    $0x4,%esp
+  801d59:	68 00 10 00 00       	push   $0x1000
+  801d5e:	68 00 f0 7f 00       	push   $0x7ff000
+  801d63:	68 00 f0 7f ee       	push   $0xee7ff000
+  801d68:	e8 87 f0 ff ff       	call   800df4 <memmove>
+  801d6d:	83 c4 08             	add    $0x8,%esp
+  801d70:	68 00 f0 7f 00       	push   $0x7ff000
+  801d75:	57                   	push   %edi
+  801d76:	e8 fb f3 ff ff       	call   801176 <sys_page_unmap>
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 72                	js     801df4 <sfork+0x2b4>
+  801d82:	83 ec 08             	sub    $0x8,%esp
+  801d85:	68 7c 36 80 00       	push   $0x80367c
+  801d8a:	56                   	push   %esi
+  801d8b:	e8 2d f5 ff ff       	call   8012bd <sys_env_set_pgfault_upcall>
+  801d90:	83 c4 10             	add    $0x10,%esp
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	78 69                	js     801e00 <sfork+0x2c0>
+  801d97:	83 ec 08             	sub    $0x8,%esp
+  801d9a:	6a 02                	push   $0x2
+  801d9c:	56                   	push   %esi
+  801d9d:	e8 35 f4 ff ff       	call   8011d7 <sys_env_set_status>
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801dac:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801db0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801db3:	e9 18 ff ff ff       	jmp    801cd0 <sfork+0x190>
+  801db8:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801dbf:	e9 0c ff ff ff       	jmp    801cd0 <sfork+0x190>
+  801dc4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801dcb:	e9 00 ff ff ff       	jmp    801cd0 <sfork+0x190>
+  801dd0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801dd7:	e9 f4 fe ff ff       	jmp    801cd0 <sfork+0x190>
+  801ddc:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801de3:	e9 e8 fe ff ff       	jmp    801cd0 <sfork+0x190>
+  801de8:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801def:	e9 dc fe ff ff       	jmp    801cd0 <sfork+0x190>
+  801df4:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801dfb:	e9 d0 fe ff ff       	jmp    801cd0 <sfork+0x190>
+  801e00:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801e07:	e9 c4 fe ff ff       	jmp    801cd0 <sfork+0x190>
+  801e0c:	68 05 08 00 00       	push   $0x805
+  801e11:	ff 75 e4             	push   -0x1c(%ebp)
+  801e14:	68 fd e7 0e 00       	push   $0xee7fd
+  801e19:	57                   	push   %edi
+  801e1a:	e8 4c fc ff ff       	call   801a6b <dupq_map>
+  801e1f:	83 c4 10             	add    $0x10,%esp
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	0f 88 30 fe ff ff    	js     801c5a <sfork+0x11a>
+  801e2a:	68 05 08 00 00       	push   $0x805
+  801e2f:	57                   	push   %edi
+  801e30:	68 fd e7 0e 00       	push   $0xee7fd
+  801e35:	57                   	push   %edi
+  801e36:	e8 30 fc ff ff       	call   801a6b <dupq_map>
+  801e3b:	83 c4 10             	add    $0x10,%esp
+  801e3e:	e9 17 fe ff ff       	jmp    801c5a <sfork+0x11a>
+
+00801e43 <fd2num>:
+  801e43:	55                   	push   %ebp
+  801e44:	89 e5                	mov    %esp,%ebp
+  801e46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e49:	05 00 00 00 30       	add    $0x30000000,%eax
+  801e4e:	c1 e8 0c             	shr    $0xc,%eax
+  801e51:	5d                   	pop    %ebp
+  801e52:	c3                   	ret
+
+00801e53 <fd2data>:
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e59:	05 00 00 00 30       	add    $0x30000000,%eax
+  801e5e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801e63:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801e68:	5d                   	pop    %ebp
+  801e69:	c3                   	ret
+
+00801e6a <fd_alloc>:
+  801e6a:	55                   	push   %ebp
+  801e6b:	89 e5                	mov    %esp,%ebp
+  801e6d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801e72:	89 c2                	mov    %eax,%edx
+  801e74:	c1 ea 16             	shr    $0x16,%edx
+  801e77:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e7e:	f6 c2 01             	test   $0x1,%dl
+  801e81:	74 29                	je     801eac <fd_alloc+0x42>
+  801e83:	89 c2                	mov    %eax,%edx
+  801e85:	c1 ea 0c             	shr    $0xc,%edx
+  801e88:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e8f:	f6 c2 01             	test   $0x1,%dl
+  801e92:	74 18                	je     801eac <fd_alloc+0x42>
+  801e94:	05 00 10 00 00       	add    $0x1000,%eax
+  801e99:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801e9e:	75 d2                	jne    801e72 <fd_alloc+0x8>
+  801ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801eaa:	eb 05                	jmp    801eb1 <fd_alloc+0x47>
+  801eac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb4:	89 02                	mov    %eax,(%edx)
+  801eb6:	89 c8                	mov    %ecx,%eax
+  801eb8:	5d                   	pop    %ebp
+  801eb9:	c3                   	ret
+
+00801eba <fd_lookup>:
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec0:	83 f8 1f             	cmp    $0x1f,%eax
+  801ec3:	77 30                	ja     801ef5 <fd_lookup+0x3b>
+  801ec5:	c1 e0 0c             	shl    $0xc,%eax
+  801ec8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801ecd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801ed3:	f6 c2 01             	test   $0x1,%dl
+  801ed6:	74 24                	je     801efc <fd_lookup+0x42>
+  801ed8:	89 c2                	mov    %eax,%edx
+  801eda:	c1 ea 0c             	shr    $0xc,%edx
+  801edd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ee4:	f6 c2 01             	test   $0x1,%dl
+  801ee7:	74 1a                	je     801f03 <fd_lookup+0x49>
+  801ee9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eec:	89 02                	mov    %eax,(%edx)
+  801eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef3:	5d                   	pop    %ebp
+  801ef4:	c3                   	ret
+  801ef5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efa:	eb f7                	jmp    801ef3 <fd_lookup+0x39>
+  801efc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f01:	eb f0                	jmp    801ef3 <fd_lookup+0x39>
+  801f03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f08:	eb e9                	jmp    801ef3 <fd_lookup+0x39>
+
+00801f0a <dev_lookup>:
+  801f0a:	55                   	push   %ebp
+  801f0b:	89 e5                	mov    %esp,%ebp
+  801f0d:	53                   	push   %ebx
+  801f0e:	83 ec 04             	sub    $0x4,%esp
+  801f11:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f19:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801f1e:	39 13                	cmp    %edx,(%ebx)
+  801f20:	74 37                	je     801f59 <dev_lookup+0x4f>
+  801f22:	83 c0 01             	add    $0x1,%eax
+  801f25:	8b 1c 85 5c 41 80 00 	mov    0x80415c(,%eax,4),%ebx
+  801f2c:	85 db                	test   %ebx,%ebx
+  801f2e:	75 ee                	jne    801f1e <dev_lookup+0x14>
+  801f30:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  801f35:	8b 40 48             	mov    0x48(%eax),%eax
+  801f38:	83 ec 04             	sub    $0x4,%esp
+  801f3b:	52                   	push   %edx
+  801f3c:	50                   	push   %eax
+  801f3d:	68 e0 40 80 00       	push   $0x8040e0
+  801f42:	e8 06 e6 ff ff       	call   80054d <cprintf>
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f52:	89 1a                	mov    %ebx,(%edx)
+  801f54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f57:	c9                   	leave
+  801f58:	c3                   	ret
+  801f59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5e:	eb ef                	jmp    801f4f <dev_lookup+0x45>
+
+00801f60 <fd_close>:
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	57                   	push   %edi
+  801f64:	56                   	push   %esi
+  801f65:	53                   	push   %ebx
+  801f66:	83 ec 24             	sub    $0x24,%esp
+  801f69:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f6f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f72:	50                   	push   %eax
+  801f73:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801f79:	c1 e8 0c             	shr    $0xc,%eax
+  801f7c:	50                   	push   %eax
+  801f7d:	e8 38 ff ff ff       	call   801eba <fd_lookup>
+  801f82:	89 c3                	mov    %eax,%ebx
+  801f84:	83 c4 10             	add    $0x10,%esp
+  801f87:	85 c0                	test   %eax,%eax
+  801f89:	78 05                	js     801f90 <fd_close+0x30>
+  801f8b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801f8e:	74 0f                	je     801f9f <fd_close+0x3f>
+  801f90:	85 ff                	test   %edi,%edi
+  801f92:	0f 44 df             	cmove  %edi,%ebx
+  801f95:	89 d8                	mov    %ebx,%eax
+  801f97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f9a:	5b                   	pop    %ebx
+  801f9b:	5e                   	pop    %esi
+  801f9c:	5f                   	pop    %edi
+  801f9d:	5d                   	pop    %ebp
+  801f9e:	c3                   	ret
+  801f9f:	83 ec 08             	sub    $0x8,%esp
+  801fa2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801fa5:	50                   	push   %eax
+  801fa6:	ff 36                	push   (%esi)
+  801fa8:	e8 5d ff ff ff       	call   801f0a <dev_lookup>
+  801fad:	89 c3                	mov    %eax,%ebx
+  801faf:	83 c4 10             	add    $0x10,%esp
+  801fb2:	85 c0                	test   %eax,%eax
+  801fb4:	78 1a                	js     801fd0 <fd_close+0x70>
+  801fb6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fb9:	8b 40 10             	mov    0x10(%eax),%eax
+  801fbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc1:	85 c0                	test   %eax,%eax
+  801fc3:	74 0b                	je     801fd0 <fd_close+0x70>
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	56                   	push   %esi
+  801fc9:	ff d0                	call   *%eax
+  801fcb:	89 c3                	mov    %eax,%ebx
+  801fcd:	83 c4 10             	add    $0x10,%esp
+  801fd0:	83 ec 08             	sub    $0x8,%esp
+  801fd3:	56                   	push   %esi
+  801fd4:	6a 00                	push   $0x0
+  801fd6:	e8 9b f1 ff ff       	call   801176 <sys_page_unmap>
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	eb b5                	jmp    801f95 <fd_close+0x35>
+
+00801fe0 <close>:
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	83 ec 20             	sub    $0x20,%esp
+  801fe6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fe9:	50                   	push   %eax
+  801fea:	ff 75 08             	push   0x8(%ebp)
+  801fed:	e8 c8 fe ff ff       	call   801eba <fd_lookup>
+  801ff2:	83 c4 10             	add    $0x10,%esp
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	79 02                	jns    801ffb <close+0x1b>
+  801ff9:	c9                   	leave
+  801ffa:	c3                   	ret
+  801ffb:	83 ec 08             	sub    $0x8,%esp
+  801ffe:	6a 01                	push   $0x1
+  802000:	ff 75 f4             	push   -0xc(%ebp)
+  802003:	e8 58 ff ff ff       	call   801f60 <fd_close>
+  802008:	83 c4 10             	add    $0x10,%esp
+  80200b:	eb ec                	jmp    801ff9 <close+0x19>
+
+0080200d <close_all>:
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	53                   	push   %ebx
+  802011:	83 ec 04             	sub    $0x4,%esp
+  802014:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802019:	83 ec 0c             	sub    $0xc,%esp
+  80201c:	53                   	push   %ebx
+  80201d:	e8 be ff ff ff       	call   801fe0 <close>
+  802022:	83 c3 01             	add    $0x1,%ebx
+  802025:	83 c4 10             	add    $0x10,%esp
+  802028:	83 fb 20             	cmp    $0x20,%ebx
+  80202b:	75 ec                	jne    802019 <close_all+0xc>
+  80202d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802030:	c9                   	leave
+  802031:	c3                   	ret
+
+00802032 <dup>:
+  802032:	55                   	push   %ebp
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	57                   	push   %edi
+  802036:	56                   	push   %esi
+  802037:	53                   	push   %ebx
+  802038:	83 ec 34             	sub    $0x34,%esp
+  80203b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80203e:	50                   	push   %eax
+  80203f:	ff 75 08             	push   0x8(%ebp)
+  802042:	e8 73 fe ff ff       	call   801eba <fd_lookup>
+  802047:	89 c3                	mov    %eax,%ebx
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 7f                	js     8020cf <dup+0x9d>
+  802050:	83 ec 0c             	sub    $0xc,%esp
+  802053:	ff 75 0c             	push   0xc(%ebp)
+  802056:	e8 85 ff ff ff       	call   801fe0 <close>
+  80205b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80205e:	c1 e6 0c             	shl    $0xc,%esi
+  802061:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  802067:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80206a:	89 3c 24             	mov    %edi,(%esp)
+  80206d:	e8 e1 fd ff ff       	call   801e53 <fd2data>
+  802072:	89 c3                	mov    %eax,%ebx
+  802074:	89 34 24             	mov    %esi,(%esp)
+  802077:	e8 d7 fd ff ff       	call   801e53 <fd2data>
+  80207c:	83 c4 10             	add    $0x10,%esp
+  80207f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802082:	89 d8                	mov    %ebx,%eax
+  802084:	c1 e8 16             	shr    $0x16,%eax
+  802087:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80208e:	a8 01                	test   $0x1,%al
+  802090:	74 11                	je     8020a3 <dup+0x71>
+  802092:	89 d8                	mov    %ebx,%eax
+  802094:	c1 e8 0c             	shr    $0xc,%eax
+  802097:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80209e:	f6 c2 01             	test   $0x1,%dl
+  8020a1:	75 36                	jne    8020d9 <dup+0xa7>
+  8020a3:	89 f8                	mov    %edi,%eax
+  8020a5:	c1 e8 0c             	shr    $0xc,%eax
+  8020a8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8020af:	83 ec 0c             	sub    $0xc,%esp
+  8020b2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8020b7:	50                   	push   %eax
+  8020b8:	56                   	push   %esi
+  8020b9:	6a 00                	push   $0x0
+  8020bb:	57                   	push   %edi
+  8020bc:	6a 00                	push   $0x0
+  8020be:	e8 24 f0 ff ff       	call   8010e7 <sys_page_map>
+  8020c3:	89 c3                	mov    %eax,%ebx
+  8020c5:	83 c4 20             	add    $0x20,%esp
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	78 33                	js     8020ff <dup+0xcd>
+  8020cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020cf:	89 d8                	mov    %ebx,%eax
+  8020d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d4:	5b                   	pop    %ebx
+  8020d5:	5e                   	pop    %esi
+  8020d6:	5f                   	pop    %edi
+  8020d7:	5d                   	pop    %ebp
+  8020d8:	c3                   	ret
+  8020d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8020e0:	83 ec 0c             	sub    $0xc,%esp
+  8020e3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8020e8:	50                   	push   %eax
+  8020e9:	ff 75 d4             	push   -0x2c(%ebp)
+  8020ec:	6a 00                	push   $0x0
+  8020ee:	53                   	push   %ebx
+  8020ef:	6a 00                	push   $0x0
+  8020f1:	e8 f1 ef ff ff       	call   8010e7 <sys_page_map>
+  8020f6:	89 c3                	mov    %eax,%ebx
+  8020f8:	83 c4 20             	add    $0x20,%esp
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	79 a4                	jns    8020a3 <dup+0x71>
+  8020ff:	83 ec 08             	sub    $0x8,%esp
+  802102:	56                   	push   %esi
+  802103:	6a 00                	push   $0x0
+  802105:	e8 6c f0 ff ff       	call   801176 <sys_page_unmap>
+  80210a:	83 c4 08             	add    $0x8,%esp
+  80210d:	ff 75 d4             	push   -0x2c(%ebp)
+  802110:	6a 00                	push   $0x0
+  802112:	e8 5f f0 ff ff       	call   801176 <sys_page_unmap>
+  802117:	83 c4 10             	add    $0x10,%esp
+  80211a:	eb b3                	jmp    8020cf <dup+0x9d>
+
+0080211c <read>:
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	56                   	push   %esi
+  802120:	53                   	push   %ebx
+  802121:	83 ec 18             	sub    $0x18,%esp
+  802124:	8b 75 08             	mov    0x8(%ebp),%esi
+  802127:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80212a:	50                   	push   %eax
+  80212b:	56                   	push   %esi
+  80212c:	e8 89 fd ff ff       	call   801eba <fd_lookup>
+  802131:	83 c4 10             	add    $0x10,%esp
+  802134:	85 c0                	test   %eax,%eax
+  802136:	78 3c                	js     802174 <read+0x58>
+  802138:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80213b:	83 ec 08             	sub    $0x8,%esp
+  80213e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802141:	50                   	push   %eax
+  802142:	ff 33                	push   (%ebx)
+  802144:	e8 c1 fd ff ff       	call   801f0a <dev_lookup>
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	85 c0                	test   %eax,%eax
+  80214e:	78 24                	js     802174 <read+0x58>
+  802150:	8b 43 08             	mov    0x8(%ebx),%eax
+  802153:	83 e0 03             	and    $0x3,%eax
+  802156:	83 f8 01             	cmp    $0x1,%eax
+  802159:	74 20                	je     80217b <read+0x5f>
+  80215b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80215e:	8b 40 08             	mov    0x8(%eax),%eax
+  802161:	85 c0                	test   %eax,%eax
+  802163:	74 37                	je     80219c <read+0x80>
+  802165:	83 ec 04             	sub    $0x4,%esp
+  802168:	ff 75 10             	push   0x10(%ebp)
+  80216b:	ff 75 0c             	push   0xc(%ebp)
+  80216e:	53                   	push   %ebx
+  80216f:	ff d0                	call   *%eax
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802177:	5b                   	pop    %ebx
+  802178:	5e                   	pop    %esi
+  802179:	5d                   	pop    %ebp
+  80217a:	c3                   	ret
+  80217b:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  802180:	8b 40 48             	mov    0x48(%eax),%eax
+  802183:	83 ec 04             	sub    $0x4,%esp
+  802186:	56                   	push   %esi
+  802187:	50                   	push   %eax
+  802188:	68 21 41 80 00       	push   $0x804121
+  80218d:	e8 bb e3 ff ff       	call   80054d <cprintf>
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80219a:	eb d8                	jmp    802174 <read+0x58>
+  80219c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021a1:	eb d1                	jmp    802174 <read+0x58>
+
+008021a3 <readn>:
+  8021a3:	55                   	push   %ebp
+  8021a4:	89 e5                	mov    %esp,%ebp
+  8021a6:	57                   	push   %edi
+  8021a7:	56                   	push   %esi
+  8021a8:	53                   	push   %ebx
+  8021a9:	83 ec 0c             	sub    $0xc,%esp
+  8021ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021af:	8b 75 10             	mov    0x10(%ebp),%esi
+  8021b2:	85 f6                	test   %esi,%esi
+  8021b4:	74 30                	je     8021e6 <readn+0x43>
+  8021b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c0:	83 ec 04             	sub    $0x4,%esp
+  8021c3:	89 f2                	mov    %esi,%edx
+  8021c5:	29 c2                	sub    %eax,%edx
+  8021c7:	52                   	push   %edx
+  8021c8:	01 f8                	add    %edi,%eax
+  8021ca:	50                   	push   %eax
+  8021cb:	ff 75 08             	push   0x8(%ebp)
+  8021ce:	e8 49 ff ff ff       	call   80211c <read>
+  8021d3:	83 c4 10             	add    $0x10,%esp
+  8021d6:	85 c0                	test   %eax,%eax
+  8021d8:	78 15                	js     8021ef <readn+0x4c>
+  8021da:	74 11                	je     8021ed <readn+0x4a>
+  8021dc:	01 c3                	add    %eax,%ebx
+  8021de:	89 d8                	mov    %ebx,%eax
+  8021e0:	39 f3                	cmp    %esi,%ebx
+  8021e2:	72 dc                	jb     8021c0 <readn+0x1d>
+  8021e4:	eb 09                	jmp    8021ef <readn+0x4c>
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021eb:	eb 02                	jmp    8021ef <readn+0x4c>
+  8021ed:	89 d8                	mov    %ebx,%eax
+  8021ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f2:	5b                   	pop    %ebx
+  8021f3:	5e                   	pop    %esi
+  8021f4:	5f                   	pop    %edi
+  8021f5:	5d                   	pop    %ebp
+  8021f6:	c3                   	ret
+
+008021f7 <write>:
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	56                   	push   %esi
+  8021fb:	53                   	push   %ebx
+  8021fc:	83 ec 18             	sub    $0x18,%esp
+  8021ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802202:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802205:	50                   	push   %eax
+  802206:	53                   	push   %ebx
+  802207:	e8 ae fc ff ff       	call   801eba <fd_lookup>
+  80220c:	83 c4 10             	add    $0x10,%esp
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	78 37                	js     80224a <write+0x53>
+  802213:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802216:	83 ec 08             	sub    $0x8,%esp
+  802219:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80221c:	50                   	push   %eax
+  80221d:	ff 36                	push   (%esi)
+  80221f:	e8 e6 fc ff ff       	call   801f0a <dev_lookup>
+  802224:	83 c4 10             	add    $0x10,%esp
+  802227:	85 c0                	test   %eax,%eax
+  802229:	78 1f                	js     80224a <write+0x53>
+  80222b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80222f:	74 20                	je     802251 <write+0x5a>
+  802231:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802234:	8b 40 0c             	mov    0xc(%eax),%eax
+  802237:	85 c0                	test   %eax,%eax
+  802239:	74 37                	je     802272 <write+0x7b>
+  80223b:	83 ec 04             	sub    $0x4,%esp
+  80223e:	ff 75 10             	push   0x10(%ebp)
+  802241:	ff 75 0c             	push   0xc(%ebp)
+  802244:	56                   	push   %esi
+  802245:	ff d0                	call   *%eax
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224d:	5b                   	pop    %ebx
+  80224e:	5e                   	pop    %esi
+  80224f:	5d                   	pop    %ebp
+  802250:	c3                   	ret
+  802251:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  802256:	8b 40 48             	mov    0x48(%eax),%eax
+  802259:	83 ec 04             	sub    $0x4,%esp
+  80225c:	53                   	push   %ebx
+  80225d:	50                   	push   %eax
+  80225e:	68 3d 41 80 00       	push   $0x80413d
+  802263:	e8 e5 e2 ff ff       	call   80054d <cprintf>
+  802268:	83 c4 10             	add    $0x10,%esp
+  80226b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802270:	eb d8                	jmp    80224a <write+0x53>
+  802272:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802277:	eb d1                	jmp    80224a <write+0x53>
+
+00802279 <seek>:
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	83 ec 20             	sub    $0x20,%esp
+  80227f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802282:	50                   	push   %eax
+  802283:	ff 75 08             	push   0x8(%ebp)
+  802286:	e8 2f fc ff ff       	call   801eba <fd_lookup>
+  80228b:	83 c4 10             	add    $0x10,%esp
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	78 0e                	js     8022a0 <seek+0x27>
+  802292:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802295:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802298:	89 50 04             	mov    %edx,0x4(%eax)
+  80229b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a0:	c9                   	leave
+  8022a1:	c3                   	ret
+
+008022a2 <ftruncate>:
+  8022a2:	55                   	push   %ebp
+  8022a3:	89 e5                	mov    %esp,%ebp
+  8022a5:	56                   	push   %esi
+  8022a6:	53                   	push   %ebx
+  8022a7:	83 ec 18             	sub    $0x18,%esp
+  8022aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022ad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022b0:	50                   	push   %eax
+  8022b1:	53                   	push   %ebx
+  8022b2:	e8 03 fc ff ff       	call   801eba <fd_lookup>
+  8022b7:	83 c4 10             	add    $0x10,%esp
+  8022ba:	85 c0                	test   %eax,%eax
+  8022bc:	78 34                	js     8022f2 <ftruncate+0x50>
+  8022be:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022c1:	83 ec 08             	sub    $0x8,%esp
+  8022c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c7:	50                   	push   %eax
+  8022c8:	ff 36                	push   (%esi)
+  8022ca:	e8 3b fc ff ff       	call   801f0a <dev_lookup>
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	78 1c                	js     8022f2 <ftruncate+0x50>
+  8022d6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8022da:	74 1d                	je     8022f9 <ftruncate+0x57>
+  8022dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022df:	8b 40 18             	mov    0x18(%eax),%eax
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	74 34                	je     80231a <ftruncate+0x78>
+  8022e6:	83 ec 08             	sub    $0x8,%esp
+  8022e9:	ff 75 0c             	push   0xc(%ebp)
+  8022ec:	56                   	push   %esi
+  8022ed:	ff d0                	call   *%eax
+  8022ef:	83 c4 10             	add    $0x10,%esp
+  8022f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f5:	5b                   	pop    %ebx
+  8022f6:	5e                   	pop    %esi
+  8022f7:	5d                   	pop    %ebp
+  8022f8:	c3                   	ret
+  8022f9:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  8022fe:	8b 40 48             	mov    0x48(%eax),%eax
+  802301:	83 ec 04             	sub    $0x4,%esp
+  802304:	53                   	push   %ebx
+  802305:	50                   	push   %eax
+  802306:	68 00 41 80 00       	push   $0x804100
+  80230b:	e8 3d e2 ff ff       	call   80054d <cprintf>
+  802310:	83 c4 10             	add    $0x10,%esp
+  802313:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802318:	eb d8                	jmp    8022f2 <ftruncate+0x50>
+  80231a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80231f:	eb d1                	jmp    8022f2 <ftruncate+0x50>
+
+00802321 <fstat>:
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	56                   	push   %esi
+  802325:	53                   	push   %ebx
+  802326:	83 ec 18             	sub    $0x18,%esp
+  802329:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80232c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80232f:	50                   	push   %eax
+  802330:	ff 75 08             	push   0x8(%ebp)
+  802333:	e8 82 fb ff ff       	call   801eba <fd_lookup>
+  802338:	83 c4 10             	add    $0x10,%esp
+  80233b:	85 c0                	test   %eax,%eax
+  80233d:	78 49                	js     802388 <fstat+0x67>
+  80233f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802342:	83 ec 08             	sub    $0x8,%esp
+  802345:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802348:	50                   	push   %eax
+  802349:	ff 36                	push   (%esi)
+  80234b:	e8 ba fb ff ff       	call   801f0a <dev_lookup>
+  802350:	83 c4 10             	add    $0x10,%esp
+  802353:	85 c0                	test   %eax,%eax
+  802355:	78 31                	js     802388 <fstat+0x67>
+  802357:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80235a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80235e:	74 2f                	je     80238f <fstat+0x6e>
+  802360:	c6 03 00             	movb   $0x0,(%ebx)
+  802363:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80236a:	00 00 00 
+  80236d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802374:	00 00 00 
+  802377:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  80237d:	83 ec 08             	sub    $0x8,%esp
+  802380:	53                   	push   %ebx
+  802381:	56                   	push   %esi
+  802382:	ff 50 14             	call   *0x14(%eax)
+  802385:	83 c4 10             	add    $0x10,%esp
+  802388:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80238b:	5b                   	pop    %ebx
+  80238c:	5e                   	pop    %esi
+  80238d:	5d                   	pop    %ebp
+  80238e:	c3                   	ret
+  80238f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802394:	eb f2                	jmp    802388 <fstat+0x67>
+
+00802396 <stat>:
+  802396:	55                   	push   %ebp
+  802397:	89 e5                	mov    %esp,%ebp
+  802399:	56                   	push   %esi
+  80239a:	53                   	push   %ebx
+  80239b:	83 ec 08             	sub    $0x8,%esp
+  80239e:	6a 00                	push   $0x0
+  8023a0:	ff 75 08             	push   0x8(%ebp)
+  8023a3:	e8 31 05 00 00       	call   8028d9 <open>
+  8023a8:	89 c3                	mov    %eax,%ebx
+  8023aa:	83 c4 10             	add    $0x10,%esp
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	78 1b                	js     8023cc <stat+0x36>
+  8023b1:	83 ec 08             	sub    $0x8,%esp
+  8023b4:	ff 75 0c             	push   0xc(%ebp)
+  8023b7:	50                   	push   %eax
+  8023b8:	e8 64 ff ff ff       	call   802321 <fstat>
+  8023bd:	89 c6                	mov    %eax,%esi
+  8023bf:	89 1c 24             	mov    %ebx,(%esp)
+  8023c2:	e8 19 fc ff ff       	call   801fe0 <close>
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	89 f3                	mov    %esi,%ebx
+  8023cc:	89 d8                	mov    %ebx,%eax
+  8023ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d1:	5b                   	pop    %ebx
+  8023d2:	5e                   	pop    %esi
+  8023d3:	5d                   	pop    %ebp
+  8023d4:	c3                   	ret
+
+008023d5 <fsipc>:
+  8023d5:	55                   	push   %ebp
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	56                   	push   %esi
+  8023d9:	53                   	push   %ebx
+  8023da:	89 c3                	mov    %eax,%ebx
+  8023dc:	89 d6                	mov    %edx,%esi
+  8023de:	83 3d f0 00 81 00 00 	cmpl   $0x0,0x8100f0
+  8023e5:	74 20                	je     802407 <fsipc+0x32>
+  8023e7:	83 ec 08             	sub    $0x8,%esp
+  8023ea:	6a 00                	push   $0x0
+  8023ec:	56                   	push   %esi
+  8023ed:	6a 07                	push   $0x7
+  8023ef:	68 00 10 81 00       	push   $0x811000
+  8023f4:	53                   	push   %ebx
+  8023f5:	ff 35 f0 00 81 00    	push   0x8100f0
+  8023fb:	e8 5f 13 00 00       	call   80375f <ipc_call>
+  802400:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802403:	5b                   	pop    %ebx
+  802404:	5e                   	pop    %esi
+  802405:	5d                   	pop    %ebp
+  802406:	c3                   	ret
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	6a 02                	push   $0x2
+  80240c:	e8 e9 14 00 00       	call   8038fa <ipc_find_env>
+  802411:	a3 f0 00 81 00       	mov    %eax,0x8100f0
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	eb cc                	jmp    8023e7 <fsipc+0x12>
+
+0080241b <devfile_trunc>:
+  80241b:	55                   	push   %ebp
+  80241c:	89 e5                	mov    %esp,%ebp
+  80241e:	83 ec 08             	sub    $0x8,%esp
+  802421:	8b 45 08             	mov    0x8(%ebp),%eax
+  802424:	8b 40 0c             	mov    0xc(%eax),%eax
+  802427:	a3 00 10 81 00       	mov    %eax,0x811000
+  80242c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242f:	a3 04 10 81 00       	mov    %eax,0x811004
+  802434:	ba 00 00 00 00       	mov    $0x0,%edx
+  802439:	b8 02 00 00 00       	mov    $0x2,%eax
+  80243e:	e8 92 ff ff ff       	call   8023d5 <fsipc>
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+
+00802445 <devfile_flush>:
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	83 ec 08             	sub    $0x8,%esp
+  80244b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802451:	a3 00 10 81 00       	mov    %eax,0x811000
+  802456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802460:	e8 70 ff ff ff       	call   8023d5 <fsipc>
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+
+00802467 <devfile_stat>:
+  802467:	55                   	push   %ebp
+  802468:	89 e5                	mov    %esp,%ebp
+  80246a:	53                   	push   %ebx
+  80246b:	83 ec 04             	sub    $0x4,%esp
+  80246e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802471:	8b 45 08             	mov    0x8(%ebp),%eax
+  802474:	8b 40 0c             	mov    0xc(%eax),%eax
+  802477:	a3 00 10 81 00       	mov    %eax,0x811000
+  80247c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802481:	b8 07 00 00 00       	mov    $0x7,%eax
+  802486:	e8 4a ff ff ff       	call   8023d5 <fsipc>
+  80248b:	85 c0                	test   %eax,%eax
+  80248d:	78 2c                	js     8024bb <devfile_stat+0x54>
+  80248f:	83 ec 08             	sub    $0x8,%esp
+  802492:	68 00 10 81 00       	push   $0x811000
+  802497:	53                   	push   %ebx
+  802498:	e8 a7 e7 ff ff       	call   800c44 <strcpy>
+  80249d:	a1 80 10 81 00       	mov    0x811080,%eax
+  8024a2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8024a8:	a1 84 10 81 00       	mov    0x811084,%eax
+  8024ad:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024be:	c9                   	leave
+  8024bf:	c3                   	ret
+
+008024c0 <fsring_rw>:
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	57                   	push   %edi
+  8024c4:	56                   	push   %esi
+  8024c5:	53                   	push   %ebx
+  8024c6:	83 ec 2c             	sub    $0x2c,%esp
+  8024c9:	89 c7                	mov    %eax,%edi
+  8024cb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8024ce:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8024d1:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8024d6:	a8 01                	test   $0x1,%al
+  8024d8:	74 0d                	je     8024e7 <fsring_rw+0x27>
+  8024da:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8024df:	a8 01                	test   $0x1,%al
+  8024e1:	0f 85 d5 00 00 00    	jne    8025bc <fsring_rw+0xfc>
+  8024e7:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  8024ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8024ef:	3b 05 ec 00 81 00    	cmp    0x8100ec,%eax
+  8024f5:	0f 84 fc 00 00 00    	je     8025f7 <fsring_rw+0x137>
+  8024fb:	83 3d f0 00 81 00 00 	cmpl   $0x0,0x8100f0
+  802502:	0f 84 02 01 00 00    	je     80260a <fsring_rw+0x14a>
+  802508:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80250d:	83 ec 04             	sub    $0x4,%esp
+  802510:	68 07 02 00 00       	push   $0x207
+  802515:	53                   	push   %ebx
+  802516:	6a 00                	push   $0x0
+  802518:	e8 87 eb ff ff       	call   8010a4 <sys_page_alloc>
+  80251d:	83 c4 10             	add    $0x10,%esp
+  802520:	85 c0                	test   %eax,%eax
+  802522:	0f 88 f9 00 00 00    	js     802621 <fsring_rw+0x161>
+  802528:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80252e:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802534:	75 d7                	jne    80250d <fsring_rw+0x4d>
+  802536:	6a 0e                	push   $0xe
+  802538:	6a 0d                	push   $0xd
+  80253a:	ff 35 f0 00 81 00    	push   0x8100f0
+  802540:	68 00 00 f0 cf       	push   $0xcff00000
+  802545:	e8 26 0d 00 00       	call   803270 <ipcring_init>
+  80254a:	83 c4 08             	add    $0x8,%esp
+  80254d:	6a 00                	push   $0x0
+  80254f:	6a 00                	push   $0x0
+  802551:	68 07 02 00 00       	push   $0x207
+  802556:	68 00 00 f0 cf       	push   $0xcff00000
+  80255b:	6a 0b                	push   $0xb
+  80255d:	ff 35 f0 00 81 00    	push   0x8100f0
+  802563:	e8 f7 11 00 00       	call   80375f <ipc_call>
+  802568:	89 c6                	mov    %eax,%esi
+  80256a:	83 c4 20             	add    $0x20,%esp
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	0f 88 ac 00 00 00    	js     802621 <fsring_rw+0x161>
+  802575:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80257a:	89 d9                	mov    %ebx,%ecx
+  80257c:	83 c3 01             	add    $0x1,%ebx
+  80257f:	89 da                	mov    %ebx,%edx
+  802581:	c1 e2 0c             	shl    $0xc,%edx
+  802584:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80258a:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802590:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802596:	83 ec 08             	sub    $0x8,%esp
+  802599:	6a 00                	push   $0x0
+  80259b:	6a 00                	push   $0x0
+  80259d:	68 07 02 00 00       	push   $0x207
+  8025a2:	50                   	push   %eax
+  8025a3:	6a 0c                	push   $0xc
+  8025a5:	ff 35 f0 00 81 00    	push   0x8100f0
+  8025ab:	e8 af 11 00 00       	call   80375f <ipc_call>
+  8025b0:	83 c4 20             	add    $0x20,%esp
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	78 6a                	js     802621 <fsring_rw+0x161>
+  8025b7:	83 fb 08             	cmp    $0x8,%ebx
+  8025ba:	75 be                	jne    80257a <fsring_rw+0xba>
+  8025bc:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8025c0:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8025c5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025ca:	0f 45 c2             	cmovne %edx,%eax
+  8025cd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8025d0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8025d7:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8025de:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8025e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ef:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8025f2:	e9 4b 01 00 00       	jmp    802742 <fsring_rw+0x282>
+  8025f7:	e8 72 ee ff ff       	call   80146e <sys_time_msec>
+  8025fc:	3b 05 e8 00 81 00    	cmp    0x8100e8,%eax
+  802602:	0f 89 f3 fe ff ff    	jns    8024fb <fsring_rw+0x3b>
+  802608:	eb 54                	jmp    80265e <fsring_rw+0x19e>
+  80260a:	83 ec 0c             	sub    $0xc,%esp
+  80260d:	6a 02                	push   $0x2
+  80260f:	e8 e6 12 00 00       	call   8038fa <ipc_find_env>
+  802614:	a3 f0 00 81 00       	mov    %eax,0x8100f0
+  802619:	83 c4 10             	add    $0x10,%esp
+  80261c:	e9 e7 fe ff ff       	jmp    802508 <fsring_rw+0x48>
+  802621:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802626:	83 ec 08             	sub    $0x8,%esp
+  802629:	53                   	push   %ebx
+  80262a:	6a 00                	push   $0x0
+  80262c:	e8 45 eb ff ff       	call   801176 <sys_page_unmap>
+  802631:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802637:	83 c4 10             	add    $0x10,%esp
+  80263a:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802640:	75 e4                	jne    802626 <fsring_rw+0x166>
+  802642:	e8 27 ee ff ff       	call   80146e <sys_time_msec>
+  802647:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80264c:	a3 e8 00 81 00       	mov    %eax,0x8100e8
+  802651:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  802656:	8b 40 48             	mov    0x48(%eax),%eax
+  802659:	a3 ec 00 81 00       	mov    %eax,0x8100ec
+  80265e:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802665:	e9 7a 01 00 00       	jmp    8027e4 <fsring_rw+0x324>
+  80266a:	8b 57 0c             	mov    0xc(%edi),%edx
+  80266d:	89 10                	mov    %edx,(%eax)
+  80266f:	89 58 04             	mov    %ebx,0x4(%eax)
+  802672:	89 f2                	mov    %esi,%edx
+  802674:	03 57 04             	add    0x4(%edi),%edx
+  802677:	89 50 08             	mov    %edx,0x8(%eax)
+  80267a:	83 ec 04             	sub    $0x4,%esp
+  80267d:	53                   	push   %ebx
+  80267e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802681:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802684:	52                   	push   %edx
+  802685:	83 c0 0c             	add    $0xc,%eax
+  802688:	50                   	push   %eax
+  802689:	e8 66 e7 ff ff       	call   800df4 <memmove>
+  80268e:	83 c4 10             	add    $0x10,%esp
+  802691:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802694:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802697:	89 08                	mov    %ecx,(%eax)
+  802699:	83 ec 0c             	sub    $0xc,%esp
+  80269c:	68 00 00 f0 cf       	push   $0xcff00000
+  8026a1:	e8 28 0c 00 00       	call   8032ce <ipcring_req_push>
+  8026a6:	01 de                	add    %ebx,%esi
+  8026a8:	83 c4 10             	add    $0x10,%esp
+  8026ab:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8026ae:	73 4c                	jae    8026fc <fsring_rw+0x23c>
+  8026b0:	83 ec 0c             	sub    $0xc,%esp
+  8026b3:	68 00 00 f0 cf       	push   $0xcff00000
+  8026b8:	e8 eb 0b 00 00       	call   8032a8 <ipcring_req_slot>
+  8026bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026c0:	83 c4 10             	add    $0x10,%esp
+  8026c3:	85 c0                	test   %eax,%eax
+  8026c5:	74 35                	je     8026fc <fsring_rw+0x23c>
+  8026c7:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8026cc:	83 e0 07             	and    $0x7,%eax
+  8026cf:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8026d4:	c1 e0 0c             	shl    $0xc,%eax
+  8026d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026da:	29 f3                	sub    %esi,%ebx
+  8026dc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8026df:	39 cb                	cmp    %ecx,%ebx
+  8026e1:	0f 47 d9             	cmova  %ecx,%ebx
+  8026e4:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8026e8:	75 80                	jne    80266a <fsring_rw+0x1aa>
+  8026ea:	8b 57 0c             	mov    0xc(%edi),%edx
+  8026ed:	89 10                	mov    %edx,(%eax)
+  8026ef:	89 58 04             	mov    %ebx,0x4(%eax)
+  8026f2:	89 f2                	mov    %esi,%edx
+  8026f4:	03 57 04             	add    0x4(%edi),%edx
+  8026f7:	89 50 08             	mov    %edx,0x8(%eax)
+  8026fa:	eb 95                	jmp    802691 <fsring_rw+0x1d1>
+  8026fc:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802701:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802704:	83 ec 0c             	sub    $0xc,%esp
+  802707:	68 00 00 f0 cf       	push   $0xcff00000
+  80270c:	e8 f6 0b 00 00       	call   803307 <ipcring_rsp_wait>
+  802711:	8b 58 04             	mov    0x4(%eax),%ebx
+  802714:	83 c4 10             	add    $0x10,%esp
+  802717:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80271b:	75 45                	jne    802762 <fsring_rw+0x2a2>
+  80271d:	85 db                	test   %ebx,%ebx
+  80271f:	79 41                	jns    802762 <fsring_rw+0x2a2>
+  802721:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802724:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80272b:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802732:	83 ec 0c             	sub    $0xc,%esp
+  802735:	68 00 00 f0 cf       	push   $0xcff00000
+  80273a:	e8 2e 0c 00 00       	call   80336d <ipcring_rsp_pop>
+  80273f:	83 c4 10             	add    $0x10,%esp
+  802742:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802748:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80274d:	39 c2                	cmp    %eax,%edx
+  80274f:	74 75                	je     8027c6 <fsring_rw+0x306>
+  802751:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802755:	75 a5                	jne    8026fc <fsring_rw+0x23c>
+  802757:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80275a:	0f 82 50 ff ff ff    	jb     8026b0 <fsring_rw+0x1f0>
+  802760:	eb 9a                	jmp    8026fc <fsring_rw+0x23c>
+  802762:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802766:	75 ca                	jne    802732 <fsring_rw+0x272>
+  802768:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80276c:	74 31                	je     80279f <fsring_rw+0x2df>
+  80276e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802771:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802774:	29 c8                	sub    %ecx,%eax
+  802776:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802779:	39 d0                	cmp    %edx,%eax
+  80277b:	0f 47 c2             	cmova  %edx,%eax
+  80277e:	39 d8                	cmp    %ebx,%eax
+  802780:	ba 01 00 00 00       	mov    $0x1,%edx
+  802785:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802789:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  80278c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802791:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802795:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802798:	01 d9                	add    %ebx,%ecx
+  80279a:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80279d:	eb 93                	jmp    802732 <fsring_rw+0x272>
+  80279f:	83 ec 04             	sub    $0x4,%esp
+  8027a2:	53                   	push   %ebx
+  8027a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027a6:	83 e0 07             	and    $0x7,%eax
+  8027a9:	c1 e0 0c             	shl    $0xc,%eax
+  8027ac:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8027b2:	50                   	push   %eax
+  8027b3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8027b6:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8027b9:	01 c8                	add    %ecx,%eax
+  8027bb:	50                   	push   %eax
+  8027bc:	e8 33 e6 ff ff       	call   800df4 <memmove>
+  8027c1:	83 c4 10             	add    $0x10,%esp
+  8027c4:	eb a8                	jmp    80276e <fsring_rw+0x2ae>
+  8027c6:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8027ca:	75 09                	jne    8027d5 <fsring_rw+0x315>
+  8027cc:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8027cf:	0f 82 db fe ff ff    	jb     8026b0 <fsring_rw+0x1f0>
+  8027d5:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8027d8:	01 57 04             	add    %edx,0x4(%edi)
+  8027db:	85 d2                	test   %edx,%edx
+  8027dd:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8027e1:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8027e4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8027e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ea:	5b                   	pop    %ebx
+  8027eb:	5e                   	pop    %esi
+  8027ec:	5f                   	pop    %edi
+  8027ed:	5d                   	pop    %ebp
+  8027ee:	c3                   	ret
+
+008027ef <devfile_write>:
+  8027ef:	55                   	push   %ebp
+  8027f0:	89 e5                	mov    %esp,%ebp
+  8027f2:	57                   	push   %edi
+  8027f3:	56                   	push   %esi
+  8027f4:	53                   	push   %ebx
+  8027f5:	83 ec 0c             	sub    $0xc,%esp
+  8027f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8027fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802801:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802807:	76 1a                	jbe    802823 <devfile_write+0x34>
+  802809:	83 ec 0c             	sub    $0xc,%esp
+  80280c:	53                   	push   %ebx
+  80280d:	89 f1                	mov    %esi,%ecx
+  80280f:	ba 06 00 00 00       	mov    $0x6,%edx
+  802814:	89 f8                	mov    %edi,%eax
+  802816:	e8 a5 fc ff ff       	call   8024c0 <fsring_rw>
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802821:	75 39                	jne    80285c <devfile_write+0x6d>
+  802823:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802828:	39 c3                	cmp    %eax,%ebx
+  80282a:	0f 47 d8             	cmova  %eax,%ebx
+  80282d:	8b 47 0c             	mov    0xc(%edi),%eax
+  802830:	a3 00 10 81 00       	mov    %eax,0x811000
+  802835:	89 1d 04 10 81 00    	mov    %ebx,0x811004
+  80283b:	83 ec 04             	sub    $0x4,%esp
+  80283e:	53                   	push   %ebx
+  80283f:	56                   	push   %esi
+  802840:	68 08 10 81 00       	push   $0x811008
+  802845:	e8 aa e5 ff ff       	call   800df4 <memmove>
+  80284a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80284f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802854:	e8 7c fb ff ff       	call   8023d5 <fsipc>
+  802859:	83 c4 10             	add    $0x10,%esp
+  80285c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80285f:	5b                   	pop    %ebx
+  802860:	5e                   	pop    %esi
+  802861:	5f                   	pop    %edi
+  802862:	5d                   	pop    %ebp
+  802863:	c3                   	ret
+
+00802864 <devfile_read>:
+  802864:	55                   	push   %ebp
+  802865:	89 e5                	mov    %esp,%ebp
+  802867:	57                   	push   %edi
+  802868:	56                   	push   %esi
+  802869:	53                   	push   %ebx
+  80286a:	83 ec 0c             	sub    $0xc,%esp
+  80286d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802870:	8b 75 10             	mov    0x10(%ebp),%esi
+  802873:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802879:	76 1d                	jbe    802898 <devfile_read+0x34>
+  80287b:	83 ec 0c             	sub    $0xc,%esp
+  80287e:	56                   	push   %esi
+  80287f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802882:	ba 05 00 00 00       	mov    $0x5,%edx
+  802887:	89 f8                	mov    %edi,%eax
+  802889:	e8 32 fc ff ff       	call   8024c0 <fsring_rw>
+  80288e:	89 c3                	mov    %eax,%ebx
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802896:	75 37                	jne    8028cf <devfile_read+0x6b>
+  802898:	8b 47 0c             	mov    0xc(%edi),%eax
+  80289b:	a3 00 10 81 00       	mov    %eax,0x811000
+  8028a0:	89 35 04 10 81 00    	mov    %esi,0x811004
+  8028a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ab:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028b0:	e8 20 fb ff ff       	call   8023d5 <fsipc>
+  8028b5:	89 c3                	mov    %eax,%ebx
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	78 14                	js     8028cf <devfile_read+0x6b>
+  8028bb:	83 ec 04             	sub    $0x4,%esp
+  8028be:	50                   	push   %eax
+  8028bf:	68 00 10 81 00       	push   $0x811000
+  8028c4:	ff 75 0c             	push   0xc(%ebp)
+  8028c7:	e8 28 e5 ff ff       	call   800df4 <memmove>
+  8028cc:	83 c4 10             	add    $0x10,%esp
+  8028cf:	89 d8                	mov    %ebx,%eax
+  8028d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028d4:	5b                   	pop    %ebx
+  8028d5:	5e                   	pop    %esi
+  8028d6:	5f                   	pop    %edi
+  8028d7:	5d                   	pop    %ebp
+  8028d8:	c3                   	ret
+
+008028d9 <open>:
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	56                   	push   %esi
+  8028dd:	53                   	push   %ebx
+  8028de:	83 ec 1c             	sub    $0x1c,%esp
+  8028e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e4:	56                   	push   %esi
+  8028e5:	e8 0e e3 ff ff       	call   800bf8 <strlen>
+  8028ea:	83 c4 10             	add    $0x10,%esp
+  8028ed:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028f2:	7f 6c                	jg     802960 <open+0x87>
+  8028f4:	83 ec 0c             	sub    $0xc,%esp
+  8028f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028fa:	50                   	push   %eax
+  8028fb:	e8 6a f5 ff ff       	call   801e6a <fd_alloc>
+  802900:	89 c3                	mov    %eax,%ebx
+  802902:	83 c4 10             	add    $0x10,%esp
+  802905:	85 c0                	test   %eax,%eax
+  802907:	78 3c                	js     802945 <open+0x6c>
+  802909:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80290c:	a3 00 14 81 00       	mov    %eax,0x811400
+  802911:	83 ec 08             	sub    $0x8,%esp
+  802914:	56                   	push   %esi
+  802915:	68 00 10 81 00       	push   $0x811000
+  80291a:	e8 25 e3 ff ff       	call   800c44 <strcpy>
+  80291f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802922:	b8 01 00 00 00       	mov    $0x1,%eax
+  802927:	e8 a9 fa ff ff       	call   8023d5 <fsipc>
+  80292c:	89 c3                	mov    %eax,%ebx
+  80292e:	83 c4 10             	add    $0x10,%esp
+  802931:	85 c0                	test   %eax,%eax
+  802933:	78 19                	js     80294e <open+0x75>
+  802935:	83 ec 0c             	sub    $0xc,%esp
+  802938:	ff 75 f4             	push   -0xc(%ebp)
+  80293b:	e8 03 f5 ff ff       	call   801e43 <fd2num>
+  802940:	89 c3                	mov    %eax,%ebx
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	89 d8                	mov    %ebx,%eax
+  802947:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80294a:	5b                   	pop    %ebx
+  80294b:	5e                   	pop    %esi
+  80294c:	5d                   	pop    %ebp
+  80294d:	c3                   	ret
+  80294e:	83 ec 08             	sub    $0x8,%esp
+  802951:	6a 00                	push   $0x0
+  802953:	ff 75 f4             	push   -0xc(%ebp)
+  802956:	e8 05 f6 ff ff       	call   801f60 <fd_close>
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	eb e5                	jmp    802945 <open+0x6c>
+  802960:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802965:	eb de                	jmp    802945 <open+0x6c>
+
+00802967 <file_image>:
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	53                   	push   %ebx
+  80296b:	83 ec 1c             	sub    $0x1c,%esp
+  80296e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802971:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802974:	50                   	push   %eax
+  802975:	ff 75 08             	push   0x8(%ebp)
+  802978:	e8 3d f5 ff ff       	call   801eba <fd_lookup>
+  80297d:	83 c4 10             	add    $0x10,%esp
+  802980:	85 c0                	test   %eax,%eax
+  802982:	78 58                	js     8029dc <file_image+0x75>
+  802984:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802987:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80298d:	39 08                	cmp    %ecx,(%eax)
+  80298f:	75 50                	jne    8029e1 <file_image+0x7a>
+  802991:	83 fb 04             	cmp    $0x4,%ebx
+  802994:	77 52                	ja     8029e8 <file_image+0x81>
+  802996:	8b 40 0c             	mov    0xc(%eax),%eax
+  802999:	a3 00 10 81 00       	mov    %eax,0x811000
+  80299e:	89 1d 04 10 81 00    	mov    %ebx,0x811004
+  8029a4:	83 ec 04             	sub    $0x4,%esp
+  8029a7:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8029aa:	c1 e0 02             	shl    $0x2,%eax
+  8029ad:	50                   	push   %eax
+  8029ae:	ff 75 0c             	push   0xc(%ebp)
+  8029b1:	68 08 10 81 00       	push   $0x811008
+  8029b6:	e8 39 e4 ff ff       	call   800df4 <memmove>
+  8029bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029c5:	e8 0b fa ff ff       	call   8023d5 <fsipc>
+  8029ca:	83 c4 10             	add    $0x10,%esp
+  8029cd:	85 c0                	test   %eax,%eax
+  8029cf:	78 0b                	js     8029dc <file_image+0x75>
+  8029d1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8029d4:	8b 0d f0 00 81 00    	mov    0x8100f0,%ecx
+  8029da:	89 0a                	mov    %ecx,(%edx)
+  8029dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029df:	c9                   	leave
+  8029e0:	c3                   	ret
+  8029e1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029e6:	eb f4                	jmp    8029dc <file_image+0x75>
+  8029e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029ed:	eb ed                	jmp    8029dc <file_image+0x75>
+
+008029ef <remove>:
+  8029ef:	55                   	push   %ebp
+  8029f0:	89 e5                	mov    %esp,%ebp
+  8029f2:	53                   	push   %ebx
+  8029f3:	83 ec 10             	sub    $0x10,%esp
+  8029f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029f9:	53                   	push   %ebx
+  8029fa:	e8 f9 e1 ff ff       	call   800bf8 <strlen>
+  8029ff:	83 c4 10             	add    $0x10,%esp
+  802a02:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a07:	7f 25                	jg     802a2e <remove+0x3f>
+  802a09:	83 ec 08             	sub    $0x8,%esp
+  802a0c:	53                   	push   %ebx
+  802a0d:	68 00 10 81 00       	push   $0x811000
+  802a12:	e8 2d e2 ff ff       	call   800c44 <strcpy>
+  802a17:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a1c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a21:	e8 af f9 ff ff       	call   8023d5 <fsipc>
+  802a26:	83 c4 10             	add    $0x10,%esp
+  802a29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+  802a2e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a33:	eb f4                	jmp    802a29 <remove+0x3a>
+
+00802a35 <sync>:
+  802a35:	55                   	push   %ebp
+  802a36:	89 e5                	mov    %esp,%ebp
+  802a38:	83 ec 08             	sub    $0x8,%esp
+  802a3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a40:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a45:	e8 8b f9 ff ff       	call   8023d5 <fsipc>
+  802a4a:	c9                   	leave
+  802a4b:	c3                   	ret
+
+00802a4c <devsock_stat>:
+  802a4c:	55                   	push   %ebp
+  802a4d:	89 e5                	mov    %esp,%ebp
+  802a4f:	83 ec 10             	sub    $0x10,%esp
+  802a52:	68 70 41 80 00       	push   $0x804170
+  802a57:	ff 75 0c             	push   0xc(%ebp)
+  802a5a:	e8 e5 e1 ff ff       	call   800c44 <strcpy>
+  802a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a64:	c9                   	leave
+  802a65:	c3                   	ret
+
+00802a66 <devsock_close>:
+  802a66:	55                   	push   %ebp
+  802a67:	89 e5                	mov    %esp,%ebp
+  802a69:	53                   	push   %ebx
+  802a6a:	83 ec 10             	sub    $0x10,%esp
+  802a6d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a70:	53                   	push   %ebx
+  802a71:	e8 9e 0e 00 00       	call   803914 <pageref>
+  802a76:	89 c2                	mov    %eax,%edx
+  802a78:	83 c4 10             	add    $0x10,%esp
+  802a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a80:	83 fa 01             	cmp    $0x1,%edx
+  802a83:	74 05                	je     802a8a <devsock_close+0x24>
+  802a85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a88:	c9                   	leave
+  802a89:	c3                   	ret
+  802a8a:	83 ec 0c             	sub    $0xc,%esp
+  802a8d:	ff 73 0c             	push   0xc(%ebx)
+  802a90:	e8 aa 02 00 00       	call   802d3f <nsipc_close>
+  802a95:	83 c4 10             	add    $0x10,%esp
+  802a98:	eb eb                	jmp    802a85 <devsock_close+0x1f>
+
+00802a9a <devsock_write>:
+  802a9a:	55                   	push   %ebp
+  802a9b:	89 e5                	mov    %esp,%ebp
+  802a9d:	83 ec 08             	sub    $0x8,%esp
+  802aa0:	6a 00                	push   $0x0
+  802aa2:	ff 75 10             	push   0x10(%ebp)
+  802aa5:	ff 75 0c             	push   0xc(%ebp)
+  802aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aab:	ff 70 0c             	push   0xc(%eax)
+  802aae:	e8 6c 03 00 00       	call   802e1f <nsipc_send>
+  802ab3:	c9                   	leave
+  802ab4:	c3                   	ret
+
+00802ab5 <devsock_read>:
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	83 ec 08             	sub    $0x8,%esp
+  802abb:	6a 00                	push   $0x0
+  802abd:	ff 75 10             	push   0x10(%ebp)
+  802ac0:	ff 75 0c             	push   0xc(%ebp)
+  802ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac6:	ff 70 0c             	push   0xc(%eax)
+  802ac9:	e8 e2 02 00 00       	call   802db0 <nsipc_recv>
+  802ace:	c9                   	leave
+  802acf:	c3                   	ret
+
+00802ad0 <fd2sockid>:
+  802ad0:	55                   	push   %ebp
+  802ad1:	89 e5                	mov    %esp,%ebp
+  802ad3:	83 ec 20             	sub    $0x20,%esp
+  802ad6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ad9:	52                   	push   %edx
+  802ada:	50                   	push   %eax
+  802adb:	e8 da f3 ff ff       	call   801eba <fd_lookup>
+  802ae0:	83 c4 10             	add    $0x10,%esp
+  802ae3:	85 c0                	test   %eax,%eax
+  802ae5:	78 10                	js     802af7 <fd2sockid+0x27>
+  802ae7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aea:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802af0:	39 08                	cmp    %ecx,(%eax)
+  802af2:	75 05                	jne    802af9 <fd2sockid+0x29>
+  802af4:	8b 40 0c             	mov    0xc(%eax),%eax
+  802af7:	c9                   	leave
+  802af8:	c3                   	ret
+  802af9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802afe:	eb f7                	jmp    802af7 <fd2sockid+0x27>
+
+00802b00 <alloc_sockfd>:
+  802b00:	55                   	push   %ebp
+  802b01:	89 e5                	mov    %esp,%ebp
+  802b03:	56                   	push   %esi
+  802b04:	53                   	push   %ebx
+  802b05:	83 ec 1c             	sub    $0x1c,%esp
+  802b08:	89 c6                	mov    %eax,%esi
+  802b0a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b0d:	50                   	push   %eax
+  802b0e:	e8 57 f3 ff ff       	call   801e6a <fd_alloc>
+  802b13:	89 c3                	mov    %eax,%ebx
+  802b15:	83 c4 10             	add    $0x10,%esp
+  802b18:	85 c0                	test   %eax,%eax
+  802b1a:	78 43                	js     802b5f <alloc_sockfd+0x5f>
+  802b1c:	83 ec 04             	sub    $0x4,%esp
+  802b1f:	68 07 04 00 00       	push   $0x407
+  802b24:	ff 75 f4             	push   -0xc(%ebp)
+  802b27:	6a 00                	push   $0x0
+  802b29:	e8 76 e5 ff ff       	call   8010a4 <sys_page_alloc>
+  802b2e:	89 c3                	mov    %eax,%ebx
+  802b30:	83 c4 10             	add    $0x10,%esp
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	78 28                	js     802b5f <alloc_sockfd+0x5f>
+  802b37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b3a:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802b40:	89 10                	mov    %edx,(%eax)
+  802b42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b45:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802b4c:	89 70 0c             	mov    %esi,0xc(%eax)
+  802b4f:	83 ec 0c             	sub    $0xc,%esp
+  802b52:	50                   	push   %eax
+  802b53:	e8 eb f2 ff ff       	call   801e43 <fd2num>
+  802b58:	89 c3                	mov    %eax,%ebx
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	eb 0c                	jmp    802b6b <alloc_sockfd+0x6b>
+  802b5f:	83 ec 0c             	sub    $0xc,%esp
+  802b62:	56                   	push   %esi
+  802b63:	e8 d7 01 00 00       	call   802d3f <nsipc_close>
+  802b68:	83 c4 10             	add    $0x10,%esp
+  802b6b:	89 d8                	mov    %ebx,%eax
+  802b6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b70:	5b                   	pop    %ebx
+  802b71:	5e                   	pop    %esi
+  802b72:	5d                   	pop    %ebp
+  802b73:	c3                   	ret
+
+00802b74 <accept>:
+  802b74:	55                   	push   %ebp
+  802b75:	89 e5                	mov    %esp,%ebp
+  802b77:	83 ec 08             	sub    $0x8,%esp
+  802b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7d:	e8 4e ff ff ff       	call   802ad0 <fd2sockid>
+  802b82:	85 c0                	test   %eax,%eax
+  802b84:	78 1b                	js     802ba1 <accept+0x2d>
+  802b86:	83 ec 04             	sub    $0x4,%esp
+  802b89:	ff 75 10             	push   0x10(%ebp)
+  802b8c:	ff 75 0c             	push   0xc(%ebp)
+  802b8f:	50                   	push   %eax
+  802b90:	e8 07 01 00 00       	call   802c9c <nsipc_accept>
+  802b95:	83 c4 10             	add    $0x10,%esp
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	78 05                	js     802ba1 <accept+0x2d>
+  802b9c:	e8 5f ff ff ff       	call   802b00 <alloc_sockfd>
+  802ba1:	c9                   	leave
+  802ba2:	c3                   	ret
+
+00802ba3 <bind>:
+  802ba3:	55                   	push   %ebp
+  802ba4:	89 e5                	mov    %esp,%ebp
+  802ba6:	83 ec 08             	sub    $0x8,%esp
+  802ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bac:	e8 1f ff ff ff       	call   802ad0 <fd2sockid>
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	78 12                	js     802bc7 <bind+0x24>
+  802bb5:	83 ec 04             	sub    $0x4,%esp
+  802bb8:	ff 75 10             	push   0x10(%ebp)
+  802bbb:	ff 75 0c             	push   0xc(%ebp)
+  802bbe:	50                   	push   %eax
+  802bbf:	e8 24 01 00 00       	call   802ce8 <nsipc_bind>
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	c9                   	leave
+  802bc8:	c3                   	ret
+
+00802bc9 <shutdown>:
+  802bc9:	55                   	push   %ebp
+  802bca:	89 e5                	mov    %esp,%ebp
+  802bcc:	83 ec 08             	sub    $0x8,%esp
+  802bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd2:	e8 f9 fe ff ff       	call   802ad0 <fd2sockid>
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	78 0f                	js     802bea <shutdown+0x21>
+  802bdb:	83 ec 08             	sub    $0x8,%esp
+  802bde:	ff 75 0c             	push   0xc(%ebp)
+  802be1:	50                   	push   %eax
+  802be2:	e8 36 01 00 00       	call   802d1d <nsipc_shutdown>
+  802be7:	83 c4 10             	add    $0x10,%esp
+  802bea:	c9                   	leave
+  802beb:	c3                   	ret
+
+00802bec <connect>:
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	83 ec 08             	sub    $0x8,%esp
+  802bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf5:	e8 d6 fe ff ff       	call   802ad0 <fd2sockid>
+  802bfa:	85 c0                	test   %eax,%eax
+  802bfc:	78 12                	js     802c10 <connect+0x24>
+  802bfe:	83 ec 04             	sub    $0x4,%esp
+  802c01:	ff 75 10             	push   0x10(%ebp)
+  802c04:	ff 75 0c             	push   0xc(%ebp)
+  802c07:	50                   	push   %eax
+  802c08:	e8 4c 01 00 00       	call   802d59 <nsipc_connect>
+  802c0d:	83 c4 10             	add    $0x10,%esp
+  802c10:	c9                   	leave
+  802c11:	c3                   	ret
+
+00802c12 <listen>:
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	83 ec 08             	sub    $0x8,%esp
+  802c18:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1b:	e8 b0 fe ff ff       	call   802ad0 <fd2sockid>
+  802c20:	85 c0                	test   %eax,%eax
+  802c22:	78 0f                	js     802c33 <listen+0x21>
+  802c24:	83 ec 08             	sub    $0x8,%esp
+  802c27:	ff 75 0c             	push   0xc(%ebp)
+  802c2a:	50                   	push   %eax
+  802c2b:	e8 5e 01 00 00       	call   802d8e <nsipc_listen>
+  802c30:	83 c4 10             	add    $0x10,%esp
+  802c33:	c9                   	leave
+  802c34:	c3                   	ret
+
+00802c35 <socket>:
+  802c35:	55                   	push   %ebp
+  802c36:	89 e5                	mov    %esp,%ebp
+  802c38:	83 ec 0c             	sub    $0xc,%esp
+  802c3b:	ff 75 10             	push   0x10(%ebp)
+  802c3e:	ff 75 0c             	push   0xc(%ebp)
+  802c41:	ff 75 08             	push   0x8(%ebp)
+  802c44:	e8 34 02 00 00       	call   802e7d <nsipc_socket>
+  802c49:	83 c4 10             	add    $0x10,%esp
+  802c4c:	85 c0                	test   %eax,%eax
+  802c4e:	78 05                	js     802c55 <socket+0x20>
+  802c50:	e8 ab fe ff ff       	call   802b00 <alloc_sockfd>
+  802c55:	c9                   	leave
+  802c56:	c3                   	ret
+
+00802c57 <nsipc>:
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	53                   	push   %ebx
+  802c5b:	83 ec 04             	sub    $0x4,%esp
+  802c5e:	89 c3                	mov    %eax,%ebx
+  802c60:	83 3d f4 00 81 00 00 	cmpl   $0x0,0x8100f4
+  802c67:	74 1f                	je     802c88 <nsipc+0x31>
+  802c69:	83 ec 08             	sub    $0x8,%esp
+  802c6c:	6a 00                	push   $0x0
+  802c6e:	6a 00                	push   $0x0
+  802c70:	6a 07                	push   $0x7
+  802c72:	68 00 20 81 00       	push   $0x812000
+  802c77:	53                   	push   %ebx
+  802c78:	ff 35 f4 00 81 00    	push   0x8100f4
+  802c7e:	e8 dc 0a 00 00       	call   80375f <ipc_call>
+  802c83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c86:	c9                   	leave
+  802c87:	c3                   	ret
+  802c88:	83 ec 0c             	sub    $0xc,%esp
+  802c8b:	6a 03                	push   $0x3
+  802c8d:	e8 68 0c 00 00       	call   8038fa <ipc_find_env>
+  802c92:	a3 f4 00 81 00       	mov    %eax,0x8100f4
+  802c97:	83 c4 10             	add    $0x10,%esp
+  802c9a:	eb cd                	jmp    802c69 <nsipc+0x12>
+
+00802c9c <nsipc_accept>:
+  802c9c:	55                   	push   %ebp
+  802c9d:	89 e5                	mov    %esp,%ebp
+  802c9f:	53                   	push   %ebx
+  802ca0:	83 ec 04             	sub    $0x4,%esp
+  802ca3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca6:	a3 00 20 81 00       	mov    %eax,0x812000
+  802cab:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cb0:	e8 a2 ff ff ff       	call   802c57 <nsipc>
+  802cb5:	89 c3                	mov    %eax,%ebx
+  802cb7:	85 c0                	test   %eax,%eax
+  802cb9:	79 07                	jns    802cc2 <nsipc_accept+0x26>
+  802cbb:	89 d8                	mov    %ebx,%eax
+  802cbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cc0:	c9                   	leave
+  802cc1:	c3                   	ret
+  802cc2:	83 ec 04             	sub    $0x4,%esp
+  802cc5:	ff 35 10 20 81 00    	push   0x812010
+  802ccb:	68 00 20 81 00       	push   $0x812000
+  802cd0:	ff 75 0c             	push   0xc(%ebp)
+  802cd3:	e8 1c e1 ff ff       	call   800df4 <memmove>
+  802cd8:	8b 15 10 20 81 00    	mov    0x812010,%edx
+  802cde:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ce1:	89 10                	mov    %edx,(%eax)
+  802ce3:	83 c4 10             	add    $0x10,%esp
+  802ce6:	eb d3                	jmp    802cbb <nsipc_accept+0x1f>
+
+00802ce8 <nsipc_bind>:
+  802ce8:	55                   	push   %ebp
+  802ce9:	89 e5                	mov    %esp,%ebp
+  802ceb:	53                   	push   %ebx
+  802cec:	83 ec 08             	sub    $0x8,%esp
+  802cef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf5:	a3 00 20 81 00       	mov    %eax,0x812000
+  802cfa:	53                   	push   %ebx
+  802cfb:	ff 75 0c             	push   0xc(%ebp)
+  802cfe:	68 04 20 81 00       	push   $0x812004
+  802d03:	e8 ec e0 ff ff       	call   800df4 <memmove>
+  802d08:	89 1d 14 20 81 00    	mov    %ebx,0x812014
+  802d0e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d13:	e8 3f ff ff ff       	call   802c57 <nsipc>
+  802d18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1b:	c9                   	leave
+  802d1c:	c3                   	ret
+
+00802d1d <nsipc_shutdown>:
+  802d1d:	55                   	push   %ebp
+  802d1e:	89 e5                	mov    %esp,%ebp
+  802d20:	83 ec 08             	sub    $0x8,%esp
+  802d23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d26:	a3 00 20 81 00       	mov    %eax,0x812000
+  802d2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d2e:	a3 04 20 81 00       	mov    %eax,0x812004
+  802d33:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d38:	e8 1a ff ff ff       	call   802c57 <nsipc>
+  802d3d:	c9                   	leave
+  802d3e:	c3                   	ret
+
+00802d3f <nsipc_close>:
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	83 ec 08             	sub    $0x8,%esp
+  802d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d48:	a3 00 20 81 00       	mov    %eax,0x812000
+  802d4d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d52:	e8 00 ff ff ff       	call   802c57 <nsipc>
+  802d57:	c9                   	leave
+  802d58:	c3                   	ret
+
+00802d59 <nsipc_connect>:
+  802d59:	55                   	push   %ebp
+  802d5a:	89 e5                	mov    %esp,%ebp
+  802d5c:	53                   	push   %ebx
+  802d5d:	83 ec 08             	sub    $0x8,%esp
+  802d60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d66:	a3 00 20 81 00       	mov    %eax,0x812000
+  802d6b:	53                   	push   %ebx
+  802d6c:	ff 75 0c             	push   0xc(%ebp)
+  802d6f:	68 04 20 81 00       	push   $0x812004
+  802d74:	e8 7b e0 ff ff       	call   800df4 <memmove>
+  802d79:	89 1d 14 20 81 00    	mov    %ebx,0x812014
+  802d7f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d84:	e8 ce fe ff ff       	call   802c57 <nsipc>
+  802d89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+00802d8e <nsipc_listen>:
+  802d8e:	55                   	push   %ebp
+  802d8f:	89 e5                	mov    %esp,%ebp
+  802d91:	83 ec 08             	sub    $0x8,%esp
+  802d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d97:	a3 00 20 81 00       	mov    %eax,0x812000
+  802d9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d9f:	a3 04 20 81 00       	mov    %eax,0x812004
+  802da4:	b8 06 00 00 00       	mov    $0x6,%eax
+  802da9:	e8 a9 fe ff ff       	call   802c57 <nsipc>
+  802dae:	c9                   	leave
+  802daf:	c3                   	ret
+
+00802db0 <nsipc_recv>:
+  802db0:	55                   	push   %ebp
+  802db1:	89 e5                	mov    %esp,%ebp
+  802db3:	56                   	push   %esi
+  802db4:	53                   	push   %ebx
+  802db5:	8b 75 10             	mov    0x10(%ebp),%esi
+  802db8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dbb:	a3 00 20 81 00       	mov    %eax,0x812000
+  802dc0:	89 35 04 20 81 00    	mov    %esi,0x812004
+  802dc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dc9:	a3 08 20 81 00       	mov    %eax,0x812008
+  802dce:	b8 07 00 00 00       	mov    $0x7,%eax
+  802dd3:	e8 7f fe ff ff       	call   802c57 <nsipc>
+  802dd8:	89 c3                	mov    %eax,%ebx
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	78 22                	js     802e00 <nsipc_recv+0x50>
+  802dde:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802de3:	39 c6                	cmp    %eax,%esi
+  802de5:	0f 4e c6             	cmovle %esi,%eax
+  802de8:	39 c3                	cmp    %eax,%ebx
+  802dea:	7f 1d                	jg     802e09 <nsipc_recv+0x59>
+  802dec:	83 ec 04             	sub    $0x4,%esp
+  802def:	53                   	push   %ebx
+  802df0:	68 00 20 81 00       	push   $0x812000
+  802df5:	ff 75 0c             	push   0xc(%ebp)
+  802df8:	e8 f7 df ff ff       	call   800df4 <memmove>
+  802dfd:	83 c4 10             	add    $0x10,%esp
+  802e00:	89 d8                	mov    %ebx,%eax
+  802e02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e05:	5b                   	pop    %ebx
+  802e06:	5e                   	pop    %esi
+  802e07:	5d                   	pop    %ebp
+  802e08:	c3                   	ret
+  802e09:	68 7c 41 80 00       	push   $0x80417c
+  802e0e:	68 91 41 80 00       	push   $0x804191
+  802e13:	6a 60                	push   $0x60
+  802e15:	68 a6 41 80 00       	push   $0x8041a6
+  802e1a:	e8 53 d6 ff ff       	call   800472 <_panic>
+
+00802e1f <nsipc_send>:
+  802e1f:	55                   	push   %ebp
+  802e20:	89 e5                	mov    %esp,%ebp
+  802e22:	53                   	push   %ebx
+  802e23:	83 ec 04             	sub    $0x4,%esp
+  802e26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2c:	a3 00 20 81 00       	mov    %eax,0x812000
+  802e31:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e37:	7f 2e                	jg     802e67 <nsipc_send+0x48>
+  802e39:	83 ec 04             	sub    $0x4,%esp
+  802e3c:	53                   	push   %ebx
+  802e3d:	ff 75 0c             	push   0xc(%ebp)
+  802e40:	68 0c 20 81 00       	push   $0x81200c
+  802e45:	e8 aa df ff ff       	call   800df4 <memmove>
+  802e4a:	89 1d 04 20 81 00    	mov    %ebx,0x812004
+  802e50:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e53:	a3 08 20 81 00       	mov    %eax,0x812008
+  802e58:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e5d:	e8 f5 fd ff ff       	call   802c57 <nsipc>
+  802e62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e65:	c9                   	leave
+  802e66:	c3                   	ret
+  802e67:	68 b2 41 80 00       	push   $0x8041b2
+  802e6c:	68 91 41 80 00       	push   $0x804191
+  802e71:	6a 6b                	push   $0x6b
+  802e73:	68 a6 41 80 00       	push   $0x8041a6
+  802e78:	e8 f5 d5 ff ff       	call   800472 <_panic>
+
+00802e7d <nsipc_socket>:
+  802e7d:	55                   	push   %ebp
+  802e7e:	89 e5                	mov    %esp,%ebp
+  802e80:	83 ec 08             	sub    $0x8,%esp
+  802e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e86:	a3 00 20 81 00       	mov    %eax,0x812000
+  802e8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e8e:	a3 04 20 81 00       	mov    %eax,0x812004
+  802e93:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e96:	a3 08 20 81 00       	mov    %eax,0x812008
+  802e9b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ea0:	e8 b2 fd ff ff       	call   802c57 <nsipc>
+  802ea5:	c9                   	leave
+  802ea6:	c3                   	ret
+
+00802ea7 <devpipe_stat>:
+  802ea7:	55                   	push   %ebp
+  802ea8:	89 e5                	mov    %esp,%ebp
+  802eaa:	56                   	push   %esi
+  802eab:	53                   	push   %ebx
+  802eac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802eaf:	83 ec 0c             	sub    $0xc,%esp
+  802eb2:	ff 75 08             	push   0x8(%ebp)
+  802eb5:	e8 99 ef ff ff       	call   801e53 <fd2data>
+  802eba:	89 c6                	mov    %eax,%esi
+  802ebc:	83 c4 08             	add    $0x8,%esp
+  802ebf:	68 be 41 80 00       	push   $0x8041be
+  802ec4:	53                   	push   %ebx
+  802ec5:	e8 7a dd ff ff       	call   800c44 <strcpy>
+  802eca:	8b 46 04             	mov    0x4(%esi),%eax
+  802ecd:	2b 06                	sub    (%esi),%eax
+  802ecf:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802ed5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802edc:	00 00 00 
+  802edf:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802ee6:	50 80 00 
+  802ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ef1:	5b                   	pop    %ebx
+  802ef2:	5e                   	pop    %esi
+  802ef3:	5d                   	pop    %ebp
+  802ef4:	c3                   	ret
+
+00802ef5 <devpipe_close>:
+  802ef5:	55                   	push   %ebp
+  802ef6:	89 e5                	mov    %esp,%ebp
+  802ef8:	53                   	push   %ebx
+  802ef9:	83 ec 0c             	sub    $0xc,%esp
+  802efc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802eff:	53                   	push   %ebx
+  802f00:	6a 00                	push   $0x0
+  802f02:	e8 6f e2 ff ff       	call   801176 <sys_page_unmap>
+  802f07:	89 1c 24             	mov    %ebx,(%esp)
+  802f0a:	e8 44 ef ff ff       	call   801e53 <fd2data>
+  802f0f:	83 c4 08             	add    $0x8,%esp
+  802f12:	50                   	push   %eax
+  802f13:	6a 00                	push   $0x0
+  802f15:	e8 5c e2 ff ff       	call   801176 <sys_page_unmap>
+  802f1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f1d:	c9                   	leave
+  802f1e:	c3                   	ret
+
+00802f1f <_pipeisclosed>:
+  802f1f:	55                   	push   %ebp
+  802f20:	89 e5                	mov    %esp,%ebp
+  802f22:	57                   	push   %edi
+  802f23:	56                   	push   %esi
+  802f24:	53                   	push   %ebx
+  802f25:	83 ec 1c             	sub    $0x1c,%esp
+  802f28:	89 c7                	mov    %eax,%edi
+  802f2a:	89 d6                	mov    %edx,%esi
+  802f2c:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  802f31:	8b 58 58             	mov    0x58(%eax),%ebx
+  802f34:	83 ec 0c             	sub    $0xc,%esp
+  802f37:	57                   	push   %edi
+  802f38:	e8 d7 09 00 00       	call   803914 <pageref>
+  802f3d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f40:	89 34 24             	mov    %esi,(%esp)
+  802f43:	e8 cc 09 00 00       	call   803914 <pageref>
+  802f48:	8b 15 f8 00 81 00    	mov    0x8100f8,%edx
+  802f4e:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802f51:	83 c4 10             	add    $0x10,%esp
+  802f54:	39 cb                	cmp    %ecx,%ebx
+  802f56:	74 1b                	je     802f73 <_pipeisclosed+0x54>
+  802f58:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f5b:	75 cf                	jne    802f2c <_pipeisclosed+0xd>
+  802f5d:	8b 42 58             	mov    0x58(%edx),%eax
+  802f60:	6a 01                	push   $0x1
+  802f62:	50                   	push   %eax
+  802f63:	53                   	push   %ebx
+  802f64:	68 c5 41 80 00       	push   $0x8041c5
+  802f69:	e8 df d5 ff ff       	call   80054d <cprintf>
+  802f6e:	83 c4 10             	add    $0x10,%esp
+  802f71:	eb b9                	jmp    802f2c <_pipeisclosed+0xd>
+  802f73:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f76:	0f 94 c0             	sete   %al
+  802f79:	0f b6 c0             	movzbl %al,%eax
+  802f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f7f:	5b                   	pop    %ebx
+  802f80:	5e                   	pop    %esi
+  802f81:	5f                   	pop    %edi
+  802f82:	5d                   	pop    %ebp
+  802f83:	c3                   	ret
+
+00802f84 <devpipe_write>:
+  802f84:	55                   	push   %ebp
+  802f85:	89 e5                	mov    %esp,%ebp
+  802f87:	57                   	push   %edi
+  802f88:	56                   	push   %esi
+  802f89:	53                   	push   %ebx
+  802f8a:	83 ec 28             	sub    $0x28,%esp
+  802f8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f90:	56                   	push   %esi
+  802f91:	e8 bd ee ff ff       	call   801e53 <fd2data>
+  802f96:	89 c3                	mov    %eax,%ebx
+  802f98:	83 c4 10             	add    $0x10,%esp
+  802f9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fa4:	74 5c                	je     803002 <devpipe_write+0x7e>
+  802fa6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fa9:	8b 0b                	mov    (%ebx),%ecx
+  802fab:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fae:	39 d0                	cmp    %edx,%eax
+  802fb0:	72 1e                	jb     802fd0 <devpipe_write+0x4c>
+  802fb2:	89 da                	mov    %ebx,%edx
+  802fb4:	89 f0                	mov    %esi,%eax
+  802fb6:	e8 64 ff ff ff       	call   802f1f <_pipeisclosed>
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	75 48                	jne    803007 <devpipe_write+0x83>
+  802fbf:	e8 95 e0 ff ff       	call   801059 <sys_yield>
+  802fc4:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fc7:	8b 0b                	mov    (%ebx),%ecx
+  802fc9:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fcc:	39 d0                	cmp    %edx,%eax
+  802fce:	73 e2                	jae    802fb2 <devpipe_write+0x2e>
+  802fd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fd3:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802fd7:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802fda:	89 c2                	mov    %eax,%edx
+  802fdc:	c1 fa 1f             	sar    $0x1f,%edx
+  802fdf:	89 d1                	mov    %edx,%ecx
+  802fe1:	c1 e9 1b             	shr    $0x1b,%ecx
+  802fe4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fe7:	83 e2 1f             	and    $0x1f,%edx
+  802fea:	29 ca                	sub    %ecx,%edx
+  802fec:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ff0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802ff4:	83 c0 01             	add    $0x1,%eax
+  802ff7:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ffa:	83 c7 01             	add    $0x1,%edi
+  802ffd:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803000:	75 a4                	jne    802fa6 <devpipe_write+0x22>
+  803002:	8b 45 10             	mov    0x10(%ebp),%eax
+  803005:	eb 05                	jmp    80300c <devpipe_write+0x88>
+  803007:	b8 00 00 00 00       	mov    $0x0,%eax
+  80300c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80300f:	5b                   	pop    %ebx
+  803010:	5e                   	pop    %esi
+  803011:	5f                   	pop    %edi
+  803012:	5d                   	pop    %ebp
+  803013:	c3                   	ret
+
+00803014 <devpipe_read>:
+  803014:	55                   	push   %ebp
+  803015:	89 e5                	mov    %esp,%ebp
+  803017:	57                   	push   %edi
+  803018:	56                   	push   %esi
+  803019:	53                   	push   %ebx
+  80301a:	83 ec 18             	sub    $0x18,%esp
+  80301d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803020:	56                   	push   %esi
+  803021:	e8 2d ee ff ff       	call   801e53 <fd2data>
+  803026:	89 c3                	mov    %eax,%ebx
+  803028:	83 c4 10             	add    $0x10,%esp
+  80302b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803030:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803034:	74 45                	je     80307b <devpipe_read+0x67>
+  803036:	8b 03                	mov    (%ebx),%eax
+  803038:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80303b:	75 1d                	jne    80305a <devpipe_read+0x46>
+  80303d:	85 ff                	test   %edi,%edi
+  80303f:	75 3f                	jne    803080 <devpipe_read+0x6c>
+  803041:	89 da                	mov    %ebx,%edx
+  803043:	89 f0                	mov    %esi,%eax
+  803045:	e8 d5 fe ff ff       	call   802f1f <_pipeisclosed>
+  80304a:	85 c0                	test   %eax,%eax
+  80304c:	75 3c                	jne    80308a <devpipe_read+0x76>
+  80304e:	e8 06 e0 ff ff       	call   801059 <sys_yield>
+  803053:	8b 03                	mov    (%ebx),%eax
+  803055:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803058:	74 e7                	je     803041 <devpipe_read+0x2d>
+  80305a:	99                   	cltd
+  80305b:	c1 ea 1b             	shr    $0x1b,%edx
+  80305e:	01 d0                	add    %edx,%eax
+  803060:	83 e0 1f             	and    $0x1f,%eax
+  803063:	29 d0                	sub    %edx,%eax
+  803065:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80306a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80306d:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  803070:	83 03 01             	addl   $0x1,(%ebx)
+  803073:	83 c7 01             	add    $0x1,%edi
+  803076:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803079:	75 bb                	jne    803036 <devpipe_read+0x22>
+  80307b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80307e:	eb 02                	jmp    803082 <devpipe_read+0x6e>
+  803080:	89 f8                	mov    %edi,%eax
+  803082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803085:	5b                   	pop    %ebx
+  803086:	5e                   	pop    %esi
+  803087:	5f                   	pop    %edi
+  803088:	5d                   	pop    %ebp
+  803089:	c3                   	ret
+  80308a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308f:	eb f1                	jmp    803082 <devpipe_read+0x6e>
+
+00803091 <pipe>:
+  803091:	55                   	push   %ebp
+  803092:	89 e5                	mov    %esp,%ebp
+  803094:	56                   	push   %esi
+  803095:	53                   	push   %ebx
+  803096:	83 ec 1c             	sub    $0x1c,%esp
+  803099:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80309c:	50                   	push   %eax
+  80309d:	e8 c8 ed ff ff       	call   801e6a <fd_alloc>
+  8030a2:	89 c3                	mov    %eax,%ebx
+  8030a4:	83 c4 10             	add    $0x10,%esp
+  8030a7:	85 c0                	test   %eax,%eax
+  8030a9:	0f 88 23 01 00 00    	js     8031d2 <pipe+0x141>
+  8030af:	83 ec 04             	sub    $0x4,%esp
+  8030b2:	68 07 04 00 00       	push   $0x407
+  8030b7:	ff 75 f4             	push   -0xc(%ebp)
+  8030ba:	6a 00                	push   $0x0
+  8030bc:	e8 e3 df ff ff       	call   8010a4 <sys_page_alloc>
+  8030c1:	89 c3                	mov    %eax,%ebx
+  8030c3:	83 c4 10             	add    $0x10,%esp
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	0f 88 04 01 00 00    	js     8031d2 <pipe+0x141>
+  8030ce:	83 ec 0c             	sub    $0xc,%esp
+  8030d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030d4:	50                   	push   %eax
+  8030d5:	e8 90 ed ff ff       	call   801e6a <fd_alloc>
+  8030da:	89 c3                	mov    %eax,%ebx
+  8030dc:	83 c4 10             	add    $0x10,%esp
+  8030df:	85 c0                	test   %eax,%eax
+  8030e1:	0f 88 db 00 00 00    	js     8031c2 <pipe+0x131>
+  8030e7:	83 ec 04             	sub    $0x4,%esp
+  8030ea:	68 07 04 00 00       	push   $0x407
+  8030ef:	ff 75 f0             	push   -0x10(%ebp)
+  8030f2:	6a 00                	push   $0x0
+  8030f4:	e8 ab df ff ff       	call   8010a4 <sys_page_alloc>
+  8030f9:	89 c3                	mov    %eax,%ebx
+  8030fb:	83 c4 10             	add    $0x10,%esp
+  8030fe:	85 c0                	test   %eax,%eax
+  803100:	0f 88 bc 00 00 00    	js     8031c2 <pipe+0x131>
+  803106:	83 ec 0c             	sub    $0xc,%esp
+  803109:	ff 75 f4             	push   -0xc(%ebp)
+  80310c:	e8 42 ed ff ff       	call   801e53 <fd2data>
+  803111:	89 c6                	mov    %eax,%esi
+  803113:	83 c4 0c             	add    $0xc,%esp
+  803116:	68 07 04 00 00       	push   $0x407
+  80311b:	50                   	push   %eax
+  80311c:	6a 00                	push   $0x0
+  80311e:	e8 81 df ff ff       	call   8010a4 <sys_page_alloc>
+  803123:	89 c3                	mov    %eax,%ebx
+  803125:	83 c4 10             	add    $0x10,%esp
+  803128:	85 c0                	test   %eax,%eax
+  80312a:	0f 88 82 00 00 00    	js     8031b2 <pipe+0x121>
+  803130:	83 ec 0c             	sub    $0xc,%esp
+  803133:	ff 75 f0             	push   -0x10(%ebp)
+  803136:	e8 18 ed ff ff       	call   801e53 <fd2data>
+  80313b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803142:	50                   	push   %eax
+  803143:	6a 00                	push   $0x0
+  803145:	56                   	push   %esi
+  803146:	6a 00                	push   $0x0
+  803148:	e8 9a df ff ff       	call   8010e7 <sys_page_map>
+  80314d:	89 c3                	mov    %eax,%ebx
+  80314f:	83 c4 20             	add    $0x20,%esp
+  803152:	85 c0                	test   %eax,%eax
+  803154:	78 4e                	js     8031a4 <pipe+0x113>
+  803156:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  80315b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80315e:	89 02                	mov    %eax,(%edx)
+  803160:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803163:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80316a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80316d:	89 02                	mov    %eax,(%edx)
+  80316f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803172:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803179:	83 ec 0c             	sub    $0xc,%esp
+  80317c:	ff 75 f4             	push   -0xc(%ebp)
+  80317f:	e8 bf ec ff ff       	call   801e43 <fd2num>
+  803184:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803187:	89 01                	mov    %eax,(%ecx)
+  803189:	83 c4 04             	add    $0x4,%esp
+  80318c:	ff 75 f0             	push   -0x10(%ebp)
+  80318f:	e8 af ec ff ff       	call   801e43 <fd2num>
+  803194:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803197:	89 41 04             	mov    %eax,0x4(%ecx)
+  80319a:	83 c4 10             	add    $0x10,%esp
+  80319d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031a2:	eb 2e                	jmp    8031d2 <pipe+0x141>
+  8031a4:	83 ec 08             	sub    $0x8,%esp
+  8031a7:	56                   	push   %esi
+  8031a8:	6a 00                	push   $0x0
+  8031aa:	e8 c7 df ff ff       	call   801176 <sys_page_unmap>
+  8031af:	83 c4 10             	add    $0x10,%esp
+  8031b2:	83 ec 08             	sub    $0x8,%esp
+  8031b5:	ff 75 f0             	push   -0x10(%ebp)
+  8031b8:	6a 00                	push   $0x0
+  8031ba:	e8 b7 df ff ff       	call   801176 <sys_page_unmap>
+  8031bf:	83 c4 10             	add    $0x10,%esp
+  8031c2:	83 ec 08             	sub    $0x8,%esp
+  8031c5:	ff 75 f4             	push   -0xc(%ebp)
+  8031c8:	6a 00                	push   $0x0
+  8031ca:	e8 a7 df ff ff       	call   801176 <sys_page_unmap>
+  8031cf:	83 c4 10             	add    $0x10,%esp
+  8031d2:	89 d8                	mov    %ebx,%eax
+  8031d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031d7:	5b                   	pop    %ebx
+  8031d8:	5e                   	pop    %esi
+  8031d9:	5d                   	pop    %ebp
+  8031da:	c3                   	ret
+
+008031db <pipeisclosed>:
+  8031db:	55                   	push   %ebp
+  8031dc:	89 e5                	mov    %esp,%ebp
+  8031de:	83 ec 20             	sub    $0x20,%esp
+  8031e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031e4:	50                   	push   %eax
+  8031e5:	ff 75 08             	push   0x8(%ebp)
+  8031e8:	e8 cd ec ff ff       	call   801eba <fd_lookup>
+  8031ed:	83 c4 10             	add    $0x10,%esp
+  8031f0:	85 c0                	test   %eax,%eax
+  8031f2:	78 18                	js     80320c <pipeisclosed+0x31>
+  8031f4:	83 ec 0c             	sub    $0xc,%esp
+  8031f7:	ff 75 f4             	push   -0xc(%ebp)
+  8031fa:	e8 54 ec ff ff       	call   801e53 <fd2data>
+  8031ff:	89 c2                	mov    %eax,%edx
+  803201:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803204:	e8 16 fd ff ff       	call   802f1f <_pipeisclosed>
+  803209:	83 c4 10             	add    $0x10,%esp
+  80320c:	c9                   	leave
+  80320d:	c3                   	ret
+
+0080320e <wait>:
+  80320e:	55                   	push   %ebp
+  80320f:	89 e5                	mov    %esp,%ebp
+  803211:	56                   	push   %esi
+  803212:	53                   	push   %ebx
+  803213:	8b 75 08             	mov    0x8(%ebp),%esi
+  803216:	85 f6                	test   %esi,%esi
+  803218:	74 40                	je     80325a <wait+0x4c>
+  80321a:	89 f3                	mov    %esi,%ebx
+  80321c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803222:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  803228:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80322d:	8b 40 48             	mov    0x48(%eax),%eax
+  803230:	39 c6                	cmp    %eax,%esi
+  803232:	75 1f                	jne    803253 <wait+0x45>
+  803234:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  80323a:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803240:	8b 43 54             	mov    0x54(%ebx),%eax
+  803243:	85 c0                	test   %eax,%eax
+  803245:	74 0c                	je     803253 <wait+0x45>
+  803247:	e8 0d de ff ff       	call   801059 <sys_yield>
+  80324c:	8b 43 48             	mov    0x48(%ebx),%eax
+  80324f:	39 f0                	cmp    %esi,%eax
+  803251:	74 ed                	je     803240 <wait+0x32>
+  803253:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803256:	5b                   	pop    %ebx
+  803257:	5e                   	pop    %esi
+  803258:	5d                   	pop    %ebp
+  803259:	c3                   	ret
+  80325a:	68 dd 41 80 00       	push   $0x8041dd
+  80325f:	68 91 41 80 00       	push   $0x804191
+  803264:	6a 09                	push   $0x9
+  803266:	68 e8 41 80 00       	push   $0x8041e8
+  80326b:	e8 02 d2 ff ff       	call   800472 <_panic>
+
+00803270 <ipcring_init>:
+  803270:	55                   	push   %ebp
+  803271:	89 e5                	mov    %esp,%ebp
+  803273:	53                   	push   %ebx
+  803274:	83 ec 08             	sub    $0x8,%esp
+  803277:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80327a:	6a 60                	push   $0x60
+  80327c:	6a 00                	push   $0x0
+  80327e:	53                   	push   %ebx
+  80327f:	e8 3b db ff ff       	call   800dbf <memset>
+  803284:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  803289:	8b 40 48             	mov    0x48(%eax),%eax
+  80328c:	89 03                	mov    %eax,(%ebx)
+  80328e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803291:	89 43 04             	mov    %eax,0x4(%ebx)
+  803294:	8b 45 10             	mov    0x10(%ebp),%eax
+  803297:	89 43 08             	mov    %eax,0x8(%ebx)
+  80329a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80329d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8032a0:	83 c4 10             	add    $0x10,%esp
+  8032a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a6:	c9                   	leave
+  8032a7:	c3                   	ret
+
+008032a8 <ipcring_req_slot>:
+  8032a8:	55                   	push   %ebp
+  8032a9:	89 e5                	mov    %esp,%ebp
+  8032ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ae:	8b 50 10             	mov    0x10(%eax),%edx
+  8032b1:	8b 48 18             	mov    0x18(%eax),%ecx
+  8032b4:	29 ca                	sub    %ecx,%edx
+  8032b6:	83 fa 07             	cmp    $0x7,%edx
+  8032b9:	77 0c                	ja     8032c7 <ipcring_req_slot+0x1f>
+  8032bb:	8b 50 10             	mov    0x10(%eax),%edx
+  8032be:	83 e2 07             	and    $0x7,%edx
+  8032c1:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  8032c5:	5d                   	pop    %ebp
+  8032c6:	c3                   	ret
+  8032c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cc:	eb f7                	jmp    8032c5 <ipcring_req_slot+0x1d>
+
+008032ce <ipcring_req_push>:
+  8032ce:	55                   	push   %ebp
+  8032cf:	89 e5                	mov    %esp,%ebp
+  8032d1:	83 ec 08             	sub    $0x8,%esp
+  8032d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8032d7:	8b 42 10             	mov    0x10(%edx),%eax
+  8032da:	83 c0 01             	add    $0x1,%eax
+  8032dd:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8032e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e6:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8032ea:	85 c0                	test   %eax,%eax
+  8032ec:	75 02                	jne    8032f0 <ipcring_req_push+0x22>
+  8032ee:	c9                   	leave
+  8032ef:	c3                   	ret
+  8032f0:	6a 00                	push   $0x0
+  8032f2:	68 00 00 80 ee       	push   $0xee800000
+  8032f7:	ff 72 08             	push   0x8(%edx)
+  8032fa:	ff 72 04             	push   0x4(%edx)
+  8032fd:	e8 da e0 ff ff       	call   8013dc <sys_ipc_send>
+  803302:	83 c4 10             	add    $0x10,%esp
+  803305:	eb e7                	jmp    8032ee <ipcring_req_push+0x20>
+
+00803307 <ipcring_rsp_wait>:
+  803307:	55                   	push   %ebp
+  803308:	89 e5                	mov    %esp,%ebp
+  80330a:	53                   	push   %ebx
+  80330b:	83 ec 04             	sub    $0x4,%esp
+  80330e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803311:	8b 53 18             	mov    0x18(%ebx),%edx
+  803314:	8b 43 10             	mov    0x10(%ebx),%eax
+  803317:	39 c2                	cmp    %eax,%edx
+  803319:	74 3c                	je     803357 <ipcring_rsp_wait+0x50>
+  80331b:	8b 53 14             	mov    0x14(%ebx),%edx
+  80331e:	8b 43 18             	mov    0x18(%ebx),%eax
+  803321:	39 c2                	cmp    %eax,%edx
+  803323:	75 23                	jne    803348 <ipcring_rsp_wait+0x41>
+  803325:	83 ec 08             	sub    $0x8,%esp
+  803328:	6a 00                	push   $0x0
+  80332a:	6a 00                	push   $0x0
+  80332c:	6a 00                	push   $0x0
+  80332e:	6a 00                	push   $0x0
+  803330:	ff 73 0c             	push   0xc(%ebx)
+  803333:	ff 73 04             	push   0x4(%ebx)
+  803336:	e8 24 04 00 00       	call   80375f <ipc_call>
+  80333b:	8b 53 14             	mov    0x14(%ebx),%edx
+  80333e:	8b 43 18             	mov    0x18(%ebx),%eax
+  803341:	83 c4 20             	add    $0x20,%esp
+  803344:	39 c2                	cmp    %eax,%edx
+  803346:	74 dd                	je     803325 <ipcring_rsp_wait+0x1e>
+  803348:	8b 43 18             	mov    0x18(%ebx),%eax
+  80334b:	83 e0 07             	and    $0x7,%eax
+  80334e:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803352:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803355:	c9                   	leave
+  803356:	c3                   	ret
+  803357:	68 f4 41 80 00       	push   $0x8041f4
+  80335c:	68 91 41 80 00       	push   $0x804191
+  803361:	6a 3b                	push   $0x3b
+  803363:	68 15 42 80 00       	push   $0x804215
+  803368:	e8 05 d1 ff ff       	call   800472 <_panic>
+
+0080336d <ipcring_rsp_pop>:
+  80336d:	55                   	push   %ebp
+  80336e:	89 e5                	mov    %esp,%ebp
+  803370:	8b 55 08             	mov    0x8(%ebp),%edx
+  803373:	8b 42 18             	mov    0x18(%edx),%eax
+  803376:	83 c0 01             	add    $0x1,%eax
+  803379:	89 42 18             	mov    %eax,0x18(%edx)
+  80337c:	5d                   	pop    %ebp
+  80337d:	c3                   	ret
+
+0080337e <ipcring_server_init>:
+  80337e:	55                   	push   %ebp
+  80337f:	89 e5                	mov    %esp,%ebp
+  803381:	8b 45 08             	mov    0x8(%ebp),%eax
+  803384:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803387:	89 10                	mov    %edx,(%eax)
+  803389:	8b 55 10             	mov    0x10(%ebp),%edx
+  80338c:	89 50 04             	mov    %edx,0x4(%eax)
+  80338f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803396:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80339d:	5d                   	pop    %ebp
+  80339e:	c3                   	ret
+
+0080339f <ipcring_req_avail>:
+  80339f:	55                   	push   %ebp
+  8033a0:	89 e5                	mov    %esp,%ebp
+  8033a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033a5:	8b 02                	mov    (%edx),%eax
+  8033a7:	8b 40 10             	mov    0x10(%eax),%eax
+  8033aa:	2b 42 08             	sub    0x8(%edx),%eax
+  8033ad:	ba 08 00 00 00       	mov    $0x8,%edx
+  8033b2:	39 d0                	cmp    %edx,%eax
+  8033b4:	0f 47 c2             	cmova  %edx,%eax
+  8033b7:	5d                   	pop    %ebp
+  8033b8:	c3                   	ret
+
+008033b9 <ipcring_req_peek>:
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033bf:	8b 42 08             	mov    0x8(%edx),%eax
+  8033c2:	83 e0 07             	and    $0x7,%eax
+  8033c5:	8b 12                	mov    (%edx),%edx
+  8033c7:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8033cb:	5d                   	pop    %ebp
+  8033cc:	c3                   	ret
+
+008033cd <ipcring_rsp_push>:
+  8033cd:	55                   	push   %ebp
+  8033ce:	89 e5                	mov    %esp,%ebp
+  8033d0:	83 ec 08             	sub    $0x8,%esp
+  8033d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033d6:	8b 41 08             	mov    0x8(%ecx),%eax
+  8033d9:	83 c0 01             	add    $0x1,%eax
+  8033dc:	89 41 08             	mov    %eax,0x8(%ecx)
+  8033df:	8b 11                	mov    (%ecx),%edx
+  8033e1:	83 c2 14             	add    $0x14,%edx
+  8033e4:	f0 87 02             	lock xchg %eax,(%edx)
+  8033e7:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8033eb:	75 02                	jne    8033ef <ipcring_rsp_push+0x22>
+  8033ed:	c9                   	leave
+  8033ee:	c3                   	ret
+  8033ef:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8033f6:	6a 00                	push   $0x0
+  8033f8:	68 00 00 80 ee       	push   $0xee800000
+  8033fd:	6a 00                	push   $0x0
+  8033ff:	ff 71 04             	push   0x4(%ecx)
+  803402:	e8 f8 de ff ff       	call   8012ff <sys_ipc_try_send>
+  803407:	83 c4 10             	add    $0x10,%esp
+  80340a:	eb e1                	jmp    8033ed <ipcring_rsp_push+0x20>
+
+0080340c <ipcring_client_wait>:
+  80340c:	55                   	push   %ebp
+  80340d:	89 e5                	mov    %esp,%ebp
+  80340f:	83 ec 08             	sub    $0x8,%esp
+  803412:	8b 45 08             	mov    0x8(%ebp),%eax
+  803415:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  80341c:	8b 10                	mov    (%eax),%edx
+  80341e:	8b 52 18             	mov    0x18(%edx),%edx
+  803421:	3b 50 08             	cmp    0x8(%eax),%edx
+  803424:	75 02                	jne    803428 <ipcring_client_wait+0x1c>
+  803426:	c9                   	leave
+  803427:	c3                   	ret
+  803428:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80342f:	6a 00                	push   $0x0
+  803431:	68 00 00 80 ee       	push   $0xee800000
+  803436:	6a 00                	push   $0x0
+  803438:	ff 70 04             	push   0x4(%eax)
+  80343b:	e8 bf de ff ff       	call   8012ff <sys_ipc_try_send>
+  803440:	83 c4 10             	add    $0x10,%esp
+  803443:	eb e1                	jmp    803426 <ipcring_client_wait+0x1a>
+
+00803445 <ipcring_server_sleep>:
+  803445:	55                   	push   %ebp
+  803446:	89 e5                	mov    %esp,%ebp
+  803448:	53                   	push   %ebx
+  803449:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80344c:	8b 01                	mov    (%ecx),%eax
+  80344e:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803451:	b8 01 00 00 00       	mov    $0x1,%eax
+  803456:	f0 87 02             	lock xchg %eax,(%edx)
+  803459:	8b 11                	mov    (%ecx),%edx
+  80345b:	8b 5a 10             	mov    0x10(%edx),%ebx
+  80345e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803463:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803466:	74 0e                	je     803476 <ipcring_server_sleep+0x31>
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346d:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803471:	b8 00 00 00 00       	mov    $0x0,%eax
+  803476:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803479:	c9                   	leave
+  80347a:	c3                   	ret
+
+0080347b <devcons_close>:
+  80347b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803480:	c3                   	ret
+
+00803481 <devcons_stat>:
+  803481:	55                   	push   %ebp
+  803482:	89 e5                	mov    %esp,%ebp
+  803484:	83 ec 10             	sub    $0x10,%esp
+  803487:	68 23 42 80 00       	push   $0x804223
+  80348c:	ff 75 0c             	push   0xc(%ebp)
+  80348f:	e8 b0 d7 ff ff       	call   800c44 <strcpy>
+  803494:	b8 00 00 00 00       	mov    $0x0,%eax
+  803499:	c9                   	leave
+  80349a:	c3                   	ret
+
+0080349b <devcons_write>:
+  80349b:	55                   	push   %ebp
+  80349c:	89 e5                	mov    %esp,%ebp
+  80349e:	57                   	push   %edi
+  80349f:	56                   	push   %esi
+  8034a0:	53                   	push   %ebx
+  8034a1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8034a7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8034aa:	85 ff                	test   %edi,%edi
+  8034ac:	74 51                	je     8034ff <devcons_write+0x64>
+  8034ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b8:	89 fb                	mov    %edi,%ebx
+  8034ba:	29 c3                	sub    %eax,%ebx
+  8034bc:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8034c1:	39 d3                	cmp    %edx,%ebx
+  8034c3:	0f 47 da             	cmova  %edx,%ebx
+  8034c6:	83 ec 04             	sub    $0x4,%esp
+  8034c9:	53                   	push   %ebx
+  8034ca:	03 45 0c             	add    0xc(%ebp),%eax
+  8034cd:	50                   	push   %eax
+  8034ce:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034d4:	50                   	push   %eax
+  8034d5:	e8 1a d9 ff ff       	call   800df4 <memmove>
+  8034da:	83 c4 08             	add    $0x8,%esp
+  8034dd:	53                   	push   %ebx
+  8034de:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034e4:	50                   	push   %eax
+  8034e5:	e8 d2 da ff ff       	call   800fbc <sys_cputs>
+  8034ea:	01 de                	add    %ebx,%esi
+  8034ec:	89 f0                	mov    %esi,%eax
+  8034ee:	83 c4 10             	add    $0x10,%esp
+  8034f1:	39 fe                	cmp    %edi,%esi
+  8034f3:	72 c3                	jb     8034b8 <devcons_write+0x1d>
+  8034f5:	89 f0                	mov    %esi,%eax
+  8034f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034fa:	5b                   	pop    %ebx
+  8034fb:	5e                   	pop    %esi
+  8034fc:	5f                   	pop    %edi
+  8034fd:	5d                   	pop    %ebp
+  8034fe:	c3                   	ret
+  8034ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803504:	eb ef                	jmp    8034f5 <devcons_write+0x5a>
+
+00803506 <devcons_read>:
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	83 ec 08             	sub    $0x8,%esp
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803511:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803515:	75 07                	jne    80351e <devcons_read+0x18>
+  803517:	eb 1f                	jmp    803538 <devcons_read+0x32>
+  803519:	e8 3b db ff ff       	call   801059 <sys_yield>
+  80351e:	e8 b7 da ff ff       	call   800fda <sys_cgetc>
+  803523:	85 c0                	test   %eax,%eax
+  803525:	74 f2                	je     803519 <devcons_read+0x13>
+  803527:	78 0f                	js     803538 <devcons_read+0x32>
+  803529:	83 f8 04             	cmp    $0x4,%eax
+  80352c:	74 0c                	je     80353a <devcons_read+0x34>
+  80352e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803531:	88 02                	mov    %al,(%edx)
+  803533:	b8 01 00 00 00       	mov    $0x1,%eax
+  803538:	c9                   	leave
+  803539:	c3                   	ret
+  80353a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353f:	eb f7                	jmp    803538 <devcons_read+0x32>
+
+00803541 <cputchar>:
+  803541:	55                   	push   %ebp
+  803542:	89 e5                	mov    %esp,%ebp
+  803544:	83 ec 20             	sub    $0x20,%esp
+  803547:	8b 45 08             	mov    0x8(%ebp),%eax
+  80354a:	88 45 f7             	mov    %al,-0x9(%ebp)
+  80354d:	6a 01                	push   $0x1
+  80354f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803552:	50                   	push   %eax
+  803553:	e8 64 da ff ff       	call   800fbc <sys_cputs>
+  803558:	83 c4 10             	add    $0x10,%esp
+  80355b:	c9                   	leave
+  80355c:	c3                   	ret
+
+0080355d <getchar>:
+  80355d:	55                   	push   %ebp
+  80355e:	89 e5                	mov    %esp,%ebp
+  803560:	83 ec 1c             	sub    $0x1c,%esp
+  803563:	6a 01                	push   $0x1
+  803565:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803568:	50                   	push   %eax
+  803569:	6a 00                	push   $0x0
+  80356b:	e8 ac eb ff ff       	call   80211c <read>
+  803570:	83 c4 10             	add    $0x10,%esp
+  803573:	85 c0                	test   %eax,%eax
+  803575:	78 06                	js     80357d <getchar+0x20>
+  803577:	74 06                	je     80357f <getchar+0x22>
+  803579:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  80357d:	c9                   	leave
+  80357e:	c3                   	ret
+  80357f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803584:	eb f7                	jmp    80357d <getchar+0x20>
+
+00803586 <iscons>:
+  803586:	55                   	push   %ebp
+  803587:	89 e5                	mov    %esp,%ebp
+  803589:	83 ec 20             	sub    $0x20,%esp
+  80358c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80358f:	50                   	push   %eax
+  803590:	ff 75 08             	push   0x8(%ebp)
+  803593:	e8 22 e9 ff ff       	call   801eba <fd_lookup>
+  803598:	83 c4 10             	add    $0x10,%esp
+  80359b:	85 c0                	test   %eax,%eax
+  80359d:	78 11                	js     8035b0 <iscons+0x2a>
+  80359f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035a2:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  8035a8:	39 10                	cmp    %edx,(%eax)
+  8035aa:	0f 94 c0             	sete   %al
+  8035ad:	0f b6 c0             	movzbl %al,%eax
+  8035b0:	c9                   	leave
+  8035b1:	c3                   	ret
+
+008035b2 <opencons>:
+  8035b2:	55                   	push   %ebp
+  8035b3:	89 e5                	mov    %esp,%ebp
+  8035b5:	83 ec 24             	sub    $0x24,%esp
+  8035b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035bb:	50                   	push   %eax
+  8035bc:	e8 a9 e8 ff ff       	call   801e6a <fd_alloc>
+  8035c1:	83 c4 10             	add    $0x10,%esp
+  8035c4:	85 c0                	test   %eax,%eax
+  8035c6:	78 3a                	js     803602 <opencons+0x50>
+  8035c8:	83 ec 04             	sub    $0x4,%esp
+  8035cb:	68 07 04 00 00       	push   $0x407
+  8035d0:	ff 75 f4             	push   -0xc(%ebp)
+  8035d3:	6a 00                	push   $0x0
+  8035d5:	e8 ca da ff ff       	call   8010a4 <sys_page_alloc>
+  8035da:	83 c4 10             	add    $0x10,%esp
+  8035dd:	85 c0                	test   %eax,%eax
+  8035df:	78 21                	js     803602 <opencons+0x50>
+  8035e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035e4:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  8035ea:	89 10                	mov    %edx,(%eax)
+  8035ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035ef:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8035f6:	83 ec 0c             	sub    $0xc,%esp
+  8035f9:	50                   	push   %eax
+  8035fa:	e8 44 e8 ff ff       	call   801e43 <fd2num>
+  8035ff:	83 c4 10             	add    $0x10,%esp
+  803602:	c9                   	leave
+  803603:	c3                   	ret
+
+00803604 <set_pgfault_handler>:
+  803604:	55                   	push   %ebp
+  803605:	89 e5                	mov    %esp,%ebp
+  803607:	53                   	push   %ebx
+  803608:	83 ec 04             	sub    $0x4,%esp
+  80360b:	83 3d 00 30 81 00 00 	cmpl   $0x0,0x813000
+  803612:	74 0d                	je     803621 <set_pgfault_handler+0x1d>
+  803614:	8b 45 08             	mov    0x8(%ebp),%eax
+  803617:	a3 00 30 81 00       	mov    %eax,0x813000
+  80361c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80361f:	c9                   	leave
+  803620:	c3                   	ret
+  803621:	e8 14 da ff ff       	call   80103a <sys_getenvid>
+  803626:	89 c3                	mov    %eax,%ebx
+  803628:	83 ec 04             	sub    $0x4,%esp
+  80362b:	6a 07                	push   $0x7
+  80362d:	68 00 f0 7f ee       	push   $0xee7ff000
+  803632:	50                   	push   %eax
+  803633:	e8 6c da ff ff       	call   8010a4 <sys_page_alloc>
+  803638:	83 c4 10             	add    $0x10,%esp
+  80363b:	85 c0                	test   %eax,%eax
+  80363d:	78 29                	js     803668 <set_pgfault_handler+0x64>
+  80363f:	83 ec 08             	sub    $0x8,%esp
+  803642:	68 7c 36 80 00       	push   $0x80367c
+  803647:	53                   	push   %ebx
+  803648:	e8 70 dc ff ff       	call   8012bd <sys_env_set_pgfault_upcall>
+  80364d:	83 c4 10             	add    $0x10,%esp
+  803650:	85 c0                	test   %eax,%eax
+  803652:	79 c0                	jns    803614 <set_pgfault_handler+0x10>
+  803654:	83 ec 04             	sub    $0x4,%esp
+  803657:	68 68 42 80 00       	push   $0x804268
+  80365c:	6a 27                	push   $0x27
+  80365e:	68 9a 42 80 00       	push   $0x80429a
+  803663:	e8 0a ce ff ff       	call   800472 <_panic>
+  803668:	83 ec 04             	sub    $0x4,%esp
+  80366b:	68 30 42 80 00       	push   $0x804230
+  803670:	6a 23                	push   $0x23
+  803672:	68 9a 42 80 00       	push   $0x80429a
+  803677:	e8 f6 cd ff ff       	call   800472 <_panic>
+
+0080367c <_pgfault_upcall>:
+  80367c:	54                   	push   %esp
+  80367d:	a1 00 30 81 00       	mov    0x813000,%eax
+  803682:	ff d0                	call   *%eax
+  803684:	83 c4 04             	add    $0x4,%esp
+  803687:	89 e3                	mov    %esp,%ebx
+  803689:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80368d:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803691:	89 d4                	mov    %edx,%esp
+  803693:	51                   	push   %ecx
+  803694:	89 dc                	mov    %ebx,%esp
+  803696:	83 ea 04             	sub    $0x4,%edx
+  803699:	89 54 24 30          	mov    %edx,0x30(%esp)
+  80369d:	83 c4 08             	add    $0x8,%esp
+  8036a0:	61                   	popa
+  8036a1:	83 c4 04             	add    $0x4,%esp
+  8036a4:	9d                   	popf
+  8036a5:	5c                   	pop    %esp
+  8036a6:	c3                   	ret
+
+008036a7 <ipc_recv>:
+  8036a7:	55                   	push   %ebp
+  8036a8:	89 e5                	mov    %esp,%ebp
+  8036aa:	56                   	push   %esi
+  8036ab:	53                   	push   %ebx
+  8036ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8036b5:	85 c0                	test   %eax,%eax
+  8036b7:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  8036bc:	0f 44 c2             	cmove  %edx,%eax
+  8036bf:	83 ec 0c             	sub    $0xc,%esp
+  8036c2:	50                   	push   %eax
+  8036c3:	e8 87 dc ff ff       	call   80134f <sys_ipc_recv>
+  8036c8:	83 c4 10             	add    $0x10,%esp
+  8036cb:	85 c0                	test   %eax,%eax
+  8036cd:	78 2a                	js     8036f9 <ipc_recv+0x52>
+  8036cf:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  8036d4:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8036da:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8036e0:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8036e6:	85 f6                	test   %esi,%esi
+  8036e8:	74 02                	je     8036ec <ipc_recv+0x45>
+  8036ea:	89 0e                	mov    %ecx,(%esi)
+  8036ec:	85 db                	test   %ebx,%ebx
+  8036ee:	74 02                	je     8036f2 <ipc_recv+0x4b>
+  8036f0:	89 13                	mov    %edx,(%ebx)
+  8036f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036f5:	5b                   	pop    %ebx
+  8036f6:	5e                   	pop    %esi
+  8036f7:	5d                   	pop    %ebp
+  8036f8:	c3                   	ret
+  8036f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803703:	eb e1                	jmp    8036e6 <ipc_recv+0x3f>
+
+00803705 <ipc_send>:
+  803705:	55                   	push   %ebp
+  803706:	89 e5                	mov    %esp,%ebp
+  803708:	57                   	push   %edi
+  803709:	56                   	push   %esi
+  80370a:	53                   	push   %ebx
+  80370b:	83 ec 0c             	sub    $0xc,%esp
+  80370e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803711:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803714:	8b 75 14             	mov    0x14(%ebp),%esi
+  803717:	85 db                	test   %ebx,%ebx
+  803719:	74 1e                	je     803739 <ipc_send+0x34>
+  80371b:	56                   	push   %esi
+  80371c:	53                   	push   %ebx
+  80371d:	57                   	push   %edi
+  80371e:	ff 75 08             	push   0x8(%ebp)
+  803721:	e8 b6 dc ff ff       	call   8013dc <sys_ipc_send>
+  803726:	83 c4 10             	add    $0x10,%esp
+  803729:	85 c0                	test   %eax,%eax
+  80372b:	74 2a                	je     803757 <ipc_send+0x52>
+  80372d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803730:	75 13                	jne    803745 <ipc_send+0x40>
+  803732:	e8 22 d9 ff ff       	call   801059 <sys_yield>
+  803737:	eb e2                	jmp    80371b <ipc_send+0x16>
+  803739:	be 00 00 00 00       	mov    $0x0,%esi
+  80373e:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803743:	eb d6                	jmp    80371b <ipc_send+0x16>
+  803745:	50                   	push   %eax
+  803746:	68 a8 42 80 00       	push   $0x8042a8
+  80374b:	6a 4f                	push   $0x4f
+  80374d:	68 eb 42 80 00       	push   $0x8042eb
+  803752:	e8 1b cd ff ff       	call   800472 <_panic>
+  803757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80375a:	5b                   	pop    %ebx
+  80375b:	5e                   	pop    %esi
+  80375c:	5f                   	pop    %edi
+  80375d:	5d                   	pop    %ebp
+  80375e:	c3                   	ret
+
+0080375f <ipc_call>:
+  80375f:	55                   	push   %ebp
+  803760:	89 e5                	mov    %esp,%ebp
+  803762:	57                   	push   %edi
+  803763:	56                   	push   %esi
+  803764:	53                   	push   %ebx
+  803765:	83 ec 0c             	sub    $0xc,%esp
+  803768:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80376c:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803771:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803775:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803779:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  80377e:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803782:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803786:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80378b:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  80378f:	eb 05                	jmp    803796 <ipc_call+0x37>
+  803791:	e8 c3 d8 ff ff       	call   801059 <sys_yield>
+  803796:	83 ec 0c             	sub    $0xc,%esp
+  803799:	56                   	push   %esi
+  80379a:	53                   	push   %ebx
+  80379b:	57                   	push   %edi
+  80379c:	ff 75 0c             	push   0xc(%ebp)
+  80379f:	ff 75 08             	push   0x8(%ebp)
+  8037a2:	e8 85 dc ff ff       	call   80142c <sys_ipc_call>
+  8037a7:	83 c4 20             	add    $0x20,%esp
+  8037aa:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037ad:	74 e2                	je     803791 <ipc_call+0x32>
+  8037af:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8037b2:	74 2d                	je     8037e1 <ipc_call+0x82>
+  8037b4:	85 c0                	test   %eax,%eax
+  8037b6:	78 4f                	js     803807 <ipc_call+0xa8>
+  8037b8:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8037bc:	74 10                	je     8037ce <ipc_call+0x6f>
+  8037be:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  8037c3:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8037c9:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8037cc:	89 02                	mov    %eax,(%edx)
+  8037ce:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  8037d3:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8037d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037dc:	5b                   	pop    %ebx
+  8037dd:	5e                   	pop    %esi
+  8037de:	5f                   	pop    %edi
+  8037df:	5d                   	pop    %ebp
+  8037e0:	c3                   	ret
+  8037e1:	ff 75 14             	push   0x14(%ebp)
+  8037e4:	ff 75 10             	push   0x10(%ebp)
+  8037e7:	ff 75 0c             	push   0xc(%ebp)
+  8037ea:	ff 75 08             	push   0x8(%ebp)
+  8037ed:	e8 13 ff ff ff       	call   803705 <ipc_send>
+  8037f2:	83 c4 0c             	add    $0xc,%esp
+  8037f5:	ff 75 1c             	push   0x1c(%ebp)
+  8037f8:	ff 75 18             	push   0x18(%ebp)
+  8037fb:	6a 00                	push   $0x0
+  8037fd:	e8 a5 fe ff ff       	call   8036a7 <ipc_recv>
+  803802:	83 c4 10             	add    $0x10,%esp
+  803805:	eb d2                	jmp    8037d9 <ipc_call+0x7a>
+  803807:	50                   	push   %eax
+  803808:	68 f5 42 80 00       	push   $0x8042f5
+  80380d:	6a 6d                	push   $0x6d
+  80380f:	68 eb 42 80 00       	push   $0x8042eb
+  803814:	e8 59 cc ff ff       	call   800472 <_panic>
+
+00803819 <ipc_reply_recv>:
+  803819:	55                   	push   %ebp
+  80381a:	89 e5                	mov    %esp,%ebp
+  80381c:	57                   	push   %edi
+  80381d:	56                   	push   %esi
+  80381e:	53                   	push   %ebx
+  80381f:	83 ec 0c             	sub    $0xc,%esp
+  803822:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803825:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803828:	8b 7d 20             	mov    0x20(%ebp),%edi
+  80382b:	85 db                	test   %ebx,%ebx
+  80382d:	0f 84 ac 00 00 00    	je     8038df <ipc_reply_recv+0xc6>
+  803833:	85 f6                	test   %esi,%esi
+  803835:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80383a:	0f 45 c6             	cmovne %esi,%eax
+  80383d:	83 ec 0c             	sub    $0xc,%esp
+  803840:	50                   	push   %eax
+  803841:	ff 75 14             	push   0x14(%ebp)
+  803844:	53                   	push   %ebx
+  803845:	ff 75 0c             	push   0xc(%ebp)
+  803848:	ff 75 08             	push   0x8(%ebp)
+  80384b:	e8 fd db ff ff       	call   80144d <sys_ipc_reply_recv>
+  803850:	83 c4 20             	add    $0x20,%esp
+  803853:	85 c0                	test   %eax,%eax
+  803855:	78 3a                	js     803891 <ipc_reply_recv+0x78>
+  803857:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80385b:	74 10                	je     80386d <ipc_reply_recv+0x54>
+  80385d:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  803862:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803868:	8b 55 18             	mov    0x18(%ebp),%edx
+  80386b:	89 02                	mov    %eax,(%edx)
+  80386d:	85 ff                	test   %edi,%edi
+  80386f:	74 0d                	je     80387e <ipc_reply_recv+0x65>
+  803871:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  803876:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80387c:	89 07                	mov    %eax,(%edi)
+  80387e:	a1 f8 00 81 00       	mov    0x8100f8,%eax
+  803883:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80388c:	5b                   	pop    %ebx
+  80388d:	5e                   	pop    %esi
+  80388e:	5f                   	pop    %edi
+  80388f:	5d                   	pop    %ebp
+  803890:	c3                   	ret
+  803891:	ff 75 14             	push   0x14(%ebp)
+  803894:	53                   	push   %ebx
+  803895:	ff 75 0c             	push   0xc(%ebp)
+  803898:	ff 75 08             	push   0x8(%ebp)
+  80389b:	e8 5f da ff ff       	call   8012ff <sys_ipc_try_send>
+  8038a0:	89 c2                	mov    %eax,%edx
+  8038a2:	c1 ea 1f             	shr    $0x1f,%edx
+  8038a5:	83 c4 10             	add    $0x10,%esp
+  8038a8:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8038ab:	0f 95 c1             	setne  %cl
+  8038ae:	84 d1                	test   %dl,%cl
+  8038b0:	74 05                	je     8038b7 <ipc_reply_recv+0x9e>
+  8038b2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8038b5:	75 12                	jne    8038c9 <ipc_reply_recv+0xb0>
+  8038b7:	83 ec 04             	sub    $0x4,%esp
+  8038ba:	57                   	push   %edi
+  8038bb:	56                   	push   %esi
+  8038bc:	ff 75 18             	push   0x18(%ebp)
+  8038bf:	e8 e3 fd ff ff       	call   8036a7 <ipc_recv>
+  8038c4:	83 c4 10             	add    $0x10,%esp
+  8038c7:	eb c0                	jmp    803889 <ipc_reply_recv+0x70>
+  8038c9:	83 ec 04             	sub    $0x4,%esp
+  8038cc:	50                   	push   %eax
+  8038cd:	ff 75 08             	push   0x8(%ebp)
+  8038d0:	68 c8 42 80 00       	push   $0x8042c8
+  8038d5:	e8 73 cc ff ff       	call   80054d <cprintf>
+  8038da:	83 c4 10             	add    $0x10,%esp
+  8038dd:	eb d8                	jmp    8038b7 <ipc_reply_recv+0x9e>
+  8038df:	85 f6                	test   %esi,%esi
+  8038e1:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8038e6:	0f 45 c6             	cmovne %esi,%eax
+  8038e9:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8038ee:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8038f5:	e9 43 ff ff ff       	jmp    80383d <ipc_reply_recv+0x24>
+
+008038fa <ipc_find_env>:
+  8038fa:	55                   	push   %ebp
+  8038fb:	89 e5                	mov    %esp,%ebp
+  8038fd:	83 ec 14             	sub    $0x14,%esp
+  803900:	ff 75 08             	push   0x8(%ebp)
+  803903:	e8 95 d9 ff ff       	call   80129d <sys_env_service>
+  803908:	85 c0                	test   %eax,%eax
+  80390a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80390f:	0f 48 c2             	cmovs  %edx,%eax
+  803912:	c9                   	leave
+  803913:	c3                   	ret
+
+00803914 <pageref>:
+  803914:	55                   	push   %ebp
+  803915:	89 e5                	mov    %esp,%ebp
+  803917:	8b 45 08             	mov    0x8(%ebp),%eax
+  80391a:	89 c2                	mov    %eax,%edx
+  80391c:	c1 ea 16             	shr    $0x16,%edx
+  80391f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803926:	ba 00 00 00 00       	mov    $0x0,%edx
+  80392b:	f6 c1 01             	test   $0x1,%cl
+  80392e:	74 22                	je     803952 <pageref+0x3e>
+  803930:	c1 e8 0c             	shr    $0xc,%eax
+  803933:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80393a:	a8 01                	test   $0x1,%al
+  80393c:	74 14                	je     803952 <pageref+0x3e>
+  80393e:	c1 e8 0c             	shr    $0xc,%eax
+  803941:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803944:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80394b:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  80394f:	0f b7 d2             	movzwl %dx,%edx
+  803952:	89 d0                	mov    %edx,%eax
+  803954:	5d                   	pop    %ebp
+  803955:	c3                   	ret
+
+00803956 <__udivmoddi4>:
+  803956:	55                   	push   %ebp
+  803957:	57                   	push   %edi
+  803958:	56                   	push   %esi
+  803959:	53                   	push   %ebx
+  80395a:	83 ec 24             	sub    $0x24,%esp
+  80395d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803961:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803965:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803969:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80396d:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803971:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803975:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803979:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80397d:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803981:	b8 00 00 00 00       	mov    $0x0,%eax
+  803986:	ba 00 00 00 00       	mov    $0x0,%edx
+  80398b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803990:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803997:	00 
+  803998:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80399f:	00 
+  8039a0:	89 fb                	mov    %edi,%ebx
+  8039a2:	eb 08                	jmp    8039ac <__udivmoddi4+0x56>
+  8039a4:	83 e9 01             	sub    $0x1,%ecx
+  8039a7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039aa:	74 68                	je     803a14 <__udivmoddi4+0xbe>
+  8039ac:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8039b0:	01 c0                	add    %eax,%eax
+  8039b2:	89 c6                	mov    %eax,%esi
+  8039b4:	89 d7                	mov    %edx,%edi
+  8039b6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039ba:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039be:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039c1:	d3 ea                	shr    %cl,%edx
+  8039c3:	f6 c1 20             	test   $0x20,%cl
+  8039c6:	74 04                	je     8039cc <__udivmoddi4+0x76>
+  8039c8:	89 d0                	mov    %edx,%eax
+  8039ca:	31 d2                	xor    %edx,%edx
+  8039cc:	83 e0 01             	and    $0x1,%eax
+  8039cf:	89 04 24             	mov    %eax,(%esp)
+  8039d2:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8039d9:	00 
+  8039da:	8b 04 24             	mov    (%esp),%eax
+  8039dd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039e1:	09 f0                	or     %esi,%eax
+  8039e3:	09 fa                	or     %edi,%edx
+  8039e5:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039e9:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039ed:	39 f0                	cmp    %esi,%eax
+  8039ef:	89 d5                	mov    %edx,%ebp
+  8039f1:	19 fd                	sbb    %edi,%ebp
+  8039f3:	72 af                	jb     8039a4 <__udivmoddi4+0x4e>
+  8039f5:	29 f0                	sub    %esi,%eax
+  8039f7:	19 fa                	sbb    %edi,%edx
+  8039f9:	89 cf                	mov    %ecx,%edi
+  8039fb:	c1 ef 05             	shr    $0x5,%edi
+  8039fe:	83 e7 01             	and    $0x1,%edi
+  803a01:	89 fe                	mov    %edi,%esi
+  803a03:	83 f6 01             	xor    $0x1,%esi
+  803a06:	d3 e6                	shl    %cl,%esi
+  803a08:	d3 e7                	shl    %cl,%edi
+  803a0a:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a0e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a12:	eb 90                	jmp    8039a4 <__udivmoddi4+0x4e>
+  803a14:	85 db                	test   %ebx,%ebx
+  803a16:	74 05                	je     803a1d <__udivmoddi4+0xc7>
+  803a18:	89 03                	mov    %eax,(%ebx)
+  803a1a:	89 53 04             	mov    %edx,0x4(%ebx)
+  803a1d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a21:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a25:	83 c4 24             	add    $0x24,%esp
+  803a28:	5b                   	pop    %ebx
+  803a29:	5e                   	pop    %esi
+  803a2a:	5f                   	pop    %edi
+  803a2b:	5d                   	pop    %ebp
+  803a2c:	c3                   	ret
+
+00803a2d <__udivdi3>:
+  803a2d:	83 ec 08             	sub    $0x8,%esp
+  803a30:	6a 00                	push   $0x0
+  803a32:	ff 74 24 1c          	push   0x1c(%esp)
+  803a36:	ff 74 24 1c          	push   0x1c(%esp)
+  803a3a:	ff 74 24 1c          	push   0x1c(%esp)
+  803a3e:	ff 74 24 1c          	push   0x1c(%esp)
+  803a42:	e8 0f ff ff ff       	call   803956 <__udivmoddi4>
+  803a47:	83 c4 1c             	add    $0x1c,%esp
+  803a4a:	c3                   	ret
+
+00803a4b <__umoddi3>:
+  803a4b:	83 ec 18             	sub    $0x18,%esp
+  803a4e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a52:	50                   	push   %eax
+  803a53:	ff 74 24 2c          	push   0x2c(%esp)
+  803a57:	ff 74 24 2c          	push   0x2c(%esp)
+  803a5b:	ff 74 24 2c          	push   0x2c(%esp)
+  803a5f:	ff 74 24 2c          	push   0x2c(%esp)
+  803a63:	e8 ee fe ff ff       	call   803956 <__udivmoddi4>
+  803a68:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803a6c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803a70:	83 c4 2c             	add    $0x2c,%esp
+  803a73:	c3                   	ret
+
+00803a74 <__divdi3>:
+  803a74:	53                   	push   %ebx
+  803a75:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a79:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a7d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a81:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a85:	85 d2                	test   %edx,%edx
+  803a87:	78 12                	js     803a9b <__divdi3+0x27>
+  803a89:	85 db                	test   %ebx,%ebx
+  803a8b:	78 2e                	js     803abb <__divdi3+0x47>
+  803a8d:	53                   	push   %ebx
+  803a8e:	51                   	push   %ecx
+  803a8f:	52                   	push   %edx
+  803a90:	50                   	push   %eax
+  803a91:	e8 97 ff ff ff       	call   803a2d <__udivdi3>
+  803a96:	83 c4 10             	add    $0x10,%esp
+  803a99:	eb 1e                	jmp    803ab9 <__divdi3+0x45>
+  803a9b:	f7 d8                	neg    %eax
+  803a9d:	83 d2 00             	adc    $0x0,%edx
+  803aa0:	f7 da                	neg    %edx
+  803aa2:	85 db                	test   %ebx,%ebx
+  803aa4:	78 2a                	js     803ad0 <__divdi3+0x5c>
+  803aa6:	53                   	push   %ebx
+  803aa7:	51                   	push   %ecx
+  803aa8:	52                   	push   %edx
+  803aa9:	50                   	push   %eax
+  803aaa:	e8 7e ff ff ff       	call   803a2d <__udivdi3>
+  803aaf:	83 c4 10             	add    $0x10,%esp
+  803ab2:	f7 d8                	neg    %eax
+  803ab4:	83 d2 00             	adc    $0x0,%edx
+  803ab7:	f7 da                	neg    %edx
+  803ab9:	5b                   	pop    %ebx
+  803aba:	c3                   	ret
+  803abb:	f7 d9                	neg    %ecx
+  803abd:	83 d3 00             	adc    $0x0,%ebx
+  803ac0:	f7 db                	neg    %ebx
+  803ac2:	53                   	push   %ebx
+  803ac3:	51                   	push   %ecx
+  803ac4:	52                   	push   %edx
+  803ac5:	50                   	push   %eax
+  803ac6:	e8 62 ff ff ff       	call   803a2d <__udivdi3>
+  803acb:	83 c4 10             	add    $0x10,%esp
+  803ace:	eb e2                	jmp    803ab2 <__divdi3+0x3e>
+  803ad0:	f7 d9                	neg    %ecx
+  803ad2:	83 d3 00             	adc    $0x0,%ebx
+  803ad5:	f7 db                	neg    %ebx
+  803ad7:	53                   	push   %ebx
+  803ad8:	51                   	push   %ecx
+  803ad9:	52                   	push   %edx
+  803ada:	50                   	push   %eax
+  803adb:	e8 4d ff ff ff       	call   803a2d <__udivdi3>
+  803ae0:	83 c4 10             	add    $0x10,%esp
+  803ae3:	eb d4                	jmp    803ab9 <__divdi3+0x45>
+
+00803ae5 <__moddi3>:
+  803ae5:	55                   	push   %ebp
+  803ae6:	57                   	push   %edi
+  803ae7:	56                   	push   %esi
+  803ae8:	53                   	push   %ebx
+  803ae9:	83 ec 0c             	sub    $0xc,%esp
+  803aec:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803af0:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803af4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803af8:	89 e9                	mov    %ebp,%ecx
+  803afa:	f7 d9                	neg    %ecx
+  803afc:	89 d0                	mov    %edx,%eax
+  803afe:	83 d0 00             	adc    $0x0,%eax
+  803b01:	f7 d8                	neg    %eax
+  803b03:	0f 49 e9             	cmovns %ecx,%ebp
+  803b06:	0f 49 d0             	cmovns %eax,%edx
+  803b09:	52                   	push   %edx
+  803b0a:	55                   	push   %ebp
+  803b0b:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803b0f:	f7 da                	neg    %edx
+  803b11:	89 d8                	mov    %ebx,%eax
+  803b13:	83 d0 00             	adc    $0x0,%eax
+  803b16:	f7 d8                	neg    %eax
+  803b18:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803b1d:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803b21:	0f 48 c3             	cmovs  %ebx,%eax
+  803b24:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803b28:	ff 74 24 0c          	push   0xc(%esp)
+  803b2c:	ff 74 24 0c          	push   0xc(%esp)
+  803b30:	e8 16 ff ff ff       	call   803a4b <__umoddi3>
+  803b35:	83 c4 10             	add    $0x10,%esp
+  803b38:	85 db                	test   %ebx,%ebx
+  803b3a:	78 08                	js     803b44 <__moddi3+0x5f>
+  803b3c:	83 c4 0c             	add    $0xc,%esp
+  803b3f:	5b                   	pop    %ebx
+  803b40:	5e                   	pop    %esi
+  803b41:	5f                   	pop    %edi
+  803b42:	5d                   	pop    %ebp
+  803b43:	c3                   	ret
+  803b44:	f7 d8                	neg    %eax
+  803b46:	83 d2 00             	adc    $0x0,%edx
+  803b49:	f7 da                	neg    %edx
+  803b4b:	eb ef                	jmp    803b3c <__moddi3+0x57>
@@ -0,0 +1,5279 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 3d 02 00 00       	call   80026e <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	bb 0a 00 00 00       	mov    $0xa,%ebx
+  80003f:	e8 7a 0f 00 00       	call   800fbe <sys_yield>
+  800044:	83 eb 01             	sub    $0x1,%ebx
+  800047:	75 f6                	jne    80003f <umain+0xc>
+  800049:	83 ec 0c             	sub    $0xc,%esp
+  80004c:	6a 00                	push   $0x0
+  80004e:	e8 c1 19 00 00       	call   801a14 <close>
+  800053:	e8 c4 01 00 00       	call   80021c <opencons>
+  800058:	83 c4 10             	add    $0x10,%esp
+  80005b:	85 c0                	test   %eax,%eax
+  80005d:	78 14                	js     800073 <umain+0x40>
+  80005f:	74 24                	je     800085 <umain+0x52>
+  800061:	50                   	push   %eax
+  800062:	68 3c 34 80 00       	push   $0x80343c
+  800067:	6a 11                	push   $0x11
+  800069:	68 2d 34 80 00       	push   $0x80342d
+  80006e:	e8 74 02 00 00       	call   8002e7 <_panic>
+  800073:	50                   	push   %eax
+  800074:	68 20 34 80 00       	push   $0x803420
+  800079:	6a 0f                	push   $0xf
+  80007b:	68 2d 34 80 00       	push   $0x80342d
+  800080:	e8 62 02 00 00       	call   8002e7 <_panic>
+  800085:	83 ec 08             	sub    $0x8,%esp
+  800088:	6a 01                	push   $0x1
+  80008a:	6a 00                	push   $0x0
+  80008c:	e8 d5 19 00 00       	call   801a66 <dup>
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	79 25                	jns    8000bd <umain+0x8a>
+  800098:	50                   	push   %eax
+  800099:	68 56 34 80 00       	push   $0x803456
+  80009e:	6a 13                	push   $0x13
+  8000a0:	68 2d 34 80 00       	push   $0x80342d
+  8000a5:	e8 3d 02 00 00       	call   8002e7 <_panic>
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	50                   	push   %eax
+  8000ae:	68 6c 34 80 00       	push   $0x80346c
+  8000b3:	6a 01                	push   $0x1
+  8000b5:	e8 ad 24 00 00       	call   802567 <fprintf>
+  8000ba:	83 c4 10             	add    $0x10,%esp
+  8000bd:	83 ec 0c             	sub    $0xc,%esp
+  8000c0:	68 5e 34 80 00       	push   $0x80345e
+  8000c5:	e8 a3 09 00 00       	call   800a6d <readline>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+  8000cd:	85 c0                	test   %eax,%eax
+  8000cf:	75 d9                	jne    8000aa <umain+0x77>
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	68 70 34 80 00       	push   $0x803470
+  8000d9:	6a 01                	push   $0x1
+  8000db:	e8 87 24 00 00       	call   802567 <fprintf>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	eb d8                	jmp    8000bd <umain+0x8a>
+
+008000e5 <devcons_close>:
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	c3                   	ret
+
+008000eb <devcons_stat>:
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	83 ec 10             	sub    $0x10,%esp
+  8000f1:	68 88 34 80 00       	push   $0x803488
+  8000f6:	ff 75 0c             	push   0xc(%ebp)
+  8000f9:	e8 ab 0a 00 00       	call   800ba9 <strcpy>
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	c9                   	leave
+  800104:	c3                   	ret
+
+00800105 <devcons_write>:
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	57                   	push   %edi
+  800109:	56                   	push   %esi
+  80010a:	53                   	push   %ebx
+  80010b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  800111:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800114:	85 ff                	test   %edi,%edi
+  800116:	74 51                	je     800169 <devcons_write+0x64>
+  800118:	be 00 00 00 00       	mov    $0x0,%esi
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800122:	89 fb                	mov    %edi,%ebx
+  800124:	29 c3                	sub    %eax,%ebx
+  800126:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80012b:	39 d3                	cmp    %edx,%ebx
+  80012d:	0f 47 da             	cmova  %edx,%ebx
+  800130:	83 ec 04             	sub    $0x4,%esp
+  800133:	53                   	push   %ebx
+  800134:	03 45 0c             	add    0xc(%ebp),%eax
+  800137:	50                   	push   %eax
+  800138:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80013e:	50                   	push   %eax
+  80013f:	e8 15 0c 00 00       	call   800d59 <memmove>
+  800144:	83 c4 08             	add    $0x8,%esp
+  800147:	53                   	push   %ebx
+  800148:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80014e:	50                   	push   %eax
+  80014f:	e8 cd 0d 00 00       	call   800f21 <sys_cputs>
+  800154:	01 de                	add    %ebx,%esi
+  800156:	89 f0                	mov    %esi,%eax
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	39 fe                	cmp    %edi,%esi
+  80015d:	72 c3                	jb     800122 <devcons_write+0x1d>
+  80015f:	89 f0                	mov    %esi,%eax
+  800161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800164:	5b                   	pop    %ebx
+  800165:	5e                   	pop    %esi
+  800166:	5f                   	pop    %edi
+  800167:	5d                   	pop    %ebp
+  800168:	c3                   	ret
+  800169:	be 00 00 00 00       	mov    $0x0,%esi
+  80016e:	eb ef                	jmp    80015f <devcons_write+0x5a>
+
+00800170 <devcons_read>:
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	83 ec 08             	sub    $0x8,%esp
+  800176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80017f:	75 07                	jne    800188 <devcons_read+0x18>
+  800181:	eb 1f                	jmp    8001a2 <devcons_read+0x32>
+  800183:	e8 36 0e 00 00       	call   800fbe <sys_yield>
+  800188:	e8 b2 0d 00 00       	call   800f3f <sys_cgetc>
+  80018d:	85 c0                	test   %eax,%eax
+  80018f:	74 f2                	je     800183 <devcons_read+0x13>
+  800191:	78 0f                	js     8001a2 <devcons_read+0x32>
+  800193:	83 f8 04             	cmp    $0x4,%eax
+  800196:	74 0c                	je     8001a4 <devcons_read+0x34>
+  800198:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80019b:	88 02                	mov    %al,(%edx)
+  80019d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001a2:	c9                   	leave
+  8001a3:	c3                   	ret
+  8001a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a9:	eb f7                	jmp    8001a2 <devcons_read+0x32>
+
+008001ab <cputchar>:
+  8001ab:	55                   	push   %ebp
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	83 ec 20             	sub    $0x20,%esp
+  8001b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b4:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8001b7:	6a 01                	push   $0x1
+  8001b9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bc:	50                   	push   %eax
+  8001bd:	e8 5f 0d 00 00       	call   800f21 <sys_cputs>
+  8001c2:	83 c4 10             	add    $0x10,%esp
+  8001c5:	c9                   	leave
+  8001c6:	c3                   	ret
+
+008001c7 <getchar>:
+  8001c7:	55                   	push   %ebp
+  8001c8:	89 e5                	mov    %esp,%ebp
+  8001ca:	83 ec 1c             	sub    $0x1c,%esp
+  8001cd:	6a 01                	push   $0x1
+  8001cf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001d2:	50                   	push   %eax
+  8001d3:	6a 00                	push   $0x0
+  8001d5:	e8 76 19 00 00       	call   801b50 <read>
+  8001da:	83 c4 10             	add    $0x10,%esp
+  8001dd:	85 c0                	test   %eax,%eax
+  8001df:	78 06                	js     8001e7 <getchar+0x20>
+  8001e1:	74 06                	je     8001e9 <getchar+0x22>
+  8001e3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8001e7:	c9                   	leave
+  8001e8:	c3                   	ret
+  8001e9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001ee:	eb f7                	jmp    8001e7 <getchar+0x20>
+
+008001f0 <iscons>:
+  8001f0:	55                   	push   %ebp
+  8001f1:	89 e5                	mov    %esp,%ebp
+  8001f3:	83 ec 20             	sub    $0x20,%esp
+  8001f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001f9:	50                   	push   %eax
+  8001fa:	ff 75 08             	push   0x8(%ebp)
+  8001fd:	e8 ec 16 00 00       	call   8018ee <fd_lookup>
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	85 c0                	test   %eax,%eax
+  800207:	78 11                	js     80021a <iscons+0x2a>
+  800209:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80020c:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  800212:	39 10                	cmp    %edx,(%eax)
+  800214:	0f 94 c0             	sete   %al
+  800217:	0f b6 c0             	movzbl %al,%eax
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+0080021c <opencons>:
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	83 ec 24             	sub    $0x24,%esp
+  800222:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800225:	50                   	push   %eax
+  800226:	e8 73 16 00 00       	call   80189e <fd_alloc>
+  80022b:	83 c4 10             	add    $0x10,%esp
+  80022e:	85 c0                	test   %eax,%eax
+  800230:	78 3a                	js     80026c <opencons+0x50>
+  800232:	83 ec 04             	sub    $0x4,%esp
+  800235:	68 07 04 00 00       	push   $0x407
+  80023a:	ff 75 f4             	push   -0xc(%ebp)
+  80023d:	6a 00                	push   $0x0
+  80023f:	e8 c5 0d 00 00       	call   801009 <sys_page_alloc>
+  800244:	83 c4 10             	add    $0x10,%esp
+  800247:	85 c0                	test   %eax,%eax
+  800249:	78 21                	js     80026c <opencons+0x50>
+  80024b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80024e:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  800254:	89 10                	mov    %edx,(%eax)
+  800256:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800259:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  800260:	83 ec 0c             	sub    $0xc,%esp
+  800263:	50                   	push   %eax
+  800264:	e8 0e 16 00 00       	call   801877 <fd2num>
+  800269:	83 c4 10             	add    $0x10,%esp
+  80026c:	c9                   	leave
+  80026d:	c3                   	ret
+
+0080026e <libmain>:
+  80026e:	55                   	push   %ebp
+  80026f:	89 e5                	mov    %esp,%ebp
+  800271:	56                   	push   %esi
+  800272:	53                   	push   %ebx
+  800273:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800276:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800279:	e8 21 0d 00 00       	call   800f9f <sys_getenvid>
+  80027e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800283:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800289:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80028e:	a3 10 54 80 00       	mov    %eax,0x805410
+  800293:	85 db                	test   %ebx,%ebx
+  800295:	7e 07                	jle    80029e <libmain+0x30>
+  800297:	8b 06                	mov    (%esi),%eax
+  800299:	a3 1c 40 80 00       	mov    %eax,0x80401c
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	56                   	push   %esi
+  8002a2:	53                   	push   %ebx
+  8002a3:	e8 8b fd ff ff       	call   800033 <umain>
+  8002a8:	e8 0a 00 00 00       	call   8002b7 <exit>
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5d                   	pop    %ebp
+  8002b6:	c3                   	ret
+
+008002b7 <exit>:
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	83 ec 08             	sub    $0x8,%esp
+  8002bd:	a1 10 54 80 00       	mov    0x805410,%eax
+  8002c2:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8002c8:	85 c0                	test   %eax,%eax
+  8002ca:	75 14                	jne    8002e0 <exit+0x29>
+  8002cc:	e8 70 17 00 00       	call   801a41 <close_all>
+  8002d1:	83 ec 0c             	sub    $0xc,%esp
+  8002d4:	6a 00                	push   $0x0
+  8002d6:	e8 83 0c 00 00       	call   800f5e <sys_env_destroy>
+  8002db:	83 c4 10             	add    $0x10,%esp
+  8002de:	c9                   	leave
+  8002df:	c3                   	ret
+  8002e0:	e8 e6 13 00 00       	call   8016cb <sys_lease_complete>
+  8002e5:	eb e5                	jmp    8002cc <exit+0x15>
+
+008002e7 <_panic>:
+  8002e7:	55                   	push   %ebp
+  8002e8:	89 e5                	mov    %esp,%ebp
+  8002ea:	56                   	push   %esi
+  8002eb:	53                   	push   %ebx
+  8002ec:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8002ef:	8b 35 1c 40 80 00    	mov    0x80401c,%esi
+  8002f5:	e8 a5 0c 00 00       	call   800f9f <sys_getenvid>
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	ff 75 0c             	push   0xc(%ebp)
+  800300:	ff 75 08             	push   0x8(%ebp)
+  800303:	56                   	push   %esi
+  800304:	50                   	push   %eax
+  800305:	68 a0 34 80 00       	push   $0x8034a0
+  80030a:	e8 b3 00 00 00       	call   8003c2 <cprintf>
+  80030f:	83 c4 18             	add    $0x18,%esp
+  800312:	53                   	push   %ebx
+  800313:	ff 75 10             	push   0x10(%ebp)
+  800316:	e8 56 00 00 00       	call   800371 <vcprintf>
+  80031b:	c7 04 24 86 34 80 00 	movl   $0x803486,(%esp)
+  800322:	e8 9b 00 00 00       	call   8003c2 <cprintf>
+  800327:	83 c4 10             	add    $0x10,%esp
+  80032a:	cc                   	int3
+  80032b:	eb fd                	jmp    80032a <_panic+0x43>
+
+0080032d <putch>:
+  80032d:	55                   	push   %ebp
+  80032e:	89 e5                	mov    %esp,%ebp
+  800330:	53                   	push   %ebx
+  800331:	83 ec 04             	sub    $0x4,%esp
+  800334:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800337:	8b 13                	mov    (%ebx),%edx
+  800339:	8d 42 01             	lea    0x1(%edx),%eax
+  80033c:	89 03                	mov    %eax,(%ebx)
+  80033e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800341:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  800345:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80034a:	74 09                	je     800355 <putch+0x28>
+  80034c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800350:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800353:	c9                   	leave
+  800354:	c3                   	ret
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	68 ff 00 00 00       	push   $0xff
+  80035d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800360:	50                   	push   %eax
+  800361:	e8 bb 0b 00 00       	call   800f21 <sys_cputs>
+  800366:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80036c:	83 c4 10             	add    $0x10,%esp
+  80036f:	eb db                	jmp    80034c <putch+0x1f>
+
+00800371 <vcprintf>:
+  800371:	55                   	push   %ebp
+  800372:	89 e5                	mov    %esp,%ebp
+  800374:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80037a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800381:	00 00 00 
+  800384:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80038b:	00 00 00 
+  80038e:	ff 75 0c             	push   0xc(%ebp)
+  800391:	ff 75 08             	push   0x8(%ebp)
+  800394:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80039a:	50                   	push   %eax
+  80039b:	68 2d 03 80 00       	push   $0x80032d
+  8003a0:	e8 1c 01 00 00       	call   8004c1 <vprintfmt>
+  8003a5:	83 c4 08             	add    $0x8,%esp
+  8003a8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003ae:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003b4:	50                   	push   %eax
+  8003b5:	e8 67 0b 00 00       	call   800f21 <sys_cputs>
+  8003ba:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003c0:	c9                   	leave
+  8003c1:	c3                   	ret
+
+008003c2 <cprintf>:
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 10             	sub    $0x10,%esp
+  8003c8:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8003cb:	50                   	push   %eax
+  8003cc:	ff 75 08             	push   0x8(%ebp)
+  8003cf:	e8 9d ff ff ff       	call   800371 <vcprintf>
+  8003d4:	c9                   	leave
+  8003d5:	c3                   	ret
+
+008003d6 <printnum>:
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	57                   	push   %edi
+  8003da:	56                   	push   %esi
+  8003db:	53                   	push   %ebx
+  8003dc:	83 ec 1c             	sub    $0x1c,%esp
+  8003df:	89 c3                	mov    %eax,%ebx
+  8003e1:	89 d6                	mov    %edx,%esi
+  8003e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003e9:	89 d1                	mov    %edx,%ecx
+  8003eb:	89 c2                	mov    %eax,%edx
+  8003ed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003f3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800400:	39 c2                	cmp    %eax,%edx
+  800402:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800405:	73 4b                	jae    800452 <printnum+0x7c>
+  800407:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040a:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80040d:	85 ff                	test   %edi,%edi
+  80040f:	7e 11                	jle    800422 <printnum+0x4c>
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	56                   	push   %esi
+  800415:	ff 75 18             	push   0x18(%ebp)
+  800418:	ff d3                	call   *%ebx
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	83 ef 01             	sub    $0x1,%edi
+  800420:	75 ef                	jne    800411 <printnum+0x3b>
+  800422:	83 ec 08             	sub    $0x8,%esp
+  800425:	56                   	push   %esi
+  800426:	83 ec 04             	sub    $0x4,%esp
+  800429:	ff 75 e4             	push   -0x1c(%ebp)
+  80042c:	ff 75 e0             	push   -0x20(%ebp)
+  80042f:	ff 75 dc             	push   -0x24(%ebp)
+  800432:	ff 75 d8             	push   -0x28(%ebp)
+  800435:	e8 cb 2e 00 00       	call   803305 <__umoddi3>
+  80043a:	83 c4 14             	add    $0x14,%esp
+  80043d:	0f be 80 c3 34 80 00 	movsbl 0x8034c3(%eax),%eax
+  800444:	50                   	push   %eax
+  800445:	ff d3                	call   *%ebx
+  800447:	83 c4 10             	add    $0x10,%esp
+  80044a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80044d:	5b                   	pop    %ebx
+  80044e:	5e                   	pop    %esi
+  80044f:	5f                   	pop    %edi
+  800450:	5d                   	pop    %ebp
+  800451:	c3                   	ret
+  800452:	83 ec 0c             	sub    $0xc,%esp
+  800455:	ff 75 18             	push   0x18(%ebp)
+  800458:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80045b:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80045e:	52                   	push   %edx
+  80045f:	50                   	push   %eax
+  800460:	83 ec 08             	sub    $0x8,%esp
+  800463:	ff 75 e4             	push   -0x1c(%ebp)
+  800466:	ff 75 e0             	push   -0x20(%ebp)
+  800469:	ff 75 dc             	push   -0x24(%ebp)
+  80046c:	ff 75 d8             	push   -0x28(%ebp)
+  80046f:	e8 73 2e 00 00       	call   8032e7 <__udivdi3>
+  800474:	83 c4 18             	add    $0x18,%esp
+  800477:	52                   	push   %edx
+  800478:	50                   	push   %eax
+  800479:	89 f2                	mov    %esi,%edx
+  80047b:	89 d8                	mov    %ebx,%eax
+  80047d:	e8 54 ff ff ff       	call   8003d6 <printnum>
+  800482:	83 c4 20             	add    $0x20,%esp
+  800485:	eb 9b                	jmp    800422 <printnum+0x4c>
+
+00800487 <sprintputch>:
+  800487:	55                   	push   %ebp
+  800488:	89 e5                	mov    %esp,%ebp
+  80048a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80048d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800491:	8b 10                	mov    (%eax),%edx
+  800493:	3b 50 04             	cmp    0x4(%eax),%edx
+  800496:	73 0a                	jae    8004a2 <sprintputch+0x1b>
+  800498:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80049b:	89 08                	mov    %ecx,(%eax)
+  80049d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004a0:	88 02                	mov    %al,(%edx)
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+
+008004a4 <printfmt>:
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	83 ec 08             	sub    $0x8,%esp
+  8004aa:	8d 45 14             	lea    0x14(%ebp),%eax
+  8004ad:	50                   	push   %eax
+  8004ae:	ff 75 10             	push   0x10(%ebp)
+  8004b1:	ff 75 0c             	push   0xc(%ebp)
+  8004b4:	ff 75 08             	push   0x8(%ebp)
+  8004b7:	e8 05 00 00 00       	call   8004c1 <vprintfmt>
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+
+008004c1 <vprintfmt>:
+  8004c1:	55                   	push   %ebp
+  8004c2:	89 e5                	mov    %esp,%ebp
+  8004c4:	57                   	push   %edi
+  8004c5:	56                   	push   %esi
+  8004c6:	53                   	push   %ebx
+  8004c7:	83 ec 2c             	sub    $0x2c,%esp
+  8004ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004cd:	89 df                	mov    %ebx,%edi
+  8004cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004d2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004d5:	8d 70 01             	lea    0x1(%eax),%esi
+  8004d8:	0f b6 00             	movzbl (%eax),%eax
+  8004db:	83 f8 25             	cmp    $0x25,%eax
+  8004de:	74 1e                	je     8004fe <vprintfmt+0x3d>
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	0f 84 15 05 00 00    	je     8009fd <vprintfmt+0x53c>
+  8004e8:	83 ec 08             	sub    $0x8,%esp
+  8004eb:	53                   	push   %ebx
+  8004ec:	50                   	push   %eax
+  8004ed:	ff d7                	call   *%edi
+  8004ef:	83 c6 01             	add    $0x1,%esi
+  8004f2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f6:	83 c4 10             	add    $0x10,%esp
+  8004f9:	83 f8 25             	cmp    $0x25,%eax
+  8004fc:	75 e2                	jne    8004e0 <vprintfmt+0x1f>
+  8004fe:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800502:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800509:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800510:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800517:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80051c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80051f:	8d 56 01             	lea    0x1(%esi),%edx
+  800522:	0f b6 0e             	movzbl (%esi),%ecx
+  800525:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800528:	3c 55                	cmp    $0x55,%al
+  80052a:	0f 87 3b 04 00 00    	ja     80096b <vprintfmt+0x4aa>
+  800530:	0f b6 c0             	movzbl %al,%eax
+  800533:	ff 24 85 00 36 80 00 	jmp    *0x803600(,%eax,4)
+  80053a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80053d:	eb 93                	jmp    8004d2 <vprintfmt+0x11>
+  80053f:	89 d6                	mov    %edx,%esi
+  800541:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800545:	eb d8                	jmp    80051f <vprintfmt+0x5e>
+  800547:	89 d6                	mov    %edx,%esi
+  800549:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80054d:	eb d0                	jmp    80051f <vprintfmt+0x5e>
+  80054f:	0f b6 c9             	movzbl %cl,%ecx
+  800552:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800555:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800558:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  80055c:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80055f:	83 f9 09             	cmp    $0x9,%ecx
+  800562:	77 6f                	ja     8005d3 <vprintfmt+0x112>
+  800564:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800567:	83 c2 01             	add    $0x1,%edx
+  80056a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80056d:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800571:	0f be 02             	movsbl (%edx),%eax
+  800574:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800577:	83 fe 09             	cmp    $0x9,%esi
+  80057a:	76 eb                	jbe    800567 <vprintfmt+0xa6>
+  80057c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80057f:	89 d6                	mov    %edx,%esi
+  800581:	eb 13                	jmp    800596 <vprintfmt+0xd5>
+  800583:	8b 45 14             	mov    0x14(%ebp),%eax
+  800586:	8b 00                	mov    (%eax),%eax
+  800588:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8d 40 04             	lea    0x4(%eax),%eax
+  800591:	89 45 14             	mov    %eax,0x14(%ebp)
+  800594:	89 d6                	mov    %edx,%esi
+  800596:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80059a:	79 83                	jns    80051f <vprintfmt+0x5e>
+  80059c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80059f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005a2:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8005a9:	e9 71 ff ff ff       	jmp    80051f <vprintfmt+0x5e>
+  8005ae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005b1:	85 c9                	test   %ecx,%ecx
+  8005b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b8:	0f 49 c1             	cmovns %ecx,%eax
+  8005bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005be:	89 d6                	mov    %edx,%esi
+  8005c0:	e9 5a ff ff ff       	jmp    80051f <vprintfmt+0x5e>
+  8005c5:	89 d6                	mov    %edx,%esi
+  8005c7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8005ce:	e9 4c ff ff ff       	jmp    80051f <vprintfmt+0x5e>
+  8005d3:	89 d6                	mov    %edx,%esi
+  8005d5:	eb bf                	jmp    800596 <vprintfmt+0xd5>
+  8005d7:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8005db:	89 d6                	mov    %edx,%esi
+  8005dd:	e9 3d ff ff ff       	jmp    80051f <vprintfmt+0x5e>
+  8005e2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e8:	8d 70 04             	lea    0x4(%eax),%esi
+  8005eb:	83 ec 08             	sub    $0x8,%esp
+  8005ee:	53                   	push   %ebx
+  8005ef:	ff 30                	push   (%eax)
+  8005f1:	ff d7                	call   *%edi
+  8005f3:	83 c4 10             	add    $0x10,%esp
+  8005f6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005f9:	e9 d4 fe ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  8005fe:	89 55 10             	mov    %edx,0x10(%ebp)
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8d 70 04             	lea    0x4(%eax),%esi
+  800607:	8b 10                	mov    (%eax),%edx
+  800609:	89 d0                	mov    %edx,%eax
+  80060b:	f7 d8                	neg    %eax
+  80060d:	0f 48 c2             	cmovs  %edx,%eax
+  800610:	83 f8 12             	cmp    $0x12,%eax
+  800613:	7f 23                	jg     800638 <vprintfmt+0x177>
+  800615:	8b 14 85 60 37 80 00 	mov    0x803760(,%eax,4),%edx
+  80061c:	85 d2                	test   %edx,%edx
+  80061e:	74 18                	je     800638 <vprintfmt+0x177>
+  800620:	52                   	push   %edx
+  800621:	68 cb 38 80 00       	push   $0x8038cb
+  800626:	53                   	push   %ebx
+  800627:	57                   	push   %edi
+  800628:	e8 77 fe ff ff       	call   8004a4 <printfmt>
+  80062d:	83 c4 10             	add    $0x10,%esp
+  800630:	89 75 14             	mov    %esi,0x14(%ebp)
+  800633:	e9 9a fe ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  800638:	50                   	push   %eax
+  800639:	68 db 34 80 00       	push   $0x8034db
+  80063e:	53                   	push   %ebx
+  80063f:	57                   	push   %edi
+  800640:	e8 5f fe ff ff       	call   8004a4 <printfmt>
+  800645:	83 c4 10             	add    $0x10,%esp
+  800648:	89 75 14             	mov    %esi,0x14(%ebp)
+  80064b:	e9 82 fe ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  800650:	89 55 10             	mov    %edx,0x10(%ebp)
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	83 c0 04             	add    $0x4,%eax
+  800659:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 00                	mov    (%eax),%eax
+  800661:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800664:	85 c0                	test   %eax,%eax
+  800666:	0f 84 61 03 00 00    	je     8009cd <vprintfmt+0x50c>
+  80066c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800670:	7e 06                	jle    800678 <vprintfmt+0x1b7>
+  800672:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800676:	75 29                	jne    8006a1 <vprintfmt+0x1e0>
+  800678:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80067b:	8d 70 01             	lea    0x1(%eax),%esi
+  80067e:	0f b6 00             	movzbl (%eax),%eax
+  800681:	0f be d0             	movsbl %al,%edx
+  800684:	85 d2                	test   %edx,%edx
+  800686:	0f 84 bb 00 00 00    	je     800747 <vprintfmt+0x286>
+  80068c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80068f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800692:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800695:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800698:	eb 7a                	jmp    800714 <vprintfmt+0x253>
+  80069a:	c7 45 d0 d4 34 80 00 	movl   $0x8034d4,-0x30(%ebp)
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	ff 75 d4             	push   -0x2c(%ebp)
+  8006a7:	ff 75 d0             	push   -0x30(%ebp)
+  8006aa:	e8 d0 04 00 00       	call   800b7f <strnlen>
+  8006af:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8006b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8006b5:	83 c4 10             	add    $0x10,%esp
+  8006b8:	85 d2                	test   %edx,%edx
+  8006ba:	0f 8e d6 02 00 00    	jle    800996 <vprintfmt+0x4d5>
+  8006c0:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	56                   	push   %esi
+  8006c9:	ff d7                	call   *%edi
+  8006cb:	83 c4 10             	add    $0x10,%esp
+  8006ce:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8006d2:	75 f0                	jne    8006c4 <vprintfmt+0x203>
+  8006d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006d7:	8d 70 01             	lea    0x1(%eax),%esi
+  8006da:	0f b6 00             	movzbl (%eax),%eax
+  8006dd:	0f be d0             	movsbl %al,%edx
+  8006e0:	85 d2                	test   %edx,%edx
+  8006e2:	0f 84 da 02 00 00    	je     8009c2 <vprintfmt+0x501>
+  8006e8:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006eb:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006ee:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006f1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006f4:	eb 1e                	jmp    800714 <vprintfmt+0x253>
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	ff 75 0c             	push   0xc(%ebp)
+  8006fc:	52                   	push   %edx
+  8006fd:	ff 55 08             	call   *0x8(%ebp)
+  800700:	83 c4 10             	add    $0x10,%esp
+  800703:	83 eb 01             	sub    $0x1,%ebx
+  800706:	83 c6 01             	add    $0x1,%esi
+  800709:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80070d:	0f be d0             	movsbl %al,%edx
+  800710:	85 d2                	test   %edx,%edx
+  800712:	74 2a                	je     80073e <vprintfmt+0x27d>
+  800714:	85 ff                	test   %edi,%edi
+  800716:	78 05                	js     80071d <vprintfmt+0x25c>
+  800718:	83 ef 01             	sub    $0x1,%edi
+  80071b:	78 59                	js     800776 <vprintfmt+0x2b5>
+  80071d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800721:	74 d3                	je     8006f6 <vprintfmt+0x235>
+  800723:	0f be c0             	movsbl %al,%eax
+  800726:	83 e8 20             	sub    $0x20,%eax
+  800729:	83 f8 5e             	cmp    $0x5e,%eax
+  80072c:	76 c8                	jbe    8006f6 <vprintfmt+0x235>
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	ff 75 0c             	push   0xc(%ebp)
+  800734:	6a 3f                	push   $0x3f
+  800736:	ff 55 08             	call   *0x8(%ebp)
+  800739:	83 c4 10             	add    $0x10,%esp
+  80073c:	eb c5                	jmp    800703 <vprintfmt+0x242>
+  80073e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800741:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800744:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800747:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80074a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80074e:	7e 1b                	jle    80076b <vprintfmt+0x2aa>
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	53                   	push   %ebx
+  800754:	6a 20                	push   $0x20
+  800756:	ff d7                	call   *%edi
+  800758:	83 c4 10             	add    $0x10,%esp
+  80075b:	83 ee 01             	sub    $0x1,%esi
+  80075e:	75 f0                	jne    800750 <vprintfmt+0x28f>
+  800760:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800763:	89 45 14             	mov    %eax,0x14(%ebp)
+  800766:	e9 67 fd ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  80076b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80076e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800771:	e9 5c fd ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  800776:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800779:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80077c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80077f:	eb c6                	jmp    800747 <vprintfmt+0x286>
+  800781:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800784:	89 55 10             	mov    %edx,0x10(%ebp)
+  800787:	83 f9 01             	cmp    $0x1,%ecx
+  80078a:	7f 1f                	jg     8007ab <vprintfmt+0x2ea>
+  80078c:	85 c9                	test   %ecx,%ecx
+  80078e:	74 67                	je     8007f7 <vprintfmt+0x336>
+  800790:	8b 45 14             	mov    0x14(%ebp),%eax
+  800793:	8b 30                	mov    (%eax),%esi
+  800795:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800798:	89 f0                	mov    %esi,%eax
+  80079a:	c1 f8 1f             	sar    $0x1f,%eax
+  80079d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a9:	eb 17                	jmp    8007c2 <vprintfmt+0x301>
+  8007ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ae:	8b 50 04             	mov    0x4(%eax),%edx
+  8007b1:	8b 00                	mov    (%eax),%eax
+  8007b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bc:	8d 40 08             	lea    0x8(%eax),%eax
+  8007bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007c8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007cd:	85 c9                	test   %ecx,%ecx
+  8007cf:	0f 89 12 01 00 00    	jns    8008e7 <vprintfmt+0x426>
+  8007d5:	83 ec 08             	sub    $0x8,%esp
+  8007d8:	53                   	push   %ebx
+  8007d9:	6a 2d                	push   $0x2d
+  8007db:	ff d7                	call   *%edi
+  8007dd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007e0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007e3:	f7 da                	neg    %edx
+  8007e5:	83 d1 00             	adc    $0x0,%ecx
+  8007e8:	f7 d9                	neg    %ecx
+  8007ea:	83 c4 10             	add    $0x10,%esp
+  8007ed:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007f2:	e9 f0 00 00 00       	jmp    8008e7 <vprintfmt+0x426>
+  8007f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fa:	8b 30                	mov    (%eax),%esi
+  8007fc:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007ff:	89 f0                	mov    %esi,%eax
+  800801:	c1 f8 1f             	sar    $0x1f,%eax
+  800804:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8d 40 04             	lea    0x4(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800810:	eb b0                	jmp    8007c2 <vprintfmt+0x301>
+  800812:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800815:	89 55 10             	mov    %edx,0x10(%ebp)
+  800818:	83 f9 01             	cmp    $0x1,%ecx
+  80081b:	7f 1e                	jg     80083b <vprintfmt+0x37a>
+  80081d:	85 c9                	test   %ecx,%ecx
+  80081f:	74 32                	je     800853 <vprintfmt+0x392>
+  800821:	8b 45 14             	mov    0x14(%ebp),%eax
+  800824:	8b 10                	mov    (%eax),%edx
+  800826:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082b:	8d 40 04             	lea    0x4(%eax),%eax
+  80082e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800831:	be 0a 00 00 00       	mov    $0xa,%esi
+  800836:	e9 ac 00 00 00       	jmp    8008e7 <vprintfmt+0x426>
+  80083b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083e:	8b 10                	mov    (%eax),%edx
+  800840:	8b 48 04             	mov    0x4(%eax),%ecx
+  800843:	8d 40 08             	lea    0x8(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+  800849:	be 0a 00 00 00       	mov    $0xa,%esi
+  80084e:	e9 94 00 00 00       	jmp    8008e7 <vprintfmt+0x426>
+  800853:	8b 45 14             	mov    0x14(%ebp),%eax
+  800856:	8b 10                	mov    (%eax),%edx
+  800858:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085d:	8d 40 04             	lea    0x4(%eax),%eax
+  800860:	89 45 14             	mov    %eax,0x14(%ebp)
+  800863:	be 0a 00 00 00       	mov    $0xa,%esi
+  800868:	eb 7d                	jmp    8008e7 <vprintfmt+0x426>
+  80086a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80086d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800870:	83 f9 01             	cmp    $0x1,%ecx
+  800873:	7f 1b                	jg     800890 <vprintfmt+0x3cf>
+  800875:	85 c9                	test   %ecx,%ecx
+  800877:	74 2c                	je     8008a5 <vprintfmt+0x3e4>
+  800879:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087c:	8b 10                	mov    (%eax),%edx
+  80087e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800883:	8d 40 04             	lea    0x4(%eax),%eax
+  800886:	89 45 14             	mov    %eax,0x14(%ebp)
+  800889:	be 08 00 00 00       	mov    $0x8,%esi
+  80088e:	eb 57                	jmp    8008e7 <vprintfmt+0x426>
+  800890:	8b 45 14             	mov    0x14(%ebp),%eax
+  800893:	8b 10                	mov    (%eax),%edx
+  800895:	8b 48 04             	mov    0x4(%eax),%ecx
+  800898:	8d 40 08             	lea    0x8(%eax),%eax
+  80089b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089e:	be 08 00 00 00       	mov    $0x8,%esi
+  8008a3:	eb 42                	jmp    8008e7 <vprintfmt+0x426>
+  8008a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a8:	8b 10                	mov    (%eax),%edx
+  8008aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008af:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b5:	be 08 00 00 00       	mov    $0x8,%esi
+  8008ba:	eb 2b                	jmp    8008e7 <vprintfmt+0x426>
+  8008bc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008bf:	83 ec 08             	sub    $0x8,%esp
+  8008c2:	53                   	push   %ebx
+  8008c3:	6a 30                	push   $0x30
+  8008c5:	ff d7                	call   *%edi
+  8008c7:	83 c4 08             	add    $0x8,%esp
+  8008ca:	53                   	push   %ebx
+  8008cb:	6a 78                	push   $0x78
+  8008cd:	ff d7                	call   *%edi
+  8008cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d2:	8b 10                	mov    (%eax),%edx
+  8008d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d9:	83 c4 10             	add    $0x10,%esp
+  8008dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e2:	be 10 00 00 00       	mov    $0x10,%esi
+  8008e7:	83 ec 0c             	sub    $0xc,%esp
+  8008ea:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008ee:	50                   	push   %eax
+  8008ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8008f2:	56                   	push   %esi
+  8008f3:	51                   	push   %ecx
+  8008f4:	52                   	push   %edx
+  8008f5:	89 da                	mov    %ebx,%edx
+  8008f7:	89 f8                	mov    %edi,%eax
+  8008f9:	e8 d8 fa ff ff       	call   8003d6 <printnum>
+  8008fe:	83 c4 20             	add    $0x20,%esp
+  800901:	e9 cc fb ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  800906:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800909:	89 55 10             	mov    %edx,0x10(%ebp)
+  80090c:	83 f9 01             	cmp    $0x1,%ecx
+  80090f:	7f 1b                	jg     80092c <vprintfmt+0x46b>
+  800911:	85 c9                	test   %ecx,%ecx
+  800913:	74 2c                	je     800941 <vprintfmt+0x480>
+  800915:	8b 45 14             	mov    0x14(%ebp),%eax
+  800918:	8b 10                	mov    (%eax),%edx
+  80091a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80091f:	8d 40 04             	lea    0x4(%eax),%eax
+  800922:	89 45 14             	mov    %eax,0x14(%ebp)
+  800925:	be 10 00 00 00       	mov    $0x10,%esi
+  80092a:	eb bb                	jmp    8008e7 <vprintfmt+0x426>
+  80092c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092f:	8b 10                	mov    (%eax),%edx
+  800931:	8b 48 04             	mov    0x4(%eax),%ecx
+  800934:	8d 40 08             	lea    0x8(%eax),%eax
+  800937:	89 45 14             	mov    %eax,0x14(%ebp)
+  80093a:	be 10 00 00 00       	mov    $0x10,%esi
+  80093f:	eb a6                	jmp    8008e7 <vprintfmt+0x426>
+  800941:	8b 45 14             	mov    0x14(%ebp),%eax
+  800944:	8b 10                	mov    (%eax),%edx
+  800946:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094b:	8d 40 04             	lea    0x4(%eax),%eax
+  80094e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800951:	be 10 00 00 00       	mov    $0x10,%esi
+  800956:	eb 8f                	jmp    8008e7 <vprintfmt+0x426>
+  800958:	89 55 10             	mov    %edx,0x10(%ebp)
+  80095b:	83 ec 08             	sub    $0x8,%esp
+  80095e:	53                   	push   %ebx
+  80095f:	6a 25                	push   $0x25
+  800961:	ff d7                	call   *%edi
+  800963:	83 c4 10             	add    $0x10,%esp
+  800966:	e9 67 fb ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  80096b:	83 ec 08             	sub    $0x8,%esp
+  80096e:	53                   	push   %ebx
+  80096f:	6a 25                	push   $0x25
+  800971:	ff d7                	call   *%edi
+  800973:	83 c4 10             	add    $0x10,%esp
+  800976:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80097a:	0f 84 ba fb ff ff    	je     80053a <vprintfmt+0x79>
+  800980:	89 75 10             	mov    %esi,0x10(%ebp)
+  800983:	89 f0                	mov    %esi,%eax
+  800985:	83 e8 01             	sub    $0x1,%eax
+  800988:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80098c:	75 f7                	jne    800985 <vprintfmt+0x4c4>
+  80098e:	89 45 10             	mov    %eax,0x10(%ebp)
+  800991:	e9 3c fb ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  800996:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800999:	8d 70 01             	lea    0x1(%eax),%esi
+  80099c:	0f b6 00             	movzbl (%eax),%eax
+  80099f:	0f be d0             	movsbl %al,%edx
+  8009a2:	85 d2                	test   %edx,%edx
+  8009a4:	74 11                	je     8009b7 <vprintfmt+0x4f6>
+  8009a6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009a9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009ac:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009af:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009b2:	e9 5d fd ff ff       	jmp    800714 <vprintfmt+0x253>
+  8009b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009bd:	e9 10 fb ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  8009c2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009c8:	e9 05 fb ff ff       	jmp    8004d2 <vprintfmt+0x11>
+  8009cd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009d1:	7e 0a                	jle    8009dd <vprintfmt+0x51c>
+  8009d3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009d7:	0f 85 bd fc ff ff    	jne    80069a <vprintfmt+0x1d9>
+  8009dd:	ba 28 00 00 00       	mov    $0x28,%edx
+  8009e2:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009e7:	be d5 34 80 00       	mov    $0x8034d5,%esi
+  8009ec:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009ef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009f2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009f5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009f8:	e9 17 fd ff ff       	jmp    800714 <vprintfmt+0x253>
+  8009fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a00:	5b                   	pop    %ebx
+  800a01:	5e                   	pop    %esi
+  800a02:	5f                   	pop    %edi
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <vsnprintf>:
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	83 ec 18             	sub    $0x18,%esp
+  800a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a11:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a14:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a18:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a1b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a22:	85 c0                	test   %eax,%eax
+  800a24:	74 26                	je     800a4c <vsnprintf+0x47>
+  800a26:	85 d2                	test   %edx,%edx
+  800a28:	7e 22                	jle    800a4c <vsnprintf+0x47>
+  800a2a:	ff 75 14             	push   0x14(%ebp)
+  800a2d:	ff 75 10             	push   0x10(%ebp)
+  800a30:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a33:	50                   	push   %eax
+  800a34:	68 87 04 80 00       	push   $0x800487
+  800a39:	e8 83 fa ff ff       	call   8004c1 <vprintfmt>
+  800a3e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a41:	c6 00 00             	movb   $0x0,(%eax)
+  800a44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a47:	83 c4 10             	add    $0x10,%esp
+  800a4a:	c9                   	leave
+  800a4b:	c3                   	ret
+  800a4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a51:	eb f7                	jmp    800a4a <vsnprintf+0x45>
+
+00800a53 <snprintf>:
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	83 ec 08             	sub    $0x8,%esp
+  800a59:	8d 45 14             	lea    0x14(%ebp),%eax
+  800a5c:	50                   	push   %eax
+  800a5d:	ff 75 10             	push   0x10(%ebp)
+  800a60:	ff 75 0c             	push   0xc(%ebp)
+  800a63:	ff 75 08             	push   0x8(%ebp)
+  800a66:	e8 9a ff ff ff       	call   800a05 <vsnprintf>
+  800a6b:	c9                   	leave
+  800a6c:	c3                   	ret
+
+00800a6d <readline>:
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	57                   	push   %edi
+  800a71:	56                   	push   %esi
+  800a72:	53                   	push   %ebx
+  800a73:	83 ec 0c             	sub    $0xc,%esp
+  800a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a79:	85 c0                	test   %eax,%eax
+  800a7b:	74 13                	je     800a90 <readline+0x23>
+  800a7d:	83 ec 04             	sub    $0x4,%esp
+  800a80:	50                   	push   %eax
+  800a81:	68 cb 38 80 00       	push   $0x8038cb
+  800a86:	6a 01                	push   $0x1
+  800a88:	e8 da 1a 00 00       	call   802567 <fprintf>
+  800a8d:	83 c4 10             	add    $0x10,%esp
+  800a90:	83 ec 0c             	sub    $0xc,%esp
+  800a93:	6a 00                	push   $0x0
+  800a95:	e8 56 f7 ff ff       	call   8001f0 <iscons>
+  800a9a:	89 c7                	mov    %eax,%edi
+  800a9c:	83 c4 10             	add    $0x10,%esp
+  800a9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800aa4:	eb 4b                	jmp    800af1 <readline+0x84>
+  800aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aab:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  800aae:	75 08                	jne    800ab8 <readline+0x4b>
+  800ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ab3:	5b                   	pop    %ebx
+  800ab4:	5e                   	pop    %esi
+  800ab5:	5f                   	pop    %edi
+  800ab6:	5d                   	pop    %ebp
+  800ab7:	c3                   	ret
+  800ab8:	83 ec 08             	sub    $0x8,%esp
+  800abb:	53                   	push   %ebx
+  800abc:	68 cb 37 80 00       	push   $0x8037cb
+  800ac1:	e8 fc f8 ff ff       	call   8003c2 <cprintf>
+  800ac6:	83 c4 10             	add    $0x10,%esp
+  800ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ace:	eb e0                	jmp    800ab0 <readline+0x43>
+  800ad0:	85 ff                	test   %edi,%edi
+  800ad2:	75 05                	jne    800ad9 <readline+0x6c>
+  800ad4:	83 ee 01             	sub    $0x1,%esi
+  800ad7:	eb 18                	jmp    800af1 <readline+0x84>
+  800ad9:	83 ec 0c             	sub    $0xc,%esp
+  800adc:	6a 08                	push   $0x8
+  800ade:	e8 c8 f6 ff ff       	call   8001ab <cputchar>
+  800ae3:	83 c4 10             	add    $0x10,%esp
+  800ae6:	eb ec                	jmp    800ad4 <readline+0x67>
+  800ae8:	88 9e 00 50 80 00    	mov    %bl,0x805000(%esi)
+  800aee:	8d 76 01             	lea    0x1(%esi),%esi
+  800af1:	e8 d1 f6 ff ff       	call   8001c7 <getchar>
+  800af6:	89 c3                	mov    %eax,%ebx
+  800af8:	85 c0                	test   %eax,%eax
+  800afa:	78 aa                	js     800aa6 <readline+0x39>
+  800afc:	83 f8 08             	cmp    $0x8,%eax
+  800aff:	0f 94 c0             	sete   %al
+  800b02:	83 fb 7f             	cmp    $0x7f,%ebx
+  800b05:	0f 94 c2             	sete   %dl
+  800b08:	08 d0                	or     %dl,%al
+  800b0a:	74 04                	je     800b10 <readline+0xa3>
+  800b0c:	85 f6                	test   %esi,%esi
+  800b0e:	7f c0                	jg     800ad0 <readline+0x63>
+  800b10:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b13:	7e 1a                	jle    800b2f <readline+0xc2>
+  800b15:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  800b1b:	7f 12                	jg     800b2f <readline+0xc2>
+  800b1d:	85 ff                	test   %edi,%edi
+  800b1f:	74 c7                	je     800ae8 <readline+0x7b>
+  800b21:	83 ec 0c             	sub    $0xc,%esp
+  800b24:	53                   	push   %ebx
+  800b25:	e8 81 f6 ff ff       	call   8001ab <cputchar>
+  800b2a:	83 c4 10             	add    $0x10,%esp
+  800b2d:	eb b9                	jmp    800ae8 <readline+0x7b>
+  800b2f:	83 fb 0a             	cmp    $0xa,%ebx
+  800b32:	74 05                	je     800b39 <readline+0xcc>
+  800b34:	83 fb 0d             	cmp    $0xd,%ebx
+  800b37:	75 b8                	jne    800af1 <readline+0x84>
+  800b39:	85 ff                	test   %edi,%edi
+  800b3b:	75 11                	jne    800b4e <readline+0xe1>
+  800b3d:	c6 86 00 50 80 00 00 	movb   $0x0,0x805000(%esi)
+  800b44:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800b49:	e9 62 ff ff ff       	jmp    800ab0 <readline+0x43>
+  800b4e:	83 ec 0c             	sub    $0xc,%esp
+  800b51:	6a 0a                	push   $0xa
+  800b53:	e8 53 f6 ff ff       	call   8001ab <cputchar>
+  800b58:	83 c4 10             	add    $0x10,%esp
+  800b5b:	eb e0                	jmp    800b3d <readline+0xd0>
+
+00800b5d <strlen>:
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b63:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b66:	74 10                	je     800b78 <strlen+0x1b>
+  800b68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6d:	83 c0 01             	add    $0x1,%eax
+  800b70:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b74:	75 f7                	jne    800b6d <strlen+0x10>
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+  800b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7d:	eb f7                	jmp    800b76 <strlen+0x19>
+
+00800b7f <strnlen>:
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b88:	85 d2                	test   %edx,%edx
+  800b8a:	74 16                	je     800ba2 <strnlen+0x23>
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b95:	74 09                	je     800ba0 <strnlen+0x21>
+  800b97:	83 c0 01             	add    $0x1,%eax
+  800b9a:	39 d0                	cmp    %edx,%eax
+  800b9c:	75 f3                	jne    800b91 <strnlen+0x12>
+  800b9e:	89 d0                	mov    %edx,%eax
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+  800ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba7:	eb f7                	jmp    800ba0 <strnlen+0x21>
+
+00800ba9 <strcpy>:
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	53                   	push   %ebx
+  800bad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bb0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bbc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bbf:	83 c0 01             	add    $0x1,%eax
+  800bc2:	84 d2                	test   %dl,%dl
+  800bc4:	75 f2                	jne    800bb8 <strcpy+0xf>
+  800bc6:	89 c8                	mov    %ecx,%eax
+  800bc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bcb:	c9                   	leave
+  800bcc:	c3                   	ret
+
+00800bcd <strcat>:
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	53                   	push   %ebx
+  800bd1:	83 ec 10             	sub    $0x10,%esp
+  800bd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bd7:	53                   	push   %ebx
+  800bd8:	e8 80 ff ff ff       	call   800b5d <strlen>
+  800bdd:	83 c4 08             	add    $0x8,%esp
+  800be0:	ff 75 0c             	push   0xc(%ebp)
+  800be3:	01 d8                	add    %ebx,%eax
+  800be5:	50                   	push   %eax
+  800be6:	e8 be ff ff ff       	call   800ba9 <strcpy>
+  800beb:	89 d8                	mov    %ebx,%eax
+  800bed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf0:	c9                   	leave
+  800bf1:	c3                   	ret
+
+00800bf2 <strncpy>:
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bfa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bfd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c00:	85 db                	test   %ebx,%ebx
+  800c02:	74 17                	je     800c1b <strncpy+0x29>
+  800c04:	01 f3                	add    %esi,%ebx
+  800c06:	89 f0                	mov    %esi,%eax
+  800c08:	83 c0 01             	add    $0x1,%eax
+  800c0b:	0f b6 0a             	movzbl (%edx),%ecx
+  800c0e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800c11:	80 f9 01             	cmp    $0x1,%cl
+  800c14:	83 da ff             	sbb    $0xffffffff,%edx
+  800c17:	39 c3                	cmp    %eax,%ebx
+  800c19:	75 ed                	jne    800c08 <strncpy+0x16>
+  800c1b:	89 f0                	mov    %esi,%eax
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5d                   	pop    %ebp
+  800c20:	c3                   	ret
+
+00800c21 <strlcpy>:
+  800c21:	55                   	push   %ebp
+  800c22:	89 e5                	mov    %esp,%ebp
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  800c26:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c2f:	89 f0                	mov    %esi,%eax
+  800c31:	85 db                	test   %ebx,%ebx
+  800c33:	74 1e                	je     800c53 <strlcpy+0x32>
+  800c35:	83 eb 01             	sub    $0x1,%ebx
+  800c38:	74 16                	je     800c50 <strlcpy+0x2f>
+  800c3a:	01 f3                	add    %esi,%ebx
+  800c3c:	0f b6 0a             	movzbl (%edx),%ecx
+  800c3f:	84 c9                	test   %cl,%cl
+  800c41:	74 0d                	je     800c50 <strlcpy+0x2f>
+  800c43:	83 c2 01             	add    $0x1,%edx
+  800c46:	83 c0 01             	add    $0x1,%eax
+  800c49:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800c4c:	39 d8                	cmp    %ebx,%eax
+  800c4e:	75 ec                	jne    800c3c <strlcpy+0x1b>
+  800c50:	c6 00 00             	movb   $0x0,(%eax)
+  800c53:	29 f0                	sub    %esi,%eax
+  800c55:	5b                   	pop    %ebx
+  800c56:	5e                   	pop    %esi
+  800c57:	5d                   	pop    %ebp
+  800c58:	c3                   	ret
+
+00800c59 <strcmp>:
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c62:	0f b6 01             	movzbl (%ecx),%eax
+  800c65:	84 c0                	test   %al,%al
+  800c67:	74 11                	je     800c7a <strcmp+0x21>
+  800c69:	38 02                	cmp    %al,(%edx)
+  800c6b:	75 0d                	jne    800c7a <strcmp+0x21>
+  800c6d:	83 c1 01             	add    $0x1,%ecx
+  800c70:	83 c2 01             	add    $0x1,%edx
+  800c73:	0f b6 01             	movzbl (%ecx),%eax
+  800c76:	84 c0                	test   %al,%al
+  800c78:	75 ef                	jne    800c69 <strcmp+0x10>
+  800c7a:	0f b6 c0             	movzbl %al,%eax
+  800c7d:	0f b6 12             	movzbl (%edx),%edx
+  800c80:	29 d0                	sub    %edx,%eax
+  800c82:	5d                   	pop    %ebp
+  800c83:	c3                   	ret
+
+00800c84 <strncmp>:
+  800c84:	55                   	push   %ebp
+  800c85:	89 e5                	mov    %esp,%ebp
+  800c87:	53                   	push   %ebx
+  800c88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c8e:	8b 55 10             	mov    0x10(%ebp),%edx
+  800c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c96:	85 d2                	test   %edx,%edx
+  800c98:	74 2e                	je     800cc8 <strncmp+0x44>
+  800c9a:	0f b6 01             	movzbl (%ecx),%eax
+  800c9d:	84 c0                	test   %al,%al
+  800c9f:	74 16                	je     800cb7 <strncmp+0x33>
+  800ca1:	3a 03                	cmp    (%ebx),%al
+  800ca3:	75 12                	jne    800cb7 <strncmp+0x33>
+  800ca5:	83 c1 01             	add    $0x1,%ecx
+  800ca8:	83 c3 01             	add    $0x1,%ebx
+  800cab:	83 ea 01             	sub    $0x1,%edx
+  800cae:	75 ea                	jne    800c9a <strncmp+0x16>
+  800cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb5:	eb 11                	jmp    800cc8 <strncmp+0x44>
+  800cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbc:	85 d2                	test   %edx,%edx
+  800cbe:	74 08                	je     800cc8 <strncmp+0x44>
+  800cc0:	0f b6 01             	movzbl (%ecx),%eax
+  800cc3:	0f b6 13             	movzbl (%ebx),%edx
+  800cc6:	29 d0                	sub    %edx,%eax
+  800cc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ccb:	c9                   	leave
+  800ccc:	c3                   	ret
+
+00800ccd <strchr>:
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800cd7:	0f b6 10             	movzbl (%eax),%edx
+  800cda:	84 d2                	test   %dl,%dl
+  800cdc:	74 15                	je     800cf3 <strchr+0x26>
+  800cde:	38 d1                	cmp    %dl,%cl
+  800ce0:	74 0f                	je     800cf1 <strchr+0x24>
+  800ce2:	83 c0 01             	add    $0x1,%eax
+  800ce5:	0f b6 10             	movzbl (%eax),%edx
+  800ce8:	84 d2                	test   %dl,%dl
+  800cea:	75 f2                	jne    800cde <strchr+0x11>
+  800cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	c3                   	ret
+  800cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf8:	eb f7                	jmp    800cf1 <strchr+0x24>
+
+00800cfa <strfind>:
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	53                   	push   %ebx
+  800cfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d04:	0f b6 18             	movzbl (%eax),%ebx
+  800d07:	38 d3                	cmp    %dl,%bl
+  800d09:	74 14                	je     800d1f <strfind+0x25>
+  800d0b:	89 d1                	mov    %edx,%ecx
+  800d0d:	84 db                	test   %bl,%bl
+  800d0f:	74 0e                	je     800d1f <strfind+0x25>
+  800d11:	83 c0 01             	add    $0x1,%eax
+  800d14:	0f b6 10             	movzbl (%eax),%edx
+  800d17:	38 ca                	cmp    %cl,%dl
+  800d19:	74 04                	je     800d1f <strfind+0x25>
+  800d1b:	84 d2                	test   %dl,%dl
+  800d1d:	75 f2                	jne    800d11 <strfind+0x17>
+  800d1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d22:	c9                   	leave
+  800d23:	c3                   	ret
+
+00800d24 <memset>:
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	57                   	push   %edi
+  800d28:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d2b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800d2e:	85 c9                	test   %ecx,%ecx
+  800d30:	74 20                	je     800d52 <memset+0x2e>
+  800d32:	89 f8                	mov    %edi,%eax
+  800d34:	09 c8                	or     %ecx,%eax
+  800d36:	a8 03                	test   $0x3,%al
+  800d38:	75 12                	jne    800d4c <memset+0x28>
+  800d3a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d3e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800d44:	c1 e9 02             	shr    $0x2,%ecx
+  800d47:	fc                   	cld
+  800d48:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d4a:	eb 06                	jmp    800d52 <memset+0x2e>
+  800d4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d4f:	fc                   	cld
+  800d50:	f3 aa                	rep stos %al,%es:(%edi)
+  800d52:	89 f8                	mov    %edi,%eax
+  800d54:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d57:	c9                   	leave
+  800d58:	c3                   	ret
+
+00800d59 <memmove>:
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	57                   	push   %edi
+  800d5d:	56                   	push   %esi
+  800d5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d61:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d64:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800d67:	39 c6                	cmp    %eax,%esi
+  800d69:	73 32                	jae    800d9d <memmove+0x44>
+  800d6b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d6e:	39 d0                	cmp    %edx,%eax
+  800d70:	73 2b                	jae    800d9d <memmove+0x44>
+  800d72:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800d75:	89 d6                	mov    %edx,%esi
+  800d77:	09 fe                	or     %edi,%esi
+  800d79:	09 ce                	or     %ecx,%esi
+  800d7b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d81:	75 0e                	jne    800d91 <memmove+0x38>
+  800d83:	83 ef 04             	sub    $0x4,%edi
+  800d86:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d89:	c1 e9 02             	shr    $0x2,%ecx
+  800d8c:	fd                   	std
+  800d8d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d8f:	eb 09                	jmp    800d9a <memmove+0x41>
+  800d91:	83 ef 01             	sub    $0x1,%edi
+  800d94:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800d97:	fd                   	std
+  800d98:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d9a:	fc                   	cld
+  800d9b:	eb 1a                	jmp    800db7 <memmove+0x5e>
+  800d9d:	89 f2                	mov    %esi,%edx
+  800d9f:	09 c2                	or     %eax,%edx
+  800da1:	09 ca                	or     %ecx,%edx
+  800da3:	f6 c2 03             	test   $0x3,%dl
+  800da6:	75 0a                	jne    800db2 <memmove+0x59>
+  800da8:	c1 e9 02             	shr    $0x2,%ecx
+  800dab:	89 c7                	mov    %eax,%edi
+  800dad:	fc                   	cld
+  800dae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800db0:	eb 05                	jmp    800db7 <memmove+0x5e>
+  800db2:	89 c7                	mov    %eax,%edi
+  800db4:	fc                   	cld
+  800db5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800db7:	5e                   	pop    %esi
+  800db8:	5f                   	pop    %edi
+  800db9:	5d                   	pop    %ebp
+  800dba:	c3                   	ret
+
+00800dbb <memcpy>:
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  800dc1:	ff 75 10             	push   0x10(%ebp)
+  800dc4:	ff 75 0c             	push   0xc(%ebp)
+  800dc7:	ff 75 08             	push   0x8(%ebp)
+  800dca:	e8 8a ff ff ff       	call   800d59 <memmove>
+  800dcf:	c9                   	leave
+  800dd0:	c3                   	ret
+
+00800dd1 <memcmp>:
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  800dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ddc:	8b 75 10             	mov    0x10(%ebp),%esi
+  800ddf:	85 f6                	test   %esi,%esi
+  800de1:	74 29                	je     800e0c <memcmp+0x3b>
+  800de3:	01 c6                	add    %eax,%esi
+  800de5:	0f b6 08             	movzbl (%eax),%ecx
+  800de8:	0f b6 1a             	movzbl (%edx),%ebx
+  800deb:	38 d9                	cmp    %bl,%cl
+  800ded:	75 11                	jne    800e00 <memcmp+0x2f>
+  800def:	83 c0 01             	add    $0x1,%eax
+  800df2:	83 c2 01             	add    $0x1,%edx
+  800df5:	39 c6                	cmp    %eax,%esi
+  800df7:	75 ec                	jne    800de5 <memcmp+0x14>
+  800df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfe:	eb 08                	jmp    800e08 <memcmp+0x37>
+  800e00:	0f b6 c1             	movzbl %cl,%eax
+  800e03:	0f b6 db             	movzbl %bl,%ebx
+  800e06:	29 d8                	sub    %ebx,%eax
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+  800e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e11:	eb f5                	jmp    800e08 <memcmp+0x37>
+
+00800e13 <memfind>:
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1c:	89 c2                	mov    %eax,%edx
+  800e1e:	03 55 10             	add    0x10(%ebp),%edx
+  800e21:	39 d0                	cmp    %edx,%eax
+  800e23:	73 0d                	jae    800e32 <memfind+0x1f>
+  800e25:	38 08                	cmp    %cl,(%eax)
+  800e27:	74 0d                	je     800e36 <memfind+0x23>
+  800e29:	83 c0 01             	add    $0x1,%eax
+  800e2c:	39 c2                	cmp    %eax,%edx
+  800e2e:	75 f5                	jne    800e25 <memfind+0x12>
+  800e30:	eb 06                	jmp    800e38 <memfind+0x25>
+  800e32:	89 c2                	mov    %eax,%edx
+  800e34:	eb 02                	jmp    800e38 <memfind+0x25>
+  800e36:	89 c2                	mov    %eax,%edx
+  800e38:	89 d0                	mov    %edx,%eax
+  800e3a:	5d                   	pop    %ebp
+  800e3b:	c3                   	ret
+
+00800e3c <strtol>:
+  800e3c:	55                   	push   %ebp
+  800e3d:	89 e5                	mov    %esp,%ebp
+  800e3f:	57                   	push   %edi
+  800e40:	56                   	push   %esi
+  800e41:	53                   	push   %ebx
+  800e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e48:	0f b6 02             	movzbl (%edx),%eax
+  800e4b:	3c 20                	cmp    $0x20,%al
+  800e4d:	74 04                	je     800e53 <strtol+0x17>
+  800e4f:	3c 09                	cmp    $0x9,%al
+  800e51:	75 0e                	jne    800e61 <strtol+0x25>
+  800e53:	83 c2 01             	add    $0x1,%edx
+  800e56:	0f b6 02             	movzbl (%edx),%eax
+  800e59:	3c 20                	cmp    $0x20,%al
+  800e5b:	74 f6                	je     800e53 <strtol+0x17>
+  800e5d:	3c 09                	cmp    $0x9,%al
+  800e5f:	74 f2                	je     800e53 <strtol+0x17>
+  800e61:	3c 2b                	cmp    $0x2b,%al
+  800e63:	74 2a                	je     800e8f <strtol+0x53>
+  800e65:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e6a:	3c 2d                	cmp    $0x2d,%al
+  800e6c:	74 2b                	je     800e99 <strtol+0x5d>
+  800e6e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e74:	75 0f                	jne    800e85 <strtol+0x49>
+  800e76:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e79:	74 28                	je     800ea3 <strtol+0x67>
+  800e7b:	85 db                	test   %ebx,%ebx
+  800e7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e82:	0f 44 d8             	cmove  %eax,%ebx
+  800e85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e8d:	eb 46                	jmp    800ed5 <strtol+0x99>
+  800e8f:	83 c2 01             	add    $0x1,%edx
+  800e92:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e97:	eb d5                	jmp    800e6e <strtol+0x32>
+  800e99:	83 c2 01             	add    $0x1,%edx
+  800e9c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ea1:	eb cb                	jmp    800e6e <strtol+0x32>
+  800ea3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ea7:	74 0e                	je     800eb7 <strtol+0x7b>
+  800ea9:	85 db                	test   %ebx,%ebx
+  800eab:	75 d8                	jne    800e85 <strtol+0x49>
+  800ead:	83 c2 01             	add    $0x1,%edx
+  800eb0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800eb5:	eb ce                	jmp    800e85 <strtol+0x49>
+  800eb7:	83 c2 02             	add    $0x2,%edx
+  800eba:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ebf:	eb c4                	jmp    800e85 <strtol+0x49>
+  800ec1:	0f be c0             	movsbl %al,%eax
+  800ec4:	83 e8 30             	sub    $0x30,%eax
+  800ec7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800eca:	7d 3a                	jge    800f06 <strtol+0xca>
+  800ecc:	83 c2 01             	add    $0x1,%edx
+  800ecf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ed3:	01 c1                	add    %eax,%ecx
+  800ed5:	0f b6 02             	movzbl (%edx),%eax
+  800ed8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800edb:	89 f3                	mov    %esi,%ebx
+  800edd:	80 fb 09             	cmp    $0x9,%bl
+  800ee0:	76 df                	jbe    800ec1 <strtol+0x85>
+  800ee2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ee5:	89 f3                	mov    %esi,%ebx
+  800ee7:	80 fb 19             	cmp    $0x19,%bl
+  800eea:	77 08                	ja     800ef4 <strtol+0xb8>
+  800eec:	0f be c0             	movsbl %al,%eax
+  800eef:	83 e8 57             	sub    $0x57,%eax
+  800ef2:	eb d3                	jmp    800ec7 <strtol+0x8b>
+  800ef4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ef7:	89 f3                	mov    %esi,%ebx
+  800ef9:	80 fb 19             	cmp    $0x19,%bl
+  800efc:	77 08                	ja     800f06 <strtol+0xca>
+  800efe:	0f be c0             	movsbl %al,%eax
+  800f01:	83 e8 37             	sub    $0x37,%eax
+  800f04:	eb c1                	jmp    800ec7 <strtol+0x8b>
+  800f06:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f0a:	74 05                	je     800f11 <strtol+0xd5>
+  800f0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f0f:	89 10                	mov    %edx,(%eax)
+  800f11:	89 c8                	mov    %ecx,%eax
+  800f13:	f7 d8                	neg    %eax
+  800f15:	85 ff                	test   %edi,%edi
+  800f17:	0f 45 c8             	cmovne %eax,%ecx
+  800f1a:	89 c8                	mov    %ecx,%eax
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+
+00800f21 <sys_cputs>:
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	57                   	push   %edi
+  800f25:	56                   	push   %esi
+  800f26:	53                   	push   %ebx
+  800f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f32:	89 c3                	mov    %eax,%ebx
+  800f34:	89 c7                	mov    %eax,%edi
+  800f36:	89 c6                	mov    %eax,%esi
+  800f38:	cd 30                	int    $0x30
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+
+00800f3f <sys_cgetc>:
+  800f3f:	55                   	push   %ebp
+  800f40:	89 e5                	mov    %esp,%ebp
+  800f42:	57                   	push   %edi
+  800f43:	56                   	push   %esi
+  800f44:	53                   	push   %ebx
+  800f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f4f:	89 d1                	mov    %edx,%ecx
+  800f51:	89 d3                	mov    %edx,%ebx
+  800f53:	89 d7                	mov    %edx,%edi
+  800f55:	89 d6                	mov    %edx,%esi
+  800f57:	cd 30                	int    $0x30
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_env_destroy>:
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f74:	89 cb                	mov    %ecx,%ebx
+  800f76:	89 cf                	mov    %ecx,%edi
+  800f78:	89 ce                	mov    %ecx,%esi
+  800f7a:	cd 30                	int    $0x30
+  800f7c:	85 c0                	test   %eax,%eax
+  800f7e:	7f 08                	jg     800f88 <sys_env_destroy+0x2a>
+  800f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	50                   	push   %eax
+  800f8c:	6a 03                	push   $0x3
+  800f8e:	68 db 37 80 00       	push   $0x8037db
+  800f93:	6a 24                	push   $0x24
+  800f95:	68 f8 37 80 00       	push   $0x8037f8
+  800f9a:	e8 48 f3 ff ff       	call   8002e7 <_panic>
+
+00800f9f <sys_getenvid>:
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  800fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800faa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800faf:	89 d1                	mov    %edx,%ecx
+  800fb1:	89 d3                	mov    %edx,%ebx
+  800fb3:	89 d7                	mov    %edx,%edi
+  800fb5:	89 d6                	mov    %edx,%esi
+  800fb7:	cd 30                	int    $0x30
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+
+00800fbe <sys_yield>:
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	57                   	push   %edi
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fcb:	74 26                	je     800ff3 <sys_yield+0x35>
+  800fcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fd7:	89 d1                	mov    %edx,%ecx
+  800fd9:	89 d3                	mov    %edx,%ebx
+  800fdb:	89 d7                	mov    %edx,%edi
+  800fdd:	6a 00                	push   $0x0
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	8d 35 ea 0f 80 00    	lea    0x800fea,%esi
+  800fe8:	0f 34                	sysenter
+  800fea:	5d                   	pop    %ebp
+  800feb:	83 c4 04             	add    $0x4,%esp
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+  800ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ffd:	89 d1                	mov    %edx,%ecx
+  800fff:	89 d3                	mov    %edx,%ebx
+  801001:	89 d7                	mov    %edx,%edi
+  801003:	89 d6                	mov    %edx,%esi
+  801005:	cd 30                	int    $0x30
+  801007:	eb e5                	jmp    800fee <sys_yield+0x30>
+
+00801009 <sys_page_alloc>:
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+  80100f:	83 ec 0c             	sub    $0xc,%esp
+  801012:	be 00 00 00 00       	mov    $0x0,%esi
+  801017:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801022:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801025:	89 f7                	mov    %esi,%edi
+  801027:	cd 30                	int    $0x30
+  801029:	85 c0                	test   %eax,%eax
+  80102b:	7f 08                	jg     801035 <sys_page_alloc+0x2c>
+  80102d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801030:	5b                   	pop    %ebx
+  801031:	5e                   	pop    %esi
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+  801035:	83 ec 0c             	sub    $0xc,%esp
+  801038:	50                   	push   %eax
+  801039:	6a 04                	push   $0x4
+  80103b:	68 db 37 80 00       	push   $0x8037db
+  801040:	6a 24                	push   $0x24
+  801042:	68 f8 37 80 00       	push   $0x8037f8
+  801047:	e8 9b f2 ff ff       	call   8002e7 <_panic>
+
+0080104c <sys_page_map>:
+  80104c:	55                   	push   %ebp
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	57                   	push   %edi
+  801050:	56                   	push   %esi
+  801051:	53                   	push   %ebx
+  801052:	83 ec 0c             	sub    $0xc,%esp
+  801055:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80105c:	74 33                	je     801091 <sys_page_map+0x45>
+  80105e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801061:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801064:	b8 05 00 00 00       	mov    $0x5,%eax
+  801069:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80106f:	ff 75 18             	push   0x18(%ebp)
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	8d 35 7d 10 80 00    	lea    0x80107d,%esi
+  80107b:	0f 34                	sysenter
+  80107d:	5d                   	pop    %ebp
+  80107e:	83 c4 04             	add    $0x4,%esp
+  801081:	89 c2                	mov    %eax,%edx
+  801083:	85 c0                	test   %eax,%eax
+  801085:	7f 3d                	jg     8010c4 <sys_page_map+0x78>
+  801087:	89 d0                	mov    %edx,%eax
+  801089:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108c:	5b                   	pop    %ebx
+  80108d:	5e                   	pop    %esi
+  80108e:	5f                   	pop    %edi
+  80108f:	5d                   	pop    %ebp
+  801090:	c3                   	ret
+  801091:	b8 05 00 00 00       	mov    $0x5,%eax
+  801096:	8b 55 08             	mov    0x8(%ebp),%edx
+  801099:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a5:	cd 30                	int    $0x30
+  8010a7:	89 c2                	mov    %eax,%edx
+  8010a9:	85 c0                	test   %eax,%eax
+  8010ab:	7e da                	jle    801087 <sys_page_map+0x3b>
+  8010ad:	83 ec 0c             	sub    $0xc,%esp
+  8010b0:	50                   	push   %eax
+  8010b1:	6a 05                	push   $0x5
+  8010b3:	68 db 37 80 00       	push   $0x8037db
+  8010b8:	6a 24                	push   $0x24
+  8010ba:	68 f8 37 80 00       	push   $0x8037f8
+  8010bf:	e8 23 f2 ff ff       	call   8002e7 <_panic>
+  8010c4:	83 ec 0c             	sub    $0xc,%esp
+  8010c7:	50                   	push   %eax
+  8010c8:	6a 05                	push   $0x5
+  8010ca:	68 db 37 80 00       	push   $0x8037db
+  8010cf:	6a 48                	push   $0x48
+  8010d1:	68 f8 37 80 00       	push   $0x8037f8
+  8010d6:	e8 0c f2 ff ff       	call   8002e7 <_panic>
+
+008010db <sys_page_unmap>:
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010f4:	89 df                	mov    %ebx,%edi
+  8010f6:	89 de                	mov    %ebx,%esi
+  8010f8:	cd 30                	int    $0x30
+  8010fa:	85 c0                	test   %eax,%eax
+  8010fc:	7f 08                	jg     801106 <sys_page_unmap+0x2b>
+  8010fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801101:	5b                   	pop    %ebx
+  801102:	5e                   	pop    %esi
+  801103:	5f                   	pop    %edi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+  801106:	83 ec 0c             	sub    $0xc,%esp
+  801109:	50                   	push   %eax
+  80110a:	6a 06                	push   $0x6
+  80110c:	68 db 37 80 00       	push   $0x8037db
+  801111:	6a 24                	push   $0x24
+  801113:	68 f8 37 80 00       	push   $0x8037f8
+  801118:	e8 ca f1 ff ff       	call   8002e7 <_panic>
+
+0080111d <sys_fork>:
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	57                   	push   %edi
+  801121:	56                   	push   %esi
+  801122:	53                   	push   %ebx
+  801123:	ba 00 00 00 00       	mov    $0x0,%edx
+  801128:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80112d:	89 d1                	mov    %edx,%ecx
+  80112f:	89 d3                	mov    %edx,%ebx
+  801131:	89 d7                	mov    %edx,%edi
+  801133:	89 d6                	mov    %edx,%esi
+  801135:	cd 30                	int    $0x30
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5f                   	pop    %edi
+  80113a:	5d                   	pop    %ebp
+  80113b:	c3                   	ret
+
+0080113c <sys_env_set_status>:
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+  801142:	83 ec 0c             	sub    $0xc,%esp
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	b8 08 00 00 00       	mov    $0x8,%eax
+  801155:	89 df                	mov    %ebx,%edi
+  801157:	89 de                	mov    %ebx,%esi
+  801159:	cd 30                	int    $0x30
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	7f 08                	jg     801167 <sys_env_set_status+0x2b>
+  80115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+  801167:	83 ec 0c             	sub    $0xc,%esp
+  80116a:	50                   	push   %eax
+  80116b:	6a 08                	push   $0x8
+  80116d:	68 db 37 80 00       	push   $0x8037db
+  801172:	6a 24                	push   $0x24
+  801174:	68 f8 37 80 00       	push   $0x8037f8
+  801179:	e8 69 f1 ff ff       	call   8002e7 <_panic>
+
+0080117e <sys_env_set_trapframe>:
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	57                   	push   %edi
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+  801184:	83 ec 0c             	sub    $0xc,%esp
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	b8 09 00 00 00       	mov    $0x9,%eax
+  801197:	89 df                	mov    %ebx,%edi
+  801199:	89 de                	mov    %ebx,%esi
+  80119b:	cd 30                	int    $0x30
+  80119d:	85 c0                	test   %eax,%eax
+  80119f:	7f 08                	jg     8011a9 <sys_env_set_trapframe+0x2b>
+  8011a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+  8011a9:	83 ec 0c             	sub    $0xc,%esp
+  8011ac:	50                   	push   %eax
+  8011ad:	6a 09                	push   $0x9
+  8011af:	68 db 37 80 00       	push   $0x8037db
+  8011b4:	6a 24                	push   $0x24
+  8011b6:	68 f8 37 80 00       	push   $0x8037f8
+  8011bb:	e8 27 f1 ff ff       	call   8002e7 <_panic>
+
+008011c0 <sys_env_set_cow>:
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	57                   	push   %edi
+  8011c4:	56                   	push   %esi
+  8011c5:	53                   	push   %ebx
+  8011c6:	83 ec 0c             	sub    $0xc,%esp
+  8011c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8011d9:	89 df                	mov    %ebx,%edi
+  8011db:	89 de                	mov    %ebx,%esi
+  8011dd:	cd 30                	int    $0x30
+  8011df:	85 c0                	test   %eax,%eax
+  8011e1:	7f 08                	jg     8011eb <sys_env_set_cow+0x2b>
+  8011e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+  8011ee:	50                   	push   %eax
+  8011ef:	6a 20                	push   $0x20
+  8011f1:	68 db 37 80 00       	push   $0x8037db
+  8011f6:	6a 24                	push   $0x24
+  8011f8:	68 f8 37 80 00       	push   $0x8037f8
+  8011fd:	e8 e5 f0 ff ff       	call   8002e7 <_panic>
+
+00801202 <sys_env_service>:
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	56                   	push   %esi
+  801207:	53                   	push   %ebx
+  801208:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801210:	b8 21 00 00 00       	mov    $0x21,%eax
+  801215:	89 cb                	mov    %ecx,%ebx
+  801217:	89 cf                	mov    %ecx,%edi
+  801219:	89 ce                	mov    %ecx,%esi
+  80121b:	cd 30                	int    $0x30
+  80121d:	5b                   	pop    %ebx
+  80121e:	5e                   	pop    %esi
+  80121f:	5f                   	pop    %edi
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+
+00801222 <sys_env_set_pgfault_upcall>:
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	57                   	push   %edi
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+  801228:	83 ec 0c             	sub    $0xc,%esp
+  80122b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801230:	8b 55 08             	mov    0x8(%ebp),%edx
+  801233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801236:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80123b:	89 df                	mov    %ebx,%edi
+  80123d:	89 de                	mov    %ebx,%esi
+  80123f:	cd 30                	int    $0x30
+  801241:	85 c0                	test   %eax,%eax
+  801243:	7f 08                	jg     80124d <sys_env_set_pgfault_upcall+0x2b>
+  801245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801248:	5b                   	pop    %ebx
+  801249:	5e                   	pop    %esi
+  80124a:	5f                   	pop    %edi
+  80124b:	5d                   	pop    %ebp
+  80124c:	c3                   	ret
+  80124d:	83 ec 0c             	sub    $0xc,%esp
+  801250:	50                   	push   %eax
+  801251:	6a 0a                	push   $0xa
+  801253:	68 db 37 80 00       	push   $0x8037db
+  801258:	6a 24                	push   $0x24
+  80125a:	68 f8 37 80 00       	push   $0x8037f8
+  80125f:	e8 83 f0 ff ff       	call   8002e7 <_panic>
+
+00801264 <sys_ipc_try_send>:
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+  80126a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801271:	74 27                	je     80129a <sys_ipc_try_send+0x36>
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801279:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80127e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801281:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801284:	6a 00                	push   $0x0
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	8d 35 91 12 80 00    	lea    0x801291,%esi
+  80128f:	0f 34                	sysenter
+  801291:	5d                   	pop    %ebp
+  801292:	83 c4 04             	add    $0x4,%esp
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+  80129a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80129f:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b0:	cd 30                	int    $0x30
+  8012b2:	eb e1                	jmp    801295 <sys_ipc_try_send+0x31>
+
+008012b4 <sys_ipc_recv>:
+  8012b4:	55                   	push   %ebp
+  8012b5:	89 e5                	mov    %esp,%ebp
+  8012b7:	57                   	push   %edi
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+  8012ba:	83 ec 0c             	sub    $0xc,%esp
+  8012bd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012c4:	74 32                	je     8012f8 <sys_ipc_recv+0x44>
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012d3:	89 cb                	mov    %ecx,%ebx
+  8012d5:	89 cf                	mov    %ecx,%edi
+  8012d7:	6a 00                	push   $0x0
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	8d 35 e4 12 80 00    	lea    0x8012e4,%esi
+  8012e2:	0f 34                	sysenter
+  8012e4:	5d                   	pop    %ebp
+  8012e5:	83 c4 04             	add    $0x4,%esp
+  8012e8:	89 c2                	mov    %eax,%edx
+  8012ea:	85 c0                	test   %eax,%eax
+  8012ec:	7f 3c                	jg     80132a <sys_ipc_recv+0x76>
+  8012ee:	89 d0                	mov    %edx,%eax
+  8012f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+  8012f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801302:	8b 55 08             	mov    0x8(%ebp),%edx
+  801305:	89 cb                	mov    %ecx,%ebx
+  801307:	89 cf                	mov    %ecx,%edi
+  801309:	89 ce                	mov    %ecx,%esi
+  80130b:	cd 30                	int    $0x30
+  80130d:	89 c2                	mov    %eax,%edx
+  80130f:	85 c0                	test   %eax,%eax
+  801311:	7e db                	jle    8012ee <sys_ipc_recv+0x3a>
+  801313:	83 ec 0c             	sub    $0xc,%esp
+  801316:	50                   	push   %eax
+  801317:	6a 0d                	push   $0xd
+  801319:	68 db 37 80 00       	push   $0x8037db
+  80131e:	6a 24                	push   $0x24
+  801320:	68 f8 37 80 00       	push   $0x8037f8
+  801325:	e8 bd ef ff ff       	call   8002e7 <_panic>
+  80132a:	83 ec 0c             	sub    $0xc,%esp
+  80132d:	50                   	push   %eax
+  80132e:	6a 0d                	push   $0xd
+  801330:	68 db 37 80 00       	push   $0x8037db
+  801335:	6a 48                	push   $0x48
+  801337:	68 f8 37 80 00       	push   $0x8037f8
+  80133c:	e8 a6 ef ff ff       	call   8002e7 <_panic>
+
+00801341 <sys_ipc_send>:
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	57                   	push   %edi
+  801345:	56                   	push   %esi
+  801346:	53                   	push   %ebx
+  801347:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80134e:	74 27                	je     801377 <sys_ipc_send+0x36>
+  801350:	8b 55 08             	mov    0x8(%ebp),%edx
+  801353:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801356:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80135b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801361:	6a 00                	push   $0x0
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	8d 35 6e 13 80 00    	lea    0x80136e,%esi
+  80136c:	0f 34                	sysenter
+  80136e:	5d                   	pop    %ebp
+  80136f:	83 c4 04             	add    $0x4,%esp
+  801372:	5b                   	pop    %ebx
+  801373:	5e                   	pop    %esi
+  801374:	5f                   	pop    %edi
+  801375:	5d                   	pop    %ebp
+  801376:	c3                   	ret
+  801377:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80137c:	be 00 00 00 00       	mov    $0x0,%esi
+  801381:	8b 55 08             	mov    0x8(%ebp),%edx
+  801384:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801387:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80138a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80138d:	cd 30                	int    $0x30
+  80138f:	eb e1                	jmp    801372 <sys_ipc_send+0x31>
+
+00801391 <sys_ipc_call>:
+  801391:	55                   	push   %ebp
+  801392:	89 e5                	mov    %esp,%ebp
+  801394:	57                   	push   %edi
+  801395:	56                   	push   %esi
+  801396:	53                   	push   %ebx
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013a8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013ab:	cd 30                	int    $0x30
+  8013ad:	5b                   	pop    %ebx
+  8013ae:	5e                   	pop    %esi
+  8013af:	5f                   	pop    %edi
+  8013b0:	5d                   	pop    %ebp
+  8013b1:	c3                   	ret
+
+008013b2 <sys_ipc_reply_recv>:
+  8013b2:	55                   	push   %ebp
+  8013b3:	89 e5                	mov    %esp,%ebp
+  8013b5:	57                   	push   %edi
+  8013b6:	56                   	push   %esi
+  8013b7:	53                   	push   %ebx
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013be:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013cc:	cd 30                	int    $0x30
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5e                   	pop    %esi
+  8013d0:	5f                   	pop    %edi
+  8013d1:	5d                   	pop    %ebp
+  8013d2:	c3                   	ret
+
+008013d3 <sys_time_msec>:
+  8013d3:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	75 06                	jne    8013e2 <sys_time_msec+0xf>
+  8013dc:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8013e1:	c3                   	ret
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+  8013e5:	57                   	push   %edi
+  8013e6:	56                   	push   %esi
+  8013e7:	53                   	push   %ebx
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+  8013eb:	0f 31                	rdtsc
+  8013ed:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8013f3:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8013f9:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8013ff:	29 c8                	sub    %ecx,%eax
+  801401:	19 da                	sbb    %ebx,%edx
+  801403:	bf 00 00 00 00       	mov    $0x0,%edi
+  801408:	57                   	push   %edi
+  801409:	56                   	push   %esi
+  80140a:	52                   	push   %edx
+  80140b:	50                   	push   %eax
+  80140c:	e8 d6 1e 00 00       	call   8032e7 <__udivdi3>
+  801411:	83 c4 10             	add    $0x10,%esp
+  801414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801417:	5b                   	pop    %ebx
+  801418:	5e                   	pop    %esi
+  801419:	5f                   	pop    %edi
+  80141a:	5d                   	pop    %ebp
+  80141b:	c3                   	ret
+
+0080141c <sys_env_swap>:
+  80141c:	55                   	push   %ebp
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	57                   	push   %edi
+  801420:	56                   	push   %esi
+  801421:	53                   	push   %ebx
+  801422:	83 ec 0c             	sub    $0xc,%esp
+  801425:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801432:	89 cb                	mov    %ecx,%ebx
+  801434:	89 cf                	mov    %ecx,%edi
+  801436:	89 ce                	mov    %ecx,%esi
+  801438:	cd 30                	int    $0x30
+  80143a:	85 c0                	test   %eax,%eax
+  80143c:	7f 08                	jg     801446 <sys_env_swap+0x2a>
+  80143e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5f                   	pop    %edi
+  801444:	5d                   	pop    %ebp
+  801445:	c3                   	ret
+  801446:	83 ec 0c             	sub    $0xc,%esp
+  801449:	50                   	push   %eax
+  80144a:	6a 12                	push   $0x12
+  80144c:	68 db 37 80 00       	push   $0x8037db
+  801451:	6a 24                	push   $0x24
+  801453:	68 f8 37 80 00       	push   $0x8037f8
+  801458:	e8 8a ee ff ff       	call   8002e7 <_panic>
+
+0080145d <sys_net_try_send>:
+  80145d:	55                   	push   %ebp
+  80145e:	89 e5                	mov    %esp,%ebp
+  801460:	57                   	push   %edi
+  801461:	56                   	push   %esi
+  801462:	53                   	push   %ebx
+  801463:	83 ec 0c             	sub    $0xc,%esp
+  801466:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801471:	b8 13 00 00 00       	mov    $0x13,%eax
+  801476:	89 df                	mov    %ebx,%edi
+  801478:	89 de                	mov    %ebx,%esi
+  80147a:	cd 30                	int    $0x30
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	7f 08                	jg     801488 <sys_net_try_send+0x2b>
+  801480:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801483:	5b                   	pop    %ebx
+  801484:	5e                   	pop    %esi
+  801485:	5f                   	pop    %edi
+  801486:	5d                   	pop    %ebp
+  801487:	c3                   	ret
+  801488:	83 ec 0c             	sub    $0xc,%esp
+  80148b:	50                   	push   %eax
+  80148c:	6a 13                	push   $0x13
+  80148e:	68 db 37 80 00       	push   $0x8037db
+  801493:	6a 24                	push   $0x24
+  801495:	68 f8 37 80 00       	push   $0x8037f8
+  80149a:	e8 48 ee ff ff       	call   8002e7 <_panic>
+
+0080149f <sys_net_try_receive>:
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	57                   	push   %edi
+  8014a3:	56                   	push   %esi
+  8014a4:	53                   	push   %ebx
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8014b8:	89 df                	mov    %ebx,%edi
+  8014ba:	89 de                	mov    %ebx,%esi
+  8014bc:	cd 30                	int    $0x30
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	7f 08                	jg     8014ca <sys_net_try_receive+0x2b>
+  8014c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+  8014ca:	83 ec 0c             	sub    $0xc,%esp
+  8014cd:	50                   	push   %eax
+  8014ce:	6a 14                	push   $0x14
+  8014d0:	68 db 37 80 00       	push   $0x8037db
+  8014d5:	6a 24                	push   $0x24
+  8014d7:	68 f8 37 80 00       	push   $0x8037f8
+  8014dc:	e8 06 ee ff ff       	call   8002e7 <_panic>
+
+008014e1 <sys_net_recv_page>:
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+  8014e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ef:	b8 27 00 00 00       	mov    $0x27,%eax
+  8014f4:	89 cb                	mov    %ecx,%ebx
+  8014f6:	89 cf                	mov    %ecx,%edi
+  8014f8:	89 ce                	mov    %ecx,%esi
+  8014fa:	cd 30                	int    $0x30
+  8014fc:	5b                   	pop    %ebx
+  8014fd:	5e                   	pop    %esi
+  8014fe:	5f                   	pop    %edi
+  8014ff:	5d                   	pop    %ebp
+  801500:	c3                   	ret
+
+00801501 <sys_net_wait>:
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	57                   	push   %edi
+  801505:	56                   	push   %esi
+  801506:	53                   	push   %ebx
+  801507:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150c:	b8 26 00 00 00       	mov    $0x26,%eax
+  801511:	89 d1                	mov    %edx,%ecx
+  801513:	89 d3                	mov    %edx,%ebx
+  801515:	89 d7                	mov    %edx,%edi
+  801517:	89 d6                	mov    %edx,%esi
+  801519:	cd 30                	int    $0x30
+  80151b:	5b                   	pop    %ebx
+  80151c:	5e                   	pop    %esi
+  80151d:	5f                   	pop    %edi
+  80151e:	5d                   	pop    %ebp
+  80151f:	c3                   	ret
+
+00801520 <sys_get_mac>:
+  801520:	55                   	push   %ebp
+  801521:	89 e5                	mov    %esp,%ebp
+  801523:	57                   	push   %edi
+  801524:	56                   	push   %esi
+  801525:	53                   	push   %ebx
+  801526:	83 ec 0c             	sub    $0xc,%esp
+  801529:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801531:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801534:	b8 15 00 00 00       	mov    $0x15,%eax
+  801539:	89 df                	mov    %ebx,%edi
+  80153b:	89 de                	mov    %ebx,%esi
+  80153d:	cd 30                	int    $0x30
+  80153f:	85 c0                	test   %eax,%eax
+  801541:	7f 08                	jg     80154b <sys_get_mac+0x2b>
+  801543:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801546:	5b                   	pop    %ebx
+  801547:	5e                   	pop    %esi
+  801548:	5f                   	pop    %edi
+  801549:	5d                   	pop    %ebp
+  80154a:	c3                   	ret
+  80154b:	83 ec 0c             	sub    $0xc,%esp
+  80154e:	50                   	push   %eax
+  80154f:	6a 15                	push   $0x15
+  801551:	68 db 37 80 00       	push   $0x8037db
+  801556:	6a 24                	push   $0x24
+  801558:	68 f8 37 80 00       	push   $0x8037f8
+  80155d:	e8 85 ed ff ff       	call   8002e7 <_panic>
+
+00801562 <sys_env_lease>:
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	57                   	push   %edi
+  801566:	56                   	push   %esi
+  801567:	53                   	push   %ebx
+  801568:	83 ec 0c             	sub    $0xc,%esp
+  80156b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801570:	8b 55 08             	mov    0x8(%ebp),%edx
+  801573:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801576:	b8 16 00 00 00       	mov    $0x16,%eax
+  80157b:	89 df                	mov    %ebx,%edi
+  80157d:	89 de                	mov    %ebx,%esi
+  80157f:	cd 30                	int    $0x30
+  801581:	85 c0                	test   %eax,%eax
+  801583:	7f 08                	jg     80158d <sys_env_lease+0x2b>
+  801585:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801588:	5b                   	pop    %ebx
+  801589:	5e                   	pop    %esi
+  80158a:	5f                   	pop    %edi
+  80158b:	5d                   	pop    %ebp
+  80158c:	c3                   	ret
+  80158d:	83 ec 0c             	sub    $0xc,%esp
+  801590:	50                   	push   %eax
+  801591:	6a 16                	push   $0x16
+  801593:	68 db 37 80 00       	push   $0x8037db
+  801598:	6a 24                	push   $0x24
+  80159a:	68 f8 37 80 00       	push   $0x8037f8
+  80159f:	e8 43 ed ff ff       	call   8002e7 <_panic>
+
+008015a4 <sys_copy_mem>:
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	57                   	push   %edi
+  8015a8:	56                   	push   %esi
+  8015a9:	53                   	push   %ebx
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+  8015ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b3:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015bb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015be:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015c1:	cd 30                	int    $0x30
+  8015c3:	85 c0                	test   %eax,%eax
+  8015c5:	7f 08                	jg     8015cf <sys_copy_mem+0x2b>
+  8015c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ca:	5b                   	pop    %ebx
+  8015cb:	5e                   	pop    %esi
+  8015cc:	5f                   	pop    %edi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+  8015cf:	83 ec 0c             	sub    $0xc,%esp
+  8015d2:	50                   	push   %eax
+  8015d3:	6a 17                	push   $0x17
+  8015d5:	68 db 37 80 00       	push   $0x8037db
+  8015da:	6a 24                	push   $0x24
+  8015dc:	68 f8 37 80 00       	push   $0x8037f8
+  8015e1:	e8 01 ed ff ff       	call   8002e7 <_panic>
+
+008015e6 <sys_get_perms>:
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	57                   	push   %edi
+  8015ea:	56                   	push   %esi
+  8015eb:	53                   	push   %ebx
+  8015ec:	83 ec 0c             	sub    $0xc,%esp
+  8015ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fa:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801602:	89 f7                	mov    %esi,%edi
+  801604:	cd 30                	int    $0x30
+  801606:	85 c0                	test   %eax,%eax
+  801608:	7f 08                	jg     801612 <sys_get_perms+0x2c>
+  80160a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5f                   	pop    %edi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+  801612:	83 ec 0c             	sub    $0xc,%esp
+  801615:	50                   	push   %eax
+  801616:	6a 18                	push   $0x18
+  801618:	68 db 37 80 00       	push   $0x8037db
+  80161d:	6a 24                	push   $0x24
+  80161f:	68 f8 37 80 00       	push   $0x8037f8
+  801624:	e8 be ec ff ff       	call   8002e7 <_panic>
+
+00801629 <sys_env_unsuspend>:
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	57                   	push   %edi
+  80162d:	56                   	push   %esi
+  80162e:	53                   	push   %ebx
+  80162f:	83 ec 0c             	sub    $0xc,%esp
+  801632:	be 00 00 00 00       	mov    $0x0,%esi
+  801637:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801642:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801645:	89 f7                	mov    %esi,%edi
+  801647:	cd 30                	int    $0x30
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	7f 08                	jg     801655 <sys_env_unsuspend+0x2c>
+  80164d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5f                   	pop    %edi
+  801653:	5d                   	pop    %ebp
+  801654:	c3                   	ret
+  801655:	83 ec 0c             	sub    $0xc,%esp
+  801658:	50                   	push   %eax
+  801659:	6a 19                	push   $0x19
+  80165b:	68 db 37 80 00       	push   $0x8037db
+  801660:	6a 24                	push   $0x24
+  801662:	68 f8 37 80 00       	push   $0x8037f8
+  801667:	e8 7b ec ff ff       	call   8002e7 <_panic>
+
+0080166c <sys_migrate>:
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  80166f:	57                   	push   %edi
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+  801672:	83 ec 0c             	sub    $0xc,%esp
+  801675:	ba 00 80 80 00       	mov    $0x808000,%edx
+  80167a:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801680:	76 11                	jbe    801693 <sys_migrate+0x27>
+  801682:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801687:	0f b6 08             	movzbl (%eax),%ecx
+  80168a:	05 00 10 00 00       	add    $0x1000,%eax
+  80168f:	39 d0                	cmp    %edx,%eax
+  801691:	72 f4                	jb     801687 <sys_migrate+0x1b>
+  801693:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801698:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8016a0:	89 cb                	mov    %ecx,%ebx
+  8016a2:	89 cf                	mov    %ecx,%edi
+  8016a4:	89 ce                	mov    %ecx,%esi
+  8016a6:	cd 30                	int    $0x30
+  8016a8:	85 c0                	test   %eax,%eax
+  8016aa:	7f 08                	jg     8016b4 <sys_migrate+0x48>
+  8016ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016af:	5b                   	pop    %ebx
+  8016b0:	5e                   	pop    %esi
+  8016b1:	5f                   	pop    %edi
+  8016b2:	5d                   	pop    %ebp
+  8016b3:	c3                   	ret
+  8016b4:	83 ec 0c             	sub    $0xc,%esp
+  8016b7:	50                   	push   %eax
+  8016b8:	6a 1a                	push   $0x1a
+  8016ba:	68 db 37 80 00       	push   $0x8037db
+  8016bf:	6a 24                	push   $0x24
+  8016c1:	68 f8 37 80 00       	push   $0x8037f8
+  8016c6:	e8 1c ec ff ff       	call   8002e7 <_panic>
+
+008016cb <sys_lease_complete>:
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	57                   	push   %edi
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+  8016d1:	83 ec 0c             	sub    $0xc,%esp
+  8016d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8016de:	89 d1                	mov    %edx,%ecx
+  8016e0:	89 d3                	mov    %edx,%ebx
+  8016e2:	89 d7                	mov    %edx,%edi
+  8016e4:	89 d6                	mov    %edx,%esi
+  8016e6:	cd 30                	int    $0x30
+  8016e8:	85 c0                	test   %eax,%eax
+  8016ea:	7f 08                	jg     8016f4 <sys_lease_complete+0x29>
+  8016ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ef:	5b                   	pop    %ebx
+  8016f0:	5e                   	pop    %esi
+  8016f1:	5f                   	pop    %edi
+  8016f2:	5d                   	pop    %ebp
+  8016f3:	c3                   	ret
+  8016f4:	83 ec 0c             	sub    $0xc,%esp
+  8016f7:	50                   	push   %eax
+  8016f8:	6a 1b                	push   $0x1b
+  8016fa:	68 db 37 80 00       	push   $0x8037db
+  8016ff:	6a 24                	push   $0x24
+  801701:	68 f8 37 80 00       	push   $0x8037f8
+  801706:	e8 dc eb ff ff       	call   8002e7 <_panic>
+
+0080170b <sys_env_set_thisenv>:
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	57                   	push   %edi
+  80170f:	56                   	push   %esi
+  801710:	53                   	push   %ebx
+  801711:	83 ec 0c             	sub    $0xc,%esp
+  801714:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801719:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801724:	89 df                	mov    %ebx,%edi
+  801726:	89 de                	mov    %ebx,%esi
+  801728:	cd 30                	int    $0x30
+  80172a:	85 c0                	test   %eax,%eax
+  80172c:	7f 08                	jg     801736 <sys_env_set_thisenv+0x2b>
+  80172e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801731:	5b                   	pop    %ebx
+  801732:	5e                   	pop    %esi
+  801733:	5f                   	pop    %edi
+  801734:	5d                   	pop    %ebp
+  801735:	c3                   	ret
+  801736:	83 ec 0c             	sub    $0xc,%esp
+  801739:	50                   	push   %eax
+  80173a:	6a 1c                	push   $0x1c
+  80173c:	68 db 37 80 00       	push   $0x8037db
+  801741:	6a 24                	push   $0x24
+  801743:	68 f8 37 80 00       	push   $0x8037f8
+  801748:	e8 9a eb ff ff       	call   8002e7 <_panic>
+
+0080174d <sys_env_set_sched>:
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	57                   	push   %edi
+  801751:	56                   	push   %esi
+  801752:	53                   	push   %ebx
+  801753:	83 ec 0c             	sub    $0xc,%esp
+  801756:	be 00 00 00 00       	mov    $0x0,%esi
+  80175b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801761:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801766:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801769:	89 f7                	mov    %esi,%edi
+  80176b:	cd 30                	int    $0x30
+  80176d:	85 c0                	test   %eax,%eax
+  80176f:	7f 08                	jg     801779 <sys_env_set_sched+0x2c>
+  801771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801774:	5b                   	pop    %ebx
+  801775:	5e                   	pop    %esi
+  801776:	5f                   	pop    %edi
+  801777:	5d                   	pop    %ebp
+  801778:	c3                   	ret
+  801779:	83 ec 0c             	sub    $0xc,%esp
+  80177c:	50                   	push   %eax
+  80177d:	6a 1d                	push   $0x1d
+  80177f:	68 db 37 80 00       	push   $0x8037db
+  801784:	6a 24                	push   $0x24
+  801786:	68 f8 37 80 00       	push   $0x8037f8
+  80178b:	e8 57 eb ff ff       	call   8002e7 <_panic>
+
+00801790 <sys_batch>:
+  801790:	55                   	push   %ebp
+  801791:	89 e5                	mov    %esp,%ebp
+  801793:	57                   	push   %edi
+  801794:	56                   	push   %esi
+  801795:	53                   	push   %ebx
+  801796:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8017a6:	89 df                	mov    %ebx,%edi
+  8017a8:	89 de                	mov    %ebx,%esi
+  8017aa:	cd 30                	int    $0x30
+  8017ac:	5b                   	pop    %ebx
+  8017ad:	5e                   	pop    %esi
+  8017ae:	5f                   	pop    %edi
+  8017af:	5d                   	pop    %ebp
+  8017b0:	c3                   	ret
+
+008017b1 <sys_env_stats>:
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	57                   	push   %edi
+  8017b5:	56                   	push   %esi
+  8017b6:	53                   	push   %ebx
+  8017b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c2:	b8 23 00 00 00       	mov    $0x23,%eax
+  8017c7:	89 df                	mov    %ebx,%edi
+  8017c9:	89 de                	mov    %ebx,%esi
+  8017cb:	cd 30                	int    $0x30
+  8017cd:	5b                   	pop    %ebx
+  8017ce:	5e                   	pop    %esi
+  8017cf:	5f                   	pop    %edi
+  8017d0:	5d                   	pop    %ebp
+  8017d1:	c3                   	ret
+
+008017d2 <sys_trace>:
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	57                   	push   %edi
+  8017d6:	56                   	push   %esi
+  8017d7:	53                   	push   %ebx
+  8017d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e0:	b8 24 00 00 00       	mov    $0x24,%eax
+  8017e5:	89 cb                	mov    %ecx,%ebx
+  8017e7:	89 cf                	mov    %ecx,%edi
+  8017e9:	89 ce                	mov    %ecx,%esi
+  8017eb:	cd 30                	int    $0x30
+  8017ed:	5b                   	pop    %ebx
+  8017ee:	5e                   	pop    %esi
+  8017ef:	5f                   	pop    %edi
+  8017f0:	5d                   	pop    %ebp
+  8017f1:	c3                   	ret
+
+008017f2 <sys_env_set_pager>:
+  8017f2:	55                   	push   %ebp
+  8017f3:	89 e5                	mov    %esp,%ebp
+  8017f5:	57                   	push   %edi
+  8017f6:	56                   	push   %esi
+  8017f7:	53                   	push   %ebx
+  8017f8:	83 ec 0c             	sub    $0xc,%esp
+  8017fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801800:	8b 55 08             	mov    0x8(%ebp),%edx
+  801803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801806:	b8 25 00 00 00       	mov    $0x25,%eax
+  80180b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80180e:	89 f7                	mov    %esi,%edi
+  801810:	cd 30                	int    $0x30
+  801812:	85 c0                	test   %eax,%eax
+  801814:	7f 08                	jg     80181e <sys_env_set_pager+0x2c>
+  801816:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801819:	5b                   	pop    %ebx
+  80181a:	5e                   	pop    %esi
+  80181b:	5f                   	pop    %edi
+  80181c:	5d                   	pop    %ebp
+  80181d:	c3                   	ret
+  80181e:	83 ec 0c             	sub    $0xc,%esp
+  801821:	50                   	push   %eax
+  801822:	6a 25                	push   $0x25
+  801824:	68 db 37 80 00       	push   $0x8037db
+  801829:	6a 24                	push   $0x24
+  80182b:	68 f8 37 80 00       	push   $0x8037f8
+  801830:	e8 b2 ea ff ff       	call   8002e7 <_panic>
+
+00801835 <sys_pager_retire>:
+  801835:	55                   	push   %ebp
+  801836:	89 e5                	mov    %esp,%ebp
+  801838:	57                   	push   %edi
+  801839:	56                   	push   %esi
+  80183a:	53                   	push   %ebx
+  80183b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801840:	8b 55 08             	mov    0x8(%ebp),%edx
+  801843:	b8 28 00 00 00       	mov    $0x28,%eax
+  801848:	89 cb                	mov    %ecx,%ebx
+  80184a:	89 cf                	mov    %ecx,%edi
+  80184c:	89 ce                	mov    %ecx,%esi
+  80184e:	cd 30                	int    $0x30
+  801850:	5b                   	pop    %ebx
+  801851:	5e                   	pop    %esi
+  801852:	5f                   	pop    %edi
+  801853:	5d                   	pop    %ebp
+  801854:	c3                   	ret
+
+00801855 <sys_prof>:
+  801855:	55                   	push   %ebp
+  801856:	89 e5                	mov    %esp,%ebp
+  801858:	57                   	push   %edi
+  801859:	56                   	push   %esi
+  80185a:	53                   	push   %ebx
+  80185b:	be 00 00 00 00       	mov    $0x0,%esi
+  801860:	8b 55 08             	mov    0x8(%ebp),%edx
+  801863:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801866:	b8 22 00 00 00       	mov    $0x22,%eax
+  80186b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186e:	89 f7                	mov    %esi,%edi
+  801870:	cd 30                	int    $0x30
+  801872:	5b                   	pop    %ebx
+  801873:	5e                   	pop    %esi
+  801874:	5f                   	pop    %edi
+  801875:	5d                   	pop    %ebp
+  801876:	c3                   	ret
+
+00801877 <fd2num>:
+  801877:	55                   	push   %ebp
+  801878:	89 e5                	mov    %esp,%ebp
+  80187a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801882:	c1 e8 0c             	shr    $0xc,%eax
+  801885:	5d                   	pop    %ebp
+  801886:	c3                   	ret
+
+00801887 <fd2data>:
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801892:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801897:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+
+0080189e <fd_alloc>:
+  80189e:	55                   	push   %ebp
+  80189f:	89 e5                	mov    %esp,%ebp
+  8018a1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018a6:	89 c2                	mov    %eax,%edx
+  8018a8:	c1 ea 16             	shr    $0x16,%edx
+  8018ab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018b2:	f6 c2 01             	test   $0x1,%dl
+  8018b5:	74 29                	je     8018e0 <fd_alloc+0x42>
+  8018b7:	89 c2                	mov    %eax,%edx
+  8018b9:	c1 ea 0c             	shr    $0xc,%edx
+  8018bc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018c3:	f6 c2 01             	test   $0x1,%dl
+  8018c6:	74 18                	je     8018e0 <fd_alloc+0x42>
+  8018c8:	05 00 10 00 00       	add    $0x1000,%eax
+  8018cd:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8018d2:	75 d2                	jne    8018a6 <fd_alloc+0x8>
+  8018d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018de:	eb 05                	jmp    8018e5 <fd_alloc+0x47>
+  8018e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e8:	89 02                	mov    %eax,(%edx)
+  8018ea:	89 c8                	mov    %ecx,%eax
+  8018ec:	5d                   	pop    %ebp
+  8018ed:	c3                   	ret
+
+008018ee <fd_lookup>:
+  8018ee:	55                   	push   %ebp
+  8018ef:	89 e5                	mov    %esp,%ebp
+  8018f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f4:	83 f8 1f             	cmp    $0x1f,%eax
+  8018f7:	77 30                	ja     801929 <fd_lookup+0x3b>
+  8018f9:	c1 e0 0c             	shl    $0xc,%eax
+  8018fc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801901:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801907:	f6 c2 01             	test   $0x1,%dl
+  80190a:	74 24                	je     801930 <fd_lookup+0x42>
+  80190c:	89 c2                	mov    %eax,%edx
+  80190e:	c1 ea 0c             	shr    $0xc,%edx
+  801911:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801918:	f6 c2 01             	test   $0x1,%dl
+  80191b:	74 1a                	je     801937 <fd_lookup+0x49>
+  80191d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801920:	89 02                	mov    %eax,(%edx)
+  801922:	b8 00 00 00 00       	mov    $0x0,%eax
+  801927:	5d                   	pop    %ebp
+  801928:	c3                   	ret
+  801929:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80192e:	eb f7                	jmp    801927 <fd_lookup+0x39>
+  801930:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801935:	eb f0                	jmp    801927 <fd_lookup+0x39>
+  801937:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193c:	eb e9                	jmp    801927 <fd_lookup+0x39>
+
+0080193e <dev_lookup>:
+  80193e:	55                   	push   %ebp
+  80193f:	89 e5                	mov    %esp,%ebp
+  801941:	53                   	push   %ebx
+  801942:	83 ec 04             	sub    $0x4,%esp
+  801945:	8b 55 08             	mov    0x8(%ebp),%edx
+  801948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194d:	bb 20 40 80 00       	mov    $0x804020,%ebx
+  801952:	39 13                	cmp    %edx,(%ebx)
+  801954:	74 37                	je     80198d <dev_lookup+0x4f>
+  801956:	83 c0 01             	add    $0x1,%eax
+  801959:	8b 1c 85 84 38 80 00 	mov    0x803884(,%eax,4),%ebx
+  801960:	85 db                	test   %ebx,%ebx
+  801962:	75 ee                	jne    801952 <dev_lookup+0x14>
+  801964:	a1 10 54 80 00       	mov    0x805410,%eax
+  801969:	8b 40 48             	mov    0x48(%eax),%eax
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	52                   	push   %edx
+  801970:	50                   	push   %eax
+  801971:	68 08 38 80 00       	push   $0x803808
+  801976:	e8 47 ea ff ff       	call   8003c2 <cprintf>
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801983:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801986:	89 1a                	mov    %ebx,(%edx)
+  801988:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80198b:	c9                   	leave
+  80198c:	c3                   	ret
+  80198d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801992:	eb ef                	jmp    801983 <dev_lookup+0x45>
+
+00801994 <fd_close>:
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+  801997:	57                   	push   %edi
+  801998:	56                   	push   %esi
+  801999:	53                   	push   %ebx
+  80199a:	83 ec 24             	sub    $0x24,%esp
+  80199d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8019a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019a6:	50                   	push   %eax
+  8019a7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019ad:	c1 e8 0c             	shr    $0xc,%eax
+  8019b0:	50                   	push   %eax
+  8019b1:	e8 38 ff ff ff       	call   8018ee <fd_lookup>
+  8019b6:	89 c3                	mov    %eax,%ebx
+  8019b8:	83 c4 10             	add    $0x10,%esp
+  8019bb:	85 c0                	test   %eax,%eax
+  8019bd:	78 05                	js     8019c4 <fd_close+0x30>
+  8019bf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019c2:	74 0f                	je     8019d3 <fd_close+0x3f>
+  8019c4:	85 ff                	test   %edi,%edi
+  8019c6:	0f 44 df             	cmove  %edi,%ebx
+  8019c9:	89 d8                	mov    %ebx,%eax
+  8019cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ce:	5b                   	pop    %ebx
+  8019cf:	5e                   	pop    %esi
+  8019d0:	5f                   	pop    %edi
+  8019d1:	5d                   	pop    %ebp
+  8019d2:	c3                   	ret
+  8019d3:	83 ec 08             	sub    $0x8,%esp
+  8019d6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019d9:	50                   	push   %eax
+  8019da:	ff 36                	push   (%esi)
+  8019dc:	e8 5d ff ff ff       	call   80193e <dev_lookup>
+  8019e1:	89 c3                	mov    %eax,%ebx
+  8019e3:	83 c4 10             	add    $0x10,%esp
+  8019e6:	85 c0                	test   %eax,%eax
+  8019e8:	78 1a                	js     801a04 <fd_close+0x70>
+  8019ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019ed:	8b 40 10             	mov    0x10(%eax),%eax
+  8019f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f5:	85 c0                	test   %eax,%eax
+  8019f7:	74 0b                	je     801a04 <fd_close+0x70>
+  8019f9:	83 ec 0c             	sub    $0xc,%esp
+  8019fc:	56                   	push   %esi
+  8019fd:	ff d0                	call   *%eax
+  8019ff:	89 c3                	mov    %eax,%ebx
+  801a01:	83 c4 10             	add    $0x10,%esp
+  801a04:	83 ec 08             	sub    $0x8,%esp
+  801a07:	56                   	push   %esi
+  801a08:	6a 00                	push   $0x0
+  801a0a:	e8 cc f6 ff ff       	call   8010db <sys_page_unmap>
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  801a12:	eb b5                	jmp    8019c9 <fd_close+0x35>
+
+00801a14 <close>:
+  801a14:	55                   	push   %ebp
+  801a15:	89 e5                	mov    %esp,%ebp
+  801a17:	83 ec 20             	sub    $0x20,%esp
+  801a1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a1d:	50                   	push   %eax
+  801a1e:	ff 75 08             	push   0x8(%ebp)
+  801a21:	e8 c8 fe ff ff       	call   8018ee <fd_lookup>
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	85 c0                	test   %eax,%eax
+  801a2b:	79 02                	jns    801a2f <close+0x1b>
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+  801a2f:	83 ec 08             	sub    $0x8,%esp
+  801a32:	6a 01                	push   $0x1
+  801a34:	ff 75 f4             	push   -0xc(%ebp)
+  801a37:	e8 58 ff ff ff       	call   801994 <fd_close>
+  801a3c:	83 c4 10             	add    $0x10,%esp
+  801a3f:	eb ec                	jmp    801a2d <close+0x19>
+
+00801a41 <close_all>:
+  801a41:	55                   	push   %ebp
+  801a42:	89 e5                	mov    %esp,%ebp
+  801a44:	53                   	push   %ebx
+  801a45:	83 ec 04             	sub    $0x4,%esp
+  801a48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a4d:	83 ec 0c             	sub    $0xc,%esp
+  801a50:	53                   	push   %ebx
+  801a51:	e8 be ff ff ff       	call   801a14 <close>
+  801a56:	83 c3 01             	add    $0x1,%ebx
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	83 fb 20             	cmp    $0x20,%ebx
+  801a5f:	75 ec                	jne    801a4d <close_all+0xc>
+  801a61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a64:	c9                   	leave
+  801a65:	c3                   	ret
+
+00801a66 <dup>:
+  801a66:	55                   	push   %ebp
+  801a67:	89 e5                	mov    %esp,%ebp
+  801a69:	57                   	push   %edi
+  801a6a:	56                   	push   %esi
+  801a6b:	53                   	push   %ebx
+  801a6c:	83 ec 34             	sub    $0x34,%esp
+  801a6f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a72:	50                   	push   %eax
+  801a73:	ff 75 08             	push   0x8(%ebp)
+  801a76:	e8 73 fe ff ff       	call   8018ee <fd_lookup>
+  801a7b:	89 c3                	mov    %eax,%ebx
+  801a7d:	83 c4 10             	add    $0x10,%esp
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	78 7f                	js     801b03 <dup+0x9d>
+  801a84:	83 ec 0c             	sub    $0xc,%esp
+  801a87:	ff 75 0c             	push   0xc(%ebp)
+  801a8a:	e8 85 ff ff ff       	call   801a14 <close>
+  801a8f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a92:	c1 e6 0c             	shl    $0xc,%esi
+  801a95:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801a9b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a9e:	89 3c 24             	mov    %edi,(%esp)
+  801aa1:	e8 e1 fd ff ff       	call   801887 <fd2data>
+  801aa6:	89 c3                	mov    %eax,%ebx
+  801aa8:	89 34 24             	mov    %esi,(%esp)
+  801aab:	e8 d7 fd ff ff       	call   801887 <fd2data>
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ab6:	89 d8                	mov    %ebx,%eax
+  801ab8:	c1 e8 16             	shr    $0x16,%eax
+  801abb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ac2:	a8 01                	test   $0x1,%al
+  801ac4:	74 11                	je     801ad7 <dup+0x71>
+  801ac6:	89 d8                	mov    %ebx,%eax
+  801ac8:	c1 e8 0c             	shr    $0xc,%eax
+  801acb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ad2:	f6 c2 01             	test   $0x1,%dl
+  801ad5:	75 36                	jne    801b0d <dup+0xa7>
+  801ad7:	89 f8                	mov    %edi,%eax
+  801ad9:	c1 e8 0c             	shr    $0xc,%eax
+  801adc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ae3:	83 ec 0c             	sub    $0xc,%esp
+  801ae6:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aeb:	50                   	push   %eax
+  801aec:	56                   	push   %esi
+  801aed:	6a 00                	push   $0x0
+  801aef:	57                   	push   %edi
+  801af0:	6a 00                	push   $0x0
+  801af2:	e8 55 f5 ff ff       	call   80104c <sys_page_map>
+  801af7:	89 c3                	mov    %eax,%ebx
+  801af9:	83 c4 20             	add    $0x20,%esp
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 33                	js     801b33 <dup+0xcd>
+  801b00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b03:	89 d8                	mov    %ebx,%eax
+  801b05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b08:	5b                   	pop    %ebx
+  801b09:	5e                   	pop    %esi
+  801b0a:	5f                   	pop    %edi
+  801b0b:	5d                   	pop    %ebp
+  801b0c:	c3                   	ret
+  801b0d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b14:	83 ec 0c             	sub    $0xc,%esp
+  801b17:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b1c:	50                   	push   %eax
+  801b1d:	ff 75 d4             	push   -0x2c(%ebp)
+  801b20:	6a 00                	push   $0x0
+  801b22:	53                   	push   %ebx
+  801b23:	6a 00                	push   $0x0
+  801b25:	e8 22 f5 ff ff       	call   80104c <sys_page_map>
+  801b2a:	89 c3                	mov    %eax,%ebx
+  801b2c:	83 c4 20             	add    $0x20,%esp
+  801b2f:	85 c0                	test   %eax,%eax
+  801b31:	79 a4                	jns    801ad7 <dup+0x71>
+  801b33:	83 ec 08             	sub    $0x8,%esp
+  801b36:	56                   	push   %esi
+  801b37:	6a 00                	push   $0x0
+  801b39:	e8 9d f5 ff ff       	call   8010db <sys_page_unmap>
+  801b3e:	83 c4 08             	add    $0x8,%esp
+  801b41:	ff 75 d4             	push   -0x2c(%ebp)
+  801b44:	6a 00                	push   $0x0
+  801b46:	e8 90 f5 ff ff       	call   8010db <sys_page_unmap>
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	eb b3                	jmp    801b03 <dup+0x9d>
+
+00801b50 <read>:
+  801b50:	55                   	push   %ebp
+  801b51:	89 e5                	mov    %esp,%ebp
+  801b53:	56                   	push   %esi
+  801b54:	53                   	push   %ebx
+  801b55:	83 ec 18             	sub    $0x18,%esp
+  801b58:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b5b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b5e:	50                   	push   %eax
+  801b5f:	56                   	push   %esi
+  801b60:	e8 89 fd ff ff       	call   8018ee <fd_lookup>
+  801b65:	83 c4 10             	add    $0x10,%esp
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	78 3c                	js     801ba8 <read+0x58>
+  801b6c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b6f:	83 ec 08             	sub    $0x8,%esp
+  801b72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b75:	50                   	push   %eax
+  801b76:	ff 33                	push   (%ebx)
+  801b78:	e8 c1 fd ff ff       	call   80193e <dev_lookup>
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	78 24                	js     801ba8 <read+0x58>
+  801b84:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b87:	83 e0 03             	and    $0x3,%eax
+  801b8a:	83 f8 01             	cmp    $0x1,%eax
+  801b8d:	74 20                	je     801baf <read+0x5f>
+  801b8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b92:	8b 40 08             	mov    0x8(%eax),%eax
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	74 37                	je     801bd0 <read+0x80>
+  801b99:	83 ec 04             	sub    $0x4,%esp
+  801b9c:	ff 75 10             	push   0x10(%ebp)
+  801b9f:	ff 75 0c             	push   0xc(%ebp)
+  801ba2:	53                   	push   %ebx
+  801ba3:	ff d0                	call   *%eax
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bab:	5b                   	pop    %ebx
+  801bac:	5e                   	pop    %esi
+  801bad:	5d                   	pop    %ebp
+  801bae:	c3                   	ret
+  801baf:	a1 10 54 80 00       	mov    0x805410,%eax
+  801bb4:	8b 40 48             	mov    0x48(%eax),%eax
+  801bb7:	83 ec 04             	sub    $0x4,%esp
+  801bba:	56                   	push   %esi
+  801bbb:	50                   	push   %eax
+  801bbc:	68 49 38 80 00       	push   $0x803849
+  801bc1:	e8 fc e7 ff ff       	call   8003c2 <cprintf>
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bce:	eb d8                	jmp    801ba8 <read+0x58>
+  801bd0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd5:	eb d1                	jmp    801ba8 <read+0x58>
+
+00801bd7 <readn>:
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	57                   	push   %edi
+  801bdb:	56                   	push   %esi
+  801bdc:	53                   	push   %ebx
+  801bdd:	83 ec 0c             	sub    $0xc,%esp
+  801be0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801be3:	8b 75 10             	mov    0x10(%ebp),%esi
+  801be6:	85 f6                	test   %esi,%esi
+  801be8:	74 30                	je     801c1a <readn+0x43>
+  801bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf4:	83 ec 04             	sub    $0x4,%esp
+  801bf7:	89 f2                	mov    %esi,%edx
+  801bf9:	29 c2                	sub    %eax,%edx
+  801bfb:	52                   	push   %edx
+  801bfc:	01 f8                	add    %edi,%eax
+  801bfe:	50                   	push   %eax
+  801bff:	ff 75 08             	push   0x8(%ebp)
+  801c02:	e8 49 ff ff ff       	call   801b50 <read>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 15                	js     801c23 <readn+0x4c>
+  801c0e:	74 11                	je     801c21 <readn+0x4a>
+  801c10:	01 c3                	add    %eax,%ebx
+  801c12:	89 d8                	mov    %ebx,%eax
+  801c14:	39 f3                	cmp    %esi,%ebx
+  801c16:	72 dc                	jb     801bf4 <readn+0x1d>
+  801c18:	eb 09                	jmp    801c23 <readn+0x4c>
+  801c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1f:	eb 02                	jmp    801c23 <readn+0x4c>
+  801c21:	89 d8                	mov    %ebx,%eax
+  801c23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c26:	5b                   	pop    %ebx
+  801c27:	5e                   	pop    %esi
+  801c28:	5f                   	pop    %edi
+  801c29:	5d                   	pop    %ebp
+  801c2a:	c3                   	ret
+
+00801c2b <write>:
+  801c2b:	55                   	push   %ebp
+  801c2c:	89 e5                	mov    %esp,%ebp
+  801c2e:	56                   	push   %esi
+  801c2f:	53                   	push   %ebx
+  801c30:	83 ec 18             	sub    $0x18,%esp
+  801c33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c36:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c39:	50                   	push   %eax
+  801c3a:	53                   	push   %ebx
+  801c3b:	e8 ae fc ff ff       	call   8018ee <fd_lookup>
+  801c40:	83 c4 10             	add    $0x10,%esp
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	78 37                	js     801c7e <write+0x53>
+  801c47:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c4a:	83 ec 08             	sub    $0x8,%esp
+  801c4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c50:	50                   	push   %eax
+  801c51:	ff 36                	push   (%esi)
+  801c53:	e8 e6 fc ff ff       	call   80193e <dev_lookup>
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	78 1f                	js     801c7e <write+0x53>
+  801c5f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c63:	74 20                	je     801c85 <write+0x5a>
+  801c65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c68:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	74 37                	je     801ca6 <write+0x7b>
+  801c6f:	83 ec 04             	sub    $0x4,%esp
+  801c72:	ff 75 10             	push   0x10(%ebp)
+  801c75:	ff 75 0c             	push   0xc(%ebp)
+  801c78:	56                   	push   %esi
+  801c79:	ff d0                	call   *%eax
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c81:	5b                   	pop    %ebx
+  801c82:	5e                   	pop    %esi
+  801c83:	5d                   	pop    %ebp
+  801c84:	c3                   	ret
+  801c85:	a1 10 54 80 00       	mov    0x805410,%eax
+  801c8a:	8b 40 48             	mov    0x48(%eax),%eax
+  801c8d:	83 ec 04             	sub    $0x4,%esp
+  801c90:	53                   	push   %ebx
+  801c91:	50                   	push   %eax
+  801c92:	68 65 38 80 00       	push   $0x803865
+  801c97:	e8 26 e7 ff ff       	call   8003c2 <cprintf>
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca4:	eb d8                	jmp    801c7e <write+0x53>
+  801ca6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cab:	eb d1                	jmp    801c7e <write+0x53>
+
+00801cad <seek>:
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	83 ec 20             	sub    $0x20,%esp
+  801cb3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb6:	50                   	push   %eax
+  801cb7:	ff 75 08             	push   0x8(%ebp)
+  801cba:	e8 2f fc ff ff       	call   8018ee <fd_lookup>
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 0e                	js     801cd4 <seek+0x27>
+  801cc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ccc:	89 50 04             	mov    %edx,0x4(%eax)
+  801ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd4:	c9                   	leave
+  801cd5:	c3                   	ret
+
+00801cd6 <ftruncate>:
+  801cd6:	55                   	push   %ebp
+  801cd7:	89 e5                	mov    %esp,%ebp
+  801cd9:	56                   	push   %esi
+  801cda:	53                   	push   %ebx
+  801cdb:	83 ec 18             	sub    $0x18,%esp
+  801cde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ce1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce4:	50                   	push   %eax
+  801ce5:	53                   	push   %ebx
+  801ce6:	e8 03 fc ff ff       	call   8018ee <fd_lookup>
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	78 34                	js     801d26 <ftruncate+0x50>
+  801cf2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf5:	83 ec 08             	sub    $0x8,%esp
+  801cf8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfb:	50                   	push   %eax
+  801cfc:	ff 36                	push   (%esi)
+  801cfe:	e8 3b fc ff ff       	call   80193e <dev_lookup>
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 1c                	js     801d26 <ftruncate+0x50>
+  801d0a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d0e:	74 1d                	je     801d2d <ftruncate+0x57>
+  801d10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d13:	8b 40 18             	mov    0x18(%eax),%eax
+  801d16:	85 c0                	test   %eax,%eax
+  801d18:	74 34                	je     801d4e <ftruncate+0x78>
+  801d1a:	83 ec 08             	sub    $0x8,%esp
+  801d1d:	ff 75 0c             	push   0xc(%ebp)
+  801d20:	56                   	push   %esi
+  801d21:	ff d0                	call   *%eax
+  801d23:	83 c4 10             	add    $0x10,%esp
+  801d26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d29:	5b                   	pop    %ebx
+  801d2a:	5e                   	pop    %esi
+  801d2b:	5d                   	pop    %ebp
+  801d2c:	c3                   	ret
+  801d2d:	a1 10 54 80 00       	mov    0x805410,%eax
+  801d32:	8b 40 48             	mov    0x48(%eax),%eax
+  801d35:	83 ec 04             	sub    $0x4,%esp
+  801d38:	53                   	push   %ebx
+  801d39:	50                   	push   %eax
+  801d3a:	68 28 38 80 00       	push   $0x803828
+  801d3f:	e8 7e e6 ff ff       	call   8003c2 <cprintf>
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d4c:	eb d8                	jmp    801d26 <ftruncate+0x50>
+  801d4e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d53:	eb d1                	jmp    801d26 <ftruncate+0x50>
+
+00801d55 <fstat>:
+  801d55:	55                   	push   %ebp
+  801d56:	89 e5                	mov    %esp,%ebp
+  801d58:	56                   	push   %esi
+  801d59:	53                   	push   %ebx
+  801d5a:	83 ec 18             	sub    $0x18,%esp
+  801d5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d60:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d63:	50                   	push   %eax
+  801d64:	ff 75 08             	push   0x8(%ebp)
+  801d67:	e8 82 fb ff ff       	call   8018ee <fd_lookup>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 49                	js     801dbc <fstat+0x67>
+  801d73:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d76:	83 ec 08             	sub    $0x8,%esp
+  801d79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d7c:	50                   	push   %eax
+  801d7d:	ff 36                	push   (%esi)
+  801d7f:	e8 ba fb ff ff       	call   80193e <dev_lookup>
+  801d84:	83 c4 10             	add    $0x10,%esp
+  801d87:	85 c0                	test   %eax,%eax
+  801d89:	78 31                	js     801dbc <fstat+0x67>
+  801d8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d92:	74 2f                	je     801dc3 <fstat+0x6e>
+  801d94:	c6 03 00             	movb   $0x0,(%ebx)
+  801d97:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d9e:	00 00 00 
+  801da1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801da8:	00 00 00 
+  801dab:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801db1:	83 ec 08             	sub    $0x8,%esp
+  801db4:	53                   	push   %ebx
+  801db5:	56                   	push   %esi
+  801db6:	ff 50 14             	call   *0x14(%eax)
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dbf:	5b                   	pop    %ebx
+  801dc0:	5e                   	pop    %esi
+  801dc1:	5d                   	pop    %ebp
+  801dc2:	c3                   	ret
+  801dc3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dc8:	eb f2                	jmp    801dbc <fstat+0x67>
+
+00801dca <stat>:
+  801dca:	55                   	push   %ebp
+  801dcb:	89 e5                	mov    %esp,%ebp
+  801dcd:	56                   	push   %esi
+  801dce:	53                   	push   %ebx
+  801dcf:	83 ec 08             	sub    $0x8,%esp
+  801dd2:	6a 00                	push   $0x0
+  801dd4:	ff 75 08             	push   0x8(%ebp)
+  801dd7:	e8 31 05 00 00       	call   80230d <open>
+  801ddc:	89 c3                	mov    %eax,%ebx
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 1b                	js     801e00 <stat+0x36>
+  801de5:	83 ec 08             	sub    $0x8,%esp
+  801de8:	ff 75 0c             	push   0xc(%ebp)
+  801deb:	50                   	push   %eax
+  801dec:	e8 64 ff ff ff       	call   801d55 <fstat>
+  801df1:	89 c6                	mov    %eax,%esi
+  801df3:	89 1c 24             	mov    %ebx,(%esp)
+  801df6:	e8 19 fc ff ff       	call   801a14 <close>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	89 f3                	mov    %esi,%ebx
+  801e00:	89 d8                	mov    %ebx,%eax
+  801e02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e05:	5b                   	pop    %ebx
+  801e06:	5e                   	pop    %esi
+  801e07:	5d                   	pop    %ebp
+  801e08:	c3                   	ret
+
+00801e09 <fsipc>:
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	56                   	push   %esi
+  801e0d:	53                   	push   %ebx
+  801e0e:	89 c3                	mov    %eax,%ebx
+  801e10:	89 d6                	mov    %edx,%esi
+  801e12:	83 3d 08 54 80 00 00 	cmpl   $0x0,0x805408
+  801e19:	74 20                	je     801e3b <fsipc+0x32>
+  801e1b:	83 ec 08             	sub    $0x8,%esp
+  801e1e:	6a 00                	push   $0x0
+  801e20:	56                   	push   %esi
+  801e21:	6a 07                	push   $0x7
+  801e23:	68 00 60 80 00       	push   $0x806000
+  801e28:	53                   	push   %ebx
+  801e29:	ff 35 08 54 80 00    	push   0x805408
+  801e2f:	e8 e5 11 00 00       	call   803019 <ipc_call>
+  801e34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e37:	5b                   	pop    %ebx
+  801e38:	5e                   	pop    %esi
+  801e39:	5d                   	pop    %ebp
+  801e3a:	c3                   	ret
+  801e3b:	83 ec 0c             	sub    $0xc,%esp
+  801e3e:	6a 02                	push   $0x2
+  801e40:	e8 6f 13 00 00       	call   8031b4 <ipc_find_env>
+  801e45:	a3 08 54 80 00       	mov    %eax,0x805408
+  801e4a:	83 c4 10             	add    $0x10,%esp
+  801e4d:	eb cc                	jmp    801e1b <fsipc+0x12>
+
+00801e4f <devfile_trunc>:
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	83 ec 08             	sub    $0x8,%esp
+  801e55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e5b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e63:	a3 04 60 80 00       	mov    %eax,0x806004
+  801e68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e72:	e8 92 ff ff ff       	call   801e09 <fsipc>
+  801e77:	c9                   	leave
+  801e78:	c3                   	ret
+
+00801e79 <devfile_flush>:
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	83 ec 08             	sub    $0x8,%esp
+  801e7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e82:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e85:	a3 00 60 80 00       	mov    %eax,0x806000
+  801e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e94:	e8 70 ff ff ff       	call   801e09 <fsipc>
+  801e99:	c9                   	leave
+  801e9a:	c3                   	ret
+
+00801e9b <devfile_stat>:
+  801e9b:	55                   	push   %ebp
+  801e9c:	89 e5                	mov    %esp,%ebp
+  801e9e:	53                   	push   %ebx
+  801e9f:	83 ec 04             	sub    $0x4,%esp
+  801ea2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eab:	a3 00 60 80 00       	mov    %eax,0x806000
+  801eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb5:	b8 07 00 00 00       	mov    $0x7,%eax
+  801eba:	e8 4a ff ff ff       	call   801e09 <fsipc>
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	78 2c                	js     801eef <devfile_stat+0x54>
+  801ec3:	83 ec 08             	sub    $0x8,%esp
+  801ec6:	68 00 60 80 00       	push   $0x806000
+  801ecb:	53                   	push   %ebx
+  801ecc:	e8 d8 ec ff ff       	call   800ba9 <strcpy>
+  801ed1:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ed6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801edc:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ee1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801ee7:	83 c4 10             	add    $0x10,%esp
+  801eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef2:	c9                   	leave
+  801ef3:	c3                   	ret
+
+00801ef4 <fsring_rw>:
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	57                   	push   %edi
+  801ef8:	56                   	push   %esi
+  801ef9:	53                   	push   %ebx
+  801efa:	83 ec 2c             	sub    $0x2c,%esp
+  801efd:	89 c7                	mov    %eax,%edi
+  801eff:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801f02:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801f05:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801f0a:	a8 01                	test   $0x1,%al
+  801f0c:	74 0d                	je     801f1b <fsring_rw+0x27>
+  801f0e:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801f13:	a8 01                	test   $0x1,%al
+  801f15:	0f 85 d5 00 00 00    	jne    801ff0 <fsring_rw+0xfc>
+  801f1b:	a1 10 54 80 00       	mov    0x805410,%eax
+  801f20:	8b 40 48             	mov    0x48(%eax),%eax
+  801f23:	3b 05 04 54 80 00    	cmp    0x805404,%eax
+  801f29:	0f 84 fc 00 00 00    	je     80202b <fsring_rw+0x137>
+  801f2f:	83 3d 08 54 80 00 00 	cmpl   $0x0,0x805408
+  801f36:	0f 84 02 01 00 00    	je     80203e <fsring_rw+0x14a>
+  801f3c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f41:	83 ec 04             	sub    $0x4,%esp
+  801f44:	68 07 02 00 00       	push   $0x207
+  801f49:	53                   	push   %ebx
+  801f4a:	6a 00                	push   $0x0
+  801f4c:	e8 b8 f0 ff ff       	call   801009 <sys_page_alloc>
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	0f 88 f9 00 00 00    	js     802055 <fsring_rw+0x161>
+  801f5c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f62:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801f68:	75 d7                	jne    801f41 <fsring_rw+0x4d>
+  801f6a:	6a 0e                	push   $0xe
+  801f6c:	6a 0d                	push   $0xd
+  801f6e:	ff 35 08 54 80 00    	push   0x805408
+  801f74:	68 00 00 f0 cf       	push   $0xcff00000
+  801f79:	e8 d8 0d 00 00       	call   802d56 <ipcring_init>
+  801f7e:	83 c4 08             	add    $0x8,%esp
+  801f81:	6a 00                	push   $0x0
+  801f83:	6a 00                	push   $0x0
+  801f85:	68 07 02 00 00       	push   $0x207
+  801f8a:	68 00 00 f0 cf       	push   $0xcff00000
+  801f8f:	6a 0b                	push   $0xb
+  801f91:	ff 35 08 54 80 00    	push   0x805408
+  801f97:	e8 7d 10 00 00       	call   803019 <ipc_call>
+  801f9c:	89 c6                	mov    %eax,%esi
+  801f9e:	83 c4 20             	add    $0x20,%esp
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	0f 88 ac 00 00 00    	js     802055 <fsring_rw+0x161>
+  801fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fae:	89 d9                	mov    %ebx,%ecx
+  801fb0:	83 c3 01             	add    $0x1,%ebx
+  801fb3:	89 da                	mov    %ebx,%edx
+  801fb5:	c1 e2 0c             	shl    $0xc,%edx
+  801fb8:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801fbe:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801fc4:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801fca:	83 ec 08             	sub    $0x8,%esp
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	6a 00                	push   $0x0
+  801fd1:	68 07 02 00 00       	push   $0x207
+  801fd6:	50                   	push   %eax
+  801fd7:	6a 0c                	push   $0xc
+  801fd9:	ff 35 08 54 80 00    	push   0x805408
+  801fdf:	e8 35 10 00 00       	call   803019 <ipc_call>
+  801fe4:	83 c4 20             	add    $0x20,%esp
+  801fe7:	85 c0                	test   %eax,%eax
+  801fe9:	78 6a                	js     802055 <fsring_rw+0x161>
+  801feb:	83 fb 08             	cmp    $0x8,%ebx
+  801fee:	75 be                	jne    801fae <fsring_rw+0xba>
+  801ff0:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801ff4:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801ff9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801ffe:	0f 45 c2             	cmovne %edx,%eax
+  802001:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802004:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80200b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802012:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802019:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201e:	be 00 00 00 00       	mov    $0x0,%esi
+  802023:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802026:	e9 4b 01 00 00       	jmp    802176 <fsring_rw+0x282>
+  80202b:	e8 a3 f3 ff ff       	call   8013d3 <sys_time_msec>
+  802030:	3b 05 00 54 80 00    	cmp    0x805400,%eax
+  802036:	0f 89 f3 fe ff ff    	jns    801f2f <fsring_rw+0x3b>
+  80203c:	eb 54                	jmp    802092 <fsring_rw+0x19e>
+  80203e:	83 ec 0c             	sub    $0xc,%esp
+  802041:	6a 02                	push   $0x2
+  802043:	e8 6c 11 00 00       	call   8031b4 <ipc_find_env>
+  802048:	a3 08 54 80 00       	mov    %eax,0x805408
+  80204d:	83 c4 10             	add    $0x10,%esp
+  802050:	e9 e7 fe ff ff       	jmp    801f3c <fsring_rw+0x48>
+  802055:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80205a:	83 ec 08             	sub    $0x8,%esp
+  80205d:	53                   	push   %ebx
+  80205e:	6a 00                	push   $0x0
+  802060:	e8 76 f0 ff ff       	call   8010db <sys_page_unmap>
+  802065:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802074:	75 e4                	jne    80205a <fsring_rw+0x166>
+  802076:	e8 58 f3 ff ff       	call   8013d3 <sys_time_msec>
+  80207b:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802080:	a3 00 54 80 00       	mov    %eax,0x805400
+  802085:	a1 10 54 80 00       	mov    0x805410,%eax
+  80208a:	8b 40 48             	mov    0x48(%eax),%eax
+  80208d:	a3 04 54 80 00       	mov    %eax,0x805404
+  802092:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802099:	e9 7a 01 00 00       	jmp    802218 <fsring_rw+0x324>
+  80209e:	8b 57 0c             	mov    0xc(%edi),%edx
+  8020a1:	89 10                	mov    %edx,(%eax)
+  8020a3:	89 58 04             	mov    %ebx,0x4(%eax)
+  8020a6:	89 f2                	mov    %esi,%edx
+  8020a8:	03 57 04             	add    0x4(%edi),%edx
+  8020ab:	89 50 08             	mov    %edx,0x8(%eax)
+  8020ae:	83 ec 04             	sub    $0x4,%esp
+  8020b1:	53                   	push   %ebx
+  8020b2:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8020b5:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8020b8:	52                   	push   %edx
+  8020b9:	83 c0 0c             	add    $0xc,%eax
+  8020bc:	50                   	push   %eax
+  8020bd:	e8 97 ec ff ff       	call   800d59 <memmove>
+  8020c2:	83 c4 10             	add    $0x10,%esp
+  8020c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020c8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8020cb:	89 08                	mov    %ecx,(%eax)
+  8020cd:	83 ec 0c             	sub    $0xc,%esp
+  8020d0:	68 00 00 f0 cf       	push   $0xcff00000
+  8020d5:	e8 da 0c 00 00       	call   802db4 <ipcring_req_push>
+  8020da:	01 de                	add    %ebx,%esi
+  8020dc:	83 c4 10             	add    $0x10,%esp
+  8020df:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8020e2:	73 4c                	jae    802130 <fsring_rw+0x23c>
+  8020e4:	83 ec 0c             	sub    $0xc,%esp
+  8020e7:	68 00 00 f0 cf       	push   $0xcff00000
+  8020ec:	e8 9d 0c 00 00       	call   802d8e <ipcring_req_slot>
+  8020f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020f4:	83 c4 10             	add    $0x10,%esp
+  8020f7:	85 c0                	test   %eax,%eax
+  8020f9:	74 35                	je     802130 <fsring_rw+0x23c>
+  8020fb:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802100:	83 e0 07             	and    $0x7,%eax
+  802103:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802108:	c1 e0 0c             	shl    $0xc,%eax
+  80210b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80210e:	29 f3                	sub    %esi,%ebx
+  802110:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802113:	39 cb                	cmp    %ecx,%ebx
+  802115:	0f 47 d9             	cmova  %ecx,%ebx
+  802118:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80211c:	75 80                	jne    80209e <fsring_rw+0x1aa>
+  80211e:	8b 57 0c             	mov    0xc(%edi),%edx
+  802121:	89 10                	mov    %edx,(%eax)
+  802123:	89 58 04             	mov    %ebx,0x4(%eax)
+  802126:	89 f2                	mov    %esi,%edx
+  802128:	03 57 04             	add    0x4(%edi),%edx
+  80212b:	89 50 08             	mov    %edx,0x8(%eax)
+  80212e:	eb 95                	jmp    8020c5 <fsring_rw+0x1d1>
+  802130:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802135:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802138:	83 ec 0c             	sub    $0xc,%esp
+  80213b:	68 00 00 f0 cf       	push   $0xcff00000
+  802140:	e8 a8 0c 00 00       	call   802ded <ipcring_rsp_wait>
+  802145:	8b 58 04             	mov    0x4(%eax),%ebx
+  802148:	83 c4 10             	add    $0x10,%esp
+  80214b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80214f:	75 45                	jne    802196 <fsring_rw+0x2a2>
+  802151:	85 db                	test   %ebx,%ebx
+  802153:	79 41                	jns    802196 <fsring_rw+0x2a2>
+  802155:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  802158:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80215f:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802166:	83 ec 0c             	sub    $0xc,%esp
+  802169:	68 00 00 f0 cf       	push   $0xcff00000
+  80216e:	e8 e0 0c 00 00       	call   802e53 <ipcring_rsp_pop>
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80217c:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802181:	39 c2                	cmp    %eax,%edx
+  802183:	74 75                	je     8021fa <fsring_rw+0x306>
+  802185:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802189:	75 a5                	jne    802130 <fsring_rw+0x23c>
+  80218b:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80218e:	0f 82 50 ff ff ff    	jb     8020e4 <fsring_rw+0x1f0>
+  802194:	eb 9a                	jmp    802130 <fsring_rw+0x23c>
+  802196:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80219a:	75 ca                	jne    802166 <fsring_rw+0x272>
+  80219c:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8021a0:	74 31                	je     8021d3 <fsring_rw+0x2df>
+  8021a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a5:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8021a8:	29 c8                	sub    %ecx,%eax
+  8021aa:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8021ad:	39 d0                	cmp    %edx,%eax
+  8021af:	0f 47 c2             	cmova  %edx,%eax
+  8021b2:	39 d8                	cmp    %ebx,%eax
+  8021b4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021b9:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8021bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8021c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c5:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8021c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8021cc:	01 d9                	add    %ebx,%ecx
+  8021ce:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8021d1:	eb 93                	jmp    802166 <fsring_rw+0x272>
+  8021d3:	83 ec 04             	sub    $0x4,%esp
+  8021d6:	53                   	push   %ebx
+  8021d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021da:	83 e0 07             	and    $0x7,%eax
+  8021dd:	c1 e0 0c             	shl    $0xc,%eax
+  8021e0:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8021e6:	50                   	push   %eax
+  8021e7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8021ea:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8021ed:	01 c8                	add    %ecx,%eax
+  8021ef:	50                   	push   %eax
+  8021f0:	e8 64 eb ff ff       	call   800d59 <memmove>
+  8021f5:	83 c4 10             	add    $0x10,%esp
+  8021f8:	eb a8                	jmp    8021a2 <fsring_rw+0x2ae>
+  8021fa:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8021fe:	75 09                	jne    802209 <fsring_rw+0x315>
+  802200:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802203:	0f 82 db fe ff ff    	jb     8020e4 <fsring_rw+0x1f0>
+  802209:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80220c:	01 57 04             	add    %edx,0x4(%edi)
+  80220f:	85 d2                	test   %edx,%edx
+  802211:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802215:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802218:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80221b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80221e:	5b                   	pop    %ebx
+  80221f:	5e                   	pop    %esi
+  802220:	5f                   	pop    %edi
+  802221:	5d                   	pop    %ebp
+  802222:	c3                   	ret
+
+00802223 <devfile_write>:
+  802223:	55                   	push   %ebp
+  802224:	89 e5                	mov    %esp,%ebp
+  802226:	57                   	push   %edi
+  802227:	56                   	push   %esi
+  802228:	53                   	push   %ebx
+  802229:	83 ec 0c             	sub    $0xc,%esp
+  80222c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80222f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802232:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802235:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80223b:	76 1a                	jbe    802257 <devfile_write+0x34>
+  80223d:	83 ec 0c             	sub    $0xc,%esp
+  802240:	53                   	push   %ebx
+  802241:	89 f1                	mov    %esi,%ecx
+  802243:	ba 06 00 00 00       	mov    $0x6,%edx
+  802248:	89 f8                	mov    %edi,%eax
+  80224a:	e8 a5 fc ff ff       	call   801ef4 <fsring_rw>
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802255:	75 39                	jne    802290 <devfile_write+0x6d>
+  802257:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80225c:	39 c3                	cmp    %eax,%ebx
+  80225e:	0f 47 d8             	cmova  %eax,%ebx
+  802261:	8b 47 0c             	mov    0xc(%edi),%eax
+  802264:	a3 00 60 80 00       	mov    %eax,0x806000
+  802269:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80226f:	83 ec 04             	sub    $0x4,%esp
+  802272:	53                   	push   %ebx
+  802273:	56                   	push   %esi
+  802274:	68 08 60 80 00       	push   $0x806008
+  802279:	e8 db ea ff ff       	call   800d59 <memmove>
+  80227e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802283:	b8 04 00 00 00       	mov    $0x4,%eax
+  802288:	e8 7c fb ff ff       	call   801e09 <fsipc>
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802293:	5b                   	pop    %ebx
+  802294:	5e                   	pop    %esi
+  802295:	5f                   	pop    %edi
+  802296:	5d                   	pop    %ebp
+  802297:	c3                   	ret
+
+00802298 <devfile_read>:
+  802298:	55                   	push   %ebp
+  802299:	89 e5                	mov    %esp,%ebp
+  80229b:	57                   	push   %edi
+  80229c:	56                   	push   %esi
+  80229d:	53                   	push   %ebx
+  80229e:	83 ec 0c             	sub    $0xc,%esp
+  8022a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022a4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8022a7:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8022ad:	76 1d                	jbe    8022cc <devfile_read+0x34>
+  8022af:	83 ec 0c             	sub    $0xc,%esp
+  8022b2:	56                   	push   %esi
+  8022b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022b6:	ba 05 00 00 00       	mov    $0x5,%edx
+  8022bb:	89 f8                	mov    %edi,%eax
+  8022bd:	e8 32 fc ff ff       	call   801ef4 <fsring_rw>
+  8022c2:	89 c3                	mov    %eax,%ebx
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8022ca:	75 37                	jne    802303 <devfile_read+0x6b>
+  8022cc:	8b 47 0c             	mov    0xc(%edi),%eax
+  8022cf:	a3 00 60 80 00       	mov    %eax,0x806000
+  8022d4:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8022da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022df:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022e4:	e8 20 fb ff ff       	call   801e09 <fsipc>
+  8022e9:	89 c3                	mov    %eax,%ebx
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	78 14                	js     802303 <devfile_read+0x6b>
+  8022ef:	83 ec 04             	sub    $0x4,%esp
+  8022f2:	50                   	push   %eax
+  8022f3:	68 00 60 80 00       	push   $0x806000
+  8022f8:	ff 75 0c             	push   0xc(%ebp)
+  8022fb:	e8 59 ea ff ff       	call   800d59 <memmove>
+  802300:	83 c4 10             	add    $0x10,%esp
+  802303:	89 d8                	mov    %ebx,%eax
+  802305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802308:	5b                   	pop    %ebx
+  802309:	5e                   	pop    %esi
+  80230a:	5f                   	pop    %edi
+  80230b:	5d                   	pop    %ebp
+  80230c:	c3                   	ret
+
+0080230d <open>:
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	56                   	push   %esi
+  802311:	53                   	push   %ebx
+  802312:	83 ec 1c             	sub    $0x1c,%esp
+  802315:	8b 75 08             	mov    0x8(%ebp),%esi
+  802318:	56                   	push   %esi
+  802319:	e8 3f e8 ff ff       	call   800b5d <strlen>
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802326:	7f 6c                	jg     802394 <open+0x87>
+  802328:	83 ec 0c             	sub    $0xc,%esp
+  80232b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80232e:	50                   	push   %eax
+  80232f:	e8 6a f5 ff ff       	call   80189e <fd_alloc>
+  802334:	89 c3                	mov    %eax,%ebx
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	78 3c                	js     802379 <open+0x6c>
+  80233d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802340:	a3 00 64 80 00       	mov    %eax,0x806400
+  802345:	83 ec 08             	sub    $0x8,%esp
+  802348:	56                   	push   %esi
+  802349:	68 00 60 80 00       	push   $0x806000
+  80234e:	e8 56 e8 ff ff       	call   800ba9 <strcpy>
+  802353:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802356:	b8 01 00 00 00       	mov    $0x1,%eax
+  80235b:	e8 a9 fa ff ff       	call   801e09 <fsipc>
+  802360:	89 c3                	mov    %eax,%ebx
+  802362:	83 c4 10             	add    $0x10,%esp
+  802365:	85 c0                	test   %eax,%eax
+  802367:	78 19                	js     802382 <open+0x75>
+  802369:	83 ec 0c             	sub    $0xc,%esp
+  80236c:	ff 75 f4             	push   -0xc(%ebp)
+  80236f:	e8 03 f5 ff ff       	call   801877 <fd2num>
+  802374:	89 c3                	mov    %eax,%ebx
+  802376:	83 c4 10             	add    $0x10,%esp
+  802379:	89 d8                	mov    %ebx,%eax
+  80237b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80237e:	5b                   	pop    %ebx
+  80237f:	5e                   	pop    %esi
+  802380:	5d                   	pop    %ebp
+  802381:	c3                   	ret
+  802382:	83 ec 08             	sub    $0x8,%esp
+  802385:	6a 00                	push   $0x0
+  802387:	ff 75 f4             	push   -0xc(%ebp)
+  80238a:	e8 05 f6 ff ff       	call   801994 <fd_close>
+  80238f:	83 c4 10             	add    $0x10,%esp
+  802392:	eb e5                	jmp    802379 <open+0x6c>
+  802394:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802399:	eb de                	jmp    802379 <open+0x6c>
+
+0080239b <file_image>:
+  80239b:	55                   	push   %ebp
+  80239c:	89 e5                	mov    %esp,%ebp
+  80239e:	53                   	push   %ebx
+  80239f:	83 ec 1c             	sub    $0x1c,%esp
+  8023a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a8:	50                   	push   %eax
+  8023a9:	ff 75 08             	push   0x8(%ebp)
+  8023ac:	e8 3d f5 ff ff       	call   8018ee <fd_lookup>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	78 58                	js     802410 <file_image+0x75>
+  8023b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023bb:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8023c1:	39 08                	cmp    %ecx,(%eax)
+  8023c3:	75 50                	jne    802415 <file_image+0x7a>
+  8023c5:	83 fb 04             	cmp    $0x4,%ebx
+  8023c8:	77 52                	ja     80241c <file_image+0x81>
+  8023ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023cd:	a3 00 60 80 00       	mov    %eax,0x806000
+  8023d2:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8023d8:	83 ec 04             	sub    $0x4,%esp
+  8023db:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8023de:	c1 e0 02             	shl    $0x2,%eax
+  8023e1:	50                   	push   %eax
+  8023e2:	ff 75 0c             	push   0xc(%ebp)
+  8023e5:	68 08 60 80 00       	push   $0x806008
+  8023ea:	e8 6a e9 ff ff       	call   800d59 <memmove>
+  8023ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8023f9:	e8 0b fa ff ff       	call   801e09 <fsipc>
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	85 c0                	test   %eax,%eax
+  802403:	78 0b                	js     802410 <file_image+0x75>
+  802405:	8b 55 14             	mov    0x14(%ebp),%edx
+  802408:	8b 0d 08 54 80 00    	mov    0x805408,%ecx
+  80240e:	89 0a                	mov    %ecx,(%edx)
+  802410:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802413:	c9                   	leave
+  802414:	c3                   	ret
+  802415:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80241a:	eb f4                	jmp    802410 <file_image+0x75>
+  80241c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802421:	eb ed                	jmp    802410 <file_image+0x75>
+
+00802423 <remove>:
+  802423:	55                   	push   %ebp
+  802424:	89 e5                	mov    %esp,%ebp
+  802426:	53                   	push   %ebx
+  802427:	83 ec 10             	sub    $0x10,%esp
+  80242a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80242d:	53                   	push   %ebx
+  80242e:	e8 2a e7 ff ff       	call   800b5d <strlen>
+  802433:	83 c4 10             	add    $0x10,%esp
+  802436:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80243b:	7f 25                	jg     802462 <remove+0x3f>
+  80243d:	83 ec 08             	sub    $0x8,%esp
+  802440:	53                   	push   %ebx
+  802441:	68 00 60 80 00       	push   $0x806000
+  802446:	e8 5e e7 ff ff       	call   800ba9 <strcpy>
+  80244b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802450:	b8 09 00 00 00       	mov    $0x9,%eax
+  802455:	e8 af f9 ff ff       	call   801e09 <fsipc>
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802460:	c9                   	leave
+  802461:	c3                   	ret
+  802462:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802467:	eb f4                	jmp    80245d <remove+0x3a>
+
+00802469 <sync>:
+  802469:	55                   	push   %ebp
+  80246a:	89 e5                	mov    %esp,%ebp
+  80246c:	83 ec 08             	sub    $0x8,%esp
+  80246f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802474:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802479:	e8 8b f9 ff ff       	call   801e09 <fsipc>
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+
+00802480 <writebuf>:
+  802480:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802484:	7f 01                	jg     802487 <writebuf+0x7>
+  802486:	c3                   	ret
+  802487:	55                   	push   %ebp
+  802488:	89 e5                	mov    %esp,%ebp
+  80248a:	53                   	push   %ebx
+  80248b:	83 ec 08             	sub    $0x8,%esp
+  80248e:	89 c3                	mov    %eax,%ebx
+  802490:	ff 70 04             	push   0x4(%eax)
+  802493:	8d 40 10             	lea    0x10(%eax),%eax
+  802496:	50                   	push   %eax
+  802497:	ff 33                	push   (%ebx)
+  802499:	e8 8d f7 ff ff       	call   801c2b <write>
+  80249e:	83 c4 10             	add    $0x10,%esp
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	7e 03                	jle    8024a8 <writebuf+0x28>
+  8024a5:	01 43 08             	add    %eax,0x8(%ebx)
+  8024a8:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8024ab:	74 0d                	je     8024ba <writebuf+0x3a>
+  8024ad:	85 c0                	test   %eax,%eax
+  8024af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b4:	0f 4f c2             	cmovg  %edx,%eax
+  8024b7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8024ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024bd:	c9                   	leave
+  8024be:	c3                   	ret
+
+008024bf <putch>:
+  8024bf:	55                   	push   %ebp
+  8024c0:	89 e5                	mov    %esp,%ebp
+  8024c2:	53                   	push   %ebx
+  8024c3:	83 ec 04             	sub    $0x4,%esp
+  8024c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8024c9:	8b 53 04             	mov    0x4(%ebx),%edx
+  8024cc:	8d 42 01             	lea    0x1(%edx),%eax
+  8024cf:	89 43 04             	mov    %eax,0x4(%ebx)
+  8024d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8024d5:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  8024d9:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8024de:	74 05                	je     8024e5 <putch+0x26>
+  8024e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+  8024e5:	89 d8                	mov    %ebx,%eax
+  8024e7:	e8 94 ff ff ff       	call   802480 <writebuf>
+  8024ec:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  8024f3:	eb eb                	jmp    8024e0 <putch+0x21>
+
+008024f5 <vfprintf>:
+  8024f5:	55                   	push   %ebp
+  8024f6:	89 e5                	mov    %esp,%ebp
+  8024f8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8024fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802501:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  802507:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80250e:	00 00 00 
+  802511:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802518:	00 00 00 
+  80251b:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802522:	00 00 00 
+  802525:	ff 75 10             	push   0x10(%ebp)
+  802528:	ff 75 0c             	push   0xc(%ebp)
+  80252b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802531:	50                   	push   %eax
+  802532:	68 bf 24 80 00       	push   $0x8024bf
+  802537:	e8 85 df ff ff       	call   8004c1 <vprintfmt>
+  80253c:	83 c4 10             	add    $0x10,%esp
+  80253f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802546:	7f 12                	jg     80255a <vfprintf+0x65>
+  802548:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80254e:	85 c0                	test   %eax,%eax
+  802550:	75 06                	jne    802558 <vfprintf+0x63>
+  802552:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802558:	c9                   	leave
+  802559:	c3                   	ret
+  80255a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802560:	e8 1b ff ff ff       	call   802480 <writebuf>
+  802565:	eb e1                	jmp    802548 <vfprintf+0x53>
+
+00802567 <fprintf>:
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	83 ec 0c             	sub    $0xc,%esp
+  80256d:	8d 45 10             	lea    0x10(%ebp),%eax
+  802570:	50                   	push   %eax
+  802571:	ff 75 0c             	push   0xc(%ebp)
+  802574:	ff 75 08             	push   0x8(%ebp)
+  802577:	e8 79 ff ff ff       	call   8024f5 <vfprintf>
+  80257c:	c9                   	leave
+  80257d:	c3                   	ret
+
+0080257e <printf>:
+  80257e:	55                   	push   %ebp
+  80257f:	89 e5                	mov    %esp,%ebp
+  802581:	83 ec 0c             	sub    $0xc,%esp
+  802584:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802587:	50                   	push   %eax
+  802588:	ff 75 08             	push   0x8(%ebp)
+  80258b:	6a 01                	push   $0x1
+  80258d:	e8 63 ff ff ff       	call   8024f5 <vfprintf>
+  802592:	c9                   	leave
+  802593:	c3                   	ret
+
+00802594 <devsock_stat>:
+  802594:	55                   	push   %ebp
+  802595:	89 e5                	mov    %esp,%ebp
+  802597:	83 ec 10             	sub    $0x10,%esp
+  80259a:	68 98 38 80 00       	push   $0x803898
+  80259f:	ff 75 0c             	push   0xc(%ebp)
+  8025a2:	e8 02 e6 ff ff       	call   800ba9 <strcpy>
+  8025a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ac:	c9                   	leave
+  8025ad:	c3                   	ret
+
+008025ae <devsock_close>:
+  8025ae:	55                   	push   %ebp
+  8025af:	89 e5                	mov    %esp,%ebp
+  8025b1:	53                   	push   %ebx
+  8025b2:	83 ec 10             	sub    $0x10,%esp
+  8025b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025b8:	53                   	push   %ebx
+  8025b9:	e8 10 0c 00 00       	call   8031ce <pageref>
+  8025be:	89 c2                	mov    %eax,%edx
+  8025c0:	83 c4 10             	add    $0x10,%esp
+  8025c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c8:	83 fa 01             	cmp    $0x1,%edx
+  8025cb:	74 05                	je     8025d2 <devsock_close+0x24>
+  8025cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025d0:	c9                   	leave
+  8025d1:	c3                   	ret
+  8025d2:	83 ec 0c             	sub    $0xc,%esp
+  8025d5:	ff 73 0c             	push   0xc(%ebx)
+  8025d8:	e8 aa 02 00 00       	call   802887 <nsipc_close>
+  8025dd:	83 c4 10             	add    $0x10,%esp
+  8025e0:	eb eb                	jmp    8025cd <devsock_close+0x1f>
+
+008025e2 <devsock_write>:
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	83 ec 08             	sub    $0x8,%esp
+  8025e8:	6a 00                	push   $0x0
+  8025ea:	ff 75 10             	push   0x10(%ebp)
+  8025ed:	ff 75 0c             	push   0xc(%ebp)
+  8025f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f3:	ff 70 0c             	push   0xc(%eax)
+  8025f6:	e8 6c 03 00 00       	call   802967 <nsipc_send>
+  8025fb:	c9                   	leave
+  8025fc:	c3                   	ret
+
+008025fd <devsock_read>:
+  8025fd:	55                   	push   %ebp
+  8025fe:	89 e5                	mov    %esp,%ebp
+  802600:	83 ec 08             	sub    $0x8,%esp
+  802603:	6a 00                	push   $0x0
+  802605:	ff 75 10             	push   0x10(%ebp)
+  802608:	ff 75 0c             	push   0xc(%ebp)
+  80260b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260e:	ff 70 0c             	push   0xc(%eax)
+  802611:	e8 e2 02 00 00       	call   8028f8 <nsipc_recv>
+  802616:	c9                   	leave
+  802617:	c3                   	ret
+
+00802618 <fd2sockid>:
+  802618:	55                   	push   %ebp
+  802619:	89 e5                	mov    %esp,%ebp
+  80261b:	83 ec 20             	sub    $0x20,%esp
+  80261e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802621:	52                   	push   %edx
+  802622:	50                   	push   %eax
+  802623:	e8 c6 f2 ff ff       	call   8018ee <fd_lookup>
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	78 10                	js     80263f <fd2sockid+0x27>
+  80262f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802632:	8b 0d 3c 40 80 00    	mov    0x80403c,%ecx
+  802638:	39 08                	cmp    %ecx,(%eax)
+  80263a:	75 05                	jne    802641 <fd2sockid+0x29>
+  80263c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80263f:	c9                   	leave
+  802640:	c3                   	ret
+  802641:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802646:	eb f7                	jmp    80263f <fd2sockid+0x27>
+
+00802648 <alloc_sockfd>:
+  802648:	55                   	push   %ebp
+  802649:	89 e5                	mov    %esp,%ebp
+  80264b:	56                   	push   %esi
+  80264c:	53                   	push   %ebx
+  80264d:	83 ec 1c             	sub    $0x1c,%esp
+  802650:	89 c6                	mov    %eax,%esi
+  802652:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802655:	50                   	push   %eax
+  802656:	e8 43 f2 ff ff       	call   80189e <fd_alloc>
+  80265b:	89 c3                	mov    %eax,%ebx
+  80265d:	83 c4 10             	add    $0x10,%esp
+  802660:	85 c0                	test   %eax,%eax
+  802662:	78 43                	js     8026a7 <alloc_sockfd+0x5f>
+  802664:	83 ec 04             	sub    $0x4,%esp
+  802667:	68 07 04 00 00       	push   $0x407
+  80266c:	ff 75 f4             	push   -0xc(%ebp)
+  80266f:	6a 00                	push   $0x0
+  802671:	e8 93 e9 ff ff       	call   801009 <sys_page_alloc>
+  802676:	89 c3                	mov    %eax,%ebx
+  802678:	83 c4 10             	add    $0x10,%esp
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	78 28                	js     8026a7 <alloc_sockfd+0x5f>
+  80267f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802682:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802688:	89 10                	mov    %edx,(%eax)
+  80268a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80268d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802694:	89 70 0c             	mov    %esi,0xc(%eax)
+  802697:	83 ec 0c             	sub    $0xc,%esp
+  80269a:	50                   	push   %eax
+  80269b:	e8 d7 f1 ff ff       	call   801877 <fd2num>
+  8026a0:	89 c3                	mov    %eax,%ebx
+  8026a2:	83 c4 10             	add    $0x10,%esp
+  8026a5:	eb 0c                	jmp    8026b3 <alloc_sockfd+0x6b>
+  8026a7:	83 ec 0c             	sub    $0xc,%esp
+  8026aa:	56                   	push   %esi
+  8026ab:	e8 d7 01 00 00       	call   802887 <nsipc_close>
+  8026b0:	83 c4 10             	add    $0x10,%esp
+  8026b3:	89 d8                	mov    %ebx,%eax
+  8026b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b8:	5b                   	pop    %ebx
+  8026b9:	5e                   	pop    %esi
+  8026ba:	5d                   	pop    %ebp
+  8026bb:	c3                   	ret
+
+008026bc <accept>:
+  8026bc:	55                   	push   %ebp
+  8026bd:	89 e5                	mov    %esp,%ebp
+  8026bf:	83 ec 08             	sub    $0x8,%esp
+  8026c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c5:	e8 4e ff ff ff       	call   802618 <fd2sockid>
+  8026ca:	85 c0                	test   %eax,%eax
+  8026cc:	78 1b                	js     8026e9 <accept+0x2d>
+  8026ce:	83 ec 04             	sub    $0x4,%esp
+  8026d1:	ff 75 10             	push   0x10(%ebp)
+  8026d4:	ff 75 0c             	push   0xc(%ebp)
+  8026d7:	50                   	push   %eax
+  8026d8:	e8 07 01 00 00       	call   8027e4 <nsipc_accept>
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	78 05                	js     8026e9 <accept+0x2d>
+  8026e4:	e8 5f ff ff ff       	call   802648 <alloc_sockfd>
+  8026e9:	c9                   	leave
+  8026ea:	c3                   	ret
+
+008026eb <bind>:
+  8026eb:	55                   	push   %ebp
+  8026ec:	89 e5                	mov    %esp,%ebp
+  8026ee:	83 ec 08             	sub    $0x8,%esp
+  8026f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f4:	e8 1f ff ff ff       	call   802618 <fd2sockid>
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	78 12                	js     80270f <bind+0x24>
+  8026fd:	83 ec 04             	sub    $0x4,%esp
+  802700:	ff 75 10             	push   0x10(%ebp)
+  802703:	ff 75 0c             	push   0xc(%ebp)
+  802706:	50                   	push   %eax
+  802707:	e8 24 01 00 00       	call   802830 <nsipc_bind>
+  80270c:	83 c4 10             	add    $0x10,%esp
+  80270f:	c9                   	leave
+  802710:	c3                   	ret
+
+00802711 <shutdown>:
+  802711:	55                   	push   %ebp
+  802712:	89 e5                	mov    %esp,%ebp
+  802714:	83 ec 08             	sub    $0x8,%esp
+  802717:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271a:	e8 f9 fe ff ff       	call   802618 <fd2sockid>
+  80271f:	85 c0                	test   %eax,%eax
+  802721:	78 0f                	js     802732 <shutdown+0x21>
+  802723:	83 ec 08             	sub    $0x8,%esp
+  802726:	ff 75 0c             	push   0xc(%ebp)
+  802729:	50                   	push   %eax
+  80272a:	e8 36 01 00 00       	call   802865 <nsipc_shutdown>
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	c9                   	leave
+  802733:	c3                   	ret
+
+00802734 <connect>:
+  802734:	55                   	push   %ebp
+  802735:	89 e5                	mov    %esp,%ebp
+  802737:	83 ec 08             	sub    $0x8,%esp
+  80273a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273d:	e8 d6 fe ff ff       	call   802618 <fd2sockid>
+  802742:	85 c0                	test   %eax,%eax
+  802744:	78 12                	js     802758 <connect+0x24>
+  802746:	83 ec 04             	sub    $0x4,%esp
+  802749:	ff 75 10             	push   0x10(%ebp)
+  80274c:	ff 75 0c             	push   0xc(%ebp)
+  80274f:	50                   	push   %eax
+  802750:	e8 4c 01 00 00       	call   8028a1 <nsipc_connect>
+  802755:	83 c4 10             	add    $0x10,%esp
+  802758:	c9                   	leave
+  802759:	c3                   	ret
+
+0080275a <listen>:
+  80275a:	55                   	push   %ebp
+  80275b:	89 e5                	mov    %esp,%ebp
+  80275d:	83 ec 08             	sub    $0x8,%esp
+  802760:	8b 45 08             	mov    0x8(%ebp),%eax
+  802763:	e8 b0 fe ff ff       	call   802618 <fd2sockid>
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	78 0f                	js     80277b <listen+0x21>
+  80276c:	83 ec 08             	sub    $0x8,%esp
+  80276f:	ff 75 0c             	push   0xc(%ebp)
+  802772:	50                   	push   %eax
+  802773:	e8 5e 01 00 00       	call   8028d6 <nsipc_listen>
+  802778:	83 c4 10             	add    $0x10,%esp
+  80277b:	c9                   	leave
+  80277c:	c3                   	ret
+
+0080277d <socket>:
+  80277d:	55                   	push   %ebp
+  80277e:	89 e5                	mov    %esp,%ebp
+  802780:	83 ec 0c             	sub    $0xc,%esp
+  802783:	ff 75 10             	push   0x10(%ebp)
+  802786:	ff 75 0c             	push   0xc(%ebp)
+  802789:	ff 75 08             	push   0x8(%ebp)
+  80278c:	e8 34 02 00 00       	call   8029c5 <nsipc_socket>
+  802791:	83 c4 10             	add    $0x10,%esp
+  802794:	85 c0                	test   %eax,%eax
+  802796:	78 05                	js     80279d <socket+0x20>
+  802798:	e8 ab fe ff ff       	call   802648 <alloc_sockfd>
+  80279d:	c9                   	leave
+  80279e:	c3                   	ret
+
+0080279f <nsipc>:
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 04             	sub    $0x4,%esp
+  8027a6:	89 c3                	mov    %eax,%ebx
+  8027a8:	83 3d 0c 54 80 00 00 	cmpl   $0x0,0x80540c
+  8027af:	74 1f                	je     8027d0 <nsipc+0x31>
+  8027b1:	83 ec 08             	sub    $0x8,%esp
+  8027b4:	6a 00                	push   $0x0
+  8027b6:	6a 00                	push   $0x0
+  8027b8:	6a 07                	push   $0x7
+  8027ba:	68 00 70 80 00       	push   $0x807000
+  8027bf:	53                   	push   %ebx
+  8027c0:	ff 35 0c 54 80 00    	push   0x80540c
+  8027c6:	e8 4e 08 00 00       	call   803019 <ipc_call>
+  8027cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027ce:	c9                   	leave
+  8027cf:	c3                   	ret
+  8027d0:	83 ec 0c             	sub    $0xc,%esp
+  8027d3:	6a 03                	push   $0x3
+  8027d5:	e8 da 09 00 00       	call   8031b4 <ipc_find_env>
+  8027da:	a3 0c 54 80 00       	mov    %eax,0x80540c
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	eb cd                	jmp    8027b1 <nsipc+0x12>
+
+008027e4 <nsipc_accept>:
+  8027e4:	55                   	push   %ebp
+  8027e5:	89 e5                	mov    %esp,%ebp
+  8027e7:	53                   	push   %ebx
+  8027e8:	83 ec 04             	sub    $0x4,%esp
+  8027eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ee:	a3 00 70 80 00       	mov    %eax,0x807000
+  8027f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027f8:	e8 a2 ff ff ff       	call   80279f <nsipc>
+  8027fd:	89 c3                	mov    %eax,%ebx
+  8027ff:	85 c0                	test   %eax,%eax
+  802801:	79 07                	jns    80280a <nsipc_accept+0x26>
+  802803:	89 d8                	mov    %ebx,%eax
+  802805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802808:	c9                   	leave
+  802809:	c3                   	ret
+  80280a:	83 ec 04             	sub    $0x4,%esp
+  80280d:	ff 35 10 70 80 00    	push   0x807010
+  802813:	68 00 70 80 00       	push   $0x807000
+  802818:	ff 75 0c             	push   0xc(%ebp)
+  80281b:	e8 39 e5 ff ff       	call   800d59 <memmove>
+  802820:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802826:	8b 45 10             	mov    0x10(%ebp),%eax
+  802829:	89 10                	mov    %edx,(%eax)
+  80282b:	83 c4 10             	add    $0x10,%esp
+  80282e:	eb d3                	jmp    802803 <nsipc_accept+0x1f>
+
+00802830 <nsipc_bind>:
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	53                   	push   %ebx
+  802834:	83 ec 08             	sub    $0x8,%esp
+  802837:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80283a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80283d:	a3 00 70 80 00       	mov    %eax,0x807000
+  802842:	53                   	push   %ebx
+  802843:	ff 75 0c             	push   0xc(%ebp)
+  802846:	68 04 70 80 00       	push   $0x807004
+  80284b:	e8 09 e5 ff ff       	call   800d59 <memmove>
+  802850:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802856:	b8 02 00 00 00       	mov    $0x2,%eax
+  80285b:	e8 3f ff ff ff       	call   80279f <nsipc>
+  802860:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802863:	c9                   	leave
+  802864:	c3                   	ret
+
+00802865 <nsipc_shutdown>:
+  802865:	55                   	push   %ebp
+  802866:	89 e5                	mov    %esp,%ebp
+  802868:	83 ec 08             	sub    $0x8,%esp
+  80286b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802873:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802876:	a3 04 70 80 00       	mov    %eax,0x807004
+  80287b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802880:	e8 1a ff ff ff       	call   80279f <nsipc>
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+00802887 <nsipc_close>:
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	83 ec 08             	sub    $0x8,%esp
+  80288d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802890:	a3 00 70 80 00       	mov    %eax,0x807000
+  802895:	b8 04 00 00 00       	mov    $0x4,%eax
+  80289a:	e8 00 ff ff ff       	call   80279f <nsipc>
+  80289f:	c9                   	leave
+  8028a0:	c3                   	ret
+
+008028a1 <nsipc_connect>:
+  8028a1:	55                   	push   %ebp
+  8028a2:	89 e5                	mov    %esp,%ebp
+  8028a4:	53                   	push   %ebx
+  8028a5:	83 ec 08             	sub    $0x8,%esp
+  8028a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ae:	a3 00 70 80 00       	mov    %eax,0x807000
+  8028b3:	53                   	push   %ebx
+  8028b4:	ff 75 0c             	push   0xc(%ebp)
+  8028b7:	68 04 70 80 00       	push   $0x807004
+  8028bc:	e8 98 e4 ff ff       	call   800d59 <memmove>
+  8028c1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8028c7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8028cc:	e8 ce fe ff ff       	call   80279f <nsipc>
+  8028d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+
+008028d6 <nsipc_listen>:
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	83 ec 08             	sub    $0x8,%esp
+  8028dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028df:	a3 00 70 80 00       	mov    %eax,0x807000
+  8028e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028e7:	a3 04 70 80 00       	mov    %eax,0x807004
+  8028ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8028f1:	e8 a9 fe ff ff       	call   80279f <nsipc>
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+
+008028f8 <nsipc_recv>:
+  8028f8:	55                   	push   %ebp
+  8028f9:	89 e5                	mov    %esp,%ebp
+  8028fb:	56                   	push   %esi
+  8028fc:	53                   	push   %ebx
+  8028fd:	8b 75 10             	mov    0x10(%ebp),%esi
+  802900:	8b 45 08             	mov    0x8(%ebp),%eax
+  802903:	a3 00 70 80 00       	mov    %eax,0x807000
+  802908:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80290e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802911:	a3 08 70 80 00       	mov    %eax,0x807008
+  802916:	b8 07 00 00 00       	mov    $0x7,%eax
+  80291b:	e8 7f fe ff ff       	call   80279f <nsipc>
+  802920:	89 c3                	mov    %eax,%ebx
+  802922:	85 c0                	test   %eax,%eax
+  802924:	78 22                	js     802948 <nsipc_recv+0x50>
+  802926:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80292b:	39 c6                	cmp    %eax,%esi
+  80292d:	0f 4e c6             	cmovle %esi,%eax
+  802930:	39 c3                	cmp    %eax,%ebx
+  802932:	7f 1d                	jg     802951 <nsipc_recv+0x59>
+  802934:	83 ec 04             	sub    $0x4,%esp
+  802937:	53                   	push   %ebx
+  802938:	68 00 70 80 00       	push   $0x807000
+  80293d:	ff 75 0c             	push   0xc(%ebp)
+  802940:	e8 14 e4 ff ff       	call   800d59 <memmove>
+  802945:	83 c4 10             	add    $0x10,%esp
+  802948:	89 d8                	mov    %ebx,%eax
+  80294a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80294d:	5b                   	pop    %ebx
+  80294e:	5e                   	pop    %esi
+  80294f:	5d                   	pop    %ebp
+  802950:	c3                   	ret
+  802951:	68 a4 38 80 00       	push   $0x8038a4
+  802956:	68 b9 38 80 00       	push   $0x8038b9
+  80295b:	6a 60                	push   $0x60
+  80295d:	68 ce 38 80 00       	push   $0x8038ce
+  802962:	e8 80 d9 ff ff       	call   8002e7 <_panic>
+
+00802967 <nsipc_send>:
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	53                   	push   %ebx
+  80296b:	83 ec 04             	sub    $0x4,%esp
+  80296e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802971:	8b 45 08             	mov    0x8(%ebp),%eax
+  802974:	a3 00 70 80 00       	mov    %eax,0x807000
+  802979:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80297f:	7f 2e                	jg     8029af <nsipc_send+0x48>
+  802981:	83 ec 04             	sub    $0x4,%esp
+  802984:	53                   	push   %ebx
+  802985:	ff 75 0c             	push   0xc(%ebp)
+  802988:	68 0c 70 80 00       	push   $0x80700c
+  80298d:	e8 c7 e3 ff ff       	call   800d59 <memmove>
+  802992:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80299b:	a3 08 70 80 00       	mov    %eax,0x807008
+  8029a0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029a5:	e8 f5 fd ff ff       	call   80279f <nsipc>
+  8029aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+  8029af:	68 da 38 80 00       	push   $0x8038da
+  8029b4:	68 b9 38 80 00       	push   $0x8038b9
+  8029b9:	6a 6b                	push   $0x6b
+  8029bb:	68 ce 38 80 00       	push   $0x8038ce
+  8029c0:	e8 22 d9 ff ff       	call   8002e7 <_panic>
+
+008029c5 <nsipc_socket>:
+  8029c5:	55                   	push   %ebp
+  8029c6:	89 e5                	mov    %esp,%ebp
+  8029c8:	83 ec 08             	sub    $0x8,%esp
+  8029cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ce:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d6:	a3 04 70 80 00       	mov    %eax,0x807004
+  8029db:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029de:	a3 08 70 80 00       	mov    %eax,0x807008
+  8029e3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8029e8:	e8 b2 fd ff ff       	call   80279f <nsipc>
+  8029ed:	c9                   	leave
+  8029ee:	c3                   	ret
+
+008029ef <devpipe_stat>:
+  8029ef:	55                   	push   %ebp
+  8029f0:	89 e5                	mov    %esp,%ebp
+  8029f2:	56                   	push   %esi
+  8029f3:	53                   	push   %ebx
+  8029f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8029f7:	83 ec 0c             	sub    $0xc,%esp
+  8029fa:	ff 75 08             	push   0x8(%ebp)
+  8029fd:	e8 85 ee ff ff       	call   801887 <fd2data>
+  802a02:	89 c6                	mov    %eax,%esi
+  802a04:	83 c4 08             	add    $0x8,%esp
+  802a07:	68 e6 38 80 00       	push   $0x8038e6
+  802a0c:	53                   	push   %ebx
+  802a0d:	e8 97 e1 ff ff       	call   800ba9 <strcpy>
+  802a12:	8b 46 04             	mov    0x4(%esi),%eax
+  802a15:	2b 06                	sub    (%esi),%eax
+  802a17:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802a1d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802a24:	00 00 00 
+  802a27:	c7 83 88 00 00 00 58 	movl   $0x804058,0x88(%ebx)
+  802a2e:	40 80 00 
+  802a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a39:	5b                   	pop    %ebx
+  802a3a:	5e                   	pop    %esi
+  802a3b:	5d                   	pop    %ebp
+  802a3c:	c3                   	ret
+
+00802a3d <devpipe_close>:
+  802a3d:	55                   	push   %ebp
+  802a3e:	89 e5                	mov    %esp,%ebp
+  802a40:	53                   	push   %ebx
+  802a41:	83 ec 0c             	sub    $0xc,%esp
+  802a44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a47:	53                   	push   %ebx
+  802a48:	6a 00                	push   $0x0
+  802a4a:	e8 8c e6 ff ff       	call   8010db <sys_page_unmap>
+  802a4f:	89 1c 24             	mov    %ebx,(%esp)
+  802a52:	e8 30 ee ff ff       	call   801887 <fd2data>
+  802a57:	83 c4 08             	add    $0x8,%esp
+  802a5a:	50                   	push   %eax
+  802a5b:	6a 00                	push   $0x0
+  802a5d:	e8 79 e6 ff ff       	call   8010db <sys_page_unmap>
+  802a62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a65:	c9                   	leave
+  802a66:	c3                   	ret
+
+00802a67 <_pipeisclosed>:
+  802a67:	55                   	push   %ebp
+  802a68:	89 e5                	mov    %esp,%ebp
+  802a6a:	57                   	push   %edi
+  802a6b:	56                   	push   %esi
+  802a6c:	53                   	push   %ebx
+  802a6d:	83 ec 1c             	sub    $0x1c,%esp
+  802a70:	89 c7                	mov    %eax,%edi
+  802a72:	89 d6                	mov    %edx,%esi
+  802a74:	a1 10 54 80 00       	mov    0x805410,%eax
+  802a79:	8b 58 58             	mov    0x58(%eax),%ebx
+  802a7c:	83 ec 0c             	sub    $0xc,%esp
+  802a7f:	57                   	push   %edi
+  802a80:	e8 49 07 00 00       	call   8031ce <pageref>
+  802a85:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a88:	89 34 24             	mov    %esi,(%esp)
+  802a8b:	e8 3e 07 00 00       	call   8031ce <pageref>
+  802a90:	8b 15 10 54 80 00    	mov    0x805410,%edx
+  802a96:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802a99:	83 c4 10             	add    $0x10,%esp
+  802a9c:	39 cb                	cmp    %ecx,%ebx
+  802a9e:	74 1b                	je     802abb <_pipeisclosed+0x54>
+  802aa0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802aa3:	75 cf                	jne    802a74 <_pipeisclosed+0xd>
+  802aa5:	8b 42 58             	mov    0x58(%edx),%eax
+  802aa8:	6a 01                	push   $0x1
+  802aaa:	50                   	push   %eax
+  802aab:	53                   	push   %ebx
+  802aac:	68 ed 38 80 00       	push   $0x8038ed
+  802ab1:	e8 0c d9 ff ff       	call   8003c2 <cprintf>
+  802ab6:	83 c4 10             	add    $0x10,%esp
+  802ab9:	eb b9                	jmp    802a74 <_pipeisclosed+0xd>
+  802abb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802abe:	0f 94 c0             	sete   %al
+  802ac1:	0f b6 c0             	movzbl %al,%eax
+  802ac4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac7:	5b                   	pop    %ebx
+  802ac8:	5e                   	pop    %esi
+  802ac9:	5f                   	pop    %edi
+  802aca:	5d                   	pop    %ebp
+  802acb:	c3                   	ret
+
+00802acc <devpipe_write>:
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	57                   	push   %edi
+  802ad0:	56                   	push   %esi
+  802ad1:	53                   	push   %ebx
+  802ad2:	83 ec 28             	sub    $0x28,%esp
+  802ad5:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ad8:	56                   	push   %esi
+  802ad9:	e8 a9 ed ff ff       	call   801887 <fd2data>
+  802ade:	89 c3                	mov    %eax,%ebx
+  802ae0:	83 c4 10             	add    $0x10,%esp
+  802ae3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ae8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802aec:	74 5c                	je     802b4a <devpipe_write+0x7e>
+  802aee:	8b 43 04             	mov    0x4(%ebx),%eax
+  802af1:	8b 0b                	mov    (%ebx),%ecx
+  802af3:	8d 51 20             	lea    0x20(%ecx),%edx
+  802af6:	39 d0                	cmp    %edx,%eax
+  802af8:	72 1e                	jb     802b18 <devpipe_write+0x4c>
+  802afa:	89 da                	mov    %ebx,%edx
+  802afc:	89 f0                	mov    %esi,%eax
+  802afe:	e8 64 ff ff ff       	call   802a67 <_pipeisclosed>
+  802b03:	85 c0                	test   %eax,%eax
+  802b05:	75 48                	jne    802b4f <devpipe_write+0x83>
+  802b07:	e8 b2 e4 ff ff       	call   800fbe <sys_yield>
+  802b0c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b0f:	8b 0b                	mov    (%ebx),%ecx
+  802b11:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b14:	39 d0                	cmp    %edx,%eax
+  802b16:	73 e2                	jae    802afa <devpipe_write+0x2e>
+  802b18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b1b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802b1f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802b22:	89 c2                	mov    %eax,%edx
+  802b24:	c1 fa 1f             	sar    $0x1f,%edx
+  802b27:	89 d1                	mov    %edx,%ecx
+  802b29:	c1 e9 1b             	shr    $0x1b,%ecx
+  802b2c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b2f:	83 e2 1f             	and    $0x1f,%edx
+  802b32:	29 ca                	sub    %ecx,%edx
+  802b34:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802b38:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802b3c:	83 c0 01             	add    $0x1,%eax
+  802b3f:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b42:	83 c7 01             	add    $0x1,%edi
+  802b45:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802b48:	75 a4                	jne    802aee <devpipe_write+0x22>
+  802b4a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b4d:	eb 05                	jmp    802b54 <devpipe_write+0x88>
+  802b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b57:	5b                   	pop    %ebx
+  802b58:	5e                   	pop    %esi
+  802b59:	5f                   	pop    %edi
+  802b5a:	5d                   	pop    %ebp
+  802b5b:	c3                   	ret
+
+00802b5c <devpipe_read>:
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	57                   	push   %edi
+  802b60:	56                   	push   %esi
+  802b61:	53                   	push   %ebx
+  802b62:	83 ec 18             	sub    $0x18,%esp
+  802b65:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b68:	56                   	push   %esi
+  802b69:	e8 19 ed ff ff       	call   801887 <fd2data>
+  802b6e:	89 c3                	mov    %eax,%ebx
+  802b70:	83 c4 10             	add    $0x10,%esp
+  802b73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b78:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b7c:	74 45                	je     802bc3 <devpipe_read+0x67>
+  802b7e:	8b 03                	mov    (%ebx),%eax
+  802b80:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802b83:	75 1d                	jne    802ba2 <devpipe_read+0x46>
+  802b85:	85 ff                	test   %edi,%edi
+  802b87:	75 3f                	jne    802bc8 <devpipe_read+0x6c>
+  802b89:	89 da                	mov    %ebx,%edx
+  802b8b:	89 f0                	mov    %esi,%eax
+  802b8d:	e8 d5 fe ff ff       	call   802a67 <_pipeisclosed>
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	75 3c                	jne    802bd2 <devpipe_read+0x76>
+  802b96:	e8 23 e4 ff ff       	call   800fbe <sys_yield>
+  802b9b:	8b 03                	mov    (%ebx),%eax
+  802b9d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ba0:	74 e7                	je     802b89 <devpipe_read+0x2d>
+  802ba2:	99                   	cltd
+  802ba3:	c1 ea 1b             	shr    $0x1b,%edx
+  802ba6:	01 d0                	add    %edx,%eax
+  802ba8:	83 e0 1f             	and    $0x1f,%eax
+  802bab:	29 d0                	sub    %edx,%eax
+  802bad:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802bb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bb5:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802bb8:	83 03 01             	addl   $0x1,(%ebx)
+  802bbb:	83 c7 01             	add    $0x1,%edi
+  802bbe:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802bc1:	75 bb                	jne    802b7e <devpipe_read+0x22>
+  802bc3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bc6:	eb 02                	jmp    802bca <devpipe_read+0x6e>
+  802bc8:	89 f8                	mov    %edi,%eax
+  802bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bcd:	5b                   	pop    %ebx
+  802bce:	5e                   	pop    %esi
+  802bcf:	5f                   	pop    %edi
+  802bd0:	5d                   	pop    %ebp
+  802bd1:	c3                   	ret
+  802bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd7:	eb f1                	jmp    802bca <devpipe_read+0x6e>
+
+00802bd9 <pipe>:
+  802bd9:	55                   	push   %ebp
+  802bda:	89 e5                	mov    %esp,%ebp
+  802bdc:	56                   	push   %esi
+  802bdd:	53                   	push   %ebx
+  802bde:	83 ec 1c             	sub    $0x1c,%esp
+  802be1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802be4:	50                   	push   %eax
+  802be5:	e8 b4 ec ff ff       	call   80189e <fd_alloc>
+  802bea:	89 c3                	mov    %eax,%ebx
+  802bec:	83 c4 10             	add    $0x10,%esp
+  802bef:	85 c0                	test   %eax,%eax
+  802bf1:	0f 88 23 01 00 00    	js     802d1a <pipe+0x141>
+  802bf7:	83 ec 04             	sub    $0x4,%esp
+  802bfa:	68 07 04 00 00       	push   $0x407
+  802bff:	ff 75 f4             	push   -0xc(%ebp)
+  802c02:	6a 00                	push   $0x0
+  802c04:	e8 00 e4 ff ff       	call   801009 <sys_page_alloc>
+  802c09:	89 c3                	mov    %eax,%ebx
+  802c0b:	83 c4 10             	add    $0x10,%esp
+  802c0e:	85 c0                	test   %eax,%eax
+  802c10:	0f 88 04 01 00 00    	js     802d1a <pipe+0x141>
+  802c16:	83 ec 0c             	sub    $0xc,%esp
+  802c19:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802c1c:	50                   	push   %eax
+  802c1d:	e8 7c ec ff ff       	call   80189e <fd_alloc>
+  802c22:	89 c3                	mov    %eax,%ebx
+  802c24:	83 c4 10             	add    $0x10,%esp
+  802c27:	85 c0                	test   %eax,%eax
+  802c29:	0f 88 db 00 00 00    	js     802d0a <pipe+0x131>
+  802c2f:	83 ec 04             	sub    $0x4,%esp
+  802c32:	68 07 04 00 00       	push   $0x407
+  802c37:	ff 75 f0             	push   -0x10(%ebp)
+  802c3a:	6a 00                	push   $0x0
+  802c3c:	e8 c8 e3 ff ff       	call   801009 <sys_page_alloc>
+  802c41:	89 c3                	mov    %eax,%ebx
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	85 c0                	test   %eax,%eax
+  802c48:	0f 88 bc 00 00 00    	js     802d0a <pipe+0x131>
+  802c4e:	83 ec 0c             	sub    $0xc,%esp
+  802c51:	ff 75 f4             	push   -0xc(%ebp)
+  802c54:	e8 2e ec ff ff       	call   801887 <fd2data>
+  802c59:	89 c6                	mov    %eax,%esi
+  802c5b:	83 c4 0c             	add    $0xc,%esp
+  802c5e:	68 07 04 00 00       	push   $0x407
+  802c63:	50                   	push   %eax
+  802c64:	6a 00                	push   $0x0
+  802c66:	e8 9e e3 ff ff       	call   801009 <sys_page_alloc>
+  802c6b:	89 c3                	mov    %eax,%ebx
+  802c6d:	83 c4 10             	add    $0x10,%esp
+  802c70:	85 c0                	test   %eax,%eax
+  802c72:	0f 88 82 00 00 00    	js     802cfa <pipe+0x121>
+  802c78:	83 ec 0c             	sub    $0xc,%esp
+  802c7b:	ff 75 f0             	push   -0x10(%ebp)
+  802c7e:	e8 04 ec ff ff       	call   801887 <fd2data>
+  802c83:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802c8a:	50                   	push   %eax
+  802c8b:	6a 00                	push   $0x0
+  802c8d:	56                   	push   %esi
+  802c8e:	6a 00                	push   $0x0
+  802c90:	e8 b7 e3 ff ff       	call   80104c <sys_page_map>
+  802c95:	89 c3                	mov    %eax,%ebx
+  802c97:	83 c4 20             	add    $0x20,%esp
+  802c9a:	85 c0                	test   %eax,%eax
+  802c9c:	78 4e                	js     802cec <pipe+0x113>
+  802c9e:	a1 58 40 80 00       	mov    0x804058,%eax
+  802ca3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ca6:	89 02                	mov    %eax,(%edx)
+  802ca8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802cab:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802cb2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802cb5:	89 02                	mov    %eax,(%edx)
+  802cb7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802cba:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802cc1:	83 ec 0c             	sub    $0xc,%esp
+  802cc4:	ff 75 f4             	push   -0xc(%ebp)
+  802cc7:	e8 ab eb ff ff       	call   801877 <fd2num>
+  802ccc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ccf:	89 01                	mov    %eax,(%ecx)
+  802cd1:	83 c4 04             	add    $0x4,%esp
+  802cd4:	ff 75 f0             	push   -0x10(%ebp)
+  802cd7:	e8 9b eb ff ff       	call   801877 <fd2num>
+  802cdc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cdf:	89 41 04             	mov    %eax,0x4(%ecx)
+  802ce2:	83 c4 10             	add    $0x10,%esp
+  802ce5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cea:	eb 2e                	jmp    802d1a <pipe+0x141>
+  802cec:	83 ec 08             	sub    $0x8,%esp
+  802cef:	56                   	push   %esi
+  802cf0:	6a 00                	push   $0x0
+  802cf2:	e8 e4 e3 ff ff       	call   8010db <sys_page_unmap>
+  802cf7:	83 c4 10             	add    $0x10,%esp
+  802cfa:	83 ec 08             	sub    $0x8,%esp
+  802cfd:	ff 75 f0             	push   -0x10(%ebp)
+  802d00:	6a 00                	push   $0x0
+  802d02:	e8 d4 e3 ff ff       	call   8010db <sys_page_unmap>
+  802d07:	83 c4 10             	add    $0x10,%esp
+  802d0a:	83 ec 08             	sub    $0x8,%esp
+  802d0d:	ff 75 f4             	push   -0xc(%ebp)
+  802d10:	6a 00                	push   $0x0
+  802d12:	e8 c4 e3 ff ff       	call   8010db <sys_page_unmap>
+  802d17:	83 c4 10             	add    $0x10,%esp
+  802d1a:	89 d8                	mov    %ebx,%eax
+  802d1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d1f:	5b                   	pop    %ebx
+  802d20:	5e                   	pop    %esi
+  802d21:	5d                   	pop    %ebp
+  802d22:	c3                   	ret
+
+00802d23 <pipeisclosed>:
+  802d23:	55                   	push   %ebp
+  802d24:	89 e5                	mov    %esp,%ebp
+  802d26:	83 ec 20             	sub    $0x20,%esp
+  802d29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d2c:	50                   	push   %eax
+  802d2d:	ff 75 08             	push   0x8(%ebp)
+  802d30:	e8 b9 eb ff ff       	call   8018ee <fd_lookup>
+  802d35:	83 c4 10             	add    $0x10,%esp
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	78 18                	js     802d54 <pipeisclosed+0x31>
+  802d3c:	83 ec 0c             	sub    $0xc,%esp
+  802d3f:	ff 75 f4             	push   -0xc(%ebp)
+  802d42:	e8 40 eb ff ff       	call   801887 <fd2data>
+  802d47:	89 c2                	mov    %eax,%edx
+  802d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d4c:	e8 16 fd ff ff       	call   802a67 <_pipeisclosed>
+  802d51:	83 c4 10             	add    $0x10,%esp
+  802d54:	c9                   	leave
+  802d55:	c3                   	ret
+
+00802d56 <ipcring_init>:
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	53                   	push   %ebx
+  802d5a:	83 ec 08             	sub    $0x8,%esp
+  802d5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802d60:	6a 60                	push   $0x60
+  802d62:	6a 00                	push   $0x0
+  802d64:	53                   	push   %ebx
+  802d65:	e8 ba df ff ff       	call   800d24 <memset>
+  802d6a:	a1 10 54 80 00       	mov    0x805410,%eax
+  802d6f:	8b 40 48             	mov    0x48(%eax),%eax
+  802d72:	89 03                	mov    %eax,(%ebx)
+  802d74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d77:	89 43 04             	mov    %eax,0x4(%ebx)
+  802d7a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d7d:	89 43 08             	mov    %eax,0x8(%ebx)
+  802d80:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d83:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802d86:	83 c4 10             	add    $0x10,%esp
+  802d89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+00802d8e <ipcring_req_slot>:
+  802d8e:	55                   	push   %ebp
+  802d8f:	89 e5                	mov    %esp,%ebp
+  802d91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d94:	8b 50 10             	mov    0x10(%eax),%edx
+  802d97:	8b 48 18             	mov    0x18(%eax),%ecx
+  802d9a:	29 ca                	sub    %ecx,%edx
+  802d9c:	83 fa 07             	cmp    $0x7,%edx
+  802d9f:	77 0c                	ja     802dad <ipcring_req_slot+0x1f>
+  802da1:	8b 50 10             	mov    0x10(%eax),%edx
+  802da4:	83 e2 07             	and    $0x7,%edx
+  802da7:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802dab:	5d                   	pop    %ebp
+  802dac:	c3                   	ret
+  802dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db2:	eb f7                	jmp    802dab <ipcring_req_slot+0x1d>
+
+00802db4 <ipcring_req_push>:
+  802db4:	55                   	push   %ebp
+  802db5:	89 e5                	mov    %esp,%ebp
+  802db7:	83 ec 08             	sub    $0x8,%esp
+  802dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  802dbd:	8b 42 10             	mov    0x10(%edx),%eax
+  802dc0:	83 c0 01             	add    $0x1,%eax
+  802dc3:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcc:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802dd0:	85 c0                	test   %eax,%eax
+  802dd2:	75 02                	jne    802dd6 <ipcring_req_push+0x22>
+  802dd4:	c9                   	leave
+  802dd5:	c3                   	ret
+  802dd6:	6a 00                	push   $0x0
+  802dd8:	68 00 00 80 ee       	push   $0xee800000
+  802ddd:	ff 72 08             	push   0x8(%edx)
+  802de0:	ff 72 04             	push   0x4(%edx)
+  802de3:	e8 59 e5 ff ff       	call   801341 <sys_ipc_send>
+  802de8:	83 c4 10             	add    $0x10,%esp
+  802deb:	eb e7                	jmp    802dd4 <ipcring_req_push+0x20>
+
+00802ded <ipcring_rsp_wait>:
+  802ded:	55                   	push   %ebp
+  802dee:	89 e5                	mov    %esp,%ebp
+  802df0:	53                   	push   %ebx
+  802df1:	83 ec 04             	sub    $0x4,%esp
+  802df4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802df7:	8b 53 18             	mov    0x18(%ebx),%edx
+  802dfa:	8b 43 10             	mov    0x10(%ebx),%eax
+  802dfd:	39 c2                	cmp    %eax,%edx
+  802dff:	74 3c                	je     802e3d <ipcring_rsp_wait+0x50>
+  802e01:	8b 53 14             	mov    0x14(%ebx),%edx
+  802e04:	8b 43 18             	mov    0x18(%ebx),%eax
+  802e07:	39 c2                	cmp    %eax,%edx
+  802e09:	75 23                	jne    802e2e <ipcring_rsp_wait+0x41>
+  802e0b:	83 ec 08             	sub    $0x8,%esp
+  802e0e:	6a 00                	push   $0x0
+  802e10:	6a 00                	push   $0x0
+  802e12:	6a 00                	push   $0x0
+  802e14:	6a 00                	push   $0x0
+  802e16:	ff 73 0c             	push   0xc(%ebx)
+  802e19:	ff 73 04             	push   0x4(%ebx)
+  802e1c:	e8 f8 01 00 00       	call   803019 <ipc_call>
+  802e21:	8b 53 14             	mov    0x14(%ebx),%edx
+  802e24:	8b 43 18             	mov    0x18(%ebx),%eax
+  802e27:	83 c4 20             	add    $0x20,%esp
+  802e2a:	39 c2                	cmp    %eax,%edx
+  802e2c:	74 dd                	je     802e0b <ipcring_rsp_wait+0x1e>
+  802e2e:	8b 43 18             	mov    0x18(%ebx),%eax
+  802e31:	83 e0 07             	and    $0x7,%eax
+  802e34:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802e38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e3b:	c9                   	leave
+  802e3c:	c3                   	ret
+  802e3d:	68 08 39 80 00       	push   $0x803908
+  802e42:	68 b9 38 80 00       	push   $0x8038b9
+  802e47:	6a 3b                	push   $0x3b
+  802e49:	68 29 39 80 00       	push   $0x803929
+  802e4e:	e8 94 d4 ff ff       	call   8002e7 <_panic>
+
+00802e53 <ipcring_rsp_pop>:
+  802e53:	55                   	push   %ebp
+  802e54:	89 e5                	mov    %esp,%ebp
+  802e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e59:	8b 42 18             	mov    0x18(%edx),%eax
+  802e5c:	83 c0 01             	add    $0x1,%eax
+  802e5f:	89 42 18             	mov    %eax,0x18(%edx)
+  802e62:	5d                   	pop    %ebp
+  802e63:	c3                   	ret
+
+00802e64 <ipcring_server_init>:
+  802e64:	55                   	push   %ebp
+  802e65:	89 e5                	mov    %esp,%ebp
+  802e67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e6d:	89 10                	mov    %edx,(%eax)
+  802e6f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802e72:	89 50 04             	mov    %edx,0x4(%eax)
+  802e75:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802e7c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802e83:	5d                   	pop    %ebp
+  802e84:	c3                   	ret
+
+00802e85 <ipcring_req_avail>:
+  802e85:	55                   	push   %ebp
+  802e86:	89 e5                	mov    %esp,%ebp
+  802e88:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e8b:	8b 02                	mov    (%edx),%eax
+  802e8d:	8b 40 10             	mov    0x10(%eax),%eax
+  802e90:	2b 42 08             	sub    0x8(%edx),%eax
+  802e93:	ba 08 00 00 00       	mov    $0x8,%edx
+  802e98:	39 d0                	cmp    %edx,%eax
+  802e9a:	0f 47 c2             	cmova  %edx,%eax
+  802e9d:	5d                   	pop    %ebp
+  802e9e:	c3                   	ret
+
+00802e9f <ipcring_req_peek>:
+  802e9f:	55                   	push   %ebp
+  802ea0:	89 e5                	mov    %esp,%ebp
+  802ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ea5:	8b 42 08             	mov    0x8(%edx),%eax
+  802ea8:	83 e0 07             	and    $0x7,%eax
+  802eab:	8b 12                	mov    (%edx),%edx
+  802ead:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802eb1:	5d                   	pop    %ebp
+  802eb2:	c3                   	ret
+
+00802eb3 <ipcring_rsp_push>:
+  802eb3:	55                   	push   %ebp
+  802eb4:	89 e5                	mov    %esp,%ebp
+  802eb6:	83 ec 08             	sub    $0x8,%esp
+  802eb9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ebc:	8b 41 08             	mov    0x8(%ecx),%eax
+  802ebf:	83 c0 01             	add    $0x1,%eax
+  802ec2:	89 41 08             	mov    %eax,0x8(%ecx)
+  802ec5:	8b 11                	mov    (%ecx),%edx
+  802ec7:	83 c2 14             	add    $0x14,%edx
+  802eca:	f0 87 02             	lock xchg %eax,(%edx)
+  802ecd:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802ed1:	75 02                	jne    802ed5 <ipcring_rsp_push+0x22>
+  802ed3:	c9                   	leave
+  802ed4:	c3                   	ret
+  802ed5:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802edc:	6a 00                	push   $0x0
+  802ede:	68 00 00 80 ee       	push   $0xee800000
+  802ee3:	6a 00                	push   $0x0
+  802ee5:	ff 71 04             	push   0x4(%ecx)
+  802ee8:	e8 77 e3 ff ff       	call   801264 <sys_ipc_try_send>
+  802eed:	83 c4 10             	add    $0x10,%esp
+  802ef0:	eb e1                	jmp    802ed3 <ipcring_rsp_push+0x20>
+
+00802ef2 <ipcring_client_wait>:
+  802ef2:	55                   	push   %ebp
+  802ef3:	89 e5                	mov    %esp,%ebp
+  802ef5:	83 ec 08             	sub    $0x8,%esp
+  802ef8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efb:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802f02:	8b 10                	mov    (%eax),%edx
+  802f04:	8b 52 18             	mov    0x18(%edx),%edx
+  802f07:	3b 50 08             	cmp    0x8(%eax),%edx
+  802f0a:	75 02                	jne    802f0e <ipcring_client_wait+0x1c>
+  802f0c:	c9                   	leave
+  802f0d:	c3                   	ret
+  802f0e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802f15:	6a 00                	push   $0x0
+  802f17:	68 00 00 80 ee       	push   $0xee800000
+  802f1c:	6a 00                	push   $0x0
+  802f1e:	ff 70 04             	push   0x4(%eax)
+  802f21:	e8 3e e3 ff ff       	call   801264 <sys_ipc_try_send>
+  802f26:	83 c4 10             	add    $0x10,%esp
+  802f29:	eb e1                	jmp    802f0c <ipcring_client_wait+0x1a>
+
+00802f2b <ipcring_server_sleep>:
+  802f2b:	55                   	push   %ebp
+  802f2c:	89 e5                	mov    %esp,%ebp
+  802f2e:	53                   	push   %ebx
+  802f2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f32:	8b 01                	mov    (%ecx),%eax
+  802f34:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802f37:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f3c:	f0 87 02             	lock xchg %eax,(%edx)
+  802f3f:	8b 11                	mov    (%ecx),%edx
+  802f41:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802f44:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f49:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802f4c:	74 0e                	je     802f5c <ipcring_server_sleep+0x31>
+  802f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f53:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f5f:	c9                   	leave
+  802f60:	c3                   	ret
+
+00802f61 <ipc_recv>:
+  802f61:	55                   	push   %ebp
+  802f62:	89 e5                	mov    %esp,%ebp
+  802f64:	56                   	push   %esi
+  802f65:	53                   	push   %ebx
+  802f66:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f6f:	85 c0                	test   %eax,%eax
+  802f71:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802f76:	0f 44 c2             	cmove  %edx,%eax
+  802f79:	83 ec 0c             	sub    $0xc,%esp
+  802f7c:	50                   	push   %eax
+  802f7d:	e8 32 e3 ff ff       	call   8012b4 <sys_ipc_recv>
+  802f82:	83 c4 10             	add    $0x10,%esp
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	78 2a                	js     802fb3 <ipc_recv+0x52>
+  802f89:	a1 10 54 80 00       	mov    0x805410,%eax
+  802f8e:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802f94:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802f9a:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802fa0:	85 f6                	test   %esi,%esi
+  802fa2:	74 02                	je     802fa6 <ipc_recv+0x45>
+  802fa4:	89 0e                	mov    %ecx,(%esi)
+  802fa6:	85 db                	test   %ebx,%ebx
+  802fa8:	74 02                	je     802fac <ipc_recv+0x4b>
+  802faa:	89 13                	mov    %edx,(%ebx)
+  802fac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802faf:	5b                   	pop    %ebx
+  802fb0:	5e                   	pop    %esi
+  802fb1:	5d                   	pop    %ebp
+  802fb2:	c3                   	ret
+  802fb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fbd:	eb e1                	jmp    802fa0 <ipc_recv+0x3f>
+
+00802fbf <ipc_send>:
+  802fbf:	55                   	push   %ebp
+  802fc0:	89 e5                	mov    %esp,%ebp
+  802fc2:	57                   	push   %edi
+  802fc3:	56                   	push   %esi
+  802fc4:	53                   	push   %ebx
+  802fc5:	83 ec 0c             	sub    $0xc,%esp
+  802fc8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802fcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fce:	8b 75 14             	mov    0x14(%ebp),%esi
+  802fd1:	85 db                	test   %ebx,%ebx
+  802fd3:	74 1e                	je     802ff3 <ipc_send+0x34>
+  802fd5:	56                   	push   %esi
+  802fd6:	53                   	push   %ebx
+  802fd7:	57                   	push   %edi
+  802fd8:	ff 75 08             	push   0x8(%ebp)
+  802fdb:	e8 61 e3 ff ff       	call   801341 <sys_ipc_send>
+  802fe0:	83 c4 10             	add    $0x10,%esp
+  802fe3:	85 c0                	test   %eax,%eax
+  802fe5:	74 2a                	je     803011 <ipc_send+0x52>
+  802fe7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802fea:	75 13                	jne    802fff <ipc_send+0x40>
+  802fec:	e8 cd df ff ff       	call   800fbe <sys_yield>
+  802ff1:	eb e2                	jmp    802fd5 <ipc_send+0x16>
+  802ff3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff8:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802ffd:	eb d6                	jmp    802fd5 <ipc_send+0x16>
+  802fff:	50                   	push   %eax
+  803000:	68 38 39 80 00       	push   $0x803938
+  803005:	6a 4f                	push   $0x4f
+  803007:	68 7b 39 80 00       	push   $0x80397b
+  80300c:	e8 d6 d2 ff ff       	call   8002e7 <_panic>
+  803011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803014:	5b                   	pop    %ebx
+  803015:	5e                   	pop    %esi
+  803016:	5f                   	pop    %edi
+  803017:	5d                   	pop    %ebp
+  803018:	c3                   	ret
+
+00803019 <ipc_call>:
+  803019:	55                   	push   %ebp
+  80301a:	89 e5                	mov    %esp,%ebp
+  80301c:	57                   	push   %edi
+  80301d:	56                   	push   %esi
+  80301e:	53                   	push   %ebx
+  80301f:	83 ec 0c             	sub    $0xc,%esp
+  803022:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803026:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  80302b:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  80302f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803033:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803038:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80303c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803040:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803045:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803049:	eb 05                	jmp    803050 <ipc_call+0x37>
+  80304b:	e8 6e df ff ff       	call   800fbe <sys_yield>
+  803050:	83 ec 0c             	sub    $0xc,%esp
+  803053:	56                   	push   %esi
+  803054:	53                   	push   %ebx
+  803055:	57                   	push   %edi
+  803056:	ff 75 0c             	push   0xc(%ebp)
+  803059:	ff 75 08             	push   0x8(%ebp)
+  80305c:	e8 30 e3 ff ff       	call   801391 <sys_ipc_call>
+  803061:	83 c4 20             	add    $0x20,%esp
+  803064:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803067:	74 e2                	je     80304b <ipc_call+0x32>
+  803069:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80306c:	74 2d                	je     80309b <ipc_call+0x82>
+  80306e:	85 c0                	test   %eax,%eax
+  803070:	78 4f                	js     8030c1 <ipc_call+0xa8>
+  803072:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803076:	74 10                	je     803088 <ipc_call+0x6f>
+  803078:	a1 10 54 80 00       	mov    0x805410,%eax
+  80307d:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803083:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803086:	89 02                	mov    %eax,(%edx)
+  803088:	a1 10 54 80 00       	mov    0x805410,%eax
+  80308d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803093:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803096:	5b                   	pop    %ebx
+  803097:	5e                   	pop    %esi
+  803098:	5f                   	pop    %edi
+  803099:	5d                   	pop    %ebp
+  80309a:	c3                   	ret
+  80309b:	ff 75 14             	push   0x14(%ebp)
+  80309e:	ff 75 10             	push   0x10(%ebp)
+  8030a1:	ff 75 0c             	push   0xc(%ebp)
+  8030a4:	ff 75 08             	push   0x8(%ebp)
+  8030a7:	e8 13 ff ff ff       	call   802fbf <ipc_send>
+  8030ac:	83 c4 0c             	add    $0xc,%esp
+  8030af:	ff 75 1c             	push   0x1c(%ebp)
+  8030b2:	ff 75 18             	push   0x18(%ebp)
+  8030b5:	6a 00                	push   $0x0
+  8030b7:	e8 a5 fe ff ff       	call   802f61 <ipc_recv>
+  8030bc:	83 c4 10             	add    $0x10,%esp
+  8030bf:	eb d2                	jmp    803093 <ipc_call+0x7a>
+  8030c1:	50                   	push   %eax
+  8030c2:	68 85 39 80 00       	push   $0x803985
+  8030c7:	6a 6d                	push   $0x6d
+  8030c9:	68 7b 39 80 00       	push   $0x80397b
+  8030ce:	e8 14 d2 ff ff       	call   8002e7 <_panic>
+
+008030d3 <ipc_reply_recv>:
+  8030d3:	55                   	push   %ebp
+  8030d4:	89 e5                	mov    %esp,%ebp
+  8030d6:	57                   	push   %edi
+  8030d7:	56                   	push   %esi
+  8030d8:	53                   	push   %ebx
+  8030d9:	83 ec 0c             	sub    $0xc,%esp
+  8030dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030df:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8030e2:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8030e5:	85 db                	test   %ebx,%ebx
+  8030e7:	0f 84 ac 00 00 00    	je     803199 <ipc_reply_recv+0xc6>
+  8030ed:	85 f6                	test   %esi,%esi
+  8030ef:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8030f4:	0f 45 c6             	cmovne %esi,%eax
+  8030f7:	83 ec 0c             	sub    $0xc,%esp
+  8030fa:	50                   	push   %eax
+  8030fb:	ff 75 14             	push   0x14(%ebp)
+  8030fe:	53                   	push   %ebx
+  8030ff:	ff 75 0c             	push   0xc(%ebp)
+  803102:	ff 75 08             	push   0x8(%ebp)
+  803105:	e8 a8 e2 ff ff       	call   8013b2 <sys_ipc_reply_recv>
+  80310a:	83 c4 20             	add    $0x20,%esp
+  80310d:	85 c0                	test   %eax,%eax
+  80310f:	78 3a                	js     80314b <ipc_reply_recv+0x78>
+  803111:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803115:	74 10                	je     803127 <ipc_reply_recv+0x54>
+  803117:	a1 10 54 80 00       	mov    0x805410,%eax
+  80311c:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803122:	8b 55 18             	mov    0x18(%ebp),%edx
+  803125:	89 02                	mov    %eax,(%edx)
+  803127:	85 ff                	test   %edi,%edi
+  803129:	74 0d                	je     803138 <ipc_reply_recv+0x65>
+  80312b:	a1 10 54 80 00       	mov    0x805410,%eax
+  803130:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803136:	89 07                	mov    %eax,(%edi)
+  803138:	a1 10 54 80 00       	mov    0x805410,%eax
+  80313d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803143:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803146:	5b                   	pop    %ebx
+  803147:	5e                   	pop    %esi
+  803148:	5f                   	pop    %edi
+  803149:	5d                   	pop    %ebp
+  80314a:	c3                   	ret
+  80314b:	ff 75 14             	push   0x14(%ebp)
+  80314e:	53                   	push   %ebx
+  80314f:	ff 75 0c             	push   0xc(%ebp)
+  803152:	ff 75 08             	push   0x8(%ebp)
+  803155:	e8 0a e1 ff ff       	call   801264 <sys_ipc_try_send>
+  80315a:	89 c2                	mov    %eax,%edx
+  80315c:	c1 ea 1f             	shr    $0x1f,%edx
+  80315f:	83 c4 10             	add    $0x10,%esp
+  803162:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803165:	0f 95 c1             	setne  %cl
+  803168:	84 d1                	test   %dl,%cl
+  80316a:	74 05                	je     803171 <ipc_reply_recv+0x9e>
+  80316c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80316f:	75 12                	jne    803183 <ipc_reply_recv+0xb0>
+  803171:	83 ec 04             	sub    $0x4,%esp
+  803174:	57                   	push   %edi
+  803175:	56                   	push   %esi
+  803176:	ff 75 18             	push   0x18(%ebp)
+  803179:	e8 e3 fd ff ff       	call   802f61 <ipc_recv>
+  80317e:	83 c4 10             	add    $0x10,%esp
+  803181:	eb c0                	jmp    803143 <ipc_reply_recv+0x70>
+  803183:	83 ec 04             	sub    $0x4,%esp
+  803186:	50                   	push   %eax
+  803187:	ff 75 08             	push   0x8(%ebp)
+  80318a:	68 58 39 80 00       	push   $0x803958
+  80318f:	e8 2e d2 ff ff       	call   8003c2 <cprintf>
+  803194:	83 c4 10             	add    $0x10,%esp
+  803197:	eb d8                	jmp    803171 <ipc_reply_recv+0x9e>
+  803199:	85 f6                	test   %esi,%esi
+  80319b:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8031a0:	0f 45 c6             	cmovne %esi,%eax
+  8031a3:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8031a8:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8031af:	e9 43 ff ff ff       	jmp    8030f7 <ipc_reply_recv+0x24>
+
+008031b4 <ipc_find_env>:
+  8031b4:	55                   	push   %ebp
+  8031b5:	89 e5                	mov    %esp,%ebp
+  8031b7:	83 ec 14             	sub    $0x14,%esp
+  8031ba:	ff 75 08             	push   0x8(%ebp)
+  8031bd:	e8 40 e0 ff ff       	call   801202 <sys_env_service>
+  8031c2:	85 c0                	test   %eax,%eax
+  8031c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031c9:	0f 48 c2             	cmovs  %edx,%eax
+  8031cc:	c9                   	leave
+  8031cd:	c3                   	ret
+
+008031ce <pageref>:
+  8031ce:	55                   	push   %ebp
+  8031cf:	89 e5                	mov    %esp,%ebp
+  8031d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d4:	89 c2                	mov    %eax,%edx
+  8031d6:	c1 ea 16             	shr    $0x16,%edx
+  8031d9:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8031e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031e5:	f6 c1 01             	test   $0x1,%cl
+  8031e8:	74 22                	je     80320c <pageref+0x3e>
+  8031ea:	c1 e8 0c             	shr    $0xc,%eax
+  8031ed:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031f4:	a8 01                	test   $0x1,%al
+  8031f6:	74 14                	je     80320c <pageref+0x3e>
+  8031f8:	c1 e8 0c             	shr    $0xc,%eax
+  8031fb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8031fe:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803205:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803209:	0f b7 d2             	movzwl %dx,%edx
+  80320c:	89 d0                	mov    %edx,%eax
+  80320e:	5d                   	pop    %ebp
+  80320f:	c3                   	ret
+
+00803210 <__udivmoddi4>:
+  803210:	55                   	push   %ebp
+  803211:	57                   	push   %edi
+  803212:	56                   	push   %esi
+  803213:	53                   	push   %ebx
+  803214:	83 ec 24             	sub    $0x24,%esp
+  803217:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80321b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80321f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803223:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803227:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80322b:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80322f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803233:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803237:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80323b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803240:	ba 00 00 00 00       	mov    $0x0,%edx
+  803245:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80324a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803251:	00 
+  803252:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803259:	00 
+  80325a:	89 fb                	mov    %edi,%ebx
+  80325c:	eb 08                	jmp    803266 <__udivmoddi4+0x56>
+  80325e:	83 e9 01             	sub    $0x1,%ecx
+  803261:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803264:	74 68                	je     8032ce <__udivmoddi4+0xbe>
+  803266:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80326a:	01 c0                	add    %eax,%eax
+  80326c:	89 c6                	mov    %eax,%esi
+  80326e:	89 d7                	mov    %edx,%edi
+  803270:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803274:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803278:	0f ad d0             	shrd   %cl,%edx,%eax
+  80327b:	d3 ea                	shr    %cl,%edx
+  80327d:	f6 c1 20             	test   $0x20,%cl
+  803280:	74 04                	je     803286 <__udivmoddi4+0x76>
+  803282:	89 d0                	mov    %edx,%eax
+  803284:	31 d2                	xor    %edx,%edx
+  803286:	83 e0 01             	and    $0x1,%eax
+  803289:	89 04 24             	mov    %eax,(%esp)
+  80328c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803293:	00 
+  803294:	8b 04 24             	mov    (%esp),%eax
+  803297:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80329b:	09 f0                	or     %esi,%eax
+  80329d:	09 fa                	or     %edi,%edx
+  80329f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8032a3:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8032a7:	39 f0                	cmp    %esi,%eax
+  8032a9:	89 d5                	mov    %edx,%ebp
+  8032ab:	19 fd                	sbb    %edi,%ebp
+  8032ad:	72 af                	jb     80325e <__udivmoddi4+0x4e>
+  8032af:	29 f0                	sub    %esi,%eax
+  8032b1:	19 fa                	sbb    %edi,%edx
+  8032b3:	89 cf                	mov    %ecx,%edi
+  8032b5:	c1 ef 05             	shr    $0x5,%edi
+  8032b8:	83 e7 01             	and    $0x1,%edi
+  8032bb:	89 fe                	mov    %edi,%esi
+  8032bd:	83 f6 01             	xor    $0x1,%esi
+  8032c0:	d3 e6                	shl    %cl,%esi
+  8032c2:	d3 e7                	shl    %cl,%edi
+  8032c4:	09 74 24 18          	or     %esi,0x18(%esp)
+  8032c8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8032cc:	eb 90                	jmp    80325e <__udivmoddi4+0x4e>
+  8032ce:	85 db                	test   %ebx,%ebx
+  8032d0:	74 05                	je     8032d7 <__udivmoddi4+0xc7>
+  8032d2:	89 03                	mov    %eax,(%ebx)
+  8032d4:	89 53 04             	mov    %edx,0x4(%ebx)
+  8032d7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8032db:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8032df:	83 c4 24             	add    $0x24,%esp
+  8032e2:	5b                   	pop    %ebx
+  8032e3:	5e                   	pop    %esi
+  8032e4:	5f                   	pop    %edi
+  8032e5:	5d                   	pop    %ebp
+  8032e6:	c3                   	ret
+
+008032e7 <__udivdi3>:
+  8032e7:	83 ec 08             	sub    $0x8,%esp
+  8032ea:	6a 00                	push   $0x0
+  8032ec:	ff 74 24 1c          	push   0x1c(%esp)
+  8032f0:	ff 74 24 1c          	push   0x1c(%esp)
+  8032f4:	ff 74 24 1c          	push   0x1c(%esp)
+  8032f8:	ff 74 24 1c          	push   0x1c(%esp)
+  8032fc:	e8 0f ff ff ff       	call   803210 <__udivmoddi4>
+  803301:	83 c4 1c             	add    $0x1c,%esp
+  803304:	c3                   	ret
+
+00803305 <__umoddi3>:
+  803305:	83 ec 18             	sub    $0x18,%esp
+  803308:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80330c:	50                   	push   %eax
+  80330d:	ff 74 24 2c          	push   0x2c(%esp)
+  803311:	ff 74 24 2c          	push   0x2c(%esp)
+  803315:	ff 74 24 2c          	push   0x2c(%esp)
+  803319:	ff 74 24 2c          	push   0x2c(%esp)
+  80331d:	e8 ee fe ff ff       	call   803210 <__udivmoddi4>
+  803322:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803326:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80332a:	83 c4 2c             	add    $0x2c,%esp
+  80332d:	c3                   	ret
+
+0080332e <__divdi3>:
+  80332e:	53                   	push   %ebx
+  80332f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803333:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803337:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80333b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80333f:	85 d2                	test   %edx,%edx
+  803341:	78 12                	js     803355 <__divdi3+0x27>
+  803343:	85 db                	test   %ebx,%ebx
+  803345:	78 2e                	js     803375 <__divdi3+0x47>
+  803347:	53                   	push   %ebx
+  803348:	51                   	push   %ecx
+  803349:	52                   	push   %edx
+  80334a:	50                   	push   %eax
+  80334b:	e8 97 ff ff ff       	call   8032e7 <__udivdi3>
+  803350:	83 c4 10             	add    $0x10,%esp
+  803353:	eb 1e                	jmp    803373 <__divdi3+0x45>
+  803355:	f7 d8                	neg    %eax
+  803357:	83 d2 00             	adc    $0x0,%edx
+  80335a:	f7 da                	neg    %edx
+  80335c:	85 db                	test   %ebx,%ebx
+  80335e:	78 2a                	js     80338a <__divdi3+0x5c>
+  803360:	53                   	push   %ebx
+  803361:	51                   	push   %ecx
+  803362:	52                   	push   %edx
+  803363:	50                   	push   %eax
+  803364:	e8 7e ff ff ff       	call   8032e7 <__udivdi3>
+  803369:	83 c4 10             	add    $0x10,%esp
+  80336c:	f7 d8                	neg    %eax
+  80336e:	83 d2 00             	adc    $0x0,%edx
+  803371:	f7 da                	neg    %edx
+  803373:	5b                   	pop    %ebx
+  803374:	c3                   	ret
+  803375:	f7 d9                	neg    %ecx
+  803377:	83 d3 00             	adc    $0x0,%ebx
+  80337a:	f7 db                	neg    %ebx
+  80337c:	53                   	push   %ebx
+  80337d:	51                   	push   %ecx
+  80337e:	52                   	push   %edx
+  80337f:	50                   	push   %eax
+  803380:	e8 62 ff ff ff       	call   8032e7 <__udivdi3>
+  803385:	83 c4 10             	add    $0x10,%esp
+  803388:	eb e2                	jmp    80336c <__divdi3+0x3e>
+  80338a:	f7 d9                	neg    %ecx
+  80338c:	83 d3 00             	adc    $0x0,%ebx
+  80338f:	f7 db                	neg    %ebx
+  803391:	53                   	push   %ebx
+  803392:	51                   	push   %ecx
+  803393:	52                   	push   %edx
+  803394:	50                   	push   %eax
+  803395:	e8 4d ff ff ff       	call   8032e7 <__udivdi3>
+  80339a:	83 c4 10             	add    $0x10,%esp
+  80339d:	eb d4                	jmp    803373 <__divdi3+0x45>
+
+0080339f <__moddi3>:
+  80339f:	55                   	push   %ebp
+  8033a0:	57                   	push   %edi
+  8033a1:	56                   	push   %esi
+  8033a2:	53                   	push   %ebx
+  8033a3:	83 ec 0c             	sub    $0xc,%esp
+  8033a6:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8033aa:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8033ae:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8033b2:	89 e9                	mov    %ebp,%ecx
+  8033b4:	f7 d9                	neg    %ecx
+  8033b6:	89 d0                	mov    %edx,%eax
+  8033b8:	83 d0 00             	adc    $0x0,%eax
+  8033bb:	f7 d8                	neg    %eax
+  8033bd:	0f 49 e9             	cmovns %ecx,%ebp
+  8033c0:	0f 49 d0             	cmovns %eax,%edx
+  8033c3:	52                   	push   %edx
+  8033c4:	55                   	push   %ebp
+  8033c5:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8033c9:	f7 da                	neg    %edx
+  8033cb:	89 d8                	mov    %ebx,%eax
+  8033cd:	83 d0 00             	adc    $0x0,%eax
+  8033d0:	f7 d8                	neg    %eax
+  8033d2:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8033d7:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8033db:	0f 48 c3             	cmovs  %ebx,%eax
+  8033de:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8033e2:	ff 74 24 0c          	push   0xc(%esp)
+  8033e6:	ff 74 24 0c          	push   0xc(%esp)
+  8033ea:	e8 16 ff ff ff       	call   803305 <__umoddi3>
+  8033ef:	83 c4 10             	add    $0x10,%esp
+  8033f2:	85 db                	test   %ebx,%ebx
+  8033f4:	78 08                	js     8033fe <__moddi3+0x5f>
+  8033f6:	83 c4 0c             	add    $0xc,%esp
+  8033f9:	5b                   	pop    %ebx
+  8033fa:	5e                   	pop    %esi
+  8033fb:	5f                   	pop    %edi
+  8033fc:	5d                   	pop    %ebp
+  8033fd:	c3                   	ret
+  8033fe:	f7 d8                	neg    %eax
+  803400:	83 d2 00             	adc    $0x0,%edx
+  803403:	f7 da                	neg    %edx
+  803405:	eb ef                	jmp    8033f6 <__moddi3+0x57>
@@ -0,0 +1,5671 @@
+
+obj/user/testlargepage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 43 02 00 00       	call   800274 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 08             	sub    $0x8,%esp
+  80003a:	68 87 00 00 00       	push   $0x87
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	6a 00                	push   $0x0
+  800046:	e8 d4 0e 00 00       	call   800f1f <sys_page_alloc>
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	85 c0                	test   %eax,%eax
+  800050:	0f 88 0d 01 00 00    	js     800163 <umain+0x130>
+  800056:	a1 00 da 7b ef       	mov    0xef7bda00,%eax
+  80005b:	a8 80                	test   $0x80,%al
+  80005d:	0f 84 12 01 00 00    	je     800175 <umain+0x142>
+  800063:	c6 05 00 00 00 a0 01 	movb   $0x1,0xa0000000
+  80006a:	c6 05 ff ff 3f a0 02 	movb   $0x2,0xa03fffff
+  800071:	e8 f7 18 00 00       	call   80196d <fork>
+  800076:	89 c3                	mov    %eax,%ebx
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 07 01 00 00    	js     800187 <umain+0x154>
+  800080:	0f 84 13 01 00 00    	je     800199 <umain+0x166>
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 fa 2f 00 00       	call   803089 <wait>
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	b8 e6 39 80 00       	mov    $0x8039e6,%eax
+  800097:	80 3d 00 00 00 a0 01 	cmpb   $0x1,0xa0000000
+  80009e:	0f 84 0d 01 00 00    	je     8001b1 <umain+0x17e>
+  8000a4:	83 ec 08             	sub    $0x8,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	68 1d 3a 80 00       	push   $0x803a1d
+  8000ad:	e8 16 03 00 00       	call   8003c8 <cprintf>
+  8000b2:	83 c4 0c             	add    $0xc,%esp
+  8000b5:	68 87 04 00 00       	push   $0x487
+  8000ba:	68 00 00 40 a0       	push   $0xa0400000
+  8000bf:	6a 00                	push   $0x0
+  8000c1:	e8 59 0e 00 00       	call   800f1f <sys_page_alloc>
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	0f 88 f9 00 00 00    	js     8001ca <umain+0x197>
+  8000d1:	e8 97 18 00 00       	call   80196d <fork>
+  8000d6:	89 c3                	mov    %eax,%ebx
+  8000d8:	85 c0                	test   %eax,%eax
+  8000da:	0f 88 fc 00 00 00    	js     8001dc <umain+0x1a9>
+  8000e0:	0f 84 08 01 00 00    	je     8001ee <umain+0x1bb>
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 9a 2f 00 00       	call   803089 <wait>
+  8000ef:	8b 15 04 da 7b ef    	mov    0xef7bda04,%edx
+  8000f5:	83 c4 10             	add    $0x10,%esp
+  8000f8:	b8 e6 39 80 00       	mov    $0x8039e6,%eax
+  8000fd:	f6 c2 80             	test   $0x80,%dl
+  800100:	0f 85 08 01 00 00    	jne    80020e <umain+0x1db>
+  800106:	83 ec 08             	sub    $0x8,%esp
+  800109:	50                   	push   %eax
+  80010a:	68 37 3a 80 00       	push   $0x803a37
+  80010f:	e8 b4 02 00 00       	call   8003c8 <cprintf>
+  800114:	83 c4 08             	add    $0x8,%esp
+  800117:	68 00 10 40 a0       	push   $0xa0401000
+  80011c:	6a 00                	push   $0x0
+  80011e:	e8 ce 0e 00 00       	call   800ff1 <sys_page_unmap>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	85 c0                	test   %eax,%eax
+  800128:	0f 88 0a 01 00 00    	js     800238 <umain+0x205>
+  80012e:	8b 15 04 da 7b ef    	mov    0xef7bda04,%edx
+  800134:	b8 e6 39 80 00       	mov    $0x8039e6,%eax
+  800139:	f6 c2 80             	test   $0x80,%dl
+  80013c:	75 0f                	jne    80014d <umain+0x11a>
+  80013e:	8b 15 04 10 68 ef    	mov    0xef681004,%edx
+  800144:	f6 c2 01             	test   $0x1,%dl
+  800147:	0f 84 fd 00 00 00    	je     80024a <umain+0x217>
+  80014d:	83 ec 08             	sub    $0x8,%esp
+  800150:	50                   	push   %eax
+  800151:	68 64 3a 80 00       	push   $0x803a64
+  800156:	e8 6d 02 00 00       	call   8003c8 <cprintf>
+  80015b:	83 c4 10             	add    $0x10,%esp
+  80015e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800161:	c9                   	leave
+  800162:	c3                   	ret
+  800163:	50                   	push   %eax
+  800164:	68 ec 39 80 00       	push   $0x8039ec
+  800169:	6a 0f                	push   $0xf
+  80016b:	68 ff 39 80 00       	push   $0x8039ff
+  800170:	e8 78 01 00 00       	call   8002ed <_panic>
+  800175:	83 ec 0c             	sub    $0xc,%esp
+  800178:	68 90 3a 80 00       	push   $0x803a90
+  80017d:	e8 46 02 00 00       	call   8003c8 <cprintf>
+  800182:	83 c4 10             	add    $0x10,%esp
+  800185:	eb d7                	jmp    80015e <umain+0x12b>
+  800187:	50                   	push   %eax
+  800188:	68 14 3a 80 00       	push   $0x803a14
+  80018d:	6a 19                	push   $0x19
+  80018f:	68 ff 39 80 00       	push   $0x8039ff
+  800194:	e8 54 01 00 00       	call   8002ed <_panic>
+  800199:	c6 05 00 00 00 a0 03 	movb   $0x3,0xa0000000
+  8001a0:	c6 05 ff ff 3f a0 04 	movb   $0x4,0xa03fffff
+  8001a7:	e8 11 01 00 00       	call   8002bd <exit>
+  8001ac:	e9 d5 fe ff ff       	jmp    800086 <umain+0x53>
+  8001b1:	80 3d ff ff 3f a0 02 	cmpb   $0x2,0xa03fffff
+  8001b8:	b8 e0 39 80 00       	mov    $0x8039e0,%eax
+  8001bd:	ba e6 39 80 00       	mov    $0x8039e6,%edx
+  8001c2:	0f 45 c2             	cmovne %edx,%eax
+  8001c5:	e9 da fe ff ff       	jmp    8000a4 <umain+0x71>
+  8001ca:	50                   	push   %eax
+  8001cb:	68 ec 39 80 00       	push   $0x8039ec
+  8001d0:	6a 25                	push   $0x25
+  8001d2:	68 ff 39 80 00       	push   $0x8039ff
+  8001d7:	e8 11 01 00 00       	call   8002ed <_panic>
+  8001dc:	50                   	push   %eax
+  8001dd:	68 14 3a 80 00       	push   $0x803a14
+  8001e2:	6a 27                	push   $0x27
+  8001e4:	68 ff 39 80 00       	push   $0x8039ff
+  8001e9:	e8 ff 00 00 00       	call   8002ed <_panic>
+  8001ee:	83 ec 08             	sub    $0x8,%esp
+  8001f1:	ff 35 00 50 80 00    	push   0x805000
+  8001f7:	68 00 00 60 a0       	push   $0xa0600000
+  8001fc:	e8 be 08 00 00       	call   800abf <strcpy>
+  800201:	e8 b7 00 00 00       	call   8002bd <exit>
+  800206:	83 c4 10             	add    $0x10,%esp
+  800209:	e9 d8 fe ff ff       	jmp    8000e6 <umain+0xb3>
+  80020e:	83 ec 08             	sub    $0x8,%esp
+  800211:	ff 35 00 50 80 00    	push   0x805000
+  800217:	68 00 00 60 a0       	push   $0xa0600000
+  80021c:	e8 4e 09 00 00       	call   800b6f <strcmp>
+  800221:	83 c4 10             	add    $0x10,%esp
+  800224:	85 c0                	test   %eax,%eax
+  800226:	b8 e6 39 80 00       	mov    $0x8039e6,%eax
+  80022b:	ba e0 39 80 00       	mov    $0x8039e0,%edx
+  800230:	0f 44 c2             	cmove  %edx,%eax
+  800233:	e9 ce fe ff ff       	jmp    800106 <umain+0xd3>
+  800238:	50                   	push   %eax
+  800239:	68 51 3a 80 00       	push   $0x803a51
+  80023e:	6a 33                	push   $0x33
+  800240:	68 ff 39 80 00       	push   $0x8039ff
+  800245:	e8 a3 00 00 00       	call   8002ed <_panic>
+  80024a:	83 ec 08             	sub    $0x8,%esp
+  80024d:	ff 35 00 50 80 00    	push   0x805000
+  800253:	68 00 00 60 a0       	push   $0xa0600000
+  800258:	e8 12 09 00 00       	call   800b6f <strcmp>
+  80025d:	83 c4 10             	add    $0x10,%esp
+  800260:	85 c0                	test   %eax,%eax
+  800262:	b8 e6 39 80 00       	mov    $0x8039e6,%eax
+  800267:	ba e0 39 80 00       	mov    $0x8039e0,%edx
+  80026c:	0f 44 c2             	cmove  %edx,%eax
+  80026f:	e9 d9 fe ff ff       	jmp    80014d <umain+0x11a>
+
+00800274 <libmain>:
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	56                   	push   %esi
+  800278:	53                   	push   %ebx
+  800279:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80027c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80027f:	e8 31 0c 00 00       	call   800eb5 <sys_getenvid>
+  800284:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800289:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80028f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800294:	a3 14 60 80 00       	mov    %eax,0x806014
+  800299:	85 db                	test   %ebx,%ebx
+  80029b:	7e 07                	jle    8002a4 <libmain+0x30>
+  80029d:	8b 06                	mov    (%esi),%eax
+  80029f:	a3 04 50 80 00       	mov    %eax,0x805004
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	56                   	push   %esi
+  8002a8:	53                   	push   %ebx
+  8002a9:	e8 85 fd ff ff       	call   800033 <umain>
+  8002ae:	e8 0a 00 00 00       	call   8002bd <exit>
+  8002b3:	83 c4 10             	add    $0x10,%esp
+  8002b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002b9:	5b                   	pop    %ebx
+  8002ba:	5e                   	pop    %esi
+  8002bb:	5d                   	pop    %ebp
+  8002bc:	c3                   	ret
+
+008002bd <exit>:
+  8002bd:	55                   	push   %ebp
+  8002be:	89 e5                	mov    %esp,%ebp
+  8002c0:	83 ec 08             	sub    $0x8,%esp
+  8002c3:	a1 14 60 80 00       	mov    0x806014,%eax
+  8002c8:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	75 14                	jne    8002e6 <exit+0x29>
+  8002d2:	e8 b1 1b 00 00       	call   801e88 <close_all>
+  8002d7:	83 ec 0c             	sub    $0xc,%esp
+  8002da:	6a 00                	push   $0x0
+  8002dc:	e8 93 0b 00 00       	call   800e74 <sys_env_destroy>
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	c9                   	leave
+  8002e5:	c3                   	ret
+  8002e6:	e8 f6 12 00 00       	call   8015e1 <sys_lease_complete>
+  8002eb:	eb e5                	jmp    8002d2 <exit+0x15>
+
+008002ed <_panic>:
+  8002ed:	55                   	push   %ebp
+  8002ee:	89 e5                	mov    %esp,%ebp
+  8002f0:	56                   	push   %esi
+  8002f1:	53                   	push   %ebx
+  8002f2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8002f5:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  8002fb:	e8 b5 0b 00 00       	call   800eb5 <sys_getenvid>
+  800300:	83 ec 0c             	sub    $0xc,%esp
+  800303:	ff 75 0c             	push   0xc(%ebp)
+  800306:	ff 75 08             	push   0x8(%ebp)
+  800309:	56                   	push   %esi
+  80030a:	50                   	push   %eax
+  80030b:	68 bc 3a 80 00       	push   $0x803abc
+  800310:	e8 b3 00 00 00       	call   8003c8 <cprintf>
+  800315:	83 c4 18             	add    $0x18,%esp
+  800318:	53                   	push   %ebx
+  800319:	ff 75 10             	push   0x10(%ebp)
+  80031c:	e8 56 00 00 00       	call   800377 <vcprintf>
+  800321:	c7 04 24 f6 3f 80 00 	movl   $0x803ff6,(%esp)
+  800328:	e8 9b 00 00 00       	call   8003c8 <cprintf>
+  80032d:	83 c4 10             	add    $0x10,%esp
+  800330:	cc                   	int3
+  800331:	eb fd                	jmp    800330 <_panic+0x43>
+
+00800333 <putch>:
+  800333:	55                   	push   %ebp
+  800334:	89 e5                	mov    %esp,%ebp
+  800336:	53                   	push   %ebx
+  800337:	83 ec 04             	sub    $0x4,%esp
+  80033a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80033d:	8b 13                	mov    (%ebx),%edx
+  80033f:	8d 42 01             	lea    0x1(%edx),%eax
+  800342:	89 03                	mov    %eax,(%ebx)
+  800344:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800347:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80034b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800350:	74 09                	je     80035b <putch+0x28>
+  800352:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800356:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800359:	c9                   	leave
+  80035a:	c3                   	ret
+  80035b:	83 ec 08             	sub    $0x8,%esp
+  80035e:	68 ff 00 00 00       	push   $0xff
+  800363:	8d 43 08             	lea    0x8(%ebx),%eax
+  800366:	50                   	push   %eax
+  800367:	e8 cb 0a 00 00       	call   800e37 <sys_cputs>
+  80036c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800372:	83 c4 10             	add    $0x10,%esp
+  800375:	eb db                	jmp    800352 <putch+0x1f>
+
+00800377 <vcprintf>:
+  800377:	55                   	push   %ebp
+  800378:	89 e5                	mov    %esp,%ebp
+  80037a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800380:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800387:	00 00 00 
+  80038a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800391:	00 00 00 
+  800394:	ff 75 0c             	push   0xc(%ebp)
+  800397:	ff 75 08             	push   0x8(%ebp)
+  80039a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003a0:	50                   	push   %eax
+  8003a1:	68 33 03 80 00       	push   $0x800333
+  8003a6:	e8 1c 01 00 00       	call   8004c7 <vprintfmt>
+  8003ab:	83 c4 08             	add    $0x8,%esp
+  8003ae:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003b4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003ba:	50                   	push   %eax
+  8003bb:	e8 77 0a 00 00       	call   800e37 <sys_cputs>
+  8003c0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+008003c8 <cprintf>:
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	83 ec 10             	sub    $0x10,%esp
+  8003ce:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8003d1:	50                   	push   %eax
+  8003d2:	ff 75 08             	push   0x8(%ebp)
+  8003d5:	e8 9d ff ff ff       	call   800377 <vcprintf>
+  8003da:	c9                   	leave
+  8003db:	c3                   	ret
+
+008003dc <printnum>:
+  8003dc:	55                   	push   %ebp
+  8003dd:	89 e5                	mov    %esp,%ebp
+  8003df:	57                   	push   %edi
+  8003e0:	56                   	push   %esi
+  8003e1:	53                   	push   %ebx
+  8003e2:	83 ec 1c             	sub    $0x1c,%esp
+  8003e5:	89 c3                	mov    %eax,%ebx
+  8003e7:	89 d6                	mov    %edx,%esi
+  8003e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003ef:	89 d1                	mov    %edx,%ecx
+  8003f1:	89 c2                	mov    %eax,%edx
+  8003f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003f6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003f9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ff:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800406:	39 c2                	cmp    %eax,%edx
+  800408:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80040b:	73 4b                	jae    800458 <printnum+0x7c>
+  80040d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800410:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800413:	85 ff                	test   %edi,%edi
+  800415:	7e 11                	jle    800428 <printnum+0x4c>
+  800417:	83 ec 08             	sub    $0x8,%esp
+  80041a:	56                   	push   %esi
+  80041b:	ff 75 18             	push   0x18(%ebp)
+  80041e:	ff d3                	call   *%ebx
+  800420:	83 c4 10             	add    $0x10,%esp
+  800423:	83 ef 01             	sub    $0x1,%edi
+  800426:	75 ef                	jne    800417 <printnum+0x3b>
+  800428:	83 ec 08             	sub    $0x8,%esp
+  80042b:	56                   	push   %esi
+  80042c:	83 ec 04             	sub    $0x4,%esp
+  80042f:	ff 75 e4             	push   -0x1c(%ebp)
+  800432:	ff 75 e0             	push   -0x20(%ebp)
+  800435:	ff 75 dc             	push   -0x24(%ebp)
+  800438:	ff 75 d8             	push   -0x28(%ebp)
+  80043b:	e8 86 34 00 00       	call   8038c6 <__umoddi3>
+  800440:	83 c4 14             	add    $0x14,%esp
+  800443:	0f be 80 df 3a 80 00 	movsbl 0x803adf(%eax),%eax
+  80044a:	50                   	push   %eax
+  80044b:	ff d3                	call   *%ebx
+  80044d:	83 c4 10             	add    $0x10,%esp
+  800450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800453:	5b                   	pop    %ebx
+  800454:	5e                   	pop    %esi
+  800455:	5f                   	pop    %edi
+  800456:	5d                   	pop    %ebp
+  800457:	c3                   	ret
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	ff 75 18             	push   0x18(%ebp)
+  80045e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800461:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800464:	52                   	push   %edx
+  800465:	50                   	push   %eax
+  800466:	83 ec 08             	sub    $0x8,%esp
+  800469:	ff 75 e4             	push   -0x1c(%ebp)
+  80046c:	ff 75 e0             	push   -0x20(%ebp)
+  80046f:	ff 75 dc             	push   -0x24(%ebp)
+  800472:	ff 75 d8             	push   -0x28(%ebp)
+  800475:	e8 2e 34 00 00       	call   8038a8 <__udivdi3>
+  80047a:	83 c4 18             	add    $0x18,%esp
+  80047d:	52                   	push   %edx
+  80047e:	50                   	push   %eax
+  80047f:	89 f2                	mov    %esi,%edx
+  800481:	89 d8                	mov    %ebx,%eax
+  800483:	e8 54 ff ff ff       	call   8003dc <printnum>
+  800488:	83 c4 20             	add    $0x20,%esp
+  80048b:	eb 9b                	jmp    800428 <printnum+0x4c>
+
+0080048d <sprintputch>:
+  80048d:	55                   	push   %ebp
+  80048e:	89 e5                	mov    %esp,%ebp
+  800490:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800493:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800497:	8b 10                	mov    (%eax),%edx
+  800499:	3b 50 04             	cmp    0x4(%eax),%edx
+  80049c:	73 0a                	jae    8004a8 <sprintputch+0x1b>
+  80049e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004a1:	89 08                	mov    %ecx,(%eax)
+  8004a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004a6:	88 02                	mov    %al,(%edx)
+  8004a8:	5d                   	pop    %ebp
+  8004a9:	c3                   	ret
+
+008004aa <printfmt>:
+  8004aa:	55                   	push   %ebp
+  8004ab:	89 e5                	mov    %esp,%ebp
+  8004ad:	83 ec 08             	sub    $0x8,%esp
+  8004b0:	8d 45 14             	lea    0x14(%ebp),%eax
+  8004b3:	50                   	push   %eax
+  8004b4:	ff 75 10             	push   0x10(%ebp)
+  8004b7:	ff 75 0c             	push   0xc(%ebp)
+  8004ba:	ff 75 08             	push   0x8(%ebp)
+  8004bd:	e8 05 00 00 00       	call   8004c7 <vprintfmt>
+  8004c2:	83 c4 10             	add    $0x10,%esp
+  8004c5:	c9                   	leave
+  8004c6:	c3                   	ret
+
+008004c7 <vprintfmt>:
+  8004c7:	55                   	push   %ebp
+  8004c8:	89 e5                	mov    %esp,%ebp
+  8004ca:	57                   	push   %edi
+  8004cb:	56                   	push   %esi
+  8004cc:	53                   	push   %ebx
+  8004cd:	83 ec 2c             	sub    $0x2c,%esp
+  8004d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004d3:	89 df                	mov    %ebx,%edi
+  8004d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004d8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004db:	8d 70 01             	lea    0x1(%eax),%esi
+  8004de:	0f b6 00             	movzbl (%eax),%eax
+  8004e1:	83 f8 25             	cmp    $0x25,%eax
+  8004e4:	74 1e                	je     800504 <vprintfmt+0x3d>
+  8004e6:	85 c0                	test   %eax,%eax
+  8004e8:	0f 84 15 05 00 00    	je     800a03 <vprintfmt+0x53c>
+  8004ee:	83 ec 08             	sub    $0x8,%esp
+  8004f1:	53                   	push   %ebx
+  8004f2:	50                   	push   %eax
+  8004f3:	ff d7                	call   *%edi
+  8004f5:	83 c6 01             	add    $0x1,%esi
+  8004f8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004fc:	83 c4 10             	add    $0x10,%esp
+  8004ff:	83 f8 25             	cmp    $0x25,%eax
+  800502:	75 e2                	jne    8004e6 <vprintfmt+0x1f>
+  800504:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800508:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80050f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800516:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80051d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800522:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800525:	8d 56 01             	lea    0x1(%esi),%edx
+  800528:	0f b6 0e             	movzbl (%esi),%ecx
+  80052b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80052e:	3c 55                	cmp    $0x55,%al
+  800530:	0f 87 3b 04 00 00    	ja     800971 <vprintfmt+0x4aa>
+  800536:	0f b6 c0             	movzbl %al,%eax
+  800539:	ff 24 85 20 3c 80 00 	jmp    *0x803c20(,%eax,4)
+  800540:	89 75 10             	mov    %esi,0x10(%ebp)
+  800543:	eb 93                	jmp    8004d8 <vprintfmt+0x11>
+  800545:	89 d6                	mov    %edx,%esi
+  800547:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80054b:	eb d8                	jmp    800525 <vprintfmt+0x5e>
+  80054d:	89 d6                	mov    %edx,%esi
+  80054f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800553:	eb d0                	jmp    800525 <vprintfmt+0x5e>
+  800555:	0f b6 c9             	movzbl %cl,%ecx
+  800558:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80055b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80055e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800562:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800565:	83 f9 09             	cmp    $0x9,%ecx
+  800568:	77 6f                	ja     8005d9 <vprintfmt+0x112>
+  80056a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80056d:	83 c2 01             	add    $0x1,%edx
+  800570:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800573:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800577:	0f be 02             	movsbl (%edx),%eax
+  80057a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80057d:	83 fe 09             	cmp    $0x9,%esi
+  800580:	76 eb                	jbe    80056d <vprintfmt+0xa6>
+  800582:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800585:	89 d6                	mov    %edx,%esi
+  800587:	eb 13                	jmp    80059c <vprintfmt+0xd5>
+  800589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058c:	8b 00                	mov    (%eax),%eax
+  80058e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8d 40 04             	lea    0x4(%eax),%eax
+  800597:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059a:	89 d6                	mov    %edx,%esi
+  80059c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005a0:	79 83                	jns    800525 <vprintfmt+0x5e>
+  8005a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005a8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8005af:	e9 71 ff ff ff       	jmp    800525 <vprintfmt+0x5e>
+  8005b4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005b7:	85 c9                	test   %ecx,%ecx
+  8005b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005be:	0f 49 c1             	cmovns %ecx,%eax
+  8005c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005c4:	89 d6                	mov    %edx,%esi
+  8005c6:	e9 5a ff ff ff       	jmp    800525 <vprintfmt+0x5e>
+  8005cb:	89 d6                	mov    %edx,%esi
+  8005cd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8005d4:	e9 4c ff ff ff       	jmp    800525 <vprintfmt+0x5e>
+  8005d9:	89 d6                	mov    %edx,%esi
+  8005db:	eb bf                	jmp    80059c <vprintfmt+0xd5>
+  8005dd:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8005e1:	89 d6                	mov    %edx,%esi
+  8005e3:	e9 3d ff ff ff       	jmp    800525 <vprintfmt+0x5e>
+  8005e8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8d 70 04             	lea    0x4(%eax),%esi
+  8005f1:	83 ec 08             	sub    $0x8,%esp
+  8005f4:	53                   	push   %ebx
+  8005f5:	ff 30                	push   (%eax)
+  8005f7:	ff d7                	call   *%edi
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005ff:	e9 d4 fe ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  800604:	89 55 10             	mov    %edx,0x10(%ebp)
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8d 70 04             	lea    0x4(%eax),%esi
+  80060d:	8b 10                	mov    (%eax),%edx
+  80060f:	89 d0                	mov    %edx,%eax
+  800611:	f7 d8                	neg    %eax
+  800613:	0f 48 c2             	cmovs  %edx,%eax
+  800616:	83 f8 12             	cmp    $0x12,%eax
+  800619:	7f 23                	jg     80063e <vprintfmt+0x177>
+  80061b:	8b 14 85 80 3d 80 00 	mov    0x803d80(,%eax,4),%edx
+  800622:	85 d2                	test   %edx,%edx
+  800624:	74 18                	je     80063e <vprintfmt+0x177>
+  800626:	52                   	push   %edx
+  800627:	68 c3 3f 80 00       	push   $0x803fc3
+  80062c:	53                   	push   %ebx
+  80062d:	57                   	push   %edi
+  80062e:	e8 77 fe ff ff       	call   8004aa <printfmt>
+  800633:	83 c4 10             	add    $0x10,%esp
+  800636:	89 75 14             	mov    %esi,0x14(%ebp)
+  800639:	e9 9a fe ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  80063e:	50                   	push   %eax
+  80063f:	68 f7 3a 80 00       	push   $0x803af7
+  800644:	53                   	push   %ebx
+  800645:	57                   	push   %edi
+  800646:	e8 5f fe ff ff       	call   8004aa <printfmt>
+  80064b:	83 c4 10             	add    $0x10,%esp
+  80064e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800651:	e9 82 fe ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  800656:	89 55 10             	mov    %edx,0x10(%ebp)
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	83 c0 04             	add    $0x4,%eax
+  80065f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 00                	mov    (%eax),%eax
+  800667:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80066a:	85 c0                	test   %eax,%eax
+  80066c:	0f 84 61 03 00 00    	je     8009d3 <vprintfmt+0x50c>
+  800672:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800676:	7e 06                	jle    80067e <vprintfmt+0x1b7>
+  800678:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80067c:	75 29                	jne    8006a7 <vprintfmt+0x1e0>
+  80067e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800681:	8d 70 01             	lea    0x1(%eax),%esi
+  800684:	0f b6 00             	movzbl (%eax),%eax
+  800687:	0f be d0             	movsbl %al,%edx
+  80068a:	85 d2                	test   %edx,%edx
+  80068c:	0f 84 bb 00 00 00    	je     80074d <vprintfmt+0x286>
+  800692:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800695:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800698:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80069b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80069e:	eb 7a                	jmp    80071a <vprintfmt+0x253>
+  8006a0:	c7 45 d0 f0 3a 80 00 	movl   $0x803af0,-0x30(%ebp)
+  8006a7:	83 ec 08             	sub    $0x8,%esp
+  8006aa:	ff 75 d4             	push   -0x2c(%ebp)
+  8006ad:	ff 75 d0             	push   -0x30(%ebp)
+  8006b0:	e8 e0 03 00 00       	call   800a95 <strnlen>
+  8006b5:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8006b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8006bb:	83 c4 10             	add    $0x10,%esp
+  8006be:	85 d2                	test   %edx,%edx
+  8006c0:	0f 8e d6 02 00 00    	jle    80099c <vprintfmt+0x4d5>
+  8006c6:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8006ca:	83 ec 08             	sub    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	56                   	push   %esi
+  8006cf:	ff d7                	call   *%edi
+  8006d1:	83 c4 10             	add    $0x10,%esp
+  8006d4:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8006d8:	75 f0                	jne    8006ca <vprintfmt+0x203>
+  8006da:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006dd:	8d 70 01             	lea    0x1(%eax),%esi
+  8006e0:	0f b6 00             	movzbl (%eax),%eax
+  8006e3:	0f be d0             	movsbl %al,%edx
+  8006e6:	85 d2                	test   %edx,%edx
+  8006e8:	0f 84 da 02 00 00    	je     8009c8 <vprintfmt+0x501>
+  8006ee:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006f1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006f4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006f7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006fa:	eb 1e                	jmp    80071a <vprintfmt+0x253>
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	ff 75 0c             	push   0xc(%ebp)
+  800702:	52                   	push   %edx
+  800703:	ff 55 08             	call   *0x8(%ebp)
+  800706:	83 c4 10             	add    $0x10,%esp
+  800709:	83 eb 01             	sub    $0x1,%ebx
+  80070c:	83 c6 01             	add    $0x1,%esi
+  80070f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800713:	0f be d0             	movsbl %al,%edx
+  800716:	85 d2                	test   %edx,%edx
+  800718:	74 2a                	je     800744 <vprintfmt+0x27d>
+  80071a:	85 ff                	test   %edi,%edi
+  80071c:	78 05                	js     800723 <vprintfmt+0x25c>
+  80071e:	83 ef 01             	sub    $0x1,%edi
+  800721:	78 59                	js     80077c <vprintfmt+0x2b5>
+  800723:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800727:	74 d3                	je     8006fc <vprintfmt+0x235>
+  800729:	0f be c0             	movsbl %al,%eax
+  80072c:	83 e8 20             	sub    $0x20,%eax
+  80072f:	83 f8 5e             	cmp    $0x5e,%eax
+  800732:	76 c8                	jbe    8006fc <vprintfmt+0x235>
+  800734:	83 ec 08             	sub    $0x8,%esp
+  800737:	ff 75 0c             	push   0xc(%ebp)
+  80073a:	6a 3f                	push   $0x3f
+  80073c:	ff 55 08             	call   *0x8(%ebp)
+  80073f:	83 c4 10             	add    $0x10,%esp
+  800742:	eb c5                	jmp    800709 <vprintfmt+0x242>
+  800744:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800747:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80074a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80074d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800750:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800754:	7e 1b                	jle    800771 <vprintfmt+0x2aa>
+  800756:	83 ec 08             	sub    $0x8,%esp
+  800759:	53                   	push   %ebx
+  80075a:	6a 20                	push   $0x20
+  80075c:	ff d7                	call   *%edi
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	83 ee 01             	sub    $0x1,%esi
+  800764:	75 f0                	jne    800756 <vprintfmt+0x28f>
+  800766:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800769:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076c:	e9 67 fd ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  800771:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800774:	89 45 14             	mov    %eax,0x14(%ebp)
+  800777:	e9 5c fd ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  80077c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80077f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800782:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800785:	eb c6                	jmp    80074d <vprintfmt+0x286>
+  800787:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80078a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80078d:	83 f9 01             	cmp    $0x1,%ecx
+  800790:	7f 1f                	jg     8007b1 <vprintfmt+0x2ea>
+  800792:	85 c9                	test   %ecx,%ecx
+  800794:	74 67                	je     8007fd <vprintfmt+0x336>
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 30                	mov    (%eax),%esi
+  80079b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80079e:	89 f0                	mov    %esi,%eax
+  8007a0:	c1 f8 1f             	sar    $0x1f,%eax
+  8007a3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007af:	eb 17                	jmp    8007c8 <vprintfmt+0x301>
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8b 50 04             	mov    0x4(%eax),%edx
+  8007b7:	8b 00                	mov    (%eax),%eax
+  8007b9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007bc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007cb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ce:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007d3:	85 c9                	test   %ecx,%ecx
+  8007d5:	0f 89 12 01 00 00    	jns    8008ed <vprintfmt+0x426>
+  8007db:	83 ec 08             	sub    $0x8,%esp
+  8007de:	53                   	push   %ebx
+  8007df:	6a 2d                	push   $0x2d
+  8007e1:	ff d7                	call   *%edi
+  8007e3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007e6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007e9:	f7 da                	neg    %edx
+  8007eb:	83 d1 00             	adc    $0x0,%ecx
+  8007ee:	f7 d9                	neg    %ecx
+  8007f0:	83 c4 10             	add    $0x10,%esp
+  8007f3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007f8:	e9 f0 00 00 00       	jmp    8008ed <vprintfmt+0x426>
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	8b 30                	mov    (%eax),%esi
+  800802:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800805:	89 f0                	mov    %esi,%eax
+  800807:	c1 f8 1f             	sar    $0x1f,%eax
+  80080a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80080d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800810:	8d 40 04             	lea    0x4(%eax),%eax
+  800813:	89 45 14             	mov    %eax,0x14(%ebp)
+  800816:	eb b0                	jmp    8007c8 <vprintfmt+0x301>
+  800818:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80081b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80081e:	83 f9 01             	cmp    $0x1,%ecx
+  800821:	7f 1e                	jg     800841 <vprintfmt+0x37a>
+  800823:	85 c9                	test   %ecx,%ecx
+  800825:	74 32                	je     800859 <vprintfmt+0x392>
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8b 10                	mov    (%eax),%edx
+  80082c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800831:	8d 40 04             	lea    0x4(%eax),%eax
+  800834:	89 45 14             	mov    %eax,0x14(%ebp)
+  800837:	be 0a 00 00 00       	mov    $0xa,%esi
+  80083c:	e9 ac 00 00 00       	jmp    8008ed <vprintfmt+0x426>
+  800841:	8b 45 14             	mov    0x14(%ebp),%eax
+  800844:	8b 10                	mov    (%eax),%edx
+  800846:	8b 48 04             	mov    0x4(%eax),%ecx
+  800849:	8d 40 08             	lea    0x8(%eax),%eax
+  80084c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800854:	e9 94 00 00 00       	jmp    8008ed <vprintfmt+0x426>
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8b 10                	mov    (%eax),%edx
+  80085e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800863:	8d 40 04             	lea    0x4(%eax),%eax
+  800866:	89 45 14             	mov    %eax,0x14(%ebp)
+  800869:	be 0a 00 00 00       	mov    $0xa,%esi
+  80086e:	eb 7d                	jmp    8008ed <vprintfmt+0x426>
+  800870:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800873:	89 55 10             	mov    %edx,0x10(%ebp)
+  800876:	83 f9 01             	cmp    $0x1,%ecx
+  800879:	7f 1b                	jg     800896 <vprintfmt+0x3cf>
+  80087b:	85 c9                	test   %ecx,%ecx
+  80087d:	74 2c                	je     8008ab <vprintfmt+0x3e4>
+  80087f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800882:	8b 10                	mov    (%eax),%edx
+  800884:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800889:	8d 40 04             	lea    0x4(%eax),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088f:	be 08 00 00 00       	mov    $0x8,%esi
+  800894:	eb 57                	jmp    8008ed <vprintfmt+0x426>
+  800896:	8b 45 14             	mov    0x14(%ebp),%eax
+  800899:	8b 10                	mov    (%eax),%edx
+  80089b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80089e:	8d 40 08             	lea    0x8(%eax),%eax
+  8008a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008a4:	be 08 00 00 00       	mov    $0x8,%esi
+  8008a9:	eb 42                	jmp    8008ed <vprintfmt+0x426>
+  8008ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ae:	8b 10                	mov    (%eax),%edx
+  8008b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008bb:	be 08 00 00 00       	mov    $0x8,%esi
+  8008c0:	eb 2b                	jmp    8008ed <vprintfmt+0x426>
+  8008c2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c5:	83 ec 08             	sub    $0x8,%esp
+  8008c8:	53                   	push   %ebx
+  8008c9:	6a 30                	push   $0x30
+  8008cb:	ff d7                	call   *%edi
+  8008cd:	83 c4 08             	add    $0x8,%esp
+  8008d0:	53                   	push   %ebx
+  8008d1:	6a 78                	push   $0x78
+  8008d3:	ff d7                	call   *%edi
+  8008d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d8:	8b 10                	mov    (%eax),%edx
+  8008da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008df:	83 c4 10             	add    $0x10,%esp
+  8008e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e8:	be 10 00 00 00       	mov    $0x10,%esi
+  8008ed:	83 ec 0c             	sub    $0xc,%esp
+  8008f0:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008f4:	50                   	push   %eax
+  8008f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8008f8:	56                   	push   %esi
+  8008f9:	51                   	push   %ecx
+  8008fa:	52                   	push   %edx
+  8008fb:	89 da                	mov    %ebx,%edx
+  8008fd:	89 f8                	mov    %edi,%eax
+  8008ff:	e8 d8 fa ff ff       	call   8003dc <printnum>
+  800904:	83 c4 20             	add    $0x20,%esp
+  800907:	e9 cc fb ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  80090c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80090f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800912:	83 f9 01             	cmp    $0x1,%ecx
+  800915:	7f 1b                	jg     800932 <vprintfmt+0x46b>
+  800917:	85 c9                	test   %ecx,%ecx
+  800919:	74 2c                	je     800947 <vprintfmt+0x480>
+  80091b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091e:	8b 10                	mov    (%eax),%edx
+  800920:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800925:	8d 40 04             	lea    0x4(%eax),%eax
+  800928:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092b:	be 10 00 00 00       	mov    $0x10,%esi
+  800930:	eb bb                	jmp    8008ed <vprintfmt+0x426>
+  800932:	8b 45 14             	mov    0x14(%ebp),%eax
+  800935:	8b 10                	mov    (%eax),%edx
+  800937:	8b 48 04             	mov    0x4(%eax),%ecx
+  80093a:	8d 40 08             	lea    0x8(%eax),%eax
+  80093d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800940:	be 10 00 00 00       	mov    $0x10,%esi
+  800945:	eb a6                	jmp    8008ed <vprintfmt+0x426>
+  800947:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094a:	8b 10                	mov    (%eax),%edx
+  80094c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800951:	8d 40 04             	lea    0x4(%eax),%eax
+  800954:	89 45 14             	mov    %eax,0x14(%ebp)
+  800957:	be 10 00 00 00       	mov    $0x10,%esi
+  80095c:	eb 8f                	jmp    8008ed <vprintfmt+0x426>
+  80095e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800961:	83 ec 08             	sub    $0x8,%esp
+  800964:	53                   	push   %ebx
+  800965:	6a 25                	push   $0x25
+  800967:	ff d7                	call   *%edi
+  800969:	83 c4 10             	add    $0x10,%esp
+  80096c:	e9 67 fb ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  800971:	83 ec 08             	sub    $0x8,%esp
+  800974:	53                   	push   %ebx
+  800975:	6a 25                	push   $0x25
+  800977:	ff d7                	call   *%edi
+  800979:	83 c4 10             	add    $0x10,%esp
+  80097c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800980:	0f 84 ba fb ff ff    	je     800540 <vprintfmt+0x79>
+  800986:	89 75 10             	mov    %esi,0x10(%ebp)
+  800989:	89 f0                	mov    %esi,%eax
+  80098b:	83 e8 01             	sub    $0x1,%eax
+  80098e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800992:	75 f7                	jne    80098b <vprintfmt+0x4c4>
+  800994:	89 45 10             	mov    %eax,0x10(%ebp)
+  800997:	e9 3c fb ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  80099c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80099f:	8d 70 01             	lea    0x1(%eax),%esi
+  8009a2:	0f b6 00             	movzbl (%eax),%eax
+  8009a5:	0f be d0             	movsbl %al,%edx
+  8009a8:	85 d2                	test   %edx,%edx
+  8009aa:	74 11                	je     8009bd <vprintfmt+0x4f6>
+  8009ac:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009af:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009b2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009b5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009b8:	e9 5d fd ff ff       	jmp    80071a <vprintfmt+0x253>
+  8009bd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009c3:	e9 10 fb ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  8009c8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ce:	e9 05 fb ff ff       	jmp    8004d8 <vprintfmt+0x11>
+  8009d3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009d7:	7e 0a                	jle    8009e3 <vprintfmt+0x51c>
+  8009d9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009dd:	0f 85 bd fc ff ff    	jne    8006a0 <vprintfmt+0x1d9>
+  8009e3:	ba 28 00 00 00       	mov    $0x28,%edx
+  8009e8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009ed:	be f1 3a 80 00       	mov    $0x803af1,%esi
+  8009f2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009f5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009f8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009fb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009fe:	e9 17 fd ff ff       	jmp    80071a <vprintfmt+0x253>
+  800a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a06:	5b                   	pop    %ebx
+  800a07:	5e                   	pop    %esi
+  800a08:	5f                   	pop    %edi
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+
+00800a0b <vsnprintf>:
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	83 ec 18             	sub    $0x18,%esp
+  800a11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a14:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a17:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a1a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a1e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a21:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a28:	85 c0                	test   %eax,%eax
+  800a2a:	74 26                	je     800a52 <vsnprintf+0x47>
+  800a2c:	85 d2                	test   %edx,%edx
+  800a2e:	7e 22                	jle    800a52 <vsnprintf+0x47>
+  800a30:	ff 75 14             	push   0x14(%ebp)
+  800a33:	ff 75 10             	push   0x10(%ebp)
+  800a36:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a39:	50                   	push   %eax
+  800a3a:	68 8d 04 80 00       	push   $0x80048d
+  800a3f:	e8 83 fa ff ff       	call   8004c7 <vprintfmt>
+  800a44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a47:	c6 00 00             	movb   $0x0,(%eax)
+  800a4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a4d:	83 c4 10             	add    $0x10,%esp
+  800a50:	c9                   	leave
+  800a51:	c3                   	ret
+  800a52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a57:	eb f7                	jmp    800a50 <vsnprintf+0x45>
+
+00800a59 <snprintf>:
+  800a59:	55                   	push   %ebp
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	83 ec 08             	sub    $0x8,%esp
+  800a5f:	8d 45 14             	lea    0x14(%ebp),%eax
+  800a62:	50                   	push   %eax
+  800a63:	ff 75 10             	push   0x10(%ebp)
+  800a66:	ff 75 0c             	push   0xc(%ebp)
+  800a69:	ff 75 08             	push   0x8(%ebp)
+  800a6c:	e8 9a ff ff ff       	call   800a0b <vsnprintf>
+  800a71:	c9                   	leave
+  800a72:	c3                   	ret
+
+00800a73 <strlen>:
+  800a73:	55                   	push   %ebp
+  800a74:	89 e5                	mov    %esp,%ebp
+  800a76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a79:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a7c:	74 10                	je     800a8e <strlen+0x1b>
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	83 c0 01             	add    $0x1,%eax
+  800a86:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a8a:	75 f7                	jne    800a83 <strlen+0x10>
+  800a8c:	5d                   	pop    %ebp
+  800a8d:	c3                   	ret
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	eb f7                	jmp    800a8c <strlen+0x19>
+
+00800a95 <strnlen>:
+  800a95:	55                   	push   %ebp
+  800a96:	89 e5                	mov    %esp,%ebp
+  800a98:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a9b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a9e:	85 d2                	test   %edx,%edx
+  800aa0:	74 16                	je     800ab8 <strnlen+0x23>
+  800aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800aab:	74 09                	je     800ab6 <strnlen+0x21>
+  800aad:	83 c0 01             	add    $0x1,%eax
+  800ab0:	39 d0                	cmp    %edx,%eax
+  800ab2:	75 f3                	jne    800aa7 <strnlen+0x12>
+  800ab4:	89 d0                	mov    %edx,%eax
+  800ab6:	5d                   	pop    %ebp
+  800ab7:	c3                   	ret
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abd:	eb f7                	jmp    800ab6 <strnlen+0x21>
+
+00800abf <strcpy>:
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	53                   	push   %ebx
+  800ac3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ace:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ad2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ad5:	83 c0 01             	add    $0x1,%eax
+  800ad8:	84 d2                	test   %dl,%dl
+  800ada:	75 f2                	jne    800ace <strcpy+0xf>
+  800adc:	89 c8                	mov    %ecx,%eax
+  800ade:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae1:	c9                   	leave
+  800ae2:	c3                   	ret
+
+00800ae3 <strcat>:
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	53                   	push   %ebx
+  800ae7:	83 ec 10             	sub    $0x10,%esp
+  800aea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800aed:	53                   	push   %ebx
+  800aee:	e8 80 ff ff ff       	call   800a73 <strlen>
+  800af3:	83 c4 08             	add    $0x8,%esp
+  800af6:	ff 75 0c             	push   0xc(%ebp)
+  800af9:	01 d8                	add    %ebx,%eax
+  800afb:	50                   	push   %eax
+  800afc:	e8 be ff ff ff       	call   800abf <strcpy>
+  800b01:	89 d8                	mov    %ebx,%eax
+  800b03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b06:	c9                   	leave
+  800b07:	c3                   	ret
+
+00800b08 <strncpy>:
+  800b08:	55                   	push   %ebp
+  800b09:	89 e5                	mov    %esp,%ebp
+  800b0b:	56                   	push   %esi
+  800b0c:	53                   	push   %ebx
+  800b0d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b10:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b16:	85 db                	test   %ebx,%ebx
+  800b18:	74 17                	je     800b31 <strncpy+0x29>
+  800b1a:	01 f3                	add    %esi,%ebx
+  800b1c:	89 f0                	mov    %esi,%eax
+  800b1e:	83 c0 01             	add    $0x1,%eax
+  800b21:	0f b6 0a             	movzbl (%edx),%ecx
+  800b24:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b27:	80 f9 01             	cmp    $0x1,%cl
+  800b2a:	83 da ff             	sbb    $0xffffffff,%edx
+  800b2d:	39 c3                	cmp    %eax,%ebx
+  800b2f:	75 ed                	jne    800b1e <strncpy+0x16>
+  800b31:	89 f0                	mov    %esi,%eax
+  800b33:	5b                   	pop    %ebx
+  800b34:	5e                   	pop    %esi
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <strlcpy>:
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	56                   	push   %esi
+  800b3b:	53                   	push   %ebx
+  800b3c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b45:	89 f0                	mov    %esi,%eax
+  800b47:	85 db                	test   %ebx,%ebx
+  800b49:	74 1e                	je     800b69 <strlcpy+0x32>
+  800b4b:	83 eb 01             	sub    $0x1,%ebx
+  800b4e:	74 16                	je     800b66 <strlcpy+0x2f>
+  800b50:	01 f3                	add    %esi,%ebx
+  800b52:	0f b6 0a             	movzbl (%edx),%ecx
+  800b55:	84 c9                	test   %cl,%cl
+  800b57:	74 0d                	je     800b66 <strlcpy+0x2f>
+  800b59:	83 c2 01             	add    $0x1,%edx
+  800b5c:	83 c0 01             	add    $0x1,%eax
+  800b5f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b62:	39 d8                	cmp    %ebx,%eax
+  800b64:	75 ec                	jne    800b52 <strlcpy+0x1b>
+  800b66:	c6 00 00             	movb   $0x0,(%eax)
+  800b69:	29 f0                	sub    %esi,%eax
+  800b6b:	5b                   	pop    %ebx
+  800b6c:	5e                   	pop    %esi
+  800b6d:	5d                   	pop    %ebp
+  800b6e:	c3                   	ret
+
+00800b6f <strcmp>:
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b75:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b78:	0f b6 01             	movzbl (%ecx),%eax
+  800b7b:	84 c0                	test   %al,%al
+  800b7d:	74 11                	je     800b90 <strcmp+0x21>
+  800b7f:	38 02                	cmp    %al,(%edx)
+  800b81:	75 0d                	jne    800b90 <strcmp+0x21>
+  800b83:	83 c1 01             	add    $0x1,%ecx
+  800b86:	83 c2 01             	add    $0x1,%edx
+  800b89:	0f b6 01             	movzbl (%ecx),%eax
+  800b8c:	84 c0                	test   %al,%al
+  800b8e:	75 ef                	jne    800b7f <strcmp+0x10>
+  800b90:	0f b6 c0             	movzbl %al,%eax
+  800b93:	0f b6 12             	movzbl (%edx),%edx
+  800b96:	29 d0                	sub    %edx,%eax
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <strncmp>:
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	53                   	push   %ebx
+  800b9e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ba1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ba4:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bac:	85 d2                	test   %edx,%edx
+  800bae:	74 2e                	je     800bde <strncmp+0x44>
+  800bb0:	0f b6 01             	movzbl (%ecx),%eax
+  800bb3:	84 c0                	test   %al,%al
+  800bb5:	74 16                	je     800bcd <strncmp+0x33>
+  800bb7:	3a 03                	cmp    (%ebx),%al
+  800bb9:	75 12                	jne    800bcd <strncmp+0x33>
+  800bbb:	83 c1 01             	add    $0x1,%ecx
+  800bbe:	83 c3 01             	add    $0x1,%ebx
+  800bc1:	83 ea 01             	sub    $0x1,%edx
+  800bc4:	75 ea                	jne    800bb0 <strncmp+0x16>
+  800bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcb:	eb 11                	jmp    800bde <strncmp+0x44>
+  800bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd2:	85 d2                	test   %edx,%edx
+  800bd4:	74 08                	je     800bde <strncmp+0x44>
+  800bd6:	0f b6 01             	movzbl (%ecx),%eax
+  800bd9:	0f b6 13             	movzbl (%ebx),%edx
+  800bdc:	29 d0                	sub    %edx,%eax
+  800bde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800be1:	c9                   	leave
+  800be2:	c3                   	ret
+
+00800be3 <strchr>:
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800bed:	0f b6 10             	movzbl (%eax),%edx
+  800bf0:	84 d2                	test   %dl,%dl
+  800bf2:	74 15                	je     800c09 <strchr+0x26>
+  800bf4:	38 d1                	cmp    %dl,%cl
+  800bf6:	74 0f                	je     800c07 <strchr+0x24>
+  800bf8:	83 c0 01             	add    $0x1,%eax
+  800bfb:	0f b6 10             	movzbl (%eax),%edx
+  800bfe:	84 d2                	test   %dl,%dl
+  800c00:	75 f2                	jne    800bf4 <strchr+0x11>
+  800c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+  800c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0e:	eb f7                	jmp    800c07 <strchr+0x24>
+
+00800c10 <strfind>:
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	53                   	push   %ebx
+  800c14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c17:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c1a:	0f b6 18             	movzbl (%eax),%ebx
+  800c1d:	38 d3                	cmp    %dl,%bl
+  800c1f:	74 14                	je     800c35 <strfind+0x25>
+  800c21:	89 d1                	mov    %edx,%ecx
+  800c23:	84 db                	test   %bl,%bl
+  800c25:	74 0e                	je     800c35 <strfind+0x25>
+  800c27:	83 c0 01             	add    $0x1,%eax
+  800c2a:	0f b6 10             	movzbl (%eax),%edx
+  800c2d:	38 ca                	cmp    %cl,%dl
+  800c2f:	74 04                	je     800c35 <strfind+0x25>
+  800c31:	84 d2                	test   %dl,%dl
+  800c33:	75 f2                	jne    800c27 <strfind+0x17>
+  800c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c38:	c9                   	leave
+  800c39:	c3                   	ret
+
+00800c3a <memset>:
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	57                   	push   %edi
+  800c3e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c41:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c44:	85 c9                	test   %ecx,%ecx
+  800c46:	74 20                	je     800c68 <memset+0x2e>
+  800c48:	89 f8                	mov    %edi,%eax
+  800c4a:	09 c8                	or     %ecx,%eax
+  800c4c:	a8 03                	test   $0x3,%al
+  800c4e:	75 12                	jne    800c62 <memset+0x28>
+  800c50:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c54:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800c5a:	c1 e9 02             	shr    $0x2,%ecx
+  800c5d:	fc                   	cld
+  800c5e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c60:	eb 06                	jmp    800c68 <memset+0x2e>
+  800c62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c65:	fc                   	cld
+  800c66:	f3 aa                	rep stos %al,%es:(%edi)
+  800c68:	89 f8                	mov    %edi,%eax
+  800c6a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c6d:	c9                   	leave
+  800c6e:	c3                   	ret
+
+00800c6f <memmove>:
+  800c6f:	55                   	push   %ebp
+  800c70:	89 e5                	mov    %esp,%ebp
+  800c72:	57                   	push   %edi
+  800c73:	56                   	push   %esi
+  800c74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c77:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c7a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c7d:	39 c6                	cmp    %eax,%esi
+  800c7f:	73 32                	jae    800cb3 <memmove+0x44>
+  800c81:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c84:	39 d0                	cmp    %edx,%eax
+  800c86:	73 2b                	jae    800cb3 <memmove+0x44>
+  800c88:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800c8b:	89 d6                	mov    %edx,%esi
+  800c8d:	09 fe                	or     %edi,%esi
+  800c8f:	09 ce                	or     %ecx,%esi
+  800c91:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c97:	75 0e                	jne    800ca7 <memmove+0x38>
+  800c99:	83 ef 04             	sub    $0x4,%edi
+  800c9c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c9f:	c1 e9 02             	shr    $0x2,%ecx
+  800ca2:	fd                   	std
+  800ca3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ca5:	eb 09                	jmp    800cb0 <memmove+0x41>
+  800ca7:	83 ef 01             	sub    $0x1,%edi
+  800caa:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800cad:	fd                   	std
+  800cae:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800cb0:	fc                   	cld
+  800cb1:	eb 1a                	jmp    800ccd <memmove+0x5e>
+  800cb3:	89 f2                	mov    %esi,%edx
+  800cb5:	09 c2                	or     %eax,%edx
+  800cb7:	09 ca                	or     %ecx,%edx
+  800cb9:	f6 c2 03             	test   $0x3,%dl
+  800cbc:	75 0a                	jne    800cc8 <memmove+0x59>
+  800cbe:	c1 e9 02             	shr    $0x2,%ecx
+  800cc1:	89 c7                	mov    %eax,%edi
+  800cc3:	fc                   	cld
+  800cc4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cc6:	eb 05                	jmp    800ccd <memmove+0x5e>
+  800cc8:	89 c7                	mov    %eax,%edi
+  800cca:	fc                   	cld
+  800ccb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ccd:	5e                   	pop    %esi
+  800cce:	5f                   	pop    %edi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+
+00800cd1 <memcpy>:
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	83 ec 0c             	sub    $0xc,%esp
+  800cd7:	ff 75 10             	push   0x10(%ebp)
+  800cda:	ff 75 0c             	push   0xc(%ebp)
+  800cdd:	ff 75 08             	push   0x8(%ebp)
+  800ce0:	e8 8a ff ff ff       	call   800c6f <memmove>
+  800ce5:	c9                   	leave
+  800ce6:	c3                   	ret
+
+00800ce7 <memcmp>:
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	56                   	push   %esi
+  800ceb:	53                   	push   %ebx
+  800cec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cf2:	8b 75 10             	mov    0x10(%ebp),%esi
+  800cf5:	85 f6                	test   %esi,%esi
+  800cf7:	74 29                	je     800d22 <memcmp+0x3b>
+  800cf9:	01 c6                	add    %eax,%esi
+  800cfb:	0f b6 08             	movzbl (%eax),%ecx
+  800cfe:	0f b6 1a             	movzbl (%edx),%ebx
+  800d01:	38 d9                	cmp    %bl,%cl
+  800d03:	75 11                	jne    800d16 <memcmp+0x2f>
+  800d05:	83 c0 01             	add    $0x1,%eax
+  800d08:	83 c2 01             	add    $0x1,%edx
+  800d0b:	39 c6                	cmp    %eax,%esi
+  800d0d:	75 ec                	jne    800cfb <memcmp+0x14>
+  800d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d14:	eb 08                	jmp    800d1e <memcmp+0x37>
+  800d16:	0f b6 c1             	movzbl %cl,%eax
+  800d19:	0f b6 db             	movzbl %bl,%ebx
+  800d1c:	29 d8                	sub    %ebx,%eax
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5d                   	pop    %ebp
+  800d21:	c3                   	ret
+  800d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d27:	eb f5                	jmp    800d1e <memcmp+0x37>
+
+00800d29 <memfind>:
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	89 c2                	mov    %eax,%edx
+  800d34:	03 55 10             	add    0x10(%ebp),%edx
+  800d37:	39 d0                	cmp    %edx,%eax
+  800d39:	73 0d                	jae    800d48 <memfind+0x1f>
+  800d3b:	38 08                	cmp    %cl,(%eax)
+  800d3d:	74 0d                	je     800d4c <memfind+0x23>
+  800d3f:	83 c0 01             	add    $0x1,%eax
+  800d42:	39 c2                	cmp    %eax,%edx
+  800d44:	75 f5                	jne    800d3b <memfind+0x12>
+  800d46:	eb 06                	jmp    800d4e <memfind+0x25>
+  800d48:	89 c2                	mov    %eax,%edx
+  800d4a:	eb 02                	jmp    800d4e <memfind+0x25>
+  800d4c:	89 c2                	mov    %eax,%edx
+  800d4e:	89 d0                	mov    %edx,%eax
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+
+00800d52 <strtol>:
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	57                   	push   %edi
+  800d56:	56                   	push   %esi
+  800d57:	53                   	push   %ebx
+  800d58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5e:	0f b6 02             	movzbl (%edx),%eax
+  800d61:	3c 20                	cmp    $0x20,%al
+  800d63:	74 04                	je     800d69 <strtol+0x17>
+  800d65:	3c 09                	cmp    $0x9,%al
+  800d67:	75 0e                	jne    800d77 <strtol+0x25>
+  800d69:	83 c2 01             	add    $0x1,%edx
+  800d6c:	0f b6 02             	movzbl (%edx),%eax
+  800d6f:	3c 20                	cmp    $0x20,%al
+  800d71:	74 f6                	je     800d69 <strtol+0x17>
+  800d73:	3c 09                	cmp    $0x9,%al
+  800d75:	74 f2                	je     800d69 <strtol+0x17>
+  800d77:	3c 2b                	cmp    $0x2b,%al
+  800d79:	74 2a                	je     800da5 <strtol+0x53>
+  800d7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d80:	3c 2d                	cmp    $0x2d,%al
+  800d82:	74 2b                	je     800daf <strtol+0x5d>
+  800d84:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d8a:	75 0f                	jne    800d9b <strtol+0x49>
+  800d8c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d8f:	74 28                	je     800db9 <strtol+0x67>
+  800d91:	85 db                	test   %ebx,%ebx
+  800d93:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d98:	0f 44 d8             	cmove  %eax,%ebx
+  800d9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800da3:	eb 46                	jmp    800deb <strtol+0x99>
+  800da5:	83 c2 01             	add    $0x1,%edx
+  800da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dad:	eb d5                	jmp    800d84 <strtol+0x32>
+  800daf:	83 c2 01             	add    $0x1,%edx
+  800db2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800db7:	eb cb                	jmp    800d84 <strtol+0x32>
+  800db9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800dbd:	74 0e                	je     800dcd <strtol+0x7b>
+  800dbf:	85 db                	test   %ebx,%ebx
+  800dc1:	75 d8                	jne    800d9b <strtol+0x49>
+  800dc3:	83 c2 01             	add    $0x1,%edx
+  800dc6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800dcb:	eb ce                	jmp    800d9b <strtol+0x49>
+  800dcd:	83 c2 02             	add    $0x2,%edx
+  800dd0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800dd5:	eb c4                	jmp    800d9b <strtol+0x49>
+  800dd7:	0f be c0             	movsbl %al,%eax
+  800dda:	83 e8 30             	sub    $0x30,%eax
+  800ddd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800de0:	7d 3a                	jge    800e1c <strtol+0xca>
+  800de2:	83 c2 01             	add    $0x1,%edx
+  800de5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800de9:	01 c1                	add    %eax,%ecx
+  800deb:	0f b6 02             	movzbl (%edx),%eax
+  800dee:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800df1:	89 f3                	mov    %esi,%ebx
+  800df3:	80 fb 09             	cmp    $0x9,%bl
+  800df6:	76 df                	jbe    800dd7 <strtol+0x85>
+  800df8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dfb:	89 f3                	mov    %esi,%ebx
+  800dfd:	80 fb 19             	cmp    $0x19,%bl
+  800e00:	77 08                	ja     800e0a <strtol+0xb8>
+  800e02:	0f be c0             	movsbl %al,%eax
+  800e05:	83 e8 57             	sub    $0x57,%eax
+  800e08:	eb d3                	jmp    800ddd <strtol+0x8b>
+  800e0a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e0d:	89 f3                	mov    %esi,%ebx
+  800e0f:	80 fb 19             	cmp    $0x19,%bl
+  800e12:	77 08                	ja     800e1c <strtol+0xca>
+  800e14:	0f be c0             	movsbl %al,%eax
+  800e17:	83 e8 37             	sub    $0x37,%eax
+  800e1a:	eb c1                	jmp    800ddd <strtol+0x8b>
+  800e1c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e20:	74 05                	je     800e27 <strtol+0xd5>
+  800e22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e25:	89 10                	mov    %edx,(%eax)
+  800e27:	89 c8                	mov    %ecx,%eax
+  800e29:	f7 d8                	neg    %eax
+  800e2b:	85 ff                	test   %edi,%edi
+  800e2d:	0f 45 c8             	cmovne %eax,%ecx
+  800e30:	89 c8                	mov    %ecx,%eax
+  800e32:	5b                   	pop    %ebx
+  800e33:	5e                   	pop    %esi
+  800e34:	5f                   	pop    %edi
+  800e35:	5d                   	pop    %ebp
+  800e36:	c3                   	ret
+
+00800e37 <sys_cputs>:
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	57                   	push   %edi
+  800e3b:	56                   	push   %esi
+  800e3c:	53                   	push   %ebx
+  800e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e48:	89 c3                	mov    %eax,%ebx
+  800e4a:	89 c7                	mov    %eax,%edi
+  800e4c:	89 c6                	mov    %eax,%esi
+  800e4e:	cd 30                	int    $0x30
+  800e50:	5b                   	pop    %ebx
+  800e51:	5e                   	pop    %esi
+  800e52:	5f                   	pop    %edi
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+
+00800e55 <sys_cgetc>:
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e60:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e65:	89 d1                	mov    %edx,%ecx
+  800e67:	89 d3                	mov    %edx,%ebx
+  800e69:	89 d7                	mov    %edx,%edi
+  800e6b:	89 d6                	mov    %edx,%esi
+  800e6d:	cd 30                	int    $0x30
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5f                   	pop    %edi
+  800e72:	5d                   	pop    %ebp
+  800e73:	c3                   	ret
+
+00800e74 <sys_env_destroy>:
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+  800e7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e85:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e8a:	89 cb                	mov    %ecx,%ebx
+  800e8c:	89 cf                	mov    %ecx,%edi
+  800e8e:	89 ce                	mov    %ecx,%esi
+  800e90:	cd 30                	int    $0x30
+  800e92:	85 c0                	test   %eax,%eax
+  800e94:	7f 08                	jg     800e9e <sys_env_destroy+0x2a>
+  800e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e99:	5b                   	pop    %ebx
+  800e9a:	5e                   	pop    %esi
+  800e9b:	5f                   	pop    %edi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+  800e9e:	83 ec 0c             	sub    $0xc,%esp
+  800ea1:	50                   	push   %eax
+  800ea2:	6a 03                	push   $0x3
+  800ea4:	68 eb 3d 80 00       	push   $0x803deb
+  800ea9:	6a 24                	push   $0x24
+  800eab:	68 08 3e 80 00       	push   $0x803e08
+  800eb0:	e8 38 f4 ff ff       	call   8002ed <_panic>
+
+00800eb5 <sys_getenvid>:
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	57                   	push   %edi
+  800eb9:	56                   	push   %esi
+  800eba:	53                   	push   %ebx
+  800ebb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ec5:	89 d1                	mov    %edx,%ecx
+  800ec7:	89 d3                	mov    %edx,%ebx
+  800ec9:	89 d7                	mov    %edx,%edi
+  800ecb:	89 d6                	mov    %edx,%esi
+  800ecd:	cd 30                	int    $0x30
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+
+00800ed4 <sys_yield>:
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  800eda:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ee1:	74 26                	je     800f09 <sys_yield+0x35>
+  800ee3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eed:	89 d1                	mov    %edx,%ecx
+  800eef:	89 d3                	mov    %edx,%ebx
+  800ef1:	89 d7                	mov    %edx,%edi
+  800ef3:	6a 00                	push   $0x0
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	8d 35 00 0f 80 00    	lea    0x800f00,%esi
+  800efe:	0f 34                	sysenter
+  800f00:	5d                   	pop    %ebp
+  800f01:	83 c4 04             	add    $0x4,%esp
+  800f04:	5b                   	pop    %ebx
+  800f05:	5e                   	pop    %esi
+  800f06:	5f                   	pop    %edi
+  800f07:	5d                   	pop    %ebp
+  800f08:	c3                   	ret
+  800f09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f13:	89 d1                	mov    %edx,%ecx
+  800f15:	89 d3                	mov    %edx,%ebx
+  800f17:	89 d7                	mov    %edx,%edi
+  800f19:	89 d6                	mov    %edx,%esi
+  800f1b:	cd 30                	int    $0x30
+  800f1d:	eb e5                	jmp    800f04 <sys_yield+0x30>
+
+00800f1f <sys_page_alloc>:
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3b:	89 f7                	mov    %esi,%edi
+  800f3d:	cd 30                	int    $0x30
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	7f 08                	jg     800f4b <sys_page_alloc+0x2c>
+  800f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+  800f4e:	50                   	push   %eax
+  800f4f:	6a 04                	push   $0x4
+  800f51:	68 eb 3d 80 00       	push   $0x803deb
+  800f56:	6a 24                	push   $0x24
+  800f58:	68 08 3e 80 00       	push   $0x803e08
+  800f5d:	e8 8b f3 ff ff       	call   8002ed <_panic>
+
+00800f62 <sys_page_map>:
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	56                   	push   %esi
+  800f67:	53                   	push   %ebx
+  800f68:	83 ec 0c             	sub    $0xc,%esp
+  800f6b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f72:	74 33                	je     800fa7 <sys_page_map+0x45>
+  800f74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f82:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f85:	ff 75 18             	push   0x18(%ebp)
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	8d 35 93 0f 80 00    	lea    0x800f93,%esi
+  800f91:	0f 34                	sysenter
+  800f93:	5d                   	pop    %ebp
+  800f94:	83 c4 04             	add    $0x4,%esp
+  800f97:	89 c2                	mov    %eax,%edx
+  800f99:	85 c0                	test   %eax,%eax
+  800f9b:	7f 3d                	jg     800fda <sys_page_map+0x78>
+  800f9d:	89 d0                	mov    %edx,%eax
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+  800fa7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fbb:	cd 30                	int    $0x30
+  800fbd:	89 c2                	mov    %eax,%edx
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	7e da                	jle    800f9d <sys_page_map+0x3b>
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+  800fc6:	50                   	push   %eax
+  800fc7:	6a 05                	push   $0x5
+  800fc9:	68 eb 3d 80 00       	push   $0x803deb
+  800fce:	6a 24                	push   $0x24
+  800fd0:	68 08 3e 80 00       	push   $0x803e08
+  800fd5:	e8 13 f3 ff ff       	call   8002ed <_panic>
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	50                   	push   %eax
+  800fde:	6a 05                	push   $0x5
+  800fe0:	68 eb 3d 80 00       	push   $0x803deb
+  800fe5:	6a 48                	push   $0x48
+  800fe7:	68 08 3e 80 00       	push   $0x803e08
+  800fec:	e8 fc f2 ff ff       	call   8002ed <_panic>
+
+00800ff1 <sys_page_unmap>:
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+  800ff7:	83 ec 0c             	sub    $0xc,%esp
+  800ffa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801005:	b8 06 00 00 00       	mov    $0x6,%eax
+  80100a:	89 df                	mov    %ebx,%edi
+  80100c:	89 de                	mov    %ebx,%esi
+  80100e:	cd 30                	int    $0x30
+  801010:	85 c0                	test   %eax,%eax
+  801012:	7f 08                	jg     80101c <sys_page_unmap+0x2b>
+  801014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+  80101f:	50                   	push   %eax
+  801020:	6a 06                	push   $0x6
+  801022:	68 eb 3d 80 00       	push   $0x803deb
+  801027:	6a 24                	push   $0x24
+  801029:	68 08 3e 80 00       	push   $0x803e08
+  80102e:	e8 ba f2 ff ff       	call   8002ed <_panic>
+
+00801033 <sys_fork>:
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	57                   	push   %edi
+  801037:	56                   	push   %esi
+  801038:	53                   	push   %ebx
+  801039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801043:	89 d1                	mov    %edx,%ecx
+  801045:	89 d3                	mov    %edx,%ebx
+  801047:	89 d7                	mov    %edx,%edi
+  801049:	89 d6                	mov    %edx,%esi
+  80104b:	cd 30                	int    $0x30
+  80104d:	5b                   	pop    %ebx
+  80104e:	5e                   	pop    %esi
+  80104f:	5f                   	pop    %edi
+  801050:	5d                   	pop    %ebp
+  801051:	c3                   	ret
+
+00801052 <sys_env_set_status>:
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	57                   	push   %edi
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+  801058:	83 ec 0c             	sub    $0xc,%esp
+  80105b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801066:	b8 08 00 00 00       	mov    $0x8,%eax
+  80106b:	89 df                	mov    %ebx,%edi
+  80106d:	89 de                	mov    %ebx,%esi
+  80106f:	cd 30                	int    $0x30
+  801071:	85 c0                	test   %eax,%eax
+  801073:	7f 08                	jg     80107d <sys_env_set_status+0x2b>
+  801075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+  801080:	50                   	push   %eax
+  801081:	6a 08                	push   $0x8
+  801083:	68 eb 3d 80 00       	push   $0x803deb
+  801088:	6a 24                	push   $0x24
+  80108a:	68 08 3e 80 00       	push   $0x803e08
+  80108f:	e8 59 f2 ff ff       	call   8002ed <_panic>
+
+00801094 <sys_env_set_trapframe>:
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	89 de                	mov    %ebx,%esi
+  8010b1:	cd 30                	int    $0x30
+  8010b3:	85 c0                	test   %eax,%eax
+  8010b5:	7f 08                	jg     8010bf <sys_env_set_trapframe+0x2b>
+  8010b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ba:	5b                   	pop    %ebx
+  8010bb:	5e                   	pop    %esi
+  8010bc:	5f                   	pop    %edi
+  8010bd:	5d                   	pop    %ebp
+  8010be:	c3                   	ret
+  8010bf:	83 ec 0c             	sub    $0xc,%esp
+  8010c2:	50                   	push   %eax
+  8010c3:	6a 09                	push   $0x9
+  8010c5:	68 eb 3d 80 00       	push   $0x803deb
+  8010ca:	6a 24                	push   $0x24
+  8010cc:	68 08 3e 80 00       	push   $0x803e08
+  8010d1:	e8 17 f2 ff ff       	call   8002ed <_panic>
+
+008010d6 <sys_env_set_cow>:
+  8010d6:	55                   	push   %ebp
+  8010d7:	89 e5                	mov    %esp,%ebp
+  8010d9:	57                   	push   %edi
+  8010da:	56                   	push   %esi
+  8010db:	53                   	push   %ebx
+  8010dc:	83 ec 0c             	sub    $0xc,%esp
+  8010df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ea:	b8 20 00 00 00       	mov    $0x20,%eax
+  8010ef:	89 df                	mov    %ebx,%edi
+  8010f1:	89 de                	mov    %ebx,%esi
+  8010f3:	cd 30                	int    $0x30
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	7f 08                	jg     801101 <sys_env_set_cow+0x2b>
+  8010f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5e                   	pop    %esi
+  8010fe:	5f                   	pop    %edi
+  8010ff:	5d                   	pop    %ebp
+  801100:	c3                   	ret
+  801101:	83 ec 0c             	sub    $0xc,%esp
+  801104:	50                   	push   %eax
+  801105:	6a 20                	push   $0x20
+  801107:	68 eb 3d 80 00       	push   $0x803deb
+  80110c:	6a 24                	push   $0x24
+  80110e:	68 08 3e 80 00       	push   $0x803e08
+  801113:	e8 d5 f1 ff ff       	call   8002ed <_panic>
+
+00801118 <sys_env_service>:
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  80111e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801123:	8b 55 08             	mov    0x8(%ebp),%edx
+  801126:	b8 21 00 00 00       	mov    $0x21,%eax
+  80112b:	89 cb                	mov    %ecx,%ebx
+  80112d:	89 cf                	mov    %ecx,%edi
+  80112f:	89 ce                	mov    %ecx,%esi
+  801131:	cd 30                	int    $0x30
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+
+00801138 <sys_env_set_pgfault_upcall>:
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801146:	8b 55 08             	mov    0x8(%ebp),%edx
+  801149:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801151:	89 df                	mov    %ebx,%edi
+  801153:	89 de                	mov    %ebx,%esi
+  801155:	cd 30                	int    $0x30
+  801157:	85 c0                	test   %eax,%eax
+  801159:	7f 08                	jg     801163 <sys_env_set_pgfault_upcall+0x2b>
+  80115b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115e:	5b                   	pop    %ebx
+  80115f:	5e                   	pop    %esi
+  801160:	5f                   	pop    %edi
+  801161:	5d                   	pop    %ebp
+  801162:	c3                   	ret
+  801163:	83 ec 0c             	sub    $0xc,%esp
+  801166:	50                   	push   %eax
+  801167:	6a 0a                	push   $0xa
+  801169:	68 eb 3d 80 00       	push   $0x803deb
+  80116e:	6a 24                	push   $0x24
+  801170:	68 08 3e 80 00       	push   $0x803e08
+  801175:	e8 73 f1 ff ff       	call   8002ed <_panic>
+
+0080117a <sys_ipc_try_send>:
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+  801180:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801187:	74 27                	je     8011b0 <sys_ipc_try_send+0x36>
+  801189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801194:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801197:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119a:	6a 00                	push   $0x0
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	8d 35 a7 11 80 00    	lea    0x8011a7,%esi
+  8011a5:	0f 34                	sysenter
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	83 c4 04             	add    $0x4,%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+  8011b0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c6:	cd 30                	int    $0x30
+  8011c8:	eb e1                	jmp    8011ab <sys_ipc_try_send+0x31>
+
+008011ca <sys_ipc_recv>:
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+  8011d3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011da:	74 32                	je     80120e <sys_ipc_recv+0x44>
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e9:	89 cb                	mov    %ecx,%ebx
+  8011eb:	89 cf                	mov    %ecx,%edi
+  8011ed:	6a 00                	push   $0x0
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	8d 35 fa 11 80 00    	lea    0x8011fa,%esi
+  8011f8:	0f 34                	sysenter
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	83 c4 04             	add    $0x4,%esp
+  8011fe:	89 c2                	mov    %eax,%edx
+  801200:	85 c0                	test   %eax,%eax
+  801202:	7f 3c                	jg     801240 <sys_ipc_recv+0x76>
+  801204:	89 d0                	mov    %edx,%eax
+  801206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801209:	5b                   	pop    %ebx
+  80120a:	5e                   	pop    %esi
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+  80120e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801213:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	89 cb                	mov    %ecx,%ebx
+  80121d:	89 cf                	mov    %ecx,%edi
+  80121f:	89 ce                	mov    %ecx,%esi
+  801221:	cd 30                	int    $0x30
+  801223:	89 c2                	mov    %eax,%edx
+  801225:	85 c0                	test   %eax,%eax
+  801227:	7e db                	jle    801204 <sys_ipc_recv+0x3a>
+  801229:	83 ec 0c             	sub    $0xc,%esp
+  80122c:	50                   	push   %eax
+  80122d:	6a 0d                	push   $0xd
+  80122f:	68 eb 3d 80 00       	push   $0x803deb
+  801234:	6a 24                	push   $0x24
+  801236:	68 08 3e 80 00       	push   $0x803e08
+  80123b:	e8 ad f0 ff ff       	call   8002ed <_panic>
+  801240:	83 ec 0c             	sub    $0xc,%esp
+  801243:	50                   	push   %eax
+  801244:	6a 0d                	push   $0xd
+  801246:	68 eb 3d 80 00       	push   $0x803deb
+  80124b:	6a 48                	push   $0x48
+  80124d:	68 08 3e 80 00       	push   $0x803e08
+  801252:	e8 96 f0 ff ff       	call   8002ed <_panic>
+
+00801257 <sys_ipc_send>:
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+  80125d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801264:	74 27                	je     80128d <sys_ipc_send+0x36>
+  801266:	8b 55 08             	mov    0x8(%ebp),%edx
+  801269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801271:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801274:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801277:	6a 00                	push   $0x0
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	8d 35 84 12 80 00    	lea    0x801284,%esi
+  801282:	0f 34                	sysenter
+  801284:	5d                   	pop    %ebp
+  801285:	83 c4 04             	add    $0x4,%esp
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+  80128d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801292:	be 00 00 00 00       	mov    $0x0,%esi
+  801297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a3:	cd 30                	int    $0x30
+  8012a5:	eb e1                	jmp    801288 <sys_ipc_send+0x31>
+
+008012a7 <sys_ipc_call>:
+  8012a7:	55                   	push   %ebp
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	57                   	push   %edi
+  8012ab:	56                   	push   %esi
+  8012ac:	53                   	push   %ebx
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012bb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012be:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012c1:	cd 30                	int    $0x30
+  8012c3:	5b                   	pop    %ebx
+  8012c4:	5e                   	pop    %esi
+  8012c5:	5f                   	pop    %edi
+  8012c6:	5d                   	pop    %ebp
+  8012c7:	c3                   	ret
+
+008012c8 <sys_ipc_reply_recv>:
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+  8012cb:	57                   	push   %edi
+  8012cc:	56                   	push   %esi
+  8012cd:	53                   	push   %ebx
+  8012ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012df:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012e2:	cd 30                	int    $0x30
+  8012e4:	5b                   	pop    %ebx
+  8012e5:	5e                   	pop    %esi
+  8012e6:	5f                   	pop    %edi
+  8012e7:	5d                   	pop    %ebp
+  8012e8:	c3                   	ret
+
+008012e9 <sys_time_msec>:
+  8012e9:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8012ee:	85 c0                	test   %eax,%eax
+  8012f0:	75 06                	jne    8012f8 <sys_time_msec+0xf>
+  8012f2:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8012f7:	c3                   	ret
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+  8012fe:	83 ec 0c             	sub    $0xc,%esp
+  801301:	0f 31                	rdtsc
+  801303:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801309:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80130f:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801315:	29 c8                	sub    %ecx,%eax
+  801317:	19 da                	sbb    %ebx,%edx
+  801319:	bf 00 00 00 00       	mov    $0x0,%edi
+  80131e:	57                   	push   %edi
+  80131f:	56                   	push   %esi
+  801320:	52                   	push   %edx
+  801321:	50                   	push   %eax
+  801322:	e8 81 25 00 00       	call   8038a8 <__udivdi3>
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132d:	5b                   	pop    %ebx
+  80132e:	5e                   	pop    %esi
+  80132f:	5f                   	pop    %edi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+
+00801332 <sys_env_swap>:
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	57                   	push   %edi
+  801336:	56                   	push   %esi
+  801337:	53                   	push   %ebx
+  801338:	83 ec 0c             	sub    $0xc,%esp
+  80133b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801340:	8b 55 08             	mov    0x8(%ebp),%edx
+  801343:	b8 12 00 00 00       	mov    $0x12,%eax
+  801348:	89 cb                	mov    %ecx,%ebx
+  80134a:	89 cf                	mov    %ecx,%edi
+  80134c:	89 ce                	mov    %ecx,%esi
+  80134e:	cd 30                	int    $0x30
+  801350:	85 c0                	test   %eax,%eax
+  801352:	7f 08                	jg     80135c <sys_env_swap+0x2a>
+  801354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801357:	5b                   	pop    %ebx
+  801358:	5e                   	pop    %esi
+  801359:	5f                   	pop    %edi
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+  80135c:	83 ec 0c             	sub    $0xc,%esp
+  80135f:	50                   	push   %eax
+  801360:	6a 12                	push   $0x12
+  801362:	68 eb 3d 80 00       	push   $0x803deb
+  801367:	6a 24                	push   $0x24
+  801369:	68 08 3e 80 00       	push   $0x803e08
+  80136e:	e8 7a ef ff ff       	call   8002ed <_panic>
+
+00801373 <sys_net_try_send>:
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	57                   	push   %edi
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+  801379:	83 ec 0c             	sub    $0xc,%esp
+  80137c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801381:	8b 55 08             	mov    0x8(%ebp),%edx
+  801384:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801387:	b8 13 00 00 00       	mov    $0x13,%eax
+  80138c:	89 df                	mov    %ebx,%edi
+  80138e:	89 de                	mov    %ebx,%esi
+  801390:	cd 30                	int    $0x30
+  801392:	85 c0                	test   %eax,%eax
+  801394:	7f 08                	jg     80139e <sys_net_try_send+0x2b>
+  801396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801399:	5b                   	pop    %ebx
+  80139a:	5e                   	pop    %esi
+  80139b:	5f                   	pop    %edi
+  80139c:	5d                   	pop    %ebp
+  80139d:	c3                   	ret
+  80139e:	83 ec 0c             	sub    $0xc,%esp
+  8013a1:	50                   	push   %eax
+  8013a2:	6a 13                	push   $0x13
+  8013a4:	68 eb 3d 80 00       	push   $0x803deb
+  8013a9:	6a 24                	push   $0x24
+  8013ab:	68 08 3e 80 00       	push   $0x803e08
+  8013b0:	e8 38 ef ff ff       	call   8002ed <_panic>
+
+008013b5 <sys_net_try_receive>:
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	57                   	push   %edi
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  8013be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013ce:	89 df                	mov    %ebx,%edi
+  8013d0:	89 de                	mov    %ebx,%esi
+  8013d2:	cd 30                	int    $0x30
+  8013d4:	85 c0                	test   %eax,%eax
+  8013d6:	7f 08                	jg     8013e0 <sys_net_try_receive+0x2b>
+  8013d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+  8013e0:	83 ec 0c             	sub    $0xc,%esp
+  8013e3:	50                   	push   %eax
+  8013e4:	6a 14                	push   $0x14
+  8013e6:	68 eb 3d 80 00       	push   $0x803deb
+  8013eb:	6a 24                	push   $0x24
+  8013ed:	68 08 3e 80 00       	push   $0x803e08
+  8013f2:	e8 f6 ee ff ff       	call   8002ed <_panic>
+
+008013f7 <sys_net_recv_page>:
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	57                   	push   %edi
+  8013fb:	56                   	push   %esi
+  8013fc:	53                   	push   %ebx
+  8013fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801402:	8b 55 08             	mov    0x8(%ebp),%edx
+  801405:	b8 27 00 00 00       	mov    $0x27,%eax
+  80140a:	89 cb                	mov    %ecx,%ebx
+  80140c:	89 cf                	mov    %ecx,%edi
+  80140e:	89 ce                	mov    %ecx,%esi
+  801410:	cd 30                	int    $0x30
+  801412:	5b                   	pop    %ebx
+  801413:	5e                   	pop    %esi
+  801414:	5f                   	pop    %edi
+  801415:	5d                   	pop    %ebp
+  801416:	c3                   	ret
+
+00801417 <sys_net_wait>:
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	57                   	push   %edi
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+  80141d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801422:	b8 26 00 00 00       	mov    $0x26,%eax
+  801427:	89 d1                	mov    %edx,%ecx
+  801429:	89 d3                	mov    %edx,%ebx
+  80142b:	89 d7                	mov    %edx,%edi
+  80142d:	89 d6                	mov    %edx,%esi
+  80142f:	cd 30                	int    $0x30
+  801431:	5b                   	pop    %ebx
+  801432:	5e                   	pop    %esi
+  801433:	5f                   	pop    %edi
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+
+00801436 <sys_get_mac>:
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	57                   	push   %edi
+  80143a:	56                   	push   %esi
+  80143b:	53                   	push   %ebx
+  80143c:	83 ec 0c             	sub    $0xc,%esp
+  80143f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801444:	8b 55 08             	mov    0x8(%ebp),%edx
+  801447:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80144f:	89 df                	mov    %ebx,%edi
+  801451:	89 de                	mov    %ebx,%esi
+  801453:	cd 30                	int    $0x30
+  801455:	85 c0                	test   %eax,%eax
+  801457:	7f 08                	jg     801461 <sys_get_mac+0x2b>
+  801459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145c:	5b                   	pop    %ebx
+  80145d:	5e                   	pop    %esi
+  80145e:	5f                   	pop    %edi
+  80145f:	5d                   	pop    %ebp
+  801460:	c3                   	ret
+  801461:	83 ec 0c             	sub    $0xc,%esp
+  801464:	50                   	push   %eax
+  801465:	6a 15                	push   $0x15
+  801467:	68 eb 3d 80 00       	push   $0x803deb
+  80146c:	6a 24                	push   $0x24
+  80146e:	68 08 3e 80 00       	push   $0x803e08
+  801473:	e8 75 ee ff ff       	call   8002ed <_panic>
+
+00801478 <sys_env_lease>:
+  801478:	55                   	push   %ebp
+  801479:	89 e5                	mov    %esp,%ebp
+  80147b:	57                   	push   %edi
+  80147c:	56                   	push   %esi
+  80147d:	53                   	push   %ebx
+  80147e:	83 ec 0c             	sub    $0xc,%esp
+  801481:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801491:	89 df                	mov    %ebx,%edi
+  801493:	89 de                	mov    %ebx,%esi
+  801495:	cd 30                	int    $0x30
+  801497:	85 c0                	test   %eax,%eax
+  801499:	7f 08                	jg     8014a3 <sys_env_lease+0x2b>
+  80149b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149e:	5b                   	pop    %ebx
+  80149f:	5e                   	pop    %esi
+  8014a0:	5f                   	pop    %edi
+  8014a1:	5d                   	pop    %ebp
+  8014a2:	c3                   	ret
+  8014a3:	83 ec 0c             	sub    $0xc,%esp
+  8014a6:	50                   	push   %eax
+  8014a7:	6a 16                	push   $0x16
+  8014a9:	68 eb 3d 80 00       	push   $0x803deb
+  8014ae:	6a 24                	push   $0x24
+  8014b0:	68 08 3e 80 00       	push   $0x803e08
+  8014b5:	e8 33 ee ff ff       	call   8002ed <_panic>
+
+008014ba <sys_copy_mem>:
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+  8014c0:	83 ec 0c             	sub    $0xc,%esp
+  8014c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014d7:	cd 30                	int    $0x30
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	7f 08                	jg     8014e5 <sys_copy_mem+0x2b>
+  8014dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e0:	5b                   	pop    %ebx
+  8014e1:	5e                   	pop    %esi
+  8014e2:	5f                   	pop    %edi
+  8014e3:	5d                   	pop    %ebp
+  8014e4:	c3                   	ret
+  8014e5:	83 ec 0c             	sub    $0xc,%esp
+  8014e8:	50                   	push   %eax
+  8014e9:	6a 17                	push   $0x17
+  8014eb:	68 eb 3d 80 00       	push   $0x803deb
+  8014f0:	6a 24                	push   $0x24
+  8014f2:	68 08 3e 80 00       	push   $0x803e08
+  8014f7:	e8 f1 ed ff ff       	call   8002ed <_panic>
+
+008014fc <sys_get_perms>:
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	57                   	push   %edi
+  801500:	56                   	push   %esi
+  801501:	53                   	push   %ebx
+  801502:	83 ec 0c             	sub    $0xc,%esp
+  801505:	be 00 00 00 00       	mov    $0x0,%esi
+  80150a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801510:	b8 18 00 00 00       	mov    $0x18,%eax
+  801515:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801518:	89 f7                	mov    %esi,%edi
+  80151a:	cd 30                	int    $0x30
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	7f 08                	jg     801528 <sys_get_perms+0x2c>
+  801520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801523:	5b                   	pop    %ebx
+  801524:	5e                   	pop    %esi
+  801525:	5f                   	pop    %edi
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+  801528:	83 ec 0c             	sub    $0xc,%esp
+  80152b:	50                   	push   %eax
+  80152c:	6a 18                	push   $0x18
+  80152e:	68 eb 3d 80 00       	push   $0x803deb
+  801533:	6a 24                	push   $0x24
+  801535:	68 08 3e 80 00       	push   $0x803e08
+  80153a:	e8 ae ed ff ff       	call   8002ed <_panic>
+
+0080153f <sys_env_unsuspend>:
+  80153f:	55                   	push   %ebp
+  801540:	89 e5                	mov    %esp,%ebp
+  801542:	57                   	push   %edi
+  801543:	56                   	push   %esi
+  801544:	53                   	push   %ebx
+  801545:	83 ec 0c             	sub    $0xc,%esp
+  801548:	be 00 00 00 00       	mov    $0x0,%esi
+  80154d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801550:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801553:	b8 19 00 00 00       	mov    $0x19,%eax
+  801558:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80155b:	89 f7                	mov    %esi,%edi
+  80155d:	cd 30                	int    $0x30
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	7f 08                	jg     80156b <sys_env_unsuspend+0x2c>
+  801563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801566:	5b                   	pop    %ebx
+  801567:	5e                   	pop    %esi
+  801568:	5f                   	pop    %edi
+  801569:	5d                   	pop    %ebp
+  80156a:	c3                   	ret
+  80156b:	83 ec 0c             	sub    $0xc,%esp
+  80156e:	50                   	push   %eax
+  80156f:	6a 19                	push   $0x19
+  801571:	68 eb 3d 80 00       	push   $0x803deb
+  801576:	6a 24                	push   $0x24
+  801578:	68 08 3e 80 00       	push   $0x803e08
+  80157d:	e8 6b ed ff ff       	call   8002ed <_panic>
+
+00801582 <sys_migrate>:
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	57                   	push   %edi
+  801586:	56                   	push   %esi
+  801587:	53                   	push   %ebx
+  801588:	83 ec 0c             	sub    $0xc,%esp
+  80158b:	ba 04 90 80 00       	mov    $0x809004,%edx
+  801590:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801596:	76 11                	jbe    8015a9 <sys_migrate+0x27>
+  801598:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80159d:	0f b6 08             	movzbl (%eax),%ecx
+  8015a0:	05 00 10 00 00       	add    $0x1000,%eax
+  8015a5:	39 d0                	cmp    %edx,%eax
+  8015a7:	72 f4                	jb     80159d <sys_migrate+0x1b>
+  8015a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015b6:	89 cb                	mov    %ecx,%ebx
+  8015b8:	89 cf                	mov    %ecx,%edi
+  8015ba:	89 ce                	mov    %ecx,%esi
+  8015bc:	cd 30                	int    $0x30
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	7f 08                	jg     8015ca <sys_migrate+0x48>
+  8015c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c5:	5b                   	pop    %ebx
+  8015c6:	5e                   	pop    %esi
+  8015c7:	5f                   	pop    %edi
+  8015c8:	5d                   	pop    %ebp
+  8015c9:	c3                   	ret
+  8015ca:	83 ec 0c             	sub    $0xc,%esp
+  8015cd:	50                   	push   %eax
+  8015ce:	6a 1a                	push   $0x1a
+  8015d0:	68 eb 3d 80 00       	push   $0x803deb
+  8015d5:	6a 24                	push   $0x24
+  8015d7:	68 08 3e 80 00       	push   $0x803e08
+  8015dc:	e8 0c ed ff ff       	call   8002ed <_panic>
+
+008015e1 <sys_lease_complete>:
+  8015e1:	55                   	push   %ebp
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	57                   	push   %edi
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+  8015e7:	83 ec 0c             	sub    $0xc,%esp
+  8015ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ef:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015f4:	89 d1                	mov    %edx,%ecx
+  8015f6:	89 d3                	mov    %edx,%ebx
+  8015f8:	89 d7                	mov    %edx,%edi
+  8015fa:	89 d6                	mov    %edx,%esi
+  8015fc:	cd 30                	int    $0x30
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	7f 08                	jg     80160a <sys_lease_complete+0x29>
+  801602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801605:	5b                   	pop    %ebx
+  801606:	5e                   	pop    %esi
+  801607:	5f                   	pop    %edi
+  801608:	5d                   	pop    %ebp
+  801609:	c3                   	ret
+  80160a:	83 ec 0c             	sub    $0xc,%esp
+  80160d:	50                   	push   %eax
+  80160e:	6a 1b                	push   $0x1b
+  801610:	68 eb 3d 80 00       	push   $0x803deb
+  801615:	6a 24                	push   $0x24
+  801617:	68 08 3e 80 00       	push   $0x803e08
+  80161c:	e8 cc ec ff ff       	call   8002ed <_panic>
+
+00801621 <sys_env_set_thisenv>:
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	57                   	push   %edi
+  801625:	56                   	push   %esi
+  801626:	53                   	push   %ebx
+  801627:	83 ec 0c             	sub    $0xc,%esp
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801632:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801635:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80163a:	89 df                	mov    %ebx,%edi
+  80163c:	89 de                	mov    %ebx,%esi
+  80163e:	cd 30                	int    $0x30
+  801640:	85 c0                	test   %eax,%eax
+  801642:	7f 08                	jg     80164c <sys_env_set_thisenv+0x2b>
+  801644:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801647:	5b                   	pop    %ebx
+  801648:	5e                   	pop    %esi
+  801649:	5f                   	pop    %edi
+  80164a:	5d                   	pop    %ebp
+  80164b:	c3                   	ret
+  80164c:	83 ec 0c             	sub    $0xc,%esp
+  80164f:	50                   	push   %eax
+  801650:	6a 1c                	push   $0x1c
+  801652:	68 eb 3d 80 00       	push   $0x803deb
+  801657:	6a 24                	push   $0x24
+  801659:	68 08 3e 80 00       	push   $0x803e08
+  80165e:	e8 8a ec ff ff       	call   8002ed <_panic>
+
+00801663 <sys_env_set_sched>:
+  801663:	55                   	push   %ebp
+  801664:	89 e5                	mov    %esp,%ebp
+  801666:	57                   	push   %edi
+  801667:	56                   	push   %esi
+  801668:	53                   	push   %ebx
+  801669:	83 ec 0c             	sub    $0xc,%esp
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	8b 55 08             	mov    0x8(%ebp),%edx
+  801674:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801677:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80167c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80167f:	89 f7                	mov    %esi,%edi
+  801681:	cd 30                	int    $0x30
+  801683:	85 c0                	test   %eax,%eax
+  801685:	7f 08                	jg     80168f <sys_env_set_sched+0x2c>
+  801687:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168a:	5b                   	pop    %ebx
+  80168b:	5e                   	pop    %esi
+  80168c:	5f                   	pop    %edi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+  80168f:	83 ec 0c             	sub    $0xc,%esp
+  801692:	50                   	push   %eax
+  801693:	6a 1d                	push   $0x1d
+  801695:	68 eb 3d 80 00       	push   $0x803deb
+  80169a:	6a 24                	push   $0x24
+  80169c:	68 08 3e 80 00       	push   $0x803e08
+  8016a1:	e8 47 ec ff ff       	call   8002ed <_panic>
+
+008016a6 <sys_batch>:
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	57                   	push   %edi
+  8016aa:	56                   	push   %esi
+  8016ab:	53                   	push   %ebx
+  8016ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8016bc:	89 df                	mov    %ebx,%edi
+  8016be:	89 de                	mov    %ebx,%esi
+  8016c0:	cd 30                	int    $0x30
+  8016c2:	5b                   	pop    %ebx
+  8016c3:	5e                   	pop    %esi
+  8016c4:	5f                   	pop    %edi
+  8016c5:	5d                   	pop    %ebp
+  8016c6:	c3                   	ret
+
+008016c7 <sys_env_stats>:
+  8016c7:	55                   	push   %ebp
+  8016c8:	89 e5                	mov    %esp,%ebp
+  8016ca:	57                   	push   %edi
+  8016cb:	56                   	push   %esi
+  8016cc:	53                   	push   %ebx
+  8016cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d8:	b8 23 00 00 00       	mov    $0x23,%eax
+  8016dd:	89 df                	mov    %ebx,%edi
+  8016df:	89 de                	mov    %ebx,%esi
+  8016e1:	cd 30                	int    $0x30
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5f                   	pop    %edi
+  8016e6:	5d                   	pop    %ebp
+  8016e7:	c3                   	ret
+
+008016e8 <sys_trace>:
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	57                   	push   %edi
+  8016ec:	56                   	push   %esi
+  8016ed:	53                   	push   %ebx
+  8016ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f6:	b8 24 00 00 00       	mov    $0x24,%eax
+  8016fb:	89 cb                	mov    %ecx,%ebx
+  8016fd:	89 cf                	mov    %ecx,%edi
+  8016ff:	89 ce                	mov    %ecx,%esi
+  801701:	cd 30                	int    $0x30
+  801703:	5b                   	pop    %ebx
+  801704:	5e                   	pop    %esi
+  801705:	5f                   	pop    %edi
+  801706:	5d                   	pop    %ebp
+  801707:	c3                   	ret
+
+00801708 <sys_env_set_pager>:
+  801708:	55                   	push   %ebp
+  801709:	89 e5                	mov    %esp,%ebp
+  80170b:	57                   	push   %edi
+  80170c:	56                   	push   %esi
+  80170d:	53                   	push   %ebx
+  80170e:	83 ec 0c             	sub    $0xc,%esp
+  801711:	be 00 00 00 00       	mov    $0x0,%esi
+  801716:	8b 55 08             	mov    0x8(%ebp),%edx
+  801719:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171c:	b8 25 00 00 00       	mov    $0x25,%eax
+  801721:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801724:	89 f7                	mov    %esi,%edi
+  801726:	cd 30                	int    $0x30
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	7f 08                	jg     801734 <sys_env_set_pager+0x2c>
+  80172c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80172f:	5b                   	pop    %ebx
+  801730:	5e                   	pop    %esi
+  801731:	5f                   	pop    %edi
+  801732:	5d                   	pop    %ebp
+  801733:	c3                   	ret
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	50                   	push   %eax
+  801738:	6a 25                	push   $0x25
+  80173a:	68 eb 3d 80 00       	push   $0x803deb
+  80173f:	6a 24                	push   $0x24
+  801741:	68 08 3e 80 00       	push   $0x803e08
+  801746:	e8 a2 eb ff ff       	call   8002ed <_panic>
+
+0080174b <sys_pager_retire>:
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	57                   	push   %edi
+  80174f:	56                   	push   %esi
+  801750:	53                   	push   %ebx
+  801751:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801756:	8b 55 08             	mov    0x8(%ebp),%edx
+  801759:	b8 28 00 00 00       	mov    $0x28,%eax
+  80175e:	89 cb                	mov    %ecx,%ebx
+  801760:	89 cf                	mov    %ecx,%edi
+  801762:	89 ce                	mov    %ecx,%esi
+  801764:	cd 30                	int    $0x30
+  801766:	5b                   	pop    %ebx
+  801767:	5e                   	pop    %esi
+  801768:	5f                   	pop    %edi
+  801769:	5d                   	pop    %ebp
+  80176a:	c3                   	ret
+
+0080176b <sys_prof>:
+  80176b:	55                   	push   %ebp
+  80176c:	89 e5                	mov    %esp,%ebp
+  80176e:	57                   	push   %edi
+  80176f:	56                   	push   %esi
+  801770:	53                   	push   %ebx
+  801771:	be 00 00 00 00       	mov    $0x0,%esi
+  801776:	8b 55 08             	mov    0x8(%ebp),%edx
+  801779:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177c:	b8 22 00 00 00       	mov    $0x22,%eax
+  801781:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801784:	89 f7                	mov    %esi,%edi
+  801786:	cd 30                	int    $0x30
+  801788:	5b                   	pop    %ebx
+  801789:	5e                   	pop    %esi
+  80178a:	5f                   	pop    %edi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+
+0080178d <dupq_flush>:
+  80178d:	55                   	push   %ebp
+  80178e:	89 e5                	mov    %esp,%ebp
+  801790:	53                   	push   %ebx
+  801791:	83 ec 0c             	sub    $0xc,%esp
+  801794:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  80179a:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8017a1:	00 00 00 
+  8017a4:	53                   	push   %ebx
+  8017a5:	68 00 00 40 00       	push   $0x400000
+  8017aa:	e8 f7 fe ff ff       	call   8016a6 <sys_batch>
+  8017af:	83 c4 10             	add    $0x10,%esp
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	78 14                	js     8017ca <dupq_flush+0x3d>
+  8017b6:	39 c3                	cmp    %eax,%ebx
+  8017b8:	7e 0b                	jle    8017c5 <dupq_flush+0x38>
+  8017ba:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8017bd:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8017c3:	eb 05                	jmp    8017ca <dupq_flush+0x3d>
+  8017c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017cd:	c9                   	leave
+  8017ce:	c3                   	ret
+
+008017cf <pgfault>:
+  8017cf:	55                   	push   %ebp
+  8017d0:	89 e5                	mov    %esp,%ebp
+  8017d2:	56                   	push   %esi
+  8017d3:	53                   	push   %ebx
+  8017d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d7:	8b 30                	mov    (%eax),%esi
+  8017d9:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8017dd:	0f 84 83 00 00 00    	je     801866 <pgfault+0x97>
+  8017e3:	89 f0                	mov    %esi,%eax
+  8017e5:	c1 e8 0c             	shr    $0xc,%eax
+  8017e8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017ef:	f6 c4 08             	test   $0x8,%ah
+  8017f2:	0f 84 80 00 00 00    	je     801878 <pgfault+0xa9>
+  8017f8:	e8 b8 f6 ff ff       	call   800eb5 <sys_getenvid>
+  8017fd:	89 c3                	mov    %eax,%ebx
+  8017ff:	83 ec 04             	sub    $0x4,%esp
+  801802:	6a 07                	push   $0x7
+  801804:	68 00 f0 7f 00       	push   $0x7ff000
+  801809:	50                   	push   %eax
+  80180a:	e8 10 f7 ff ff       	call   800f1f <sys_page_alloc>
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	85 c0                	test   %eax,%eax
+  801814:	78 74                	js     80188a <pgfault+0xbb>
+  801816:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80181c:	83 ec 04             	sub    $0x4,%esp
+  80181f:	68 00 10 00 00       	push   $0x1000
+  801824:	56                   	push   %esi
+  801825:	68 00 f0 7f 00       	push   $0x7ff000
+  80182a:	e8 40 f4 ff ff       	call   800c6f <memmove>
+  80182f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801836:	56                   	push   %esi
+  801837:	53                   	push   %ebx
+  801838:	68 00 f0 7f 00       	push   $0x7ff000
+  80183d:	53                   	push   %ebx
+  80183e:	e8 1f f7 ff ff       	call   800f62 <sys_page_map>
+  801843:	83 c4 20             	add    $0x20,%esp
+  801846:	85 c0                	test   %eax,%eax
+  801848:	78 54                	js     80189e <pgfault+0xcf>
+  80184a:	83 ec 08             	sub    $0x8,%esp
+  80184d:	68 00 f0 7f 00       	push   $0x7ff000
+  801852:	53                   	push   %ebx
+  801853:	e8 99 f7 ff ff       	call   800ff1 <sys_page_unmap>
+  801858:	83 c4 10             	add    $0x10,%esp
+  80185b:	85 c0                	test   %eax,%eax
+  80185d:	78 53                	js     8018b2 <pgfault+0xe3>
+  80185f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801862:	5b                   	pop    %ebx
+  801863:	5e                   	pop    %esi
+  801864:	5d                   	pop    %ebp
+  801865:	c3                   	ret
+  801866:	56                   	push   %esi
+  801867:	68 18 3e 80 00       	push   $0x803e18
+  80186c:	6a 19                	push   $0x19
+  80186e:	68 f4 3e 80 00       	push   $0x803ef4
+  801873:	e8 75 ea ff ff       	call   8002ed <_panic>
+  801878:	56                   	push   %esi
+  801879:	68 4c 3e 80 00       	push   $0x803e4c
+  80187e:	6a 1e                	push   $0x1e
+  801880:	68 f4 3e 80 00       	push   $0x803ef4
+  801885:	e8 63 ea ff ff       	call   8002ed <_panic>
+  80188a:	83 ec 04             	sub    $0x4,%esp
+  80188d:	68 80 3e 80 00       	push   $0x803e80
+  801892:	6a 2e                	push   $0x2e
+  801894:	68 f4 3e 80 00       	push   $0x803ef4
+  801899:	e8 4f ea ff ff       	call   8002ed <_panic>
+  80189e:	83 ec 04             	sub    $0x4,%esp
+  8018a1:	68 a4 3e 80 00       	push   $0x803ea4
+  8018a6:	6a 37                	push   $0x37
+  8018a8:	68 f4 3e 80 00       	push   $0x803ef4
+  8018ad:	e8 3b ea ff ff       	call   8002ed <_panic>
+  8018b2:	83 ec 04             	sub    $0x4,%esp
+  8018b5:	68 d0 3e 80 00       	push   $0x803ed0
+  8018ba:	6a 3c                	push   $0x3c
+  8018bc:	68 f4 3e 80 00       	push   $0x803ef4
+  8018c1:	e8 27 ea ff ff       	call   8002ed <_panic>
+
+008018c6 <dupq_begin>:
+  8018c6:	55                   	push   %ebp
+  8018c7:	89 e5                	mov    %esp,%ebp
+  8018c9:	83 ec 0c             	sub    $0xc,%esp
+  8018cc:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8018d3:	00 00 00 
+  8018d6:	6a 07                	push   $0x7
+  8018d8:	68 00 00 40 00       	push   $0x400000
+  8018dd:	6a 00                	push   $0x0
+  8018df:	e8 3b f6 ff ff       	call   800f1f <sys_page_alloc>
+  8018e4:	c9                   	leave
+  8018e5:	c3                   	ret
+
+008018e6 <dupq_map>:
+  8018e6:	55                   	push   %ebp
+  8018e7:	89 e5                	mov    %esp,%ebp
+  8018e9:	83 ec 08             	sub    $0x8,%esp
+  8018ec:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  8018f3:	00 00 00 
+  8018f6:	74 46                	je     80193e <dupq_map+0x58>
+  8018f8:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8018fe:	8d 42 01             	lea    0x1(%edx),%eax
+  801901:	a3 00 60 80 00       	mov    %eax,0x806000
+  801906:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801909:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80190f:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801916:	00 00 00 
+  801919:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191c:	89 50 04             	mov    %edx,0x4(%eax)
+  80191f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801922:	c1 e2 0c             	shl    $0xc,%edx
+  801925:	89 50 08             	mov    %edx,0x8(%eax)
+  801928:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80192b:	89 48 0c             	mov    %ecx,0xc(%eax)
+  80192e:	89 50 10             	mov    %edx,0x10(%eax)
+  801931:	8b 55 14             	mov    0x14(%ebp),%edx
+  801934:	89 50 14             	mov    %edx,0x14(%eax)
+  801937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193c:	c9                   	leave
+  80193d:	c3                   	ret
+  80193e:	e8 4a fe ff ff       	call   80178d <dupq_flush>
+  801943:	85 c0                	test   %eax,%eax
+  801945:	79 b1                	jns    8018f8 <dupq_map+0x12>
+  801947:	eb f3                	jmp    80193c <dupq_map+0x56>
+
+00801949 <dupq_end>:
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	53                   	push   %ebx
+  80194d:	83 ec 04             	sub    $0x4,%esp
+  801950:	e8 38 fe ff ff       	call   80178d <dupq_flush>
+  801955:	89 c3                	mov    %eax,%ebx
+  801957:	83 ec 08             	sub    $0x8,%esp
+  80195a:	68 00 00 40 00       	push   $0x400000
+  80195f:	6a 00                	push   $0x0
+  801961:	e8 8b f6 ff ff       	call   800ff1 <sys_page_unmap>
+  801966:	89 d8                	mov    %ebx,%eax
+  801968:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80196b:	c9                   	leave
+  80196c:	c3                   	ret
+
+0080196d <fork>:
+  80196d:	55                   	push   %ebp
+  80196e:	89 e5                	mov    %esp,%ebp
+  801970:	53                   	push   %ebx
+  801971:	83 ec 10             	sub    $0x10,%esp
+  801974:	68 cf 17 80 00       	push   $0x8017cf
+  801979:	e8 01 1b 00 00       	call   80347f <set_pgfault_handler>
+  80197e:	83 c4 08             	add    $0x8,%esp
+  801981:	6a 01                	push   $0x1
+  801983:	6a 00                	push   $0x0
+  801985:	e8 4c f7 ff ff       	call   8010d6 <sys_env_set_cow>
+  80198a:	e8 a4 f6 ff ff       	call   801033 <sys_fork>
+  80198f:	89 c3                	mov    %eax,%ebx
+  801991:	83 c4 10             	add    $0x10,%esp
+  801994:	85 c0                	test   %eax,%eax
+  801996:	74 07                	je     80199f <fork+0x32>
+  801998:	89 d8                	mov    %ebx,%eax
+  80199a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80199d:	c9                   	leave
+  80199e:	c3                   	ret
+  80199f:	e8 11 f5 ff ff       	call   800eb5 <sys_getenvid>
+  8019a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019a9:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8019af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019b4:	a3 14 60 80 00       	mov    %eax,0x806014
+  8019b9:	eb dd                	jmp    801998 <fork+0x2b>
+
+008019bb <sfork>:
+  8019bb:	55                   	push   %ebp
+  8019bc:	89 e5                	mov    %esp,%ebp
+  8019be:	57                   	push   %edi
+  8019bf:	56                   	push   %esi
+  8019c0:	53                   	push   %ebx
+  8019c1:	83 ec 1c             	sub    $0x1c,%esp
+  8019c4:	e8 ec f4 ff ff       	call   800eb5 <sys_getenvid>
+  8019c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+  8019cf:	68 cf 17 80 00       	push   $0x8017cf
+  8019d4:	e8 a6 1a 00 00       	call   80347f <set_pgfault_handler>
+  8019d9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019de:	cd 30                	int    $0x30
+  8019e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8019e3:	83 c4 10             	add    $0x10,%esp
+  8019e6:	85 c0                	test   %eax,%eax
+  8019e8:	0f 88 45 02 00 00    	js     801c33 <sfork+0x278>
+  8019ee:	89 c6                	mov    %eax,%esi
+  8019f0:	74 17                	je     801a09 <sfork+0x4e>
+  8019f2:	e8 cf fe ff ff       	call   8018c6 <dupq_begin>
+  8019f7:	85 c0                	test   %eax,%eax
+  8019f9:	0f 88 40 02 00 00    	js     801c3f <sfork+0x284>
+  8019ff:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a04:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801a07:	eb 39                	jmp    801a42 <sfork+0x87>
+  801a09:	e8 a7 f4 ff ff       	call   800eb5 <sys_getenvid>
+  801a0e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a13:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801a19:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a1e:	a3 14 60 80 00       	mov    %eax,0x806014
+  801a23:	e9 23 01 00 00       	jmp    801b4b <sfork+0x190>
+  801a28:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a2f:	a8 01                	test   $0x1,%al
+  801a31:	75 5b                	jne    801a8e <sfork+0xd3>
+  801a33:	83 c7 01             	add    $0x1,%edi
+  801a36:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801a3c:	0f 84 40 01 00 00    	je     801b82 <sfork+0x1c7>
+  801a42:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a49:	a8 01                	test   $0x1,%al
+  801a4b:	74 db                	je     801a28 <sfork+0x6d>
+  801a4d:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a54:	a8 80                	test   $0x80,%al
+  801a56:	74 d0                	je     801a28 <sfork+0x6d>
+  801a58:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a5f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a64:	0c 80                	or     $0x80,%al
+  801a66:	50                   	push   %eax
+  801a67:	ff 75 e4             	push   -0x1c(%ebp)
+  801a6a:	89 f8                	mov    %edi,%eax
+  801a6c:	c1 e0 16             	shl    $0x16,%eax
+  801a6f:	c1 e8 0c             	shr    $0xc,%eax
+  801a72:	50                   	push   %eax
+  801a73:	ff 75 e0             	push   -0x20(%ebp)
+  801a76:	e8 6b fe ff ff       	call   8018e6 <dupq_map>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	79 b1                	jns    801a33 <sfork+0x78>
+  801a82:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a89:	e9 bd 00 00 00       	jmp    801b4b <sfork+0x190>
+  801a8e:	89 fe                	mov    %edi,%esi
+  801a90:	c1 e6 16             	shl    $0x16,%esi
+  801a93:	89 f0                	mov    %esi,%eax
+  801a95:	c1 e8 0c             	shr    $0xc,%eax
+  801a98:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801a9d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801aa0:	eb 57                	jmp    801af9 <sfork+0x13e>
+  801aa2:	e8 0e f4 ff ff       	call   800eb5 <sys_getenvid>
+  801aa7:	89 c7                	mov    %eax,%edi
+  801aa9:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801aae:	f6 c4 04             	test   $0x4,%ah
+  801ab1:	0f 85 9f 00 00 00    	jne    801b56 <sfork+0x19b>
+  801ab7:	a9 02 08 00 00       	test   $0x802,%eax
+  801abc:	0f 85 c5 01 00 00    	jne    801c87 <sfork+0x2cc>
+  801ac2:	6a 05                	push   $0x5
+  801ac4:	ff 75 e4             	push   -0x1c(%ebp)
+  801ac7:	68 fd e7 0e 00       	push   $0xee7fd
+  801acc:	57                   	push   %edi
+  801acd:	e8 14 fe ff ff       	call   8018e6 <dupq_map>
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801adb:	0f 84 91 00 00 00    	je     801b72 <sfork+0x1b7>
+  801ae1:	89 f0                	mov    %esi,%eax
+  801ae3:	09 d8                	or     %ebx,%eax
+  801ae5:	c1 e8 0c             	shr    $0xc,%eax
+  801ae8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801aee:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801af3:	0f 84 81 00 00 00    	je     801b7a <sfork+0x1bf>
+  801af9:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801afe:	74 a2                	je     801aa2 <sfork+0xe7>
+  801b00:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b07:	f6 c2 01             	test   $0x1,%dl
+  801b0a:	74 c9                	je     801ad5 <sfork+0x11a>
+  801b0c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b13:	f6 c6 02             	test   $0x2,%dh
+  801b16:	75 bd                	jne    801ad5 <sfork+0x11a>
+  801b18:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801b1f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b26:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801b2c:	f7 d2                	not    %edx
+  801b2e:	21 ca                	and    %ecx,%edx
+  801b30:	52                   	push   %edx
+  801b31:	ff 75 e4             	push   -0x1c(%ebp)
+  801b34:	50                   	push   %eax
+  801b35:	ff 75 e0             	push   -0x20(%ebp)
+  801b38:	e8 a9 fd ff ff       	call   8018e6 <dupq_map>
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	79 91                	jns    801ad5 <sfork+0x11a>
+  801b44:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b51:	5b                   	pop    %ebx
+  801b52:	5e                   	pop    %esi
+  801b53:	5f                   	pop    %edi
+  801b54:	5d                   	pop    %ebp
+  801b55:	c3                   	ret
+  801b56:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b5b:	50                   	push   %eax
+  801b5c:	ff 75 e4             	push   -0x1c(%ebp)
+  801b5f:	68 fd e7 0e 00       	push   $0xee7fd
+  801b64:	57                   	push   %edi
+  801b65:	e8 7c fd ff ff       	call   8018e6 <dupq_map>
+  801b6a:	83 c4 10             	add    $0x10,%esp
+  801b6d:	e9 63 ff ff ff       	jmp    801ad5 <sfork+0x11a>
+  801b72:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b75:	e9 b9 fe ff ff       	jmp    801a33 <sfork+0x78>
+  801b7a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b7d:	e9 b1 fe ff ff       	jmp    801a33 <sfork+0x78>
+  801b82:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801b85:	e8 bf fd ff ff       	call   801949 <dupq_end>
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	0f 88 b9 00 00 00    	js     801c4b <sfork+0x290>
+  801b92:	83 ec 04             	sub    $0x4,%esp
+  801b95:	6a 07                	push   $0x7
+  801b97:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b9c:	56                   	push   %esi
+  801b9d:	e8 7d f3 ff ff       	call   800f1f <sys_page_alloc>
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	0f 88 aa 00 00 00    	js     801c57 <sfork+0x29c>
+  801bad:	83 ec 0c             	sub    $0xc,%esp
+  801bb0:	6a 07                	push   $0x7
+  801bb2:	68 00 f0 7f 00       	push   $0x7ff000
+  801bb7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801bba:	57                   	push   %edi
+  801bbb:	68 00 f0 7f ee       	push   $0xee7ff000
+  801bc0:	56                   	push   %esi
+  801bc1:	e8 9c f3 ff ff       	call   800f62 <sys_page_map>
+  801bc6:	83 c4 20             	add    $0x20,%esp
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	0f 88 92 00 00 00    	js     801c63 <sfork+0x2a8>
+  801bd1:	83 ec 04             	sub    $0x4,%esp
+  801bd4:	68 00 10 00 00       	push   $0x1000
+  801bd9:	68 00 f0 7f 00       	push   $0x7ff000
+  801bde:	68 00 f0 7f ee       	push   $0xee7ff000
+  801be3:	e8 87 f0 ff ff       	call   800c6f <memmove>
+  801be8:	83 c4 08             	add    $0x8,%esp
+  801beb:	68 00 f0 7f 00       	push   $0x7ff000
+  801bf0:	57                   	push   %edi
+  801bf1:	e8 fb f3 ff ff       	call   800ff1 <sys_page_unmap>
+  801bf6:	83 c4 10             	add    $0x10,%esp
+  801bf9:	85 c0                	test   %eax,%eax
+  801bfb:	78 72                	js     801c6f <sfork+0x2b4>
+  801bfd:	83 ec 08             	sub    $0x8,%esp
+  801c00:	68 f7 34 80 00       	push   $0x8034f7
+  801c05:	56                   	push   %esi
+  801c06:	e8 2d f5 ff ff       	call   801138 <sys_env_set_pgfault_upcall>
+  801c0b:	83 c4 10             	add    $0x10,%esp
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	78 69                	js     801c7b <sfork+0x2c0>
+  801c12:	83 ec 08             	sub    $0x8,%esp
+  801c15:	6a 02                	push   $0x2
+  801c17:	56                   	push   %esi
+  801c18:	e8 35 f4 ff ff       	call   801052 <sys_env_set_status>
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c27:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801c2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c2e:	e9 18 ff ff ff       	jmp    801b4b <sfork+0x190>
+  801c33:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c3a:	e9 0c ff ff ff       	jmp    801b4b <sfork+0x190>
+  801c3f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c46:	e9 00 ff ff ff       	jmp    801b4b <sfork+0x190>
+  801c4b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c52:	e9 f4 fe ff ff       	jmp    801b4b <sfork+0x190>
+  801c57:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c5e:	e9 e8 fe ff ff       	jmp    801b4b <sfork+0x190>
+  801c63:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c6a:	e9 dc fe ff ff       	jmp    801b4b <sfork+0x190>
+  801c6f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c76:	e9 d0 fe ff ff       	jmp    801b4b <sfork+0x190>
+  801c7b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c82:	e9 c4 fe ff ff       	jmp    801b4b <sfork+0x190>
+  801c87:	68 05 08 00 00       	push   $0x805
+  801c8c:	ff 75 e4             	push   -0x1c(%ebp)
+  801c8f:	68 fd e7 0e 00       	push   $0xee7fd
+  801c94:	57                   	push   %edi
+  801c95:	e8 4c fc ff ff       	call   8018e6 <dupq_map>
+  801c9a:	83 c4 10             	add    $0x10,%esp
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	0f 88 30 fe ff ff    	js     801ad5 <sfork+0x11a>
+  801ca5:	68 05 08 00 00       	push   $0x805
+  801caa:	57                   	push   %edi
+  801cab:	68 fd e7 0e 00       	push   $0xee7fd
+  801cb0:	57                   	push   %edi
+  801cb1:	e8 30 fc ff ff       	call   8018e6 <dupq_map>
+  801cb6:	83 c4 10             	add    $0x10,%esp
+  801cb9:	e9 17 fe ff ff       	jmp    801ad5 <sfork+0x11a>
+
+00801cbe <fd2num>:
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc4:	05 00 00 00 30       	add    $0x30000000,%eax
+  801cc9:	c1 e8 0c             	shr    $0xc,%eax
+  801ccc:	5d                   	pop    %ebp
+  801ccd:	c3                   	ret
+
+00801cce <fd2data>:
+  801cce:	55                   	push   %ebp
+  801ccf:	89 e5                	mov    %esp,%ebp
+  801cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd4:	05 00 00 00 30       	add    $0x30000000,%eax
+  801cd9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801cde:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801ce3:	5d                   	pop    %ebp
+  801ce4:	c3                   	ret
+
+00801ce5 <fd_alloc>:
+  801ce5:	55                   	push   %ebp
+  801ce6:	89 e5                	mov    %esp,%ebp
+  801ce8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801ced:	89 c2                	mov    %eax,%edx
+  801cef:	c1 ea 16             	shr    $0x16,%edx
+  801cf2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cf9:	f6 c2 01             	test   $0x1,%dl
+  801cfc:	74 29                	je     801d27 <fd_alloc+0x42>
+  801cfe:	89 c2                	mov    %eax,%edx
+  801d00:	c1 ea 0c             	shr    $0xc,%edx
+  801d03:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d0a:	f6 c2 01             	test   $0x1,%dl
+  801d0d:	74 18                	je     801d27 <fd_alloc+0x42>
+  801d0f:	05 00 10 00 00       	add    $0x1000,%eax
+  801d14:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801d19:	75 d2                	jne    801ced <fd_alloc+0x8>
+  801d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d20:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d25:	eb 05                	jmp    801d2c <fd_alloc+0x47>
+  801d27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2f:	89 02                	mov    %eax,(%edx)
+  801d31:	89 c8                	mov    %ecx,%eax
+  801d33:	5d                   	pop    %ebp
+  801d34:	c3                   	ret
+
+00801d35 <fd_lookup>:
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3b:	83 f8 1f             	cmp    $0x1f,%eax
+  801d3e:	77 30                	ja     801d70 <fd_lookup+0x3b>
+  801d40:	c1 e0 0c             	shl    $0xc,%eax
+  801d43:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801d48:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801d4e:	f6 c2 01             	test   $0x1,%dl
+  801d51:	74 24                	je     801d77 <fd_lookup+0x42>
+  801d53:	89 c2                	mov    %eax,%edx
+  801d55:	c1 ea 0c             	shr    $0xc,%edx
+  801d58:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d5f:	f6 c2 01             	test   $0x1,%dl
+  801d62:	74 1a                	je     801d7e <fd_lookup+0x49>
+  801d64:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d67:	89 02                	mov    %eax,(%edx)
+  801d69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6e:	5d                   	pop    %ebp
+  801d6f:	c3                   	ret
+  801d70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d75:	eb f7                	jmp    801d6e <fd_lookup+0x39>
+  801d77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d7c:	eb f0                	jmp    801d6e <fd_lookup+0x39>
+  801d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d83:	eb e9                	jmp    801d6e <fd_lookup+0x39>
+
+00801d85 <dev_lookup>:
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	53                   	push   %ebx
+  801d89:	83 ec 04             	sub    $0x4,%esp
+  801d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d94:	bb 08 50 80 00       	mov    $0x805008,%ebx
+  801d99:	39 13                	cmp    %edx,(%ebx)
+  801d9b:	74 37                	je     801dd4 <dev_lookup+0x4f>
+  801d9d:	83 c0 01             	add    $0x1,%eax
+  801da0:	8b 1c 85 7c 3f 80 00 	mov    0x803f7c(,%eax,4),%ebx
+  801da7:	85 db                	test   %ebx,%ebx
+  801da9:	75 ee                	jne    801d99 <dev_lookup+0x14>
+  801dab:	a1 14 60 80 00       	mov    0x806014,%eax
+  801db0:	8b 40 48             	mov    0x48(%eax),%eax
+  801db3:	83 ec 04             	sub    $0x4,%esp
+  801db6:	52                   	push   %edx
+  801db7:	50                   	push   %eax
+  801db8:	68 00 3f 80 00       	push   $0x803f00
+  801dbd:	e8 06 e6 ff ff       	call   8003c8 <cprintf>
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dcd:	89 1a                	mov    %ebx,(%edx)
+  801dcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dd2:	c9                   	leave
+  801dd3:	c3                   	ret
+  801dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd9:	eb ef                	jmp    801dca <dev_lookup+0x45>
+
+00801ddb <fd_close>:
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	57                   	push   %edi
+  801ddf:	56                   	push   %esi
+  801de0:	53                   	push   %ebx
+  801de1:	83 ec 24             	sub    $0x24,%esp
+  801de4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801de7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801dea:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ded:	50                   	push   %eax
+  801dee:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801df4:	c1 e8 0c             	shr    $0xc,%eax
+  801df7:	50                   	push   %eax
+  801df8:	e8 38 ff ff ff       	call   801d35 <fd_lookup>
+  801dfd:	89 c3                	mov    %eax,%ebx
+  801dff:	83 c4 10             	add    $0x10,%esp
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	78 05                	js     801e0b <fd_close+0x30>
+  801e06:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e09:	74 0f                	je     801e1a <fd_close+0x3f>
+  801e0b:	85 ff                	test   %edi,%edi
+  801e0d:	0f 44 df             	cmove  %edi,%ebx
+  801e10:	89 d8                	mov    %ebx,%eax
+  801e12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e15:	5b                   	pop    %ebx
+  801e16:	5e                   	pop    %esi
+  801e17:	5f                   	pop    %edi
+  801e18:	5d                   	pop    %ebp
+  801e19:	c3                   	ret
+  801e1a:	83 ec 08             	sub    $0x8,%esp
+  801e1d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e20:	50                   	push   %eax
+  801e21:	ff 36                	push   (%esi)
+  801e23:	e8 5d ff ff ff       	call   801d85 <dev_lookup>
+  801e28:	89 c3                	mov    %eax,%ebx
+  801e2a:	83 c4 10             	add    $0x10,%esp
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 1a                	js     801e4b <fd_close+0x70>
+  801e31:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e34:	8b 40 10             	mov    0x10(%eax),%eax
+  801e37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e3c:	85 c0                	test   %eax,%eax
+  801e3e:	74 0b                	je     801e4b <fd_close+0x70>
+  801e40:	83 ec 0c             	sub    $0xc,%esp
+  801e43:	56                   	push   %esi
+  801e44:	ff d0                	call   *%eax
+  801e46:	89 c3                	mov    %eax,%ebx
+  801e48:	83 c4 10             	add    $0x10,%esp
+  801e4b:	83 ec 08             	sub    $0x8,%esp
+  801e4e:	56                   	push   %esi
+  801e4f:	6a 00                	push   $0x0
+  801e51:	e8 9b f1 ff ff       	call   800ff1 <sys_page_unmap>
+  801e56:	83 c4 10             	add    $0x10,%esp
+  801e59:	eb b5                	jmp    801e10 <fd_close+0x35>
+
+00801e5b <close>:
+  801e5b:	55                   	push   %ebp
+  801e5c:	89 e5                	mov    %esp,%ebp
+  801e5e:	83 ec 20             	sub    $0x20,%esp
+  801e61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e64:	50                   	push   %eax
+  801e65:	ff 75 08             	push   0x8(%ebp)
+  801e68:	e8 c8 fe ff ff       	call   801d35 <fd_lookup>
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	79 02                	jns    801e76 <close+0x1b>
+  801e74:	c9                   	leave
+  801e75:	c3                   	ret
+  801e76:	83 ec 08             	sub    $0x8,%esp
+  801e79:	6a 01                	push   $0x1
+  801e7b:	ff 75 f4             	push   -0xc(%ebp)
+  801e7e:	e8 58 ff ff ff       	call   801ddb <fd_close>
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	eb ec                	jmp    801e74 <close+0x19>
+
+00801e88 <close_all>:
+  801e88:	55                   	push   %ebp
+  801e89:	89 e5                	mov    %esp,%ebp
+  801e8b:	53                   	push   %ebx
+  801e8c:	83 ec 04             	sub    $0x4,%esp
+  801e8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e94:	83 ec 0c             	sub    $0xc,%esp
+  801e97:	53                   	push   %ebx
+  801e98:	e8 be ff ff ff       	call   801e5b <close>
+  801e9d:	83 c3 01             	add    $0x1,%ebx
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	83 fb 20             	cmp    $0x20,%ebx
+  801ea6:	75 ec                	jne    801e94 <close_all+0xc>
+  801ea8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eab:	c9                   	leave
+  801eac:	c3                   	ret
+
+00801ead <dup>:
+  801ead:	55                   	push   %ebp
+  801eae:	89 e5                	mov    %esp,%ebp
+  801eb0:	57                   	push   %edi
+  801eb1:	56                   	push   %esi
+  801eb2:	53                   	push   %ebx
+  801eb3:	83 ec 34             	sub    $0x34,%esp
+  801eb6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eb9:	50                   	push   %eax
+  801eba:	ff 75 08             	push   0x8(%ebp)
+  801ebd:	e8 73 fe ff ff       	call   801d35 <fd_lookup>
+  801ec2:	89 c3                	mov    %eax,%ebx
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 7f                	js     801f4a <dup+0x9d>
+  801ecb:	83 ec 0c             	sub    $0xc,%esp
+  801ece:	ff 75 0c             	push   0xc(%ebp)
+  801ed1:	e8 85 ff ff ff       	call   801e5b <close>
+  801ed6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ed9:	c1 e6 0c             	shl    $0xc,%esi
+  801edc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801ee2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ee5:	89 3c 24             	mov    %edi,(%esp)
+  801ee8:	e8 e1 fd ff ff       	call   801cce <fd2data>
+  801eed:	89 c3                	mov    %eax,%ebx
+  801eef:	89 34 24             	mov    %esi,(%esp)
+  801ef2:	e8 d7 fd ff ff       	call   801cce <fd2data>
+  801ef7:	83 c4 10             	add    $0x10,%esp
+  801efa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801efd:	89 d8                	mov    %ebx,%eax
+  801eff:	c1 e8 16             	shr    $0x16,%eax
+  801f02:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f09:	a8 01                	test   $0x1,%al
+  801f0b:	74 11                	je     801f1e <dup+0x71>
+  801f0d:	89 d8                	mov    %ebx,%eax
+  801f0f:	c1 e8 0c             	shr    $0xc,%eax
+  801f12:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f19:	f6 c2 01             	test   $0x1,%dl
+  801f1c:	75 36                	jne    801f54 <dup+0xa7>
+  801f1e:	89 f8                	mov    %edi,%eax
+  801f20:	c1 e8 0c             	shr    $0xc,%eax
+  801f23:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f2a:	83 ec 0c             	sub    $0xc,%esp
+  801f2d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f32:	50                   	push   %eax
+  801f33:	56                   	push   %esi
+  801f34:	6a 00                	push   $0x0
+  801f36:	57                   	push   %edi
+  801f37:	6a 00                	push   $0x0
+  801f39:	e8 24 f0 ff ff       	call   800f62 <sys_page_map>
+  801f3e:	89 c3                	mov    %eax,%ebx
+  801f40:	83 c4 20             	add    $0x20,%esp
+  801f43:	85 c0                	test   %eax,%eax
+  801f45:	78 33                	js     801f7a <dup+0xcd>
+  801f47:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f4a:	89 d8                	mov    %ebx,%eax
+  801f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f4f:	5b                   	pop    %ebx
+  801f50:	5e                   	pop    %esi
+  801f51:	5f                   	pop    %edi
+  801f52:	5d                   	pop    %ebp
+  801f53:	c3                   	ret
+  801f54:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f5b:	83 ec 0c             	sub    $0xc,%esp
+  801f5e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f63:	50                   	push   %eax
+  801f64:	ff 75 d4             	push   -0x2c(%ebp)
+  801f67:	6a 00                	push   $0x0
+  801f69:	53                   	push   %ebx
+  801f6a:	6a 00                	push   $0x0
+  801f6c:	e8 f1 ef ff ff       	call   800f62 <sys_page_map>
+  801f71:	89 c3                	mov    %eax,%ebx
+  801f73:	83 c4 20             	add    $0x20,%esp
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	79 a4                	jns    801f1e <dup+0x71>
+  801f7a:	83 ec 08             	sub    $0x8,%esp
+  801f7d:	56                   	push   %esi
+  801f7e:	6a 00                	push   $0x0
+  801f80:	e8 6c f0 ff ff       	call   800ff1 <sys_page_unmap>
+  801f85:	83 c4 08             	add    $0x8,%esp
+  801f88:	ff 75 d4             	push   -0x2c(%ebp)
+  801f8b:	6a 00                	push   $0x0
+  801f8d:	e8 5f f0 ff ff       	call   800ff1 <sys_page_unmap>
+  801f92:	83 c4 10             	add    $0x10,%esp
+  801f95:	eb b3                	jmp    801f4a <dup+0x9d>
+
+00801f97 <read>:
+  801f97:	55                   	push   %ebp
+  801f98:	89 e5                	mov    %esp,%ebp
+  801f9a:	56                   	push   %esi
+  801f9b:	53                   	push   %ebx
+  801f9c:	83 ec 18             	sub    $0x18,%esp
+  801f9f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fa2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fa5:	50                   	push   %eax
+  801fa6:	56                   	push   %esi
+  801fa7:	e8 89 fd ff ff       	call   801d35 <fd_lookup>
+  801fac:	83 c4 10             	add    $0x10,%esp
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	78 3c                	js     801fef <read+0x58>
+  801fb3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801fb6:	83 ec 08             	sub    $0x8,%esp
+  801fb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fbc:	50                   	push   %eax
+  801fbd:	ff 33                	push   (%ebx)
+  801fbf:	e8 c1 fd ff ff       	call   801d85 <dev_lookup>
+  801fc4:	83 c4 10             	add    $0x10,%esp
+  801fc7:	85 c0                	test   %eax,%eax
+  801fc9:	78 24                	js     801fef <read+0x58>
+  801fcb:	8b 43 08             	mov    0x8(%ebx),%eax
+  801fce:	83 e0 03             	and    $0x3,%eax
+  801fd1:	83 f8 01             	cmp    $0x1,%eax
+  801fd4:	74 20                	je     801ff6 <read+0x5f>
+  801fd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fd9:	8b 40 08             	mov    0x8(%eax),%eax
+  801fdc:	85 c0                	test   %eax,%eax
+  801fde:	74 37                	je     802017 <read+0x80>
+  801fe0:	83 ec 04             	sub    $0x4,%esp
+  801fe3:	ff 75 10             	push   0x10(%ebp)
+  801fe6:	ff 75 0c             	push   0xc(%ebp)
+  801fe9:	53                   	push   %ebx
+  801fea:	ff d0                	call   *%eax
+  801fec:	83 c4 10             	add    $0x10,%esp
+  801fef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff2:	5b                   	pop    %ebx
+  801ff3:	5e                   	pop    %esi
+  801ff4:	5d                   	pop    %ebp
+  801ff5:	c3                   	ret
+  801ff6:	a1 14 60 80 00       	mov    0x806014,%eax
+  801ffb:	8b 40 48             	mov    0x48(%eax),%eax
+  801ffe:	83 ec 04             	sub    $0x4,%esp
+  802001:	56                   	push   %esi
+  802002:	50                   	push   %eax
+  802003:	68 41 3f 80 00       	push   $0x803f41
+  802008:	e8 bb e3 ff ff       	call   8003c8 <cprintf>
+  80200d:	83 c4 10             	add    $0x10,%esp
+  802010:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802015:	eb d8                	jmp    801fef <read+0x58>
+  802017:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80201c:	eb d1                	jmp    801fef <read+0x58>
+
+0080201e <readn>:
+  80201e:	55                   	push   %ebp
+  80201f:	89 e5                	mov    %esp,%ebp
+  802021:	57                   	push   %edi
+  802022:	56                   	push   %esi
+  802023:	53                   	push   %ebx
+  802024:	83 ec 0c             	sub    $0xc,%esp
+  802027:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80202a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80202d:	85 f6                	test   %esi,%esi
+  80202f:	74 30                	je     802061 <readn+0x43>
+  802031:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203b:	83 ec 04             	sub    $0x4,%esp
+  80203e:	89 f2                	mov    %esi,%edx
+  802040:	29 c2                	sub    %eax,%edx
+  802042:	52                   	push   %edx
+  802043:	01 f8                	add    %edi,%eax
+  802045:	50                   	push   %eax
+  802046:	ff 75 08             	push   0x8(%ebp)
+  802049:	e8 49 ff ff ff       	call   801f97 <read>
+  80204e:	83 c4 10             	add    $0x10,%esp
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 15                	js     80206a <readn+0x4c>
+  802055:	74 11                	je     802068 <readn+0x4a>
+  802057:	01 c3                	add    %eax,%ebx
+  802059:	89 d8                	mov    %ebx,%eax
+  80205b:	39 f3                	cmp    %esi,%ebx
+  80205d:	72 dc                	jb     80203b <readn+0x1d>
+  80205f:	eb 09                	jmp    80206a <readn+0x4c>
+  802061:	b8 00 00 00 00       	mov    $0x0,%eax
+  802066:	eb 02                	jmp    80206a <readn+0x4c>
+  802068:	89 d8                	mov    %ebx,%eax
+  80206a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206d:	5b                   	pop    %ebx
+  80206e:	5e                   	pop    %esi
+  80206f:	5f                   	pop    %edi
+  802070:	5d                   	pop    %ebp
+  802071:	c3                   	ret
+
+00802072 <write>:
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	56                   	push   %esi
+  802076:	53                   	push   %ebx
+  802077:	83 ec 18             	sub    $0x18,%esp
+  80207a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80207d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802080:	50                   	push   %eax
+  802081:	53                   	push   %ebx
+  802082:	e8 ae fc ff ff       	call   801d35 <fd_lookup>
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	85 c0                	test   %eax,%eax
+  80208c:	78 37                	js     8020c5 <write+0x53>
+  80208e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802091:	83 ec 08             	sub    $0x8,%esp
+  802094:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802097:	50                   	push   %eax
+  802098:	ff 36                	push   (%esi)
+  80209a:	e8 e6 fc ff ff       	call   801d85 <dev_lookup>
+  80209f:	83 c4 10             	add    $0x10,%esp
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	78 1f                	js     8020c5 <write+0x53>
+  8020a6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8020aa:	74 20                	je     8020cc <write+0x5a>
+  8020ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020af:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	74 37                	je     8020ed <write+0x7b>
+  8020b6:	83 ec 04             	sub    $0x4,%esp
+  8020b9:	ff 75 10             	push   0x10(%ebp)
+  8020bc:	ff 75 0c             	push   0xc(%ebp)
+  8020bf:	56                   	push   %esi
+  8020c0:	ff d0                	call   *%eax
+  8020c2:	83 c4 10             	add    $0x10,%esp
+  8020c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c8:	5b                   	pop    %ebx
+  8020c9:	5e                   	pop    %esi
+  8020ca:	5d                   	pop    %ebp
+  8020cb:	c3                   	ret
+  8020cc:	a1 14 60 80 00       	mov    0x806014,%eax
+  8020d1:	8b 40 48             	mov    0x48(%eax),%eax
+  8020d4:	83 ec 04             	sub    $0x4,%esp
+  8020d7:	53                   	push   %ebx
+  8020d8:	50                   	push   %eax
+  8020d9:	68 5d 3f 80 00       	push   $0x803f5d
+  8020de:	e8 e5 e2 ff ff       	call   8003c8 <cprintf>
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020eb:	eb d8                	jmp    8020c5 <write+0x53>
+  8020ed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020f2:	eb d1                	jmp    8020c5 <write+0x53>
+
+008020f4 <seek>:
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	83 ec 20             	sub    $0x20,%esp
+  8020fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020fd:	50                   	push   %eax
+  8020fe:	ff 75 08             	push   0x8(%ebp)
+  802101:	e8 2f fc ff ff       	call   801d35 <fd_lookup>
+  802106:	83 c4 10             	add    $0x10,%esp
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 0e                	js     80211b <seek+0x27>
+  80210d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802110:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802113:	89 50 04             	mov    %edx,0x4(%eax)
+  802116:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211b:	c9                   	leave
+  80211c:	c3                   	ret
+
+0080211d <ftruncate>:
+  80211d:	55                   	push   %ebp
+  80211e:	89 e5                	mov    %esp,%ebp
+  802120:	56                   	push   %esi
+  802121:	53                   	push   %ebx
+  802122:	83 ec 18             	sub    $0x18,%esp
+  802125:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802128:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80212b:	50                   	push   %eax
+  80212c:	53                   	push   %ebx
+  80212d:	e8 03 fc ff ff       	call   801d35 <fd_lookup>
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 34                	js     80216d <ftruncate+0x50>
+  802139:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80213c:	83 ec 08             	sub    $0x8,%esp
+  80213f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802142:	50                   	push   %eax
+  802143:	ff 36                	push   (%esi)
+  802145:	e8 3b fc ff ff       	call   801d85 <dev_lookup>
+  80214a:	83 c4 10             	add    $0x10,%esp
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	78 1c                	js     80216d <ftruncate+0x50>
+  802151:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802155:	74 1d                	je     802174 <ftruncate+0x57>
+  802157:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80215a:	8b 40 18             	mov    0x18(%eax),%eax
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	74 34                	je     802195 <ftruncate+0x78>
+  802161:	83 ec 08             	sub    $0x8,%esp
+  802164:	ff 75 0c             	push   0xc(%ebp)
+  802167:	56                   	push   %esi
+  802168:	ff d0                	call   *%eax
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802170:	5b                   	pop    %ebx
+  802171:	5e                   	pop    %esi
+  802172:	5d                   	pop    %ebp
+  802173:	c3                   	ret
+  802174:	a1 14 60 80 00       	mov    0x806014,%eax
+  802179:	8b 40 48             	mov    0x48(%eax),%eax
+  80217c:	83 ec 04             	sub    $0x4,%esp
+  80217f:	53                   	push   %ebx
+  802180:	50                   	push   %eax
+  802181:	68 20 3f 80 00       	push   $0x803f20
+  802186:	e8 3d e2 ff ff       	call   8003c8 <cprintf>
+  80218b:	83 c4 10             	add    $0x10,%esp
+  80218e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802193:	eb d8                	jmp    80216d <ftruncate+0x50>
+  802195:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80219a:	eb d1                	jmp    80216d <ftruncate+0x50>
+
+0080219c <fstat>:
+  80219c:	55                   	push   %ebp
+  80219d:	89 e5                	mov    %esp,%ebp
+  80219f:	56                   	push   %esi
+  8021a0:	53                   	push   %ebx
+  8021a1:	83 ec 18             	sub    $0x18,%esp
+  8021a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021aa:	50                   	push   %eax
+  8021ab:	ff 75 08             	push   0x8(%ebp)
+  8021ae:	e8 82 fb ff ff       	call   801d35 <fd_lookup>
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	78 49                	js     802203 <fstat+0x67>
+  8021ba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021bd:	83 ec 08             	sub    $0x8,%esp
+  8021c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c3:	50                   	push   %eax
+  8021c4:	ff 36                	push   (%esi)
+  8021c6:	e8 ba fb ff ff       	call   801d85 <dev_lookup>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	85 c0                	test   %eax,%eax
+  8021d0:	78 31                	js     802203 <fstat+0x67>
+  8021d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8021d9:	74 2f                	je     80220a <fstat+0x6e>
+  8021db:	c6 03 00             	movb   $0x0,(%ebx)
+  8021de:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021e5:	00 00 00 
+  8021e8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021ef:	00 00 00 
+  8021f2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8021f8:	83 ec 08             	sub    $0x8,%esp
+  8021fb:	53                   	push   %ebx
+  8021fc:	56                   	push   %esi
+  8021fd:	ff 50 14             	call   *0x14(%eax)
+  802200:	83 c4 10             	add    $0x10,%esp
+  802203:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802206:	5b                   	pop    %ebx
+  802207:	5e                   	pop    %esi
+  802208:	5d                   	pop    %ebp
+  802209:	c3                   	ret
+  80220a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80220f:	eb f2                	jmp    802203 <fstat+0x67>
+
+00802211 <stat>:
+  802211:	55                   	push   %ebp
+  802212:	89 e5                	mov    %esp,%ebp
+  802214:	56                   	push   %esi
+  802215:	53                   	push   %ebx
+  802216:	83 ec 08             	sub    $0x8,%esp
+  802219:	6a 00                	push   $0x0
+  80221b:	ff 75 08             	push   0x8(%ebp)
+  80221e:	e8 31 05 00 00       	call   802754 <open>
+  802223:	89 c3                	mov    %eax,%ebx
+  802225:	83 c4 10             	add    $0x10,%esp
+  802228:	85 c0                	test   %eax,%eax
+  80222a:	78 1b                	js     802247 <stat+0x36>
+  80222c:	83 ec 08             	sub    $0x8,%esp
+  80222f:	ff 75 0c             	push   0xc(%ebp)
+  802232:	50                   	push   %eax
+  802233:	e8 64 ff ff ff       	call   80219c <fstat>
+  802238:	89 c6                	mov    %eax,%esi
+  80223a:	89 1c 24             	mov    %ebx,(%esp)
+  80223d:	e8 19 fc ff ff       	call   801e5b <close>
+  802242:	83 c4 10             	add    $0x10,%esp
+  802245:	89 f3                	mov    %esi,%ebx
+  802247:	89 d8                	mov    %ebx,%eax
+  802249:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224c:	5b                   	pop    %ebx
+  80224d:	5e                   	pop    %esi
+  80224e:	5d                   	pop    %ebp
+  80224f:	c3                   	ret
+
+00802250 <fsipc>:
+  802250:	55                   	push   %ebp
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	56                   	push   %esi
+  802254:	53                   	push   %ebx
+  802255:	89 c3                	mov    %eax,%ebx
+  802257:	89 d6                	mov    %edx,%esi
+  802259:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802260:	74 20                	je     802282 <fsipc+0x32>
+  802262:	83 ec 08             	sub    $0x8,%esp
+  802265:	6a 00                	push   $0x0
+  802267:	56                   	push   %esi
+  802268:	6a 07                	push   $0x7
+  80226a:	68 00 70 80 00       	push   $0x807000
+  80226f:	53                   	push   %ebx
+  802270:	ff 35 0c 60 80 00    	push   0x80600c
+  802276:	e8 5f 13 00 00       	call   8035da <ipc_call>
+  80227b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227e:	5b                   	pop    %ebx
+  80227f:	5e                   	pop    %esi
+  802280:	5d                   	pop    %ebp
+  802281:	c3                   	ret
+  802282:	83 ec 0c             	sub    $0xc,%esp
+  802285:	6a 02                	push   $0x2
+  802287:	e8 e9 14 00 00       	call   803775 <ipc_find_env>
+  80228c:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802291:	83 c4 10             	add    $0x10,%esp
+  802294:	eb cc                	jmp    802262 <fsipc+0x12>
+
+00802296 <devfile_trunc>:
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	83 ec 08             	sub    $0x8,%esp
+  80229c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229f:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022a2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8022a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022aa:	a3 04 70 80 00       	mov    %eax,0x807004
+  8022af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022b9:	e8 92 ff ff ff       	call   802250 <fsipc>
+  8022be:	c9                   	leave
+  8022bf:	c3                   	ret
+
+008022c0 <devfile_flush>:
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	83 ec 08             	sub    $0x8,%esp
+  8022c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022cc:	a3 00 70 80 00       	mov    %eax,0x807000
+  8022d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8022db:	e8 70 ff ff ff       	call   802250 <fsipc>
+  8022e0:	c9                   	leave
+  8022e1:	c3                   	ret
+
+008022e2 <devfile_stat>:
+  8022e2:	55                   	push   %ebp
+  8022e3:	89 e5                	mov    %esp,%ebp
+  8022e5:	53                   	push   %ebx
+  8022e6:	83 ec 04             	sub    $0x4,%esp
+  8022e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022f2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8022f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802301:	e8 4a ff ff ff       	call   802250 <fsipc>
+  802306:	85 c0                	test   %eax,%eax
+  802308:	78 2c                	js     802336 <devfile_stat+0x54>
+  80230a:	83 ec 08             	sub    $0x8,%esp
+  80230d:	68 00 70 80 00       	push   $0x807000
+  802312:	53                   	push   %ebx
+  802313:	e8 a7 e7 ff ff       	call   800abf <strcpy>
+  802318:	a1 80 70 80 00       	mov    0x807080,%eax
+  80231d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802323:	a1 84 70 80 00       	mov    0x807084,%eax
+  802328:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80232e:	83 c4 10             	add    $0x10,%esp
+  802331:	b8 00 00 00 00       	mov    $0x0,%eax
+  802336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+
+0080233b <fsring_rw>:
+  80233b:	55                   	push   %ebp
+  80233c:	89 e5                	mov    %esp,%ebp
+  80233e:	57                   	push   %edi
+  80233f:	56                   	push   %esi
+  802340:	53                   	push   %ebx
+  802341:	83 ec 2c             	sub    $0x2c,%esp
+  802344:	89 c7                	mov    %eax,%edi
+  802346:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802349:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80234c:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802351:	a8 01                	test   $0x1,%al
+  802353:	74 0d                	je     802362 <fsring_rw+0x27>
+  802355:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  80235a:	a8 01                	test   $0x1,%al
+  80235c:	0f 85 d5 00 00 00    	jne    802437 <fsring_rw+0xfc>
+  802362:	a1 14 60 80 00       	mov    0x806014,%eax
+  802367:	8b 40 48             	mov    0x48(%eax),%eax
+  80236a:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  802370:	0f 84 fc 00 00 00    	je     802472 <fsring_rw+0x137>
+  802376:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  80237d:	0f 84 02 01 00 00    	je     802485 <fsring_rw+0x14a>
+  802383:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802388:	83 ec 04             	sub    $0x4,%esp
+  80238b:	68 07 02 00 00       	push   $0x207
+  802390:	53                   	push   %ebx
+  802391:	6a 00                	push   $0x0
+  802393:	e8 87 eb ff ff       	call   800f1f <sys_page_alloc>
+  802398:	83 c4 10             	add    $0x10,%esp
+  80239b:	85 c0                	test   %eax,%eax
+  80239d:	0f 88 f9 00 00 00    	js     80249c <fsring_rw+0x161>
+  8023a3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023a9:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8023af:	75 d7                	jne    802388 <fsring_rw+0x4d>
+  8023b1:	6a 0e                	push   $0xe
+  8023b3:	6a 0d                	push   $0xd
+  8023b5:	ff 35 0c 60 80 00    	push   0x80600c
+  8023bb:	68 00 00 f0 cf       	push   $0xcff00000
+  8023c0:	e8 26 0d 00 00       	call   8030eb <ipcring_init>
+  8023c5:	83 c4 08             	add    $0x8,%esp
+  8023c8:	6a 00                	push   $0x0
+  8023ca:	6a 00                	push   $0x0
+  8023cc:	68 07 02 00 00       	push   $0x207
+  8023d1:	68 00 00 f0 cf       	push   $0xcff00000
+  8023d6:	6a 0b                	push   $0xb
+  8023d8:	ff 35 0c 60 80 00    	push   0x80600c
+  8023de:	e8 f7 11 00 00       	call   8035da <ipc_call>
+  8023e3:	89 c6                	mov    %eax,%esi
+  8023e5:	83 c4 20             	add    $0x20,%esp
+  8023e8:	85 c0                	test   %eax,%eax
+  8023ea:	0f 88 ac 00 00 00    	js     80249c <fsring_rw+0x161>
+  8023f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023f5:	89 d9                	mov    %ebx,%ecx
+  8023f7:	83 c3 01             	add    $0x1,%ebx
+  8023fa:	89 da                	mov    %ebx,%edx
+  8023fc:	c1 e2 0c             	shl    $0xc,%edx
+  8023ff:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802405:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80240b:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802411:	83 ec 08             	sub    $0x8,%esp
+  802414:	6a 00                	push   $0x0
+  802416:	6a 00                	push   $0x0
+  802418:	68 07 02 00 00       	push   $0x207
+  80241d:	50                   	push   %eax
+  80241e:	6a 0c                	push   $0xc
+  802420:	ff 35 0c 60 80 00    	push   0x80600c
+  802426:	e8 af 11 00 00       	call   8035da <ipc_call>
+  80242b:	83 c4 20             	add    $0x20,%esp
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	78 6a                	js     80249c <fsring_rw+0x161>
+  802432:	83 fb 08             	cmp    $0x8,%ebx
+  802435:	75 be                	jne    8023f5 <fsring_rw+0xba>
+  802437:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80243b:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802440:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802445:	0f 45 c2             	cmovne %edx,%eax
+  802448:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80244b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802452:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802459:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802460:	ba 00 00 00 00       	mov    $0x0,%edx
+  802465:	be 00 00 00 00       	mov    $0x0,%esi
+  80246a:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80246d:	e9 4b 01 00 00       	jmp    8025bd <fsring_rw+0x282>
+  802472:	e8 72 ee ff ff       	call   8012e9 <sys_time_msec>
+  802477:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  80247d:	0f 89 f3 fe ff ff    	jns    802376 <fsring_rw+0x3b>
+  802483:	eb 54                	jmp    8024d9 <fsring_rw+0x19e>
+  802485:	83 ec 0c             	sub    $0xc,%esp
+  802488:	6a 02                	push   $0x2
+  80248a:	e8 e6 12 00 00       	call   803775 <ipc_find_env>
+  80248f:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802494:	83 c4 10             	add    $0x10,%esp
+  802497:	e9 e7 fe ff ff       	jmp    802383 <fsring_rw+0x48>
+  80249c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8024a1:	83 ec 08             	sub    $0x8,%esp
+  8024a4:	53                   	push   %ebx
+  8024a5:	6a 00                	push   $0x0
+  8024a7:	e8 45 eb ff ff       	call   800ff1 <sys_page_unmap>
+  8024ac:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024b2:	83 c4 10             	add    $0x10,%esp
+  8024b5:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8024bb:	75 e4                	jne    8024a1 <fsring_rw+0x166>
+  8024bd:	e8 27 ee ff ff       	call   8012e9 <sys_time_msec>
+  8024c2:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8024c7:	a3 04 60 80 00       	mov    %eax,0x806004
+  8024cc:	a1 14 60 80 00       	mov    0x806014,%eax
+  8024d1:	8b 40 48             	mov    0x48(%eax),%eax
+  8024d4:	a3 08 60 80 00       	mov    %eax,0x806008
+  8024d9:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8024e0:	e9 7a 01 00 00       	jmp    80265f <fsring_rw+0x324>
+  8024e5:	8b 57 0c             	mov    0xc(%edi),%edx
+  8024e8:	89 10                	mov    %edx,(%eax)
+  8024ea:	89 58 04             	mov    %ebx,0x4(%eax)
+  8024ed:	89 f2                	mov    %esi,%edx
+  8024ef:	03 57 04             	add    0x4(%edi),%edx
+  8024f2:	89 50 08             	mov    %edx,0x8(%eax)
+  8024f5:	83 ec 04             	sub    $0x4,%esp
+  8024f8:	53                   	push   %ebx
+  8024f9:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8024fc:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8024ff:	52                   	push   %edx
+  802500:	83 c0 0c             	add    $0xc,%eax
+  802503:	50                   	push   %eax
+  802504:	e8 66 e7 ff ff       	call   800c6f <memmove>
+  802509:	83 c4 10             	add    $0x10,%esp
+  80250c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80250f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802512:	89 08                	mov    %ecx,(%eax)
+  802514:	83 ec 0c             	sub    $0xc,%esp
+  802517:	68 00 00 f0 cf       	push   $0xcff00000
+  80251c:	e8 28 0c 00 00       	call   803149 <ipcring_req_push>
+  802521:	01 de                	add    %ebx,%esi
+  802523:	83 c4 10             	add    $0x10,%esp
+  802526:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802529:	73 4c                	jae    802577 <fsring_rw+0x23c>
+  80252b:	83 ec 0c             	sub    $0xc,%esp
+  80252e:	68 00 00 f0 cf       	push   $0xcff00000
+  802533:	e8 eb 0b 00 00       	call   803123 <ipcring_req_slot>
+  802538:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	74 35                	je     802577 <fsring_rw+0x23c>
+  802542:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802547:	83 e0 07             	and    $0x7,%eax
+  80254a:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80254f:	c1 e0 0c             	shl    $0xc,%eax
+  802552:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802555:	29 f3                	sub    %esi,%ebx
+  802557:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80255a:	39 cb                	cmp    %ecx,%ebx
+  80255c:	0f 47 d9             	cmova  %ecx,%ebx
+  80255f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802563:	75 80                	jne    8024e5 <fsring_rw+0x1aa>
+  802565:	8b 57 0c             	mov    0xc(%edi),%edx
+  802568:	89 10                	mov    %edx,(%eax)
+  80256a:	89 58 04             	mov    %ebx,0x4(%eax)
+  80256d:	89 f2                	mov    %esi,%edx
+  80256f:	03 57 04             	add    0x4(%edi),%edx
+  802572:	89 50 08             	mov    %edx,0x8(%eax)
+  802575:	eb 95                	jmp    80250c <fsring_rw+0x1d1>
+  802577:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80257c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80257f:	83 ec 0c             	sub    $0xc,%esp
+  802582:	68 00 00 f0 cf       	push   $0xcff00000
+  802587:	e8 f6 0b 00 00       	call   803182 <ipcring_rsp_wait>
+  80258c:	8b 58 04             	mov    0x4(%eax),%ebx
+  80258f:	83 c4 10             	add    $0x10,%esp
+  802592:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802596:	75 45                	jne    8025dd <fsring_rw+0x2a2>
+  802598:	85 db                	test   %ebx,%ebx
+  80259a:	79 41                	jns    8025dd <fsring_rw+0x2a2>
+  80259c:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80259f:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8025a6:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8025ad:	83 ec 0c             	sub    $0xc,%esp
+  8025b0:	68 00 00 f0 cf       	push   $0xcff00000
+  8025b5:	e8 2e 0c 00 00       	call   8031e8 <ipcring_rsp_pop>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+  8025bd:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8025c3:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8025c8:	39 c2                	cmp    %eax,%edx
+  8025ca:	74 75                	je     802641 <fsring_rw+0x306>
+  8025cc:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8025d0:	75 a5                	jne    802577 <fsring_rw+0x23c>
+  8025d2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8025d5:	0f 82 50 ff ff ff    	jb     80252b <fsring_rw+0x1f0>
+  8025db:	eb 9a                	jmp    802577 <fsring_rw+0x23c>
+  8025dd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8025e1:	75 ca                	jne    8025ad <fsring_rw+0x272>
+  8025e3:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8025e7:	74 31                	je     80261a <fsring_rw+0x2df>
+  8025e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ec:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8025ef:	29 c8                	sub    %ecx,%eax
+  8025f1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8025f4:	39 d0                	cmp    %edx,%eax
+  8025f6:	0f 47 c2             	cmova  %edx,%eax
+  8025f9:	39 d8                	cmp    %ebx,%eax
+  8025fb:	ba 01 00 00 00       	mov    $0x1,%edx
+  802600:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802604:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802607:	b8 01 00 00 00       	mov    $0x1,%eax
+  80260c:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802610:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802613:	01 d9                	add    %ebx,%ecx
+  802615:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802618:	eb 93                	jmp    8025ad <fsring_rw+0x272>
+  80261a:	83 ec 04             	sub    $0x4,%esp
+  80261d:	53                   	push   %ebx
+  80261e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802621:	83 e0 07             	and    $0x7,%eax
+  802624:	c1 e0 0c             	shl    $0xc,%eax
+  802627:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80262d:	50                   	push   %eax
+  80262e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802631:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802634:	01 c8                	add    %ecx,%eax
+  802636:	50                   	push   %eax
+  802637:	e8 33 e6 ff ff       	call   800c6f <memmove>
+  80263c:	83 c4 10             	add    $0x10,%esp
+  80263f:	eb a8                	jmp    8025e9 <fsring_rw+0x2ae>
+  802641:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802645:	75 09                	jne    802650 <fsring_rw+0x315>
+  802647:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80264a:	0f 82 db fe ff ff    	jb     80252b <fsring_rw+0x1f0>
+  802650:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802653:	01 57 04             	add    %edx,0x4(%edi)
+  802656:	85 d2                	test   %edx,%edx
+  802658:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80265c:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80265f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802662:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802665:	5b                   	pop    %ebx
+  802666:	5e                   	pop    %esi
+  802667:	5f                   	pop    %edi
+  802668:	5d                   	pop    %ebp
+  802669:	c3                   	ret
+
+0080266a <devfile_write>:
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+  80266d:	57                   	push   %edi
+  80266e:	56                   	push   %esi
+  80266f:	53                   	push   %ebx
+  802670:	83 ec 0c             	sub    $0xc,%esp
+  802673:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802676:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802679:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80267c:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802682:	76 1a                	jbe    80269e <devfile_write+0x34>
+  802684:	83 ec 0c             	sub    $0xc,%esp
+  802687:	53                   	push   %ebx
+  802688:	89 f1                	mov    %esi,%ecx
+  80268a:	ba 06 00 00 00       	mov    $0x6,%edx
+  80268f:	89 f8                	mov    %edi,%eax
+  802691:	e8 a5 fc ff ff       	call   80233b <fsring_rw>
+  802696:	83 c4 10             	add    $0x10,%esp
+  802699:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80269c:	75 39                	jne    8026d7 <devfile_write+0x6d>
+  80269e:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8026a3:	39 c3                	cmp    %eax,%ebx
+  8026a5:	0f 47 d8             	cmova  %eax,%ebx
+  8026a8:	8b 47 0c             	mov    0xc(%edi),%eax
+  8026ab:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026b0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8026b6:	83 ec 04             	sub    $0x4,%esp
+  8026b9:	53                   	push   %ebx
+  8026ba:	56                   	push   %esi
+  8026bb:	68 08 70 80 00       	push   $0x807008
+  8026c0:	e8 aa e5 ff ff       	call   800c6f <memmove>
+  8026c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ca:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026cf:	e8 7c fb ff ff       	call   802250 <fsipc>
+  8026d4:	83 c4 10             	add    $0x10,%esp
+  8026d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026da:	5b                   	pop    %ebx
+  8026db:	5e                   	pop    %esi
+  8026dc:	5f                   	pop    %edi
+  8026dd:	5d                   	pop    %ebp
+  8026de:	c3                   	ret
+
+008026df <devfile_read>:
+  8026df:	55                   	push   %ebp
+  8026e0:	89 e5                	mov    %esp,%ebp
+  8026e2:	57                   	push   %edi
+  8026e3:	56                   	push   %esi
+  8026e4:	53                   	push   %ebx
+  8026e5:	83 ec 0c             	sub    $0xc,%esp
+  8026e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026eb:	8b 75 10             	mov    0x10(%ebp),%esi
+  8026ee:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8026f4:	76 1d                	jbe    802713 <devfile_read+0x34>
+  8026f6:	83 ec 0c             	sub    $0xc,%esp
+  8026f9:	56                   	push   %esi
+  8026fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026fd:	ba 05 00 00 00       	mov    $0x5,%edx
+  802702:	89 f8                	mov    %edi,%eax
+  802704:	e8 32 fc ff ff       	call   80233b <fsring_rw>
+  802709:	89 c3                	mov    %eax,%ebx
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802711:	75 37                	jne    80274a <devfile_read+0x6b>
+  802713:	8b 47 0c             	mov    0xc(%edi),%eax
+  802716:	a3 00 70 80 00       	mov    %eax,0x807000
+  80271b:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802721:	ba 00 00 00 00       	mov    $0x0,%edx
+  802726:	b8 03 00 00 00       	mov    $0x3,%eax
+  80272b:	e8 20 fb ff ff       	call   802250 <fsipc>
+  802730:	89 c3                	mov    %eax,%ebx
+  802732:	85 c0                	test   %eax,%eax
+  802734:	78 14                	js     80274a <devfile_read+0x6b>
+  802736:	83 ec 04             	sub    $0x4,%esp
+  802739:	50                   	push   %eax
+  80273a:	68 00 70 80 00       	push   $0x807000
+  80273f:	ff 75 0c             	push   0xc(%ebp)
+  802742:	e8 28 e5 ff ff       	call   800c6f <memmove>
+  802747:	83 c4 10             	add    $0x10,%esp
+  80274a:	89 d8                	mov    %ebx,%eax
+  80274c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274f:	5b                   	pop    %ebx
+  802750:	5e                   	pop    %esi
+  802751:	5f                   	pop    %edi
+  802752:	5d                   	pop    %ebp
+  802753:	c3                   	ret
+
+00802754 <open>:
+  802754:	55                   	push   %ebp
+  802755:	89 e5                	mov    %esp,%ebp
+  802757:	56                   	push   %esi
+  802758:	53                   	push   %ebx
+  802759:	83 ec 1c             	sub    $0x1c,%esp
+  80275c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80275f:	56                   	push   %esi
+  802760:	e8 0e e3 ff ff       	call   800a73 <strlen>
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80276d:	7f 6c                	jg     8027db <open+0x87>
+  80276f:	83 ec 0c             	sub    $0xc,%esp
+  802772:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802775:	50                   	push   %eax
+  802776:	e8 6a f5 ff ff       	call   801ce5 <fd_alloc>
+  80277b:	89 c3                	mov    %eax,%ebx
+  80277d:	83 c4 10             	add    $0x10,%esp
+  802780:	85 c0                	test   %eax,%eax
+  802782:	78 3c                	js     8027c0 <open+0x6c>
+  802784:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802787:	a3 00 74 80 00       	mov    %eax,0x807400
+  80278c:	83 ec 08             	sub    $0x8,%esp
+  80278f:	56                   	push   %esi
+  802790:	68 00 70 80 00       	push   $0x807000
+  802795:	e8 25 e3 ff ff       	call   800abf <strcpy>
+  80279a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80279d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027a2:	e8 a9 fa ff ff       	call   802250 <fsipc>
+  8027a7:	89 c3                	mov    %eax,%ebx
+  8027a9:	83 c4 10             	add    $0x10,%esp
+  8027ac:	85 c0                	test   %eax,%eax
+  8027ae:	78 19                	js     8027c9 <open+0x75>
+  8027b0:	83 ec 0c             	sub    $0xc,%esp
+  8027b3:	ff 75 f4             	push   -0xc(%ebp)
+  8027b6:	e8 03 f5 ff ff       	call   801cbe <fd2num>
+  8027bb:	89 c3                	mov    %eax,%ebx
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	89 d8                	mov    %ebx,%eax
+  8027c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c5:	5b                   	pop    %ebx
+  8027c6:	5e                   	pop    %esi
+  8027c7:	5d                   	pop    %ebp
+  8027c8:	c3                   	ret
+  8027c9:	83 ec 08             	sub    $0x8,%esp
+  8027cc:	6a 00                	push   $0x0
+  8027ce:	ff 75 f4             	push   -0xc(%ebp)
+  8027d1:	e8 05 f6 ff ff       	call   801ddb <fd_close>
+  8027d6:	83 c4 10             	add    $0x10,%esp
+  8027d9:	eb e5                	jmp    8027c0 <open+0x6c>
+  8027db:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8027e0:	eb de                	jmp    8027c0 <open+0x6c>
+
+008027e2 <file_image>:
+  8027e2:	55                   	push   %ebp
+  8027e3:	89 e5                	mov    %esp,%ebp
+  8027e5:	53                   	push   %ebx
+  8027e6:	83 ec 1c             	sub    $0x1c,%esp
+  8027e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ef:	50                   	push   %eax
+  8027f0:	ff 75 08             	push   0x8(%ebp)
+  8027f3:	e8 3d f5 ff ff       	call   801d35 <fd_lookup>
+  8027f8:	83 c4 10             	add    $0x10,%esp
+  8027fb:	85 c0                	test   %eax,%eax
+  8027fd:	78 58                	js     802857 <file_image+0x75>
+  8027ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802802:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802808:	39 08                	cmp    %ecx,(%eax)
+  80280a:	75 50                	jne    80285c <file_image+0x7a>
+  80280c:	83 fb 04             	cmp    $0x4,%ebx
+  80280f:	77 52                	ja     802863 <file_image+0x81>
+  802811:	8b 40 0c             	mov    0xc(%eax),%eax
+  802814:	a3 00 70 80 00       	mov    %eax,0x807000
+  802819:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80281f:	83 ec 04             	sub    $0x4,%esp
+  802822:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802825:	c1 e0 02             	shl    $0x2,%eax
+  802828:	50                   	push   %eax
+  802829:	ff 75 0c             	push   0xc(%ebp)
+  80282c:	68 08 70 80 00       	push   $0x807008
+  802831:	e8 39 e4 ff ff       	call   800c6f <memmove>
+  802836:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802840:	e8 0b fa ff ff       	call   802250 <fsipc>
+  802845:	83 c4 10             	add    $0x10,%esp
+  802848:	85 c0                	test   %eax,%eax
+  80284a:	78 0b                	js     802857 <file_image+0x75>
+  80284c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80284f:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802855:	89 0a                	mov    %ecx,(%edx)
+  802857:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80285a:	c9                   	leave
+  80285b:	c3                   	ret
+  80285c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802861:	eb f4                	jmp    802857 <file_image+0x75>
+  802863:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802868:	eb ed                	jmp    802857 <file_image+0x75>
+
+0080286a <remove>:
+  80286a:	55                   	push   %ebp
+  80286b:	89 e5                	mov    %esp,%ebp
+  80286d:	53                   	push   %ebx
+  80286e:	83 ec 10             	sub    $0x10,%esp
+  802871:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802874:	53                   	push   %ebx
+  802875:	e8 f9 e1 ff ff       	call   800a73 <strlen>
+  80287a:	83 c4 10             	add    $0x10,%esp
+  80287d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802882:	7f 25                	jg     8028a9 <remove+0x3f>
+  802884:	83 ec 08             	sub    $0x8,%esp
+  802887:	53                   	push   %ebx
+  802888:	68 00 70 80 00       	push   $0x807000
+  80288d:	e8 2d e2 ff ff       	call   800abf <strcpy>
+  802892:	ba 00 00 00 00       	mov    $0x0,%edx
+  802897:	b8 09 00 00 00       	mov    $0x9,%eax
+  80289c:	e8 af f9 ff ff       	call   802250 <fsipc>
+  8028a1:	83 c4 10             	add    $0x10,%esp
+  8028a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028a7:	c9                   	leave
+  8028a8:	c3                   	ret
+  8028a9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8028ae:	eb f4                	jmp    8028a4 <remove+0x3a>
+
+008028b0 <sync>:
+  8028b0:	55                   	push   %ebp
+  8028b1:	89 e5                	mov    %esp,%ebp
+  8028b3:	83 ec 08             	sub    $0x8,%esp
+  8028b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8028c0:	e8 8b f9 ff ff       	call   802250 <fsipc>
+  8028c5:	c9                   	leave
+  8028c6:	c3                   	ret
+
+008028c7 <devsock_stat>:
+  8028c7:	55                   	push   %ebp
+  8028c8:	89 e5                	mov    %esp,%ebp
+  8028ca:	83 ec 10             	sub    $0x10,%esp
+  8028cd:	68 90 3f 80 00       	push   $0x803f90
+  8028d2:	ff 75 0c             	push   0xc(%ebp)
+  8028d5:	e8 e5 e1 ff ff       	call   800abf <strcpy>
+  8028da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028df:	c9                   	leave
+  8028e0:	c3                   	ret
+
+008028e1 <devsock_close>:
+  8028e1:	55                   	push   %ebp
+  8028e2:	89 e5                	mov    %esp,%ebp
+  8028e4:	53                   	push   %ebx
+  8028e5:	83 ec 10             	sub    $0x10,%esp
+  8028e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028eb:	53                   	push   %ebx
+  8028ec:	e8 9e 0e 00 00       	call   80378f <pageref>
+  8028f1:	89 c2                	mov    %eax,%edx
+  8028f3:	83 c4 10             	add    $0x10,%esp
+  8028f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fb:	83 fa 01             	cmp    $0x1,%edx
+  8028fe:	74 05                	je     802905 <devsock_close+0x24>
+  802900:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802903:	c9                   	leave
+  802904:	c3                   	ret
+  802905:	83 ec 0c             	sub    $0xc,%esp
+  802908:	ff 73 0c             	push   0xc(%ebx)
+  80290b:	e8 aa 02 00 00       	call   802bba <nsipc_close>
+  802910:	83 c4 10             	add    $0x10,%esp
+  802913:	eb eb                	jmp    802900 <devsock_close+0x1f>
+
+00802915 <devsock_write>:
+  802915:	55                   	push   %ebp
+  802916:	89 e5                	mov    %esp,%ebp
+  802918:	83 ec 08             	sub    $0x8,%esp
+  80291b:	6a 00                	push   $0x0
+  80291d:	ff 75 10             	push   0x10(%ebp)
+  802920:	ff 75 0c             	push   0xc(%ebp)
+  802923:	8b 45 08             	mov    0x8(%ebp),%eax
+  802926:	ff 70 0c             	push   0xc(%eax)
+  802929:	e8 6c 03 00 00       	call   802c9a <nsipc_send>
+  80292e:	c9                   	leave
+  80292f:	c3                   	ret
+
+00802930 <devsock_read>:
+  802930:	55                   	push   %ebp
+  802931:	89 e5                	mov    %esp,%ebp
+  802933:	83 ec 08             	sub    $0x8,%esp
+  802936:	6a 00                	push   $0x0
+  802938:	ff 75 10             	push   0x10(%ebp)
+  80293b:	ff 75 0c             	push   0xc(%ebp)
+  80293e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802941:	ff 70 0c             	push   0xc(%eax)
+  802944:	e8 e2 02 00 00       	call   802c2b <nsipc_recv>
+  802949:	c9                   	leave
+  80294a:	c3                   	ret
+
+0080294b <fd2sockid>:
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	83 ec 20             	sub    $0x20,%esp
+  802951:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802954:	52                   	push   %edx
+  802955:	50                   	push   %eax
+  802956:	e8 da f3 ff ff       	call   801d35 <fd_lookup>
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	78 10                	js     802972 <fd2sockid+0x27>
+  802962:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802965:	8b 0d 24 50 80 00    	mov    0x805024,%ecx
+  80296b:	39 08                	cmp    %ecx,(%eax)
+  80296d:	75 05                	jne    802974 <fd2sockid+0x29>
+  80296f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802972:	c9                   	leave
+  802973:	c3                   	ret
+  802974:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802979:	eb f7                	jmp    802972 <fd2sockid+0x27>
+
+0080297b <alloc_sockfd>:
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+  80297e:	56                   	push   %esi
+  80297f:	53                   	push   %ebx
+  802980:	83 ec 1c             	sub    $0x1c,%esp
+  802983:	89 c6                	mov    %eax,%esi
+  802985:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802988:	50                   	push   %eax
+  802989:	e8 57 f3 ff ff       	call   801ce5 <fd_alloc>
+  80298e:	89 c3                	mov    %eax,%ebx
+  802990:	83 c4 10             	add    $0x10,%esp
+  802993:	85 c0                	test   %eax,%eax
+  802995:	78 43                	js     8029da <alloc_sockfd+0x5f>
+  802997:	83 ec 04             	sub    $0x4,%esp
+  80299a:	68 07 04 00 00       	push   $0x407
+  80299f:	ff 75 f4             	push   -0xc(%ebp)
+  8029a2:	6a 00                	push   $0x0
+  8029a4:	e8 76 e5 ff ff       	call   800f1f <sys_page_alloc>
+  8029a9:	89 c3                	mov    %eax,%ebx
+  8029ab:	83 c4 10             	add    $0x10,%esp
+  8029ae:	85 c0                	test   %eax,%eax
+  8029b0:	78 28                	js     8029da <alloc_sockfd+0x5f>
+  8029b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029b5:	8b 15 24 50 80 00    	mov    0x805024,%edx
+  8029bb:	89 10                	mov    %edx,(%eax)
+  8029bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8029c7:	89 70 0c             	mov    %esi,0xc(%eax)
+  8029ca:	83 ec 0c             	sub    $0xc,%esp
+  8029cd:	50                   	push   %eax
+  8029ce:	e8 eb f2 ff ff       	call   801cbe <fd2num>
+  8029d3:	89 c3                	mov    %eax,%ebx
+  8029d5:	83 c4 10             	add    $0x10,%esp
+  8029d8:	eb 0c                	jmp    8029e6 <alloc_sockfd+0x6b>
+  8029da:	83 ec 0c             	sub    $0xc,%esp
+  8029dd:	56                   	push   %esi
+  8029de:	e8 d7 01 00 00       	call   802bba <nsipc_close>
+  8029e3:	83 c4 10             	add    $0x10,%esp
+  8029e6:	89 d8                	mov    %ebx,%eax
+  8029e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029eb:	5b                   	pop    %ebx
+  8029ec:	5e                   	pop    %esi
+  8029ed:	5d                   	pop    %ebp
+  8029ee:	c3                   	ret
+
+008029ef <accept>:
+  8029ef:	55                   	push   %ebp
+  8029f0:	89 e5                	mov    %esp,%ebp
+  8029f2:	83 ec 08             	sub    $0x8,%esp
+  8029f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f8:	e8 4e ff ff ff       	call   80294b <fd2sockid>
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 1b                	js     802a1c <accept+0x2d>
+  802a01:	83 ec 04             	sub    $0x4,%esp
+  802a04:	ff 75 10             	push   0x10(%ebp)
+  802a07:	ff 75 0c             	push   0xc(%ebp)
+  802a0a:	50                   	push   %eax
+  802a0b:	e8 07 01 00 00       	call   802b17 <nsipc_accept>
+  802a10:	83 c4 10             	add    $0x10,%esp
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	78 05                	js     802a1c <accept+0x2d>
+  802a17:	e8 5f ff ff ff       	call   80297b <alloc_sockfd>
+  802a1c:	c9                   	leave
+  802a1d:	c3                   	ret
+
+00802a1e <bind>:
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	83 ec 08             	sub    $0x8,%esp
+  802a24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a27:	e8 1f ff ff ff       	call   80294b <fd2sockid>
+  802a2c:	85 c0                	test   %eax,%eax
+  802a2e:	78 12                	js     802a42 <bind+0x24>
+  802a30:	83 ec 04             	sub    $0x4,%esp
+  802a33:	ff 75 10             	push   0x10(%ebp)
+  802a36:	ff 75 0c             	push   0xc(%ebp)
+  802a39:	50                   	push   %eax
+  802a3a:	e8 24 01 00 00       	call   802b63 <nsipc_bind>
+  802a3f:	83 c4 10             	add    $0x10,%esp
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+
+00802a44 <shutdown>:
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	83 ec 08             	sub    $0x8,%esp
+  802a4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a4d:	e8 f9 fe ff ff       	call   80294b <fd2sockid>
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	78 0f                	js     802a65 <shutdown+0x21>
+  802a56:	83 ec 08             	sub    $0x8,%esp
+  802a59:	ff 75 0c             	push   0xc(%ebp)
+  802a5c:	50                   	push   %eax
+  802a5d:	e8 36 01 00 00       	call   802b98 <nsipc_shutdown>
+  802a62:	83 c4 10             	add    $0x10,%esp
+  802a65:	c9                   	leave
+  802a66:	c3                   	ret
+
+00802a67 <connect>:
+  802a67:	55                   	push   %ebp
+  802a68:	89 e5                	mov    %esp,%ebp
+  802a6a:	83 ec 08             	sub    $0x8,%esp
+  802a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a70:	e8 d6 fe ff ff       	call   80294b <fd2sockid>
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	78 12                	js     802a8b <connect+0x24>
+  802a79:	83 ec 04             	sub    $0x4,%esp
+  802a7c:	ff 75 10             	push   0x10(%ebp)
+  802a7f:	ff 75 0c             	push   0xc(%ebp)
+  802a82:	50                   	push   %eax
+  802a83:	e8 4c 01 00 00       	call   802bd4 <nsipc_connect>
+  802a88:	83 c4 10             	add    $0x10,%esp
+  802a8b:	c9                   	leave
+  802a8c:	c3                   	ret
+
+00802a8d <listen>:
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+  802a90:	83 ec 08             	sub    $0x8,%esp
+  802a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a96:	e8 b0 fe ff ff       	call   80294b <fd2sockid>
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	78 0f                	js     802aae <listen+0x21>
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+  802aa2:	ff 75 0c             	push   0xc(%ebp)
+  802aa5:	50                   	push   %eax
+  802aa6:	e8 5e 01 00 00       	call   802c09 <nsipc_listen>
+  802aab:	83 c4 10             	add    $0x10,%esp
+  802aae:	c9                   	leave
+  802aaf:	c3                   	ret
+
+00802ab0 <socket>:
+  802ab0:	55                   	push   %ebp
+  802ab1:	89 e5                	mov    %esp,%ebp
+  802ab3:	83 ec 0c             	sub    $0xc,%esp
+  802ab6:	ff 75 10             	push   0x10(%ebp)
+  802ab9:	ff 75 0c             	push   0xc(%ebp)
+  802abc:	ff 75 08             	push   0x8(%ebp)
+  802abf:	e8 34 02 00 00       	call   802cf8 <nsipc_socket>
+  802ac4:	83 c4 10             	add    $0x10,%esp
+  802ac7:	85 c0                	test   %eax,%eax
+  802ac9:	78 05                	js     802ad0 <socket+0x20>
+  802acb:	e8 ab fe ff ff       	call   80297b <alloc_sockfd>
+  802ad0:	c9                   	leave
+  802ad1:	c3                   	ret
+
+00802ad2 <nsipc>:
+  802ad2:	55                   	push   %ebp
+  802ad3:	89 e5                	mov    %esp,%ebp
+  802ad5:	53                   	push   %ebx
+  802ad6:	83 ec 04             	sub    $0x4,%esp
+  802ad9:	89 c3                	mov    %eax,%ebx
+  802adb:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  802ae2:	74 1f                	je     802b03 <nsipc+0x31>
+  802ae4:	83 ec 08             	sub    $0x8,%esp
+  802ae7:	6a 00                	push   $0x0
+  802ae9:	6a 00                	push   $0x0
+  802aeb:	6a 07                	push   $0x7
+  802aed:	68 00 80 80 00       	push   $0x808000
+  802af2:	53                   	push   %ebx
+  802af3:	ff 35 10 60 80 00    	push   0x806010
+  802af9:	e8 dc 0a 00 00       	call   8035da <ipc_call>
+  802afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b01:	c9                   	leave
+  802b02:	c3                   	ret
+  802b03:	83 ec 0c             	sub    $0xc,%esp
+  802b06:	6a 03                	push   $0x3
+  802b08:	e8 68 0c 00 00       	call   803775 <ipc_find_env>
+  802b0d:	a3 10 60 80 00       	mov    %eax,0x806010
+  802b12:	83 c4 10             	add    $0x10,%esp
+  802b15:	eb cd                	jmp    802ae4 <nsipc+0x12>
+
+00802b17 <nsipc_accept>:
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	53                   	push   %ebx
+  802b1b:	83 ec 04             	sub    $0x4,%esp
+  802b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b21:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b26:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b2b:	e8 a2 ff ff ff       	call   802ad2 <nsipc>
+  802b30:	89 c3                	mov    %eax,%ebx
+  802b32:	85 c0                	test   %eax,%eax
+  802b34:	79 07                	jns    802b3d <nsipc_accept+0x26>
+  802b36:	89 d8                	mov    %ebx,%eax
+  802b38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b3b:	c9                   	leave
+  802b3c:	c3                   	ret
+  802b3d:	83 ec 04             	sub    $0x4,%esp
+  802b40:	ff 35 10 80 80 00    	push   0x808010
+  802b46:	68 00 80 80 00       	push   $0x808000
+  802b4b:	ff 75 0c             	push   0xc(%ebp)
+  802b4e:	e8 1c e1 ff ff       	call   800c6f <memmove>
+  802b53:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b59:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b5c:	89 10                	mov    %edx,(%eax)
+  802b5e:	83 c4 10             	add    $0x10,%esp
+  802b61:	eb d3                	jmp    802b36 <nsipc_accept+0x1f>
+
+00802b63 <nsipc_bind>:
+  802b63:	55                   	push   %ebp
+  802b64:	89 e5                	mov    %esp,%ebp
+  802b66:	53                   	push   %ebx
+  802b67:	83 ec 08             	sub    $0x8,%esp
+  802b6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b70:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b75:	53                   	push   %ebx
+  802b76:	ff 75 0c             	push   0xc(%ebp)
+  802b79:	68 04 80 80 00       	push   $0x808004
+  802b7e:	e8 ec e0 ff ff       	call   800c6f <memmove>
+  802b83:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802b89:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b8e:	e8 3f ff ff ff       	call   802ad2 <nsipc>
+  802b93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b96:	c9                   	leave
+  802b97:	c3                   	ret
+
+00802b98 <nsipc_shutdown>:
+  802b98:	55                   	push   %ebp
+  802b99:	89 e5                	mov    %esp,%ebp
+  802b9b:	83 ec 08             	sub    $0x8,%esp
+  802b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba1:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ba6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ba9:	a3 04 80 80 00       	mov    %eax,0x808004
+  802bae:	b8 03 00 00 00       	mov    $0x3,%eax
+  802bb3:	e8 1a ff ff ff       	call   802ad2 <nsipc>
+  802bb8:	c9                   	leave
+  802bb9:	c3                   	ret
+
+00802bba <nsipc_close>:
+  802bba:	55                   	push   %ebp
+  802bbb:	89 e5                	mov    %esp,%ebp
+  802bbd:	83 ec 08             	sub    $0x8,%esp
+  802bc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc3:	a3 00 80 80 00       	mov    %eax,0x808000
+  802bc8:	b8 04 00 00 00       	mov    $0x4,%eax
+  802bcd:	e8 00 ff ff ff       	call   802ad2 <nsipc>
+  802bd2:	c9                   	leave
+  802bd3:	c3                   	ret
+
+00802bd4 <nsipc_connect>:
+  802bd4:	55                   	push   %ebp
+  802bd5:	89 e5                	mov    %esp,%ebp
+  802bd7:	53                   	push   %ebx
+  802bd8:	83 ec 08             	sub    $0x8,%esp
+  802bdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bde:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be1:	a3 00 80 80 00       	mov    %eax,0x808000
+  802be6:	53                   	push   %ebx
+  802be7:	ff 75 0c             	push   0xc(%ebp)
+  802bea:	68 04 80 80 00       	push   $0x808004
+  802bef:	e8 7b e0 ff ff       	call   800c6f <memmove>
+  802bf4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802bfa:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bff:	e8 ce fe ff ff       	call   802ad2 <nsipc>
+  802c04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c07:	c9                   	leave
+  802c08:	c3                   	ret
+
+00802c09 <nsipc_listen>:
+  802c09:	55                   	push   %ebp
+  802c0a:	89 e5                	mov    %esp,%ebp
+  802c0c:	83 ec 08             	sub    $0x8,%esp
+  802c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c12:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c1a:	a3 04 80 80 00       	mov    %eax,0x808004
+  802c1f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c24:	e8 a9 fe ff ff       	call   802ad2 <nsipc>
+  802c29:	c9                   	leave
+  802c2a:	c3                   	ret
+
+00802c2b <nsipc_recv>:
+  802c2b:	55                   	push   %ebp
+  802c2c:	89 e5                	mov    %esp,%ebp
+  802c2e:	56                   	push   %esi
+  802c2f:	53                   	push   %ebx
+  802c30:	8b 75 10             	mov    0x10(%ebp),%esi
+  802c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c36:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c3b:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802c41:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c44:	a3 08 80 80 00       	mov    %eax,0x808008
+  802c49:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c4e:	e8 7f fe ff ff       	call   802ad2 <nsipc>
+  802c53:	89 c3                	mov    %eax,%ebx
+  802c55:	85 c0                	test   %eax,%eax
+  802c57:	78 22                	js     802c7b <nsipc_recv+0x50>
+  802c59:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c5e:	39 c6                	cmp    %eax,%esi
+  802c60:	0f 4e c6             	cmovle %esi,%eax
+  802c63:	39 c3                	cmp    %eax,%ebx
+  802c65:	7f 1d                	jg     802c84 <nsipc_recv+0x59>
+  802c67:	83 ec 04             	sub    $0x4,%esp
+  802c6a:	53                   	push   %ebx
+  802c6b:	68 00 80 80 00       	push   $0x808000
+  802c70:	ff 75 0c             	push   0xc(%ebp)
+  802c73:	e8 f7 df ff ff       	call   800c6f <memmove>
+  802c78:	83 c4 10             	add    $0x10,%esp
+  802c7b:	89 d8                	mov    %ebx,%eax
+  802c7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c80:	5b                   	pop    %ebx
+  802c81:	5e                   	pop    %esi
+  802c82:	5d                   	pop    %ebp
+  802c83:	c3                   	ret
+  802c84:	68 9c 3f 80 00       	push   $0x803f9c
+  802c89:	68 b1 3f 80 00       	push   $0x803fb1
+  802c8e:	6a 60                	push   $0x60
+  802c90:	68 c6 3f 80 00       	push   $0x803fc6
+  802c95:	e8 53 d6 ff ff       	call   8002ed <_panic>
+
+00802c9a <nsipc_send>:
+  802c9a:	55                   	push   %ebp
+  802c9b:	89 e5                	mov    %esp,%ebp
+  802c9d:	53                   	push   %ebx
+  802c9e:	83 ec 04             	sub    $0x4,%esp
+  802ca1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ca4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca7:	a3 00 80 80 00       	mov    %eax,0x808000
+  802cac:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802cb2:	7f 2e                	jg     802ce2 <nsipc_send+0x48>
+  802cb4:	83 ec 04             	sub    $0x4,%esp
+  802cb7:	53                   	push   %ebx
+  802cb8:	ff 75 0c             	push   0xc(%ebp)
+  802cbb:	68 0c 80 80 00       	push   $0x80800c
+  802cc0:	e8 aa df ff ff       	call   800c6f <memmove>
+  802cc5:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802ccb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cce:	a3 08 80 80 00       	mov    %eax,0x808008
+  802cd3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802cd8:	e8 f5 fd ff ff       	call   802ad2 <nsipc>
+  802cdd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ce0:	c9                   	leave
+  802ce1:	c3                   	ret
+  802ce2:	68 d2 3f 80 00       	push   $0x803fd2
+  802ce7:	68 b1 3f 80 00       	push   $0x803fb1
+  802cec:	6a 6b                	push   $0x6b
+  802cee:	68 c6 3f 80 00       	push   $0x803fc6
+  802cf3:	e8 f5 d5 ff ff       	call   8002ed <_panic>
+
+00802cf8 <nsipc_socket>:
+  802cf8:	55                   	push   %ebp
+  802cf9:	89 e5                	mov    %esp,%ebp
+  802cfb:	83 ec 08             	sub    $0x8,%esp
+  802cfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d01:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d09:	a3 04 80 80 00       	mov    %eax,0x808004
+  802d0e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d11:	a3 08 80 80 00       	mov    %eax,0x808008
+  802d16:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d1b:	e8 b2 fd ff ff       	call   802ad2 <nsipc>
+  802d20:	c9                   	leave
+  802d21:	c3                   	ret
+
+00802d22 <devpipe_stat>:
+  802d22:	55                   	push   %ebp
+  802d23:	89 e5                	mov    %esp,%ebp
+  802d25:	56                   	push   %esi
+  802d26:	53                   	push   %ebx
+  802d27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802d2a:	83 ec 0c             	sub    $0xc,%esp
+  802d2d:	ff 75 08             	push   0x8(%ebp)
+  802d30:	e8 99 ef ff ff       	call   801cce <fd2data>
+  802d35:	89 c6                	mov    %eax,%esi
+  802d37:	83 c4 08             	add    $0x8,%esp
+  802d3a:	68 de 3f 80 00       	push   $0x803fde
+  802d3f:	53                   	push   %ebx
+  802d40:	e8 7a dd ff ff       	call   800abf <strcpy>
+  802d45:	8b 46 04             	mov    0x4(%esi),%eax
+  802d48:	2b 06                	sub    (%esi),%eax
+  802d4a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802d50:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d57:	00 00 00 
+  802d5a:	c7 83 88 00 00 00 40 	movl   $0x805040,0x88(%ebx)
+  802d61:	50 80 00 
+  802d64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d6c:	5b                   	pop    %ebx
+  802d6d:	5e                   	pop    %esi
+  802d6e:	5d                   	pop    %ebp
+  802d6f:	c3                   	ret
+
+00802d70 <devpipe_close>:
+  802d70:	55                   	push   %ebp
+  802d71:	89 e5                	mov    %esp,%ebp
+  802d73:	53                   	push   %ebx
+  802d74:	83 ec 0c             	sub    $0xc,%esp
+  802d77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802d7a:	53                   	push   %ebx
+  802d7b:	6a 00                	push   $0x0
+  802d7d:	e8 6f e2 ff ff       	call   800ff1 <sys_page_unmap>
+  802d82:	89 1c 24             	mov    %ebx,(%esp)
+  802d85:	e8 44 ef ff ff       	call   801cce <fd2data>
+  802d8a:	83 c4 08             	add    $0x8,%esp
+  802d8d:	50                   	push   %eax
+  802d8e:	6a 00                	push   $0x0
+  802d90:	e8 5c e2 ff ff       	call   800ff1 <sys_page_unmap>
+  802d95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d98:	c9                   	leave
+  802d99:	c3                   	ret
+
+00802d9a <_pipeisclosed>:
+  802d9a:	55                   	push   %ebp
+  802d9b:	89 e5                	mov    %esp,%ebp
+  802d9d:	57                   	push   %edi
+  802d9e:	56                   	push   %esi
+  802d9f:	53                   	push   %ebx
+  802da0:	83 ec 1c             	sub    $0x1c,%esp
+  802da3:	89 c7                	mov    %eax,%edi
+  802da5:	89 d6                	mov    %edx,%esi
+  802da7:	a1 14 60 80 00       	mov    0x806014,%eax
+  802dac:	8b 58 58             	mov    0x58(%eax),%ebx
+  802daf:	83 ec 0c             	sub    $0xc,%esp
+  802db2:	57                   	push   %edi
+  802db3:	e8 d7 09 00 00       	call   80378f <pageref>
+  802db8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802dbb:	89 34 24             	mov    %esi,(%esp)
+  802dbe:	e8 cc 09 00 00       	call   80378f <pageref>
+  802dc3:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  802dc9:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802dcc:	83 c4 10             	add    $0x10,%esp
+  802dcf:	39 cb                	cmp    %ecx,%ebx
+  802dd1:	74 1b                	je     802dee <_pipeisclosed+0x54>
+  802dd3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802dd6:	75 cf                	jne    802da7 <_pipeisclosed+0xd>
+  802dd8:	8b 42 58             	mov    0x58(%edx),%eax
+  802ddb:	6a 01                	push   $0x1
+  802ddd:	50                   	push   %eax
+  802dde:	53                   	push   %ebx
+  802ddf:	68 e5 3f 80 00       	push   $0x803fe5
+  802de4:	e8 df d5 ff ff       	call   8003c8 <cprintf>
+  802de9:	83 c4 10             	add    $0x10,%esp
+  802dec:	eb b9                	jmp    802da7 <_pipeisclosed+0xd>
+  802dee:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802df1:	0f 94 c0             	sete   %al
+  802df4:	0f b6 c0             	movzbl %al,%eax
+  802df7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dfa:	5b                   	pop    %ebx
+  802dfb:	5e                   	pop    %esi
+  802dfc:	5f                   	pop    %edi
+  802dfd:	5d                   	pop    %ebp
+  802dfe:	c3                   	ret
+
+00802dff <devpipe_write>:
+  802dff:	55                   	push   %ebp
+  802e00:	89 e5                	mov    %esp,%ebp
+  802e02:	57                   	push   %edi
+  802e03:	56                   	push   %esi
+  802e04:	53                   	push   %ebx
+  802e05:	83 ec 28             	sub    $0x28,%esp
+  802e08:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e0b:	56                   	push   %esi
+  802e0c:	e8 bd ee ff ff       	call   801cce <fd2data>
+  802e11:	89 c3                	mov    %eax,%ebx
+  802e13:	83 c4 10             	add    $0x10,%esp
+  802e16:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e1b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e1f:	74 5c                	je     802e7d <devpipe_write+0x7e>
+  802e21:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e24:	8b 0b                	mov    (%ebx),%ecx
+  802e26:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e29:	39 d0                	cmp    %edx,%eax
+  802e2b:	72 1e                	jb     802e4b <devpipe_write+0x4c>
+  802e2d:	89 da                	mov    %ebx,%edx
+  802e2f:	89 f0                	mov    %esi,%eax
+  802e31:	e8 64 ff ff ff       	call   802d9a <_pipeisclosed>
+  802e36:	85 c0                	test   %eax,%eax
+  802e38:	75 48                	jne    802e82 <devpipe_write+0x83>
+  802e3a:	e8 95 e0 ff ff       	call   800ed4 <sys_yield>
+  802e3f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e42:	8b 0b                	mov    (%ebx),%ecx
+  802e44:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e47:	39 d0                	cmp    %edx,%eax
+  802e49:	73 e2                	jae    802e2d <devpipe_write+0x2e>
+  802e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e4e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e52:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e55:	89 c2                	mov    %eax,%edx
+  802e57:	c1 fa 1f             	sar    $0x1f,%edx
+  802e5a:	89 d1                	mov    %edx,%ecx
+  802e5c:	c1 e9 1b             	shr    $0x1b,%ecx
+  802e5f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e62:	83 e2 1f             	and    $0x1f,%edx
+  802e65:	29 ca                	sub    %ecx,%edx
+  802e67:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802e6b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802e6f:	83 c0 01             	add    $0x1,%eax
+  802e72:	89 43 04             	mov    %eax,0x4(%ebx)
+  802e75:	83 c7 01             	add    $0x1,%edi
+  802e78:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802e7b:	75 a4                	jne    802e21 <devpipe_write+0x22>
+  802e7d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e80:	eb 05                	jmp    802e87 <devpipe_write+0x88>
+  802e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e8a:	5b                   	pop    %ebx
+  802e8b:	5e                   	pop    %esi
+  802e8c:	5f                   	pop    %edi
+  802e8d:	5d                   	pop    %ebp
+  802e8e:	c3                   	ret
+
+00802e8f <devpipe_read>:
+  802e8f:	55                   	push   %ebp
+  802e90:	89 e5                	mov    %esp,%ebp
+  802e92:	57                   	push   %edi
+  802e93:	56                   	push   %esi
+  802e94:	53                   	push   %ebx
+  802e95:	83 ec 18             	sub    $0x18,%esp
+  802e98:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e9b:	56                   	push   %esi
+  802e9c:	e8 2d ee ff ff       	call   801cce <fd2data>
+  802ea1:	89 c3                	mov    %eax,%ebx
+  802ea3:	83 c4 10             	add    $0x10,%esp
+  802ea6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eab:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802eaf:	74 45                	je     802ef6 <devpipe_read+0x67>
+  802eb1:	8b 03                	mov    (%ebx),%eax
+  802eb3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802eb6:	75 1d                	jne    802ed5 <devpipe_read+0x46>
+  802eb8:	85 ff                	test   %edi,%edi
+  802eba:	75 3f                	jne    802efb <devpipe_read+0x6c>
+  802ebc:	89 da                	mov    %ebx,%edx
+  802ebe:	89 f0                	mov    %esi,%eax
+  802ec0:	e8 d5 fe ff ff       	call   802d9a <_pipeisclosed>
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	75 3c                	jne    802f05 <devpipe_read+0x76>
+  802ec9:	e8 06 e0 ff ff       	call   800ed4 <sys_yield>
+  802ece:	8b 03                	mov    (%ebx),%eax
+  802ed0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ed3:	74 e7                	je     802ebc <devpipe_read+0x2d>
+  802ed5:	99                   	cltd
+  802ed6:	c1 ea 1b             	shr    $0x1b,%edx
+  802ed9:	01 d0                	add    %edx,%eax
+  802edb:	83 e0 1f             	and    $0x1f,%eax
+  802ede:	29 d0                	sub    %edx,%eax
+  802ee0:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ee5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ee8:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802eeb:	83 03 01             	addl   $0x1,(%ebx)
+  802eee:	83 c7 01             	add    $0x1,%edi
+  802ef1:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802ef4:	75 bb                	jne    802eb1 <devpipe_read+0x22>
+  802ef6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ef9:	eb 02                	jmp    802efd <devpipe_read+0x6e>
+  802efb:	89 f8                	mov    %edi,%eax
+  802efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f00:	5b                   	pop    %ebx
+  802f01:	5e                   	pop    %esi
+  802f02:	5f                   	pop    %edi
+  802f03:	5d                   	pop    %ebp
+  802f04:	c3                   	ret
+  802f05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0a:	eb f1                	jmp    802efd <devpipe_read+0x6e>
+
+00802f0c <pipe>:
+  802f0c:	55                   	push   %ebp
+  802f0d:	89 e5                	mov    %esp,%ebp
+  802f0f:	56                   	push   %esi
+  802f10:	53                   	push   %ebx
+  802f11:	83 ec 1c             	sub    $0x1c,%esp
+  802f14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f17:	50                   	push   %eax
+  802f18:	e8 c8 ed ff ff       	call   801ce5 <fd_alloc>
+  802f1d:	89 c3                	mov    %eax,%ebx
+  802f1f:	83 c4 10             	add    $0x10,%esp
+  802f22:	85 c0                	test   %eax,%eax
+  802f24:	0f 88 23 01 00 00    	js     80304d <pipe+0x141>
+  802f2a:	83 ec 04             	sub    $0x4,%esp
+  802f2d:	68 07 04 00 00       	push   $0x407
+  802f32:	ff 75 f4             	push   -0xc(%ebp)
+  802f35:	6a 00                	push   $0x0
+  802f37:	e8 e3 df ff ff       	call   800f1f <sys_page_alloc>
+  802f3c:	89 c3                	mov    %eax,%ebx
+  802f3e:	83 c4 10             	add    $0x10,%esp
+  802f41:	85 c0                	test   %eax,%eax
+  802f43:	0f 88 04 01 00 00    	js     80304d <pipe+0x141>
+  802f49:	83 ec 0c             	sub    $0xc,%esp
+  802f4c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f4f:	50                   	push   %eax
+  802f50:	e8 90 ed ff ff       	call   801ce5 <fd_alloc>
+  802f55:	89 c3                	mov    %eax,%ebx
+  802f57:	83 c4 10             	add    $0x10,%esp
+  802f5a:	85 c0                	test   %eax,%eax
+  802f5c:	0f 88 db 00 00 00    	js     80303d <pipe+0x131>
+  802f62:	83 ec 04             	sub    $0x4,%esp
+  802f65:	68 07 04 00 00       	push   $0x407
+  802f6a:	ff 75 f0             	push   -0x10(%ebp)
+  802f6d:	6a 00                	push   $0x0
+  802f6f:	e8 ab df ff ff       	call   800f1f <sys_page_alloc>
+  802f74:	89 c3                	mov    %eax,%ebx
+  802f76:	83 c4 10             	add    $0x10,%esp
+  802f79:	85 c0                	test   %eax,%eax
+  802f7b:	0f 88 bc 00 00 00    	js     80303d <pipe+0x131>
+  802f81:	83 ec 0c             	sub    $0xc,%esp
+  802f84:	ff 75 f4             	push   -0xc(%ebp)
+  802f87:	e8 42 ed ff ff       	call   801cce <fd2data>
+  802f8c:	89 c6                	mov    %eax,%esi
+  802f8e:	83 c4 0c             	add    $0xc,%esp
+  802f91:	68 07 04 00 00       	push   $0x407
+  802f96:	50                   	push   %eax
+  802f97:	6a 00                	push   $0x0
+  802f99:	e8 81 df ff ff       	call   800f1f <sys_page_alloc>
+  802f9e:	89 c3                	mov    %eax,%ebx
+  802fa0:	83 c4 10             	add    $0x10,%esp
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	0f 88 82 00 00 00    	js     80302d <pipe+0x121>
+  802fab:	83 ec 0c             	sub    $0xc,%esp
+  802fae:	ff 75 f0             	push   -0x10(%ebp)
+  802fb1:	e8 18 ed ff ff       	call   801cce <fd2data>
+  802fb6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802fbd:	50                   	push   %eax
+  802fbe:	6a 00                	push   $0x0
+  802fc0:	56                   	push   %esi
+  802fc1:	6a 00                	push   $0x0
+  802fc3:	e8 9a df ff ff       	call   800f62 <sys_page_map>
+  802fc8:	89 c3                	mov    %eax,%ebx
+  802fca:	83 c4 20             	add    $0x20,%esp
+  802fcd:	85 c0                	test   %eax,%eax
+  802fcf:	78 4e                	js     80301f <pipe+0x113>
+  802fd1:	a1 40 50 80 00       	mov    0x805040,%eax
+  802fd6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802fd9:	89 02                	mov    %eax,(%edx)
+  802fdb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802fde:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802fe5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802fe8:	89 02                	mov    %eax,(%edx)
+  802fea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802fed:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802ff4:	83 ec 0c             	sub    $0xc,%esp
+  802ff7:	ff 75 f4             	push   -0xc(%ebp)
+  802ffa:	e8 bf ec ff ff       	call   801cbe <fd2num>
+  802fff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803002:	89 01                	mov    %eax,(%ecx)
+  803004:	83 c4 04             	add    $0x4,%esp
+  803007:	ff 75 f0             	push   -0x10(%ebp)
+  80300a:	e8 af ec ff ff       	call   801cbe <fd2num>
+  80300f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803012:	89 41 04             	mov    %eax,0x4(%ecx)
+  803015:	83 c4 10             	add    $0x10,%esp
+  803018:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80301d:	eb 2e                	jmp    80304d <pipe+0x141>
+  80301f:	83 ec 08             	sub    $0x8,%esp
+  803022:	56                   	push   %esi
+  803023:	6a 00                	push   $0x0
+  803025:	e8 c7 df ff ff       	call   800ff1 <sys_page_unmap>
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	83 ec 08             	sub    $0x8,%esp
+  803030:	ff 75 f0             	push   -0x10(%ebp)
+  803033:	6a 00                	push   $0x0
+  803035:	e8 b7 df ff ff       	call   800ff1 <sys_page_unmap>
+  80303a:	83 c4 10             	add    $0x10,%esp
+  80303d:	83 ec 08             	sub    $0x8,%esp
+  803040:	ff 75 f4             	push   -0xc(%ebp)
+  803043:	6a 00                	push   $0x0
+  803045:	e8 a7 df ff ff       	call   800ff1 <sys_page_unmap>
+  80304a:	83 c4 10             	add    $0x10,%esp
+  80304d:	89 d8                	mov    %ebx,%eax
+  80304f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803052:	5b                   	pop    %ebx
+  803053:	5e                   	pop    %esi
+  803054:	5d                   	pop    %ebp
+  803055:	c3                   	ret
+
+00803056 <pipeisclosed>:
+  803056:	55                   	push   %ebp
+  803057:	89 e5                	mov    %esp,%ebp
+  803059:	83 ec 20             	sub    $0x20,%esp
+  80305c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80305f:	50                   	push   %eax
+  803060:	ff 75 08             	push   0x8(%ebp)
+  803063:	e8 cd ec ff ff       	call   801d35 <fd_lookup>
+  803068:	83 c4 10             	add    $0x10,%esp
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	78 18                	js     803087 <pipeisclosed+0x31>
+  80306f:	83 ec 0c             	sub    $0xc,%esp
+  803072:	ff 75 f4             	push   -0xc(%ebp)
+  803075:	e8 54 ec ff ff       	call   801cce <fd2data>
+  80307a:	89 c2                	mov    %eax,%edx
+  80307c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80307f:	e8 16 fd ff ff       	call   802d9a <_pipeisclosed>
+  803084:	83 c4 10             	add    $0x10,%esp
+  803087:	c9                   	leave
+  803088:	c3                   	ret
+
+00803089 <wait>:
+  803089:	55                   	push   %ebp
+  80308a:	89 e5                	mov    %esp,%ebp
+  80308c:	56                   	push   %esi
+  80308d:	53                   	push   %ebx
+  80308e:	8b 75 08             	mov    0x8(%ebp),%esi
+  803091:	85 f6                	test   %esi,%esi
+  803093:	74 40                	je     8030d5 <wait+0x4c>
+  803095:	89 f3                	mov    %esi,%ebx
+  803097:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80309d:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  8030a3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030a8:	8b 40 48             	mov    0x48(%eax),%eax
+  8030ab:	39 c6                	cmp    %eax,%esi
+  8030ad:	75 1f                	jne    8030ce <wait+0x45>
+  8030af:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  8030b5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8030bb:	8b 43 54             	mov    0x54(%ebx),%eax
+  8030be:	85 c0                	test   %eax,%eax
+  8030c0:	74 0c                	je     8030ce <wait+0x45>
+  8030c2:	e8 0d de ff ff       	call   800ed4 <sys_yield>
+  8030c7:	8b 43 48             	mov    0x48(%ebx),%eax
+  8030ca:	39 f0                	cmp    %esi,%eax
+  8030cc:	74 ed                	je     8030bb <wait+0x32>
+  8030ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030d1:	5b                   	pop    %ebx
+  8030d2:	5e                   	pop    %esi
+  8030d3:	5d                   	pop    %ebp
+  8030d4:	c3                   	ret
+  8030d5:	68 fd 3f 80 00       	push   $0x803ffd
+  8030da:	68 b1 3f 80 00       	push   $0x803fb1
+  8030df:	6a 09                	push   $0x9
+  8030e1:	68 08 40 80 00       	push   $0x804008
+  8030e6:	e8 02 d2 ff ff       	call   8002ed <_panic>
+
+008030eb <ipcring_init>:
+  8030eb:	55                   	push   %ebp
+  8030ec:	89 e5                	mov    %esp,%ebp
+  8030ee:	53                   	push   %ebx
+  8030ef:	83 ec 08             	sub    $0x8,%esp
+  8030f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8030f5:	6a 60                	push   $0x60
+  8030f7:	6a 00                	push   $0x0
+  8030f9:	53                   	push   %ebx
+  8030fa:	e8 3b db ff ff       	call   800c3a <memset>
+  8030ff:	a1 14 60 80 00       	mov    0x806014,%eax
+  803104:	8b 40 48             	mov    0x48(%eax),%eax
+  803107:	89 03                	mov    %eax,(%ebx)
+  803109:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80310c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80310f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803112:	89 43 08             	mov    %eax,0x8(%ebx)
+  803115:	8b 45 14             	mov    0x14(%ebp),%eax
+  803118:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803121:	c9                   	leave
+  803122:	c3                   	ret
+
+00803123 <ipcring_req_slot>:
+  803123:	55                   	push   %ebp
+  803124:	89 e5                	mov    %esp,%ebp
+  803126:	8b 45 08             	mov    0x8(%ebp),%eax
+  803129:	8b 50 10             	mov    0x10(%eax),%edx
+  80312c:	8b 48 18             	mov    0x18(%eax),%ecx
+  80312f:	29 ca                	sub    %ecx,%edx
+  803131:	83 fa 07             	cmp    $0x7,%edx
+  803134:	77 0c                	ja     803142 <ipcring_req_slot+0x1f>
+  803136:	8b 50 10             	mov    0x10(%eax),%edx
+  803139:	83 e2 07             	and    $0x7,%edx
+  80313c:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803140:	5d                   	pop    %ebp
+  803141:	c3                   	ret
+  803142:	b8 00 00 00 00       	mov    $0x0,%eax
+  803147:	eb f7                	jmp    803140 <ipcring_req_slot+0x1d>
+
+00803149 <ipcring_req_push>:
+  803149:	55                   	push   %ebp
+  80314a:	89 e5                	mov    %esp,%ebp
+  80314c:	83 ec 08             	sub    $0x8,%esp
+  80314f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803152:	8b 42 10             	mov    0x10(%edx),%eax
+  803155:	83 c0 01             	add    $0x1,%eax
+  803158:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80315c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803161:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803165:	85 c0                	test   %eax,%eax
+  803167:	75 02                	jne    80316b <ipcring_req_push+0x22>
+  803169:	c9                   	leave
+  80316a:	c3                   	ret
+  80316b:	6a 00                	push   $0x0
+  80316d:	68 00 00 80 ee       	push   $0xee800000
+  803172:	ff 72 08             	push   0x8(%edx)
+  803175:	ff 72 04             	push   0x4(%edx)
+  803178:	e8 da e0 ff ff       	call   801257 <sys_ipc_send>
+  80317d:	83 c4 10             	add    $0x10,%esp
+  803180:	eb e7                	jmp    803169 <ipcring_req_push+0x20>
+
+00803182 <ipcring_rsp_wait>:
+  803182:	55                   	push   %ebp
+  803183:	89 e5                	mov    %esp,%ebp
+  803185:	53                   	push   %ebx
+  803186:	83 ec 04             	sub    $0x4,%esp
+  803189:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80318c:	8b 53 18             	mov    0x18(%ebx),%edx
+  80318f:	8b 43 10             	mov    0x10(%ebx),%eax
+  803192:	39 c2                	cmp    %eax,%edx
+  803194:	74 3c                	je     8031d2 <ipcring_rsp_wait+0x50>
+  803196:	8b 53 14             	mov    0x14(%ebx),%edx
+  803199:	8b 43 18             	mov    0x18(%ebx),%eax
+  80319c:	39 c2                	cmp    %eax,%edx
+  80319e:	75 23                	jne    8031c3 <ipcring_rsp_wait+0x41>
+  8031a0:	83 ec 08             	sub    $0x8,%esp
+  8031a3:	6a 00                	push   $0x0
+  8031a5:	6a 00                	push   $0x0
+  8031a7:	6a 00                	push   $0x0
+  8031a9:	6a 00                	push   $0x0
+  8031ab:	ff 73 0c             	push   0xc(%ebx)
+  8031ae:	ff 73 04             	push   0x4(%ebx)
+  8031b1:	e8 24 04 00 00       	call   8035da <ipc_call>
+  8031b6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8031b9:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031bc:	83 c4 20             	add    $0x20,%esp
+  8031bf:	39 c2                	cmp    %eax,%edx
+  8031c1:	74 dd                	je     8031a0 <ipcring_rsp_wait+0x1e>
+  8031c3:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031c6:	83 e0 07             	and    $0x7,%eax
+  8031c9:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8031cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031d0:	c9                   	leave
+  8031d1:	c3                   	ret
+  8031d2:	68 14 40 80 00       	push   $0x804014
+  8031d7:	68 b1 3f 80 00       	push   $0x803fb1
+  8031dc:	6a 3b                	push   $0x3b
+  8031de:	68 35 40 80 00       	push   $0x804035
+  8031e3:	e8 05 d1 ff ff       	call   8002ed <_panic>
+
+008031e8 <ipcring_rsp_pop>:
+  8031e8:	55                   	push   %ebp
+  8031e9:	89 e5                	mov    %esp,%ebp
+  8031eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031ee:	8b 42 18             	mov    0x18(%edx),%eax
+  8031f1:	83 c0 01             	add    $0x1,%eax
+  8031f4:	89 42 18             	mov    %eax,0x18(%edx)
+  8031f7:	5d                   	pop    %ebp
+  8031f8:	c3                   	ret
+
+008031f9 <ipcring_server_init>:
+  8031f9:	55                   	push   %ebp
+  8031fa:	89 e5                	mov    %esp,%ebp
+  8031fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803202:	89 10                	mov    %edx,(%eax)
+  803204:	8b 55 10             	mov    0x10(%ebp),%edx
+  803207:	89 50 04             	mov    %edx,0x4(%eax)
+  80320a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803211:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803218:	5d                   	pop    %ebp
+  803219:	c3                   	ret
+
+0080321a <ipcring_req_avail>:
+  80321a:	55                   	push   %ebp
+  80321b:	89 e5                	mov    %esp,%ebp
+  80321d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803220:	8b 02                	mov    (%edx),%eax
+  803222:	8b 40 10             	mov    0x10(%eax),%eax
+  803225:	2b 42 08             	sub    0x8(%edx),%eax
+  803228:	ba 08 00 00 00       	mov    $0x8,%edx
+  80322d:	39 d0                	cmp    %edx,%eax
+  80322f:	0f 47 c2             	cmova  %edx,%eax
+  803232:	5d                   	pop    %ebp
+  803233:	c3                   	ret
+
+00803234 <ipcring_req_peek>:
+  803234:	55                   	push   %ebp
+  803235:	89 e5                	mov    %esp,%ebp
+  803237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80323a:	8b 42 08             	mov    0x8(%edx),%eax
+  80323d:	83 e0 07             	and    $0x7,%eax
+  803240:	8b 12                	mov    (%edx),%edx
+  803242:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803246:	5d                   	pop    %ebp
+  803247:	c3                   	ret
+
+00803248 <ipcring_rsp_push>:
+  803248:	55                   	push   %ebp
+  803249:	89 e5                	mov    %esp,%ebp
+  80324b:	83 ec 08             	sub    $0x8,%esp
+  80324e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803251:	8b 41 08             	mov    0x8(%ecx),%eax
+  803254:	83 c0 01             	add    $0x1,%eax
+  803257:	89 41 08             	mov    %eax,0x8(%ecx)
+  80325a:	8b 11                	mov    (%ecx),%edx
+  80325c:	83 c2 14             	add    $0x14,%edx
+  80325f:	f0 87 02             	lock xchg %eax,(%edx)
+  803262:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803266:	75 02                	jne    80326a <ipcring_rsp_push+0x22>
+  803268:	c9                   	leave
+  803269:	c3                   	ret
+  80326a:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803271:	6a 00                	push   $0x0
+  803273:	68 00 00 80 ee       	push   $0xee800000
+  803278:	6a 00                	push   $0x0
+  80327a:	ff 71 04             	push   0x4(%ecx)
+  80327d:	e8 f8 de ff ff       	call   80117a <sys_ipc_try_send>
+  803282:	83 c4 10             	add    $0x10,%esp
+  803285:	eb e1                	jmp    803268 <ipcring_rsp_push+0x20>
+
+00803287 <ipcring_client_wait>:
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	83 ec 08             	sub    $0x8,%esp
+  80328d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803290:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803297:	8b 10                	mov    (%eax),%edx
+  803299:	8b 52 18             	mov    0x18(%edx),%edx
+  80329c:	3b 50 08             	cmp    0x8(%eax),%edx
+  80329f:	75 02                	jne    8032a3 <ipcring_client_wait+0x1c>
+  8032a1:	c9                   	leave
+  8032a2:	c3                   	ret
+  8032a3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8032aa:	6a 00                	push   $0x0
+  8032ac:	68 00 00 80 ee       	push   $0xee800000
+  8032b1:	6a 00                	push   $0x0
+  8032b3:	ff 70 04             	push   0x4(%eax)
+  8032b6:	e8 bf de ff ff       	call   80117a <sys_ipc_try_send>
+  8032bb:	83 c4 10             	add    $0x10,%esp
+  8032be:	eb e1                	jmp    8032a1 <ipcring_client_wait+0x1a>
+
+008032c0 <ipcring_server_sleep>:
+  8032c0:	55                   	push   %ebp
+  8032c1:	89 e5                	mov    %esp,%ebp
+  8032c3:	53                   	push   %ebx
+  8032c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032c7:	8b 01                	mov    (%ecx),%eax
+  8032c9:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8032cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032d1:	f0 87 02             	lock xchg %eax,(%edx)
+  8032d4:	8b 11                	mov    (%ecx),%edx
+  8032d6:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8032d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032de:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8032e1:	74 0e                	je     8032f1 <ipcring_server_sleep+0x31>
+  8032e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e8:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8032ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+008032f6 <devcons_close>:
+  8032f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fb:	c3                   	ret
+
+008032fc <devcons_stat>:
+  8032fc:	55                   	push   %ebp
+  8032fd:	89 e5                	mov    %esp,%ebp
+  8032ff:	83 ec 10             	sub    $0x10,%esp
+  803302:	68 43 40 80 00       	push   $0x804043
+  803307:	ff 75 0c             	push   0xc(%ebp)
+  80330a:	e8 b0 d7 ff ff       	call   800abf <strcpy>
+  80330f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803314:	c9                   	leave
+  803315:	c3                   	ret
+
+00803316 <devcons_write>:
+  803316:	55                   	push   %ebp
+  803317:	89 e5                	mov    %esp,%ebp
+  803319:	57                   	push   %edi
+  80331a:	56                   	push   %esi
+  80331b:	53                   	push   %ebx
+  80331c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803322:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803325:	85 ff                	test   %edi,%edi
+  803327:	74 51                	je     80337a <devcons_write+0x64>
+  803329:	be 00 00 00 00       	mov    $0x0,%esi
+  80332e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803333:	89 fb                	mov    %edi,%ebx
+  803335:	29 c3                	sub    %eax,%ebx
+  803337:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80333c:	39 d3                	cmp    %edx,%ebx
+  80333e:	0f 47 da             	cmova  %edx,%ebx
+  803341:	83 ec 04             	sub    $0x4,%esp
+  803344:	53                   	push   %ebx
+  803345:	03 45 0c             	add    0xc(%ebp),%eax
+  803348:	50                   	push   %eax
+  803349:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80334f:	50                   	push   %eax
+  803350:	e8 1a d9 ff ff       	call   800c6f <memmove>
+  803355:	83 c4 08             	add    $0x8,%esp
+  803358:	53                   	push   %ebx
+  803359:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80335f:	50                   	push   %eax
+  803360:	e8 d2 da ff ff       	call   800e37 <sys_cputs>
+  803365:	01 de                	add    %ebx,%esi
+  803367:	89 f0                	mov    %esi,%eax
+  803369:	83 c4 10             	add    $0x10,%esp
+  80336c:	39 fe                	cmp    %edi,%esi
+  80336e:	72 c3                	jb     803333 <devcons_write+0x1d>
+  803370:	89 f0                	mov    %esi,%eax
+  803372:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803375:	5b                   	pop    %ebx
+  803376:	5e                   	pop    %esi
+  803377:	5f                   	pop    %edi
+  803378:	5d                   	pop    %ebp
+  803379:	c3                   	ret
+  80337a:	be 00 00 00 00       	mov    $0x0,%esi
+  80337f:	eb ef                	jmp    803370 <devcons_write+0x5a>
+
+00803381 <devcons_read>:
+  803381:	55                   	push   %ebp
+  803382:	89 e5                	mov    %esp,%ebp
+  803384:	83 ec 08             	sub    $0x8,%esp
+  803387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803390:	75 07                	jne    803399 <devcons_read+0x18>
+  803392:	eb 1f                	jmp    8033b3 <devcons_read+0x32>
+  803394:	e8 3b db ff ff       	call   800ed4 <sys_yield>
+  803399:	e8 b7 da ff ff       	call   800e55 <sys_cgetc>
+  80339e:	85 c0                	test   %eax,%eax
+  8033a0:	74 f2                	je     803394 <devcons_read+0x13>
+  8033a2:	78 0f                	js     8033b3 <devcons_read+0x32>
+  8033a4:	83 f8 04             	cmp    $0x4,%eax
+  8033a7:	74 0c                	je     8033b5 <devcons_read+0x34>
+  8033a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033ac:	88 02                	mov    %al,(%edx)
+  8033ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033b3:	c9                   	leave
+  8033b4:	c3                   	ret
+  8033b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ba:	eb f7                	jmp    8033b3 <devcons_read+0x32>
+
+008033bc <cputchar>:
+  8033bc:	55                   	push   %ebp
+  8033bd:	89 e5                	mov    %esp,%ebp
+  8033bf:	83 ec 20             	sub    $0x20,%esp
+  8033c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c5:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8033c8:	6a 01                	push   $0x1
+  8033ca:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033cd:	50                   	push   %eax
+  8033ce:	e8 64 da ff ff       	call   800e37 <sys_cputs>
+  8033d3:	83 c4 10             	add    $0x10,%esp
+  8033d6:	c9                   	leave
+  8033d7:	c3                   	ret
+
+008033d8 <getchar>:
+  8033d8:	55                   	push   %ebp
+  8033d9:	89 e5                	mov    %esp,%ebp
+  8033db:	83 ec 1c             	sub    $0x1c,%esp
+  8033de:	6a 01                	push   $0x1
+  8033e0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033e3:	50                   	push   %eax
+  8033e4:	6a 00                	push   $0x0
+  8033e6:	e8 ac eb ff ff       	call   801f97 <read>
+  8033eb:	83 c4 10             	add    $0x10,%esp
+  8033ee:	85 c0                	test   %eax,%eax
+  8033f0:	78 06                	js     8033f8 <getchar+0x20>
+  8033f2:	74 06                	je     8033fa <getchar+0x22>
+  8033f4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8033f8:	c9                   	leave
+  8033f9:	c3                   	ret
+  8033fa:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8033ff:	eb f7                	jmp    8033f8 <getchar+0x20>
+
+00803401 <iscons>:
+  803401:	55                   	push   %ebp
+  803402:	89 e5                	mov    %esp,%ebp
+  803404:	83 ec 20             	sub    $0x20,%esp
+  803407:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80340a:	50                   	push   %eax
+  80340b:	ff 75 08             	push   0x8(%ebp)
+  80340e:	e8 22 e9 ff ff       	call   801d35 <fd_lookup>
+  803413:	83 c4 10             	add    $0x10,%esp
+  803416:	85 c0                	test   %eax,%eax
+  803418:	78 11                	js     80342b <iscons+0x2a>
+  80341a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80341d:	8b 15 5c 50 80 00    	mov    0x80505c,%edx
+  803423:	39 10                	cmp    %edx,(%eax)
+  803425:	0f 94 c0             	sete   %al
+  803428:	0f b6 c0             	movzbl %al,%eax
+  80342b:	c9                   	leave
+  80342c:	c3                   	ret
+
+0080342d <opencons>:
+  80342d:	55                   	push   %ebp
+  80342e:	89 e5                	mov    %esp,%ebp
+  803430:	83 ec 24             	sub    $0x24,%esp
+  803433:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803436:	50                   	push   %eax
+  803437:	e8 a9 e8 ff ff       	call   801ce5 <fd_alloc>
+  80343c:	83 c4 10             	add    $0x10,%esp
+  80343f:	85 c0                	test   %eax,%eax
+  803441:	78 3a                	js     80347d <opencons+0x50>
+  803443:	83 ec 04             	sub    $0x4,%esp
+  803446:	68 07 04 00 00       	push   $0x407
+  80344b:	ff 75 f4             	push   -0xc(%ebp)
+  80344e:	6a 00                	push   $0x0
+  803450:	e8 ca da ff ff       	call   800f1f <sys_page_alloc>
+  803455:	83 c4 10             	add    $0x10,%esp
+  803458:	85 c0                	test   %eax,%eax
+  80345a:	78 21                	js     80347d <opencons+0x50>
+  80345c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80345f:	8b 15 5c 50 80 00    	mov    0x80505c,%edx
+  803465:	89 10                	mov    %edx,(%eax)
+  803467:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80346a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803471:	83 ec 0c             	sub    $0xc,%esp
+  803474:	50                   	push   %eax
+  803475:	e8 44 e8 ff ff       	call   801cbe <fd2num>
+  80347a:	83 c4 10             	add    $0x10,%esp
+  80347d:	c9                   	leave
+  80347e:	c3                   	ret
+
+0080347f <set_pgfault_handler>:
+  80347f:	55                   	push   %ebp
+  803480:	89 e5                	mov    %esp,%ebp
+  803482:	53                   	push   %ebx
+  803483:	83 ec 04             	sub    $0x4,%esp
+  803486:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80348d:	74 0d                	je     80349c <set_pgfault_handler+0x1d>
+  80348f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803492:	a3 00 90 80 00       	mov    %eax,0x809000
+  803497:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80349a:	c9                   	leave
+  80349b:	c3                   	ret
+  80349c:	e8 14 da ff ff       	call   800eb5 <sys_getenvid>
+  8034a1:	89 c3                	mov    %eax,%ebx
+  8034a3:	83 ec 04             	sub    $0x4,%esp
+  8034a6:	6a 07                	push   $0x7
+  8034a8:	68 00 f0 7f ee       	push   $0xee7ff000
+  8034ad:	50                   	push   %eax
+  8034ae:	e8 6c da ff ff       	call   800f1f <sys_page_alloc>
+  8034b3:	83 c4 10             	add    $0x10,%esp
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	78 29                	js     8034e3 <set_pgfault_handler+0x64>
+  8034ba:	83 ec 08             	sub    $0x8,%esp
+  8034bd:	68 f7 34 80 00       	push   $0x8034f7
+  8034c2:	53                   	push   %ebx
+  8034c3:	e8 70 dc ff ff       	call   801138 <sys_env_set_pgfault_upcall>
+  8034c8:	83 c4 10             	add    $0x10,%esp
+  8034cb:	85 c0                	test   %eax,%eax
+  8034cd:	79 c0                	jns    80348f <set_pgfault_handler+0x10>
+  8034cf:	83 ec 04             	sub    $0x4,%esp
+  8034d2:	68 88 40 80 00       	push   $0x804088
+  8034d7:	6a 27                	push   $0x27
+  8034d9:	68 ba 40 80 00       	push   $0x8040ba
+  8034de:	e8 0a ce ff ff       	call   8002ed <_panic>
+  8034e3:	83 ec 04             	sub    $0x4,%esp
+  8034e6:	68 50 40 80 00       	push   $0x804050
+  8034eb:	6a 23                	push   $0x23
+  8034ed:	68 ba 40 80 00       	push   $0x8040ba
+  8034f2:	e8 f6 cd ff ff       	call   8002ed <_panic>
+
+008034f7 <_pgfault_upcall>:
+  8034f7:	54                   	push   %esp
+  8034f8:	a1 00 90 80 00       	mov    0x809000,%eax
+  8034fd:	ff d0                	call   *%eax
+  8034ff:	83 c4 04             	add    $0x4,%esp
+  803502:	89 e3                	mov    %esp,%ebx
+  803504:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803508:	8b 54 24 30          	mov    0x30(%esp),%edx
+  80350c:	89 d4                	mov    %edx,%esp
+  80350e:	51                   	push   %ecx
+  80350f:	89 dc                	mov    %ebx,%esp
+  803511:	83 ea 04             	sub    $0x4,%edx
+  803514:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803518:	83 c4 08             	add    $0x8,%esp
+  80351b:	61                   	popa
+  80351c:	83 c4 04             	add    $0x4,%esp
+  80351f:	9d                   	popf
+  803520:	5c                   	pop    %esp
+  803521:	c3                   	ret
+
+00803522 <ipc_recv>:
+  803522:	55                   	push   %ebp
+  803523:	89 e5                	mov    %esp,%ebp
+  803525:	56                   	push   %esi
+  803526:	53                   	push   %ebx
+  803527:	8b 75 08             	mov    0x8(%ebp),%esi
+  80352a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80352d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803530:	85 c0                	test   %eax,%eax
+  803532:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803537:	0f 44 c2             	cmove  %edx,%eax
+  80353a:	83 ec 0c             	sub    $0xc,%esp
+  80353d:	50                   	push   %eax
+  80353e:	e8 87 dc ff ff       	call   8011ca <sys_ipc_recv>
+  803543:	83 c4 10             	add    $0x10,%esp
+  803546:	85 c0                	test   %eax,%eax
+  803548:	78 2a                	js     803574 <ipc_recv+0x52>
+  80354a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80354f:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803555:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  80355b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803561:	85 f6                	test   %esi,%esi
+  803563:	74 02                	je     803567 <ipc_recv+0x45>
+  803565:	89 0e                	mov    %ecx,(%esi)
+  803567:	85 db                	test   %ebx,%ebx
+  803569:	74 02                	je     80356d <ipc_recv+0x4b>
+  80356b:	89 13                	mov    %edx,(%ebx)
+  80356d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803570:	5b                   	pop    %ebx
+  803571:	5e                   	pop    %esi
+  803572:	5d                   	pop    %ebp
+  803573:	c3                   	ret
+  803574:	ba 00 00 00 00       	mov    $0x0,%edx
+  803579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80357e:	eb e1                	jmp    803561 <ipc_recv+0x3f>
+
+00803580 <ipc_send>:
+  803580:	55                   	push   %ebp
+  803581:	89 e5                	mov    %esp,%ebp
+  803583:	57                   	push   %edi
+  803584:	56                   	push   %esi
+  803585:	53                   	push   %ebx
+  803586:	83 ec 0c             	sub    $0xc,%esp
+  803589:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80358c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80358f:	8b 75 14             	mov    0x14(%ebp),%esi
+  803592:	85 db                	test   %ebx,%ebx
+  803594:	74 1e                	je     8035b4 <ipc_send+0x34>
+  803596:	56                   	push   %esi
+  803597:	53                   	push   %ebx
+  803598:	57                   	push   %edi
+  803599:	ff 75 08             	push   0x8(%ebp)
+  80359c:	e8 b6 dc ff ff       	call   801257 <sys_ipc_send>
+  8035a1:	83 c4 10             	add    $0x10,%esp
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	74 2a                	je     8035d2 <ipc_send+0x52>
+  8035a8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8035ab:	75 13                	jne    8035c0 <ipc_send+0x40>
+  8035ad:	e8 22 d9 ff ff       	call   800ed4 <sys_yield>
+  8035b2:	eb e2                	jmp    803596 <ipc_send+0x16>
+  8035b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b9:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8035be:	eb d6                	jmp    803596 <ipc_send+0x16>
+  8035c0:	50                   	push   %eax
+  8035c1:	68 c8 40 80 00       	push   $0x8040c8
+  8035c6:	6a 4f                	push   $0x4f
+  8035c8:	68 0b 41 80 00       	push   $0x80410b
+  8035cd:	e8 1b cd ff ff       	call   8002ed <_panic>
+  8035d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035d5:	5b                   	pop    %ebx
+  8035d6:	5e                   	pop    %esi
+  8035d7:	5f                   	pop    %edi
+  8035d8:	5d                   	pop    %ebp
+  8035d9:	c3                   	ret
+
+008035da <ipc_call>:
+  8035da:	55                   	push   %ebp
+  8035db:	89 e5                	mov    %esp,%ebp
+  8035dd:	57                   	push   %edi
+  8035de:	56                   	push   %esi
+  8035df:	53                   	push   %ebx
+  8035e0:	83 ec 0c             	sub    $0xc,%esp
+  8035e3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035e7:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8035ec:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8035f0:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8035f4:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8035f9:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8035fd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803601:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803606:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  80360a:	eb 05                	jmp    803611 <ipc_call+0x37>
+  80360c:	e8 c3 d8 ff ff       	call   800ed4 <sys_yield>
+  803611:	83 ec 0c             	sub    $0xc,%esp
+  803614:	56                   	push   %esi
+  803615:	53                   	push   %ebx
+  803616:	57                   	push   %edi
+  803617:	ff 75 0c             	push   0xc(%ebp)
+  80361a:	ff 75 08             	push   0x8(%ebp)
+  80361d:	e8 85 dc ff ff       	call   8012a7 <sys_ipc_call>
+  803622:	83 c4 20             	add    $0x20,%esp
+  803625:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803628:	74 e2                	je     80360c <ipc_call+0x32>
+  80362a:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80362d:	74 2d                	je     80365c <ipc_call+0x82>
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	78 4f                	js     803682 <ipc_call+0xa8>
+  803633:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803637:	74 10                	je     803649 <ipc_call+0x6f>
+  803639:	a1 14 60 80 00       	mov    0x806014,%eax
+  80363e:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803644:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803647:	89 02                	mov    %eax,(%edx)
+  803649:	a1 14 60 80 00       	mov    0x806014,%eax
+  80364e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803654:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803657:	5b                   	pop    %ebx
+  803658:	5e                   	pop    %esi
+  803659:	5f                   	pop    %edi
+  80365a:	5d                   	pop    %ebp
+  80365b:	c3                   	ret
+  80365c:	ff 75 14             	push   0x14(%ebp)
+  80365f:	ff 75 10             	push   0x10(%ebp)
+  803662:	ff 75 0c             	push   0xc(%ebp)
+  803665:	ff 75 08             	push   0x8(%ebp)
+  803668:	e8 13 ff ff ff       	call   803580 <ipc_send>
+  80366d:	83 c4 0c             	add    $0xc,%esp
+  803670:	ff 75 1c             	push   0x1c(%ebp)
+  803673:	ff 75 18             	push   0x18(%ebp)
+  803676:	6a 00                	push   $0x0
+  803678:	e8 a5 fe ff ff       	call   803522 <ipc_recv>
+  80367d:	83 c4 10             	add    $0x10,%esp
+  803680:	eb d2                	jmp    803654 <ipc_call+0x7a>
+  803682:	50                   	push   %eax
+  803683:	68 15 41 80 00       	push   $0x804115
+  803688:	6a 6d                	push   $0x6d
+  80368a:	68 0b 41 80 00       	push   $0x80410b
+  80368f:	e8 59 cc ff ff       	call   8002ed <_panic>
+
+00803694 <ipc_reply_recv>:
+  803694:	55                   	push   %ebp
+  803695:	89 e5                	mov    %esp,%ebp
+  803697:	57                   	push   %edi
+  803698:	56                   	push   %esi
+  803699:	53                   	push   %ebx
+  80369a:	83 ec 0c             	sub    $0xc,%esp
+  80369d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8036a0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8036a3:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8036a6:	85 db                	test   %ebx,%ebx
+  8036a8:	0f 84 ac 00 00 00    	je     80375a <ipc_reply_recv+0xc6>
+  8036ae:	85 f6                	test   %esi,%esi
+  8036b0:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8036b5:	0f 45 c6             	cmovne %esi,%eax
+  8036b8:	83 ec 0c             	sub    $0xc,%esp
+  8036bb:	50                   	push   %eax
+  8036bc:	ff 75 14             	push   0x14(%ebp)
+  8036bf:	53                   	push   %ebx
+  8036c0:	ff 75 0c             	push   0xc(%ebp)
+  8036c3:	ff 75 08             	push   0x8(%ebp)
+  8036c6:	e8 fd db ff ff       	call   8012c8 <sys_ipc_reply_recv>
+  8036cb:	83 c4 20             	add    $0x20,%esp
+  8036ce:	85 c0                	test   %eax,%eax
+  8036d0:	78 3a                	js     80370c <ipc_reply_recv+0x78>
+  8036d2:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8036d6:	74 10                	je     8036e8 <ipc_reply_recv+0x54>
+  8036d8:	a1 14 60 80 00       	mov    0x806014,%eax
+  8036dd:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8036e3:	8b 55 18             	mov    0x18(%ebp),%edx
+  8036e6:	89 02                	mov    %eax,(%edx)
+  8036e8:	85 ff                	test   %edi,%edi
+  8036ea:	74 0d                	je     8036f9 <ipc_reply_recv+0x65>
+  8036ec:	a1 14 60 80 00       	mov    0x806014,%eax
+  8036f1:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8036f7:	89 07                	mov    %eax,(%edi)
+  8036f9:	a1 14 60 80 00       	mov    0x806014,%eax
+  8036fe:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803704:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803707:	5b                   	pop    %ebx
+  803708:	5e                   	pop    %esi
+  803709:	5f                   	pop    %edi
+  80370a:	5d                   	pop    %ebp
+  80370b:	c3                   	ret
+  80370c:	ff 75 14             	push   0x14(%ebp)
+  80370f:	53                   	push   %ebx
+  803710:	ff 75 0c             	push   0xc(%ebp)
+  803713:	ff 75 08             	push   0x8(%ebp)
+  803716:	e8 5f da ff ff       	call   80117a <sys_ipc_try_send>
+  80371b:	89 c2                	mov    %eax,%edx
+  80371d:	c1 ea 1f             	shr    $0x1f,%edx
+  803720:	83 c4 10             	add    $0x10,%esp
+  803723:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803726:	0f 95 c1             	setne  %cl
+  803729:	84 d1                	test   %dl,%cl
+  80372b:	74 05                	je     803732 <ipc_reply_recv+0x9e>
+  80372d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803730:	75 12                	jne    803744 <ipc_reply_recv+0xb0>
+  803732:	83 ec 04             	sub    $0x4,%esp
+  803735:	57                   	push   %edi
+  803736:	56                   	push   %esi
+  803737:	ff 75 18             	push   0x18(%ebp)
+  80373a:	e8 e3 fd ff ff       	call   803522 <ipc_recv>
+  80373f:	83 c4 10             	add    $0x10,%esp
+  803742:	eb c0                	jmp    803704 <ipc_reply_recv+0x70>
+  803744:	83 ec 04             	sub    $0x4,%esp
+  803747:	50                   	push   %eax
+  803748:	ff 75 08             	push   0x8(%ebp)
+  80374b:	68 e8 40 80 00       	push   $0x8040e8
+  803750:	e8 73 cc ff ff       	call   8003c8 <cprintf>
+  803755:	83 c4 10             	add    $0x10,%esp
+  803758:	eb d8                	jmp    803732 <ipc_reply_recv+0x9e>
+  80375a:	85 f6                	test   %esi,%esi
+  80375c:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803761:	0f 45 c6             	cmovne %esi,%eax
+  803764:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803769:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803770:	e9 43 ff ff ff       	jmp    8036b8 <ipc_reply_recv+0x24>
+
+00803775 <ipc_find_env>:
+  803775:	55                   	push   %ebp
+  803776:	89 e5                	mov    %esp,%ebp
+  803778:	83 ec 14             	sub    $0x14,%esp
+  80377b:	ff 75 08             	push   0x8(%ebp)
+  80377e:	e8 95 d9 ff ff       	call   801118 <sys_env_service>
+  803783:	85 c0                	test   %eax,%eax
+  803785:	ba 00 00 00 00       	mov    $0x0,%edx
+  80378a:	0f 48 c2             	cmovs  %edx,%eax
+  80378d:	c9                   	leave
+  80378e:	c3                   	ret
+
+0080378f <pageref>:
+  80378f:	55                   	push   %ebp
+  803790:	89 e5                	mov    %esp,%ebp
+  803792:	8b 45 08             	mov    0x8(%ebp),%eax
+  803795:	89 c2                	mov    %eax,%edx
+  803797:	c1 ea 16             	shr    $0x16,%edx
+  80379a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8037a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037a6:	f6 c1 01             	test   $0x1,%cl
+  8037a9:	74 22                	je     8037cd <pageref+0x3e>
+  8037ab:	c1 e8 0c             	shr    $0xc,%eax
+  8037ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037b5:	a8 01                	test   $0x1,%al
+  8037b7:	74 14                	je     8037cd <pageref+0x3e>
+  8037b9:	c1 e8 0c             	shr    $0xc,%eax
+  8037bc:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8037bf:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8037c6:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8037ca:	0f b7 d2             	movzwl %dx,%edx
+  8037cd:	89 d0                	mov    %edx,%eax
+  8037cf:	5d                   	pop    %ebp
+  8037d0:	c3                   	ret
+
+008037d1 <__udivmoddi4>:
+  8037d1:	55                   	push   %ebp
+  8037d2:	57                   	push   %edi
+  8037d3:	56                   	push   %esi
+  8037d4:	53                   	push   %ebx
+  8037d5:	83 ec 24             	sub    $0x24,%esp
+  8037d8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8037dc:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8037e0:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8037e4:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8037e8:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8037ec:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8037f0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8037f4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8037f8:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8037fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803801:	ba 00 00 00 00       	mov    $0x0,%edx
+  803806:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80380b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803812:	00 
+  803813:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80381a:	00 
+  80381b:	89 fb                	mov    %edi,%ebx
+  80381d:	eb 08                	jmp    803827 <__udivmoddi4+0x56>
+  80381f:	83 e9 01             	sub    $0x1,%ecx
+  803822:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803825:	74 68                	je     80388f <__udivmoddi4+0xbe>
+  803827:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80382b:	01 c0                	add    %eax,%eax
+  80382d:	89 c6                	mov    %eax,%esi
+  80382f:	89 d7                	mov    %edx,%edi
+  803831:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803835:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803839:	0f ad d0             	shrd   %cl,%edx,%eax
+  80383c:	d3 ea                	shr    %cl,%edx
+  80383e:	f6 c1 20             	test   $0x20,%cl
+  803841:	74 04                	je     803847 <__udivmoddi4+0x76>
+  803843:	89 d0                	mov    %edx,%eax
+  803845:	31 d2                	xor    %edx,%edx
+  803847:	83 e0 01             	and    $0x1,%eax
+  80384a:	89 04 24             	mov    %eax,(%esp)
+  80384d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803854:	00 
+  803855:	8b 04 24             	mov    (%esp),%eax
+  803858:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80385c:	09 f0                	or     %esi,%eax
+  80385e:	09 fa                	or     %edi,%edx
+  803860:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803864:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803868:	39 f0                	cmp    %esi,%eax
+  80386a:	89 d5                	mov    %edx,%ebp
+  80386c:	19 fd                	sbb    %edi,%ebp
+  80386e:	72 af                	jb     80381f <__udivmoddi4+0x4e>
+  803870:	29 f0                	sub    %esi,%eax
+  803872:	19 fa                	sbb    %edi,%edx
+  803874:	89 cf                	mov    %ecx,%edi
+  803876:	c1 ef 05             	shr    $0x5,%edi
+  803879:	83 e7 01             	and    $0x1,%edi
+  80387c:	89 fe                	mov    %edi,%esi
+  80387e:	83 f6 01             	xor    $0x1,%esi
+  803881:	d3 e6                	shl    %cl,%esi
+  803883:	d3 e7                	shl    %cl,%edi
+  803885:	09 74 24 18          	or     %esi,0x18(%esp)
+  803889:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80388d:	eb 90                	jmp    80381f <__udivmoddi4+0x4e>
+  80388f:	85 db                	test   %ebx,%ebx
+  803891:	74 05                	je     803898 <__udivmoddi4+0xc7>
+  803893:	89 03                	mov    %eax,(%ebx)
+  803895:	89 53 04             	mov    %edx,0x4(%ebx)
+  803898:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80389c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8038a0:	83 c4 24             	add    $0x24,%esp
+  8038a3:	5b                   	pop    %ebx
+  8038a4:	5e                   	pop    %esi
+  8038a5:	5f                   	pop    %edi
+  8038a6:	5d                   	pop    %ebp
+  8038a7:	c3                   	ret
+
+008038a8 <__udivdi3>:
+  8038a8:	83 ec 08             	sub    $0x8,%esp
+  8038ab:	6a 00                	push   $0x0
+  8038ad:	ff 74 24 1c          	push   0x1c(%esp)
+  8038b1:	ff 74 24 1c          	push   0x1c(%esp)
+  8038b5:	ff 74 24 1c          	push   0x1c(%esp)
+  8038b9:	ff 74 24 1c          	push   0x1c(%esp)
+  8038bd:	e8 0f ff ff ff       	call   8037d1 <__udivmoddi4>
+  8038c2:	83 c4 1c             	add    $0x1c,%esp
+  8038c5:	c3                   	ret
+
+008038c6 <__umoddi3>:
+  8038c6:	83 ec 18             	sub    $0x18,%esp
+  8038c9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8038cd:	50                   	push   %eax
+  8038ce:	ff 74 24 2c          	push   0x2c(%esp)
+  8038d2:	ff 74 24 2c          	push   0x2c(%esp)
+  8038d6:	ff 74 24 2c          	push   0x2c(%esp)
+  8038da:	ff 74 24 2c          	push   0x2c(%esp)
+  8038de:	e8 ee fe ff ff       	call   8037d1 <__udivmoddi4>
+  8038e3:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8038e7:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8038eb:	83 c4 2c             	add    $0x2c,%esp
+  8038ee:	c3                   	ret
+
+008038ef <__divdi3>:
+  8038ef:	53                   	push   %ebx
+  8038f0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038f4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038f8:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8038fc:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803900:	85 d2                	test   %edx,%edx
+  803902:	78 12                	js     803916 <__divdi3+0x27>
+  803904:	85 db                	test   %ebx,%ebx
+  803906:	78 2e                	js     803936 <__divdi3+0x47>
+  803908:	53                   	push   %ebx
+  803909:	51                   	push   %ecx
+  80390a:	52                   	push   %edx
+  80390b:	50                   	push   %eax
+  80390c:	e8 97 ff ff ff       	call   8038a8 <__udivdi3>
+  803911:	83 c4 10             	add    $0x10,%esp
+  803914:	eb 1e                	jmp    803934 <__divdi3+0x45>
+  803916:	f7 d8                	neg    %eax
+  803918:	83 d2 00             	adc    $0x0,%edx
+  80391b:	f7 da                	neg    %edx
+  80391d:	85 db                	test   %ebx,%ebx
+  80391f:	78 2a                	js     80394b <__divdi3+0x5c>
+  803921:	53                   	push   %ebx
+  803922:	51                   	push   %ecx
+  803923:	52                   	push   %edx
+  803924:	50                   	push   %eax
+  803925:	e8 7e ff ff ff       	call   8038a8 <__udivdi3>
+  80392a:	83 c4 10             	add    $0x10,%esp
+  80392d:	f7 d8                	neg    %eax
+  80392f:	83 d2 00             	adc    $0x0,%edx
+  803932:	f7 da                	neg    %edx
+  803934:	5b                   	pop    %ebx
+  803935:	c3                   	ret
+  803936:	f7 d9                	neg    %ecx
+  803938:	83 d3 00             	adc    $0x0,%ebx
+  80393b:	f7 db                	neg    %ebx
+  80393d:	53                   	push   %ebx
+  80393e:	51                   	push   %ecx
+  80393f:	52                   	push   %edx
+  803940:	50                   	push   %eax
+  803941:	e8 62 ff ff ff       	call   8038a8 <__udivdi3>
+  803946:	83 c4 10             	add    $0x10,%esp
+  803949:	eb e2                	jmp    80392d <__divdi3+0x3e>
+  80394b:	f7 d9                	neg    %ecx
+  80394d:	83 d3 00             	adc    $0x0,%ebx
+  803950:	f7 db                	neg    %ebx
+  803952:	53                   	push   %ebx
+  803953:	51                   	push   %ecx
+  803954:	52                   	push   %edx
+  803955:	50                   	push   %eax
+  803956:	e8 4d ff ff ff       	call   8038a8 <__udivdi3>
+  80395b:	83 c4 10             	add    $0x10,%esp
+  80395e:	eb d4                	jmp    803934 <__divdi3+0x45>
+
+00803960 <__moddi3>:
+  803960:	55                   	push   %ebp
+  803961:	57                   	push   %edi
+  803962:	56                   	push   %esi
+  803963:	53                   	push   %ebx
+  803964:	83 ec 0c             	sub    $0xc,%esp
+  803967:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80396b:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80396f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803973:	89 e9                	mov    %ebp,%ecx
+  803975:	f7 d9                	neg    %ecx
+  803977:	89 d0                	mov    %edx,%eax
+  803979:	83 d0 00             	adc    $0x0,%eax
+  80397c:	f7 d8                	neg    %eax
+  80397e:	0f 49 e9             	cmovns %ecx,%ebp
+  803981:	0f 49 d0             	cmovns %eax,%edx
+  803984:	52                   	push   %edx
+  803985:	55                   	push   %ebp
+  803986:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80398a:	f7 da                	neg    %edx
+  80398c:	89 d8                	mov    %ebx,%eax
+  80398e:	83 d0 00             	adc    $0x0,%eax
+  803991:	f7 d8                	neg    %eax
+  803993:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803998:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80399c:	0f 48 c3             	cmovs  %ebx,%eax
+  80399f:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8039a3:	ff 74 24 0c          	push   0xc(%esp)
+  8039a7:	ff 74 24 0c          	push   0xc(%esp)
+  8039ab:	e8 16 ff ff ff       	call   8038c6 <__umoddi3>
+  8039b0:	83 c4 10             	add    $0x10,%esp
+  8039b3:	85 db                	test   %ebx,%ebx
+  8039b5:	78 08                	js     8039bf <__moddi3+0x5f>
+  8039b7:	83 c4 0c             	add    $0xc,%esp
+  8039ba:	5b                   	pop    %ebx
+  8039bb:	5e                   	pop    %esi
+  8039bc:	5f                   	pop    %edi
+  8039bd:	5d                   	pop    %ebp
+  8039be:	c3                   	ret
+  8039bf:	f7 d8                	neg    %eax
+  8039c1:	83 d2 00             	adc    $0x0,%edx
+  8039c4:	f7 da                	neg    %edx
+  8039c6:	eb ef                	jmp    8039b7 <__moddi3+0x57>
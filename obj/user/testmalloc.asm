@@ -0,0 +1,5476 @@
+
+obj/user/testmalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b1 00 00 00       	call   8000e2 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	eb 22                	jmp    80005e <umain+0x2b>
+  80003c:	e8 ea 00 00 00       	call   80012b <exit>
+  800041:	eb 31                	jmp    800074 <umain+0x41>
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 00                	push   $0x0
+  800048:	6a 00                	push   $0x0
+  80004a:	83 c3 05             	add    $0x5,%ebx
+  80004d:	53                   	push   %ebx
+  80004e:	e8 d7 04 00 00       	call   80052a <strtol>
+  800053:	89 04 24             	mov    %eax,(%esp)
+  800056:	e8 82 20 00 00       	call   8020dd <free>
+  80005b:	83 c4 10             	add    $0x10,%esp
+  80005e:	83 ec 0c             	sub    $0xc,%esp
+  800061:	68 a0 36 80 00       	push   $0x8036a0
+  800066:	e8 f0 00 00 00       	call   80015b <readline>
+  80006b:	89 c3                	mov    %eax,%ebx
+  80006d:	83 c4 10             	add    $0x10,%esp
+  800070:	85 c0                	test   %eax,%eax
+  800072:	74 c8                	je     80003c <umain+0x9>
+  800074:	83 ec 04             	sub    $0x4,%esp
+  800077:	6a 05                	push   $0x5
+  800079:	68 a3 36 80 00       	push   $0x8036a3
+  80007e:	53                   	push   %ebx
+  80007f:	e8 3b 04 00 00       	call   8004bf <memcmp>
+  800084:	83 c4 10             	add    $0x10,%esp
+  800087:	85 c0                	test   %eax,%eax
+  800089:	74 b8                	je     800043 <umain+0x10>
+  80008b:	83 ec 04             	sub    $0x4,%esp
+  80008e:	6a 07                	push   $0x7
+  800090:	68 a9 36 80 00       	push   $0x8036a9
+  800095:	53                   	push   %ebx
+  800096:	e8 24 04 00 00       	call   8004bf <memcmp>
+  80009b:	83 c4 10             	add    $0x10,%esp
+  80009e:	85 c0                	test   %eax,%eax
+  8000a0:	75 2b                	jne    8000cd <umain+0x9a>
+  8000a2:	83 ec 04             	sub    $0x4,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	6a 00                	push   $0x0
+  8000a9:	83 c3 07             	add    $0x7,%ebx
+  8000ac:	53                   	push   %ebx
+  8000ad:	e8 78 04 00 00       	call   80052a <strtol>
+  8000b2:	89 04 24             	mov    %eax,(%esp)
+  8000b5:	e8 cf 20 00 00       	call   802189 <malloc>
+  8000ba:	83 c4 08             	add    $0x8,%esp
+  8000bd:	50                   	push   %eax
+  8000be:	68 b1 36 80 00       	push   $0x8036b1
+  8000c3:	e8 a4 1b 00 00       	call   801c6c <printf>
+  8000c8:	83 c4 10             	add    $0x10,%esp
+  8000cb:	eb 91                	jmp    80005e <umain+0x2b>
+  8000cd:	83 ec 0c             	sub    $0xc,%esp
+  8000d0:	68 b8 36 80 00       	push   $0x8036b8
+  8000d5:	e8 92 1b 00 00       	call   801c6c <printf>
+  8000da:	83 c4 10             	add    $0x10,%esp
+  8000dd:	e9 7c ff ff ff       	jmp    80005e <umain+0x2b>
+
+008000e2 <libmain>:
+  8000e2:	55                   	push   %ebp
+  8000e3:	89 e5                	mov    %esp,%ebp
+  8000e5:	56                   	push   %esi
+  8000e6:	53                   	push   %ebx
+  8000e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ed:	e8 9b 05 00 00       	call   80068d <sys_getenvid>
+  8000f2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f7:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000fd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800102:	a3 14 54 80 00       	mov    %eax,0x805414
+  800107:	85 db                	test   %ebx,%ebx
+  800109:	7e 07                	jle    800112 <libmain+0x30>
+  80010b:	8b 06                	mov    (%esi),%eax
+  80010d:	a3 00 40 80 00       	mov    %eax,0x804000
+  800112:	83 ec 08             	sub    $0x8,%esp
+  800115:	56                   	push   %esi
+  800116:	53                   	push   %ebx
+  800117:	e8 17 ff ff ff       	call   800033 <umain>
+  80011c:	e8 0a 00 00 00       	call   80012b <exit>
+  800121:	83 c4 10             	add    $0x10,%esp
+  800124:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800127:	5b                   	pop    %ebx
+  800128:	5e                   	pop    %esi
+  800129:	5d                   	pop    %ebp
+  80012a:	c3                   	ret
+
+0080012b <exit>:
+  80012b:	55                   	push   %ebp
+  80012c:	89 e5                	mov    %esp,%ebp
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	a1 14 54 80 00       	mov    0x805414,%eax
+  800136:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	75 14                	jne    800154 <exit+0x29>
+  800140:	e8 ea 0f 00 00       	call   80112f <close_all>
+  800145:	83 ec 0c             	sub    $0xc,%esp
+  800148:	6a 00                	push   $0x0
+  80014a:	e8 fd 04 00 00       	call   80064c <sys_env_destroy>
+  80014f:	83 c4 10             	add    $0x10,%esp
+  800152:	c9                   	leave
+  800153:	c3                   	ret
+  800154:	e8 60 0c 00 00       	call   800db9 <sys_lease_complete>
+  800159:	eb e5                	jmp    800140 <exit+0x15>
+
+0080015b <readline>:
+  80015b:	55                   	push   %ebp
+  80015c:	89 e5                	mov    %esp,%ebp
+  80015e:	57                   	push   %edi
+  80015f:	56                   	push   %esi
+  800160:	53                   	push   %ebx
+  800161:	83 ec 0c             	sub    $0xc,%esp
+  800164:	8b 45 08             	mov    0x8(%ebp),%eax
+  800167:	85 c0                	test   %eax,%eax
+  800169:	74 13                	je     80017e <readline+0x23>
+  80016b:	83 ec 04             	sub    $0x4,%esp
+  80016e:	50                   	push   %eax
+  80016f:	68 d3 37 80 00       	push   $0x8037d3
+  800174:	6a 01                	push   $0x1
+  800176:	e8 da 1a 00 00       	call   801c55 <fprintf>
+  80017b:	83 c4 10             	add    $0x10,%esp
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	6a 00                	push   $0x0
+  800183:	e8 6d 28 00 00       	call   8029f5 <iscons>
+  800188:	89 c7                	mov    %eax,%edi
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	be 00 00 00 00       	mov    $0x0,%esi
+  800192:	eb 4b                	jmp    8001df <readline+0x84>
+  800194:	b8 00 00 00 00       	mov    $0x0,%eax
+  800199:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  80019c:	75 08                	jne    8001a6 <readline+0x4b>
+  80019e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a1:	5b                   	pop    %ebx
+  8001a2:	5e                   	pop    %esi
+  8001a3:	5f                   	pop    %edi
+  8001a4:	5d                   	pop    %ebp
+  8001a5:	c3                   	ret
+  8001a6:	83 ec 08             	sub    $0x8,%esp
+  8001a9:	53                   	push   %ebx
+  8001aa:	68 d4 36 80 00       	push   $0x8036d4
+  8001af:	e8 9a 29 00 00       	call   802b4e <cprintf>
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bc:	eb e0                	jmp    80019e <readline+0x43>
+  8001be:	85 ff                	test   %edi,%edi
+  8001c0:	75 05                	jne    8001c7 <readline+0x6c>
+  8001c2:	83 ee 01             	sub    $0x1,%esi
+  8001c5:	eb 18                	jmp    8001df <readline+0x84>
+  8001c7:	83 ec 0c             	sub    $0xc,%esp
+  8001ca:	6a 08                	push   $0x8
+  8001cc:	e8 df 27 00 00       	call   8029b0 <cputchar>
+  8001d1:	83 c4 10             	add    $0x10,%esp
+  8001d4:	eb ec                	jmp    8001c2 <readline+0x67>
+  8001d6:	88 9e 00 50 80 00    	mov    %bl,0x805000(%esi)
+  8001dc:	8d 76 01             	lea    0x1(%esi),%esi
+  8001df:	e8 e8 27 00 00       	call   8029cc <getchar>
+  8001e4:	89 c3                	mov    %eax,%ebx
+  8001e6:	85 c0                	test   %eax,%eax
+  8001e8:	78 aa                	js     800194 <readline+0x39>
+  8001ea:	83 f8 08             	cmp    $0x8,%eax
+  8001ed:	0f 94 c0             	sete   %al
+  8001f0:	83 fb 7f             	cmp    $0x7f,%ebx
+  8001f3:	0f 94 c2             	sete   %dl
+  8001f6:	08 d0                	or     %dl,%al
+  8001f8:	74 04                	je     8001fe <readline+0xa3>
+  8001fa:	85 f6                	test   %esi,%esi
+  8001fc:	7f c0                	jg     8001be <readline+0x63>
+  8001fe:	83 fb 1f             	cmp    $0x1f,%ebx
+  800201:	7e 1a                	jle    80021d <readline+0xc2>
+  800203:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  800209:	7f 12                	jg     80021d <readline+0xc2>
+  80020b:	85 ff                	test   %edi,%edi
+  80020d:	74 c7                	je     8001d6 <readline+0x7b>
+  80020f:	83 ec 0c             	sub    $0xc,%esp
+  800212:	53                   	push   %ebx
+  800213:	e8 98 27 00 00       	call   8029b0 <cputchar>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	eb b9                	jmp    8001d6 <readline+0x7b>
+  80021d:	83 fb 0a             	cmp    $0xa,%ebx
+  800220:	74 05                	je     800227 <readline+0xcc>
+  800222:	83 fb 0d             	cmp    $0xd,%ebx
+  800225:	75 b8                	jne    8001df <readline+0x84>
+  800227:	85 ff                	test   %edi,%edi
+  800229:	75 11                	jne    80023c <readline+0xe1>
+  80022b:	c6 86 00 50 80 00 00 	movb   $0x0,0x805000(%esi)
+  800232:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800237:	e9 62 ff ff ff       	jmp    80019e <readline+0x43>
+  80023c:	83 ec 0c             	sub    $0xc,%esp
+  80023f:	6a 0a                	push   $0xa
+  800241:	e8 6a 27 00 00       	call   8029b0 <cputchar>
+  800246:	83 c4 10             	add    $0x10,%esp
+  800249:	eb e0                	jmp    80022b <readline+0xd0>
+
+0080024b <strlen>:
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800251:	80 3a 00             	cmpb   $0x0,(%edx)
+  800254:	74 10                	je     800266 <strlen+0x1b>
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	83 c0 01             	add    $0x1,%eax
+  80025e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800262:	75 f7                	jne    80025b <strlen+0x10>
+  800264:	5d                   	pop    %ebp
+  800265:	c3                   	ret
+  800266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026b:	eb f7                	jmp    800264 <strlen+0x19>
+
+0080026d <strnlen>:
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800273:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800276:	85 d2                	test   %edx,%edx
+  800278:	74 16                	je     800290 <strnlen+0x23>
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800283:	74 09                	je     80028e <strnlen+0x21>
+  800285:	83 c0 01             	add    $0x1,%eax
+  800288:	39 d0                	cmp    %edx,%eax
+  80028a:	75 f3                	jne    80027f <strnlen+0x12>
+  80028c:	89 d0                	mov    %edx,%eax
+  80028e:	5d                   	pop    %ebp
+  80028f:	c3                   	ret
+  800290:	b8 00 00 00 00       	mov    $0x0,%eax
+  800295:	eb f7                	jmp    80028e <strnlen+0x21>
+
+00800297 <strcpy>:
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	53                   	push   %ebx
+  80029b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80029e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8002aa:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8002ad:	83 c0 01             	add    $0x1,%eax
+  8002b0:	84 d2                	test   %dl,%dl
+  8002b2:	75 f2                	jne    8002a6 <strcpy+0xf>
+  8002b4:	89 c8                	mov    %ecx,%eax
+  8002b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002b9:	c9                   	leave
+  8002ba:	c3                   	ret
+
+008002bb <strcat>:
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	53                   	push   %ebx
+  8002bf:	83 ec 10             	sub    $0x10,%esp
+  8002c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002c5:	53                   	push   %ebx
+  8002c6:	e8 80 ff ff ff       	call   80024b <strlen>
+  8002cb:	83 c4 08             	add    $0x8,%esp
+  8002ce:	ff 75 0c             	push   0xc(%ebp)
+  8002d1:	01 d8                	add    %ebx,%eax
+  8002d3:	50                   	push   %eax
+  8002d4:	e8 be ff ff ff       	call   800297 <strcpy>
+  8002d9:	89 d8                	mov    %ebx,%eax
+  8002db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002de:	c9                   	leave
+  8002df:	c3                   	ret
+
+008002e0 <strncpy>:
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	56                   	push   %esi
+  8002e4:	53                   	push   %ebx
+  8002e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002ee:	85 db                	test   %ebx,%ebx
+  8002f0:	74 17                	je     800309 <strncpy+0x29>
+  8002f2:	01 f3                	add    %esi,%ebx
+  8002f4:	89 f0                	mov    %esi,%eax
+  8002f6:	83 c0 01             	add    $0x1,%eax
+  8002f9:	0f b6 0a             	movzbl (%edx),%ecx
+  8002fc:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8002ff:	80 f9 01             	cmp    $0x1,%cl
+  800302:	83 da ff             	sbb    $0xffffffff,%edx
+  800305:	39 c3                	cmp    %eax,%ebx
+  800307:	75 ed                	jne    8002f6 <strncpy+0x16>
+  800309:	89 f0                	mov    %esi,%eax
+  80030b:	5b                   	pop    %ebx
+  80030c:	5e                   	pop    %esi
+  80030d:	5d                   	pop    %ebp
+  80030e:	c3                   	ret
+
+0080030f <strlcpy>:
+  80030f:	55                   	push   %ebp
+  800310:	89 e5                	mov    %esp,%ebp
+  800312:	56                   	push   %esi
+  800313:	53                   	push   %ebx
+  800314:	8b 75 08             	mov    0x8(%ebp),%esi
+  800317:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80031a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80031d:	89 f0                	mov    %esi,%eax
+  80031f:	85 db                	test   %ebx,%ebx
+  800321:	74 1e                	je     800341 <strlcpy+0x32>
+  800323:	83 eb 01             	sub    $0x1,%ebx
+  800326:	74 16                	je     80033e <strlcpy+0x2f>
+  800328:	01 f3                	add    %esi,%ebx
+  80032a:	0f b6 0a             	movzbl (%edx),%ecx
+  80032d:	84 c9                	test   %cl,%cl
+  80032f:	74 0d                	je     80033e <strlcpy+0x2f>
+  800331:	83 c2 01             	add    $0x1,%edx
+  800334:	83 c0 01             	add    $0x1,%eax
+  800337:	88 48 ff             	mov    %cl,-0x1(%eax)
+  80033a:	39 d8                	cmp    %ebx,%eax
+  80033c:	75 ec                	jne    80032a <strlcpy+0x1b>
+  80033e:	c6 00 00             	movb   $0x0,(%eax)
+  800341:	29 f0                	sub    %esi,%eax
+  800343:	5b                   	pop    %ebx
+  800344:	5e                   	pop    %esi
+  800345:	5d                   	pop    %ebp
+  800346:	c3                   	ret
+
+00800347 <strcmp>:
+  800347:	55                   	push   %ebp
+  800348:	89 e5                	mov    %esp,%ebp
+  80034a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80034d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800350:	0f b6 01             	movzbl (%ecx),%eax
+  800353:	84 c0                	test   %al,%al
+  800355:	74 11                	je     800368 <strcmp+0x21>
+  800357:	38 02                	cmp    %al,(%edx)
+  800359:	75 0d                	jne    800368 <strcmp+0x21>
+  80035b:	83 c1 01             	add    $0x1,%ecx
+  80035e:	83 c2 01             	add    $0x1,%edx
+  800361:	0f b6 01             	movzbl (%ecx),%eax
+  800364:	84 c0                	test   %al,%al
+  800366:	75 ef                	jne    800357 <strcmp+0x10>
+  800368:	0f b6 c0             	movzbl %al,%eax
+  80036b:	0f b6 12             	movzbl (%edx),%edx
+  80036e:	29 d0                	sub    %edx,%eax
+  800370:	5d                   	pop    %ebp
+  800371:	c3                   	ret
+
+00800372 <strncmp>:
+  800372:	55                   	push   %ebp
+  800373:	89 e5                	mov    %esp,%ebp
+  800375:	53                   	push   %ebx
+  800376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80037c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80037f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800384:	85 d2                	test   %edx,%edx
+  800386:	74 2e                	je     8003b6 <strncmp+0x44>
+  800388:	0f b6 01             	movzbl (%ecx),%eax
+  80038b:	84 c0                	test   %al,%al
+  80038d:	74 16                	je     8003a5 <strncmp+0x33>
+  80038f:	3a 03                	cmp    (%ebx),%al
+  800391:	75 12                	jne    8003a5 <strncmp+0x33>
+  800393:	83 c1 01             	add    $0x1,%ecx
+  800396:	83 c3 01             	add    $0x1,%ebx
+  800399:	83 ea 01             	sub    $0x1,%edx
+  80039c:	75 ea                	jne    800388 <strncmp+0x16>
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	eb 11                	jmp    8003b6 <strncmp+0x44>
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	85 d2                	test   %edx,%edx
+  8003ac:	74 08                	je     8003b6 <strncmp+0x44>
+  8003ae:	0f b6 01             	movzbl (%ecx),%eax
+  8003b1:	0f b6 13             	movzbl (%ebx),%edx
+  8003b4:	29 d0                	sub    %edx,%eax
+  8003b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+
+008003bb <strchr>:
+  8003bb:	55                   	push   %ebp
+  8003bc:	89 e5                	mov    %esp,%ebp
+  8003be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003c1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8003c5:	0f b6 10             	movzbl (%eax),%edx
+  8003c8:	84 d2                	test   %dl,%dl
+  8003ca:	74 15                	je     8003e1 <strchr+0x26>
+  8003cc:	38 d1                	cmp    %dl,%cl
+  8003ce:	74 0f                	je     8003df <strchr+0x24>
+  8003d0:	83 c0 01             	add    $0x1,%eax
+  8003d3:	0f b6 10             	movzbl (%eax),%edx
+  8003d6:	84 d2                	test   %dl,%dl
+  8003d8:	75 f2                	jne    8003cc <strchr+0x11>
+  8003da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003df:	5d                   	pop    %ebp
+  8003e0:	c3                   	ret
+  8003e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e6:	eb f7                	jmp    8003df <strchr+0x24>
+
+008003e8 <strfind>:
+  8003e8:	55                   	push   %ebp
+  8003e9:	89 e5                	mov    %esp,%ebp
+  8003eb:	53                   	push   %ebx
+  8003ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003f2:	0f b6 18             	movzbl (%eax),%ebx
+  8003f5:	38 d3                	cmp    %dl,%bl
+  8003f7:	74 14                	je     80040d <strfind+0x25>
+  8003f9:	89 d1                	mov    %edx,%ecx
+  8003fb:	84 db                	test   %bl,%bl
+  8003fd:	74 0e                	je     80040d <strfind+0x25>
+  8003ff:	83 c0 01             	add    $0x1,%eax
+  800402:	0f b6 10             	movzbl (%eax),%edx
+  800405:	38 ca                	cmp    %cl,%dl
+  800407:	74 04                	je     80040d <strfind+0x25>
+  800409:	84 d2                	test   %dl,%dl
+  80040b:	75 f2                	jne    8003ff <strfind+0x17>
+  80040d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800410:	c9                   	leave
+  800411:	c3                   	ret
+
+00800412 <memset>:
+  800412:	55                   	push   %ebp
+  800413:	89 e5                	mov    %esp,%ebp
+  800415:	57                   	push   %edi
+  800416:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800419:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80041c:	85 c9                	test   %ecx,%ecx
+  80041e:	74 20                	je     800440 <memset+0x2e>
+  800420:	89 f8                	mov    %edi,%eax
+  800422:	09 c8                	or     %ecx,%eax
+  800424:	a8 03                	test   $0x3,%al
+  800426:	75 12                	jne    80043a <memset+0x28>
+  800428:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80042c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800432:	c1 e9 02             	shr    $0x2,%ecx
+  800435:	fc                   	cld
+  800436:	f3 ab                	rep stos %eax,%es:(%edi)
+  800438:	eb 06                	jmp    800440 <memset+0x2e>
+  80043a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80043d:	fc                   	cld
+  80043e:	f3 aa                	rep stos %al,%es:(%edi)
+  800440:	89 f8                	mov    %edi,%eax
+  800442:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+
+00800447 <memmove>:
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	57                   	push   %edi
+  80044b:	56                   	push   %esi
+  80044c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80044f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800452:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800455:	39 c6                	cmp    %eax,%esi
+  800457:	73 32                	jae    80048b <memmove+0x44>
+  800459:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80045c:	39 d0                	cmp    %edx,%eax
+  80045e:	73 2b                	jae    80048b <memmove+0x44>
+  800460:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800463:	89 d6                	mov    %edx,%esi
+  800465:	09 fe                	or     %edi,%esi
+  800467:	09 ce                	or     %ecx,%esi
+  800469:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80046f:	75 0e                	jne    80047f <memmove+0x38>
+  800471:	83 ef 04             	sub    $0x4,%edi
+  800474:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800477:	c1 e9 02             	shr    $0x2,%ecx
+  80047a:	fd                   	std
+  80047b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80047d:	eb 09                	jmp    800488 <memmove+0x41>
+  80047f:	83 ef 01             	sub    $0x1,%edi
+  800482:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800485:	fd                   	std
+  800486:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800488:	fc                   	cld
+  800489:	eb 1a                	jmp    8004a5 <memmove+0x5e>
+  80048b:	89 f2                	mov    %esi,%edx
+  80048d:	09 c2                	or     %eax,%edx
+  80048f:	09 ca                	or     %ecx,%edx
+  800491:	f6 c2 03             	test   $0x3,%dl
+  800494:	75 0a                	jne    8004a0 <memmove+0x59>
+  800496:	c1 e9 02             	shr    $0x2,%ecx
+  800499:	89 c7                	mov    %eax,%edi
+  80049b:	fc                   	cld
+  80049c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80049e:	eb 05                	jmp    8004a5 <memmove+0x5e>
+  8004a0:	89 c7                	mov    %eax,%edi
+  8004a2:	fc                   	cld
+  8004a3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  8004a5:	5e                   	pop    %esi
+  8004a6:	5f                   	pop    %edi
+  8004a7:	5d                   	pop    %ebp
+  8004a8:	c3                   	ret
+
+008004a9 <memcpy>:
+  8004a9:	55                   	push   %ebp
+  8004aa:	89 e5                	mov    %esp,%ebp
+  8004ac:	83 ec 0c             	sub    $0xc,%esp
+  8004af:	ff 75 10             	push   0x10(%ebp)
+  8004b2:	ff 75 0c             	push   0xc(%ebp)
+  8004b5:	ff 75 08             	push   0x8(%ebp)
+  8004b8:	e8 8a ff ff ff       	call   800447 <memmove>
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+
+008004bf <memcmp>:
+  8004bf:	55                   	push   %ebp
+  8004c0:	89 e5                	mov    %esp,%ebp
+  8004c2:	56                   	push   %esi
+  8004c3:	53                   	push   %ebx
+  8004c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004ca:	8b 75 10             	mov    0x10(%ebp),%esi
+  8004cd:	85 f6                	test   %esi,%esi
+  8004cf:	74 29                	je     8004fa <memcmp+0x3b>
+  8004d1:	01 c6                	add    %eax,%esi
+  8004d3:	0f b6 08             	movzbl (%eax),%ecx
+  8004d6:	0f b6 1a             	movzbl (%edx),%ebx
+  8004d9:	38 d9                	cmp    %bl,%cl
+  8004db:	75 11                	jne    8004ee <memcmp+0x2f>
+  8004dd:	83 c0 01             	add    $0x1,%eax
+  8004e0:	83 c2 01             	add    $0x1,%edx
+  8004e3:	39 c6                	cmp    %eax,%esi
+  8004e5:	75 ec                	jne    8004d3 <memcmp+0x14>
+  8004e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ec:	eb 08                	jmp    8004f6 <memcmp+0x37>
+  8004ee:	0f b6 c1             	movzbl %cl,%eax
+  8004f1:	0f b6 db             	movzbl %bl,%ebx
+  8004f4:	29 d8                	sub    %ebx,%eax
+  8004f6:	5b                   	pop    %ebx
+  8004f7:	5e                   	pop    %esi
+  8004f8:	5d                   	pop    %ebp
+  8004f9:	c3                   	ret
+  8004fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ff:	eb f5                	jmp    8004f6 <memcmp+0x37>
+
+00800501 <memfind>:
+  800501:	55                   	push   %ebp
+  800502:	89 e5                	mov    %esp,%ebp
+  800504:	8b 45 08             	mov    0x8(%ebp),%eax
+  800507:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80050a:	89 c2                	mov    %eax,%edx
+  80050c:	03 55 10             	add    0x10(%ebp),%edx
+  80050f:	39 d0                	cmp    %edx,%eax
+  800511:	73 0d                	jae    800520 <memfind+0x1f>
+  800513:	38 08                	cmp    %cl,(%eax)
+  800515:	74 0d                	je     800524 <memfind+0x23>
+  800517:	83 c0 01             	add    $0x1,%eax
+  80051a:	39 c2                	cmp    %eax,%edx
+  80051c:	75 f5                	jne    800513 <memfind+0x12>
+  80051e:	eb 06                	jmp    800526 <memfind+0x25>
+  800520:	89 c2                	mov    %eax,%edx
+  800522:	eb 02                	jmp    800526 <memfind+0x25>
+  800524:	89 c2                	mov    %eax,%edx
+  800526:	89 d0                	mov    %edx,%eax
+  800528:	5d                   	pop    %ebp
+  800529:	c3                   	ret
+
+0080052a <strtol>:
+  80052a:	55                   	push   %ebp
+  80052b:	89 e5                	mov    %esp,%ebp
+  80052d:	57                   	push   %edi
+  80052e:	56                   	push   %esi
+  80052f:	53                   	push   %ebx
+  800530:	8b 55 08             	mov    0x8(%ebp),%edx
+  800533:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800536:	0f b6 02             	movzbl (%edx),%eax
+  800539:	3c 20                	cmp    $0x20,%al
+  80053b:	74 04                	je     800541 <strtol+0x17>
+  80053d:	3c 09                	cmp    $0x9,%al
+  80053f:	75 0e                	jne    80054f <strtol+0x25>
+  800541:	83 c2 01             	add    $0x1,%edx
+  800544:	0f b6 02             	movzbl (%edx),%eax
+  800547:	3c 20                	cmp    $0x20,%al
+  800549:	74 f6                	je     800541 <strtol+0x17>
+  80054b:	3c 09                	cmp    $0x9,%al
+  80054d:	74 f2                	je     800541 <strtol+0x17>
+  80054f:	3c 2b                	cmp    $0x2b,%al
+  800551:	74 2a                	je     80057d <strtol+0x53>
+  800553:	bf 00 00 00 00       	mov    $0x0,%edi
+  800558:	3c 2d                	cmp    $0x2d,%al
+  80055a:	74 2b                	je     800587 <strtol+0x5d>
+  80055c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800562:	75 0f                	jne    800573 <strtol+0x49>
+  800564:	80 3a 30             	cmpb   $0x30,(%edx)
+  800567:	74 28                	je     800591 <strtol+0x67>
+  800569:	85 db                	test   %ebx,%ebx
+  80056b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800570:	0f 44 d8             	cmove  %eax,%ebx
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80057b:	eb 46                	jmp    8005c3 <strtol+0x99>
+  80057d:	83 c2 01             	add    $0x1,%edx
+  800580:	bf 00 00 00 00       	mov    $0x0,%edi
+  800585:	eb d5                	jmp    80055c <strtol+0x32>
+  800587:	83 c2 01             	add    $0x1,%edx
+  80058a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80058f:	eb cb                	jmp    80055c <strtol+0x32>
+  800591:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800595:	74 0e                	je     8005a5 <strtol+0x7b>
+  800597:	85 db                	test   %ebx,%ebx
+  800599:	75 d8                	jne    800573 <strtol+0x49>
+  80059b:	83 c2 01             	add    $0x1,%edx
+  80059e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8005a3:	eb ce                	jmp    800573 <strtol+0x49>
+  8005a5:	83 c2 02             	add    $0x2,%edx
+  8005a8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8005ad:	eb c4                	jmp    800573 <strtol+0x49>
+  8005af:	0f be c0             	movsbl %al,%eax
+  8005b2:	83 e8 30             	sub    $0x30,%eax
+  8005b5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8005b8:	7d 3a                	jge    8005f4 <strtol+0xca>
+  8005ba:	83 c2 01             	add    $0x1,%edx
+  8005bd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8005c1:	01 c1                	add    %eax,%ecx
+  8005c3:	0f b6 02             	movzbl (%edx),%eax
+  8005c6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005c9:	89 f3                	mov    %esi,%ebx
+  8005cb:	80 fb 09             	cmp    $0x9,%bl
+  8005ce:	76 df                	jbe    8005af <strtol+0x85>
+  8005d0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8005d3:	89 f3                	mov    %esi,%ebx
+  8005d5:	80 fb 19             	cmp    $0x19,%bl
+  8005d8:	77 08                	ja     8005e2 <strtol+0xb8>
+  8005da:	0f be c0             	movsbl %al,%eax
+  8005dd:	83 e8 57             	sub    $0x57,%eax
+  8005e0:	eb d3                	jmp    8005b5 <strtol+0x8b>
+  8005e2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8005e5:	89 f3                	mov    %esi,%ebx
+  8005e7:	80 fb 19             	cmp    $0x19,%bl
+  8005ea:	77 08                	ja     8005f4 <strtol+0xca>
+  8005ec:	0f be c0             	movsbl %al,%eax
+  8005ef:	83 e8 37             	sub    $0x37,%eax
+  8005f2:	eb c1                	jmp    8005b5 <strtol+0x8b>
+  8005f4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8005f8:	74 05                	je     8005ff <strtol+0xd5>
+  8005fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8005fd:	89 10                	mov    %edx,(%eax)
+  8005ff:	89 c8                	mov    %ecx,%eax
+  800601:	f7 d8                	neg    %eax
+  800603:	85 ff                	test   %edi,%edi
+  800605:	0f 45 c8             	cmovne %eax,%ecx
+  800608:	89 c8                	mov    %ecx,%eax
+  80060a:	5b                   	pop    %ebx
+  80060b:	5e                   	pop    %esi
+  80060c:	5f                   	pop    %edi
+  80060d:	5d                   	pop    %ebp
+  80060e:	c3                   	ret
+
+0080060f <sys_cputs>:
+  80060f:	55                   	push   %ebp
+  800610:	89 e5                	mov    %esp,%ebp
+  800612:	57                   	push   %edi
+  800613:	56                   	push   %esi
+  800614:	53                   	push   %ebx
+  800615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80061d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800620:	89 c3                	mov    %eax,%ebx
+  800622:	89 c7                	mov    %eax,%edi
+  800624:	89 c6                	mov    %eax,%esi
+  800626:	cd 30                	int    $0x30
+  800628:	5b                   	pop    %ebx
+  800629:	5e                   	pop    %esi
+  80062a:	5f                   	pop    %edi
+  80062b:	5d                   	pop    %ebp
+  80062c:	c3                   	ret
+
+0080062d <sys_cgetc>:
+  80062d:	55                   	push   %ebp
+  80062e:	89 e5                	mov    %esp,%ebp
+  800630:	57                   	push   %edi
+  800631:	56                   	push   %esi
+  800632:	53                   	push   %ebx
+  800633:	ba 00 00 00 00       	mov    $0x0,%edx
+  800638:	b8 01 00 00 00       	mov    $0x1,%eax
+  80063d:	89 d1                	mov    %edx,%ecx
+  80063f:	89 d3                	mov    %edx,%ebx
+  800641:	89 d7                	mov    %edx,%edi
+  800643:	89 d6                	mov    %edx,%esi
+  800645:	cd 30                	int    $0x30
+  800647:	5b                   	pop    %ebx
+  800648:	5e                   	pop    %esi
+  800649:	5f                   	pop    %edi
+  80064a:	5d                   	pop    %ebp
+  80064b:	c3                   	ret
+
+0080064c <sys_env_destroy>:
+  80064c:	55                   	push   %ebp
+  80064d:	89 e5                	mov    %esp,%ebp
+  80064f:	57                   	push   %edi
+  800650:	56                   	push   %esi
+  800651:	53                   	push   %ebx
+  800652:	83 ec 0c             	sub    $0xc,%esp
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80065d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800662:	89 cb                	mov    %ecx,%ebx
+  800664:	89 cf                	mov    %ecx,%edi
+  800666:	89 ce                	mov    %ecx,%esi
+  800668:	cd 30                	int    $0x30
+  80066a:	85 c0                	test   %eax,%eax
+  80066c:	7f 08                	jg     800676 <sys_env_destroy+0x2a>
+  80066e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800671:	5b                   	pop    %ebx
+  800672:	5e                   	pop    %esi
+  800673:	5f                   	pop    %edi
+  800674:	5d                   	pop    %ebp
+  800675:	c3                   	ret
+  800676:	83 ec 0c             	sub    $0xc,%esp
+  800679:	50                   	push   %eax
+  80067a:	6a 03                	push   $0x3
+  80067c:	68 e4 36 80 00       	push   $0x8036e4
+  800681:	6a 24                	push   $0x24
+  800683:	68 01 37 80 00       	push   $0x803701
+  800688:	e8 e6 23 00 00       	call   802a73 <_panic>
+
+0080068d <sys_getenvid>:
+  80068d:	55                   	push   %ebp
+  80068e:	89 e5                	mov    %esp,%ebp
+  800690:	57                   	push   %edi
+  800691:	56                   	push   %esi
+  800692:	53                   	push   %ebx
+  800693:	ba 00 00 00 00       	mov    $0x0,%edx
+  800698:	b8 02 00 00 00       	mov    $0x2,%eax
+  80069d:	89 d1                	mov    %edx,%ecx
+  80069f:	89 d3                	mov    %edx,%ebx
+  8006a1:	89 d7                	mov    %edx,%edi
+  8006a3:	89 d6                	mov    %edx,%esi
+  8006a5:	cd 30                	int    $0x30
+  8006a7:	5b                   	pop    %ebx
+  8006a8:	5e                   	pop    %esi
+  8006a9:	5f                   	pop    %edi
+  8006aa:	5d                   	pop    %ebp
+  8006ab:	c3                   	ret
+
+008006ac <sys_yield>:
+  8006ac:	55                   	push   %ebp
+  8006ad:	89 e5                	mov    %esp,%ebp
+  8006af:	57                   	push   %edi
+  8006b0:	56                   	push   %esi
+  8006b1:	53                   	push   %ebx
+  8006b2:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8006b9:	74 26                	je     8006e1 <sys_yield+0x35>
+  8006bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8006c5:	89 d1                	mov    %edx,%ecx
+  8006c7:	89 d3                	mov    %edx,%ebx
+  8006c9:	89 d7                	mov    %edx,%edi
+  8006cb:	6a 00                	push   $0x0
+  8006cd:	55                   	push   %ebp
+  8006ce:	89 e5                	mov    %esp,%ebp
+  8006d0:	8d 35 d8 06 80 00    	lea    0x8006d8,%esi
+  8006d6:	0f 34                	sysenter
+  8006d8:	5d                   	pop    %ebp
+  8006d9:	83 c4 04             	add    $0x4,%esp
+  8006dc:	5b                   	pop    %ebx
+  8006dd:	5e                   	pop    %esi
+  8006de:	5f                   	pop    %edi
+  8006df:	5d                   	pop    %ebp
+  8006e0:	c3                   	ret
+  8006e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8006eb:	89 d1                	mov    %edx,%ecx
+  8006ed:	89 d3                	mov    %edx,%ebx
+  8006ef:	89 d7                	mov    %edx,%edi
+  8006f1:	89 d6                	mov    %edx,%esi
+  8006f3:	cd 30                	int    $0x30
+  8006f5:	eb e5                	jmp    8006dc <sys_yield+0x30>
+
+008006f7 <sys_page_alloc>:
+  8006f7:	55                   	push   %ebp
+  8006f8:	89 e5                	mov    %esp,%ebp
+  8006fa:	57                   	push   %edi
+  8006fb:	56                   	push   %esi
+  8006fc:	53                   	push   %ebx
+  8006fd:	83 ec 0c             	sub    $0xc,%esp
+  800700:	be 00 00 00 00       	mov    $0x0,%esi
+  800705:	8b 55 08             	mov    0x8(%ebp),%edx
+  800708:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80070b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800710:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800713:	89 f7                	mov    %esi,%edi
+  800715:	cd 30                	int    $0x30
+  800717:	85 c0                	test   %eax,%eax
+  800719:	7f 08                	jg     800723 <sys_page_alloc+0x2c>
+  80071b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80071e:	5b                   	pop    %ebx
+  80071f:	5e                   	pop    %esi
+  800720:	5f                   	pop    %edi
+  800721:	5d                   	pop    %ebp
+  800722:	c3                   	ret
+  800723:	83 ec 0c             	sub    $0xc,%esp
+  800726:	50                   	push   %eax
+  800727:	6a 04                	push   $0x4
+  800729:	68 e4 36 80 00       	push   $0x8036e4
+  80072e:	6a 24                	push   $0x24
+  800730:	68 01 37 80 00       	push   $0x803701
+  800735:	e8 39 23 00 00       	call   802a73 <_panic>
+
+0080073a <sys_page_map>:
+  80073a:	55                   	push   %ebp
+  80073b:	89 e5                	mov    %esp,%ebp
+  80073d:	57                   	push   %edi
+  80073e:	56                   	push   %esi
+  80073f:	53                   	push   %ebx
+  800740:	83 ec 0c             	sub    $0xc,%esp
+  800743:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80074a:	74 33                	je     80077f <sys_page_map+0x45>
+  80074c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800752:	b8 05 00 00 00       	mov    $0x5,%eax
+  800757:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80075a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80075d:	ff 75 18             	push   0x18(%ebp)
+  800760:	55                   	push   %ebp
+  800761:	89 e5                	mov    %esp,%ebp
+  800763:	8d 35 6b 07 80 00    	lea    0x80076b,%esi
+  800769:	0f 34                	sysenter
+  80076b:	5d                   	pop    %ebp
+  80076c:	83 c4 04             	add    $0x4,%esp
+  80076f:	89 c2                	mov    %eax,%edx
+  800771:	85 c0                	test   %eax,%eax
+  800773:	7f 3d                	jg     8007b2 <sys_page_map+0x78>
+  800775:	89 d0                	mov    %edx,%eax
+  800777:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80077a:	5b                   	pop    %ebx
+  80077b:	5e                   	pop    %esi
+  80077c:	5f                   	pop    %edi
+  80077d:	5d                   	pop    %ebp
+  80077e:	c3                   	ret
+  80077f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800784:	8b 55 08             	mov    0x8(%ebp),%edx
+  800787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80078a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80078d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800790:	8b 75 18             	mov    0x18(%ebp),%esi
+  800793:	cd 30                	int    $0x30
+  800795:	89 c2                	mov    %eax,%edx
+  800797:	85 c0                	test   %eax,%eax
+  800799:	7e da                	jle    800775 <sys_page_map+0x3b>
+  80079b:	83 ec 0c             	sub    $0xc,%esp
+  80079e:	50                   	push   %eax
+  80079f:	6a 05                	push   $0x5
+  8007a1:	68 e4 36 80 00       	push   $0x8036e4
+  8007a6:	6a 24                	push   $0x24
+  8007a8:	68 01 37 80 00       	push   $0x803701
+  8007ad:	e8 c1 22 00 00       	call   802a73 <_panic>
+  8007b2:	83 ec 0c             	sub    $0xc,%esp
+  8007b5:	50                   	push   %eax
+  8007b6:	6a 05                	push   $0x5
+  8007b8:	68 e4 36 80 00       	push   $0x8036e4
+  8007bd:	6a 48                	push   $0x48
+  8007bf:	68 01 37 80 00       	push   $0x803701
+  8007c4:	e8 aa 22 00 00       	call   802a73 <_panic>
+
+008007c9 <sys_page_unmap>:
+  8007c9:	55                   	push   %ebp
+  8007ca:	89 e5                	mov    %esp,%ebp
+  8007cc:	57                   	push   %edi
+  8007cd:	56                   	push   %esi
+  8007ce:	53                   	push   %ebx
+  8007cf:	83 ec 0c             	sub    $0xc,%esp
+  8007d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007dd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8007e2:	89 df                	mov    %ebx,%edi
+  8007e4:	89 de                	mov    %ebx,%esi
+  8007e6:	cd 30                	int    $0x30
+  8007e8:	85 c0                	test   %eax,%eax
+  8007ea:	7f 08                	jg     8007f4 <sys_page_unmap+0x2b>
+  8007ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ef:	5b                   	pop    %ebx
+  8007f0:	5e                   	pop    %esi
+  8007f1:	5f                   	pop    %edi
+  8007f2:	5d                   	pop    %ebp
+  8007f3:	c3                   	ret
+  8007f4:	83 ec 0c             	sub    $0xc,%esp
+  8007f7:	50                   	push   %eax
+  8007f8:	6a 06                	push   $0x6
+  8007fa:	68 e4 36 80 00       	push   $0x8036e4
+  8007ff:	6a 24                	push   $0x24
+  800801:	68 01 37 80 00       	push   $0x803701
+  800806:	e8 68 22 00 00       	call   802a73 <_panic>
+
+0080080b <sys_fork>:
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	57                   	push   %edi
+  80080f:	56                   	push   %esi
+  800810:	53                   	push   %ebx
+  800811:	ba 00 00 00 00       	mov    $0x0,%edx
+  800816:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80081b:	89 d1                	mov    %edx,%ecx
+  80081d:	89 d3                	mov    %edx,%ebx
+  80081f:	89 d7                	mov    %edx,%edi
+  800821:	89 d6                	mov    %edx,%esi
+  800823:	cd 30                	int    $0x30
+  800825:	5b                   	pop    %ebx
+  800826:	5e                   	pop    %esi
+  800827:	5f                   	pop    %edi
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+
+0080082a <sys_env_set_status>:
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	57                   	push   %edi
+  80082e:	56                   	push   %esi
+  80082f:	53                   	push   %ebx
+  800830:	83 ec 0c             	sub    $0xc,%esp
+  800833:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800838:	8b 55 08             	mov    0x8(%ebp),%edx
+  80083b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80083e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800843:	89 df                	mov    %ebx,%edi
+  800845:	89 de                	mov    %ebx,%esi
+  800847:	cd 30                	int    $0x30
+  800849:	85 c0                	test   %eax,%eax
+  80084b:	7f 08                	jg     800855 <sys_env_set_status+0x2b>
+  80084d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800850:	5b                   	pop    %ebx
+  800851:	5e                   	pop    %esi
+  800852:	5f                   	pop    %edi
+  800853:	5d                   	pop    %ebp
+  800854:	c3                   	ret
+  800855:	83 ec 0c             	sub    $0xc,%esp
+  800858:	50                   	push   %eax
+  800859:	6a 08                	push   $0x8
+  80085b:	68 e4 36 80 00       	push   $0x8036e4
+  800860:	6a 24                	push   $0x24
+  800862:	68 01 37 80 00       	push   $0x803701
+  800867:	e8 07 22 00 00       	call   802a73 <_panic>
+
+0080086c <sys_env_set_trapframe>:
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	57                   	push   %edi
+  800870:	56                   	push   %esi
+  800871:	53                   	push   %ebx
+  800872:	83 ec 0c             	sub    $0xc,%esp
+  800875:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80087a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80087d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800880:	b8 09 00 00 00       	mov    $0x9,%eax
+  800885:	89 df                	mov    %ebx,%edi
+  800887:	89 de                	mov    %ebx,%esi
+  800889:	cd 30                	int    $0x30
+  80088b:	85 c0                	test   %eax,%eax
+  80088d:	7f 08                	jg     800897 <sys_env_set_trapframe+0x2b>
+  80088f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800892:	5b                   	pop    %ebx
+  800893:	5e                   	pop    %esi
+  800894:	5f                   	pop    %edi
+  800895:	5d                   	pop    %ebp
+  800896:	c3                   	ret
+  800897:	83 ec 0c             	sub    $0xc,%esp
+  80089a:	50                   	push   %eax
+  80089b:	6a 09                	push   $0x9
+  80089d:	68 e4 36 80 00       	push   $0x8036e4
+  8008a2:	6a 24                	push   $0x24
+  8008a4:	68 01 37 80 00       	push   $0x803701
+  8008a9:	e8 c5 21 00 00       	call   802a73 <_panic>
+
+008008ae <sys_env_set_cow>:
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	57                   	push   %edi
+  8008b2:	56                   	push   %esi
+  8008b3:	53                   	push   %ebx
+  8008b4:	83 ec 0c             	sub    $0xc,%esp
+  8008b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8008c7:	89 df                	mov    %ebx,%edi
+  8008c9:	89 de                	mov    %ebx,%esi
+  8008cb:	cd 30                	int    $0x30
+  8008cd:	85 c0                	test   %eax,%eax
+  8008cf:	7f 08                	jg     8008d9 <sys_env_set_cow+0x2b>
+  8008d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d4:	5b                   	pop    %ebx
+  8008d5:	5e                   	pop    %esi
+  8008d6:	5f                   	pop    %edi
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+  8008d9:	83 ec 0c             	sub    $0xc,%esp
+  8008dc:	50                   	push   %eax
+  8008dd:	6a 20                	push   $0x20
+  8008df:	68 e4 36 80 00       	push   $0x8036e4
+  8008e4:	6a 24                	push   $0x24
+  8008e6:	68 01 37 80 00       	push   $0x803701
+  8008eb:	e8 83 21 00 00       	call   802a73 <_panic>
+
+008008f0 <sys_env_service>:
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	57                   	push   %edi
+  8008f4:	56                   	push   %esi
+  8008f5:	53                   	push   %ebx
+  8008f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008fe:	b8 21 00 00 00       	mov    $0x21,%eax
+  800903:	89 cb                	mov    %ecx,%ebx
+  800905:	89 cf                	mov    %ecx,%edi
+  800907:	89 ce                	mov    %ecx,%esi
+  800909:	cd 30                	int    $0x30
+  80090b:	5b                   	pop    %ebx
+  80090c:	5e                   	pop    %esi
+  80090d:	5f                   	pop    %edi
+  80090e:	5d                   	pop    %ebp
+  80090f:	c3                   	ret
+
+00800910 <sys_env_set_pgfault_upcall>:
+  800910:	55                   	push   %ebp
+  800911:	89 e5                	mov    %esp,%ebp
+  800913:	57                   	push   %edi
+  800914:	56                   	push   %esi
+  800915:	53                   	push   %ebx
+  800916:	83 ec 0c             	sub    $0xc,%esp
+  800919:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80091e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800921:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800924:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800929:	89 df                	mov    %ebx,%edi
+  80092b:	89 de                	mov    %ebx,%esi
+  80092d:	cd 30                	int    $0x30
+  80092f:	85 c0                	test   %eax,%eax
+  800931:	7f 08                	jg     80093b <sys_env_set_pgfault_upcall+0x2b>
+  800933:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800936:	5b                   	pop    %ebx
+  800937:	5e                   	pop    %esi
+  800938:	5f                   	pop    %edi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+  80093b:	83 ec 0c             	sub    $0xc,%esp
+  80093e:	50                   	push   %eax
+  80093f:	6a 0a                	push   $0xa
+  800941:	68 e4 36 80 00       	push   $0x8036e4
+  800946:	6a 24                	push   $0x24
+  800948:	68 01 37 80 00       	push   $0x803701
+  80094d:	e8 21 21 00 00       	call   802a73 <_panic>
+
+00800952 <sys_ipc_try_send>:
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	57                   	push   %edi
+  800956:	56                   	push   %esi
+  800957:	53                   	push   %ebx
+  800958:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80095f:	74 27                	je     800988 <sys_ipc_try_send+0x36>
+  800961:	8b 55 08             	mov    0x8(%ebp),%edx
+  800964:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800967:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80096c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80096f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800972:	6a 00                	push   $0x0
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	8d 35 7f 09 80 00    	lea    0x80097f,%esi
+  80097d:	0f 34                	sysenter
+  80097f:	5d                   	pop    %ebp
+  800980:	83 c4 04             	add    $0x4,%esp
+  800983:	5b                   	pop    %ebx
+  800984:	5e                   	pop    %esi
+  800985:	5f                   	pop    %edi
+  800986:	5d                   	pop    %ebp
+  800987:	c3                   	ret
+  800988:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80098d:	be 00 00 00 00       	mov    $0x0,%esi
+  800992:	8b 55 08             	mov    0x8(%ebp),%edx
+  800995:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800998:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80099b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80099e:	cd 30                	int    $0x30
+  8009a0:	eb e1                	jmp    800983 <sys_ipc_try_send+0x31>
+
+008009a2 <sys_ipc_recv>:
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	57                   	push   %edi
+  8009a6:	56                   	push   %esi
+  8009a7:	53                   	push   %ebx
+  8009a8:	83 ec 0c             	sub    $0xc,%esp
+  8009ab:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8009b2:	74 32                	je     8009e6 <sys_ipc_recv+0x44>
+  8009b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8009c1:	89 cb                	mov    %ecx,%ebx
+  8009c3:	89 cf                	mov    %ecx,%edi
+  8009c5:	6a 00                	push   $0x0
+  8009c7:	55                   	push   %ebp
+  8009c8:	89 e5                	mov    %esp,%ebp
+  8009ca:	8d 35 d2 09 80 00    	lea    0x8009d2,%esi
+  8009d0:	0f 34                	sysenter
+  8009d2:	5d                   	pop    %ebp
+  8009d3:	83 c4 04             	add    $0x4,%esp
+  8009d6:	89 c2                	mov    %eax,%edx
+  8009d8:	85 c0                	test   %eax,%eax
+  8009da:	7f 3c                	jg     800a18 <sys_ipc_recv+0x76>
+  8009dc:	89 d0                	mov    %edx,%eax
+  8009de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009e1:	5b                   	pop    %ebx
+  8009e2:	5e                   	pop    %esi
+  8009e3:	5f                   	pop    %edi
+  8009e4:	5d                   	pop    %ebp
+  8009e5:	c3                   	ret
+  8009e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8009f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f3:	89 cb                	mov    %ecx,%ebx
+  8009f5:	89 cf                	mov    %ecx,%edi
+  8009f7:	89 ce                	mov    %ecx,%esi
+  8009f9:	cd 30                	int    $0x30
+  8009fb:	89 c2                	mov    %eax,%edx
+  8009fd:	85 c0                	test   %eax,%eax
+  8009ff:	7e db                	jle    8009dc <sys_ipc_recv+0x3a>
+  800a01:	83 ec 0c             	sub    $0xc,%esp
+  800a04:	50                   	push   %eax
+  800a05:	6a 0d                	push   $0xd
+  800a07:	68 e4 36 80 00       	push   $0x8036e4
+  800a0c:	6a 24                	push   $0x24
+  800a0e:	68 01 37 80 00       	push   $0x803701
+  800a13:	e8 5b 20 00 00       	call   802a73 <_panic>
+  800a18:	83 ec 0c             	sub    $0xc,%esp
+  800a1b:	50                   	push   %eax
+  800a1c:	6a 0d                	push   $0xd
+  800a1e:	68 e4 36 80 00       	push   $0x8036e4
+  800a23:	6a 48                	push   $0x48
+  800a25:	68 01 37 80 00       	push   $0x803701
+  800a2a:	e8 44 20 00 00       	call   802a73 <_panic>
+
+00800a2f <sys_ipc_send>:
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	57                   	push   %edi
+  800a33:	56                   	push   %esi
+  800a34:	53                   	push   %ebx
+  800a35:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800a3c:	74 27                	je     800a65 <sys_ipc_send+0x36>
+  800a3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a44:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800a49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a4c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800a4f:	6a 00                	push   $0x0
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	8d 35 5c 0a 80 00    	lea    0x800a5c,%esi
+  800a5a:	0f 34                	sysenter
+  800a5c:	5d                   	pop    %ebp
+  800a5d:	83 c4 04             	add    $0x4,%esp
+  800a60:	5b                   	pop    %ebx
+  800a61:	5e                   	pop    %esi
+  800a62:	5f                   	pop    %edi
+  800a63:	5d                   	pop    %ebp
+  800a64:	c3                   	ret
+  800a65:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800a6a:	be 00 00 00 00       	mov    $0x0,%esi
+  800a6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a78:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800a7b:	cd 30                	int    $0x30
+  800a7d:	eb e1                	jmp    800a60 <sys_ipc_send+0x31>
+
+00800a7f <sys_ipc_call>:
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	57                   	push   %edi
+  800a83:	56                   	push   %esi
+  800a84:	53                   	push   %ebx
+  800a85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a8b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800a90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a93:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800a96:	8b 75 18             	mov    0x18(%ebp),%esi
+  800a99:	cd 30                	int    $0x30
+  800a9b:	5b                   	pop    %ebx
+  800a9c:	5e                   	pop    %esi
+  800a9d:	5f                   	pop    %edi
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <sys_ipc_reply_recv>:
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	57                   	push   %edi
+  800aa4:	56                   	push   %esi
+  800aa5:	53                   	push   %ebx
+  800aa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aac:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ab1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ab4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ab7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800aba:	cd 30                	int    $0x30
+  800abc:	5b                   	pop    %ebx
+  800abd:	5e                   	pop    %esi
+  800abe:	5f                   	pop    %edi
+  800abf:	5d                   	pop    %ebp
+  800ac0:	c3                   	ret
+
+00800ac1 <sys_time_msec>:
+  800ac1:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  800ac6:	85 c0                	test   %eax,%eax
+  800ac8:	75 06                	jne    800ad0 <sys_time_msec+0xf>
+  800aca:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  800acf:	c3                   	ret
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	57                   	push   %edi
+  800ad4:	56                   	push   %esi
+  800ad5:	53                   	push   %ebx
+  800ad6:	83 ec 0c             	sub    $0xc,%esp
+  800ad9:	0f 31                	rdtsc
+  800adb:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  800ae1:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  800ae7:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  800aed:	29 c8                	sub    %ecx,%eax
+  800aef:	19 da                	sbb    %ebx,%edx
+  800af1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800af6:	57                   	push   %edi
+  800af7:	56                   	push   %esi
+  800af8:	52                   	push   %edx
+  800af9:	50                   	push   %eax
+  800afa:	e8 80 2a 00 00       	call   80357f <__udivdi3>
+  800aff:	83 c4 10             	add    $0x10,%esp
+  800b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b05:	5b                   	pop    %ebx
+  800b06:	5e                   	pop    %esi
+  800b07:	5f                   	pop    %edi
+  800b08:	5d                   	pop    %ebp
+  800b09:	c3                   	ret
+
+00800b0a <sys_env_swap>:
+  800b0a:	55                   	push   %ebp
+  800b0b:	89 e5                	mov    %esp,%ebp
+  800b0d:	57                   	push   %edi
+  800b0e:	56                   	push   %esi
+  800b0f:	53                   	push   %ebx
+  800b10:	83 ec 0c             	sub    $0xc,%esp
+  800b13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800b20:	89 cb                	mov    %ecx,%ebx
+  800b22:	89 cf                	mov    %ecx,%edi
+  800b24:	89 ce                	mov    %ecx,%esi
+  800b26:	cd 30                	int    $0x30
+  800b28:	85 c0                	test   %eax,%eax
+  800b2a:	7f 08                	jg     800b34 <sys_env_swap+0x2a>
+  800b2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b2f:	5b                   	pop    %ebx
+  800b30:	5e                   	pop    %esi
+  800b31:	5f                   	pop    %edi
+  800b32:	5d                   	pop    %ebp
+  800b33:	c3                   	ret
+  800b34:	83 ec 0c             	sub    $0xc,%esp
+  800b37:	50                   	push   %eax
+  800b38:	6a 12                	push   $0x12
+  800b3a:	68 e4 36 80 00       	push   $0x8036e4
+  800b3f:	6a 24                	push   $0x24
+  800b41:	68 01 37 80 00       	push   $0x803701
+  800b46:	e8 28 1f 00 00       	call   802a73 <_panic>
+
+00800b4b <sys_net_try_send>:
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	57                   	push   %edi
+  800b4f:	56                   	push   %esi
+  800b50:	53                   	push   %ebx
+  800b51:	83 ec 0c             	sub    $0xc,%esp
+  800b54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800b64:	89 df                	mov    %ebx,%edi
+  800b66:	89 de                	mov    %ebx,%esi
+  800b68:	cd 30                	int    $0x30
+  800b6a:	85 c0                	test   %eax,%eax
+  800b6c:	7f 08                	jg     800b76 <sys_net_try_send+0x2b>
+  800b6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b71:	5b                   	pop    %ebx
+  800b72:	5e                   	pop    %esi
+  800b73:	5f                   	pop    %edi
+  800b74:	5d                   	pop    %ebp
+  800b75:	c3                   	ret
+  800b76:	83 ec 0c             	sub    $0xc,%esp
+  800b79:	50                   	push   %eax
+  800b7a:	6a 13                	push   $0x13
+  800b7c:	68 e4 36 80 00       	push   $0x8036e4
+  800b81:	6a 24                	push   $0x24
+  800b83:	68 01 37 80 00       	push   $0x803701
+  800b88:	e8 e6 1e 00 00       	call   802a73 <_panic>
+
+00800b8d <sys_net_try_receive>:
+  800b8d:	55                   	push   %ebp
+  800b8e:	89 e5                	mov    %esp,%ebp
+  800b90:	57                   	push   %edi
+  800b91:	56                   	push   %esi
+  800b92:	53                   	push   %ebx
+  800b93:	83 ec 0c             	sub    $0xc,%esp
+  800b96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba1:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ba6:	89 df                	mov    %ebx,%edi
+  800ba8:	89 de                	mov    %ebx,%esi
+  800baa:	cd 30                	int    $0x30
+  800bac:	85 c0                	test   %eax,%eax
+  800bae:	7f 08                	jg     800bb8 <sys_net_try_receive+0x2b>
+  800bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb3:	5b                   	pop    %ebx
+  800bb4:	5e                   	pop    %esi
+  800bb5:	5f                   	pop    %edi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+  800bb8:	83 ec 0c             	sub    $0xc,%esp
+  800bbb:	50                   	push   %eax
+  800bbc:	6a 14                	push   $0x14
+  800bbe:	68 e4 36 80 00       	push   $0x8036e4
+  800bc3:	6a 24                	push   $0x24
+  800bc5:	68 01 37 80 00       	push   $0x803701
+  800bca:	e8 a4 1e 00 00       	call   802a73 <_panic>
+
+00800bcf <sys_net_recv_page>:
+  800bcf:	55                   	push   %ebp
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	57                   	push   %edi
+  800bd3:	56                   	push   %esi
+  800bd4:	53                   	push   %ebx
+  800bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdd:	b8 27 00 00 00       	mov    $0x27,%eax
+  800be2:	89 cb                	mov    %ecx,%ebx
+  800be4:	89 cf                	mov    %ecx,%edi
+  800be6:	89 ce                	mov    %ecx,%esi
+  800be8:	cd 30                	int    $0x30
+  800bea:	5b                   	pop    %ebx
+  800beb:	5e                   	pop    %esi
+  800bec:	5f                   	pop    %edi
+  800bed:	5d                   	pop    %ebp
+  800bee:	c3                   	ret
+
+00800bef <sys_net_wait>:
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	57                   	push   %edi
+  800bf3:	56                   	push   %esi
+  800bf4:	53                   	push   %ebx
+  800bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfa:	b8 26 00 00 00       	mov    $0x26,%eax
+  800bff:	89 d1                	mov    %edx,%ecx
+  800c01:	89 d3                	mov    %edx,%ebx
+  800c03:	89 d7                	mov    %edx,%edi
+  800c05:	89 d6                	mov    %edx,%esi
+  800c07:	cd 30                	int    $0x30
+  800c09:	5b                   	pop    %ebx
+  800c0a:	5e                   	pop    %esi
+  800c0b:	5f                   	pop    %edi
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	c3                   	ret
+
+00800c0e <sys_get_mac>:
+  800c0e:	55                   	push   %ebp
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	57                   	push   %edi
+  800c12:	56                   	push   %esi
+  800c13:	53                   	push   %ebx
+  800c14:	83 ec 0c             	sub    $0xc,%esp
+  800c17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c22:	b8 15 00 00 00       	mov    $0x15,%eax
+  800c27:	89 df                	mov    %ebx,%edi
+  800c29:	89 de                	mov    %ebx,%esi
+  800c2b:	cd 30                	int    $0x30
+  800c2d:	85 c0                	test   %eax,%eax
+  800c2f:	7f 08                	jg     800c39 <sys_get_mac+0x2b>
+  800c31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c34:	5b                   	pop    %ebx
+  800c35:	5e                   	pop    %esi
+  800c36:	5f                   	pop    %edi
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+  800c39:	83 ec 0c             	sub    $0xc,%esp
+  800c3c:	50                   	push   %eax
+  800c3d:	6a 15                	push   $0x15
+  800c3f:	68 e4 36 80 00       	push   $0x8036e4
+  800c44:	6a 24                	push   $0x24
+  800c46:	68 01 37 80 00       	push   $0x803701
+  800c4b:	e8 23 1e 00 00       	call   802a73 <_panic>
+
+00800c50 <sys_env_lease>:
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+  800c56:	83 ec 0c             	sub    $0xc,%esp
+  800c59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c64:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c69:	89 df                	mov    %ebx,%edi
+  800c6b:	89 de                	mov    %ebx,%esi
+  800c6d:	cd 30                	int    $0x30
+  800c6f:	85 c0                	test   %eax,%eax
+  800c71:	7f 08                	jg     800c7b <sys_env_lease+0x2b>
+  800c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c76:	5b                   	pop    %ebx
+  800c77:	5e                   	pop    %esi
+  800c78:	5f                   	pop    %edi
+  800c79:	5d                   	pop    %ebp
+  800c7a:	c3                   	ret
+  800c7b:	83 ec 0c             	sub    $0xc,%esp
+  800c7e:	50                   	push   %eax
+  800c7f:	6a 16                	push   $0x16
+  800c81:	68 e4 36 80 00       	push   $0x8036e4
+  800c86:	6a 24                	push   $0x24
+  800c88:	68 01 37 80 00       	push   $0x803701
+  800c8d:	e8 e1 1d 00 00       	call   802a73 <_panic>
+
+00800c92 <sys_copy_mem>:
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	57                   	push   %edi
+  800c96:	56                   	push   %esi
+  800c97:	53                   	push   %ebx
+  800c98:	83 ec 0c             	sub    $0xc,%esp
+  800c9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca1:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ca6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cac:	8b 75 18             	mov    0x18(%ebp),%esi
+  800caf:	cd 30                	int    $0x30
+  800cb1:	85 c0                	test   %eax,%eax
+  800cb3:	7f 08                	jg     800cbd <sys_copy_mem+0x2b>
+  800cb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5f                   	pop    %edi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+  800cbd:	83 ec 0c             	sub    $0xc,%esp
+  800cc0:	50                   	push   %eax
+  800cc1:	6a 17                	push   $0x17
+  800cc3:	68 e4 36 80 00       	push   $0x8036e4
+  800cc8:	6a 24                	push   $0x24
+  800cca:	68 01 37 80 00       	push   $0x803701
+  800ccf:	e8 9f 1d 00 00       	call   802a73 <_panic>
+
+00800cd4 <sys_get_perms>:
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	57                   	push   %edi
+  800cd8:	56                   	push   %esi
+  800cd9:	53                   	push   %ebx
+  800cda:	83 ec 0c             	sub    $0xc,%esp
+  800cdd:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce8:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ced:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf0:	89 f7                	mov    %esi,%edi
+  800cf2:	cd 30                	int    $0x30
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 08                	jg     800d00 <sys_get_perms+0x2c>
+  800cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+  800d00:	83 ec 0c             	sub    $0xc,%esp
+  800d03:	50                   	push   %eax
+  800d04:	6a 18                	push   $0x18
+  800d06:	68 e4 36 80 00       	push   $0x8036e4
+  800d0b:	6a 24                	push   $0x24
+  800d0d:	68 01 37 80 00       	push   $0x803701
+  800d12:	e8 5c 1d 00 00       	call   802a73 <_panic>
+
+00800d17 <sys_env_unsuspend>:
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+  800d20:	be 00 00 00 00       	mov    $0x0,%esi
+  800d25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d33:	89 f7                	mov    %esi,%edi
+  800d35:	cd 30                	int    $0x30
+  800d37:	85 c0                	test   %eax,%eax
+  800d39:	7f 08                	jg     800d43 <sys_env_unsuspend+0x2c>
+  800d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3e:	5b                   	pop    %ebx
+  800d3f:	5e                   	pop    %esi
+  800d40:	5f                   	pop    %edi
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+  800d43:	83 ec 0c             	sub    $0xc,%esp
+  800d46:	50                   	push   %eax
+  800d47:	6a 19                	push   $0x19
+  800d49:	68 e4 36 80 00       	push   $0x8036e4
+  800d4e:	6a 24                	push   $0x24
+  800d50:	68 01 37 80 00       	push   $0x803701
+  800d55:	e8 19 1d 00 00       	call   802a73 <_panic>
+
+00800d5a <sys_migrate>:
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	57                   	push   %edi
+  800d5e:	56                   	push   %esi
+  800d5f:	53                   	push   %ebx
+  800d60:	83 ec 0c             	sub    $0xc,%esp
+  800d63:	ba 00 80 80 00       	mov    $0x808000,%edx
+  800d68:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  800d6e:	76 11                	jbe    800d81 <sys_migrate+0x27>
+  800d70:	b8 00 00 80 00       	mov    $0x800000,%eax
+  800d75:	0f b6 08             	movzbl (%eax),%ecx
+  800d78:	05 00 10 00 00       	add    $0x1000,%eax
+  800d7d:	39 d0                	cmp    %edx,%eax
+  800d7f:	72 f4                	jb     800d75 <sys_migrate+0x1b>
+  800d81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d89:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800d8e:	89 cb                	mov    %ecx,%ebx
+  800d90:	89 cf                	mov    %ecx,%edi
+  800d92:	89 ce                	mov    %ecx,%esi
+  800d94:	cd 30                	int    $0x30
+  800d96:	85 c0                	test   %eax,%eax
+  800d98:	7f 08                	jg     800da2 <sys_migrate+0x48>
+  800d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	50                   	push   %eax
+  800da6:	6a 1a                	push   $0x1a
+  800da8:	68 e4 36 80 00       	push   $0x8036e4
+  800dad:	6a 24                	push   $0x24
+  800daf:	68 01 37 80 00       	push   $0x803701
+  800db4:	e8 ba 1c 00 00       	call   802a73 <_panic>
+
+00800db9 <sys_lease_complete>:
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	56                   	push   %esi
+  800dbe:	53                   	push   %ebx
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+  800dc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800dcc:	89 d1                	mov    %edx,%ecx
+  800dce:	89 d3                	mov    %edx,%ebx
+  800dd0:	89 d7                	mov    %edx,%edi
+  800dd2:	89 d6                	mov    %edx,%esi
+  800dd4:	cd 30                	int    $0x30
+  800dd6:	85 c0                	test   %eax,%eax
+  800dd8:	7f 08                	jg     800de2 <sys_lease_complete+0x29>
+  800dda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ddd:	5b                   	pop    %ebx
+  800dde:	5e                   	pop    %esi
+  800ddf:	5f                   	pop    %edi
+  800de0:	5d                   	pop    %ebp
+  800de1:	c3                   	ret
+  800de2:	83 ec 0c             	sub    $0xc,%esp
+  800de5:	50                   	push   %eax
+  800de6:	6a 1b                	push   $0x1b
+  800de8:	68 e4 36 80 00       	push   $0x8036e4
+  800ded:	6a 24                	push   $0x24
+  800def:	68 01 37 80 00       	push   $0x803701
+  800df4:	e8 7a 1c 00 00       	call   802a73 <_panic>
+
+00800df9 <sys_env_set_thisenv>:
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	57                   	push   %edi
+  800dfd:	56                   	push   %esi
+  800dfe:	53                   	push   %ebx
+  800dff:	83 ec 0c             	sub    $0xc,%esp
+  800e02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800e12:	89 df                	mov    %ebx,%edi
+  800e14:	89 de                	mov    %ebx,%esi
+  800e16:	cd 30                	int    $0x30
+  800e18:	85 c0                	test   %eax,%eax
+  800e1a:	7f 08                	jg     800e24 <sys_env_set_thisenv+0x2b>
+  800e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1f:	5b                   	pop    %ebx
+  800e20:	5e                   	pop    %esi
+  800e21:	5f                   	pop    %edi
+  800e22:	5d                   	pop    %ebp
+  800e23:	c3                   	ret
+  800e24:	83 ec 0c             	sub    $0xc,%esp
+  800e27:	50                   	push   %eax
+  800e28:	6a 1c                	push   $0x1c
+  800e2a:	68 e4 36 80 00       	push   $0x8036e4
+  800e2f:	6a 24                	push   $0x24
+  800e31:	68 01 37 80 00       	push   $0x803701
+  800e36:	e8 38 1c 00 00       	call   802a73 <_panic>
+
+00800e3b <sys_env_set_sched>:
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	57                   	push   %edi
+  800e3f:	56                   	push   %esi
+  800e40:	53                   	push   %ebx
+  800e41:	83 ec 0c             	sub    $0xc,%esp
+  800e44:	be 00 00 00 00       	mov    $0x0,%esi
+  800e49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800e54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e57:	89 f7                	mov    %esi,%edi
+  800e59:	cd 30                	int    $0x30
+  800e5b:	85 c0                	test   %eax,%eax
+  800e5d:	7f 08                	jg     800e67 <sys_env_set_sched+0x2c>
+  800e5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+  800e67:	83 ec 0c             	sub    $0xc,%esp
+  800e6a:	50                   	push   %eax
+  800e6b:	6a 1d                	push   $0x1d
+  800e6d:	68 e4 36 80 00       	push   $0x8036e4
+  800e72:	6a 24                	push   $0x24
+  800e74:	68 01 37 80 00       	push   $0x803701
+  800e79:	e8 f5 1b 00 00       	call   802a73 <_panic>
+
+00800e7e <sys_batch>:
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	57                   	push   %edi
+  800e82:	56                   	push   %esi
+  800e83:	53                   	push   %ebx
+  800e84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  800e94:	89 df                	mov    %ebx,%edi
+  800e96:	89 de                	mov    %ebx,%esi
+  800e98:	cd 30                	int    $0x30
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+
+00800e9f <sys_env_stats>:
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	57                   	push   %edi
+  800ea3:	56                   	push   %esi
+  800ea4:	53                   	push   %ebx
+  800ea5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ead:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb0:	b8 23 00 00 00       	mov    $0x23,%eax
+  800eb5:	89 df                	mov    %ebx,%edi
+  800eb7:	89 de                	mov    %ebx,%esi
+  800eb9:	cd 30                	int    $0x30
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+
+00800ec0 <sys_trace>:
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+  800ec6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	b8 24 00 00 00       	mov    $0x24,%eax
+  800ed3:	89 cb                	mov    %ecx,%ebx
+  800ed5:	89 cf                	mov    %ecx,%edi
+  800ed7:	89 ce                	mov    %ecx,%esi
+  800ed9:	cd 30                	int    $0x30
+  800edb:	5b                   	pop    %ebx
+  800edc:	5e                   	pop    %esi
+  800edd:	5f                   	pop    %edi
+  800ede:	5d                   	pop    %ebp
+  800edf:	c3                   	ret
+
+00800ee0 <sys_env_set_pager>:
+  800ee0:	55                   	push   %ebp
+  800ee1:	89 e5                	mov    %esp,%ebp
+  800ee3:	57                   	push   %edi
+  800ee4:	56                   	push   %esi
+  800ee5:	53                   	push   %ebx
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+  800ee9:	be 00 00 00 00       	mov    $0x0,%esi
+  800eee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef4:	b8 25 00 00 00       	mov    $0x25,%eax
+  800ef9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efc:	89 f7                	mov    %esi,%edi
+  800efe:	cd 30                	int    $0x30
+  800f00:	85 c0                	test   %eax,%eax
+  800f02:	7f 08                	jg     800f0c <sys_env_set_pager+0x2c>
+  800f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+  800f0c:	83 ec 0c             	sub    $0xc,%esp
+  800f0f:	50                   	push   %eax
+  800f10:	6a 25                	push   $0x25
+  800f12:	68 e4 36 80 00       	push   $0x8036e4
+  800f17:	6a 24                	push   $0x24
+  800f19:	68 01 37 80 00       	push   $0x803701
+  800f1e:	e8 50 1b 00 00       	call   802a73 <_panic>
+
+00800f23 <sys_pager_retire>:
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	56                   	push   %esi
+  800f28:	53                   	push   %ebx
+  800f29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	b8 28 00 00 00       	mov    $0x28,%eax
+  800f36:	89 cb                	mov    %ecx,%ebx
+  800f38:	89 cf                	mov    %ecx,%edi
+  800f3a:	89 ce                	mov    %ecx,%esi
+  800f3c:	cd 30                	int    $0x30
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <sys_prof>:
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	57                   	push   %edi
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+  800f49:	be 00 00 00 00       	mov    $0x0,%esi
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 22 00 00 00       	mov    $0x22,%eax
+  800f59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5c:	89 f7                	mov    %esi,%edi
+  800f5e:	cd 30                	int    $0x30
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+
+00800f65 <fd2num>:
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f70:	c1 e8 0c             	shr    $0xc,%eax
+  800f73:	5d                   	pop    %ebp
+  800f74:	c3                   	ret
+
+00800f75 <fd2data>:
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f80:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f85:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <fd_alloc>:
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f94:	89 c2                	mov    %eax,%edx
+  800f96:	c1 ea 16             	shr    $0x16,%edx
+  800f99:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800fa0:	f6 c2 01             	test   $0x1,%dl
+  800fa3:	74 29                	je     800fce <fd_alloc+0x42>
+  800fa5:	89 c2                	mov    %eax,%edx
+  800fa7:	c1 ea 0c             	shr    $0xc,%edx
+  800faa:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800fb1:	f6 c2 01             	test   $0x1,%dl
+  800fb4:	74 18                	je     800fce <fd_alloc+0x42>
+  800fb6:	05 00 10 00 00       	add    $0x1000,%eax
+  800fbb:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  800fc0:	75 d2                	jne    800f94 <fd_alloc+0x8>
+  800fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800fcc:	eb 05                	jmp    800fd3 <fd_alloc+0x47>
+  800fce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd6:	89 02                	mov    %eax,(%edx)
+  800fd8:	89 c8                	mov    %ecx,%eax
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+
+00800fdc <fd_lookup>:
+  800fdc:	55                   	push   %ebp
+  800fdd:	89 e5                	mov    %esp,%ebp
+  800fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe2:	83 f8 1f             	cmp    $0x1f,%eax
+  800fe5:	77 30                	ja     801017 <fd_lookup+0x3b>
+  800fe7:	c1 e0 0c             	shl    $0xc,%eax
+  800fea:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  800fef:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ff5:	f6 c2 01             	test   $0x1,%dl
+  800ff8:	74 24                	je     80101e <fd_lookup+0x42>
+  800ffa:	89 c2                	mov    %eax,%edx
+  800ffc:	c1 ea 0c             	shr    $0xc,%edx
+  800fff:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801006:	f6 c2 01             	test   $0x1,%dl
+  801009:	74 1a                	je     801025 <fd_lookup+0x49>
+  80100b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80100e:	89 02                	mov    %eax,(%edx)
+  801010:	b8 00 00 00 00       	mov    $0x0,%eax
+  801015:	5d                   	pop    %ebp
+  801016:	c3                   	ret
+  801017:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80101c:	eb f7                	jmp    801015 <fd_lookup+0x39>
+  80101e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801023:	eb f0                	jmp    801015 <fd_lookup+0x39>
+  801025:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80102a:	eb e9                	jmp    801015 <fd_lookup+0x39>
+
+0080102c <dev_lookup>:
+  80102c:	55                   	push   %ebp
+  80102d:	89 e5                	mov    %esp,%ebp
+  80102f:	53                   	push   %ebx
+  801030:	83 ec 04             	sub    $0x4,%esp
+  801033:	8b 55 08             	mov    0x8(%ebp),%edx
+  801036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103b:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801040:	39 13                	cmp    %edx,(%ebx)
+  801042:	74 37                	je     80107b <dev_lookup+0x4f>
+  801044:	83 c0 01             	add    $0x1,%eax
+  801047:	8b 1c 85 8c 37 80 00 	mov    0x80378c(,%eax,4),%ebx
+  80104e:	85 db                	test   %ebx,%ebx
+  801050:	75 ee                	jne    801040 <dev_lookup+0x14>
+  801052:	a1 14 54 80 00       	mov    0x805414,%eax
+  801057:	8b 40 48             	mov    0x48(%eax),%eax
+  80105a:	83 ec 04             	sub    $0x4,%esp
+  80105d:	52                   	push   %edx
+  80105e:	50                   	push   %eax
+  80105f:	68 10 37 80 00       	push   $0x803710
+  801064:	e8 e5 1a 00 00       	call   802b4e <cprintf>
+  801069:	83 c4 10             	add    $0x10,%esp
+  80106c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801071:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801074:	89 1a                	mov    %ebx,(%edx)
+  801076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801079:	c9                   	leave
+  80107a:	c3                   	ret
+  80107b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801080:	eb ef                	jmp    801071 <dev_lookup+0x45>
+
+00801082 <fd_close>:
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	83 ec 24             	sub    $0x24,%esp
+  80108b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80108e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801091:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801094:	50                   	push   %eax
+  801095:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80109b:	c1 e8 0c             	shr    $0xc,%eax
+  80109e:	50                   	push   %eax
+  80109f:	e8 38 ff ff ff       	call   800fdc <fd_lookup>
+  8010a4:	89 c3                	mov    %eax,%ebx
+  8010a6:	83 c4 10             	add    $0x10,%esp
+  8010a9:	85 c0                	test   %eax,%eax
+  8010ab:	78 05                	js     8010b2 <fd_close+0x30>
+  8010ad:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8010b0:	74 0f                	je     8010c1 <fd_close+0x3f>
+  8010b2:	85 ff                	test   %edi,%edi
+  8010b4:	0f 44 df             	cmove  %edi,%ebx
+  8010b7:	89 d8                	mov    %ebx,%eax
+  8010b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+  8010c1:	83 ec 08             	sub    $0x8,%esp
+  8010c4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8010c7:	50                   	push   %eax
+  8010c8:	ff 36                	push   (%esi)
+  8010ca:	e8 5d ff ff ff       	call   80102c <dev_lookup>
+  8010cf:	89 c3                	mov    %eax,%ebx
+  8010d1:	83 c4 10             	add    $0x10,%esp
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	78 1a                	js     8010f2 <fd_close+0x70>
+  8010d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8010db:	8b 40 10             	mov    0x10(%eax),%eax
+  8010de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e3:	85 c0                	test   %eax,%eax
+  8010e5:	74 0b                	je     8010f2 <fd_close+0x70>
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+  8010ea:	56                   	push   %esi
+  8010eb:	ff d0                	call   *%eax
+  8010ed:	89 c3                	mov    %eax,%ebx
+  8010ef:	83 c4 10             	add    $0x10,%esp
+  8010f2:	83 ec 08             	sub    $0x8,%esp
+  8010f5:	56                   	push   %esi
+  8010f6:	6a 00                	push   $0x0
+  8010f8:	e8 cc f6 ff ff       	call   8007c9 <sys_page_unmap>
+  8010fd:	83 c4 10             	add    $0x10,%esp
+  801100:	eb b5                	jmp    8010b7 <fd_close+0x35>
+
+00801102 <close>:
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	83 ec 20             	sub    $0x20,%esp
+  801108:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80110b:	50                   	push   %eax
+  80110c:	ff 75 08             	push   0x8(%ebp)
+  80110f:	e8 c8 fe ff ff       	call   800fdc <fd_lookup>
+  801114:	83 c4 10             	add    $0x10,%esp
+  801117:	85 c0                	test   %eax,%eax
+  801119:	79 02                	jns    80111d <close+0x1b>
+  80111b:	c9                   	leave
+  80111c:	c3                   	ret
+  80111d:	83 ec 08             	sub    $0x8,%esp
+  801120:	6a 01                	push   $0x1
+  801122:	ff 75 f4             	push   -0xc(%ebp)
+  801125:	e8 58 ff ff ff       	call   801082 <fd_close>
+  80112a:	83 c4 10             	add    $0x10,%esp
+  80112d:	eb ec                	jmp    80111b <close+0x19>
+
+0080112f <close_all>:
+  80112f:	55                   	push   %ebp
+  801130:	89 e5                	mov    %esp,%ebp
+  801132:	53                   	push   %ebx
+  801133:	83 ec 04             	sub    $0x4,%esp
+  801136:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113b:	83 ec 0c             	sub    $0xc,%esp
+  80113e:	53                   	push   %ebx
+  80113f:	e8 be ff ff ff       	call   801102 <close>
+  801144:	83 c3 01             	add    $0x1,%ebx
+  801147:	83 c4 10             	add    $0x10,%esp
+  80114a:	83 fb 20             	cmp    $0x20,%ebx
+  80114d:	75 ec                	jne    80113b <close_all+0xc>
+  80114f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801152:	c9                   	leave
+  801153:	c3                   	ret
+
+00801154 <dup>:
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	57                   	push   %edi
+  801158:	56                   	push   %esi
+  801159:	53                   	push   %ebx
+  80115a:	83 ec 34             	sub    $0x34,%esp
+  80115d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801160:	50                   	push   %eax
+  801161:	ff 75 08             	push   0x8(%ebp)
+  801164:	e8 73 fe ff ff       	call   800fdc <fd_lookup>
+  801169:	89 c3                	mov    %eax,%ebx
+  80116b:	83 c4 10             	add    $0x10,%esp
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	78 7f                	js     8011f1 <dup+0x9d>
+  801172:	83 ec 0c             	sub    $0xc,%esp
+  801175:	ff 75 0c             	push   0xc(%ebp)
+  801178:	e8 85 ff ff ff       	call   801102 <close>
+  80117d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801180:	c1 e6 0c             	shl    $0xc,%esi
+  801183:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801189:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80118c:	89 3c 24             	mov    %edi,(%esp)
+  80118f:	e8 e1 fd ff ff       	call   800f75 <fd2data>
+  801194:	89 c3                	mov    %eax,%ebx
+  801196:	89 34 24             	mov    %esi,(%esp)
+  801199:	e8 d7 fd ff ff       	call   800f75 <fd2data>
+  80119e:	83 c4 10             	add    $0x10,%esp
+  8011a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8011a4:	89 d8                	mov    %ebx,%eax
+  8011a6:	c1 e8 16             	shr    $0x16,%eax
+  8011a9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011b0:	a8 01                	test   $0x1,%al
+  8011b2:	74 11                	je     8011c5 <dup+0x71>
+  8011b4:	89 d8                	mov    %ebx,%eax
+  8011b6:	c1 e8 0c             	shr    $0xc,%eax
+  8011b9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011c0:	f6 c2 01             	test   $0x1,%dl
+  8011c3:	75 36                	jne    8011fb <dup+0xa7>
+  8011c5:	89 f8                	mov    %edi,%eax
+  8011c7:	c1 e8 0c             	shr    $0xc,%eax
+  8011ca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011d1:	83 ec 0c             	sub    $0xc,%esp
+  8011d4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011d9:	50                   	push   %eax
+  8011da:	56                   	push   %esi
+  8011db:	6a 00                	push   $0x0
+  8011dd:	57                   	push   %edi
+  8011de:	6a 00                	push   $0x0
+  8011e0:	e8 55 f5 ff ff       	call   80073a <sys_page_map>
+  8011e5:	89 c3                	mov    %eax,%ebx
+  8011e7:	83 c4 20             	add    $0x20,%esp
+  8011ea:	85 c0                	test   %eax,%eax
+  8011ec:	78 33                	js     801221 <dup+0xcd>
+  8011ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8011f1:	89 d8                	mov    %ebx,%eax
+  8011f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+  8011fb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801202:	83 ec 0c             	sub    $0xc,%esp
+  801205:	25 07 0e 00 00       	and    $0xe07,%eax
+  80120a:	50                   	push   %eax
+  80120b:	ff 75 d4             	push   -0x2c(%ebp)
+  80120e:	6a 00                	push   $0x0
+  801210:	53                   	push   %ebx
+  801211:	6a 00                	push   $0x0
+  801213:	e8 22 f5 ff ff       	call   80073a <sys_page_map>
+  801218:	89 c3                	mov    %eax,%ebx
+  80121a:	83 c4 20             	add    $0x20,%esp
+  80121d:	85 c0                	test   %eax,%eax
+  80121f:	79 a4                	jns    8011c5 <dup+0x71>
+  801221:	83 ec 08             	sub    $0x8,%esp
+  801224:	56                   	push   %esi
+  801225:	6a 00                	push   $0x0
+  801227:	e8 9d f5 ff ff       	call   8007c9 <sys_page_unmap>
+  80122c:	83 c4 08             	add    $0x8,%esp
+  80122f:	ff 75 d4             	push   -0x2c(%ebp)
+  801232:	6a 00                	push   $0x0
+  801234:	e8 90 f5 ff ff       	call   8007c9 <sys_page_unmap>
+  801239:	83 c4 10             	add    $0x10,%esp
+  80123c:	eb b3                	jmp    8011f1 <dup+0x9d>
+
+0080123e <read>:
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	56                   	push   %esi
+  801242:	53                   	push   %ebx
+  801243:	83 ec 18             	sub    $0x18,%esp
+  801246:	8b 75 08             	mov    0x8(%ebp),%esi
+  801249:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80124c:	50                   	push   %eax
+  80124d:	56                   	push   %esi
+  80124e:	e8 89 fd ff ff       	call   800fdc <fd_lookup>
+  801253:	83 c4 10             	add    $0x10,%esp
+  801256:	85 c0                	test   %eax,%eax
+  801258:	78 3c                	js     801296 <read+0x58>
+  80125a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80125d:	83 ec 08             	sub    $0x8,%esp
+  801260:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801263:	50                   	push   %eax
+  801264:	ff 33                	push   (%ebx)
+  801266:	e8 c1 fd ff ff       	call   80102c <dev_lookup>
+  80126b:	83 c4 10             	add    $0x10,%esp
+  80126e:	85 c0                	test   %eax,%eax
+  801270:	78 24                	js     801296 <read+0x58>
+  801272:	8b 43 08             	mov    0x8(%ebx),%eax
+  801275:	83 e0 03             	and    $0x3,%eax
+  801278:	83 f8 01             	cmp    $0x1,%eax
+  80127b:	74 20                	je     80129d <read+0x5f>
+  80127d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801280:	8b 40 08             	mov    0x8(%eax),%eax
+  801283:	85 c0                	test   %eax,%eax
+  801285:	74 37                	je     8012be <read+0x80>
+  801287:	83 ec 04             	sub    $0x4,%esp
+  80128a:	ff 75 10             	push   0x10(%ebp)
+  80128d:	ff 75 0c             	push   0xc(%ebp)
+  801290:	53                   	push   %ebx
+  801291:	ff d0                	call   *%eax
+  801293:	83 c4 10             	add    $0x10,%esp
+  801296:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801299:	5b                   	pop    %ebx
+  80129a:	5e                   	pop    %esi
+  80129b:	5d                   	pop    %ebp
+  80129c:	c3                   	ret
+  80129d:	a1 14 54 80 00       	mov    0x805414,%eax
+  8012a2:	8b 40 48             	mov    0x48(%eax),%eax
+  8012a5:	83 ec 04             	sub    $0x4,%esp
+  8012a8:	56                   	push   %esi
+  8012a9:	50                   	push   %eax
+  8012aa:	68 51 37 80 00       	push   $0x803751
+  8012af:	e8 9a 18 00 00       	call   802b4e <cprintf>
+  8012b4:	83 c4 10             	add    $0x10,%esp
+  8012b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012bc:	eb d8                	jmp    801296 <read+0x58>
+  8012be:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012c3:	eb d1                	jmp    801296 <read+0x58>
+
+008012c5 <readn>:
+  8012c5:	55                   	push   %ebp
+  8012c6:	89 e5                	mov    %esp,%ebp
+  8012c8:	57                   	push   %edi
+  8012c9:	56                   	push   %esi
+  8012ca:	53                   	push   %ebx
+  8012cb:	83 ec 0c             	sub    $0xc,%esp
+  8012ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8012d1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8012d4:	85 f6                	test   %esi,%esi
+  8012d6:	74 30                	je     801308 <readn+0x43>
+  8012d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e2:	83 ec 04             	sub    $0x4,%esp
+  8012e5:	89 f2                	mov    %esi,%edx
+  8012e7:	29 c2                	sub    %eax,%edx
+  8012e9:	52                   	push   %edx
+  8012ea:	01 f8                	add    %edi,%eax
+  8012ec:	50                   	push   %eax
+  8012ed:	ff 75 08             	push   0x8(%ebp)
+  8012f0:	e8 49 ff ff ff       	call   80123e <read>
+  8012f5:	83 c4 10             	add    $0x10,%esp
+  8012f8:	85 c0                	test   %eax,%eax
+  8012fa:	78 15                	js     801311 <readn+0x4c>
+  8012fc:	74 11                	je     80130f <readn+0x4a>
+  8012fe:	01 c3                	add    %eax,%ebx
+  801300:	89 d8                	mov    %ebx,%eax
+  801302:	39 f3                	cmp    %esi,%ebx
+  801304:	72 dc                	jb     8012e2 <readn+0x1d>
+  801306:	eb 09                	jmp    801311 <readn+0x4c>
+  801308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130d:	eb 02                	jmp    801311 <readn+0x4c>
+  80130f:	89 d8                	mov    %ebx,%eax
+  801311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801314:	5b                   	pop    %ebx
+  801315:	5e                   	pop    %esi
+  801316:	5f                   	pop    %edi
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+
+00801319 <write>:
+  801319:	55                   	push   %ebp
+  80131a:	89 e5                	mov    %esp,%ebp
+  80131c:	56                   	push   %esi
+  80131d:	53                   	push   %ebx
+  80131e:	83 ec 18             	sub    $0x18,%esp
+  801321:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801324:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801327:	50                   	push   %eax
+  801328:	53                   	push   %ebx
+  801329:	e8 ae fc ff ff       	call   800fdc <fd_lookup>
+  80132e:	83 c4 10             	add    $0x10,%esp
+  801331:	85 c0                	test   %eax,%eax
+  801333:	78 37                	js     80136c <write+0x53>
+  801335:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801338:	83 ec 08             	sub    $0x8,%esp
+  80133b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80133e:	50                   	push   %eax
+  80133f:	ff 36                	push   (%esi)
+  801341:	e8 e6 fc ff ff       	call   80102c <dev_lookup>
+  801346:	83 c4 10             	add    $0x10,%esp
+  801349:	85 c0                	test   %eax,%eax
+  80134b:	78 1f                	js     80136c <write+0x53>
+  80134d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801351:	74 20                	je     801373 <write+0x5a>
+  801353:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801356:	8b 40 0c             	mov    0xc(%eax),%eax
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	74 37                	je     801394 <write+0x7b>
+  80135d:	83 ec 04             	sub    $0x4,%esp
+  801360:	ff 75 10             	push   0x10(%ebp)
+  801363:	ff 75 0c             	push   0xc(%ebp)
+  801366:	56                   	push   %esi
+  801367:	ff d0                	call   *%eax
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136f:	5b                   	pop    %ebx
+  801370:	5e                   	pop    %esi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+  801373:	a1 14 54 80 00       	mov    0x805414,%eax
+  801378:	8b 40 48             	mov    0x48(%eax),%eax
+  80137b:	83 ec 04             	sub    $0x4,%esp
+  80137e:	53                   	push   %ebx
+  80137f:	50                   	push   %eax
+  801380:	68 6d 37 80 00       	push   $0x80376d
+  801385:	e8 c4 17 00 00       	call   802b4e <cprintf>
+  80138a:	83 c4 10             	add    $0x10,%esp
+  80138d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801392:	eb d8                	jmp    80136c <write+0x53>
+  801394:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801399:	eb d1                	jmp    80136c <write+0x53>
+
+0080139b <seek>:
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  80139e:	83 ec 20             	sub    $0x20,%esp
+  8013a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a4:	50                   	push   %eax
+  8013a5:	ff 75 08             	push   0x8(%ebp)
+  8013a8:	e8 2f fc ff ff       	call   800fdc <fd_lookup>
+  8013ad:	83 c4 10             	add    $0x10,%esp
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	78 0e                	js     8013c2 <seek+0x27>
+  8013b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ba:	89 50 04             	mov    %edx,0x4(%eax)
+  8013bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c2:	c9                   	leave
+  8013c3:	c3                   	ret
+
+008013c4 <ftruncate>:
+  8013c4:	55                   	push   %ebp
+  8013c5:	89 e5                	mov    %esp,%ebp
+  8013c7:	56                   	push   %esi
+  8013c8:	53                   	push   %ebx
+  8013c9:	83 ec 18             	sub    $0x18,%esp
+  8013cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8013cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013d2:	50                   	push   %eax
+  8013d3:	53                   	push   %ebx
+  8013d4:	e8 03 fc ff ff       	call   800fdc <fd_lookup>
+  8013d9:	83 c4 10             	add    $0x10,%esp
+  8013dc:	85 c0                	test   %eax,%eax
+  8013de:	78 34                	js     801414 <ftruncate+0x50>
+  8013e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013e3:	83 ec 08             	sub    $0x8,%esp
+  8013e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e9:	50                   	push   %eax
+  8013ea:	ff 36                	push   (%esi)
+  8013ec:	e8 3b fc ff ff       	call   80102c <dev_lookup>
+  8013f1:	83 c4 10             	add    $0x10,%esp
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	78 1c                	js     801414 <ftruncate+0x50>
+  8013f8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013fc:	74 1d                	je     80141b <ftruncate+0x57>
+  8013fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801401:	8b 40 18             	mov    0x18(%eax),%eax
+  801404:	85 c0                	test   %eax,%eax
+  801406:	74 34                	je     80143c <ftruncate+0x78>
+  801408:	83 ec 08             	sub    $0x8,%esp
+  80140b:	ff 75 0c             	push   0xc(%ebp)
+  80140e:	56                   	push   %esi
+  80140f:	ff d0                	call   *%eax
+  801411:	83 c4 10             	add    $0x10,%esp
+  801414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801417:	5b                   	pop    %ebx
+  801418:	5e                   	pop    %esi
+  801419:	5d                   	pop    %ebp
+  80141a:	c3                   	ret
+  80141b:	a1 14 54 80 00       	mov    0x805414,%eax
+  801420:	8b 40 48             	mov    0x48(%eax),%eax
+  801423:	83 ec 04             	sub    $0x4,%esp
+  801426:	53                   	push   %ebx
+  801427:	50                   	push   %eax
+  801428:	68 30 37 80 00       	push   $0x803730
+  80142d:	e8 1c 17 00 00       	call   802b4e <cprintf>
+  801432:	83 c4 10             	add    $0x10,%esp
+  801435:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143a:	eb d8                	jmp    801414 <ftruncate+0x50>
+  80143c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801441:	eb d1                	jmp    801414 <ftruncate+0x50>
+
+00801443 <fstat>:
+  801443:	55                   	push   %ebp
+  801444:	89 e5                	mov    %esp,%ebp
+  801446:	56                   	push   %esi
+  801447:	53                   	push   %ebx
+  801448:	83 ec 18             	sub    $0x18,%esp
+  80144b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80144e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801451:	50                   	push   %eax
+  801452:	ff 75 08             	push   0x8(%ebp)
+  801455:	e8 82 fb ff ff       	call   800fdc <fd_lookup>
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	78 49                	js     8014aa <fstat+0x67>
+  801461:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801464:	83 ec 08             	sub    $0x8,%esp
+  801467:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80146a:	50                   	push   %eax
+  80146b:	ff 36                	push   (%esi)
+  80146d:	e8 ba fb ff ff       	call   80102c <dev_lookup>
+  801472:	83 c4 10             	add    $0x10,%esp
+  801475:	85 c0                	test   %eax,%eax
+  801477:	78 31                	js     8014aa <fstat+0x67>
+  801479:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80147c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801480:	74 2f                	je     8014b1 <fstat+0x6e>
+  801482:	c6 03 00             	movb   $0x0,(%ebx)
+  801485:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80148c:	00 00 00 
+  80148f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801496:	00 00 00 
+  801499:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  80149f:	83 ec 08             	sub    $0x8,%esp
+  8014a2:	53                   	push   %ebx
+  8014a3:	56                   	push   %esi
+  8014a4:	ff 50 14             	call   *0x14(%eax)
+  8014a7:	83 c4 10             	add    $0x10,%esp
+  8014aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ad:	5b                   	pop    %ebx
+  8014ae:	5e                   	pop    %esi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+  8014b1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014b6:	eb f2                	jmp    8014aa <fstat+0x67>
+
+008014b8 <stat>:
+  8014b8:	55                   	push   %ebp
+  8014b9:	89 e5                	mov    %esp,%ebp
+  8014bb:	56                   	push   %esi
+  8014bc:	53                   	push   %ebx
+  8014bd:	83 ec 08             	sub    $0x8,%esp
+  8014c0:	6a 00                	push   $0x0
+  8014c2:	ff 75 08             	push   0x8(%ebp)
+  8014c5:	e8 31 05 00 00       	call   8019fb <open>
+  8014ca:	89 c3                	mov    %eax,%ebx
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 1b                	js     8014ee <stat+0x36>
+  8014d3:	83 ec 08             	sub    $0x8,%esp
+  8014d6:	ff 75 0c             	push   0xc(%ebp)
+  8014d9:	50                   	push   %eax
+  8014da:	e8 64 ff ff ff       	call   801443 <fstat>
+  8014df:	89 c6                	mov    %eax,%esi
+  8014e1:	89 1c 24             	mov    %ebx,(%esp)
+  8014e4:	e8 19 fc ff ff       	call   801102 <close>
+  8014e9:	83 c4 10             	add    $0x10,%esp
+  8014ec:	89 f3                	mov    %esi,%ebx
+  8014ee:	89 d8                	mov    %ebx,%eax
+  8014f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f3:	5b                   	pop    %ebx
+  8014f4:	5e                   	pop    %esi
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+
+008014f7 <fsipc>:
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	56                   	push   %esi
+  8014fb:	53                   	push   %ebx
+  8014fc:	89 c3                	mov    %eax,%ebx
+  8014fe:	89 d6                	mov    %edx,%esi
+  801500:	83 3d 08 54 80 00 00 	cmpl   $0x0,0x805408
+  801507:	74 20                	je     801529 <fsipc+0x32>
+  801509:	83 ec 08             	sub    $0x8,%esp
+  80150c:	6a 00                	push   $0x0
+  80150e:	56                   	push   %esi
+  80150f:	6a 07                	push   $0x7
+  801511:	68 00 60 80 00       	push   $0x806000
+  801516:	53                   	push   %ebx
+  801517:	ff 35 08 54 80 00    	push   0x805408
+  80151d:	e8 8f 1d 00 00       	call   8032b1 <ipc_call>
+  801522:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801525:	5b                   	pop    %ebx
+  801526:	5e                   	pop    %esi
+  801527:	5d                   	pop    %ebp
+  801528:	c3                   	ret
+  801529:	83 ec 0c             	sub    $0xc,%esp
+  80152c:	6a 02                	push   $0x2
+  80152e:	e8 19 1f 00 00       	call   80344c <ipc_find_env>
+  801533:	a3 08 54 80 00       	mov    %eax,0x805408
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	eb cc                	jmp    801509 <fsipc+0x12>
+
+0080153d <devfile_trunc>:
+  80153d:	55                   	push   %ebp
+  80153e:	89 e5                	mov    %esp,%ebp
+  801540:	83 ec 08             	sub    $0x8,%esp
+  801543:	8b 45 08             	mov    0x8(%ebp),%eax
+  801546:	8b 40 0c             	mov    0xc(%eax),%eax
+  801549:	a3 00 60 80 00       	mov    %eax,0x806000
+  80154e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801551:	a3 04 60 80 00       	mov    %eax,0x806004
+  801556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801560:	e8 92 ff ff ff       	call   8014f7 <fsipc>
+  801565:	c9                   	leave
+  801566:	c3                   	ret
+
+00801567 <devfile_flush>:
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	83 ec 08             	sub    $0x8,%esp
+  80156d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801570:	8b 40 0c             	mov    0xc(%eax),%eax
+  801573:	a3 00 60 80 00       	mov    %eax,0x806000
+  801578:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801582:	e8 70 ff ff ff       	call   8014f7 <fsipc>
+  801587:	c9                   	leave
+  801588:	c3                   	ret
+
+00801589 <devfile_stat>:
+  801589:	55                   	push   %ebp
+  80158a:	89 e5                	mov    %esp,%ebp
+  80158c:	53                   	push   %ebx
+  80158d:	83 ec 04             	sub    $0x4,%esp
+  801590:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801593:	8b 45 08             	mov    0x8(%ebp),%eax
+  801596:	8b 40 0c             	mov    0xc(%eax),%eax
+  801599:	a3 00 60 80 00       	mov    %eax,0x806000
+  80159e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015a8:	e8 4a ff ff ff       	call   8014f7 <fsipc>
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	78 2c                	js     8015dd <devfile_stat+0x54>
+  8015b1:	83 ec 08             	sub    $0x8,%esp
+  8015b4:	68 00 60 80 00       	push   $0x806000
+  8015b9:	53                   	push   %ebx
+  8015ba:	e8 d8 ec ff ff       	call   800297 <strcpy>
+  8015bf:	a1 80 60 80 00       	mov    0x806080,%eax
+  8015c4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8015ca:	a1 84 60 80 00       	mov    0x806084,%eax
+  8015cf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8015d5:	83 c4 10             	add    $0x10,%esp
+  8015d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015e0:	c9                   	leave
+  8015e1:	c3                   	ret
+
+008015e2 <fsring_rw>:
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	57                   	push   %edi
+  8015e6:	56                   	push   %esi
+  8015e7:	53                   	push   %ebx
+  8015e8:	83 ec 2c             	sub    $0x2c,%esp
+  8015eb:	89 c7                	mov    %eax,%edi
+  8015ed:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8015f0:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8015f3:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8015f8:	a8 01                	test   $0x1,%al
+  8015fa:	74 0d                	je     801609 <fsring_rw+0x27>
+  8015fc:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801601:	a8 01                	test   $0x1,%al
+  801603:	0f 85 d5 00 00 00    	jne    8016de <fsring_rw+0xfc>
+  801609:	a1 14 54 80 00       	mov    0x805414,%eax
+  80160e:	8b 40 48             	mov    0x48(%eax),%eax
+  801611:	3b 05 04 54 80 00    	cmp    0x805404,%eax
+  801617:	0f 84 fc 00 00 00    	je     801719 <fsring_rw+0x137>
+  80161d:	83 3d 08 54 80 00 00 	cmpl   $0x0,0x805408
+  801624:	0f 84 02 01 00 00    	je     80172c <fsring_rw+0x14a>
+  80162a:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80162f:	83 ec 04             	sub    $0x4,%esp
+  801632:	68 07 02 00 00       	push   $0x207
+  801637:	53                   	push   %ebx
+  801638:	6a 00                	push   $0x0
+  80163a:	e8 b8 f0 ff ff       	call   8006f7 <sys_page_alloc>
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	0f 88 f9 00 00 00    	js     801743 <fsring_rw+0x161>
+  80164a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801650:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801656:	75 d7                	jne    80162f <fsring_rw+0x4d>
+  801658:	6a 0e                	push   $0xe
+  80165a:	6a 0d                	push   $0xd
+  80165c:	ff 35 08 54 80 00    	push   0x805408
+  801662:	68 00 00 f0 cf       	push   $0xcff00000
+  801667:	e8 73 10 00 00       	call   8026df <ipcring_init>
+  80166c:	83 c4 08             	add    $0x8,%esp
+  80166f:	6a 00                	push   $0x0
+  801671:	6a 00                	push   $0x0
+  801673:	68 07 02 00 00       	push   $0x207
+  801678:	68 00 00 f0 cf       	push   $0xcff00000
+  80167d:	6a 0b                	push   $0xb
+  80167f:	ff 35 08 54 80 00    	push   0x805408
+  801685:	e8 27 1c 00 00       	call   8032b1 <ipc_call>
+  80168a:	89 c6                	mov    %eax,%esi
+  80168c:	83 c4 20             	add    $0x20,%esp
+  80168f:	85 c0                	test   %eax,%eax
+  801691:	0f 88 ac 00 00 00    	js     801743 <fsring_rw+0x161>
+  801697:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169c:	89 d9                	mov    %ebx,%ecx
+  80169e:	83 c3 01             	add    $0x1,%ebx
+  8016a1:	89 da                	mov    %ebx,%edx
+  8016a3:	c1 e2 0c             	shl    $0xc,%edx
+  8016a6:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8016ac:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8016b2:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8016b8:	83 ec 08             	sub    $0x8,%esp
+  8016bb:	6a 00                	push   $0x0
+  8016bd:	6a 00                	push   $0x0
+  8016bf:	68 07 02 00 00       	push   $0x207
+  8016c4:	50                   	push   %eax
+  8016c5:	6a 0c                	push   $0xc
+  8016c7:	ff 35 08 54 80 00    	push   0x805408
+  8016cd:	e8 df 1b 00 00       	call   8032b1 <ipc_call>
+  8016d2:	83 c4 20             	add    $0x20,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 6a                	js     801743 <fsring_rw+0x161>
+  8016d9:	83 fb 08             	cmp    $0x8,%ebx
+  8016dc:	75 be                	jne    80169c <fsring_rw+0xba>
+  8016de:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8016e2:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8016e7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8016ec:	0f 45 c2             	cmovne %edx,%eax
+  8016ef:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8016f2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8016f9:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801700:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801707:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170c:	be 00 00 00 00       	mov    $0x0,%esi
+  801711:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801714:	e9 4b 01 00 00       	jmp    801864 <fsring_rw+0x282>
+  801719:	e8 a3 f3 ff ff       	call   800ac1 <sys_time_msec>
+  80171e:	3b 05 00 54 80 00    	cmp    0x805400,%eax
+  801724:	0f 89 f3 fe ff ff    	jns    80161d <fsring_rw+0x3b>
+  80172a:	eb 54                	jmp    801780 <fsring_rw+0x19e>
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+  80172f:	6a 02                	push   $0x2
+  801731:	e8 16 1d 00 00       	call   80344c <ipc_find_env>
+  801736:	a3 08 54 80 00       	mov    %eax,0x805408
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	e9 e7 fe ff ff       	jmp    80162a <fsring_rw+0x48>
+  801743:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801748:	83 ec 08             	sub    $0x8,%esp
+  80174b:	53                   	push   %ebx
+  80174c:	6a 00                	push   $0x0
+  80174e:	e8 76 f0 ff ff       	call   8007c9 <sys_page_unmap>
+  801753:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801759:	83 c4 10             	add    $0x10,%esp
+  80175c:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801762:	75 e4                	jne    801748 <fsring_rw+0x166>
+  801764:	e8 58 f3 ff ff       	call   800ac1 <sys_time_msec>
+  801769:	05 e8 03 00 00       	add    $0x3e8,%eax
+  80176e:	a3 00 54 80 00       	mov    %eax,0x805400
+  801773:	a1 14 54 80 00       	mov    0x805414,%eax
+  801778:	8b 40 48             	mov    0x48(%eax),%eax
+  80177b:	a3 04 54 80 00       	mov    %eax,0x805404
+  801780:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801787:	e9 7a 01 00 00       	jmp    801906 <fsring_rw+0x324>
+  80178c:	8b 57 0c             	mov    0xc(%edi),%edx
+  80178f:	89 10                	mov    %edx,(%eax)
+  801791:	89 58 04             	mov    %ebx,0x4(%eax)
+  801794:	89 f2                	mov    %esi,%edx
+  801796:	03 57 04             	add    0x4(%edi),%edx
+  801799:	89 50 08             	mov    %edx,0x8(%eax)
+  80179c:	83 ec 04             	sub    $0x4,%esp
+  80179f:	53                   	push   %ebx
+  8017a0:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8017a3:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8017a6:	52                   	push   %edx
+  8017a7:	83 c0 0c             	add    $0xc,%eax
+  8017aa:	50                   	push   %eax
+  8017ab:	e8 97 ec ff ff       	call   800447 <memmove>
+  8017b0:	83 c4 10             	add    $0x10,%esp
+  8017b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017b6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017b9:	89 08                	mov    %ecx,(%eax)
+  8017bb:	83 ec 0c             	sub    $0xc,%esp
+  8017be:	68 00 00 f0 cf       	push   $0xcff00000
+  8017c3:	e8 75 0f 00 00       	call   80273d <ipcring_req_push>
+  8017c8:	01 de                	add    %ebx,%esi
+  8017ca:	83 c4 10             	add    $0x10,%esp
+  8017cd:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8017d0:	73 4c                	jae    80181e <fsring_rw+0x23c>
+  8017d2:	83 ec 0c             	sub    $0xc,%esp
+  8017d5:	68 00 00 f0 cf       	push   $0xcff00000
+  8017da:	e8 38 0f 00 00       	call   802717 <ipcring_req_slot>
+  8017df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	74 35                	je     80181e <fsring_rw+0x23c>
+  8017e9:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8017ee:	83 e0 07             	and    $0x7,%eax
+  8017f1:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8017f6:	c1 e0 0c             	shl    $0xc,%eax
+  8017f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8017fc:	29 f3                	sub    %esi,%ebx
+  8017fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801801:	39 cb                	cmp    %ecx,%ebx
+  801803:	0f 47 d9             	cmova  %ecx,%ebx
+  801806:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80180a:	75 80                	jne    80178c <fsring_rw+0x1aa>
+  80180c:	8b 57 0c             	mov    0xc(%edi),%edx
+  80180f:	89 10                	mov    %edx,(%eax)
+  801811:	89 58 04             	mov    %ebx,0x4(%eax)
+  801814:	89 f2                	mov    %esi,%edx
+  801816:	03 57 04             	add    0x4(%edi),%edx
+  801819:	89 50 08             	mov    %edx,0x8(%eax)
+  80181c:	eb 95                	jmp    8017b3 <fsring_rw+0x1d1>
+  80181e:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801823:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801826:	83 ec 0c             	sub    $0xc,%esp
+  801829:	68 00 00 f0 cf       	push   $0xcff00000
+  80182e:	e8 43 0f 00 00       	call   802776 <ipcring_rsp_wait>
+  801833:	8b 58 04             	mov    0x4(%eax),%ebx
+  801836:	83 c4 10             	add    $0x10,%esp
+  801839:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80183d:	75 45                	jne    801884 <fsring_rw+0x2a2>
+  80183f:	85 db                	test   %ebx,%ebx
+  801841:	79 41                	jns    801884 <fsring_rw+0x2a2>
+  801843:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801846:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  80184d:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801854:	83 ec 0c             	sub    $0xc,%esp
+  801857:	68 00 00 f0 cf       	push   $0xcff00000
+  80185c:	e8 7b 0f 00 00       	call   8027dc <ipcring_rsp_pop>
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80186a:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  80186f:	39 c2                	cmp    %eax,%edx
+  801871:	74 75                	je     8018e8 <fsring_rw+0x306>
+  801873:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801877:	75 a5                	jne    80181e <fsring_rw+0x23c>
+  801879:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80187c:	0f 82 50 ff ff ff    	jb     8017d2 <fsring_rw+0x1f0>
+  801882:	eb 9a                	jmp    80181e <fsring_rw+0x23c>
+  801884:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801888:	75 ca                	jne    801854 <fsring_rw+0x272>
+  80188a:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80188e:	74 31                	je     8018c1 <fsring_rw+0x2df>
+  801890:	8b 45 08             	mov    0x8(%ebp),%eax
+  801893:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801896:	29 c8                	sub    %ecx,%eax
+  801898:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80189b:	39 d0                	cmp    %edx,%eax
+  80189d:	0f 47 c2             	cmova  %edx,%eax
+  8018a0:	39 d8                	cmp    %ebx,%eax
+  8018a2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8018a7:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8018ab:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8018ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018b3:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8018b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8018ba:	01 d9                	add    %ebx,%ecx
+  8018bc:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8018bf:	eb 93                	jmp    801854 <fsring_rw+0x272>
+  8018c1:	83 ec 04             	sub    $0x4,%esp
+  8018c4:	53                   	push   %ebx
+  8018c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018c8:	83 e0 07             	and    $0x7,%eax
+  8018cb:	c1 e0 0c             	shl    $0xc,%eax
+  8018ce:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8018d4:	50                   	push   %eax
+  8018d5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018d8:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8018db:	01 c8                	add    %ecx,%eax
+  8018dd:	50                   	push   %eax
+  8018de:	e8 64 eb ff ff       	call   800447 <memmove>
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	eb a8                	jmp    801890 <fsring_rw+0x2ae>
+  8018e8:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8018ec:	75 09                	jne    8018f7 <fsring_rw+0x315>
+  8018ee:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8018f1:	0f 82 db fe ff ff    	jb     8017d2 <fsring_rw+0x1f0>
+  8018f7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8018fa:	01 57 04             	add    %edx,0x4(%edi)
+  8018fd:	85 d2                	test   %edx,%edx
+  8018ff:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801903:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801906:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190c:	5b                   	pop    %ebx
+  80190d:	5e                   	pop    %esi
+  80190e:	5f                   	pop    %edi
+  80190f:	5d                   	pop    %ebp
+  801910:	c3                   	ret
+
+00801911 <devfile_write>:
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	57                   	push   %edi
+  801915:	56                   	push   %esi
+  801916:	53                   	push   %ebx
+  801917:	83 ec 0c             	sub    $0xc,%esp
+  80191a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80191d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801920:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801923:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801929:	76 1a                	jbe    801945 <devfile_write+0x34>
+  80192b:	83 ec 0c             	sub    $0xc,%esp
+  80192e:	53                   	push   %ebx
+  80192f:	89 f1                	mov    %esi,%ecx
+  801931:	ba 06 00 00 00       	mov    $0x6,%edx
+  801936:	89 f8                	mov    %edi,%eax
+  801938:	e8 a5 fc ff ff       	call   8015e2 <fsring_rw>
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801943:	75 39                	jne    80197e <devfile_write+0x6d>
+  801945:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80194a:	39 c3                	cmp    %eax,%ebx
+  80194c:	0f 47 d8             	cmova  %eax,%ebx
+  80194f:	8b 47 0c             	mov    0xc(%edi),%eax
+  801952:	a3 00 60 80 00       	mov    %eax,0x806000
+  801957:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80195d:	83 ec 04             	sub    $0x4,%esp
+  801960:	53                   	push   %ebx
+  801961:	56                   	push   %esi
+  801962:	68 08 60 80 00       	push   $0x806008
+  801967:	e8 db ea ff ff       	call   800447 <memmove>
+  80196c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801971:	b8 04 00 00 00       	mov    $0x4,%eax
+  801976:	e8 7c fb ff ff       	call   8014f7 <fsipc>
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801981:	5b                   	pop    %ebx
+  801982:	5e                   	pop    %esi
+  801983:	5f                   	pop    %edi
+  801984:	5d                   	pop    %ebp
+  801985:	c3                   	ret
+
+00801986 <devfile_read>:
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	57                   	push   %edi
+  80198a:	56                   	push   %esi
+  80198b:	53                   	push   %ebx
+  80198c:	83 ec 0c             	sub    $0xc,%esp
+  80198f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801992:	8b 75 10             	mov    0x10(%ebp),%esi
+  801995:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80199b:	76 1d                	jbe    8019ba <devfile_read+0x34>
+  80199d:	83 ec 0c             	sub    $0xc,%esp
+  8019a0:	56                   	push   %esi
+  8019a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a4:	ba 05 00 00 00       	mov    $0x5,%edx
+  8019a9:	89 f8                	mov    %edi,%eax
+  8019ab:	e8 32 fc ff ff       	call   8015e2 <fsring_rw>
+  8019b0:	89 c3                	mov    %eax,%ebx
+  8019b2:	83 c4 10             	add    $0x10,%esp
+  8019b5:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8019b8:	75 37                	jne    8019f1 <devfile_read+0x6b>
+  8019ba:	8b 47 0c             	mov    0xc(%edi),%eax
+  8019bd:	a3 00 60 80 00       	mov    %eax,0x806000
+  8019c2:	89 35 04 60 80 00    	mov    %esi,0x806004
+  8019c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019d2:	e8 20 fb ff ff       	call   8014f7 <fsipc>
+  8019d7:	89 c3                	mov    %eax,%ebx
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	78 14                	js     8019f1 <devfile_read+0x6b>
+  8019dd:	83 ec 04             	sub    $0x4,%esp
+  8019e0:	50                   	push   %eax
+  8019e1:	68 00 60 80 00       	push   $0x806000
+  8019e6:	ff 75 0c             	push   0xc(%ebp)
+  8019e9:	e8 59 ea ff ff       	call   800447 <memmove>
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	89 d8                	mov    %ebx,%eax
+  8019f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f6:	5b                   	pop    %ebx
+  8019f7:	5e                   	pop    %esi
+  8019f8:	5f                   	pop    %edi
+  8019f9:	5d                   	pop    %ebp
+  8019fa:	c3                   	ret
+
+008019fb <open>:
+  8019fb:	55                   	push   %ebp
+  8019fc:	89 e5                	mov    %esp,%ebp
+  8019fe:	56                   	push   %esi
+  8019ff:	53                   	push   %ebx
+  801a00:	83 ec 1c             	sub    $0x1c,%esp
+  801a03:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a06:	56                   	push   %esi
+  801a07:	e8 3f e8 ff ff       	call   80024b <strlen>
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a14:	7f 6c                	jg     801a82 <open+0x87>
+  801a16:	83 ec 0c             	sub    $0xc,%esp
+  801a19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a1c:	50                   	push   %eax
+  801a1d:	e8 6a f5 ff ff       	call   800f8c <fd_alloc>
+  801a22:	89 c3                	mov    %eax,%ebx
+  801a24:	83 c4 10             	add    $0x10,%esp
+  801a27:	85 c0                	test   %eax,%eax
+  801a29:	78 3c                	js     801a67 <open+0x6c>
+  801a2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a2e:	a3 00 64 80 00       	mov    %eax,0x806400
+  801a33:	83 ec 08             	sub    $0x8,%esp
+  801a36:	56                   	push   %esi
+  801a37:	68 00 60 80 00       	push   $0x806000
+  801a3c:	e8 56 e8 ff ff       	call   800297 <strcpy>
+  801a41:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a44:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a49:	e8 a9 fa ff ff       	call   8014f7 <fsipc>
+  801a4e:	89 c3                	mov    %eax,%ebx
+  801a50:	83 c4 10             	add    $0x10,%esp
+  801a53:	85 c0                	test   %eax,%eax
+  801a55:	78 19                	js     801a70 <open+0x75>
+  801a57:	83 ec 0c             	sub    $0xc,%esp
+  801a5a:	ff 75 f4             	push   -0xc(%ebp)
+  801a5d:	e8 03 f5 ff ff       	call   800f65 <fd2num>
+  801a62:	89 c3                	mov    %eax,%ebx
+  801a64:	83 c4 10             	add    $0x10,%esp
+  801a67:	89 d8                	mov    %ebx,%eax
+  801a69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6c:	5b                   	pop    %ebx
+  801a6d:	5e                   	pop    %esi
+  801a6e:	5d                   	pop    %ebp
+  801a6f:	c3                   	ret
+  801a70:	83 ec 08             	sub    $0x8,%esp
+  801a73:	6a 00                	push   $0x0
+  801a75:	ff 75 f4             	push   -0xc(%ebp)
+  801a78:	e8 05 f6 ff ff       	call   801082 <fd_close>
+  801a7d:	83 c4 10             	add    $0x10,%esp
+  801a80:	eb e5                	jmp    801a67 <open+0x6c>
+  801a82:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801a87:	eb de                	jmp    801a67 <open+0x6c>
+
+00801a89 <file_image>:
+  801a89:	55                   	push   %ebp
+  801a8a:	89 e5                	mov    %esp,%ebp
+  801a8c:	53                   	push   %ebx
+  801a8d:	83 ec 1c             	sub    $0x1c,%esp
+  801a90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a96:	50                   	push   %eax
+  801a97:	ff 75 08             	push   0x8(%ebp)
+  801a9a:	e8 3d f5 ff ff       	call   800fdc <fd_lookup>
+  801a9f:	83 c4 10             	add    $0x10,%esp
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	78 58                	js     801afe <file_image+0x75>
+  801aa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa9:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801aaf:	39 08                	cmp    %ecx,(%eax)
+  801ab1:	75 50                	jne    801b03 <file_image+0x7a>
+  801ab3:	83 fb 04             	cmp    $0x4,%ebx
+  801ab6:	77 52                	ja     801b0a <file_image+0x81>
+  801ab8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801abb:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ac0:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801ac6:	83 ec 04             	sub    $0x4,%esp
+  801ac9:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  801acc:	c1 e0 02             	shl    $0x2,%eax
+  801acf:	50                   	push   %eax
+  801ad0:	ff 75 0c             	push   0xc(%ebp)
+  801ad3:	68 08 60 80 00       	push   $0x806008
+  801ad8:	e8 6a e9 ff ff       	call   800447 <memmove>
+  801add:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ae7:	e8 0b fa ff ff       	call   8014f7 <fsipc>
+  801aec:	83 c4 10             	add    $0x10,%esp
+  801aef:	85 c0                	test   %eax,%eax
+  801af1:	78 0b                	js     801afe <file_image+0x75>
+  801af3:	8b 55 14             	mov    0x14(%ebp),%edx
+  801af6:	8b 0d 08 54 80 00    	mov    0x805408,%ecx
+  801afc:	89 0a                	mov    %ecx,(%edx)
+  801afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b01:	c9                   	leave
+  801b02:	c3                   	ret
+  801b03:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b08:	eb f4                	jmp    801afe <file_image+0x75>
+  801b0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b0f:	eb ed                	jmp    801afe <file_image+0x75>
+
+00801b11 <remove>:
+  801b11:	55                   	push   %ebp
+  801b12:	89 e5                	mov    %esp,%ebp
+  801b14:	53                   	push   %ebx
+  801b15:	83 ec 10             	sub    $0x10,%esp
+  801b18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b1b:	53                   	push   %ebx
+  801b1c:	e8 2a e7 ff ff       	call   80024b <strlen>
+  801b21:	83 c4 10             	add    $0x10,%esp
+  801b24:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b29:	7f 25                	jg     801b50 <remove+0x3f>
+  801b2b:	83 ec 08             	sub    $0x8,%esp
+  801b2e:	53                   	push   %ebx
+  801b2f:	68 00 60 80 00       	push   $0x806000
+  801b34:	e8 5e e7 ff ff       	call   800297 <strcpy>
+  801b39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801b43:	e8 af f9 ff ff       	call   8014f7 <fsipc>
+  801b48:	83 c4 10             	add    $0x10,%esp
+  801b4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b4e:	c9                   	leave
+  801b4f:	c3                   	ret
+  801b50:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b55:	eb f4                	jmp    801b4b <remove+0x3a>
+
+00801b57 <sync>:
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	83 ec 08             	sub    $0x8,%esp
+  801b5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b62:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b67:	e8 8b f9 ff ff       	call   8014f7 <fsipc>
+  801b6c:	c9                   	leave
+  801b6d:	c3                   	ret
+
+00801b6e <writebuf>:
+  801b6e:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801b72:	7f 01                	jg     801b75 <writebuf+0x7>
+  801b74:	c3                   	ret
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	53                   	push   %ebx
+  801b79:	83 ec 08             	sub    $0x8,%esp
+  801b7c:	89 c3                	mov    %eax,%ebx
+  801b7e:	ff 70 04             	push   0x4(%eax)
+  801b81:	8d 40 10             	lea    0x10(%eax),%eax
+  801b84:	50                   	push   %eax
+  801b85:	ff 33                	push   (%ebx)
+  801b87:	e8 8d f7 ff ff       	call   801319 <write>
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	7e 03                	jle    801b96 <writebuf+0x28>
+  801b93:	01 43 08             	add    %eax,0x8(%ebx)
+  801b96:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801b99:	74 0d                	je     801ba8 <writebuf+0x3a>
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba2:	0f 4f c2             	cmovg  %edx,%eax
+  801ba5:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801ba8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bab:	c9                   	leave
+  801bac:	c3                   	ret
+
+00801bad <putch>:
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	53                   	push   %ebx
+  801bb1:	83 ec 04             	sub    $0x4,%esp
+  801bb4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bb7:	8b 53 04             	mov    0x4(%ebx),%edx
+  801bba:	8d 42 01             	lea    0x1(%edx),%eax
+  801bbd:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bc0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bc3:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  801bc7:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801bcc:	74 05                	je     801bd3 <putch+0x26>
+  801bce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd1:	c9                   	leave
+  801bd2:	c3                   	ret
+  801bd3:	89 d8                	mov    %ebx,%eax
+  801bd5:	e8 94 ff ff ff       	call   801b6e <writebuf>
+  801bda:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  801be1:	eb eb                	jmp    801bce <putch+0x21>
+
+00801be3 <vfprintf>:
+  801be3:	55                   	push   %ebp
+  801be4:	89 e5                	mov    %esp,%ebp
+  801be6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  801bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bef:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  801bf5:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801bfc:	00 00 00 
+  801bff:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801c06:	00 00 00 
+  801c09:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801c10:	00 00 00 
+  801c13:	ff 75 10             	push   0x10(%ebp)
+  801c16:	ff 75 0c             	push   0xc(%ebp)
+  801c19:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801c1f:	50                   	push   %eax
+  801c20:	68 ad 1b 80 00       	push   $0x801bad
+  801c25:	e8 23 10 00 00       	call   802c4d <vprintfmt>
+  801c2a:	83 c4 10             	add    $0x10,%esp
+  801c2d:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801c34:	7f 12                	jg     801c48 <vfprintf+0x65>
+  801c36:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	75 06                	jne    801c46 <vfprintf+0x63>
+  801c40:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801c46:	c9                   	leave
+  801c47:	c3                   	ret
+  801c48:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801c4e:	e8 1b ff ff ff       	call   801b6e <writebuf>
+  801c53:	eb e1                	jmp    801c36 <vfprintf+0x53>
+
+00801c55 <fprintf>:
+  801c55:	55                   	push   %ebp
+  801c56:	89 e5                	mov    %esp,%ebp
+  801c58:	83 ec 0c             	sub    $0xc,%esp
+  801c5b:	8d 45 10             	lea    0x10(%ebp),%eax
+  801c5e:	50                   	push   %eax
+  801c5f:	ff 75 0c             	push   0xc(%ebp)
+  801c62:	ff 75 08             	push   0x8(%ebp)
+  801c65:	e8 79 ff ff ff       	call   801be3 <vfprintf>
+  801c6a:	c9                   	leave
+  801c6b:	c3                   	ret
+
+00801c6c <printf>:
+  801c6c:	55                   	push   %ebp
+  801c6d:	89 e5                	mov    %esp,%ebp
+  801c6f:	83 ec 0c             	sub    $0xc,%esp
+  801c72:	8d 45 0c             	lea    0xc(%ebp),%eax
+  801c75:	50                   	push   %eax
+  801c76:	ff 75 08             	push   0x8(%ebp)
+  801c79:	6a 01                	push   $0x1
+  801c7b:	e8 63 ff ff ff       	call   801be3 <vfprintf>
+  801c80:	c9                   	leave
+  801c81:	c3                   	ret
+
+00801c82 <devsock_stat>:
+  801c82:	55                   	push   %ebp
+  801c83:	89 e5                	mov    %esp,%ebp
+  801c85:	83 ec 10             	sub    $0x10,%esp
+  801c88:	68 a0 37 80 00       	push   $0x8037a0
+  801c8d:	ff 75 0c             	push   0xc(%ebp)
+  801c90:	e8 02 e6 ff ff       	call   800297 <strcpy>
+  801c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9a:	c9                   	leave
+  801c9b:	c3                   	ret
+
+00801c9c <devsock_close>:
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	53                   	push   %ebx
+  801ca0:	83 ec 10             	sub    $0x10,%esp
+  801ca3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ca6:	53                   	push   %ebx
+  801ca7:	e8 ba 17 00 00       	call   803466 <pageref>
+  801cac:	89 c2                	mov    %eax,%edx
+  801cae:	83 c4 10             	add    $0x10,%esp
+  801cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb6:	83 fa 01             	cmp    $0x1,%edx
+  801cb9:	74 05                	je     801cc0 <devsock_close+0x24>
+  801cbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbe:	c9                   	leave
+  801cbf:	c3                   	ret
+  801cc0:	83 ec 0c             	sub    $0xc,%esp
+  801cc3:	ff 73 0c             	push   0xc(%ebx)
+  801cc6:	e8 aa 02 00 00       	call   801f75 <nsipc_close>
+  801ccb:	83 c4 10             	add    $0x10,%esp
+  801cce:	eb eb                	jmp    801cbb <devsock_close+0x1f>
+
+00801cd0 <devsock_write>:
+  801cd0:	55                   	push   %ebp
+  801cd1:	89 e5                	mov    %esp,%ebp
+  801cd3:	83 ec 08             	sub    $0x8,%esp
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	ff 75 10             	push   0x10(%ebp)
+  801cdb:	ff 75 0c             	push   0xc(%ebp)
+  801cde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce1:	ff 70 0c             	push   0xc(%eax)
+  801ce4:	e8 6c 03 00 00       	call   802055 <nsipc_send>
+  801ce9:	c9                   	leave
+  801cea:	c3                   	ret
+
+00801ceb <devsock_read>:
+  801ceb:	55                   	push   %ebp
+  801cec:	89 e5                	mov    %esp,%ebp
+  801cee:	83 ec 08             	sub    $0x8,%esp
+  801cf1:	6a 00                	push   $0x0
+  801cf3:	ff 75 10             	push   0x10(%ebp)
+  801cf6:	ff 75 0c             	push   0xc(%ebp)
+  801cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cfc:	ff 70 0c             	push   0xc(%eax)
+  801cff:	e8 e2 02 00 00       	call   801fe6 <nsipc_recv>
+  801d04:	c9                   	leave
+  801d05:	c3                   	ret
+
+00801d06 <fd2sockid>:
+  801d06:	55                   	push   %ebp
+  801d07:	89 e5                	mov    %esp,%ebp
+  801d09:	83 ec 20             	sub    $0x20,%esp
+  801d0c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d0f:	52                   	push   %edx
+  801d10:	50                   	push   %eax
+  801d11:	e8 c6 f2 ff ff       	call   800fdc <fd_lookup>
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	78 10                	js     801d2d <fd2sockid+0x27>
+  801d1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d20:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801d26:	39 08                	cmp    %ecx,(%eax)
+  801d28:	75 05                	jne    801d2f <fd2sockid+0x29>
+  801d2a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d2d:	c9                   	leave
+  801d2e:	c3                   	ret
+  801d2f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d34:	eb f7                	jmp    801d2d <fd2sockid+0x27>
+
+00801d36 <alloc_sockfd>:
+  801d36:	55                   	push   %ebp
+  801d37:	89 e5                	mov    %esp,%ebp
+  801d39:	56                   	push   %esi
+  801d3a:	53                   	push   %ebx
+  801d3b:	83 ec 1c             	sub    $0x1c,%esp
+  801d3e:	89 c6                	mov    %eax,%esi
+  801d40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d43:	50                   	push   %eax
+  801d44:	e8 43 f2 ff ff       	call   800f8c <fd_alloc>
+  801d49:	89 c3                	mov    %eax,%ebx
+  801d4b:	83 c4 10             	add    $0x10,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 43                	js     801d95 <alloc_sockfd+0x5f>
+  801d52:	83 ec 04             	sub    $0x4,%esp
+  801d55:	68 07 04 00 00       	push   $0x407
+  801d5a:	ff 75 f4             	push   -0xc(%ebp)
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	e8 93 e9 ff ff       	call   8006f7 <sys_page_alloc>
+  801d64:	89 c3                	mov    %eax,%ebx
+  801d66:	83 c4 10             	add    $0x10,%esp
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 28                	js     801d95 <alloc_sockfd+0x5f>
+  801d6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d70:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d76:	89 10                	mov    %edx,(%eax)
+  801d78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  801d82:	89 70 0c             	mov    %esi,0xc(%eax)
+  801d85:	83 ec 0c             	sub    $0xc,%esp
+  801d88:	50                   	push   %eax
+  801d89:	e8 d7 f1 ff ff       	call   800f65 <fd2num>
+  801d8e:	89 c3                	mov    %eax,%ebx
+  801d90:	83 c4 10             	add    $0x10,%esp
+  801d93:	eb 0c                	jmp    801da1 <alloc_sockfd+0x6b>
+  801d95:	83 ec 0c             	sub    $0xc,%esp
+  801d98:	56                   	push   %esi
+  801d99:	e8 d7 01 00 00       	call   801f75 <nsipc_close>
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	89 d8                	mov    %ebx,%eax
+  801da3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da6:	5b                   	pop    %ebx
+  801da7:	5e                   	pop    %esi
+  801da8:	5d                   	pop    %ebp
+  801da9:	c3                   	ret
+
+00801daa <accept>:
+  801daa:	55                   	push   %ebp
+  801dab:	89 e5                	mov    %esp,%ebp
+  801dad:	83 ec 08             	sub    $0x8,%esp
+  801db0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db3:	e8 4e ff ff ff       	call   801d06 <fd2sockid>
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 1b                	js     801dd7 <accept+0x2d>
+  801dbc:	83 ec 04             	sub    $0x4,%esp
+  801dbf:	ff 75 10             	push   0x10(%ebp)
+  801dc2:	ff 75 0c             	push   0xc(%ebp)
+  801dc5:	50                   	push   %eax
+  801dc6:	e8 07 01 00 00       	call   801ed2 <nsipc_accept>
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	78 05                	js     801dd7 <accept+0x2d>
+  801dd2:	e8 5f ff ff ff       	call   801d36 <alloc_sockfd>
+  801dd7:	c9                   	leave
+  801dd8:	c3                   	ret
+
+00801dd9 <bind>:
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	83 ec 08             	sub    $0x8,%esp
+  801ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de2:	e8 1f ff ff ff       	call   801d06 <fd2sockid>
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 12                	js     801dfd <bind+0x24>
+  801deb:	83 ec 04             	sub    $0x4,%esp
+  801dee:	ff 75 10             	push   0x10(%ebp)
+  801df1:	ff 75 0c             	push   0xc(%ebp)
+  801df4:	50                   	push   %eax
+  801df5:	e8 24 01 00 00       	call   801f1e <nsipc_bind>
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	c9                   	leave
+  801dfe:	c3                   	ret
+
+00801dff <shutdown>:
+  801dff:	55                   	push   %ebp
+  801e00:	89 e5                	mov    %esp,%ebp
+  801e02:	83 ec 08             	sub    $0x8,%esp
+  801e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e08:	e8 f9 fe ff ff       	call   801d06 <fd2sockid>
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	78 0f                	js     801e20 <shutdown+0x21>
+  801e11:	83 ec 08             	sub    $0x8,%esp
+  801e14:	ff 75 0c             	push   0xc(%ebp)
+  801e17:	50                   	push   %eax
+  801e18:	e8 36 01 00 00       	call   801f53 <nsipc_shutdown>
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	c9                   	leave
+  801e21:	c3                   	ret
+
+00801e22 <connect>:
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	83 ec 08             	sub    $0x8,%esp
+  801e28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2b:	e8 d6 fe ff ff       	call   801d06 <fd2sockid>
+  801e30:	85 c0                	test   %eax,%eax
+  801e32:	78 12                	js     801e46 <connect+0x24>
+  801e34:	83 ec 04             	sub    $0x4,%esp
+  801e37:	ff 75 10             	push   0x10(%ebp)
+  801e3a:	ff 75 0c             	push   0xc(%ebp)
+  801e3d:	50                   	push   %eax
+  801e3e:	e8 4c 01 00 00       	call   801f8f <nsipc_connect>
+  801e43:	83 c4 10             	add    $0x10,%esp
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+
+00801e48 <listen>:
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	83 ec 08             	sub    $0x8,%esp
+  801e4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e51:	e8 b0 fe ff ff       	call   801d06 <fd2sockid>
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	78 0f                	js     801e69 <listen+0x21>
+  801e5a:	83 ec 08             	sub    $0x8,%esp
+  801e5d:	ff 75 0c             	push   0xc(%ebp)
+  801e60:	50                   	push   %eax
+  801e61:	e8 5e 01 00 00       	call   801fc4 <nsipc_listen>
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	c9                   	leave
+  801e6a:	c3                   	ret
+
+00801e6b <socket>:
+  801e6b:	55                   	push   %ebp
+  801e6c:	89 e5                	mov    %esp,%ebp
+  801e6e:	83 ec 0c             	sub    $0xc,%esp
+  801e71:	ff 75 10             	push   0x10(%ebp)
+  801e74:	ff 75 0c             	push   0xc(%ebp)
+  801e77:	ff 75 08             	push   0x8(%ebp)
+  801e7a:	e8 34 02 00 00       	call   8020b3 <nsipc_socket>
+  801e7f:	83 c4 10             	add    $0x10,%esp
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	78 05                	js     801e8b <socket+0x20>
+  801e86:	e8 ab fe ff ff       	call   801d36 <alloc_sockfd>
+  801e8b:	c9                   	leave
+  801e8c:	c3                   	ret
+
+00801e8d <nsipc>:
+  801e8d:	55                   	push   %ebp
+  801e8e:	89 e5                	mov    %esp,%ebp
+  801e90:	53                   	push   %ebx
+  801e91:	83 ec 04             	sub    $0x4,%esp
+  801e94:	89 c3                	mov    %eax,%ebx
+  801e96:	83 3d 0c 54 80 00 00 	cmpl   $0x0,0x80540c
+  801e9d:	74 1f                	je     801ebe <nsipc+0x31>
+  801e9f:	83 ec 08             	sub    $0x8,%esp
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	6a 00                	push   $0x0
+  801ea6:	6a 07                	push   $0x7
+  801ea8:	68 00 70 80 00       	push   $0x807000
+  801ead:	53                   	push   %ebx
+  801eae:	ff 35 0c 54 80 00    	push   0x80540c
+  801eb4:	e8 f8 13 00 00       	call   8032b1 <ipc_call>
+  801eb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebc:	c9                   	leave
+  801ebd:	c3                   	ret
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+  801ec1:	6a 03                	push   $0x3
+  801ec3:	e8 84 15 00 00       	call   80344c <ipc_find_env>
+  801ec8:	a3 0c 54 80 00       	mov    %eax,0x80540c
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	eb cd                	jmp    801e9f <nsipc+0x12>
+
+00801ed2 <nsipc_accept>:
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	53                   	push   %ebx
+  801ed6:	83 ec 04             	sub    $0x4,%esp
+  801ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801edc:	a3 00 70 80 00       	mov    %eax,0x807000
+  801ee1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ee6:	e8 a2 ff ff ff       	call   801e8d <nsipc>
+  801eeb:	89 c3                	mov    %eax,%ebx
+  801eed:	85 c0                	test   %eax,%eax
+  801eef:	79 07                	jns    801ef8 <nsipc_accept+0x26>
+  801ef1:	89 d8                	mov    %ebx,%eax
+  801ef3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef6:	c9                   	leave
+  801ef7:	c3                   	ret
+  801ef8:	83 ec 04             	sub    $0x4,%esp
+  801efb:	ff 35 10 70 80 00    	push   0x807010
+  801f01:	68 00 70 80 00       	push   $0x807000
+  801f06:	ff 75 0c             	push   0xc(%ebp)
+  801f09:	e8 39 e5 ff ff       	call   800447 <memmove>
+  801f0e:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801f14:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f17:	89 10                	mov    %edx,(%eax)
+  801f19:	83 c4 10             	add    $0x10,%esp
+  801f1c:	eb d3                	jmp    801ef1 <nsipc_accept+0x1f>
+
+00801f1e <nsipc_bind>:
+  801f1e:	55                   	push   %ebp
+  801f1f:	89 e5                	mov    %esp,%ebp
+  801f21:	53                   	push   %ebx
+  801f22:	83 ec 08             	sub    $0x8,%esp
+  801f25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2b:	a3 00 70 80 00       	mov    %eax,0x807000
+  801f30:	53                   	push   %ebx
+  801f31:	ff 75 0c             	push   0xc(%ebp)
+  801f34:	68 04 70 80 00       	push   $0x807004
+  801f39:	e8 09 e5 ff ff       	call   800447 <memmove>
+  801f3e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801f44:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f49:	e8 3f ff ff ff       	call   801e8d <nsipc>
+  801f4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+
+00801f53 <nsipc_shutdown>:
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	83 ec 08             	sub    $0x8,%esp
+  801f59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801f61:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f64:	a3 04 70 80 00       	mov    %eax,0x807004
+  801f69:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f6e:	e8 1a ff ff ff       	call   801e8d <nsipc>
+  801f73:	c9                   	leave
+  801f74:	c3                   	ret
+
+00801f75 <nsipc_close>:
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	83 ec 08             	sub    $0x8,%esp
+  801f7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7e:	a3 00 70 80 00       	mov    %eax,0x807000
+  801f83:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f88:	e8 00 ff ff ff       	call   801e8d <nsipc>
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <nsipc_connect>:
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	53                   	push   %ebx
+  801f93:	83 ec 08             	sub    $0x8,%esp
+  801f96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f99:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9c:	a3 00 70 80 00       	mov    %eax,0x807000
+  801fa1:	53                   	push   %ebx
+  801fa2:	ff 75 0c             	push   0xc(%ebp)
+  801fa5:	68 04 70 80 00       	push   $0x807004
+  801faa:	e8 98 e4 ff ff       	call   800447 <memmove>
+  801faf:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  801fb5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fba:	e8 ce fe ff ff       	call   801e8d <nsipc>
+  801fbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fc2:	c9                   	leave
+  801fc3:	c3                   	ret
+
+00801fc4 <nsipc_listen>:
+  801fc4:	55                   	push   %ebp
+  801fc5:	89 e5                	mov    %esp,%ebp
+  801fc7:	83 ec 08             	sub    $0x8,%esp
+  801fca:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fcd:	a3 00 70 80 00       	mov    %eax,0x807000
+  801fd2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd5:	a3 04 70 80 00       	mov    %eax,0x807004
+  801fda:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fdf:	e8 a9 fe ff ff       	call   801e8d <nsipc>
+  801fe4:	c9                   	leave
+  801fe5:	c3                   	ret
+
+00801fe6 <nsipc_recv>:
+  801fe6:	55                   	push   %ebp
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	56                   	push   %esi
+  801fea:	53                   	push   %ebx
+  801feb:	8b 75 10             	mov    0x10(%ebp),%esi
+  801fee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff1:	a3 00 70 80 00       	mov    %eax,0x807000
+  801ff6:	89 35 04 70 80 00    	mov    %esi,0x807004
+  801ffc:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fff:	a3 08 70 80 00       	mov    %eax,0x807008
+  802004:	b8 07 00 00 00       	mov    $0x7,%eax
+  802009:	e8 7f fe ff ff       	call   801e8d <nsipc>
+  80200e:	89 c3                	mov    %eax,%ebx
+  802010:	85 c0                	test   %eax,%eax
+  802012:	78 22                	js     802036 <nsipc_recv+0x50>
+  802014:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802019:	39 c6                	cmp    %eax,%esi
+  80201b:	0f 4e c6             	cmovle %esi,%eax
+  80201e:	39 c3                	cmp    %eax,%ebx
+  802020:	7f 1d                	jg     80203f <nsipc_recv+0x59>
+  802022:	83 ec 04             	sub    $0x4,%esp
+  802025:	53                   	push   %ebx
+  802026:	68 00 70 80 00       	push   $0x807000
+  80202b:	ff 75 0c             	push   0xc(%ebp)
+  80202e:	e8 14 e4 ff ff       	call   800447 <memmove>
+  802033:	83 c4 10             	add    $0x10,%esp
+  802036:	89 d8                	mov    %ebx,%eax
+  802038:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203b:	5b                   	pop    %ebx
+  80203c:	5e                   	pop    %esi
+  80203d:	5d                   	pop    %ebp
+  80203e:	c3                   	ret
+  80203f:	68 ac 37 80 00       	push   $0x8037ac
+  802044:	68 c1 37 80 00       	push   $0x8037c1
+  802049:	6a 60                	push   $0x60
+  80204b:	68 d6 37 80 00       	push   $0x8037d6
+  802050:	e8 1e 0a 00 00       	call   802a73 <_panic>
+
+00802055 <nsipc_send>:
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	53                   	push   %ebx
+  802059:	83 ec 04             	sub    $0x4,%esp
+  80205c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80205f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802062:	a3 00 70 80 00       	mov    %eax,0x807000
+  802067:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80206d:	7f 2e                	jg     80209d <nsipc_send+0x48>
+  80206f:	83 ec 04             	sub    $0x4,%esp
+  802072:	53                   	push   %ebx
+  802073:	ff 75 0c             	push   0xc(%ebp)
+  802076:	68 0c 70 80 00       	push   $0x80700c
+  80207b:	e8 c7 e3 ff ff       	call   800447 <memmove>
+  802080:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802086:	8b 45 14             	mov    0x14(%ebp),%eax
+  802089:	a3 08 70 80 00       	mov    %eax,0x807008
+  80208e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802093:	e8 f5 fd ff ff       	call   801e8d <nsipc>
+  802098:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80209b:	c9                   	leave
+  80209c:	c3                   	ret
+  80209d:	68 e2 37 80 00       	push   $0x8037e2
+  8020a2:	68 c1 37 80 00       	push   $0x8037c1
+  8020a7:	6a 6b                	push   $0x6b
+  8020a9:	68 d6 37 80 00       	push   $0x8037d6
+  8020ae:	e8 c0 09 00 00       	call   802a73 <_panic>
+
+008020b3 <nsipc_socket>:
+  8020b3:	55                   	push   %ebp
+  8020b4:	89 e5                	mov    %esp,%ebp
+  8020b6:	83 ec 08             	sub    $0x8,%esp
+  8020b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bc:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020c4:	a3 04 70 80 00       	mov    %eax,0x807004
+  8020c9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020cc:	a3 08 70 80 00       	mov    %eax,0x807008
+  8020d1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020d6:	e8 b2 fd ff ff       	call   801e8d <nsipc>
+  8020db:	c9                   	leave
+  8020dc:	c3                   	ret
+
+008020dd <free>:
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	53                   	push   %ebx
+  8020e1:	83 ec 04             	sub    $0x4,%esp
+  8020e4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020e7:	85 db                	test   %ebx,%ebx
+  8020e9:	0f 84 85 00 00 00    	je     802174 <free+0x97>
+  8020ef:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8020f5:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8020fa:	77 51                	ja     80214d <free+0x70>
+  8020fc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802102:	89 d8                	mov    %ebx,%eax
+  802104:	c1 e8 0c             	shr    $0xc,%eax
+  802107:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80210e:	f6 c4 04             	test   $0x4,%ah
+  802111:	74 50                	je     802163 <free+0x86>
+  802113:	83 ec 08             	sub    $0x8,%esp
+  802116:	53                   	push   %ebx
+  802117:	6a 00                	push   $0x0
+  802119:	e8 ab e6 ff ff       	call   8007c9 <sys_page_unmap>
+  80211e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802124:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80212a:	83 c4 10             	add    $0x10,%esp
+  80212d:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802132:	76 ce                	jbe    802102 <free+0x25>
+  802134:	68 2b 38 80 00       	push   $0x80382b
+  802139:	68 c1 37 80 00       	push   $0x8037c1
+  80213e:	68 81 00 00 00       	push   $0x81
+  802143:	68 1e 38 80 00       	push   $0x80381e
+  802148:	e8 26 09 00 00       	call   802a73 <_panic>
+  80214d:	68 f0 37 80 00       	push   $0x8037f0
+  802152:	68 c1 37 80 00       	push   $0x8037c1
+  802157:	6a 7a                	push   $0x7a
+  802159:	68 1e 38 80 00       	push   $0x80381e
+  80215e:	e8 10 09 00 00       	call   802a73 <_panic>
+  802163:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802169:	83 e8 01             	sub    $0x1,%eax
+  80216c:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802172:	74 05                	je     802179 <free+0x9c>
+  802174:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+  802179:	83 ec 08             	sub    $0x8,%esp
+  80217c:	53                   	push   %ebx
+  80217d:	6a 00                	push   $0x0
+  80217f:	e8 45 e6 ff ff       	call   8007c9 <sys_page_unmap>
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	eb eb                	jmp    802174 <free+0x97>
+
+00802189 <malloc>:
+  802189:	55                   	push   %ebp
+  80218a:	89 e5                	mov    %esp,%ebp
+  80218c:	57                   	push   %edi
+  80218d:	56                   	push   %esi
+  80218e:	53                   	push   %ebx
+  80218f:	83 ec 1c             	sub    $0x1c,%esp
+  802192:	a1 10 54 80 00       	mov    0x805410,%eax
+  802197:	85 c0                	test   %eax,%eax
+  802199:	74 6c                	je     802207 <malloc+0x7e>
+  80219b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80219e:	8d 57 03             	lea    0x3(%edi),%edx
+  8021a1:	89 d6                	mov    %edx,%esi
+  8021a3:	83 e6 fc             	and    $0xfffffffc,%esi
+  8021a6:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8021ac:	0f 87 69 01 00 00    	ja     80231b <malloc+0x192>
+  8021b2:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  8021b7:	74 30                	je     8021e9 <malloc+0x60>
+  8021b9:	89 c3                	mov    %eax,%ebx
+  8021bb:	c1 eb 0c             	shr    $0xc,%ebx
+  8021be:	8d 54 30 03          	lea    0x3(%eax,%esi,1),%edx
+  8021c2:	c1 ea 0c             	shr    $0xc,%edx
+  8021c5:	39 d3                	cmp    %edx,%ebx
+  8021c7:	74 60                	je     802229 <malloc+0xa0>
+  8021c9:	83 ec 0c             	sub    $0xc,%esp
+  8021cc:	50                   	push   %eax
+  8021cd:	e8 0b ff ff ff       	call   8020dd <free>
+  8021d2:	a1 10 54 80 00       	mov    0x805410,%eax
+  8021d7:	05 00 10 00 00       	add    $0x1000,%eax
+  8021dc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021e1:	a3 10 54 80 00       	mov    %eax,0x805410
+  8021e6:	83 c4 10             	add    $0x10,%esp
+  8021e9:	8b 0d 10 54 80 00    	mov    0x805410,%ecx
+  8021ef:	ba 02 00 00 00       	mov    $0x2,%edx
+  8021f4:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8021f8:	8d 7e 04             	lea    0x4(%esi),%edi
+  8021fb:	89 cb                	mov    %ecx,%ebx
+  8021fd:	01 f9                	add    %edi,%ecx
+  8021ff:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802202:	e9 8e 00 00 00       	jmp    802295 <malloc+0x10c>
+  802207:	c7 05 10 54 80 00 00 	movl   $0x8000000,0x805410
+  80220e:	00 00 08 
+  802211:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802214:	8d 57 03             	lea    0x3(%edi),%edx
+  802217:	89 d6                	mov    %edx,%esi
+  802219:	83 e6 fc             	and    $0xfffffffc,%esi
+  80221c:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802222:	76 c5                	jbe    8021e9 <malloc+0x60>
+  802224:	e9 ea 00 00 00       	jmp    802313 <malloc+0x18a>
+  802229:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  80222f:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802235:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+  802239:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80223c:	89 15 10 54 80 00    	mov    %edx,0x805410
+  802242:	e9 cc 00 00 00       	jmp    802313 <malloc+0x18a>
+  802247:	05 00 10 00 00       	add    $0x1000,%eax
+  80224c:	39 c8                	cmp    %ecx,%eax
+  80224e:	0f 83 d5 00 00 00    	jae    802329 <malloc+0x1a0>
+  802254:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802259:	77 22                	ja     80227d <malloc+0xf4>
+  80225b:	89 c2                	mov    %eax,%edx
+  80225d:	c1 ea 16             	shr    $0x16,%edx
+  802260:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802267:	f6 c2 01             	test   $0x1,%dl
+  80226a:	74 db                	je     802247 <malloc+0xbe>
+  80226c:	89 c2                	mov    %eax,%edx
+  80226e:	c1 ea 0c             	shr    $0xc,%edx
+  802271:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802278:	f6 c2 01             	test   $0x1,%dl
+  80227b:	74 ca                	je     802247 <malloc+0xbe>
+  80227d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802283:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802289:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  80228d:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802293:	74 14                	je     8022a9 <malloc+0x120>
+  802295:	39 cb                	cmp    %ecx,%ebx
+  802297:	0f 83 8c 00 00 00    	jae    802329 <malloc+0x1a0>
+  80229d:	81 fb ff ff ff 0f    	cmp    $0xfffffff,%ebx
+  8022a3:	77 d8                	ja     80227d <malloc+0xf4>
+  8022a5:	89 d8                	mov    %ebx,%eax
+  8022a7:	eb b2                	jmp    80225b <malloc+0xd2>
+  8022a9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8022ac:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  8022b1:	83 ea 01             	sub    $0x1,%edx
+  8022b4:	0f 85 41 ff ff ff    	jne    8021fb <malloc+0x72>
+  8022ba:	c7 05 10 54 80 00 00 	movl   $0x8000000,0x805410
+  8022c1:	00 00 08 
+  8022c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c9:	eb 48                	jmp    802313 <malloc+0x18a>
+  8022cb:	85 db                	test   %ebx,%ebx
+  8022cd:	78 53                	js     802322 <malloc+0x199>
+  8022cf:	83 ec 08             	sub    $0x8,%esp
+  8022d2:	89 d8                	mov    %ebx,%eax
+  8022d4:	03 05 10 54 80 00    	add    0x805410,%eax
+  8022da:	50                   	push   %eax
+  8022db:	6a 00                	push   $0x0
+  8022dd:	e8 e7 e4 ff ff       	call   8007c9 <sys_page_unmap>
+  8022e2:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8022e8:	83 c4 10             	add    $0x10,%esp
+  8022eb:	81 fb 00 f0 ff ff    	cmp    $0xfffff000,%ebx
+  8022f1:	75 dc                	jne    8022cf <malloc+0x146>
+  8022f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f8:	eb 19                	jmp    802313 <malloc+0x18a>
+  8022fa:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8022fd:	a1 10 54 80 00       	mov    0x805410,%eax
+  802302:	c7 44 18 fc 02 00 00 	movl   $0x2,-0x4(%eax,%ebx,1)
+  802309:	00 
+  80230a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80230d:	89 15 10 54 80 00    	mov    %edx,0x805410
+  802313:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802316:	5b                   	pop    %ebx
+  802317:	5e                   	pop    %esi
+  802318:	5f                   	pop    %edi
+  802319:	5d                   	pop    %ebp
+  80231a:	c3                   	ret
+  80231b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802320:	eb f1                	jmp    802313 <malloc+0x18a>
+  802322:	b8 00 00 00 00       	mov    $0x0,%eax
+  802327:	eb ea                	jmp    802313 <malloc+0x18a>
+  802329:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  80232d:	74 06                	je     802335 <malloc+0x1ac>
+  80232f:	89 1d 10 54 80 00    	mov    %ebx,0x805410
+  802335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80233a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80233d:	39 fb                	cmp    %edi,%ebx
+  80233f:	73 b9                	jae    8022fa <malloc+0x171>
+  802341:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802347:	83 ec 04             	sub    $0x4,%esp
+  80234a:	39 fe                	cmp    %edi,%esi
+  80234c:	0f 92 c0             	setb   %al
+  80234f:	0f b6 c0             	movzbl %al,%eax
+  802352:	c1 e0 0a             	shl    $0xa,%eax
+  802355:	83 c8 07             	or     $0x7,%eax
+  802358:	50                   	push   %eax
+  802359:	89 d8                	mov    %ebx,%eax
+  80235b:	03 05 10 54 80 00    	add    0x805410,%eax
+  802361:	50                   	push   %eax
+  802362:	6a 00                	push   $0x0
+  802364:	e8 8e e3 ff ff       	call   8006f7 <sys_page_alloc>
+  802369:	83 c4 10             	add    $0x10,%esp
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	0f 88 57 ff ff ff    	js     8022cb <malloc+0x142>
+  802374:	89 f3                	mov    %esi,%ebx
+  802376:	eb c5                	jmp    80233d <malloc+0x1b4>
+
+00802378 <devpipe_stat>:
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	56                   	push   %esi
+  80237c:	53                   	push   %ebx
+  80237d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802380:	83 ec 0c             	sub    $0xc,%esp
+  802383:	ff 75 08             	push   0x8(%ebp)
+  802386:	e8 ea eb ff ff       	call   800f75 <fd2data>
+  80238b:	89 c6                	mov    %eax,%esi
+  80238d:	83 c4 08             	add    $0x8,%esp
+  802390:	68 43 38 80 00       	push   $0x803843
+  802395:	53                   	push   %ebx
+  802396:	e8 fc de ff ff       	call   800297 <strcpy>
+  80239b:	8b 46 04             	mov    0x4(%esi),%eax
+  80239e:	2b 06                	sub    (%esi),%eax
+  8023a0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8023a6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023ad:	00 00 00 
+  8023b0:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8023b7:	40 80 00 
+  8023ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c2:	5b                   	pop    %ebx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5d                   	pop    %ebp
+  8023c5:	c3                   	ret
+
+008023c6 <devpipe_close>:
+  8023c6:	55                   	push   %ebp
+  8023c7:	89 e5                	mov    %esp,%ebp
+  8023c9:	53                   	push   %ebx
+  8023ca:	83 ec 0c             	sub    $0xc,%esp
+  8023cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023d0:	53                   	push   %ebx
+  8023d1:	6a 00                	push   $0x0
+  8023d3:	e8 f1 e3 ff ff       	call   8007c9 <sys_page_unmap>
+  8023d8:	89 1c 24             	mov    %ebx,(%esp)
+  8023db:	e8 95 eb ff ff       	call   800f75 <fd2data>
+  8023e0:	83 c4 08             	add    $0x8,%esp
+  8023e3:	50                   	push   %eax
+  8023e4:	6a 00                	push   $0x0
+  8023e6:	e8 de e3 ff ff       	call   8007c9 <sys_page_unmap>
+  8023eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ee:	c9                   	leave
+  8023ef:	c3                   	ret
+
+008023f0 <_pipeisclosed>:
+  8023f0:	55                   	push   %ebp
+  8023f1:	89 e5                	mov    %esp,%ebp
+  8023f3:	57                   	push   %edi
+  8023f4:	56                   	push   %esi
+  8023f5:	53                   	push   %ebx
+  8023f6:	83 ec 1c             	sub    $0x1c,%esp
+  8023f9:	89 c7                	mov    %eax,%edi
+  8023fb:	89 d6                	mov    %edx,%esi
+  8023fd:	a1 14 54 80 00       	mov    0x805414,%eax
+  802402:	8b 58 58             	mov    0x58(%eax),%ebx
+  802405:	83 ec 0c             	sub    $0xc,%esp
+  802408:	57                   	push   %edi
+  802409:	e8 58 10 00 00       	call   803466 <pageref>
+  80240e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802411:	89 34 24             	mov    %esi,(%esp)
+  802414:	e8 4d 10 00 00       	call   803466 <pageref>
+  802419:	8b 15 14 54 80 00    	mov    0x805414,%edx
+  80241f:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	39 cb                	cmp    %ecx,%ebx
+  802427:	74 1b                	je     802444 <_pipeisclosed+0x54>
+  802429:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80242c:	75 cf                	jne    8023fd <_pipeisclosed+0xd>
+  80242e:	8b 42 58             	mov    0x58(%edx),%eax
+  802431:	6a 01                	push   $0x1
+  802433:	50                   	push   %eax
+  802434:	53                   	push   %ebx
+  802435:	68 4a 38 80 00       	push   $0x80384a
+  80243a:	e8 0f 07 00 00       	call   802b4e <cprintf>
+  80243f:	83 c4 10             	add    $0x10,%esp
+  802442:	eb b9                	jmp    8023fd <_pipeisclosed+0xd>
+  802444:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802447:	0f 94 c0             	sete   %al
+  80244a:	0f b6 c0             	movzbl %al,%eax
+  80244d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802450:	5b                   	pop    %ebx
+  802451:	5e                   	pop    %esi
+  802452:	5f                   	pop    %edi
+  802453:	5d                   	pop    %ebp
+  802454:	c3                   	ret
+
+00802455 <devpipe_write>:
+  802455:	55                   	push   %ebp
+  802456:	89 e5                	mov    %esp,%ebp
+  802458:	57                   	push   %edi
+  802459:	56                   	push   %esi
+  80245a:	53                   	push   %ebx
+  80245b:	83 ec 28             	sub    $0x28,%esp
+  80245e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802461:	56                   	push   %esi
+  802462:	e8 0e eb ff ff       	call   800f75 <fd2data>
+  802467:	89 c3                	mov    %eax,%ebx
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802471:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802475:	74 5c                	je     8024d3 <devpipe_write+0x7e>
+  802477:	8b 43 04             	mov    0x4(%ebx),%eax
+  80247a:	8b 0b                	mov    (%ebx),%ecx
+  80247c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80247f:	39 d0                	cmp    %edx,%eax
+  802481:	72 1e                	jb     8024a1 <devpipe_write+0x4c>
+  802483:	89 da                	mov    %ebx,%edx
+  802485:	89 f0                	mov    %esi,%eax
+  802487:	e8 64 ff ff ff       	call   8023f0 <_pipeisclosed>
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	75 48                	jne    8024d8 <devpipe_write+0x83>
+  802490:	e8 17 e2 ff ff       	call   8006ac <sys_yield>
+  802495:	8b 43 04             	mov    0x4(%ebx),%eax
+  802498:	8b 0b                	mov    (%ebx),%ecx
+  80249a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80249d:	39 d0                	cmp    %edx,%eax
+  80249f:	73 e2                	jae    802483 <devpipe_write+0x2e>
+  8024a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024a4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8024a8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8024ab:	89 c2                	mov    %eax,%edx
+  8024ad:	c1 fa 1f             	sar    $0x1f,%edx
+  8024b0:	89 d1                	mov    %edx,%ecx
+  8024b2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8024b5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8024b8:	83 e2 1f             	and    $0x1f,%edx
+  8024bb:	29 ca                	sub    %ecx,%edx
+  8024bd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8024c1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8024c5:	83 c0 01             	add    $0x1,%eax
+  8024c8:	89 43 04             	mov    %eax,0x4(%ebx)
+  8024cb:	83 c7 01             	add    $0x1,%edi
+  8024ce:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8024d1:	75 a4                	jne    802477 <devpipe_write+0x22>
+  8024d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024d6:	eb 05                	jmp    8024dd <devpipe_write+0x88>
+  8024d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e0:	5b                   	pop    %ebx
+  8024e1:	5e                   	pop    %esi
+  8024e2:	5f                   	pop    %edi
+  8024e3:	5d                   	pop    %ebp
+  8024e4:	c3                   	ret
+
+008024e5 <devpipe_read>:
+  8024e5:	55                   	push   %ebp
+  8024e6:	89 e5                	mov    %esp,%ebp
+  8024e8:	57                   	push   %edi
+  8024e9:	56                   	push   %esi
+  8024ea:	53                   	push   %ebx
+  8024eb:	83 ec 18             	sub    $0x18,%esp
+  8024ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024f1:	56                   	push   %esi
+  8024f2:	e8 7e ea ff ff       	call   800f75 <fd2data>
+  8024f7:	89 c3                	mov    %eax,%ebx
+  8024f9:	83 c4 10             	add    $0x10,%esp
+  8024fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802501:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802505:	74 45                	je     80254c <devpipe_read+0x67>
+  802507:	8b 03                	mov    (%ebx),%eax
+  802509:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80250c:	75 1d                	jne    80252b <devpipe_read+0x46>
+  80250e:	85 ff                	test   %edi,%edi
+  802510:	75 3f                	jne    802551 <devpipe_read+0x6c>
+  802512:	89 da                	mov    %ebx,%edx
+  802514:	89 f0                	mov    %esi,%eax
+  802516:	e8 d5 fe ff ff       	call   8023f0 <_pipeisclosed>
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	75 3c                	jne    80255b <devpipe_read+0x76>
+  80251f:	e8 88 e1 ff ff       	call   8006ac <sys_yield>
+  802524:	8b 03                	mov    (%ebx),%eax
+  802526:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802529:	74 e7                	je     802512 <devpipe_read+0x2d>
+  80252b:	99                   	cltd
+  80252c:	c1 ea 1b             	shr    $0x1b,%edx
+  80252f:	01 d0                	add    %edx,%eax
+  802531:	83 e0 1f             	and    $0x1f,%eax
+  802534:	29 d0                	sub    %edx,%eax
+  802536:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80253b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80253e:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802541:	83 03 01             	addl   $0x1,(%ebx)
+  802544:	83 c7 01             	add    $0x1,%edi
+  802547:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80254a:	75 bb                	jne    802507 <devpipe_read+0x22>
+  80254c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80254f:	eb 02                	jmp    802553 <devpipe_read+0x6e>
+  802551:	89 f8                	mov    %edi,%eax
+  802553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802556:	5b                   	pop    %ebx
+  802557:	5e                   	pop    %esi
+  802558:	5f                   	pop    %edi
+  802559:	5d                   	pop    %ebp
+  80255a:	c3                   	ret
+  80255b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802560:	eb f1                	jmp    802553 <devpipe_read+0x6e>
+
+00802562 <pipe>:
+  802562:	55                   	push   %ebp
+  802563:	89 e5                	mov    %esp,%ebp
+  802565:	56                   	push   %esi
+  802566:	53                   	push   %ebx
+  802567:	83 ec 1c             	sub    $0x1c,%esp
+  80256a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80256d:	50                   	push   %eax
+  80256e:	e8 19 ea ff ff       	call   800f8c <fd_alloc>
+  802573:	89 c3                	mov    %eax,%ebx
+  802575:	83 c4 10             	add    $0x10,%esp
+  802578:	85 c0                	test   %eax,%eax
+  80257a:	0f 88 23 01 00 00    	js     8026a3 <pipe+0x141>
+  802580:	83 ec 04             	sub    $0x4,%esp
+  802583:	68 07 04 00 00       	push   $0x407
+  802588:	ff 75 f4             	push   -0xc(%ebp)
+  80258b:	6a 00                	push   $0x0
+  80258d:	e8 65 e1 ff ff       	call   8006f7 <sys_page_alloc>
+  802592:	89 c3                	mov    %eax,%ebx
+  802594:	83 c4 10             	add    $0x10,%esp
+  802597:	85 c0                	test   %eax,%eax
+  802599:	0f 88 04 01 00 00    	js     8026a3 <pipe+0x141>
+  80259f:	83 ec 0c             	sub    $0xc,%esp
+  8025a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025a5:	50                   	push   %eax
+  8025a6:	e8 e1 e9 ff ff       	call   800f8c <fd_alloc>
+  8025ab:	89 c3                	mov    %eax,%ebx
+  8025ad:	83 c4 10             	add    $0x10,%esp
+  8025b0:	85 c0                	test   %eax,%eax
+  8025b2:	0f 88 db 00 00 00    	js     802693 <pipe+0x131>
+  8025b8:	83 ec 04             	sub    $0x4,%esp
+  8025bb:	68 07 04 00 00       	push   $0x407
+  8025c0:	ff 75 f0             	push   -0x10(%ebp)
+  8025c3:	6a 00                	push   $0x0
+  8025c5:	e8 2d e1 ff ff       	call   8006f7 <sys_page_alloc>
+  8025ca:	89 c3                	mov    %eax,%ebx
+  8025cc:	83 c4 10             	add    $0x10,%esp
+  8025cf:	85 c0                	test   %eax,%eax
+  8025d1:	0f 88 bc 00 00 00    	js     802693 <pipe+0x131>
+  8025d7:	83 ec 0c             	sub    $0xc,%esp
+  8025da:	ff 75 f4             	push   -0xc(%ebp)
+  8025dd:	e8 93 e9 ff ff       	call   800f75 <fd2data>
+  8025e2:	89 c6                	mov    %eax,%esi
+  8025e4:	83 c4 0c             	add    $0xc,%esp
+  8025e7:	68 07 04 00 00       	push   $0x407
+  8025ec:	50                   	push   %eax
+  8025ed:	6a 00                	push   $0x0
+  8025ef:	e8 03 e1 ff ff       	call   8006f7 <sys_page_alloc>
+  8025f4:	89 c3                	mov    %eax,%ebx
+  8025f6:	83 c4 10             	add    $0x10,%esp
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	0f 88 82 00 00 00    	js     802683 <pipe+0x121>
+  802601:	83 ec 0c             	sub    $0xc,%esp
+  802604:	ff 75 f0             	push   -0x10(%ebp)
+  802607:	e8 69 e9 ff ff       	call   800f75 <fd2data>
+  80260c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802613:	50                   	push   %eax
+  802614:	6a 00                	push   $0x0
+  802616:	56                   	push   %esi
+  802617:	6a 00                	push   $0x0
+  802619:	e8 1c e1 ff ff       	call   80073a <sys_page_map>
+  80261e:	89 c3                	mov    %eax,%ebx
+  802620:	83 c4 20             	add    $0x20,%esp
+  802623:	85 c0                	test   %eax,%eax
+  802625:	78 4e                	js     802675 <pipe+0x113>
+  802627:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80262c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80262f:	89 02                	mov    %eax,(%edx)
+  802631:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802634:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  80263b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80263e:	89 02                	mov    %eax,(%edx)
+  802640:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802643:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  80264a:	83 ec 0c             	sub    $0xc,%esp
+  80264d:	ff 75 f4             	push   -0xc(%ebp)
+  802650:	e8 10 e9 ff ff       	call   800f65 <fd2num>
+  802655:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802658:	89 01                	mov    %eax,(%ecx)
+  80265a:	83 c4 04             	add    $0x4,%esp
+  80265d:	ff 75 f0             	push   -0x10(%ebp)
+  802660:	e8 00 e9 ff ff       	call   800f65 <fd2num>
+  802665:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802668:	89 41 04             	mov    %eax,0x4(%ecx)
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802673:	eb 2e                	jmp    8026a3 <pipe+0x141>
+  802675:	83 ec 08             	sub    $0x8,%esp
+  802678:	56                   	push   %esi
+  802679:	6a 00                	push   $0x0
+  80267b:	e8 49 e1 ff ff       	call   8007c9 <sys_page_unmap>
+  802680:	83 c4 10             	add    $0x10,%esp
+  802683:	83 ec 08             	sub    $0x8,%esp
+  802686:	ff 75 f0             	push   -0x10(%ebp)
+  802689:	6a 00                	push   $0x0
+  80268b:	e8 39 e1 ff ff       	call   8007c9 <sys_page_unmap>
+  802690:	83 c4 10             	add    $0x10,%esp
+  802693:	83 ec 08             	sub    $0x8,%esp
+  802696:	ff 75 f4             	push   -0xc(%ebp)
+  802699:	6a 00                	push   $0x0
+  80269b:	e8 29 e1 ff ff       	call   8007c9 <sys_page_unmap>
+  8026a0:	83 c4 10             	add    $0x10,%esp
+  8026a3:	89 d8                	mov    %ebx,%eax
+  8026a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a8:	5b                   	pop    %ebx
+  8026a9:	5e                   	pop    %esi
+  8026aa:	5d                   	pop    %ebp
+  8026ab:	c3                   	ret
+
+008026ac <pipeisclosed>:
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	83 ec 20             	sub    $0x20,%esp
+  8026b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b5:	50                   	push   %eax
+  8026b6:	ff 75 08             	push   0x8(%ebp)
+  8026b9:	e8 1e e9 ff ff       	call   800fdc <fd_lookup>
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	78 18                	js     8026dd <pipeisclosed+0x31>
+  8026c5:	83 ec 0c             	sub    $0xc,%esp
+  8026c8:	ff 75 f4             	push   -0xc(%ebp)
+  8026cb:	e8 a5 e8 ff ff       	call   800f75 <fd2data>
+  8026d0:	89 c2                	mov    %eax,%edx
+  8026d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d5:	e8 16 fd ff ff       	call   8023f0 <_pipeisclosed>
+  8026da:	83 c4 10             	add    $0x10,%esp
+  8026dd:	c9                   	leave
+  8026de:	c3                   	ret
+
+008026df <ipcring_init>:
+  8026df:	55                   	push   %ebp
+  8026e0:	89 e5                	mov    %esp,%ebp
+  8026e2:	53                   	push   %ebx
+  8026e3:	83 ec 08             	sub    $0x8,%esp
+  8026e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026e9:	6a 60                	push   $0x60
+  8026eb:	6a 00                	push   $0x0
+  8026ed:	53                   	push   %ebx
+  8026ee:	e8 1f dd ff ff       	call   800412 <memset>
+  8026f3:	a1 14 54 80 00       	mov    0x805414,%eax
+  8026f8:	8b 40 48             	mov    0x48(%eax),%eax
+  8026fb:	89 03                	mov    %eax,(%ebx)
+  8026fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802700:	89 43 04             	mov    %eax,0x4(%ebx)
+  802703:	8b 45 10             	mov    0x10(%ebp),%eax
+  802706:	89 43 08             	mov    %eax,0x8(%ebx)
+  802709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80270c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80270f:	83 c4 10             	add    $0x10,%esp
+  802712:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802715:	c9                   	leave
+  802716:	c3                   	ret
+
+00802717 <ipcring_req_slot>:
+  802717:	55                   	push   %ebp
+  802718:	89 e5                	mov    %esp,%ebp
+  80271a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271d:	8b 50 10             	mov    0x10(%eax),%edx
+  802720:	8b 48 18             	mov    0x18(%eax),%ecx
+  802723:	29 ca                	sub    %ecx,%edx
+  802725:	83 fa 07             	cmp    $0x7,%edx
+  802728:	77 0c                	ja     802736 <ipcring_req_slot+0x1f>
+  80272a:	8b 50 10             	mov    0x10(%eax),%edx
+  80272d:	83 e2 07             	and    $0x7,%edx
+  802730:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802734:	5d                   	pop    %ebp
+  802735:	c3                   	ret
+  802736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273b:	eb f7                	jmp    802734 <ipcring_req_slot+0x1d>
+
+0080273d <ipcring_req_push>:
+  80273d:	55                   	push   %ebp
+  80273e:	89 e5                	mov    %esp,%ebp
+  802740:	83 ec 08             	sub    $0x8,%esp
+  802743:	8b 55 08             	mov    0x8(%ebp),%edx
+  802746:	8b 42 10             	mov    0x10(%edx),%eax
+  802749:	83 c0 01             	add    $0x1,%eax
+  80274c:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802750:	b8 00 00 00 00       	mov    $0x0,%eax
+  802755:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	75 02                	jne    80275f <ipcring_req_push+0x22>
+  80275d:	c9                   	leave
+  80275e:	c3                   	ret
+  80275f:	6a 00                	push   $0x0
+  802761:	68 00 00 80 ee       	push   $0xee800000
+  802766:	ff 72 08             	push   0x8(%edx)
+  802769:	ff 72 04             	push   0x4(%edx)
+  80276c:	e8 be e2 ff ff       	call   800a2f <sys_ipc_send>
+  802771:	83 c4 10             	add    $0x10,%esp
+  802774:	eb e7                	jmp    80275d <ipcring_req_push+0x20>
+
+00802776 <ipcring_rsp_wait>:
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	53                   	push   %ebx
+  80277a:	83 ec 04             	sub    $0x4,%esp
+  80277d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802780:	8b 53 18             	mov    0x18(%ebx),%edx
+  802783:	8b 43 10             	mov    0x10(%ebx),%eax
+  802786:	39 c2                	cmp    %eax,%edx
+  802788:	74 3c                	je     8027c6 <ipcring_rsp_wait+0x50>
+  80278a:	8b 53 14             	mov    0x14(%ebx),%edx
+  80278d:	8b 43 18             	mov    0x18(%ebx),%eax
+  802790:	39 c2                	cmp    %eax,%edx
+  802792:	75 23                	jne    8027b7 <ipcring_rsp_wait+0x41>
+  802794:	83 ec 08             	sub    $0x8,%esp
+  802797:	6a 00                	push   $0x0
+  802799:	6a 00                	push   $0x0
+  80279b:	6a 00                	push   $0x0
+  80279d:	6a 00                	push   $0x0
+  80279f:	ff 73 0c             	push   0xc(%ebx)
+  8027a2:	ff 73 04             	push   0x4(%ebx)
+  8027a5:	e8 07 0b 00 00       	call   8032b1 <ipc_call>
+  8027aa:	8b 53 14             	mov    0x14(%ebx),%edx
+  8027ad:	8b 43 18             	mov    0x18(%ebx),%eax
+  8027b0:	83 c4 20             	add    $0x20,%esp
+  8027b3:	39 c2                	cmp    %eax,%edx
+  8027b5:	74 dd                	je     802794 <ipcring_rsp_wait+0x1e>
+  8027b7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8027ba:	83 e0 07             	and    $0x7,%eax
+  8027bd:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8027c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027c4:	c9                   	leave
+  8027c5:	c3                   	ret
+  8027c6:	68 64 38 80 00       	push   $0x803864
+  8027cb:	68 c1 37 80 00       	push   $0x8037c1
+  8027d0:	6a 3b                	push   $0x3b
+  8027d2:	68 85 38 80 00       	push   $0x803885
+  8027d7:	e8 97 02 00 00       	call   802a73 <_panic>
+
+008027dc <ipcring_rsp_pop>:
+  8027dc:	55                   	push   %ebp
+  8027dd:	89 e5                	mov    %esp,%ebp
+  8027df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027e2:	8b 42 18             	mov    0x18(%edx),%eax
+  8027e5:	83 c0 01             	add    $0x1,%eax
+  8027e8:	89 42 18             	mov    %eax,0x18(%edx)
+  8027eb:	5d                   	pop    %ebp
+  8027ec:	c3                   	ret
+
+008027ed <ipcring_server_init>:
+  8027ed:	55                   	push   %ebp
+  8027ee:	89 e5                	mov    %esp,%ebp
+  8027f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027f6:	89 10                	mov    %edx,(%eax)
+  8027f8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027fb:	89 50 04             	mov    %edx,0x4(%eax)
+  8027fe:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802805:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80280c:	5d                   	pop    %ebp
+  80280d:	c3                   	ret
+
+0080280e <ipcring_req_avail>:
+  80280e:	55                   	push   %ebp
+  80280f:	89 e5                	mov    %esp,%ebp
+  802811:	8b 55 08             	mov    0x8(%ebp),%edx
+  802814:	8b 02                	mov    (%edx),%eax
+  802816:	8b 40 10             	mov    0x10(%eax),%eax
+  802819:	2b 42 08             	sub    0x8(%edx),%eax
+  80281c:	ba 08 00 00 00       	mov    $0x8,%edx
+  802821:	39 d0                	cmp    %edx,%eax
+  802823:	0f 47 c2             	cmova  %edx,%eax
+  802826:	5d                   	pop    %ebp
+  802827:	c3                   	ret
+
+00802828 <ipcring_req_peek>:
+  802828:	55                   	push   %ebp
+  802829:	89 e5                	mov    %esp,%ebp
+  80282b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80282e:	8b 42 08             	mov    0x8(%edx),%eax
+  802831:	83 e0 07             	and    $0x7,%eax
+  802834:	8b 12                	mov    (%edx),%edx
+  802836:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80283a:	5d                   	pop    %ebp
+  80283b:	c3                   	ret
+
+0080283c <ipcring_rsp_push>:
+  80283c:	55                   	push   %ebp
+  80283d:	89 e5                	mov    %esp,%ebp
+  80283f:	83 ec 08             	sub    $0x8,%esp
+  802842:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802845:	8b 41 08             	mov    0x8(%ecx),%eax
+  802848:	83 c0 01             	add    $0x1,%eax
+  80284b:	89 41 08             	mov    %eax,0x8(%ecx)
+  80284e:	8b 11                	mov    (%ecx),%edx
+  802850:	83 c2 14             	add    $0x14,%edx
+  802853:	f0 87 02             	lock xchg %eax,(%edx)
+  802856:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80285a:	75 02                	jne    80285e <ipcring_rsp_push+0x22>
+  80285c:	c9                   	leave
+  80285d:	c3                   	ret
+  80285e:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802865:	6a 00                	push   $0x0
+  802867:	68 00 00 80 ee       	push   $0xee800000
+  80286c:	6a 00                	push   $0x0
+  80286e:	ff 71 04             	push   0x4(%ecx)
+  802871:	e8 dc e0 ff ff       	call   800952 <sys_ipc_try_send>
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	eb e1                	jmp    80285c <ipcring_rsp_push+0x20>
+
+0080287b <ipcring_client_wait>:
+  80287b:	55                   	push   %ebp
+  80287c:	89 e5                	mov    %esp,%ebp
+  80287e:	83 ec 08             	sub    $0x8,%esp
+  802881:	8b 45 08             	mov    0x8(%ebp),%eax
+  802884:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  80288b:	8b 10                	mov    (%eax),%edx
+  80288d:	8b 52 18             	mov    0x18(%edx),%edx
+  802890:	3b 50 08             	cmp    0x8(%eax),%edx
+  802893:	75 02                	jne    802897 <ipcring_client_wait+0x1c>
+  802895:	c9                   	leave
+  802896:	c3                   	ret
+  802897:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80289e:	6a 00                	push   $0x0
+  8028a0:	68 00 00 80 ee       	push   $0xee800000
+  8028a5:	6a 00                	push   $0x0
+  8028a7:	ff 70 04             	push   0x4(%eax)
+  8028aa:	e8 a3 e0 ff ff       	call   800952 <sys_ipc_try_send>
+  8028af:	83 c4 10             	add    $0x10,%esp
+  8028b2:	eb e1                	jmp    802895 <ipcring_client_wait+0x1a>
+
+008028b4 <ipcring_server_sleep>:
+  8028b4:	55                   	push   %ebp
+  8028b5:	89 e5                	mov    %esp,%ebp
+  8028b7:	53                   	push   %ebx
+  8028b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028bb:	8b 01                	mov    (%ecx),%eax
+  8028bd:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8028c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028c5:	f0 87 02             	lock xchg %eax,(%edx)
+  8028c8:	8b 11                	mov    (%ecx),%edx
+  8028ca:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8028cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028d2:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8028d5:	74 0e                	je     8028e5 <ipcring_server_sleep+0x31>
+  8028d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028dc:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e8:	c9                   	leave
+  8028e9:	c3                   	ret
+
+008028ea <devcons_close>:
+  8028ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ef:	c3                   	ret
+
+008028f0 <devcons_stat>:
+  8028f0:	55                   	push   %ebp
+  8028f1:	89 e5                	mov    %esp,%ebp
+  8028f3:	83 ec 10             	sub    $0x10,%esp
+  8028f6:	68 93 38 80 00       	push   $0x803893
+  8028fb:	ff 75 0c             	push   0xc(%ebp)
+  8028fe:	e8 94 d9 ff ff       	call   800297 <strcpy>
+  802903:	b8 00 00 00 00       	mov    $0x0,%eax
+  802908:	c9                   	leave
+  802909:	c3                   	ret
+
+0080290a <devcons_write>:
+  80290a:	55                   	push   %ebp
+  80290b:	89 e5                	mov    %esp,%ebp
+  80290d:	57                   	push   %edi
+  80290e:	56                   	push   %esi
+  80290f:	53                   	push   %ebx
+  802910:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802916:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802919:	85 ff                	test   %edi,%edi
+  80291b:	74 51                	je     80296e <devcons_write+0x64>
+  80291d:	be 00 00 00 00       	mov    $0x0,%esi
+  802922:	b8 00 00 00 00       	mov    $0x0,%eax
+  802927:	89 fb                	mov    %edi,%ebx
+  802929:	29 c3                	sub    %eax,%ebx
+  80292b:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802930:	39 d3                	cmp    %edx,%ebx
+  802932:	0f 47 da             	cmova  %edx,%ebx
+  802935:	83 ec 04             	sub    $0x4,%esp
+  802938:	53                   	push   %ebx
+  802939:	03 45 0c             	add    0xc(%ebp),%eax
+  80293c:	50                   	push   %eax
+  80293d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802943:	50                   	push   %eax
+  802944:	e8 fe da ff ff       	call   800447 <memmove>
+  802949:	83 c4 08             	add    $0x8,%esp
+  80294c:	53                   	push   %ebx
+  80294d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802953:	50                   	push   %eax
+  802954:	e8 b6 dc ff ff       	call   80060f <sys_cputs>
+  802959:	01 de                	add    %ebx,%esi
+  80295b:	89 f0                	mov    %esi,%eax
+  80295d:	83 c4 10             	add    $0x10,%esp
+  802960:	39 fe                	cmp    %edi,%esi
+  802962:	72 c3                	jb     802927 <devcons_write+0x1d>
+  802964:	89 f0                	mov    %esi,%eax
+  802966:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802969:	5b                   	pop    %ebx
+  80296a:	5e                   	pop    %esi
+  80296b:	5f                   	pop    %edi
+  80296c:	5d                   	pop    %ebp
+  80296d:	c3                   	ret
+  80296e:	be 00 00 00 00       	mov    $0x0,%esi
+  802973:	eb ef                	jmp    802964 <devcons_write+0x5a>
+
+00802975 <devcons_read>:
+  802975:	55                   	push   %ebp
+  802976:	89 e5                	mov    %esp,%ebp
+  802978:	83 ec 08             	sub    $0x8,%esp
+  80297b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802980:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802984:	75 07                	jne    80298d <devcons_read+0x18>
+  802986:	eb 1f                	jmp    8029a7 <devcons_read+0x32>
+  802988:	e8 1f dd ff ff       	call   8006ac <sys_yield>
+  80298d:	e8 9b dc ff ff       	call   80062d <sys_cgetc>
+  802992:	85 c0                	test   %eax,%eax
+  802994:	74 f2                	je     802988 <devcons_read+0x13>
+  802996:	78 0f                	js     8029a7 <devcons_read+0x32>
+  802998:	83 f8 04             	cmp    $0x4,%eax
+  80299b:	74 0c                	je     8029a9 <devcons_read+0x34>
+  80299d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a0:	88 02                	mov    %al,(%edx)
+  8029a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029a7:	c9                   	leave
+  8029a8:	c3                   	ret
+  8029a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ae:	eb f7                	jmp    8029a7 <devcons_read+0x32>
+
+008029b0 <cputchar>:
+  8029b0:	55                   	push   %ebp
+  8029b1:	89 e5                	mov    %esp,%ebp
+  8029b3:	83 ec 20             	sub    $0x20,%esp
+  8029b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8029bc:	6a 01                	push   $0x1
+  8029be:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029c1:	50                   	push   %eax
+  8029c2:	e8 48 dc ff ff       	call   80060f <sys_cputs>
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	c9                   	leave
+  8029cb:	c3                   	ret
+
+008029cc <getchar>:
+  8029cc:	55                   	push   %ebp
+  8029cd:	89 e5                	mov    %esp,%ebp
+  8029cf:	83 ec 1c             	sub    $0x1c,%esp
+  8029d2:	6a 01                	push   $0x1
+  8029d4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029d7:	50                   	push   %eax
+  8029d8:	6a 00                	push   $0x0
+  8029da:	e8 5f e8 ff ff       	call   80123e <read>
+  8029df:	83 c4 10             	add    $0x10,%esp
+  8029e2:	85 c0                	test   %eax,%eax
+  8029e4:	78 06                	js     8029ec <getchar+0x20>
+  8029e6:	74 06                	je     8029ee <getchar+0x22>
+  8029e8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8029ec:	c9                   	leave
+  8029ed:	c3                   	ret
+  8029ee:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029f3:	eb f7                	jmp    8029ec <getchar+0x20>
+
+008029f5 <iscons>:
+  8029f5:	55                   	push   %ebp
+  8029f6:	89 e5                	mov    %esp,%ebp
+  8029f8:	83 ec 20             	sub    $0x20,%esp
+  8029fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029fe:	50                   	push   %eax
+  8029ff:	ff 75 08             	push   0x8(%ebp)
+  802a02:	e8 d5 e5 ff ff       	call   800fdc <fd_lookup>
+  802a07:	83 c4 10             	add    $0x10,%esp
+  802a0a:	85 c0                	test   %eax,%eax
+  802a0c:	78 11                	js     802a1f <iscons+0x2a>
+  802a0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a11:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a17:	39 10                	cmp    %edx,(%eax)
+  802a19:	0f 94 c0             	sete   %al
+  802a1c:	0f b6 c0             	movzbl %al,%eax
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+
+00802a21 <opencons>:
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	83 ec 24             	sub    $0x24,%esp
+  802a27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a2a:	50                   	push   %eax
+  802a2b:	e8 5c e5 ff ff       	call   800f8c <fd_alloc>
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	78 3a                	js     802a71 <opencons+0x50>
+  802a37:	83 ec 04             	sub    $0x4,%esp
+  802a3a:	68 07 04 00 00       	push   $0x407
+  802a3f:	ff 75 f4             	push   -0xc(%ebp)
+  802a42:	6a 00                	push   $0x0
+  802a44:	e8 ae dc ff ff       	call   8006f7 <sys_page_alloc>
+  802a49:	83 c4 10             	add    $0x10,%esp
+  802a4c:	85 c0                	test   %eax,%eax
+  802a4e:	78 21                	js     802a71 <opencons+0x50>
+  802a50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a53:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a59:	89 10                	mov    %edx,(%eax)
+  802a5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a5e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802a65:	83 ec 0c             	sub    $0xc,%esp
+  802a68:	50                   	push   %eax
+  802a69:	e8 f7 e4 ff ff       	call   800f65 <fd2num>
+  802a6e:	83 c4 10             	add    $0x10,%esp
+  802a71:	c9                   	leave
+  802a72:	c3                   	ret
+
+00802a73 <_panic>:
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	56                   	push   %esi
+  802a77:	53                   	push   %ebx
+  802a78:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802a7b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a81:	e8 07 dc ff ff       	call   80068d <sys_getenvid>
+  802a86:	83 ec 0c             	sub    $0xc,%esp
+  802a89:	ff 75 0c             	push   0xc(%ebp)
+  802a8c:	ff 75 08             	push   0x8(%ebp)
+  802a8f:	56                   	push   %esi
+  802a90:	50                   	push   %eax
+  802a91:	68 a0 38 80 00       	push   $0x8038a0
+  802a96:	e8 b3 00 00 00       	call   802b4e <cprintf>
+  802a9b:	83 c4 18             	add    $0x18,%esp
+  802a9e:	53                   	push   %ebx
+  802a9f:	ff 75 10             	push   0x10(%ebp)
+  802aa2:	e8 56 00 00 00       	call   802afd <vcprintf>
+  802aa7:	c7 04 24 5b 38 80 00 	movl   $0x80385b,(%esp)
+  802aae:	e8 9b 00 00 00       	call   802b4e <cprintf>
+  802ab3:	83 c4 10             	add    $0x10,%esp
+  802ab6:	cc                   	int3
+  802ab7:	eb fd                	jmp    802ab6 <_panic+0x43>
+
+00802ab9 <putch>:
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	53                   	push   %ebx
+  802abd:	83 ec 04             	sub    $0x4,%esp
+  802ac0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ac3:	8b 13                	mov    (%ebx),%edx
+  802ac5:	8d 42 01             	lea    0x1(%edx),%eax
+  802ac8:	89 03                	mov    %eax,(%ebx)
+  802aca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802acd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802ad1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802ad6:	74 09                	je     802ae1 <putch+0x28>
+  802ad8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  802adc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802adf:	c9                   	leave
+  802ae0:	c3                   	ret
+  802ae1:	83 ec 08             	sub    $0x8,%esp
+  802ae4:	68 ff 00 00 00       	push   $0xff
+  802ae9:	8d 43 08             	lea    0x8(%ebx),%eax
+  802aec:	50                   	push   %eax
+  802aed:	e8 1d db ff ff       	call   80060f <sys_cputs>
+  802af2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802af8:	83 c4 10             	add    $0x10,%esp
+  802afb:	eb db                	jmp    802ad8 <putch+0x1f>
+
+00802afd <vcprintf>:
+  802afd:	55                   	push   %ebp
+  802afe:	89 e5                	mov    %esp,%ebp
+  802b00:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802b06:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802b0d:	00 00 00 
+  802b10:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802b17:	00 00 00 
+  802b1a:	ff 75 0c             	push   0xc(%ebp)
+  802b1d:	ff 75 08             	push   0x8(%ebp)
+  802b20:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802b26:	50                   	push   %eax
+  802b27:	68 b9 2a 80 00       	push   $0x802ab9
+  802b2c:	e8 1c 01 00 00       	call   802c4d <vprintfmt>
+  802b31:	83 c4 08             	add    $0x8,%esp
+  802b34:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802b3a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802b40:	50                   	push   %eax
+  802b41:	e8 c9 da ff ff       	call   80060f <sys_cputs>
+  802b46:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802b4c:	c9                   	leave
+  802b4d:	c3                   	ret
+
+00802b4e <cprintf>:
+  802b4e:	55                   	push   %ebp
+  802b4f:	89 e5                	mov    %esp,%ebp
+  802b51:	83 ec 10             	sub    $0x10,%esp
+  802b54:	8d 45 0c             	lea    0xc(%ebp),%eax
+  802b57:	50                   	push   %eax
+  802b58:	ff 75 08             	push   0x8(%ebp)
+  802b5b:	e8 9d ff ff ff       	call   802afd <vcprintf>
+  802b60:	c9                   	leave
+  802b61:	c3                   	ret
+
+00802b62 <printnum>:
+  802b62:	55                   	push   %ebp
+  802b63:	89 e5                	mov    %esp,%ebp
+  802b65:	57                   	push   %edi
+  802b66:	56                   	push   %esi
+  802b67:	53                   	push   %ebx
+  802b68:	83 ec 1c             	sub    $0x1c,%esp
+  802b6b:	89 c3                	mov    %eax,%ebx
+  802b6d:	89 d6                	mov    %edx,%esi
+  802b6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b75:	89 d1                	mov    %edx,%ecx
+  802b77:	89 c2                	mov    %eax,%edx
+  802b79:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802b7c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b7f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b82:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b85:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b8c:	39 c2                	cmp    %eax,%edx
+  802b8e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802b91:	73 4b                	jae    802bde <printnum+0x7c>
+  802b93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b96:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802b99:	85 ff                	test   %edi,%edi
+  802b9b:	7e 11                	jle    802bae <printnum+0x4c>
+  802b9d:	83 ec 08             	sub    $0x8,%esp
+  802ba0:	56                   	push   %esi
+  802ba1:	ff 75 18             	push   0x18(%ebp)
+  802ba4:	ff d3                	call   *%ebx
+  802ba6:	83 c4 10             	add    $0x10,%esp
+  802ba9:	83 ef 01             	sub    $0x1,%edi
+  802bac:	75 ef                	jne    802b9d <printnum+0x3b>
+  802bae:	83 ec 08             	sub    $0x8,%esp
+  802bb1:	56                   	push   %esi
+  802bb2:	83 ec 04             	sub    $0x4,%esp
+  802bb5:	ff 75 e4             	push   -0x1c(%ebp)
+  802bb8:	ff 75 e0             	push   -0x20(%ebp)
+  802bbb:	ff 75 dc             	push   -0x24(%ebp)
+  802bbe:	ff 75 d8             	push   -0x28(%ebp)
+  802bc1:	e8 d7 09 00 00       	call   80359d <__umoddi3>
+  802bc6:	83 c4 14             	add    $0x14,%esp
+  802bc9:	0f be 80 c3 38 80 00 	movsbl 0x8038c3(%eax),%eax
+  802bd0:	50                   	push   %eax
+  802bd1:	ff d3                	call   *%ebx
+  802bd3:	83 c4 10             	add    $0x10,%esp
+  802bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd9:	5b                   	pop    %ebx
+  802bda:	5e                   	pop    %esi
+  802bdb:	5f                   	pop    %edi
+  802bdc:	5d                   	pop    %ebp
+  802bdd:	c3                   	ret
+  802bde:	83 ec 0c             	sub    $0xc,%esp
+  802be1:	ff 75 18             	push   0x18(%ebp)
+  802be4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802be7:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802bea:	52                   	push   %edx
+  802beb:	50                   	push   %eax
+  802bec:	83 ec 08             	sub    $0x8,%esp
+  802bef:	ff 75 e4             	push   -0x1c(%ebp)
+  802bf2:	ff 75 e0             	push   -0x20(%ebp)
+  802bf5:	ff 75 dc             	push   -0x24(%ebp)
+  802bf8:	ff 75 d8             	push   -0x28(%ebp)
+  802bfb:	e8 7f 09 00 00       	call   80357f <__udivdi3>
+  802c00:	83 c4 18             	add    $0x18,%esp
+  802c03:	52                   	push   %edx
+  802c04:	50                   	push   %eax
+  802c05:	89 f2                	mov    %esi,%edx
+  802c07:	89 d8                	mov    %ebx,%eax
+  802c09:	e8 54 ff ff ff       	call   802b62 <printnum>
+  802c0e:	83 c4 20             	add    $0x20,%esp
+  802c11:	eb 9b                	jmp    802bae <printnum+0x4c>
+
+00802c13 <sprintputch>:
+  802c13:	55                   	push   %ebp
+  802c14:	89 e5                	mov    %esp,%ebp
+  802c16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c19:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  802c1d:	8b 10                	mov    (%eax),%edx
+  802c1f:	3b 50 04             	cmp    0x4(%eax),%edx
+  802c22:	73 0a                	jae    802c2e <sprintputch+0x1b>
+  802c24:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802c27:	89 08                	mov    %ecx,(%eax)
+  802c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2c:	88 02                	mov    %al,(%edx)
+  802c2e:	5d                   	pop    %ebp
+  802c2f:	c3                   	ret
+
+00802c30 <printfmt>:
+  802c30:	55                   	push   %ebp
+  802c31:	89 e5                	mov    %esp,%ebp
+  802c33:	83 ec 08             	sub    $0x8,%esp
+  802c36:	8d 45 14             	lea    0x14(%ebp),%eax
+  802c39:	50                   	push   %eax
+  802c3a:	ff 75 10             	push   0x10(%ebp)
+  802c3d:	ff 75 0c             	push   0xc(%ebp)
+  802c40:	ff 75 08             	push   0x8(%ebp)
+  802c43:	e8 05 00 00 00       	call   802c4d <vprintfmt>
+  802c48:	83 c4 10             	add    $0x10,%esp
+  802c4b:	c9                   	leave
+  802c4c:	c3                   	ret
+
+00802c4d <vprintfmt>:
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	57                   	push   %edi
+  802c51:	56                   	push   %esi
+  802c52:	53                   	push   %ebx
+  802c53:	83 ec 2c             	sub    $0x2c,%esp
+  802c56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c59:	89 df                	mov    %ebx,%edi
+  802c5b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802c5e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c61:	8d 70 01             	lea    0x1(%eax),%esi
+  802c64:	0f b6 00             	movzbl (%eax),%eax
+  802c67:	83 f8 25             	cmp    $0x25,%eax
+  802c6a:	74 1e                	je     802c8a <vprintfmt+0x3d>
+  802c6c:	85 c0                	test   %eax,%eax
+  802c6e:	0f 84 15 05 00 00    	je     803189 <vprintfmt+0x53c>
+  802c74:	83 ec 08             	sub    $0x8,%esp
+  802c77:	53                   	push   %ebx
+  802c78:	50                   	push   %eax
+  802c79:	ff d7                	call   *%edi
+  802c7b:	83 c6 01             	add    $0x1,%esi
+  802c7e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802c82:	83 c4 10             	add    $0x10,%esp
+  802c85:	83 f8 25             	cmp    $0x25,%eax
+  802c88:	75 e2                	jne    802c6c <vprintfmt+0x1f>
+  802c8a:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  802c8e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  802c95:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802c9c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  802ca3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ca8:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  802cab:	8d 56 01             	lea    0x1(%esi),%edx
+  802cae:	0f b6 0e             	movzbl (%esi),%ecx
+  802cb1:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802cb4:	3c 55                	cmp    $0x55,%al
+  802cb6:	0f 87 3b 04 00 00    	ja     8030f7 <vprintfmt+0x4aa>
+  802cbc:	0f b6 c0             	movzbl %al,%eax
+  802cbf:	ff 24 85 00 3a 80 00 	jmp    *0x803a00(,%eax,4)
+  802cc6:	89 75 10             	mov    %esi,0x10(%ebp)
+  802cc9:	eb 93                	jmp    802c5e <vprintfmt+0x11>
+  802ccb:	89 d6                	mov    %edx,%esi
+  802ccd:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802cd1:	eb d8                	jmp    802cab <vprintfmt+0x5e>
+  802cd3:	89 d6                	mov    %edx,%esi
+  802cd5:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802cd9:	eb d0                	jmp    802cab <vprintfmt+0x5e>
+  802cdb:	0f b6 c9             	movzbl %cl,%ecx
+  802cde:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802ce1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ce4:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  802ce8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802ceb:	83 f9 09             	cmp    $0x9,%ecx
+  802cee:	77 6f                	ja     802d5f <vprintfmt+0x112>
+  802cf0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  802cf3:	83 c2 01             	add    $0x1,%edx
+  802cf6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802cf9:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  802cfd:	0f be 02             	movsbl (%edx),%eax
+  802d00:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802d03:	83 fe 09             	cmp    $0x9,%esi
+  802d06:	76 eb                	jbe    802cf3 <vprintfmt+0xa6>
+  802d08:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  802d0b:	89 d6                	mov    %edx,%esi
+  802d0d:	eb 13                	jmp    802d22 <vprintfmt+0xd5>
+  802d0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d12:	8b 00                	mov    (%eax),%eax
+  802d14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d17:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d1a:	8d 40 04             	lea    0x4(%eax),%eax
+  802d1d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802d20:	89 d6                	mov    %edx,%esi
+  802d22:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d26:	79 83                	jns    802cab <vprintfmt+0x5e>
+  802d28:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802d2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d2e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802d35:	e9 71 ff ff ff       	jmp    802cab <vprintfmt+0x5e>
+  802d3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802d3d:	85 c9                	test   %ecx,%ecx
+  802d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d44:	0f 49 c1             	cmovns %ecx,%eax
+  802d47:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d4a:	89 d6                	mov    %edx,%esi
+  802d4c:	e9 5a ff ff ff       	jmp    802cab <vprintfmt+0x5e>
+  802d51:	89 d6                	mov    %edx,%esi
+  802d53:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  802d5a:	e9 4c ff ff ff       	jmp    802cab <vprintfmt+0x5e>
+  802d5f:	89 d6                	mov    %edx,%esi
+  802d61:	eb bf                	jmp    802d22 <vprintfmt+0xd5>
+  802d63:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  802d67:	89 d6                	mov    %edx,%esi
+  802d69:	e9 3d ff ff ff       	jmp    802cab <vprintfmt+0x5e>
+  802d6e:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d71:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d74:	8d 70 04             	lea    0x4(%eax),%esi
+  802d77:	83 ec 08             	sub    $0x8,%esp
+  802d7a:	53                   	push   %ebx
+  802d7b:	ff 30                	push   (%eax)
+  802d7d:	ff d7                	call   *%edi
+  802d7f:	83 c4 10             	add    $0x10,%esp
+  802d82:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d85:	e9 d4 fe ff ff       	jmp    802c5e <vprintfmt+0x11>
+  802d8a:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d90:	8d 70 04             	lea    0x4(%eax),%esi
+  802d93:	8b 10                	mov    (%eax),%edx
+  802d95:	89 d0                	mov    %edx,%eax
+  802d97:	f7 d8                	neg    %eax
+  802d99:	0f 48 c2             	cmovs  %edx,%eax
+  802d9c:	83 f8 12             	cmp    $0x12,%eax
+  802d9f:	7f 23                	jg     802dc4 <vprintfmt+0x177>
+  802da1:	8b 14 85 60 3b 80 00 	mov    0x803b60(,%eax,4),%edx
+  802da8:	85 d2                	test   %edx,%edx
+  802daa:	74 18                	je     802dc4 <vprintfmt+0x177>
+  802dac:	52                   	push   %edx
+  802dad:	68 d3 37 80 00       	push   $0x8037d3
+  802db2:	53                   	push   %ebx
+  802db3:	57                   	push   %edi
+  802db4:	e8 77 fe ff ff       	call   802c30 <printfmt>
+  802db9:	83 c4 10             	add    $0x10,%esp
+  802dbc:	89 75 14             	mov    %esi,0x14(%ebp)
+  802dbf:	e9 9a fe ff ff       	jmp    802c5e <vprintfmt+0x11>
+  802dc4:	50                   	push   %eax
+  802dc5:	68 db 38 80 00       	push   $0x8038db
+  802dca:	53                   	push   %ebx
+  802dcb:	57                   	push   %edi
+  802dcc:	e8 5f fe ff ff       	call   802c30 <printfmt>
+  802dd1:	83 c4 10             	add    $0x10,%esp
+  802dd4:	89 75 14             	mov    %esi,0x14(%ebp)
+  802dd7:	e9 82 fe ff ff       	jmp    802c5e <vprintfmt+0x11>
+  802ddc:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ddf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802de2:	83 c0 04             	add    $0x4,%eax
+  802de5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802de8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802deb:	8b 00                	mov    (%eax),%eax
+  802ded:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802df0:	85 c0                	test   %eax,%eax
+  802df2:	0f 84 61 03 00 00    	je     803159 <vprintfmt+0x50c>
+  802df8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802dfc:	7e 06                	jle    802e04 <vprintfmt+0x1b7>
+  802dfe:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802e02:	75 29                	jne    802e2d <vprintfmt+0x1e0>
+  802e04:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802e07:	8d 70 01             	lea    0x1(%eax),%esi
+  802e0a:	0f b6 00             	movzbl (%eax),%eax
+  802e0d:	0f be d0             	movsbl %al,%edx
+  802e10:	85 d2                	test   %edx,%edx
+  802e12:	0f 84 bb 00 00 00    	je     802ed3 <vprintfmt+0x286>
+  802e18:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802e1b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802e1e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802e21:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e24:	eb 7a                	jmp    802ea0 <vprintfmt+0x253>
+  802e26:	c7 45 d0 d4 38 80 00 	movl   $0x8038d4,-0x30(%ebp)
+  802e2d:	83 ec 08             	sub    $0x8,%esp
+  802e30:	ff 75 d4             	push   -0x2c(%ebp)
+  802e33:	ff 75 d0             	push   -0x30(%ebp)
+  802e36:	e8 32 d4 ff ff       	call   80026d <strnlen>
+  802e3b:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802e3e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e41:	83 c4 10             	add    $0x10,%esp
+  802e44:	85 d2                	test   %edx,%edx
+  802e46:	0f 8e d6 02 00 00    	jle    803122 <vprintfmt+0x4d5>
+  802e4c:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802e50:	83 ec 08             	sub    $0x8,%esp
+  802e53:	53                   	push   %ebx
+  802e54:	56                   	push   %esi
+  802e55:	ff d7                	call   *%edi
+  802e57:	83 c4 10             	add    $0x10,%esp
+  802e5a:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802e5e:	75 f0                	jne    802e50 <vprintfmt+0x203>
+  802e60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802e63:	8d 70 01             	lea    0x1(%eax),%esi
+  802e66:	0f b6 00             	movzbl (%eax),%eax
+  802e69:	0f be d0             	movsbl %al,%edx
+  802e6c:	85 d2                	test   %edx,%edx
+  802e6e:	0f 84 da 02 00 00    	je     80314e <vprintfmt+0x501>
+  802e74:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802e77:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802e7a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802e7d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802e80:	eb 1e                	jmp    802ea0 <vprintfmt+0x253>
+  802e82:	83 ec 08             	sub    $0x8,%esp
+  802e85:	ff 75 0c             	push   0xc(%ebp)
+  802e88:	52                   	push   %edx
+  802e89:	ff 55 08             	call   *0x8(%ebp)
+  802e8c:	83 c4 10             	add    $0x10,%esp
+  802e8f:	83 eb 01             	sub    $0x1,%ebx
+  802e92:	83 c6 01             	add    $0x1,%esi
+  802e95:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802e99:	0f be d0             	movsbl %al,%edx
+  802e9c:	85 d2                	test   %edx,%edx
+  802e9e:	74 2a                	je     802eca <vprintfmt+0x27d>
+  802ea0:	85 ff                	test   %edi,%edi
+  802ea2:	78 05                	js     802ea9 <vprintfmt+0x25c>
+  802ea4:	83 ef 01             	sub    $0x1,%edi
+  802ea7:	78 59                	js     802f02 <vprintfmt+0x2b5>
+  802ea9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802ead:	74 d3                	je     802e82 <vprintfmt+0x235>
+  802eaf:	0f be c0             	movsbl %al,%eax
+  802eb2:	83 e8 20             	sub    $0x20,%eax
+  802eb5:	83 f8 5e             	cmp    $0x5e,%eax
+  802eb8:	76 c8                	jbe    802e82 <vprintfmt+0x235>
+  802eba:	83 ec 08             	sub    $0x8,%esp
+  802ebd:	ff 75 0c             	push   0xc(%ebp)
+  802ec0:	6a 3f                	push   $0x3f
+  802ec2:	ff 55 08             	call   *0x8(%ebp)
+  802ec5:	83 c4 10             	add    $0x10,%esp
+  802ec8:	eb c5                	jmp    802e8f <vprintfmt+0x242>
+  802eca:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802ecd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ed0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ed3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802ed6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802eda:	7e 1b                	jle    802ef7 <vprintfmt+0x2aa>
+  802edc:	83 ec 08             	sub    $0x8,%esp
+  802edf:	53                   	push   %ebx
+  802ee0:	6a 20                	push   $0x20
+  802ee2:	ff d7                	call   *%edi
+  802ee4:	83 c4 10             	add    $0x10,%esp
+  802ee7:	83 ee 01             	sub    $0x1,%esi
+  802eea:	75 f0                	jne    802edc <vprintfmt+0x28f>
+  802eec:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802eef:	89 45 14             	mov    %eax,0x14(%ebp)
+  802ef2:	e9 67 fd ff ff       	jmp    802c5e <vprintfmt+0x11>
+  802ef7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802efa:	89 45 14             	mov    %eax,0x14(%ebp)
+  802efd:	e9 5c fd ff ff       	jmp    802c5e <vprintfmt+0x11>
+  802f02:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802f05:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802f0b:	eb c6                	jmp    802ed3 <vprintfmt+0x286>
+  802f0d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f10:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f13:	83 f9 01             	cmp    $0x1,%ecx
+  802f16:	7f 1f                	jg     802f37 <vprintfmt+0x2ea>
+  802f18:	85 c9                	test   %ecx,%ecx
+  802f1a:	74 67                	je     802f83 <vprintfmt+0x336>
+  802f1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f1f:	8b 30                	mov    (%eax),%esi
+  802f21:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f24:	89 f0                	mov    %esi,%eax
+  802f26:	c1 f8 1f             	sar    $0x1f,%eax
+  802f29:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2f:	8d 40 04             	lea    0x4(%eax),%eax
+  802f32:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f35:	eb 17                	jmp    802f4e <vprintfmt+0x301>
+  802f37:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f3a:	8b 50 04             	mov    0x4(%eax),%edx
+  802f3d:	8b 00                	mov    (%eax),%eax
+  802f3f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802f42:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802f45:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f48:	8d 40 08             	lea    0x8(%eax),%eax
+  802f4b:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f4e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802f51:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f54:	be 0a 00 00 00       	mov    $0xa,%esi
+  802f59:	85 c9                	test   %ecx,%ecx
+  802f5b:	0f 89 12 01 00 00    	jns    803073 <vprintfmt+0x426>
+  802f61:	83 ec 08             	sub    $0x8,%esp
+  802f64:	53                   	push   %ebx
+  802f65:	6a 2d                	push   $0x2d
+  802f67:	ff d7                	call   *%edi
+  802f69:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802f6c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f6f:	f7 da                	neg    %edx
+  802f71:	83 d1 00             	adc    $0x0,%ecx
+  802f74:	f7 d9                	neg    %ecx
+  802f76:	83 c4 10             	add    $0x10,%esp
+  802f79:	be 0a 00 00 00       	mov    $0xa,%esi
+  802f7e:	e9 f0 00 00 00       	jmp    803073 <vprintfmt+0x426>
+  802f83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f86:	8b 30                	mov    (%eax),%esi
+  802f88:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f8b:	89 f0                	mov    %esi,%eax
+  802f8d:	c1 f8 1f             	sar    $0x1f,%eax
+  802f90:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f96:	8d 40 04             	lea    0x4(%eax),%eax
+  802f99:	89 45 14             	mov    %eax,0x14(%ebp)
+  802f9c:	eb b0                	jmp    802f4e <vprintfmt+0x301>
+  802f9e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802fa1:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fa4:	83 f9 01             	cmp    $0x1,%ecx
+  802fa7:	7f 1e                	jg     802fc7 <vprintfmt+0x37a>
+  802fa9:	85 c9                	test   %ecx,%ecx
+  802fab:	74 32                	je     802fdf <vprintfmt+0x392>
+  802fad:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fb0:	8b 10                	mov    (%eax),%edx
+  802fb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fb7:	8d 40 04             	lea    0x4(%eax),%eax
+  802fba:	89 45 14             	mov    %eax,0x14(%ebp)
+  802fbd:	be 0a 00 00 00       	mov    $0xa,%esi
+  802fc2:	e9 ac 00 00 00       	jmp    803073 <vprintfmt+0x426>
+  802fc7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fca:	8b 10                	mov    (%eax),%edx
+  802fcc:	8b 48 04             	mov    0x4(%eax),%ecx
+  802fcf:	8d 40 08             	lea    0x8(%eax),%eax
+  802fd2:	89 45 14             	mov    %eax,0x14(%ebp)
+  802fd5:	be 0a 00 00 00       	mov    $0xa,%esi
+  802fda:	e9 94 00 00 00       	jmp    803073 <vprintfmt+0x426>
+  802fdf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fe2:	8b 10                	mov    (%eax),%edx
+  802fe4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fe9:	8d 40 04             	lea    0x4(%eax),%eax
+  802fec:	89 45 14             	mov    %eax,0x14(%ebp)
+  802fef:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ff4:	eb 7d                	jmp    803073 <vprintfmt+0x426>
+  802ff6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802ff9:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ffc:	83 f9 01             	cmp    $0x1,%ecx
+  802fff:	7f 1b                	jg     80301c <vprintfmt+0x3cf>
+  803001:	85 c9                	test   %ecx,%ecx
+  803003:	74 2c                	je     803031 <vprintfmt+0x3e4>
+  803005:	8b 45 14             	mov    0x14(%ebp),%eax
+  803008:	8b 10                	mov    (%eax),%edx
+  80300a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80300f:	8d 40 04             	lea    0x4(%eax),%eax
+  803012:	89 45 14             	mov    %eax,0x14(%ebp)
+  803015:	be 08 00 00 00       	mov    $0x8,%esi
+  80301a:	eb 57                	jmp    803073 <vprintfmt+0x426>
+  80301c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80301f:	8b 10                	mov    (%eax),%edx
+  803021:	8b 48 04             	mov    0x4(%eax),%ecx
+  803024:	8d 40 08             	lea    0x8(%eax),%eax
+  803027:	89 45 14             	mov    %eax,0x14(%ebp)
+  80302a:	be 08 00 00 00       	mov    $0x8,%esi
+  80302f:	eb 42                	jmp    803073 <vprintfmt+0x426>
+  803031:	8b 45 14             	mov    0x14(%ebp),%eax
+  803034:	8b 10                	mov    (%eax),%edx
+  803036:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80303b:	8d 40 04             	lea    0x4(%eax),%eax
+  80303e:	89 45 14             	mov    %eax,0x14(%ebp)
+  803041:	be 08 00 00 00       	mov    $0x8,%esi
+  803046:	eb 2b                	jmp    803073 <vprintfmt+0x426>
+  803048:	89 55 10             	mov    %edx,0x10(%ebp)
+  80304b:	83 ec 08             	sub    $0x8,%esp
+  80304e:	53                   	push   %ebx
+  80304f:	6a 30                	push   $0x30
+  803051:	ff d7                	call   *%edi
+  803053:	83 c4 08             	add    $0x8,%esp
+  803056:	53                   	push   %ebx
+  803057:	6a 78                	push   $0x78
+  803059:	ff d7                	call   *%edi
+  80305b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80305e:	8b 10                	mov    (%eax),%edx
+  803060:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803065:	83 c4 10             	add    $0x10,%esp
+  803068:	8d 40 04             	lea    0x4(%eax),%eax
+  80306b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80306e:	be 10 00 00 00       	mov    $0x10,%esi
+  803073:	83 ec 0c             	sub    $0xc,%esp
+  803076:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80307a:	50                   	push   %eax
+  80307b:	ff 75 e4             	push   -0x1c(%ebp)
+  80307e:	56                   	push   %esi
+  80307f:	51                   	push   %ecx
+  803080:	52                   	push   %edx
+  803081:	89 da                	mov    %ebx,%edx
+  803083:	89 f8                	mov    %edi,%eax
+  803085:	e8 d8 fa ff ff       	call   802b62 <printnum>
+  80308a:	83 c4 20             	add    $0x20,%esp
+  80308d:	e9 cc fb ff ff       	jmp    802c5e <vprintfmt+0x11>
+  803092:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803095:	89 55 10             	mov    %edx,0x10(%ebp)
+  803098:	83 f9 01             	cmp    $0x1,%ecx
+  80309b:	7f 1b                	jg     8030b8 <vprintfmt+0x46b>
+  80309d:	85 c9                	test   %ecx,%ecx
+  80309f:	74 2c                	je     8030cd <vprintfmt+0x480>
+  8030a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030a4:	8b 10                	mov    (%eax),%edx
+  8030a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8030ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030b1:	be 10 00 00 00       	mov    $0x10,%esi
+  8030b6:	eb bb                	jmp    803073 <vprintfmt+0x426>
+  8030b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030bb:	8b 10                	mov    (%eax),%edx
+  8030bd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8030c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8030c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030c6:	be 10 00 00 00       	mov    $0x10,%esi
+  8030cb:	eb a6                	jmp    803073 <vprintfmt+0x426>
+  8030cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030d0:	8b 10                	mov    (%eax),%edx
+  8030d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8030da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030dd:	be 10 00 00 00       	mov    $0x10,%esi
+  8030e2:	eb 8f                	jmp    803073 <vprintfmt+0x426>
+  8030e4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8030e7:	83 ec 08             	sub    $0x8,%esp
+  8030ea:	53                   	push   %ebx
+  8030eb:	6a 25                	push   $0x25
+  8030ed:	ff d7                	call   *%edi
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	e9 67 fb ff ff       	jmp    802c5e <vprintfmt+0x11>
+  8030f7:	83 ec 08             	sub    $0x8,%esp
+  8030fa:	53                   	push   %ebx
+  8030fb:	6a 25                	push   $0x25
+  8030fd:	ff d7                	call   *%edi
+  8030ff:	83 c4 10             	add    $0x10,%esp
+  803102:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  803106:	0f 84 ba fb ff ff    	je     802cc6 <vprintfmt+0x79>
+  80310c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80310f:	89 f0                	mov    %esi,%eax
+  803111:	83 e8 01             	sub    $0x1,%eax
+  803114:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  803118:	75 f7                	jne    803111 <vprintfmt+0x4c4>
+  80311a:	89 45 10             	mov    %eax,0x10(%ebp)
+  80311d:	e9 3c fb ff ff       	jmp    802c5e <vprintfmt+0x11>
+  803122:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803125:	8d 70 01             	lea    0x1(%eax),%esi
+  803128:	0f b6 00             	movzbl (%eax),%eax
+  80312b:	0f be d0             	movsbl %al,%edx
+  80312e:	85 d2                	test   %edx,%edx
+  803130:	74 11                	je     803143 <vprintfmt+0x4f6>
+  803132:	89 7d 08             	mov    %edi,0x8(%ebp)
+  803135:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803138:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80313b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80313e:	e9 5d fd ff ff       	jmp    802ea0 <vprintfmt+0x253>
+  803143:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803146:	89 45 14             	mov    %eax,0x14(%ebp)
+  803149:	e9 10 fb ff ff       	jmp    802c5e <vprintfmt+0x11>
+  80314e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803151:	89 45 14             	mov    %eax,0x14(%ebp)
+  803154:	e9 05 fb ff ff       	jmp    802c5e <vprintfmt+0x11>
+  803159:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80315d:	7e 0a                	jle    803169 <vprintfmt+0x51c>
+  80315f:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  803163:	0f 85 bd fc ff ff    	jne    802e26 <vprintfmt+0x1d9>
+  803169:	ba 28 00 00 00       	mov    $0x28,%edx
+  80316e:	b8 28 00 00 00       	mov    $0x28,%eax
+  803173:	be d5 38 80 00       	mov    $0x8038d5,%esi
+  803178:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80317b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80317e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  803181:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803184:	e9 17 fd ff ff       	jmp    802ea0 <vprintfmt+0x253>
+  803189:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80318c:	5b                   	pop    %ebx
+  80318d:	5e                   	pop    %esi
+  80318e:	5f                   	pop    %edi
+  80318f:	5d                   	pop    %ebp
+  803190:	c3                   	ret
+
+00803191 <vsnprintf>:
+  803191:	55                   	push   %ebp
+  803192:	89 e5                	mov    %esp,%ebp
+  803194:	83 ec 18             	sub    $0x18,%esp
+  803197:	8b 45 08             	mov    0x8(%ebp),%eax
+  80319a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80319d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8031a0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8031a4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8031a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8031ae:	85 c0                	test   %eax,%eax
+  8031b0:	74 26                	je     8031d8 <vsnprintf+0x47>
+  8031b2:	85 d2                	test   %edx,%edx
+  8031b4:	7e 22                	jle    8031d8 <vsnprintf+0x47>
+  8031b6:	ff 75 14             	push   0x14(%ebp)
+  8031b9:	ff 75 10             	push   0x10(%ebp)
+  8031bc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8031bf:	50                   	push   %eax
+  8031c0:	68 13 2c 80 00       	push   $0x802c13
+  8031c5:	e8 83 fa ff ff       	call   802c4d <vprintfmt>
+  8031ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8031cd:	c6 00 00             	movb   $0x0,(%eax)
+  8031d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031d3:	83 c4 10             	add    $0x10,%esp
+  8031d6:	c9                   	leave
+  8031d7:	c3                   	ret
+  8031d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031dd:	eb f7                	jmp    8031d6 <vsnprintf+0x45>
+
+008031df <snprintf>:
+  8031df:	55                   	push   %ebp
+  8031e0:	89 e5                	mov    %esp,%ebp
+  8031e2:	83 ec 08             	sub    $0x8,%esp
+  8031e5:	8d 45 14             	lea    0x14(%ebp),%eax
+  8031e8:	50                   	push   %eax
+  8031e9:	ff 75 10             	push   0x10(%ebp)
+  8031ec:	ff 75 0c             	push   0xc(%ebp)
+  8031ef:	ff 75 08             	push   0x8(%ebp)
+  8031f2:	e8 9a ff ff ff       	call   803191 <vsnprintf>
+  8031f7:	c9                   	leave
+  8031f8:	c3                   	ret
+
+008031f9 <ipc_recv>:
+  8031f9:	55                   	push   %ebp
+  8031fa:	89 e5                	mov    %esp,%ebp
+  8031fc:	56                   	push   %esi
+  8031fd:	53                   	push   %ebx
+  8031fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  803201:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803204:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803207:	85 c0                	test   %eax,%eax
+  803209:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  80320e:	0f 44 c2             	cmove  %edx,%eax
+  803211:	83 ec 0c             	sub    $0xc,%esp
+  803214:	50                   	push   %eax
+  803215:	e8 88 d7 ff ff       	call   8009a2 <sys_ipc_recv>
+  80321a:	83 c4 10             	add    $0x10,%esp
+  80321d:	85 c0                	test   %eax,%eax
+  80321f:	78 2a                	js     80324b <ipc_recv+0x52>
+  803221:	a1 14 54 80 00       	mov    0x805414,%eax
+  803226:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  80322c:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803232:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803238:	85 f6                	test   %esi,%esi
+  80323a:	74 02                	je     80323e <ipc_recv+0x45>
+  80323c:	89 0e                	mov    %ecx,(%esi)
+  80323e:	85 db                	test   %ebx,%ebx
+  803240:	74 02                	je     803244 <ipc_recv+0x4b>
+  803242:	89 13                	mov    %edx,(%ebx)
+  803244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803247:	5b                   	pop    %ebx
+  803248:	5e                   	pop    %esi
+  803249:	5d                   	pop    %ebp
+  80324a:	c3                   	ret
+  80324b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803255:	eb e1                	jmp    803238 <ipc_recv+0x3f>
+
+00803257 <ipc_send>:
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	57                   	push   %edi
+  80325b:	56                   	push   %esi
+  80325c:	53                   	push   %ebx
+  80325d:	83 ec 0c             	sub    $0xc,%esp
+  803260:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803263:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803266:	8b 75 14             	mov    0x14(%ebp),%esi
+  803269:	85 db                	test   %ebx,%ebx
+  80326b:	74 1e                	je     80328b <ipc_send+0x34>
+  80326d:	56                   	push   %esi
+  80326e:	53                   	push   %ebx
+  80326f:	57                   	push   %edi
+  803270:	ff 75 08             	push   0x8(%ebp)
+  803273:	e8 b7 d7 ff ff       	call   800a2f <sys_ipc_send>
+  803278:	83 c4 10             	add    $0x10,%esp
+  80327b:	85 c0                	test   %eax,%eax
+  80327d:	74 2a                	je     8032a9 <ipc_send+0x52>
+  80327f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803282:	75 13                	jne    803297 <ipc_send+0x40>
+  803284:	e8 23 d4 ff ff       	call   8006ac <sys_yield>
+  803289:	eb e2                	jmp    80326d <ipc_send+0x16>
+  80328b:	be 00 00 00 00       	mov    $0x0,%esi
+  803290:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803295:	eb d6                	jmp    80326d <ipc_send+0x16>
+  803297:	50                   	push   %eax
+  803298:	68 cc 3b 80 00       	push   $0x803bcc
+  80329d:	6a 4f                	push   $0x4f
+  80329f:	68 0f 3c 80 00       	push   $0x803c0f
+  8032a4:	e8 ca f7 ff ff       	call   802a73 <_panic>
+  8032a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032ac:	5b                   	pop    %ebx
+  8032ad:	5e                   	pop    %esi
+  8032ae:	5f                   	pop    %edi
+  8032af:	5d                   	pop    %ebp
+  8032b0:	c3                   	ret
+
+008032b1 <ipc_call>:
+  8032b1:	55                   	push   %ebp
+  8032b2:	89 e5                	mov    %esp,%ebp
+  8032b4:	57                   	push   %edi
+  8032b5:	56                   	push   %esi
+  8032b6:	53                   	push   %ebx
+  8032b7:	83 ec 0c             	sub    $0xc,%esp
+  8032ba:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032be:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8032c3:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8032c7:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8032cb:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8032d0:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8032d4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032dd:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  8032e1:	eb 05                	jmp    8032e8 <ipc_call+0x37>
+  8032e3:	e8 c4 d3 ff ff       	call   8006ac <sys_yield>
+  8032e8:	83 ec 0c             	sub    $0xc,%esp
+  8032eb:	56                   	push   %esi
+  8032ec:	53                   	push   %ebx
+  8032ed:	57                   	push   %edi
+  8032ee:	ff 75 0c             	push   0xc(%ebp)
+  8032f1:	ff 75 08             	push   0x8(%ebp)
+  8032f4:	e8 86 d7 ff ff       	call   800a7f <sys_ipc_call>
+  8032f9:	83 c4 20             	add    $0x20,%esp
+  8032fc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032ff:	74 e2                	je     8032e3 <ipc_call+0x32>
+  803301:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803304:	74 2d                	je     803333 <ipc_call+0x82>
+  803306:	85 c0                	test   %eax,%eax
+  803308:	78 4f                	js     803359 <ipc_call+0xa8>
+  80330a:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80330e:	74 10                	je     803320 <ipc_call+0x6f>
+  803310:	a1 14 54 80 00       	mov    0x805414,%eax
+  803315:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80331b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80331e:	89 02                	mov    %eax,(%edx)
+  803320:	a1 14 54 80 00       	mov    0x805414,%eax
+  803325:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80332b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80332e:	5b                   	pop    %ebx
+  80332f:	5e                   	pop    %esi
+  803330:	5f                   	pop    %edi
+  803331:	5d                   	pop    %ebp
+  803332:	c3                   	ret
+  803333:	ff 75 14             	push   0x14(%ebp)
+  803336:	ff 75 10             	push   0x10(%ebp)
+  803339:	ff 75 0c             	push   0xc(%ebp)
+  80333c:	ff 75 08             	push   0x8(%ebp)
+  80333f:	e8 13 ff ff ff       	call   803257 <ipc_send>
+  803344:	83 c4 0c             	add    $0xc,%esp
+  803347:	ff 75 1c             	push   0x1c(%ebp)
+  80334a:	ff 75 18             	push   0x18(%ebp)
+  80334d:	6a 00                	push   $0x0
+  80334f:	e8 a5 fe ff ff       	call   8031f9 <ipc_recv>
+  803354:	83 c4 10             	add    $0x10,%esp
+  803357:	eb d2                	jmp    80332b <ipc_call+0x7a>
+  803359:	50                   	push   %eax
+  80335a:	68 19 3c 80 00       	push   $0x803c19
+  80335f:	6a 6d                	push   $0x6d
+  803361:	68 0f 3c 80 00       	push   $0x803c0f
+  803366:	e8 08 f7 ff ff       	call   802a73 <_panic>
+
+0080336b <ipc_reply_recv>:
+  80336b:	55                   	push   %ebp
+  80336c:	89 e5                	mov    %esp,%ebp
+  80336e:	57                   	push   %edi
+  80336f:	56                   	push   %esi
+  803370:	53                   	push   %ebx
+  803371:	83 ec 0c             	sub    $0xc,%esp
+  803374:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803377:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  80337a:	8b 7d 20             	mov    0x20(%ebp),%edi
+  80337d:	85 db                	test   %ebx,%ebx
+  80337f:	0f 84 ac 00 00 00    	je     803431 <ipc_reply_recv+0xc6>
+  803385:	85 f6                	test   %esi,%esi
+  803387:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80338c:	0f 45 c6             	cmovne %esi,%eax
+  80338f:	83 ec 0c             	sub    $0xc,%esp
+  803392:	50                   	push   %eax
+  803393:	ff 75 14             	push   0x14(%ebp)
+  803396:	53                   	push   %ebx
+  803397:	ff 75 0c             	push   0xc(%ebp)
+  80339a:	ff 75 08             	push   0x8(%ebp)
+  80339d:	e8 fe d6 ff ff       	call   800aa0 <sys_ipc_reply_recv>
+  8033a2:	83 c4 20             	add    $0x20,%esp
+  8033a5:	85 c0                	test   %eax,%eax
+  8033a7:	78 3a                	js     8033e3 <ipc_reply_recv+0x78>
+  8033a9:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8033ad:	74 10                	je     8033bf <ipc_reply_recv+0x54>
+  8033af:	a1 14 54 80 00       	mov    0x805414,%eax
+  8033b4:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8033ba:	8b 55 18             	mov    0x18(%ebp),%edx
+  8033bd:	89 02                	mov    %eax,(%edx)
+  8033bf:	85 ff                	test   %edi,%edi
+  8033c1:	74 0d                	je     8033d0 <ipc_reply_recv+0x65>
+  8033c3:	a1 14 54 80 00       	mov    0x805414,%eax
+  8033c8:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8033ce:	89 07                	mov    %eax,(%edi)
+  8033d0:	a1 14 54 80 00       	mov    0x805414,%eax
+  8033d5:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8033db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033de:	5b                   	pop    %ebx
+  8033df:	5e                   	pop    %esi
+  8033e0:	5f                   	pop    %edi
+  8033e1:	5d                   	pop    %ebp
+  8033e2:	c3                   	ret
+  8033e3:	ff 75 14             	push   0x14(%ebp)
+  8033e6:	53                   	push   %ebx
+  8033e7:	ff 75 0c             	push   0xc(%ebp)
+  8033ea:	ff 75 08             	push   0x8(%ebp)
+  8033ed:	e8 60 d5 ff ff       	call   800952 <sys_ipc_try_send>
+  8033f2:	89 c2                	mov    %eax,%edx
+  8033f4:	c1 ea 1f             	shr    $0x1f,%edx
+  8033f7:	83 c4 10             	add    $0x10,%esp
+  8033fa:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8033fd:	0f 95 c1             	setne  %cl
+  803400:	84 d1                	test   %dl,%cl
+  803402:	74 05                	je     803409 <ipc_reply_recv+0x9e>
+  803404:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803407:	75 12                	jne    80341b <ipc_reply_recv+0xb0>
+  803409:	83 ec 04             	sub    $0x4,%esp
+  80340c:	57                   	push   %edi
+  80340d:	56                   	push   %esi
+  80340e:	ff 75 18             	push   0x18(%ebp)
+  803411:	e8 e3 fd ff ff       	call   8031f9 <ipc_recv>
+  803416:	83 c4 10             	add    $0x10,%esp
+  803419:	eb c0                	jmp    8033db <ipc_reply_recv+0x70>
+  80341b:	83 ec 04             	sub    $0x4,%esp
+  80341e:	50                   	push   %eax
+  80341f:	ff 75 08             	push   0x8(%ebp)
+  803422:	68 ec 3b 80 00       	push   $0x803bec
+  803427:	e8 22 f7 ff ff       	call   802b4e <cprintf>
+  80342c:	83 c4 10             	add    $0x10,%esp
+  80342f:	eb d8                	jmp    803409 <ipc_reply_recv+0x9e>
+  803431:	85 f6                	test   %esi,%esi
+  803433:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803438:	0f 45 c6             	cmovne %esi,%eax
+  80343b:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803440:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803447:	e9 43 ff ff ff       	jmp    80338f <ipc_reply_recv+0x24>
+
+0080344c <ipc_find_env>:
+  80344c:	55                   	push   %ebp
+  80344d:	89 e5                	mov    %esp,%ebp
+  80344f:	83 ec 14             	sub    $0x14,%esp
+  803452:	ff 75 08             	push   0x8(%ebp)
+  803455:	e8 96 d4 ff ff       	call   8008f0 <sys_env_service>
+  80345a:	85 c0                	test   %eax,%eax
+  80345c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803461:	0f 48 c2             	cmovs  %edx,%eax
+  803464:	c9                   	leave
+  803465:	c3                   	ret
+
+00803466 <pageref>:
+  803466:	55                   	push   %ebp
+  803467:	89 e5                	mov    %esp,%ebp
+  803469:	8b 45 08             	mov    0x8(%ebp),%eax
+  80346c:	89 c2                	mov    %eax,%edx
+  80346e:	c1 ea 16             	shr    $0x16,%edx
+  803471:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803478:	ba 00 00 00 00       	mov    $0x0,%edx
+  80347d:	f6 c1 01             	test   $0x1,%cl
+  803480:	74 22                	je     8034a4 <pageref+0x3e>
+  803482:	c1 e8 0c             	shr    $0xc,%eax
+  803485:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80348c:	a8 01                	test   $0x1,%al
+  80348e:	74 14                	je     8034a4 <pageref+0x3e>
+  803490:	c1 e8 0c             	shr    $0xc,%eax
+  803493:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803496:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80349d:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8034a1:	0f b7 d2             	movzwl %dx,%edx
+  8034a4:	89 d0                	mov    %edx,%eax
+  8034a6:	5d                   	pop    %ebp
+  8034a7:	c3                   	ret
+
+008034a8 <__udivmoddi4>:
+  8034a8:	55                   	push   %ebp
+  8034a9:	57                   	push   %edi
+  8034aa:	56                   	push   %esi
+  8034ab:	53                   	push   %ebx
+  8034ac:	83 ec 24             	sub    $0x24,%esp
+  8034af:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8034b3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8034b7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8034bb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8034bf:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8034c3:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8034c7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8034cb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8034cf:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8034d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034dd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8034e2:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8034e9:	00 
+  8034ea:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8034f1:	00 
+  8034f2:	89 fb                	mov    %edi,%ebx
+  8034f4:	eb 08                	jmp    8034fe <__udivmoddi4+0x56>
+  8034f6:	83 e9 01             	sub    $0x1,%ecx
+  8034f9:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8034fc:	74 68                	je     803566 <__udivmoddi4+0xbe>
+  8034fe:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803502:	01 c0                	add    %eax,%eax
+  803504:	89 c6                	mov    %eax,%esi
+  803506:	89 d7                	mov    %edx,%edi
+  803508:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80350c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803510:	0f ad d0             	shrd   %cl,%edx,%eax
+  803513:	d3 ea                	shr    %cl,%edx
+  803515:	f6 c1 20             	test   $0x20,%cl
+  803518:	74 04                	je     80351e <__udivmoddi4+0x76>
+  80351a:	89 d0                	mov    %edx,%eax
+  80351c:	31 d2                	xor    %edx,%edx
+  80351e:	83 e0 01             	and    $0x1,%eax
+  803521:	89 04 24             	mov    %eax,(%esp)
+  803524:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80352b:	00 
+  80352c:	8b 04 24             	mov    (%esp),%eax
+  80352f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803533:	09 f0                	or     %esi,%eax
+  803535:	09 fa                	or     %edi,%edx
+  803537:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80353b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80353f:	39 f0                	cmp    %esi,%eax
+  803541:	89 d5                	mov    %edx,%ebp
+  803543:	19 fd                	sbb    %edi,%ebp
+  803545:	72 af                	jb     8034f6 <__udivmoddi4+0x4e>
+  803547:	29 f0                	sub    %esi,%eax
+  803549:	19 fa                	sbb    %edi,%edx
+  80354b:	89 cf                	mov    %ecx,%edi
+  80354d:	c1 ef 05             	shr    $0x5,%edi
+  803550:	83 e7 01             	and    $0x1,%edi
+  803553:	89 fe                	mov    %edi,%esi
+  803555:	83 f6 01             	xor    $0x1,%esi
+  803558:	d3 e6                	shl    %cl,%esi
+  80355a:	d3 e7                	shl    %cl,%edi
+  80355c:	09 74 24 18          	or     %esi,0x18(%esp)
+  803560:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803564:	eb 90                	jmp    8034f6 <__udivmoddi4+0x4e>
+  803566:	85 db                	test   %ebx,%ebx
+  803568:	74 05                	je     80356f <__udivmoddi4+0xc7>
+  80356a:	89 03                	mov    %eax,(%ebx)
+  80356c:	89 53 04             	mov    %edx,0x4(%ebx)
+  80356f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803573:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803577:	83 c4 24             	add    $0x24,%esp
+  80357a:	5b                   	pop    %ebx
+  80357b:	5e                   	pop    %esi
+  80357c:	5f                   	pop    %edi
+  80357d:	5d                   	pop    %ebp
+  80357e:	c3                   	ret
+
+0080357f <__udivdi3>:
+  80357f:	83 ec 08             	sub    $0x8,%esp
+  803582:	6a 00                	push   $0x0
+  803584:	ff 74 24 1c          	push   0x1c(%esp)
+  803588:	ff 74 24 1c          	push   0x1c(%esp)
+  80358c:	ff 74 24 1c          	push   0x1c(%esp)
+  803590:	ff 74 24 1c          	push   0x1c(%esp)
+  803594:	e8 0f ff ff ff       	call   8034a8 <__udivmoddi4>
+  803599:	83 c4 1c             	add    $0x1c,%esp
+  80359c:	c3                   	ret
+
+0080359d <__umoddi3>:
+  80359d:	83 ec 18             	sub    $0x18,%esp
+  8035a0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8035a4:	50                   	push   %eax
+  8035a5:	ff 74 24 2c          	push   0x2c(%esp)
+  8035a9:	ff 74 24 2c          	push   0x2c(%esp)
+  8035ad:	ff 74 24 2c          	push   0x2c(%esp)
+  8035b1:	ff 74 24 2c          	push   0x2c(%esp)
+  8035b5:	e8 ee fe ff ff       	call   8034a8 <__udivmoddi4>
+  8035ba:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8035be:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8035c2:	83 c4 2c             	add    $0x2c,%esp
+  8035c5:	c3                   	ret
+
+008035c6 <__divdi3>:
+  8035c6:	53                   	push   %ebx
+  8035c7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035cb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035cf:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8035d3:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8035d7:	85 d2                	test   %edx,%edx
+  8035d9:	78 12                	js     8035ed <__divdi3+0x27>
+  8035db:	85 db                	test   %ebx,%ebx
+  8035dd:	78 2e                	js     80360d <__divdi3+0x47>
+  8035df:	53                   	push   %ebx
+  8035e0:	51                   	push   %ecx
+  8035e1:	52                   	push   %edx
+  8035e2:	50                   	push   %eax
+  8035e3:	e8 97 ff ff ff       	call   80357f <__udivdi3>
+  8035e8:	83 c4 10             	add    $0x10,%esp
+  8035eb:	eb 1e                	jmp    80360b <__divdi3+0x45>
+  8035ed:	f7 d8                	neg    %eax
+  8035ef:	83 d2 00             	adc    $0x0,%edx
+  8035f2:	f7 da                	neg    %edx
+  8035f4:	85 db                	test   %ebx,%ebx
+  8035f6:	78 2a                	js     803622 <__divdi3+0x5c>
+  8035f8:	53                   	push   %ebx
+  8035f9:	51                   	push   %ecx
+  8035fa:	52                   	push   %edx
+  8035fb:	50                   	push   %eax
+  8035fc:	e8 7e ff ff ff       	call   80357f <__udivdi3>
+  803601:	83 c4 10             	add    $0x10,%esp
+  803604:	f7 d8                	neg    %eax
+  803606:	83 d2 00             	adc    $0x0,%edx
+  803609:	f7 da                	neg    %edx
+  80360b:	5b                   	pop    %ebx
+  80360c:	c3                   	ret
+  80360d:	f7 d9                	neg    %ecx
+  80360f:	83 d3 00             	adc    $0x0,%ebx
+  803612:	f7 db                	neg    %ebx
+  803614:	53                   	push   %ebx
+  803615:	51                   	push   %ecx
+  803616:	52                   	push   %edx
+  803617:	50                   	push   %eax
+  803618:	e8 62 ff ff ff       	call   80357f <__udivdi3>
+  80361d:	83 c4 10             	add    $0x10,%esp
+  803620:	eb e2                	jmp    803604 <__divdi3+0x3e>
+  803622:	f7 d9                	neg    %ecx
+  803624:	83 d3 00             	adc    $0x0,%ebx
+  803627:	f7 db                	neg    %ebx
+  803629:	53                   	push   %ebx
+  80362a:	51                   	push   %ecx
+  80362b:	52                   	push   %edx
+  80362c:	50                   	push   %eax
+  80362d:	e8 4d ff ff ff       	call   80357f <__udivdi3>
+  803632:	83 c4 10             	add    $0x10,%esp
+  803635:	eb d4                	jmp    80360b <__divdi3+0x45>
+
+00803637 <__moddi3>:
+  803637:	55                   	push   %ebp
+  803638:	57                   	push   %edi
+  803639:	56                   	push   %esi
+  80363a:	53                   	push   %ebx
+  80363b:	83 ec 0c             	sub    $0xc,%esp
+  80363e:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803642:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803646:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80364a:	89 e9                	mov    %ebp,%ecx
+  80364c:	f7 d9                	neg    %ecx
+  80364e:	89 d0                	mov    %edx,%eax
+  803650:	83 d0 00             	adc    $0x0,%eax
+  803653:	f7 d8                	neg    %eax
+  803655:	0f 49 e9             	cmovns %ecx,%ebp
+  803658:	0f 49 d0             	cmovns %eax,%edx
+  80365b:	52                   	push   %edx
+  80365c:	55                   	push   %ebp
+  80365d:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803661:	f7 da                	neg    %edx
+  803663:	89 d8                	mov    %ebx,%eax
+  803665:	83 d0 00             	adc    $0x0,%eax
+  803668:	f7 d8                	neg    %eax
+  80366a:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80366f:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803673:	0f 48 c3             	cmovs  %ebx,%eax
+  803676:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  80367a:	ff 74 24 0c          	push   0xc(%esp)
+  80367e:	ff 74 24 0c          	push   0xc(%esp)
+  803682:	e8 16 ff ff ff       	call   80359d <__umoddi3>
+  803687:	83 c4 10             	add    $0x10,%esp
+  80368a:	85 db                	test   %ebx,%ebx
+  80368c:	78 08                	js     803696 <__moddi3+0x5f>
+  80368e:	83 c4 0c             	add    $0xc,%esp
+  803691:	5b                   	pop    %ebx
+  803692:	5e                   	pop    %esi
+  803693:	5f                   	pop    %edi
+  803694:	5d                   	pop    %ebp
+  803695:	c3                   	ret
+  803696:	f7 d8                	neg    %eax
+  803698:	83 d2 00             	adc    $0x0,%edx
+  80369b:	f7 da                	neg    %edx
+  80369d:	eb ef                	jmp    80368e <__moddi3+0x57>
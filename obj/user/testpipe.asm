@@ -0,0 +1,5715 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 a1 02 00 00       	call   8002d2 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+  80003b:	c7 05 04 50 80 00 40 	movl   $0x803a40,0x805004
+  800042:	3a 80 00 
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 1c 2f 00 00       	call   802f6a <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 1b 01 00 00    	js     800176 <umain+0x143>
+  80005b:	e8 6b 19 00 00       	call   8019cb <fork>
+  800060:	89 c3                	mov    %eax,%ebx
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 1e 01 00 00    	js     800188 <umain+0x155>
+  80006a:	0f 85 56 01 00 00    	jne    8001c6 <umain+0x193>
+  800070:	a1 14 60 80 00       	mov    0x806014,%eax
+  800075:	8b 40 48             	mov    0x48(%eax),%eax
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	ff 75 90             	push   -0x70(%ebp)
+  80007e:	50                   	push   %eax
+  80007f:	68 6e 3a 80 00       	push   $0x803a6e
+  800084:	e8 9d 03 00 00       	call   800426 <cprintf>
+  800089:	83 c4 04             	add    $0x4,%esp
+  80008c:	ff 75 90             	push   -0x70(%ebp)
+  80008f:	e8 25 1e 00 00       	call   801eb9 <close>
+  800094:	a1 14 60 80 00       	mov    0x806014,%eax
+  800099:	8b 40 48             	mov    0x48(%eax),%eax
+  80009c:	83 c4 0c             	add    $0xc,%esp
+  80009f:	ff 75 8c             	push   -0x74(%ebp)
+  8000a2:	50                   	push   %eax
+  8000a3:	68 8b 3a 80 00       	push   $0x803a8b
+  8000a8:	e8 79 03 00 00       	call   800426 <cprintf>
+  8000ad:	83 c4 0c             	add    $0xc,%esp
+  8000b0:	6a 63                	push   $0x63
+  8000b2:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000b5:	50                   	push   %eax
+  8000b6:	ff 75 8c             	push   -0x74(%ebp)
+  8000b9:	e8 be 1f 00 00       	call   80207c <readn>
+  8000be:	89 c6                	mov    %eax,%esi
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	0f 88 cf 00 00 00    	js     80019a <umain+0x167>
+  8000cb:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	ff 35 00 50 80 00    	push   0x805000
+  8000d9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	e8 eb 0a 00 00       	call   800bcd <strcmp>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	85 c0                	test   %eax,%eax
+  8000e7:	0f 85 bf 00 00 00    	jne    8001ac <umain+0x179>
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	68 b1 3a 80 00       	push   $0x803ab1
+  8000f5:	e8 2c 03 00 00       	call   800426 <cprintf>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+  8000fd:	e8 19 02 00 00       	call   80031b <exit>
+  800102:	83 ec 0c             	sub    $0xc,%esp
+  800105:	53                   	push   %ebx
+  800106:	e8 dc 2f 00 00       	call   8030e7 <wait>
+  80010b:	c7 05 04 50 80 00 07 	movl   $0x803b07,0x805004
+  800112:	3b 80 00 
+  800115:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800118:	89 04 24             	mov    %eax,(%esp)
+  80011b:	e8 4a 2e 00 00       	call   802f6a <pipe>
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 32 01 00 00    	js     80025f <umain+0x22c>
+  80012d:	e8 99 18 00 00       	call   8019cb <fork>
+  800132:	89 c3                	mov    %eax,%ebx
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 88 35 01 00 00    	js     800271 <umain+0x23e>
+  80013c:	0f 84 41 01 00 00    	je     800283 <umain+0x250>
+  800142:	83 ec 0c             	sub    $0xc,%esp
+  800145:	ff 75 8c             	push   -0x74(%ebp)
+  800148:	e8 6c 1d 00 00       	call   801eb9 <close>
+  80014d:	83 c4 04             	add    $0x4,%esp
+  800150:	ff 75 90             	push   -0x70(%ebp)
+  800153:	e8 61 1d 00 00       	call   801eb9 <close>
+  800158:	89 1c 24             	mov    %ebx,(%esp)
+  80015b:	e8 87 2f 00 00       	call   8030e7 <wait>
+  800160:	c7 04 24 35 3b 80 00 	movl   $0x803b35,(%esp)
+  800167:	e8 ba 02 00 00       	call   800426 <cprintf>
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+  800176:	50                   	push   %eax
+  800177:	68 4c 3a 80 00       	push   $0x803a4c
+  80017c:	6a 0e                	push   $0xe
+  80017e:	68 55 3a 80 00       	push   $0x803a55
+  800183:	e8 c3 01 00 00       	call   80034b <_panic>
+  800188:	56                   	push   %esi
+  800189:	68 65 3a 80 00       	push   $0x803a65
+  80018e:	6a 11                	push   $0x11
+  800190:	68 55 3a 80 00       	push   $0x803a55
+  800195:	e8 b1 01 00 00       	call   80034b <_panic>
+  80019a:	50                   	push   %eax
+  80019b:	68 a8 3a 80 00       	push   $0x803aa8
+  8001a0:	6a 19                	push   $0x19
+  8001a2:	68 55 3a 80 00       	push   $0x803a55
+  8001a7:	e8 9f 01 00 00       	call   80034b <_panic>
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	56                   	push   %esi
+  8001b4:	68 cd 3a 80 00       	push   $0x803acd
+  8001b9:	e8 68 02 00 00       	call   800426 <cprintf>
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	e9 37 ff ff ff       	jmp    8000fd <umain+0xca>
+  8001c6:	a1 14 60 80 00       	mov    0x806014,%eax
+  8001cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8001ce:	83 ec 04             	sub    $0x4,%esp
+  8001d1:	ff 75 8c             	push   -0x74(%ebp)
+  8001d4:	50                   	push   %eax
+  8001d5:	68 6e 3a 80 00       	push   $0x803a6e
+  8001da:	e8 47 02 00 00       	call   800426 <cprintf>
+  8001df:	83 c4 04             	add    $0x4,%esp
+  8001e2:	ff 75 8c             	push   -0x74(%ebp)
+  8001e5:	e8 cf 1c 00 00       	call   801eb9 <close>
+  8001ea:	a1 14 60 80 00       	mov    0x806014,%eax
+  8001ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	ff 75 90             	push   -0x70(%ebp)
+  8001f8:	50                   	push   %eax
+  8001f9:	68 e0 3a 80 00       	push   $0x803ae0
+  8001fe:	e8 23 02 00 00       	call   800426 <cprintf>
+  800203:	83 c4 04             	add    $0x4,%esp
+  800206:	ff 35 00 50 80 00    	push   0x805000
+  80020c:	e8 c0 08 00 00       	call   800ad1 <strlen>
+  800211:	83 c4 0c             	add    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	ff 35 00 50 80 00    	push   0x805000
+  80021b:	ff 75 90             	push   -0x70(%ebp)
+  80021e:	e8 ad 1e 00 00       	call   8020d0 <write>
+  800223:	89 c6                	mov    %eax,%esi
+  800225:	83 c4 04             	add    $0x4,%esp
+  800228:	ff 35 00 50 80 00    	push   0x805000
+  80022e:	e8 9e 08 00 00       	call   800ad1 <strlen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	39 f0                	cmp    %esi,%eax
+  800238:	75 13                	jne    80024d <umain+0x21a>
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	ff 75 90             	push   -0x70(%ebp)
+  800240:	e8 74 1c 00 00       	call   801eb9 <close>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	e9 b5 fe ff ff       	jmp    800102 <umain+0xcf>
+  80024d:	56                   	push   %esi
+  80024e:	68 fd 3a 80 00       	push   $0x803afd
+  800253:	6a 25                	push   $0x25
+  800255:	68 55 3a 80 00       	push   $0x803a55
+  80025a:	e8 ec 00 00 00       	call   80034b <_panic>
+  80025f:	50                   	push   %eax
+  800260:	68 4c 3a 80 00       	push   $0x803a4c
+  800265:	6a 2c                	push   $0x2c
+  800267:	68 55 3a 80 00       	push   $0x803a55
+  80026c:	e8 da 00 00 00       	call   80034b <_panic>
+  800271:	56                   	push   %esi
+  800272:	68 65 3a 80 00       	push   $0x803a65
+  800277:	6a 2f                	push   $0x2f
+  800279:	68 55 3a 80 00       	push   $0x803a55
+  80027e:	e8 c8 00 00 00       	call   80034b <_panic>
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	ff 75 8c             	push   -0x74(%ebp)
+  800289:	e8 2b 1c 00 00       	call   801eb9 <close>
+  80028e:	83 c4 10             	add    $0x10,%esp
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	68 14 3b 80 00       	push   $0x803b14
+  800299:	e8 88 01 00 00       	call   800426 <cprintf>
+  80029e:	83 c4 0c             	add    $0xc,%esp
+  8002a1:	6a 01                	push   $0x1
+  8002a3:	68 16 3b 80 00       	push   $0x803b16
+  8002a8:	ff 75 90             	push   -0x70(%ebp)
+  8002ab:	e8 20 1e 00 00       	call   8020d0 <write>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	83 f8 01             	cmp    $0x1,%eax
+  8002b6:	74 d9                	je     800291 <umain+0x25e>
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	68 18 3b 80 00       	push   $0x803b18
+  8002c0:	e8 61 01 00 00       	call   800426 <cprintf>
+  8002c5:	e8 51 00 00 00       	call   80031b <exit>
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	e9 70 fe ff ff       	jmp    800142 <umain+0x10f>
+
+008002d2 <libmain>:
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8002dd:	e8 31 0c 00 00       	call   800f13 <sys_getenvid>
+  8002e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e7:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8002ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f2:	a3 14 60 80 00       	mov    %eax,0x806014
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7e 07                	jle    800302 <libmain+0x30>
+  8002fb:	8b 06                	mov    (%esi),%eax
+  8002fd:	a3 04 50 80 00       	mov    %eax,0x805004
+  800302:	83 ec 08             	sub    $0x8,%esp
+  800305:	56                   	push   %esi
+  800306:	53                   	push   %ebx
+  800307:	e8 27 fd ff ff       	call   800033 <umain>
+  80030c:	e8 0a 00 00 00       	call   80031b <exit>
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800317:	5b                   	pop    %ebx
+  800318:	5e                   	pop    %esi
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+
+0080031b <exit>:
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	83 ec 08             	sub    $0x8,%esp
+  800321:	a1 14 60 80 00       	mov    0x806014,%eax
+  800326:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80032c:	85 c0                	test   %eax,%eax
+  80032e:	75 14                	jne    800344 <exit+0x29>
+  800330:	e8 b1 1b 00 00       	call   801ee6 <close_all>
+  800335:	83 ec 0c             	sub    $0xc,%esp
+  800338:	6a 00                	push   $0x0
+  80033a:	e8 93 0b 00 00       	call   800ed2 <sys_env_destroy>
+  80033f:	83 c4 10             	add    $0x10,%esp
+  800342:	c9                   	leave
+  800343:	c3                   	ret
+  800344:	e8 f6 12 00 00       	call   80163f <sys_lease_complete>
+  800349:	eb e5                	jmp    800330 <exit+0x15>
+
+0080034b <_panic>:
+  80034b:	55                   	push   %ebp
+  80034c:	89 e5                	mov    %esp,%ebp
+  80034e:	56                   	push   %esi
+  80034f:	53                   	push   %ebx
+  800350:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800353:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  800359:	e8 b5 0b 00 00       	call   800f13 <sys_getenvid>
+  80035e:	83 ec 0c             	sub    $0xc,%esp
+  800361:	ff 75 0c             	push   0xc(%ebp)
+  800364:	ff 75 08             	push   0x8(%ebp)
+  800367:	56                   	push   %esi
+  800368:	50                   	push   %eax
+  800369:	68 98 3b 80 00       	push   $0x803b98
+  80036e:	e8 b3 00 00 00       	call   800426 <cprintf>
+  800373:	83 c4 18             	add    $0x18,%esp
+  800376:	53                   	push   %ebx
+  800377:	ff 75 10             	push   0x10(%ebp)
+  80037a:	e8 56 00 00 00       	call   8003d5 <vcprintf>
+  80037f:	c7 04 24 89 3a 80 00 	movl   $0x803a89,(%esp)
+  800386:	e8 9b 00 00 00       	call   800426 <cprintf>
+  80038b:	83 c4 10             	add    $0x10,%esp
+  80038e:	cc                   	int3
+  80038f:	eb fd                	jmp    80038e <_panic+0x43>
+
+00800391 <putch>:
+  800391:	55                   	push   %ebp
+  800392:	89 e5                	mov    %esp,%ebp
+  800394:	53                   	push   %ebx
+  800395:	83 ec 04             	sub    $0x4,%esp
+  800398:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80039b:	8b 13                	mov    (%ebx),%edx
+  80039d:	8d 42 01             	lea    0x1(%edx),%eax
+  8003a0:	89 03                	mov    %eax,(%ebx)
+  8003a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003a5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8003a9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003ae:	74 09                	je     8003b9 <putch+0x28>
+  8003b0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8003b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003b7:	c9                   	leave
+  8003b8:	c3                   	ret
+  8003b9:	83 ec 08             	sub    $0x8,%esp
+  8003bc:	68 ff 00 00 00       	push   $0xff
+  8003c1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003c4:	50                   	push   %eax
+  8003c5:	e8 cb 0a 00 00       	call   800e95 <sys_cputs>
+  8003ca:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003d0:	83 c4 10             	add    $0x10,%esp
+  8003d3:	eb db                	jmp    8003b0 <putch+0x1f>
+
+008003d5 <vcprintf>:
+  8003d5:	55                   	push   %ebp
+  8003d6:	89 e5                	mov    %esp,%ebp
+  8003d8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8003de:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003e5:	00 00 00 
+  8003e8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003ef:	00 00 00 
+  8003f2:	ff 75 0c             	push   0xc(%ebp)
+  8003f5:	ff 75 08             	push   0x8(%ebp)
+  8003f8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003fe:	50                   	push   %eax
+  8003ff:	68 91 03 80 00       	push   $0x800391
+  800404:	e8 1c 01 00 00       	call   800525 <vprintfmt>
+  800409:	83 c4 08             	add    $0x8,%esp
+  80040c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800412:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800418:	50                   	push   %eax
+  800419:	e8 77 0a 00 00       	call   800e95 <sys_cputs>
+  80041e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800424:	c9                   	leave
+  800425:	c3                   	ret
+
+00800426 <cprintf>:
+  800426:	55                   	push   %ebp
+  800427:	89 e5                	mov    %esp,%ebp
+  800429:	83 ec 10             	sub    $0x10,%esp
+  80042c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80042f:	50                   	push   %eax
+  800430:	ff 75 08             	push   0x8(%ebp)
+  800433:	e8 9d ff ff ff       	call   8003d5 <vcprintf>
+  800438:	c9                   	leave
+  800439:	c3                   	ret
+
+0080043a <printnum>:
+  80043a:	55                   	push   %ebp
+  80043b:	89 e5                	mov    %esp,%ebp
+  80043d:	57                   	push   %edi
+  80043e:	56                   	push   %esi
+  80043f:	53                   	push   %ebx
+  800440:	83 ec 1c             	sub    $0x1c,%esp
+  800443:	89 c3                	mov    %eax,%ebx
+  800445:	89 d6                	mov    %edx,%esi
+  800447:	8b 45 08             	mov    0x8(%ebp),%eax
+  80044a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80044d:	89 d1                	mov    %edx,%ecx
+  80044f:	89 c2                	mov    %eax,%edx
+  800451:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800454:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800457:	8b 45 10             	mov    0x10(%ebp),%eax
+  80045a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800464:	39 c2                	cmp    %eax,%edx
+  800466:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800469:	73 4b                	jae    8004b6 <printnum+0x7c>
+  80046b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046e:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800471:	85 ff                	test   %edi,%edi
+  800473:	7e 11                	jle    800486 <printnum+0x4c>
+  800475:	83 ec 08             	sub    $0x8,%esp
+  800478:	56                   	push   %esi
+  800479:	ff 75 18             	push   0x18(%ebp)
+  80047c:	ff d3                	call   *%ebx
+  80047e:	83 c4 10             	add    $0x10,%esp
+  800481:	83 ef 01             	sub    $0x1,%edi
+  800484:	75 ef                	jne    800475 <printnum+0x3b>
+  800486:	83 ec 08             	sub    $0x8,%esp
+  800489:	56                   	push   %esi
+  80048a:	83 ec 04             	sub    $0x4,%esp
+  80048d:	ff 75 e4             	push   -0x1c(%ebp)
+  800490:	ff 75 e0             	push   -0x20(%ebp)
+  800493:	ff 75 dc             	push   -0x24(%ebp)
+  800496:	ff 75 d8             	push   -0x28(%ebp)
+  800499:	e8 86 34 00 00       	call   803924 <__umoddi3>
+  80049e:	83 c4 14             	add    $0x14,%esp
+  8004a1:	0f be 80 bb 3b 80 00 	movsbl 0x803bbb(%eax),%eax
+  8004a8:	50                   	push   %eax
+  8004a9:	ff d3                	call   *%ebx
+  8004ab:	83 c4 10             	add    $0x10,%esp
+  8004ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b1:	5b                   	pop    %ebx
+  8004b2:	5e                   	pop    %esi
+  8004b3:	5f                   	pop    %edi
+  8004b4:	5d                   	pop    %ebp
+  8004b5:	c3                   	ret
+  8004b6:	83 ec 0c             	sub    $0xc,%esp
+  8004b9:	ff 75 18             	push   0x18(%ebp)
+  8004bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004bf:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004c2:	52                   	push   %edx
+  8004c3:	50                   	push   %eax
+  8004c4:	83 ec 08             	sub    $0x8,%esp
+  8004c7:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ca:	ff 75 e0             	push   -0x20(%ebp)
+  8004cd:	ff 75 dc             	push   -0x24(%ebp)
+  8004d0:	ff 75 d8             	push   -0x28(%ebp)
+  8004d3:	e8 2e 34 00 00       	call   803906 <__udivdi3>
+  8004d8:	83 c4 18             	add    $0x18,%esp
+  8004db:	52                   	push   %edx
+  8004dc:	50                   	push   %eax
+  8004dd:	89 f2                	mov    %esi,%edx
+  8004df:	89 d8                	mov    %ebx,%eax
+  8004e1:	e8 54 ff ff ff       	call   80043a <printnum>
+  8004e6:	83 c4 20             	add    $0x20,%esp
+  8004e9:	eb 9b                	jmp    800486 <printnum+0x4c>
+
+008004eb <sprintputch>:
+  8004eb:	55                   	push   %ebp
+  8004ec:	89 e5                	mov    %esp,%ebp
+  8004ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004f1:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8004f5:	8b 10                	mov    (%eax),%edx
+  8004f7:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004fa:	73 0a                	jae    800506 <sprintputch+0x1b>
+  8004fc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004ff:	89 08                	mov    %ecx,(%eax)
+  800501:	8b 45 08             	mov    0x8(%ebp),%eax
+  800504:	88 02                	mov    %al,(%edx)
+  800506:	5d                   	pop    %ebp
+  800507:	c3                   	ret
+
+00800508 <printfmt>:
+  800508:	55                   	push   %ebp
+  800509:	89 e5                	mov    %esp,%ebp
+  80050b:	83 ec 08             	sub    $0x8,%esp
+  80050e:	8d 45 14             	lea    0x14(%ebp),%eax
+  800511:	50                   	push   %eax
+  800512:	ff 75 10             	push   0x10(%ebp)
+  800515:	ff 75 0c             	push   0xc(%ebp)
+  800518:	ff 75 08             	push   0x8(%ebp)
+  80051b:	e8 05 00 00 00       	call   800525 <vprintfmt>
+  800520:	83 c4 10             	add    $0x10,%esp
+  800523:	c9                   	leave
+  800524:	c3                   	ret
+
+00800525 <vprintfmt>:
+  800525:	55                   	push   %ebp
+  800526:	89 e5                	mov    %esp,%ebp
+  800528:	57                   	push   %edi
+  800529:	56                   	push   %esi
+  80052a:	53                   	push   %ebx
+  80052b:	83 ec 2c             	sub    $0x2c,%esp
+  80052e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800531:	89 df                	mov    %ebx,%edi
+  800533:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800536:	8b 45 10             	mov    0x10(%ebp),%eax
+  800539:	8d 70 01             	lea    0x1(%eax),%esi
+  80053c:	0f b6 00             	movzbl (%eax),%eax
+  80053f:	83 f8 25             	cmp    $0x25,%eax
+  800542:	74 1e                	je     800562 <vprintfmt+0x3d>
+  800544:	85 c0                	test   %eax,%eax
+  800546:	0f 84 15 05 00 00    	je     800a61 <vprintfmt+0x53c>
+  80054c:	83 ec 08             	sub    $0x8,%esp
+  80054f:	53                   	push   %ebx
+  800550:	50                   	push   %eax
+  800551:	ff d7                	call   *%edi
+  800553:	83 c6 01             	add    $0x1,%esi
+  800556:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80055a:	83 c4 10             	add    $0x10,%esp
+  80055d:	83 f8 25             	cmp    $0x25,%eax
+  800560:	75 e2                	jne    800544 <vprintfmt+0x1f>
+  800562:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800566:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80056d:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800574:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80057b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800580:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800583:	8d 56 01             	lea    0x1(%esi),%edx
+  800586:	0f b6 0e             	movzbl (%esi),%ecx
+  800589:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80058c:	3c 55                	cmp    $0x55,%al
+  80058e:	0f 87 3b 04 00 00    	ja     8009cf <vprintfmt+0x4aa>
+  800594:	0f b6 c0             	movzbl %al,%eax
+  800597:	ff 24 85 00 3d 80 00 	jmp    *0x803d00(,%eax,4)
+  80059e:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005a1:	eb 93                	jmp    800536 <vprintfmt+0x11>
+  8005a3:	89 d6                	mov    %edx,%esi
+  8005a5:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005a9:	eb d8                	jmp    800583 <vprintfmt+0x5e>
+  8005ab:	89 d6                	mov    %edx,%esi
+  8005ad:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005b1:	eb d0                	jmp    800583 <vprintfmt+0x5e>
+  8005b3:	0f b6 c9             	movzbl %cl,%ecx
+  8005b6:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8005bc:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8005c0:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005c3:	83 f9 09             	cmp    $0x9,%ecx
+  8005c6:	77 6f                	ja     800637 <vprintfmt+0x112>
+  8005c8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8005cb:	83 c2 01             	add    $0x1,%edx
+  8005ce:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8005d1:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8005d5:	0f be 02             	movsbl (%edx),%eax
+  8005d8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005db:	83 fe 09             	cmp    $0x9,%esi
+  8005de:	76 eb                	jbe    8005cb <vprintfmt+0xa6>
+  8005e0:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8005e3:	89 d6                	mov    %edx,%esi
+  8005e5:	eb 13                	jmp    8005fa <vprintfmt+0xd5>
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 00                	mov    (%eax),%eax
+  8005ec:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8005ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f8:	89 d6                	mov    %edx,%esi
+  8005fa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005fe:	79 83                	jns    800583 <vprintfmt+0x5e>
+  800600:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800603:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800606:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80060d:	e9 71 ff ff ff       	jmp    800583 <vprintfmt+0x5e>
+  800612:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800615:	85 c9                	test   %ecx,%ecx
+  800617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061c:	0f 49 c1             	cmovns %ecx,%eax
+  80061f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800622:	89 d6                	mov    %edx,%esi
+  800624:	e9 5a ff ff ff       	jmp    800583 <vprintfmt+0x5e>
+  800629:	89 d6                	mov    %edx,%esi
+  80062b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800632:	e9 4c ff ff ff       	jmp    800583 <vprintfmt+0x5e>
+  800637:	89 d6                	mov    %edx,%esi
+  800639:	eb bf                	jmp    8005fa <vprintfmt+0xd5>
+  80063b:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80063f:	89 d6                	mov    %edx,%esi
+  800641:	e9 3d ff ff ff       	jmp    800583 <vprintfmt+0x5e>
+  800646:	89 55 10             	mov    %edx,0x10(%ebp)
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8d 70 04             	lea    0x4(%eax),%esi
+  80064f:	83 ec 08             	sub    $0x8,%esp
+  800652:	53                   	push   %ebx
+  800653:	ff 30                	push   (%eax)
+  800655:	ff d7                	call   *%edi
+  800657:	83 c4 10             	add    $0x10,%esp
+  80065a:	89 75 14             	mov    %esi,0x14(%ebp)
+  80065d:	e9 d4 fe ff ff       	jmp    800536 <vprintfmt+0x11>
+  800662:	89 55 10             	mov    %edx,0x10(%ebp)
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8d 70 04             	lea    0x4(%eax),%esi
+  80066b:	8b 10                	mov    (%eax),%edx
+  80066d:	89 d0                	mov    %edx,%eax
+  80066f:	f7 d8                	neg    %eax
+  800671:	0f 48 c2             	cmovs  %edx,%eax
+  800674:	83 f8 12             	cmp    $0x12,%eax
+  800677:	7f 23                	jg     80069c <vprintfmt+0x177>
+  800679:	8b 14 85 60 3e 80 00 	mov    0x803e60(,%eax,4),%edx
+  800680:	85 d2                	test   %edx,%edx
+  800682:	74 18                	je     80069c <vprintfmt+0x177>
+  800684:	52                   	push   %edx
+  800685:	68 a3 40 80 00       	push   $0x8040a3
+  80068a:	53                   	push   %ebx
+  80068b:	57                   	push   %edi
+  80068c:	e8 77 fe ff ff       	call   800508 <printfmt>
+  800691:	83 c4 10             	add    $0x10,%esp
+  800694:	89 75 14             	mov    %esi,0x14(%ebp)
+  800697:	e9 9a fe ff ff       	jmp    800536 <vprintfmt+0x11>
+  80069c:	50                   	push   %eax
+  80069d:	68 d3 3b 80 00       	push   $0x803bd3
+  8006a2:	53                   	push   %ebx
+  8006a3:	57                   	push   %edi
+  8006a4:	e8 5f fe ff ff       	call   800508 <printfmt>
+  8006a9:	83 c4 10             	add    $0x10,%esp
+  8006ac:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006af:	e9 82 fe ff ff       	jmp    800536 <vprintfmt+0x11>
+  8006b4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	83 c0 04             	add    $0x4,%eax
+  8006bd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8b 00                	mov    (%eax),%eax
+  8006c5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c8:	85 c0                	test   %eax,%eax
+  8006ca:	0f 84 61 03 00 00    	je     800a31 <vprintfmt+0x50c>
+  8006d0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006d4:	7e 06                	jle    8006dc <vprintfmt+0x1b7>
+  8006d6:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8006da:	75 29                	jne    800705 <vprintfmt+0x1e0>
+  8006dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006df:	8d 70 01             	lea    0x1(%eax),%esi
+  8006e2:	0f b6 00             	movzbl (%eax),%eax
+  8006e5:	0f be d0             	movsbl %al,%edx
+  8006e8:	85 d2                	test   %edx,%edx
+  8006ea:	0f 84 bb 00 00 00    	je     8007ab <vprintfmt+0x286>
+  8006f0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006f3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006f6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006f9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006fc:	eb 7a                	jmp    800778 <vprintfmt+0x253>
+  8006fe:	c7 45 d0 cc 3b 80 00 	movl   $0x803bcc,-0x30(%ebp)
+  800705:	83 ec 08             	sub    $0x8,%esp
+  800708:	ff 75 d4             	push   -0x2c(%ebp)
+  80070b:	ff 75 d0             	push   -0x30(%ebp)
+  80070e:	e8 e0 03 00 00       	call   800af3 <strnlen>
+  800713:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800716:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	85 d2                	test   %edx,%edx
+  80071e:	0f 8e d6 02 00 00    	jle    8009fa <vprintfmt+0x4d5>
+  800724:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800728:	83 ec 08             	sub    $0x8,%esp
+  80072b:	53                   	push   %ebx
+  80072c:	56                   	push   %esi
+  80072d:	ff d7                	call   *%edi
+  80072f:	83 c4 10             	add    $0x10,%esp
+  800732:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800736:	75 f0                	jne    800728 <vprintfmt+0x203>
+  800738:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80073b:	8d 70 01             	lea    0x1(%eax),%esi
+  80073e:	0f b6 00             	movzbl (%eax),%eax
+  800741:	0f be d0             	movsbl %al,%edx
+  800744:	85 d2                	test   %edx,%edx
+  800746:	0f 84 da 02 00 00    	je     800a26 <vprintfmt+0x501>
+  80074c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80074f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800752:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800755:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800758:	eb 1e                	jmp    800778 <vprintfmt+0x253>
+  80075a:	83 ec 08             	sub    $0x8,%esp
+  80075d:	ff 75 0c             	push   0xc(%ebp)
+  800760:	52                   	push   %edx
+  800761:	ff 55 08             	call   *0x8(%ebp)
+  800764:	83 c4 10             	add    $0x10,%esp
+  800767:	83 eb 01             	sub    $0x1,%ebx
+  80076a:	83 c6 01             	add    $0x1,%esi
+  80076d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800771:	0f be d0             	movsbl %al,%edx
+  800774:	85 d2                	test   %edx,%edx
+  800776:	74 2a                	je     8007a2 <vprintfmt+0x27d>
+  800778:	85 ff                	test   %edi,%edi
+  80077a:	78 05                	js     800781 <vprintfmt+0x25c>
+  80077c:	83 ef 01             	sub    $0x1,%edi
+  80077f:	78 59                	js     8007da <vprintfmt+0x2b5>
+  800781:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800785:	74 d3                	je     80075a <vprintfmt+0x235>
+  800787:	0f be c0             	movsbl %al,%eax
+  80078a:	83 e8 20             	sub    $0x20,%eax
+  80078d:	83 f8 5e             	cmp    $0x5e,%eax
+  800790:	76 c8                	jbe    80075a <vprintfmt+0x235>
+  800792:	83 ec 08             	sub    $0x8,%esp
+  800795:	ff 75 0c             	push   0xc(%ebp)
+  800798:	6a 3f                	push   $0x3f
+  80079a:	ff 55 08             	call   *0x8(%ebp)
+  80079d:	83 c4 10             	add    $0x10,%esp
+  8007a0:	eb c5                	jmp    800767 <vprintfmt+0x242>
+  8007a2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007ab:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007ae:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007b2:	7e 1b                	jle    8007cf <vprintfmt+0x2aa>
+  8007b4:	83 ec 08             	sub    $0x8,%esp
+  8007b7:	53                   	push   %ebx
+  8007b8:	6a 20                	push   $0x20
+  8007ba:	ff d7                	call   *%edi
+  8007bc:	83 c4 10             	add    $0x10,%esp
+  8007bf:	83 ee 01             	sub    $0x1,%esi
+  8007c2:	75 f0                	jne    8007b4 <vprintfmt+0x28f>
+  8007c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ca:	e9 67 fd ff ff       	jmp    800536 <vprintfmt+0x11>
+  8007cf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d5:	e9 5c fd ff ff       	jmp    800536 <vprintfmt+0x11>
+  8007da:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007e3:	eb c6                	jmp    8007ab <vprintfmt+0x286>
+  8007e5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007e8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007eb:	83 f9 01             	cmp    $0x1,%ecx
+  8007ee:	7f 1f                	jg     80080f <vprintfmt+0x2ea>
+  8007f0:	85 c9                	test   %ecx,%ecx
+  8007f2:	74 67                	je     80085b <vprintfmt+0x336>
+  8007f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f7:	8b 30                	mov    (%eax),%esi
+  8007f9:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007fc:	89 f0                	mov    %esi,%eax
+  8007fe:	c1 f8 1f             	sar    $0x1f,%eax
+  800801:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800804:	8b 45 14             	mov    0x14(%ebp),%eax
+  800807:	8d 40 04             	lea    0x4(%eax),%eax
+  80080a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080d:	eb 17                	jmp    800826 <vprintfmt+0x301>
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8b 50 04             	mov    0x4(%eax),%edx
+  800815:	8b 00                	mov    (%eax),%eax
+  800817:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80081a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80081d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800820:	8d 40 08             	lea    0x8(%eax),%eax
+  800823:	89 45 14             	mov    %eax,0x14(%ebp)
+  800826:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800829:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80082c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800831:	85 c9                	test   %ecx,%ecx
+  800833:	0f 89 12 01 00 00    	jns    80094b <vprintfmt+0x426>
+  800839:	83 ec 08             	sub    $0x8,%esp
+  80083c:	53                   	push   %ebx
+  80083d:	6a 2d                	push   $0x2d
+  80083f:	ff d7                	call   *%edi
+  800841:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800844:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800847:	f7 da                	neg    %edx
+  800849:	83 d1 00             	adc    $0x0,%ecx
+  80084c:	f7 d9                	neg    %ecx
+  80084e:	83 c4 10             	add    $0x10,%esp
+  800851:	be 0a 00 00 00       	mov    $0xa,%esi
+  800856:	e9 f0 00 00 00       	jmp    80094b <vprintfmt+0x426>
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 30                	mov    (%eax),%esi
+  800860:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800863:	89 f0                	mov    %esi,%eax
+  800865:	c1 f8 1f             	sar    $0x1f,%eax
+  800868:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80086b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086e:	8d 40 04             	lea    0x4(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+  800874:	eb b0                	jmp    800826 <vprintfmt+0x301>
+  800876:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800879:	89 55 10             	mov    %edx,0x10(%ebp)
+  80087c:	83 f9 01             	cmp    $0x1,%ecx
+  80087f:	7f 1e                	jg     80089f <vprintfmt+0x37a>
+  800881:	85 c9                	test   %ecx,%ecx
+  800883:	74 32                	je     8008b7 <vprintfmt+0x392>
+  800885:	8b 45 14             	mov    0x14(%ebp),%eax
+  800888:	8b 10                	mov    (%eax),%edx
+  80088a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088f:	8d 40 04             	lea    0x4(%eax),%eax
+  800892:	89 45 14             	mov    %eax,0x14(%ebp)
+  800895:	be 0a 00 00 00       	mov    $0xa,%esi
+  80089a:	e9 ac 00 00 00       	jmp    80094b <vprintfmt+0x426>
+  80089f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a2:	8b 10                	mov    (%eax),%edx
+  8008a4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8008aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ad:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008b2:	e9 94 00 00 00       	jmp    80094b <vprintfmt+0x426>
+  8008b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ba:	8b 10                	mov    (%eax),%edx
+  8008bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008cc:	eb 7d                	jmp    80094b <vprintfmt+0x426>
+  8008ce:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008d1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008d4:	83 f9 01             	cmp    $0x1,%ecx
+  8008d7:	7f 1b                	jg     8008f4 <vprintfmt+0x3cf>
+  8008d9:	85 c9                	test   %ecx,%ecx
+  8008db:	74 2c                	je     800909 <vprintfmt+0x3e4>
+  8008dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e0:	8b 10                	mov    (%eax),%edx
+  8008e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ed:	be 08 00 00 00       	mov    $0x8,%esi
+  8008f2:	eb 57                	jmp    80094b <vprintfmt+0x426>
+  8008f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f7:	8b 10                	mov    (%eax),%edx
+  8008f9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008fc:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ff:	89 45 14             	mov    %eax,0x14(%ebp)
+  800902:	be 08 00 00 00       	mov    $0x8,%esi
+  800907:	eb 42                	jmp    80094b <vprintfmt+0x426>
+  800909:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090c:	8b 10                	mov    (%eax),%edx
+  80090e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800913:	8d 40 04             	lea    0x4(%eax),%eax
+  800916:	89 45 14             	mov    %eax,0x14(%ebp)
+  800919:	be 08 00 00 00       	mov    $0x8,%esi
+  80091e:	eb 2b                	jmp    80094b <vprintfmt+0x426>
+  800920:	89 55 10             	mov    %edx,0x10(%ebp)
+  800923:	83 ec 08             	sub    $0x8,%esp
+  800926:	53                   	push   %ebx
+  800927:	6a 30                	push   $0x30
+  800929:	ff d7                	call   *%edi
+  80092b:	83 c4 08             	add    $0x8,%esp
+  80092e:	53                   	push   %ebx
+  80092f:	6a 78                	push   $0x78
+  800931:	ff d7                	call   *%edi
+  800933:	8b 45 14             	mov    0x14(%ebp),%eax
+  800936:	8b 10                	mov    (%eax),%edx
+  800938:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80093d:	83 c4 10             	add    $0x10,%esp
+  800940:	8d 40 04             	lea    0x4(%eax),%eax
+  800943:	89 45 14             	mov    %eax,0x14(%ebp)
+  800946:	be 10 00 00 00       	mov    $0x10,%esi
+  80094b:	83 ec 0c             	sub    $0xc,%esp
+  80094e:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800952:	50                   	push   %eax
+  800953:	ff 75 e4             	push   -0x1c(%ebp)
+  800956:	56                   	push   %esi
+  800957:	51                   	push   %ecx
+  800958:	52                   	push   %edx
+  800959:	89 da                	mov    %ebx,%edx
+  80095b:	89 f8                	mov    %edi,%eax
+  80095d:	e8 d8 fa ff ff       	call   80043a <printnum>
+  800962:	83 c4 20             	add    $0x20,%esp
+  800965:	e9 cc fb ff ff       	jmp    800536 <vprintfmt+0x11>
+  80096a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80096d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800970:	83 f9 01             	cmp    $0x1,%ecx
+  800973:	7f 1b                	jg     800990 <vprintfmt+0x46b>
+  800975:	85 c9                	test   %ecx,%ecx
+  800977:	74 2c                	je     8009a5 <vprintfmt+0x480>
+  800979:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097c:	8b 10                	mov    (%eax),%edx
+  80097e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800983:	8d 40 04             	lea    0x4(%eax),%eax
+  800986:	89 45 14             	mov    %eax,0x14(%ebp)
+  800989:	be 10 00 00 00       	mov    $0x10,%esi
+  80098e:	eb bb                	jmp    80094b <vprintfmt+0x426>
+  800990:	8b 45 14             	mov    0x14(%ebp),%eax
+  800993:	8b 10                	mov    (%eax),%edx
+  800995:	8b 48 04             	mov    0x4(%eax),%ecx
+  800998:	8d 40 08             	lea    0x8(%eax),%eax
+  80099b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80099e:	be 10 00 00 00       	mov    $0x10,%esi
+  8009a3:	eb a6                	jmp    80094b <vprintfmt+0x426>
+  8009a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a8:	8b 10                	mov    (%eax),%edx
+  8009aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009af:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009b5:	be 10 00 00 00       	mov    $0x10,%esi
+  8009ba:	eb 8f                	jmp    80094b <vprintfmt+0x426>
+  8009bc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009bf:	83 ec 08             	sub    $0x8,%esp
+  8009c2:	53                   	push   %ebx
+  8009c3:	6a 25                	push   $0x25
+  8009c5:	ff d7                	call   *%edi
+  8009c7:	83 c4 10             	add    $0x10,%esp
+  8009ca:	e9 67 fb ff ff       	jmp    800536 <vprintfmt+0x11>
+  8009cf:	83 ec 08             	sub    $0x8,%esp
+  8009d2:	53                   	push   %ebx
+  8009d3:	6a 25                	push   $0x25
+  8009d5:	ff d7                	call   *%edi
+  8009d7:	83 c4 10             	add    $0x10,%esp
+  8009da:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8009de:	0f 84 ba fb ff ff    	je     80059e <vprintfmt+0x79>
+  8009e4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8009e7:	89 f0                	mov    %esi,%eax
+  8009e9:	83 e8 01             	sub    $0x1,%eax
+  8009ec:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009f0:	75 f7                	jne    8009e9 <vprintfmt+0x4c4>
+  8009f2:	89 45 10             	mov    %eax,0x10(%ebp)
+  8009f5:	e9 3c fb ff ff       	jmp    800536 <vprintfmt+0x11>
+  8009fa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009fd:	8d 70 01             	lea    0x1(%eax),%esi
+  800a00:	0f b6 00             	movzbl (%eax),%eax
+  800a03:	0f be d0             	movsbl %al,%edx
+  800a06:	85 d2                	test   %edx,%edx
+  800a08:	74 11                	je     800a1b <vprintfmt+0x4f6>
+  800a0a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a0d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a10:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a13:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a16:	e9 5d fd ff ff       	jmp    800778 <vprintfmt+0x253>
+  800a1b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a1e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a21:	e9 10 fb ff ff       	jmp    800536 <vprintfmt+0x11>
+  800a26:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a29:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a2c:	e9 05 fb ff ff       	jmp    800536 <vprintfmt+0x11>
+  800a31:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a35:	7e 0a                	jle    800a41 <vprintfmt+0x51c>
+  800a37:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a3b:	0f 85 bd fc ff ff    	jne    8006fe <vprintfmt+0x1d9>
+  800a41:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a46:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a4b:	be cd 3b 80 00       	mov    $0x803bcd,%esi
+  800a50:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a53:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a56:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a59:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a5c:	e9 17 fd ff ff       	jmp    800778 <vprintfmt+0x253>
+  800a61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a64:	5b                   	pop    %ebx
+  800a65:	5e                   	pop    %esi
+  800a66:	5f                   	pop    %edi
+  800a67:	5d                   	pop    %ebp
+  800a68:	c3                   	ret
+
+00800a69 <vsnprintf>:
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	83 ec 18             	sub    $0x18,%esp
+  800a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a75:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a78:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a7c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a7f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a86:	85 c0                	test   %eax,%eax
+  800a88:	74 26                	je     800ab0 <vsnprintf+0x47>
+  800a8a:	85 d2                	test   %edx,%edx
+  800a8c:	7e 22                	jle    800ab0 <vsnprintf+0x47>
+  800a8e:	ff 75 14             	push   0x14(%ebp)
+  800a91:	ff 75 10             	push   0x10(%ebp)
+  800a94:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a97:	50                   	push   %eax
+  800a98:	68 eb 04 80 00       	push   $0x8004eb
+  800a9d:	e8 83 fa ff ff       	call   800525 <vprintfmt>
+  800aa2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800aa5:	c6 00 00             	movb   $0x0,(%eax)
+  800aa8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aab:	83 c4 10             	add    $0x10,%esp
+  800aae:	c9                   	leave
+  800aaf:	c3                   	ret
+  800ab0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab5:	eb f7                	jmp    800aae <vsnprintf+0x45>
+
+00800ab7 <snprintf>:
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	83 ec 08             	sub    $0x8,%esp
+  800abd:	8d 45 14             	lea    0x14(%ebp),%eax
+  800ac0:	50                   	push   %eax
+  800ac1:	ff 75 10             	push   0x10(%ebp)
+  800ac4:	ff 75 0c             	push   0xc(%ebp)
+  800ac7:	ff 75 08             	push   0x8(%ebp)
+  800aca:	e8 9a ff ff ff       	call   800a69 <vsnprintf>
+  800acf:	c9                   	leave
+  800ad0:	c3                   	ret
+
+00800ad1 <strlen>:
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad7:	80 3a 00             	cmpb   $0x0,(%edx)
+  800ada:	74 10                	je     800aec <strlen+0x1b>
+  800adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae1:	83 c0 01             	add    $0x1,%eax
+  800ae4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ae8:	75 f7                	jne    800ae1 <strlen+0x10>
+  800aea:	5d                   	pop    %ebp
+  800aeb:	c3                   	ret
+  800aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af1:	eb f7                	jmp    800aea <strlen+0x19>
+
+00800af3 <strnlen>:
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800afc:	85 d2                	test   %edx,%edx
+  800afe:	74 16                	je     800b16 <strnlen+0x23>
+  800b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b05:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b09:	74 09                	je     800b14 <strnlen+0x21>
+  800b0b:	83 c0 01             	add    $0x1,%eax
+  800b0e:	39 d0                	cmp    %edx,%eax
+  800b10:	75 f3                	jne    800b05 <strnlen+0x12>
+  800b12:	89 d0                	mov    %edx,%eax
+  800b14:	5d                   	pop    %ebp
+  800b15:	c3                   	ret
+  800b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1b:	eb f7                	jmp    800b14 <strnlen+0x21>
+
+00800b1d <strcpy>:
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	53                   	push   %ebx
+  800b21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b24:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b30:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b33:	83 c0 01             	add    $0x1,%eax
+  800b36:	84 d2                	test   %dl,%dl
+  800b38:	75 f2                	jne    800b2c <strcpy+0xf>
+  800b3a:	89 c8                	mov    %ecx,%eax
+  800b3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b3f:	c9                   	leave
+  800b40:	c3                   	ret
+
+00800b41 <strcat>:
+  800b41:	55                   	push   %ebp
+  800b42:	89 e5                	mov    %esp,%ebp
+  800b44:	53                   	push   %ebx
+  800b45:	83 ec 10             	sub    $0x10,%esp
+  800b48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b4b:	53                   	push   %ebx
+  800b4c:	e8 80 ff ff ff       	call   800ad1 <strlen>
+  800b51:	83 c4 08             	add    $0x8,%esp
+  800b54:	ff 75 0c             	push   0xc(%ebp)
+  800b57:	01 d8                	add    %ebx,%eax
+  800b59:	50                   	push   %eax
+  800b5a:	e8 be ff ff ff       	call   800b1d <strcpy>
+  800b5f:	89 d8                	mov    %ebx,%eax
+  800b61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b64:	c9                   	leave
+  800b65:	c3                   	ret
+
+00800b66 <strncpy>:
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	56                   	push   %esi
+  800b6a:	53                   	push   %ebx
+  800b6b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b74:	85 db                	test   %ebx,%ebx
+  800b76:	74 17                	je     800b8f <strncpy+0x29>
+  800b78:	01 f3                	add    %esi,%ebx
+  800b7a:	89 f0                	mov    %esi,%eax
+  800b7c:	83 c0 01             	add    $0x1,%eax
+  800b7f:	0f b6 0a             	movzbl (%edx),%ecx
+  800b82:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b85:	80 f9 01             	cmp    $0x1,%cl
+  800b88:	83 da ff             	sbb    $0xffffffff,%edx
+  800b8b:	39 c3                	cmp    %eax,%ebx
+  800b8d:	75 ed                	jne    800b7c <strncpy+0x16>
+  800b8f:	89 f0                	mov    %esi,%eax
+  800b91:	5b                   	pop    %ebx
+  800b92:	5e                   	pop    %esi
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+
+00800b95 <strlcpy>:
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	56                   	push   %esi
+  800b99:	53                   	push   %ebx
+  800b9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ba3:	89 f0                	mov    %esi,%eax
+  800ba5:	85 db                	test   %ebx,%ebx
+  800ba7:	74 1e                	je     800bc7 <strlcpy+0x32>
+  800ba9:	83 eb 01             	sub    $0x1,%ebx
+  800bac:	74 16                	je     800bc4 <strlcpy+0x2f>
+  800bae:	01 f3                	add    %esi,%ebx
+  800bb0:	0f b6 0a             	movzbl (%edx),%ecx
+  800bb3:	84 c9                	test   %cl,%cl
+  800bb5:	74 0d                	je     800bc4 <strlcpy+0x2f>
+  800bb7:	83 c2 01             	add    $0x1,%edx
+  800bba:	83 c0 01             	add    $0x1,%eax
+  800bbd:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800bc0:	39 d8                	cmp    %ebx,%eax
+  800bc2:	75 ec                	jne    800bb0 <strlcpy+0x1b>
+  800bc4:	c6 00 00             	movb   $0x0,(%eax)
+  800bc7:	29 f0                	sub    %esi,%eax
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5d                   	pop    %ebp
+  800bcc:	c3                   	ret
+
+00800bcd <strcmp>:
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bd6:	0f b6 01             	movzbl (%ecx),%eax
+  800bd9:	84 c0                	test   %al,%al
+  800bdb:	74 11                	je     800bee <strcmp+0x21>
+  800bdd:	38 02                	cmp    %al,(%edx)
+  800bdf:	75 0d                	jne    800bee <strcmp+0x21>
+  800be1:	83 c1 01             	add    $0x1,%ecx
+  800be4:	83 c2 01             	add    $0x1,%edx
+  800be7:	0f b6 01             	movzbl (%ecx),%eax
+  800bea:	84 c0                	test   %al,%al
+  800bec:	75 ef                	jne    800bdd <strcmp+0x10>
+  800bee:	0f b6 c0             	movzbl %al,%eax
+  800bf1:	0f b6 12             	movzbl (%edx),%edx
+  800bf4:	29 d0                	sub    %edx,%eax
+  800bf6:	5d                   	pop    %ebp
+  800bf7:	c3                   	ret
+
+00800bf8 <strncmp>:
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	53                   	push   %ebx
+  800bfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c02:	8b 55 10             	mov    0x10(%ebp),%edx
+  800c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0a:	85 d2                	test   %edx,%edx
+  800c0c:	74 2e                	je     800c3c <strncmp+0x44>
+  800c0e:	0f b6 01             	movzbl (%ecx),%eax
+  800c11:	84 c0                	test   %al,%al
+  800c13:	74 16                	je     800c2b <strncmp+0x33>
+  800c15:	3a 03                	cmp    (%ebx),%al
+  800c17:	75 12                	jne    800c2b <strncmp+0x33>
+  800c19:	83 c1 01             	add    $0x1,%ecx
+  800c1c:	83 c3 01             	add    $0x1,%ebx
+  800c1f:	83 ea 01             	sub    $0x1,%edx
+  800c22:	75 ea                	jne    800c0e <strncmp+0x16>
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	eb 11                	jmp    800c3c <strncmp+0x44>
+  800c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c30:	85 d2                	test   %edx,%edx
+  800c32:	74 08                	je     800c3c <strncmp+0x44>
+  800c34:	0f b6 01             	movzbl (%ecx),%eax
+  800c37:	0f b6 13             	movzbl (%ebx),%edx
+  800c3a:	29 d0                	sub    %edx,%eax
+  800c3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c3f:	c9                   	leave
+  800c40:	c3                   	ret
+
+00800c41 <strchr>:
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c47:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800c4b:	0f b6 10             	movzbl (%eax),%edx
+  800c4e:	84 d2                	test   %dl,%dl
+  800c50:	74 15                	je     800c67 <strchr+0x26>
+  800c52:	38 d1                	cmp    %dl,%cl
+  800c54:	74 0f                	je     800c65 <strchr+0x24>
+  800c56:	83 c0 01             	add    $0x1,%eax
+  800c59:	0f b6 10             	movzbl (%eax),%edx
+  800c5c:	84 d2                	test   %dl,%dl
+  800c5e:	75 f2                	jne    800c52 <strchr+0x11>
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+  800c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6c:	eb f7                	jmp    800c65 <strchr+0x24>
+
+00800c6e <strfind>:
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	53                   	push   %ebx
+  800c72:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c75:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c78:	0f b6 18             	movzbl (%eax),%ebx
+  800c7b:	38 d3                	cmp    %dl,%bl
+  800c7d:	74 14                	je     800c93 <strfind+0x25>
+  800c7f:	89 d1                	mov    %edx,%ecx
+  800c81:	84 db                	test   %bl,%bl
+  800c83:	74 0e                	je     800c93 <strfind+0x25>
+  800c85:	83 c0 01             	add    $0x1,%eax
+  800c88:	0f b6 10             	movzbl (%eax),%edx
+  800c8b:	38 ca                	cmp    %cl,%dl
+  800c8d:	74 04                	je     800c93 <strfind+0x25>
+  800c8f:	84 d2                	test   %dl,%dl
+  800c91:	75 f2                	jne    800c85 <strfind+0x17>
+  800c93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c96:	c9                   	leave
+  800c97:	c3                   	ret
+
+00800c98 <memset>:
+  800c98:	55                   	push   %ebp
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	57                   	push   %edi
+  800c9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c9f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ca2:	85 c9                	test   %ecx,%ecx
+  800ca4:	74 20                	je     800cc6 <memset+0x2e>
+  800ca6:	89 f8                	mov    %edi,%eax
+  800ca8:	09 c8                	or     %ecx,%eax
+  800caa:	a8 03                	test   $0x3,%al
+  800cac:	75 12                	jne    800cc0 <memset+0x28>
+  800cae:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cb2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800cb8:	c1 e9 02             	shr    $0x2,%ecx
+  800cbb:	fc                   	cld
+  800cbc:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cbe:	eb 06                	jmp    800cc6 <memset+0x2e>
+  800cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cc3:	fc                   	cld
+  800cc4:	f3 aa                	rep stos %al,%es:(%edi)
+  800cc6:	89 f8                	mov    %edi,%eax
+  800cc8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ccb:	c9                   	leave
+  800ccc:	c3                   	ret
+
+00800ccd <memmove>:
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cd8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800cdb:	39 c6                	cmp    %eax,%esi
+  800cdd:	73 32                	jae    800d11 <memmove+0x44>
+  800cdf:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ce2:	39 d0                	cmp    %edx,%eax
+  800ce4:	73 2b                	jae    800d11 <memmove+0x44>
+  800ce6:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800ce9:	89 d6                	mov    %edx,%esi
+  800ceb:	09 fe                	or     %edi,%esi
+  800ced:	09 ce                	or     %ecx,%esi
+  800cef:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800cf5:	75 0e                	jne    800d05 <memmove+0x38>
+  800cf7:	83 ef 04             	sub    $0x4,%edi
+  800cfa:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800cfd:	c1 e9 02             	shr    $0x2,%ecx
+  800d00:	fd                   	std
+  800d01:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d03:	eb 09                	jmp    800d0e <memmove+0x41>
+  800d05:	83 ef 01             	sub    $0x1,%edi
+  800d08:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800d0b:	fd                   	std
+  800d0c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d0e:	fc                   	cld
+  800d0f:	eb 1a                	jmp    800d2b <memmove+0x5e>
+  800d11:	89 f2                	mov    %esi,%edx
+  800d13:	09 c2                	or     %eax,%edx
+  800d15:	09 ca                	or     %ecx,%edx
+  800d17:	f6 c2 03             	test   $0x3,%dl
+  800d1a:	75 0a                	jne    800d26 <memmove+0x59>
+  800d1c:	c1 e9 02             	shr    $0x2,%ecx
+  800d1f:	89 c7                	mov    %eax,%edi
+  800d21:	fc                   	cld
+  800d22:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d24:	eb 05                	jmp    800d2b <memmove+0x5e>
+  800d26:	89 c7                	mov    %eax,%edi
+  800d28:	fc                   	cld
+  800d29:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d2b:	5e                   	pop    %esi
+  800d2c:	5f                   	pop    %edi
+  800d2d:	5d                   	pop    %ebp
+  800d2e:	c3                   	ret
+
+00800d2f <memcpy>:
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+  800d35:	ff 75 10             	push   0x10(%ebp)
+  800d38:	ff 75 0c             	push   0xc(%ebp)
+  800d3b:	ff 75 08             	push   0x8(%ebp)
+  800d3e:	e8 8a ff ff ff       	call   800ccd <memmove>
+  800d43:	c9                   	leave
+  800d44:	c3                   	ret
+
+00800d45 <memcmp>:
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	56                   	push   %esi
+  800d49:	53                   	push   %ebx
+  800d4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d50:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d53:	85 f6                	test   %esi,%esi
+  800d55:	74 29                	je     800d80 <memcmp+0x3b>
+  800d57:	01 c6                	add    %eax,%esi
+  800d59:	0f b6 08             	movzbl (%eax),%ecx
+  800d5c:	0f b6 1a             	movzbl (%edx),%ebx
+  800d5f:	38 d9                	cmp    %bl,%cl
+  800d61:	75 11                	jne    800d74 <memcmp+0x2f>
+  800d63:	83 c0 01             	add    $0x1,%eax
+  800d66:	83 c2 01             	add    $0x1,%edx
+  800d69:	39 c6                	cmp    %eax,%esi
+  800d6b:	75 ec                	jne    800d59 <memcmp+0x14>
+  800d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d72:	eb 08                	jmp    800d7c <memcmp+0x37>
+  800d74:	0f b6 c1             	movzbl %cl,%eax
+  800d77:	0f b6 db             	movzbl %bl,%ebx
+  800d7a:	29 d8                	sub    %ebx,%eax
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5e                   	pop    %esi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+  800d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d85:	eb f5                	jmp    800d7c <memcmp+0x37>
+
+00800d87 <memfind>:
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d90:	89 c2                	mov    %eax,%edx
+  800d92:	03 55 10             	add    0x10(%ebp),%edx
+  800d95:	39 d0                	cmp    %edx,%eax
+  800d97:	73 0d                	jae    800da6 <memfind+0x1f>
+  800d99:	38 08                	cmp    %cl,(%eax)
+  800d9b:	74 0d                	je     800daa <memfind+0x23>
+  800d9d:	83 c0 01             	add    $0x1,%eax
+  800da0:	39 c2                	cmp    %eax,%edx
+  800da2:	75 f5                	jne    800d99 <memfind+0x12>
+  800da4:	eb 06                	jmp    800dac <memfind+0x25>
+  800da6:	89 c2                	mov    %eax,%edx
+  800da8:	eb 02                	jmp    800dac <memfind+0x25>
+  800daa:	89 c2                	mov    %eax,%edx
+  800dac:	89 d0                	mov    %edx,%eax
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+
+00800db0 <strtol>:
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  800db6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbc:	0f b6 02             	movzbl (%edx),%eax
+  800dbf:	3c 20                	cmp    $0x20,%al
+  800dc1:	74 04                	je     800dc7 <strtol+0x17>
+  800dc3:	3c 09                	cmp    $0x9,%al
+  800dc5:	75 0e                	jne    800dd5 <strtol+0x25>
+  800dc7:	83 c2 01             	add    $0x1,%edx
+  800dca:	0f b6 02             	movzbl (%edx),%eax
+  800dcd:	3c 20                	cmp    $0x20,%al
+  800dcf:	74 f6                	je     800dc7 <strtol+0x17>
+  800dd1:	3c 09                	cmp    $0x9,%al
+  800dd3:	74 f2                	je     800dc7 <strtol+0x17>
+  800dd5:	3c 2b                	cmp    $0x2b,%al
+  800dd7:	74 2a                	je     800e03 <strtol+0x53>
+  800dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dde:	3c 2d                	cmp    $0x2d,%al
+  800de0:	74 2b                	je     800e0d <strtol+0x5d>
+  800de2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800de8:	75 0f                	jne    800df9 <strtol+0x49>
+  800dea:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ded:	74 28                	je     800e17 <strtol+0x67>
+  800def:	85 db                	test   %ebx,%ebx
+  800df1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800df6:	0f 44 d8             	cmove  %eax,%ebx
+  800df9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfe:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e01:	eb 46                	jmp    800e49 <strtol+0x99>
+  800e03:	83 c2 01             	add    $0x1,%edx
+  800e06:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e0b:	eb d5                	jmp    800de2 <strtol+0x32>
+  800e0d:	83 c2 01             	add    $0x1,%edx
+  800e10:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e15:	eb cb                	jmp    800de2 <strtol+0x32>
+  800e17:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e1b:	74 0e                	je     800e2b <strtol+0x7b>
+  800e1d:	85 db                	test   %ebx,%ebx
+  800e1f:	75 d8                	jne    800df9 <strtol+0x49>
+  800e21:	83 c2 01             	add    $0x1,%edx
+  800e24:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e29:	eb ce                	jmp    800df9 <strtol+0x49>
+  800e2b:	83 c2 02             	add    $0x2,%edx
+  800e2e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e33:	eb c4                	jmp    800df9 <strtol+0x49>
+  800e35:	0f be c0             	movsbl %al,%eax
+  800e38:	83 e8 30             	sub    $0x30,%eax
+  800e3b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e3e:	7d 3a                	jge    800e7a <strtol+0xca>
+  800e40:	83 c2 01             	add    $0x1,%edx
+  800e43:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e47:	01 c1                	add    %eax,%ecx
+  800e49:	0f b6 02             	movzbl (%edx),%eax
+  800e4c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e4f:	89 f3                	mov    %esi,%ebx
+  800e51:	80 fb 09             	cmp    $0x9,%bl
+  800e54:	76 df                	jbe    800e35 <strtol+0x85>
+  800e56:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e59:	89 f3                	mov    %esi,%ebx
+  800e5b:	80 fb 19             	cmp    $0x19,%bl
+  800e5e:	77 08                	ja     800e68 <strtol+0xb8>
+  800e60:	0f be c0             	movsbl %al,%eax
+  800e63:	83 e8 57             	sub    $0x57,%eax
+  800e66:	eb d3                	jmp    800e3b <strtol+0x8b>
+  800e68:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e6b:	89 f3                	mov    %esi,%ebx
+  800e6d:	80 fb 19             	cmp    $0x19,%bl
+  800e70:	77 08                	ja     800e7a <strtol+0xca>
+  800e72:	0f be c0             	movsbl %al,%eax
+  800e75:	83 e8 37             	sub    $0x37,%eax
+  800e78:	eb c1                	jmp    800e3b <strtol+0x8b>
+  800e7a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e7e:	74 05                	je     800e85 <strtol+0xd5>
+  800e80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e83:	89 10                	mov    %edx,(%eax)
+  800e85:	89 c8                	mov    %ecx,%eax
+  800e87:	f7 d8                	neg    %eax
+  800e89:	85 ff                	test   %edi,%edi
+  800e8b:	0f 45 c8             	cmovne %eax,%ecx
+  800e8e:	89 c8                	mov    %ecx,%eax
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+
+00800e95 <sys_cputs>:
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	57                   	push   %edi
+  800e99:	56                   	push   %esi
+  800e9a:	53                   	push   %ebx
+  800e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea6:	89 c3                	mov    %eax,%ebx
+  800ea8:	89 c7                	mov    %eax,%edi
+  800eaa:	89 c6                	mov    %eax,%esi
+  800eac:	cd 30                	int    $0x30
+  800eae:	5b                   	pop    %ebx
+  800eaf:	5e                   	pop    %esi
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+
+00800eb3 <sys_cgetc>:
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+  800eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ec3:	89 d1                	mov    %edx,%ecx
+  800ec5:	89 d3                	mov    %edx,%ebx
+  800ec7:	89 d7                	mov    %edx,%edi
+  800ec9:	89 d6                	mov    %edx,%esi
+  800ecb:	cd 30                	int    $0x30
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+
+00800ed2 <sys_env_destroy>:
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	57                   	push   %edi
+  800ed6:	56                   	push   %esi
+  800ed7:	53                   	push   %ebx
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ee8:	89 cb                	mov    %ecx,%ebx
+  800eea:	89 cf                	mov    %ecx,%edi
+  800eec:	89 ce                	mov    %ecx,%esi
+  800eee:	cd 30                	int    $0x30
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_env_destroy+0x2a>
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 03                	push   $0x3
+  800f02:	68 cb 3e 80 00       	push   $0x803ecb
+  800f07:	6a 24                	push   $0x24
+  800f09:	68 e8 3e 80 00       	push   $0x803ee8
+  800f0e:	e8 38 f4 ff ff       	call   80034b <_panic>
+
+00800f13 <sys_getenvid>:
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f23:	89 d1                	mov    %edx,%ecx
+  800f25:	89 d3                	mov    %edx,%ebx
+  800f27:	89 d7                	mov    %edx,%edi
+  800f29:	89 d6                	mov    %edx,%esi
+  800f2b:	cd 30                	int    $0x30
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+
+00800f32 <sys_yield>:
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	57                   	push   %edi
+  800f36:	56                   	push   %esi
+  800f37:	53                   	push   %ebx
+  800f38:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f3f:	74 26                	je     800f67 <sys_yield+0x35>
+  800f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f46:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f4b:	89 d1                	mov    %edx,%ecx
+  800f4d:	89 d3                	mov    %edx,%ebx
+  800f4f:	89 d7                	mov    %edx,%edi
+  800f51:	6a 00                	push   $0x0
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	8d 35 5e 0f 80 00    	lea    0x800f5e,%esi
+  800f5c:	0f 34                	sysenter
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	83 c4 04             	add    $0x4,%esp
+  800f62:	5b                   	pop    %ebx
+  800f63:	5e                   	pop    %esi
+  800f64:	5f                   	pop    %edi
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+  800f67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f71:	89 d1                	mov    %edx,%ecx
+  800f73:	89 d3                	mov    %edx,%ebx
+  800f75:	89 d7                	mov    %edx,%edi
+  800f77:	89 d6                	mov    %edx,%esi
+  800f79:	cd 30                	int    $0x30
+  800f7b:	eb e5                	jmp    800f62 <sys_yield+0x30>
+
+00800f7d <sys_page_alloc>:
+  800f7d:	55                   	push   %ebp
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	57                   	push   %edi
+  800f81:	56                   	push   %esi
+  800f82:	53                   	push   %ebx
+  800f83:	83 ec 0c             	sub    $0xc,%esp
+  800f86:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f91:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f99:	89 f7                	mov    %esi,%edi
+  800f9b:	cd 30                	int    $0x30
+  800f9d:	85 c0                	test   %eax,%eax
+  800f9f:	7f 08                	jg     800fa9 <sys_page_alloc+0x2c>
+  800fa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa4:	5b                   	pop    %ebx
+  800fa5:	5e                   	pop    %esi
+  800fa6:	5f                   	pop    %edi
+  800fa7:	5d                   	pop    %ebp
+  800fa8:	c3                   	ret
+  800fa9:	83 ec 0c             	sub    $0xc,%esp
+  800fac:	50                   	push   %eax
+  800fad:	6a 04                	push   $0x4
+  800faf:	68 cb 3e 80 00       	push   $0x803ecb
+  800fb4:	6a 24                	push   $0x24
+  800fb6:	68 e8 3e 80 00       	push   $0x803ee8
+  800fbb:	e8 8b f3 ff ff       	call   80034b <_panic>
+
+00800fc0 <sys_page_map>:
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	57                   	push   %edi
+  800fc4:	56                   	push   %esi
+  800fc5:	53                   	push   %ebx
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fd0:	74 33                	je     801005 <sys_page_map+0x45>
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe3:	ff 75 18             	push   0x18(%ebp)
+  800fe6:	55                   	push   %ebp
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	8d 35 f1 0f 80 00    	lea    0x800ff1,%esi
+  800fef:	0f 34                	sysenter
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	83 c4 04             	add    $0x4,%esp
+  800ff5:	89 c2                	mov    %eax,%edx
+  800ff7:	85 c0                	test   %eax,%eax
+  800ff9:	7f 3d                	jg     801038 <sys_page_map+0x78>
+  800ffb:	89 d0                	mov    %edx,%eax
+  800ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+  801005:	b8 05 00 00 00       	mov    $0x5,%eax
+  80100a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801010:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801013:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801016:	8b 75 18             	mov    0x18(%ebp),%esi
+  801019:	cd 30                	int    $0x30
+  80101b:	89 c2                	mov    %eax,%edx
+  80101d:	85 c0                	test   %eax,%eax
+  80101f:	7e da                	jle    800ffb <sys_page_map+0x3b>
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  801024:	50                   	push   %eax
+  801025:	6a 05                	push   $0x5
+  801027:	68 cb 3e 80 00       	push   $0x803ecb
+  80102c:	6a 24                	push   $0x24
+  80102e:	68 e8 3e 80 00       	push   $0x803ee8
+  801033:	e8 13 f3 ff ff       	call   80034b <_panic>
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	50                   	push   %eax
+  80103c:	6a 05                	push   $0x5
+  80103e:	68 cb 3e 80 00       	push   $0x803ecb
+  801043:	6a 48                	push   $0x48
+  801045:	68 e8 3e 80 00       	push   $0x803ee8
+  80104a:	e8 fc f2 ff ff       	call   80034b <_panic>
+
+0080104f <sys_page_unmap>:
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+  801055:	83 ec 0c             	sub    $0xc,%esp
+  801058:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801063:	b8 06 00 00 00       	mov    $0x6,%eax
+  801068:	89 df                	mov    %ebx,%edi
+  80106a:	89 de                	mov    %ebx,%esi
+  80106c:	cd 30                	int    $0x30
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	7f 08                	jg     80107a <sys_page_unmap+0x2b>
+  801072:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801075:	5b                   	pop    %ebx
+  801076:	5e                   	pop    %esi
+  801077:	5f                   	pop    %edi
+  801078:	5d                   	pop    %ebp
+  801079:	c3                   	ret
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+  80107d:	50                   	push   %eax
+  80107e:	6a 06                	push   $0x6
+  801080:	68 cb 3e 80 00       	push   $0x803ecb
+  801085:	6a 24                	push   $0x24
+  801087:	68 e8 3e 80 00       	push   $0x803ee8
+  80108c:	e8 ba f2 ff ff       	call   80034b <_panic>
+
+00801091 <sys_fork>:
+  801091:	55                   	push   %ebp
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	57                   	push   %edi
+  801095:	56                   	push   %esi
+  801096:	53                   	push   %ebx
+  801097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80109c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8010a1:	89 d1                	mov    %edx,%ecx
+  8010a3:	89 d3                	mov    %edx,%ebx
+  8010a5:	89 d7                	mov    %edx,%edi
+  8010a7:	89 d6                	mov    %edx,%esi
+  8010a9:	cd 30                	int    $0x30
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5e                   	pop    %esi
+  8010ad:	5f                   	pop    %edi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+
+008010b0 <sys_env_set_status>:
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	57                   	push   %edi
+  8010b4:	56                   	push   %esi
+  8010b5:	53                   	push   %ebx
+  8010b6:	83 ec 0c             	sub    $0xc,%esp
+  8010b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010c9:	89 df                	mov    %ebx,%edi
+  8010cb:	89 de                	mov    %ebx,%esi
+  8010cd:	cd 30                	int    $0x30
+  8010cf:	85 c0                	test   %eax,%eax
+  8010d1:	7f 08                	jg     8010db <sys_env_set_status+0x2b>
+  8010d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+  8010db:	83 ec 0c             	sub    $0xc,%esp
+  8010de:	50                   	push   %eax
+  8010df:	6a 08                	push   $0x8
+  8010e1:	68 cb 3e 80 00       	push   $0x803ecb
+  8010e6:	6a 24                	push   $0x24
+  8010e8:	68 e8 3e 80 00       	push   $0x803ee8
+  8010ed:	e8 59 f2 ff ff       	call   80034b <_panic>
+
+008010f2 <sys_env_set_trapframe>:
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	57                   	push   %edi
+  8010f6:	56                   	push   %esi
+  8010f7:	53                   	push   %ebx
+  8010f8:	83 ec 0c             	sub    $0xc,%esp
+  8010fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801100:	8b 55 08             	mov    0x8(%ebp),%edx
+  801103:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801106:	b8 09 00 00 00       	mov    $0x9,%eax
+  80110b:	89 df                	mov    %ebx,%edi
+  80110d:	89 de                	mov    %ebx,%esi
+  80110f:	cd 30                	int    $0x30
+  801111:	85 c0                	test   %eax,%eax
+  801113:	7f 08                	jg     80111d <sys_env_set_trapframe+0x2b>
+  801115:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801118:	5b                   	pop    %ebx
+  801119:	5e                   	pop    %esi
+  80111a:	5f                   	pop    %edi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+  801120:	50                   	push   %eax
+  801121:	6a 09                	push   $0x9
+  801123:	68 cb 3e 80 00       	push   $0x803ecb
+  801128:	6a 24                	push   $0x24
+  80112a:	68 e8 3e 80 00       	push   $0x803ee8
+  80112f:	e8 17 f2 ff ff       	call   80034b <_panic>
+
+00801134 <sys_env_set_cow>:
+  801134:	55                   	push   %ebp
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	57                   	push   %edi
+  801138:	56                   	push   %esi
+  801139:	53                   	push   %ebx
+  80113a:	83 ec 0c             	sub    $0xc,%esp
+  80113d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801142:	8b 55 08             	mov    0x8(%ebp),%edx
+  801145:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801148:	b8 20 00 00 00       	mov    $0x20,%eax
+  80114d:	89 df                	mov    %ebx,%edi
+  80114f:	89 de                	mov    %ebx,%esi
+  801151:	cd 30                	int    $0x30
+  801153:	85 c0                	test   %eax,%eax
+  801155:	7f 08                	jg     80115f <sys_env_set_cow+0x2b>
+  801157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	50                   	push   %eax
+  801163:	6a 20                	push   $0x20
+  801165:	68 cb 3e 80 00       	push   $0x803ecb
+  80116a:	6a 24                	push   $0x24
+  80116c:	68 e8 3e 80 00       	push   $0x803ee8
+  801171:	e8 d5 f1 ff ff       	call   80034b <_panic>
+
+00801176 <sys_env_service>:
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	57                   	push   %edi
+  80117a:	56                   	push   %esi
+  80117b:	53                   	push   %ebx
+  80117c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801181:	8b 55 08             	mov    0x8(%ebp),%edx
+  801184:	b8 21 00 00 00       	mov    $0x21,%eax
+  801189:	89 cb                	mov    %ecx,%ebx
+  80118b:	89 cf                	mov    %ecx,%edi
+  80118d:	89 ce                	mov    %ecx,%esi
+  80118f:	cd 30                	int    $0x30
+  801191:	5b                   	pop    %ebx
+  801192:	5e                   	pop    %esi
+  801193:	5f                   	pop    %edi
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+
+00801196 <sys_env_set_pgfault_upcall>:
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+  801199:	57                   	push   %edi
+  80119a:	56                   	push   %esi
+  80119b:	53                   	push   %ebx
+  80119c:	83 ec 0c             	sub    $0xc,%esp
+  80119f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011af:	89 df                	mov    %ebx,%edi
+  8011b1:	89 de                	mov    %ebx,%esi
+  8011b3:	cd 30                	int    $0x30
+  8011b5:	85 c0                	test   %eax,%eax
+  8011b7:	7f 08                	jg     8011c1 <sys_env_set_pgfault_upcall+0x2b>
+  8011b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bc:	5b                   	pop    %ebx
+  8011bd:	5e                   	pop    %esi
+  8011be:	5f                   	pop    %edi
+  8011bf:	5d                   	pop    %ebp
+  8011c0:	c3                   	ret
+  8011c1:	83 ec 0c             	sub    $0xc,%esp
+  8011c4:	50                   	push   %eax
+  8011c5:	6a 0a                	push   $0xa
+  8011c7:	68 cb 3e 80 00       	push   $0x803ecb
+  8011cc:	6a 24                	push   $0x24
+  8011ce:	68 e8 3e 80 00       	push   $0x803ee8
+  8011d3:	e8 73 f1 ff ff       	call   80034b <_panic>
+
+008011d8 <sys_ipc_try_send>:
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	57                   	push   %edi
+  8011dc:	56                   	push   %esi
+  8011dd:	53                   	push   %ebx
+  8011de:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011e5:	74 27                	je     80120e <sys_ipc_try_send+0x36>
+  8011e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ed:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f8:	6a 00                	push   $0x0
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	8d 35 05 12 80 00    	lea    0x801205,%esi
+  801203:	0f 34                	sysenter
+  801205:	5d                   	pop    %ebp
+  801206:	83 c4 04             	add    $0x4,%esp
+  801209:	5b                   	pop    %ebx
+  80120a:	5e                   	pop    %esi
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+  80120e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801213:	be 00 00 00 00       	mov    $0x0,%esi
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801221:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801224:	cd 30                	int    $0x30
+  801226:	eb e1                	jmp    801209 <sys_ipc_try_send+0x31>
+
+00801228 <sys_ipc_recv>:
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	57                   	push   %edi
+  80122c:	56                   	push   %esi
+  80122d:	53                   	push   %ebx
+  80122e:	83 ec 0c             	sub    $0xc,%esp
+  801231:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801238:	74 32                	je     80126c <sys_ipc_recv+0x44>
+  80123a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801242:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801247:	89 cb                	mov    %ecx,%ebx
+  801249:	89 cf                	mov    %ecx,%edi
+  80124b:	6a 00                	push   $0x0
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	8d 35 58 12 80 00    	lea    0x801258,%esi
+  801256:	0f 34                	sysenter
+  801258:	5d                   	pop    %ebp
+  801259:	83 c4 04             	add    $0x4,%esp
+  80125c:	89 c2                	mov    %eax,%edx
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	7f 3c                	jg     80129e <sys_ipc_recv+0x76>
+  801262:	89 d0                	mov    %edx,%eax
+  801264:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+  80126c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801271:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801276:	8b 55 08             	mov    0x8(%ebp),%edx
+  801279:	89 cb                	mov    %ecx,%ebx
+  80127b:	89 cf                	mov    %ecx,%edi
+  80127d:	89 ce                	mov    %ecx,%esi
+  80127f:	cd 30                	int    $0x30
+  801281:	89 c2                	mov    %eax,%edx
+  801283:	85 c0                	test   %eax,%eax
+  801285:	7e db                	jle    801262 <sys_ipc_recv+0x3a>
+  801287:	83 ec 0c             	sub    $0xc,%esp
+  80128a:	50                   	push   %eax
+  80128b:	6a 0d                	push   $0xd
+  80128d:	68 cb 3e 80 00       	push   $0x803ecb
+  801292:	6a 24                	push   $0x24
+  801294:	68 e8 3e 80 00       	push   $0x803ee8
+  801299:	e8 ad f0 ff ff       	call   80034b <_panic>
+  80129e:	83 ec 0c             	sub    $0xc,%esp
+  8012a1:	50                   	push   %eax
+  8012a2:	6a 0d                	push   $0xd
+  8012a4:	68 cb 3e 80 00       	push   $0x803ecb
+  8012a9:	6a 48                	push   $0x48
+  8012ab:	68 e8 3e 80 00       	push   $0x803ee8
+  8012b0:	e8 96 f0 ff ff       	call   80034b <_panic>
+
+008012b5 <sys_ipc_send>:
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	57                   	push   %edi
+  8012b9:	56                   	push   %esi
+  8012ba:	53                   	push   %ebx
+  8012bb:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012c2:	74 27                	je     8012eb <sys_ipc_send+0x36>
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012d5:	6a 00                	push   $0x0
+  8012d7:	55                   	push   %ebp
+  8012d8:	89 e5                	mov    %esp,%ebp
+  8012da:	8d 35 e2 12 80 00    	lea    0x8012e2,%esi
+  8012e0:	0f 34                	sysenter
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	83 c4 04             	add    $0x4,%esp
+  8012e6:	5b                   	pop    %ebx
+  8012e7:	5e                   	pop    %esi
+  8012e8:	5f                   	pop    %edi
+  8012e9:	5d                   	pop    %ebp
+  8012ea:	c3                   	ret
+  8012eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801301:	cd 30                	int    $0x30
+  801303:	eb e1                	jmp    8012e6 <sys_ipc_send+0x31>
+
+00801305 <sys_ipc_call>:
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801311:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801319:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80131c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80131f:	cd 30                	int    $0x30
+  801321:	5b                   	pop    %ebx
+  801322:	5e                   	pop    %esi
+  801323:	5f                   	pop    %edi
+  801324:	5d                   	pop    %ebp
+  801325:	c3                   	ret
+
+00801326 <sys_ipc_reply_recv>:
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	57                   	push   %edi
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801332:	b8 10 00 00 00       	mov    $0x10,%eax
+  801337:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801340:	cd 30                	int    $0x30
+  801342:	5b                   	pop    %ebx
+  801343:	5e                   	pop    %esi
+  801344:	5f                   	pop    %edi
+  801345:	5d                   	pop    %ebp
+  801346:	c3                   	ret
+
+00801347 <sys_time_msec>:
+  801347:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80134c:	85 c0                	test   %eax,%eax
+  80134e:	75 06                	jne    801356 <sys_time_msec+0xf>
+  801350:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801355:	c3                   	ret
+  801356:	55                   	push   %ebp
+  801357:	89 e5                	mov    %esp,%ebp
+  801359:	57                   	push   %edi
+  80135a:	56                   	push   %esi
+  80135b:	53                   	push   %ebx
+  80135c:	83 ec 0c             	sub    $0xc,%esp
+  80135f:	0f 31                	rdtsc
+  801361:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801367:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80136d:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801373:	29 c8                	sub    %ecx,%eax
+  801375:	19 da                	sbb    %ebx,%edx
+  801377:	bf 00 00 00 00       	mov    $0x0,%edi
+  80137c:	57                   	push   %edi
+  80137d:	56                   	push   %esi
+  80137e:	52                   	push   %edx
+  80137f:	50                   	push   %eax
+  801380:	e8 81 25 00 00       	call   803906 <__udivdi3>
+  801385:	83 c4 10             	add    $0x10,%esp
+  801388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <sys_env_swap>:
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	56                   	push   %esi
+  801395:	53                   	push   %ebx
+  801396:	83 ec 0c             	sub    $0xc,%esp
+  801399:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80139e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013a6:	89 cb                	mov    %ecx,%ebx
+  8013a8:	89 cf                	mov    %ecx,%edi
+  8013aa:	89 ce                	mov    %ecx,%esi
+  8013ac:	cd 30                	int    $0x30
+  8013ae:	85 c0                	test   %eax,%eax
+  8013b0:	7f 08                	jg     8013ba <sys_env_swap+0x2a>
+  8013b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b5:	5b                   	pop    %ebx
+  8013b6:	5e                   	pop    %esi
+  8013b7:	5f                   	pop    %edi
+  8013b8:	5d                   	pop    %ebp
+  8013b9:	c3                   	ret
+  8013ba:	83 ec 0c             	sub    $0xc,%esp
+  8013bd:	50                   	push   %eax
+  8013be:	6a 12                	push   $0x12
+  8013c0:	68 cb 3e 80 00       	push   $0x803ecb
+  8013c5:	6a 24                	push   $0x24
+  8013c7:	68 e8 3e 80 00       	push   $0x803ee8
+  8013cc:	e8 7a ef ff ff       	call   80034b <_panic>
+
+008013d1 <sys_net_try_send>:
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	57                   	push   %edi
+  8013d5:	56                   	push   %esi
+  8013d6:	53                   	push   %ebx
+  8013d7:	83 ec 0c             	sub    $0xc,%esp
+  8013da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013ea:	89 df                	mov    %ebx,%edi
+  8013ec:	89 de                	mov    %ebx,%esi
+  8013ee:	cd 30                	int    $0x30
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	7f 08                	jg     8013fc <sys_net_try_send+0x2b>
+  8013f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f7:	5b                   	pop    %ebx
+  8013f8:	5e                   	pop    %esi
+  8013f9:	5f                   	pop    %edi
+  8013fa:	5d                   	pop    %ebp
+  8013fb:	c3                   	ret
+  8013fc:	83 ec 0c             	sub    $0xc,%esp
+  8013ff:	50                   	push   %eax
+  801400:	6a 13                	push   $0x13
+  801402:	68 cb 3e 80 00       	push   $0x803ecb
+  801407:	6a 24                	push   $0x24
+  801409:	68 e8 3e 80 00       	push   $0x803ee8
+  80140e:	e8 38 ef ff ff       	call   80034b <_panic>
+
+00801413 <sys_net_try_receive>:
+  801413:	55                   	push   %ebp
+  801414:	89 e5                	mov    %esp,%ebp
+  801416:	57                   	push   %edi
+  801417:	56                   	push   %esi
+  801418:	53                   	push   %ebx
+  801419:	83 ec 0c             	sub    $0xc,%esp
+  80141c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801421:	8b 55 08             	mov    0x8(%ebp),%edx
+  801424:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801427:	b8 14 00 00 00       	mov    $0x14,%eax
+  80142c:	89 df                	mov    %ebx,%edi
+  80142e:	89 de                	mov    %ebx,%esi
+  801430:	cd 30                	int    $0x30
+  801432:	85 c0                	test   %eax,%eax
+  801434:	7f 08                	jg     80143e <sys_net_try_receive+0x2b>
+  801436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801439:	5b                   	pop    %ebx
+  80143a:	5e                   	pop    %esi
+  80143b:	5f                   	pop    %edi
+  80143c:	5d                   	pop    %ebp
+  80143d:	c3                   	ret
+  80143e:	83 ec 0c             	sub    $0xc,%esp
+  801441:	50                   	push   %eax
+  801442:	6a 14                	push   $0x14
+  801444:	68 cb 3e 80 00       	push   $0x803ecb
+  801449:	6a 24                	push   $0x24
+  80144b:	68 e8 3e 80 00       	push   $0x803ee8
+  801450:	e8 f6 ee ff ff       	call   80034b <_panic>
+
+00801455 <sys_net_recv_page>:
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	57                   	push   %edi
+  801459:	56                   	push   %esi
+  80145a:	53                   	push   %ebx
+  80145b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801460:	8b 55 08             	mov    0x8(%ebp),%edx
+  801463:	b8 27 00 00 00       	mov    $0x27,%eax
+  801468:	89 cb                	mov    %ecx,%ebx
+  80146a:	89 cf                	mov    %ecx,%edi
+  80146c:	89 ce                	mov    %ecx,%esi
+  80146e:	cd 30                	int    $0x30
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+
+00801475 <sys_net_wait>:
+  801475:	55                   	push   %ebp
+  801476:	89 e5                	mov    %esp,%ebp
+  801478:	57                   	push   %edi
+  801479:	56                   	push   %esi
+  80147a:	53                   	push   %ebx
+  80147b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801480:	b8 26 00 00 00       	mov    $0x26,%eax
+  801485:	89 d1                	mov    %edx,%ecx
+  801487:	89 d3                	mov    %edx,%ebx
+  801489:	89 d7                	mov    %edx,%edi
+  80148b:	89 d6                	mov    %edx,%esi
+  80148d:	cd 30                	int    $0x30
+  80148f:	5b                   	pop    %ebx
+  801490:	5e                   	pop    %esi
+  801491:	5f                   	pop    %edi
+  801492:	5d                   	pop    %ebp
+  801493:	c3                   	ret
+
+00801494 <sys_get_mac>:
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	57                   	push   %edi
+  801498:	56                   	push   %esi
+  801499:	53                   	push   %ebx
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+  80149d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8014ad:	89 df                	mov    %ebx,%edi
+  8014af:	89 de                	mov    %ebx,%esi
+  8014b1:	cd 30                	int    $0x30
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	7f 08                	jg     8014bf <sys_get_mac+0x2b>
+  8014b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ba:	5b                   	pop    %ebx
+  8014bb:	5e                   	pop    %esi
+  8014bc:	5f                   	pop    %edi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+  8014bf:	83 ec 0c             	sub    $0xc,%esp
+  8014c2:	50                   	push   %eax
+  8014c3:	6a 15                	push   $0x15
+  8014c5:	68 cb 3e 80 00       	push   $0x803ecb
+  8014ca:	6a 24                	push   $0x24
+  8014cc:	68 e8 3e 80 00       	push   $0x803ee8
+  8014d1:	e8 75 ee ff ff       	call   80034b <_panic>
+
+008014d6 <sys_env_lease>:
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	57                   	push   %edi
+  8014da:	56                   	push   %esi
+  8014db:	53                   	push   %ebx
+  8014dc:	83 ec 0c             	sub    $0xc,%esp
+  8014df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ea:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014ef:	89 df                	mov    %ebx,%edi
+  8014f1:	89 de                	mov    %ebx,%esi
+  8014f3:	cd 30                	int    $0x30
+  8014f5:	85 c0                	test   %eax,%eax
+  8014f7:	7f 08                	jg     801501 <sys_env_lease+0x2b>
+  8014f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fc:	5b                   	pop    %ebx
+  8014fd:	5e                   	pop    %esi
+  8014fe:	5f                   	pop    %edi
+  8014ff:	5d                   	pop    %ebp
+  801500:	c3                   	ret
+  801501:	83 ec 0c             	sub    $0xc,%esp
+  801504:	50                   	push   %eax
+  801505:	6a 16                	push   $0x16
+  801507:	68 cb 3e 80 00       	push   $0x803ecb
+  80150c:	6a 24                	push   $0x24
+  80150e:	68 e8 3e 80 00       	push   $0x803ee8
+  801513:	e8 33 ee ff ff       	call   80034b <_panic>
+
+00801518 <sys_copy_mem>:
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	57                   	push   %edi
+  80151c:	56                   	push   %esi
+  80151d:	53                   	push   %ebx
+  80151e:	83 ec 0c             	sub    $0xc,%esp
+  801521:	8b 55 08             	mov    0x8(%ebp),%edx
+  801524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801527:	b8 17 00 00 00       	mov    $0x17,%eax
+  80152c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801532:	8b 75 18             	mov    0x18(%ebp),%esi
+  801535:	cd 30                	int    $0x30
+  801537:	85 c0                	test   %eax,%eax
+  801539:	7f 08                	jg     801543 <sys_copy_mem+0x2b>
+  80153b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153e:	5b                   	pop    %ebx
+  80153f:	5e                   	pop    %esi
+  801540:	5f                   	pop    %edi
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+  801543:	83 ec 0c             	sub    $0xc,%esp
+  801546:	50                   	push   %eax
+  801547:	6a 17                	push   $0x17
+  801549:	68 cb 3e 80 00       	push   $0x803ecb
+  80154e:	6a 24                	push   $0x24
+  801550:	68 e8 3e 80 00       	push   $0x803ee8
+  801555:	e8 f1 ed ff ff       	call   80034b <_panic>
+
+0080155a <sys_get_perms>:
+  80155a:	55                   	push   %ebp
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	57                   	push   %edi
+  80155e:	56                   	push   %esi
+  80155f:	53                   	push   %ebx
+  801560:	83 ec 0c             	sub    $0xc,%esp
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801573:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801576:	89 f7                	mov    %esi,%edi
+  801578:	cd 30                	int    $0x30
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	7f 08                	jg     801586 <sys_get_perms+0x2c>
+  80157e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801581:	5b                   	pop    %ebx
+  801582:	5e                   	pop    %esi
+  801583:	5f                   	pop    %edi
+  801584:	5d                   	pop    %ebp
+  801585:	c3                   	ret
+  801586:	83 ec 0c             	sub    $0xc,%esp
+  801589:	50                   	push   %eax
+  80158a:	6a 18                	push   $0x18
+  80158c:	68 cb 3e 80 00       	push   $0x803ecb
+  801591:	6a 24                	push   $0x24
+  801593:	68 e8 3e 80 00       	push   $0x803ee8
+  801598:	e8 ae ed ff ff       	call   80034b <_panic>
+
+0080159d <sys_env_unsuspend>:
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	57                   	push   %edi
+  8015a1:	56                   	push   %esi
+  8015a2:	53                   	push   %ebx
+  8015a3:	83 ec 0c             	sub    $0xc,%esp
+  8015a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015b9:	89 f7                	mov    %esi,%edi
+  8015bb:	cd 30                	int    $0x30
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	7f 08                	jg     8015c9 <sys_env_unsuspend+0x2c>
+  8015c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+  8015c9:	83 ec 0c             	sub    $0xc,%esp
+  8015cc:	50                   	push   %eax
+  8015cd:	6a 19                	push   $0x19
+  8015cf:	68 cb 3e 80 00       	push   $0x803ecb
+  8015d4:	6a 24                	push   $0x24
+  8015d6:	68 e8 3e 80 00       	push   $0x803ee8
+  8015db:	e8 6b ed ff ff       	call   80034b <_panic>
+
+008015e0 <sys_migrate>:
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	57                   	push   %edi
+  8015e4:	56                   	push   %esi
+  8015e5:	53                   	push   %ebx
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	ba 04 90 80 00       	mov    $0x809004,%edx
+  8015ee:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8015f4:	76 11                	jbe    801607 <sys_migrate+0x27>
+  8015f6:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8015fb:	0f b6 08             	movzbl (%eax),%ecx
+  8015fe:	05 00 10 00 00       	add    $0x1000,%eax
+  801603:	39 d0                	cmp    %edx,%eax
+  801605:	72 f4                	jb     8015fb <sys_migrate+0x1b>
+  801607:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80160c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801614:	89 cb                	mov    %ecx,%ebx
+  801616:	89 cf                	mov    %ecx,%edi
+  801618:	89 ce                	mov    %ecx,%esi
+  80161a:	cd 30                	int    $0x30
+  80161c:	85 c0                	test   %eax,%eax
+  80161e:	7f 08                	jg     801628 <sys_migrate+0x48>
+  801620:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801623:	5b                   	pop    %ebx
+  801624:	5e                   	pop    %esi
+  801625:	5f                   	pop    %edi
+  801626:	5d                   	pop    %ebp
+  801627:	c3                   	ret
+  801628:	83 ec 0c             	sub    $0xc,%esp
+  80162b:	50                   	push   %eax
+  80162c:	6a 1a                	push   $0x1a
+  80162e:	68 cb 3e 80 00       	push   $0x803ecb
+  801633:	6a 24                	push   $0x24
+  801635:	68 e8 3e 80 00       	push   $0x803ee8
+  80163a:	e8 0c ed ff ff       	call   80034b <_panic>
+
+0080163f <sys_lease_complete>:
+  80163f:	55                   	push   %ebp
+  801640:	89 e5                	mov    %esp,%ebp
+  801642:	57                   	push   %edi
+  801643:	56                   	push   %esi
+  801644:	53                   	push   %ebx
+  801645:	83 ec 0c             	sub    $0xc,%esp
+  801648:	ba 00 00 00 00       	mov    $0x0,%edx
+  80164d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801652:	89 d1                	mov    %edx,%ecx
+  801654:	89 d3                	mov    %edx,%ebx
+  801656:	89 d7                	mov    %edx,%edi
+  801658:	89 d6                	mov    %edx,%esi
+  80165a:	cd 30                	int    $0x30
+  80165c:	85 c0                	test   %eax,%eax
+  80165e:	7f 08                	jg     801668 <sys_lease_complete+0x29>
+  801660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801663:	5b                   	pop    %ebx
+  801664:	5e                   	pop    %esi
+  801665:	5f                   	pop    %edi
+  801666:	5d                   	pop    %ebp
+  801667:	c3                   	ret
+  801668:	83 ec 0c             	sub    $0xc,%esp
+  80166b:	50                   	push   %eax
+  80166c:	6a 1b                	push   $0x1b
+  80166e:	68 cb 3e 80 00       	push   $0x803ecb
+  801673:	6a 24                	push   $0x24
+  801675:	68 e8 3e 80 00       	push   $0x803ee8
+  80167a:	e8 cc ec ff ff       	call   80034b <_panic>
+
+0080167f <sys_env_set_thisenv>:
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	57                   	push   %edi
+  801683:	56                   	push   %esi
+  801684:	53                   	push   %ebx
+  801685:	83 ec 0c             	sub    $0xc,%esp
+  801688:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801690:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801693:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801698:	89 df                	mov    %ebx,%edi
+  80169a:	89 de                	mov    %ebx,%esi
+  80169c:	cd 30                	int    $0x30
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	7f 08                	jg     8016aa <sys_env_set_thisenv+0x2b>
+  8016a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a5:	5b                   	pop    %ebx
+  8016a6:	5e                   	pop    %esi
+  8016a7:	5f                   	pop    %edi
+  8016a8:	5d                   	pop    %ebp
+  8016a9:	c3                   	ret
+  8016aa:	83 ec 0c             	sub    $0xc,%esp
+  8016ad:	50                   	push   %eax
+  8016ae:	6a 1c                	push   $0x1c
+  8016b0:	68 cb 3e 80 00       	push   $0x803ecb
+  8016b5:	6a 24                	push   $0x24
+  8016b7:	68 e8 3e 80 00       	push   $0x803ee8
+  8016bc:	e8 8a ec ff ff       	call   80034b <_panic>
+
+008016c1 <sys_env_set_sched>:
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	57                   	push   %edi
+  8016c5:	56                   	push   %esi
+  8016c6:	53                   	push   %ebx
+  8016c7:	83 ec 0c             	sub    $0xc,%esp
+  8016ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016dd:	89 f7                	mov    %esi,%edi
+  8016df:	cd 30                	int    $0x30
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	7f 08                	jg     8016ed <sys_env_set_sched+0x2c>
+  8016e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+  8016ed:	83 ec 0c             	sub    $0xc,%esp
+  8016f0:	50                   	push   %eax
+  8016f1:	6a 1d                	push   $0x1d
+  8016f3:	68 cb 3e 80 00       	push   $0x803ecb
+  8016f8:	6a 24                	push   $0x24
+  8016fa:	68 e8 3e 80 00       	push   $0x803ee8
+  8016ff:	e8 47 ec ff ff       	call   80034b <_panic>
+
+00801704 <sys_batch>:
+  801704:	55                   	push   %ebp
+  801705:	89 e5                	mov    %esp,%ebp
+  801707:	57                   	push   %edi
+  801708:	56                   	push   %esi
+  801709:	53                   	push   %ebx
+  80170a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801712:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801715:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80171a:	89 df                	mov    %ebx,%edi
+  80171c:	89 de                	mov    %ebx,%esi
+  80171e:	cd 30                	int    $0x30
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+
+00801725 <sys_env_stats>:
+  801725:	55                   	push   %ebp
+  801726:	89 e5                	mov    %esp,%ebp
+  801728:	57                   	push   %edi
+  801729:	56                   	push   %esi
+  80172a:	53                   	push   %ebx
+  80172b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801730:	8b 55 08             	mov    0x8(%ebp),%edx
+  801733:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801736:	b8 23 00 00 00       	mov    $0x23,%eax
+  80173b:	89 df                	mov    %ebx,%edi
+  80173d:	89 de                	mov    %ebx,%esi
+  80173f:	cd 30                	int    $0x30
+  801741:	5b                   	pop    %ebx
+  801742:	5e                   	pop    %esi
+  801743:	5f                   	pop    %edi
+  801744:	5d                   	pop    %ebp
+  801745:	c3                   	ret
+
+00801746 <sys_trace>:
+  801746:	55                   	push   %ebp
+  801747:	89 e5                	mov    %esp,%ebp
+  801749:	57                   	push   %edi
+  80174a:	56                   	push   %esi
+  80174b:	53                   	push   %ebx
+  80174c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801751:	8b 55 08             	mov    0x8(%ebp),%edx
+  801754:	b8 24 00 00 00       	mov    $0x24,%eax
+  801759:	89 cb                	mov    %ecx,%ebx
+  80175b:	89 cf                	mov    %ecx,%edi
+  80175d:	89 ce                	mov    %ecx,%esi
+  80175f:	cd 30                	int    $0x30
+  801761:	5b                   	pop    %ebx
+  801762:	5e                   	pop    %esi
+  801763:	5f                   	pop    %edi
+  801764:	5d                   	pop    %ebp
+  801765:	c3                   	ret
+
+00801766 <sys_env_set_pager>:
+  801766:	55                   	push   %ebp
+  801767:	89 e5                	mov    %esp,%ebp
+  801769:	57                   	push   %edi
+  80176a:	56                   	push   %esi
+  80176b:	53                   	push   %ebx
+  80176c:	83 ec 0c             	sub    $0xc,%esp
+  80176f:	be 00 00 00 00       	mov    $0x0,%esi
+  801774:	8b 55 08             	mov    0x8(%ebp),%edx
+  801777:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177a:	b8 25 00 00 00       	mov    $0x25,%eax
+  80177f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801782:	89 f7                	mov    %esi,%edi
+  801784:	cd 30                	int    $0x30
+  801786:	85 c0                	test   %eax,%eax
+  801788:	7f 08                	jg     801792 <sys_env_set_pager+0x2c>
+  80178a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178d:	5b                   	pop    %ebx
+  80178e:	5e                   	pop    %esi
+  80178f:	5f                   	pop    %edi
+  801790:	5d                   	pop    %ebp
+  801791:	c3                   	ret
+  801792:	83 ec 0c             	sub    $0xc,%esp
+  801795:	50                   	push   %eax
+  801796:	6a 25                	push   $0x25
+  801798:	68 cb 3e 80 00       	push   $0x803ecb
+  80179d:	6a 24                	push   $0x24
+  80179f:	68 e8 3e 80 00       	push   $0x803ee8
+  8017a4:	e8 a2 eb ff ff       	call   80034b <_panic>
+
+008017a9 <sys_pager_retire>:
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	57                   	push   %edi
+  8017ad:	56                   	push   %esi
+  8017ae:	53                   	push   %ebx
+  8017af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b7:	b8 28 00 00 00       	mov    $0x28,%eax
+  8017bc:	89 cb                	mov    %ecx,%ebx
+  8017be:	89 cf                	mov    %ecx,%edi
+  8017c0:	89 ce                	mov    %ecx,%esi
+  8017c2:	cd 30                	int    $0x30
+  8017c4:	5b                   	pop    %ebx
+  8017c5:	5e                   	pop    %esi
+  8017c6:	5f                   	pop    %edi
+  8017c7:	5d                   	pop    %ebp
+  8017c8:	c3                   	ret
+
+008017c9 <sys_prof>:
+  8017c9:	55                   	push   %ebp
+  8017ca:	89 e5                	mov    %esp,%ebp
+  8017cc:	57                   	push   %edi
+  8017cd:	56                   	push   %esi
+  8017ce:	53                   	push   %ebx
+  8017cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017da:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017e2:	89 f7                	mov    %esi,%edi
+  8017e4:	cd 30                	int    $0x30
+  8017e6:	5b                   	pop    %ebx
+  8017e7:	5e                   	pop    %esi
+  8017e8:	5f                   	pop    %edi
+  8017e9:	5d                   	pop    %ebp
+  8017ea:	c3                   	ret
+
+008017eb <dupq_flush>:
+  8017eb:	55                   	push   %ebp
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	53                   	push   %ebx
+  8017ef:	83 ec 0c             	sub    $0xc,%esp
+  8017f2:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  8017f8:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8017ff:	00 00 00 
+  801802:	53                   	push   %ebx
+  801803:	68 00 00 40 00       	push   $0x400000
+  801808:	e8 f7 fe ff ff       	call   801704 <sys_batch>
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 14                	js     801828 <dupq_flush+0x3d>
+  801814:	39 c3                	cmp    %eax,%ebx
+  801816:	7e 0b                	jle    801823 <dupq_flush+0x38>
+  801818:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80181b:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801821:	eb 05                	jmp    801828 <dupq_flush+0x3d>
+  801823:	b8 00 00 00 00       	mov    $0x0,%eax
+  801828:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+
+0080182d <pgfault>:
+  80182d:	55                   	push   %ebp
+  80182e:	89 e5                	mov    %esp,%ebp
+  801830:	56                   	push   %esi
+  801831:	53                   	push   %ebx
+  801832:	8b 45 08             	mov    0x8(%ebp),%eax
+  801835:	8b 30                	mov    (%eax),%esi
+  801837:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80183b:	0f 84 83 00 00 00    	je     8018c4 <pgfault+0x97>
+  801841:	89 f0                	mov    %esi,%eax
+  801843:	c1 e8 0c             	shr    $0xc,%eax
+  801846:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80184d:	f6 c4 08             	test   $0x8,%ah
+  801850:	0f 84 80 00 00 00    	je     8018d6 <pgfault+0xa9>
+  801856:	e8 b8 f6 ff ff       	call   800f13 <sys_getenvid>
+  80185b:	89 c3                	mov    %eax,%ebx
+  80185d:	83 ec 04             	sub    $0x4,%esp
+  801860:	6a 07                	push   $0x7
+  801862:	68 00 f0 7f 00       	push   $0x7ff000
+  801867:	50                   	push   %eax
+  801868:	e8 10 f7 ff ff       	call   800f7d <sys_page_alloc>
+  80186d:	83 c4 10             	add    $0x10,%esp
+  801870:	85 c0                	test   %eax,%eax
+  801872:	78 74                	js     8018e8 <pgfault+0xbb>
+  801874:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	68 00 10 00 00       	push   $0x1000
+  801882:	56                   	push   %esi
+  801883:	68 00 f0 7f 00       	push   $0x7ff000
+  801888:	e8 40 f4 ff ff       	call   800ccd <memmove>
+  80188d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801894:	56                   	push   %esi
+  801895:	53                   	push   %ebx
+  801896:	68 00 f0 7f 00       	push   $0x7ff000
+  80189b:	53                   	push   %ebx
+  80189c:	e8 1f f7 ff ff       	call   800fc0 <sys_page_map>
+  8018a1:	83 c4 20             	add    $0x20,%esp
+  8018a4:	85 c0                	test   %eax,%eax
+  8018a6:	78 54                	js     8018fc <pgfault+0xcf>
+  8018a8:	83 ec 08             	sub    $0x8,%esp
+  8018ab:	68 00 f0 7f 00       	push   $0x7ff000
+  8018b0:	53                   	push   %ebx
+  8018b1:	e8 99 f7 ff ff       	call   80104f <sys_page_unmap>
+  8018b6:	83 c4 10             	add    $0x10,%esp
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 53                	js     801910 <pgfault+0xe3>
+  8018bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c0:	5b                   	pop    %ebx
+  8018c1:	5e                   	pop    %esi
+  8018c2:	5d                   	pop    %ebp
+  8018c3:	c3                   	ret
+  8018c4:	56                   	push   %esi
+  8018c5:	68 f8 3e 80 00       	push   $0x803ef8
+  8018ca:	6a 19                	push   $0x19
+  8018cc:	68 d4 3f 80 00       	push   $0x803fd4
+  8018d1:	e8 75 ea ff ff       	call   80034b <_panic>
+  8018d6:	56                   	push   %esi
+  8018d7:	68 2c 3f 80 00       	push   $0x803f2c
+  8018dc:	6a 1e                	push   $0x1e
+  8018de:	68 d4 3f 80 00       	push   $0x803fd4
+  8018e3:	e8 63 ea ff ff       	call   80034b <_panic>
+  8018e8:	83 ec 04             	sub    $0x4,%esp
+  8018eb:	68 60 3f 80 00       	push   $0x803f60
+  8018f0:	6a 2e                	push   $0x2e
+  8018f2:	68 d4 3f 80 00       	push   $0x803fd4
+  8018f7:	e8 4f ea ff ff       	call   80034b <_panic>
+  8018fc:	83 ec 04             	sub    $0x4,%esp
+  8018ff:	68 84 3f 80 00       	push   $0x803f84
+  801904:	6a 37                	push   $0x37
+  801906:	68 d4 3f 80 00       	push   $0x803fd4
+  80190b:	e8 3b ea ff ff       	call   80034b <_panic>
+  801910:	83 ec 04             	sub    $0x4,%esp
+  801913:	68 b0 3f 80 00       	push   $0x803fb0
+  801918:	6a 3c                	push   $0x3c
+  80191a:	68 d4 3f 80 00       	push   $0x803fd4
+  80191f:	e8 27 ea ff ff       	call   80034b <_panic>
+
+00801924 <dupq_begin>:
+  801924:	55                   	push   %ebp
+  801925:	89 e5                	mov    %esp,%ebp
+  801927:	83 ec 0c             	sub    $0xc,%esp
+  80192a:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801931:	00 00 00 
+  801934:	6a 07                	push   $0x7
+  801936:	68 00 00 40 00       	push   $0x400000
+  80193b:	6a 00                	push   $0x0
+  80193d:	e8 3b f6 ff ff       	call   800f7d <sys_page_alloc>
+  801942:	c9                   	leave
+  801943:	c3                   	ret
+
+00801944 <dupq_map>:
+  801944:	55                   	push   %ebp
+  801945:	89 e5                	mov    %esp,%ebp
+  801947:	83 ec 08             	sub    $0x8,%esp
+  80194a:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  801951:	00 00 00 
+  801954:	74 46                	je     80199c <dupq_map+0x58>
+  801956:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80195c:	8d 42 01             	lea    0x1(%edx),%eax
+  80195f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801964:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801967:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80196d:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801974:	00 00 00 
+  801977:	8b 55 08             	mov    0x8(%ebp),%edx
+  80197a:	89 50 04             	mov    %edx,0x4(%eax)
+  80197d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801980:	c1 e2 0c             	shl    $0xc,%edx
+  801983:	89 50 08             	mov    %edx,0x8(%eax)
+  801986:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801989:	89 48 0c             	mov    %ecx,0xc(%eax)
+  80198c:	89 50 10             	mov    %edx,0x10(%eax)
+  80198f:	8b 55 14             	mov    0x14(%ebp),%edx
+  801992:	89 50 14             	mov    %edx,0x14(%eax)
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199a:	c9                   	leave
+  80199b:	c3                   	ret
+  80199c:	e8 4a fe ff ff       	call   8017eb <dupq_flush>
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	79 b1                	jns    801956 <dupq_map+0x12>
+  8019a5:	eb f3                	jmp    80199a <dupq_map+0x56>
+
+008019a7 <dupq_end>:
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	53                   	push   %ebx
+  8019ab:	83 ec 04             	sub    $0x4,%esp
+  8019ae:	e8 38 fe ff ff       	call   8017eb <dupq_flush>
+  8019b3:	89 c3                	mov    %eax,%ebx
+  8019b5:	83 ec 08             	sub    $0x8,%esp
+  8019b8:	68 00 00 40 00       	push   $0x400000
+  8019bd:	6a 00                	push   $0x0
+  8019bf:	e8 8b f6 ff ff       	call   80104f <sys_page_unmap>
+  8019c4:	89 d8                	mov    %ebx,%eax
+  8019c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c9:	c9                   	leave
+  8019ca:	c3                   	ret
+
+008019cb <fork>:
+  8019cb:	55                   	push   %ebp
+  8019cc:	89 e5                	mov    %esp,%ebp
+  8019ce:	53                   	push   %ebx
+  8019cf:	83 ec 10             	sub    $0x10,%esp
+  8019d2:	68 2d 18 80 00       	push   $0x80182d
+  8019d7:	e8 01 1b 00 00       	call   8034dd <set_pgfault_handler>
+  8019dc:	83 c4 08             	add    $0x8,%esp
+  8019df:	6a 01                	push   $0x1
+  8019e1:	6a 00                	push   $0x0
+  8019e3:	e8 4c f7 ff ff       	call   801134 <sys_env_set_cow>
+  8019e8:	e8 a4 f6 ff ff       	call   801091 <sys_fork>
+  8019ed:	89 c3                	mov    %eax,%ebx
+  8019ef:	83 c4 10             	add    $0x10,%esp
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	74 07                	je     8019fd <fork+0x32>
+  8019f6:	89 d8                	mov    %ebx,%eax
+  8019f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019fb:	c9                   	leave
+  8019fc:	c3                   	ret
+  8019fd:	e8 11 f5 ff ff       	call   800f13 <sys_getenvid>
+  801a02:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a07:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801a0d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a12:	a3 14 60 80 00       	mov    %eax,0x806014
+  801a17:	eb dd                	jmp    8019f6 <fork+0x2b>
+
+00801a19 <sfork>:
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	57                   	push   %edi
+  801a1d:	56                   	push   %esi
+  801a1e:	53                   	push   %ebx
+  801a1f:	83 ec 1c             	sub    $0x1c,%esp
+  801a22:	e8 ec f4 ff ff       	call   800f13 <sys_getenvid>
+  801a27:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801a2a:	83 ec 0c             	sub    $0xc,%esp
+  801a2d:	68 2d 18 80 00       	push   $0x80182d
+  801a32:	e8 a6 1a 00 00       	call   8034dd <set_pgfault_handler>
+  801a37:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a3c:	cd 30                	int    $0x30
+  801a3e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a41:	83 c4 10             	add    $0x10,%esp
+  801a44:	85 c0                	test   %eax,%eax
+  801a46:	0f 88 45 02 00 00    	js     801c91 <sfork+0x278>
+  801a4c:	89 c6                	mov    %eax,%esi
+  801a4e:	74 17                	je     801a67 <sfork+0x4e>
+  801a50:	e8 cf fe ff ff       	call   801924 <dupq_begin>
+  801a55:	85 c0                	test   %eax,%eax
+  801a57:	0f 88 40 02 00 00    	js     801c9d <sfork+0x284>
+  801a5d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a62:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801a65:	eb 39                	jmp    801aa0 <sfork+0x87>
+  801a67:	e8 a7 f4 ff ff       	call   800f13 <sys_getenvid>
+  801a6c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a71:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801a77:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a7c:	a3 14 60 80 00       	mov    %eax,0x806014
+  801a81:	e9 23 01 00 00       	jmp    801ba9 <sfork+0x190>
+  801a86:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a8d:	a8 01                	test   $0x1,%al
+  801a8f:	75 5b                	jne    801aec <sfork+0xd3>
+  801a91:	83 c7 01             	add    $0x1,%edi
+  801a94:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801a9a:	0f 84 40 01 00 00    	je     801be0 <sfork+0x1c7>
+  801aa0:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801aa7:	a8 01                	test   $0x1,%al
+  801aa9:	74 db                	je     801a86 <sfork+0x6d>
+  801aab:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801ab2:	a8 80                	test   $0x80,%al
+  801ab4:	74 d0                	je     801a86 <sfork+0x6d>
+  801ab6:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801abd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ac2:	0c 80                	or     $0x80,%al
+  801ac4:	50                   	push   %eax
+  801ac5:	ff 75 e4             	push   -0x1c(%ebp)
+  801ac8:	89 f8                	mov    %edi,%eax
+  801aca:	c1 e0 16             	shl    $0x16,%eax
+  801acd:	c1 e8 0c             	shr    $0xc,%eax
+  801ad0:	50                   	push   %eax
+  801ad1:	ff 75 e0             	push   -0x20(%ebp)
+  801ad4:	e8 6b fe ff ff       	call   801944 <dupq_map>
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	79 b1                	jns    801a91 <sfork+0x78>
+  801ae0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ae7:	e9 bd 00 00 00       	jmp    801ba9 <sfork+0x190>
+  801aec:	89 fe                	mov    %edi,%esi
+  801aee:	c1 e6 16             	shl    $0x16,%esi
+  801af1:	89 f0                	mov    %esi,%eax
+  801af3:	c1 e8 0c             	shr    $0xc,%eax
+  801af6:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801afb:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801afe:	eb 57                	jmp    801b57 <sfork+0x13e>
+  801b00:	e8 0e f4 ff ff       	call   800f13 <sys_getenvid>
+  801b05:	89 c7                	mov    %eax,%edi
+  801b07:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801b0c:	f6 c4 04             	test   $0x4,%ah
+  801b0f:	0f 85 9f 00 00 00    	jne    801bb4 <sfork+0x19b>
+  801b15:	a9 02 08 00 00       	test   $0x802,%eax
+  801b1a:	0f 85 c5 01 00 00    	jne    801ce5 <sfork+0x2cc>
+  801b20:	6a 05                	push   $0x5
+  801b22:	ff 75 e4             	push   -0x1c(%ebp)
+  801b25:	68 fd e7 0e 00       	push   $0xee7fd
+  801b2a:	57                   	push   %edi
+  801b2b:	e8 14 fe ff ff       	call   801944 <dupq_map>
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801b39:	0f 84 91 00 00 00    	je     801bd0 <sfork+0x1b7>
+  801b3f:	89 f0                	mov    %esi,%eax
+  801b41:	09 d8                	or     %ebx,%eax
+  801b43:	c1 e8 0c             	shr    $0xc,%eax
+  801b46:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b4c:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801b51:	0f 84 81 00 00 00    	je     801bd8 <sfork+0x1bf>
+  801b57:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801b5c:	74 a2                	je     801b00 <sfork+0xe7>
+  801b5e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b65:	f6 c2 01             	test   $0x1,%dl
+  801b68:	74 c9                	je     801b33 <sfork+0x11a>
+  801b6a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b71:	f6 c6 02             	test   $0x2,%dh
+  801b74:	75 bd                	jne    801b33 <sfork+0x11a>
+  801b76:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801b7d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b84:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801b8a:	f7 d2                	not    %edx
+  801b8c:	21 ca                	and    %ecx,%edx
+  801b8e:	52                   	push   %edx
+  801b8f:	ff 75 e4             	push   -0x1c(%ebp)
+  801b92:	50                   	push   %eax
+  801b93:	ff 75 e0             	push   -0x20(%ebp)
+  801b96:	e8 a9 fd ff ff       	call   801944 <dupq_map>
+  801b9b:	83 c4 10             	add    $0x10,%esp
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	79 91                	jns    801b33 <sfork+0x11a>
+  801ba2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ba9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801baf:	5b                   	pop    %ebx
+  801bb0:	5e                   	pop    %esi
+  801bb1:	5f                   	pop    %edi
+  801bb2:	5d                   	pop    %ebp
+  801bb3:	c3                   	ret
+  801bb4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bb9:	50                   	push   %eax
+  801bba:	ff 75 e4             	push   -0x1c(%ebp)
+  801bbd:	68 fd e7 0e 00       	push   $0xee7fd
+  801bc2:	57                   	push   %edi
+  801bc3:	e8 7c fd ff ff       	call   801944 <dupq_map>
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	e9 63 ff ff ff       	jmp    801b33 <sfork+0x11a>
+  801bd0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801bd3:	e9 b9 fe ff ff       	jmp    801a91 <sfork+0x78>
+  801bd8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801bdb:	e9 b1 fe ff ff       	jmp    801a91 <sfork+0x78>
+  801be0:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801be3:	e8 bf fd ff ff       	call   8019a7 <dupq_end>
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	0f 88 b9 00 00 00    	js     801ca9 <sfork+0x290>
+  801bf0:	83 ec 04             	sub    $0x4,%esp
+  801bf3:	6a 07                	push   $0x7
+  801bf5:	68 00 f0 7f ee       	push   $0xee7ff000
+  801bfa:	56                   	push   %esi
+  801bfb:	e8 7d f3 ff ff       	call   800f7d <sys_page_alloc>
+  801c00:	83 c4 10             	add    $0x10,%esp
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	0f 88 aa 00 00 00    	js     801cb5 <sfork+0x29c>
+  801c0b:	83 ec 0c             	sub    $0xc,%esp
+  801c0e:	6a 07                	push   $0x7
+  801c10:	68 00 f0 7f 00       	push   $0x7ff000
+  801c15:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801c18:	57                   	push   %edi
+  801c19:	68 00 f0 7f ee       	push   $0xee7ff000
+  801c1e:	56                   	push   %esi
+  801c1f:	e8 9c f3 ff ff       	call   800fc0 <sys_page_map>
+  801c24:	83 c4 20             	add    $0x20,%esp
+  801c27:	85 c0                	test   %eax,%eax
+  801c29:	0f 88 92 00 00 00    	js     801cc1 <sfork+0x2a8>
+  801c2f:	83 ec 04             	sub    $0x4,%esp
+  801c32:	68 00 10 00 00       	push   $0x1000
+  801c37:	68 00 f0 7f 00       	push   $0x7ff000
+  801c3c:	68 00 f0 7f ee       	push   $0xee7ff000
+  801c41:	e8 87 f0 ff ff       	call   800ccd <memmove>
+  801c46:	83 c4 08             	add    $0x8,%esp
+  801c49:	68 00 f0 7f 00       	push   $0x7ff000
+  801c4e:	57                   	push   %edi
+  801c4f:	e8 fb f3 ff ff       	call   80104f <sys_page_unmap>
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	78 72                	js     801ccd <sfork+0x2b4>
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+  801c5e:	68 55 35 80 00       	push   $0x803555
+  801c63:	56                   	push   %esi
+  801c64:	e8 2d f5 ff ff       	call   801196 <sys_env_set_pgfault_upcall>
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 69                	js     801cd9 <sfork+0x2c0>
+  801c70:	83 ec 08             	sub    $0x8,%esp
+  801c73:	6a 02                	push   $0x2
+  801c75:	56                   	push   %esi
+  801c76:	e8 35 f4 ff ff       	call   8010b0 <sys_env_set_status>
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c85:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801c89:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c8c:	e9 18 ff ff ff       	jmp    801ba9 <sfork+0x190>
+  801c91:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c98:	e9 0c ff ff ff       	jmp    801ba9 <sfork+0x190>
+  801c9d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ca4:	e9 00 ff ff ff       	jmp    801ba9 <sfork+0x190>
+  801ca9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cb0:	e9 f4 fe ff ff       	jmp    801ba9 <sfork+0x190>
+  801cb5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cbc:	e9 e8 fe ff ff       	jmp    801ba9 <sfork+0x190>
+  801cc1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cc8:	e9 dc fe ff ff       	jmp    801ba9 <sfork+0x190>
+  801ccd:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cd4:	e9 d0 fe ff ff       	jmp    801ba9 <sfork+0x190>
+  801cd9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ce0:	e9 c4 fe ff ff       	jmp    801ba9 <sfork+0x190>
+  801ce5:	68 05 08 00 00       	push   $0x805
+  801cea:	ff 75 e4             	push   -0x1c(%ebp)
+  801ced:	68 fd e7 0e 00       	push   $0xee7fd
+  801cf2:	57                   	push   %edi
+  801cf3:	e8 4c fc ff ff       	call   801944 <dupq_map>
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	0f 88 30 fe ff ff    	js     801b33 <sfork+0x11a>
+  801d03:	68 05 08 00 00       	push   $0x805
+  801d08:	57                   	push   %edi
+  801d09:	68 fd e7 0e 00       	push   $0xee7fd
+  801d0e:	57                   	push   %edi
+  801d0f:	e8 30 fc ff ff       	call   801944 <dupq_map>
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	e9 17 fe ff ff       	jmp    801b33 <sfork+0x11a>
+
+00801d1c <fd2num>:
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d22:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d27:	c1 e8 0c             	shr    $0xc,%eax
+  801d2a:	5d                   	pop    %ebp
+  801d2b:	c3                   	ret
+
+00801d2c <fd2data>:
+  801d2c:	55                   	push   %ebp
+  801d2d:	89 e5                	mov    %esp,%ebp
+  801d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d32:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d37:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d3c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801d41:	5d                   	pop    %ebp
+  801d42:	c3                   	ret
+
+00801d43 <fd_alloc>:
+  801d43:	55                   	push   %ebp
+  801d44:	89 e5                	mov    %esp,%ebp
+  801d46:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801d4b:	89 c2                	mov    %eax,%edx
+  801d4d:	c1 ea 16             	shr    $0x16,%edx
+  801d50:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d57:	f6 c2 01             	test   $0x1,%dl
+  801d5a:	74 29                	je     801d85 <fd_alloc+0x42>
+  801d5c:	89 c2                	mov    %eax,%edx
+  801d5e:	c1 ea 0c             	shr    $0xc,%edx
+  801d61:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d68:	f6 c2 01             	test   $0x1,%dl
+  801d6b:	74 18                	je     801d85 <fd_alloc+0x42>
+  801d6d:	05 00 10 00 00       	add    $0x1000,%eax
+  801d72:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801d77:	75 d2                	jne    801d4b <fd_alloc+0x8>
+  801d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d83:	eb 05                	jmp    801d8a <fd_alloc+0x47>
+  801d85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d8d:	89 02                	mov    %eax,(%edx)
+  801d8f:	89 c8                	mov    %ecx,%eax
+  801d91:	5d                   	pop    %ebp
+  801d92:	c3                   	ret
+
+00801d93 <fd_lookup>:
+  801d93:	55                   	push   %ebp
+  801d94:	89 e5                	mov    %esp,%ebp
+  801d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d99:	83 f8 1f             	cmp    $0x1f,%eax
+  801d9c:	77 30                	ja     801dce <fd_lookup+0x3b>
+  801d9e:	c1 e0 0c             	shl    $0xc,%eax
+  801da1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801da6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801dac:	f6 c2 01             	test   $0x1,%dl
+  801daf:	74 24                	je     801dd5 <fd_lookup+0x42>
+  801db1:	89 c2                	mov    %eax,%edx
+  801db3:	c1 ea 0c             	shr    $0xc,%edx
+  801db6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dbd:	f6 c2 01             	test   $0x1,%dl
+  801dc0:	74 1a                	je     801ddc <fd_lookup+0x49>
+  801dc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dc5:	89 02                	mov    %eax,(%edx)
+  801dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcc:	5d                   	pop    %ebp
+  801dcd:	c3                   	ret
+  801dce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd3:	eb f7                	jmp    801dcc <fd_lookup+0x39>
+  801dd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dda:	eb f0                	jmp    801dcc <fd_lookup+0x39>
+  801ddc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de1:	eb e9                	jmp    801dcc <fd_lookup+0x39>
+
+00801de3 <dev_lookup>:
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	53                   	push   %ebx
+  801de7:	83 ec 04             	sub    $0x4,%esp
+  801dea:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df2:	bb 08 50 80 00       	mov    $0x805008,%ebx
+  801df7:	39 13                	cmp    %edx,(%ebx)
+  801df9:	74 37                	je     801e32 <dev_lookup+0x4f>
+  801dfb:	83 c0 01             	add    $0x1,%eax
+  801dfe:	8b 1c 85 5c 40 80 00 	mov    0x80405c(,%eax,4),%ebx
+  801e05:	85 db                	test   %ebx,%ebx
+  801e07:	75 ee                	jne    801df7 <dev_lookup+0x14>
+  801e09:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e0e:	8b 40 48             	mov    0x48(%eax),%eax
+  801e11:	83 ec 04             	sub    $0x4,%esp
+  801e14:	52                   	push   %edx
+  801e15:	50                   	push   %eax
+  801e16:	68 e0 3f 80 00       	push   $0x803fe0
+  801e1b:	e8 06 e6 ff ff       	call   800426 <cprintf>
+  801e20:	83 c4 10             	add    $0x10,%esp
+  801e23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e28:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e2b:	89 1a                	mov    %ebx,(%edx)
+  801e2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e30:	c9                   	leave
+  801e31:	c3                   	ret
+  801e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e37:	eb ef                	jmp    801e28 <dev_lookup+0x45>
+
+00801e39 <fd_close>:
+  801e39:	55                   	push   %ebp
+  801e3a:	89 e5                	mov    %esp,%ebp
+  801e3c:	57                   	push   %edi
+  801e3d:	56                   	push   %esi
+  801e3e:	53                   	push   %ebx
+  801e3f:	83 ec 24             	sub    $0x24,%esp
+  801e42:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e45:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e48:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e4b:	50                   	push   %eax
+  801e4c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e52:	c1 e8 0c             	shr    $0xc,%eax
+  801e55:	50                   	push   %eax
+  801e56:	e8 38 ff ff ff       	call   801d93 <fd_lookup>
+  801e5b:	89 c3                	mov    %eax,%ebx
+  801e5d:	83 c4 10             	add    $0x10,%esp
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	78 05                	js     801e69 <fd_close+0x30>
+  801e64:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e67:	74 0f                	je     801e78 <fd_close+0x3f>
+  801e69:	85 ff                	test   %edi,%edi
+  801e6b:	0f 44 df             	cmove  %edi,%ebx
+  801e6e:	89 d8                	mov    %ebx,%eax
+  801e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e73:	5b                   	pop    %ebx
+  801e74:	5e                   	pop    %esi
+  801e75:	5f                   	pop    %edi
+  801e76:	5d                   	pop    %ebp
+  801e77:	c3                   	ret
+  801e78:	83 ec 08             	sub    $0x8,%esp
+  801e7b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e7e:	50                   	push   %eax
+  801e7f:	ff 36                	push   (%esi)
+  801e81:	e8 5d ff ff ff       	call   801de3 <dev_lookup>
+  801e86:	89 c3                	mov    %eax,%ebx
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	78 1a                	js     801ea9 <fd_close+0x70>
+  801e8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e92:	8b 40 10             	mov    0x10(%eax),%eax
+  801e95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	74 0b                	je     801ea9 <fd_close+0x70>
+  801e9e:	83 ec 0c             	sub    $0xc,%esp
+  801ea1:	56                   	push   %esi
+  801ea2:	ff d0                	call   *%eax
+  801ea4:	89 c3                	mov    %eax,%ebx
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	83 ec 08             	sub    $0x8,%esp
+  801eac:	56                   	push   %esi
+  801ead:	6a 00                	push   $0x0
+  801eaf:	e8 9b f1 ff ff       	call   80104f <sys_page_unmap>
+  801eb4:	83 c4 10             	add    $0x10,%esp
+  801eb7:	eb b5                	jmp    801e6e <fd_close+0x35>
+
+00801eb9 <close>:
+  801eb9:	55                   	push   %ebp
+  801eba:	89 e5                	mov    %esp,%ebp
+  801ebc:	83 ec 20             	sub    $0x20,%esp
+  801ebf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec2:	50                   	push   %eax
+  801ec3:	ff 75 08             	push   0x8(%ebp)
+  801ec6:	e8 c8 fe ff ff       	call   801d93 <fd_lookup>
+  801ecb:	83 c4 10             	add    $0x10,%esp
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	79 02                	jns    801ed4 <close+0x1b>
+  801ed2:	c9                   	leave
+  801ed3:	c3                   	ret
+  801ed4:	83 ec 08             	sub    $0x8,%esp
+  801ed7:	6a 01                	push   $0x1
+  801ed9:	ff 75 f4             	push   -0xc(%ebp)
+  801edc:	e8 58 ff ff ff       	call   801e39 <fd_close>
+  801ee1:	83 c4 10             	add    $0x10,%esp
+  801ee4:	eb ec                	jmp    801ed2 <close+0x19>
+
+00801ee6 <close_all>:
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	53                   	push   %ebx
+  801eea:	83 ec 04             	sub    $0x4,%esp
+  801eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	53                   	push   %ebx
+  801ef6:	e8 be ff ff ff       	call   801eb9 <close>
+  801efb:	83 c3 01             	add    $0x1,%ebx
+  801efe:	83 c4 10             	add    $0x10,%esp
+  801f01:	83 fb 20             	cmp    $0x20,%ebx
+  801f04:	75 ec                	jne    801ef2 <close_all+0xc>
+  801f06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f09:	c9                   	leave
+  801f0a:	c3                   	ret
+
+00801f0b <dup>:
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	57                   	push   %edi
+  801f0f:	56                   	push   %esi
+  801f10:	53                   	push   %ebx
+  801f11:	83 ec 34             	sub    $0x34,%esp
+  801f14:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f17:	50                   	push   %eax
+  801f18:	ff 75 08             	push   0x8(%ebp)
+  801f1b:	e8 73 fe ff ff       	call   801d93 <fd_lookup>
+  801f20:	89 c3                	mov    %eax,%ebx
+  801f22:	83 c4 10             	add    $0x10,%esp
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	78 7f                	js     801fa8 <dup+0x9d>
+  801f29:	83 ec 0c             	sub    $0xc,%esp
+  801f2c:	ff 75 0c             	push   0xc(%ebp)
+  801f2f:	e8 85 ff ff ff       	call   801eb9 <close>
+  801f34:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f37:	c1 e6 0c             	shl    $0xc,%esi
+  801f3a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801f40:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f43:	89 3c 24             	mov    %edi,(%esp)
+  801f46:	e8 e1 fd ff ff       	call   801d2c <fd2data>
+  801f4b:	89 c3                	mov    %eax,%ebx
+  801f4d:	89 34 24             	mov    %esi,(%esp)
+  801f50:	e8 d7 fd ff ff       	call   801d2c <fd2data>
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f5b:	89 d8                	mov    %ebx,%eax
+  801f5d:	c1 e8 16             	shr    $0x16,%eax
+  801f60:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f67:	a8 01                	test   $0x1,%al
+  801f69:	74 11                	je     801f7c <dup+0x71>
+  801f6b:	89 d8                	mov    %ebx,%eax
+  801f6d:	c1 e8 0c             	shr    $0xc,%eax
+  801f70:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f77:	f6 c2 01             	test   $0x1,%dl
+  801f7a:	75 36                	jne    801fb2 <dup+0xa7>
+  801f7c:	89 f8                	mov    %edi,%eax
+  801f7e:	c1 e8 0c             	shr    $0xc,%eax
+  801f81:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f88:	83 ec 0c             	sub    $0xc,%esp
+  801f8b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f90:	50                   	push   %eax
+  801f91:	56                   	push   %esi
+  801f92:	6a 00                	push   $0x0
+  801f94:	57                   	push   %edi
+  801f95:	6a 00                	push   $0x0
+  801f97:	e8 24 f0 ff ff       	call   800fc0 <sys_page_map>
+  801f9c:	89 c3                	mov    %eax,%ebx
+  801f9e:	83 c4 20             	add    $0x20,%esp
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	78 33                	js     801fd8 <dup+0xcd>
+  801fa5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fa8:	89 d8                	mov    %ebx,%eax
+  801faa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fad:	5b                   	pop    %ebx
+  801fae:	5e                   	pop    %esi
+  801faf:	5f                   	pop    %edi
+  801fb0:	5d                   	pop    %ebp
+  801fb1:	c3                   	ret
+  801fb2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fb9:	83 ec 0c             	sub    $0xc,%esp
+  801fbc:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fc1:	50                   	push   %eax
+  801fc2:	ff 75 d4             	push   -0x2c(%ebp)
+  801fc5:	6a 00                	push   $0x0
+  801fc7:	53                   	push   %ebx
+  801fc8:	6a 00                	push   $0x0
+  801fca:	e8 f1 ef ff ff       	call   800fc0 <sys_page_map>
+  801fcf:	89 c3                	mov    %eax,%ebx
+  801fd1:	83 c4 20             	add    $0x20,%esp
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	79 a4                	jns    801f7c <dup+0x71>
+  801fd8:	83 ec 08             	sub    $0x8,%esp
+  801fdb:	56                   	push   %esi
+  801fdc:	6a 00                	push   $0x0
+  801fde:	e8 6c f0 ff ff       	call   80104f <sys_page_unmap>
+  801fe3:	83 c4 08             	add    $0x8,%esp
+  801fe6:	ff 75 d4             	push   -0x2c(%ebp)
+  801fe9:	6a 00                	push   $0x0
+  801feb:	e8 5f f0 ff ff       	call   80104f <sys_page_unmap>
+  801ff0:	83 c4 10             	add    $0x10,%esp
+  801ff3:	eb b3                	jmp    801fa8 <dup+0x9d>
+
+00801ff5 <read>:
+  801ff5:	55                   	push   %ebp
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	56                   	push   %esi
+  801ff9:	53                   	push   %ebx
+  801ffa:	83 ec 18             	sub    $0x18,%esp
+  801ffd:	8b 75 08             	mov    0x8(%ebp),%esi
+  802000:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802003:	50                   	push   %eax
+  802004:	56                   	push   %esi
+  802005:	e8 89 fd ff ff       	call   801d93 <fd_lookup>
+  80200a:	83 c4 10             	add    $0x10,%esp
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	78 3c                	js     80204d <read+0x58>
+  802011:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802014:	83 ec 08             	sub    $0x8,%esp
+  802017:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80201a:	50                   	push   %eax
+  80201b:	ff 33                	push   (%ebx)
+  80201d:	e8 c1 fd ff ff       	call   801de3 <dev_lookup>
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	85 c0                	test   %eax,%eax
+  802027:	78 24                	js     80204d <read+0x58>
+  802029:	8b 43 08             	mov    0x8(%ebx),%eax
+  80202c:	83 e0 03             	and    $0x3,%eax
+  80202f:	83 f8 01             	cmp    $0x1,%eax
+  802032:	74 20                	je     802054 <read+0x5f>
+  802034:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802037:	8b 40 08             	mov    0x8(%eax),%eax
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	74 37                	je     802075 <read+0x80>
+  80203e:	83 ec 04             	sub    $0x4,%esp
+  802041:	ff 75 10             	push   0x10(%ebp)
+  802044:	ff 75 0c             	push   0xc(%ebp)
+  802047:	53                   	push   %ebx
+  802048:	ff d0                	call   *%eax
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802050:	5b                   	pop    %ebx
+  802051:	5e                   	pop    %esi
+  802052:	5d                   	pop    %ebp
+  802053:	c3                   	ret
+  802054:	a1 14 60 80 00       	mov    0x806014,%eax
+  802059:	8b 40 48             	mov    0x48(%eax),%eax
+  80205c:	83 ec 04             	sub    $0x4,%esp
+  80205f:	56                   	push   %esi
+  802060:	50                   	push   %eax
+  802061:	68 21 40 80 00       	push   $0x804021
+  802066:	e8 bb e3 ff ff       	call   800426 <cprintf>
+  80206b:	83 c4 10             	add    $0x10,%esp
+  80206e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802073:	eb d8                	jmp    80204d <read+0x58>
+  802075:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80207a:	eb d1                	jmp    80204d <read+0x58>
+
+0080207c <readn>:
+  80207c:	55                   	push   %ebp
+  80207d:	89 e5                	mov    %esp,%ebp
+  80207f:	57                   	push   %edi
+  802080:	56                   	push   %esi
+  802081:	53                   	push   %ebx
+  802082:	83 ec 0c             	sub    $0xc,%esp
+  802085:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802088:	8b 75 10             	mov    0x10(%ebp),%esi
+  80208b:	85 f6                	test   %esi,%esi
+  80208d:	74 30                	je     8020bf <readn+0x43>
+  80208f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802094:	b8 00 00 00 00       	mov    $0x0,%eax
+  802099:	83 ec 04             	sub    $0x4,%esp
+  80209c:	89 f2                	mov    %esi,%edx
+  80209e:	29 c2                	sub    %eax,%edx
+  8020a0:	52                   	push   %edx
+  8020a1:	01 f8                	add    %edi,%eax
+  8020a3:	50                   	push   %eax
+  8020a4:	ff 75 08             	push   0x8(%ebp)
+  8020a7:	e8 49 ff ff ff       	call   801ff5 <read>
+  8020ac:	83 c4 10             	add    $0x10,%esp
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 15                	js     8020c8 <readn+0x4c>
+  8020b3:	74 11                	je     8020c6 <readn+0x4a>
+  8020b5:	01 c3                	add    %eax,%ebx
+  8020b7:	89 d8                	mov    %ebx,%eax
+  8020b9:	39 f3                	cmp    %esi,%ebx
+  8020bb:	72 dc                	jb     802099 <readn+0x1d>
+  8020bd:	eb 09                	jmp    8020c8 <readn+0x4c>
+  8020bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c4:	eb 02                	jmp    8020c8 <readn+0x4c>
+  8020c6:	89 d8                	mov    %ebx,%eax
+  8020c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020cb:	5b                   	pop    %ebx
+  8020cc:	5e                   	pop    %esi
+  8020cd:	5f                   	pop    %edi
+  8020ce:	5d                   	pop    %ebp
+  8020cf:	c3                   	ret
+
+008020d0 <write>:
+  8020d0:	55                   	push   %ebp
+  8020d1:	89 e5                	mov    %esp,%ebp
+  8020d3:	56                   	push   %esi
+  8020d4:	53                   	push   %ebx
+  8020d5:	83 ec 18             	sub    $0x18,%esp
+  8020d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020de:	50                   	push   %eax
+  8020df:	53                   	push   %ebx
+  8020e0:	e8 ae fc ff ff       	call   801d93 <fd_lookup>
+  8020e5:	83 c4 10             	add    $0x10,%esp
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	78 37                	js     802123 <write+0x53>
+  8020ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020ef:	83 ec 08             	sub    $0x8,%esp
+  8020f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f5:	50                   	push   %eax
+  8020f6:	ff 36                	push   (%esi)
+  8020f8:	e8 e6 fc ff ff       	call   801de3 <dev_lookup>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 1f                	js     802123 <write+0x53>
+  802104:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802108:	74 20                	je     80212a <write+0x5a>
+  80210a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80210d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802110:	85 c0                	test   %eax,%eax
+  802112:	74 37                	je     80214b <write+0x7b>
+  802114:	83 ec 04             	sub    $0x4,%esp
+  802117:	ff 75 10             	push   0x10(%ebp)
+  80211a:	ff 75 0c             	push   0xc(%ebp)
+  80211d:	56                   	push   %esi
+  80211e:	ff d0                	call   *%eax
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802126:	5b                   	pop    %ebx
+  802127:	5e                   	pop    %esi
+  802128:	5d                   	pop    %ebp
+  802129:	c3                   	ret
+  80212a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80212f:	8b 40 48             	mov    0x48(%eax),%eax
+  802132:	83 ec 04             	sub    $0x4,%esp
+  802135:	53                   	push   %ebx
+  802136:	50                   	push   %eax
+  802137:	68 3d 40 80 00       	push   $0x80403d
+  80213c:	e8 e5 e2 ff ff       	call   800426 <cprintf>
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802149:	eb d8                	jmp    802123 <write+0x53>
+  80214b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802150:	eb d1                	jmp    802123 <write+0x53>
+
+00802152 <seek>:
+  802152:	55                   	push   %ebp
+  802153:	89 e5                	mov    %esp,%ebp
+  802155:	83 ec 20             	sub    $0x20,%esp
+  802158:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215b:	50                   	push   %eax
+  80215c:	ff 75 08             	push   0x8(%ebp)
+  80215f:	e8 2f fc ff ff       	call   801d93 <fd_lookup>
+  802164:	83 c4 10             	add    $0x10,%esp
+  802167:	85 c0                	test   %eax,%eax
+  802169:	78 0e                	js     802179 <seek+0x27>
+  80216b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80216e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802171:	89 50 04             	mov    %edx,0x4(%eax)
+  802174:	b8 00 00 00 00       	mov    $0x0,%eax
+  802179:	c9                   	leave
+  80217a:	c3                   	ret
+
+0080217b <ftruncate>:
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	56                   	push   %esi
+  80217f:	53                   	push   %ebx
+  802180:	83 ec 18             	sub    $0x18,%esp
+  802183:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802186:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802189:	50                   	push   %eax
+  80218a:	53                   	push   %ebx
+  80218b:	e8 03 fc ff ff       	call   801d93 <fd_lookup>
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	85 c0                	test   %eax,%eax
+  802195:	78 34                	js     8021cb <ftruncate+0x50>
+  802197:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80219a:	83 ec 08             	sub    $0x8,%esp
+  80219d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a0:	50                   	push   %eax
+  8021a1:	ff 36                	push   (%esi)
+  8021a3:	e8 3b fc ff ff       	call   801de3 <dev_lookup>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	78 1c                	js     8021cb <ftruncate+0x50>
+  8021af:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021b3:	74 1d                	je     8021d2 <ftruncate+0x57>
+  8021b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b8:	8b 40 18             	mov    0x18(%eax),%eax
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	74 34                	je     8021f3 <ftruncate+0x78>
+  8021bf:	83 ec 08             	sub    $0x8,%esp
+  8021c2:	ff 75 0c             	push   0xc(%ebp)
+  8021c5:	56                   	push   %esi
+  8021c6:	ff d0                	call   *%eax
+  8021c8:	83 c4 10             	add    $0x10,%esp
+  8021cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ce:	5b                   	pop    %ebx
+  8021cf:	5e                   	pop    %esi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+  8021d2:	a1 14 60 80 00       	mov    0x806014,%eax
+  8021d7:	8b 40 48             	mov    0x48(%eax),%eax
+  8021da:	83 ec 04             	sub    $0x4,%esp
+  8021dd:	53                   	push   %ebx
+  8021de:	50                   	push   %eax
+  8021df:	68 00 40 80 00       	push   $0x804000
+  8021e4:	e8 3d e2 ff ff       	call   800426 <cprintf>
+  8021e9:	83 c4 10             	add    $0x10,%esp
+  8021ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f1:	eb d8                	jmp    8021cb <ftruncate+0x50>
+  8021f3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021f8:	eb d1                	jmp    8021cb <ftruncate+0x50>
+
+008021fa <fstat>:
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	56                   	push   %esi
+  8021fe:	53                   	push   %ebx
+  8021ff:	83 ec 18             	sub    $0x18,%esp
+  802202:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802205:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802208:	50                   	push   %eax
+  802209:	ff 75 08             	push   0x8(%ebp)
+  80220c:	e8 82 fb ff ff       	call   801d93 <fd_lookup>
+  802211:	83 c4 10             	add    $0x10,%esp
+  802214:	85 c0                	test   %eax,%eax
+  802216:	78 49                	js     802261 <fstat+0x67>
+  802218:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80221b:	83 ec 08             	sub    $0x8,%esp
+  80221e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802221:	50                   	push   %eax
+  802222:	ff 36                	push   (%esi)
+  802224:	e8 ba fb ff ff       	call   801de3 <dev_lookup>
+  802229:	83 c4 10             	add    $0x10,%esp
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	78 31                	js     802261 <fstat+0x67>
+  802230:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802233:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802237:	74 2f                	je     802268 <fstat+0x6e>
+  802239:	c6 03 00             	movb   $0x0,(%ebx)
+  80223c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802243:	00 00 00 
+  802246:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80224d:	00 00 00 
+  802250:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802256:	83 ec 08             	sub    $0x8,%esp
+  802259:	53                   	push   %ebx
+  80225a:	56                   	push   %esi
+  80225b:	ff 50 14             	call   *0x14(%eax)
+  80225e:	83 c4 10             	add    $0x10,%esp
+  802261:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802264:	5b                   	pop    %ebx
+  802265:	5e                   	pop    %esi
+  802266:	5d                   	pop    %ebp
+  802267:	c3                   	ret
+  802268:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80226d:	eb f2                	jmp    802261 <fstat+0x67>
+
+0080226f <stat>:
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	56                   	push   %esi
+  802273:	53                   	push   %ebx
+  802274:	83 ec 08             	sub    $0x8,%esp
+  802277:	6a 00                	push   $0x0
+  802279:	ff 75 08             	push   0x8(%ebp)
+  80227c:	e8 31 05 00 00       	call   8027b2 <open>
+  802281:	89 c3                	mov    %eax,%ebx
+  802283:	83 c4 10             	add    $0x10,%esp
+  802286:	85 c0                	test   %eax,%eax
+  802288:	78 1b                	js     8022a5 <stat+0x36>
+  80228a:	83 ec 08             	sub    $0x8,%esp
+  80228d:	ff 75 0c             	push   0xc(%ebp)
+  802290:	50                   	push   %eax
+  802291:	e8 64 ff ff ff       	call   8021fa <fstat>
+  802296:	89 c6                	mov    %eax,%esi
+  802298:	89 1c 24             	mov    %ebx,(%esp)
+  80229b:	e8 19 fc ff ff       	call   801eb9 <close>
+  8022a0:	83 c4 10             	add    $0x10,%esp
+  8022a3:	89 f3                	mov    %esi,%ebx
+  8022a5:	89 d8                	mov    %ebx,%eax
+  8022a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022aa:	5b                   	pop    %ebx
+  8022ab:	5e                   	pop    %esi
+  8022ac:	5d                   	pop    %ebp
+  8022ad:	c3                   	ret
+
+008022ae <fsipc>:
+  8022ae:	55                   	push   %ebp
+  8022af:	89 e5                	mov    %esp,%ebp
+  8022b1:	56                   	push   %esi
+  8022b2:	53                   	push   %ebx
+  8022b3:	89 c3                	mov    %eax,%ebx
+  8022b5:	89 d6                	mov    %edx,%esi
+  8022b7:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  8022be:	74 20                	je     8022e0 <fsipc+0x32>
+  8022c0:	83 ec 08             	sub    $0x8,%esp
+  8022c3:	6a 00                	push   $0x0
+  8022c5:	56                   	push   %esi
+  8022c6:	6a 07                	push   $0x7
+  8022c8:	68 00 70 80 00       	push   $0x807000
+  8022cd:	53                   	push   %ebx
+  8022ce:	ff 35 0c 60 80 00    	push   0x80600c
+  8022d4:	e8 5f 13 00 00       	call   803638 <ipc_call>
+  8022d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022dc:	5b                   	pop    %ebx
+  8022dd:	5e                   	pop    %esi
+  8022de:	5d                   	pop    %ebp
+  8022df:	c3                   	ret
+  8022e0:	83 ec 0c             	sub    $0xc,%esp
+  8022e3:	6a 02                	push   $0x2
+  8022e5:	e8 e9 14 00 00       	call   8037d3 <ipc_find_env>
+  8022ea:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8022ef:	83 c4 10             	add    $0x10,%esp
+  8022f2:	eb cc                	jmp    8022c0 <fsipc+0x12>
+
+008022f4 <devfile_trunc>:
+  8022f4:	55                   	push   %ebp
+  8022f5:	89 e5                	mov    %esp,%ebp
+  8022f7:	83 ec 08             	sub    $0x8,%esp
+  8022fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fd:	8b 40 0c             	mov    0xc(%eax),%eax
+  802300:	a3 00 70 80 00       	mov    %eax,0x807000
+  802305:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802308:	a3 04 70 80 00       	mov    %eax,0x807004
+  80230d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802312:	b8 02 00 00 00       	mov    $0x2,%eax
+  802317:	e8 92 ff ff ff       	call   8022ae <fsipc>
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+
+0080231e <devfile_flush>:
+  80231e:	55                   	push   %ebp
+  80231f:	89 e5                	mov    %esp,%ebp
+  802321:	83 ec 08             	sub    $0x8,%esp
+  802324:	8b 45 08             	mov    0x8(%ebp),%eax
+  802327:	8b 40 0c             	mov    0xc(%eax),%eax
+  80232a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80232f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802334:	b8 08 00 00 00       	mov    $0x8,%eax
+  802339:	e8 70 ff ff ff       	call   8022ae <fsipc>
+  80233e:	c9                   	leave
+  80233f:	c3                   	ret
+
+00802340 <devfile_stat>:
+  802340:	55                   	push   %ebp
+  802341:	89 e5                	mov    %esp,%ebp
+  802343:	53                   	push   %ebx
+  802344:	83 ec 04             	sub    $0x4,%esp
+  802347:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80234a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802350:	a3 00 70 80 00       	mov    %eax,0x807000
+  802355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80235f:	e8 4a ff ff ff       	call   8022ae <fsipc>
+  802364:	85 c0                	test   %eax,%eax
+  802366:	78 2c                	js     802394 <devfile_stat+0x54>
+  802368:	83 ec 08             	sub    $0x8,%esp
+  80236b:	68 00 70 80 00       	push   $0x807000
+  802370:	53                   	push   %ebx
+  802371:	e8 a7 e7 ff ff       	call   800b1d <strcpy>
+  802376:	a1 80 70 80 00       	mov    0x807080,%eax
+  80237b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802381:	a1 84 70 80 00       	mov    0x807084,%eax
+  802386:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80238c:	83 c4 10             	add    $0x10,%esp
+  80238f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802394:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802397:	c9                   	leave
+  802398:	c3                   	ret
+
+00802399 <fsring_rw>:
+  802399:	55                   	push   %ebp
+  80239a:	89 e5                	mov    %esp,%ebp
+  80239c:	57                   	push   %edi
+  80239d:	56                   	push   %esi
+  80239e:	53                   	push   %ebx
+  80239f:	83 ec 2c             	sub    $0x2c,%esp
+  8023a2:	89 c7                	mov    %eax,%edi
+  8023a4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8023a7:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8023aa:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8023af:	a8 01                	test   $0x1,%al
+  8023b1:	74 0d                	je     8023c0 <fsring_rw+0x27>
+  8023b3:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8023b8:	a8 01                	test   $0x1,%al
+  8023ba:	0f 85 d5 00 00 00    	jne    802495 <fsring_rw+0xfc>
+  8023c0:	a1 14 60 80 00       	mov    0x806014,%eax
+  8023c5:	8b 40 48             	mov    0x48(%eax),%eax
+  8023c8:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  8023ce:	0f 84 fc 00 00 00    	je     8024d0 <fsring_rw+0x137>
+  8023d4:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  8023db:	0f 84 02 01 00 00    	je     8024e3 <fsring_rw+0x14a>
+  8023e1:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8023e6:	83 ec 04             	sub    $0x4,%esp
+  8023e9:	68 07 02 00 00       	push   $0x207
+  8023ee:	53                   	push   %ebx
+  8023ef:	6a 00                	push   $0x0
+  8023f1:	e8 87 eb ff ff       	call   800f7d <sys_page_alloc>
+  8023f6:	83 c4 10             	add    $0x10,%esp
+  8023f9:	85 c0                	test   %eax,%eax
+  8023fb:	0f 88 f9 00 00 00    	js     8024fa <fsring_rw+0x161>
+  802401:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802407:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80240d:	75 d7                	jne    8023e6 <fsring_rw+0x4d>
+  80240f:	6a 0e                	push   $0xe
+  802411:	6a 0d                	push   $0xd
+  802413:	ff 35 0c 60 80 00    	push   0x80600c
+  802419:	68 00 00 f0 cf       	push   $0xcff00000
+  80241e:	e8 26 0d 00 00       	call   803149 <ipcring_init>
+  802423:	83 c4 08             	add    $0x8,%esp
+  802426:	6a 00                	push   $0x0
+  802428:	6a 00                	push   $0x0
+  80242a:	68 07 02 00 00       	push   $0x207
+  80242f:	68 00 00 f0 cf       	push   $0xcff00000
+  802434:	6a 0b                	push   $0xb
+  802436:	ff 35 0c 60 80 00    	push   0x80600c
+  80243c:	e8 f7 11 00 00       	call   803638 <ipc_call>
+  802441:	89 c6                	mov    %eax,%esi
+  802443:	83 c4 20             	add    $0x20,%esp
+  802446:	85 c0                	test   %eax,%eax
+  802448:	0f 88 ac 00 00 00    	js     8024fa <fsring_rw+0x161>
+  80244e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802453:	89 d9                	mov    %ebx,%ecx
+  802455:	83 c3 01             	add    $0x1,%ebx
+  802458:	89 da                	mov    %ebx,%edx
+  80245a:	c1 e2 0c             	shl    $0xc,%edx
+  80245d:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802463:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802469:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80246f:	83 ec 08             	sub    $0x8,%esp
+  802472:	6a 00                	push   $0x0
+  802474:	6a 00                	push   $0x0
+  802476:	68 07 02 00 00       	push   $0x207
+  80247b:	50                   	push   %eax
+  80247c:	6a 0c                	push   $0xc
+  80247e:	ff 35 0c 60 80 00    	push   0x80600c
+  802484:	e8 af 11 00 00       	call   803638 <ipc_call>
+  802489:	83 c4 20             	add    $0x20,%esp
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 6a                	js     8024fa <fsring_rw+0x161>
+  802490:	83 fb 08             	cmp    $0x8,%ebx
+  802493:	75 be                	jne    802453 <fsring_rw+0xba>
+  802495:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802499:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80249e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024a3:	0f 45 c2             	cmovne %edx,%eax
+  8024a6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8024a9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8024b0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8024b7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8024be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c8:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8024cb:	e9 4b 01 00 00       	jmp    80261b <fsring_rw+0x282>
+  8024d0:	e8 72 ee ff ff       	call   801347 <sys_time_msec>
+  8024d5:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  8024db:	0f 89 f3 fe ff ff    	jns    8023d4 <fsring_rw+0x3b>
+  8024e1:	eb 54                	jmp    802537 <fsring_rw+0x19e>
+  8024e3:	83 ec 0c             	sub    $0xc,%esp
+  8024e6:	6a 02                	push   $0x2
+  8024e8:	e8 e6 12 00 00       	call   8037d3 <ipc_find_env>
+  8024ed:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8024f2:	83 c4 10             	add    $0x10,%esp
+  8024f5:	e9 e7 fe ff ff       	jmp    8023e1 <fsring_rw+0x48>
+  8024fa:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8024ff:	83 ec 08             	sub    $0x8,%esp
+  802502:	53                   	push   %ebx
+  802503:	6a 00                	push   $0x0
+  802505:	e8 45 eb ff ff       	call   80104f <sys_page_unmap>
+  80250a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802519:	75 e4                	jne    8024ff <fsring_rw+0x166>
+  80251b:	e8 27 ee ff ff       	call   801347 <sys_time_msec>
+  802520:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802525:	a3 04 60 80 00       	mov    %eax,0x806004
+  80252a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80252f:	8b 40 48             	mov    0x48(%eax),%eax
+  802532:	a3 08 60 80 00       	mov    %eax,0x806008
+  802537:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80253e:	e9 7a 01 00 00       	jmp    8026bd <fsring_rw+0x324>
+  802543:	8b 57 0c             	mov    0xc(%edi),%edx
+  802546:	89 10                	mov    %edx,(%eax)
+  802548:	89 58 04             	mov    %ebx,0x4(%eax)
+  80254b:	89 f2                	mov    %esi,%edx
+  80254d:	03 57 04             	add    0x4(%edi),%edx
+  802550:	89 50 08             	mov    %edx,0x8(%eax)
+  802553:	83 ec 04             	sub    $0x4,%esp
+  802556:	53                   	push   %ebx
+  802557:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80255a:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80255d:	52                   	push   %edx
+  80255e:	83 c0 0c             	add    $0xc,%eax
+  802561:	50                   	push   %eax
+  802562:	e8 66 e7 ff ff       	call   800ccd <memmove>
+  802567:	83 c4 10             	add    $0x10,%esp
+  80256a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80256d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802570:	89 08                	mov    %ecx,(%eax)
+  802572:	83 ec 0c             	sub    $0xc,%esp
+  802575:	68 00 00 f0 cf       	push   $0xcff00000
+  80257a:	e8 28 0c 00 00       	call   8031a7 <ipcring_req_push>
+  80257f:	01 de                	add    %ebx,%esi
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802587:	73 4c                	jae    8025d5 <fsring_rw+0x23c>
+  802589:	83 ec 0c             	sub    $0xc,%esp
+  80258c:	68 00 00 f0 cf       	push   $0xcff00000
+  802591:	e8 eb 0b 00 00       	call   803181 <ipcring_req_slot>
+  802596:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	74 35                	je     8025d5 <fsring_rw+0x23c>
+  8025a0:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8025a5:	83 e0 07             	and    $0x7,%eax
+  8025a8:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8025ad:	c1 e0 0c             	shl    $0xc,%eax
+  8025b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025b3:	29 f3                	sub    %esi,%ebx
+  8025b5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8025b8:	39 cb                	cmp    %ecx,%ebx
+  8025ba:	0f 47 d9             	cmova  %ecx,%ebx
+  8025bd:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8025c1:	75 80                	jne    802543 <fsring_rw+0x1aa>
+  8025c3:	8b 57 0c             	mov    0xc(%edi),%edx
+  8025c6:	89 10                	mov    %edx,(%eax)
+  8025c8:	89 58 04             	mov    %ebx,0x4(%eax)
+  8025cb:	89 f2                	mov    %esi,%edx
+  8025cd:	03 57 04             	add    0x4(%edi),%edx
+  8025d0:	89 50 08             	mov    %edx,0x8(%eax)
+  8025d3:	eb 95                	jmp    80256a <fsring_rw+0x1d1>
+  8025d5:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8025da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025dd:	83 ec 0c             	sub    $0xc,%esp
+  8025e0:	68 00 00 f0 cf       	push   $0xcff00000
+  8025e5:	e8 f6 0b 00 00       	call   8031e0 <ipcring_rsp_wait>
+  8025ea:	8b 58 04             	mov    0x4(%eax),%ebx
+  8025ed:	83 c4 10             	add    $0x10,%esp
+  8025f0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8025f4:	75 45                	jne    80263b <fsring_rw+0x2a2>
+  8025f6:	85 db                	test   %ebx,%ebx
+  8025f8:	79 41                	jns    80263b <fsring_rw+0x2a2>
+  8025fa:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8025fd:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802604:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  80260b:	83 ec 0c             	sub    $0xc,%esp
+  80260e:	68 00 00 f0 cf       	push   $0xcff00000
+  802613:	e8 2e 0c 00 00       	call   803246 <ipcring_rsp_pop>
+  802618:	83 c4 10             	add    $0x10,%esp
+  80261b:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802621:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802626:	39 c2                	cmp    %eax,%edx
+  802628:	74 75                	je     80269f <fsring_rw+0x306>
+  80262a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80262e:	75 a5                	jne    8025d5 <fsring_rw+0x23c>
+  802630:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802633:	0f 82 50 ff ff ff    	jb     802589 <fsring_rw+0x1f0>
+  802639:	eb 9a                	jmp    8025d5 <fsring_rw+0x23c>
+  80263b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80263f:	75 ca                	jne    80260b <fsring_rw+0x272>
+  802641:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802645:	74 31                	je     802678 <fsring_rw+0x2df>
+  802647:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264a:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80264d:	29 c8                	sub    %ecx,%eax
+  80264f:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802652:	39 d0                	cmp    %edx,%eax
+  802654:	0f 47 c2             	cmova  %edx,%eax
+  802657:	39 d8                	cmp    %ebx,%eax
+  802659:	ba 01 00 00 00       	mov    $0x1,%edx
+  80265e:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802662:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802665:	b8 01 00 00 00       	mov    $0x1,%eax
+  80266a:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80266e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802671:	01 d9                	add    %ebx,%ecx
+  802673:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802676:	eb 93                	jmp    80260b <fsring_rw+0x272>
+  802678:	83 ec 04             	sub    $0x4,%esp
+  80267b:	53                   	push   %ebx
+  80267c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80267f:	83 e0 07             	and    $0x7,%eax
+  802682:	c1 e0 0c             	shl    $0xc,%eax
+  802685:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80268b:	50                   	push   %eax
+  80268c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80268f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802692:	01 c8                	add    %ecx,%eax
+  802694:	50                   	push   %eax
+  802695:	e8 33 e6 ff ff       	call   800ccd <memmove>
+  80269a:	83 c4 10             	add    $0x10,%esp
+  80269d:	eb a8                	jmp    802647 <fsring_rw+0x2ae>
+  80269f:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8026a3:	75 09                	jne    8026ae <fsring_rw+0x315>
+  8026a5:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8026a8:	0f 82 db fe ff ff    	jb     802589 <fsring_rw+0x1f0>
+  8026ae:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8026b1:	01 57 04             	add    %edx,0x4(%edi)
+  8026b4:	85 d2                	test   %edx,%edx
+  8026b6:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8026ba:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8026bd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8026c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c3:	5b                   	pop    %ebx
+  8026c4:	5e                   	pop    %esi
+  8026c5:	5f                   	pop    %edi
+  8026c6:	5d                   	pop    %ebp
+  8026c7:	c3                   	ret
+
+008026c8 <devfile_write>:
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	57                   	push   %edi
+  8026cc:	56                   	push   %esi
+  8026cd:	53                   	push   %ebx
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  8026d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8026d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026da:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8026e0:	76 1a                	jbe    8026fc <devfile_write+0x34>
+  8026e2:	83 ec 0c             	sub    $0xc,%esp
+  8026e5:	53                   	push   %ebx
+  8026e6:	89 f1                	mov    %esi,%ecx
+  8026e8:	ba 06 00 00 00       	mov    $0x6,%edx
+  8026ed:	89 f8                	mov    %edi,%eax
+  8026ef:	e8 a5 fc ff ff       	call   802399 <fsring_rw>
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8026fa:	75 39                	jne    802735 <devfile_write+0x6d>
+  8026fc:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802701:	39 c3                	cmp    %eax,%ebx
+  802703:	0f 47 d8             	cmova  %eax,%ebx
+  802706:	8b 47 0c             	mov    0xc(%edi),%eax
+  802709:	a3 00 70 80 00       	mov    %eax,0x807000
+  80270e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802714:	83 ec 04             	sub    $0x4,%esp
+  802717:	53                   	push   %ebx
+  802718:	56                   	push   %esi
+  802719:	68 08 70 80 00       	push   $0x807008
+  80271e:	e8 aa e5 ff ff       	call   800ccd <memmove>
+  802723:	ba 00 00 00 00       	mov    $0x0,%edx
+  802728:	b8 04 00 00 00       	mov    $0x4,%eax
+  80272d:	e8 7c fb ff ff       	call   8022ae <fsipc>
+  802732:	83 c4 10             	add    $0x10,%esp
+  802735:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802738:	5b                   	pop    %ebx
+  802739:	5e                   	pop    %esi
+  80273a:	5f                   	pop    %edi
+  80273b:	5d                   	pop    %ebp
+  80273c:	c3                   	ret
+
+0080273d <devfile_read>:
+  80273d:	55                   	push   %ebp
+  80273e:	89 e5                	mov    %esp,%ebp
+  802740:	57                   	push   %edi
+  802741:	56                   	push   %esi
+  802742:	53                   	push   %ebx
+  802743:	83 ec 0c             	sub    $0xc,%esp
+  802746:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802749:	8b 75 10             	mov    0x10(%ebp),%esi
+  80274c:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802752:	76 1d                	jbe    802771 <devfile_read+0x34>
+  802754:	83 ec 0c             	sub    $0xc,%esp
+  802757:	56                   	push   %esi
+  802758:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80275b:	ba 05 00 00 00       	mov    $0x5,%edx
+  802760:	89 f8                	mov    %edi,%eax
+  802762:	e8 32 fc ff ff       	call   802399 <fsring_rw>
+  802767:	89 c3                	mov    %eax,%ebx
+  802769:	83 c4 10             	add    $0x10,%esp
+  80276c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80276f:	75 37                	jne    8027a8 <devfile_read+0x6b>
+  802771:	8b 47 0c             	mov    0xc(%edi),%eax
+  802774:	a3 00 70 80 00       	mov    %eax,0x807000
+  802779:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80277f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802784:	b8 03 00 00 00       	mov    $0x3,%eax
+  802789:	e8 20 fb ff ff       	call   8022ae <fsipc>
+  80278e:	89 c3                	mov    %eax,%ebx
+  802790:	85 c0                	test   %eax,%eax
+  802792:	78 14                	js     8027a8 <devfile_read+0x6b>
+  802794:	83 ec 04             	sub    $0x4,%esp
+  802797:	50                   	push   %eax
+  802798:	68 00 70 80 00       	push   $0x807000
+  80279d:	ff 75 0c             	push   0xc(%ebp)
+  8027a0:	e8 28 e5 ff ff       	call   800ccd <memmove>
+  8027a5:	83 c4 10             	add    $0x10,%esp
+  8027a8:	89 d8                	mov    %ebx,%eax
+  8027aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ad:	5b                   	pop    %ebx
+  8027ae:	5e                   	pop    %esi
+  8027af:	5f                   	pop    %edi
+  8027b0:	5d                   	pop    %ebp
+  8027b1:	c3                   	ret
+
+008027b2 <open>:
+  8027b2:	55                   	push   %ebp
+  8027b3:	89 e5                	mov    %esp,%ebp
+  8027b5:	56                   	push   %esi
+  8027b6:	53                   	push   %ebx
+  8027b7:	83 ec 1c             	sub    $0x1c,%esp
+  8027ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027bd:	56                   	push   %esi
+  8027be:	e8 0e e3 ff ff       	call   800ad1 <strlen>
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  8027c6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027cb:	7f 6c                	jg     802839 <open+0x87>
+  8027cd:	83 ec 0c             	sub    $0xc,%esp
+  8027d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027d3:	50                   	push   %eax
+  8027d4:	e8 6a f5 ff ff       	call   801d43 <fd_alloc>
+  8027d9:	89 c3                	mov    %eax,%ebx
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	78 3c                	js     80281e <open+0x6c>
+  8027e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027e5:	a3 00 74 80 00       	mov    %eax,0x807400
+  8027ea:	83 ec 08             	sub    $0x8,%esp
+  8027ed:	56                   	push   %esi
+  8027ee:	68 00 70 80 00       	push   $0x807000
+  8027f3:	e8 25 e3 ff ff       	call   800b1d <strcpy>
+  8027f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802800:	e8 a9 fa ff ff       	call   8022ae <fsipc>
+  802805:	89 c3                	mov    %eax,%ebx
+  802807:	83 c4 10             	add    $0x10,%esp
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	78 19                	js     802827 <open+0x75>
+  80280e:	83 ec 0c             	sub    $0xc,%esp
+  802811:	ff 75 f4             	push   -0xc(%ebp)
+  802814:	e8 03 f5 ff ff       	call   801d1c <fd2num>
+  802819:	89 c3                	mov    %eax,%ebx
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	89 d8                	mov    %ebx,%eax
+  802820:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802823:	5b                   	pop    %ebx
+  802824:	5e                   	pop    %esi
+  802825:	5d                   	pop    %ebp
+  802826:	c3                   	ret
+  802827:	83 ec 08             	sub    $0x8,%esp
+  80282a:	6a 00                	push   $0x0
+  80282c:	ff 75 f4             	push   -0xc(%ebp)
+  80282f:	e8 05 f6 ff ff       	call   801e39 <fd_close>
+  802834:	83 c4 10             	add    $0x10,%esp
+  802837:	eb e5                	jmp    80281e <open+0x6c>
+  802839:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80283e:	eb de                	jmp    80281e <open+0x6c>
+
+00802840 <file_image>:
+  802840:	55                   	push   %ebp
+  802841:	89 e5                	mov    %esp,%ebp
+  802843:	53                   	push   %ebx
+  802844:	83 ec 1c             	sub    $0x1c,%esp
+  802847:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80284a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80284d:	50                   	push   %eax
+  80284e:	ff 75 08             	push   0x8(%ebp)
+  802851:	e8 3d f5 ff ff       	call   801d93 <fd_lookup>
+  802856:	83 c4 10             	add    $0x10,%esp
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	78 58                	js     8028b5 <file_image+0x75>
+  80285d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802860:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802866:	39 08                	cmp    %ecx,(%eax)
+  802868:	75 50                	jne    8028ba <file_image+0x7a>
+  80286a:	83 fb 04             	cmp    $0x4,%ebx
+  80286d:	77 52                	ja     8028c1 <file_image+0x81>
+  80286f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802872:	a3 00 70 80 00       	mov    %eax,0x807000
+  802877:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80287d:	83 ec 04             	sub    $0x4,%esp
+  802880:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802883:	c1 e0 02             	shl    $0x2,%eax
+  802886:	50                   	push   %eax
+  802887:	ff 75 0c             	push   0xc(%ebp)
+  80288a:	68 08 70 80 00       	push   $0x807008
+  80288f:	e8 39 e4 ff ff       	call   800ccd <memmove>
+  802894:	ba 00 00 00 00       	mov    $0x0,%edx
+  802899:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80289e:	e8 0b fa ff ff       	call   8022ae <fsipc>
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  8028a6:	85 c0                	test   %eax,%eax
+  8028a8:	78 0b                	js     8028b5 <file_image+0x75>
+  8028aa:	8b 55 14             	mov    0x14(%ebp),%edx
+  8028ad:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  8028b3:	89 0a                	mov    %ecx,(%edx)
+  8028b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+  8028ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028bf:	eb f4                	jmp    8028b5 <file_image+0x75>
+  8028c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c6:	eb ed                	jmp    8028b5 <file_image+0x75>
+
+008028c8 <remove>:
+  8028c8:	55                   	push   %ebp
+  8028c9:	89 e5                	mov    %esp,%ebp
+  8028cb:	53                   	push   %ebx
+  8028cc:	83 ec 10             	sub    $0x10,%esp
+  8028cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028d2:	53                   	push   %ebx
+  8028d3:	e8 f9 e1 ff ff       	call   800ad1 <strlen>
+  8028d8:	83 c4 10             	add    $0x10,%esp
+  8028db:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028e0:	7f 25                	jg     802907 <remove+0x3f>
+  8028e2:	83 ec 08             	sub    $0x8,%esp
+  8028e5:	53                   	push   %ebx
+  8028e6:	68 00 70 80 00       	push   $0x807000
+  8028eb:	e8 2d e2 ff ff       	call   800b1d <strcpy>
+  8028f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8028fa:	e8 af f9 ff ff       	call   8022ae <fsipc>
+  8028ff:	83 c4 10             	add    $0x10,%esp
+  802902:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802905:	c9                   	leave
+  802906:	c3                   	ret
+  802907:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80290c:	eb f4                	jmp    802902 <remove+0x3a>
+
+0080290e <sync>:
+  80290e:	55                   	push   %ebp
+  80290f:	89 e5                	mov    %esp,%ebp
+  802911:	83 ec 08             	sub    $0x8,%esp
+  802914:	ba 00 00 00 00       	mov    $0x0,%edx
+  802919:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80291e:	e8 8b f9 ff ff       	call   8022ae <fsipc>
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+00802925 <devsock_stat>:
+  802925:	55                   	push   %ebp
+  802926:	89 e5                	mov    %esp,%ebp
+  802928:	83 ec 10             	sub    $0x10,%esp
+  80292b:	68 70 40 80 00       	push   $0x804070
+  802930:	ff 75 0c             	push   0xc(%ebp)
+  802933:	e8 e5 e1 ff ff       	call   800b1d <strcpy>
+  802938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293d:	c9                   	leave
+  80293e:	c3                   	ret
+
+0080293f <devsock_close>:
+  80293f:	55                   	push   %ebp
+  802940:	89 e5                	mov    %esp,%ebp
+  802942:	53                   	push   %ebx
+  802943:	83 ec 10             	sub    $0x10,%esp
+  802946:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802949:	53                   	push   %ebx
+  80294a:	e8 9e 0e 00 00       	call   8037ed <pageref>
+  80294f:	89 c2                	mov    %eax,%edx
+  802951:	83 c4 10             	add    $0x10,%esp
+  802954:	b8 00 00 00 00       	mov    $0x0,%eax
+  802959:	83 fa 01             	cmp    $0x1,%edx
+  80295c:	74 05                	je     802963 <devsock_close+0x24>
+  80295e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802961:	c9                   	leave
+  802962:	c3                   	ret
+  802963:	83 ec 0c             	sub    $0xc,%esp
+  802966:	ff 73 0c             	push   0xc(%ebx)
+  802969:	e8 aa 02 00 00       	call   802c18 <nsipc_close>
+  80296e:	83 c4 10             	add    $0x10,%esp
+  802971:	eb eb                	jmp    80295e <devsock_close+0x1f>
+
+00802973 <devsock_write>:
+  802973:	55                   	push   %ebp
+  802974:	89 e5                	mov    %esp,%ebp
+  802976:	83 ec 08             	sub    $0x8,%esp
+  802979:	6a 00                	push   $0x0
+  80297b:	ff 75 10             	push   0x10(%ebp)
+  80297e:	ff 75 0c             	push   0xc(%ebp)
+  802981:	8b 45 08             	mov    0x8(%ebp),%eax
+  802984:	ff 70 0c             	push   0xc(%eax)
+  802987:	e8 6c 03 00 00       	call   802cf8 <nsipc_send>
+  80298c:	c9                   	leave
+  80298d:	c3                   	ret
+
+0080298e <devsock_read>:
+  80298e:	55                   	push   %ebp
+  80298f:	89 e5                	mov    %esp,%ebp
+  802991:	83 ec 08             	sub    $0x8,%esp
+  802994:	6a 00                	push   $0x0
+  802996:	ff 75 10             	push   0x10(%ebp)
+  802999:	ff 75 0c             	push   0xc(%ebp)
+  80299c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299f:	ff 70 0c             	push   0xc(%eax)
+  8029a2:	e8 e2 02 00 00       	call   802c89 <nsipc_recv>
+  8029a7:	c9                   	leave
+  8029a8:	c3                   	ret
+
+008029a9 <fd2sockid>:
+  8029a9:	55                   	push   %ebp
+  8029aa:	89 e5                	mov    %esp,%ebp
+  8029ac:	83 ec 20             	sub    $0x20,%esp
+  8029af:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029b2:	52                   	push   %edx
+  8029b3:	50                   	push   %eax
+  8029b4:	e8 da f3 ff ff       	call   801d93 <fd_lookup>
+  8029b9:	83 c4 10             	add    $0x10,%esp
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	78 10                	js     8029d0 <fd2sockid+0x27>
+  8029c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c3:	8b 0d 24 50 80 00    	mov    0x805024,%ecx
+  8029c9:	39 08                	cmp    %ecx,(%eax)
+  8029cb:	75 05                	jne    8029d2 <fd2sockid+0x29>
+  8029cd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029d0:	c9                   	leave
+  8029d1:	c3                   	ret
+  8029d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029d7:	eb f7                	jmp    8029d0 <fd2sockid+0x27>
+
+008029d9 <alloc_sockfd>:
+  8029d9:	55                   	push   %ebp
+  8029da:	89 e5                	mov    %esp,%ebp
+  8029dc:	56                   	push   %esi
+  8029dd:	53                   	push   %ebx
+  8029de:	83 ec 1c             	sub    $0x1c,%esp
+  8029e1:	89 c6                	mov    %eax,%esi
+  8029e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029e6:	50                   	push   %eax
+  8029e7:	e8 57 f3 ff ff       	call   801d43 <fd_alloc>
+  8029ec:	89 c3                	mov    %eax,%ebx
+  8029ee:	83 c4 10             	add    $0x10,%esp
+  8029f1:	85 c0                	test   %eax,%eax
+  8029f3:	78 43                	js     802a38 <alloc_sockfd+0x5f>
+  8029f5:	83 ec 04             	sub    $0x4,%esp
+  8029f8:	68 07 04 00 00       	push   $0x407
+  8029fd:	ff 75 f4             	push   -0xc(%ebp)
+  802a00:	6a 00                	push   $0x0
+  802a02:	e8 76 e5 ff ff       	call   800f7d <sys_page_alloc>
+  802a07:	89 c3                	mov    %eax,%ebx
+  802a09:	83 c4 10             	add    $0x10,%esp
+  802a0c:	85 c0                	test   %eax,%eax
+  802a0e:	78 28                	js     802a38 <alloc_sockfd+0x5f>
+  802a10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a13:	8b 15 24 50 80 00    	mov    0x805024,%edx
+  802a19:	89 10                	mov    %edx,(%eax)
+  802a1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a1e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802a25:	89 70 0c             	mov    %esi,0xc(%eax)
+  802a28:	83 ec 0c             	sub    $0xc,%esp
+  802a2b:	50                   	push   %eax
+  802a2c:	e8 eb f2 ff ff       	call   801d1c <fd2num>
+  802a31:	89 c3                	mov    %eax,%ebx
+  802a33:	83 c4 10             	add    $0x10,%esp
+  802a36:	eb 0c                	jmp    802a44 <alloc_sockfd+0x6b>
+  802a38:	83 ec 0c             	sub    $0xc,%esp
+  802a3b:	56                   	push   %esi
+  802a3c:	e8 d7 01 00 00       	call   802c18 <nsipc_close>
+  802a41:	83 c4 10             	add    $0x10,%esp
+  802a44:	89 d8                	mov    %ebx,%eax
+  802a46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a49:	5b                   	pop    %ebx
+  802a4a:	5e                   	pop    %esi
+  802a4b:	5d                   	pop    %ebp
+  802a4c:	c3                   	ret
+
+00802a4d <accept>:
+  802a4d:	55                   	push   %ebp
+  802a4e:	89 e5                	mov    %esp,%ebp
+  802a50:	83 ec 08             	sub    $0x8,%esp
+  802a53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a56:	e8 4e ff ff ff       	call   8029a9 <fd2sockid>
+  802a5b:	85 c0                	test   %eax,%eax
+  802a5d:	78 1b                	js     802a7a <accept+0x2d>
+  802a5f:	83 ec 04             	sub    $0x4,%esp
+  802a62:	ff 75 10             	push   0x10(%ebp)
+  802a65:	ff 75 0c             	push   0xc(%ebp)
+  802a68:	50                   	push   %eax
+  802a69:	e8 07 01 00 00       	call   802b75 <nsipc_accept>
+  802a6e:	83 c4 10             	add    $0x10,%esp
+  802a71:	85 c0                	test   %eax,%eax
+  802a73:	78 05                	js     802a7a <accept+0x2d>
+  802a75:	e8 5f ff ff ff       	call   8029d9 <alloc_sockfd>
+  802a7a:	c9                   	leave
+  802a7b:	c3                   	ret
+
+00802a7c <bind>:
+  802a7c:	55                   	push   %ebp
+  802a7d:	89 e5                	mov    %esp,%ebp
+  802a7f:	83 ec 08             	sub    $0x8,%esp
+  802a82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a85:	e8 1f ff ff ff       	call   8029a9 <fd2sockid>
+  802a8a:	85 c0                	test   %eax,%eax
+  802a8c:	78 12                	js     802aa0 <bind+0x24>
+  802a8e:	83 ec 04             	sub    $0x4,%esp
+  802a91:	ff 75 10             	push   0x10(%ebp)
+  802a94:	ff 75 0c             	push   0xc(%ebp)
+  802a97:	50                   	push   %eax
+  802a98:	e8 24 01 00 00       	call   802bc1 <nsipc_bind>
+  802a9d:	83 c4 10             	add    $0x10,%esp
+  802aa0:	c9                   	leave
+  802aa1:	c3                   	ret
+
+00802aa2 <shutdown>:
+  802aa2:	55                   	push   %ebp
+  802aa3:	89 e5                	mov    %esp,%ebp
+  802aa5:	83 ec 08             	sub    $0x8,%esp
+  802aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aab:	e8 f9 fe ff ff       	call   8029a9 <fd2sockid>
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	78 0f                	js     802ac3 <shutdown+0x21>
+  802ab4:	83 ec 08             	sub    $0x8,%esp
+  802ab7:	ff 75 0c             	push   0xc(%ebp)
+  802aba:	50                   	push   %eax
+  802abb:	e8 36 01 00 00       	call   802bf6 <nsipc_shutdown>
+  802ac0:	83 c4 10             	add    $0x10,%esp
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <connect>:
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	83 ec 08             	sub    $0x8,%esp
+  802acb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ace:	e8 d6 fe ff ff       	call   8029a9 <fd2sockid>
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	78 12                	js     802ae9 <connect+0x24>
+  802ad7:	83 ec 04             	sub    $0x4,%esp
+  802ada:	ff 75 10             	push   0x10(%ebp)
+  802add:	ff 75 0c             	push   0xc(%ebp)
+  802ae0:	50                   	push   %eax
+  802ae1:	e8 4c 01 00 00       	call   802c32 <nsipc_connect>
+  802ae6:	83 c4 10             	add    $0x10,%esp
+  802ae9:	c9                   	leave
+  802aea:	c3                   	ret
+
+00802aeb <listen>:
+  802aeb:	55                   	push   %ebp
+  802aec:	89 e5                	mov    %esp,%ebp
+  802aee:	83 ec 08             	sub    $0x8,%esp
+  802af1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af4:	e8 b0 fe ff ff       	call   8029a9 <fd2sockid>
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	78 0f                	js     802b0c <listen+0x21>
+  802afd:	83 ec 08             	sub    $0x8,%esp
+  802b00:	ff 75 0c             	push   0xc(%ebp)
+  802b03:	50                   	push   %eax
+  802b04:	e8 5e 01 00 00       	call   802c67 <nsipc_listen>
+  802b09:	83 c4 10             	add    $0x10,%esp
+  802b0c:	c9                   	leave
+  802b0d:	c3                   	ret
+
+00802b0e <socket>:
+  802b0e:	55                   	push   %ebp
+  802b0f:	89 e5                	mov    %esp,%ebp
+  802b11:	83 ec 0c             	sub    $0xc,%esp
+  802b14:	ff 75 10             	push   0x10(%ebp)
+  802b17:	ff 75 0c             	push   0xc(%ebp)
+  802b1a:	ff 75 08             	push   0x8(%ebp)
+  802b1d:	e8 34 02 00 00       	call   802d56 <nsipc_socket>
+  802b22:	83 c4 10             	add    $0x10,%esp
+  802b25:	85 c0                	test   %eax,%eax
+  802b27:	78 05                	js     802b2e <socket+0x20>
+  802b29:	e8 ab fe ff ff       	call   8029d9 <alloc_sockfd>
+  802b2e:	c9                   	leave
+  802b2f:	c3                   	ret
+
+00802b30 <nsipc>:
+  802b30:	55                   	push   %ebp
+  802b31:	89 e5                	mov    %esp,%ebp
+  802b33:	53                   	push   %ebx
+  802b34:	83 ec 04             	sub    $0x4,%esp
+  802b37:	89 c3                	mov    %eax,%ebx
+  802b39:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  802b40:	74 1f                	je     802b61 <nsipc+0x31>
+  802b42:	83 ec 08             	sub    $0x8,%esp
+  802b45:	6a 00                	push   $0x0
+  802b47:	6a 00                	push   $0x0
+  802b49:	6a 07                	push   $0x7
+  802b4b:	68 00 80 80 00       	push   $0x808000
+  802b50:	53                   	push   %ebx
+  802b51:	ff 35 10 60 80 00    	push   0x806010
+  802b57:	e8 dc 0a 00 00       	call   803638 <ipc_call>
+  802b5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5f:	c9                   	leave
+  802b60:	c3                   	ret
+  802b61:	83 ec 0c             	sub    $0xc,%esp
+  802b64:	6a 03                	push   $0x3
+  802b66:	e8 68 0c 00 00       	call   8037d3 <ipc_find_env>
+  802b6b:	a3 10 60 80 00       	mov    %eax,0x806010
+  802b70:	83 c4 10             	add    $0x10,%esp
+  802b73:	eb cd                	jmp    802b42 <nsipc+0x12>
+
+00802b75 <nsipc_accept>:
+  802b75:	55                   	push   %ebp
+  802b76:	89 e5                	mov    %esp,%ebp
+  802b78:	53                   	push   %ebx
+  802b79:	83 ec 04             	sub    $0x4,%esp
+  802b7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7f:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b84:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b89:	e8 a2 ff ff ff       	call   802b30 <nsipc>
+  802b8e:	89 c3                	mov    %eax,%ebx
+  802b90:	85 c0                	test   %eax,%eax
+  802b92:	79 07                	jns    802b9b <nsipc_accept+0x26>
+  802b94:	89 d8                	mov    %ebx,%eax
+  802b96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b99:	c9                   	leave
+  802b9a:	c3                   	ret
+  802b9b:	83 ec 04             	sub    $0x4,%esp
+  802b9e:	ff 35 10 80 80 00    	push   0x808010
+  802ba4:	68 00 80 80 00       	push   $0x808000
+  802ba9:	ff 75 0c             	push   0xc(%ebp)
+  802bac:	e8 1c e1 ff ff       	call   800ccd <memmove>
+  802bb1:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802bb7:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bba:	89 10                	mov    %edx,(%eax)
+  802bbc:	83 c4 10             	add    $0x10,%esp
+  802bbf:	eb d3                	jmp    802b94 <nsipc_accept+0x1f>
+
+00802bc1 <nsipc_bind>:
+  802bc1:	55                   	push   %ebp
+  802bc2:	89 e5                	mov    %esp,%ebp
+  802bc4:	53                   	push   %ebx
+  802bc5:	83 ec 08             	sub    $0x8,%esp
+  802bc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bce:	a3 00 80 80 00       	mov    %eax,0x808000
+  802bd3:	53                   	push   %ebx
+  802bd4:	ff 75 0c             	push   0xc(%ebp)
+  802bd7:	68 04 80 80 00       	push   $0x808004
+  802bdc:	e8 ec e0 ff ff       	call   800ccd <memmove>
+  802be1:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802be7:	b8 02 00 00 00       	mov    $0x2,%eax
+  802bec:	e8 3f ff ff ff       	call   802b30 <nsipc>
+  802bf1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf4:	c9                   	leave
+  802bf5:	c3                   	ret
+
+00802bf6 <nsipc_shutdown>:
+  802bf6:	55                   	push   %ebp
+  802bf7:	89 e5                	mov    %esp,%ebp
+  802bf9:	83 ec 08             	sub    $0x8,%esp
+  802bfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bff:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c04:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c07:	a3 04 80 80 00       	mov    %eax,0x808004
+  802c0c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c11:	e8 1a ff ff ff       	call   802b30 <nsipc>
+  802c16:	c9                   	leave
+  802c17:	c3                   	ret
+
+00802c18 <nsipc_close>:
+  802c18:	55                   	push   %ebp
+  802c19:	89 e5                	mov    %esp,%ebp
+  802c1b:	83 ec 08             	sub    $0x8,%esp
+  802c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c21:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c26:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c2b:	e8 00 ff ff ff       	call   802b30 <nsipc>
+  802c30:	c9                   	leave
+  802c31:	c3                   	ret
+
+00802c32 <nsipc_connect>:
+  802c32:	55                   	push   %ebp
+  802c33:	89 e5                	mov    %esp,%ebp
+  802c35:	53                   	push   %ebx
+  802c36:	83 ec 08             	sub    $0x8,%esp
+  802c39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c3f:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c44:	53                   	push   %ebx
+  802c45:	ff 75 0c             	push   0xc(%ebp)
+  802c48:	68 04 80 80 00       	push   $0x808004
+  802c4d:	e8 7b e0 ff ff       	call   800ccd <memmove>
+  802c52:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802c58:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c5d:	e8 ce fe ff ff       	call   802b30 <nsipc>
+  802c62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c65:	c9                   	leave
+  802c66:	c3                   	ret
+
+00802c67 <nsipc_listen>:
+  802c67:	55                   	push   %ebp
+  802c68:	89 e5                	mov    %esp,%ebp
+  802c6a:	83 ec 08             	sub    $0x8,%esp
+  802c6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c70:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c78:	a3 04 80 80 00       	mov    %eax,0x808004
+  802c7d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c82:	e8 a9 fe ff ff       	call   802b30 <nsipc>
+  802c87:	c9                   	leave
+  802c88:	c3                   	ret
+
+00802c89 <nsipc_recv>:
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	56                   	push   %esi
+  802c8d:	53                   	push   %ebx
+  802c8e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802c91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c94:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c99:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802c9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ca2:	a3 08 80 80 00       	mov    %eax,0x808008
+  802ca7:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cac:	e8 7f fe ff ff       	call   802b30 <nsipc>
+  802cb1:	89 c3                	mov    %eax,%ebx
+  802cb3:	85 c0                	test   %eax,%eax
+  802cb5:	78 22                	js     802cd9 <nsipc_recv+0x50>
+  802cb7:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802cbc:	39 c6                	cmp    %eax,%esi
+  802cbe:	0f 4e c6             	cmovle %esi,%eax
+  802cc1:	39 c3                	cmp    %eax,%ebx
+  802cc3:	7f 1d                	jg     802ce2 <nsipc_recv+0x59>
+  802cc5:	83 ec 04             	sub    $0x4,%esp
+  802cc8:	53                   	push   %ebx
+  802cc9:	68 00 80 80 00       	push   $0x808000
+  802cce:	ff 75 0c             	push   0xc(%ebp)
+  802cd1:	e8 f7 df ff ff       	call   800ccd <memmove>
+  802cd6:	83 c4 10             	add    $0x10,%esp
+  802cd9:	89 d8                	mov    %ebx,%eax
+  802cdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cde:	5b                   	pop    %ebx
+  802cdf:	5e                   	pop    %esi
+  802ce0:	5d                   	pop    %ebp
+  802ce1:	c3                   	ret
+  802ce2:	68 7c 40 80 00       	push   $0x80407c
+  802ce7:	68 91 40 80 00       	push   $0x804091
+  802cec:	6a 60                	push   $0x60
+  802cee:	68 a6 40 80 00       	push   $0x8040a6
+  802cf3:	e8 53 d6 ff ff       	call   80034b <_panic>
+
+00802cf8 <nsipc_send>:
+  802cf8:	55                   	push   %ebp
+  802cf9:	89 e5                	mov    %esp,%ebp
+  802cfb:	53                   	push   %ebx
+  802cfc:	83 ec 04             	sub    $0x4,%esp
+  802cff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d05:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d0a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d10:	7f 2e                	jg     802d40 <nsipc_send+0x48>
+  802d12:	83 ec 04             	sub    $0x4,%esp
+  802d15:	53                   	push   %ebx
+  802d16:	ff 75 0c             	push   0xc(%ebp)
+  802d19:	68 0c 80 80 00       	push   $0x80800c
+  802d1e:	e8 aa df ff ff       	call   800ccd <memmove>
+  802d23:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802d29:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d2c:	a3 08 80 80 00       	mov    %eax,0x808008
+  802d31:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d36:	e8 f5 fd ff ff       	call   802b30 <nsipc>
+  802d3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d3e:	c9                   	leave
+  802d3f:	c3                   	ret
+  802d40:	68 b2 40 80 00       	push   $0x8040b2
+  802d45:	68 91 40 80 00       	push   $0x804091
+  802d4a:	6a 6b                	push   $0x6b
+  802d4c:	68 a6 40 80 00       	push   $0x8040a6
+  802d51:	e8 f5 d5 ff ff       	call   80034b <_panic>
+
+00802d56 <nsipc_socket>:
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	83 ec 08             	sub    $0x8,%esp
+  802d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5f:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d67:	a3 04 80 80 00       	mov    %eax,0x808004
+  802d6c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d6f:	a3 08 80 80 00       	mov    %eax,0x808008
+  802d74:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d79:	e8 b2 fd ff ff       	call   802b30 <nsipc>
+  802d7e:	c9                   	leave
+  802d7f:	c3                   	ret
+
+00802d80 <devpipe_stat>:
+  802d80:	55                   	push   %ebp
+  802d81:	89 e5                	mov    %esp,%ebp
+  802d83:	56                   	push   %esi
+  802d84:	53                   	push   %ebx
+  802d85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802d88:	83 ec 0c             	sub    $0xc,%esp
+  802d8b:	ff 75 08             	push   0x8(%ebp)
+  802d8e:	e8 99 ef ff ff       	call   801d2c <fd2data>
+  802d93:	89 c6                	mov    %eax,%esi
+  802d95:	83 c4 08             	add    $0x8,%esp
+  802d98:	68 be 40 80 00       	push   $0x8040be
+  802d9d:	53                   	push   %ebx
+  802d9e:	e8 7a dd ff ff       	call   800b1d <strcpy>
+  802da3:	8b 46 04             	mov    0x4(%esi),%eax
+  802da6:	2b 06                	sub    (%esi),%eax
+  802da8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802dae:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802db5:	00 00 00 
+  802db8:	c7 83 88 00 00 00 40 	movl   $0x805040,0x88(%ebx)
+  802dbf:	50 80 00 
+  802dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dca:	5b                   	pop    %ebx
+  802dcb:	5e                   	pop    %esi
+  802dcc:	5d                   	pop    %ebp
+  802dcd:	c3                   	ret
+
+00802dce <devpipe_close>:
+  802dce:	55                   	push   %ebp
+  802dcf:	89 e5                	mov    %esp,%ebp
+  802dd1:	53                   	push   %ebx
+  802dd2:	83 ec 0c             	sub    $0xc,%esp
+  802dd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802dd8:	53                   	push   %ebx
+  802dd9:	6a 00                	push   $0x0
+  802ddb:	e8 6f e2 ff ff       	call   80104f <sys_page_unmap>
+  802de0:	89 1c 24             	mov    %ebx,(%esp)
+  802de3:	e8 44 ef ff ff       	call   801d2c <fd2data>
+  802de8:	83 c4 08             	add    $0x8,%esp
+  802deb:	50                   	push   %eax
+  802dec:	6a 00                	push   $0x0
+  802dee:	e8 5c e2 ff ff       	call   80104f <sys_page_unmap>
+  802df3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df6:	c9                   	leave
+  802df7:	c3                   	ret
+
+00802df8 <_pipeisclosed>:
+  802df8:	55                   	push   %ebp
+  802df9:	89 e5                	mov    %esp,%ebp
+  802dfb:	57                   	push   %edi
+  802dfc:	56                   	push   %esi
+  802dfd:	53                   	push   %ebx
+  802dfe:	83 ec 1c             	sub    $0x1c,%esp
+  802e01:	89 c7                	mov    %eax,%edi
+  802e03:	89 d6                	mov    %edx,%esi
+  802e05:	a1 14 60 80 00       	mov    0x806014,%eax
+  802e0a:	8b 58 58             	mov    0x58(%eax),%ebx
+  802e0d:	83 ec 0c             	sub    $0xc,%esp
+  802e10:	57                   	push   %edi
+  802e11:	e8 d7 09 00 00       	call   8037ed <pageref>
+  802e16:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e19:	89 34 24             	mov    %esi,(%esp)
+  802e1c:	e8 cc 09 00 00       	call   8037ed <pageref>
+  802e21:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  802e27:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802e2a:	83 c4 10             	add    $0x10,%esp
+  802e2d:	39 cb                	cmp    %ecx,%ebx
+  802e2f:	74 1b                	je     802e4c <_pipeisclosed+0x54>
+  802e31:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e34:	75 cf                	jne    802e05 <_pipeisclosed+0xd>
+  802e36:	8b 42 58             	mov    0x58(%edx),%eax
+  802e39:	6a 01                	push   $0x1
+  802e3b:	50                   	push   %eax
+  802e3c:	53                   	push   %ebx
+  802e3d:	68 c5 40 80 00       	push   $0x8040c5
+  802e42:	e8 df d5 ff ff       	call   800426 <cprintf>
+  802e47:	83 c4 10             	add    $0x10,%esp
+  802e4a:	eb b9                	jmp    802e05 <_pipeisclosed+0xd>
+  802e4c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e4f:	0f 94 c0             	sete   %al
+  802e52:	0f b6 c0             	movzbl %al,%eax
+  802e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e58:	5b                   	pop    %ebx
+  802e59:	5e                   	pop    %esi
+  802e5a:	5f                   	pop    %edi
+  802e5b:	5d                   	pop    %ebp
+  802e5c:	c3                   	ret
+
+00802e5d <devpipe_write>:
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	57                   	push   %edi
+  802e61:	56                   	push   %esi
+  802e62:	53                   	push   %ebx
+  802e63:	83 ec 28             	sub    $0x28,%esp
+  802e66:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e69:	56                   	push   %esi
+  802e6a:	e8 bd ee ff ff       	call   801d2c <fd2data>
+  802e6f:	89 c3                	mov    %eax,%ebx
+  802e71:	83 c4 10             	add    $0x10,%esp
+  802e74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e79:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e7d:	74 5c                	je     802edb <devpipe_write+0x7e>
+  802e7f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e82:	8b 0b                	mov    (%ebx),%ecx
+  802e84:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e87:	39 d0                	cmp    %edx,%eax
+  802e89:	72 1e                	jb     802ea9 <devpipe_write+0x4c>
+  802e8b:	89 da                	mov    %ebx,%edx
+  802e8d:	89 f0                	mov    %esi,%eax
+  802e8f:	e8 64 ff ff ff       	call   802df8 <_pipeisclosed>
+  802e94:	85 c0                	test   %eax,%eax
+  802e96:	75 48                	jne    802ee0 <devpipe_write+0x83>
+  802e98:	e8 95 e0 ff ff       	call   800f32 <sys_yield>
+  802e9d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ea0:	8b 0b                	mov    (%ebx),%ecx
+  802ea2:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ea5:	39 d0                	cmp    %edx,%eax
+  802ea7:	73 e2                	jae    802e8b <devpipe_write+0x2e>
+  802ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802eac:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802eb0:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802eb3:	89 c2                	mov    %eax,%edx
+  802eb5:	c1 fa 1f             	sar    $0x1f,%edx
+  802eb8:	89 d1                	mov    %edx,%ecx
+  802eba:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ebd:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ec0:	83 e2 1f             	and    $0x1f,%edx
+  802ec3:	29 ca                	sub    %ecx,%edx
+  802ec5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ec9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802ecd:	83 c0 01             	add    $0x1,%eax
+  802ed0:	89 43 04             	mov    %eax,0x4(%ebx)
+  802ed3:	83 c7 01             	add    $0x1,%edi
+  802ed6:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802ed9:	75 a4                	jne    802e7f <devpipe_write+0x22>
+  802edb:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ede:	eb 05                	jmp    802ee5 <devpipe_write+0x88>
+  802ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ee8:	5b                   	pop    %ebx
+  802ee9:	5e                   	pop    %esi
+  802eea:	5f                   	pop    %edi
+  802eeb:	5d                   	pop    %ebp
+  802eec:	c3                   	ret
+
+00802eed <devpipe_read>:
+  802eed:	55                   	push   %ebp
+  802eee:	89 e5                	mov    %esp,%ebp
+  802ef0:	57                   	push   %edi
+  802ef1:	56                   	push   %esi
+  802ef2:	53                   	push   %ebx
+  802ef3:	83 ec 18             	sub    $0x18,%esp
+  802ef6:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ef9:	56                   	push   %esi
+  802efa:	e8 2d ee ff ff       	call   801d2c <fd2data>
+  802eff:	89 c3                	mov    %eax,%ebx
+  802f01:	83 c4 10             	add    $0x10,%esp
+  802f04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f09:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f0d:	74 45                	je     802f54 <devpipe_read+0x67>
+  802f0f:	8b 03                	mov    (%ebx),%eax
+  802f11:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f14:	75 1d                	jne    802f33 <devpipe_read+0x46>
+  802f16:	85 ff                	test   %edi,%edi
+  802f18:	75 3f                	jne    802f59 <devpipe_read+0x6c>
+  802f1a:	89 da                	mov    %ebx,%edx
+  802f1c:	89 f0                	mov    %esi,%eax
+  802f1e:	e8 d5 fe ff ff       	call   802df8 <_pipeisclosed>
+  802f23:	85 c0                	test   %eax,%eax
+  802f25:	75 3c                	jne    802f63 <devpipe_read+0x76>
+  802f27:	e8 06 e0 ff ff       	call   800f32 <sys_yield>
+  802f2c:	8b 03                	mov    (%ebx),%eax
+  802f2e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f31:	74 e7                	je     802f1a <devpipe_read+0x2d>
+  802f33:	99                   	cltd
+  802f34:	c1 ea 1b             	shr    $0x1b,%edx
+  802f37:	01 d0                	add    %edx,%eax
+  802f39:	83 e0 1f             	and    $0x1f,%eax
+  802f3c:	29 d0                	sub    %edx,%eax
+  802f3e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f46:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802f49:	83 03 01             	addl   $0x1,(%ebx)
+  802f4c:	83 c7 01             	add    $0x1,%edi
+  802f4f:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802f52:	75 bb                	jne    802f0f <devpipe_read+0x22>
+  802f54:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f57:	eb 02                	jmp    802f5b <devpipe_read+0x6e>
+  802f59:	89 f8                	mov    %edi,%eax
+  802f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5e:	5b                   	pop    %ebx
+  802f5f:	5e                   	pop    %esi
+  802f60:	5f                   	pop    %edi
+  802f61:	5d                   	pop    %ebp
+  802f62:	c3                   	ret
+  802f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f68:	eb f1                	jmp    802f5b <devpipe_read+0x6e>
+
+00802f6a <pipe>:
+  802f6a:	55                   	push   %ebp
+  802f6b:	89 e5                	mov    %esp,%ebp
+  802f6d:	56                   	push   %esi
+  802f6e:	53                   	push   %ebx
+  802f6f:	83 ec 1c             	sub    $0x1c,%esp
+  802f72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f75:	50                   	push   %eax
+  802f76:	e8 c8 ed ff ff       	call   801d43 <fd_alloc>
+  802f7b:	89 c3                	mov    %eax,%ebx
+  802f7d:	83 c4 10             	add    $0x10,%esp
+  802f80:	85 c0                	test   %eax,%eax
+  802f82:	0f 88 23 01 00 00    	js     8030ab <pipe+0x141>
+  802f88:	83 ec 04             	sub    $0x4,%esp
+  802f8b:	68 07 04 00 00       	push   $0x407
+  802f90:	ff 75 f4             	push   -0xc(%ebp)
+  802f93:	6a 00                	push   $0x0
+  802f95:	e8 e3 df ff ff       	call   800f7d <sys_page_alloc>
+  802f9a:	89 c3                	mov    %eax,%ebx
+  802f9c:	83 c4 10             	add    $0x10,%esp
+  802f9f:	85 c0                	test   %eax,%eax
+  802fa1:	0f 88 04 01 00 00    	js     8030ab <pipe+0x141>
+  802fa7:	83 ec 0c             	sub    $0xc,%esp
+  802faa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802fad:	50                   	push   %eax
+  802fae:	e8 90 ed ff ff       	call   801d43 <fd_alloc>
+  802fb3:	89 c3                	mov    %eax,%ebx
+  802fb5:	83 c4 10             	add    $0x10,%esp
+  802fb8:	85 c0                	test   %eax,%eax
+  802fba:	0f 88 db 00 00 00    	js     80309b <pipe+0x131>
+  802fc0:	83 ec 04             	sub    $0x4,%esp
+  802fc3:	68 07 04 00 00       	push   $0x407
+  802fc8:	ff 75 f0             	push   -0x10(%ebp)
+  802fcb:	6a 00                	push   $0x0
+  802fcd:	e8 ab df ff ff       	call   800f7d <sys_page_alloc>
+  802fd2:	89 c3                	mov    %eax,%ebx
+  802fd4:	83 c4 10             	add    $0x10,%esp
+  802fd7:	85 c0                	test   %eax,%eax
+  802fd9:	0f 88 bc 00 00 00    	js     80309b <pipe+0x131>
+  802fdf:	83 ec 0c             	sub    $0xc,%esp
+  802fe2:	ff 75 f4             	push   -0xc(%ebp)
+  802fe5:	e8 42 ed ff ff       	call   801d2c <fd2data>
+  802fea:	89 c6                	mov    %eax,%esi
+  802fec:	83 c4 0c             	add    $0xc,%esp
+  802fef:	68 07 04 00 00       	push   $0x407
+  802ff4:	50                   	push   %eax
+  802ff5:	6a 00                	push   $0x0
+  802ff7:	e8 81 df ff ff       	call   800f7d <sys_page_alloc>
+  802ffc:	89 c3                	mov    %eax,%ebx
+  802ffe:	83 c4 10             	add    $0x10,%esp
+  803001:	85 c0                	test   %eax,%eax
+  803003:	0f 88 82 00 00 00    	js     80308b <pipe+0x121>
+  803009:	83 ec 0c             	sub    $0xc,%esp
+  80300c:	ff 75 f0             	push   -0x10(%ebp)
+  80300f:	e8 18 ed ff ff       	call   801d2c <fd2data>
+  803014:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80301b:	50                   	push   %eax
+  80301c:	6a 00                	push   $0x0
+  80301e:	56                   	push   %esi
+  80301f:	6a 00                	push   $0x0
+  803021:	e8 9a df ff ff       	call   800fc0 <sys_page_map>
+  803026:	89 c3                	mov    %eax,%ebx
+  803028:	83 c4 20             	add    $0x20,%esp
+  80302b:	85 c0                	test   %eax,%eax
+  80302d:	78 4e                	js     80307d <pipe+0x113>
+  80302f:	a1 40 50 80 00       	mov    0x805040,%eax
+  803034:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803037:	89 02                	mov    %eax,(%edx)
+  803039:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80303c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803043:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803046:	89 02                	mov    %eax,(%edx)
+  803048:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80304b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803052:	83 ec 0c             	sub    $0xc,%esp
+  803055:	ff 75 f4             	push   -0xc(%ebp)
+  803058:	e8 bf ec ff ff       	call   801d1c <fd2num>
+  80305d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803060:	89 01                	mov    %eax,(%ecx)
+  803062:	83 c4 04             	add    $0x4,%esp
+  803065:	ff 75 f0             	push   -0x10(%ebp)
+  803068:	e8 af ec ff ff       	call   801d1c <fd2num>
+  80306d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803070:	89 41 04             	mov    %eax,0x4(%ecx)
+  803073:	83 c4 10             	add    $0x10,%esp
+  803076:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80307b:	eb 2e                	jmp    8030ab <pipe+0x141>
+  80307d:	83 ec 08             	sub    $0x8,%esp
+  803080:	56                   	push   %esi
+  803081:	6a 00                	push   $0x0
+  803083:	e8 c7 df ff ff       	call   80104f <sys_page_unmap>
+  803088:	83 c4 10             	add    $0x10,%esp
+  80308b:	83 ec 08             	sub    $0x8,%esp
+  80308e:	ff 75 f0             	push   -0x10(%ebp)
+  803091:	6a 00                	push   $0x0
+  803093:	e8 b7 df ff ff       	call   80104f <sys_page_unmap>
+  803098:	83 c4 10             	add    $0x10,%esp
+  80309b:	83 ec 08             	sub    $0x8,%esp
+  80309e:	ff 75 f4             	push   -0xc(%ebp)
+  8030a1:	6a 00                	push   $0x0
+  8030a3:	e8 a7 df ff ff       	call   80104f <sys_page_unmap>
+  8030a8:	83 c4 10             	add    $0x10,%esp
+  8030ab:	89 d8                	mov    %ebx,%eax
+  8030ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030b0:	5b                   	pop    %ebx
+  8030b1:	5e                   	pop    %esi
+  8030b2:	5d                   	pop    %ebp
+  8030b3:	c3                   	ret
+
+008030b4 <pipeisclosed>:
+  8030b4:	55                   	push   %ebp
+  8030b5:	89 e5                	mov    %esp,%ebp
+  8030b7:	83 ec 20             	sub    $0x20,%esp
+  8030ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030bd:	50                   	push   %eax
+  8030be:	ff 75 08             	push   0x8(%ebp)
+  8030c1:	e8 cd ec ff ff       	call   801d93 <fd_lookup>
+  8030c6:	83 c4 10             	add    $0x10,%esp
+  8030c9:	85 c0                	test   %eax,%eax
+  8030cb:	78 18                	js     8030e5 <pipeisclosed+0x31>
+  8030cd:	83 ec 0c             	sub    $0xc,%esp
+  8030d0:	ff 75 f4             	push   -0xc(%ebp)
+  8030d3:	e8 54 ec ff ff       	call   801d2c <fd2data>
+  8030d8:	89 c2                	mov    %eax,%edx
+  8030da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030dd:	e8 16 fd ff ff       	call   802df8 <_pipeisclosed>
+  8030e2:	83 c4 10             	add    $0x10,%esp
+  8030e5:	c9                   	leave
+  8030e6:	c3                   	ret
+
+008030e7 <wait>:
+  8030e7:	55                   	push   %ebp
+  8030e8:	89 e5                	mov    %esp,%ebp
+  8030ea:	56                   	push   %esi
+  8030eb:	53                   	push   %ebx
+  8030ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030ef:	85 f6                	test   %esi,%esi
+  8030f1:	74 40                	je     803133 <wait+0x4c>
+  8030f3:	89 f3                	mov    %esi,%ebx
+  8030f5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8030fb:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  803101:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803106:	8b 40 48             	mov    0x48(%eax),%eax
+  803109:	39 c6                	cmp    %eax,%esi
+  80310b:	75 1f                	jne    80312c <wait+0x45>
+  80310d:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  803113:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803119:	8b 43 54             	mov    0x54(%ebx),%eax
+  80311c:	85 c0                	test   %eax,%eax
+  80311e:	74 0c                	je     80312c <wait+0x45>
+  803120:	e8 0d de ff ff       	call   800f32 <sys_yield>
+  803125:	8b 43 48             	mov    0x48(%ebx),%eax
+  803128:	39 f0                	cmp    %esi,%eax
+  80312a:	74 ed                	je     803119 <wait+0x32>
+  80312c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80312f:	5b                   	pop    %ebx
+  803130:	5e                   	pop    %esi
+  803131:	5d                   	pop    %ebp
+  803132:	c3                   	ret
+  803133:	68 dd 40 80 00       	push   $0x8040dd
+  803138:	68 91 40 80 00       	push   $0x804091
+  80313d:	6a 09                	push   $0x9
+  80313f:	68 e8 40 80 00       	push   $0x8040e8
+  803144:	e8 02 d2 ff ff       	call   80034b <_panic>
+
+00803149 <ipcring_init>:
+  803149:	55                   	push   %ebp
+  80314a:	89 e5                	mov    %esp,%ebp
+  80314c:	53                   	push   %ebx
+  80314d:	83 ec 08             	sub    $0x8,%esp
+  803150:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803153:	6a 60                	push   $0x60
+  803155:	6a 00                	push   $0x0
+  803157:	53                   	push   %ebx
+  803158:	e8 3b db ff ff       	call   800c98 <memset>
+  80315d:	a1 14 60 80 00       	mov    0x806014,%eax
+  803162:	8b 40 48             	mov    0x48(%eax),%eax
+  803165:	89 03                	mov    %eax,(%ebx)
+  803167:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80316a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80316d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803170:	89 43 08             	mov    %eax,0x8(%ebx)
+  803173:	8b 45 14             	mov    0x14(%ebp),%eax
+  803176:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803179:	83 c4 10             	add    $0x10,%esp
+  80317c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80317f:	c9                   	leave
+  803180:	c3                   	ret
+
+00803181 <ipcring_req_slot>:
+  803181:	55                   	push   %ebp
+  803182:	89 e5                	mov    %esp,%ebp
+  803184:	8b 45 08             	mov    0x8(%ebp),%eax
+  803187:	8b 50 10             	mov    0x10(%eax),%edx
+  80318a:	8b 48 18             	mov    0x18(%eax),%ecx
+  80318d:	29 ca                	sub    %ecx,%edx
+  80318f:	83 fa 07             	cmp    $0x7,%edx
+  803192:	77 0c                	ja     8031a0 <ipcring_req_slot+0x1f>
+  803194:	8b 50 10             	mov    0x10(%eax),%edx
+  803197:	83 e2 07             	and    $0x7,%edx
+  80319a:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80319e:	5d                   	pop    %ebp
+  80319f:	c3                   	ret
+  8031a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a5:	eb f7                	jmp    80319e <ipcring_req_slot+0x1d>
+
+008031a7 <ipcring_req_push>:
+  8031a7:	55                   	push   %ebp
+  8031a8:	89 e5                	mov    %esp,%ebp
+  8031aa:	83 ec 08             	sub    $0x8,%esp
+  8031ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031b0:	8b 42 10             	mov    0x10(%edx),%eax
+  8031b3:	83 c0 01             	add    $0x1,%eax
+  8031b6:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8031ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bf:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8031c3:	85 c0                	test   %eax,%eax
+  8031c5:	75 02                	jne    8031c9 <ipcring_req_push+0x22>
+  8031c7:	c9                   	leave
+  8031c8:	c3                   	ret
+  8031c9:	6a 00                	push   $0x0
+  8031cb:	68 00 00 80 ee       	push   $0xee800000
+  8031d0:	ff 72 08             	push   0x8(%edx)
+  8031d3:	ff 72 04             	push   0x4(%edx)
+  8031d6:	e8 da e0 ff ff       	call   8012b5 <sys_ipc_send>
+  8031db:	83 c4 10             	add    $0x10,%esp
+  8031de:	eb e7                	jmp    8031c7 <ipcring_req_push+0x20>
+
+008031e0 <ipcring_rsp_wait>:
+  8031e0:	55                   	push   %ebp
+  8031e1:	89 e5                	mov    %esp,%ebp
+  8031e3:	53                   	push   %ebx
+  8031e4:	83 ec 04             	sub    $0x4,%esp
+  8031e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8031ea:	8b 53 18             	mov    0x18(%ebx),%edx
+  8031ed:	8b 43 10             	mov    0x10(%ebx),%eax
+  8031f0:	39 c2                	cmp    %eax,%edx
+  8031f2:	74 3c                	je     803230 <ipcring_rsp_wait+0x50>
+  8031f4:	8b 53 14             	mov    0x14(%ebx),%edx
+  8031f7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8031fa:	39 c2                	cmp    %eax,%edx
+  8031fc:	75 23                	jne    803221 <ipcring_rsp_wait+0x41>
+  8031fe:	83 ec 08             	sub    $0x8,%esp
+  803201:	6a 00                	push   $0x0
+  803203:	6a 00                	push   $0x0
+  803205:	6a 00                	push   $0x0
+  803207:	6a 00                	push   $0x0
+  803209:	ff 73 0c             	push   0xc(%ebx)
+  80320c:	ff 73 04             	push   0x4(%ebx)
+  80320f:	e8 24 04 00 00       	call   803638 <ipc_call>
+  803214:	8b 53 14             	mov    0x14(%ebx),%edx
+  803217:	8b 43 18             	mov    0x18(%ebx),%eax
+  80321a:	83 c4 20             	add    $0x20,%esp
+  80321d:	39 c2                	cmp    %eax,%edx
+  80321f:	74 dd                	je     8031fe <ipcring_rsp_wait+0x1e>
+  803221:	8b 43 18             	mov    0x18(%ebx),%eax
+  803224:	83 e0 07             	and    $0x7,%eax
+  803227:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  80322b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80322e:	c9                   	leave
+  80322f:	c3                   	ret
+  803230:	68 f4 40 80 00       	push   $0x8040f4
+  803235:	68 91 40 80 00       	push   $0x804091
+  80323a:	6a 3b                	push   $0x3b
+  80323c:	68 15 41 80 00       	push   $0x804115
+  803241:	e8 05 d1 ff ff       	call   80034b <_panic>
+
+00803246 <ipcring_rsp_pop>:
+  803246:	55                   	push   %ebp
+  803247:	89 e5                	mov    %esp,%ebp
+  803249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80324c:	8b 42 18             	mov    0x18(%edx),%eax
+  80324f:	83 c0 01             	add    $0x1,%eax
+  803252:	89 42 18             	mov    %eax,0x18(%edx)
+  803255:	5d                   	pop    %ebp
+  803256:	c3                   	ret
+
+00803257 <ipcring_server_init>:
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80325d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803260:	89 10                	mov    %edx,(%eax)
+  803262:	8b 55 10             	mov    0x10(%ebp),%edx
+  803265:	89 50 04             	mov    %edx,0x4(%eax)
+  803268:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80326f:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803276:	5d                   	pop    %ebp
+  803277:	c3                   	ret
+
+00803278 <ipcring_req_avail>:
+  803278:	55                   	push   %ebp
+  803279:	89 e5                	mov    %esp,%ebp
+  80327b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80327e:	8b 02                	mov    (%edx),%eax
+  803280:	8b 40 10             	mov    0x10(%eax),%eax
+  803283:	2b 42 08             	sub    0x8(%edx),%eax
+  803286:	ba 08 00 00 00       	mov    $0x8,%edx
+  80328b:	39 d0                	cmp    %edx,%eax
+  80328d:	0f 47 c2             	cmova  %edx,%eax
+  803290:	5d                   	pop    %ebp
+  803291:	c3                   	ret
+
+00803292 <ipcring_req_peek>:
+  803292:	55                   	push   %ebp
+  803293:	89 e5                	mov    %esp,%ebp
+  803295:	8b 55 08             	mov    0x8(%ebp),%edx
+  803298:	8b 42 08             	mov    0x8(%edx),%eax
+  80329b:	83 e0 07             	and    $0x7,%eax
+  80329e:	8b 12                	mov    (%edx),%edx
+  8032a0:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8032a4:	5d                   	pop    %ebp
+  8032a5:	c3                   	ret
+
+008032a6 <ipcring_rsp_push>:
+  8032a6:	55                   	push   %ebp
+  8032a7:	89 e5                	mov    %esp,%ebp
+  8032a9:	83 ec 08             	sub    $0x8,%esp
+  8032ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032af:	8b 41 08             	mov    0x8(%ecx),%eax
+  8032b2:	83 c0 01             	add    $0x1,%eax
+  8032b5:	89 41 08             	mov    %eax,0x8(%ecx)
+  8032b8:	8b 11                	mov    (%ecx),%edx
+  8032ba:	83 c2 14             	add    $0x14,%edx
+  8032bd:	f0 87 02             	lock xchg %eax,(%edx)
+  8032c0:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8032c4:	75 02                	jne    8032c8 <ipcring_rsp_push+0x22>
+  8032c6:	c9                   	leave
+  8032c7:	c3                   	ret
+  8032c8:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8032cf:	6a 00                	push   $0x0
+  8032d1:	68 00 00 80 ee       	push   $0xee800000
+  8032d6:	6a 00                	push   $0x0
+  8032d8:	ff 71 04             	push   0x4(%ecx)
+  8032db:	e8 f8 de ff ff       	call   8011d8 <sys_ipc_try_send>
+  8032e0:	83 c4 10             	add    $0x10,%esp
+  8032e3:	eb e1                	jmp    8032c6 <ipcring_rsp_push+0x20>
+
+008032e5 <ipcring_client_wait>:
+  8032e5:	55                   	push   %ebp
+  8032e6:	89 e5                	mov    %esp,%ebp
+  8032e8:	83 ec 08             	sub    $0x8,%esp
+  8032eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ee:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8032f5:	8b 10                	mov    (%eax),%edx
+  8032f7:	8b 52 18             	mov    0x18(%edx),%edx
+  8032fa:	3b 50 08             	cmp    0x8(%eax),%edx
+  8032fd:	75 02                	jne    803301 <ipcring_client_wait+0x1c>
+  8032ff:	c9                   	leave
+  803300:	c3                   	ret
+  803301:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803308:	6a 00                	push   $0x0
+  80330a:	68 00 00 80 ee       	push   $0xee800000
+  80330f:	6a 00                	push   $0x0
+  803311:	ff 70 04             	push   0x4(%eax)
+  803314:	e8 bf de ff ff       	call   8011d8 <sys_ipc_try_send>
+  803319:	83 c4 10             	add    $0x10,%esp
+  80331c:	eb e1                	jmp    8032ff <ipcring_client_wait+0x1a>
+
+0080331e <ipcring_server_sleep>:
+  80331e:	55                   	push   %ebp
+  80331f:	89 e5                	mov    %esp,%ebp
+  803321:	53                   	push   %ebx
+  803322:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803325:	8b 01                	mov    (%ecx),%eax
+  803327:	8d 50 1c             	lea    0x1c(%eax),%edx
+  80332a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80332f:	f0 87 02             	lock xchg %eax,(%edx)
+  803332:	8b 11                	mov    (%ecx),%edx
+  803334:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803337:	b8 01 00 00 00       	mov    $0x1,%eax
+  80333c:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80333f:	74 0e                	je     80334f <ipcring_server_sleep+0x31>
+  803341:	b8 00 00 00 00       	mov    $0x0,%eax
+  803346:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80334a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803352:	c9                   	leave
+  803353:	c3                   	ret
+
+00803354 <devcons_close>:
+  803354:	b8 00 00 00 00       	mov    $0x0,%eax
+  803359:	c3                   	ret
+
+0080335a <devcons_stat>:
+  80335a:	55                   	push   %ebp
+  80335b:	89 e5                	mov    %esp,%ebp
+  80335d:	83 ec 10             	sub    $0x10,%esp
+  803360:	68 23 41 80 00       	push   $0x804123
+  803365:	ff 75 0c             	push   0xc(%ebp)
+  803368:	e8 b0 d7 ff ff       	call   800b1d <strcpy>
+  80336d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803372:	c9                   	leave
+  803373:	c3                   	ret
+
+00803374 <devcons_write>:
+  803374:	55                   	push   %ebp
+  803375:	89 e5                	mov    %esp,%ebp
+  803377:	57                   	push   %edi
+  803378:	56                   	push   %esi
+  803379:	53                   	push   %ebx
+  80337a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803380:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803383:	85 ff                	test   %edi,%edi
+  803385:	74 51                	je     8033d8 <devcons_write+0x64>
+  803387:	be 00 00 00 00       	mov    $0x0,%esi
+  80338c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803391:	89 fb                	mov    %edi,%ebx
+  803393:	29 c3                	sub    %eax,%ebx
+  803395:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80339a:	39 d3                	cmp    %edx,%ebx
+  80339c:	0f 47 da             	cmova  %edx,%ebx
+  80339f:	83 ec 04             	sub    $0x4,%esp
+  8033a2:	53                   	push   %ebx
+  8033a3:	03 45 0c             	add    0xc(%ebp),%eax
+  8033a6:	50                   	push   %eax
+  8033a7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033ad:	50                   	push   %eax
+  8033ae:	e8 1a d9 ff ff       	call   800ccd <memmove>
+  8033b3:	83 c4 08             	add    $0x8,%esp
+  8033b6:	53                   	push   %ebx
+  8033b7:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8033bd:	50                   	push   %eax
+  8033be:	e8 d2 da ff ff       	call   800e95 <sys_cputs>
+  8033c3:	01 de                	add    %ebx,%esi
+  8033c5:	89 f0                	mov    %esi,%eax
+  8033c7:	83 c4 10             	add    $0x10,%esp
+  8033ca:	39 fe                	cmp    %edi,%esi
+  8033cc:	72 c3                	jb     803391 <devcons_write+0x1d>
+  8033ce:	89 f0                	mov    %esi,%eax
+  8033d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d3:	5b                   	pop    %ebx
+  8033d4:	5e                   	pop    %esi
+  8033d5:	5f                   	pop    %edi
+  8033d6:	5d                   	pop    %ebp
+  8033d7:	c3                   	ret
+  8033d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8033dd:	eb ef                	jmp    8033ce <devcons_write+0x5a>
+
+008033df <devcons_read>:
+  8033df:	55                   	push   %ebp
+  8033e0:	89 e5                	mov    %esp,%ebp
+  8033e2:	83 ec 08             	sub    $0x8,%esp
+  8033e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ea:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033ee:	75 07                	jne    8033f7 <devcons_read+0x18>
+  8033f0:	eb 1f                	jmp    803411 <devcons_read+0x32>
+  8033f2:	e8 3b db ff ff       	call   800f32 <sys_yield>
+  8033f7:	e8 b7 da ff ff       	call   800eb3 <sys_cgetc>
+  8033fc:	85 c0                	test   %eax,%eax
+  8033fe:	74 f2                	je     8033f2 <devcons_read+0x13>
+  803400:	78 0f                	js     803411 <devcons_read+0x32>
+  803402:	83 f8 04             	cmp    $0x4,%eax
+  803405:	74 0c                	je     803413 <devcons_read+0x34>
+  803407:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80340a:	88 02                	mov    %al,(%edx)
+  80340c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803411:	c9                   	leave
+  803412:	c3                   	ret
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+  803418:	eb f7                	jmp    803411 <devcons_read+0x32>
+
+0080341a <cputchar>:
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	83 ec 20             	sub    $0x20,%esp
+  803420:	8b 45 08             	mov    0x8(%ebp),%eax
+  803423:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803426:	6a 01                	push   $0x1
+  803428:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80342b:	50                   	push   %eax
+  80342c:	e8 64 da ff ff       	call   800e95 <sys_cputs>
+  803431:	83 c4 10             	add    $0x10,%esp
+  803434:	c9                   	leave
+  803435:	c3                   	ret
+
+00803436 <getchar>:
+  803436:	55                   	push   %ebp
+  803437:	89 e5                	mov    %esp,%ebp
+  803439:	83 ec 1c             	sub    $0x1c,%esp
+  80343c:	6a 01                	push   $0x1
+  80343e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803441:	50                   	push   %eax
+  803442:	6a 00                	push   $0x0
+  803444:	e8 ac eb ff ff       	call   801ff5 <read>
+  803449:	83 c4 10             	add    $0x10,%esp
+  80344c:	85 c0                	test   %eax,%eax
+  80344e:	78 06                	js     803456 <getchar+0x20>
+  803450:	74 06                	je     803458 <getchar+0x22>
+  803452:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803456:	c9                   	leave
+  803457:	c3                   	ret
+  803458:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80345d:	eb f7                	jmp    803456 <getchar+0x20>
+
+0080345f <iscons>:
+  80345f:	55                   	push   %ebp
+  803460:	89 e5                	mov    %esp,%ebp
+  803462:	83 ec 20             	sub    $0x20,%esp
+  803465:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803468:	50                   	push   %eax
+  803469:	ff 75 08             	push   0x8(%ebp)
+  80346c:	e8 22 e9 ff ff       	call   801d93 <fd_lookup>
+  803471:	83 c4 10             	add    $0x10,%esp
+  803474:	85 c0                	test   %eax,%eax
+  803476:	78 11                	js     803489 <iscons+0x2a>
+  803478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347b:	8b 15 5c 50 80 00    	mov    0x80505c,%edx
+  803481:	39 10                	cmp    %edx,(%eax)
+  803483:	0f 94 c0             	sete   %al
+  803486:	0f b6 c0             	movzbl %al,%eax
+  803489:	c9                   	leave
+  80348a:	c3                   	ret
+
+0080348b <opencons>:
+  80348b:	55                   	push   %ebp
+  80348c:	89 e5                	mov    %esp,%ebp
+  80348e:	83 ec 24             	sub    $0x24,%esp
+  803491:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803494:	50                   	push   %eax
+  803495:	e8 a9 e8 ff ff       	call   801d43 <fd_alloc>
+  80349a:	83 c4 10             	add    $0x10,%esp
+  80349d:	85 c0                	test   %eax,%eax
+  80349f:	78 3a                	js     8034db <opencons+0x50>
+  8034a1:	83 ec 04             	sub    $0x4,%esp
+  8034a4:	68 07 04 00 00       	push   $0x407
+  8034a9:	ff 75 f4             	push   -0xc(%ebp)
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	e8 ca da ff ff       	call   800f7d <sys_page_alloc>
+  8034b3:	83 c4 10             	add    $0x10,%esp
+  8034b6:	85 c0                	test   %eax,%eax
+  8034b8:	78 21                	js     8034db <opencons+0x50>
+  8034ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034bd:	8b 15 5c 50 80 00    	mov    0x80505c,%edx
+  8034c3:	89 10                	mov    %edx,(%eax)
+  8034c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034c8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8034cf:	83 ec 0c             	sub    $0xc,%esp
+  8034d2:	50                   	push   %eax
+  8034d3:	e8 44 e8 ff ff       	call   801d1c <fd2num>
+  8034d8:	83 c4 10             	add    $0x10,%esp
+  8034db:	c9                   	leave
+  8034dc:	c3                   	ret
+
+008034dd <set_pgfault_handler>:
+  8034dd:	55                   	push   %ebp
+  8034de:	89 e5                	mov    %esp,%ebp
+  8034e0:	53                   	push   %ebx
+  8034e1:	83 ec 04             	sub    $0x4,%esp
+  8034e4:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8034eb:	74 0d                	je     8034fa <set_pgfault_handler+0x1d>
+  8034ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f0:	a3 00 90 80 00       	mov    %eax,0x809000
+  8034f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034f8:	c9                   	leave
+  8034f9:	c3                   	ret
+  8034fa:	e8 14 da ff ff       	call   800f13 <sys_getenvid>
+  8034ff:	89 c3                	mov    %eax,%ebx
+  803501:	83 ec 04             	sub    $0x4,%esp
+  803504:	6a 07                	push   $0x7
+  803506:	68 00 f0 7f ee       	push   $0xee7ff000
+  80350b:	50                   	push   %eax
+  80350c:	e8 6c da ff ff       	call   800f7d <sys_page_alloc>
+  803511:	83 c4 10             	add    $0x10,%esp
+  803514:	85 c0                	test   %eax,%eax
+  803516:	78 29                	js     803541 <set_pgfault_handler+0x64>
+  803518:	83 ec 08             	sub    $0x8,%esp
+  80351b:	68 55 35 80 00       	push   $0x803555
+  803520:	53                   	push   %ebx
+  803521:	e8 70 dc ff ff       	call   801196 <sys_env_set_pgfault_upcall>
+  803526:	83 c4 10             	add    $0x10,%esp
+  803529:	85 c0                	test   %eax,%eax
+  80352b:	79 c0                	jns    8034ed <set_pgfault_handler+0x10>
+  80352d:	83 ec 04             	sub    $0x4,%esp
+  803530:	68 68 41 80 00       	push   $0x804168
+  803535:	6a 27                	push   $0x27
+  803537:	68 9a 41 80 00       	push   $0x80419a
+  80353c:	e8 0a ce ff ff       	call   80034b <_panic>
+  803541:	83 ec 04             	sub    $0x4,%esp
+  803544:	68 30 41 80 00       	push   $0x804130
+  803549:	6a 23                	push   $0x23
+  80354b:	68 9a 41 80 00       	push   $0x80419a
+  803550:	e8 f6 cd ff ff       	call   80034b <_panic>
+
+00803555 <_pgfault_upcall>:
+  803555:	54                   	push   %esp
+  803556:	a1 00 90 80 00       	mov    0x809000,%eax
+  80355b:	ff d0                	call   *%eax
+  80355d:	83 c4 04             	add    $0x4,%esp
+  803560:	89 e3                	mov    %esp,%ebx
+  803562:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803566:	8b 54 24 30          	mov    0x30(%esp),%edx
+  80356a:	89 d4                	mov    %edx,%esp
+  80356c:	51                   	push   %ecx
+  80356d:	89 dc                	mov    %ebx,%esp
+  80356f:	83 ea 04             	sub    $0x4,%edx
+  803572:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803576:	83 c4 08             	add    $0x8,%esp
+  803579:	61                   	popa
+  80357a:	83 c4 04             	add    $0x4,%esp
+  80357d:	9d                   	popf
+  80357e:	5c                   	pop    %esp
+  80357f:	c3                   	ret
+
+00803580 <ipc_recv>:
+  803580:	55                   	push   %ebp
+  803581:	89 e5                	mov    %esp,%ebp
+  803583:	56                   	push   %esi
+  803584:	53                   	push   %ebx
+  803585:	8b 75 08             	mov    0x8(%ebp),%esi
+  803588:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80358b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80358e:	85 c0                	test   %eax,%eax
+  803590:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803595:	0f 44 c2             	cmove  %edx,%eax
+  803598:	83 ec 0c             	sub    $0xc,%esp
+  80359b:	50                   	push   %eax
+  80359c:	e8 87 dc ff ff       	call   801228 <sys_ipc_recv>
+  8035a1:	83 c4 10             	add    $0x10,%esp
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	78 2a                	js     8035d2 <ipc_recv+0x52>
+  8035a8:	a1 14 60 80 00       	mov    0x806014,%eax
+  8035ad:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  8035b3:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  8035b9:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8035bf:	85 f6                	test   %esi,%esi
+  8035c1:	74 02                	je     8035c5 <ipc_recv+0x45>
+  8035c3:	89 0e                	mov    %ecx,(%esi)
+  8035c5:	85 db                	test   %ebx,%ebx
+  8035c7:	74 02                	je     8035cb <ipc_recv+0x4b>
+  8035c9:	89 13                	mov    %edx,(%ebx)
+  8035cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035ce:	5b                   	pop    %ebx
+  8035cf:	5e                   	pop    %esi
+  8035d0:	5d                   	pop    %ebp
+  8035d1:	c3                   	ret
+  8035d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035dc:	eb e1                	jmp    8035bf <ipc_recv+0x3f>
+
+008035de <ipc_send>:
+  8035de:	55                   	push   %ebp
+  8035df:	89 e5                	mov    %esp,%ebp
+  8035e1:	57                   	push   %edi
+  8035e2:	56                   	push   %esi
+  8035e3:	53                   	push   %ebx
+  8035e4:	83 ec 0c             	sub    $0xc,%esp
+  8035e7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8035ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035ed:	8b 75 14             	mov    0x14(%ebp),%esi
+  8035f0:	85 db                	test   %ebx,%ebx
+  8035f2:	74 1e                	je     803612 <ipc_send+0x34>
+  8035f4:	56                   	push   %esi
+  8035f5:	53                   	push   %ebx
+  8035f6:	57                   	push   %edi
+  8035f7:	ff 75 08             	push   0x8(%ebp)
+  8035fa:	e8 b6 dc ff ff       	call   8012b5 <sys_ipc_send>
+  8035ff:	83 c4 10             	add    $0x10,%esp
+  803602:	85 c0                	test   %eax,%eax
+  803604:	74 2a                	je     803630 <ipc_send+0x52>
+  803606:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803609:	75 13                	jne    80361e <ipc_send+0x40>
+  80360b:	e8 22 d9 ff ff       	call   800f32 <sys_yield>
+  803610:	eb e2                	jmp    8035f4 <ipc_send+0x16>
+  803612:	be 00 00 00 00       	mov    $0x0,%esi
+  803617:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80361c:	eb d6                	jmp    8035f4 <ipc_send+0x16>
+  80361e:	50                   	push   %eax
+  80361f:	68 a8 41 80 00       	push   $0x8041a8
+  803624:	6a 4f                	push   $0x4f
+  803626:	68 eb 41 80 00       	push   $0x8041eb
+  80362b:	e8 1b cd ff ff       	call   80034b <_panic>
+  803630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803633:	5b                   	pop    %ebx
+  803634:	5e                   	pop    %esi
+  803635:	5f                   	pop    %edi
+  803636:	5d                   	pop    %ebp
+  803637:	c3                   	ret
+
+00803638 <ipc_call>:
+  803638:	55                   	push   %ebp
+  803639:	89 e5                	mov    %esp,%ebp
+  80363b:	57                   	push   %edi
+  80363c:	56                   	push   %esi
+  80363d:	53                   	push   %ebx
+  80363e:	83 ec 0c             	sub    $0xc,%esp
+  803641:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803645:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  80364a:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  80364e:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803652:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803657:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80365b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80365f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803664:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803668:	eb 05                	jmp    80366f <ipc_call+0x37>
+  80366a:	e8 c3 d8 ff ff       	call   800f32 <sys_yield>
+  80366f:	83 ec 0c             	sub    $0xc,%esp
+  803672:	56                   	push   %esi
+  803673:	53                   	push   %ebx
+  803674:	57                   	push   %edi
+  803675:	ff 75 0c             	push   0xc(%ebp)
+  803678:	ff 75 08             	push   0x8(%ebp)
+  80367b:	e8 85 dc ff ff       	call   801305 <sys_ipc_call>
+  803680:	83 c4 20             	add    $0x20,%esp
+  803683:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803686:	74 e2                	je     80366a <ipc_call+0x32>
+  803688:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80368b:	74 2d                	je     8036ba <ipc_call+0x82>
+  80368d:	85 c0                	test   %eax,%eax
+  80368f:	78 4f                	js     8036e0 <ipc_call+0xa8>
+  803691:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803695:	74 10                	je     8036a7 <ipc_call+0x6f>
+  803697:	a1 14 60 80 00       	mov    0x806014,%eax
+  80369c:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8036a2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8036a5:	89 02                	mov    %eax,(%edx)
+  8036a7:	a1 14 60 80 00       	mov    0x806014,%eax
+  8036ac:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8036b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b5:	5b                   	pop    %ebx
+  8036b6:	5e                   	pop    %esi
+  8036b7:	5f                   	pop    %edi
+  8036b8:	5d                   	pop    %ebp
+  8036b9:	c3                   	ret
+  8036ba:	ff 75 14             	push   0x14(%ebp)
+  8036bd:	ff 75 10             	push   0x10(%ebp)
+  8036c0:	ff 75 0c             	push   0xc(%ebp)
+  8036c3:	ff 75 08             	push   0x8(%ebp)
+  8036c6:	e8 13 ff ff ff       	call   8035de <ipc_send>
+  8036cb:	83 c4 0c             	add    $0xc,%esp
+  8036ce:	ff 75 1c             	push   0x1c(%ebp)
+  8036d1:	ff 75 18             	push   0x18(%ebp)
+  8036d4:	6a 00                	push   $0x0
+  8036d6:	e8 a5 fe ff ff       	call   803580 <ipc_recv>
+  8036db:	83 c4 10             	add    $0x10,%esp
+  8036de:	eb d2                	jmp    8036b2 <ipc_call+0x7a>
+  8036e0:	50                   	push   %eax
+  8036e1:	68 f5 41 80 00       	push   $0x8041f5
+  8036e6:	6a 6d                	push   $0x6d
+  8036e8:	68 eb 41 80 00       	push   $0x8041eb
+  8036ed:	e8 59 cc ff ff       	call   80034b <_panic>
+
+008036f2 <ipc_reply_recv>:
+  8036f2:	55                   	push   %ebp
+  8036f3:	89 e5                	mov    %esp,%ebp
+  8036f5:	57                   	push   %edi
+  8036f6:	56                   	push   %esi
+  8036f7:	53                   	push   %ebx
+  8036f8:	83 ec 0c             	sub    $0xc,%esp
+  8036fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8036fe:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803701:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803704:	85 db                	test   %ebx,%ebx
+  803706:	0f 84 ac 00 00 00    	je     8037b8 <ipc_reply_recv+0xc6>
+  80370c:	85 f6                	test   %esi,%esi
+  80370e:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803713:	0f 45 c6             	cmovne %esi,%eax
+  803716:	83 ec 0c             	sub    $0xc,%esp
+  803719:	50                   	push   %eax
+  80371a:	ff 75 14             	push   0x14(%ebp)
+  80371d:	53                   	push   %ebx
+  80371e:	ff 75 0c             	push   0xc(%ebp)
+  803721:	ff 75 08             	push   0x8(%ebp)
+  803724:	e8 fd db ff ff       	call   801326 <sys_ipc_reply_recv>
+  803729:	83 c4 20             	add    $0x20,%esp
+  80372c:	85 c0                	test   %eax,%eax
+  80372e:	78 3a                	js     80376a <ipc_reply_recv+0x78>
+  803730:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803734:	74 10                	je     803746 <ipc_reply_recv+0x54>
+  803736:	a1 14 60 80 00       	mov    0x806014,%eax
+  80373b:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803741:	8b 55 18             	mov    0x18(%ebp),%edx
+  803744:	89 02                	mov    %eax,(%edx)
+  803746:	85 ff                	test   %edi,%edi
+  803748:	74 0d                	je     803757 <ipc_reply_recv+0x65>
+  80374a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80374f:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803755:	89 07                	mov    %eax,(%edi)
+  803757:	a1 14 60 80 00       	mov    0x806014,%eax
+  80375c:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803765:	5b                   	pop    %ebx
+  803766:	5e                   	pop    %esi
+  803767:	5f                   	pop    %edi
+  803768:	5d                   	pop    %ebp
+  803769:	c3                   	ret
+  80376a:	ff 75 14             	push   0x14(%ebp)
+  80376d:	53                   	push   %ebx
+  80376e:	ff 75 0c             	push   0xc(%ebp)
+  803771:	ff 75 08             	push   0x8(%ebp)
+  803774:	e8 5f da ff ff       	call   8011d8 <sys_ipc_try_send>
+  803779:	89 c2                	mov    %eax,%edx
+  80377b:	c1 ea 1f             	shr    $0x1f,%edx
+  80377e:	83 c4 10             	add    $0x10,%esp
+  803781:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803784:	0f 95 c1             	setne  %cl
+  803787:	84 d1                	test   %dl,%cl
+  803789:	74 05                	je     803790 <ipc_reply_recv+0x9e>
+  80378b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80378e:	75 12                	jne    8037a2 <ipc_reply_recv+0xb0>
+  803790:	83 ec 04             	sub    $0x4,%esp
+  803793:	57                   	push   %edi
+  803794:	56                   	push   %esi
+  803795:	ff 75 18             	push   0x18(%ebp)
+  803798:	e8 e3 fd ff ff       	call   803580 <ipc_recv>
+  80379d:	83 c4 10             	add    $0x10,%esp
+  8037a0:	eb c0                	jmp    803762 <ipc_reply_recv+0x70>
+  8037a2:	83 ec 04             	sub    $0x4,%esp
+  8037a5:	50                   	push   %eax
+  8037a6:	ff 75 08             	push   0x8(%ebp)
+  8037a9:	68 c8 41 80 00       	push   $0x8041c8
+  8037ae:	e8 73 cc ff ff       	call   800426 <cprintf>
+  8037b3:	83 c4 10             	add    $0x10,%esp
+  8037b6:	eb d8                	jmp    803790 <ipc_reply_recv+0x9e>
+  8037b8:	85 f6                	test   %esi,%esi
+  8037ba:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8037bf:	0f 45 c6             	cmovne %esi,%eax
+  8037c2:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8037c7:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8037ce:	e9 43 ff ff ff       	jmp    803716 <ipc_reply_recv+0x24>
+
+008037d3 <ipc_find_env>:
+  8037d3:	55                   	push   %ebp
+  8037d4:	89 e5                	mov    %esp,%ebp
+  8037d6:	83 ec 14             	sub    $0x14,%esp
+  8037d9:	ff 75 08             	push   0x8(%ebp)
+  8037dc:	e8 95 d9 ff ff       	call   801176 <sys_env_service>
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037e8:	0f 48 c2             	cmovs  %edx,%eax
+  8037eb:	c9                   	leave
+  8037ec:	c3                   	ret
+
+008037ed <pageref>:
+  8037ed:	55                   	push   %ebp
+  8037ee:	89 e5                	mov    %esp,%ebp
+  8037f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037f3:	89 c2                	mov    %eax,%edx
+  8037f5:	c1 ea 16             	shr    $0x16,%edx
+  8037f8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8037ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  803804:	f6 c1 01             	test   $0x1,%cl
+  803807:	74 22                	je     80382b <pageref+0x3e>
+  803809:	c1 e8 0c             	shr    $0xc,%eax
+  80380c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803813:	a8 01                	test   $0x1,%al
+  803815:	74 14                	je     80382b <pageref+0x3e>
+  803817:	c1 e8 0c             	shr    $0xc,%eax
+  80381a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80381d:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803824:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803828:	0f b7 d2             	movzwl %dx,%edx
+  80382b:	89 d0                	mov    %edx,%eax
+  80382d:	5d                   	pop    %ebp
+  80382e:	c3                   	ret
+
+0080382f <__udivmoddi4>:
+  80382f:	55                   	push   %ebp
+  803830:	57                   	push   %edi
+  803831:	56                   	push   %esi
+  803832:	53                   	push   %ebx
+  803833:	83 ec 24             	sub    $0x24,%esp
+  803836:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80383a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80383e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803842:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803846:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80384a:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80384e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803852:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803856:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80385a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803864:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803869:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803870:	00 
+  803871:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803878:	00 
+  803879:	89 fb                	mov    %edi,%ebx
+  80387b:	eb 08                	jmp    803885 <__udivmoddi4+0x56>
+  80387d:	83 e9 01             	sub    $0x1,%ecx
+  803880:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803883:	74 68                	je     8038ed <__udivmoddi4+0xbe>
+  803885:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803889:	01 c0                	add    %eax,%eax
+  80388b:	89 c6                	mov    %eax,%esi
+  80388d:	89 d7                	mov    %edx,%edi
+  80388f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803893:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803897:	0f ad d0             	shrd   %cl,%edx,%eax
+  80389a:	d3 ea                	shr    %cl,%edx
+  80389c:	f6 c1 20             	test   $0x20,%cl
+  80389f:	74 04                	je     8038a5 <__udivmoddi4+0x76>
+  8038a1:	89 d0                	mov    %edx,%eax
+  8038a3:	31 d2                	xor    %edx,%edx
+  8038a5:	83 e0 01             	and    $0x1,%eax
+  8038a8:	89 04 24             	mov    %eax,(%esp)
+  8038ab:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8038b2:	00 
+  8038b3:	8b 04 24             	mov    (%esp),%eax
+  8038b6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8038ba:	09 f0                	or     %esi,%eax
+  8038bc:	09 fa                	or     %edi,%edx
+  8038be:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8038c2:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8038c6:	39 f0                	cmp    %esi,%eax
+  8038c8:	89 d5                	mov    %edx,%ebp
+  8038ca:	19 fd                	sbb    %edi,%ebp
+  8038cc:	72 af                	jb     80387d <__udivmoddi4+0x4e>
+  8038ce:	29 f0                	sub    %esi,%eax
+  8038d0:	19 fa                	sbb    %edi,%edx
+  8038d2:	89 cf                	mov    %ecx,%edi
+  8038d4:	c1 ef 05             	shr    $0x5,%edi
+  8038d7:	83 e7 01             	and    $0x1,%edi
+  8038da:	89 fe                	mov    %edi,%esi
+  8038dc:	83 f6 01             	xor    $0x1,%esi
+  8038df:	d3 e6                	shl    %cl,%esi
+  8038e1:	d3 e7                	shl    %cl,%edi
+  8038e3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8038e7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8038eb:	eb 90                	jmp    80387d <__udivmoddi4+0x4e>
+  8038ed:	85 db                	test   %ebx,%ebx
+  8038ef:	74 05                	je     8038f6 <__udivmoddi4+0xc7>
+  8038f1:	89 03                	mov    %eax,(%ebx)
+  8038f3:	89 53 04             	mov    %edx,0x4(%ebx)
+  8038f6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8038fa:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8038fe:	83 c4 24             	add    $0x24,%esp
+  803901:	5b                   	pop    %ebx
+  803902:	5e                   	pop    %esi
+  803903:	5f                   	pop    %edi
+  803904:	5d                   	pop    %ebp
+  803905:	c3                   	ret
+
+00803906 <__udivdi3>:
+  803906:	83 ec 08             	sub    $0x8,%esp
+  803909:	6a 00                	push   $0x0
+  80390b:	ff 74 24 1c          	push   0x1c(%esp)
+  80390f:	ff 74 24 1c          	push   0x1c(%esp)
+  803913:	ff 74 24 1c          	push   0x1c(%esp)
+  803917:	ff 74 24 1c          	push   0x1c(%esp)
+  80391b:	e8 0f ff ff ff       	call   80382f <__udivmoddi4>
+  803920:	83 c4 1c             	add    $0x1c,%esp
+  803923:	c3                   	ret
+
+00803924 <__umoddi3>:
+  803924:	83 ec 18             	sub    $0x18,%esp
+  803927:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80392b:	50                   	push   %eax
+  80392c:	ff 74 24 2c          	push   0x2c(%esp)
+  803930:	ff 74 24 2c          	push   0x2c(%esp)
+  803934:	ff 74 24 2c          	push   0x2c(%esp)
+  803938:	ff 74 24 2c          	push   0x2c(%esp)
+  80393c:	e8 ee fe ff ff       	call   80382f <__udivmoddi4>
+  803941:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803945:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803949:	83 c4 2c             	add    $0x2c,%esp
+  80394c:	c3                   	ret
+
+0080394d <__divdi3>:
+  80394d:	53                   	push   %ebx
+  80394e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803952:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803956:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80395a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80395e:	85 d2                	test   %edx,%edx
+  803960:	78 12                	js     803974 <__divdi3+0x27>
+  803962:	85 db                	test   %ebx,%ebx
+  803964:	78 2e                	js     803994 <__divdi3+0x47>
+  803966:	53                   	push   %ebx
+  803967:	51                   	push   %ecx
+  803968:	52                   	push   %edx
+  803969:	50                   	push   %eax
+  80396a:	e8 97 ff ff ff       	call   803906 <__udivdi3>
+  80396f:	83 c4 10             	add    $0x10,%esp
+  803972:	eb 1e                	jmp    803992 <__divdi3+0x45>
+  803974:	f7 d8                	neg    %eax
+  803976:	83 d2 00             	adc    $0x0,%edx
+  803979:	f7 da                	neg    %edx
+  80397b:	85 db                	test   %ebx,%ebx
+  80397d:	78 2a                	js     8039a9 <__divdi3+0x5c>
+  80397f:	53                   	push   %ebx
+  803980:	51                   	push   %ecx
+  803981:	52                   	push   %edx
+  803982:	50                   	push   %eax
+  803983:	e8 7e ff ff ff       	call   803906 <__udivdi3>
+  803988:	83 c4 10             	add    $0x10,%esp
+  80398b:	f7 d8                	neg    %eax
+  80398d:	83 d2 00             	adc    $0x0,%edx
+  803990:	f7 da                	neg    %edx
+  803992:	5b                   	pop    %ebx
+  803993:	c3                   	ret
+  803994:	f7 d9                	neg    %ecx
+  803996:	83 d3 00             	adc    $0x0,%ebx
+  803999:	f7 db                	neg    %ebx
+  80399b:	53                   	push   %ebx
+  80399c:	51                   	push   %ecx
+  80399d:	52                   	push   %edx
+  80399e:	50                   	push   %eax
+  80399f:	e8 62 ff ff ff       	call   803906 <__udivdi3>
+  8039a4:	83 c4 10             	add    $0x10,%esp
+  8039a7:	eb e2                	jmp    80398b <__divdi3+0x3e>
+  8039a9:	f7 d9                	neg    %ecx
+  8039ab:	83 d3 00             	adc    $0x0,%ebx
+  8039ae:	f7 db                	neg    %ebx
+  8039b0:	53                   	push   %ebx
+  8039b1:	51                   	push   %ecx
+  8039b2:	52                   	push   %edx
+  8039b3:	50                   	push   %eax
+  8039b4:	e8 4d ff ff ff       	call   803906 <__udivdi3>
+  8039b9:	83 c4 10             	add    $0x10,%esp
+  8039bc:	eb d4                	jmp    803992 <__divdi3+0x45>
+
+008039be <__moddi3>:
+  8039be:	55                   	push   %ebp
+  8039bf:	57                   	push   %edi
+  8039c0:	56                   	push   %esi
+  8039c1:	53                   	push   %ebx
+  8039c2:	83 ec 0c             	sub    $0xc,%esp
+  8039c5:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8039c9:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8039cd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039d1:	89 e9                	mov    %ebp,%ecx
+  8039d3:	f7 d9                	neg    %ecx
+  8039d5:	89 d0                	mov    %edx,%eax
+  8039d7:	83 d0 00             	adc    $0x0,%eax
+  8039da:	f7 d8                	neg    %eax
+  8039dc:	0f 49 e9             	cmovns %ecx,%ebp
+  8039df:	0f 49 d0             	cmovns %eax,%edx
+  8039e2:	52                   	push   %edx
+  8039e3:	55                   	push   %ebp
+  8039e4:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8039e8:	f7 da                	neg    %edx
+  8039ea:	89 d8                	mov    %ebx,%eax
+  8039ec:	83 d0 00             	adc    $0x0,%eax
+  8039ef:	f7 d8                	neg    %eax
+  8039f1:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8039f6:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8039fa:	0f 48 c3             	cmovs  %ebx,%eax
+  8039fd:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803a01:	ff 74 24 0c          	push   0xc(%esp)
+  803a05:	ff 74 24 0c          	push   0xc(%esp)
+  803a09:	e8 16 ff ff ff       	call   803924 <__umoddi3>
+  803a0e:	83 c4 10             	add    $0x10,%esp
+  803a11:	85 db                	test   %ebx,%ebx
+  803a13:	78 08                	js     803a1d <__moddi3+0x5f>
+  803a15:	83 c4 0c             	add    $0xc,%esp
+  803a18:	5b                   	pop    %ebx
+  803a19:	5e                   	pop    %esi
+  803a1a:	5f                   	pop    %edi
+  803a1b:	5d                   	pop    %ebp
+  803a1c:	c3                   	ret
+  803a1d:	f7 d8                	neg    %eax
+  803a1f:	83 d2 00             	adc    $0x0,%edx
+  803a22:	f7 da                	neg    %edx
+  803a24:	eb ef                	jmp    803a15 <__moddi3+0x57>
@@ -0,0 +1,5628 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 e6 01 00 00       	call   800217 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+  80003b:	68 20 39 80 00       	push   $0x803920
+  800040:	e8 26 03 00 00       	call   80036b <cprintf>
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 0e 31 00 00       	call   80315e <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 fa 00 00 00    	js     800155 <umain+0x122>
+  80005b:	e8 b0 18 00 00       	call   801910 <fork>
+  800060:	89 c6                	mov    %eax,%esi
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 fd 00 00 00    	js     800167 <umain+0x134>
+  80006a:	0f 84 09 01 00 00    	je     800179 <umain+0x146>
+  800070:	83 ec 08             	sub    $0x8,%esp
+  800073:	56                   	push   %esi
+  800074:	68 7a 39 80 00       	push   $0x80397a
+  800079:	e8 ed 02 00 00       	call   80036b <cprintf>
+  80007e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  800084:	83 c4 08             	add    $0x8,%esp
+  800087:	69 de ac 01 00 00    	imul   $0x1ac,%esi,%ebx
+  80008d:	89 d8                	mov    %ebx,%eax
+  80008f:	c1 f8 02             	sar    $0x2,%eax
+  800092:	69 c0 43 ac 28 8d    	imul   $0x8d28ac43,%eax,%eax
+  800098:	50                   	push   %eax
+  800099:	68 85 39 80 00       	push   $0x803985
+  80009e:	e8 c8 02 00 00       	call   80036b <cprintf>
+  8000a3:	83 c4 08             	add    $0x8,%esp
+  8000a6:	6a 0a                	push   $0xa
+  8000a8:	ff 75 f0             	push   -0x10(%ebp)
+  8000ab:	e8 0d 20 00 00       	call   8020bd <dup>
+  8000b0:	8b 83 54 00 c0 ee    	mov    -0x113fffac(%ebx),%eax
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	83 f8 02             	cmp    $0x2,%eax
+  8000bc:	75 24                	jne    8000e2 <umain+0xaf>
+  8000be:	69 de ac 01 00 00    	imul   $0x1ac,%esi,%ebx
+  8000c4:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	6a 0a                	push   $0xa
+  8000cf:	ff 75 f0             	push   -0x10(%ebp)
+  8000d2:	e8 e6 1f 00 00       	call   8020bd <dup>
+  8000d7:	8b 43 54             	mov    0x54(%ebx),%eax
+  8000da:	83 c4 10             	add    $0x10,%esp
+  8000dd:	83 f8 02             	cmp    $0x2,%eax
+  8000e0:	74 e8                	je     8000ca <umain+0x97>
+  8000e2:	83 ec 0c             	sub    $0xc,%esp
+  8000e5:	68 90 39 80 00       	push   $0x803990
+  8000ea:	e8 7c 02 00 00       	call   80036b <cprintf>
+  8000ef:	83 c4 04             	add    $0x4,%esp
+  8000f2:	ff 75 f0             	push   -0x10(%ebp)
+  8000f5:	e8 ae 31 00 00       	call   8032a8 <pipeisclosed>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+  8000fd:	85 c0                	test   %eax,%eax
+  8000ff:	0f 85 d2 00 00 00    	jne    8001d7 <umain+0x1a4>
+  800105:	83 ec 08             	sub    $0x8,%esp
+  800108:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80010b:	50                   	push   %eax
+  80010c:	ff 75 f0             	push   -0x10(%ebp)
+  80010f:	e8 31 1e 00 00       	call   801f45 <fd_lookup>
+  800114:	83 c4 10             	add    $0x10,%esp
+  800117:	85 c0                	test   %eax,%eax
+  800119:	0f 88 cc 00 00 00    	js     8001eb <umain+0x1b8>
+  80011f:	83 ec 0c             	sub    $0xc,%esp
+  800122:	ff 75 ec             	push   -0x14(%ebp)
+  800125:	e8 b4 1d 00 00       	call   801ede <fd2data>
+  80012a:	89 04 24             	mov    %eax,(%esp)
+  80012d:	e8 a5 29 00 00       	call   802ad7 <pageref>
+  800132:	83 c4 10             	add    $0x10,%esp
+  800135:	83 f8 04             	cmp    $0x4,%eax
+  800138:	0f 84 bf 00 00 00    	je     8001fd <umain+0x1ca>
+  80013e:	83 ec 0c             	sub    $0xc,%esp
+  800141:	68 be 39 80 00       	push   $0x8039be
+  800146:	e8 20 02 00 00       	call   80036b <cprintf>
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800151:	5b                   	pop    %ebx
+  800152:	5e                   	pop    %esi
+  800153:	5d                   	pop    %ebp
+  800154:	c3                   	ret
+  800155:	50                   	push   %eax
+  800156:	68 39 39 80 00       	push   $0x803939
+  80015b:	6a 0d                	push   $0xd
+  80015d:	68 42 39 80 00       	push   $0x803942
+  800162:	e8 29 01 00 00       	call   800290 <_panic>
+  800167:	50                   	push   %eax
+  800168:	68 56 39 80 00       	push   $0x803956
+  80016d:	6a 10                	push   $0x10
+  80016f:	68 42 39 80 00       	push   $0x803942
+  800174:	e8 17 01 00 00       	call   800290 <_panic>
+  800179:	83 ec 0c             	sub    $0xc,%esp
+  80017c:	ff 75 f4             	push   -0xc(%ebp)
+  80017f:	e8 e7 1e 00 00       	call   80206b <close>
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	bb c8 00 00 00       	mov    $0xc8,%ebx
+  80018c:	eb 0a                	jmp    800198 <umain+0x165>
+  80018e:	e8 e4 0c 00 00       	call   800e77 <sys_yield>
+  800193:	83 eb 01             	sub    $0x1,%ebx
+  800196:	74 29                	je     8001c1 <umain+0x18e>
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	ff 75 f0             	push   -0x10(%ebp)
+  80019e:	e8 05 31 00 00       	call   8032a8 <pipeisclosed>
+  8001a3:	83 c4 10             	add    $0x10,%esp
+  8001a6:	85 c0                	test   %eax,%eax
+  8001a8:	74 e4                	je     80018e <umain+0x15b>
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+  8001ad:	68 5f 39 80 00       	push   $0x80395f
+  8001b2:	e8 b4 01 00 00       	call   80036b <cprintf>
+  8001b7:	e8 a4 00 00 00       	call   800260 <exit>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	eb cd                	jmp    80018e <umain+0x15b>
+  8001c1:	83 ec 04             	sub    $0x4,%esp
+  8001c4:	6a 00                	push   $0x0
+  8001c6:	6a 00                	push   $0x0
+  8001c8:	6a 00                	push   $0x0
+  8001ca:	e8 92 1a 00 00       	call   801c61 <ipc_recv>
+  8001cf:	83 c4 10             	add    $0x10,%esp
+  8001d2:	e9 99 fe ff ff       	jmp    800070 <umain+0x3d>
+  8001d7:	83 ec 04             	sub    $0x4,%esp
+  8001da:	68 ec 39 80 00       	push   $0x8039ec
+  8001df:	6a 3a                	push   $0x3a
+  8001e1:	68 42 39 80 00       	push   $0x803942
+  8001e6:	e8 a5 00 00 00       	call   800290 <_panic>
+  8001eb:	50                   	push   %eax
+  8001ec:	68 a6 39 80 00       	push   $0x8039a6
+  8001f1:	6a 3c                	push   $0x3c
+  8001f3:	68 42 39 80 00       	push   $0x803942
+  8001f8:	e8 93 00 00 00       	call   800290 <_panic>
+  8001fd:	83 ec 08             	sub    $0x8,%esp
+  800200:	68 c8 00 00 00       	push   $0xc8
+  800205:	68 d4 39 80 00       	push   $0x8039d4
+  80020a:	e8 5c 01 00 00       	call   80036b <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	e9 37 ff ff ff       	jmp    80014e <umain+0x11b>
+
+00800217 <libmain>:
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	56                   	push   %esi
+  80021b:	53                   	push   %ebx
+  80021c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80021f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800222:	e8 31 0c 00 00       	call   800e58 <sys_getenvid>
+  800227:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80022c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800232:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800237:	a3 14 60 80 00       	mov    %eax,0x806014
+  80023c:	85 db                	test   %ebx,%ebx
+  80023e:	7e 07                	jle    800247 <libmain+0x30>
+  800240:	8b 06                	mov    (%esi),%eax
+  800242:	a3 00 50 80 00       	mov    %eax,0x805000
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	56                   	push   %esi
+  80024b:	53                   	push   %ebx
+  80024c:	e8 e2 fd ff ff       	call   800033 <umain>
+  800251:	e8 0a 00 00 00       	call   800260 <exit>
+  800256:	83 c4 10             	add    $0x10,%esp
+  800259:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80025c:	5b                   	pop    %ebx
+  80025d:	5e                   	pop    %esi
+  80025e:	5d                   	pop    %ebp
+  80025f:	c3                   	ret
+
+00800260 <exit>:
+  800260:	55                   	push   %ebp
+  800261:	89 e5                	mov    %esp,%ebp
+  800263:	83 ec 08             	sub    $0x8,%esp
+  800266:	a1 14 60 80 00       	mov    0x806014,%eax
+  80026b:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800271:	85 c0                	test   %eax,%eax
+  800273:	75 14                	jne    800289 <exit+0x29>
+  800275:	e8 1e 1e 00 00       	call   802098 <close_all>
+  80027a:	83 ec 0c             	sub    $0xc,%esp
+  80027d:	6a 00                	push   $0x0
+  80027f:	e8 93 0b 00 00       	call   800e17 <sys_env_destroy>
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+  800289:	e8 f6 12 00 00       	call   801584 <sys_lease_complete>
+  80028e:	eb e5                	jmp    800275 <exit+0x15>
+
+00800290 <_panic>:
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	56                   	push   %esi
+  800294:	53                   	push   %ebx
+  800295:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800298:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80029e:	e8 b5 0b 00 00       	call   800e58 <sys_getenvid>
+  8002a3:	83 ec 0c             	sub    $0xc,%esp
+  8002a6:	ff 75 0c             	push   0xc(%ebp)
+  8002a9:	ff 75 08             	push   0x8(%ebp)
+  8002ac:	56                   	push   %esi
+  8002ad:	50                   	push   %eax
+  8002ae:	68 20 3a 80 00       	push   $0x803a20
+  8002b3:	e8 b3 00 00 00       	call   80036b <cprintf>
+  8002b8:	83 c4 18             	add    $0x18,%esp
+  8002bb:	53                   	push   %ebx
+  8002bc:	ff 75 10             	push   0x10(%ebp)
+  8002bf:	e8 56 00 00 00       	call   80031a <vcprintf>
+  8002c4:	c7 04 24 37 39 80 00 	movl   $0x803937,(%esp)
+  8002cb:	e8 9b 00 00 00       	call   80036b <cprintf>
+  8002d0:	83 c4 10             	add    $0x10,%esp
+  8002d3:	cc                   	int3
+  8002d4:	eb fd                	jmp    8002d3 <_panic+0x43>
+
+008002d6 <putch>:
+  8002d6:	55                   	push   %ebp
+  8002d7:	89 e5                	mov    %esp,%ebp
+  8002d9:	53                   	push   %ebx
+  8002da:	83 ec 04             	sub    $0x4,%esp
+  8002dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002e0:	8b 13                	mov    (%ebx),%edx
+  8002e2:	8d 42 01             	lea    0x1(%edx),%eax
+  8002e5:	89 03                	mov    %eax,(%ebx)
+  8002e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002ea:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8002ee:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002f3:	74 09                	je     8002fe <putch+0x28>
+  8002f5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8002f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002fc:	c9                   	leave
+  8002fd:	c3                   	ret
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+  800301:	68 ff 00 00 00       	push   $0xff
+  800306:	8d 43 08             	lea    0x8(%ebx),%eax
+  800309:	50                   	push   %eax
+  80030a:	e8 cb 0a 00 00       	call   800dda <sys_cputs>
+  80030f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800315:	83 c4 10             	add    $0x10,%esp
+  800318:	eb db                	jmp    8002f5 <putch+0x1f>
+
+0080031a <vcprintf>:
+  80031a:	55                   	push   %ebp
+  80031b:	89 e5                	mov    %esp,%ebp
+  80031d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800323:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80032a:	00 00 00 
+  80032d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800334:	00 00 00 
+  800337:	ff 75 0c             	push   0xc(%ebp)
+  80033a:	ff 75 08             	push   0x8(%ebp)
+  80033d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800343:	50                   	push   %eax
+  800344:	68 d6 02 80 00       	push   $0x8002d6
+  800349:	e8 1c 01 00 00       	call   80046a <vprintfmt>
+  80034e:	83 c4 08             	add    $0x8,%esp
+  800351:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800357:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80035d:	50                   	push   %eax
+  80035e:	e8 77 0a 00 00       	call   800dda <sys_cputs>
+  800363:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800369:	c9                   	leave
+  80036a:	c3                   	ret
+
+0080036b <cprintf>:
+  80036b:	55                   	push   %ebp
+  80036c:	89 e5                	mov    %esp,%ebp
+  80036e:	83 ec 10             	sub    $0x10,%esp
+  800371:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800374:	50                   	push   %eax
+  800375:	ff 75 08             	push   0x8(%ebp)
+  800378:	e8 9d ff ff ff       	call   80031a <vcprintf>
+  80037d:	c9                   	leave
+  80037e:	c3                   	ret
+
+0080037f <printnum>:
+  80037f:	55                   	push   %ebp
+  800380:	89 e5                	mov    %esp,%ebp
+  800382:	57                   	push   %edi
+  800383:	56                   	push   %esi
+  800384:	53                   	push   %ebx
+  800385:	83 ec 1c             	sub    $0x1c,%esp
+  800388:	89 c3                	mov    %eax,%ebx
+  80038a:	89 d6                	mov    %edx,%esi
+  80038c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80038f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800392:	89 d1                	mov    %edx,%ecx
+  800394:	89 c2                	mov    %eax,%edx
+  800396:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800399:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80039c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80039f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003a2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003a9:	39 c2                	cmp    %eax,%edx
+  8003ab:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003ae:	73 4b                	jae    8003fb <printnum+0x7c>
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003b6:	85 ff                	test   %edi,%edi
+  8003b8:	7e 11                	jle    8003cb <printnum+0x4c>
+  8003ba:	83 ec 08             	sub    $0x8,%esp
+  8003bd:	56                   	push   %esi
+  8003be:	ff 75 18             	push   0x18(%ebp)
+  8003c1:	ff d3                	call   *%ebx
+  8003c3:	83 c4 10             	add    $0x10,%esp
+  8003c6:	83 ef 01             	sub    $0x1,%edi
+  8003c9:	75 ef                	jne    8003ba <printnum+0x3b>
+  8003cb:	83 ec 08             	sub    $0x8,%esp
+  8003ce:	56                   	push   %esi
+  8003cf:	83 ec 04             	sub    $0x4,%esp
+  8003d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d5:	ff 75 e0             	push   -0x20(%ebp)
+  8003d8:	ff 75 dc             	push   -0x24(%ebp)
+  8003db:	ff 75 d8             	push   -0x28(%ebp)
+  8003de:	e8 24 34 00 00       	call   803807 <__umoddi3>
+  8003e3:	83 c4 14             	add    $0x14,%esp
+  8003e6:	0f be 80 43 3a 80 00 	movsbl 0x803a43(%eax),%eax
+  8003ed:	50                   	push   %eax
+  8003ee:	ff d3                	call   *%ebx
+  8003f0:	83 c4 10             	add    $0x10,%esp
+  8003f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f6:	5b                   	pop    %ebx
+  8003f7:	5e                   	pop    %esi
+  8003f8:	5f                   	pop    %edi
+  8003f9:	5d                   	pop    %ebp
+  8003fa:	c3                   	ret
+  8003fb:	83 ec 0c             	sub    $0xc,%esp
+  8003fe:	ff 75 18             	push   0x18(%ebp)
+  800401:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800404:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800407:	52                   	push   %edx
+  800408:	50                   	push   %eax
+  800409:	83 ec 08             	sub    $0x8,%esp
+  80040c:	ff 75 e4             	push   -0x1c(%ebp)
+  80040f:	ff 75 e0             	push   -0x20(%ebp)
+  800412:	ff 75 dc             	push   -0x24(%ebp)
+  800415:	ff 75 d8             	push   -0x28(%ebp)
+  800418:	e8 cc 33 00 00       	call   8037e9 <__udivdi3>
+  80041d:	83 c4 18             	add    $0x18,%esp
+  800420:	52                   	push   %edx
+  800421:	50                   	push   %eax
+  800422:	89 f2                	mov    %esi,%edx
+  800424:	89 d8                	mov    %ebx,%eax
+  800426:	e8 54 ff ff ff       	call   80037f <printnum>
+  80042b:	83 c4 20             	add    $0x20,%esp
+  80042e:	eb 9b                	jmp    8003cb <printnum+0x4c>
+
+00800430 <sprintputch>:
+  800430:	55                   	push   %ebp
+  800431:	89 e5                	mov    %esp,%ebp
+  800433:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800436:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80043a:	8b 10                	mov    (%eax),%edx
+  80043c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80043f:	73 0a                	jae    80044b <sprintputch+0x1b>
+  800441:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800444:	89 08                	mov    %ecx,(%eax)
+  800446:	8b 45 08             	mov    0x8(%ebp),%eax
+  800449:	88 02                	mov    %al,(%edx)
+  80044b:	5d                   	pop    %ebp
+  80044c:	c3                   	ret
+
+0080044d <printfmt>:
+  80044d:	55                   	push   %ebp
+  80044e:	89 e5                	mov    %esp,%ebp
+  800450:	83 ec 08             	sub    $0x8,%esp
+  800453:	8d 45 14             	lea    0x14(%ebp),%eax
+  800456:	50                   	push   %eax
+  800457:	ff 75 10             	push   0x10(%ebp)
+  80045a:	ff 75 0c             	push   0xc(%ebp)
+  80045d:	ff 75 08             	push   0x8(%ebp)
+  800460:	e8 05 00 00 00       	call   80046a <vprintfmt>
+  800465:	83 c4 10             	add    $0x10,%esp
+  800468:	c9                   	leave
+  800469:	c3                   	ret
+
+0080046a <vprintfmt>:
+  80046a:	55                   	push   %ebp
+  80046b:	89 e5                	mov    %esp,%ebp
+  80046d:	57                   	push   %edi
+  80046e:	56                   	push   %esi
+  80046f:	53                   	push   %ebx
+  800470:	83 ec 2c             	sub    $0x2c,%esp
+  800473:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800476:	89 df                	mov    %ebx,%edi
+  800478:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80047b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80047e:	8d 70 01             	lea    0x1(%eax),%esi
+  800481:	0f b6 00             	movzbl (%eax),%eax
+  800484:	83 f8 25             	cmp    $0x25,%eax
+  800487:	74 1e                	je     8004a7 <vprintfmt+0x3d>
+  800489:	85 c0                	test   %eax,%eax
+  80048b:	0f 84 15 05 00 00    	je     8009a6 <vprintfmt+0x53c>
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	53                   	push   %ebx
+  800495:	50                   	push   %eax
+  800496:	ff d7                	call   *%edi
+  800498:	83 c6 01             	add    $0x1,%esi
+  80049b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80049f:	83 c4 10             	add    $0x10,%esp
+  8004a2:	83 f8 25             	cmp    $0x25,%eax
+  8004a5:	75 e2                	jne    800489 <vprintfmt+0x1f>
+  8004a7:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8004ab:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8004b2:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004b9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8004c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004c5:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8004c8:	8d 56 01             	lea    0x1(%esi),%edx
+  8004cb:	0f b6 0e             	movzbl (%esi),%ecx
+  8004ce:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004d1:	3c 55                	cmp    $0x55,%al
+  8004d3:	0f 87 3b 04 00 00    	ja     800914 <vprintfmt+0x4aa>
+  8004d9:	0f b6 c0             	movzbl %al,%eax
+  8004dc:	ff 24 85 80 3b 80 00 	jmp    *0x803b80(,%eax,4)
+  8004e3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004e6:	eb 93                	jmp    80047b <vprintfmt+0x11>
+  8004e8:	89 d6                	mov    %edx,%esi
+  8004ea:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004ee:	eb d8                	jmp    8004c8 <vprintfmt+0x5e>
+  8004f0:	89 d6                	mov    %edx,%esi
+  8004f2:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004f6:	eb d0                	jmp    8004c8 <vprintfmt+0x5e>
+  8004f8:	0f b6 c9             	movzbl %cl,%ecx
+  8004fb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004fe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800501:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800505:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800508:	83 f9 09             	cmp    $0x9,%ecx
+  80050b:	77 6f                	ja     80057c <vprintfmt+0x112>
+  80050d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800510:	83 c2 01             	add    $0x1,%edx
+  800513:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800516:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80051a:	0f be 02             	movsbl (%edx),%eax
+  80051d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800520:	83 fe 09             	cmp    $0x9,%esi
+  800523:	76 eb                	jbe    800510 <vprintfmt+0xa6>
+  800525:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800528:	89 d6                	mov    %edx,%esi
+  80052a:	eb 13                	jmp    80053f <vprintfmt+0xd5>
+  80052c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052f:	8b 00                	mov    (%eax),%eax
+  800531:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8d 40 04             	lea    0x4(%eax),%eax
+  80053a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053d:	89 d6                	mov    %edx,%esi
+  80053f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800543:	79 83                	jns    8004c8 <vprintfmt+0x5e>
+  800545:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800548:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80054b:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800552:	e9 71 ff ff ff       	jmp    8004c8 <vprintfmt+0x5e>
+  800557:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80055a:	85 c9                	test   %ecx,%ecx
+  80055c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800561:	0f 49 c1             	cmovns %ecx,%eax
+  800564:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800567:	89 d6                	mov    %edx,%esi
+  800569:	e9 5a ff ff ff       	jmp    8004c8 <vprintfmt+0x5e>
+  80056e:	89 d6                	mov    %edx,%esi
+  800570:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800577:	e9 4c ff ff ff       	jmp    8004c8 <vprintfmt+0x5e>
+  80057c:	89 d6                	mov    %edx,%esi
+  80057e:	eb bf                	jmp    80053f <vprintfmt+0xd5>
+  800580:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800584:	89 d6                	mov    %edx,%esi
+  800586:	e9 3d ff ff ff       	jmp    8004c8 <vprintfmt+0x5e>
+  80058b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8d 70 04             	lea    0x4(%eax),%esi
+  800594:	83 ec 08             	sub    $0x8,%esp
+  800597:	53                   	push   %ebx
+  800598:	ff 30                	push   (%eax)
+  80059a:	ff d7                	call   *%edi
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005a2:	e9 d4 fe ff ff       	jmp    80047b <vprintfmt+0x11>
+  8005a7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8d 70 04             	lea    0x4(%eax),%esi
+  8005b0:	8b 10                	mov    (%eax),%edx
+  8005b2:	89 d0                	mov    %edx,%eax
+  8005b4:	f7 d8                	neg    %eax
+  8005b6:	0f 48 c2             	cmovs  %edx,%eax
+  8005b9:	83 f8 12             	cmp    $0x12,%eax
+  8005bc:	7f 23                	jg     8005e1 <vprintfmt+0x177>
+  8005be:	8b 14 85 e0 3c 80 00 	mov    0x803ce0(,%eax,4),%edx
+  8005c5:	85 d2                	test   %edx,%edx
+  8005c7:	74 18                	je     8005e1 <vprintfmt+0x177>
+  8005c9:	52                   	push   %edx
+  8005ca:	68 8f 3f 80 00       	push   $0x803f8f
+  8005cf:	53                   	push   %ebx
+  8005d0:	57                   	push   %edi
+  8005d1:	e8 77 fe ff ff       	call   80044d <printfmt>
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005dc:	e9 9a fe ff ff       	jmp    80047b <vprintfmt+0x11>
+  8005e1:	50                   	push   %eax
+  8005e2:	68 5b 3a 80 00       	push   $0x803a5b
+  8005e7:	53                   	push   %ebx
+  8005e8:	57                   	push   %edi
+  8005e9:	e8 5f fe ff ff       	call   80044d <printfmt>
+  8005ee:	83 c4 10             	add    $0x10,%esp
+  8005f1:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005f4:	e9 82 fe ff ff       	jmp    80047b <vprintfmt+0x11>
+  8005f9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	83 c0 04             	add    $0x4,%eax
+  800602:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800605:	8b 45 14             	mov    0x14(%ebp),%eax
+  800608:	8b 00                	mov    (%eax),%eax
+  80060a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80060d:	85 c0                	test   %eax,%eax
+  80060f:	0f 84 61 03 00 00    	je     800976 <vprintfmt+0x50c>
+  800615:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800619:	7e 06                	jle    800621 <vprintfmt+0x1b7>
+  80061b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80061f:	75 29                	jne    80064a <vprintfmt+0x1e0>
+  800621:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800624:	8d 70 01             	lea    0x1(%eax),%esi
+  800627:	0f b6 00             	movzbl (%eax),%eax
+  80062a:	0f be d0             	movsbl %al,%edx
+  80062d:	85 d2                	test   %edx,%edx
+  80062f:	0f 84 bb 00 00 00    	je     8006f0 <vprintfmt+0x286>
+  800635:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800638:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80063b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80063e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800641:	eb 7a                	jmp    8006bd <vprintfmt+0x253>
+  800643:	c7 45 d0 54 3a 80 00 	movl   $0x803a54,-0x30(%ebp)
+  80064a:	83 ec 08             	sub    $0x8,%esp
+  80064d:	ff 75 d4             	push   -0x2c(%ebp)
+  800650:	ff 75 d0             	push   -0x30(%ebp)
+  800653:	e8 e0 03 00 00       	call   800a38 <strnlen>
+  800658:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80065b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80065e:	83 c4 10             	add    $0x10,%esp
+  800661:	85 d2                	test   %edx,%edx
+  800663:	0f 8e d6 02 00 00    	jle    80093f <vprintfmt+0x4d5>
+  800669:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80066d:	83 ec 08             	sub    $0x8,%esp
+  800670:	53                   	push   %ebx
+  800671:	56                   	push   %esi
+  800672:	ff d7                	call   *%edi
+  800674:	83 c4 10             	add    $0x10,%esp
+  800677:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80067b:	75 f0                	jne    80066d <vprintfmt+0x203>
+  80067d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800680:	8d 70 01             	lea    0x1(%eax),%esi
+  800683:	0f b6 00             	movzbl (%eax),%eax
+  800686:	0f be d0             	movsbl %al,%edx
+  800689:	85 d2                	test   %edx,%edx
+  80068b:	0f 84 da 02 00 00    	je     80096b <vprintfmt+0x501>
+  800691:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800694:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800697:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80069a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80069d:	eb 1e                	jmp    8006bd <vprintfmt+0x253>
+  80069f:	83 ec 08             	sub    $0x8,%esp
+  8006a2:	ff 75 0c             	push   0xc(%ebp)
+  8006a5:	52                   	push   %edx
+  8006a6:	ff 55 08             	call   *0x8(%ebp)
+  8006a9:	83 c4 10             	add    $0x10,%esp
+  8006ac:	83 eb 01             	sub    $0x1,%ebx
+  8006af:	83 c6 01             	add    $0x1,%esi
+  8006b2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006b6:	0f be d0             	movsbl %al,%edx
+  8006b9:	85 d2                	test   %edx,%edx
+  8006bb:	74 2a                	je     8006e7 <vprintfmt+0x27d>
+  8006bd:	85 ff                	test   %edi,%edi
+  8006bf:	78 05                	js     8006c6 <vprintfmt+0x25c>
+  8006c1:	83 ef 01             	sub    $0x1,%edi
+  8006c4:	78 59                	js     80071f <vprintfmt+0x2b5>
+  8006c6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006ca:	74 d3                	je     80069f <vprintfmt+0x235>
+  8006cc:	0f be c0             	movsbl %al,%eax
+  8006cf:	83 e8 20             	sub    $0x20,%eax
+  8006d2:	83 f8 5e             	cmp    $0x5e,%eax
+  8006d5:	76 c8                	jbe    80069f <vprintfmt+0x235>
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	ff 75 0c             	push   0xc(%ebp)
+  8006dd:	6a 3f                	push   $0x3f
+  8006df:	ff 55 08             	call   *0x8(%ebp)
+  8006e2:	83 c4 10             	add    $0x10,%esp
+  8006e5:	eb c5                	jmp    8006ac <vprintfmt+0x242>
+  8006e7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006f0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006f3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006f7:	7e 1b                	jle    800714 <vprintfmt+0x2aa>
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+  8006fc:	53                   	push   %ebx
+  8006fd:	6a 20                	push   $0x20
+  8006ff:	ff d7                	call   *%edi
+  800701:	83 c4 10             	add    $0x10,%esp
+  800704:	83 ee 01             	sub    $0x1,%esi
+  800707:	75 f0                	jne    8006f9 <vprintfmt+0x28f>
+  800709:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070f:	e9 67 fd ff ff       	jmp    80047b <vprintfmt+0x11>
+  800714:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071a:	e9 5c fd ff ff       	jmp    80047b <vprintfmt+0x11>
+  80071f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800722:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800725:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800728:	eb c6                	jmp    8006f0 <vprintfmt+0x286>
+  80072a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80072d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800730:	83 f9 01             	cmp    $0x1,%ecx
+  800733:	7f 1f                	jg     800754 <vprintfmt+0x2ea>
+  800735:	85 c9                	test   %ecx,%ecx
+  800737:	74 67                	je     8007a0 <vprintfmt+0x336>
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 30                	mov    (%eax),%esi
+  80073e:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800741:	89 f0                	mov    %esi,%eax
+  800743:	c1 f8 1f             	sar    $0x1f,%eax
+  800746:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800749:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074c:	8d 40 04             	lea    0x4(%eax),%eax
+  80074f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800752:	eb 17                	jmp    80076b <vprintfmt+0x301>
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8b 50 04             	mov    0x4(%eax),%edx
+  80075a:	8b 00                	mov    (%eax),%eax
+  80075c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800762:	8b 45 14             	mov    0x14(%ebp),%eax
+  800765:	8d 40 08             	lea    0x8(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80076e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800771:	be 0a 00 00 00       	mov    $0xa,%esi
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	0f 89 12 01 00 00    	jns    800890 <vprintfmt+0x426>
+  80077e:	83 ec 08             	sub    $0x8,%esp
+  800781:	53                   	push   %ebx
+  800782:	6a 2d                	push   $0x2d
+  800784:	ff d7                	call   *%edi
+  800786:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800789:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80078c:	f7 da                	neg    %edx
+  80078e:	83 d1 00             	adc    $0x0,%ecx
+  800791:	f7 d9                	neg    %ecx
+  800793:	83 c4 10             	add    $0x10,%esp
+  800796:	be 0a 00 00 00       	mov    $0xa,%esi
+  80079b:	e9 f0 00 00 00       	jmp    800890 <vprintfmt+0x426>
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8b 30                	mov    (%eax),%esi
+  8007a5:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007a8:	89 f0                	mov    %esi,%eax
+  8007aa:	c1 f8 1f             	sar    $0x1f,%eax
+  8007ad:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b9:	eb b0                	jmp    80076b <vprintfmt+0x301>
+  8007bb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007be:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007c1:	83 f9 01             	cmp    $0x1,%ecx
+  8007c4:	7f 1e                	jg     8007e4 <vprintfmt+0x37a>
+  8007c6:	85 c9                	test   %ecx,%ecx
+  8007c8:	74 32                	je     8007fc <vprintfmt+0x392>
+  8007ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cd:	8b 10                	mov    (%eax),%edx
+  8007cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007da:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007df:	e9 ac 00 00 00       	jmp    800890 <vprintfmt+0x426>
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8b 10                	mov    (%eax),%edx
+  8007e9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ec:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007f7:	e9 94 00 00 00       	jmp    800890 <vprintfmt+0x426>
+  8007fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ff:	8b 10                	mov    (%eax),%edx
+  800801:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800806:	8d 40 04             	lea    0x4(%eax),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800811:	eb 7d                	jmp    800890 <vprintfmt+0x426>
+  800813:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800816:	89 55 10             	mov    %edx,0x10(%ebp)
+  800819:	83 f9 01             	cmp    $0x1,%ecx
+  80081c:	7f 1b                	jg     800839 <vprintfmt+0x3cf>
+  80081e:	85 c9                	test   %ecx,%ecx
+  800820:	74 2c                	je     80084e <vprintfmt+0x3e4>
+  800822:	8b 45 14             	mov    0x14(%ebp),%eax
+  800825:	8b 10                	mov    (%eax),%edx
+  800827:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082c:	8d 40 04             	lea    0x4(%eax),%eax
+  80082f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800832:	be 08 00 00 00       	mov    $0x8,%esi
+  800837:	eb 57                	jmp    800890 <vprintfmt+0x426>
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 10                	mov    (%eax),%edx
+  80083e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800841:	8d 40 08             	lea    0x8(%eax),%eax
+  800844:	89 45 14             	mov    %eax,0x14(%ebp)
+  800847:	be 08 00 00 00       	mov    $0x8,%esi
+  80084c:	eb 42                	jmp    800890 <vprintfmt+0x426>
+  80084e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800851:	8b 10                	mov    (%eax),%edx
+  800853:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800858:	8d 40 04             	lea    0x4(%eax),%eax
+  80085b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80085e:	be 08 00 00 00       	mov    $0x8,%esi
+  800863:	eb 2b                	jmp    800890 <vprintfmt+0x426>
+  800865:	89 55 10             	mov    %edx,0x10(%ebp)
+  800868:	83 ec 08             	sub    $0x8,%esp
+  80086b:	53                   	push   %ebx
+  80086c:	6a 30                	push   $0x30
+  80086e:	ff d7                	call   *%edi
+  800870:	83 c4 08             	add    $0x8,%esp
+  800873:	53                   	push   %ebx
+  800874:	6a 78                	push   $0x78
+  800876:	ff d7                	call   *%edi
+  800878:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087b:	8b 10                	mov    (%eax),%edx
+  80087d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800882:	83 c4 10             	add    $0x10,%esp
+  800885:	8d 40 04             	lea    0x4(%eax),%eax
+  800888:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088b:	be 10 00 00 00       	mov    $0x10,%esi
+  800890:	83 ec 0c             	sub    $0xc,%esp
+  800893:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800897:	50                   	push   %eax
+  800898:	ff 75 e4             	push   -0x1c(%ebp)
+  80089b:	56                   	push   %esi
+  80089c:	51                   	push   %ecx
+  80089d:	52                   	push   %edx
+  80089e:	89 da                	mov    %ebx,%edx
+  8008a0:	89 f8                	mov    %edi,%eax
+  8008a2:	e8 d8 fa ff ff       	call   80037f <printnum>
+  8008a7:	83 c4 20             	add    $0x20,%esp
+  8008aa:	e9 cc fb ff ff       	jmp    80047b <vprintfmt+0x11>
+  8008af:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008b2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b5:	83 f9 01             	cmp    $0x1,%ecx
+  8008b8:	7f 1b                	jg     8008d5 <vprintfmt+0x46b>
+  8008ba:	85 c9                	test   %ecx,%ecx
+  8008bc:	74 2c                	je     8008ea <vprintfmt+0x480>
+  8008be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c1:	8b 10                	mov    (%eax),%edx
+  8008c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ce:	be 10 00 00 00       	mov    $0x10,%esi
+  8008d3:	eb bb                	jmp    800890 <vprintfmt+0x426>
+  8008d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d8:	8b 10                	mov    (%eax),%edx
+  8008da:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e3:	be 10 00 00 00       	mov    $0x10,%esi
+  8008e8:	eb a6                	jmp    800890 <vprintfmt+0x426>
+  8008ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ed:	8b 10                	mov    (%eax),%edx
+  8008ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008fa:	be 10 00 00 00       	mov    $0x10,%esi
+  8008ff:	eb 8f                	jmp    800890 <vprintfmt+0x426>
+  800901:	89 55 10             	mov    %edx,0x10(%ebp)
+  800904:	83 ec 08             	sub    $0x8,%esp
+  800907:	53                   	push   %ebx
+  800908:	6a 25                	push   $0x25
+  80090a:	ff d7                	call   *%edi
+  80090c:	83 c4 10             	add    $0x10,%esp
+  80090f:	e9 67 fb ff ff       	jmp    80047b <vprintfmt+0x11>
+  800914:	83 ec 08             	sub    $0x8,%esp
+  800917:	53                   	push   %ebx
+  800918:	6a 25                	push   $0x25
+  80091a:	ff d7                	call   *%edi
+  80091c:	83 c4 10             	add    $0x10,%esp
+  80091f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800923:	0f 84 ba fb ff ff    	je     8004e3 <vprintfmt+0x79>
+  800929:	89 75 10             	mov    %esi,0x10(%ebp)
+  80092c:	89 f0                	mov    %esi,%eax
+  80092e:	83 e8 01             	sub    $0x1,%eax
+  800931:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800935:	75 f7                	jne    80092e <vprintfmt+0x4c4>
+  800937:	89 45 10             	mov    %eax,0x10(%ebp)
+  80093a:	e9 3c fb ff ff       	jmp    80047b <vprintfmt+0x11>
+  80093f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800942:	8d 70 01             	lea    0x1(%eax),%esi
+  800945:	0f b6 00             	movzbl (%eax),%eax
+  800948:	0f be d0             	movsbl %al,%edx
+  80094b:	85 d2                	test   %edx,%edx
+  80094d:	74 11                	je     800960 <vprintfmt+0x4f6>
+  80094f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800952:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800955:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800958:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80095b:	e9 5d fd ff ff       	jmp    8006bd <vprintfmt+0x253>
+  800960:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800963:	89 45 14             	mov    %eax,0x14(%ebp)
+  800966:	e9 10 fb ff ff       	jmp    80047b <vprintfmt+0x11>
+  80096b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80096e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800971:	e9 05 fb ff ff       	jmp    80047b <vprintfmt+0x11>
+  800976:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80097a:	7e 0a                	jle    800986 <vprintfmt+0x51c>
+  80097c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800980:	0f 85 bd fc ff ff    	jne    800643 <vprintfmt+0x1d9>
+  800986:	ba 28 00 00 00       	mov    $0x28,%edx
+  80098b:	b8 28 00 00 00       	mov    $0x28,%eax
+  800990:	be 55 3a 80 00       	mov    $0x803a55,%esi
+  800995:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800998:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80099b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80099e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009a1:	e9 17 fd ff ff       	jmp    8006bd <vprintfmt+0x253>
+  8009a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a9:	5b                   	pop    %ebx
+  8009aa:	5e                   	pop    %esi
+  8009ab:	5f                   	pop    %edi
+  8009ac:	5d                   	pop    %ebp
+  8009ad:	c3                   	ret
+
+008009ae <vsnprintf>:
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	83 ec 18             	sub    $0x18,%esp
+  8009b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009bd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009c1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009c4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8009cb:	85 c0                	test   %eax,%eax
+  8009cd:	74 26                	je     8009f5 <vsnprintf+0x47>
+  8009cf:	85 d2                	test   %edx,%edx
+  8009d1:	7e 22                	jle    8009f5 <vsnprintf+0x47>
+  8009d3:	ff 75 14             	push   0x14(%ebp)
+  8009d6:	ff 75 10             	push   0x10(%ebp)
+  8009d9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009dc:	50                   	push   %eax
+  8009dd:	68 30 04 80 00       	push   $0x800430
+  8009e2:	e8 83 fa ff ff       	call   80046a <vprintfmt>
+  8009e7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009ea:	c6 00 00             	movb   $0x0,(%eax)
+  8009ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009f0:	83 c4 10             	add    $0x10,%esp
+  8009f3:	c9                   	leave
+  8009f4:	c3                   	ret
+  8009f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009fa:	eb f7                	jmp    8009f3 <vsnprintf+0x45>
+
+008009fc <snprintf>:
+  8009fc:	55                   	push   %ebp
+  8009fd:	89 e5                	mov    %esp,%ebp
+  8009ff:	83 ec 08             	sub    $0x8,%esp
+  800a02:	8d 45 14             	lea    0x14(%ebp),%eax
+  800a05:	50                   	push   %eax
+  800a06:	ff 75 10             	push   0x10(%ebp)
+  800a09:	ff 75 0c             	push   0xc(%ebp)
+  800a0c:	ff 75 08             	push   0x8(%ebp)
+  800a0f:	e8 9a ff ff ff       	call   8009ae <vsnprintf>
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+
+00800a16 <strlen>:
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a1c:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a1f:	74 10                	je     800a31 <strlen+0x1b>
+  800a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a26:	83 c0 01             	add    $0x1,%eax
+  800a29:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a2d:	75 f7                	jne    800a26 <strlen+0x10>
+  800a2f:	5d                   	pop    %ebp
+  800a30:	c3                   	ret
+  800a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a36:	eb f7                	jmp    800a2f <strlen+0x19>
+
+00800a38 <strnlen>:
+  800a38:	55                   	push   %ebp
+  800a39:	89 e5                	mov    %esp,%ebp
+  800a3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a41:	85 d2                	test   %edx,%edx
+  800a43:	74 16                	je     800a5b <strnlen+0x23>
+  800a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a4e:	74 09                	je     800a59 <strnlen+0x21>
+  800a50:	83 c0 01             	add    $0x1,%eax
+  800a53:	39 d0                	cmp    %edx,%eax
+  800a55:	75 f3                	jne    800a4a <strnlen+0x12>
+  800a57:	89 d0                	mov    %edx,%eax
+  800a59:	5d                   	pop    %ebp
+  800a5a:	c3                   	ret
+  800a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a60:	eb f7                	jmp    800a59 <strnlen+0x21>
+
+00800a62 <strcpy>:
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	53                   	push   %ebx
+  800a66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a71:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a75:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a78:	83 c0 01             	add    $0x1,%eax
+  800a7b:	84 d2                	test   %dl,%dl
+  800a7d:	75 f2                	jne    800a71 <strcpy+0xf>
+  800a7f:	89 c8                	mov    %ecx,%eax
+  800a81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+
+00800a86 <strcat>:
+  800a86:	55                   	push   %ebp
+  800a87:	89 e5                	mov    %esp,%ebp
+  800a89:	53                   	push   %ebx
+  800a8a:	83 ec 10             	sub    $0x10,%esp
+  800a8d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a90:	53                   	push   %ebx
+  800a91:	e8 80 ff ff ff       	call   800a16 <strlen>
+  800a96:	83 c4 08             	add    $0x8,%esp
+  800a99:	ff 75 0c             	push   0xc(%ebp)
+  800a9c:	01 d8                	add    %ebx,%eax
+  800a9e:	50                   	push   %eax
+  800a9f:	e8 be ff ff ff       	call   800a62 <strcpy>
+  800aa4:	89 d8                	mov    %ebx,%eax
+  800aa6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+00800aab <strncpy>:
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	56                   	push   %esi
+  800aaf:	53                   	push   %ebx
+  800ab0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ab3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ab9:	85 db                	test   %ebx,%ebx
+  800abb:	74 17                	je     800ad4 <strncpy+0x29>
+  800abd:	01 f3                	add    %esi,%ebx
+  800abf:	89 f0                	mov    %esi,%eax
+  800ac1:	83 c0 01             	add    $0x1,%eax
+  800ac4:	0f b6 0a             	movzbl (%edx),%ecx
+  800ac7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800aca:	80 f9 01             	cmp    $0x1,%cl
+  800acd:	83 da ff             	sbb    $0xffffffff,%edx
+  800ad0:	39 c3                	cmp    %eax,%ebx
+  800ad2:	75 ed                	jne    800ac1 <strncpy+0x16>
+  800ad4:	89 f0                	mov    %esi,%eax
+  800ad6:	5b                   	pop    %ebx
+  800ad7:	5e                   	pop    %esi
+  800ad8:	5d                   	pop    %ebp
+  800ad9:	c3                   	ret
+
+00800ada <strlcpy>:
+  800ada:	55                   	push   %ebp
+  800adb:	89 e5                	mov    %esp,%ebp
+  800add:	56                   	push   %esi
+  800ade:	53                   	push   %ebx
+  800adf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ae2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ae8:	89 f0                	mov    %esi,%eax
+  800aea:	85 db                	test   %ebx,%ebx
+  800aec:	74 1e                	je     800b0c <strlcpy+0x32>
+  800aee:	83 eb 01             	sub    $0x1,%ebx
+  800af1:	74 16                	je     800b09 <strlcpy+0x2f>
+  800af3:	01 f3                	add    %esi,%ebx
+  800af5:	0f b6 0a             	movzbl (%edx),%ecx
+  800af8:	84 c9                	test   %cl,%cl
+  800afa:	74 0d                	je     800b09 <strlcpy+0x2f>
+  800afc:	83 c2 01             	add    $0x1,%edx
+  800aff:	83 c0 01             	add    $0x1,%eax
+  800b02:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b05:	39 d8                	cmp    %ebx,%eax
+  800b07:	75 ec                	jne    800af5 <strlcpy+0x1b>
+  800b09:	c6 00 00             	movb   $0x0,(%eax)
+  800b0c:	29 f0                	sub    %esi,%eax
+  800b0e:	5b                   	pop    %ebx
+  800b0f:	5e                   	pop    %esi
+  800b10:	5d                   	pop    %ebp
+  800b11:	c3                   	ret
+
+00800b12 <strcmp>:
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b18:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b1b:	0f b6 01             	movzbl (%ecx),%eax
+  800b1e:	84 c0                	test   %al,%al
+  800b20:	74 11                	je     800b33 <strcmp+0x21>
+  800b22:	38 02                	cmp    %al,(%edx)
+  800b24:	75 0d                	jne    800b33 <strcmp+0x21>
+  800b26:	83 c1 01             	add    $0x1,%ecx
+  800b29:	83 c2 01             	add    $0x1,%edx
+  800b2c:	0f b6 01             	movzbl (%ecx),%eax
+  800b2f:	84 c0                	test   %al,%al
+  800b31:	75 ef                	jne    800b22 <strcmp+0x10>
+  800b33:	0f b6 c0             	movzbl %al,%eax
+  800b36:	0f b6 12             	movzbl (%edx),%edx
+  800b39:	29 d0                	sub    %edx,%eax
+  800b3b:	5d                   	pop    %ebp
+  800b3c:	c3                   	ret
+
+00800b3d <strncmp>:
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	53                   	push   %ebx
+  800b41:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b47:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4f:	85 d2                	test   %edx,%edx
+  800b51:	74 2e                	je     800b81 <strncmp+0x44>
+  800b53:	0f b6 01             	movzbl (%ecx),%eax
+  800b56:	84 c0                	test   %al,%al
+  800b58:	74 16                	je     800b70 <strncmp+0x33>
+  800b5a:	3a 03                	cmp    (%ebx),%al
+  800b5c:	75 12                	jne    800b70 <strncmp+0x33>
+  800b5e:	83 c1 01             	add    $0x1,%ecx
+  800b61:	83 c3 01             	add    $0x1,%ebx
+  800b64:	83 ea 01             	sub    $0x1,%edx
+  800b67:	75 ea                	jne    800b53 <strncmp+0x16>
+  800b69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6e:	eb 11                	jmp    800b81 <strncmp+0x44>
+  800b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b75:	85 d2                	test   %edx,%edx
+  800b77:	74 08                	je     800b81 <strncmp+0x44>
+  800b79:	0f b6 01             	movzbl (%ecx),%eax
+  800b7c:	0f b6 13             	movzbl (%ebx),%edx
+  800b7f:	29 d0                	sub    %edx,%eax
+  800b81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b84:	c9                   	leave
+  800b85:	c3                   	ret
+
+00800b86 <strchr>:
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b90:	0f b6 10             	movzbl (%eax),%edx
+  800b93:	84 d2                	test   %dl,%dl
+  800b95:	74 15                	je     800bac <strchr+0x26>
+  800b97:	38 d1                	cmp    %dl,%cl
+  800b99:	74 0f                	je     800baa <strchr+0x24>
+  800b9b:	83 c0 01             	add    $0x1,%eax
+  800b9e:	0f b6 10             	movzbl (%eax),%edx
+  800ba1:	84 d2                	test   %dl,%dl
+  800ba3:	75 f2                	jne    800b97 <strchr+0x11>
+  800ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800baa:	5d                   	pop    %ebp
+  800bab:	c3                   	ret
+  800bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb1:	eb f7                	jmp    800baa <strchr+0x24>
+
+00800bb3 <strfind>:
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	53                   	push   %ebx
+  800bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bbd:	0f b6 18             	movzbl (%eax),%ebx
+  800bc0:	38 d3                	cmp    %dl,%bl
+  800bc2:	74 14                	je     800bd8 <strfind+0x25>
+  800bc4:	89 d1                	mov    %edx,%ecx
+  800bc6:	84 db                	test   %bl,%bl
+  800bc8:	74 0e                	je     800bd8 <strfind+0x25>
+  800bca:	83 c0 01             	add    $0x1,%eax
+  800bcd:	0f b6 10             	movzbl (%eax),%edx
+  800bd0:	38 ca                	cmp    %cl,%dl
+  800bd2:	74 04                	je     800bd8 <strfind+0x25>
+  800bd4:	84 d2                	test   %dl,%dl
+  800bd6:	75 f2                	jne    800bca <strfind+0x17>
+  800bd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bdb:	c9                   	leave
+  800bdc:	c3                   	ret
+
+00800bdd <memset>:
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	57                   	push   %edi
+  800be1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800be4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800be7:	85 c9                	test   %ecx,%ecx
+  800be9:	74 20                	je     800c0b <memset+0x2e>
+  800beb:	89 f8                	mov    %edi,%eax
+  800bed:	09 c8                	or     %ecx,%eax
+  800bef:	a8 03                	test   $0x3,%al
+  800bf1:	75 12                	jne    800c05 <memset+0x28>
+  800bf3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bf7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800bfd:	c1 e9 02             	shr    $0x2,%ecx
+  800c00:	fc                   	cld
+  800c01:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c03:	eb 06                	jmp    800c0b <memset+0x2e>
+  800c05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c08:	fc                   	cld
+  800c09:	f3 aa                	rep stos %al,%es:(%edi)
+  800c0b:	89 f8                	mov    %edi,%eax
+  800c0d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c10:	c9                   	leave
+  800c11:	c3                   	ret
+
+00800c12 <memmove>:
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	57                   	push   %edi
+  800c16:	56                   	push   %esi
+  800c17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c1d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c20:	39 c6                	cmp    %eax,%esi
+  800c22:	73 32                	jae    800c56 <memmove+0x44>
+  800c24:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c27:	39 d0                	cmp    %edx,%eax
+  800c29:	73 2b                	jae    800c56 <memmove+0x44>
+  800c2b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800c2e:	89 d6                	mov    %edx,%esi
+  800c30:	09 fe                	or     %edi,%esi
+  800c32:	09 ce                	or     %ecx,%esi
+  800c34:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c3a:	75 0e                	jne    800c4a <memmove+0x38>
+  800c3c:	83 ef 04             	sub    $0x4,%edi
+  800c3f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c42:	c1 e9 02             	shr    $0x2,%ecx
+  800c45:	fd                   	std
+  800c46:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c48:	eb 09                	jmp    800c53 <memmove+0x41>
+  800c4a:	83 ef 01             	sub    $0x1,%edi
+  800c4d:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800c50:	fd                   	std
+  800c51:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c53:	fc                   	cld
+  800c54:	eb 1a                	jmp    800c70 <memmove+0x5e>
+  800c56:	89 f2                	mov    %esi,%edx
+  800c58:	09 c2                	or     %eax,%edx
+  800c5a:	09 ca                	or     %ecx,%edx
+  800c5c:	f6 c2 03             	test   $0x3,%dl
+  800c5f:	75 0a                	jne    800c6b <memmove+0x59>
+  800c61:	c1 e9 02             	shr    $0x2,%ecx
+  800c64:	89 c7                	mov    %eax,%edi
+  800c66:	fc                   	cld
+  800c67:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c69:	eb 05                	jmp    800c70 <memmove+0x5e>
+  800c6b:	89 c7                	mov    %eax,%edi
+  800c6d:	fc                   	cld
+  800c6e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c70:	5e                   	pop    %esi
+  800c71:	5f                   	pop    %edi
+  800c72:	5d                   	pop    %ebp
+  800c73:	c3                   	ret
+
+00800c74 <memcpy>:
+  800c74:	55                   	push   %ebp
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	83 ec 0c             	sub    $0xc,%esp
+  800c7a:	ff 75 10             	push   0x10(%ebp)
+  800c7d:	ff 75 0c             	push   0xc(%ebp)
+  800c80:	ff 75 08             	push   0x8(%ebp)
+  800c83:	e8 8a ff ff ff       	call   800c12 <memmove>
+  800c88:	c9                   	leave
+  800c89:	c3                   	ret
+
+00800c8a <memcmp>:
+  800c8a:	55                   	push   %ebp
+  800c8b:	89 e5                	mov    %esp,%ebp
+  800c8d:	56                   	push   %esi
+  800c8e:	53                   	push   %ebx
+  800c8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c92:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c95:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c98:	85 f6                	test   %esi,%esi
+  800c9a:	74 29                	je     800cc5 <memcmp+0x3b>
+  800c9c:	01 c6                	add    %eax,%esi
+  800c9e:	0f b6 08             	movzbl (%eax),%ecx
+  800ca1:	0f b6 1a             	movzbl (%edx),%ebx
+  800ca4:	38 d9                	cmp    %bl,%cl
+  800ca6:	75 11                	jne    800cb9 <memcmp+0x2f>
+  800ca8:	83 c0 01             	add    $0x1,%eax
+  800cab:	83 c2 01             	add    $0x1,%edx
+  800cae:	39 c6                	cmp    %eax,%esi
+  800cb0:	75 ec                	jne    800c9e <memcmp+0x14>
+  800cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb7:	eb 08                	jmp    800cc1 <memcmp+0x37>
+  800cb9:	0f b6 c1             	movzbl %cl,%eax
+  800cbc:	0f b6 db             	movzbl %bl,%ebx
+  800cbf:	29 d8                	sub    %ebx,%eax
+  800cc1:	5b                   	pop    %ebx
+  800cc2:	5e                   	pop    %esi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+  800cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cca:	eb f5                	jmp    800cc1 <memcmp+0x37>
+
+00800ccc <memfind>:
+  800ccc:	55                   	push   %ebp
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd5:	89 c2                	mov    %eax,%edx
+  800cd7:	03 55 10             	add    0x10(%ebp),%edx
+  800cda:	39 d0                	cmp    %edx,%eax
+  800cdc:	73 0d                	jae    800ceb <memfind+0x1f>
+  800cde:	38 08                	cmp    %cl,(%eax)
+  800ce0:	74 0d                	je     800cef <memfind+0x23>
+  800ce2:	83 c0 01             	add    $0x1,%eax
+  800ce5:	39 c2                	cmp    %eax,%edx
+  800ce7:	75 f5                	jne    800cde <memfind+0x12>
+  800ce9:	eb 06                	jmp    800cf1 <memfind+0x25>
+  800ceb:	89 c2                	mov    %eax,%edx
+  800ced:	eb 02                	jmp    800cf1 <memfind+0x25>
+  800cef:	89 c2                	mov    %eax,%edx
+  800cf1:	89 d0                	mov    %edx,%eax
+  800cf3:	5d                   	pop    %ebp
+  800cf4:	c3                   	ret
+
+00800cf5 <strtol>:
+  800cf5:	55                   	push   %ebp
+  800cf6:	89 e5                	mov    %esp,%ebp
+  800cf8:	57                   	push   %edi
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+  800cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d01:	0f b6 02             	movzbl (%edx),%eax
+  800d04:	3c 20                	cmp    $0x20,%al
+  800d06:	74 04                	je     800d0c <strtol+0x17>
+  800d08:	3c 09                	cmp    $0x9,%al
+  800d0a:	75 0e                	jne    800d1a <strtol+0x25>
+  800d0c:	83 c2 01             	add    $0x1,%edx
+  800d0f:	0f b6 02             	movzbl (%edx),%eax
+  800d12:	3c 20                	cmp    $0x20,%al
+  800d14:	74 f6                	je     800d0c <strtol+0x17>
+  800d16:	3c 09                	cmp    $0x9,%al
+  800d18:	74 f2                	je     800d0c <strtol+0x17>
+  800d1a:	3c 2b                	cmp    $0x2b,%al
+  800d1c:	74 2a                	je     800d48 <strtol+0x53>
+  800d1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d23:	3c 2d                	cmp    $0x2d,%al
+  800d25:	74 2b                	je     800d52 <strtol+0x5d>
+  800d27:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d2d:	75 0f                	jne    800d3e <strtol+0x49>
+  800d2f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d32:	74 28                	je     800d5c <strtol+0x67>
+  800d34:	85 db                	test   %ebx,%ebx
+  800d36:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d3b:	0f 44 d8             	cmove  %eax,%ebx
+  800d3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d43:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d46:	eb 46                	jmp    800d8e <strtol+0x99>
+  800d48:	83 c2 01             	add    $0x1,%edx
+  800d4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d50:	eb d5                	jmp    800d27 <strtol+0x32>
+  800d52:	83 c2 01             	add    $0x1,%edx
+  800d55:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d5a:	eb cb                	jmp    800d27 <strtol+0x32>
+  800d5c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d60:	74 0e                	je     800d70 <strtol+0x7b>
+  800d62:	85 db                	test   %ebx,%ebx
+  800d64:	75 d8                	jne    800d3e <strtol+0x49>
+  800d66:	83 c2 01             	add    $0x1,%edx
+  800d69:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d6e:	eb ce                	jmp    800d3e <strtol+0x49>
+  800d70:	83 c2 02             	add    $0x2,%edx
+  800d73:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d78:	eb c4                	jmp    800d3e <strtol+0x49>
+  800d7a:	0f be c0             	movsbl %al,%eax
+  800d7d:	83 e8 30             	sub    $0x30,%eax
+  800d80:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d83:	7d 3a                	jge    800dbf <strtol+0xca>
+  800d85:	83 c2 01             	add    $0x1,%edx
+  800d88:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d8c:	01 c1                	add    %eax,%ecx
+  800d8e:	0f b6 02             	movzbl (%edx),%eax
+  800d91:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d94:	89 f3                	mov    %esi,%ebx
+  800d96:	80 fb 09             	cmp    $0x9,%bl
+  800d99:	76 df                	jbe    800d7a <strtol+0x85>
+  800d9b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d9e:	89 f3                	mov    %esi,%ebx
+  800da0:	80 fb 19             	cmp    $0x19,%bl
+  800da3:	77 08                	ja     800dad <strtol+0xb8>
+  800da5:	0f be c0             	movsbl %al,%eax
+  800da8:	83 e8 57             	sub    $0x57,%eax
+  800dab:	eb d3                	jmp    800d80 <strtol+0x8b>
+  800dad:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800db0:	89 f3                	mov    %esi,%ebx
+  800db2:	80 fb 19             	cmp    $0x19,%bl
+  800db5:	77 08                	ja     800dbf <strtol+0xca>
+  800db7:	0f be c0             	movsbl %al,%eax
+  800dba:	83 e8 37             	sub    $0x37,%eax
+  800dbd:	eb c1                	jmp    800d80 <strtol+0x8b>
+  800dbf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dc3:	74 05                	je     800dca <strtol+0xd5>
+  800dc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dc8:	89 10                	mov    %edx,(%eax)
+  800dca:	89 c8                	mov    %ecx,%eax
+  800dcc:	f7 d8                	neg    %eax
+  800dce:	85 ff                	test   %edi,%edi
+  800dd0:	0f 45 c8             	cmovne %eax,%ecx
+  800dd3:	89 c8                	mov    %ecx,%eax
+  800dd5:	5b                   	pop    %ebx
+  800dd6:	5e                   	pop    %esi
+  800dd7:	5f                   	pop    %edi
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	c3                   	ret
+
+00800dda <sys_cputs>:
+  800dda:	55                   	push   %ebp
+  800ddb:	89 e5                	mov    %esp,%ebp
+  800ddd:	57                   	push   %edi
+  800dde:	56                   	push   %esi
+  800ddf:	53                   	push   %ebx
+  800de0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800deb:	89 c3                	mov    %eax,%ebx
+  800ded:	89 c7                	mov    %eax,%edi
+  800def:	89 c6                	mov    %eax,%esi
+  800df1:	cd 30                	int    $0x30
+  800df3:	5b                   	pop    %ebx
+  800df4:	5e                   	pop    %esi
+  800df5:	5f                   	pop    %edi
+  800df6:	5d                   	pop    %ebp
+  800df7:	c3                   	ret
+
+00800df8 <sys_cgetc>:
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	57                   	push   %edi
+  800dfc:	56                   	push   %esi
+  800dfd:	53                   	push   %ebx
+  800dfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e03:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e08:	89 d1                	mov    %edx,%ecx
+  800e0a:	89 d3                	mov    %edx,%ebx
+  800e0c:	89 d7                	mov    %edx,%edi
+  800e0e:	89 d6                	mov    %edx,%esi
+  800e10:	cd 30                	int    $0x30
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+
+00800e17 <sys_env_destroy>:
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	57                   	push   %edi
+  800e1b:	56                   	push   %esi
+  800e1c:	53                   	push   %ebx
+  800e1d:	83 ec 0c             	sub    $0xc,%esp
+  800e20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e28:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e2d:	89 cb                	mov    %ecx,%ebx
+  800e2f:	89 cf                	mov    %ecx,%edi
+  800e31:	89 ce                	mov    %ecx,%esi
+  800e33:	cd 30                	int    $0x30
+  800e35:	85 c0                	test   %eax,%eax
+  800e37:	7f 08                	jg     800e41 <sys_env_destroy+0x2a>
+  800e39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5f                   	pop    %edi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+  800e41:	83 ec 0c             	sub    $0xc,%esp
+  800e44:	50                   	push   %eax
+  800e45:	6a 03                	push   $0x3
+  800e47:	68 4b 3d 80 00       	push   $0x803d4b
+  800e4c:	6a 24                	push   $0x24
+  800e4e:	68 68 3d 80 00       	push   $0x803d68
+  800e53:	e8 38 f4 ff ff       	call   800290 <_panic>
+
+00800e58 <sys_getenvid>:
+  800e58:	55                   	push   %ebp
+  800e59:	89 e5                	mov    %esp,%ebp
+  800e5b:	57                   	push   %edi
+  800e5c:	56                   	push   %esi
+  800e5d:	53                   	push   %ebx
+  800e5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e63:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e68:	89 d1                	mov    %edx,%ecx
+  800e6a:	89 d3                	mov    %edx,%ebx
+  800e6c:	89 d7                	mov    %edx,%edi
+  800e6e:	89 d6                	mov    %edx,%esi
+  800e70:	cd 30                	int    $0x30
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5f                   	pop    %edi
+  800e75:	5d                   	pop    %ebp
+  800e76:	c3                   	ret
+
+00800e77 <sys_yield>:
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	57                   	push   %edi
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+  800e7d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e84:	74 26                	je     800eac <sys_yield+0x35>
+  800e86:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e90:	89 d1                	mov    %edx,%ecx
+  800e92:	89 d3                	mov    %edx,%ebx
+  800e94:	89 d7                	mov    %edx,%edi
+  800e96:	6a 00                	push   $0x0
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	8d 35 a3 0e 80 00    	lea    0x800ea3,%esi
+  800ea1:	0f 34                	sysenter
+  800ea3:	5d                   	pop    %ebp
+  800ea4:	83 c4 04             	add    $0x4,%esp
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5f                   	pop    %edi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+  800eac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eb6:	89 d1                	mov    %edx,%ecx
+  800eb8:	89 d3                	mov    %edx,%ebx
+  800eba:	89 d7                	mov    %edx,%edi
+  800ebc:	89 d6                	mov    %edx,%esi
+  800ebe:	cd 30                	int    $0x30
+  800ec0:	eb e5                	jmp    800ea7 <sys_yield+0x30>
+
+00800ec2 <sys_page_alloc>:
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	57                   	push   %edi
+  800ec6:	56                   	push   %esi
+  800ec7:	53                   	push   %ebx
+  800ec8:	83 ec 0c             	sub    $0xc,%esp
+  800ecb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800edb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ede:	89 f7                	mov    %esi,%edi
+  800ee0:	cd 30                	int    $0x30
+  800ee2:	85 c0                	test   %eax,%eax
+  800ee4:	7f 08                	jg     800eee <sys_page_alloc+0x2c>
+  800ee6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee9:	5b                   	pop    %ebx
+  800eea:	5e                   	pop    %esi
+  800eeb:	5f                   	pop    %edi
+  800eec:	5d                   	pop    %ebp
+  800eed:	c3                   	ret
+  800eee:	83 ec 0c             	sub    $0xc,%esp
+  800ef1:	50                   	push   %eax
+  800ef2:	6a 04                	push   $0x4
+  800ef4:	68 4b 3d 80 00       	push   $0x803d4b
+  800ef9:	6a 24                	push   $0x24
+  800efb:	68 68 3d 80 00       	push   $0x803d68
+  800f00:	e8 8b f3 ff ff       	call   800290 <_panic>
+
+00800f05 <sys_page_map>:
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	57                   	push   %edi
+  800f09:	56                   	push   %esi
+  800f0a:	53                   	push   %ebx
+  800f0b:	83 ec 0c             	sub    $0xc,%esp
+  800f0e:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f15:	74 33                	je     800f4a <sys_page_map+0x45>
+  800f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f25:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f28:	ff 75 18             	push   0x18(%ebp)
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	8d 35 36 0f 80 00    	lea    0x800f36,%esi
+  800f34:	0f 34                	sysenter
+  800f36:	5d                   	pop    %ebp
+  800f37:	83 c4 04             	add    $0x4,%esp
+  800f3a:	89 c2                	mov    %eax,%edx
+  800f3c:	85 c0                	test   %eax,%eax
+  800f3e:	7f 3d                	jg     800f7d <sys_page_map+0x78>
+  800f40:	89 d0                	mov    %edx,%eax
+  800f42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f45:	5b                   	pop    %ebx
+  800f46:	5e                   	pop    %esi
+  800f47:	5f                   	pop    %edi
+  800f48:	5d                   	pop    %ebp
+  800f49:	c3                   	ret
+  800f4a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f58:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f5e:	cd 30                	int    $0x30
+  800f60:	89 c2                	mov    %eax,%edx
+  800f62:	85 c0                	test   %eax,%eax
+  800f64:	7e da                	jle    800f40 <sys_page_map+0x3b>
+  800f66:	83 ec 0c             	sub    $0xc,%esp
+  800f69:	50                   	push   %eax
+  800f6a:	6a 05                	push   $0x5
+  800f6c:	68 4b 3d 80 00       	push   $0x803d4b
+  800f71:	6a 24                	push   $0x24
+  800f73:	68 68 3d 80 00       	push   $0x803d68
+  800f78:	e8 13 f3 ff ff       	call   800290 <_panic>
+  800f7d:	83 ec 0c             	sub    $0xc,%esp
+  800f80:	50                   	push   %eax
+  800f81:	6a 05                	push   $0x5
+  800f83:	68 4b 3d 80 00       	push   $0x803d4b
+  800f88:	6a 48                	push   $0x48
+  800f8a:	68 68 3d 80 00       	push   $0x803d68
+  800f8f:	e8 fc f2 ff ff       	call   800290 <_panic>
+
+00800f94 <sys_page_unmap>:
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	57                   	push   %edi
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+  800f9a:	83 ec 0c             	sub    $0xc,%esp
+  800f9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fad:	89 df                	mov    %ebx,%edi
+  800faf:	89 de                	mov    %ebx,%esi
+  800fb1:	cd 30                	int    $0x30
+  800fb3:	85 c0                	test   %eax,%eax
+  800fb5:	7f 08                	jg     800fbf <sys_page_unmap+0x2b>
+  800fb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+  800fbf:	83 ec 0c             	sub    $0xc,%esp
+  800fc2:	50                   	push   %eax
+  800fc3:	6a 06                	push   $0x6
+  800fc5:	68 4b 3d 80 00       	push   $0x803d4b
+  800fca:	6a 24                	push   $0x24
+  800fcc:	68 68 3d 80 00       	push   $0x803d68
+  800fd1:	e8 ba f2 ff ff       	call   800290 <_panic>
+
+00800fd6 <sys_fork>:
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+  800fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fe6:	89 d1                	mov    %edx,%ecx
+  800fe8:	89 d3                	mov    %edx,%ebx
+  800fea:	89 d7                	mov    %edx,%edi
+  800fec:	89 d6                	mov    %edx,%esi
+  800fee:	cd 30                	int    $0x30
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_env_set_status>:
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+  800ffe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	b8 08 00 00 00       	mov    $0x8,%eax
+  80100e:	89 df                	mov    %ebx,%edi
+  801010:	89 de                	mov    %ebx,%esi
+  801012:	cd 30                	int    $0x30
+  801014:	85 c0                	test   %eax,%eax
+  801016:	7f 08                	jg     801020 <sys_env_set_status+0x2b>
+  801018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+  801020:	83 ec 0c             	sub    $0xc,%esp
+  801023:	50                   	push   %eax
+  801024:	6a 08                	push   $0x8
+  801026:	68 4b 3d 80 00       	push   $0x803d4b
+  80102b:	6a 24                	push   $0x24
+  80102d:	68 68 3d 80 00       	push   $0x803d68
+  801032:	e8 59 f2 ff ff       	call   800290 <_panic>
+
+00801037 <sys_env_set_trapframe>:
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+  80103d:	83 ec 0c             	sub    $0xc,%esp
+  801040:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801045:	8b 55 08             	mov    0x8(%ebp),%edx
+  801048:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801050:	89 df                	mov    %ebx,%edi
+  801052:	89 de                	mov    %ebx,%esi
+  801054:	cd 30                	int    $0x30
+  801056:	85 c0                	test   %eax,%eax
+  801058:	7f 08                	jg     801062 <sys_env_set_trapframe+0x2b>
+  80105a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105d:	5b                   	pop    %ebx
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+  801062:	83 ec 0c             	sub    $0xc,%esp
+  801065:	50                   	push   %eax
+  801066:	6a 09                	push   $0x9
+  801068:	68 4b 3d 80 00       	push   $0x803d4b
+  80106d:	6a 24                	push   $0x24
+  80106f:	68 68 3d 80 00       	push   $0x803d68
+  801074:	e8 17 f2 ff ff       	call   800290 <_panic>
+
+00801079 <sys_env_set_cow>:
+  801079:	55                   	push   %ebp
+  80107a:	89 e5                	mov    %esp,%ebp
+  80107c:	57                   	push   %edi
+  80107d:	56                   	push   %esi
+  80107e:	53                   	push   %ebx
+  80107f:	83 ec 0c             	sub    $0xc,%esp
+  801082:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801087:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801092:	89 df                	mov    %ebx,%edi
+  801094:	89 de                	mov    %ebx,%esi
+  801096:	cd 30                	int    $0x30
+  801098:	85 c0                	test   %eax,%eax
+  80109a:	7f 08                	jg     8010a4 <sys_env_set_cow+0x2b>
+  80109c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5f                   	pop    %edi
+  8010a2:	5d                   	pop    %ebp
+  8010a3:	c3                   	ret
+  8010a4:	83 ec 0c             	sub    $0xc,%esp
+  8010a7:	50                   	push   %eax
+  8010a8:	6a 20                	push   $0x20
+  8010aa:	68 4b 3d 80 00       	push   $0x803d4b
+  8010af:	6a 24                	push   $0x24
+  8010b1:	68 68 3d 80 00       	push   $0x803d68
+  8010b6:	e8 d5 f1 ff ff       	call   800290 <_panic>
+
+008010bb <sys_env_service>:
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+  8010c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8010ce:	89 cb                	mov    %ecx,%ebx
+  8010d0:	89 cf                	mov    %ecx,%edi
+  8010d2:	89 ce                	mov    %ecx,%esi
+  8010d4:	cd 30                	int    $0x30
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+
+008010db <sys_env_set_pgfault_upcall>:
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010f4:	89 df                	mov    %ebx,%edi
+  8010f6:	89 de                	mov    %ebx,%esi
+  8010f8:	cd 30                	int    $0x30
+  8010fa:	85 c0                	test   %eax,%eax
+  8010fc:	7f 08                	jg     801106 <sys_env_set_pgfault_upcall+0x2b>
+  8010fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801101:	5b                   	pop    %ebx
+  801102:	5e                   	pop    %esi
+  801103:	5f                   	pop    %edi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+  801106:	83 ec 0c             	sub    $0xc,%esp
+  801109:	50                   	push   %eax
+  80110a:	6a 0a                	push   $0xa
+  80110c:	68 4b 3d 80 00       	push   $0x803d4b
+  801111:	6a 24                	push   $0x24
+  801113:	68 68 3d 80 00       	push   $0x803d68
+  801118:	e8 73 f1 ff ff       	call   800290 <_panic>
+
+0080111d <sys_ipc_try_send>:
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	57                   	push   %edi
+  801121:	56                   	push   %esi
+  801122:	53                   	push   %ebx
+  801123:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80112a:	74 27                	je     801153 <sys_ipc_try_send+0x36>
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801132:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801137:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113d:	6a 00                	push   $0x0
+  80113f:	55                   	push   %ebp
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	8d 35 4a 11 80 00    	lea    0x80114a,%esi
+  801148:	0f 34                	sysenter
+  80114a:	5d                   	pop    %ebp
+  80114b:	83 c4 04             	add    $0x4,%esp
+  80114e:	5b                   	pop    %ebx
+  80114f:	5e                   	pop    %esi
+  801150:	5f                   	pop    %edi
+  801151:	5d                   	pop    %ebp
+  801152:	c3                   	ret
+  801153:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801158:	be 00 00 00 00       	mov    $0x0,%esi
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801166:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801169:	cd 30                	int    $0x30
+  80116b:	eb e1                	jmp    80114e <sys_ipc_try_send+0x31>
+
+0080116d <sys_ipc_recv>:
+  80116d:	55                   	push   %ebp
+  80116e:	89 e5                	mov    %esp,%ebp
+  801170:	57                   	push   %edi
+  801171:	56                   	push   %esi
+  801172:	53                   	push   %ebx
+  801173:	83 ec 0c             	sub    $0xc,%esp
+  801176:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80117d:	74 32                	je     8011b1 <sys_ipc_recv+0x44>
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801187:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80118c:	89 cb                	mov    %ecx,%ebx
+  80118e:	89 cf                	mov    %ecx,%edi
+  801190:	6a 00                	push   $0x0
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	8d 35 9d 11 80 00    	lea    0x80119d,%esi
+  80119b:	0f 34                	sysenter
+  80119d:	5d                   	pop    %ebp
+  80119e:	83 c4 04             	add    $0x4,%esp
+  8011a1:	89 c2                	mov    %eax,%edx
+  8011a3:	85 c0                	test   %eax,%eax
+  8011a5:	7f 3c                	jg     8011e3 <sys_ipc_recv+0x76>
+  8011a7:	89 d0                	mov    %edx,%eax
+  8011a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5e                   	pop    %esi
+  8011ae:	5f                   	pop    %edi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+  8011b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011be:	89 cb                	mov    %ecx,%ebx
+  8011c0:	89 cf                	mov    %ecx,%edi
+  8011c2:	89 ce                	mov    %ecx,%esi
+  8011c4:	cd 30                	int    $0x30
+  8011c6:	89 c2                	mov    %eax,%edx
+  8011c8:	85 c0                	test   %eax,%eax
+  8011ca:	7e db                	jle    8011a7 <sys_ipc_recv+0x3a>
+  8011cc:	83 ec 0c             	sub    $0xc,%esp
+  8011cf:	50                   	push   %eax
+  8011d0:	6a 0d                	push   $0xd
+  8011d2:	68 4b 3d 80 00       	push   $0x803d4b
+  8011d7:	6a 24                	push   $0x24
+  8011d9:	68 68 3d 80 00       	push   $0x803d68
+  8011de:	e8 ad f0 ff ff       	call   800290 <_panic>
+  8011e3:	83 ec 0c             	sub    $0xc,%esp
+  8011e6:	50                   	push   %eax
+  8011e7:	6a 0d                	push   $0xd
+  8011e9:	68 4b 3d 80 00       	push   $0x803d4b
+  8011ee:	6a 48                	push   $0x48
+  8011f0:	68 68 3d 80 00       	push   $0x803d68
+  8011f5:	e8 96 f0 ff ff       	call   800290 <_panic>
+
+008011fa <sys_ipc_send>:
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	57                   	push   %edi
+  8011fe:	56                   	push   %esi
+  8011ff:	53                   	push   %ebx
+  801200:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801207:	74 27                	je     801230 <sys_ipc_send+0x36>
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801214:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801217:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121a:	6a 00                	push   $0x0
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	8d 35 27 12 80 00    	lea    0x801227,%esi
+  801225:	0f 34                	sysenter
+  801227:	5d                   	pop    %ebp
+  801228:	83 c4 04             	add    $0x4,%esp
+  80122b:	5b                   	pop    %ebx
+  80122c:	5e                   	pop    %esi
+  80122d:	5f                   	pop    %edi
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+  801230:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801235:	be 00 00 00 00       	mov    $0x0,%esi
+  80123a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801240:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801243:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801246:	cd 30                	int    $0x30
+  801248:	eb e1                	jmp    80122b <sys_ipc_send+0x31>
+
+0080124a <sys_ipc_call>:
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	57                   	push   %edi
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+  801250:	8b 55 08             	mov    0x8(%ebp),%edx
+  801253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801256:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80125b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801261:	8b 75 18             	mov    0x18(%ebp),%esi
+  801264:	cd 30                	int    $0x30
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+
+0080126b <sys_ipc_reply_recv>:
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 10 00 00 00       	mov    $0x10,%eax
+  80127c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80127f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801282:	8b 75 18             	mov    0x18(%ebp),%esi
+  801285:	cd 30                	int    $0x30
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+
+0080128c <sys_time_msec>:
+  80128c:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801291:	85 c0                	test   %eax,%eax
+  801293:	75 06                	jne    80129b <sys_time_msec+0xf>
+  801295:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  80129a:	c3                   	ret
+  80129b:	55                   	push   %ebp
+  80129c:	89 e5                	mov    %esp,%ebp
+  80129e:	57                   	push   %edi
+  80129f:	56                   	push   %esi
+  8012a0:	53                   	push   %ebx
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	0f 31                	rdtsc
+  8012a6:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8012ac:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8012b2:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8012b8:	29 c8                	sub    %ecx,%eax
+  8012ba:	19 da                	sbb    %ebx,%edx
+  8012bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	52                   	push   %edx
+  8012c4:	50                   	push   %eax
+  8012c5:	e8 1f 25 00 00       	call   8037e9 <__udivdi3>
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d0:	5b                   	pop    %ebx
+  8012d1:	5e                   	pop    %esi
+  8012d2:	5f                   	pop    %edi
+  8012d3:	5d                   	pop    %ebp
+  8012d4:	c3                   	ret
+
+008012d5 <sys_env_swap>:
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	57                   	push   %edi
+  8012d9:	56                   	push   %esi
+  8012da:	53                   	push   %ebx
+  8012db:	83 ec 0c             	sub    $0xc,%esp
+  8012de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012eb:	89 cb                	mov    %ecx,%ebx
+  8012ed:	89 cf                	mov    %ecx,%edi
+  8012ef:	89 ce                	mov    %ecx,%esi
+  8012f1:	cd 30                	int    $0x30
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	7f 08                	jg     8012ff <sys_env_swap+0x2a>
+  8012f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fa:	5b                   	pop    %ebx
+  8012fb:	5e                   	pop    %esi
+  8012fc:	5f                   	pop    %edi
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	50                   	push   %eax
+  801303:	6a 12                	push   $0x12
+  801305:	68 4b 3d 80 00       	push   $0x803d4b
+  80130a:	6a 24                	push   $0x24
+  80130c:	68 68 3d 80 00       	push   $0x803d68
+  801311:	e8 7a ef ff ff       	call   800290 <_panic>
+
+00801316 <sys_net_try_send>:
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	57                   	push   %edi
+  80131a:	56                   	push   %esi
+  80131b:	53                   	push   %ebx
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+  80131f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801324:	8b 55 08             	mov    0x8(%ebp),%edx
+  801327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80132f:	89 df                	mov    %ebx,%edi
+  801331:	89 de                	mov    %ebx,%esi
+  801333:	cd 30                	int    $0x30
+  801335:	85 c0                	test   %eax,%eax
+  801337:	7f 08                	jg     801341 <sys_net_try_send+0x2b>
+  801339:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133c:	5b                   	pop    %ebx
+  80133d:	5e                   	pop    %esi
+  80133e:	5f                   	pop    %edi
+  80133f:	5d                   	pop    %ebp
+  801340:	c3                   	ret
+  801341:	83 ec 0c             	sub    $0xc,%esp
+  801344:	50                   	push   %eax
+  801345:	6a 13                	push   $0x13
+  801347:	68 4b 3d 80 00       	push   $0x803d4b
+  80134c:	6a 24                	push   $0x24
+  80134e:	68 68 3d 80 00       	push   $0x803d68
+  801353:	e8 38 ef ff ff       	call   800290 <_panic>
+
+00801358 <sys_net_try_receive>:
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	57                   	push   %edi
+  80135c:	56                   	push   %esi
+  80135d:	53                   	push   %ebx
+  80135e:	83 ec 0c             	sub    $0xc,%esp
+  801361:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801366:	8b 55 08             	mov    0x8(%ebp),%edx
+  801369:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801371:	89 df                	mov    %ebx,%edi
+  801373:	89 de                	mov    %ebx,%esi
+  801375:	cd 30                	int    $0x30
+  801377:	85 c0                	test   %eax,%eax
+  801379:	7f 08                	jg     801383 <sys_net_try_receive+0x2b>
+  80137b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137e:	5b                   	pop    %ebx
+  80137f:	5e                   	pop    %esi
+  801380:	5f                   	pop    %edi
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  801386:	50                   	push   %eax
+  801387:	6a 14                	push   $0x14
+  801389:	68 4b 3d 80 00       	push   $0x803d4b
+  80138e:	6a 24                	push   $0x24
+  801390:	68 68 3d 80 00       	push   $0x803d68
+  801395:	e8 f6 ee ff ff       	call   800290 <_panic>
+
+0080139a <sys_net_recv_page>:
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+  80139d:	57                   	push   %edi
+  80139e:	56                   	push   %esi
+  80139f:	53                   	push   %ebx
+  8013a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a8:	b8 27 00 00 00       	mov    $0x27,%eax
+  8013ad:	89 cb                	mov    %ecx,%ebx
+  8013af:	89 cf                	mov    %ecx,%edi
+  8013b1:	89 ce                	mov    %ecx,%esi
+  8013b3:	cd 30                	int    $0x30
+  8013b5:	5b                   	pop    %ebx
+  8013b6:	5e                   	pop    %esi
+  8013b7:	5f                   	pop    %edi
+  8013b8:	5d                   	pop    %ebp
+  8013b9:	c3                   	ret
+
+008013ba <sys_net_wait>:
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	57                   	push   %edi
+  8013be:	56                   	push   %esi
+  8013bf:	53                   	push   %ebx
+  8013c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c5:	b8 26 00 00 00       	mov    $0x26,%eax
+  8013ca:	89 d1                	mov    %edx,%ecx
+  8013cc:	89 d3                	mov    %edx,%ebx
+  8013ce:	89 d7                	mov    %edx,%edi
+  8013d0:	89 d6                	mov    %edx,%esi
+  8013d2:	cd 30                	int    $0x30
+  8013d4:	5b                   	pop    %ebx
+  8013d5:	5e                   	pop    %esi
+  8013d6:	5f                   	pop    %edi
+  8013d7:	5d                   	pop    %ebp
+  8013d8:	c3                   	ret
+
+008013d9 <sys_get_mac>:
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	57                   	push   %edi
+  8013dd:	56                   	push   %esi
+  8013de:	53                   	push   %ebx
+  8013df:	83 ec 0c             	sub    $0xc,%esp
+  8013e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ed:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013f2:	89 df                	mov    %ebx,%edi
+  8013f4:	89 de                	mov    %ebx,%esi
+  8013f6:	cd 30                	int    $0x30
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	7f 08                	jg     801404 <sys_get_mac+0x2b>
+  8013fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ff:	5b                   	pop    %ebx
+  801400:	5e                   	pop    %esi
+  801401:	5f                   	pop    %edi
+  801402:	5d                   	pop    %ebp
+  801403:	c3                   	ret
+  801404:	83 ec 0c             	sub    $0xc,%esp
+  801407:	50                   	push   %eax
+  801408:	6a 15                	push   $0x15
+  80140a:	68 4b 3d 80 00       	push   $0x803d4b
+  80140f:	6a 24                	push   $0x24
+  801411:	68 68 3d 80 00       	push   $0x803d68
+  801416:	e8 75 ee ff ff       	call   800290 <_panic>
+
+0080141b <sys_env_lease>:
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	57                   	push   %edi
+  80141f:	56                   	push   %esi
+  801420:	53                   	push   %ebx
+  801421:	83 ec 0c             	sub    $0xc,%esp
+  801424:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801434:	89 df                	mov    %ebx,%edi
+  801436:	89 de                	mov    %ebx,%esi
+  801438:	cd 30                	int    $0x30
+  80143a:	85 c0                	test   %eax,%eax
+  80143c:	7f 08                	jg     801446 <sys_env_lease+0x2b>
+  80143e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5f                   	pop    %edi
+  801444:	5d                   	pop    %ebp
+  801445:	c3                   	ret
+  801446:	83 ec 0c             	sub    $0xc,%esp
+  801449:	50                   	push   %eax
+  80144a:	6a 16                	push   $0x16
+  80144c:	68 4b 3d 80 00       	push   $0x803d4b
+  801451:	6a 24                	push   $0x24
+  801453:	68 68 3d 80 00       	push   $0x803d68
+  801458:	e8 33 ee ff ff       	call   800290 <_panic>
+
+0080145d <sys_copy_mem>:
+  80145d:	55                   	push   %ebp
+  80145e:	89 e5                	mov    %esp,%ebp
+  801460:	57                   	push   %edi
+  801461:	56                   	push   %esi
+  801462:	53                   	push   %ebx
+  801463:	83 ec 0c             	sub    $0xc,%esp
+  801466:	8b 55 08             	mov    0x8(%ebp),%edx
+  801469:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801471:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801474:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801477:	8b 75 18             	mov    0x18(%ebp),%esi
+  80147a:	cd 30                	int    $0x30
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	7f 08                	jg     801488 <sys_copy_mem+0x2b>
+  801480:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801483:	5b                   	pop    %ebx
+  801484:	5e                   	pop    %esi
+  801485:	5f                   	pop    %edi
+  801486:	5d                   	pop    %ebp
+  801487:	c3                   	ret
+  801488:	83 ec 0c             	sub    $0xc,%esp
+  80148b:	50                   	push   %eax
+  80148c:	6a 17                	push   $0x17
+  80148e:	68 4b 3d 80 00       	push   $0x803d4b
+  801493:	6a 24                	push   $0x24
+  801495:	68 68 3d 80 00       	push   $0x803d68
+  80149a:	e8 f1 ed ff ff       	call   800290 <_panic>
+
+0080149f <sys_get_perms>:
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	57                   	push   %edi
+  8014a3:	56                   	push   %esi
+  8014a4:	53                   	push   %ebx
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014bb:	89 f7                	mov    %esi,%edi
+  8014bd:	cd 30                	int    $0x30
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	7f 08                	jg     8014cb <sys_get_perms+0x2c>
+  8014c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c6:	5b                   	pop    %ebx
+  8014c7:	5e                   	pop    %esi
+  8014c8:	5f                   	pop    %edi
+  8014c9:	5d                   	pop    %ebp
+  8014ca:	c3                   	ret
+  8014cb:	83 ec 0c             	sub    $0xc,%esp
+  8014ce:	50                   	push   %eax
+  8014cf:	6a 18                	push   $0x18
+  8014d1:	68 4b 3d 80 00       	push   $0x803d4b
+  8014d6:	6a 24                	push   $0x24
+  8014d8:	68 68 3d 80 00       	push   $0x803d68
+  8014dd:	e8 ae ed ff ff       	call   800290 <_panic>
+
+008014e2 <sys_env_unsuspend>:
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	57                   	push   %edi
+  8014e6:	56                   	push   %esi
+  8014e7:	53                   	push   %ebx
+  8014e8:	83 ec 0c             	sub    $0xc,%esp
+  8014eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fe:	89 f7                	mov    %esi,%edi
+  801500:	cd 30                	int    $0x30
+  801502:	85 c0                	test   %eax,%eax
+  801504:	7f 08                	jg     80150e <sys_env_unsuspend+0x2c>
+  801506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801509:	5b                   	pop    %ebx
+  80150a:	5e                   	pop    %esi
+  80150b:	5f                   	pop    %edi
+  80150c:	5d                   	pop    %ebp
+  80150d:	c3                   	ret
+  80150e:	83 ec 0c             	sub    $0xc,%esp
+  801511:	50                   	push   %eax
+  801512:	6a 19                	push   $0x19
+  801514:	68 4b 3d 80 00       	push   $0x803d4b
+  801519:	6a 24                	push   $0x24
+  80151b:	68 68 3d 80 00       	push   $0x803d68
+  801520:	e8 6b ed ff ff       	call   800290 <_panic>
+
+00801525 <sys_migrate>:
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+  801528:	57                   	push   %edi
+  801529:	56                   	push   %esi
+  80152a:	53                   	push   %ebx
+  80152b:	83 ec 0c             	sub    $0xc,%esp
+  80152e:	ba 04 90 80 00       	mov    $0x809004,%edx
+  801533:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801539:	76 11                	jbe    80154c <sys_migrate+0x27>
+  80153b:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801540:	0f b6 08             	movzbl (%eax),%ecx
+  801543:	05 00 10 00 00       	add    $0x1000,%eax
+  801548:	39 d0                	cmp    %edx,%eax
+  80154a:	72 f4                	jb     801540 <sys_migrate+0x1b>
+  80154c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801551:	8b 55 08             	mov    0x8(%ebp),%edx
+  801554:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801559:	89 cb                	mov    %ecx,%ebx
+  80155b:	89 cf                	mov    %ecx,%edi
+  80155d:	89 ce                	mov    %ecx,%esi
+  80155f:	cd 30                	int    $0x30
+  801561:	85 c0                	test   %eax,%eax
+  801563:	7f 08                	jg     80156d <sys_migrate+0x48>
+  801565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801568:	5b                   	pop    %ebx
+  801569:	5e                   	pop    %esi
+  80156a:	5f                   	pop    %edi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+  80156d:	83 ec 0c             	sub    $0xc,%esp
+  801570:	50                   	push   %eax
+  801571:	6a 1a                	push   $0x1a
+  801573:	68 4b 3d 80 00       	push   $0x803d4b
+  801578:	6a 24                	push   $0x24
+  80157a:	68 68 3d 80 00       	push   $0x803d68
+  80157f:	e8 0c ed ff ff       	call   800290 <_panic>
+
+00801584 <sys_lease_complete>:
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	57                   	push   %edi
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+  80158a:	83 ec 0c             	sub    $0xc,%esp
+  80158d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801592:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801597:	89 d1                	mov    %edx,%ecx
+  801599:	89 d3                	mov    %edx,%ebx
+  80159b:	89 d7                	mov    %edx,%edi
+  80159d:	89 d6                	mov    %edx,%esi
+  80159f:	cd 30                	int    $0x30
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	7f 08                	jg     8015ad <sys_lease_complete+0x29>
+  8015a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a8:	5b                   	pop    %ebx
+  8015a9:	5e                   	pop    %esi
+  8015aa:	5f                   	pop    %edi
+  8015ab:	5d                   	pop    %ebp
+  8015ac:	c3                   	ret
+  8015ad:	83 ec 0c             	sub    $0xc,%esp
+  8015b0:	50                   	push   %eax
+  8015b1:	6a 1b                	push   $0x1b
+  8015b3:	68 4b 3d 80 00       	push   $0x803d4b
+  8015b8:	6a 24                	push   $0x24
+  8015ba:	68 68 3d 80 00       	push   $0x803d68
+  8015bf:	e8 cc ec ff ff       	call   800290 <_panic>
+
+008015c4 <sys_env_set_thisenv>:
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	57                   	push   %edi
+  8015c8:	56                   	push   %esi
+  8015c9:	53                   	push   %ebx
+  8015ca:	83 ec 0c             	sub    $0xc,%esp
+  8015cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015dd:	89 df                	mov    %ebx,%edi
+  8015df:	89 de                	mov    %ebx,%esi
+  8015e1:	cd 30                	int    $0x30
+  8015e3:	85 c0                	test   %eax,%eax
+  8015e5:	7f 08                	jg     8015ef <sys_env_set_thisenv+0x2b>
+  8015e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ea:	5b                   	pop    %ebx
+  8015eb:	5e                   	pop    %esi
+  8015ec:	5f                   	pop    %edi
+  8015ed:	5d                   	pop    %ebp
+  8015ee:	c3                   	ret
+  8015ef:	83 ec 0c             	sub    $0xc,%esp
+  8015f2:	50                   	push   %eax
+  8015f3:	6a 1c                	push   $0x1c
+  8015f5:	68 4b 3d 80 00       	push   $0x803d4b
+  8015fa:	6a 24                	push   $0x24
+  8015fc:	68 68 3d 80 00       	push   $0x803d68
+  801601:	e8 8a ec ff ff       	call   800290 <_panic>
+
+00801606 <sys_env_set_sched>:
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	57                   	push   %edi
+  80160a:	56                   	push   %esi
+  80160b:	53                   	push   %ebx
+  80160c:	83 ec 0c             	sub    $0xc,%esp
+  80160f:	be 00 00 00 00       	mov    $0x0,%esi
+  801614:	8b 55 08             	mov    0x8(%ebp),%edx
+  801617:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80161f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801622:	89 f7                	mov    %esi,%edi
+  801624:	cd 30                	int    $0x30
+  801626:	85 c0                	test   %eax,%eax
+  801628:	7f 08                	jg     801632 <sys_env_set_sched+0x2c>
+  80162a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162d:	5b                   	pop    %ebx
+  80162e:	5e                   	pop    %esi
+  80162f:	5f                   	pop    %edi
+  801630:	5d                   	pop    %ebp
+  801631:	c3                   	ret
+  801632:	83 ec 0c             	sub    $0xc,%esp
+  801635:	50                   	push   %eax
+  801636:	6a 1d                	push   $0x1d
+  801638:	68 4b 3d 80 00       	push   $0x803d4b
+  80163d:	6a 24                	push   $0x24
+  80163f:	68 68 3d 80 00       	push   $0x803d68
+  801644:	e8 47 ec ff ff       	call   800290 <_panic>
+
+00801649 <sys_batch>:
+  801649:	55                   	push   %ebp
+  80164a:	89 e5                	mov    %esp,%ebp
+  80164c:	57                   	push   %edi
+  80164d:	56                   	push   %esi
+  80164e:	53                   	push   %ebx
+  80164f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801654:	8b 55 08             	mov    0x8(%ebp),%edx
+  801657:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80165f:	89 df                	mov    %ebx,%edi
+  801661:	89 de                	mov    %ebx,%esi
+  801663:	cd 30                	int    $0x30
+  801665:	5b                   	pop    %ebx
+  801666:	5e                   	pop    %esi
+  801667:	5f                   	pop    %edi
+  801668:	5d                   	pop    %ebp
+  801669:	c3                   	ret
+
+0080166a <sys_env_stats>:
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	57                   	push   %edi
+  80166e:	56                   	push   %esi
+  80166f:	53                   	push   %ebx
+  801670:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801675:	8b 55 08             	mov    0x8(%ebp),%edx
+  801678:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167b:	b8 23 00 00 00       	mov    $0x23,%eax
+  801680:	89 df                	mov    %ebx,%edi
+  801682:	89 de                	mov    %ebx,%esi
+  801684:	cd 30                	int    $0x30
+  801686:	5b                   	pop    %ebx
+  801687:	5e                   	pop    %esi
+  801688:	5f                   	pop    %edi
+  801689:	5d                   	pop    %ebp
+  80168a:	c3                   	ret
+
+0080168b <sys_trace>:
+  80168b:	55                   	push   %ebp
+  80168c:	89 e5                	mov    %esp,%ebp
+  80168e:	57                   	push   %edi
+  80168f:	56                   	push   %esi
+  801690:	53                   	push   %ebx
+  801691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801696:	8b 55 08             	mov    0x8(%ebp),%edx
+  801699:	b8 24 00 00 00       	mov    $0x24,%eax
+  80169e:	89 cb                	mov    %ecx,%ebx
+  8016a0:	89 cf                	mov    %ecx,%edi
+  8016a2:	89 ce                	mov    %ecx,%esi
+  8016a4:	cd 30                	int    $0x30
+  8016a6:	5b                   	pop    %ebx
+  8016a7:	5e                   	pop    %esi
+  8016a8:	5f                   	pop    %edi
+  8016a9:	5d                   	pop    %ebp
+  8016aa:	c3                   	ret
+
+008016ab <sys_env_set_pager>:
+  8016ab:	55                   	push   %ebp
+  8016ac:	89 e5                	mov    %esp,%ebp
+  8016ae:	57                   	push   %edi
+  8016af:	56                   	push   %esi
+  8016b0:	53                   	push   %ebx
+  8016b1:	83 ec 0c             	sub    $0xc,%esp
+  8016b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bf:	b8 25 00 00 00       	mov    $0x25,%eax
+  8016c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c7:	89 f7                	mov    %esi,%edi
+  8016c9:	cd 30                	int    $0x30
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	7f 08                	jg     8016d7 <sys_env_set_pager+0x2c>
+  8016cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d2:	5b                   	pop    %ebx
+  8016d3:	5e                   	pop    %esi
+  8016d4:	5f                   	pop    %edi
+  8016d5:	5d                   	pop    %ebp
+  8016d6:	c3                   	ret
+  8016d7:	83 ec 0c             	sub    $0xc,%esp
+  8016da:	50                   	push   %eax
+  8016db:	6a 25                	push   $0x25
+  8016dd:	68 4b 3d 80 00       	push   $0x803d4b
+  8016e2:	6a 24                	push   $0x24
+  8016e4:	68 68 3d 80 00       	push   $0x803d68
+  8016e9:	e8 a2 eb ff ff       	call   800290 <_panic>
+
+008016ee <sys_pager_retire>:
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	57                   	push   %edi
+  8016f2:	56                   	push   %esi
+  8016f3:	53                   	push   %ebx
+  8016f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fc:	b8 28 00 00 00       	mov    $0x28,%eax
+  801701:	89 cb                	mov    %ecx,%ebx
+  801703:	89 cf                	mov    %ecx,%edi
+  801705:	89 ce                	mov    %ecx,%esi
+  801707:	cd 30                	int    $0x30
+  801709:	5b                   	pop    %ebx
+  80170a:	5e                   	pop    %esi
+  80170b:	5f                   	pop    %edi
+  80170c:	5d                   	pop    %ebp
+  80170d:	c3                   	ret
+
+0080170e <sys_prof>:
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	57                   	push   %edi
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+  801714:	be 00 00 00 00       	mov    $0x0,%esi
+  801719:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171f:	b8 22 00 00 00       	mov    $0x22,%eax
+  801724:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801727:	89 f7                	mov    %esi,%edi
+  801729:	cd 30                	int    $0x30
+  80172b:	5b                   	pop    %ebx
+  80172c:	5e                   	pop    %esi
+  80172d:	5f                   	pop    %edi
+  80172e:	5d                   	pop    %ebp
+  80172f:	c3                   	ret
+
+00801730 <dupq_flush>:
+  801730:	55                   	push   %ebp
+  801731:	89 e5                	mov    %esp,%ebp
+  801733:	53                   	push   %ebx
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  80173d:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801744:	00 00 00 
+  801747:	53                   	push   %ebx
+  801748:	68 00 00 40 00       	push   $0x400000
+  80174d:	e8 f7 fe ff ff       	call   801649 <sys_batch>
+  801752:	83 c4 10             	add    $0x10,%esp
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 14                	js     80176d <dupq_flush+0x3d>
+  801759:	39 c3                	cmp    %eax,%ebx
+  80175b:	7e 0b                	jle    801768 <dupq_flush+0x38>
+  80175d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801760:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801766:	eb 05                	jmp    80176d <dupq_flush+0x3d>
+  801768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+
+00801772 <pgfault>:
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	56                   	push   %esi
+  801776:	53                   	push   %ebx
+  801777:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177a:	8b 30                	mov    (%eax),%esi
+  80177c:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801780:	0f 84 83 00 00 00    	je     801809 <pgfault+0x97>
+  801786:	89 f0                	mov    %esi,%eax
+  801788:	c1 e8 0c             	shr    $0xc,%eax
+  80178b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801792:	f6 c4 08             	test   $0x8,%ah
+  801795:	0f 84 80 00 00 00    	je     80181b <pgfault+0xa9>
+  80179b:	e8 b8 f6 ff ff       	call   800e58 <sys_getenvid>
+  8017a0:	89 c3                	mov    %eax,%ebx
+  8017a2:	83 ec 04             	sub    $0x4,%esp
+  8017a5:	6a 07                	push   $0x7
+  8017a7:	68 00 f0 7f 00       	push   $0x7ff000
+  8017ac:	50                   	push   %eax
+  8017ad:	e8 10 f7 ff ff       	call   800ec2 <sys_page_alloc>
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	78 74                	js     80182d <pgfault+0xbb>
+  8017b9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8017bf:	83 ec 04             	sub    $0x4,%esp
+  8017c2:	68 00 10 00 00       	push   $0x1000
+  8017c7:	56                   	push   %esi
+  8017c8:	68 00 f0 7f 00       	push   $0x7ff000
+  8017cd:	e8 40 f4 ff ff       	call   800c12 <memmove>
+  8017d2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8017d9:	56                   	push   %esi
+  8017da:	53                   	push   %ebx
+  8017db:	68 00 f0 7f 00       	push   $0x7ff000
+  8017e0:	53                   	push   %ebx
+  8017e1:	e8 1f f7 ff ff       	call   800f05 <sys_page_map>
+  8017e6:	83 c4 20             	add    $0x20,%esp
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	78 54                	js     801841 <pgfault+0xcf>
+  8017ed:	83 ec 08             	sub    $0x8,%esp
+  8017f0:	68 00 f0 7f 00       	push   $0x7ff000
+  8017f5:	53                   	push   %ebx
+  8017f6:	e8 99 f7 ff ff       	call   800f94 <sys_page_unmap>
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	78 53                	js     801855 <pgfault+0xe3>
+  801802:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801805:	5b                   	pop    %ebx
+  801806:	5e                   	pop    %esi
+  801807:	5d                   	pop    %ebp
+  801808:	c3                   	ret
+  801809:	56                   	push   %esi
+  80180a:	68 78 3d 80 00       	push   $0x803d78
+  80180f:	6a 19                	push   $0x19
+  801811:	68 54 3e 80 00       	push   $0x803e54
+  801816:	e8 75 ea ff ff       	call   800290 <_panic>
+  80181b:	56                   	push   %esi
+  80181c:	68 ac 3d 80 00       	push   $0x803dac
+  801821:	6a 1e                	push   $0x1e
+  801823:	68 54 3e 80 00       	push   $0x803e54
+  801828:	e8 63 ea ff ff       	call   800290 <_panic>
+  80182d:	83 ec 04             	sub    $0x4,%esp
+  801830:	68 e0 3d 80 00       	push   $0x803de0
+  801835:	6a 2e                	push   $0x2e
+  801837:	68 54 3e 80 00       	push   $0x803e54
+  80183c:	e8 4f ea ff ff       	call   800290 <_panic>
+  801841:	83 ec 04             	sub    $0x4,%esp
+  801844:	68 04 3e 80 00       	push   $0x803e04
+  801849:	6a 37                	push   $0x37
+  80184b:	68 54 3e 80 00       	push   $0x803e54
+  801850:	e8 3b ea ff ff       	call   800290 <_panic>
+  801855:	83 ec 04             	sub    $0x4,%esp
+  801858:	68 30 3e 80 00       	push   $0x803e30
+  80185d:	6a 3c                	push   $0x3c
+  80185f:	68 54 3e 80 00       	push   $0x803e54
+  801864:	e8 27 ea ff ff       	call   800290 <_panic>
+
+00801869 <dupq_begin>:
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	83 ec 0c             	sub    $0xc,%esp
+  80186f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801876:	00 00 00 
+  801879:	6a 07                	push   $0x7
+  80187b:	68 00 00 40 00       	push   $0x400000
+  801880:	6a 00                	push   $0x0
+  801882:	e8 3b f6 ff ff       	call   800ec2 <sys_page_alloc>
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+
+00801889 <dupq_map>:
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+  80188c:	83 ec 08             	sub    $0x8,%esp
+  80188f:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  801896:	00 00 00 
+  801899:	74 46                	je     8018e1 <dupq_map+0x58>
+  80189b:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8018a1:	8d 42 01             	lea    0x1(%edx),%eax
+  8018a4:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018a9:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8018ac:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  8018b2:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  8018b9:	00 00 00 
+  8018bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018bf:	89 50 04             	mov    %edx,0x4(%eax)
+  8018c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018c5:	c1 e2 0c             	shl    $0xc,%edx
+  8018c8:	89 50 08             	mov    %edx,0x8(%eax)
+  8018cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8018ce:	89 48 0c             	mov    %ecx,0xc(%eax)
+  8018d1:	89 50 10             	mov    %edx,0x10(%eax)
+  8018d4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8018d7:	89 50 14             	mov    %edx,0x14(%eax)
+  8018da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018df:	c9                   	leave
+  8018e0:	c3                   	ret
+  8018e1:	e8 4a fe ff ff       	call   801730 <dupq_flush>
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	79 b1                	jns    80189b <dupq_map+0x12>
+  8018ea:	eb f3                	jmp    8018df <dupq_map+0x56>
+
+008018ec <dupq_end>:
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	53                   	push   %ebx
+  8018f0:	83 ec 04             	sub    $0x4,%esp
+  8018f3:	e8 38 fe ff ff       	call   801730 <dupq_flush>
+  8018f8:	89 c3                	mov    %eax,%ebx
+  8018fa:	83 ec 08             	sub    $0x8,%esp
+  8018fd:	68 00 00 40 00       	push   $0x400000
+  801902:	6a 00                	push   $0x0
+  801904:	e8 8b f6 ff ff       	call   800f94 <sys_page_unmap>
+  801909:	89 d8                	mov    %ebx,%eax
+  80190b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190e:	c9                   	leave
+  80190f:	c3                   	ret
+
+00801910 <fork>:
+  801910:	55                   	push   %ebp
+  801911:	89 e5                	mov    %esp,%ebp
+  801913:	53                   	push   %ebx
+  801914:	83 ec 10             	sub    $0x10,%esp
+  801917:	68 72 17 80 00       	push   $0x801772
+  80191c:	e8 4e 1d 00 00       	call   80366f <set_pgfault_handler>
+  801921:	83 c4 08             	add    $0x8,%esp
+  801924:	6a 01                	push   $0x1
+  801926:	6a 00                	push   $0x0
+  801928:	e8 4c f7 ff ff       	call   801079 <sys_env_set_cow>
+  80192d:	e8 a4 f6 ff ff       	call   800fd6 <sys_fork>
+  801932:	89 c3                	mov    %eax,%ebx
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	85 c0                	test   %eax,%eax
+  801939:	74 07                	je     801942 <fork+0x32>
+  80193b:	89 d8                	mov    %ebx,%eax
+  80193d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801940:	c9                   	leave
+  801941:	c3                   	ret
+  801942:	e8 11 f5 ff ff       	call   800e58 <sys_getenvid>
+  801947:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80194c:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801952:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801957:	a3 14 60 80 00       	mov    %eax,0x806014
+  80195c:	eb dd                	jmp    80193b <fork+0x2b>
+
+0080195e <sfork>:
+  80195e:	55                   	push   %ebp
+  80195f:	89 e5                	mov    %esp,%ebp
+  801961:	57                   	push   %edi
+  801962:	56                   	push   %esi
+  801963:	53                   	push   %ebx
+  801964:	83 ec 1c             	sub    $0x1c,%esp
+  801967:	e8 ec f4 ff ff       	call   800e58 <sys_getenvid>
+  80196c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80196f:	83 ec 0c             	sub    $0xc,%esp
+  801972:	68 72 17 80 00       	push   $0x801772
+  801977:	e8 f3 1c 00 00       	call   80366f <set_pgfault_handler>
+  80197c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801981:	cd 30                	int    $0x30
+  801983:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801986:	83 c4 10             	add    $0x10,%esp
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	0f 88 45 02 00 00    	js     801bd6 <sfork+0x278>
+  801991:	89 c6                	mov    %eax,%esi
+  801993:	74 17                	je     8019ac <sfork+0x4e>
+  801995:	e8 cf fe ff ff       	call   801869 <dupq_begin>
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	0f 88 40 02 00 00    	js     801be2 <sfork+0x284>
+  8019a2:	bf 02 00 00 00       	mov    $0x2,%edi
+  8019a7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8019aa:	eb 39                	jmp    8019e5 <sfork+0x87>
+  8019ac:	e8 a7 f4 ff ff       	call   800e58 <sys_getenvid>
+  8019b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019b6:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8019bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019c1:	a3 14 60 80 00       	mov    %eax,0x806014
+  8019c6:	e9 23 01 00 00       	jmp    801aee <sfork+0x190>
+  8019cb:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8019d2:	a8 01                	test   $0x1,%al
+  8019d4:	75 5b                	jne    801a31 <sfork+0xd3>
+  8019d6:	83 c7 01             	add    $0x1,%edi
+  8019d9:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  8019df:	0f 84 40 01 00 00    	je     801b25 <sfork+0x1c7>
+  8019e5:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8019ec:	a8 01                	test   $0x1,%al
+  8019ee:	74 db                	je     8019cb <sfork+0x6d>
+  8019f0:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8019f7:	a8 80                	test   $0x80,%al
+  8019f9:	74 d0                	je     8019cb <sfork+0x6d>
+  8019fb:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a02:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a07:	0c 80                	or     $0x80,%al
+  801a09:	50                   	push   %eax
+  801a0a:	ff 75 e4             	push   -0x1c(%ebp)
+  801a0d:	89 f8                	mov    %edi,%eax
+  801a0f:	c1 e0 16             	shl    $0x16,%eax
+  801a12:	c1 e8 0c             	shr    $0xc,%eax
+  801a15:	50                   	push   %eax
+  801a16:	ff 75 e0             	push   -0x20(%ebp)
+  801a19:	e8 6b fe ff ff       	call   801889 <dupq_map>
+  801a1e:	83 c4 10             	add    $0x10,%esp
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	79 b1                	jns    8019d6 <sfork+0x78>
+  801a25:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a2c:	e9 bd 00 00 00       	jmp    801aee <sfork+0x190>
+  801a31:	89 fe                	mov    %edi,%esi
+  801a33:	c1 e6 16             	shl    $0x16,%esi
+  801a36:	89 f0                	mov    %esi,%eax
+  801a38:	c1 e8 0c             	shr    $0xc,%eax
+  801a3b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801a40:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801a43:	eb 57                	jmp    801a9c <sfork+0x13e>
+  801a45:	e8 0e f4 ff ff       	call   800e58 <sys_getenvid>
+  801a4a:	89 c7                	mov    %eax,%edi
+  801a4c:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801a51:	f6 c4 04             	test   $0x4,%ah
+  801a54:	0f 85 9f 00 00 00    	jne    801af9 <sfork+0x19b>
+  801a5a:	a9 02 08 00 00       	test   $0x802,%eax
+  801a5f:	0f 85 c5 01 00 00    	jne    801c2a <sfork+0x2cc>
+  801a65:	6a 05                	push   $0x5
+  801a67:	ff 75 e4             	push   -0x1c(%ebp)
+  801a6a:	68 fd e7 0e 00       	push   $0xee7fd
+  801a6f:	57                   	push   %edi
+  801a70:	e8 14 fe ff ff       	call   801889 <dupq_map>
+  801a75:	83 c4 10             	add    $0x10,%esp
+  801a78:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801a7e:	0f 84 91 00 00 00    	je     801b15 <sfork+0x1b7>
+  801a84:	89 f0                	mov    %esi,%eax
+  801a86:	09 d8                	or     %ebx,%eax
+  801a88:	c1 e8 0c             	shr    $0xc,%eax
+  801a8b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a91:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801a96:	0f 84 81 00 00 00    	je     801b1d <sfork+0x1bf>
+  801a9c:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801aa1:	74 a2                	je     801a45 <sfork+0xe7>
+  801aa3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801aaa:	f6 c2 01             	test   $0x1,%dl
+  801aad:	74 c9                	je     801a78 <sfork+0x11a>
+  801aaf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ab6:	f6 c6 02             	test   $0x2,%dh
+  801ab9:	75 bd                	jne    801a78 <sfork+0x11a>
+  801abb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801ac2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ac9:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801acf:	f7 d2                	not    %edx
+  801ad1:	21 ca                	and    %ecx,%edx
+  801ad3:	52                   	push   %edx
+  801ad4:	ff 75 e4             	push   -0x1c(%ebp)
+  801ad7:	50                   	push   %eax
+  801ad8:	ff 75 e0             	push   -0x20(%ebp)
+  801adb:	e8 a9 fd ff ff       	call   801889 <dupq_map>
+  801ae0:	83 c4 10             	add    $0x10,%esp
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	79 91                	jns    801a78 <sfork+0x11a>
+  801ae7:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801aee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801af1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af4:	5b                   	pop    %ebx
+  801af5:	5e                   	pop    %esi
+  801af6:	5f                   	pop    %edi
+  801af7:	5d                   	pop    %ebp
+  801af8:	c3                   	ret
+  801af9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801afe:	50                   	push   %eax
+  801aff:	ff 75 e4             	push   -0x1c(%ebp)
+  801b02:	68 fd e7 0e 00       	push   $0xee7fd
+  801b07:	57                   	push   %edi
+  801b08:	e8 7c fd ff ff       	call   801889 <dupq_map>
+  801b0d:	83 c4 10             	add    $0x10,%esp
+  801b10:	e9 63 ff ff ff       	jmp    801a78 <sfork+0x11a>
+  801b15:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b18:	e9 b9 fe ff ff       	jmp    8019d6 <sfork+0x78>
+  801b1d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801b20:	e9 b1 fe ff ff       	jmp    8019d6 <sfork+0x78>
+  801b25:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801b28:	e8 bf fd ff ff       	call   8018ec <dupq_end>
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	0f 88 b9 00 00 00    	js     801bee <sfork+0x290>
+  801b35:	83 ec 04             	sub    $0x4,%esp
+  801b38:	6a 07                	push   $0x7
+  801b3a:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b3f:	56                   	push   %esi
+  801b40:	e8 7d f3 ff ff       	call   800ec2 <sys_page_alloc>
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	0f 88 aa 00 00 00    	js     801bfa <sfork+0x29c>
+  801b50:	83 ec 0c             	sub    $0xc,%esp
+  801b53:	6a 07                	push   $0x7
+  801b55:	68 00 f0 7f 00       	push   $0x7ff000
+  801b5a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801b5d:	57                   	push   %edi
+  801b5e:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b63:	56                   	push   %esi
+  801b64:	e8 9c f3 ff ff       	call   800f05 <sys_page_map>
+  801b69:	83 c4 20             	add    $0x20,%esp
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	0f 88 92 00 00 00    	js     801c06 <sfork+0x2a8>
+  801b74:	83 ec 04             	sub    $0x4,%esp
+  801b77:	68 00 10 00 00       	push   $0x1000
+  801b7c:	68 00 f0 7f 00       	push   $0x7ff000
+  801b81:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b86:	e8 87 f0 ff ff       	call   800c12 <memmove>
+  801b8b:	83 c4 08             	add    $0x8,%esp
+  801b8e:	68 00 f0 7f 00       	push   $0x7ff000
+  801b93:	57                   	push   %edi
+  801b94:	e8 fb f3 ff ff       	call   800f94 <sys_page_unmap>
+  801b99:	83 c4 10             	add    $0x10,%esp
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 72                	js     801c12 <sfork+0x2b4>
+  801ba0:	83 ec 08             	sub    $0x8,%esp
+  801ba3:	68 e7 36 80 00       	push   $0x8036e7
+  801ba8:	56                   	push   %esi
+  801ba9:	e8 2d f5 ff ff       	call   8010db <sys_env_set_pgfault_upcall>
+  801bae:	83 c4 10             	add    $0x10,%esp
+  801bb1:	85 c0                	test   %eax,%eax
+  801bb3:	78 69                	js     801c1e <sfork+0x2c0>
+  801bb5:	83 ec 08             	sub    $0x8,%esp
+  801bb8:	6a 02                	push   $0x2
+  801bba:	56                   	push   %esi
+  801bbb:	e8 35 f4 ff ff       	call   800ff5 <sys_env_set_status>
+  801bc0:	83 c4 10             	add    $0x10,%esp
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801bca:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801bce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bd1:	e9 18 ff ff ff       	jmp    801aee <sfork+0x190>
+  801bd6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801bdd:	e9 0c ff ff ff       	jmp    801aee <sfork+0x190>
+  801be2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801be9:	e9 00 ff ff ff       	jmp    801aee <sfork+0x190>
+  801bee:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801bf5:	e9 f4 fe ff ff       	jmp    801aee <sfork+0x190>
+  801bfa:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c01:	e9 e8 fe ff ff       	jmp    801aee <sfork+0x190>
+  801c06:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c0d:	e9 dc fe ff ff       	jmp    801aee <sfork+0x190>
+  801c12:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c19:	e9 d0 fe ff ff       	jmp    801aee <sfork+0x190>
+  801c1e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c25:	e9 c4 fe ff ff       	jmp    801aee <sfork+0x190>
+  801c2a:	68 05 08 00 00       	push   $0x805
+  801c2f:	ff 75 e4             	push   -0x1c(%ebp)
+  801c32:	68 fd e7 0e 00       	push   $0xee7fd
+  801c37:	57                   	push   %edi
+  801c38:	e8 4c fc ff ff       	call   801889 <dupq_map>
+  801c3d:	83 c4 10             	add    $0x10,%esp
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	0f 88 30 fe ff ff    	js     801a78 <sfork+0x11a>
+  801c48:	68 05 08 00 00       	push   $0x805
+  801c4d:	57                   	push   %edi
+  801c4e:	68 fd e7 0e 00       	push   $0xee7fd
+  801c53:	57                   	push   %edi
+  801c54:	e8 30 fc ff ff       	call   801889 <dupq_map>
+  801c59:	83 c4 10             	add    $0x10,%esp
+  801c5c:	e9 17 fe ff ff       	jmp    801a78 <sfork+0x11a>
+
+00801c61 <ipc_recv>:
+  801c61:	55                   	push   %ebp
+  801c62:	89 e5                	mov    %esp,%ebp
+  801c64:	56                   	push   %esi
+  801c65:	53                   	push   %ebx
+  801c66:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801c76:	0f 44 c2             	cmove  %edx,%eax
+  801c79:	83 ec 0c             	sub    $0xc,%esp
+  801c7c:	50                   	push   %eax
+  801c7d:	e8 eb f4 ff ff       	call   80116d <sys_ipc_recv>
+  801c82:	83 c4 10             	add    $0x10,%esp
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	78 2a                	js     801cb3 <ipc_recv+0x52>
+  801c89:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c8e:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801c94:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801c9a:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801ca0:	85 f6                	test   %esi,%esi
+  801ca2:	74 02                	je     801ca6 <ipc_recv+0x45>
+  801ca4:	89 0e                	mov    %ecx,(%esi)
+  801ca6:	85 db                	test   %ebx,%ebx
+  801ca8:	74 02                	je     801cac <ipc_recv+0x4b>
+  801caa:	89 13                	mov    %edx,(%ebx)
+  801cac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801caf:	5b                   	pop    %ebx
+  801cb0:	5e                   	pop    %esi
+  801cb1:	5d                   	pop    %ebp
+  801cb2:	c3                   	ret
+  801cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cbd:	eb e1                	jmp    801ca0 <ipc_recv+0x3f>
+
+00801cbf <ipc_send>:
+  801cbf:	55                   	push   %ebp
+  801cc0:	89 e5                	mov    %esp,%ebp
+  801cc2:	57                   	push   %edi
+  801cc3:	56                   	push   %esi
+  801cc4:	53                   	push   %ebx
+  801cc5:	83 ec 0c             	sub    $0xc,%esp
+  801cc8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ccb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cce:	8b 75 14             	mov    0x14(%ebp),%esi
+  801cd1:	85 db                	test   %ebx,%ebx
+  801cd3:	74 1e                	je     801cf3 <ipc_send+0x34>
+  801cd5:	56                   	push   %esi
+  801cd6:	53                   	push   %ebx
+  801cd7:	57                   	push   %edi
+  801cd8:	ff 75 08             	push   0x8(%ebp)
+  801cdb:	e8 1a f5 ff ff       	call   8011fa <sys_ipc_send>
+  801ce0:	83 c4 10             	add    $0x10,%esp
+  801ce3:	85 c0                	test   %eax,%eax
+  801ce5:	74 2a                	je     801d11 <ipc_send+0x52>
+  801ce7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cea:	75 13                	jne    801cff <ipc_send+0x40>
+  801cec:	e8 86 f1 ff ff       	call   800e77 <sys_yield>
+  801cf1:	eb e2                	jmp    801cd5 <ipc_send+0x16>
+  801cf3:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf8:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801cfd:	eb d6                	jmp    801cd5 <ipc_send+0x16>
+  801cff:	50                   	push   %eax
+  801d00:	68 60 3e 80 00       	push   $0x803e60
+  801d05:	6a 4f                	push   $0x4f
+  801d07:	68 a3 3e 80 00       	push   $0x803ea3
+  801d0c:	e8 7f e5 ff ff       	call   800290 <_panic>
+  801d11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d14:	5b                   	pop    %ebx
+  801d15:	5e                   	pop    %esi
+  801d16:	5f                   	pop    %edi
+  801d17:	5d                   	pop    %ebp
+  801d18:	c3                   	ret
+
+00801d19 <ipc_call>:
+  801d19:	55                   	push   %ebp
+  801d1a:	89 e5                	mov    %esp,%ebp
+  801d1c:	57                   	push   %edi
+  801d1d:	56                   	push   %esi
+  801d1e:	53                   	push   %ebx
+  801d1f:	83 ec 0c             	sub    $0xc,%esp
+  801d22:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801d26:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801d2b:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801d2f:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801d33:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801d38:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801d3c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801d40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d45:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801d49:	eb 05                	jmp    801d50 <ipc_call+0x37>
+  801d4b:	e8 27 f1 ff ff       	call   800e77 <sys_yield>
+  801d50:	83 ec 0c             	sub    $0xc,%esp
+  801d53:	56                   	push   %esi
+  801d54:	53                   	push   %ebx
+  801d55:	57                   	push   %edi
+  801d56:	ff 75 0c             	push   0xc(%ebp)
+  801d59:	ff 75 08             	push   0x8(%ebp)
+  801d5c:	e8 e9 f4 ff ff       	call   80124a <sys_ipc_call>
+  801d61:	83 c4 20             	add    $0x20,%esp
+  801d64:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d67:	74 e2                	je     801d4b <ipc_call+0x32>
+  801d69:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801d6c:	74 2d                	je     801d9b <ipc_call+0x82>
+  801d6e:	85 c0                	test   %eax,%eax
+  801d70:	78 4f                	js     801dc1 <ipc_call+0xa8>
+  801d72:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801d76:	74 10                	je     801d88 <ipc_call+0x6f>
+  801d78:	a1 14 60 80 00       	mov    0x806014,%eax
+  801d7d:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801d83:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801d86:	89 02                	mov    %eax,(%edx)
+  801d88:	a1 14 60 80 00       	mov    0x806014,%eax
+  801d8d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801d93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d96:	5b                   	pop    %ebx
+  801d97:	5e                   	pop    %esi
+  801d98:	5f                   	pop    %edi
+  801d99:	5d                   	pop    %ebp
+  801d9a:	c3                   	ret
+  801d9b:	ff 75 14             	push   0x14(%ebp)
+  801d9e:	ff 75 10             	push   0x10(%ebp)
+  801da1:	ff 75 0c             	push   0xc(%ebp)
+  801da4:	ff 75 08             	push   0x8(%ebp)
+  801da7:	e8 13 ff ff ff       	call   801cbf <ipc_send>
+  801dac:	83 c4 0c             	add    $0xc,%esp
+  801daf:	ff 75 1c             	push   0x1c(%ebp)
+  801db2:	ff 75 18             	push   0x18(%ebp)
+  801db5:	6a 00                	push   $0x0
+  801db7:	e8 a5 fe ff ff       	call   801c61 <ipc_recv>
+  801dbc:	83 c4 10             	add    $0x10,%esp
+  801dbf:	eb d2                	jmp    801d93 <ipc_call+0x7a>
+  801dc1:	50                   	push   %eax
+  801dc2:	68 ad 3e 80 00       	push   $0x803ead
+  801dc7:	6a 6d                	push   $0x6d
+  801dc9:	68 a3 3e 80 00       	push   $0x803ea3
+  801dce:	e8 bd e4 ff ff       	call   800290 <_panic>
+
+00801dd3 <ipc_reply_recv>:
+  801dd3:	55                   	push   %ebp
+  801dd4:	89 e5                	mov    %esp,%ebp
+  801dd6:	57                   	push   %edi
+  801dd7:	56                   	push   %esi
+  801dd8:	53                   	push   %ebx
+  801dd9:	83 ec 0c             	sub    $0xc,%esp
+  801ddc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ddf:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801de2:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801de5:	85 db                	test   %ebx,%ebx
+  801de7:	0f 84 ac 00 00 00    	je     801e99 <ipc_reply_recv+0xc6>
+  801ded:	85 f6                	test   %esi,%esi
+  801def:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801df4:	0f 45 c6             	cmovne %esi,%eax
+  801df7:	83 ec 0c             	sub    $0xc,%esp
+  801dfa:	50                   	push   %eax
+  801dfb:	ff 75 14             	push   0x14(%ebp)
+  801dfe:	53                   	push   %ebx
+  801dff:	ff 75 0c             	push   0xc(%ebp)
+  801e02:	ff 75 08             	push   0x8(%ebp)
+  801e05:	e8 61 f4 ff ff       	call   80126b <sys_ipc_reply_recv>
+  801e0a:	83 c4 20             	add    $0x20,%esp
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	78 3a                	js     801e4b <ipc_reply_recv+0x78>
+  801e11:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801e15:	74 10                	je     801e27 <ipc_reply_recv+0x54>
+  801e17:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e1c:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801e22:	8b 55 18             	mov    0x18(%ebp),%edx
+  801e25:	89 02                	mov    %eax,(%edx)
+  801e27:	85 ff                	test   %edi,%edi
+  801e29:	74 0d                	je     801e38 <ipc_reply_recv+0x65>
+  801e2b:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e30:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801e36:	89 07                	mov    %eax,(%edi)
+  801e38:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e3d:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e46:	5b                   	pop    %ebx
+  801e47:	5e                   	pop    %esi
+  801e48:	5f                   	pop    %edi
+  801e49:	5d                   	pop    %ebp
+  801e4a:	c3                   	ret
+  801e4b:	ff 75 14             	push   0x14(%ebp)
+  801e4e:	53                   	push   %ebx
+  801e4f:	ff 75 0c             	push   0xc(%ebp)
+  801e52:	ff 75 08             	push   0x8(%ebp)
+  801e55:	e8 c3 f2 ff ff       	call   80111d <sys_ipc_try_send>
+  801e5a:	89 c2                	mov    %eax,%edx
+  801e5c:	c1 ea 1f             	shr    $0x1f,%edx
+  801e5f:	83 c4 10             	add    $0x10,%esp
+  801e62:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801e65:	0f 95 c1             	setne  %cl
+  801e68:	84 d1                	test   %dl,%cl
+  801e6a:	74 05                	je     801e71 <ipc_reply_recv+0x9e>
+  801e6c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801e6f:	75 12                	jne    801e83 <ipc_reply_recv+0xb0>
+  801e71:	83 ec 04             	sub    $0x4,%esp
+  801e74:	57                   	push   %edi
+  801e75:	56                   	push   %esi
+  801e76:	ff 75 18             	push   0x18(%ebp)
+  801e79:	e8 e3 fd ff ff       	call   801c61 <ipc_recv>
+  801e7e:	83 c4 10             	add    $0x10,%esp
+  801e81:	eb c0                	jmp    801e43 <ipc_reply_recv+0x70>
+  801e83:	83 ec 04             	sub    $0x4,%esp
+  801e86:	50                   	push   %eax
+  801e87:	ff 75 08             	push   0x8(%ebp)
+  801e8a:	68 80 3e 80 00       	push   $0x803e80
+  801e8f:	e8 d7 e4 ff ff       	call   80036b <cprintf>
+  801e94:	83 c4 10             	add    $0x10,%esp
+  801e97:	eb d8                	jmp    801e71 <ipc_reply_recv+0x9e>
+  801e99:	85 f6                	test   %esi,%esi
+  801e9b:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801ea0:	0f 45 c6             	cmovne %esi,%eax
+  801ea3:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801ea8:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801eaf:	e9 43 ff ff ff       	jmp    801df7 <ipc_reply_recv+0x24>
+
+00801eb4 <ipc_find_env>:
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	83 ec 14             	sub    $0x14,%esp
+  801eba:	ff 75 08             	push   0x8(%ebp)
+  801ebd:	e8 f9 f1 ff ff       	call   8010bb <sys_env_service>
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec9:	0f 48 c2             	cmovs  %edx,%eax
+  801ecc:	c9                   	leave
+  801ecd:	c3                   	ret
+
+00801ece <fd2num>:
+  801ece:	55                   	push   %ebp
+  801ecf:	89 e5                	mov    %esp,%ebp
+  801ed1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed4:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ed9:	c1 e8 0c             	shr    $0xc,%eax
+  801edc:	5d                   	pop    %ebp
+  801edd:	c3                   	ret
+
+00801ede <fd2data>:
+  801ede:	55                   	push   %ebp
+  801edf:	89 e5                	mov    %esp,%ebp
+  801ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee4:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ee9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801eee:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801ef3:	5d                   	pop    %ebp
+  801ef4:	c3                   	ret
+
+00801ef5 <fd_alloc>:
+  801ef5:	55                   	push   %ebp
+  801ef6:	89 e5                	mov    %esp,%ebp
+  801ef8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801efd:	89 c2                	mov    %eax,%edx
+  801eff:	c1 ea 16             	shr    $0x16,%edx
+  801f02:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f09:	f6 c2 01             	test   $0x1,%dl
+  801f0c:	74 29                	je     801f37 <fd_alloc+0x42>
+  801f0e:	89 c2                	mov    %eax,%edx
+  801f10:	c1 ea 0c             	shr    $0xc,%edx
+  801f13:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f1a:	f6 c2 01             	test   $0x1,%dl
+  801f1d:	74 18                	je     801f37 <fd_alloc+0x42>
+  801f1f:	05 00 10 00 00       	add    $0x1000,%eax
+  801f24:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801f29:	75 d2                	jne    801efd <fd_alloc+0x8>
+  801f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f30:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f35:	eb 05                	jmp    801f3c <fd_alloc+0x47>
+  801f37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f3f:	89 02                	mov    %eax,(%edx)
+  801f41:	89 c8                	mov    %ecx,%eax
+  801f43:	5d                   	pop    %ebp
+  801f44:	c3                   	ret
+
+00801f45 <fd_lookup>:
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4b:	83 f8 1f             	cmp    $0x1f,%eax
+  801f4e:	77 30                	ja     801f80 <fd_lookup+0x3b>
+  801f50:	c1 e0 0c             	shl    $0xc,%eax
+  801f53:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801f58:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801f5e:	f6 c2 01             	test   $0x1,%dl
+  801f61:	74 24                	je     801f87 <fd_lookup+0x42>
+  801f63:	89 c2                	mov    %eax,%edx
+  801f65:	c1 ea 0c             	shr    $0xc,%edx
+  801f68:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f6f:	f6 c2 01             	test   $0x1,%dl
+  801f72:	74 1a                	je     801f8e <fd_lookup+0x49>
+  801f74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f77:	89 02                	mov    %eax,(%edx)
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7e:	5d                   	pop    %ebp
+  801f7f:	c3                   	ret
+  801f80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f85:	eb f7                	jmp    801f7e <fd_lookup+0x39>
+  801f87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f8c:	eb f0                	jmp    801f7e <fd_lookup+0x39>
+  801f8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f93:	eb e9                	jmp    801f7e <fd_lookup+0x39>
+
+00801f95 <dev_lookup>:
+  801f95:	55                   	push   %ebp
+  801f96:	89 e5                	mov    %esp,%ebp
+  801f98:	53                   	push   %ebx
+  801f99:	83 ec 04             	sub    $0x4,%esp
+  801f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa4:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801fa9:	39 13                	cmp    %edx,(%ebx)
+  801fab:	74 37                	je     801fe4 <dev_lookup+0x4f>
+  801fad:	83 c0 01             	add    $0x1,%eax
+  801fb0:	8b 1c 85 48 3f 80 00 	mov    0x803f48(,%eax,4),%ebx
+  801fb7:	85 db                	test   %ebx,%ebx
+  801fb9:	75 ee                	jne    801fa9 <dev_lookup+0x14>
+  801fbb:	a1 14 60 80 00       	mov    0x806014,%eax
+  801fc0:	8b 40 48             	mov    0x48(%eax),%eax
+  801fc3:	83 ec 04             	sub    $0x4,%esp
+  801fc6:	52                   	push   %edx
+  801fc7:	50                   	push   %eax
+  801fc8:	68 cc 3e 80 00       	push   $0x803ecc
+  801fcd:	e8 99 e3 ff ff       	call   80036b <cprintf>
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fda:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fdd:	89 1a                	mov    %ebx,(%edx)
+  801fdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe2:	c9                   	leave
+  801fe3:	c3                   	ret
+  801fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe9:	eb ef                	jmp    801fda <dev_lookup+0x45>
+
+00801feb <fd_close>:
+  801feb:	55                   	push   %ebp
+  801fec:	89 e5                	mov    %esp,%ebp
+  801fee:	57                   	push   %edi
+  801fef:	56                   	push   %esi
+  801ff0:	53                   	push   %ebx
+  801ff1:	83 ec 24             	sub    $0x24,%esp
+  801ff4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ff7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ffa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ffd:	50                   	push   %eax
+  801ffe:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802004:	c1 e8 0c             	shr    $0xc,%eax
+  802007:	50                   	push   %eax
+  802008:	e8 38 ff ff ff       	call   801f45 <fd_lookup>
+  80200d:	89 c3                	mov    %eax,%ebx
+  80200f:	83 c4 10             	add    $0x10,%esp
+  802012:	85 c0                	test   %eax,%eax
+  802014:	78 05                	js     80201b <fd_close+0x30>
+  802016:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802019:	74 0f                	je     80202a <fd_close+0x3f>
+  80201b:	85 ff                	test   %edi,%edi
+  80201d:	0f 44 df             	cmove  %edi,%ebx
+  802020:	89 d8                	mov    %ebx,%eax
+  802022:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802025:	5b                   	pop    %ebx
+  802026:	5e                   	pop    %esi
+  802027:	5f                   	pop    %edi
+  802028:	5d                   	pop    %ebp
+  802029:	c3                   	ret
+  80202a:	83 ec 08             	sub    $0x8,%esp
+  80202d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802030:	50                   	push   %eax
+  802031:	ff 36                	push   (%esi)
+  802033:	e8 5d ff ff ff       	call   801f95 <dev_lookup>
+  802038:	89 c3                	mov    %eax,%ebx
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 1a                	js     80205b <fd_close+0x70>
+  802041:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802044:	8b 40 10             	mov    0x10(%eax),%eax
+  802047:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	74 0b                	je     80205b <fd_close+0x70>
+  802050:	83 ec 0c             	sub    $0xc,%esp
+  802053:	56                   	push   %esi
+  802054:	ff d0                	call   *%eax
+  802056:	89 c3                	mov    %eax,%ebx
+  802058:	83 c4 10             	add    $0x10,%esp
+  80205b:	83 ec 08             	sub    $0x8,%esp
+  80205e:	56                   	push   %esi
+  80205f:	6a 00                	push   $0x0
+  802061:	e8 2e ef ff ff       	call   800f94 <sys_page_unmap>
+  802066:	83 c4 10             	add    $0x10,%esp
+  802069:	eb b5                	jmp    802020 <fd_close+0x35>
+
+0080206b <close>:
+  80206b:	55                   	push   %ebp
+  80206c:	89 e5                	mov    %esp,%ebp
+  80206e:	83 ec 20             	sub    $0x20,%esp
+  802071:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802074:	50                   	push   %eax
+  802075:	ff 75 08             	push   0x8(%ebp)
+  802078:	e8 c8 fe ff ff       	call   801f45 <fd_lookup>
+  80207d:	83 c4 10             	add    $0x10,%esp
+  802080:	85 c0                	test   %eax,%eax
+  802082:	79 02                	jns    802086 <close+0x1b>
+  802084:	c9                   	leave
+  802085:	c3                   	ret
+  802086:	83 ec 08             	sub    $0x8,%esp
+  802089:	6a 01                	push   $0x1
+  80208b:	ff 75 f4             	push   -0xc(%ebp)
+  80208e:	e8 58 ff ff ff       	call   801feb <fd_close>
+  802093:	83 c4 10             	add    $0x10,%esp
+  802096:	eb ec                	jmp    802084 <close+0x19>
+
+00802098 <close_all>:
+  802098:	55                   	push   %ebp
+  802099:	89 e5                	mov    %esp,%ebp
+  80209b:	53                   	push   %ebx
+  80209c:	83 ec 04             	sub    $0x4,%esp
+  80209f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020a4:	83 ec 0c             	sub    $0xc,%esp
+  8020a7:	53                   	push   %ebx
+  8020a8:	e8 be ff ff ff       	call   80206b <close>
+  8020ad:	83 c3 01             	add    $0x1,%ebx
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	83 fb 20             	cmp    $0x20,%ebx
+  8020b6:	75 ec                	jne    8020a4 <close_all+0xc>
+  8020b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020bb:	c9                   	leave
+  8020bc:	c3                   	ret
+
+008020bd <dup>:
+  8020bd:	55                   	push   %ebp
+  8020be:	89 e5                	mov    %esp,%ebp
+  8020c0:	57                   	push   %edi
+  8020c1:	56                   	push   %esi
+  8020c2:	53                   	push   %ebx
+  8020c3:	83 ec 34             	sub    $0x34,%esp
+  8020c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020c9:	50                   	push   %eax
+  8020ca:	ff 75 08             	push   0x8(%ebp)
+  8020cd:	e8 73 fe ff ff       	call   801f45 <fd_lookup>
+  8020d2:	89 c3                	mov    %eax,%ebx
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	78 7f                	js     80215a <dup+0x9d>
+  8020db:	83 ec 0c             	sub    $0xc,%esp
+  8020de:	ff 75 0c             	push   0xc(%ebp)
+  8020e1:	e8 85 ff ff ff       	call   80206b <close>
+  8020e6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020e9:	c1 e6 0c             	shl    $0xc,%esi
+  8020ec:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  8020f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8020f5:	89 3c 24             	mov    %edi,(%esp)
+  8020f8:	e8 e1 fd ff ff       	call   801ede <fd2data>
+  8020fd:	89 c3                	mov    %eax,%ebx
+  8020ff:	89 34 24             	mov    %esi,(%esp)
+  802102:	e8 d7 fd ff ff       	call   801ede <fd2data>
+  802107:	83 c4 10             	add    $0x10,%esp
+  80210a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80210d:	89 d8                	mov    %ebx,%eax
+  80210f:	c1 e8 16             	shr    $0x16,%eax
+  802112:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802119:	a8 01                	test   $0x1,%al
+  80211b:	74 11                	je     80212e <dup+0x71>
+  80211d:	89 d8                	mov    %ebx,%eax
+  80211f:	c1 e8 0c             	shr    $0xc,%eax
+  802122:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802129:	f6 c2 01             	test   $0x1,%dl
+  80212c:	75 36                	jne    802164 <dup+0xa7>
+  80212e:	89 f8                	mov    %edi,%eax
+  802130:	c1 e8 0c             	shr    $0xc,%eax
+  802133:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80213a:	83 ec 0c             	sub    $0xc,%esp
+  80213d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802142:	50                   	push   %eax
+  802143:	56                   	push   %esi
+  802144:	6a 00                	push   $0x0
+  802146:	57                   	push   %edi
+  802147:	6a 00                	push   $0x0
+  802149:	e8 b7 ed ff ff       	call   800f05 <sys_page_map>
+  80214e:	89 c3                	mov    %eax,%ebx
+  802150:	83 c4 20             	add    $0x20,%esp
+  802153:	85 c0                	test   %eax,%eax
+  802155:	78 33                	js     80218a <dup+0xcd>
+  802157:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80215a:	89 d8                	mov    %ebx,%eax
+  80215c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215f:	5b                   	pop    %ebx
+  802160:	5e                   	pop    %esi
+  802161:	5f                   	pop    %edi
+  802162:	5d                   	pop    %ebp
+  802163:	c3                   	ret
+  802164:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80216b:	83 ec 0c             	sub    $0xc,%esp
+  80216e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802173:	50                   	push   %eax
+  802174:	ff 75 d4             	push   -0x2c(%ebp)
+  802177:	6a 00                	push   $0x0
+  802179:	53                   	push   %ebx
+  80217a:	6a 00                	push   $0x0
+  80217c:	e8 84 ed ff ff       	call   800f05 <sys_page_map>
+  802181:	89 c3                	mov    %eax,%ebx
+  802183:	83 c4 20             	add    $0x20,%esp
+  802186:	85 c0                	test   %eax,%eax
+  802188:	79 a4                	jns    80212e <dup+0x71>
+  80218a:	83 ec 08             	sub    $0x8,%esp
+  80218d:	56                   	push   %esi
+  80218e:	6a 00                	push   $0x0
+  802190:	e8 ff ed ff ff       	call   800f94 <sys_page_unmap>
+  802195:	83 c4 08             	add    $0x8,%esp
+  802198:	ff 75 d4             	push   -0x2c(%ebp)
+  80219b:	6a 00                	push   $0x0
+  80219d:	e8 f2 ed ff ff       	call   800f94 <sys_page_unmap>
+  8021a2:	83 c4 10             	add    $0x10,%esp
+  8021a5:	eb b3                	jmp    80215a <dup+0x9d>
+
+008021a7 <read>:
+  8021a7:	55                   	push   %ebp
+  8021a8:	89 e5                	mov    %esp,%ebp
+  8021aa:	56                   	push   %esi
+  8021ab:	53                   	push   %ebx
+  8021ac:	83 ec 18             	sub    $0x18,%esp
+  8021af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021b5:	50                   	push   %eax
+  8021b6:	56                   	push   %esi
+  8021b7:	e8 89 fd ff ff       	call   801f45 <fd_lookup>
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	78 3c                	js     8021ff <read+0x58>
+  8021c3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8021c6:	83 ec 08             	sub    $0x8,%esp
+  8021c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021cc:	50                   	push   %eax
+  8021cd:	ff 33                	push   (%ebx)
+  8021cf:	e8 c1 fd ff ff       	call   801f95 <dev_lookup>
+  8021d4:	83 c4 10             	add    $0x10,%esp
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 24                	js     8021ff <read+0x58>
+  8021db:	8b 43 08             	mov    0x8(%ebx),%eax
+  8021de:	83 e0 03             	and    $0x3,%eax
+  8021e1:	83 f8 01             	cmp    $0x1,%eax
+  8021e4:	74 20                	je     802206 <read+0x5f>
+  8021e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e9:	8b 40 08             	mov    0x8(%eax),%eax
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	74 37                	je     802227 <read+0x80>
+  8021f0:	83 ec 04             	sub    $0x4,%esp
+  8021f3:	ff 75 10             	push   0x10(%ebp)
+  8021f6:	ff 75 0c             	push   0xc(%ebp)
+  8021f9:	53                   	push   %ebx
+  8021fa:	ff d0                	call   *%eax
+  8021fc:	83 c4 10             	add    $0x10,%esp
+  8021ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802202:	5b                   	pop    %ebx
+  802203:	5e                   	pop    %esi
+  802204:	5d                   	pop    %ebp
+  802205:	c3                   	ret
+  802206:	a1 14 60 80 00       	mov    0x806014,%eax
+  80220b:	8b 40 48             	mov    0x48(%eax),%eax
+  80220e:	83 ec 04             	sub    $0x4,%esp
+  802211:	56                   	push   %esi
+  802212:	50                   	push   %eax
+  802213:	68 0d 3f 80 00       	push   $0x803f0d
+  802218:	e8 4e e1 ff ff       	call   80036b <cprintf>
+  80221d:	83 c4 10             	add    $0x10,%esp
+  802220:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802225:	eb d8                	jmp    8021ff <read+0x58>
+  802227:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80222c:	eb d1                	jmp    8021ff <read+0x58>
+
+0080222e <readn>:
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	57                   	push   %edi
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+  802234:	83 ec 0c             	sub    $0xc,%esp
+  802237:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80223a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80223d:	85 f6                	test   %esi,%esi
+  80223f:	74 30                	je     802271 <readn+0x43>
+  802241:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224b:	83 ec 04             	sub    $0x4,%esp
+  80224e:	89 f2                	mov    %esi,%edx
+  802250:	29 c2                	sub    %eax,%edx
+  802252:	52                   	push   %edx
+  802253:	01 f8                	add    %edi,%eax
+  802255:	50                   	push   %eax
+  802256:	ff 75 08             	push   0x8(%ebp)
+  802259:	e8 49 ff ff ff       	call   8021a7 <read>
+  80225e:	83 c4 10             	add    $0x10,%esp
+  802261:	85 c0                	test   %eax,%eax
+  802263:	78 15                	js     80227a <readn+0x4c>
+  802265:	74 11                	je     802278 <readn+0x4a>
+  802267:	01 c3                	add    %eax,%ebx
+  802269:	89 d8                	mov    %ebx,%eax
+  80226b:	39 f3                	cmp    %esi,%ebx
+  80226d:	72 dc                	jb     80224b <readn+0x1d>
+  80226f:	eb 09                	jmp    80227a <readn+0x4c>
+  802271:	b8 00 00 00 00       	mov    $0x0,%eax
+  802276:	eb 02                	jmp    80227a <readn+0x4c>
+  802278:	89 d8                	mov    %ebx,%eax
+  80227a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80227d:	5b                   	pop    %ebx
+  80227e:	5e                   	pop    %esi
+  80227f:	5f                   	pop    %edi
+  802280:	5d                   	pop    %ebp
+  802281:	c3                   	ret
+
+00802282 <write>:
+  802282:	55                   	push   %ebp
+  802283:	89 e5                	mov    %esp,%ebp
+  802285:	56                   	push   %esi
+  802286:	53                   	push   %ebx
+  802287:	83 ec 18             	sub    $0x18,%esp
+  80228a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80228d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802290:	50                   	push   %eax
+  802291:	53                   	push   %ebx
+  802292:	e8 ae fc ff ff       	call   801f45 <fd_lookup>
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 37                	js     8022d5 <write+0x53>
+  80229e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022a1:	83 ec 08             	sub    $0x8,%esp
+  8022a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a7:	50                   	push   %eax
+  8022a8:	ff 36                	push   (%esi)
+  8022aa:	e8 e6 fc ff ff       	call   801f95 <dev_lookup>
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 1f                	js     8022d5 <write+0x53>
+  8022b6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8022ba:	74 20                	je     8022dc <write+0x5a>
+  8022bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	74 37                	je     8022fd <write+0x7b>
+  8022c6:	83 ec 04             	sub    $0x4,%esp
+  8022c9:	ff 75 10             	push   0x10(%ebp)
+  8022cc:	ff 75 0c             	push   0xc(%ebp)
+  8022cf:	56                   	push   %esi
+  8022d0:	ff d0                	call   *%eax
+  8022d2:	83 c4 10             	add    $0x10,%esp
+  8022d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d8:	5b                   	pop    %ebx
+  8022d9:	5e                   	pop    %esi
+  8022da:	5d                   	pop    %ebp
+  8022db:	c3                   	ret
+  8022dc:	a1 14 60 80 00       	mov    0x806014,%eax
+  8022e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8022e4:	83 ec 04             	sub    $0x4,%esp
+  8022e7:	53                   	push   %ebx
+  8022e8:	50                   	push   %eax
+  8022e9:	68 29 3f 80 00       	push   $0x803f29
+  8022ee:	e8 78 e0 ff ff       	call   80036b <cprintf>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fb:	eb d8                	jmp    8022d5 <write+0x53>
+  8022fd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802302:	eb d1                	jmp    8022d5 <write+0x53>
+
+00802304 <seek>:
+  802304:	55                   	push   %ebp
+  802305:	89 e5                	mov    %esp,%ebp
+  802307:	83 ec 20             	sub    $0x20,%esp
+  80230a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230d:	50                   	push   %eax
+  80230e:	ff 75 08             	push   0x8(%ebp)
+  802311:	e8 2f fc ff ff       	call   801f45 <fd_lookup>
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	78 0e                	js     80232b <seek+0x27>
+  80231d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802320:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802323:	89 50 04             	mov    %edx,0x4(%eax)
+  802326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232b:	c9                   	leave
+  80232c:	c3                   	ret
+
+0080232d <ftruncate>:
+  80232d:	55                   	push   %ebp
+  80232e:	89 e5                	mov    %esp,%ebp
+  802330:	56                   	push   %esi
+  802331:	53                   	push   %ebx
+  802332:	83 ec 18             	sub    $0x18,%esp
+  802335:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802338:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80233b:	50                   	push   %eax
+  80233c:	53                   	push   %ebx
+  80233d:	e8 03 fc ff ff       	call   801f45 <fd_lookup>
+  802342:	83 c4 10             	add    $0x10,%esp
+  802345:	85 c0                	test   %eax,%eax
+  802347:	78 34                	js     80237d <ftruncate+0x50>
+  802349:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80234c:	83 ec 08             	sub    $0x8,%esp
+  80234f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802352:	50                   	push   %eax
+  802353:	ff 36                	push   (%esi)
+  802355:	e8 3b fc ff ff       	call   801f95 <dev_lookup>
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	78 1c                	js     80237d <ftruncate+0x50>
+  802361:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802365:	74 1d                	je     802384 <ftruncate+0x57>
+  802367:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236a:	8b 40 18             	mov    0x18(%eax),%eax
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	74 34                	je     8023a5 <ftruncate+0x78>
+  802371:	83 ec 08             	sub    $0x8,%esp
+  802374:	ff 75 0c             	push   0xc(%ebp)
+  802377:	56                   	push   %esi
+  802378:	ff d0                	call   *%eax
+  80237a:	83 c4 10             	add    $0x10,%esp
+  80237d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802380:	5b                   	pop    %ebx
+  802381:	5e                   	pop    %esi
+  802382:	5d                   	pop    %ebp
+  802383:	c3                   	ret
+  802384:	a1 14 60 80 00       	mov    0x806014,%eax
+  802389:	8b 40 48             	mov    0x48(%eax),%eax
+  80238c:	83 ec 04             	sub    $0x4,%esp
+  80238f:	53                   	push   %ebx
+  802390:	50                   	push   %eax
+  802391:	68 ec 3e 80 00       	push   $0x803eec
+  802396:	e8 d0 df ff ff       	call   80036b <cprintf>
+  80239b:	83 c4 10             	add    $0x10,%esp
+  80239e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023a3:	eb d8                	jmp    80237d <ftruncate+0x50>
+  8023a5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023aa:	eb d1                	jmp    80237d <ftruncate+0x50>
+
+008023ac <fstat>:
+  8023ac:	55                   	push   %ebp
+  8023ad:	89 e5                	mov    %esp,%ebp
+  8023af:	56                   	push   %esi
+  8023b0:	53                   	push   %ebx
+  8023b1:	83 ec 18             	sub    $0x18,%esp
+  8023b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023ba:	50                   	push   %eax
+  8023bb:	ff 75 08             	push   0x8(%ebp)
+  8023be:	e8 82 fb ff ff       	call   801f45 <fd_lookup>
+  8023c3:	83 c4 10             	add    $0x10,%esp
+  8023c6:	85 c0                	test   %eax,%eax
+  8023c8:	78 49                	js     802413 <fstat+0x67>
+  8023ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023cd:	83 ec 08             	sub    $0x8,%esp
+  8023d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d3:	50                   	push   %eax
+  8023d4:	ff 36                	push   (%esi)
+  8023d6:	e8 ba fb ff ff       	call   801f95 <dev_lookup>
+  8023db:	83 c4 10             	add    $0x10,%esp
+  8023de:	85 c0                	test   %eax,%eax
+  8023e0:	78 31                	js     802413 <fstat+0x67>
+  8023e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8023e9:	74 2f                	je     80241a <fstat+0x6e>
+  8023eb:	c6 03 00             	movb   $0x0,(%ebx)
+  8023ee:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8023f5:	00 00 00 
+  8023f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023ff:	00 00 00 
+  802402:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802408:	83 ec 08             	sub    $0x8,%esp
+  80240b:	53                   	push   %ebx
+  80240c:	56                   	push   %esi
+  80240d:	ff 50 14             	call   *0x14(%eax)
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802416:	5b                   	pop    %ebx
+  802417:	5e                   	pop    %esi
+  802418:	5d                   	pop    %ebp
+  802419:	c3                   	ret
+  80241a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80241f:	eb f2                	jmp    802413 <fstat+0x67>
+
+00802421 <stat>:
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	56                   	push   %esi
+  802425:	53                   	push   %ebx
+  802426:	83 ec 08             	sub    $0x8,%esp
+  802429:	6a 00                	push   $0x0
+  80242b:	ff 75 08             	push   0x8(%ebp)
+  80242e:	e8 31 05 00 00       	call   802964 <open>
+  802433:	89 c3                	mov    %eax,%ebx
+  802435:	83 c4 10             	add    $0x10,%esp
+  802438:	85 c0                	test   %eax,%eax
+  80243a:	78 1b                	js     802457 <stat+0x36>
+  80243c:	83 ec 08             	sub    $0x8,%esp
+  80243f:	ff 75 0c             	push   0xc(%ebp)
+  802442:	50                   	push   %eax
+  802443:	e8 64 ff ff ff       	call   8023ac <fstat>
+  802448:	89 c6                	mov    %eax,%esi
+  80244a:	89 1c 24             	mov    %ebx,(%esp)
+  80244d:	e8 19 fc ff ff       	call   80206b <close>
+  802452:	83 c4 10             	add    $0x10,%esp
+  802455:	89 f3                	mov    %esi,%ebx
+  802457:	89 d8                	mov    %ebx,%eax
+  802459:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80245c:	5b                   	pop    %ebx
+  80245d:	5e                   	pop    %esi
+  80245e:	5d                   	pop    %ebp
+  80245f:	c3                   	ret
+
+00802460 <fsipc>:
+  802460:	55                   	push   %ebp
+  802461:	89 e5                	mov    %esp,%ebp
+  802463:	56                   	push   %esi
+  802464:	53                   	push   %ebx
+  802465:	89 c3                	mov    %eax,%ebx
+  802467:	89 d6                	mov    %edx,%esi
+  802469:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802470:	74 20                	je     802492 <fsipc+0x32>
+  802472:	83 ec 08             	sub    $0x8,%esp
+  802475:	6a 00                	push   $0x0
+  802477:	56                   	push   %esi
+  802478:	6a 07                	push   $0x7
+  80247a:	68 00 70 80 00       	push   $0x807000
+  80247f:	53                   	push   %ebx
+  802480:	ff 35 0c 60 80 00    	push   0x80600c
+  802486:	e8 8e f8 ff ff       	call   801d19 <ipc_call>
+  80248b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80248e:	5b                   	pop    %ebx
+  80248f:	5e                   	pop    %esi
+  802490:	5d                   	pop    %ebp
+  802491:	c3                   	ret
+  802492:	83 ec 0c             	sub    $0xc,%esp
+  802495:	6a 02                	push   $0x2
+  802497:	e8 18 fa ff ff       	call   801eb4 <ipc_find_env>
+  80249c:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	eb cc                	jmp    802472 <fsipc+0x12>
+
+008024a6 <devfile_trunc>:
+  8024a6:	55                   	push   %ebp
+  8024a7:	89 e5                	mov    %esp,%ebp
+  8024a9:	83 ec 08             	sub    $0x8,%esp
+  8024ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024af:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024b2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ba:	a3 04 70 80 00       	mov    %eax,0x807004
+  8024bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024c9:	e8 92 ff ff ff       	call   802460 <fsipc>
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+
+008024d0 <devfile_flush>:
+  8024d0:	55                   	push   %ebp
+  8024d1:	89 e5                	mov    %esp,%ebp
+  8024d3:	83 ec 08             	sub    $0x8,%esp
+  8024d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024dc:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024eb:	e8 70 ff ff ff       	call   802460 <fsipc>
+  8024f0:	c9                   	leave
+  8024f1:	c3                   	ret
+
+008024f2 <devfile_stat>:
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	53                   	push   %ebx
+  8024f6:	83 ec 04             	sub    $0x4,%esp
+  8024f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8024fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  802502:	a3 00 70 80 00       	mov    %eax,0x807000
+  802507:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802511:	e8 4a ff ff ff       	call   802460 <fsipc>
+  802516:	85 c0                	test   %eax,%eax
+  802518:	78 2c                	js     802546 <devfile_stat+0x54>
+  80251a:	83 ec 08             	sub    $0x8,%esp
+  80251d:	68 00 70 80 00       	push   $0x807000
+  802522:	53                   	push   %ebx
+  802523:	e8 3a e5 ff ff       	call   800a62 <strcpy>
+  802528:	a1 80 70 80 00       	mov    0x807080,%eax
+  80252d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802533:	a1 84 70 80 00       	mov    0x807084,%eax
+  802538:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80253e:	83 c4 10             	add    $0x10,%esp
+  802541:	b8 00 00 00 00       	mov    $0x0,%eax
+  802546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802549:	c9                   	leave
+  80254a:	c3                   	ret
+
+0080254b <fsring_rw>:
+  80254b:	55                   	push   %ebp
+  80254c:	89 e5                	mov    %esp,%ebp
+  80254e:	57                   	push   %edi
+  80254f:	56                   	push   %esi
+  802550:	53                   	push   %ebx
+  802551:	83 ec 2c             	sub    $0x2c,%esp
+  802554:	89 c7                	mov    %eax,%edi
+  802556:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802559:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80255c:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802561:	a8 01                	test   $0x1,%al
+  802563:	74 0d                	je     802572 <fsring_rw+0x27>
+  802565:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  80256a:	a8 01                	test   $0x1,%al
+  80256c:	0f 85 d5 00 00 00    	jne    802647 <fsring_rw+0xfc>
+  802572:	a1 14 60 80 00       	mov    0x806014,%eax
+  802577:	8b 40 48             	mov    0x48(%eax),%eax
+  80257a:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  802580:	0f 84 fc 00 00 00    	je     802682 <fsring_rw+0x137>
+  802586:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  80258d:	0f 84 02 01 00 00    	je     802695 <fsring_rw+0x14a>
+  802593:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802598:	83 ec 04             	sub    $0x4,%esp
+  80259b:	68 07 02 00 00       	push   $0x207
+  8025a0:	53                   	push   %ebx
+  8025a1:	6a 00                	push   $0x0
+  8025a3:	e8 1a e9 ff ff       	call   800ec2 <sys_page_alloc>
+  8025a8:	83 c4 10             	add    $0x10,%esp
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	0f 88 f9 00 00 00    	js     8026ac <fsring_rw+0x161>
+  8025b3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025b9:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8025bf:	75 d7                	jne    802598 <fsring_rw+0x4d>
+  8025c1:	6a 0e                	push   $0xe
+  8025c3:	6a 0d                	push   $0xd
+  8025c5:	ff 35 0c 60 80 00    	push   0x80600c
+  8025cb:	68 00 00 f0 cf       	push   $0xcff00000
+  8025d0:	e8 06 0d 00 00       	call   8032db <ipcring_init>
+  8025d5:	83 c4 08             	add    $0x8,%esp
+  8025d8:	6a 00                	push   $0x0
+  8025da:	6a 00                	push   $0x0
+  8025dc:	68 07 02 00 00       	push   $0x207
+  8025e1:	68 00 00 f0 cf       	push   $0xcff00000
+  8025e6:	6a 0b                	push   $0xb
+  8025e8:	ff 35 0c 60 80 00    	push   0x80600c
+  8025ee:	e8 26 f7 ff ff       	call   801d19 <ipc_call>
+  8025f3:	89 c6                	mov    %eax,%esi
+  8025f5:	83 c4 20             	add    $0x20,%esp
+  8025f8:	85 c0                	test   %eax,%eax
+  8025fa:	0f 88 ac 00 00 00    	js     8026ac <fsring_rw+0x161>
+  802600:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802605:	89 d9                	mov    %ebx,%ecx
+  802607:	83 c3 01             	add    $0x1,%ebx
+  80260a:	89 da                	mov    %ebx,%edx
+  80260c:	c1 e2 0c             	shl    $0xc,%edx
+  80260f:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802615:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80261b:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802621:	83 ec 08             	sub    $0x8,%esp
+  802624:	6a 00                	push   $0x0
+  802626:	6a 00                	push   $0x0
+  802628:	68 07 02 00 00       	push   $0x207
+  80262d:	50                   	push   %eax
+  80262e:	6a 0c                	push   $0xc
+  802630:	ff 35 0c 60 80 00    	push   0x80600c
+  802636:	e8 de f6 ff ff       	call   801d19 <ipc_call>
+  80263b:	83 c4 20             	add    $0x20,%esp
+  80263e:	85 c0                	test   %eax,%eax
+  802640:	78 6a                	js     8026ac <fsring_rw+0x161>
+  802642:	83 fb 08             	cmp    $0x8,%ebx
+  802645:	75 be                	jne    802605 <fsring_rw+0xba>
+  802647:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80264b:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802650:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802655:	0f 45 c2             	cmovne %edx,%eax
+  802658:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80265b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802662:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802669:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802670:	ba 00 00 00 00       	mov    $0x0,%edx
+  802675:	be 00 00 00 00       	mov    $0x0,%esi
+  80267a:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80267d:	e9 4b 01 00 00       	jmp    8027cd <fsring_rw+0x282>
+  802682:	e8 05 ec ff ff       	call   80128c <sys_time_msec>
+  802687:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  80268d:	0f 89 f3 fe ff ff    	jns    802586 <fsring_rw+0x3b>
+  802693:	eb 54                	jmp    8026e9 <fsring_rw+0x19e>
+  802695:	83 ec 0c             	sub    $0xc,%esp
+  802698:	6a 02                	push   $0x2
+  80269a:	e8 15 f8 ff ff       	call   801eb4 <ipc_find_env>
+  80269f:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8026a4:	83 c4 10             	add    $0x10,%esp
+  8026a7:	e9 e7 fe ff ff       	jmp    802593 <fsring_rw+0x48>
+  8026ac:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8026b1:	83 ec 08             	sub    $0x8,%esp
+  8026b4:	53                   	push   %ebx
+  8026b5:	6a 00                	push   $0x0
+  8026b7:	e8 d8 e8 ff ff       	call   800f94 <sys_page_unmap>
+  8026bc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8026cb:	75 e4                	jne    8026b1 <fsring_rw+0x166>
+  8026cd:	e8 ba eb ff ff       	call   80128c <sys_time_msec>
+  8026d2:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8026d7:	a3 04 60 80 00       	mov    %eax,0x806004
+  8026dc:	a1 14 60 80 00       	mov    0x806014,%eax
+  8026e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8026e4:	a3 08 60 80 00       	mov    %eax,0x806008
+  8026e9:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8026f0:	e9 7a 01 00 00       	jmp    80286f <fsring_rw+0x324>
+  8026f5:	8b 57 0c             	mov    0xc(%edi),%edx
+  8026f8:	89 10                	mov    %edx,(%eax)
+  8026fa:	89 58 04             	mov    %ebx,0x4(%eax)
+  8026fd:	89 f2                	mov    %esi,%edx
+  8026ff:	03 57 04             	add    0x4(%edi),%edx
+  802702:	89 50 08             	mov    %edx,0x8(%eax)
+  802705:	83 ec 04             	sub    $0x4,%esp
+  802708:	53                   	push   %ebx
+  802709:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80270c:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80270f:	52                   	push   %edx
+  802710:	83 c0 0c             	add    $0xc,%eax
+  802713:	50                   	push   %eax
+  802714:	e8 f9 e4 ff ff       	call   800c12 <memmove>
+  802719:	83 c4 10             	add    $0x10,%esp
+  80271c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80271f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802722:	89 08                	mov    %ecx,(%eax)
+  802724:	83 ec 0c             	sub    $0xc,%esp
+  802727:	68 00 00 f0 cf       	push   $0xcff00000
+  80272c:	e8 08 0c 00 00       	call   803339 <ipcring_req_push>
+  802731:	01 de                	add    %ebx,%esi
+  802733:	83 c4 10             	add    $0x10,%esp
+  802736:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802739:	73 4c                	jae    802787 <fsring_rw+0x23c>
+  80273b:	83 ec 0c             	sub    $0xc,%esp
+  80273e:	68 00 00 f0 cf       	push   $0xcff00000
+  802743:	e8 cb 0b 00 00       	call   803313 <ipcring_req_slot>
+  802748:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80274b:	83 c4 10             	add    $0x10,%esp
+  80274e:	85 c0                	test   %eax,%eax
+  802750:	74 35                	je     802787 <fsring_rw+0x23c>
+  802752:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802757:	83 e0 07             	and    $0x7,%eax
+  80275a:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80275f:	c1 e0 0c             	shl    $0xc,%eax
+  802762:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802765:	29 f3                	sub    %esi,%ebx
+  802767:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80276a:	39 cb                	cmp    %ecx,%ebx
+  80276c:	0f 47 d9             	cmova  %ecx,%ebx
+  80276f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802773:	75 80                	jne    8026f5 <fsring_rw+0x1aa>
+  802775:	8b 57 0c             	mov    0xc(%edi),%edx
+  802778:	89 10                	mov    %edx,(%eax)
+  80277a:	89 58 04             	mov    %ebx,0x4(%eax)
+  80277d:	89 f2                	mov    %esi,%edx
+  80277f:	03 57 04             	add    0x4(%edi),%edx
+  802782:	89 50 08             	mov    %edx,0x8(%eax)
+  802785:	eb 95                	jmp    80271c <fsring_rw+0x1d1>
+  802787:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80278c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80278f:	83 ec 0c             	sub    $0xc,%esp
+  802792:	68 00 00 f0 cf       	push   $0xcff00000
+  802797:	e8 d6 0b 00 00       	call   803372 <ipcring_rsp_wait>
+  80279c:	8b 58 04             	mov    0x4(%eax),%ebx
+  80279f:	83 c4 10             	add    $0x10,%esp
+  8027a2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8027a6:	75 45                	jne    8027ed <fsring_rw+0x2a2>
+  8027a8:	85 db                	test   %ebx,%ebx
+  8027aa:	79 41                	jns    8027ed <fsring_rw+0x2a2>
+  8027ac:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8027af:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8027b6:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8027bd:	83 ec 0c             	sub    $0xc,%esp
+  8027c0:	68 00 00 f0 cf       	push   $0xcff00000
+  8027c5:	e8 0e 0c 00 00       	call   8033d8 <ipcring_rsp_pop>
+  8027ca:	83 c4 10             	add    $0x10,%esp
+  8027cd:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8027d3:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8027d8:	39 c2                	cmp    %eax,%edx
+  8027da:	74 75                	je     802851 <fsring_rw+0x306>
+  8027dc:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8027e0:	75 a5                	jne    802787 <fsring_rw+0x23c>
+  8027e2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8027e5:	0f 82 50 ff ff ff    	jb     80273b <fsring_rw+0x1f0>
+  8027eb:	eb 9a                	jmp    802787 <fsring_rw+0x23c>
+  8027ed:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8027f1:	75 ca                	jne    8027bd <fsring_rw+0x272>
+  8027f3:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8027f7:	74 31                	je     80282a <fsring_rw+0x2df>
+  8027f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027fc:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8027ff:	29 c8                	sub    %ecx,%eax
+  802801:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802804:	39 d0                	cmp    %edx,%eax
+  802806:	0f 47 c2             	cmova  %edx,%eax
+  802809:	39 d8                	cmp    %ebx,%eax
+  80280b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802810:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802814:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802817:	b8 01 00 00 00       	mov    $0x1,%eax
+  80281c:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802820:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802823:	01 d9                	add    %ebx,%ecx
+  802825:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802828:	eb 93                	jmp    8027bd <fsring_rw+0x272>
+  80282a:	83 ec 04             	sub    $0x4,%esp
+  80282d:	53                   	push   %ebx
+  80282e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802831:	83 e0 07             	and    $0x7,%eax
+  802834:	c1 e0 0c             	shl    $0xc,%eax
+  802837:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80283d:	50                   	push   %eax
+  80283e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802841:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802844:	01 c8                	add    %ecx,%eax
+  802846:	50                   	push   %eax
+  802847:	e8 c6 e3 ff ff       	call   800c12 <memmove>
+  80284c:	83 c4 10             	add    $0x10,%esp
+  80284f:	eb a8                	jmp    8027f9 <fsring_rw+0x2ae>
+  802851:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802855:	75 09                	jne    802860 <fsring_rw+0x315>
+  802857:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80285a:	0f 82 db fe ff ff    	jb     80273b <fsring_rw+0x1f0>
+  802860:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802863:	01 57 04             	add    %edx,0x4(%edi)
+  802866:	85 d2                	test   %edx,%edx
+  802868:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80286c:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80286f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802872:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802875:	5b                   	pop    %ebx
+  802876:	5e                   	pop    %esi
+  802877:	5f                   	pop    %edi
+  802878:	5d                   	pop    %ebp
+  802879:	c3                   	ret
+
+0080287a <devfile_write>:
+  80287a:	55                   	push   %ebp
+  80287b:	89 e5                	mov    %esp,%ebp
+  80287d:	57                   	push   %edi
+  80287e:	56                   	push   %esi
+  80287f:	53                   	push   %ebx
+  802880:	83 ec 0c             	sub    $0xc,%esp
+  802883:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802886:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802889:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80288c:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802892:	76 1a                	jbe    8028ae <devfile_write+0x34>
+  802894:	83 ec 0c             	sub    $0xc,%esp
+  802897:	53                   	push   %ebx
+  802898:	89 f1                	mov    %esi,%ecx
+  80289a:	ba 06 00 00 00       	mov    $0x6,%edx
+  80289f:	89 f8                	mov    %edi,%eax
+  8028a1:	e8 a5 fc ff ff       	call   80254b <fsring_rw>
+  8028a6:	83 c4 10             	add    $0x10,%esp
+  8028a9:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8028ac:	75 39                	jne    8028e7 <devfile_write+0x6d>
+  8028ae:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8028b3:	39 c3                	cmp    %eax,%ebx
+  8028b5:	0f 47 d8             	cmova  %eax,%ebx
+  8028b8:	8b 47 0c             	mov    0xc(%edi),%eax
+  8028bb:	a3 00 70 80 00       	mov    %eax,0x807000
+  8028c0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8028c6:	83 ec 04             	sub    $0x4,%esp
+  8028c9:	53                   	push   %ebx
+  8028ca:	56                   	push   %esi
+  8028cb:	68 08 70 80 00       	push   $0x807008
+  8028d0:	e8 3d e3 ff ff       	call   800c12 <memmove>
+  8028d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028da:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028df:	e8 7c fb ff ff       	call   802460 <fsipc>
+  8028e4:	83 c4 10             	add    $0x10,%esp
+  8028e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ea:	5b                   	pop    %ebx
+  8028eb:	5e                   	pop    %esi
+  8028ec:	5f                   	pop    %edi
+  8028ed:	5d                   	pop    %ebp
+  8028ee:	c3                   	ret
+
+008028ef <devfile_read>:
+  8028ef:	55                   	push   %ebp
+  8028f0:	89 e5                	mov    %esp,%ebp
+  8028f2:	57                   	push   %edi
+  8028f3:	56                   	push   %esi
+  8028f4:	53                   	push   %ebx
+  8028f5:	83 ec 0c             	sub    $0xc,%esp
+  8028f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028fb:	8b 75 10             	mov    0x10(%ebp),%esi
+  8028fe:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802904:	76 1d                	jbe    802923 <devfile_read+0x34>
+  802906:	83 ec 0c             	sub    $0xc,%esp
+  802909:	56                   	push   %esi
+  80290a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80290d:	ba 05 00 00 00       	mov    $0x5,%edx
+  802912:	89 f8                	mov    %edi,%eax
+  802914:	e8 32 fc ff ff       	call   80254b <fsring_rw>
+  802919:	89 c3                	mov    %eax,%ebx
+  80291b:	83 c4 10             	add    $0x10,%esp
+  80291e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802921:	75 37                	jne    80295a <devfile_read+0x6b>
+  802923:	8b 47 0c             	mov    0xc(%edi),%eax
+  802926:	a3 00 70 80 00       	mov    %eax,0x807000
+  80292b:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802931:	ba 00 00 00 00       	mov    $0x0,%edx
+  802936:	b8 03 00 00 00       	mov    $0x3,%eax
+  80293b:	e8 20 fb ff ff       	call   802460 <fsipc>
+  802940:	89 c3                	mov    %eax,%ebx
+  802942:	85 c0                	test   %eax,%eax
+  802944:	78 14                	js     80295a <devfile_read+0x6b>
+  802946:	83 ec 04             	sub    $0x4,%esp
+  802949:	50                   	push   %eax
+  80294a:	68 00 70 80 00       	push   $0x807000
+  80294f:	ff 75 0c             	push   0xc(%ebp)
+  802952:	e8 bb e2 ff ff       	call   800c12 <memmove>
+  802957:	83 c4 10             	add    $0x10,%esp
+  80295a:	89 d8                	mov    %ebx,%eax
+  80295c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80295f:	5b                   	pop    %ebx
+  802960:	5e                   	pop    %esi
+  802961:	5f                   	pop    %edi
+  802962:	5d                   	pop    %ebp
+  802963:	c3                   	ret
+
+00802964 <open>:
+  802964:	55                   	push   %ebp
+  802965:	89 e5                	mov    %esp,%ebp
+  802967:	56                   	push   %esi
+  802968:	53                   	push   %ebx
+  802969:	83 ec 1c             	sub    $0x1c,%esp
+  80296c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80296f:	56                   	push   %esi
+  802970:	e8 a1 e0 ff ff       	call   800a16 <strlen>
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80297d:	7f 6c                	jg     8029eb <open+0x87>
+  80297f:	83 ec 0c             	sub    $0xc,%esp
+  802982:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802985:	50                   	push   %eax
+  802986:	e8 6a f5 ff ff       	call   801ef5 <fd_alloc>
+  80298b:	89 c3                	mov    %eax,%ebx
+  80298d:	83 c4 10             	add    $0x10,%esp
+  802990:	85 c0                	test   %eax,%eax
+  802992:	78 3c                	js     8029d0 <open+0x6c>
+  802994:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802997:	a3 00 74 80 00       	mov    %eax,0x807400
+  80299c:	83 ec 08             	sub    $0x8,%esp
+  80299f:	56                   	push   %esi
+  8029a0:	68 00 70 80 00       	push   $0x807000
+  8029a5:	e8 b8 e0 ff ff       	call   800a62 <strcpy>
+  8029aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029b2:	e8 a9 fa ff ff       	call   802460 <fsipc>
+  8029b7:	89 c3                	mov    %eax,%ebx
+  8029b9:	83 c4 10             	add    $0x10,%esp
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	78 19                	js     8029d9 <open+0x75>
+  8029c0:	83 ec 0c             	sub    $0xc,%esp
+  8029c3:	ff 75 f4             	push   -0xc(%ebp)
+  8029c6:	e8 03 f5 ff ff       	call   801ece <fd2num>
+  8029cb:	89 c3                	mov    %eax,%ebx
+  8029cd:	83 c4 10             	add    $0x10,%esp
+  8029d0:	89 d8                	mov    %ebx,%eax
+  8029d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029d5:	5b                   	pop    %ebx
+  8029d6:	5e                   	pop    %esi
+  8029d7:	5d                   	pop    %ebp
+  8029d8:	c3                   	ret
+  8029d9:	83 ec 08             	sub    $0x8,%esp
+  8029dc:	6a 00                	push   $0x0
+  8029de:	ff 75 f4             	push   -0xc(%ebp)
+  8029e1:	e8 05 f6 ff ff       	call   801feb <fd_close>
+  8029e6:	83 c4 10             	add    $0x10,%esp
+  8029e9:	eb e5                	jmp    8029d0 <open+0x6c>
+  8029eb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8029f0:	eb de                	jmp    8029d0 <open+0x6c>
+
+008029f2 <file_image>:
+  8029f2:	55                   	push   %ebp
+  8029f3:	89 e5                	mov    %esp,%ebp
+  8029f5:	53                   	push   %ebx
+  8029f6:	83 ec 1c             	sub    $0x1c,%esp
+  8029f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029ff:	50                   	push   %eax
+  802a00:	ff 75 08             	push   0x8(%ebp)
+  802a03:	e8 3d f5 ff ff       	call   801f45 <fd_lookup>
+  802a08:	83 c4 10             	add    $0x10,%esp
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	78 58                	js     802a67 <file_image+0x75>
+  802a0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a12:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802a18:	39 08                	cmp    %ecx,(%eax)
+  802a1a:	75 50                	jne    802a6c <file_image+0x7a>
+  802a1c:	83 fb 04             	cmp    $0x4,%ebx
+  802a1f:	77 52                	ja     802a73 <file_image+0x81>
+  802a21:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a24:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a29:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802a2f:	83 ec 04             	sub    $0x4,%esp
+  802a32:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802a35:	c1 e0 02             	shl    $0x2,%eax
+  802a38:	50                   	push   %eax
+  802a39:	ff 75 0c             	push   0xc(%ebp)
+  802a3c:	68 08 70 80 00       	push   $0x807008
+  802a41:	e8 cc e1 ff ff       	call   800c12 <memmove>
+  802a46:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a4b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a50:	e8 0b fa ff ff       	call   802460 <fsipc>
+  802a55:	83 c4 10             	add    $0x10,%esp
+  802a58:	85 c0                	test   %eax,%eax
+  802a5a:	78 0b                	js     802a67 <file_image+0x75>
+  802a5c:	8b 55 14             	mov    0x14(%ebp),%edx
+  802a5f:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802a65:	89 0a                	mov    %ecx,(%edx)
+  802a67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+  802a6c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a71:	eb f4                	jmp    802a67 <file_image+0x75>
+  802a73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a78:	eb ed                	jmp    802a67 <file_image+0x75>
+
+00802a7a <remove>:
+  802a7a:	55                   	push   %ebp
+  802a7b:	89 e5                	mov    %esp,%ebp
+  802a7d:	53                   	push   %ebx
+  802a7e:	83 ec 10             	sub    $0x10,%esp
+  802a81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a84:	53                   	push   %ebx
+  802a85:	e8 8c df ff ff       	call   800a16 <strlen>
+  802a8a:	83 c4 10             	add    $0x10,%esp
+  802a8d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a92:	7f 25                	jg     802ab9 <remove+0x3f>
+  802a94:	83 ec 08             	sub    $0x8,%esp
+  802a97:	53                   	push   %ebx
+  802a98:	68 00 70 80 00       	push   $0x807000
+  802a9d:	e8 c0 df ff ff       	call   800a62 <strcpy>
+  802aa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa7:	b8 09 00 00 00       	mov    $0x9,%eax
+  802aac:	e8 af f9 ff ff       	call   802460 <fsipc>
+  802ab1:	83 c4 10             	add    $0x10,%esp
+  802ab4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+  802ab9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802abe:	eb f4                	jmp    802ab4 <remove+0x3a>
+
+00802ac0 <sync>:
+  802ac0:	55                   	push   %ebp
+  802ac1:	89 e5                	mov    %esp,%ebp
+  802ac3:	83 ec 08             	sub    $0x8,%esp
+  802ac6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802acb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ad0:	e8 8b f9 ff ff       	call   802460 <fsipc>
+  802ad5:	c9                   	leave
+  802ad6:	c3                   	ret
+
+00802ad7 <pageref>:
+  802ad7:	55                   	push   %ebp
+  802ad8:	89 e5                	mov    %esp,%ebp
+  802ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  802add:	89 c2                	mov    %eax,%edx
+  802adf:	c1 ea 16             	shr    $0x16,%edx
+  802ae2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802ae9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aee:	f6 c1 01             	test   $0x1,%cl
+  802af1:	74 22                	je     802b15 <pageref+0x3e>
+  802af3:	c1 e8 0c             	shr    $0xc,%eax
+  802af6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802afd:	a8 01                	test   $0x1,%al
+  802aff:	74 14                	je     802b15 <pageref+0x3e>
+  802b01:	c1 e8 0c             	shr    $0xc,%eax
+  802b04:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802b07:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802b0e:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802b12:	0f b7 d2             	movzwl %dx,%edx
+  802b15:	89 d0                	mov    %edx,%eax
+  802b17:	5d                   	pop    %ebp
+  802b18:	c3                   	ret
+
+00802b19 <devsock_stat>:
+  802b19:	55                   	push   %ebp
+  802b1a:	89 e5                	mov    %esp,%ebp
+  802b1c:	83 ec 10             	sub    $0x10,%esp
+  802b1f:	68 5c 3f 80 00       	push   $0x803f5c
+  802b24:	ff 75 0c             	push   0xc(%ebp)
+  802b27:	e8 36 df ff ff       	call   800a62 <strcpy>
+  802b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b31:	c9                   	leave
+  802b32:	c3                   	ret
+
+00802b33 <devsock_close>:
+  802b33:	55                   	push   %ebp
+  802b34:	89 e5                	mov    %esp,%ebp
+  802b36:	53                   	push   %ebx
+  802b37:	83 ec 10             	sub    $0x10,%esp
+  802b3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b3d:	53                   	push   %ebx
+  802b3e:	e8 94 ff ff ff       	call   802ad7 <pageref>
+  802b43:	89 c2                	mov    %eax,%edx
+  802b45:	83 c4 10             	add    $0x10,%esp
+  802b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4d:	83 fa 01             	cmp    $0x1,%edx
+  802b50:	74 05                	je     802b57 <devsock_close+0x24>
+  802b52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b55:	c9                   	leave
+  802b56:	c3                   	ret
+  802b57:	83 ec 0c             	sub    $0xc,%esp
+  802b5a:	ff 73 0c             	push   0xc(%ebx)
+  802b5d:	e8 aa 02 00 00       	call   802e0c <nsipc_close>
+  802b62:	83 c4 10             	add    $0x10,%esp
+  802b65:	eb eb                	jmp    802b52 <devsock_close+0x1f>
+
+00802b67 <devsock_write>:
+  802b67:	55                   	push   %ebp
+  802b68:	89 e5                	mov    %esp,%ebp
+  802b6a:	83 ec 08             	sub    $0x8,%esp
+  802b6d:	6a 00                	push   $0x0
+  802b6f:	ff 75 10             	push   0x10(%ebp)
+  802b72:	ff 75 0c             	push   0xc(%ebp)
+  802b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b78:	ff 70 0c             	push   0xc(%eax)
+  802b7b:	e8 6c 03 00 00       	call   802eec <nsipc_send>
+  802b80:	c9                   	leave
+  802b81:	c3                   	ret
+
+00802b82 <devsock_read>:
+  802b82:	55                   	push   %ebp
+  802b83:	89 e5                	mov    %esp,%ebp
+  802b85:	83 ec 08             	sub    $0x8,%esp
+  802b88:	6a 00                	push   $0x0
+  802b8a:	ff 75 10             	push   0x10(%ebp)
+  802b8d:	ff 75 0c             	push   0xc(%ebp)
+  802b90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b93:	ff 70 0c             	push   0xc(%eax)
+  802b96:	e8 e2 02 00 00       	call   802e7d <nsipc_recv>
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+
+00802b9d <fd2sockid>:
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	83 ec 20             	sub    $0x20,%esp
+  802ba3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ba6:	52                   	push   %edx
+  802ba7:	50                   	push   %eax
+  802ba8:	e8 98 f3 ff ff       	call   801f45 <fd_lookup>
+  802bad:	83 c4 10             	add    $0x10,%esp
+  802bb0:	85 c0                	test   %eax,%eax
+  802bb2:	78 10                	js     802bc4 <fd2sockid+0x27>
+  802bb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bb7:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802bbd:	39 08                	cmp    %ecx,(%eax)
+  802bbf:	75 05                	jne    802bc6 <fd2sockid+0x29>
+  802bc1:	8b 40 0c             	mov    0xc(%eax),%eax
+  802bc4:	c9                   	leave
+  802bc5:	c3                   	ret
+  802bc6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bcb:	eb f7                	jmp    802bc4 <fd2sockid+0x27>
+
+00802bcd <alloc_sockfd>:
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	56                   	push   %esi
+  802bd1:	53                   	push   %ebx
+  802bd2:	83 ec 1c             	sub    $0x1c,%esp
+  802bd5:	89 c6                	mov    %eax,%esi
+  802bd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bda:	50                   	push   %eax
+  802bdb:	e8 15 f3 ff ff       	call   801ef5 <fd_alloc>
+  802be0:	89 c3                	mov    %eax,%ebx
+  802be2:	83 c4 10             	add    $0x10,%esp
+  802be5:	85 c0                	test   %eax,%eax
+  802be7:	78 43                	js     802c2c <alloc_sockfd+0x5f>
+  802be9:	83 ec 04             	sub    $0x4,%esp
+  802bec:	68 07 04 00 00       	push   $0x407
+  802bf1:	ff 75 f4             	push   -0xc(%ebp)
+  802bf4:	6a 00                	push   $0x0
+  802bf6:	e8 c7 e2 ff ff       	call   800ec2 <sys_page_alloc>
+  802bfb:	89 c3                	mov    %eax,%ebx
+  802bfd:	83 c4 10             	add    $0x10,%esp
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	78 28                	js     802c2c <alloc_sockfd+0x5f>
+  802c04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c07:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802c0d:	89 10                	mov    %edx,(%eax)
+  802c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c12:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c19:	89 70 0c             	mov    %esi,0xc(%eax)
+  802c1c:	83 ec 0c             	sub    $0xc,%esp
+  802c1f:	50                   	push   %eax
+  802c20:	e8 a9 f2 ff ff       	call   801ece <fd2num>
+  802c25:	89 c3                	mov    %eax,%ebx
+  802c27:	83 c4 10             	add    $0x10,%esp
+  802c2a:	eb 0c                	jmp    802c38 <alloc_sockfd+0x6b>
+  802c2c:	83 ec 0c             	sub    $0xc,%esp
+  802c2f:	56                   	push   %esi
+  802c30:	e8 d7 01 00 00       	call   802e0c <nsipc_close>
+  802c35:	83 c4 10             	add    $0x10,%esp
+  802c38:	89 d8                	mov    %ebx,%eax
+  802c3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c3d:	5b                   	pop    %ebx
+  802c3e:	5e                   	pop    %esi
+  802c3f:	5d                   	pop    %ebp
+  802c40:	c3                   	ret
+
+00802c41 <accept>:
+  802c41:	55                   	push   %ebp
+  802c42:	89 e5                	mov    %esp,%ebp
+  802c44:	83 ec 08             	sub    $0x8,%esp
+  802c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4a:	e8 4e ff ff ff       	call   802b9d <fd2sockid>
+  802c4f:	85 c0                	test   %eax,%eax
+  802c51:	78 1b                	js     802c6e <accept+0x2d>
+  802c53:	83 ec 04             	sub    $0x4,%esp
+  802c56:	ff 75 10             	push   0x10(%ebp)
+  802c59:	ff 75 0c             	push   0xc(%ebp)
+  802c5c:	50                   	push   %eax
+  802c5d:	e8 07 01 00 00       	call   802d69 <nsipc_accept>
+  802c62:	83 c4 10             	add    $0x10,%esp
+  802c65:	85 c0                	test   %eax,%eax
+  802c67:	78 05                	js     802c6e <accept+0x2d>
+  802c69:	e8 5f ff ff ff       	call   802bcd <alloc_sockfd>
+  802c6e:	c9                   	leave
+  802c6f:	c3                   	ret
+
+00802c70 <bind>:
+  802c70:	55                   	push   %ebp
+  802c71:	89 e5                	mov    %esp,%ebp
+  802c73:	83 ec 08             	sub    $0x8,%esp
+  802c76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c79:	e8 1f ff ff ff       	call   802b9d <fd2sockid>
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	78 12                	js     802c94 <bind+0x24>
+  802c82:	83 ec 04             	sub    $0x4,%esp
+  802c85:	ff 75 10             	push   0x10(%ebp)
+  802c88:	ff 75 0c             	push   0xc(%ebp)
+  802c8b:	50                   	push   %eax
+  802c8c:	e8 24 01 00 00       	call   802db5 <nsipc_bind>
+  802c91:	83 c4 10             	add    $0x10,%esp
+  802c94:	c9                   	leave
+  802c95:	c3                   	ret
+
+00802c96 <shutdown>:
+  802c96:	55                   	push   %ebp
+  802c97:	89 e5                	mov    %esp,%ebp
+  802c99:	83 ec 08             	sub    $0x8,%esp
+  802c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9f:	e8 f9 fe ff ff       	call   802b9d <fd2sockid>
+  802ca4:	85 c0                	test   %eax,%eax
+  802ca6:	78 0f                	js     802cb7 <shutdown+0x21>
+  802ca8:	83 ec 08             	sub    $0x8,%esp
+  802cab:	ff 75 0c             	push   0xc(%ebp)
+  802cae:	50                   	push   %eax
+  802caf:	e8 36 01 00 00       	call   802dea <nsipc_shutdown>
+  802cb4:	83 c4 10             	add    $0x10,%esp
+  802cb7:	c9                   	leave
+  802cb8:	c3                   	ret
+
+00802cb9 <connect>:
+  802cb9:	55                   	push   %ebp
+  802cba:	89 e5                	mov    %esp,%ebp
+  802cbc:	83 ec 08             	sub    $0x8,%esp
+  802cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc2:	e8 d6 fe ff ff       	call   802b9d <fd2sockid>
+  802cc7:	85 c0                	test   %eax,%eax
+  802cc9:	78 12                	js     802cdd <connect+0x24>
+  802ccb:	83 ec 04             	sub    $0x4,%esp
+  802cce:	ff 75 10             	push   0x10(%ebp)
+  802cd1:	ff 75 0c             	push   0xc(%ebp)
+  802cd4:	50                   	push   %eax
+  802cd5:	e8 4c 01 00 00       	call   802e26 <nsipc_connect>
+  802cda:	83 c4 10             	add    $0x10,%esp
+  802cdd:	c9                   	leave
+  802cde:	c3                   	ret
+
+00802cdf <listen>:
+  802cdf:	55                   	push   %ebp
+  802ce0:	89 e5                	mov    %esp,%ebp
+  802ce2:	83 ec 08             	sub    $0x8,%esp
+  802ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce8:	e8 b0 fe ff ff       	call   802b9d <fd2sockid>
+  802ced:	85 c0                	test   %eax,%eax
+  802cef:	78 0f                	js     802d00 <listen+0x21>
+  802cf1:	83 ec 08             	sub    $0x8,%esp
+  802cf4:	ff 75 0c             	push   0xc(%ebp)
+  802cf7:	50                   	push   %eax
+  802cf8:	e8 5e 01 00 00       	call   802e5b <nsipc_listen>
+  802cfd:	83 c4 10             	add    $0x10,%esp
+  802d00:	c9                   	leave
+  802d01:	c3                   	ret
+
+00802d02 <socket>:
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	83 ec 0c             	sub    $0xc,%esp
+  802d08:	ff 75 10             	push   0x10(%ebp)
+  802d0b:	ff 75 0c             	push   0xc(%ebp)
+  802d0e:	ff 75 08             	push   0x8(%ebp)
+  802d11:	e8 34 02 00 00       	call   802f4a <nsipc_socket>
+  802d16:	83 c4 10             	add    $0x10,%esp
+  802d19:	85 c0                	test   %eax,%eax
+  802d1b:	78 05                	js     802d22 <socket+0x20>
+  802d1d:	e8 ab fe ff ff       	call   802bcd <alloc_sockfd>
+  802d22:	c9                   	leave
+  802d23:	c3                   	ret
+
+00802d24 <nsipc>:
+  802d24:	55                   	push   %ebp
+  802d25:	89 e5                	mov    %esp,%ebp
+  802d27:	53                   	push   %ebx
+  802d28:	83 ec 04             	sub    $0x4,%esp
+  802d2b:	89 c3                	mov    %eax,%ebx
+  802d2d:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  802d34:	74 1f                	je     802d55 <nsipc+0x31>
+  802d36:	83 ec 08             	sub    $0x8,%esp
+  802d39:	6a 00                	push   $0x0
+  802d3b:	6a 00                	push   $0x0
+  802d3d:	6a 07                	push   $0x7
+  802d3f:	68 00 80 80 00       	push   $0x808000
+  802d44:	53                   	push   %ebx
+  802d45:	ff 35 10 60 80 00    	push   0x806010
+  802d4b:	e8 c9 ef ff ff       	call   801d19 <ipc_call>
+  802d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+  802d55:	83 ec 0c             	sub    $0xc,%esp
+  802d58:	6a 03                	push   $0x3
+  802d5a:	e8 55 f1 ff ff       	call   801eb4 <ipc_find_env>
+  802d5f:	a3 10 60 80 00       	mov    %eax,0x806010
+  802d64:	83 c4 10             	add    $0x10,%esp
+  802d67:	eb cd                	jmp    802d36 <nsipc+0x12>
+
+00802d69 <nsipc_accept>:
+  802d69:	55                   	push   %ebp
+  802d6a:	89 e5                	mov    %esp,%ebp
+  802d6c:	53                   	push   %ebx
+  802d6d:	83 ec 04             	sub    $0x4,%esp
+  802d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d73:	a3 00 80 80 00       	mov    %eax,0x808000
+  802d78:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d7d:	e8 a2 ff ff ff       	call   802d24 <nsipc>
+  802d82:	89 c3                	mov    %eax,%ebx
+  802d84:	85 c0                	test   %eax,%eax
+  802d86:	79 07                	jns    802d8f <nsipc_accept+0x26>
+  802d88:	89 d8                	mov    %ebx,%eax
+  802d8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d8d:	c9                   	leave
+  802d8e:	c3                   	ret
+  802d8f:	83 ec 04             	sub    $0x4,%esp
+  802d92:	ff 35 10 80 80 00    	push   0x808010
+  802d98:	68 00 80 80 00       	push   $0x808000
+  802d9d:	ff 75 0c             	push   0xc(%ebp)
+  802da0:	e8 6d de ff ff       	call   800c12 <memmove>
+  802da5:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802dab:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dae:	89 10                	mov    %edx,(%eax)
+  802db0:	83 c4 10             	add    $0x10,%esp
+  802db3:	eb d3                	jmp    802d88 <nsipc_accept+0x1f>
+
+00802db5 <nsipc_bind>:
+  802db5:	55                   	push   %ebp
+  802db6:	89 e5                	mov    %esp,%ebp
+  802db8:	53                   	push   %ebx
+  802db9:	83 ec 08             	sub    $0x8,%esp
+  802dbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc2:	a3 00 80 80 00       	mov    %eax,0x808000
+  802dc7:	53                   	push   %ebx
+  802dc8:	ff 75 0c             	push   0xc(%ebp)
+  802dcb:	68 04 80 80 00       	push   $0x808004
+  802dd0:	e8 3d de ff ff       	call   800c12 <memmove>
+  802dd5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802ddb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802de0:	e8 3f ff ff ff       	call   802d24 <nsipc>
+  802de5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802de8:	c9                   	leave
+  802de9:	c3                   	ret
+
+00802dea <nsipc_shutdown>:
+  802dea:	55                   	push   %ebp
+  802deb:	89 e5                	mov    %esp,%ebp
+  802ded:	83 ec 08             	sub    $0x8,%esp
+  802df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df3:	a3 00 80 80 00       	mov    %eax,0x808000
+  802df8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dfb:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e00:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e05:	e8 1a ff ff ff       	call   802d24 <nsipc>
+  802e0a:	c9                   	leave
+  802e0b:	c3                   	ret
+
+00802e0c <nsipc_close>:
+  802e0c:	55                   	push   %ebp
+  802e0d:	89 e5                	mov    %esp,%ebp
+  802e0f:	83 ec 08             	sub    $0x8,%esp
+  802e12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e15:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e1a:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e1f:	e8 00 ff ff ff       	call   802d24 <nsipc>
+  802e24:	c9                   	leave
+  802e25:	c3                   	ret
+
+00802e26 <nsipc_connect>:
+  802e26:	55                   	push   %ebp
+  802e27:	89 e5                	mov    %esp,%ebp
+  802e29:	53                   	push   %ebx
+  802e2a:	83 ec 08             	sub    $0x8,%esp
+  802e2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e33:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e38:	53                   	push   %ebx
+  802e39:	ff 75 0c             	push   0xc(%ebp)
+  802e3c:	68 04 80 80 00       	push   $0x808004
+  802e41:	e8 cc dd ff ff       	call   800c12 <memmove>
+  802e46:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802e4c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e51:	e8 ce fe ff ff       	call   802d24 <nsipc>
+  802e56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e59:	c9                   	leave
+  802e5a:	c3                   	ret
+
+00802e5b <nsipc_listen>:
+  802e5b:	55                   	push   %ebp
+  802e5c:	89 e5                	mov    %esp,%ebp
+  802e5e:	83 ec 08             	sub    $0x8,%esp
+  802e61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e64:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e6c:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e71:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e76:	e8 a9 fe ff ff       	call   802d24 <nsipc>
+  802e7b:	c9                   	leave
+  802e7c:	c3                   	ret
+
+00802e7d <nsipc_recv>:
+  802e7d:	55                   	push   %ebp
+  802e7e:	89 e5                	mov    %esp,%ebp
+  802e80:	56                   	push   %esi
+  802e81:	53                   	push   %ebx
+  802e82:	8b 75 10             	mov    0x10(%ebp),%esi
+  802e85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e88:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e8d:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802e93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e96:	a3 08 80 80 00       	mov    %eax,0x808008
+  802e9b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ea0:	e8 7f fe ff ff       	call   802d24 <nsipc>
+  802ea5:	89 c3                	mov    %eax,%ebx
+  802ea7:	85 c0                	test   %eax,%eax
+  802ea9:	78 22                	js     802ecd <nsipc_recv+0x50>
+  802eab:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802eb0:	39 c6                	cmp    %eax,%esi
+  802eb2:	0f 4e c6             	cmovle %esi,%eax
+  802eb5:	39 c3                	cmp    %eax,%ebx
+  802eb7:	7f 1d                	jg     802ed6 <nsipc_recv+0x59>
+  802eb9:	83 ec 04             	sub    $0x4,%esp
+  802ebc:	53                   	push   %ebx
+  802ebd:	68 00 80 80 00       	push   $0x808000
+  802ec2:	ff 75 0c             	push   0xc(%ebp)
+  802ec5:	e8 48 dd ff ff       	call   800c12 <memmove>
+  802eca:	83 c4 10             	add    $0x10,%esp
+  802ecd:	89 d8                	mov    %ebx,%eax
+  802ecf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ed2:	5b                   	pop    %ebx
+  802ed3:	5e                   	pop    %esi
+  802ed4:	5d                   	pop    %ebp
+  802ed5:	c3                   	ret
+  802ed6:	68 68 3f 80 00       	push   $0x803f68
+  802edb:	68 7d 3f 80 00       	push   $0x803f7d
+  802ee0:	6a 60                	push   $0x60
+  802ee2:	68 92 3f 80 00       	push   $0x803f92
+  802ee7:	e8 a4 d3 ff ff       	call   800290 <_panic>
+
+00802eec <nsipc_send>:
+  802eec:	55                   	push   %ebp
+  802eed:	89 e5                	mov    %esp,%ebp
+  802eef:	53                   	push   %ebx
+  802ef0:	83 ec 04             	sub    $0x4,%esp
+  802ef3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef9:	a3 00 80 80 00       	mov    %eax,0x808000
+  802efe:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f04:	7f 2e                	jg     802f34 <nsipc_send+0x48>
+  802f06:	83 ec 04             	sub    $0x4,%esp
+  802f09:	53                   	push   %ebx
+  802f0a:	ff 75 0c             	push   0xc(%ebp)
+  802f0d:	68 0c 80 80 00       	push   $0x80800c
+  802f12:	e8 fb dc ff ff       	call   800c12 <memmove>
+  802f17:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802f1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f20:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f25:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f2a:	e8 f5 fd ff ff       	call   802d24 <nsipc>
+  802f2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f32:	c9                   	leave
+  802f33:	c3                   	ret
+  802f34:	68 9e 3f 80 00       	push   $0x803f9e
+  802f39:	68 7d 3f 80 00       	push   $0x803f7d
+  802f3e:	6a 6b                	push   $0x6b
+  802f40:	68 92 3f 80 00       	push   $0x803f92
+  802f45:	e8 46 d3 ff ff       	call   800290 <_panic>
+
+00802f4a <nsipc_socket>:
+  802f4a:	55                   	push   %ebp
+  802f4b:	89 e5                	mov    %esp,%ebp
+  802f4d:	83 ec 08             	sub    $0x8,%esp
+  802f50:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f53:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f5b:	a3 04 80 80 00       	mov    %eax,0x808004
+  802f60:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f63:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f68:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f6d:	e8 b2 fd ff ff       	call   802d24 <nsipc>
+  802f72:	c9                   	leave
+  802f73:	c3                   	ret
+
+00802f74 <devpipe_stat>:
+  802f74:	55                   	push   %ebp
+  802f75:	89 e5                	mov    %esp,%ebp
+  802f77:	56                   	push   %esi
+  802f78:	53                   	push   %ebx
+  802f79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802f7c:	83 ec 0c             	sub    $0xc,%esp
+  802f7f:	ff 75 08             	push   0x8(%ebp)
+  802f82:	e8 57 ef ff ff       	call   801ede <fd2data>
+  802f87:	89 c6                	mov    %eax,%esi
+  802f89:	83 c4 08             	add    $0x8,%esp
+  802f8c:	68 aa 3f 80 00       	push   $0x803faa
+  802f91:	53                   	push   %ebx
+  802f92:	e8 cb da ff ff       	call   800a62 <strcpy>
+  802f97:	8b 46 04             	mov    0x4(%esi),%eax
+  802f9a:	2b 06                	sub    (%esi),%eax
+  802f9c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802fa2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fa9:	00 00 00 
+  802fac:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802fb3:	50 80 00 
+  802fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fbe:	5b                   	pop    %ebx
+  802fbf:	5e                   	pop    %esi
+  802fc0:	5d                   	pop    %ebp
+  802fc1:	c3                   	ret
+
+00802fc2 <devpipe_close>:
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	53                   	push   %ebx
+  802fc6:	83 ec 0c             	sub    $0xc,%esp
+  802fc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fcc:	53                   	push   %ebx
+  802fcd:	6a 00                	push   $0x0
+  802fcf:	e8 c0 df ff ff       	call   800f94 <sys_page_unmap>
+  802fd4:	89 1c 24             	mov    %ebx,(%esp)
+  802fd7:	e8 02 ef ff ff       	call   801ede <fd2data>
+  802fdc:	83 c4 08             	add    $0x8,%esp
+  802fdf:	50                   	push   %eax
+  802fe0:	6a 00                	push   $0x0
+  802fe2:	e8 ad df ff ff       	call   800f94 <sys_page_unmap>
+  802fe7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fea:	c9                   	leave
+  802feb:	c3                   	ret
+
+00802fec <_pipeisclosed>:
+  802fec:	55                   	push   %ebp
+  802fed:	89 e5                	mov    %esp,%ebp
+  802fef:	57                   	push   %edi
+  802ff0:	56                   	push   %esi
+  802ff1:	53                   	push   %ebx
+  802ff2:	83 ec 1c             	sub    $0x1c,%esp
+  802ff5:	89 c7                	mov    %eax,%edi
+  802ff7:	89 d6                	mov    %edx,%esi
+  802ff9:	a1 14 60 80 00       	mov    0x806014,%eax
+  802ffe:	8b 58 58             	mov    0x58(%eax),%ebx
+  803001:	83 ec 0c             	sub    $0xc,%esp
+  803004:	57                   	push   %edi
+  803005:	e8 cd fa ff ff       	call   802ad7 <pageref>
+  80300a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80300d:	89 34 24             	mov    %esi,(%esp)
+  803010:	e8 c2 fa ff ff       	call   802ad7 <pageref>
+  803015:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  80301b:	8b 4a 58             	mov    0x58(%edx),%ecx
+  80301e:	83 c4 10             	add    $0x10,%esp
+  803021:	39 cb                	cmp    %ecx,%ebx
+  803023:	74 1b                	je     803040 <_pipeisclosed+0x54>
+  803025:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803028:	75 cf                	jne    802ff9 <_pipeisclosed+0xd>
+  80302a:	8b 42 58             	mov    0x58(%edx),%eax
+  80302d:	6a 01                	push   $0x1
+  80302f:	50                   	push   %eax
+  803030:	53                   	push   %ebx
+  803031:	68 b1 3f 80 00       	push   $0x803fb1
+  803036:	e8 30 d3 ff ff       	call   80036b <cprintf>
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	eb b9                	jmp    802ff9 <_pipeisclosed+0xd>
+  803040:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803043:	0f 94 c0             	sete   %al
+  803046:	0f b6 c0             	movzbl %al,%eax
+  803049:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80304c:	5b                   	pop    %ebx
+  80304d:	5e                   	pop    %esi
+  80304e:	5f                   	pop    %edi
+  80304f:	5d                   	pop    %ebp
+  803050:	c3                   	ret
+
+00803051 <devpipe_write>:
+  803051:	55                   	push   %ebp
+  803052:	89 e5                	mov    %esp,%ebp
+  803054:	57                   	push   %edi
+  803055:	56                   	push   %esi
+  803056:	53                   	push   %ebx
+  803057:	83 ec 28             	sub    $0x28,%esp
+  80305a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80305d:	56                   	push   %esi
+  80305e:	e8 7b ee ff ff       	call   801ede <fd2data>
+  803063:	89 c3                	mov    %eax,%ebx
+  803065:	83 c4 10             	add    $0x10,%esp
+  803068:	bf 00 00 00 00       	mov    $0x0,%edi
+  80306d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803071:	74 5c                	je     8030cf <devpipe_write+0x7e>
+  803073:	8b 43 04             	mov    0x4(%ebx),%eax
+  803076:	8b 0b                	mov    (%ebx),%ecx
+  803078:	8d 51 20             	lea    0x20(%ecx),%edx
+  80307b:	39 d0                	cmp    %edx,%eax
+  80307d:	72 1e                	jb     80309d <devpipe_write+0x4c>
+  80307f:	89 da                	mov    %ebx,%edx
+  803081:	89 f0                	mov    %esi,%eax
+  803083:	e8 64 ff ff ff       	call   802fec <_pipeisclosed>
+  803088:	85 c0                	test   %eax,%eax
+  80308a:	75 48                	jne    8030d4 <devpipe_write+0x83>
+  80308c:	e8 e6 dd ff ff       	call   800e77 <sys_yield>
+  803091:	8b 43 04             	mov    0x4(%ebx),%eax
+  803094:	8b 0b                	mov    (%ebx),%ecx
+  803096:	8d 51 20             	lea    0x20(%ecx),%edx
+  803099:	39 d0                	cmp    %edx,%eax
+  80309b:	73 e2                	jae    80307f <devpipe_write+0x2e>
+  80309d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030a0:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030a4:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030a7:	89 c2                	mov    %eax,%edx
+  8030a9:	c1 fa 1f             	sar    $0x1f,%edx
+  8030ac:	89 d1                	mov    %edx,%ecx
+  8030ae:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030b1:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030b4:	83 e2 1f             	and    $0x1f,%edx
+  8030b7:	29 ca                	sub    %ecx,%edx
+  8030b9:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030bd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8030c1:	83 c0 01             	add    $0x1,%eax
+  8030c4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030c7:	83 c7 01             	add    $0x1,%edi
+  8030ca:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8030cd:	75 a4                	jne    803073 <devpipe_write+0x22>
+  8030cf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030d2:	eb 05                	jmp    8030d9 <devpipe_write+0x88>
+  8030d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030dc:	5b                   	pop    %ebx
+  8030dd:	5e                   	pop    %esi
+  8030de:	5f                   	pop    %edi
+  8030df:	5d                   	pop    %ebp
+  8030e0:	c3                   	ret
+
+008030e1 <devpipe_read>:
+  8030e1:	55                   	push   %ebp
+  8030e2:	89 e5                	mov    %esp,%ebp
+  8030e4:	57                   	push   %edi
+  8030e5:	56                   	push   %esi
+  8030e6:	53                   	push   %ebx
+  8030e7:	83 ec 18             	sub    $0x18,%esp
+  8030ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030ed:	56                   	push   %esi
+  8030ee:	e8 eb ed ff ff       	call   801ede <fd2data>
+  8030f3:	89 c3                	mov    %eax,%ebx
+  8030f5:	83 c4 10             	add    $0x10,%esp
+  8030f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030fd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803101:	74 45                	je     803148 <devpipe_read+0x67>
+  803103:	8b 03                	mov    (%ebx),%eax
+  803105:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803108:	75 1d                	jne    803127 <devpipe_read+0x46>
+  80310a:	85 ff                	test   %edi,%edi
+  80310c:	75 3f                	jne    80314d <devpipe_read+0x6c>
+  80310e:	89 da                	mov    %ebx,%edx
+  803110:	89 f0                	mov    %esi,%eax
+  803112:	e8 d5 fe ff ff       	call   802fec <_pipeisclosed>
+  803117:	85 c0                	test   %eax,%eax
+  803119:	75 3c                	jne    803157 <devpipe_read+0x76>
+  80311b:	e8 57 dd ff ff       	call   800e77 <sys_yield>
+  803120:	8b 03                	mov    (%ebx),%eax
+  803122:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803125:	74 e7                	je     80310e <devpipe_read+0x2d>
+  803127:	99                   	cltd
+  803128:	c1 ea 1b             	shr    $0x1b,%edx
+  80312b:	01 d0                	add    %edx,%eax
+  80312d:	83 e0 1f             	and    $0x1f,%eax
+  803130:	29 d0                	sub    %edx,%eax
+  803132:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803137:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80313a:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80313d:	83 03 01             	addl   $0x1,(%ebx)
+  803140:	83 c7 01             	add    $0x1,%edi
+  803143:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803146:	75 bb                	jne    803103 <devpipe_read+0x22>
+  803148:	8b 45 10             	mov    0x10(%ebp),%eax
+  80314b:	eb 02                	jmp    80314f <devpipe_read+0x6e>
+  80314d:	89 f8                	mov    %edi,%eax
+  80314f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803152:	5b                   	pop    %ebx
+  803153:	5e                   	pop    %esi
+  803154:	5f                   	pop    %edi
+  803155:	5d                   	pop    %ebp
+  803156:	c3                   	ret
+  803157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315c:	eb f1                	jmp    80314f <devpipe_read+0x6e>
+
+0080315e <pipe>:
+  80315e:	55                   	push   %ebp
+  80315f:	89 e5                	mov    %esp,%ebp
+  803161:	56                   	push   %esi
+  803162:	53                   	push   %ebx
+  803163:	83 ec 1c             	sub    $0x1c,%esp
+  803166:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803169:	50                   	push   %eax
+  80316a:	e8 86 ed ff ff       	call   801ef5 <fd_alloc>
+  80316f:	89 c3                	mov    %eax,%ebx
+  803171:	83 c4 10             	add    $0x10,%esp
+  803174:	85 c0                	test   %eax,%eax
+  803176:	0f 88 23 01 00 00    	js     80329f <pipe+0x141>
+  80317c:	83 ec 04             	sub    $0x4,%esp
+  80317f:	68 07 04 00 00       	push   $0x407
+  803184:	ff 75 f4             	push   -0xc(%ebp)
+  803187:	6a 00                	push   $0x0
+  803189:	e8 34 dd ff ff       	call   800ec2 <sys_page_alloc>
+  80318e:	89 c3                	mov    %eax,%ebx
+  803190:	83 c4 10             	add    $0x10,%esp
+  803193:	85 c0                	test   %eax,%eax
+  803195:	0f 88 04 01 00 00    	js     80329f <pipe+0x141>
+  80319b:	83 ec 0c             	sub    $0xc,%esp
+  80319e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031a1:	50                   	push   %eax
+  8031a2:	e8 4e ed ff ff       	call   801ef5 <fd_alloc>
+  8031a7:	89 c3                	mov    %eax,%ebx
+  8031a9:	83 c4 10             	add    $0x10,%esp
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	0f 88 db 00 00 00    	js     80328f <pipe+0x131>
+  8031b4:	83 ec 04             	sub    $0x4,%esp
+  8031b7:	68 07 04 00 00       	push   $0x407
+  8031bc:	ff 75 f0             	push   -0x10(%ebp)
+  8031bf:	6a 00                	push   $0x0
+  8031c1:	e8 fc dc ff ff       	call   800ec2 <sys_page_alloc>
+  8031c6:	89 c3                	mov    %eax,%ebx
+  8031c8:	83 c4 10             	add    $0x10,%esp
+  8031cb:	85 c0                	test   %eax,%eax
+  8031cd:	0f 88 bc 00 00 00    	js     80328f <pipe+0x131>
+  8031d3:	83 ec 0c             	sub    $0xc,%esp
+  8031d6:	ff 75 f4             	push   -0xc(%ebp)
+  8031d9:	e8 00 ed ff ff       	call   801ede <fd2data>
+  8031de:	89 c6                	mov    %eax,%esi
+  8031e0:	83 c4 0c             	add    $0xc,%esp
+  8031e3:	68 07 04 00 00       	push   $0x407
+  8031e8:	50                   	push   %eax
+  8031e9:	6a 00                	push   $0x0
+  8031eb:	e8 d2 dc ff ff       	call   800ec2 <sys_page_alloc>
+  8031f0:	89 c3                	mov    %eax,%ebx
+  8031f2:	83 c4 10             	add    $0x10,%esp
+  8031f5:	85 c0                	test   %eax,%eax
+  8031f7:	0f 88 82 00 00 00    	js     80327f <pipe+0x121>
+  8031fd:	83 ec 0c             	sub    $0xc,%esp
+  803200:	ff 75 f0             	push   -0x10(%ebp)
+  803203:	e8 d6 ec ff ff       	call   801ede <fd2data>
+  803208:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80320f:	50                   	push   %eax
+  803210:	6a 00                	push   $0x0
+  803212:	56                   	push   %esi
+  803213:	6a 00                	push   $0x0
+  803215:	e8 eb dc ff ff       	call   800f05 <sys_page_map>
+  80321a:	89 c3                	mov    %eax,%ebx
+  80321c:	83 c4 20             	add    $0x20,%esp
+  80321f:	85 c0                	test   %eax,%eax
+  803221:	78 4e                	js     803271 <pipe+0x113>
+  803223:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  803228:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80322b:	89 02                	mov    %eax,(%edx)
+  80322d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803230:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803237:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80323a:	89 02                	mov    %eax,(%edx)
+  80323c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80323f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803246:	83 ec 0c             	sub    $0xc,%esp
+  803249:	ff 75 f4             	push   -0xc(%ebp)
+  80324c:	e8 7d ec ff ff       	call   801ece <fd2num>
+  803251:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803254:	89 01                	mov    %eax,(%ecx)
+  803256:	83 c4 04             	add    $0x4,%esp
+  803259:	ff 75 f0             	push   -0x10(%ebp)
+  80325c:	e8 6d ec ff ff       	call   801ece <fd2num>
+  803261:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803264:	89 41 04             	mov    %eax,0x4(%ecx)
+  803267:	83 c4 10             	add    $0x10,%esp
+  80326a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80326f:	eb 2e                	jmp    80329f <pipe+0x141>
+  803271:	83 ec 08             	sub    $0x8,%esp
+  803274:	56                   	push   %esi
+  803275:	6a 00                	push   $0x0
+  803277:	e8 18 dd ff ff       	call   800f94 <sys_page_unmap>
+  80327c:	83 c4 10             	add    $0x10,%esp
+  80327f:	83 ec 08             	sub    $0x8,%esp
+  803282:	ff 75 f0             	push   -0x10(%ebp)
+  803285:	6a 00                	push   $0x0
+  803287:	e8 08 dd ff ff       	call   800f94 <sys_page_unmap>
+  80328c:	83 c4 10             	add    $0x10,%esp
+  80328f:	83 ec 08             	sub    $0x8,%esp
+  803292:	ff 75 f4             	push   -0xc(%ebp)
+  803295:	6a 00                	push   $0x0
+  803297:	e8 f8 dc ff ff       	call   800f94 <sys_page_unmap>
+  80329c:	83 c4 10             	add    $0x10,%esp
+  80329f:	89 d8                	mov    %ebx,%eax
+  8032a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a4:	5b                   	pop    %ebx
+  8032a5:	5e                   	pop    %esi
+  8032a6:	5d                   	pop    %ebp
+  8032a7:	c3                   	ret
+
+008032a8 <pipeisclosed>:
+  8032a8:	55                   	push   %ebp
+  8032a9:	89 e5                	mov    %esp,%ebp
+  8032ab:	83 ec 20             	sub    $0x20,%esp
+  8032ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032b1:	50                   	push   %eax
+  8032b2:	ff 75 08             	push   0x8(%ebp)
+  8032b5:	e8 8b ec ff ff       	call   801f45 <fd_lookup>
+  8032ba:	83 c4 10             	add    $0x10,%esp
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	78 18                	js     8032d9 <pipeisclosed+0x31>
+  8032c1:	83 ec 0c             	sub    $0xc,%esp
+  8032c4:	ff 75 f4             	push   -0xc(%ebp)
+  8032c7:	e8 12 ec ff ff       	call   801ede <fd2data>
+  8032cc:	89 c2                	mov    %eax,%edx
+  8032ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032d1:	e8 16 fd ff ff       	call   802fec <_pipeisclosed>
+  8032d6:	83 c4 10             	add    $0x10,%esp
+  8032d9:	c9                   	leave
+  8032da:	c3                   	ret
+
+008032db <ipcring_init>:
+  8032db:	55                   	push   %ebp
+  8032dc:	89 e5                	mov    %esp,%ebp
+  8032de:	53                   	push   %ebx
+  8032df:	83 ec 08             	sub    $0x8,%esp
+  8032e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8032e5:	6a 60                	push   $0x60
+  8032e7:	6a 00                	push   $0x0
+  8032e9:	53                   	push   %ebx
+  8032ea:	e8 ee d8 ff ff       	call   800bdd <memset>
+  8032ef:	a1 14 60 80 00       	mov    0x806014,%eax
+  8032f4:	8b 40 48             	mov    0x48(%eax),%eax
+  8032f7:	89 03                	mov    %eax,(%ebx)
+  8032f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032fc:	89 43 04             	mov    %eax,0x4(%ebx)
+  8032ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  803302:	89 43 08             	mov    %eax,0x8(%ebx)
+  803305:	8b 45 14             	mov    0x14(%ebp),%eax
+  803308:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80330b:	83 c4 10             	add    $0x10,%esp
+  80330e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803311:	c9                   	leave
+  803312:	c3                   	ret
+
+00803313 <ipcring_req_slot>:
+  803313:	55                   	push   %ebp
+  803314:	89 e5                	mov    %esp,%ebp
+  803316:	8b 45 08             	mov    0x8(%ebp),%eax
+  803319:	8b 50 10             	mov    0x10(%eax),%edx
+  80331c:	8b 48 18             	mov    0x18(%eax),%ecx
+  80331f:	29 ca                	sub    %ecx,%edx
+  803321:	83 fa 07             	cmp    $0x7,%edx
+  803324:	77 0c                	ja     803332 <ipcring_req_slot+0x1f>
+  803326:	8b 50 10             	mov    0x10(%eax),%edx
+  803329:	83 e2 07             	and    $0x7,%edx
+  80332c:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803330:	5d                   	pop    %ebp
+  803331:	c3                   	ret
+  803332:	b8 00 00 00 00       	mov    $0x0,%eax
+  803337:	eb f7                	jmp    803330 <ipcring_req_slot+0x1d>
+
+00803339 <ipcring_req_push>:
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	83 ec 08             	sub    $0x8,%esp
+  80333f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803342:	8b 42 10             	mov    0x10(%edx),%eax
+  803345:	83 c0 01             	add    $0x1,%eax
+  803348:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  80334c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803351:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803355:	85 c0                	test   %eax,%eax
+  803357:	75 02                	jne    80335b <ipcring_req_push+0x22>
+  803359:	c9                   	leave
+  80335a:	c3                   	ret
+  80335b:	6a 00                	push   $0x0
+  80335d:	68 00 00 80 ee       	push   $0xee800000
+  803362:	ff 72 08             	push   0x8(%edx)
+  803365:	ff 72 04             	push   0x4(%edx)
+  803368:	e8 8d de ff ff       	call   8011fa <sys_ipc_send>
+  80336d:	83 c4 10             	add    $0x10,%esp
+  803370:	eb e7                	jmp    803359 <ipcring_req_push+0x20>
+
+00803372 <ipcring_rsp_wait>:
+  803372:	55                   	push   %ebp
+  803373:	89 e5                	mov    %esp,%ebp
+  803375:	53                   	push   %ebx
+  803376:	83 ec 04             	sub    $0x4,%esp
+  803379:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80337c:	8b 53 18             	mov    0x18(%ebx),%edx
+  80337f:	8b 43 10             	mov    0x10(%ebx),%eax
+  803382:	39 c2                	cmp    %eax,%edx
+  803384:	74 3c                	je     8033c2 <ipcring_rsp_wait+0x50>
+  803386:	8b 53 14             	mov    0x14(%ebx),%edx
+  803389:	8b 43 18             	mov    0x18(%ebx),%eax
+  80338c:	39 c2                	cmp    %eax,%edx
+  80338e:	75 23                	jne    8033b3 <ipcring_rsp_wait+0x41>
+  803390:	83 ec 08             	sub    $0x8,%esp
+  803393:	6a 00                	push   $0x0
+  803395:	6a 00                	push   $0x0
+  803397:	6a 00                	push   $0x0
+  803399:	6a 00                	push   $0x0
+  80339b:	ff 73 0c             	push   0xc(%ebx)
+  80339e:	ff 73 04             	push   0x4(%ebx)
+  8033a1:	e8 73 e9 ff ff       	call   801d19 <ipc_call>
+  8033a6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8033a9:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033ac:	83 c4 20             	add    $0x20,%esp
+  8033af:	39 c2                	cmp    %eax,%edx
+  8033b1:	74 dd                	je     803390 <ipcring_rsp_wait+0x1e>
+  8033b3:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033b6:	83 e0 07             	and    $0x7,%eax
+  8033b9:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8033bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033c0:	c9                   	leave
+  8033c1:	c3                   	ret
+  8033c2:	68 cc 3f 80 00       	push   $0x803fcc
+  8033c7:	68 7d 3f 80 00       	push   $0x803f7d
+  8033cc:	6a 3b                	push   $0x3b
+  8033ce:	68 ed 3f 80 00       	push   $0x803fed
+  8033d3:	e8 b8 ce ff ff       	call   800290 <_panic>
+
+008033d8 <ipcring_rsp_pop>:
+  8033d8:	55                   	push   %ebp
+  8033d9:	89 e5                	mov    %esp,%ebp
+  8033db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033de:	8b 42 18             	mov    0x18(%edx),%eax
+  8033e1:	83 c0 01             	add    $0x1,%eax
+  8033e4:	89 42 18             	mov    %eax,0x18(%edx)
+  8033e7:	5d                   	pop    %ebp
+  8033e8:	c3                   	ret
+
+008033e9 <ipcring_server_init>:
+  8033e9:	55                   	push   %ebp
+  8033ea:	89 e5                	mov    %esp,%ebp
+  8033ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033f2:	89 10                	mov    %edx,(%eax)
+  8033f4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033f7:	89 50 04             	mov    %edx,0x4(%eax)
+  8033fa:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803401:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803408:	5d                   	pop    %ebp
+  803409:	c3                   	ret
+
+0080340a <ipcring_req_avail>:
+  80340a:	55                   	push   %ebp
+  80340b:	89 e5                	mov    %esp,%ebp
+  80340d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803410:	8b 02                	mov    (%edx),%eax
+  803412:	8b 40 10             	mov    0x10(%eax),%eax
+  803415:	2b 42 08             	sub    0x8(%edx),%eax
+  803418:	ba 08 00 00 00       	mov    $0x8,%edx
+  80341d:	39 d0                	cmp    %edx,%eax
+  80341f:	0f 47 c2             	cmova  %edx,%eax
+  803422:	5d                   	pop    %ebp
+  803423:	c3                   	ret
+
+00803424 <ipcring_req_peek>:
+  803424:	55                   	push   %ebp
+  803425:	89 e5                	mov    %esp,%ebp
+  803427:	8b 55 08             	mov    0x8(%ebp),%edx
+  80342a:	8b 42 08             	mov    0x8(%edx),%eax
+  80342d:	83 e0 07             	and    $0x7,%eax
+  803430:	8b 12                	mov    (%edx),%edx
+  803432:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803436:	5d                   	pop    %ebp
+  803437:	c3                   	ret
+
+00803438 <ipcring_rsp_push>:
+  803438:	55                   	push   %ebp
+  803439:	89 e5                	mov    %esp,%ebp
+  80343b:	83 ec 08             	sub    $0x8,%esp
+  80343e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803441:	8b 41 08             	mov    0x8(%ecx),%eax
+  803444:	83 c0 01             	add    $0x1,%eax
+  803447:	89 41 08             	mov    %eax,0x8(%ecx)
+  80344a:	8b 11                	mov    (%ecx),%edx
+  80344c:	83 c2 14             	add    $0x14,%edx
+  80344f:	f0 87 02             	lock xchg %eax,(%edx)
+  803452:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803456:	75 02                	jne    80345a <ipcring_rsp_push+0x22>
+  803458:	c9                   	leave
+  803459:	c3                   	ret
+  80345a:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803461:	6a 00                	push   $0x0
+  803463:	68 00 00 80 ee       	push   $0xee800000
+  803468:	6a 00                	push   $0x0
+  80346a:	ff 71 04             	push   0x4(%ecx)
+  80346d:	e8 ab dc ff ff       	call   80111d <sys_ipc_try_send>
+  803472:	83 c4 10             	add    $0x10,%esp
+  803475:	eb e1                	jmp    803458 <ipcring_rsp_push+0x20>
+
+00803477 <ipcring_client_wait>:
+  803477:	55                   	push   %ebp
+  803478:	89 e5                	mov    %esp,%ebp
+  80347a:	83 ec 08             	sub    $0x8,%esp
+  80347d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803480:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803487:	8b 10                	mov    (%eax),%edx
+  803489:	8b 52 18             	mov    0x18(%edx),%edx
+  80348c:	3b 50 08             	cmp    0x8(%eax),%edx
+  80348f:	75 02                	jne    803493 <ipcring_client_wait+0x1c>
+  803491:	c9                   	leave
+  803492:	c3                   	ret
+  803493:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80349a:	6a 00                	push   $0x0
+  80349c:	68 00 00 80 ee       	push   $0xee800000
+  8034a1:	6a 00                	push   $0x0
+  8034a3:	ff 70 04             	push   0x4(%eax)
+  8034a6:	e8 72 dc ff ff       	call   80111d <sys_ipc_try_send>
+  8034ab:	83 c4 10             	add    $0x10,%esp
+  8034ae:	eb e1                	jmp    803491 <ipcring_client_wait+0x1a>
+
+008034b0 <ipcring_server_sleep>:
+  8034b0:	55                   	push   %ebp
+  8034b1:	89 e5                	mov    %esp,%ebp
+  8034b3:	53                   	push   %ebx
+  8034b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034b7:	8b 01                	mov    (%ecx),%eax
+  8034b9:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8034bc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034c1:	f0 87 02             	lock xchg %eax,(%edx)
+  8034c4:	8b 11                	mov    (%ecx),%edx
+  8034c6:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8034c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034ce:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8034d1:	74 0e                	je     8034e1 <ipcring_server_sleep+0x31>
+  8034d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d8:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8034dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034e4:	c9                   	leave
+  8034e5:	c3                   	ret
+
+008034e6 <devcons_close>:
+  8034e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034eb:	c3                   	ret
+
+008034ec <devcons_stat>:
+  8034ec:	55                   	push   %ebp
+  8034ed:	89 e5                	mov    %esp,%ebp
+  8034ef:	83 ec 10             	sub    $0x10,%esp
+  8034f2:	68 fb 3f 80 00       	push   $0x803ffb
+  8034f7:	ff 75 0c             	push   0xc(%ebp)
+  8034fa:	e8 63 d5 ff ff       	call   800a62 <strcpy>
+  8034ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803504:	c9                   	leave
+  803505:	c3                   	ret
+
+00803506 <devcons_write>:
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	57                   	push   %edi
+  80350a:	56                   	push   %esi
+  80350b:	53                   	push   %ebx
+  80350c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803512:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803515:	85 ff                	test   %edi,%edi
+  803517:	74 51                	je     80356a <devcons_write+0x64>
+  803519:	be 00 00 00 00       	mov    $0x0,%esi
+  80351e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803523:	89 fb                	mov    %edi,%ebx
+  803525:	29 c3                	sub    %eax,%ebx
+  803527:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80352c:	39 d3                	cmp    %edx,%ebx
+  80352e:	0f 47 da             	cmova  %edx,%ebx
+  803531:	83 ec 04             	sub    $0x4,%esp
+  803534:	53                   	push   %ebx
+  803535:	03 45 0c             	add    0xc(%ebp),%eax
+  803538:	50                   	push   %eax
+  803539:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80353f:	50                   	push   %eax
+  803540:	e8 cd d6 ff ff       	call   800c12 <memmove>
+  803545:	83 c4 08             	add    $0x8,%esp
+  803548:	53                   	push   %ebx
+  803549:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80354f:	50                   	push   %eax
+  803550:	e8 85 d8 ff ff       	call   800dda <sys_cputs>
+  803555:	01 de                	add    %ebx,%esi
+  803557:	89 f0                	mov    %esi,%eax
+  803559:	83 c4 10             	add    $0x10,%esp
+  80355c:	39 fe                	cmp    %edi,%esi
+  80355e:	72 c3                	jb     803523 <devcons_write+0x1d>
+  803560:	89 f0                	mov    %esi,%eax
+  803562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803565:	5b                   	pop    %ebx
+  803566:	5e                   	pop    %esi
+  803567:	5f                   	pop    %edi
+  803568:	5d                   	pop    %ebp
+  803569:	c3                   	ret
+  80356a:	be 00 00 00 00       	mov    $0x0,%esi
+  80356f:	eb ef                	jmp    803560 <devcons_write+0x5a>
+
+00803571 <devcons_read>:
+  803571:	55                   	push   %ebp
+  803572:	89 e5                	mov    %esp,%ebp
+  803574:	83 ec 08             	sub    $0x8,%esp
+  803577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803580:	75 07                	jne    803589 <devcons_read+0x18>
+  803582:	eb 1f                	jmp    8035a3 <devcons_read+0x32>
+  803584:	e8 ee d8 ff ff       	call   800e77 <sys_yield>
+  803589:	e8 6a d8 ff ff       	call   800df8 <sys_cgetc>
+  80358e:	85 c0                	test   %eax,%eax
+  803590:	74 f2                	je     803584 <devcons_read+0x13>
+  803592:	78 0f                	js     8035a3 <devcons_read+0x32>
+  803594:	83 f8 04             	cmp    $0x4,%eax
+  803597:	74 0c                	je     8035a5 <devcons_read+0x34>
+  803599:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80359c:	88 02                	mov    %al,(%edx)
+  80359e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035a3:	c9                   	leave
+  8035a4:	c3                   	ret
+  8035a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035aa:	eb f7                	jmp    8035a3 <devcons_read+0x32>
+
+008035ac <cputchar>:
+  8035ac:	55                   	push   %ebp
+  8035ad:	89 e5                	mov    %esp,%ebp
+  8035af:	83 ec 20             	sub    $0x20,%esp
+  8035b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b5:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8035b8:	6a 01                	push   $0x1
+  8035ba:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035bd:	50                   	push   %eax
+  8035be:	e8 17 d8 ff ff       	call   800dda <sys_cputs>
+  8035c3:	83 c4 10             	add    $0x10,%esp
+  8035c6:	c9                   	leave
+  8035c7:	c3                   	ret
+
+008035c8 <getchar>:
+  8035c8:	55                   	push   %ebp
+  8035c9:	89 e5                	mov    %esp,%ebp
+  8035cb:	83 ec 1c             	sub    $0x1c,%esp
+  8035ce:	6a 01                	push   $0x1
+  8035d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035d3:	50                   	push   %eax
+  8035d4:	6a 00                	push   $0x0
+  8035d6:	e8 cc eb ff ff       	call   8021a7 <read>
+  8035db:	83 c4 10             	add    $0x10,%esp
+  8035de:	85 c0                	test   %eax,%eax
+  8035e0:	78 06                	js     8035e8 <getchar+0x20>
+  8035e2:	74 06                	je     8035ea <getchar+0x22>
+  8035e4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8035e8:	c9                   	leave
+  8035e9:	c3                   	ret
+  8035ea:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8035ef:	eb f7                	jmp    8035e8 <getchar+0x20>
+
+008035f1 <iscons>:
+  8035f1:	55                   	push   %ebp
+  8035f2:	89 e5                	mov    %esp,%ebp
+  8035f4:	83 ec 20             	sub    $0x20,%esp
+  8035f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035fa:	50                   	push   %eax
+  8035fb:	ff 75 08             	push   0x8(%ebp)
+  8035fe:	e8 42 e9 ff ff       	call   801f45 <fd_lookup>
+  803603:	83 c4 10             	add    $0x10,%esp
+  803606:	85 c0                	test   %eax,%eax
+  803608:	78 11                	js     80361b <iscons+0x2a>
+  80360a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80360d:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803613:	39 10                	cmp    %edx,(%eax)
+  803615:	0f 94 c0             	sete   %al
+  803618:	0f b6 c0             	movzbl %al,%eax
+  80361b:	c9                   	leave
+  80361c:	c3                   	ret
+
+0080361d <opencons>:
+  80361d:	55                   	push   %ebp
+  80361e:	89 e5                	mov    %esp,%ebp
+  803620:	83 ec 24             	sub    $0x24,%esp
+  803623:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803626:	50                   	push   %eax
+  803627:	e8 c9 e8 ff ff       	call   801ef5 <fd_alloc>
+  80362c:	83 c4 10             	add    $0x10,%esp
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	78 3a                	js     80366d <opencons+0x50>
+  803633:	83 ec 04             	sub    $0x4,%esp
+  803636:	68 07 04 00 00       	push   $0x407
+  80363b:	ff 75 f4             	push   -0xc(%ebp)
+  80363e:	6a 00                	push   $0x0
+  803640:	e8 7d d8 ff ff       	call   800ec2 <sys_page_alloc>
+  803645:	83 c4 10             	add    $0x10,%esp
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	78 21                	js     80366d <opencons+0x50>
+  80364c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80364f:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803655:	89 10                	mov    %edx,(%eax)
+  803657:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80365a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803661:	83 ec 0c             	sub    $0xc,%esp
+  803664:	50                   	push   %eax
+  803665:	e8 64 e8 ff ff       	call   801ece <fd2num>
+  80366a:	83 c4 10             	add    $0x10,%esp
+  80366d:	c9                   	leave
+  80366e:	c3                   	ret
+
+0080366f <set_pgfault_handler>:
+  80366f:	55                   	push   %ebp
+  803670:	89 e5                	mov    %esp,%ebp
+  803672:	53                   	push   %ebx
+  803673:	83 ec 04             	sub    $0x4,%esp
+  803676:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80367d:	74 0d                	je     80368c <set_pgfault_handler+0x1d>
+  80367f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803682:	a3 00 90 80 00       	mov    %eax,0x809000
+  803687:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80368a:	c9                   	leave
+  80368b:	c3                   	ret
+  80368c:	e8 c7 d7 ff ff       	call   800e58 <sys_getenvid>
+  803691:	89 c3                	mov    %eax,%ebx
+  803693:	83 ec 04             	sub    $0x4,%esp
+  803696:	6a 07                	push   $0x7
+  803698:	68 00 f0 7f ee       	push   $0xee7ff000
+  80369d:	50                   	push   %eax
+  80369e:	e8 1f d8 ff ff       	call   800ec2 <sys_page_alloc>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	78 29                	js     8036d3 <set_pgfault_handler+0x64>
+  8036aa:	83 ec 08             	sub    $0x8,%esp
+  8036ad:	68 e7 36 80 00       	push   $0x8036e7
+  8036b2:	53                   	push   %ebx
+  8036b3:	e8 23 da ff ff       	call   8010db <sys_env_set_pgfault_upcall>
+  8036b8:	83 c4 10             	add    $0x10,%esp
+  8036bb:	85 c0                	test   %eax,%eax
+  8036bd:	79 c0                	jns    80367f <set_pgfault_handler+0x10>
+  8036bf:	83 ec 04             	sub    $0x4,%esp
+  8036c2:	68 40 40 80 00       	push   $0x804040
+  8036c7:	6a 27                	push   $0x27
+  8036c9:	68 72 40 80 00       	push   $0x804072
+  8036ce:	e8 bd cb ff ff       	call   800290 <_panic>
+  8036d3:	83 ec 04             	sub    $0x4,%esp
+  8036d6:	68 08 40 80 00       	push   $0x804008
+  8036db:	6a 23                	push   $0x23
+  8036dd:	68 72 40 80 00       	push   $0x804072
+  8036e2:	e8 a9 cb ff ff       	call   800290 <_panic>
+
+008036e7 <_pgfault_upcall>:
+  8036e7:	54                   	push   %esp
+  8036e8:	a1 00 90 80 00       	mov    0x809000,%eax
+  8036ed:	ff d0                	call   *%eax
+  8036ef:	83 c4 04             	add    $0x4,%esp
+  8036f2:	89 e3                	mov    %esp,%ebx
+  8036f4:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8036f8:	8b 54 24 30          	mov    0x30(%esp),%edx
+  8036fc:	89 d4                	mov    %edx,%esp
+  8036fe:	51                   	push   %ecx
+  8036ff:	89 dc                	mov    %ebx,%esp
+  803701:	83 ea 04             	sub    $0x4,%edx
+  803704:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803708:	83 c4 08             	add    $0x8,%esp
+  80370b:	61                   	popa
+  80370c:	83 c4 04             	add    $0x4,%esp
+  80370f:	9d                   	popf
+  803710:	5c                   	pop    %esp
+  803711:	c3                   	ret
+
+00803712 <__udivmoddi4>:
+  803712:	55                   	push   %ebp
+  803713:	57                   	push   %edi
+  803714:	56                   	push   %esi
+  803715:	53                   	push   %ebx
+  803716:	83 ec 24             	sub    $0x24,%esp
+  803719:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80371d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803721:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803725:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803729:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80372d:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803731:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803735:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803739:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80373d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803742:	ba 00 00 00 00       	mov    $0x0,%edx
+  803747:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80374c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803753:	00 
+  803754:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80375b:	00 
+  80375c:	89 fb                	mov    %edi,%ebx
+  80375e:	eb 08                	jmp    803768 <__udivmoddi4+0x56>
+  803760:	83 e9 01             	sub    $0x1,%ecx
+  803763:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803766:	74 68                	je     8037d0 <__udivmoddi4+0xbe>
+  803768:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80376c:	01 c0                	add    %eax,%eax
+  80376e:	89 c6                	mov    %eax,%esi
+  803770:	89 d7                	mov    %edx,%edi
+  803772:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803776:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80377a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80377d:	d3 ea                	shr    %cl,%edx
+  80377f:	f6 c1 20             	test   $0x20,%cl
+  803782:	74 04                	je     803788 <__udivmoddi4+0x76>
+  803784:	89 d0                	mov    %edx,%eax
+  803786:	31 d2                	xor    %edx,%edx
+  803788:	83 e0 01             	and    $0x1,%eax
+  80378b:	89 04 24             	mov    %eax,(%esp)
+  80378e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803795:	00 
+  803796:	8b 04 24             	mov    (%esp),%eax
+  803799:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80379d:	09 f0                	or     %esi,%eax
+  80379f:	09 fa                	or     %edi,%edx
+  8037a1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8037a5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8037a9:	39 f0                	cmp    %esi,%eax
+  8037ab:	89 d5                	mov    %edx,%ebp
+  8037ad:	19 fd                	sbb    %edi,%ebp
+  8037af:	72 af                	jb     803760 <__udivmoddi4+0x4e>
+  8037b1:	29 f0                	sub    %esi,%eax
+  8037b3:	19 fa                	sbb    %edi,%edx
+  8037b5:	89 cf                	mov    %ecx,%edi
+  8037b7:	c1 ef 05             	shr    $0x5,%edi
+  8037ba:	83 e7 01             	and    $0x1,%edi
+  8037bd:	89 fe                	mov    %edi,%esi
+  8037bf:	83 f6 01             	xor    $0x1,%esi
+  8037c2:	d3 e6                	shl    %cl,%esi
+  8037c4:	d3 e7                	shl    %cl,%edi
+  8037c6:	09 74 24 18          	or     %esi,0x18(%esp)
+  8037ca:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8037ce:	eb 90                	jmp    803760 <__udivmoddi4+0x4e>
+  8037d0:	85 db                	test   %ebx,%ebx
+  8037d2:	74 05                	je     8037d9 <__udivmoddi4+0xc7>
+  8037d4:	89 03                	mov    %eax,(%ebx)
+  8037d6:	89 53 04             	mov    %edx,0x4(%ebx)
+  8037d9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037dd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037e1:	83 c4 24             	add    $0x24,%esp
+  8037e4:	5b                   	pop    %ebx
+  8037e5:	5e                   	pop    %esi
+  8037e6:	5f                   	pop    %edi
+  8037e7:	5d                   	pop    %ebp
+  8037e8:	c3                   	ret
+
+008037e9 <__udivdi3>:
+  8037e9:	83 ec 08             	sub    $0x8,%esp
+  8037ec:	6a 00                	push   $0x0
+  8037ee:	ff 74 24 1c          	push   0x1c(%esp)
+  8037f2:	ff 74 24 1c          	push   0x1c(%esp)
+  8037f6:	ff 74 24 1c          	push   0x1c(%esp)
+  8037fa:	ff 74 24 1c          	push   0x1c(%esp)
+  8037fe:	e8 0f ff ff ff       	call   803712 <__udivmoddi4>
+  803803:	83 c4 1c             	add    $0x1c,%esp
+  803806:	c3                   	ret
+
+00803807 <__umoddi3>:
+  803807:	83 ec 18             	sub    $0x18,%esp
+  80380a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80380e:	50                   	push   %eax
+  80380f:	ff 74 24 2c          	push   0x2c(%esp)
+  803813:	ff 74 24 2c          	push   0x2c(%esp)
+  803817:	ff 74 24 2c          	push   0x2c(%esp)
+  80381b:	ff 74 24 2c          	push   0x2c(%esp)
+  80381f:	e8 ee fe ff ff       	call   803712 <__udivmoddi4>
+  803824:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803828:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80382c:	83 c4 2c             	add    $0x2c,%esp
+  80382f:	c3                   	ret
+
+00803830 <__divdi3>:
+  803830:	53                   	push   %ebx
+  803831:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803835:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803839:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80383d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803841:	85 d2                	test   %edx,%edx
+  803843:	78 12                	js     803857 <__divdi3+0x27>
+  803845:	85 db                	test   %ebx,%ebx
+  803847:	78 2e                	js     803877 <__divdi3+0x47>
+  803849:	53                   	push   %ebx
+  80384a:	51                   	push   %ecx
+  80384b:	52                   	push   %edx
+  80384c:	50                   	push   %eax
+  80384d:	e8 97 ff ff ff       	call   8037e9 <__udivdi3>
+  803852:	83 c4 10             	add    $0x10,%esp
+  803855:	eb 1e                	jmp    803875 <__divdi3+0x45>
+  803857:	f7 d8                	neg    %eax
+  803859:	83 d2 00             	adc    $0x0,%edx
+  80385c:	f7 da                	neg    %edx
+  80385e:	85 db                	test   %ebx,%ebx
+  803860:	78 2a                	js     80388c <__divdi3+0x5c>
+  803862:	53                   	push   %ebx
+  803863:	51                   	push   %ecx
+  803864:	52                   	push   %edx
+  803865:	50                   	push   %eax
+  803866:	e8 7e ff ff ff       	call   8037e9 <__udivdi3>
+  80386b:	83 c4 10             	add    $0x10,%esp
+  80386e:	f7 d8                	neg    %eax
+  803870:	83 d2 00             	adc    $0x0,%edx
+  803873:	f7 da                	neg    %edx
+  803875:	5b                   	pop    %ebx
+  803876:	c3                   	ret
+  803877:	f7 d9                	neg    %ecx
+  803879:	83 d3 00             	adc    $0x0,%ebx
+  80387c:	f7 db                	neg    %ebx
+  80387e:	53                   	push   %ebx
+  80387f:	51                   	push   %ecx
+  803880:	52                   	push   %edx
+  803881:	50                   	push   %eax
+  803882:	e8 62 ff ff ff       	call   8037e9 <__udivdi3>
+  803887:	83 c4 10             	add    $0x10,%esp
+  80388a:	eb e2                	jmp    80386e <__divdi3+0x3e>
+  80388c:	f7 d9                	neg    %ecx
+  80388e:	83 d3 00             	adc    $0x0,%ebx
+  803891:	f7 db                	neg    %ebx
+  803893:	53                   	push   %ebx
+  803894:	51                   	push   %ecx
+  803895:	52                   	push   %edx
+  803896:	50                   	push   %eax
+  803897:	e8 4d ff ff ff       	call   8037e9 <__udivdi3>
+  80389c:	83 c4 10             	add    $0x10,%esp
+  80389f:	eb d4                	jmp    803875 <__divdi3+0x45>
+
+008038a1 <__moddi3>:
+  8038a1:	55                   	push   %ebp
+  8038a2:	57                   	push   %edi
+  8038a3:	56                   	push   %esi
+  8038a4:	53                   	push   %ebx
+  8038a5:	83 ec 0c             	sub    $0xc,%esp
+  8038a8:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8038ac:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8038b0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038b4:	89 e9                	mov    %ebp,%ecx
+  8038b6:	f7 d9                	neg    %ecx
+  8038b8:	89 d0                	mov    %edx,%eax
+  8038ba:	83 d0 00             	adc    $0x0,%eax
+  8038bd:	f7 d8                	neg    %eax
+  8038bf:	0f 49 e9             	cmovns %ecx,%ebp
+  8038c2:	0f 49 d0             	cmovns %eax,%edx
+  8038c5:	52                   	push   %edx
+  8038c6:	55                   	push   %ebp
+  8038c7:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8038cb:	f7 da                	neg    %edx
+  8038cd:	89 d8                	mov    %ebx,%eax
+  8038cf:	83 d0 00             	adc    $0x0,%eax
+  8038d2:	f7 d8                	neg    %eax
+  8038d4:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8038d9:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8038dd:	0f 48 c3             	cmovs  %ebx,%eax
+  8038e0:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8038e4:	ff 74 24 0c          	push   0xc(%esp)
+  8038e8:	ff 74 24 0c          	push   0xc(%esp)
+  8038ec:	e8 16 ff ff ff       	call   803807 <__umoddi3>
+  8038f1:	83 c4 10             	add    $0x10,%esp
+  8038f4:	85 db                	test   %ebx,%ebx
+  8038f6:	78 08                	js     803900 <__moddi3+0x5f>
+  8038f8:	83 c4 0c             	add    $0xc,%esp
+  8038fb:	5b                   	pop    %ebx
+  8038fc:	5e                   	pop    %esi
+  8038fd:	5f                   	pop    %edi
+  8038fe:	5d                   	pop    %ebp
+  8038ff:	c3                   	ret
+  803900:	f7 d8                	neg    %eax
+  803902:	83 d2 00             	adc    $0x0,%edx
+  803905:	f7 da                	neg    %edx
+  803907:	eb ef                	jmp    8038f8 <__moddi3+0x57>
@@ -0,0 +1,5617 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 a2 01 00 00       	call   8001d3 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+  80003c:	68 e0 38 80 00       	push   $0x8038e0
+  800041:	e8 e1 02 00 00       	call   800327 <cprintf>
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 1a 2e 00 00       	call   802e6b <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5e                	js     8000b6 <umain+0x83>
+  800058:	e8 6f 18 00 00       	call   8018cc <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 65                	js     8000c8 <umain+0x95>
+  800063:	74 75                	je     8000da <umain+0xa7>
+  800065:	89 fb                	mov    %edi,%ebx
+  800067:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80006d:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  800073:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800079:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007c:	83 f8 02             	cmp    $0x2,%eax
+  80007f:	0f 85 d1 00 00 00    	jne    800156 <umain+0x123>
+  800085:	83 ec 0c             	sub    $0xc,%esp
+  800088:	ff 75 e0             	push   -0x20(%ebp)
+  80008b:	e8 25 2f 00 00       	call   802fb5 <pipeisclosed>
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	85 c0                	test   %eax,%eax
+  800095:	74 e2                	je     800079 <umain+0x46>
+  800097:	83 ec 0c             	sub    $0xc,%esp
+  80009a:	68 59 39 80 00       	push   $0x803959
+  80009f:	e8 83 02 00 00       	call   800327 <cprintf>
+  8000a4:	89 3c 24             	mov    %edi,(%esp)
+  8000a7:	e8 27 0d 00 00       	call   800dd3 <sys_env_destroy>
+  8000ac:	e8 6b 01 00 00       	call   80021c <exit>
+  8000b1:	83 c4 10             	add    $0x10,%esp
+  8000b4:	eb c3                	jmp    800079 <umain+0x46>
+  8000b6:	50                   	push   %eax
+  8000b7:	68 2e 39 80 00       	push   $0x80392e
+  8000bc:	6a 0d                	push   $0xd
+  8000be:	68 37 39 80 00       	push   $0x803937
+  8000c3:	e8 84 01 00 00       	call   80024c <_panic>
+  8000c8:	50                   	push   %eax
+  8000c9:	68 4c 39 80 00       	push   $0x80394c
+  8000ce:	6a 0f                	push   $0xf
+  8000d0:	68 37 39 80 00       	push   $0x803937
+  8000d5:	e8 72 01 00 00       	call   80024c <_panic>
+  8000da:	83 ec 0c             	sub    $0xc,%esp
+  8000dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8000e0:	e8 d5 1c 00 00       	call   801dba <close>
+  8000e5:	83 c4 10             	add    $0x10,%esp
+  8000e8:	89 fb                	mov    %edi,%ebx
+  8000ea:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ef:	eb 31                	jmp    800122 <umain+0xef>
+  8000f1:	83 ec 08             	sub    $0x8,%esp
+  8000f4:	6a 0a                	push   $0xa
+  8000f6:	ff 75 e0             	push   -0x20(%ebp)
+  8000f9:	e8 0e 1d 00 00       	call   801e0c <dup>
+  8000fe:	e8 30 0d 00 00       	call   800e33 <sys_yield>
+  800103:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  80010a:	e8 ab 1c 00 00       	call   801dba <close>
+  80010f:	e8 1f 0d 00 00       	call   800e33 <sys_yield>
+  800114:	83 c3 01             	add    $0x1,%ebx
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  800120:	74 2a                	je     80014c <umain+0x119>
+  800122:	89 d8                	mov    %ebx,%eax
+  800124:	f7 ee                	imul   %esi
+  800126:	c1 fa 02             	sar    $0x2,%edx
+  800129:	89 d8                	mov    %ebx,%eax
+  80012b:	c1 f8 1f             	sar    $0x1f,%eax
+  80012e:	29 c2                	sub    %eax,%edx
+  800130:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800133:	01 c0                	add    %eax,%eax
+  800135:	39 c3                	cmp    %eax,%ebx
+  800137:	75 b8                	jne    8000f1 <umain+0xbe>
+  800139:	83 ec 08             	sub    $0x8,%esp
+  80013c:	53                   	push   %ebx
+  80013d:	68 55 39 80 00       	push   $0x803955
+  800142:	e8 e0 01 00 00       	call   800327 <cprintf>
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	eb a5                	jmp    8000f1 <umain+0xbe>
+  80014c:	e8 cb 00 00 00       	call   80021c <exit>
+  800151:	e9 0f ff ff ff       	jmp    800065 <umain+0x32>
+  800156:	83 ec 0c             	sub    $0xc,%esp
+  800159:	68 75 39 80 00       	push   $0x803975
+  80015e:	e8 c4 01 00 00       	call   800327 <cprintf>
+  800163:	83 c4 04             	add    $0x4,%esp
+  800166:	ff 75 e0             	push   -0x20(%ebp)
+  800169:	e8 47 2e 00 00       	call   802fb5 <pipeisclosed>
+  80016e:	83 c4 10             	add    $0x10,%esp
+  800171:	85 c0                	test   %eax,%eax
+  800173:	75 38                	jne    8001ad <umain+0x17a>
+  800175:	83 ec 08             	sub    $0x8,%esp
+  800178:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017b:	50                   	push   %eax
+  80017c:	ff 75 e0             	push   -0x20(%ebp)
+  80017f:	e8 10 1b 00 00       	call   801c94 <fd_lookup>
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	85 c0                	test   %eax,%eax
+  800189:	78 36                	js     8001c1 <umain+0x18e>
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	ff 75 dc             	push   -0x24(%ebp)
+  800191:	e8 97 1a 00 00       	call   801c2d <fd2data>
+  800196:	c7 04 24 a3 39 80 00 	movl   $0x8039a3,(%esp)
+  80019d:	e8 85 01 00 00       	call   800327 <cprintf>
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a8:	5b                   	pop    %ebx
+  8001a9:	5e                   	pop    %esi
+  8001aa:	5f                   	pop    %edi
+  8001ab:	5d                   	pop    %ebp
+  8001ac:	c3                   	ret
+  8001ad:	83 ec 04             	sub    $0x4,%esp
+  8001b0:	68 04 39 80 00       	push   $0x803904
+  8001b5:	6a 40                	push   $0x40
+  8001b7:	68 37 39 80 00       	push   $0x803937
+  8001bc:	e8 8b 00 00 00       	call   80024c <_panic>
+  8001c1:	50                   	push   %eax
+  8001c2:	68 8b 39 80 00       	push   $0x80398b
+  8001c7:	6a 42                	push   $0x42
+  8001c9:	68 37 39 80 00       	push   $0x803937
+  8001ce:	e8 79 00 00 00       	call   80024c <_panic>
+
+008001d3 <libmain>:
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	56                   	push   %esi
+  8001d7:	53                   	push   %ebx
+  8001d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001de:	e8 31 0c 00 00       	call   800e14 <sys_getenvid>
+  8001e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8001ee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f3:	a3 14 60 80 00       	mov    %eax,0x806014
+  8001f8:	85 db                	test   %ebx,%ebx
+  8001fa:	7e 07                	jle    800203 <libmain+0x30>
+  8001fc:	8b 06                	mov    (%esi),%eax
+  8001fe:	a3 00 50 80 00       	mov    %eax,0x805000
+  800203:	83 ec 08             	sub    $0x8,%esp
+  800206:	56                   	push   %esi
+  800207:	53                   	push   %ebx
+  800208:	e8 26 fe ff ff       	call   800033 <umain>
+  80020d:	e8 0a 00 00 00       	call   80021c <exit>
+  800212:	83 c4 10             	add    $0x10,%esp
+  800215:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800218:	5b                   	pop    %ebx
+  800219:	5e                   	pop    %esi
+  80021a:	5d                   	pop    %ebp
+  80021b:	c3                   	ret
+
+0080021c <exit>:
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	83 ec 08             	sub    $0x8,%esp
+  800222:	a1 14 60 80 00       	mov    0x806014,%eax
+  800227:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80022d:	85 c0                	test   %eax,%eax
+  80022f:	75 14                	jne    800245 <exit+0x29>
+  800231:	e8 b1 1b 00 00       	call   801de7 <close_all>
+  800236:	83 ec 0c             	sub    $0xc,%esp
+  800239:	6a 00                	push   $0x0
+  80023b:	e8 93 0b 00 00       	call   800dd3 <sys_env_destroy>
+  800240:	83 c4 10             	add    $0x10,%esp
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+  800245:	e8 f6 12 00 00       	call   801540 <sys_lease_complete>
+  80024a:	eb e5                	jmp    800231 <exit+0x15>
+
+0080024c <_panic>:
+  80024c:	55                   	push   %ebp
+  80024d:	89 e5                	mov    %esp,%ebp
+  80024f:	56                   	push   %esi
+  800250:	53                   	push   %ebx
+  800251:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800254:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80025a:	e8 b5 0b 00 00       	call   800e14 <sys_getenvid>
+  80025f:	83 ec 0c             	sub    $0xc,%esp
+  800262:	ff 75 0c             	push   0xc(%ebp)
+  800265:	ff 75 08             	push   0x8(%ebp)
+  800268:	56                   	push   %esi
+  800269:	50                   	push   %eax
+  80026a:	68 c4 39 80 00       	push   $0x8039c4
+  80026f:	e8 b3 00 00 00       	call   800327 <cprintf>
+  800274:	83 c4 18             	add    $0x18,%esp
+  800277:	53                   	push   %ebx
+  800278:	ff 75 10             	push   0x10(%ebp)
+  80027b:	e8 56 00 00 00       	call   8002d6 <vcprintf>
+  800280:	c7 04 24 f6 3e 80 00 	movl   $0x803ef6,(%esp)
+  800287:	e8 9b 00 00 00       	call   800327 <cprintf>
+  80028c:	83 c4 10             	add    $0x10,%esp
+  80028f:	cc                   	int3
+  800290:	eb fd                	jmp    80028f <_panic+0x43>
+
+00800292 <putch>:
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	53                   	push   %ebx
+  800296:	83 ec 04             	sub    $0x4,%esp
+  800299:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80029c:	8b 13                	mov    (%ebx),%edx
+  80029e:	8d 42 01             	lea    0x1(%edx),%eax
+  8002a1:	89 03                	mov    %eax,(%ebx)
+  8002a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002a6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8002aa:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002af:	74 09                	je     8002ba <putch+0x28>
+  8002b1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8002b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+  8002ba:	83 ec 08             	sub    $0x8,%esp
+  8002bd:	68 ff 00 00 00       	push   $0xff
+  8002c2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002c5:	50                   	push   %eax
+  8002c6:	e8 cb 0a 00 00       	call   800d96 <sys_cputs>
+  8002cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002d1:	83 c4 10             	add    $0x10,%esp
+  8002d4:	eb db                	jmp    8002b1 <putch+0x1f>
+
+008002d6 <vcprintf>:
+  8002d6:	55                   	push   %ebp
+  8002d7:	89 e5                	mov    %esp,%ebp
+  8002d9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002df:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002e6:	00 00 00 
+  8002e9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002f0:	00 00 00 
+  8002f3:	ff 75 0c             	push   0xc(%ebp)
+  8002f6:	ff 75 08             	push   0x8(%ebp)
+  8002f9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ff:	50                   	push   %eax
+  800300:	68 92 02 80 00       	push   $0x800292
+  800305:	e8 1c 01 00 00       	call   800426 <vprintfmt>
+  80030a:	83 c4 08             	add    $0x8,%esp
+  80030d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800313:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800319:	50                   	push   %eax
+  80031a:	e8 77 0a 00 00       	call   800d96 <sys_cputs>
+  80031f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800325:	c9                   	leave
+  800326:	c3                   	ret
+
+00800327 <cprintf>:
+  800327:	55                   	push   %ebp
+  800328:	89 e5                	mov    %esp,%ebp
+  80032a:	83 ec 10             	sub    $0x10,%esp
+  80032d:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800330:	50                   	push   %eax
+  800331:	ff 75 08             	push   0x8(%ebp)
+  800334:	e8 9d ff ff ff       	call   8002d6 <vcprintf>
+  800339:	c9                   	leave
+  80033a:	c3                   	ret
+
+0080033b <printnum>:
+  80033b:	55                   	push   %ebp
+  80033c:	89 e5                	mov    %esp,%ebp
+  80033e:	57                   	push   %edi
+  80033f:	56                   	push   %esi
+  800340:	53                   	push   %ebx
+  800341:	83 ec 1c             	sub    $0x1c,%esp
+  800344:	89 c3                	mov    %eax,%ebx
+  800346:	89 d6                	mov    %edx,%esi
+  800348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80034b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80034e:	89 d1                	mov    %edx,%ecx
+  800350:	89 c2                	mov    %eax,%edx
+  800352:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800355:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800358:	8b 45 10             	mov    0x10(%ebp),%eax
+  80035b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80035e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800365:	39 c2                	cmp    %eax,%edx
+  800367:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80036a:	73 4b                	jae    8003b7 <printnum+0x7c>
+  80036c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800372:	85 ff                	test   %edi,%edi
+  800374:	7e 11                	jle    800387 <printnum+0x4c>
+  800376:	83 ec 08             	sub    $0x8,%esp
+  800379:	56                   	push   %esi
+  80037a:	ff 75 18             	push   0x18(%ebp)
+  80037d:	ff d3                	call   *%ebx
+  80037f:	83 c4 10             	add    $0x10,%esp
+  800382:	83 ef 01             	sub    $0x1,%edi
+  800385:	75 ef                	jne    800376 <printnum+0x3b>
+  800387:	83 ec 08             	sub    $0x8,%esp
+  80038a:	56                   	push   %esi
+  80038b:	83 ec 04             	sub    $0x4,%esp
+  80038e:	ff 75 e4             	push   -0x1c(%ebp)
+  800391:	ff 75 e0             	push   -0x20(%ebp)
+  800394:	ff 75 dc             	push   -0x24(%ebp)
+  800397:	ff 75 d8             	push   -0x28(%ebp)
+  80039a:	e8 24 34 00 00       	call   8037c3 <__umoddi3>
+  80039f:	83 c4 14             	add    $0x14,%esp
+  8003a2:	0f be 80 e7 39 80 00 	movsbl 0x8039e7(%eax),%eax
+  8003a9:	50                   	push   %eax
+  8003aa:	ff d3                	call   *%ebx
+  8003ac:	83 c4 10             	add    $0x10,%esp
+  8003af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b2:	5b                   	pop    %ebx
+  8003b3:	5e                   	pop    %esi
+  8003b4:	5f                   	pop    %edi
+  8003b5:	5d                   	pop    %ebp
+  8003b6:	c3                   	ret
+  8003b7:	83 ec 0c             	sub    $0xc,%esp
+  8003ba:	ff 75 18             	push   0x18(%ebp)
+  8003bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003c0:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003c3:	52                   	push   %edx
+  8003c4:	50                   	push   %eax
+  8003c5:	83 ec 08             	sub    $0x8,%esp
+  8003c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8003cb:	ff 75 e0             	push   -0x20(%ebp)
+  8003ce:	ff 75 dc             	push   -0x24(%ebp)
+  8003d1:	ff 75 d8             	push   -0x28(%ebp)
+  8003d4:	e8 cc 33 00 00       	call   8037a5 <__udivdi3>
+  8003d9:	83 c4 18             	add    $0x18,%esp
+  8003dc:	52                   	push   %edx
+  8003dd:	50                   	push   %eax
+  8003de:	89 f2                	mov    %esi,%edx
+  8003e0:	89 d8                	mov    %ebx,%eax
+  8003e2:	e8 54 ff ff ff       	call   80033b <printnum>
+  8003e7:	83 c4 20             	add    $0x20,%esp
+  8003ea:	eb 9b                	jmp    800387 <printnum+0x4c>
+
+008003ec <sprintputch>:
+  8003ec:	55                   	push   %ebp
+  8003ed:	89 e5                	mov    %esp,%ebp
+  8003ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003f2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8003f6:	8b 10                	mov    (%eax),%edx
+  8003f8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003fb:	73 0a                	jae    800407 <sprintputch+0x1b>
+  8003fd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800400:	89 08                	mov    %ecx,(%eax)
+  800402:	8b 45 08             	mov    0x8(%ebp),%eax
+  800405:	88 02                	mov    %al,(%edx)
+  800407:	5d                   	pop    %ebp
+  800408:	c3                   	ret
+
+00800409 <printfmt>:
+  800409:	55                   	push   %ebp
+  80040a:	89 e5                	mov    %esp,%ebp
+  80040c:	83 ec 08             	sub    $0x8,%esp
+  80040f:	8d 45 14             	lea    0x14(%ebp),%eax
+  800412:	50                   	push   %eax
+  800413:	ff 75 10             	push   0x10(%ebp)
+  800416:	ff 75 0c             	push   0xc(%ebp)
+  800419:	ff 75 08             	push   0x8(%ebp)
+  80041c:	e8 05 00 00 00       	call   800426 <vprintfmt>
+  800421:	83 c4 10             	add    $0x10,%esp
+  800424:	c9                   	leave
+  800425:	c3                   	ret
+
+00800426 <vprintfmt>:
+  800426:	55                   	push   %ebp
+  800427:	89 e5                	mov    %esp,%ebp
+  800429:	57                   	push   %edi
+  80042a:	56                   	push   %esi
+  80042b:	53                   	push   %ebx
+  80042c:	83 ec 2c             	sub    $0x2c,%esp
+  80042f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800432:	89 df                	mov    %ebx,%edi
+  800434:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800437:	8b 45 10             	mov    0x10(%ebp),%eax
+  80043a:	8d 70 01             	lea    0x1(%eax),%esi
+  80043d:	0f b6 00             	movzbl (%eax),%eax
+  800440:	83 f8 25             	cmp    $0x25,%eax
+  800443:	74 1e                	je     800463 <vprintfmt+0x3d>
+  800445:	85 c0                	test   %eax,%eax
+  800447:	0f 84 15 05 00 00    	je     800962 <vprintfmt+0x53c>
+  80044d:	83 ec 08             	sub    $0x8,%esp
+  800450:	53                   	push   %ebx
+  800451:	50                   	push   %eax
+  800452:	ff d7                	call   *%edi
+  800454:	83 c6 01             	add    $0x1,%esi
+  800457:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	83 f8 25             	cmp    $0x25,%eax
+  800461:	75 e2                	jne    800445 <vprintfmt+0x1f>
+  800463:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800467:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80046e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800475:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80047c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800481:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800484:	8d 56 01             	lea    0x1(%esi),%edx
+  800487:	0f b6 0e             	movzbl (%esi),%ecx
+  80048a:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80048d:	3c 55                	cmp    $0x55,%al
+  80048f:	0f 87 3b 04 00 00    	ja     8008d0 <vprintfmt+0x4aa>
+  800495:	0f b6 c0             	movzbl %al,%eax
+  800498:	ff 24 85 20 3b 80 00 	jmp    *0x803b20(,%eax,4)
+  80049f:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004a2:	eb 93                	jmp    800437 <vprintfmt+0x11>
+  8004a4:	89 d6                	mov    %edx,%esi
+  8004a6:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004aa:	eb d8                	jmp    800484 <vprintfmt+0x5e>
+  8004ac:	89 d6                	mov    %edx,%esi
+  8004ae:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004b2:	eb d0                	jmp    800484 <vprintfmt+0x5e>
+  8004b4:	0f b6 c9             	movzbl %cl,%ecx
+  8004b7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004bd:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8004c1:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004c4:	83 f9 09             	cmp    $0x9,%ecx
+  8004c7:	77 6f                	ja     800538 <vprintfmt+0x112>
+  8004c9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8004cc:	83 c2 01             	add    $0x1,%edx
+  8004cf:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004d2:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8004d6:	0f be 02             	movsbl (%edx),%eax
+  8004d9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004dc:	83 fe 09             	cmp    $0x9,%esi
+  8004df:	76 eb                	jbe    8004cc <vprintfmt+0xa6>
+  8004e1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8004e4:	89 d6                	mov    %edx,%esi
+  8004e6:	eb 13                	jmp    8004fb <vprintfmt+0xd5>
+  8004e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004eb:	8b 00                	mov    (%eax),%eax
+  8004ed:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f9:	89 d6                	mov    %edx,%esi
+  8004fb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004ff:	79 83                	jns    800484 <vprintfmt+0x5e>
+  800501:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800504:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800507:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80050e:	e9 71 ff ff ff       	jmp    800484 <vprintfmt+0x5e>
+  800513:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800516:	85 c9                	test   %ecx,%ecx
+  800518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051d:	0f 49 c1             	cmovns %ecx,%eax
+  800520:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800523:	89 d6                	mov    %edx,%esi
+  800525:	e9 5a ff ff ff       	jmp    800484 <vprintfmt+0x5e>
+  80052a:	89 d6                	mov    %edx,%esi
+  80052c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800533:	e9 4c ff ff ff       	jmp    800484 <vprintfmt+0x5e>
+  800538:	89 d6                	mov    %edx,%esi
+  80053a:	eb bf                	jmp    8004fb <vprintfmt+0xd5>
+  80053c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800540:	89 d6                	mov    %edx,%esi
+  800542:	e9 3d ff ff ff       	jmp    800484 <vprintfmt+0x5e>
+  800547:	89 55 10             	mov    %edx,0x10(%ebp)
+  80054a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054d:	8d 70 04             	lea    0x4(%eax),%esi
+  800550:	83 ec 08             	sub    $0x8,%esp
+  800553:	53                   	push   %ebx
+  800554:	ff 30                	push   (%eax)
+  800556:	ff d7                	call   *%edi
+  800558:	83 c4 10             	add    $0x10,%esp
+  80055b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80055e:	e9 d4 fe ff ff       	jmp    800437 <vprintfmt+0x11>
+  800563:	89 55 10             	mov    %edx,0x10(%ebp)
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8d 70 04             	lea    0x4(%eax),%esi
+  80056c:	8b 10                	mov    (%eax),%edx
+  80056e:	89 d0                	mov    %edx,%eax
+  800570:	f7 d8                	neg    %eax
+  800572:	0f 48 c2             	cmovs  %edx,%eax
+  800575:	83 f8 12             	cmp    $0x12,%eax
+  800578:	7f 23                	jg     80059d <vprintfmt+0x177>
+  80057a:	8b 14 85 80 3c 80 00 	mov    0x803c80(,%eax,4),%edx
+  800581:	85 d2                	test   %edx,%edx
+  800583:	74 18                	je     80059d <vprintfmt+0x177>
+  800585:	52                   	push   %edx
+  800586:	68 c3 3e 80 00       	push   $0x803ec3
+  80058b:	53                   	push   %ebx
+  80058c:	57                   	push   %edi
+  80058d:	e8 77 fe ff ff       	call   800409 <printfmt>
+  800592:	83 c4 10             	add    $0x10,%esp
+  800595:	89 75 14             	mov    %esi,0x14(%ebp)
+  800598:	e9 9a fe ff ff       	jmp    800437 <vprintfmt+0x11>
+  80059d:	50                   	push   %eax
+  80059e:	68 ff 39 80 00       	push   $0x8039ff
+  8005a3:	53                   	push   %ebx
+  8005a4:	57                   	push   %edi
+  8005a5:	e8 5f fe ff ff       	call   800409 <printfmt>
+  8005aa:	83 c4 10             	add    $0x10,%esp
+  8005ad:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005b0:	e9 82 fe ff ff       	jmp    800437 <vprintfmt+0x11>
+  8005b5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	83 c0 04             	add    $0x4,%eax
+  8005be:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c4:	8b 00                	mov    (%eax),%eax
+  8005c6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005c9:	85 c0                	test   %eax,%eax
+  8005cb:	0f 84 61 03 00 00    	je     800932 <vprintfmt+0x50c>
+  8005d1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005d5:	7e 06                	jle    8005dd <vprintfmt+0x1b7>
+  8005d7:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005db:	75 29                	jne    800606 <vprintfmt+0x1e0>
+  8005dd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005e0:	8d 70 01             	lea    0x1(%eax),%esi
+  8005e3:	0f b6 00             	movzbl (%eax),%eax
+  8005e6:	0f be d0             	movsbl %al,%edx
+  8005e9:	85 d2                	test   %edx,%edx
+  8005eb:	0f 84 bb 00 00 00    	je     8006ac <vprintfmt+0x286>
+  8005f1:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005f4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005f7:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005fa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005fd:	eb 7a                	jmp    800679 <vprintfmt+0x253>
+  8005ff:	c7 45 d0 f8 39 80 00 	movl   $0x8039f8,-0x30(%ebp)
+  800606:	83 ec 08             	sub    $0x8,%esp
+  800609:	ff 75 d4             	push   -0x2c(%ebp)
+  80060c:	ff 75 d0             	push   -0x30(%ebp)
+  80060f:	e8 e0 03 00 00       	call   8009f4 <strnlen>
+  800614:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800617:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80061a:	83 c4 10             	add    $0x10,%esp
+  80061d:	85 d2                	test   %edx,%edx
+  80061f:	0f 8e d6 02 00 00    	jle    8008fb <vprintfmt+0x4d5>
+  800625:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	56                   	push   %esi
+  80062e:	ff d7                	call   *%edi
+  800630:	83 c4 10             	add    $0x10,%esp
+  800633:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800637:	75 f0                	jne    800629 <vprintfmt+0x203>
+  800639:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80063c:	8d 70 01             	lea    0x1(%eax),%esi
+  80063f:	0f b6 00             	movzbl (%eax),%eax
+  800642:	0f be d0             	movsbl %al,%edx
+  800645:	85 d2                	test   %edx,%edx
+  800647:	0f 84 da 02 00 00    	je     800927 <vprintfmt+0x501>
+  80064d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800650:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800653:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800656:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800659:	eb 1e                	jmp    800679 <vprintfmt+0x253>
+  80065b:	83 ec 08             	sub    $0x8,%esp
+  80065e:	ff 75 0c             	push   0xc(%ebp)
+  800661:	52                   	push   %edx
+  800662:	ff 55 08             	call   *0x8(%ebp)
+  800665:	83 c4 10             	add    $0x10,%esp
+  800668:	83 eb 01             	sub    $0x1,%ebx
+  80066b:	83 c6 01             	add    $0x1,%esi
+  80066e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800672:	0f be d0             	movsbl %al,%edx
+  800675:	85 d2                	test   %edx,%edx
+  800677:	74 2a                	je     8006a3 <vprintfmt+0x27d>
+  800679:	85 ff                	test   %edi,%edi
+  80067b:	78 05                	js     800682 <vprintfmt+0x25c>
+  80067d:	83 ef 01             	sub    $0x1,%edi
+  800680:	78 59                	js     8006db <vprintfmt+0x2b5>
+  800682:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800686:	74 d3                	je     80065b <vprintfmt+0x235>
+  800688:	0f be c0             	movsbl %al,%eax
+  80068b:	83 e8 20             	sub    $0x20,%eax
+  80068e:	83 f8 5e             	cmp    $0x5e,%eax
+  800691:	76 c8                	jbe    80065b <vprintfmt+0x235>
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	ff 75 0c             	push   0xc(%ebp)
+  800699:	6a 3f                	push   $0x3f
+  80069b:	ff 55 08             	call   *0x8(%ebp)
+  80069e:	83 c4 10             	add    $0x10,%esp
+  8006a1:	eb c5                	jmp    800668 <vprintfmt+0x242>
+  8006a3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006ac:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006af:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006b3:	7e 1b                	jle    8006d0 <vprintfmt+0x2aa>
+  8006b5:	83 ec 08             	sub    $0x8,%esp
+  8006b8:	53                   	push   %ebx
+  8006b9:	6a 20                	push   $0x20
+  8006bb:	ff d7                	call   *%edi
+  8006bd:	83 c4 10             	add    $0x10,%esp
+  8006c0:	83 ee 01             	sub    $0x1,%esi
+  8006c3:	75 f0                	jne    8006b5 <vprintfmt+0x28f>
+  8006c5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cb:	e9 67 fd ff ff       	jmp    800437 <vprintfmt+0x11>
+  8006d0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d6:	e9 5c fd ff ff       	jmp    800437 <vprintfmt+0x11>
+  8006db:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006e4:	eb c6                	jmp    8006ac <vprintfmt+0x286>
+  8006e6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006e9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ec:	83 f9 01             	cmp    $0x1,%ecx
+  8006ef:	7f 1f                	jg     800710 <vprintfmt+0x2ea>
+  8006f1:	85 c9                	test   %ecx,%ecx
+  8006f3:	74 67                	je     80075c <vprintfmt+0x336>
+  8006f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f8:	8b 30                	mov    (%eax),%esi
+  8006fa:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006fd:	89 f0                	mov    %esi,%eax
+  8006ff:	c1 f8 1f             	sar    $0x1f,%eax
+  800702:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070e:	eb 17                	jmp    800727 <vprintfmt+0x301>
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 50 04             	mov    0x4(%eax),%edx
+  800716:	8b 00                	mov    (%eax),%eax
+  800718:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80071b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	8d 40 08             	lea    0x8(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+  800727:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80072a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80072d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800732:	85 c9                	test   %ecx,%ecx
+  800734:	0f 89 12 01 00 00    	jns    80084c <vprintfmt+0x426>
+  80073a:	83 ec 08             	sub    $0x8,%esp
+  80073d:	53                   	push   %ebx
+  80073e:	6a 2d                	push   $0x2d
+  800740:	ff d7                	call   *%edi
+  800742:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800745:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800748:	f7 da                	neg    %edx
+  80074a:	83 d1 00             	adc    $0x0,%ecx
+  80074d:	f7 d9                	neg    %ecx
+  80074f:	83 c4 10             	add    $0x10,%esp
+  800752:	be 0a 00 00 00       	mov    $0xa,%esi
+  800757:	e9 f0 00 00 00       	jmp    80084c <vprintfmt+0x426>
+  80075c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075f:	8b 30                	mov    (%eax),%esi
+  800761:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800764:	89 f0                	mov    %esi,%eax
+  800766:	c1 f8 1f             	sar    $0x1f,%eax
+  800769:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8d 40 04             	lea    0x4(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+  800775:	eb b0                	jmp    800727 <vprintfmt+0x301>
+  800777:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80077a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80077d:	83 f9 01             	cmp    $0x1,%ecx
+  800780:	7f 1e                	jg     8007a0 <vprintfmt+0x37a>
+  800782:	85 c9                	test   %ecx,%ecx
+  800784:	74 32                	je     8007b8 <vprintfmt+0x392>
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	8b 10                	mov    (%eax),%edx
+  80078b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800790:	8d 40 04             	lea    0x4(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+  800796:	be 0a 00 00 00       	mov    $0xa,%esi
+  80079b:	e9 ac 00 00 00       	jmp    80084c <vprintfmt+0x426>
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8b 10                	mov    (%eax),%edx
+  8007a5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ae:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007b3:	e9 94 00 00 00       	jmp    80084c <vprintfmt+0x426>
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007cd:	eb 7d                	jmp    80084c <vprintfmt+0x426>
+  8007cf:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007d2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d5:	83 f9 01             	cmp    $0x1,%ecx
+  8007d8:	7f 1b                	jg     8007f5 <vprintfmt+0x3cf>
+  8007da:	85 c9                	test   %ecx,%ecx
+  8007dc:	74 2c                	je     80080a <vprintfmt+0x3e4>
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8b 10                	mov    (%eax),%edx
+  8007e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ee:	be 08 00 00 00       	mov    $0x8,%esi
+  8007f3:	eb 57                	jmp    80084c <vprintfmt+0x426>
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8b 10                	mov    (%eax),%edx
+  8007fa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fd:	8d 40 08             	lea    0x8(%eax),%eax
+  800800:	89 45 14             	mov    %eax,0x14(%ebp)
+  800803:	be 08 00 00 00       	mov    $0x8,%esi
+  800808:	eb 42                	jmp    80084c <vprintfmt+0x426>
+  80080a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080d:	8b 10                	mov    (%eax),%edx
+  80080f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800814:	8d 40 04             	lea    0x4(%eax),%eax
+  800817:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081a:	be 08 00 00 00       	mov    $0x8,%esi
+  80081f:	eb 2b                	jmp    80084c <vprintfmt+0x426>
+  800821:	89 55 10             	mov    %edx,0x10(%ebp)
+  800824:	83 ec 08             	sub    $0x8,%esp
+  800827:	53                   	push   %ebx
+  800828:	6a 30                	push   $0x30
+  80082a:	ff d7                	call   *%edi
+  80082c:	83 c4 08             	add    $0x8,%esp
+  80082f:	53                   	push   %ebx
+  800830:	6a 78                	push   $0x78
+  800832:	ff d7                	call   *%edi
+  800834:	8b 45 14             	mov    0x14(%ebp),%eax
+  800837:	8b 10                	mov    (%eax),%edx
+  800839:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083e:	83 c4 10             	add    $0x10,%esp
+  800841:	8d 40 04             	lea    0x4(%eax),%eax
+  800844:	89 45 14             	mov    %eax,0x14(%ebp)
+  800847:	be 10 00 00 00       	mov    $0x10,%esi
+  80084c:	83 ec 0c             	sub    $0xc,%esp
+  80084f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800853:	50                   	push   %eax
+  800854:	ff 75 e4             	push   -0x1c(%ebp)
+  800857:	56                   	push   %esi
+  800858:	51                   	push   %ecx
+  800859:	52                   	push   %edx
+  80085a:	89 da                	mov    %ebx,%edx
+  80085c:	89 f8                	mov    %edi,%eax
+  80085e:	e8 d8 fa ff ff       	call   80033b <printnum>
+  800863:	83 c4 20             	add    $0x20,%esp
+  800866:	e9 cc fb ff ff       	jmp    800437 <vprintfmt+0x11>
+  80086b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80086e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800871:	83 f9 01             	cmp    $0x1,%ecx
+  800874:	7f 1b                	jg     800891 <vprintfmt+0x46b>
+  800876:	85 c9                	test   %ecx,%ecx
+  800878:	74 2c                	je     8008a6 <vprintfmt+0x480>
+  80087a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087d:	8b 10                	mov    (%eax),%edx
+  80087f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800884:	8d 40 04             	lea    0x4(%eax),%eax
+  800887:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088a:	be 10 00 00 00       	mov    $0x10,%esi
+  80088f:	eb bb                	jmp    80084c <vprintfmt+0x426>
+  800891:	8b 45 14             	mov    0x14(%ebp),%eax
+  800894:	8b 10                	mov    (%eax),%edx
+  800896:	8b 48 04             	mov    0x4(%eax),%ecx
+  800899:	8d 40 08             	lea    0x8(%eax),%eax
+  80089c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089f:	be 10 00 00 00       	mov    $0x10,%esi
+  8008a4:	eb a6                	jmp    80084c <vprintfmt+0x426>
+  8008a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a9:	8b 10                	mov    (%eax),%edx
+  8008ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b6:	be 10 00 00 00       	mov    $0x10,%esi
+  8008bb:	eb 8f                	jmp    80084c <vprintfmt+0x426>
+  8008bd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c0:	83 ec 08             	sub    $0x8,%esp
+  8008c3:	53                   	push   %ebx
+  8008c4:	6a 25                	push   $0x25
+  8008c6:	ff d7                	call   *%edi
+  8008c8:	83 c4 10             	add    $0x10,%esp
+  8008cb:	e9 67 fb ff ff       	jmp    800437 <vprintfmt+0x11>
+  8008d0:	83 ec 08             	sub    $0x8,%esp
+  8008d3:	53                   	push   %ebx
+  8008d4:	6a 25                	push   $0x25
+  8008d6:	ff d7                	call   *%edi
+  8008d8:	83 c4 10             	add    $0x10,%esp
+  8008db:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008df:	0f 84 ba fb ff ff    	je     80049f <vprintfmt+0x79>
+  8008e5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008e8:	89 f0                	mov    %esi,%eax
+  8008ea:	83 e8 01             	sub    $0x1,%eax
+  8008ed:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008f1:	75 f7                	jne    8008ea <vprintfmt+0x4c4>
+  8008f3:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008f6:	e9 3c fb ff ff       	jmp    800437 <vprintfmt+0x11>
+  8008fb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008fe:	8d 70 01             	lea    0x1(%eax),%esi
+  800901:	0f b6 00             	movzbl (%eax),%eax
+  800904:	0f be d0             	movsbl %al,%edx
+  800907:	85 d2                	test   %edx,%edx
+  800909:	74 11                	je     80091c <vprintfmt+0x4f6>
+  80090b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80090e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800911:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800914:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800917:	e9 5d fd ff ff       	jmp    800679 <vprintfmt+0x253>
+  80091c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80091f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800922:	e9 10 fb ff ff       	jmp    800437 <vprintfmt+0x11>
+  800927:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80092a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092d:	e9 05 fb ff ff       	jmp    800437 <vprintfmt+0x11>
+  800932:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800936:	7e 0a                	jle    800942 <vprintfmt+0x51c>
+  800938:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80093c:	0f 85 bd fc ff ff    	jne    8005ff <vprintfmt+0x1d9>
+  800942:	ba 28 00 00 00       	mov    $0x28,%edx
+  800947:	b8 28 00 00 00       	mov    $0x28,%eax
+  80094c:	be f9 39 80 00       	mov    $0x8039f9,%esi
+  800951:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800954:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800957:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80095a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80095d:	e9 17 fd ff ff       	jmp    800679 <vprintfmt+0x253>
+  800962:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800965:	5b                   	pop    %ebx
+  800966:	5e                   	pop    %esi
+  800967:	5f                   	pop    %edi
+  800968:	5d                   	pop    %ebp
+  800969:	c3                   	ret
+
+0080096a <vsnprintf>:
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	83 ec 18             	sub    $0x18,%esp
+  800970:	8b 45 08             	mov    0x8(%ebp),%eax
+  800973:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800976:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800979:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80097d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800980:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800987:	85 c0                	test   %eax,%eax
+  800989:	74 26                	je     8009b1 <vsnprintf+0x47>
+  80098b:	85 d2                	test   %edx,%edx
+  80098d:	7e 22                	jle    8009b1 <vsnprintf+0x47>
+  80098f:	ff 75 14             	push   0x14(%ebp)
+  800992:	ff 75 10             	push   0x10(%ebp)
+  800995:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800998:	50                   	push   %eax
+  800999:	68 ec 03 80 00       	push   $0x8003ec
+  80099e:	e8 83 fa ff ff       	call   800426 <vprintfmt>
+  8009a3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009a6:	c6 00 00             	movb   $0x0,(%eax)
+  8009a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ac:	83 c4 10             	add    $0x10,%esp
+  8009af:	c9                   	leave
+  8009b0:	c3                   	ret
+  8009b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009b6:	eb f7                	jmp    8009af <vsnprintf+0x45>
+
+008009b8 <snprintf>:
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	83 ec 08             	sub    $0x8,%esp
+  8009be:	8d 45 14             	lea    0x14(%ebp),%eax
+  8009c1:	50                   	push   %eax
+  8009c2:	ff 75 10             	push   0x10(%ebp)
+  8009c5:	ff 75 0c             	push   0xc(%ebp)
+  8009c8:	ff 75 08             	push   0x8(%ebp)
+  8009cb:	e8 9a ff ff ff       	call   80096a <vsnprintf>
+  8009d0:	c9                   	leave
+  8009d1:	c3                   	ret
+
+008009d2 <strlen>:
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d8:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009db:	74 10                	je     8009ed <strlen+0x1b>
+  8009dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e2:	83 c0 01             	add    $0x1,%eax
+  8009e5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009e9:	75 f7                	jne    8009e2 <strlen+0x10>
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+  8009ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f2:	eb f7                	jmp    8009eb <strlen+0x19>
+
+008009f4 <strnlen>:
+  8009f4:	55                   	push   %ebp
+  8009f5:	89 e5                	mov    %esp,%ebp
+  8009f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009fd:	85 d2                	test   %edx,%edx
+  8009ff:	74 16                	je     800a17 <strnlen+0x23>
+  800a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a06:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a0a:	74 09                	je     800a15 <strnlen+0x21>
+  800a0c:	83 c0 01             	add    $0x1,%eax
+  800a0f:	39 d0                	cmp    %edx,%eax
+  800a11:	75 f3                	jne    800a06 <strnlen+0x12>
+  800a13:	89 d0                	mov    %edx,%eax
+  800a15:	5d                   	pop    %ebp
+  800a16:	c3                   	ret
+  800a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1c:	eb f7                	jmp    800a15 <strnlen+0x21>
+
+00800a1e <strcpy>:
+  800a1e:	55                   	push   %ebp
+  800a1f:	89 e5                	mov    %esp,%ebp
+  800a21:	53                   	push   %ebx
+  800a22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a31:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a34:	83 c0 01             	add    $0x1,%eax
+  800a37:	84 d2                	test   %dl,%dl
+  800a39:	75 f2                	jne    800a2d <strcpy+0xf>
+  800a3b:	89 c8                	mov    %ecx,%eax
+  800a3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a40:	c9                   	leave
+  800a41:	c3                   	ret
+
+00800a42 <strcat>:
+  800a42:	55                   	push   %ebp
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	53                   	push   %ebx
+  800a46:	83 ec 10             	sub    $0x10,%esp
+  800a49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a4c:	53                   	push   %ebx
+  800a4d:	e8 80 ff ff ff       	call   8009d2 <strlen>
+  800a52:	83 c4 08             	add    $0x8,%esp
+  800a55:	ff 75 0c             	push   0xc(%ebp)
+  800a58:	01 d8                	add    %ebx,%eax
+  800a5a:	50                   	push   %eax
+  800a5b:	e8 be ff ff ff       	call   800a1e <strcpy>
+  800a60:	89 d8                	mov    %ebx,%eax
+  800a62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a65:	c9                   	leave
+  800a66:	c3                   	ret
+
+00800a67 <strncpy>:
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	56                   	push   %esi
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a75:	85 db                	test   %ebx,%ebx
+  800a77:	74 17                	je     800a90 <strncpy+0x29>
+  800a79:	01 f3                	add    %esi,%ebx
+  800a7b:	89 f0                	mov    %esi,%eax
+  800a7d:	83 c0 01             	add    $0x1,%eax
+  800a80:	0f b6 0a             	movzbl (%edx),%ecx
+  800a83:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a86:	80 f9 01             	cmp    $0x1,%cl
+  800a89:	83 da ff             	sbb    $0xffffffff,%edx
+  800a8c:	39 c3                	cmp    %eax,%ebx
+  800a8e:	75 ed                	jne    800a7d <strncpy+0x16>
+  800a90:	89 f0                	mov    %esi,%eax
+  800a92:	5b                   	pop    %ebx
+  800a93:	5e                   	pop    %esi
+  800a94:	5d                   	pop    %ebp
+  800a95:	c3                   	ret
+
+00800a96 <strlcpy>:
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	56                   	push   %esi
+  800a9a:	53                   	push   %ebx
+  800a9b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800aa4:	89 f0                	mov    %esi,%eax
+  800aa6:	85 db                	test   %ebx,%ebx
+  800aa8:	74 1e                	je     800ac8 <strlcpy+0x32>
+  800aaa:	83 eb 01             	sub    $0x1,%ebx
+  800aad:	74 16                	je     800ac5 <strlcpy+0x2f>
+  800aaf:	01 f3                	add    %esi,%ebx
+  800ab1:	0f b6 0a             	movzbl (%edx),%ecx
+  800ab4:	84 c9                	test   %cl,%cl
+  800ab6:	74 0d                	je     800ac5 <strlcpy+0x2f>
+  800ab8:	83 c2 01             	add    $0x1,%edx
+  800abb:	83 c0 01             	add    $0x1,%eax
+  800abe:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800ac1:	39 d8                	cmp    %ebx,%eax
+  800ac3:	75 ec                	jne    800ab1 <strlcpy+0x1b>
+  800ac5:	c6 00 00             	movb   $0x0,(%eax)
+  800ac8:	29 f0                	sub    %esi,%eax
+  800aca:	5b                   	pop    %ebx
+  800acb:	5e                   	pop    %esi
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <strcmp>:
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad7:	0f b6 01             	movzbl (%ecx),%eax
+  800ada:	84 c0                	test   %al,%al
+  800adc:	74 11                	je     800aef <strcmp+0x21>
+  800ade:	38 02                	cmp    %al,(%edx)
+  800ae0:	75 0d                	jne    800aef <strcmp+0x21>
+  800ae2:	83 c1 01             	add    $0x1,%ecx
+  800ae5:	83 c2 01             	add    $0x1,%edx
+  800ae8:	0f b6 01             	movzbl (%ecx),%eax
+  800aeb:	84 c0                	test   %al,%al
+  800aed:	75 ef                	jne    800ade <strcmp+0x10>
+  800aef:	0f b6 c0             	movzbl %al,%eax
+  800af2:	0f b6 12             	movzbl (%edx),%edx
+  800af5:	29 d0                	sub    %edx,%eax
+  800af7:	5d                   	pop    %ebp
+  800af8:	c3                   	ret
+
+00800af9 <strncmp>:
+  800af9:	55                   	push   %ebp
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	53                   	push   %ebx
+  800afd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b03:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0b:	85 d2                	test   %edx,%edx
+  800b0d:	74 2e                	je     800b3d <strncmp+0x44>
+  800b0f:	0f b6 01             	movzbl (%ecx),%eax
+  800b12:	84 c0                	test   %al,%al
+  800b14:	74 16                	je     800b2c <strncmp+0x33>
+  800b16:	3a 03                	cmp    (%ebx),%al
+  800b18:	75 12                	jne    800b2c <strncmp+0x33>
+  800b1a:	83 c1 01             	add    $0x1,%ecx
+  800b1d:	83 c3 01             	add    $0x1,%ebx
+  800b20:	83 ea 01             	sub    $0x1,%edx
+  800b23:	75 ea                	jne    800b0f <strncmp+0x16>
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2a:	eb 11                	jmp    800b3d <strncmp+0x44>
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b31:	85 d2                	test   %edx,%edx
+  800b33:	74 08                	je     800b3d <strncmp+0x44>
+  800b35:	0f b6 01             	movzbl (%ecx),%eax
+  800b38:	0f b6 13             	movzbl (%ebx),%edx
+  800b3b:	29 d0                	sub    %edx,%eax
+  800b3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b40:	c9                   	leave
+  800b41:	c3                   	ret
+
+00800b42 <strchr>:
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b48:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b4c:	0f b6 10             	movzbl (%eax),%edx
+  800b4f:	84 d2                	test   %dl,%dl
+  800b51:	74 15                	je     800b68 <strchr+0x26>
+  800b53:	38 d1                	cmp    %dl,%cl
+  800b55:	74 0f                	je     800b66 <strchr+0x24>
+  800b57:	83 c0 01             	add    $0x1,%eax
+  800b5a:	0f b6 10             	movzbl (%eax),%edx
+  800b5d:	84 d2                	test   %dl,%dl
+  800b5f:	75 f2                	jne    800b53 <strchr+0x11>
+  800b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b66:	5d                   	pop    %ebp
+  800b67:	c3                   	ret
+  800b68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6d:	eb f7                	jmp    800b66 <strchr+0x24>
+
+00800b6f <strfind>:
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	53                   	push   %ebx
+  800b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b79:	0f b6 18             	movzbl (%eax),%ebx
+  800b7c:	38 d3                	cmp    %dl,%bl
+  800b7e:	74 14                	je     800b94 <strfind+0x25>
+  800b80:	89 d1                	mov    %edx,%ecx
+  800b82:	84 db                	test   %bl,%bl
+  800b84:	74 0e                	je     800b94 <strfind+0x25>
+  800b86:	83 c0 01             	add    $0x1,%eax
+  800b89:	0f b6 10             	movzbl (%eax),%edx
+  800b8c:	38 ca                	cmp    %cl,%dl
+  800b8e:	74 04                	je     800b94 <strfind+0x25>
+  800b90:	84 d2                	test   %dl,%dl
+  800b92:	75 f2                	jne    800b86 <strfind+0x17>
+  800b94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b97:	c9                   	leave
+  800b98:	c3                   	ret
+
+00800b99 <memset>:
+  800b99:	55                   	push   %ebp
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	57                   	push   %edi
+  800b9d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ba0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ba3:	85 c9                	test   %ecx,%ecx
+  800ba5:	74 20                	je     800bc7 <memset+0x2e>
+  800ba7:	89 f8                	mov    %edi,%eax
+  800ba9:	09 c8                	or     %ecx,%eax
+  800bab:	a8 03                	test   $0x3,%al
+  800bad:	75 12                	jne    800bc1 <memset+0x28>
+  800baf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bb3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800bb9:	c1 e9 02             	shr    $0x2,%ecx
+  800bbc:	fc                   	cld
+  800bbd:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bbf:	eb 06                	jmp    800bc7 <memset+0x2e>
+  800bc1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc4:	fc                   	cld
+  800bc5:	f3 aa                	rep stos %al,%es:(%edi)
+  800bc7:	89 f8                	mov    %edi,%eax
+  800bc9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bcc:	c9                   	leave
+  800bcd:	c3                   	ret
+
+00800bce <memmove>:
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	57                   	push   %edi
+  800bd2:	56                   	push   %esi
+  800bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bd9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800bdc:	39 c6                	cmp    %eax,%esi
+  800bde:	73 32                	jae    800c12 <memmove+0x44>
+  800be0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800be3:	39 d0                	cmp    %edx,%eax
+  800be5:	73 2b                	jae    800c12 <memmove+0x44>
+  800be7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800bea:	89 d6                	mov    %edx,%esi
+  800bec:	09 fe                	or     %edi,%esi
+  800bee:	09 ce                	or     %ecx,%esi
+  800bf0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bf6:	75 0e                	jne    800c06 <memmove+0x38>
+  800bf8:	83 ef 04             	sub    $0x4,%edi
+  800bfb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bfe:	c1 e9 02             	shr    $0x2,%ecx
+  800c01:	fd                   	std
+  800c02:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c04:	eb 09                	jmp    800c0f <memmove+0x41>
+  800c06:	83 ef 01             	sub    $0x1,%edi
+  800c09:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800c0c:	fd                   	std
+  800c0d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c0f:	fc                   	cld
+  800c10:	eb 1a                	jmp    800c2c <memmove+0x5e>
+  800c12:	89 f2                	mov    %esi,%edx
+  800c14:	09 c2                	or     %eax,%edx
+  800c16:	09 ca                	or     %ecx,%edx
+  800c18:	f6 c2 03             	test   $0x3,%dl
+  800c1b:	75 0a                	jne    800c27 <memmove+0x59>
+  800c1d:	c1 e9 02             	shr    $0x2,%ecx
+  800c20:	89 c7                	mov    %eax,%edi
+  800c22:	fc                   	cld
+  800c23:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c25:	eb 05                	jmp    800c2c <memmove+0x5e>
+  800c27:	89 c7                	mov    %eax,%edi
+  800c29:	fc                   	cld
+  800c2a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <memcpy>:
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	83 ec 0c             	sub    $0xc,%esp
+  800c36:	ff 75 10             	push   0x10(%ebp)
+  800c39:	ff 75 0c             	push   0xc(%ebp)
+  800c3c:	ff 75 08             	push   0x8(%ebp)
+  800c3f:	e8 8a ff ff ff       	call   800bce <memmove>
+  800c44:	c9                   	leave
+  800c45:	c3                   	ret
+
+00800c46 <memcmp>:
+  800c46:	55                   	push   %ebp
+  800c47:	89 e5                	mov    %esp,%ebp
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+  800c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c51:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c54:	85 f6                	test   %esi,%esi
+  800c56:	74 29                	je     800c81 <memcmp+0x3b>
+  800c58:	01 c6                	add    %eax,%esi
+  800c5a:	0f b6 08             	movzbl (%eax),%ecx
+  800c5d:	0f b6 1a             	movzbl (%edx),%ebx
+  800c60:	38 d9                	cmp    %bl,%cl
+  800c62:	75 11                	jne    800c75 <memcmp+0x2f>
+  800c64:	83 c0 01             	add    $0x1,%eax
+  800c67:	83 c2 01             	add    $0x1,%edx
+  800c6a:	39 c6                	cmp    %eax,%esi
+  800c6c:	75 ec                	jne    800c5a <memcmp+0x14>
+  800c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c73:	eb 08                	jmp    800c7d <memcmp+0x37>
+  800c75:	0f b6 c1             	movzbl %cl,%eax
+  800c78:	0f b6 db             	movzbl %bl,%ebx
+  800c7b:	29 d8                	sub    %ebx,%eax
+  800c7d:	5b                   	pop    %ebx
+  800c7e:	5e                   	pop    %esi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+  800c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c86:	eb f5                	jmp    800c7d <memcmp+0x37>
+
+00800c88 <memfind>:
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c91:	89 c2                	mov    %eax,%edx
+  800c93:	03 55 10             	add    0x10(%ebp),%edx
+  800c96:	39 d0                	cmp    %edx,%eax
+  800c98:	73 0d                	jae    800ca7 <memfind+0x1f>
+  800c9a:	38 08                	cmp    %cl,(%eax)
+  800c9c:	74 0d                	je     800cab <memfind+0x23>
+  800c9e:	83 c0 01             	add    $0x1,%eax
+  800ca1:	39 c2                	cmp    %eax,%edx
+  800ca3:	75 f5                	jne    800c9a <memfind+0x12>
+  800ca5:	eb 06                	jmp    800cad <memfind+0x25>
+  800ca7:	89 c2                	mov    %eax,%edx
+  800ca9:	eb 02                	jmp    800cad <memfind+0x25>
+  800cab:	89 c2                	mov    %eax,%edx
+  800cad:	89 d0                	mov    %edx,%eax
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+
+00800cb1 <strtol>:
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	57                   	push   %edi
+  800cb5:	56                   	push   %esi
+  800cb6:	53                   	push   %ebx
+  800cb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cbd:	0f b6 02             	movzbl (%edx),%eax
+  800cc0:	3c 20                	cmp    $0x20,%al
+  800cc2:	74 04                	je     800cc8 <strtol+0x17>
+  800cc4:	3c 09                	cmp    $0x9,%al
+  800cc6:	75 0e                	jne    800cd6 <strtol+0x25>
+  800cc8:	83 c2 01             	add    $0x1,%edx
+  800ccb:	0f b6 02             	movzbl (%edx),%eax
+  800cce:	3c 20                	cmp    $0x20,%al
+  800cd0:	74 f6                	je     800cc8 <strtol+0x17>
+  800cd2:	3c 09                	cmp    $0x9,%al
+  800cd4:	74 f2                	je     800cc8 <strtol+0x17>
+  800cd6:	3c 2b                	cmp    $0x2b,%al
+  800cd8:	74 2a                	je     800d04 <strtol+0x53>
+  800cda:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cdf:	3c 2d                	cmp    $0x2d,%al
+  800ce1:	74 2b                	je     800d0e <strtol+0x5d>
+  800ce3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ce9:	75 0f                	jne    800cfa <strtol+0x49>
+  800ceb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cee:	74 28                	je     800d18 <strtol+0x67>
+  800cf0:	85 db                	test   %ebx,%ebx
+  800cf2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cf7:	0f 44 d8             	cmove  %eax,%ebx
+  800cfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cff:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d02:	eb 46                	jmp    800d4a <strtol+0x99>
+  800d04:	83 c2 01             	add    $0x1,%edx
+  800d07:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d0c:	eb d5                	jmp    800ce3 <strtol+0x32>
+  800d0e:	83 c2 01             	add    $0x1,%edx
+  800d11:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d16:	eb cb                	jmp    800ce3 <strtol+0x32>
+  800d18:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d1c:	74 0e                	je     800d2c <strtol+0x7b>
+  800d1e:	85 db                	test   %ebx,%ebx
+  800d20:	75 d8                	jne    800cfa <strtol+0x49>
+  800d22:	83 c2 01             	add    $0x1,%edx
+  800d25:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d2a:	eb ce                	jmp    800cfa <strtol+0x49>
+  800d2c:	83 c2 02             	add    $0x2,%edx
+  800d2f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d34:	eb c4                	jmp    800cfa <strtol+0x49>
+  800d36:	0f be c0             	movsbl %al,%eax
+  800d39:	83 e8 30             	sub    $0x30,%eax
+  800d3c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d3f:	7d 3a                	jge    800d7b <strtol+0xca>
+  800d41:	83 c2 01             	add    $0x1,%edx
+  800d44:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d48:	01 c1                	add    %eax,%ecx
+  800d4a:	0f b6 02             	movzbl (%edx),%eax
+  800d4d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d50:	89 f3                	mov    %esi,%ebx
+  800d52:	80 fb 09             	cmp    $0x9,%bl
+  800d55:	76 df                	jbe    800d36 <strtol+0x85>
+  800d57:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d5a:	89 f3                	mov    %esi,%ebx
+  800d5c:	80 fb 19             	cmp    $0x19,%bl
+  800d5f:	77 08                	ja     800d69 <strtol+0xb8>
+  800d61:	0f be c0             	movsbl %al,%eax
+  800d64:	83 e8 57             	sub    $0x57,%eax
+  800d67:	eb d3                	jmp    800d3c <strtol+0x8b>
+  800d69:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d6c:	89 f3                	mov    %esi,%ebx
+  800d6e:	80 fb 19             	cmp    $0x19,%bl
+  800d71:	77 08                	ja     800d7b <strtol+0xca>
+  800d73:	0f be c0             	movsbl %al,%eax
+  800d76:	83 e8 37             	sub    $0x37,%eax
+  800d79:	eb c1                	jmp    800d3c <strtol+0x8b>
+  800d7b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d7f:	74 05                	je     800d86 <strtol+0xd5>
+  800d81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d84:	89 10                	mov    %edx,(%eax)
+  800d86:	89 c8                	mov    %ecx,%eax
+  800d88:	f7 d8                	neg    %eax
+  800d8a:	85 ff                	test   %edi,%edi
+  800d8c:	0f 45 c8             	cmovne %eax,%ecx
+  800d8f:	89 c8                	mov    %ecx,%eax
+  800d91:	5b                   	pop    %ebx
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+
+00800d96 <sys_cputs>:
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	57                   	push   %edi
+  800d9a:	56                   	push   %esi
+  800d9b:	53                   	push   %ebx
+  800d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da7:	89 c3                	mov    %eax,%ebx
+  800da9:	89 c7                	mov    %eax,%edi
+  800dab:	89 c6                	mov    %eax,%esi
+  800dad:	cd 30                	int    $0x30
+  800daf:	5b                   	pop    %ebx
+  800db0:	5e                   	pop    %esi
+  800db1:	5f                   	pop    %edi
+  800db2:	5d                   	pop    %ebp
+  800db3:	c3                   	ret
+
+00800db4 <sys_cgetc>:
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+  800dba:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dc4:	89 d1                	mov    %edx,%ecx
+  800dc6:	89 d3                	mov    %edx,%ebx
+  800dc8:	89 d7                	mov    %edx,%edi
+  800dca:	89 d6                	mov    %edx,%esi
+  800dcc:	cd 30                	int    $0x30
+  800dce:	5b                   	pop    %ebx
+  800dcf:	5e                   	pop    %esi
+  800dd0:	5f                   	pop    %edi
+  800dd1:	5d                   	pop    %ebp
+  800dd2:	c3                   	ret
+
+00800dd3 <sys_env_destroy>:
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	57                   	push   %edi
+  800dd7:	56                   	push   %esi
+  800dd8:	53                   	push   %ebx
+  800dd9:	83 ec 0c             	sub    $0xc,%esp
+  800ddc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800de9:	89 cb                	mov    %ecx,%ebx
+  800deb:	89 cf                	mov    %ecx,%edi
+  800ded:	89 ce                	mov    %ecx,%esi
+  800def:	cd 30                	int    $0x30
+  800df1:	85 c0                	test   %eax,%eax
+  800df3:	7f 08                	jg     800dfd <sys_env_destroy+0x2a>
+  800df5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df8:	5b                   	pop    %ebx
+  800df9:	5e                   	pop    %esi
+  800dfa:	5f                   	pop    %edi
+  800dfb:	5d                   	pop    %ebp
+  800dfc:	c3                   	ret
+  800dfd:	83 ec 0c             	sub    $0xc,%esp
+  800e00:	50                   	push   %eax
+  800e01:	6a 03                	push   $0x3
+  800e03:	68 eb 3c 80 00       	push   $0x803ceb
+  800e08:	6a 24                	push   $0x24
+  800e0a:	68 08 3d 80 00       	push   $0x803d08
+  800e0f:	e8 38 f4 ff ff       	call   80024c <_panic>
+
+00800e14 <sys_getenvid>:
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	57                   	push   %edi
+  800e18:	56                   	push   %esi
+  800e19:	53                   	push   %ebx
+  800e1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e24:	89 d1                	mov    %edx,%ecx
+  800e26:	89 d3                	mov    %edx,%ebx
+  800e28:	89 d7                	mov    %edx,%edi
+  800e2a:	89 d6                	mov    %edx,%esi
+  800e2c:	cd 30                	int    $0x30
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+
+00800e33 <sys_yield>:
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	56                   	push   %esi
+  800e38:	53                   	push   %ebx
+  800e39:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e40:	74 26                	je     800e68 <sys_yield+0x35>
+  800e42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e47:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e4c:	89 d1                	mov    %edx,%ecx
+  800e4e:	89 d3                	mov    %edx,%ebx
+  800e50:	89 d7                	mov    %edx,%edi
+  800e52:	6a 00                	push   $0x0
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	8d 35 5f 0e 80 00    	lea    0x800e5f,%esi
+  800e5d:	0f 34                	sysenter
+  800e5f:	5d                   	pop    %ebp
+  800e60:	83 c4 04             	add    $0x4,%esp
+  800e63:	5b                   	pop    %ebx
+  800e64:	5e                   	pop    %esi
+  800e65:	5f                   	pop    %edi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+  800e68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e72:	89 d1                	mov    %edx,%ecx
+  800e74:	89 d3                	mov    %edx,%ebx
+  800e76:	89 d7                	mov    %edx,%edi
+  800e78:	89 d6                	mov    %edx,%esi
+  800e7a:	cd 30                	int    $0x30
+  800e7c:	eb e5                	jmp    800e63 <sys_yield+0x30>
+
+00800e7e <sys_page_alloc>:
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	57                   	push   %edi
+  800e82:	56                   	push   %esi
+  800e83:	53                   	push   %ebx
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+  800e87:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e92:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9a:	89 f7                	mov    %esi,%edi
+  800e9c:	cd 30                	int    $0x30
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	7f 08                	jg     800eaa <sys_page_alloc+0x2c>
+  800ea2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+  800eaa:	83 ec 0c             	sub    $0xc,%esp
+  800ead:	50                   	push   %eax
+  800eae:	6a 04                	push   $0x4
+  800eb0:	68 eb 3c 80 00       	push   $0x803ceb
+  800eb5:	6a 24                	push   $0x24
+  800eb7:	68 08 3d 80 00       	push   $0x803d08
+  800ebc:	e8 8b f3 ff ff       	call   80024c <_panic>
+
+00800ec1 <sys_page_map>:
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	56                   	push   %esi
+  800ec6:	53                   	push   %ebx
+  800ec7:	83 ec 0c             	sub    $0xc,%esp
+  800eca:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ed1:	74 33                	je     800f06 <sys_page_map+0x45>
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ede:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ee4:	ff 75 18             	push   0x18(%ebp)
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	8d 35 f2 0e 80 00    	lea    0x800ef2,%esi
+  800ef0:	0f 34                	sysenter
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	83 c4 04             	add    $0x4,%esp
+  800ef6:	89 c2                	mov    %eax,%edx
+  800ef8:	85 c0                	test   %eax,%eax
+  800efa:	7f 3d                	jg     800f39 <sys_page_map+0x78>
+  800efc:	89 d0                	mov    %edx,%eax
+  800efe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f01:	5b                   	pop    %ebx
+  800f02:	5e                   	pop    %esi
+  800f03:	5f                   	pop    %edi
+  800f04:	5d                   	pop    %ebp
+  800f05:	c3                   	ret
+  800f06:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f14:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f17:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f1a:	cd 30                	int    $0x30
+  800f1c:	89 c2                	mov    %eax,%edx
+  800f1e:	85 c0                	test   %eax,%eax
+  800f20:	7e da                	jle    800efc <sys_page_map+0x3b>
+  800f22:	83 ec 0c             	sub    $0xc,%esp
+  800f25:	50                   	push   %eax
+  800f26:	6a 05                	push   $0x5
+  800f28:	68 eb 3c 80 00       	push   $0x803ceb
+  800f2d:	6a 24                	push   $0x24
+  800f2f:	68 08 3d 80 00       	push   $0x803d08
+  800f34:	e8 13 f3 ff ff       	call   80024c <_panic>
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+  800f3c:	50                   	push   %eax
+  800f3d:	6a 05                	push   $0x5
+  800f3f:	68 eb 3c 80 00       	push   $0x803ceb
+  800f44:	6a 48                	push   $0x48
+  800f46:	68 08 3d 80 00       	push   $0x803d08
+  800f4b:	e8 fc f2 ff ff       	call   80024c <_panic>
+
+00800f50 <sys_page_unmap>:
+  800f50:	55                   	push   %ebp
+  800f51:	89 e5                	mov    %esp,%ebp
+  800f53:	57                   	push   %edi
+  800f54:	56                   	push   %esi
+  800f55:	53                   	push   %ebx
+  800f56:	83 ec 0c             	sub    $0xc,%esp
+  800f59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f64:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f69:	89 df                	mov    %ebx,%edi
+  800f6b:	89 de                	mov    %ebx,%esi
+  800f6d:	cd 30                	int    $0x30
+  800f6f:	85 c0                	test   %eax,%eax
+  800f71:	7f 08                	jg     800f7b <sys_page_unmap+0x2b>
+  800f73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f76:	5b                   	pop    %ebx
+  800f77:	5e                   	pop    %esi
+  800f78:	5f                   	pop    %edi
+  800f79:	5d                   	pop    %ebp
+  800f7a:	c3                   	ret
+  800f7b:	83 ec 0c             	sub    $0xc,%esp
+  800f7e:	50                   	push   %eax
+  800f7f:	6a 06                	push   $0x6
+  800f81:	68 eb 3c 80 00       	push   $0x803ceb
+  800f86:	6a 24                	push   $0x24
+  800f88:	68 08 3d 80 00       	push   $0x803d08
+  800f8d:	e8 ba f2 ff ff       	call   80024c <_panic>
+
+00800f92 <sys_fork>:
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	57                   	push   %edi
+  800f96:	56                   	push   %esi
+  800f97:	53                   	push   %ebx
+  800f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fa2:	89 d1                	mov    %edx,%ecx
+  800fa4:	89 d3                	mov    %edx,%ebx
+  800fa6:	89 d7                	mov    %edx,%edi
+  800fa8:	89 d6                	mov    %edx,%esi
+  800faa:	cd 30                	int    $0x30
+  800fac:	5b                   	pop    %ebx
+  800fad:	5e                   	pop    %esi
+  800fae:	5f                   	pop    %edi
+  800faf:	5d                   	pop    %ebp
+  800fb0:	c3                   	ret
+
+00800fb1 <sys_env_set_status>:
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	57                   	push   %edi
+  800fb5:	56                   	push   %esi
+  800fb6:	53                   	push   %ebx
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fca:	89 df                	mov    %ebx,%edi
+  800fcc:	89 de                	mov    %ebx,%esi
+  800fce:	cd 30                	int    $0x30
+  800fd0:	85 c0                	test   %eax,%eax
+  800fd2:	7f 08                	jg     800fdc <sys_env_set_status+0x2b>
+  800fd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd7:	5b                   	pop    %ebx
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5f                   	pop    %edi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+  800fdf:	50                   	push   %eax
+  800fe0:	6a 08                	push   $0x8
+  800fe2:	68 eb 3c 80 00       	push   $0x803ceb
+  800fe7:	6a 24                	push   $0x24
+  800fe9:	68 08 3d 80 00       	push   $0x803d08
+  800fee:	e8 59 f2 ff ff       	call   80024c <_panic>
+
+00800ff3 <sys_env_set_trapframe>:
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+  800ffc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801007:	b8 09 00 00 00       	mov    $0x9,%eax
+  80100c:	89 df                	mov    %ebx,%edi
+  80100e:	89 de                	mov    %ebx,%esi
+  801010:	cd 30                	int    $0x30
+  801012:	85 c0                	test   %eax,%eax
+  801014:	7f 08                	jg     80101e <sys_env_set_trapframe+0x2b>
+  801016:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801019:	5b                   	pop    %ebx
+  80101a:	5e                   	pop    %esi
+  80101b:	5f                   	pop    %edi
+  80101c:	5d                   	pop    %ebp
+  80101d:	c3                   	ret
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+  801021:	50                   	push   %eax
+  801022:	6a 09                	push   $0x9
+  801024:	68 eb 3c 80 00       	push   $0x803ceb
+  801029:	6a 24                	push   $0x24
+  80102b:	68 08 3d 80 00       	push   $0x803d08
+  801030:	e8 17 f2 ff ff       	call   80024c <_panic>
+
+00801035 <sys_env_set_cow>:
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	56                   	push   %esi
+  80103a:	53                   	push   %ebx
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+  80103e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801043:	8b 55 08             	mov    0x8(%ebp),%edx
+  801046:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801049:	b8 20 00 00 00       	mov    $0x20,%eax
+  80104e:	89 df                	mov    %ebx,%edi
+  801050:	89 de                	mov    %ebx,%esi
+  801052:	cd 30                	int    $0x30
+  801054:	85 c0                	test   %eax,%eax
+  801056:	7f 08                	jg     801060 <sys_env_set_cow+0x2b>
+  801058:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+  801060:	83 ec 0c             	sub    $0xc,%esp
+  801063:	50                   	push   %eax
+  801064:	6a 20                	push   $0x20
+  801066:	68 eb 3c 80 00       	push   $0x803ceb
+  80106b:	6a 24                	push   $0x24
+  80106d:	68 08 3d 80 00       	push   $0x803d08
+  801072:	e8 d5 f1 ff ff       	call   80024c <_panic>
+
+00801077 <sys_env_service>:
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  80107d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	b8 21 00 00 00       	mov    $0x21,%eax
+  80108a:	89 cb                	mov    %ecx,%ebx
+  80108c:	89 cf                	mov    %ecx,%edi
+  80108e:	89 ce                	mov    %ecx,%esi
+  801090:	cd 30                	int    $0x30
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <sys_env_set_pgfault_upcall>:
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010b0:	89 df                	mov    %ebx,%edi
+  8010b2:	89 de                	mov    %ebx,%esi
+  8010b4:	cd 30                	int    $0x30
+  8010b6:	85 c0                	test   %eax,%eax
+  8010b8:	7f 08                	jg     8010c2 <sys_env_set_pgfault_upcall+0x2b>
+  8010ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bd:	5b                   	pop    %ebx
+  8010be:	5e                   	pop    %esi
+  8010bf:	5f                   	pop    %edi
+  8010c0:	5d                   	pop    %ebp
+  8010c1:	c3                   	ret
+  8010c2:	83 ec 0c             	sub    $0xc,%esp
+  8010c5:	50                   	push   %eax
+  8010c6:	6a 0a                	push   $0xa
+  8010c8:	68 eb 3c 80 00       	push   $0x803ceb
+  8010cd:	6a 24                	push   $0x24
+  8010cf:	68 08 3d 80 00       	push   $0x803d08
+  8010d4:	e8 73 f1 ff ff       	call   80024c <_panic>
+
+008010d9 <sys_ipc_try_send>:
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	57                   	push   %edi
+  8010dd:	56                   	push   %esi
+  8010de:	53                   	push   %ebx
+  8010df:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010e6:	74 27                	je     80110f <sys_ipc_try_send+0x36>
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f9:	6a 00                	push   $0x0
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	8d 35 06 11 80 00    	lea    0x801106,%esi
+  801104:	0f 34                	sysenter
+  801106:	5d                   	pop    %ebp
+  801107:	83 c4 04             	add    $0x4,%esp
+  80110a:	5b                   	pop    %ebx
+  80110b:	5e                   	pop    %esi
+  80110c:	5f                   	pop    %edi
+  80110d:	5d                   	pop    %ebp
+  80110e:	c3                   	ret
+  80110f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801114:	be 00 00 00 00       	mov    $0x0,%esi
+  801119:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801122:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801125:	cd 30                	int    $0x30
+  801127:	eb e1                	jmp    80110a <sys_ipc_try_send+0x31>
+
+00801129 <sys_ipc_recv>:
+  801129:	55                   	push   %ebp
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	57                   	push   %edi
+  80112d:	56                   	push   %esi
+  80112e:	53                   	push   %ebx
+  80112f:	83 ec 0c             	sub    $0xc,%esp
+  801132:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801139:	74 32                	je     80116d <sys_ipc_recv+0x44>
+  80113b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801143:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801148:	89 cb                	mov    %ecx,%ebx
+  80114a:	89 cf                	mov    %ecx,%edi
+  80114c:	6a 00                	push   $0x0
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	8d 35 59 11 80 00    	lea    0x801159,%esi
+  801157:	0f 34                	sysenter
+  801159:	5d                   	pop    %ebp
+  80115a:	83 c4 04             	add    $0x4,%esp
+  80115d:	89 c2                	mov    %eax,%edx
+  80115f:	85 c0                	test   %eax,%eax
+  801161:	7f 3c                	jg     80119f <sys_ipc_recv+0x76>
+  801163:	89 d0                	mov    %edx,%eax
+  801165:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801168:	5b                   	pop    %ebx
+  801169:	5e                   	pop    %esi
+  80116a:	5f                   	pop    %edi
+  80116b:	5d                   	pop    %ebp
+  80116c:	c3                   	ret
+  80116d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801172:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801177:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117a:	89 cb                	mov    %ecx,%ebx
+  80117c:	89 cf                	mov    %ecx,%edi
+  80117e:	89 ce                	mov    %ecx,%esi
+  801180:	cd 30                	int    $0x30
+  801182:	89 c2                	mov    %eax,%edx
+  801184:	85 c0                	test   %eax,%eax
+  801186:	7e db                	jle    801163 <sys_ipc_recv+0x3a>
+  801188:	83 ec 0c             	sub    $0xc,%esp
+  80118b:	50                   	push   %eax
+  80118c:	6a 0d                	push   $0xd
+  80118e:	68 eb 3c 80 00       	push   $0x803ceb
+  801193:	6a 24                	push   $0x24
+  801195:	68 08 3d 80 00       	push   $0x803d08
+  80119a:	e8 ad f0 ff ff       	call   80024c <_panic>
+  80119f:	83 ec 0c             	sub    $0xc,%esp
+  8011a2:	50                   	push   %eax
+  8011a3:	6a 0d                	push   $0xd
+  8011a5:	68 eb 3c 80 00       	push   $0x803ceb
+  8011aa:	6a 48                	push   $0x48
+  8011ac:	68 08 3d 80 00       	push   $0x803d08
+  8011b1:	e8 96 f0 ff ff       	call   80024c <_panic>
+
+008011b6 <sys_ipc_send>:
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	57                   	push   %edi
+  8011ba:	56                   	push   %esi
+  8011bb:	53                   	push   %ebx
+  8011bc:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011c3:	74 27                	je     8011ec <sys_ipc_send+0x36>
+  8011c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d6:	6a 00                	push   $0x0
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	8d 35 e3 11 80 00    	lea    0x8011e3,%esi
+  8011e1:	0f 34                	sysenter
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	83 c4 04             	add    $0x4,%esp
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+  8011ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801202:	cd 30                	int    $0x30
+  801204:	eb e1                	jmp    8011e7 <sys_ipc_send+0x31>
+
+00801206 <sys_ipc_call>:
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801217:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801220:	cd 30                	int    $0x30
+  801222:	5b                   	pop    %ebx
+  801223:	5e                   	pop    %esi
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+
+00801227 <sys_ipc_reply_recv>:
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+  80122d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801230:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801233:	b8 10 00 00 00       	mov    $0x10,%eax
+  801238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80123e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801241:	cd 30                	int    $0x30
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+
+00801248 <sys_time_msec>:
+  801248:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80124d:	85 c0                	test   %eax,%eax
+  80124f:	75 06                	jne    801257 <sys_time_msec+0xf>
+  801251:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801256:	c3                   	ret
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 0c             	sub    $0xc,%esp
+  801260:	0f 31                	rdtsc
+  801262:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801268:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80126e:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801274:	29 c8                	sub    %ecx,%eax
+  801276:	19 da                	sbb    %ebx,%edx
+  801278:	bf 00 00 00 00       	mov    $0x0,%edi
+  80127d:	57                   	push   %edi
+  80127e:	56                   	push   %esi
+  80127f:	52                   	push   %edx
+  801280:	50                   	push   %eax
+  801281:	e8 1f 25 00 00       	call   8037a5 <__udivdi3>
+  801286:	83 c4 10             	add    $0x10,%esp
+  801289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128c:	5b                   	pop    %ebx
+  80128d:	5e                   	pop    %esi
+  80128e:	5f                   	pop    %edi
+  80128f:	5d                   	pop    %ebp
+  801290:	c3                   	ret
+
+00801291 <sys_env_swap>:
+  801291:	55                   	push   %ebp
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	57                   	push   %edi
+  801295:	56                   	push   %esi
+  801296:	53                   	push   %ebx
+  801297:	83 ec 0c             	sub    $0xc,%esp
+  80129a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80129f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012a7:	89 cb                	mov    %ecx,%ebx
+  8012a9:	89 cf                	mov    %ecx,%edi
+  8012ab:	89 ce                	mov    %ecx,%esi
+  8012ad:	cd 30                	int    $0x30
+  8012af:	85 c0                	test   %eax,%eax
+  8012b1:	7f 08                	jg     8012bb <sys_env_swap+0x2a>
+  8012b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b6:	5b                   	pop    %ebx
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5f                   	pop    %edi
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+  8012bb:	83 ec 0c             	sub    $0xc,%esp
+  8012be:	50                   	push   %eax
+  8012bf:	6a 12                	push   $0x12
+  8012c1:	68 eb 3c 80 00       	push   $0x803ceb
+  8012c6:	6a 24                	push   $0x24
+  8012c8:	68 08 3d 80 00       	push   $0x803d08
+  8012cd:	e8 7a ef ff ff       	call   80024c <_panic>
+
+008012d2 <sys_net_try_send>:
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	57                   	push   %edi
+  8012d6:	56                   	push   %esi
+  8012d7:	53                   	push   %ebx
+  8012d8:	83 ec 0c             	sub    $0xc,%esp
+  8012db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012eb:	89 df                	mov    %ebx,%edi
+  8012ed:	89 de                	mov    %ebx,%esi
+  8012ef:	cd 30                	int    $0x30
+  8012f1:	85 c0                	test   %eax,%eax
+  8012f3:	7f 08                	jg     8012fd <sys_net_try_send+0x2b>
+  8012f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f8:	5b                   	pop    %ebx
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5f                   	pop    %edi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+  8012fd:	83 ec 0c             	sub    $0xc,%esp
+  801300:	50                   	push   %eax
+  801301:	6a 13                	push   $0x13
+  801303:	68 eb 3c 80 00       	push   $0x803ceb
+  801308:	6a 24                	push   $0x24
+  80130a:	68 08 3d 80 00       	push   $0x803d08
+  80130f:	e8 38 ef ff ff       	call   80024c <_panic>
+
+00801314 <sys_net_try_receive>:
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	57                   	push   %edi
+  801318:	56                   	push   %esi
+  801319:	53                   	push   %ebx
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+  80131d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+  801325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801328:	b8 14 00 00 00       	mov    $0x14,%eax
+  80132d:	89 df                	mov    %ebx,%edi
+  80132f:	89 de                	mov    %ebx,%esi
+  801331:	cd 30                	int    $0x30
+  801333:	85 c0                	test   %eax,%eax
+  801335:	7f 08                	jg     80133f <sys_net_try_receive+0x2b>
+  801337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133a:	5b                   	pop    %ebx
+  80133b:	5e                   	pop    %esi
+  80133c:	5f                   	pop    %edi
+  80133d:	5d                   	pop    %ebp
+  80133e:	c3                   	ret
+  80133f:	83 ec 0c             	sub    $0xc,%esp
+  801342:	50                   	push   %eax
+  801343:	6a 14                	push   $0x14
+  801345:	68 eb 3c 80 00       	push   $0x803ceb
+  80134a:	6a 24                	push   $0x24
+  80134c:	68 08 3d 80 00       	push   $0x803d08
+  801351:	e8 f6 ee ff ff       	call   80024c <_panic>
+
+00801356 <sys_net_recv_page>:
+  801356:	55                   	push   %ebp
+  801357:	89 e5                	mov    %esp,%ebp
+  801359:	57                   	push   %edi
+  80135a:	56                   	push   %esi
+  80135b:	53                   	push   %ebx
+  80135c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801361:	8b 55 08             	mov    0x8(%ebp),%edx
+  801364:	b8 27 00 00 00       	mov    $0x27,%eax
+  801369:	89 cb                	mov    %ecx,%ebx
+  80136b:	89 cf                	mov    %ecx,%edi
+  80136d:	89 ce                	mov    %ecx,%esi
+  80136f:	cd 30                	int    $0x30
+  801371:	5b                   	pop    %ebx
+  801372:	5e                   	pop    %esi
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+
+00801376 <sys_net_wait>:
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	57                   	push   %edi
+  80137a:	56                   	push   %esi
+  80137b:	53                   	push   %ebx
+  80137c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801381:	b8 26 00 00 00       	mov    $0x26,%eax
+  801386:	89 d1                	mov    %edx,%ecx
+  801388:	89 d3                	mov    %edx,%ebx
+  80138a:	89 d7                	mov    %edx,%edi
+  80138c:	89 d6                	mov    %edx,%esi
+  80138e:	cd 30                	int    $0x30
+  801390:	5b                   	pop    %ebx
+  801391:	5e                   	pop    %esi
+  801392:	5f                   	pop    %edi
+  801393:	5d                   	pop    %ebp
+  801394:	c3                   	ret
+
+00801395 <sys_get_mac>:
+  801395:	55                   	push   %ebp
+  801396:	89 e5                	mov    %esp,%ebp
+  801398:	57                   	push   %edi
+  801399:	56                   	push   %esi
+  80139a:	53                   	push   %ebx
+  80139b:	83 ec 0c             	sub    $0xc,%esp
+  80139e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013ae:	89 df                	mov    %ebx,%edi
+  8013b0:	89 de                	mov    %ebx,%esi
+  8013b2:	cd 30                	int    $0x30
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	7f 08                	jg     8013c0 <sys_get_mac+0x2b>
+  8013b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bb:	5b                   	pop    %ebx
+  8013bc:	5e                   	pop    %esi
+  8013bd:	5f                   	pop    %edi
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+  8013c0:	83 ec 0c             	sub    $0xc,%esp
+  8013c3:	50                   	push   %eax
+  8013c4:	6a 15                	push   $0x15
+  8013c6:	68 eb 3c 80 00       	push   $0x803ceb
+  8013cb:	6a 24                	push   $0x24
+  8013cd:	68 08 3d 80 00       	push   $0x803d08
+  8013d2:	e8 75 ee ff ff       	call   80024c <_panic>
+
+008013d7 <sys_env_lease>:
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	57                   	push   %edi
+  8013db:	56                   	push   %esi
+  8013dc:	53                   	push   %ebx
+  8013dd:	83 ec 0c             	sub    $0xc,%esp
+  8013e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013eb:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013f0:	89 df                	mov    %ebx,%edi
+  8013f2:	89 de                	mov    %ebx,%esi
+  8013f4:	cd 30                	int    $0x30
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	7f 08                	jg     801402 <sys_env_lease+0x2b>
+  8013fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fd:	5b                   	pop    %ebx
+  8013fe:	5e                   	pop    %esi
+  8013ff:	5f                   	pop    %edi
+  801400:	5d                   	pop    %ebp
+  801401:	c3                   	ret
+  801402:	83 ec 0c             	sub    $0xc,%esp
+  801405:	50                   	push   %eax
+  801406:	6a 16                	push   $0x16
+  801408:	68 eb 3c 80 00       	push   $0x803ceb
+  80140d:	6a 24                	push   $0x24
+  80140f:	68 08 3d 80 00       	push   $0x803d08
+  801414:	e8 33 ee ff ff       	call   80024c <_panic>
+
+00801419 <sys_copy_mem>:
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	57                   	push   %edi
+  80141d:	56                   	push   %esi
+  80141e:	53                   	push   %ebx
+  80141f:	83 ec 0c             	sub    $0xc,%esp
+  801422:	8b 55 08             	mov    0x8(%ebp),%edx
+  801425:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801428:	b8 17 00 00 00       	mov    $0x17,%eax
+  80142d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801430:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801433:	8b 75 18             	mov    0x18(%ebp),%esi
+  801436:	cd 30                	int    $0x30
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	7f 08                	jg     801444 <sys_copy_mem+0x2b>
+  80143c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143f:	5b                   	pop    %ebx
+  801440:	5e                   	pop    %esi
+  801441:	5f                   	pop    %edi
+  801442:	5d                   	pop    %ebp
+  801443:	c3                   	ret
+  801444:	83 ec 0c             	sub    $0xc,%esp
+  801447:	50                   	push   %eax
+  801448:	6a 17                	push   $0x17
+  80144a:	68 eb 3c 80 00       	push   $0x803ceb
+  80144f:	6a 24                	push   $0x24
+  801451:	68 08 3d 80 00       	push   $0x803d08
+  801456:	e8 f1 ed ff ff       	call   80024c <_panic>
+
+0080145b <sys_get_perms>:
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	57                   	push   %edi
+  80145f:	56                   	push   %esi
+  801460:	53                   	push   %ebx
+  801461:	83 ec 0c             	sub    $0xc,%esp
+  801464:	be 00 00 00 00       	mov    $0x0,%esi
+  801469:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801474:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801477:	89 f7                	mov    %esi,%edi
+  801479:	cd 30                	int    $0x30
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	7f 08                	jg     801487 <sys_get_perms+0x2c>
+  80147f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801482:	5b                   	pop    %ebx
+  801483:	5e                   	pop    %esi
+  801484:	5f                   	pop    %edi
+  801485:	5d                   	pop    %ebp
+  801486:	c3                   	ret
+  801487:	83 ec 0c             	sub    $0xc,%esp
+  80148a:	50                   	push   %eax
+  80148b:	6a 18                	push   $0x18
+  80148d:	68 eb 3c 80 00       	push   $0x803ceb
+  801492:	6a 24                	push   $0x24
+  801494:	68 08 3d 80 00       	push   $0x803d08
+  801499:	e8 ae ed ff ff       	call   80024c <_panic>
+
+0080149e <sys_env_unsuspend>:
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	57                   	push   %edi
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+  8014a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ba:	89 f7                	mov    %esi,%edi
+  8014bc:	cd 30                	int    $0x30
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	7f 08                	jg     8014ca <sys_env_unsuspend+0x2c>
+  8014c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+  8014ca:	83 ec 0c             	sub    $0xc,%esp
+  8014cd:	50                   	push   %eax
+  8014ce:	6a 19                	push   $0x19
+  8014d0:	68 eb 3c 80 00       	push   $0x803ceb
+  8014d5:	6a 24                	push   $0x24
+  8014d7:	68 08 3d 80 00       	push   $0x803d08
+  8014dc:	e8 6b ed ff ff       	call   80024c <_panic>
+
+008014e1 <sys_migrate>:
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+  8014e7:	83 ec 0c             	sub    $0xc,%esp
+  8014ea:	ba 04 90 80 00       	mov    $0x809004,%edx
+  8014ef:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8014f5:	76 11                	jbe    801508 <sys_migrate+0x27>
+  8014f7:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8014fc:	0f b6 08             	movzbl (%eax),%ecx
+  8014ff:	05 00 10 00 00       	add    $0x1000,%eax
+  801504:	39 d0                	cmp    %edx,%eax
+  801506:	72 f4                	jb     8014fc <sys_migrate+0x1b>
+  801508:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80150d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801510:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801515:	89 cb                	mov    %ecx,%ebx
+  801517:	89 cf                	mov    %ecx,%edi
+  801519:	89 ce                	mov    %ecx,%esi
+  80151b:	cd 30                	int    $0x30
+  80151d:	85 c0                	test   %eax,%eax
+  80151f:	7f 08                	jg     801529 <sys_migrate+0x48>
+  801521:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801524:	5b                   	pop    %ebx
+  801525:	5e                   	pop    %esi
+  801526:	5f                   	pop    %edi
+  801527:	5d                   	pop    %ebp
+  801528:	c3                   	ret
+  801529:	83 ec 0c             	sub    $0xc,%esp
+  80152c:	50                   	push   %eax
+  80152d:	6a 1a                	push   $0x1a
+  80152f:	68 eb 3c 80 00       	push   $0x803ceb
+  801534:	6a 24                	push   $0x24
+  801536:	68 08 3d 80 00       	push   $0x803d08
+  80153b:	e8 0c ed ff ff       	call   80024c <_panic>
+
+00801540 <sys_lease_complete>:
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+  801546:	83 ec 0c             	sub    $0xc,%esp
+  801549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801553:	89 d1                	mov    %edx,%ecx
+  801555:	89 d3                	mov    %edx,%ebx
+  801557:	89 d7                	mov    %edx,%edi
+  801559:	89 d6                	mov    %edx,%esi
+  80155b:	cd 30                	int    $0x30
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	7f 08                	jg     801569 <sys_lease_complete+0x29>
+  801561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+  801569:	83 ec 0c             	sub    $0xc,%esp
+  80156c:	50                   	push   %eax
+  80156d:	6a 1b                	push   $0x1b
+  80156f:	68 eb 3c 80 00       	push   $0x803ceb
+  801574:	6a 24                	push   $0x24
+  801576:	68 08 3d 80 00       	push   $0x803d08
+  80157b:	e8 cc ec ff ff       	call   80024c <_panic>
+
+00801580 <sys_env_set_thisenv>:
+  801580:	55                   	push   %ebp
+  801581:	89 e5                	mov    %esp,%ebp
+  801583:	57                   	push   %edi
+  801584:	56                   	push   %esi
+  801585:	53                   	push   %ebx
+  801586:	83 ec 0c             	sub    $0xc,%esp
+  801589:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801591:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801594:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801599:	89 df                	mov    %ebx,%edi
+  80159b:	89 de                	mov    %ebx,%esi
+  80159d:	cd 30                	int    $0x30
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	7f 08                	jg     8015ab <sys_env_set_thisenv+0x2b>
+  8015a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a6:	5b                   	pop    %ebx
+  8015a7:	5e                   	pop    %esi
+  8015a8:	5f                   	pop    %edi
+  8015a9:	5d                   	pop    %ebp
+  8015aa:	c3                   	ret
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+  8015ae:	50                   	push   %eax
+  8015af:	6a 1c                	push   $0x1c
+  8015b1:	68 eb 3c 80 00       	push   $0x803ceb
+  8015b6:	6a 24                	push   $0x24
+  8015b8:	68 08 3d 80 00       	push   $0x803d08
+  8015bd:	e8 8a ec ff ff       	call   80024c <_panic>
+
+008015c2 <sys_env_set_sched>:
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	57                   	push   %edi
+  8015c6:	56                   	push   %esi
+  8015c7:	53                   	push   %ebx
+  8015c8:	83 ec 0c             	sub    $0xc,%esp
+  8015cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015de:	89 f7                	mov    %esi,%edi
+  8015e0:	cd 30                	int    $0x30
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	7f 08                	jg     8015ee <sys_env_set_sched+0x2c>
+  8015e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e9:	5b                   	pop    %ebx
+  8015ea:	5e                   	pop    %esi
+  8015eb:	5f                   	pop    %edi
+  8015ec:	5d                   	pop    %ebp
+  8015ed:	c3                   	ret
+  8015ee:	83 ec 0c             	sub    $0xc,%esp
+  8015f1:	50                   	push   %eax
+  8015f2:	6a 1d                	push   $0x1d
+  8015f4:	68 eb 3c 80 00       	push   $0x803ceb
+  8015f9:	6a 24                	push   $0x24
+  8015fb:	68 08 3d 80 00       	push   $0x803d08
+  801600:	e8 47 ec ff ff       	call   80024c <_panic>
+
+00801605 <sys_batch>:
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	57                   	push   %edi
+  801609:	56                   	push   %esi
+  80160a:	53                   	push   %ebx
+  80160b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801610:	8b 55 08             	mov    0x8(%ebp),%edx
+  801613:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801616:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80161b:	89 df                	mov    %ebx,%edi
+  80161d:	89 de                	mov    %ebx,%esi
+  80161f:	cd 30                	int    $0x30
+  801621:	5b                   	pop    %ebx
+  801622:	5e                   	pop    %esi
+  801623:	5f                   	pop    %edi
+  801624:	5d                   	pop    %ebp
+  801625:	c3                   	ret
+
+00801626 <sys_env_stats>:
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  801629:	57                   	push   %edi
+  80162a:	56                   	push   %esi
+  80162b:	53                   	push   %ebx
+  80162c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801631:	8b 55 08             	mov    0x8(%ebp),%edx
+  801634:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801637:	b8 23 00 00 00       	mov    $0x23,%eax
+  80163c:	89 df                	mov    %ebx,%edi
+  80163e:	89 de                	mov    %ebx,%esi
+  801640:	cd 30                	int    $0x30
+  801642:	5b                   	pop    %ebx
+  801643:	5e                   	pop    %esi
+  801644:	5f                   	pop    %edi
+  801645:	5d                   	pop    %ebp
+  801646:	c3                   	ret
+
+00801647 <sys_trace>:
+  801647:	55                   	push   %ebp
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	57                   	push   %edi
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+  80164d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801652:	8b 55 08             	mov    0x8(%ebp),%edx
+  801655:	b8 24 00 00 00       	mov    $0x24,%eax
+  80165a:	89 cb                	mov    %ecx,%ebx
+  80165c:	89 cf                	mov    %ecx,%edi
+  80165e:	89 ce                	mov    %ecx,%esi
+  801660:	cd 30                	int    $0x30
+  801662:	5b                   	pop    %ebx
+  801663:	5e                   	pop    %esi
+  801664:	5f                   	pop    %edi
+  801665:	5d                   	pop    %ebp
+  801666:	c3                   	ret
+
+00801667 <sys_env_set_pager>:
+  801667:	55                   	push   %ebp
+  801668:	89 e5                	mov    %esp,%ebp
+  80166a:	57                   	push   %edi
+  80166b:	56                   	push   %esi
+  80166c:	53                   	push   %ebx
+  80166d:	83 ec 0c             	sub    $0xc,%esp
+  801670:	be 00 00 00 00       	mov    $0x0,%esi
+  801675:	8b 55 08             	mov    0x8(%ebp),%edx
+  801678:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167b:	b8 25 00 00 00       	mov    $0x25,%eax
+  801680:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801683:	89 f7                	mov    %esi,%edi
+  801685:	cd 30                	int    $0x30
+  801687:	85 c0                	test   %eax,%eax
+  801689:	7f 08                	jg     801693 <sys_env_set_pager+0x2c>
+  80168b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168e:	5b                   	pop    %ebx
+  80168f:	5e                   	pop    %esi
+  801690:	5f                   	pop    %edi
+  801691:	5d                   	pop    %ebp
+  801692:	c3                   	ret
+  801693:	83 ec 0c             	sub    $0xc,%esp
+  801696:	50                   	push   %eax
+  801697:	6a 25                	push   $0x25
+  801699:	68 eb 3c 80 00       	push   $0x803ceb
+  80169e:	6a 24                	push   $0x24
+  8016a0:	68 08 3d 80 00       	push   $0x803d08
+  8016a5:	e8 a2 eb ff ff       	call   80024c <_panic>
+
+008016aa <sys_pager_retire>:
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	57                   	push   %edi
+  8016ae:	56                   	push   %esi
+  8016af:	53                   	push   %ebx
+  8016b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8016bd:	89 cb                	mov    %ecx,%ebx
+  8016bf:	89 cf                	mov    %ecx,%edi
+  8016c1:	89 ce                	mov    %ecx,%esi
+  8016c3:	cd 30                	int    $0x30
+  8016c5:	5b                   	pop    %ebx
+  8016c6:	5e                   	pop    %esi
+  8016c7:	5f                   	pop    %edi
+  8016c8:	5d                   	pop    %ebp
+  8016c9:	c3                   	ret
+
+008016ca <sys_prof>:
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	57                   	push   %edi
+  8016ce:	56                   	push   %esi
+  8016cf:	53                   	push   %ebx
+  8016d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016db:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e3:	89 f7                	mov    %esi,%edi
+  8016e5:	cd 30                	int    $0x30
+  8016e7:	5b                   	pop    %ebx
+  8016e8:	5e                   	pop    %esi
+  8016e9:	5f                   	pop    %edi
+  8016ea:	5d                   	pop    %ebp
+  8016eb:	c3                   	ret
+
+008016ec <dupq_flush>:
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	53                   	push   %ebx
+  8016f0:	83 ec 0c             	sub    $0xc,%esp
+  8016f3:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  8016f9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801700:	00 00 00 
+  801703:	53                   	push   %ebx
+  801704:	68 00 00 40 00       	push   $0x400000
+  801709:	e8 f7 fe ff ff       	call   801605 <sys_batch>
+  80170e:	83 c4 10             	add    $0x10,%esp
+  801711:	85 c0                	test   %eax,%eax
+  801713:	78 14                	js     801729 <dupq_flush+0x3d>
+  801715:	39 c3                	cmp    %eax,%ebx
+  801717:	7e 0b                	jle    801724 <dupq_flush+0x38>
+  801719:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80171c:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801722:	eb 05                	jmp    801729 <dupq_flush+0x3d>
+  801724:	b8 00 00 00 00       	mov    $0x0,%eax
+  801729:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80172c:	c9                   	leave
+  80172d:	c3                   	ret
+
+0080172e <pgfault>:
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	56                   	push   %esi
+  801732:	53                   	push   %ebx
+  801733:	8b 45 08             	mov    0x8(%ebp),%eax
+  801736:	8b 30                	mov    (%eax),%esi
+  801738:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80173c:	0f 84 83 00 00 00    	je     8017c5 <pgfault+0x97>
+  801742:	89 f0                	mov    %esi,%eax
+  801744:	c1 e8 0c             	shr    $0xc,%eax
+  801747:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80174e:	f6 c4 08             	test   $0x8,%ah
+  801751:	0f 84 80 00 00 00    	je     8017d7 <pgfault+0xa9>
+  801757:	e8 b8 f6 ff ff       	call   800e14 <sys_getenvid>
+  80175c:	89 c3                	mov    %eax,%ebx
+  80175e:	83 ec 04             	sub    $0x4,%esp
+  801761:	6a 07                	push   $0x7
+  801763:	68 00 f0 7f 00       	push   $0x7ff000
+  801768:	50                   	push   %eax
+  801769:	e8 10 f7 ff ff       	call   800e7e <sys_page_alloc>
+  80176e:	83 c4 10             	add    $0x10,%esp
+  801771:	85 c0                	test   %eax,%eax
+  801773:	78 74                	js     8017e9 <pgfault+0xbb>
+  801775:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80177b:	83 ec 04             	sub    $0x4,%esp
+  80177e:	68 00 10 00 00       	push   $0x1000
+  801783:	56                   	push   %esi
+  801784:	68 00 f0 7f 00       	push   $0x7ff000
+  801789:	e8 40 f4 ff ff       	call   800bce <memmove>
+  80178e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801795:	56                   	push   %esi
+  801796:	53                   	push   %ebx
+  801797:	68 00 f0 7f 00       	push   $0x7ff000
+  80179c:	53                   	push   %ebx
+  80179d:	e8 1f f7 ff ff       	call   800ec1 <sys_page_map>
+  8017a2:	83 c4 20             	add    $0x20,%esp
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 54                	js     8017fd <pgfault+0xcf>
+  8017a9:	83 ec 08             	sub    $0x8,%esp
+  8017ac:	68 00 f0 7f 00       	push   $0x7ff000
+  8017b1:	53                   	push   %ebx
+  8017b2:	e8 99 f7 ff ff       	call   800f50 <sys_page_unmap>
+  8017b7:	83 c4 10             	add    $0x10,%esp
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	78 53                	js     801811 <pgfault+0xe3>
+  8017be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+  8017c5:	56                   	push   %esi
+  8017c6:	68 18 3d 80 00       	push   $0x803d18
+  8017cb:	6a 19                	push   $0x19
+  8017cd:	68 f4 3d 80 00       	push   $0x803df4
+  8017d2:	e8 75 ea ff ff       	call   80024c <_panic>
+  8017d7:	56                   	push   %esi
+  8017d8:	68 4c 3d 80 00       	push   $0x803d4c
+  8017dd:	6a 1e                	push   $0x1e
+  8017df:	68 f4 3d 80 00       	push   $0x803df4
+  8017e4:	e8 63 ea ff ff       	call   80024c <_panic>
+  8017e9:	83 ec 04             	sub    $0x4,%esp
+  8017ec:	68 80 3d 80 00       	push   $0x803d80
+  8017f1:	6a 2e                	push   $0x2e
+  8017f3:	68 f4 3d 80 00       	push   $0x803df4
+  8017f8:	e8 4f ea ff ff       	call   80024c <_panic>
+  8017fd:	83 ec 04             	sub    $0x4,%esp
+  801800:	68 a4 3d 80 00       	push   $0x803da4
+  801805:	6a 37                	push   $0x37
+  801807:	68 f4 3d 80 00       	push   $0x803df4
+  80180c:	e8 3b ea ff ff       	call   80024c <_panic>
+  801811:	83 ec 04             	sub    $0x4,%esp
+  801814:	68 d0 3d 80 00       	push   $0x803dd0
+  801819:	6a 3c                	push   $0x3c
+  80181b:	68 f4 3d 80 00       	push   $0x803df4
+  801820:	e8 27 ea ff ff       	call   80024c <_panic>
+
+00801825 <dupq_begin>:
+  801825:	55                   	push   %ebp
+  801826:	89 e5                	mov    %esp,%ebp
+  801828:	83 ec 0c             	sub    $0xc,%esp
+  80182b:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801832:	00 00 00 
+  801835:	6a 07                	push   $0x7
+  801837:	68 00 00 40 00       	push   $0x400000
+  80183c:	6a 00                	push   $0x0
+  80183e:	e8 3b f6 ff ff       	call   800e7e <sys_page_alloc>
+  801843:	c9                   	leave
+  801844:	c3                   	ret
+
+00801845 <dupq_map>:
+  801845:	55                   	push   %ebp
+  801846:	89 e5                	mov    %esp,%ebp
+  801848:	83 ec 08             	sub    $0x8,%esp
+  80184b:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  801852:	00 00 00 
+  801855:	74 46                	je     80189d <dupq_map+0x58>
+  801857:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80185d:	8d 42 01             	lea    0x1(%edx),%eax
+  801860:	a3 00 60 80 00       	mov    %eax,0x806000
+  801865:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801868:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80186e:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801875:	00 00 00 
+  801878:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187b:	89 50 04             	mov    %edx,0x4(%eax)
+  80187e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801881:	c1 e2 0c             	shl    $0xc,%edx
+  801884:	89 50 08             	mov    %edx,0x8(%eax)
+  801887:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80188a:	89 48 0c             	mov    %ecx,0xc(%eax)
+  80188d:	89 50 10             	mov    %edx,0x10(%eax)
+  801890:	8b 55 14             	mov    0x14(%ebp),%edx
+  801893:	89 50 14             	mov    %edx,0x14(%eax)
+  801896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189b:	c9                   	leave
+  80189c:	c3                   	ret
+  80189d:	e8 4a fe ff ff       	call   8016ec <dupq_flush>
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	79 b1                	jns    801857 <dupq_map+0x12>
+  8018a6:	eb f3                	jmp    80189b <dupq_map+0x56>
+
+008018a8 <dupq_end>:
+  8018a8:	55                   	push   %ebp
+  8018a9:	89 e5                	mov    %esp,%ebp
+  8018ab:	53                   	push   %ebx
+  8018ac:	83 ec 04             	sub    $0x4,%esp
+  8018af:	e8 38 fe ff ff       	call   8016ec <dupq_flush>
+  8018b4:	89 c3                	mov    %eax,%ebx
+  8018b6:	83 ec 08             	sub    $0x8,%esp
+  8018b9:	68 00 00 40 00       	push   $0x400000
+  8018be:	6a 00                	push   $0x0
+  8018c0:	e8 8b f6 ff ff       	call   800f50 <sys_page_unmap>
+  8018c5:	89 d8                	mov    %ebx,%eax
+  8018c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ca:	c9                   	leave
+  8018cb:	c3                   	ret
+
+008018cc <fork>:
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	53                   	push   %ebx
+  8018d0:	83 ec 10             	sub    $0x10,%esp
+  8018d3:	68 2e 17 80 00       	push   $0x80172e
+  8018d8:	e8 9f 1a 00 00       	call   80337c <set_pgfault_handler>
+  8018dd:	83 c4 08             	add    $0x8,%esp
+  8018e0:	6a 01                	push   $0x1
+  8018e2:	6a 00                	push   $0x0
+  8018e4:	e8 4c f7 ff ff       	call   801035 <sys_env_set_cow>
+  8018e9:	e8 a4 f6 ff ff       	call   800f92 <sys_fork>
+  8018ee:	89 c3                	mov    %eax,%ebx
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	74 07                	je     8018fe <fork+0x32>
+  8018f7:	89 d8                	mov    %ebx,%eax
+  8018f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018fc:	c9                   	leave
+  8018fd:	c3                   	ret
+  8018fe:	e8 11 f5 ff ff       	call   800e14 <sys_getenvid>
+  801903:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801908:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80190e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801913:	a3 14 60 80 00       	mov    %eax,0x806014
+  801918:	eb dd                	jmp    8018f7 <fork+0x2b>
+
+0080191a <sfork>:
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	57                   	push   %edi
+  80191e:	56                   	push   %esi
+  80191f:	53                   	push   %ebx
+  801920:	83 ec 1c             	sub    $0x1c,%esp
+  801923:	e8 ec f4 ff ff       	call   800e14 <sys_getenvid>
+  801928:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80192b:	83 ec 0c             	sub    $0xc,%esp
+  80192e:	68 2e 17 80 00       	push   $0x80172e
+  801933:	e8 44 1a 00 00       	call   80337c <set_pgfault_handler>
+  801938:	b8 07 00 00 00       	mov    $0x7,%eax
+  80193d:	cd 30                	int    $0x30
+  80193f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801942:	83 c4 10             	add    $0x10,%esp
+  801945:	85 c0                	test   %eax,%eax
+  801947:	0f 88 45 02 00 00    	js     801b92 <sfork+0x278>
+  80194d:	89 c6                	mov    %eax,%esi
+  80194f:	74 17                	je     801968 <sfork+0x4e>
+  801951:	e8 cf fe ff ff       	call   801825 <dupq_begin>
+  801956:	85 c0                	test   %eax,%eax
+  801958:	0f 88 40 02 00 00    	js     801b9e <sfork+0x284>
+  80195e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801963:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801966:	eb 39                	jmp    8019a1 <sfork+0x87>
+  801968:	e8 a7 f4 ff ff       	call   800e14 <sys_getenvid>
+  80196d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801972:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801978:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80197d:	a3 14 60 80 00       	mov    %eax,0x806014
+  801982:	e9 23 01 00 00       	jmp    801aaa <sfork+0x190>
+  801987:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80198e:	a8 01                	test   $0x1,%al
+  801990:	75 5b                	jne    8019ed <sfork+0xd3>
+  801992:	83 c7 01             	add    $0x1,%edi
+  801995:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  80199b:	0f 84 40 01 00 00    	je     801ae1 <sfork+0x1c7>
+  8019a1:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8019a8:	a8 01                	test   $0x1,%al
+  8019aa:	74 db                	je     801987 <sfork+0x6d>
+  8019ac:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8019b3:	a8 80                	test   $0x80,%al
+  8019b5:	74 d0                	je     801987 <sfork+0x6d>
+  8019b7:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  8019be:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019c3:	0c 80                	or     $0x80,%al
+  8019c5:	50                   	push   %eax
+  8019c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8019c9:	89 f8                	mov    %edi,%eax
+  8019cb:	c1 e0 16             	shl    $0x16,%eax
+  8019ce:	c1 e8 0c             	shr    $0xc,%eax
+  8019d1:	50                   	push   %eax
+  8019d2:	ff 75 e0             	push   -0x20(%ebp)
+  8019d5:	e8 6b fe ff ff       	call   801845 <dupq_map>
+  8019da:	83 c4 10             	add    $0x10,%esp
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	79 b1                	jns    801992 <sfork+0x78>
+  8019e1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8019e8:	e9 bd 00 00 00       	jmp    801aaa <sfork+0x190>
+  8019ed:	89 fe                	mov    %edi,%esi
+  8019ef:	c1 e6 16             	shl    $0x16,%esi
+  8019f2:	89 f0                	mov    %esi,%eax
+  8019f4:	c1 e8 0c             	shr    $0xc,%eax
+  8019f7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8019fc:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8019ff:	eb 57                	jmp    801a58 <sfork+0x13e>
+  801a01:	e8 0e f4 ff ff       	call   800e14 <sys_getenvid>
+  801a06:	89 c7                	mov    %eax,%edi
+  801a08:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801a0d:	f6 c4 04             	test   $0x4,%ah
+  801a10:	0f 85 9f 00 00 00    	jne    801ab5 <sfork+0x19b>
+  801a16:	a9 02 08 00 00       	test   $0x802,%eax
+  801a1b:	0f 85 c5 01 00 00    	jne    801be6 <sfork+0x2cc>
+  801a21:	6a 05                	push   $0x5
+  801a23:	ff 75 e4             	push   -0x1c(%ebp)
+  801a26:	68 fd e7 0e 00       	push   $0xee7fd
+  801a2b:	57                   	push   %edi
+  801a2c:	e8 14 fe ff ff       	call   801845 <dupq_map>
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801a3a:	0f 84 91 00 00 00    	je     801ad1 <sfork+0x1b7>
+  801a40:	89 f0                	mov    %esi,%eax
+  801a42:	09 d8                	or     %ebx,%eax
+  801a44:	c1 e8 0c             	shr    $0xc,%eax
+  801a47:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a4d:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801a52:	0f 84 81 00 00 00    	je     801ad9 <sfork+0x1bf>
+  801a58:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801a5d:	74 a2                	je     801a01 <sfork+0xe7>
+  801a5f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a66:	f6 c2 01             	test   $0x1,%dl
+  801a69:	74 c9                	je     801a34 <sfork+0x11a>
+  801a6b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a72:	f6 c6 02             	test   $0x2,%dh
+  801a75:	75 bd                	jne    801a34 <sfork+0x11a>
+  801a77:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801a7e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a85:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801a8b:	f7 d2                	not    %edx
+  801a8d:	21 ca                	and    %ecx,%edx
+  801a8f:	52                   	push   %edx
+  801a90:	ff 75 e4             	push   -0x1c(%ebp)
+  801a93:	50                   	push   %eax
+  801a94:	ff 75 e0             	push   -0x20(%ebp)
+  801a97:	e8 a9 fd ff ff       	call   801845 <dupq_map>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	85 c0                	test   %eax,%eax
+  801aa1:	79 91                	jns    801a34 <sfork+0x11a>
+  801aa3:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801aaa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801aad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab0:	5b                   	pop    %ebx
+  801ab1:	5e                   	pop    %esi
+  801ab2:	5f                   	pop    %edi
+  801ab3:	5d                   	pop    %ebp
+  801ab4:	c3                   	ret
+  801ab5:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aba:	50                   	push   %eax
+  801abb:	ff 75 e4             	push   -0x1c(%ebp)
+  801abe:	68 fd e7 0e 00       	push   $0xee7fd
+  801ac3:	57                   	push   %edi
+  801ac4:	e8 7c fd ff ff       	call   801845 <dupq_map>
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	e9 63 ff ff ff       	jmp    801a34 <sfork+0x11a>
+  801ad1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801ad4:	e9 b9 fe ff ff       	jmp    801992 <sfork+0x78>
+  801ad9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801adc:	e9 b1 fe ff ff       	jmp    801992 <sfork+0x78>
+  801ae1:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801ae4:	e8 bf fd ff ff       	call   8018a8 <dupq_end>
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	0f 88 b9 00 00 00    	js     801baa <sfork+0x290>
+  801af1:	83 ec 04             	sub    $0x4,%esp
+  801af4:	6a 07                	push   $0x7
+  801af6:	68 00 f0 7f ee       	push   $0xee7ff000
+  801afb:	56                   	push   %esi
+  801afc:	e8 7d f3 ff ff       	call   800e7e <sys_page_alloc>
+  801b01:	83 c4 10             	add    $0x10,%esp
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	0f 88 aa 00 00 00    	js     801bb6 <sfork+0x29c>
+  801b0c:	83 ec 0c             	sub    $0xc,%esp
+  801b0f:	6a 07                	push   $0x7
+  801b11:	68 00 f0 7f 00       	push   $0x7ff000
+  801b16:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801b19:	57                   	push   %edi
+  801b1a:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b1f:	56                   	push   %esi
+  801b20:	e8 9c f3 ff ff       	call   800ec1 <sys_page_map>
+  801b25:	83 c4 20             	add    $0x20,%esp
+  801b28:	85 c0                	test   %eax,%eax
+  801b2a:	0f 88 92 00 00 00    	js     801bc2 <sfork+0x2a8>
+  801b30:	83 ec 04             	sub    $0x4,%esp
+  801b33:	68 00 10 00 00       	push   $0x1000
+  801b38:	68 00 f0 7f 00       	push   $0x7ff000
+  801b3d:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b42:	e8 87 f0 ff ff       	call   800bce <memmove>
+  801b47:	83 c4 08             	add    $0x8,%esp
+  801b4a:	68 00 f0 7f 00       	push   $0x7ff000
+  801b4f:	57                   	push   %edi
+  801b50:	e8 fb f3 ff ff       	call   800f50 <sys_page_unmap>
+  801b55:	83 c4 10             	add    $0x10,%esp
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	78 72                	js     801bce <sfork+0x2b4>
+  801b5c:	83 ec 08             	sub    $0x8,%esp
+  801b5f:	68 f4 33 80 00       	push   $0x8033f4
+  801b64:	56                   	push   %esi
+  801b65:	e8 2d f5 ff ff       	call   801097 <sys_env_set_pgfault_upcall>
+  801b6a:	83 c4 10             	add    $0x10,%esp
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	78 69                	js     801bda <sfork+0x2c0>
+  801b71:	83 ec 08             	sub    $0x8,%esp
+  801b74:	6a 02                	push   $0x2
+  801b76:	56                   	push   %esi
+  801b77:	e8 35 f4 ff ff       	call   800fb1 <sys_env_set_status>
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801b86:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801b8a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b8d:	e9 18 ff ff ff       	jmp    801aaa <sfork+0x190>
+  801b92:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b99:	e9 0c ff ff ff       	jmp    801aaa <sfork+0x190>
+  801b9e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ba5:	e9 00 ff ff ff       	jmp    801aaa <sfork+0x190>
+  801baa:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801bb1:	e9 f4 fe ff ff       	jmp    801aaa <sfork+0x190>
+  801bb6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801bbd:	e9 e8 fe ff ff       	jmp    801aaa <sfork+0x190>
+  801bc2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801bc9:	e9 dc fe ff ff       	jmp    801aaa <sfork+0x190>
+  801bce:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801bd5:	e9 d0 fe ff ff       	jmp    801aaa <sfork+0x190>
+  801bda:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801be1:	e9 c4 fe ff ff       	jmp    801aaa <sfork+0x190>
+  801be6:	68 05 08 00 00       	push   $0x805
+  801beb:	ff 75 e4             	push   -0x1c(%ebp)
+  801bee:	68 fd e7 0e 00       	push   $0xee7fd
+  801bf3:	57                   	push   %edi
+  801bf4:	e8 4c fc ff ff       	call   801845 <dupq_map>
+  801bf9:	83 c4 10             	add    $0x10,%esp
+  801bfc:	85 c0                	test   %eax,%eax
+  801bfe:	0f 88 30 fe ff ff    	js     801a34 <sfork+0x11a>
+  801c04:	68 05 08 00 00       	push   $0x805
+  801c09:	57                   	push   %edi
+  801c0a:	68 fd e7 0e 00       	push   $0xee7fd
+  801c0f:	57                   	push   %edi
+  801c10:	e8 30 fc ff ff       	call   801845 <dupq_map>
+  801c15:	83 c4 10             	add    $0x10,%esp
+  801c18:	e9 17 fe ff ff       	jmp    801a34 <sfork+0x11a>
+
+00801c1d <fd2num>:
+  801c1d:	55                   	push   %ebp
+  801c1e:	89 e5                	mov    %esp,%ebp
+  801c20:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c23:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c28:	c1 e8 0c             	shr    $0xc,%eax
+  801c2b:	5d                   	pop    %ebp
+  801c2c:	c3                   	ret
+
+00801c2d <fd2data>:
+  801c2d:	55                   	push   %ebp
+  801c2e:	89 e5                	mov    %esp,%ebp
+  801c30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c33:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c38:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c3d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801c42:	5d                   	pop    %ebp
+  801c43:	c3                   	ret
+
+00801c44 <fd_alloc>:
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801c4c:	89 c2                	mov    %eax,%edx
+  801c4e:	c1 ea 16             	shr    $0x16,%edx
+  801c51:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c58:	f6 c2 01             	test   $0x1,%dl
+  801c5b:	74 29                	je     801c86 <fd_alloc+0x42>
+  801c5d:	89 c2                	mov    %eax,%edx
+  801c5f:	c1 ea 0c             	shr    $0xc,%edx
+  801c62:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c69:	f6 c2 01             	test   $0x1,%dl
+  801c6c:	74 18                	je     801c86 <fd_alloc+0x42>
+  801c6e:	05 00 10 00 00       	add    $0x1000,%eax
+  801c73:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801c78:	75 d2                	jne    801c4c <fd_alloc+0x8>
+  801c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c84:	eb 05                	jmp    801c8b <fd_alloc+0x47>
+  801c86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c8e:	89 02                	mov    %eax,(%edx)
+  801c90:	89 c8                	mov    %ecx,%eax
+  801c92:	5d                   	pop    %ebp
+  801c93:	c3                   	ret
+
+00801c94 <fd_lookup>:
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c9a:	83 f8 1f             	cmp    $0x1f,%eax
+  801c9d:	77 30                	ja     801ccf <fd_lookup+0x3b>
+  801c9f:	c1 e0 0c             	shl    $0xc,%eax
+  801ca2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801ca7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801cad:	f6 c2 01             	test   $0x1,%dl
+  801cb0:	74 24                	je     801cd6 <fd_lookup+0x42>
+  801cb2:	89 c2                	mov    %eax,%edx
+  801cb4:	c1 ea 0c             	shr    $0xc,%edx
+  801cb7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801cbe:	f6 c2 01             	test   $0x1,%dl
+  801cc1:	74 1a                	je     801cdd <fd_lookup+0x49>
+  801cc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cc6:	89 02                	mov    %eax,(%edx)
+  801cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccd:	5d                   	pop    %ebp
+  801cce:	c3                   	ret
+  801ccf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd4:	eb f7                	jmp    801ccd <fd_lookup+0x39>
+  801cd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cdb:	eb f0                	jmp    801ccd <fd_lookup+0x39>
+  801cdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce2:	eb e9                	jmp    801ccd <fd_lookup+0x39>
+
+00801ce4 <dev_lookup>:
+  801ce4:	55                   	push   %ebp
+  801ce5:	89 e5                	mov    %esp,%ebp
+  801ce7:	53                   	push   %ebx
+  801ce8:	83 ec 04             	sub    $0x4,%esp
+  801ceb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf3:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  801cf8:	39 13                	cmp    %edx,(%ebx)
+  801cfa:	74 37                	je     801d33 <dev_lookup+0x4f>
+  801cfc:	83 c0 01             	add    $0x1,%eax
+  801cff:	8b 1c 85 7c 3e 80 00 	mov    0x803e7c(,%eax,4),%ebx
+  801d06:	85 db                	test   %ebx,%ebx
+  801d08:	75 ee                	jne    801cf8 <dev_lookup+0x14>
+  801d0a:	a1 14 60 80 00       	mov    0x806014,%eax
+  801d0f:	8b 40 48             	mov    0x48(%eax),%eax
+  801d12:	83 ec 04             	sub    $0x4,%esp
+  801d15:	52                   	push   %edx
+  801d16:	50                   	push   %eax
+  801d17:	68 00 3e 80 00       	push   $0x803e00
+  801d1c:	e8 06 e6 ff ff       	call   800327 <cprintf>
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d2c:	89 1a                	mov    %ebx,(%edx)
+  801d2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d31:	c9                   	leave
+  801d32:	c3                   	ret
+  801d33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d38:	eb ef                	jmp    801d29 <dev_lookup+0x45>
+
+00801d3a <fd_close>:
+  801d3a:	55                   	push   %ebp
+  801d3b:	89 e5                	mov    %esp,%ebp
+  801d3d:	57                   	push   %edi
+  801d3e:	56                   	push   %esi
+  801d3f:	53                   	push   %ebx
+  801d40:	83 ec 24             	sub    $0x24,%esp
+  801d43:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d46:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801d49:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d4c:	50                   	push   %eax
+  801d4d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d53:	c1 e8 0c             	shr    $0xc,%eax
+  801d56:	50                   	push   %eax
+  801d57:	e8 38 ff ff ff       	call   801c94 <fd_lookup>
+  801d5c:	89 c3                	mov    %eax,%ebx
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	78 05                	js     801d6a <fd_close+0x30>
+  801d65:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d68:	74 0f                	je     801d79 <fd_close+0x3f>
+  801d6a:	85 ff                	test   %edi,%edi
+  801d6c:	0f 44 df             	cmove  %edi,%ebx
+  801d6f:	89 d8                	mov    %ebx,%eax
+  801d71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d74:	5b                   	pop    %ebx
+  801d75:	5e                   	pop    %esi
+  801d76:	5f                   	pop    %edi
+  801d77:	5d                   	pop    %ebp
+  801d78:	c3                   	ret
+  801d79:	83 ec 08             	sub    $0x8,%esp
+  801d7c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d7f:	50                   	push   %eax
+  801d80:	ff 36                	push   (%esi)
+  801d82:	e8 5d ff ff ff       	call   801ce4 <dev_lookup>
+  801d87:	89 c3                	mov    %eax,%ebx
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 1a                	js     801daa <fd_close+0x70>
+  801d90:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d93:	8b 40 10             	mov    0x10(%eax),%eax
+  801d96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	74 0b                	je     801daa <fd_close+0x70>
+  801d9f:	83 ec 0c             	sub    $0xc,%esp
+  801da2:	56                   	push   %esi
+  801da3:	ff d0                	call   *%eax
+  801da5:	89 c3                	mov    %eax,%ebx
+  801da7:	83 c4 10             	add    $0x10,%esp
+  801daa:	83 ec 08             	sub    $0x8,%esp
+  801dad:	56                   	push   %esi
+  801dae:	6a 00                	push   $0x0
+  801db0:	e8 9b f1 ff ff       	call   800f50 <sys_page_unmap>
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	eb b5                	jmp    801d6f <fd_close+0x35>
+
+00801dba <close>:
+  801dba:	55                   	push   %ebp
+  801dbb:	89 e5                	mov    %esp,%ebp
+  801dbd:	83 ec 20             	sub    $0x20,%esp
+  801dc0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc3:	50                   	push   %eax
+  801dc4:	ff 75 08             	push   0x8(%ebp)
+  801dc7:	e8 c8 fe ff ff       	call   801c94 <fd_lookup>
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	79 02                	jns    801dd5 <close+0x1b>
+  801dd3:	c9                   	leave
+  801dd4:	c3                   	ret
+  801dd5:	83 ec 08             	sub    $0x8,%esp
+  801dd8:	6a 01                	push   $0x1
+  801dda:	ff 75 f4             	push   -0xc(%ebp)
+  801ddd:	e8 58 ff ff ff       	call   801d3a <fd_close>
+  801de2:	83 c4 10             	add    $0x10,%esp
+  801de5:	eb ec                	jmp    801dd3 <close+0x19>
+
+00801de7 <close_all>:
+  801de7:	55                   	push   %ebp
+  801de8:	89 e5                	mov    %esp,%ebp
+  801dea:	53                   	push   %ebx
+  801deb:	83 ec 04             	sub    $0x4,%esp
+  801dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801df3:	83 ec 0c             	sub    $0xc,%esp
+  801df6:	53                   	push   %ebx
+  801df7:	e8 be ff ff ff       	call   801dba <close>
+  801dfc:	83 c3 01             	add    $0x1,%ebx
+  801dff:	83 c4 10             	add    $0x10,%esp
+  801e02:	83 fb 20             	cmp    $0x20,%ebx
+  801e05:	75 ec                	jne    801df3 <close_all+0xc>
+  801e07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0a:	c9                   	leave
+  801e0b:	c3                   	ret
+
+00801e0c <dup>:
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	57                   	push   %edi
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 34             	sub    $0x34,%esp
+  801e15:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e18:	50                   	push   %eax
+  801e19:	ff 75 08             	push   0x8(%ebp)
+  801e1c:	e8 73 fe ff ff       	call   801c94 <fd_lookup>
+  801e21:	89 c3                	mov    %eax,%ebx
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 7f                	js     801ea9 <dup+0x9d>
+  801e2a:	83 ec 0c             	sub    $0xc,%esp
+  801e2d:	ff 75 0c             	push   0xc(%ebp)
+  801e30:	e8 85 ff ff ff       	call   801dba <close>
+  801e35:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e38:	c1 e6 0c             	shl    $0xc,%esi
+  801e3b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801e41:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e44:	89 3c 24             	mov    %edi,(%esp)
+  801e47:	e8 e1 fd ff ff       	call   801c2d <fd2data>
+  801e4c:	89 c3                	mov    %eax,%ebx
+  801e4e:	89 34 24             	mov    %esi,(%esp)
+  801e51:	e8 d7 fd ff ff       	call   801c2d <fd2data>
+  801e56:	83 c4 10             	add    $0x10,%esp
+  801e59:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e5c:	89 d8                	mov    %ebx,%eax
+  801e5e:	c1 e8 16             	shr    $0x16,%eax
+  801e61:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e68:	a8 01                	test   $0x1,%al
+  801e6a:	74 11                	je     801e7d <dup+0x71>
+  801e6c:	89 d8                	mov    %ebx,%eax
+  801e6e:	c1 e8 0c             	shr    $0xc,%eax
+  801e71:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e78:	f6 c2 01             	test   $0x1,%dl
+  801e7b:	75 36                	jne    801eb3 <dup+0xa7>
+  801e7d:	89 f8                	mov    %edi,%eax
+  801e7f:	c1 e8 0c             	shr    $0xc,%eax
+  801e82:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e89:	83 ec 0c             	sub    $0xc,%esp
+  801e8c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e91:	50                   	push   %eax
+  801e92:	56                   	push   %esi
+  801e93:	6a 00                	push   $0x0
+  801e95:	57                   	push   %edi
+  801e96:	6a 00                	push   $0x0
+  801e98:	e8 24 f0 ff ff       	call   800ec1 <sys_page_map>
+  801e9d:	89 c3                	mov    %eax,%ebx
+  801e9f:	83 c4 20             	add    $0x20,%esp
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 33                	js     801ed9 <dup+0xcd>
+  801ea6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801ea9:	89 d8                	mov    %ebx,%eax
+  801eab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eae:	5b                   	pop    %ebx
+  801eaf:	5e                   	pop    %esi
+  801eb0:	5f                   	pop    %edi
+  801eb1:	5d                   	pop    %ebp
+  801eb2:	c3                   	ret
+  801eb3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801eba:	83 ec 0c             	sub    $0xc,%esp
+  801ebd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ec2:	50                   	push   %eax
+  801ec3:	ff 75 d4             	push   -0x2c(%ebp)
+  801ec6:	6a 00                	push   $0x0
+  801ec8:	53                   	push   %ebx
+  801ec9:	6a 00                	push   $0x0
+  801ecb:	e8 f1 ef ff ff       	call   800ec1 <sys_page_map>
+  801ed0:	89 c3                	mov    %eax,%ebx
+  801ed2:	83 c4 20             	add    $0x20,%esp
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	79 a4                	jns    801e7d <dup+0x71>
+  801ed9:	83 ec 08             	sub    $0x8,%esp
+  801edc:	56                   	push   %esi
+  801edd:	6a 00                	push   $0x0
+  801edf:	e8 6c f0 ff ff       	call   800f50 <sys_page_unmap>
+  801ee4:	83 c4 08             	add    $0x8,%esp
+  801ee7:	ff 75 d4             	push   -0x2c(%ebp)
+  801eea:	6a 00                	push   $0x0
+  801eec:	e8 5f f0 ff ff       	call   800f50 <sys_page_unmap>
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	eb b3                	jmp    801ea9 <dup+0x9d>
+
+00801ef6 <read>:
+  801ef6:	55                   	push   %ebp
+  801ef7:	89 e5                	mov    %esp,%ebp
+  801ef9:	56                   	push   %esi
+  801efa:	53                   	push   %ebx
+  801efb:	83 ec 18             	sub    $0x18,%esp
+  801efe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f01:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f04:	50                   	push   %eax
+  801f05:	56                   	push   %esi
+  801f06:	e8 89 fd ff ff       	call   801c94 <fd_lookup>
+  801f0b:	83 c4 10             	add    $0x10,%esp
+  801f0e:	85 c0                	test   %eax,%eax
+  801f10:	78 3c                	js     801f4e <read+0x58>
+  801f12:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801f15:	83 ec 08             	sub    $0x8,%esp
+  801f18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1b:	50                   	push   %eax
+  801f1c:	ff 33                	push   (%ebx)
+  801f1e:	e8 c1 fd ff ff       	call   801ce4 <dev_lookup>
+  801f23:	83 c4 10             	add    $0x10,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	78 24                	js     801f4e <read+0x58>
+  801f2a:	8b 43 08             	mov    0x8(%ebx),%eax
+  801f2d:	83 e0 03             	and    $0x3,%eax
+  801f30:	83 f8 01             	cmp    $0x1,%eax
+  801f33:	74 20                	je     801f55 <read+0x5f>
+  801f35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f38:	8b 40 08             	mov    0x8(%eax),%eax
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	74 37                	je     801f76 <read+0x80>
+  801f3f:	83 ec 04             	sub    $0x4,%esp
+  801f42:	ff 75 10             	push   0x10(%ebp)
+  801f45:	ff 75 0c             	push   0xc(%ebp)
+  801f48:	53                   	push   %ebx
+  801f49:	ff d0                	call   *%eax
+  801f4b:	83 c4 10             	add    $0x10,%esp
+  801f4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f51:	5b                   	pop    %ebx
+  801f52:	5e                   	pop    %esi
+  801f53:	5d                   	pop    %ebp
+  801f54:	c3                   	ret
+  801f55:	a1 14 60 80 00       	mov    0x806014,%eax
+  801f5a:	8b 40 48             	mov    0x48(%eax),%eax
+  801f5d:	83 ec 04             	sub    $0x4,%esp
+  801f60:	56                   	push   %esi
+  801f61:	50                   	push   %eax
+  801f62:	68 41 3e 80 00       	push   $0x803e41
+  801f67:	e8 bb e3 ff ff       	call   800327 <cprintf>
+  801f6c:	83 c4 10             	add    $0x10,%esp
+  801f6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f74:	eb d8                	jmp    801f4e <read+0x58>
+  801f76:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f7b:	eb d1                	jmp    801f4e <read+0x58>
+
+00801f7d <readn>:
+  801f7d:	55                   	push   %ebp
+  801f7e:	89 e5                	mov    %esp,%ebp
+  801f80:	57                   	push   %edi
+  801f81:	56                   	push   %esi
+  801f82:	53                   	push   %ebx
+  801f83:	83 ec 0c             	sub    $0xc,%esp
+  801f86:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f89:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f8c:	85 f6                	test   %esi,%esi
+  801f8e:	74 30                	je     801fc0 <readn+0x43>
+  801f90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9a:	83 ec 04             	sub    $0x4,%esp
+  801f9d:	89 f2                	mov    %esi,%edx
+  801f9f:	29 c2                	sub    %eax,%edx
+  801fa1:	52                   	push   %edx
+  801fa2:	01 f8                	add    %edi,%eax
+  801fa4:	50                   	push   %eax
+  801fa5:	ff 75 08             	push   0x8(%ebp)
+  801fa8:	e8 49 ff ff ff       	call   801ef6 <read>
+  801fad:	83 c4 10             	add    $0x10,%esp
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	78 15                	js     801fc9 <readn+0x4c>
+  801fb4:	74 11                	je     801fc7 <readn+0x4a>
+  801fb6:	01 c3                	add    %eax,%ebx
+  801fb8:	89 d8                	mov    %ebx,%eax
+  801fba:	39 f3                	cmp    %esi,%ebx
+  801fbc:	72 dc                	jb     801f9a <readn+0x1d>
+  801fbe:	eb 09                	jmp    801fc9 <readn+0x4c>
+  801fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc5:	eb 02                	jmp    801fc9 <readn+0x4c>
+  801fc7:	89 d8                	mov    %ebx,%eax
+  801fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fcc:	5b                   	pop    %ebx
+  801fcd:	5e                   	pop    %esi
+  801fce:	5f                   	pop    %edi
+  801fcf:	5d                   	pop    %ebp
+  801fd0:	c3                   	ret
+
+00801fd1 <write>:
+  801fd1:	55                   	push   %ebp
+  801fd2:	89 e5                	mov    %esp,%ebp
+  801fd4:	56                   	push   %esi
+  801fd5:	53                   	push   %ebx
+  801fd6:	83 ec 18             	sub    $0x18,%esp
+  801fd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801fdc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fdf:	50                   	push   %eax
+  801fe0:	53                   	push   %ebx
+  801fe1:	e8 ae fc ff ff       	call   801c94 <fd_lookup>
+  801fe6:	83 c4 10             	add    $0x10,%esp
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 37                	js     802024 <write+0x53>
+  801fed:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ff0:	83 ec 08             	sub    $0x8,%esp
+  801ff3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff6:	50                   	push   %eax
+  801ff7:	ff 36                	push   (%esi)
+  801ff9:	e8 e6 fc ff ff       	call   801ce4 <dev_lookup>
+  801ffe:	83 c4 10             	add    $0x10,%esp
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 1f                	js     802024 <write+0x53>
+  802005:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802009:	74 20                	je     80202b <write+0x5a>
+  80200b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80200e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802011:	85 c0                	test   %eax,%eax
+  802013:	74 37                	je     80204c <write+0x7b>
+  802015:	83 ec 04             	sub    $0x4,%esp
+  802018:	ff 75 10             	push   0x10(%ebp)
+  80201b:	ff 75 0c             	push   0xc(%ebp)
+  80201e:	56                   	push   %esi
+  80201f:	ff d0                	call   *%eax
+  802021:	83 c4 10             	add    $0x10,%esp
+  802024:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802027:	5b                   	pop    %ebx
+  802028:	5e                   	pop    %esi
+  802029:	5d                   	pop    %ebp
+  80202a:	c3                   	ret
+  80202b:	a1 14 60 80 00       	mov    0x806014,%eax
+  802030:	8b 40 48             	mov    0x48(%eax),%eax
+  802033:	83 ec 04             	sub    $0x4,%esp
+  802036:	53                   	push   %ebx
+  802037:	50                   	push   %eax
+  802038:	68 5d 3e 80 00       	push   $0x803e5d
+  80203d:	e8 e5 e2 ff ff       	call   800327 <cprintf>
+  802042:	83 c4 10             	add    $0x10,%esp
+  802045:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80204a:	eb d8                	jmp    802024 <write+0x53>
+  80204c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802051:	eb d1                	jmp    802024 <write+0x53>
+
+00802053 <seek>:
+  802053:	55                   	push   %ebp
+  802054:	89 e5                	mov    %esp,%ebp
+  802056:	83 ec 20             	sub    $0x20,%esp
+  802059:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205c:	50                   	push   %eax
+  80205d:	ff 75 08             	push   0x8(%ebp)
+  802060:	e8 2f fc ff ff       	call   801c94 <fd_lookup>
+  802065:	83 c4 10             	add    $0x10,%esp
+  802068:	85 c0                	test   %eax,%eax
+  80206a:	78 0e                	js     80207a <seek+0x27>
+  80206c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80206f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802072:	89 50 04             	mov    %edx,0x4(%eax)
+  802075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80207a:	c9                   	leave
+  80207b:	c3                   	ret
+
+0080207c <ftruncate>:
+  80207c:	55                   	push   %ebp
+  80207d:	89 e5                	mov    %esp,%ebp
+  80207f:	56                   	push   %esi
+  802080:	53                   	push   %ebx
+  802081:	83 ec 18             	sub    $0x18,%esp
+  802084:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802087:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80208a:	50                   	push   %eax
+  80208b:	53                   	push   %ebx
+  80208c:	e8 03 fc ff ff       	call   801c94 <fd_lookup>
+  802091:	83 c4 10             	add    $0x10,%esp
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 34                	js     8020cc <ftruncate+0x50>
+  802098:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80209b:	83 ec 08             	sub    $0x8,%esp
+  80209e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020a1:	50                   	push   %eax
+  8020a2:	ff 36                	push   (%esi)
+  8020a4:	e8 3b fc ff ff       	call   801ce4 <dev_lookup>
+  8020a9:	83 c4 10             	add    $0x10,%esp
+  8020ac:	85 c0                	test   %eax,%eax
+  8020ae:	78 1c                	js     8020cc <ftruncate+0x50>
+  8020b0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8020b4:	74 1d                	je     8020d3 <ftruncate+0x57>
+  8020b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020b9:	8b 40 18             	mov    0x18(%eax),%eax
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	74 34                	je     8020f4 <ftruncate+0x78>
+  8020c0:	83 ec 08             	sub    $0x8,%esp
+  8020c3:	ff 75 0c             	push   0xc(%ebp)
+  8020c6:	56                   	push   %esi
+  8020c7:	ff d0                	call   *%eax
+  8020c9:	83 c4 10             	add    $0x10,%esp
+  8020cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020cf:	5b                   	pop    %ebx
+  8020d0:	5e                   	pop    %esi
+  8020d1:	5d                   	pop    %ebp
+  8020d2:	c3                   	ret
+  8020d3:	a1 14 60 80 00       	mov    0x806014,%eax
+  8020d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8020db:	83 ec 04             	sub    $0x4,%esp
+  8020de:	53                   	push   %ebx
+  8020df:	50                   	push   %eax
+  8020e0:	68 20 3e 80 00       	push   $0x803e20
+  8020e5:	e8 3d e2 ff ff       	call   800327 <cprintf>
+  8020ea:	83 c4 10             	add    $0x10,%esp
+  8020ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020f2:	eb d8                	jmp    8020cc <ftruncate+0x50>
+  8020f4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020f9:	eb d1                	jmp    8020cc <ftruncate+0x50>
+
+008020fb <fstat>:
+  8020fb:	55                   	push   %ebp
+  8020fc:	89 e5                	mov    %esp,%ebp
+  8020fe:	56                   	push   %esi
+  8020ff:	53                   	push   %ebx
+  802100:	83 ec 18             	sub    $0x18,%esp
+  802103:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802106:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802109:	50                   	push   %eax
+  80210a:	ff 75 08             	push   0x8(%ebp)
+  80210d:	e8 82 fb ff ff       	call   801c94 <fd_lookup>
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 49                	js     802162 <fstat+0x67>
+  802119:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80211c:	83 ec 08             	sub    $0x8,%esp
+  80211f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802122:	50                   	push   %eax
+  802123:	ff 36                	push   (%esi)
+  802125:	e8 ba fb ff ff       	call   801ce4 <dev_lookup>
+  80212a:	83 c4 10             	add    $0x10,%esp
+  80212d:	85 c0                	test   %eax,%eax
+  80212f:	78 31                	js     802162 <fstat+0x67>
+  802131:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802134:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802138:	74 2f                	je     802169 <fstat+0x6e>
+  80213a:	c6 03 00             	movb   $0x0,(%ebx)
+  80213d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802144:	00 00 00 
+  802147:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80214e:	00 00 00 
+  802151:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802157:	83 ec 08             	sub    $0x8,%esp
+  80215a:	53                   	push   %ebx
+  80215b:	56                   	push   %esi
+  80215c:	ff 50 14             	call   *0x14(%eax)
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802165:	5b                   	pop    %ebx
+  802166:	5e                   	pop    %esi
+  802167:	5d                   	pop    %ebp
+  802168:	c3                   	ret
+  802169:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80216e:	eb f2                	jmp    802162 <fstat+0x67>
+
+00802170 <stat>:
+  802170:	55                   	push   %ebp
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	56                   	push   %esi
+  802174:	53                   	push   %ebx
+  802175:	83 ec 08             	sub    $0x8,%esp
+  802178:	6a 00                	push   $0x0
+  80217a:	ff 75 08             	push   0x8(%ebp)
+  80217d:	e8 31 05 00 00       	call   8026b3 <open>
+  802182:	89 c3                	mov    %eax,%ebx
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	85 c0                	test   %eax,%eax
+  802189:	78 1b                	js     8021a6 <stat+0x36>
+  80218b:	83 ec 08             	sub    $0x8,%esp
+  80218e:	ff 75 0c             	push   0xc(%ebp)
+  802191:	50                   	push   %eax
+  802192:	e8 64 ff ff ff       	call   8020fb <fstat>
+  802197:	89 c6                	mov    %eax,%esi
+  802199:	89 1c 24             	mov    %ebx,(%esp)
+  80219c:	e8 19 fc ff ff       	call   801dba <close>
+  8021a1:	83 c4 10             	add    $0x10,%esp
+  8021a4:	89 f3                	mov    %esi,%ebx
+  8021a6:	89 d8                	mov    %ebx,%eax
+  8021a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ab:	5b                   	pop    %ebx
+  8021ac:	5e                   	pop    %esi
+  8021ad:	5d                   	pop    %ebp
+  8021ae:	c3                   	ret
+
+008021af <fsipc>:
+  8021af:	55                   	push   %ebp
+  8021b0:	89 e5                	mov    %esp,%ebp
+  8021b2:	56                   	push   %esi
+  8021b3:	53                   	push   %ebx
+  8021b4:	89 c3                	mov    %eax,%ebx
+  8021b6:	89 d6                	mov    %edx,%esi
+  8021b8:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  8021bf:	74 20                	je     8021e1 <fsipc+0x32>
+  8021c1:	83 ec 08             	sub    $0x8,%esp
+  8021c4:	6a 00                	push   $0x0
+  8021c6:	56                   	push   %esi
+  8021c7:	6a 07                	push   $0x7
+  8021c9:	68 00 70 80 00       	push   $0x807000
+  8021ce:	53                   	push   %ebx
+  8021cf:	ff 35 0c 60 80 00    	push   0x80600c
+  8021d5:	e8 fd 12 00 00       	call   8034d7 <ipc_call>
+  8021da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021dd:	5b                   	pop    %ebx
+  8021de:	5e                   	pop    %esi
+  8021df:	5d                   	pop    %ebp
+  8021e0:	c3                   	ret
+  8021e1:	83 ec 0c             	sub    $0xc,%esp
+  8021e4:	6a 02                	push   $0x2
+  8021e6:	e8 87 14 00 00       	call   803672 <ipc_find_env>
+  8021eb:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8021f0:	83 c4 10             	add    $0x10,%esp
+  8021f3:	eb cc                	jmp    8021c1 <fsipc+0x12>
+
+008021f5 <devfile_trunc>:
+  8021f5:	55                   	push   %ebp
+  8021f6:	89 e5                	mov    %esp,%ebp
+  8021f8:	83 ec 08             	sub    $0x8,%esp
+  8021fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  802201:	a3 00 70 80 00       	mov    %eax,0x807000
+  802206:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802209:	a3 04 70 80 00       	mov    %eax,0x807004
+  80220e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802213:	b8 02 00 00 00       	mov    $0x2,%eax
+  802218:	e8 92 ff ff ff       	call   8021af <fsipc>
+  80221d:	c9                   	leave
+  80221e:	c3                   	ret
+
+0080221f <devfile_flush>:
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	83 ec 08             	sub    $0x8,%esp
+  802225:	8b 45 08             	mov    0x8(%ebp),%eax
+  802228:	8b 40 0c             	mov    0xc(%eax),%eax
+  80222b:	a3 00 70 80 00       	mov    %eax,0x807000
+  802230:	ba 00 00 00 00       	mov    $0x0,%edx
+  802235:	b8 08 00 00 00       	mov    $0x8,%eax
+  80223a:	e8 70 ff ff ff       	call   8021af <fsipc>
+  80223f:	c9                   	leave
+  802240:	c3                   	ret
+
+00802241 <devfile_stat>:
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	53                   	push   %ebx
+  802245:	83 ec 04             	sub    $0x4,%esp
+  802248:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80224b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80224e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802251:	a3 00 70 80 00       	mov    %eax,0x807000
+  802256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802260:	e8 4a ff ff ff       	call   8021af <fsipc>
+  802265:	85 c0                	test   %eax,%eax
+  802267:	78 2c                	js     802295 <devfile_stat+0x54>
+  802269:	83 ec 08             	sub    $0x8,%esp
+  80226c:	68 00 70 80 00       	push   $0x807000
+  802271:	53                   	push   %ebx
+  802272:	e8 a7 e7 ff ff       	call   800a1e <strcpy>
+  802277:	a1 80 70 80 00       	mov    0x807080,%eax
+  80227c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802282:	a1 84 70 80 00       	mov    0x807084,%eax
+  802287:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	b8 00 00 00 00       	mov    $0x0,%eax
+  802295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+
+0080229a <fsring_rw>:
+  80229a:	55                   	push   %ebp
+  80229b:	89 e5                	mov    %esp,%ebp
+  80229d:	57                   	push   %edi
+  80229e:	56                   	push   %esi
+  80229f:	53                   	push   %ebx
+  8022a0:	83 ec 2c             	sub    $0x2c,%esp
+  8022a3:	89 c7                	mov    %eax,%edi
+  8022a5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8022a8:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8022ab:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8022b0:	a8 01                	test   $0x1,%al
+  8022b2:	74 0d                	je     8022c1 <fsring_rw+0x27>
+  8022b4:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8022b9:	a8 01                	test   $0x1,%al
+  8022bb:	0f 85 d5 00 00 00    	jne    802396 <fsring_rw+0xfc>
+  8022c1:	a1 14 60 80 00       	mov    0x806014,%eax
+  8022c6:	8b 40 48             	mov    0x48(%eax),%eax
+  8022c9:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  8022cf:	0f 84 fc 00 00 00    	je     8023d1 <fsring_rw+0x137>
+  8022d5:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  8022dc:	0f 84 02 01 00 00    	je     8023e4 <fsring_rw+0x14a>
+  8022e2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8022e7:	83 ec 04             	sub    $0x4,%esp
+  8022ea:	68 07 02 00 00       	push   $0x207
+  8022ef:	53                   	push   %ebx
+  8022f0:	6a 00                	push   $0x0
+  8022f2:	e8 87 eb ff ff       	call   800e7e <sys_page_alloc>
+  8022f7:	83 c4 10             	add    $0x10,%esp
+  8022fa:	85 c0                	test   %eax,%eax
+  8022fc:	0f 88 f9 00 00 00    	js     8023fb <fsring_rw+0x161>
+  802302:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802308:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80230e:	75 d7                	jne    8022e7 <fsring_rw+0x4d>
+  802310:	6a 0e                	push   $0xe
+  802312:	6a 0d                	push   $0xd
+  802314:	ff 35 0c 60 80 00    	push   0x80600c
+  80231a:	68 00 00 f0 cf       	push   $0xcff00000
+  80231f:	e8 c4 0c 00 00       	call   802fe8 <ipcring_init>
+  802324:	83 c4 08             	add    $0x8,%esp
+  802327:	6a 00                	push   $0x0
+  802329:	6a 00                	push   $0x0
+  80232b:	68 07 02 00 00       	push   $0x207
+  802330:	68 00 00 f0 cf       	push   $0xcff00000
+  802335:	6a 0b                	push   $0xb
+  802337:	ff 35 0c 60 80 00    	push   0x80600c
+  80233d:	e8 95 11 00 00       	call   8034d7 <ipc_call>
+  802342:	89 c6                	mov    %eax,%esi
+  802344:	83 c4 20             	add    $0x20,%esp
+  802347:	85 c0                	test   %eax,%eax
+  802349:	0f 88 ac 00 00 00    	js     8023fb <fsring_rw+0x161>
+  80234f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802354:	89 d9                	mov    %ebx,%ecx
+  802356:	83 c3 01             	add    $0x1,%ebx
+  802359:	89 da                	mov    %ebx,%edx
+  80235b:	c1 e2 0c             	shl    $0xc,%edx
+  80235e:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802364:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80236a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802370:	83 ec 08             	sub    $0x8,%esp
+  802373:	6a 00                	push   $0x0
+  802375:	6a 00                	push   $0x0
+  802377:	68 07 02 00 00       	push   $0x207
+  80237c:	50                   	push   %eax
+  80237d:	6a 0c                	push   $0xc
+  80237f:	ff 35 0c 60 80 00    	push   0x80600c
+  802385:	e8 4d 11 00 00       	call   8034d7 <ipc_call>
+  80238a:	83 c4 20             	add    $0x20,%esp
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	78 6a                	js     8023fb <fsring_rw+0x161>
+  802391:	83 fb 08             	cmp    $0x8,%ebx
+  802394:	75 be                	jne    802354 <fsring_rw+0xba>
+  802396:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80239a:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80239f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8023a4:	0f 45 c2             	cmovne %edx,%eax
+  8023a7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8023aa:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8023b1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8023b8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8023bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8023cc:	e9 4b 01 00 00       	jmp    80251c <fsring_rw+0x282>
+  8023d1:	e8 72 ee ff ff       	call   801248 <sys_time_msec>
+  8023d6:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  8023dc:	0f 89 f3 fe ff ff    	jns    8022d5 <fsring_rw+0x3b>
+  8023e2:	eb 54                	jmp    802438 <fsring_rw+0x19e>
+  8023e4:	83 ec 0c             	sub    $0xc,%esp
+  8023e7:	6a 02                	push   $0x2
+  8023e9:	e8 84 12 00 00       	call   803672 <ipc_find_env>
+  8023ee:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8023f3:	83 c4 10             	add    $0x10,%esp
+  8023f6:	e9 e7 fe ff ff       	jmp    8022e2 <fsring_rw+0x48>
+  8023fb:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802400:	83 ec 08             	sub    $0x8,%esp
+  802403:	53                   	push   %ebx
+  802404:	6a 00                	push   $0x0
+  802406:	e8 45 eb ff ff       	call   800f50 <sys_page_unmap>
+  80240b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80241a:	75 e4                	jne    802400 <fsring_rw+0x166>
+  80241c:	e8 27 ee ff ff       	call   801248 <sys_time_msec>
+  802421:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802426:	a3 04 60 80 00       	mov    %eax,0x806004
+  80242b:	a1 14 60 80 00       	mov    0x806014,%eax
+  802430:	8b 40 48             	mov    0x48(%eax),%eax
+  802433:	a3 08 60 80 00       	mov    %eax,0x806008
+  802438:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80243f:	e9 7a 01 00 00       	jmp    8025be <fsring_rw+0x324>
+  802444:	8b 57 0c             	mov    0xc(%edi),%edx
+  802447:	89 10                	mov    %edx,(%eax)
+  802449:	89 58 04             	mov    %ebx,0x4(%eax)
+  80244c:	89 f2                	mov    %esi,%edx
+  80244e:	03 57 04             	add    0x4(%edi),%edx
+  802451:	89 50 08             	mov    %edx,0x8(%eax)
+  802454:	83 ec 04             	sub    $0x4,%esp
+  802457:	53                   	push   %ebx
+  802458:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80245b:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80245e:	52                   	push   %edx
+  80245f:	83 c0 0c             	add    $0xc,%eax
+  802462:	50                   	push   %eax
+  802463:	e8 66 e7 ff ff       	call   800bce <memmove>
+  802468:	83 c4 10             	add    $0x10,%esp
+  80246b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80246e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802471:	89 08                	mov    %ecx,(%eax)
+  802473:	83 ec 0c             	sub    $0xc,%esp
+  802476:	68 00 00 f0 cf       	push   $0xcff00000
+  80247b:	e8 c6 0b 00 00       	call   803046 <ipcring_req_push>
+  802480:	01 de                	add    %ebx,%esi
+  802482:	83 c4 10             	add    $0x10,%esp
+  802485:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802488:	73 4c                	jae    8024d6 <fsring_rw+0x23c>
+  80248a:	83 ec 0c             	sub    $0xc,%esp
+  80248d:	68 00 00 f0 cf       	push   $0xcff00000
+  802492:	e8 89 0b 00 00       	call   803020 <ipcring_req_slot>
+  802497:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80249a:	83 c4 10             	add    $0x10,%esp
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	74 35                	je     8024d6 <fsring_rw+0x23c>
+  8024a1:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8024a6:	83 e0 07             	and    $0x7,%eax
+  8024a9:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8024ae:	c1 e0 0c             	shl    $0xc,%eax
+  8024b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024b4:	29 f3                	sub    %esi,%ebx
+  8024b6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8024b9:	39 cb                	cmp    %ecx,%ebx
+  8024bb:	0f 47 d9             	cmova  %ecx,%ebx
+  8024be:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8024c2:	75 80                	jne    802444 <fsring_rw+0x1aa>
+  8024c4:	8b 57 0c             	mov    0xc(%edi),%edx
+  8024c7:	89 10                	mov    %edx,(%eax)
+  8024c9:	89 58 04             	mov    %ebx,0x4(%eax)
+  8024cc:	89 f2                	mov    %esi,%edx
+  8024ce:	03 57 04             	add    0x4(%edi),%edx
+  8024d1:	89 50 08             	mov    %edx,0x8(%eax)
+  8024d4:	eb 95                	jmp    80246b <fsring_rw+0x1d1>
+  8024d6:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8024db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024de:	83 ec 0c             	sub    $0xc,%esp
+  8024e1:	68 00 00 f0 cf       	push   $0xcff00000
+  8024e6:	e8 94 0b 00 00       	call   80307f <ipcring_rsp_wait>
+  8024eb:	8b 58 04             	mov    0x4(%eax),%ebx
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8024f5:	75 45                	jne    80253c <fsring_rw+0x2a2>
+  8024f7:	85 db                	test   %ebx,%ebx
+  8024f9:	79 41                	jns    80253c <fsring_rw+0x2a2>
+  8024fb:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8024fe:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802505:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  80250c:	83 ec 0c             	sub    $0xc,%esp
+  80250f:	68 00 00 f0 cf       	push   $0xcff00000
+  802514:	e8 cc 0b 00 00       	call   8030e5 <ipcring_rsp_pop>
+  802519:	83 c4 10             	add    $0x10,%esp
+  80251c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802522:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802527:	39 c2                	cmp    %eax,%edx
+  802529:	74 75                	je     8025a0 <fsring_rw+0x306>
+  80252b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80252f:	75 a5                	jne    8024d6 <fsring_rw+0x23c>
+  802531:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802534:	0f 82 50 ff ff ff    	jb     80248a <fsring_rw+0x1f0>
+  80253a:	eb 9a                	jmp    8024d6 <fsring_rw+0x23c>
+  80253c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802540:	75 ca                	jne    80250c <fsring_rw+0x272>
+  802542:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802546:	74 31                	je     802579 <fsring_rw+0x2df>
+  802548:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80254e:	29 c8                	sub    %ecx,%eax
+  802550:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802553:	39 d0                	cmp    %edx,%eax
+  802555:	0f 47 c2             	cmova  %edx,%eax
+  802558:	39 d8                	cmp    %ebx,%eax
+  80255a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80255f:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802563:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802566:	b8 01 00 00 00       	mov    $0x1,%eax
+  80256b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80256f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802572:	01 d9                	add    %ebx,%ecx
+  802574:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802577:	eb 93                	jmp    80250c <fsring_rw+0x272>
+  802579:	83 ec 04             	sub    $0x4,%esp
+  80257c:	53                   	push   %ebx
+  80257d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802580:	83 e0 07             	and    $0x7,%eax
+  802583:	c1 e0 0c             	shl    $0xc,%eax
+  802586:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80258c:	50                   	push   %eax
+  80258d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802590:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802593:	01 c8                	add    %ecx,%eax
+  802595:	50                   	push   %eax
+  802596:	e8 33 e6 ff ff       	call   800bce <memmove>
+  80259b:	83 c4 10             	add    $0x10,%esp
+  80259e:	eb a8                	jmp    802548 <fsring_rw+0x2ae>
+  8025a0:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8025a4:	75 09                	jne    8025af <fsring_rw+0x315>
+  8025a6:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8025a9:	0f 82 db fe ff ff    	jb     80248a <fsring_rw+0x1f0>
+  8025af:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8025b2:	01 57 04             	add    %edx,0x4(%edi)
+  8025b5:	85 d2                	test   %edx,%edx
+  8025b7:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8025bb:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8025be:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8025c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c4:	5b                   	pop    %ebx
+  8025c5:	5e                   	pop    %esi
+  8025c6:	5f                   	pop    %edi
+  8025c7:	5d                   	pop    %ebp
+  8025c8:	c3                   	ret
+
+008025c9 <devfile_write>:
+  8025c9:	55                   	push   %ebp
+  8025ca:	89 e5                	mov    %esp,%ebp
+  8025cc:	57                   	push   %edi
+  8025cd:	56                   	push   %esi
+  8025ce:	53                   	push   %ebx
+  8025cf:	83 ec 0c             	sub    $0xc,%esp
+  8025d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025db:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8025e1:	76 1a                	jbe    8025fd <devfile_write+0x34>
+  8025e3:	83 ec 0c             	sub    $0xc,%esp
+  8025e6:	53                   	push   %ebx
+  8025e7:	89 f1                	mov    %esi,%ecx
+  8025e9:	ba 06 00 00 00       	mov    $0x6,%edx
+  8025ee:	89 f8                	mov    %edi,%eax
+  8025f0:	e8 a5 fc ff ff       	call   80229a <fsring_rw>
+  8025f5:	83 c4 10             	add    $0x10,%esp
+  8025f8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8025fb:	75 39                	jne    802636 <devfile_write+0x6d>
+  8025fd:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  802602:	39 c3                	cmp    %eax,%ebx
+  802604:	0f 47 d8             	cmova  %eax,%ebx
+  802607:	8b 47 0c             	mov    0xc(%edi),%eax
+  80260a:	a3 00 70 80 00       	mov    %eax,0x807000
+  80260f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802615:	83 ec 04             	sub    $0x4,%esp
+  802618:	53                   	push   %ebx
+  802619:	56                   	push   %esi
+  80261a:	68 08 70 80 00       	push   $0x807008
+  80261f:	e8 aa e5 ff ff       	call   800bce <memmove>
+  802624:	ba 00 00 00 00       	mov    $0x0,%edx
+  802629:	b8 04 00 00 00       	mov    $0x4,%eax
+  80262e:	e8 7c fb ff ff       	call   8021af <fsipc>
+  802633:	83 c4 10             	add    $0x10,%esp
+  802636:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802639:	5b                   	pop    %ebx
+  80263a:	5e                   	pop    %esi
+  80263b:	5f                   	pop    %edi
+  80263c:	5d                   	pop    %ebp
+  80263d:	c3                   	ret
+
+0080263e <devfile_read>:
+  80263e:	55                   	push   %ebp
+  80263f:	89 e5                	mov    %esp,%ebp
+  802641:	57                   	push   %edi
+  802642:	56                   	push   %esi
+  802643:	53                   	push   %ebx
+  802644:	83 ec 0c             	sub    $0xc,%esp
+  802647:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80264a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80264d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802653:	76 1d                	jbe    802672 <devfile_read+0x34>
+  802655:	83 ec 0c             	sub    $0xc,%esp
+  802658:	56                   	push   %esi
+  802659:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80265c:	ba 05 00 00 00       	mov    $0x5,%edx
+  802661:	89 f8                	mov    %edi,%eax
+  802663:	e8 32 fc ff ff       	call   80229a <fsring_rw>
+  802668:	89 c3                	mov    %eax,%ebx
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802670:	75 37                	jne    8026a9 <devfile_read+0x6b>
+  802672:	8b 47 0c             	mov    0xc(%edi),%eax
+  802675:	a3 00 70 80 00       	mov    %eax,0x807000
+  80267a:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802680:	ba 00 00 00 00       	mov    $0x0,%edx
+  802685:	b8 03 00 00 00       	mov    $0x3,%eax
+  80268a:	e8 20 fb ff ff       	call   8021af <fsipc>
+  80268f:	89 c3                	mov    %eax,%ebx
+  802691:	85 c0                	test   %eax,%eax
+  802693:	78 14                	js     8026a9 <devfile_read+0x6b>
+  802695:	83 ec 04             	sub    $0x4,%esp
+  802698:	50                   	push   %eax
+  802699:	68 00 70 80 00       	push   $0x807000
+  80269e:	ff 75 0c             	push   0xc(%ebp)
+  8026a1:	e8 28 e5 ff ff       	call   800bce <memmove>
+  8026a6:	83 c4 10             	add    $0x10,%esp
+  8026a9:	89 d8                	mov    %ebx,%eax
+  8026ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ae:	5b                   	pop    %ebx
+  8026af:	5e                   	pop    %esi
+  8026b0:	5f                   	pop    %edi
+  8026b1:	5d                   	pop    %ebp
+  8026b2:	c3                   	ret
+
+008026b3 <open>:
+  8026b3:	55                   	push   %ebp
+  8026b4:	89 e5                	mov    %esp,%ebp
+  8026b6:	56                   	push   %esi
+  8026b7:	53                   	push   %ebx
+  8026b8:	83 ec 1c             	sub    $0x1c,%esp
+  8026bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8026be:	56                   	push   %esi
+  8026bf:	e8 0e e3 ff ff       	call   8009d2 <strlen>
+  8026c4:	83 c4 10             	add    $0x10,%esp
+  8026c7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026cc:	7f 6c                	jg     80273a <open+0x87>
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  8026d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026d4:	50                   	push   %eax
+  8026d5:	e8 6a f5 ff ff       	call   801c44 <fd_alloc>
+  8026da:	89 c3                	mov    %eax,%ebx
+  8026dc:	83 c4 10             	add    $0x10,%esp
+  8026df:	85 c0                	test   %eax,%eax
+  8026e1:	78 3c                	js     80271f <open+0x6c>
+  8026e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026e6:	a3 00 74 80 00       	mov    %eax,0x807400
+  8026eb:	83 ec 08             	sub    $0x8,%esp
+  8026ee:	56                   	push   %esi
+  8026ef:	68 00 70 80 00       	push   $0x807000
+  8026f4:	e8 25 e3 ff ff       	call   800a1e <strcpy>
+  8026f9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802701:	e8 a9 fa ff ff       	call   8021af <fsipc>
+  802706:	89 c3                	mov    %eax,%ebx
+  802708:	83 c4 10             	add    $0x10,%esp
+  80270b:	85 c0                	test   %eax,%eax
+  80270d:	78 19                	js     802728 <open+0x75>
+  80270f:	83 ec 0c             	sub    $0xc,%esp
+  802712:	ff 75 f4             	push   -0xc(%ebp)
+  802715:	e8 03 f5 ff ff       	call   801c1d <fd2num>
+  80271a:	89 c3                	mov    %eax,%ebx
+  80271c:	83 c4 10             	add    $0x10,%esp
+  80271f:	89 d8                	mov    %ebx,%eax
+  802721:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802724:	5b                   	pop    %ebx
+  802725:	5e                   	pop    %esi
+  802726:	5d                   	pop    %ebp
+  802727:	c3                   	ret
+  802728:	83 ec 08             	sub    $0x8,%esp
+  80272b:	6a 00                	push   $0x0
+  80272d:	ff 75 f4             	push   -0xc(%ebp)
+  802730:	e8 05 f6 ff ff       	call   801d3a <fd_close>
+  802735:	83 c4 10             	add    $0x10,%esp
+  802738:	eb e5                	jmp    80271f <open+0x6c>
+  80273a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80273f:	eb de                	jmp    80271f <open+0x6c>
+
+00802741 <file_image>:
+  802741:	55                   	push   %ebp
+  802742:	89 e5                	mov    %esp,%ebp
+  802744:	53                   	push   %ebx
+  802745:	83 ec 1c             	sub    $0x1c,%esp
+  802748:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80274b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80274e:	50                   	push   %eax
+  80274f:	ff 75 08             	push   0x8(%ebp)
+  802752:	e8 3d f5 ff ff       	call   801c94 <fd_lookup>
+  802757:	83 c4 10             	add    $0x10,%esp
+  80275a:	85 c0                	test   %eax,%eax
+  80275c:	78 58                	js     8027b6 <file_image+0x75>
+  80275e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802761:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802767:	39 08                	cmp    %ecx,(%eax)
+  802769:	75 50                	jne    8027bb <file_image+0x7a>
+  80276b:	83 fb 04             	cmp    $0x4,%ebx
+  80276e:	77 52                	ja     8027c2 <file_image+0x81>
+  802770:	8b 40 0c             	mov    0xc(%eax),%eax
+  802773:	a3 00 70 80 00       	mov    %eax,0x807000
+  802778:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80277e:	83 ec 04             	sub    $0x4,%esp
+  802781:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802784:	c1 e0 02             	shl    $0x2,%eax
+  802787:	50                   	push   %eax
+  802788:	ff 75 0c             	push   0xc(%ebp)
+  80278b:	68 08 70 80 00       	push   $0x807008
+  802790:	e8 39 e4 ff ff       	call   800bce <memmove>
+  802795:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80279f:	e8 0b fa ff ff       	call   8021af <fsipc>
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	78 0b                	js     8027b6 <file_image+0x75>
+  8027ab:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027ae:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  8027b4:	89 0a                	mov    %ecx,(%edx)
+  8027b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b9:	c9                   	leave
+  8027ba:	c3                   	ret
+  8027bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027c0:	eb f4                	jmp    8027b6 <file_image+0x75>
+  8027c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027c7:	eb ed                	jmp    8027b6 <file_image+0x75>
+
+008027c9 <remove>:
+  8027c9:	55                   	push   %ebp
+  8027ca:	89 e5                	mov    %esp,%ebp
+  8027cc:	53                   	push   %ebx
+  8027cd:	83 ec 10             	sub    $0x10,%esp
+  8027d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027d3:	53                   	push   %ebx
+  8027d4:	e8 f9 e1 ff ff       	call   8009d2 <strlen>
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027e1:	7f 25                	jg     802808 <remove+0x3f>
+  8027e3:	83 ec 08             	sub    $0x8,%esp
+  8027e6:	53                   	push   %ebx
+  8027e7:	68 00 70 80 00       	push   $0x807000
+  8027ec:	e8 2d e2 ff ff       	call   800a1e <strcpy>
+  8027f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8027fb:	e8 af f9 ff ff       	call   8021af <fsipc>
+  802800:	83 c4 10             	add    $0x10,%esp
+  802803:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802806:	c9                   	leave
+  802807:	c3                   	ret
+  802808:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80280d:	eb f4                	jmp    802803 <remove+0x3a>
+
+0080280f <sync>:
+  80280f:	55                   	push   %ebp
+  802810:	89 e5                	mov    %esp,%ebp
+  802812:	83 ec 08             	sub    $0x8,%esp
+  802815:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80281f:	e8 8b f9 ff ff       	call   8021af <fsipc>
+  802824:	c9                   	leave
+  802825:	c3                   	ret
+
+00802826 <devsock_stat>:
+  802826:	55                   	push   %ebp
+  802827:	89 e5                	mov    %esp,%ebp
+  802829:	83 ec 10             	sub    $0x10,%esp
+  80282c:	68 90 3e 80 00       	push   $0x803e90
+  802831:	ff 75 0c             	push   0xc(%ebp)
+  802834:	e8 e5 e1 ff ff       	call   800a1e <strcpy>
+  802839:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283e:	c9                   	leave
+  80283f:	c3                   	ret
+
+00802840 <devsock_close>:
+  802840:	55                   	push   %ebp
+  802841:	89 e5                	mov    %esp,%ebp
+  802843:	53                   	push   %ebx
+  802844:	83 ec 10             	sub    $0x10,%esp
+  802847:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80284a:	53                   	push   %ebx
+  80284b:	e8 3c 0e 00 00       	call   80368c <pageref>
+  802850:	89 c2                	mov    %eax,%edx
+  802852:	83 c4 10             	add    $0x10,%esp
+  802855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285a:	83 fa 01             	cmp    $0x1,%edx
+  80285d:	74 05                	je     802864 <devsock_close+0x24>
+  80285f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802862:	c9                   	leave
+  802863:	c3                   	ret
+  802864:	83 ec 0c             	sub    $0xc,%esp
+  802867:	ff 73 0c             	push   0xc(%ebx)
+  80286a:	e8 aa 02 00 00       	call   802b19 <nsipc_close>
+  80286f:	83 c4 10             	add    $0x10,%esp
+  802872:	eb eb                	jmp    80285f <devsock_close+0x1f>
+
+00802874 <devsock_write>:
+  802874:	55                   	push   %ebp
+  802875:	89 e5                	mov    %esp,%ebp
+  802877:	83 ec 08             	sub    $0x8,%esp
+  80287a:	6a 00                	push   $0x0
+  80287c:	ff 75 10             	push   0x10(%ebp)
+  80287f:	ff 75 0c             	push   0xc(%ebp)
+  802882:	8b 45 08             	mov    0x8(%ebp),%eax
+  802885:	ff 70 0c             	push   0xc(%eax)
+  802888:	e8 6c 03 00 00       	call   802bf9 <nsipc_send>
+  80288d:	c9                   	leave
+  80288e:	c3                   	ret
+
+0080288f <devsock_read>:
+  80288f:	55                   	push   %ebp
+  802890:	89 e5                	mov    %esp,%ebp
+  802892:	83 ec 08             	sub    $0x8,%esp
+  802895:	6a 00                	push   $0x0
+  802897:	ff 75 10             	push   0x10(%ebp)
+  80289a:	ff 75 0c             	push   0xc(%ebp)
+  80289d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a0:	ff 70 0c             	push   0xc(%eax)
+  8028a3:	e8 e2 02 00 00       	call   802b8a <nsipc_recv>
+  8028a8:	c9                   	leave
+  8028a9:	c3                   	ret
+
+008028aa <fd2sockid>:
+  8028aa:	55                   	push   %ebp
+  8028ab:	89 e5                	mov    %esp,%ebp
+  8028ad:	83 ec 20             	sub    $0x20,%esp
+  8028b0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028b3:	52                   	push   %edx
+  8028b4:	50                   	push   %eax
+  8028b5:	e8 da f3 ff ff       	call   801c94 <fd_lookup>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	78 10                	js     8028d1 <fd2sockid+0x27>
+  8028c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c4:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8028ca:	39 08                	cmp    %ecx,(%eax)
+  8028cc:	75 05                	jne    8028d3 <fd2sockid+0x29>
+  8028ce:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028d1:	c9                   	leave
+  8028d2:	c3                   	ret
+  8028d3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028d8:	eb f7                	jmp    8028d1 <fd2sockid+0x27>
+
+008028da <alloc_sockfd>:
+  8028da:	55                   	push   %ebp
+  8028db:	89 e5                	mov    %esp,%ebp
+  8028dd:	56                   	push   %esi
+  8028de:	53                   	push   %ebx
+  8028df:	83 ec 1c             	sub    $0x1c,%esp
+  8028e2:	89 c6                	mov    %eax,%esi
+  8028e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028e7:	50                   	push   %eax
+  8028e8:	e8 57 f3 ff ff       	call   801c44 <fd_alloc>
+  8028ed:	89 c3                	mov    %eax,%ebx
+  8028ef:	83 c4 10             	add    $0x10,%esp
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	78 43                	js     802939 <alloc_sockfd+0x5f>
+  8028f6:	83 ec 04             	sub    $0x4,%esp
+  8028f9:	68 07 04 00 00       	push   $0x407
+  8028fe:	ff 75 f4             	push   -0xc(%ebp)
+  802901:	6a 00                	push   $0x0
+  802903:	e8 76 e5 ff ff       	call   800e7e <sys_page_alloc>
+  802908:	89 c3                	mov    %eax,%ebx
+  80290a:	83 c4 10             	add    $0x10,%esp
+  80290d:	85 c0                	test   %eax,%eax
+  80290f:	78 28                	js     802939 <alloc_sockfd+0x5f>
+  802911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802914:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80291a:	89 10                	mov    %edx,(%eax)
+  80291c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80291f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802926:	89 70 0c             	mov    %esi,0xc(%eax)
+  802929:	83 ec 0c             	sub    $0xc,%esp
+  80292c:	50                   	push   %eax
+  80292d:	e8 eb f2 ff ff       	call   801c1d <fd2num>
+  802932:	89 c3                	mov    %eax,%ebx
+  802934:	83 c4 10             	add    $0x10,%esp
+  802937:	eb 0c                	jmp    802945 <alloc_sockfd+0x6b>
+  802939:	83 ec 0c             	sub    $0xc,%esp
+  80293c:	56                   	push   %esi
+  80293d:	e8 d7 01 00 00       	call   802b19 <nsipc_close>
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	89 d8                	mov    %ebx,%eax
+  802947:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80294a:	5b                   	pop    %ebx
+  80294b:	5e                   	pop    %esi
+  80294c:	5d                   	pop    %ebp
+  80294d:	c3                   	ret
+
+0080294e <accept>:
+  80294e:	55                   	push   %ebp
+  80294f:	89 e5                	mov    %esp,%ebp
+  802951:	83 ec 08             	sub    $0x8,%esp
+  802954:	8b 45 08             	mov    0x8(%ebp),%eax
+  802957:	e8 4e ff ff ff       	call   8028aa <fd2sockid>
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	78 1b                	js     80297b <accept+0x2d>
+  802960:	83 ec 04             	sub    $0x4,%esp
+  802963:	ff 75 10             	push   0x10(%ebp)
+  802966:	ff 75 0c             	push   0xc(%ebp)
+  802969:	50                   	push   %eax
+  80296a:	e8 07 01 00 00       	call   802a76 <nsipc_accept>
+  80296f:	83 c4 10             	add    $0x10,%esp
+  802972:	85 c0                	test   %eax,%eax
+  802974:	78 05                	js     80297b <accept+0x2d>
+  802976:	e8 5f ff ff ff       	call   8028da <alloc_sockfd>
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+0080297d <bind>:
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 08             	sub    $0x8,%esp
+  802983:	8b 45 08             	mov    0x8(%ebp),%eax
+  802986:	e8 1f ff ff ff       	call   8028aa <fd2sockid>
+  80298b:	85 c0                	test   %eax,%eax
+  80298d:	78 12                	js     8029a1 <bind+0x24>
+  80298f:	83 ec 04             	sub    $0x4,%esp
+  802992:	ff 75 10             	push   0x10(%ebp)
+  802995:	ff 75 0c             	push   0xc(%ebp)
+  802998:	50                   	push   %eax
+  802999:	e8 24 01 00 00       	call   802ac2 <nsipc_bind>
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	c9                   	leave
+  8029a2:	c3                   	ret
+
+008029a3 <shutdown>:
+  8029a3:	55                   	push   %ebp
+  8029a4:	89 e5                	mov    %esp,%ebp
+  8029a6:	83 ec 08             	sub    $0x8,%esp
+  8029a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ac:	e8 f9 fe ff ff       	call   8028aa <fd2sockid>
+  8029b1:	85 c0                	test   %eax,%eax
+  8029b3:	78 0f                	js     8029c4 <shutdown+0x21>
+  8029b5:	83 ec 08             	sub    $0x8,%esp
+  8029b8:	ff 75 0c             	push   0xc(%ebp)
+  8029bb:	50                   	push   %eax
+  8029bc:	e8 36 01 00 00       	call   802af7 <nsipc_shutdown>
+  8029c1:	83 c4 10             	add    $0x10,%esp
+  8029c4:	c9                   	leave
+  8029c5:	c3                   	ret
+
+008029c6 <connect>:
+  8029c6:	55                   	push   %ebp
+  8029c7:	89 e5                	mov    %esp,%ebp
+  8029c9:	83 ec 08             	sub    $0x8,%esp
+  8029cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029cf:	e8 d6 fe ff ff       	call   8028aa <fd2sockid>
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	78 12                	js     8029ea <connect+0x24>
+  8029d8:	83 ec 04             	sub    $0x4,%esp
+  8029db:	ff 75 10             	push   0x10(%ebp)
+  8029de:	ff 75 0c             	push   0xc(%ebp)
+  8029e1:	50                   	push   %eax
+  8029e2:	e8 4c 01 00 00       	call   802b33 <nsipc_connect>
+  8029e7:	83 c4 10             	add    $0x10,%esp
+  8029ea:	c9                   	leave
+  8029eb:	c3                   	ret
+
+008029ec <listen>:
+  8029ec:	55                   	push   %ebp
+  8029ed:	89 e5                	mov    %esp,%ebp
+  8029ef:	83 ec 08             	sub    $0x8,%esp
+  8029f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f5:	e8 b0 fe ff ff       	call   8028aa <fd2sockid>
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	78 0f                	js     802a0d <listen+0x21>
+  8029fe:	83 ec 08             	sub    $0x8,%esp
+  802a01:	ff 75 0c             	push   0xc(%ebp)
+  802a04:	50                   	push   %eax
+  802a05:	e8 5e 01 00 00       	call   802b68 <nsipc_listen>
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+
+00802a0f <socket>:
+  802a0f:	55                   	push   %ebp
+  802a10:	89 e5                	mov    %esp,%ebp
+  802a12:	83 ec 0c             	sub    $0xc,%esp
+  802a15:	ff 75 10             	push   0x10(%ebp)
+  802a18:	ff 75 0c             	push   0xc(%ebp)
+  802a1b:	ff 75 08             	push   0x8(%ebp)
+  802a1e:	e8 34 02 00 00       	call   802c57 <nsipc_socket>
+  802a23:	83 c4 10             	add    $0x10,%esp
+  802a26:	85 c0                	test   %eax,%eax
+  802a28:	78 05                	js     802a2f <socket+0x20>
+  802a2a:	e8 ab fe ff ff       	call   8028da <alloc_sockfd>
+  802a2f:	c9                   	leave
+  802a30:	c3                   	ret
+
+00802a31 <nsipc>:
+  802a31:	55                   	push   %ebp
+  802a32:	89 e5                	mov    %esp,%ebp
+  802a34:	53                   	push   %ebx
+  802a35:	83 ec 04             	sub    $0x4,%esp
+  802a38:	89 c3                	mov    %eax,%ebx
+  802a3a:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  802a41:	74 1f                	je     802a62 <nsipc+0x31>
+  802a43:	83 ec 08             	sub    $0x8,%esp
+  802a46:	6a 00                	push   $0x0
+  802a48:	6a 00                	push   $0x0
+  802a4a:	6a 07                	push   $0x7
+  802a4c:	68 00 80 80 00       	push   $0x808000
+  802a51:	53                   	push   %ebx
+  802a52:	ff 35 10 60 80 00    	push   0x806010
+  802a58:	e8 7a 0a 00 00       	call   8034d7 <ipc_call>
+  802a5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+  802a62:	83 ec 0c             	sub    $0xc,%esp
+  802a65:	6a 03                	push   $0x3
+  802a67:	e8 06 0c 00 00       	call   803672 <ipc_find_env>
+  802a6c:	a3 10 60 80 00       	mov    %eax,0x806010
+  802a71:	83 c4 10             	add    $0x10,%esp
+  802a74:	eb cd                	jmp    802a43 <nsipc+0x12>
+
+00802a76 <nsipc_accept>:
+  802a76:	55                   	push   %ebp
+  802a77:	89 e5                	mov    %esp,%ebp
+  802a79:	53                   	push   %ebx
+  802a7a:	83 ec 04             	sub    $0x4,%esp
+  802a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a80:	a3 00 80 80 00       	mov    %eax,0x808000
+  802a85:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a8a:	e8 a2 ff ff ff       	call   802a31 <nsipc>
+  802a8f:	89 c3                	mov    %eax,%ebx
+  802a91:	85 c0                	test   %eax,%eax
+  802a93:	79 07                	jns    802a9c <nsipc_accept+0x26>
+  802a95:	89 d8                	mov    %ebx,%eax
+  802a97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a9a:	c9                   	leave
+  802a9b:	c3                   	ret
+  802a9c:	83 ec 04             	sub    $0x4,%esp
+  802a9f:	ff 35 10 80 80 00    	push   0x808010
+  802aa5:	68 00 80 80 00       	push   $0x808000
+  802aaa:	ff 75 0c             	push   0xc(%ebp)
+  802aad:	e8 1c e1 ff ff       	call   800bce <memmove>
+  802ab2:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802ab8:	8b 45 10             	mov    0x10(%ebp),%eax
+  802abb:	89 10                	mov    %edx,(%eax)
+  802abd:	83 c4 10             	add    $0x10,%esp
+  802ac0:	eb d3                	jmp    802a95 <nsipc_accept+0x1f>
+
+00802ac2 <nsipc_bind>:
+  802ac2:	55                   	push   %ebp
+  802ac3:	89 e5                	mov    %esp,%ebp
+  802ac5:	53                   	push   %ebx
+  802ac6:	83 ec 08             	sub    $0x8,%esp
+  802ac9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acf:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ad4:	53                   	push   %ebx
+  802ad5:	ff 75 0c             	push   0xc(%ebp)
+  802ad8:	68 04 80 80 00       	push   $0x808004
+  802add:	e8 ec e0 ff ff       	call   800bce <memmove>
+  802ae2:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802ae8:	b8 02 00 00 00       	mov    $0x2,%eax
+  802aed:	e8 3f ff ff ff       	call   802a31 <nsipc>
+  802af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+
+00802af7 <nsipc_shutdown>:
+  802af7:	55                   	push   %ebp
+  802af8:	89 e5                	mov    %esp,%ebp
+  802afa:	83 ec 08             	sub    $0x8,%esp
+  802afd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b00:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b08:	a3 04 80 80 00       	mov    %eax,0x808004
+  802b0d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b12:	e8 1a ff ff ff       	call   802a31 <nsipc>
+  802b17:	c9                   	leave
+  802b18:	c3                   	ret
+
+00802b19 <nsipc_close>:
+  802b19:	55                   	push   %ebp
+  802b1a:	89 e5                	mov    %esp,%ebp
+  802b1c:	83 ec 08             	sub    $0x8,%esp
+  802b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b22:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b27:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b2c:	e8 00 ff ff ff       	call   802a31 <nsipc>
+  802b31:	c9                   	leave
+  802b32:	c3                   	ret
+
+00802b33 <nsipc_connect>:
+  802b33:	55                   	push   %ebp
+  802b34:	89 e5                	mov    %esp,%ebp
+  802b36:	53                   	push   %ebx
+  802b37:	83 ec 08             	sub    $0x8,%esp
+  802b3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b40:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b45:	53                   	push   %ebx
+  802b46:	ff 75 0c             	push   0xc(%ebp)
+  802b49:	68 04 80 80 00       	push   $0x808004
+  802b4e:	e8 7b e0 ff ff       	call   800bce <memmove>
+  802b53:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802b59:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b5e:	e8 ce fe ff ff       	call   802a31 <nsipc>
+  802b63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b66:	c9                   	leave
+  802b67:	c3                   	ret
+
+00802b68 <nsipc_listen>:
+  802b68:	55                   	push   %ebp
+  802b69:	89 e5                	mov    %esp,%ebp
+  802b6b:	83 ec 08             	sub    $0x8,%esp
+  802b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b71:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b79:	a3 04 80 80 00       	mov    %eax,0x808004
+  802b7e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b83:	e8 a9 fe ff ff       	call   802a31 <nsipc>
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+00802b8a <nsipc_recv>:
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	56                   	push   %esi
+  802b8e:	53                   	push   %ebx
+  802b8f:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b95:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b9a:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802ba0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ba3:	a3 08 80 80 00       	mov    %eax,0x808008
+  802ba8:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bad:	e8 7f fe ff ff       	call   802a31 <nsipc>
+  802bb2:	89 c3                	mov    %eax,%ebx
+  802bb4:	85 c0                	test   %eax,%eax
+  802bb6:	78 22                	js     802bda <nsipc_recv+0x50>
+  802bb8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802bbd:	39 c6                	cmp    %eax,%esi
+  802bbf:	0f 4e c6             	cmovle %esi,%eax
+  802bc2:	39 c3                	cmp    %eax,%ebx
+  802bc4:	7f 1d                	jg     802be3 <nsipc_recv+0x59>
+  802bc6:	83 ec 04             	sub    $0x4,%esp
+  802bc9:	53                   	push   %ebx
+  802bca:	68 00 80 80 00       	push   $0x808000
+  802bcf:	ff 75 0c             	push   0xc(%ebp)
+  802bd2:	e8 f7 df ff ff       	call   800bce <memmove>
+  802bd7:	83 c4 10             	add    $0x10,%esp
+  802bda:	89 d8                	mov    %ebx,%eax
+  802bdc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bdf:	5b                   	pop    %ebx
+  802be0:	5e                   	pop    %esi
+  802be1:	5d                   	pop    %ebp
+  802be2:	c3                   	ret
+  802be3:	68 9c 3e 80 00       	push   $0x803e9c
+  802be8:	68 b1 3e 80 00       	push   $0x803eb1
+  802bed:	6a 60                	push   $0x60
+  802bef:	68 c6 3e 80 00       	push   $0x803ec6
+  802bf4:	e8 53 d6 ff ff       	call   80024c <_panic>
+
+00802bf9 <nsipc_send>:
+  802bf9:	55                   	push   %ebp
+  802bfa:	89 e5                	mov    %esp,%ebp
+  802bfc:	53                   	push   %ebx
+  802bfd:	83 ec 04             	sub    $0x4,%esp
+  802c00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c06:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c0b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c11:	7f 2e                	jg     802c41 <nsipc_send+0x48>
+  802c13:	83 ec 04             	sub    $0x4,%esp
+  802c16:	53                   	push   %ebx
+  802c17:	ff 75 0c             	push   0xc(%ebp)
+  802c1a:	68 0c 80 80 00       	push   $0x80800c
+  802c1f:	e8 aa df ff ff       	call   800bce <memmove>
+  802c24:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802c2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c2d:	a3 08 80 80 00       	mov    %eax,0x808008
+  802c32:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c37:	e8 f5 fd ff ff       	call   802a31 <nsipc>
+  802c3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c3f:	c9                   	leave
+  802c40:	c3                   	ret
+  802c41:	68 d2 3e 80 00       	push   $0x803ed2
+  802c46:	68 b1 3e 80 00       	push   $0x803eb1
+  802c4b:	6a 6b                	push   $0x6b
+  802c4d:	68 c6 3e 80 00       	push   $0x803ec6
+  802c52:	e8 f5 d5 ff ff       	call   80024c <_panic>
+
+00802c57 <nsipc_socket>:
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	83 ec 08             	sub    $0x8,%esp
+  802c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c60:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c68:	a3 04 80 80 00       	mov    %eax,0x808004
+  802c6d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c70:	a3 08 80 80 00       	mov    %eax,0x808008
+  802c75:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c7a:	e8 b2 fd ff ff       	call   802a31 <nsipc>
+  802c7f:	c9                   	leave
+  802c80:	c3                   	ret
+
+00802c81 <devpipe_stat>:
+  802c81:	55                   	push   %ebp
+  802c82:	89 e5                	mov    %esp,%ebp
+  802c84:	56                   	push   %esi
+  802c85:	53                   	push   %ebx
+  802c86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802c89:	83 ec 0c             	sub    $0xc,%esp
+  802c8c:	ff 75 08             	push   0x8(%ebp)
+  802c8f:	e8 99 ef ff ff       	call   801c2d <fd2data>
+  802c94:	89 c6                	mov    %eax,%esi
+  802c96:	83 c4 08             	add    $0x8,%esp
+  802c99:	68 de 3e 80 00       	push   $0x803ede
+  802c9e:	53                   	push   %ebx
+  802c9f:	e8 7a dd ff ff       	call   800a1e <strcpy>
+  802ca4:	8b 46 04             	mov    0x4(%esi),%eax
+  802ca7:	2b 06                	sub    (%esi),%eax
+  802ca9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802caf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802cb6:	00 00 00 
+  802cb9:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802cc0:	50 80 00 
+  802cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ccb:	5b                   	pop    %ebx
+  802ccc:	5e                   	pop    %esi
+  802ccd:	5d                   	pop    %ebp
+  802cce:	c3                   	ret
+
+00802ccf <devpipe_close>:
+  802ccf:	55                   	push   %ebp
+  802cd0:	89 e5                	mov    %esp,%ebp
+  802cd2:	53                   	push   %ebx
+  802cd3:	83 ec 0c             	sub    $0xc,%esp
+  802cd6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802cd9:	53                   	push   %ebx
+  802cda:	6a 00                	push   $0x0
+  802cdc:	e8 6f e2 ff ff       	call   800f50 <sys_page_unmap>
+  802ce1:	89 1c 24             	mov    %ebx,(%esp)
+  802ce4:	e8 44 ef ff ff       	call   801c2d <fd2data>
+  802ce9:	83 c4 08             	add    $0x8,%esp
+  802cec:	50                   	push   %eax
+  802ced:	6a 00                	push   $0x0
+  802cef:	e8 5c e2 ff ff       	call   800f50 <sys_page_unmap>
+  802cf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cf7:	c9                   	leave
+  802cf8:	c3                   	ret
+
+00802cf9 <_pipeisclosed>:
+  802cf9:	55                   	push   %ebp
+  802cfa:	89 e5                	mov    %esp,%ebp
+  802cfc:	57                   	push   %edi
+  802cfd:	56                   	push   %esi
+  802cfe:	53                   	push   %ebx
+  802cff:	83 ec 1c             	sub    $0x1c,%esp
+  802d02:	89 c7                	mov    %eax,%edi
+  802d04:	89 d6                	mov    %edx,%esi
+  802d06:	a1 14 60 80 00       	mov    0x806014,%eax
+  802d0b:	8b 58 58             	mov    0x58(%eax),%ebx
+  802d0e:	83 ec 0c             	sub    $0xc,%esp
+  802d11:	57                   	push   %edi
+  802d12:	e8 75 09 00 00       	call   80368c <pageref>
+  802d17:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d1a:	89 34 24             	mov    %esi,(%esp)
+  802d1d:	e8 6a 09 00 00       	call   80368c <pageref>
+  802d22:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  802d28:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802d2b:	83 c4 10             	add    $0x10,%esp
+  802d2e:	39 cb                	cmp    %ecx,%ebx
+  802d30:	74 1b                	je     802d4d <_pipeisclosed+0x54>
+  802d32:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d35:	75 cf                	jne    802d06 <_pipeisclosed+0xd>
+  802d37:	8b 42 58             	mov    0x58(%edx),%eax
+  802d3a:	6a 01                	push   $0x1
+  802d3c:	50                   	push   %eax
+  802d3d:	53                   	push   %ebx
+  802d3e:	68 e5 3e 80 00       	push   $0x803ee5
+  802d43:	e8 df d5 ff ff       	call   800327 <cprintf>
+  802d48:	83 c4 10             	add    $0x10,%esp
+  802d4b:	eb b9                	jmp    802d06 <_pipeisclosed+0xd>
+  802d4d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d50:	0f 94 c0             	sete   %al
+  802d53:	0f b6 c0             	movzbl %al,%eax
+  802d56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d59:	5b                   	pop    %ebx
+  802d5a:	5e                   	pop    %esi
+  802d5b:	5f                   	pop    %edi
+  802d5c:	5d                   	pop    %ebp
+  802d5d:	c3                   	ret
+
+00802d5e <devpipe_write>:
+  802d5e:	55                   	push   %ebp
+  802d5f:	89 e5                	mov    %esp,%ebp
+  802d61:	57                   	push   %edi
+  802d62:	56                   	push   %esi
+  802d63:	53                   	push   %ebx
+  802d64:	83 ec 28             	sub    $0x28,%esp
+  802d67:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d6a:	56                   	push   %esi
+  802d6b:	e8 bd ee ff ff       	call   801c2d <fd2data>
+  802d70:	89 c3                	mov    %eax,%ebx
+  802d72:	83 c4 10             	add    $0x10,%esp
+  802d75:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d7a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d7e:	74 5c                	je     802ddc <devpipe_write+0x7e>
+  802d80:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d83:	8b 0b                	mov    (%ebx),%ecx
+  802d85:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d88:	39 d0                	cmp    %edx,%eax
+  802d8a:	72 1e                	jb     802daa <devpipe_write+0x4c>
+  802d8c:	89 da                	mov    %ebx,%edx
+  802d8e:	89 f0                	mov    %esi,%eax
+  802d90:	e8 64 ff ff ff       	call   802cf9 <_pipeisclosed>
+  802d95:	85 c0                	test   %eax,%eax
+  802d97:	75 48                	jne    802de1 <devpipe_write+0x83>
+  802d99:	e8 95 e0 ff ff       	call   800e33 <sys_yield>
+  802d9e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802da1:	8b 0b                	mov    (%ebx),%ecx
+  802da3:	8d 51 20             	lea    0x20(%ecx),%edx
+  802da6:	39 d0                	cmp    %edx,%eax
+  802da8:	73 e2                	jae    802d8c <devpipe_write+0x2e>
+  802daa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dad:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802db1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802db4:	89 c2                	mov    %eax,%edx
+  802db6:	c1 fa 1f             	sar    $0x1f,%edx
+  802db9:	89 d1                	mov    %edx,%ecx
+  802dbb:	c1 e9 1b             	shr    $0x1b,%ecx
+  802dbe:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802dc1:	83 e2 1f             	and    $0x1f,%edx
+  802dc4:	29 ca                	sub    %ecx,%edx
+  802dc6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802dca:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802dce:	83 c0 01             	add    $0x1,%eax
+  802dd1:	89 43 04             	mov    %eax,0x4(%ebx)
+  802dd4:	83 c7 01             	add    $0x1,%edi
+  802dd7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802dda:	75 a4                	jne    802d80 <devpipe_write+0x22>
+  802ddc:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ddf:	eb 05                	jmp    802de6 <devpipe_write+0x88>
+  802de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de9:	5b                   	pop    %ebx
+  802dea:	5e                   	pop    %esi
+  802deb:	5f                   	pop    %edi
+  802dec:	5d                   	pop    %ebp
+  802ded:	c3                   	ret
+
+00802dee <devpipe_read>:
+  802dee:	55                   	push   %ebp
+  802def:	89 e5                	mov    %esp,%ebp
+  802df1:	57                   	push   %edi
+  802df2:	56                   	push   %esi
+  802df3:	53                   	push   %ebx
+  802df4:	83 ec 18             	sub    $0x18,%esp
+  802df7:	8b 75 08             	mov    0x8(%ebp),%esi
+  802dfa:	56                   	push   %esi
+  802dfb:	e8 2d ee ff ff       	call   801c2d <fd2data>
+  802e00:	89 c3                	mov    %eax,%ebx
+  802e02:	83 c4 10             	add    $0x10,%esp
+  802e05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e0a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e0e:	74 45                	je     802e55 <devpipe_read+0x67>
+  802e10:	8b 03                	mov    (%ebx),%eax
+  802e12:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e15:	75 1d                	jne    802e34 <devpipe_read+0x46>
+  802e17:	85 ff                	test   %edi,%edi
+  802e19:	75 3f                	jne    802e5a <devpipe_read+0x6c>
+  802e1b:	89 da                	mov    %ebx,%edx
+  802e1d:	89 f0                	mov    %esi,%eax
+  802e1f:	e8 d5 fe ff ff       	call   802cf9 <_pipeisclosed>
+  802e24:	85 c0                	test   %eax,%eax
+  802e26:	75 3c                	jne    802e64 <devpipe_read+0x76>
+  802e28:	e8 06 e0 ff ff       	call   800e33 <sys_yield>
+  802e2d:	8b 03                	mov    (%ebx),%eax
+  802e2f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e32:	74 e7                	je     802e1b <devpipe_read+0x2d>
+  802e34:	99                   	cltd
+  802e35:	c1 ea 1b             	shr    $0x1b,%edx
+  802e38:	01 d0                	add    %edx,%eax
+  802e3a:	83 e0 1f             	and    $0x1f,%eax
+  802e3d:	29 d0                	sub    %edx,%eax
+  802e3f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e47:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802e4a:	83 03 01             	addl   $0x1,(%ebx)
+  802e4d:	83 c7 01             	add    $0x1,%edi
+  802e50:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802e53:	75 bb                	jne    802e10 <devpipe_read+0x22>
+  802e55:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e58:	eb 02                	jmp    802e5c <devpipe_read+0x6e>
+  802e5a:	89 f8                	mov    %edi,%eax
+  802e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e5f:	5b                   	pop    %ebx
+  802e60:	5e                   	pop    %esi
+  802e61:	5f                   	pop    %edi
+  802e62:	5d                   	pop    %ebp
+  802e63:	c3                   	ret
+  802e64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e69:	eb f1                	jmp    802e5c <devpipe_read+0x6e>
+
+00802e6b <pipe>:
+  802e6b:	55                   	push   %ebp
+  802e6c:	89 e5                	mov    %esp,%ebp
+  802e6e:	56                   	push   %esi
+  802e6f:	53                   	push   %ebx
+  802e70:	83 ec 1c             	sub    $0x1c,%esp
+  802e73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e76:	50                   	push   %eax
+  802e77:	e8 c8 ed ff ff       	call   801c44 <fd_alloc>
+  802e7c:	89 c3                	mov    %eax,%ebx
+  802e7e:	83 c4 10             	add    $0x10,%esp
+  802e81:	85 c0                	test   %eax,%eax
+  802e83:	0f 88 23 01 00 00    	js     802fac <pipe+0x141>
+  802e89:	83 ec 04             	sub    $0x4,%esp
+  802e8c:	68 07 04 00 00       	push   $0x407
+  802e91:	ff 75 f4             	push   -0xc(%ebp)
+  802e94:	6a 00                	push   $0x0
+  802e96:	e8 e3 df ff ff       	call   800e7e <sys_page_alloc>
+  802e9b:	89 c3                	mov    %eax,%ebx
+  802e9d:	83 c4 10             	add    $0x10,%esp
+  802ea0:	85 c0                	test   %eax,%eax
+  802ea2:	0f 88 04 01 00 00    	js     802fac <pipe+0x141>
+  802ea8:	83 ec 0c             	sub    $0xc,%esp
+  802eab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802eae:	50                   	push   %eax
+  802eaf:	e8 90 ed ff ff       	call   801c44 <fd_alloc>
+  802eb4:	89 c3                	mov    %eax,%ebx
+  802eb6:	83 c4 10             	add    $0x10,%esp
+  802eb9:	85 c0                	test   %eax,%eax
+  802ebb:	0f 88 db 00 00 00    	js     802f9c <pipe+0x131>
+  802ec1:	83 ec 04             	sub    $0x4,%esp
+  802ec4:	68 07 04 00 00       	push   $0x407
+  802ec9:	ff 75 f0             	push   -0x10(%ebp)
+  802ecc:	6a 00                	push   $0x0
+  802ece:	e8 ab df ff ff       	call   800e7e <sys_page_alloc>
+  802ed3:	89 c3                	mov    %eax,%ebx
+  802ed5:	83 c4 10             	add    $0x10,%esp
+  802ed8:	85 c0                	test   %eax,%eax
+  802eda:	0f 88 bc 00 00 00    	js     802f9c <pipe+0x131>
+  802ee0:	83 ec 0c             	sub    $0xc,%esp
+  802ee3:	ff 75 f4             	push   -0xc(%ebp)
+  802ee6:	e8 42 ed ff ff       	call   801c2d <fd2data>
+  802eeb:	89 c6                	mov    %eax,%esi
+  802eed:	83 c4 0c             	add    $0xc,%esp
+  802ef0:	68 07 04 00 00       	push   $0x407
+  802ef5:	50                   	push   %eax
+  802ef6:	6a 00                	push   $0x0
+  802ef8:	e8 81 df ff ff       	call   800e7e <sys_page_alloc>
+  802efd:	89 c3                	mov    %eax,%ebx
+  802eff:	83 c4 10             	add    $0x10,%esp
+  802f02:	85 c0                	test   %eax,%eax
+  802f04:	0f 88 82 00 00 00    	js     802f8c <pipe+0x121>
+  802f0a:	83 ec 0c             	sub    $0xc,%esp
+  802f0d:	ff 75 f0             	push   -0x10(%ebp)
+  802f10:	e8 18 ed ff ff       	call   801c2d <fd2data>
+  802f15:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802f1c:	50                   	push   %eax
+  802f1d:	6a 00                	push   $0x0
+  802f1f:	56                   	push   %esi
+  802f20:	6a 00                	push   $0x0
+  802f22:	e8 9a df ff ff       	call   800ec1 <sys_page_map>
+  802f27:	89 c3                	mov    %eax,%ebx
+  802f29:	83 c4 20             	add    $0x20,%esp
+  802f2c:	85 c0                	test   %eax,%eax
+  802f2e:	78 4e                	js     802f7e <pipe+0x113>
+  802f30:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  802f35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f38:	89 02                	mov    %eax,(%edx)
+  802f3a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f3d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802f44:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f47:	89 02                	mov    %eax,(%edx)
+  802f49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f4c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802f53:	83 ec 0c             	sub    $0xc,%esp
+  802f56:	ff 75 f4             	push   -0xc(%ebp)
+  802f59:	e8 bf ec ff ff       	call   801c1d <fd2num>
+  802f5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f61:	89 01                	mov    %eax,(%ecx)
+  802f63:	83 c4 04             	add    $0x4,%esp
+  802f66:	ff 75 f0             	push   -0x10(%ebp)
+  802f69:	e8 af ec ff ff       	call   801c1d <fd2num>
+  802f6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f71:	89 41 04             	mov    %eax,0x4(%ecx)
+  802f74:	83 c4 10             	add    $0x10,%esp
+  802f77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f7c:	eb 2e                	jmp    802fac <pipe+0x141>
+  802f7e:	83 ec 08             	sub    $0x8,%esp
+  802f81:	56                   	push   %esi
+  802f82:	6a 00                	push   $0x0
+  802f84:	e8 c7 df ff ff       	call   800f50 <sys_page_unmap>
+  802f89:	83 c4 10             	add    $0x10,%esp
+  802f8c:	83 ec 08             	sub    $0x8,%esp
+  802f8f:	ff 75 f0             	push   -0x10(%ebp)
+  802f92:	6a 00                	push   $0x0
+  802f94:	e8 b7 df ff ff       	call   800f50 <sys_page_unmap>
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	83 ec 08             	sub    $0x8,%esp
+  802f9f:	ff 75 f4             	push   -0xc(%ebp)
+  802fa2:	6a 00                	push   $0x0
+  802fa4:	e8 a7 df ff ff       	call   800f50 <sys_page_unmap>
+  802fa9:	83 c4 10             	add    $0x10,%esp
+  802fac:	89 d8                	mov    %ebx,%eax
+  802fae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fb1:	5b                   	pop    %ebx
+  802fb2:	5e                   	pop    %esi
+  802fb3:	5d                   	pop    %ebp
+  802fb4:	c3                   	ret
+
+00802fb5 <pipeisclosed>:
+  802fb5:	55                   	push   %ebp
+  802fb6:	89 e5                	mov    %esp,%ebp
+  802fb8:	83 ec 20             	sub    $0x20,%esp
+  802fbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fbe:	50                   	push   %eax
+  802fbf:	ff 75 08             	push   0x8(%ebp)
+  802fc2:	e8 cd ec ff ff       	call   801c94 <fd_lookup>
+  802fc7:	83 c4 10             	add    $0x10,%esp
+  802fca:	85 c0                	test   %eax,%eax
+  802fcc:	78 18                	js     802fe6 <pipeisclosed+0x31>
+  802fce:	83 ec 0c             	sub    $0xc,%esp
+  802fd1:	ff 75 f4             	push   -0xc(%ebp)
+  802fd4:	e8 54 ec ff ff       	call   801c2d <fd2data>
+  802fd9:	89 c2                	mov    %eax,%edx
+  802fdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fde:	e8 16 fd ff ff       	call   802cf9 <_pipeisclosed>
+  802fe3:	83 c4 10             	add    $0x10,%esp
+  802fe6:	c9                   	leave
+  802fe7:	c3                   	ret
+
+00802fe8 <ipcring_init>:
+  802fe8:	55                   	push   %ebp
+  802fe9:	89 e5                	mov    %esp,%ebp
+  802feb:	53                   	push   %ebx
+  802fec:	83 ec 08             	sub    $0x8,%esp
+  802fef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ff2:	6a 60                	push   $0x60
+  802ff4:	6a 00                	push   $0x0
+  802ff6:	53                   	push   %ebx
+  802ff7:	e8 9d db ff ff       	call   800b99 <memset>
+  802ffc:	a1 14 60 80 00       	mov    0x806014,%eax
+  803001:	8b 40 48             	mov    0x48(%eax),%eax
+  803004:	89 03                	mov    %eax,(%ebx)
+  803006:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803009:	89 43 04             	mov    %eax,0x4(%ebx)
+  80300c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80300f:	89 43 08             	mov    %eax,0x8(%ebx)
+  803012:	8b 45 14             	mov    0x14(%ebp),%eax
+  803015:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80301e:	c9                   	leave
+  80301f:	c3                   	ret
+
+00803020 <ipcring_req_slot>:
+  803020:	55                   	push   %ebp
+  803021:	89 e5                	mov    %esp,%ebp
+  803023:	8b 45 08             	mov    0x8(%ebp),%eax
+  803026:	8b 50 10             	mov    0x10(%eax),%edx
+  803029:	8b 48 18             	mov    0x18(%eax),%ecx
+  80302c:	29 ca                	sub    %ecx,%edx
+  80302e:	83 fa 07             	cmp    $0x7,%edx
+  803031:	77 0c                	ja     80303f <ipcring_req_slot+0x1f>
+  803033:	8b 50 10             	mov    0x10(%eax),%edx
+  803036:	83 e2 07             	and    $0x7,%edx
+  803039:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80303d:	5d                   	pop    %ebp
+  80303e:	c3                   	ret
+  80303f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803044:	eb f7                	jmp    80303d <ipcring_req_slot+0x1d>
+
+00803046 <ipcring_req_push>:
+  803046:	55                   	push   %ebp
+  803047:	89 e5                	mov    %esp,%ebp
+  803049:	83 ec 08             	sub    $0x8,%esp
+  80304c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80304f:	8b 42 10             	mov    0x10(%edx),%eax
+  803052:	83 c0 01             	add    $0x1,%eax
+  803055:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803059:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305e:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803062:	85 c0                	test   %eax,%eax
+  803064:	75 02                	jne    803068 <ipcring_req_push+0x22>
+  803066:	c9                   	leave
+  803067:	c3                   	ret
+  803068:	6a 00                	push   $0x0
+  80306a:	68 00 00 80 ee       	push   $0xee800000
+  80306f:	ff 72 08             	push   0x8(%edx)
+  803072:	ff 72 04             	push   0x4(%edx)
+  803075:	e8 3c e1 ff ff       	call   8011b6 <sys_ipc_send>
+  80307a:	83 c4 10             	add    $0x10,%esp
+  80307d:	eb e7                	jmp    803066 <ipcring_req_push+0x20>
+
+0080307f <ipcring_rsp_wait>:
+  80307f:	55                   	push   %ebp
+  803080:	89 e5                	mov    %esp,%ebp
+  803082:	53                   	push   %ebx
+  803083:	83 ec 04             	sub    $0x4,%esp
+  803086:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803089:	8b 53 18             	mov    0x18(%ebx),%edx
+  80308c:	8b 43 10             	mov    0x10(%ebx),%eax
+  80308f:	39 c2                	cmp    %eax,%edx
+  803091:	74 3c                	je     8030cf <ipcring_rsp_wait+0x50>
+  803093:	8b 53 14             	mov    0x14(%ebx),%edx
+  803096:	8b 43 18             	mov    0x18(%ebx),%eax
+  803099:	39 c2                	cmp    %eax,%edx
+  80309b:	75 23                	jne    8030c0 <ipcring_rsp_wait+0x41>
+  80309d:	83 ec 08             	sub    $0x8,%esp
+  8030a0:	6a 00                	push   $0x0
+  8030a2:	6a 00                	push   $0x0
+  8030a4:	6a 00                	push   $0x0
+  8030a6:	6a 00                	push   $0x0
+  8030a8:	ff 73 0c             	push   0xc(%ebx)
+  8030ab:	ff 73 04             	push   0x4(%ebx)
+  8030ae:	e8 24 04 00 00       	call   8034d7 <ipc_call>
+  8030b3:	8b 53 14             	mov    0x14(%ebx),%edx
+  8030b6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8030b9:	83 c4 20             	add    $0x20,%esp
+  8030bc:	39 c2                	cmp    %eax,%edx
+  8030be:	74 dd                	je     80309d <ipcring_rsp_wait+0x1e>
+  8030c0:	8b 43 18             	mov    0x18(%ebx),%eax
+  8030c3:	83 e0 07             	and    $0x7,%eax
+  8030c6:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8030ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+  8030cf:	68 00 3f 80 00       	push   $0x803f00
+  8030d4:	68 b1 3e 80 00       	push   $0x803eb1
+  8030d9:	6a 3b                	push   $0x3b
+  8030db:	68 21 3f 80 00       	push   $0x803f21
+  8030e0:	e8 67 d1 ff ff       	call   80024c <_panic>
+
+008030e5 <ipcring_rsp_pop>:
+  8030e5:	55                   	push   %ebp
+  8030e6:	89 e5                	mov    %esp,%ebp
+  8030e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030eb:	8b 42 18             	mov    0x18(%edx),%eax
+  8030ee:	83 c0 01             	add    $0x1,%eax
+  8030f1:	89 42 18             	mov    %eax,0x18(%edx)
+  8030f4:	5d                   	pop    %ebp
+  8030f5:	c3                   	ret
+
+008030f6 <ipcring_server_init>:
+  8030f6:	55                   	push   %ebp
+  8030f7:	89 e5                	mov    %esp,%ebp
+  8030f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030ff:	89 10                	mov    %edx,(%eax)
+  803101:	8b 55 10             	mov    0x10(%ebp),%edx
+  803104:	89 50 04             	mov    %edx,0x4(%eax)
+  803107:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80310e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803115:	5d                   	pop    %ebp
+  803116:	c3                   	ret
+
+00803117 <ipcring_req_avail>:
+  803117:	55                   	push   %ebp
+  803118:	89 e5                	mov    %esp,%ebp
+  80311a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80311d:	8b 02                	mov    (%edx),%eax
+  80311f:	8b 40 10             	mov    0x10(%eax),%eax
+  803122:	2b 42 08             	sub    0x8(%edx),%eax
+  803125:	ba 08 00 00 00       	mov    $0x8,%edx
+  80312a:	39 d0                	cmp    %edx,%eax
+  80312c:	0f 47 c2             	cmova  %edx,%eax
+  80312f:	5d                   	pop    %ebp
+  803130:	c3                   	ret
+
+00803131 <ipcring_req_peek>:
+  803131:	55                   	push   %ebp
+  803132:	89 e5                	mov    %esp,%ebp
+  803134:	8b 55 08             	mov    0x8(%ebp),%edx
+  803137:	8b 42 08             	mov    0x8(%edx),%eax
+  80313a:	83 e0 07             	and    $0x7,%eax
+  80313d:	8b 12                	mov    (%edx),%edx
+  80313f:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803143:	5d                   	pop    %ebp
+  803144:	c3                   	ret
+
+00803145 <ipcring_rsp_push>:
+  803145:	55                   	push   %ebp
+  803146:	89 e5                	mov    %esp,%ebp
+  803148:	83 ec 08             	sub    $0x8,%esp
+  80314b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80314e:	8b 41 08             	mov    0x8(%ecx),%eax
+  803151:	83 c0 01             	add    $0x1,%eax
+  803154:	89 41 08             	mov    %eax,0x8(%ecx)
+  803157:	8b 11                	mov    (%ecx),%edx
+  803159:	83 c2 14             	add    $0x14,%edx
+  80315c:	f0 87 02             	lock xchg %eax,(%edx)
+  80315f:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803163:	75 02                	jne    803167 <ipcring_rsp_push+0x22>
+  803165:	c9                   	leave
+  803166:	c3                   	ret
+  803167:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  80316e:	6a 00                	push   $0x0
+  803170:	68 00 00 80 ee       	push   $0xee800000
+  803175:	6a 00                	push   $0x0
+  803177:	ff 71 04             	push   0x4(%ecx)
+  80317a:	e8 5a df ff ff       	call   8010d9 <sys_ipc_try_send>
+  80317f:	83 c4 10             	add    $0x10,%esp
+  803182:	eb e1                	jmp    803165 <ipcring_rsp_push+0x20>
+
+00803184 <ipcring_client_wait>:
+  803184:	55                   	push   %ebp
+  803185:	89 e5                	mov    %esp,%ebp
+  803187:	83 ec 08             	sub    $0x8,%esp
+  80318a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318d:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803194:	8b 10                	mov    (%eax),%edx
+  803196:	8b 52 18             	mov    0x18(%edx),%edx
+  803199:	3b 50 08             	cmp    0x8(%eax),%edx
+  80319c:	75 02                	jne    8031a0 <ipcring_client_wait+0x1c>
+  80319e:	c9                   	leave
+  80319f:	c3                   	ret
+  8031a0:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8031a7:	6a 00                	push   $0x0
+  8031a9:	68 00 00 80 ee       	push   $0xee800000
+  8031ae:	6a 00                	push   $0x0
+  8031b0:	ff 70 04             	push   0x4(%eax)
+  8031b3:	e8 21 df ff ff       	call   8010d9 <sys_ipc_try_send>
+  8031b8:	83 c4 10             	add    $0x10,%esp
+  8031bb:	eb e1                	jmp    80319e <ipcring_client_wait+0x1a>
+
+008031bd <ipcring_server_sleep>:
+  8031bd:	55                   	push   %ebp
+  8031be:	89 e5                	mov    %esp,%ebp
+  8031c0:	53                   	push   %ebx
+  8031c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031c4:	8b 01                	mov    (%ecx),%eax
+  8031c6:	8d 50 1c             	lea    0x1c(%eax),%edx
+  8031c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031ce:	f0 87 02             	lock xchg %eax,(%edx)
+  8031d1:	8b 11                	mov    (%ecx),%edx
+  8031d3:	8b 5a 10             	mov    0x10(%edx),%ebx
+  8031d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031db:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8031de:	74 0e                	je     8031ee <ipcring_server_sleep+0x31>
+  8031e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e5:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8031e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031f1:	c9                   	leave
+  8031f2:	c3                   	ret
+
+008031f3 <devcons_close>:
+  8031f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f8:	c3                   	ret
+
+008031f9 <devcons_stat>:
+  8031f9:	55                   	push   %ebp
+  8031fa:	89 e5                	mov    %esp,%ebp
+  8031fc:	83 ec 10             	sub    $0x10,%esp
+  8031ff:	68 2f 3f 80 00       	push   $0x803f2f
+  803204:	ff 75 0c             	push   0xc(%ebp)
+  803207:	e8 12 d8 ff ff       	call   800a1e <strcpy>
+  80320c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803211:	c9                   	leave
+  803212:	c3                   	ret
+
+00803213 <devcons_write>:
+  803213:	55                   	push   %ebp
+  803214:	89 e5                	mov    %esp,%ebp
+  803216:	57                   	push   %edi
+  803217:	56                   	push   %esi
+  803218:	53                   	push   %ebx
+  803219:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80321f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803222:	85 ff                	test   %edi,%edi
+  803224:	74 51                	je     803277 <devcons_write+0x64>
+  803226:	be 00 00 00 00       	mov    $0x0,%esi
+  80322b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803230:	89 fb                	mov    %edi,%ebx
+  803232:	29 c3                	sub    %eax,%ebx
+  803234:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803239:	39 d3                	cmp    %edx,%ebx
+  80323b:	0f 47 da             	cmova  %edx,%ebx
+  80323e:	83 ec 04             	sub    $0x4,%esp
+  803241:	53                   	push   %ebx
+  803242:	03 45 0c             	add    0xc(%ebp),%eax
+  803245:	50                   	push   %eax
+  803246:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80324c:	50                   	push   %eax
+  80324d:	e8 7c d9 ff ff       	call   800bce <memmove>
+  803252:	83 c4 08             	add    $0x8,%esp
+  803255:	53                   	push   %ebx
+  803256:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80325c:	50                   	push   %eax
+  80325d:	e8 34 db ff ff       	call   800d96 <sys_cputs>
+  803262:	01 de                	add    %ebx,%esi
+  803264:	89 f0                	mov    %esi,%eax
+  803266:	83 c4 10             	add    $0x10,%esp
+  803269:	39 fe                	cmp    %edi,%esi
+  80326b:	72 c3                	jb     803230 <devcons_write+0x1d>
+  80326d:	89 f0                	mov    %esi,%eax
+  80326f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803272:	5b                   	pop    %ebx
+  803273:	5e                   	pop    %esi
+  803274:	5f                   	pop    %edi
+  803275:	5d                   	pop    %ebp
+  803276:	c3                   	ret
+  803277:	be 00 00 00 00       	mov    $0x0,%esi
+  80327c:	eb ef                	jmp    80326d <devcons_write+0x5a>
+
+0080327e <devcons_read>:
+  80327e:	55                   	push   %ebp
+  80327f:	89 e5                	mov    %esp,%ebp
+  803281:	83 ec 08             	sub    $0x8,%esp
+  803284:	b8 00 00 00 00       	mov    $0x0,%eax
+  803289:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80328d:	75 07                	jne    803296 <devcons_read+0x18>
+  80328f:	eb 1f                	jmp    8032b0 <devcons_read+0x32>
+  803291:	e8 9d db ff ff       	call   800e33 <sys_yield>
+  803296:	e8 19 db ff ff       	call   800db4 <sys_cgetc>
+  80329b:	85 c0                	test   %eax,%eax
+  80329d:	74 f2                	je     803291 <devcons_read+0x13>
+  80329f:	78 0f                	js     8032b0 <devcons_read+0x32>
+  8032a1:	83 f8 04             	cmp    $0x4,%eax
+  8032a4:	74 0c                	je     8032b2 <devcons_read+0x34>
+  8032a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032a9:	88 02                	mov    %al,(%edx)
+  8032ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032b0:	c9                   	leave
+  8032b1:	c3                   	ret
+  8032b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b7:	eb f7                	jmp    8032b0 <devcons_read+0x32>
+
+008032b9 <cputchar>:
+  8032b9:	55                   	push   %ebp
+  8032ba:	89 e5                	mov    %esp,%ebp
+  8032bc:	83 ec 20             	sub    $0x20,%esp
+  8032bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c2:	88 45 f7             	mov    %al,-0x9(%ebp)
+  8032c5:	6a 01                	push   $0x1
+  8032c7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032ca:	50                   	push   %eax
+  8032cb:	e8 c6 da ff ff       	call   800d96 <sys_cputs>
+  8032d0:	83 c4 10             	add    $0x10,%esp
+  8032d3:	c9                   	leave
+  8032d4:	c3                   	ret
+
+008032d5 <getchar>:
+  8032d5:	55                   	push   %ebp
+  8032d6:	89 e5                	mov    %esp,%ebp
+  8032d8:	83 ec 1c             	sub    $0x1c,%esp
+  8032db:	6a 01                	push   $0x1
+  8032dd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032e0:	50                   	push   %eax
+  8032e1:	6a 00                	push   $0x0
+  8032e3:	e8 0e ec ff ff       	call   801ef6 <read>
+  8032e8:	83 c4 10             	add    $0x10,%esp
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	78 06                	js     8032f5 <getchar+0x20>
+  8032ef:	74 06                	je     8032f7 <getchar+0x22>
+  8032f1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8032f5:	c9                   	leave
+  8032f6:	c3                   	ret
+  8032f7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8032fc:	eb f7                	jmp    8032f5 <getchar+0x20>
+
+008032fe <iscons>:
+  8032fe:	55                   	push   %ebp
+  8032ff:	89 e5                	mov    %esp,%ebp
+  803301:	83 ec 20             	sub    $0x20,%esp
+  803304:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803307:	50                   	push   %eax
+  803308:	ff 75 08             	push   0x8(%ebp)
+  80330b:	e8 84 e9 ff ff       	call   801c94 <fd_lookup>
+  803310:	83 c4 10             	add    $0x10,%esp
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 11                	js     803328 <iscons+0x2a>
+  803317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80331a:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803320:	39 10                	cmp    %edx,(%eax)
+  803322:	0f 94 c0             	sete   %al
+  803325:	0f b6 c0             	movzbl %al,%eax
+  803328:	c9                   	leave
+  803329:	c3                   	ret
+
+0080332a <opencons>:
+  80332a:	55                   	push   %ebp
+  80332b:	89 e5                	mov    %esp,%ebp
+  80332d:	83 ec 24             	sub    $0x24,%esp
+  803330:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803333:	50                   	push   %eax
+  803334:	e8 0b e9 ff ff       	call   801c44 <fd_alloc>
+  803339:	83 c4 10             	add    $0x10,%esp
+  80333c:	85 c0                	test   %eax,%eax
+  80333e:	78 3a                	js     80337a <opencons+0x50>
+  803340:	83 ec 04             	sub    $0x4,%esp
+  803343:	68 07 04 00 00       	push   $0x407
+  803348:	ff 75 f4             	push   -0xc(%ebp)
+  80334b:	6a 00                	push   $0x0
+  80334d:	e8 2c db ff ff       	call   800e7e <sys_page_alloc>
+  803352:	83 c4 10             	add    $0x10,%esp
+  803355:	85 c0                	test   %eax,%eax
+  803357:	78 21                	js     80337a <opencons+0x50>
+  803359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80335c:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803362:	89 10                	mov    %edx,(%eax)
+  803364:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803367:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  80336e:	83 ec 0c             	sub    $0xc,%esp
+  803371:	50                   	push   %eax
+  803372:	e8 a6 e8 ff ff       	call   801c1d <fd2num>
+  803377:	83 c4 10             	add    $0x10,%esp
+  80337a:	c9                   	leave
+  80337b:	c3                   	ret
+
+0080337c <set_pgfault_handler>:
+  80337c:	55                   	push   %ebp
+  80337d:	89 e5                	mov    %esp,%ebp
+  80337f:	53                   	push   %ebx
+  803380:	83 ec 04             	sub    $0x4,%esp
+  803383:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80338a:	74 0d                	je     803399 <set_pgfault_handler+0x1d>
+  80338c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80338f:	a3 00 90 80 00       	mov    %eax,0x809000
+  803394:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803397:	c9                   	leave
+  803398:	c3                   	ret
+  803399:	e8 76 da ff ff       	call   800e14 <sys_getenvid>
+  80339e:	89 c3                	mov    %eax,%ebx
+  8033a0:	83 ec 04             	sub    $0x4,%esp
+  8033a3:	6a 07                	push   $0x7
+  8033a5:	68 00 f0 7f ee       	push   $0xee7ff000
+  8033aa:	50                   	push   %eax
+  8033ab:	e8 ce da ff ff       	call   800e7e <sys_page_alloc>
+  8033b0:	83 c4 10             	add    $0x10,%esp
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	78 29                	js     8033e0 <set_pgfault_handler+0x64>
+  8033b7:	83 ec 08             	sub    $0x8,%esp
+  8033ba:	68 f4 33 80 00       	push   $0x8033f4
+  8033bf:	53                   	push   %ebx
+  8033c0:	e8 d2 dc ff ff       	call   801097 <sys_env_set_pgfault_upcall>
+  8033c5:	83 c4 10             	add    $0x10,%esp
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	79 c0                	jns    80338c <set_pgfault_handler+0x10>
+  8033cc:	83 ec 04             	sub    $0x4,%esp
+  8033cf:	68 74 3f 80 00       	push   $0x803f74
+  8033d4:	6a 27                	push   $0x27
+  8033d6:	68 a6 3f 80 00       	push   $0x803fa6
+  8033db:	e8 6c ce ff ff       	call   80024c <_panic>
+  8033e0:	83 ec 04             	sub    $0x4,%esp
+  8033e3:	68 3c 3f 80 00       	push   $0x803f3c
+  8033e8:	6a 23                	push   $0x23
+  8033ea:	68 a6 3f 80 00       	push   $0x803fa6
+  8033ef:	e8 58 ce ff ff       	call   80024c <_panic>
+
+008033f4 <_pgfault_upcall>:
+  8033f4:	54                   	push   %esp
+  8033f5:	a1 00 90 80 00       	mov    0x809000,%eax
+  8033fa:	ff d0                	call   *%eax
+  8033fc:	83 c4 04             	add    $0x4,%esp
+  8033ff:	89 e3                	mov    %esp,%ebx
+  803401:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803405:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803409:	89 d4                	mov    %edx,%esp
+  80340b:	51                   	push   %ecx
+  80340c:	89 dc                	mov    %ebx,%esp
+  80340e:	83 ea 04             	sub    $0x4,%edx
+  803411:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803415:	83 c4 08             	add    $0x8,%esp
+  803418:	61                   	popa
+  803419:	83 c4 04             	add    $0x4,%esp
+  80341c:	9d                   	popf
+  80341d:	5c                   	pop    %esp
+  80341e:	c3                   	ret
+
+0080341f <ipc_recv>:
+  80341f:	55                   	push   %ebp
+  803420:	89 e5                	mov    %esp,%ebp
+  803422:	56                   	push   %esi
+  803423:	53                   	push   %ebx
+  803424:	8b 75 08             	mov    0x8(%ebp),%esi
+  803427:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80342a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80342d:	85 c0                	test   %eax,%eax
+  80342f:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803434:	0f 44 c2             	cmove  %edx,%eax
+  803437:	83 ec 0c             	sub    $0xc,%esp
+  80343a:	50                   	push   %eax
+  80343b:	e8 e9 dc ff ff       	call   801129 <sys_ipc_recv>
+  803440:	83 c4 10             	add    $0x10,%esp
+  803443:	85 c0                	test   %eax,%eax
+  803445:	78 2a                	js     803471 <ipc_recv+0x52>
+  803447:	a1 14 60 80 00       	mov    0x806014,%eax
+  80344c:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803452:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803458:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80345e:	85 f6                	test   %esi,%esi
+  803460:	74 02                	je     803464 <ipc_recv+0x45>
+  803462:	89 0e                	mov    %ecx,(%esi)
+  803464:	85 db                	test   %ebx,%ebx
+  803466:	74 02                	je     80346a <ipc_recv+0x4b>
+  803468:	89 13                	mov    %edx,(%ebx)
+  80346a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80346d:	5b                   	pop    %ebx
+  80346e:	5e                   	pop    %esi
+  80346f:	5d                   	pop    %ebp
+  803470:	c3                   	ret
+  803471:	ba 00 00 00 00       	mov    $0x0,%edx
+  803476:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80347b:	eb e1                	jmp    80345e <ipc_recv+0x3f>
+
+0080347d <ipc_send>:
+  80347d:	55                   	push   %ebp
+  80347e:	89 e5                	mov    %esp,%ebp
+  803480:	57                   	push   %edi
+  803481:	56                   	push   %esi
+  803482:	53                   	push   %ebx
+  803483:	83 ec 0c             	sub    $0xc,%esp
+  803486:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803489:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80348c:	8b 75 14             	mov    0x14(%ebp),%esi
+  80348f:	85 db                	test   %ebx,%ebx
+  803491:	74 1e                	je     8034b1 <ipc_send+0x34>
+  803493:	56                   	push   %esi
+  803494:	53                   	push   %ebx
+  803495:	57                   	push   %edi
+  803496:	ff 75 08             	push   0x8(%ebp)
+  803499:	e8 18 dd ff ff       	call   8011b6 <sys_ipc_send>
+  80349e:	83 c4 10             	add    $0x10,%esp
+  8034a1:	85 c0                	test   %eax,%eax
+  8034a3:	74 2a                	je     8034cf <ipc_send+0x52>
+  8034a5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8034a8:	75 13                	jne    8034bd <ipc_send+0x40>
+  8034aa:	e8 84 d9 ff ff       	call   800e33 <sys_yield>
+  8034af:	eb e2                	jmp    803493 <ipc_send+0x16>
+  8034b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b6:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8034bb:	eb d6                	jmp    803493 <ipc_send+0x16>
+  8034bd:	50                   	push   %eax
+  8034be:	68 b4 3f 80 00       	push   $0x803fb4
+  8034c3:	6a 4f                	push   $0x4f
+  8034c5:	68 f7 3f 80 00       	push   $0x803ff7
+  8034ca:	e8 7d cd ff ff       	call   80024c <_panic>
+  8034cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d2:	5b                   	pop    %ebx
+  8034d3:	5e                   	pop    %esi
+  8034d4:	5f                   	pop    %edi
+  8034d5:	5d                   	pop    %ebp
+  8034d6:	c3                   	ret
+
+008034d7 <ipc_call>:
+  8034d7:	55                   	push   %ebp
+  8034d8:	89 e5                	mov    %esp,%ebp
+  8034da:	57                   	push   %edi
+  8034db:	56                   	push   %esi
+  8034dc:	53                   	push   %ebx
+  8034dd:	83 ec 0c             	sub    $0xc,%esp
+  8034e0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034e4:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  8034e9:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  8034ed:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8034f1:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  8034f6:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  8034fa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803503:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803507:	eb 05                	jmp    80350e <ipc_call+0x37>
+  803509:	e8 25 d9 ff ff       	call   800e33 <sys_yield>
+  80350e:	83 ec 0c             	sub    $0xc,%esp
+  803511:	56                   	push   %esi
+  803512:	53                   	push   %ebx
+  803513:	57                   	push   %edi
+  803514:	ff 75 0c             	push   0xc(%ebp)
+  803517:	ff 75 08             	push   0x8(%ebp)
+  80351a:	e8 e7 dc ff ff       	call   801206 <sys_ipc_call>
+  80351f:	83 c4 20             	add    $0x20,%esp
+  803522:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803525:	74 e2                	je     803509 <ipc_call+0x32>
+  803527:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80352a:	74 2d                	je     803559 <ipc_call+0x82>
+  80352c:	85 c0                	test   %eax,%eax
+  80352e:	78 4f                	js     80357f <ipc_call+0xa8>
+  803530:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803534:	74 10                	je     803546 <ipc_call+0x6f>
+  803536:	a1 14 60 80 00       	mov    0x806014,%eax
+  80353b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803541:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803544:	89 02                	mov    %eax,(%edx)
+  803546:	a1 14 60 80 00       	mov    0x806014,%eax
+  80354b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803551:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803554:	5b                   	pop    %ebx
+  803555:	5e                   	pop    %esi
+  803556:	5f                   	pop    %edi
+  803557:	5d                   	pop    %ebp
+  803558:	c3                   	ret
+  803559:	ff 75 14             	push   0x14(%ebp)
+  80355c:	ff 75 10             	push   0x10(%ebp)
+  80355f:	ff 75 0c             	push   0xc(%ebp)
+  803562:	ff 75 08             	push   0x8(%ebp)
+  803565:	e8 13 ff ff ff       	call   80347d <ipc_send>
+  80356a:	83 c4 0c             	add    $0xc,%esp
+  80356d:	ff 75 1c             	push   0x1c(%ebp)
+  803570:	ff 75 18             	push   0x18(%ebp)
+  803573:	6a 00                	push   $0x0
+  803575:	e8 a5 fe ff ff       	call   80341f <ipc_recv>
+  80357a:	83 c4 10             	add    $0x10,%esp
+  80357d:	eb d2                	jmp    803551 <ipc_call+0x7a>
+  80357f:	50                   	push   %eax
+  803580:	68 01 40 80 00       	push   $0x804001
+  803585:	6a 6d                	push   $0x6d
+  803587:	68 f7 3f 80 00       	push   $0x803ff7
+  80358c:	e8 bb cc ff ff       	call   80024c <_panic>
+
+00803591 <ipc_reply_recv>:
+  803591:	55                   	push   %ebp
+  803592:	89 e5                	mov    %esp,%ebp
+  803594:	57                   	push   %edi
+  803595:	56                   	push   %esi
+  803596:	53                   	push   %ebx
+  803597:	83 ec 0c             	sub    $0xc,%esp
+  80359a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80359d:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8035a0:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8035a3:	85 db                	test   %ebx,%ebx
+  8035a5:	0f 84 ac 00 00 00    	je     803657 <ipc_reply_recv+0xc6>
+  8035ab:	85 f6                	test   %esi,%esi
+  8035ad:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8035b2:	0f 45 c6             	cmovne %esi,%eax
+  8035b5:	83 ec 0c             	sub    $0xc,%esp
+  8035b8:	50                   	push   %eax
+  8035b9:	ff 75 14             	push   0x14(%ebp)
+  8035bc:	53                   	push   %ebx
+  8035bd:	ff 75 0c             	push   0xc(%ebp)
+  8035c0:	ff 75 08             	push   0x8(%ebp)
+  8035c3:	e8 5f dc ff ff       	call   801227 <sys_ipc_reply_recv>
+  8035c8:	83 c4 20             	add    $0x20,%esp
+  8035cb:	85 c0                	test   %eax,%eax
+  8035cd:	78 3a                	js     803609 <ipc_reply_recv+0x78>
+  8035cf:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8035d3:	74 10                	je     8035e5 <ipc_reply_recv+0x54>
+  8035d5:	a1 14 60 80 00       	mov    0x806014,%eax
+  8035da:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  8035e0:	8b 55 18             	mov    0x18(%ebp),%edx
+  8035e3:	89 02                	mov    %eax,(%edx)
+  8035e5:	85 ff                	test   %edi,%edi
+  8035e7:	74 0d                	je     8035f6 <ipc_reply_recv+0x65>
+  8035e9:	a1 14 60 80 00       	mov    0x806014,%eax
+  8035ee:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  8035f4:	89 07                	mov    %eax,(%edi)
+  8035f6:	a1 14 60 80 00       	mov    0x806014,%eax
+  8035fb:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803601:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803604:	5b                   	pop    %ebx
+  803605:	5e                   	pop    %esi
+  803606:	5f                   	pop    %edi
+  803607:	5d                   	pop    %ebp
+  803608:	c3                   	ret
+  803609:	ff 75 14             	push   0x14(%ebp)
+  80360c:	53                   	push   %ebx
+  80360d:	ff 75 0c             	push   0xc(%ebp)
+  803610:	ff 75 08             	push   0x8(%ebp)
+  803613:	e8 c1 da ff ff       	call   8010d9 <sys_ipc_try_send>
+  803618:	89 c2                	mov    %eax,%edx
+  80361a:	c1 ea 1f             	shr    $0x1f,%edx
+  80361d:	83 c4 10             	add    $0x10,%esp
+  803620:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803623:	0f 95 c1             	setne  %cl
+  803626:	84 d1                	test   %dl,%cl
+  803628:	74 05                	je     80362f <ipc_reply_recv+0x9e>
+  80362a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80362d:	75 12                	jne    803641 <ipc_reply_recv+0xb0>
+  80362f:	83 ec 04             	sub    $0x4,%esp
+  803632:	57                   	push   %edi
+  803633:	56                   	push   %esi
+  803634:	ff 75 18             	push   0x18(%ebp)
+  803637:	e8 e3 fd ff ff       	call   80341f <ipc_recv>
+  80363c:	83 c4 10             	add    $0x10,%esp
+  80363f:	eb c0                	jmp    803601 <ipc_reply_recv+0x70>
+  803641:	83 ec 04             	sub    $0x4,%esp
+  803644:	50                   	push   %eax
+  803645:	ff 75 08             	push   0x8(%ebp)
+  803648:	68 d4 3f 80 00       	push   $0x803fd4
+  80364d:	e8 d5 cc ff ff       	call   800327 <cprintf>
+  803652:	83 c4 10             	add    $0x10,%esp
+  803655:	eb d8                	jmp    80362f <ipc_reply_recv+0x9e>
+  803657:	85 f6                	test   %esi,%esi
+  803659:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80365e:	0f 45 c6             	cmovne %esi,%eax
+  803661:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803666:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  80366d:	e9 43 ff ff ff       	jmp    8035b5 <ipc_reply_recv+0x24>
+
+00803672 <ipc_find_env>:
+  803672:	55                   	push   %ebp
+  803673:	89 e5                	mov    %esp,%ebp
+  803675:	83 ec 14             	sub    $0x14,%esp
+  803678:	ff 75 08             	push   0x8(%ebp)
+  80367b:	e8 f7 d9 ff ff       	call   801077 <sys_env_service>
+  803680:	85 c0                	test   %eax,%eax
+  803682:	ba 00 00 00 00       	mov    $0x0,%edx
+  803687:	0f 48 c2             	cmovs  %edx,%eax
+  80368a:	c9                   	leave
+  80368b:	c3                   	ret
+
+0080368c <pageref>:
+  80368c:	55                   	push   %ebp
+  80368d:	89 e5                	mov    %esp,%ebp
+  80368f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803692:	89 c2                	mov    %eax,%edx
+  803694:	c1 ea 16             	shr    $0x16,%edx
+  803697:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80369e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036a3:	f6 c1 01             	test   $0x1,%cl
+  8036a6:	74 22                	je     8036ca <pageref+0x3e>
+  8036a8:	c1 e8 0c             	shr    $0xc,%eax
+  8036ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036b2:	a8 01                	test   $0x1,%al
+  8036b4:	74 14                	je     8036ca <pageref+0x3e>
+  8036b6:	c1 e8 0c             	shr    $0xc,%eax
+  8036b9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8036bc:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8036c3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8036c7:	0f b7 d2             	movzwl %dx,%edx
+  8036ca:	89 d0                	mov    %edx,%eax
+  8036cc:	5d                   	pop    %ebp
+  8036cd:	c3                   	ret
+
+008036ce <__udivmoddi4>:
+  8036ce:	55                   	push   %ebp
+  8036cf:	57                   	push   %edi
+  8036d0:	56                   	push   %esi
+  8036d1:	53                   	push   %ebx
+  8036d2:	83 ec 24             	sub    $0x24,%esp
+  8036d5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036d9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036dd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8036e1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8036e5:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8036e9:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8036ed:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8036f1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8036f5:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8036f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803703:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803708:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80370f:	00 
+  803710:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803717:	00 
+  803718:	89 fb                	mov    %edi,%ebx
+  80371a:	eb 08                	jmp    803724 <__udivmoddi4+0x56>
+  80371c:	83 e9 01             	sub    $0x1,%ecx
+  80371f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803722:	74 68                	je     80378c <__udivmoddi4+0xbe>
+  803724:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803728:	01 c0                	add    %eax,%eax
+  80372a:	89 c6                	mov    %eax,%esi
+  80372c:	89 d7                	mov    %edx,%edi
+  80372e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803732:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803736:	0f ad d0             	shrd   %cl,%edx,%eax
+  803739:	d3 ea                	shr    %cl,%edx
+  80373b:	f6 c1 20             	test   $0x20,%cl
+  80373e:	74 04                	je     803744 <__udivmoddi4+0x76>
+  803740:	89 d0                	mov    %edx,%eax
+  803742:	31 d2                	xor    %edx,%edx
+  803744:	83 e0 01             	and    $0x1,%eax
+  803747:	89 04 24             	mov    %eax,(%esp)
+  80374a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803751:	00 
+  803752:	8b 04 24             	mov    (%esp),%eax
+  803755:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803759:	09 f0                	or     %esi,%eax
+  80375b:	09 fa                	or     %edi,%edx
+  80375d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803761:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803765:	39 f0                	cmp    %esi,%eax
+  803767:	89 d5                	mov    %edx,%ebp
+  803769:	19 fd                	sbb    %edi,%ebp
+  80376b:	72 af                	jb     80371c <__udivmoddi4+0x4e>
+  80376d:	29 f0                	sub    %esi,%eax
+  80376f:	19 fa                	sbb    %edi,%edx
+  803771:	89 cf                	mov    %ecx,%edi
+  803773:	c1 ef 05             	shr    $0x5,%edi
+  803776:	83 e7 01             	and    $0x1,%edi
+  803779:	89 fe                	mov    %edi,%esi
+  80377b:	83 f6 01             	xor    $0x1,%esi
+  80377e:	d3 e6                	shl    %cl,%esi
+  803780:	d3 e7                	shl    %cl,%edi
+  803782:	09 74 24 18          	or     %esi,0x18(%esp)
+  803786:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80378a:	eb 90                	jmp    80371c <__udivmoddi4+0x4e>
+  80378c:	85 db                	test   %ebx,%ebx
+  80378e:	74 05                	je     803795 <__udivmoddi4+0xc7>
+  803790:	89 03                	mov    %eax,(%ebx)
+  803792:	89 53 04             	mov    %edx,0x4(%ebx)
+  803795:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803799:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80379d:	83 c4 24             	add    $0x24,%esp
+  8037a0:	5b                   	pop    %ebx
+  8037a1:	5e                   	pop    %esi
+  8037a2:	5f                   	pop    %edi
+  8037a3:	5d                   	pop    %ebp
+  8037a4:	c3                   	ret
+
+008037a5 <__udivdi3>:
+  8037a5:	83 ec 08             	sub    $0x8,%esp
+  8037a8:	6a 00                	push   $0x0
+  8037aa:	ff 74 24 1c          	push   0x1c(%esp)
+  8037ae:	ff 74 24 1c          	push   0x1c(%esp)
+  8037b2:	ff 74 24 1c          	push   0x1c(%esp)
+  8037b6:	ff 74 24 1c          	push   0x1c(%esp)
+  8037ba:	e8 0f ff ff ff       	call   8036ce <__udivmoddi4>
+  8037bf:	83 c4 1c             	add    $0x1c,%esp
+  8037c2:	c3                   	ret
+
+008037c3 <__umoddi3>:
+  8037c3:	83 ec 18             	sub    $0x18,%esp
+  8037c6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8037ca:	50                   	push   %eax
+  8037cb:	ff 74 24 2c          	push   0x2c(%esp)
+  8037cf:	ff 74 24 2c          	push   0x2c(%esp)
+  8037d3:	ff 74 24 2c          	push   0x2c(%esp)
+  8037d7:	ff 74 24 2c          	push   0x2c(%esp)
+  8037db:	e8 ee fe ff ff       	call   8036ce <__udivmoddi4>
+  8037e0:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8037e4:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8037e8:	83 c4 2c             	add    $0x2c,%esp
+  8037eb:	c3                   	ret
+
+008037ec <__divdi3>:
+  8037ec:	53                   	push   %ebx
+  8037ed:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037f1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037f5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8037f9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8037fd:	85 d2                	test   %edx,%edx
+  8037ff:	78 12                	js     803813 <__divdi3+0x27>
+  803801:	85 db                	test   %ebx,%ebx
+  803803:	78 2e                	js     803833 <__divdi3+0x47>
+  803805:	53                   	push   %ebx
+  803806:	51                   	push   %ecx
+  803807:	52                   	push   %edx
+  803808:	50                   	push   %eax
+  803809:	e8 97 ff ff ff       	call   8037a5 <__udivdi3>
+  80380e:	83 c4 10             	add    $0x10,%esp
+  803811:	eb 1e                	jmp    803831 <__divdi3+0x45>
+  803813:	f7 d8                	neg    %eax
+  803815:	83 d2 00             	adc    $0x0,%edx
+  803818:	f7 da                	neg    %edx
+  80381a:	85 db                	test   %ebx,%ebx
+  80381c:	78 2a                	js     803848 <__divdi3+0x5c>
+  80381e:	53                   	push   %ebx
+  80381f:	51                   	push   %ecx
+  803820:	52                   	push   %edx
+  803821:	50                   	push   %eax
+  803822:	e8 7e ff ff ff       	call   8037a5 <__udivdi3>
+  803827:	83 c4 10             	add    $0x10,%esp
+  80382a:	f7 d8                	neg    %eax
+  80382c:	83 d2 00             	adc    $0x0,%edx
+  80382f:	f7 da                	neg    %edx
+  803831:	5b                   	pop    %ebx
+  803832:	c3                   	ret
+  803833:	f7 d9                	neg    %ecx
+  803835:	83 d3 00             	adc    $0x0,%ebx
+  803838:	f7 db                	neg    %ebx
+  80383a:	53                   	push   %ebx
+  80383b:	51                   	push   %ecx
+  80383c:	52                   	push   %edx
+  80383d:	50                   	push   %eax
+  80383e:	e8 62 ff ff ff       	call   8037a5 <__udivdi3>
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	eb e2                	jmp    80382a <__divdi3+0x3e>
+  803848:	f7 d9                	neg    %ecx
+  80384a:	83 d3 00             	adc    $0x0,%ebx
+  80384d:	f7 db                	neg    %ebx
+  80384f:	53                   	push   %ebx
+  803850:	51                   	push   %ecx
+  803851:	52                   	push   %edx
+  803852:	50                   	push   %eax
+  803853:	e8 4d ff ff ff       	call   8037a5 <__udivdi3>
+  803858:	83 c4 10             	add    $0x10,%esp
+  80385b:	eb d4                	jmp    803831 <__divdi3+0x45>
+
+0080385d <__moddi3>:
+  80385d:	55                   	push   %ebp
+  80385e:	57                   	push   %edi
+  80385f:	56                   	push   %esi
+  803860:	53                   	push   %ebx
+  803861:	83 ec 0c             	sub    $0xc,%esp
+  803864:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803868:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80386c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803870:	89 e9                	mov    %ebp,%ecx
+  803872:	f7 d9                	neg    %ecx
+  803874:	89 d0                	mov    %edx,%eax
+  803876:	83 d0 00             	adc    $0x0,%eax
+  803879:	f7 d8                	neg    %eax
+  80387b:	0f 49 e9             	cmovns %ecx,%ebp
+  80387e:	0f 49 d0             	cmovns %eax,%edx
+  803881:	52                   	push   %edx
+  803882:	55                   	push   %ebp
+  803883:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803887:	f7 da                	neg    %edx
+  803889:	89 d8                	mov    %ebx,%eax
+  80388b:	83 d0 00             	adc    $0x0,%eax
+  80388e:	f7 d8                	neg    %eax
+  803890:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803895:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803899:	0f 48 c3             	cmovs  %ebx,%eax
+  80389c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8038a0:	ff 74 24 0c          	push   0xc(%esp)
+  8038a4:	ff 74 24 0c          	push   0xc(%esp)
+  8038a8:	e8 16 ff ff ff       	call   8037c3 <__umoddi3>
+  8038ad:	83 c4 10             	add    $0x10,%esp
+  8038b0:	85 db                	test   %ebx,%ebx
+  8038b2:	78 08                	js     8038bc <__moddi3+0x5f>
+  8038b4:	83 c4 0c             	add    $0xc,%esp
+  8038b7:	5b                   	pop    %ebx
+  8038b8:	5e                   	pop    %esi
+  8038b9:	5f                   	pop    %edi
+  8038ba:	5d                   	pop    %ebp
+  8038bb:	c3                   	ret
+  8038bc:	f7 d8                	neg    %eax
+  8038be:	83 d2 00             	adc    $0x0,%edx
+  8038c1:	f7 da                	neg    %edx
+  8038c3:	eb ef                	jmp    8038b4 <__moddi3+0x57>
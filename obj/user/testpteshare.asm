@@ -0,0 +1,6273 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 63 01 00 00       	call   800194 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  800039:	ff 35 00 50 80 00    	push   0x805000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 96 09 00 00       	call   8009df <strcpy>
+  800049:	e8 8f 01 00 00       	call   8001dd <exit>
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 d0 00 00 00    	jne    800134 <umain+0xe1>
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	68 07 04 00 00       	push   $0x407
+  80006c:	68 00 00 00 a0       	push   $0xa0000000
+  800071:	6a 00                	push   $0x0
+  800073:	e8 c7 0d 00 00       	call   800e3f <sys_page_alloc>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	0f 88 bb 00 00 00    	js     80013e <umain+0xeb>
+  800083:	e8 05 18 00 00       	call   80188d <fork>
+  800088:	89 c3                	mov    %eax,%ebx
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 be 00 00 00    	js     800150 <umain+0xfd>
+  800092:	0f 84 ca 00 00 00    	je     800162 <umain+0x10f>
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	e8 dd 37 00 00       	call   80387e <wait>
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	ff 35 04 50 80 00    	push   0x805004
+  8000aa:	68 00 00 00 a0       	push   $0xa0000000
+  8000af:	e8 db 09 00 00       	call   800a8f <strcmp>
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	b8 c6 41 80 00       	mov    $0x8041c6,%eax
+  8000be:	ba c0 41 80 00       	mov    $0x8041c0,%edx
+  8000c3:	0f 44 c2             	cmove  %edx,%eax
+  8000c6:	50                   	push   %eax
+  8000c7:	68 fc 41 80 00       	push   $0x8041fc
+  8000cc:	e8 17 02 00 00       	call   8002e8 <cprintf>
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 17 42 80 00       	push   $0x804217
+  8000d8:	68 1c 42 80 00       	push   $0x80421c
+  8000dd:	68 1b 42 80 00       	push   $0x80421b
+  8000e2:	e8 e5 2e 00 00       	call   802fcc <spawnl>
+  8000e7:	83 c4 20             	add    $0x20,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 88 90 00 00 00    	js     800182 <umain+0x12f>
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	50                   	push   %eax
+  8000f6:	e8 83 37 00 00       	call   80387e <wait>
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	ff 35 00 50 80 00    	push   0x805000
+  800104:	68 00 00 00 a0       	push   $0xa0000000
+  800109:	e8 81 09 00 00       	call   800a8f <strcmp>
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	b8 c6 41 80 00       	mov    $0x8041c6,%eax
+  800118:	ba c0 41 80 00       	mov    $0x8041c0,%edx
+  80011d:	0f 44 c2             	cmove  %edx,%eax
+  800120:	50                   	push   %eax
+  800121:	68 33 42 80 00       	push   $0x804233
+  800126:	e8 bd 01 00 00       	call   8002e8 <cprintf>
+  80012b:	cc                   	int3
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+  800134:	e8 fa fe ff ff       	call   800033 <childofspawn>
+  800139:	e9 26 ff ff ff       	jmp    800064 <umain+0x11>
+  80013e:	50                   	push   %eax
+  80013f:	68 cc 41 80 00       	push   $0x8041cc
+  800144:	6a 13                	push   $0x13
+  800146:	68 df 41 80 00       	push   $0x8041df
+  80014b:	e8 bd 00 00 00       	call   80020d <_panic>
+  800150:	50                   	push   %eax
+  800151:	68 f3 41 80 00       	push   $0x8041f3
+  800156:	6a 17                	push   $0x17
+  800158:	68 df 41 80 00       	push   $0x8041df
+  80015d:	e8 ab 00 00 00       	call   80020d <_panic>
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	ff 35 04 50 80 00    	push   0x805004
+  80016b:	68 00 00 00 a0       	push   $0xa0000000
+  800170:	e8 6a 08 00 00       	call   8009df <strcpy>
+  800175:	e8 63 00 00 00       	call   8001dd <exit>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	e9 16 ff ff ff       	jmp    800098 <umain+0x45>
+  800182:	50                   	push   %eax
+  800183:	68 29 42 80 00       	push   $0x804229
+  800188:	6a 21                	push   $0x21
+  80018a:	68 df 41 80 00       	push   $0x8041df
+  80018f:	e8 79 00 00 00       	call   80020d <_panic>
+
+00800194 <libmain>:
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	56                   	push   %esi
+  800198:	53                   	push   %ebx
+  800199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80019f:	e8 31 0c 00 00       	call   800dd5 <sys_getenvid>
+  8001a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a9:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8001af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001b4:	a3 14 60 80 00       	mov    %eax,0x806014
+  8001b9:	85 db                	test   %ebx,%ebx
+  8001bb:	7e 07                	jle    8001c4 <libmain+0x30>
+  8001bd:	8b 06                	mov    (%esi),%eax
+  8001bf:	a3 08 50 80 00       	mov    %eax,0x805008
+  8001c4:	83 ec 08             	sub    $0x8,%esp
+  8001c7:	56                   	push   %esi
+  8001c8:	53                   	push   %ebx
+  8001c9:	e8 85 fe ff ff       	call   800053 <umain>
+  8001ce:	e8 0a 00 00 00       	call   8001dd <exit>
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001d9:	5b                   	pop    %ebx
+  8001da:	5e                   	pop    %esi
+  8001db:	5d                   	pop    %ebp
+  8001dc:	c3                   	ret
+
+008001dd <exit>:
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 08             	sub    $0x8,%esp
+  8001e3:	a1 14 60 80 00       	mov    0x806014,%eax
+  8001e8:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8001ee:	85 c0                	test   %eax,%eax
+  8001f0:	75 14                	jne    800206 <exit+0x29>
+  8001f2:	e8 b1 1b 00 00       	call   801da8 <close_all>
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+  8001fa:	6a 00                	push   $0x0
+  8001fc:	e8 93 0b 00 00       	call   800d94 <sys_env_destroy>
+  800201:	83 c4 10             	add    $0x10,%esp
+  800204:	c9                   	leave
+  800205:	c3                   	ret
+  800206:	e8 f6 12 00 00       	call   801501 <sys_lease_complete>
+  80020b:	eb e5                	jmp    8001f2 <exit+0x15>
+
+0080020d <_panic>:
+  80020d:	55                   	push   %ebp
+  80020e:	89 e5                	mov    %esp,%ebp
+  800210:	56                   	push   %esi
+  800211:	53                   	push   %ebx
+  800212:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800215:	8b 35 08 50 80 00    	mov    0x805008,%esi
+  80021b:	e8 b5 0b 00 00       	call   800dd5 <sys_getenvid>
+  800220:	83 ec 0c             	sub    $0xc,%esp
+  800223:	ff 75 0c             	push   0xc(%ebp)
+  800226:	ff 75 08             	push   0x8(%ebp)
+  800229:	56                   	push   %esi
+  80022a:	50                   	push   %eax
+  80022b:	68 78 42 80 00       	push   $0x804278
+  800230:	e8 b3 00 00 00       	call   8002e8 <cprintf>
+  800235:	83 c4 18             	add    $0x18,%esp
+  800238:	53                   	push   %ebx
+  800239:	ff 75 10             	push   0x10(%ebp)
+  80023c:	e8 56 00 00 00       	call   800297 <vcprintf>
+  800241:	c7 04 24 77 48 80 00 	movl   $0x804877,(%esp)
+  800248:	e8 9b 00 00 00       	call   8002e8 <cprintf>
+  80024d:	83 c4 10             	add    $0x10,%esp
+  800250:	cc                   	int3
+  800251:	eb fd                	jmp    800250 <_panic+0x43>
+
+00800253 <putch>:
+  800253:	55                   	push   %ebp
+  800254:	89 e5                	mov    %esp,%ebp
+  800256:	53                   	push   %ebx
+  800257:	83 ec 04             	sub    $0x4,%esp
+  80025a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025d:	8b 13                	mov    (%ebx),%edx
+  80025f:	8d 42 01             	lea    0x1(%edx),%eax
+  800262:	89 03                	mov    %eax,(%ebx)
+  800264:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800267:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80026b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800270:	74 09                	je     80027b <putch+0x28>
+  800272:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800276:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800279:	c9                   	leave
+  80027a:	c3                   	ret
+  80027b:	83 ec 08             	sub    $0x8,%esp
+  80027e:	68 ff 00 00 00       	push   $0xff
+  800283:	8d 43 08             	lea    0x8(%ebx),%eax
+  800286:	50                   	push   %eax
+  800287:	e8 cb 0a 00 00       	call   800d57 <sys_cputs>
+  80028c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800292:	83 c4 10             	add    $0x10,%esp
+  800295:	eb db                	jmp    800272 <putch+0x1f>
+
+00800297 <vcprintf>:
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002a0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002a7:	00 00 00 
+  8002aa:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002b1:	00 00 00 
+  8002b4:	ff 75 0c             	push   0xc(%ebp)
+  8002b7:	ff 75 08             	push   0x8(%ebp)
+  8002ba:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002c0:	50                   	push   %eax
+  8002c1:	68 53 02 80 00       	push   $0x800253
+  8002c6:	e8 1c 01 00 00       	call   8003e7 <vprintfmt>
+  8002cb:	83 c4 08             	add    $0x8,%esp
+  8002ce:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002d4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002da:	50                   	push   %eax
+  8002db:	e8 77 0a 00 00       	call   800d57 <sys_cputs>
+  8002e0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002e6:	c9                   	leave
+  8002e7:	c3                   	ret
+
+008002e8 <cprintf>:
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	83 ec 10             	sub    $0x10,%esp
+  8002ee:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8002f1:	50                   	push   %eax
+  8002f2:	ff 75 08             	push   0x8(%ebp)
+  8002f5:	e8 9d ff ff ff       	call   800297 <vcprintf>
+  8002fa:	c9                   	leave
+  8002fb:	c3                   	ret
+
+008002fc <printnum>:
+  8002fc:	55                   	push   %ebp
+  8002fd:	89 e5                	mov    %esp,%ebp
+  8002ff:	57                   	push   %edi
+  800300:	56                   	push   %esi
+  800301:	53                   	push   %ebx
+  800302:	83 ec 1c             	sub    $0x1c,%esp
+  800305:	89 c3                	mov    %eax,%ebx
+  800307:	89 d6                	mov    %edx,%esi
+  800309:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80030f:	89 d1                	mov    %edx,%ecx
+  800311:	89 c2                	mov    %eax,%edx
+  800313:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800316:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800319:	8b 45 10             	mov    0x10(%ebp),%eax
+  80031c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80031f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800326:	39 c2                	cmp    %eax,%edx
+  800328:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80032b:	73 4b                	jae    800378 <printnum+0x7c>
+  80032d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800330:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800333:	85 ff                	test   %edi,%edi
+  800335:	7e 11                	jle    800348 <printnum+0x4c>
+  800337:	83 ec 08             	sub    $0x8,%esp
+  80033a:	56                   	push   %esi
+  80033b:	ff 75 18             	push   0x18(%ebp)
+  80033e:	ff d3                	call   *%ebx
+  800340:	83 c4 10             	add    $0x10,%esp
+  800343:	83 ef 01             	sub    $0x1,%edi
+  800346:	75 ef                	jne    800337 <printnum+0x3b>
+  800348:	83 ec 08             	sub    $0x8,%esp
+  80034b:	56                   	push   %esi
+  80034c:	83 ec 04             	sub    $0x4,%esp
+  80034f:	ff 75 e4             	push   -0x1c(%ebp)
+  800352:	ff 75 e0             	push   -0x20(%ebp)
+  800355:	ff 75 dc             	push   -0x24(%ebp)
+  800358:	ff 75 d8             	push   -0x28(%ebp)
+  80035b:	e8 5b 3d 00 00       	call   8040bb <__umoddi3>
+  800360:	83 c4 14             	add    $0x14,%esp
+  800363:	0f be 80 9b 42 80 00 	movsbl 0x80429b(%eax),%eax
+  80036a:	50                   	push   %eax
+  80036b:	ff d3                	call   *%ebx
+  80036d:	83 c4 10             	add    $0x10,%esp
+  800370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800373:	5b                   	pop    %ebx
+  800374:	5e                   	pop    %esi
+  800375:	5f                   	pop    %edi
+  800376:	5d                   	pop    %ebp
+  800377:	c3                   	ret
+  800378:	83 ec 0c             	sub    $0xc,%esp
+  80037b:	ff 75 18             	push   0x18(%ebp)
+  80037e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800381:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800384:	52                   	push   %edx
+  800385:	50                   	push   %eax
+  800386:	83 ec 08             	sub    $0x8,%esp
+  800389:	ff 75 e4             	push   -0x1c(%ebp)
+  80038c:	ff 75 e0             	push   -0x20(%ebp)
+  80038f:	ff 75 dc             	push   -0x24(%ebp)
+  800392:	ff 75 d8             	push   -0x28(%ebp)
+  800395:	e8 03 3d 00 00       	call   80409d <__udivdi3>
+  80039a:	83 c4 18             	add    $0x18,%esp
+  80039d:	52                   	push   %edx
+  80039e:	50                   	push   %eax
+  80039f:	89 f2                	mov    %esi,%edx
+  8003a1:	89 d8                	mov    %ebx,%eax
+  8003a3:	e8 54 ff ff ff       	call   8002fc <printnum>
+  8003a8:	83 c4 20             	add    $0x20,%esp
+  8003ab:	eb 9b                	jmp    800348 <printnum+0x4c>
+
+008003ad <sprintputch>:
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003b3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8003b7:	8b 10                	mov    (%eax),%edx
+  8003b9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003bc:	73 0a                	jae    8003c8 <sprintputch+0x1b>
+  8003be:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003c1:	89 08                	mov    %ecx,(%eax)
+  8003c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003c6:	88 02                	mov    %al,(%edx)
+  8003c8:	5d                   	pop    %ebp
+  8003c9:	c3                   	ret
+
+008003ca <printfmt>:
+  8003ca:	55                   	push   %ebp
+  8003cb:	89 e5                	mov    %esp,%ebp
+  8003cd:	83 ec 08             	sub    $0x8,%esp
+  8003d0:	8d 45 14             	lea    0x14(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	ff 75 10             	push   0x10(%ebp)
+  8003d7:	ff 75 0c             	push   0xc(%ebp)
+  8003da:	ff 75 08             	push   0x8(%ebp)
+  8003dd:	e8 05 00 00 00       	call   8003e7 <vprintfmt>
+  8003e2:	83 c4 10             	add    $0x10,%esp
+  8003e5:	c9                   	leave
+  8003e6:	c3                   	ret
+
+008003e7 <vprintfmt>:
+  8003e7:	55                   	push   %ebp
+  8003e8:	89 e5                	mov    %esp,%ebp
+  8003ea:	57                   	push   %edi
+  8003eb:	56                   	push   %esi
+  8003ec:	53                   	push   %ebx
+  8003ed:	83 ec 2c             	sub    $0x2c,%esp
+  8003f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003f3:	89 df                	mov    %ebx,%edi
+  8003f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003fb:	8d 70 01             	lea    0x1(%eax),%esi
+  8003fe:	0f b6 00             	movzbl (%eax),%eax
+  800401:	83 f8 25             	cmp    $0x25,%eax
+  800404:	74 1e                	je     800424 <vprintfmt+0x3d>
+  800406:	85 c0                	test   %eax,%eax
+  800408:	0f 84 15 05 00 00    	je     800923 <vprintfmt+0x53c>
+  80040e:	83 ec 08             	sub    $0x8,%esp
+  800411:	53                   	push   %ebx
+  800412:	50                   	push   %eax
+  800413:	ff d7                	call   *%edi
+  800415:	83 c6 01             	add    $0x1,%esi
+  800418:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80041c:	83 c4 10             	add    $0x10,%esp
+  80041f:	83 f8 25             	cmp    $0x25,%eax
+  800422:	75 e2                	jne    800406 <vprintfmt+0x1f>
+  800424:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800428:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80042f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800436:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80043d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800442:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800445:	8d 56 01             	lea    0x1(%esi),%edx
+  800448:	0f b6 0e             	movzbl (%esi),%ecx
+  80044b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80044e:	3c 55                	cmp    $0x55,%al
+  800450:	0f 87 3b 04 00 00    	ja     800891 <vprintfmt+0x4aa>
+  800456:	0f b6 c0             	movzbl %al,%eax
+  800459:	ff 24 85 e0 43 80 00 	jmp    *0x8043e0(,%eax,4)
+  800460:	89 75 10             	mov    %esi,0x10(%ebp)
+  800463:	eb 93                	jmp    8003f8 <vprintfmt+0x11>
+  800465:	89 d6                	mov    %edx,%esi
+  800467:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80046b:	eb d8                	jmp    800445 <vprintfmt+0x5e>
+  80046d:	89 d6                	mov    %edx,%esi
+  80046f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800473:	eb d0                	jmp    800445 <vprintfmt+0x5e>
+  800475:	0f b6 c9             	movzbl %cl,%ecx
+  800478:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80047b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80047e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800482:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800485:	83 f9 09             	cmp    $0x9,%ecx
+  800488:	77 6f                	ja     8004f9 <vprintfmt+0x112>
+  80048a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80048d:	83 c2 01             	add    $0x1,%edx
+  800490:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800493:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800497:	0f be 02             	movsbl (%edx),%eax
+  80049a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80049d:	83 fe 09             	cmp    $0x9,%esi
+  8004a0:	76 eb                	jbe    80048d <vprintfmt+0xa6>
+  8004a2:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8004a5:	89 d6                	mov    %edx,%esi
+  8004a7:	eb 13                	jmp    8004bc <vprintfmt+0xd5>
+  8004a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ac:	8b 00                	mov    (%eax),%eax
+  8004ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ba:	89 d6                	mov    %edx,%esi
+  8004bc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004c0:	79 83                	jns    800445 <vprintfmt+0x5e>
+  8004c2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004cf:	e9 71 ff ff ff       	jmp    800445 <vprintfmt+0x5e>
+  8004d4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004d7:	85 c9                	test   %ecx,%ecx
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	0f 49 c1             	cmovns %ecx,%eax
+  8004e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e4:	89 d6                	mov    %edx,%esi
+  8004e6:	e9 5a ff ff ff       	jmp    800445 <vprintfmt+0x5e>
+  8004eb:	89 d6                	mov    %edx,%esi
+  8004ed:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8004f4:	e9 4c ff ff ff       	jmp    800445 <vprintfmt+0x5e>
+  8004f9:	89 d6                	mov    %edx,%esi
+  8004fb:	eb bf                	jmp    8004bc <vprintfmt+0xd5>
+  8004fd:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800501:	89 d6                	mov    %edx,%esi
+  800503:	e9 3d ff ff ff       	jmp    800445 <vprintfmt+0x5e>
+  800508:	89 55 10             	mov    %edx,0x10(%ebp)
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8d 70 04             	lea    0x4(%eax),%esi
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	53                   	push   %ebx
+  800515:	ff 30                	push   (%eax)
+  800517:	ff d7                	call   *%edi
+  800519:	83 c4 10             	add    $0x10,%esp
+  80051c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80051f:	e9 d4 fe ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  800524:	89 55 10             	mov    %edx,0x10(%ebp)
+  800527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052a:	8d 70 04             	lea    0x4(%eax),%esi
+  80052d:	8b 10                	mov    (%eax),%edx
+  80052f:	89 d0                	mov    %edx,%eax
+  800531:	f7 d8                	neg    %eax
+  800533:	0f 48 c2             	cmovs  %edx,%eax
+  800536:	83 f8 12             	cmp    $0x12,%eax
+  800539:	7f 23                	jg     80055e <vprintfmt+0x177>
+  80053b:	8b 14 85 40 45 80 00 	mov    0x804540(,%eax,4),%edx
+  800542:	85 d2                	test   %edx,%edx
+  800544:	74 18                	je     80055e <vprintfmt+0x177>
+  800546:	52                   	push   %edx
+  800547:	68 a5 47 80 00       	push   $0x8047a5
+  80054c:	53                   	push   %ebx
+  80054d:	57                   	push   %edi
+  80054e:	e8 77 fe ff ff       	call   8003ca <printfmt>
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	89 75 14             	mov    %esi,0x14(%ebp)
+  800559:	e9 9a fe ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  80055e:	50                   	push   %eax
+  80055f:	68 b3 42 80 00       	push   $0x8042b3
+  800564:	53                   	push   %ebx
+  800565:	57                   	push   %edi
+  800566:	e8 5f fe ff ff       	call   8003ca <printfmt>
+  80056b:	83 c4 10             	add    $0x10,%esp
+  80056e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800571:	e9 82 fe ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  800576:	89 55 10             	mov    %edx,0x10(%ebp)
+  800579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057c:	83 c0 04             	add    $0x4,%eax
+  80057f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800582:	8b 45 14             	mov    0x14(%ebp),%eax
+  800585:	8b 00                	mov    (%eax),%eax
+  800587:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80058a:	85 c0                	test   %eax,%eax
+  80058c:	0f 84 61 03 00 00    	je     8008f3 <vprintfmt+0x50c>
+  800592:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800596:	7e 06                	jle    80059e <vprintfmt+0x1b7>
+  800598:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80059c:	75 29                	jne    8005c7 <vprintfmt+0x1e0>
+  80059e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005a1:	8d 70 01             	lea    0x1(%eax),%esi
+  8005a4:	0f b6 00             	movzbl (%eax),%eax
+  8005a7:	0f be d0             	movsbl %al,%edx
+  8005aa:	85 d2                	test   %edx,%edx
+  8005ac:	0f 84 bb 00 00 00    	je     80066d <vprintfmt+0x286>
+  8005b2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005b5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005b8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005bb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005be:	eb 7a                	jmp    80063a <vprintfmt+0x253>
+  8005c0:	c7 45 d0 ac 42 80 00 	movl   $0x8042ac,-0x30(%ebp)
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	ff 75 d4             	push   -0x2c(%ebp)
+  8005cd:	ff 75 d0             	push   -0x30(%ebp)
+  8005d0:	e8 e0 03 00 00       	call   8009b5 <strnlen>
+  8005d5:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005d8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005db:	83 c4 10             	add    $0x10,%esp
+  8005de:	85 d2                	test   %edx,%edx
+  8005e0:	0f 8e d6 02 00 00    	jle    8008bc <vprintfmt+0x4d5>
+  8005e6:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8005ea:	83 ec 08             	sub    $0x8,%esp
+  8005ed:	53                   	push   %ebx
+  8005ee:	56                   	push   %esi
+  8005ef:	ff d7                	call   *%edi
+  8005f1:	83 c4 10             	add    $0x10,%esp
+  8005f4:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8005f8:	75 f0                	jne    8005ea <vprintfmt+0x203>
+  8005fa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005fd:	8d 70 01             	lea    0x1(%eax),%esi
+  800600:	0f b6 00             	movzbl (%eax),%eax
+  800603:	0f be d0             	movsbl %al,%edx
+  800606:	85 d2                	test   %edx,%edx
+  800608:	0f 84 da 02 00 00    	je     8008e8 <vprintfmt+0x501>
+  80060e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800611:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800614:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800617:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80061a:	eb 1e                	jmp    80063a <vprintfmt+0x253>
+  80061c:	83 ec 08             	sub    $0x8,%esp
+  80061f:	ff 75 0c             	push   0xc(%ebp)
+  800622:	52                   	push   %edx
+  800623:	ff 55 08             	call   *0x8(%ebp)
+  800626:	83 c4 10             	add    $0x10,%esp
+  800629:	83 eb 01             	sub    $0x1,%ebx
+  80062c:	83 c6 01             	add    $0x1,%esi
+  80062f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800633:	0f be d0             	movsbl %al,%edx
+  800636:	85 d2                	test   %edx,%edx
+  800638:	74 2a                	je     800664 <vprintfmt+0x27d>
+  80063a:	85 ff                	test   %edi,%edi
+  80063c:	78 05                	js     800643 <vprintfmt+0x25c>
+  80063e:	83 ef 01             	sub    $0x1,%edi
+  800641:	78 59                	js     80069c <vprintfmt+0x2b5>
+  800643:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800647:	74 d3                	je     80061c <vprintfmt+0x235>
+  800649:	0f be c0             	movsbl %al,%eax
+  80064c:	83 e8 20             	sub    $0x20,%eax
+  80064f:	83 f8 5e             	cmp    $0x5e,%eax
+  800652:	76 c8                	jbe    80061c <vprintfmt+0x235>
+  800654:	83 ec 08             	sub    $0x8,%esp
+  800657:	ff 75 0c             	push   0xc(%ebp)
+  80065a:	6a 3f                	push   $0x3f
+  80065c:	ff 55 08             	call   *0x8(%ebp)
+  80065f:	83 c4 10             	add    $0x10,%esp
+  800662:	eb c5                	jmp    800629 <vprintfmt+0x242>
+  800664:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800667:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80066a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80066d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800670:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800674:	7e 1b                	jle    800691 <vprintfmt+0x2aa>
+  800676:	83 ec 08             	sub    $0x8,%esp
+  800679:	53                   	push   %ebx
+  80067a:	6a 20                	push   $0x20
+  80067c:	ff d7                	call   *%edi
+  80067e:	83 c4 10             	add    $0x10,%esp
+  800681:	83 ee 01             	sub    $0x1,%esi
+  800684:	75 f0                	jne    800676 <vprintfmt+0x28f>
+  800686:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068c:	e9 67 fd ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  800691:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800694:	89 45 14             	mov    %eax,0x14(%ebp)
+  800697:	e9 5c fd ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  80069c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80069f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006a5:	eb c6                	jmp    80066d <vprintfmt+0x286>
+  8006a7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006aa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ad:	83 f9 01             	cmp    $0x1,%ecx
+  8006b0:	7f 1f                	jg     8006d1 <vprintfmt+0x2ea>
+  8006b2:	85 c9                	test   %ecx,%ecx
+  8006b4:	74 67                	je     80071d <vprintfmt+0x336>
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8b 30                	mov    (%eax),%esi
+  8006bb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006be:	89 f0                	mov    %esi,%eax
+  8006c0:	c1 f8 1f             	sar    $0x1f,%eax
+  8006c3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cf:	eb 17                	jmp    8006e8 <vprintfmt+0x301>
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 50 04             	mov    0x4(%eax),%edx
+  8006d7:	8b 00                	mov    (%eax),%eax
+  8006d9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006dc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006eb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006ee:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006f3:	85 c9                	test   %ecx,%ecx
+  8006f5:	0f 89 12 01 00 00    	jns    80080d <vprintfmt+0x426>
+  8006fb:	83 ec 08             	sub    $0x8,%esp
+  8006fe:	53                   	push   %ebx
+  8006ff:	6a 2d                	push   $0x2d
+  800701:	ff d7                	call   *%edi
+  800703:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800706:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800709:	f7 da                	neg    %edx
+  80070b:	83 d1 00             	adc    $0x0,%ecx
+  80070e:	f7 d9                	neg    %ecx
+  800710:	83 c4 10             	add    $0x10,%esp
+  800713:	be 0a 00 00 00       	mov    $0xa,%esi
+  800718:	e9 f0 00 00 00       	jmp    80080d <vprintfmt+0x426>
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 30                	mov    (%eax),%esi
+  800722:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800725:	89 f0                	mov    %esi,%eax
+  800727:	c1 f8 1f             	sar    $0x1f,%eax
+  80072a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8d 40 04             	lea    0x4(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+  800736:	eb b0                	jmp    8006e8 <vprintfmt+0x301>
+  800738:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80073b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80073e:	83 f9 01             	cmp    $0x1,%ecx
+  800741:	7f 1e                	jg     800761 <vprintfmt+0x37a>
+  800743:	85 c9                	test   %ecx,%ecx
+  800745:	74 32                	je     800779 <vprintfmt+0x392>
+  800747:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074a:	8b 10                	mov    (%eax),%edx
+  80074c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800751:	8d 40 04             	lea    0x4(%eax),%eax
+  800754:	89 45 14             	mov    %eax,0x14(%ebp)
+  800757:	be 0a 00 00 00       	mov    $0xa,%esi
+  80075c:	e9 ac 00 00 00       	jmp    80080d <vprintfmt+0x426>
+  800761:	8b 45 14             	mov    0x14(%ebp),%eax
+  800764:	8b 10                	mov    (%eax),%edx
+  800766:	8b 48 04             	mov    0x4(%eax),%ecx
+  800769:	8d 40 08             	lea    0x8(%eax),%eax
+  80076c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800774:	e9 94 00 00 00       	jmp    80080d <vprintfmt+0x426>
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800783:	8d 40 04             	lea    0x4(%eax),%eax
+  800786:	89 45 14             	mov    %eax,0x14(%ebp)
+  800789:	be 0a 00 00 00       	mov    $0xa,%esi
+  80078e:	eb 7d                	jmp    80080d <vprintfmt+0x426>
+  800790:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800793:	89 55 10             	mov    %edx,0x10(%ebp)
+  800796:	83 f9 01             	cmp    $0x1,%ecx
+  800799:	7f 1b                	jg     8007b6 <vprintfmt+0x3cf>
+  80079b:	85 c9                	test   %ecx,%ecx
+  80079d:	74 2c                	je     8007cb <vprintfmt+0x3e4>
+  80079f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a2:	8b 10                	mov    (%eax),%edx
+  8007a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007af:	be 08 00 00 00       	mov    $0x8,%esi
+  8007b4:	eb 57                	jmp    80080d <vprintfmt+0x426>
+  8007b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b9:	8b 10                	mov    (%eax),%edx
+  8007bb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007be:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c4:	be 08 00 00 00       	mov    $0x8,%esi
+  8007c9:	eb 42                	jmp    80080d <vprintfmt+0x426>
+  8007cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ce:	8b 10                	mov    (%eax),%edx
+  8007d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007db:	be 08 00 00 00       	mov    $0x8,%esi
+  8007e0:	eb 2b                	jmp    80080d <vprintfmt+0x426>
+  8007e2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e5:	83 ec 08             	sub    $0x8,%esp
+  8007e8:	53                   	push   %ebx
+  8007e9:	6a 30                	push   $0x30
+  8007eb:	ff d7                	call   *%edi
+  8007ed:	83 c4 08             	add    $0x8,%esp
+  8007f0:	53                   	push   %ebx
+  8007f1:	6a 78                	push   $0x78
+  8007f3:	ff d7                	call   *%edi
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8b 10                	mov    (%eax),%edx
+  8007fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ff:	83 c4 10             	add    $0x10,%esp
+  800802:	8d 40 04             	lea    0x4(%eax),%eax
+  800805:	89 45 14             	mov    %eax,0x14(%ebp)
+  800808:	be 10 00 00 00       	mov    $0x10,%esi
+  80080d:	83 ec 0c             	sub    $0xc,%esp
+  800810:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800814:	50                   	push   %eax
+  800815:	ff 75 e4             	push   -0x1c(%ebp)
+  800818:	56                   	push   %esi
+  800819:	51                   	push   %ecx
+  80081a:	52                   	push   %edx
+  80081b:	89 da                	mov    %ebx,%edx
+  80081d:	89 f8                	mov    %edi,%eax
+  80081f:	e8 d8 fa ff ff       	call   8002fc <printnum>
+  800824:	83 c4 20             	add    $0x20,%esp
+  800827:	e9 cc fb ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  80082c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80082f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800832:	83 f9 01             	cmp    $0x1,%ecx
+  800835:	7f 1b                	jg     800852 <vprintfmt+0x46b>
+  800837:	85 c9                	test   %ecx,%ecx
+  800839:	74 2c                	je     800867 <vprintfmt+0x480>
+  80083b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083e:	8b 10                	mov    (%eax),%edx
+  800840:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800845:	8d 40 04             	lea    0x4(%eax),%eax
+  800848:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084b:	be 10 00 00 00       	mov    $0x10,%esi
+  800850:	eb bb                	jmp    80080d <vprintfmt+0x426>
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	8b 10                	mov    (%eax),%edx
+  800857:	8b 48 04             	mov    0x4(%eax),%ecx
+  80085a:	8d 40 08             	lea    0x8(%eax),%eax
+  80085d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800860:	be 10 00 00 00       	mov    $0x10,%esi
+  800865:	eb a6                	jmp    80080d <vprintfmt+0x426>
+  800867:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086a:	8b 10                	mov    (%eax),%edx
+  80086c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800871:	8d 40 04             	lea    0x4(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+  800877:	be 10 00 00 00       	mov    $0x10,%esi
+  80087c:	eb 8f                	jmp    80080d <vprintfmt+0x426>
+  80087e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800881:	83 ec 08             	sub    $0x8,%esp
+  800884:	53                   	push   %ebx
+  800885:	6a 25                	push   $0x25
+  800887:	ff d7                	call   *%edi
+  800889:	83 c4 10             	add    $0x10,%esp
+  80088c:	e9 67 fb ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  800891:	83 ec 08             	sub    $0x8,%esp
+  800894:	53                   	push   %ebx
+  800895:	6a 25                	push   $0x25
+  800897:	ff d7                	call   *%edi
+  800899:	83 c4 10             	add    $0x10,%esp
+  80089c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008a0:	0f 84 ba fb ff ff    	je     800460 <vprintfmt+0x79>
+  8008a6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008a9:	89 f0                	mov    %esi,%eax
+  8008ab:	83 e8 01             	sub    $0x1,%eax
+  8008ae:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008b2:	75 f7                	jne    8008ab <vprintfmt+0x4c4>
+  8008b4:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008b7:	e9 3c fb ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  8008bc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008bf:	8d 70 01             	lea    0x1(%eax),%esi
+  8008c2:	0f b6 00             	movzbl (%eax),%eax
+  8008c5:	0f be d0             	movsbl %al,%edx
+  8008c8:	85 d2                	test   %edx,%edx
+  8008ca:	74 11                	je     8008dd <vprintfmt+0x4f6>
+  8008cc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008cf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008d2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008d5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008d8:	e9 5d fd ff ff       	jmp    80063a <vprintfmt+0x253>
+  8008dd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e3:	e9 10 fb ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  8008e8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ee:	e9 05 fb ff ff       	jmp    8003f8 <vprintfmt+0x11>
+  8008f3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008f7:	7e 0a                	jle    800903 <vprintfmt+0x51c>
+  8008f9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008fd:	0f 85 bd fc ff ff    	jne    8005c0 <vprintfmt+0x1d9>
+  800903:	ba 28 00 00 00       	mov    $0x28,%edx
+  800908:	b8 28 00 00 00       	mov    $0x28,%eax
+  80090d:	be ad 42 80 00       	mov    $0x8042ad,%esi
+  800912:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800915:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800918:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80091b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80091e:	e9 17 fd ff ff       	jmp    80063a <vprintfmt+0x253>
+  800923:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800926:	5b                   	pop    %ebx
+  800927:	5e                   	pop    %esi
+  800928:	5f                   	pop    %edi
+  800929:	5d                   	pop    %ebp
+  80092a:	c3                   	ret
+
+0080092b <vsnprintf>:
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	83 ec 18             	sub    $0x18,%esp
+  800931:	8b 45 08             	mov    0x8(%ebp),%eax
+  800934:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800937:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80093a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80093e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800941:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800948:	85 c0                	test   %eax,%eax
+  80094a:	74 26                	je     800972 <vsnprintf+0x47>
+  80094c:	85 d2                	test   %edx,%edx
+  80094e:	7e 22                	jle    800972 <vsnprintf+0x47>
+  800950:	ff 75 14             	push   0x14(%ebp)
+  800953:	ff 75 10             	push   0x10(%ebp)
+  800956:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800959:	50                   	push   %eax
+  80095a:	68 ad 03 80 00       	push   $0x8003ad
+  80095f:	e8 83 fa ff ff       	call   8003e7 <vprintfmt>
+  800964:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800967:	c6 00 00             	movb   $0x0,(%eax)
+  80096a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80096d:	83 c4 10             	add    $0x10,%esp
+  800970:	c9                   	leave
+  800971:	c3                   	ret
+  800972:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800977:	eb f7                	jmp    800970 <vsnprintf+0x45>
+
+00800979 <snprintf>:
+  800979:	55                   	push   %ebp
+  80097a:	89 e5                	mov    %esp,%ebp
+  80097c:	83 ec 08             	sub    $0x8,%esp
+  80097f:	8d 45 14             	lea    0x14(%ebp),%eax
+  800982:	50                   	push   %eax
+  800983:	ff 75 10             	push   0x10(%ebp)
+  800986:	ff 75 0c             	push   0xc(%ebp)
+  800989:	ff 75 08             	push   0x8(%ebp)
+  80098c:	e8 9a ff ff ff       	call   80092b <vsnprintf>
+  800991:	c9                   	leave
+  800992:	c3                   	ret
+
+00800993 <strlen>:
+  800993:	55                   	push   %ebp
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	8b 55 08             	mov    0x8(%ebp),%edx
+  800999:	80 3a 00             	cmpb   $0x0,(%edx)
+  80099c:	74 10                	je     8009ae <strlen+0x1b>
+  80099e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a3:	83 c0 01             	add    $0x1,%eax
+  8009a6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009aa:	75 f7                	jne    8009a3 <strlen+0x10>
+  8009ac:	5d                   	pop    %ebp
+  8009ad:	c3                   	ret
+  8009ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b3:	eb f7                	jmp    8009ac <strlen+0x19>
+
+008009b5 <strnlen>:
+  8009b5:	55                   	push   %ebp
+  8009b6:	89 e5                	mov    %esp,%ebp
+  8009b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009be:	85 d2                	test   %edx,%edx
+  8009c0:	74 16                	je     8009d8 <strnlen+0x23>
+  8009c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009cb:	74 09                	je     8009d6 <strnlen+0x21>
+  8009cd:	83 c0 01             	add    $0x1,%eax
+  8009d0:	39 d0                	cmp    %edx,%eax
+  8009d2:	75 f3                	jne    8009c7 <strnlen+0x12>
+  8009d4:	89 d0                	mov    %edx,%eax
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+  8009d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009dd:	eb f7                	jmp    8009d6 <strnlen+0x21>
+
+008009df <strcpy>:
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	53                   	push   %ebx
+  8009e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ee:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009f2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009f5:	83 c0 01             	add    $0x1,%eax
+  8009f8:	84 d2                	test   %dl,%dl
+  8009fa:	75 f2                	jne    8009ee <strcpy+0xf>
+  8009fc:	89 c8                	mov    %ecx,%eax
+  8009fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a01:	c9                   	leave
+  800a02:	c3                   	ret
+
+00800a03 <strcat>:
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	53                   	push   %ebx
+  800a07:	83 ec 10             	sub    $0x10,%esp
+  800a0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a0d:	53                   	push   %ebx
+  800a0e:	e8 80 ff ff ff       	call   800993 <strlen>
+  800a13:	83 c4 08             	add    $0x8,%esp
+  800a16:	ff 75 0c             	push   0xc(%ebp)
+  800a19:	01 d8                	add    %ebx,%eax
+  800a1b:	50                   	push   %eax
+  800a1c:	e8 be ff ff ff       	call   8009df <strcpy>
+  800a21:	89 d8                	mov    %ebx,%eax
+  800a23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a26:	c9                   	leave
+  800a27:	c3                   	ret
+
+00800a28 <strncpy>:
+  800a28:	55                   	push   %ebp
+  800a29:	89 e5                	mov    %esp,%ebp
+  800a2b:	56                   	push   %esi
+  800a2c:	53                   	push   %ebx
+  800a2d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a36:	85 db                	test   %ebx,%ebx
+  800a38:	74 17                	je     800a51 <strncpy+0x29>
+  800a3a:	01 f3                	add    %esi,%ebx
+  800a3c:	89 f0                	mov    %esi,%eax
+  800a3e:	83 c0 01             	add    $0x1,%eax
+  800a41:	0f b6 0a             	movzbl (%edx),%ecx
+  800a44:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a47:	80 f9 01             	cmp    $0x1,%cl
+  800a4a:	83 da ff             	sbb    $0xffffffff,%edx
+  800a4d:	39 c3                	cmp    %eax,%ebx
+  800a4f:	75 ed                	jne    800a3e <strncpy+0x16>
+  800a51:	89 f0                	mov    %esi,%eax
+  800a53:	5b                   	pop    %ebx
+  800a54:	5e                   	pop    %esi
+  800a55:	5d                   	pop    %ebp
+  800a56:	c3                   	ret
+
+00800a57 <strlcpy>:
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	56                   	push   %esi
+  800a5b:	53                   	push   %ebx
+  800a5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a65:	89 f0                	mov    %esi,%eax
+  800a67:	85 db                	test   %ebx,%ebx
+  800a69:	74 1e                	je     800a89 <strlcpy+0x32>
+  800a6b:	83 eb 01             	sub    $0x1,%ebx
+  800a6e:	74 16                	je     800a86 <strlcpy+0x2f>
+  800a70:	01 f3                	add    %esi,%ebx
+  800a72:	0f b6 0a             	movzbl (%edx),%ecx
+  800a75:	84 c9                	test   %cl,%cl
+  800a77:	74 0d                	je     800a86 <strlcpy+0x2f>
+  800a79:	83 c2 01             	add    $0x1,%edx
+  800a7c:	83 c0 01             	add    $0x1,%eax
+  800a7f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a82:	39 d8                	cmp    %ebx,%eax
+  800a84:	75 ec                	jne    800a72 <strlcpy+0x1b>
+  800a86:	c6 00 00             	movb   $0x0,(%eax)
+  800a89:	29 f0                	sub    %esi,%eax
+  800a8b:	5b                   	pop    %ebx
+  800a8c:	5e                   	pop    %esi
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <strcmp>:
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a98:	0f b6 01             	movzbl (%ecx),%eax
+  800a9b:	84 c0                	test   %al,%al
+  800a9d:	74 11                	je     800ab0 <strcmp+0x21>
+  800a9f:	38 02                	cmp    %al,(%edx)
+  800aa1:	75 0d                	jne    800ab0 <strcmp+0x21>
+  800aa3:	83 c1 01             	add    $0x1,%ecx
+  800aa6:	83 c2 01             	add    $0x1,%edx
+  800aa9:	0f b6 01             	movzbl (%ecx),%eax
+  800aac:	84 c0                	test   %al,%al
+  800aae:	75 ef                	jne    800a9f <strcmp+0x10>
+  800ab0:	0f b6 c0             	movzbl %al,%eax
+  800ab3:	0f b6 12             	movzbl (%edx),%edx
+  800ab6:	29 d0                	sub    %edx,%eax
+  800ab8:	5d                   	pop    %ebp
+  800ab9:	c3                   	ret
+
+00800aba <strncmp>:
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	53                   	push   %ebx
+  800abe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ac4:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acc:	85 d2                	test   %edx,%edx
+  800ace:	74 2e                	je     800afe <strncmp+0x44>
+  800ad0:	0f b6 01             	movzbl (%ecx),%eax
+  800ad3:	84 c0                	test   %al,%al
+  800ad5:	74 16                	je     800aed <strncmp+0x33>
+  800ad7:	3a 03                	cmp    (%ebx),%al
+  800ad9:	75 12                	jne    800aed <strncmp+0x33>
+  800adb:	83 c1 01             	add    $0x1,%ecx
+  800ade:	83 c3 01             	add    $0x1,%ebx
+  800ae1:	83 ea 01             	sub    $0x1,%edx
+  800ae4:	75 ea                	jne    800ad0 <strncmp+0x16>
+  800ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aeb:	eb 11                	jmp    800afe <strncmp+0x44>
+  800aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af2:	85 d2                	test   %edx,%edx
+  800af4:	74 08                	je     800afe <strncmp+0x44>
+  800af6:	0f b6 01             	movzbl (%ecx),%eax
+  800af9:	0f b6 13             	movzbl (%ebx),%edx
+  800afc:	29 d0                	sub    %edx,%eax
+  800afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b01:	c9                   	leave
+  800b02:	c3                   	ret
+
+00800b03 <strchr>:
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b09:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b0d:	0f b6 10             	movzbl (%eax),%edx
+  800b10:	84 d2                	test   %dl,%dl
+  800b12:	74 15                	je     800b29 <strchr+0x26>
+  800b14:	38 d1                	cmp    %dl,%cl
+  800b16:	74 0f                	je     800b27 <strchr+0x24>
+  800b18:	83 c0 01             	add    $0x1,%eax
+  800b1b:	0f b6 10             	movzbl (%eax),%edx
+  800b1e:	84 d2                	test   %dl,%dl
+  800b20:	75 f2                	jne    800b14 <strchr+0x11>
+  800b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b27:	5d                   	pop    %ebp
+  800b28:	c3                   	ret
+  800b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2e:	eb f7                	jmp    800b27 <strchr+0x24>
+
+00800b30 <strfind>:
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	53                   	push   %ebx
+  800b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b37:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b3a:	0f b6 18             	movzbl (%eax),%ebx
+  800b3d:	38 d3                	cmp    %dl,%bl
+  800b3f:	74 14                	je     800b55 <strfind+0x25>
+  800b41:	89 d1                	mov    %edx,%ecx
+  800b43:	84 db                	test   %bl,%bl
+  800b45:	74 0e                	je     800b55 <strfind+0x25>
+  800b47:	83 c0 01             	add    $0x1,%eax
+  800b4a:	0f b6 10             	movzbl (%eax),%edx
+  800b4d:	38 ca                	cmp    %cl,%dl
+  800b4f:	74 04                	je     800b55 <strfind+0x25>
+  800b51:	84 d2                	test   %dl,%dl
+  800b53:	75 f2                	jne    800b47 <strfind+0x17>
+  800b55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b58:	c9                   	leave
+  800b59:	c3                   	ret
+
+00800b5a <memset>:
+  800b5a:	55                   	push   %ebp
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	57                   	push   %edi
+  800b5e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b61:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b64:	85 c9                	test   %ecx,%ecx
+  800b66:	74 20                	je     800b88 <memset+0x2e>
+  800b68:	89 f8                	mov    %edi,%eax
+  800b6a:	09 c8                	or     %ecx,%eax
+  800b6c:	a8 03                	test   $0x3,%al
+  800b6e:	75 12                	jne    800b82 <memset+0x28>
+  800b70:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b74:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800b7a:	c1 e9 02             	shr    $0x2,%ecx
+  800b7d:	fc                   	cld
+  800b7e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b80:	eb 06                	jmp    800b88 <memset+0x2e>
+  800b82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b85:	fc                   	cld
+  800b86:	f3 aa                	rep stos %al,%es:(%edi)
+  800b88:	89 f8                	mov    %edi,%eax
+  800b8a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b8d:	c9                   	leave
+  800b8e:	c3                   	ret
+
+00800b8f <memmove>:
+  800b8f:	55                   	push   %ebp
+  800b90:	89 e5                	mov    %esp,%ebp
+  800b92:	57                   	push   %edi
+  800b93:	56                   	push   %esi
+  800b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b97:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b9a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800b9d:	39 c6                	cmp    %eax,%esi
+  800b9f:	73 32                	jae    800bd3 <memmove+0x44>
+  800ba1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ba4:	39 d0                	cmp    %edx,%eax
+  800ba6:	73 2b                	jae    800bd3 <memmove+0x44>
+  800ba8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800bab:	89 d6                	mov    %edx,%esi
+  800bad:	09 fe                	or     %edi,%esi
+  800baf:	09 ce                	or     %ecx,%esi
+  800bb1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bb7:	75 0e                	jne    800bc7 <memmove+0x38>
+  800bb9:	83 ef 04             	sub    $0x4,%edi
+  800bbc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bbf:	c1 e9 02             	shr    $0x2,%ecx
+  800bc2:	fd                   	std
+  800bc3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bc5:	eb 09                	jmp    800bd0 <memmove+0x41>
+  800bc7:	83 ef 01             	sub    $0x1,%edi
+  800bca:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800bcd:	fd                   	std
+  800bce:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800bd0:	fc                   	cld
+  800bd1:	eb 1a                	jmp    800bed <memmove+0x5e>
+  800bd3:	89 f2                	mov    %esi,%edx
+  800bd5:	09 c2                	or     %eax,%edx
+  800bd7:	09 ca                	or     %ecx,%edx
+  800bd9:	f6 c2 03             	test   $0x3,%dl
+  800bdc:	75 0a                	jne    800be8 <memmove+0x59>
+  800bde:	c1 e9 02             	shr    $0x2,%ecx
+  800be1:	89 c7                	mov    %eax,%edi
+  800be3:	fc                   	cld
+  800be4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800be6:	eb 05                	jmp    800bed <memmove+0x5e>
+  800be8:	89 c7                	mov    %eax,%edi
+  800bea:	fc                   	cld
+  800beb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800bed:	5e                   	pop    %esi
+  800bee:	5f                   	pop    %edi
+  800bef:	5d                   	pop    %ebp
+  800bf0:	c3                   	ret
+
+00800bf1 <memcpy>:
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	83 ec 0c             	sub    $0xc,%esp
+  800bf7:	ff 75 10             	push   0x10(%ebp)
+  800bfa:	ff 75 0c             	push   0xc(%ebp)
+  800bfd:	ff 75 08             	push   0x8(%ebp)
+  800c00:	e8 8a ff ff ff       	call   800b8f <memmove>
+  800c05:	c9                   	leave
+  800c06:	c3                   	ret
+
+00800c07 <memcmp>:
+  800c07:	55                   	push   %ebp
+  800c08:	89 e5                	mov    %esp,%ebp
+  800c0a:	56                   	push   %esi
+  800c0b:	53                   	push   %ebx
+  800c0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c12:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c15:	85 f6                	test   %esi,%esi
+  800c17:	74 29                	je     800c42 <memcmp+0x3b>
+  800c19:	01 c6                	add    %eax,%esi
+  800c1b:	0f b6 08             	movzbl (%eax),%ecx
+  800c1e:	0f b6 1a             	movzbl (%edx),%ebx
+  800c21:	38 d9                	cmp    %bl,%cl
+  800c23:	75 11                	jne    800c36 <memcmp+0x2f>
+  800c25:	83 c0 01             	add    $0x1,%eax
+  800c28:	83 c2 01             	add    $0x1,%edx
+  800c2b:	39 c6                	cmp    %eax,%esi
+  800c2d:	75 ec                	jne    800c1b <memcmp+0x14>
+  800c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c34:	eb 08                	jmp    800c3e <memcmp+0x37>
+  800c36:	0f b6 c1             	movzbl %cl,%eax
+  800c39:	0f b6 db             	movzbl %bl,%ebx
+  800c3c:	29 d8                	sub    %ebx,%eax
+  800c3e:	5b                   	pop    %ebx
+  800c3f:	5e                   	pop    %esi
+  800c40:	5d                   	pop    %ebp
+  800c41:	c3                   	ret
+  800c42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c47:	eb f5                	jmp    800c3e <memcmp+0x37>
+
+00800c49 <memfind>:
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c52:	89 c2                	mov    %eax,%edx
+  800c54:	03 55 10             	add    0x10(%ebp),%edx
+  800c57:	39 d0                	cmp    %edx,%eax
+  800c59:	73 0d                	jae    800c68 <memfind+0x1f>
+  800c5b:	38 08                	cmp    %cl,(%eax)
+  800c5d:	74 0d                	je     800c6c <memfind+0x23>
+  800c5f:	83 c0 01             	add    $0x1,%eax
+  800c62:	39 c2                	cmp    %eax,%edx
+  800c64:	75 f5                	jne    800c5b <memfind+0x12>
+  800c66:	eb 06                	jmp    800c6e <memfind+0x25>
+  800c68:	89 c2                	mov    %eax,%edx
+  800c6a:	eb 02                	jmp    800c6e <memfind+0x25>
+  800c6c:	89 c2                	mov    %eax,%edx
+  800c6e:	89 d0                	mov    %edx,%eax
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+
+00800c72 <strtol>:
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	57                   	push   %edi
+  800c76:	56                   	push   %esi
+  800c77:	53                   	push   %ebx
+  800c78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7e:	0f b6 02             	movzbl (%edx),%eax
+  800c81:	3c 20                	cmp    $0x20,%al
+  800c83:	74 04                	je     800c89 <strtol+0x17>
+  800c85:	3c 09                	cmp    $0x9,%al
+  800c87:	75 0e                	jne    800c97 <strtol+0x25>
+  800c89:	83 c2 01             	add    $0x1,%edx
+  800c8c:	0f b6 02             	movzbl (%edx),%eax
+  800c8f:	3c 20                	cmp    $0x20,%al
+  800c91:	74 f6                	je     800c89 <strtol+0x17>
+  800c93:	3c 09                	cmp    $0x9,%al
+  800c95:	74 f2                	je     800c89 <strtol+0x17>
+  800c97:	3c 2b                	cmp    $0x2b,%al
+  800c99:	74 2a                	je     800cc5 <strtol+0x53>
+  800c9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca0:	3c 2d                	cmp    $0x2d,%al
+  800ca2:	74 2b                	je     800ccf <strtol+0x5d>
+  800ca4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800caa:	75 0f                	jne    800cbb <strtol+0x49>
+  800cac:	80 3a 30             	cmpb   $0x30,(%edx)
+  800caf:	74 28                	je     800cd9 <strtol+0x67>
+  800cb1:	85 db                	test   %ebx,%ebx
+  800cb3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cb8:	0f 44 d8             	cmove  %eax,%ebx
+  800cbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cc3:	eb 46                	jmp    800d0b <strtol+0x99>
+  800cc5:	83 c2 01             	add    $0x1,%edx
+  800cc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ccd:	eb d5                	jmp    800ca4 <strtol+0x32>
+  800ccf:	83 c2 01             	add    $0x1,%edx
+  800cd2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cd7:	eb cb                	jmp    800ca4 <strtol+0x32>
+  800cd9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cdd:	74 0e                	je     800ced <strtol+0x7b>
+  800cdf:	85 db                	test   %ebx,%ebx
+  800ce1:	75 d8                	jne    800cbb <strtol+0x49>
+  800ce3:	83 c2 01             	add    $0x1,%edx
+  800ce6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ceb:	eb ce                	jmp    800cbb <strtol+0x49>
+  800ced:	83 c2 02             	add    $0x2,%edx
+  800cf0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cf5:	eb c4                	jmp    800cbb <strtol+0x49>
+  800cf7:	0f be c0             	movsbl %al,%eax
+  800cfa:	83 e8 30             	sub    $0x30,%eax
+  800cfd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d00:	7d 3a                	jge    800d3c <strtol+0xca>
+  800d02:	83 c2 01             	add    $0x1,%edx
+  800d05:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d09:	01 c1                	add    %eax,%ecx
+  800d0b:	0f b6 02             	movzbl (%edx),%eax
+  800d0e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d11:	89 f3                	mov    %esi,%ebx
+  800d13:	80 fb 09             	cmp    $0x9,%bl
+  800d16:	76 df                	jbe    800cf7 <strtol+0x85>
+  800d18:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d1b:	89 f3                	mov    %esi,%ebx
+  800d1d:	80 fb 19             	cmp    $0x19,%bl
+  800d20:	77 08                	ja     800d2a <strtol+0xb8>
+  800d22:	0f be c0             	movsbl %al,%eax
+  800d25:	83 e8 57             	sub    $0x57,%eax
+  800d28:	eb d3                	jmp    800cfd <strtol+0x8b>
+  800d2a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d2d:	89 f3                	mov    %esi,%ebx
+  800d2f:	80 fb 19             	cmp    $0x19,%bl
+  800d32:	77 08                	ja     800d3c <strtol+0xca>
+  800d34:	0f be c0             	movsbl %al,%eax
+  800d37:	83 e8 37             	sub    $0x37,%eax
+  800d3a:	eb c1                	jmp    800cfd <strtol+0x8b>
+  800d3c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d40:	74 05                	je     800d47 <strtol+0xd5>
+  800d42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d45:	89 10                	mov    %edx,(%eax)
+  800d47:	89 c8                	mov    %ecx,%eax
+  800d49:	f7 d8                	neg    %eax
+  800d4b:	85 ff                	test   %edi,%edi
+  800d4d:	0f 45 c8             	cmovne %eax,%ecx
+  800d50:	89 c8                	mov    %ecx,%eax
+  800d52:	5b                   	pop    %ebx
+  800d53:	5e                   	pop    %esi
+  800d54:	5f                   	pop    %edi
+  800d55:	5d                   	pop    %ebp
+  800d56:	c3                   	ret
+
+00800d57 <sys_cputs>:
+  800d57:	55                   	push   %ebp
+  800d58:	89 e5                	mov    %esp,%ebp
+  800d5a:	57                   	push   %edi
+  800d5b:	56                   	push   %esi
+  800d5c:	53                   	push   %ebx
+  800d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d68:	89 c3                	mov    %eax,%ebx
+  800d6a:	89 c7                	mov    %eax,%edi
+  800d6c:	89 c6                	mov    %eax,%esi
+  800d6e:	cd 30                	int    $0x30
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+
+00800d75 <sys_cgetc>:
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+  800d7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d80:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d85:	89 d1                	mov    %edx,%ecx
+  800d87:	89 d3                	mov    %edx,%ebx
+  800d89:	89 d7                	mov    %edx,%edi
+  800d8b:	89 d6                	mov    %edx,%esi
+  800d8d:	cd 30                	int    $0x30
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+
+00800d94 <sys_env_destroy>:
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+  800d9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800daa:	89 cb                	mov    %ecx,%ebx
+  800dac:	89 cf                	mov    %ecx,%edi
+  800dae:	89 ce                	mov    %ecx,%esi
+  800db0:	cd 30                	int    $0x30
+  800db2:	85 c0                	test   %eax,%eax
+  800db4:	7f 08                	jg     800dbe <sys_env_destroy+0x2a>
+  800db6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  800dc1:	50                   	push   %eax
+  800dc2:	6a 03                	push   $0x3
+  800dc4:	68 ab 45 80 00       	push   $0x8045ab
+  800dc9:	6a 24                	push   $0x24
+  800dcb:	68 c8 45 80 00       	push   $0x8045c8
+  800dd0:	e8 38 f4 ff ff       	call   80020d <_panic>
+
+00800dd5 <sys_getenvid>:
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+  800ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800de5:	89 d1                	mov    %edx,%ecx
+  800de7:	89 d3                	mov    %edx,%ebx
+  800de9:	89 d7                	mov    %edx,%edi
+  800deb:	89 d6                	mov    %edx,%esi
+  800ded:	cd 30                	int    $0x30
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_yield>:
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e01:	74 26                	je     800e29 <sys_yield+0x35>
+  800e03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e08:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e0d:	89 d1                	mov    %edx,%ecx
+  800e0f:	89 d3                	mov    %edx,%ebx
+  800e11:	89 d7                	mov    %edx,%edi
+  800e13:	6a 00                	push   $0x0
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	8d 35 20 0e 80 00    	lea    0x800e20,%esi
+  800e1e:	0f 34                	sysenter
+  800e20:	5d                   	pop    %ebp
+  800e21:	83 c4 04             	add    $0x4,%esp
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+  800e29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e33:	89 d1                	mov    %edx,%ecx
+  800e35:	89 d3                	mov    %edx,%ebx
+  800e37:	89 d7                	mov    %edx,%edi
+  800e39:	89 d6                	mov    %edx,%esi
+  800e3b:	cd 30                	int    $0x30
+  800e3d:	eb e5                	jmp    800e24 <sys_yield+0x30>
+
+00800e3f <sys_page_alloc>:
+  800e3f:	55                   	push   %ebp
+  800e40:	89 e5                	mov    %esp,%ebp
+  800e42:	57                   	push   %edi
+  800e43:	56                   	push   %esi
+  800e44:	53                   	push   %ebx
+  800e45:	83 ec 0c             	sub    $0xc,%esp
+  800e48:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e53:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5b:	89 f7                	mov    %esi,%edi
+  800e5d:	cd 30                	int    $0x30
+  800e5f:	85 c0                	test   %eax,%eax
+  800e61:	7f 08                	jg     800e6b <sys_page_alloc+0x2c>
+  800e63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  800e6e:	50                   	push   %eax
+  800e6f:	6a 04                	push   $0x4
+  800e71:	68 ab 45 80 00       	push   $0x8045ab
+  800e76:	6a 24                	push   $0x24
+  800e78:	68 c8 45 80 00       	push   $0x8045c8
+  800e7d:	e8 8b f3 ff ff       	call   80020d <_panic>
+
+00800e82 <sys_page_map>:
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+  800e88:	83 ec 0c             	sub    $0xc,%esp
+  800e8b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e92:	74 33                	je     800ec7 <sys_page_map+0x45>
+  800e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea5:	ff 75 18             	push   0x18(%ebp)
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	8d 35 b3 0e 80 00    	lea    0x800eb3,%esi
+  800eb1:	0f 34                	sysenter
+  800eb3:	5d                   	pop    %ebp
+  800eb4:	83 c4 04             	add    $0x4,%esp
+  800eb7:	89 c2                	mov    %eax,%edx
+  800eb9:	85 c0                	test   %eax,%eax
+  800ebb:	7f 3d                	jg     800efa <sys_page_map+0x78>
+  800ebd:	89 d0                	mov    %edx,%eax
+  800ebf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec2:	5b                   	pop    %ebx
+  800ec3:	5e                   	pop    %esi
+  800ec4:	5f                   	pop    %edi
+  800ec5:	5d                   	pop    %ebp
+  800ec6:	c3                   	ret
+  800ec7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ecc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800edb:	cd 30                	int    $0x30
+  800edd:	89 c2                	mov    %eax,%edx
+  800edf:	85 c0                	test   %eax,%eax
+  800ee1:	7e da                	jle    800ebd <sys_page_map+0x3b>
+  800ee3:	83 ec 0c             	sub    $0xc,%esp
+  800ee6:	50                   	push   %eax
+  800ee7:	6a 05                	push   $0x5
+  800ee9:	68 ab 45 80 00       	push   $0x8045ab
+  800eee:	6a 24                	push   $0x24
+  800ef0:	68 c8 45 80 00       	push   $0x8045c8
+  800ef5:	e8 13 f3 ff ff       	call   80020d <_panic>
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	50                   	push   %eax
+  800efe:	6a 05                	push   $0x5
+  800f00:	68 ab 45 80 00       	push   $0x8045ab
+  800f05:	6a 48                	push   $0x48
+  800f07:	68 c8 45 80 00       	push   $0x8045c8
+  800f0c:	e8 fc f2 ff ff       	call   80020d <_panic>
+
+00800f11 <sys_page_unmap>:
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	57                   	push   %edi
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f25:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f2a:	89 df                	mov    %ebx,%edi
+  800f2c:	89 de                	mov    %ebx,%esi
+  800f2e:	cd 30                	int    $0x30
+  800f30:	85 c0                	test   %eax,%eax
+  800f32:	7f 08                	jg     800f3c <sys_page_unmap+0x2b>
+  800f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5f                   	pop    %edi
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+  800f3c:	83 ec 0c             	sub    $0xc,%esp
+  800f3f:	50                   	push   %eax
+  800f40:	6a 06                	push   $0x6
+  800f42:	68 ab 45 80 00       	push   $0x8045ab
+  800f47:	6a 24                	push   $0x24
+  800f49:	68 c8 45 80 00       	push   $0x8045c8
+  800f4e:	e8 ba f2 ff ff       	call   80020d <_panic>
+
+00800f53 <sys_fork>:
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	57                   	push   %edi
+  800f57:	56                   	push   %esi
+  800f58:	53                   	push   %ebx
+  800f59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800f63:	89 d1                	mov    %edx,%ecx
+  800f65:	89 d3                	mov    %edx,%ebx
+  800f67:	89 d7                	mov    %edx,%edi
+  800f69:	89 d6                	mov    %edx,%esi
+  800f6b:	cd 30                	int    $0x30
+  800f6d:	5b                   	pop    %ebx
+  800f6e:	5e                   	pop    %esi
+  800f6f:	5f                   	pop    %edi
+  800f70:	5d                   	pop    %ebp
+  800f71:	c3                   	ret
+
+00800f72 <sys_env_set_status>:
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	57                   	push   %edi
+  800f76:	56                   	push   %esi
+  800f77:	53                   	push   %ebx
+  800f78:	83 ec 0c             	sub    $0xc,%esp
+  800f7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f8b:	89 df                	mov    %ebx,%edi
+  800f8d:	89 de                	mov    %ebx,%esi
+  800f8f:	cd 30                	int    $0x30
+  800f91:	85 c0                	test   %eax,%eax
+  800f93:	7f 08                	jg     800f9d <sys_env_set_status+0x2b>
+  800f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f98:	5b                   	pop    %ebx
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+  800f9d:	83 ec 0c             	sub    $0xc,%esp
+  800fa0:	50                   	push   %eax
+  800fa1:	6a 08                	push   $0x8
+  800fa3:	68 ab 45 80 00       	push   $0x8045ab
+  800fa8:	6a 24                	push   $0x24
+  800faa:	68 c8 45 80 00       	push   $0x8045c8
+  800faf:	e8 59 f2 ff ff       	call   80020d <_panic>
+
+00800fb4 <sys_env_set_trapframe>:
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	57                   	push   %edi
+  800fb8:	56                   	push   %esi
+  800fb9:	53                   	push   %ebx
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+  800fbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fcd:	89 df                	mov    %ebx,%edi
+  800fcf:	89 de                	mov    %ebx,%esi
+  800fd1:	cd 30                	int    $0x30
+  800fd3:	85 c0                	test   %eax,%eax
+  800fd5:	7f 08                	jg     800fdf <sys_env_set_trapframe+0x2b>
+  800fd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5e                   	pop    %esi
+  800fdc:	5f                   	pop    %edi
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+  800fe2:	50                   	push   %eax
+  800fe3:	6a 09                	push   $0x9
+  800fe5:	68 ab 45 80 00       	push   $0x8045ab
+  800fea:	6a 24                	push   $0x24
+  800fec:	68 c8 45 80 00       	push   $0x8045c8
+  800ff1:	e8 17 f2 ff ff       	call   80020d <_panic>
+
+00800ff6 <sys_env_set_cow>:
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+  800ffc:	83 ec 0c             	sub    $0xc,%esp
+  800fff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801004:	8b 55 08             	mov    0x8(%ebp),%edx
+  801007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80100f:	89 df                	mov    %ebx,%edi
+  801011:	89 de                	mov    %ebx,%esi
+  801013:	cd 30                	int    $0x30
+  801015:	85 c0                	test   %eax,%eax
+  801017:	7f 08                	jg     801021 <sys_env_set_cow+0x2b>
+  801019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  801024:	50                   	push   %eax
+  801025:	6a 20                	push   $0x20
+  801027:	68 ab 45 80 00       	push   $0x8045ab
+  80102c:	6a 24                	push   $0x24
+  80102e:	68 c8 45 80 00       	push   $0x8045c8
+  801033:	e8 d5 f1 ff ff       	call   80020d <_panic>
+
+00801038 <sys_env_service>:
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	57                   	push   %edi
+  80103c:	56                   	push   %esi
+  80103d:	53                   	push   %ebx
+  80103e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801043:	8b 55 08             	mov    0x8(%ebp),%edx
+  801046:	b8 21 00 00 00       	mov    $0x21,%eax
+  80104b:	89 cb                	mov    %ecx,%ebx
+  80104d:	89 cf                	mov    %ecx,%edi
+  80104f:	89 ce                	mov    %ecx,%esi
+  801051:	cd 30                	int    $0x30
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+
+00801058 <sys_env_set_pgfault_upcall>:
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+  80105e:	83 ec 0c             	sub    $0xc,%esp
+  801061:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801071:	89 df                	mov    %ebx,%edi
+  801073:	89 de                	mov    %ebx,%esi
+  801075:	cd 30                	int    $0x30
+  801077:	85 c0                	test   %eax,%eax
+  801079:	7f 08                	jg     801083 <sys_env_set_pgfault_upcall+0x2b>
+  80107b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107e:	5b                   	pop    %ebx
+  80107f:	5e                   	pop    %esi
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+  801083:	83 ec 0c             	sub    $0xc,%esp
+  801086:	50                   	push   %eax
+  801087:	6a 0a                	push   $0xa
+  801089:	68 ab 45 80 00       	push   $0x8045ab
+  80108e:	6a 24                	push   $0x24
+  801090:	68 c8 45 80 00       	push   $0x8045c8
+  801095:	e8 73 f1 ff ff       	call   80020d <_panic>
+
+0080109a <sys_ipc_try_send>:
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	57                   	push   %edi
+  80109e:	56                   	push   %esi
+  80109f:	53                   	push   %ebx
+  8010a0:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010a7:	74 27                	je     8010d0 <sys_ipc_try_send+0x36>
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ba:	6a 00                	push   $0x0
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	8d 35 c7 10 80 00    	lea    0x8010c7,%esi
+  8010c5:	0f 34                	sysenter
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	83 c4 04             	add    $0x4,%esp
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+  8010d0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e6:	cd 30                	int    $0x30
+  8010e8:	eb e1                	jmp    8010cb <sys_ipc_try_send+0x31>
+
+008010ea <sys_ipc_recv>:
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+  8010ed:	57                   	push   %edi
+  8010ee:	56                   	push   %esi
+  8010ef:	53                   	push   %ebx
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+  8010f3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010fa:	74 32                	je     80112e <sys_ipc_recv+0x44>
+  8010fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801104:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801109:	89 cb                	mov    %ecx,%ebx
+  80110b:	89 cf                	mov    %ecx,%edi
+  80110d:	6a 00                	push   $0x0
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+  801112:	8d 35 1a 11 80 00    	lea    0x80111a,%esi
+  801118:	0f 34                	sysenter
+  80111a:	5d                   	pop    %ebp
+  80111b:	83 c4 04             	add    $0x4,%esp
+  80111e:	89 c2                	mov    %eax,%edx
+  801120:	85 c0                	test   %eax,%eax
+  801122:	7f 3c                	jg     801160 <sys_ipc_recv+0x76>
+  801124:	89 d0                	mov    %edx,%eax
+  801126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+  80112e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801133:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801138:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113b:	89 cb                	mov    %ecx,%ebx
+  80113d:	89 cf                	mov    %ecx,%edi
+  80113f:	89 ce                	mov    %ecx,%esi
+  801141:	cd 30                	int    $0x30
+  801143:	89 c2                	mov    %eax,%edx
+  801145:	85 c0                	test   %eax,%eax
+  801147:	7e db                	jle    801124 <sys_ipc_recv+0x3a>
+  801149:	83 ec 0c             	sub    $0xc,%esp
+  80114c:	50                   	push   %eax
+  80114d:	6a 0d                	push   $0xd
+  80114f:	68 ab 45 80 00       	push   $0x8045ab
+  801154:	6a 24                	push   $0x24
+  801156:	68 c8 45 80 00       	push   $0x8045c8
+  80115b:	e8 ad f0 ff ff       	call   80020d <_panic>
+  801160:	83 ec 0c             	sub    $0xc,%esp
+  801163:	50                   	push   %eax
+  801164:	6a 0d                	push   $0xd
+  801166:	68 ab 45 80 00       	push   $0x8045ab
+  80116b:	6a 48                	push   $0x48
+  80116d:	68 c8 45 80 00       	push   $0x8045c8
+  801172:	e8 96 f0 ff ff       	call   80020d <_panic>
+
+00801177 <sys_ipc_send>:
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	57                   	push   %edi
+  80117b:	56                   	push   %esi
+  80117c:	53                   	push   %ebx
+  80117d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801184:	74 27                	je     8011ad <sys_ipc_send+0x36>
+  801186:	8b 55 08             	mov    0x8(%ebp),%edx
+  801189:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801191:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801194:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801197:	6a 00                	push   $0x0
+  801199:	55                   	push   %ebp
+  80119a:	89 e5                	mov    %esp,%ebp
+  80119c:	8d 35 a4 11 80 00    	lea    0x8011a4,%esi
+  8011a2:	0f 34                	sysenter
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	83 c4 04             	add    $0x4,%esp
+  8011a8:	5b                   	pop    %ebx
+  8011a9:	5e                   	pop    %esi
+  8011aa:	5f                   	pop    %edi
+  8011ab:	5d                   	pop    %ebp
+  8011ac:	c3                   	ret
+  8011ad:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c3:	cd 30                	int    $0x30
+  8011c5:	eb e1                	jmp    8011a8 <sys_ipc_send+0x31>
+
+008011c7 <sys_ipc_call>:
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	57                   	push   %edi
+  8011cb:	56                   	push   %esi
+  8011cc:	53                   	push   %ebx
+  8011cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011de:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011e1:	cd 30                	int    $0x30
+  8011e3:	5b                   	pop    %ebx
+  8011e4:	5e                   	pop    %esi
+  8011e5:	5f                   	pop    %edi
+  8011e6:	5d                   	pop    %ebp
+  8011e7:	c3                   	ret
+
+008011e8 <sys_ipc_reply_recv>:
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	57                   	push   %edi
+  8011ec:	56                   	push   %esi
+  8011ed:	53                   	push   %ebx
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  801202:	cd 30                	int    $0x30
+  801204:	5b                   	pop    %ebx
+  801205:	5e                   	pop    %esi
+  801206:	5f                   	pop    %edi
+  801207:	5d                   	pop    %ebp
+  801208:	c3                   	ret
+
+00801209 <sys_time_msec>:
+  801209:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80120e:	85 c0                	test   %eax,%eax
+  801210:	75 06                	jne    801218 <sys_time_msec+0xf>
+  801212:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801217:	c3                   	ret
+  801218:	55                   	push   %ebp
+  801219:	89 e5                	mov    %esp,%ebp
+  80121b:	57                   	push   %edi
+  80121c:	56                   	push   %esi
+  80121d:	53                   	push   %ebx
+  80121e:	83 ec 0c             	sub    $0xc,%esp
+  801221:	0f 31                	rdtsc
+  801223:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801229:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80122f:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801235:	29 c8                	sub    %ecx,%eax
+  801237:	19 da                	sbb    %ebx,%edx
+  801239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80123e:	57                   	push   %edi
+  80123f:	56                   	push   %esi
+  801240:	52                   	push   %edx
+  801241:	50                   	push   %eax
+  801242:	e8 56 2e 00 00       	call   80409d <__udivdi3>
+  801247:	83 c4 10             	add    $0x10,%esp
+  80124a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124d:	5b                   	pop    %ebx
+  80124e:	5e                   	pop    %esi
+  80124f:	5f                   	pop    %edi
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+
+00801252 <sys_env_swap>:
+  801252:	55                   	push   %ebp
+  801253:	89 e5                	mov    %esp,%ebp
+  801255:	57                   	push   %edi
+  801256:	56                   	push   %esi
+  801257:	53                   	push   %ebx
+  801258:	83 ec 0c             	sub    $0xc,%esp
+  80125b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801260:	8b 55 08             	mov    0x8(%ebp),%edx
+  801263:	b8 12 00 00 00       	mov    $0x12,%eax
+  801268:	89 cb                	mov    %ecx,%ebx
+  80126a:	89 cf                	mov    %ecx,%edi
+  80126c:	89 ce                	mov    %ecx,%esi
+  80126e:	cd 30                	int    $0x30
+  801270:	85 c0                	test   %eax,%eax
+  801272:	7f 08                	jg     80127c <sys_env_swap+0x2a>
+  801274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801277:	5b                   	pop    %ebx
+  801278:	5e                   	pop    %esi
+  801279:	5f                   	pop    %edi
+  80127a:	5d                   	pop    %ebp
+  80127b:	c3                   	ret
+  80127c:	83 ec 0c             	sub    $0xc,%esp
+  80127f:	50                   	push   %eax
+  801280:	6a 12                	push   $0x12
+  801282:	68 ab 45 80 00       	push   $0x8045ab
+  801287:	6a 24                	push   $0x24
+  801289:	68 c8 45 80 00       	push   $0x8045c8
+  80128e:	e8 7a ef ff ff       	call   80020d <_panic>
+
+00801293 <sys_net_try_send>:
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+  801296:	57                   	push   %edi
+  801297:	56                   	push   %esi
+  801298:	53                   	push   %ebx
+  801299:	83 ec 0c             	sub    $0xc,%esp
+  80129c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012ac:	89 df                	mov    %ebx,%edi
+  8012ae:	89 de                	mov    %ebx,%esi
+  8012b0:	cd 30                	int    $0x30
+  8012b2:	85 c0                	test   %eax,%eax
+  8012b4:	7f 08                	jg     8012be <sys_net_try_send+0x2b>
+  8012b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b9:	5b                   	pop    %ebx
+  8012ba:	5e                   	pop    %esi
+  8012bb:	5f                   	pop    %edi
+  8012bc:	5d                   	pop    %ebp
+  8012bd:	c3                   	ret
+  8012be:	83 ec 0c             	sub    $0xc,%esp
+  8012c1:	50                   	push   %eax
+  8012c2:	6a 13                	push   $0x13
+  8012c4:	68 ab 45 80 00       	push   $0x8045ab
+  8012c9:	6a 24                	push   $0x24
+  8012cb:	68 c8 45 80 00       	push   $0x8045c8
+  8012d0:	e8 38 ef ff ff       	call   80020d <_panic>
+
+008012d5 <sys_net_try_receive>:
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	57                   	push   %edi
+  8012d9:	56                   	push   %esi
+  8012da:	53                   	push   %ebx
+  8012db:	83 ec 0c             	sub    $0xc,%esp
+  8012de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012ee:	89 df                	mov    %ebx,%edi
+  8012f0:	89 de                	mov    %ebx,%esi
+  8012f2:	cd 30                	int    $0x30
+  8012f4:	85 c0                	test   %eax,%eax
+  8012f6:	7f 08                	jg     801300 <sys_net_try_receive+0x2b>
+  8012f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fb:	5b                   	pop    %ebx
+  8012fc:	5e                   	pop    %esi
+  8012fd:	5f                   	pop    %edi
+  8012fe:	5d                   	pop    %ebp
+  8012ff:	c3                   	ret
+  801300:	83 ec 0c             	sub    $0xc,%esp
+  801303:	50                   	push   %eax
+  801304:	6a 14                	push   $0x14
+  801306:	68 ab 45 80 00       	push   $0x8045ab
+  80130b:	6a 24                	push   $0x24
+  80130d:	68 c8 45 80 00       	push   $0x8045c8
+  801312:	e8 f6 ee ff ff       	call   80020d <_panic>
+
+00801317 <sys_net_recv_page>:
+  801317:	55                   	push   %ebp
+  801318:	89 e5                	mov    %esp,%ebp
+  80131a:	57                   	push   %edi
+  80131b:	56                   	push   %esi
+  80131c:	53                   	push   %ebx
+  80131d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+  801325:	b8 27 00 00 00       	mov    $0x27,%eax
+  80132a:	89 cb                	mov    %ecx,%ebx
+  80132c:	89 cf                	mov    %ecx,%edi
+  80132e:	89 ce                	mov    %ecx,%esi
+  801330:	cd 30                	int    $0x30
+  801332:	5b                   	pop    %ebx
+  801333:	5e                   	pop    %esi
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+
+00801337 <sys_net_wait>:
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	57                   	push   %edi
+  80133b:	56                   	push   %esi
+  80133c:	53                   	push   %ebx
+  80133d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801342:	b8 26 00 00 00       	mov    $0x26,%eax
+  801347:	89 d1                	mov    %edx,%ecx
+  801349:	89 d3                	mov    %edx,%ebx
+  80134b:	89 d7                	mov    %edx,%edi
+  80134d:	89 d6                	mov    %edx,%esi
+  80134f:	cd 30                	int    $0x30
+  801351:	5b                   	pop    %ebx
+  801352:	5e                   	pop    %esi
+  801353:	5f                   	pop    %edi
+  801354:	5d                   	pop    %ebp
+  801355:	c3                   	ret
+
+00801356 <sys_get_mac>:
+  801356:	55                   	push   %ebp
+  801357:	89 e5                	mov    %esp,%ebp
+  801359:	57                   	push   %edi
+  80135a:	56                   	push   %esi
+  80135b:	53                   	push   %ebx
+  80135c:	83 ec 0c             	sub    $0xc,%esp
+  80135f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801364:	8b 55 08             	mov    0x8(%ebp),%edx
+  801367:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80136f:	89 df                	mov    %ebx,%edi
+  801371:	89 de                	mov    %ebx,%esi
+  801373:	cd 30                	int    $0x30
+  801375:	85 c0                	test   %eax,%eax
+  801377:	7f 08                	jg     801381 <sys_get_mac+0x2b>
+  801379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137c:	5b                   	pop    %ebx
+  80137d:	5e                   	pop    %esi
+  80137e:	5f                   	pop    %edi
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+  801381:	83 ec 0c             	sub    $0xc,%esp
+  801384:	50                   	push   %eax
+  801385:	6a 15                	push   $0x15
+  801387:	68 ab 45 80 00       	push   $0x8045ab
+  80138c:	6a 24                	push   $0x24
+  80138e:	68 c8 45 80 00       	push   $0x8045c8
+  801393:	e8 75 ee ff ff       	call   80020d <_panic>
+
+00801398 <sys_env_lease>:
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	57                   	push   %edi
+  80139c:	56                   	push   %esi
+  80139d:	53                   	push   %ebx
+  80139e:	83 ec 0c             	sub    $0xc,%esp
+  8013a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ac:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013b1:	89 df                	mov    %ebx,%edi
+  8013b3:	89 de                	mov    %ebx,%esi
+  8013b5:	cd 30                	int    $0x30
+  8013b7:	85 c0                	test   %eax,%eax
+  8013b9:	7f 08                	jg     8013c3 <sys_env_lease+0x2b>
+  8013bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013be:	5b                   	pop    %ebx
+  8013bf:	5e                   	pop    %esi
+  8013c0:	5f                   	pop    %edi
+  8013c1:	5d                   	pop    %ebp
+  8013c2:	c3                   	ret
+  8013c3:	83 ec 0c             	sub    $0xc,%esp
+  8013c6:	50                   	push   %eax
+  8013c7:	6a 16                	push   $0x16
+  8013c9:	68 ab 45 80 00       	push   $0x8045ab
+  8013ce:	6a 24                	push   $0x24
+  8013d0:	68 c8 45 80 00       	push   $0x8045c8
+  8013d5:	e8 33 ee ff ff       	call   80020d <_panic>
+
+008013da <sys_copy_mem>:
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	57                   	push   %edi
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+  8013e0:	83 ec 0c             	sub    $0xc,%esp
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013f7:	cd 30                	int    $0x30
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	7f 08                	jg     801405 <sys_copy_mem+0x2b>
+  8013fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+  801405:	83 ec 0c             	sub    $0xc,%esp
+  801408:	50                   	push   %eax
+  801409:	6a 17                	push   $0x17
+  80140b:	68 ab 45 80 00       	push   $0x8045ab
+  801410:	6a 24                	push   $0x24
+  801412:	68 c8 45 80 00       	push   $0x8045c8
+  801417:	e8 f1 ed ff ff       	call   80020d <_panic>
+
+0080141c <sys_get_perms>:
+  80141c:	55                   	push   %ebp
+  80141d:	89 e5                	mov    %esp,%ebp
+  80141f:	57                   	push   %edi
+  801420:	56                   	push   %esi
+  801421:	53                   	push   %ebx
+  801422:	83 ec 0c             	sub    $0xc,%esp
+  801425:	be 00 00 00 00       	mov    $0x0,%esi
+  80142a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801430:	b8 18 00 00 00       	mov    $0x18,%eax
+  801435:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801438:	89 f7                	mov    %esi,%edi
+  80143a:	cd 30                	int    $0x30
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	7f 08                	jg     801448 <sys_get_perms+0x2c>
+  801440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801443:	5b                   	pop    %ebx
+  801444:	5e                   	pop    %esi
+  801445:	5f                   	pop    %edi
+  801446:	5d                   	pop    %ebp
+  801447:	c3                   	ret
+  801448:	83 ec 0c             	sub    $0xc,%esp
+  80144b:	50                   	push   %eax
+  80144c:	6a 18                	push   $0x18
+  80144e:	68 ab 45 80 00       	push   $0x8045ab
+  801453:	6a 24                	push   $0x24
+  801455:	68 c8 45 80 00       	push   $0x8045c8
+  80145a:	e8 ae ed ff ff       	call   80020d <_panic>
+
+0080145f <sys_env_unsuspend>:
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	57                   	push   %edi
+  801463:	56                   	push   %esi
+  801464:	53                   	push   %ebx
+  801465:	83 ec 0c             	sub    $0xc,%esp
+  801468:	be 00 00 00 00       	mov    $0x0,%esi
+  80146d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801470:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801473:	b8 19 00 00 00       	mov    $0x19,%eax
+  801478:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147b:	89 f7                	mov    %esi,%edi
+  80147d:	cd 30                	int    $0x30
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	7f 08                	jg     80148b <sys_env_unsuspend+0x2c>
+  801483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801486:	5b                   	pop    %ebx
+  801487:	5e                   	pop    %esi
+  801488:	5f                   	pop    %edi
+  801489:	5d                   	pop    %ebp
+  80148a:	c3                   	ret
+  80148b:	83 ec 0c             	sub    $0xc,%esp
+  80148e:	50                   	push   %eax
+  80148f:	6a 19                	push   $0x19
+  801491:	68 ab 45 80 00       	push   $0x8045ab
+  801496:	6a 24                	push   $0x24
+  801498:	68 c8 45 80 00       	push   $0x8045c8
+  80149d:	e8 6b ed ff ff       	call   80020d <_panic>
+
+008014a2 <sys_migrate>:
+  8014a2:	55                   	push   %ebp
+  8014a3:	89 e5                	mov    %esp,%ebp
+  8014a5:	57                   	push   %edi
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	83 ec 0c             	sub    $0xc,%esp
+  8014ab:	ba 04 90 80 00       	mov    $0x809004,%edx
+  8014b0:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8014b6:	76 11                	jbe    8014c9 <sys_migrate+0x27>
+  8014b8:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8014bd:	0f b6 08             	movzbl (%eax),%ecx
+  8014c0:	05 00 10 00 00       	add    $0x1000,%eax
+  8014c5:	39 d0                	cmp    %edx,%eax
+  8014c7:	72 f4                	jb     8014bd <sys_migrate+0x1b>
+  8014c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014d6:	89 cb                	mov    %ecx,%ebx
+  8014d8:	89 cf                	mov    %ecx,%edi
+  8014da:	89 ce                	mov    %ecx,%esi
+  8014dc:	cd 30                	int    $0x30
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	7f 08                	jg     8014ea <sys_migrate+0x48>
+  8014e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e5:	5b                   	pop    %ebx
+  8014e6:	5e                   	pop    %esi
+  8014e7:	5f                   	pop    %edi
+  8014e8:	5d                   	pop    %ebp
+  8014e9:	c3                   	ret
+  8014ea:	83 ec 0c             	sub    $0xc,%esp
+  8014ed:	50                   	push   %eax
+  8014ee:	6a 1a                	push   $0x1a
+  8014f0:	68 ab 45 80 00       	push   $0x8045ab
+  8014f5:	6a 24                	push   $0x24
+  8014f7:	68 c8 45 80 00       	push   $0x8045c8
+  8014fc:	e8 0c ed ff ff       	call   80020d <_panic>
+
+00801501 <sys_lease_complete>:
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	57                   	push   %edi
+  801505:	56                   	push   %esi
+  801506:	53                   	push   %ebx
+  801507:	83 ec 0c             	sub    $0xc,%esp
+  80150a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801514:	89 d1                	mov    %edx,%ecx
+  801516:	89 d3                	mov    %edx,%ebx
+  801518:	89 d7                	mov    %edx,%edi
+  80151a:	89 d6                	mov    %edx,%esi
+  80151c:	cd 30                	int    $0x30
+  80151e:	85 c0                	test   %eax,%eax
+  801520:	7f 08                	jg     80152a <sys_lease_complete+0x29>
+  801522:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801525:	5b                   	pop    %ebx
+  801526:	5e                   	pop    %esi
+  801527:	5f                   	pop    %edi
+  801528:	5d                   	pop    %ebp
+  801529:	c3                   	ret
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	50                   	push   %eax
+  80152e:	6a 1b                	push   $0x1b
+  801530:	68 ab 45 80 00       	push   $0x8045ab
+  801535:	6a 24                	push   $0x24
+  801537:	68 c8 45 80 00       	push   $0x8045c8
+  80153c:	e8 cc ec ff ff       	call   80020d <_panic>
+
+00801541 <sys_env_set_thisenv>:
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+  801547:	83 ec 0c             	sub    $0xc,%esp
+  80154a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801552:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801555:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80155a:	89 df                	mov    %ebx,%edi
+  80155c:	89 de                	mov    %ebx,%esi
+  80155e:	cd 30                	int    $0x30
+  801560:	85 c0                	test   %eax,%eax
+  801562:	7f 08                	jg     80156c <sys_env_set_thisenv+0x2b>
+  801564:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801567:	5b                   	pop    %ebx
+  801568:	5e                   	pop    %esi
+  801569:	5f                   	pop    %edi
+  80156a:	5d                   	pop    %ebp
+  80156b:	c3                   	ret
+  80156c:	83 ec 0c             	sub    $0xc,%esp
+  80156f:	50                   	push   %eax
+  801570:	6a 1c                	push   $0x1c
+  801572:	68 ab 45 80 00       	push   $0x8045ab
+  801577:	6a 24                	push   $0x24
+  801579:	68 c8 45 80 00       	push   $0x8045c8
+  80157e:	e8 8a ec ff ff       	call   80020d <_panic>
+
+00801583 <sys_env_set_sched>:
+  801583:	55                   	push   %ebp
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	57                   	push   %edi
+  801587:	56                   	push   %esi
+  801588:	53                   	push   %ebx
+  801589:	83 ec 0c             	sub    $0xc,%esp
+  80158c:	be 00 00 00 00       	mov    $0x0,%esi
+  801591:	8b 55 08             	mov    0x8(%ebp),%edx
+  801594:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801597:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80159c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80159f:	89 f7                	mov    %esi,%edi
+  8015a1:	cd 30                	int    $0x30
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	7f 08                	jg     8015af <sys_env_set_sched+0x2c>
+  8015a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015aa:	5b                   	pop    %ebx
+  8015ab:	5e                   	pop    %esi
+  8015ac:	5f                   	pop    %edi
+  8015ad:	5d                   	pop    %ebp
+  8015ae:	c3                   	ret
+  8015af:	83 ec 0c             	sub    $0xc,%esp
+  8015b2:	50                   	push   %eax
+  8015b3:	6a 1d                	push   $0x1d
+  8015b5:	68 ab 45 80 00       	push   $0x8045ab
+  8015ba:	6a 24                	push   $0x24
+  8015bc:	68 c8 45 80 00       	push   $0x8045c8
+  8015c1:	e8 47 ec ff ff       	call   80020d <_panic>
+
+008015c6 <sys_batch>:
+  8015c6:	55                   	push   %ebp
+  8015c7:	89 e5                	mov    %esp,%ebp
+  8015c9:	57                   	push   %edi
+  8015ca:	56                   	push   %esi
+  8015cb:	53                   	push   %ebx
+  8015cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8015dc:	89 df                	mov    %ebx,%edi
+  8015de:	89 de                	mov    %ebx,%esi
+  8015e0:	cd 30                	int    $0x30
+  8015e2:	5b                   	pop    %ebx
+  8015e3:	5e                   	pop    %esi
+  8015e4:	5f                   	pop    %edi
+  8015e5:	5d                   	pop    %ebp
+  8015e6:	c3                   	ret
+
+008015e7 <sys_env_stats>:
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	57                   	push   %edi
+  8015eb:	56                   	push   %esi
+  8015ec:	53                   	push   %ebx
+  8015ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f8:	b8 23 00 00 00       	mov    $0x23,%eax
+  8015fd:	89 df                	mov    %ebx,%edi
+  8015ff:	89 de                	mov    %ebx,%esi
+  801601:	cd 30                	int    $0x30
+  801603:	5b                   	pop    %ebx
+  801604:	5e                   	pop    %esi
+  801605:	5f                   	pop    %edi
+  801606:	5d                   	pop    %ebp
+  801607:	c3                   	ret
+
+00801608 <sys_trace>:
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	57                   	push   %edi
+  80160c:	56                   	push   %esi
+  80160d:	53                   	push   %ebx
+  80160e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801613:	8b 55 08             	mov    0x8(%ebp),%edx
+  801616:	b8 24 00 00 00       	mov    $0x24,%eax
+  80161b:	89 cb                	mov    %ecx,%ebx
+  80161d:	89 cf                	mov    %ecx,%edi
+  80161f:	89 ce                	mov    %ecx,%esi
+  801621:	cd 30                	int    $0x30
+  801623:	5b                   	pop    %ebx
+  801624:	5e                   	pop    %esi
+  801625:	5f                   	pop    %edi
+  801626:	5d                   	pop    %ebp
+  801627:	c3                   	ret
+
+00801628 <sys_env_set_pager>:
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	57                   	push   %edi
+  80162c:	56                   	push   %esi
+  80162d:	53                   	push   %ebx
+  80162e:	83 ec 0c             	sub    $0xc,%esp
+  801631:	be 00 00 00 00       	mov    $0x0,%esi
+  801636:	8b 55 08             	mov    0x8(%ebp),%edx
+  801639:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163c:	b8 25 00 00 00       	mov    $0x25,%eax
+  801641:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801644:	89 f7                	mov    %esi,%edi
+  801646:	cd 30                	int    $0x30
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	7f 08                	jg     801654 <sys_env_set_pager+0x2c>
+  80164c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164f:	5b                   	pop    %ebx
+  801650:	5e                   	pop    %esi
+  801651:	5f                   	pop    %edi
+  801652:	5d                   	pop    %ebp
+  801653:	c3                   	ret
+  801654:	83 ec 0c             	sub    $0xc,%esp
+  801657:	50                   	push   %eax
+  801658:	6a 25                	push   $0x25
+  80165a:	68 ab 45 80 00       	push   $0x8045ab
+  80165f:	6a 24                	push   $0x24
+  801661:	68 c8 45 80 00       	push   $0x8045c8
+  801666:	e8 a2 eb ff ff       	call   80020d <_panic>
+
+0080166b <sys_pager_retire>:
+  80166b:	55                   	push   %ebp
+  80166c:	89 e5                	mov    %esp,%ebp
+  80166e:	57                   	push   %edi
+  80166f:	56                   	push   %esi
+  801670:	53                   	push   %ebx
+  801671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801676:	8b 55 08             	mov    0x8(%ebp),%edx
+  801679:	b8 28 00 00 00       	mov    $0x28,%eax
+  80167e:	89 cb                	mov    %ecx,%ebx
+  801680:	89 cf                	mov    %ecx,%edi
+  801682:	89 ce                	mov    %ecx,%esi
+  801684:	cd 30                	int    $0x30
+  801686:	5b                   	pop    %ebx
+  801687:	5e                   	pop    %esi
+  801688:	5f                   	pop    %edi
+  801689:	5d                   	pop    %ebp
+  80168a:	c3                   	ret
+
+0080168b <sys_prof>:
+  80168b:	55                   	push   %ebp
+  80168c:	89 e5                	mov    %esp,%ebp
+  80168e:	57                   	push   %edi
+  80168f:	56                   	push   %esi
+  801690:	53                   	push   %ebx
+  801691:	be 00 00 00 00       	mov    $0x0,%esi
+  801696:	8b 55 08             	mov    0x8(%ebp),%edx
+  801699:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169c:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a4:	89 f7                	mov    %esi,%edi
+  8016a6:	cd 30                	int    $0x30
+  8016a8:	5b                   	pop    %ebx
+  8016a9:	5e                   	pop    %esi
+  8016aa:	5f                   	pop    %edi
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+
+008016ad <dupq_flush>:
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	53                   	push   %ebx
+  8016b1:	83 ec 0c             	sub    $0xc,%esp
+  8016b4:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  8016ba:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8016c1:	00 00 00 
+  8016c4:	53                   	push   %ebx
+  8016c5:	68 00 00 40 00       	push   $0x400000
+  8016ca:	e8 f7 fe ff ff       	call   8015c6 <sys_batch>
+  8016cf:	83 c4 10             	add    $0x10,%esp
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	78 14                	js     8016ea <dupq_flush+0x3d>
+  8016d6:	39 c3                	cmp    %eax,%ebx
+  8016d8:	7e 0b                	jle    8016e5 <dupq_flush+0x38>
+  8016da:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8016dd:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  8016e3:	eb 05                	jmp    8016ea <dupq_flush+0x3d>
+  8016e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ed:	c9                   	leave
+  8016ee:	c3                   	ret
+
+008016ef <pgfault>:
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	56                   	push   %esi
+  8016f3:	53                   	push   %ebx
+  8016f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016f7:	8b 30                	mov    (%eax),%esi
+  8016f9:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8016fd:	0f 84 83 00 00 00    	je     801786 <pgfault+0x97>
+  801703:	89 f0                	mov    %esi,%eax
+  801705:	c1 e8 0c             	shr    $0xc,%eax
+  801708:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80170f:	f6 c4 08             	test   $0x8,%ah
+  801712:	0f 84 80 00 00 00    	je     801798 <pgfault+0xa9>
+  801718:	e8 b8 f6 ff ff       	call   800dd5 <sys_getenvid>
+  80171d:	89 c3                	mov    %eax,%ebx
+  80171f:	83 ec 04             	sub    $0x4,%esp
+  801722:	6a 07                	push   $0x7
+  801724:	68 00 f0 7f 00       	push   $0x7ff000
+  801729:	50                   	push   %eax
+  80172a:	e8 10 f7 ff ff       	call   800e3f <sys_page_alloc>
+  80172f:	83 c4 10             	add    $0x10,%esp
+  801732:	85 c0                	test   %eax,%eax
+  801734:	78 74                	js     8017aa <pgfault+0xbb>
+  801736:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80173c:	83 ec 04             	sub    $0x4,%esp
+  80173f:	68 00 10 00 00       	push   $0x1000
+  801744:	56                   	push   %esi
+  801745:	68 00 f0 7f 00       	push   $0x7ff000
+  80174a:	e8 40 f4 ff ff       	call   800b8f <memmove>
+  80174f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801756:	56                   	push   %esi
+  801757:	53                   	push   %ebx
+  801758:	68 00 f0 7f 00       	push   $0x7ff000
+  80175d:	53                   	push   %ebx
+  80175e:	e8 1f f7 ff ff       	call   800e82 <sys_page_map>
+  801763:	83 c4 20             	add    $0x20,%esp
+  801766:	85 c0                	test   %eax,%eax
+  801768:	78 54                	js     8017be <pgfault+0xcf>
+  80176a:	83 ec 08             	sub    $0x8,%esp
+  80176d:	68 00 f0 7f 00       	push   $0x7ff000
+  801772:	53                   	push   %ebx
+  801773:	e8 99 f7 ff ff       	call   800f11 <sys_page_unmap>
+  801778:	83 c4 10             	add    $0x10,%esp
+  80177b:	85 c0                	test   %eax,%eax
+  80177d:	78 53                	js     8017d2 <pgfault+0xe3>
+  80177f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801782:	5b                   	pop    %ebx
+  801783:	5e                   	pop    %esi
+  801784:	5d                   	pop    %ebp
+  801785:	c3                   	ret
+  801786:	56                   	push   %esi
+  801787:	68 d8 45 80 00       	push   $0x8045d8
+  80178c:	6a 19                	push   $0x19
+  80178e:	68 b4 46 80 00       	push   $0x8046b4
+  801793:	e8 75 ea ff ff       	call   80020d <_panic>
+  801798:	56                   	push   %esi
+  801799:	68 0c 46 80 00       	push   $0x80460c
+  80179e:	6a 1e                	push   $0x1e
+  8017a0:	68 b4 46 80 00       	push   $0x8046b4
+  8017a5:	e8 63 ea ff ff       	call   80020d <_panic>
+  8017aa:	83 ec 04             	sub    $0x4,%esp
+  8017ad:	68 40 46 80 00       	push   $0x804640
+  8017b2:	6a 2e                	push   $0x2e
+  8017b4:	68 b4 46 80 00       	push   $0x8046b4
+  8017b9:	e8 4f ea ff ff       	call   80020d <_panic>
+  8017be:	83 ec 04             	sub    $0x4,%esp
+  8017c1:	68 64 46 80 00       	push   $0x804664
+  8017c6:	6a 37                	push   $0x37
+  8017c8:	68 b4 46 80 00       	push   $0x8046b4
+  8017cd:	e8 3b ea ff ff       	call   80020d <_panic>
+  8017d2:	83 ec 04             	sub    $0x4,%esp
+  8017d5:	68 90 46 80 00       	push   $0x804690
+  8017da:	6a 3c                	push   $0x3c
+  8017dc:	68 b4 46 80 00       	push   $0x8046b4
+  8017e1:	e8 27 ea ff ff       	call   80020d <_panic>
+
+008017e6 <dupq_begin>:
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+  8017e9:	83 ec 0c             	sub    $0xc,%esp
+  8017ec:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8017f3:	00 00 00 
+  8017f6:	6a 07                	push   $0x7
+  8017f8:	68 00 00 40 00       	push   $0x400000
+  8017fd:	6a 00                	push   $0x0
+  8017ff:	e8 3b f6 ff ff       	call   800e3f <sys_page_alloc>
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+
+00801806 <dupq_map>:
+  801806:	55                   	push   %ebp
+  801807:	89 e5                	mov    %esp,%ebp
+  801809:	83 ec 08             	sub    $0x8,%esp
+  80180c:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  801813:	00 00 00 
+  801816:	74 46                	je     80185e <dupq_map+0x58>
+  801818:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80181e:	8d 42 01             	lea    0x1(%edx),%eax
+  801821:	a3 00 60 80 00       	mov    %eax,0x806000
+  801826:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801829:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80182f:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801836:	00 00 00 
+  801839:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183c:	89 50 04             	mov    %edx,0x4(%eax)
+  80183f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801842:	c1 e2 0c             	shl    $0xc,%edx
+  801845:	89 50 08             	mov    %edx,0x8(%eax)
+  801848:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80184b:	89 48 0c             	mov    %ecx,0xc(%eax)
+  80184e:	89 50 10             	mov    %edx,0x10(%eax)
+  801851:	8b 55 14             	mov    0x14(%ebp),%edx
+  801854:	89 50 14             	mov    %edx,0x14(%eax)
+  801857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185c:	c9                   	leave
+  80185d:	c3                   	ret
+  80185e:	e8 4a fe ff ff       	call   8016ad <dupq_flush>
+  801863:	85 c0                	test   %eax,%eax
+  801865:	79 b1                	jns    801818 <dupq_map+0x12>
+  801867:	eb f3                	jmp    80185c <dupq_map+0x56>
+
+00801869 <dupq_end>:
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	53                   	push   %ebx
+  80186d:	83 ec 04             	sub    $0x4,%esp
+  801870:	e8 38 fe ff ff       	call   8016ad <dupq_flush>
+  801875:	89 c3                	mov    %eax,%ebx
+  801877:	83 ec 08             	sub    $0x8,%esp
+  80187a:	68 00 00 40 00       	push   $0x400000
+  80187f:	6a 00                	push   $0x0
+  801881:	e8 8b f6 ff ff       	call   800f11 <sys_page_unmap>
+  801886:	89 d8                	mov    %ebx,%eax
+  801888:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+
+0080188d <fork>:
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	53                   	push   %ebx
+  801891:	83 ec 10             	sub    $0x10,%esp
+  801894:	68 ef 16 80 00       	push   $0x8016ef
+  801899:	e8 d6 23 00 00       	call   803c74 <set_pgfault_handler>
+  80189e:	83 c4 08             	add    $0x8,%esp
+  8018a1:	6a 01                	push   $0x1
+  8018a3:	6a 00                	push   $0x0
+  8018a5:	e8 4c f7 ff ff       	call   800ff6 <sys_env_set_cow>
+  8018aa:	e8 a4 f6 ff ff       	call   800f53 <sys_fork>
+  8018af:	89 c3                	mov    %eax,%ebx
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	74 07                	je     8018bf <fork+0x32>
+  8018b8:	89 d8                	mov    %ebx,%eax
+  8018ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018bd:	c9                   	leave
+  8018be:	c3                   	ret
+  8018bf:	e8 11 f5 ff ff       	call   800dd5 <sys_getenvid>
+  8018c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018c9:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8018cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018d4:	a3 14 60 80 00       	mov    %eax,0x806014
+  8018d9:	eb dd                	jmp    8018b8 <fork+0x2b>
+
+008018db <sfork>:
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	57                   	push   %edi
+  8018df:	56                   	push   %esi
+  8018e0:	53                   	push   %ebx
+  8018e1:	83 ec 1c             	sub    $0x1c,%esp
+  8018e4:	e8 ec f4 ff ff       	call   800dd5 <sys_getenvid>
+  8018e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8018ec:	83 ec 0c             	sub    $0xc,%esp
+  8018ef:	68 ef 16 80 00       	push   $0x8016ef
+  8018f4:	e8 7b 23 00 00       	call   803c74 <set_pgfault_handler>
+  8018f9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8018fe:	cd 30                	int    $0x30
+  801900:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	0f 88 45 02 00 00    	js     801b53 <sfork+0x278>
+  80190e:	89 c6                	mov    %eax,%esi
+  801910:	74 17                	je     801929 <sfork+0x4e>
+  801912:	e8 cf fe ff ff       	call   8017e6 <dupq_begin>
+  801917:	85 c0                	test   %eax,%eax
+  801919:	0f 88 40 02 00 00    	js     801b5f <sfork+0x284>
+  80191f:	bf 02 00 00 00       	mov    $0x2,%edi
+  801924:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801927:	eb 39                	jmp    801962 <sfork+0x87>
+  801929:	e8 a7 f4 ff ff       	call   800dd5 <sys_getenvid>
+  80192e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801933:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801939:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80193e:	a3 14 60 80 00       	mov    %eax,0x806014
+  801943:	e9 23 01 00 00       	jmp    801a6b <sfork+0x190>
+  801948:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80194f:	a8 01                	test   $0x1,%al
+  801951:	75 5b                	jne    8019ae <sfork+0xd3>
+  801953:	83 c7 01             	add    $0x1,%edi
+  801956:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  80195c:	0f 84 40 01 00 00    	je     801aa2 <sfork+0x1c7>
+  801962:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801969:	a8 01                	test   $0x1,%al
+  80196b:	74 db                	je     801948 <sfork+0x6d>
+  80196d:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801974:	a8 80                	test   $0x80,%al
+  801976:	74 d0                	je     801948 <sfork+0x6d>
+  801978:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  80197f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801984:	0c 80                	or     $0x80,%al
+  801986:	50                   	push   %eax
+  801987:	ff 75 e4             	push   -0x1c(%ebp)
+  80198a:	89 f8                	mov    %edi,%eax
+  80198c:	c1 e0 16             	shl    $0x16,%eax
+  80198f:	c1 e8 0c             	shr    $0xc,%eax
+  801992:	50                   	push   %eax
+  801993:	ff 75 e0             	push   -0x20(%ebp)
+  801996:	e8 6b fe ff ff       	call   801806 <dupq_map>
+  80199b:	83 c4 10             	add    $0x10,%esp
+  80199e:	85 c0                	test   %eax,%eax
+  8019a0:	79 b1                	jns    801953 <sfork+0x78>
+  8019a2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8019a9:	e9 bd 00 00 00       	jmp    801a6b <sfork+0x190>
+  8019ae:	89 fe                	mov    %edi,%esi
+  8019b0:	c1 e6 16             	shl    $0x16,%esi
+  8019b3:	89 f0                	mov    %esi,%eax
+  8019b5:	c1 e8 0c             	shr    $0xc,%eax
+  8019b8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8019bd:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8019c0:	eb 57                	jmp    801a19 <sfork+0x13e>
+  8019c2:	e8 0e f4 ff ff       	call   800dd5 <sys_getenvid>
+  8019c7:	89 c7                	mov    %eax,%edi
+  8019c9:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  8019ce:	f6 c4 04             	test   $0x4,%ah
+  8019d1:	0f 85 9f 00 00 00    	jne    801a76 <sfork+0x19b>
+  8019d7:	a9 02 08 00 00       	test   $0x802,%eax
+  8019dc:	0f 85 c5 01 00 00    	jne    801ba7 <sfork+0x2cc>
+  8019e2:	6a 05                	push   $0x5
+  8019e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8019e7:	68 fd e7 0e 00       	push   $0xee7fd
+  8019ec:	57                   	push   %edi
+  8019ed:	e8 14 fe ff ff       	call   801806 <dupq_map>
+  8019f2:	83 c4 10             	add    $0x10,%esp
+  8019f5:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8019fb:	0f 84 91 00 00 00    	je     801a92 <sfork+0x1b7>
+  801a01:	89 f0                	mov    %esi,%eax
+  801a03:	09 d8                	or     %ebx,%eax
+  801a05:	c1 e8 0c             	shr    $0xc,%eax
+  801a08:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a0e:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801a13:	0f 84 81 00 00 00    	je     801a9a <sfork+0x1bf>
+  801a19:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801a1e:	74 a2                	je     8019c2 <sfork+0xe7>
+  801a20:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a27:	f6 c2 01             	test   $0x1,%dl
+  801a2a:	74 c9                	je     8019f5 <sfork+0x11a>
+  801a2c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a33:	f6 c6 02             	test   $0x2,%dh
+  801a36:	75 bd                	jne    8019f5 <sfork+0x11a>
+  801a38:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801a3f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a46:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801a4c:	f7 d2                	not    %edx
+  801a4e:	21 ca                	and    %ecx,%edx
+  801a50:	52                   	push   %edx
+  801a51:	ff 75 e4             	push   -0x1c(%ebp)
+  801a54:	50                   	push   %eax
+  801a55:	ff 75 e0             	push   -0x20(%ebp)
+  801a58:	e8 a9 fd ff ff       	call   801806 <dupq_map>
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	79 91                	jns    8019f5 <sfork+0x11a>
+  801a64:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801a6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a71:	5b                   	pop    %ebx
+  801a72:	5e                   	pop    %esi
+  801a73:	5f                   	pop    %edi
+  801a74:	5d                   	pop    %ebp
+  801a75:	c3                   	ret
+  801a76:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a7b:	50                   	push   %eax
+  801a7c:	ff 75 e4             	push   -0x1c(%ebp)
+  801a7f:	68 fd e7 0e 00       	push   $0xee7fd
+  801a84:	57                   	push   %edi
+  801a85:	e8 7c fd ff ff       	call   801806 <dupq_map>
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	e9 63 ff ff ff       	jmp    8019f5 <sfork+0x11a>
+  801a92:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801a95:	e9 b9 fe ff ff       	jmp    801953 <sfork+0x78>
+  801a9a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801a9d:	e9 b1 fe ff ff       	jmp    801953 <sfork+0x78>
+  801aa2:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801aa5:	e8 bf fd ff ff       	call   801869 <dupq_end>
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	0f 88 b9 00 00 00    	js     801b6b <sfork+0x290>
+  801ab2:	83 ec 04             	sub    $0x4,%esp
+  801ab5:	6a 07                	push   $0x7
+  801ab7:	68 00 f0 7f ee       	push   $0xee7ff000
+  801abc:	56                   	push   %esi
+  801abd:	e8 7d f3 ff ff       	call   800e3f <sys_page_alloc>
+  801ac2:	83 c4 10             	add    $0x10,%esp
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	0f 88 aa 00 00 00    	js     801b77 <sfork+0x29c>
+  801acd:	83 ec 0c             	sub    $0xc,%esp
+  801ad0:	6a 07                	push   $0x7
+  801ad2:	68 00 f0 7f 00       	push   $0x7ff000
+  801ad7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801ada:	57                   	push   %edi
+  801adb:	68 00 f0 7f ee       	push   $0xee7ff000
+  801ae0:	56                   	push   %esi
+  801ae1:	e8 9c f3 ff ff       	call   800e82 <sys_page_map>
+  801ae6:	83 c4 20             	add    $0x20,%esp
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	0f 88 92 00 00 00    	js     801b83 <sfork+0x2a8>
+  801af1:	83 ec 04             	sub    $0x4,%esp
+  801af4:	68 00 10 00 00       	push   $0x1000
+  801af9:	68 00 f0 7f 00       	push   $0x7ff000
+  801afe:	68 00 f0 7f ee       	push   $0xee7ff000
+  801b03:	e8 87 f0 ff ff       	call   800b8f <memmove>
+  801b08:	83 c4 08             	add    $0x8,%esp
+  801b0b:	68 00 f0 7f 00       	push   $0x7ff000
+  801b10:	57                   	push   %edi
+  801b11:	e8 fb f3 ff ff       	call   800f11 <sys_page_unmap>
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	78 72                	js     801b8f <sfork+0x2b4>
+  801b1d:	83 ec 08             	sub    $0x8,%esp
+  801b20:	68 ec 3c 80 00       	push   $0x803cec
+  801b25:	56                   	push   %esi
+  801b26:	e8 2d f5 ff ff       	call   801058 <sys_env_set_pgfault_upcall>
+  801b2b:	83 c4 10             	add    $0x10,%esp
+  801b2e:	85 c0                	test   %eax,%eax
+  801b30:	78 69                	js     801b9b <sfork+0x2c0>
+  801b32:	83 ec 08             	sub    $0x8,%esp
+  801b35:	6a 02                	push   $0x2
+  801b37:	56                   	push   %esi
+  801b38:	e8 35 f4 ff ff       	call   800f72 <sys_env_set_status>
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801b47:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801b4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b4e:	e9 18 ff ff ff       	jmp    801a6b <sfork+0x190>
+  801b53:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b5a:	e9 0c ff ff ff       	jmp    801a6b <sfork+0x190>
+  801b5f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b66:	e9 00 ff ff ff       	jmp    801a6b <sfork+0x190>
+  801b6b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b72:	e9 f4 fe ff ff       	jmp    801a6b <sfork+0x190>
+  801b77:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b7e:	e9 e8 fe ff ff       	jmp    801a6b <sfork+0x190>
+  801b83:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b8a:	e9 dc fe ff ff       	jmp    801a6b <sfork+0x190>
+  801b8f:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b96:	e9 d0 fe ff ff       	jmp    801a6b <sfork+0x190>
+  801b9b:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ba2:	e9 c4 fe ff ff       	jmp    801a6b <sfork+0x190>
+  801ba7:	68 05 08 00 00       	push   $0x805
+  801bac:	ff 75 e4             	push   -0x1c(%ebp)
+  801baf:	68 fd e7 0e 00       	push   $0xee7fd
+  801bb4:	57                   	push   %edi
+  801bb5:	e8 4c fc ff ff       	call   801806 <dupq_map>
+  801bba:	83 c4 10             	add    $0x10,%esp
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	0f 88 30 fe ff ff    	js     8019f5 <sfork+0x11a>
+  801bc5:	68 05 08 00 00       	push   $0x805
+  801bca:	57                   	push   %edi
+  801bcb:	68 fd e7 0e 00       	push   $0xee7fd
+  801bd0:	57                   	push   %edi
+  801bd1:	e8 30 fc ff ff       	call   801806 <dupq_map>
+  801bd6:	83 c4 10             	add    $0x10,%esp
+  801bd9:	e9 17 fe ff ff       	jmp    8019f5 <sfork+0x11a>
+
+00801bde <fd2num>:
+  801bde:	55                   	push   %ebp
+  801bdf:	89 e5                	mov    %esp,%ebp
+  801be1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be4:	05 00 00 00 30       	add    $0x30000000,%eax
+  801be9:	c1 e8 0c             	shr    $0xc,%eax
+  801bec:	5d                   	pop    %ebp
+  801bed:	c3                   	ret
+
+00801bee <fd2data>:
+  801bee:	55                   	push   %ebp
+  801bef:	89 e5                	mov    %esp,%ebp
+  801bf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf4:	05 00 00 00 30       	add    $0x30000000,%eax
+  801bf9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bfe:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801c03:	5d                   	pop    %ebp
+  801c04:	c3                   	ret
+
+00801c05 <fd_alloc>:
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801c0d:	89 c2                	mov    %eax,%edx
+  801c0f:	c1 ea 16             	shr    $0x16,%edx
+  801c12:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c19:	f6 c2 01             	test   $0x1,%dl
+  801c1c:	74 29                	je     801c47 <fd_alloc+0x42>
+  801c1e:	89 c2                	mov    %eax,%edx
+  801c20:	c1 ea 0c             	shr    $0xc,%edx
+  801c23:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c2a:	f6 c2 01             	test   $0x1,%dl
+  801c2d:	74 18                	je     801c47 <fd_alloc+0x42>
+  801c2f:	05 00 10 00 00       	add    $0x1000,%eax
+  801c34:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801c39:	75 d2                	jne    801c0d <fd_alloc+0x8>
+  801c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c40:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c45:	eb 05                	jmp    801c4c <fd_alloc+0x47>
+  801c47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c4f:	89 02                	mov    %eax,(%edx)
+  801c51:	89 c8                	mov    %ecx,%eax
+  801c53:	5d                   	pop    %ebp
+  801c54:	c3                   	ret
+
+00801c55 <fd_lookup>:
+  801c55:	55                   	push   %ebp
+  801c56:	89 e5                	mov    %esp,%ebp
+  801c58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5b:	83 f8 1f             	cmp    $0x1f,%eax
+  801c5e:	77 30                	ja     801c90 <fd_lookup+0x3b>
+  801c60:	c1 e0 0c             	shl    $0xc,%eax
+  801c63:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801c68:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c6e:	f6 c2 01             	test   $0x1,%dl
+  801c71:	74 24                	je     801c97 <fd_lookup+0x42>
+  801c73:	89 c2                	mov    %eax,%edx
+  801c75:	c1 ea 0c             	shr    $0xc,%edx
+  801c78:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c7f:	f6 c2 01             	test   $0x1,%dl
+  801c82:	74 1a                	je     801c9e <fd_lookup+0x49>
+  801c84:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c87:	89 02                	mov    %eax,(%edx)
+  801c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8e:	5d                   	pop    %ebp
+  801c8f:	c3                   	ret
+  801c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c95:	eb f7                	jmp    801c8e <fd_lookup+0x39>
+  801c97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c9c:	eb f0                	jmp    801c8e <fd_lookup+0x39>
+  801c9e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca3:	eb e9                	jmp    801c8e <fd_lookup+0x39>
+
+00801ca5 <dev_lookup>:
+  801ca5:	55                   	push   %ebp
+  801ca6:	89 e5                	mov    %esp,%ebp
+  801ca8:	53                   	push   %ebx
+  801ca9:	83 ec 04             	sub    $0x4,%esp
+  801cac:	8b 55 08             	mov    0x8(%ebp),%edx
+  801caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb4:	bb 0c 50 80 00       	mov    $0x80500c,%ebx
+  801cb9:	39 13                	cmp    %edx,(%ebx)
+  801cbb:	74 37                	je     801cf4 <dev_lookup+0x4f>
+  801cbd:	83 c0 01             	add    $0x1,%eax
+  801cc0:	8b 1c 85 3c 47 80 00 	mov    0x80473c(,%eax,4),%ebx
+  801cc7:	85 db                	test   %ebx,%ebx
+  801cc9:	75 ee                	jne    801cb9 <dev_lookup+0x14>
+  801ccb:	a1 14 60 80 00       	mov    0x806014,%eax
+  801cd0:	8b 40 48             	mov    0x48(%eax),%eax
+  801cd3:	83 ec 04             	sub    $0x4,%esp
+  801cd6:	52                   	push   %edx
+  801cd7:	50                   	push   %eax
+  801cd8:	68 c0 46 80 00       	push   $0x8046c0
+  801cdd:	e8 06 e6 ff ff       	call   8002e8 <cprintf>
+  801ce2:	83 c4 10             	add    $0x10,%esp
+  801ce5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ced:	89 1a                	mov    %ebx,(%edx)
+  801cef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf2:	c9                   	leave
+  801cf3:	c3                   	ret
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	eb ef                	jmp    801cea <dev_lookup+0x45>
+
+00801cfb <fd_close>:
+  801cfb:	55                   	push   %ebp
+  801cfc:	89 e5                	mov    %esp,%ebp
+  801cfe:	57                   	push   %edi
+  801cff:	56                   	push   %esi
+  801d00:	53                   	push   %ebx
+  801d01:	83 ec 24             	sub    $0x24,%esp
+  801d04:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d07:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801d0a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d0d:	50                   	push   %eax
+  801d0e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d14:	c1 e8 0c             	shr    $0xc,%eax
+  801d17:	50                   	push   %eax
+  801d18:	e8 38 ff ff ff       	call   801c55 <fd_lookup>
+  801d1d:	89 c3                	mov    %eax,%ebx
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 05                	js     801d2b <fd_close+0x30>
+  801d26:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d29:	74 0f                	je     801d3a <fd_close+0x3f>
+  801d2b:	85 ff                	test   %edi,%edi
+  801d2d:	0f 44 df             	cmove  %edi,%ebx
+  801d30:	89 d8                	mov    %ebx,%eax
+  801d32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d35:	5b                   	pop    %ebx
+  801d36:	5e                   	pop    %esi
+  801d37:	5f                   	pop    %edi
+  801d38:	5d                   	pop    %ebp
+  801d39:	c3                   	ret
+  801d3a:	83 ec 08             	sub    $0x8,%esp
+  801d3d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d40:	50                   	push   %eax
+  801d41:	ff 36                	push   (%esi)
+  801d43:	e8 5d ff ff ff       	call   801ca5 <dev_lookup>
+  801d48:	89 c3                	mov    %eax,%ebx
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 1a                	js     801d6b <fd_close+0x70>
+  801d51:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d54:	8b 40 10             	mov    0x10(%eax),%eax
+  801d57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d5c:	85 c0                	test   %eax,%eax
+  801d5e:	74 0b                	je     801d6b <fd_close+0x70>
+  801d60:	83 ec 0c             	sub    $0xc,%esp
+  801d63:	56                   	push   %esi
+  801d64:	ff d0                	call   *%eax
+  801d66:	89 c3                	mov    %eax,%ebx
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	83 ec 08             	sub    $0x8,%esp
+  801d6e:	56                   	push   %esi
+  801d6f:	6a 00                	push   $0x0
+  801d71:	e8 9b f1 ff ff       	call   800f11 <sys_page_unmap>
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	eb b5                	jmp    801d30 <fd_close+0x35>
+
+00801d7b <close>:
+  801d7b:	55                   	push   %ebp
+  801d7c:	89 e5                	mov    %esp,%ebp
+  801d7e:	83 ec 20             	sub    $0x20,%esp
+  801d81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d84:	50                   	push   %eax
+  801d85:	ff 75 08             	push   0x8(%ebp)
+  801d88:	e8 c8 fe ff ff       	call   801c55 <fd_lookup>
+  801d8d:	83 c4 10             	add    $0x10,%esp
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	79 02                	jns    801d96 <close+0x1b>
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+  801d96:	83 ec 08             	sub    $0x8,%esp
+  801d99:	6a 01                	push   $0x1
+  801d9b:	ff 75 f4             	push   -0xc(%ebp)
+  801d9e:	e8 58 ff ff ff       	call   801cfb <fd_close>
+  801da3:	83 c4 10             	add    $0x10,%esp
+  801da6:	eb ec                	jmp    801d94 <close+0x19>
+
+00801da8 <close_all>:
+  801da8:	55                   	push   %ebp
+  801da9:	89 e5                	mov    %esp,%ebp
+  801dab:	53                   	push   %ebx
+  801dac:	83 ec 04             	sub    $0x4,%esp
+  801daf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db4:	83 ec 0c             	sub    $0xc,%esp
+  801db7:	53                   	push   %ebx
+  801db8:	e8 be ff ff ff       	call   801d7b <close>
+  801dbd:	83 c3 01             	add    $0x1,%ebx
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	83 fb 20             	cmp    $0x20,%ebx
+  801dc6:	75 ec                	jne    801db4 <close_all+0xc>
+  801dc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dcb:	c9                   	leave
+  801dcc:	c3                   	ret
+
+00801dcd <dup>:
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	57                   	push   %edi
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 34             	sub    $0x34,%esp
+  801dd6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dd9:	50                   	push   %eax
+  801dda:	ff 75 08             	push   0x8(%ebp)
+  801ddd:	e8 73 fe ff ff       	call   801c55 <fd_lookup>
+  801de2:	89 c3                	mov    %eax,%ebx
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 7f                	js     801e6a <dup+0x9d>
+  801deb:	83 ec 0c             	sub    $0xc,%esp
+  801dee:	ff 75 0c             	push   0xc(%ebp)
+  801df1:	e8 85 ff ff ff       	call   801d7b <close>
+  801df6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801df9:	c1 e6 0c             	shl    $0xc,%esi
+  801dfc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801e02:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e05:	89 3c 24             	mov    %edi,(%esp)
+  801e08:	e8 e1 fd ff ff       	call   801bee <fd2data>
+  801e0d:	89 c3                	mov    %eax,%ebx
+  801e0f:	89 34 24             	mov    %esi,(%esp)
+  801e12:	e8 d7 fd ff ff       	call   801bee <fd2data>
+  801e17:	83 c4 10             	add    $0x10,%esp
+  801e1a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e1d:	89 d8                	mov    %ebx,%eax
+  801e1f:	c1 e8 16             	shr    $0x16,%eax
+  801e22:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e29:	a8 01                	test   $0x1,%al
+  801e2b:	74 11                	je     801e3e <dup+0x71>
+  801e2d:	89 d8                	mov    %ebx,%eax
+  801e2f:	c1 e8 0c             	shr    $0xc,%eax
+  801e32:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e39:	f6 c2 01             	test   $0x1,%dl
+  801e3c:	75 36                	jne    801e74 <dup+0xa7>
+  801e3e:	89 f8                	mov    %edi,%eax
+  801e40:	c1 e8 0c             	shr    $0xc,%eax
+  801e43:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e4a:	83 ec 0c             	sub    $0xc,%esp
+  801e4d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e52:	50                   	push   %eax
+  801e53:	56                   	push   %esi
+  801e54:	6a 00                	push   $0x0
+  801e56:	57                   	push   %edi
+  801e57:	6a 00                	push   $0x0
+  801e59:	e8 24 f0 ff ff       	call   800e82 <sys_page_map>
+  801e5e:	89 c3                	mov    %eax,%ebx
+  801e60:	83 c4 20             	add    $0x20,%esp
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	78 33                	js     801e9a <dup+0xcd>
+  801e67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e6a:	89 d8                	mov    %ebx,%eax
+  801e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e6f:	5b                   	pop    %ebx
+  801e70:	5e                   	pop    %esi
+  801e71:	5f                   	pop    %edi
+  801e72:	5d                   	pop    %ebp
+  801e73:	c3                   	ret
+  801e74:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e7b:	83 ec 0c             	sub    $0xc,%esp
+  801e7e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e83:	50                   	push   %eax
+  801e84:	ff 75 d4             	push   -0x2c(%ebp)
+  801e87:	6a 00                	push   $0x0
+  801e89:	53                   	push   %ebx
+  801e8a:	6a 00                	push   $0x0
+  801e8c:	e8 f1 ef ff ff       	call   800e82 <sys_page_map>
+  801e91:	89 c3                	mov    %eax,%ebx
+  801e93:	83 c4 20             	add    $0x20,%esp
+  801e96:	85 c0                	test   %eax,%eax
+  801e98:	79 a4                	jns    801e3e <dup+0x71>
+  801e9a:	83 ec 08             	sub    $0x8,%esp
+  801e9d:	56                   	push   %esi
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	e8 6c f0 ff ff       	call   800f11 <sys_page_unmap>
+  801ea5:	83 c4 08             	add    $0x8,%esp
+  801ea8:	ff 75 d4             	push   -0x2c(%ebp)
+  801eab:	6a 00                	push   $0x0
+  801ead:	e8 5f f0 ff ff       	call   800f11 <sys_page_unmap>
+  801eb2:	83 c4 10             	add    $0x10,%esp
+  801eb5:	eb b3                	jmp    801e6a <dup+0x9d>
+
+00801eb7 <read>:
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	56                   	push   %esi
+  801ebb:	53                   	push   %ebx
+  801ebc:	83 ec 18             	sub    $0x18,%esp
+  801ebf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ec2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ec5:	50                   	push   %eax
+  801ec6:	56                   	push   %esi
+  801ec7:	e8 89 fd ff ff       	call   801c55 <fd_lookup>
+  801ecc:	83 c4 10             	add    $0x10,%esp
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	78 3c                	js     801f0f <read+0x58>
+  801ed3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ed6:	83 ec 08             	sub    $0x8,%esp
+  801ed9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801edc:	50                   	push   %eax
+  801edd:	ff 33                	push   (%ebx)
+  801edf:	e8 c1 fd ff ff       	call   801ca5 <dev_lookup>
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	78 24                	js     801f0f <read+0x58>
+  801eeb:	8b 43 08             	mov    0x8(%ebx),%eax
+  801eee:	83 e0 03             	and    $0x3,%eax
+  801ef1:	83 f8 01             	cmp    $0x1,%eax
+  801ef4:	74 20                	je     801f16 <read+0x5f>
+  801ef6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef9:	8b 40 08             	mov    0x8(%eax),%eax
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	74 37                	je     801f37 <read+0x80>
+  801f00:	83 ec 04             	sub    $0x4,%esp
+  801f03:	ff 75 10             	push   0x10(%ebp)
+  801f06:	ff 75 0c             	push   0xc(%ebp)
+  801f09:	53                   	push   %ebx
+  801f0a:	ff d0                	call   *%eax
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  801f0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f12:	5b                   	pop    %ebx
+  801f13:	5e                   	pop    %esi
+  801f14:	5d                   	pop    %ebp
+  801f15:	c3                   	ret
+  801f16:	a1 14 60 80 00       	mov    0x806014,%eax
+  801f1b:	8b 40 48             	mov    0x48(%eax),%eax
+  801f1e:	83 ec 04             	sub    $0x4,%esp
+  801f21:	56                   	push   %esi
+  801f22:	50                   	push   %eax
+  801f23:	68 01 47 80 00       	push   $0x804701
+  801f28:	e8 bb e3 ff ff       	call   8002e8 <cprintf>
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f35:	eb d8                	jmp    801f0f <read+0x58>
+  801f37:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f3c:	eb d1                	jmp    801f0f <read+0x58>
+
+00801f3e <readn>:
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	57                   	push   %edi
+  801f42:	56                   	push   %esi
+  801f43:	53                   	push   %ebx
+  801f44:	83 ec 0c             	sub    $0xc,%esp
+  801f47:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f4a:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f4d:	85 f6                	test   %esi,%esi
+  801f4f:	74 30                	je     801f81 <readn+0x43>
+  801f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5b:	83 ec 04             	sub    $0x4,%esp
+  801f5e:	89 f2                	mov    %esi,%edx
+  801f60:	29 c2                	sub    %eax,%edx
+  801f62:	52                   	push   %edx
+  801f63:	01 f8                	add    %edi,%eax
+  801f65:	50                   	push   %eax
+  801f66:	ff 75 08             	push   0x8(%ebp)
+  801f69:	e8 49 ff ff ff       	call   801eb7 <read>
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	78 15                	js     801f8a <readn+0x4c>
+  801f75:	74 11                	je     801f88 <readn+0x4a>
+  801f77:	01 c3                	add    %eax,%ebx
+  801f79:	89 d8                	mov    %ebx,%eax
+  801f7b:	39 f3                	cmp    %esi,%ebx
+  801f7d:	72 dc                	jb     801f5b <readn+0x1d>
+  801f7f:	eb 09                	jmp    801f8a <readn+0x4c>
+  801f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f86:	eb 02                	jmp    801f8a <readn+0x4c>
+  801f88:	89 d8                	mov    %ebx,%eax
+  801f8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8d:	5b                   	pop    %ebx
+  801f8e:	5e                   	pop    %esi
+  801f8f:	5f                   	pop    %edi
+  801f90:	5d                   	pop    %ebp
+  801f91:	c3                   	ret
+
+00801f92 <write>:
+  801f92:	55                   	push   %ebp
+  801f93:	89 e5                	mov    %esp,%ebp
+  801f95:	56                   	push   %esi
+  801f96:	53                   	push   %ebx
+  801f97:	83 ec 18             	sub    $0x18,%esp
+  801f9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fa0:	50                   	push   %eax
+  801fa1:	53                   	push   %ebx
+  801fa2:	e8 ae fc ff ff       	call   801c55 <fd_lookup>
+  801fa7:	83 c4 10             	add    $0x10,%esp
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	78 37                	js     801fe5 <write+0x53>
+  801fae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fb1:	83 ec 08             	sub    $0x8,%esp
+  801fb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb7:	50                   	push   %eax
+  801fb8:	ff 36                	push   (%esi)
+  801fba:	e8 e6 fc ff ff       	call   801ca5 <dev_lookup>
+  801fbf:	83 c4 10             	add    $0x10,%esp
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	78 1f                	js     801fe5 <write+0x53>
+  801fc6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fca:	74 20                	je     801fec <write+0x5a>
+  801fcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fcf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	74 37                	je     80200d <write+0x7b>
+  801fd6:	83 ec 04             	sub    $0x4,%esp
+  801fd9:	ff 75 10             	push   0x10(%ebp)
+  801fdc:	ff 75 0c             	push   0xc(%ebp)
+  801fdf:	56                   	push   %esi
+  801fe0:	ff d0                	call   *%eax
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe8:	5b                   	pop    %ebx
+  801fe9:	5e                   	pop    %esi
+  801fea:	5d                   	pop    %ebp
+  801feb:	c3                   	ret
+  801fec:	a1 14 60 80 00       	mov    0x806014,%eax
+  801ff1:	8b 40 48             	mov    0x48(%eax),%eax
+  801ff4:	83 ec 04             	sub    $0x4,%esp
+  801ff7:	53                   	push   %ebx
+  801ff8:	50                   	push   %eax
+  801ff9:	68 1d 47 80 00       	push   $0x80471d
+  801ffe:	e8 e5 e2 ff ff       	call   8002e8 <cprintf>
+  802003:	83 c4 10             	add    $0x10,%esp
+  802006:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80200b:	eb d8                	jmp    801fe5 <write+0x53>
+  80200d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802012:	eb d1                	jmp    801fe5 <write+0x53>
+
+00802014 <seek>:
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	83 ec 20             	sub    $0x20,%esp
+  80201a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80201d:	50                   	push   %eax
+  80201e:	ff 75 08             	push   0x8(%ebp)
+  802021:	e8 2f fc ff ff       	call   801c55 <fd_lookup>
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	85 c0                	test   %eax,%eax
+  80202b:	78 0e                	js     80203b <seek+0x27>
+  80202d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802030:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802033:	89 50 04             	mov    %edx,0x4(%eax)
+  802036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203b:	c9                   	leave
+  80203c:	c3                   	ret
+
+0080203d <ftruncate>:
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	56                   	push   %esi
+  802041:	53                   	push   %ebx
+  802042:	83 ec 18             	sub    $0x18,%esp
+  802045:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802048:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80204b:	50                   	push   %eax
+  80204c:	53                   	push   %ebx
+  80204d:	e8 03 fc ff ff       	call   801c55 <fd_lookup>
+  802052:	83 c4 10             	add    $0x10,%esp
+  802055:	85 c0                	test   %eax,%eax
+  802057:	78 34                	js     80208d <ftruncate+0x50>
+  802059:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80205c:	83 ec 08             	sub    $0x8,%esp
+  80205f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802062:	50                   	push   %eax
+  802063:	ff 36                	push   (%esi)
+  802065:	e8 3b fc ff ff       	call   801ca5 <dev_lookup>
+  80206a:	83 c4 10             	add    $0x10,%esp
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	78 1c                	js     80208d <ftruncate+0x50>
+  802071:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802075:	74 1d                	je     802094 <ftruncate+0x57>
+  802077:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80207a:	8b 40 18             	mov    0x18(%eax),%eax
+  80207d:	85 c0                	test   %eax,%eax
+  80207f:	74 34                	je     8020b5 <ftruncate+0x78>
+  802081:	83 ec 08             	sub    $0x8,%esp
+  802084:	ff 75 0c             	push   0xc(%ebp)
+  802087:	56                   	push   %esi
+  802088:	ff d0                	call   *%eax
+  80208a:	83 c4 10             	add    $0x10,%esp
+  80208d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802090:	5b                   	pop    %ebx
+  802091:	5e                   	pop    %esi
+  802092:	5d                   	pop    %ebp
+  802093:	c3                   	ret
+  802094:	a1 14 60 80 00       	mov    0x806014,%eax
+  802099:	8b 40 48             	mov    0x48(%eax),%eax
+  80209c:	83 ec 04             	sub    $0x4,%esp
+  80209f:	53                   	push   %ebx
+  8020a0:	50                   	push   %eax
+  8020a1:	68 e0 46 80 00       	push   $0x8046e0
+  8020a6:	e8 3d e2 ff ff       	call   8002e8 <cprintf>
+  8020ab:	83 c4 10             	add    $0x10,%esp
+  8020ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b3:	eb d8                	jmp    80208d <ftruncate+0x50>
+  8020b5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ba:	eb d1                	jmp    80208d <ftruncate+0x50>
+
+008020bc <fstat>:
+  8020bc:	55                   	push   %ebp
+  8020bd:	89 e5                	mov    %esp,%ebp
+  8020bf:	56                   	push   %esi
+  8020c0:	53                   	push   %ebx
+  8020c1:	83 ec 18             	sub    $0x18,%esp
+  8020c4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020c7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020ca:	50                   	push   %eax
+  8020cb:	ff 75 08             	push   0x8(%ebp)
+  8020ce:	e8 82 fb ff ff       	call   801c55 <fd_lookup>
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	78 49                	js     802123 <fstat+0x67>
+  8020da:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020dd:	83 ec 08             	sub    $0x8,%esp
+  8020e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e3:	50                   	push   %eax
+  8020e4:	ff 36                	push   (%esi)
+  8020e6:	e8 ba fb ff ff       	call   801ca5 <dev_lookup>
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	78 31                	js     802123 <fstat+0x67>
+  8020f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020f9:	74 2f                	je     80212a <fstat+0x6e>
+  8020fb:	c6 03 00             	movb   $0x0,(%ebx)
+  8020fe:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802105:	00 00 00 
+  802108:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80210f:	00 00 00 
+  802112:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802118:	83 ec 08             	sub    $0x8,%esp
+  80211b:	53                   	push   %ebx
+  80211c:	56                   	push   %esi
+  80211d:	ff 50 14             	call   *0x14(%eax)
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802126:	5b                   	pop    %ebx
+  802127:	5e                   	pop    %esi
+  802128:	5d                   	pop    %ebp
+  802129:	c3                   	ret
+  80212a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80212f:	eb f2                	jmp    802123 <fstat+0x67>
+
+00802131 <stat>:
+  802131:	55                   	push   %ebp
+  802132:	89 e5                	mov    %esp,%ebp
+  802134:	56                   	push   %esi
+  802135:	53                   	push   %ebx
+  802136:	83 ec 08             	sub    $0x8,%esp
+  802139:	6a 00                	push   $0x0
+  80213b:	ff 75 08             	push   0x8(%ebp)
+  80213e:	e8 31 05 00 00       	call   802674 <open>
+  802143:	89 c3                	mov    %eax,%ebx
+  802145:	83 c4 10             	add    $0x10,%esp
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	78 1b                	js     802167 <stat+0x36>
+  80214c:	83 ec 08             	sub    $0x8,%esp
+  80214f:	ff 75 0c             	push   0xc(%ebp)
+  802152:	50                   	push   %eax
+  802153:	e8 64 ff ff ff       	call   8020bc <fstat>
+  802158:	89 c6                	mov    %eax,%esi
+  80215a:	89 1c 24             	mov    %ebx,(%esp)
+  80215d:	e8 19 fc ff ff       	call   801d7b <close>
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	89 f3                	mov    %esi,%ebx
+  802167:	89 d8                	mov    %ebx,%eax
+  802169:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80216c:	5b                   	pop    %ebx
+  80216d:	5e                   	pop    %esi
+  80216e:	5d                   	pop    %ebp
+  80216f:	c3                   	ret
+
+00802170 <fsipc>:
+  802170:	55                   	push   %ebp
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	56                   	push   %esi
+  802174:	53                   	push   %ebx
+  802175:	89 c3                	mov    %eax,%ebx
+  802177:	89 d6                	mov    %edx,%esi
+  802179:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802180:	74 20                	je     8021a2 <fsipc+0x32>
+  802182:	83 ec 08             	sub    $0x8,%esp
+  802185:	6a 00                	push   $0x0
+  802187:	56                   	push   %esi
+  802188:	6a 07                	push   $0x7
+  80218a:	68 00 70 80 00       	push   $0x807000
+  80218f:	53                   	push   %ebx
+  802190:	ff 35 0c 60 80 00    	push   0x80600c
+  802196:	e8 34 1c 00 00       	call   803dcf <ipc_call>
+  80219b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80219e:	5b                   	pop    %ebx
+  80219f:	5e                   	pop    %esi
+  8021a0:	5d                   	pop    %ebp
+  8021a1:	c3                   	ret
+  8021a2:	83 ec 0c             	sub    $0xc,%esp
+  8021a5:	6a 02                	push   $0x2
+  8021a7:	e8 be 1d 00 00       	call   803f6a <ipc_find_env>
+  8021ac:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8021b1:	83 c4 10             	add    $0x10,%esp
+  8021b4:	eb cc                	jmp    802182 <fsipc+0x12>
+
+008021b6 <devfile_trunc>:
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	83 ec 08             	sub    $0x8,%esp
+  8021bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021c2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021ca:	a3 04 70 80 00       	mov    %eax,0x807004
+  8021cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021d9:	e8 92 ff ff ff       	call   802170 <fsipc>
+  8021de:	c9                   	leave
+  8021df:	c3                   	ret
+
+008021e0 <devfile_flush>:
+  8021e0:	55                   	push   %ebp
+  8021e1:	89 e5                	mov    %esp,%ebp
+  8021e3:	83 ec 08             	sub    $0x8,%esp
+  8021e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021ec:	a3 00 70 80 00       	mov    %eax,0x807000
+  8021f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021fb:	e8 70 ff ff ff       	call   802170 <fsipc>
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+
+00802202 <devfile_stat>:
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	53                   	push   %ebx
+  802206:	83 ec 04             	sub    $0x4,%esp
+  802209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80220c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802212:	a3 00 70 80 00       	mov    %eax,0x807000
+  802217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802221:	e8 4a ff ff ff       	call   802170 <fsipc>
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 2c                	js     802256 <devfile_stat+0x54>
+  80222a:	83 ec 08             	sub    $0x8,%esp
+  80222d:	68 00 70 80 00       	push   $0x807000
+  802232:	53                   	push   %ebx
+  802233:	e8 a7 e7 ff ff       	call   8009df <strcpy>
+  802238:	a1 80 70 80 00       	mov    0x807080,%eax
+  80223d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802243:	a1 84 70 80 00       	mov    0x807084,%eax
+  802248:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  80224e:	83 c4 10             	add    $0x10,%esp
+  802251:	b8 00 00 00 00       	mov    $0x0,%eax
+  802256:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802259:	c9                   	leave
+  80225a:	c3                   	ret
+
+0080225b <fsring_rw>:
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	57                   	push   %edi
+  80225f:	56                   	push   %esi
+  802260:	53                   	push   %ebx
+  802261:	83 ec 2c             	sub    $0x2c,%esp
+  802264:	89 c7                	mov    %eax,%edi
+  802266:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802269:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80226c:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802271:	a8 01                	test   $0x1,%al
+  802273:	74 0d                	je     802282 <fsring_rw+0x27>
+  802275:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  80227a:	a8 01                	test   $0x1,%al
+  80227c:	0f 85 d5 00 00 00    	jne    802357 <fsring_rw+0xfc>
+  802282:	a1 14 60 80 00       	mov    0x806014,%eax
+  802287:	8b 40 48             	mov    0x48(%eax),%eax
+  80228a:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  802290:	0f 84 fc 00 00 00    	je     802392 <fsring_rw+0x137>
+  802296:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  80229d:	0f 84 02 01 00 00    	je     8023a5 <fsring_rw+0x14a>
+  8022a3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8022a8:	83 ec 04             	sub    $0x4,%esp
+  8022ab:	68 07 02 00 00       	push   $0x207
+  8022b0:	53                   	push   %ebx
+  8022b1:	6a 00                	push   $0x0
+  8022b3:	e8 87 eb ff ff       	call   800e3f <sys_page_alloc>
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	0f 88 f9 00 00 00    	js     8023bc <fsring_rw+0x161>
+  8022c3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022c9:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8022cf:	75 d7                	jne    8022a8 <fsring_rw+0x4d>
+  8022d1:	6a 0e                	push   $0xe
+  8022d3:	6a 0d                	push   $0xd
+  8022d5:	ff 35 0c 60 80 00    	push   0x80600c
+  8022db:	68 00 00 f0 cf       	push   $0xcff00000
+  8022e0:	e8 fb 15 00 00       	call   8038e0 <ipcring_init>
+  8022e5:	83 c4 08             	add    $0x8,%esp
+  8022e8:	6a 00                	push   $0x0
+  8022ea:	6a 00                	push   $0x0
+  8022ec:	68 07 02 00 00       	push   $0x207
+  8022f1:	68 00 00 f0 cf       	push   $0xcff00000
+  8022f6:	6a 0b                	push   $0xb
+  8022f8:	ff 35 0c 60 80 00    	push   0x80600c
+  8022fe:	e8 cc 1a 00 00       	call   803dcf <ipc_call>
+  802303:	89 c6                	mov    %eax,%esi
+  802305:	83 c4 20             	add    $0x20,%esp
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	0f 88 ac 00 00 00    	js     8023bc <fsring_rw+0x161>
+  802310:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802315:	89 d9                	mov    %ebx,%ecx
+  802317:	83 c3 01             	add    $0x1,%ebx
+  80231a:	89 da                	mov    %ebx,%edx
+  80231c:	c1 e2 0c             	shl    $0xc,%edx
+  80231f:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802325:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80232b:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802331:	83 ec 08             	sub    $0x8,%esp
+  802334:	6a 00                	push   $0x0
+  802336:	6a 00                	push   $0x0
+  802338:	68 07 02 00 00       	push   $0x207
+  80233d:	50                   	push   %eax
+  80233e:	6a 0c                	push   $0xc
+  802340:	ff 35 0c 60 80 00    	push   0x80600c
+  802346:	e8 84 1a 00 00       	call   803dcf <ipc_call>
+  80234b:	83 c4 20             	add    $0x20,%esp
+  80234e:	85 c0                	test   %eax,%eax
+  802350:	78 6a                	js     8023bc <fsring_rw+0x161>
+  802352:	83 fb 08             	cmp    $0x8,%ebx
+  802355:	75 be                	jne    802315 <fsring_rw+0xba>
+  802357:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80235b:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802360:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802365:	0f 45 c2             	cmovne %edx,%eax
+  802368:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80236b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802372:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802379:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802380:	ba 00 00 00 00       	mov    $0x0,%edx
+  802385:	be 00 00 00 00       	mov    $0x0,%esi
+  80238a:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80238d:	e9 4b 01 00 00       	jmp    8024dd <fsring_rw+0x282>
+  802392:	e8 72 ee ff ff       	call   801209 <sys_time_msec>
+  802397:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  80239d:	0f 89 f3 fe ff ff    	jns    802296 <fsring_rw+0x3b>
+  8023a3:	eb 54                	jmp    8023f9 <fsring_rw+0x19e>
+  8023a5:	83 ec 0c             	sub    $0xc,%esp
+  8023a8:	6a 02                	push   $0x2
+  8023aa:	e8 bb 1b 00 00       	call   803f6a <ipc_find_env>
+  8023af:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8023b4:	83 c4 10             	add    $0x10,%esp
+  8023b7:	e9 e7 fe ff ff       	jmp    8022a3 <fsring_rw+0x48>
+  8023bc:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8023c1:	83 ec 08             	sub    $0x8,%esp
+  8023c4:	53                   	push   %ebx
+  8023c5:	6a 00                	push   $0x0
+  8023c7:	e8 45 eb ff ff       	call   800f11 <sys_page_unmap>
+  8023cc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8023db:	75 e4                	jne    8023c1 <fsring_rw+0x166>
+  8023dd:	e8 27 ee ff ff       	call   801209 <sys_time_msec>
+  8023e2:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8023e7:	a3 04 60 80 00       	mov    %eax,0x806004
+  8023ec:	a1 14 60 80 00       	mov    0x806014,%eax
+  8023f1:	8b 40 48             	mov    0x48(%eax),%eax
+  8023f4:	a3 08 60 80 00       	mov    %eax,0x806008
+  8023f9:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  802400:	e9 7a 01 00 00       	jmp    80257f <fsring_rw+0x324>
+  802405:	8b 57 0c             	mov    0xc(%edi),%edx
+  802408:	89 10                	mov    %edx,(%eax)
+  80240a:	89 58 04             	mov    %ebx,0x4(%eax)
+  80240d:	89 f2                	mov    %esi,%edx
+  80240f:	03 57 04             	add    0x4(%edi),%edx
+  802412:	89 50 08             	mov    %edx,0x8(%eax)
+  802415:	83 ec 04             	sub    $0x4,%esp
+  802418:	53                   	push   %ebx
+  802419:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80241c:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  80241f:	52                   	push   %edx
+  802420:	83 c0 0c             	add    $0xc,%eax
+  802423:	50                   	push   %eax
+  802424:	e8 66 e7 ff ff       	call   800b8f <memmove>
+  802429:	83 c4 10             	add    $0x10,%esp
+  80242c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80242f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802432:	89 08                	mov    %ecx,(%eax)
+  802434:	83 ec 0c             	sub    $0xc,%esp
+  802437:	68 00 00 f0 cf       	push   $0xcff00000
+  80243c:	e8 fd 14 00 00       	call   80393e <ipcring_req_push>
+  802441:	01 de                	add    %ebx,%esi
+  802443:	83 c4 10             	add    $0x10,%esp
+  802446:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802449:	73 4c                	jae    802497 <fsring_rw+0x23c>
+  80244b:	83 ec 0c             	sub    $0xc,%esp
+  80244e:	68 00 00 f0 cf       	push   $0xcff00000
+  802453:	e8 c0 14 00 00       	call   803918 <ipcring_req_slot>
+  802458:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	85 c0                	test   %eax,%eax
+  802460:	74 35                	je     802497 <fsring_rw+0x23c>
+  802462:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802467:	83 e0 07             	and    $0x7,%eax
+  80246a:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80246f:	c1 e0 0c             	shl    $0xc,%eax
+  802472:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802475:	29 f3                	sub    %esi,%ebx
+  802477:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80247a:	39 cb                	cmp    %ecx,%ebx
+  80247c:	0f 47 d9             	cmova  %ecx,%ebx
+  80247f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802483:	75 80                	jne    802405 <fsring_rw+0x1aa>
+  802485:	8b 57 0c             	mov    0xc(%edi),%edx
+  802488:	89 10                	mov    %edx,(%eax)
+  80248a:	89 58 04             	mov    %ebx,0x4(%eax)
+  80248d:	89 f2                	mov    %esi,%edx
+  80248f:	03 57 04             	add    0x4(%edi),%edx
+  802492:	89 50 08             	mov    %edx,0x8(%eax)
+  802495:	eb 95                	jmp    80242c <fsring_rw+0x1d1>
+  802497:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80249c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80249f:	83 ec 0c             	sub    $0xc,%esp
+  8024a2:	68 00 00 f0 cf       	push   $0xcff00000
+  8024a7:	e8 cb 14 00 00       	call   803977 <ipcring_rsp_wait>
+  8024ac:	8b 58 04             	mov    0x4(%eax),%ebx
+  8024af:	83 c4 10             	add    $0x10,%esp
+  8024b2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8024b6:	75 45                	jne    8024fd <fsring_rw+0x2a2>
+  8024b8:	85 db                	test   %ebx,%ebx
+  8024ba:	79 41                	jns    8024fd <fsring_rw+0x2a2>
+  8024bc:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8024bf:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8024c6:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8024cd:	83 ec 0c             	sub    $0xc,%esp
+  8024d0:	68 00 00 f0 cf       	push   $0xcff00000
+  8024d5:	e8 03 15 00 00       	call   8039dd <ipcring_rsp_pop>
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8024e3:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8024e8:	39 c2                	cmp    %eax,%edx
+  8024ea:	74 75                	je     802561 <fsring_rw+0x306>
+  8024ec:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8024f0:	75 a5                	jne    802497 <fsring_rw+0x23c>
+  8024f2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8024f5:	0f 82 50 ff ff ff    	jb     80244b <fsring_rw+0x1f0>
+  8024fb:	eb 9a                	jmp    802497 <fsring_rw+0x23c>
+  8024fd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802501:	75 ca                	jne    8024cd <fsring_rw+0x272>
+  802503:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802507:	74 31                	je     80253a <fsring_rw+0x2df>
+  802509:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80250f:	29 c8                	sub    %ecx,%eax
+  802511:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802514:	39 d0                	cmp    %edx,%eax
+  802516:	0f 47 c2             	cmova  %edx,%eax
+  802519:	39 d8                	cmp    %ebx,%eax
+  80251b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802520:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802524:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802527:	b8 01 00 00 00       	mov    $0x1,%eax
+  80252c:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802530:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802533:	01 d9                	add    %ebx,%ecx
+  802535:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802538:	eb 93                	jmp    8024cd <fsring_rw+0x272>
+  80253a:	83 ec 04             	sub    $0x4,%esp
+  80253d:	53                   	push   %ebx
+  80253e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802541:	83 e0 07             	and    $0x7,%eax
+  802544:	c1 e0 0c             	shl    $0xc,%eax
+  802547:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80254d:	50                   	push   %eax
+  80254e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802551:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802554:	01 c8                	add    %ecx,%eax
+  802556:	50                   	push   %eax
+  802557:	e8 33 e6 ff ff       	call   800b8f <memmove>
+  80255c:	83 c4 10             	add    $0x10,%esp
+  80255f:	eb a8                	jmp    802509 <fsring_rw+0x2ae>
+  802561:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802565:	75 09                	jne    802570 <fsring_rw+0x315>
+  802567:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80256a:	0f 82 db fe ff ff    	jb     80244b <fsring_rw+0x1f0>
+  802570:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802573:	01 57 04             	add    %edx,0x4(%edi)
+  802576:	85 d2                	test   %edx,%edx
+  802578:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80257c:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80257f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802585:	5b                   	pop    %ebx
+  802586:	5e                   	pop    %esi
+  802587:	5f                   	pop    %edi
+  802588:	5d                   	pop    %ebp
+  802589:	c3                   	ret
+
+0080258a <devfile_write>:
+  80258a:	55                   	push   %ebp
+  80258b:	89 e5                	mov    %esp,%ebp
+  80258d:	57                   	push   %edi
+  80258e:	56                   	push   %esi
+  80258f:	53                   	push   %ebx
+  802590:	83 ec 0c             	sub    $0xc,%esp
+  802593:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802596:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802599:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80259c:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8025a2:	76 1a                	jbe    8025be <devfile_write+0x34>
+  8025a4:	83 ec 0c             	sub    $0xc,%esp
+  8025a7:	53                   	push   %ebx
+  8025a8:	89 f1                	mov    %esi,%ecx
+  8025aa:	ba 06 00 00 00       	mov    $0x6,%edx
+  8025af:	89 f8                	mov    %edi,%eax
+  8025b1:	e8 a5 fc ff ff       	call   80225b <fsring_rw>
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8025bc:	75 39                	jne    8025f7 <devfile_write+0x6d>
+  8025be:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8025c3:	39 c3                	cmp    %eax,%ebx
+  8025c5:	0f 47 d8             	cmova  %eax,%ebx
+  8025c8:	8b 47 0c             	mov    0xc(%edi),%eax
+  8025cb:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025d0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8025d6:	83 ec 04             	sub    $0x4,%esp
+  8025d9:	53                   	push   %ebx
+  8025da:	56                   	push   %esi
+  8025db:	68 08 70 80 00       	push   $0x807008
+  8025e0:	e8 aa e5 ff ff       	call   800b8f <memmove>
+  8025e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ea:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025ef:	e8 7c fb ff ff       	call   802170 <fsipc>
+  8025f4:	83 c4 10             	add    $0x10,%esp
+  8025f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025fa:	5b                   	pop    %ebx
+  8025fb:	5e                   	pop    %esi
+  8025fc:	5f                   	pop    %edi
+  8025fd:	5d                   	pop    %ebp
+  8025fe:	c3                   	ret
+
+008025ff <devfile_read>:
+  8025ff:	55                   	push   %ebp
+  802600:	89 e5                	mov    %esp,%ebp
+  802602:	57                   	push   %edi
+  802603:	56                   	push   %esi
+  802604:	53                   	push   %ebx
+  802605:	83 ec 0c             	sub    $0xc,%esp
+  802608:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80260b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80260e:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802614:	76 1d                	jbe    802633 <devfile_read+0x34>
+  802616:	83 ec 0c             	sub    $0xc,%esp
+  802619:	56                   	push   %esi
+  80261a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80261d:	ba 05 00 00 00       	mov    $0x5,%edx
+  802622:	89 f8                	mov    %edi,%eax
+  802624:	e8 32 fc ff ff       	call   80225b <fsring_rw>
+  802629:	89 c3                	mov    %eax,%ebx
+  80262b:	83 c4 10             	add    $0x10,%esp
+  80262e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802631:	75 37                	jne    80266a <devfile_read+0x6b>
+  802633:	8b 47 0c             	mov    0xc(%edi),%eax
+  802636:	a3 00 70 80 00       	mov    %eax,0x807000
+  80263b:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802641:	ba 00 00 00 00       	mov    $0x0,%edx
+  802646:	b8 03 00 00 00       	mov    $0x3,%eax
+  80264b:	e8 20 fb ff ff       	call   802170 <fsipc>
+  802650:	89 c3                	mov    %eax,%ebx
+  802652:	85 c0                	test   %eax,%eax
+  802654:	78 14                	js     80266a <devfile_read+0x6b>
+  802656:	83 ec 04             	sub    $0x4,%esp
+  802659:	50                   	push   %eax
+  80265a:	68 00 70 80 00       	push   $0x807000
+  80265f:	ff 75 0c             	push   0xc(%ebp)
+  802662:	e8 28 e5 ff ff       	call   800b8f <memmove>
+  802667:	83 c4 10             	add    $0x10,%esp
+  80266a:	89 d8                	mov    %ebx,%eax
+  80266c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266f:	5b                   	pop    %ebx
+  802670:	5e                   	pop    %esi
+  802671:	5f                   	pop    %edi
+  802672:	5d                   	pop    %ebp
+  802673:	c3                   	ret
+
+00802674 <open>:
+  802674:	55                   	push   %ebp
+  802675:	89 e5                	mov    %esp,%ebp
+  802677:	56                   	push   %esi
+  802678:	53                   	push   %ebx
+  802679:	83 ec 1c             	sub    $0x1c,%esp
+  80267c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80267f:	56                   	push   %esi
+  802680:	e8 0e e3 ff ff       	call   800993 <strlen>
+  802685:	83 c4 10             	add    $0x10,%esp
+  802688:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80268d:	7f 6c                	jg     8026fb <open+0x87>
+  80268f:	83 ec 0c             	sub    $0xc,%esp
+  802692:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802695:	50                   	push   %eax
+  802696:	e8 6a f5 ff ff       	call   801c05 <fd_alloc>
+  80269b:	89 c3                	mov    %eax,%ebx
+  80269d:	83 c4 10             	add    $0x10,%esp
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	78 3c                	js     8026e0 <open+0x6c>
+  8026a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026a7:	a3 00 74 80 00       	mov    %eax,0x807400
+  8026ac:	83 ec 08             	sub    $0x8,%esp
+  8026af:	56                   	push   %esi
+  8026b0:	68 00 70 80 00       	push   $0x807000
+  8026b5:	e8 25 e3 ff ff       	call   8009df <strcpy>
+  8026ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026c2:	e8 a9 fa ff ff       	call   802170 <fsipc>
+  8026c7:	89 c3                	mov    %eax,%ebx
+  8026c9:	83 c4 10             	add    $0x10,%esp
+  8026cc:	85 c0                	test   %eax,%eax
+  8026ce:	78 19                	js     8026e9 <open+0x75>
+  8026d0:	83 ec 0c             	sub    $0xc,%esp
+  8026d3:	ff 75 f4             	push   -0xc(%ebp)
+  8026d6:	e8 03 f5 ff ff       	call   801bde <fd2num>
+  8026db:	89 c3                	mov    %eax,%ebx
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	89 d8                	mov    %ebx,%eax
+  8026e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e5:	5b                   	pop    %ebx
+  8026e6:	5e                   	pop    %esi
+  8026e7:	5d                   	pop    %ebp
+  8026e8:	c3                   	ret
+  8026e9:	83 ec 08             	sub    $0x8,%esp
+  8026ec:	6a 00                	push   $0x0
+  8026ee:	ff 75 f4             	push   -0xc(%ebp)
+  8026f1:	e8 05 f6 ff ff       	call   801cfb <fd_close>
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	eb e5                	jmp    8026e0 <open+0x6c>
+  8026fb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802700:	eb de                	jmp    8026e0 <open+0x6c>
+
+00802702 <file_image>:
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	53                   	push   %ebx
+  802706:	83 ec 1c             	sub    $0x1c,%esp
+  802709:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80270c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80270f:	50                   	push   %eax
+  802710:	ff 75 08             	push   0x8(%ebp)
+  802713:	e8 3d f5 ff ff       	call   801c55 <fd_lookup>
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	85 c0                	test   %eax,%eax
+  80271d:	78 58                	js     802777 <file_image+0x75>
+  80271f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802722:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  802728:	39 08                	cmp    %ecx,(%eax)
+  80272a:	75 50                	jne    80277c <file_image+0x7a>
+  80272c:	83 fb 04             	cmp    $0x4,%ebx
+  80272f:	77 52                	ja     802783 <file_image+0x81>
+  802731:	8b 40 0c             	mov    0xc(%eax),%eax
+  802734:	a3 00 70 80 00       	mov    %eax,0x807000
+  802739:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80273f:	83 ec 04             	sub    $0x4,%esp
+  802742:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802745:	c1 e0 02             	shl    $0x2,%eax
+  802748:	50                   	push   %eax
+  802749:	ff 75 0c             	push   0xc(%ebp)
+  80274c:	68 08 70 80 00       	push   $0x807008
+  802751:	e8 39 e4 ff ff       	call   800b8f <memmove>
+  802756:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802760:	e8 0b fa ff ff       	call   802170 <fsipc>
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	78 0b                	js     802777 <file_image+0x75>
+  80276c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80276f:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802775:	89 0a                	mov    %ecx,(%edx)
+  802777:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80277a:	c9                   	leave
+  80277b:	c3                   	ret
+  80277c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802781:	eb f4                	jmp    802777 <file_image+0x75>
+  802783:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802788:	eb ed                	jmp    802777 <file_image+0x75>
+
+0080278a <remove>:
+  80278a:	55                   	push   %ebp
+  80278b:	89 e5                	mov    %esp,%ebp
+  80278d:	53                   	push   %ebx
+  80278e:	83 ec 10             	sub    $0x10,%esp
+  802791:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802794:	53                   	push   %ebx
+  802795:	e8 f9 e1 ff ff       	call   800993 <strlen>
+  80279a:	83 c4 10             	add    $0x10,%esp
+  80279d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027a2:	7f 25                	jg     8027c9 <remove+0x3f>
+  8027a4:	83 ec 08             	sub    $0x8,%esp
+  8027a7:	53                   	push   %ebx
+  8027a8:	68 00 70 80 00       	push   $0x807000
+  8027ad:	e8 2d e2 ff ff       	call   8009df <strcpy>
+  8027b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8027bc:	e8 af f9 ff ff       	call   802170 <fsipc>
+  8027c1:	83 c4 10             	add    $0x10,%esp
+  8027c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027c7:	c9                   	leave
+  8027c8:	c3                   	ret
+  8027c9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8027ce:	eb f4                	jmp    8027c4 <remove+0x3a>
+
+008027d0 <sync>:
+  8027d0:	55                   	push   %ebp
+  8027d1:	89 e5                	mov    %esp,%ebp
+  8027d3:	83 ec 08             	sub    $0x8,%esp
+  8027d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027db:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8027e0:	e8 8b f9 ff ff       	call   802170 <fsipc>
+  8027e5:	c9                   	leave
+  8027e6:	c3                   	ret
+
+008027e7 <map_segment>:
+  8027e7:	55                   	push   %ebp
+  8027e8:	89 e5                	mov    %esp,%ebp
+  8027ea:	57                   	push   %edi
+  8027eb:	56                   	push   %esi
+  8027ec:	53                   	push   %ebx
+  8027ed:	83 ec 1c             	sub    $0x1c,%esp
+  8027f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027f3:	89 d7                	mov    %edx,%edi
+  8027f5:	89 d0                	mov    %edx,%eax
+  8027f7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8027fc:	74 0a                	je     802808 <map_segment+0x21>
+  8027fe:	29 c7                	sub    %eax,%edi
+  802800:	01 c1                	add    %eax,%ecx
+  802802:	01 45 0c             	add    %eax,0xc(%ebp)
+  802805:	29 45 10             	sub    %eax,0x10(%ebp)
+  802808:	85 c9                	test   %ecx,%ecx
+  80280a:	0f 84 fb 00 00 00    	je     80290b <map_segment+0x124>
+  802810:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802815:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802818:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80281b:	e9 a6 00 00 00       	jmp    8028c6 <map_segment+0xdf>
+  802820:	83 ec 04             	sub    $0x4,%esp
+  802823:	6a 07                	push   $0x7
+  802825:	68 00 00 40 00       	push   $0x400000
+  80282a:	6a 00                	push   $0x0
+  80282c:	e8 0e e6 ff ff       	call   800e3f <sys_page_alloc>
+  802831:	83 c4 10             	add    $0x10,%esp
+  802834:	85 c0                	test   %eax,%eax
+  802836:	0f 88 c7 00 00 00    	js     802903 <map_segment+0x11c>
+  80283c:	83 ec 08             	sub    $0x8,%esp
+  80283f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802842:	03 45 10             	add    0x10(%ebp),%eax
+  802845:	50                   	push   %eax
+  802846:	ff 75 08             	push   0x8(%ebp)
+  802849:	e8 c6 f7 ff ff       	call   802014 <seek>
+  80284e:	83 c4 10             	add    $0x10,%esp
+  802851:	85 c0                	test   %eax,%eax
+  802853:	0f 88 aa 00 00 00    	js     802903 <map_segment+0x11c>
+  802859:	83 ec 04             	sub    $0x4,%esp
+  80285c:	89 f2                	mov    %esi,%edx
+  80285e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802861:	29 ca                	sub    %ecx,%edx
+  802863:	89 d0                	mov    %edx,%eax
+  802865:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80286a:	39 d0                	cmp    %edx,%eax
+  80286c:	0f 47 c2             	cmova  %edx,%eax
+  80286f:	50                   	push   %eax
+  802870:	68 00 00 40 00       	push   $0x400000
+  802875:	ff 75 08             	push   0x8(%ebp)
+  802878:	e8 c1 f6 ff ff       	call   801f3e <readn>
+  80287d:	83 c4 10             	add    $0x10,%esp
+  802880:	85 c0                	test   %eax,%eax
+  802882:	78 7f                	js     802903 <map_segment+0x11c>
+  802884:	83 ec 0c             	sub    $0xc,%esp
+  802887:	ff 75 14             	push   0x14(%ebp)
+  80288a:	57                   	push   %edi
+  80288b:	ff 75 e0             	push   -0x20(%ebp)
+  80288e:	68 00 00 40 00       	push   $0x400000
+  802893:	6a 00                	push   $0x0
+  802895:	e8 e8 e5 ff ff       	call   800e82 <sys_page_map>
+  80289a:	83 c4 20             	add    $0x20,%esp
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 48                	js     8028e9 <map_segment+0x102>
+  8028a1:	83 ec 08             	sub    $0x8,%esp
+  8028a4:	68 00 00 40 00       	push   $0x400000
+  8028a9:	6a 00                	push   $0x0
+  8028ab:	e8 61 e6 ff ff       	call   800f11 <sys_page_unmap>
+  8028b0:	83 c4 10             	add    $0x10,%esp
+  8028b3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8028b9:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8028bf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8028c2:	39 c3                	cmp    %eax,%ebx
+  8028c4:	73 38                	jae    8028fe <map_segment+0x117>
+  8028c6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8028c9:	39 f3                	cmp    %esi,%ebx
+  8028cb:	0f 82 4f ff ff ff    	jb     802820 <map_segment+0x39>
+  8028d1:	83 ec 04             	sub    $0x4,%esp
+  8028d4:	ff 75 14             	push   0x14(%ebp)
+  8028d7:	57                   	push   %edi
+  8028d8:	ff 75 e0             	push   -0x20(%ebp)
+  8028db:	e8 5f e5 ff ff       	call   800e3f <sys_page_alloc>
+  8028e0:	83 c4 10             	add    $0x10,%esp
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	79 cc                	jns    8028b3 <map_segment+0xcc>
+  8028e7:	eb 1a                	jmp    802903 <map_segment+0x11c>
+  8028e9:	50                   	push   %eax
+  8028ea:	68 50 47 80 00       	push   $0x804750
+  8028ef:	68 75 01 00 00       	push   $0x175
+  8028f4:	68 6d 47 80 00       	push   $0x80476d
+  8028f9:	e8 0f d9 ff ff       	call   80020d <_panic>
+  8028fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802906:	5b                   	pop    %ebx
+  802907:	5e                   	pop    %esi
+  802908:	5f                   	pop    %edi
+  802909:	5d                   	pop    %ebp
+  80290a:	c3                   	ret
+  80290b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802910:	eb f1                	jmp    802903 <map_segment+0x11c>
+
+00802912 <execv>:
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	57                   	push   %edi
+  802916:	56                   	push   %esi
+  802917:	53                   	push   %ebx
+  802918:	81 ec d4 02 00 00    	sub    $0x2d4,%esp
+  80291e:	6a 00                	push   $0x0
+  802920:	ff 75 08             	push   0x8(%ebp)
+  802923:	e8 4c fd ff ff       	call   802674 <open>
+  802928:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80292e:	83 c4 10             	add    $0x10,%esp
+  802931:	85 c0                	test   %eax,%eax
+  802933:	0f 88 ea 05 00 00    	js     802f23 <execv+0x611>
+  802939:	89 c6                	mov    %eax,%esi
+  80293b:	83 ec 04             	sub    $0x4,%esp
+  80293e:	68 00 02 00 00       	push   $0x200
+  802943:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802949:	50                   	push   %eax
+  80294a:	56                   	push   %esi
+  80294b:	e8 ee f5 ff ff       	call   801f3e <readn>
+  802950:	83 c4 10             	add    $0x10,%esp
+  802953:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802958:	0f 85 e1 01 00 00    	jne    802b3f <execv+0x22d>
+  80295e:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802965:	45 4c 46 
+  802968:	0f 85 d1 01 00 00    	jne    802b3f <execv+0x22d>
+  80296e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802973:	cd 30                	int    $0x30
+  802975:	89 85 40 fd ff ff    	mov    %eax,-0x2c0(%ebp)
+  80297b:	85 c0                	test   %eax,%eax
+  80297d:	0f 88 94 05 00 00    	js     802f17 <execv+0x605>
+  802983:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802988:	69 f0 ac 01 00 00    	imul   $0x1ac,%eax,%esi
+  80298e:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802994:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80299a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80299f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8029a1:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8029a7:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  8029ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029b0:	8b 00                	mov    (%eax),%eax
+  8029b2:	85 c0                	test   %eax,%eax
+  8029b4:	0f 84 ad 05 00 00    	je     802f67 <execv+0x655>
+  8029ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029c7:	83 ec 0c             	sub    $0xc,%esp
+  8029ca:	50                   	push   %eax
+  8029cb:	e8 c3 df ff ff       	call   800993 <strlen>
+  8029d0:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  8029d4:	89 d9                	mov    %ebx,%ecx
+  8029d6:	83 c3 01             	add    $0x1,%ebx
+  8029d9:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%ebp)
+  8029df:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  8029e6:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8029e9:	83 c4 10             	add    $0x10,%esp
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	75 d7                	jne    8029c7 <execv+0xb5>
+  8029f0:	89 95 2c fd ff ff    	mov    %edx,-0x2d4(%ebp)
+  8029f6:	89 8d 30 fd ff ff    	mov    %ecx,-0x2d0(%ebp)
+  8029fc:	be 00 10 40 00       	mov    $0x401000,%esi
+  802a01:	29 fe                	sub    %edi,%esi
+  802a03:	89 f2                	mov    %esi,%edx
+  802a05:	83 e2 fc             	and    $0xfffffffc,%edx
+  802a08:	8d 04 8d 08 00 00 00 	lea    0x8(,%ecx,4),%eax
+  802a0f:	89 d7                	mov    %edx,%edi
+  802a11:	29 c7                	sub    %eax,%edi
+  802a13:	8d 47 f8             	lea    -0x8(%edi),%eax
+  802a16:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802a1b:	0f 86 1f 05 00 00    	jbe    802f40 <execv+0x62e>
+  802a21:	83 ec 04             	sub    $0x4,%esp
+  802a24:	6a 07                	push   $0x7
+  802a26:	68 00 00 40 00       	push   $0x400000
+  802a2b:	6a 00                	push   $0x0
+  802a2d:	e8 0d e4 ff ff       	call   800e3f <sys_page_alloc>
+  802a32:	83 c4 10             	add    $0x10,%esp
+  802a35:	85 c0                	test   %eax,%eax
+  802a37:	0f 88 08 05 00 00    	js     802f45 <execv+0x633>
+  802a3d:	85 db                	test   %ebx,%ebx
+  802a3f:	7e 58                	jle    802a99 <execv+0x187>
+  802a41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a46:	89 bd 34 fd ff ff    	mov    %edi,-0x2cc(%ebp)
+  802a4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802a4f:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+  802a55:	8d 86 00 d0 3f ee    	lea    -0x11c03000(%esi),%eax
+  802a5b:	8b 8d 34 fd ff ff    	mov    -0x2cc(%ebp),%ecx
+  802a61:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+  802a64:	83 ec 08             	sub    $0x8,%esp
+  802a67:	ff 34 9f             	push   (%edi,%ebx,4)
+  802a6a:	56                   	push   %esi
+  802a6b:	e8 6f df ff ff       	call   8009df <strcpy>
+  802a70:	83 c4 04             	add    $0x4,%esp
+  802a73:	ff 34 9f             	push   (%edi,%ebx,4)
+  802a76:	e8 18 df ff ff       	call   800993 <strlen>
+  802a7b:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  802a7f:	83 c3 01             	add    $0x1,%ebx
+  802a82:	83 c4 10             	add    $0x10,%esp
+  802a85:	8b 8d 3c fd ff ff    	mov    -0x2c4(%ebp),%ecx
+  802a8b:	39 8d 30 fd ff ff    	cmp    %ecx,-0x2d0(%ebp)
+  802a91:	75 bc                	jne    802a4f <execv+0x13d>
+  802a93:	8b bd 34 fd ff ff    	mov    -0x2cc(%ebp),%edi
+  802a99:	8b 85 2c fd ff ff    	mov    -0x2d4(%ebp),%eax
+  802a9f:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+  802aa6:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  802aac:	0f 85 c5 00 00 00    	jne    802b77 <execv+0x265>
+  802ab2:	8d 87 00 d0 3f ee    	lea    -0x11c03000(%edi),%eax
+  802ab8:	89 47 fc             	mov    %eax,-0x4(%edi)
+  802abb:	8b 85 38 fd ff ff    	mov    -0x2c8(%ebp),%eax
+  802ac1:	89 47 f8             	mov    %eax,-0x8(%edi)
+  802ac4:	8d 87 f8 cf 3f ee    	lea    -0x11c03008(%edi),%eax
+  802aca:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  802ad0:	83 ec 0c             	sub    $0xc,%esp
+  802ad3:	6a 07                	push   $0x7
+  802ad5:	68 00 d0 7f ee       	push   $0xee7fd000
+  802ada:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802ae0:	68 00 00 40 00       	push   $0x400000
+  802ae5:	6a 00                	push   $0x0
+  802ae7:	e8 96 e3 ff ff       	call   800e82 <sys_page_map>
+  802aec:	89 c3                	mov    %eax,%ebx
+  802aee:	83 c4 20             	add    $0x20,%esp
+  802af1:	85 c0                	test   %eax,%eax
+  802af3:	0f 88 54 04 00 00    	js     802f4d <execv+0x63b>
+  802af9:	83 ec 08             	sub    $0x8,%esp
+  802afc:	68 00 00 40 00       	push   $0x400000
+  802b01:	6a 00                	push   $0x0
+  802b03:	e8 09 e4 ff ff       	call   800f11 <sys_page_unmap>
+  802b08:	89 c3                	mov    %eax,%ebx
+  802b0a:	83 c4 10             	add    $0x10,%esp
+  802b0d:	85 c0                	test   %eax,%eax
+  802b0f:	0f 88 38 04 00 00    	js     802f4d <execv+0x63b>
+  802b15:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802b1b:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+  802b22:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  802b29:	00 
+  802b2a:	0f 84 01 04 00 00    	je     802f31 <execv+0x61f>
+  802b30:	be 00 00 00 00       	mov    $0x0,%esi
+  802b35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3a:	e9 88 00 00 00       	jmp    802bc7 <execv+0x2b5>
+  802b3f:	83 ec 0c             	sub    $0xc,%esp
+  802b42:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802b48:	e8 2e f2 ff ff       	call   801d7b <close>
+  802b4d:	83 c4 0c             	add    $0xc,%esp
+  802b50:	68 7f 45 4c 46       	push   $0x464c457f
+  802b55:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802b5b:	68 79 47 80 00       	push   $0x804779
+  802b60:	e8 83 d7 ff ff       	call   8002e8 <cprintf>
+  802b65:	83 c4 10             	add    $0x10,%esp
+  802b68:	c7 85 44 fd ff ff f2 	movl   $0xfffffff2,-0x2bc(%ebp)
+  802b6f:	ff ff ff 
+  802b72:	e9 ac 03 00 00       	jmp    802f23 <execv+0x611>
+  802b77:	68 00 48 80 00       	push   $0x804800
+  802b7c:	68 93 47 80 00       	push   $0x804793
+  802b81:	68 41 01 00 00       	push   $0x141
+  802b86:	68 6d 47 80 00       	push   $0x80476d
+  802b8b:	e8 7d d6 ff ff       	call   80020d <_panic>
+  802b90:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  802b93:	50                   	push   %eax
+  802b94:	ff 73 04             	push   0x4(%ebx)
+  802b97:	ff 73 10             	push   0x10(%ebx)
+  802b9a:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802ba0:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802ba6:	e8 3c fc ff ff       	call   8027e7 <map_segment>
+  802bab:	83 c4 10             	add    $0x10,%esp
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	0f 88 34 03 00 00    	js     802eea <execv+0x5d8>
+  802bb6:	83 c7 01             	add    $0x1,%edi
+  802bb9:	83 c3 20             	add    $0x20,%ebx
+  802bbc:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802bc3:	39 f8                	cmp    %edi,%eax
+  802bc5:	7e 5d                	jle    802c24 <execv+0x312>
+  802bc7:	83 3b 01             	cmpl   $0x1,(%ebx)
+  802bca:	75 ea                	jne    802bb6 <execv+0x2a4>
+  802bcc:	8b 43 18             	mov    0x18(%ebx),%eax
+  802bcf:	83 e0 02             	and    $0x2,%eax
+  802bd2:	83 f8 01             	cmp    $0x1,%eax
+  802bd5:	19 c0                	sbb    %eax,%eax
+  802bd7:	83 e0 fe             	and    $0xfffffffe,%eax
+  802bda:	83 c0 07             	add    $0x7,%eax
+  802bdd:	8b 53 08             	mov    0x8(%ebx),%edx
+  802be0:	81 fa ff ff 7f 00    	cmp    $0x7fffff,%edx
+  802be6:	76 a8                	jbe    802b90 <execv+0x27e>
+  802be8:	83 fe 03             	cmp    $0x3,%esi
+  802beb:	7f a3                	jg     802b90 <execv+0x27e>
+  802bed:	8d 0c b6             	lea    (%esi,%esi,4),%ecx
+  802bf0:	c1 e1 02             	shl    $0x2,%ecx
+  802bf3:	89 94 0d 54 fd ff ff 	mov    %edx,-0x2ac(%ebp,%ecx,1)
+  802bfa:	8b 53 14             	mov    0x14(%ebx),%edx
+  802bfd:	89 94 0d 58 fd ff ff 	mov    %edx,-0x2a8(%ebp,%ecx,1)
+  802c04:	8b 53 10             	mov    0x10(%ebx),%edx
+  802c07:	89 94 0d 5c fd ff ff 	mov    %edx,-0x2a4(%ebp,%ecx,1)
+  802c0e:	8b 53 04             	mov    0x4(%ebx),%edx
+  802c11:	89 94 0d 60 fd ff ff 	mov    %edx,-0x2a0(%ebp,%ecx,1)
+  802c18:	89 84 0d 64 fd ff ff 	mov    %eax,-0x29c(%ebp,%ecx,1)
+  802c1f:	83 c6 01             	add    $0x1,%esi
+  802c22:	eb 92                	jmp    802bb6 <execv+0x2a4>
+  802c24:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802c2b:	00 00 00 
+  802c2e:	85 f6                	test   %esi,%esi
+  802c30:	7f 12                	jg     802c44 <execv+0x332>
+  802c32:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802c38:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  802c3f:	00 00 00 
+  802c42:	eb 7e                	jmp    802cc2 <execv+0x3b0>
+  802c44:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  802c4a:	50                   	push   %eax
+  802c4b:	56                   	push   %esi
+  802c4c:	8d 85 54 fd ff ff    	lea    -0x2ac(%ebp),%eax
+  802c52:	50                   	push   %eax
+  802c53:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802c59:	e8 a4 fa ff ff       	call   802702 <file_image>
+  802c5e:	89 85 3c fd ff ff    	mov    %eax,-0x2c4(%ebp)
+  802c64:	83 c4 10             	add    $0x10,%esp
+  802c67:	85 c0                	test   %eax,%eax
+  802c69:	0f 88 9e 00 00 00    	js     802d0d <execv+0x3fb>
+  802c6f:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802c75:	85 c0                	test   %eax,%eax
+  802c77:	75 49                	jne    802cc2 <execv+0x3b0>
+  802c79:	8d 9d 54 fd ff ff    	lea    -0x2ac(%ebp),%ebx
+  802c7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c84:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  802c87:	8b 13                	mov    (%ebx),%edx
+  802c89:	ff 73 10             	push   0x10(%ebx)
+  802c8c:	ff 73 0c             	push   0xc(%ebx)
+  802c8f:	ff 73 08             	push   0x8(%ebx)
+  802c92:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802c98:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802c9e:	e8 44 fb ff ff       	call   8027e7 <map_segment>
+  802ca3:	83 c4 10             	add    $0x10,%esp
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	0f 88 65 02 00 00    	js     802f13 <execv+0x601>
+  802cae:	83 c7 01             	add    $0x1,%edi
+  802cb1:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802cb7:	83 c3 14             	add    $0x14,%ebx
+  802cba:	39 fe                	cmp    %edi,%esi
+  802cbc:	7e 04                	jle    802cc2 <execv+0x3b0>
+  802cbe:	85 c0                	test   %eax,%eax
+  802cc0:	74 c2                	je     802c84 <execv+0x372>
+  802cc2:	83 ec 04             	sub    $0x4,%esp
+  802cc5:	ff b5 3c fd ff ff    	push   -0x2c4(%ebp)
+  802ccb:	50                   	push   %eax
+  802ccc:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802cd2:	e8 51 e9 ff ff       	call   801628 <sys_env_set_pager>
+  802cd7:	89 c7                	mov    %eax,%edi
+  802cd9:	83 c4 10             	add    $0x10,%esp
+  802cdc:	85 c0                	test   %eax,%eax
+  802cde:	0f 88 08 02 00 00    	js     802eec <execv+0x5da>
+  802ce4:	83 ec 0c             	sub    $0xc,%esp
+  802ce7:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802ced:	e8 89 f0 ff ff       	call   801d7b <close>
+  802cf2:	e8 ef ea ff ff       	call   8017e6 <dupq_begin>
+  802cf7:	89 c7                	mov    %eax,%edi
+  802cf9:	83 c4 10             	add    $0x10,%esp
+  802cfc:	89 c1                	mov    %eax,%ecx
+  802cfe:	85 c0                	test   %eax,%eax
+  802d00:	0f 88 91 00 00 00    	js     802d97 <execv+0x485>
+  802d06:	be 02 00 00 00       	mov    $0x2,%esi
+  802d0b:	eb 33                	jmp    802d40 <execv+0x42e>
+  802d0d:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802d14:	00 00 00 
+  802d17:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  802d1e:	00 00 00 
+  802d21:	e9 53 ff ff ff       	jmp    802c79 <execv+0x367>
+  802d26:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802d2d:	a8 01                	test   $0x1,%al
+  802d2f:	75 7b                	jne    802dac <execv+0x49a>
+  802d31:	83 c6 01             	add    $0x1,%esi
+  802d34:	81 fe ba 03 00 00    	cmp    $0x3ba,%esi
+  802d3a:	0f 84 e5 00 00 00    	je     802e25 <execv+0x513>
+  802d40:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802d47:	a8 01                	test   $0x1,%al
+  802d49:	74 db                	je     802d26 <execv+0x414>
+  802d4b:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802d52:	a8 80                	test   $0x80,%al
+  802d54:	74 d0                	je     802d26 <execv+0x414>
+  802d56:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802d5d:	f6 c4 04             	test   $0x4,%ah
+  802d60:	74 cf                	je     802d31 <execv+0x41f>
+  802d62:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802d69:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d6e:	0c 80                	or     $0x80,%al
+  802d70:	50                   	push   %eax
+  802d71:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802d77:	89 f0                	mov    %esi,%eax
+  802d79:	c1 e0 16             	shl    $0x16,%eax
+  802d7c:	c1 e8 0c             	shr    $0xc,%eax
+  802d7f:	50                   	push   %eax
+  802d80:	6a 00                	push   $0x0
+  802d82:	e8 7f ea ff ff       	call   801806 <dupq_map>
+  802d87:	89 c1                	mov    %eax,%ecx
+  802d89:	83 c4 10             	add    $0x10,%esp
+  802d8c:	85 c0                	test   %eax,%eax
+  802d8e:	79 a1                	jns    802d31 <execv+0x41f>
+  802d90:	89 c7                	mov    %eax,%edi
+  802d92:	e8 d2 ea ff ff       	call   801869 <dupq_end>
+  802d97:	57                   	push   %edi
+  802d98:	68 a8 47 80 00       	push   $0x8047a8
+  802d9d:	68 ac 00 00 00       	push   $0xac
+  802da2:	68 6d 47 80 00       	push   $0x80476d
+  802da7:	e8 61 d4 ff ff       	call   80020d <_panic>
+  802dac:	89 f7                	mov    %esi,%edi
+  802dae:	c1 e7 16             	shl    $0x16,%edi
+  802db1:	89 f8                	mov    %edi,%eax
+  802db3:	c1 e8 0c             	shr    $0xc,%eax
+  802db6:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802dbb:	eb 24                	jmp    802de1 <execv+0x4cf>
+  802dbd:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  802dc3:	0f 84 68 ff ff ff    	je     802d31 <execv+0x41f>
+  802dc9:	89 d8                	mov    %ebx,%eax
+  802dcb:	09 f8                	or     %edi,%eax
+  802dcd:	c1 e8 0c             	shr    $0xc,%eax
+  802dd0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802dd6:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  802ddb:	0f 84 50 ff ff ff    	je     802d31 <execv+0x41f>
+  802de1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802de8:	f6 c2 01             	test   $0x1,%dl
+  802deb:	74 d0                	je     802dbd <execv+0x4ab>
+  802ded:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802df4:	f6 c6 04             	test   $0x4,%dh
+  802df7:	74 c4                	je     802dbd <execv+0x4ab>
+  802df9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802e00:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  802e06:	52                   	push   %edx
+  802e07:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802e0d:	50                   	push   %eax
+  802e0e:	6a 00                	push   $0x0
+  802e10:	e8 f1 e9 ff ff       	call   801806 <dupq_map>
+  802e15:	89 c1                	mov    %eax,%ecx
+  802e17:	83 c4 10             	add    $0x10,%esp
+  802e1a:	85 c0                	test   %eax,%eax
+  802e1c:	79 9f                	jns    802dbd <execv+0x4ab>
+  802e1e:	89 c7                	mov    %eax,%edi
+  802e20:	e9 6d ff ff ff       	jmp    802d92 <execv+0x480>
+  802e25:	89 cf                	mov    %ecx,%edi
+  802e27:	85 c9                	test   %ecx,%ecx
+  802e29:	0f 88 63 ff ff ff    	js     802d92 <execv+0x480>
+  802e2f:	e8 35 ea ff ff       	call   801869 <dupq_end>
+  802e34:	89 c7                	mov    %eax,%edi
+  802e36:	85 c0                	test   %eax,%eax
+  802e38:	0f 88 59 ff ff ff    	js     802d97 <execv+0x485>
+  802e3e:	83 ec 08             	sub    $0x8,%esp
+  802e41:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802e47:	50                   	push   %eax
+  802e48:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802e4e:	e8 61 e1 ff ff       	call   800fb4 <sys_env_set_trapframe>
+  802e53:	83 c4 10             	add    $0x10,%esp
+  802e56:	85 c0                	test   %eax,%eax
+  802e58:	78 2e                	js     802e88 <execv+0x576>
+  802e5a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e5e:	74 52                	je     802eb2 <execv+0x5a0>
+  802e60:	83 ec 08             	sub    $0x8,%esp
+  802e63:	6a 02                	push   $0x2
+  802e65:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802e6b:	e8 02 e1 ff ff       	call   800f72 <sys_env_set_status>
+  802e70:	83 c4 10             	add    $0x10,%esp
+  802e73:	85 c0                	test   %eax,%eax
+  802e75:	78 26                	js     802e9d <execv+0x58b>
+  802e77:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802e7d:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802e83:	e9 9b 00 00 00       	jmp    802f23 <execv+0x611>
+  802e88:	50                   	push   %eax
+  802e89:	68 be 47 80 00       	push   $0x8047be
+  802e8e:	68 af 00 00 00       	push   $0xaf
+  802e93:	68 6d 47 80 00       	push   $0x80476d
+  802e98:	e8 70 d3 ff ff       	call   80020d <_panic>
+  802e9d:	50                   	push   %eax
+  802e9e:	68 d8 47 80 00       	push   $0x8047d8
+  802ea3:	68 b3 00 00 00       	push   $0xb3
+  802ea8:	68 6d 47 80 00       	push   $0x80476d
+  802ead:	e8 5b d3 ff ff       	call   80020d <_panic>
+  802eb2:	83 ec 0c             	sub    $0xc,%esp
+  802eb5:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802ebb:	e8 92 e3 ff ff       	call   801252 <sys_env_swap>
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	78 0e                	js     802ed5 <execv+0x5c3>
+  802ec7:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802ecd:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802ed3:	eb 4e                	jmp    802f23 <execv+0x611>
+  802ed5:	50                   	push   %eax
+  802ed6:	68 ef 47 80 00       	push   $0x8047ef
+  802edb:	68 ba 00 00 00       	push   $0xba
+  802ee0:	68 6d 47 80 00       	push   $0x80476d
+  802ee5:	e8 23 d3 ff ff       	call   80020d <_panic>
+  802eea:	89 c7                	mov    %eax,%edi
+  802eec:	83 ec 0c             	sub    $0xc,%esp
+  802eef:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802ef5:	e8 9a de ff ff       	call   800d94 <sys_env_destroy>
+  802efa:	83 c4 04             	add    $0x4,%esp
+  802efd:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802f03:	e8 73 ee ff ff       	call   801d7b <close>
+  802f08:	83 c4 10             	add    $0x10,%esp
+  802f0b:	89 bd 44 fd ff ff    	mov    %edi,-0x2bc(%ebp)
+  802f11:	eb 10                	jmp    802f23 <execv+0x611>
+  802f13:	89 c7                	mov    %eax,%edi
+  802f15:	eb d5                	jmp    802eec <execv+0x5da>
+  802f17:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802f1d:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802f23:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  802f29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f2c:	5b                   	pop    %ebx
+  802f2d:	5e                   	pop    %esi
+  802f2e:	5f                   	pop    %edi
+  802f2f:	5d                   	pop    %ebp
+  802f30:	c3                   	ret
+  802f31:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802f38:	00 00 00 
+  802f3b:	e9 f2 fc ff ff       	jmp    802c32 <execv+0x320>
+  802f40:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802f45:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802f4b:	eb d6                	jmp    802f23 <execv+0x611>
+  802f4d:	83 ec 08             	sub    $0x8,%esp
+  802f50:	68 00 00 40 00       	push   $0x400000
+  802f55:	6a 00                	push   $0x0
+  802f57:	e8 b5 df ff ff       	call   800f11 <sys_page_unmap>
+  802f5c:	83 c4 10             	add    $0x10,%esp
+  802f5f:	89 9d 44 fd ff ff    	mov    %ebx,-0x2bc(%ebp)
+  802f65:	eb bc                	jmp    802f23 <execv+0x611>
+  802f67:	83 ec 04             	sub    $0x4,%esp
+  802f6a:	6a 07                	push   $0x7
+  802f6c:	68 00 00 40 00       	push   $0x400000
+  802f71:	6a 00                	push   $0x0
+  802f73:	e8 c7 de ff ff       	call   800e3f <sys_page_alloc>
+  802f78:	83 c4 10             	add    $0x10,%esp
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	78 c6                	js     802f45 <execv+0x633>
+  802f7f:	c7 85 2c fd ff ff 00 	movl   $0x0,-0x2d4(%ebp)
+  802f86:	00 00 00 
+  802f89:	c7 85 38 fd ff ff 00 	movl   $0x0,-0x2c8(%ebp)
+  802f90:	00 00 00 
+  802f93:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+  802f98:	be 00 10 40 00       	mov    $0x401000,%esi
+  802f9d:	e9 f7 fa ff ff       	jmp    802a99 <execv+0x187>
+
+00802fa2 <spawn>:
+  802fa2:	55                   	push   %ebp
+  802fa3:	89 e5                	mov    %esp,%ebp
+  802fa5:	83 ec 0c             	sub    $0xc,%esp
+  802fa8:	6a 01                	push   $0x1
+  802faa:	ff 75 0c             	push   0xc(%ebp)
+  802fad:	ff 75 08             	push   0x8(%ebp)
+  802fb0:	e8 5d f9 ff ff       	call   802912 <execv>
+  802fb5:	c9                   	leave
+  802fb6:	c3                   	ret
+
+00802fb7 <exec>:
+  802fb7:	55                   	push   %ebp
+  802fb8:	89 e5                	mov    %esp,%ebp
+  802fba:	83 ec 0c             	sub    $0xc,%esp
+  802fbd:	6a 00                	push   $0x0
+  802fbf:	ff 75 0c             	push   0xc(%ebp)
+  802fc2:	ff 75 08             	push   0x8(%ebp)
+  802fc5:	e8 48 f9 ff ff       	call   802912 <execv>
+  802fca:	c9                   	leave
+  802fcb:	c3                   	ret
+
+00802fcc <spawnl>:
+  802fcc:	55                   	push   %ebp
+  802fcd:	89 e5                	mov    %esp,%ebp
+  802fcf:	56                   	push   %esi
+  802fd0:	53                   	push   %ebx
+  802fd1:	8d 45 10             	lea    0x10(%ebp),%eax
+  802fd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fd9:	eb 05                	jmp    802fe0 <spawnl+0x14>
+  802fdb:	83 c1 01             	add    $0x1,%ecx
+  802fde:	89 d0                	mov    %edx,%eax
+  802fe0:	8d 50 04             	lea    0x4(%eax),%edx
+  802fe3:	83 38 00             	cmpl   $0x0,(%eax)
+  802fe6:	75 f3                	jne    802fdb <spawnl+0xf>
+  802fe8:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802fef:	83 e0 f0             	and    $0xfffffff0,%eax
+  802ff2:	29 c4                	sub    %eax,%esp
+  802ff4:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802ff8:	89 d8                	mov    %ebx,%eax
+  802ffa:	c1 e8 02             	shr    $0x2,%eax
+  802ffd:	83 e3 fc             	and    $0xfffffffc,%ebx
+  803000:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803003:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  80300a:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  803011:	00 
+  803012:	8d 55 10             	lea    0x10(%ebp),%edx
+  803015:	89 ce                	mov    %ecx,%esi
+  803017:	85 c9                	test   %ecx,%ecx
+  803019:	74 16                	je     803031 <spawnl+0x65>
+  80301b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803020:	83 c0 01             	add    $0x1,%eax
+  803023:	89 d1                	mov    %edx,%ecx
+  803025:	83 c2 04             	add    $0x4,%edx
+  803028:	8b 09                	mov    (%ecx),%ecx
+  80302a:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  80302d:	39 f0                	cmp    %esi,%eax
+  80302f:	75 ef                	jne    803020 <spawnl+0x54>
+  803031:	83 ec 08             	sub    $0x8,%esp
+  803034:	53                   	push   %ebx
+  803035:	ff 75 08             	push   0x8(%ebp)
+  803038:	e8 65 ff ff ff       	call   802fa2 <spawn>
+  80303d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803040:	5b                   	pop    %ebx
+  803041:	5e                   	pop    %esi
+  803042:	5d                   	pop    %ebp
+  803043:	c3                   	ret
+
+00803044 <execl>:
+  803044:	55                   	push   %ebp
+  803045:	89 e5                	mov    %esp,%ebp
+  803047:	56                   	push   %esi
+  803048:	53                   	push   %ebx
+  803049:	8d 45 10             	lea    0x10(%ebp),%eax
+  80304c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803051:	eb 05                	jmp    803058 <execl+0x14>
+  803053:	83 c1 01             	add    $0x1,%ecx
+  803056:	89 d0                	mov    %edx,%eax
+  803058:	8d 50 04             	lea    0x4(%eax),%edx
+  80305b:	83 38 00             	cmpl   $0x0,(%eax)
+  80305e:	75 f3                	jne    803053 <execl+0xf>
+  803060:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  803067:	83 e0 f0             	and    $0xfffffff0,%eax
+  80306a:	29 c4                	sub    %eax,%esp
+  80306c:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803070:	89 d8                	mov    %ebx,%eax
+  803072:	c1 e8 02             	shr    $0x2,%eax
+  803075:	83 e3 fc             	and    $0xfffffffc,%ebx
+  803078:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80307b:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  803082:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  803089:	00 
+  80308a:	8d 55 10             	lea    0x10(%ebp),%edx
+  80308d:	89 ce                	mov    %ecx,%esi
+  80308f:	85 c9                	test   %ecx,%ecx
+  803091:	74 16                	je     8030a9 <execl+0x65>
+  803093:	b8 00 00 00 00       	mov    $0x0,%eax
+  803098:	83 c0 01             	add    $0x1,%eax
+  80309b:	89 d1                	mov    %edx,%ecx
+  80309d:	83 c2 04             	add    $0x4,%edx
+  8030a0:	8b 09                	mov    (%ecx),%ecx
+  8030a2:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  8030a5:	39 f0                	cmp    %esi,%eax
+  8030a7:	75 ef                	jne    803098 <execl+0x54>
+  8030a9:	83 ec 08             	sub    $0x8,%esp
+  8030ac:	53                   	push   %ebx
+  8030ad:	ff 75 08             	push   0x8(%ebp)
+  8030b0:	e8 02 ff ff ff       	call   802fb7 <exec>
+  8030b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030b8:	5b                   	pop    %ebx
+  8030b9:	5e                   	pop    %esi
+  8030ba:	5d                   	pop    %ebp
+  8030bb:	c3                   	ret
+
+008030bc <devsock_stat>:
+  8030bc:	55                   	push   %ebp
+  8030bd:	89 e5                	mov    %esp,%ebp
+  8030bf:	83 ec 10             	sub    $0x10,%esp
+  8030c2:	68 26 48 80 00       	push   $0x804826
+  8030c7:	ff 75 0c             	push   0xc(%ebp)
+  8030ca:	e8 10 d9 ff ff       	call   8009df <strcpy>
+  8030cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d4:	c9                   	leave
+  8030d5:	c3                   	ret
+
+008030d6 <devsock_close>:
+  8030d6:	55                   	push   %ebp
+  8030d7:	89 e5                	mov    %esp,%ebp
+  8030d9:	53                   	push   %ebx
+  8030da:	83 ec 10             	sub    $0x10,%esp
+  8030dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8030e0:	53                   	push   %ebx
+  8030e1:	e8 9e 0e 00 00       	call   803f84 <pageref>
+  8030e6:	89 c2                	mov    %eax,%edx
+  8030e8:	83 c4 10             	add    $0x10,%esp
+  8030eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f0:	83 fa 01             	cmp    $0x1,%edx
+  8030f3:	74 05                	je     8030fa <devsock_close+0x24>
+  8030f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f8:	c9                   	leave
+  8030f9:	c3                   	ret
+  8030fa:	83 ec 0c             	sub    $0xc,%esp
+  8030fd:	ff 73 0c             	push   0xc(%ebx)
+  803100:	e8 aa 02 00 00       	call   8033af <nsipc_close>
+  803105:	83 c4 10             	add    $0x10,%esp
+  803108:	eb eb                	jmp    8030f5 <devsock_close+0x1f>
+
+0080310a <devsock_write>:
+  80310a:	55                   	push   %ebp
+  80310b:	89 e5                	mov    %esp,%ebp
+  80310d:	83 ec 08             	sub    $0x8,%esp
+  803110:	6a 00                	push   $0x0
+  803112:	ff 75 10             	push   0x10(%ebp)
+  803115:	ff 75 0c             	push   0xc(%ebp)
+  803118:	8b 45 08             	mov    0x8(%ebp),%eax
+  80311b:	ff 70 0c             	push   0xc(%eax)
+  80311e:	e8 6c 03 00 00       	call   80348f <nsipc_send>
+  803123:	c9                   	leave
+  803124:	c3                   	ret
+
+00803125 <devsock_read>:
+  803125:	55                   	push   %ebp
+  803126:	89 e5                	mov    %esp,%ebp
+  803128:	83 ec 08             	sub    $0x8,%esp
+  80312b:	6a 00                	push   $0x0
+  80312d:	ff 75 10             	push   0x10(%ebp)
+  803130:	ff 75 0c             	push   0xc(%ebp)
+  803133:	8b 45 08             	mov    0x8(%ebp),%eax
+  803136:	ff 70 0c             	push   0xc(%eax)
+  803139:	e8 e2 02 00 00       	call   803420 <nsipc_recv>
+  80313e:	c9                   	leave
+  80313f:	c3                   	ret
+
+00803140 <fd2sockid>:
+  803140:	55                   	push   %ebp
+  803141:	89 e5                	mov    %esp,%ebp
+  803143:	83 ec 20             	sub    $0x20,%esp
+  803146:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803149:	52                   	push   %edx
+  80314a:	50                   	push   %eax
+  80314b:	e8 05 eb ff ff       	call   801c55 <fd_lookup>
+  803150:	83 c4 10             	add    $0x10,%esp
+  803153:	85 c0                	test   %eax,%eax
+  803155:	78 10                	js     803167 <fd2sockid+0x27>
+  803157:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80315a:	8b 0d 28 50 80 00    	mov    0x805028,%ecx
+  803160:	39 08                	cmp    %ecx,(%eax)
+  803162:	75 05                	jne    803169 <fd2sockid+0x29>
+  803164:	8b 40 0c             	mov    0xc(%eax),%eax
+  803167:	c9                   	leave
+  803168:	c3                   	ret
+  803169:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80316e:	eb f7                	jmp    803167 <fd2sockid+0x27>
+
+00803170 <alloc_sockfd>:
+  803170:	55                   	push   %ebp
+  803171:	89 e5                	mov    %esp,%ebp
+  803173:	56                   	push   %esi
+  803174:	53                   	push   %ebx
+  803175:	83 ec 1c             	sub    $0x1c,%esp
+  803178:	89 c6                	mov    %eax,%esi
+  80317a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80317d:	50                   	push   %eax
+  80317e:	e8 82 ea ff ff       	call   801c05 <fd_alloc>
+  803183:	89 c3                	mov    %eax,%ebx
+  803185:	83 c4 10             	add    $0x10,%esp
+  803188:	85 c0                	test   %eax,%eax
+  80318a:	78 43                	js     8031cf <alloc_sockfd+0x5f>
+  80318c:	83 ec 04             	sub    $0x4,%esp
+  80318f:	68 07 04 00 00       	push   $0x407
+  803194:	ff 75 f4             	push   -0xc(%ebp)
+  803197:	6a 00                	push   $0x0
+  803199:	e8 a1 dc ff ff       	call   800e3f <sys_page_alloc>
+  80319e:	89 c3                	mov    %eax,%ebx
+  8031a0:	83 c4 10             	add    $0x10,%esp
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	78 28                	js     8031cf <alloc_sockfd+0x5f>
+  8031a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031aa:	8b 15 28 50 80 00    	mov    0x805028,%edx
+  8031b0:	89 10                	mov    %edx,(%eax)
+  8031b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031b5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8031bc:	89 70 0c             	mov    %esi,0xc(%eax)
+  8031bf:	83 ec 0c             	sub    $0xc,%esp
+  8031c2:	50                   	push   %eax
+  8031c3:	e8 16 ea ff ff       	call   801bde <fd2num>
+  8031c8:	89 c3                	mov    %eax,%ebx
+  8031ca:	83 c4 10             	add    $0x10,%esp
+  8031cd:	eb 0c                	jmp    8031db <alloc_sockfd+0x6b>
+  8031cf:	83 ec 0c             	sub    $0xc,%esp
+  8031d2:	56                   	push   %esi
+  8031d3:	e8 d7 01 00 00       	call   8033af <nsipc_close>
+  8031d8:	83 c4 10             	add    $0x10,%esp
+  8031db:	89 d8                	mov    %ebx,%eax
+  8031dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031e0:	5b                   	pop    %ebx
+  8031e1:	5e                   	pop    %esi
+  8031e2:	5d                   	pop    %ebp
+  8031e3:	c3                   	ret
+
+008031e4 <accept>:
+  8031e4:	55                   	push   %ebp
+  8031e5:	89 e5                	mov    %esp,%ebp
+  8031e7:	83 ec 08             	sub    $0x8,%esp
+  8031ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ed:	e8 4e ff ff ff       	call   803140 <fd2sockid>
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	78 1b                	js     803211 <accept+0x2d>
+  8031f6:	83 ec 04             	sub    $0x4,%esp
+  8031f9:	ff 75 10             	push   0x10(%ebp)
+  8031fc:	ff 75 0c             	push   0xc(%ebp)
+  8031ff:	50                   	push   %eax
+  803200:	e8 07 01 00 00       	call   80330c <nsipc_accept>
+  803205:	83 c4 10             	add    $0x10,%esp
+  803208:	85 c0                	test   %eax,%eax
+  80320a:	78 05                	js     803211 <accept+0x2d>
+  80320c:	e8 5f ff ff ff       	call   803170 <alloc_sockfd>
+  803211:	c9                   	leave
+  803212:	c3                   	ret
+
+00803213 <bind>:
+  803213:	55                   	push   %ebp
+  803214:	89 e5                	mov    %esp,%ebp
+  803216:	83 ec 08             	sub    $0x8,%esp
+  803219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80321c:	e8 1f ff ff ff       	call   803140 <fd2sockid>
+  803221:	85 c0                	test   %eax,%eax
+  803223:	78 12                	js     803237 <bind+0x24>
+  803225:	83 ec 04             	sub    $0x4,%esp
+  803228:	ff 75 10             	push   0x10(%ebp)
+  80322b:	ff 75 0c             	push   0xc(%ebp)
+  80322e:	50                   	push   %eax
+  80322f:	e8 24 01 00 00       	call   803358 <nsipc_bind>
+  803234:	83 c4 10             	add    $0x10,%esp
+  803237:	c9                   	leave
+  803238:	c3                   	ret
+
+00803239 <shutdown>:
+  803239:	55                   	push   %ebp
+  80323a:	89 e5                	mov    %esp,%ebp
+  80323c:	83 ec 08             	sub    $0x8,%esp
+  80323f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803242:	e8 f9 fe ff ff       	call   803140 <fd2sockid>
+  803247:	85 c0                	test   %eax,%eax
+  803249:	78 0f                	js     80325a <shutdown+0x21>
+  80324b:	83 ec 08             	sub    $0x8,%esp
+  80324e:	ff 75 0c             	push   0xc(%ebp)
+  803251:	50                   	push   %eax
+  803252:	e8 36 01 00 00       	call   80338d <nsipc_shutdown>
+  803257:	83 c4 10             	add    $0x10,%esp
+  80325a:	c9                   	leave
+  80325b:	c3                   	ret
+
+0080325c <connect>:
+  80325c:	55                   	push   %ebp
+  80325d:	89 e5                	mov    %esp,%ebp
+  80325f:	83 ec 08             	sub    $0x8,%esp
+  803262:	8b 45 08             	mov    0x8(%ebp),%eax
+  803265:	e8 d6 fe ff ff       	call   803140 <fd2sockid>
+  80326a:	85 c0                	test   %eax,%eax
+  80326c:	78 12                	js     803280 <connect+0x24>
+  80326e:	83 ec 04             	sub    $0x4,%esp
+  803271:	ff 75 10             	push   0x10(%ebp)
+  803274:	ff 75 0c             	push   0xc(%ebp)
+  803277:	50                   	push   %eax
+  803278:	e8 4c 01 00 00       	call   8033c9 <nsipc_connect>
+  80327d:	83 c4 10             	add    $0x10,%esp
+  803280:	c9                   	leave
+  803281:	c3                   	ret
+
+00803282 <listen>:
+  803282:	55                   	push   %ebp
+  803283:	89 e5                	mov    %esp,%ebp
+  803285:	83 ec 08             	sub    $0x8,%esp
+  803288:	8b 45 08             	mov    0x8(%ebp),%eax
+  80328b:	e8 b0 fe ff ff       	call   803140 <fd2sockid>
+  803290:	85 c0                	test   %eax,%eax
+  803292:	78 0f                	js     8032a3 <listen+0x21>
+  803294:	83 ec 08             	sub    $0x8,%esp
+  803297:	ff 75 0c             	push   0xc(%ebp)
+  80329a:	50                   	push   %eax
+  80329b:	e8 5e 01 00 00       	call   8033fe <nsipc_listen>
+  8032a0:	83 c4 10             	add    $0x10,%esp
+  8032a3:	c9                   	leave
+  8032a4:	c3                   	ret
+
+008032a5 <socket>:
+  8032a5:	55                   	push   %ebp
+  8032a6:	89 e5                	mov    %esp,%ebp
+  8032a8:	83 ec 0c             	sub    $0xc,%esp
+  8032ab:	ff 75 10             	push   0x10(%ebp)
+  8032ae:	ff 75 0c             	push   0xc(%ebp)
+  8032b1:	ff 75 08             	push   0x8(%ebp)
+  8032b4:	e8 34 02 00 00       	call   8034ed <nsipc_socket>
+  8032b9:	83 c4 10             	add    $0x10,%esp
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	78 05                	js     8032c5 <socket+0x20>
+  8032c0:	e8 ab fe ff ff       	call   803170 <alloc_sockfd>
+  8032c5:	c9                   	leave
+  8032c6:	c3                   	ret
+
+008032c7 <nsipc>:
+  8032c7:	55                   	push   %ebp
+  8032c8:	89 e5                	mov    %esp,%ebp
+  8032ca:	53                   	push   %ebx
+  8032cb:	83 ec 04             	sub    $0x4,%esp
+  8032ce:	89 c3                	mov    %eax,%ebx
+  8032d0:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  8032d7:	74 1f                	je     8032f8 <nsipc+0x31>
+  8032d9:	83 ec 08             	sub    $0x8,%esp
+  8032dc:	6a 00                	push   $0x0
+  8032de:	6a 00                	push   $0x0
+  8032e0:	6a 07                	push   $0x7
+  8032e2:	68 00 80 80 00       	push   $0x808000
+  8032e7:	53                   	push   %ebx
+  8032e8:	ff 35 10 60 80 00    	push   0x806010
+  8032ee:	e8 dc 0a 00 00       	call   803dcf <ipc_call>
+  8032f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032f6:	c9                   	leave
+  8032f7:	c3                   	ret
+  8032f8:	83 ec 0c             	sub    $0xc,%esp
+  8032fb:	6a 03                	push   $0x3
+  8032fd:	e8 68 0c 00 00       	call   803f6a <ipc_find_env>
+  803302:	a3 10 60 80 00       	mov    %eax,0x806010
+  803307:	83 c4 10             	add    $0x10,%esp
+  80330a:	eb cd                	jmp    8032d9 <nsipc+0x12>
+
+0080330c <nsipc_accept>:
+  80330c:	55                   	push   %ebp
+  80330d:	89 e5                	mov    %esp,%ebp
+  80330f:	53                   	push   %ebx
+  803310:	83 ec 04             	sub    $0x4,%esp
+  803313:	8b 45 08             	mov    0x8(%ebp),%eax
+  803316:	a3 00 80 80 00       	mov    %eax,0x808000
+  80331b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803320:	e8 a2 ff ff ff       	call   8032c7 <nsipc>
+  803325:	89 c3                	mov    %eax,%ebx
+  803327:	85 c0                	test   %eax,%eax
+  803329:	79 07                	jns    803332 <nsipc_accept+0x26>
+  80332b:	89 d8                	mov    %ebx,%eax
+  80332d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803330:	c9                   	leave
+  803331:	c3                   	ret
+  803332:	83 ec 04             	sub    $0x4,%esp
+  803335:	ff 35 10 80 80 00    	push   0x808010
+  80333b:	68 00 80 80 00       	push   $0x808000
+  803340:	ff 75 0c             	push   0xc(%ebp)
+  803343:	e8 47 d8 ff ff       	call   800b8f <memmove>
+  803348:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80334e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803351:	89 10                	mov    %edx,(%eax)
+  803353:	83 c4 10             	add    $0x10,%esp
+  803356:	eb d3                	jmp    80332b <nsipc_accept+0x1f>
+
+00803358 <nsipc_bind>:
+  803358:	55                   	push   %ebp
+  803359:	89 e5                	mov    %esp,%ebp
+  80335b:	53                   	push   %ebx
+  80335c:	83 ec 08             	sub    $0x8,%esp
+  80335f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803362:	8b 45 08             	mov    0x8(%ebp),%eax
+  803365:	a3 00 80 80 00       	mov    %eax,0x808000
+  80336a:	53                   	push   %ebx
+  80336b:	ff 75 0c             	push   0xc(%ebp)
+  80336e:	68 04 80 80 00       	push   $0x808004
+  803373:	e8 17 d8 ff ff       	call   800b8f <memmove>
+  803378:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  80337e:	b8 02 00 00 00       	mov    $0x2,%eax
+  803383:	e8 3f ff ff ff       	call   8032c7 <nsipc>
+  803388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80338b:	c9                   	leave
+  80338c:	c3                   	ret
+
+0080338d <nsipc_shutdown>:
+  80338d:	55                   	push   %ebp
+  80338e:	89 e5                	mov    %esp,%ebp
+  803390:	83 ec 08             	sub    $0x8,%esp
+  803393:	8b 45 08             	mov    0x8(%ebp),%eax
+  803396:	a3 00 80 80 00       	mov    %eax,0x808000
+  80339b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80339e:	a3 04 80 80 00       	mov    %eax,0x808004
+  8033a3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8033a8:	e8 1a ff ff ff       	call   8032c7 <nsipc>
+  8033ad:	c9                   	leave
+  8033ae:	c3                   	ret
+
+008033af <nsipc_close>:
+  8033af:	55                   	push   %ebp
+  8033b0:	89 e5                	mov    %esp,%ebp
+  8033b2:	83 ec 08             	sub    $0x8,%esp
+  8033b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b8:	a3 00 80 80 00       	mov    %eax,0x808000
+  8033bd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8033c2:	e8 00 ff ff ff       	call   8032c7 <nsipc>
+  8033c7:	c9                   	leave
+  8033c8:	c3                   	ret
+
+008033c9 <nsipc_connect>:
+  8033c9:	55                   	push   %ebp
+  8033ca:	89 e5                	mov    %esp,%ebp
+  8033cc:	53                   	push   %ebx
+  8033cd:	83 ec 08             	sub    $0x8,%esp
+  8033d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d6:	a3 00 80 80 00       	mov    %eax,0x808000
+  8033db:	53                   	push   %ebx
+  8033dc:	ff 75 0c             	push   0xc(%ebp)
+  8033df:	68 04 80 80 00       	push   $0x808004
+  8033e4:	e8 a6 d7 ff ff       	call   800b8f <memmove>
+  8033e9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  8033ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8033f4:	e8 ce fe ff ff       	call   8032c7 <nsipc>
+  8033f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033fc:	c9                   	leave
+  8033fd:	c3                   	ret
+
+008033fe <nsipc_listen>:
+  8033fe:	55                   	push   %ebp
+  8033ff:	89 e5                	mov    %esp,%ebp
+  803401:	83 ec 08             	sub    $0x8,%esp
+  803404:	8b 45 08             	mov    0x8(%ebp),%eax
+  803407:	a3 00 80 80 00       	mov    %eax,0x808000
+  80340c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80340f:	a3 04 80 80 00       	mov    %eax,0x808004
+  803414:	b8 06 00 00 00       	mov    $0x6,%eax
+  803419:	e8 a9 fe ff ff       	call   8032c7 <nsipc>
+  80341e:	c9                   	leave
+  80341f:	c3                   	ret
+
+00803420 <nsipc_recv>:
+  803420:	55                   	push   %ebp
+  803421:	89 e5                	mov    %esp,%ebp
+  803423:	56                   	push   %esi
+  803424:	53                   	push   %ebx
+  803425:	8b 75 10             	mov    0x10(%ebp),%esi
+  803428:	8b 45 08             	mov    0x8(%ebp),%eax
+  80342b:	a3 00 80 80 00       	mov    %eax,0x808000
+  803430:	89 35 04 80 80 00    	mov    %esi,0x808004
+  803436:	8b 45 14             	mov    0x14(%ebp),%eax
+  803439:	a3 08 80 80 00       	mov    %eax,0x808008
+  80343e:	b8 07 00 00 00       	mov    $0x7,%eax
+  803443:	e8 7f fe ff ff       	call   8032c7 <nsipc>
+  803448:	89 c3                	mov    %eax,%ebx
+  80344a:	85 c0                	test   %eax,%eax
+  80344c:	78 22                	js     803470 <nsipc_recv+0x50>
+  80344e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803453:	39 c6                	cmp    %eax,%esi
+  803455:	0f 4e c6             	cmovle %esi,%eax
+  803458:	39 c3                	cmp    %eax,%ebx
+  80345a:	7f 1d                	jg     803479 <nsipc_recv+0x59>
+  80345c:	83 ec 04             	sub    $0x4,%esp
+  80345f:	53                   	push   %ebx
+  803460:	68 00 80 80 00       	push   $0x808000
+  803465:	ff 75 0c             	push   0xc(%ebp)
+  803468:	e8 22 d7 ff ff       	call   800b8f <memmove>
+  80346d:	83 c4 10             	add    $0x10,%esp
+  803470:	89 d8                	mov    %ebx,%eax
+  803472:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803475:	5b                   	pop    %ebx
+  803476:	5e                   	pop    %esi
+  803477:	5d                   	pop    %ebp
+  803478:	c3                   	ret
+  803479:	68 32 48 80 00       	push   $0x804832
+  80347e:	68 93 47 80 00       	push   $0x804793
+  803483:	6a 60                	push   $0x60
+  803485:	68 47 48 80 00       	push   $0x804847
+  80348a:	e8 7e cd ff ff       	call   80020d <_panic>
+
+0080348f <nsipc_send>:
+  80348f:	55                   	push   %ebp
+  803490:	89 e5                	mov    %esp,%ebp
+  803492:	53                   	push   %ebx
+  803493:	83 ec 04             	sub    $0x4,%esp
+  803496:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803499:	8b 45 08             	mov    0x8(%ebp),%eax
+  80349c:	a3 00 80 80 00       	mov    %eax,0x808000
+  8034a1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8034a7:	7f 2e                	jg     8034d7 <nsipc_send+0x48>
+  8034a9:	83 ec 04             	sub    $0x4,%esp
+  8034ac:	53                   	push   %ebx
+  8034ad:	ff 75 0c             	push   0xc(%ebp)
+  8034b0:	68 0c 80 80 00       	push   $0x80800c
+  8034b5:	e8 d5 d6 ff ff       	call   800b8f <memmove>
+  8034ba:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  8034c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034c3:	a3 08 80 80 00       	mov    %eax,0x808008
+  8034c8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8034cd:	e8 f5 fd ff ff       	call   8032c7 <nsipc>
+  8034d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034d5:	c9                   	leave
+  8034d6:	c3                   	ret
+  8034d7:	68 53 48 80 00       	push   $0x804853
+  8034dc:	68 93 47 80 00       	push   $0x804793
+  8034e1:	6a 6b                	push   $0x6b
+  8034e3:	68 47 48 80 00       	push   $0x804847
+  8034e8:	e8 20 cd ff ff       	call   80020d <_panic>
+
+008034ed <nsipc_socket>:
+  8034ed:	55                   	push   %ebp
+  8034ee:	89 e5                	mov    %esp,%ebp
+  8034f0:	83 ec 08             	sub    $0x8,%esp
+  8034f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f6:	a3 00 80 80 00       	mov    %eax,0x808000
+  8034fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034fe:	a3 04 80 80 00       	mov    %eax,0x808004
+  803503:	8b 45 10             	mov    0x10(%ebp),%eax
+  803506:	a3 08 80 80 00       	mov    %eax,0x808008
+  80350b:	b8 09 00 00 00       	mov    $0x9,%eax
+  803510:	e8 b2 fd ff ff       	call   8032c7 <nsipc>
+  803515:	c9                   	leave
+  803516:	c3                   	ret
+
+00803517 <devpipe_stat>:
+  803517:	55                   	push   %ebp
+  803518:	89 e5                	mov    %esp,%ebp
+  80351a:	56                   	push   %esi
+  80351b:	53                   	push   %ebx
+  80351c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80351f:	83 ec 0c             	sub    $0xc,%esp
+  803522:	ff 75 08             	push   0x8(%ebp)
+  803525:	e8 c4 e6 ff ff       	call   801bee <fd2data>
+  80352a:	89 c6                	mov    %eax,%esi
+  80352c:	83 c4 08             	add    $0x8,%esp
+  80352f:	68 5f 48 80 00       	push   $0x80485f
+  803534:	53                   	push   %ebx
+  803535:	e8 a5 d4 ff ff       	call   8009df <strcpy>
+  80353a:	8b 46 04             	mov    0x4(%esi),%eax
+  80353d:	2b 06                	sub    (%esi),%eax
+  80353f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  803545:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80354c:	00 00 00 
+  80354f:	c7 83 88 00 00 00 44 	movl   $0x805044,0x88(%ebx)
+  803556:	50 80 00 
+  803559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803561:	5b                   	pop    %ebx
+  803562:	5e                   	pop    %esi
+  803563:	5d                   	pop    %ebp
+  803564:	c3                   	ret
+
+00803565 <devpipe_close>:
+  803565:	55                   	push   %ebp
+  803566:	89 e5                	mov    %esp,%ebp
+  803568:	53                   	push   %ebx
+  803569:	83 ec 0c             	sub    $0xc,%esp
+  80356c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80356f:	53                   	push   %ebx
+  803570:	6a 00                	push   $0x0
+  803572:	e8 9a d9 ff ff       	call   800f11 <sys_page_unmap>
+  803577:	89 1c 24             	mov    %ebx,(%esp)
+  80357a:	e8 6f e6 ff ff       	call   801bee <fd2data>
+  80357f:	83 c4 08             	add    $0x8,%esp
+  803582:	50                   	push   %eax
+  803583:	6a 00                	push   $0x0
+  803585:	e8 87 d9 ff ff       	call   800f11 <sys_page_unmap>
+  80358a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80358d:	c9                   	leave
+  80358e:	c3                   	ret
+
+0080358f <_pipeisclosed>:
+  80358f:	55                   	push   %ebp
+  803590:	89 e5                	mov    %esp,%ebp
+  803592:	57                   	push   %edi
+  803593:	56                   	push   %esi
+  803594:	53                   	push   %ebx
+  803595:	83 ec 1c             	sub    $0x1c,%esp
+  803598:	89 c7                	mov    %eax,%edi
+  80359a:	89 d6                	mov    %edx,%esi
+  80359c:	a1 14 60 80 00       	mov    0x806014,%eax
+  8035a1:	8b 58 58             	mov    0x58(%eax),%ebx
+  8035a4:	83 ec 0c             	sub    $0xc,%esp
+  8035a7:	57                   	push   %edi
+  8035a8:	e8 d7 09 00 00       	call   803f84 <pageref>
+  8035ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8035b0:	89 34 24             	mov    %esi,(%esp)
+  8035b3:	e8 cc 09 00 00       	call   803f84 <pageref>
+  8035b8:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  8035be:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8035c1:	83 c4 10             	add    $0x10,%esp
+  8035c4:	39 cb                	cmp    %ecx,%ebx
+  8035c6:	74 1b                	je     8035e3 <_pipeisclosed+0x54>
+  8035c8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035cb:	75 cf                	jne    80359c <_pipeisclosed+0xd>
+  8035cd:	8b 42 58             	mov    0x58(%edx),%eax
+  8035d0:	6a 01                	push   $0x1
+  8035d2:	50                   	push   %eax
+  8035d3:	53                   	push   %ebx
+  8035d4:	68 66 48 80 00       	push   $0x804866
+  8035d9:	e8 0a cd ff ff       	call   8002e8 <cprintf>
+  8035de:	83 c4 10             	add    $0x10,%esp
+  8035e1:	eb b9                	jmp    80359c <_pipeisclosed+0xd>
+  8035e3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035e6:	0f 94 c0             	sete   %al
+  8035e9:	0f b6 c0             	movzbl %al,%eax
+  8035ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035ef:	5b                   	pop    %ebx
+  8035f0:	5e                   	pop    %esi
+  8035f1:	5f                   	pop    %edi
+  8035f2:	5d                   	pop    %ebp
+  8035f3:	c3                   	ret
+
+008035f4 <devpipe_write>:
+  8035f4:	55                   	push   %ebp
+  8035f5:	89 e5                	mov    %esp,%ebp
+  8035f7:	57                   	push   %edi
+  8035f8:	56                   	push   %esi
+  8035f9:	53                   	push   %ebx
+  8035fa:	83 ec 28             	sub    $0x28,%esp
+  8035fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  803600:	56                   	push   %esi
+  803601:	e8 e8 e5 ff ff       	call   801bee <fd2data>
+  803606:	89 c3                	mov    %eax,%ebx
+  803608:	83 c4 10             	add    $0x10,%esp
+  80360b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803610:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803614:	74 5c                	je     803672 <devpipe_write+0x7e>
+  803616:	8b 43 04             	mov    0x4(%ebx),%eax
+  803619:	8b 0b                	mov    (%ebx),%ecx
+  80361b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80361e:	39 d0                	cmp    %edx,%eax
+  803620:	72 1e                	jb     803640 <devpipe_write+0x4c>
+  803622:	89 da                	mov    %ebx,%edx
+  803624:	89 f0                	mov    %esi,%eax
+  803626:	e8 64 ff ff ff       	call   80358f <_pipeisclosed>
+  80362b:	85 c0                	test   %eax,%eax
+  80362d:	75 48                	jne    803677 <devpipe_write+0x83>
+  80362f:	e8 c0 d7 ff ff       	call   800df4 <sys_yield>
+  803634:	8b 43 04             	mov    0x4(%ebx),%eax
+  803637:	8b 0b                	mov    (%ebx),%ecx
+  803639:	8d 51 20             	lea    0x20(%ecx),%edx
+  80363c:	39 d0                	cmp    %edx,%eax
+  80363e:	73 e2                	jae    803622 <devpipe_write+0x2e>
+  803640:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803643:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803647:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80364a:	89 c2                	mov    %eax,%edx
+  80364c:	c1 fa 1f             	sar    $0x1f,%edx
+  80364f:	89 d1                	mov    %edx,%ecx
+  803651:	c1 e9 1b             	shr    $0x1b,%ecx
+  803654:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803657:	83 e2 1f             	and    $0x1f,%edx
+  80365a:	29 ca                	sub    %ecx,%edx
+  80365c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803660:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  803664:	83 c0 01             	add    $0x1,%eax
+  803667:	89 43 04             	mov    %eax,0x4(%ebx)
+  80366a:	83 c7 01             	add    $0x1,%edi
+  80366d:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803670:	75 a4                	jne    803616 <devpipe_write+0x22>
+  803672:	8b 45 10             	mov    0x10(%ebp),%eax
+  803675:	eb 05                	jmp    80367c <devpipe_write+0x88>
+  803677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80367f:	5b                   	pop    %ebx
+  803680:	5e                   	pop    %esi
+  803681:	5f                   	pop    %edi
+  803682:	5d                   	pop    %ebp
+  803683:	c3                   	ret
+
+00803684 <devpipe_read>:
+  803684:	55                   	push   %ebp
+  803685:	89 e5                	mov    %esp,%ebp
+  803687:	57                   	push   %edi
+  803688:	56                   	push   %esi
+  803689:	53                   	push   %ebx
+  80368a:	83 ec 18             	sub    $0x18,%esp
+  80368d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803690:	56                   	push   %esi
+  803691:	e8 58 e5 ff ff       	call   801bee <fd2data>
+  803696:	89 c3                	mov    %eax,%ebx
+  803698:	83 c4 10             	add    $0x10,%esp
+  80369b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036a4:	74 45                	je     8036eb <devpipe_read+0x67>
+  8036a6:	8b 03                	mov    (%ebx),%eax
+  8036a8:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8036ab:	75 1d                	jne    8036ca <devpipe_read+0x46>
+  8036ad:	85 ff                	test   %edi,%edi
+  8036af:	75 3f                	jne    8036f0 <devpipe_read+0x6c>
+  8036b1:	89 da                	mov    %ebx,%edx
+  8036b3:	89 f0                	mov    %esi,%eax
+  8036b5:	e8 d5 fe ff ff       	call   80358f <_pipeisclosed>
+  8036ba:	85 c0                	test   %eax,%eax
+  8036bc:	75 3c                	jne    8036fa <devpipe_read+0x76>
+  8036be:	e8 31 d7 ff ff       	call   800df4 <sys_yield>
+  8036c3:	8b 03                	mov    (%ebx),%eax
+  8036c5:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8036c8:	74 e7                	je     8036b1 <devpipe_read+0x2d>
+  8036ca:	99                   	cltd
+  8036cb:	c1 ea 1b             	shr    $0x1b,%edx
+  8036ce:	01 d0                	add    %edx,%eax
+  8036d0:	83 e0 1f             	and    $0x1f,%eax
+  8036d3:	29 d0                	sub    %edx,%eax
+  8036d5:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8036da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8036dd:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8036e0:	83 03 01             	addl   $0x1,(%ebx)
+  8036e3:	83 c7 01             	add    $0x1,%edi
+  8036e6:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8036e9:	75 bb                	jne    8036a6 <devpipe_read+0x22>
+  8036eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036ee:	eb 02                	jmp    8036f2 <devpipe_read+0x6e>
+  8036f0:	89 f8                	mov    %edi,%eax
+  8036f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f5:	5b                   	pop    %ebx
+  8036f6:	5e                   	pop    %esi
+  8036f7:	5f                   	pop    %edi
+  8036f8:	5d                   	pop    %ebp
+  8036f9:	c3                   	ret
+  8036fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ff:	eb f1                	jmp    8036f2 <devpipe_read+0x6e>
+
+00803701 <pipe>:
+  803701:	55                   	push   %ebp
+  803702:	89 e5                	mov    %esp,%ebp
+  803704:	56                   	push   %esi
+  803705:	53                   	push   %ebx
+  803706:	83 ec 1c             	sub    $0x1c,%esp
+  803709:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80370c:	50                   	push   %eax
+  80370d:	e8 f3 e4 ff ff       	call   801c05 <fd_alloc>
+  803712:	89 c3                	mov    %eax,%ebx
+  803714:	83 c4 10             	add    $0x10,%esp
+  803717:	85 c0                	test   %eax,%eax
+  803719:	0f 88 23 01 00 00    	js     803842 <pipe+0x141>
+  80371f:	83 ec 04             	sub    $0x4,%esp
+  803722:	68 07 04 00 00       	push   $0x407
+  803727:	ff 75 f4             	push   -0xc(%ebp)
+  80372a:	6a 00                	push   $0x0
+  80372c:	e8 0e d7 ff ff       	call   800e3f <sys_page_alloc>
+  803731:	89 c3                	mov    %eax,%ebx
+  803733:	83 c4 10             	add    $0x10,%esp
+  803736:	85 c0                	test   %eax,%eax
+  803738:	0f 88 04 01 00 00    	js     803842 <pipe+0x141>
+  80373e:	83 ec 0c             	sub    $0xc,%esp
+  803741:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803744:	50                   	push   %eax
+  803745:	e8 bb e4 ff ff       	call   801c05 <fd_alloc>
+  80374a:	89 c3                	mov    %eax,%ebx
+  80374c:	83 c4 10             	add    $0x10,%esp
+  80374f:	85 c0                	test   %eax,%eax
+  803751:	0f 88 db 00 00 00    	js     803832 <pipe+0x131>
+  803757:	83 ec 04             	sub    $0x4,%esp
+  80375a:	68 07 04 00 00       	push   $0x407
+  80375f:	ff 75 f0             	push   -0x10(%ebp)
+  803762:	6a 00                	push   $0x0
+  803764:	e8 d6 d6 ff ff       	call   800e3f <sys_page_alloc>
+  803769:	89 c3                	mov    %eax,%ebx
+  80376b:	83 c4 10             	add    $0x10,%esp
+  80376e:	85 c0                	test   %eax,%eax
+  803770:	0f 88 bc 00 00 00    	js     803832 <pipe+0x131>
+  803776:	83 ec 0c             	sub    $0xc,%esp
+  803779:	ff 75 f4             	push   -0xc(%ebp)
+  80377c:	e8 6d e4 ff ff       	call   801bee <fd2data>
+  803781:	89 c6                	mov    %eax,%esi
+  803783:	83 c4 0c             	add    $0xc,%esp
+  803786:	68 07 04 00 00       	push   $0x407
+  80378b:	50                   	push   %eax
+  80378c:	6a 00                	push   $0x0
+  80378e:	e8 ac d6 ff ff       	call   800e3f <sys_page_alloc>
+  803793:	89 c3                	mov    %eax,%ebx
+  803795:	83 c4 10             	add    $0x10,%esp
+  803798:	85 c0                	test   %eax,%eax
+  80379a:	0f 88 82 00 00 00    	js     803822 <pipe+0x121>
+  8037a0:	83 ec 0c             	sub    $0xc,%esp
+  8037a3:	ff 75 f0             	push   -0x10(%ebp)
+  8037a6:	e8 43 e4 ff ff       	call   801bee <fd2data>
+  8037ab:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8037b2:	50                   	push   %eax
+  8037b3:	6a 00                	push   $0x0
+  8037b5:	56                   	push   %esi
+  8037b6:	6a 00                	push   $0x0
+  8037b8:	e8 c5 d6 ff ff       	call   800e82 <sys_page_map>
+  8037bd:	89 c3                	mov    %eax,%ebx
+  8037bf:	83 c4 20             	add    $0x20,%esp
+  8037c2:	85 c0                	test   %eax,%eax
+  8037c4:	78 4e                	js     803814 <pipe+0x113>
+  8037c6:	a1 44 50 80 00       	mov    0x805044,%eax
+  8037cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8037ce:	89 02                	mov    %eax,(%edx)
+  8037d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8037d3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8037da:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8037dd:	89 02                	mov    %eax,(%edx)
+  8037df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8037e2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8037e9:	83 ec 0c             	sub    $0xc,%esp
+  8037ec:	ff 75 f4             	push   -0xc(%ebp)
+  8037ef:	e8 ea e3 ff ff       	call   801bde <fd2num>
+  8037f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037f7:	89 01                	mov    %eax,(%ecx)
+  8037f9:	83 c4 04             	add    $0x4,%esp
+  8037fc:	ff 75 f0             	push   -0x10(%ebp)
+  8037ff:	e8 da e3 ff ff       	call   801bde <fd2num>
+  803804:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803807:	89 41 04             	mov    %eax,0x4(%ecx)
+  80380a:	83 c4 10             	add    $0x10,%esp
+  80380d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803812:	eb 2e                	jmp    803842 <pipe+0x141>
+  803814:	83 ec 08             	sub    $0x8,%esp
+  803817:	56                   	push   %esi
+  803818:	6a 00                	push   $0x0
+  80381a:	e8 f2 d6 ff ff       	call   800f11 <sys_page_unmap>
+  80381f:	83 c4 10             	add    $0x10,%esp
+  803822:	83 ec 08             	sub    $0x8,%esp
+  803825:	ff 75 f0             	push   -0x10(%ebp)
+  803828:	6a 00                	push   $0x0
+  80382a:	e8 e2 d6 ff ff       	call   800f11 <sys_page_unmap>
+  80382f:	83 c4 10             	add    $0x10,%esp
+  803832:	83 ec 08             	sub    $0x8,%esp
+  803835:	ff 75 f4             	push   -0xc(%ebp)
+  803838:	6a 00                	push   $0x0
+  80383a:	e8 d2 d6 ff ff       	call   800f11 <sys_page_unmap>
+  80383f:	83 c4 10             	add    $0x10,%esp
+  803842:	89 d8                	mov    %ebx,%eax
+  803844:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803847:	5b                   	pop    %ebx
+  803848:	5e                   	pop    %esi
+  803849:	5d                   	pop    %ebp
+  80384a:	c3                   	ret
+
+0080384b <pipeisclosed>:
+  80384b:	55                   	push   %ebp
+  80384c:	89 e5                	mov    %esp,%ebp
+  80384e:	83 ec 20             	sub    $0x20,%esp
+  803851:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803854:	50                   	push   %eax
+  803855:	ff 75 08             	push   0x8(%ebp)
+  803858:	e8 f8 e3 ff ff       	call   801c55 <fd_lookup>
+  80385d:	83 c4 10             	add    $0x10,%esp
+  803860:	85 c0                	test   %eax,%eax
+  803862:	78 18                	js     80387c <pipeisclosed+0x31>
+  803864:	83 ec 0c             	sub    $0xc,%esp
+  803867:	ff 75 f4             	push   -0xc(%ebp)
+  80386a:	e8 7f e3 ff ff       	call   801bee <fd2data>
+  80386f:	89 c2                	mov    %eax,%edx
+  803871:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803874:	e8 16 fd ff ff       	call   80358f <_pipeisclosed>
+  803879:	83 c4 10             	add    $0x10,%esp
+  80387c:	c9                   	leave
+  80387d:	c3                   	ret
+
+0080387e <wait>:
+  80387e:	55                   	push   %ebp
+  80387f:	89 e5                	mov    %esp,%ebp
+  803881:	56                   	push   %esi
+  803882:	53                   	push   %ebx
+  803883:	8b 75 08             	mov    0x8(%ebp),%esi
+  803886:	85 f6                	test   %esi,%esi
+  803888:	74 40                	je     8038ca <wait+0x4c>
+  80388a:	89 f3                	mov    %esi,%ebx
+  80388c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803892:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  803898:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80389d:	8b 40 48             	mov    0x48(%eax),%eax
+  8038a0:	39 c6                	cmp    %eax,%esi
+  8038a2:	75 1f                	jne    8038c3 <wait+0x45>
+  8038a4:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  8038aa:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8038b0:	8b 43 54             	mov    0x54(%ebx),%eax
+  8038b3:	85 c0                	test   %eax,%eax
+  8038b5:	74 0c                	je     8038c3 <wait+0x45>
+  8038b7:	e8 38 d5 ff ff       	call   800df4 <sys_yield>
+  8038bc:	8b 43 48             	mov    0x48(%ebx),%eax
+  8038bf:	39 f0                	cmp    %esi,%eax
+  8038c1:	74 ed                	je     8038b0 <wait+0x32>
+  8038c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038c6:	5b                   	pop    %ebx
+  8038c7:	5e                   	pop    %esi
+  8038c8:	5d                   	pop    %ebp
+  8038c9:	c3                   	ret
+  8038ca:	68 7e 48 80 00       	push   $0x80487e
+  8038cf:	68 93 47 80 00       	push   $0x804793
+  8038d4:	6a 09                	push   $0x9
+  8038d6:	68 89 48 80 00       	push   $0x804889
+  8038db:	e8 2d c9 ff ff       	call   80020d <_panic>
+
+008038e0 <ipcring_init>:
+  8038e0:	55                   	push   %ebp
+  8038e1:	89 e5                	mov    %esp,%ebp
+  8038e3:	53                   	push   %ebx
+  8038e4:	83 ec 08             	sub    $0x8,%esp
+  8038e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8038ea:	6a 60                	push   $0x60
+  8038ec:	6a 00                	push   $0x0
+  8038ee:	53                   	push   %ebx
+  8038ef:	e8 66 d2 ff ff       	call   800b5a <memset>
+  8038f4:	a1 14 60 80 00       	mov    0x806014,%eax
+  8038f9:	8b 40 48             	mov    0x48(%eax),%eax
+  8038fc:	89 03                	mov    %eax,(%ebx)
+  8038fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803901:	89 43 04             	mov    %eax,0x4(%ebx)
+  803904:	8b 45 10             	mov    0x10(%ebp),%eax
+  803907:	89 43 08             	mov    %eax,0x8(%ebx)
+  80390a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80390d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803910:	83 c4 10             	add    $0x10,%esp
+  803913:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803916:	c9                   	leave
+  803917:	c3                   	ret
+
+00803918 <ipcring_req_slot>:
+  803918:	55                   	push   %ebp
+  803919:	89 e5                	mov    %esp,%ebp
+  80391b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80391e:	8b 50 10             	mov    0x10(%eax),%edx
+  803921:	8b 48 18             	mov    0x18(%eax),%ecx
+  803924:	29 ca                	sub    %ecx,%edx
+  803926:	83 fa 07             	cmp    $0x7,%edx
+  803929:	77 0c                	ja     803937 <ipcring_req_slot+0x1f>
+  80392b:	8b 50 10             	mov    0x10(%eax),%edx
+  80392e:	83 e2 07             	and    $0x7,%edx
+  803931:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803935:	5d                   	pop    %ebp
+  803936:	c3                   	ret
+  803937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80393c:	eb f7                	jmp    803935 <ipcring_req_slot+0x1d>
+
+0080393e <ipcring_req_push>:
+  80393e:	55                   	push   %ebp
+  80393f:	89 e5                	mov    %esp,%ebp
+  803941:	83 ec 08             	sub    $0x8,%esp
+  803944:	8b 55 08             	mov    0x8(%ebp),%edx
+  803947:	8b 42 10             	mov    0x10(%edx),%eax
+  80394a:	83 c0 01             	add    $0x1,%eax
+  80394d:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803951:	b8 00 00 00 00       	mov    $0x0,%eax
+  803956:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  80395a:	85 c0                	test   %eax,%eax
+  80395c:	75 02                	jne    803960 <ipcring_req_push+0x22>
+  80395e:	c9                   	leave
+  80395f:	c3                   	ret
+  803960:	6a 00                	push   $0x0
+  803962:	68 00 00 80 ee       	push   $0xee800000
+  803967:	ff 72 08             	push   0x8(%edx)
+  80396a:	ff 72 04             	push   0x4(%edx)
+  80396d:	e8 05 d8 ff ff       	call   801177 <sys_ipc_send>
+  803972:	83 c4 10             	add    $0x10,%esp
+  803975:	eb e7                	jmp    80395e <ipcring_req_push+0x20>
+
+00803977 <ipcring_rsp_wait>:
+  803977:	55                   	push   %ebp
+  803978:	89 e5                	mov    %esp,%ebp
+  80397a:	53                   	push   %ebx
+  80397b:	83 ec 04             	sub    $0x4,%esp
+  80397e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803981:	8b 53 18             	mov    0x18(%ebx),%edx
+  803984:	8b 43 10             	mov    0x10(%ebx),%eax
+  803987:	39 c2                	cmp    %eax,%edx
+  803989:	74 3c                	je     8039c7 <ipcring_rsp_wait+0x50>
+  80398b:	8b 53 14             	mov    0x14(%ebx),%edx
+  80398e:	8b 43 18             	mov    0x18(%ebx),%eax
+  803991:	39 c2                	cmp    %eax,%edx
+  803993:	75 23                	jne    8039b8 <ipcring_rsp_wait+0x41>
+  803995:	83 ec 08             	sub    $0x8,%esp
+  803998:	6a 00                	push   $0x0
+  80399a:	6a 00                	push   $0x0
+  80399c:	6a 00                	push   $0x0
+  80399e:	6a 00                	push   $0x0
+  8039a0:	ff 73 0c             	push   0xc(%ebx)
+  8039a3:	ff 73 04             	push   0x4(%ebx)
+  8039a6:	e8 24 04 00 00       	call   803dcf <ipc_call>
+  8039ab:	8b 53 14             	mov    0x14(%ebx),%edx
+  8039ae:	8b 43 18             	mov    0x18(%ebx),%eax
+  8039b1:	83 c4 20             	add    $0x20,%esp
+  8039b4:	39 c2                	cmp    %eax,%edx
+  8039b6:	74 dd                	je     803995 <ipcring_rsp_wait+0x1e>
+  8039b8:	8b 43 18             	mov    0x18(%ebx),%eax
+  8039bb:	83 e0 07             	and    $0x7,%eax
+  8039be:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  8039c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039c5:	c9                   	leave
+  8039c6:	c3                   	ret
+  8039c7:	68 94 48 80 00       	push   $0x804894
+  8039cc:	68 93 47 80 00       	push   $0x804793
+  8039d1:	6a 3b                	push   $0x3b
+  8039d3:	68 b5 48 80 00       	push   $0x8048b5
+  8039d8:	e8 30 c8 ff ff       	call   80020d <_panic>
+
+008039dd <ipcring_rsp_pop>:
+  8039dd:	55                   	push   %ebp
+  8039de:	89 e5                	mov    %esp,%ebp
+  8039e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8039e3:	8b 42 18             	mov    0x18(%edx),%eax
+  8039e6:	83 c0 01             	add    $0x1,%eax
+  8039e9:	89 42 18             	mov    %eax,0x18(%edx)
+  8039ec:	5d                   	pop    %ebp
+  8039ed:	c3                   	ret
+
+008039ee <ipcring_server_init>:
+  8039ee:	55                   	push   %ebp
+  8039ef:	89 e5                	mov    %esp,%ebp
+  8039f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039f7:	89 10                	mov    %edx,(%eax)
+  8039f9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8039fc:	89 50 04             	mov    %edx,0x4(%eax)
+  8039ff:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803a06:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803a0d:	5d                   	pop    %ebp
+  803a0e:	c3                   	ret
+
+00803a0f <ipcring_req_avail>:
+  803a0f:	55                   	push   %ebp
+  803a10:	89 e5                	mov    %esp,%ebp
+  803a12:	8b 55 08             	mov    0x8(%ebp),%edx
+  803a15:	8b 02                	mov    (%edx),%eax
+  803a17:	8b 40 10             	mov    0x10(%eax),%eax
+  803a1a:	2b 42 08             	sub    0x8(%edx),%eax
+  803a1d:	ba 08 00 00 00       	mov    $0x8,%edx
+  803a22:	39 d0                	cmp    %edx,%eax
+  803a24:	0f 47 c2             	cmova  %edx,%eax
+  803a27:	5d                   	pop    %ebp
+  803a28:	c3                   	ret
+
+00803a29 <ipcring_req_peek>:
+  803a29:	55                   	push   %ebp
+  803a2a:	89 e5                	mov    %esp,%ebp
+  803a2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  803a2f:	8b 42 08             	mov    0x8(%edx),%eax
+  803a32:	83 e0 07             	and    $0x7,%eax
+  803a35:	8b 12                	mov    (%edx),%edx
+  803a37:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803a3b:	5d                   	pop    %ebp
+  803a3c:	c3                   	ret
+
+00803a3d <ipcring_rsp_push>:
+  803a3d:	55                   	push   %ebp
+  803a3e:	89 e5                	mov    %esp,%ebp
+  803a40:	83 ec 08             	sub    $0x8,%esp
+  803a43:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a46:	8b 41 08             	mov    0x8(%ecx),%eax
+  803a49:	83 c0 01             	add    $0x1,%eax
+  803a4c:	89 41 08             	mov    %eax,0x8(%ecx)
+  803a4f:	8b 11                	mov    (%ecx),%edx
+  803a51:	83 c2 14             	add    $0x14,%edx
+  803a54:	f0 87 02             	lock xchg %eax,(%edx)
+  803a57:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803a5b:	75 02                	jne    803a5f <ipcring_rsp_push+0x22>
+  803a5d:	c9                   	leave
+  803a5e:	c3                   	ret
+  803a5f:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803a66:	6a 00                	push   $0x0
+  803a68:	68 00 00 80 ee       	push   $0xee800000
+  803a6d:	6a 00                	push   $0x0
+  803a6f:	ff 71 04             	push   0x4(%ecx)
+  803a72:	e8 23 d6 ff ff       	call   80109a <sys_ipc_try_send>
+  803a77:	83 c4 10             	add    $0x10,%esp
+  803a7a:	eb e1                	jmp    803a5d <ipcring_rsp_push+0x20>
+
+00803a7c <ipcring_client_wait>:
+  803a7c:	55                   	push   %ebp
+  803a7d:	89 e5                	mov    %esp,%ebp
+  803a7f:	83 ec 08             	sub    $0x8,%esp
+  803a82:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a85:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803a8c:	8b 10                	mov    (%eax),%edx
+  803a8e:	8b 52 18             	mov    0x18(%edx),%edx
+  803a91:	3b 50 08             	cmp    0x8(%eax),%edx
+  803a94:	75 02                	jne    803a98 <ipcring_client_wait+0x1c>
+  803a96:	c9                   	leave
+  803a97:	c3                   	ret
+  803a98:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803a9f:	6a 00                	push   $0x0
+  803aa1:	68 00 00 80 ee       	push   $0xee800000
+  803aa6:	6a 00                	push   $0x0
+  803aa8:	ff 70 04             	push   0x4(%eax)
+  803aab:	e8 ea d5 ff ff       	call   80109a <sys_ipc_try_send>
+  803ab0:	83 c4 10             	add    $0x10,%esp
+  803ab3:	eb e1                	jmp    803a96 <ipcring_client_wait+0x1a>
+
+00803ab5 <ipcring_server_sleep>:
+  803ab5:	55                   	push   %ebp
+  803ab6:	89 e5                	mov    %esp,%ebp
+  803ab8:	53                   	push   %ebx
+  803ab9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803abc:	8b 01                	mov    (%ecx),%eax
+  803abe:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803ac1:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ac6:	f0 87 02             	lock xchg %eax,(%edx)
+  803ac9:	8b 11                	mov    (%ecx),%edx
+  803acb:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803ace:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ad3:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803ad6:	74 0e                	je     803ae6 <ipcring_server_sleep+0x31>
+  803ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803add:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ae9:	c9                   	leave
+  803aea:	c3                   	ret
+
+00803aeb <devcons_close>:
+  803aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af0:	c3                   	ret
+
+00803af1 <devcons_stat>:
+  803af1:	55                   	push   %ebp
+  803af2:	89 e5                	mov    %esp,%ebp
+  803af4:	83 ec 10             	sub    $0x10,%esp
+  803af7:	68 c3 48 80 00       	push   $0x8048c3
+  803afc:	ff 75 0c             	push   0xc(%ebp)
+  803aff:	e8 db ce ff ff       	call   8009df <strcpy>
+  803b04:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b09:	c9                   	leave
+  803b0a:	c3                   	ret
+
+00803b0b <devcons_write>:
+  803b0b:	55                   	push   %ebp
+  803b0c:	89 e5                	mov    %esp,%ebp
+  803b0e:	57                   	push   %edi
+  803b0f:	56                   	push   %esi
+  803b10:	53                   	push   %ebx
+  803b11:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803b17:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803b1a:	85 ff                	test   %edi,%edi
+  803b1c:	74 51                	je     803b6f <devcons_write+0x64>
+  803b1e:	be 00 00 00 00       	mov    $0x0,%esi
+  803b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b28:	89 fb                	mov    %edi,%ebx
+  803b2a:	29 c3                	sub    %eax,%ebx
+  803b2c:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803b31:	39 d3                	cmp    %edx,%ebx
+  803b33:	0f 47 da             	cmova  %edx,%ebx
+  803b36:	83 ec 04             	sub    $0x4,%esp
+  803b39:	53                   	push   %ebx
+  803b3a:	03 45 0c             	add    0xc(%ebp),%eax
+  803b3d:	50                   	push   %eax
+  803b3e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803b44:	50                   	push   %eax
+  803b45:	e8 45 d0 ff ff       	call   800b8f <memmove>
+  803b4a:	83 c4 08             	add    $0x8,%esp
+  803b4d:	53                   	push   %ebx
+  803b4e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803b54:	50                   	push   %eax
+  803b55:	e8 fd d1 ff ff       	call   800d57 <sys_cputs>
+  803b5a:	01 de                	add    %ebx,%esi
+  803b5c:	89 f0                	mov    %esi,%eax
+  803b5e:	83 c4 10             	add    $0x10,%esp
+  803b61:	39 fe                	cmp    %edi,%esi
+  803b63:	72 c3                	jb     803b28 <devcons_write+0x1d>
+  803b65:	89 f0                	mov    %esi,%eax
+  803b67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b6a:	5b                   	pop    %ebx
+  803b6b:	5e                   	pop    %esi
+  803b6c:	5f                   	pop    %edi
+  803b6d:	5d                   	pop    %ebp
+  803b6e:	c3                   	ret
+  803b6f:	be 00 00 00 00       	mov    $0x0,%esi
+  803b74:	eb ef                	jmp    803b65 <devcons_write+0x5a>
+
+00803b76 <devcons_read>:
+  803b76:	55                   	push   %ebp
+  803b77:	89 e5                	mov    %esp,%ebp
+  803b79:	83 ec 08             	sub    $0x8,%esp
+  803b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b81:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b85:	75 07                	jne    803b8e <devcons_read+0x18>
+  803b87:	eb 1f                	jmp    803ba8 <devcons_read+0x32>
+  803b89:	e8 66 d2 ff ff       	call   800df4 <sys_yield>
+  803b8e:	e8 e2 d1 ff ff       	call   800d75 <sys_cgetc>
+  803b93:	85 c0                	test   %eax,%eax
+  803b95:	74 f2                	je     803b89 <devcons_read+0x13>
+  803b97:	78 0f                	js     803ba8 <devcons_read+0x32>
+  803b99:	83 f8 04             	cmp    $0x4,%eax
+  803b9c:	74 0c                	je     803baa <devcons_read+0x34>
+  803b9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ba1:	88 02                	mov    %al,(%edx)
+  803ba3:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ba8:	c9                   	leave
+  803ba9:	c3                   	ret
+  803baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803baf:	eb f7                	jmp    803ba8 <devcons_read+0x32>
+
+00803bb1 <cputchar>:
+  803bb1:	55                   	push   %ebp
+  803bb2:	89 e5                	mov    %esp,%ebp
+  803bb4:	83 ec 20             	sub    $0x20,%esp
+  803bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bba:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803bbd:	6a 01                	push   $0x1
+  803bbf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bc2:	50                   	push   %eax
+  803bc3:	e8 8f d1 ff ff       	call   800d57 <sys_cputs>
+  803bc8:	83 c4 10             	add    $0x10,%esp
+  803bcb:	c9                   	leave
+  803bcc:	c3                   	ret
+
+00803bcd <getchar>:
+  803bcd:	55                   	push   %ebp
+  803bce:	89 e5                	mov    %esp,%ebp
+  803bd0:	83 ec 1c             	sub    $0x1c,%esp
+  803bd3:	6a 01                	push   $0x1
+  803bd5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803bd8:	50                   	push   %eax
+  803bd9:	6a 00                	push   $0x0
+  803bdb:	e8 d7 e2 ff ff       	call   801eb7 <read>
+  803be0:	83 c4 10             	add    $0x10,%esp
+  803be3:	85 c0                	test   %eax,%eax
+  803be5:	78 06                	js     803bed <getchar+0x20>
+  803be7:	74 06                	je     803bef <getchar+0x22>
+  803be9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803bed:	c9                   	leave
+  803bee:	c3                   	ret
+  803bef:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803bf4:	eb f7                	jmp    803bed <getchar+0x20>
+
+00803bf6 <iscons>:
+  803bf6:	55                   	push   %ebp
+  803bf7:	89 e5                	mov    %esp,%ebp
+  803bf9:	83 ec 20             	sub    $0x20,%esp
+  803bfc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bff:	50                   	push   %eax
+  803c00:	ff 75 08             	push   0x8(%ebp)
+  803c03:	e8 4d e0 ff ff       	call   801c55 <fd_lookup>
+  803c08:	83 c4 10             	add    $0x10,%esp
+  803c0b:	85 c0                	test   %eax,%eax
+  803c0d:	78 11                	js     803c20 <iscons+0x2a>
+  803c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c12:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  803c18:	39 10                	cmp    %edx,(%eax)
+  803c1a:	0f 94 c0             	sete   %al
+  803c1d:	0f b6 c0             	movzbl %al,%eax
+  803c20:	c9                   	leave
+  803c21:	c3                   	ret
+
+00803c22 <opencons>:
+  803c22:	55                   	push   %ebp
+  803c23:	89 e5                	mov    %esp,%ebp
+  803c25:	83 ec 24             	sub    $0x24,%esp
+  803c28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c2b:	50                   	push   %eax
+  803c2c:	e8 d4 df ff ff       	call   801c05 <fd_alloc>
+  803c31:	83 c4 10             	add    $0x10,%esp
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	78 3a                	js     803c72 <opencons+0x50>
+  803c38:	83 ec 04             	sub    $0x4,%esp
+  803c3b:	68 07 04 00 00       	push   $0x407
+  803c40:	ff 75 f4             	push   -0xc(%ebp)
+  803c43:	6a 00                	push   $0x0
+  803c45:	e8 f5 d1 ff ff       	call   800e3f <sys_page_alloc>
+  803c4a:	83 c4 10             	add    $0x10,%esp
+  803c4d:	85 c0                	test   %eax,%eax
+  803c4f:	78 21                	js     803c72 <opencons+0x50>
+  803c51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c54:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  803c5a:	89 10                	mov    %edx,(%eax)
+  803c5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c5f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803c66:	83 ec 0c             	sub    $0xc,%esp
+  803c69:	50                   	push   %eax
+  803c6a:	e8 6f df ff ff       	call   801bde <fd2num>
+  803c6f:	83 c4 10             	add    $0x10,%esp
+  803c72:	c9                   	leave
+  803c73:	c3                   	ret
+
+00803c74 <set_pgfault_handler>:
+  803c74:	55                   	push   %ebp
+  803c75:	89 e5                	mov    %esp,%ebp
+  803c77:	53                   	push   %ebx
+  803c78:	83 ec 04             	sub    $0x4,%esp
+  803c7b:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803c82:	74 0d                	je     803c91 <set_pgfault_handler+0x1d>
+  803c84:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c87:	a3 00 90 80 00       	mov    %eax,0x809000
+  803c8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c8f:	c9                   	leave
+  803c90:	c3                   	ret
+  803c91:	e8 3f d1 ff ff       	call   800dd5 <sys_getenvid>
+  803c96:	89 c3                	mov    %eax,%ebx
+  803c98:	83 ec 04             	sub    $0x4,%esp
+  803c9b:	6a 07                	push   $0x7
+  803c9d:	68 00 f0 7f ee       	push   $0xee7ff000
+  803ca2:	50                   	push   %eax
+  803ca3:	e8 97 d1 ff ff       	call   800e3f <sys_page_alloc>
+  803ca8:	83 c4 10             	add    $0x10,%esp
+  803cab:	85 c0                	test   %eax,%eax
+  803cad:	78 29                	js     803cd8 <set_pgfault_handler+0x64>
+  803caf:	83 ec 08             	sub    $0x8,%esp
+  803cb2:	68 ec 3c 80 00       	push   $0x803cec
+  803cb7:	53                   	push   %ebx
+  803cb8:	e8 9b d3 ff ff       	call   801058 <sys_env_set_pgfault_upcall>
+  803cbd:	83 c4 10             	add    $0x10,%esp
+  803cc0:	85 c0                	test   %eax,%eax
+  803cc2:	79 c0                	jns    803c84 <set_pgfault_handler+0x10>
+  803cc4:	83 ec 04             	sub    $0x4,%esp
+  803cc7:	68 08 49 80 00       	push   $0x804908
+  803ccc:	6a 27                	push   $0x27
+  803cce:	68 3a 49 80 00       	push   $0x80493a
+  803cd3:	e8 35 c5 ff ff       	call   80020d <_panic>
+  803cd8:	83 ec 04             	sub    $0x4,%esp
+  803cdb:	68 d0 48 80 00       	push   $0x8048d0
+  803ce0:	6a 23                	push   $0x23
+  803ce2:	68 3a 49 80 00       	push   $0x80493a
+  803ce7:	e8 21 c5 ff ff       	call   80020d <_panic>
+
+00803cec <_pgfault_upcall>:
+  803cec:	54                   	push   %esp
+  803ced:	a1 00 90 80 00       	mov    0x809000,%eax
+  803cf2:	ff d0                	call   *%eax
+  803cf4:	83 c4 04             	add    $0x4,%esp
+  803cf7:	89 e3                	mov    %esp,%ebx
+  803cf9:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803cfd:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803d01:	89 d4                	mov    %edx,%esp
+  803d03:	51                   	push   %ecx
+  803d04:	89 dc                	mov    %ebx,%esp
+  803d06:	83 ea 04             	sub    $0x4,%edx
+  803d09:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803d0d:	83 c4 08             	add    $0x8,%esp
+  803d10:	61                   	popa
+  803d11:	83 c4 04             	add    $0x4,%esp
+  803d14:	9d                   	popf
+  803d15:	5c                   	pop    %esp
+  803d16:	c3                   	ret
+
+00803d17 <ipc_recv>:
+  803d17:	55                   	push   %ebp
+  803d18:	89 e5                	mov    %esp,%ebp
+  803d1a:	56                   	push   %esi
+  803d1b:	53                   	push   %ebx
+  803d1c:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d25:	85 c0                	test   %eax,%eax
+  803d27:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803d2c:	0f 44 c2             	cmove  %edx,%eax
+  803d2f:	83 ec 0c             	sub    $0xc,%esp
+  803d32:	50                   	push   %eax
+  803d33:	e8 b2 d3 ff ff       	call   8010ea <sys_ipc_recv>
+  803d38:	83 c4 10             	add    $0x10,%esp
+  803d3b:	85 c0                	test   %eax,%eax
+  803d3d:	78 2a                	js     803d69 <ipc_recv+0x52>
+  803d3f:	a1 14 60 80 00       	mov    0x806014,%eax
+  803d44:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803d4a:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803d50:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803d56:	85 f6                	test   %esi,%esi
+  803d58:	74 02                	je     803d5c <ipc_recv+0x45>
+  803d5a:	89 0e                	mov    %ecx,(%esi)
+  803d5c:	85 db                	test   %ebx,%ebx
+  803d5e:	74 02                	je     803d62 <ipc_recv+0x4b>
+  803d60:	89 13                	mov    %edx,(%ebx)
+  803d62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d65:	5b                   	pop    %ebx
+  803d66:	5e                   	pop    %esi
+  803d67:	5d                   	pop    %ebp
+  803d68:	c3                   	ret
+  803d69:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d73:	eb e1                	jmp    803d56 <ipc_recv+0x3f>
+
+00803d75 <ipc_send>:
+  803d75:	55                   	push   %ebp
+  803d76:	89 e5                	mov    %esp,%ebp
+  803d78:	57                   	push   %edi
+  803d79:	56                   	push   %esi
+  803d7a:	53                   	push   %ebx
+  803d7b:	83 ec 0c             	sub    $0xc,%esp
+  803d7e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803d84:	8b 75 14             	mov    0x14(%ebp),%esi
+  803d87:	85 db                	test   %ebx,%ebx
+  803d89:	74 1e                	je     803da9 <ipc_send+0x34>
+  803d8b:	56                   	push   %esi
+  803d8c:	53                   	push   %ebx
+  803d8d:	57                   	push   %edi
+  803d8e:	ff 75 08             	push   0x8(%ebp)
+  803d91:	e8 e1 d3 ff ff       	call   801177 <sys_ipc_send>
+  803d96:	83 c4 10             	add    $0x10,%esp
+  803d99:	85 c0                	test   %eax,%eax
+  803d9b:	74 2a                	je     803dc7 <ipc_send+0x52>
+  803d9d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803da0:	75 13                	jne    803db5 <ipc_send+0x40>
+  803da2:	e8 4d d0 ff ff       	call   800df4 <sys_yield>
+  803da7:	eb e2                	jmp    803d8b <ipc_send+0x16>
+  803da9:	be 00 00 00 00       	mov    $0x0,%esi
+  803dae:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803db3:	eb d6                	jmp    803d8b <ipc_send+0x16>
+  803db5:	50                   	push   %eax
+  803db6:	68 48 49 80 00       	push   $0x804948
+  803dbb:	6a 4f                	push   $0x4f
+  803dbd:	68 8b 49 80 00       	push   $0x80498b
+  803dc2:	e8 46 c4 ff ff       	call   80020d <_panic>
+  803dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dca:	5b                   	pop    %ebx
+  803dcb:	5e                   	pop    %esi
+  803dcc:	5f                   	pop    %edi
+  803dcd:	5d                   	pop    %ebp
+  803dce:	c3                   	ret
+
+00803dcf <ipc_call>:
+  803dcf:	55                   	push   %ebp
+  803dd0:	89 e5                	mov    %esp,%ebp
+  803dd2:	57                   	push   %edi
+  803dd3:	56                   	push   %esi
+  803dd4:	53                   	push   %ebx
+  803dd5:	83 ec 0c             	sub    $0xc,%esp
+  803dd8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803ddc:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803de1:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803de5:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803de9:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803dee:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803df2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803dfb:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803dff:	eb 05                	jmp    803e06 <ipc_call+0x37>
+  803e01:	e8 ee cf ff ff       	call   800df4 <sys_yield>
+  803e06:	83 ec 0c             	sub    $0xc,%esp
+  803e09:	56                   	push   %esi
+  803e0a:	53                   	push   %ebx
+  803e0b:	57                   	push   %edi
+  803e0c:	ff 75 0c             	push   0xc(%ebp)
+  803e0f:	ff 75 08             	push   0x8(%ebp)
+  803e12:	e8 b0 d3 ff ff       	call   8011c7 <sys_ipc_call>
+  803e17:	83 c4 20             	add    $0x20,%esp
+  803e1a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803e1d:	74 e2                	je     803e01 <ipc_call+0x32>
+  803e1f:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803e22:	74 2d                	je     803e51 <ipc_call+0x82>
+  803e24:	85 c0                	test   %eax,%eax
+  803e26:	78 4f                	js     803e77 <ipc_call+0xa8>
+  803e28:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803e2c:	74 10                	je     803e3e <ipc_call+0x6f>
+  803e2e:	a1 14 60 80 00       	mov    0x806014,%eax
+  803e33:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803e39:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803e3c:	89 02                	mov    %eax,(%edx)
+  803e3e:	a1 14 60 80 00       	mov    0x806014,%eax
+  803e43:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e4c:	5b                   	pop    %ebx
+  803e4d:	5e                   	pop    %esi
+  803e4e:	5f                   	pop    %edi
+  803e4f:	5d                   	pop    %ebp
+  803e50:	c3                   	ret
+  803e51:	ff 75 14             	push   0x14(%ebp)
+  803e54:	ff 75 10             	push   0x10(%ebp)
+  803e57:	ff 75 0c             	push   0xc(%ebp)
+  803e5a:	ff 75 08             	push   0x8(%ebp)
+  803e5d:	e8 13 ff ff ff       	call   803d75 <ipc_send>
+  803e62:	83 c4 0c             	add    $0xc,%esp
+  803e65:	ff 75 1c             	push   0x1c(%ebp)
+  803e68:	ff 75 18             	push   0x18(%ebp)
+  803e6b:	6a 00                	push   $0x0
+  803e6d:	e8 a5 fe ff ff       	call   803d17 <ipc_recv>
+  803e72:	83 c4 10             	add    $0x10,%esp
+  803e75:	eb d2                	jmp    803e49 <ipc_call+0x7a>
+  803e77:	50                   	push   %eax
+  803e78:	68 95 49 80 00       	push   $0x804995
+  803e7d:	6a 6d                	push   $0x6d
+  803e7f:	68 8b 49 80 00       	push   $0x80498b
+  803e84:	e8 84 c3 ff ff       	call   80020d <_panic>
+
+00803e89 <ipc_reply_recv>:
+  803e89:	55                   	push   %ebp
+  803e8a:	89 e5                	mov    %esp,%ebp
+  803e8c:	57                   	push   %edi
+  803e8d:	56                   	push   %esi
+  803e8e:	53                   	push   %ebx
+  803e8f:	83 ec 0c             	sub    $0xc,%esp
+  803e92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803e95:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  803e98:	8b 7d 20             	mov    0x20(%ebp),%edi
+  803e9b:	85 db                	test   %ebx,%ebx
+  803e9d:	0f 84 ac 00 00 00    	je     803f4f <ipc_reply_recv+0xc6>
+  803ea3:	85 f6                	test   %esi,%esi
+  803ea5:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803eaa:	0f 45 c6             	cmovne %esi,%eax
+  803ead:	83 ec 0c             	sub    $0xc,%esp
+  803eb0:	50                   	push   %eax
+  803eb1:	ff 75 14             	push   0x14(%ebp)
+  803eb4:	53                   	push   %ebx
+  803eb5:	ff 75 0c             	push   0xc(%ebp)
+  803eb8:	ff 75 08             	push   0x8(%ebp)
+  803ebb:	e8 28 d3 ff ff       	call   8011e8 <sys_ipc_reply_recv>
+  803ec0:	83 c4 20             	add    $0x20,%esp
+  803ec3:	85 c0                	test   %eax,%eax
+  803ec5:	78 3a                	js     803f01 <ipc_reply_recv+0x78>
+  803ec7:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803ecb:	74 10                	je     803edd <ipc_reply_recv+0x54>
+  803ecd:	a1 14 60 80 00       	mov    0x806014,%eax
+  803ed2:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803ed8:	8b 55 18             	mov    0x18(%ebp),%edx
+  803edb:	89 02                	mov    %eax,(%edx)
+  803edd:	85 ff                	test   %edi,%edi
+  803edf:	74 0d                	je     803eee <ipc_reply_recv+0x65>
+  803ee1:	a1 14 60 80 00       	mov    0x806014,%eax
+  803ee6:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803eec:	89 07                	mov    %eax,(%edi)
+  803eee:	a1 14 60 80 00       	mov    0x806014,%eax
+  803ef3:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803ef9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803efc:	5b                   	pop    %ebx
+  803efd:	5e                   	pop    %esi
+  803efe:	5f                   	pop    %edi
+  803eff:	5d                   	pop    %ebp
+  803f00:	c3                   	ret
+  803f01:	ff 75 14             	push   0x14(%ebp)
+  803f04:	53                   	push   %ebx
+  803f05:	ff 75 0c             	push   0xc(%ebp)
+  803f08:	ff 75 08             	push   0x8(%ebp)
+  803f0b:	e8 8a d1 ff ff       	call   80109a <sys_ipc_try_send>
+  803f10:	89 c2                	mov    %eax,%edx
+  803f12:	c1 ea 1f             	shr    $0x1f,%edx
+  803f15:	83 c4 10             	add    $0x10,%esp
+  803f18:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803f1b:	0f 95 c1             	setne  %cl
+  803f1e:	84 d1                	test   %dl,%cl
+  803f20:	74 05                	je     803f27 <ipc_reply_recv+0x9e>
+  803f22:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803f25:	75 12                	jne    803f39 <ipc_reply_recv+0xb0>
+  803f27:	83 ec 04             	sub    $0x4,%esp
+  803f2a:	57                   	push   %edi
+  803f2b:	56                   	push   %esi
+  803f2c:	ff 75 18             	push   0x18(%ebp)
+  803f2f:	e8 e3 fd ff ff       	call   803d17 <ipc_recv>
+  803f34:	83 c4 10             	add    $0x10,%esp
+  803f37:	eb c0                	jmp    803ef9 <ipc_reply_recv+0x70>
+  803f39:	83 ec 04             	sub    $0x4,%esp
+  803f3c:	50                   	push   %eax
+  803f3d:	ff 75 08             	push   0x8(%ebp)
+  803f40:	68 68 49 80 00       	push   $0x804968
+  803f45:	e8 9e c3 ff ff       	call   8002e8 <cprintf>
+  803f4a:	83 c4 10             	add    $0x10,%esp
+  803f4d:	eb d8                	jmp    803f27 <ipc_reply_recv+0x9e>
+  803f4f:	85 f6                	test   %esi,%esi
+  803f51:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803f56:	0f 45 c6             	cmovne %esi,%eax
+  803f59:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803f5e:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803f65:	e9 43 ff ff ff       	jmp    803ead <ipc_reply_recv+0x24>
+
+00803f6a <ipc_find_env>:
+  803f6a:	55                   	push   %ebp
+  803f6b:	89 e5                	mov    %esp,%ebp
+  803f6d:	83 ec 14             	sub    $0x14,%esp
+  803f70:	ff 75 08             	push   0x8(%ebp)
+  803f73:	e8 c0 d0 ff ff       	call   801038 <sys_env_service>
+  803f78:	85 c0                	test   %eax,%eax
+  803f7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f7f:	0f 48 c2             	cmovs  %edx,%eax
+  803f82:	c9                   	leave
+  803f83:	c3                   	ret
+
+00803f84 <pageref>:
+  803f84:	55                   	push   %ebp
+  803f85:	89 e5                	mov    %esp,%ebp
+  803f87:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f8a:	89 c2                	mov    %eax,%edx
+  803f8c:	c1 ea 16             	shr    $0x16,%edx
+  803f8f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  803f96:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f9b:	f6 c1 01             	test   $0x1,%cl
+  803f9e:	74 22                	je     803fc2 <pageref+0x3e>
+  803fa0:	c1 e8 0c             	shr    $0xc,%eax
+  803fa3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803faa:	a8 01                	test   $0x1,%al
+  803fac:	74 14                	je     803fc2 <pageref+0x3e>
+  803fae:	c1 e8 0c             	shr    $0xc,%eax
+  803fb1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803fb4:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803fbb:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803fbf:	0f b7 d2             	movzwl %dx,%edx
+  803fc2:	89 d0                	mov    %edx,%eax
+  803fc4:	5d                   	pop    %ebp
+  803fc5:	c3                   	ret
+
+00803fc6 <__udivmoddi4>:
+  803fc6:	55                   	push   %ebp
+  803fc7:	57                   	push   %edi
+  803fc8:	56                   	push   %esi
+  803fc9:	53                   	push   %ebx
+  803fca:	83 ec 24             	sub    $0x24,%esp
+  803fcd:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803fd1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803fd5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803fd9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803fdd:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803fe1:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803fe5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803fe9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803fed:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ffb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804000:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804007:	00 
+  804008:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80400f:	00 
+  804010:	89 fb                	mov    %edi,%ebx
+  804012:	eb 08                	jmp    80401c <__udivmoddi4+0x56>
+  804014:	83 e9 01             	sub    $0x1,%ecx
+  804017:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80401a:	74 68                	je     804084 <__udivmoddi4+0xbe>
+  80401c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804020:	01 c0                	add    %eax,%eax
+  804022:	89 c6                	mov    %eax,%esi
+  804024:	89 d7                	mov    %edx,%edi
+  804026:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80402a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80402e:	0f ad d0             	shrd   %cl,%edx,%eax
+  804031:	d3 ea                	shr    %cl,%edx
+  804033:	f6 c1 20             	test   $0x20,%cl
+  804036:	74 04                	je     80403c <__udivmoddi4+0x76>
+  804038:	89 d0                	mov    %edx,%eax
+  80403a:	31 d2                	xor    %edx,%edx
+  80403c:	83 e0 01             	and    $0x1,%eax
+  80403f:	89 04 24             	mov    %eax,(%esp)
+  804042:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804049:	00 
+  80404a:	8b 04 24             	mov    (%esp),%eax
+  80404d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804051:	09 f0                	or     %esi,%eax
+  804053:	09 fa                	or     %edi,%edx
+  804055:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804059:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80405d:	39 f0                	cmp    %esi,%eax
+  80405f:	89 d5                	mov    %edx,%ebp
+  804061:	19 fd                	sbb    %edi,%ebp
+  804063:	72 af                	jb     804014 <__udivmoddi4+0x4e>
+  804065:	29 f0                	sub    %esi,%eax
+  804067:	19 fa                	sbb    %edi,%edx
+  804069:	89 cf                	mov    %ecx,%edi
+  80406b:	c1 ef 05             	shr    $0x5,%edi
+  80406e:	83 e7 01             	and    $0x1,%edi
+  804071:	89 fe                	mov    %edi,%esi
+  804073:	83 f6 01             	xor    $0x1,%esi
+  804076:	d3 e6                	shl    %cl,%esi
+  804078:	d3 e7                	shl    %cl,%edi
+  80407a:	09 74 24 18          	or     %esi,0x18(%esp)
+  80407e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804082:	eb 90                	jmp    804014 <__udivmoddi4+0x4e>
+  804084:	85 db                	test   %ebx,%ebx
+  804086:	74 05                	je     80408d <__udivmoddi4+0xc7>
+  804088:	89 03                	mov    %eax,(%ebx)
+  80408a:	89 53 04             	mov    %edx,0x4(%ebx)
+  80408d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804091:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804095:	83 c4 24             	add    $0x24,%esp
+  804098:	5b                   	pop    %ebx
+  804099:	5e                   	pop    %esi
+  80409a:	5f                   	pop    %edi
+  80409b:	5d                   	pop    %ebp
+  80409c:	c3                   	ret
+
+0080409d <__udivdi3>:
+  80409d:	83 ec 08             	sub    $0x8,%esp
+  8040a0:	6a 00                	push   $0x0
+  8040a2:	ff 74 24 1c          	push   0x1c(%esp)
+  8040a6:	ff 74 24 1c          	push   0x1c(%esp)
+  8040aa:	ff 74 24 1c          	push   0x1c(%esp)
+  8040ae:	ff 74 24 1c          	push   0x1c(%esp)
+  8040b2:	e8 0f ff ff ff       	call   803fc6 <__udivmoddi4>
+  8040b7:	83 c4 1c             	add    $0x1c,%esp
+  8040ba:	c3                   	ret
+
+008040bb <__umoddi3>:
+  8040bb:	83 ec 18             	sub    $0x18,%esp
+  8040be:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8040c2:	50                   	push   %eax
+  8040c3:	ff 74 24 2c          	push   0x2c(%esp)
+  8040c7:	ff 74 24 2c          	push   0x2c(%esp)
+  8040cb:	ff 74 24 2c          	push   0x2c(%esp)
+  8040cf:	ff 74 24 2c          	push   0x2c(%esp)
+  8040d3:	e8 ee fe ff ff       	call   803fc6 <__udivmoddi4>
+  8040d8:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8040dc:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8040e0:	83 c4 2c             	add    $0x2c,%esp
+  8040e3:	c3                   	ret
+
+008040e4 <__divdi3>:
+  8040e4:	53                   	push   %ebx
+  8040e5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8040e9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8040ed:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8040f1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8040f5:	85 d2                	test   %edx,%edx
+  8040f7:	78 12                	js     80410b <__divdi3+0x27>
+  8040f9:	85 db                	test   %ebx,%ebx
+  8040fb:	78 2e                	js     80412b <__divdi3+0x47>
+  8040fd:	53                   	push   %ebx
+  8040fe:	51                   	push   %ecx
+  8040ff:	52                   	push   %edx
+  804100:	50                   	push   %eax
+  804101:	e8 97 ff ff ff       	call   80409d <__udivdi3>
+  804106:	83 c4 10             	add    $0x10,%esp
+  804109:	eb 1e                	jmp    804129 <__divdi3+0x45>
+  80410b:	f7 d8                	neg    %eax
+  80410d:	83 d2 00             	adc    $0x0,%edx
+  804110:	f7 da                	neg    %edx
+  804112:	85 db                	test   %ebx,%ebx
+  804114:	78 2a                	js     804140 <__divdi3+0x5c>
+  804116:	53                   	push   %ebx
+  804117:	51                   	push   %ecx
+  804118:	52                   	push   %edx
+  804119:	50                   	push   %eax
+  80411a:	e8 7e ff ff ff       	call   80409d <__udivdi3>
+  80411f:	83 c4 10             	add    $0x10,%esp
+  804122:	f7 d8                	neg    %eax
+  804124:	83 d2 00             	adc    $0x0,%edx
+  804127:	f7 da                	neg    %edx
+  804129:	5b                   	pop    %ebx
+  80412a:	c3                   	ret
+  80412b:	f7 d9                	neg    %ecx
+  80412d:	83 d3 00             	adc    $0x0,%ebx
+  804130:	f7 db                	neg    %ebx
+  804132:	53                   	push   %ebx
+  804133:	51                   	push   %ecx
+  804134:	52                   	push   %edx
+  804135:	50                   	push   %eax
+  804136:	e8 62 ff ff ff       	call   80409d <__udivdi3>
+  80413b:	83 c4 10             	add    $0x10,%esp
+  80413e:	eb e2                	jmp    804122 <__divdi3+0x3e>
+  804140:	f7 d9                	neg    %ecx
+  804142:	83 d3 00             	adc    $0x0,%ebx
+  804145:	f7 db                	neg    %ebx
+  804147:	53                   	push   %ebx
+  804148:	51                   	push   %ecx
+  804149:	52                   	push   %edx
+  80414a:	50                   	push   %eax
+  80414b:	e8 4d ff ff ff       	call   80409d <__udivdi3>
+  804150:	83 c4 10             	add    $0x10,%esp
+  804153:	eb d4                	jmp    804129 <__divdi3+0x45>
+
+00804155 <__moddi3>:
+  804155:	55                   	push   %ebp
+  804156:	57                   	push   %edi
+  804157:	56                   	push   %esi
+  804158:	53                   	push   %ebx
+  804159:	83 ec 0c             	sub    $0xc,%esp
+  80415c:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  804160:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  804164:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804168:	89 e9                	mov    %ebp,%ecx
+  80416a:	f7 d9                	neg    %ecx
+  80416c:	89 d0                	mov    %edx,%eax
+  80416e:	83 d0 00             	adc    $0x0,%eax
+  804171:	f7 d8                	neg    %eax
+  804173:	0f 49 e9             	cmovns %ecx,%ebp
+  804176:	0f 49 d0             	cmovns %eax,%edx
+  804179:	52                   	push   %edx
+  80417a:	55                   	push   %ebp
+  80417b:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80417f:	f7 da                	neg    %edx
+  804181:	89 d8                	mov    %ebx,%eax
+  804183:	83 d0 00             	adc    $0x0,%eax
+  804186:	f7 d8                	neg    %eax
+  804188:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80418d:	89 54 24 08          	mov    %edx,0x8(%esp)
+  804191:	0f 48 c3             	cmovs  %ebx,%eax
+  804194:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  804198:	ff 74 24 0c          	push   0xc(%esp)
+  80419c:	ff 74 24 0c          	push   0xc(%esp)
+  8041a0:	e8 16 ff ff ff       	call   8040bb <__umoddi3>
+  8041a5:	83 c4 10             	add    $0x10,%esp
+  8041a8:	85 db                	test   %ebx,%ebx
+  8041aa:	78 08                	js     8041b4 <__moddi3+0x5f>
+  8041ac:	83 c4 0c             	add    $0xc,%esp
+  8041af:	5b                   	pop    %ebx
+  8041b0:	5e                   	pop    %esi
+  8041b1:	5f                   	pop    %edi
+  8041b2:	5d                   	pop    %ebp
+  8041b3:	c3                   	ret
+  8041b4:	f7 d8                	neg    %eax
+  8041b6:	83 d2 00             	adc    $0x0,%edx
+  8041b9:	f7 da                	neg    %edx
+  8041bb:	eb ef                	jmp    8041ac <__moddi3+0x57>
@@ -0,0 +1,5689 @@
+
+obj/user/testsched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 92 02 00 00       	call   8002c3 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <spinner>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	89 c3                	mov    %eax,%ebx
+  80003c:	e8 7b 19 00 00       	call   8019bc <fork>
+  800041:	85 c0                	test   %eax,%eax
+  800043:	78 07                	js     80004c <spinner+0x19>
+  800045:	74 17                	je     80005e <spinner+0x2b>
+  800047:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80004a:	c9                   	leave
+  80004b:	c3                   	ret
+  80004c:	50                   	push   %eax
+  80004d:	68 c0 39 80 00       	push   $0x8039c0
+  800052:	6a 16                	push   $0x16
+  800054:	68 c9 39 80 00       	push   $0x8039c9
+  800059:	e8 de 02 00 00       	call   80033c <_panic>
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	53                   	push   %ebx
+  800062:	6a 00                	push   $0x0
+  800064:	6a 00                	push   $0x0
+  800066:	e8 47 16 00 00       	call   8016b2 <sys_env_set_sched>
+  80006b:	83 c4 10             	add    $0x10,%esp
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	78 02                	js     800074 <spinner+0x41>
+  800072:	eb fe                	jmp    800072 <spinner+0x3f>
+  800074:	50                   	push   %eax
+  800075:	68 da 39 80 00       	push   $0x8039da
+  80007a:	6a 19                	push   $0x19
+  80007c:	68 c9 39 80 00       	push   $0x8039c9
+  800081:	e8 b6 02 00 00       	call   80033c <_panic>
+
+00800086 <cpu_msec>:
+  800086:	55                   	push   %ebp
+  800087:	89 e5                	mov    %esp,%ebp
+  800089:	81 ec e0 00 00 00    	sub    $0xe0,%esp
+  80008f:	8d 95 28 ff ff ff    	lea    -0xd8(%ebp),%edx
+  800095:	52                   	push   %edx
+  800096:	50                   	push   %eax
+  800097:	e8 7a 16 00 00       	call   801716 <sys_env_stats>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	78 08                	js     8000ab <cpu_msec+0x25>
+  8000a3:	8b 85 30 ff ff ff    	mov    -0xd0(%ebp),%eax
+  8000a9:	c9                   	leave
+  8000aa:	c3                   	ret
+  8000ab:	50                   	push   %eax
+  8000ac:	68 f0 39 80 00       	push   $0x8039f0
+  8000b1:	6a 27                	push   $0x27
+  8000b3:	68 c9 39 80 00       	push   $0x8039c9
+  8000b8:	e8 7f 02 00 00       	call   80033c <_panic>
+
+008000bd <umain>:
+  8000bd:	55                   	push   %ebp
+  8000be:	89 e5                	mov    %esp,%ebp
+  8000c0:	57                   	push   %edi
+  8000c1:	56                   	push   %esi
+  8000c2:	53                   	push   %ebx
+  8000c3:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  8000c9:	6a 03                	push   $0x3
+  8000cb:	e8 90 1e 00 00       	call   801f60 <ipc_find_env>
+  8000d0:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  8000d6:	83 c4 0c             	add    $0xc,%esp
+  8000d9:	68 00 40 00 00       	push   $0x4000
+  8000de:	6a 00                	push   $0x0
+  8000e0:	6a 00                	push   $0x0
+  8000e2:	e8 cb 15 00 00       	call   8016b2 <sys_env_set_sched>
+  8000e7:	83 c4 08             	add    $0x8,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	b8 08 3a 80 00       	mov    $0x803a08,%eax
+  8000f1:	ba 02 3a 80 00       	mov    $0x803a02,%edx
+  8000f6:	0f 48 c2             	cmovs  %edx,%eax
+  8000f9:	50                   	push   %eax
+  8000fa:	68 5c 3a 80 00       	push   $0x803a5c
+  8000ff:	e8 13 03 00 00       	call   800417 <cprintf>
+  800104:	b8 00 04 00 00       	mov    $0x400,%eax
+  800109:	e8 25 ff ff ff       	call   800033 <spinner>
+  80010e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800114:	b8 00 01 00 00       	mov    $0x100,%eax
+  800119:	e8 15 ff ff ff       	call   800033 <spinner>
+  80011e:	89 85 48 ff ff ff    	mov    %eax,-0xb8(%ebp)
+  800124:	e8 0f 12 00 00       	call   801338 <sys_time_msec>
+  800129:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80012f:	83 c4 10             	add    $0x10,%esp
+  800132:	bf 00 00 00 00       	mov    $0x0,%edi
+  800137:	be 00 00 00 00       	mov    $0x0,%esi
+  80013c:	eb 29                	jmp    800167 <umain+0xaa>
+  80013e:	50                   	push   %eax
+  80013f:	68 14 3a 80 00       	push   $0x803a14
+  800144:	6a 40                	push   $0x40
+  800146:	68 c9 39 80 00       	push   $0x8039c9
+  80014b:	e8 ec 01 00 00       	call   80033c <_panic>
+  800150:	50                   	push   %eax
+  800151:	68 1d 3a 80 00       	push   $0x803a1d
+  800156:	6a 46                	push   $0x46
+  800158:	68 c9 39 80 00       	push   $0x8039c9
+  80015d:	e8 da 01 00 00       	call   80033c <_panic>
+  800162:	e8 bc 0d 00 00       	call   800f23 <sys_yield>
+  800167:	e8 cc 11 00 00       	call   801338 <sys_time_msec>
+  80016c:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  800172:	29 c8                	sub    %ecx,%eax
+  800174:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+  800179:	77 70                	ja     8001eb <umain+0x12e>
+  80017b:	e8 b8 11 00 00       	call   801338 <sys_time_msec>
+  800180:	89 c3                	mov    %eax,%ebx
+  800182:	83 ec 08             	sub    $0x8,%esp
+  800185:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	68 0e 3a 80 00       	push   $0x803a0e
+  800191:	e8 37 23 00 00       	call   8024cd <stat>
+  800196:	83 c4 10             	add    $0x10,%esp
+  800199:	85 c0                	test   %eax,%eax
+  80019b:	78 a1                	js     80013e <umain+0x81>
+  80019d:	e8 96 11 00 00       	call   801338 <sys_time_msec>
+  8001a2:	29 d8                	sub    %ebx,%eax
+  8001a4:	39 c6                	cmp    %eax,%esi
+  8001a6:	0f 42 f0             	cmovb  %eax,%esi
+  8001a9:	83 bd 50 ff ff ff 00 	cmpl   $0x0,-0xb0(%ebp)
+  8001b0:	74 b0                	je     800162 <umain+0xa5>
+  8001b2:	e8 81 11 00 00       	call   801338 <sys_time_msec>
+  8001b7:	89 c3                	mov    %eax,%ebx
+  8001b9:	83 ec 04             	sub    $0x4,%esp
+  8001bc:	6a 06                	push   $0x6
+  8001be:	6a 01                	push   $0x1
+  8001c0:	6a 02                	push   $0x2
+  8001c2:	e8 a5 2b 00 00       	call   802d6c <socket>
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 82                	js     800150 <umain+0x93>
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	50                   	push   %eax
+  8001d2:	e8 40 1f 00 00       	call   802117 <close>
+  8001d7:	e8 5c 11 00 00       	call   801338 <sys_time_msec>
+  8001dc:	29 d8                	sub    %ebx,%eax
+  8001de:	39 c7                	cmp    %eax,%edi
+  8001e0:	0f 42 f8             	cmovb  %eax,%edi
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	e9 77 ff ff ff       	jmp    800162 <umain+0xa5>
+  8001eb:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  8001f1:	e8 90 fe ff ff       	call   800086 <cpu_msec>
+  8001f6:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8001fc:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+  800202:	e8 7f fe ff ff       	call   800086 <cpu_msec>
+  800207:	89 c3                	mov    %eax,%ebx
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  80020c:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  800212:	e8 ac 0c 00 00       	call   800ec3 <sys_env_destroy>
+  800217:	83 c4 04             	add    $0x4,%esp
+  80021a:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+  800220:	e8 9e 0c 00 00       	call   800ec3 <sys_env_destroy>
+  800225:	83 c4 0c             	add    $0xc,%esp
+  800228:	53                   	push   %ebx
+  800229:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80022f:	68 28 3a 80 00       	push   $0x803a28
+  800234:	e8 de 01 00 00       	call   800417 <cprintf>
+  800239:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+  80023c:	83 c4 10             	add    $0x10,%esp
+  80023f:	b8 08 3a 80 00       	mov    $0x803a08,%eax
+  800244:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  80024a:	39 d1                	cmp    %edx,%ecx
+  80024c:	72 12                	jb     800260 <umain+0x1a3>
+  80024e:	c1 e3 03             	shl    $0x3,%ebx
+  800251:	39 cb                	cmp    %ecx,%ebx
+  800253:	b8 02 3a 80 00       	mov    $0x803a02,%eax
+  800258:	ba 08 3a 80 00       	mov    $0x803a08,%edx
+  80025d:	0f 42 c2             	cmovb  %edx,%eax
+  800260:	83 ec 08             	sub    $0x8,%esp
+  800263:	50                   	push   %eax
+  800264:	68 45 3a 80 00       	push   $0x803a45
+  800269:	e8 a9 01 00 00       	call   800417 <cprintf>
+  80026e:	83 c4 0c             	add    $0xc,%esp
+  800271:	83 fe 32             	cmp    $0x32,%esi
+  800274:	b8 08 3a 80 00       	mov    $0x803a08,%eax
+  800279:	ba 02 3a 80 00       	mov    $0x803a02,%edx
+  80027e:	0f 46 c2             	cmovbe %edx,%eax
+  800281:	50                   	push   %eax
+  800282:	56                   	push   %esi
+  800283:	68 80 3a 80 00       	push   $0x803a80
+  800288:	e8 8a 01 00 00       	call   800417 <cprintf>
+  80028d:	83 c4 10             	add    $0x10,%esp
+  800290:	83 bd 50 ff ff ff 00 	cmpl   $0x0,-0xb0(%ebp)
+  800297:	74 22                	je     8002bb <umain+0x1fe>
+  800299:	83 ff 32             	cmp    $0x32,%edi
+  80029c:	b8 08 3a 80 00       	mov    $0x803a08,%eax
+  8002a1:	ba 02 3a 80 00       	mov    $0x803a02,%edx
+  8002a6:	0f 46 c2             	cmovbe %edx,%eax
+  8002a9:	83 ec 04             	sub    $0x4,%esp
+  8002ac:	50                   	push   %eax
+  8002ad:	57                   	push   %edi
+  8002ae:	68 a0 3a 80 00       	push   $0x803aa0
+  8002b3:	e8 5f 01 00 00       	call   800417 <cprintf>
+  8002b8:	83 c4 10             	add    $0x10,%esp
+  8002bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002be:	5b                   	pop    %ebx
+  8002bf:	5e                   	pop    %esi
+  8002c0:	5f                   	pop    %edi
+  8002c1:	5d                   	pop    %ebp
+  8002c2:	c3                   	ret
+
+008002c3 <libmain>:
+  8002c3:	55                   	push   %ebp
+  8002c4:	89 e5                	mov    %esp,%ebp
+  8002c6:	56                   	push   %esi
+  8002c7:	53                   	push   %ebx
+  8002c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8002ce:	e8 31 0c 00 00       	call   800f04 <sys_getenvid>
+  8002d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002d8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8002de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002e3:	a3 14 60 80 00       	mov    %eax,0x806014
+  8002e8:	85 db                	test   %ebx,%ebx
+  8002ea:	7e 07                	jle    8002f3 <libmain+0x30>
+  8002ec:	8b 06                	mov    (%esi),%eax
+  8002ee:	a3 00 50 80 00       	mov    %eax,0x805000
+  8002f3:	83 ec 08             	sub    $0x8,%esp
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	e8 c0 fd ff ff       	call   8000bd <umain>
+  8002fd:	e8 0a 00 00 00       	call   80030c <exit>
+  800302:	83 c4 10             	add    $0x10,%esp
+  800305:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800308:	5b                   	pop    %ebx
+  800309:	5e                   	pop    %esi
+  80030a:	5d                   	pop    %ebp
+  80030b:	c3                   	ret
+
+0080030c <exit>:
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	83 ec 08             	sub    $0x8,%esp
+  800312:	a1 14 60 80 00       	mov    0x806014,%eax
+  800317:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80031d:	85 c0                	test   %eax,%eax
+  80031f:	75 14                	jne    800335 <exit+0x29>
+  800321:	e8 1e 1e 00 00       	call   802144 <close_all>
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	6a 00                	push   $0x0
+  80032b:	e8 93 0b 00 00       	call   800ec3 <sys_env_destroy>
+  800330:	83 c4 10             	add    $0x10,%esp
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+  800335:	e8 f6 12 00 00       	call   801630 <sys_lease_complete>
+  80033a:	eb e5                	jmp    800321 <exit+0x15>
+
+0080033c <_panic>:
+  80033c:	55                   	push   %ebp
+  80033d:	89 e5                	mov    %esp,%ebp
+  80033f:	56                   	push   %esi
+  800340:	53                   	push   %ebx
+  800341:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800344:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80034a:	e8 b5 0b 00 00       	call   800f04 <sys_getenvid>
+  80034f:	83 ec 0c             	sub    $0xc,%esp
+  800352:	ff 75 0c             	push   0xc(%ebp)
+  800355:	ff 75 08             	push   0x8(%ebp)
+  800358:	56                   	push   %esi
+  800359:	50                   	push   %eax
+  80035a:	68 d0 3a 80 00       	push   $0x803ad0
+  80035f:	e8 b3 00 00 00       	call   800417 <cprintf>
+  800364:	83 c4 18             	add    $0x18,%esp
+  800367:	53                   	push   %ebx
+  800368:	ff 75 10             	push   0x10(%ebp)
+  80036b:	e8 56 00 00 00       	call   8003c6 <vcprintf>
+  800370:	c7 04 24 43 3a 80 00 	movl   $0x803a43,(%esp)
+  800377:	e8 9b 00 00 00       	call   800417 <cprintf>
+  80037c:	83 c4 10             	add    $0x10,%esp
+  80037f:	cc                   	int3
+  800380:	eb fd                	jmp    80037f <_panic+0x43>
+
+00800382 <putch>:
+  800382:	55                   	push   %ebp
+  800383:	89 e5                	mov    %esp,%ebp
+  800385:	53                   	push   %ebx
+  800386:	83 ec 04             	sub    $0x4,%esp
+  800389:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80038c:	8b 13                	mov    (%ebx),%edx
+  80038e:	8d 42 01             	lea    0x1(%edx),%eax
+  800391:	89 03                	mov    %eax,(%ebx)
+  800393:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800396:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80039a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80039f:	74 09                	je     8003aa <putch+0x28>
+  8003a1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8003a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a8:	c9                   	leave
+  8003a9:	c3                   	ret
+  8003aa:	83 ec 08             	sub    $0x8,%esp
+  8003ad:	68 ff 00 00 00       	push   $0xff
+  8003b2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003b5:	50                   	push   %eax
+  8003b6:	e8 cb 0a 00 00       	call   800e86 <sys_cputs>
+  8003bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003c1:	83 c4 10             	add    $0x10,%esp
+  8003c4:	eb db                	jmp    8003a1 <putch+0x1f>
+
+008003c6 <vcprintf>:
+  8003c6:	55                   	push   %ebp
+  8003c7:	89 e5                	mov    %esp,%ebp
+  8003c9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8003cf:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003d6:	00 00 00 
+  8003d9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003e0:	00 00 00 
+  8003e3:	ff 75 0c             	push   0xc(%ebp)
+  8003e6:	ff 75 08             	push   0x8(%ebp)
+  8003e9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003ef:	50                   	push   %eax
+  8003f0:	68 82 03 80 00       	push   $0x800382
+  8003f5:	e8 1c 01 00 00       	call   800516 <vprintfmt>
+  8003fa:	83 c4 08             	add    $0x8,%esp
+  8003fd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800403:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800409:	50                   	push   %eax
+  80040a:	e8 77 0a 00 00       	call   800e86 <sys_cputs>
+  80040f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800415:	c9                   	leave
+  800416:	c3                   	ret
+
+00800417 <cprintf>:
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	83 ec 10             	sub    $0x10,%esp
+  80041d:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800420:	50                   	push   %eax
+  800421:	ff 75 08             	push   0x8(%ebp)
+  800424:	e8 9d ff ff ff       	call   8003c6 <vcprintf>
+  800429:	c9                   	leave
+  80042a:	c3                   	ret
+
+0080042b <printnum>:
+  80042b:	55                   	push   %ebp
+  80042c:	89 e5                	mov    %esp,%ebp
+  80042e:	57                   	push   %edi
+  80042f:	56                   	push   %esi
+  800430:	53                   	push   %ebx
+  800431:	83 ec 1c             	sub    $0x1c,%esp
+  800434:	89 c3                	mov    %eax,%ebx
+  800436:	89 d6                	mov    %edx,%esi
+  800438:	8b 45 08             	mov    0x8(%ebp),%eax
+  80043b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80043e:	89 d1                	mov    %edx,%ecx
+  800440:	89 c2                	mov    %eax,%edx
+  800442:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800445:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800448:	8b 45 10             	mov    0x10(%ebp),%eax
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800455:	39 c2                	cmp    %eax,%edx
+  800457:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80045a:	73 4b                	jae    8004a7 <printnum+0x7c>
+  80045c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800462:	85 ff                	test   %edi,%edi
+  800464:	7e 11                	jle    800477 <printnum+0x4c>
+  800466:	83 ec 08             	sub    $0x8,%esp
+  800469:	56                   	push   %esi
+  80046a:	ff 75 18             	push   0x18(%ebp)
+  80046d:	ff d3                	call   *%ebx
+  80046f:	83 c4 10             	add    $0x10,%esp
+  800472:	83 ef 01             	sub    $0x1,%edi
+  800475:	75 ef                	jne    800466 <printnum+0x3b>
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	56                   	push   %esi
+  80047b:	83 ec 04             	sub    $0x4,%esp
+  80047e:	ff 75 e4             	push   -0x1c(%ebp)
+  800481:	ff 75 e0             	push   -0x20(%ebp)
+  800484:	ff 75 dc             	push   -0x24(%ebp)
+  800487:	ff 75 d8             	push   -0x28(%ebp)
+  80048a:	e8 24 34 00 00       	call   8038b3 <__umoddi3>
+  80048f:	83 c4 14             	add    $0x14,%esp
+  800492:	0f be 80 f3 3a 80 00 	movsbl 0x803af3(%eax),%eax
+  800499:	50                   	push   %eax
+  80049a:	ff d3                	call   *%ebx
+  80049c:	83 c4 10             	add    $0x10,%esp
+  80049f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a2:	5b                   	pop    %ebx
+  8004a3:	5e                   	pop    %esi
+  8004a4:	5f                   	pop    %edi
+  8004a5:	5d                   	pop    %ebp
+  8004a6:	c3                   	ret
+  8004a7:	83 ec 0c             	sub    $0xc,%esp
+  8004aa:	ff 75 18             	push   0x18(%ebp)
+  8004ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004b0:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004b3:	52                   	push   %edx
+  8004b4:	50                   	push   %eax
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+  8004b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004bb:	ff 75 e0             	push   -0x20(%ebp)
+  8004be:	ff 75 dc             	push   -0x24(%ebp)
+  8004c1:	ff 75 d8             	push   -0x28(%ebp)
+  8004c4:	e8 cc 33 00 00       	call   803895 <__udivdi3>
+  8004c9:	83 c4 18             	add    $0x18,%esp
+  8004cc:	52                   	push   %edx
+  8004cd:	50                   	push   %eax
+  8004ce:	89 f2                	mov    %esi,%edx
+  8004d0:	89 d8                	mov    %ebx,%eax
+  8004d2:	e8 54 ff ff ff       	call   80042b <printnum>
+  8004d7:	83 c4 20             	add    $0x20,%esp
+  8004da:	eb 9b                	jmp    800477 <printnum+0x4c>
+
+008004dc <sprintputch>:
+  8004dc:	55                   	push   %ebp
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004e2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8004e6:	8b 10                	mov    (%eax),%edx
+  8004e8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004eb:	73 0a                	jae    8004f7 <sprintputch+0x1b>
+  8004ed:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004f0:	89 08                	mov    %ecx,(%eax)
+  8004f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f5:	88 02                	mov    %al,(%edx)
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+
+008004f9 <printfmt>:
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	8d 45 14             	lea    0x14(%ebp),%eax
+  800502:	50                   	push   %eax
+  800503:	ff 75 10             	push   0x10(%ebp)
+  800506:	ff 75 0c             	push   0xc(%ebp)
+  800509:	ff 75 08             	push   0x8(%ebp)
+  80050c:	e8 05 00 00 00       	call   800516 <vprintfmt>
+  800511:	83 c4 10             	add    $0x10,%esp
+  800514:	c9                   	leave
+  800515:	c3                   	ret
+
+00800516 <vprintfmt>:
+  800516:	55                   	push   %ebp
+  800517:	89 e5                	mov    %esp,%ebp
+  800519:	57                   	push   %edi
+  80051a:	56                   	push   %esi
+  80051b:	53                   	push   %ebx
+  80051c:	83 ec 2c             	sub    $0x2c,%esp
+  80051f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800522:	89 df                	mov    %ebx,%edi
+  800524:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800527:	8b 45 10             	mov    0x10(%ebp),%eax
+  80052a:	8d 70 01             	lea    0x1(%eax),%esi
+  80052d:	0f b6 00             	movzbl (%eax),%eax
+  800530:	83 f8 25             	cmp    $0x25,%eax
+  800533:	74 1e                	je     800553 <vprintfmt+0x3d>
+  800535:	85 c0                	test   %eax,%eax
+  800537:	0f 84 15 05 00 00    	je     800a52 <vprintfmt+0x53c>
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	53                   	push   %ebx
+  800541:	50                   	push   %eax
+  800542:	ff d7                	call   *%edi
+  800544:	83 c6 01             	add    $0x1,%esi
+  800547:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	83 f8 25             	cmp    $0x25,%eax
+  800551:	75 e2                	jne    800535 <vprintfmt+0x1f>
+  800553:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800557:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80055e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800565:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80056c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800571:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800574:	8d 56 01             	lea    0x1(%esi),%edx
+  800577:	0f b6 0e             	movzbl (%esi),%ecx
+  80057a:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80057d:	3c 55                	cmp    $0x55,%al
+  80057f:	0f 87 3b 04 00 00    	ja     8009c0 <vprintfmt+0x4aa>
+  800585:	0f b6 c0             	movzbl %al,%eax
+  800588:	ff 24 85 40 3c 80 00 	jmp    *0x803c40(,%eax,4)
+  80058f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800592:	eb 93                	jmp    800527 <vprintfmt+0x11>
+  800594:	89 d6                	mov    %edx,%esi
+  800596:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80059a:	eb d8                	jmp    800574 <vprintfmt+0x5e>
+  80059c:	89 d6                	mov    %edx,%esi
+  80059e:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005a2:	eb d0                	jmp    800574 <vprintfmt+0x5e>
+  8005a4:	0f b6 c9             	movzbl %cl,%ecx
+  8005a7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005aa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8005ad:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8005b1:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005b4:	83 f9 09             	cmp    $0x9,%ecx
+  8005b7:	77 6f                	ja     800628 <vprintfmt+0x112>
+  8005b9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8005bc:	83 c2 01             	add    $0x1,%edx
+  8005bf:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8005c2:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8005c6:	0f be 02             	movsbl (%edx),%eax
+  8005c9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005cc:	83 fe 09             	cmp    $0x9,%esi
+  8005cf:	76 eb                	jbe    8005bc <vprintfmt+0xa6>
+  8005d1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8005d4:	89 d6                	mov    %edx,%esi
+  8005d6:	eb 13                	jmp    8005eb <vprintfmt+0xd5>
+  8005d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005db:	8b 00                	mov    (%eax),%eax
+  8005dd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e9:	89 d6                	mov    %edx,%esi
+  8005eb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005ef:	79 83                	jns    800574 <vprintfmt+0x5e>
+  8005f1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005f7:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8005fe:	e9 71 ff ff ff       	jmp    800574 <vprintfmt+0x5e>
+  800603:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800606:	85 c9                	test   %ecx,%ecx
+  800608:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060d:	0f 49 c1             	cmovns %ecx,%eax
+  800610:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800613:	89 d6                	mov    %edx,%esi
+  800615:	e9 5a ff ff ff       	jmp    800574 <vprintfmt+0x5e>
+  80061a:	89 d6                	mov    %edx,%esi
+  80061c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800623:	e9 4c ff ff ff       	jmp    800574 <vprintfmt+0x5e>
+  800628:	89 d6                	mov    %edx,%esi
+  80062a:	eb bf                	jmp    8005eb <vprintfmt+0xd5>
+  80062c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800630:	89 d6                	mov    %edx,%esi
+  800632:	e9 3d ff ff ff       	jmp    800574 <vprintfmt+0x5e>
+  800637:	89 55 10             	mov    %edx,0x10(%ebp)
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8d 70 04             	lea    0x4(%eax),%esi
+  800640:	83 ec 08             	sub    $0x8,%esp
+  800643:	53                   	push   %ebx
+  800644:	ff 30                	push   (%eax)
+  800646:	ff d7                	call   *%edi
+  800648:	83 c4 10             	add    $0x10,%esp
+  80064b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80064e:	e9 d4 fe ff ff       	jmp    800527 <vprintfmt+0x11>
+  800653:	89 55 10             	mov    %edx,0x10(%ebp)
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8d 70 04             	lea    0x4(%eax),%esi
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	89 d0                	mov    %edx,%eax
+  800660:	f7 d8                	neg    %eax
+  800662:	0f 48 c2             	cmovs  %edx,%eax
+  800665:	83 f8 12             	cmp    $0x12,%eax
+  800668:	7f 23                	jg     80068d <vprintfmt+0x177>
+  80066a:	8b 14 85 a0 3d 80 00 	mov    0x803da0(,%eax,4),%edx
+  800671:	85 d2                	test   %edx,%edx
+  800673:	74 18                	je     80068d <vprintfmt+0x177>
+  800675:	52                   	push   %edx
+  800676:	68 4f 40 80 00       	push   $0x80404f
+  80067b:	53                   	push   %ebx
+  80067c:	57                   	push   %edi
+  80067d:	e8 77 fe ff ff       	call   8004f9 <printfmt>
+  800682:	83 c4 10             	add    $0x10,%esp
+  800685:	89 75 14             	mov    %esi,0x14(%ebp)
+  800688:	e9 9a fe ff ff       	jmp    800527 <vprintfmt+0x11>
+  80068d:	50                   	push   %eax
+  80068e:	68 0b 3b 80 00       	push   $0x803b0b
+  800693:	53                   	push   %ebx
+  800694:	57                   	push   %edi
+  800695:	e8 5f fe ff ff       	call   8004f9 <printfmt>
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006a0:	e9 82 fe ff ff       	jmp    800527 <vprintfmt+0x11>
+  8006a5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	83 c0 04             	add    $0x4,%eax
+  8006ae:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8b 00                	mov    (%eax),%eax
+  8006b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006b9:	85 c0                	test   %eax,%eax
+  8006bb:	0f 84 61 03 00 00    	je     800a22 <vprintfmt+0x50c>
+  8006c1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006c5:	7e 06                	jle    8006cd <vprintfmt+0x1b7>
+  8006c7:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8006cb:	75 29                	jne    8006f6 <vprintfmt+0x1e0>
+  8006cd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006d0:	8d 70 01             	lea    0x1(%eax),%esi
+  8006d3:	0f b6 00             	movzbl (%eax),%eax
+  8006d6:	0f be d0             	movsbl %al,%edx
+  8006d9:	85 d2                	test   %edx,%edx
+  8006db:	0f 84 bb 00 00 00    	je     80079c <vprintfmt+0x286>
+  8006e1:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006e4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006e7:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006ea:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006ed:	eb 7a                	jmp    800769 <vprintfmt+0x253>
+  8006ef:	c7 45 d0 04 3b 80 00 	movl   $0x803b04,-0x30(%ebp)
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	ff 75 d4             	push   -0x2c(%ebp)
+  8006fc:	ff 75 d0             	push   -0x30(%ebp)
+  8006ff:	e8 e0 03 00 00       	call   800ae4 <strnlen>
+  800704:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800707:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80070a:	83 c4 10             	add    $0x10,%esp
+  80070d:	85 d2                	test   %edx,%edx
+  80070f:	0f 8e d6 02 00 00    	jle    8009eb <vprintfmt+0x4d5>
+  800715:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800719:	83 ec 08             	sub    $0x8,%esp
+  80071c:	53                   	push   %ebx
+  80071d:	56                   	push   %esi
+  80071e:	ff d7                	call   *%edi
+  800720:	83 c4 10             	add    $0x10,%esp
+  800723:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800727:	75 f0                	jne    800719 <vprintfmt+0x203>
+  800729:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80072c:	8d 70 01             	lea    0x1(%eax),%esi
+  80072f:	0f b6 00             	movzbl (%eax),%eax
+  800732:	0f be d0             	movsbl %al,%edx
+  800735:	85 d2                	test   %edx,%edx
+  800737:	0f 84 da 02 00 00    	je     800a17 <vprintfmt+0x501>
+  80073d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800740:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800743:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800746:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800749:	eb 1e                	jmp    800769 <vprintfmt+0x253>
+  80074b:	83 ec 08             	sub    $0x8,%esp
+  80074e:	ff 75 0c             	push   0xc(%ebp)
+  800751:	52                   	push   %edx
+  800752:	ff 55 08             	call   *0x8(%ebp)
+  800755:	83 c4 10             	add    $0x10,%esp
+  800758:	83 eb 01             	sub    $0x1,%ebx
+  80075b:	83 c6 01             	add    $0x1,%esi
+  80075e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800762:	0f be d0             	movsbl %al,%edx
+  800765:	85 d2                	test   %edx,%edx
+  800767:	74 2a                	je     800793 <vprintfmt+0x27d>
+  800769:	85 ff                	test   %edi,%edi
+  80076b:	78 05                	js     800772 <vprintfmt+0x25c>
+  80076d:	83 ef 01             	sub    $0x1,%edi
+  800770:	78 59                	js     8007cb <vprintfmt+0x2b5>
+  800772:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800776:	74 d3                	je     80074b <vprintfmt+0x235>
+  800778:	0f be c0             	movsbl %al,%eax
+  80077b:	83 e8 20             	sub    $0x20,%eax
+  80077e:	83 f8 5e             	cmp    $0x5e,%eax
+  800781:	76 c8                	jbe    80074b <vprintfmt+0x235>
+  800783:	83 ec 08             	sub    $0x8,%esp
+  800786:	ff 75 0c             	push   0xc(%ebp)
+  800789:	6a 3f                	push   $0x3f
+  80078b:	ff 55 08             	call   *0x8(%ebp)
+  80078e:	83 c4 10             	add    $0x10,%esp
+  800791:	eb c5                	jmp    800758 <vprintfmt+0x242>
+  800793:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800796:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800799:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80079c:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80079f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007a3:	7e 1b                	jle    8007c0 <vprintfmt+0x2aa>
+  8007a5:	83 ec 08             	sub    $0x8,%esp
+  8007a8:	53                   	push   %ebx
+  8007a9:	6a 20                	push   $0x20
+  8007ab:	ff d7                	call   *%edi
+  8007ad:	83 c4 10             	add    $0x10,%esp
+  8007b0:	83 ee 01             	sub    $0x1,%esi
+  8007b3:	75 f0                	jne    8007a5 <vprintfmt+0x28f>
+  8007b5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bb:	e9 67 fd ff ff       	jmp    800527 <vprintfmt+0x11>
+  8007c0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c6:	e9 5c fd ff ff       	jmp    800527 <vprintfmt+0x11>
+  8007cb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007d4:	eb c6                	jmp    80079c <vprintfmt+0x286>
+  8007d6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007d9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007dc:	83 f9 01             	cmp    $0x1,%ecx
+  8007df:	7f 1f                	jg     800800 <vprintfmt+0x2ea>
+  8007e1:	85 c9                	test   %ecx,%ecx
+  8007e3:	74 67                	je     80084c <vprintfmt+0x336>
+  8007e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e8:	8b 30                	mov    (%eax),%esi
+  8007ea:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007ed:	89 f0                	mov    %esi,%eax
+  8007ef:	c1 f8 1f             	sar    $0x1f,%eax
+  8007f2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fe:	eb 17                	jmp    800817 <vprintfmt+0x301>
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 50 04             	mov    0x4(%eax),%edx
+  800806:	8b 00                	mov    (%eax),%eax
+  800808:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80080b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8d 40 08             	lea    0x8(%eax),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+  800817:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80081a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80081d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800822:	85 c9                	test   %ecx,%ecx
+  800824:	0f 89 12 01 00 00    	jns    80093c <vprintfmt+0x426>
+  80082a:	83 ec 08             	sub    $0x8,%esp
+  80082d:	53                   	push   %ebx
+  80082e:	6a 2d                	push   $0x2d
+  800830:	ff d7                	call   *%edi
+  800832:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800835:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800838:	f7 da                	neg    %edx
+  80083a:	83 d1 00             	adc    $0x0,%ecx
+  80083d:	f7 d9                	neg    %ecx
+  80083f:	83 c4 10             	add    $0x10,%esp
+  800842:	be 0a 00 00 00       	mov    $0xa,%esi
+  800847:	e9 f0 00 00 00       	jmp    80093c <vprintfmt+0x426>
+  80084c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084f:	8b 30                	mov    (%eax),%esi
+  800851:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800854:	89 f0                	mov    %esi,%eax
+  800856:	c1 f8 1f             	sar    $0x1f,%eax
+  800859:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80085c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085f:	8d 40 04             	lea    0x4(%eax),%eax
+  800862:	89 45 14             	mov    %eax,0x14(%ebp)
+  800865:	eb b0                	jmp    800817 <vprintfmt+0x301>
+  800867:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80086a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80086d:	83 f9 01             	cmp    $0x1,%ecx
+  800870:	7f 1e                	jg     800890 <vprintfmt+0x37a>
+  800872:	85 c9                	test   %ecx,%ecx
+  800874:	74 32                	je     8008a8 <vprintfmt+0x392>
+  800876:	8b 45 14             	mov    0x14(%ebp),%eax
+  800879:	8b 10                	mov    (%eax),%edx
+  80087b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800880:	8d 40 04             	lea    0x4(%eax),%eax
+  800883:	89 45 14             	mov    %eax,0x14(%ebp)
+  800886:	be 0a 00 00 00       	mov    $0xa,%esi
+  80088b:	e9 ac 00 00 00       	jmp    80093c <vprintfmt+0x426>
+  800890:	8b 45 14             	mov    0x14(%ebp),%eax
+  800893:	8b 10                	mov    (%eax),%edx
+  800895:	8b 48 04             	mov    0x4(%eax),%ecx
+  800898:	8d 40 08             	lea    0x8(%eax),%eax
+  80089b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089e:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008a3:	e9 94 00 00 00       	jmp    80093c <vprintfmt+0x426>
+  8008a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ab:	8b 10                	mov    (%eax),%edx
+  8008ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008bd:	eb 7d                	jmp    80093c <vprintfmt+0x426>
+  8008bf:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008c2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c5:	83 f9 01             	cmp    $0x1,%ecx
+  8008c8:	7f 1b                	jg     8008e5 <vprintfmt+0x3cf>
+  8008ca:	85 c9                	test   %ecx,%ecx
+  8008cc:	74 2c                	je     8008fa <vprintfmt+0x3e4>
+  8008ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d1:	8b 10                	mov    (%eax),%edx
+  8008d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008de:	be 08 00 00 00       	mov    $0x8,%esi
+  8008e3:	eb 57                	jmp    80093c <vprintfmt+0x426>
+  8008e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e8:	8b 10                	mov    (%eax),%edx
+  8008ea:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f3:	be 08 00 00 00       	mov    $0x8,%esi
+  8008f8:	eb 42                	jmp    80093c <vprintfmt+0x426>
+  8008fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fd:	8b 10                	mov    (%eax),%edx
+  8008ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800904:	8d 40 04             	lea    0x4(%eax),%eax
+  800907:	89 45 14             	mov    %eax,0x14(%ebp)
+  80090a:	be 08 00 00 00       	mov    $0x8,%esi
+  80090f:	eb 2b                	jmp    80093c <vprintfmt+0x426>
+  800911:	89 55 10             	mov    %edx,0x10(%ebp)
+  800914:	83 ec 08             	sub    $0x8,%esp
+  800917:	53                   	push   %ebx
+  800918:	6a 30                	push   $0x30
+  80091a:	ff d7                	call   *%edi
+  80091c:	83 c4 08             	add    $0x8,%esp
+  80091f:	53                   	push   %ebx
+  800920:	6a 78                	push   $0x78
+  800922:	ff d7                	call   *%edi
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8b 10                	mov    (%eax),%edx
+  800929:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092e:	83 c4 10             	add    $0x10,%esp
+  800931:	8d 40 04             	lea    0x4(%eax),%eax
+  800934:	89 45 14             	mov    %eax,0x14(%ebp)
+  800937:	be 10 00 00 00       	mov    $0x10,%esi
+  80093c:	83 ec 0c             	sub    $0xc,%esp
+  80093f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800943:	50                   	push   %eax
+  800944:	ff 75 e4             	push   -0x1c(%ebp)
+  800947:	56                   	push   %esi
+  800948:	51                   	push   %ecx
+  800949:	52                   	push   %edx
+  80094a:	89 da                	mov    %ebx,%edx
+  80094c:	89 f8                	mov    %edi,%eax
+  80094e:	e8 d8 fa ff ff       	call   80042b <printnum>
+  800953:	83 c4 20             	add    $0x20,%esp
+  800956:	e9 cc fb ff ff       	jmp    800527 <vprintfmt+0x11>
+  80095b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80095e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800961:	83 f9 01             	cmp    $0x1,%ecx
+  800964:	7f 1b                	jg     800981 <vprintfmt+0x46b>
+  800966:	85 c9                	test   %ecx,%ecx
+  800968:	74 2c                	je     800996 <vprintfmt+0x480>
+  80096a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096d:	8b 10                	mov    (%eax),%edx
+  80096f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800974:	8d 40 04             	lea    0x4(%eax),%eax
+  800977:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097a:	be 10 00 00 00       	mov    $0x10,%esi
+  80097f:	eb bb                	jmp    80093c <vprintfmt+0x426>
+  800981:	8b 45 14             	mov    0x14(%ebp),%eax
+  800984:	8b 10                	mov    (%eax),%edx
+  800986:	8b 48 04             	mov    0x4(%eax),%ecx
+  800989:	8d 40 08             	lea    0x8(%eax),%eax
+  80098c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80098f:	be 10 00 00 00       	mov    $0x10,%esi
+  800994:	eb a6                	jmp    80093c <vprintfmt+0x426>
+  800996:	8b 45 14             	mov    0x14(%ebp),%eax
+  800999:	8b 10                	mov    (%eax),%edx
+  80099b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a6:	be 10 00 00 00       	mov    $0x10,%esi
+  8009ab:	eb 8f                	jmp    80093c <vprintfmt+0x426>
+  8009ad:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009b0:	83 ec 08             	sub    $0x8,%esp
+  8009b3:	53                   	push   %ebx
+  8009b4:	6a 25                	push   $0x25
+  8009b6:	ff d7                	call   *%edi
+  8009b8:	83 c4 10             	add    $0x10,%esp
+  8009bb:	e9 67 fb ff ff       	jmp    800527 <vprintfmt+0x11>
+  8009c0:	83 ec 08             	sub    $0x8,%esp
+  8009c3:	53                   	push   %ebx
+  8009c4:	6a 25                	push   $0x25
+  8009c6:	ff d7                	call   *%edi
+  8009c8:	83 c4 10             	add    $0x10,%esp
+  8009cb:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8009cf:	0f 84 ba fb ff ff    	je     80058f <vprintfmt+0x79>
+  8009d5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8009d8:	89 f0                	mov    %esi,%eax
+  8009da:	83 e8 01             	sub    $0x1,%eax
+  8009dd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009e1:	75 f7                	jne    8009da <vprintfmt+0x4c4>
+  8009e3:	89 45 10             	mov    %eax,0x10(%ebp)
+  8009e6:	e9 3c fb ff ff       	jmp    800527 <vprintfmt+0x11>
+  8009eb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009ee:	8d 70 01             	lea    0x1(%eax),%esi
+  8009f1:	0f b6 00             	movzbl (%eax),%eax
+  8009f4:	0f be d0             	movsbl %al,%edx
+  8009f7:	85 d2                	test   %edx,%edx
+  8009f9:	74 11                	je     800a0c <vprintfmt+0x4f6>
+  8009fb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009fe:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a01:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a04:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a07:	e9 5d fd ff ff       	jmp    800769 <vprintfmt+0x253>
+  800a0c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a0f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a12:	e9 10 fb ff ff       	jmp    800527 <vprintfmt+0x11>
+  800a17:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a1a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a1d:	e9 05 fb ff ff       	jmp    800527 <vprintfmt+0x11>
+  800a22:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a26:	7e 0a                	jle    800a32 <vprintfmt+0x51c>
+  800a28:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a2c:	0f 85 bd fc ff ff    	jne    8006ef <vprintfmt+0x1d9>
+  800a32:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a37:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a3c:	be 05 3b 80 00       	mov    $0x803b05,%esi
+  800a41:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a44:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a47:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a4a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a4d:	e9 17 fd ff ff       	jmp    800769 <vprintfmt+0x253>
+  800a52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a55:	5b                   	pop    %ebx
+  800a56:	5e                   	pop    %esi
+  800a57:	5f                   	pop    %edi
+  800a58:	5d                   	pop    %ebp
+  800a59:	c3                   	ret
+
+00800a5a <vsnprintf>:
+  800a5a:	55                   	push   %ebp
+  800a5b:	89 e5                	mov    %esp,%ebp
+  800a5d:	83 ec 18             	sub    $0x18,%esp
+  800a60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a66:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a69:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a6d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a70:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800a77:	85 c0                	test   %eax,%eax
+  800a79:	74 26                	je     800aa1 <vsnprintf+0x47>
+  800a7b:	85 d2                	test   %edx,%edx
+  800a7d:	7e 22                	jle    800aa1 <vsnprintf+0x47>
+  800a7f:	ff 75 14             	push   0x14(%ebp)
+  800a82:	ff 75 10             	push   0x10(%ebp)
+  800a85:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a88:	50                   	push   %eax
+  800a89:	68 dc 04 80 00       	push   $0x8004dc
+  800a8e:	e8 83 fa ff ff       	call   800516 <vprintfmt>
+  800a93:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a96:	c6 00 00             	movb   $0x0,(%eax)
+  800a99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a9c:	83 c4 10             	add    $0x10,%esp
+  800a9f:	c9                   	leave
+  800aa0:	c3                   	ret
+  800aa1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aa6:	eb f7                	jmp    800a9f <vsnprintf+0x45>
+
+00800aa8 <snprintf>:
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	83 ec 08             	sub    $0x8,%esp
+  800aae:	8d 45 14             	lea    0x14(%ebp),%eax
+  800ab1:	50                   	push   %eax
+  800ab2:	ff 75 10             	push   0x10(%ebp)
+  800ab5:	ff 75 0c             	push   0xc(%ebp)
+  800ab8:	ff 75 08             	push   0x8(%ebp)
+  800abb:	e8 9a ff ff ff       	call   800a5a <vsnprintf>
+  800ac0:	c9                   	leave
+  800ac1:	c3                   	ret
+
+00800ac2 <strlen>:
+  800ac2:	55                   	push   %ebp
+  800ac3:	89 e5                	mov    %esp,%ebp
+  800ac5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac8:	80 3a 00             	cmpb   $0x0,(%edx)
+  800acb:	74 10                	je     800add <strlen+0x1b>
+  800acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad2:	83 c0 01             	add    $0x1,%eax
+  800ad5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ad9:	75 f7                	jne    800ad2 <strlen+0x10>
+  800adb:	5d                   	pop    %ebp
+  800adc:	c3                   	ret
+  800add:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae2:	eb f7                	jmp    800adb <strlen+0x19>
+
+00800ae4 <strnlen>:
+  800ae4:	55                   	push   %ebp
+  800ae5:	89 e5                	mov    %esp,%ebp
+  800ae7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aed:	85 d2                	test   %edx,%edx
+  800aef:	74 16                	je     800b07 <strnlen+0x23>
+  800af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800afa:	74 09                	je     800b05 <strnlen+0x21>
+  800afc:	83 c0 01             	add    $0x1,%eax
+  800aff:	39 d0                	cmp    %edx,%eax
+  800b01:	75 f3                	jne    800af6 <strnlen+0x12>
+  800b03:	89 d0                	mov    %edx,%eax
+  800b05:	5d                   	pop    %ebp
+  800b06:	c3                   	ret
+  800b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0c:	eb f7                	jmp    800b05 <strnlen+0x21>
+
+00800b0e <strcpy>:
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	53                   	push   %ebx
+  800b12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b15:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b21:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b24:	83 c0 01             	add    $0x1,%eax
+  800b27:	84 d2                	test   %dl,%dl
+  800b29:	75 f2                	jne    800b1d <strcpy+0xf>
+  800b2b:	89 c8                	mov    %ecx,%eax
+  800b2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b30:	c9                   	leave
+  800b31:	c3                   	ret
+
+00800b32 <strcat>:
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	53                   	push   %ebx
+  800b36:	83 ec 10             	sub    $0x10,%esp
+  800b39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800b3c:	53                   	push   %ebx
+  800b3d:	e8 80 ff ff ff       	call   800ac2 <strlen>
+  800b42:	83 c4 08             	add    $0x8,%esp
+  800b45:	ff 75 0c             	push   0xc(%ebp)
+  800b48:	01 d8                	add    %ebx,%eax
+  800b4a:	50                   	push   %eax
+  800b4b:	e8 be ff ff ff       	call   800b0e <strcpy>
+  800b50:	89 d8                	mov    %ebx,%eax
+  800b52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b55:	c9                   	leave
+  800b56:	c3                   	ret
+
+00800b57 <strncpy>:
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	56                   	push   %esi
+  800b5b:	53                   	push   %ebx
+  800b5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b65:	85 db                	test   %ebx,%ebx
+  800b67:	74 17                	je     800b80 <strncpy+0x29>
+  800b69:	01 f3                	add    %esi,%ebx
+  800b6b:	89 f0                	mov    %esi,%eax
+  800b6d:	83 c0 01             	add    $0x1,%eax
+  800b70:	0f b6 0a             	movzbl (%edx),%ecx
+  800b73:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800b76:	80 f9 01             	cmp    $0x1,%cl
+  800b79:	83 da ff             	sbb    $0xffffffff,%edx
+  800b7c:	39 c3                	cmp    %eax,%ebx
+  800b7e:	75 ed                	jne    800b6d <strncpy+0x16>
+  800b80:	89 f0                	mov    %esi,%eax
+  800b82:	5b                   	pop    %ebx
+  800b83:	5e                   	pop    %esi
+  800b84:	5d                   	pop    %ebp
+  800b85:	c3                   	ret
+
+00800b86 <strlcpy>:
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  800b8b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b94:	89 f0                	mov    %esi,%eax
+  800b96:	85 db                	test   %ebx,%ebx
+  800b98:	74 1e                	je     800bb8 <strlcpy+0x32>
+  800b9a:	83 eb 01             	sub    $0x1,%ebx
+  800b9d:	74 16                	je     800bb5 <strlcpy+0x2f>
+  800b9f:	01 f3                	add    %esi,%ebx
+  800ba1:	0f b6 0a             	movzbl (%edx),%ecx
+  800ba4:	84 c9                	test   %cl,%cl
+  800ba6:	74 0d                	je     800bb5 <strlcpy+0x2f>
+  800ba8:	83 c2 01             	add    $0x1,%edx
+  800bab:	83 c0 01             	add    $0x1,%eax
+  800bae:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800bb1:	39 d8                	cmp    %ebx,%eax
+  800bb3:	75 ec                	jne    800ba1 <strlcpy+0x1b>
+  800bb5:	c6 00 00             	movb   $0x0,(%eax)
+  800bb8:	29 f0                	sub    %esi,%eax
+  800bba:	5b                   	pop    %ebx
+  800bbb:	5e                   	pop    %esi
+  800bbc:	5d                   	pop    %ebp
+  800bbd:	c3                   	ret
+
+00800bbe <strcmp>:
+  800bbe:	55                   	push   %ebp
+  800bbf:	89 e5                	mov    %esp,%ebp
+  800bc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bc7:	0f b6 01             	movzbl (%ecx),%eax
+  800bca:	84 c0                	test   %al,%al
+  800bcc:	74 11                	je     800bdf <strcmp+0x21>
+  800bce:	38 02                	cmp    %al,(%edx)
+  800bd0:	75 0d                	jne    800bdf <strcmp+0x21>
+  800bd2:	83 c1 01             	add    $0x1,%ecx
+  800bd5:	83 c2 01             	add    $0x1,%edx
+  800bd8:	0f b6 01             	movzbl (%ecx),%eax
+  800bdb:	84 c0                	test   %al,%al
+  800bdd:	75 ef                	jne    800bce <strcmp+0x10>
+  800bdf:	0f b6 c0             	movzbl %al,%eax
+  800be2:	0f b6 12             	movzbl (%edx),%edx
+  800be5:	29 d0                	sub    %edx,%eax
+  800be7:	5d                   	pop    %ebp
+  800be8:	c3                   	ret
+
+00800be9 <strncmp>:
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	53                   	push   %ebx
+  800bed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bf0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bf3:	8b 55 10             	mov    0x10(%ebp),%edx
+  800bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfb:	85 d2                	test   %edx,%edx
+  800bfd:	74 2e                	je     800c2d <strncmp+0x44>
+  800bff:	0f b6 01             	movzbl (%ecx),%eax
+  800c02:	84 c0                	test   %al,%al
+  800c04:	74 16                	je     800c1c <strncmp+0x33>
+  800c06:	3a 03                	cmp    (%ebx),%al
+  800c08:	75 12                	jne    800c1c <strncmp+0x33>
+  800c0a:	83 c1 01             	add    $0x1,%ecx
+  800c0d:	83 c3 01             	add    $0x1,%ebx
+  800c10:	83 ea 01             	sub    $0x1,%edx
+  800c13:	75 ea                	jne    800bff <strncmp+0x16>
+  800c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1a:	eb 11                	jmp    800c2d <strncmp+0x44>
+  800c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c21:	85 d2                	test   %edx,%edx
+  800c23:	74 08                	je     800c2d <strncmp+0x44>
+  800c25:	0f b6 01             	movzbl (%ecx),%eax
+  800c28:	0f b6 13             	movzbl (%ebx),%edx
+  800c2b:	29 d0                	sub    %edx,%eax
+  800c2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+
+00800c32 <strchr>:
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c38:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800c3c:	0f b6 10             	movzbl (%eax),%edx
+  800c3f:	84 d2                	test   %dl,%dl
+  800c41:	74 15                	je     800c58 <strchr+0x26>
+  800c43:	38 d1                	cmp    %dl,%cl
+  800c45:	74 0f                	je     800c56 <strchr+0x24>
+  800c47:	83 c0 01             	add    $0x1,%eax
+  800c4a:	0f b6 10             	movzbl (%eax),%edx
+  800c4d:	84 d2                	test   %dl,%dl
+  800c4f:	75 f2                	jne    800c43 <strchr+0x11>
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	5d                   	pop    %ebp
+  800c57:	c3                   	ret
+  800c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5d:	eb f7                	jmp    800c56 <strchr+0x24>
+
+00800c5f <strfind>:
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	53                   	push   %ebx
+  800c63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c69:	0f b6 18             	movzbl (%eax),%ebx
+  800c6c:	38 d3                	cmp    %dl,%bl
+  800c6e:	74 14                	je     800c84 <strfind+0x25>
+  800c70:	89 d1                	mov    %edx,%ecx
+  800c72:	84 db                	test   %bl,%bl
+  800c74:	74 0e                	je     800c84 <strfind+0x25>
+  800c76:	83 c0 01             	add    $0x1,%eax
+  800c79:	0f b6 10             	movzbl (%eax),%edx
+  800c7c:	38 ca                	cmp    %cl,%dl
+  800c7e:	74 04                	je     800c84 <strfind+0x25>
+  800c80:	84 d2                	test   %dl,%dl
+  800c82:	75 f2                	jne    800c76 <strfind+0x17>
+  800c84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c87:	c9                   	leave
+  800c88:	c3                   	ret
+
+00800c89 <memset>:
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	57                   	push   %edi
+  800c8d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c90:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c93:	85 c9                	test   %ecx,%ecx
+  800c95:	74 20                	je     800cb7 <memset+0x2e>
+  800c97:	89 f8                	mov    %edi,%eax
+  800c99:	09 c8                	or     %ecx,%eax
+  800c9b:	a8 03                	test   $0x3,%al
+  800c9d:	75 12                	jne    800cb1 <memset+0x28>
+  800c9f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ca3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ca9:	c1 e9 02             	shr    $0x2,%ecx
+  800cac:	fc                   	cld
+  800cad:	f3 ab                	rep stos %eax,%es:(%edi)
+  800caf:	eb 06                	jmp    800cb7 <memset+0x2e>
+  800cb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cb4:	fc                   	cld
+  800cb5:	f3 aa                	rep stos %al,%es:(%edi)
+  800cb7:	89 f8                	mov    %edi,%eax
+  800cb9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cbc:	c9                   	leave
+  800cbd:	c3                   	ret
+
+00800cbe <memmove>:
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	57                   	push   %edi
+  800cc2:	56                   	push   %esi
+  800cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cc9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ccc:	39 c6                	cmp    %eax,%esi
+  800cce:	73 32                	jae    800d02 <memmove+0x44>
+  800cd0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800cd3:	39 d0                	cmp    %edx,%eax
+  800cd5:	73 2b                	jae    800d02 <memmove+0x44>
+  800cd7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800cda:	89 d6                	mov    %edx,%esi
+  800cdc:	09 fe                	or     %edi,%esi
+  800cde:	09 ce                	or     %ecx,%esi
+  800ce0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ce6:	75 0e                	jne    800cf6 <memmove+0x38>
+  800ce8:	83 ef 04             	sub    $0x4,%edi
+  800ceb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800cee:	c1 e9 02             	shr    $0x2,%ecx
+  800cf1:	fd                   	std
+  800cf2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cf4:	eb 09                	jmp    800cff <memmove+0x41>
+  800cf6:	83 ef 01             	sub    $0x1,%edi
+  800cf9:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800cfc:	fd                   	std
+  800cfd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800cff:	fc                   	cld
+  800d00:	eb 1a                	jmp    800d1c <memmove+0x5e>
+  800d02:	89 f2                	mov    %esi,%edx
+  800d04:	09 c2                	or     %eax,%edx
+  800d06:	09 ca                	or     %ecx,%edx
+  800d08:	f6 c2 03             	test   $0x3,%dl
+  800d0b:	75 0a                	jne    800d17 <memmove+0x59>
+  800d0d:	c1 e9 02             	shr    $0x2,%ecx
+  800d10:	89 c7                	mov    %eax,%edi
+  800d12:	fc                   	cld
+  800d13:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d15:	eb 05                	jmp    800d1c <memmove+0x5e>
+  800d17:	89 c7                	mov    %eax,%edi
+  800d19:	fc                   	cld
+  800d1a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5f                   	pop    %edi
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+
+00800d20 <memcpy>:
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	ff 75 10             	push   0x10(%ebp)
+  800d29:	ff 75 0c             	push   0xc(%ebp)
+  800d2c:	ff 75 08             	push   0x8(%ebp)
+  800d2f:	e8 8a ff ff ff       	call   800cbe <memmove>
+  800d34:	c9                   	leave
+  800d35:	c3                   	ret
+
+00800d36 <memcmp>:
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d41:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d44:	85 f6                	test   %esi,%esi
+  800d46:	74 29                	je     800d71 <memcmp+0x3b>
+  800d48:	01 c6                	add    %eax,%esi
+  800d4a:	0f b6 08             	movzbl (%eax),%ecx
+  800d4d:	0f b6 1a             	movzbl (%edx),%ebx
+  800d50:	38 d9                	cmp    %bl,%cl
+  800d52:	75 11                	jne    800d65 <memcmp+0x2f>
+  800d54:	83 c0 01             	add    $0x1,%eax
+  800d57:	83 c2 01             	add    $0x1,%edx
+  800d5a:	39 c6                	cmp    %eax,%esi
+  800d5c:	75 ec                	jne    800d4a <memcmp+0x14>
+  800d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d63:	eb 08                	jmp    800d6d <memcmp+0x37>
+  800d65:	0f b6 c1             	movzbl %cl,%eax
+  800d68:	0f b6 db             	movzbl %bl,%ebx
+  800d6b:	29 d8                	sub    %ebx,%eax
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	eb f5                	jmp    800d6d <memcmp+0x37>
+
+00800d78 <memfind>:
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	89 c2                	mov    %eax,%edx
+  800d83:	03 55 10             	add    0x10(%ebp),%edx
+  800d86:	39 d0                	cmp    %edx,%eax
+  800d88:	73 0d                	jae    800d97 <memfind+0x1f>
+  800d8a:	38 08                	cmp    %cl,(%eax)
+  800d8c:	74 0d                	je     800d9b <memfind+0x23>
+  800d8e:	83 c0 01             	add    $0x1,%eax
+  800d91:	39 c2                	cmp    %eax,%edx
+  800d93:	75 f5                	jne    800d8a <memfind+0x12>
+  800d95:	eb 06                	jmp    800d9d <memfind+0x25>
+  800d97:	89 c2                	mov    %eax,%edx
+  800d99:	eb 02                	jmp    800d9d <memfind+0x25>
+  800d9b:	89 c2                	mov    %eax,%edx
+  800d9d:	89 d0                	mov    %edx,%eax
+  800d9f:	5d                   	pop    %ebp
+  800da0:	c3                   	ret
+
+00800da1 <strtol>:
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	57                   	push   %edi
+  800da5:	56                   	push   %esi
+  800da6:	53                   	push   %ebx
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dad:	0f b6 02             	movzbl (%edx),%eax
+  800db0:	3c 20                	cmp    $0x20,%al
+  800db2:	74 04                	je     800db8 <strtol+0x17>
+  800db4:	3c 09                	cmp    $0x9,%al
+  800db6:	75 0e                	jne    800dc6 <strtol+0x25>
+  800db8:	83 c2 01             	add    $0x1,%edx
+  800dbb:	0f b6 02             	movzbl (%edx),%eax
+  800dbe:	3c 20                	cmp    $0x20,%al
+  800dc0:	74 f6                	je     800db8 <strtol+0x17>
+  800dc2:	3c 09                	cmp    $0x9,%al
+  800dc4:	74 f2                	je     800db8 <strtol+0x17>
+  800dc6:	3c 2b                	cmp    $0x2b,%al
+  800dc8:	74 2a                	je     800df4 <strtol+0x53>
+  800dca:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dcf:	3c 2d                	cmp    $0x2d,%al
+  800dd1:	74 2b                	je     800dfe <strtol+0x5d>
+  800dd3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800dd9:	75 0f                	jne    800dea <strtol+0x49>
+  800ddb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800dde:	74 28                	je     800e08 <strtol+0x67>
+  800de0:	85 db                	test   %ebx,%ebx
+  800de2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800de7:	0f 44 d8             	cmove  %eax,%ebx
+  800dea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800def:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800df2:	eb 46                	jmp    800e3a <strtol+0x99>
+  800df4:	83 c2 01             	add    $0x1,%edx
+  800df7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dfc:	eb d5                	jmp    800dd3 <strtol+0x32>
+  800dfe:	83 c2 01             	add    $0x1,%edx
+  800e01:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e06:	eb cb                	jmp    800dd3 <strtol+0x32>
+  800e08:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e0c:	74 0e                	je     800e1c <strtol+0x7b>
+  800e0e:	85 db                	test   %ebx,%ebx
+  800e10:	75 d8                	jne    800dea <strtol+0x49>
+  800e12:	83 c2 01             	add    $0x1,%edx
+  800e15:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e1a:	eb ce                	jmp    800dea <strtol+0x49>
+  800e1c:	83 c2 02             	add    $0x2,%edx
+  800e1f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e24:	eb c4                	jmp    800dea <strtol+0x49>
+  800e26:	0f be c0             	movsbl %al,%eax
+  800e29:	83 e8 30             	sub    $0x30,%eax
+  800e2c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e2f:	7d 3a                	jge    800e6b <strtol+0xca>
+  800e31:	83 c2 01             	add    $0x1,%edx
+  800e34:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e38:	01 c1                	add    %eax,%ecx
+  800e3a:	0f b6 02             	movzbl (%edx),%eax
+  800e3d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e40:	89 f3                	mov    %esi,%ebx
+  800e42:	80 fb 09             	cmp    $0x9,%bl
+  800e45:	76 df                	jbe    800e26 <strtol+0x85>
+  800e47:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e4a:	89 f3                	mov    %esi,%ebx
+  800e4c:	80 fb 19             	cmp    $0x19,%bl
+  800e4f:	77 08                	ja     800e59 <strtol+0xb8>
+  800e51:	0f be c0             	movsbl %al,%eax
+  800e54:	83 e8 57             	sub    $0x57,%eax
+  800e57:	eb d3                	jmp    800e2c <strtol+0x8b>
+  800e59:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e5c:	89 f3                	mov    %esi,%ebx
+  800e5e:	80 fb 19             	cmp    $0x19,%bl
+  800e61:	77 08                	ja     800e6b <strtol+0xca>
+  800e63:	0f be c0             	movsbl %al,%eax
+  800e66:	83 e8 37             	sub    $0x37,%eax
+  800e69:	eb c1                	jmp    800e2c <strtol+0x8b>
+  800e6b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e6f:	74 05                	je     800e76 <strtol+0xd5>
+  800e71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e74:	89 10                	mov    %edx,(%eax)
+  800e76:	89 c8                	mov    %ecx,%eax
+  800e78:	f7 d8                	neg    %eax
+  800e7a:	85 ff                	test   %edi,%edi
+  800e7c:	0f 45 c8             	cmovne %eax,%ecx
+  800e7f:	89 c8                	mov    %ecx,%eax
+  800e81:	5b                   	pop    %ebx
+  800e82:	5e                   	pop    %esi
+  800e83:	5f                   	pop    %edi
+  800e84:	5d                   	pop    %ebp
+  800e85:	c3                   	ret
+
+00800e86 <sys_cputs>:
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	57                   	push   %edi
+  800e8a:	56                   	push   %esi
+  800e8b:	53                   	push   %ebx
+  800e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	89 c3                	mov    %eax,%ebx
+  800e99:	89 c7                	mov    %eax,%edi
+  800e9b:	89 c6                	mov    %eax,%esi
+  800e9d:	cd 30                	int    $0x30
+  800e9f:	5b                   	pop    %ebx
+  800ea0:	5e                   	pop    %esi
+  800ea1:	5f                   	pop    %edi
+  800ea2:	5d                   	pop    %ebp
+  800ea3:	c3                   	ret
+
+00800ea4 <sys_cgetc>:
+  800ea4:	55                   	push   %ebp
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	57                   	push   %edi
+  800ea8:	56                   	push   %esi
+  800ea9:	53                   	push   %ebx
+  800eaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eaf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eb4:	89 d1                	mov    %edx,%ecx
+  800eb6:	89 d3                	mov    %edx,%ebx
+  800eb8:	89 d7                	mov    %edx,%edi
+  800eba:	89 d6                	mov    %edx,%esi
+  800ebc:	cd 30                	int    $0x30
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+
+00800ec3 <sys_env_destroy>:
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+  800ecc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ed9:	89 cb                	mov    %ecx,%ebx
+  800edb:	89 cf                	mov    %ecx,%edi
+  800edd:	89 ce                	mov    %ecx,%esi
+  800edf:	cd 30                	int    $0x30
+  800ee1:	85 c0                	test   %eax,%eax
+  800ee3:	7f 08                	jg     800eed <sys_env_destroy+0x2a>
+  800ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+  800eed:	83 ec 0c             	sub    $0xc,%esp
+  800ef0:	50                   	push   %eax
+  800ef1:	6a 03                	push   $0x3
+  800ef3:	68 0b 3e 80 00       	push   $0x803e0b
+  800ef8:	6a 24                	push   $0x24
+  800efa:	68 28 3e 80 00       	push   $0x803e28
+  800eff:	e8 38 f4 ff ff       	call   80033c <_panic>
+
+00800f04 <sys_getenvid>:
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	56                   	push   %esi
+  800f09:	53                   	push   %ebx
+  800f0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f14:	89 d1                	mov    %edx,%ecx
+  800f16:	89 d3                	mov    %edx,%ebx
+  800f18:	89 d7                	mov    %edx,%edi
+  800f1a:	89 d6                	mov    %edx,%esi
+  800f1c:	cd 30                	int    $0x30
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+
+00800f23 <sys_yield>:
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	56                   	push   %esi
+  800f28:	53                   	push   %ebx
+  800f29:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f30:	74 26                	je     800f58 <sys_yield+0x35>
+  800f32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f37:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f3c:	89 d1                	mov    %edx,%ecx
+  800f3e:	89 d3                	mov    %edx,%ebx
+  800f40:	89 d7                	mov    %edx,%edi
+  800f42:	6a 00                	push   $0x0
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	8d 35 4f 0f 80 00    	lea    0x800f4f,%esi
+  800f4d:	0f 34                	sysenter
+  800f4f:	5d                   	pop    %ebp
+  800f50:	83 c4 04             	add    $0x4,%esp
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+  800f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f62:	89 d1                	mov    %edx,%ecx
+  800f64:	89 d3                	mov    %edx,%ebx
+  800f66:	89 d7                	mov    %edx,%edi
+  800f68:	89 d6                	mov    %edx,%esi
+  800f6a:	cd 30                	int    $0x30
+  800f6c:	eb e5                	jmp    800f53 <sys_yield+0x30>
+
+00800f6e <sys_page_alloc>:
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+  800f74:	83 ec 0c             	sub    $0xc,%esp
+  800f77:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f82:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8a:	89 f7                	mov    %esi,%edi
+  800f8c:	cd 30                	int    $0x30
+  800f8e:	85 c0                	test   %eax,%eax
+  800f90:	7f 08                	jg     800f9a <sys_page_alloc+0x2c>
+  800f92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f95:	5b                   	pop    %ebx
+  800f96:	5e                   	pop    %esi
+  800f97:	5f                   	pop    %edi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+  800f9a:	83 ec 0c             	sub    $0xc,%esp
+  800f9d:	50                   	push   %eax
+  800f9e:	6a 04                	push   $0x4
+  800fa0:	68 0b 3e 80 00       	push   $0x803e0b
+  800fa5:	6a 24                	push   $0x24
+  800fa7:	68 28 3e 80 00       	push   $0x803e28
+  800fac:	e8 8b f3 ff ff       	call   80033c <_panic>
+
+00800fb1 <sys_page_map>:
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	57                   	push   %edi
+  800fb5:	56                   	push   %esi
+  800fb6:	53                   	push   %ebx
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+  800fba:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fc1:	74 33                	je     800ff6 <sys_page_map+0x45>
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd4:	ff 75 18             	push   0x18(%ebp)
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	8d 35 e2 0f 80 00    	lea    0x800fe2,%esi
+  800fe0:	0f 34                	sysenter
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	83 c4 04             	add    $0x4,%esp
+  800fe6:	89 c2                	mov    %eax,%edx
+  800fe8:	85 c0                	test   %eax,%eax
+  800fea:	7f 3d                	jg     801029 <sys_page_map+0x78>
+  800fec:	89 d0                	mov    %edx,%eax
+  800fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+  800ff6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801004:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801007:	8b 75 18             	mov    0x18(%ebp),%esi
+  80100a:	cd 30                	int    $0x30
+  80100c:	89 c2                	mov    %eax,%edx
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	7e da                	jle    800fec <sys_page_map+0x3b>
+  801012:	83 ec 0c             	sub    $0xc,%esp
+  801015:	50                   	push   %eax
+  801016:	6a 05                	push   $0x5
+  801018:	68 0b 3e 80 00       	push   $0x803e0b
+  80101d:	6a 24                	push   $0x24
+  80101f:	68 28 3e 80 00       	push   $0x803e28
+  801024:	e8 13 f3 ff ff       	call   80033c <_panic>
+  801029:	83 ec 0c             	sub    $0xc,%esp
+  80102c:	50                   	push   %eax
+  80102d:	6a 05                	push   $0x5
+  80102f:	68 0b 3e 80 00       	push   $0x803e0b
+  801034:	6a 48                	push   $0x48
+  801036:	68 28 3e 80 00       	push   $0x803e28
+  80103b:	e8 fc f2 ff ff       	call   80033c <_panic>
+
+00801040 <sys_page_unmap>:
+  801040:	55                   	push   %ebp
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	57                   	push   %edi
+  801044:	56                   	push   %esi
+  801045:	53                   	push   %ebx
+  801046:	83 ec 0c             	sub    $0xc,%esp
+  801049:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	b8 06 00 00 00       	mov    $0x6,%eax
+  801059:	89 df                	mov    %ebx,%edi
+  80105b:	89 de                	mov    %ebx,%esi
+  80105d:	cd 30                	int    $0x30
+  80105f:	85 c0                	test   %eax,%eax
+  801061:	7f 08                	jg     80106b <sys_page_unmap+0x2b>
+  801063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5f                   	pop    %edi
+  801069:	5d                   	pop    %ebp
+  80106a:	c3                   	ret
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+  80106e:	50                   	push   %eax
+  80106f:	6a 06                	push   $0x6
+  801071:	68 0b 3e 80 00       	push   $0x803e0b
+  801076:	6a 24                	push   $0x24
+  801078:	68 28 3e 80 00       	push   $0x803e28
+  80107d:	e8 ba f2 ff ff       	call   80033c <_panic>
+
+00801082 <sys_fork>:
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801092:	89 d1                	mov    %edx,%ecx
+  801094:	89 d3                	mov    %edx,%ebx
+  801096:	89 d7                	mov    %edx,%edi
+  801098:	89 d6                	mov    %edx,%esi
+  80109a:	cd 30                	int    $0x30
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5f                   	pop    %edi
+  80109f:	5d                   	pop    %ebp
+  8010a0:	c3                   	ret
+
+008010a1 <sys_env_set_status>:
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  8010aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ba:	89 df                	mov    %ebx,%edi
+  8010bc:	89 de                	mov    %ebx,%esi
+  8010be:	cd 30                	int    $0x30
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 08                	jg     8010cc <sys_env_set_status+0x2b>
+  8010c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+  8010cf:	50                   	push   %eax
+  8010d0:	6a 08                	push   $0x8
+  8010d2:	68 0b 3e 80 00       	push   $0x803e0b
+  8010d7:	6a 24                	push   $0x24
+  8010d9:	68 28 3e 80 00       	push   $0x803e28
+  8010de:	e8 59 f2 ff ff       	call   80033c <_panic>
+
+008010e3 <sys_env_set_trapframe>:
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  8010ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010fc:	89 df                	mov    %ebx,%edi
+  8010fe:	89 de                	mov    %ebx,%esi
+  801100:	cd 30                	int    $0x30
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 08                	jg     80110e <sys_env_set_trapframe+0x2b>
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 09                	push   $0x9
+  801114:	68 0b 3e 80 00       	push   $0x803e0b
+  801119:	6a 24                	push   $0x24
+  80111b:	68 28 3e 80 00       	push   $0x803e28
+  801120:	e8 17 f2 ff ff       	call   80033c <_panic>
+
+00801125 <sys_env_set_cow>:
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801139:	b8 20 00 00 00       	mov    $0x20,%eax
+  80113e:	89 df                	mov    %ebx,%edi
+  801140:	89 de                	mov    %ebx,%esi
+  801142:	cd 30                	int    $0x30
+  801144:	85 c0                	test   %eax,%eax
+  801146:	7f 08                	jg     801150 <sys_env_set_cow+0x2b>
+  801148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114b:	5b                   	pop    %ebx
+  80114c:	5e                   	pop    %esi
+  80114d:	5f                   	pop    %edi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+  801150:	83 ec 0c             	sub    $0xc,%esp
+  801153:	50                   	push   %eax
+  801154:	6a 20                	push   $0x20
+  801156:	68 0b 3e 80 00       	push   $0x803e0b
+  80115b:	6a 24                	push   $0x24
+  80115d:	68 28 3e 80 00       	push   $0x803e28
+  801162:	e8 d5 f1 ff ff       	call   80033c <_panic>
+
+00801167 <sys_env_service>:
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+  80116d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	b8 21 00 00 00       	mov    $0x21,%eax
+  80117a:	89 cb                	mov    %ecx,%ebx
+  80117c:	89 cf                	mov    %ecx,%edi
+  80117e:	89 ce                	mov    %ecx,%esi
+  801180:	cd 30                	int    $0x30
+  801182:	5b                   	pop    %ebx
+  801183:	5e                   	pop    %esi
+  801184:	5f                   	pop    %edi
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+
+00801187 <sys_env_set_pgfault_upcall>:
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+  80118d:	83 ec 0c             	sub    $0xc,%esp
+  801190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011a0:	89 df                	mov    %ebx,%edi
+  8011a2:	89 de                	mov    %ebx,%esi
+  8011a4:	cd 30                	int    $0x30
+  8011a6:	85 c0                	test   %eax,%eax
+  8011a8:	7f 08                	jg     8011b2 <sys_env_set_pgfault_upcall+0x2b>
+  8011aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+  8011b2:	83 ec 0c             	sub    $0xc,%esp
+  8011b5:	50                   	push   %eax
+  8011b6:	6a 0a                	push   $0xa
+  8011b8:	68 0b 3e 80 00       	push   $0x803e0b
+  8011bd:	6a 24                	push   $0x24
+  8011bf:	68 28 3e 80 00       	push   $0x803e28
+  8011c4:	e8 73 f1 ff ff       	call   80033c <_panic>
+
+008011c9 <sys_ipc_try_send>:
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	57                   	push   %edi
+  8011cd:	56                   	push   %esi
+  8011ce:	53                   	push   %ebx
+  8011cf:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011d6:	74 27                	je     8011ff <sys_ipc_try_send+0x36>
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e9:	6a 00                	push   $0x0
+  8011eb:	55                   	push   %ebp
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	8d 35 f6 11 80 00    	lea    0x8011f6,%esi
+  8011f4:	0f 34                	sysenter
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	83 c4 04             	add    $0x4,%esp
+  8011fa:	5b                   	pop    %ebx
+  8011fb:	5e                   	pop    %esi
+  8011fc:	5f                   	pop    %edi
+  8011fd:	5d                   	pop    %ebp
+  8011fe:	c3                   	ret
+  8011ff:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801204:	be 00 00 00 00       	mov    $0x0,%esi
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801212:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801215:	cd 30                	int    $0x30
+  801217:	eb e1                	jmp    8011fa <sys_ipc_try_send+0x31>
+
+00801219 <sys_ipc_recv>:
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	57                   	push   %edi
+  80121d:	56                   	push   %esi
+  80121e:	53                   	push   %ebx
+  80121f:	83 ec 0c             	sub    $0xc,%esp
+  801222:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801229:	74 32                	je     80125d <sys_ipc_recv+0x44>
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801233:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801238:	89 cb                	mov    %ecx,%ebx
+  80123a:	89 cf                	mov    %ecx,%edi
+  80123c:	6a 00                	push   $0x0
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	8d 35 49 12 80 00    	lea    0x801249,%esi
+  801247:	0f 34                	sysenter
+  801249:	5d                   	pop    %ebp
+  80124a:	83 c4 04             	add    $0x4,%esp
+  80124d:	89 c2                	mov    %eax,%edx
+  80124f:	85 c0                	test   %eax,%eax
+  801251:	7f 3c                	jg     80128f <sys_ipc_recv+0x76>
+  801253:	89 d0                	mov    %edx,%eax
+  801255:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801258:	5b                   	pop    %ebx
+  801259:	5e                   	pop    %esi
+  80125a:	5f                   	pop    %edi
+  80125b:	5d                   	pop    %ebp
+  80125c:	c3                   	ret
+  80125d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801262:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801267:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126a:	89 cb                	mov    %ecx,%ebx
+  80126c:	89 cf                	mov    %ecx,%edi
+  80126e:	89 ce                	mov    %ecx,%esi
+  801270:	cd 30                	int    $0x30
+  801272:	89 c2                	mov    %eax,%edx
+  801274:	85 c0                	test   %eax,%eax
+  801276:	7e db                	jle    801253 <sys_ipc_recv+0x3a>
+  801278:	83 ec 0c             	sub    $0xc,%esp
+  80127b:	50                   	push   %eax
+  80127c:	6a 0d                	push   $0xd
+  80127e:	68 0b 3e 80 00       	push   $0x803e0b
+  801283:	6a 24                	push   $0x24
+  801285:	68 28 3e 80 00       	push   $0x803e28
+  80128a:	e8 ad f0 ff ff       	call   80033c <_panic>
+  80128f:	83 ec 0c             	sub    $0xc,%esp
+  801292:	50                   	push   %eax
+  801293:	6a 0d                	push   $0xd
+  801295:	68 0b 3e 80 00       	push   $0x803e0b
+  80129a:	6a 48                	push   $0x48
+  80129c:	68 28 3e 80 00       	push   $0x803e28
+  8012a1:	e8 96 f0 ff ff       	call   80033c <_panic>
+
+008012a6 <sys_ipc_send>:
+  8012a6:	55                   	push   %ebp
+  8012a7:	89 e5                	mov    %esp,%ebp
+  8012a9:	57                   	push   %edi
+  8012aa:	56                   	push   %esi
+  8012ab:	53                   	push   %ebx
+  8012ac:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8012b3:	74 27                	je     8012dc <sys_ipc_send+0x36>
+  8012b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c6:	6a 00                	push   $0x0
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+  8012cb:	8d 35 d3 12 80 00    	lea    0x8012d3,%esi
+  8012d1:	0f 34                	sysenter
+  8012d3:	5d                   	pop    %ebp
+  8012d4:	83 c4 04             	add    $0x4,%esp
+  8012d7:	5b                   	pop    %ebx
+  8012d8:	5e                   	pop    %esi
+  8012d9:	5f                   	pop    %edi
+  8012da:	5d                   	pop    %ebp
+  8012db:	c3                   	ret
+  8012dc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f2:	cd 30                	int    $0x30
+  8012f4:	eb e1                	jmp    8012d7 <sys_ipc_send+0x31>
+
+008012f6 <sys_ipc_call>:
+  8012f6:	55                   	push   %ebp
+  8012f7:	89 e5                	mov    %esp,%ebp
+  8012f9:	57                   	push   %edi
+  8012fa:	56                   	push   %esi
+  8012fb:	53                   	push   %ebx
+  8012fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801302:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801307:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801310:	cd 30                	int    $0x30
+  801312:	5b                   	pop    %ebx
+  801313:	5e                   	pop    %esi
+  801314:	5f                   	pop    %edi
+  801315:	5d                   	pop    %ebp
+  801316:	c3                   	ret
+
+00801317 <sys_ipc_reply_recv>:
+  801317:	55                   	push   %ebp
+  801318:	89 e5                	mov    %esp,%ebp
+  80131a:	57                   	push   %edi
+  80131b:	56                   	push   %esi
+  80131c:	53                   	push   %ebx
+  80131d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801323:	b8 10 00 00 00       	mov    $0x10,%eax
+  801328:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80132e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801331:	cd 30                	int    $0x30
+  801333:	5b                   	pop    %ebx
+  801334:	5e                   	pop    %esi
+  801335:	5f                   	pop    %edi
+  801336:	5d                   	pop    %ebp
+  801337:	c3                   	ret
+
+00801338 <sys_time_msec>:
+  801338:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	75 06                	jne    801347 <sys_time_msec+0xf>
+  801341:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801346:	c3                   	ret
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	57                   	push   %edi
+  80134b:	56                   	push   %esi
+  80134c:	53                   	push   %ebx
+  80134d:	83 ec 0c             	sub    $0xc,%esp
+  801350:	0f 31                	rdtsc
+  801352:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801358:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80135e:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801364:	29 c8                	sub    %ecx,%eax
+  801366:	19 da                	sbb    %ebx,%edx
+  801368:	bf 00 00 00 00       	mov    $0x0,%edi
+  80136d:	57                   	push   %edi
+  80136e:	56                   	push   %esi
+  80136f:	52                   	push   %edx
+  801370:	50                   	push   %eax
+  801371:	e8 1f 25 00 00       	call   803895 <__udivdi3>
+  801376:	83 c4 10             	add    $0x10,%esp
+  801379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137c:	5b                   	pop    %ebx
+  80137d:	5e                   	pop    %esi
+  80137e:	5f                   	pop    %edi
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+
+00801381 <sys_env_swap>:
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	57                   	push   %edi
+  801385:	56                   	push   %esi
+  801386:	53                   	push   %ebx
+  801387:	83 ec 0c             	sub    $0xc,%esp
+  80138a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80138f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801392:	b8 12 00 00 00       	mov    $0x12,%eax
+  801397:	89 cb                	mov    %ecx,%ebx
+  801399:	89 cf                	mov    %ecx,%edi
+  80139b:	89 ce                	mov    %ecx,%esi
+  80139d:	cd 30                	int    $0x30
+  80139f:	85 c0                	test   %eax,%eax
+  8013a1:	7f 08                	jg     8013ab <sys_env_swap+0x2a>
+  8013a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a6:	5b                   	pop    %ebx
+  8013a7:	5e                   	pop    %esi
+  8013a8:	5f                   	pop    %edi
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+  8013ae:	50                   	push   %eax
+  8013af:	6a 12                	push   $0x12
+  8013b1:	68 0b 3e 80 00       	push   $0x803e0b
+  8013b6:	6a 24                	push   $0x24
+  8013b8:	68 28 3e 80 00       	push   $0x803e28
+  8013bd:	e8 7a ef ff ff       	call   80033c <_panic>
+
+008013c2 <sys_net_try_send>:
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	57                   	push   %edi
+  8013c6:	56                   	push   %esi
+  8013c7:	53                   	push   %ebx
+  8013c8:	83 ec 0c             	sub    $0xc,%esp
+  8013cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013db:	89 df                	mov    %ebx,%edi
+  8013dd:	89 de                	mov    %ebx,%esi
+  8013df:	cd 30                	int    $0x30
+  8013e1:	85 c0                	test   %eax,%eax
+  8013e3:	7f 08                	jg     8013ed <sys_net_try_send+0x2b>
+  8013e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e8:	5b                   	pop    %ebx
+  8013e9:	5e                   	pop    %esi
+  8013ea:	5f                   	pop    %edi
+  8013eb:	5d                   	pop    %ebp
+  8013ec:	c3                   	ret
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	50                   	push   %eax
+  8013f1:	6a 13                	push   $0x13
+  8013f3:	68 0b 3e 80 00       	push   $0x803e0b
+  8013f8:	6a 24                	push   $0x24
+  8013fa:	68 28 3e 80 00       	push   $0x803e28
+  8013ff:	e8 38 ef ff ff       	call   80033c <_panic>
+
+00801404 <sys_net_try_receive>:
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	57                   	push   %edi
+  801408:	56                   	push   %esi
+  801409:	53                   	push   %ebx
+  80140a:	83 ec 0c             	sub    $0xc,%esp
+  80140d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801412:	8b 55 08             	mov    0x8(%ebp),%edx
+  801415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801418:	b8 14 00 00 00       	mov    $0x14,%eax
+  80141d:	89 df                	mov    %ebx,%edi
+  80141f:	89 de                	mov    %ebx,%esi
+  801421:	cd 30                	int    $0x30
+  801423:	85 c0                	test   %eax,%eax
+  801425:	7f 08                	jg     80142f <sys_net_try_receive+0x2b>
+  801427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142a:	5b                   	pop    %ebx
+  80142b:	5e                   	pop    %esi
+  80142c:	5f                   	pop    %edi
+  80142d:	5d                   	pop    %ebp
+  80142e:	c3                   	ret
+  80142f:	83 ec 0c             	sub    $0xc,%esp
+  801432:	50                   	push   %eax
+  801433:	6a 14                	push   $0x14
+  801435:	68 0b 3e 80 00       	push   $0x803e0b
+  80143a:	6a 24                	push   $0x24
+  80143c:	68 28 3e 80 00       	push   $0x803e28
+  801441:	e8 f6 ee ff ff       	call   80033c <_panic>
+
+00801446 <sys_net_recv_page>:
+  801446:	55                   	push   %ebp
+  801447:	89 e5                	mov    %esp,%ebp
+  801449:	57                   	push   %edi
+  80144a:	56                   	push   %esi
+  80144b:	53                   	push   %ebx
+  80144c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801451:	8b 55 08             	mov    0x8(%ebp),%edx
+  801454:	b8 27 00 00 00       	mov    $0x27,%eax
+  801459:	89 cb                	mov    %ecx,%ebx
+  80145b:	89 cf                	mov    %ecx,%edi
+  80145d:	89 ce                	mov    %ecx,%esi
+  80145f:	cd 30                	int    $0x30
+  801461:	5b                   	pop    %ebx
+  801462:	5e                   	pop    %esi
+  801463:	5f                   	pop    %edi
+  801464:	5d                   	pop    %ebp
+  801465:	c3                   	ret
+
+00801466 <sys_net_wait>:
+  801466:	55                   	push   %ebp
+  801467:	89 e5                	mov    %esp,%ebp
+  801469:	57                   	push   %edi
+  80146a:	56                   	push   %esi
+  80146b:	53                   	push   %ebx
+  80146c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801471:	b8 26 00 00 00       	mov    $0x26,%eax
+  801476:	89 d1                	mov    %edx,%ecx
+  801478:	89 d3                	mov    %edx,%ebx
+  80147a:	89 d7                	mov    %edx,%edi
+  80147c:	89 d6                	mov    %edx,%esi
+  80147e:	cd 30                	int    $0x30
+  801480:	5b                   	pop    %ebx
+  801481:	5e                   	pop    %esi
+  801482:	5f                   	pop    %edi
+  801483:	5d                   	pop    %ebp
+  801484:	c3                   	ret
+
+00801485 <sys_get_mac>:
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	57                   	push   %edi
+  801489:	56                   	push   %esi
+  80148a:	53                   	push   %ebx
+  80148b:	83 ec 0c             	sub    $0xc,%esp
+  80148e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801493:	8b 55 08             	mov    0x8(%ebp),%edx
+  801496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801499:	b8 15 00 00 00       	mov    $0x15,%eax
+  80149e:	89 df                	mov    %ebx,%edi
+  8014a0:	89 de                	mov    %ebx,%esi
+  8014a2:	cd 30                	int    $0x30
+  8014a4:	85 c0                	test   %eax,%eax
+  8014a6:	7f 08                	jg     8014b0 <sys_get_mac+0x2b>
+  8014a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ab:	5b                   	pop    %ebx
+  8014ac:	5e                   	pop    %esi
+  8014ad:	5f                   	pop    %edi
+  8014ae:	5d                   	pop    %ebp
+  8014af:	c3                   	ret
+  8014b0:	83 ec 0c             	sub    $0xc,%esp
+  8014b3:	50                   	push   %eax
+  8014b4:	6a 15                	push   $0x15
+  8014b6:	68 0b 3e 80 00       	push   $0x803e0b
+  8014bb:	6a 24                	push   $0x24
+  8014bd:	68 28 3e 80 00       	push   $0x803e28
+  8014c2:	e8 75 ee ff ff       	call   80033c <_panic>
+
+008014c7 <sys_env_lease>:
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  8014ca:	57                   	push   %edi
+  8014cb:	56                   	push   %esi
+  8014cc:	53                   	push   %ebx
+  8014cd:	83 ec 0c             	sub    $0xc,%esp
+  8014d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014db:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014e0:	89 df                	mov    %ebx,%edi
+  8014e2:	89 de                	mov    %ebx,%esi
+  8014e4:	cd 30                	int    $0x30
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	7f 08                	jg     8014f2 <sys_env_lease+0x2b>
+  8014ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ed:	5b                   	pop    %ebx
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5f                   	pop    %edi
+  8014f0:	5d                   	pop    %ebp
+  8014f1:	c3                   	ret
+  8014f2:	83 ec 0c             	sub    $0xc,%esp
+  8014f5:	50                   	push   %eax
+  8014f6:	6a 16                	push   $0x16
+  8014f8:	68 0b 3e 80 00       	push   $0x803e0b
+  8014fd:	6a 24                	push   $0x24
+  8014ff:	68 28 3e 80 00       	push   $0x803e28
+  801504:	e8 33 ee ff ff       	call   80033c <_panic>
+
+00801509 <sys_copy_mem>:
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	57                   	push   %edi
+  80150d:	56                   	push   %esi
+  80150e:	53                   	push   %ebx
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	8b 55 08             	mov    0x8(%ebp),%edx
+  801515:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801518:	b8 17 00 00 00       	mov    $0x17,%eax
+  80151d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801520:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801523:	8b 75 18             	mov    0x18(%ebp),%esi
+  801526:	cd 30                	int    $0x30
+  801528:	85 c0                	test   %eax,%eax
+  80152a:	7f 08                	jg     801534 <sys_copy_mem+0x2b>
+  80152c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152f:	5b                   	pop    %ebx
+  801530:	5e                   	pop    %esi
+  801531:	5f                   	pop    %edi
+  801532:	5d                   	pop    %ebp
+  801533:	c3                   	ret
+  801534:	83 ec 0c             	sub    $0xc,%esp
+  801537:	50                   	push   %eax
+  801538:	6a 17                	push   $0x17
+  80153a:	68 0b 3e 80 00       	push   $0x803e0b
+  80153f:	6a 24                	push   $0x24
+  801541:	68 28 3e 80 00       	push   $0x803e28
+  801546:	e8 f1 ed ff ff       	call   80033c <_panic>
+
+0080154b <sys_get_perms>:
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	57                   	push   %edi
+  80154f:	56                   	push   %esi
+  801550:	53                   	push   %ebx
+  801551:	83 ec 0c             	sub    $0xc,%esp
+  801554:	be 00 00 00 00       	mov    $0x0,%esi
+  801559:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801564:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801567:	89 f7                	mov    %esi,%edi
+  801569:	cd 30                	int    $0x30
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	7f 08                	jg     801577 <sys_get_perms+0x2c>
+  80156f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801572:	5b                   	pop    %ebx
+  801573:	5e                   	pop    %esi
+  801574:	5f                   	pop    %edi
+  801575:	5d                   	pop    %ebp
+  801576:	c3                   	ret
+  801577:	83 ec 0c             	sub    $0xc,%esp
+  80157a:	50                   	push   %eax
+  80157b:	6a 18                	push   $0x18
+  80157d:	68 0b 3e 80 00       	push   $0x803e0b
+  801582:	6a 24                	push   $0x24
+  801584:	68 28 3e 80 00       	push   $0x803e28
+  801589:	e8 ae ed ff ff       	call   80033c <_panic>
+
+0080158e <sys_env_unsuspend>:
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	56                   	push   %esi
+  801593:	53                   	push   %ebx
+  801594:	83 ec 0c             	sub    $0xc,%esp
+  801597:	be 00 00 00 00       	mov    $0x0,%esi
+  80159c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015aa:	89 f7                	mov    %esi,%edi
+  8015ac:	cd 30                	int    $0x30
+  8015ae:	85 c0                	test   %eax,%eax
+  8015b0:	7f 08                	jg     8015ba <sys_env_unsuspend+0x2c>
+  8015b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b5:	5b                   	pop    %ebx
+  8015b6:	5e                   	pop    %esi
+  8015b7:	5f                   	pop    %edi
+  8015b8:	5d                   	pop    %ebp
+  8015b9:	c3                   	ret
+  8015ba:	83 ec 0c             	sub    $0xc,%esp
+  8015bd:	50                   	push   %eax
+  8015be:	6a 19                	push   $0x19
+  8015c0:	68 0b 3e 80 00       	push   $0x803e0b
+  8015c5:	6a 24                	push   $0x24
+  8015c7:	68 28 3e 80 00       	push   $0x803e28
+  8015cc:	e8 6b ed ff ff       	call   80033c <_panic>
+
+008015d1 <sys_migrate>:
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	57                   	push   %edi
+  8015d5:	56                   	push   %esi
+  8015d6:	53                   	push   %ebx
+  8015d7:	83 ec 0c             	sub    $0xc,%esp
+  8015da:	ba 04 90 80 00       	mov    $0x809004,%edx
+  8015df:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8015e5:	76 11                	jbe    8015f8 <sys_migrate+0x27>
+  8015e7:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8015ec:	0f b6 08             	movzbl (%eax),%ecx
+  8015ef:	05 00 10 00 00       	add    $0x1000,%eax
+  8015f4:	39 d0                	cmp    %edx,%eax
+  8015f6:	72 f4                	jb     8015ec <sys_migrate+0x1b>
+  8015f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801600:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801605:	89 cb                	mov    %ecx,%ebx
+  801607:	89 cf                	mov    %ecx,%edi
+  801609:	89 ce                	mov    %ecx,%esi
+  80160b:	cd 30                	int    $0x30
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	7f 08                	jg     801619 <sys_migrate+0x48>
+  801611:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801614:	5b                   	pop    %ebx
+  801615:	5e                   	pop    %esi
+  801616:	5f                   	pop    %edi
+  801617:	5d                   	pop    %ebp
+  801618:	c3                   	ret
+  801619:	83 ec 0c             	sub    $0xc,%esp
+  80161c:	50                   	push   %eax
+  80161d:	6a 1a                	push   $0x1a
+  80161f:	68 0b 3e 80 00       	push   $0x803e0b
+  801624:	6a 24                	push   $0x24
+  801626:	68 28 3e 80 00       	push   $0x803e28
+  80162b:	e8 0c ed ff ff       	call   80033c <_panic>
+
+00801630 <sys_lease_complete>:
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	57                   	push   %edi
+  801634:	56                   	push   %esi
+  801635:	53                   	push   %ebx
+  801636:	83 ec 0c             	sub    $0xc,%esp
+  801639:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801643:	89 d1                	mov    %edx,%ecx
+  801645:	89 d3                	mov    %edx,%ebx
+  801647:	89 d7                	mov    %edx,%edi
+  801649:	89 d6                	mov    %edx,%esi
+  80164b:	cd 30                	int    $0x30
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	7f 08                	jg     801659 <sys_lease_complete+0x29>
+  801651:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801654:	5b                   	pop    %ebx
+  801655:	5e                   	pop    %esi
+  801656:	5f                   	pop    %edi
+  801657:	5d                   	pop    %ebp
+  801658:	c3                   	ret
+  801659:	83 ec 0c             	sub    $0xc,%esp
+  80165c:	50                   	push   %eax
+  80165d:	6a 1b                	push   $0x1b
+  80165f:	68 0b 3e 80 00       	push   $0x803e0b
+  801664:	6a 24                	push   $0x24
+  801666:	68 28 3e 80 00       	push   $0x803e28
+  80166b:	e8 cc ec ff ff       	call   80033c <_panic>
+
+00801670 <sys_env_set_thisenv>:
+  801670:	55                   	push   %ebp
+  801671:	89 e5                	mov    %esp,%ebp
+  801673:	57                   	push   %edi
+  801674:	56                   	push   %esi
+  801675:	53                   	push   %ebx
+  801676:	83 ec 0c             	sub    $0xc,%esp
+  801679:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801681:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801684:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801689:	89 df                	mov    %ebx,%edi
+  80168b:	89 de                	mov    %ebx,%esi
+  80168d:	cd 30                	int    $0x30
+  80168f:	85 c0                	test   %eax,%eax
+  801691:	7f 08                	jg     80169b <sys_env_set_thisenv+0x2b>
+  801693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801696:	5b                   	pop    %ebx
+  801697:	5e                   	pop    %esi
+  801698:	5f                   	pop    %edi
+  801699:	5d                   	pop    %ebp
+  80169a:	c3                   	ret
+  80169b:	83 ec 0c             	sub    $0xc,%esp
+  80169e:	50                   	push   %eax
+  80169f:	6a 1c                	push   $0x1c
+  8016a1:	68 0b 3e 80 00       	push   $0x803e0b
+  8016a6:	6a 24                	push   $0x24
+  8016a8:	68 28 3e 80 00       	push   $0x803e28
+  8016ad:	e8 8a ec ff ff       	call   80033c <_panic>
+
+008016b2 <sys_env_set_sched>:
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	57                   	push   %edi
+  8016b6:	56                   	push   %esi
+  8016b7:	53                   	push   %ebx
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+  8016bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016ce:	89 f7                	mov    %esi,%edi
+  8016d0:	cd 30                	int    $0x30
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	7f 08                	jg     8016de <sys_env_set_sched+0x2c>
+  8016d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d9:	5b                   	pop    %ebx
+  8016da:	5e                   	pop    %esi
+  8016db:	5f                   	pop    %edi
+  8016dc:	5d                   	pop    %ebp
+  8016dd:	c3                   	ret
+  8016de:	83 ec 0c             	sub    $0xc,%esp
+  8016e1:	50                   	push   %eax
+  8016e2:	6a 1d                	push   $0x1d
+  8016e4:	68 0b 3e 80 00       	push   $0x803e0b
+  8016e9:	6a 24                	push   $0x24
+  8016eb:	68 28 3e 80 00       	push   $0x803e28
+  8016f0:	e8 47 ec ff ff       	call   80033c <_panic>
+
+008016f5 <sys_batch>:
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	57                   	push   %edi
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+  8016fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801700:	8b 55 08             	mov    0x8(%ebp),%edx
+  801703:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801706:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80170b:	89 df                	mov    %ebx,%edi
+  80170d:	89 de                	mov    %ebx,%esi
+  80170f:	cd 30                	int    $0x30
+  801711:	5b                   	pop    %ebx
+  801712:	5e                   	pop    %esi
+  801713:	5f                   	pop    %edi
+  801714:	5d                   	pop    %ebp
+  801715:	c3                   	ret
+
+00801716 <sys_env_stats>:
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	57                   	push   %edi
+  80171a:	56                   	push   %esi
+  80171b:	53                   	push   %ebx
+  80171c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801721:	8b 55 08             	mov    0x8(%ebp),%edx
+  801724:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801727:	b8 23 00 00 00       	mov    $0x23,%eax
+  80172c:	89 df                	mov    %ebx,%edi
+  80172e:	89 de                	mov    %ebx,%esi
+  801730:	cd 30                	int    $0x30
+  801732:	5b                   	pop    %ebx
+  801733:	5e                   	pop    %esi
+  801734:	5f                   	pop    %edi
+  801735:	5d                   	pop    %ebp
+  801736:	c3                   	ret
+
+00801737 <sys_trace>:
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	57                   	push   %edi
+  80173b:	56                   	push   %esi
+  80173c:	53                   	push   %ebx
+  80173d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801742:	8b 55 08             	mov    0x8(%ebp),%edx
+  801745:	b8 24 00 00 00       	mov    $0x24,%eax
+  80174a:	89 cb                	mov    %ecx,%ebx
+  80174c:	89 cf                	mov    %ecx,%edi
+  80174e:	89 ce                	mov    %ecx,%esi
+  801750:	cd 30                	int    $0x30
+  801752:	5b                   	pop    %ebx
+  801753:	5e                   	pop    %esi
+  801754:	5f                   	pop    %edi
+  801755:	5d                   	pop    %ebp
+  801756:	c3                   	ret
+
+00801757 <sys_env_set_pager>:
+  801757:	55                   	push   %ebp
+  801758:	89 e5                	mov    %esp,%ebp
+  80175a:	57                   	push   %edi
+  80175b:	56                   	push   %esi
+  80175c:	53                   	push   %ebx
+  80175d:	83 ec 0c             	sub    $0xc,%esp
+  801760:	be 00 00 00 00       	mov    $0x0,%esi
+  801765:	8b 55 08             	mov    0x8(%ebp),%edx
+  801768:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176b:	b8 25 00 00 00       	mov    $0x25,%eax
+  801770:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801773:	89 f7                	mov    %esi,%edi
+  801775:	cd 30                	int    $0x30
+  801777:	85 c0                	test   %eax,%eax
+  801779:	7f 08                	jg     801783 <sys_env_set_pager+0x2c>
+  80177b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5f                   	pop    %edi
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+  801783:	83 ec 0c             	sub    $0xc,%esp
+  801786:	50                   	push   %eax
+  801787:	6a 25                	push   $0x25
+  801789:	68 0b 3e 80 00       	push   $0x803e0b
+  80178e:	6a 24                	push   $0x24
+  801790:	68 28 3e 80 00       	push   $0x803e28
+  801795:	e8 a2 eb ff ff       	call   80033c <_panic>
+
+0080179a <sys_pager_retire>:
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	57                   	push   %edi
+  80179e:	56                   	push   %esi
+  80179f:	53                   	push   %ebx
+  8017a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8017ad:	89 cb                	mov    %ecx,%ebx
+  8017af:	89 cf                	mov    %ecx,%edi
+  8017b1:	89 ce                	mov    %ecx,%esi
+  8017b3:	cd 30                	int    $0x30
+  8017b5:	5b                   	pop    %ebx
+  8017b6:	5e                   	pop    %esi
+  8017b7:	5f                   	pop    %edi
+  8017b8:	5d                   	pop    %ebp
+  8017b9:	c3                   	ret
+
+008017ba <sys_prof>:
+  8017ba:	55                   	push   %ebp
+  8017bb:	89 e5                	mov    %esp,%ebp
+  8017bd:	57                   	push   %edi
+  8017be:	56                   	push   %esi
+  8017bf:	53                   	push   %ebx
+  8017c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cb:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017d3:	89 f7                	mov    %esi,%edi
+  8017d5:	cd 30                	int    $0x30
+  8017d7:	5b                   	pop    %ebx
+  8017d8:	5e                   	pop    %esi
+  8017d9:	5f                   	pop    %edi
+  8017da:	5d                   	pop    %ebp
+  8017db:	c3                   	ret
+
+008017dc <dupq_flush>:
+  8017dc:	55                   	push   %ebp
+  8017dd:	89 e5                	mov    %esp,%ebp
+  8017df:	53                   	push   %ebx
+  8017e0:	83 ec 0c             	sub    $0xc,%esp
+  8017e3:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  8017e9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8017f0:	00 00 00 
+  8017f3:	53                   	push   %ebx
+  8017f4:	68 00 00 40 00       	push   $0x400000
+  8017f9:	e8 f7 fe ff ff       	call   8016f5 <sys_batch>
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 14                	js     801819 <dupq_flush+0x3d>
+  801805:	39 c3                	cmp    %eax,%ebx
+  801807:	7e 0b                	jle    801814 <dupq_flush+0x38>
+  801809:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80180c:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801812:	eb 05                	jmp    801819 <dupq_flush+0x3d>
+  801814:	b8 00 00 00 00       	mov    $0x0,%eax
+  801819:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181c:	c9                   	leave
+  80181d:	c3                   	ret
+
+0080181e <pgfault>:
+  80181e:	55                   	push   %ebp
+  80181f:	89 e5                	mov    %esp,%ebp
+  801821:	56                   	push   %esi
+  801822:	53                   	push   %ebx
+  801823:	8b 45 08             	mov    0x8(%ebp),%eax
+  801826:	8b 30                	mov    (%eax),%esi
+  801828:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80182c:	0f 84 83 00 00 00    	je     8018b5 <pgfault+0x97>
+  801832:	89 f0                	mov    %esi,%eax
+  801834:	c1 e8 0c             	shr    $0xc,%eax
+  801837:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80183e:	f6 c4 08             	test   $0x8,%ah
+  801841:	0f 84 80 00 00 00    	je     8018c7 <pgfault+0xa9>
+  801847:	e8 b8 f6 ff ff       	call   800f04 <sys_getenvid>
+  80184c:	89 c3                	mov    %eax,%ebx
+  80184e:	83 ec 04             	sub    $0x4,%esp
+  801851:	6a 07                	push   $0x7
+  801853:	68 00 f0 7f 00       	push   $0x7ff000
+  801858:	50                   	push   %eax
+  801859:	e8 10 f7 ff ff       	call   800f6e <sys_page_alloc>
+  80185e:	83 c4 10             	add    $0x10,%esp
+  801861:	85 c0                	test   %eax,%eax
+  801863:	78 74                	js     8018d9 <pgfault+0xbb>
+  801865:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80186b:	83 ec 04             	sub    $0x4,%esp
+  80186e:	68 00 10 00 00       	push   $0x1000
+  801873:	56                   	push   %esi
+  801874:	68 00 f0 7f 00       	push   $0x7ff000
+  801879:	e8 40 f4 ff ff       	call   800cbe <memmove>
+  80187e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801885:	56                   	push   %esi
+  801886:	53                   	push   %ebx
+  801887:	68 00 f0 7f 00       	push   $0x7ff000
+  80188c:	53                   	push   %ebx
+  80188d:	e8 1f f7 ff ff       	call   800fb1 <sys_page_map>
+  801892:	83 c4 20             	add    $0x20,%esp
+  801895:	85 c0                	test   %eax,%eax
+  801897:	78 54                	js     8018ed <pgfault+0xcf>
+  801899:	83 ec 08             	sub    $0x8,%esp
+  80189c:	68 00 f0 7f 00       	push   $0x7ff000
+  8018a1:	53                   	push   %ebx
+  8018a2:	e8 99 f7 ff ff       	call   801040 <sys_page_unmap>
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	85 c0                	test   %eax,%eax
+  8018ac:	78 53                	js     801901 <pgfault+0xe3>
+  8018ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b1:	5b                   	pop    %ebx
+  8018b2:	5e                   	pop    %esi
+  8018b3:	5d                   	pop    %ebp
+  8018b4:	c3                   	ret
+  8018b5:	56                   	push   %esi
+  8018b6:	68 38 3e 80 00       	push   $0x803e38
+  8018bb:	6a 19                	push   $0x19
+  8018bd:	68 14 3f 80 00       	push   $0x803f14
+  8018c2:	e8 75 ea ff ff       	call   80033c <_panic>
+  8018c7:	56                   	push   %esi
+  8018c8:	68 6c 3e 80 00       	push   $0x803e6c
+  8018cd:	6a 1e                	push   $0x1e
+  8018cf:	68 14 3f 80 00       	push   $0x803f14
+  8018d4:	e8 63 ea ff ff       	call   80033c <_panic>
+  8018d9:	83 ec 04             	sub    $0x4,%esp
+  8018dc:	68 a0 3e 80 00       	push   $0x803ea0
+  8018e1:	6a 2e                	push   $0x2e
+  8018e3:	68 14 3f 80 00       	push   $0x803f14
+  8018e8:	e8 4f ea ff ff       	call   80033c <_panic>
+  8018ed:	83 ec 04             	sub    $0x4,%esp
+  8018f0:	68 c4 3e 80 00       	push   $0x803ec4
+  8018f5:	6a 37                	push   $0x37
+  8018f7:	68 14 3f 80 00       	push   $0x803f14
+  8018fc:	e8 3b ea ff ff       	call   80033c <_panic>
+  801901:	83 ec 04             	sub    $0x4,%esp
+  801904:	68 f0 3e 80 00       	push   $0x803ef0
+  801909:	6a 3c                	push   $0x3c
+  80190b:	68 14 3f 80 00       	push   $0x803f14
+  801910:	e8 27 ea ff ff       	call   80033c <_panic>
+
+00801915 <dupq_begin>:
+  801915:	55                   	push   %ebp
+  801916:	89 e5                	mov    %esp,%ebp
+  801918:	83 ec 0c             	sub    $0xc,%esp
+  80191b:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801922:	00 00 00 
+  801925:	6a 07                	push   $0x7
+  801927:	68 00 00 40 00       	push   $0x400000
+  80192c:	6a 00                	push   $0x0
+  80192e:	e8 3b f6 ff ff       	call   800f6e <sys_page_alloc>
+  801933:	c9                   	leave
+  801934:	c3                   	ret
+
+00801935 <dupq_map>:
+  801935:	55                   	push   %ebp
+  801936:	89 e5                	mov    %esp,%ebp
+  801938:	83 ec 08             	sub    $0x8,%esp
+  80193b:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  801942:	00 00 00 
+  801945:	74 46                	je     80198d <dupq_map+0x58>
+  801947:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80194d:	8d 42 01             	lea    0x1(%edx),%eax
+  801950:	a3 00 60 80 00       	mov    %eax,0x806000
+  801955:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801958:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  80195e:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801965:	00 00 00 
+  801968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196b:	89 50 04             	mov    %edx,0x4(%eax)
+  80196e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801971:	c1 e2 0c             	shl    $0xc,%edx
+  801974:	89 50 08             	mov    %edx,0x8(%eax)
+  801977:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80197a:	89 48 0c             	mov    %ecx,0xc(%eax)
+  80197d:	89 50 10             	mov    %edx,0x10(%eax)
+  801980:	8b 55 14             	mov    0x14(%ebp),%edx
+  801983:	89 50 14             	mov    %edx,0x14(%eax)
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198b:	c9                   	leave
+  80198c:	c3                   	ret
+  80198d:	e8 4a fe ff ff       	call   8017dc <dupq_flush>
+  801992:	85 c0                	test   %eax,%eax
+  801994:	79 b1                	jns    801947 <dupq_map+0x12>
+  801996:	eb f3                	jmp    80198b <dupq_map+0x56>
+
+00801998 <dupq_end>:
+  801998:	55                   	push   %ebp
+  801999:	89 e5                	mov    %esp,%ebp
+  80199b:	53                   	push   %ebx
+  80199c:	83 ec 04             	sub    $0x4,%esp
+  80199f:	e8 38 fe ff ff       	call   8017dc <dupq_flush>
+  8019a4:	89 c3                	mov    %eax,%ebx
+  8019a6:	83 ec 08             	sub    $0x8,%esp
+  8019a9:	68 00 00 40 00       	push   $0x400000
+  8019ae:	6a 00                	push   $0x0
+  8019b0:	e8 8b f6 ff ff       	call   801040 <sys_page_unmap>
+  8019b5:	89 d8                	mov    %ebx,%eax
+  8019b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ba:	c9                   	leave
+  8019bb:	c3                   	ret
+
+008019bc <fork>:
+  8019bc:	55                   	push   %ebp
+  8019bd:	89 e5                	mov    %esp,%ebp
+  8019bf:	53                   	push   %ebx
+  8019c0:	83 ec 10             	sub    $0x10,%esp
+  8019c3:	68 1e 18 80 00       	push   $0x80181e
+  8019c8:	e8 0c 1d 00 00       	call   8036d9 <set_pgfault_handler>
+  8019cd:	83 c4 08             	add    $0x8,%esp
+  8019d0:	6a 01                	push   $0x1
+  8019d2:	6a 00                	push   $0x0
+  8019d4:	e8 4c f7 ff ff       	call   801125 <sys_env_set_cow>
+  8019d9:	e8 a4 f6 ff ff       	call   801082 <sys_fork>
+  8019de:	89 c3                	mov    %eax,%ebx
+  8019e0:	83 c4 10             	add    $0x10,%esp
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	74 07                	je     8019ee <fork+0x32>
+  8019e7:	89 d8                	mov    %ebx,%eax
+  8019e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ec:	c9                   	leave
+  8019ed:	c3                   	ret
+  8019ee:	e8 11 f5 ff ff       	call   800f04 <sys_getenvid>
+  8019f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019f8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8019fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a03:	a3 14 60 80 00       	mov    %eax,0x806014
+  801a08:	eb dd                	jmp    8019e7 <fork+0x2b>
+
+00801a0a <sfork>:
+  801a0a:	55                   	push   %ebp
+  801a0b:	89 e5                	mov    %esp,%ebp
+  801a0d:	57                   	push   %edi
+  801a0e:	56                   	push   %esi
+  801a0f:	53                   	push   %ebx
+  801a10:	83 ec 1c             	sub    $0x1c,%esp
+  801a13:	e8 ec f4 ff ff       	call   800f04 <sys_getenvid>
+  801a18:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801a1b:	83 ec 0c             	sub    $0xc,%esp
+  801a1e:	68 1e 18 80 00       	push   $0x80181e
+  801a23:	e8 b1 1c 00 00       	call   8036d9 <set_pgfault_handler>
+  801a28:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a2d:	cd 30                	int    $0x30
+  801a2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	85 c0                	test   %eax,%eax
+  801a37:	0f 88 45 02 00 00    	js     801c82 <sfork+0x278>
+  801a3d:	89 c6                	mov    %eax,%esi
+  801a3f:	74 17                	je     801a58 <sfork+0x4e>
+  801a41:	e8 cf fe ff ff       	call   801915 <dupq_begin>
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	0f 88 40 02 00 00    	js     801c8e <sfork+0x284>
+  801a4e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801a53:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801a56:	eb 39                	jmp    801a91 <sfork+0x87>
+  801a58:	e8 a7 f4 ff ff       	call   800f04 <sys_getenvid>
+  801a5d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a62:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801a68:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a6d:	a3 14 60 80 00       	mov    %eax,0x806014
+  801a72:	e9 23 01 00 00       	jmp    801b9a <sfork+0x190>
+  801a77:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a7e:	a8 01                	test   $0x1,%al
+  801a80:	75 5b                	jne    801add <sfork+0xd3>
+  801a82:	83 c7 01             	add    $0x1,%edi
+  801a85:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801a8b:	0f 84 40 01 00 00    	je     801bd1 <sfork+0x1c7>
+  801a91:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801a98:	a8 01                	test   $0x1,%al
+  801a9a:	74 db                	je     801a77 <sfork+0x6d>
+  801a9c:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801aa3:	a8 80                	test   $0x80,%al
+  801aa5:	74 d0                	je     801a77 <sfork+0x6d>
+  801aa7:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801aae:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ab3:	0c 80                	or     $0x80,%al
+  801ab5:	50                   	push   %eax
+  801ab6:	ff 75 e4             	push   -0x1c(%ebp)
+  801ab9:	89 f8                	mov    %edi,%eax
+  801abb:	c1 e0 16             	shl    $0x16,%eax
+  801abe:	c1 e8 0c             	shr    $0xc,%eax
+  801ac1:	50                   	push   %eax
+  801ac2:	ff 75 e0             	push   -0x20(%ebp)
+  801ac5:	e8 6b fe ff ff       	call   801935 <dupq_map>
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	79 b1                	jns    801a82 <sfork+0x78>
+  801ad1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ad8:	e9 bd 00 00 00       	jmp    801b9a <sfork+0x190>
+  801add:	89 fe                	mov    %edi,%esi
+  801adf:	c1 e6 16             	shl    $0x16,%esi
+  801ae2:	89 f0                	mov    %esi,%eax
+  801ae4:	c1 e8 0c             	shr    $0xc,%eax
+  801ae7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801aec:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801aef:	eb 57                	jmp    801b48 <sfork+0x13e>
+  801af1:	e8 0e f4 ff ff       	call   800f04 <sys_getenvid>
+  801af6:	89 c7                	mov    %eax,%edi
+  801af8:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801afd:	f6 c4 04             	test   $0x4,%ah
+  801b00:	0f 85 9f 00 00 00    	jne    801ba5 <sfork+0x19b>
+  801b06:	a9 02 08 00 00       	test   $0x802,%eax
+  801b0b:	0f 85 c5 01 00 00    	jne    801cd6 <sfork+0x2cc>
+  801b11:	6a 05                	push   $0x5
+  801b13:	ff 75 e4             	push   -0x1c(%ebp)
+  801b16:	68 fd e7 0e 00       	push   $0xee7fd
+  801b1b:	57                   	push   %edi
+  801b1c:	e8 14 fe ff ff       	call   801935 <dupq_map>
+  801b21:	83 c4 10             	add    $0x10,%esp
+  801b24:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801b2a:	0f 84 91 00 00 00    	je     801bc1 <sfork+0x1b7>
+  801b30:	89 f0                	mov    %esi,%eax
+  801b32:	09 d8                	or     %ebx,%eax
+  801b34:	c1 e8 0c             	shr    $0xc,%eax
+  801b37:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b3d:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801b42:	0f 84 81 00 00 00    	je     801bc9 <sfork+0x1bf>
+  801b48:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801b4d:	74 a2                	je     801af1 <sfork+0xe7>
+  801b4f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b56:	f6 c2 01             	test   $0x1,%dl
+  801b59:	74 c9                	je     801b24 <sfork+0x11a>
+  801b5b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b62:	f6 c6 02             	test   $0x2,%dh
+  801b65:	75 bd                	jne    801b24 <sfork+0x11a>
+  801b67:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801b6e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b75:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801b7b:	f7 d2                	not    %edx
+  801b7d:	21 ca                	and    %ecx,%edx
+  801b7f:	52                   	push   %edx
+  801b80:	ff 75 e4             	push   -0x1c(%ebp)
+  801b83:	50                   	push   %eax
+  801b84:	ff 75 e0             	push   -0x20(%ebp)
+  801b87:	e8 a9 fd ff ff       	call   801935 <dupq_map>
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	79 91                	jns    801b24 <sfork+0x11a>
+  801b93:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801b9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba0:	5b                   	pop    %ebx
+  801ba1:	5e                   	pop    %esi
+  801ba2:	5f                   	pop    %edi
+  801ba3:	5d                   	pop    %ebp
+  801ba4:	c3                   	ret
+  801ba5:	25 07 0e 00 00       	and    $0xe07,%eax
+  801baa:	50                   	push   %eax
+  801bab:	ff 75 e4             	push   -0x1c(%ebp)
+  801bae:	68 fd e7 0e 00       	push   $0xee7fd
+  801bb3:	57                   	push   %edi
+  801bb4:	e8 7c fd ff ff       	call   801935 <dupq_map>
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	e9 63 ff ff ff       	jmp    801b24 <sfork+0x11a>
+  801bc1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801bc4:	e9 b9 fe ff ff       	jmp    801a82 <sfork+0x78>
+  801bc9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801bcc:	e9 b1 fe ff ff       	jmp    801a82 <sfork+0x78>
+  801bd1:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801bd4:	e8 bf fd ff ff       	call   801998 <dupq_end>
+  801bd9:	85 c0                	test   %eax,%eax
+  801bdb:	0f 88 b9 00 00 00    	js     801c9a <sfork+0x290>
+  801be1:	83 ec 04             	sub    $0x4,%esp
+  801be4:	6a 07                	push   $0x7
+  801be6:	68 00 f0 7f ee       	push   $0xee7ff000
+  801beb:	56                   	push   %esi
+  801bec:	e8 7d f3 ff ff       	call   800f6e <sys_page_alloc>
+  801bf1:	83 c4 10             	add    $0x10,%esp
+  801bf4:	85 c0                	test   %eax,%eax
+  801bf6:	0f 88 aa 00 00 00    	js     801ca6 <sfork+0x29c>
+  801bfc:	83 ec 0c             	sub    $0xc,%esp
+  801bff:	6a 07                	push   $0x7
+  801c01:	68 00 f0 7f 00       	push   $0x7ff000
+  801c06:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801c09:	57                   	push   %edi
+  801c0a:	68 00 f0 7f ee       	push   $0xee7ff000
+  801c0f:	56                   	push   %esi
+  801c10:	e8 9c f3 ff ff       	call   800fb1 <sys_page_map>
+  801c15:	83 c4 20             	add    $0x20,%esp
+  801c18:	85 c0                	test   %eax,%eax
+  801c1a:	0f 88 92 00 00 00    	js     801cb2 <sfork+0x2a8>
+  801c20:	83 ec 04             	sub    $0x4,%esp
+  801c23:	68 00 10 00 00       	push   $0x1000
+  801c28:	68 00 f0 7f 00       	push   $0x7ff000
+  801c2d:	68 00 f0 7f ee       	push   $0xee7ff000
+  801c32:	e8 87 f0 ff ff       	call   800cbe <memmove>
+  801c37:	83 c4 08             	add    $0x8,%esp
+  801c3a:	68 00 f0 7f 00       	push   $0x7ff000
+  801c3f:	57                   	push   %edi
+  801c40:	e8 fb f3 ff ff       	call   801040 <sys_page_unmap>
+  801c45:	83 c4 10             	add    $0x10,%esp
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	78 72                	js     801cbe <sfork+0x2b4>
+  801c4c:	83 ec 08             	sub    $0x8,%esp
+  801c4f:	68 51 37 80 00       	push   $0x803751
+  801c54:	56                   	push   %esi
+  801c55:	e8 2d f5 ff ff       	call   801187 <sys_env_set_pgfault_upcall>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	78 69                	js     801cca <sfork+0x2c0>
+  801c61:	83 ec 08             	sub    $0x8,%esp
+  801c64:	6a 02                	push   $0x2
+  801c66:	56                   	push   %esi
+  801c67:	e8 35 f4 ff ff       	call   8010a1 <sys_env_set_status>
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c76:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801c7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c7d:	e9 18 ff ff ff       	jmp    801b9a <sfork+0x190>
+  801c82:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c89:	e9 0c ff ff ff       	jmp    801b9a <sfork+0x190>
+  801c8e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801c95:	e9 00 ff ff ff       	jmp    801b9a <sfork+0x190>
+  801c9a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ca1:	e9 f4 fe ff ff       	jmp    801b9a <sfork+0x190>
+  801ca6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cad:	e9 e8 fe ff ff       	jmp    801b9a <sfork+0x190>
+  801cb2:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cb9:	e9 dc fe ff ff       	jmp    801b9a <sfork+0x190>
+  801cbe:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cc5:	e9 d0 fe ff ff       	jmp    801b9a <sfork+0x190>
+  801cca:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801cd1:	e9 c4 fe ff ff       	jmp    801b9a <sfork+0x190>
+  801cd6:	68 05 08 00 00       	push   $0x805
+  801cdb:	ff 75 e4             	push   -0x1c(%ebp)
+  801cde:	68 fd e7 0e 00       	push   $0xee7fd
+  801ce3:	57                   	push   %edi
+  801ce4:	e8 4c fc ff ff       	call   801935 <dupq_map>
+  801ce9:	83 c4 10             	add    $0x10,%esp
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	0f 88 30 fe ff ff    	js     801b24 <sfork+0x11a>
+  801cf4:	68 05 08 00 00       	push   $0x805
+  801cf9:	57                   	push   %edi
+  801cfa:	68 fd e7 0e 00       	push   $0xee7fd
+  801cff:	57                   	push   %edi
+  801d00:	e8 30 fc ff ff       	call   801935 <dupq_map>
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	e9 17 fe ff ff       	jmp    801b24 <sfork+0x11a>
+
+00801d0d <ipc_recv>:
+  801d0d:	55                   	push   %ebp
+  801d0e:	89 e5                	mov    %esp,%ebp
+  801d10:	56                   	push   %esi
+  801d11:	53                   	push   %ebx
+  801d12:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  801d22:	0f 44 c2             	cmove  %edx,%eax
+  801d25:	83 ec 0c             	sub    $0xc,%esp
+  801d28:	50                   	push   %eax
+  801d29:	e8 eb f4 ff ff       	call   801219 <sys_ipc_recv>
+  801d2e:	83 c4 10             	add    $0x10,%esp
+  801d31:	85 c0                	test   %eax,%eax
+  801d33:	78 2a                	js     801d5f <ipc_recv+0x52>
+  801d35:	a1 14 60 80 00       	mov    0x806014,%eax
+  801d3a:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  801d40:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  801d46:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801d4c:	85 f6                	test   %esi,%esi
+  801d4e:	74 02                	je     801d52 <ipc_recv+0x45>
+  801d50:	89 0e                	mov    %ecx,(%esi)
+  801d52:	85 db                	test   %ebx,%ebx
+  801d54:	74 02                	je     801d58 <ipc_recv+0x4b>
+  801d56:	89 13                	mov    %edx,(%ebx)
+  801d58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d5b:	5b                   	pop    %ebx
+  801d5c:	5e                   	pop    %esi
+  801d5d:	5d                   	pop    %ebp
+  801d5e:	c3                   	ret
+  801d5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d69:	eb e1                	jmp    801d4c <ipc_recv+0x3f>
+
+00801d6b <ipc_send>:
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	57                   	push   %edi
+  801d6f:	56                   	push   %esi
+  801d70:	53                   	push   %ebx
+  801d71:	83 ec 0c             	sub    $0xc,%esp
+  801d74:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801d77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d7a:	8b 75 14             	mov    0x14(%ebp),%esi
+  801d7d:	85 db                	test   %ebx,%ebx
+  801d7f:	74 1e                	je     801d9f <ipc_send+0x34>
+  801d81:	56                   	push   %esi
+  801d82:	53                   	push   %ebx
+  801d83:	57                   	push   %edi
+  801d84:	ff 75 08             	push   0x8(%ebp)
+  801d87:	e8 1a f5 ff ff       	call   8012a6 <sys_ipc_send>
+  801d8c:	83 c4 10             	add    $0x10,%esp
+  801d8f:	85 c0                	test   %eax,%eax
+  801d91:	74 2a                	je     801dbd <ipc_send+0x52>
+  801d93:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d96:	75 13                	jne    801dab <ipc_send+0x40>
+  801d98:	e8 86 f1 ff ff       	call   800f23 <sys_yield>
+  801d9d:	eb e2                	jmp    801d81 <ipc_send+0x16>
+  801d9f:	be 00 00 00 00       	mov    $0x0,%esi
+  801da4:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801da9:	eb d6                	jmp    801d81 <ipc_send+0x16>
+  801dab:	50                   	push   %eax
+  801dac:	68 20 3f 80 00       	push   $0x803f20
+  801db1:	6a 4f                	push   $0x4f
+  801db3:	68 63 3f 80 00       	push   $0x803f63
+  801db8:	e8 7f e5 ff ff       	call   80033c <_panic>
+  801dbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc0:	5b                   	pop    %ebx
+  801dc1:	5e                   	pop    %esi
+  801dc2:	5f                   	pop    %edi
+  801dc3:	5d                   	pop    %ebp
+  801dc4:	c3                   	ret
+
+00801dc5 <ipc_call>:
+  801dc5:	55                   	push   %ebp
+  801dc6:	89 e5                	mov    %esp,%ebp
+  801dc8:	57                   	push   %edi
+  801dc9:	56                   	push   %esi
+  801dca:	53                   	push   %ebx
+  801dcb:	83 ec 0c             	sub    $0xc,%esp
+  801dce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801dd2:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  801dd7:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  801ddb:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801ddf:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  801de4:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  801de8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801dec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801df1:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  801df5:	eb 05                	jmp    801dfc <ipc_call+0x37>
+  801df7:	e8 27 f1 ff ff       	call   800f23 <sys_yield>
+  801dfc:	83 ec 0c             	sub    $0xc,%esp
+  801dff:	56                   	push   %esi
+  801e00:	53                   	push   %ebx
+  801e01:	57                   	push   %edi
+  801e02:	ff 75 0c             	push   0xc(%ebp)
+  801e05:	ff 75 08             	push   0x8(%ebp)
+  801e08:	e8 e9 f4 ff ff       	call   8012f6 <sys_ipc_call>
+  801e0d:	83 c4 20             	add    $0x20,%esp
+  801e10:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801e13:	74 e2                	je     801df7 <ipc_call+0x32>
+  801e15:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801e18:	74 2d                	je     801e47 <ipc_call+0x82>
+  801e1a:	85 c0                	test   %eax,%eax
+  801e1c:	78 4f                	js     801e6d <ipc_call+0xa8>
+  801e1e:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801e22:	74 10                	je     801e34 <ipc_call+0x6f>
+  801e24:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e29:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801e2f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801e32:	89 02                	mov    %eax,(%edx)
+  801e34:	a1 14 60 80 00       	mov    0x806014,%eax
+  801e39:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e42:	5b                   	pop    %ebx
+  801e43:	5e                   	pop    %esi
+  801e44:	5f                   	pop    %edi
+  801e45:	5d                   	pop    %ebp
+  801e46:	c3                   	ret
+  801e47:	ff 75 14             	push   0x14(%ebp)
+  801e4a:	ff 75 10             	push   0x10(%ebp)
+  801e4d:	ff 75 0c             	push   0xc(%ebp)
+  801e50:	ff 75 08             	push   0x8(%ebp)
+  801e53:	e8 13 ff ff ff       	call   801d6b <ipc_send>
+  801e58:	83 c4 0c             	add    $0xc,%esp
+  801e5b:	ff 75 1c             	push   0x1c(%ebp)
+  801e5e:	ff 75 18             	push   0x18(%ebp)
+  801e61:	6a 00                	push   $0x0
+  801e63:	e8 a5 fe ff ff       	call   801d0d <ipc_recv>
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	eb d2                	jmp    801e3f <ipc_call+0x7a>
+  801e6d:	50                   	push   %eax
+  801e6e:	68 6d 3f 80 00       	push   $0x803f6d
+  801e73:	6a 6d                	push   $0x6d
+  801e75:	68 63 3f 80 00       	push   $0x803f63
+  801e7a:	e8 bd e4 ff ff       	call   80033c <_panic>
+
+00801e7f <ipc_reply_recv>:
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	57                   	push   %edi
+  801e83:	56                   	push   %esi
+  801e84:	53                   	push   %ebx
+  801e85:	83 ec 0c             	sub    $0xc,%esp
+  801e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e8b:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  801e8e:	8b 7d 20             	mov    0x20(%ebp),%edi
+  801e91:	85 db                	test   %ebx,%ebx
+  801e93:	0f 84 ac 00 00 00    	je     801f45 <ipc_reply_recv+0xc6>
+  801e99:	85 f6                	test   %esi,%esi
+  801e9b:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801ea0:	0f 45 c6             	cmovne %esi,%eax
+  801ea3:	83 ec 0c             	sub    $0xc,%esp
+  801ea6:	50                   	push   %eax
+  801ea7:	ff 75 14             	push   0x14(%ebp)
+  801eaa:	53                   	push   %ebx
+  801eab:	ff 75 0c             	push   0xc(%ebp)
+  801eae:	ff 75 08             	push   0x8(%ebp)
+  801eb1:	e8 61 f4 ff ff       	call   801317 <sys_ipc_reply_recv>
+  801eb6:	83 c4 20             	add    $0x20,%esp
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	78 3a                	js     801ef7 <ipc_reply_recv+0x78>
+  801ebd:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  801ec1:	74 10                	je     801ed3 <ipc_reply_recv+0x54>
+  801ec3:	a1 14 60 80 00       	mov    0x806014,%eax
+  801ec8:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  801ece:	8b 55 18             	mov    0x18(%ebp),%edx
+  801ed1:	89 02                	mov    %eax,(%edx)
+  801ed3:	85 ff                	test   %edi,%edi
+  801ed5:	74 0d                	je     801ee4 <ipc_reply_recv+0x65>
+  801ed7:	a1 14 60 80 00       	mov    0x806014,%eax
+  801edc:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  801ee2:	89 07                	mov    %eax,(%edi)
+  801ee4:	a1 14 60 80 00       	mov    0x806014,%eax
+  801ee9:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  801eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef2:	5b                   	pop    %ebx
+  801ef3:	5e                   	pop    %esi
+  801ef4:	5f                   	pop    %edi
+  801ef5:	5d                   	pop    %ebp
+  801ef6:	c3                   	ret
+  801ef7:	ff 75 14             	push   0x14(%ebp)
+  801efa:	53                   	push   %ebx
+  801efb:	ff 75 0c             	push   0xc(%ebp)
+  801efe:	ff 75 08             	push   0x8(%ebp)
+  801f01:	e8 c3 f2 ff ff       	call   8011c9 <sys_ipc_try_send>
+  801f06:	89 c2                	mov    %eax,%edx
+  801f08:	c1 ea 1f             	shr    $0x1f,%edx
+  801f0b:	83 c4 10             	add    $0x10,%esp
+  801f0e:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801f11:	0f 95 c1             	setne  %cl
+  801f14:	84 d1                	test   %dl,%cl
+  801f16:	74 05                	je     801f1d <ipc_reply_recv+0x9e>
+  801f18:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f1b:	75 12                	jne    801f2f <ipc_reply_recv+0xb0>
+  801f1d:	83 ec 04             	sub    $0x4,%esp
+  801f20:	57                   	push   %edi
+  801f21:	56                   	push   %esi
+  801f22:	ff 75 18             	push   0x18(%ebp)
+  801f25:	e8 e3 fd ff ff       	call   801d0d <ipc_recv>
+  801f2a:	83 c4 10             	add    $0x10,%esp
+  801f2d:	eb c0                	jmp    801eef <ipc_reply_recv+0x70>
+  801f2f:	83 ec 04             	sub    $0x4,%esp
+  801f32:	50                   	push   %eax
+  801f33:	ff 75 08             	push   0x8(%ebp)
+  801f36:	68 40 3f 80 00       	push   $0x803f40
+  801f3b:	e8 d7 e4 ff ff       	call   800417 <cprintf>
+  801f40:	83 c4 10             	add    $0x10,%esp
+  801f43:	eb d8                	jmp    801f1d <ipc_reply_recv+0x9e>
+  801f45:	85 f6                	test   %esi,%esi
+  801f47:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  801f4c:	0f 45 c6             	cmovne %esi,%eax
+  801f4f:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  801f54:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  801f5b:	e9 43 ff ff ff       	jmp    801ea3 <ipc_reply_recv+0x24>
+
+00801f60 <ipc_find_env>:
+  801f60:	55                   	push   %ebp
+  801f61:	89 e5                	mov    %esp,%ebp
+  801f63:	83 ec 14             	sub    $0x14,%esp
+  801f66:	ff 75 08             	push   0x8(%ebp)
+  801f69:	e8 f9 f1 ff ff       	call   801167 <sys_env_service>
+  801f6e:	85 c0                	test   %eax,%eax
+  801f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f75:	0f 48 c2             	cmovs  %edx,%eax
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+
+00801f7a <fd2num>:
+  801f7a:	55                   	push   %ebp
+  801f7b:	89 e5                	mov    %esp,%ebp
+  801f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f80:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f85:	c1 e8 0c             	shr    $0xc,%eax
+  801f88:	5d                   	pop    %ebp
+  801f89:	c3                   	ret
+
+00801f8a <fd2data>:
+  801f8a:	55                   	push   %ebp
+  801f8b:	89 e5                	mov    %esp,%ebp
+  801f8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f90:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f9a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801f9f:	5d                   	pop    %ebp
+  801fa0:	c3                   	ret
+
+00801fa1 <fd_alloc>:
+  801fa1:	55                   	push   %ebp
+  801fa2:	89 e5                	mov    %esp,%ebp
+  801fa4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801fa9:	89 c2                	mov    %eax,%edx
+  801fab:	c1 ea 16             	shr    $0x16,%edx
+  801fae:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801fb5:	f6 c2 01             	test   $0x1,%dl
+  801fb8:	74 29                	je     801fe3 <fd_alloc+0x42>
+  801fba:	89 c2                	mov    %eax,%edx
+  801fbc:	c1 ea 0c             	shr    $0xc,%edx
+  801fbf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fc6:	f6 c2 01             	test   $0x1,%dl
+  801fc9:	74 18                	je     801fe3 <fd_alloc+0x42>
+  801fcb:	05 00 10 00 00       	add    $0x1000,%eax
+  801fd0:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801fd5:	75 d2                	jne    801fa9 <fd_alloc+0x8>
+  801fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801fe1:	eb 05                	jmp    801fe8 <fd_alloc+0x47>
+  801fe3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801feb:	89 02                	mov    %eax,(%edx)
+  801fed:	89 c8                	mov    %ecx,%eax
+  801fef:	5d                   	pop    %ebp
+  801ff0:	c3                   	ret
+
+00801ff1 <fd_lookup>:
+  801ff1:	55                   	push   %ebp
+  801ff2:	89 e5                	mov    %esp,%ebp
+  801ff4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff7:	83 f8 1f             	cmp    $0x1f,%eax
+  801ffa:	77 30                	ja     80202c <fd_lookup+0x3b>
+  801ffc:	c1 e0 0c             	shl    $0xc,%eax
+  801fff:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  802004:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80200a:	f6 c2 01             	test   $0x1,%dl
+  80200d:	74 24                	je     802033 <fd_lookup+0x42>
+  80200f:	89 c2                	mov    %eax,%edx
+  802011:	c1 ea 0c             	shr    $0xc,%edx
+  802014:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80201b:	f6 c2 01             	test   $0x1,%dl
+  80201e:	74 1a                	je     80203a <fd_lookup+0x49>
+  802020:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802023:	89 02                	mov    %eax,(%edx)
+  802025:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+  80202c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802031:	eb f7                	jmp    80202a <fd_lookup+0x39>
+  802033:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802038:	eb f0                	jmp    80202a <fd_lookup+0x39>
+  80203a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80203f:	eb e9                	jmp    80202a <fd_lookup+0x39>
+
+00802041 <dev_lookup>:
+  802041:	55                   	push   %ebp
+  802042:	89 e5                	mov    %esp,%ebp
+  802044:	53                   	push   %ebx
+  802045:	83 ec 04             	sub    $0x4,%esp
+  802048:	8b 55 08             	mov    0x8(%ebp),%edx
+  80204b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802050:	bb 04 50 80 00       	mov    $0x805004,%ebx
+  802055:	39 13                	cmp    %edx,(%ebx)
+  802057:	74 37                	je     802090 <dev_lookup+0x4f>
+  802059:	83 c0 01             	add    $0x1,%eax
+  80205c:	8b 1c 85 08 40 80 00 	mov    0x804008(,%eax,4),%ebx
+  802063:	85 db                	test   %ebx,%ebx
+  802065:	75 ee                	jne    802055 <dev_lookup+0x14>
+  802067:	a1 14 60 80 00       	mov    0x806014,%eax
+  80206c:	8b 40 48             	mov    0x48(%eax),%eax
+  80206f:	83 ec 04             	sub    $0x4,%esp
+  802072:	52                   	push   %edx
+  802073:	50                   	push   %eax
+  802074:	68 8c 3f 80 00       	push   $0x803f8c
+  802079:	e8 99 e3 ff ff       	call   800417 <cprintf>
+  80207e:	83 c4 10             	add    $0x10,%esp
+  802081:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802086:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802089:	89 1a                	mov    %ebx,(%edx)
+  80208b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208e:	c9                   	leave
+  80208f:	c3                   	ret
+  802090:	b8 00 00 00 00       	mov    $0x0,%eax
+  802095:	eb ef                	jmp    802086 <dev_lookup+0x45>
+
+00802097 <fd_close>:
+  802097:	55                   	push   %ebp
+  802098:	89 e5                	mov    %esp,%ebp
+  80209a:	57                   	push   %edi
+  80209b:	56                   	push   %esi
+  80209c:	53                   	push   %ebx
+  80209d:	83 ec 24             	sub    $0x24,%esp
+  8020a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020a9:	50                   	push   %eax
+  8020aa:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8020b0:	c1 e8 0c             	shr    $0xc,%eax
+  8020b3:	50                   	push   %eax
+  8020b4:	e8 38 ff ff ff       	call   801ff1 <fd_lookup>
+  8020b9:	89 c3                	mov    %eax,%ebx
+  8020bb:	83 c4 10             	add    $0x10,%esp
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 05                	js     8020c7 <fd_close+0x30>
+  8020c2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8020c5:	74 0f                	je     8020d6 <fd_close+0x3f>
+  8020c7:	85 ff                	test   %edi,%edi
+  8020c9:	0f 44 df             	cmove  %edi,%ebx
+  8020cc:	89 d8                	mov    %ebx,%eax
+  8020ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d1:	5b                   	pop    %ebx
+  8020d2:	5e                   	pop    %esi
+  8020d3:	5f                   	pop    %edi
+  8020d4:	5d                   	pop    %ebp
+  8020d5:	c3                   	ret
+  8020d6:	83 ec 08             	sub    $0x8,%esp
+  8020d9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8020dc:	50                   	push   %eax
+  8020dd:	ff 36                	push   (%esi)
+  8020df:	e8 5d ff ff ff       	call   802041 <dev_lookup>
+  8020e4:	89 c3                	mov    %eax,%ebx
+  8020e6:	83 c4 10             	add    $0x10,%esp
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 1a                	js     802107 <fd_close+0x70>
+  8020ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020f0:	8b 40 10             	mov    0x10(%eax),%eax
+  8020f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	74 0b                	je     802107 <fd_close+0x70>
+  8020fc:	83 ec 0c             	sub    $0xc,%esp
+  8020ff:	56                   	push   %esi
+  802100:	ff d0                	call   *%eax
+  802102:	89 c3                	mov    %eax,%ebx
+  802104:	83 c4 10             	add    $0x10,%esp
+  802107:	83 ec 08             	sub    $0x8,%esp
+  80210a:	56                   	push   %esi
+  80210b:	6a 00                	push   $0x0
+  80210d:	e8 2e ef ff ff       	call   801040 <sys_page_unmap>
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	eb b5                	jmp    8020cc <fd_close+0x35>
+
+00802117 <close>:
+  802117:	55                   	push   %ebp
+  802118:	89 e5                	mov    %esp,%ebp
+  80211a:	83 ec 20             	sub    $0x20,%esp
+  80211d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802120:	50                   	push   %eax
+  802121:	ff 75 08             	push   0x8(%ebp)
+  802124:	e8 c8 fe ff ff       	call   801ff1 <fd_lookup>
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	79 02                	jns    802132 <close+0x1b>
+  802130:	c9                   	leave
+  802131:	c3                   	ret
+  802132:	83 ec 08             	sub    $0x8,%esp
+  802135:	6a 01                	push   $0x1
+  802137:	ff 75 f4             	push   -0xc(%ebp)
+  80213a:	e8 58 ff ff ff       	call   802097 <fd_close>
+  80213f:	83 c4 10             	add    $0x10,%esp
+  802142:	eb ec                	jmp    802130 <close+0x19>
+
+00802144 <close_all>:
+  802144:	55                   	push   %ebp
+  802145:	89 e5                	mov    %esp,%ebp
+  802147:	53                   	push   %ebx
+  802148:	83 ec 04             	sub    $0x4,%esp
+  80214b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802150:	83 ec 0c             	sub    $0xc,%esp
+  802153:	53                   	push   %ebx
+  802154:	e8 be ff ff ff       	call   802117 <close>
+  802159:	83 c3 01             	add    $0x1,%ebx
+  80215c:	83 c4 10             	add    $0x10,%esp
+  80215f:	83 fb 20             	cmp    $0x20,%ebx
+  802162:	75 ec                	jne    802150 <close_all+0xc>
+  802164:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+
+00802169 <dup>:
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	57                   	push   %edi
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	83 ec 34             	sub    $0x34,%esp
+  802172:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802175:	50                   	push   %eax
+  802176:	ff 75 08             	push   0x8(%ebp)
+  802179:	e8 73 fe ff ff       	call   801ff1 <fd_lookup>
+  80217e:	89 c3                	mov    %eax,%ebx
+  802180:	83 c4 10             	add    $0x10,%esp
+  802183:	85 c0                	test   %eax,%eax
+  802185:	78 7f                	js     802206 <dup+0x9d>
+  802187:	83 ec 0c             	sub    $0xc,%esp
+  80218a:	ff 75 0c             	push   0xc(%ebp)
+  80218d:	e8 85 ff ff ff       	call   802117 <close>
+  802192:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802195:	c1 e6 0c             	shl    $0xc,%esi
+  802198:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80219e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8021a1:	89 3c 24             	mov    %edi,(%esp)
+  8021a4:	e8 e1 fd ff ff       	call   801f8a <fd2data>
+  8021a9:	89 c3                	mov    %eax,%ebx
+  8021ab:	89 34 24             	mov    %esi,(%esp)
+  8021ae:	e8 d7 fd ff ff       	call   801f8a <fd2data>
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8021b9:	89 d8                	mov    %ebx,%eax
+  8021bb:	c1 e8 16             	shr    $0x16,%eax
+  8021be:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021c5:	a8 01                	test   $0x1,%al
+  8021c7:	74 11                	je     8021da <dup+0x71>
+  8021c9:	89 d8                	mov    %ebx,%eax
+  8021cb:	c1 e8 0c             	shr    $0xc,%eax
+  8021ce:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8021d5:	f6 c2 01             	test   $0x1,%dl
+  8021d8:	75 36                	jne    802210 <dup+0xa7>
+  8021da:	89 f8                	mov    %edi,%eax
+  8021dc:	c1 e8 0c             	shr    $0xc,%eax
+  8021df:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021e6:	83 ec 0c             	sub    $0xc,%esp
+  8021e9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021ee:	50                   	push   %eax
+  8021ef:	56                   	push   %esi
+  8021f0:	6a 00                	push   $0x0
+  8021f2:	57                   	push   %edi
+  8021f3:	6a 00                	push   $0x0
+  8021f5:	e8 b7 ed ff ff       	call   800fb1 <sys_page_map>
+  8021fa:	89 c3                	mov    %eax,%ebx
+  8021fc:	83 c4 20             	add    $0x20,%esp
+  8021ff:	85 c0                	test   %eax,%eax
+  802201:	78 33                	js     802236 <dup+0xcd>
+  802203:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802206:	89 d8                	mov    %ebx,%eax
+  802208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220b:	5b                   	pop    %ebx
+  80220c:	5e                   	pop    %esi
+  80220d:	5f                   	pop    %edi
+  80220e:	5d                   	pop    %ebp
+  80220f:	c3                   	ret
+  802210:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802217:	83 ec 0c             	sub    $0xc,%esp
+  80221a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80221f:	50                   	push   %eax
+  802220:	ff 75 d4             	push   -0x2c(%ebp)
+  802223:	6a 00                	push   $0x0
+  802225:	53                   	push   %ebx
+  802226:	6a 00                	push   $0x0
+  802228:	e8 84 ed ff ff       	call   800fb1 <sys_page_map>
+  80222d:	89 c3                	mov    %eax,%ebx
+  80222f:	83 c4 20             	add    $0x20,%esp
+  802232:	85 c0                	test   %eax,%eax
+  802234:	79 a4                	jns    8021da <dup+0x71>
+  802236:	83 ec 08             	sub    $0x8,%esp
+  802239:	56                   	push   %esi
+  80223a:	6a 00                	push   $0x0
+  80223c:	e8 ff ed ff ff       	call   801040 <sys_page_unmap>
+  802241:	83 c4 08             	add    $0x8,%esp
+  802244:	ff 75 d4             	push   -0x2c(%ebp)
+  802247:	6a 00                	push   $0x0
+  802249:	e8 f2 ed ff ff       	call   801040 <sys_page_unmap>
+  80224e:	83 c4 10             	add    $0x10,%esp
+  802251:	eb b3                	jmp    802206 <dup+0x9d>
+
+00802253 <read>:
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	56                   	push   %esi
+  802257:	53                   	push   %ebx
+  802258:	83 ec 18             	sub    $0x18,%esp
+  80225b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80225e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802261:	50                   	push   %eax
+  802262:	56                   	push   %esi
+  802263:	e8 89 fd ff ff       	call   801ff1 <fd_lookup>
+  802268:	83 c4 10             	add    $0x10,%esp
+  80226b:	85 c0                	test   %eax,%eax
+  80226d:	78 3c                	js     8022ab <read+0x58>
+  80226f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802272:	83 ec 08             	sub    $0x8,%esp
+  802275:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802278:	50                   	push   %eax
+  802279:	ff 33                	push   (%ebx)
+  80227b:	e8 c1 fd ff ff       	call   802041 <dev_lookup>
+  802280:	83 c4 10             	add    $0x10,%esp
+  802283:	85 c0                	test   %eax,%eax
+  802285:	78 24                	js     8022ab <read+0x58>
+  802287:	8b 43 08             	mov    0x8(%ebx),%eax
+  80228a:	83 e0 03             	and    $0x3,%eax
+  80228d:	83 f8 01             	cmp    $0x1,%eax
+  802290:	74 20                	je     8022b2 <read+0x5f>
+  802292:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802295:	8b 40 08             	mov    0x8(%eax),%eax
+  802298:	85 c0                	test   %eax,%eax
+  80229a:	74 37                	je     8022d3 <read+0x80>
+  80229c:	83 ec 04             	sub    $0x4,%esp
+  80229f:	ff 75 10             	push   0x10(%ebp)
+  8022a2:	ff 75 0c             	push   0xc(%ebp)
+  8022a5:	53                   	push   %ebx
+  8022a6:	ff d0                	call   *%eax
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ae:	5b                   	pop    %ebx
+  8022af:	5e                   	pop    %esi
+  8022b0:	5d                   	pop    %ebp
+  8022b1:	c3                   	ret
+  8022b2:	a1 14 60 80 00       	mov    0x806014,%eax
+  8022b7:	8b 40 48             	mov    0x48(%eax),%eax
+  8022ba:	83 ec 04             	sub    $0x4,%esp
+  8022bd:	56                   	push   %esi
+  8022be:	50                   	push   %eax
+  8022bf:	68 cd 3f 80 00       	push   $0x803fcd
+  8022c4:	e8 4e e1 ff ff       	call   800417 <cprintf>
+  8022c9:	83 c4 10             	add    $0x10,%esp
+  8022cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022d1:	eb d8                	jmp    8022ab <read+0x58>
+  8022d3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022d8:	eb d1                	jmp    8022ab <read+0x58>
+
+008022da <readn>:
+  8022da:	55                   	push   %ebp
+  8022db:	89 e5                	mov    %esp,%ebp
+  8022dd:	57                   	push   %edi
+  8022de:	56                   	push   %esi
+  8022df:	53                   	push   %ebx
+  8022e0:	83 ec 0c             	sub    $0xc,%esp
+  8022e3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8022e6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8022e9:	85 f6                	test   %esi,%esi
+  8022eb:	74 30                	je     80231d <readn+0x43>
+  8022ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f7:	83 ec 04             	sub    $0x4,%esp
+  8022fa:	89 f2                	mov    %esi,%edx
+  8022fc:	29 c2                	sub    %eax,%edx
+  8022fe:	52                   	push   %edx
+  8022ff:	01 f8                	add    %edi,%eax
+  802301:	50                   	push   %eax
+  802302:	ff 75 08             	push   0x8(%ebp)
+  802305:	e8 49 ff ff ff       	call   802253 <read>
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	85 c0                	test   %eax,%eax
+  80230f:	78 15                	js     802326 <readn+0x4c>
+  802311:	74 11                	je     802324 <readn+0x4a>
+  802313:	01 c3                	add    %eax,%ebx
+  802315:	89 d8                	mov    %ebx,%eax
+  802317:	39 f3                	cmp    %esi,%ebx
+  802319:	72 dc                	jb     8022f7 <readn+0x1d>
+  80231b:	eb 09                	jmp    802326 <readn+0x4c>
+  80231d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802322:	eb 02                	jmp    802326 <readn+0x4c>
+  802324:	89 d8                	mov    %ebx,%eax
+  802326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802329:	5b                   	pop    %ebx
+  80232a:	5e                   	pop    %esi
+  80232b:	5f                   	pop    %edi
+  80232c:	5d                   	pop    %ebp
+  80232d:	c3                   	ret
+
+0080232e <write>:
+  80232e:	55                   	push   %ebp
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	56                   	push   %esi
+  802332:	53                   	push   %ebx
+  802333:	83 ec 18             	sub    $0x18,%esp
+  802336:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802339:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80233c:	50                   	push   %eax
+  80233d:	53                   	push   %ebx
+  80233e:	e8 ae fc ff ff       	call   801ff1 <fd_lookup>
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	85 c0                	test   %eax,%eax
+  802348:	78 37                	js     802381 <write+0x53>
+  80234a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80234d:	83 ec 08             	sub    $0x8,%esp
+  802350:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802353:	50                   	push   %eax
+  802354:	ff 36                	push   (%esi)
+  802356:	e8 e6 fc ff ff       	call   802041 <dev_lookup>
+  80235b:	83 c4 10             	add    $0x10,%esp
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	78 1f                	js     802381 <write+0x53>
+  802362:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802366:	74 20                	je     802388 <write+0x5a>
+  802368:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80236e:	85 c0                	test   %eax,%eax
+  802370:	74 37                	je     8023a9 <write+0x7b>
+  802372:	83 ec 04             	sub    $0x4,%esp
+  802375:	ff 75 10             	push   0x10(%ebp)
+  802378:	ff 75 0c             	push   0xc(%ebp)
+  80237b:	56                   	push   %esi
+  80237c:	ff d0                	call   *%eax
+  80237e:	83 c4 10             	add    $0x10,%esp
+  802381:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802384:	5b                   	pop    %ebx
+  802385:	5e                   	pop    %esi
+  802386:	5d                   	pop    %ebp
+  802387:	c3                   	ret
+  802388:	a1 14 60 80 00       	mov    0x806014,%eax
+  80238d:	8b 40 48             	mov    0x48(%eax),%eax
+  802390:	83 ec 04             	sub    $0x4,%esp
+  802393:	53                   	push   %ebx
+  802394:	50                   	push   %eax
+  802395:	68 e9 3f 80 00       	push   $0x803fe9
+  80239a:	e8 78 e0 ff ff       	call   800417 <cprintf>
+  80239f:	83 c4 10             	add    $0x10,%esp
+  8023a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023a7:	eb d8                	jmp    802381 <write+0x53>
+  8023a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023ae:	eb d1                	jmp    802381 <write+0x53>
+
+008023b0 <seek>:
+  8023b0:	55                   	push   %ebp
+  8023b1:	89 e5                	mov    %esp,%ebp
+  8023b3:	83 ec 20             	sub    $0x20,%esp
+  8023b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023b9:	50                   	push   %eax
+  8023ba:	ff 75 08             	push   0x8(%ebp)
+  8023bd:	e8 2f fc ff ff       	call   801ff1 <fd_lookup>
+  8023c2:	83 c4 10             	add    $0x10,%esp
+  8023c5:	85 c0                	test   %eax,%eax
+  8023c7:	78 0e                	js     8023d7 <seek+0x27>
+  8023c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023cf:	89 50 04             	mov    %edx,0x4(%eax)
+  8023d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d7:	c9                   	leave
+  8023d8:	c3                   	ret
+
+008023d9 <ftruncate>:
+  8023d9:	55                   	push   %ebp
+  8023da:	89 e5                	mov    %esp,%ebp
+  8023dc:	56                   	push   %esi
+  8023dd:	53                   	push   %ebx
+  8023de:	83 ec 18             	sub    $0x18,%esp
+  8023e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023e7:	50                   	push   %eax
+  8023e8:	53                   	push   %ebx
+  8023e9:	e8 03 fc ff ff       	call   801ff1 <fd_lookup>
+  8023ee:	83 c4 10             	add    $0x10,%esp
+  8023f1:	85 c0                	test   %eax,%eax
+  8023f3:	78 34                	js     802429 <ftruncate+0x50>
+  8023f5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023f8:	83 ec 08             	sub    $0x8,%esp
+  8023fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023fe:	50                   	push   %eax
+  8023ff:	ff 36                	push   (%esi)
+  802401:	e8 3b fc ff ff       	call   802041 <dev_lookup>
+  802406:	83 c4 10             	add    $0x10,%esp
+  802409:	85 c0                	test   %eax,%eax
+  80240b:	78 1c                	js     802429 <ftruncate+0x50>
+  80240d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802411:	74 1d                	je     802430 <ftruncate+0x57>
+  802413:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802416:	8b 40 18             	mov    0x18(%eax),%eax
+  802419:	85 c0                	test   %eax,%eax
+  80241b:	74 34                	je     802451 <ftruncate+0x78>
+  80241d:	83 ec 08             	sub    $0x8,%esp
+  802420:	ff 75 0c             	push   0xc(%ebp)
+  802423:	56                   	push   %esi
+  802424:	ff d0                	call   *%eax
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80242c:	5b                   	pop    %ebx
+  80242d:	5e                   	pop    %esi
+  80242e:	5d                   	pop    %ebp
+  80242f:	c3                   	ret
+  802430:	a1 14 60 80 00       	mov    0x806014,%eax
+  802435:	8b 40 48             	mov    0x48(%eax),%eax
+  802438:	83 ec 04             	sub    $0x4,%esp
+  80243b:	53                   	push   %ebx
+  80243c:	50                   	push   %eax
+  80243d:	68 ac 3f 80 00       	push   $0x803fac
+  802442:	e8 d0 df ff ff       	call   800417 <cprintf>
+  802447:	83 c4 10             	add    $0x10,%esp
+  80244a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80244f:	eb d8                	jmp    802429 <ftruncate+0x50>
+  802451:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802456:	eb d1                	jmp    802429 <ftruncate+0x50>
+
+00802458 <fstat>:
+  802458:	55                   	push   %ebp
+  802459:	89 e5                	mov    %esp,%ebp
+  80245b:	56                   	push   %esi
+  80245c:	53                   	push   %ebx
+  80245d:	83 ec 18             	sub    $0x18,%esp
+  802460:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802463:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802466:	50                   	push   %eax
+  802467:	ff 75 08             	push   0x8(%ebp)
+  80246a:	e8 82 fb ff ff       	call   801ff1 <fd_lookup>
+  80246f:	83 c4 10             	add    $0x10,%esp
+  802472:	85 c0                	test   %eax,%eax
+  802474:	78 49                	js     8024bf <fstat+0x67>
+  802476:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802479:	83 ec 08             	sub    $0x8,%esp
+  80247c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80247f:	50                   	push   %eax
+  802480:	ff 36                	push   (%esi)
+  802482:	e8 ba fb ff ff       	call   802041 <dev_lookup>
+  802487:	83 c4 10             	add    $0x10,%esp
+  80248a:	85 c0                	test   %eax,%eax
+  80248c:	78 31                	js     8024bf <fstat+0x67>
+  80248e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802491:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802495:	74 2f                	je     8024c6 <fstat+0x6e>
+  802497:	c6 03 00             	movb   $0x0,(%ebx)
+  80249a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8024a1:	00 00 00 
+  8024a4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024ab:	00 00 00 
+  8024ae:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  8024b4:	83 ec 08             	sub    $0x8,%esp
+  8024b7:	53                   	push   %ebx
+  8024b8:	56                   	push   %esi
+  8024b9:	ff 50 14             	call   *0x14(%eax)
+  8024bc:	83 c4 10             	add    $0x10,%esp
+  8024bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c2:	5b                   	pop    %ebx
+  8024c3:	5e                   	pop    %esi
+  8024c4:	5d                   	pop    %ebp
+  8024c5:	c3                   	ret
+  8024c6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024cb:	eb f2                	jmp    8024bf <fstat+0x67>
+
+008024cd <stat>:
+  8024cd:	55                   	push   %ebp
+  8024ce:	89 e5                	mov    %esp,%ebp
+  8024d0:	56                   	push   %esi
+  8024d1:	53                   	push   %ebx
+  8024d2:	83 ec 08             	sub    $0x8,%esp
+  8024d5:	6a 00                	push   $0x0
+  8024d7:	ff 75 08             	push   0x8(%ebp)
+  8024da:	e8 31 05 00 00       	call   802a10 <open>
+  8024df:	89 c3                	mov    %eax,%ebx
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	78 1b                	js     802503 <stat+0x36>
+  8024e8:	83 ec 08             	sub    $0x8,%esp
+  8024eb:	ff 75 0c             	push   0xc(%ebp)
+  8024ee:	50                   	push   %eax
+  8024ef:	e8 64 ff ff ff       	call   802458 <fstat>
+  8024f4:	89 c6                	mov    %eax,%esi
+  8024f6:	89 1c 24             	mov    %ebx,(%esp)
+  8024f9:	e8 19 fc ff ff       	call   802117 <close>
+  8024fe:	83 c4 10             	add    $0x10,%esp
+  802501:	89 f3                	mov    %esi,%ebx
+  802503:	89 d8                	mov    %ebx,%eax
+  802505:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802508:	5b                   	pop    %ebx
+  802509:	5e                   	pop    %esi
+  80250a:	5d                   	pop    %ebp
+  80250b:	c3                   	ret
+
+0080250c <fsipc>:
+  80250c:	55                   	push   %ebp
+  80250d:	89 e5                	mov    %esp,%ebp
+  80250f:	56                   	push   %esi
+  802510:	53                   	push   %ebx
+  802511:	89 c3                	mov    %eax,%ebx
+  802513:	89 d6                	mov    %edx,%esi
+  802515:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  80251c:	74 20                	je     80253e <fsipc+0x32>
+  80251e:	83 ec 08             	sub    $0x8,%esp
+  802521:	6a 00                	push   $0x0
+  802523:	56                   	push   %esi
+  802524:	6a 07                	push   $0x7
+  802526:	68 00 70 80 00       	push   $0x807000
+  80252b:	53                   	push   %ebx
+  80252c:	ff 35 0c 60 80 00    	push   0x80600c
+  802532:	e8 8e f8 ff ff       	call   801dc5 <ipc_call>
+  802537:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80253a:	5b                   	pop    %ebx
+  80253b:	5e                   	pop    %esi
+  80253c:	5d                   	pop    %ebp
+  80253d:	c3                   	ret
+  80253e:	83 ec 0c             	sub    $0xc,%esp
+  802541:	6a 02                	push   $0x2
+  802543:	e8 18 fa ff ff       	call   801f60 <ipc_find_env>
+  802548:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  80254d:	83 c4 10             	add    $0x10,%esp
+  802550:	eb cc                	jmp    80251e <fsipc+0x12>
+
+00802552 <devfile_trunc>:
+  802552:	55                   	push   %ebp
+  802553:	89 e5                	mov    %esp,%ebp
+  802555:	83 ec 08             	sub    $0x8,%esp
+  802558:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80255e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802563:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802566:	a3 04 70 80 00       	mov    %eax,0x807004
+  80256b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802570:	b8 02 00 00 00       	mov    $0x2,%eax
+  802575:	e8 92 ff ff ff       	call   80250c <fsipc>
+  80257a:	c9                   	leave
+  80257b:	c3                   	ret
+
+0080257c <devfile_flush>:
+  80257c:	55                   	push   %ebp
+  80257d:	89 e5                	mov    %esp,%ebp
+  80257f:	83 ec 08             	sub    $0x8,%esp
+  802582:	8b 45 08             	mov    0x8(%ebp),%eax
+  802585:	8b 40 0c             	mov    0xc(%eax),%eax
+  802588:	a3 00 70 80 00       	mov    %eax,0x807000
+  80258d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802592:	b8 08 00 00 00       	mov    $0x8,%eax
+  802597:	e8 70 ff ff ff       	call   80250c <fsipc>
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+0080259e <devfile_stat>:
+  80259e:	55                   	push   %ebp
+  80259f:	89 e5                	mov    %esp,%ebp
+  8025a1:	53                   	push   %ebx
+  8025a2:	83 ec 04             	sub    $0x4,%esp
+  8025a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025ae:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025bd:	e8 4a ff ff ff       	call   80250c <fsipc>
+  8025c2:	85 c0                	test   %eax,%eax
+  8025c4:	78 2c                	js     8025f2 <devfile_stat+0x54>
+  8025c6:	83 ec 08             	sub    $0x8,%esp
+  8025c9:	68 00 70 80 00       	push   $0x807000
+  8025ce:	53                   	push   %ebx
+  8025cf:	e8 3a e5 ff ff       	call   800b0e <strcpy>
+  8025d4:	a1 80 70 80 00       	mov    0x807080,%eax
+  8025d9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8025df:	a1 84 70 80 00       	mov    0x807084,%eax
+  8025e4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  8025ea:	83 c4 10             	add    $0x10,%esp
+  8025ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f5:	c9                   	leave
+  8025f6:	c3                   	ret
+
+008025f7 <fsring_rw>:
+  8025f7:	55                   	push   %ebp
+  8025f8:	89 e5                	mov    %esp,%ebp
+  8025fa:	57                   	push   %edi
+  8025fb:	56                   	push   %esi
+  8025fc:	53                   	push   %ebx
+  8025fd:	83 ec 2c             	sub    $0x2c,%esp
+  802600:	89 c7                	mov    %eax,%edi
+  802602:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802605:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802608:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  80260d:	a8 01                	test   $0x1,%al
+  80260f:	74 0d                	je     80261e <fsring_rw+0x27>
+  802611:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  802616:	a8 01                	test   $0x1,%al
+  802618:	0f 85 d5 00 00 00    	jne    8026f3 <fsring_rw+0xfc>
+  80261e:	a1 14 60 80 00       	mov    0x806014,%eax
+  802623:	8b 40 48             	mov    0x48(%eax),%eax
+  802626:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  80262c:	0f 84 fc 00 00 00    	je     80272e <fsring_rw+0x137>
+  802632:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  802639:	0f 84 02 01 00 00    	je     802741 <fsring_rw+0x14a>
+  80263f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802644:	83 ec 04             	sub    $0x4,%esp
+  802647:	68 07 02 00 00       	push   $0x207
+  80264c:	53                   	push   %ebx
+  80264d:	6a 00                	push   $0x0
+  80264f:	e8 1a e9 ff ff       	call   800f6e <sys_page_alloc>
+  802654:	83 c4 10             	add    $0x10,%esp
+  802657:	85 c0                	test   %eax,%eax
+  802659:	0f 88 f9 00 00 00    	js     802758 <fsring_rw+0x161>
+  80265f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802665:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  80266b:	75 d7                	jne    802644 <fsring_rw+0x4d>
+  80266d:	6a 0e                	push   $0xe
+  80266f:	6a 0d                	push   $0xd
+  802671:	ff 35 0c 60 80 00    	push   0x80600c
+  802677:	68 00 00 f0 cf       	push   $0xcff00000
+  80267c:	e8 c4 0c 00 00       	call   803345 <ipcring_init>
+  802681:	83 c4 08             	add    $0x8,%esp
+  802684:	6a 00                	push   $0x0
+  802686:	6a 00                	push   $0x0
+  802688:	68 07 02 00 00       	push   $0x207
+  80268d:	68 00 00 f0 cf       	push   $0xcff00000
+  802692:	6a 0b                	push   $0xb
+  802694:	ff 35 0c 60 80 00    	push   0x80600c
+  80269a:	e8 26 f7 ff ff       	call   801dc5 <ipc_call>
+  80269f:	89 c6                	mov    %eax,%esi
+  8026a1:	83 c4 20             	add    $0x20,%esp
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	0f 88 ac 00 00 00    	js     802758 <fsring_rw+0x161>
+  8026ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b1:	89 d9                	mov    %ebx,%ecx
+  8026b3:	83 c3 01             	add    $0x1,%ebx
+  8026b6:	89 da                	mov    %ebx,%edx
+  8026b8:	c1 e2 0c             	shl    $0xc,%edx
+  8026bb:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  8026c1:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  8026c7:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  8026cd:	83 ec 08             	sub    $0x8,%esp
+  8026d0:	6a 00                	push   $0x0
+  8026d2:	6a 00                	push   $0x0
+  8026d4:	68 07 02 00 00       	push   $0x207
+  8026d9:	50                   	push   %eax
+  8026da:	6a 0c                	push   $0xc
+  8026dc:	ff 35 0c 60 80 00    	push   0x80600c
+  8026e2:	e8 de f6 ff ff       	call   801dc5 <ipc_call>
+  8026e7:	83 c4 20             	add    $0x20,%esp
+  8026ea:	85 c0                	test   %eax,%eax
+  8026ec:	78 6a                	js     802758 <fsring_rw+0x161>
+  8026ee:	83 fb 08             	cmp    $0x8,%ebx
+  8026f1:	75 be                	jne    8026b1 <fsring_rw+0xba>
+  8026f3:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8026f7:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  8026fc:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802701:	0f 45 c2             	cmovne %edx,%eax
+  802704:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802707:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  80270e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  802715:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  80271c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802721:	be 00 00 00 00       	mov    $0x0,%esi
+  802726:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802729:	e9 4b 01 00 00       	jmp    802879 <fsring_rw+0x282>
+  80272e:	e8 05 ec ff ff       	call   801338 <sys_time_msec>
+  802733:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  802739:	0f 89 f3 fe ff ff    	jns    802632 <fsring_rw+0x3b>
+  80273f:	eb 54                	jmp    802795 <fsring_rw+0x19e>
+  802741:	83 ec 0c             	sub    $0xc,%esp
+  802744:	6a 02                	push   $0x2
+  802746:	e8 15 f8 ff ff       	call   801f60 <ipc_find_env>
+  80274b:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  802750:	83 c4 10             	add    $0x10,%esp
+  802753:	e9 e7 fe ff ff       	jmp    80263f <fsring_rw+0x48>
+  802758:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80275d:	83 ec 08             	sub    $0x8,%esp
+  802760:	53                   	push   %ebx
+  802761:	6a 00                	push   $0x0
+  802763:	e8 d8 e8 ff ff       	call   801040 <sys_page_unmap>
+  802768:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80276e:	83 c4 10             	add    $0x10,%esp
+  802771:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802777:	75 e4                	jne    80275d <fsring_rw+0x166>
+  802779:	e8 ba eb ff ff       	call   801338 <sys_time_msec>
+  80277e:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802783:	a3 04 60 80 00       	mov    %eax,0x806004
+  802788:	a1 14 60 80 00       	mov    0x806014,%eax
+  80278d:	8b 40 48             	mov    0x48(%eax),%eax
+  802790:	a3 08 60 80 00       	mov    %eax,0x806008
+  802795:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80279c:	e9 7a 01 00 00       	jmp    80291b <fsring_rw+0x324>
+  8027a1:	8b 57 0c             	mov    0xc(%edi),%edx
+  8027a4:	89 10                	mov    %edx,(%eax)
+  8027a6:	89 58 04             	mov    %ebx,0x4(%eax)
+  8027a9:	89 f2                	mov    %esi,%edx
+  8027ab:	03 57 04             	add    0x4(%edi),%edx
+  8027ae:	89 50 08             	mov    %edx,0x8(%eax)
+  8027b1:	83 ec 04             	sub    $0x4,%esp
+  8027b4:	53                   	push   %ebx
+  8027b5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8027b8:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  8027bb:	52                   	push   %edx
+  8027bc:	83 c0 0c             	add    $0xc,%eax
+  8027bf:	50                   	push   %eax
+  8027c0:	e8 f9 e4 ff ff       	call   800cbe <memmove>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+  8027c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027cb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027ce:	89 08                	mov    %ecx,(%eax)
+  8027d0:	83 ec 0c             	sub    $0xc,%esp
+  8027d3:	68 00 00 f0 cf       	push   $0xcff00000
+  8027d8:	e8 c6 0b 00 00       	call   8033a3 <ipcring_req_push>
+  8027dd:	01 de                	add    %ebx,%esi
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8027e5:	73 4c                	jae    802833 <fsring_rw+0x23c>
+  8027e7:	83 ec 0c             	sub    $0xc,%esp
+  8027ea:	68 00 00 f0 cf       	push   $0xcff00000
+  8027ef:	e8 89 0b 00 00       	call   80337d <ipcring_req_slot>
+  8027f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027f7:	83 c4 10             	add    $0x10,%esp
+  8027fa:	85 c0                	test   %eax,%eax
+  8027fc:	74 35                	je     802833 <fsring_rw+0x23c>
+  8027fe:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802803:	83 e0 07             	and    $0x7,%eax
+  802806:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  80280b:	c1 e0 0c             	shl    $0xc,%eax
+  80280e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802811:	29 f3                	sub    %esi,%ebx
+  802813:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802816:	39 cb                	cmp    %ecx,%ebx
+  802818:	0f 47 d9             	cmova  %ecx,%ebx
+  80281b:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80281f:	75 80                	jne    8027a1 <fsring_rw+0x1aa>
+  802821:	8b 57 0c             	mov    0xc(%edi),%edx
+  802824:	89 10                	mov    %edx,(%eax)
+  802826:	89 58 04             	mov    %ebx,0x4(%eax)
+  802829:	89 f2                	mov    %esi,%edx
+  80282b:	03 57 04             	add    0x4(%edi),%edx
+  80282e:	89 50 08             	mov    %edx,0x8(%eax)
+  802831:	eb 95                	jmp    8027c8 <fsring_rw+0x1d1>
+  802833:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  802838:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80283b:	83 ec 0c             	sub    $0xc,%esp
+  80283e:	68 00 00 f0 cf       	push   $0xcff00000
+  802843:	e8 94 0b 00 00       	call   8033dc <ipcring_rsp_wait>
+  802848:	8b 58 04             	mov    0x4(%eax),%ebx
+  80284b:	83 c4 10             	add    $0x10,%esp
+  80284e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802852:	75 45                	jne    802899 <fsring_rw+0x2a2>
+  802854:	85 db                	test   %ebx,%ebx
+  802856:	79 41                	jns    802899 <fsring_rw+0x2a2>
+  802858:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  80285b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802862:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802869:	83 ec 0c             	sub    $0xc,%esp
+  80286c:	68 00 00 f0 cf       	push   $0xcff00000
+  802871:	e8 cc 0b 00 00       	call   803442 <ipcring_rsp_pop>
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80287f:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802884:	39 c2                	cmp    %eax,%edx
+  802886:	74 75                	je     8028fd <fsring_rw+0x306>
+  802888:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80288c:	75 a5                	jne    802833 <fsring_rw+0x23c>
+  80288e:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802891:	0f 82 50 ff ff ff    	jb     8027e7 <fsring_rw+0x1f0>
+  802897:	eb 9a                	jmp    802833 <fsring_rw+0x23c>
+  802899:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80289d:	75 ca                	jne    802869 <fsring_rw+0x272>
+  80289f:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8028a3:	74 31                	je     8028d6 <fsring_rw+0x2df>
+  8028a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a8:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8028ab:	29 c8                	sub    %ecx,%eax
+  8028ad:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8028b0:	39 d0                	cmp    %edx,%eax
+  8028b2:	0f 47 c2             	cmova  %edx,%eax
+  8028b5:	39 d8                	cmp    %ebx,%eax
+  8028b7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028bc:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  8028c0:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  8028c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028c8:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  8028cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8028cf:	01 d9                	add    %ebx,%ecx
+  8028d1:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  8028d4:	eb 93                	jmp    802869 <fsring_rw+0x272>
+  8028d6:	83 ec 04             	sub    $0x4,%esp
+  8028d9:	53                   	push   %ebx
+  8028da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028dd:	83 e0 07             	and    $0x7,%eax
+  8028e0:	c1 e0 0c             	shl    $0xc,%eax
+  8028e3:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  8028e9:	50                   	push   %eax
+  8028ea:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8028ed:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8028f0:	01 c8                	add    %ecx,%eax
+  8028f2:	50                   	push   %eax
+  8028f3:	e8 c6 e3 ff ff       	call   800cbe <memmove>
+  8028f8:	83 c4 10             	add    $0x10,%esp
+  8028fb:	eb a8                	jmp    8028a5 <fsring_rw+0x2ae>
+  8028fd:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802901:	75 09                	jne    80290c <fsring_rw+0x315>
+  802903:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802906:	0f 82 db fe ff ff    	jb     8027e7 <fsring_rw+0x1f0>
+  80290c:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80290f:	01 57 04             	add    %edx,0x4(%edi)
+  802912:	85 d2                	test   %edx,%edx
+  802914:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  802918:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80291b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80291e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802921:	5b                   	pop    %ebx
+  802922:	5e                   	pop    %esi
+  802923:	5f                   	pop    %edi
+  802924:	5d                   	pop    %ebp
+  802925:	c3                   	ret
+
+00802926 <devfile_write>:
+  802926:	55                   	push   %ebp
+  802927:	89 e5                	mov    %esp,%ebp
+  802929:	57                   	push   %edi
+  80292a:	56                   	push   %esi
+  80292b:	53                   	push   %ebx
+  80292c:	83 ec 0c             	sub    $0xc,%esp
+  80292f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802932:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802935:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802938:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  80293e:	76 1a                	jbe    80295a <devfile_write+0x34>
+  802940:	83 ec 0c             	sub    $0xc,%esp
+  802943:	53                   	push   %ebx
+  802944:	89 f1                	mov    %esi,%ecx
+  802946:	ba 06 00 00 00       	mov    $0x6,%edx
+  80294b:	89 f8                	mov    %edi,%eax
+  80294d:	e8 a5 fc ff ff       	call   8025f7 <fsring_rw>
+  802952:	83 c4 10             	add    $0x10,%esp
+  802955:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802958:	75 39                	jne    802993 <devfile_write+0x6d>
+  80295a:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  80295f:	39 c3                	cmp    %eax,%ebx
+  802961:	0f 47 d8             	cmova  %eax,%ebx
+  802964:	8b 47 0c             	mov    0xc(%edi),%eax
+  802967:	a3 00 70 80 00       	mov    %eax,0x807000
+  80296c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802972:	83 ec 04             	sub    $0x4,%esp
+  802975:	53                   	push   %ebx
+  802976:	56                   	push   %esi
+  802977:	68 08 70 80 00       	push   $0x807008
+  80297c:	e8 3d e3 ff ff       	call   800cbe <memmove>
+  802981:	ba 00 00 00 00       	mov    $0x0,%edx
+  802986:	b8 04 00 00 00       	mov    $0x4,%eax
+  80298b:	e8 7c fb ff ff       	call   80250c <fsipc>
+  802990:	83 c4 10             	add    $0x10,%esp
+  802993:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802996:	5b                   	pop    %ebx
+  802997:	5e                   	pop    %esi
+  802998:	5f                   	pop    %edi
+  802999:	5d                   	pop    %ebp
+  80299a:	c3                   	ret
+
+0080299b <devfile_read>:
+  80299b:	55                   	push   %ebp
+  80299c:	89 e5                	mov    %esp,%ebp
+  80299e:	57                   	push   %edi
+  80299f:	56                   	push   %esi
+  8029a0:	53                   	push   %ebx
+  8029a1:	83 ec 0c             	sub    $0xc,%esp
+  8029a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029a7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8029aa:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  8029b0:	76 1d                	jbe    8029cf <devfile_read+0x34>
+  8029b2:	83 ec 0c             	sub    $0xc,%esp
+  8029b5:	56                   	push   %esi
+  8029b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029b9:	ba 05 00 00 00       	mov    $0x5,%edx
+  8029be:	89 f8                	mov    %edi,%eax
+  8029c0:	e8 32 fc ff ff       	call   8025f7 <fsring_rw>
+  8029c5:	89 c3                	mov    %eax,%ebx
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8029cd:	75 37                	jne    802a06 <devfile_read+0x6b>
+  8029cf:	8b 47 0c             	mov    0xc(%edi),%eax
+  8029d2:	a3 00 70 80 00       	mov    %eax,0x807000
+  8029d7:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8029dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029e7:	e8 20 fb ff ff       	call   80250c <fsipc>
+  8029ec:	89 c3                	mov    %eax,%ebx
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	78 14                	js     802a06 <devfile_read+0x6b>
+  8029f2:	83 ec 04             	sub    $0x4,%esp
+  8029f5:	50                   	push   %eax
+  8029f6:	68 00 70 80 00       	push   $0x807000
+  8029fb:	ff 75 0c             	push   0xc(%ebp)
+  8029fe:	e8 bb e2 ff ff       	call   800cbe <memmove>
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	89 d8                	mov    %ebx,%eax
+  802a08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a0b:	5b                   	pop    %ebx
+  802a0c:	5e                   	pop    %esi
+  802a0d:	5f                   	pop    %edi
+  802a0e:	5d                   	pop    %ebp
+  802a0f:	c3                   	ret
+
+00802a10 <open>:
+  802a10:	55                   	push   %ebp
+  802a11:	89 e5                	mov    %esp,%ebp
+  802a13:	56                   	push   %esi
+  802a14:	53                   	push   %ebx
+  802a15:	83 ec 1c             	sub    $0x1c,%esp
+  802a18:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a1b:	56                   	push   %esi
+  802a1c:	e8 a1 e0 ff ff       	call   800ac2 <strlen>
+  802a21:	83 c4 10             	add    $0x10,%esp
+  802a24:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a29:	7f 6c                	jg     802a97 <open+0x87>
+  802a2b:	83 ec 0c             	sub    $0xc,%esp
+  802a2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a31:	50                   	push   %eax
+  802a32:	e8 6a f5 ff ff       	call   801fa1 <fd_alloc>
+  802a37:	89 c3                	mov    %eax,%ebx
+  802a39:	83 c4 10             	add    $0x10,%esp
+  802a3c:	85 c0                	test   %eax,%eax
+  802a3e:	78 3c                	js     802a7c <open+0x6c>
+  802a40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a43:	a3 00 74 80 00       	mov    %eax,0x807400
+  802a48:	83 ec 08             	sub    $0x8,%esp
+  802a4b:	56                   	push   %esi
+  802a4c:	68 00 70 80 00       	push   $0x807000
+  802a51:	e8 b8 e0 ff ff       	call   800b0e <strcpy>
+  802a56:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a59:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a5e:	e8 a9 fa ff ff       	call   80250c <fsipc>
+  802a63:	89 c3                	mov    %eax,%ebx
+  802a65:	83 c4 10             	add    $0x10,%esp
+  802a68:	85 c0                	test   %eax,%eax
+  802a6a:	78 19                	js     802a85 <open+0x75>
+  802a6c:	83 ec 0c             	sub    $0xc,%esp
+  802a6f:	ff 75 f4             	push   -0xc(%ebp)
+  802a72:	e8 03 f5 ff ff       	call   801f7a <fd2num>
+  802a77:	89 c3                	mov    %eax,%ebx
+  802a79:	83 c4 10             	add    $0x10,%esp
+  802a7c:	89 d8                	mov    %ebx,%eax
+  802a7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a81:	5b                   	pop    %ebx
+  802a82:	5e                   	pop    %esi
+  802a83:	5d                   	pop    %ebp
+  802a84:	c3                   	ret
+  802a85:	83 ec 08             	sub    $0x8,%esp
+  802a88:	6a 00                	push   $0x0
+  802a8a:	ff 75 f4             	push   -0xc(%ebp)
+  802a8d:	e8 05 f6 ff ff       	call   802097 <fd_close>
+  802a92:	83 c4 10             	add    $0x10,%esp
+  802a95:	eb e5                	jmp    802a7c <open+0x6c>
+  802a97:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a9c:	eb de                	jmp    802a7c <open+0x6c>
+
+00802a9e <file_image>:
+  802a9e:	55                   	push   %ebp
+  802a9f:	89 e5                	mov    %esp,%ebp
+  802aa1:	53                   	push   %ebx
+  802aa2:	83 ec 1c             	sub    $0x1c,%esp
+  802aa5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802aa8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aab:	50                   	push   %eax
+  802aac:	ff 75 08             	push   0x8(%ebp)
+  802aaf:	e8 3d f5 ff ff       	call   801ff1 <fd_lookup>
+  802ab4:	83 c4 10             	add    $0x10,%esp
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	78 58                	js     802b13 <file_image+0x75>
+  802abb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802abe:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802ac4:	39 08                	cmp    %ecx,(%eax)
+  802ac6:	75 50                	jne    802b18 <file_image+0x7a>
+  802ac8:	83 fb 04             	cmp    $0x4,%ebx
+  802acb:	77 52                	ja     802b1f <file_image+0x81>
+  802acd:	8b 40 0c             	mov    0xc(%eax),%eax
+  802ad0:	a3 00 70 80 00       	mov    %eax,0x807000
+  802ad5:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802adb:	83 ec 04             	sub    $0x4,%esp
+  802ade:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ae1:	c1 e0 02             	shl    $0x2,%eax
+  802ae4:	50                   	push   %eax
+  802ae5:	ff 75 0c             	push   0xc(%ebp)
+  802ae8:	68 08 70 80 00       	push   $0x807008
+  802aed:	e8 cc e1 ff ff       	call   800cbe <memmove>
+  802af2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802afc:	e8 0b fa ff ff       	call   80250c <fsipc>
+  802b01:	83 c4 10             	add    $0x10,%esp
+  802b04:	85 c0                	test   %eax,%eax
+  802b06:	78 0b                	js     802b13 <file_image+0x75>
+  802b08:	8b 55 14             	mov    0x14(%ebp),%edx
+  802b0b:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802b11:	89 0a                	mov    %ecx,(%edx)
+  802b13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b16:	c9                   	leave
+  802b17:	c3                   	ret
+  802b18:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b1d:	eb f4                	jmp    802b13 <file_image+0x75>
+  802b1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b24:	eb ed                	jmp    802b13 <file_image+0x75>
+
+00802b26 <remove>:
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	53                   	push   %ebx
+  802b2a:	83 ec 10             	sub    $0x10,%esp
+  802b2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b30:	53                   	push   %ebx
+  802b31:	e8 8c df ff ff       	call   800ac2 <strlen>
+  802b36:	83 c4 10             	add    $0x10,%esp
+  802b39:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b3e:	7f 25                	jg     802b65 <remove+0x3f>
+  802b40:	83 ec 08             	sub    $0x8,%esp
+  802b43:	53                   	push   %ebx
+  802b44:	68 00 70 80 00       	push   $0x807000
+  802b49:	e8 c0 df ff ff       	call   800b0e <strcpy>
+  802b4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b53:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b58:	e8 af f9 ff ff       	call   80250c <fsipc>
+  802b5d:	83 c4 10             	add    $0x10,%esp
+  802b60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b63:	c9                   	leave
+  802b64:	c3                   	ret
+  802b65:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b6a:	eb f4                	jmp    802b60 <remove+0x3a>
+
+00802b6c <sync>:
+  802b6c:	55                   	push   %ebp
+  802b6d:	89 e5                	mov    %esp,%ebp
+  802b6f:	83 ec 08             	sub    $0x8,%esp
+  802b72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b77:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b7c:	e8 8b f9 ff ff       	call   80250c <fsipc>
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+00802b83 <devsock_stat>:
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	83 ec 10             	sub    $0x10,%esp
+  802b89:	68 1c 40 80 00       	push   $0x80401c
+  802b8e:	ff 75 0c             	push   0xc(%ebp)
+  802b91:	e8 78 df ff ff       	call   800b0e <strcpy>
+  802b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+
+00802b9d <devsock_close>:
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	53                   	push   %ebx
+  802ba1:	83 ec 10             	sub    $0x10,%esp
+  802ba4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ba7:	53                   	push   %ebx
+  802ba8:	e8 cf 0b 00 00       	call   80377c <pageref>
+  802bad:	89 c2                	mov    %eax,%edx
+  802baf:	83 c4 10             	add    $0x10,%esp
+  802bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb7:	83 fa 01             	cmp    $0x1,%edx
+  802bba:	74 05                	je     802bc1 <devsock_close+0x24>
+  802bbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bbf:	c9                   	leave
+  802bc0:	c3                   	ret
+  802bc1:	83 ec 0c             	sub    $0xc,%esp
+  802bc4:	ff 73 0c             	push   0xc(%ebx)
+  802bc7:	e8 aa 02 00 00       	call   802e76 <nsipc_close>
+  802bcc:	83 c4 10             	add    $0x10,%esp
+  802bcf:	eb eb                	jmp    802bbc <devsock_close+0x1f>
+
+00802bd1 <devsock_write>:
+  802bd1:	55                   	push   %ebp
+  802bd2:	89 e5                	mov    %esp,%ebp
+  802bd4:	83 ec 08             	sub    $0x8,%esp
+  802bd7:	6a 00                	push   $0x0
+  802bd9:	ff 75 10             	push   0x10(%ebp)
+  802bdc:	ff 75 0c             	push   0xc(%ebp)
+  802bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be2:	ff 70 0c             	push   0xc(%eax)
+  802be5:	e8 6c 03 00 00       	call   802f56 <nsipc_send>
+  802bea:	c9                   	leave
+  802beb:	c3                   	ret
+
+00802bec <devsock_read>:
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	83 ec 08             	sub    $0x8,%esp
+  802bf2:	6a 00                	push   $0x0
+  802bf4:	ff 75 10             	push   0x10(%ebp)
+  802bf7:	ff 75 0c             	push   0xc(%ebp)
+  802bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfd:	ff 70 0c             	push   0xc(%eax)
+  802c00:	e8 e2 02 00 00       	call   802ee7 <nsipc_recv>
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+
+00802c07 <fd2sockid>:
+  802c07:	55                   	push   %ebp
+  802c08:	89 e5                	mov    %esp,%ebp
+  802c0a:	83 ec 20             	sub    $0x20,%esp
+  802c0d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c10:	52                   	push   %edx
+  802c11:	50                   	push   %eax
+  802c12:	e8 da f3 ff ff       	call   801ff1 <fd_lookup>
+  802c17:	83 c4 10             	add    $0x10,%esp
+  802c1a:	85 c0                	test   %eax,%eax
+  802c1c:	78 10                	js     802c2e <fd2sockid+0x27>
+  802c1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c21:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802c27:	39 08                	cmp    %ecx,(%eax)
+  802c29:	75 05                	jne    802c30 <fd2sockid+0x29>
+  802c2b:	8b 40 0c             	mov    0xc(%eax),%eax
+  802c2e:	c9                   	leave
+  802c2f:	c3                   	ret
+  802c30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c35:	eb f7                	jmp    802c2e <fd2sockid+0x27>
+
+00802c37 <alloc_sockfd>:
+  802c37:	55                   	push   %ebp
+  802c38:	89 e5                	mov    %esp,%ebp
+  802c3a:	56                   	push   %esi
+  802c3b:	53                   	push   %ebx
+  802c3c:	83 ec 1c             	sub    $0x1c,%esp
+  802c3f:	89 c6                	mov    %eax,%esi
+  802c41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c44:	50                   	push   %eax
+  802c45:	e8 57 f3 ff ff       	call   801fa1 <fd_alloc>
+  802c4a:	89 c3                	mov    %eax,%ebx
+  802c4c:	83 c4 10             	add    $0x10,%esp
+  802c4f:	85 c0                	test   %eax,%eax
+  802c51:	78 43                	js     802c96 <alloc_sockfd+0x5f>
+  802c53:	83 ec 04             	sub    $0x4,%esp
+  802c56:	68 07 04 00 00       	push   $0x407
+  802c5b:	ff 75 f4             	push   -0xc(%ebp)
+  802c5e:	6a 00                	push   $0x0
+  802c60:	e8 09 e3 ff ff       	call   800f6e <sys_page_alloc>
+  802c65:	89 c3                	mov    %eax,%ebx
+  802c67:	83 c4 10             	add    $0x10,%esp
+  802c6a:	85 c0                	test   %eax,%eax
+  802c6c:	78 28                	js     802c96 <alloc_sockfd+0x5f>
+  802c6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c71:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802c77:	89 10                	mov    %edx,(%eax)
+  802c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c7c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802c83:	89 70 0c             	mov    %esi,0xc(%eax)
+  802c86:	83 ec 0c             	sub    $0xc,%esp
+  802c89:	50                   	push   %eax
+  802c8a:	e8 eb f2 ff ff       	call   801f7a <fd2num>
+  802c8f:	89 c3                	mov    %eax,%ebx
+  802c91:	83 c4 10             	add    $0x10,%esp
+  802c94:	eb 0c                	jmp    802ca2 <alloc_sockfd+0x6b>
+  802c96:	83 ec 0c             	sub    $0xc,%esp
+  802c99:	56                   	push   %esi
+  802c9a:	e8 d7 01 00 00       	call   802e76 <nsipc_close>
+  802c9f:	83 c4 10             	add    $0x10,%esp
+  802ca2:	89 d8                	mov    %ebx,%eax
+  802ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ca7:	5b                   	pop    %ebx
+  802ca8:	5e                   	pop    %esi
+  802ca9:	5d                   	pop    %ebp
+  802caa:	c3                   	ret
+
+00802cab <accept>:
+  802cab:	55                   	push   %ebp
+  802cac:	89 e5                	mov    %esp,%ebp
+  802cae:	83 ec 08             	sub    $0x8,%esp
+  802cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb4:	e8 4e ff ff ff       	call   802c07 <fd2sockid>
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	78 1b                	js     802cd8 <accept+0x2d>
+  802cbd:	83 ec 04             	sub    $0x4,%esp
+  802cc0:	ff 75 10             	push   0x10(%ebp)
+  802cc3:	ff 75 0c             	push   0xc(%ebp)
+  802cc6:	50                   	push   %eax
+  802cc7:	e8 07 01 00 00       	call   802dd3 <nsipc_accept>
+  802ccc:	83 c4 10             	add    $0x10,%esp
+  802ccf:	85 c0                	test   %eax,%eax
+  802cd1:	78 05                	js     802cd8 <accept+0x2d>
+  802cd3:	e8 5f ff ff ff       	call   802c37 <alloc_sockfd>
+  802cd8:	c9                   	leave
+  802cd9:	c3                   	ret
+
+00802cda <bind>:
+  802cda:	55                   	push   %ebp
+  802cdb:	89 e5                	mov    %esp,%ebp
+  802cdd:	83 ec 08             	sub    $0x8,%esp
+  802ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce3:	e8 1f ff ff ff       	call   802c07 <fd2sockid>
+  802ce8:	85 c0                	test   %eax,%eax
+  802cea:	78 12                	js     802cfe <bind+0x24>
+  802cec:	83 ec 04             	sub    $0x4,%esp
+  802cef:	ff 75 10             	push   0x10(%ebp)
+  802cf2:	ff 75 0c             	push   0xc(%ebp)
+  802cf5:	50                   	push   %eax
+  802cf6:	e8 24 01 00 00       	call   802e1f <nsipc_bind>
+  802cfb:	83 c4 10             	add    $0x10,%esp
+  802cfe:	c9                   	leave
+  802cff:	c3                   	ret
+
+00802d00 <shutdown>:
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	83 ec 08             	sub    $0x8,%esp
+  802d06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d09:	e8 f9 fe ff ff       	call   802c07 <fd2sockid>
+  802d0e:	85 c0                	test   %eax,%eax
+  802d10:	78 0f                	js     802d21 <shutdown+0x21>
+  802d12:	83 ec 08             	sub    $0x8,%esp
+  802d15:	ff 75 0c             	push   0xc(%ebp)
+  802d18:	50                   	push   %eax
+  802d19:	e8 36 01 00 00       	call   802e54 <nsipc_shutdown>
+  802d1e:	83 c4 10             	add    $0x10,%esp
+  802d21:	c9                   	leave
+  802d22:	c3                   	ret
+
+00802d23 <connect>:
+  802d23:	55                   	push   %ebp
+  802d24:	89 e5                	mov    %esp,%ebp
+  802d26:	83 ec 08             	sub    $0x8,%esp
+  802d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2c:	e8 d6 fe ff ff       	call   802c07 <fd2sockid>
+  802d31:	85 c0                	test   %eax,%eax
+  802d33:	78 12                	js     802d47 <connect+0x24>
+  802d35:	83 ec 04             	sub    $0x4,%esp
+  802d38:	ff 75 10             	push   0x10(%ebp)
+  802d3b:	ff 75 0c             	push   0xc(%ebp)
+  802d3e:	50                   	push   %eax
+  802d3f:	e8 4c 01 00 00       	call   802e90 <nsipc_connect>
+  802d44:	83 c4 10             	add    $0x10,%esp
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+
+00802d49 <listen>:
+  802d49:	55                   	push   %ebp
+  802d4a:	89 e5                	mov    %esp,%ebp
+  802d4c:	83 ec 08             	sub    $0x8,%esp
+  802d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d52:	e8 b0 fe ff ff       	call   802c07 <fd2sockid>
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	78 0f                	js     802d6a <listen+0x21>
+  802d5b:	83 ec 08             	sub    $0x8,%esp
+  802d5e:	ff 75 0c             	push   0xc(%ebp)
+  802d61:	50                   	push   %eax
+  802d62:	e8 5e 01 00 00       	call   802ec5 <nsipc_listen>
+  802d67:	83 c4 10             	add    $0x10,%esp
+  802d6a:	c9                   	leave
+  802d6b:	c3                   	ret
+
+00802d6c <socket>:
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	83 ec 0c             	sub    $0xc,%esp
+  802d72:	ff 75 10             	push   0x10(%ebp)
+  802d75:	ff 75 0c             	push   0xc(%ebp)
+  802d78:	ff 75 08             	push   0x8(%ebp)
+  802d7b:	e8 34 02 00 00       	call   802fb4 <nsipc_socket>
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	78 05                	js     802d8c <socket+0x20>
+  802d87:	e8 ab fe ff ff       	call   802c37 <alloc_sockfd>
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+00802d8e <nsipc>:
+  802d8e:	55                   	push   %ebp
+  802d8f:	89 e5                	mov    %esp,%ebp
+  802d91:	53                   	push   %ebx
+  802d92:	83 ec 04             	sub    $0x4,%esp
+  802d95:	89 c3                	mov    %eax,%ebx
+  802d97:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  802d9e:	74 1f                	je     802dbf <nsipc+0x31>
+  802da0:	83 ec 08             	sub    $0x8,%esp
+  802da3:	6a 00                	push   $0x0
+  802da5:	6a 00                	push   $0x0
+  802da7:	6a 07                	push   $0x7
+  802da9:	68 00 80 80 00       	push   $0x808000
+  802dae:	53                   	push   %ebx
+  802daf:	ff 35 10 60 80 00    	push   0x806010
+  802db5:	e8 0b f0 ff ff       	call   801dc5 <ipc_call>
+  802dba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dbd:	c9                   	leave
+  802dbe:	c3                   	ret
+  802dbf:	83 ec 0c             	sub    $0xc,%esp
+  802dc2:	6a 03                	push   $0x3
+  802dc4:	e8 97 f1 ff ff       	call   801f60 <ipc_find_env>
+  802dc9:	a3 10 60 80 00       	mov    %eax,0x806010
+  802dce:	83 c4 10             	add    $0x10,%esp
+  802dd1:	eb cd                	jmp    802da0 <nsipc+0x12>
+
+00802dd3 <nsipc_accept>:
+  802dd3:	55                   	push   %ebp
+  802dd4:	89 e5                	mov    %esp,%ebp
+  802dd6:	53                   	push   %ebx
+  802dd7:	83 ec 04             	sub    $0x4,%esp
+  802dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ddd:	a3 00 80 80 00       	mov    %eax,0x808000
+  802de2:	b8 01 00 00 00       	mov    $0x1,%eax
+  802de7:	e8 a2 ff ff ff       	call   802d8e <nsipc>
+  802dec:	89 c3                	mov    %eax,%ebx
+  802dee:	85 c0                	test   %eax,%eax
+  802df0:	79 07                	jns    802df9 <nsipc_accept+0x26>
+  802df2:	89 d8                	mov    %ebx,%eax
+  802df4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df7:	c9                   	leave
+  802df8:	c3                   	ret
+  802df9:	83 ec 04             	sub    $0x4,%esp
+  802dfc:	ff 35 10 80 80 00    	push   0x808010
+  802e02:	68 00 80 80 00       	push   $0x808000
+  802e07:	ff 75 0c             	push   0xc(%ebp)
+  802e0a:	e8 af de ff ff       	call   800cbe <memmove>
+  802e0f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802e15:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e18:	89 10                	mov    %edx,(%eax)
+  802e1a:	83 c4 10             	add    $0x10,%esp
+  802e1d:	eb d3                	jmp    802df2 <nsipc_accept+0x1f>
+
+00802e1f <nsipc_bind>:
+  802e1f:	55                   	push   %ebp
+  802e20:	89 e5                	mov    %esp,%ebp
+  802e22:	53                   	push   %ebx
+  802e23:	83 ec 08             	sub    $0x8,%esp
+  802e26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2c:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e31:	53                   	push   %ebx
+  802e32:	ff 75 0c             	push   0xc(%ebp)
+  802e35:	68 04 80 80 00       	push   $0x808004
+  802e3a:	e8 7f de ff ff       	call   800cbe <memmove>
+  802e3f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802e45:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e4a:	e8 3f ff ff ff       	call   802d8e <nsipc>
+  802e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e52:	c9                   	leave
+  802e53:	c3                   	ret
+
+00802e54 <nsipc_shutdown>:
+  802e54:	55                   	push   %ebp
+  802e55:	89 e5                	mov    %esp,%ebp
+  802e57:	83 ec 08             	sub    $0x8,%esp
+  802e5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5d:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e65:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e6a:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e6f:	e8 1a ff ff ff       	call   802d8e <nsipc>
+  802e74:	c9                   	leave
+  802e75:	c3                   	ret
+
+00802e76 <nsipc_close>:
+  802e76:	55                   	push   %ebp
+  802e77:	89 e5                	mov    %esp,%ebp
+  802e79:	83 ec 08             	sub    $0x8,%esp
+  802e7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e7f:	a3 00 80 80 00       	mov    %eax,0x808000
+  802e84:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e89:	e8 00 ff ff ff       	call   802d8e <nsipc>
+  802e8e:	c9                   	leave
+  802e8f:	c3                   	ret
+
+00802e90 <nsipc_connect>:
+  802e90:	55                   	push   %ebp
+  802e91:	89 e5                	mov    %esp,%ebp
+  802e93:	53                   	push   %ebx
+  802e94:	83 ec 08             	sub    $0x8,%esp
+  802e97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9d:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ea2:	53                   	push   %ebx
+  802ea3:	ff 75 0c             	push   0xc(%ebp)
+  802ea6:	68 04 80 80 00       	push   $0x808004
+  802eab:	e8 0e de ff ff       	call   800cbe <memmove>
+  802eb0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802eb6:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ebb:	e8 ce fe ff ff       	call   802d8e <nsipc>
+  802ec0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ec3:	c9                   	leave
+  802ec4:	c3                   	ret
+
+00802ec5 <nsipc_listen>:
+  802ec5:	55                   	push   %ebp
+  802ec6:	89 e5                	mov    %esp,%ebp
+  802ec8:	83 ec 08             	sub    $0x8,%esp
+  802ecb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ece:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ed3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ed6:	a3 04 80 80 00       	mov    %eax,0x808004
+  802edb:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ee0:	e8 a9 fe ff ff       	call   802d8e <nsipc>
+  802ee5:	c9                   	leave
+  802ee6:	c3                   	ret
+
+00802ee7 <nsipc_recv>:
+  802ee7:	55                   	push   %ebp
+  802ee8:	89 e5                	mov    %esp,%ebp
+  802eea:	56                   	push   %esi
+  802eeb:	53                   	push   %ebx
+  802eec:	8b 75 10             	mov    0x10(%ebp),%esi
+  802eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef2:	a3 00 80 80 00       	mov    %eax,0x808000
+  802ef7:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802efd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f00:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f05:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f0a:	e8 7f fe ff ff       	call   802d8e <nsipc>
+  802f0f:	89 c3                	mov    %eax,%ebx
+  802f11:	85 c0                	test   %eax,%eax
+  802f13:	78 22                	js     802f37 <nsipc_recv+0x50>
+  802f15:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802f1a:	39 c6                	cmp    %eax,%esi
+  802f1c:	0f 4e c6             	cmovle %esi,%eax
+  802f1f:	39 c3                	cmp    %eax,%ebx
+  802f21:	7f 1d                	jg     802f40 <nsipc_recv+0x59>
+  802f23:	83 ec 04             	sub    $0x4,%esp
+  802f26:	53                   	push   %ebx
+  802f27:	68 00 80 80 00       	push   $0x808000
+  802f2c:	ff 75 0c             	push   0xc(%ebp)
+  802f2f:	e8 8a dd ff ff       	call   800cbe <memmove>
+  802f34:	83 c4 10             	add    $0x10,%esp
+  802f37:	89 d8                	mov    %ebx,%eax
+  802f39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f3c:	5b                   	pop    %ebx
+  802f3d:	5e                   	pop    %esi
+  802f3e:	5d                   	pop    %ebp
+  802f3f:	c3                   	ret
+  802f40:	68 28 40 80 00       	push   $0x804028
+  802f45:	68 3d 40 80 00       	push   $0x80403d
+  802f4a:	6a 60                	push   $0x60
+  802f4c:	68 52 40 80 00       	push   $0x804052
+  802f51:	e8 e6 d3 ff ff       	call   80033c <_panic>
+
+00802f56 <nsipc_send>:
+  802f56:	55                   	push   %ebp
+  802f57:	89 e5                	mov    %esp,%ebp
+  802f59:	53                   	push   %ebx
+  802f5a:	83 ec 04             	sub    $0x4,%esp
+  802f5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f63:	a3 00 80 80 00       	mov    %eax,0x808000
+  802f68:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f6e:	7f 2e                	jg     802f9e <nsipc_send+0x48>
+  802f70:	83 ec 04             	sub    $0x4,%esp
+  802f73:	53                   	push   %ebx
+  802f74:	ff 75 0c             	push   0xc(%ebp)
+  802f77:	68 0c 80 80 00       	push   $0x80800c
+  802f7c:	e8 3d dd ff ff       	call   800cbe <memmove>
+  802f81:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802f87:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f8a:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f8f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f94:	e8 f5 fd ff ff       	call   802d8e <nsipc>
+  802f99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f9c:	c9                   	leave
+  802f9d:	c3                   	ret
+  802f9e:	68 5e 40 80 00       	push   $0x80405e
+  802fa3:	68 3d 40 80 00       	push   $0x80403d
+  802fa8:	6a 6b                	push   $0x6b
+  802faa:	68 52 40 80 00       	push   $0x804052
+  802faf:	e8 88 d3 ff ff       	call   80033c <_panic>
+
+00802fb4 <nsipc_socket>:
+  802fb4:	55                   	push   %ebp
+  802fb5:	89 e5                	mov    %esp,%ebp
+  802fb7:	83 ec 08             	sub    $0x8,%esp
+  802fba:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fbd:	a3 00 80 80 00       	mov    %eax,0x808000
+  802fc2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fc5:	a3 04 80 80 00       	mov    %eax,0x808004
+  802fca:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fcd:	a3 08 80 80 00       	mov    %eax,0x808008
+  802fd2:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fd7:	e8 b2 fd ff ff       	call   802d8e <nsipc>
+  802fdc:	c9                   	leave
+  802fdd:	c3                   	ret
+
+00802fde <devpipe_stat>:
+  802fde:	55                   	push   %ebp
+  802fdf:	89 e5                	mov    %esp,%ebp
+  802fe1:	56                   	push   %esi
+  802fe2:	53                   	push   %ebx
+  802fe3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802fe6:	83 ec 0c             	sub    $0xc,%esp
+  802fe9:	ff 75 08             	push   0x8(%ebp)
+  802fec:	e8 99 ef ff ff       	call   801f8a <fd2data>
+  802ff1:	89 c6                	mov    %eax,%esi
+  802ff3:	83 c4 08             	add    $0x8,%esp
+  802ff6:	68 6a 40 80 00       	push   $0x80406a
+  802ffb:	53                   	push   %ebx
+  802ffc:	e8 0d db ff ff       	call   800b0e <strcpy>
+  803001:	8b 46 04             	mov    0x4(%esi),%eax
+  803004:	2b 06                	sub    (%esi),%eax
+  803006:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80300c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803013:	00 00 00 
+  803016:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  80301d:	50 80 00 
+  803020:	b8 00 00 00 00       	mov    $0x0,%eax
+  803025:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803028:	5b                   	pop    %ebx
+  803029:	5e                   	pop    %esi
+  80302a:	5d                   	pop    %ebp
+  80302b:	c3                   	ret
+
+0080302c <devpipe_close>:
+  80302c:	55                   	push   %ebp
+  80302d:	89 e5                	mov    %esp,%ebp
+  80302f:	53                   	push   %ebx
+  803030:	83 ec 0c             	sub    $0xc,%esp
+  803033:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803036:	53                   	push   %ebx
+  803037:	6a 00                	push   $0x0
+  803039:	e8 02 e0 ff ff       	call   801040 <sys_page_unmap>
+  80303e:	89 1c 24             	mov    %ebx,(%esp)
+  803041:	e8 44 ef ff ff       	call   801f8a <fd2data>
+  803046:	83 c4 08             	add    $0x8,%esp
+  803049:	50                   	push   %eax
+  80304a:	6a 00                	push   $0x0
+  80304c:	e8 ef df ff ff       	call   801040 <sys_page_unmap>
+  803051:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803054:	c9                   	leave
+  803055:	c3                   	ret
+
+00803056 <_pipeisclosed>:
+  803056:	55                   	push   %ebp
+  803057:	89 e5                	mov    %esp,%ebp
+  803059:	57                   	push   %edi
+  80305a:	56                   	push   %esi
+  80305b:	53                   	push   %ebx
+  80305c:	83 ec 1c             	sub    $0x1c,%esp
+  80305f:	89 c7                	mov    %eax,%edi
+  803061:	89 d6                	mov    %edx,%esi
+  803063:	a1 14 60 80 00       	mov    0x806014,%eax
+  803068:	8b 58 58             	mov    0x58(%eax),%ebx
+  80306b:	83 ec 0c             	sub    $0xc,%esp
+  80306e:	57                   	push   %edi
+  80306f:	e8 08 07 00 00       	call   80377c <pageref>
+  803074:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803077:	89 34 24             	mov    %esi,(%esp)
+  80307a:	e8 fd 06 00 00       	call   80377c <pageref>
+  80307f:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  803085:	8b 4a 58             	mov    0x58(%edx),%ecx
+  803088:	83 c4 10             	add    $0x10,%esp
+  80308b:	39 cb                	cmp    %ecx,%ebx
+  80308d:	74 1b                	je     8030aa <_pipeisclosed+0x54>
+  80308f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803092:	75 cf                	jne    803063 <_pipeisclosed+0xd>
+  803094:	8b 42 58             	mov    0x58(%edx),%eax
+  803097:	6a 01                	push   $0x1
+  803099:	50                   	push   %eax
+  80309a:	53                   	push   %ebx
+  80309b:	68 71 40 80 00       	push   $0x804071
+  8030a0:	e8 72 d3 ff ff       	call   800417 <cprintf>
+  8030a5:	83 c4 10             	add    $0x10,%esp
+  8030a8:	eb b9                	jmp    803063 <_pipeisclosed+0xd>
+  8030aa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030ad:	0f 94 c0             	sete   %al
+  8030b0:	0f b6 c0             	movzbl %al,%eax
+  8030b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b6:	5b                   	pop    %ebx
+  8030b7:	5e                   	pop    %esi
+  8030b8:	5f                   	pop    %edi
+  8030b9:	5d                   	pop    %ebp
+  8030ba:	c3                   	ret
+
+008030bb <devpipe_write>:
+  8030bb:	55                   	push   %ebp
+  8030bc:	89 e5                	mov    %esp,%ebp
+  8030be:	57                   	push   %edi
+  8030bf:	56                   	push   %esi
+  8030c0:	53                   	push   %ebx
+  8030c1:	83 ec 28             	sub    $0x28,%esp
+  8030c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8030c7:	56                   	push   %esi
+  8030c8:	e8 bd ee ff ff       	call   801f8a <fd2data>
+  8030cd:	89 c3                	mov    %eax,%ebx
+  8030cf:	83 c4 10             	add    $0x10,%esp
+  8030d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030db:	74 5c                	je     803139 <devpipe_write+0x7e>
+  8030dd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030e0:	8b 0b                	mov    (%ebx),%ecx
+  8030e2:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030e5:	39 d0                	cmp    %edx,%eax
+  8030e7:	72 1e                	jb     803107 <devpipe_write+0x4c>
+  8030e9:	89 da                	mov    %ebx,%edx
+  8030eb:	89 f0                	mov    %esi,%eax
+  8030ed:	e8 64 ff ff ff       	call   803056 <_pipeisclosed>
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	75 48                	jne    80313e <devpipe_write+0x83>
+  8030f6:	e8 28 de ff ff       	call   800f23 <sys_yield>
+  8030fb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030fe:	8b 0b                	mov    (%ebx),%ecx
+  803100:	8d 51 20             	lea    0x20(%ecx),%edx
+  803103:	39 d0                	cmp    %edx,%eax
+  803105:	73 e2                	jae    8030e9 <devpipe_write+0x2e>
+  803107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80310a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80310e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803111:	89 c2                	mov    %eax,%edx
+  803113:	c1 fa 1f             	sar    $0x1f,%edx
+  803116:	89 d1                	mov    %edx,%ecx
+  803118:	c1 e9 1b             	shr    $0x1b,%ecx
+  80311b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80311e:	83 e2 1f             	and    $0x1f,%edx
+  803121:	29 ca                	sub    %ecx,%edx
+  803123:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803127:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80312b:	83 c0 01             	add    $0x1,%eax
+  80312e:	89 43 04             	mov    %eax,0x4(%ebx)
+  803131:	83 c7 01             	add    $0x1,%edi
+  803134:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803137:	75 a4                	jne    8030dd <devpipe_write+0x22>
+  803139:	8b 45 10             	mov    0x10(%ebp),%eax
+  80313c:	eb 05                	jmp    803143 <devpipe_write+0x88>
+  80313e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803143:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803146:	5b                   	pop    %ebx
+  803147:	5e                   	pop    %esi
+  803148:	5f                   	pop    %edi
+  803149:	5d                   	pop    %ebp
+  80314a:	c3                   	ret
+
+0080314b <devpipe_read>:
+  80314b:	55                   	push   %ebp
+  80314c:	89 e5                	mov    %esp,%ebp
+  80314e:	57                   	push   %edi
+  80314f:	56                   	push   %esi
+  803150:	53                   	push   %ebx
+  803151:	83 ec 18             	sub    $0x18,%esp
+  803154:	8b 75 08             	mov    0x8(%ebp),%esi
+  803157:	56                   	push   %esi
+  803158:	e8 2d ee ff ff       	call   801f8a <fd2data>
+  80315d:	89 c3                	mov    %eax,%ebx
+  80315f:	83 c4 10             	add    $0x10,%esp
+  803162:	bf 00 00 00 00       	mov    $0x0,%edi
+  803167:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80316b:	74 45                	je     8031b2 <devpipe_read+0x67>
+  80316d:	8b 03                	mov    (%ebx),%eax
+  80316f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803172:	75 1d                	jne    803191 <devpipe_read+0x46>
+  803174:	85 ff                	test   %edi,%edi
+  803176:	75 3f                	jne    8031b7 <devpipe_read+0x6c>
+  803178:	89 da                	mov    %ebx,%edx
+  80317a:	89 f0                	mov    %esi,%eax
+  80317c:	e8 d5 fe ff ff       	call   803056 <_pipeisclosed>
+  803181:	85 c0                	test   %eax,%eax
+  803183:	75 3c                	jne    8031c1 <devpipe_read+0x76>
+  803185:	e8 99 dd ff ff       	call   800f23 <sys_yield>
+  80318a:	8b 03                	mov    (%ebx),%eax
+  80318c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80318f:	74 e7                	je     803178 <devpipe_read+0x2d>
+  803191:	99                   	cltd
+  803192:	c1 ea 1b             	shr    $0x1b,%edx
+  803195:	01 d0                	add    %edx,%eax
+  803197:	83 e0 1f             	and    $0x1f,%eax
+  80319a:	29 d0                	sub    %edx,%eax
+  80319c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8031a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031a4:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  8031a7:	83 03 01             	addl   $0x1,(%ebx)
+  8031aa:	83 c7 01             	add    $0x1,%edi
+  8031ad:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8031b0:	75 bb                	jne    80316d <devpipe_read+0x22>
+  8031b2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031b5:	eb 02                	jmp    8031b9 <devpipe_read+0x6e>
+  8031b7:	89 f8                	mov    %edi,%eax
+  8031b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031bc:	5b                   	pop    %ebx
+  8031bd:	5e                   	pop    %esi
+  8031be:	5f                   	pop    %edi
+  8031bf:	5d                   	pop    %ebp
+  8031c0:	c3                   	ret
+  8031c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c6:	eb f1                	jmp    8031b9 <devpipe_read+0x6e>
+
+008031c8 <pipe>:
+  8031c8:	55                   	push   %ebp
+  8031c9:	89 e5                	mov    %esp,%ebp
+  8031cb:	56                   	push   %esi
+  8031cc:	53                   	push   %ebx
+  8031cd:	83 ec 1c             	sub    $0x1c,%esp
+  8031d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031d3:	50                   	push   %eax
+  8031d4:	e8 c8 ed ff ff       	call   801fa1 <fd_alloc>
+  8031d9:	89 c3                	mov    %eax,%ebx
+  8031db:	83 c4 10             	add    $0x10,%esp
+  8031de:	85 c0                	test   %eax,%eax
+  8031e0:	0f 88 23 01 00 00    	js     803309 <pipe+0x141>
+  8031e6:	83 ec 04             	sub    $0x4,%esp
+  8031e9:	68 07 04 00 00       	push   $0x407
+  8031ee:	ff 75 f4             	push   -0xc(%ebp)
+  8031f1:	6a 00                	push   $0x0
+  8031f3:	e8 76 dd ff ff       	call   800f6e <sys_page_alloc>
+  8031f8:	89 c3                	mov    %eax,%ebx
+  8031fa:	83 c4 10             	add    $0x10,%esp
+  8031fd:	85 c0                	test   %eax,%eax
+  8031ff:	0f 88 04 01 00 00    	js     803309 <pipe+0x141>
+  803205:	83 ec 0c             	sub    $0xc,%esp
+  803208:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80320b:	50                   	push   %eax
+  80320c:	e8 90 ed ff ff       	call   801fa1 <fd_alloc>
+  803211:	89 c3                	mov    %eax,%ebx
+  803213:	83 c4 10             	add    $0x10,%esp
+  803216:	85 c0                	test   %eax,%eax
+  803218:	0f 88 db 00 00 00    	js     8032f9 <pipe+0x131>
+  80321e:	83 ec 04             	sub    $0x4,%esp
+  803221:	68 07 04 00 00       	push   $0x407
+  803226:	ff 75 f0             	push   -0x10(%ebp)
+  803229:	6a 00                	push   $0x0
+  80322b:	e8 3e dd ff ff       	call   800f6e <sys_page_alloc>
+  803230:	89 c3                	mov    %eax,%ebx
+  803232:	83 c4 10             	add    $0x10,%esp
+  803235:	85 c0                	test   %eax,%eax
+  803237:	0f 88 bc 00 00 00    	js     8032f9 <pipe+0x131>
+  80323d:	83 ec 0c             	sub    $0xc,%esp
+  803240:	ff 75 f4             	push   -0xc(%ebp)
+  803243:	e8 42 ed ff ff       	call   801f8a <fd2data>
+  803248:	89 c6                	mov    %eax,%esi
+  80324a:	83 c4 0c             	add    $0xc,%esp
+  80324d:	68 07 04 00 00       	push   $0x407
+  803252:	50                   	push   %eax
+  803253:	6a 00                	push   $0x0
+  803255:	e8 14 dd ff ff       	call   800f6e <sys_page_alloc>
+  80325a:	89 c3                	mov    %eax,%ebx
+  80325c:	83 c4 10             	add    $0x10,%esp
+  80325f:	85 c0                	test   %eax,%eax
+  803261:	0f 88 82 00 00 00    	js     8032e9 <pipe+0x121>
+  803267:	83 ec 0c             	sub    $0xc,%esp
+  80326a:	ff 75 f0             	push   -0x10(%ebp)
+  80326d:	e8 18 ed ff ff       	call   801f8a <fd2data>
+  803272:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803279:	50                   	push   %eax
+  80327a:	6a 00                	push   $0x0
+  80327c:	56                   	push   %esi
+  80327d:	6a 00                	push   $0x0
+  80327f:	e8 2d dd ff ff       	call   800fb1 <sys_page_map>
+  803284:	89 c3                	mov    %eax,%ebx
+  803286:	83 c4 20             	add    $0x20,%esp
+  803289:	85 c0                	test   %eax,%eax
+  80328b:	78 4e                	js     8032db <pipe+0x113>
+  80328d:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  803292:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803295:	89 02                	mov    %eax,(%edx)
+  803297:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80329a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  8032a1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032a4:	89 02                	mov    %eax,(%edx)
+  8032a6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032a9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8032b0:	83 ec 0c             	sub    $0xc,%esp
+  8032b3:	ff 75 f4             	push   -0xc(%ebp)
+  8032b6:	e8 bf ec ff ff       	call   801f7a <fd2num>
+  8032bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032be:	89 01                	mov    %eax,(%ecx)
+  8032c0:	83 c4 04             	add    $0x4,%esp
+  8032c3:	ff 75 f0             	push   -0x10(%ebp)
+  8032c6:	e8 af ec ff ff       	call   801f7a <fd2num>
+  8032cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032ce:	89 41 04             	mov    %eax,0x4(%ecx)
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032d9:	eb 2e                	jmp    803309 <pipe+0x141>
+  8032db:	83 ec 08             	sub    $0x8,%esp
+  8032de:	56                   	push   %esi
+  8032df:	6a 00                	push   $0x0
+  8032e1:	e8 5a dd ff ff       	call   801040 <sys_page_unmap>
+  8032e6:	83 c4 10             	add    $0x10,%esp
+  8032e9:	83 ec 08             	sub    $0x8,%esp
+  8032ec:	ff 75 f0             	push   -0x10(%ebp)
+  8032ef:	6a 00                	push   $0x0
+  8032f1:	e8 4a dd ff ff       	call   801040 <sys_page_unmap>
+  8032f6:	83 c4 10             	add    $0x10,%esp
+  8032f9:	83 ec 08             	sub    $0x8,%esp
+  8032fc:	ff 75 f4             	push   -0xc(%ebp)
+  8032ff:	6a 00                	push   $0x0
+  803301:	e8 3a dd ff ff       	call   801040 <sys_page_unmap>
+  803306:	83 c4 10             	add    $0x10,%esp
+  803309:	89 d8                	mov    %ebx,%eax
+  80330b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80330e:	5b                   	pop    %ebx
+  80330f:	5e                   	pop    %esi
+  803310:	5d                   	pop    %ebp
+  803311:	c3                   	ret
+
+00803312 <pipeisclosed>:
+  803312:	55                   	push   %ebp
+  803313:	89 e5                	mov    %esp,%ebp
+  803315:	83 ec 20             	sub    $0x20,%esp
+  803318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80331b:	50                   	push   %eax
+  80331c:	ff 75 08             	push   0x8(%ebp)
+  80331f:	e8 cd ec ff ff       	call   801ff1 <fd_lookup>
+  803324:	83 c4 10             	add    $0x10,%esp
+  803327:	85 c0                	test   %eax,%eax
+  803329:	78 18                	js     803343 <pipeisclosed+0x31>
+  80332b:	83 ec 0c             	sub    $0xc,%esp
+  80332e:	ff 75 f4             	push   -0xc(%ebp)
+  803331:	e8 54 ec ff ff       	call   801f8a <fd2data>
+  803336:	89 c2                	mov    %eax,%edx
+  803338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80333b:	e8 16 fd ff ff       	call   803056 <_pipeisclosed>
+  803340:	83 c4 10             	add    $0x10,%esp
+  803343:	c9                   	leave
+  803344:	c3                   	ret
+
+00803345 <ipcring_init>:
+  803345:	55                   	push   %ebp
+  803346:	89 e5                	mov    %esp,%ebp
+  803348:	53                   	push   %ebx
+  803349:	83 ec 08             	sub    $0x8,%esp
+  80334c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80334f:	6a 60                	push   $0x60
+  803351:	6a 00                	push   $0x0
+  803353:	53                   	push   %ebx
+  803354:	e8 30 d9 ff ff       	call   800c89 <memset>
+  803359:	a1 14 60 80 00       	mov    0x806014,%eax
+  80335e:	8b 40 48             	mov    0x48(%eax),%eax
+  803361:	89 03                	mov    %eax,(%ebx)
+  803363:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803366:	89 43 04             	mov    %eax,0x4(%ebx)
+  803369:	8b 45 10             	mov    0x10(%ebp),%eax
+  80336c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80336f:	8b 45 14             	mov    0x14(%ebp),%eax
+  803372:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803375:	83 c4 10             	add    $0x10,%esp
+  803378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80337b:	c9                   	leave
+  80337c:	c3                   	ret
+
+0080337d <ipcring_req_slot>:
+  80337d:	55                   	push   %ebp
+  80337e:	89 e5                	mov    %esp,%ebp
+  803380:	8b 45 08             	mov    0x8(%ebp),%eax
+  803383:	8b 50 10             	mov    0x10(%eax),%edx
+  803386:	8b 48 18             	mov    0x18(%eax),%ecx
+  803389:	29 ca                	sub    %ecx,%edx
+  80338b:	83 fa 07             	cmp    $0x7,%edx
+  80338e:	77 0c                	ja     80339c <ipcring_req_slot+0x1f>
+  803390:	8b 50 10             	mov    0x10(%eax),%edx
+  803393:	83 e2 07             	and    $0x7,%edx
+  803396:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80339a:	5d                   	pop    %ebp
+  80339b:	c3                   	ret
+  80339c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a1:	eb f7                	jmp    80339a <ipcring_req_slot+0x1d>
+
+008033a3 <ipcring_req_push>:
+  8033a3:	55                   	push   %ebp
+  8033a4:	89 e5                	mov    %esp,%ebp
+  8033a6:	83 ec 08             	sub    $0x8,%esp
+  8033a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033ac:	8b 42 10             	mov    0x10(%edx),%eax
+  8033af:	83 c0 01             	add    $0x1,%eax
+  8033b2:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8033b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033bb:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8033bf:	85 c0                	test   %eax,%eax
+  8033c1:	75 02                	jne    8033c5 <ipcring_req_push+0x22>
+  8033c3:	c9                   	leave
+  8033c4:	c3                   	ret
+  8033c5:	6a 00                	push   $0x0
+  8033c7:	68 00 00 80 ee       	push   $0xee800000
+  8033cc:	ff 72 08             	push   0x8(%edx)
+  8033cf:	ff 72 04             	push   0x4(%edx)
+  8033d2:	e8 cf de ff ff       	call   8012a6 <sys_ipc_send>
+  8033d7:	83 c4 10             	add    $0x10,%esp
+  8033da:	eb e7                	jmp    8033c3 <ipcring_req_push+0x20>
+
+008033dc <ipcring_rsp_wait>:
+  8033dc:	55                   	push   %ebp
+  8033dd:	89 e5                	mov    %esp,%ebp
+  8033df:	53                   	push   %ebx
+  8033e0:	83 ec 04             	sub    $0x4,%esp
+  8033e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8033e6:	8b 53 18             	mov    0x18(%ebx),%edx
+  8033e9:	8b 43 10             	mov    0x10(%ebx),%eax
+  8033ec:	39 c2                	cmp    %eax,%edx
+  8033ee:	74 3c                	je     80342c <ipcring_rsp_wait+0x50>
+  8033f0:	8b 53 14             	mov    0x14(%ebx),%edx
+  8033f3:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033f6:	39 c2                	cmp    %eax,%edx
+  8033f8:	75 23                	jne    80341d <ipcring_rsp_wait+0x41>
+  8033fa:	83 ec 08             	sub    $0x8,%esp
+  8033fd:	6a 00                	push   $0x0
+  8033ff:	6a 00                	push   $0x0
+  803401:	6a 00                	push   $0x0
+  803403:	6a 00                	push   $0x0
+  803405:	ff 73 0c             	push   0xc(%ebx)
+  803408:	ff 73 04             	push   0x4(%ebx)
+  80340b:	e8 b5 e9 ff ff       	call   801dc5 <ipc_call>
+  803410:	8b 53 14             	mov    0x14(%ebx),%edx
+  803413:	8b 43 18             	mov    0x18(%ebx),%eax
+  803416:	83 c4 20             	add    $0x20,%esp
+  803419:	39 c2                	cmp    %eax,%edx
+  80341b:	74 dd                	je     8033fa <ipcring_rsp_wait+0x1e>
+  80341d:	8b 43 18             	mov    0x18(%ebx),%eax
+  803420:	83 e0 07             	and    $0x7,%eax
+  803423:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803427:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80342a:	c9                   	leave
+  80342b:	c3                   	ret
+  80342c:	68 8c 40 80 00       	push   $0x80408c
+  803431:	68 3d 40 80 00       	push   $0x80403d
+  803436:	6a 3b                	push   $0x3b
+  803438:	68 ad 40 80 00       	push   $0x8040ad
+  80343d:	e8 fa ce ff ff       	call   80033c <_panic>
+
+00803442 <ipcring_rsp_pop>:
+  803442:	55                   	push   %ebp
+  803443:	89 e5                	mov    %esp,%ebp
+  803445:	8b 55 08             	mov    0x8(%ebp),%edx
+  803448:	8b 42 18             	mov    0x18(%edx),%eax
+  80344b:	83 c0 01             	add    $0x1,%eax
+  80344e:	89 42 18             	mov    %eax,0x18(%edx)
+  803451:	5d                   	pop    %ebp
+  803452:	c3                   	ret
+
+00803453 <ipcring_server_init>:
+  803453:	55                   	push   %ebp
+  803454:	89 e5                	mov    %esp,%ebp
+  803456:	8b 45 08             	mov    0x8(%ebp),%eax
+  803459:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80345c:	89 10                	mov    %edx,(%eax)
+  80345e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803461:	89 50 04             	mov    %edx,0x4(%eax)
+  803464:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  80346b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803472:	5d                   	pop    %ebp
+  803473:	c3                   	ret
+
+00803474 <ipcring_req_avail>:
+  803474:	55                   	push   %ebp
+  803475:	89 e5                	mov    %esp,%ebp
+  803477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80347a:	8b 02                	mov    (%edx),%eax
+  80347c:	8b 40 10             	mov    0x10(%eax),%eax
+  80347f:	2b 42 08             	sub    0x8(%edx),%eax
+  803482:	ba 08 00 00 00       	mov    $0x8,%edx
+  803487:	39 d0                	cmp    %edx,%eax
+  803489:	0f 47 c2             	cmova  %edx,%eax
+  80348c:	5d                   	pop    %ebp
+  80348d:	c3                   	ret
+
+0080348e <ipcring_req_peek>:
+  80348e:	55                   	push   %ebp
+  80348f:	89 e5                	mov    %esp,%ebp
+  803491:	8b 55 08             	mov    0x8(%ebp),%edx
+  803494:	8b 42 08             	mov    0x8(%edx),%eax
+  803497:	83 e0 07             	and    $0x7,%eax
+  80349a:	8b 12                	mov    (%edx),%edx
+  80349c:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  8034a0:	5d                   	pop    %ebp
+  8034a1:	c3                   	ret
+
+008034a2 <ipcring_rsp_push>:
+  8034a2:	55                   	push   %ebp
+  8034a3:	89 e5                	mov    %esp,%ebp
+  8034a5:	83 ec 08             	sub    $0x8,%esp
+  8034a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8034ab:	8b 41 08             	mov    0x8(%ecx),%eax
+  8034ae:	83 c0 01             	add    $0x1,%eax
+  8034b1:	89 41 08             	mov    %eax,0x8(%ecx)
+  8034b4:	8b 11                	mov    (%ecx),%edx
+  8034b6:	83 c2 14             	add    $0x14,%edx
+  8034b9:	f0 87 02             	lock xchg %eax,(%edx)
+  8034bc:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  8034c0:	75 02                	jne    8034c4 <ipcring_rsp_push+0x22>
+  8034c2:	c9                   	leave
+  8034c3:	c3                   	ret
+  8034c4:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  8034cb:	6a 00                	push   $0x0
+  8034cd:	68 00 00 80 ee       	push   $0xee800000
+  8034d2:	6a 00                	push   $0x0
+  8034d4:	ff 71 04             	push   0x4(%ecx)
+  8034d7:	e8 ed dc ff ff       	call   8011c9 <sys_ipc_try_send>
+  8034dc:	83 c4 10             	add    $0x10,%esp
+  8034df:	eb e1                	jmp    8034c2 <ipcring_rsp_push+0x20>
+
+008034e1 <ipcring_client_wait>:
+  8034e1:	55                   	push   %ebp
+  8034e2:	89 e5                	mov    %esp,%ebp
+  8034e4:	83 ec 08             	sub    $0x8,%esp
+  8034e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ea:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  8034f1:	8b 10                	mov    (%eax),%edx
+  8034f3:	8b 52 18             	mov    0x18(%edx),%edx
+  8034f6:	3b 50 08             	cmp    0x8(%eax),%edx
+  8034f9:	75 02                	jne    8034fd <ipcring_client_wait+0x1c>
+  8034fb:	c9                   	leave
+  8034fc:	c3                   	ret
+  8034fd:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803504:	6a 00                	push   $0x0
+  803506:	68 00 00 80 ee       	push   $0xee800000
+  80350b:	6a 00                	push   $0x0
+  80350d:	ff 70 04             	push   0x4(%eax)
+  803510:	e8 b4 dc ff ff       	call   8011c9 <sys_ipc_try_send>
+  803515:	83 c4 10             	add    $0x10,%esp
+  803518:	eb e1                	jmp    8034fb <ipcring_client_wait+0x1a>
+
+0080351a <ipcring_server_sleep>:
+  80351a:	55                   	push   %ebp
+  80351b:	89 e5                	mov    %esp,%ebp
+  80351d:	53                   	push   %ebx
+  80351e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803521:	8b 01                	mov    (%ecx),%eax
+  803523:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803526:	b8 01 00 00 00       	mov    $0x1,%eax
+  80352b:	f0 87 02             	lock xchg %eax,(%edx)
+  80352e:	8b 11                	mov    (%ecx),%edx
+  803530:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803533:	b8 01 00 00 00       	mov    $0x1,%eax
+  803538:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  80353b:	74 0e                	je     80354b <ipcring_server_sleep+0x31>
+  80353d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803542:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80354e:	c9                   	leave
+  80354f:	c3                   	ret
+
+00803550 <devcons_close>:
+  803550:	b8 00 00 00 00       	mov    $0x0,%eax
+  803555:	c3                   	ret
+
+00803556 <devcons_stat>:
+  803556:	55                   	push   %ebp
+  803557:	89 e5                	mov    %esp,%ebp
+  803559:	83 ec 10             	sub    $0x10,%esp
+  80355c:	68 bb 40 80 00       	push   $0x8040bb
+  803561:	ff 75 0c             	push   0xc(%ebp)
+  803564:	e8 a5 d5 ff ff       	call   800b0e <strcpy>
+  803569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356e:	c9                   	leave
+  80356f:	c3                   	ret
+
+00803570 <devcons_write>:
+  803570:	55                   	push   %ebp
+  803571:	89 e5                	mov    %esp,%ebp
+  803573:	57                   	push   %edi
+  803574:	56                   	push   %esi
+  803575:	53                   	push   %ebx
+  803576:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80357c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80357f:	85 ff                	test   %edi,%edi
+  803581:	74 51                	je     8035d4 <devcons_write+0x64>
+  803583:	be 00 00 00 00       	mov    $0x0,%esi
+  803588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358d:	89 fb                	mov    %edi,%ebx
+  80358f:	29 c3                	sub    %eax,%ebx
+  803591:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803596:	39 d3                	cmp    %edx,%ebx
+  803598:	0f 47 da             	cmova  %edx,%ebx
+  80359b:	83 ec 04             	sub    $0x4,%esp
+  80359e:	53                   	push   %ebx
+  80359f:	03 45 0c             	add    0xc(%ebp),%eax
+  8035a2:	50                   	push   %eax
+  8035a3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035a9:	50                   	push   %eax
+  8035aa:	e8 0f d7 ff ff       	call   800cbe <memmove>
+  8035af:	83 c4 08             	add    $0x8,%esp
+  8035b2:	53                   	push   %ebx
+  8035b3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035b9:	50                   	push   %eax
+  8035ba:	e8 c7 d8 ff ff       	call   800e86 <sys_cputs>
+  8035bf:	01 de                	add    %ebx,%esi
+  8035c1:	89 f0                	mov    %esi,%eax
+  8035c3:	83 c4 10             	add    $0x10,%esp
+  8035c6:	39 fe                	cmp    %edi,%esi
+  8035c8:	72 c3                	jb     80358d <devcons_write+0x1d>
+  8035ca:	89 f0                	mov    %esi,%eax
+  8035cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035cf:	5b                   	pop    %ebx
+  8035d0:	5e                   	pop    %esi
+  8035d1:	5f                   	pop    %edi
+  8035d2:	5d                   	pop    %ebp
+  8035d3:	c3                   	ret
+  8035d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035d9:	eb ef                	jmp    8035ca <devcons_write+0x5a>
+
+008035db <devcons_read>:
+  8035db:	55                   	push   %ebp
+  8035dc:	89 e5                	mov    %esp,%ebp
+  8035de:	83 ec 08             	sub    $0x8,%esp
+  8035e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035ea:	75 07                	jne    8035f3 <devcons_read+0x18>
+  8035ec:	eb 1f                	jmp    80360d <devcons_read+0x32>
+  8035ee:	e8 30 d9 ff ff       	call   800f23 <sys_yield>
+  8035f3:	e8 ac d8 ff ff       	call   800ea4 <sys_cgetc>
+  8035f8:	85 c0                	test   %eax,%eax
+  8035fa:	74 f2                	je     8035ee <devcons_read+0x13>
+  8035fc:	78 0f                	js     80360d <devcons_read+0x32>
+  8035fe:	83 f8 04             	cmp    $0x4,%eax
+  803601:	74 0c                	je     80360f <devcons_read+0x34>
+  803603:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803606:	88 02                	mov    %al,(%edx)
+  803608:	b8 01 00 00 00       	mov    $0x1,%eax
+  80360d:	c9                   	leave
+  80360e:	c3                   	ret
+  80360f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803614:	eb f7                	jmp    80360d <devcons_read+0x32>
+
+00803616 <cputchar>:
+  803616:	55                   	push   %ebp
+  803617:	89 e5                	mov    %esp,%ebp
+  803619:	83 ec 20             	sub    $0x20,%esp
+  80361c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80361f:	88 45 f7             	mov    %al,-0x9(%ebp)
+  803622:	6a 01                	push   $0x1
+  803624:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803627:	50                   	push   %eax
+  803628:	e8 59 d8 ff ff       	call   800e86 <sys_cputs>
+  80362d:	83 c4 10             	add    $0x10,%esp
+  803630:	c9                   	leave
+  803631:	c3                   	ret
+
+00803632 <getchar>:
+  803632:	55                   	push   %ebp
+  803633:	89 e5                	mov    %esp,%ebp
+  803635:	83 ec 1c             	sub    $0x1c,%esp
+  803638:	6a 01                	push   $0x1
+  80363a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80363d:	50                   	push   %eax
+  80363e:	6a 00                	push   $0x0
+  803640:	e8 0e ec ff ff       	call   802253 <read>
+  803645:	83 c4 10             	add    $0x10,%esp
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	78 06                	js     803652 <getchar+0x20>
+  80364c:	74 06                	je     803654 <getchar+0x22>
+  80364e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  803652:	c9                   	leave
+  803653:	c3                   	ret
+  803654:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803659:	eb f7                	jmp    803652 <getchar+0x20>
+
+0080365b <iscons>:
+  80365b:	55                   	push   %ebp
+  80365c:	89 e5                	mov    %esp,%ebp
+  80365e:	83 ec 20             	sub    $0x20,%esp
+  803661:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803664:	50                   	push   %eax
+  803665:	ff 75 08             	push   0x8(%ebp)
+  803668:	e8 84 e9 ff ff       	call   801ff1 <fd_lookup>
+  80366d:	83 c4 10             	add    $0x10,%esp
+  803670:	85 c0                	test   %eax,%eax
+  803672:	78 11                	js     803685 <iscons+0x2a>
+  803674:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803677:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  80367d:	39 10                	cmp    %edx,(%eax)
+  80367f:	0f 94 c0             	sete   %al
+  803682:	0f b6 c0             	movzbl %al,%eax
+  803685:	c9                   	leave
+  803686:	c3                   	ret
+
+00803687 <opencons>:
+  803687:	55                   	push   %ebp
+  803688:	89 e5                	mov    %esp,%ebp
+  80368a:	83 ec 24             	sub    $0x24,%esp
+  80368d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803690:	50                   	push   %eax
+  803691:	e8 0b e9 ff ff       	call   801fa1 <fd_alloc>
+  803696:	83 c4 10             	add    $0x10,%esp
+  803699:	85 c0                	test   %eax,%eax
+  80369b:	78 3a                	js     8036d7 <opencons+0x50>
+  80369d:	83 ec 04             	sub    $0x4,%esp
+  8036a0:	68 07 04 00 00       	push   $0x407
+  8036a5:	ff 75 f4             	push   -0xc(%ebp)
+  8036a8:	6a 00                	push   $0x0
+  8036aa:	e8 bf d8 ff ff       	call   800f6e <sys_page_alloc>
+  8036af:	83 c4 10             	add    $0x10,%esp
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	78 21                	js     8036d7 <opencons+0x50>
+  8036b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036b9:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  8036bf:	89 10                	mov    %edx,(%eax)
+  8036c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036c4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8036cb:	83 ec 0c             	sub    $0xc,%esp
+  8036ce:	50                   	push   %eax
+  8036cf:	e8 a6 e8 ff ff       	call   801f7a <fd2num>
+  8036d4:	83 c4 10             	add    $0x10,%esp
+  8036d7:	c9                   	leave
+  8036d8:	c3                   	ret
+
+008036d9 <set_pgfault_handler>:
+  8036d9:	55                   	push   %ebp
+  8036da:	89 e5                	mov    %esp,%ebp
+  8036dc:	53                   	push   %ebx
+  8036dd:	83 ec 04             	sub    $0x4,%esp
+  8036e0:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8036e7:	74 0d                	je     8036f6 <set_pgfault_handler+0x1d>
+  8036e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ec:	a3 00 90 80 00       	mov    %eax,0x809000
+  8036f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036f4:	c9                   	leave
+  8036f5:	c3                   	ret
+  8036f6:	e8 09 d8 ff ff       	call   800f04 <sys_getenvid>
+  8036fb:	89 c3                	mov    %eax,%ebx
+  8036fd:	83 ec 04             	sub    $0x4,%esp
+  803700:	6a 07                	push   $0x7
+  803702:	68 00 f0 7f ee       	push   $0xee7ff000
+  803707:	50                   	push   %eax
+  803708:	e8 61 d8 ff ff       	call   800f6e <sys_page_alloc>
+  80370d:	83 c4 10             	add    $0x10,%esp
+  803710:	85 c0                	test   %eax,%eax
+  803712:	78 29                	js     80373d <set_pgfault_handler+0x64>
+  803714:	83 ec 08             	sub    $0x8,%esp
+  803717:	68 51 37 80 00       	push   $0x803751
+  80371c:	53                   	push   %ebx
+  80371d:	e8 65 da ff ff       	call   801187 <sys_env_set_pgfault_upcall>
+  803722:	83 c4 10             	add    $0x10,%esp
+  803725:	85 c0                	test   %eax,%eax
+  803727:	79 c0                	jns    8036e9 <set_pgfault_handler+0x10>
+  803729:	83 ec 04             	sub    $0x4,%esp
+  80372c:	68 00 41 80 00       	push   $0x804100
+  803731:	6a 27                	push   $0x27
+  803733:	68 32 41 80 00       	push   $0x804132
+  803738:	e8 ff cb ff ff       	call   80033c <_panic>
+  80373d:	83 ec 04             	sub    $0x4,%esp
+  803740:	68 c8 40 80 00       	push   $0x8040c8
+  803745:	6a 23                	push   $0x23
+  803747:	68 32 41 80 00       	push   $0x804132
+  80374c:	e8 eb cb ff ff       	call   80033c <_panic>
+
+00803751 <_pgfault_upcall>:
+  803751:	54                   	push   %esp
+  803752:	a1 00 90 80 00       	mov    0x809000,%eax
+  803757:	ff d0                	call   *%eax
+  803759:	83 c4 04             	add    $0x4,%esp
+  80375c:	89 e3                	mov    %esp,%ebx
+  80375e:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803762:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803766:	89 d4                	mov    %edx,%esp
+  803768:	51                   	push   %ecx
+  803769:	89 dc                	mov    %ebx,%esp
+  80376b:	83 ea 04             	sub    $0x4,%edx
+  80376e:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803772:	83 c4 08             	add    $0x8,%esp
+  803775:	61                   	popa
+  803776:	83 c4 04             	add    $0x4,%esp
+  803779:	9d                   	popf
+  80377a:	5c                   	pop    %esp
+  80377b:	c3                   	ret
+
+0080377c <pageref>:
+  80377c:	55                   	push   %ebp
+  80377d:	89 e5                	mov    %esp,%ebp
+  80377f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803782:	89 c2                	mov    %eax,%edx
+  803784:	c1 ea 16             	shr    $0x16,%edx
+  803787:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80378e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803793:	f6 c1 01             	test   $0x1,%cl
+  803796:	74 22                	je     8037ba <pageref+0x3e>
+  803798:	c1 e8 0c             	shr    $0xc,%eax
+  80379b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037a2:	a8 01                	test   $0x1,%al
+  8037a4:	74 14                	je     8037ba <pageref+0x3e>
+  8037a6:	c1 e8 0c             	shr    $0xc,%eax
+  8037a9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8037ac:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8037b3:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8037b7:	0f b7 d2             	movzwl %dx,%edx
+  8037ba:	89 d0                	mov    %edx,%eax
+  8037bc:	5d                   	pop    %ebp
+  8037bd:	c3                   	ret
+
+008037be <__udivmoddi4>:
+  8037be:	55                   	push   %ebp
+  8037bf:	57                   	push   %edi
+  8037c0:	56                   	push   %esi
+  8037c1:	53                   	push   %ebx
+  8037c2:	83 ec 24             	sub    $0x24,%esp
+  8037c5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8037c9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8037cd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8037d1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8037d5:	8b 44 24 40          	mov    0x40(%esp),%eax
+  8037d9:	8b 54 24 44          	mov    0x44(%esp),%edx
+  8037dd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8037e1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8037e5:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8037e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037f3:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8037f8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8037ff:	00 
+  803800:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803807:	00 
+  803808:	89 fb                	mov    %edi,%ebx
+  80380a:	eb 08                	jmp    803814 <__udivmoddi4+0x56>
+  80380c:	83 e9 01             	sub    $0x1,%ecx
+  80380f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803812:	74 68                	je     80387c <__udivmoddi4+0xbe>
+  803814:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803818:	01 c0                	add    %eax,%eax
+  80381a:	89 c6                	mov    %eax,%esi
+  80381c:	89 d7                	mov    %edx,%edi
+  80381e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803822:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803826:	0f ad d0             	shrd   %cl,%edx,%eax
+  803829:	d3 ea                	shr    %cl,%edx
+  80382b:	f6 c1 20             	test   $0x20,%cl
+  80382e:	74 04                	je     803834 <__udivmoddi4+0x76>
+  803830:	89 d0                	mov    %edx,%eax
+  803832:	31 d2                	xor    %edx,%edx
+  803834:	83 e0 01             	and    $0x1,%eax
+  803837:	89 04 24             	mov    %eax,(%esp)
+  80383a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803841:	00 
+  803842:	8b 04 24             	mov    (%esp),%eax
+  803845:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803849:	09 f0                	or     %esi,%eax
+  80384b:	09 fa                	or     %edi,%edx
+  80384d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803851:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803855:	39 f0                	cmp    %esi,%eax
+  803857:	89 d5                	mov    %edx,%ebp
+  803859:	19 fd                	sbb    %edi,%ebp
+  80385b:	72 af                	jb     80380c <__udivmoddi4+0x4e>
+  80385d:	29 f0                	sub    %esi,%eax
+  80385f:	19 fa                	sbb    %edi,%edx
+  803861:	89 cf                	mov    %ecx,%edi
+  803863:	c1 ef 05             	shr    $0x5,%edi
+  803866:	83 e7 01             	and    $0x1,%edi
+  803869:	89 fe                	mov    %edi,%esi
+  80386b:	83 f6 01             	xor    $0x1,%esi
+  80386e:	d3 e6                	shl    %cl,%esi
+  803870:	d3 e7                	shl    %cl,%edi
+  803872:	09 74 24 18          	or     %esi,0x18(%esp)
+  803876:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80387a:	eb 90                	jmp    80380c <__udivmoddi4+0x4e>
+  80387c:	85 db                	test   %ebx,%ebx
+  80387e:	74 05                	je     803885 <__udivmoddi4+0xc7>
+  803880:	89 03                	mov    %eax,(%ebx)
+  803882:	89 53 04             	mov    %edx,0x4(%ebx)
+  803885:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803889:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80388d:	83 c4 24             	add    $0x24,%esp
+  803890:	5b                   	pop    %ebx
+  803891:	5e                   	pop    %esi
+  803892:	5f                   	pop    %edi
+  803893:	5d                   	pop    %ebp
+  803894:	c3                   	ret
+
+00803895 <__udivdi3>:
+  803895:	83 ec 08             	sub    $0x8,%esp
+  803898:	6a 00                	push   $0x0
+  80389a:	ff 74 24 1c          	push   0x1c(%esp)
+  80389e:	ff 74 24 1c          	push   0x1c(%esp)
+  8038a2:	ff 74 24 1c          	push   0x1c(%esp)
+  8038a6:	ff 74 24 1c          	push   0x1c(%esp)
+  8038aa:	e8 0f ff ff ff       	call   8037be <__udivmoddi4>
+  8038af:	83 c4 1c             	add    $0x1c,%esp
+  8038b2:	c3                   	ret
+
+008038b3 <__umoddi3>:
+  8038b3:	83 ec 18             	sub    $0x18,%esp
+  8038b6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8038ba:	50                   	push   %eax
+  8038bb:	ff 74 24 2c          	push   0x2c(%esp)
+  8038bf:	ff 74 24 2c          	push   0x2c(%esp)
+  8038c3:	ff 74 24 2c          	push   0x2c(%esp)
+  8038c7:	ff 74 24 2c          	push   0x2c(%esp)
+  8038cb:	e8 ee fe ff ff       	call   8037be <__udivmoddi4>
+  8038d0:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8038d4:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8038d8:	83 c4 2c             	add    $0x2c,%esp
+  8038db:	c3                   	ret
+
+008038dc <__divdi3>:
+  8038dc:	53                   	push   %ebx
+  8038dd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038e1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038e5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8038e9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8038ed:	85 d2                	test   %edx,%edx
+  8038ef:	78 12                	js     803903 <__divdi3+0x27>
+  8038f1:	85 db                	test   %ebx,%ebx
+  8038f3:	78 2e                	js     803923 <__divdi3+0x47>
+  8038f5:	53                   	push   %ebx
+  8038f6:	51                   	push   %ecx
+  8038f7:	52                   	push   %edx
+  8038f8:	50                   	push   %eax
+  8038f9:	e8 97 ff ff ff       	call   803895 <__udivdi3>
+  8038fe:	83 c4 10             	add    $0x10,%esp
+  803901:	eb 1e                	jmp    803921 <__divdi3+0x45>
+  803903:	f7 d8                	neg    %eax
+  803905:	83 d2 00             	adc    $0x0,%edx
+  803908:	f7 da                	neg    %edx
+  80390a:	85 db                	test   %ebx,%ebx
+  80390c:	78 2a                	js     803938 <__divdi3+0x5c>
+  80390e:	53                   	push   %ebx
+  80390f:	51                   	push   %ecx
+  803910:	52                   	push   %edx
+  803911:	50                   	push   %eax
+  803912:	e8 7e ff ff ff       	call   803895 <__udivdi3>
+  803917:	83 c4 10             	add    $0x10,%esp
+  80391a:	f7 d8                	neg    %eax
+  80391c:	83 d2 00             	adc    $0x0,%edx
+  80391f:	f7 da                	neg    %edx
+  803921:	5b                   	pop    %ebx
+  803922:	c3                   	ret
+  803923:	f7 d9                	neg    %ecx
+  803925:	83 d3 00             	adc    $0x0,%ebx
+  803928:	f7 db                	neg    %ebx
+  80392a:	53                   	push   %ebx
+  80392b:	51                   	push   %ecx
+  80392c:	52                   	push   %edx
+  80392d:	50                   	push   %eax
+  80392e:	e8 62 ff ff ff       	call   803895 <__udivdi3>
+  803933:	83 c4 10             	add    $0x10,%esp
+  803936:	eb e2                	jmp    80391a <__divdi3+0x3e>
+  803938:	f7 d9                	neg    %ecx
+  80393a:	83 d3 00             	adc    $0x0,%ebx
+  80393d:	f7 db                	neg    %ebx
+  80393f:	53                   	push   %ebx
+  803940:	51                   	push   %ecx
+  803941:	52                   	push   %edx
+  803942:	50                   	push   %eax
+  803943:	e8 4d ff ff ff       	call   803895 <__udivdi3>
+  803948:	83 c4 10             	add    $0x10,%esp
+  80394b:	eb d4                	jmp    803921 <__divdi3+0x45>
+
+0080394d <__moddi3>:
+  80394d:	55                   	push   %ebp
+  80394e:	57                   	push   %edi
+  80394f:	56                   	push   %esi
+  803950:	53                   	push   %ebx
+  803951:	83 ec 0c             	sub    $0xc,%esp
+  803954:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  803958:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80395c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803960:	89 e9                	mov    %ebp,%ecx
+  803962:	f7 d9                	neg    %ecx
+  803964:	89 d0                	mov    %edx,%eax
+  803966:	83 d0 00             	adc    $0x0,%eax
+  803969:	f7 d8                	neg    %eax
+  80396b:	0f 49 e9             	cmovns %ecx,%ebp
+  80396e:	0f 49 d0             	cmovns %eax,%edx
+  803971:	52                   	push   %edx
+  803972:	55                   	push   %ebp
+  803973:	8b 54 24 28          	mov    0x28(%esp),%edx
+  803977:	f7 da                	neg    %edx
+  803979:	89 d8                	mov    %ebx,%eax
+  80397b:	83 d0 00             	adc    $0x0,%eax
+  80397e:	f7 d8                	neg    %eax
+  803980:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803985:	89 54 24 08          	mov    %edx,0x8(%esp)
+  803989:	0f 48 c3             	cmovs  %ebx,%eax
+  80398c:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803990:	ff 74 24 0c          	push   0xc(%esp)
+  803994:	ff 74 24 0c          	push   0xc(%esp)
+  803998:	e8 16 ff ff ff       	call   8038b3 <__umoddi3>
+  80399d:	83 c4 10             	add    $0x10,%esp
+  8039a0:	85 db                	test   %ebx,%ebx
+  8039a2:	78 08                	js     8039ac <__moddi3+0x5f>
+  8039a4:	83 c4 0c             	add    $0xc,%esp
+  8039a7:	5b                   	pop    %ebx
+  8039a8:	5e                   	pop    %esi
+  8039a9:	5f                   	pop    %edi
+  8039aa:	5d                   	pop    %ebp
+  8039ab:	c3                   	ret
+  8039ac:	f7 d8                	neg    %eax
+  8039ae:	83 d2 00             	adc    $0x0,%edx
+  8039b1:	f7 da                	neg    %edx
+  8039b3:	eb ef                	jmp    8039a4 <__moddi3+0x57>
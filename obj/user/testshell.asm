@@ -0,0 +1,6425 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 9d 04 00 00       	call   8004ce <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 ff 22 00 00       	call   80234e <seek>
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 f5 22 00 00       	call   80234e <seek>
+  800059:	c7 04 24 80 43 80 00 	movl   $0x804380,(%esp)
+  800060:	e8 bd 05 00 00       	call   800622 <cprintf>
+  800065:	c7 04 24 1b 44 80 00 	movl   $0x80441b,(%esp)
+  80006c:	e8 b1 05 00 00       	call   800622 <cprintf>
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 0e 10 00 00       	call   801091 <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 5f 21 00 00       	call   8021f1 <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 2a 44 80 00       	push   $0x80442a
+  8000a1:	e8 7c 05 00 00       	call   800622 <cprintf>
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 d9 0f 00 00       	call   801091 <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 2a 21 00 00       	call   8021f1 <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 25 44 80 00       	push   $0x804425
+  8000d6:	e8 47 05 00 00       	call   800622 <cprintf>
+  8000db:	e8 37 04 00 00       	call   800517 <exit>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 ba 1f 00 00       	call   8020b5 <close>
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 ae 1f 00 00       	call   8020b5 <close>
+  800107:	e8 70 03 00 00       	call   80047c <opencons>
+  80010c:	e8 6b 03 00 00       	call   80047c <opencons>
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 38 44 80 00       	push   $0x804438
+  80011b:	e8 8e 28 00 00       	call   8029ae <open>
+  800120:	89 c7                	mov    %eax,%edi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 09 01 00 00    	js     800236 <umain+0x14b>
+  80012d:	83 ec 08             	sub    $0x8,%esp
+  800130:	68 01 03 00 00       	push   $0x301
+  800135:	68 6c 44 80 00       	push   $0x80446c
+  80013a:	e8 6f 28 00 00       	call   8029ae <open>
+  80013f:	89 c6                	mov    %eax,%esi
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	85 c0                	test   %eax,%eax
+  800146:	0f 88 fc 00 00 00    	js     800248 <umain+0x15d>
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	68 a4 43 80 00       	push   $0x8043a4
+  800154:	e8 c9 04 00 00       	call   800622 <cprintf>
+  800159:	e8 69 1a 00 00       	call   801bc7 <fork>
+  80015e:	89 c3                	mov    %eax,%ebx
+  800160:	83 c4 10             	add    $0x10,%esp
+  800163:	85 c0                	test   %eax,%eax
+  800165:	0f 88 ef 00 00 00    	js     80025a <umain+0x16f>
+  80016b:	75 6f                	jne    8001dc <umain+0xf1>
+  80016d:	83 ec 08             	sub    $0x8,%esp
+  800170:	6a 00                	push   $0x0
+  800172:	57                   	push   %edi
+  800173:	e8 8f 1f 00 00       	call   802107 <dup>
+  800178:	83 c4 08             	add    $0x8,%esp
+  80017b:	6a 01                	push   $0x1
+  80017d:	56                   	push   %esi
+  80017e:	e8 84 1f 00 00       	call   802107 <dup>
+  800183:	89 3c 24             	mov    %edi,(%esp)
+  800186:	e8 2a 1f 00 00       	call   8020b5 <close>
+  80018b:	89 34 24             	mov    %esi,(%esp)
+  80018e:	e8 22 1f 00 00       	call   8020b5 <close>
+  800193:	6a 00                	push   $0x0
+  800195:	68 9a 44 80 00       	push   $0x80449a
+  80019a:	68 42 44 80 00       	push   $0x804442
+  80019f:	68 9d 44 80 00       	push   $0x80449d
+  8001a4:	e8 5d 31 00 00       	call   803306 <spawnl>
+  8001a9:	89 c3                	mov    %eax,%ebx
+  8001ab:	83 c4 20             	add    $0x20,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 b6 00 00 00    	js     80026c <umain+0x181>
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	6a 00                	push   $0x0
+  8001bb:	e8 f5 1e 00 00       	call   8020b5 <close>
+  8001c0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c7:	e8 e9 1e 00 00       	call   8020b5 <close>
+  8001cc:	89 1c 24             	mov    %ebx,(%esp)
+  8001cf:	e8 e4 39 00 00       	call   803bb8 <wait>
+  8001d4:	e8 3e 03 00 00       	call   800517 <exit>
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	83 ec 0c             	sub    $0xc,%esp
+  8001df:	57                   	push   %edi
+  8001e0:	e8 d0 1e 00 00       	call   8020b5 <close>
+  8001e5:	89 34 24             	mov    %esi,(%esp)
+  8001e8:	e8 c8 1e 00 00       	call   8020b5 <close>
+  8001ed:	89 1c 24             	mov    %ebx,(%esp)
+  8001f0:	e8 c3 39 00 00       	call   803bb8 <wait>
+  8001f5:	83 c4 08             	add    $0x8,%esp
+  8001f8:	6a 00                	push   $0x0
+  8001fa:	68 6c 44 80 00       	push   $0x80446c
+  8001ff:	e8 aa 27 00 00       	call   8029ae <open>
+  800204:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 70                	js     80027e <umain+0x193>
+  80020e:	83 ec 08             	sub    $0x8,%esp
+  800211:	6a 00                	push   $0x0
+  800213:	68 ab 44 80 00       	push   $0x8044ab
+  800218:	e8 91 27 00 00       	call   8029ae <open>
+  80021d:	83 c4 10             	add    $0x10,%esp
+  800220:	85 c0                	test   %eax,%eax
+  800222:	78 6c                	js     800290 <umain+0x1a5>
+  800224:	be 01 00 00 00       	mov    $0x1,%esi
+  800229:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800231:	e9 ac 00 00 00       	jmp    8002e2 <umain+0x1f7>
+  800236:	50                   	push   %eax
+  800237:	68 45 44 80 00       	push   $0x804445
+  80023c:	6a 12                	push   $0x12
+  80023e:	68 5b 44 80 00       	push   $0x80445b
+  800243:	e8 ff 02 00 00       	call   800547 <_panic>
+  800248:	50                   	push   %eax
+  800249:	68 7a 44 80 00       	push   $0x80447a
+  80024e:	6a 14                	push   $0x14
+  800250:	68 5b 44 80 00       	push   $0x80445b
+  800255:	e8 ed 02 00 00       	call   800547 <_panic>
+  80025a:	50                   	push   %eax
+  80025b:	68 91 44 80 00       	push   $0x804491
+  800260:	6a 18                	push   $0x18
+  800262:	68 5b 44 80 00       	push   $0x80445b
+  800267:	e8 db 02 00 00       	call   800547 <_panic>
+  80026c:	50                   	push   %eax
+  80026d:	68 a1 44 80 00       	push   $0x8044a1
+  800272:	6a 1f                	push   $0x1f
+  800274:	68 5b 44 80 00       	push   $0x80445b
+  800279:	e8 c9 02 00 00       	call   800547 <_panic>
+  80027e:	50                   	push   %eax
+  80027f:	68 d4 43 80 00       	push   $0x8043d4
+  800284:	6a 2a                	push   $0x2a
+  800286:	68 5b 44 80 00       	push   $0x80445b
+  80028b:	e8 b7 02 00 00       	call   800547 <_panic>
+  800290:	50                   	push   %eax
+  800291:	68 f8 43 80 00       	push   $0x8043f8
+  800296:	6a 2c                	push   $0x2c
+  800298:	68 5b 44 80 00       	push   $0x80445b
+  80029d:	e8 a5 02 00 00       	call   800547 <_panic>
+  8002a2:	53                   	push   %ebx
+  8002a3:	68 b9 44 80 00       	push   $0x8044b9
+  8002a8:	6a 33                	push   $0x33
+  8002aa:	68 5b 44 80 00       	push   $0x80445b
+  8002af:	e8 93 02 00 00       	call   800547 <_panic>
+  8002b4:	50                   	push   %eax
+  8002b5:	68 d3 44 80 00       	push   $0x8044d3
+  8002ba:	6a 35                	push   $0x35
+  8002bc:	68 5b 44 80 00       	push   $0x80445b
+  8002c1:	e8 81 02 00 00       	call   800547 <_panic>
+  8002c6:	83 ec 04             	sub    $0x4,%esp
+  8002c9:	57                   	push   %edi
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	ff 75 d4             	push   -0x2c(%ebp)
+  8002d0:	e8 5e fd ff ff       	call   800033 <wrong>
+  8002d5:	83 c4 10             	add    $0x10,%esp
+  8002d8:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002dc:	0f 44 fe             	cmove  %esi,%edi
+  8002df:	83 c6 01             	add    $0x1,%esi
+  8002e2:	83 ec 04             	sub    $0x4,%esp
+  8002e5:	6a 01                	push   $0x1
+  8002e7:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002ea:	50                   	push   %eax
+  8002eb:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ee:	e8 fe 1e 00 00       	call   8021f1 <read>
+  8002f3:	89 c3                	mov    %eax,%ebx
+  8002f5:	83 c4 0c             	add    $0xc,%esp
+  8002f8:	6a 01                	push   $0x1
+  8002fa:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002fd:	50                   	push   %eax
+  8002fe:	ff 75 d0             	push   -0x30(%ebp)
+  800301:	e8 eb 1e 00 00       	call   8021f1 <read>
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	85 db                	test   %ebx,%ebx
+  80030b:	78 95                	js     8002a2 <umain+0x1b7>
+  80030d:	85 c0                	test   %eax,%eax
+  80030f:	78 a3                	js     8002b4 <umain+0x1c9>
+  800311:	89 d9                	mov    %ebx,%ecx
+  800313:	09 c1                	or     %eax,%ecx
+  800315:	74 15                	je     80032c <umain+0x241>
+  800317:	83 fb 01             	cmp    $0x1,%ebx
+  80031a:	75 aa                	jne    8002c6 <umain+0x1db>
+  80031c:	83 f8 01             	cmp    $0x1,%eax
+  80031f:	75 a5                	jne    8002c6 <umain+0x1db>
+  800321:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  800325:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  800328:	75 9c                	jne    8002c6 <umain+0x1db>
+  80032a:	eb ac                	jmp    8002d8 <umain+0x1ed>
+  80032c:	83 ec 0c             	sub    $0xc,%esp
+  80032f:	68 ed 44 80 00       	push   $0x8044ed
+  800334:	e8 e9 02 00 00       	call   800622 <cprintf>
+  800339:	cc                   	int3
+  80033a:	83 c4 10             	add    $0x10,%esp
+  80033d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800340:	5b                   	pop    %ebx
+  800341:	5e                   	pop    %esi
+  800342:	5f                   	pop    %edi
+  800343:	5d                   	pop    %ebp
+  800344:	c3                   	ret
+
+00800345 <devcons_close>:
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	c3                   	ret
+
+0080034b <devcons_stat>:
+  80034b:	55                   	push   %ebp
+  80034c:	89 e5                	mov    %esp,%ebp
+  80034e:	83 ec 10             	sub    $0x10,%esp
+  800351:	68 02 45 80 00       	push   $0x804502
+  800356:	ff 75 0c             	push   0xc(%ebp)
+  800359:	e8 bb 09 00 00       	call   800d19 <strcpy>
+  80035e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800363:	c9                   	leave
+  800364:	c3                   	ret
+
+00800365 <devcons_write>:
+  800365:	55                   	push   %ebp
+  800366:	89 e5                	mov    %esp,%ebp
+  800368:	57                   	push   %edi
+  800369:	56                   	push   %esi
+  80036a:	53                   	push   %ebx
+  80036b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  800371:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800374:	85 ff                	test   %edi,%edi
+  800376:	74 51                	je     8003c9 <devcons_write+0x64>
+  800378:	be 00 00 00 00       	mov    $0x0,%esi
+  80037d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800382:	89 fb                	mov    %edi,%ebx
+  800384:	29 c3                	sub    %eax,%ebx
+  800386:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80038b:	39 d3                	cmp    %edx,%ebx
+  80038d:	0f 47 da             	cmova  %edx,%ebx
+  800390:	83 ec 04             	sub    $0x4,%esp
+  800393:	53                   	push   %ebx
+  800394:	03 45 0c             	add    0xc(%ebp),%eax
+  800397:	50                   	push   %eax
+  800398:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80039e:	50                   	push   %eax
+  80039f:	e8 25 0b 00 00       	call   800ec9 <memmove>
+  8003a4:	83 c4 08             	add    $0x8,%esp
+  8003a7:	53                   	push   %ebx
+  8003a8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8003ae:	50                   	push   %eax
+  8003af:	e8 dd 0c 00 00       	call   801091 <sys_cputs>
+  8003b4:	01 de                	add    %ebx,%esi
+  8003b6:	89 f0                	mov    %esi,%eax
+  8003b8:	83 c4 10             	add    $0x10,%esp
+  8003bb:	39 fe                	cmp    %edi,%esi
+  8003bd:	72 c3                	jb     800382 <devcons_write+0x1d>
+  8003bf:	89 f0                	mov    %esi,%eax
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+  8003c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ce:	eb ef                	jmp    8003bf <devcons_write+0x5a>
+
+008003d0 <devcons_read>:
+  8003d0:	55                   	push   %ebp
+  8003d1:	89 e5                	mov    %esp,%ebp
+  8003d3:	83 ec 08             	sub    $0x8,%esp
+  8003d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003db:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8003df:	75 07                	jne    8003e8 <devcons_read+0x18>
+  8003e1:	eb 1f                	jmp    800402 <devcons_read+0x32>
+  8003e3:	e8 46 0d 00 00       	call   80112e <sys_yield>
+  8003e8:	e8 c2 0c 00 00       	call   8010af <sys_cgetc>
+  8003ed:	85 c0                	test   %eax,%eax
+  8003ef:	74 f2                	je     8003e3 <devcons_read+0x13>
+  8003f1:	78 0f                	js     800402 <devcons_read+0x32>
+  8003f3:	83 f8 04             	cmp    $0x4,%eax
+  8003f6:	74 0c                	je     800404 <devcons_read+0x34>
+  8003f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003fb:	88 02                	mov    %al,(%edx)
+  8003fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800402:	c9                   	leave
+  800403:	c3                   	ret
+  800404:	b8 00 00 00 00       	mov    $0x0,%eax
+  800409:	eb f7                	jmp    800402 <devcons_read+0x32>
+
+0080040b <cputchar>:
+  80040b:	55                   	push   %ebp
+  80040c:	89 e5                	mov    %esp,%ebp
+  80040e:	83 ec 20             	sub    $0x20,%esp
+  800411:	8b 45 08             	mov    0x8(%ebp),%eax
+  800414:	88 45 f7             	mov    %al,-0x9(%ebp)
+  800417:	6a 01                	push   $0x1
+  800419:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80041c:	50                   	push   %eax
+  80041d:	e8 6f 0c 00 00       	call   801091 <sys_cputs>
+  800422:	83 c4 10             	add    $0x10,%esp
+  800425:	c9                   	leave
+  800426:	c3                   	ret
+
+00800427 <getchar>:
+  800427:	55                   	push   %ebp
+  800428:	89 e5                	mov    %esp,%ebp
+  80042a:	83 ec 1c             	sub    $0x1c,%esp
+  80042d:	6a 01                	push   $0x1
+  80042f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800432:	50                   	push   %eax
+  800433:	6a 00                	push   $0x0
+  800435:	e8 b7 1d 00 00       	call   8021f1 <read>
+  80043a:	83 c4 10             	add    $0x10,%esp
+  80043d:	85 c0                	test   %eax,%eax
+  80043f:	78 06                	js     800447 <getchar+0x20>
+  800441:	74 06                	je     800449 <getchar+0x22>
+  800443:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  800447:	c9                   	leave
+  800448:	c3                   	ret
+  800449:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80044e:	eb f7                	jmp    800447 <getchar+0x20>
+
+00800450 <iscons>:
+  800450:	55                   	push   %ebp
+  800451:	89 e5                	mov    %esp,%ebp
+  800453:	83 ec 20             	sub    $0x20,%esp
+  800456:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800459:	50                   	push   %eax
+  80045a:	ff 75 08             	push   0x8(%ebp)
+  80045d:	e8 2d 1b 00 00       	call   801f8f <fd_lookup>
+  800462:	83 c4 10             	add    $0x10,%esp
+  800465:	85 c0                	test   %eax,%eax
+  800467:	78 11                	js     80047a <iscons+0x2a>
+  800469:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80046c:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800472:	39 10                	cmp    %edx,(%eax)
+  800474:	0f 94 c0             	sete   %al
+  800477:	0f b6 c0             	movzbl %al,%eax
+  80047a:	c9                   	leave
+  80047b:	c3                   	ret
+
+0080047c <opencons>:
+  80047c:	55                   	push   %ebp
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	83 ec 24             	sub    $0x24,%esp
+  800482:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800485:	50                   	push   %eax
+  800486:	e8 b4 1a 00 00       	call   801f3f <fd_alloc>
+  80048b:	83 c4 10             	add    $0x10,%esp
+  80048e:	85 c0                	test   %eax,%eax
+  800490:	78 3a                	js     8004cc <opencons+0x50>
+  800492:	83 ec 04             	sub    $0x4,%esp
+  800495:	68 07 04 00 00       	push   $0x407
+  80049a:	ff 75 f4             	push   -0xc(%ebp)
+  80049d:	6a 00                	push   $0x0
+  80049f:	e8 d5 0c 00 00       	call   801179 <sys_page_alloc>
+  8004a4:	83 c4 10             	add    $0x10,%esp
+  8004a7:	85 c0                	test   %eax,%eax
+  8004a9:	78 21                	js     8004cc <opencons+0x50>
+  8004ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004ae:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8004b4:	89 10                	mov    %edx,(%eax)
+  8004b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004b9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8004c0:	83 ec 0c             	sub    $0xc,%esp
+  8004c3:	50                   	push   %eax
+  8004c4:	e8 4f 1a 00 00       	call   801f18 <fd2num>
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  8004cc:	c9                   	leave
+  8004cd:	c3                   	ret
+
+008004ce <libmain>:
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	56                   	push   %esi
+  8004d2:	53                   	push   %ebx
+  8004d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8004d9:	e8 31 0c 00 00       	call   80110f <sys_getenvid>
+  8004de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004e3:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8004e9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004ee:	a3 14 60 80 00       	mov    %eax,0x806014
+  8004f3:	85 db                	test   %ebx,%ebx
+  8004f5:	7e 07                	jle    8004fe <libmain+0x30>
+  8004f7:	8b 06                	mov    (%esi),%eax
+  8004f9:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	56                   	push   %esi
+  800502:	53                   	push   %ebx
+  800503:	e8 e3 fb ff ff       	call   8000eb <umain>
+  800508:	e8 0a 00 00 00       	call   800517 <exit>
+  80050d:	83 c4 10             	add    $0x10,%esp
+  800510:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800513:	5b                   	pop    %ebx
+  800514:	5e                   	pop    %esi
+  800515:	5d                   	pop    %ebp
+  800516:	c3                   	ret
+
+00800517 <exit>:
+  800517:	55                   	push   %ebp
+  800518:	89 e5                	mov    %esp,%ebp
+  80051a:	83 ec 08             	sub    $0x8,%esp
+  80051d:	a1 14 60 80 00       	mov    0x806014,%eax
+  800522:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  800528:	85 c0                	test   %eax,%eax
+  80052a:	75 14                	jne    800540 <exit+0x29>
+  80052c:	e8 b1 1b 00 00       	call   8020e2 <close_all>
+  800531:	83 ec 0c             	sub    $0xc,%esp
+  800534:	6a 00                	push   $0x0
+  800536:	e8 93 0b 00 00       	call   8010ce <sys_env_destroy>
+  80053b:	83 c4 10             	add    $0x10,%esp
+  80053e:	c9                   	leave
+  80053f:	c3                   	ret
+  800540:	e8 f6 12 00 00       	call   80183b <sys_lease_complete>
+  800545:	eb e5                	jmp    80052c <exit+0x15>
+
+00800547 <_panic>:
+  800547:	55                   	push   %ebp
+  800548:	89 e5                	mov    %esp,%ebp
+  80054a:	56                   	push   %esi
+  80054b:	53                   	push   %ebx
+  80054c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  80054f:	8b 35 1c 50 80 00    	mov    0x80501c,%esi
+  800555:	e8 b5 0b 00 00       	call   80110f <sys_getenvid>
+  80055a:	83 ec 0c             	sub    $0xc,%esp
+  80055d:	ff 75 0c             	push   0xc(%ebp)
+  800560:	ff 75 08             	push   0x8(%ebp)
+  800563:	56                   	push   %esi
+  800564:	50                   	push   %eax
+  800565:	68 18 45 80 00       	push   $0x804518
+  80056a:	e8 b3 00 00 00       	call   800622 <cprintf>
+  80056f:	83 c4 18             	add    $0x18,%esp
+  800572:	53                   	push   %ebx
+  800573:	ff 75 10             	push   0x10(%ebp)
+  800576:	e8 56 00 00 00       	call   8005d1 <vcprintf>
+  80057b:	c7 04 24 28 44 80 00 	movl   $0x804428,(%esp)
+  800582:	e8 9b 00 00 00       	call   800622 <cprintf>
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	cc                   	int3
+  80058b:	eb fd                	jmp    80058a <_panic+0x43>
+
+0080058d <putch>:
+  80058d:	55                   	push   %ebp
+  80058e:	89 e5                	mov    %esp,%ebp
+  800590:	53                   	push   %ebx
+  800591:	83 ec 04             	sub    $0x4,%esp
+  800594:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800597:	8b 13                	mov    (%ebx),%edx
+  800599:	8d 42 01             	lea    0x1(%edx),%eax
+  80059c:	89 03                	mov    %eax,(%ebx)
+  80059e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005a1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8005a5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005aa:	74 09                	je     8005b5 <putch+0x28>
+  8005ac:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8005b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005b3:	c9                   	leave
+  8005b4:	c3                   	ret
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  8005b8:	68 ff 00 00 00       	push   $0xff
+  8005bd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005c0:	50                   	push   %eax
+  8005c1:	e8 cb 0a 00 00       	call   801091 <sys_cputs>
+  8005c6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005cc:	83 c4 10             	add    $0x10,%esp
+  8005cf:	eb db                	jmp    8005ac <putch+0x1f>
+
+008005d1 <vcprintf>:
+  8005d1:	55                   	push   %ebp
+  8005d2:	89 e5                	mov    %esp,%ebp
+  8005d4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8005da:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005e1:	00 00 00 
+  8005e4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005eb:	00 00 00 
+  8005ee:	ff 75 0c             	push   0xc(%ebp)
+  8005f1:	ff 75 08             	push   0x8(%ebp)
+  8005f4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005fa:	50                   	push   %eax
+  8005fb:	68 8d 05 80 00       	push   $0x80058d
+  800600:	e8 1c 01 00 00       	call   800721 <vprintfmt>
+  800605:	83 c4 08             	add    $0x8,%esp
+  800608:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80060e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800614:	50                   	push   %eax
+  800615:	e8 77 0a 00 00       	call   801091 <sys_cputs>
+  80061a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800620:	c9                   	leave
+  800621:	c3                   	ret
+
+00800622 <cprintf>:
+  800622:	55                   	push   %ebp
+  800623:	89 e5                	mov    %esp,%ebp
+  800625:	83 ec 10             	sub    $0x10,%esp
+  800628:	8d 45 0c             	lea    0xc(%ebp),%eax
+  80062b:	50                   	push   %eax
+  80062c:	ff 75 08             	push   0x8(%ebp)
+  80062f:	e8 9d ff ff ff       	call   8005d1 <vcprintf>
+  800634:	c9                   	leave
+  800635:	c3                   	ret
+
+00800636 <printnum>:
+  800636:	55                   	push   %ebp
+  800637:	89 e5                	mov    %esp,%ebp
+  800639:	57                   	push   %edi
+  80063a:	56                   	push   %esi
+  80063b:	53                   	push   %ebx
+  80063c:	83 ec 1c             	sub    $0x1c,%esp
+  80063f:	89 c3                	mov    %eax,%ebx
+  800641:	89 d6                	mov    %edx,%esi
+  800643:	8b 45 08             	mov    0x8(%ebp),%eax
+  800646:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800649:	89 d1                	mov    %edx,%ecx
+  80064b:	89 c2                	mov    %eax,%edx
+  80064d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800650:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800653:	8b 45 10             	mov    0x10(%ebp),%eax
+  800656:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800659:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800660:	39 c2                	cmp    %eax,%edx
+  800662:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800665:	73 4b                	jae    8006b2 <printnum+0x7c>
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80066d:	85 ff                	test   %edi,%edi
+  80066f:	7e 11                	jle    800682 <printnum+0x4c>
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	56                   	push   %esi
+  800675:	ff 75 18             	push   0x18(%ebp)
+  800678:	ff d3                	call   *%ebx
+  80067a:	83 c4 10             	add    $0x10,%esp
+  80067d:	83 ef 01             	sub    $0x1,%edi
+  800680:	75 ef                	jne    800671 <printnum+0x3b>
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	56                   	push   %esi
+  800686:	83 ec 04             	sub    $0x4,%esp
+  800689:	ff 75 e4             	push   -0x1c(%ebp)
+  80068c:	ff 75 e0             	push   -0x20(%ebp)
+  80068f:	ff 75 dc             	push   -0x24(%ebp)
+  800692:	ff 75 d8             	push   -0x28(%ebp)
+  800695:	e8 d2 3b 00 00       	call   80426c <__umoddi3>
+  80069a:	83 c4 14             	add    $0x14,%esp
+  80069d:	0f be 80 3b 45 80 00 	movsbl 0x80453b(%eax),%eax
+  8006a4:	50                   	push   %eax
+  8006a5:	ff d3                	call   *%ebx
+  8006a7:	83 c4 10             	add    $0x10,%esp
+  8006aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ad:	5b                   	pop    %ebx
+  8006ae:	5e                   	pop    %esi
+  8006af:	5f                   	pop    %edi
+  8006b0:	5d                   	pop    %ebp
+  8006b1:	c3                   	ret
+  8006b2:	83 ec 0c             	sub    $0xc,%esp
+  8006b5:	ff 75 18             	push   0x18(%ebp)
+  8006b8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006bb:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8006be:	52                   	push   %edx
+  8006bf:	50                   	push   %eax
+  8006c0:	83 ec 08             	sub    $0x8,%esp
+  8006c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8006c6:	ff 75 e0             	push   -0x20(%ebp)
+  8006c9:	ff 75 dc             	push   -0x24(%ebp)
+  8006cc:	ff 75 d8             	push   -0x28(%ebp)
+  8006cf:	e8 7a 3b 00 00       	call   80424e <__udivdi3>
+  8006d4:	83 c4 18             	add    $0x18,%esp
+  8006d7:	52                   	push   %edx
+  8006d8:	50                   	push   %eax
+  8006d9:	89 f2                	mov    %esi,%edx
+  8006db:	89 d8                	mov    %ebx,%eax
+  8006dd:	e8 54 ff ff ff       	call   800636 <printnum>
+  8006e2:	83 c4 20             	add    $0x20,%esp
+  8006e5:	eb 9b                	jmp    800682 <printnum+0x4c>
+
+008006e7 <sprintputch>:
+  8006e7:	55                   	push   %ebp
+  8006e8:	89 e5                	mov    %esp,%ebp
+  8006ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8006ed:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  8006f1:	8b 10                	mov    (%eax),%edx
+  8006f3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006f6:	73 0a                	jae    800702 <sprintputch+0x1b>
+  8006f8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006fb:	89 08                	mov    %ecx,(%eax)
+  8006fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800700:	88 02                	mov    %al,(%edx)
+  800702:	5d                   	pop    %ebp
+  800703:	c3                   	ret
+
+00800704 <printfmt>:
+  800704:	55                   	push   %ebp
+  800705:	89 e5                	mov    %esp,%ebp
+  800707:	83 ec 08             	sub    $0x8,%esp
+  80070a:	8d 45 14             	lea    0x14(%ebp),%eax
+  80070d:	50                   	push   %eax
+  80070e:	ff 75 10             	push   0x10(%ebp)
+  800711:	ff 75 0c             	push   0xc(%ebp)
+  800714:	ff 75 08             	push   0x8(%ebp)
+  800717:	e8 05 00 00 00       	call   800721 <vprintfmt>
+  80071c:	83 c4 10             	add    $0x10,%esp
+  80071f:	c9                   	leave
+  800720:	c3                   	ret
+
+00800721 <vprintfmt>:
+  800721:	55                   	push   %ebp
+  800722:	89 e5                	mov    %esp,%ebp
+  800724:	57                   	push   %edi
+  800725:	56                   	push   %esi
+  800726:	53                   	push   %ebx
+  800727:	83 ec 2c             	sub    $0x2c,%esp
+  80072a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80072d:	89 df                	mov    %ebx,%edi
+  80072f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800732:	8b 45 10             	mov    0x10(%ebp),%eax
+  800735:	8d 70 01             	lea    0x1(%eax),%esi
+  800738:	0f b6 00             	movzbl (%eax),%eax
+  80073b:	83 f8 25             	cmp    $0x25,%eax
+  80073e:	74 1e                	je     80075e <vprintfmt+0x3d>
+  800740:	85 c0                	test   %eax,%eax
+  800742:	0f 84 15 05 00 00    	je     800c5d <vprintfmt+0x53c>
+  800748:	83 ec 08             	sub    $0x8,%esp
+  80074b:	53                   	push   %ebx
+  80074c:	50                   	push   %eax
+  80074d:	ff d7                	call   *%edi
+  80074f:	83 c6 01             	add    $0x1,%esi
+  800752:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800756:	83 c4 10             	add    $0x10,%esp
+  800759:	83 f8 25             	cmp    $0x25,%eax
+  80075c:	75 e2                	jne    800740 <vprintfmt+0x1f>
+  80075e:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800762:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800769:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800770:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800777:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80077f:	8d 56 01             	lea    0x1(%esi),%edx
+  800782:	0f b6 0e             	movzbl (%esi),%ecx
+  800785:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800788:	3c 55                	cmp    $0x55,%al
+  80078a:	0f 87 3b 04 00 00    	ja     800bcb <vprintfmt+0x4aa>
+  800790:	0f b6 c0             	movzbl %al,%eax
+  800793:	ff 24 85 80 46 80 00 	jmp    *0x804680(,%eax,4)
+  80079a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80079d:	eb 93                	jmp    800732 <vprintfmt+0x11>
+  80079f:	89 d6                	mov    %edx,%esi
+  8007a1:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8007a5:	eb d8                	jmp    80077f <vprintfmt+0x5e>
+  8007a7:	89 d6                	mov    %edx,%esi
+  8007a9:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8007ad:	eb d0                	jmp    80077f <vprintfmt+0x5e>
+  8007af:	0f b6 c9             	movzbl %cl,%ecx
+  8007b2:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8007b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8007b8:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8007bc:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8007bf:	83 f9 09             	cmp    $0x9,%ecx
+  8007c2:	77 6f                	ja     800833 <vprintfmt+0x112>
+  8007c4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8007c7:	83 c2 01             	add    $0x1,%edx
+  8007ca:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8007cd:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8007d1:	0f be 02             	movsbl (%edx),%eax
+  8007d4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8007d7:	83 fe 09             	cmp    $0x9,%esi
+  8007da:	76 eb                	jbe    8007c7 <vprintfmt+0xa6>
+  8007dc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8007df:	89 d6                	mov    %edx,%esi
+  8007e1:	eb 13                	jmp    8007f6 <vprintfmt+0xd5>
+  8007e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e6:	8b 00                	mov    (%eax),%eax
+  8007e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8007eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f4:	89 d6                	mov    %edx,%esi
+  8007f6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007fa:	79 83                	jns    80077f <vprintfmt+0x5e>
+  8007fc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8007ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800802:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800809:	e9 71 ff ff ff       	jmp    80077f <vprintfmt+0x5e>
+  80080e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800811:	85 c9                	test   %ecx,%ecx
+  800813:	b8 00 00 00 00       	mov    $0x0,%eax
+  800818:	0f 49 c1             	cmovns %ecx,%eax
+  80081b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80081e:	89 d6                	mov    %edx,%esi
+  800820:	e9 5a ff ff ff       	jmp    80077f <vprintfmt+0x5e>
+  800825:	89 d6                	mov    %edx,%esi
+  800827:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  80082e:	e9 4c ff ff ff       	jmp    80077f <vprintfmt+0x5e>
+  800833:	89 d6                	mov    %edx,%esi
+  800835:	eb bf                	jmp    8007f6 <vprintfmt+0xd5>
+  800837:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  80083b:	89 d6                	mov    %edx,%esi
+  80083d:	e9 3d ff ff ff       	jmp    80077f <vprintfmt+0x5e>
+  800842:	89 55 10             	mov    %edx,0x10(%ebp)
+  800845:	8b 45 14             	mov    0x14(%ebp),%eax
+  800848:	8d 70 04             	lea    0x4(%eax),%esi
+  80084b:	83 ec 08             	sub    $0x8,%esp
+  80084e:	53                   	push   %ebx
+  80084f:	ff 30                	push   (%eax)
+  800851:	ff d7                	call   *%edi
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	89 75 14             	mov    %esi,0x14(%ebp)
+  800859:	e9 d4 fe ff ff       	jmp    800732 <vprintfmt+0x11>
+  80085e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800861:	8b 45 14             	mov    0x14(%ebp),%eax
+  800864:	8d 70 04             	lea    0x4(%eax),%esi
+  800867:	8b 10                	mov    (%eax),%edx
+  800869:	89 d0                	mov    %edx,%eax
+  80086b:	f7 d8                	neg    %eax
+  80086d:	0f 48 c2             	cmovs  %edx,%eax
+  800870:	83 f8 12             	cmp    $0x12,%eax
+  800873:	7f 23                	jg     800898 <vprintfmt+0x177>
+  800875:	8b 14 85 e0 47 80 00 	mov    0x8047e0(,%eax,4),%edx
+  80087c:	85 d2                	test   %edx,%edx
+  80087e:	74 18                	je     800898 <vprintfmt+0x177>
+  800880:	52                   	push   %edx
+  800881:	68 45 4a 80 00       	push   $0x804a45
+  800886:	53                   	push   %ebx
+  800887:	57                   	push   %edi
+  800888:	e8 77 fe ff ff       	call   800704 <printfmt>
+  80088d:	83 c4 10             	add    $0x10,%esp
+  800890:	89 75 14             	mov    %esi,0x14(%ebp)
+  800893:	e9 9a fe ff ff       	jmp    800732 <vprintfmt+0x11>
+  800898:	50                   	push   %eax
+  800899:	68 53 45 80 00       	push   $0x804553
+  80089e:	53                   	push   %ebx
+  80089f:	57                   	push   %edi
+  8008a0:	e8 5f fe ff ff       	call   800704 <printfmt>
+  8008a5:	83 c4 10             	add    $0x10,%esp
+  8008a8:	89 75 14             	mov    %esi,0x14(%ebp)
+  8008ab:	e9 82 fe ff ff       	jmp    800732 <vprintfmt+0x11>
+  8008b0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b6:	83 c0 04             	add    $0x4,%eax
+  8008b9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bf:	8b 00                	mov    (%eax),%eax
+  8008c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008c4:	85 c0                	test   %eax,%eax
+  8008c6:	0f 84 61 03 00 00    	je     800c2d <vprintfmt+0x50c>
+  8008cc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008d0:	7e 06                	jle    8008d8 <vprintfmt+0x1b7>
+  8008d2:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008d6:	75 29                	jne    800901 <vprintfmt+0x1e0>
+  8008d8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008db:	8d 70 01             	lea    0x1(%eax),%esi
+  8008de:	0f b6 00             	movzbl (%eax),%eax
+  8008e1:	0f be d0             	movsbl %al,%edx
+  8008e4:	85 d2                	test   %edx,%edx
+  8008e6:	0f 84 bb 00 00 00    	je     8009a7 <vprintfmt+0x286>
+  8008ec:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008ef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008f2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008f5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008f8:	eb 7a                	jmp    800974 <vprintfmt+0x253>
+  8008fa:	c7 45 d0 4c 45 80 00 	movl   $0x80454c,-0x30(%ebp)
+  800901:	83 ec 08             	sub    $0x8,%esp
+  800904:	ff 75 d4             	push   -0x2c(%ebp)
+  800907:	ff 75 d0             	push   -0x30(%ebp)
+  80090a:	e8 e0 03 00 00       	call   800cef <strnlen>
+  80090f:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800912:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800915:	83 c4 10             	add    $0x10,%esp
+  800918:	85 d2                	test   %edx,%edx
+  80091a:	0f 8e d6 02 00 00    	jle    800bf6 <vprintfmt+0x4d5>
+  800920:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	53                   	push   %ebx
+  800928:	56                   	push   %esi
+  800929:	ff d7                	call   *%edi
+  80092b:	83 c4 10             	add    $0x10,%esp
+  80092e:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800932:	75 f0                	jne    800924 <vprintfmt+0x203>
+  800934:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800937:	8d 70 01             	lea    0x1(%eax),%esi
+  80093a:	0f b6 00             	movzbl (%eax),%eax
+  80093d:	0f be d0             	movsbl %al,%edx
+  800940:	85 d2                	test   %edx,%edx
+  800942:	0f 84 da 02 00 00    	je     800c22 <vprintfmt+0x501>
+  800948:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80094b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80094e:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800951:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800954:	eb 1e                	jmp    800974 <vprintfmt+0x253>
+  800956:	83 ec 08             	sub    $0x8,%esp
+  800959:	ff 75 0c             	push   0xc(%ebp)
+  80095c:	52                   	push   %edx
+  80095d:	ff 55 08             	call   *0x8(%ebp)
+  800960:	83 c4 10             	add    $0x10,%esp
+  800963:	83 eb 01             	sub    $0x1,%ebx
+  800966:	83 c6 01             	add    $0x1,%esi
+  800969:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80096d:	0f be d0             	movsbl %al,%edx
+  800970:	85 d2                	test   %edx,%edx
+  800972:	74 2a                	je     80099e <vprintfmt+0x27d>
+  800974:	85 ff                	test   %edi,%edi
+  800976:	78 05                	js     80097d <vprintfmt+0x25c>
+  800978:	83 ef 01             	sub    $0x1,%edi
+  80097b:	78 59                	js     8009d6 <vprintfmt+0x2b5>
+  80097d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800981:	74 d3                	je     800956 <vprintfmt+0x235>
+  800983:	0f be c0             	movsbl %al,%eax
+  800986:	83 e8 20             	sub    $0x20,%eax
+  800989:	83 f8 5e             	cmp    $0x5e,%eax
+  80098c:	76 c8                	jbe    800956 <vprintfmt+0x235>
+  80098e:	83 ec 08             	sub    $0x8,%esp
+  800991:	ff 75 0c             	push   0xc(%ebp)
+  800994:	6a 3f                	push   $0x3f
+  800996:	ff 55 08             	call   *0x8(%ebp)
+  800999:	83 c4 10             	add    $0x10,%esp
+  80099c:	eb c5                	jmp    800963 <vprintfmt+0x242>
+  80099e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009a7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8009aa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009ae:	7e 1b                	jle    8009cb <vprintfmt+0x2aa>
+  8009b0:	83 ec 08             	sub    $0x8,%esp
+  8009b3:	53                   	push   %ebx
+  8009b4:	6a 20                	push   $0x20
+  8009b6:	ff d7                	call   *%edi
+  8009b8:	83 c4 10             	add    $0x10,%esp
+  8009bb:	83 ee 01             	sub    $0x1,%esi
+  8009be:	75 f0                	jne    8009b0 <vprintfmt+0x28f>
+  8009c0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009c6:	e9 67 fd ff ff       	jmp    800732 <vprintfmt+0x11>
+  8009cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d1:	e9 5c fd ff ff       	jmp    800732 <vprintfmt+0x11>
+  8009d6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009df:	eb c6                	jmp    8009a7 <vprintfmt+0x286>
+  8009e1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009e4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009e7:	83 f9 01             	cmp    $0x1,%ecx
+  8009ea:	7f 1f                	jg     800a0b <vprintfmt+0x2ea>
+  8009ec:	85 c9                	test   %ecx,%ecx
+  8009ee:	74 67                	je     800a57 <vprintfmt+0x336>
+  8009f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f3:	8b 30                	mov    (%eax),%esi
+  8009f5:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8009f8:	89 f0                	mov    %esi,%eax
+  8009fa:	c1 f8 1f             	sar    $0x1f,%eax
+  8009fd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a00:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a03:	8d 40 04             	lea    0x4(%eax),%eax
+  800a06:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a09:	eb 17                	jmp    800a22 <vprintfmt+0x301>
+  800a0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0e:	8b 50 04             	mov    0x4(%eax),%edx
+  800a11:	8b 00                	mov    (%eax),%eax
+  800a13:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a16:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1c:	8d 40 08             	lea    0x8(%eax),%eax
+  800a1f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a22:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a25:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a28:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a2d:	85 c9                	test   %ecx,%ecx
+  800a2f:	0f 89 12 01 00 00    	jns    800b47 <vprintfmt+0x426>
+  800a35:	83 ec 08             	sub    $0x8,%esp
+  800a38:	53                   	push   %ebx
+  800a39:	6a 2d                	push   $0x2d
+  800a3b:	ff d7                	call   *%edi
+  800a3d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a40:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a43:	f7 da                	neg    %edx
+  800a45:	83 d1 00             	adc    $0x0,%ecx
+  800a48:	f7 d9                	neg    %ecx
+  800a4a:	83 c4 10             	add    $0x10,%esp
+  800a4d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a52:	e9 f0 00 00 00       	jmp    800b47 <vprintfmt+0x426>
+  800a57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5a:	8b 30                	mov    (%eax),%esi
+  800a5c:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a5f:	89 f0                	mov    %esi,%eax
+  800a61:	c1 f8 1f             	sar    $0x1f,%eax
+  800a64:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a70:	eb b0                	jmp    800a22 <vprintfmt+0x301>
+  800a72:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a75:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a78:	83 f9 01             	cmp    $0x1,%ecx
+  800a7b:	7f 1e                	jg     800a9b <vprintfmt+0x37a>
+  800a7d:	85 c9                	test   %ecx,%ecx
+  800a7f:	74 32                	je     800ab3 <vprintfmt+0x392>
+  800a81:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a84:	8b 10                	mov    (%eax),%edx
+  800a86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a8e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a91:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a96:	e9 ac 00 00 00       	jmp    800b47 <vprintfmt+0x426>
+  800a9b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9e:	8b 10                	mov    (%eax),%edx
+  800aa0:	8b 48 04             	mov    0x4(%eax),%ecx
+  800aa3:	8d 40 08             	lea    0x8(%eax),%eax
+  800aa6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa9:	be 0a 00 00 00       	mov    $0xa,%esi
+  800aae:	e9 94 00 00 00       	jmp    800b47 <vprintfmt+0x426>
+  800ab3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab6:	8b 10                	mov    (%eax),%edx
+  800ab8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abd:	8d 40 04             	lea    0x4(%eax),%eax
+  800ac0:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac3:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ac8:	eb 7d                	jmp    800b47 <vprintfmt+0x426>
+  800aca:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800acd:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ad0:	83 f9 01             	cmp    $0x1,%ecx
+  800ad3:	7f 1b                	jg     800af0 <vprintfmt+0x3cf>
+  800ad5:	85 c9                	test   %ecx,%ecx
+  800ad7:	74 2c                	je     800b05 <vprintfmt+0x3e4>
+  800ad9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800adc:	8b 10                	mov    (%eax),%edx
+  800ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae3:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae6:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ae9:	be 08 00 00 00       	mov    $0x8,%esi
+  800aee:	eb 57                	jmp    800b47 <vprintfmt+0x426>
+  800af0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af3:	8b 10                	mov    (%eax),%edx
+  800af5:	8b 48 04             	mov    0x4(%eax),%ecx
+  800af8:	8d 40 08             	lea    0x8(%eax),%eax
+  800afb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800afe:	be 08 00 00 00       	mov    $0x8,%esi
+  800b03:	eb 42                	jmp    800b47 <vprintfmt+0x426>
+  800b05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b08:	8b 10                	mov    (%eax),%edx
+  800b0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b0f:	8d 40 04             	lea    0x4(%eax),%eax
+  800b12:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b15:	be 08 00 00 00       	mov    $0x8,%esi
+  800b1a:	eb 2b                	jmp    800b47 <vprintfmt+0x426>
+  800b1c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b1f:	83 ec 08             	sub    $0x8,%esp
+  800b22:	53                   	push   %ebx
+  800b23:	6a 30                	push   $0x30
+  800b25:	ff d7                	call   *%edi
+  800b27:	83 c4 08             	add    $0x8,%esp
+  800b2a:	53                   	push   %ebx
+  800b2b:	6a 78                	push   $0x78
+  800b2d:	ff d7                	call   *%edi
+  800b2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b32:	8b 10                	mov    (%eax),%edx
+  800b34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b39:	83 c4 10             	add    $0x10,%esp
+  800b3c:	8d 40 04             	lea    0x4(%eax),%eax
+  800b3f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b42:	be 10 00 00 00       	mov    $0x10,%esi
+  800b47:	83 ec 0c             	sub    $0xc,%esp
+  800b4a:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800b4e:	50                   	push   %eax
+  800b4f:	ff 75 e4             	push   -0x1c(%ebp)
+  800b52:	56                   	push   %esi
+  800b53:	51                   	push   %ecx
+  800b54:	52                   	push   %edx
+  800b55:	89 da                	mov    %ebx,%edx
+  800b57:	89 f8                	mov    %edi,%eax
+  800b59:	e8 d8 fa ff ff       	call   800636 <printnum>
+  800b5e:	83 c4 20             	add    $0x20,%esp
+  800b61:	e9 cc fb ff ff       	jmp    800732 <vprintfmt+0x11>
+  800b66:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b69:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b6c:	83 f9 01             	cmp    $0x1,%ecx
+  800b6f:	7f 1b                	jg     800b8c <vprintfmt+0x46b>
+  800b71:	85 c9                	test   %ecx,%ecx
+  800b73:	74 2c                	je     800ba1 <vprintfmt+0x480>
+  800b75:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b78:	8b 10                	mov    (%eax),%edx
+  800b7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7f:	8d 40 04             	lea    0x4(%eax),%eax
+  800b82:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b85:	be 10 00 00 00       	mov    $0x10,%esi
+  800b8a:	eb bb                	jmp    800b47 <vprintfmt+0x426>
+  800b8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8f:	8b 10                	mov    (%eax),%edx
+  800b91:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b94:	8d 40 08             	lea    0x8(%eax),%eax
+  800b97:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b9a:	be 10 00 00 00       	mov    $0x10,%esi
+  800b9f:	eb a6                	jmp    800b47 <vprintfmt+0x426>
+  800ba1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba4:	8b 10                	mov    (%eax),%edx
+  800ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bab:	8d 40 04             	lea    0x4(%eax),%eax
+  800bae:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bb1:	be 10 00 00 00       	mov    $0x10,%esi
+  800bb6:	eb 8f                	jmp    800b47 <vprintfmt+0x426>
+  800bb8:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bbb:	83 ec 08             	sub    $0x8,%esp
+  800bbe:	53                   	push   %ebx
+  800bbf:	6a 25                	push   $0x25
+  800bc1:	ff d7                	call   *%edi
+  800bc3:	83 c4 10             	add    $0x10,%esp
+  800bc6:	e9 67 fb ff ff       	jmp    800732 <vprintfmt+0x11>
+  800bcb:	83 ec 08             	sub    $0x8,%esp
+  800bce:	53                   	push   %ebx
+  800bcf:	6a 25                	push   $0x25
+  800bd1:	ff d7                	call   *%edi
+  800bd3:	83 c4 10             	add    $0x10,%esp
+  800bd6:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800bda:	0f 84 ba fb ff ff    	je     80079a <vprintfmt+0x79>
+  800be0:	89 75 10             	mov    %esi,0x10(%ebp)
+  800be3:	89 f0                	mov    %esi,%eax
+  800be5:	83 e8 01             	sub    $0x1,%eax
+  800be8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800bec:	75 f7                	jne    800be5 <vprintfmt+0x4c4>
+  800bee:	89 45 10             	mov    %eax,0x10(%ebp)
+  800bf1:	e9 3c fb ff ff       	jmp    800732 <vprintfmt+0x11>
+  800bf6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800bf9:	8d 70 01             	lea    0x1(%eax),%esi
+  800bfc:	0f b6 00             	movzbl (%eax),%eax
+  800bff:	0f be d0             	movsbl %al,%edx
+  800c02:	85 d2                	test   %edx,%edx
+  800c04:	74 11                	je     800c17 <vprintfmt+0x4f6>
+  800c06:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c09:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c0c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c0f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c12:	e9 5d fd ff ff       	jmp    800974 <vprintfmt+0x253>
+  800c17:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c1a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c1d:	e9 10 fb ff ff       	jmp    800732 <vprintfmt+0x11>
+  800c22:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c25:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c28:	e9 05 fb ff ff       	jmp    800732 <vprintfmt+0x11>
+  800c2d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c31:	7e 0a                	jle    800c3d <vprintfmt+0x51c>
+  800c33:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800c37:	0f 85 bd fc ff ff    	jne    8008fa <vprintfmt+0x1d9>
+  800c3d:	ba 28 00 00 00       	mov    $0x28,%edx
+  800c42:	b8 28 00 00 00       	mov    $0x28,%eax
+  800c47:	be 4d 45 80 00       	mov    $0x80454d,%esi
+  800c4c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c4f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c52:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c55:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c58:	e9 17 fd ff ff       	jmp    800974 <vprintfmt+0x253>
+  800c5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c60:	5b                   	pop    %ebx
+  800c61:	5e                   	pop    %esi
+  800c62:	5f                   	pop    %edi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <vsnprintf>:
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	83 ec 18             	sub    $0x18,%esp
+  800c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c71:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c74:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c78:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c7b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	74 26                	je     800cac <vsnprintf+0x47>
+  800c86:	85 d2                	test   %edx,%edx
+  800c88:	7e 22                	jle    800cac <vsnprintf+0x47>
+  800c8a:	ff 75 14             	push   0x14(%ebp)
+  800c8d:	ff 75 10             	push   0x10(%ebp)
+  800c90:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c93:	50                   	push   %eax
+  800c94:	68 e7 06 80 00       	push   $0x8006e7
+  800c99:	e8 83 fa ff ff       	call   800721 <vprintfmt>
+  800c9e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ca1:	c6 00 00             	movb   $0x0,(%eax)
+  800ca4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ca7:	83 c4 10             	add    $0x10,%esp
+  800caa:	c9                   	leave
+  800cab:	c3                   	ret
+  800cac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb1:	eb f7                	jmp    800caa <vsnprintf+0x45>
+
+00800cb3 <snprintf>:
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	83 ec 08             	sub    $0x8,%esp
+  800cb9:	8d 45 14             	lea    0x14(%ebp),%eax
+  800cbc:	50                   	push   %eax
+  800cbd:	ff 75 10             	push   0x10(%ebp)
+  800cc0:	ff 75 0c             	push   0xc(%ebp)
+  800cc3:	ff 75 08             	push   0x8(%ebp)
+  800cc6:	e8 9a ff ff ff       	call   800c65 <vsnprintf>
+  800ccb:	c9                   	leave
+  800ccc:	c3                   	ret
+
+00800ccd <strlen>:
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd3:	80 3a 00             	cmpb   $0x0,(%edx)
+  800cd6:	74 10                	je     800ce8 <strlen+0x1b>
+  800cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdd:	83 c0 01             	add    $0x1,%eax
+  800ce0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ce4:	75 f7                	jne    800cdd <strlen+0x10>
+  800ce6:	5d                   	pop    %ebp
+  800ce7:	c3                   	ret
+  800ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ced:	eb f7                	jmp    800ce6 <strlen+0x19>
+
+00800cef <strnlen>:
+  800cef:	55                   	push   %ebp
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cf5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cf8:	85 d2                	test   %edx,%edx
+  800cfa:	74 16                	je     800d12 <strnlen+0x23>
+  800cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d01:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d05:	74 09                	je     800d10 <strnlen+0x21>
+  800d07:	83 c0 01             	add    $0x1,%eax
+  800d0a:	39 d0                	cmp    %edx,%eax
+  800d0c:	75 f3                	jne    800d01 <strnlen+0x12>
+  800d0e:	89 d0                	mov    %edx,%eax
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+  800d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d17:	eb f7                	jmp    800d10 <strnlen+0x21>
+
+00800d19 <strcpy>:
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	53                   	push   %ebx
+  800d1d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d28:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d2c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d2f:	83 c0 01             	add    $0x1,%eax
+  800d32:	84 d2                	test   %dl,%dl
+  800d34:	75 f2                	jne    800d28 <strcpy+0xf>
+  800d36:	89 c8                	mov    %ecx,%eax
+  800d38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3b:	c9                   	leave
+  800d3c:	c3                   	ret
+
+00800d3d <strcat>:
+  800d3d:	55                   	push   %ebp
+  800d3e:	89 e5                	mov    %esp,%ebp
+  800d40:	53                   	push   %ebx
+  800d41:	83 ec 10             	sub    $0x10,%esp
+  800d44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d47:	53                   	push   %ebx
+  800d48:	e8 80 ff ff ff       	call   800ccd <strlen>
+  800d4d:	83 c4 08             	add    $0x8,%esp
+  800d50:	ff 75 0c             	push   0xc(%ebp)
+  800d53:	01 d8                	add    %ebx,%eax
+  800d55:	50                   	push   %eax
+  800d56:	e8 be ff ff ff       	call   800d19 <strcpy>
+  800d5b:	89 d8                	mov    %ebx,%eax
+  800d5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d60:	c9                   	leave
+  800d61:	c3                   	ret
+
+00800d62 <strncpy>:
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	56                   	push   %esi
+  800d66:	53                   	push   %ebx
+  800d67:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d70:	85 db                	test   %ebx,%ebx
+  800d72:	74 17                	je     800d8b <strncpy+0x29>
+  800d74:	01 f3                	add    %esi,%ebx
+  800d76:	89 f0                	mov    %esi,%eax
+  800d78:	83 c0 01             	add    $0x1,%eax
+  800d7b:	0f b6 0a             	movzbl (%edx),%ecx
+  800d7e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800d81:	80 f9 01             	cmp    $0x1,%cl
+  800d84:	83 da ff             	sbb    $0xffffffff,%edx
+  800d87:	39 c3                	cmp    %eax,%ebx
+  800d89:	75 ed                	jne    800d78 <strncpy+0x16>
+  800d8b:	89 f0                	mov    %esi,%eax
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5d                   	pop    %ebp
+  800d90:	c3                   	ret
+
+00800d91 <strlcpy>:
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  800d96:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9f:	89 f0                	mov    %esi,%eax
+  800da1:	85 db                	test   %ebx,%ebx
+  800da3:	74 1e                	je     800dc3 <strlcpy+0x32>
+  800da5:	83 eb 01             	sub    $0x1,%ebx
+  800da8:	74 16                	je     800dc0 <strlcpy+0x2f>
+  800daa:	01 f3                	add    %esi,%ebx
+  800dac:	0f b6 0a             	movzbl (%edx),%ecx
+  800daf:	84 c9                	test   %cl,%cl
+  800db1:	74 0d                	je     800dc0 <strlcpy+0x2f>
+  800db3:	83 c2 01             	add    $0x1,%edx
+  800db6:	83 c0 01             	add    $0x1,%eax
+  800db9:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800dbc:	39 d8                	cmp    %ebx,%eax
+  800dbe:	75 ec                	jne    800dac <strlcpy+0x1b>
+  800dc0:	c6 00 00             	movb   $0x0,(%eax)
+  800dc3:	29 f0                	sub    %esi,%eax
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+
+00800dc9 <strcmp>:
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800dd2:	0f b6 01             	movzbl (%ecx),%eax
+  800dd5:	84 c0                	test   %al,%al
+  800dd7:	74 11                	je     800dea <strcmp+0x21>
+  800dd9:	38 02                	cmp    %al,(%edx)
+  800ddb:	75 0d                	jne    800dea <strcmp+0x21>
+  800ddd:	83 c1 01             	add    $0x1,%ecx
+  800de0:	83 c2 01             	add    $0x1,%edx
+  800de3:	0f b6 01             	movzbl (%ecx),%eax
+  800de6:	84 c0                	test   %al,%al
+  800de8:	75 ef                	jne    800dd9 <strcmp+0x10>
+  800dea:	0f b6 c0             	movzbl %al,%eax
+  800ded:	0f b6 12             	movzbl (%edx),%edx
+  800df0:	29 d0                	sub    %edx,%eax
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <strncmp>:
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	53                   	push   %ebx
+  800df8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dfb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800dfe:	8b 55 10             	mov    0x10(%ebp),%edx
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e06:	85 d2                	test   %edx,%edx
+  800e08:	74 2e                	je     800e38 <strncmp+0x44>
+  800e0a:	0f b6 01             	movzbl (%ecx),%eax
+  800e0d:	84 c0                	test   %al,%al
+  800e0f:	74 16                	je     800e27 <strncmp+0x33>
+  800e11:	3a 03                	cmp    (%ebx),%al
+  800e13:	75 12                	jne    800e27 <strncmp+0x33>
+  800e15:	83 c1 01             	add    $0x1,%ecx
+  800e18:	83 c3 01             	add    $0x1,%ebx
+  800e1b:	83 ea 01             	sub    $0x1,%edx
+  800e1e:	75 ea                	jne    800e0a <strncmp+0x16>
+  800e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e25:	eb 11                	jmp    800e38 <strncmp+0x44>
+  800e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2c:	85 d2                	test   %edx,%edx
+  800e2e:	74 08                	je     800e38 <strncmp+0x44>
+  800e30:	0f b6 01             	movzbl (%ecx),%eax
+  800e33:	0f b6 13             	movzbl (%ebx),%edx
+  800e36:	29 d0                	sub    %edx,%eax
+  800e38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e3b:	c9                   	leave
+  800e3c:	c3                   	ret
+
+00800e3d <strchr>:
+  800e3d:	55                   	push   %ebp
+  800e3e:	89 e5                	mov    %esp,%ebp
+  800e40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e43:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800e47:	0f b6 10             	movzbl (%eax),%edx
+  800e4a:	84 d2                	test   %dl,%dl
+  800e4c:	74 15                	je     800e63 <strchr+0x26>
+  800e4e:	38 d1                	cmp    %dl,%cl
+  800e50:	74 0f                	je     800e61 <strchr+0x24>
+  800e52:	83 c0 01             	add    $0x1,%eax
+  800e55:	0f b6 10             	movzbl (%eax),%edx
+  800e58:	84 d2                	test   %dl,%dl
+  800e5a:	75 f2                	jne    800e4e <strchr+0x11>
+  800e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+  800e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e68:	eb f7                	jmp    800e61 <strchr+0x24>
+
+00800e6a <strfind>:
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	53                   	push   %ebx
+  800e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e71:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e74:	0f b6 18             	movzbl (%eax),%ebx
+  800e77:	38 d3                	cmp    %dl,%bl
+  800e79:	74 14                	je     800e8f <strfind+0x25>
+  800e7b:	89 d1                	mov    %edx,%ecx
+  800e7d:	84 db                	test   %bl,%bl
+  800e7f:	74 0e                	je     800e8f <strfind+0x25>
+  800e81:	83 c0 01             	add    $0x1,%eax
+  800e84:	0f b6 10             	movzbl (%eax),%edx
+  800e87:	38 ca                	cmp    %cl,%dl
+  800e89:	74 04                	je     800e8f <strfind+0x25>
+  800e8b:	84 d2                	test   %dl,%dl
+  800e8d:	75 f2                	jne    800e81 <strfind+0x17>
+  800e8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e92:	c9                   	leave
+  800e93:	c3                   	ret
+
+00800e94 <memset>:
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e9b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800e9e:	85 c9                	test   %ecx,%ecx
+  800ea0:	74 20                	je     800ec2 <memset+0x2e>
+  800ea2:	89 f8                	mov    %edi,%eax
+  800ea4:	09 c8                	or     %ecx,%eax
+  800ea6:	a8 03                	test   $0x3,%al
+  800ea8:	75 12                	jne    800ebc <memset+0x28>
+  800eaa:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800eae:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800eb4:	c1 e9 02             	shr    $0x2,%ecx
+  800eb7:	fc                   	cld
+  800eb8:	f3 ab                	rep stos %eax,%es:(%edi)
+  800eba:	eb 06                	jmp    800ec2 <memset+0x2e>
+  800ebc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ebf:	fc                   	cld
+  800ec0:	f3 aa                	rep stos %al,%es:(%edi)
+  800ec2:	89 f8                	mov    %edi,%eax
+  800ec4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ec7:	c9                   	leave
+  800ec8:	c3                   	ret
+
+00800ec9 <memmove>:
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	56                   	push   %esi
+  800ece:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ed4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ed7:	39 c6                	cmp    %eax,%esi
+  800ed9:	73 32                	jae    800f0d <memmove+0x44>
+  800edb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ede:	39 d0                	cmp    %edx,%eax
+  800ee0:	73 2b                	jae    800f0d <memmove+0x44>
+  800ee2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800ee5:	89 d6                	mov    %edx,%esi
+  800ee7:	09 fe                	or     %edi,%esi
+  800ee9:	09 ce                	or     %ecx,%esi
+  800eeb:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ef1:	75 0e                	jne    800f01 <memmove+0x38>
+  800ef3:	83 ef 04             	sub    $0x4,%edi
+  800ef6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ef9:	c1 e9 02             	shr    $0x2,%ecx
+  800efc:	fd                   	std
+  800efd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eff:	eb 09                	jmp    800f0a <memmove+0x41>
+  800f01:	83 ef 01             	sub    $0x1,%edi
+  800f04:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800f07:	fd                   	std
+  800f08:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800f0a:	fc                   	cld
+  800f0b:	eb 1a                	jmp    800f27 <memmove+0x5e>
+  800f0d:	89 f2                	mov    %esi,%edx
+  800f0f:	09 c2                	or     %eax,%edx
+  800f11:	09 ca                	or     %ecx,%edx
+  800f13:	f6 c2 03             	test   $0x3,%dl
+  800f16:	75 0a                	jne    800f22 <memmove+0x59>
+  800f18:	c1 e9 02             	shr    $0x2,%ecx
+  800f1b:	89 c7                	mov    %eax,%edi
+  800f1d:	fc                   	cld
+  800f1e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f20:	eb 05                	jmp    800f27 <memmove+0x5e>
+  800f22:	89 c7                	mov    %eax,%edi
+  800f24:	fc                   	cld
+  800f25:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <memcpy>:
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  800f31:	ff 75 10             	push   0x10(%ebp)
+  800f34:	ff 75 0c             	push   0xc(%ebp)
+  800f37:	ff 75 08             	push   0x8(%ebp)
+  800f3a:	e8 8a ff ff ff       	call   800ec9 <memmove>
+  800f3f:	c9                   	leave
+  800f40:	c3                   	ret
+
+00800f41 <memcmp>:
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  800f46:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f4c:	8b 75 10             	mov    0x10(%ebp),%esi
+  800f4f:	85 f6                	test   %esi,%esi
+  800f51:	74 29                	je     800f7c <memcmp+0x3b>
+  800f53:	01 c6                	add    %eax,%esi
+  800f55:	0f b6 08             	movzbl (%eax),%ecx
+  800f58:	0f b6 1a             	movzbl (%edx),%ebx
+  800f5b:	38 d9                	cmp    %bl,%cl
+  800f5d:	75 11                	jne    800f70 <memcmp+0x2f>
+  800f5f:	83 c0 01             	add    $0x1,%eax
+  800f62:	83 c2 01             	add    $0x1,%edx
+  800f65:	39 c6                	cmp    %eax,%esi
+  800f67:	75 ec                	jne    800f55 <memcmp+0x14>
+  800f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6e:	eb 08                	jmp    800f78 <memcmp+0x37>
+  800f70:	0f b6 c1             	movzbl %cl,%eax
+  800f73:	0f b6 db             	movzbl %bl,%ebx
+  800f76:	29 d8                	sub    %ebx,%eax
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+  800f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f81:	eb f5                	jmp    800f78 <memcmp+0x37>
+
+00800f83 <memfind>:
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8c:	89 c2                	mov    %eax,%edx
+  800f8e:	03 55 10             	add    0x10(%ebp),%edx
+  800f91:	39 d0                	cmp    %edx,%eax
+  800f93:	73 0d                	jae    800fa2 <memfind+0x1f>
+  800f95:	38 08                	cmp    %cl,(%eax)
+  800f97:	74 0d                	je     800fa6 <memfind+0x23>
+  800f99:	83 c0 01             	add    $0x1,%eax
+  800f9c:	39 c2                	cmp    %eax,%edx
+  800f9e:	75 f5                	jne    800f95 <memfind+0x12>
+  800fa0:	eb 06                	jmp    800fa8 <memfind+0x25>
+  800fa2:	89 c2                	mov    %eax,%edx
+  800fa4:	eb 02                	jmp    800fa8 <memfind+0x25>
+  800fa6:	89 c2                	mov    %eax,%edx
+  800fa8:	89 d0                	mov    %edx,%eax
+  800faa:	5d                   	pop    %ebp
+  800fab:	c3                   	ret
+
+00800fac <strtol>:
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb8:	0f b6 02             	movzbl (%edx),%eax
+  800fbb:	3c 20                	cmp    $0x20,%al
+  800fbd:	74 04                	je     800fc3 <strtol+0x17>
+  800fbf:	3c 09                	cmp    $0x9,%al
+  800fc1:	75 0e                	jne    800fd1 <strtol+0x25>
+  800fc3:	83 c2 01             	add    $0x1,%edx
+  800fc6:	0f b6 02             	movzbl (%edx),%eax
+  800fc9:	3c 20                	cmp    $0x20,%al
+  800fcb:	74 f6                	je     800fc3 <strtol+0x17>
+  800fcd:	3c 09                	cmp    $0x9,%al
+  800fcf:	74 f2                	je     800fc3 <strtol+0x17>
+  800fd1:	3c 2b                	cmp    $0x2b,%al
+  800fd3:	74 2a                	je     800fff <strtol+0x53>
+  800fd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fda:	3c 2d                	cmp    $0x2d,%al
+  800fdc:	74 2b                	je     801009 <strtol+0x5d>
+  800fde:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800fe4:	75 0f                	jne    800ff5 <strtol+0x49>
+  800fe6:	80 3a 30             	cmpb   $0x30,(%edx)
+  800fe9:	74 28                	je     801013 <strtol+0x67>
+  800feb:	85 db                	test   %ebx,%ebx
+  800fed:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff2:	0f 44 d8             	cmove  %eax,%ebx
+  800ff5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ffa:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ffd:	eb 46                	jmp    801045 <strtol+0x99>
+  800fff:	83 c2 01             	add    $0x1,%edx
+  801002:	bf 00 00 00 00       	mov    $0x0,%edi
+  801007:	eb d5                	jmp    800fde <strtol+0x32>
+  801009:	83 c2 01             	add    $0x1,%edx
+  80100c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801011:	eb cb                	jmp    800fde <strtol+0x32>
+  801013:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801017:	74 0e                	je     801027 <strtol+0x7b>
+  801019:	85 db                	test   %ebx,%ebx
+  80101b:	75 d8                	jne    800ff5 <strtol+0x49>
+  80101d:	83 c2 01             	add    $0x1,%edx
+  801020:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801025:	eb ce                	jmp    800ff5 <strtol+0x49>
+  801027:	83 c2 02             	add    $0x2,%edx
+  80102a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80102f:	eb c4                	jmp    800ff5 <strtol+0x49>
+  801031:	0f be c0             	movsbl %al,%eax
+  801034:	83 e8 30             	sub    $0x30,%eax
+  801037:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80103a:	7d 3a                	jge    801076 <strtol+0xca>
+  80103c:	83 c2 01             	add    $0x1,%edx
+  80103f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801043:	01 c1                	add    %eax,%ecx
+  801045:	0f b6 02             	movzbl (%edx),%eax
+  801048:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80104b:	89 f3                	mov    %esi,%ebx
+  80104d:	80 fb 09             	cmp    $0x9,%bl
+  801050:	76 df                	jbe    801031 <strtol+0x85>
+  801052:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801055:	89 f3                	mov    %esi,%ebx
+  801057:	80 fb 19             	cmp    $0x19,%bl
+  80105a:	77 08                	ja     801064 <strtol+0xb8>
+  80105c:	0f be c0             	movsbl %al,%eax
+  80105f:	83 e8 57             	sub    $0x57,%eax
+  801062:	eb d3                	jmp    801037 <strtol+0x8b>
+  801064:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801067:	89 f3                	mov    %esi,%ebx
+  801069:	80 fb 19             	cmp    $0x19,%bl
+  80106c:	77 08                	ja     801076 <strtol+0xca>
+  80106e:	0f be c0             	movsbl %al,%eax
+  801071:	83 e8 37             	sub    $0x37,%eax
+  801074:	eb c1                	jmp    801037 <strtol+0x8b>
+  801076:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80107a:	74 05                	je     801081 <strtol+0xd5>
+  80107c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80107f:	89 10                	mov    %edx,(%eax)
+  801081:	89 c8                	mov    %ecx,%eax
+  801083:	f7 d8                	neg    %eax
+  801085:	85 ff                	test   %edi,%edi
+  801087:	0f 45 c8             	cmovne %eax,%ecx
+  80108a:	89 c8                	mov    %ecx,%eax
+  80108c:	5b                   	pop    %ebx
+  80108d:	5e                   	pop    %esi
+  80108e:	5f                   	pop    %edi
+  80108f:	5d                   	pop    %ebp
+  801090:	c3                   	ret
+
+00801091 <sys_cputs>:
+  801091:	55                   	push   %ebp
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	57                   	push   %edi
+  801095:	56                   	push   %esi
+  801096:	53                   	push   %ebx
+  801097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a2:	89 c3                	mov    %eax,%ebx
+  8010a4:	89 c7                	mov    %eax,%edi
+  8010a6:	89 c6                	mov    %eax,%esi
+  8010a8:	cd 30                	int    $0x30
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+
+008010af <sys_cgetc>:
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	57                   	push   %edi
+  8010b3:	56                   	push   %esi
+  8010b4:	53                   	push   %ebx
+  8010b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010bf:	89 d1                	mov    %edx,%ecx
+  8010c1:	89 d3                	mov    %edx,%ebx
+  8010c3:	89 d7                	mov    %edx,%edi
+  8010c5:	89 d6                	mov    %edx,%esi
+  8010c7:	cd 30                	int    $0x30
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+
+008010ce <sys_env_destroy>:
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+  8010d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010df:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010e4:	89 cb                	mov    %ecx,%ebx
+  8010e6:	89 cf                	mov    %ecx,%edi
+  8010e8:	89 ce                	mov    %ecx,%esi
+  8010ea:	cd 30                	int    $0x30
+  8010ec:	85 c0                	test   %eax,%eax
+  8010ee:	7f 08                	jg     8010f8 <sys_env_destroy+0x2a>
+  8010f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+  8010f8:	83 ec 0c             	sub    $0xc,%esp
+  8010fb:	50                   	push   %eax
+  8010fc:	6a 03                	push   $0x3
+  8010fe:	68 4b 48 80 00       	push   $0x80484b
+  801103:	6a 24                	push   $0x24
+  801105:	68 68 48 80 00       	push   $0x804868
+  80110a:	e8 38 f4 ff ff       	call   800547 <_panic>
+
+0080110f <sys_getenvid>:
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+  801112:	57                   	push   %edi
+  801113:	56                   	push   %esi
+  801114:	53                   	push   %ebx
+  801115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80111f:	89 d1                	mov    %edx,%ecx
+  801121:	89 d3                	mov    %edx,%ebx
+  801123:	89 d7                	mov    %edx,%edi
+  801125:	89 d6                	mov    %edx,%esi
+  801127:	cd 30                	int    $0x30
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+
+0080112e <sys_yield>:
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	53                   	push   %ebx
+  801134:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80113b:	74 26                	je     801163 <sys_yield+0x35>
+  80113d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801142:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801147:	89 d1                	mov    %edx,%ecx
+  801149:	89 d3                	mov    %edx,%ebx
+  80114b:	89 d7                	mov    %edx,%edi
+  80114d:	6a 00                	push   $0x0
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	8d 35 5a 11 80 00    	lea    0x80115a,%esi
+  801158:	0f 34                	sysenter
+  80115a:	5d                   	pop    %ebp
+  80115b:	83 c4 04             	add    $0x4,%esp
+  80115e:	5b                   	pop    %ebx
+  80115f:	5e                   	pop    %esi
+  801160:	5f                   	pop    %edi
+  801161:	5d                   	pop    %ebp
+  801162:	c3                   	ret
+  801163:	ba 00 00 00 00       	mov    $0x0,%edx
+  801168:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80116d:	89 d1                	mov    %edx,%ecx
+  80116f:	89 d3                	mov    %edx,%ebx
+  801171:	89 d7                	mov    %edx,%edi
+  801173:	89 d6                	mov    %edx,%esi
+  801175:	cd 30                	int    $0x30
+  801177:	eb e5                	jmp    80115e <sys_yield+0x30>
+
+00801179 <sys_page_alloc>:
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+  80117f:	83 ec 0c             	sub    $0xc,%esp
+  801182:	be 00 00 00 00       	mov    $0x0,%esi
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801192:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801195:	89 f7                	mov    %esi,%edi
+  801197:	cd 30                	int    $0x30
+  801199:	85 c0                	test   %eax,%eax
+  80119b:	7f 08                	jg     8011a5 <sys_page_alloc+0x2c>
+  80119d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5e                   	pop    %esi
+  8011a2:	5f                   	pop    %edi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+  8011a5:	83 ec 0c             	sub    $0xc,%esp
+  8011a8:	50                   	push   %eax
+  8011a9:	6a 04                	push   $0x4
+  8011ab:	68 4b 48 80 00       	push   $0x80484b
+  8011b0:	6a 24                	push   $0x24
+  8011b2:	68 68 48 80 00       	push   $0x804868
+  8011b7:	e8 8b f3 ff ff       	call   800547 <_panic>
+
+008011bc <sys_page_map>:
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+  8011c5:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011cc:	74 33                	je     801201 <sys_page_map+0x45>
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011df:	ff 75 18             	push   0x18(%ebp)
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  8011e5:	8d 35 ed 11 80 00    	lea    0x8011ed,%esi
+  8011eb:	0f 34                	sysenter
+  8011ed:	5d                   	pop    %ebp
+  8011ee:	83 c4 04             	add    $0x4,%esp
+  8011f1:	89 c2                	mov    %eax,%edx
+  8011f3:	85 c0                	test   %eax,%eax
+  8011f5:	7f 3d                	jg     801234 <sys_page_map+0x78>
+  8011f7:	89 d0                	mov    %edx,%eax
+  8011f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fc:	5b                   	pop    %ebx
+  8011fd:	5e                   	pop    %esi
+  8011fe:	5f                   	pop    %edi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+  801201:	b8 05 00 00 00       	mov    $0x5,%eax
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801212:	8b 75 18             	mov    0x18(%ebp),%esi
+  801215:	cd 30                	int    $0x30
+  801217:	89 c2                	mov    %eax,%edx
+  801219:	85 c0                	test   %eax,%eax
+  80121b:	7e da                	jle    8011f7 <sys_page_map+0x3b>
+  80121d:	83 ec 0c             	sub    $0xc,%esp
+  801220:	50                   	push   %eax
+  801221:	6a 05                	push   $0x5
+  801223:	68 4b 48 80 00       	push   $0x80484b
+  801228:	6a 24                	push   $0x24
+  80122a:	68 68 48 80 00       	push   $0x804868
+  80122f:	e8 13 f3 ff ff       	call   800547 <_panic>
+  801234:	83 ec 0c             	sub    $0xc,%esp
+  801237:	50                   	push   %eax
+  801238:	6a 05                	push   $0x5
+  80123a:	68 4b 48 80 00       	push   $0x80484b
+  80123f:	6a 48                	push   $0x48
+  801241:	68 68 48 80 00       	push   $0x804868
+  801246:	e8 fc f2 ff ff       	call   800547 <_panic>
+
+0080124b <sys_page_unmap>:
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+  801251:	83 ec 0c             	sub    $0xc,%esp
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801264:	89 df                	mov    %ebx,%edi
+  801266:	89 de                	mov    %ebx,%esi
+  801268:	cd 30                	int    $0x30
+  80126a:	85 c0                	test   %eax,%eax
+  80126c:	7f 08                	jg     801276 <sys_page_unmap+0x2b>
+  80126e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801271:	5b                   	pop    %ebx
+  801272:	5e                   	pop    %esi
+  801273:	5f                   	pop    %edi
+  801274:	5d                   	pop    %ebp
+  801275:	c3                   	ret
+  801276:	83 ec 0c             	sub    $0xc,%esp
+  801279:	50                   	push   %eax
+  80127a:	6a 06                	push   $0x6
+  80127c:	68 4b 48 80 00       	push   $0x80484b
+  801281:	6a 24                	push   $0x24
+  801283:	68 68 48 80 00       	push   $0x804868
+  801288:	e8 ba f2 ff ff       	call   800547 <_panic>
+
+0080128d <sys_fork>:
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	57                   	push   %edi
+  801291:	56                   	push   %esi
+  801292:	53                   	push   %ebx
+  801293:	ba 00 00 00 00       	mov    $0x0,%edx
+  801298:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80129d:	89 d1                	mov    %edx,%ecx
+  80129f:	89 d3                	mov    %edx,%ebx
+  8012a1:	89 d7                	mov    %edx,%edi
+  8012a3:	89 d6                	mov    %edx,%esi
+  8012a5:	cd 30                	int    $0x30
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+
+008012ac <sys_env_set_status>:
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+  8012b2:	83 ec 0c             	sub    $0xc,%esp
+  8012b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012c5:	89 df                	mov    %ebx,%edi
+  8012c7:	89 de                	mov    %ebx,%esi
+  8012c9:	cd 30                	int    $0x30
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	7f 08                	jg     8012d7 <sys_env_set_status+0x2b>
+  8012cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d2:	5b                   	pop    %ebx
+  8012d3:	5e                   	pop    %esi
+  8012d4:	5f                   	pop    %edi
+  8012d5:	5d                   	pop    %ebp
+  8012d6:	c3                   	ret
+  8012d7:	83 ec 0c             	sub    $0xc,%esp
+  8012da:	50                   	push   %eax
+  8012db:	6a 08                	push   $0x8
+  8012dd:	68 4b 48 80 00       	push   $0x80484b
+  8012e2:	6a 24                	push   $0x24
+  8012e4:	68 68 48 80 00       	push   $0x804868
+  8012e9:	e8 59 f2 ff ff       	call   800547 <_panic>
+
+008012ee <sys_env_set_trapframe>:
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	57                   	push   %edi
+  8012f2:	56                   	push   %esi
+  8012f3:	53                   	push   %ebx
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801302:	b8 09 00 00 00       	mov    $0x9,%eax
+  801307:	89 df                	mov    %ebx,%edi
+  801309:	89 de                	mov    %ebx,%esi
+  80130b:	cd 30                	int    $0x30
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	7f 08                	jg     801319 <sys_env_set_trapframe+0x2b>
+  801311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801314:	5b                   	pop    %ebx
+  801315:	5e                   	pop    %esi
+  801316:	5f                   	pop    %edi
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+  801319:	83 ec 0c             	sub    $0xc,%esp
+  80131c:	50                   	push   %eax
+  80131d:	6a 09                	push   $0x9
+  80131f:	68 4b 48 80 00       	push   $0x80484b
+  801324:	6a 24                	push   $0x24
+  801326:	68 68 48 80 00       	push   $0x804868
+  80132b:	e8 17 f2 ff ff       	call   800547 <_panic>
+
+00801330 <sys_env_set_cow>:
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	56                   	push   %esi
+  801335:	53                   	push   %ebx
+  801336:	83 ec 0c             	sub    $0xc,%esp
+  801339:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801341:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801344:	b8 20 00 00 00       	mov    $0x20,%eax
+  801349:	89 df                	mov    %ebx,%edi
+  80134b:	89 de                	mov    %ebx,%esi
+  80134d:	cd 30                	int    $0x30
+  80134f:	85 c0                	test   %eax,%eax
+  801351:	7f 08                	jg     80135b <sys_env_set_cow+0x2b>
+  801353:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801356:	5b                   	pop    %ebx
+  801357:	5e                   	pop    %esi
+  801358:	5f                   	pop    %edi
+  801359:	5d                   	pop    %ebp
+  80135a:	c3                   	ret
+  80135b:	83 ec 0c             	sub    $0xc,%esp
+  80135e:	50                   	push   %eax
+  80135f:	6a 20                	push   $0x20
+  801361:	68 4b 48 80 00       	push   $0x80484b
+  801366:	6a 24                	push   $0x24
+  801368:	68 68 48 80 00       	push   $0x804868
+  80136d:	e8 d5 f1 ff ff       	call   800547 <_panic>
+
+00801372 <sys_env_service>:
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	57                   	push   %edi
+  801376:	56                   	push   %esi
+  801377:	53                   	push   %ebx
+  801378:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801380:	b8 21 00 00 00       	mov    $0x21,%eax
+  801385:	89 cb                	mov    %ecx,%ebx
+  801387:	89 cf                	mov    %ecx,%edi
+  801389:	89 ce                	mov    %ecx,%esi
+  80138b:	cd 30                	int    $0x30
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+
+00801392 <sys_env_set_pgfault_upcall>:
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+  801398:	83 ec 0c             	sub    $0xc,%esp
+  80139b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013ab:	89 df                	mov    %ebx,%edi
+  8013ad:	89 de                	mov    %ebx,%esi
+  8013af:	cd 30                	int    $0x30
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	7f 08                	jg     8013bd <sys_env_set_pgfault_upcall+0x2b>
+  8013b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5f                   	pop    %edi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+  8013bd:	83 ec 0c             	sub    $0xc,%esp
+  8013c0:	50                   	push   %eax
+  8013c1:	6a 0a                	push   $0xa
+  8013c3:	68 4b 48 80 00       	push   $0x80484b
+  8013c8:	6a 24                	push   $0x24
+  8013ca:	68 68 48 80 00       	push   $0x804868
+  8013cf:	e8 73 f1 ff ff       	call   800547 <_panic>
+
+008013d4 <sys_ipc_try_send>:
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	57                   	push   %edi
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+  8013da:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8013e1:	74 27                	je     80140a <sys_ipc_try_send+0x36>
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f4:	6a 00                	push   $0x0
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	8d 35 01 14 80 00    	lea    0x801401,%esi
+  8013ff:	0f 34                	sysenter
+  801401:	5d                   	pop    %ebp
+  801402:	83 c4 04             	add    $0x4,%esp
+  801405:	5b                   	pop    %ebx
+  801406:	5e                   	pop    %esi
+  801407:	5f                   	pop    %edi
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+  80140a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80140f:	be 00 00 00 00       	mov    $0x0,%esi
+  801414:	8b 55 08             	mov    0x8(%ebp),%edx
+  801417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80141d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801420:	cd 30                	int    $0x30
+  801422:	eb e1                	jmp    801405 <sys_ipc_try_send+0x31>
+
+00801424 <sys_ipc_recv>:
+  801424:	55                   	push   %ebp
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	57                   	push   %edi
+  801428:	56                   	push   %esi
+  801429:	53                   	push   %ebx
+  80142a:	83 ec 0c             	sub    $0xc,%esp
+  80142d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801434:	74 32                	je     801468 <sys_ipc_recv+0x44>
+  801436:	8b 55 08             	mov    0x8(%ebp),%edx
+  801439:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80143e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801443:	89 cb                	mov    %ecx,%ebx
+  801445:	89 cf                	mov    %ecx,%edi
+  801447:	6a 00                	push   $0x0
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	8d 35 54 14 80 00    	lea    0x801454,%esi
+  801452:	0f 34                	sysenter
+  801454:	5d                   	pop    %ebp
+  801455:	83 c4 04             	add    $0x4,%esp
+  801458:	89 c2                	mov    %eax,%edx
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	7f 3c                	jg     80149a <sys_ipc_recv+0x76>
+  80145e:	89 d0                	mov    %edx,%eax
+  801460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801463:	5b                   	pop    %ebx
+  801464:	5e                   	pop    %esi
+  801465:	5f                   	pop    %edi
+  801466:	5d                   	pop    %ebp
+  801467:	c3                   	ret
+  801468:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801472:	8b 55 08             	mov    0x8(%ebp),%edx
+  801475:	89 cb                	mov    %ecx,%ebx
+  801477:	89 cf                	mov    %ecx,%edi
+  801479:	89 ce                	mov    %ecx,%esi
+  80147b:	cd 30                	int    $0x30
+  80147d:	89 c2                	mov    %eax,%edx
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	7e db                	jle    80145e <sys_ipc_recv+0x3a>
+  801483:	83 ec 0c             	sub    $0xc,%esp
+  801486:	50                   	push   %eax
+  801487:	6a 0d                	push   $0xd
+  801489:	68 4b 48 80 00       	push   $0x80484b
+  80148e:	6a 24                	push   $0x24
+  801490:	68 68 48 80 00       	push   $0x804868
+  801495:	e8 ad f0 ff ff       	call   800547 <_panic>
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+  80149d:	50                   	push   %eax
+  80149e:	6a 0d                	push   $0xd
+  8014a0:	68 4b 48 80 00       	push   $0x80484b
+  8014a5:	6a 48                	push   $0x48
+  8014a7:	68 68 48 80 00       	push   $0x804868
+  8014ac:	e8 96 f0 ff ff       	call   800547 <_panic>
+
+008014b1 <sys_ipc_send>:
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	57                   	push   %edi
+  8014b5:	56                   	push   %esi
+  8014b6:	53                   	push   %ebx
+  8014b7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8014be:	74 27                	je     8014e7 <sys_ipc_send+0x36>
+  8014c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d1:	6a 00                	push   $0x0
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	8d 35 de 14 80 00    	lea    0x8014de,%esi
+  8014dc:	0f 34                	sysenter
+  8014de:	5d                   	pop    %ebp
+  8014df:	83 c4 04             	add    $0x4,%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+  8014e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014fd:	cd 30                	int    $0x30
+  8014ff:	eb e1                	jmp    8014e2 <sys_ipc_send+0x31>
+
+00801501 <sys_ipc_call>:
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	57                   	push   %edi
+  801505:	56                   	push   %esi
+  801506:	53                   	push   %ebx
+  801507:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801515:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801518:	8b 75 18             	mov    0x18(%ebp),%esi
+  80151b:	cd 30                	int    $0x30
+  80151d:	5b                   	pop    %ebx
+  80151e:	5e                   	pop    %esi
+  80151f:	5f                   	pop    %edi
+  801520:	5d                   	pop    %ebp
+  801521:	c3                   	ret
+
+00801522 <sys_ipc_reply_recv>:
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	57                   	push   %edi
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+  801528:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801533:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801536:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801539:	8b 75 18             	mov    0x18(%ebp),%esi
+  80153c:	cd 30                	int    $0x30
+  80153e:	5b                   	pop    %ebx
+  80153f:	5e                   	pop    %esi
+  801540:	5f                   	pop    %edi
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+
+00801543 <sys_time_msec>:
+  801543:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  801548:	85 c0                	test   %eax,%eax
+  80154a:	75 06                	jne    801552 <sys_time_msec+0xf>
+  80154c:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801551:	c3                   	ret
+  801552:	55                   	push   %ebp
+  801553:	89 e5                	mov    %esp,%ebp
+  801555:	57                   	push   %edi
+  801556:	56                   	push   %esi
+  801557:	53                   	push   %ebx
+  801558:	83 ec 0c             	sub    $0xc,%esp
+  80155b:	0f 31                	rdtsc
+  80155d:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801563:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801569:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  80156f:	29 c8                	sub    %ecx,%eax
+  801571:	19 da                	sbb    %ebx,%edx
+  801573:	bf 00 00 00 00       	mov    $0x0,%edi
+  801578:	57                   	push   %edi
+  801579:	56                   	push   %esi
+  80157a:	52                   	push   %edx
+  80157b:	50                   	push   %eax
+  80157c:	e8 cd 2c 00 00       	call   80424e <__udivdi3>
+  801581:	83 c4 10             	add    $0x10,%esp
+  801584:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801587:	5b                   	pop    %ebx
+  801588:	5e                   	pop    %esi
+  801589:	5f                   	pop    %edi
+  80158a:	5d                   	pop    %ebp
+  80158b:	c3                   	ret
+
+0080158c <sys_env_swap>:
+  80158c:	55                   	push   %ebp
+  80158d:	89 e5                	mov    %esp,%ebp
+  80158f:	57                   	push   %edi
+  801590:	56                   	push   %esi
+  801591:	53                   	push   %ebx
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159d:	b8 12 00 00 00       	mov    $0x12,%eax
+  8015a2:	89 cb                	mov    %ecx,%ebx
+  8015a4:	89 cf                	mov    %ecx,%edi
+  8015a6:	89 ce                	mov    %ecx,%esi
+  8015a8:	cd 30                	int    $0x30
+  8015aa:	85 c0                	test   %eax,%eax
+  8015ac:	7f 08                	jg     8015b6 <sys_env_swap+0x2a>
+  8015ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b1:	5b                   	pop    %ebx
+  8015b2:	5e                   	pop    %esi
+  8015b3:	5f                   	pop    %edi
+  8015b4:	5d                   	pop    %ebp
+  8015b5:	c3                   	ret
+  8015b6:	83 ec 0c             	sub    $0xc,%esp
+  8015b9:	50                   	push   %eax
+  8015ba:	6a 12                	push   $0x12
+  8015bc:	68 4b 48 80 00       	push   $0x80484b
+  8015c1:	6a 24                	push   $0x24
+  8015c3:	68 68 48 80 00       	push   $0x804868
+  8015c8:	e8 7a ef ff ff       	call   800547 <_panic>
+
+008015cd <sys_net_try_send>:
+  8015cd:	55                   	push   %ebp
+  8015ce:	89 e5                	mov    %esp,%ebp
+  8015d0:	57                   	push   %edi
+  8015d1:	56                   	push   %esi
+  8015d2:	53                   	push   %ebx
+  8015d3:	83 ec 0c             	sub    $0xc,%esp
+  8015d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	89 de                	mov    %ebx,%esi
+  8015ea:	cd 30                	int    $0x30
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	7f 08                	jg     8015f8 <sys_net_try_send+0x2b>
+  8015f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f3:	5b                   	pop    %ebx
+  8015f4:	5e                   	pop    %esi
+  8015f5:	5f                   	pop    %edi
+  8015f6:	5d                   	pop    %ebp
+  8015f7:	c3                   	ret
+  8015f8:	83 ec 0c             	sub    $0xc,%esp
+  8015fb:	50                   	push   %eax
+  8015fc:	6a 13                	push   $0x13
+  8015fe:	68 4b 48 80 00       	push   $0x80484b
+  801603:	6a 24                	push   $0x24
+  801605:	68 68 48 80 00       	push   $0x804868
+  80160a:	e8 38 ef ff ff       	call   800547 <_panic>
+
+0080160f <sys_net_try_receive>:
+  80160f:	55                   	push   %ebp
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	57                   	push   %edi
+  801613:	56                   	push   %esi
+  801614:	53                   	push   %ebx
+  801615:	83 ec 0c             	sub    $0xc,%esp
+  801618:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801620:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801623:	b8 14 00 00 00       	mov    $0x14,%eax
+  801628:	89 df                	mov    %ebx,%edi
+  80162a:	89 de                	mov    %ebx,%esi
+  80162c:	cd 30                	int    $0x30
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	7f 08                	jg     80163a <sys_net_try_receive+0x2b>
+  801632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801635:	5b                   	pop    %ebx
+  801636:	5e                   	pop    %esi
+  801637:	5f                   	pop    %edi
+  801638:	5d                   	pop    %ebp
+  801639:	c3                   	ret
+  80163a:	83 ec 0c             	sub    $0xc,%esp
+  80163d:	50                   	push   %eax
+  80163e:	6a 14                	push   $0x14
+  801640:	68 4b 48 80 00       	push   $0x80484b
+  801645:	6a 24                	push   $0x24
+  801647:	68 68 48 80 00       	push   $0x804868
+  80164c:	e8 f6 ee ff ff       	call   800547 <_panic>
+
+00801651 <sys_net_recv_page>:
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	57                   	push   %edi
+  801655:	56                   	push   %esi
+  801656:	53                   	push   %ebx
+  801657:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80165c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165f:	b8 27 00 00 00       	mov    $0x27,%eax
+  801664:	89 cb                	mov    %ecx,%ebx
+  801666:	89 cf                	mov    %ecx,%edi
+  801668:	89 ce                	mov    %ecx,%esi
+  80166a:	cd 30                	int    $0x30
+  80166c:	5b                   	pop    %ebx
+  80166d:	5e                   	pop    %esi
+  80166e:	5f                   	pop    %edi
+  80166f:	5d                   	pop    %ebp
+  801670:	c3                   	ret
+
+00801671 <sys_net_wait>:
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	57                   	push   %edi
+  801675:	56                   	push   %esi
+  801676:	53                   	push   %ebx
+  801677:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167c:	b8 26 00 00 00       	mov    $0x26,%eax
+  801681:	89 d1                	mov    %edx,%ecx
+  801683:	89 d3                	mov    %edx,%ebx
+  801685:	89 d7                	mov    %edx,%edi
+  801687:	89 d6                	mov    %edx,%esi
+  801689:	cd 30                	int    $0x30
+  80168b:	5b                   	pop    %ebx
+  80168c:	5e                   	pop    %esi
+  80168d:	5f                   	pop    %edi
+  80168e:	5d                   	pop    %ebp
+  80168f:	c3                   	ret
+
+00801690 <sys_get_mac>:
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	57                   	push   %edi
+  801694:	56                   	push   %esi
+  801695:	53                   	push   %ebx
+  801696:	83 ec 0c             	sub    $0xc,%esp
+  801699:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8016a9:	89 df                	mov    %ebx,%edi
+  8016ab:	89 de                	mov    %ebx,%esi
+  8016ad:	cd 30                	int    $0x30
+  8016af:	85 c0                	test   %eax,%eax
+  8016b1:	7f 08                	jg     8016bb <sys_get_mac+0x2b>
+  8016b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b6:	5b                   	pop    %ebx
+  8016b7:	5e                   	pop    %esi
+  8016b8:	5f                   	pop    %edi
+  8016b9:	5d                   	pop    %ebp
+  8016ba:	c3                   	ret
+  8016bb:	83 ec 0c             	sub    $0xc,%esp
+  8016be:	50                   	push   %eax
+  8016bf:	6a 15                	push   $0x15
+  8016c1:	68 4b 48 80 00       	push   $0x80484b
+  8016c6:	6a 24                	push   $0x24
+  8016c8:	68 68 48 80 00       	push   $0x804868
+  8016cd:	e8 75 ee ff ff       	call   800547 <_panic>
+
+008016d2 <sys_env_lease>:
+  8016d2:	55                   	push   %ebp
+  8016d3:	89 e5                	mov    %esp,%ebp
+  8016d5:	57                   	push   %edi
+  8016d6:	56                   	push   %esi
+  8016d7:	53                   	push   %ebx
+  8016d8:	83 ec 0c             	sub    $0xc,%esp
+  8016db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e6:	b8 16 00 00 00       	mov    $0x16,%eax
+  8016eb:	89 df                	mov    %ebx,%edi
+  8016ed:	89 de                	mov    %ebx,%esi
+  8016ef:	cd 30                	int    $0x30
+  8016f1:	85 c0                	test   %eax,%eax
+  8016f3:	7f 08                	jg     8016fd <sys_env_lease+0x2b>
+  8016f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f8:	5b                   	pop    %ebx
+  8016f9:	5e                   	pop    %esi
+  8016fa:	5f                   	pop    %edi
+  8016fb:	5d                   	pop    %ebp
+  8016fc:	c3                   	ret
+  8016fd:	83 ec 0c             	sub    $0xc,%esp
+  801700:	50                   	push   %eax
+  801701:	6a 16                	push   $0x16
+  801703:	68 4b 48 80 00       	push   $0x80484b
+  801708:	6a 24                	push   $0x24
+  80170a:	68 68 48 80 00       	push   $0x804868
+  80170f:	e8 33 ee ff ff       	call   800547 <_panic>
+
+00801714 <sys_copy_mem>:
+  801714:	55                   	push   %ebp
+  801715:	89 e5                	mov    %esp,%ebp
+  801717:	57                   	push   %edi
+  801718:	56                   	push   %esi
+  801719:	53                   	push   %ebx
+  80171a:	83 ec 0c             	sub    $0xc,%esp
+  80171d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801720:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801723:	b8 17 00 00 00       	mov    $0x17,%eax
+  801728:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80172b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80172e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801731:	cd 30                	int    $0x30
+  801733:	85 c0                	test   %eax,%eax
+  801735:	7f 08                	jg     80173f <sys_copy_mem+0x2b>
+  801737:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5e                   	pop    %esi
+  80173c:	5f                   	pop    %edi
+  80173d:	5d                   	pop    %ebp
+  80173e:	c3                   	ret
+  80173f:	83 ec 0c             	sub    $0xc,%esp
+  801742:	50                   	push   %eax
+  801743:	6a 17                	push   $0x17
+  801745:	68 4b 48 80 00       	push   $0x80484b
+  80174a:	6a 24                	push   $0x24
+  80174c:	68 68 48 80 00       	push   $0x804868
+  801751:	e8 f1 ed ff ff       	call   800547 <_panic>
+
+00801756 <sys_get_perms>:
+  801756:	55                   	push   %ebp
+  801757:	89 e5                	mov    %esp,%ebp
+  801759:	57                   	push   %edi
+  80175a:	56                   	push   %esi
+  80175b:	53                   	push   %ebx
+  80175c:	83 ec 0c             	sub    $0xc,%esp
+  80175f:	be 00 00 00 00       	mov    $0x0,%esi
+  801764:	8b 55 08             	mov    0x8(%ebp),%edx
+  801767:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80176f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801772:	89 f7                	mov    %esi,%edi
+  801774:	cd 30                	int    $0x30
+  801776:	85 c0                	test   %eax,%eax
+  801778:	7f 08                	jg     801782 <sys_get_perms+0x2c>
+  80177a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177d:	5b                   	pop    %ebx
+  80177e:	5e                   	pop    %esi
+  80177f:	5f                   	pop    %edi
+  801780:	5d                   	pop    %ebp
+  801781:	c3                   	ret
+  801782:	83 ec 0c             	sub    $0xc,%esp
+  801785:	50                   	push   %eax
+  801786:	6a 18                	push   $0x18
+  801788:	68 4b 48 80 00       	push   $0x80484b
+  80178d:	6a 24                	push   $0x24
+  80178f:	68 68 48 80 00       	push   $0x804868
+  801794:	e8 ae ed ff ff       	call   800547 <_panic>
+
+00801799 <sys_env_unsuspend>:
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	57                   	push   %edi
+  80179d:	56                   	push   %esi
+  80179e:	53                   	push   %ebx
+  80179f:	83 ec 0c             	sub    $0xc,%esp
+  8017a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ad:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017b5:	89 f7                	mov    %esi,%edi
+  8017b7:	cd 30                	int    $0x30
+  8017b9:	85 c0                	test   %eax,%eax
+  8017bb:	7f 08                	jg     8017c5 <sys_env_unsuspend+0x2c>
+  8017bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c0:	5b                   	pop    %ebx
+  8017c1:	5e                   	pop    %esi
+  8017c2:	5f                   	pop    %edi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+  8017c5:	83 ec 0c             	sub    $0xc,%esp
+  8017c8:	50                   	push   %eax
+  8017c9:	6a 19                	push   $0x19
+  8017cb:	68 4b 48 80 00       	push   $0x80484b
+  8017d0:	6a 24                	push   $0x24
+  8017d2:	68 68 48 80 00       	push   $0x804868
+  8017d7:	e8 6b ed ff ff       	call   800547 <_panic>
+
+008017dc <sys_migrate>:
+  8017dc:	55                   	push   %ebp
+  8017dd:	89 e5                	mov    %esp,%ebp
+  8017df:	57                   	push   %edi
+  8017e0:	56                   	push   %esi
+  8017e1:	53                   	push   %ebx
+  8017e2:	83 ec 0c             	sub    $0xc,%esp
+  8017e5:	ba 04 90 80 00       	mov    $0x809004,%edx
+  8017ea:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  8017f0:	76 11                	jbe    801803 <sys_migrate+0x27>
+  8017f2:	b8 00 00 80 00       	mov    $0x800000,%eax
+  8017f7:	0f b6 08             	movzbl (%eax),%ecx
+  8017fa:	05 00 10 00 00       	add    $0x1000,%eax
+  8017ff:	39 d0                	cmp    %edx,%eax
+  801801:	72 f4                	jb     8017f7 <sys_migrate+0x1b>
+  801803:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801808:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801810:	89 cb                	mov    %ecx,%ebx
+  801812:	89 cf                	mov    %ecx,%edi
+  801814:	89 ce                	mov    %ecx,%esi
+  801816:	cd 30                	int    $0x30
+  801818:	85 c0                	test   %eax,%eax
+  80181a:	7f 08                	jg     801824 <sys_migrate+0x48>
+  80181c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80181f:	5b                   	pop    %ebx
+  801820:	5e                   	pop    %esi
+  801821:	5f                   	pop    %edi
+  801822:	5d                   	pop    %ebp
+  801823:	c3                   	ret
+  801824:	83 ec 0c             	sub    $0xc,%esp
+  801827:	50                   	push   %eax
+  801828:	6a 1a                	push   $0x1a
+  80182a:	68 4b 48 80 00       	push   $0x80484b
+  80182f:	6a 24                	push   $0x24
+  801831:	68 68 48 80 00       	push   $0x804868
+  801836:	e8 0c ed ff ff       	call   800547 <_panic>
+
+0080183b <sys_lease_complete>:
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	57                   	push   %edi
+  80183f:	56                   	push   %esi
+  801840:	53                   	push   %ebx
+  801841:	83 ec 0c             	sub    $0xc,%esp
+  801844:	ba 00 00 00 00       	mov    $0x0,%edx
+  801849:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80184e:	89 d1                	mov    %edx,%ecx
+  801850:	89 d3                	mov    %edx,%ebx
+  801852:	89 d7                	mov    %edx,%edi
+  801854:	89 d6                	mov    %edx,%esi
+  801856:	cd 30                	int    $0x30
+  801858:	85 c0                	test   %eax,%eax
+  80185a:	7f 08                	jg     801864 <sys_lease_complete+0x29>
+  80185c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80185f:	5b                   	pop    %ebx
+  801860:	5e                   	pop    %esi
+  801861:	5f                   	pop    %edi
+  801862:	5d                   	pop    %ebp
+  801863:	c3                   	ret
+  801864:	83 ec 0c             	sub    $0xc,%esp
+  801867:	50                   	push   %eax
+  801868:	6a 1b                	push   $0x1b
+  80186a:	68 4b 48 80 00       	push   $0x80484b
+  80186f:	6a 24                	push   $0x24
+  801871:	68 68 48 80 00       	push   $0x804868
+  801876:	e8 cc ec ff ff       	call   800547 <_panic>
+
+0080187b <sys_env_set_thisenv>:
+  80187b:	55                   	push   %ebp
+  80187c:	89 e5                	mov    %esp,%ebp
+  80187e:	57                   	push   %edi
+  80187f:	56                   	push   %esi
+  801880:	53                   	push   %ebx
+  801881:	83 ec 0c             	sub    $0xc,%esp
+  801884:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801889:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80188f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801894:	89 df                	mov    %ebx,%edi
+  801896:	89 de                	mov    %ebx,%esi
+  801898:	cd 30                	int    $0x30
+  80189a:	85 c0                	test   %eax,%eax
+  80189c:	7f 08                	jg     8018a6 <sys_env_set_thisenv+0x2b>
+  80189e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a1:	5b                   	pop    %ebx
+  8018a2:	5e                   	pop    %esi
+  8018a3:	5f                   	pop    %edi
+  8018a4:	5d                   	pop    %ebp
+  8018a5:	c3                   	ret
+  8018a6:	83 ec 0c             	sub    $0xc,%esp
+  8018a9:	50                   	push   %eax
+  8018aa:	6a 1c                	push   $0x1c
+  8018ac:	68 4b 48 80 00       	push   $0x80484b
+  8018b1:	6a 24                	push   $0x24
+  8018b3:	68 68 48 80 00       	push   $0x804868
+  8018b8:	e8 8a ec ff ff       	call   800547 <_panic>
+
+008018bd <sys_env_set_sched>:
+  8018bd:	55                   	push   %ebp
+  8018be:	89 e5                	mov    %esp,%ebp
+  8018c0:	57                   	push   %edi
+  8018c1:	56                   	push   %esi
+  8018c2:	53                   	push   %ebx
+  8018c3:	83 ec 0c             	sub    $0xc,%esp
+  8018c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8018d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018d9:	89 f7                	mov    %esi,%edi
+  8018db:	cd 30                	int    $0x30
+  8018dd:	85 c0                	test   %eax,%eax
+  8018df:	7f 08                	jg     8018e9 <sys_env_set_sched+0x2c>
+  8018e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e4:	5b                   	pop    %ebx
+  8018e5:	5e                   	pop    %esi
+  8018e6:	5f                   	pop    %edi
+  8018e7:	5d                   	pop    %ebp
+  8018e8:	c3                   	ret
+  8018e9:	83 ec 0c             	sub    $0xc,%esp
+  8018ec:	50                   	push   %eax
+  8018ed:	6a 1d                	push   $0x1d
+  8018ef:	68 4b 48 80 00       	push   $0x80484b
+  8018f4:	6a 24                	push   $0x24
+  8018f6:	68 68 48 80 00       	push   $0x804868
+  8018fb:	e8 47 ec ff ff       	call   800547 <_panic>
+
+00801900 <sys_batch>:
+  801900:	55                   	push   %ebp
+  801901:	89 e5                	mov    %esp,%ebp
+  801903:	57                   	push   %edi
+  801904:	56                   	push   %esi
+  801905:	53                   	push   %ebx
+  801906:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801911:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801916:	89 df                	mov    %ebx,%edi
+  801918:	89 de                	mov    %ebx,%esi
+  80191a:	cd 30                	int    $0x30
+  80191c:	5b                   	pop    %ebx
+  80191d:	5e                   	pop    %esi
+  80191e:	5f                   	pop    %edi
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+
+00801921 <sys_env_stats>:
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	57                   	push   %edi
+  801925:	56                   	push   %esi
+  801926:	53                   	push   %ebx
+  801927:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801932:	b8 23 00 00 00       	mov    $0x23,%eax
+  801937:	89 df                	mov    %ebx,%edi
+  801939:	89 de                	mov    %ebx,%esi
+  80193b:	cd 30                	int    $0x30
+  80193d:	5b                   	pop    %ebx
+  80193e:	5e                   	pop    %esi
+  80193f:	5f                   	pop    %edi
+  801940:	5d                   	pop    %ebp
+  801941:	c3                   	ret
+
+00801942 <sys_trace>:
+  801942:	55                   	push   %ebp
+  801943:	89 e5                	mov    %esp,%ebp
+  801945:	57                   	push   %edi
+  801946:	56                   	push   %esi
+  801947:	53                   	push   %ebx
+  801948:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80194d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801950:	b8 24 00 00 00       	mov    $0x24,%eax
+  801955:	89 cb                	mov    %ecx,%ebx
+  801957:	89 cf                	mov    %ecx,%edi
+  801959:	89 ce                	mov    %ecx,%esi
+  80195b:	cd 30                	int    $0x30
+  80195d:	5b                   	pop    %ebx
+  80195e:	5e                   	pop    %esi
+  80195f:	5f                   	pop    %edi
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+
+00801962 <sys_env_set_pager>:
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	57                   	push   %edi
+  801966:	56                   	push   %esi
+  801967:	53                   	push   %ebx
+  801968:	83 ec 0c             	sub    $0xc,%esp
+  80196b:	be 00 00 00 00       	mov    $0x0,%esi
+  801970:	8b 55 08             	mov    0x8(%ebp),%edx
+  801973:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801976:	b8 25 00 00 00       	mov    $0x25,%eax
+  80197b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80197e:	89 f7                	mov    %esi,%edi
+  801980:	cd 30                	int    $0x30
+  801982:	85 c0                	test   %eax,%eax
+  801984:	7f 08                	jg     80198e <sys_env_set_pager+0x2c>
+  801986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801989:	5b                   	pop    %ebx
+  80198a:	5e                   	pop    %esi
+  80198b:	5f                   	pop    %edi
+  80198c:	5d                   	pop    %ebp
+  80198d:	c3                   	ret
+  80198e:	83 ec 0c             	sub    $0xc,%esp
+  801991:	50                   	push   %eax
+  801992:	6a 25                	push   $0x25
+  801994:	68 4b 48 80 00       	push   $0x80484b
+  801999:	6a 24                	push   $0x24
+  80199b:	68 68 48 80 00       	push   $0x804868
+  8019a0:	e8 a2 eb ff ff       	call   800547 <_panic>
+
+008019a5 <sys_pager_retire>:
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	57                   	push   %edi
+  8019a9:	56                   	push   %esi
+  8019aa:	53                   	push   %ebx
+  8019ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b3:	b8 28 00 00 00       	mov    $0x28,%eax
+  8019b8:	89 cb                	mov    %ecx,%ebx
+  8019ba:	89 cf                	mov    %ecx,%edi
+  8019bc:	89 ce                	mov    %ecx,%esi
+  8019be:	cd 30                	int    $0x30
+  8019c0:	5b                   	pop    %ebx
+  8019c1:	5e                   	pop    %esi
+  8019c2:	5f                   	pop    %edi
+  8019c3:	5d                   	pop    %ebp
+  8019c4:	c3                   	ret
+
+008019c5 <sys_prof>:
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+  8019c8:	57                   	push   %edi
+  8019c9:	56                   	push   %esi
+  8019ca:	53                   	push   %ebx
+  8019cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8019d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019d6:	b8 22 00 00 00       	mov    $0x22,%eax
+  8019db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019de:	89 f7                	mov    %esi,%edi
+  8019e0:	cd 30                	int    $0x30
+  8019e2:	5b                   	pop    %ebx
+  8019e3:	5e                   	pop    %esi
+  8019e4:	5f                   	pop    %edi
+  8019e5:	5d                   	pop    %ebp
+  8019e6:	c3                   	ret
+
+008019e7 <dupq_flush>:
+  8019e7:	55                   	push   %ebp
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	53                   	push   %ebx
+  8019eb:	83 ec 0c             	sub    $0xc,%esp
+  8019ee:	8b 1d 00 60 80 00    	mov    0x806000,%ebx
+  8019f4:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8019fb:	00 00 00 
+  8019fe:	53                   	push   %ebx
+  8019ff:	68 00 00 40 00       	push   $0x400000
+  801a04:	e8 f7 fe ff ff       	call   801900 <sys_batch>
+  801a09:	83 c4 10             	add    $0x10,%esp
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	78 14                	js     801a24 <dupq_flush+0x3d>
+  801a10:	39 c3                	cmp    %eax,%ebx
+  801a12:	7e 0b                	jle    801a1f <dupq_flush+0x38>
+  801a14:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801a17:	8b 80 18 00 40 00    	mov    0x400018(%eax),%eax
+  801a1d:	eb 05                	jmp    801a24 <dupq_flush+0x3d>
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a27:	c9                   	leave
+  801a28:	c3                   	ret
+
+00801a29 <pgfault>:
+  801a29:	55                   	push   %ebp
+  801a2a:	89 e5                	mov    %esp,%ebp
+  801a2c:	56                   	push   %esi
+  801a2d:	53                   	push   %ebx
+  801a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a31:	8b 30                	mov    (%eax),%esi
+  801a33:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801a37:	0f 84 83 00 00 00    	je     801ac0 <pgfault+0x97>
+  801a3d:	89 f0                	mov    %esi,%eax
+  801a3f:	c1 e8 0c             	shr    $0xc,%eax
+  801a42:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a49:	f6 c4 08             	test   $0x8,%ah
+  801a4c:	0f 84 80 00 00 00    	je     801ad2 <pgfault+0xa9>
+  801a52:	e8 b8 f6 ff ff       	call   80110f <sys_getenvid>
+  801a57:	89 c3                	mov    %eax,%ebx
+  801a59:	83 ec 04             	sub    $0x4,%esp
+  801a5c:	6a 07                	push   $0x7
+  801a5e:	68 00 f0 7f 00       	push   $0x7ff000
+  801a63:	50                   	push   %eax
+  801a64:	e8 10 f7 ff ff       	call   801179 <sys_page_alloc>
+  801a69:	83 c4 10             	add    $0x10,%esp
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	78 74                	js     801ae4 <pgfault+0xbb>
+  801a70:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801a76:	83 ec 04             	sub    $0x4,%esp
+  801a79:	68 00 10 00 00       	push   $0x1000
+  801a7e:	56                   	push   %esi
+  801a7f:	68 00 f0 7f 00       	push   $0x7ff000
+  801a84:	e8 40 f4 ff ff       	call   800ec9 <memmove>
+  801a89:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a90:	56                   	push   %esi
+  801a91:	53                   	push   %ebx
+  801a92:	68 00 f0 7f 00       	push   $0x7ff000
+  801a97:	53                   	push   %ebx
+  801a98:	e8 1f f7 ff ff       	call   8011bc <sys_page_map>
+  801a9d:	83 c4 20             	add    $0x20,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	78 54                	js     801af8 <pgfault+0xcf>
+  801aa4:	83 ec 08             	sub    $0x8,%esp
+  801aa7:	68 00 f0 7f 00       	push   $0x7ff000
+  801aac:	53                   	push   %ebx
+  801aad:	e8 99 f7 ff ff       	call   80124b <sys_page_unmap>
+  801ab2:	83 c4 10             	add    $0x10,%esp
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	78 53                	js     801b0c <pgfault+0xe3>
+  801ab9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abc:	5b                   	pop    %ebx
+  801abd:	5e                   	pop    %esi
+  801abe:	5d                   	pop    %ebp
+  801abf:	c3                   	ret
+  801ac0:	56                   	push   %esi
+  801ac1:	68 78 48 80 00       	push   $0x804878
+  801ac6:	6a 19                	push   $0x19
+  801ac8:	68 54 49 80 00       	push   $0x804954
+  801acd:	e8 75 ea ff ff       	call   800547 <_panic>
+  801ad2:	56                   	push   %esi
+  801ad3:	68 ac 48 80 00       	push   $0x8048ac
+  801ad8:	6a 1e                	push   $0x1e
+  801ada:	68 54 49 80 00       	push   $0x804954
+  801adf:	e8 63 ea ff ff       	call   800547 <_panic>
+  801ae4:	83 ec 04             	sub    $0x4,%esp
+  801ae7:	68 e0 48 80 00       	push   $0x8048e0
+  801aec:	6a 2e                	push   $0x2e
+  801aee:	68 54 49 80 00       	push   $0x804954
+  801af3:	e8 4f ea ff ff       	call   800547 <_panic>
+  801af8:	83 ec 04             	sub    $0x4,%esp
+  801afb:	68 04 49 80 00       	push   $0x804904
+  801b00:	6a 37                	push   $0x37
+  801b02:	68 54 49 80 00       	push   $0x804954
+  801b07:	e8 3b ea ff ff       	call   800547 <_panic>
+  801b0c:	83 ec 04             	sub    $0x4,%esp
+  801b0f:	68 30 49 80 00       	push   $0x804930
+  801b14:	6a 3c                	push   $0x3c
+  801b16:	68 54 49 80 00       	push   $0x804954
+  801b1b:	e8 27 ea ff ff       	call   800547 <_panic>
+
+00801b20 <dupq_begin>:
+  801b20:	55                   	push   %ebp
+  801b21:	89 e5                	mov    %esp,%ebp
+  801b23:	83 ec 0c             	sub    $0xc,%esp
+  801b26:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801b2d:	00 00 00 
+  801b30:	6a 07                	push   $0x7
+  801b32:	68 00 00 40 00       	push   $0x400000
+  801b37:	6a 00                	push   $0x0
+  801b39:	e8 3b f6 ff ff       	call   801179 <sys_page_alloc>
+  801b3e:	c9                   	leave
+  801b3f:	c3                   	ret
+
+00801b40 <dupq_map>:
+  801b40:	55                   	push   %ebp
+  801b41:	89 e5                	mov    %esp,%ebp
+  801b43:	83 ec 08             	sub    $0x8,%esp
+  801b46:	81 3d 00 60 80 00 92 	cmpl   $0x92,0x806000
+  801b4d:	00 00 00 
+  801b50:	74 46                	je     801b98 <dupq_map+0x58>
+  801b52:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  801b58:	8d 42 01             	lea    0x1(%edx),%eax
+  801b5b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b60:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  801b63:	8d 82 00 00 40 00    	lea    0x400000(%edx),%eax
+  801b69:	c7 82 00 00 40 00 05 	movl   $0x5,0x400000(%edx)
+  801b70:	00 00 00 
+  801b73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b76:	89 50 04             	mov    %edx,0x4(%eax)
+  801b79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b7c:	c1 e2 0c             	shl    $0xc,%edx
+  801b7f:	89 50 08             	mov    %edx,0x8(%eax)
+  801b82:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801b85:	89 48 0c             	mov    %ecx,0xc(%eax)
+  801b88:	89 50 10             	mov    %edx,0x10(%eax)
+  801b8b:	8b 55 14             	mov    0x14(%ebp),%edx
+  801b8e:	89 50 14             	mov    %edx,0x14(%eax)
+  801b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b96:	c9                   	leave
+  801b97:	c3                   	ret
+  801b98:	e8 4a fe ff ff       	call   8019e7 <dupq_flush>
+  801b9d:	85 c0                	test   %eax,%eax
+  801b9f:	79 b1                	jns    801b52 <dupq_map+0x12>
+  801ba1:	eb f3                	jmp    801b96 <dupq_map+0x56>
+
+00801ba3 <dupq_end>:
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	53                   	push   %ebx
+  801ba7:	83 ec 04             	sub    $0x4,%esp
+  801baa:	e8 38 fe ff ff       	call   8019e7 <dupq_flush>
+  801baf:	89 c3                	mov    %eax,%ebx
+  801bb1:	83 ec 08             	sub    $0x8,%esp
+  801bb4:	68 00 00 40 00       	push   $0x400000
+  801bb9:	6a 00                	push   $0x0
+  801bbb:	e8 8b f6 ff ff       	call   80124b <sys_page_unmap>
+  801bc0:	89 d8                	mov    %ebx,%eax
+  801bc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc5:	c9                   	leave
+  801bc6:	c3                   	ret
+
+00801bc7 <fork>:
+  801bc7:	55                   	push   %ebp
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	53                   	push   %ebx
+  801bcb:	83 ec 10             	sub    $0x10,%esp
+  801bce:	68 29 1a 80 00       	push   $0x801a29
+  801bd3:	e8 4d 22 00 00       	call   803e25 <set_pgfault_handler>
+  801bd8:	83 c4 08             	add    $0x8,%esp
+  801bdb:	6a 01                	push   $0x1
+  801bdd:	6a 00                	push   $0x0
+  801bdf:	e8 4c f7 ff ff       	call   801330 <sys_env_set_cow>
+  801be4:	e8 a4 f6 ff ff       	call   80128d <sys_fork>
+  801be9:	89 c3                	mov    %eax,%ebx
+  801beb:	83 c4 10             	add    $0x10,%esp
+  801bee:	85 c0                	test   %eax,%eax
+  801bf0:	74 07                	je     801bf9 <fork+0x32>
+  801bf2:	89 d8                	mov    %ebx,%eax
+  801bf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf7:	c9                   	leave
+  801bf8:	c3                   	ret
+  801bf9:	e8 11 f5 ff ff       	call   80110f <sys_getenvid>
+  801bfe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c03:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801c09:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c0e:	a3 14 60 80 00       	mov    %eax,0x806014
+  801c13:	eb dd                	jmp    801bf2 <fork+0x2b>
+
+00801c15 <sfork>:
+  801c15:	55                   	push   %ebp
+  801c16:	89 e5                	mov    %esp,%ebp
+  801c18:	57                   	push   %edi
+  801c19:	56                   	push   %esi
+  801c1a:	53                   	push   %ebx
+  801c1b:	83 ec 1c             	sub    $0x1c,%esp
+  801c1e:	e8 ec f4 ff ff       	call   80110f <sys_getenvid>
+  801c23:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+  801c29:	68 29 1a 80 00       	push   $0x801a29
+  801c2e:	e8 f2 21 00 00       	call   803e25 <set_pgfault_handler>
+  801c33:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c38:	cd 30                	int    $0x30
+  801c3a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c3d:	83 c4 10             	add    $0x10,%esp
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	0f 88 45 02 00 00    	js     801e8d <sfork+0x278>
+  801c48:	89 c6                	mov    %eax,%esi
+  801c4a:	74 17                	je     801c63 <sfork+0x4e>
+  801c4c:	e8 cf fe ff ff       	call   801b20 <dupq_begin>
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	0f 88 40 02 00 00    	js     801e99 <sfork+0x284>
+  801c59:	bf 02 00 00 00       	mov    $0x2,%edi
+  801c5e:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  801c61:	eb 39                	jmp    801c9c <sfork+0x87>
+  801c63:	e8 a7 f4 ff ff       	call   80110f <sys_getenvid>
+  801c68:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c6d:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  801c73:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c78:	a3 14 60 80 00       	mov    %eax,0x806014
+  801c7d:	e9 23 01 00 00       	jmp    801da5 <sfork+0x190>
+  801c82:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801c89:	a8 01                	test   $0x1,%al
+  801c8b:	75 5b                	jne    801ce8 <sfork+0xd3>
+  801c8d:	83 c7 01             	add    $0x1,%edi
+  801c90:	81 ff ba 03 00 00    	cmp    $0x3ba,%edi
+  801c96:	0f 84 40 01 00 00    	je     801ddc <sfork+0x1c7>
+  801c9c:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801ca3:	a8 01                	test   $0x1,%al
+  801ca5:	74 db                	je     801c82 <sfork+0x6d>
+  801ca7:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801cae:	a8 80                	test   $0x80,%al
+  801cb0:	74 d0                	je     801c82 <sfork+0x6d>
+  801cb2:	8b 04 bd 00 d0 7b ef 	mov    -0x10843000(,%edi,4),%eax
+  801cb9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cbe:	0c 80                	or     $0x80,%al
+  801cc0:	50                   	push   %eax
+  801cc1:	ff 75 e4             	push   -0x1c(%ebp)
+  801cc4:	89 f8                	mov    %edi,%eax
+  801cc6:	c1 e0 16             	shl    $0x16,%eax
+  801cc9:	c1 e8 0c             	shr    $0xc,%eax
+  801ccc:	50                   	push   %eax
+  801ccd:	ff 75 e0             	push   -0x20(%ebp)
+  801cd0:	e8 6b fe ff ff       	call   801b40 <dupq_map>
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	79 b1                	jns    801c8d <sfork+0x78>
+  801cdc:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ce3:	e9 bd 00 00 00       	jmp    801da5 <sfork+0x190>
+  801ce8:	89 fe                	mov    %edi,%esi
+  801cea:	c1 e6 16             	shl    $0x16,%esi
+  801ced:	89 f0                	mov    %esi,%eax
+  801cef:	c1 e8 0c             	shr    $0xc,%eax
+  801cf2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801cf7:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801cfa:	eb 57                	jmp    801d53 <sfork+0x13e>
+  801cfc:	e8 0e f4 ff ff       	call   80110f <sys_getenvid>
+  801d01:	89 c7                	mov    %eax,%edi
+  801d03:	a1 f4 9f 7b ef       	mov    0xef7b9ff4,%eax
+  801d08:	f6 c4 04             	test   $0x4,%ah
+  801d0b:	0f 85 9f 00 00 00    	jne    801db0 <sfork+0x19b>
+  801d11:	a9 02 08 00 00       	test   $0x802,%eax
+  801d16:	0f 85 c5 01 00 00    	jne    801ee1 <sfork+0x2cc>
+  801d1c:	6a 05                	push   $0x5
+  801d1e:	ff 75 e4             	push   -0x1c(%ebp)
+  801d21:	68 fd e7 0e 00       	push   $0xee7fd
+  801d26:	57                   	push   %edi
+  801d27:	e8 14 fe ff ff       	call   801b40 <dupq_map>
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  801d35:	0f 84 91 00 00 00    	je     801dcc <sfork+0x1b7>
+  801d3b:	89 f0                	mov    %esi,%eax
+  801d3d:	09 d8                	or     %ebx,%eax
+  801d3f:	c1 e8 0c             	shr    $0xc,%eax
+  801d42:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d48:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  801d4d:	0f 84 81 00 00 00    	je     801dd4 <sfork+0x1bf>
+  801d53:	3d fd e7 0e 00       	cmp    $0xee7fd,%eax
+  801d58:	74 a2                	je     801cfc <sfork+0xe7>
+  801d5a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d61:	f6 c2 01             	test   $0x1,%dl
+  801d64:	74 c9                	je     801d2f <sfork+0x11a>
+  801d66:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d6d:	f6 c6 02             	test   $0x2,%dh
+  801d70:	75 bd                	jne    801d2f <sfork+0x11a>
+  801d72:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  801d79:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d80:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+  801d86:	f7 d2                	not    %edx
+  801d88:	21 ca                	and    %ecx,%edx
+  801d8a:	52                   	push   %edx
+  801d8b:	ff 75 e4             	push   -0x1c(%ebp)
+  801d8e:	50                   	push   %eax
+  801d8f:	ff 75 e0             	push   -0x20(%ebp)
+  801d92:	e8 a9 fd ff ff       	call   801b40 <dupq_map>
+  801d97:	83 c4 10             	add    $0x10,%esp
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	79 91                	jns    801d2f <sfork+0x11a>
+  801d9e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801da5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801da8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dab:	5b                   	pop    %ebx
+  801dac:	5e                   	pop    %esi
+  801dad:	5f                   	pop    %edi
+  801dae:	5d                   	pop    %ebp
+  801daf:	c3                   	ret
+  801db0:	25 07 0e 00 00       	and    $0xe07,%eax
+  801db5:	50                   	push   %eax
+  801db6:	ff 75 e4             	push   -0x1c(%ebp)
+  801db9:	68 fd e7 0e 00       	push   $0xee7fd
+  801dbe:	57                   	push   %edi
+  801dbf:	e8 7c fd ff ff       	call   801b40 <dupq_map>
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	e9 63 ff ff ff       	jmp    801d2f <sfork+0x11a>
+  801dcc:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801dcf:	e9 b9 fe ff ff       	jmp    801c8d <sfork+0x78>
+  801dd4:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801dd7:	e9 b1 fe ff ff       	jmp    801c8d <sfork+0x78>
+  801ddc:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801ddf:	e8 bf fd ff ff       	call   801ba3 <dupq_end>
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	0f 88 b9 00 00 00    	js     801ea5 <sfork+0x290>
+  801dec:	83 ec 04             	sub    $0x4,%esp
+  801def:	6a 07                	push   $0x7
+  801df1:	68 00 f0 7f ee       	push   $0xee7ff000
+  801df6:	56                   	push   %esi
+  801df7:	e8 7d f3 ff ff       	call   801179 <sys_page_alloc>
+  801dfc:	83 c4 10             	add    $0x10,%esp
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	0f 88 aa 00 00 00    	js     801eb1 <sfork+0x29c>
+  801e07:	83 ec 0c             	sub    $0xc,%esp
+  801e0a:	6a 07                	push   $0x7
+  801e0c:	68 00 f0 7f 00       	push   $0x7ff000
+  801e11:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801e14:	57                   	push   %edi
+  801e15:	68 00 f0 7f ee       	push   $0xee7ff000
+  801e1a:	56                   	push   %esi
+  801e1b:	e8 9c f3 ff ff       	call   8011bc <sys_page_map>
+  801e20:	83 c4 20             	add    $0x20,%esp
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	0f 88 92 00 00 00    	js     801ebd <sfork+0x2a8>
+  801e2b:	83 ec 04             	sub    $0x4,%esp
+  801e2e:	68 00 10 00 00       	push   $0x1000
+  801e33:	68 00 f0 7f 00       	push   $0x7ff000
+  801e38:	68 00 f0 7f ee       	push   $0xee7ff000
+  801e3d:	e8 87 f0 ff ff       	call   800ec9 <memmove>
+  801e42:	83 c4 08             	add    $0x8,%esp
+  801e45:	68 00 f0 7f 00       	push   $0x7ff000
+  801e4a:	57                   	push   %edi
+  801e4b:	e8 fb f3 ff ff       	call   80124b <sys_page_unmap>
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	78 72                	js     801ec9 <sfork+0x2b4>
+  801e57:	83 ec 08             	sub    $0x8,%esp
+  801e5a:	68 9d 3e 80 00       	push   $0x803e9d
+  801e5f:	56                   	push   %esi
+  801e60:	e8 2d f5 ff ff       	call   801392 <sys_env_set_pgfault_upcall>
+  801e65:	83 c4 10             	add    $0x10,%esp
+  801e68:	85 c0                	test   %eax,%eax
+  801e6a:	78 69                	js     801ed5 <sfork+0x2c0>
+  801e6c:	83 ec 08             	sub    $0x8,%esp
+  801e6f:	6a 02                	push   $0x2
+  801e71:	56                   	push   %esi
+  801e72:	e8 35 f4 ff ff       	call   8012ac <sys_env_set_status>
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801e81:	0f 49 45 e4          	cmovns -0x1c(%ebp),%eax
+  801e85:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e88:	e9 18 ff ff ff       	jmp    801da5 <sfork+0x190>
+  801e8d:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801e94:	e9 0c ff ff ff       	jmp    801da5 <sfork+0x190>
+  801e99:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ea0:	e9 00 ff ff ff       	jmp    801da5 <sfork+0x190>
+  801ea5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801eac:	e9 f4 fe ff ff       	jmp    801da5 <sfork+0x190>
+  801eb1:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801eb8:	e9 e8 fe ff ff       	jmp    801da5 <sfork+0x190>
+  801ebd:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ec4:	e9 dc fe ff ff       	jmp    801da5 <sfork+0x190>
+  801ec9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801ed0:	e9 d0 fe ff ff       	jmp    801da5 <sfork+0x190>
+  801ed5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  801edc:	e9 c4 fe ff ff       	jmp    801da5 <sfork+0x190>
+  801ee1:	68 05 08 00 00       	push   $0x805
+  801ee6:	ff 75 e4             	push   -0x1c(%ebp)
+  801ee9:	68 fd e7 0e 00       	push   $0xee7fd
+  801eee:	57                   	push   %edi
+  801eef:	e8 4c fc ff ff       	call   801b40 <dupq_map>
+  801ef4:	83 c4 10             	add    $0x10,%esp
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	0f 88 30 fe ff ff    	js     801d2f <sfork+0x11a>
+  801eff:	68 05 08 00 00       	push   $0x805
+  801f04:	57                   	push   %edi
+  801f05:	68 fd e7 0e 00       	push   $0xee7fd
+  801f0a:	57                   	push   %edi
+  801f0b:	e8 30 fc ff ff       	call   801b40 <dupq_map>
+  801f10:	83 c4 10             	add    $0x10,%esp
+  801f13:	e9 17 fe ff ff       	jmp    801d2f <sfork+0x11a>
+
+00801f18 <fd2num>:
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f23:	c1 e8 0c             	shr    $0xc,%eax
+  801f26:	5d                   	pop    %ebp
+  801f27:	c3                   	ret
+
+00801f28 <fd2data>:
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f33:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f38:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801f3d:	5d                   	pop    %ebp
+  801f3e:	c3                   	ret
+
+00801f3f <fd_alloc>:
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801f47:	89 c2                	mov    %eax,%edx
+  801f49:	c1 ea 16             	shr    $0x16,%edx
+  801f4c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f53:	f6 c2 01             	test   $0x1,%dl
+  801f56:	74 29                	je     801f81 <fd_alloc+0x42>
+  801f58:	89 c2                	mov    %eax,%edx
+  801f5a:	c1 ea 0c             	shr    $0xc,%edx
+  801f5d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f64:	f6 c2 01             	test   $0x1,%dl
+  801f67:	74 18                	je     801f81 <fd_alloc+0x42>
+  801f69:	05 00 10 00 00       	add    $0x1000,%eax
+  801f6e:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801f73:	75 d2                	jne    801f47 <fd_alloc+0x8>
+  801f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f7f:	eb 05                	jmp    801f86 <fd_alloc+0x47>
+  801f81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f89:	89 02                	mov    %eax,(%edx)
+  801f8b:	89 c8                	mov    %ecx,%eax
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+
+00801f8f <fd_lookup>:
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f95:	83 f8 1f             	cmp    $0x1f,%eax
+  801f98:	77 30                	ja     801fca <fd_lookup+0x3b>
+  801f9a:	c1 e0 0c             	shl    $0xc,%eax
+  801f9d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801fa2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801fa8:	f6 c2 01             	test   $0x1,%dl
+  801fab:	74 24                	je     801fd1 <fd_lookup+0x42>
+  801fad:	89 c2                	mov    %eax,%edx
+  801faf:	c1 ea 0c             	shr    $0xc,%edx
+  801fb2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fb9:	f6 c2 01             	test   $0x1,%dl
+  801fbc:	74 1a                	je     801fd8 <fd_lookup+0x49>
+  801fbe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fc1:	89 02                	mov    %eax,(%edx)
+  801fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc8:	5d                   	pop    %ebp
+  801fc9:	c3                   	ret
+  801fca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fcf:	eb f7                	jmp    801fc8 <fd_lookup+0x39>
+  801fd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd6:	eb f0                	jmp    801fc8 <fd_lookup+0x39>
+  801fd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fdd:	eb e9                	jmp    801fc8 <fd_lookup+0x39>
+
+00801fdf <dev_lookup>:
+  801fdf:	55                   	push   %ebp
+  801fe0:	89 e5                	mov    %esp,%ebp
+  801fe2:	53                   	push   %ebx
+  801fe3:	83 ec 04             	sub    $0x4,%esp
+  801fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fee:	bb 20 50 80 00       	mov    $0x805020,%ebx
+  801ff3:	39 13                	cmp    %edx,(%ebx)
+  801ff5:	74 37                	je     80202e <dev_lookup+0x4f>
+  801ff7:	83 c0 01             	add    $0x1,%eax
+  801ffa:	8b 1c 85 dc 49 80 00 	mov    0x8049dc(,%eax,4),%ebx
+  802001:	85 db                	test   %ebx,%ebx
+  802003:	75 ee                	jne    801ff3 <dev_lookup+0x14>
+  802005:	a1 14 60 80 00       	mov    0x806014,%eax
+  80200a:	8b 40 48             	mov    0x48(%eax),%eax
+  80200d:	83 ec 04             	sub    $0x4,%esp
+  802010:	52                   	push   %edx
+  802011:	50                   	push   %eax
+  802012:	68 60 49 80 00       	push   $0x804960
+  802017:	e8 06 e6 ff ff       	call   800622 <cprintf>
+  80201c:	83 c4 10             	add    $0x10,%esp
+  80201f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802024:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802027:	89 1a                	mov    %ebx,(%edx)
+  802029:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80202c:	c9                   	leave
+  80202d:	c3                   	ret
+  80202e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802033:	eb ef                	jmp    802024 <dev_lookup+0x45>
+
+00802035 <fd_close>:
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	57                   	push   %edi
+  802039:	56                   	push   %esi
+  80203a:	53                   	push   %ebx
+  80203b:	83 ec 24             	sub    $0x24,%esp
+  80203e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802041:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802044:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802047:	50                   	push   %eax
+  802048:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80204e:	c1 e8 0c             	shr    $0xc,%eax
+  802051:	50                   	push   %eax
+  802052:	e8 38 ff ff ff       	call   801f8f <fd_lookup>
+  802057:	89 c3                	mov    %eax,%ebx
+  802059:	83 c4 10             	add    $0x10,%esp
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	78 05                	js     802065 <fd_close+0x30>
+  802060:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802063:	74 0f                	je     802074 <fd_close+0x3f>
+  802065:	85 ff                	test   %edi,%edi
+  802067:	0f 44 df             	cmove  %edi,%ebx
+  80206a:	89 d8                	mov    %ebx,%eax
+  80206c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206f:	5b                   	pop    %ebx
+  802070:	5e                   	pop    %esi
+  802071:	5f                   	pop    %edi
+  802072:	5d                   	pop    %ebp
+  802073:	c3                   	ret
+  802074:	83 ec 08             	sub    $0x8,%esp
+  802077:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80207a:	50                   	push   %eax
+  80207b:	ff 36                	push   (%esi)
+  80207d:	e8 5d ff ff ff       	call   801fdf <dev_lookup>
+  802082:	89 c3                	mov    %eax,%ebx
+  802084:	83 c4 10             	add    $0x10,%esp
+  802087:	85 c0                	test   %eax,%eax
+  802089:	78 1a                	js     8020a5 <fd_close+0x70>
+  80208b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80208e:	8b 40 10             	mov    0x10(%eax),%eax
+  802091:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802096:	85 c0                	test   %eax,%eax
+  802098:	74 0b                	je     8020a5 <fd_close+0x70>
+  80209a:	83 ec 0c             	sub    $0xc,%esp
+  80209d:	56                   	push   %esi
+  80209e:	ff d0                	call   *%eax
+  8020a0:	89 c3                	mov    %eax,%ebx
+  8020a2:	83 c4 10             	add    $0x10,%esp
+  8020a5:	83 ec 08             	sub    $0x8,%esp
+  8020a8:	56                   	push   %esi
+  8020a9:	6a 00                	push   $0x0
+  8020ab:	e8 9b f1 ff ff       	call   80124b <sys_page_unmap>
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	eb b5                	jmp    80206a <fd_close+0x35>
+
+008020b5 <close>:
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	83 ec 20             	sub    $0x20,%esp
+  8020bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020be:	50                   	push   %eax
+  8020bf:	ff 75 08             	push   0x8(%ebp)
+  8020c2:	e8 c8 fe ff ff       	call   801f8f <fd_lookup>
+  8020c7:	83 c4 10             	add    $0x10,%esp
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	79 02                	jns    8020d0 <close+0x1b>
+  8020ce:	c9                   	leave
+  8020cf:	c3                   	ret
+  8020d0:	83 ec 08             	sub    $0x8,%esp
+  8020d3:	6a 01                	push   $0x1
+  8020d5:	ff 75 f4             	push   -0xc(%ebp)
+  8020d8:	e8 58 ff ff ff       	call   802035 <fd_close>
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	eb ec                	jmp    8020ce <close+0x19>
+
+008020e2 <close_all>:
+  8020e2:	55                   	push   %ebp
+  8020e3:	89 e5                	mov    %esp,%ebp
+  8020e5:	53                   	push   %ebx
+  8020e6:	83 ec 04             	sub    $0x4,%esp
+  8020e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ee:	83 ec 0c             	sub    $0xc,%esp
+  8020f1:	53                   	push   %ebx
+  8020f2:	e8 be ff ff ff       	call   8020b5 <close>
+  8020f7:	83 c3 01             	add    $0x1,%ebx
+  8020fa:	83 c4 10             	add    $0x10,%esp
+  8020fd:	83 fb 20             	cmp    $0x20,%ebx
+  802100:	75 ec                	jne    8020ee <close_all+0xc>
+  802102:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802105:	c9                   	leave
+  802106:	c3                   	ret
+
+00802107 <dup>:
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	57                   	push   %edi
+  80210b:	56                   	push   %esi
+  80210c:	53                   	push   %ebx
+  80210d:	83 ec 34             	sub    $0x34,%esp
+  802110:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802113:	50                   	push   %eax
+  802114:	ff 75 08             	push   0x8(%ebp)
+  802117:	e8 73 fe ff ff       	call   801f8f <fd_lookup>
+  80211c:	89 c3                	mov    %eax,%ebx
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	85 c0                	test   %eax,%eax
+  802123:	78 7f                	js     8021a4 <dup+0x9d>
+  802125:	83 ec 0c             	sub    $0xc,%esp
+  802128:	ff 75 0c             	push   0xc(%ebp)
+  80212b:	e8 85 ff ff ff       	call   8020b5 <close>
+  802130:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802133:	c1 e6 0c             	shl    $0xc,%esi
+  802136:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  80213c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80213f:	89 3c 24             	mov    %edi,(%esp)
+  802142:	e8 e1 fd ff ff       	call   801f28 <fd2data>
+  802147:	89 c3                	mov    %eax,%ebx
+  802149:	89 34 24             	mov    %esi,(%esp)
+  80214c:	e8 d7 fd ff ff       	call   801f28 <fd2data>
+  802151:	83 c4 10             	add    $0x10,%esp
+  802154:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802157:	89 d8                	mov    %ebx,%eax
+  802159:	c1 e8 16             	shr    $0x16,%eax
+  80215c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802163:	a8 01                	test   $0x1,%al
+  802165:	74 11                	je     802178 <dup+0x71>
+  802167:	89 d8                	mov    %ebx,%eax
+  802169:	c1 e8 0c             	shr    $0xc,%eax
+  80216c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802173:	f6 c2 01             	test   $0x1,%dl
+  802176:	75 36                	jne    8021ae <dup+0xa7>
+  802178:	89 f8                	mov    %edi,%eax
+  80217a:	c1 e8 0c             	shr    $0xc,%eax
+  80217d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802184:	83 ec 0c             	sub    $0xc,%esp
+  802187:	25 07 0e 00 00       	and    $0xe07,%eax
+  80218c:	50                   	push   %eax
+  80218d:	56                   	push   %esi
+  80218e:	6a 00                	push   $0x0
+  802190:	57                   	push   %edi
+  802191:	6a 00                	push   $0x0
+  802193:	e8 24 f0 ff ff       	call   8011bc <sys_page_map>
+  802198:	89 c3                	mov    %eax,%ebx
+  80219a:	83 c4 20             	add    $0x20,%esp
+  80219d:	85 c0                	test   %eax,%eax
+  80219f:	78 33                	js     8021d4 <dup+0xcd>
+  8021a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021a4:	89 d8                	mov    %ebx,%eax
+  8021a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a9:	5b                   	pop    %ebx
+  8021aa:	5e                   	pop    %esi
+  8021ab:	5f                   	pop    %edi
+  8021ac:	5d                   	pop    %ebp
+  8021ad:	c3                   	ret
+  8021ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021b5:	83 ec 0c             	sub    $0xc,%esp
+  8021b8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021bd:	50                   	push   %eax
+  8021be:	ff 75 d4             	push   -0x2c(%ebp)
+  8021c1:	6a 00                	push   $0x0
+  8021c3:	53                   	push   %ebx
+  8021c4:	6a 00                	push   $0x0
+  8021c6:	e8 f1 ef ff ff       	call   8011bc <sys_page_map>
+  8021cb:	89 c3                	mov    %eax,%ebx
+  8021cd:	83 c4 20             	add    $0x20,%esp
+  8021d0:	85 c0                	test   %eax,%eax
+  8021d2:	79 a4                	jns    802178 <dup+0x71>
+  8021d4:	83 ec 08             	sub    $0x8,%esp
+  8021d7:	56                   	push   %esi
+  8021d8:	6a 00                	push   $0x0
+  8021da:	e8 6c f0 ff ff       	call   80124b <sys_page_unmap>
+  8021df:	83 c4 08             	add    $0x8,%esp
+  8021e2:	ff 75 d4             	push   -0x2c(%ebp)
+  8021e5:	6a 00                	push   $0x0
+  8021e7:	e8 5f f0 ff ff       	call   80124b <sys_page_unmap>
+  8021ec:	83 c4 10             	add    $0x10,%esp
+  8021ef:	eb b3                	jmp    8021a4 <dup+0x9d>
+
+008021f1 <read>:
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	56                   	push   %esi
+  8021f5:	53                   	push   %ebx
+  8021f6:	83 ec 18             	sub    $0x18,%esp
+  8021f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021fc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021ff:	50                   	push   %eax
+  802200:	56                   	push   %esi
+  802201:	e8 89 fd ff ff       	call   801f8f <fd_lookup>
+  802206:	83 c4 10             	add    $0x10,%esp
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	78 3c                	js     802249 <read+0x58>
+  80220d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802210:	83 ec 08             	sub    $0x8,%esp
+  802213:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802216:	50                   	push   %eax
+  802217:	ff 33                	push   (%ebx)
+  802219:	e8 c1 fd ff ff       	call   801fdf <dev_lookup>
+  80221e:	83 c4 10             	add    $0x10,%esp
+  802221:	85 c0                	test   %eax,%eax
+  802223:	78 24                	js     802249 <read+0x58>
+  802225:	8b 43 08             	mov    0x8(%ebx),%eax
+  802228:	83 e0 03             	and    $0x3,%eax
+  80222b:	83 f8 01             	cmp    $0x1,%eax
+  80222e:	74 20                	je     802250 <read+0x5f>
+  802230:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802233:	8b 40 08             	mov    0x8(%eax),%eax
+  802236:	85 c0                	test   %eax,%eax
+  802238:	74 37                	je     802271 <read+0x80>
+  80223a:	83 ec 04             	sub    $0x4,%esp
+  80223d:	ff 75 10             	push   0x10(%ebp)
+  802240:	ff 75 0c             	push   0xc(%ebp)
+  802243:	53                   	push   %ebx
+  802244:	ff d0                	call   *%eax
+  802246:	83 c4 10             	add    $0x10,%esp
+  802249:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224c:	5b                   	pop    %ebx
+  80224d:	5e                   	pop    %esi
+  80224e:	5d                   	pop    %ebp
+  80224f:	c3                   	ret
+  802250:	a1 14 60 80 00       	mov    0x806014,%eax
+  802255:	8b 40 48             	mov    0x48(%eax),%eax
+  802258:	83 ec 04             	sub    $0x4,%esp
+  80225b:	56                   	push   %esi
+  80225c:	50                   	push   %eax
+  80225d:	68 a1 49 80 00       	push   $0x8049a1
+  802262:	e8 bb e3 ff ff       	call   800622 <cprintf>
+  802267:	83 c4 10             	add    $0x10,%esp
+  80226a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80226f:	eb d8                	jmp    802249 <read+0x58>
+  802271:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802276:	eb d1                	jmp    802249 <read+0x58>
+
+00802278 <readn>:
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	57                   	push   %edi
+  80227c:	56                   	push   %esi
+  80227d:	53                   	push   %ebx
+  80227e:	83 ec 0c             	sub    $0xc,%esp
+  802281:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802284:	8b 75 10             	mov    0x10(%ebp),%esi
+  802287:	85 f6                	test   %esi,%esi
+  802289:	74 30                	je     8022bb <readn+0x43>
+  80228b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802290:	b8 00 00 00 00       	mov    $0x0,%eax
+  802295:	83 ec 04             	sub    $0x4,%esp
+  802298:	89 f2                	mov    %esi,%edx
+  80229a:	29 c2                	sub    %eax,%edx
+  80229c:	52                   	push   %edx
+  80229d:	01 f8                	add    %edi,%eax
+  80229f:	50                   	push   %eax
+  8022a0:	ff 75 08             	push   0x8(%ebp)
+  8022a3:	e8 49 ff ff ff       	call   8021f1 <read>
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	78 15                	js     8022c4 <readn+0x4c>
+  8022af:	74 11                	je     8022c2 <readn+0x4a>
+  8022b1:	01 c3                	add    %eax,%ebx
+  8022b3:	89 d8                	mov    %ebx,%eax
+  8022b5:	39 f3                	cmp    %esi,%ebx
+  8022b7:	72 dc                	jb     802295 <readn+0x1d>
+  8022b9:	eb 09                	jmp    8022c4 <readn+0x4c>
+  8022bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c0:	eb 02                	jmp    8022c4 <readn+0x4c>
+  8022c2:	89 d8                	mov    %ebx,%eax
+  8022c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c7:	5b                   	pop    %ebx
+  8022c8:	5e                   	pop    %esi
+  8022c9:	5f                   	pop    %edi
+  8022ca:	5d                   	pop    %ebp
+  8022cb:	c3                   	ret
+
+008022cc <write>:
+  8022cc:	55                   	push   %ebp
+  8022cd:	89 e5                	mov    %esp,%ebp
+  8022cf:	56                   	push   %esi
+  8022d0:	53                   	push   %ebx
+  8022d1:	83 ec 18             	sub    $0x18,%esp
+  8022d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022d7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022da:	50                   	push   %eax
+  8022db:	53                   	push   %ebx
+  8022dc:	e8 ae fc ff ff       	call   801f8f <fd_lookup>
+  8022e1:	83 c4 10             	add    $0x10,%esp
+  8022e4:	85 c0                	test   %eax,%eax
+  8022e6:	78 37                	js     80231f <write+0x53>
+  8022e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022eb:	83 ec 08             	sub    $0x8,%esp
+  8022ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022f1:	50                   	push   %eax
+  8022f2:	ff 36                	push   (%esi)
+  8022f4:	e8 e6 fc ff ff       	call   801fdf <dev_lookup>
+  8022f9:	83 c4 10             	add    $0x10,%esp
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 1f                	js     80231f <write+0x53>
+  802300:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802304:	74 20                	je     802326 <write+0x5a>
+  802306:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802309:	8b 40 0c             	mov    0xc(%eax),%eax
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	74 37                	je     802347 <write+0x7b>
+  802310:	83 ec 04             	sub    $0x4,%esp
+  802313:	ff 75 10             	push   0x10(%ebp)
+  802316:	ff 75 0c             	push   0xc(%ebp)
+  802319:	56                   	push   %esi
+  80231a:	ff d0                	call   *%eax
+  80231c:	83 c4 10             	add    $0x10,%esp
+  80231f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802322:	5b                   	pop    %ebx
+  802323:	5e                   	pop    %esi
+  802324:	5d                   	pop    %ebp
+  802325:	c3                   	ret
+  802326:	a1 14 60 80 00       	mov    0x806014,%eax
+  80232b:	8b 40 48             	mov    0x48(%eax),%eax
+  80232e:	83 ec 04             	sub    $0x4,%esp
+  802331:	53                   	push   %ebx
+  802332:	50                   	push   %eax
+  802333:	68 bd 49 80 00       	push   $0x8049bd
+  802338:	e8 e5 e2 ff ff       	call   800622 <cprintf>
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802345:	eb d8                	jmp    80231f <write+0x53>
+  802347:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80234c:	eb d1                	jmp    80231f <write+0x53>
+
+0080234e <seek>:
+  80234e:	55                   	push   %ebp
+  80234f:	89 e5                	mov    %esp,%ebp
+  802351:	83 ec 20             	sub    $0x20,%esp
+  802354:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802357:	50                   	push   %eax
+  802358:	ff 75 08             	push   0x8(%ebp)
+  80235b:	e8 2f fc ff ff       	call   801f8f <fd_lookup>
+  802360:	83 c4 10             	add    $0x10,%esp
+  802363:	85 c0                	test   %eax,%eax
+  802365:	78 0e                	js     802375 <seek+0x27>
+  802367:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80236a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236d:	89 50 04             	mov    %edx,0x4(%eax)
+  802370:	b8 00 00 00 00       	mov    $0x0,%eax
+  802375:	c9                   	leave
+  802376:	c3                   	ret
+
+00802377 <ftruncate>:
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	56                   	push   %esi
+  80237b:	53                   	push   %ebx
+  80237c:	83 ec 18             	sub    $0x18,%esp
+  80237f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802382:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802385:	50                   	push   %eax
+  802386:	53                   	push   %ebx
+  802387:	e8 03 fc ff ff       	call   801f8f <fd_lookup>
+  80238c:	83 c4 10             	add    $0x10,%esp
+  80238f:	85 c0                	test   %eax,%eax
+  802391:	78 34                	js     8023c7 <ftruncate+0x50>
+  802393:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802396:	83 ec 08             	sub    $0x8,%esp
+  802399:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80239c:	50                   	push   %eax
+  80239d:	ff 36                	push   (%esi)
+  80239f:	e8 3b fc ff ff       	call   801fdf <dev_lookup>
+  8023a4:	83 c4 10             	add    $0x10,%esp
+  8023a7:	85 c0                	test   %eax,%eax
+  8023a9:	78 1c                	js     8023c7 <ftruncate+0x50>
+  8023ab:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8023af:	74 1d                	je     8023ce <ftruncate+0x57>
+  8023b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b4:	8b 40 18             	mov    0x18(%eax),%eax
+  8023b7:	85 c0                	test   %eax,%eax
+  8023b9:	74 34                	je     8023ef <ftruncate+0x78>
+  8023bb:	83 ec 08             	sub    $0x8,%esp
+  8023be:	ff 75 0c             	push   0xc(%ebp)
+  8023c1:	56                   	push   %esi
+  8023c2:	ff d0                	call   *%eax
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+  8023ce:	a1 14 60 80 00       	mov    0x806014,%eax
+  8023d3:	8b 40 48             	mov    0x48(%eax),%eax
+  8023d6:	83 ec 04             	sub    $0x4,%esp
+  8023d9:	53                   	push   %ebx
+  8023da:	50                   	push   %eax
+  8023db:	68 80 49 80 00       	push   $0x804980
+  8023e0:	e8 3d e2 ff ff       	call   800622 <cprintf>
+  8023e5:	83 c4 10             	add    $0x10,%esp
+  8023e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ed:	eb d8                	jmp    8023c7 <ftruncate+0x50>
+  8023ef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023f4:	eb d1                	jmp    8023c7 <ftruncate+0x50>
+
+008023f6 <fstat>:
+  8023f6:	55                   	push   %ebp
+  8023f7:	89 e5                	mov    %esp,%ebp
+  8023f9:	56                   	push   %esi
+  8023fa:	53                   	push   %ebx
+  8023fb:	83 ec 18             	sub    $0x18,%esp
+  8023fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802401:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802404:	50                   	push   %eax
+  802405:	ff 75 08             	push   0x8(%ebp)
+  802408:	e8 82 fb ff ff       	call   801f8f <fd_lookup>
+  80240d:	83 c4 10             	add    $0x10,%esp
+  802410:	85 c0                	test   %eax,%eax
+  802412:	78 49                	js     80245d <fstat+0x67>
+  802414:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802417:	83 ec 08             	sub    $0x8,%esp
+  80241a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241d:	50                   	push   %eax
+  80241e:	ff 36                	push   (%esi)
+  802420:	e8 ba fb ff ff       	call   801fdf <dev_lookup>
+  802425:	83 c4 10             	add    $0x10,%esp
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	78 31                	js     80245d <fstat+0x67>
+  80242c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802433:	74 2f                	je     802464 <fstat+0x6e>
+  802435:	c6 03 00             	movb   $0x0,(%ebx)
+  802438:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80243f:	00 00 00 
+  802442:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802449:	00 00 00 
+  80244c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  802452:	83 ec 08             	sub    $0x8,%esp
+  802455:	53                   	push   %ebx
+  802456:	56                   	push   %esi
+  802457:	ff 50 14             	call   *0x14(%eax)
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802460:	5b                   	pop    %ebx
+  802461:	5e                   	pop    %esi
+  802462:	5d                   	pop    %ebp
+  802463:	c3                   	ret
+  802464:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802469:	eb f2                	jmp    80245d <fstat+0x67>
+
+0080246b <stat>:
+  80246b:	55                   	push   %ebp
+  80246c:	89 e5                	mov    %esp,%ebp
+  80246e:	56                   	push   %esi
+  80246f:	53                   	push   %ebx
+  802470:	83 ec 08             	sub    $0x8,%esp
+  802473:	6a 00                	push   $0x0
+  802475:	ff 75 08             	push   0x8(%ebp)
+  802478:	e8 31 05 00 00       	call   8029ae <open>
+  80247d:	89 c3                	mov    %eax,%ebx
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	85 c0                	test   %eax,%eax
+  802484:	78 1b                	js     8024a1 <stat+0x36>
+  802486:	83 ec 08             	sub    $0x8,%esp
+  802489:	ff 75 0c             	push   0xc(%ebp)
+  80248c:	50                   	push   %eax
+  80248d:	e8 64 ff ff ff       	call   8023f6 <fstat>
+  802492:	89 c6                	mov    %eax,%esi
+  802494:	89 1c 24             	mov    %ebx,(%esp)
+  802497:	e8 19 fc ff ff       	call   8020b5 <close>
+  80249c:	83 c4 10             	add    $0x10,%esp
+  80249f:	89 f3                	mov    %esi,%ebx
+  8024a1:	89 d8                	mov    %ebx,%eax
+  8024a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a6:	5b                   	pop    %ebx
+  8024a7:	5e                   	pop    %esi
+  8024a8:	5d                   	pop    %ebp
+  8024a9:	c3                   	ret
+
+008024aa <fsipc>:
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	56                   	push   %esi
+  8024ae:	53                   	push   %ebx
+  8024af:	89 c3                	mov    %eax,%ebx
+  8024b1:	89 d6                	mov    %edx,%esi
+  8024b3:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  8024ba:	74 20                	je     8024dc <fsipc+0x32>
+  8024bc:	83 ec 08             	sub    $0x8,%esp
+  8024bf:	6a 00                	push   $0x0
+  8024c1:	56                   	push   %esi
+  8024c2:	6a 07                	push   $0x7
+  8024c4:	68 00 70 80 00       	push   $0x807000
+  8024c9:	53                   	push   %ebx
+  8024ca:	ff 35 0c 60 80 00    	push   0x80600c
+  8024d0:	e8 ab 1a 00 00       	call   803f80 <ipc_call>
+  8024d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d8:	5b                   	pop    %ebx
+  8024d9:	5e                   	pop    %esi
+  8024da:	5d                   	pop    %ebp
+  8024db:	c3                   	ret
+  8024dc:	83 ec 0c             	sub    $0xc,%esp
+  8024df:	6a 02                	push   $0x2
+  8024e1:	e8 35 1c 00 00       	call   80411b <ipc_find_env>
+  8024e6:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8024eb:	83 c4 10             	add    $0x10,%esp
+  8024ee:	eb cc                	jmp    8024bc <fsipc+0x12>
+
+008024f0 <devfile_trunc>:
+  8024f0:	55                   	push   %ebp
+  8024f1:	89 e5                	mov    %esp,%ebp
+  8024f3:	83 ec 08             	sub    $0x8,%esp
+  8024f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024fc:	a3 00 70 80 00       	mov    %eax,0x807000
+  802501:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802504:	a3 04 70 80 00       	mov    %eax,0x807004
+  802509:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802513:	e8 92 ff ff ff       	call   8024aa <fsipc>
+  802518:	c9                   	leave
+  802519:	c3                   	ret
+
+0080251a <devfile_flush>:
+  80251a:	55                   	push   %ebp
+  80251b:	89 e5                	mov    %esp,%ebp
+  80251d:	83 ec 08             	sub    $0x8,%esp
+  802520:	8b 45 08             	mov    0x8(%ebp),%eax
+  802523:	8b 40 0c             	mov    0xc(%eax),%eax
+  802526:	a3 00 70 80 00       	mov    %eax,0x807000
+  80252b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802530:	b8 08 00 00 00       	mov    $0x8,%eax
+  802535:	e8 70 ff ff ff       	call   8024aa <fsipc>
+  80253a:	c9                   	leave
+  80253b:	c3                   	ret
+
+0080253c <devfile_stat>:
+  80253c:	55                   	push   %ebp
+  80253d:	89 e5                	mov    %esp,%ebp
+  80253f:	53                   	push   %ebx
+  802540:	83 ec 04             	sub    $0x4,%esp
+  802543:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802546:	8b 45 08             	mov    0x8(%ebp),%eax
+  802549:	8b 40 0c             	mov    0xc(%eax),%eax
+  80254c:	a3 00 70 80 00       	mov    %eax,0x807000
+  802551:	ba 00 00 00 00       	mov    $0x0,%edx
+  802556:	b8 07 00 00 00       	mov    $0x7,%eax
+  80255b:	e8 4a ff ff ff       	call   8024aa <fsipc>
+  802560:	85 c0                	test   %eax,%eax
+  802562:	78 2c                	js     802590 <devfile_stat+0x54>
+  802564:	83 ec 08             	sub    $0x8,%esp
+  802567:	68 00 70 80 00       	push   $0x807000
+  80256c:	53                   	push   %ebx
+  80256d:	e8 a7 e7 ff ff       	call   800d19 <strcpy>
+  802572:	a1 80 70 80 00       	mov    0x807080,%eax
+  802577:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80257d:	a1 84 70 80 00       	mov    0x807084,%eax
+  802582:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802588:	83 c4 10             	add    $0x10,%esp
+  80258b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802590:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802593:	c9                   	leave
+  802594:	c3                   	ret
+
+00802595 <fsring_rw>:
+  802595:	55                   	push   %ebp
+  802596:	89 e5                	mov    %esp,%ebp
+  802598:	57                   	push   %edi
+  802599:	56                   	push   %esi
+  80259a:	53                   	push   %ebx
+  80259b:	83 ec 2c             	sub    $0x2c,%esp
+  80259e:	89 c7                	mov    %eax,%edi
+  8025a0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8025a3:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8025a6:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  8025ab:	a8 01                	test   $0x1,%al
+  8025ad:	74 0d                	je     8025bc <fsring_rw+0x27>
+  8025af:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  8025b4:	a8 01                	test   $0x1,%al
+  8025b6:	0f 85 d5 00 00 00    	jne    802691 <fsring_rw+0xfc>
+  8025bc:	a1 14 60 80 00       	mov    0x806014,%eax
+  8025c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8025c4:	3b 05 08 60 80 00    	cmp    0x806008,%eax
+  8025ca:	0f 84 fc 00 00 00    	je     8026cc <fsring_rw+0x137>
+  8025d0:	83 3d 0c 60 80 00 00 	cmpl   $0x0,0x80600c
+  8025d7:	0f 84 02 01 00 00    	je     8026df <fsring_rw+0x14a>
+  8025dd:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8025e2:	83 ec 04             	sub    $0x4,%esp
+  8025e5:	68 07 02 00 00       	push   $0x207
+  8025ea:	53                   	push   %ebx
+  8025eb:	6a 00                	push   $0x0
+  8025ed:	e8 87 eb ff ff       	call   801179 <sys_page_alloc>
+  8025f2:	83 c4 10             	add    $0x10,%esp
+  8025f5:	85 c0                	test   %eax,%eax
+  8025f7:	0f 88 f9 00 00 00    	js     8026f6 <fsring_rw+0x161>
+  8025fd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802603:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802609:	75 d7                	jne    8025e2 <fsring_rw+0x4d>
+  80260b:	6a 0e                	push   $0xe
+  80260d:	6a 0d                	push   $0xd
+  80260f:	ff 35 0c 60 80 00    	push   0x80600c
+  802615:	68 00 00 f0 cf       	push   $0xcff00000
+  80261a:	e8 fb 15 00 00       	call   803c1a <ipcring_init>
+  80261f:	83 c4 08             	add    $0x8,%esp
+  802622:	6a 00                	push   $0x0
+  802624:	6a 00                	push   $0x0
+  802626:	68 07 02 00 00       	push   $0x207
+  80262b:	68 00 00 f0 cf       	push   $0xcff00000
+  802630:	6a 0b                	push   $0xb
+  802632:	ff 35 0c 60 80 00    	push   0x80600c
+  802638:	e8 43 19 00 00       	call   803f80 <ipc_call>
+  80263d:	89 c6                	mov    %eax,%esi
+  80263f:	83 c4 20             	add    $0x20,%esp
+  802642:	85 c0                	test   %eax,%eax
+  802644:	0f 88 ac 00 00 00    	js     8026f6 <fsring_rw+0x161>
+  80264a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80264f:	89 d9                	mov    %ebx,%ecx
+  802651:	83 c3 01             	add    $0x1,%ebx
+  802654:	89 da                	mov    %ebx,%edx
+  802656:	c1 e2 0c             	shl    $0xc,%edx
+  802659:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  80265f:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  802665:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  80266b:	83 ec 08             	sub    $0x8,%esp
+  80266e:	6a 00                	push   $0x0
+  802670:	6a 00                	push   $0x0
+  802672:	68 07 02 00 00       	push   $0x207
+  802677:	50                   	push   %eax
+  802678:	6a 0c                	push   $0xc
+  80267a:	ff 35 0c 60 80 00    	push   0x80600c
+  802680:	e8 fb 18 00 00       	call   803f80 <ipc_call>
+  802685:	83 c4 20             	add    $0x20,%esp
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	78 6a                	js     8026f6 <fsring_rw+0x161>
+  80268c:	83 fb 08             	cmp    $0x8,%ebx
+  80268f:	75 be                	jne    80264f <fsring_rw+0xba>
+  802691:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802695:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  80269a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80269f:	0f 45 c2             	cmovne %edx,%eax
+  8026a2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8026a5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8026ac:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  8026b3:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  8026ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c4:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8026c7:	e9 4b 01 00 00       	jmp    802817 <fsring_rw+0x282>
+  8026cc:	e8 72 ee ff ff       	call   801543 <sys_time_msec>
+  8026d1:	3b 05 04 60 80 00    	cmp    0x806004,%eax
+  8026d7:	0f 89 f3 fe ff ff    	jns    8025d0 <fsring_rw+0x3b>
+  8026dd:	eb 54                	jmp    802733 <fsring_rw+0x19e>
+  8026df:	83 ec 0c             	sub    $0xc,%esp
+  8026e2:	6a 02                	push   $0x2
+  8026e4:	e8 32 1a 00 00       	call   80411b <ipc_find_env>
+  8026e9:	a3 0c 60 80 00       	mov    %eax,0x80600c
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	e9 e7 fe ff ff       	jmp    8025dd <fsring_rw+0x48>
+  8026f6:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8026fb:	83 ec 08             	sub    $0x8,%esp
+  8026fe:	53                   	push   %ebx
+  8026ff:	6a 00                	push   $0x0
+  802701:	e8 45 eb ff ff       	call   80124b <sys_page_unmap>
+  802706:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80270c:	83 c4 10             	add    $0x10,%esp
+  80270f:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  802715:	75 e4                	jne    8026fb <fsring_rw+0x166>
+  802717:	e8 27 ee ff ff       	call   801543 <sys_time_msec>
+  80271c:	05 e8 03 00 00       	add    $0x3e8,%eax
+  802721:	a3 04 60 80 00       	mov    %eax,0x806004
+  802726:	a1 14 60 80 00       	mov    0x806014,%eax
+  80272b:	8b 40 48             	mov    0x48(%eax),%eax
+  80272e:	a3 08 60 80 00       	mov    %eax,0x806008
+  802733:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  80273a:	e9 7a 01 00 00       	jmp    8028b9 <fsring_rw+0x324>
+  80273f:	8b 57 0c             	mov    0xc(%edi),%edx
+  802742:	89 10                	mov    %edx,(%eax)
+  802744:	89 58 04             	mov    %ebx,0x4(%eax)
+  802747:	89 f2                	mov    %esi,%edx
+  802749:	03 57 04             	add    0x4(%edi),%edx
+  80274c:	89 50 08             	mov    %edx,0x8(%eax)
+  80274f:	83 ec 04             	sub    $0x4,%esp
+  802752:	53                   	push   %ebx
+  802753:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802756:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802759:	52                   	push   %edx
+  80275a:	83 c0 0c             	add    $0xc,%eax
+  80275d:	50                   	push   %eax
+  80275e:	e8 66 e7 ff ff       	call   800ec9 <memmove>
+  802763:	83 c4 10             	add    $0x10,%esp
+  802766:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802769:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80276c:	89 08                	mov    %ecx,(%eax)
+  80276e:	83 ec 0c             	sub    $0xc,%esp
+  802771:	68 00 00 f0 cf       	push   $0xcff00000
+  802776:	e8 fd 14 00 00       	call   803c78 <ipcring_req_push>
+  80277b:	01 de                	add    %ebx,%esi
+  80277d:	83 c4 10             	add    $0x10,%esp
+  802780:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802783:	73 4c                	jae    8027d1 <fsring_rw+0x23c>
+  802785:	83 ec 0c             	sub    $0xc,%esp
+  802788:	68 00 00 f0 cf       	push   $0xcff00000
+  80278d:	e8 c0 14 00 00       	call   803c52 <ipcring_req_slot>
+  802792:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802795:	83 c4 10             	add    $0x10,%esp
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	74 35                	je     8027d1 <fsring_rw+0x23c>
+  80279c:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8027a1:	83 e0 07             	and    $0x7,%eax
+  8027a4:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  8027a9:	c1 e0 0c             	shl    $0xc,%eax
+  8027ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027af:	29 f3                	sub    %esi,%ebx
+  8027b1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8027b4:	39 cb                	cmp    %ecx,%ebx
+  8027b6:	0f 47 d9             	cmova  %ecx,%ebx
+  8027b9:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8027bd:	75 80                	jne    80273f <fsring_rw+0x1aa>
+  8027bf:	8b 57 0c             	mov    0xc(%edi),%edx
+  8027c2:	89 10                	mov    %edx,(%eax)
+  8027c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  8027c7:	89 f2                	mov    %esi,%edx
+  8027c9:	03 57 04             	add    0x4(%edi),%edx
+  8027cc:	89 50 08             	mov    %edx,0x8(%eax)
+  8027cf:	eb 95                	jmp    802766 <fsring_rw+0x1d1>
+  8027d1:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  8027d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027d9:	83 ec 0c             	sub    $0xc,%esp
+  8027dc:	68 00 00 f0 cf       	push   $0xcff00000
+  8027e1:	e8 cb 14 00 00       	call   803cb1 <ipcring_rsp_wait>
+  8027e6:	8b 58 04             	mov    0x4(%eax),%ebx
+  8027e9:	83 c4 10             	add    $0x10,%esp
+  8027ec:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8027f0:	75 45                	jne    802837 <fsring_rw+0x2a2>
+  8027f2:	85 db                	test   %ebx,%ebx
+  8027f4:	79 41                	jns    802837 <fsring_rw+0x2a2>
+  8027f6:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8027f9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  802800:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  802807:	83 ec 0c             	sub    $0xc,%esp
+  80280a:	68 00 00 f0 cf       	push   $0xcff00000
+  80280f:	e8 03 15 00 00       	call   803d17 <ipcring_rsp_pop>
+  802814:	83 c4 10             	add    $0x10,%esp
+  802817:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  80281d:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802822:	39 c2                	cmp    %eax,%edx
+  802824:	74 75                	je     80289b <fsring_rw+0x306>
+  802826:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80282a:	75 a5                	jne    8027d1 <fsring_rw+0x23c>
+  80282c:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80282f:	0f 82 50 ff ff ff    	jb     802785 <fsring_rw+0x1f0>
+  802835:	eb 9a                	jmp    8027d1 <fsring_rw+0x23c>
+  802837:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80283b:	75 ca                	jne    802807 <fsring_rw+0x272>
+  80283d:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802841:	74 31                	je     802874 <fsring_rw+0x2df>
+  802843:	8b 45 08             	mov    0x8(%ebp),%eax
+  802846:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802849:	29 c8                	sub    %ecx,%eax
+  80284b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80284e:	39 d0                	cmp    %edx,%eax
+  802850:	0f 47 c2             	cmova  %edx,%eax
+  802853:	39 d8                	cmp    %ebx,%eax
+  802855:	ba 01 00 00 00       	mov    $0x1,%edx
+  80285a:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  80285e:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802861:	b8 01 00 00 00       	mov    $0x1,%eax
+  802866:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80286a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80286d:	01 d9                	add    %ebx,%ecx
+  80286f:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802872:	eb 93                	jmp    802807 <fsring_rw+0x272>
+  802874:	83 ec 04             	sub    $0x4,%esp
+  802877:	53                   	push   %ebx
+  802878:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80287b:	83 e0 07             	and    $0x7,%eax
+  80287e:	c1 e0 0c             	shl    $0xc,%eax
+  802881:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  802887:	50                   	push   %eax
+  802888:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80288b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80288e:	01 c8                	add    %ecx,%eax
+  802890:	50                   	push   %eax
+  802891:	e8 33 e6 ff ff       	call   800ec9 <memmove>
+  802896:	83 c4 10             	add    $0x10,%esp
+  802899:	eb a8                	jmp    802843 <fsring_rw+0x2ae>
+  80289b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80289f:	75 09                	jne    8028aa <fsring_rw+0x315>
+  8028a1:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8028a4:	0f 82 db fe ff ff    	jb     802785 <fsring_rw+0x1f0>
+  8028aa:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8028ad:	01 57 04             	add    %edx,0x4(%edi)
+  8028b0:	85 d2                	test   %edx,%edx
+  8028b2:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  8028b6:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8028b9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8028bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028bf:	5b                   	pop    %ebx
+  8028c0:	5e                   	pop    %esi
+  8028c1:	5f                   	pop    %edi
+  8028c2:	5d                   	pop    %ebp
+  8028c3:	c3                   	ret
+
+008028c4 <devfile_write>:
+  8028c4:	55                   	push   %ebp
+  8028c5:	89 e5                	mov    %esp,%ebp
+  8028c7:	57                   	push   %edi
+  8028c8:	56                   	push   %esi
+  8028c9:	53                   	push   %ebx
+  8028ca:	83 ec 0c             	sub    $0xc,%esp
+  8028cd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028d0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028d6:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8028dc:	76 1a                	jbe    8028f8 <devfile_write+0x34>
+  8028de:	83 ec 0c             	sub    $0xc,%esp
+  8028e1:	53                   	push   %ebx
+  8028e2:	89 f1                	mov    %esi,%ecx
+  8028e4:	ba 06 00 00 00       	mov    $0x6,%edx
+  8028e9:	89 f8                	mov    %edi,%eax
+  8028eb:	e8 a5 fc ff ff       	call   802595 <fsring_rw>
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8028f6:	75 39                	jne    802931 <devfile_write+0x6d>
+  8028f8:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8028fd:	39 c3                	cmp    %eax,%ebx
+  8028ff:	0f 47 d8             	cmova  %eax,%ebx
+  802902:	8b 47 0c             	mov    0xc(%edi),%eax
+  802905:	a3 00 70 80 00       	mov    %eax,0x807000
+  80290a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802910:	83 ec 04             	sub    $0x4,%esp
+  802913:	53                   	push   %ebx
+  802914:	56                   	push   %esi
+  802915:	68 08 70 80 00       	push   $0x807008
+  80291a:	e8 aa e5 ff ff       	call   800ec9 <memmove>
+  80291f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802924:	b8 04 00 00 00       	mov    $0x4,%eax
+  802929:	e8 7c fb ff ff       	call   8024aa <fsipc>
+  80292e:	83 c4 10             	add    $0x10,%esp
+  802931:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802934:	5b                   	pop    %ebx
+  802935:	5e                   	pop    %esi
+  802936:	5f                   	pop    %edi
+  802937:	5d                   	pop    %ebp
+  802938:	c3                   	ret
+
+00802939 <devfile_read>:
+  802939:	55                   	push   %ebp
+  80293a:	89 e5                	mov    %esp,%ebp
+  80293c:	57                   	push   %edi
+  80293d:	56                   	push   %esi
+  80293e:	53                   	push   %ebx
+  80293f:	83 ec 0c             	sub    $0xc,%esp
+  802942:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802945:	8b 75 10             	mov    0x10(%ebp),%esi
+  802948:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  80294e:	76 1d                	jbe    80296d <devfile_read+0x34>
+  802950:	83 ec 0c             	sub    $0xc,%esp
+  802953:	56                   	push   %esi
+  802954:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802957:	ba 05 00 00 00       	mov    $0x5,%edx
+  80295c:	89 f8                	mov    %edi,%eax
+  80295e:	e8 32 fc ff ff       	call   802595 <fsring_rw>
+  802963:	89 c3                	mov    %eax,%ebx
+  802965:	83 c4 10             	add    $0x10,%esp
+  802968:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80296b:	75 37                	jne    8029a4 <devfile_read+0x6b>
+  80296d:	8b 47 0c             	mov    0xc(%edi),%eax
+  802970:	a3 00 70 80 00       	mov    %eax,0x807000
+  802975:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80297b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802980:	b8 03 00 00 00       	mov    $0x3,%eax
+  802985:	e8 20 fb ff ff       	call   8024aa <fsipc>
+  80298a:	89 c3                	mov    %eax,%ebx
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	78 14                	js     8029a4 <devfile_read+0x6b>
+  802990:	83 ec 04             	sub    $0x4,%esp
+  802993:	50                   	push   %eax
+  802994:	68 00 70 80 00       	push   $0x807000
+  802999:	ff 75 0c             	push   0xc(%ebp)
+  80299c:	e8 28 e5 ff ff       	call   800ec9 <memmove>
+  8029a1:	83 c4 10             	add    $0x10,%esp
+  8029a4:	89 d8                	mov    %ebx,%eax
+  8029a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a9:	5b                   	pop    %ebx
+  8029aa:	5e                   	pop    %esi
+  8029ab:	5f                   	pop    %edi
+  8029ac:	5d                   	pop    %ebp
+  8029ad:	c3                   	ret
+
+008029ae <open>:
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	56                   	push   %esi
+  8029b2:	53                   	push   %ebx
+  8029b3:	83 ec 1c             	sub    $0x1c,%esp
+  8029b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029b9:	56                   	push   %esi
+  8029ba:	e8 0e e3 ff ff       	call   800ccd <strlen>
+  8029bf:	83 c4 10             	add    $0x10,%esp
+  8029c2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029c7:	7f 6c                	jg     802a35 <open+0x87>
+  8029c9:	83 ec 0c             	sub    $0xc,%esp
+  8029cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029cf:	50                   	push   %eax
+  8029d0:	e8 6a f5 ff ff       	call   801f3f <fd_alloc>
+  8029d5:	89 c3                	mov    %eax,%ebx
+  8029d7:	83 c4 10             	add    $0x10,%esp
+  8029da:	85 c0                	test   %eax,%eax
+  8029dc:	78 3c                	js     802a1a <open+0x6c>
+  8029de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029e1:	a3 00 74 80 00       	mov    %eax,0x807400
+  8029e6:	83 ec 08             	sub    $0x8,%esp
+  8029e9:	56                   	push   %esi
+  8029ea:	68 00 70 80 00       	push   $0x807000
+  8029ef:	e8 25 e3 ff ff       	call   800d19 <strcpy>
+  8029f4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029fc:	e8 a9 fa ff ff       	call   8024aa <fsipc>
+  802a01:	89 c3                	mov    %eax,%ebx
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 19                	js     802a23 <open+0x75>
+  802a0a:	83 ec 0c             	sub    $0xc,%esp
+  802a0d:	ff 75 f4             	push   -0xc(%ebp)
+  802a10:	e8 03 f5 ff ff       	call   801f18 <fd2num>
+  802a15:	89 c3                	mov    %eax,%ebx
+  802a17:	83 c4 10             	add    $0x10,%esp
+  802a1a:	89 d8                	mov    %ebx,%eax
+  802a1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a1f:	5b                   	pop    %ebx
+  802a20:	5e                   	pop    %esi
+  802a21:	5d                   	pop    %ebp
+  802a22:	c3                   	ret
+  802a23:	83 ec 08             	sub    $0x8,%esp
+  802a26:	6a 00                	push   $0x0
+  802a28:	ff 75 f4             	push   -0xc(%ebp)
+  802a2b:	e8 05 f6 ff ff       	call   802035 <fd_close>
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	eb e5                	jmp    802a1a <open+0x6c>
+  802a35:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a3a:	eb de                	jmp    802a1a <open+0x6c>
+
+00802a3c <file_image>:
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	53                   	push   %ebx
+  802a40:	83 ec 1c             	sub    $0x1c,%esp
+  802a43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a49:	50                   	push   %eax
+  802a4a:	ff 75 08             	push   0x8(%ebp)
+  802a4d:	e8 3d f5 ff ff       	call   801f8f <fd_lookup>
+  802a52:	83 c4 10             	add    $0x10,%esp
+  802a55:	85 c0                	test   %eax,%eax
+  802a57:	78 58                	js     802ab1 <file_image+0x75>
+  802a59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a5c:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802a62:	39 08                	cmp    %ecx,(%eax)
+  802a64:	75 50                	jne    802ab6 <file_image+0x7a>
+  802a66:	83 fb 04             	cmp    $0x4,%ebx
+  802a69:	77 52                	ja     802abd <file_image+0x81>
+  802a6b:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a6e:	a3 00 70 80 00       	mov    %eax,0x807000
+  802a73:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802a79:	83 ec 04             	sub    $0x4,%esp
+  802a7c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802a7f:	c1 e0 02             	shl    $0x2,%eax
+  802a82:	50                   	push   %eax
+  802a83:	ff 75 0c             	push   0xc(%ebp)
+  802a86:	68 08 70 80 00       	push   $0x807008
+  802a8b:	e8 39 e4 ff ff       	call   800ec9 <memmove>
+  802a90:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a95:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a9a:	e8 0b fa ff ff       	call   8024aa <fsipc>
+  802a9f:	83 c4 10             	add    $0x10,%esp
+  802aa2:	85 c0                	test   %eax,%eax
+  802aa4:	78 0b                	js     802ab1 <file_image+0x75>
+  802aa6:	8b 55 14             	mov    0x14(%ebp),%edx
+  802aa9:	8b 0d 0c 60 80 00    	mov    0x80600c,%ecx
+  802aaf:	89 0a                	mov    %ecx,(%edx)
+  802ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab4:	c9                   	leave
+  802ab5:	c3                   	ret
+  802ab6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802abb:	eb f4                	jmp    802ab1 <file_image+0x75>
+  802abd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac2:	eb ed                	jmp    802ab1 <file_image+0x75>
+
+00802ac4 <remove>:
+  802ac4:	55                   	push   %ebp
+  802ac5:	89 e5                	mov    %esp,%ebp
+  802ac7:	53                   	push   %ebx
+  802ac8:	83 ec 10             	sub    $0x10,%esp
+  802acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ace:	53                   	push   %ebx
+  802acf:	e8 f9 e1 ff ff       	call   800ccd <strlen>
+  802ad4:	83 c4 10             	add    $0x10,%esp
+  802ad7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802adc:	7f 25                	jg     802b03 <remove+0x3f>
+  802ade:	83 ec 08             	sub    $0x8,%esp
+  802ae1:	53                   	push   %ebx
+  802ae2:	68 00 70 80 00       	push   $0x807000
+  802ae7:	e8 2d e2 ff ff       	call   800d19 <strcpy>
+  802aec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af1:	b8 09 00 00 00       	mov    $0x9,%eax
+  802af6:	e8 af f9 ff ff       	call   8024aa <fsipc>
+  802afb:	83 c4 10             	add    $0x10,%esp
+  802afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b01:	c9                   	leave
+  802b02:	c3                   	ret
+  802b03:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b08:	eb f4                	jmp    802afe <remove+0x3a>
+
+00802b0a <sync>:
+  802b0a:	55                   	push   %ebp
+  802b0b:	89 e5                	mov    %esp,%ebp
+  802b0d:	83 ec 08             	sub    $0x8,%esp
+  802b10:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b15:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b1a:	e8 8b f9 ff ff       	call   8024aa <fsipc>
+  802b1f:	c9                   	leave
+  802b20:	c3                   	ret
+
+00802b21 <map_segment>:
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	57                   	push   %edi
+  802b25:	56                   	push   %esi
+  802b26:	53                   	push   %ebx
+  802b27:	83 ec 1c             	sub    $0x1c,%esp
+  802b2a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b2d:	89 d7                	mov    %edx,%edi
+  802b2f:	89 d0                	mov    %edx,%eax
+  802b31:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b36:	74 0a                	je     802b42 <map_segment+0x21>
+  802b38:	29 c7                	sub    %eax,%edi
+  802b3a:	01 c1                	add    %eax,%ecx
+  802b3c:	01 45 0c             	add    %eax,0xc(%ebp)
+  802b3f:	29 45 10             	sub    %eax,0x10(%ebp)
+  802b42:	85 c9                	test   %ecx,%ecx
+  802b44:	0f 84 fb 00 00 00    	je     802c45 <map_segment+0x124>
+  802b4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b4f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b52:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b55:	e9 a6 00 00 00       	jmp    802c00 <map_segment+0xdf>
+  802b5a:	83 ec 04             	sub    $0x4,%esp
+  802b5d:	6a 07                	push   $0x7
+  802b5f:	68 00 00 40 00       	push   $0x400000
+  802b64:	6a 00                	push   $0x0
+  802b66:	e8 0e e6 ff ff       	call   801179 <sys_page_alloc>
+  802b6b:	83 c4 10             	add    $0x10,%esp
+  802b6e:	85 c0                	test   %eax,%eax
+  802b70:	0f 88 c7 00 00 00    	js     802c3d <map_segment+0x11c>
+  802b76:	83 ec 08             	sub    $0x8,%esp
+  802b79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b7c:	03 45 10             	add    0x10(%ebp),%eax
+  802b7f:	50                   	push   %eax
+  802b80:	ff 75 08             	push   0x8(%ebp)
+  802b83:	e8 c6 f7 ff ff       	call   80234e <seek>
+  802b88:	83 c4 10             	add    $0x10,%esp
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	0f 88 aa 00 00 00    	js     802c3d <map_segment+0x11c>
+  802b93:	83 ec 04             	sub    $0x4,%esp
+  802b96:	89 f2                	mov    %esi,%edx
+  802b98:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802b9b:	29 ca                	sub    %ecx,%edx
+  802b9d:	89 d0                	mov    %edx,%eax
+  802b9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba4:	39 d0                	cmp    %edx,%eax
+  802ba6:	0f 47 c2             	cmova  %edx,%eax
+  802ba9:	50                   	push   %eax
+  802baa:	68 00 00 40 00       	push   $0x400000
+  802baf:	ff 75 08             	push   0x8(%ebp)
+  802bb2:	e8 c1 f6 ff ff       	call   802278 <readn>
+  802bb7:	83 c4 10             	add    $0x10,%esp
+  802bba:	85 c0                	test   %eax,%eax
+  802bbc:	78 7f                	js     802c3d <map_segment+0x11c>
+  802bbe:	83 ec 0c             	sub    $0xc,%esp
+  802bc1:	ff 75 14             	push   0x14(%ebp)
+  802bc4:	57                   	push   %edi
+  802bc5:	ff 75 e0             	push   -0x20(%ebp)
+  802bc8:	68 00 00 40 00       	push   $0x400000
+  802bcd:	6a 00                	push   $0x0
+  802bcf:	e8 e8 e5 ff ff       	call   8011bc <sys_page_map>
+  802bd4:	83 c4 20             	add    $0x20,%esp
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	78 48                	js     802c23 <map_segment+0x102>
+  802bdb:	83 ec 08             	sub    $0x8,%esp
+  802bde:	68 00 00 40 00       	push   $0x400000
+  802be3:	6a 00                	push   $0x0
+  802be5:	e8 61 e6 ff ff       	call   80124b <sys_page_unmap>
+  802bea:	83 c4 10             	add    $0x10,%esp
+  802bed:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802bf3:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802bf9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802bfc:	39 c3                	cmp    %eax,%ebx
+  802bfe:	73 38                	jae    802c38 <map_segment+0x117>
+  802c00:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802c03:	39 f3                	cmp    %esi,%ebx
+  802c05:	0f 82 4f ff ff ff    	jb     802b5a <map_segment+0x39>
+  802c0b:	83 ec 04             	sub    $0x4,%esp
+  802c0e:	ff 75 14             	push   0x14(%ebp)
+  802c11:	57                   	push   %edi
+  802c12:	ff 75 e0             	push   -0x20(%ebp)
+  802c15:	e8 5f e5 ff ff       	call   801179 <sys_page_alloc>
+  802c1a:	83 c4 10             	add    $0x10,%esp
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	79 cc                	jns    802bed <map_segment+0xcc>
+  802c21:	eb 1a                	jmp    802c3d <map_segment+0x11c>
+  802c23:	50                   	push   %eax
+  802c24:	68 f0 49 80 00       	push   $0x8049f0
+  802c29:	68 75 01 00 00       	push   $0x175
+  802c2e:	68 0d 4a 80 00       	push   $0x804a0d
+  802c33:	e8 0f d9 ff ff       	call   800547 <_panic>
+  802c38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c40:	5b                   	pop    %ebx
+  802c41:	5e                   	pop    %esi
+  802c42:	5f                   	pop    %edi
+  802c43:	5d                   	pop    %ebp
+  802c44:	c3                   	ret
+  802c45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4a:	eb f1                	jmp    802c3d <map_segment+0x11c>
+
+00802c4c <execv>:
+  802c4c:	55                   	push   %ebp
+  802c4d:	89 e5                	mov    %esp,%ebp
+  802c4f:	57                   	push   %edi
+  802c50:	56                   	push   %esi
+  802c51:	53                   	push   %ebx
+  802c52:	81 ec d4 02 00 00    	sub    $0x2d4,%esp
+  802c58:	6a 00                	push   $0x0
+  802c5a:	ff 75 08             	push   0x8(%ebp)
+  802c5d:	e8 4c fd ff ff       	call   8029ae <open>
+  802c62:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  802c68:	83 c4 10             	add    $0x10,%esp
+  802c6b:	85 c0                	test   %eax,%eax
+  802c6d:	0f 88 ea 05 00 00    	js     80325d <execv+0x611>
+  802c73:	89 c6                	mov    %eax,%esi
+  802c75:	83 ec 04             	sub    $0x4,%esp
+  802c78:	68 00 02 00 00       	push   $0x200
+  802c7d:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802c83:	50                   	push   %eax
+  802c84:	56                   	push   %esi
+  802c85:	e8 ee f5 ff ff       	call   802278 <readn>
+  802c8a:	83 c4 10             	add    $0x10,%esp
+  802c8d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802c92:	0f 85 e1 01 00 00    	jne    802e79 <execv+0x22d>
+  802c98:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802c9f:	45 4c 46 
+  802ca2:	0f 85 d1 01 00 00    	jne    802e79 <execv+0x22d>
+  802ca8:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cad:	cd 30                	int    $0x30
+  802caf:	89 85 40 fd ff ff    	mov    %eax,-0x2c0(%ebp)
+  802cb5:	85 c0                	test   %eax,%eax
+  802cb7:	0f 88 94 05 00 00    	js     803251 <execv+0x605>
+  802cbd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802cc2:	69 f0 ac 01 00 00    	imul   $0x1ac,%eax,%esi
+  802cc8:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802cce:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802cd4:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802cd9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802cdb:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802ce1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  802ce7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cea:	8b 00                	mov    (%eax),%eax
+  802cec:	85 c0                	test   %eax,%eax
+  802cee:	0f 84 ad 05 00 00    	je     8032a1 <execv+0x655>
+  802cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cf9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cfe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d01:	83 ec 0c             	sub    $0xc,%esp
+  802d04:	50                   	push   %eax
+  802d05:	e8 c3 df ff ff       	call   800ccd <strlen>
+  802d0a:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  802d0e:	89 d9                	mov    %ebx,%ecx
+  802d10:	83 c3 01             	add    $0x1,%ebx
+  802d13:	89 9d 38 fd ff ff    	mov    %ebx,-0x2c8(%ebp)
+  802d19:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  802d20:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  802d23:	83 c4 10             	add    $0x10,%esp
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	75 d7                	jne    802d01 <execv+0xb5>
+  802d2a:	89 95 2c fd ff ff    	mov    %edx,-0x2d4(%ebp)
+  802d30:	89 8d 30 fd ff ff    	mov    %ecx,-0x2d0(%ebp)
+  802d36:	be 00 10 40 00       	mov    $0x401000,%esi
+  802d3b:	29 fe                	sub    %edi,%esi
+  802d3d:	89 f2                	mov    %esi,%edx
+  802d3f:	83 e2 fc             	and    $0xfffffffc,%edx
+  802d42:	8d 04 8d 08 00 00 00 	lea    0x8(,%ecx,4),%eax
+  802d49:	89 d7                	mov    %edx,%edi
+  802d4b:	29 c7                	sub    %eax,%edi
+  802d4d:	8d 47 f8             	lea    -0x8(%edi),%eax
+  802d50:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802d55:	0f 86 1f 05 00 00    	jbe    80327a <execv+0x62e>
+  802d5b:	83 ec 04             	sub    $0x4,%esp
+  802d5e:	6a 07                	push   $0x7
+  802d60:	68 00 00 40 00       	push   $0x400000
+  802d65:	6a 00                	push   $0x0
+  802d67:	e8 0d e4 ff ff       	call   801179 <sys_page_alloc>
+  802d6c:	83 c4 10             	add    $0x10,%esp
+  802d6f:	85 c0                	test   %eax,%eax
+  802d71:	0f 88 08 05 00 00    	js     80327f <execv+0x633>
+  802d77:	85 db                	test   %ebx,%ebx
+  802d79:	7e 58                	jle    802dd3 <execv+0x187>
+  802d7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d80:	89 bd 34 fd ff ff    	mov    %edi,-0x2cc(%ebp)
+  802d86:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d89:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+  802d8f:	8d 86 00 d0 3f ee    	lea    -0x11c03000(%esi),%eax
+  802d95:	8b 8d 34 fd ff ff    	mov    -0x2cc(%ebp),%ecx
+  802d9b:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+  802d9e:	83 ec 08             	sub    $0x8,%esp
+  802da1:	ff 34 9f             	push   (%edi,%ebx,4)
+  802da4:	56                   	push   %esi
+  802da5:	e8 6f df ff ff       	call   800d19 <strcpy>
+  802daa:	83 c4 04             	add    $0x4,%esp
+  802dad:	ff 34 9f             	push   (%edi,%ebx,4)
+  802db0:	e8 18 df ff ff       	call   800ccd <strlen>
+  802db5:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  802db9:	83 c3 01             	add    $0x1,%ebx
+  802dbc:	83 c4 10             	add    $0x10,%esp
+  802dbf:	8b 8d 3c fd ff ff    	mov    -0x2c4(%ebp),%ecx
+  802dc5:	39 8d 30 fd ff ff    	cmp    %ecx,-0x2d0(%ebp)
+  802dcb:	75 bc                	jne    802d89 <execv+0x13d>
+  802dcd:	8b bd 34 fd ff ff    	mov    -0x2cc(%ebp),%edi
+  802dd3:	8b 85 2c fd ff ff    	mov    -0x2d4(%ebp),%eax
+  802dd9:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+  802de0:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  802de6:	0f 85 c5 00 00 00    	jne    802eb1 <execv+0x265>
+  802dec:	8d 87 00 d0 3f ee    	lea    -0x11c03000(%edi),%eax
+  802df2:	89 47 fc             	mov    %eax,-0x4(%edi)
+  802df5:	8b 85 38 fd ff ff    	mov    -0x2c8(%ebp),%eax
+  802dfb:	89 47 f8             	mov    %eax,-0x8(%edi)
+  802dfe:	8d 87 f8 cf 3f ee    	lea    -0x11c03008(%edi),%eax
+  802e04:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+  802e0a:	83 ec 0c             	sub    $0xc,%esp
+  802e0d:	6a 07                	push   $0x7
+  802e0f:	68 00 d0 7f ee       	push   $0xee7fd000
+  802e14:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  802e1a:	68 00 00 40 00       	push   $0x400000
+  802e1f:	6a 00                	push   $0x0
+  802e21:	e8 96 e3 ff ff       	call   8011bc <sys_page_map>
+  802e26:	89 c3                	mov    %eax,%ebx
+  802e28:	83 c4 20             	add    $0x20,%esp
+  802e2b:	85 c0                	test   %eax,%eax
+  802e2d:	0f 88 54 04 00 00    	js     803287 <execv+0x63b>
+  802e33:	83 ec 08             	sub    $0x8,%esp
+  802e36:	68 00 00 40 00       	push   $0x400000
+  802e3b:	6a 00                	push   $0x0
+  802e3d:	e8 09 e4 ff ff       	call   80124b <sys_page_unmap>
+  802e42:	89 c3                	mov    %eax,%ebx
+  802e44:	83 c4 10             	add    $0x10,%esp
+  802e47:	85 c0                	test   %eax,%eax
+  802e49:	0f 88 38 04 00 00    	js     803287 <execv+0x63b>
+  802e4f:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802e55:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+  802e5c:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  802e63:	00 
+  802e64:	0f 84 01 04 00 00    	je     80326b <execv+0x61f>
+  802e6a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e74:	e9 88 00 00 00       	jmp    802f01 <execv+0x2b5>
+  802e79:	83 ec 0c             	sub    $0xc,%esp
+  802e7c:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802e82:	e8 2e f2 ff ff       	call   8020b5 <close>
+  802e87:	83 c4 0c             	add    $0xc,%esp
+  802e8a:	68 7f 45 4c 46       	push   $0x464c457f
+  802e8f:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802e95:	68 19 4a 80 00       	push   $0x804a19
+  802e9a:	e8 83 d7 ff ff       	call   800622 <cprintf>
+  802e9f:	83 c4 10             	add    $0x10,%esp
+  802ea2:	c7 85 44 fd ff ff f2 	movl   $0xfffffff2,-0x2bc(%ebp)
+  802ea9:	ff ff ff 
+  802eac:	e9 ac 03 00 00       	jmp    80325d <execv+0x611>
+  802eb1:	68 a0 4a 80 00       	push   $0x804aa0
+  802eb6:	68 33 4a 80 00       	push   $0x804a33
+  802ebb:	68 41 01 00 00       	push   $0x141
+  802ec0:	68 0d 4a 80 00       	push   $0x804a0d
+  802ec5:	e8 7d d6 ff ff       	call   800547 <_panic>
+  802eca:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  802ecd:	50                   	push   %eax
+  802ece:	ff 73 04             	push   0x4(%ebx)
+  802ed1:	ff 73 10             	push   0x10(%ebx)
+  802ed4:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802eda:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802ee0:	e8 3c fc ff ff       	call   802b21 <map_segment>
+  802ee5:	83 c4 10             	add    $0x10,%esp
+  802ee8:	85 c0                	test   %eax,%eax
+  802eea:	0f 88 34 03 00 00    	js     803224 <execv+0x5d8>
+  802ef0:	83 c7 01             	add    $0x1,%edi
+  802ef3:	83 c3 20             	add    $0x20,%ebx
+  802ef6:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802efd:	39 f8                	cmp    %edi,%eax
+  802eff:	7e 5d                	jle    802f5e <execv+0x312>
+  802f01:	83 3b 01             	cmpl   $0x1,(%ebx)
+  802f04:	75 ea                	jne    802ef0 <execv+0x2a4>
+  802f06:	8b 43 18             	mov    0x18(%ebx),%eax
+  802f09:	83 e0 02             	and    $0x2,%eax
+  802f0c:	83 f8 01             	cmp    $0x1,%eax
+  802f0f:	19 c0                	sbb    %eax,%eax
+  802f11:	83 e0 fe             	and    $0xfffffffe,%eax
+  802f14:	83 c0 07             	add    $0x7,%eax
+  802f17:	8b 53 08             	mov    0x8(%ebx),%edx
+  802f1a:	81 fa ff ff 7f 00    	cmp    $0x7fffff,%edx
+  802f20:	76 a8                	jbe    802eca <execv+0x27e>
+  802f22:	83 fe 03             	cmp    $0x3,%esi
+  802f25:	7f a3                	jg     802eca <execv+0x27e>
+  802f27:	8d 0c b6             	lea    (%esi,%esi,4),%ecx
+  802f2a:	c1 e1 02             	shl    $0x2,%ecx
+  802f2d:	89 94 0d 54 fd ff ff 	mov    %edx,-0x2ac(%ebp,%ecx,1)
+  802f34:	8b 53 14             	mov    0x14(%ebx),%edx
+  802f37:	89 94 0d 58 fd ff ff 	mov    %edx,-0x2a8(%ebp,%ecx,1)
+  802f3e:	8b 53 10             	mov    0x10(%ebx),%edx
+  802f41:	89 94 0d 5c fd ff ff 	mov    %edx,-0x2a4(%ebp,%ecx,1)
+  802f48:	8b 53 04             	mov    0x4(%ebx),%edx
+  802f4b:	89 94 0d 60 fd ff ff 	mov    %edx,-0x2a0(%ebp,%ecx,1)
+  802f52:	89 84 0d 64 fd ff ff 	mov    %eax,-0x29c(%ebp,%ecx,1)
+  802f59:	83 c6 01             	add    $0x1,%esi
+  802f5c:	eb 92                	jmp    802ef0 <execv+0x2a4>
+  802f5e:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  802f65:	00 00 00 
+  802f68:	85 f6                	test   %esi,%esi
+  802f6a:	7f 12                	jg     802f7e <execv+0x332>
+  802f6c:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802f72:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  802f79:	00 00 00 
+  802f7c:	eb 7e                	jmp    802ffc <execv+0x3b0>
+  802f7e:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  802f84:	50                   	push   %eax
+  802f85:	56                   	push   %esi
+  802f86:	8d 85 54 fd ff ff    	lea    -0x2ac(%ebp),%eax
+  802f8c:	50                   	push   %eax
+  802f8d:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802f93:	e8 a4 fa ff ff       	call   802a3c <file_image>
+  802f98:	89 85 3c fd ff ff    	mov    %eax,-0x2c4(%ebp)
+  802f9e:	83 c4 10             	add    $0x10,%esp
+  802fa1:	85 c0                	test   %eax,%eax
+  802fa3:	0f 88 9e 00 00 00    	js     803047 <execv+0x3fb>
+  802fa9:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802faf:	85 c0                	test   %eax,%eax
+  802fb1:	75 49                	jne    802ffc <execv+0x3b0>
+  802fb3:	8d 9d 54 fd ff ff    	lea    -0x2ac(%ebp),%ebx
+  802fb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fbe:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  802fc1:	8b 13                	mov    (%ebx),%edx
+  802fc3:	ff 73 10             	push   0x10(%ebx)
+  802fc6:	ff 73 0c             	push   0xc(%ebx)
+  802fc9:	ff 73 08             	push   0x8(%ebx)
+  802fcc:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  802fd2:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  802fd8:	e8 44 fb ff ff       	call   802b21 <map_segment>
+  802fdd:	83 c4 10             	add    $0x10,%esp
+  802fe0:	85 c0                	test   %eax,%eax
+  802fe2:	0f 88 65 02 00 00    	js     80324d <execv+0x601>
+  802fe8:	83 c7 01             	add    $0x1,%edi
+  802feb:	8b 85 50 fd ff ff    	mov    -0x2b0(%ebp),%eax
+  802ff1:	83 c3 14             	add    $0x14,%ebx
+  802ff4:	39 fe                	cmp    %edi,%esi
+  802ff6:	7e 04                	jle    802ffc <execv+0x3b0>
+  802ff8:	85 c0                	test   %eax,%eax
+  802ffa:	74 c2                	je     802fbe <execv+0x372>
+  802ffc:	83 ec 04             	sub    $0x4,%esp
+  802fff:	ff b5 3c fd ff ff    	push   -0x2c4(%ebp)
+  803005:	50                   	push   %eax
+  803006:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80300c:	e8 51 e9 ff ff       	call   801962 <sys_env_set_pager>
+  803011:	89 c7                	mov    %eax,%edi
+  803013:	83 c4 10             	add    $0x10,%esp
+  803016:	85 c0                	test   %eax,%eax
+  803018:	0f 88 08 02 00 00    	js     803226 <execv+0x5da>
+  80301e:	83 ec 0c             	sub    $0xc,%esp
+  803021:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  803027:	e8 89 f0 ff ff       	call   8020b5 <close>
+  80302c:	e8 ef ea ff ff       	call   801b20 <dupq_begin>
+  803031:	89 c7                	mov    %eax,%edi
+  803033:	83 c4 10             	add    $0x10,%esp
+  803036:	89 c1                	mov    %eax,%ecx
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	0f 88 91 00 00 00    	js     8030d1 <execv+0x485>
+  803040:	be 02 00 00 00       	mov    $0x2,%esi
+  803045:	eb 33                	jmp    80307a <execv+0x42e>
+  803047:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  80304e:	00 00 00 
+  803051:	c7 85 3c fd ff ff 00 	movl   $0x0,-0x2c4(%ebp)
+  803058:	00 00 00 
+  80305b:	e9 53 ff ff ff       	jmp    802fb3 <execv+0x367>
+  803060:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803067:	a8 01                	test   $0x1,%al
+  803069:	75 7b                	jne    8030e6 <execv+0x49a>
+  80306b:	83 c6 01             	add    $0x1,%esi
+  80306e:	81 fe ba 03 00 00    	cmp    $0x3ba,%esi
+  803074:	0f 84 e5 00 00 00    	je     80315f <execv+0x513>
+  80307a:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803081:	a8 01                	test   $0x1,%al
+  803083:	74 db                	je     803060 <execv+0x414>
+  803085:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80308c:	a8 80                	test   $0x80,%al
+  80308e:	74 d0                	je     803060 <execv+0x414>
+  803090:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803097:	f6 c4 04             	test   $0x4,%ah
+  80309a:	74 cf                	je     80306b <execv+0x41f>
+  80309c:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8030a3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030a8:	0c 80                	or     $0x80,%al
+  8030aa:	50                   	push   %eax
+  8030ab:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8030b1:	89 f0                	mov    %esi,%eax
+  8030b3:	c1 e0 16             	shl    $0x16,%eax
+  8030b6:	c1 e8 0c             	shr    $0xc,%eax
+  8030b9:	50                   	push   %eax
+  8030ba:	6a 00                	push   $0x0
+  8030bc:	e8 7f ea ff ff       	call   801b40 <dupq_map>
+  8030c1:	89 c1                	mov    %eax,%ecx
+  8030c3:	83 c4 10             	add    $0x10,%esp
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	79 a1                	jns    80306b <execv+0x41f>
+  8030ca:	89 c7                	mov    %eax,%edi
+  8030cc:	e8 d2 ea ff ff       	call   801ba3 <dupq_end>
+  8030d1:	57                   	push   %edi
+  8030d2:	68 48 4a 80 00       	push   $0x804a48
+  8030d7:	68 ac 00 00 00       	push   $0xac
+  8030dc:	68 0d 4a 80 00       	push   $0x804a0d
+  8030e1:	e8 61 d4 ff ff       	call   800547 <_panic>
+  8030e6:	89 f7                	mov    %esi,%edi
+  8030e8:	c1 e7 16             	shl    $0x16,%edi
+  8030eb:	89 f8                	mov    %edi,%eax
+  8030ed:	c1 e8 0c             	shr    $0xc,%eax
+  8030f0:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8030f5:	eb 24                	jmp    80311b <execv+0x4cf>
+  8030f7:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+  8030fd:	0f 84 68 ff ff ff    	je     80306b <execv+0x41f>
+  803103:	89 d8                	mov    %ebx,%eax
+  803105:	09 f8                	or     %edi,%eax
+  803107:	c1 e8 0c             	shr    $0xc,%eax
+  80310a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803110:	3d ff e7 0e 00       	cmp    $0xee7ff,%eax
+  803115:	0f 84 50 ff ff ff    	je     80306b <execv+0x41f>
+  80311b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803122:	f6 c2 01             	test   $0x1,%dl
+  803125:	74 d0                	je     8030f7 <execv+0x4ab>
+  803127:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80312e:	f6 c6 04             	test   $0x4,%dh
+  803131:	74 c4                	je     8030f7 <execv+0x4ab>
+  803133:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80313a:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+  803140:	52                   	push   %edx
+  803141:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803147:	50                   	push   %eax
+  803148:	6a 00                	push   $0x0
+  80314a:	e8 f1 e9 ff ff       	call   801b40 <dupq_map>
+  80314f:	89 c1                	mov    %eax,%ecx
+  803151:	83 c4 10             	add    $0x10,%esp
+  803154:	85 c0                	test   %eax,%eax
+  803156:	79 9f                	jns    8030f7 <execv+0x4ab>
+  803158:	89 c7                	mov    %eax,%edi
+  80315a:	e9 6d ff ff ff       	jmp    8030cc <execv+0x480>
+  80315f:	89 cf                	mov    %ecx,%edi
+  803161:	85 c9                	test   %ecx,%ecx
+  803163:	0f 88 63 ff ff ff    	js     8030cc <execv+0x480>
+  803169:	e8 35 ea ff ff       	call   801ba3 <dupq_end>
+  80316e:	89 c7                	mov    %eax,%edi
+  803170:	85 c0                	test   %eax,%eax
+  803172:	0f 88 59 ff ff ff    	js     8030d1 <execv+0x485>
+  803178:	83 ec 08             	sub    $0x8,%esp
+  80317b:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803181:	50                   	push   %eax
+  803182:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  803188:	e8 61 e1 ff ff       	call   8012ee <sys_env_set_trapframe>
+  80318d:	83 c4 10             	add    $0x10,%esp
+  803190:	85 c0                	test   %eax,%eax
+  803192:	78 2e                	js     8031c2 <execv+0x576>
+  803194:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803198:	74 52                	je     8031ec <execv+0x5a0>
+  80319a:	83 ec 08             	sub    $0x8,%esp
+  80319d:	6a 02                	push   $0x2
+  80319f:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8031a5:	e8 02 e1 ff ff       	call   8012ac <sys_env_set_status>
+  8031aa:	83 c4 10             	add    $0x10,%esp
+  8031ad:	85 c0                	test   %eax,%eax
+  8031af:	78 26                	js     8031d7 <execv+0x58b>
+  8031b1:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  8031b7:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  8031bd:	e9 9b 00 00 00       	jmp    80325d <execv+0x611>
+  8031c2:	50                   	push   %eax
+  8031c3:	68 5e 4a 80 00       	push   $0x804a5e
+  8031c8:	68 af 00 00 00       	push   $0xaf
+  8031cd:	68 0d 4a 80 00       	push   $0x804a0d
+  8031d2:	e8 70 d3 ff ff       	call   800547 <_panic>
+  8031d7:	50                   	push   %eax
+  8031d8:	68 78 4a 80 00       	push   $0x804a78
+  8031dd:	68 b3 00 00 00       	push   $0xb3
+  8031e2:	68 0d 4a 80 00       	push   $0x804a0d
+  8031e7:	e8 5b d3 ff ff       	call   800547 <_panic>
+  8031ec:	83 ec 0c             	sub    $0xc,%esp
+  8031ef:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  8031f5:	e8 92 e3 ff ff       	call   80158c <sys_env_swap>
+  8031fa:	83 c4 10             	add    $0x10,%esp
+  8031fd:	85 c0                	test   %eax,%eax
+  8031ff:	78 0e                	js     80320f <execv+0x5c3>
+  803201:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  803207:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80320d:	eb 4e                	jmp    80325d <execv+0x611>
+  80320f:	50                   	push   %eax
+  803210:	68 8f 4a 80 00       	push   $0x804a8f
+  803215:	68 ba 00 00 00       	push   $0xba
+  80321a:	68 0d 4a 80 00       	push   $0x804a0d
+  80321f:	e8 23 d3 ff ff       	call   800547 <_panic>
+  803224:	89 c7                	mov    %eax,%edi
+  803226:	83 ec 0c             	sub    $0xc,%esp
+  803229:	ff b5 40 fd ff ff    	push   -0x2c0(%ebp)
+  80322f:	e8 9a de ff ff       	call   8010ce <sys_env_destroy>
+  803234:	83 c4 04             	add    $0x4,%esp
+  803237:	ff b5 44 fd ff ff    	push   -0x2bc(%ebp)
+  80323d:	e8 73 ee ff ff       	call   8020b5 <close>
+  803242:	83 c4 10             	add    $0x10,%esp
+  803245:	89 bd 44 fd ff ff    	mov    %edi,-0x2bc(%ebp)
+  80324b:	eb 10                	jmp    80325d <execv+0x611>
+  80324d:	89 c7                	mov    %eax,%edi
+  80324f:	eb d5                	jmp    803226 <execv+0x5da>
+  803251:	8b 85 40 fd ff ff    	mov    -0x2c0(%ebp),%eax
+  803257:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  80325d:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  803263:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803266:	5b                   	pop    %ebx
+  803267:	5e                   	pop    %esi
+  803268:	5f                   	pop    %edi
+  803269:	5d                   	pop    %ebp
+  80326a:	c3                   	ret
+  80326b:	c7 85 50 fd ff ff 00 	movl   $0x0,-0x2b0(%ebp)
+  803272:	00 00 00 
+  803275:	e9 f2 fc ff ff       	jmp    802f6c <execv+0x320>
+  80327a:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80327f:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  803285:	eb d6                	jmp    80325d <execv+0x611>
+  803287:	83 ec 08             	sub    $0x8,%esp
+  80328a:	68 00 00 40 00       	push   $0x400000
+  80328f:	6a 00                	push   $0x0
+  803291:	e8 b5 df ff ff       	call   80124b <sys_page_unmap>
+  803296:	83 c4 10             	add    $0x10,%esp
+  803299:	89 9d 44 fd ff ff    	mov    %ebx,-0x2bc(%ebp)
+  80329f:	eb bc                	jmp    80325d <execv+0x611>
+  8032a1:	83 ec 04             	sub    $0x4,%esp
+  8032a4:	6a 07                	push   $0x7
+  8032a6:	68 00 00 40 00       	push   $0x400000
+  8032ab:	6a 00                	push   $0x0
+  8032ad:	e8 c7 de ff ff       	call   801179 <sys_page_alloc>
+  8032b2:	83 c4 10             	add    $0x10,%esp
+  8032b5:	85 c0                	test   %eax,%eax
+  8032b7:	78 c6                	js     80327f <execv+0x633>
+  8032b9:	c7 85 2c fd ff ff 00 	movl   $0x0,-0x2d4(%ebp)
+  8032c0:	00 00 00 
+  8032c3:	c7 85 38 fd ff ff 00 	movl   $0x0,-0x2c8(%ebp)
+  8032ca:	00 00 00 
+  8032cd:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+  8032d2:	be 00 10 40 00       	mov    $0x401000,%esi
+  8032d7:	e9 f7 fa ff ff       	jmp    802dd3 <execv+0x187>
+
+008032dc <spawn>:
+  8032dc:	55                   	push   %ebp
+  8032dd:	89 e5                	mov    %esp,%ebp
+  8032df:	83 ec 0c             	sub    $0xc,%esp
+  8032e2:	6a 01                	push   $0x1
+  8032e4:	ff 75 0c             	push   0xc(%ebp)
+  8032e7:	ff 75 08             	push   0x8(%ebp)
+  8032ea:	e8 5d f9 ff ff       	call   802c4c <execv>
+  8032ef:	c9                   	leave
+  8032f0:	c3                   	ret
+
+008032f1 <exec>:
+  8032f1:	55                   	push   %ebp
+  8032f2:	89 e5                	mov    %esp,%ebp
+  8032f4:	83 ec 0c             	sub    $0xc,%esp
+  8032f7:	6a 00                	push   $0x0
+  8032f9:	ff 75 0c             	push   0xc(%ebp)
+  8032fc:	ff 75 08             	push   0x8(%ebp)
+  8032ff:	e8 48 f9 ff ff       	call   802c4c <execv>
+  803304:	c9                   	leave
+  803305:	c3                   	ret
+
+00803306 <spawnl>:
+  803306:	55                   	push   %ebp
+  803307:	89 e5                	mov    %esp,%ebp
+  803309:	56                   	push   %esi
+  80330a:	53                   	push   %ebx
+  80330b:	8d 45 10             	lea    0x10(%ebp),%eax
+  80330e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803313:	eb 05                	jmp    80331a <spawnl+0x14>
+  803315:	83 c1 01             	add    $0x1,%ecx
+  803318:	89 d0                	mov    %edx,%eax
+  80331a:	8d 50 04             	lea    0x4(%eax),%edx
+  80331d:	83 38 00             	cmpl   $0x0,(%eax)
+  803320:	75 f3                	jne    803315 <spawnl+0xf>
+  803322:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  803329:	83 e0 f0             	and    $0xfffffff0,%eax
+  80332c:	29 c4                	sub    %eax,%esp
+  80332e:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803332:	89 d8                	mov    %ebx,%eax
+  803334:	c1 e8 02             	shr    $0x2,%eax
+  803337:	83 e3 fc             	and    $0xfffffffc,%ebx
+  80333a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80333d:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  803344:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  80334b:	00 
+  80334c:	8d 55 10             	lea    0x10(%ebp),%edx
+  80334f:	89 ce                	mov    %ecx,%esi
+  803351:	85 c9                	test   %ecx,%ecx
+  803353:	74 16                	je     80336b <spawnl+0x65>
+  803355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335a:	83 c0 01             	add    $0x1,%eax
+  80335d:	89 d1                	mov    %edx,%ecx
+  80335f:	83 c2 04             	add    $0x4,%edx
+  803362:	8b 09                	mov    (%ecx),%ecx
+  803364:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  803367:	39 f0                	cmp    %esi,%eax
+  803369:	75 ef                	jne    80335a <spawnl+0x54>
+  80336b:	83 ec 08             	sub    $0x8,%esp
+  80336e:	53                   	push   %ebx
+  80336f:	ff 75 08             	push   0x8(%ebp)
+  803372:	e8 65 ff ff ff       	call   8032dc <spawn>
+  803377:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80337a:	5b                   	pop    %ebx
+  80337b:	5e                   	pop    %esi
+  80337c:	5d                   	pop    %ebp
+  80337d:	c3                   	ret
+
+0080337e <execl>:
+  80337e:	55                   	push   %ebp
+  80337f:	89 e5                	mov    %esp,%ebp
+  803381:	56                   	push   %esi
+  803382:	53                   	push   %ebx
+  803383:	8d 45 10             	lea    0x10(%ebp),%eax
+  803386:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80338b:	eb 05                	jmp    803392 <execl+0x14>
+  80338d:	83 c1 01             	add    $0x1,%ecx
+  803390:	89 d0                	mov    %edx,%eax
+  803392:	8d 50 04             	lea    0x4(%eax),%edx
+  803395:	83 38 00             	cmpl   $0x0,(%eax)
+  803398:	75 f3                	jne    80338d <execl+0xf>
+  80339a:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  8033a1:	83 e0 f0             	and    $0xfffffff0,%eax
+  8033a4:	29 c4                	sub    %eax,%esp
+  8033a6:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8033aa:	89 d8                	mov    %ebx,%eax
+  8033ac:	c1 e8 02             	shr    $0x2,%eax
+  8033af:	83 e3 fc             	and    $0xfffffffc,%ebx
+  8033b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033b5:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  8033bc:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  8033c3:	00 
+  8033c4:	8d 55 10             	lea    0x10(%ebp),%edx
+  8033c7:	89 ce                	mov    %ecx,%esi
+  8033c9:	85 c9                	test   %ecx,%ecx
+  8033cb:	74 16                	je     8033e3 <execl+0x65>
+  8033cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d2:	83 c0 01             	add    $0x1,%eax
+  8033d5:	89 d1                	mov    %edx,%ecx
+  8033d7:	83 c2 04             	add    $0x4,%edx
+  8033da:	8b 09                	mov    (%ecx),%ecx
+  8033dc:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  8033df:	39 f0                	cmp    %esi,%eax
+  8033e1:	75 ef                	jne    8033d2 <execl+0x54>
+  8033e3:	83 ec 08             	sub    $0x8,%esp
+  8033e6:	53                   	push   %ebx
+  8033e7:	ff 75 08             	push   0x8(%ebp)
+  8033ea:	e8 02 ff ff ff       	call   8032f1 <exec>
+  8033ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033f2:	5b                   	pop    %ebx
+  8033f3:	5e                   	pop    %esi
+  8033f4:	5d                   	pop    %ebp
+  8033f5:	c3                   	ret
+
+008033f6 <devsock_stat>:
+  8033f6:	55                   	push   %ebp
+  8033f7:	89 e5                	mov    %esp,%ebp
+  8033f9:	83 ec 10             	sub    $0x10,%esp
+  8033fc:	68 c6 4a 80 00       	push   $0x804ac6
+  803401:	ff 75 0c             	push   0xc(%ebp)
+  803404:	e8 10 d9 ff ff       	call   800d19 <strcpy>
+  803409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340e:	c9                   	leave
+  80340f:	c3                   	ret
+
+00803410 <devsock_close>:
+  803410:	55                   	push   %ebp
+  803411:	89 e5                	mov    %esp,%ebp
+  803413:	53                   	push   %ebx
+  803414:	83 ec 10             	sub    $0x10,%esp
+  803417:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80341a:	53                   	push   %ebx
+  80341b:	e8 15 0d 00 00       	call   804135 <pageref>
+  803420:	89 c2                	mov    %eax,%edx
+  803422:	83 c4 10             	add    $0x10,%esp
+  803425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342a:	83 fa 01             	cmp    $0x1,%edx
+  80342d:	74 05                	je     803434 <devsock_close+0x24>
+  80342f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803432:	c9                   	leave
+  803433:	c3                   	ret
+  803434:	83 ec 0c             	sub    $0xc,%esp
+  803437:	ff 73 0c             	push   0xc(%ebx)
+  80343a:	e8 aa 02 00 00       	call   8036e9 <nsipc_close>
+  80343f:	83 c4 10             	add    $0x10,%esp
+  803442:	eb eb                	jmp    80342f <devsock_close+0x1f>
+
+00803444 <devsock_write>:
+  803444:	55                   	push   %ebp
+  803445:	89 e5                	mov    %esp,%ebp
+  803447:	83 ec 08             	sub    $0x8,%esp
+  80344a:	6a 00                	push   $0x0
+  80344c:	ff 75 10             	push   0x10(%ebp)
+  80344f:	ff 75 0c             	push   0xc(%ebp)
+  803452:	8b 45 08             	mov    0x8(%ebp),%eax
+  803455:	ff 70 0c             	push   0xc(%eax)
+  803458:	e8 6c 03 00 00       	call   8037c9 <nsipc_send>
+  80345d:	c9                   	leave
+  80345e:	c3                   	ret
+
+0080345f <devsock_read>:
+  80345f:	55                   	push   %ebp
+  803460:	89 e5                	mov    %esp,%ebp
+  803462:	83 ec 08             	sub    $0x8,%esp
+  803465:	6a 00                	push   $0x0
+  803467:	ff 75 10             	push   0x10(%ebp)
+  80346a:	ff 75 0c             	push   0xc(%ebp)
+  80346d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803470:	ff 70 0c             	push   0xc(%eax)
+  803473:	e8 e2 02 00 00       	call   80375a <nsipc_recv>
+  803478:	c9                   	leave
+  803479:	c3                   	ret
+
+0080347a <fd2sockid>:
+  80347a:	55                   	push   %ebp
+  80347b:	89 e5                	mov    %esp,%ebp
+  80347d:	83 ec 20             	sub    $0x20,%esp
+  803480:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803483:	52                   	push   %edx
+  803484:	50                   	push   %eax
+  803485:	e8 05 eb ff ff       	call   801f8f <fd_lookup>
+  80348a:	83 c4 10             	add    $0x10,%esp
+  80348d:	85 c0                	test   %eax,%eax
+  80348f:	78 10                	js     8034a1 <fd2sockid+0x27>
+  803491:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803494:	8b 0d 3c 50 80 00    	mov    0x80503c,%ecx
+  80349a:	39 08                	cmp    %ecx,(%eax)
+  80349c:	75 05                	jne    8034a3 <fd2sockid+0x29>
+  80349e:	8b 40 0c             	mov    0xc(%eax),%eax
+  8034a1:	c9                   	leave
+  8034a2:	c3                   	ret
+  8034a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8034a8:	eb f7                	jmp    8034a1 <fd2sockid+0x27>
+
+008034aa <alloc_sockfd>:
+  8034aa:	55                   	push   %ebp
+  8034ab:	89 e5                	mov    %esp,%ebp
+  8034ad:	56                   	push   %esi
+  8034ae:	53                   	push   %ebx
+  8034af:	83 ec 1c             	sub    $0x1c,%esp
+  8034b2:	89 c6                	mov    %eax,%esi
+  8034b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034b7:	50                   	push   %eax
+  8034b8:	e8 82 ea ff ff       	call   801f3f <fd_alloc>
+  8034bd:	89 c3                	mov    %eax,%ebx
+  8034bf:	83 c4 10             	add    $0x10,%esp
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	78 43                	js     803509 <alloc_sockfd+0x5f>
+  8034c6:	83 ec 04             	sub    $0x4,%esp
+  8034c9:	68 07 04 00 00       	push   $0x407
+  8034ce:	ff 75 f4             	push   -0xc(%ebp)
+  8034d1:	6a 00                	push   $0x0
+  8034d3:	e8 a1 dc ff ff       	call   801179 <sys_page_alloc>
+  8034d8:	89 c3                	mov    %eax,%ebx
+  8034da:	83 c4 10             	add    $0x10,%esp
+  8034dd:	85 c0                	test   %eax,%eax
+  8034df:	78 28                	js     803509 <alloc_sockfd+0x5f>
+  8034e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034e4:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  8034ea:	89 10                	mov    %edx,(%eax)
+  8034ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034ef:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8034f6:	89 70 0c             	mov    %esi,0xc(%eax)
+  8034f9:	83 ec 0c             	sub    $0xc,%esp
+  8034fc:	50                   	push   %eax
+  8034fd:	e8 16 ea ff ff       	call   801f18 <fd2num>
+  803502:	89 c3                	mov    %eax,%ebx
+  803504:	83 c4 10             	add    $0x10,%esp
+  803507:	eb 0c                	jmp    803515 <alloc_sockfd+0x6b>
+  803509:	83 ec 0c             	sub    $0xc,%esp
+  80350c:	56                   	push   %esi
+  80350d:	e8 d7 01 00 00       	call   8036e9 <nsipc_close>
+  803512:	83 c4 10             	add    $0x10,%esp
+  803515:	89 d8                	mov    %ebx,%eax
+  803517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80351a:	5b                   	pop    %ebx
+  80351b:	5e                   	pop    %esi
+  80351c:	5d                   	pop    %ebp
+  80351d:	c3                   	ret
+
+0080351e <accept>:
+  80351e:	55                   	push   %ebp
+  80351f:	89 e5                	mov    %esp,%ebp
+  803521:	83 ec 08             	sub    $0x8,%esp
+  803524:	8b 45 08             	mov    0x8(%ebp),%eax
+  803527:	e8 4e ff ff ff       	call   80347a <fd2sockid>
+  80352c:	85 c0                	test   %eax,%eax
+  80352e:	78 1b                	js     80354b <accept+0x2d>
+  803530:	83 ec 04             	sub    $0x4,%esp
+  803533:	ff 75 10             	push   0x10(%ebp)
+  803536:	ff 75 0c             	push   0xc(%ebp)
+  803539:	50                   	push   %eax
+  80353a:	e8 07 01 00 00       	call   803646 <nsipc_accept>
+  80353f:	83 c4 10             	add    $0x10,%esp
+  803542:	85 c0                	test   %eax,%eax
+  803544:	78 05                	js     80354b <accept+0x2d>
+  803546:	e8 5f ff ff ff       	call   8034aa <alloc_sockfd>
+  80354b:	c9                   	leave
+  80354c:	c3                   	ret
+
+0080354d <bind>:
+  80354d:	55                   	push   %ebp
+  80354e:	89 e5                	mov    %esp,%ebp
+  803550:	83 ec 08             	sub    $0x8,%esp
+  803553:	8b 45 08             	mov    0x8(%ebp),%eax
+  803556:	e8 1f ff ff ff       	call   80347a <fd2sockid>
+  80355b:	85 c0                	test   %eax,%eax
+  80355d:	78 12                	js     803571 <bind+0x24>
+  80355f:	83 ec 04             	sub    $0x4,%esp
+  803562:	ff 75 10             	push   0x10(%ebp)
+  803565:	ff 75 0c             	push   0xc(%ebp)
+  803568:	50                   	push   %eax
+  803569:	e8 24 01 00 00       	call   803692 <nsipc_bind>
+  80356e:	83 c4 10             	add    $0x10,%esp
+  803571:	c9                   	leave
+  803572:	c3                   	ret
+
+00803573 <shutdown>:
+  803573:	55                   	push   %ebp
+  803574:	89 e5                	mov    %esp,%ebp
+  803576:	83 ec 08             	sub    $0x8,%esp
+  803579:	8b 45 08             	mov    0x8(%ebp),%eax
+  80357c:	e8 f9 fe ff ff       	call   80347a <fd2sockid>
+  803581:	85 c0                	test   %eax,%eax
+  803583:	78 0f                	js     803594 <shutdown+0x21>
+  803585:	83 ec 08             	sub    $0x8,%esp
+  803588:	ff 75 0c             	push   0xc(%ebp)
+  80358b:	50                   	push   %eax
+  80358c:	e8 36 01 00 00       	call   8036c7 <nsipc_shutdown>
+  803591:	83 c4 10             	add    $0x10,%esp
+  803594:	c9                   	leave
+  803595:	c3                   	ret
+
+00803596 <connect>:
+  803596:	55                   	push   %ebp
+  803597:	89 e5                	mov    %esp,%ebp
+  803599:	83 ec 08             	sub    $0x8,%esp
+  80359c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80359f:	e8 d6 fe ff ff       	call   80347a <fd2sockid>
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	78 12                	js     8035ba <connect+0x24>
+  8035a8:	83 ec 04             	sub    $0x4,%esp
+  8035ab:	ff 75 10             	push   0x10(%ebp)
+  8035ae:	ff 75 0c             	push   0xc(%ebp)
+  8035b1:	50                   	push   %eax
+  8035b2:	e8 4c 01 00 00       	call   803703 <nsipc_connect>
+  8035b7:	83 c4 10             	add    $0x10,%esp
+  8035ba:	c9                   	leave
+  8035bb:	c3                   	ret
+
+008035bc <listen>:
+  8035bc:	55                   	push   %ebp
+  8035bd:	89 e5                	mov    %esp,%ebp
+  8035bf:	83 ec 08             	sub    $0x8,%esp
+  8035c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c5:	e8 b0 fe ff ff       	call   80347a <fd2sockid>
+  8035ca:	85 c0                	test   %eax,%eax
+  8035cc:	78 0f                	js     8035dd <listen+0x21>
+  8035ce:	83 ec 08             	sub    $0x8,%esp
+  8035d1:	ff 75 0c             	push   0xc(%ebp)
+  8035d4:	50                   	push   %eax
+  8035d5:	e8 5e 01 00 00       	call   803738 <nsipc_listen>
+  8035da:	83 c4 10             	add    $0x10,%esp
+  8035dd:	c9                   	leave
+  8035de:	c3                   	ret
+
+008035df <socket>:
+  8035df:	55                   	push   %ebp
+  8035e0:	89 e5                	mov    %esp,%ebp
+  8035e2:	83 ec 0c             	sub    $0xc,%esp
+  8035e5:	ff 75 10             	push   0x10(%ebp)
+  8035e8:	ff 75 0c             	push   0xc(%ebp)
+  8035eb:	ff 75 08             	push   0x8(%ebp)
+  8035ee:	e8 34 02 00 00       	call   803827 <nsipc_socket>
+  8035f3:	83 c4 10             	add    $0x10,%esp
+  8035f6:	85 c0                	test   %eax,%eax
+  8035f8:	78 05                	js     8035ff <socket+0x20>
+  8035fa:	e8 ab fe ff ff       	call   8034aa <alloc_sockfd>
+  8035ff:	c9                   	leave
+  803600:	c3                   	ret
+
+00803601 <nsipc>:
+  803601:	55                   	push   %ebp
+  803602:	89 e5                	mov    %esp,%ebp
+  803604:	53                   	push   %ebx
+  803605:	83 ec 04             	sub    $0x4,%esp
+  803608:	89 c3                	mov    %eax,%ebx
+  80360a:	83 3d 10 60 80 00 00 	cmpl   $0x0,0x806010
+  803611:	74 1f                	je     803632 <nsipc+0x31>
+  803613:	83 ec 08             	sub    $0x8,%esp
+  803616:	6a 00                	push   $0x0
+  803618:	6a 00                	push   $0x0
+  80361a:	6a 07                	push   $0x7
+  80361c:	68 00 80 80 00       	push   $0x808000
+  803621:	53                   	push   %ebx
+  803622:	ff 35 10 60 80 00    	push   0x806010
+  803628:	e8 53 09 00 00       	call   803f80 <ipc_call>
+  80362d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803630:	c9                   	leave
+  803631:	c3                   	ret
+  803632:	83 ec 0c             	sub    $0xc,%esp
+  803635:	6a 03                	push   $0x3
+  803637:	e8 df 0a 00 00       	call   80411b <ipc_find_env>
+  80363c:	a3 10 60 80 00       	mov    %eax,0x806010
+  803641:	83 c4 10             	add    $0x10,%esp
+  803644:	eb cd                	jmp    803613 <nsipc+0x12>
+
+00803646 <nsipc_accept>:
+  803646:	55                   	push   %ebp
+  803647:	89 e5                	mov    %esp,%ebp
+  803649:	53                   	push   %ebx
+  80364a:	83 ec 04             	sub    $0x4,%esp
+  80364d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803650:	a3 00 80 80 00       	mov    %eax,0x808000
+  803655:	b8 01 00 00 00       	mov    $0x1,%eax
+  80365a:	e8 a2 ff ff ff       	call   803601 <nsipc>
+  80365f:	89 c3                	mov    %eax,%ebx
+  803661:	85 c0                	test   %eax,%eax
+  803663:	79 07                	jns    80366c <nsipc_accept+0x26>
+  803665:	89 d8                	mov    %ebx,%eax
+  803667:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80366a:	c9                   	leave
+  80366b:	c3                   	ret
+  80366c:	83 ec 04             	sub    $0x4,%esp
+  80366f:	ff 35 10 80 80 00    	push   0x808010
+  803675:	68 00 80 80 00       	push   $0x808000
+  80367a:	ff 75 0c             	push   0xc(%ebp)
+  80367d:	e8 47 d8 ff ff       	call   800ec9 <memmove>
+  803682:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803688:	8b 45 10             	mov    0x10(%ebp),%eax
+  80368b:	89 10                	mov    %edx,(%eax)
+  80368d:	83 c4 10             	add    $0x10,%esp
+  803690:	eb d3                	jmp    803665 <nsipc_accept+0x1f>
+
+00803692 <nsipc_bind>:
+  803692:	55                   	push   %ebp
+  803693:	89 e5                	mov    %esp,%ebp
+  803695:	53                   	push   %ebx
+  803696:	83 ec 08             	sub    $0x8,%esp
+  803699:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80369c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80369f:	a3 00 80 80 00       	mov    %eax,0x808000
+  8036a4:	53                   	push   %ebx
+  8036a5:	ff 75 0c             	push   0xc(%ebp)
+  8036a8:	68 04 80 80 00       	push   $0x808004
+  8036ad:	e8 17 d8 ff ff       	call   800ec9 <memmove>
+  8036b2:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  8036b8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8036bd:	e8 3f ff ff ff       	call   803601 <nsipc>
+  8036c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c5:	c9                   	leave
+  8036c6:	c3                   	ret
+
+008036c7 <nsipc_shutdown>:
+  8036c7:	55                   	push   %ebp
+  8036c8:	89 e5                	mov    %esp,%ebp
+  8036ca:	83 ec 08             	sub    $0x8,%esp
+  8036cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036d0:	a3 00 80 80 00       	mov    %eax,0x808000
+  8036d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036d8:	a3 04 80 80 00       	mov    %eax,0x808004
+  8036dd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8036e2:	e8 1a ff ff ff       	call   803601 <nsipc>
+  8036e7:	c9                   	leave
+  8036e8:	c3                   	ret
+
+008036e9 <nsipc_close>:
+  8036e9:	55                   	push   %ebp
+  8036ea:	89 e5                	mov    %esp,%ebp
+  8036ec:	83 ec 08             	sub    $0x8,%esp
+  8036ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036f2:	a3 00 80 80 00       	mov    %eax,0x808000
+  8036f7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8036fc:	e8 00 ff ff ff       	call   803601 <nsipc>
+  803701:	c9                   	leave
+  803702:	c3                   	ret
+
+00803703 <nsipc_connect>:
+  803703:	55                   	push   %ebp
+  803704:	89 e5                	mov    %esp,%ebp
+  803706:	53                   	push   %ebx
+  803707:	83 ec 08             	sub    $0x8,%esp
+  80370a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80370d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803710:	a3 00 80 80 00       	mov    %eax,0x808000
+  803715:	53                   	push   %ebx
+  803716:	ff 75 0c             	push   0xc(%ebp)
+  803719:	68 04 80 80 00       	push   $0x808004
+  80371e:	e8 a6 d7 ff ff       	call   800ec9 <memmove>
+  803723:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  803729:	b8 05 00 00 00       	mov    $0x5,%eax
+  80372e:	e8 ce fe ff ff       	call   803601 <nsipc>
+  803733:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803736:	c9                   	leave
+  803737:	c3                   	ret
+
+00803738 <nsipc_listen>:
+  803738:	55                   	push   %ebp
+  803739:	89 e5                	mov    %esp,%ebp
+  80373b:	83 ec 08             	sub    $0x8,%esp
+  80373e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803741:	a3 00 80 80 00       	mov    %eax,0x808000
+  803746:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803749:	a3 04 80 80 00       	mov    %eax,0x808004
+  80374e:	b8 06 00 00 00       	mov    $0x6,%eax
+  803753:	e8 a9 fe ff ff       	call   803601 <nsipc>
+  803758:	c9                   	leave
+  803759:	c3                   	ret
+
+0080375a <nsipc_recv>:
+  80375a:	55                   	push   %ebp
+  80375b:	89 e5                	mov    %esp,%ebp
+  80375d:	56                   	push   %esi
+  80375e:	53                   	push   %ebx
+  80375f:	8b 75 10             	mov    0x10(%ebp),%esi
+  803762:	8b 45 08             	mov    0x8(%ebp),%eax
+  803765:	a3 00 80 80 00       	mov    %eax,0x808000
+  80376a:	89 35 04 80 80 00    	mov    %esi,0x808004
+  803770:	8b 45 14             	mov    0x14(%ebp),%eax
+  803773:	a3 08 80 80 00       	mov    %eax,0x808008
+  803778:	b8 07 00 00 00       	mov    $0x7,%eax
+  80377d:	e8 7f fe ff ff       	call   803601 <nsipc>
+  803782:	89 c3                	mov    %eax,%ebx
+  803784:	85 c0                	test   %eax,%eax
+  803786:	78 22                	js     8037aa <nsipc_recv+0x50>
+  803788:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80378d:	39 c6                	cmp    %eax,%esi
+  80378f:	0f 4e c6             	cmovle %esi,%eax
+  803792:	39 c3                	cmp    %eax,%ebx
+  803794:	7f 1d                	jg     8037b3 <nsipc_recv+0x59>
+  803796:	83 ec 04             	sub    $0x4,%esp
+  803799:	53                   	push   %ebx
+  80379a:	68 00 80 80 00       	push   $0x808000
+  80379f:	ff 75 0c             	push   0xc(%ebp)
+  8037a2:	e8 22 d7 ff ff       	call   800ec9 <memmove>
+  8037a7:	83 c4 10             	add    $0x10,%esp
+  8037aa:	89 d8                	mov    %ebx,%eax
+  8037ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037af:	5b                   	pop    %ebx
+  8037b0:	5e                   	pop    %esi
+  8037b1:	5d                   	pop    %ebp
+  8037b2:	c3                   	ret
+  8037b3:	68 d2 4a 80 00       	push   $0x804ad2
+  8037b8:	68 33 4a 80 00       	push   $0x804a33
+  8037bd:	6a 60                	push   $0x60
+  8037bf:	68 e7 4a 80 00       	push   $0x804ae7
+  8037c4:	e8 7e cd ff ff       	call   800547 <_panic>
+
+008037c9 <nsipc_send>:
+  8037c9:	55                   	push   %ebp
+  8037ca:	89 e5                	mov    %esp,%ebp
+  8037cc:	53                   	push   %ebx
+  8037cd:	83 ec 04             	sub    $0x4,%esp
+  8037d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8037d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d6:	a3 00 80 80 00       	mov    %eax,0x808000
+  8037db:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8037e1:	7f 2e                	jg     803811 <nsipc_send+0x48>
+  8037e3:	83 ec 04             	sub    $0x4,%esp
+  8037e6:	53                   	push   %ebx
+  8037e7:	ff 75 0c             	push   0xc(%ebp)
+  8037ea:	68 0c 80 80 00       	push   $0x80800c
+  8037ef:	e8 d5 d6 ff ff       	call   800ec9 <memmove>
+  8037f4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  8037fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037fd:	a3 08 80 80 00       	mov    %eax,0x808008
+  803802:	b8 08 00 00 00       	mov    $0x8,%eax
+  803807:	e8 f5 fd ff ff       	call   803601 <nsipc>
+  80380c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80380f:	c9                   	leave
+  803810:	c3                   	ret
+  803811:	68 f3 4a 80 00       	push   $0x804af3
+  803816:	68 33 4a 80 00       	push   $0x804a33
+  80381b:	6a 6b                	push   $0x6b
+  80381d:	68 e7 4a 80 00       	push   $0x804ae7
+  803822:	e8 20 cd ff ff       	call   800547 <_panic>
+
+00803827 <nsipc_socket>:
+  803827:	55                   	push   %ebp
+  803828:	89 e5                	mov    %esp,%ebp
+  80382a:	83 ec 08             	sub    $0x8,%esp
+  80382d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803830:	a3 00 80 80 00       	mov    %eax,0x808000
+  803835:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803838:	a3 04 80 80 00       	mov    %eax,0x808004
+  80383d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803840:	a3 08 80 80 00       	mov    %eax,0x808008
+  803845:	b8 09 00 00 00       	mov    $0x9,%eax
+  80384a:	e8 b2 fd ff ff       	call   803601 <nsipc>
+  80384f:	c9                   	leave
+  803850:	c3                   	ret
+
+00803851 <devpipe_stat>:
+  803851:	55                   	push   %ebp
+  803852:	89 e5                	mov    %esp,%ebp
+  803854:	56                   	push   %esi
+  803855:	53                   	push   %ebx
+  803856:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803859:	83 ec 0c             	sub    $0xc,%esp
+  80385c:	ff 75 08             	push   0x8(%ebp)
+  80385f:	e8 c4 e6 ff ff       	call   801f28 <fd2data>
+  803864:	89 c6                	mov    %eax,%esi
+  803866:	83 c4 08             	add    $0x8,%esp
+  803869:	68 ff 4a 80 00       	push   $0x804aff
+  80386e:	53                   	push   %ebx
+  80386f:	e8 a5 d4 ff ff       	call   800d19 <strcpy>
+  803874:	8b 46 04             	mov    0x4(%esi),%eax
+  803877:	2b 06                	sub    (%esi),%eax
+  803879:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80387f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803886:	00 00 00 
+  803889:	c7 83 88 00 00 00 58 	movl   $0x805058,0x88(%ebx)
+  803890:	50 80 00 
+  803893:	b8 00 00 00 00       	mov    $0x0,%eax
+  803898:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80389b:	5b                   	pop    %ebx
+  80389c:	5e                   	pop    %esi
+  80389d:	5d                   	pop    %ebp
+  80389e:	c3                   	ret
+
+0080389f <devpipe_close>:
+  80389f:	55                   	push   %ebp
+  8038a0:	89 e5                	mov    %esp,%ebp
+  8038a2:	53                   	push   %ebx
+  8038a3:	83 ec 0c             	sub    $0xc,%esp
+  8038a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8038a9:	53                   	push   %ebx
+  8038aa:	6a 00                	push   $0x0
+  8038ac:	e8 9a d9 ff ff       	call   80124b <sys_page_unmap>
+  8038b1:	89 1c 24             	mov    %ebx,(%esp)
+  8038b4:	e8 6f e6 ff ff       	call   801f28 <fd2data>
+  8038b9:	83 c4 08             	add    $0x8,%esp
+  8038bc:	50                   	push   %eax
+  8038bd:	6a 00                	push   $0x0
+  8038bf:	e8 87 d9 ff ff       	call   80124b <sys_page_unmap>
+  8038c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038c7:	c9                   	leave
+  8038c8:	c3                   	ret
+
+008038c9 <_pipeisclosed>:
+  8038c9:	55                   	push   %ebp
+  8038ca:	89 e5                	mov    %esp,%ebp
+  8038cc:	57                   	push   %edi
+  8038cd:	56                   	push   %esi
+  8038ce:	53                   	push   %ebx
+  8038cf:	83 ec 1c             	sub    $0x1c,%esp
+  8038d2:	89 c7                	mov    %eax,%edi
+  8038d4:	89 d6                	mov    %edx,%esi
+  8038d6:	a1 14 60 80 00       	mov    0x806014,%eax
+  8038db:	8b 58 58             	mov    0x58(%eax),%ebx
+  8038de:	83 ec 0c             	sub    $0xc,%esp
+  8038e1:	57                   	push   %edi
+  8038e2:	e8 4e 08 00 00       	call   804135 <pageref>
+  8038e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038ea:	89 34 24             	mov    %esi,(%esp)
+  8038ed:	e8 43 08 00 00       	call   804135 <pageref>
+  8038f2:	8b 15 14 60 80 00    	mov    0x806014,%edx
+  8038f8:	8b 4a 58             	mov    0x58(%edx),%ecx
+  8038fb:	83 c4 10             	add    $0x10,%esp
+  8038fe:	39 cb                	cmp    %ecx,%ebx
+  803900:	74 1b                	je     80391d <_pipeisclosed+0x54>
+  803902:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803905:	75 cf                	jne    8038d6 <_pipeisclosed+0xd>
+  803907:	8b 42 58             	mov    0x58(%edx),%eax
+  80390a:	6a 01                	push   $0x1
+  80390c:	50                   	push   %eax
+  80390d:	53                   	push   %ebx
+  80390e:	68 06 4b 80 00       	push   $0x804b06
+  803913:	e8 0a cd ff ff       	call   800622 <cprintf>
+  803918:	83 c4 10             	add    $0x10,%esp
+  80391b:	eb b9                	jmp    8038d6 <_pipeisclosed+0xd>
+  80391d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803920:	0f 94 c0             	sete   %al
+  803923:	0f b6 c0             	movzbl %al,%eax
+  803926:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803929:	5b                   	pop    %ebx
+  80392a:	5e                   	pop    %esi
+  80392b:	5f                   	pop    %edi
+  80392c:	5d                   	pop    %ebp
+  80392d:	c3                   	ret
+
+0080392e <devpipe_write>:
+  80392e:	55                   	push   %ebp
+  80392f:	89 e5                	mov    %esp,%ebp
+  803931:	57                   	push   %edi
+  803932:	56                   	push   %esi
+  803933:	53                   	push   %ebx
+  803934:	83 ec 28             	sub    $0x28,%esp
+  803937:	8b 75 08             	mov    0x8(%ebp),%esi
+  80393a:	56                   	push   %esi
+  80393b:	e8 e8 e5 ff ff       	call   801f28 <fd2data>
+  803940:	89 c3                	mov    %eax,%ebx
+  803942:	83 c4 10             	add    $0x10,%esp
+  803945:	bf 00 00 00 00       	mov    $0x0,%edi
+  80394a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80394e:	74 5c                	je     8039ac <devpipe_write+0x7e>
+  803950:	8b 43 04             	mov    0x4(%ebx),%eax
+  803953:	8b 0b                	mov    (%ebx),%ecx
+  803955:	8d 51 20             	lea    0x20(%ecx),%edx
+  803958:	39 d0                	cmp    %edx,%eax
+  80395a:	72 1e                	jb     80397a <devpipe_write+0x4c>
+  80395c:	89 da                	mov    %ebx,%edx
+  80395e:	89 f0                	mov    %esi,%eax
+  803960:	e8 64 ff ff ff       	call   8038c9 <_pipeisclosed>
+  803965:	85 c0                	test   %eax,%eax
+  803967:	75 48                	jne    8039b1 <devpipe_write+0x83>
+  803969:	e8 c0 d7 ff ff       	call   80112e <sys_yield>
+  80396e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803971:	8b 0b                	mov    (%ebx),%ecx
+  803973:	8d 51 20             	lea    0x20(%ecx),%edx
+  803976:	39 d0                	cmp    %edx,%eax
+  803978:	73 e2                	jae    80395c <devpipe_write+0x2e>
+  80397a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80397d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803981:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803984:	89 c2                	mov    %eax,%edx
+  803986:	c1 fa 1f             	sar    $0x1f,%edx
+  803989:	89 d1                	mov    %edx,%ecx
+  80398b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80398e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803991:	83 e2 1f             	and    $0x1f,%edx
+  803994:	29 ca                	sub    %ecx,%edx
+  803996:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80399a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80399e:	83 c0 01             	add    $0x1,%eax
+  8039a1:	89 43 04             	mov    %eax,0x4(%ebx)
+  8039a4:	83 c7 01             	add    $0x1,%edi
+  8039a7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8039aa:	75 a4                	jne    803950 <devpipe_write+0x22>
+  8039ac:	8b 45 10             	mov    0x10(%ebp),%eax
+  8039af:	eb 05                	jmp    8039b6 <devpipe_write+0x88>
+  8039b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039b9:	5b                   	pop    %ebx
+  8039ba:	5e                   	pop    %esi
+  8039bb:	5f                   	pop    %edi
+  8039bc:	5d                   	pop    %ebp
+  8039bd:	c3                   	ret
+
+008039be <devpipe_read>:
+  8039be:	55                   	push   %ebp
+  8039bf:	89 e5                	mov    %esp,%ebp
+  8039c1:	57                   	push   %edi
+  8039c2:	56                   	push   %esi
+  8039c3:	53                   	push   %ebx
+  8039c4:	83 ec 18             	sub    $0x18,%esp
+  8039c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039ca:	56                   	push   %esi
+  8039cb:	e8 58 e5 ff ff       	call   801f28 <fd2data>
+  8039d0:	89 c3                	mov    %eax,%ebx
+  8039d2:	83 c4 10             	add    $0x10,%esp
+  8039d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039da:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039de:	74 45                	je     803a25 <devpipe_read+0x67>
+  8039e0:	8b 03                	mov    (%ebx),%eax
+  8039e2:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8039e5:	75 1d                	jne    803a04 <devpipe_read+0x46>
+  8039e7:	85 ff                	test   %edi,%edi
+  8039e9:	75 3f                	jne    803a2a <devpipe_read+0x6c>
+  8039eb:	89 da                	mov    %ebx,%edx
+  8039ed:	89 f0                	mov    %esi,%eax
+  8039ef:	e8 d5 fe ff ff       	call   8038c9 <_pipeisclosed>
+  8039f4:	85 c0                	test   %eax,%eax
+  8039f6:	75 3c                	jne    803a34 <devpipe_read+0x76>
+  8039f8:	e8 31 d7 ff ff       	call   80112e <sys_yield>
+  8039fd:	8b 03                	mov    (%ebx),%eax
+  8039ff:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803a02:	74 e7                	je     8039eb <devpipe_read+0x2d>
+  803a04:	99                   	cltd
+  803a05:	c1 ea 1b             	shr    $0x1b,%edx
+  803a08:	01 d0                	add    %edx,%eax
+  803a0a:	83 e0 1f             	and    $0x1f,%eax
+  803a0d:	29 d0                	sub    %edx,%eax
+  803a0f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803a14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a17:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  803a1a:	83 03 01             	addl   $0x1,(%ebx)
+  803a1d:	83 c7 01             	add    $0x1,%edi
+  803a20:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  803a23:	75 bb                	jne    8039e0 <devpipe_read+0x22>
+  803a25:	8b 45 10             	mov    0x10(%ebp),%eax
+  803a28:	eb 02                	jmp    803a2c <devpipe_read+0x6e>
+  803a2a:	89 f8                	mov    %edi,%eax
+  803a2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a2f:	5b                   	pop    %ebx
+  803a30:	5e                   	pop    %esi
+  803a31:	5f                   	pop    %edi
+  803a32:	5d                   	pop    %ebp
+  803a33:	c3                   	ret
+  803a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a39:	eb f1                	jmp    803a2c <devpipe_read+0x6e>
+
+00803a3b <pipe>:
+  803a3b:	55                   	push   %ebp
+  803a3c:	89 e5                	mov    %esp,%ebp
+  803a3e:	56                   	push   %esi
+  803a3f:	53                   	push   %ebx
+  803a40:	83 ec 1c             	sub    $0x1c,%esp
+  803a43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a46:	50                   	push   %eax
+  803a47:	e8 f3 e4 ff ff       	call   801f3f <fd_alloc>
+  803a4c:	89 c3                	mov    %eax,%ebx
+  803a4e:	83 c4 10             	add    $0x10,%esp
+  803a51:	85 c0                	test   %eax,%eax
+  803a53:	0f 88 23 01 00 00    	js     803b7c <pipe+0x141>
+  803a59:	83 ec 04             	sub    $0x4,%esp
+  803a5c:	68 07 04 00 00       	push   $0x407
+  803a61:	ff 75 f4             	push   -0xc(%ebp)
+  803a64:	6a 00                	push   $0x0
+  803a66:	e8 0e d7 ff ff       	call   801179 <sys_page_alloc>
+  803a6b:	89 c3                	mov    %eax,%ebx
+  803a6d:	83 c4 10             	add    $0x10,%esp
+  803a70:	85 c0                	test   %eax,%eax
+  803a72:	0f 88 04 01 00 00    	js     803b7c <pipe+0x141>
+  803a78:	83 ec 0c             	sub    $0xc,%esp
+  803a7b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a7e:	50                   	push   %eax
+  803a7f:	e8 bb e4 ff ff       	call   801f3f <fd_alloc>
+  803a84:	89 c3                	mov    %eax,%ebx
+  803a86:	83 c4 10             	add    $0x10,%esp
+  803a89:	85 c0                	test   %eax,%eax
+  803a8b:	0f 88 db 00 00 00    	js     803b6c <pipe+0x131>
+  803a91:	83 ec 04             	sub    $0x4,%esp
+  803a94:	68 07 04 00 00       	push   $0x407
+  803a99:	ff 75 f0             	push   -0x10(%ebp)
+  803a9c:	6a 00                	push   $0x0
+  803a9e:	e8 d6 d6 ff ff       	call   801179 <sys_page_alloc>
+  803aa3:	89 c3                	mov    %eax,%ebx
+  803aa5:	83 c4 10             	add    $0x10,%esp
+  803aa8:	85 c0                	test   %eax,%eax
+  803aaa:	0f 88 bc 00 00 00    	js     803b6c <pipe+0x131>
+  803ab0:	83 ec 0c             	sub    $0xc,%esp
+  803ab3:	ff 75 f4             	push   -0xc(%ebp)
+  803ab6:	e8 6d e4 ff ff       	call   801f28 <fd2data>
+  803abb:	89 c6                	mov    %eax,%esi
+  803abd:	83 c4 0c             	add    $0xc,%esp
+  803ac0:	68 07 04 00 00       	push   $0x407
+  803ac5:	50                   	push   %eax
+  803ac6:	6a 00                	push   $0x0
+  803ac8:	e8 ac d6 ff ff       	call   801179 <sys_page_alloc>
+  803acd:	89 c3                	mov    %eax,%ebx
+  803acf:	83 c4 10             	add    $0x10,%esp
+  803ad2:	85 c0                	test   %eax,%eax
+  803ad4:	0f 88 82 00 00 00    	js     803b5c <pipe+0x121>
+  803ada:	83 ec 0c             	sub    $0xc,%esp
+  803add:	ff 75 f0             	push   -0x10(%ebp)
+  803ae0:	e8 43 e4 ff ff       	call   801f28 <fd2data>
+  803ae5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803aec:	50                   	push   %eax
+  803aed:	6a 00                	push   $0x0
+  803aef:	56                   	push   %esi
+  803af0:	6a 00                	push   $0x0
+  803af2:	e8 c5 d6 ff ff       	call   8011bc <sys_page_map>
+  803af7:	89 c3                	mov    %eax,%ebx
+  803af9:	83 c4 20             	add    $0x20,%esp
+  803afc:	85 c0                	test   %eax,%eax
+  803afe:	78 4e                	js     803b4e <pipe+0x113>
+  803b00:	a1 58 50 80 00       	mov    0x805058,%eax
+  803b05:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b08:	89 02                	mov    %eax,(%edx)
+  803b0a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b0d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  803b14:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b17:	89 02                	mov    %eax,(%edx)
+  803b19:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b1c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  803b23:	83 ec 0c             	sub    $0xc,%esp
+  803b26:	ff 75 f4             	push   -0xc(%ebp)
+  803b29:	e8 ea e3 ff ff       	call   801f18 <fd2num>
+  803b2e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b31:	89 01                	mov    %eax,(%ecx)
+  803b33:	83 c4 04             	add    $0x4,%esp
+  803b36:	ff 75 f0             	push   -0x10(%ebp)
+  803b39:	e8 da e3 ff ff       	call   801f18 <fd2num>
+  803b3e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b41:	89 41 04             	mov    %eax,0x4(%ecx)
+  803b44:	83 c4 10             	add    $0x10,%esp
+  803b47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b4c:	eb 2e                	jmp    803b7c <pipe+0x141>
+  803b4e:	83 ec 08             	sub    $0x8,%esp
+  803b51:	56                   	push   %esi
+  803b52:	6a 00                	push   $0x0
+  803b54:	e8 f2 d6 ff ff       	call   80124b <sys_page_unmap>
+  803b59:	83 c4 10             	add    $0x10,%esp
+  803b5c:	83 ec 08             	sub    $0x8,%esp
+  803b5f:	ff 75 f0             	push   -0x10(%ebp)
+  803b62:	6a 00                	push   $0x0
+  803b64:	e8 e2 d6 ff ff       	call   80124b <sys_page_unmap>
+  803b69:	83 c4 10             	add    $0x10,%esp
+  803b6c:	83 ec 08             	sub    $0x8,%esp
+  803b6f:	ff 75 f4             	push   -0xc(%ebp)
+  803b72:	6a 00                	push   $0x0
+  803b74:	e8 d2 d6 ff ff       	call   80124b <sys_page_unmap>
+  803b79:	83 c4 10             	add    $0x10,%esp
+  803b7c:	89 d8                	mov    %ebx,%eax
+  803b7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b81:	5b                   	pop    %ebx
+  803b82:	5e                   	pop    %esi
+  803b83:	5d                   	pop    %ebp
+  803b84:	c3                   	ret
+
+00803b85 <pipeisclosed>:
+  803b85:	55                   	push   %ebp
+  803b86:	89 e5                	mov    %esp,%ebp
+  803b88:	83 ec 20             	sub    $0x20,%esp
+  803b8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b8e:	50                   	push   %eax
+  803b8f:	ff 75 08             	push   0x8(%ebp)
+  803b92:	e8 f8 e3 ff ff       	call   801f8f <fd_lookup>
+  803b97:	83 c4 10             	add    $0x10,%esp
+  803b9a:	85 c0                	test   %eax,%eax
+  803b9c:	78 18                	js     803bb6 <pipeisclosed+0x31>
+  803b9e:	83 ec 0c             	sub    $0xc,%esp
+  803ba1:	ff 75 f4             	push   -0xc(%ebp)
+  803ba4:	e8 7f e3 ff ff       	call   801f28 <fd2data>
+  803ba9:	89 c2                	mov    %eax,%edx
+  803bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bae:	e8 16 fd ff ff       	call   8038c9 <_pipeisclosed>
+  803bb3:	83 c4 10             	add    $0x10,%esp
+  803bb6:	c9                   	leave
+  803bb7:	c3                   	ret
+
+00803bb8 <wait>:
+  803bb8:	55                   	push   %ebp
+  803bb9:	89 e5                	mov    %esp,%ebp
+  803bbb:	56                   	push   %esi
+  803bbc:	53                   	push   %ebx
+  803bbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  803bc0:	85 f6                	test   %esi,%esi
+  803bc2:	74 40                	je     803c04 <wait+0x4c>
+  803bc4:	89 f3                	mov    %esi,%ebx
+  803bc6:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803bcc:	69 c3 ac 01 00 00    	imul   $0x1ac,%ebx,%eax
+  803bd2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803bd7:	8b 40 48             	mov    0x48(%eax),%eax
+  803bda:	39 c6                	cmp    %eax,%esi
+  803bdc:	75 1f                	jne    803bfd <wait+0x45>
+  803bde:	69 db ac 01 00 00    	imul   $0x1ac,%ebx,%ebx
+  803be4:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803bea:	8b 43 54             	mov    0x54(%ebx),%eax
+  803bed:	85 c0                	test   %eax,%eax
+  803bef:	74 0c                	je     803bfd <wait+0x45>
+  803bf1:	e8 38 d5 ff ff       	call   80112e <sys_yield>
+  803bf6:	8b 43 48             	mov    0x48(%ebx),%eax
+  803bf9:	39 f0                	cmp    %esi,%eax
+  803bfb:	74 ed                	je     803bea <wait+0x32>
+  803bfd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c00:	5b                   	pop    %ebx
+  803c01:	5e                   	pop    %esi
+  803c02:	5d                   	pop    %ebp
+  803c03:	c3                   	ret
+  803c04:	68 1e 4b 80 00       	push   $0x804b1e
+  803c09:	68 33 4a 80 00       	push   $0x804a33
+  803c0e:	6a 09                	push   $0x9
+  803c10:	68 29 4b 80 00       	push   $0x804b29
+  803c15:	e8 2d c9 ff ff       	call   800547 <_panic>
+
+00803c1a <ipcring_init>:
+  803c1a:	55                   	push   %ebp
+  803c1b:	89 e5                	mov    %esp,%ebp
+  803c1d:	53                   	push   %ebx
+  803c1e:	83 ec 08             	sub    $0x8,%esp
+  803c21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c24:	6a 60                	push   $0x60
+  803c26:	6a 00                	push   $0x0
+  803c28:	53                   	push   %ebx
+  803c29:	e8 66 d2 ff ff       	call   800e94 <memset>
+  803c2e:	a1 14 60 80 00       	mov    0x806014,%eax
+  803c33:	8b 40 48             	mov    0x48(%eax),%eax
+  803c36:	89 03                	mov    %eax,(%ebx)
+  803c38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c3b:	89 43 04             	mov    %eax,0x4(%ebx)
+  803c3e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803c41:	89 43 08             	mov    %eax,0x8(%ebx)
+  803c44:	8b 45 14             	mov    0x14(%ebp),%eax
+  803c47:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803c4a:	83 c4 10             	add    $0x10,%esp
+  803c4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c50:	c9                   	leave
+  803c51:	c3                   	ret
+
+00803c52 <ipcring_req_slot>:
+  803c52:	55                   	push   %ebp
+  803c53:	89 e5                	mov    %esp,%ebp
+  803c55:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c58:	8b 50 10             	mov    0x10(%eax),%edx
+  803c5b:	8b 48 18             	mov    0x18(%eax),%ecx
+  803c5e:	29 ca                	sub    %ecx,%edx
+  803c60:	83 fa 07             	cmp    $0x7,%edx
+  803c63:	77 0c                	ja     803c71 <ipcring_req_slot+0x1f>
+  803c65:	8b 50 10             	mov    0x10(%eax),%edx
+  803c68:	83 e2 07             	and    $0x7,%edx
+  803c6b:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803c6f:	5d                   	pop    %ebp
+  803c70:	c3                   	ret
+  803c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c76:	eb f7                	jmp    803c6f <ipcring_req_slot+0x1d>
+
+00803c78 <ipcring_req_push>:
+  803c78:	55                   	push   %ebp
+  803c79:	89 e5                	mov    %esp,%ebp
+  803c7b:	83 ec 08             	sub    $0x8,%esp
+  803c7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  803c81:	8b 42 10             	mov    0x10(%edx),%eax
+  803c84:	83 c0 01             	add    $0x1,%eax
+  803c87:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c90:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803c94:	85 c0                	test   %eax,%eax
+  803c96:	75 02                	jne    803c9a <ipcring_req_push+0x22>
+  803c98:	c9                   	leave
+  803c99:	c3                   	ret
+  803c9a:	6a 00                	push   $0x0
+  803c9c:	68 00 00 80 ee       	push   $0xee800000
+  803ca1:	ff 72 08             	push   0x8(%edx)
+  803ca4:	ff 72 04             	push   0x4(%edx)
+  803ca7:	e8 05 d8 ff ff       	call   8014b1 <sys_ipc_send>
+  803cac:	83 c4 10             	add    $0x10,%esp
+  803caf:	eb e7                	jmp    803c98 <ipcring_req_push+0x20>
+
+00803cb1 <ipcring_rsp_wait>:
+  803cb1:	55                   	push   %ebp
+  803cb2:	89 e5                	mov    %esp,%ebp
+  803cb4:	53                   	push   %ebx
+  803cb5:	83 ec 04             	sub    $0x4,%esp
+  803cb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803cbb:	8b 53 18             	mov    0x18(%ebx),%edx
+  803cbe:	8b 43 10             	mov    0x10(%ebx),%eax
+  803cc1:	39 c2                	cmp    %eax,%edx
+  803cc3:	74 3c                	je     803d01 <ipcring_rsp_wait+0x50>
+  803cc5:	8b 53 14             	mov    0x14(%ebx),%edx
+  803cc8:	8b 43 18             	mov    0x18(%ebx),%eax
+  803ccb:	39 c2                	cmp    %eax,%edx
+  803ccd:	75 23                	jne    803cf2 <ipcring_rsp_wait+0x41>
+  803ccf:	83 ec 08             	sub    $0x8,%esp
+  803cd2:	6a 00                	push   $0x0
+  803cd4:	6a 00                	push   $0x0
+  803cd6:	6a 00                	push   $0x0
+  803cd8:	6a 00                	push   $0x0
+  803cda:	ff 73 0c             	push   0xc(%ebx)
+  803cdd:	ff 73 04             	push   0x4(%ebx)
+  803ce0:	e8 9b 02 00 00       	call   803f80 <ipc_call>
+  803ce5:	8b 53 14             	mov    0x14(%ebx),%edx
+  803ce8:	8b 43 18             	mov    0x18(%ebx),%eax
+  803ceb:	83 c4 20             	add    $0x20,%esp
+  803cee:	39 c2                	cmp    %eax,%edx
+  803cf0:	74 dd                	je     803ccf <ipcring_rsp_wait+0x1e>
+  803cf2:	8b 43 18             	mov    0x18(%ebx),%eax
+  803cf5:	83 e0 07             	and    $0x7,%eax
+  803cf8:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803cfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cff:	c9                   	leave
+  803d00:	c3                   	ret
+  803d01:	68 34 4b 80 00       	push   $0x804b34
+  803d06:	68 33 4a 80 00       	push   $0x804a33
+  803d0b:	6a 3b                	push   $0x3b
+  803d0d:	68 55 4b 80 00       	push   $0x804b55
+  803d12:	e8 30 c8 ff ff       	call   800547 <_panic>
+
+00803d17 <ipcring_rsp_pop>:
+  803d17:	55                   	push   %ebp
+  803d18:	89 e5                	mov    %esp,%ebp
+  803d1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  803d1d:	8b 42 18             	mov    0x18(%edx),%eax
+  803d20:	83 c0 01             	add    $0x1,%eax
+  803d23:	89 42 18             	mov    %eax,0x18(%edx)
+  803d26:	5d                   	pop    %ebp
+  803d27:	c3                   	ret
+
+00803d28 <ipcring_server_init>:
+  803d28:	55                   	push   %ebp
+  803d29:	89 e5                	mov    %esp,%ebp
+  803d2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d31:	89 10                	mov    %edx,(%eax)
+  803d33:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d36:	89 50 04             	mov    %edx,0x4(%eax)
+  803d39:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  803d40:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803d47:	5d                   	pop    %ebp
+  803d48:	c3                   	ret
+
+00803d49 <ipcring_req_avail>:
+  803d49:	55                   	push   %ebp
+  803d4a:	89 e5                	mov    %esp,%ebp
+  803d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  803d4f:	8b 02                	mov    (%edx),%eax
+  803d51:	8b 40 10             	mov    0x10(%eax),%eax
+  803d54:	2b 42 08             	sub    0x8(%edx),%eax
+  803d57:	ba 08 00 00 00       	mov    $0x8,%edx
+  803d5c:	39 d0                	cmp    %edx,%eax
+  803d5e:	0f 47 c2             	cmova  %edx,%eax
+  803d61:	5d                   	pop    %ebp
+  803d62:	c3                   	ret
+
+00803d63 <ipcring_req_peek>:
+  803d63:	55                   	push   %ebp
+  803d64:	89 e5                	mov    %esp,%ebp
+  803d66:	8b 55 08             	mov    0x8(%ebp),%edx
+  803d69:	8b 42 08             	mov    0x8(%edx),%eax
+  803d6c:	83 e0 07             	and    $0x7,%eax
+  803d6f:	8b 12                	mov    (%edx),%edx
+  803d71:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  803d75:	5d                   	pop    %ebp
+  803d76:	c3                   	ret
+
+00803d77 <ipcring_rsp_push>:
+  803d77:	55                   	push   %ebp
+  803d78:	89 e5                	mov    %esp,%ebp
+  803d7a:	83 ec 08             	sub    $0x8,%esp
+  803d7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803d80:	8b 41 08             	mov    0x8(%ecx),%eax
+  803d83:	83 c0 01             	add    $0x1,%eax
+  803d86:	89 41 08             	mov    %eax,0x8(%ecx)
+  803d89:	8b 11                	mov    (%ecx),%edx
+  803d8b:	83 c2 14             	add    $0x14,%edx
+  803d8e:	f0 87 02             	lock xchg %eax,(%edx)
+  803d91:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  803d95:	75 02                	jne    803d99 <ipcring_rsp_push+0x22>
+  803d97:	c9                   	leave
+  803d98:	c3                   	ret
+  803d99:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803da0:	6a 00                	push   $0x0
+  803da2:	68 00 00 80 ee       	push   $0xee800000
+  803da7:	6a 00                	push   $0x0
+  803da9:	ff 71 04             	push   0x4(%ecx)
+  803dac:	e8 23 d6 ff ff       	call   8013d4 <sys_ipc_try_send>
+  803db1:	83 c4 10             	add    $0x10,%esp
+  803db4:	eb e1                	jmp    803d97 <ipcring_rsp_push+0x20>
+
+00803db6 <ipcring_client_wait>:
+  803db6:	55                   	push   %ebp
+  803db7:	89 e5                	mov    %esp,%ebp
+  803db9:	83 ec 08             	sub    $0x8,%esp
+  803dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dbf:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  803dc6:	8b 10                	mov    (%eax),%edx
+  803dc8:	8b 52 18             	mov    0x18(%edx),%edx
+  803dcb:	3b 50 08             	cmp    0x8(%eax),%edx
+  803dce:	75 02                	jne    803dd2 <ipcring_client_wait+0x1c>
+  803dd0:	c9                   	leave
+  803dd1:	c3                   	ret
+  803dd2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  803dd9:	6a 00                	push   $0x0
+  803ddb:	68 00 00 80 ee       	push   $0xee800000
+  803de0:	6a 00                	push   $0x0
+  803de2:	ff 70 04             	push   0x4(%eax)
+  803de5:	e8 ea d5 ff ff       	call   8013d4 <sys_ipc_try_send>
+  803dea:	83 c4 10             	add    $0x10,%esp
+  803ded:	eb e1                	jmp    803dd0 <ipcring_client_wait+0x1a>
+
+00803def <ipcring_server_sleep>:
+  803def:	55                   	push   %ebp
+  803df0:	89 e5                	mov    %esp,%ebp
+  803df2:	53                   	push   %ebx
+  803df3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803df6:	8b 01                	mov    (%ecx),%eax
+  803df8:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803dfb:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e00:	f0 87 02             	lock xchg %eax,(%edx)
+  803e03:	8b 11                	mov    (%ecx),%edx
+  803e05:	8b 5a 10             	mov    0x10(%edx),%ebx
+  803e08:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e0d:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  803e10:	74 0e                	je     803e20 <ipcring_server_sleep+0x31>
+  803e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e17:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e23:	c9                   	leave
+  803e24:	c3                   	ret
+
+00803e25 <set_pgfault_handler>:
+  803e25:	55                   	push   %ebp
+  803e26:	89 e5                	mov    %esp,%ebp
+  803e28:	53                   	push   %ebx
+  803e29:	83 ec 04             	sub    $0x4,%esp
+  803e2c:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803e33:	74 0d                	je     803e42 <set_pgfault_handler+0x1d>
+  803e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e38:	a3 00 90 80 00       	mov    %eax,0x809000
+  803e3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e40:	c9                   	leave
+  803e41:	c3                   	ret
+  803e42:	e8 c8 d2 ff ff       	call   80110f <sys_getenvid>
+  803e47:	89 c3                	mov    %eax,%ebx
+  803e49:	83 ec 04             	sub    $0x4,%esp
+  803e4c:	6a 07                	push   $0x7
+  803e4e:	68 00 f0 7f ee       	push   $0xee7ff000
+  803e53:	50                   	push   %eax
+  803e54:	e8 20 d3 ff ff       	call   801179 <sys_page_alloc>
+  803e59:	83 c4 10             	add    $0x10,%esp
+  803e5c:	85 c0                	test   %eax,%eax
+  803e5e:	78 29                	js     803e89 <set_pgfault_handler+0x64>
+  803e60:	83 ec 08             	sub    $0x8,%esp
+  803e63:	68 9d 3e 80 00       	push   $0x803e9d
+  803e68:	53                   	push   %ebx
+  803e69:	e8 24 d5 ff ff       	call   801392 <sys_env_set_pgfault_upcall>
+  803e6e:	83 c4 10             	add    $0x10,%esp
+  803e71:	85 c0                	test   %eax,%eax
+  803e73:	79 c0                	jns    803e35 <set_pgfault_handler+0x10>
+  803e75:	83 ec 04             	sub    $0x4,%esp
+  803e78:	68 9c 4b 80 00       	push   $0x804b9c
+  803e7d:	6a 27                	push   $0x27
+  803e7f:	68 ce 4b 80 00       	push   $0x804bce
+  803e84:	e8 be c6 ff ff       	call   800547 <_panic>
+  803e89:	83 ec 04             	sub    $0x4,%esp
+  803e8c:	68 64 4b 80 00       	push   $0x804b64
+  803e91:	6a 23                	push   $0x23
+  803e93:	68 ce 4b 80 00       	push   $0x804bce
+  803e98:	e8 aa c6 ff ff       	call   800547 <_panic>
+
+00803e9d <_pgfault_upcall>:
+  803e9d:	54                   	push   %esp
+  803e9e:	a1 00 90 80 00       	mov    0x809000,%eax
+  803ea3:	ff d0                	call   *%eax
+  803ea5:	83 c4 04             	add    $0x4,%esp
+  803ea8:	89 e3                	mov    %esp,%ebx
+  803eaa:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803eae:	8b 54 24 30          	mov    0x30(%esp),%edx
+  803eb2:	89 d4                	mov    %edx,%esp
+  803eb4:	51                   	push   %ecx
+  803eb5:	89 dc                	mov    %ebx,%esp
+  803eb7:	83 ea 04             	sub    $0x4,%edx
+  803eba:	89 54 24 30          	mov    %edx,0x30(%esp)
+  803ebe:	83 c4 08             	add    $0x8,%esp
+  803ec1:	61                   	popa
+  803ec2:	83 c4 04             	add    $0x4,%esp
+  803ec5:	9d                   	popf
+  803ec6:	5c                   	pop    %esp
+  803ec7:	c3                   	ret
+
+00803ec8 <ipc_recv>:
+  803ec8:	55                   	push   %ebp
+  803ec9:	89 e5                	mov    %esp,%ebp
+  803ecb:	56                   	push   %esi
+  803ecc:	53                   	push   %ebx
+  803ecd:	8b 75 08             	mov    0x8(%ebp),%esi
+  803ed0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ed3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ed6:	85 c0                	test   %eax,%eax
+  803ed8:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803edd:	0f 44 c2             	cmove  %edx,%eax
+  803ee0:	83 ec 0c             	sub    $0xc,%esp
+  803ee3:	50                   	push   %eax
+  803ee4:	e8 3b d5 ff ff       	call   801424 <sys_ipc_recv>
+  803ee9:	83 c4 10             	add    $0x10,%esp
+  803eec:	85 c0                	test   %eax,%eax
+  803eee:	78 2a                	js     803f1a <ipc_recv+0x52>
+  803ef0:	a1 14 60 80 00       	mov    0x806014,%eax
+  803ef5:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803efb:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  803f01:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803f07:	85 f6                	test   %esi,%esi
+  803f09:	74 02                	je     803f0d <ipc_recv+0x45>
+  803f0b:	89 0e                	mov    %ecx,(%esi)
+  803f0d:	85 db                	test   %ebx,%ebx
+  803f0f:	74 02                	je     803f13 <ipc_recv+0x4b>
+  803f11:	89 13                	mov    %edx,(%ebx)
+  803f13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f16:	5b                   	pop    %ebx
+  803f17:	5e                   	pop    %esi
+  803f18:	5d                   	pop    %ebp
+  803f19:	c3                   	ret
+  803f1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803f24:	eb e1                	jmp    803f07 <ipc_recv+0x3f>
+
+00803f26 <ipc_send>:
+  803f26:	55                   	push   %ebp
+  803f27:	89 e5                	mov    %esp,%ebp
+  803f29:	57                   	push   %edi
+  803f2a:	56                   	push   %esi
+  803f2b:	53                   	push   %ebx
+  803f2c:	83 ec 0c             	sub    $0xc,%esp
+  803f2f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803f35:	8b 75 14             	mov    0x14(%ebp),%esi
+  803f38:	85 db                	test   %ebx,%ebx
+  803f3a:	74 1e                	je     803f5a <ipc_send+0x34>
+  803f3c:	56                   	push   %esi
+  803f3d:	53                   	push   %ebx
+  803f3e:	57                   	push   %edi
+  803f3f:	ff 75 08             	push   0x8(%ebp)
+  803f42:	e8 6a d5 ff ff       	call   8014b1 <sys_ipc_send>
+  803f47:	83 c4 10             	add    $0x10,%esp
+  803f4a:	85 c0                	test   %eax,%eax
+  803f4c:	74 2a                	je     803f78 <ipc_send+0x52>
+  803f4e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803f51:	75 13                	jne    803f66 <ipc_send+0x40>
+  803f53:	e8 d6 d1 ff ff       	call   80112e <sys_yield>
+  803f58:	eb e2                	jmp    803f3c <ipc_send+0x16>
+  803f5a:	be 00 00 00 00       	mov    $0x0,%esi
+  803f5f:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  803f64:	eb d6                	jmp    803f3c <ipc_send+0x16>
+  803f66:	50                   	push   %eax
+  803f67:	68 dc 4b 80 00       	push   $0x804bdc
+  803f6c:	6a 4f                	push   $0x4f
+  803f6e:	68 1f 4c 80 00       	push   $0x804c1f
+  803f73:	e8 cf c5 ff ff       	call   800547 <_panic>
+  803f78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f7b:	5b                   	pop    %ebx
+  803f7c:	5e                   	pop    %esi
+  803f7d:	5f                   	pop    %edi
+  803f7e:	5d                   	pop    %ebp
+  803f7f:	c3                   	ret
+
+00803f80 <ipc_call>:
+  803f80:	55                   	push   %ebp
+  803f81:	89 e5                	mov    %esp,%ebp
+  803f83:	57                   	push   %edi
+  803f84:	56                   	push   %esi
+  803f85:	53                   	push   %ebx
+  803f86:	83 ec 0c             	sub    $0xc,%esp
+  803f89:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803f8d:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  803f92:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803f96:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803f9a:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  803f9f:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  803fa3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803fa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fac:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  803fb0:	eb 05                	jmp    803fb7 <ipc_call+0x37>
+  803fb2:	e8 77 d1 ff ff       	call   80112e <sys_yield>
+  803fb7:	83 ec 0c             	sub    $0xc,%esp
+  803fba:	56                   	push   %esi
+  803fbb:	53                   	push   %ebx
+  803fbc:	57                   	push   %edi
+  803fbd:	ff 75 0c             	push   0xc(%ebp)
+  803fc0:	ff 75 08             	push   0x8(%ebp)
+  803fc3:	e8 39 d5 ff ff       	call   801501 <sys_ipc_call>
+  803fc8:	83 c4 20             	add    $0x20,%esp
+  803fcb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803fce:	74 e2                	je     803fb2 <ipc_call+0x32>
+  803fd0:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  803fd3:	74 2d                	je     804002 <ipc_call+0x82>
+  803fd5:	85 c0                	test   %eax,%eax
+  803fd7:	78 4f                	js     804028 <ipc_call+0xa8>
+  803fd9:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803fdd:	74 10                	je     803fef <ipc_call+0x6f>
+  803fdf:	a1 14 60 80 00       	mov    0x806014,%eax
+  803fe4:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803fea:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803fed:	89 02                	mov    %eax,(%edx)
+  803fef:	a1 14 60 80 00       	mov    0x806014,%eax
+  803ff4:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803ffa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ffd:	5b                   	pop    %ebx
+  803ffe:	5e                   	pop    %esi
+  803fff:	5f                   	pop    %edi
+  804000:	5d                   	pop    %ebp
+  804001:	c3                   	ret
+  804002:	ff 75 14             	push   0x14(%ebp)
+  804005:	ff 75 10             	push   0x10(%ebp)
+  804008:	ff 75 0c             	push   0xc(%ebp)
+  80400b:	ff 75 08             	push   0x8(%ebp)
+  80400e:	e8 13 ff ff ff       	call   803f26 <ipc_send>
+  804013:	83 c4 0c             	add    $0xc,%esp
+  804016:	ff 75 1c             	push   0x1c(%ebp)
+  804019:	ff 75 18             	push   0x18(%ebp)
+  80401c:	6a 00                	push   $0x0
+  80401e:	e8 a5 fe ff ff       	call   803ec8 <ipc_recv>
+  804023:	83 c4 10             	add    $0x10,%esp
+  804026:	eb d2                	jmp    803ffa <ipc_call+0x7a>
+  804028:	50                   	push   %eax
+  804029:	68 29 4c 80 00       	push   $0x804c29
+  80402e:	6a 6d                	push   $0x6d
+  804030:	68 1f 4c 80 00       	push   $0x804c1f
+  804035:	e8 0d c5 ff ff       	call   800547 <_panic>
+
+0080403a <ipc_reply_recv>:
+  80403a:	55                   	push   %ebp
+  80403b:	89 e5                	mov    %esp,%ebp
+  80403d:	57                   	push   %edi
+  80403e:	56                   	push   %esi
+  80403f:	53                   	push   %ebx
+  804040:	83 ec 0c             	sub    $0xc,%esp
+  804043:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804046:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  804049:	8b 7d 20             	mov    0x20(%ebp),%edi
+  80404c:	85 db                	test   %ebx,%ebx
+  80404e:	0f 84 ac 00 00 00    	je     804100 <ipc_reply_recv+0xc6>
+  804054:	85 f6                	test   %esi,%esi
+  804056:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80405b:	0f 45 c6             	cmovne %esi,%eax
+  80405e:	83 ec 0c             	sub    $0xc,%esp
+  804061:	50                   	push   %eax
+  804062:	ff 75 14             	push   0x14(%ebp)
+  804065:	53                   	push   %ebx
+  804066:	ff 75 0c             	push   0xc(%ebp)
+  804069:	ff 75 08             	push   0x8(%ebp)
+  80406c:	e8 b1 d4 ff ff       	call   801522 <sys_ipc_reply_recv>
+  804071:	83 c4 20             	add    $0x20,%esp
+  804074:	85 c0                	test   %eax,%eax
+  804076:	78 3a                	js     8040b2 <ipc_reply_recv+0x78>
+  804078:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80407c:	74 10                	je     80408e <ipc_reply_recv+0x54>
+  80407e:	a1 14 60 80 00       	mov    0x806014,%eax
+  804083:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  804089:	8b 55 18             	mov    0x18(%ebp),%edx
+  80408c:	89 02                	mov    %eax,(%edx)
+  80408e:	85 ff                	test   %edi,%edi
+  804090:	74 0d                	je     80409f <ipc_reply_recv+0x65>
+  804092:	a1 14 60 80 00       	mov    0x806014,%eax
+  804097:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  80409d:	89 07                	mov    %eax,(%edi)
+  80409f:	a1 14 60 80 00       	mov    0x806014,%eax
+  8040a4:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  8040aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040ad:	5b                   	pop    %ebx
+  8040ae:	5e                   	pop    %esi
+  8040af:	5f                   	pop    %edi
+  8040b0:	5d                   	pop    %ebp
+  8040b1:	c3                   	ret
+  8040b2:	ff 75 14             	push   0x14(%ebp)
+  8040b5:	53                   	push   %ebx
+  8040b6:	ff 75 0c             	push   0xc(%ebp)
+  8040b9:	ff 75 08             	push   0x8(%ebp)
+  8040bc:	e8 13 d3 ff ff       	call   8013d4 <sys_ipc_try_send>
+  8040c1:	89 c2                	mov    %eax,%edx
+  8040c3:	c1 ea 1f             	shr    $0x1f,%edx
+  8040c6:	83 c4 10             	add    $0x10,%esp
+  8040c9:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8040cc:	0f 95 c1             	setne  %cl
+  8040cf:	84 d1                	test   %dl,%cl
+  8040d1:	74 05                	je     8040d8 <ipc_reply_recv+0x9e>
+  8040d3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8040d6:	75 12                	jne    8040ea <ipc_reply_recv+0xb0>
+  8040d8:	83 ec 04             	sub    $0x4,%esp
+  8040db:	57                   	push   %edi
+  8040dc:	56                   	push   %esi
+  8040dd:	ff 75 18             	push   0x18(%ebp)
+  8040e0:	e8 e3 fd ff ff       	call   803ec8 <ipc_recv>
+  8040e5:	83 c4 10             	add    $0x10,%esp
+  8040e8:	eb c0                	jmp    8040aa <ipc_reply_recv+0x70>
+  8040ea:	83 ec 04             	sub    $0x4,%esp
+  8040ed:	50                   	push   %eax
+  8040ee:	ff 75 08             	push   0x8(%ebp)
+  8040f1:	68 fc 4b 80 00       	push   $0x804bfc
+  8040f6:	e8 27 c5 ff ff       	call   800622 <cprintf>
+  8040fb:	83 c4 10             	add    $0x10,%esp
+  8040fe:	eb d8                	jmp    8040d8 <ipc_reply_recv+0x9e>
+  804100:	85 f6                	test   %esi,%esi
+  804102:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  804107:	0f 45 c6             	cmovne %esi,%eax
+  80410a:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80410f:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  804116:	e9 43 ff ff ff       	jmp    80405e <ipc_reply_recv+0x24>
+
+0080411b <ipc_find_env>:
+  80411b:	55                   	push   %ebp
+  80411c:	89 e5                	mov    %esp,%ebp
+  80411e:	83 ec 14             	sub    $0x14,%esp
+  804121:	ff 75 08             	push   0x8(%ebp)
+  804124:	e8 49 d2 ff ff       	call   801372 <sys_env_service>
+  804129:	85 c0                	test   %eax,%eax
+  80412b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804130:	0f 48 c2             	cmovs  %edx,%eax
+  804133:	c9                   	leave
+  804134:	c3                   	ret
+
+00804135 <pageref>:
+  804135:	55                   	push   %ebp
+  804136:	89 e5                	mov    %esp,%ebp
+  804138:	8b 45 08             	mov    0x8(%ebp),%eax
+  80413b:	89 c2                	mov    %eax,%edx
+  80413d:	c1 ea 16             	shr    $0x16,%edx
+  804140:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  804147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80414c:	f6 c1 01             	test   $0x1,%cl
+  80414f:	74 22                	je     804173 <pageref+0x3e>
+  804151:	c1 e8 0c             	shr    $0xc,%eax
+  804154:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80415b:	a8 01                	test   $0x1,%al
+  80415d:	74 14                	je     804173 <pageref+0x3e>
+  80415f:	c1 e8 0c             	shr    $0xc,%eax
+  804162:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  804165:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80416c:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  804170:	0f b7 d2             	movzwl %dx,%edx
+  804173:	89 d0                	mov    %edx,%eax
+  804175:	5d                   	pop    %ebp
+  804176:	c3                   	ret
+
+00804177 <__udivmoddi4>:
+  804177:	55                   	push   %ebp
+  804178:	57                   	push   %edi
+  804179:	56                   	push   %esi
+  80417a:	53                   	push   %ebx
+  80417b:	83 ec 24             	sub    $0x24,%esp
+  80417e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804182:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804186:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80418a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80418e:	8b 44 24 40          	mov    0x40(%esp),%eax
+  804192:	8b 54 24 44          	mov    0x44(%esp),%edx
+  804196:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80419a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80419e:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  8041a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041ac:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8041b1:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8041b8:	00 
+  8041b9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8041c0:	00 
+  8041c1:	89 fb                	mov    %edi,%ebx
+  8041c3:	eb 08                	jmp    8041cd <__udivmoddi4+0x56>
+  8041c5:	83 e9 01             	sub    $0x1,%ecx
+  8041c8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8041cb:	74 68                	je     804235 <__udivmoddi4+0xbe>
+  8041cd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8041d1:	01 c0                	add    %eax,%eax
+  8041d3:	89 c6                	mov    %eax,%esi
+  8041d5:	89 d7                	mov    %edx,%edi
+  8041d7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8041db:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8041df:	0f ad d0             	shrd   %cl,%edx,%eax
+  8041e2:	d3 ea                	shr    %cl,%edx
+  8041e4:	f6 c1 20             	test   $0x20,%cl
+  8041e7:	74 04                	je     8041ed <__udivmoddi4+0x76>
+  8041e9:	89 d0                	mov    %edx,%eax
+  8041eb:	31 d2                	xor    %edx,%edx
+  8041ed:	83 e0 01             	and    $0x1,%eax
+  8041f0:	89 04 24             	mov    %eax,(%esp)
+  8041f3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8041fa:	00 
+  8041fb:	8b 04 24             	mov    (%esp),%eax
+  8041fe:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804202:	09 f0                	or     %esi,%eax
+  804204:	09 fa                	or     %edi,%edx
+  804206:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80420a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80420e:	39 f0                	cmp    %esi,%eax
+  804210:	89 d5                	mov    %edx,%ebp
+  804212:	19 fd                	sbb    %edi,%ebp
+  804214:	72 af                	jb     8041c5 <__udivmoddi4+0x4e>
+  804216:	29 f0                	sub    %esi,%eax
+  804218:	19 fa                	sbb    %edi,%edx
+  80421a:	89 cf                	mov    %ecx,%edi
+  80421c:	c1 ef 05             	shr    $0x5,%edi
+  80421f:	83 e7 01             	and    $0x1,%edi
+  804222:	89 fe                	mov    %edi,%esi
+  804224:	83 f6 01             	xor    $0x1,%esi
+  804227:	d3 e6                	shl    %cl,%esi
+  804229:	d3 e7                	shl    %cl,%edi
+  80422b:	09 74 24 18          	or     %esi,0x18(%esp)
+  80422f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804233:	eb 90                	jmp    8041c5 <__udivmoddi4+0x4e>
+  804235:	85 db                	test   %ebx,%ebx
+  804237:	74 05                	je     80423e <__udivmoddi4+0xc7>
+  804239:	89 03                	mov    %eax,(%ebx)
+  80423b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80423e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804242:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804246:	83 c4 24             	add    $0x24,%esp
+  804249:	5b                   	pop    %ebx
+  80424a:	5e                   	pop    %esi
+  80424b:	5f                   	pop    %edi
+  80424c:	5d                   	pop    %ebp
+  80424d:	c3                   	ret
+
+0080424e <__udivdi3>:
+  80424e:	83 ec 08             	sub    $0x8,%esp
+  804251:	6a 00                	push   $0x0
+  804253:	ff 74 24 1c          	push   0x1c(%esp)
+  804257:	ff 74 24 1c          	push   0x1c(%esp)
+  80425b:	ff 74 24 1c          	push   0x1c(%esp)
+  80425f:	ff 74 24 1c          	push   0x1c(%esp)
+  804263:	e8 0f ff ff ff       	call   804177 <__udivmoddi4>
+  804268:	83 c4 1c             	add    $0x1c,%esp
+  80426b:	c3                   	ret
+
+0080426c <__umoddi3>:
+  80426c:	83 ec 18             	sub    $0x18,%esp
+  80426f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804273:	50                   	push   %eax
+  804274:	ff 74 24 2c          	push   0x2c(%esp)
+  804278:	ff 74 24 2c          	push   0x2c(%esp)
+  80427c:	ff 74 24 2c          	push   0x2c(%esp)
+  804280:	ff 74 24 2c          	push   0x2c(%esp)
+  804284:	e8 ee fe ff ff       	call   804177 <__udivmoddi4>
+  804289:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80428d:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804291:	83 c4 2c             	add    $0x2c,%esp
+  804294:	c3                   	ret
+
+00804295 <__divdi3>:
+  804295:	53                   	push   %ebx
+  804296:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80429a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80429e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8042a2:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8042a6:	85 d2                	test   %edx,%edx
+  8042a8:	78 12                	js     8042bc <__divdi3+0x27>
+  8042aa:	85 db                	test   %ebx,%ebx
+  8042ac:	78 2e                	js     8042dc <__divdi3+0x47>
+  8042ae:	53                   	push   %ebx
+  8042af:	51                   	push   %ecx
+  8042b0:	52                   	push   %edx
+  8042b1:	50                   	push   %eax
+  8042b2:	e8 97 ff ff ff       	call   80424e <__udivdi3>
+  8042b7:	83 c4 10             	add    $0x10,%esp
+  8042ba:	eb 1e                	jmp    8042da <__divdi3+0x45>
+  8042bc:	f7 d8                	neg    %eax
+  8042be:	83 d2 00             	adc    $0x0,%edx
+  8042c1:	f7 da                	neg    %edx
+  8042c3:	85 db                	test   %ebx,%ebx
+  8042c5:	78 2a                	js     8042f1 <__divdi3+0x5c>
+  8042c7:	53                   	push   %ebx
+  8042c8:	51                   	push   %ecx
+  8042c9:	52                   	push   %edx
+  8042ca:	50                   	push   %eax
+  8042cb:	e8 7e ff ff ff       	call   80424e <__udivdi3>
+  8042d0:	83 c4 10             	add    $0x10,%esp
+  8042d3:	f7 d8                	neg    %eax
+  8042d5:	83 d2 00             	adc    $0x0,%edx
+  8042d8:	f7 da                	neg    %edx
+  8042da:	5b                   	pop    %ebx
+  8042db:	c3                   	ret
+  8042dc:	f7 d9                	neg    %ecx
+  8042de:	83 d3 00             	adc    $0x0,%ebx
+  8042e1:	f7 db                	neg    %ebx
+  8042e3:	53                   	push   %ebx
+  8042e4:	51                   	push   %ecx
+  8042e5:	52                   	push   %edx
+  8042e6:	50                   	push   %eax
+  8042e7:	e8 62 ff ff ff       	call   80424e <__udivdi3>
+  8042ec:	83 c4 10             	add    $0x10,%esp
+  8042ef:	eb e2                	jmp    8042d3 <__divdi3+0x3e>
+  8042f1:	f7 d9                	neg    %ecx
+  8042f3:	83 d3 00             	adc    $0x0,%ebx
+  8042f6:	f7 db                	neg    %ebx
+  8042f8:	53                   	push   %ebx
+  8042f9:	51                   	push   %ecx
+  8042fa:	52                   	push   %edx
+  8042fb:	50                   	push   %eax
+  8042fc:	e8 4d ff ff ff       	call   80424e <__udivdi3>
+  804301:	83 c4 10             	add    $0x10,%esp
+  804304:	eb d4                	jmp    8042da <__divdi3+0x45>
+
+00804306 <__moddi3>:
+  804306:	55                   	push   %ebp
+  804307:	57                   	push   %edi
+  804308:	56                   	push   %esi
+  804309:	53                   	push   %ebx
+  80430a:	83 ec 0c             	sub    $0xc,%esp
+  80430d:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  804311:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  804315:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804319:	89 e9                	mov    %ebp,%ecx
+  80431b:	f7 d9                	neg    %ecx
+  80431d:	89 d0                	mov    %edx,%eax
+  80431f:	83 d0 00             	adc    $0x0,%eax
+  804322:	f7 d8                	neg    %eax
+  804324:	0f 49 e9             	cmovns %ecx,%ebp
+  804327:	0f 49 d0             	cmovns %eax,%edx
+  80432a:	52                   	push   %edx
+  80432b:	55                   	push   %ebp
+  80432c:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804330:	f7 da                	neg    %edx
+  804332:	89 d8                	mov    %ebx,%eax
+  804334:	83 d0 00             	adc    $0x0,%eax
+  804337:	f7 d8                	neg    %eax
+  804339:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  80433e:	89 54 24 08          	mov    %edx,0x8(%esp)
+  804342:	0f 48 c3             	cmovs  %ebx,%eax
+  804345:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  804349:	ff 74 24 0c          	push   0xc(%esp)
+  80434d:	ff 74 24 0c          	push   0xc(%esp)
+  804351:	e8 16 ff ff ff       	call   80426c <__umoddi3>
+  804356:	83 c4 10             	add    $0x10,%esp
+  804359:	85 db                	test   %ebx,%ebx
+  80435b:	78 08                	js     804365 <__moddi3+0x5f>
+  80435d:	83 c4 0c             	add    $0xc,%esp
+  804360:	5b                   	pop    %ebx
+  804361:	5e                   	pop    %esi
+  804362:	5f                   	pop    %edi
+  804363:	5d                   	pop    %ebp
+  804364:	c3                   	ret
+  804365:	f7 d8                	neg    %eax
+  804367:	83 d2 00             	adc    $0x0,%edx
+  80436a:	f7 da                	neg    %edx
+  80436c:	eb ef                	jmp    80435d <__moddi3+0x57>
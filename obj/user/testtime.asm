@@ -0,0 +1,5094 @@
+
+obj/user/testtime.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sleep>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	e8 2a 11 00 00       	call   801169 <sys_time_msec>
+  80003f:	69 5d 08 e8 03 00 00 	imul   $0x3e8,0x8(%ebp),%ebx
+  800046:	01 c3                	add    %eax,%ebx
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	79 05                	jns    800051 <sleep+0x1e>
+  80004c:	83 f8 ee             	cmp    $0xffffffee,%eax
+  80004f:	7d 18                	jge    800069 <sleep+0x36>
+  800051:	39 c3                	cmp    %eax,%ebx
+  800053:	73 2b                	jae    800080 <sleep+0x4d>
+  800055:	83 ec 04             	sub    $0x4,%esp
+  800058:	68 42 32 80 00       	push   $0x803242
+  80005d:	6a 0d                	push   $0xd
+  80005f:	68 32 32 80 00       	push   $0x803232
+  800064:	e8 04 01 00 00       	call   80016d <_panic>
+  800069:	50                   	push   %eax
+  80006a:	68 20 32 80 00       	push   $0x803220
+  80006f:	6a 0b                	push   $0xb
+  800071:	68 32 32 80 00       	push   $0x803232
+  800076:	e8 f2 00 00 00       	call   80016d <_panic>
+  80007b:	e8 d4 0c 00 00       	call   800d54 <sys_yield>
+  800080:	e8 e4 10 00 00       	call   801169 <sys_time_msec>
+  800085:	39 d8                	cmp    %ebx,%eax
+  800087:	72 f2                	jb     80007b <sleep+0x48>
+  800089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80008c:	c9                   	leave
+  80008d:	c3                   	ret
+
+0080008e <umain>:
+  80008e:	55                   	push   %ebp
+  80008f:	89 e5                	mov    %esp,%ebp
+  800091:	53                   	push   %ebx
+  800092:	83 ec 04             	sub    $0x4,%esp
+  800095:	bb 32 00 00 00       	mov    $0x32,%ebx
+  80009a:	e8 b5 0c 00 00       	call   800d54 <sys_yield>
+  80009f:	83 eb 01             	sub    $0x1,%ebx
+  8000a2:	75 f6                	jne    80009a <umain+0xc>
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	68 4e 32 80 00       	push   $0x80324e
+  8000ac:	e8 97 01 00 00       	call   800248 <cprintf>
+  8000b1:	83 c4 10             	add    $0x10,%esp
+  8000b4:	bb 05 00 00 00       	mov    $0x5,%ebx
+  8000b9:	83 ec 08             	sub    $0x8,%esp
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 64 32 80 00       	push   $0x803264
+  8000c2:	e8 81 01 00 00       	call   800248 <cprintf>
+  8000c7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8000ce:	e8 60 ff ff ff       	call   800033 <sleep>
+  8000d3:	83 eb 01             	sub    $0x1,%ebx
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8000dc:	75 db                	jne    8000b9 <umain+0x2b>
+  8000de:	83 ec 0c             	sub    $0xc,%esp
+  8000e1:	68 ce 36 80 00       	push   $0x8036ce
+  8000e6:	e8 5d 01 00 00       	call   800248 <cprintf>
+  8000eb:	cc                   	int3
+  8000ec:	83 c4 10             	add    $0x10,%esp
+  8000ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f2:	c9                   	leave
+  8000f3:	c3                   	ret
+
+008000f4 <libmain>:
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000ff:	e8 31 0c 00 00       	call   800d35 <sys_getenvid>
+  800104:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800109:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  80010f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800114:	a3 10 50 80 00       	mov    %eax,0x805010
+  800119:	85 db                	test   %ebx,%ebx
+  80011b:	7e 07                	jle    800124 <libmain+0x30>
+  80011d:	8b 06                	mov    (%esi),%eax
+  80011f:	a3 00 40 80 00       	mov    %eax,0x804000
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	e8 60 ff ff ff       	call   80008e <umain>
+  80012e:	e8 0a 00 00 00       	call   80013d <exit>
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+
+0080013d <exit>:
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	a1 10 50 80 00       	mov    0x805010,%eax
+  800148:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80014e:	85 c0                	test   %eax,%eax
+  800150:	75 14                	jne    800166 <exit+0x29>
+  800152:	e8 80 16 00 00       	call   8017d7 <close_all>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	6a 00                	push   $0x0
+  80015c:	e8 93 0b 00 00       	call   800cf4 <sys_env_destroy>
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+  800166:	e8 f6 12 00 00       	call   801461 <sys_lease_complete>
+  80016b:	eb e5                	jmp    800152 <exit+0x15>
+
+0080016d <_panic>:
+  80016d:	55                   	push   %ebp
+  80016e:	89 e5                	mov    %esp,%ebp
+  800170:	56                   	push   %esi
+  800171:	53                   	push   %ebx
+  800172:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800175:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80017b:	e8 b5 0b 00 00       	call   800d35 <sys_getenvid>
+  800180:	83 ec 0c             	sub    $0xc,%esp
+  800183:	ff 75 0c             	push   0xc(%ebp)
+  800186:	ff 75 08             	push   0x8(%ebp)
+  800189:	56                   	push   %esi
+  80018a:	50                   	push   %eax
+  80018b:	68 74 32 80 00       	push   $0x803274
+  800190:	e8 b3 00 00 00       	call   800248 <cprintf>
+  800195:	83 c4 18             	add    $0x18,%esp
+  800198:	53                   	push   %ebx
+  800199:	ff 75 10             	push   0x10(%ebp)
+  80019c:	e8 56 00 00 00       	call   8001f7 <vcprintf>
+  8001a1:	c7 04 24 ce 36 80 00 	movl   $0x8036ce,(%esp)
+  8001a8:	e8 9b 00 00 00       	call   800248 <cprintf>
+  8001ad:	83 c4 10             	add    $0x10,%esp
+  8001b0:	cc                   	int3
+  8001b1:	eb fd                	jmp    8001b0 <_panic+0x43>
+
+008001b3 <putch>:
+  8001b3:	55                   	push   %ebp
+  8001b4:	89 e5                	mov    %esp,%ebp
+  8001b6:	53                   	push   %ebx
+  8001b7:	83 ec 04             	sub    $0x4,%esp
+  8001ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001bd:	8b 13                	mov    (%ebx),%edx
+  8001bf:	8d 42 01             	lea    0x1(%edx),%eax
+  8001c2:	89 03                	mov    %eax,(%ebx)
+  8001c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001c7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8001cb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001d0:	74 09                	je     8001db <putch+0x28>
+  8001d2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8001d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+  8001db:	83 ec 08             	sub    $0x8,%esp
+  8001de:	68 ff 00 00 00       	push   $0xff
+  8001e3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	e8 cb 0a 00 00       	call   800cb7 <sys_cputs>
+  8001ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001f2:	83 c4 10             	add    $0x10,%esp
+  8001f5:	eb db                	jmp    8001d2 <putch+0x1f>
+
+008001f7 <vcprintf>:
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800200:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800207:	00 00 00 
+  80020a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800211:	00 00 00 
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	ff 75 08             	push   0x8(%ebp)
+  80021a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800220:	50                   	push   %eax
+  800221:	68 b3 01 80 00       	push   $0x8001b3
+  800226:	e8 1c 01 00 00       	call   800347 <vprintfmt>
+  80022b:	83 c4 08             	add    $0x8,%esp
+  80022e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800234:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80023a:	50                   	push   %eax
+  80023b:	e8 77 0a 00 00       	call   800cb7 <sys_cputs>
+  800240:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800246:	c9                   	leave
+  800247:	c3                   	ret
+
+00800248 <cprintf>:
+  800248:	55                   	push   %ebp
+  800249:	89 e5                	mov    %esp,%ebp
+  80024b:	83 ec 10             	sub    $0x10,%esp
+  80024e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800251:	50                   	push   %eax
+  800252:	ff 75 08             	push   0x8(%ebp)
+  800255:	e8 9d ff ff ff       	call   8001f7 <vcprintf>
+  80025a:	c9                   	leave
+  80025b:	c3                   	ret
+
+0080025c <printnum>:
+  80025c:	55                   	push   %ebp
+  80025d:	89 e5                	mov    %esp,%ebp
+  80025f:	57                   	push   %edi
+  800260:	56                   	push   %esi
+  800261:	53                   	push   %ebx
+  800262:	83 ec 1c             	sub    $0x1c,%esp
+  800265:	89 c3                	mov    %eax,%ebx
+  800267:	89 d6                	mov    %edx,%esi
+  800269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80026f:	89 d1                	mov    %edx,%ecx
+  800271:	89 c2                	mov    %eax,%edx
+  800273:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800276:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800279:	8b 45 10             	mov    0x10(%ebp),%eax
+  80027c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80027f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800286:	39 c2                	cmp    %eax,%edx
+  800288:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80028b:	73 4b                	jae    8002d8 <printnum+0x7c>
+  80028d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800290:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800293:	85 ff                	test   %edi,%edi
+  800295:	7e 11                	jle    8002a8 <printnum+0x4c>
+  800297:	83 ec 08             	sub    $0x8,%esp
+  80029a:	56                   	push   %esi
+  80029b:	ff 75 18             	push   0x18(%ebp)
+  80029e:	ff d3                	call   *%ebx
+  8002a0:	83 c4 10             	add    $0x10,%esp
+  8002a3:	83 ef 01             	sub    $0x1,%edi
+  8002a6:	75 ef                	jne    800297 <printnum+0x3b>
+  8002a8:	83 ec 08             	sub    $0x8,%esp
+  8002ab:	56                   	push   %esi
+  8002ac:	83 ec 04             	sub    $0x4,%esp
+  8002af:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b2:	ff 75 e0             	push   -0x20(%ebp)
+  8002b5:	ff 75 dc             	push   -0x24(%ebp)
+  8002b8:	ff 75 d8             	push   -0x28(%ebp)
+  8002bb:	e8 50 2e 00 00       	call   803110 <__umoddi3>
+  8002c0:	83 c4 14             	add    $0x14,%esp
+  8002c3:	0f be 80 97 32 80 00 	movsbl 0x803297(%eax),%eax
+  8002ca:	50                   	push   %eax
+  8002cb:	ff d3                	call   *%ebx
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d3:	5b                   	pop    %ebx
+  8002d4:	5e                   	pop    %esi
+  8002d5:	5f                   	pop    %edi
+  8002d6:	5d                   	pop    %ebp
+  8002d7:	c3                   	ret
+  8002d8:	83 ec 0c             	sub    $0xc,%esp
+  8002db:	ff 75 18             	push   0x18(%ebp)
+  8002de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002e4:	52                   	push   %edx
+  8002e5:	50                   	push   %eax
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+  8002e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ec:	ff 75 e0             	push   -0x20(%ebp)
+  8002ef:	ff 75 dc             	push   -0x24(%ebp)
+  8002f2:	ff 75 d8             	push   -0x28(%ebp)
+  8002f5:	e8 f8 2d 00 00       	call   8030f2 <__udivdi3>
+  8002fa:	83 c4 18             	add    $0x18,%esp
+  8002fd:	52                   	push   %edx
+  8002fe:	50                   	push   %eax
+  8002ff:	89 f2                	mov    %esi,%edx
+  800301:	89 d8                	mov    %ebx,%eax
+  800303:	e8 54 ff ff ff       	call   80025c <printnum>
+  800308:	83 c4 20             	add    $0x20,%esp
+  80030b:	eb 9b                	jmp    8002a8 <printnum+0x4c>
+
+0080030d <sprintputch>:
+  80030d:	55                   	push   %ebp
+  80030e:	89 e5                	mov    %esp,%ebp
+  800310:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800313:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800317:	8b 10                	mov    (%eax),%edx
+  800319:	3b 50 04             	cmp    0x4(%eax),%edx
+  80031c:	73 0a                	jae    800328 <sprintputch+0x1b>
+  80031e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800321:	89 08                	mov    %ecx,(%eax)
+  800323:	8b 45 08             	mov    0x8(%ebp),%eax
+  800326:	88 02                	mov    %al,(%edx)
+  800328:	5d                   	pop    %ebp
+  800329:	c3                   	ret
+
+0080032a <printfmt>:
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	83 ec 08             	sub    $0x8,%esp
+  800330:	8d 45 14             	lea    0x14(%ebp),%eax
+  800333:	50                   	push   %eax
+  800334:	ff 75 10             	push   0x10(%ebp)
+  800337:	ff 75 0c             	push   0xc(%ebp)
+  80033a:	ff 75 08             	push   0x8(%ebp)
+  80033d:	e8 05 00 00 00       	call   800347 <vprintfmt>
+  800342:	83 c4 10             	add    $0x10,%esp
+  800345:	c9                   	leave
+  800346:	c3                   	ret
+
+00800347 <vprintfmt>:
+  800347:	55                   	push   %ebp
+  800348:	89 e5                	mov    %esp,%ebp
+  80034a:	57                   	push   %edi
+  80034b:	56                   	push   %esi
+  80034c:	53                   	push   %ebx
+  80034d:	83 ec 2c             	sub    $0x2c,%esp
+  800350:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800353:	89 df                	mov    %ebx,%edi
+  800355:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800358:	8b 45 10             	mov    0x10(%ebp),%eax
+  80035b:	8d 70 01             	lea    0x1(%eax),%esi
+  80035e:	0f b6 00             	movzbl (%eax),%eax
+  800361:	83 f8 25             	cmp    $0x25,%eax
+  800364:	74 1e                	je     800384 <vprintfmt+0x3d>
+  800366:	85 c0                	test   %eax,%eax
+  800368:	0f 84 15 05 00 00    	je     800883 <vprintfmt+0x53c>
+  80036e:	83 ec 08             	sub    $0x8,%esp
+  800371:	53                   	push   %ebx
+  800372:	50                   	push   %eax
+  800373:	ff d7                	call   *%edi
+  800375:	83 c6 01             	add    $0x1,%esi
+  800378:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80037c:	83 c4 10             	add    $0x10,%esp
+  80037f:	83 f8 25             	cmp    $0x25,%eax
+  800382:	75 e2                	jne    800366 <vprintfmt+0x1f>
+  800384:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800388:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80038f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800396:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80039d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8003a5:	8d 56 01             	lea    0x1(%esi),%edx
+  8003a8:	0f b6 0e             	movzbl (%esi),%ecx
+  8003ab:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003ae:	3c 55                	cmp    $0x55,%al
+  8003b0:	0f 87 3b 04 00 00    	ja     8007f1 <vprintfmt+0x4aa>
+  8003b6:	0f b6 c0             	movzbl %al,%eax
+  8003b9:	ff 24 85 e0 33 80 00 	jmp    *0x8033e0(,%eax,4)
+  8003c0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003c3:	eb 93                	jmp    800358 <vprintfmt+0x11>
+  8003c5:	89 d6                	mov    %edx,%esi
+  8003c7:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003cb:	eb d8                	jmp    8003a5 <vprintfmt+0x5e>
+  8003cd:	89 d6                	mov    %edx,%esi
+  8003cf:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003d3:	eb d0                	jmp    8003a5 <vprintfmt+0x5e>
+  8003d5:	0f b6 c9             	movzbl %cl,%ecx
+  8003d8:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003db:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003de:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8003e2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003e5:	83 f9 09             	cmp    $0x9,%ecx
+  8003e8:	77 6f                	ja     800459 <vprintfmt+0x112>
+  8003ea:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8003ed:	83 c2 01             	add    $0x1,%edx
+  8003f0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003f3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8003f7:	0f be 02             	movsbl (%edx),%eax
+  8003fa:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003fd:	83 fe 09             	cmp    $0x9,%esi
+  800400:	76 eb                	jbe    8003ed <vprintfmt+0xa6>
+  800402:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800405:	89 d6                	mov    %edx,%esi
+  800407:	eb 13                	jmp    80041c <vprintfmt+0xd5>
+  800409:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040c:	8b 00                	mov    (%eax),%eax
+  80040e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800411:	8b 45 14             	mov    0x14(%ebp),%eax
+  800414:	8d 40 04             	lea    0x4(%eax),%eax
+  800417:	89 45 14             	mov    %eax,0x14(%ebp)
+  80041a:	89 d6                	mov    %edx,%esi
+  80041c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800420:	79 83                	jns    8003a5 <vprintfmt+0x5e>
+  800422:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800425:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800428:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80042f:	e9 71 ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  800434:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800437:	85 c9                	test   %ecx,%ecx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	0f 49 c1             	cmovns %ecx,%eax
+  800441:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800444:	89 d6                	mov    %edx,%esi
+  800446:	e9 5a ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  80044b:	89 d6                	mov    %edx,%esi
+  80044d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800454:	e9 4c ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  800459:	89 d6                	mov    %edx,%esi
+  80045b:	eb bf                	jmp    80041c <vprintfmt+0xd5>
+  80045d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800461:	89 d6                	mov    %edx,%esi
+  800463:	e9 3d ff ff ff       	jmp    8003a5 <vprintfmt+0x5e>
+  800468:	89 55 10             	mov    %edx,0x10(%ebp)
+  80046b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046e:	8d 70 04             	lea    0x4(%eax),%esi
+  800471:	83 ec 08             	sub    $0x8,%esp
+  800474:	53                   	push   %ebx
+  800475:	ff 30                	push   (%eax)
+  800477:	ff d7                	call   *%edi
+  800479:	83 c4 10             	add    $0x10,%esp
+  80047c:	89 75 14             	mov    %esi,0x14(%ebp)
+  80047f:	e9 d4 fe ff ff       	jmp    800358 <vprintfmt+0x11>
+  800484:	89 55 10             	mov    %edx,0x10(%ebp)
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8d 70 04             	lea    0x4(%eax),%esi
+  80048d:	8b 10                	mov    (%eax),%edx
+  80048f:	89 d0                	mov    %edx,%eax
+  800491:	f7 d8                	neg    %eax
+  800493:	0f 48 c2             	cmovs  %edx,%eax
+  800496:	83 f8 12             	cmp    $0x12,%eax
+  800499:	7f 23                	jg     8004be <vprintfmt+0x177>
+  80049b:	8b 14 85 40 35 80 00 	mov    0x803540(,%eax,4),%edx
+  8004a2:	85 d2                	test   %edx,%edx
+  8004a4:	74 18                	je     8004be <vprintfmt+0x177>
+  8004a6:	52                   	push   %edx
+  8004a7:	68 9b 36 80 00       	push   $0x80369b
+  8004ac:	53                   	push   %ebx
+  8004ad:	57                   	push   %edi
+  8004ae:	e8 77 fe ff ff       	call   80032a <printfmt>
+  8004b3:	83 c4 10             	add    $0x10,%esp
+  8004b6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004b9:	e9 9a fe ff ff       	jmp    800358 <vprintfmt+0x11>
+  8004be:	50                   	push   %eax
+  8004bf:	68 af 32 80 00       	push   $0x8032af
+  8004c4:	53                   	push   %ebx
+  8004c5:	57                   	push   %edi
+  8004c6:	e8 5f fe ff ff       	call   80032a <printfmt>
+  8004cb:	83 c4 10             	add    $0x10,%esp
+  8004ce:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004d1:	e9 82 fe ff ff       	jmp    800358 <vprintfmt+0x11>
+  8004d6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dc:	83 c0 04             	add    $0x4,%eax
+  8004df:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e5:	8b 00                	mov    (%eax),%eax
+  8004e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ea:	85 c0                	test   %eax,%eax
+  8004ec:	0f 84 61 03 00 00    	je     800853 <vprintfmt+0x50c>
+  8004f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004f6:	7e 06                	jle    8004fe <vprintfmt+0x1b7>
+  8004f8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004fc:	75 29                	jne    800527 <vprintfmt+0x1e0>
+  8004fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800501:	8d 70 01             	lea    0x1(%eax),%esi
+  800504:	0f b6 00             	movzbl (%eax),%eax
+  800507:	0f be d0             	movsbl %al,%edx
+  80050a:	85 d2                	test   %edx,%edx
+  80050c:	0f 84 bb 00 00 00    	je     8005cd <vprintfmt+0x286>
+  800512:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800515:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800518:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80051b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80051e:	eb 7a                	jmp    80059a <vprintfmt+0x253>
+  800520:	c7 45 d0 a8 32 80 00 	movl   $0x8032a8,-0x30(%ebp)
+  800527:	83 ec 08             	sub    $0x8,%esp
+  80052a:	ff 75 d4             	push   -0x2c(%ebp)
+  80052d:	ff 75 d0             	push   -0x30(%ebp)
+  800530:	e8 e0 03 00 00       	call   800915 <strnlen>
+  800535:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800538:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80053b:	83 c4 10             	add    $0x10,%esp
+  80053e:	85 d2                	test   %edx,%edx
+  800540:	0f 8e d6 02 00 00    	jle    80081c <vprintfmt+0x4d5>
+  800546:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80054a:	83 ec 08             	sub    $0x8,%esp
+  80054d:	53                   	push   %ebx
+  80054e:	56                   	push   %esi
+  80054f:	ff d7                	call   *%edi
+  800551:	83 c4 10             	add    $0x10,%esp
+  800554:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800558:	75 f0                	jne    80054a <vprintfmt+0x203>
+  80055a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80055d:	8d 70 01             	lea    0x1(%eax),%esi
+  800560:	0f b6 00             	movzbl (%eax),%eax
+  800563:	0f be d0             	movsbl %al,%edx
+  800566:	85 d2                	test   %edx,%edx
+  800568:	0f 84 da 02 00 00    	je     800848 <vprintfmt+0x501>
+  80056e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800571:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800574:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800577:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80057a:	eb 1e                	jmp    80059a <vprintfmt+0x253>
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	ff 75 0c             	push   0xc(%ebp)
+  800582:	52                   	push   %edx
+  800583:	ff 55 08             	call   *0x8(%ebp)
+  800586:	83 c4 10             	add    $0x10,%esp
+  800589:	83 eb 01             	sub    $0x1,%ebx
+  80058c:	83 c6 01             	add    $0x1,%esi
+  80058f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800593:	0f be d0             	movsbl %al,%edx
+  800596:	85 d2                	test   %edx,%edx
+  800598:	74 2a                	je     8005c4 <vprintfmt+0x27d>
+  80059a:	85 ff                	test   %edi,%edi
+  80059c:	78 05                	js     8005a3 <vprintfmt+0x25c>
+  80059e:	83 ef 01             	sub    $0x1,%edi
+  8005a1:	78 59                	js     8005fc <vprintfmt+0x2b5>
+  8005a3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005a7:	74 d3                	je     80057c <vprintfmt+0x235>
+  8005a9:	0f be c0             	movsbl %al,%eax
+  8005ac:	83 e8 20             	sub    $0x20,%eax
+  8005af:	83 f8 5e             	cmp    $0x5e,%eax
+  8005b2:	76 c8                	jbe    80057c <vprintfmt+0x235>
+  8005b4:	83 ec 08             	sub    $0x8,%esp
+  8005b7:	ff 75 0c             	push   0xc(%ebp)
+  8005ba:	6a 3f                	push   $0x3f
+  8005bc:	ff 55 08             	call   *0x8(%ebp)
+  8005bf:	83 c4 10             	add    $0x10,%esp
+  8005c2:	eb c5                	jmp    800589 <vprintfmt+0x242>
+  8005c4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005cd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005d0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005d4:	7e 1b                	jle    8005f1 <vprintfmt+0x2aa>
+  8005d6:	83 ec 08             	sub    $0x8,%esp
+  8005d9:	53                   	push   %ebx
+  8005da:	6a 20                	push   $0x20
+  8005dc:	ff d7                	call   *%edi
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	83 ee 01             	sub    $0x1,%esi
+  8005e4:	75 f0                	jne    8005d6 <vprintfmt+0x28f>
+  8005e6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ec:	e9 67 fd ff ff       	jmp    800358 <vprintfmt+0x11>
+  8005f1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f7:	e9 5c fd ff ff       	jmp    800358 <vprintfmt+0x11>
+  8005fc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800602:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800605:	eb c6                	jmp    8005cd <vprintfmt+0x286>
+  800607:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80060a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80060d:	83 f9 01             	cmp    $0x1,%ecx
+  800610:	7f 1f                	jg     800631 <vprintfmt+0x2ea>
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	74 67                	je     80067d <vprintfmt+0x336>
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 30                	mov    (%eax),%esi
+  80061b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80061e:	89 f0                	mov    %esi,%eax
+  800620:	c1 f8 1f             	sar    $0x1f,%eax
+  800623:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8d 40 04             	lea    0x4(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062f:	eb 17                	jmp    800648 <vprintfmt+0x301>
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8b 50 04             	mov    0x4(%eax),%edx
+  800637:	8b 00                	mov    (%eax),%eax
+  800639:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80063c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8d 40 08             	lea    0x8(%eax),%eax
+  800645:	89 45 14             	mov    %eax,0x14(%ebp)
+  800648:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80064b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80064e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800653:	85 c9                	test   %ecx,%ecx
+  800655:	0f 89 12 01 00 00    	jns    80076d <vprintfmt+0x426>
+  80065b:	83 ec 08             	sub    $0x8,%esp
+  80065e:	53                   	push   %ebx
+  80065f:	6a 2d                	push   $0x2d
+  800661:	ff d7                	call   *%edi
+  800663:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800666:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800669:	f7 da                	neg    %edx
+  80066b:	83 d1 00             	adc    $0x0,%ecx
+  80066e:	f7 d9                	neg    %ecx
+  800670:	83 c4 10             	add    $0x10,%esp
+  800673:	be 0a 00 00 00       	mov    $0xa,%esi
+  800678:	e9 f0 00 00 00       	jmp    80076d <vprintfmt+0x426>
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8b 30                	mov    (%eax),%esi
+  800682:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800685:	89 f0                	mov    %esi,%eax
+  800687:	c1 f8 1f             	sar    $0x1f,%eax
+  80068a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+  800696:	eb b0                	jmp    800648 <vprintfmt+0x301>
+  800698:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80069b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80069e:	83 f9 01             	cmp    $0x1,%ecx
+  8006a1:	7f 1e                	jg     8006c1 <vprintfmt+0x37a>
+  8006a3:	85 c9                	test   %ecx,%ecx
+  8006a5:	74 32                	je     8006d9 <vprintfmt+0x392>
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006bc:	e9 ac 00 00 00       	jmp    80076d <vprintfmt+0x426>
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006cf:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006d4:	e9 94 00 00 00       	jmp    80076d <vprintfmt+0x426>
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 10                	mov    (%eax),%edx
+  8006de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e9:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006ee:	eb 7d                	jmp    80076d <vprintfmt+0x426>
+  8006f0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006f3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f6:	83 f9 01             	cmp    $0x1,%ecx
+  8006f9:	7f 1b                	jg     800716 <vprintfmt+0x3cf>
+  8006fb:	85 c9                	test   %ecx,%ecx
+  8006fd:	74 2c                	je     80072b <vprintfmt+0x3e4>
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8b 10                	mov    (%eax),%edx
+  800704:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800709:	8d 40 04             	lea    0x4(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070f:	be 08 00 00 00       	mov    $0x8,%esi
+  800714:	eb 57                	jmp    80076d <vprintfmt+0x426>
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 10                	mov    (%eax),%edx
+  80071b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071e:	8d 40 08             	lea    0x8(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+  800724:	be 08 00 00 00       	mov    $0x8,%esi
+  800729:	eb 42                	jmp    80076d <vprintfmt+0x426>
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 10                	mov    (%eax),%edx
+  800730:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800735:	8d 40 04             	lea    0x4(%eax),%eax
+  800738:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073b:	be 08 00 00 00       	mov    $0x8,%esi
+  800740:	eb 2b                	jmp    80076d <vprintfmt+0x426>
+  800742:	89 55 10             	mov    %edx,0x10(%ebp)
+  800745:	83 ec 08             	sub    $0x8,%esp
+  800748:	53                   	push   %ebx
+  800749:	6a 30                	push   $0x30
+  80074b:	ff d7                	call   *%edi
+  80074d:	83 c4 08             	add    $0x8,%esp
+  800750:	53                   	push   %ebx
+  800751:	6a 78                	push   $0x78
+  800753:	ff d7                	call   *%edi
+  800755:	8b 45 14             	mov    0x14(%ebp),%eax
+  800758:	8b 10                	mov    (%eax),%edx
+  80075a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075f:	83 c4 10             	add    $0x10,%esp
+  800762:	8d 40 04             	lea    0x4(%eax),%eax
+  800765:	89 45 14             	mov    %eax,0x14(%ebp)
+  800768:	be 10 00 00 00       	mov    $0x10,%esi
+  80076d:	83 ec 0c             	sub    $0xc,%esp
+  800770:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800774:	50                   	push   %eax
+  800775:	ff 75 e4             	push   -0x1c(%ebp)
+  800778:	56                   	push   %esi
+  800779:	51                   	push   %ecx
+  80077a:	52                   	push   %edx
+  80077b:	89 da                	mov    %ebx,%edx
+  80077d:	89 f8                	mov    %edi,%eax
+  80077f:	e8 d8 fa ff ff       	call   80025c <printnum>
+  800784:	83 c4 20             	add    $0x20,%esp
+  800787:	e9 cc fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  80078c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80078f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800792:	83 f9 01             	cmp    $0x1,%ecx
+  800795:	7f 1b                	jg     8007b2 <vprintfmt+0x46b>
+  800797:	85 c9                	test   %ecx,%ecx
+  800799:	74 2c                	je     8007c7 <vprintfmt+0x480>
+  80079b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079e:	8b 10                	mov    (%eax),%edx
+  8007a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ab:	be 10 00 00 00       	mov    $0x10,%esi
+  8007b0:	eb bb                	jmp    80076d <vprintfmt+0x426>
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 10                	mov    (%eax),%edx
+  8007b7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c0:	be 10 00 00 00       	mov    $0x10,%esi
+  8007c5:	eb a6                	jmp    80076d <vprintfmt+0x426>
+  8007c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ca:	8b 10                	mov    (%eax),%edx
+  8007cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d7:	be 10 00 00 00       	mov    $0x10,%esi
+  8007dc:	eb 8f                	jmp    80076d <vprintfmt+0x426>
+  8007de:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e1:	83 ec 08             	sub    $0x8,%esp
+  8007e4:	53                   	push   %ebx
+  8007e5:	6a 25                	push   $0x25
+  8007e7:	ff d7                	call   *%edi
+  8007e9:	83 c4 10             	add    $0x10,%esp
+  8007ec:	e9 67 fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  8007f1:	83 ec 08             	sub    $0x8,%esp
+  8007f4:	53                   	push   %ebx
+  8007f5:	6a 25                	push   $0x25
+  8007f7:	ff d7                	call   *%edi
+  8007f9:	83 c4 10             	add    $0x10,%esp
+  8007fc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800800:	0f 84 ba fb ff ff    	je     8003c0 <vprintfmt+0x79>
+  800806:	89 75 10             	mov    %esi,0x10(%ebp)
+  800809:	89 f0                	mov    %esi,%eax
+  80080b:	83 e8 01             	sub    $0x1,%eax
+  80080e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800812:	75 f7                	jne    80080b <vprintfmt+0x4c4>
+  800814:	89 45 10             	mov    %eax,0x10(%ebp)
+  800817:	e9 3c fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  80081c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80081f:	8d 70 01             	lea    0x1(%eax),%esi
+  800822:	0f b6 00             	movzbl (%eax),%eax
+  800825:	0f be d0             	movsbl %al,%edx
+  800828:	85 d2                	test   %edx,%edx
+  80082a:	74 11                	je     80083d <vprintfmt+0x4f6>
+  80082c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80082f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800832:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800835:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800838:	e9 5d fd ff ff       	jmp    80059a <vprintfmt+0x253>
+  80083d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800840:	89 45 14             	mov    %eax,0x14(%ebp)
+  800843:	e9 10 fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  800848:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084e:	e9 05 fb ff ff       	jmp    800358 <vprintfmt+0x11>
+  800853:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800857:	7e 0a                	jle    800863 <vprintfmt+0x51c>
+  800859:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80085d:	0f 85 bd fc ff ff    	jne    800520 <vprintfmt+0x1d9>
+  800863:	ba 28 00 00 00       	mov    $0x28,%edx
+  800868:	b8 28 00 00 00       	mov    $0x28,%eax
+  80086d:	be a9 32 80 00       	mov    $0x8032a9,%esi
+  800872:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800875:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800878:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80087b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80087e:	e9 17 fd ff ff       	jmp    80059a <vprintfmt+0x253>
+  800883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800886:	5b                   	pop    %ebx
+  800887:	5e                   	pop    %esi
+  800888:	5f                   	pop    %edi
+  800889:	5d                   	pop    %ebp
+  80088a:	c3                   	ret
+
+0080088b <vsnprintf>:
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	83 ec 18             	sub    $0x18,%esp
+  800891:	8b 45 08             	mov    0x8(%ebp),%eax
+  800894:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800897:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80089a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80089e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  8008a8:	85 c0                	test   %eax,%eax
+  8008aa:	74 26                	je     8008d2 <vsnprintf+0x47>
+  8008ac:	85 d2                	test   %edx,%edx
+  8008ae:	7e 22                	jle    8008d2 <vsnprintf+0x47>
+  8008b0:	ff 75 14             	push   0x14(%ebp)
+  8008b3:	ff 75 10             	push   0x10(%ebp)
+  8008b6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008b9:	50                   	push   %eax
+  8008ba:	68 0d 03 80 00       	push   $0x80030d
+  8008bf:	e8 83 fa ff ff       	call   800347 <vprintfmt>
+  8008c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008c7:	c6 00 00             	movb   $0x0,(%eax)
+  8008ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008cd:	83 c4 10             	add    $0x10,%esp
+  8008d0:	c9                   	leave
+  8008d1:	c3                   	ret
+  8008d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d7:	eb f7                	jmp    8008d0 <vsnprintf+0x45>
+
+008008d9 <snprintf>:
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	83 ec 08             	sub    $0x8,%esp
+  8008df:	8d 45 14             	lea    0x14(%ebp),%eax
+  8008e2:	50                   	push   %eax
+  8008e3:	ff 75 10             	push   0x10(%ebp)
+  8008e6:	ff 75 0c             	push   0xc(%ebp)
+  8008e9:	ff 75 08             	push   0x8(%ebp)
+  8008ec:	e8 9a ff ff ff       	call   80088b <vsnprintf>
+  8008f1:	c9                   	leave
+  8008f2:	c3                   	ret
+
+008008f3 <strlen>:
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f9:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008fc:	74 10                	je     80090e <strlen+0x1b>
+  8008fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800903:	83 c0 01             	add    $0x1,%eax
+  800906:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80090a:	75 f7                	jne    800903 <strlen+0x10>
+  80090c:	5d                   	pop    %ebp
+  80090d:	c3                   	ret
+  80090e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800913:	eb f7                	jmp    80090c <strlen+0x19>
+
+00800915 <strnlen>:
+  800915:	55                   	push   %ebp
+  800916:	89 e5                	mov    %esp,%ebp
+  800918:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091e:	85 d2                	test   %edx,%edx
+  800920:	74 16                	je     800938 <strnlen+0x23>
+  800922:	b8 00 00 00 00       	mov    $0x0,%eax
+  800927:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80092b:	74 09                	je     800936 <strnlen+0x21>
+  80092d:	83 c0 01             	add    $0x1,%eax
+  800930:	39 d0                	cmp    %edx,%eax
+  800932:	75 f3                	jne    800927 <strnlen+0x12>
+  800934:	89 d0                	mov    %edx,%eax
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	eb f7                	jmp    800936 <strnlen+0x21>
+
+0080093f <strcpy>:
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	53                   	push   %ebx
+  800943:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800946:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800952:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800955:	83 c0 01             	add    $0x1,%eax
+  800958:	84 d2                	test   %dl,%dl
+  80095a:	75 f2                	jne    80094e <strcpy+0xf>
+  80095c:	89 c8                	mov    %ecx,%eax
+  80095e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800961:	c9                   	leave
+  800962:	c3                   	ret
+
+00800963 <strcat>:
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	53                   	push   %ebx
+  800967:	83 ec 10             	sub    $0x10,%esp
+  80096a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80096d:	53                   	push   %ebx
+  80096e:	e8 80 ff ff ff       	call   8008f3 <strlen>
+  800973:	83 c4 08             	add    $0x8,%esp
+  800976:	ff 75 0c             	push   0xc(%ebp)
+  800979:	01 d8                	add    %ebx,%eax
+  80097b:	50                   	push   %eax
+  80097c:	e8 be ff ff ff       	call   80093f <strcpy>
+  800981:	89 d8                	mov    %ebx,%eax
+  800983:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800986:	c9                   	leave
+  800987:	c3                   	ret
+
+00800988 <strncpy>:
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	56                   	push   %esi
+  80098c:	53                   	push   %ebx
+  80098d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800990:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800993:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800996:	85 db                	test   %ebx,%ebx
+  800998:	74 17                	je     8009b1 <strncpy+0x29>
+  80099a:	01 f3                	add    %esi,%ebx
+  80099c:	89 f0                	mov    %esi,%eax
+  80099e:	83 c0 01             	add    $0x1,%eax
+  8009a1:	0f b6 0a             	movzbl (%edx),%ecx
+  8009a4:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009a7:	80 f9 01             	cmp    $0x1,%cl
+  8009aa:	83 da ff             	sbb    $0xffffffff,%edx
+  8009ad:	39 c3                	cmp    %eax,%ebx
+  8009af:	75 ed                	jne    80099e <strncpy+0x16>
+  8009b1:	89 f0                	mov    %esi,%eax
+  8009b3:	5b                   	pop    %ebx
+  8009b4:	5e                   	pop    %esi
+  8009b5:	5d                   	pop    %ebp
+  8009b6:	c3                   	ret
+
+008009b7 <strlcpy>:
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	56                   	push   %esi
+  8009bb:	53                   	push   %ebx
+  8009bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8009c5:	89 f0                	mov    %esi,%eax
+  8009c7:	85 db                	test   %ebx,%ebx
+  8009c9:	74 1e                	je     8009e9 <strlcpy+0x32>
+  8009cb:	83 eb 01             	sub    $0x1,%ebx
+  8009ce:	74 16                	je     8009e6 <strlcpy+0x2f>
+  8009d0:	01 f3                	add    %esi,%ebx
+  8009d2:	0f b6 0a             	movzbl (%edx),%ecx
+  8009d5:	84 c9                	test   %cl,%cl
+  8009d7:	74 0d                	je     8009e6 <strlcpy+0x2f>
+  8009d9:	83 c2 01             	add    $0x1,%edx
+  8009dc:	83 c0 01             	add    $0x1,%eax
+  8009df:	88 48 ff             	mov    %cl,-0x1(%eax)
+  8009e2:	39 d8                	cmp    %ebx,%eax
+  8009e4:	75 ec                	jne    8009d2 <strlcpy+0x1b>
+  8009e6:	c6 00 00             	movb   $0x0,(%eax)
+  8009e9:	29 f0                	sub    %esi,%eax
+  8009eb:	5b                   	pop    %ebx
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5d                   	pop    %ebp
+  8009ee:	c3                   	ret
+
+008009ef <strcmp>:
+  8009ef:	55                   	push   %ebp
+  8009f0:	89 e5                	mov    %esp,%ebp
+  8009f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009f8:	0f b6 01             	movzbl (%ecx),%eax
+  8009fb:	84 c0                	test   %al,%al
+  8009fd:	74 11                	je     800a10 <strcmp+0x21>
+  8009ff:	38 02                	cmp    %al,(%edx)
+  800a01:	75 0d                	jne    800a10 <strcmp+0x21>
+  800a03:	83 c1 01             	add    $0x1,%ecx
+  800a06:	83 c2 01             	add    $0x1,%edx
+  800a09:	0f b6 01             	movzbl (%ecx),%eax
+  800a0c:	84 c0                	test   %al,%al
+  800a0e:	75 ef                	jne    8009ff <strcmp+0x10>
+  800a10:	0f b6 c0             	movzbl %al,%eax
+  800a13:	0f b6 12             	movzbl (%edx),%edx
+  800a16:	29 d0                	sub    %edx,%eax
+  800a18:	5d                   	pop    %ebp
+  800a19:	c3                   	ret
+
+00800a1a <strncmp>:
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	53                   	push   %ebx
+  800a1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a21:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a24:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2c:	85 d2                	test   %edx,%edx
+  800a2e:	74 2e                	je     800a5e <strncmp+0x44>
+  800a30:	0f b6 01             	movzbl (%ecx),%eax
+  800a33:	84 c0                	test   %al,%al
+  800a35:	74 16                	je     800a4d <strncmp+0x33>
+  800a37:	3a 03                	cmp    (%ebx),%al
+  800a39:	75 12                	jne    800a4d <strncmp+0x33>
+  800a3b:	83 c1 01             	add    $0x1,%ecx
+  800a3e:	83 c3 01             	add    $0x1,%ebx
+  800a41:	83 ea 01             	sub    $0x1,%edx
+  800a44:	75 ea                	jne    800a30 <strncmp+0x16>
+  800a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4b:	eb 11                	jmp    800a5e <strncmp+0x44>
+  800a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a52:	85 d2                	test   %edx,%edx
+  800a54:	74 08                	je     800a5e <strncmp+0x44>
+  800a56:	0f b6 01             	movzbl (%ecx),%eax
+  800a59:	0f b6 13             	movzbl (%ebx),%edx
+  800a5c:	29 d0                	sub    %edx,%eax
+  800a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a61:	c9                   	leave
+  800a62:	c3                   	ret
+
+00800a63 <strchr>:
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a69:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800a6d:	0f b6 10             	movzbl (%eax),%edx
+  800a70:	84 d2                	test   %dl,%dl
+  800a72:	74 15                	je     800a89 <strchr+0x26>
+  800a74:	38 d1                	cmp    %dl,%cl
+  800a76:	74 0f                	je     800a87 <strchr+0x24>
+  800a78:	83 c0 01             	add    $0x1,%eax
+  800a7b:	0f b6 10             	movzbl (%eax),%edx
+  800a7e:	84 d2                	test   %dl,%dl
+  800a80:	75 f2                	jne    800a74 <strchr+0x11>
+  800a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a87:	5d                   	pop    %ebp
+  800a88:	c3                   	ret
+  800a89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8e:	eb f7                	jmp    800a87 <strchr+0x24>
+
+00800a90 <strfind>:
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	53                   	push   %ebx
+  800a94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a9a:	0f b6 18             	movzbl (%eax),%ebx
+  800a9d:	38 d3                	cmp    %dl,%bl
+  800a9f:	74 14                	je     800ab5 <strfind+0x25>
+  800aa1:	89 d1                	mov    %edx,%ecx
+  800aa3:	84 db                	test   %bl,%bl
+  800aa5:	74 0e                	je     800ab5 <strfind+0x25>
+  800aa7:	83 c0 01             	add    $0x1,%eax
+  800aaa:	0f b6 10             	movzbl (%eax),%edx
+  800aad:	38 ca                	cmp    %cl,%dl
+  800aaf:	74 04                	je     800ab5 <strfind+0x25>
+  800ab1:	84 d2                	test   %dl,%dl
+  800ab3:	75 f2                	jne    800aa7 <strfind+0x17>
+  800ab5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab8:	c9                   	leave
+  800ab9:	c3                   	ret
+
+00800aba <memset>:
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	57                   	push   %edi
+  800abe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800ac4:	85 c9                	test   %ecx,%ecx
+  800ac6:	74 20                	je     800ae8 <memset+0x2e>
+  800ac8:	89 f8                	mov    %edi,%eax
+  800aca:	09 c8                	or     %ecx,%eax
+  800acc:	a8 03                	test   $0x3,%al
+  800ace:	75 12                	jne    800ae2 <memset+0x28>
+  800ad0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ad4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800ada:	c1 e9 02             	shr    $0x2,%ecx
+  800add:	fc                   	cld
+  800ade:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ae0:	eb 06                	jmp    800ae8 <memset+0x2e>
+  800ae2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae5:	fc                   	cld
+  800ae6:	f3 aa                	rep stos %al,%es:(%edi)
+  800ae8:	89 f8                	mov    %edi,%eax
+  800aea:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aed:	c9                   	leave
+  800aee:	c3                   	ret
+
+00800aef <memmove>:
+  800aef:	55                   	push   %ebp
+  800af0:	89 e5                	mov    %esp,%ebp
+  800af2:	57                   	push   %edi
+  800af3:	56                   	push   %esi
+  800af4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800afa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800afd:	39 c6                	cmp    %eax,%esi
+  800aff:	73 32                	jae    800b33 <memmove+0x44>
+  800b01:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b04:	39 d0                	cmp    %edx,%eax
+  800b06:	73 2b                	jae    800b33 <memmove+0x44>
+  800b08:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800b0b:	89 d6                	mov    %edx,%esi
+  800b0d:	09 fe                	or     %edi,%esi
+  800b0f:	09 ce                	or     %ecx,%esi
+  800b11:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b17:	75 0e                	jne    800b27 <memmove+0x38>
+  800b19:	83 ef 04             	sub    $0x4,%edi
+  800b1c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b1f:	c1 e9 02             	shr    $0x2,%ecx
+  800b22:	fd                   	std
+  800b23:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b25:	eb 09                	jmp    800b30 <memmove+0x41>
+  800b27:	83 ef 01             	sub    $0x1,%edi
+  800b2a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800b2d:	fd                   	std
+  800b2e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b30:	fc                   	cld
+  800b31:	eb 1a                	jmp    800b4d <memmove+0x5e>
+  800b33:	89 f2                	mov    %esi,%edx
+  800b35:	09 c2                	or     %eax,%edx
+  800b37:	09 ca                	or     %ecx,%edx
+  800b39:	f6 c2 03             	test   $0x3,%dl
+  800b3c:	75 0a                	jne    800b48 <memmove+0x59>
+  800b3e:	c1 e9 02             	shr    $0x2,%ecx
+  800b41:	89 c7                	mov    %eax,%edi
+  800b43:	fc                   	cld
+  800b44:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b46:	eb 05                	jmp    800b4d <memmove+0x5e>
+  800b48:	89 c7                	mov    %eax,%edi
+  800b4a:	fc                   	cld
+  800b4b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800b4d:	5e                   	pop    %esi
+  800b4e:	5f                   	pop    %edi
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+
+00800b51 <memcpy>:
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	83 ec 0c             	sub    $0xc,%esp
+  800b57:	ff 75 10             	push   0x10(%ebp)
+  800b5a:	ff 75 0c             	push   0xc(%ebp)
+  800b5d:	ff 75 08             	push   0x8(%ebp)
+  800b60:	e8 8a ff ff ff       	call   800aef <memmove>
+  800b65:	c9                   	leave
+  800b66:	c3                   	ret
+
+00800b67 <memcmp>:
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	56                   	push   %esi
+  800b6b:	53                   	push   %ebx
+  800b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b72:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b75:	85 f6                	test   %esi,%esi
+  800b77:	74 29                	je     800ba2 <memcmp+0x3b>
+  800b79:	01 c6                	add    %eax,%esi
+  800b7b:	0f b6 08             	movzbl (%eax),%ecx
+  800b7e:	0f b6 1a             	movzbl (%edx),%ebx
+  800b81:	38 d9                	cmp    %bl,%cl
+  800b83:	75 11                	jne    800b96 <memcmp+0x2f>
+  800b85:	83 c0 01             	add    $0x1,%eax
+  800b88:	83 c2 01             	add    $0x1,%edx
+  800b8b:	39 c6                	cmp    %eax,%esi
+  800b8d:	75 ec                	jne    800b7b <memcmp+0x14>
+  800b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b94:	eb 08                	jmp    800b9e <memcmp+0x37>
+  800b96:	0f b6 c1             	movzbl %cl,%eax
+  800b99:	0f b6 db             	movzbl %bl,%ebx
+  800b9c:	29 d8                	sub    %ebx,%eax
+  800b9e:	5b                   	pop    %ebx
+  800b9f:	5e                   	pop    %esi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+  800ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba7:	eb f5                	jmp    800b9e <memcmp+0x37>
+
+00800ba9 <memfind>:
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	03 55 10             	add    0x10(%ebp),%edx
+  800bb7:	39 d0                	cmp    %edx,%eax
+  800bb9:	73 0d                	jae    800bc8 <memfind+0x1f>
+  800bbb:	38 08                	cmp    %cl,(%eax)
+  800bbd:	74 0d                	je     800bcc <memfind+0x23>
+  800bbf:	83 c0 01             	add    $0x1,%eax
+  800bc2:	39 c2                	cmp    %eax,%edx
+  800bc4:	75 f5                	jne    800bbb <memfind+0x12>
+  800bc6:	eb 06                	jmp    800bce <memfind+0x25>
+  800bc8:	89 c2                	mov    %eax,%edx
+  800bca:	eb 02                	jmp    800bce <memfind+0x25>
+  800bcc:	89 c2                	mov    %eax,%edx
+  800bce:	89 d0                	mov    %edx,%eax
+  800bd0:	5d                   	pop    %ebp
+  800bd1:	c3                   	ret
+
+00800bd2 <strtol>:
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	57                   	push   %edi
+  800bd6:	56                   	push   %esi
+  800bd7:	53                   	push   %ebx
+  800bd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bde:	0f b6 02             	movzbl (%edx),%eax
+  800be1:	3c 20                	cmp    $0x20,%al
+  800be3:	74 04                	je     800be9 <strtol+0x17>
+  800be5:	3c 09                	cmp    $0x9,%al
+  800be7:	75 0e                	jne    800bf7 <strtol+0x25>
+  800be9:	83 c2 01             	add    $0x1,%edx
+  800bec:	0f b6 02             	movzbl (%edx),%eax
+  800bef:	3c 20                	cmp    $0x20,%al
+  800bf1:	74 f6                	je     800be9 <strtol+0x17>
+  800bf3:	3c 09                	cmp    $0x9,%al
+  800bf5:	74 f2                	je     800be9 <strtol+0x17>
+  800bf7:	3c 2b                	cmp    $0x2b,%al
+  800bf9:	74 2a                	je     800c25 <strtol+0x53>
+  800bfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c00:	3c 2d                	cmp    $0x2d,%al
+  800c02:	74 2b                	je     800c2f <strtol+0x5d>
+  800c04:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c0a:	75 0f                	jne    800c1b <strtol+0x49>
+  800c0c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c0f:	74 28                	je     800c39 <strtol+0x67>
+  800c11:	85 db                	test   %ebx,%ebx
+  800c13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c18:	0f 44 d8             	cmove  %eax,%ebx
+  800c1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c20:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c23:	eb 46                	jmp    800c6b <strtol+0x99>
+  800c25:	83 c2 01             	add    $0x1,%edx
+  800c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c2d:	eb d5                	jmp    800c04 <strtol+0x32>
+  800c2f:	83 c2 01             	add    $0x1,%edx
+  800c32:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c37:	eb cb                	jmp    800c04 <strtol+0x32>
+  800c39:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c3d:	74 0e                	je     800c4d <strtol+0x7b>
+  800c3f:	85 db                	test   %ebx,%ebx
+  800c41:	75 d8                	jne    800c1b <strtol+0x49>
+  800c43:	83 c2 01             	add    $0x1,%edx
+  800c46:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c4b:	eb ce                	jmp    800c1b <strtol+0x49>
+  800c4d:	83 c2 02             	add    $0x2,%edx
+  800c50:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c55:	eb c4                	jmp    800c1b <strtol+0x49>
+  800c57:	0f be c0             	movsbl %al,%eax
+  800c5a:	83 e8 30             	sub    $0x30,%eax
+  800c5d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c60:	7d 3a                	jge    800c9c <strtol+0xca>
+  800c62:	83 c2 01             	add    $0x1,%edx
+  800c65:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c69:	01 c1                	add    %eax,%ecx
+  800c6b:	0f b6 02             	movzbl (%edx),%eax
+  800c6e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c71:	89 f3                	mov    %esi,%ebx
+  800c73:	80 fb 09             	cmp    $0x9,%bl
+  800c76:	76 df                	jbe    800c57 <strtol+0x85>
+  800c78:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c7b:	89 f3                	mov    %esi,%ebx
+  800c7d:	80 fb 19             	cmp    $0x19,%bl
+  800c80:	77 08                	ja     800c8a <strtol+0xb8>
+  800c82:	0f be c0             	movsbl %al,%eax
+  800c85:	83 e8 57             	sub    $0x57,%eax
+  800c88:	eb d3                	jmp    800c5d <strtol+0x8b>
+  800c8a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c8d:	89 f3                	mov    %esi,%ebx
+  800c8f:	80 fb 19             	cmp    $0x19,%bl
+  800c92:	77 08                	ja     800c9c <strtol+0xca>
+  800c94:	0f be c0             	movsbl %al,%eax
+  800c97:	83 e8 37             	sub    $0x37,%eax
+  800c9a:	eb c1                	jmp    800c5d <strtol+0x8b>
+  800c9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ca0:	74 05                	je     800ca7 <strtol+0xd5>
+  800ca2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ca5:	89 10                	mov    %edx,(%eax)
+  800ca7:	89 c8                	mov    %ecx,%eax
+  800ca9:	f7 d8                	neg    %eax
+  800cab:	85 ff                	test   %edi,%edi
+  800cad:	0f 45 c8             	cmovne %eax,%ecx
+  800cb0:	89 c8                	mov    %ecx,%eax
+  800cb2:	5b                   	pop    %ebx
+  800cb3:	5e                   	pop    %esi
+  800cb4:	5f                   	pop    %edi
+  800cb5:	5d                   	pop    %ebp
+  800cb6:	c3                   	ret
+
+00800cb7 <sys_cputs>:
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	57                   	push   %edi
+  800cbb:	56                   	push   %esi
+  800cbc:	53                   	push   %ebx
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc8:	89 c3                	mov    %eax,%ebx
+  800cca:	89 c7                	mov    %eax,%edi
+  800ccc:	89 c6                	mov    %eax,%esi
+  800cce:	cd 30                	int    $0x30
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5e                   	pop    %esi
+  800cd2:	5f                   	pop    %edi
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+
+00800cd5 <sys_cgetc>:
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  800cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ce5:	89 d1                	mov    %edx,%ecx
+  800ce7:	89 d3                	mov    %edx,%ebx
+  800ce9:	89 d7                	mov    %edx,%edi
+  800ceb:	89 d6                	mov    %edx,%esi
+  800ced:	cd 30                	int    $0x30
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+
+00800cf4 <sys_env_destroy>:
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+  800cfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d05:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d0a:	89 cb                	mov    %ecx,%ebx
+  800d0c:	89 cf                	mov    %ecx,%edi
+  800d0e:	89 ce                	mov    %ecx,%esi
+  800d10:	cd 30                	int    $0x30
+  800d12:	85 c0                	test   %eax,%eax
+  800d14:	7f 08                	jg     800d1e <sys_env_destroy+0x2a>
+  800d16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+  800d1e:	83 ec 0c             	sub    $0xc,%esp
+  800d21:	50                   	push   %eax
+  800d22:	6a 03                	push   $0x3
+  800d24:	68 ab 35 80 00       	push   $0x8035ab
+  800d29:	6a 24                	push   $0x24
+  800d2b:	68 c8 35 80 00       	push   $0x8035c8
+  800d30:	e8 38 f4 ff ff       	call   80016d <_panic>
+
+00800d35 <sys_getenvid>:
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	57                   	push   %edi
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d40:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d45:	89 d1                	mov    %edx,%ecx
+  800d47:	89 d3                	mov    %edx,%ebx
+  800d49:	89 d7                	mov    %edx,%edi
+  800d4b:	89 d6                	mov    %edx,%esi
+  800d4d:	cd 30                	int    $0x30
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5f                   	pop    %edi
+  800d52:	5d                   	pop    %ebp
+  800d53:	c3                   	ret
+
+00800d54 <sys_yield>:
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	57                   	push   %edi
+  800d58:	56                   	push   %esi
+  800d59:	53                   	push   %ebx
+  800d5a:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d61:	74 26                	je     800d89 <sys_yield+0x35>
+  800d63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d68:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d6d:	89 d1                	mov    %edx,%ecx
+  800d6f:	89 d3                	mov    %edx,%ebx
+  800d71:	89 d7                	mov    %edx,%edi
+  800d73:	6a 00                	push   $0x0
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	8d 35 80 0d 80 00    	lea    0x800d80,%esi
+  800d7e:	0f 34                	sysenter
+  800d80:	5d                   	pop    %ebp
+  800d81:	83 c4 04             	add    $0x4,%esp
+  800d84:	5b                   	pop    %ebx
+  800d85:	5e                   	pop    %esi
+  800d86:	5f                   	pop    %edi
+  800d87:	5d                   	pop    %ebp
+  800d88:	c3                   	ret
+  800d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d93:	89 d1                	mov    %edx,%ecx
+  800d95:	89 d3                	mov    %edx,%ebx
+  800d97:	89 d7                	mov    %edx,%edi
+  800d99:	89 d6                	mov    %edx,%esi
+  800d9b:	cd 30                	int    $0x30
+  800d9d:	eb e5                	jmp    800d84 <sys_yield+0x30>
+
+00800d9f <sys_page_alloc>:
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  800da8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbb:	89 f7                	mov    %esi,%edi
+  800dbd:	cd 30                	int    $0x30
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	7f 08                	jg     800dcb <sys_page_alloc+0x2c>
+  800dc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+  800dce:	50                   	push   %eax
+  800dcf:	6a 04                	push   $0x4
+  800dd1:	68 ab 35 80 00       	push   $0x8035ab
+  800dd6:	6a 24                	push   $0x24
+  800dd8:	68 c8 35 80 00       	push   $0x8035c8
+  800ddd:	e8 8b f3 ff ff       	call   80016d <_panic>
+
+00800de2 <sys_page_map>:
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+  800deb:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800df2:	74 33                	je     800e27 <sys_page_map+0x45>
+  800df4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfa:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e02:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e05:	ff 75 18             	push   0x18(%ebp)
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	8d 35 13 0e 80 00    	lea    0x800e13,%esi
+  800e11:	0f 34                	sysenter
+  800e13:	5d                   	pop    %ebp
+  800e14:	83 c4 04             	add    $0x4,%esp
+  800e17:	89 c2                	mov    %eax,%edx
+  800e19:	85 c0                	test   %eax,%eax
+  800e1b:	7f 3d                	jg     800e5a <sys_page_map+0x78>
+  800e1d:	89 d0                	mov    %edx,%eax
+  800e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+  800e27:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e35:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e38:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e3b:	cd 30                	int    $0x30
+  800e3d:	89 c2                	mov    %eax,%edx
+  800e3f:	85 c0                	test   %eax,%eax
+  800e41:	7e da                	jle    800e1d <sys_page_map+0x3b>
+  800e43:	83 ec 0c             	sub    $0xc,%esp
+  800e46:	50                   	push   %eax
+  800e47:	6a 05                	push   $0x5
+  800e49:	68 ab 35 80 00       	push   $0x8035ab
+  800e4e:	6a 24                	push   $0x24
+  800e50:	68 c8 35 80 00       	push   $0x8035c8
+  800e55:	e8 13 f3 ff ff       	call   80016d <_panic>
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	50                   	push   %eax
+  800e5e:	6a 05                	push   $0x5
+  800e60:	68 ab 35 80 00       	push   $0x8035ab
+  800e65:	6a 48                	push   $0x48
+  800e67:	68 c8 35 80 00       	push   $0x8035c8
+  800e6c:	e8 fc f2 ff ff       	call   80016d <_panic>
+
+00800e71 <sys_page_unmap>:
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+  800e7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e85:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e8a:	89 df                	mov    %ebx,%edi
+  800e8c:	89 de                	mov    %ebx,%esi
+  800e8e:	cd 30                	int    $0x30
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	7f 08                	jg     800e9c <sys_page_unmap+0x2b>
+  800e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+  800e9f:	50                   	push   %eax
+  800ea0:	6a 06                	push   $0x6
+  800ea2:	68 ab 35 80 00       	push   $0x8035ab
+  800ea7:	6a 24                	push   $0x24
+  800ea9:	68 c8 35 80 00       	push   $0x8035c8
+  800eae:	e8 ba f2 ff ff       	call   80016d <_panic>
+
+00800eb3 <sys_fork>:
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+  800eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebe:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800ec3:	89 d1                	mov    %edx,%ecx
+  800ec5:	89 d3                	mov    %edx,%ebx
+  800ec7:	89 d7                	mov    %edx,%edi
+  800ec9:	89 d6                	mov    %edx,%esi
+  800ecb:	cd 30                	int    $0x30
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+
+00800ed2 <sys_env_set_status>:
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	57                   	push   %edi
+  800ed6:	56                   	push   %esi
+  800ed7:	53                   	push   %ebx
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eeb:	89 df                	mov    %ebx,%edi
+  800eed:	89 de                	mov    %ebx,%esi
+  800eef:	cd 30                	int    $0x30
+  800ef1:	85 c0                	test   %eax,%eax
+  800ef3:	7f 08                	jg     800efd <sys_env_set_status+0x2b>
+  800ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	50                   	push   %eax
+  800f01:	6a 08                	push   $0x8
+  800f03:	68 ab 35 80 00       	push   $0x8035ab
+  800f08:	6a 24                	push   $0x24
+  800f0a:	68 c8 35 80 00       	push   $0x8035c8
+  800f0f:	e8 59 f2 ff ff       	call   80016d <_panic>
+
+00800f14 <sys_env_set_trapframe>:
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	56                   	push   %esi
+  800f19:	53                   	push   %ebx
+  800f1a:	83 ec 0c             	sub    $0xc,%esp
+  800f1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f28:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f2d:	89 df                	mov    %ebx,%edi
+  800f2f:	89 de                	mov    %ebx,%esi
+  800f31:	cd 30                	int    $0x30
+  800f33:	85 c0                	test   %eax,%eax
+  800f35:	7f 08                	jg     800f3f <sys_env_set_trapframe+0x2b>
+  800f37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3a:	5b                   	pop    %ebx
+  800f3b:	5e                   	pop    %esi
+  800f3c:	5f                   	pop    %edi
+  800f3d:	5d                   	pop    %ebp
+  800f3e:	c3                   	ret
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  800f42:	50                   	push   %eax
+  800f43:	6a 09                	push   $0x9
+  800f45:	68 ab 35 80 00       	push   $0x8035ab
+  800f4a:	6a 24                	push   $0x24
+  800f4c:	68 c8 35 80 00       	push   $0x8035c8
+  800f51:	e8 17 f2 ff ff       	call   80016d <_panic>
+
+00800f56 <sys_env_set_cow>:
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+  800f5c:	83 ec 0c             	sub    $0xc,%esp
+  800f5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6a:	b8 20 00 00 00       	mov    $0x20,%eax
+  800f6f:	89 df                	mov    %ebx,%edi
+  800f71:	89 de                	mov    %ebx,%esi
+  800f73:	cd 30                	int    $0x30
+  800f75:	85 c0                	test   %eax,%eax
+  800f77:	7f 08                	jg     800f81 <sys_env_set_cow+0x2b>
+  800f79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+  800f84:	50                   	push   %eax
+  800f85:	6a 20                	push   $0x20
+  800f87:	68 ab 35 80 00       	push   $0x8035ab
+  800f8c:	6a 24                	push   $0x24
+  800f8e:	68 c8 35 80 00       	push   $0x8035c8
+  800f93:	e8 d5 f1 ff ff       	call   80016d <_panic>
+
+00800f98 <sys_env_service>:
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  800f9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa6:	b8 21 00 00 00       	mov    $0x21,%eax
+  800fab:	89 cb                	mov    %ecx,%ebx
+  800fad:	89 cf                	mov    %ecx,%edi
+  800faf:	89 ce                	mov    %ecx,%esi
+  800fb1:	cd 30                	int    $0x30
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+
+00800fb8 <sys_env_set_pgfault_upcall>:
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  800fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd1:	89 df                	mov    %ebx,%edi
+  800fd3:	89 de                	mov    %ebx,%esi
+  800fd5:	cd 30                	int    $0x30
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	7f 08                	jg     800fe3 <sys_env_set_pgfault_upcall+0x2b>
+  800fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 0a                	push   $0xa
+  800fe9:	68 ab 35 80 00       	push   $0x8035ab
+  800fee:	6a 24                	push   $0x24
+  800ff0:	68 c8 35 80 00       	push   $0x8035c8
+  800ff5:	e8 73 f1 ff ff       	call   80016d <_panic>
+
+00800ffa <sys_ipc_try_send>:
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+  801000:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801007:	74 27                	je     801030 <sys_ipc_try_send+0x36>
+  801009:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801014:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801017:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101a:	6a 00                	push   $0x0
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	8d 35 27 10 80 00    	lea    0x801027,%esi
+  801025:	0f 34                	sysenter
+  801027:	5d                   	pop    %ebp
+  801028:	83 c4 04             	add    $0x4,%esp
+  80102b:	5b                   	pop    %ebx
+  80102c:	5e                   	pop    %esi
+  80102d:	5f                   	pop    %edi
+  80102e:	5d                   	pop    %ebp
+  80102f:	c3                   	ret
+  801030:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801035:	be 00 00 00 00       	mov    $0x0,%esi
+  80103a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801046:	cd 30                	int    $0x30
+  801048:	eb e1                	jmp    80102b <sys_ipc_try_send+0x31>
+
+0080104a <sys_ipc_recv>:
+  80104a:	55                   	push   %ebp
+  80104b:	89 e5                	mov    %esp,%ebp
+  80104d:	57                   	push   %edi
+  80104e:	56                   	push   %esi
+  80104f:	53                   	push   %ebx
+  801050:	83 ec 0c             	sub    $0xc,%esp
+  801053:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80105a:	74 32                	je     80108e <sys_ipc_recv+0x44>
+  80105c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801064:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801069:	89 cb                	mov    %ecx,%ebx
+  80106b:	89 cf                	mov    %ecx,%edi
+  80106d:	6a 00                	push   $0x0
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	8d 35 7a 10 80 00    	lea    0x80107a,%esi
+  801078:	0f 34                	sysenter
+  80107a:	5d                   	pop    %ebp
+  80107b:	83 c4 04             	add    $0x4,%esp
+  80107e:	89 c2                	mov    %eax,%edx
+  801080:	85 c0                	test   %eax,%eax
+  801082:	7f 3c                	jg     8010c0 <sys_ipc_recv+0x76>
+  801084:	89 d0                	mov    %edx,%eax
+  801086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+  80108e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801093:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	89 cb                	mov    %ecx,%ebx
+  80109d:	89 cf                	mov    %ecx,%edi
+  80109f:	89 ce                	mov    %ecx,%esi
+  8010a1:	cd 30                	int    $0x30
+  8010a3:	89 c2                	mov    %eax,%edx
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	7e db                	jle    801084 <sys_ipc_recv+0x3a>
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 0d                	push   $0xd
+  8010af:	68 ab 35 80 00       	push   $0x8035ab
+  8010b4:	6a 24                	push   $0x24
+  8010b6:	68 c8 35 80 00       	push   $0x8035c8
+  8010bb:	e8 ad f0 ff ff       	call   80016d <_panic>
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+  8010c3:	50                   	push   %eax
+  8010c4:	6a 0d                	push   $0xd
+  8010c6:	68 ab 35 80 00       	push   $0x8035ab
+  8010cb:	6a 48                	push   $0x48
+  8010cd:	68 c8 35 80 00       	push   $0x8035c8
+  8010d2:	e8 96 f0 ff ff       	call   80016d <_panic>
+
+008010d7 <sys_ipc_send>:
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+  8010dd:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010e4:	74 27                	je     80110d <sys_ipc_send+0x36>
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f7:	6a 00                	push   $0x0
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+  801104:	5d                   	pop    %ebp
+  801105:	83 c4 04             	add    $0x4,%esp
+  801108:	5b                   	pop    %ebx
+  801109:	5e                   	pop    %esi
+  80110a:	5f                   	pop    %edi
+  80110b:	5d                   	pop    %ebp
+  80110c:	c3                   	ret
+  80110d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801120:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801123:	cd 30                	int    $0x30
+  801125:	eb e1                	jmp    801108 <sys_ipc_send+0x31>
+
+00801127 <sys_ipc_call>:
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	57                   	push   %edi
+  80112b:	56                   	push   %esi
+  80112c:	53                   	push   %ebx
+  80112d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801130:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801133:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801138:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801141:	cd 30                	int    $0x30
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_ipc_reply_recv>:
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	b8 10 00 00 00       	mov    $0x10,%eax
+  801159:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80115f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801162:	cd 30                	int    $0x30
+  801164:	5b                   	pop    %ebx
+  801165:	5e                   	pop    %esi
+  801166:	5f                   	pop    %edi
+  801167:	5d                   	pop    %ebp
+  801168:	c3                   	ret
+
+00801169 <sys_time_msec>:
+  801169:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	75 06                	jne    801178 <sys_time_msec+0xf>
+  801172:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801177:	c3                   	ret
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+  801181:	0f 31                	rdtsc
+  801183:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801189:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80118f:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801195:	29 c8                	sub    %ecx,%eax
+  801197:	19 da                	sbb    %ebx,%edx
+  801199:	bf 00 00 00 00       	mov    $0x0,%edi
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	52                   	push   %edx
+  8011a1:	50                   	push   %eax
+  8011a2:	e8 4b 1f 00 00       	call   8030f2 <__udivdi3>
+  8011a7:	83 c4 10             	add    $0x10,%esp
+  8011aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+
+008011b2 <sys_env_swap>:
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+  8011b8:	83 ec 0c             	sub    $0xc,%esp
+  8011bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011c8:	89 cb                	mov    %ecx,%ebx
+  8011ca:	89 cf                	mov    %ecx,%edi
+  8011cc:	89 ce                	mov    %ecx,%esi
+  8011ce:	cd 30                	int    $0x30
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	7f 08                	jg     8011dc <sys_env_swap+0x2a>
+  8011d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+  8011dc:	83 ec 0c             	sub    $0xc,%esp
+  8011df:	50                   	push   %eax
+  8011e0:	6a 12                	push   $0x12
+  8011e2:	68 ab 35 80 00       	push   $0x8035ab
+  8011e7:	6a 24                	push   $0x24
+  8011e9:	68 c8 35 80 00       	push   $0x8035c8
+  8011ee:	e8 7a ef ff ff       	call   80016d <_panic>
+
+008011f3 <sys_net_try_send>:
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	57                   	push   %edi
+  8011f7:	56                   	push   %esi
+  8011f8:	53                   	push   %ebx
+  8011f9:	83 ec 0c             	sub    $0xc,%esp
+  8011fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801201:	8b 55 08             	mov    0x8(%ebp),%edx
+  801204:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801207:	b8 13 00 00 00       	mov    $0x13,%eax
+  80120c:	89 df                	mov    %ebx,%edi
+  80120e:	89 de                	mov    %ebx,%esi
+  801210:	cd 30                	int    $0x30
+  801212:	85 c0                	test   %eax,%eax
+  801214:	7f 08                	jg     80121e <sys_net_try_send+0x2b>
+  801216:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801219:	5b                   	pop    %ebx
+  80121a:	5e                   	pop    %esi
+  80121b:	5f                   	pop    %edi
+  80121c:	5d                   	pop    %ebp
+  80121d:	c3                   	ret
+  80121e:	83 ec 0c             	sub    $0xc,%esp
+  801221:	50                   	push   %eax
+  801222:	6a 13                	push   $0x13
+  801224:	68 ab 35 80 00       	push   $0x8035ab
+  801229:	6a 24                	push   $0x24
+  80122b:	68 c8 35 80 00       	push   $0x8035c8
+  801230:	e8 38 ef ff ff       	call   80016d <_panic>
+
+00801235 <sys_net_try_receive>:
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+  80123b:	83 ec 0c             	sub    $0xc,%esp
+  80123e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+  801246:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801249:	b8 14 00 00 00       	mov    $0x14,%eax
+  80124e:	89 df                	mov    %ebx,%edi
+  801250:	89 de                	mov    %ebx,%esi
+  801252:	cd 30                	int    $0x30
+  801254:	85 c0                	test   %eax,%eax
+  801256:	7f 08                	jg     801260 <sys_net_try_receive+0x2b>
+  801258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125b:	5b                   	pop    %ebx
+  80125c:	5e                   	pop    %esi
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+  801260:	83 ec 0c             	sub    $0xc,%esp
+  801263:	50                   	push   %eax
+  801264:	6a 14                	push   $0x14
+  801266:	68 ab 35 80 00       	push   $0x8035ab
+  80126b:	6a 24                	push   $0x24
+  80126d:	68 c8 35 80 00       	push   $0x8035c8
+  801272:	e8 f6 ee ff ff       	call   80016d <_panic>
+
+00801277 <sys_net_recv_page>:
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	57                   	push   %edi
+  80127b:	56                   	push   %esi
+  80127c:	53                   	push   %ebx
+  80127d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801282:	8b 55 08             	mov    0x8(%ebp),%edx
+  801285:	b8 27 00 00 00       	mov    $0x27,%eax
+  80128a:	89 cb                	mov    %ecx,%ebx
+  80128c:	89 cf                	mov    %ecx,%edi
+  80128e:	89 ce                	mov    %ecx,%esi
+  801290:	cd 30                	int    $0x30
+  801292:	5b                   	pop    %ebx
+  801293:	5e                   	pop    %esi
+  801294:	5f                   	pop    %edi
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+
+00801297 <sys_net_wait>:
+  801297:	55                   	push   %ebp
+  801298:	89 e5                	mov    %esp,%ebp
+  80129a:	57                   	push   %edi
+  80129b:	56                   	push   %esi
+  80129c:	53                   	push   %ebx
+  80129d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a2:	b8 26 00 00 00       	mov    $0x26,%eax
+  8012a7:	89 d1                	mov    %edx,%ecx
+  8012a9:	89 d3                	mov    %edx,%ebx
+  8012ab:	89 d7                	mov    %edx,%edi
+  8012ad:	89 d6                	mov    %edx,%esi
+  8012af:	cd 30                	int    $0x30
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5f                   	pop    %edi
+  8012b4:	5d                   	pop    %ebp
+  8012b5:	c3                   	ret
+
+008012b6 <sys_get_mac>:
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	57                   	push   %edi
+  8012ba:	56                   	push   %esi
+  8012bb:	53                   	push   %ebx
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+  8012bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ca:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012cf:	89 df                	mov    %ebx,%edi
+  8012d1:	89 de                	mov    %ebx,%esi
+  8012d3:	cd 30                	int    $0x30
+  8012d5:	85 c0                	test   %eax,%eax
+  8012d7:	7f 08                	jg     8012e1 <sys_get_mac+0x2b>
+  8012d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012dc:	5b                   	pop    %ebx
+  8012dd:	5e                   	pop    %esi
+  8012de:	5f                   	pop    %edi
+  8012df:	5d                   	pop    %ebp
+  8012e0:	c3                   	ret
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	50                   	push   %eax
+  8012e5:	6a 15                	push   $0x15
+  8012e7:	68 ab 35 80 00       	push   $0x8035ab
+  8012ec:	6a 24                	push   $0x24
+  8012ee:	68 c8 35 80 00       	push   $0x8035c8
+  8012f3:	e8 75 ee ff ff       	call   80016d <_panic>
+
+008012f8 <sys_env_lease>:
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+  8012fe:	83 ec 0c             	sub    $0xc,%esp
+  801301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801306:	8b 55 08             	mov    0x8(%ebp),%edx
+  801309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801311:	89 df                	mov    %ebx,%edi
+  801313:	89 de                	mov    %ebx,%esi
+  801315:	cd 30                	int    $0x30
+  801317:	85 c0                	test   %eax,%eax
+  801319:	7f 08                	jg     801323 <sys_env_lease+0x2b>
+  80131b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131e:	5b                   	pop    %ebx
+  80131f:	5e                   	pop    %esi
+  801320:	5f                   	pop    %edi
+  801321:	5d                   	pop    %ebp
+  801322:	c3                   	ret
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	50                   	push   %eax
+  801327:	6a 16                	push   $0x16
+  801329:	68 ab 35 80 00       	push   $0x8035ab
+  80132e:	6a 24                	push   $0x24
+  801330:	68 c8 35 80 00       	push   $0x8035c8
+  801335:	e8 33 ee ff ff       	call   80016d <_panic>
+
+0080133a <sys_copy_mem>:
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 0c             	sub    $0xc,%esp
+  801343:	8b 55 08             	mov    0x8(%ebp),%edx
+  801346:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801349:	b8 17 00 00 00       	mov    $0x17,%eax
+  80134e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801351:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801354:	8b 75 18             	mov    0x18(%ebp),%esi
+  801357:	cd 30                	int    $0x30
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	7f 08                	jg     801365 <sys_copy_mem+0x2b>
+  80135d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801360:	5b                   	pop    %ebx
+  801361:	5e                   	pop    %esi
+  801362:	5f                   	pop    %edi
+  801363:	5d                   	pop    %ebp
+  801364:	c3                   	ret
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	50                   	push   %eax
+  801369:	6a 17                	push   $0x17
+  80136b:	68 ab 35 80 00       	push   $0x8035ab
+  801370:	6a 24                	push   $0x24
+  801372:	68 c8 35 80 00       	push   $0x8035c8
+  801377:	e8 f1 ed ff ff       	call   80016d <_panic>
+
+0080137c <sys_get_perms>:
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	57                   	push   %edi
+  801380:	56                   	push   %esi
+  801381:	53                   	push   %ebx
+  801382:	83 ec 0c             	sub    $0xc,%esp
+  801385:	be 00 00 00 00       	mov    $0x0,%esi
+  80138a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801390:	b8 18 00 00 00       	mov    $0x18,%eax
+  801395:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801398:	89 f7                	mov    %esi,%edi
+  80139a:	cd 30                	int    $0x30
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	7f 08                	jg     8013a8 <sys_get_perms+0x2c>
+  8013a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5f                   	pop    %edi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	50                   	push   %eax
+  8013ac:	6a 18                	push   $0x18
+  8013ae:	68 ab 35 80 00       	push   $0x8035ab
+  8013b3:	6a 24                	push   $0x24
+  8013b5:	68 c8 35 80 00       	push   $0x8035c8
+  8013ba:	e8 ae ed ff ff       	call   80016d <_panic>
+
+008013bf <sys_env_unsuspend>:
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	57                   	push   %edi
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  8013c5:	83 ec 0c             	sub    $0xc,%esp
+  8013c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d3:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013db:	89 f7                	mov    %esi,%edi
+  8013dd:	cd 30                	int    $0x30
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	7f 08                	jg     8013eb <sys_env_unsuspend+0x2c>
+  8013e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e6:	5b                   	pop    %ebx
+  8013e7:	5e                   	pop    %esi
+  8013e8:	5f                   	pop    %edi
+  8013e9:	5d                   	pop    %ebp
+  8013ea:	c3                   	ret
+  8013eb:	83 ec 0c             	sub    $0xc,%esp
+  8013ee:	50                   	push   %eax
+  8013ef:	6a 19                	push   $0x19
+  8013f1:	68 ab 35 80 00       	push   $0x8035ab
+  8013f6:	6a 24                	push   $0x24
+  8013f8:	68 c8 35 80 00       	push   $0x8035c8
+  8013fd:	e8 6b ed ff ff       	call   80016d <_panic>
+
+00801402 <sys_migrate>:
+  801402:	55                   	push   %ebp
+  801403:	89 e5                	mov    %esp,%ebp
+  801405:	57                   	push   %edi
+  801406:	56                   	push   %esi
+  801407:	53                   	push   %ebx
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	ba 00 80 80 00       	mov    $0x808000,%edx
+  801410:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801416:	76 11                	jbe    801429 <sys_migrate+0x27>
+  801418:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80141d:	0f b6 08             	movzbl (%eax),%ecx
+  801420:	05 00 10 00 00       	add    $0x1000,%eax
+  801425:	39 d0                	cmp    %edx,%eax
+  801427:	72 f4                	jb     80141d <sys_migrate+0x1b>
+  801429:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801436:	89 cb                	mov    %ecx,%ebx
+  801438:	89 cf                	mov    %ecx,%edi
+  80143a:	89 ce                	mov    %ecx,%esi
+  80143c:	cd 30                	int    $0x30
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	7f 08                	jg     80144a <sys_migrate+0x48>
+  801442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801445:	5b                   	pop    %ebx
+  801446:	5e                   	pop    %esi
+  801447:	5f                   	pop    %edi
+  801448:	5d                   	pop    %ebp
+  801449:	c3                   	ret
+  80144a:	83 ec 0c             	sub    $0xc,%esp
+  80144d:	50                   	push   %eax
+  80144e:	6a 1a                	push   $0x1a
+  801450:	68 ab 35 80 00       	push   $0x8035ab
+  801455:	6a 24                	push   $0x24
+  801457:	68 c8 35 80 00       	push   $0x8035c8
+  80145c:	e8 0c ed ff ff       	call   80016d <_panic>
+
+00801461 <sys_lease_complete>:
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	57                   	push   %edi
+  801465:	56                   	push   %esi
+  801466:	53                   	push   %ebx
+  801467:	83 ec 0c             	sub    $0xc,%esp
+  80146a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801474:	89 d1                	mov    %edx,%ecx
+  801476:	89 d3                	mov    %edx,%ebx
+  801478:	89 d7                	mov    %edx,%edi
+  80147a:	89 d6                	mov    %edx,%esi
+  80147c:	cd 30                	int    $0x30
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	7f 08                	jg     80148a <sys_lease_complete+0x29>
+  801482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+  80148a:	83 ec 0c             	sub    $0xc,%esp
+  80148d:	50                   	push   %eax
+  80148e:	6a 1b                	push   $0x1b
+  801490:	68 ab 35 80 00       	push   $0x8035ab
+  801495:	6a 24                	push   $0x24
+  801497:	68 c8 35 80 00       	push   $0x8035c8
+  80149c:	e8 cc ec ff ff       	call   80016d <_panic>
+
+008014a1 <sys_env_set_thisenv>:
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	57                   	push   %edi
+  8014a5:	56                   	push   %esi
+  8014a6:	53                   	push   %ebx
+  8014a7:	83 ec 0c             	sub    $0xc,%esp
+  8014aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014ba:	89 df                	mov    %ebx,%edi
+  8014bc:	89 de                	mov    %ebx,%esi
+  8014be:	cd 30                	int    $0x30
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	7f 08                	jg     8014cc <sys_env_set_thisenv+0x2b>
+  8014c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c7:	5b                   	pop    %ebx
+  8014c8:	5e                   	pop    %esi
+  8014c9:	5f                   	pop    %edi
+  8014ca:	5d                   	pop    %ebp
+  8014cb:	c3                   	ret
+  8014cc:	83 ec 0c             	sub    $0xc,%esp
+  8014cf:	50                   	push   %eax
+  8014d0:	6a 1c                	push   $0x1c
+  8014d2:	68 ab 35 80 00       	push   $0x8035ab
+  8014d7:	6a 24                	push   $0x24
+  8014d9:	68 c8 35 80 00       	push   $0x8035c8
+  8014de:	e8 8a ec ff ff       	call   80016d <_panic>
+
+008014e3 <sys_env_set_sched>:
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	57                   	push   %edi
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 ec 0c             	sub    $0xc,%esp
+  8014ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ff:	89 f7                	mov    %esi,%edi
+  801501:	cd 30                	int    $0x30
+  801503:	85 c0                	test   %eax,%eax
+  801505:	7f 08                	jg     80150f <sys_env_set_sched+0x2c>
+  801507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150a:	5b                   	pop    %ebx
+  80150b:	5e                   	pop    %esi
+  80150c:	5f                   	pop    %edi
+  80150d:	5d                   	pop    %ebp
+  80150e:	c3                   	ret
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	50                   	push   %eax
+  801513:	6a 1d                	push   $0x1d
+  801515:	68 ab 35 80 00       	push   $0x8035ab
+  80151a:	6a 24                	push   $0x24
+  80151c:	68 c8 35 80 00       	push   $0x8035c8
+  801521:	e8 47 ec ff ff       	call   80016d <_panic>
+
+00801526 <sys_batch>:
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+  801529:	57                   	push   %edi
+  80152a:	56                   	push   %esi
+  80152b:	53                   	push   %ebx
+  80152c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801531:	8b 55 08             	mov    0x8(%ebp),%edx
+  801534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801537:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80153c:	89 df                	mov    %ebx,%edi
+  80153e:	89 de                	mov    %ebx,%esi
+  801540:	cd 30                	int    $0x30
+  801542:	5b                   	pop    %ebx
+  801543:	5e                   	pop    %esi
+  801544:	5f                   	pop    %edi
+  801545:	5d                   	pop    %ebp
+  801546:	c3                   	ret
+
+00801547 <sys_env_stats>:
+  801547:	55                   	push   %ebp
+  801548:	89 e5                	mov    %esp,%ebp
+  80154a:	57                   	push   %edi
+  80154b:	56                   	push   %esi
+  80154c:	53                   	push   %ebx
+  80154d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801552:	8b 55 08             	mov    0x8(%ebp),%edx
+  801555:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801558:	b8 23 00 00 00       	mov    $0x23,%eax
+  80155d:	89 df                	mov    %ebx,%edi
+  80155f:	89 de                	mov    %ebx,%esi
+  801561:	cd 30                	int    $0x30
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5f                   	pop    %edi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+
+00801568 <sys_trace>:
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	57                   	push   %edi
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801573:	8b 55 08             	mov    0x8(%ebp),%edx
+  801576:	b8 24 00 00 00       	mov    $0x24,%eax
+  80157b:	89 cb                	mov    %ecx,%ebx
+  80157d:	89 cf                	mov    %ecx,%edi
+  80157f:	89 ce                	mov    %ecx,%esi
+  801581:	cd 30                	int    $0x30
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+
+00801588 <sys_env_set_pager>:
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	57                   	push   %edi
+  80158c:	56                   	push   %esi
+  80158d:	53                   	push   %ebx
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	be 00 00 00 00       	mov    $0x0,%esi
+  801596:	8b 55 08             	mov    0x8(%ebp),%edx
+  801599:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159c:	b8 25 00 00 00       	mov    $0x25,%eax
+  8015a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a4:	89 f7                	mov    %esi,%edi
+  8015a6:	cd 30                	int    $0x30
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	7f 08                	jg     8015b4 <sys_env_set_pager+0x2c>
+  8015ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+  8015b4:	83 ec 0c             	sub    $0xc,%esp
+  8015b7:	50                   	push   %eax
+  8015b8:	6a 25                	push   $0x25
+  8015ba:	68 ab 35 80 00       	push   $0x8035ab
+  8015bf:	6a 24                	push   $0x24
+  8015c1:	68 c8 35 80 00       	push   $0x8035c8
+  8015c6:	e8 a2 eb ff ff       	call   80016d <_panic>
+
+008015cb <sys_pager_retire>:
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d9:	b8 28 00 00 00       	mov    $0x28,%eax
+  8015de:	89 cb                	mov    %ecx,%ebx
+  8015e0:	89 cf                	mov    %ecx,%edi
+  8015e2:	89 ce                	mov    %ecx,%esi
+  8015e4:	cd 30                	int    $0x30
+  8015e6:	5b                   	pop    %ebx
+  8015e7:	5e                   	pop    %esi
+  8015e8:	5f                   	pop    %edi
+  8015e9:	5d                   	pop    %ebp
+  8015ea:	c3                   	ret
+
+008015eb <sys_prof>:
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+  8015f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fc:	b8 22 00 00 00       	mov    $0x22,%eax
+  801601:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801604:	89 f7                	mov    %esi,%edi
+  801606:	cd 30                	int    $0x30
+  801608:	5b                   	pop    %ebx
+  801609:	5e                   	pop    %esi
+  80160a:	5f                   	pop    %edi
+  80160b:	5d                   	pop    %ebp
+  80160c:	c3                   	ret
+
+0080160d <fd2num>:
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	8b 45 08             	mov    0x8(%ebp),%eax
+  801613:	05 00 00 00 30       	add    $0x30000000,%eax
+  801618:	c1 e8 0c             	shr    $0xc,%eax
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+
+0080161d <fd2data>:
+  80161d:	55                   	push   %ebp
+  80161e:	89 e5                	mov    %esp,%ebp
+  801620:	8b 45 08             	mov    0x8(%ebp),%eax
+  801623:	05 00 00 00 30       	add    $0x30000000,%eax
+  801628:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80162d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801632:	5d                   	pop    %ebp
+  801633:	c3                   	ret
+
+00801634 <fd_alloc>:
+  801634:	55                   	push   %ebp
+  801635:	89 e5                	mov    %esp,%ebp
+  801637:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80163c:	89 c2                	mov    %eax,%edx
+  80163e:	c1 ea 16             	shr    $0x16,%edx
+  801641:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801648:	f6 c2 01             	test   $0x1,%dl
+  80164b:	74 29                	je     801676 <fd_alloc+0x42>
+  80164d:	89 c2                	mov    %eax,%edx
+  80164f:	c1 ea 0c             	shr    $0xc,%edx
+  801652:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801659:	f6 c2 01             	test   $0x1,%dl
+  80165c:	74 18                	je     801676 <fd_alloc+0x42>
+  80165e:	05 00 10 00 00       	add    $0x1000,%eax
+  801663:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801668:	75 d2                	jne    80163c <fd_alloc+0x8>
+  80166a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801674:	eb 05                	jmp    80167b <fd_alloc+0x47>
+  801676:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80167b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167e:	89 02                	mov    %eax,(%edx)
+  801680:	89 c8                	mov    %ecx,%eax
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+
+00801684 <fd_lookup>:
+  801684:	55                   	push   %ebp
+  801685:	89 e5                	mov    %esp,%ebp
+  801687:	8b 45 08             	mov    0x8(%ebp),%eax
+  80168a:	83 f8 1f             	cmp    $0x1f,%eax
+  80168d:	77 30                	ja     8016bf <fd_lookup+0x3b>
+  80168f:	c1 e0 0c             	shl    $0xc,%eax
+  801692:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801697:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80169d:	f6 c2 01             	test   $0x1,%dl
+  8016a0:	74 24                	je     8016c6 <fd_lookup+0x42>
+  8016a2:	89 c2                	mov    %eax,%edx
+  8016a4:	c1 ea 0c             	shr    $0xc,%edx
+  8016a7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016ae:	f6 c2 01             	test   $0x1,%dl
+  8016b1:	74 1a                	je     8016cd <fd_lookup+0x49>
+  8016b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016b6:	89 02                	mov    %eax,(%edx)
+  8016b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bd:	5d                   	pop    %ebp
+  8016be:	c3                   	ret
+  8016bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c4:	eb f7                	jmp    8016bd <fd_lookup+0x39>
+  8016c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016cb:	eb f0                	jmp    8016bd <fd_lookup+0x39>
+  8016cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d2:	eb e9                	jmp    8016bd <fd_lookup+0x39>
+
+008016d4 <dev_lookup>:
+  8016d4:	55                   	push   %ebp
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	53                   	push   %ebx
+  8016d8:	83 ec 04             	sub    $0x4,%esp
+  8016db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e3:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8016e8:	39 13                	cmp    %edx,(%ebx)
+  8016ea:	74 37                	je     801723 <dev_lookup+0x4f>
+  8016ec:	83 c0 01             	add    $0x1,%eax
+  8016ef:	8b 1c 85 54 36 80 00 	mov    0x803654(,%eax,4),%ebx
+  8016f6:	85 db                	test   %ebx,%ebx
+  8016f8:	75 ee                	jne    8016e8 <dev_lookup+0x14>
+  8016fa:	a1 10 50 80 00       	mov    0x805010,%eax
+  8016ff:	8b 40 48             	mov    0x48(%eax),%eax
+  801702:	83 ec 04             	sub    $0x4,%esp
+  801705:	52                   	push   %edx
+  801706:	50                   	push   %eax
+  801707:	68 d8 35 80 00       	push   $0x8035d8
+  80170c:	e8 37 eb ff ff       	call   800248 <cprintf>
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801719:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171c:	89 1a                	mov    %ebx,(%edx)
+  80171e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801721:	c9                   	leave
+  801722:	c3                   	ret
+  801723:	b8 00 00 00 00       	mov    $0x0,%eax
+  801728:	eb ef                	jmp    801719 <dev_lookup+0x45>
+
+0080172a <fd_close>:
+  80172a:	55                   	push   %ebp
+  80172b:	89 e5                	mov    %esp,%ebp
+  80172d:	57                   	push   %edi
+  80172e:	56                   	push   %esi
+  80172f:	53                   	push   %ebx
+  801730:	83 ec 24             	sub    $0x24,%esp
+  801733:	8b 75 08             	mov    0x8(%ebp),%esi
+  801736:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801739:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80173c:	50                   	push   %eax
+  80173d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801743:	c1 e8 0c             	shr    $0xc,%eax
+  801746:	50                   	push   %eax
+  801747:	e8 38 ff ff ff       	call   801684 <fd_lookup>
+  80174c:	89 c3                	mov    %eax,%ebx
+  80174e:	83 c4 10             	add    $0x10,%esp
+  801751:	85 c0                	test   %eax,%eax
+  801753:	78 05                	js     80175a <fd_close+0x30>
+  801755:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801758:	74 0f                	je     801769 <fd_close+0x3f>
+  80175a:	85 ff                	test   %edi,%edi
+  80175c:	0f 44 df             	cmove  %edi,%ebx
+  80175f:	89 d8                	mov    %ebx,%eax
+  801761:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801764:	5b                   	pop    %ebx
+  801765:	5e                   	pop    %esi
+  801766:	5f                   	pop    %edi
+  801767:	5d                   	pop    %ebp
+  801768:	c3                   	ret
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80176f:	50                   	push   %eax
+  801770:	ff 36                	push   (%esi)
+  801772:	e8 5d ff ff ff       	call   8016d4 <dev_lookup>
+  801777:	89 c3                	mov    %eax,%ebx
+  801779:	83 c4 10             	add    $0x10,%esp
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	78 1a                	js     80179a <fd_close+0x70>
+  801780:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801783:	8b 40 10             	mov    0x10(%eax),%eax
+  801786:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	74 0b                	je     80179a <fd_close+0x70>
+  80178f:	83 ec 0c             	sub    $0xc,%esp
+  801792:	56                   	push   %esi
+  801793:	ff d0                	call   *%eax
+  801795:	89 c3                	mov    %eax,%ebx
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	83 ec 08             	sub    $0x8,%esp
+  80179d:	56                   	push   %esi
+  80179e:	6a 00                	push   $0x0
+  8017a0:	e8 cc f6 ff ff       	call   800e71 <sys_page_unmap>
+  8017a5:	83 c4 10             	add    $0x10,%esp
+  8017a8:	eb b5                	jmp    80175f <fd_close+0x35>
+
+008017aa <close>:
+  8017aa:	55                   	push   %ebp
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	83 ec 20             	sub    $0x20,%esp
+  8017b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b3:	50                   	push   %eax
+  8017b4:	ff 75 08             	push   0x8(%ebp)
+  8017b7:	e8 c8 fe ff ff       	call   801684 <fd_lookup>
+  8017bc:	83 c4 10             	add    $0x10,%esp
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	79 02                	jns    8017c5 <close+0x1b>
+  8017c3:	c9                   	leave
+  8017c4:	c3                   	ret
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	6a 01                	push   $0x1
+  8017ca:	ff 75 f4             	push   -0xc(%ebp)
+  8017cd:	e8 58 ff ff ff       	call   80172a <fd_close>
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	eb ec                	jmp    8017c3 <close+0x19>
+
+008017d7 <close_all>:
+  8017d7:	55                   	push   %ebp
+  8017d8:	89 e5                	mov    %esp,%ebp
+  8017da:	53                   	push   %ebx
+  8017db:	83 ec 04             	sub    $0x4,%esp
+  8017de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	53                   	push   %ebx
+  8017e7:	e8 be ff ff ff       	call   8017aa <close>
+  8017ec:	83 c3 01             	add    $0x1,%ebx
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	83 fb 20             	cmp    $0x20,%ebx
+  8017f5:	75 ec                	jne    8017e3 <close_all+0xc>
+  8017f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+
+008017fc <dup>:
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	57                   	push   %edi
+  801800:	56                   	push   %esi
+  801801:	53                   	push   %ebx
+  801802:	83 ec 34             	sub    $0x34,%esp
+  801805:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801808:	50                   	push   %eax
+  801809:	ff 75 08             	push   0x8(%ebp)
+  80180c:	e8 73 fe ff ff       	call   801684 <fd_lookup>
+  801811:	89 c3                	mov    %eax,%ebx
+  801813:	83 c4 10             	add    $0x10,%esp
+  801816:	85 c0                	test   %eax,%eax
+  801818:	78 7f                	js     801899 <dup+0x9d>
+  80181a:	83 ec 0c             	sub    $0xc,%esp
+  80181d:	ff 75 0c             	push   0xc(%ebp)
+  801820:	e8 85 ff ff ff       	call   8017aa <close>
+  801825:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801828:	c1 e6 0c             	shl    $0xc,%esi
+  80182b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801831:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801834:	89 3c 24             	mov    %edi,(%esp)
+  801837:	e8 e1 fd ff ff       	call   80161d <fd2data>
+  80183c:	89 c3                	mov    %eax,%ebx
+  80183e:	89 34 24             	mov    %esi,(%esp)
+  801841:	e8 d7 fd ff ff       	call   80161d <fd2data>
+  801846:	83 c4 10             	add    $0x10,%esp
+  801849:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80184c:	89 d8                	mov    %ebx,%eax
+  80184e:	c1 e8 16             	shr    $0x16,%eax
+  801851:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801858:	a8 01                	test   $0x1,%al
+  80185a:	74 11                	je     80186d <dup+0x71>
+  80185c:	89 d8                	mov    %ebx,%eax
+  80185e:	c1 e8 0c             	shr    $0xc,%eax
+  801861:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801868:	f6 c2 01             	test   $0x1,%dl
+  80186b:	75 36                	jne    8018a3 <dup+0xa7>
+  80186d:	89 f8                	mov    %edi,%eax
+  80186f:	c1 e8 0c             	shr    $0xc,%eax
+  801872:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801879:	83 ec 0c             	sub    $0xc,%esp
+  80187c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801881:	50                   	push   %eax
+  801882:	56                   	push   %esi
+  801883:	6a 00                	push   $0x0
+  801885:	57                   	push   %edi
+  801886:	6a 00                	push   $0x0
+  801888:	e8 55 f5 ff ff       	call   800de2 <sys_page_map>
+  80188d:	89 c3                	mov    %eax,%ebx
+  80188f:	83 c4 20             	add    $0x20,%esp
+  801892:	85 c0                	test   %eax,%eax
+  801894:	78 33                	js     8018c9 <dup+0xcd>
+  801896:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801899:	89 d8                	mov    %ebx,%eax
+  80189b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189e:	5b                   	pop    %ebx
+  80189f:	5e                   	pop    %esi
+  8018a0:	5f                   	pop    %edi
+  8018a1:	5d                   	pop    %ebp
+  8018a2:	c3                   	ret
+  8018a3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018aa:	83 ec 0c             	sub    $0xc,%esp
+  8018ad:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018b2:	50                   	push   %eax
+  8018b3:	ff 75 d4             	push   -0x2c(%ebp)
+  8018b6:	6a 00                	push   $0x0
+  8018b8:	53                   	push   %ebx
+  8018b9:	6a 00                	push   $0x0
+  8018bb:	e8 22 f5 ff ff       	call   800de2 <sys_page_map>
+  8018c0:	89 c3                	mov    %eax,%ebx
+  8018c2:	83 c4 20             	add    $0x20,%esp
+  8018c5:	85 c0                	test   %eax,%eax
+  8018c7:	79 a4                	jns    80186d <dup+0x71>
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+  8018cc:	56                   	push   %esi
+  8018cd:	6a 00                	push   $0x0
+  8018cf:	e8 9d f5 ff ff       	call   800e71 <sys_page_unmap>
+  8018d4:	83 c4 08             	add    $0x8,%esp
+  8018d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8018da:	6a 00                	push   $0x0
+  8018dc:	e8 90 f5 ff ff       	call   800e71 <sys_page_unmap>
+  8018e1:	83 c4 10             	add    $0x10,%esp
+  8018e4:	eb b3                	jmp    801899 <dup+0x9d>
+
+008018e6 <read>:
+  8018e6:	55                   	push   %ebp
+  8018e7:	89 e5                	mov    %esp,%ebp
+  8018e9:	56                   	push   %esi
+  8018ea:	53                   	push   %ebx
+  8018eb:	83 ec 18             	sub    $0x18,%esp
+  8018ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018f4:	50                   	push   %eax
+  8018f5:	56                   	push   %esi
+  8018f6:	e8 89 fd ff ff       	call   801684 <fd_lookup>
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	78 3c                	js     80193e <read+0x58>
+  801902:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801905:	83 ec 08             	sub    $0x8,%esp
+  801908:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80190b:	50                   	push   %eax
+  80190c:	ff 33                	push   (%ebx)
+  80190e:	e8 c1 fd ff ff       	call   8016d4 <dev_lookup>
+  801913:	83 c4 10             	add    $0x10,%esp
+  801916:	85 c0                	test   %eax,%eax
+  801918:	78 24                	js     80193e <read+0x58>
+  80191a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80191d:	83 e0 03             	and    $0x3,%eax
+  801920:	83 f8 01             	cmp    $0x1,%eax
+  801923:	74 20                	je     801945 <read+0x5f>
+  801925:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801928:	8b 40 08             	mov    0x8(%eax),%eax
+  80192b:	85 c0                	test   %eax,%eax
+  80192d:	74 37                	je     801966 <read+0x80>
+  80192f:	83 ec 04             	sub    $0x4,%esp
+  801932:	ff 75 10             	push   0x10(%ebp)
+  801935:	ff 75 0c             	push   0xc(%ebp)
+  801938:	53                   	push   %ebx
+  801939:	ff d0                	call   *%eax
+  80193b:	83 c4 10             	add    $0x10,%esp
+  80193e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801941:	5b                   	pop    %ebx
+  801942:	5e                   	pop    %esi
+  801943:	5d                   	pop    %ebp
+  801944:	c3                   	ret
+  801945:	a1 10 50 80 00       	mov    0x805010,%eax
+  80194a:	8b 40 48             	mov    0x48(%eax),%eax
+  80194d:	83 ec 04             	sub    $0x4,%esp
+  801950:	56                   	push   %esi
+  801951:	50                   	push   %eax
+  801952:	68 19 36 80 00       	push   $0x803619
+  801957:	e8 ec e8 ff ff       	call   800248 <cprintf>
+  80195c:	83 c4 10             	add    $0x10,%esp
+  80195f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801964:	eb d8                	jmp    80193e <read+0x58>
+  801966:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80196b:	eb d1                	jmp    80193e <read+0x58>
+
+0080196d <readn>:
+  80196d:	55                   	push   %ebp
+  80196e:	89 e5                	mov    %esp,%ebp
+  801970:	57                   	push   %edi
+  801971:	56                   	push   %esi
+  801972:	53                   	push   %ebx
+  801973:	83 ec 0c             	sub    $0xc,%esp
+  801976:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801979:	8b 75 10             	mov    0x10(%ebp),%esi
+  80197c:	85 f6                	test   %esi,%esi
+  80197e:	74 30                	je     8019b0 <readn+0x43>
+  801980:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198a:	83 ec 04             	sub    $0x4,%esp
+  80198d:	89 f2                	mov    %esi,%edx
+  80198f:	29 c2                	sub    %eax,%edx
+  801991:	52                   	push   %edx
+  801992:	01 f8                	add    %edi,%eax
+  801994:	50                   	push   %eax
+  801995:	ff 75 08             	push   0x8(%ebp)
+  801998:	e8 49 ff ff ff       	call   8018e6 <read>
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 15                	js     8019b9 <readn+0x4c>
+  8019a4:	74 11                	je     8019b7 <readn+0x4a>
+  8019a6:	01 c3                	add    %eax,%ebx
+  8019a8:	89 d8                	mov    %ebx,%eax
+  8019aa:	39 f3                	cmp    %esi,%ebx
+  8019ac:	72 dc                	jb     80198a <readn+0x1d>
+  8019ae:	eb 09                	jmp    8019b9 <readn+0x4c>
+  8019b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b5:	eb 02                	jmp    8019b9 <readn+0x4c>
+  8019b7:	89 d8                	mov    %ebx,%eax
+  8019b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019bc:	5b                   	pop    %ebx
+  8019bd:	5e                   	pop    %esi
+  8019be:	5f                   	pop    %edi
+  8019bf:	5d                   	pop    %ebp
+  8019c0:	c3                   	ret
+
+008019c1 <write>:
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	56                   	push   %esi
+  8019c5:	53                   	push   %ebx
+  8019c6:	83 ec 18             	sub    $0x18,%esp
+  8019c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019cc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019cf:	50                   	push   %eax
+  8019d0:	53                   	push   %ebx
+  8019d1:	e8 ae fc ff ff       	call   801684 <fd_lookup>
+  8019d6:	83 c4 10             	add    $0x10,%esp
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	78 37                	js     801a14 <write+0x53>
+  8019dd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019e0:	83 ec 08             	sub    $0x8,%esp
+  8019e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019e6:	50                   	push   %eax
+  8019e7:	ff 36                	push   (%esi)
+  8019e9:	e8 e6 fc ff ff       	call   8016d4 <dev_lookup>
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	85 c0                	test   %eax,%eax
+  8019f3:	78 1f                	js     801a14 <write+0x53>
+  8019f5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019f9:	74 20                	je     801a1b <write+0x5a>
+  8019fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	74 37                	je     801a3c <write+0x7b>
+  801a05:	83 ec 04             	sub    $0x4,%esp
+  801a08:	ff 75 10             	push   0x10(%ebp)
+  801a0b:	ff 75 0c             	push   0xc(%ebp)
+  801a0e:	56                   	push   %esi
+  801a0f:	ff d0                	call   *%eax
+  801a11:	83 c4 10             	add    $0x10,%esp
+  801a14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a17:	5b                   	pop    %ebx
+  801a18:	5e                   	pop    %esi
+  801a19:	5d                   	pop    %ebp
+  801a1a:	c3                   	ret
+  801a1b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a20:	8b 40 48             	mov    0x48(%eax),%eax
+  801a23:	83 ec 04             	sub    $0x4,%esp
+  801a26:	53                   	push   %ebx
+  801a27:	50                   	push   %eax
+  801a28:	68 35 36 80 00       	push   $0x803635
+  801a2d:	e8 16 e8 ff ff       	call   800248 <cprintf>
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a3a:	eb d8                	jmp    801a14 <write+0x53>
+  801a3c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a41:	eb d1                	jmp    801a14 <write+0x53>
+
+00801a43 <seek>:
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	83 ec 20             	sub    $0x20,%esp
+  801a49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a4c:	50                   	push   %eax
+  801a4d:	ff 75 08             	push   0x8(%ebp)
+  801a50:	e8 2f fc ff ff       	call   801684 <fd_lookup>
+  801a55:	83 c4 10             	add    $0x10,%esp
+  801a58:	85 c0                	test   %eax,%eax
+  801a5a:	78 0e                	js     801a6a <seek+0x27>
+  801a5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a62:	89 50 04             	mov    %edx,0x4(%eax)
+  801a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6a:	c9                   	leave
+  801a6b:	c3                   	ret
+
+00801a6c <ftruncate>:
+  801a6c:	55                   	push   %ebp
+  801a6d:	89 e5                	mov    %esp,%ebp
+  801a6f:	56                   	push   %esi
+  801a70:	53                   	push   %ebx
+  801a71:	83 ec 18             	sub    $0x18,%esp
+  801a74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a7a:	50                   	push   %eax
+  801a7b:	53                   	push   %ebx
+  801a7c:	e8 03 fc ff ff       	call   801684 <fd_lookup>
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 34                	js     801abc <ftruncate+0x50>
+  801a88:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a8b:	83 ec 08             	sub    $0x8,%esp
+  801a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	ff 36                	push   (%esi)
+  801a94:	e8 3b fc ff ff       	call   8016d4 <dev_lookup>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 1c                	js     801abc <ftruncate+0x50>
+  801aa0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801aa4:	74 1d                	je     801ac3 <ftruncate+0x57>
+  801aa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa9:	8b 40 18             	mov    0x18(%eax),%eax
+  801aac:	85 c0                	test   %eax,%eax
+  801aae:	74 34                	je     801ae4 <ftruncate+0x78>
+  801ab0:	83 ec 08             	sub    $0x8,%esp
+  801ab3:	ff 75 0c             	push   0xc(%ebp)
+  801ab6:	56                   	push   %esi
+  801ab7:	ff d0                	call   *%eax
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abf:	5b                   	pop    %ebx
+  801ac0:	5e                   	pop    %esi
+  801ac1:	5d                   	pop    %ebp
+  801ac2:	c3                   	ret
+  801ac3:	a1 10 50 80 00       	mov    0x805010,%eax
+  801ac8:	8b 40 48             	mov    0x48(%eax),%eax
+  801acb:	83 ec 04             	sub    $0x4,%esp
+  801ace:	53                   	push   %ebx
+  801acf:	50                   	push   %eax
+  801ad0:	68 f8 35 80 00       	push   $0x8035f8
+  801ad5:	e8 6e e7 ff ff       	call   800248 <cprintf>
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae2:	eb d8                	jmp    801abc <ftruncate+0x50>
+  801ae4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae9:	eb d1                	jmp    801abc <ftruncate+0x50>
+
+00801aeb <fstat>:
+  801aeb:	55                   	push   %ebp
+  801aec:	89 e5                	mov    %esp,%ebp
+  801aee:	56                   	push   %esi
+  801aef:	53                   	push   %ebx
+  801af0:	83 ec 18             	sub    $0x18,%esp
+  801af3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801af6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801af9:	50                   	push   %eax
+  801afa:	ff 75 08             	push   0x8(%ebp)
+  801afd:	e8 82 fb ff ff       	call   801684 <fd_lookup>
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 49                	js     801b52 <fstat+0x67>
+  801b09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b0c:	83 ec 08             	sub    $0x8,%esp
+  801b0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b12:	50                   	push   %eax
+  801b13:	ff 36                	push   (%esi)
+  801b15:	e8 ba fb ff ff       	call   8016d4 <dev_lookup>
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 31                	js     801b52 <fstat+0x67>
+  801b21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b24:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b28:	74 2f                	je     801b59 <fstat+0x6e>
+  801b2a:	c6 03 00             	movb   $0x0,(%ebx)
+  801b2d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b34:	00 00 00 
+  801b37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b3e:	00 00 00 
+  801b41:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801b47:	83 ec 08             	sub    $0x8,%esp
+  801b4a:	53                   	push   %ebx
+  801b4b:	56                   	push   %esi
+  801b4c:	ff 50 14             	call   *0x14(%eax)
+  801b4f:	83 c4 10             	add    $0x10,%esp
+  801b52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5d                   	pop    %ebp
+  801b58:	c3                   	ret
+  801b59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b5e:	eb f2                	jmp    801b52 <fstat+0x67>
+
+00801b60 <stat>:
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	56                   	push   %esi
+  801b64:	53                   	push   %ebx
+  801b65:	83 ec 08             	sub    $0x8,%esp
+  801b68:	6a 00                	push   $0x0
+  801b6a:	ff 75 08             	push   0x8(%ebp)
+  801b6d:	e8 31 05 00 00       	call   8020a3 <open>
+  801b72:	89 c3                	mov    %eax,%ebx
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 1b                	js     801b96 <stat+0x36>
+  801b7b:	83 ec 08             	sub    $0x8,%esp
+  801b7e:	ff 75 0c             	push   0xc(%ebp)
+  801b81:	50                   	push   %eax
+  801b82:	e8 64 ff ff ff       	call   801aeb <fstat>
+  801b87:	89 c6                	mov    %eax,%esi
+  801b89:	89 1c 24             	mov    %ebx,(%esp)
+  801b8c:	e8 19 fc ff ff       	call   8017aa <close>
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	89 f3                	mov    %esi,%ebx
+  801b96:	89 d8                	mov    %ebx,%eax
+  801b98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b9b:	5b                   	pop    %ebx
+  801b9c:	5e                   	pop    %esi
+  801b9d:	5d                   	pop    %ebp
+  801b9e:	c3                   	ret
+
+00801b9f <fsipc>:
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	56                   	push   %esi
+  801ba3:	53                   	push   %ebx
+  801ba4:	89 c3                	mov    %eax,%ebx
+  801ba6:	89 d6                	mov    %edx,%esi
+  801ba8:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801baf:	74 20                	je     801bd1 <fsipc+0x32>
+  801bb1:	83 ec 08             	sub    $0x8,%esp
+  801bb4:	6a 00                	push   $0x0
+  801bb6:	56                   	push   %esi
+  801bb7:	6a 07                	push   $0x7
+  801bb9:	68 00 60 80 00       	push   $0x806000
+  801bbe:	53                   	push   %ebx
+  801bbf:	ff 35 08 50 80 00    	push   0x805008
+  801bc5:	e8 5a 12 00 00       	call   802e24 <ipc_call>
+  801bca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bcd:	5b                   	pop    %ebx
+  801bce:	5e                   	pop    %esi
+  801bcf:	5d                   	pop    %ebp
+  801bd0:	c3                   	ret
+  801bd1:	83 ec 0c             	sub    $0xc,%esp
+  801bd4:	6a 02                	push   $0x2
+  801bd6:	e8 e4 13 00 00       	call   802fbf <ipc_find_env>
+  801bdb:	a3 08 50 80 00       	mov    %eax,0x805008
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	eb cc                	jmp    801bb1 <fsipc+0x12>
+
+00801be5 <devfile_trunc>:
+  801be5:	55                   	push   %ebp
+  801be6:	89 e5                	mov    %esp,%ebp
+  801be8:	83 ec 08             	sub    $0x8,%esp
+  801beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bee:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bf1:	a3 00 60 80 00       	mov    %eax,0x806000
+  801bf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bf9:	a3 04 60 80 00       	mov    %eax,0x806004
+  801bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c03:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c08:	e8 92 ff ff ff       	call   801b9f <fsipc>
+  801c0d:	c9                   	leave
+  801c0e:	c3                   	ret
+
+00801c0f <devfile_flush>:
+  801c0f:	55                   	push   %ebp
+  801c10:	89 e5                	mov    %esp,%ebp
+  801c12:	83 ec 08             	sub    $0x8,%esp
+  801c15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c18:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c1b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c25:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c2a:	e8 70 ff ff ff       	call   801b9f <fsipc>
+  801c2f:	c9                   	leave
+  801c30:	c3                   	ret
+
+00801c31 <devfile_stat>:
+  801c31:	55                   	push   %ebp
+  801c32:	89 e5                	mov    %esp,%ebp
+  801c34:	53                   	push   %ebx
+  801c35:	83 ec 04             	sub    $0x4,%esp
+  801c38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c41:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c50:	e8 4a ff ff ff       	call   801b9f <fsipc>
+  801c55:	85 c0                	test   %eax,%eax
+  801c57:	78 2c                	js     801c85 <devfile_stat+0x54>
+  801c59:	83 ec 08             	sub    $0x8,%esp
+  801c5c:	68 00 60 80 00       	push   $0x806000
+  801c61:	53                   	push   %ebx
+  801c62:	e8 d8 ec ff ff       	call   80093f <strcpy>
+  801c67:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c6c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801c72:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c77:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c88:	c9                   	leave
+  801c89:	c3                   	ret
+
+00801c8a <fsring_rw>:
+  801c8a:	55                   	push   %ebp
+  801c8b:	89 e5                	mov    %esp,%ebp
+  801c8d:	57                   	push   %edi
+  801c8e:	56                   	push   %esi
+  801c8f:	53                   	push   %ebx
+  801c90:	83 ec 2c             	sub    $0x2c,%esp
+  801c93:	89 c7                	mov    %eax,%edi
+  801c95:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801c98:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801c9b:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801ca0:	a8 01                	test   $0x1,%al
+  801ca2:	74 0d                	je     801cb1 <fsring_rw+0x27>
+  801ca4:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801ca9:	a8 01                	test   $0x1,%al
+  801cab:	0f 85 d5 00 00 00    	jne    801d86 <fsring_rw+0xfc>
+  801cb1:	a1 10 50 80 00       	mov    0x805010,%eax
+  801cb6:	8b 40 48             	mov    0x48(%eax),%eax
+  801cb9:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801cbf:	0f 84 fc 00 00 00    	je     801dc1 <fsring_rw+0x137>
+  801cc5:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801ccc:	0f 84 02 01 00 00    	je     801dd4 <fsring_rw+0x14a>
+  801cd2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801cd7:	83 ec 04             	sub    $0x4,%esp
+  801cda:	68 07 02 00 00       	push   $0x207
+  801cdf:	53                   	push   %ebx
+  801ce0:	6a 00                	push   $0x0
+  801ce2:	e8 b8 f0 ff ff       	call   800d9f <sys_page_alloc>
+  801ce7:	83 c4 10             	add    $0x10,%esp
+  801cea:	85 c0                	test   %eax,%eax
+  801cec:	0f 88 f9 00 00 00    	js     801deb <fsring_rw+0x161>
+  801cf2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801cf8:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801cfe:	75 d7                	jne    801cd7 <fsring_rw+0x4d>
+  801d00:	6a 0e                	push   $0xe
+  801d02:	6a 0d                	push   $0xd
+  801d04:	ff 35 08 50 80 00    	push   0x805008
+  801d0a:	68 00 00 f0 cf       	push   $0xcff00000
+  801d0f:	e8 c4 0c 00 00       	call   8029d8 <ipcring_init>
+  801d14:	83 c4 08             	add    $0x8,%esp
+  801d17:	6a 00                	push   $0x0
+  801d19:	6a 00                	push   $0x0
+  801d1b:	68 07 02 00 00       	push   $0x207
+  801d20:	68 00 00 f0 cf       	push   $0xcff00000
+  801d25:	6a 0b                	push   $0xb
+  801d27:	ff 35 08 50 80 00    	push   0x805008
+  801d2d:	e8 f2 10 00 00       	call   802e24 <ipc_call>
+  801d32:	89 c6                	mov    %eax,%esi
+  801d34:	83 c4 20             	add    $0x20,%esp
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	0f 88 ac 00 00 00    	js     801deb <fsring_rw+0x161>
+  801d3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d44:	89 d9                	mov    %ebx,%ecx
+  801d46:	83 c3 01             	add    $0x1,%ebx
+  801d49:	89 da                	mov    %ebx,%edx
+  801d4b:	c1 e2 0c             	shl    $0xc,%edx
+  801d4e:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801d54:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801d5a:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801d60:	83 ec 08             	sub    $0x8,%esp
+  801d63:	6a 00                	push   $0x0
+  801d65:	6a 00                	push   $0x0
+  801d67:	68 07 02 00 00       	push   $0x207
+  801d6c:	50                   	push   %eax
+  801d6d:	6a 0c                	push   $0xc
+  801d6f:	ff 35 08 50 80 00    	push   0x805008
+  801d75:	e8 aa 10 00 00       	call   802e24 <ipc_call>
+  801d7a:	83 c4 20             	add    $0x20,%esp
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 6a                	js     801deb <fsring_rw+0x161>
+  801d81:	83 fb 08             	cmp    $0x8,%ebx
+  801d84:	75 be                	jne    801d44 <fsring_rw+0xba>
+  801d86:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801d8a:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801d8f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801d94:	0f 45 c2             	cmovne %edx,%eax
+  801d97:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801d9a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801da1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801da8:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db4:	be 00 00 00 00       	mov    $0x0,%esi
+  801db9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801dbc:	e9 4b 01 00 00       	jmp    801f0c <fsring_rw+0x282>
+  801dc1:	e8 a3 f3 ff ff       	call   801169 <sys_time_msec>
+  801dc6:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801dcc:	0f 89 f3 fe ff ff    	jns    801cc5 <fsring_rw+0x3b>
+  801dd2:	eb 54                	jmp    801e28 <fsring_rw+0x19e>
+  801dd4:	83 ec 0c             	sub    $0xc,%esp
+  801dd7:	6a 02                	push   $0x2
+  801dd9:	e8 e1 11 00 00       	call   802fbf <ipc_find_env>
+  801dde:	a3 08 50 80 00       	mov    %eax,0x805008
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	e9 e7 fe ff ff       	jmp    801cd2 <fsring_rw+0x48>
+  801deb:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801df0:	83 ec 08             	sub    $0x8,%esp
+  801df3:	53                   	push   %ebx
+  801df4:	6a 00                	push   $0x0
+  801df6:	e8 76 f0 ff ff       	call   800e71 <sys_page_unmap>
+  801dfb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e01:	83 c4 10             	add    $0x10,%esp
+  801e04:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801e0a:	75 e4                	jne    801df0 <fsring_rw+0x166>
+  801e0c:	e8 58 f3 ff ff       	call   801169 <sys_time_msec>
+  801e11:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801e16:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e1b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e20:	8b 40 48             	mov    0x48(%eax),%eax
+  801e23:	a3 04 50 80 00       	mov    %eax,0x805004
+  801e28:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801e2f:	e9 7a 01 00 00       	jmp    801fae <fsring_rw+0x324>
+  801e34:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e37:	89 10                	mov    %edx,(%eax)
+  801e39:	89 58 04             	mov    %ebx,0x4(%eax)
+  801e3c:	89 f2                	mov    %esi,%edx
+  801e3e:	03 57 04             	add    0x4(%edi),%edx
+  801e41:	89 50 08             	mov    %edx,0x8(%eax)
+  801e44:	83 ec 04             	sub    $0x4,%esp
+  801e47:	53                   	push   %ebx
+  801e48:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801e4b:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801e4e:	52                   	push   %edx
+  801e4f:	83 c0 0c             	add    $0xc,%eax
+  801e52:	50                   	push   %eax
+  801e53:	e8 97 ec ff ff       	call   800aef <memmove>
+  801e58:	83 c4 10             	add    $0x10,%esp
+  801e5b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e5e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e61:	89 08                	mov    %ecx,(%eax)
+  801e63:	83 ec 0c             	sub    $0xc,%esp
+  801e66:	68 00 00 f0 cf       	push   $0xcff00000
+  801e6b:	e8 c6 0b 00 00       	call   802a36 <ipcring_req_push>
+  801e70:	01 de                	add    %ebx,%esi
+  801e72:	83 c4 10             	add    $0x10,%esp
+  801e75:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801e78:	73 4c                	jae    801ec6 <fsring_rw+0x23c>
+  801e7a:	83 ec 0c             	sub    $0xc,%esp
+  801e7d:	68 00 00 f0 cf       	push   $0xcff00000
+  801e82:	e8 89 0b 00 00       	call   802a10 <ipcring_req_slot>
+  801e87:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e8a:	83 c4 10             	add    $0x10,%esp
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	74 35                	je     801ec6 <fsring_rw+0x23c>
+  801e91:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801e96:	83 e0 07             	and    $0x7,%eax
+  801e99:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801e9e:	c1 e0 0c             	shl    $0xc,%eax
+  801ea1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ea4:	29 f3                	sub    %esi,%ebx
+  801ea6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801ea9:	39 cb                	cmp    %ecx,%ebx
+  801eab:	0f 47 d9             	cmova  %ecx,%ebx
+  801eae:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801eb2:	75 80                	jne    801e34 <fsring_rw+0x1aa>
+  801eb4:	8b 57 0c             	mov    0xc(%edi),%edx
+  801eb7:	89 10                	mov    %edx,(%eax)
+  801eb9:	89 58 04             	mov    %ebx,0x4(%eax)
+  801ebc:	89 f2                	mov    %esi,%edx
+  801ebe:	03 57 04             	add    0x4(%edi),%edx
+  801ec1:	89 50 08             	mov    %edx,0x8(%eax)
+  801ec4:	eb 95                	jmp    801e5b <fsring_rw+0x1d1>
+  801ec6:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801ecb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ece:	83 ec 0c             	sub    $0xc,%esp
+  801ed1:	68 00 00 f0 cf       	push   $0xcff00000
+  801ed6:	e8 94 0b 00 00       	call   802a6f <ipcring_rsp_wait>
+  801edb:	8b 58 04             	mov    0x4(%eax),%ebx
+  801ede:	83 c4 10             	add    $0x10,%esp
+  801ee1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801ee5:	75 45                	jne    801f2c <fsring_rw+0x2a2>
+  801ee7:	85 db                	test   %ebx,%ebx
+  801ee9:	79 41                	jns    801f2c <fsring_rw+0x2a2>
+  801eeb:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801eee:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801ef5:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801efc:	83 ec 0c             	sub    $0xc,%esp
+  801eff:	68 00 00 f0 cf       	push   $0xcff00000
+  801f04:	e8 cc 0b 00 00       	call   802ad5 <ipcring_rsp_pop>
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801f12:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f17:	39 c2                	cmp    %eax,%edx
+  801f19:	74 75                	je     801f90 <fsring_rw+0x306>
+  801f1b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f1f:	75 a5                	jne    801ec6 <fsring_rw+0x23c>
+  801f21:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f24:	0f 82 50 ff ff ff    	jb     801e7a <fsring_rw+0x1f0>
+  801f2a:	eb 9a                	jmp    801ec6 <fsring_rw+0x23c>
+  801f2c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801f30:	75 ca                	jne    801efc <fsring_rw+0x272>
+  801f32:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801f36:	74 31                	je     801f69 <fsring_rw+0x2df>
+  801f38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f3e:	29 c8                	sub    %ecx,%eax
+  801f40:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801f43:	39 d0                	cmp    %edx,%eax
+  801f45:	0f 47 c2             	cmova  %edx,%eax
+  801f48:	39 d8                	cmp    %ebx,%eax
+  801f4a:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f4f:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801f53:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801f56:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f5b:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801f5f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f62:	01 d9                	add    %ebx,%ecx
+  801f64:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801f67:	eb 93                	jmp    801efc <fsring_rw+0x272>
+  801f69:	83 ec 04             	sub    $0x4,%esp
+  801f6c:	53                   	push   %ebx
+  801f6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f70:	83 e0 07             	and    $0x7,%eax
+  801f73:	c1 e0 0c             	shl    $0xc,%eax
+  801f76:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801f7c:	50                   	push   %eax
+  801f7d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801f80:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f83:	01 c8                	add    %ecx,%eax
+  801f85:	50                   	push   %eax
+  801f86:	e8 64 eb ff ff       	call   800aef <memmove>
+  801f8b:	83 c4 10             	add    $0x10,%esp
+  801f8e:	eb a8                	jmp    801f38 <fsring_rw+0x2ae>
+  801f90:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801f94:	75 09                	jne    801f9f <fsring_rw+0x315>
+  801f96:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f99:	0f 82 db fe ff ff    	jb     801e7a <fsring_rw+0x1f0>
+  801f9f:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801fa2:	01 57 04             	add    %edx,0x4(%edi)
+  801fa5:	85 d2                	test   %edx,%edx
+  801fa7:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801fab:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801fae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb4:	5b                   	pop    %ebx
+  801fb5:	5e                   	pop    %esi
+  801fb6:	5f                   	pop    %edi
+  801fb7:	5d                   	pop    %ebp
+  801fb8:	c3                   	ret
+
+00801fb9 <devfile_write>:
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	57                   	push   %edi
+  801fbd:	56                   	push   %esi
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 0c             	sub    $0xc,%esp
+  801fc2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fc5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801fcb:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801fd1:	76 1a                	jbe    801fed <devfile_write+0x34>
+  801fd3:	83 ec 0c             	sub    $0xc,%esp
+  801fd6:	53                   	push   %ebx
+  801fd7:	89 f1                	mov    %esi,%ecx
+  801fd9:	ba 06 00 00 00       	mov    $0x6,%edx
+  801fde:	89 f8                	mov    %edi,%eax
+  801fe0:	e8 a5 fc ff ff       	call   801c8a <fsring_rw>
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801feb:	75 39                	jne    802026 <devfile_write+0x6d>
+  801fed:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801ff2:	39 c3                	cmp    %eax,%ebx
+  801ff4:	0f 47 d8             	cmova  %eax,%ebx
+  801ff7:	8b 47 0c             	mov    0xc(%edi),%eax
+  801ffa:	a3 00 60 80 00       	mov    %eax,0x806000
+  801fff:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  802005:	83 ec 04             	sub    $0x4,%esp
+  802008:	53                   	push   %ebx
+  802009:	56                   	push   %esi
+  80200a:	68 08 60 80 00       	push   $0x806008
+  80200f:	e8 db ea ff ff       	call   800aef <memmove>
+  802014:	ba 00 00 00 00       	mov    $0x0,%edx
+  802019:	b8 04 00 00 00       	mov    $0x4,%eax
+  80201e:	e8 7c fb ff ff       	call   801b9f <fsipc>
+  802023:	83 c4 10             	add    $0x10,%esp
+  802026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802029:	5b                   	pop    %ebx
+  80202a:	5e                   	pop    %esi
+  80202b:	5f                   	pop    %edi
+  80202c:	5d                   	pop    %ebp
+  80202d:	c3                   	ret
+
+0080202e <devfile_read>:
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	57                   	push   %edi
+  802032:	56                   	push   %esi
+  802033:	53                   	push   %ebx
+  802034:	83 ec 0c             	sub    $0xc,%esp
+  802037:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80203a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80203d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802043:	76 1d                	jbe    802062 <devfile_read+0x34>
+  802045:	83 ec 0c             	sub    $0xc,%esp
+  802048:	56                   	push   %esi
+  802049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80204c:	ba 05 00 00 00       	mov    $0x5,%edx
+  802051:	89 f8                	mov    %edi,%eax
+  802053:	e8 32 fc ff ff       	call   801c8a <fsring_rw>
+  802058:	89 c3                	mov    %eax,%ebx
+  80205a:	83 c4 10             	add    $0x10,%esp
+  80205d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802060:	75 37                	jne    802099 <devfile_read+0x6b>
+  802062:	8b 47 0c             	mov    0xc(%edi),%eax
+  802065:	a3 00 60 80 00       	mov    %eax,0x806000
+  80206a:	89 35 04 60 80 00    	mov    %esi,0x806004
+  802070:	ba 00 00 00 00       	mov    $0x0,%edx
+  802075:	b8 03 00 00 00       	mov    $0x3,%eax
+  80207a:	e8 20 fb ff ff       	call   801b9f <fsipc>
+  80207f:	89 c3                	mov    %eax,%ebx
+  802081:	85 c0                	test   %eax,%eax
+  802083:	78 14                	js     802099 <devfile_read+0x6b>
+  802085:	83 ec 04             	sub    $0x4,%esp
+  802088:	50                   	push   %eax
+  802089:	68 00 60 80 00       	push   $0x806000
+  80208e:	ff 75 0c             	push   0xc(%ebp)
+  802091:	e8 59 ea ff ff       	call   800aef <memmove>
+  802096:	83 c4 10             	add    $0x10,%esp
+  802099:	89 d8                	mov    %ebx,%eax
+  80209b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80209e:	5b                   	pop    %ebx
+  80209f:	5e                   	pop    %esi
+  8020a0:	5f                   	pop    %edi
+  8020a1:	5d                   	pop    %ebp
+  8020a2:	c3                   	ret
+
+008020a3 <open>:
+  8020a3:	55                   	push   %ebp
+  8020a4:	89 e5                	mov    %esp,%ebp
+  8020a6:	56                   	push   %esi
+  8020a7:	53                   	push   %ebx
+  8020a8:	83 ec 1c             	sub    $0x1c,%esp
+  8020ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020ae:	56                   	push   %esi
+  8020af:	e8 3f e8 ff ff       	call   8008f3 <strlen>
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020bc:	7f 6c                	jg     80212a <open+0x87>
+  8020be:	83 ec 0c             	sub    $0xc,%esp
+  8020c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c4:	50                   	push   %eax
+  8020c5:	e8 6a f5 ff ff       	call   801634 <fd_alloc>
+  8020ca:	89 c3                	mov    %eax,%ebx
+  8020cc:	83 c4 10             	add    $0x10,%esp
+  8020cf:	85 c0                	test   %eax,%eax
+  8020d1:	78 3c                	js     80210f <open+0x6c>
+  8020d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d6:	a3 00 64 80 00       	mov    %eax,0x806400
+  8020db:	83 ec 08             	sub    $0x8,%esp
+  8020de:	56                   	push   %esi
+  8020df:	68 00 60 80 00       	push   $0x806000
+  8020e4:	e8 56 e8 ff ff       	call   80093f <strcpy>
+  8020e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020f1:	e8 a9 fa ff ff       	call   801b9f <fsipc>
+  8020f6:	89 c3                	mov    %eax,%ebx
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	78 19                	js     802118 <open+0x75>
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	ff 75 f4             	push   -0xc(%ebp)
+  802105:	e8 03 f5 ff ff       	call   80160d <fd2num>
+  80210a:	89 c3                	mov    %eax,%ebx
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	89 d8                	mov    %ebx,%eax
+  802111:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802114:	5b                   	pop    %ebx
+  802115:	5e                   	pop    %esi
+  802116:	5d                   	pop    %ebp
+  802117:	c3                   	ret
+  802118:	83 ec 08             	sub    $0x8,%esp
+  80211b:	6a 00                	push   $0x0
+  80211d:	ff 75 f4             	push   -0xc(%ebp)
+  802120:	e8 05 f6 ff ff       	call   80172a <fd_close>
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	eb e5                	jmp    80210f <open+0x6c>
+  80212a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80212f:	eb de                	jmp    80210f <open+0x6c>
+
+00802131 <file_image>:
+  802131:	55                   	push   %ebp
+  802132:	89 e5                	mov    %esp,%ebp
+  802134:	53                   	push   %ebx
+  802135:	83 ec 1c             	sub    $0x1c,%esp
+  802138:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80213b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80213e:	50                   	push   %eax
+  80213f:	ff 75 08             	push   0x8(%ebp)
+  802142:	e8 3d f5 ff ff       	call   801684 <fd_lookup>
+  802147:	83 c4 10             	add    $0x10,%esp
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	78 58                	js     8021a6 <file_image+0x75>
+  80214e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802151:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802157:	39 08                	cmp    %ecx,(%eax)
+  802159:	75 50                	jne    8021ab <file_image+0x7a>
+  80215b:	83 fb 04             	cmp    $0x4,%ebx
+  80215e:	77 52                	ja     8021b2 <file_image+0x81>
+  802160:	8b 40 0c             	mov    0xc(%eax),%eax
+  802163:	a3 00 60 80 00       	mov    %eax,0x806000
+  802168:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80216e:	83 ec 04             	sub    $0x4,%esp
+  802171:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802174:	c1 e0 02             	shl    $0x2,%eax
+  802177:	50                   	push   %eax
+  802178:	ff 75 0c             	push   0xc(%ebp)
+  80217b:	68 08 60 80 00       	push   $0x806008
+  802180:	e8 6a e9 ff ff       	call   800aef <memmove>
+  802185:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80218f:	e8 0b fa ff ff       	call   801b9f <fsipc>
+  802194:	83 c4 10             	add    $0x10,%esp
+  802197:	85 c0                	test   %eax,%eax
+  802199:	78 0b                	js     8021a6 <file_image+0x75>
+  80219b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80219e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8021a4:	89 0a                	mov    %ecx,(%edx)
+  8021a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021a9:	c9                   	leave
+  8021aa:	c3                   	ret
+  8021ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021b0:	eb f4                	jmp    8021a6 <file_image+0x75>
+  8021b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b7:	eb ed                	jmp    8021a6 <file_image+0x75>
+
+008021b9 <remove>:
+  8021b9:	55                   	push   %ebp
+  8021ba:	89 e5                	mov    %esp,%ebp
+  8021bc:	53                   	push   %ebx
+  8021bd:	83 ec 10             	sub    $0x10,%esp
+  8021c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021c3:	53                   	push   %ebx
+  8021c4:	e8 2a e7 ff ff       	call   8008f3 <strlen>
+  8021c9:	83 c4 10             	add    $0x10,%esp
+  8021cc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021d1:	7f 25                	jg     8021f8 <remove+0x3f>
+  8021d3:	83 ec 08             	sub    $0x8,%esp
+  8021d6:	53                   	push   %ebx
+  8021d7:	68 00 60 80 00       	push   $0x806000
+  8021dc:	e8 5e e7 ff ff       	call   80093f <strcpy>
+  8021e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021eb:	e8 af f9 ff ff       	call   801b9f <fsipc>
+  8021f0:	83 c4 10             	add    $0x10,%esp
+  8021f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f6:	c9                   	leave
+  8021f7:	c3                   	ret
+  8021f8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8021fd:	eb f4                	jmp    8021f3 <remove+0x3a>
+
+008021ff <sync>:
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+  802202:	83 ec 08             	sub    $0x8,%esp
+  802205:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80220f:	e8 8b f9 ff ff       	call   801b9f <fsipc>
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+00802216 <devsock_stat>:
+  802216:	55                   	push   %ebp
+  802217:	89 e5                	mov    %esp,%ebp
+  802219:	83 ec 10             	sub    $0x10,%esp
+  80221c:	68 68 36 80 00       	push   $0x803668
+  802221:	ff 75 0c             	push   0xc(%ebp)
+  802224:	e8 16 e7 ff ff       	call   80093f <strcpy>
+  802229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+00802230 <devsock_close>:
+  802230:	55                   	push   %ebp
+  802231:	89 e5                	mov    %esp,%ebp
+  802233:	53                   	push   %ebx
+  802234:	83 ec 10             	sub    $0x10,%esp
+  802237:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80223a:	53                   	push   %ebx
+  80223b:	e8 99 0d 00 00       	call   802fd9 <pageref>
+  802240:	89 c2                	mov    %eax,%edx
+  802242:	83 c4 10             	add    $0x10,%esp
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224a:	83 fa 01             	cmp    $0x1,%edx
+  80224d:	74 05                	je     802254 <devsock_close+0x24>
+  80224f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802252:	c9                   	leave
+  802253:	c3                   	ret
+  802254:	83 ec 0c             	sub    $0xc,%esp
+  802257:	ff 73 0c             	push   0xc(%ebx)
+  80225a:	e8 aa 02 00 00       	call   802509 <nsipc_close>
+  80225f:	83 c4 10             	add    $0x10,%esp
+  802262:	eb eb                	jmp    80224f <devsock_close+0x1f>
+
+00802264 <devsock_write>:
+  802264:	55                   	push   %ebp
+  802265:	89 e5                	mov    %esp,%ebp
+  802267:	83 ec 08             	sub    $0x8,%esp
+  80226a:	6a 00                	push   $0x0
+  80226c:	ff 75 10             	push   0x10(%ebp)
+  80226f:	ff 75 0c             	push   0xc(%ebp)
+  802272:	8b 45 08             	mov    0x8(%ebp),%eax
+  802275:	ff 70 0c             	push   0xc(%eax)
+  802278:	e8 6c 03 00 00       	call   8025e9 <nsipc_send>
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+
+0080227f <devsock_read>:
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	83 ec 08             	sub    $0x8,%esp
+  802285:	6a 00                	push   $0x0
+  802287:	ff 75 10             	push   0x10(%ebp)
+  80228a:	ff 75 0c             	push   0xc(%ebp)
+  80228d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802290:	ff 70 0c             	push   0xc(%eax)
+  802293:	e8 e2 02 00 00       	call   80257a <nsipc_recv>
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+
+0080229a <fd2sockid>:
+  80229a:	55                   	push   %ebp
+  80229b:	89 e5                	mov    %esp,%ebp
+  80229d:	83 ec 20             	sub    $0x20,%esp
+  8022a0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022a3:	52                   	push   %edx
+  8022a4:	50                   	push   %eax
+  8022a5:	e8 da f3 ff ff       	call   801684 <fd_lookup>
+  8022aa:	83 c4 10             	add    $0x10,%esp
+  8022ad:	85 c0                	test   %eax,%eax
+  8022af:	78 10                	js     8022c1 <fd2sockid+0x27>
+  8022b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022b4:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022ba:	39 08                	cmp    %ecx,(%eax)
+  8022bc:	75 05                	jne    8022c3 <fd2sockid+0x29>
+  8022be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c1:	c9                   	leave
+  8022c2:	c3                   	ret
+  8022c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022c8:	eb f7                	jmp    8022c1 <fd2sockid+0x27>
+
+008022ca <alloc_sockfd>:
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	56                   	push   %esi
+  8022ce:	53                   	push   %ebx
+  8022cf:	83 ec 1c             	sub    $0x1c,%esp
+  8022d2:	89 c6                	mov    %eax,%esi
+  8022d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022d7:	50                   	push   %eax
+  8022d8:	e8 57 f3 ff ff       	call   801634 <fd_alloc>
+  8022dd:	89 c3                	mov    %eax,%ebx
+  8022df:	83 c4 10             	add    $0x10,%esp
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	78 43                	js     802329 <alloc_sockfd+0x5f>
+  8022e6:	83 ec 04             	sub    $0x4,%esp
+  8022e9:	68 07 04 00 00       	push   $0x407
+  8022ee:	ff 75 f4             	push   -0xc(%ebp)
+  8022f1:	6a 00                	push   $0x0
+  8022f3:	e8 a7 ea ff ff       	call   800d9f <sys_page_alloc>
+  8022f8:	89 c3                	mov    %eax,%ebx
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	78 28                	js     802329 <alloc_sockfd+0x5f>
+  802301:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802304:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80230a:	89 10                	mov    %edx,(%eax)
+  80230c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80230f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802316:	89 70 0c             	mov    %esi,0xc(%eax)
+  802319:	83 ec 0c             	sub    $0xc,%esp
+  80231c:	50                   	push   %eax
+  80231d:	e8 eb f2 ff ff       	call   80160d <fd2num>
+  802322:	89 c3                	mov    %eax,%ebx
+  802324:	83 c4 10             	add    $0x10,%esp
+  802327:	eb 0c                	jmp    802335 <alloc_sockfd+0x6b>
+  802329:	83 ec 0c             	sub    $0xc,%esp
+  80232c:	56                   	push   %esi
+  80232d:	e8 d7 01 00 00       	call   802509 <nsipc_close>
+  802332:	83 c4 10             	add    $0x10,%esp
+  802335:	89 d8                	mov    %ebx,%eax
+  802337:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80233a:	5b                   	pop    %ebx
+  80233b:	5e                   	pop    %esi
+  80233c:	5d                   	pop    %ebp
+  80233d:	c3                   	ret
+
+0080233e <accept>:
+  80233e:	55                   	push   %ebp
+  80233f:	89 e5                	mov    %esp,%ebp
+  802341:	83 ec 08             	sub    $0x8,%esp
+  802344:	8b 45 08             	mov    0x8(%ebp),%eax
+  802347:	e8 4e ff ff ff       	call   80229a <fd2sockid>
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	78 1b                	js     80236b <accept+0x2d>
+  802350:	83 ec 04             	sub    $0x4,%esp
+  802353:	ff 75 10             	push   0x10(%ebp)
+  802356:	ff 75 0c             	push   0xc(%ebp)
+  802359:	50                   	push   %eax
+  80235a:	e8 07 01 00 00       	call   802466 <nsipc_accept>
+  80235f:	83 c4 10             	add    $0x10,%esp
+  802362:	85 c0                	test   %eax,%eax
+  802364:	78 05                	js     80236b <accept+0x2d>
+  802366:	e8 5f ff ff ff       	call   8022ca <alloc_sockfd>
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+
+0080236d <bind>:
+  80236d:	55                   	push   %ebp
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	83 ec 08             	sub    $0x8,%esp
+  802373:	8b 45 08             	mov    0x8(%ebp),%eax
+  802376:	e8 1f ff ff ff       	call   80229a <fd2sockid>
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	78 12                	js     802391 <bind+0x24>
+  80237f:	83 ec 04             	sub    $0x4,%esp
+  802382:	ff 75 10             	push   0x10(%ebp)
+  802385:	ff 75 0c             	push   0xc(%ebp)
+  802388:	50                   	push   %eax
+  802389:	e8 24 01 00 00       	call   8024b2 <nsipc_bind>
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	c9                   	leave
+  802392:	c3                   	ret
+
+00802393 <shutdown>:
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	83 ec 08             	sub    $0x8,%esp
+  802399:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239c:	e8 f9 fe ff ff       	call   80229a <fd2sockid>
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 0f                	js     8023b4 <shutdown+0x21>
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+  8023a8:	ff 75 0c             	push   0xc(%ebp)
+  8023ab:	50                   	push   %eax
+  8023ac:	e8 36 01 00 00       	call   8024e7 <nsipc_shutdown>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+
+008023b6 <connect>:
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	83 ec 08             	sub    $0x8,%esp
+  8023bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bf:	e8 d6 fe ff ff       	call   80229a <fd2sockid>
+  8023c4:	85 c0                	test   %eax,%eax
+  8023c6:	78 12                	js     8023da <connect+0x24>
+  8023c8:	83 ec 04             	sub    $0x4,%esp
+  8023cb:	ff 75 10             	push   0x10(%ebp)
+  8023ce:	ff 75 0c             	push   0xc(%ebp)
+  8023d1:	50                   	push   %eax
+  8023d2:	e8 4c 01 00 00       	call   802523 <nsipc_connect>
+  8023d7:	83 c4 10             	add    $0x10,%esp
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+
+008023dc <listen>:
+  8023dc:	55                   	push   %ebp
+  8023dd:	89 e5                	mov    %esp,%ebp
+  8023df:	83 ec 08             	sub    $0x8,%esp
+  8023e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e5:	e8 b0 fe ff ff       	call   80229a <fd2sockid>
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	78 0f                	js     8023fd <listen+0x21>
+  8023ee:	83 ec 08             	sub    $0x8,%esp
+  8023f1:	ff 75 0c             	push   0xc(%ebp)
+  8023f4:	50                   	push   %eax
+  8023f5:	e8 5e 01 00 00       	call   802558 <nsipc_listen>
+  8023fa:	83 c4 10             	add    $0x10,%esp
+  8023fd:	c9                   	leave
+  8023fe:	c3                   	ret
+
+008023ff <socket>:
+  8023ff:	55                   	push   %ebp
+  802400:	89 e5                	mov    %esp,%ebp
+  802402:	83 ec 0c             	sub    $0xc,%esp
+  802405:	ff 75 10             	push   0x10(%ebp)
+  802408:	ff 75 0c             	push   0xc(%ebp)
+  80240b:	ff 75 08             	push   0x8(%ebp)
+  80240e:	e8 34 02 00 00       	call   802647 <nsipc_socket>
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	85 c0                	test   %eax,%eax
+  802418:	78 05                	js     80241f <socket+0x20>
+  80241a:	e8 ab fe ff ff       	call   8022ca <alloc_sockfd>
+  80241f:	c9                   	leave
+  802420:	c3                   	ret
+
+00802421 <nsipc>:
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	53                   	push   %ebx
+  802425:	83 ec 04             	sub    $0x4,%esp
+  802428:	89 c3                	mov    %eax,%ebx
+  80242a:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802431:	74 1f                	je     802452 <nsipc+0x31>
+  802433:	83 ec 08             	sub    $0x8,%esp
+  802436:	6a 00                	push   $0x0
+  802438:	6a 00                	push   $0x0
+  80243a:	6a 07                	push   $0x7
+  80243c:	68 00 70 80 00       	push   $0x807000
+  802441:	53                   	push   %ebx
+  802442:	ff 35 0c 50 80 00    	push   0x80500c
+  802448:	e8 d7 09 00 00       	call   802e24 <ipc_call>
+  80244d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802450:	c9                   	leave
+  802451:	c3                   	ret
+  802452:	83 ec 0c             	sub    $0xc,%esp
+  802455:	6a 03                	push   $0x3
+  802457:	e8 63 0b 00 00       	call   802fbf <ipc_find_env>
+  80245c:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802461:	83 c4 10             	add    $0x10,%esp
+  802464:	eb cd                	jmp    802433 <nsipc+0x12>
+
+00802466 <nsipc_accept>:
+  802466:	55                   	push   %ebp
+  802467:	89 e5                	mov    %esp,%ebp
+  802469:	53                   	push   %ebx
+  80246a:	83 ec 04             	sub    $0x4,%esp
+  80246d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802470:	a3 00 70 80 00       	mov    %eax,0x807000
+  802475:	b8 01 00 00 00       	mov    $0x1,%eax
+  80247a:	e8 a2 ff ff ff       	call   802421 <nsipc>
+  80247f:	89 c3                	mov    %eax,%ebx
+  802481:	85 c0                	test   %eax,%eax
+  802483:	79 07                	jns    80248c <nsipc_accept+0x26>
+  802485:	89 d8                	mov    %ebx,%eax
+  802487:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80248a:	c9                   	leave
+  80248b:	c3                   	ret
+  80248c:	83 ec 04             	sub    $0x4,%esp
+  80248f:	ff 35 10 70 80 00    	push   0x807010
+  802495:	68 00 70 80 00       	push   $0x807000
+  80249a:	ff 75 0c             	push   0xc(%ebp)
+  80249d:	e8 4d e6 ff ff       	call   800aef <memmove>
+  8024a2:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8024a8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024ab:	89 10                	mov    %edx,(%eax)
+  8024ad:	83 c4 10             	add    $0x10,%esp
+  8024b0:	eb d3                	jmp    802485 <nsipc_accept+0x1f>
+
+008024b2 <nsipc_bind>:
+  8024b2:	55                   	push   %ebp
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	53                   	push   %ebx
+  8024b6:	83 ec 08             	sub    $0x8,%esp
+  8024b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8024bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024bf:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024c4:	53                   	push   %ebx
+  8024c5:	ff 75 0c             	push   0xc(%ebp)
+  8024c8:	68 04 70 80 00       	push   $0x807004
+  8024cd:	e8 1d e6 ff ff       	call   800aef <memmove>
+  8024d2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8024d8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024dd:	e8 3f ff ff ff       	call   802421 <nsipc>
+  8024e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+
+008024e7 <nsipc_shutdown>:
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	83 ec 08             	sub    $0x8,%esp
+  8024ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024f8:	a3 04 70 80 00       	mov    %eax,0x807004
+  8024fd:	b8 03 00 00 00       	mov    $0x3,%eax
+  802502:	e8 1a ff ff ff       	call   802421 <nsipc>
+  802507:	c9                   	leave
+  802508:	c3                   	ret
+
+00802509 <nsipc_close>:
+  802509:	55                   	push   %ebp
+  80250a:	89 e5                	mov    %esp,%ebp
+  80250c:	83 ec 08             	sub    $0x8,%esp
+  80250f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802512:	a3 00 70 80 00       	mov    %eax,0x807000
+  802517:	b8 04 00 00 00       	mov    $0x4,%eax
+  80251c:	e8 00 ff ff ff       	call   802421 <nsipc>
+  802521:	c9                   	leave
+  802522:	c3                   	ret
+
+00802523 <nsipc_connect>:
+  802523:	55                   	push   %ebp
+  802524:	89 e5                	mov    %esp,%ebp
+  802526:	53                   	push   %ebx
+  802527:	83 ec 08             	sub    $0x8,%esp
+  80252a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80252d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802530:	a3 00 70 80 00       	mov    %eax,0x807000
+  802535:	53                   	push   %ebx
+  802536:	ff 75 0c             	push   0xc(%ebp)
+  802539:	68 04 70 80 00       	push   $0x807004
+  80253e:	e8 ac e5 ff ff       	call   800aef <memmove>
+  802543:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802549:	b8 05 00 00 00       	mov    $0x5,%eax
+  80254e:	e8 ce fe ff ff       	call   802421 <nsipc>
+  802553:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802556:	c9                   	leave
+  802557:	c3                   	ret
+
+00802558 <nsipc_listen>:
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	83 ec 08             	sub    $0x8,%esp
+  80255e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802561:	a3 00 70 80 00       	mov    %eax,0x807000
+  802566:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802569:	a3 04 70 80 00       	mov    %eax,0x807004
+  80256e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802573:	e8 a9 fe ff ff       	call   802421 <nsipc>
+  802578:	c9                   	leave
+  802579:	c3                   	ret
+
+0080257a <nsipc_recv>:
+  80257a:	55                   	push   %ebp
+  80257b:	89 e5                	mov    %esp,%ebp
+  80257d:	56                   	push   %esi
+  80257e:	53                   	push   %ebx
+  80257f:	8b 75 10             	mov    0x10(%ebp),%esi
+  802582:	8b 45 08             	mov    0x8(%ebp),%eax
+  802585:	a3 00 70 80 00       	mov    %eax,0x807000
+  80258a:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802590:	8b 45 14             	mov    0x14(%ebp),%eax
+  802593:	a3 08 70 80 00       	mov    %eax,0x807008
+  802598:	b8 07 00 00 00       	mov    $0x7,%eax
+  80259d:	e8 7f fe ff ff       	call   802421 <nsipc>
+  8025a2:	89 c3                	mov    %eax,%ebx
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	78 22                	js     8025ca <nsipc_recv+0x50>
+  8025a8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025ad:	39 c6                	cmp    %eax,%esi
+  8025af:	0f 4e c6             	cmovle %esi,%eax
+  8025b2:	39 c3                	cmp    %eax,%ebx
+  8025b4:	7f 1d                	jg     8025d3 <nsipc_recv+0x59>
+  8025b6:	83 ec 04             	sub    $0x4,%esp
+  8025b9:	53                   	push   %ebx
+  8025ba:	68 00 70 80 00       	push   $0x807000
+  8025bf:	ff 75 0c             	push   0xc(%ebp)
+  8025c2:	e8 28 e5 ff ff       	call   800aef <memmove>
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	89 d8                	mov    %ebx,%eax
+  8025cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025cf:	5b                   	pop    %ebx
+  8025d0:	5e                   	pop    %esi
+  8025d1:	5d                   	pop    %ebp
+  8025d2:	c3                   	ret
+  8025d3:	68 74 36 80 00       	push   $0x803674
+  8025d8:	68 89 36 80 00       	push   $0x803689
+  8025dd:	6a 60                	push   $0x60
+  8025df:	68 9e 36 80 00       	push   $0x80369e
+  8025e4:	e8 84 db ff ff       	call   80016d <_panic>
+
+008025e9 <nsipc_send>:
+  8025e9:	55                   	push   %ebp
+  8025ea:	89 e5                	mov    %esp,%ebp
+  8025ec:	53                   	push   %ebx
+  8025ed:	83 ec 04             	sub    $0x4,%esp
+  8025f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f6:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025fb:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802601:	7f 2e                	jg     802631 <nsipc_send+0x48>
+  802603:	83 ec 04             	sub    $0x4,%esp
+  802606:	53                   	push   %ebx
+  802607:	ff 75 0c             	push   0xc(%ebp)
+  80260a:	68 0c 70 80 00       	push   $0x80700c
+  80260f:	e8 db e4 ff ff       	call   800aef <memmove>
+  802614:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80261a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80261d:	a3 08 70 80 00       	mov    %eax,0x807008
+  802622:	b8 08 00 00 00       	mov    $0x8,%eax
+  802627:	e8 f5 fd ff ff       	call   802421 <nsipc>
+  80262c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80262f:	c9                   	leave
+  802630:	c3                   	ret
+  802631:	68 aa 36 80 00       	push   $0x8036aa
+  802636:	68 89 36 80 00       	push   $0x803689
+  80263b:	6a 6b                	push   $0x6b
+  80263d:	68 9e 36 80 00       	push   $0x80369e
+  802642:	e8 26 db ff ff       	call   80016d <_panic>
+
+00802647 <nsipc_socket>:
+  802647:	55                   	push   %ebp
+  802648:	89 e5                	mov    %esp,%ebp
+  80264a:	83 ec 08             	sub    $0x8,%esp
+  80264d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802650:	a3 00 70 80 00       	mov    %eax,0x807000
+  802655:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802658:	a3 04 70 80 00       	mov    %eax,0x807004
+  80265d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802660:	a3 08 70 80 00       	mov    %eax,0x807008
+  802665:	b8 09 00 00 00       	mov    $0x9,%eax
+  80266a:	e8 b2 fd ff ff       	call   802421 <nsipc>
+  80266f:	c9                   	leave
+  802670:	c3                   	ret
+
+00802671 <devpipe_stat>:
+  802671:	55                   	push   %ebp
+  802672:	89 e5                	mov    %esp,%ebp
+  802674:	56                   	push   %esi
+  802675:	53                   	push   %ebx
+  802676:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802679:	83 ec 0c             	sub    $0xc,%esp
+  80267c:	ff 75 08             	push   0x8(%ebp)
+  80267f:	e8 99 ef ff ff       	call   80161d <fd2data>
+  802684:	89 c6                	mov    %eax,%esi
+  802686:	83 c4 08             	add    $0x8,%esp
+  802689:	68 b6 36 80 00       	push   $0x8036b6
+  80268e:	53                   	push   %ebx
+  80268f:	e8 ab e2 ff ff       	call   80093f <strcpy>
+  802694:	8b 46 04             	mov    0x4(%esi),%eax
+  802697:	2b 06                	sub    (%esi),%eax
+  802699:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80269f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026a6:	00 00 00 
+  8026a9:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8026b0:	40 80 00 
+  8026b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026bb:	5b                   	pop    %ebx
+  8026bc:	5e                   	pop    %esi
+  8026bd:	5d                   	pop    %ebp
+  8026be:	c3                   	ret
+
+008026bf <devpipe_close>:
+  8026bf:	55                   	push   %ebp
+  8026c0:	89 e5                	mov    %esp,%ebp
+  8026c2:	53                   	push   %ebx
+  8026c3:	83 ec 0c             	sub    $0xc,%esp
+  8026c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026c9:	53                   	push   %ebx
+  8026ca:	6a 00                	push   $0x0
+  8026cc:	e8 a0 e7 ff ff       	call   800e71 <sys_page_unmap>
+  8026d1:	89 1c 24             	mov    %ebx,(%esp)
+  8026d4:	e8 44 ef ff ff       	call   80161d <fd2data>
+  8026d9:	83 c4 08             	add    $0x8,%esp
+  8026dc:	50                   	push   %eax
+  8026dd:	6a 00                	push   $0x0
+  8026df:	e8 8d e7 ff ff       	call   800e71 <sys_page_unmap>
+  8026e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e7:	c9                   	leave
+  8026e8:	c3                   	ret
+
+008026e9 <_pipeisclosed>:
+  8026e9:	55                   	push   %ebp
+  8026ea:	89 e5                	mov    %esp,%ebp
+  8026ec:	57                   	push   %edi
+  8026ed:	56                   	push   %esi
+  8026ee:	53                   	push   %ebx
+  8026ef:	83 ec 1c             	sub    $0x1c,%esp
+  8026f2:	89 c7                	mov    %eax,%edi
+  8026f4:	89 d6                	mov    %edx,%esi
+  8026f6:	a1 10 50 80 00       	mov    0x805010,%eax
+  8026fb:	8b 58 58             	mov    0x58(%eax),%ebx
+  8026fe:	83 ec 0c             	sub    $0xc,%esp
+  802701:	57                   	push   %edi
+  802702:	e8 d2 08 00 00       	call   802fd9 <pageref>
+  802707:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80270a:	89 34 24             	mov    %esi,(%esp)
+  80270d:	e8 c7 08 00 00       	call   802fd9 <pageref>
+  802712:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  802718:	8b 4a 58             	mov    0x58(%edx),%ecx
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	39 cb                	cmp    %ecx,%ebx
+  802720:	74 1b                	je     80273d <_pipeisclosed+0x54>
+  802722:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802725:	75 cf                	jne    8026f6 <_pipeisclosed+0xd>
+  802727:	8b 42 58             	mov    0x58(%edx),%eax
+  80272a:	6a 01                	push   $0x1
+  80272c:	50                   	push   %eax
+  80272d:	53                   	push   %ebx
+  80272e:	68 bd 36 80 00       	push   $0x8036bd
+  802733:	e8 10 db ff ff       	call   800248 <cprintf>
+  802738:	83 c4 10             	add    $0x10,%esp
+  80273b:	eb b9                	jmp    8026f6 <_pipeisclosed+0xd>
+  80273d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802740:	0f 94 c0             	sete   %al
+  802743:	0f b6 c0             	movzbl %al,%eax
+  802746:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802749:	5b                   	pop    %ebx
+  80274a:	5e                   	pop    %esi
+  80274b:	5f                   	pop    %edi
+  80274c:	5d                   	pop    %ebp
+  80274d:	c3                   	ret
+
+0080274e <devpipe_write>:
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	57                   	push   %edi
+  802752:	56                   	push   %esi
+  802753:	53                   	push   %ebx
+  802754:	83 ec 28             	sub    $0x28,%esp
+  802757:	8b 75 08             	mov    0x8(%ebp),%esi
+  80275a:	56                   	push   %esi
+  80275b:	e8 bd ee ff ff       	call   80161d <fd2data>
+  802760:	89 c3                	mov    %eax,%ebx
+  802762:	83 c4 10             	add    $0x10,%esp
+  802765:	bf 00 00 00 00       	mov    $0x0,%edi
+  80276a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80276e:	74 5c                	je     8027cc <devpipe_write+0x7e>
+  802770:	8b 43 04             	mov    0x4(%ebx),%eax
+  802773:	8b 0b                	mov    (%ebx),%ecx
+  802775:	8d 51 20             	lea    0x20(%ecx),%edx
+  802778:	39 d0                	cmp    %edx,%eax
+  80277a:	72 1e                	jb     80279a <devpipe_write+0x4c>
+  80277c:	89 da                	mov    %ebx,%edx
+  80277e:	89 f0                	mov    %esi,%eax
+  802780:	e8 64 ff ff ff       	call   8026e9 <_pipeisclosed>
+  802785:	85 c0                	test   %eax,%eax
+  802787:	75 48                	jne    8027d1 <devpipe_write+0x83>
+  802789:	e8 c6 e5 ff ff       	call   800d54 <sys_yield>
+  80278e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802791:	8b 0b                	mov    (%ebx),%ecx
+  802793:	8d 51 20             	lea    0x20(%ecx),%edx
+  802796:	39 d0                	cmp    %edx,%eax
+  802798:	73 e2                	jae    80277c <devpipe_write+0x2e>
+  80279a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80279d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8027a1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8027a4:	89 c2                	mov    %eax,%edx
+  8027a6:	c1 fa 1f             	sar    $0x1f,%edx
+  8027a9:	89 d1                	mov    %edx,%ecx
+  8027ab:	c1 e9 1b             	shr    $0x1b,%ecx
+  8027ae:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8027b1:	83 e2 1f             	and    $0x1f,%edx
+  8027b4:	29 ca                	sub    %ecx,%edx
+  8027b6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8027ba:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8027be:	83 c0 01             	add    $0x1,%eax
+  8027c1:	89 43 04             	mov    %eax,0x4(%ebx)
+  8027c4:	83 c7 01             	add    $0x1,%edi
+  8027c7:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8027ca:	75 a4                	jne    802770 <devpipe_write+0x22>
+  8027cc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027cf:	eb 05                	jmp    8027d6 <devpipe_write+0x88>
+  8027d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d9:	5b                   	pop    %ebx
+  8027da:	5e                   	pop    %esi
+  8027db:	5f                   	pop    %edi
+  8027dc:	5d                   	pop    %ebp
+  8027dd:	c3                   	ret
+
+008027de <devpipe_read>:
+  8027de:	55                   	push   %ebp
+  8027df:	89 e5                	mov    %esp,%ebp
+  8027e1:	57                   	push   %edi
+  8027e2:	56                   	push   %esi
+  8027e3:	53                   	push   %ebx
+  8027e4:	83 ec 18             	sub    $0x18,%esp
+  8027e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027ea:	56                   	push   %esi
+  8027eb:	e8 2d ee ff ff       	call   80161d <fd2data>
+  8027f0:	89 c3                	mov    %eax,%ebx
+  8027f2:	83 c4 10             	add    $0x10,%esp
+  8027f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027fa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027fe:	74 45                	je     802845 <devpipe_read+0x67>
+  802800:	8b 03                	mov    (%ebx),%eax
+  802802:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802805:	75 1d                	jne    802824 <devpipe_read+0x46>
+  802807:	85 ff                	test   %edi,%edi
+  802809:	75 3f                	jne    80284a <devpipe_read+0x6c>
+  80280b:	89 da                	mov    %ebx,%edx
+  80280d:	89 f0                	mov    %esi,%eax
+  80280f:	e8 d5 fe ff ff       	call   8026e9 <_pipeisclosed>
+  802814:	85 c0                	test   %eax,%eax
+  802816:	75 3c                	jne    802854 <devpipe_read+0x76>
+  802818:	e8 37 e5 ff ff       	call   800d54 <sys_yield>
+  80281d:	8b 03                	mov    (%ebx),%eax
+  80281f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802822:	74 e7                	je     80280b <devpipe_read+0x2d>
+  802824:	99                   	cltd
+  802825:	c1 ea 1b             	shr    $0x1b,%edx
+  802828:	01 d0                	add    %edx,%eax
+  80282a:	83 e0 1f             	and    $0x1f,%eax
+  80282d:	29 d0                	sub    %edx,%eax
+  80282f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802834:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802837:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80283a:	83 03 01             	addl   $0x1,(%ebx)
+  80283d:	83 c7 01             	add    $0x1,%edi
+  802840:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802843:	75 bb                	jne    802800 <devpipe_read+0x22>
+  802845:	8b 45 10             	mov    0x10(%ebp),%eax
+  802848:	eb 02                	jmp    80284c <devpipe_read+0x6e>
+  80284a:	89 f8                	mov    %edi,%eax
+  80284c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80284f:	5b                   	pop    %ebx
+  802850:	5e                   	pop    %esi
+  802851:	5f                   	pop    %edi
+  802852:	5d                   	pop    %ebp
+  802853:	c3                   	ret
+  802854:	b8 00 00 00 00       	mov    $0x0,%eax
+  802859:	eb f1                	jmp    80284c <devpipe_read+0x6e>
+
+0080285b <pipe>:
+  80285b:	55                   	push   %ebp
+  80285c:	89 e5                	mov    %esp,%ebp
+  80285e:	56                   	push   %esi
+  80285f:	53                   	push   %ebx
+  802860:	83 ec 1c             	sub    $0x1c,%esp
+  802863:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802866:	50                   	push   %eax
+  802867:	e8 c8 ed ff ff       	call   801634 <fd_alloc>
+  80286c:	89 c3                	mov    %eax,%ebx
+  80286e:	83 c4 10             	add    $0x10,%esp
+  802871:	85 c0                	test   %eax,%eax
+  802873:	0f 88 23 01 00 00    	js     80299c <pipe+0x141>
+  802879:	83 ec 04             	sub    $0x4,%esp
+  80287c:	68 07 04 00 00       	push   $0x407
+  802881:	ff 75 f4             	push   -0xc(%ebp)
+  802884:	6a 00                	push   $0x0
+  802886:	e8 14 e5 ff ff       	call   800d9f <sys_page_alloc>
+  80288b:	89 c3                	mov    %eax,%ebx
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	85 c0                	test   %eax,%eax
+  802892:	0f 88 04 01 00 00    	js     80299c <pipe+0x141>
+  802898:	83 ec 0c             	sub    $0xc,%esp
+  80289b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80289e:	50                   	push   %eax
+  80289f:	e8 90 ed ff ff       	call   801634 <fd_alloc>
+  8028a4:	89 c3                	mov    %eax,%ebx
+  8028a6:	83 c4 10             	add    $0x10,%esp
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	0f 88 db 00 00 00    	js     80298c <pipe+0x131>
+  8028b1:	83 ec 04             	sub    $0x4,%esp
+  8028b4:	68 07 04 00 00       	push   $0x407
+  8028b9:	ff 75 f0             	push   -0x10(%ebp)
+  8028bc:	6a 00                	push   $0x0
+  8028be:	e8 dc e4 ff ff       	call   800d9f <sys_page_alloc>
+  8028c3:	89 c3                	mov    %eax,%ebx
+  8028c5:	83 c4 10             	add    $0x10,%esp
+  8028c8:	85 c0                	test   %eax,%eax
+  8028ca:	0f 88 bc 00 00 00    	js     80298c <pipe+0x131>
+  8028d0:	83 ec 0c             	sub    $0xc,%esp
+  8028d3:	ff 75 f4             	push   -0xc(%ebp)
+  8028d6:	e8 42 ed ff ff       	call   80161d <fd2data>
+  8028db:	89 c6                	mov    %eax,%esi
+  8028dd:	83 c4 0c             	add    $0xc,%esp
+  8028e0:	68 07 04 00 00       	push   $0x407
+  8028e5:	50                   	push   %eax
+  8028e6:	6a 00                	push   $0x0
+  8028e8:	e8 b2 e4 ff ff       	call   800d9f <sys_page_alloc>
+  8028ed:	89 c3                	mov    %eax,%ebx
+  8028ef:	83 c4 10             	add    $0x10,%esp
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	0f 88 82 00 00 00    	js     80297c <pipe+0x121>
+  8028fa:	83 ec 0c             	sub    $0xc,%esp
+  8028fd:	ff 75 f0             	push   -0x10(%ebp)
+  802900:	e8 18 ed ff ff       	call   80161d <fd2data>
+  802905:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80290c:	50                   	push   %eax
+  80290d:	6a 00                	push   $0x0
+  80290f:	56                   	push   %esi
+  802910:	6a 00                	push   $0x0
+  802912:	e8 cb e4 ff ff       	call   800de2 <sys_page_map>
+  802917:	89 c3                	mov    %eax,%ebx
+  802919:	83 c4 20             	add    $0x20,%esp
+  80291c:	85 c0                	test   %eax,%eax
+  80291e:	78 4e                	js     80296e <pipe+0x113>
+  802920:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802925:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802928:	89 02                	mov    %eax,(%edx)
+  80292a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80292d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802934:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802937:	89 02                	mov    %eax,(%edx)
+  802939:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80293c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802943:	83 ec 0c             	sub    $0xc,%esp
+  802946:	ff 75 f4             	push   -0xc(%ebp)
+  802949:	e8 bf ec ff ff       	call   80160d <fd2num>
+  80294e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802951:	89 01                	mov    %eax,(%ecx)
+  802953:	83 c4 04             	add    $0x4,%esp
+  802956:	ff 75 f0             	push   -0x10(%ebp)
+  802959:	e8 af ec ff ff       	call   80160d <fd2num>
+  80295e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802961:	89 41 04             	mov    %eax,0x4(%ecx)
+  802964:	83 c4 10             	add    $0x10,%esp
+  802967:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80296c:	eb 2e                	jmp    80299c <pipe+0x141>
+  80296e:	83 ec 08             	sub    $0x8,%esp
+  802971:	56                   	push   %esi
+  802972:	6a 00                	push   $0x0
+  802974:	e8 f8 e4 ff ff       	call   800e71 <sys_page_unmap>
+  802979:	83 c4 10             	add    $0x10,%esp
+  80297c:	83 ec 08             	sub    $0x8,%esp
+  80297f:	ff 75 f0             	push   -0x10(%ebp)
+  802982:	6a 00                	push   $0x0
+  802984:	e8 e8 e4 ff ff       	call   800e71 <sys_page_unmap>
+  802989:	83 c4 10             	add    $0x10,%esp
+  80298c:	83 ec 08             	sub    $0x8,%esp
+  80298f:	ff 75 f4             	push   -0xc(%ebp)
+  802992:	6a 00                	push   $0x0
+  802994:	e8 d8 e4 ff ff       	call   800e71 <sys_page_unmap>
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	89 d8                	mov    %ebx,%eax
+  80299e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029a1:	5b                   	pop    %ebx
+  8029a2:	5e                   	pop    %esi
+  8029a3:	5d                   	pop    %ebp
+  8029a4:	c3                   	ret
+
+008029a5 <pipeisclosed>:
+  8029a5:	55                   	push   %ebp
+  8029a6:	89 e5                	mov    %esp,%ebp
+  8029a8:	83 ec 20             	sub    $0x20,%esp
+  8029ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029ae:	50                   	push   %eax
+  8029af:	ff 75 08             	push   0x8(%ebp)
+  8029b2:	e8 cd ec ff ff       	call   801684 <fd_lookup>
+  8029b7:	83 c4 10             	add    $0x10,%esp
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	78 18                	js     8029d6 <pipeisclosed+0x31>
+  8029be:	83 ec 0c             	sub    $0xc,%esp
+  8029c1:	ff 75 f4             	push   -0xc(%ebp)
+  8029c4:	e8 54 ec ff ff       	call   80161d <fd2data>
+  8029c9:	89 c2                	mov    %eax,%edx
+  8029cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ce:	e8 16 fd ff ff       	call   8026e9 <_pipeisclosed>
+  8029d3:	83 c4 10             	add    $0x10,%esp
+  8029d6:	c9                   	leave
+  8029d7:	c3                   	ret
+
+008029d8 <ipcring_init>:
+  8029d8:	55                   	push   %ebp
+  8029d9:	89 e5                	mov    %esp,%ebp
+  8029db:	53                   	push   %ebx
+  8029dc:	83 ec 08             	sub    $0x8,%esp
+  8029df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029e2:	6a 60                	push   $0x60
+  8029e4:	6a 00                	push   $0x0
+  8029e6:	53                   	push   %ebx
+  8029e7:	e8 ce e0 ff ff       	call   800aba <memset>
+  8029ec:	a1 10 50 80 00       	mov    0x805010,%eax
+  8029f1:	8b 40 48             	mov    0x48(%eax),%eax
+  8029f4:	89 03                	mov    %eax,(%ebx)
+  8029f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029f9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8029fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029ff:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a02:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a05:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a08:	83 c4 10             	add    $0x10,%esp
+  802a0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a0e:	c9                   	leave
+  802a0f:	c3                   	ret
+
+00802a10 <ipcring_req_slot>:
+  802a10:	55                   	push   %ebp
+  802a11:	89 e5                	mov    %esp,%ebp
+  802a13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a16:	8b 50 10             	mov    0x10(%eax),%edx
+  802a19:	8b 48 18             	mov    0x18(%eax),%ecx
+  802a1c:	29 ca                	sub    %ecx,%edx
+  802a1e:	83 fa 07             	cmp    $0x7,%edx
+  802a21:	77 0c                	ja     802a2f <ipcring_req_slot+0x1f>
+  802a23:	8b 50 10             	mov    0x10(%eax),%edx
+  802a26:	83 e2 07             	and    $0x7,%edx
+  802a29:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802a2d:	5d                   	pop    %ebp
+  802a2e:	c3                   	ret
+  802a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a34:	eb f7                	jmp    802a2d <ipcring_req_slot+0x1d>
+
+00802a36 <ipcring_req_push>:
+  802a36:	55                   	push   %ebp
+  802a37:	89 e5                	mov    %esp,%ebp
+  802a39:	83 ec 08             	sub    $0x8,%esp
+  802a3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a3f:	8b 42 10             	mov    0x10(%edx),%eax
+  802a42:	83 c0 01             	add    $0x1,%eax
+  802a45:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802a49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4e:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	75 02                	jne    802a58 <ipcring_req_push+0x22>
+  802a56:	c9                   	leave
+  802a57:	c3                   	ret
+  802a58:	6a 00                	push   $0x0
+  802a5a:	68 00 00 80 ee       	push   $0xee800000
+  802a5f:	ff 72 08             	push   0x8(%edx)
+  802a62:	ff 72 04             	push   0x4(%edx)
+  802a65:	e8 6d e6 ff ff       	call   8010d7 <sys_ipc_send>
+  802a6a:	83 c4 10             	add    $0x10,%esp
+  802a6d:	eb e7                	jmp    802a56 <ipcring_req_push+0x20>
+
+00802a6f <ipcring_rsp_wait>:
+  802a6f:	55                   	push   %ebp
+  802a70:	89 e5                	mov    %esp,%ebp
+  802a72:	53                   	push   %ebx
+  802a73:	83 ec 04             	sub    $0x4,%esp
+  802a76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a79:	8b 53 18             	mov    0x18(%ebx),%edx
+  802a7c:	8b 43 10             	mov    0x10(%ebx),%eax
+  802a7f:	39 c2                	cmp    %eax,%edx
+  802a81:	74 3c                	je     802abf <ipcring_rsp_wait+0x50>
+  802a83:	8b 53 14             	mov    0x14(%ebx),%edx
+  802a86:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a89:	39 c2                	cmp    %eax,%edx
+  802a8b:	75 23                	jne    802ab0 <ipcring_rsp_wait+0x41>
+  802a8d:	83 ec 08             	sub    $0x8,%esp
+  802a90:	6a 00                	push   $0x0
+  802a92:	6a 00                	push   $0x0
+  802a94:	6a 00                	push   $0x0
+  802a96:	6a 00                	push   $0x0
+  802a98:	ff 73 0c             	push   0xc(%ebx)
+  802a9b:	ff 73 04             	push   0x4(%ebx)
+  802a9e:	e8 81 03 00 00       	call   802e24 <ipc_call>
+  802aa3:	8b 53 14             	mov    0x14(%ebx),%edx
+  802aa6:	8b 43 18             	mov    0x18(%ebx),%eax
+  802aa9:	83 c4 20             	add    $0x20,%esp
+  802aac:	39 c2                	cmp    %eax,%edx
+  802aae:	74 dd                	je     802a8d <ipcring_rsp_wait+0x1e>
+  802ab0:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ab3:	83 e0 07             	and    $0x7,%eax
+  802ab6:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802aba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802abd:	c9                   	leave
+  802abe:	c3                   	ret
+  802abf:	68 d8 36 80 00       	push   $0x8036d8
+  802ac4:	68 89 36 80 00       	push   $0x803689
+  802ac9:	6a 3b                	push   $0x3b
+  802acb:	68 f9 36 80 00       	push   $0x8036f9
+  802ad0:	e8 98 d6 ff ff       	call   80016d <_panic>
+
+00802ad5 <ipcring_rsp_pop>:
+  802ad5:	55                   	push   %ebp
+  802ad6:	89 e5                	mov    %esp,%ebp
+  802ad8:	8b 55 08             	mov    0x8(%ebp),%edx
+  802adb:	8b 42 18             	mov    0x18(%edx),%eax
+  802ade:	83 c0 01             	add    $0x1,%eax
+  802ae1:	89 42 18             	mov    %eax,0x18(%edx)
+  802ae4:	5d                   	pop    %ebp
+  802ae5:	c3                   	ret
+
+00802ae6 <ipcring_server_init>:
+  802ae6:	55                   	push   %ebp
+  802ae7:	89 e5                	mov    %esp,%ebp
+  802ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aef:	89 10                	mov    %edx,(%eax)
+  802af1:	8b 55 10             	mov    0x10(%ebp),%edx
+  802af4:	89 50 04             	mov    %edx,0x4(%eax)
+  802af7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802afe:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802b05:	5d                   	pop    %ebp
+  802b06:	c3                   	ret
+
+00802b07 <ipcring_req_avail>:
+  802b07:	55                   	push   %ebp
+  802b08:	89 e5                	mov    %esp,%ebp
+  802b0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b0d:	8b 02                	mov    (%edx),%eax
+  802b0f:	8b 40 10             	mov    0x10(%eax),%eax
+  802b12:	2b 42 08             	sub    0x8(%edx),%eax
+  802b15:	ba 08 00 00 00       	mov    $0x8,%edx
+  802b1a:	39 d0                	cmp    %edx,%eax
+  802b1c:	0f 47 c2             	cmova  %edx,%eax
+  802b1f:	5d                   	pop    %ebp
+  802b20:	c3                   	ret
+
+00802b21 <ipcring_req_peek>:
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b27:	8b 42 08             	mov    0x8(%edx),%eax
+  802b2a:	83 e0 07             	and    $0x7,%eax
+  802b2d:	8b 12                	mov    (%edx),%edx
+  802b2f:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802b33:	5d                   	pop    %ebp
+  802b34:	c3                   	ret
+
+00802b35 <ipcring_rsp_push>:
+  802b35:	55                   	push   %ebp
+  802b36:	89 e5                	mov    %esp,%ebp
+  802b38:	83 ec 08             	sub    $0x8,%esp
+  802b3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b3e:	8b 41 08             	mov    0x8(%ecx),%eax
+  802b41:	83 c0 01             	add    $0x1,%eax
+  802b44:	89 41 08             	mov    %eax,0x8(%ecx)
+  802b47:	8b 11                	mov    (%ecx),%edx
+  802b49:	83 c2 14             	add    $0x14,%edx
+  802b4c:	f0 87 02             	lock xchg %eax,(%edx)
+  802b4f:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802b53:	75 02                	jne    802b57 <ipcring_rsp_push+0x22>
+  802b55:	c9                   	leave
+  802b56:	c3                   	ret
+  802b57:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802b5e:	6a 00                	push   $0x0
+  802b60:	68 00 00 80 ee       	push   $0xee800000
+  802b65:	6a 00                	push   $0x0
+  802b67:	ff 71 04             	push   0x4(%ecx)
+  802b6a:	e8 8b e4 ff ff       	call   800ffa <sys_ipc_try_send>
+  802b6f:	83 c4 10             	add    $0x10,%esp
+  802b72:	eb e1                	jmp    802b55 <ipcring_rsp_push+0x20>
+
+00802b74 <ipcring_client_wait>:
+  802b74:	55                   	push   %ebp
+  802b75:	89 e5                	mov    %esp,%ebp
+  802b77:	83 ec 08             	sub    $0x8,%esp
+  802b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7d:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802b84:	8b 10                	mov    (%eax),%edx
+  802b86:	8b 52 18             	mov    0x18(%edx),%edx
+  802b89:	3b 50 08             	cmp    0x8(%eax),%edx
+  802b8c:	75 02                	jne    802b90 <ipcring_client_wait+0x1c>
+  802b8e:	c9                   	leave
+  802b8f:	c3                   	ret
+  802b90:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802b97:	6a 00                	push   $0x0
+  802b99:	68 00 00 80 ee       	push   $0xee800000
+  802b9e:	6a 00                	push   $0x0
+  802ba0:	ff 70 04             	push   0x4(%eax)
+  802ba3:	e8 52 e4 ff ff       	call   800ffa <sys_ipc_try_send>
+  802ba8:	83 c4 10             	add    $0x10,%esp
+  802bab:	eb e1                	jmp    802b8e <ipcring_client_wait+0x1a>
+
+00802bad <ipcring_server_sleep>:
+  802bad:	55                   	push   %ebp
+  802bae:	89 e5                	mov    %esp,%ebp
+  802bb0:	53                   	push   %ebx
+  802bb1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bb4:	8b 01                	mov    (%ecx),%eax
+  802bb6:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802bb9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bbe:	f0 87 02             	lock xchg %eax,(%edx)
+  802bc1:	8b 11                	mov    (%ecx),%edx
+  802bc3:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802bc6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bcb:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802bce:	74 0e                	je     802bde <ipcring_server_sleep+0x31>
+  802bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd5:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802be1:	c9                   	leave
+  802be2:	c3                   	ret
+
+00802be3 <devcons_close>:
+  802be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be8:	c3                   	ret
+
+00802be9 <devcons_stat>:
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	83 ec 10             	sub    $0x10,%esp
+  802bef:	68 07 37 80 00       	push   $0x803707
+  802bf4:	ff 75 0c             	push   0xc(%ebp)
+  802bf7:	e8 43 dd ff ff       	call   80093f <strcpy>
+  802bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c01:	c9                   	leave
+  802c02:	c3                   	ret
+
+00802c03 <devcons_write>:
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	57                   	push   %edi
+  802c07:	56                   	push   %esi
+  802c08:	53                   	push   %ebx
+  802c09:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802c0f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802c12:	85 ff                	test   %edi,%edi
+  802c14:	74 51                	je     802c67 <devcons_write+0x64>
+  802c16:	be 00 00 00 00       	mov    $0x0,%esi
+  802c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c20:	89 fb                	mov    %edi,%ebx
+  802c22:	29 c3                	sub    %eax,%ebx
+  802c24:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802c29:	39 d3                	cmp    %edx,%ebx
+  802c2b:	0f 47 da             	cmova  %edx,%ebx
+  802c2e:	83 ec 04             	sub    $0x4,%esp
+  802c31:	53                   	push   %ebx
+  802c32:	03 45 0c             	add    0xc(%ebp),%eax
+  802c35:	50                   	push   %eax
+  802c36:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802c3c:	50                   	push   %eax
+  802c3d:	e8 ad de ff ff       	call   800aef <memmove>
+  802c42:	83 c4 08             	add    $0x8,%esp
+  802c45:	53                   	push   %ebx
+  802c46:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802c4c:	50                   	push   %eax
+  802c4d:	e8 65 e0 ff ff       	call   800cb7 <sys_cputs>
+  802c52:	01 de                	add    %ebx,%esi
+  802c54:	89 f0                	mov    %esi,%eax
+  802c56:	83 c4 10             	add    $0x10,%esp
+  802c59:	39 fe                	cmp    %edi,%esi
+  802c5b:	72 c3                	jb     802c20 <devcons_write+0x1d>
+  802c5d:	89 f0                	mov    %esi,%eax
+  802c5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c62:	5b                   	pop    %ebx
+  802c63:	5e                   	pop    %esi
+  802c64:	5f                   	pop    %edi
+  802c65:	5d                   	pop    %ebp
+  802c66:	c3                   	ret
+  802c67:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6c:	eb ef                	jmp    802c5d <devcons_write+0x5a>
+
+00802c6e <devcons_read>:
+  802c6e:	55                   	push   %ebp
+  802c6f:	89 e5                	mov    %esp,%ebp
+  802c71:	83 ec 08             	sub    $0x8,%esp
+  802c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c79:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c7d:	75 07                	jne    802c86 <devcons_read+0x18>
+  802c7f:	eb 1f                	jmp    802ca0 <devcons_read+0x32>
+  802c81:	e8 ce e0 ff ff       	call   800d54 <sys_yield>
+  802c86:	e8 4a e0 ff ff       	call   800cd5 <sys_cgetc>
+  802c8b:	85 c0                	test   %eax,%eax
+  802c8d:	74 f2                	je     802c81 <devcons_read+0x13>
+  802c8f:	78 0f                	js     802ca0 <devcons_read+0x32>
+  802c91:	83 f8 04             	cmp    $0x4,%eax
+  802c94:	74 0c                	je     802ca2 <devcons_read+0x34>
+  802c96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c99:	88 02                	mov    %al,(%edx)
+  802c9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ca0:	c9                   	leave
+  802ca1:	c3                   	ret
+  802ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca7:	eb f7                	jmp    802ca0 <devcons_read+0x32>
+
+00802ca9 <cputchar>:
+  802ca9:	55                   	push   %ebp
+  802caa:	89 e5                	mov    %esp,%ebp
+  802cac:	83 ec 20             	sub    $0x20,%esp
+  802caf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb2:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802cb5:	6a 01                	push   $0x1
+  802cb7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cba:	50                   	push   %eax
+  802cbb:	e8 f7 df ff ff       	call   800cb7 <sys_cputs>
+  802cc0:	83 c4 10             	add    $0x10,%esp
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+
+00802cc5 <getchar>:
+  802cc5:	55                   	push   %ebp
+  802cc6:	89 e5                	mov    %esp,%ebp
+  802cc8:	83 ec 1c             	sub    $0x1c,%esp
+  802ccb:	6a 01                	push   $0x1
+  802ccd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cd0:	50                   	push   %eax
+  802cd1:	6a 00                	push   $0x0
+  802cd3:	e8 0e ec ff ff       	call   8018e6 <read>
+  802cd8:	83 c4 10             	add    $0x10,%esp
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	78 06                	js     802ce5 <getchar+0x20>
+  802cdf:	74 06                	je     802ce7 <getchar+0x22>
+  802ce1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802ce5:	c9                   	leave
+  802ce6:	c3                   	ret
+  802ce7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cec:	eb f7                	jmp    802ce5 <getchar+0x20>
+
+00802cee <iscons>:
+  802cee:	55                   	push   %ebp
+  802cef:	89 e5                	mov    %esp,%ebp
+  802cf1:	83 ec 20             	sub    $0x20,%esp
+  802cf4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cf7:	50                   	push   %eax
+  802cf8:	ff 75 08             	push   0x8(%ebp)
+  802cfb:	e8 84 e9 ff ff       	call   801684 <fd_lookup>
+  802d00:	83 c4 10             	add    $0x10,%esp
+  802d03:	85 c0                	test   %eax,%eax
+  802d05:	78 11                	js     802d18 <iscons+0x2a>
+  802d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d0a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802d10:	39 10                	cmp    %edx,(%eax)
+  802d12:	0f 94 c0             	sete   %al
+  802d15:	0f b6 c0             	movzbl %al,%eax
+  802d18:	c9                   	leave
+  802d19:	c3                   	ret
+
+00802d1a <opencons>:
+  802d1a:	55                   	push   %ebp
+  802d1b:	89 e5                	mov    %esp,%ebp
+  802d1d:	83 ec 24             	sub    $0x24,%esp
+  802d20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d23:	50                   	push   %eax
+  802d24:	e8 0b e9 ff ff       	call   801634 <fd_alloc>
+  802d29:	83 c4 10             	add    $0x10,%esp
+  802d2c:	85 c0                	test   %eax,%eax
+  802d2e:	78 3a                	js     802d6a <opencons+0x50>
+  802d30:	83 ec 04             	sub    $0x4,%esp
+  802d33:	68 07 04 00 00       	push   $0x407
+  802d38:	ff 75 f4             	push   -0xc(%ebp)
+  802d3b:	6a 00                	push   $0x0
+  802d3d:	e8 5d e0 ff ff       	call   800d9f <sys_page_alloc>
+  802d42:	83 c4 10             	add    $0x10,%esp
+  802d45:	85 c0                	test   %eax,%eax
+  802d47:	78 21                	js     802d6a <opencons+0x50>
+  802d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d4c:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802d52:	89 10                	mov    %edx,(%eax)
+  802d54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d57:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802d5e:	83 ec 0c             	sub    $0xc,%esp
+  802d61:	50                   	push   %eax
+  802d62:	e8 a6 e8 ff ff       	call   80160d <fd2num>
+  802d67:	83 c4 10             	add    $0x10,%esp
+  802d6a:	c9                   	leave
+  802d6b:	c3                   	ret
+
+00802d6c <ipc_recv>:
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	56                   	push   %esi
+  802d70:	53                   	push   %ebx
+  802d71:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d7a:	85 c0                	test   %eax,%eax
+  802d7c:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802d81:	0f 44 c2             	cmove  %edx,%eax
+  802d84:	83 ec 0c             	sub    $0xc,%esp
+  802d87:	50                   	push   %eax
+  802d88:	e8 bd e2 ff ff       	call   80104a <sys_ipc_recv>
+  802d8d:	83 c4 10             	add    $0x10,%esp
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	78 2a                	js     802dbe <ipc_recv+0x52>
+  802d94:	a1 10 50 80 00       	mov    0x805010,%eax
+  802d99:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802d9f:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802da5:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802dab:	85 f6                	test   %esi,%esi
+  802dad:	74 02                	je     802db1 <ipc_recv+0x45>
+  802daf:	89 0e                	mov    %ecx,(%esi)
+  802db1:	85 db                	test   %ebx,%ebx
+  802db3:	74 02                	je     802db7 <ipc_recv+0x4b>
+  802db5:	89 13                	mov    %edx,(%ebx)
+  802db7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dba:	5b                   	pop    %ebx
+  802dbb:	5e                   	pop    %esi
+  802dbc:	5d                   	pop    %ebp
+  802dbd:	c3                   	ret
+  802dbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dc8:	eb e1                	jmp    802dab <ipc_recv+0x3f>
+
+00802dca <ipc_send>:
+  802dca:	55                   	push   %ebp
+  802dcb:	89 e5                	mov    %esp,%ebp
+  802dcd:	57                   	push   %edi
+  802dce:	56                   	push   %esi
+  802dcf:	53                   	push   %ebx
+  802dd0:	83 ec 0c             	sub    $0xc,%esp
+  802dd3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802dd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dd9:	8b 75 14             	mov    0x14(%ebp),%esi
+  802ddc:	85 db                	test   %ebx,%ebx
+  802dde:	74 1e                	je     802dfe <ipc_send+0x34>
+  802de0:	56                   	push   %esi
+  802de1:	53                   	push   %ebx
+  802de2:	57                   	push   %edi
+  802de3:	ff 75 08             	push   0x8(%ebp)
+  802de6:	e8 ec e2 ff ff       	call   8010d7 <sys_ipc_send>
+  802deb:	83 c4 10             	add    $0x10,%esp
+  802dee:	85 c0                	test   %eax,%eax
+  802df0:	74 2a                	je     802e1c <ipc_send+0x52>
+  802df2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802df5:	75 13                	jne    802e0a <ipc_send+0x40>
+  802df7:	e8 58 df ff ff       	call   800d54 <sys_yield>
+  802dfc:	eb e2                	jmp    802de0 <ipc_send+0x16>
+  802dfe:	be 00 00 00 00       	mov    $0x0,%esi
+  802e03:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802e08:	eb d6                	jmp    802de0 <ipc_send+0x16>
+  802e0a:	50                   	push   %eax
+  802e0b:	68 14 37 80 00       	push   $0x803714
+  802e10:	6a 4f                	push   $0x4f
+  802e12:	68 57 37 80 00       	push   $0x803757
+  802e17:	e8 51 d3 ff ff       	call   80016d <_panic>
+  802e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e1f:	5b                   	pop    %ebx
+  802e20:	5e                   	pop    %esi
+  802e21:	5f                   	pop    %edi
+  802e22:	5d                   	pop    %ebp
+  802e23:	c3                   	ret
+
+00802e24 <ipc_call>:
+  802e24:	55                   	push   %ebp
+  802e25:	89 e5                	mov    %esp,%ebp
+  802e27:	57                   	push   %edi
+  802e28:	56                   	push   %esi
+  802e29:	53                   	push   %ebx
+  802e2a:	83 ec 0c             	sub    $0xc,%esp
+  802e2d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e31:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802e36:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802e3a:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802e3e:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802e43:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802e47:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e50:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802e54:	eb 05                	jmp    802e5b <ipc_call+0x37>
+  802e56:	e8 f9 de ff ff       	call   800d54 <sys_yield>
+  802e5b:	83 ec 0c             	sub    $0xc,%esp
+  802e5e:	56                   	push   %esi
+  802e5f:	53                   	push   %ebx
+  802e60:	57                   	push   %edi
+  802e61:	ff 75 0c             	push   0xc(%ebp)
+  802e64:	ff 75 08             	push   0x8(%ebp)
+  802e67:	e8 bb e2 ff ff       	call   801127 <sys_ipc_call>
+  802e6c:	83 c4 20             	add    $0x20,%esp
+  802e6f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e72:	74 e2                	je     802e56 <ipc_call+0x32>
+  802e74:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802e77:	74 2d                	je     802ea6 <ipc_call+0x82>
+  802e79:	85 c0                	test   %eax,%eax
+  802e7b:	78 4f                	js     802ecc <ipc_call+0xa8>
+  802e7d:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802e81:	74 10                	je     802e93 <ipc_call+0x6f>
+  802e83:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e88:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e8e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802e91:	89 02                	mov    %eax,(%edx)
+  802e93:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e98:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea1:	5b                   	pop    %ebx
+  802ea2:	5e                   	pop    %esi
+  802ea3:	5f                   	pop    %edi
+  802ea4:	5d                   	pop    %ebp
+  802ea5:	c3                   	ret
+  802ea6:	ff 75 14             	push   0x14(%ebp)
+  802ea9:	ff 75 10             	push   0x10(%ebp)
+  802eac:	ff 75 0c             	push   0xc(%ebp)
+  802eaf:	ff 75 08             	push   0x8(%ebp)
+  802eb2:	e8 13 ff ff ff       	call   802dca <ipc_send>
+  802eb7:	83 c4 0c             	add    $0xc,%esp
+  802eba:	ff 75 1c             	push   0x1c(%ebp)
+  802ebd:	ff 75 18             	push   0x18(%ebp)
+  802ec0:	6a 00                	push   $0x0
+  802ec2:	e8 a5 fe ff ff       	call   802d6c <ipc_recv>
+  802ec7:	83 c4 10             	add    $0x10,%esp
+  802eca:	eb d2                	jmp    802e9e <ipc_call+0x7a>
+  802ecc:	50                   	push   %eax
+  802ecd:	68 61 37 80 00       	push   $0x803761
+  802ed2:	6a 6d                	push   $0x6d
+  802ed4:	68 57 37 80 00       	push   $0x803757
+  802ed9:	e8 8f d2 ff ff       	call   80016d <_panic>
+
+00802ede <ipc_reply_recv>:
+  802ede:	55                   	push   %ebp
+  802edf:	89 e5                	mov    %esp,%ebp
+  802ee1:	57                   	push   %edi
+  802ee2:	56                   	push   %esi
+  802ee3:	53                   	push   %ebx
+  802ee4:	83 ec 0c             	sub    $0xc,%esp
+  802ee7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802eea:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802eed:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802ef0:	85 db                	test   %ebx,%ebx
+  802ef2:	0f 84 ac 00 00 00    	je     802fa4 <ipc_reply_recv+0xc6>
+  802ef8:	85 f6                	test   %esi,%esi
+  802efa:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802eff:	0f 45 c6             	cmovne %esi,%eax
+  802f02:	83 ec 0c             	sub    $0xc,%esp
+  802f05:	50                   	push   %eax
+  802f06:	ff 75 14             	push   0x14(%ebp)
+  802f09:	53                   	push   %ebx
+  802f0a:	ff 75 0c             	push   0xc(%ebp)
+  802f0d:	ff 75 08             	push   0x8(%ebp)
+  802f10:	e8 33 e2 ff ff       	call   801148 <sys_ipc_reply_recv>
+  802f15:	83 c4 20             	add    $0x20,%esp
+  802f18:	85 c0                	test   %eax,%eax
+  802f1a:	78 3a                	js     802f56 <ipc_reply_recv+0x78>
+  802f1c:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f20:	74 10                	je     802f32 <ipc_reply_recv+0x54>
+  802f22:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f27:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802f2d:	8b 55 18             	mov    0x18(%ebp),%edx
+  802f30:	89 02                	mov    %eax,(%edx)
+  802f32:	85 ff                	test   %edi,%edi
+  802f34:	74 0d                	je     802f43 <ipc_reply_recv+0x65>
+  802f36:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f3b:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f41:	89 07                	mov    %eax,(%edi)
+  802f43:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f48:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f51:	5b                   	pop    %ebx
+  802f52:	5e                   	pop    %esi
+  802f53:	5f                   	pop    %edi
+  802f54:	5d                   	pop    %ebp
+  802f55:	c3                   	ret
+  802f56:	ff 75 14             	push   0x14(%ebp)
+  802f59:	53                   	push   %ebx
+  802f5a:	ff 75 0c             	push   0xc(%ebp)
+  802f5d:	ff 75 08             	push   0x8(%ebp)
+  802f60:	e8 95 e0 ff ff       	call   800ffa <sys_ipc_try_send>
+  802f65:	89 c2                	mov    %eax,%edx
+  802f67:	c1 ea 1f             	shr    $0x1f,%edx
+  802f6a:	83 c4 10             	add    $0x10,%esp
+  802f6d:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802f70:	0f 95 c1             	setne  %cl
+  802f73:	84 d1                	test   %dl,%cl
+  802f75:	74 05                	je     802f7c <ipc_reply_recv+0x9e>
+  802f77:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f7a:	75 12                	jne    802f8e <ipc_reply_recv+0xb0>
+  802f7c:	83 ec 04             	sub    $0x4,%esp
+  802f7f:	57                   	push   %edi
+  802f80:	56                   	push   %esi
+  802f81:	ff 75 18             	push   0x18(%ebp)
+  802f84:	e8 e3 fd ff ff       	call   802d6c <ipc_recv>
+  802f89:	83 c4 10             	add    $0x10,%esp
+  802f8c:	eb c0                	jmp    802f4e <ipc_reply_recv+0x70>
+  802f8e:	83 ec 04             	sub    $0x4,%esp
+  802f91:	50                   	push   %eax
+  802f92:	ff 75 08             	push   0x8(%ebp)
+  802f95:	68 34 37 80 00       	push   $0x803734
+  802f9a:	e8 a9 d2 ff ff       	call   800248 <cprintf>
+  802f9f:	83 c4 10             	add    $0x10,%esp
+  802fa2:	eb d8                	jmp    802f7c <ipc_reply_recv+0x9e>
+  802fa4:	85 f6                	test   %esi,%esi
+  802fa6:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802fab:	0f 45 c6             	cmovne %esi,%eax
+  802fae:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802fb3:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802fba:	e9 43 ff ff ff       	jmp    802f02 <ipc_reply_recv+0x24>
+
+00802fbf <ipc_find_env>:
+  802fbf:	55                   	push   %ebp
+  802fc0:	89 e5                	mov    %esp,%ebp
+  802fc2:	83 ec 14             	sub    $0x14,%esp
+  802fc5:	ff 75 08             	push   0x8(%ebp)
+  802fc8:	e8 cb df ff ff       	call   800f98 <sys_env_service>
+  802fcd:	85 c0                	test   %eax,%eax
+  802fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd4:	0f 48 c2             	cmovs  %edx,%eax
+  802fd7:	c9                   	leave
+  802fd8:	c3                   	ret
+
+00802fd9 <pageref>:
+  802fd9:	55                   	push   %ebp
+  802fda:	89 e5                	mov    %esp,%ebp
+  802fdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fdf:	89 c2                	mov    %eax,%edx
+  802fe1:	c1 ea 16             	shr    $0x16,%edx
+  802fe4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802feb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff0:	f6 c1 01             	test   $0x1,%cl
+  802ff3:	74 22                	je     803017 <pageref+0x3e>
+  802ff5:	c1 e8 0c             	shr    $0xc,%eax
+  802ff8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fff:	a8 01                	test   $0x1,%al
+  803001:	74 14                	je     803017 <pageref+0x3e>
+  803003:	c1 e8 0c             	shr    $0xc,%eax
+  803006:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803009:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803010:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803014:	0f b7 d2             	movzwl %dx,%edx
+  803017:	89 d0                	mov    %edx,%eax
+  803019:	5d                   	pop    %ebp
+  80301a:	c3                   	ret
+
+0080301b <__udivmoddi4>:
+  80301b:	55                   	push   %ebp
+  80301c:	57                   	push   %edi
+  80301d:	56                   	push   %esi
+  80301e:	53                   	push   %ebx
+  80301f:	83 ec 24             	sub    $0x24,%esp
+  803022:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803026:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80302a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80302e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803032:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803036:	8b 54 24 44          	mov    0x44(%esp),%edx
+  80303a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80303e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803042:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803050:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803055:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80305c:	00 
+  80305d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803064:	00 
+  803065:	89 fb                	mov    %edi,%ebx
+  803067:	eb 08                	jmp    803071 <__udivmoddi4+0x56>
+  803069:	83 e9 01             	sub    $0x1,%ecx
+  80306c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80306f:	74 68                	je     8030d9 <__udivmoddi4+0xbe>
+  803071:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803075:	01 c0                	add    %eax,%eax
+  803077:	89 c6                	mov    %eax,%esi
+  803079:	89 d7                	mov    %edx,%edi
+  80307b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80307f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803083:	0f ad d0             	shrd   %cl,%edx,%eax
+  803086:	d3 ea                	shr    %cl,%edx
+  803088:	f6 c1 20             	test   $0x20,%cl
+  80308b:	74 04                	je     803091 <__udivmoddi4+0x76>
+  80308d:	89 d0                	mov    %edx,%eax
+  80308f:	31 d2                	xor    %edx,%edx
+  803091:	83 e0 01             	and    $0x1,%eax
+  803094:	89 04 24             	mov    %eax,(%esp)
+  803097:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80309e:	00 
+  80309f:	8b 04 24             	mov    (%esp),%eax
+  8030a2:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8030a6:	09 f0                	or     %esi,%eax
+  8030a8:	09 fa                	or     %edi,%edx
+  8030aa:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8030ae:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8030b2:	39 f0                	cmp    %esi,%eax
+  8030b4:	89 d5                	mov    %edx,%ebp
+  8030b6:	19 fd                	sbb    %edi,%ebp
+  8030b8:	72 af                	jb     803069 <__udivmoddi4+0x4e>
+  8030ba:	29 f0                	sub    %esi,%eax
+  8030bc:	19 fa                	sbb    %edi,%edx
+  8030be:	89 cf                	mov    %ecx,%edi
+  8030c0:	c1 ef 05             	shr    $0x5,%edi
+  8030c3:	83 e7 01             	and    $0x1,%edi
+  8030c6:	89 fe                	mov    %edi,%esi
+  8030c8:	83 f6 01             	xor    $0x1,%esi
+  8030cb:	d3 e6                	shl    %cl,%esi
+  8030cd:	d3 e7                	shl    %cl,%edi
+  8030cf:	09 74 24 18          	or     %esi,0x18(%esp)
+  8030d3:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8030d7:	eb 90                	jmp    803069 <__udivmoddi4+0x4e>
+  8030d9:	85 db                	test   %ebx,%ebx
+  8030db:	74 05                	je     8030e2 <__udivmoddi4+0xc7>
+  8030dd:	89 03                	mov    %eax,(%ebx)
+  8030df:	89 53 04             	mov    %edx,0x4(%ebx)
+  8030e2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8030e6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8030ea:	83 c4 24             	add    $0x24,%esp
+  8030ed:	5b                   	pop    %ebx
+  8030ee:	5e                   	pop    %esi
+  8030ef:	5f                   	pop    %edi
+  8030f0:	5d                   	pop    %ebp
+  8030f1:	c3                   	ret
+
+008030f2 <__udivdi3>:
+  8030f2:	83 ec 08             	sub    $0x8,%esp
+  8030f5:	6a 00                	push   $0x0
+  8030f7:	ff 74 24 1c          	push   0x1c(%esp)
+  8030fb:	ff 74 24 1c          	push   0x1c(%esp)
+  8030ff:	ff 74 24 1c          	push   0x1c(%esp)
+  803103:	ff 74 24 1c          	push   0x1c(%esp)
+  803107:	e8 0f ff ff ff       	call   80301b <__udivmoddi4>
+  80310c:	83 c4 1c             	add    $0x1c,%esp
+  80310f:	c3                   	ret
+
+00803110 <__umoddi3>:
+  803110:	83 ec 18             	sub    $0x18,%esp
+  803113:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803117:	50                   	push   %eax
+  803118:	ff 74 24 2c          	push   0x2c(%esp)
+  80311c:	ff 74 24 2c          	push   0x2c(%esp)
+  803120:	ff 74 24 2c          	push   0x2c(%esp)
+  803124:	ff 74 24 2c          	push   0x2c(%esp)
+  803128:	e8 ee fe ff ff       	call   80301b <__udivmoddi4>
+  80312d:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803131:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803135:	83 c4 2c             	add    $0x2c,%esp
+  803138:	c3                   	ret
+
+00803139 <__divdi3>:
+  803139:	53                   	push   %ebx
+  80313a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80313e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803142:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803146:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80314a:	85 d2                	test   %edx,%edx
+  80314c:	78 12                	js     803160 <__divdi3+0x27>
+  80314e:	85 db                	test   %ebx,%ebx
+  803150:	78 2e                	js     803180 <__divdi3+0x47>
+  803152:	53                   	push   %ebx
+  803153:	51                   	push   %ecx
+  803154:	52                   	push   %edx
+  803155:	50                   	push   %eax
+  803156:	e8 97 ff ff ff       	call   8030f2 <__udivdi3>
+  80315b:	83 c4 10             	add    $0x10,%esp
+  80315e:	eb 1e                	jmp    80317e <__divdi3+0x45>
+  803160:	f7 d8                	neg    %eax
+  803162:	83 d2 00             	adc    $0x0,%edx
+  803165:	f7 da                	neg    %edx
+  803167:	85 db                	test   %ebx,%ebx
+  803169:	78 2a                	js     803195 <__divdi3+0x5c>
+  80316b:	53                   	push   %ebx
+  80316c:	51                   	push   %ecx
+  80316d:	52                   	push   %edx
+  80316e:	50                   	push   %eax
+  80316f:	e8 7e ff ff ff       	call   8030f2 <__udivdi3>
+  803174:	83 c4 10             	add    $0x10,%esp
+  803177:	f7 d8                	neg    %eax
+  803179:	83 d2 00             	adc    $0x0,%edx
+  80317c:	f7 da                	neg    %edx
+  80317e:	5b                   	pop    %ebx
+  80317f:	c3                   	ret
+  803180:	f7 d9                	neg    %ecx
+  803182:	83 d3 00             	adc    $0x0,%ebx
+  803185:	f7 db                	neg    %ebx
+  803187:	53                   	push   %ebx
+  803188:	51                   	push   %ecx
+  803189:	52                   	push   %edx
+  80318a:	50                   	push   %eax
+  80318b:	e8 62 ff ff ff       	call   8030f2 <__udivdi3>
+  803190:	83 c4 10             	add    $0x10,%esp
+  803193:	eb e2                	jmp    803177 <__divdi3+0x3e>
+  803195:	f7 d9                	neg    %ecx
+  803197:	83 d3 00             	adc    $0x0,%ebx
+  80319a:	f7 db                	neg    %ebx
+  80319c:	53                   	push   %ebx
+  80319d:	51                   	push   %ecx
+  80319e:	52                   	push   %edx
+  80319f:	50                   	push   %eax
+  8031a0:	e8 4d ff ff ff       	call   8030f2 <__udivdi3>
+  8031a5:	83 c4 10             	add    $0x10,%esp
+  8031a8:	eb d4                	jmp    80317e <__divdi3+0x45>
+
+008031aa <__moddi3>:
+  8031aa:	55                   	push   %ebp
+  8031ab:	57                   	push   %edi
+  8031ac:	56                   	push   %esi
+  8031ad:	53                   	push   %ebx
+  8031ae:	83 ec 0c             	sub    $0xc,%esp
+  8031b1:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8031b5:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8031b9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031bd:	89 e9                	mov    %ebp,%ecx
+  8031bf:	f7 d9                	neg    %ecx
+  8031c1:	89 d0                	mov    %edx,%eax
+  8031c3:	83 d0 00             	adc    $0x0,%eax
+  8031c6:	f7 d8                	neg    %eax
+  8031c8:	0f 49 e9             	cmovns %ecx,%ebp
+  8031cb:	0f 49 d0             	cmovns %eax,%edx
+  8031ce:	52                   	push   %edx
+  8031cf:	55                   	push   %ebp
+  8031d0:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8031d4:	f7 da                	neg    %edx
+  8031d6:	89 d8                	mov    %ebx,%eax
+  8031d8:	83 d0 00             	adc    $0x0,%eax
+  8031db:	f7 d8                	neg    %eax
+  8031dd:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8031e2:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8031e6:	0f 48 c3             	cmovs  %ebx,%eax
+  8031e9:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8031ed:	ff 74 24 0c          	push   0xc(%esp)
+  8031f1:	ff 74 24 0c          	push   0xc(%esp)
+  8031f5:	e8 16 ff ff ff       	call   803110 <__umoddi3>
+  8031fa:	83 c4 10             	add    $0x10,%esp
+  8031fd:	85 db                	test   %ebx,%ebx
+  8031ff:	78 08                	js     803209 <__moddi3+0x5f>
+  803201:	83 c4 0c             	add    $0xc,%esp
+  803204:	5b                   	pop    %ebx
+  803205:	5e                   	pop    %esi
+  803206:	5f                   	pop    %edi
+  803207:	5d                   	pop    %ebp
+  803208:	c3                   	ret
+  803209:	f7 d8                	neg    %eax
+  80320b:	83 d2 00             	adc    $0x0,%edx
+  80320e:	f7 da                	neg    %edx
+  803210:	eb ef                	jmp    803201 <__moddi3+0x57>
@@ -0,0 +1,5571 @@
+
+obj/user/tracedump.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 37 04 00 00       	call   800468 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <flush>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 08             	sub    $0x8,%esp
+  80003a:	8b 1d 20 50 80 00    	mov    0x805020,%ebx
+  800040:	c1 e3 05             	shl    $0x5,%ebx
+  800043:	53                   	push   %ebx
+  800044:	68 60 50 80 00       	push   $0x805060
+  800049:	ff 35 24 50 80 00    	push   0x805024
+  80004f:	e8 30 1e 00 00       	call   801e84 <write>
+  800054:	83 c4 10             	add    $0x10,%esp
+  800057:	39 c3                	cmp    %eax,%ebx
+  800059:	75 1a                	jne    800075 <flush+0x42>
+  80005b:	a1 20 50 80 00       	mov    0x805020,%eax
+  800060:	01 05 68 60 80 00    	add    %eax,0x806068
+  800066:	c7 05 20 50 80 00 00 	movl   $0x0,0x805020
+  80006d:	00 00 00 
+  800070:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800073:	c9                   	leave
+  800074:	c3                   	ret
+  800075:	85 c0                	test   %eax,%eax
+  800077:	78 05                	js     80007e <flush+0x4b>
+  800079:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80007e:	50                   	push   %eax
+  80007f:	68 00 38 80 00       	push   $0x803800
+  800084:	6a 1c                	push   $0x1c
+  800086:	68 0a 38 80 00       	push   $0x80380a
+  80008b:	e8 51 04 00 00       	call   8004e1 <_panic>
+
+00800090 <drain_all>:
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	57                   	push   %edi
+  800094:	56                   	push   %esi
+  800095:	53                   	push   %ebx
+  800096:	83 ec 2c             	sub    $0x2c,%esp
+  800099:	be 00 00 00 00       	mov    $0x0,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  8000a6:	e9 e7 00 00 00       	jmp    800192 <drain_all+0x102>
+  8000ab:	83 05 6c 60 80 00 01 	addl   $0x1,0x80606c
+  8000b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b5:	8b 04 85 40 50 80 00 	mov    0x805040(,%eax,4),%eax
+  8000bc:	8d 58 01             	lea    0x1(%eax),%ebx
+  8000bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000c2:	89 1c 85 40 50 80 00 	mov    %ebx,0x805040(,%eax,4)
+  8000c9:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+  8000cc:	0f 84 ab 00 00 00    	je     80017d <drain_all+0xed>
+  8000d2:	89 d8                	mov    %ebx,%eax
+  8000d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d9:	89 c2                	mov    %eax,%edx
+  8000db:	c1 e2 05             	shl    $0x5,%edx
+  8000de:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8000e1:	01 d6                	add    %edx,%esi
+  8000e3:	8b 56 28             	mov    0x28(%esi),%edx
+  8000e6:	39 da                	cmp    %ebx,%edx
+  8000e8:	75 c1                	jne    8000ab <drain_all+0x1b>
+  8000ea:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8000f0:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8000f3:	c1 e1 05             	shl    $0x5,%ecx
+  8000f6:	89 cf                	mov    %ecx,%edi
+  8000f8:	83 c0 01             	add    $0x1,%eax
+  8000fb:	c1 e0 05             	shl    $0x5,%eax
+  8000fe:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800101:	01 c8                	add    %ecx,%eax
+  800103:	8b 08                	mov    (%eax),%ecx
+  800105:	89 8f 60 50 80 00    	mov    %ecx,0x805060(%edi)
+  80010b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80010e:	89 8f 64 50 80 00    	mov    %ecx,0x805064(%edi)
+  800114:	8b 48 08             	mov    0x8(%eax),%ecx
+  800117:	89 8f 68 50 80 00    	mov    %ecx,0x805068(%edi)
+  80011d:	8b 48 0c             	mov    0xc(%eax),%ecx
+  800120:	89 8f 6c 50 80 00    	mov    %ecx,0x80506c(%edi)
+  800126:	8b 48 10             	mov    0x10(%eax),%ecx
+  800129:	89 8f 70 50 80 00    	mov    %ecx,0x805070(%edi)
+  80012f:	8b 48 14             	mov    0x14(%eax),%ecx
+  800132:	89 8f 74 50 80 00    	mov    %ecx,0x805074(%edi)
+  800138:	8b 48 18             	mov    0x18(%eax),%ecx
+  80013b:	89 8f 78 50 80 00    	mov    %ecx,0x805078(%edi)
+  800141:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800144:	89 87 7c 50 80 00    	mov    %eax,0x80507c(%edi)
+  80014a:	8b 46 28             	mov    0x28(%esi),%eax
+  80014d:	39 d8                	cmp    %ebx,%eax
+  80014f:	75 20                	jne    800171 <drain_all+0xe1>
+  800151:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800154:	83 c0 01             	add    $0x1,%eax
+  800157:	a3 20 50 80 00       	mov    %eax,0x805020
+  80015c:	3d 80 00 00 00       	cmp    $0x80,%eax
+  800161:	0f 85 4b ff ff ff    	jne    8000b2 <drain_all+0x22>
+  800167:	e8 c7 fe ff ff       	call   800033 <flush>
+  80016c:	e9 41 ff ff ff       	jmp    8000b2 <drain_all+0x22>
+  800171:	83 05 6c 60 80 00 01 	addl   $0x1,0x80606c
+  800178:	e9 35 ff ff ff       	jmp    8000b2 <drain_all+0x22>
+  80017d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800180:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+  800184:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800187:	81 c6 20 80 00 00    	add    $0x8020,%esi
+  80018d:	83 f8 08             	cmp    $0x8,%eax
+  800190:	74 5b                	je     8001ed <drain_all+0x15d>
+  800192:	89 f0                	mov    %esi,%eax
+  800194:	03 05 00 40 80 00    	add    0x804000,%eax
+  80019a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80019d:	8b 18                	mov    (%eax),%ebx
+  80019f:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+  8001a2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8001a5:	89 cf                	mov    %ecx,%edi
+  8001a7:	89 d8                	mov    %ebx,%eax
+  8001a9:	2b 04 8d 40 50 80 00 	sub    0x805040(,%ecx,4),%eax
+  8001b0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001b5:	76 1f                	jbe    8001d6 <drain_all+0x146>
+  8001b7:	8b 15 6c 60 80 00    	mov    0x80606c,%edx
+  8001bd:	8d 84 10 00 fc ff ff 	lea    -0x400(%eax,%edx,1),%eax
+  8001c4:	a3 6c 60 80 00       	mov    %eax,0x80606c
+  8001c9:	8d 83 00 fc ff ff    	lea    -0x400(%ebx),%eax
+  8001cf:	89 04 8d 40 50 80 00 	mov    %eax,0x805040(,%ecx,4)
+  8001d6:	8b 1c bd 40 50 80 00 	mov    0x805040(,%edi,4),%ebx
+  8001dd:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+  8001e0:	74 9e                	je     800180 <drain_all+0xf0>
+  8001e2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8001e5:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  8001e8:	e9 e5 fe ff ff       	jmp    8000d2 <drain_all+0x42>
+  8001ed:	e8 41 fe ff ff       	call   800033 <flush>
+  8001f2:	83 c4 2c             	add    $0x2c,%esp
+  8001f5:	5b                   	pop    %ebx
+  8001f6:	5e                   	pop    %esi
+  8001f7:	5f                   	pop    %edi
+  8001f8:	5d                   	pop    %ebp
+  8001f9:	c3                   	ret
+
+008001fa <umain>:
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	83 ec 20             	sub    $0x20,%esp
+  800203:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800206:	c7 05 04 40 80 00 1b 	movl   $0x80381b,0x804004
+  80020d:	38 80 00 
+  800210:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800213:	50                   	push   %eax
+  800214:	57                   	push   %edi
+  800215:	8d 45 08             	lea    0x8(%ebp),%eax
+  800218:	50                   	push   %eax
+  800219:	e8 63 17 00 00       	call   801981 <argstart>
+  80021e:	83 c4 10             	add    $0x10,%esp
+  800221:	be ff 03 00 00       	mov    $0x3ff,%esi
+  800226:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800229:	eb 1b                	jmp    800246 <umain+0x4c>
+  80022b:	83 ec 0c             	sub    $0xc,%esp
+  80022e:	53                   	push   %ebx
+  80022f:	e8 7c 18 00 00       	call   801ab0 <argvalue>
+  800234:	83 c4 0c             	add    $0xc,%esp
+  800237:	6a 00                	push   $0x0
+  800239:	6a 00                	push   $0x0
+  80023b:	50                   	push   %eax
+  80023c:	e8 05 0d 00 00       	call   800f46 <strtol>
+  800241:	89 c6                	mov    %eax,%esi
+  800243:	83 c4 10             	add    $0x10,%esp
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	53                   	push   %ebx
+  80024a:	e8 62 17 00 00       	call   8019b1 <argnext>
+  80024f:	83 c4 10             	add    $0x10,%esp
+  800252:	85 c0                	test   %eax,%eax
+  800254:	78 1c                	js     800272 <umain+0x78>
+  800256:	83 f8 6d             	cmp    $0x6d,%eax
+  800259:	74 d0                	je     80022b <umain+0x31>
+  80025b:	83 ec 0c             	sub    $0xc,%esp
+  80025e:	68 54 38 80 00       	push   $0x803854
+  800263:	e8 6f 25 00 00       	call   8027d7 <printf>
+  800268:	e8 44 02 00 00       	call   8004b1 <exit>
+  80026d:	83 c4 10             	add    $0x10,%esp
+  800270:	eb d4                	jmp    800246 <umain+0x4c>
+  800272:	8b 45 08             	mov    0x8(%ebp),%eax
+  800275:	83 e8 02             	sub    $0x2,%eax
+  800278:	83 f8 01             	cmp    $0x1,%eax
+  80027b:	0f 87 cf 00 00 00    	ja     800350 <umain+0x156>
+  800281:	83 ec 08             	sub    $0x8,%esp
+  800284:	68 01 03 00 00       	push   $0x301
+  800289:	ff 77 04             	push   0x4(%edi)
+  80028c:	e8 d5 22 00 00       	call   802566 <open>
+  800291:	a3 24 50 80 00       	mov    %eax,0x805024
+  800296:	83 c4 10             	add    $0x10,%esp
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	0f 88 c9 00 00 00    	js     80036a <umain+0x170>
+  8002a1:	c7 05 60 60 80 00 4a 	movl   $0x4352544a,0x806060
+  8002a8:	54 52 43 
+  8002ab:	66 c7 05 64 60 80 00 	movw   $0x1,0x806064
+  8002b2:	01 00 
+  8002b4:	66 c7 05 66 60 80 00 	movw   $0x20,0x806066
+  8002bb:	20 00 
+  8002bd:	83 ec 04             	sub    $0x4,%esp
+  8002c0:	6a 28                	push   $0x28
+  8002c2:	68 60 60 80 00       	push   $0x806060
+  8002c7:	50                   	push   %eax
+  8002c8:	e8 b7 1b 00 00       	call   801e84 <write>
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	83 f8 28             	cmp    $0x28,%eax
+  8002d3:	0f 85 a9 00 00 00    	jne    800382 <umain+0x188>
+  8002d9:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  8002df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e4:	8b 0a                	mov    (%edx),%ecx
+  8002e6:	89 0c 85 40 50 80 00 	mov    %ecx,0x805040(,%eax,4)
+  8002ed:	83 c0 01             	add    $0x1,%eax
+  8002f0:	81 c2 20 80 00 00    	add    $0x8020,%edx
+  8002f6:	83 f8 08             	cmp    $0x8,%eax
+  8002f9:	75 e9                	jne    8002e4 <umain+0xea>
+  8002fb:	83 ec 0c             	sub    $0xc,%esp
+  8002fe:	56                   	push   %esi
+  8002ff:	e8 d8 15 00 00       	call   8018dc <sys_trace>
+  800304:	89 c3                	mov    %eax,%ebx
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	85 c0                	test   %eax,%eax
+  80030b:	0f 88 8c 00 00 00    	js     80039d <umain+0x1a3>
+  800311:	e8 c7 11 00 00       	call   8014dd <sys_time_msec>
+  800316:	89 c6                	mov    %eax,%esi
+  800318:	a3 80 60 80 00       	mov    %eax,0x806080
+  80031d:	0f 31                	rdtsc
+  80031f:	a3 70 60 80 00       	mov    %eax,0x806070
+  800324:	89 15 74 60 80 00    	mov    %edx,0x806074
+  80032a:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+  80032f:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+  800333:	74 7a                	je     8003af <umain+0x1b5>
+  800335:	01 c6                	add    %eax,%esi
+  800337:	e8 a1 11 00 00       	call   8014dd <sys_time_msec>
+  80033c:	39 f0                	cmp    %esi,%eax
+  80033e:	0f 83 82 00 00 00    	jae    8003c6 <umain+0x1cc>
+  800344:	e8 47 fd ff ff       	call   800090 <drain_all>
+  800349:	e8 7a 0d 00 00       	call   8010c8 <sys_yield>
+  80034e:	eb e7                	jmp    800337 <umain+0x13d>
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	68 54 38 80 00       	push   $0x803854
+  800358:	e8 7a 24 00 00       	call   8027d7 <printf>
+  80035d:	e8 4f 01 00 00       	call   8004b1 <exit>
+  800362:	83 c4 10             	add    $0x10,%esp
+  800365:	e9 17 ff ff ff       	jmp    800281 <umain+0x87>
+  80036a:	83 ec 0c             	sub    $0xc,%esp
+  80036d:	50                   	push   %eax
+  80036e:	ff 77 04             	push   0x4(%edi)
+  800371:	68 25 38 80 00       	push   $0x803825
+  800376:	6a 65                	push   $0x65
+  800378:	68 0a 38 80 00       	push   $0x80380a
+  80037d:	e8 5f 01 00 00       	call   8004e1 <_panic>
+  800382:	85 c0                	test   %eax,%eax
+  800384:	78 05                	js     80038b <umain+0x191>
+  800386:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80038b:	50                   	push   %eax
+  80038c:	68 00 38 80 00       	push   $0x803800
+  800391:	6a 6c                	push   $0x6c
+  800393:	68 0a 38 80 00       	push   $0x80380a
+  800398:	e8 44 01 00 00       	call   8004e1 <_panic>
+  80039d:	50                   	push   %eax
+  80039e:	68 31 38 80 00       	push   $0x803831
+  8003a3:	6a 73                	push   $0x73
+  8003a5:	68 0a 38 80 00       	push   $0x80380a
+  8003aa:	e8 32 01 00 00       	call   8004e1 <_panic>
+  8003af:	83 ec 04             	sub    $0x4,%esp
+  8003b2:	6a 00                	push   $0x0
+  8003b4:	6a 00                	push   $0x0
+  8003b6:	ff 77 08             	push   0x8(%edi)
+  8003b9:	e8 88 0b 00 00       	call   800f46 <strtol>
+  8003be:	83 c4 10             	add    $0x10,%esp
+  8003c1:	e9 6f ff ff ff       	jmp    800335 <umain+0x13b>
+  8003c6:	0f 31                	rdtsc
+  8003c8:	a3 78 60 80 00       	mov    %eax,0x806078
+  8003cd:	89 15 7c 60 80 00    	mov    %edx,0x80607c
+  8003d3:	e8 05 11 00 00       	call   8014dd <sys_time_msec>
+  8003d8:	a3 84 60 80 00       	mov    %eax,0x806084
+  8003dd:	83 ec 0c             	sub    $0xc,%esp
+  8003e0:	53                   	push   %ebx
+  8003e1:	e8 f6 14 00 00       	call   8018dc <sys_trace>
+  8003e6:	e8 a5 fc ff ff       	call   800090 <drain_all>
+  8003eb:	83 c4 08             	add    $0x8,%esp
+  8003ee:	6a 00                	push   $0x0
+  8003f0:	ff 35 24 50 80 00    	push   0x805024
+  8003f6:	e8 0b 1b 00 00       	call   801f06 <seek>
+  8003fb:	83 c4 0c             	add    $0xc,%esp
+  8003fe:	6a 28                	push   $0x28
+  800400:	68 60 60 80 00       	push   $0x806060
+  800405:	ff 35 24 50 80 00    	push   0x805024
+  80040b:	e8 74 1a 00 00       	call   801e84 <write>
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	83 f8 28             	cmp    $0x28,%eax
+  800416:	75 32                	jne    80044a <umain+0x250>
+  800418:	83 ec 0c             	sub    $0xc,%esp
+  80041b:	ff 35 24 50 80 00    	push   0x805024
+  800421:	e8 47 18 00 00       	call   801c6d <close>
+  800426:	83 c4 0c             	add    $0xc,%esp
+  800429:	ff 35 6c 60 80 00    	push   0x80606c
+  80042f:	ff 35 68 60 80 00    	push   0x806068
+  800435:	68 3f 38 80 00       	push   $0x80383f
+  80043a:	e8 98 23 00 00       	call   8027d7 <printf>
+  80043f:	83 c4 10             	add    $0x10,%esp
+  800442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800445:	5b                   	pop    %ebx
+  800446:	5e                   	pop    %esi
+  800447:	5f                   	pop    %edi
+  800448:	5d                   	pop    %ebp
+  800449:	c3                   	ret
+  80044a:	85 c0                	test   %eax,%eax
+  80044c:	78 05                	js     800453 <umain+0x259>
+  80044e:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  800453:	50                   	push   %eax
+  800454:	68 00 38 80 00       	push   $0x803800
+  800459:	68 84 00 00 00       	push   $0x84
+  80045e:	68 0a 38 80 00       	push   $0x80380a
+  800463:	e8 79 00 00 00       	call   8004e1 <_panic>
+
+00800468 <libmain>:
+  800468:	55                   	push   %ebp
+  800469:	89 e5                	mov    %esp,%ebp
+  80046b:	56                   	push   %esi
+  80046c:	53                   	push   %ebx
+  80046d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800470:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800473:	e8 31 0c 00 00       	call   8010a9 <sys_getenvid>
+  800478:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80047d:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  800483:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800488:	a3 88 60 80 00       	mov    %eax,0x806088
+  80048d:	85 db                	test   %ebx,%ebx
+  80048f:	7e 07                	jle    800498 <libmain+0x30>
+  800491:	8b 06                	mov    (%esi),%eax
+  800493:	a3 04 40 80 00       	mov    %eax,0x804004
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	56                   	push   %esi
+  80049c:	53                   	push   %ebx
+  80049d:	e8 58 fd ff ff       	call   8001fa <umain>
+  8004a2:	e8 0a 00 00 00       	call   8004b1 <exit>
+  8004a7:	83 c4 10             	add    $0x10,%esp
+  8004aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004ad:	5b                   	pop    %ebx
+  8004ae:	5e                   	pop    %esi
+  8004af:	5d                   	pop    %ebp
+  8004b0:	c3                   	ret
+
+008004b1 <exit>:
+  8004b1:	55                   	push   %ebp
+  8004b2:	89 e5                	mov    %esp,%ebp
+  8004b4:	83 ec 08             	sub    $0x8,%esp
+  8004b7:	a1 88 60 80 00       	mov    0x806088,%eax
+  8004bc:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8004c2:	85 c0                	test   %eax,%eax
+  8004c4:	75 14                	jne    8004da <exit+0x29>
+  8004c6:	e8 cf 17 00 00       	call   801c9a <close_all>
+  8004cb:	83 ec 0c             	sub    $0xc,%esp
+  8004ce:	6a 00                	push   $0x0
+  8004d0:	e8 93 0b 00 00       	call   801068 <sys_env_destroy>
+  8004d5:	83 c4 10             	add    $0x10,%esp
+  8004d8:	c9                   	leave
+  8004d9:	c3                   	ret
+  8004da:	e8 f6 12 00 00       	call   8017d5 <sys_lease_complete>
+  8004df:	eb e5                	jmp    8004c6 <exit+0x15>
+
+008004e1 <_panic>:
+  8004e1:	55                   	push   %ebp
+  8004e2:	89 e5                	mov    %esp,%ebp
+  8004e4:	56                   	push   %esi
+  8004e5:	53                   	push   %ebx
+  8004e6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  8004e9:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8004ef:	e8 b5 0b 00 00       	call   8010a9 <sys_getenvid>
+  8004f4:	83 ec 0c             	sub    $0xc,%esp
+  8004f7:	ff 75 0c             	push   0xc(%ebp)
+  8004fa:	ff 75 08             	push   0x8(%ebp)
+  8004fd:	56                   	push   %esi
+  8004fe:	50                   	push   %eax
+  8004ff:	68 88 38 80 00       	push   $0x803888
+  800504:	e8 b3 00 00 00       	call   8005bc <cprintf>
+  800509:	83 c4 18             	add    $0x18,%esp
+  80050c:	53                   	push   %ebx
+  80050d:	ff 75 10             	push   0x10(%ebp)
+  800510:	e8 56 00 00 00       	call   80056b <vcprintf>
+  800515:	c7 04 24 ce 3c 80 00 	movl   $0x803cce,(%esp)
+  80051c:	e8 9b 00 00 00       	call   8005bc <cprintf>
+  800521:	83 c4 10             	add    $0x10,%esp
+  800524:	cc                   	int3
+  800525:	eb fd                	jmp    800524 <_panic+0x43>
+
+00800527 <putch>:
+  800527:	55                   	push   %ebp
+  800528:	89 e5                	mov    %esp,%ebp
+  80052a:	53                   	push   %ebx
+  80052b:	83 ec 04             	sub    $0x4,%esp
+  80052e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800531:	8b 13                	mov    (%ebx),%edx
+  800533:	8d 42 01             	lea    0x1(%edx),%eax
+  800536:	89 03                	mov    %eax,(%ebx)
+  800538:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80053b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80053f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800544:	74 09                	je     80054f <putch+0x28>
+  800546:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  80054a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80054d:	c9                   	leave
+  80054e:	c3                   	ret
+  80054f:	83 ec 08             	sub    $0x8,%esp
+  800552:	68 ff 00 00 00       	push   $0xff
+  800557:	8d 43 08             	lea    0x8(%ebx),%eax
+  80055a:	50                   	push   %eax
+  80055b:	e8 cb 0a 00 00       	call   80102b <sys_cputs>
+  800560:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800566:	83 c4 10             	add    $0x10,%esp
+  800569:	eb db                	jmp    800546 <putch+0x1f>
+
+0080056b <vcprintf>:
+  80056b:	55                   	push   %ebp
+  80056c:	89 e5                	mov    %esp,%ebp
+  80056e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800574:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80057b:	00 00 00 
+  80057e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800585:	00 00 00 
+  800588:	ff 75 0c             	push   0xc(%ebp)
+  80058b:	ff 75 08             	push   0x8(%ebp)
+  80058e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800594:	50                   	push   %eax
+  800595:	68 27 05 80 00       	push   $0x800527
+  80059a:	e8 1c 01 00 00       	call   8006bb <vprintfmt>
+  80059f:	83 c4 08             	add    $0x8,%esp
+  8005a2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005a8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005ae:	50                   	push   %eax
+  8005af:	e8 77 0a 00 00       	call   80102b <sys_cputs>
+  8005b4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005ba:	c9                   	leave
+  8005bb:	c3                   	ret
+
+008005bc <cprintf>:
+  8005bc:	55                   	push   %ebp
+  8005bd:	89 e5                	mov    %esp,%ebp
+  8005bf:	83 ec 10             	sub    $0x10,%esp
+  8005c2:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8005c5:	50                   	push   %eax
+  8005c6:	ff 75 08             	push   0x8(%ebp)
+  8005c9:	e8 9d ff ff ff       	call   80056b <vcprintf>
+  8005ce:	c9                   	leave
+  8005cf:	c3                   	ret
+
+008005d0 <printnum>:
+  8005d0:	55                   	push   %ebp
+  8005d1:	89 e5                	mov    %esp,%ebp
+  8005d3:	57                   	push   %edi
+  8005d4:	56                   	push   %esi
+  8005d5:	53                   	push   %ebx
+  8005d6:	83 ec 1c             	sub    $0x1c,%esp
+  8005d9:	89 c3                	mov    %eax,%ebx
+  8005db:	89 d6                	mov    %edx,%esi
+  8005dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005e3:	89 d1                	mov    %edx,%ecx
+  8005e5:	89 c2                	mov    %eax,%edx
+  8005e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ea:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ed:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8005fa:	39 c2                	cmp    %eax,%edx
+  8005fc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8005ff:	73 4b                	jae    80064c <printnum+0x7c>
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800607:	85 ff                	test   %edi,%edi
+  800609:	7e 11                	jle    80061c <printnum+0x4c>
+  80060b:	83 ec 08             	sub    $0x8,%esp
+  80060e:	56                   	push   %esi
+  80060f:	ff 75 18             	push   0x18(%ebp)
+  800612:	ff d3                	call   *%ebx
+  800614:	83 c4 10             	add    $0x10,%esp
+  800617:	83 ef 01             	sub    $0x1,%edi
+  80061a:	75 ef                	jne    80060b <printnum+0x3b>
+  80061c:	83 ec 08             	sub    $0x8,%esp
+  80061f:	56                   	push   %esi
+  800620:	83 ec 04             	sub    $0x4,%esp
+  800623:	ff 75 e4             	push   -0x1c(%ebp)
+  800626:	ff 75 e0             	push   -0x20(%ebp)
+  800629:	ff 75 dc             	push   -0x24(%ebp)
+  80062c:	ff 75 d8             	push   -0x28(%ebp)
+  80062f:	e8 b3 30 00 00       	call   8036e7 <__umoddi3>
+  800634:	83 c4 14             	add    $0x14,%esp
+  800637:	0f be 80 ab 38 80 00 	movsbl 0x8038ab(%eax),%eax
+  80063e:	50                   	push   %eax
+  80063f:	ff d3                	call   *%ebx
+  800641:	83 c4 10             	add    $0x10,%esp
+  800644:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800647:	5b                   	pop    %ebx
+  800648:	5e                   	pop    %esi
+  800649:	5f                   	pop    %edi
+  80064a:	5d                   	pop    %ebp
+  80064b:	c3                   	ret
+  80064c:	83 ec 0c             	sub    $0xc,%esp
+  80064f:	ff 75 18             	push   0x18(%ebp)
+  800652:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800655:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800658:	52                   	push   %edx
+  800659:	50                   	push   %eax
+  80065a:	83 ec 08             	sub    $0x8,%esp
+  80065d:	ff 75 e4             	push   -0x1c(%ebp)
+  800660:	ff 75 e0             	push   -0x20(%ebp)
+  800663:	ff 75 dc             	push   -0x24(%ebp)
+  800666:	ff 75 d8             	push   -0x28(%ebp)
+  800669:	e8 5b 30 00 00       	call   8036c9 <__udivdi3>
+  80066e:	83 c4 18             	add    $0x18,%esp
+  800671:	52                   	push   %edx
+  800672:	50                   	push   %eax
+  800673:	89 f2                	mov    %esi,%edx
+  800675:	89 d8                	mov    %ebx,%eax
+  800677:	e8 54 ff ff ff       	call   8005d0 <printnum>
+  80067c:	83 c4 20             	add    $0x20,%esp
+  80067f:	eb 9b                	jmp    80061c <printnum+0x4c>
+
+00800681 <sprintputch>:
+  800681:	55                   	push   %ebp
+  800682:	89 e5                	mov    %esp,%ebp
+  800684:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800687:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  80068b:	8b 10                	mov    (%eax),%edx
+  80068d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800690:	73 0a                	jae    80069c <sprintputch+0x1b>
+  800692:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800695:	89 08                	mov    %ecx,(%eax)
+  800697:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069a:	88 02                	mov    %al,(%edx)
+  80069c:	5d                   	pop    %ebp
+  80069d:	c3                   	ret
+
+0080069e <printfmt>:
+  80069e:	55                   	push   %ebp
+  80069f:	89 e5                	mov    %esp,%ebp
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	8d 45 14             	lea    0x14(%ebp),%eax
+  8006a7:	50                   	push   %eax
+  8006a8:	ff 75 10             	push   0x10(%ebp)
+  8006ab:	ff 75 0c             	push   0xc(%ebp)
+  8006ae:	ff 75 08             	push   0x8(%ebp)
+  8006b1:	e8 05 00 00 00       	call   8006bb <vprintfmt>
+  8006b6:	83 c4 10             	add    $0x10,%esp
+  8006b9:	c9                   	leave
+  8006ba:	c3                   	ret
+
+008006bb <vprintfmt>:
+  8006bb:	55                   	push   %ebp
+  8006bc:	89 e5                	mov    %esp,%ebp
+  8006be:	57                   	push   %edi
+  8006bf:	56                   	push   %esi
+  8006c0:	53                   	push   %ebx
+  8006c1:	83 ec 2c             	sub    $0x2c,%esp
+  8006c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8006c7:	89 df                	mov    %ebx,%edi
+  8006c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006cc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8006cf:	8d 70 01             	lea    0x1(%eax),%esi
+  8006d2:	0f b6 00             	movzbl (%eax),%eax
+  8006d5:	83 f8 25             	cmp    $0x25,%eax
+  8006d8:	74 1e                	je     8006f8 <vprintfmt+0x3d>
+  8006da:	85 c0                	test   %eax,%eax
+  8006dc:	0f 84 15 05 00 00    	je     800bf7 <vprintfmt+0x53c>
+  8006e2:	83 ec 08             	sub    $0x8,%esp
+  8006e5:	53                   	push   %ebx
+  8006e6:	50                   	push   %eax
+  8006e7:	ff d7                	call   *%edi
+  8006e9:	83 c6 01             	add    $0x1,%esi
+  8006ec:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006f0:	83 c4 10             	add    $0x10,%esp
+  8006f3:	83 f8 25             	cmp    $0x25,%eax
+  8006f6:	75 e2                	jne    8006da <vprintfmt+0x1f>
+  8006f8:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8006fc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  800703:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80070a:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  800711:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800716:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800719:	8d 56 01             	lea    0x1(%esi),%edx
+  80071c:	0f b6 0e             	movzbl (%esi),%ecx
+  80071f:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800722:	3c 55                	cmp    $0x55,%al
+  800724:	0f 87 3b 04 00 00    	ja     800b65 <vprintfmt+0x4aa>
+  80072a:	0f b6 c0             	movzbl %al,%eax
+  80072d:	ff 24 85 e0 39 80 00 	jmp    *0x8039e0(,%eax,4)
+  800734:	89 75 10             	mov    %esi,0x10(%ebp)
+  800737:	eb 93                	jmp    8006cc <vprintfmt+0x11>
+  800739:	89 d6                	mov    %edx,%esi
+  80073b:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80073f:	eb d8                	jmp    800719 <vprintfmt+0x5e>
+  800741:	89 d6                	mov    %edx,%esi
+  800743:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800747:	eb d0                	jmp    800719 <vprintfmt+0x5e>
+  800749:	0f b6 c9             	movzbl %cl,%ecx
+  80074c:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80074f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800752:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800756:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800759:	83 f9 09             	cmp    $0x9,%ecx
+  80075c:	77 6f                	ja     8007cd <vprintfmt+0x112>
+  80075e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800761:	83 c2 01             	add    $0x1,%edx
+  800764:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800767:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  80076b:	0f be 02             	movsbl (%edx),%eax
+  80076e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800771:	83 fe 09             	cmp    $0x9,%esi
+  800774:	76 eb                	jbe    800761 <vprintfmt+0xa6>
+  800776:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800779:	89 d6                	mov    %edx,%esi
+  80077b:	eb 13                	jmp    800790 <vprintfmt+0xd5>
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8b 00                	mov    (%eax),%eax
+  800782:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8d 40 04             	lea    0x4(%eax),%eax
+  80078b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078e:	89 d6                	mov    %edx,%esi
+  800790:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800794:	79 83                	jns    800719 <vprintfmt+0x5e>
+  800796:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800799:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80079c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8007a3:	e9 71 ff ff ff       	jmp    800719 <vprintfmt+0x5e>
+  8007a8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007ab:	85 c9                	test   %ecx,%ecx
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	0f 49 c1             	cmovns %ecx,%eax
+  8007b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b8:	89 d6                	mov    %edx,%esi
+  8007ba:	e9 5a ff ff ff       	jmp    800719 <vprintfmt+0x5e>
+  8007bf:	89 d6                	mov    %edx,%esi
+  8007c1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8007c8:	e9 4c ff ff ff       	jmp    800719 <vprintfmt+0x5e>
+  8007cd:	89 d6                	mov    %edx,%esi
+  8007cf:	eb bf                	jmp    800790 <vprintfmt+0xd5>
+  8007d1:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8007d5:	89 d6                	mov    %edx,%esi
+  8007d7:	e9 3d ff ff ff       	jmp    800719 <vprintfmt+0x5e>
+  8007dc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8d 70 04             	lea    0x4(%eax),%esi
+  8007e5:	83 ec 08             	sub    $0x8,%esp
+  8007e8:	53                   	push   %ebx
+  8007e9:	ff 30                	push   (%eax)
+  8007eb:	ff d7                	call   *%edi
+  8007ed:	83 c4 10             	add    $0x10,%esp
+  8007f0:	89 75 14             	mov    %esi,0x14(%ebp)
+  8007f3:	e9 d4 fe ff ff       	jmp    8006cc <vprintfmt+0x11>
+  8007f8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8d 70 04             	lea    0x4(%eax),%esi
+  800801:	8b 10                	mov    (%eax),%edx
+  800803:	89 d0                	mov    %edx,%eax
+  800805:	f7 d8                	neg    %eax
+  800807:	0f 48 c2             	cmovs  %edx,%eax
+  80080a:	83 f8 12             	cmp    $0x12,%eax
+  80080d:	7f 23                	jg     800832 <vprintfmt+0x177>
+  80080f:	8b 14 85 40 3b 80 00 	mov    0x803b40(,%eax,4),%edx
+  800816:	85 d2                	test   %edx,%edx
+  800818:	74 18                	je     800832 <vprintfmt+0x177>
+  80081a:	52                   	push   %edx
+  80081b:	68 9b 3c 80 00       	push   $0x803c9b
+  800820:	53                   	push   %ebx
+  800821:	57                   	push   %edi
+  800822:	e8 77 fe ff ff       	call   80069e <printfmt>
+  800827:	83 c4 10             	add    $0x10,%esp
+  80082a:	89 75 14             	mov    %esi,0x14(%ebp)
+  80082d:	e9 9a fe ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800832:	50                   	push   %eax
+  800833:	68 c3 38 80 00       	push   $0x8038c3
+  800838:	53                   	push   %ebx
+  800839:	57                   	push   %edi
+  80083a:	e8 5f fe ff ff       	call   80069e <printfmt>
+  80083f:	83 c4 10             	add    $0x10,%esp
+  800842:	89 75 14             	mov    %esi,0x14(%ebp)
+  800845:	e9 82 fe ff ff       	jmp    8006cc <vprintfmt+0x11>
+  80084a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80084d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800850:	83 c0 04             	add    $0x4,%eax
+  800853:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800856:	8b 45 14             	mov    0x14(%ebp),%eax
+  800859:	8b 00                	mov    (%eax),%eax
+  80085b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80085e:	85 c0                	test   %eax,%eax
+  800860:	0f 84 61 03 00 00    	je     800bc7 <vprintfmt+0x50c>
+  800866:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80086a:	7e 06                	jle    800872 <vprintfmt+0x1b7>
+  80086c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800870:	75 29                	jne    80089b <vprintfmt+0x1e0>
+  800872:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800875:	8d 70 01             	lea    0x1(%eax),%esi
+  800878:	0f b6 00             	movzbl (%eax),%eax
+  80087b:	0f be d0             	movsbl %al,%edx
+  80087e:	85 d2                	test   %edx,%edx
+  800880:	0f 84 bb 00 00 00    	je     800941 <vprintfmt+0x286>
+  800886:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800889:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80088c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80088f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800892:	eb 7a                	jmp    80090e <vprintfmt+0x253>
+  800894:	c7 45 d0 bc 38 80 00 	movl   $0x8038bc,-0x30(%ebp)
+  80089b:	83 ec 08             	sub    $0x8,%esp
+  80089e:	ff 75 d4             	push   -0x2c(%ebp)
+  8008a1:	ff 75 d0             	push   -0x30(%ebp)
+  8008a4:	e8 e0 03 00 00       	call   800c89 <strnlen>
+  8008a9:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8008ac:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	85 d2                	test   %edx,%edx
+  8008b4:	0f 8e d6 02 00 00    	jle    800b90 <vprintfmt+0x4d5>
+  8008ba:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8008be:	83 ec 08             	sub    $0x8,%esp
+  8008c1:	53                   	push   %ebx
+  8008c2:	56                   	push   %esi
+  8008c3:	ff d7                	call   *%edi
+  8008c5:	83 c4 10             	add    $0x10,%esp
+  8008c8:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8008cc:	75 f0                	jne    8008be <vprintfmt+0x203>
+  8008ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008d1:	8d 70 01             	lea    0x1(%eax),%esi
+  8008d4:	0f b6 00             	movzbl (%eax),%eax
+  8008d7:	0f be d0             	movsbl %al,%edx
+  8008da:	85 d2                	test   %edx,%edx
+  8008dc:	0f 84 da 02 00 00    	je     800bbc <vprintfmt+0x501>
+  8008e2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008e5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008e8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008ee:	eb 1e                	jmp    80090e <vprintfmt+0x253>
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	ff 75 0c             	push   0xc(%ebp)
+  8008f6:	52                   	push   %edx
+  8008f7:	ff 55 08             	call   *0x8(%ebp)
+  8008fa:	83 c4 10             	add    $0x10,%esp
+  8008fd:	83 eb 01             	sub    $0x1,%ebx
+  800900:	83 c6 01             	add    $0x1,%esi
+  800903:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800907:	0f be d0             	movsbl %al,%edx
+  80090a:	85 d2                	test   %edx,%edx
+  80090c:	74 2a                	je     800938 <vprintfmt+0x27d>
+  80090e:	85 ff                	test   %edi,%edi
+  800910:	78 05                	js     800917 <vprintfmt+0x25c>
+  800912:	83 ef 01             	sub    $0x1,%edi
+  800915:	78 59                	js     800970 <vprintfmt+0x2b5>
+  800917:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80091b:	74 d3                	je     8008f0 <vprintfmt+0x235>
+  80091d:	0f be c0             	movsbl %al,%eax
+  800920:	83 e8 20             	sub    $0x20,%eax
+  800923:	83 f8 5e             	cmp    $0x5e,%eax
+  800926:	76 c8                	jbe    8008f0 <vprintfmt+0x235>
+  800928:	83 ec 08             	sub    $0x8,%esp
+  80092b:	ff 75 0c             	push   0xc(%ebp)
+  80092e:	6a 3f                	push   $0x3f
+  800930:	ff 55 08             	call   *0x8(%ebp)
+  800933:	83 c4 10             	add    $0x10,%esp
+  800936:	eb c5                	jmp    8008fd <vprintfmt+0x242>
+  800938:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80093b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80093e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800941:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800944:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800948:	7e 1b                	jle    800965 <vprintfmt+0x2aa>
+  80094a:	83 ec 08             	sub    $0x8,%esp
+  80094d:	53                   	push   %ebx
+  80094e:	6a 20                	push   $0x20
+  800950:	ff d7                	call   *%edi
+  800952:	83 c4 10             	add    $0x10,%esp
+  800955:	83 ee 01             	sub    $0x1,%esi
+  800958:	75 f0                	jne    80094a <vprintfmt+0x28f>
+  80095a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80095d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800960:	e9 67 fd ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800965:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800968:	89 45 14             	mov    %eax,0x14(%ebp)
+  80096b:	e9 5c fd ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800970:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800973:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800976:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800979:	eb c6                	jmp    800941 <vprintfmt+0x286>
+  80097b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80097e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800981:	83 f9 01             	cmp    $0x1,%ecx
+  800984:	7f 1f                	jg     8009a5 <vprintfmt+0x2ea>
+  800986:	85 c9                	test   %ecx,%ecx
+  800988:	74 67                	je     8009f1 <vprintfmt+0x336>
+  80098a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098d:	8b 30                	mov    (%eax),%esi
+  80098f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800992:	89 f0                	mov    %esi,%eax
+  800994:	c1 f8 1f             	sar    $0x1f,%eax
+  800997:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80099a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099d:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a3:	eb 17                	jmp    8009bc <vprintfmt+0x301>
+  8009a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a8:	8b 50 04             	mov    0x4(%eax),%edx
+  8009ab:	8b 00                	mov    (%eax),%eax
+  8009ad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009b0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b6:	8d 40 08             	lea    0x8(%eax),%eax
+  8009b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009bc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009bf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009c2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8009c7:	85 c9                	test   %ecx,%ecx
+  8009c9:	0f 89 12 01 00 00    	jns    800ae1 <vprintfmt+0x426>
+  8009cf:	83 ec 08             	sub    $0x8,%esp
+  8009d2:	53                   	push   %ebx
+  8009d3:	6a 2d                	push   $0x2d
+  8009d5:	ff d7                	call   *%edi
+  8009d7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009da:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009dd:	f7 da                	neg    %edx
+  8009df:	83 d1 00             	adc    $0x0,%ecx
+  8009e2:	f7 d9                	neg    %ecx
+  8009e4:	83 c4 10             	add    $0x10,%esp
+  8009e7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8009ec:	e9 f0 00 00 00       	jmp    800ae1 <vprintfmt+0x426>
+  8009f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f4:	8b 30                	mov    (%eax),%esi
+  8009f6:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8009f9:	89 f0                	mov    %esi,%eax
+  8009fb:	c1 f8 1f             	sar    $0x1f,%eax
+  8009fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a04:	8d 40 04             	lea    0x4(%eax),%eax
+  800a07:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a0a:	eb b0                	jmp    8009bc <vprintfmt+0x301>
+  800a0c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a0f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a12:	83 f9 01             	cmp    $0x1,%ecx
+  800a15:	7f 1e                	jg     800a35 <vprintfmt+0x37a>
+  800a17:	85 c9                	test   %ecx,%ecx
+  800a19:	74 32                	je     800a4d <vprintfmt+0x392>
+  800a1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1e:	8b 10                	mov    (%eax),%edx
+  800a20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a25:	8d 40 04             	lea    0x4(%eax),%eax
+  800a28:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a2b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a30:	e9 ac 00 00 00       	jmp    800ae1 <vprintfmt+0x426>
+  800a35:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a38:	8b 10                	mov    (%eax),%edx
+  800a3a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a3d:	8d 40 08             	lea    0x8(%eax),%eax
+  800a40:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a43:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a48:	e9 94 00 00 00       	jmp    800ae1 <vprintfmt+0x426>
+  800a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a50:	8b 10                	mov    (%eax),%edx
+  800a52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a57:	8d 40 04             	lea    0x4(%eax),%eax
+  800a5a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a5d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a62:	eb 7d                	jmp    800ae1 <vprintfmt+0x426>
+  800a64:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a67:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a6a:	83 f9 01             	cmp    $0x1,%ecx
+  800a6d:	7f 1b                	jg     800a8a <vprintfmt+0x3cf>
+  800a6f:	85 c9                	test   %ecx,%ecx
+  800a71:	74 2c                	je     800a9f <vprintfmt+0x3e4>
+  800a73:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a76:	8b 10                	mov    (%eax),%edx
+  800a78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a80:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a83:	be 08 00 00 00       	mov    $0x8,%esi
+  800a88:	eb 57                	jmp    800ae1 <vprintfmt+0x426>
+  800a8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8d:	8b 10                	mov    (%eax),%edx
+  800a8f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a92:	8d 40 08             	lea    0x8(%eax),%eax
+  800a95:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a98:	be 08 00 00 00       	mov    $0x8,%esi
+  800a9d:	eb 42                	jmp    800ae1 <vprintfmt+0x426>
+  800a9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa2:	8b 10                	mov    (%eax),%edx
+  800aa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa9:	8d 40 04             	lea    0x4(%eax),%eax
+  800aac:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aaf:	be 08 00 00 00       	mov    $0x8,%esi
+  800ab4:	eb 2b                	jmp    800ae1 <vprintfmt+0x426>
+  800ab6:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ab9:	83 ec 08             	sub    $0x8,%esp
+  800abc:	53                   	push   %ebx
+  800abd:	6a 30                	push   $0x30
+  800abf:	ff d7                	call   *%edi
+  800ac1:	83 c4 08             	add    $0x8,%esp
+  800ac4:	53                   	push   %ebx
+  800ac5:	6a 78                	push   $0x78
+  800ac7:	ff d7                	call   *%edi
+  800ac9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800acc:	8b 10                	mov    (%eax),%edx
+  800ace:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad3:	83 c4 10             	add    $0x10,%esp
+  800ad6:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800adc:	be 10 00 00 00       	mov    $0x10,%esi
+  800ae1:	83 ec 0c             	sub    $0xc,%esp
+  800ae4:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800ae8:	50                   	push   %eax
+  800ae9:	ff 75 e4             	push   -0x1c(%ebp)
+  800aec:	56                   	push   %esi
+  800aed:	51                   	push   %ecx
+  800aee:	52                   	push   %edx
+  800aef:	89 da                	mov    %ebx,%edx
+  800af1:	89 f8                	mov    %edi,%eax
+  800af3:	e8 d8 fa ff ff       	call   8005d0 <printnum>
+  800af8:	83 c4 20             	add    $0x20,%esp
+  800afb:	e9 cc fb ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800b00:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b03:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b06:	83 f9 01             	cmp    $0x1,%ecx
+  800b09:	7f 1b                	jg     800b26 <vprintfmt+0x46b>
+  800b0b:	85 c9                	test   %ecx,%ecx
+  800b0d:	74 2c                	je     800b3b <vprintfmt+0x480>
+  800b0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b12:	8b 10                	mov    (%eax),%edx
+  800b14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b19:	8d 40 04             	lea    0x4(%eax),%eax
+  800b1c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b1f:	be 10 00 00 00       	mov    $0x10,%esi
+  800b24:	eb bb                	jmp    800ae1 <vprintfmt+0x426>
+  800b26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b29:	8b 10                	mov    (%eax),%edx
+  800b2b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b2e:	8d 40 08             	lea    0x8(%eax),%eax
+  800b31:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b34:	be 10 00 00 00       	mov    $0x10,%esi
+  800b39:	eb a6                	jmp    800ae1 <vprintfmt+0x426>
+  800b3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3e:	8b 10                	mov    (%eax),%edx
+  800b40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b45:	8d 40 04             	lea    0x4(%eax),%eax
+  800b48:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b4b:	be 10 00 00 00       	mov    $0x10,%esi
+  800b50:	eb 8f                	jmp    800ae1 <vprintfmt+0x426>
+  800b52:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b55:	83 ec 08             	sub    $0x8,%esp
+  800b58:	53                   	push   %ebx
+  800b59:	6a 25                	push   $0x25
+  800b5b:	ff d7                	call   *%edi
+  800b5d:	83 c4 10             	add    $0x10,%esp
+  800b60:	e9 67 fb ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800b65:	83 ec 08             	sub    $0x8,%esp
+  800b68:	53                   	push   %ebx
+  800b69:	6a 25                	push   $0x25
+  800b6b:	ff d7                	call   *%edi
+  800b6d:	83 c4 10             	add    $0x10,%esp
+  800b70:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800b74:	0f 84 ba fb ff ff    	je     800734 <vprintfmt+0x79>
+  800b7a:	89 75 10             	mov    %esi,0x10(%ebp)
+  800b7d:	89 f0                	mov    %esi,%eax
+  800b7f:	83 e8 01             	sub    $0x1,%eax
+  800b82:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b86:	75 f7                	jne    800b7f <vprintfmt+0x4c4>
+  800b88:	89 45 10             	mov    %eax,0x10(%ebp)
+  800b8b:	e9 3c fb ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800b90:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b93:	8d 70 01             	lea    0x1(%eax),%esi
+  800b96:	0f b6 00             	movzbl (%eax),%eax
+  800b99:	0f be d0             	movsbl %al,%edx
+  800b9c:	85 d2                	test   %edx,%edx
+  800b9e:	74 11                	je     800bb1 <vprintfmt+0x4f6>
+  800ba0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ba3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ba6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ba9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bac:	e9 5d fd ff ff       	jmp    80090e <vprintfmt+0x253>
+  800bb1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800bb4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bb7:	e9 10 fb ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800bbc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800bbf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bc2:	e9 05 fb ff ff       	jmp    8006cc <vprintfmt+0x11>
+  800bc7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800bcb:	7e 0a                	jle    800bd7 <vprintfmt+0x51c>
+  800bcd:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800bd1:	0f 85 bd fc ff ff    	jne    800894 <vprintfmt+0x1d9>
+  800bd7:	ba 28 00 00 00       	mov    $0x28,%edx
+  800bdc:	b8 28 00 00 00       	mov    $0x28,%eax
+  800be1:	be bd 38 80 00       	mov    $0x8038bd,%esi
+  800be6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800be9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800bec:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800bef:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bf2:	e9 17 fd ff ff       	jmp    80090e <vprintfmt+0x253>
+  800bf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfa:	5b                   	pop    %ebx
+  800bfb:	5e                   	pop    %esi
+  800bfc:	5f                   	pop    %edi
+  800bfd:	5d                   	pop    %ebp
+  800bfe:	c3                   	ret
+
+00800bff <vsnprintf>:
+  800bff:	55                   	push   %ebp
+  800c00:	89 e5                	mov    %esp,%ebp
+  800c02:	83 ec 18             	sub    $0x18,%esp
+  800c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c0b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c0e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c12:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c15:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800c1c:	85 c0                	test   %eax,%eax
+  800c1e:	74 26                	je     800c46 <vsnprintf+0x47>
+  800c20:	85 d2                	test   %edx,%edx
+  800c22:	7e 22                	jle    800c46 <vsnprintf+0x47>
+  800c24:	ff 75 14             	push   0x14(%ebp)
+  800c27:	ff 75 10             	push   0x10(%ebp)
+  800c2a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c2d:	50                   	push   %eax
+  800c2e:	68 81 06 80 00       	push   $0x800681
+  800c33:	e8 83 fa ff ff       	call   8006bb <vprintfmt>
+  800c38:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c3b:	c6 00 00             	movb   $0x0,(%eax)
+  800c3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c41:	83 c4 10             	add    $0x10,%esp
+  800c44:	c9                   	leave
+  800c45:	c3                   	ret
+  800c46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c4b:	eb f7                	jmp    800c44 <vsnprintf+0x45>
+
+00800c4d <snprintf>:
+  800c4d:	55                   	push   %ebp
+  800c4e:	89 e5                	mov    %esp,%ebp
+  800c50:	83 ec 08             	sub    $0x8,%esp
+  800c53:	8d 45 14             	lea    0x14(%ebp),%eax
+  800c56:	50                   	push   %eax
+  800c57:	ff 75 10             	push   0x10(%ebp)
+  800c5a:	ff 75 0c             	push   0xc(%ebp)
+  800c5d:	ff 75 08             	push   0x8(%ebp)
+  800c60:	e8 9a ff ff ff       	call   800bff <vsnprintf>
+  800c65:	c9                   	leave
+  800c66:	c3                   	ret
+
+00800c67 <strlen>:
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6d:	80 3a 00             	cmpb   $0x0,(%edx)
+  800c70:	74 10                	je     800c82 <strlen+0x1b>
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	83 c0 01             	add    $0x1,%eax
+  800c7a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c7e:	75 f7                	jne    800c77 <strlen+0x10>
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+  800c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c87:	eb f7                	jmp    800c80 <strlen+0x19>
+
+00800c89 <strnlen>:
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c92:	85 d2                	test   %edx,%edx
+  800c94:	74 16                	je     800cac <strnlen+0x23>
+  800c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c9f:	74 09                	je     800caa <strnlen+0x21>
+  800ca1:	83 c0 01             	add    $0x1,%eax
+  800ca4:	39 d0                	cmp    %edx,%eax
+  800ca6:	75 f3                	jne    800c9b <strnlen+0x12>
+  800ca8:	89 d0                	mov    %edx,%eax
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+  800cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb1:	eb f7                	jmp    800caa <strnlen+0x21>
+
+00800cb3 <strcpy>:
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	53                   	push   %ebx
+  800cb7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800cc6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800cc9:	83 c0 01             	add    $0x1,%eax
+  800ccc:	84 d2                	test   %dl,%dl
+  800cce:	75 f2                	jne    800cc2 <strcpy+0xf>
+  800cd0:	89 c8                	mov    %ecx,%eax
+  800cd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cd5:	c9                   	leave
+  800cd6:	c3                   	ret
+
+00800cd7 <strcat>:
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	53                   	push   %ebx
+  800cdb:	83 ec 10             	sub    $0x10,%esp
+  800cde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ce1:	53                   	push   %ebx
+  800ce2:	e8 80 ff ff ff       	call   800c67 <strlen>
+  800ce7:	83 c4 08             	add    $0x8,%esp
+  800cea:	ff 75 0c             	push   0xc(%ebp)
+  800ced:	01 d8                	add    %ebx,%eax
+  800cef:	50                   	push   %eax
+  800cf0:	e8 be ff ff ff       	call   800cb3 <strcpy>
+  800cf5:	89 d8                	mov    %ebx,%eax
+  800cf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cfa:	c9                   	leave
+  800cfb:	c3                   	ret
+
+00800cfc <strncpy>:
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	56                   	push   %esi
+  800d00:	53                   	push   %ebx
+  800d01:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0a:	85 db                	test   %ebx,%ebx
+  800d0c:	74 17                	je     800d25 <strncpy+0x29>
+  800d0e:	01 f3                	add    %esi,%ebx
+  800d10:	89 f0                	mov    %esi,%eax
+  800d12:	83 c0 01             	add    $0x1,%eax
+  800d15:	0f b6 0a             	movzbl (%edx),%ecx
+  800d18:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800d1b:	80 f9 01             	cmp    $0x1,%cl
+  800d1e:	83 da ff             	sbb    $0xffffffff,%edx
+  800d21:	39 c3                	cmp    %eax,%ebx
+  800d23:	75 ed                	jne    800d12 <strncpy+0x16>
+  800d25:	89 f0                	mov    %esi,%eax
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+
+00800d2b <strlcpy>:
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	56                   	push   %esi
+  800d2f:	53                   	push   %ebx
+  800d30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d39:	89 f0                	mov    %esi,%eax
+  800d3b:	85 db                	test   %ebx,%ebx
+  800d3d:	74 1e                	je     800d5d <strlcpy+0x32>
+  800d3f:	83 eb 01             	sub    $0x1,%ebx
+  800d42:	74 16                	je     800d5a <strlcpy+0x2f>
+  800d44:	01 f3                	add    %esi,%ebx
+  800d46:	0f b6 0a             	movzbl (%edx),%ecx
+  800d49:	84 c9                	test   %cl,%cl
+  800d4b:	74 0d                	je     800d5a <strlcpy+0x2f>
+  800d4d:	83 c2 01             	add    $0x1,%edx
+  800d50:	83 c0 01             	add    $0x1,%eax
+  800d53:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800d56:	39 d8                	cmp    %ebx,%eax
+  800d58:	75 ec                	jne    800d46 <strlcpy+0x1b>
+  800d5a:	c6 00 00             	movb   $0x0,(%eax)
+  800d5d:	29 f0                	sub    %esi,%eax
+  800d5f:	5b                   	pop    %ebx
+  800d60:	5e                   	pop    %esi
+  800d61:	5d                   	pop    %ebp
+  800d62:	c3                   	ret
+
+00800d63 <strcmp>:
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d6c:	0f b6 01             	movzbl (%ecx),%eax
+  800d6f:	84 c0                	test   %al,%al
+  800d71:	74 11                	je     800d84 <strcmp+0x21>
+  800d73:	38 02                	cmp    %al,(%edx)
+  800d75:	75 0d                	jne    800d84 <strcmp+0x21>
+  800d77:	83 c1 01             	add    $0x1,%ecx
+  800d7a:	83 c2 01             	add    $0x1,%edx
+  800d7d:	0f b6 01             	movzbl (%ecx),%eax
+  800d80:	84 c0                	test   %al,%al
+  800d82:	75 ef                	jne    800d73 <strcmp+0x10>
+  800d84:	0f b6 c0             	movzbl %al,%eax
+  800d87:	0f b6 12             	movzbl (%edx),%edx
+  800d8a:	29 d0                	sub    %edx,%eax
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+
+00800d8e <strncmp>:
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	53                   	push   %ebx
+  800d92:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d95:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d98:	8b 55 10             	mov    0x10(%ebp),%edx
+  800d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da0:	85 d2                	test   %edx,%edx
+  800da2:	74 2e                	je     800dd2 <strncmp+0x44>
+  800da4:	0f b6 01             	movzbl (%ecx),%eax
+  800da7:	84 c0                	test   %al,%al
+  800da9:	74 16                	je     800dc1 <strncmp+0x33>
+  800dab:	3a 03                	cmp    (%ebx),%al
+  800dad:	75 12                	jne    800dc1 <strncmp+0x33>
+  800daf:	83 c1 01             	add    $0x1,%ecx
+  800db2:	83 c3 01             	add    $0x1,%ebx
+  800db5:	83 ea 01             	sub    $0x1,%edx
+  800db8:	75 ea                	jne    800da4 <strncmp+0x16>
+  800dba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbf:	eb 11                	jmp    800dd2 <strncmp+0x44>
+  800dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc6:	85 d2                	test   %edx,%edx
+  800dc8:	74 08                	je     800dd2 <strncmp+0x44>
+  800dca:	0f b6 01             	movzbl (%ecx),%eax
+  800dcd:	0f b6 13             	movzbl (%ebx),%edx
+  800dd0:	29 d0                	sub    %edx,%eax
+  800dd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dd5:	c9                   	leave
+  800dd6:	c3                   	ret
+
+00800dd7 <strchr>:
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800de1:	0f b6 10             	movzbl (%eax),%edx
+  800de4:	84 d2                	test   %dl,%dl
+  800de6:	74 15                	je     800dfd <strchr+0x26>
+  800de8:	38 d1                	cmp    %dl,%cl
+  800dea:	74 0f                	je     800dfb <strchr+0x24>
+  800dec:	83 c0 01             	add    $0x1,%eax
+  800def:	0f b6 10             	movzbl (%eax),%edx
+  800df2:	84 d2                	test   %dl,%dl
+  800df4:	75 f2                	jne    800de8 <strchr+0x11>
+  800df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfb:	5d                   	pop    %ebp
+  800dfc:	c3                   	ret
+  800dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e02:	eb f7                	jmp    800dfb <strchr+0x24>
+
+00800e04 <strfind>:
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	53                   	push   %ebx
+  800e08:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e0e:	0f b6 18             	movzbl (%eax),%ebx
+  800e11:	38 d3                	cmp    %dl,%bl
+  800e13:	74 14                	je     800e29 <strfind+0x25>
+  800e15:	89 d1                	mov    %edx,%ecx
+  800e17:	84 db                	test   %bl,%bl
+  800e19:	74 0e                	je     800e29 <strfind+0x25>
+  800e1b:	83 c0 01             	add    $0x1,%eax
+  800e1e:	0f b6 10             	movzbl (%eax),%edx
+  800e21:	38 ca                	cmp    %cl,%dl
+  800e23:	74 04                	je     800e29 <strfind+0x25>
+  800e25:	84 d2                	test   %dl,%dl
+  800e27:	75 f2                	jne    800e1b <strfind+0x17>
+  800e29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e2c:	c9                   	leave
+  800e2d:	c3                   	ret
+
+00800e2e <memset>:
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800e38:	85 c9                	test   %ecx,%ecx
+  800e3a:	74 20                	je     800e5c <memset+0x2e>
+  800e3c:	89 f8                	mov    %edi,%eax
+  800e3e:	09 c8                	or     %ecx,%eax
+  800e40:	a8 03                	test   $0x3,%al
+  800e42:	75 12                	jne    800e56 <memset+0x28>
+  800e44:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e48:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800e4e:	c1 e9 02             	shr    $0x2,%ecx
+  800e51:	fc                   	cld
+  800e52:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e54:	eb 06                	jmp    800e5c <memset+0x2e>
+  800e56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e59:	fc                   	cld
+  800e5a:	f3 aa                	rep stos %al,%es:(%edi)
+  800e5c:	89 f8                	mov    %edi,%eax
+  800e5e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e61:	c9                   	leave
+  800e62:	c3                   	ret
+
+00800e63 <memmove>:
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e6e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800e71:	39 c6                	cmp    %eax,%esi
+  800e73:	73 32                	jae    800ea7 <memmove+0x44>
+  800e75:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e78:	39 d0                	cmp    %edx,%eax
+  800e7a:	73 2b                	jae    800ea7 <memmove+0x44>
+  800e7c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800e7f:	89 d6                	mov    %edx,%esi
+  800e81:	09 fe                	or     %edi,%esi
+  800e83:	09 ce                	or     %ecx,%esi
+  800e85:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e8b:	75 0e                	jne    800e9b <memmove+0x38>
+  800e8d:	83 ef 04             	sub    $0x4,%edi
+  800e90:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e93:	c1 e9 02             	shr    $0x2,%ecx
+  800e96:	fd                   	std
+  800e97:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e99:	eb 09                	jmp    800ea4 <memmove+0x41>
+  800e9b:	83 ef 01             	sub    $0x1,%edi
+  800e9e:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800ea1:	fd                   	std
+  800ea2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ea4:	fc                   	cld
+  800ea5:	eb 1a                	jmp    800ec1 <memmove+0x5e>
+  800ea7:	89 f2                	mov    %esi,%edx
+  800ea9:	09 c2                	or     %eax,%edx
+  800eab:	09 ca                	or     %ecx,%edx
+  800ead:	f6 c2 03             	test   $0x3,%dl
+  800eb0:	75 0a                	jne    800ebc <memmove+0x59>
+  800eb2:	c1 e9 02             	shr    $0x2,%ecx
+  800eb5:	89 c7                	mov    %eax,%edi
+  800eb7:	fc                   	cld
+  800eb8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eba:	eb 05                	jmp    800ec1 <memmove+0x5e>
+  800ebc:	89 c7                	mov    %eax,%edi
+  800ebe:	fc                   	cld
+  800ebf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+
+00800ec5 <memcpy>:
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	83 ec 0c             	sub    $0xc,%esp
+  800ecb:	ff 75 10             	push   0x10(%ebp)
+  800ece:	ff 75 0c             	push   0xc(%ebp)
+  800ed1:	ff 75 08             	push   0x8(%ebp)
+  800ed4:	e8 8a ff ff ff       	call   800e63 <memmove>
+  800ed9:	c9                   	leave
+  800eda:	c3                   	ret
+
+00800edb <memcmp>:
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ee6:	8b 75 10             	mov    0x10(%ebp),%esi
+  800ee9:	85 f6                	test   %esi,%esi
+  800eeb:	74 29                	je     800f16 <memcmp+0x3b>
+  800eed:	01 c6                	add    %eax,%esi
+  800eef:	0f b6 08             	movzbl (%eax),%ecx
+  800ef2:	0f b6 1a             	movzbl (%edx),%ebx
+  800ef5:	38 d9                	cmp    %bl,%cl
+  800ef7:	75 11                	jne    800f0a <memcmp+0x2f>
+  800ef9:	83 c0 01             	add    $0x1,%eax
+  800efc:	83 c2 01             	add    $0x1,%edx
+  800eff:	39 c6                	cmp    %eax,%esi
+  800f01:	75 ec                	jne    800eef <memcmp+0x14>
+  800f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f08:	eb 08                	jmp    800f12 <memcmp+0x37>
+  800f0a:	0f b6 c1             	movzbl %cl,%eax
+  800f0d:	0f b6 db             	movzbl %bl,%ebx
+  800f10:	29 d8                	sub    %ebx,%eax
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+  800f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1b:	eb f5                	jmp    800f12 <memcmp+0x37>
+
+00800f1d <memfind>:
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	89 c2                	mov    %eax,%edx
+  800f28:	03 55 10             	add    0x10(%ebp),%edx
+  800f2b:	39 d0                	cmp    %edx,%eax
+  800f2d:	73 0d                	jae    800f3c <memfind+0x1f>
+  800f2f:	38 08                	cmp    %cl,(%eax)
+  800f31:	74 0d                	je     800f40 <memfind+0x23>
+  800f33:	83 c0 01             	add    $0x1,%eax
+  800f36:	39 c2                	cmp    %eax,%edx
+  800f38:	75 f5                	jne    800f2f <memfind+0x12>
+  800f3a:	eb 06                	jmp    800f42 <memfind+0x25>
+  800f3c:	89 c2                	mov    %eax,%edx
+  800f3e:	eb 02                	jmp    800f42 <memfind+0x25>
+  800f40:	89 c2                	mov    %eax,%edx
+  800f42:	89 d0                	mov    %edx,%eax
+  800f44:	5d                   	pop    %ebp
+  800f45:	c3                   	ret
+
+00800f46 <strtol>:
+  800f46:	55                   	push   %ebp
+  800f47:	89 e5                	mov    %esp,%ebp
+  800f49:	57                   	push   %edi
+  800f4a:	56                   	push   %esi
+  800f4b:	53                   	push   %ebx
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f52:	0f b6 02             	movzbl (%edx),%eax
+  800f55:	3c 20                	cmp    $0x20,%al
+  800f57:	74 04                	je     800f5d <strtol+0x17>
+  800f59:	3c 09                	cmp    $0x9,%al
+  800f5b:	75 0e                	jne    800f6b <strtol+0x25>
+  800f5d:	83 c2 01             	add    $0x1,%edx
+  800f60:	0f b6 02             	movzbl (%edx),%eax
+  800f63:	3c 20                	cmp    $0x20,%al
+  800f65:	74 f6                	je     800f5d <strtol+0x17>
+  800f67:	3c 09                	cmp    $0x9,%al
+  800f69:	74 f2                	je     800f5d <strtol+0x17>
+  800f6b:	3c 2b                	cmp    $0x2b,%al
+  800f6d:	74 2a                	je     800f99 <strtol+0x53>
+  800f6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f74:	3c 2d                	cmp    $0x2d,%al
+  800f76:	74 2b                	je     800fa3 <strtol+0x5d>
+  800f78:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f7e:	75 0f                	jne    800f8f <strtol+0x49>
+  800f80:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f83:	74 28                	je     800fad <strtol+0x67>
+  800f85:	85 db                	test   %ebx,%ebx
+  800f87:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f8c:	0f 44 d8             	cmove  %eax,%ebx
+  800f8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f94:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f97:	eb 46                	jmp    800fdf <strtol+0x99>
+  800f99:	83 c2 01             	add    $0x1,%edx
+  800f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fa1:	eb d5                	jmp    800f78 <strtol+0x32>
+  800fa3:	83 c2 01             	add    $0x1,%edx
+  800fa6:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fab:	eb cb                	jmp    800f78 <strtol+0x32>
+  800fad:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800fb1:	74 0e                	je     800fc1 <strtol+0x7b>
+  800fb3:	85 db                	test   %ebx,%ebx
+  800fb5:	75 d8                	jne    800f8f <strtol+0x49>
+  800fb7:	83 c2 01             	add    $0x1,%edx
+  800fba:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800fbf:	eb ce                	jmp    800f8f <strtol+0x49>
+  800fc1:	83 c2 02             	add    $0x2,%edx
+  800fc4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800fc9:	eb c4                	jmp    800f8f <strtol+0x49>
+  800fcb:	0f be c0             	movsbl %al,%eax
+  800fce:	83 e8 30             	sub    $0x30,%eax
+  800fd1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fd4:	7d 3a                	jge    801010 <strtol+0xca>
+  800fd6:	83 c2 01             	add    $0x1,%edx
+  800fd9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fdd:	01 c1                	add    %eax,%ecx
+  800fdf:	0f b6 02             	movzbl (%edx),%eax
+  800fe2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800fe5:	89 f3                	mov    %esi,%ebx
+  800fe7:	80 fb 09             	cmp    $0x9,%bl
+  800fea:	76 df                	jbe    800fcb <strtol+0x85>
+  800fec:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800fef:	89 f3                	mov    %esi,%ebx
+  800ff1:	80 fb 19             	cmp    $0x19,%bl
+  800ff4:	77 08                	ja     800ffe <strtol+0xb8>
+  800ff6:	0f be c0             	movsbl %al,%eax
+  800ff9:	83 e8 57             	sub    $0x57,%eax
+  800ffc:	eb d3                	jmp    800fd1 <strtol+0x8b>
+  800ffe:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801001:	89 f3                	mov    %esi,%ebx
+  801003:	80 fb 19             	cmp    $0x19,%bl
+  801006:	77 08                	ja     801010 <strtol+0xca>
+  801008:	0f be c0             	movsbl %al,%eax
+  80100b:	83 e8 37             	sub    $0x37,%eax
+  80100e:	eb c1                	jmp    800fd1 <strtol+0x8b>
+  801010:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801014:	74 05                	je     80101b <strtol+0xd5>
+  801016:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801019:	89 10                	mov    %edx,(%eax)
+  80101b:	89 c8                	mov    %ecx,%eax
+  80101d:	f7 d8                	neg    %eax
+  80101f:	85 ff                	test   %edi,%edi
+  801021:	0f 45 c8             	cmovne %eax,%ecx
+  801024:	89 c8                	mov    %ecx,%eax
+  801026:	5b                   	pop    %ebx
+  801027:	5e                   	pop    %esi
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+
+0080102b <sys_cputs>:
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	56                   	push   %esi
+  801030:	53                   	push   %ebx
+  801031:	b8 00 00 00 00       	mov    $0x0,%eax
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	89 c3                	mov    %eax,%ebx
+  80103e:	89 c7                	mov    %eax,%edi
+  801040:	89 c6                	mov    %eax,%esi
+  801042:	cd 30                	int    $0x30
+  801044:	5b                   	pop    %ebx
+  801045:	5e                   	pop    %esi
+  801046:	5f                   	pop    %edi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+
+00801049 <sys_cgetc>:
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+  80104f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801054:	b8 01 00 00 00       	mov    $0x1,%eax
+  801059:	89 d1                	mov    %edx,%ecx
+  80105b:	89 d3                	mov    %edx,%ebx
+  80105d:	89 d7                	mov    %edx,%edi
+  80105f:	89 d6                	mov    %edx,%esi
+  801061:	cd 30                	int    $0x30
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+
+00801068 <sys_env_destroy>:
+  801068:	55                   	push   %ebp
+  801069:	89 e5                	mov    %esp,%ebp
+  80106b:	57                   	push   %edi
+  80106c:	56                   	push   %esi
+  80106d:	53                   	push   %ebx
+  80106e:	83 ec 0c             	sub    $0xc,%esp
+  801071:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801076:	8b 55 08             	mov    0x8(%ebp),%edx
+  801079:	b8 03 00 00 00       	mov    $0x3,%eax
+  80107e:	89 cb                	mov    %ecx,%ebx
+  801080:	89 cf                	mov    %ecx,%edi
+  801082:	89 ce                	mov    %ecx,%esi
+  801084:	cd 30                	int    $0x30
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 08                	jg     801092 <sys_env_destroy+0x2a>
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+  801092:	83 ec 0c             	sub    $0xc,%esp
+  801095:	50                   	push   %eax
+  801096:	6a 03                	push   $0x3
+  801098:	68 ab 3b 80 00       	push   $0x803bab
+  80109d:	6a 24                	push   $0x24
+  80109f:	68 c8 3b 80 00       	push   $0x803bc8
+  8010a4:	e8 38 f4 ff ff       	call   8004e1 <_panic>
+
+008010a9 <sys_getenvid>:
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	57                   	push   %edi
+  8010ad:	56                   	push   %esi
+  8010ae:	53                   	push   %ebx
+  8010af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010b9:	89 d1                	mov    %edx,%ecx
+  8010bb:	89 d3                	mov    %edx,%ebx
+  8010bd:	89 d7                	mov    %edx,%edi
+  8010bf:	89 d6                	mov    %edx,%esi
+  8010c1:	cd 30                	int    $0x30
+  8010c3:	5b                   	pop    %ebx
+  8010c4:	5e                   	pop    %esi
+  8010c5:	5f                   	pop    %edi
+  8010c6:	5d                   	pop    %ebp
+  8010c7:	c3                   	ret
+
+008010c8 <sys_yield>:
+  8010c8:	55                   	push   %ebp
+  8010c9:	89 e5                	mov    %esp,%ebp
+  8010cb:	57                   	push   %edi
+  8010cc:	56                   	push   %esi
+  8010cd:	53                   	push   %ebx
+  8010ce:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010d5:	74 26                	je     8010fd <sys_yield+0x35>
+  8010d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010e1:	89 d1                	mov    %edx,%ecx
+  8010e3:	89 d3                	mov    %edx,%ebx
+  8010e5:	89 d7                	mov    %edx,%edi
+  8010e7:	6a 00                	push   $0x0
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	8d 35 f4 10 80 00    	lea    0x8010f4,%esi
+  8010f2:	0f 34                	sysenter
+  8010f4:	5d                   	pop    %ebp
+  8010f5:	83 c4 04             	add    $0x4,%esp
+  8010f8:	5b                   	pop    %ebx
+  8010f9:	5e                   	pop    %esi
+  8010fa:	5f                   	pop    %edi
+  8010fb:	5d                   	pop    %ebp
+  8010fc:	c3                   	ret
+  8010fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801102:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801107:	89 d1                	mov    %edx,%ecx
+  801109:	89 d3                	mov    %edx,%ebx
+  80110b:	89 d7                	mov    %edx,%edi
+  80110d:	89 d6                	mov    %edx,%esi
+  80110f:	cd 30                	int    $0x30
+  801111:	eb e5                	jmp    8010f8 <sys_yield+0x30>
+
+00801113 <sys_page_alloc>:
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	be 00 00 00 00       	mov    $0x0,%esi
+  801121:	8b 55 08             	mov    0x8(%ebp),%edx
+  801124:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801127:	b8 04 00 00 00       	mov    $0x4,%eax
+  80112c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112f:	89 f7                	mov    %esi,%edi
+  801131:	cd 30                	int    $0x30
+  801133:	85 c0                	test   %eax,%eax
+  801135:	7f 08                	jg     80113f <sys_page_alloc+0x2c>
+  801137:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113a:	5b                   	pop    %ebx
+  80113b:	5e                   	pop    %esi
+  80113c:	5f                   	pop    %edi
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+  801142:	50                   	push   %eax
+  801143:	6a 04                	push   $0x4
+  801145:	68 ab 3b 80 00       	push   $0x803bab
+  80114a:	6a 24                	push   $0x24
+  80114c:	68 c8 3b 80 00       	push   $0x803bc8
+  801151:	e8 8b f3 ff ff       	call   8004e1 <_panic>
+
+00801156 <sys_page_map>:
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	57                   	push   %edi
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+  80115c:	83 ec 0c             	sub    $0xc,%esp
+  80115f:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801166:	74 33                	je     80119b <sys_page_map+0x45>
+  801168:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801173:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801176:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801179:	ff 75 18             	push   0x18(%ebp)
+  80117c:	55                   	push   %ebp
+  80117d:	89 e5                	mov    %esp,%ebp
+  80117f:	8d 35 87 11 80 00    	lea    0x801187,%esi
+  801185:	0f 34                	sysenter
+  801187:	5d                   	pop    %ebp
+  801188:	83 c4 04             	add    $0x4,%esp
+  80118b:	89 c2                	mov    %eax,%edx
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	7f 3d                	jg     8011ce <sys_page_map+0x78>
+  801191:	89 d0                	mov    %edx,%eax
+  801193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+  80119b:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ac:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011af:	cd 30                	int    $0x30
+  8011b1:	89 c2                	mov    %eax,%edx
+  8011b3:	85 c0                	test   %eax,%eax
+  8011b5:	7e da                	jle    801191 <sys_page_map+0x3b>
+  8011b7:	83 ec 0c             	sub    $0xc,%esp
+  8011ba:	50                   	push   %eax
+  8011bb:	6a 05                	push   $0x5
+  8011bd:	68 ab 3b 80 00       	push   $0x803bab
+  8011c2:	6a 24                	push   $0x24
+  8011c4:	68 c8 3b 80 00       	push   $0x803bc8
+  8011c9:	e8 13 f3 ff ff       	call   8004e1 <_panic>
+  8011ce:	83 ec 0c             	sub    $0xc,%esp
+  8011d1:	50                   	push   %eax
+  8011d2:	6a 05                	push   $0x5
+  8011d4:	68 ab 3b 80 00       	push   $0x803bab
+  8011d9:	6a 48                	push   $0x48
+  8011db:	68 c8 3b 80 00       	push   $0x803bc8
+  8011e0:	e8 fc f2 ff ff       	call   8004e1 <_panic>
+
+008011e5 <sys_page_unmap>:
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	57                   	push   %edi
+  8011e9:	56                   	push   %esi
+  8011ea:	53                   	push   %ebx
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+  8011ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011fe:	89 df                	mov    %ebx,%edi
+  801200:	89 de                	mov    %ebx,%esi
+  801202:	cd 30                	int    $0x30
+  801204:	85 c0                	test   %eax,%eax
+  801206:	7f 08                	jg     801210 <sys_page_unmap+0x2b>
+  801208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120b:	5b                   	pop    %ebx
+  80120c:	5e                   	pop    %esi
+  80120d:	5f                   	pop    %edi
+  80120e:	5d                   	pop    %ebp
+  80120f:	c3                   	ret
+  801210:	83 ec 0c             	sub    $0xc,%esp
+  801213:	50                   	push   %eax
+  801214:	6a 06                	push   $0x6
+  801216:	68 ab 3b 80 00       	push   $0x803bab
+  80121b:	6a 24                	push   $0x24
+  80121d:	68 c8 3b 80 00       	push   $0x803bc8
+  801222:	e8 ba f2 ff ff       	call   8004e1 <_panic>
+
+00801227 <sys_fork>:
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+  80122d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801232:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801237:	89 d1                	mov    %edx,%ecx
+  801239:	89 d3                	mov    %edx,%ebx
+  80123b:	89 d7                	mov    %edx,%edi
+  80123d:	89 d6                	mov    %edx,%esi
+  80123f:	cd 30                	int    $0x30
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5f                   	pop    %edi
+  801244:	5d                   	pop    %ebp
+  801245:	c3                   	ret
+
+00801246 <sys_env_set_status>:
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	57                   	push   %edi
+  80124a:	56                   	push   %esi
+  80124b:	53                   	push   %ebx
+  80124c:	83 ec 0c             	sub    $0xc,%esp
+  80124f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801254:	8b 55 08             	mov    0x8(%ebp),%edx
+  801257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80125f:	89 df                	mov    %ebx,%edi
+  801261:	89 de                	mov    %ebx,%esi
+  801263:	cd 30                	int    $0x30
+  801265:	85 c0                	test   %eax,%eax
+  801267:	7f 08                	jg     801271 <sys_env_set_status+0x2b>
+  801269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126c:	5b                   	pop    %ebx
+  80126d:	5e                   	pop    %esi
+  80126e:	5f                   	pop    %edi
+  80126f:	5d                   	pop    %ebp
+  801270:	c3                   	ret
+  801271:	83 ec 0c             	sub    $0xc,%esp
+  801274:	50                   	push   %eax
+  801275:	6a 08                	push   $0x8
+  801277:	68 ab 3b 80 00       	push   $0x803bab
+  80127c:	6a 24                	push   $0x24
+  80127e:	68 c8 3b 80 00       	push   $0x803bc8
+  801283:	e8 59 f2 ff ff       	call   8004e1 <_panic>
+
+00801288 <sys_env_set_trapframe>:
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	57                   	push   %edi
+  80128c:	56                   	push   %esi
+  80128d:	53                   	push   %ebx
+  80128e:	83 ec 0c             	sub    $0xc,%esp
+  801291:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801296:	8b 55 08             	mov    0x8(%ebp),%edx
+  801299:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129c:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012a1:	89 df                	mov    %ebx,%edi
+  8012a3:	89 de                	mov    %ebx,%esi
+  8012a5:	cd 30                	int    $0x30
+  8012a7:	85 c0                	test   %eax,%eax
+  8012a9:	7f 08                	jg     8012b3 <sys_env_set_trapframe+0x2b>
+  8012ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ae:	5b                   	pop    %ebx
+  8012af:	5e                   	pop    %esi
+  8012b0:	5f                   	pop    %edi
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	c3                   	ret
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  8012b6:	50                   	push   %eax
+  8012b7:	6a 09                	push   $0x9
+  8012b9:	68 ab 3b 80 00       	push   $0x803bab
+  8012be:	6a 24                	push   $0x24
+  8012c0:	68 c8 3b 80 00       	push   $0x803bc8
+  8012c5:	e8 17 f2 ff ff       	call   8004e1 <_panic>
+
+008012ca <sys_env_set_cow>:
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+  8012d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012de:	b8 20 00 00 00       	mov    $0x20,%eax
+  8012e3:	89 df                	mov    %ebx,%edi
+  8012e5:	89 de                	mov    %ebx,%esi
+  8012e7:	cd 30                	int    $0x30
+  8012e9:	85 c0                	test   %eax,%eax
+  8012eb:	7f 08                	jg     8012f5 <sys_env_set_cow+0x2b>
+  8012ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+  8012f5:	83 ec 0c             	sub    $0xc,%esp
+  8012f8:	50                   	push   %eax
+  8012f9:	6a 20                	push   $0x20
+  8012fb:	68 ab 3b 80 00       	push   $0x803bab
+  801300:	6a 24                	push   $0x24
+  801302:	68 c8 3b 80 00       	push   $0x803bc8
+  801307:	e8 d5 f1 ff ff       	call   8004e1 <_panic>
+
+0080130c <sys_env_service>:
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	57                   	push   %edi
+  801310:	56                   	push   %esi
+  801311:	53                   	push   %ebx
+  801312:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801317:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80131f:	89 cb                	mov    %ecx,%ebx
+  801321:	89 cf                	mov    %ecx,%edi
+  801323:	89 ce                	mov    %ecx,%esi
+  801325:	cd 30                	int    $0x30
+  801327:	5b                   	pop    %ebx
+  801328:	5e                   	pop    %esi
+  801329:	5f                   	pop    %edi
+  80132a:	5d                   	pop    %ebp
+  80132b:	c3                   	ret
+
+0080132c <sys_env_set_pgfault_upcall>:
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	57                   	push   %edi
+  801330:	56                   	push   %esi
+  801331:	53                   	push   %ebx
+  801332:	83 ec 0c             	sub    $0xc,%esp
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801345:	89 df                	mov    %ebx,%edi
+  801347:	89 de                	mov    %ebx,%esi
+  801349:	cd 30                	int    $0x30
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	7f 08                	jg     801357 <sys_env_set_pgfault_upcall+0x2b>
+  80134f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801352:	5b                   	pop    %ebx
+  801353:	5e                   	pop    %esi
+  801354:	5f                   	pop    %edi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+  801357:	83 ec 0c             	sub    $0xc,%esp
+  80135a:	50                   	push   %eax
+  80135b:	6a 0a                	push   $0xa
+  80135d:	68 ab 3b 80 00       	push   $0x803bab
+  801362:	6a 24                	push   $0x24
+  801364:	68 c8 3b 80 00       	push   $0x803bc8
+  801369:	e8 73 f1 ff ff       	call   8004e1 <_panic>
+
+0080136e <sys_ipc_try_send>:
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	57                   	push   %edi
+  801372:	56                   	push   %esi
+  801373:	53                   	push   %ebx
+  801374:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  80137b:	74 27                	je     8013a4 <sys_ipc_try_send+0x36>
+  80137d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801380:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801383:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801388:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80138b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80138e:	6a 00                	push   $0x0
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	8d 35 9b 13 80 00    	lea    0x80139b,%esi
+  801399:	0f 34                	sysenter
+  80139b:	5d                   	pop    %ebp
+  80139c:	83 c4 04             	add    $0x4,%esp
+  80139f:	5b                   	pop    %ebx
+  8013a0:	5e                   	pop    %esi
+  8013a1:	5f                   	pop    %edi
+  8013a2:	5d                   	pop    %ebp
+  8013a3:	c3                   	ret
+  8013a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013ba:	cd 30                	int    $0x30
+  8013bc:	eb e1                	jmp    80139f <sys_ipc_try_send+0x31>
+
+008013be <sys_ipc_recv>:
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	57                   	push   %edi
+  8013c2:	56                   	push   %esi
+  8013c3:	53                   	push   %ebx
+  8013c4:	83 ec 0c             	sub    $0xc,%esp
+  8013c7:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8013ce:	74 32                	je     801402 <sys_ipc_recv+0x44>
+  8013d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013dd:	89 cb                	mov    %ecx,%ebx
+  8013df:	89 cf                	mov    %ecx,%edi
+  8013e1:	6a 00                	push   $0x0
+  8013e3:	55                   	push   %ebp
+  8013e4:	89 e5                	mov    %esp,%ebp
+  8013e6:	8d 35 ee 13 80 00    	lea    0x8013ee,%esi
+  8013ec:	0f 34                	sysenter
+  8013ee:	5d                   	pop    %ebp
+  8013ef:	83 c4 04             	add    $0x4,%esp
+  8013f2:	89 c2                	mov    %eax,%edx
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	7f 3c                	jg     801434 <sys_ipc_recv+0x76>
+  8013f8:	89 d0                	mov    %edx,%eax
+  8013fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fd:	5b                   	pop    %ebx
+  8013fe:	5e                   	pop    %esi
+  8013ff:	5f                   	pop    %edi
+  801400:	5d                   	pop    %ebp
+  801401:	c3                   	ret
+  801402:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801407:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80140c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140f:	89 cb                	mov    %ecx,%ebx
+  801411:	89 cf                	mov    %ecx,%edi
+  801413:	89 ce                	mov    %ecx,%esi
+  801415:	cd 30                	int    $0x30
+  801417:	89 c2                	mov    %eax,%edx
+  801419:	85 c0                	test   %eax,%eax
+  80141b:	7e db                	jle    8013f8 <sys_ipc_recv+0x3a>
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+  801420:	50                   	push   %eax
+  801421:	6a 0d                	push   $0xd
+  801423:	68 ab 3b 80 00       	push   $0x803bab
+  801428:	6a 24                	push   $0x24
+  80142a:	68 c8 3b 80 00       	push   $0x803bc8
+  80142f:	e8 ad f0 ff ff       	call   8004e1 <_panic>
+  801434:	83 ec 0c             	sub    $0xc,%esp
+  801437:	50                   	push   %eax
+  801438:	6a 0d                	push   $0xd
+  80143a:	68 ab 3b 80 00       	push   $0x803bab
+  80143f:	6a 48                	push   $0x48
+  801441:	68 c8 3b 80 00       	push   $0x803bc8
+  801446:	e8 96 f0 ff ff       	call   8004e1 <_panic>
+
+0080144b <sys_ipc_send>:
+  80144b:	55                   	push   %ebp
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	57                   	push   %edi
+  80144f:	56                   	push   %esi
+  801450:	53                   	push   %ebx
+  801451:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801458:	74 27                	je     801481 <sys_ipc_send+0x36>
+  80145a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801460:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801465:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801468:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80146b:	6a 00                	push   $0x0
+  80146d:	55                   	push   %ebp
+  80146e:	89 e5                	mov    %esp,%ebp
+  801470:	8d 35 78 14 80 00    	lea    0x801478,%esi
+  801476:	0f 34                	sysenter
+  801478:	5d                   	pop    %ebp
+  801479:	83 c4 04             	add    $0x4,%esp
+  80147c:	5b                   	pop    %ebx
+  80147d:	5e                   	pop    %esi
+  80147e:	5f                   	pop    %edi
+  80147f:	5d                   	pop    %ebp
+  801480:	c3                   	ret
+  801481:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801486:	be 00 00 00 00       	mov    $0x0,%esi
+  80148b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801491:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801494:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801497:	cd 30                	int    $0x30
+  801499:	eb e1                	jmp    80147c <sys_ipc_send+0x31>
+
+0080149b <sys_ipc_call>:
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	57                   	push   %edi
+  80149f:	56                   	push   %esi
+  8014a0:	53                   	push   %ebx
+  8014a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8014ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014b2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014b5:	cd 30                	int    $0x30
+  8014b7:	5b                   	pop    %ebx
+  8014b8:	5e                   	pop    %esi
+  8014b9:	5f                   	pop    %edi
+  8014ba:	5d                   	pop    %ebp
+  8014bb:	c3                   	ret
+
+008014bc <sys_ipc_reply_recv>:
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	57                   	push   %edi
+  8014c0:	56                   	push   %esi
+  8014c1:	53                   	push   %ebx
+  8014c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014d6:	cd 30                	int    $0x30
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5f                   	pop    %edi
+  8014db:	5d                   	pop    %ebp
+  8014dc:	c3                   	ret
+
+008014dd <sys_time_msec>:
+  8014dd:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	75 06                	jne    8014ec <sys_time_msec+0xf>
+  8014e6:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8014eb:	c3                   	ret
+  8014ec:	55                   	push   %ebp
+  8014ed:	89 e5                	mov    %esp,%ebp
+  8014ef:	57                   	push   %edi
+  8014f0:	56                   	push   %esi
+  8014f1:	53                   	push   %ebx
+  8014f2:	83 ec 0c             	sub    $0xc,%esp
+  8014f5:	0f 31                	rdtsc
+  8014f7:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8014fd:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  801503:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801509:	29 c8                	sub    %ecx,%eax
+  80150b:	19 da                	sbb    %ebx,%edx
+  80150d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801512:	57                   	push   %edi
+  801513:	56                   	push   %esi
+  801514:	52                   	push   %edx
+  801515:	50                   	push   %eax
+  801516:	e8 ae 21 00 00       	call   8036c9 <__udivdi3>
+  80151b:	83 c4 10             	add    $0x10,%esp
+  80151e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801521:	5b                   	pop    %ebx
+  801522:	5e                   	pop    %esi
+  801523:	5f                   	pop    %edi
+  801524:	5d                   	pop    %ebp
+  801525:	c3                   	ret
+
+00801526 <sys_env_swap>:
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+  801529:	57                   	push   %edi
+  80152a:	56                   	push   %esi
+  80152b:	53                   	push   %ebx
+  80152c:	83 ec 0c             	sub    $0xc,%esp
+  80152f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801534:	8b 55 08             	mov    0x8(%ebp),%edx
+  801537:	b8 12 00 00 00       	mov    $0x12,%eax
+  80153c:	89 cb                	mov    %ecx,%ebx
+  80153e:	89 cf                	mov    %ecx,%edi
+  801540:	89 ce                	mov    %ecx,%esi
+  801542:	cd 30                	int    $0x30
+  801544:	85 c0                	test   %eax,%eax
+  801546:	7f 08                	jg     801550 <sys_env_swap+0x2a>
+  801548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154b:	5b                   	pop    %ebx
+  80154c:	5e                   	pop    %esi
+  80154d:	5f                   	pop    %edi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+  801550:	83 ec 0c             	sub    $0xc,%esp
+  801553:	50                   	push   %eax
+  801554:	6a 12                	push   $0x12
+  801556:	68 ab 3b 80 00       	push   $0x803bab
+  80155b:	6a 24                	push   $0x24
+  80155d:	68 c8 3b 80 00       	push   $0x803bc8
+  801562:	e8 7a ef ff ff       	call   8004e1 <_panic>
+
+00801567 <sys_net_try_send>:
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	57                   	push   %edi
+  80156b:	56                   	push   %esi
+  80156c:	53                   	push   %ebx
+  80156d:	83 ec 0c             	sub    $0xc,%esp
+  801570:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801575:	8b 55 08             	mov    0x8(%ebp),%edx
+  801578:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801580:	89 df                	mov    %ebx,%edi
+  801582:	89 de                	mov    %ebx,%esi
+  801584:	cd 30                	int    $0x30
+  801586:	85 c0                	test   %eax,%eax
+  801588:	7f 08                	jg     801592 <sys_net_try_send+0x2b>
+  80158a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80158d:	5b                   	pop    %ebx
+  80158e:	5e                   	pop    %esi
+  80158f:	5f                   	pop    %edi
+  801590:	5d                   	pop    %ebp
+  801591:	c3                   	ret
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	50                   	push   %eax
+  801596:	6a 13                	push   $0x13
+  801598:	68 ab 3b 80 00       	push   $0x803bab
+  80159d:	6a 24                	push   $0x24
+  80159f:	68 c8 3b 80 00       	push   $0x803bc8
+  8015a4:	e8 38 ef ff ff       	call   8004e1 <_panic>
+
+008015a9 <sys_net_try_receive>:
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	57                   	push   %edi
+  8015ad:	56                   	push   %esi
+  8015ae:	53                   	push   %ebx
+  8015af:	83 ec 0c             	sub    $0xc,%esp
+  8015b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bd:	b8 14 00 00 00       	mov    $0x14,%eax
+  8015c2:	89 df                	mov    %ebx,%edi
+  8015c4:	89 de                	mov    %ebx,%esi
+  8015c6:	cd 30                	int    $0x30
+  8015c8:	85 c0                	test   %eax,%eax
+  8015ca:	7f 08                	jg     8015d4 <sys_net_try_receive+0x2b>
+  8015cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015cf:	5b                   	pop    %ebx
+  8015d0:	5e                   	pop    %esi
+  8015d1:	5f                   	pop    %edi
+  8015d2:	5d                   	pop    %ebp
+  8015d3:	c3                   	ret
+  8015d4:	83 ec 0c             	sub    $0xc,%esp
+  8015d7:	50                   	push   %eax
+  8015d8:	6a 14                	push   $0x14
+  8015da:	68 ab 3b 80 00       	push   $0x803bab
+  8015df:	6a 24                	push   $0x24
+  8015e1:	68 c8 3b 80 00       	push   $0x803bc8
+  8015e6:	e8 f6 ee ff ff       	call   8004e1 <_panic>
+
+008015eb <sys_net_recv_page>:
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+  8015f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	b8 27 00 00 00       	mov    $0x27,%eax
+  8015fe:	89 cb                	mov    %ecx,%ebx
+  801600:	89 cf                	mov    %ecx,%edi
+  801602:	89 ce                	mov    %ecx,%esi
+  801604:	cd 30                	int    $0x30
+  801606:	5b                   	pop    %ebx
+  801607:	5e                   	pop    %esi
+  801608:	5f                   	pop    %edi
+  801609:	5d                   	pop    %ebp
+  80160a:	c3                   	ret
+
+0080160b <sys_net_wait>:
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	57                   	push   %edi
+  80160f:	56                   	push   %esi
+  801610:	53                   	push   %ebx
+  801611:	ba 00 00 00 00       	mov    $0x0,%edx
+  801616:	b8 26 00 00 00       	mov    $0x26,%eax
+  80161b:	89 d1                	mov    %edx,%ecx
+  80161d:	89 d3                	mov    %edx,%ebx
+  80161f:	89 d7                	mov    %edx,%edi
+  801621:	89 d6                	mov    %edx,%esi
+  801623:	cd 30                	int    $0x30
+  801625:	5b                   	pop    %ebx
+  801626:	5e                   	pop    %esi
+  801627:	5f                   	pop    %edi
+  801628:	5d                   	pop    %ebp
+  801629:	c3                   	ret
+
+0080162a <sys_get_mac>:
+  80162a:	55                   	push   %ebp
+  80162b:	89 e5                	mov    %esp,%ebp
+  80162d:	57                   	push   %edi
+  80162e:	56                   	push   %esi
+  80162f:	53                   	push   %ebx
+  801630:	83 ec 0c             	sub    $0xc,%esp
+  801633:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801638:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801643:	89 df                	mov    %ebx,%edi
+  801645:	89 de                	mov    %ebx,%esi
+  801647:	cd 30                	int    $0x30
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	7f 08                	jg     801655 <sys_get_mac+0x2b>
+  80164d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5f                   	pop    %edi
+  801653:	5d                   	pop    %ebp
+  801654:	c3                   	ret
+  801655:	83 ec 0c             	sub    $0xc,%esp
+  801658:	50                   	push   %eax
+  801659:	6a 15                	push   $0x15
+  80165b:	68 ab 3b 80 00       	push   $0x803bab
+  801660:	6a 24                	push   $0x24
+  801662:	68 c8 3b 80 00       	push   $0x803bc8
+  801667:	e8 75 ee ff ff       	call   8004e1 <_panic>
+
+0080166c <sys_env_lease>:
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  80166f:	57                   	push   %edi
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+  801672:	83 ec 0c             	sub    $0xc,%esp
+  801675:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801680:	b8 16 00 00 00       	mov    $0x16,%eax
+  801685:	89 df                	mov    %ebx,%edi
+  801687:	89 de                	mov    %ebx,%esi
+  801689:	cd 30                	int    $0x30
+  80168b:	85 c0                	test   %eax,%eax
+  80168d:	7f 08                	jg     801697 <sys_env_lease+0x2b>
+  80168f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801692:	5b                   	pop    %ebx
+  801693:	5e                   	pop    %esi
+  801694:	5f                   	pop    %edi
+  801695:	5d                   	pop    %ebp
+  801696:	c3                   	ret
+  801697:	83 ec 0c             	sub    $0xc,%esp
+  80169a:	50                   	push   %eax
+  80169b:	6a 16                	push   $0x16
+  80169d:	68 ab 3b 80 00       	push   $0x803bab
+  8016a2:	6a 24                	push   $0x24
+  8016a4:	68 c8 3b 80 00       	push   $0x803bc8
+  8016a9:	e8 33 ee ff ff       	call   8004e1 <_panic>
+
+008016ae <sys_copy_mem>:
+  8016ae:	55                   	push   %ebp
+  8016af:	89 e5                	mov    %esp,%ebp
+  8016b1:	57                   	push   %edi
+  8016b2:	56                   	push   %esi
+  8016b3:	53                   	push   %ebx
+  8016b4:	83 ec 0c             	sub    $0xc,%esp
+  8016b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8016c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016cb:	cd 30                	int    $0x30
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	7f 08                	jg     8016d9 <sys_copy_mem+0x2b>
+  8016d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d4:	5b                   	pop    %ebx
+  8016d5:	5e                   	pop    %esi
+  8016d6:	5f                   	pop    %edi
+  8016d7:	5d                   	pop    %ebp
+  8016d8:	c3                   	ret
+  8016d9:	83 ec 0c             	sub    $0xc,%esp
+  8016dc:	50                   	push   %eax
+  8016dd:	6a 17                	push   $0x17
+  8016df:	68 ab 3b 80 00       	push   $0x803bab
+  8016e4:	6a 24                	push   $0x24
+  8016e6:	68 c8 3b 80 00       	push   $0x803bc8
+  8016eb:	e8 f1 ed ff ff       	call   8004e1 <_panic>
+
+008016f0 <sys_get_perms>:
+  8016f0:	55                   	push   %ebp
+  8016f1:	89 e5                	mov    %esp,%ebp
+  8016f3:	57                   	push   %edi
+  8016f4:	56                   	push   %esi
+  8016f5:	53                   	push   %ebx
+  8016f6:	83 ec 0c             	sub    $0xc,%esp
+  8016f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801701:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801704:	b8 18 00 00 00       	mov    $0x18,%eax
+  801709:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170c:	89 f7                	mov    %esi,%edi
+  80170e:	cd 30                	int    $0x30
+  801710:	85 c0                	test   %eax,%eax
+  801712:	7f 08                	jg     80171c <sys_get_perms+0x2c>
+  801714:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801717:	5b                   	pop    %ebx
+  801718:	5e                   	pop    %esi
+  801719:	5f                   	pop    %edi
+  80171a:	5d                   	pop    %ebp
+  80171b:	c3                   	ret
+  80171c:	83 ec 0c             	sub    $0xc,%esp
+  80171f:	50                   	push   %eax
+  801720:	6a 18                	push   $0x18
+  801722:	68 ab 3b 80 00       	push   $0x803bab
+  801727:	6a 24                	push   $0x24
+  801729:	68 c8 3b 80 00       	push   $0x803bc8
+  80172e:	e8 ae ed ff ff       	call   8004e1 <_panic>
+
+00801733 <sys_env_unsuspend>:
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	57                   	push   %edi
+  801737:	56                   	push   %esi
+  801738:	53                   	push   %ebx
+  801739:	83 ec 0c             	sub    $0xc,%esp
+  80173c:	be 00 00 00 00       	mov    $0x0,%esi
+  801741:	8b 55 08             	mov    0x8(%ebp),%edx
+  801744:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801747:	b8 19 00 00 00       	mov    $0x19,%eax
+  80174c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80174f:	89 f7                	mov    %esi,%edi
+  801751:	cd 30                	int    $0x30
+  801753:	85 c0                	test   %eax,%eax
+  801755:	7f 08                	jg     80175f <sys_env_unsuspend+0x2c>
+  801757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80175a:	5b                   	pop    %ebx
+  80175b:	5e                   	pop    %esi
+  80175c:	5f                   	pop    %edi
+  80175d:	5d                   	pop    %ebp
+  80175e:	c3                   	ret
+  80175f:	83 ec 0c             	sub    $0xc,%esp
+  801762:	50                   	push   %eax
+  801763:	6a 19                	push   $0x19
+  801765:	68 ab 3b 80 00       	push   $0x803bab
+  80176a:	6a 24                	push   $0x24
+  80176c:	68 c8 3b 80 00       	push   $0x803bc8
+  801771:	e8 6b ed ff ff       	call   8004e1 <_panic>
+
+00801776 <sys_migrate>:
+  801776:	55                   	push   %ebp
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	57                   	push   %edi
+  80177a:	56                   	push   %esi
+  80177b:	53                   	push   %ebx
+  80177c:	83 ec 0c             	sub    $0xc,%esp
+  80177f:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801784:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  80178a:	76 11                	jbe    80179d <sys_migrate+0x27>
+  80178c:	b8 00 00 80 00       	mov    $0x800000,%eax
+  801791:	0f b6 08             	movzbl (%eax),%ecx
+  801794:	05 00 10 00 00       	add    $0x1000,%eax
+  801799:	39 d0                	cmp    %edx,%eax
+  80179b:	72 f4                	jb     801791 <sys_migrate+0x1b>
+  80179d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017aa:	89 cb                	mov    %ecx,%ebx
+  8017ac:	89 cf                	mov    %ecx,%edi
+  8017ae:	89 ce                	mov    %ecx,%esi
+  8017b0:	cd 30                	int    $0x30
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	7f 08                	jg     8017be <sys_migrate+0x48>
+  8017b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b9:	5b                   	pop    %ebx
+  8017ba:	5e                   	pop    %esi
+  8017bb:	5f                   	pop    %edi
+  8017bc:	5d                   	pop    %ebp
+  8017bd:	c3                   	ret
+  8017be:	83 ec 0c             	sub    $0xc,%esp
+  8017c1:	50                   	push   %eax
+  8017c2:	6a 1a                	push   $0x1a
+  8017c4:	68 ab 3b 80 00       	push   $0x803bab
+  8017c9:	6a 24                	push   $0x24
+  8017cb:	68 c8 3b 80 00       	push   $0x803bc8
+  8017d0:	e8 0c ed ff ff       	call   8004e1 <_panic>
+
+008017d5 <sys_lease_complete>:
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	57                   	push   %edi
+  8017d9:	56                   	push   %esi
+  8017da:	53                   	push   %ebx
+  8017db:	83 ec 0c             	sub    $0xc,%esp
+  8017de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017e8:	89 d1                	mov    %edx,%ecx
+  8017ea:	89 d3                	mov    %edx,%ebx
+  8017ec:	89 d7                	mov    %edx,%edi
+  8017ee:	89 d6                	mov    %edx,%esi
+  8017f0:	cd 30                	int    $0x30
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	7f 08                	jg     8017fe <sys_lease_complete+0x29>
+  8017f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f9:	5b                   	pop    %ebx
+  8017fa:	5e                   	pop    %esi
+  8017fb:	5f                   	pop    %edi
+  8017fc:	5d                   	pop    %ebp
+  8017fd:	c3                   	ret
+  8017fe:	83 ec 0c             	sub    $0xc,%esp
+  801801:	50                   	push   %eax
+  801802:	6a 1b                	push   $0x1b
+  801804:	68 ab 3b 80 00       	push   $0x803bab
+  801809:	6a 24                	push   $0x24
+  80180b:	68 c8 3b 80 00       	push   $0x803bc8
+  801810:	e8 cc ec ff ff       	call   8004e1 <_panic>
+
+00801815 <sys_env_set_thisenv>:
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	57                   	push   %edi
+  801819:	56                   	push   %esi
+  80181a:	53                   	push   %ebx
+  80181b:	83 ec 0c             	sub    $0xc,%esp
+  80181e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801823:	8b 55 08             	mov    0x8(%ebp),%edx
+  801826:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801829:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80182e:	89 df                	mov    %ebx,%edi
+  801830:	89 de                	mov    %ebx,%esi
+  801832:	cd 30                	int    $0x30
+  801834:	85 c0                	test   %eax,%eax
+  801836:	7f 08                	jg     801840 <sys_env_set_thisenv+0x2b>
+  801838:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80183b:	5b                   	pop    %ebx
+  80183c:	5e                   	pop    %esi
+  80183d:	5f                   	pop    %edi
+  80183e:	5d                   	pop    %ebp
+  80183f:	c3                   	ret
+  801840:	83 ec 0c             	sub    $0xc,%esp
+  801843:	50                   	push   %eax
+  801844:	6a 1c                	push   $0x1c
+  801846:	68 ab 3b 80 00       	push   $0x803bab
+  80184b:	6a 24                	push   $0x24
+  80184d:	68 c8 3b 80 00       	push   $0x803bc8
+  801852:	e8 8a ec ff ff       	call   8004e1 <_panic>
+
+00801857 <sys_env_set_sched>:
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	57                   	push   %edi
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+  80185d:	83 ec 0c             	sub    $0xc,%esp
+  801860:	be 00 00 00 00       	mov    $0x0,%esi
+  801865:	8b 55 08             	mov    0x8(%ebp),%edx
+  801868:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80186b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801870:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801873:	89 f7                	mov    %esi,%edi
+  801875:	cd 30                	int    $0x30
+  801877:	85 c0                	test   %eax,%eax
+  801879:	7f 08                	jg     801883 <sys_env_set_sched+0x2c>
+  80187b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80187e:	5b                   	pop    %ebx
+  80187f:	5e                   	pop    %esi
+  801880:	5f                   	pop    %edi
+  801881:	5d                   	pop    %ebp
+  801882:	c3                   	ret
+  801883:	83 ec 0c             	sub    $0xc,%esp
+  801886:	50                   	push   %eax
+  801887:	6a 1d                	push   $0x1d
+  801889:	68 ab 3b 80 00       	push   $0x803bab
+  80188e:	6a 24                	push   $0x24
+  801890:	68 c8 3b 80 00       	push   $0x803bc8
+  801895:	e8 47 ec ff ff       	call   8004e1 <_panic>
+
+0080189a <sys_batch>:
+  80189a:	55                   	push   %ebp
+  80189b:	89 e5                	mov    %esp,%ebp
+  80189d:	57                   	push   %edi
+  80189e:	56                   	push   %esi
+  80189f:	53                   	push   %ebx
+  8018a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ab:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8018b0:	89 df                	mov    %ebx,%edi
+  8018b2:	89 de                	mov    %ebx,%esi
+  8018b4:	cd 30                	int    $0x30
+  8018b6:	5b                   	pop    %ebx
+  8018b7:	5e                   	pop    %esi
+  8018b8:	5f                   	pop    %edi
+  8018b9:	5d                   	pop    %ebp
+  8018ba:	c3                   	ret
+
+008018bb <sys_env_stats>:
+  8018bb:	55                   	push   %ebp
+  8018bc:	89 e5                	mov    %esp,%ebp
+  8018be:	57                   	push   %edi
+  8018bf:	56                   	push   %esi
+  8018c0:	53                   	push   %ebx
+  8018c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018cc:	b8 23 00 00 00       	mov    $0x23,%eax
+  8018d1:	89 df                	mov    %ebx,%edi
+  8018d3:	89 de                	mov    %ebx,%esi
+  8018d5:	cd 30                	int    $0x30
+  8018d7:	5b                   	pop    %ebx
+  8018d8:	5e                   	pop    %esi
+  8018d9:	5f                   	pop    %edi
+  8018da:	5d                   	pop    %ebp
+  8018db:	c3                   	ret
+
+008018dc <sys_trace>:
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	57                   	push   %edi
+  8018e0:	56                   	push   %esi
+  8018e1:	53                   	push   %ebx
+  8018e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ea:	b8 24 00 00 00       	mov    $0x24,%eax
+  8018ef:	89 cb                	mov    %ecx,%ebx
+  8018f1:	89 cf                	mov    %ecx,%edi
+  8018f3:	89 ce                	mov    %ecx,%esi
+  8018f5:	cd 30                	int    $0x30
+  8018f7:	5b                   	pop    %ebx
+  8018f8:	5e                   	pop    %esi
+  8018f9:	5f                   	pop    %edi
+  8018fa:	5d                   	pop    %ebp
+  8018fb:	c3                   	ret
+
+008018fc <sys_env_set_pager>:
+  8018fc:	55                   	push   %ebp
+  8018fd:	89 e5                	mov    %esp,%ebp
+  8018ff:	57                   	push   %edi
+  801900:	56                   	push   %esi
+  801901:	53                   	push   %ebx
+  801902:	83 ec 0c             	sub    $0xc,%esp
+  801905:	be 00 00 00 00       	mov    $0x0,%esi
+  80190a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801910:	b8 25 00 00 00       	mov    $0x25,%eax
+  801915:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801918:	89 f7                	mov    %esi,%edi
+  80191a:	cd 30                	int    $0x30
+  80191c:	85 c0                	test   %eax,%eax
+  80191e:	7f 08                	jg     801928 <sys_env_set_pager+0x2c>
+  801920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801923:	5b                   	pop    %ebx
+  801924:	5e                   	pop    %esi
+  801925:	5f                   	pop    %edi
+  801926:	5d                   	pop    %ebp
+  801927:	c3                   	ret
+  801928:	83 ec 0c             	sub    $0xc,%esp
+  80192b:	50                   	push   %eax
+  80192c:	6a 25                	push   $0x25
+  80192e:	68 ab 3b 80 00       	push   $0x803bab
+  801933:	6a 24                	push   $0x24
+  801935:	68 c8 3b 80 00       	push   $0x803bc8
+  80193a:	e8 a2 eb ff ff       	call   8004e1 <_panic>
+
+0080193f <sys_pager_retire>:
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	57                   	push   %edi
+  801943:	56                   	push   %esi
+  801944:	53                   	push   %ebx
+  801945:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80194a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194d:	b8 28 00 00 00       	mov    $0x28,%eax
+  801952:	89 cb                	mov    %ecx,%ebx
+  801954:	89 cf                	mov    %ecx,%edi
+  801956:	89 ce                	mov    %ecx,%esi
+  801958:	cd 30                	int    $0x30
+  80195a:	5b                   	pop    %ebx
+  80195b:	5e                   	pop    %esi
+  80195c:	5f                   	pop    %edi
+  80195d:	5d                   	pop    %ebp
+  80195e:	c3                   	ret
+
+0080195f <sys_prof>:
+  80195f:	55                   	push   %ebp
+  801960:	89 e5                	mov    %esp,%ebp
+  801962:	57                   	push   %edi
+  801963:	56                   	push   %esi
+  801964:	53                   	push   %ebx
+  801965:	be 00 00 00 00       	mov    $0x0,%esi
+  80196a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801970:	b8 22 00 00 00       	mov    $0x22,%eax
+  801975:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801978:	89 f7                	mov    %esi,%edi
+  80197a:	cd 30                	int    $0x30
+  80197c:	5b                   	pop    %ebx
+  80197d:	5e                   	pop    %esi
+  80197e:	5f                   	pop    %edi
+  80197f:	5d                   	pop    %ebp
+  801980:	c3                   	ret
+
+00801981 <argstart>:
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	8b 55 08             	mov    0x8(%ebp),%edx
+  801987:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80198d:	89 10                	mov    %edx,(%eax)
+  80198f:	89 48 04             	mov    %ecx,0x4(%eax)
+  801992:	83 3a 01             	cmpl   $0x1,(%edx)
+  801995:	7e 09                	jle    8019a0 <argstart+0x1f>
+  801997:	ba cf 3c 80 00       	mov    $0x803ccf,%edx
+  80199c:	85 c9                	test   %ecx,%ecx
+  80199e:	75 05                	jne    8019a5 <argstart+0x24>
+  8019a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a5:	89 50 08             	mov    %edx,0x8(%eax)
+  8019a8:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8019af:	5d                   	pop    %ebp
+  8019b0:	c3                   	ret
+
+008019b1 <argnext>:
+  8019b1:	55                   	push   %ebp
+  8019b2:	89 e5                	mov    %esp,%ebp
+  8019b4:	53                   	push   %ebx
+  8019b5:	83 ec 04             	sub    $0x4,%esp
+  8019b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019bb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  8019c2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019c5:	85 c0                	test   %eax,%eax
+  8019c7:	74 74                	je     801a3d <argnext+0x8c>
+  8019c9:	80 38 00             	cmpb   $0x0,(%eax)
+  8019cc:	75 48                	jne    801a16 <argnext+0x65>
+  8019ce:	8b 0b                	mov    (%ebx),%ecx
+  8019d0:	83 39 01             	cmpl   $0x1,(%ecx)
+  8019d3:	74 5a                	je     801a2f <argnext+0x7e>
+  8019d5:	8b 53 04             	mov    0x4(%ebx),%edx
+  8019d8:	8b 42 04             	mov    0x4(%edx),%eax
+  8019db:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8019de:	75 4f                	jne    801a2f <argnext+0x7e>
+  8019e0:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8019e4:	74 49                	je     801a2f <argnext+0x7e>
+  8019e6:	83 c0 01             	add    $0x1,%eax
+  8019e9:	89 43 08             	mov    %eax,0x8(%ebx)
+  8019ec:	83 ec 04             	sub    $0x4,%esp
+  8019ef:	8b 01                	mov    (%ecx),%eax
+  8019f1:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8019f8:	50                   	push   %eax
+  8019f9:	8d 42 08             	lea    0x8(%edx),%eax
+  8019fc:	50                   	push   %eax
+  8019fd:	83 c2 04             	add    $0x4,%edx
+  801a00:	52                   	push   %edx
+  801a01:	e8 5d f4 ff ff       	call   800e63 <memmove>
+  801a06:	8b 03                	mov    (%ebx),%eax
+  801a08:	83 28 01             	subl   $0x1,(%eax)
+  801a0b:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a0e:	83 c4 10             	add    $0x10,%esp
+  801a11:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801a14:	74 13                	je     801a29 <argnext+0x78>
+  801a16:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a19:	0f b6 10             	movzbl (%eax),%edx
+  801a1c:	83 c0 01             	add    $0x1,%eax
+  801a1f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801a22:	89 d0                	mov    %edx,%eax
+  801a24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a27:	c9                   	leave
+  801a28:	c3                   	ret
+  801a29:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801a2d:	75 e7                	jne    801a16 <argnext+0x65>
+  801a2f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801a36:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801a3b:	eb e5                	jmp    801a22 <argnext+0x71>
+  801a3d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801a42:	eb de                	jmp    801a22 <argnext+0x71>
+
+00801a44 <argnextvalue>:
+  801a44:	55                   	push   %ebp
+  801a45:	89 e5                	mov    %esp,%ebp
+  801a47:	53                   	push   %ebx
+  801a48:	83 ec 04             	sub    $0x4,%esp
+  801a4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a4e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	74 12                	je     801a67 <argnextvalue+0x23>
+  801a55:	80 38 00             	cmpb   $0x0,(%eax)
+  801a58:	74 12                	je     801a6c <argnextvalue+0x28>
+  801a5a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801a5d:	c7 43 08 cf 3c 80 00 	movl   $0x803ccf,0x8(%ebx)
+  801a64:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6a:	c9                   	leave
+  801a6b:	c3                   	ret
+  801a6c:	8b 13                	mov    (%ebx),%edx
+  801a6e:	83 3a 01             	cmpl   $0x1,(%edx)
+  801a71:	7f 10                	jg     801a83 <argnextvalue+0x3f>
+  801a73:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  801a7a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801a81:	eb e1                	jmp    801a64 <argnextvalue+0x20>
+  801a83:	8b 43 04             	mov    0x4(%ebx),%eax
+  801a86:	8b 48 04             	mov    0x4(%eax),%ecx
+  801a89:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+  801a8c:	83 ec 04             	sub    $0x4,%esp
+  801a8f:	8b 12                	mov    (%edx),%edx
+  801a91:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801a98:	52                   	push   %edx
+  801a99:	8d 50 08             	lea    0x8(%eax),%edx
+  801a9c:	52                   	push   %edx
+  801a9d:	83 c0 04             	add    $0x4,%eax
+  801aa0:	50                   	push   %eax
+  801aa1:	e8 bd f3 ff ff       	call   800e63 <memmove>
+  801aa6:	8b 03                	mov    (%ebx),%eax
+  801aa8:	83 28 01             	subl   $0x1,(%eax)
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	eb b4                	jmp    801a64 <argnextvalue+0x20>
+
+00801ab0 <argvalue>:
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	83 ec 08             	sub    $0x8,%esp
+  801ab6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab9:	8b 42 0c             	mov    0xc(%edx),%eax
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	74 02                	je     801ac2 <argvalue+0x12>
+  801ac0:	c9                   	leave
+  801ac1:	c3                   	ret
+  801ac2:	83 ec 0c             	sub    $0xc,%esp
+  801ac5:	52                   	push   %edx
+  801ac6:	e8 79 ff ff ff       	call   801a44 <argnextvalue>
+  801acb:	83 c4 10             	add    $0x10,%esp
+  801ace:	eb f0                	jmp    801ac0 <argvalue+0x10>
+
+00801ad0 <fd2num>:
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ad6:	05 00 00 00 30       	add    $0x30000000,%eax
+  801adb:	c1 e8 0c             	shr    $0xc,%eax
+  801ade:	5d                   	pop    %ebp
+  801adf:	c3                   	ret
+
+00801ae0 <fd2data>:
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae6:	05 00 00 00 30       	add    $0x30000000,%eax
+  801aeb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801af0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801af5:	5d                   	pop    %ebp
+  801af6:	c3                   	ret
+
+00801af7 <fd_alloc>:
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801aff:	89 c2                	mov    %eax,%edx
+  801b01:	c1 ea 16             	shr    $0x16,%edx
+  801b04:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b0b:	f6 c2 01             	test   $0x1,%dl
+  801b0e:	74 29                	je     801b39 <fd_alloc+0x42>
+  801b10:	89 c2                	mov    %eax,%edx
+  801b12:	c1 ea 0c             	shr    $0xc,%edx
+  801b15:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b1c:	f6 c2 01             	test   $0x1,%dl
+  801b1f:	74 18                	je     801b39 <fd_alloc+0x42>
+  801b21:	05 00 10 00 00       	add    $0x1000,%eax
+  801b26:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801b2b:	75 d2                	jne    801aff <fd_alloc+0x8>
+  801b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b32:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b37:	eb 05                	jmp    801b3e <fd_alloc+0x47>
+  801b39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b41:	89 02                	mov    %eax,(%edx)
+  801b43:	89 c8                	mov    %ecx,%eax
+  801b45:	5d                   	pop    %ebp
+  801b46:	c3                   	ret
+
+00801b47 <fd_lookup>:
+  801b47:	55                   	push   %ebp
+  801b48:	89 e5                	mov    %esp,%ebp
+  801b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4d:	83 f8 1f             	cmp    $0x1f,%eax
+  801b50:	77 30                	ja     801b82 <fd_lookup+0x3b>
+  801b52:	c1 e0 0c             	shl    $0xc,%eax
+  801b55:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801b5a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b60:	f6 c2 01             	test   $0x1,%dl
+  801b63:	74 24                	je     801b89 <fd_lookup+0x42>
+  801b65:	89 c2                	mov    %eax,%edx
+  801b67:	c1 ea 0c             	shr    $0xc,%edx
+  801b6a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b71:	f6 c2 01             	test   $0x1,%dl
+  801b74:	74 1a                	je     801b90 <fd_lookup+0x49>
+  801b76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b79:	89 02                	mov    %eax,(%edx)
+  801b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b80:	5d                   	pop    %ebp
+  801b81:	c3                   	ret
+  801b82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b87:	eb f7                	jmp    801b80 <fd_lookup+0x39>
+  801b89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b8e:	eb f0                	jmp    801b80 <fd_lookup+0x39>
+  801b90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b95:	eb e9                	jmp    801b80 <fd_lookup+0x39>
+
+00801b97 <dev_lookup>:
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+  801b9a:	53                   	push   %ebx
+  801b9b:	83 ec 04             	sub    $0x4,%esp
+  801b9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba6:	bb 08 40 80 00       	mov    $0x804008,%ebx
+  801bab:	39 13                	cmp    %edx,(%ebx)
+  801bad:	74 37                	je     801be6 <dev_lookup+0x4f>
+  801baf:	83 c0 01             	add    $0x1,%eax
+  801bb2:	8b 1c 85 54 3c 80 00 	mov    0x803c54(,%eax,4),%ebx
+  801bb9:	85 db                	test   %ebx,%ebx
+  801bbb:	75 ee                	jne    801bab <dev_lookup+0x14>
+  801bbd:	a1 88 60 80 00       	mov    0x806088,%eax
+  801bc2:	8b 40 48             	mov    0x48(%eax),%eax
+  801bc5:	83 ec 04             	sub    $0x4,%esp
+  801bc8:	52                   	push   %edx
+  801bc9:	50                   	push   %eax
+  801bca:	68 d8 3b 80 00       	push   $0x803bd8
+  801bcf:	e8 e8 e9 ff ff       	call   8005bc <cprintf>
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bdf:	89 1a                	mov    %ebx,(%edx)
+  801be1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be4:	c9                   	leave
+  801be5:	c3                   	ret
+  801be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801beb:	eb ef                	jmp    801bdc <dev_lookup+0x45>
+
+00801bed <fd_close>:
+  801bed:	55                   	push   %ebp
+  801bee:	89 e5                	mov    %esp,%ebp
+  801bf0:	57                   	push   %edi
+  801bf1:	56                   	push   %esi
+  801bf2:	53                   	push   %ebx
+  801bf3:	83 ec 24             	sub    $0x24,%esp
+  801bf6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bf9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801bfc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bff:	50                   	push   %eax
+  801c00:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c06:	c1 e8 0c             	shr    $0xc,%eax
+  801c09:	50                   	push   %eax
+  801c0a:	e8 38 ff ff ff       	call   801b47 <fd_lookup>
+  801c0f:	89 c3                	mov    %eax,%ebx
+  801c11:	83 c4 10             	add    $0x10,%esp
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	78 05                	js     801c1d <fd_close+0x30>
+  801c18:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c1b:	74 0f                	je     801c2c <fd_close+0x3f>
+  801c1d:	85 ff                	test   %edi,%edi
+  801c1f:	0f 44 df             	cmove  %edi,%ebx
+  801c22:	89 d8                	mov    %ebx,%eax
+  801c24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c27:	5b                   	pop    %ebx
+  801c28:	5e                   	pop    %esi
+  801c29:	5f                   	pop    %edi
+  801c2a:	5d                   	pop    %ebp
+  801c2b:	c3                   	ret
+  801c2c:	83 ec 08             	sub    $0x8,%esp
+  801c2f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c32:	50                   	push   %eax
+  801c33:	ff 36                	push   (%esi)
+  801c35:	e8 5d ff ff ff       	call   801b97 <dev_lookup>
+  801c3a:	89 c3                	mov    %eax,%ebx
+  801c3c:	83 c4 10             	add    $0x10,%esp
+  801c3f:	85 c0                	test   %eax,%eax
+  801c41:	78 1a                	js     801c5d <fd_close+0x70>
+  801c43:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c46:	8b 40 10             	mov    0x10(%eax),%eax
+  801c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c4e:	85 c0                	test   %eax,%eax
+  801c50:	74 0b                	je     801c5d <fd_close+0x70>
+  801c52:	83 ec 0c             	sub    $0xc,%esp
+  801c55:	56                   	push   %esi
+  801c56:	ff d0                	call   *%eax
+  801c58:	89 c3                	mov    %eax,%ebx
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	83 ec 08             	sub    $0x8,%esp
+  801c60:	56                   	push   %esi
+  801c61:	6a 00                	push   $0x0
+  801c63:	e8 7d f5 ff ff       	call   8011e5 <sys_page_unmap>
+  801c68:	83 c4 10             	add    $0x10,%esp
+  801c6b:	eb b5                	jmp    801c22 <fd_close+0x35>
+
+00801c6d <close>:
+  801c6d:	55                   	push   %ebp
+  801c6e:	89 e5                	mov    %esp,%ebp
+  801c70:	83 ec 20             	sub    $0x20,%esp
+  801c73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c76:	50                   	push   %eax
+  801c77:	ff 75 08             	push   0x8(%ebp)
+  801c7a:	e8 c8 fe ff ff       	call   801b47 <fd_lookup>
+  801c7f:	83 c4 10             	add    $0x10,%esp
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	79 02                	jns    801c88 <close+0x1b>
+  801c86:	c9                   	leave
+  801c87:	c3                   	ret
+  801c88:	83 ec 08             	sub    $0x8,%esp
+  801c8b:	6a 01                	push   $0x1
+  801c8d:	ff 75 f4             	push   -0xc(%ebp)
+  801c90:	e8 58 ff ff ff       	call   801bed <fd_close>
+  801c95:	83 c4 10             	add    $0x10,%esp
+  801c98:	eb ec                	jmp    801c86 <close+0x19>
+
+00801c9a <close_all>:
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	53                   	push   %ebx
+  801c9e:	83 ec 04             	sub    $0x4,%esp
+  801ca1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca6:	83 ec 0c             	sub    $0xc,%esp
+  801ca9:	53                   	push   %ebx
+  801caa:	e8 be ff ff ff       	call   801c6d <close>
+  801caf:	83 c3 01             	add    $0x1,%ebx
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	83 fb 20             	cmp    $0x20,%ebx
+  801cb8:	75 ec                	jne    801ca6 <close_all+0xc>
+  801cba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cbd:	c9                   	leave
+  801cbe:	c3                   	ret
+
+00801cbf <dup>:
+  801cbf:	55                   	push   %ebp
+  801cc0:	89 e5                	mov    %esp,%ebp
+  801cc2:	57                   	push   %edi
+  801cc3:	56                   	push   %esi
+  801cc4:	53                   	push   %ebx
+  801cc5:	83 ec 34             	sub    $0x34,%esp
+  801cc8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ccb:	50                   	push   %eax
+  801ccc:	ff 75 08             	push   0x8(%ebp)
+  801ccf:	e8 73 fe ff ff       	call   801b47 <fd_lookup>
+  801cd4:	89 c3                	mov    %eax,%ebx
+  801cd6:	83 c4 10             	add    $0x10,%esp
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	78 7f                	js     801d5c <dup+0x9d>
+  801cdd:	83 ec 0c             	sub    $0xc,%esp
+  801ce0:	ff 75 0c             	push   0xc(%ebp)
+  801ce3:	e8 85 ff ff ff       	call   801c6d <close>
+  801ce8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ceb:	c1 e6 0c             	shl    $0xc,%esi
+  801cee:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801cf4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801cf7:	89 3c 24             	mov    %edi,(%esp)
+  801cfa:	e8 e1 fd ff ff       	call   801ae0 <fd2data>
+  801cff:	89 c3                	mov    %eax,%ebx
+  801d01:	89 34 24             	mov    %esi,(%esp)
+  801d04:	e8 d7 fd ff ff       	call   801ae0 <fd2data>
+  801d09:	83 c4 10             	add    $0x10,%esp
+  801d0c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d0f:	89 d8                	mov    %ebx,%eax
+  801d11:	c1 e8 16             	shr    $0x16,%eax
+  801d14:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d1b:	a8 01                	test   $0x1,%al
+  801d1d:	74 11                	je     801d30 <dup+0x71>
+  801d1f:	89 d8                	mov    %ebx,%eax
+  801d21:	c1 e8 0c             	shr    $0xc,%eax
+  801d24:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d2b:	f6 c2 01             	test   $0x1,%dl
+  801d2e:	75 36                	jne    801d66 <dup+0xa7>
+  801d30:	89 f8                	mov    %edi,%eax
+  801d32:	c1 e8 0c             	shr    $0xc,%eax
+  801d35:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d3c:	83 ec 0c             	sub    $0xc,%esp
+  801d3f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d44:	50                   	push   %eax
+  801d45:	56                   	push   %esi
+  801d46:	6a 00                	push   $0x0
+  801d48:	57                   	push   %edi
+  801d49:	6a 00                	push   $0x0
+  801d4b:	e8 06 f4 ff ff       	call   801156 <sys_page_map>
+  801d50:	89 c3                	mov    %eax,%ebx
+  801d52:	83 c4 20             	add    $0x20,%esp
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	78 33                	js     801d8c <dup+0xcd>
+  801d59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d5c:	89 d8                	mov    %ebx,%eax
+  801d5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d61:	5b                   	pop    %ebx
+  801d62:	5e                   	pop    %esi
+  801d63:	5f                   	pop    %edi
+  801d64:	5d                   	pop    %ebp
+  801d65:	c3                   	ret
+  801d66:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d6d:	83 ec 0c             	sub    $0xc,%esp
+  801d70:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d75:	50                   	push   %eax
+  801d76:	ff 75 d4             	push   -0x2c(%ebp)
+  801d79:	6a 00                	push   $0x0
+  801d7b:	53                   	push   %ebx
+  801d7c:	6a 00                	push   $0x0
+  801d7e:	e8 d3 f3 ff ff       	call   801156 <sys_page_map>
+  801d83:	89 c3                	mov    %eax,%ebx
+  801d85:	83 c4 20             	add    $0x20,%esp
+  801d88:	85 c0                	test   %eax,%eax
+  801d8a:	79 a4                	jns    801d30 <dup+0x71>
+  801d8c:	83 ec 08             	sub    $0x8,%esp
+  801d8f:	56                   	push   %esi
+  801d90:	6a 00                	push   $0x0
+  801d92:	e8 4e f4 ff ff       	call   8011e5 <sys_page_unmap>
+  801d97:	83 c4 08             	add    $0x8,%esp
+  801d9a:	ff 75 d4             	push   -0x2c(%ebp)
+  801d9d:	6a 00                	push   $0x0
+  801d9f:	e8 41 f4 ff ff       	call   8011e5 <sys_page_unmap>
+  801da4:	83 c4 10             	add    $0x10,%esp
+  801da7:	eb b3                	jmp    801d5c <dup+0x9d>
+
+00801da9 <read>:
+  801da9:	55                   	push   %ebp
+  801daa:	89 e5                	mov    %esp,%ebp
+  801dac:	56                   	push   %esi
+  801dad:	53                   	push   %ebx
+  801dae:	83 ec 18             	sub    $0x18,%esp
+  801db1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801db4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801db7:	50                   	push   %eax
+  801db8:	56                   	push   %esi
+  801db9:	e8 89 fd ff ff       	call   801b47 <fd_lookup>
+  801dbe:	83 c4 10             	add    $0x10,%esp
+  801dc1:	85 c0                	test   %eax,%eax
+  801dc3:	78 3c                	js     801e01 <read+0x58>
+  801dc5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801dc8:	83 ec 08             	sub    $0x8,%esp
+  801dcb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dce:	50                   	push   %eax
+  801dcf:	ff 33                	push   (%ebx)
+  801dd1:	e8 c1 fd ff ff       	call   801b97 <dev_lookup>
+  801dd6:	83 c4 10             	add    $0x10,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 24                	js     801e01 <read+0x58>
+  801ddd:	8b 43 08             	mov    0x8(%ebx),%eax
+  801de0:	83 e0 03             	and    $0x3,%eax
+  801de3:	83 f8 01             	cmp    $0x1,%eax
+  801de6:	74 20                	je     801e08 <read+0x5f>
+  801de8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801deb:	8b 40 08             	mov    0x8(%eax),%eax
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	74 37                	je     801e29 <read+0x80>
+  801df2:	83 ec 04             	sub    $0x4,%esp
+  801df5:	ff 75 10             	push   0x10(%ebp)
+  801df8:	ff 75 0c             	push   0xc(%ebp)
+  801dfb:	53                   	push   %ebx
+  801dfc:	ff d0                	call   *%eax
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e04:	5b                   	pop    %ebx
+  801e05:	5e                   	pop    %esi
+  801e06:	5d                   	pop    %ebp
+  801e07:	c3                   	ret
+  801e08:	a1 88 60 80 00       	mov    0x806088,%eax
+  801e0d:	8b 40 48             	mov    0x48(%eax),%eax
+  801e10:	83 ec 04             	sub    $0x4,%esp
+  801e13:	56                   	push   %esi
+  801e14:	50                   	push   %eax
+  801e15:	68 19 3c 80 00       	push   $0x803c19
+  801e1a:	e8 9d e7 ff ff       	call   8005bc <cprintf>
+  801e1f:	83 c4 10             	add    $0x10,%esp
+  801e22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e27:	eb d8                	jmp    801e01 <read+0x58>
+  801e29:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e2e:	eb d1                	jmp    801e01 <read+0x58>
+
+00801e30 <readn>:
+  801e30:	55                   	push   %ebp
+  801e31:	89 e5                	mov    %esp,%ebp
+  801e33:	57                   	push   %edi
+  801e34:	56                   	push   %esi
+  801e35:	53                   	push   %ebx
+  801e36:	83 ec 0c             	sub    $0xc,%esp
+  801e39:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e3c:	8b 75 10             	mov    0x10(%ebp),%esi
+  801e3f:	85 f6                	test   %esi,%esi
+  801e41:	74 30                	je     801e73 <readn+0x43>
+  801e43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	83 ec 04             	sub    $0x4,%esp
+  801e50:	89 f2                	mov    %esi,%edx
+  801e52:	29 c2                	sub    %eax,%edx
+  801e54:	52                   	push   %edx
+  801e55:	01 f8                	add    %edi,%eax
+  801e57:	50                   	push   %eax
+  801e58:	ff 75 08             	push   0x8(%ebp)
+  801e5b:	e8 49 ff ff ff       	call   801da9 <read>
+  801e60:	83 c4 10             	add    $0x10,%esp
+  801e63:	85 c0                	test   %eax,%eax
+  801e65:	78 15                	js     801e7c <readn+0x4c>
+  801e67:	74 11                	je     801e7a <readn+0x4a>
+  801e69:	01 c3                	add    %eax,%ebx
+  801e6b:	89 d8                	mov    %ebx,%eax
+  801e6d:	39 f3                	cmp    %esi,%ebx
+  801e6f:	72 dc                	jb     801e4d <readn+0x1d>
+  801e71:	eb 09                	jmp    801e7c <readn+0x4c>
+  801e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e78:	eb 02                	jmp    801e7c <readn+0x4c>
+  801e7a:	89 d8                	mov    %ebx,%eax
+  801e7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7f:	5b                   	pop    %ebx
+  801e80:	5e                   	pop    %esi
+  801e81:	5f                   	pop    %edi
+  801e82:	5d                   	pop    %ebp
+  801e83:	c3                   	ret
+
+00801e84 <write>:
+  801e84:	55                   	push   %ebp
+  801e85:	89 e5                	mov    %esp,%ebp
+  801e87:	56                   	push   %esi
+  801e88:	53                   	push   %ebx
+  801e89:	83 ec 18             	sub    $0x18,%esp
+  801e8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e8f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e92:	50                   	push   %eax
+  801e93:	53                   	push   %ebx
+  801e94:	e8 ae fc ff ff       	call   801b47 <fd_lookup>
+  801e99:	83 c4 10             	add    $0x10,%esp
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	78 37                	js     801ed7 <write+0x53>
+  801ea0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ea3:	83 ec 08             	sub    $0x8,%esp
+  801ea6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea9:	50                   	push   %eax
+  801eaa:	ff 36                	push   (%esi)
+  801eac:	e8 e6 fc ff ff       	call   801b97 <dev_lookup>
+  801eb1:	83 c4 10             	add    $0x10,%esp
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	78 1f                	js     801ed7 <write+0x53>
+  801eb8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ebc:	74 20                	je     801ede <write+0x5a>
+  801ebe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ec4:	85 c0                	test   %eax,%eax
+  801ec6:	74 37                	je     801eff <write+0x7b>
+  801ec8:	83 ec 04             	sub    $0x4,%esp
+  801ecb:	ff 75 10             	push   0x10(%ebp)
+  801ece:	ff 75 0c             	push   0xc(%ebp)
+  801ed1:	56                   	push   %esi
+  801ed2:	ff d0                	call   *%eax
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eda:	5b                   	pop    %ebx
+  801edb:	5e                   	pop    %esi
+  801edc:	5d                   	pop    %ebp
+  801edd:	c3                   	ret
+  801ede:	a1 88 60 80 00       	mov    0x806088,%eax
+  801ee3:	8b 40 48             	mov    0x48(%eax),%eax
+  801ee6:	83 ec 04             	sub    $0x4,%esp
+  801ee9:	53                   	push   %ebx
+  801eea:	50                   	push   %eax
+  801eeb:	68 35 3c 80 00       	push   $0x803c35
+  801ef0:	e8 c7 e6 ff ff       	call   8005bc <cprintf>
+  801ef5:	83 c4 10             	add    $0x10,%esp
+  801ef8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efd:	eb d8                	jmp    801ed7 <write+0x53>
+  801eff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f04:	eb d1                	jmp    801ed7 <write+0x53>
+
+00801f06 <seek>:
+  801f06:	55                   	push   %ebp
+  801f07:	89 e5                	mov    %esp,%ebp
+  801f09:	83 ec 20             	sub    $0x20,%esp
+  801f0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f0f:	50                   	push   %eax
+  801f10:	ff 75 08             	push   0x8(%ebp)
+  801f13:	e8 2f fc ff ff       	call   801b47 <fd_lookup>
+  801f18:	83 c4 10             	add    $0x10,%esp
+  801f1b:	85 c0                	test   %eax,%eax
+  801f1d:	78 0e                	js     801f2d <seek+0x27>
+  801f1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f25:	89 50 04             	mov    %edx,0x4(%eax)
+  801f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2d:	c9                   	leave
+  801f2e:	c3                   	ret
+
+00801f2f <ftruncate>:
+  801f2f:	55                   	push   %ebp
+  801f30:	89 e5                	mov    %esp,%ebp
+  801f32:	56                   	push   %esi
+  801f33:	53                   	push   %ebx
+  801f34:	83 ec 18             	sub    $0x18,%esp
+  801f37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f3a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f3d:	50                   	push   %eax
+  801f3e:	53                   	push   %ebx
+  801f3f:	e8 03 fc ff ff       	call   801b47 <fd_lookup>
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	78 34                	js     801f7f <ftruncate+0x50>
+  801f4b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f4e:	83 ec 08             	sub    $0x8,%esp
+  801f51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f54:	50                   	push   %eax
+  801f55:	ff 36                	push   (%esi)
+  801f57:	e8 3b fc ff ff       	call   801b97 <dev_lookup>
+  801f5c:	83 c4 10             	add    $0x10,%esp
+  801f5f:	85 c0                	test   %eax,%eax
+  801f61:	78 1c                	js     801f7f <ftruncate+0x50>
+  801f63:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f67:	74 1d                	je     801f86 <ftruncate+0x57>
+  801f69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6c:	8b 40 18             	mov    0x18(%eax),%eax
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	74 34                	je     801fa7 <ftruncate+0x78>
+  801f73:	83 ec 08             	sub    $0x8,%esp
+  801f76:	ff 75 0c             	push   0xc(%ebp)
+  801f79:	56                   	push   %esi
+  801f7a:	ff d0                	call   *%eax
+  801f7c:	83 c4 10             	add    $0x10,%esp
+  801f7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f82:	5b                   	pop    %ebx
+  801f83:	5e                   	pop    %esi
+  801f84:	5d                   	pop    %ebp
+  801f85:	c3                   	ret
+  801f86:	a1 88 60 80 00       	mov    0x806088,%eax
+  801f8b:	8b 40 48             	mov    0x48(%eax),%eax
+  801f8e:	83 ec 04             	sub    $0x4,%esp
+  801f91:	53                   	push   %ebx
+  801f92:	50                   	push   %eax
+  801f93:	68 f8 3b 80 00       	push   $0x803bf8
+  801f98:	e8 1f e6 ff ff       	call   8005bc <cprintf>
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fa5:	eb d8                	jmp    801f7f <ftruncate+0x50>
+  801fa7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fac:	eb d1                	jmp    801f7f <ftruncate+0x50>
+
+00801fae <fstat>:
+  801fae:	55                   	push   %ebp
+  801faf:	89 e5                	mov    %esp,%ebp
+  801fb1:	56                   	push   %esi
+  801fb2:	53                   	push   %ebx
+  801fb3:	83 ec 18             	sub    $0x18,%esp
+  801fb6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fb9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fbc:	50                   	push   %eax
+  801fbd:	ff 75 08             	push   0x8(%ebp)
+  801fc0:	e8 82 fb ff ff       	call   801b47 <fd_lookup>
+  801fc5:	83 c4 10             	add    $0x10,%esp
+  801fc8:	85 c0                	test   %eax,%eax
+  801fca:	78 49                	js     802015 <fstat+0x67>
+  801fcc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fcf:	83 ec 08             	sub    $0x8,%esp
+  801fd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd5:	50                   	push   %eax
+  801fd6:	ff 36                	push   (%esi)
+  801fd8:	e8 ba fb ff ff       	call   801b97 <dev_lookup>
+  801fdd:	83 c4 10             	add    $0x10,%esp
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 31                	js     802015 <fstat+0x67>
+  801fe4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fe7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801feb:	74 2f                	je     80201c <fstat+0x6e>
+  801fed:	c6 03 00             	movb   $0x0,(%ebx)
+  801ff0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ff7:	00 00 00 
+  801ffa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802001:	00 00 00 
+  802004:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  80200a:	83 ec 08             	sub    $0x8,%esp
+  80200d:	53                   	push   %ebx
+  80200e:	56                   	push   %esi
+  80200f:	ff 50 14             	call   *0x14(%eax)
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802018:	5b                   	pop    %ebx
+  802019:	5e                   	pop    %esi
+  80201a:	5d                   	pop    %ebp
+  80201b:	c3                   	ret
+  80201c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802021:	eb f2                	jmp    802015 <fstat+0x67>
+
+00802023 <stat>:
+  802023:	55                   	push   %ebp
+  802024:	89 e5                	mov    %esp,%ebp
+  802026:	56                   	push   %esi
+  802027:	53                   	push   %ebx
+  802028:	83 ec 08             	sub    $0x8,%esp
+  80202b:	6a 00                	push   $0x0
+  80202d:	ff 75 08             	push   0x8(%ebp)
+  802030:	e8 31 05 00 00       	call   802566 <open>
+  802035:	89 c3                	mov    %eax,%ebx
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	78 1b                	js     802059 <stat+0x36>
+  80203e:	83 ec 08             	sub    $0x8,%esp
+  802041:	ff 75 0c             	push   0xc(%ebp)
+  802044:	50                   	push   %eax
+  802045:	e8 64 ff ff ff       	call   801fae <fstat>
+  80204a:	89 c6                	mov    %eax,%esi
+  80204c:	89 1c 24             	mov    %ebx,(%esp)
+  80204f:	e8 19 fc ff ff       	call   801c6d <close>
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	89 f3                	mov    %esi,%ebx
+  802059:	89 d8                	mov    %ebx,%eax
+  80205b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80205e:	5b                   	pop    %ebx
+  80205f:	5e                   	pop    %esi
+  802060:	5d                   	pop    %ebp
+  802061:	c3                   	ret
+
+00802062 <fsipc>:
+  802062:	55                   	push   %ebp
+  802063:	89 e5                	mov    %esp,%ebp
+  802065:	56                   	push   %esi
+  802066:	53                   	push   %ebx
+  802067:	89 c3                	mov    %eax,%ebx
+  802069:	89 d6                	mov    %edx,%esi
+  80206b:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  802072:	74 20                	je     802094 <fsipc+0x32>
+  802074:	83 ec 08             	sub    $0x8,%esp
+  802077:	6a 00                	push   $0x0
+  802079:	56                   	push   %esi
+  80207a:	6a 07                	push   $0x7
+  80207c:	68 00 70 80 00       	push   $0x807000
+  802081:	53                   	push   %ebx
+  802082:	ff 35 08 50 80 00    	push   0x805008
+  802088:	e8 6e 13 00 00       	call   8033fb <ipc_call>
+  80208d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802090:	5b                   	pop    %ebx
+  802091:	5e                   	pop    %esi
+  802092:	5d                   	pop    %ebp
+  802093:	c3                   	ret
+  802094:	83 ec 0c             	sub    $0xc,%esp
+  802097:	6a 02                	push   $0x2
+  802099:	e8 f8 14 00 00       	call   803596 <ipc_find_env>
+  80209e:	a3 08 50 80 00       	mov    %eax,0x805008
+  8020a3:	83 c4 10             	add    $0x10,%esp
+  8020a6:	eb cc                	jmp    802074 <fsipc+0x12>
+
+008020a8 <devfile_trunc>:
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	83 ec 08             	sub    $0x8,%esp
+  8020ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b4:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020bc:	a3 04 70 80 00       	mov    %eax,0x807004
+  8020c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020cb:	e8 92 ff ff ff       	call   802062 <fsipc>
+  8020d0:	c9                   	leave
+  8020d1:	c3                   	ret
+
+008020d2 <devfile_flush>:
+  8020d2:	55                   	push   %ebp
+  8020d3:	89 e5                	mov    %esp,%ebp
+  8020d5:	83 ec 08             	sub    $0x8,%esp
+  8020d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020db:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020de:	a3 00 70 80 00       	mov    %eax,0x807000
+  8020e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020ed:	e8 70 ff ff ff       	call   802062 <fsipc>
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+008020f4 <devfile_stat>:
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	53                   	push   %ebx
+  8020f8:	83 ec 04             	sub    $0x4,%esp
+  8020fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802101:	8b 40 0c             	mov    0xc(%eax),%eax
+  802104:	a3 00 70 80 00       	mov    %eax,0x807000
+  802109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80210e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802113:	e8 4a ff ff ff       	call   802062 <fsipc>
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	78 2c                	js     802148 <devfile_stat+0x54>
+  80211c:	83 ec 08             	sub    $0x8,%esp
+  80211f:	68 00 70 80 00       	push   $0x807000
+  802124:	53                   	push   %ebx
+  802125:	e8 89 eb ff ff       	call   800cb3 <strcpy>
+  80212a:	a1 80 70 80 00       	mov    0x807080,%eax
+  80212f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802135:	a1 84 70 80 00       	mov    0x807084,%eax
+  80213a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  802140:	83 c4 10             	add    $0x10,%esp
+  802143:	b8 00 00 00 00       	mov    $0x0,%eax
+  802148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214b:	c9                   	leave
+  80214c:	c3                   	ret
+
+0080214d <fsring_rw>:
+  80214d:	55                   	push   %ebp
+  80214e:	89 e5                	mov    %esp,%ebp
+  802150:	57                   	push   %edi
+  802151:	56                   	push   %esi
+  802152:	53                   	push   %ebx
+  802153:	83 ec 2c             	sub    $0x2c,%esp
+  802156:	89 c7                	mov    %eax,%edi
+  802158:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80215b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80215e:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  802163:	a8 01                	test   $0x1,%al
+  802165:	74 0d                	je     802174 <fsring_rw+0x27>
+  802167:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  80216c:	a8 01                	test   $0x1,%al
+  80216e:	0f 85 d5 00 00 00    	jne    802249 <fsring_rw+0xfc>
+  802174:	a1 88 60 80 00       	mov    0x806088,%eax
+  802179:	8b 40 48             	mov    0x48(%eax),%eax
+  80217c:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  802182:	0f 84 fc 00 00 00    	je     802284 <fsring_rw+0x137>
+  802188:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80218f:	0f 84 02 01 00 00    	je     802297 <fsring_rw+0x14a>
+  802195:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80219a:	83 ec 04             	sub    $0x4,%esp
+  80219d:	68 07 02 00 00       	push   $0x207
+  8021a2:	53                   	push   %ebx
+  8021a3:	6a 00                	push   $0x0
+  8021a5:	e8 69 ef ff ff       	call   801113 <sys_page_alloc>
+  8021aa:	83 c4 10             	add    $0x10,%esp
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	0f 88 f9 00 00 00    	js     8022ae <fsring_rw+0x161>
+  8021b5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021bb:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8021c1:	75 d7                	jne    80219a <fsring_rw+0x4d>
+  8021c3:	6a 0e                	push   $0xe
+  8021c5:	6a 0d                	push   $0xd
+  8021c7:	ff 35 08 50 80 00    	push   0x805008
+  8021cd:	68 00 00 f0 cf       	push   $0xcff00000
+  8021d2:	e8 d8 0d 00 00       	call   802faf <ipcring_init>
+  8021d7:	83 c4 08             	add    $0x8,%esp
+  8021da:	6a 00                	push   $0x0
+  8021dc:	6a 00                	push   $0x0
+  8021de:	68 07 02 00 00       	push   $0x207
+  8021e3:	68 00 00 f0 cf       	push   $0xcff00000
+  8021e8:	6a 0b                	push   $0xb
+  8021ea:	ff 35 08 50 80 00    	push   0x805008
+  8021f0:	e8 06 12 00 00       	call   8033fb <ipc_call>
+  8021f5:	89 c6                	mov    %eax,%esi
+  8021f7:	83 c4 20             	add    $0x20,%esp
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	0f 88 ac 00 00 00    	js     8022ae <fsring_rw+0x161>
+  802202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802207:	89 d9                	mov    %ebx,%ecx
+  802209:	83 c3 01             	add    $0x1,%ebx
+  80220c:	89 da                	mov    %ebx,%edx
+  80220e:	c1 e2 0c             	shl    $0xc,%edx
+  802211:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  802217:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  80221d:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  802223:	83 ec 08             	sub    $0x8,%esp
+  802226:	6a 00                	push   $0x0
+  802228:	6a 00                	push   $0x0
+  80222a:	68 07 02 00 00       	push   $0x207
+  80222f:	50                   	push   %eax
+  802230:	6a 0c                	push   $0xc
+  802232:	ff 35 08 50 80 00    	push   0x805008
+  802238:	e8 be 11 00 00       	call   8033fb <ipc_call>
+  80223d:	83 c4 20             	add    $0x20,%esp
+  802240:	85 c0                	test   %eax,%eax
+  802242:	78 6a                	js     8022ae <fsring_rw+0x161>
+  802244:	83 fb 08             	cmp    $0x8,%ebx
+  802247:	75 be                	jne    802207 <fsring_rw+0xba>
+  802249:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  80224d:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  802252:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802257:	0f 45 c2             	cmovne %edx,%eax
+  80225a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80225d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802264:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  80226b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  802272:	ba 00 00 00 00       	mov    $0x0,%edx
+  802277:	be 00 00 00 00       	mov    $0x0,%esi
+  80227c:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80227f:	e9 4b 01 00 00       	jmp    8023cf <fsring_rw+0x282>
+  802284:	e8 54 f2 ff ff       	call   8014dd <sys_time_msec>
+  802289:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  80228f:	0f 89 f3 fe ff ff    	jns    802188 <fsring_rw+0x3b>
+  802295:	eb 54                	jmp    8022eb <fsring_rw+0x19e>
+  802297:	83 ec 0c             	sub    $0xc,%esp
+  80229a:	6a 02                	push   $0x2
+  80229c:	e8 f5 12 00 00       	call   803596 <ipc_find_env>
+  8022a1:	a3 08 50 80 00       	mov    %eax,0x805008
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	e9 e7 fe ff ff       	jmp    802195 <fsring_rw+0x48>
+  8022ae:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8022b3:	83 ec 08             	sub    $0x8,%esp
+  8022b6:	53                   	push   %ebx
+  8022b7:	6a 00                	push   $0x0
+  8022b9:	e8 27 ef ff ff       	call   8011e5 <sys_page_unmap>
+  8022be:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  8022cd:	75 e4                	jne    8022b3 <fsring_rw+0x166>
+  8022cf:	e8 09 f2 ff ff       	call   8014dd <sys_time_msec>
+  8022d4:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8022d9:	a3 00 50 80 00       	mov    %eax,0x805000
+  8022de:	a1 88 60 80 00       	mov    0x806088,%eax
+  8022e3:	8b 40 48             	mov    0x48(%eax),%eax
+  8022e6:	a3 04 50 80 00       	mov    %eax,0x805004
+  8022eb:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  8022f2:	e9 7a 01 00 00       	jmp    802471 <fsring_rw+0x324>
+  8022f7:	8b 57 0c             	mov    0xc(%edi),%edx
+  8022fa:	89 10                	mov    %edx,(%eax)
+  8022fc:	89 58 04             	mov    %ebx,0x4(%eax)
+  8022ff:	89 f2                	mov    %esi,%edx
+  802301:	03 57 04             	add    0x4(%edi),%edx
+  802304:	89 50 08             	mov    %edx,0x8(%eax)
+  802307:	83 ec 04             	sub    $0x4,%esp
+  80230a:	53                   	push   %ebx
+  80230b:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80230e:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  802311:	52                   	push   %edx
+  802312:	83 c0 0c             	add    $0xc,%eax
+  802315:	50                   	push   %eax
+  802316:	e8 48 eb ff ff       	call   800e63 <memmove>
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802321:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802324:	89 08                	mov    %ecx,(%eax)
+  802326:	83 ec 0c             	sub    $0xc,%esp
+  802329:	68 00 00 f0 cf       	push   $0xcff00000
+  80232e:	e8 da 0c 00 00       	call   80300d <ipcring_req_push>
+  802333:	01 de                	add    %ebx,%esi
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80233b:	73 4c                	jae    802389 <fsring_rw+0x23c>
+  80233d:	83 ec 0c             	sub    $0xc,%esp
+  802340:	68 00 00 f0 cf       	push   $0xcff00000
+  802345:	e8 9d 0c 00 00       	call   802fe7 <ipcring_req_slot>
+  80234a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	85 c0                	test   %eax,%eax
+  802352:	74 35                	je     802389 <fsring_rw+0x23c>
+  802354:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802359:	83 e0 07             	and    $0x7,%eax
+  80235c:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  802361:	c1 e0 0c             	shl    $0xc,%eax
+  802364:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802367:	29 f3                	sub    %esi,%ebx
+  802369:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80236c:	39 cb                	cmp    %ecx,%ebx
+  80236e:	0f 47 d9             	cmova  %ecx,%ebx
+  802371:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802375:	75 80                	jne    8022f7 <fsring_rw+0x1aa>
+  802377:	8b 57 0c             	mov    0xc(%edi),%edx
+  80237a:	89 10                	mov    %edx,(%eax)
+  80237c:	89 58 04             	mov    %ebx,0x4(%eax)
+  80237f:	89 f2                	mov    %esi,%edx
+  802381:	03 57 04             	add    0x4(%edi),%edx
+  802384:	89 50 08             	mov    %edx,0x8(%eax)
+  802387:	eb 95                	jmp    80231e <fsring_rw+0x1d1>
+  802389:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  80238e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802391:	83 ec 0c             	sub    $0xc,%esp
+  802394:	68 00 00 f0 cf       	push   $0xcff00000
+  802399:	e8 a8 0c 00 00       	call   803046 <ipcring_rsp_wait>
+  80239e:	8b 58 04             	mov    0x4(%eax),%ebx
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8023a8:	75 45                	jne    8023ef <fsring_rw+0x2a2>
+  8023aa:	85 db                	test   %ebx,%ebx
+  8023ac:	79 41                	jns    8023ef <fsring_rw+0x2a2>
+  8023ae:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  8023b1:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  8023b8:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  8023bf:	83 ec 0c             	sub    $0xc,%esp
+  8023c2:	68 00 00 f0 cf       	push   $0xcff00000
+  8023c7:	e8 e0 0c 00 00       	call   8030ac <ipcring_rsp_pop>
+  8023cc:	83 c4 10             	add    $0x10,%esp
+  8023cf:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  8023d5:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  8023da:	39 c2                	cmp    %eax,%edx
+  8023dc:	74 75                	je     802453 <fsring_rw+0x306>
+  8023de:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  8023e2:	75 a5                	jne    802389 <fsring_rw+0x23c>
+  8023e4:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8023e7:	0f 82 50 ff ff ff    	jb     80233d <fsring_rw+0x1f0>
+  8023ed:	eb 9a                	jmp    802389 <fsring_rw+0x23c>
+  8023ef:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8023f3:	75 ca                	jne    8023bf <fsring_rw+0x272>
+  8023f5:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  8023f9:	74 31                	je     80242c <fsring_rw+0x2df>
+  8023fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fe:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802401:	29 c8                	sub    %ecx,%eax
+  802403:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802406:	39 d0                	cmp    %edx,%eax
+  802408:	0f 47 c2             	cmova  %edx,%eax
+  80240b:	39 d8                	cmp    %ebx,%eax
+  80240d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802412:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802416:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802419:	b8 01 00 00 00       	mov    $0x1,%eax
+  80241e:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  802422:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802425:	01 d9                	add    %ebx,%ecx
+  802427:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  80242a:	eb 93                	jmp    8023bf <fsring_rw+0x272>
+  80242c:	83 ec 04             	sub    $0x4,%esp
+  80242f:	53                   	push   %ebx
+  802430:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802433:	83 e0 07             	and    $0x7,%eax
+  802436:	c1 e0 0c             	shl    $0xc,%eax
+  802439:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80243f:	50                   	push   %eax
+  802440:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802443:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802446:	01 c8                	add    %ecx,%eax
+  802448:	50                   	push   %eax
+  802449:	e8 15 ea ff ff       	call   800e63 <memmove>
+  80244e:	83 c4 10             	add    $0x10,%esp
+  802451:	eb a8                	jmp    8023fb <fsring_rw+0x2ae>
+  802453:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802457:	75 09                	jne    802462 <fsring_rw+0x315>
+  802459:	3b 75 08             	cmp    0x8(%ebp),%esi
+  80245c:	0f 82 db fe ff ff    	jb     80233d <fsring_rw+0x1f0>
+  802462:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802465:	01 57 04             	add    %edx,0x4(%edi)
+  802468:	85 d2                	test   %edx,%edx
+  80246a:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80246e:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  802471:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802474:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802477:	5b                   	pop    %ebx
+  802478:	5e                   	pop    %esi
+  802479:	5f                   	pop    %edi
+  80247a:	5d                   	pop    %ebp
+  80247b:	c3                   	ret
+
+0080247c <devfile_write>:
+  80247c:	55                   	push   %ebp
+  80247d:	89 e5                	mov    %esp,%ebp
+  80247f:	57                   	push   %edi
+  802480:	56                   	push   %esi
+  802481:	53                   	push   %ebx
+  802482:	83 ec 0c             	sub    $0xc,%esp
+  802485:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802488:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80248b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80248e:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  802494:	76 1a                	jbe    8024b0 <devfile_write+0x34>
+  802496:	83 ec 0c             	sub    $0xc,%esp
+  802499:	53                   	push   %ebx
+  80249a:	89 f1                	mov    %esi,%ecx
+  80249c:	ba 06 00 00 00       	mov    $0x6,%edx
+  8024a1:	89 f8                	mov    %edi,%eax
+  8024a3:	e8 a5 fc ff ff       	call   80214d <fsring_rw>
+  8024a8:	83 c4 10             	add    $0x10,%esp
+  8024ab:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8024ae:	75 39                	jne    8024e9 <devfile_write+0x6d>
+  8024b0:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8024b5:	39 c3                	cmp    %eax,%ebx
+  8024b7:	0f 47 d8             	cmova  %eax,%ebx
+  8024ba:	8b 47 0c             	mov    0xc(%edi),%eax
+  8024bd:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024c2:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  8024c8:	83 ec 04             	sub    $0x4,%esp
+  8024cb:	53                   	push   %ebx
+  8024cc:	56                   	push   %esi
+  8024cd:	68 08 70 80 00       	push   $0x807008
+  8024d2:	e8 8c e9 ff ff       	call   800e63 <memmove>
+  8024d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024dc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024e1:	e8 7c fb ff ff       	call   802062 <fsipc>
+  8024e6:	83 c4 10             	add    $0x10,%esp
+  8024e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ec:	5b                   	pop    %ebx
+  8024ed:	5e                   	pop    %esi
+  8024ee:	5f                   	pop    %edi
+  8024ef:	5d                   	pop    %ebp
+  8024f0:	c3                   	ret
+
+008024f1 <devfile_read>:
+  8024f1:	55                   	push   %ebp
+  8024f2:	89 e5                	mov    %esp,%ebp
+  8024f4:	57                   	push   %edi
+  8024f5:	56                   	push   %esi
+  8024f6:	53                   	push   %ebx
+  8024f7:	83 ec 0c             	sub    $0xc,%esp
+  8024fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024fd:	8b 75 10             	mov    0x10(%ebp),%esi
+  802500:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802506:	76 1d                	jbe    802525 <devfile_read+0x34>
+  802508:	83 ec 0c             	sub    $0xc,%esp
+  80250b:	56                   	push   %esi
+  80250c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80250f:	ba 05 00 00 00       	mov    $0x5,%edx
+  802514:	89 f8                	mov    %edi,%eax
+  802516:	e8 32 fc ff ff       	call   80214d <fsring_rw>
+  80251b:	89 c3                	mov    %eax,%ebx
+  80251d:	83 c4 10             	add    $0x10,%esp
+  802520:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802523:	75 37                	jne    80255c <devfile_read+0x6b>
+  802525:	8b 47 0c             	mov    0xc(%edi),%eax
+  802528:	a3 00 70 80 00       	mov    %eax,0x807000
+  80252d:	89 35 04 70 80 00    	mov    %esi,0x807004
+  802533:	ba 00 00 00 00       	mov    $0x0,%edx
+  802538:	b8 03 00 00 00       	mov    $0x3,%eax
+  80253d:	e8 20 fb ff ff       	call   802062 <fsipc>
+  802542:	89 c3                	mov    %eax,%ebx
+  802544:	85 c0                	test   %eax,%eax
+  802546:	78 14                	js     80255c <devfile_read+0x6b>
+  802548:	83 ec 04             	sub    $0x4,%esp
+  80254b:	50                   	push   %eax
+  80254c:	68 00 70 80 00       	push   $0x807000
+  802551:	ff 75 0c             	push   0xc(%ebp)
+  802554:	e8 0a e9 ff ff       	call   800e63 <memmove>
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	89 d8                	mov    %ebx,%eax
+  80255e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802561:	5b                   	pop    %ebx
+  802562:	5e                   	pop    %esi
+  802563:	5f                   	pop    %edi
+  802564:	5d                   	pop    %ebp
+  802565:	c3                   	ret
+
+00802566 <open>:
+  802566:	55                   	push   %ebp
+  802567:	89 e5                	mov    %esp,%ebp
+  802569:	56                   	push   %esi
+  80256a:	53                   	push   %ebx
+  80256b:	83 ec 1c             	sub    $0x1c,%esp
+  80256e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802571:	56                   	push   %esi
+  802572:	e8 f0 e6 ff ff       	call   800c67 <strlen>
+  802577:	83 c4 10             	add    $0x10,%esp
+  80257a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80257f:	7f 6c                	jg     8025ed <open+0x87>
+  802581:	83 ec 0c             	sub    $0xc,%esp
+  802584:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802587:	50                   	push   %eax
+  802588:	e8 6a f5 ff ff       	call   801af7 <fd_alloc>
+  80258d:	89 c3                	mov    %eax,%ebx
+  80258f:	83 c4 10             	add    $0x10,%esp
+  802592:	85 c0                	test   %eax,%eax
+  802594:	78 3c                	js     8025d2 <open+0x6c>
+  802596:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802599:	a3 00 74 80 00       	mov    %eax,0x807400
+  80259e:	83 ec 08             	sub    $0x8,%esp
+  8025a1:	56                   	push   %esi
+  8025a2:	68 00 70 80 00       	push   $0x807000
+  8025a7:	e8 07 e7 ff ff       	call   800cb3 <strcpy>
+  8025ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025b4:	e8 a9 fa ff ff       	call   802062 <fsipc>
+  8025b9:	89 c3                	mov    %eax,%ebx
+  8025bb:	83 c4 10             	add    $0x10,%esp
+  8025be:	85 c0                	test   %eax,%eax
+  8025c0:	78 19                	js     8025db <open+0x75>
+  8025c2:	83 ec 0c             	sub    $0xc,%esp
+  8025c5:	ff 75 f4             	push   -0xc(%ebp)
+  8025c8:	e8 03 f5 ff ff       	call   801ad0 <fd2num>
+  8025cd:	89 c3                	mov    %eax,%ebx
+  8025cf:	83 c4 10             	add    $0x10,%esp
+  8025d2:	89 d8                	mov    %ebx,%eax
+  8025d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d7:	5b                   	pop    %ebx
+  8025d8:	5e                   	pop    %esi
+  8025d9:	5d                   	pop    %ebp
+  8025da:	c3                   	ret
+  8025db:	83 ec 08             	sub    $0x8,%esp
+  8025de:	6a 00                	push   $0x0
+  8025e0:	ff 75 f4             	push   -0xc(%ebp)
+  8025e3:	e8 05 f6 ff ff       	call   801bed <fd_close>
+  8025e8:	83 c4 10             	add    $0x10,%esp
+  8025eb:	eb e5                	jmp    8025d2 <open+0x6c>
+  8025ed:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8025f2:	eb de                	jmp    8025d2 <open+0x6c>
+
+008025f4 <file_image>:
+  8025f4:	55                   	push   %ebp
+  8025f5:	89 e5                	mov    %esp,%ebp
+  8025f7:	53                   	push   %ebx
+  8025f8:	83 ec 1c             	sub    $0x1c,%esp
+  8025fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802601:	50                   	push   %eax
+  802602:	ff 75 08             	push   0x8(%ebp)
+  802605:	e8 3d f5 ff ff       	call   801b47 <fd_lookup>
+  80260a:	83 c4 10             	add    $0x10,%esp
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	78 58                	js     802669 <file_image+0x75>
+  802611:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802614:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  80261a:	39 08                	cmp    %ecx,(%eax)
+  80261c:	75 50                	jne    80266e <file_image+0x7a>
+  80261e:	83 fb 04             	cmp    $0x4,%ebx
+  802621:	77 52                	ja     802675 <file_image+0x81>
+  802623:	8b 40 0c             	mov    0xc(%eax),%eax
+  802626:	a3 00 70 80 00       	mov    %eax,0x807000
+  80262b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802631:	83 ec 04             	sub    $0x4,%esp
+  802634:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802637:	c1 e0 02             	shl    $0x2,%eax
+  80263a:	50                   	push   %eax
+  80263b:	ff 75 0c             	push   0xc(%ebp)
+  80263e:	68 08 70 80 00       	push   $0x807008
+  802643:	e8 1b e8 ff ff       	call   800e63 <memmove>
+  802648:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802652:	e8 0b fa ff ff       	call   802062 <fsipc>
+  802657:	83 c4 10             	add    $0x10,%esp
+  80265a:	85 c0                	test   %eax,%eax
+  80265c:	78 0b                	js     802669 <file_image+0x75>
+  80265e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802661:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802667:	89 0a                	mov    %ecx,(%edx)
+  802669:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80266c:	c9                   	leave
+  80266d:	c3                   	ret
+  80266e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802673:	eb f4                	jmp    802669 <file_image+0x75>
+  802675:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80267a:	eb ed                	jmp    802669 <file_image+0x75>
+
+0080267c <remove>:
+  80267c:	55                   	push   %ebp
+  80267d:	89 e5                	mov    %esp,%ebp
+  80267f:	53                   	push   %ebx
+  802680:	83 ec 10             	sub    $0x10,%esp
+  802683:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802686:	53                   	push   %ebx
+  802687:	e8 db e5 ff ff       	call   800c67 <strlen>
+  80268c:	83 c4 10             	add    $0x10,%esp
+  80268f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802694:	7f 25                	jg     8026bb <remove+0x3f>
+  802696:	83 ec 08             	sub    $0x8,%esp
+  802699:	53                   	push   %ebx
+  80269a:	68 00 70 80 00       	push   $0x807000
+  80269f:	e8 0f e6 ff ff       	call   800cb3 <strcpy>
+  8026a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026ae:	e8 af f9 ff ff       	call   802062 <fsipc>
+  8026b3:	83 c4 10             	add    $0x10,%esp
+  8026b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b9:	c9                   	leave
+  8026ba:	c3                   	ret
+  8026bb:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026c0:	eb f4                	jmp    8026b6 <remove+0x3a>
+
+008026c2 <sync>:
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	83 ec 08             	sub    $0x8,%esp
+  8026c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026d2:	e8 8b f9 ff ff       	call   802062 <fsipc>
+  8026d7:	c9                   	leave
+  8026d8:	c3                   	ret
+
+008026d9 <writebuf>:
+  8026d9:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8026dd:	7f 01                	jg     8026e0 <writebuf+0x7>
+  8026df:	c3                   	ret
+  8026e0:	55                   	push   %ebp
+  8026e1:	89 e5                	mov    %esp,%ebp
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 08             	sub    $0x8,%esp
+  8026e7:	89 c3                	mov    %eax,%ebx
+  8026e9:	ff 70 04             	push   0x4(%eax)
+  8026ec:	8d 40 10             	lea    0x10(%eax),%eax
+  8026ef:	50                   	push   %eax
+  8026f0:	ff 33                	push   (%ebx)
+  8026f2:	e8 8d f7 ff ff       	call   801e84 <write>
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	7e 03                	jle    802701 <writebuf+0x28>
+  8026fe:	01 43 08             	add    %eax,0x8(%ebx)
+  802701:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802704:	74 0d                	je     802713 <writebuf+0x3a>
+  802706:	85 c0                	test   %eax,%eax
+  802708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270d:	0f 4f c2             	cmovg  %edx,%eax
+  802710:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802713:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802716:	c9                   	leave
+  802717:	c3                   	ret
+
+00802718 <putch>:
+  802718:	55                   	push   %ebp
+  802719:	89 e5                	mov    %esp,%ebp
+  80271b:	53                   	push   %ebx
+  80271c:	83 ec 04             	sub    $0x4,%esp
+  80271f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802722:	8b 53 04             	mov    0x4(%ebx),%edx
+  802725:	8d 42 01             	lea    0x1(%edx),%eax
+  802728:	89 43 04             	mov    %eax,0x4(%ebx)
+  80272b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80272e:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  802732:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802737:	74 05                	je     80273e <putch+0x26>
+  802739:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80273c:	c9                   	leave
+  80273d:	c3                   	ret
+  80273e:	89 d8                	mov    %ebx,%eax
+  802740:	e8 94 ff ff ff       	call   8026d9 <writebuf>
+  802745:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  80274c:	eb eb                	jmp    802739 <putch+0x21>
+
+0080274e <vfprintf>:
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  802757:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275a:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  802760:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802767:	00 00 00 
+  80276a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802771:	00 00 00 
+  802774:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80277b:	00 00 00 
+  80277e:	ff 75 10             	push   0x10(%ebp)
+  802781:	ff 75 0c             	push   0xc(%ebp)
+  802784:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80278a:	50                   	push   %eax
+  80278b:	68 18 27 80 00       	push   $0x802718
+  802790:	e8 26 df ff ff       	call   8006bb <vprintfmt>
+  802795:	83 c4 10             	add    $0x10,%esp
+  802798:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80279f:	7f 12                	jg     8027b3 <vfprintf+0x65>
+  8027a1:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8027a7:	85 c0                	test   %eax,%eax
+  8027a9:	75 06                	jne    8027b1 <vfprintf+0x63>
+  8027ab:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8027b1:	c9                   	leave
+  8027b2:	c3                   	ret
+  8027b3:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8027b9:	e8 1b ff ff ff       	call   8026d9 <writebuf>
+  8027be:	eb e1                	jmp    8027a1 <vfprintf+0x53>
+
+008027c0 <fprintf>:
+  8027c0:	55                   	push   %ebp
+  8027c1:	89 e5                	mov    %esp,%ebp
+  8027c3:	83 ec 0c             	sub    $0xc,%esp
+  8027c6:	8d 45 10             	lea    0x10(%ebp),%eax
+  8027c9:	50                   	push   %eax
+  8027ca:	ff 75 0c             	push   0xc(%ebp)
+  8027cd:	ff 75 08             	push   0x8(%ebp)
+  8027d0:	e8 79 ff ff ff       	call   80274e <vfprintf>
+  8027d5:	c9                   	leave
+  8027d6:	c3                   	ret
+
+008027d7 <printf>:
+  8027d7:	55                   	push   %ebp
+  8027d8:	89 e5                	mov    %esp,%ebp
+  8027da:	83 ec 0c             	sub    $0xc,%esp
+  8027dd:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8027e0:	50                   	push   %eax
+  8027e1:	ff 75 08             	push   0x8(%ebp)
+  8027e4:	6a 01                	push   $0x1
+  8027e6:	e8 63 ff ff ff       	call   80274e <vfprintf>
+  8027eb:	c9                   	leave
+  8027ec:	c3                   	ret
+
+008027ed <devsock_stat>:
+  8027ed:	55                   	push   %ebp
+  8027ee:	89 e5                	mov    %esp,%ebp
+  8027f0:	83 ec 10             	sub    $0x10,%esp
+  8027f3:	68 68 3c 80 00       	push   $0x803c68
+  8027f8:	ff 75 0c             	push   0xc(%ebp)
+  8027fb:	e8 b3 e4 ff ff       	call   800cb3 <strcpy>
+  802800:	b8 00 00 00 00       	mov    $0x0,%eax
+  802805:	c9                   	leave
+  802806:	c3                   	ret
+
+00802807 <devsock_close>:
+  802807:	55                   	push   %ebp
+  802808:	89 e5                	mov    %esp,%ebp
+  80280a:	53                   	push   %ebx
+  80280b:	83 ec 10             	sub    $0x10,%esp
+  80280e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802811:	53                   	push   %ebx
+  802812:	e8 99 0d 00 00       	call   8035b0 <pageref>
+  802817:	89 c2                	mov    %eax,%edx
+  802819:	83 c4 10             	add    $0x10,%esp
+  80281c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802821:	83 fa 01             	cmp    $0x1,%edx
+  802824:	74 05                	je     80282b <devsock_close+0x24>
+  802826:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802829:	c9                   	leave
+  80282a:	c3                   	ret
+  80282b:	83 ec 0c             	sub    $0xc,%esp
+  80282e:	ff 73 0c             	push   0xc(%ebx)
+  802831:	e8 aa 02 00 00       	call   802ae0 <nsipc_close>
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	eb eb                	jmp    802826 <devsock_close+0x1f>
+
+0080283b <devsock_write>:
+  80283b:	55                   	push   %ebp
+  80283c:	89 e5                	mov    %esp,%ebp
+  80283e:	83 ec 08             	sub    $0x8,%esp
+  802841:	6a 00                	push   $0x0
+  802843:	ff 75 10             	push   0x10(%ebp)
+  802846:	ff 75 0c             	push   0xc(%ebp)
+  802849:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284c:	ff 70 0c             	push   0xc(%eax)
+  80284f:	e8 6c 03 00 00       	call   802bc0 <nsipc_send>
+  802854:	c9                   	leave
+  802855:	c3                   	ret
+
+00802856 <devsock_read>:
+  802856:	55                   	push   %ebp
+  802857:	89 e5                	mov    %esp,%ebp
+  802859:	83 ec 08             	sub    $0x8,%esp
+  80285c:	6a 00                	push   $0x0
+  80285e:	ff 75 10             	push   0x10(%ebp)
+  802861:	ff 75 0c             	push   0xc(%ebp)
+  802864:	8b 45 08             	mov    0x8(%ebp),%eax
+  802867:	ff 70 0c             	push   0xc(%eax)
+  80286a:	e8 e2 02 00 00       	call   802b51 <nsipc_recv>
+  80286f:	c9                   	leave
+  802870:	c3                   	ret
+
+00802871 <fd2sockid>:
+  802871:	55                   	push   %ebp
+  802872:	89 e5                	mov    %esp,%ebp
+  802874:	83 ec 20             	sub    $0x20,%esp
+  802877:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80287a:	52                   	push   %edx
+  80287b:	50                   	push   %eax
+  80287c:	e8 c6 f2 ff ff       	call   801b47 <fd_lookup>
+  802881:	83 c4 10             	add    $0x10,%esp
+  802884:	85 c0                	test   %eax,%eax
+  802886:	78 10                	js     802898 <fd2sockid+0x27>
+  802888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80288b:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  802891:	39 08                	cmp    %ecx,(%eax)
+  802893:	75 05                	jne    80289a <fd2sockid+0x29>
+  802895:	8b 40 0c             	mov    0xc(%eax),%eax
+  802898:	c9                   	leave
+  802899:	c3                   	ret
+  80289a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80289f:	eb f7                	jmp    802898 <fd2sockid+0x27>
+
+008028a1 <alloc_sockfd>:
+  8028a1:	55                   	push   %ebp
+  8028a2:	89 e5                	mov    %esp,%ebp
+  8028a4:	56                   	push   %esi
+  8028a5:	53                   	push   %ebx
+  8028a6:	83 ec 1c             	sub    $0x1c,%esp
+  8028a9:	89 c6                	mov    %eax,%esi
+  8028ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ae:	50                   	push   %eax
+  8028af:	e8 43 f2 ff ff       	call   801af7 <fd_alloc>
+  8028b4:	89 c3                	mov    %eax,%ebx
+  8028b6:	83 c4 10             	add    $0x10,%esp
+  8028b9:	85 c0                	test   %eax,%eax
+  8028bb:	78 43                	js     802900 <alloc_sockfd+0x5f>
+  8028bd:	83 ec 04             	sub    $0x4,%esp
+  8028c0:	68 07 04 00 00       	push   $0x407
+  8028c5:	ff 75 f4             	push   -0xc(%ebp)
+  8028c8:	6a 00                	push   $0x0
+  8028ca:	e8 44 e8 ff ff       	call   801113 <sys_page_alloc>
+  8028cf:	89 c3                	mov    %eax,%ebx
+  8028d1:	83 c4 10             	add    $0x10,%esp
+  8028d4:	85 c0                	test   %eax,%eax
+  8028d6:	78 28                	js     802900 <alloc_sockfd+0x5f>
+  8028d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028db:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  8028e1:	89 10                	mov    %edx,(%eax)
+  8028e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028e6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  8028ed:	89 70 0c             	mov    %esi,0xc(%eax)
+  8028f0:	83 ec 0c             	sub    $0xc,%esp
+  8028f3:	50                   	push   %eax
+  8028f4:	e8 d7 f1 ff ff       	call   801ad0 <fd2num>
+  8028f9:	89 c3                	mov    %eax,%ebx
+  8028fb:	83 c4 10             	add    $0x10,%esp
+  8028fe:	eb 0c                	jmp    80290c <alloc_sockfd+0x6b>
+  802900:	83 ec 0c             	sub    $0xc,%esp
+  802903:	56                   	push   %esi
+  802904:	e8 d7 01 00 00       	call   802ae0 <nsipc_close>
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	89 d8                	mov    %ebx,%eax
+  80290e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802911:	5b                   	pop    %ebx
+  802912:	5e                   	pop    %esi
+  802913:	5d                   	pop    %ebp
+  802914:	c3                   	ret
+
+00802915 <accept>:
+  802915:	55                   	push   %ebp
+  802916:	89 e5                	mov    %esp,%ebp
+  802918:	83 ec 08             	sub    $0x8,%esp
+  80291b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291e:	e8 4e ff ff ff       	call   802871 <fd2sockid>
+  802923:	85 c0                	test   %eax,%eax
+  802925:	78 1b                	js     802942 <accept+0x2d>
+  802927:	83 ec 04             	sub    $0x4,%esp
+  80292a:	ff 75 10             	push   0x10(%ebp)
+  80292d:	ff 75 0c             	push   0xc(%ebp)
+  802930:	50                   	push   %eax
+  802931:	e8 07 01 00 00       	call   802a3d <nsipc_accept>
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	85 c0                	test   %eax,%eax
+  80293b:	78 05                	js     802942 <accept+0x2d>
+  80293d:	e8 5f ff ff ff       	call   8028a1 <alloc_sockfd>
+  802942:	c9                   	leave
+  802943:	c3                   	ret
+
+00802944 <bind>:
+  802944:	55                   	push   %ebp
+  802945:	89 e5                	mov    %esp,%ebp
+  802947:	83 ec 08             	sub    $0x8,%esp
+  80294a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294d:	e8 1f ff ff ff       	call   802871 <fd2sockid>
+  802952:	85 c0                	test   %eax,%eax
+  802954:	78 12                	js     802968 <bind+0x24>
+  802956:	83 ec 04             	sub    $0x4,%esp
+  802959:	ff 75 10             	push   0x10(%ebp)
+  80295c:	ff 75 0c             	push   0xc(%ebp)
+  80295f:	50                   	push   %eax
+  802960:	e8 24 01 00 00       	call   802a89 <nsipc_bind>
+  802965:	83 c4 10             	add    $0x10,%esp
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+0080296a <shutdown>:
+  80296a:	55                   	push   %ebp
+  80296b:	89 e5                	mov    %esp,%ebp
+  80296d:	83 ec 08             	sub    $0x8,%esp
+  802970:	8b 45 08             	mov    0x8(%ebp),%eax
+  802973:	e8 f9 fe ff ff       	call   802871 <fd2sockid>
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	78 0f                	js     80298b <shutdown+0x21>
+  80297c:	83 ec 08             	sub    $0x8,%esp
+  80297f:	ff 75 0c             	push   0xc(%ebp)
+  802982:	50                   	push   %eax
+  802983:	e8 36 01 00 00       	call   802abe <nsipc_shutdown>
+  802988:	83 c4 10             	add    $0x10,%esp
+  80298b:	c9                   	leave
+  80298c:	c3                   	ret
+
+0080298d <connect>:
+  80298d:	55                   	push   %ebp
+  80298e:	89 e5                	mov    %esp,%ebp
+  802990:	83 ec 08             	sub    $0x8,%esp
+  802993:	8b 45 08             	mov    0x8(%ebp),%eax
+  802996:	e8 d6 fe ff ff       	call   802871 <fd2sockid>
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	78 12                	js     8029b1 <connect+0x24>
+  80299f:	83 ec 04             	sub    $0x4,%esp
+  8029a2:	ff 75 10             	push   0x10(%ebp)
+  8029a5:	ff 75 0c             	push   0xc(%ebp)
+  8029a8:	50                   	push   %eax
+  8029a9:	e8 4c 01 00 00       	call   802afa <nsipc_connect>
+  8029ae:	83 c4 10             	add    $0x10,%esp
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+
+008029b3 <listen>:
+  8029b3:	55                   	push   %ebp
+  8029b4:	89 e5                	mov    %esp,%ebp
+  8029b6:	83 ec 08             	sub    $0x8,%esp
+  8029b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029bc:	e8 b0 fe ff ff       	call   802871 <fd2sockid>
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	78 0f                	js     8029d4 <listen+0x21>
+  8029c5:	83 ec 08             	sub    $0x8,%esp
+  8029c8:	ff 75 0c             	push   0xc(%ebp)
+  8029cb:	50                   	push   %eax
+  8029cc:	e8 5e 01 00 00       	call   802b2f <nsipc_listen>
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	c9                   	leave
+  8029d5:	c3                   	ret
+
+008029d6 <socket>:
+  8029d6:	55                   	push   %ebp
+  8029d7:	89 e5                	mov    %esp,%ebp
+  8029d9:	83 ec 0c             	sub    $0xc,%esp
+  8029dc:	ff 75 10             	push   0x10(%ebp)
+  8029df:	ff 75 0c             	push   0xc(%ebp)
+  8029e2:	ff 75 08             	push   0x8(%ebp)
+  8029e5:	e8 34 02 00 00       	call   802c1e <nsipc_socket>
+  8029ea:	83 c4 10             	add    $0x10,%esp
+  8029ed:	85 c0                	test   %eax,%eax
+  8029ef:	78 05                	js     8029f6 <socket+0x20>
+  8029f1:	e8 ab fe ff ff       	call   8028a1 <alloc_sockfd>
+  8029f6:	c9                   	leave
+  8029f7:	c3                   	ret
+
+008029f8 <nsipc>:
+  8029f8:	55                   	push   %ebp
+  8029f9:	89 e5                	mov    %esp,%ebp
+  8029fb:	53                   	push   %ebx
+  8029fc:	83 ec 04             	sub    $0x4,%esp
+  8029ff:	89 c3                	mov    %eax,%ebx
+  802a01:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802a08:	74 1f                	je     802a29 <nsipc+0x31>
+  802a0a:	83 ec 08             	sub    $0x8,%esp
+  802a0d:	6a 00                	push   $0x0
+  802a0f:	6a 00                	push   $0x0
+  802a11:	6a 07                	push   $0x7
+  802a13:	68 00 80 80 00       	push   $0x808000
+  802a18:	53                   	push   %ebx
+  802a19:	ff 35 0c 50 80 00    	push   0x80500c
+  802a1f:	e8 d7 09 00 00       	call   8033fb <ipc_call>
+  802a24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a27:	c9                   	leave
+  802a28:	c3                   	ret
+  802a29:	83 ec 0c             	sub    $0xc,%esp
+  802a2c:	6a 03                	push   $0x3
+  802a2e:	e8 63 0b 00 00       	call   803596 <ipc_find_env>
+  802a33:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802a38:	83 c4 10             	add    $0x10,%esp
+  802a3b:	eb cd                	jmp    802a0a <nsipc+0x12>
+
+00802a3d <nsipc_accept>:
+  802a3d:	55                   	push   %ebp
+  802a3e:	89 e5                	mov    %esp,%ebp
+  802a40:	53                   	push   %ebx
+  802a41:	83 ec 04             	sub    $0x4,%esp
+  802a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a47:	a3 00 80 80 00       	mov    %eax,0x808000
+  802a4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a51:	e8 a2 ff ff ff       	call   8029f8 <nsipc>
+  802a56:	89 c3                	mov    %eax,%ebx
+  802a58:	85 c0                	test   %eax,%eax
+  802a5a:	79 07                	jns    802a63 <nsipc_accept+0x26>
+  802a5c:	89 d8                	mov    %ebx,%eax
+  802a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+  802a63:	83 ec 04             	sub    $0x4,%esp
+  802a66:	ff 35 10 80 80 00    	push   0x808010
+  802a6c:	68 00 80 80 00       	push   $0x808000
+  802a71:	ff 75 0c             	push   0xc(%ebp)
+  802a74:	e8 ea e3 ff ff       	call   800e63 <memmove>
+  802a79:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a7f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a82:	89 10                	mov    %edx,(%eax)
+  802a84:	83 c4 10             	add    $0x10,%esp
+  802a87:	eb d3                	jmp    802a5c <nsipc_accept+0x1f>
+
+00802a89 <nsipc_bind>:
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	53                   	push   %ebx
+  802a8d:	83 ec 08             	sub    $0x8,%esp
+  802a90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a96:	a3 00 80 80 00       	mov    %eax,0x808000
+  802a9b:	53                   	push   %ebx
+  802a9c:	ff 75 0c             	push   0xc(%ebp)
+  802a9f:	68 04 80 80 00       	push   $0x808004
+  802aa4:	e8 ba e3 ff ff       	call   800e63 <memmove>
+  802aa9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802aaf:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ab4:	e8 3f ff ff ff       	call   8029f8 <nsipc>
+  802ab9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802abc:	c9                   	leave
+  802abd:	c3                   	ret
+
+00802abe <nsipc_shutdown>:
+  802abe:	55                   	push   %ebp
+  802abf:	89 e5                	mov    %esp,%ebp
+  802ac1:	83 ec 08             	sub    $0x8,%esp
+  802ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac7:	a3 00 80 80 00       	mov    %eax,0x808000
+  802acc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802acf:	a3 04 80 80 00       	mov    %eax,0x808004
+  802ad4:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ad9:	e8 1a ff ff ff       	call   8029f8 <nsipc>
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+00802ae0 <nsipc_close>:
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	83 ec 08             	sub    $0x8,%esp
+  802ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae9:	a3 00 80 80 00       	mov    %eax,0x808000
+  802aee:	b8 04 00 00 00       	mov    $0x4,%eax
+  802af3:	e8 00 ff ff ff       	call   8029f8 <nsipc>
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <nsipc_connect>:
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	53                   	push   %ebx
+  802afe:	83 ec 08             	sub    $0x8,%esp
+  802b01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b04:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b07:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b0c:	53                   	push   %ebx
+  802b0d:	ff 75 0c             	push   0xc(%ebp)
+  802b10:	68 04 80 80 00       	push   $0x808004
+  802b15:	e8 49 e3 ff ff       	call   800e63 <memmove>
+  802b1a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+  802b20:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b25:	e8 ce fe ff ff       	call   8029f8 <nsipc>
+  802b2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b2d:	c9                   	leave
+  802b2e:	c3                   	ret
+
+00802b2f <nsipc_listen>:
+  802b2f:	55                   	push   %ebp
+  802b30:	89 e5                	mov    %esp,%ebp
+  802b32:	83 ec 08             	sub    $0x8,%esp
+  802b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b38:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b40:	a3 04 80 80 00       	mov    %eax,0x808004
+  802b45:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b4a:	e8 a9 fe ff ff       	call   8029f8 <nsipc>
+  802b4f:	c9                   	leave
+  802b50:	c3                   	ret
+
+00802b51 <nsipc_recv>:
+  802b51:	55                   	push   %ebp
+  802b52:	89 e5                	mov    %esp,%ebp
+  802b54:	56                   	push   %esi
+  802b55:	53                   	push   %ebx
+  802b56:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5c:	a3 00 80 80 00       	mov    %eax,0x808000
+  802b61:	89 35 04 80 80 00    	mov    %esi,0x808004
+  802b67:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b6a:	a3 08 80 80 00       	mov    %eax,0x808008
+  802b6f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b74:	e8 7f fe ff ff       	call   8029f8 <nsipc>
+  802b79:	89 c3                	mov    %eax,%ebx
+  802b7b:	85 c0                	test   %eax,%eax
+  802b7d:	78 22                	js     802ba1 <nsipc_recv+0x50>
+  802b7f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b84:	39 c6                	cmp    %eax,%esi
+  802b86:	0f 4e c6             	cmovle %esi,%eax
+  802b89:	39 c3                	cmp    %eax,%ebx
+  802b8b:	7f 1d                	jg     802baa <nsipc_recv+0x59>
+  802b8d:	83 ec 04             	sub    $0x4,%esp
+  802b90:	53                   	push   %ebx
+  802b91:	68 00 80 80 00       	push   $0x808000
+  802b96:	ff 75 0c             	push   0xc(%ebp)
+  802b99:	e8 c5 e2 ff ff       	call   800e63 <memmove>
+  802b9e:	83 c4 10             	add    $0x10,%esp
+  802ba1:	89 d8                	mov    %ebx,%eax
+  802ba3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ba6:	5b                   	pop    %ebx
+  802ba7:	5e                   	pop    %esi
+  802ba8:	5d                   	pop    %ebp
+  802ba9:	c3                   	ret
+  802baa:	68 74 3c 80 00       	push   $0x803c74
+  802baf:	68 89 3c 80 00       	push   $0x803c89
+  802bb4:	6a 60                	push   $0x60
+  802bb6:	68 9e 3c 80 00       	push   $0x803c9e
+  802bbb:	e8 21 d9 ff ff       	call   8004e1 <_panic>
+
+00802bc0 <nsipc_send>:
+  802bc0:	55                   	push   %ebp
+  802bc1:	89 e5                	mov    %esp,%ebp
+  802bc3:	53                   	push   %ebx
+  802bc4:	83 ec 04             	sub    $0x4,%esp
+  802bc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcd:	a3 00 80 80 00       	mov    %eax,0x808000
+  802bd2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bd8:	7f 2e                	jg     802c08 <nsipc_send+0x48>
+  802bda:	83 ec 04             	sub    $0x4,%esp
+  802bdd:	53                   	push   %ebx
+  802bde:	ff 75 0c             	push   0xc(%ebp)
+  802be1:	68 0c 80 80 00       	push   $0x80800c
+  802be6:	e8 78 e2 ff ff       	call   800e63 <memmove>
+  802beb:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  802bf1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bf4:	a3 08 80 80 00       	mov    %eax,0x808008
+  802bf9:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bfe:	e8 f5 fd ff ff       	call   8029f8 <nsipc>
+  802c03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c06:	c9                   	leave
+  802c07:	c3                   	ret
+  802c08:	68 aa 3c 80 00       	push   $0x803caa
+  802c0d:	68 89 3c 80 00       	push   $0x803c89
+  802c12:	6a 6b                	push   $0x6b
+  802c14:	68 9e 3c 80 00       	push   $0x803c9e
+  802c19:	e8 c3 d8 ff ff       	call   8004e1 <_panic>
+
+00802c1e <nsipc_socket>:
+  802c1e:	55                   	push   %ebp
+  802c1f:	89 e5                	mov    %esp,%ebp
+  802c21:	83 ec 08             	sub    $0x8,%esp
+  802c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c27:	a3 00 80 80 00       	mov    %eax,0x808000
+  802c2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c2f:	a3 04 80 80 00       	mov    %eax,0x808004
+  802c34:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c37:	a3 08 80 80 00       	mov    %eax,0x808008
+  802c3c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c41:	e8 b2 fd ff ff       	call   8029f8 <nsipc>
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+
+00802c48 <devpipe_stat>:
+  802c48:	55                   	push   %ebp
+  802c49:	89 e5                	mov    %esp,%ebp
+  802c4b:	56                   	push   %esi
+  802c4c:	53                   	push   %ebx
+  802c4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802c50:	83 ec 0c             	sub    $0xc,%esp
+  802c53:	ff 75 08             	push   0x8(%ebp)
+  802c56:	e8 85 ee ff ff       	call   801ae0 <fd2data>
+  802c5b:	89 c6                	mov    %eax,%esi
+  802c5d:	83 c4 08             	add    $0x8,%esp
+  802c60:	68 b6 3c 80 00       	push   $0x803cb6
+  802c65:	53                   	push   %ebx
+  802c66:	e8 48 e0 ff ff       	call   800cb3 <strcpy>
+  802c6b:	8b 46 04             	mov    0x4(%esi),%eax
+  802c6e:	2b 06                	sub    (%esi),%eax
+  802c70:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  802c76:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c7d:	00 00 00 
+  802c80:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802c87:	40 80 00 
+  802c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c92:	5b                   	pop    %ebx
+  802c93:	5e                   	pop    %esi
+  802c94:	5d                   	pop    %ebp
+  802c95:	c3                   	ret
+
+00802c96 <devpipe_close>:
+  802c96:	55                   	push   %ebp
+  802c97:	89 e5                	mov    %esp,%ebp
+  802c99:	53                   	push   %ebx
+  802c9a:	83 ec 0c             	sub    $0xc,%esp
+  802c9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ca0:	53                   	push   %ebx
+  802ca1:	6a 00                	push   $0x0
+  802ca3:	e8 3d e5 ff ff       	call   8011e5 <sys_page_unmap>
+  802ca8:	89 1c 24             	mov    %ebx,(%esp)
+  802cab:	e8 30 ee ff ff       	call   801ae0 <fd2data>
+  802cb0:	83 c4 08             	add    $0x8,%esp
+  802cb3:	50                   	push   %eax
+  802cb4:	6a 00                	push   $0x0
+  802cb6:	e8 2a e5 ff ff       	call   8011e5 <sys_page_unmap>
+  802cbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cbe:	c9                   	leave
+  802cbf:	c3                   	ret
+
+00802cc0 <_pipeisclosed>:
+  802cc0:	55                   	push   %ebp
+  802cc1:	89 e5                	mov    %esp,%ebp
+  802cc3:	57                   	push   %edi
+  802cc4:	56                   	push   %esi
+  802cc5:	53                   	push   %ebx
+  802cc6:	83 ec 1c             	sub    $0x1c,%esp
+  802cc9:	89 c7                	mov    %eax,%edi
+  802ccb:	89 d6                	mov    %edx,%esi
+  802ccd:	a1 88 60 80 00       	mov    0x806088,%eax
+  802cd2:	8b 58 58             	mov    0x58(%eax),%ebx
+  802cd5:	83 ec 0c             	sub    $0xc,%esp
+  802cd8:	57                   	push   %edi
+  802cd9:	e8 d2 08 00 00       	call   8035b0 <pageref>
+  802cde:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ce1:	89 34 24             	mov    %esi,(%esp)
+  802ce4:	e8 c7 08 00 00       	call   8035b0 <pageref>
+  802ce9:	8b 15 88 60 80 00    	mov    0x806088,%edx
+  802cef:	8b 4a 58             	mov    0x58(%edx),%ecx
+  802cf2:	83 c4 10             	add    $0x10,%esp
+  802cf5:	39 cb                	cmp    %ecx,%ebx
+  802cf7:	74 1b                	je     802d14 <_pipeisclosed+0x54>
+  802cf9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cfc:	75 cf                	jne    802ccd <_pipeisclosed+0xd>
+  802cfe:	8b 42 58             	mov    0x58(%edx),%eax
+  802d01:	6a 01                	push   $0x1
+  802d03:	50                   	push   %eax
+  802d04:	53                   	push   %ebx
+  802d05:	68 bd 3c 80 00       	push   $0x803cbd
+  802d0a:	e8 ad d8 ff ff       	call   8005bc <cprintf>
+  802d0f:	83 c4 10             	add    $0x10,%esp
+  802d12:	eb b9                	jmp    802ccd <_pipeisclosed+0xd>
+  802d14:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d17:	0f 94 c0             	sete   %al
+  802d1a:	0f b6 c0             	movzbl %al,%eax
+  802d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d20:	5b                   	pop    %ebx
+  802d21:	5e                   	pop    %esi
+  802d22:	5f                   	pop    %edi
+  802d23:	5d                   	pop    %ebp
+  802d24:	c3                   	ret
+
+00802d25 <devpipe_write>:
+  802d25:	55                   	push   %ebp
+  802d26:	89 e5                	mov    %esp,%ebp
+  802d28:	57                   	push   %edi
+  802d29:	56                   	push   %esi
+  802d2a:	53                   	push   %ebx
+  802d2b:	83 ec 28             	sub    $0x28,%esp
+  802d2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d31:	56                   	push   %esi
+  802d32:	e8 a9 ed ff ff       	call   801ae0 <fd2data>
+  802d37:	89 c3                	mov    %eax,%ebx
+  802d39:	83 c4 10             	add    $0x10,%esp
+  802d3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d41:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d45:	74 5c                	je     802da3 <devpipe_write+0x7e>
+  802d47:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d4a:	8b 0b                	mov    (%ebx),%ecx
+  802d4c:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d4f:	39 d0                	cmp    %edx,%eax
+  802d51:	72 1e                	jb     802d71 <devpipe_write+0x4c>
+  802d53:	89 da                	mov    %ebx,%edx
+  802d55:	89 f0                	mov    %esi,%eax
+  802d57:	e8 64 ff ff ff       	call   802cc0 <_pipeisclosed>
+  802d5c:	85 c0                	test   %eax,%eax
+  802d5e:	75 48                	jne    802da8 <devpipe_write+0x83>
+  802d60:	e8 63 e3 ff ff       	call   8010c8 <sys_yield>
+  802d65:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d68:	8b 0b                	mov    (%ebx),%ecx
+  802d6a:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d6d:	39 d0                	cmp    %edx,%eax
+  802d6f:	73 e2                	jae    802d53 <devpipe_write+0x2e>
+  802d71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d74:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802d78:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802d7b:	89 c2                	mov    %eax,%edx
+  802d7d:	c1 fa 1f             	sar    $0x1f,%edx
+  802d80:	89 d1                	mov    %edx,%ecx
+  802d82:	c1 e9 1b             	shr    $0x1b,%ecx
+  802d85:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d88:	83 e2 1f             	and    $0x1f,%edx
+  802d8b:	29 ca                	sub    %ecx,%edx
+  802d8d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802d91:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  802d95:	83 c0 01             	add    $0x1,%eax
+  802d98:	89 43 04             	mov    %eax,0x4(%ebx)
+  802d9b:	83 c7 01             	add    $0x1,%edi
+  802d9e:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802da1:	75 a4                	jne    802d47 <devpipe_write+0x22>
+  802da3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802da6:	eb 05                	jmp    802dad <devpipe_write+0x88>
+  802da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db0:	5b                   	pop    %ebx
+  802db1:	5e                   	pop    %esi
+  802db2:	5f                   	pop    %edi
+  802db3:	5d                   	pop    %ebp
+  802db4:	c3                   	ret
+
+00802db5 <devpipe_read>:
+  802db5:	55                   	push   %ebp
+  802db6:	89 e5                	mov    %esp,%ebp
+  802db8:	57                   	push   %edi
+  802db9:	56                   	push   %esi
+  802dba:	53                   	push   %ebx
+  802dbb:	83 ec 18             	sub    $0x18,%esp
+  802dbe:	8b 75 08             	mov    0x8(%ebp),%esi
+  802dc1:	56                   	push   %esi
+  802dc2:	e8 19 ed ff ff       	call   801ae0 <fd2data>
+  802dc7:	89 c3                	mov    %eax,%ebx
+  802dc9:	83 c4 10             	add    $0x10,%esp
+  802dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dd5:	74 45                	je     802e1c <devpipe_read+0x67>
+  802dd7:	8b 03                	mov    (%ebx),%eax
+  802dd9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ddc:	75 1d                	jne    802dfb <devpipe_read+0x46>
+  802dde:	85 ff                	test   %edi,%edi
+  802de0:	75 3f                	jne    802e21 <devpipe_read+0x6c>
+  802de2:	89 da                	mov    %ebx,%edx
+  802de4:	89 f0                	mov    %esi,%eax
+  802de6:	e8 d5 fe ff ff       	call   802cc0 <_pipeisclosed>
+  802deb:	85 c0                	test   %eax,%eax
+  802ded:	75 3c                	jne    802e2b <devpipe_read+0x76>
+  802def:	e8 d4 e2 ff ff       	call   8010c8 <sys_yield>
+  802df4:	8b 03                	mov    (%ebx),%eax
+  802df6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802df9:	74 e7                	je     802de2 <devpipe_read+0x2d>
+  802dfb:	99                   	cltd
+  802dfc:	c1 ea 1b             	shr    $0x1b,%edx
+  802dff:	01 d0                	add    %edx,%eax
+  802e01:	83 e0 1f             	and    $0x1f,%eax
+  802e04:	29 d0                	sub    %edx,%eax
+  802e06:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e0e:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802e11:	83 03 01             	addl   $0x1,(%ebx)
+  802e14:	83 c7 01             	add    $0x1,%edi
+  802e17:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802e1a:	75 bb                	jne    802dd7 <devpipe_read+0x22>
+  802e1c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e1f:	eb 02                	jmp    802e23 <devpipe_read+0x6e>
+  802e21:	89 f8                	mov    %edi,%eax
+  802e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e26:	5b                   	pop    %ebx
+  802e27:	5e                   	pop    %esi
+  802e28:	5f                   	pop    %edi
+  802e29:	5d                   	pop    %ebp
+  802e2a:	c3                   	ret
+  802e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e30:	eb f1                	jmp    802e23 <devpipe_read+0x6e>
+
+00802e32 <pipe>:
+  802e32:	55                   	push   %ebp
+  802e33:	89 e5                	mov    %esp,%ebp
+  802e35:	56                   	push   %esi
+  802e36:	53                   	push   %ebx
+  802e37:	83 ec 1c             	sub    $0x1c,%esp
+  802e3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e3d:	50                   	push   %eax
+  802e3e:	e8 b4 ec ff ff       	call   801af7 <fd_alloc>
+  802e43:	89 c3                	mov    %eax,%ebx
+  802e45:	83 c4 10             	add    $0x10,%esp
+  802e48:	85 c0                	test   %eax,%eax
+  802e4a:	0f 88 23 01 00 00    	js     802f73 <pipe+0x141>
+  802e50:	83 ec 04             	sub    $0x4,%esp
+  802e53:	68 07 04 00 00       	push   $0x407
+  802e58:	ff 75 f4             	push   -0xc(%ebp)
+  802e5b:	6a 00                	push   $0x0
+  802e5d:	e8 b1 e2 ff ff       	call   801113 <sys_page_alloc>
+  802e62:	89 c3                	mov    %eax,%ebx
+  802e64:	83 c4 10             	add    $0x10,%esp
+  802e67:	85 c0                	test   %eax,%eax
+  802e69:	0f 88 04 01 00 00    	js     802f73 <pipe+0x141>
+  802e6f:	83 ec 0c             	sub    $0xc,%esp
+  802e72:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e75:	50                   	push   %eax
+  802e76:	e8 7c ec ff ff       	call   801af7 <fd_alloc>
+  802e7b:	89 c3                	mov    %eax,%ebx
+  802e7d:	83 c4 10             	add    $0x10,%esp
+  802e80:	85 c0                	test   %eax,%eax
+  802e82:	0f 88 db 00 00 00    	js     802f63 <pipe+0x131>
+  802e88:	83 ec 04             	sub    $0x4,%esp
+  802e8b:	68 07 04 00 00       	push   $0x407
+  802e90:	ff 75 f0             	push   -0x10(%ebp)
+  802e93:	6a 00                	push   $0x0
+  802e95:	e8 79 e2 ff ff       	call   801113 <sys_page_alloc>
+  802e9a:	89 c3                	mov    %eax,%ebx
+  802e9c:	83 c4 10             	add    $0x10,%esp
+  802e9f:	85 c0                	test   %eax,%eax
+  802ea1:	0f 88 bc 00 00 00    	js     802f63 <pipe+0x131>
+  802ea7:	83 ec 0c             	sub    $0xc,%esp
+  802eaa:	ff 75 f4             	push   -0xc(%ebp)
+  802ead:	e8 2e ec ff ff       	call   801ae0 <fd2data>
+  802eb2:	89 c6                	mov    %eax,%esi
+  802eb4:	83 c4 0c             	add    $0xc,%esp
+  802eb7:	68 07 04 00 00       	push   $0x407
+  802ebc:	50                   	push   %eax
+  802ebd:	6a 00                	push   $0x0
+  802ebf:	e8 4f e2 ff ff       	call   801113 <sys_page_alloc>
+  802ec4:	89 c3                	mov    %eax,%ebx
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	0f 88 82 00 00 00    	js     802f53 <pipe+0x121>
+  802ed1:	83 ec 0c             	sub    $0xc,%esp
+  802ed4:	ff 75 f0             	push   -0x10(%ebp)
+  802ed7:	e8 04 ec ff ff       	call   801ae0 <fd2data>
+  802edc:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ee3:	50                   	push   %eax
+  802ee4:	6a 00                	push   $0x0
+  802ee6:	56                   	push   %esi
+  802ee7:	6a 00                	push   $0x0
+  802ee9:	e8 68 e2 ff ff       	call   801156 <sys_page_map>
+  802eee:	89 c3                	mov    %eax,%ebx
+  802ef0:	83 c4 20             	add    $0x20,%esp
+  802ef3:	85 c0                	test   %eax,%eax
+  802ef5:	78 4e                	js     802f45 <pipe+0x113>
+  802ef7:	a1 40 40 80 00       	mov    0x804040,%eax
+  802efc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802eff:	89 02                	mov    %eax,(%edx)
+  802f01:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f04:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802f0b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f0e:	89 02                	mov    %eax,(%edx)
+  802f10:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f13:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802f1a:	83 ec 0c             	sub    $0xc,%esp
+  802f1d:	ff 75 f4             	push   -0xc(%ebp)
+  802f20:	e8 ab eb ff ff       	call   801ad0 <fd2num>
+  802f25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f28:	89 01                	mov    %eax,(%ecx)
+  802f2a:	83 c4 04             	add    $0x4,%esp
+  802f2d:	ff 75 f0             	push   -0x10(%ebp)
+  802f30:	e8 9b eb ff ff       	call   801ad0 <fd2num>
+  802f35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f38:	89 41 04             	mov    %eax,0x4(%ecx)
+  802f3b:	83 c4 10             	add    $0x10,%esp
+  802f3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f43:	eb 2e                	jmp    802f73 <pipe+0x141>
+  802f45:	83 ec 08             	sub    $0x8,%esp
+  802f48:	56                   	push   %esi
+  802f49:	6a 00                	push   $0x0
+  802f4b:	e8 95 e2 ff ff       	call   8011e5 <sys_page_unmap>
+  802f50:	83 c4 10             	add    $0x10,%esp
+  802f53:	83 ec 08             	sub    $0x8,%esp
+  802f56:	ff 75 f0             	push   -0x10(%ebp)
+  802f59:	6a 00                	push   $0x0
+  802f5b:	e8 85 e2 ff ff       	call   8011e5 <sys_page_unmap>
+  802f60:	83 c4 10             	add    $0x10,%esp
+  802f63:	83 ec 08             	sub    $0x8,%esp
+  802f66:	ff 75 f4             	push   -0xc(%ebp)
+  802f69:	6a 00                	push   $0x0
+  802f6b:	e8 75 e2 ff ff       	call   8011e5 <sys_page_unmap>
+  802f70:	83 c4 10             	add    $0x10,%esp
+  802f73:	89 d8                	mov    %ebx,%eax
+  802f75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f78:	5b                   	pop    %ebx
+  802f79:	5e                   	pop    %esi
+  802f7a:	5d                   	pop    %ebp
+  802f7b:	c3                   	ret
+
+00802f7c <pipeisclosed>:
+  802f7c:	55                   	push   %ebp
+  802f7d:	89 e5                	mov    %esp,%ebp
+  802f7f:	83 ec 20             	sub    $0x20,%esp
+  802f82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f85:	50                   	push   %eax
+  802f86:	ff 75 08             	push   0x8(%ebp)
+  802f89:	e8 b9 eb ff ff       	call   801b47 <fd_lookup>
+  802f8e:	83 c4 10             	add    $0x10,%esp
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	78 18                	js     802fad <pipeisclosed+0x31>
+  802f95:	83 ec 0c             	sub    $0xc,%esp
+  802f98:	ff 75 f4             	push   -0xc(%ebp)
+  802f9b:	e8 40 eb ff ff       	call   801ae0 <fd2data>
+  802fa0:	89 c2                	mov    %eax,%edx
+  802fa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fa5:	e8 16 fd ff ff       	call   802cc0 <_pipeisclosed>
+  802faa:	83 c4 10             	add    $0x10,%esp
+  802fad:	c9                   	leave
+  802fae:	c3                   	ret
+
+00802faf <ipcring_init>:
+  802faf:	55                   	push   %ebp
+  802fb0:	89 e5                	mov    %esp,%ebp
+  802fb2:	53                   	push   %ebx
+  802fb3:	83 ec 08             	sub    $0x8,%esp
+  802fb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fb9:	6a 60                	push   $0x60
+  802fbb:	6a 00                	push   $0x0
+  802fbd:	53                   	push   %ebx
+  802fbe:	e8 6b de ff ff       	call   800e2e <memset>
+  802fc3:	a1 88 60 80 00       	mov    0x806088,%eax
+  802fc8:	8b 40 48             	mov    0x48(%eax),%eax
+  802fcb:	89 03                	mov    %eax,(%ebx)
+  802fcd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fd0:	89 43 04             	mov    %eax,0x4(%ebx)
+  802fd3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fd6:	89 43 08             	mov    %eax,0x8(%ebx)
+  802fd9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fdc:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802fdf:	83 c4 10             	add    $0x10,%esp
+  802fe2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fe5:	c9                   	leave
+  802fe6:	c3                   	ret
+
+00802fe7 <ipcring_req_slot>:
+  802fe7:	55                   	push   %ebp
+  802fe8:	89 e5                	mov    %esp,%ebp
+  802fea:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fed:	8b 50 10             	mov    0x10(%eax),%edx
+  802ff0:	8b 48 18             	mov    0x18(%eax),%ecx
+  802ff3:	29 ca                	sub    %ecx,%edx
+  802ff5:	83 fa 07             	cmp    $0x7,%edx
+  802ff8:	77 0c                	ja     803006 <ipcring_req_slot+0x1f>
+  802ffa:	8b 50 10             	mov    0x10(%eax),%edx
+  802ffd:	83 e2 07             	and    $0x7,%edx
+  803000:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  803004:	5d                   	pop    %ebp
+  803005:	c3                   	ret
+  803006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80300b:	eb f7                	jmp    803004 <ipcring_req_slot+0x1d>
+
+0080300d <ipcring_req_push>:
+  80300d:	55                   	push   %ebp
+  80300e:	89 e5                	mov    %esp,%ebp
+  803010:	83 ec 08             	sub    $0x8,%esp
+  803013:	8b 55 08             	mov    0x8(%ebp),%edx
+  803016:	8b 42 10             	mov    0x10(%edx),%eax
+  803019:	83 c0 01             	add    $0x1,%eax
+  80301c:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  803020:	b8 00 00 00 00       	mov    $0x0,%eax
+  803025:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  803029:	85 c0                	test   %eax,%eax
+  80302b:	75 02                	jne    80302f <ipcring_req_push+0x22>
+  80302d:	c9                   	leave
+  80302e:	c3                   	ret
+  80302f:	6a 00                	push   $0x0
+  803031:	68 00 00 80 ee       	push   $0xee800000
+  803036:	ff 72 08             	push   0x8(%edx)
+  803039:	ff 72 04             	push   0x4(%edx)
+  80303c:	e8 0a e4 ff ff       	call   80144b <sys_ipc_send>
+  803041:	83 c4 10             	add    $0x10,%esp
+  803044:	eb e7                	jmp    80302d <ipcring_req_push+0x20>
+
+00803046 <ipcring_rsp_wait>:
+  803046:	55                   	push   %ebp
+  803047:	89 e5                	mov    %esp,%ebp
+  803049:	53                   	push   %ebx
+  80304a:	83 ec 04             	sub    $0x4,%esp
+  80304d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803050:	8b 53 18             	mov    0x18(%ebx),%edx
+  803053:	8b 43 10             	mov    0x10(%ebx),%eax
+  803056:	39 c2                	cmp    %eax,%edx
+  803058:	74 3c                	je     803096 <ipcring_rsp_wait+0x50>
+  80305a:	8b 53 14             	mov    0x14(%ebx),%edx
+  80305d:	8b 43 18             	mov    0x18(%ebx),%eax
+  803060:	39 c2                	cmp    %eax,%edx
+  803062:	75 23                	jne    803087 <ipcring_rsp_wait+0x41>
+  803064:	83 ec 08             	sub    $0x8,%esp
+  803067:	6a 00                	push   $0x0
+  803069:	6a 00                	push   $0x0
+  80306b:	6a 00                	push   $0x0
+  80306d:	6a 00                	push   $0x0
+  80306f:	ff 73 0c             	push   0xc(%ebx)
+  803072:	ff 73 04             	push   0x4(%ebx)
+  803075:	e8 81 03 00 00       	call   8033fb <ipc_call>
+  80307a:	8b 53 14             	mov    0x14(%ebx),%edx
+  80307d:	8b 43 18             	mov    0x18(%ebx),%eax
+  803080:	83 c4 20             	add    $0x20,%esp
+  803083:	39 c2                	cmp    %eax,%edx
+  803085:	74 dd                	je     803064 <ipcring_rsp_wait+0x1e>
+  803087:	8b 43 18             	mov    0x18(%ebx),%eax
+  80308a:	83 e0 07             	and    $0x7,%eax
+  80308d:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  803091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803094:	c9                   	leave
+  803095:	c3                   	ret
+  803096:	68 d8 3c 80 00       	push   $0x803cd8
+  80309b:	68 89 3c 80 00       	push   $0x803c89
+  8030a0:	6a 3b                	push   $0x3b
+  8030a2:	68 f9 3c 80 00       	push   $0x803cf9
+  8030a7:	e8 35 d4 ff ff       	call   8004e1 <_panic>
+
+008030ac <ipcring_rsp_pop>:
+  8030ac:	55                   	push   %ebp
+  8030ad:	89 e5                	mov    %esp,%ebp
+  8030af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030b2:	8b 42 18             	mov    0x18(%edx),%eax
+  8030b5:	83 c0 01             	add    $0x1,%eax
+  8030b8:	89 42 18             	mov    %eax,0x18(%edx)
+  8030bb:	5d                   	pop    %ebp
+  8030bc:	c3                   	ret
+
+008030bd <ipcring_server_init>:
+  8030bd:	55                   	push   %ebp
+  8030be:	89 e5                	mov    %esp,%ebp
+  8030c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030c6:	89 10                	mov    %edx,(%eax)
+  8030c8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8030cb:	89 50 04             	mov    %edx,0x4(%eax)
+  8030ce:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  8030d5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  8030dc:	5d                   	pop    %ebp
+  8030dd:	c3                   	ret
+
+008030de <ipcring_req_avail>:
+  8030de:	55                   	push   %ebp
+  8030df:	89 e5                	mov    %esp,%ebp
+  8030e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030e4:	8b 02                	mov    (%edx),%eax
+  8030e6:	8b 40 10             	mov    0x10(%eax),%eax
+  8030e9:	2b 42 08             	sub    0x8(%edx),%eax
+  8030ec:	ba 08 00 00 00       	mov    $0x8,%edx
+  8030f1:	39 d0                	cmp    %edx,%eax
+  8030f3:	0f 47 c2             	cmova  %edx,%eax
+  8030f6:	5d                   	pop    %ebp
+  8030f7:	c3                   	ret
+
+008030f8 <ipcring_req_peek>:
+  8030f8:	55                   	push   %ebp
+  8030f9:	89 e5                	mov    %esp,%ebp
+  8030fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030fe:	8b 42 08             	mov    0x8(%edx),%eax
+  803101:	83 e0 07             	and    $0x7,%eax
+  803104:	8b 12                	mov    (%edx),%edx
+  803106:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  80310a:	5d                   	pop    %ebp
+  80310b:	c3                   	ret
+
+0080310c <ipcring_rsp_push>:
+  80310c:	55                   	push   %ebp
+  80310d:	89 e5                	mov    %esp,%ebp
+  80310f:	83 ec 08             	sub    $0x8,%esp
+  803112:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803115:	8b 41 08             	mov    0x8(%ecx),%eax
+  803118:	83 c0 01             	add    $0x1,%eax
+  80311b:	89 41 08             	mov    %eax,0x8(%ecx)
+  80311e:	8b 11                	mov    (%ecx),%edx
+  803120:	83 c2 14             	add    $0x14,%edx
+  803123:	f0 87 02             	lock xchg %eax,(%edx)
+  803126:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  80312a:	75 02                	jne    80312e <ipcring_rsp_push+0x22>
+  80312c:	c9                   	leave
+  80312d:	c3                   	ret
+  80312e:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  803135:	6a 00                	push   $0x0
+  803137:	68 00 00 80 ee       	push   $0xee800000
+  80313c:	6a 00                	push   $0x0
+  80313e:	ff 71 04             	push   0x4(%ecx)
+  803141:	e8 28 e2 ff ff       	call   80136e <sys_ipc_try_send>
+  803146:	83 c4 10             	add    $0x10,%esp
+  803149:	eb e1                	jmp    80312c <ipcring_rsp_push+0x20>
+
+0080314b <ipcring_client_wait>:
+  80314b:	55                   	push   %ebp
+  80314c:	89 e5                	mov    %esp,%ebp
+  80314e:	83 ec 08             	sub    $0x8,%esp
+  803151:	8b 45 08             	mov    0x8(%ebp),%eax
+  803154:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  80315b:	8b 10                	mov    (%eax),%edx
+  80315d:	8b 52 18             	mov    0x18(%edx),%edx
+  803160:	3b 50 08             	cmp    0x8(%eax),%edx
+  803163:	75 02                	jne    803167 <ipcring_client_wait+0x1c>
+  803165:	c9                   	leave
+  803166:	c3                   	ret
+  803167:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  80316e:	6a 00                	push   $0x0
+  803170:	68 00 00 80 ee       	push   $0xee800000
+  803175:	6a 00                	push   $0x0
+  803177:	ff 70 04             	push   0x4(%eax)
+  80317a:	e8 ef e1 ff ff       	call   80136e <sys_ipc_try_send>
+  80317f:	83 c4 10             	add    $0x10,%esp
+  803182:	eb e1                	jmp    803165 <ipcring_client_wait+0x1a>
+
+00803184 <ipcring_server_sleep>:
+  803184:	55                   	push   %ebp
+  803185:	89 e5                	mov    %esp,%ebp
+  803187:	53                   	push   %ebx
+  803188:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80318b:	8b 01                	mov    (%ecx),%eax
+  80318d:	8d 50 1c             	lea    0x1c(%eax),%edx
+  803190:	b8 01 00 00 00       	mov    $0x1,%eax
+  803195:	f0 87 02             	lock xchg %eax,(%edx)
+  803198:	8b 11                	mov    (%ecx),%edx
+  80319a:	8b 5a 10             	mov    0x10(%edx),%ebx
+  80319d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031a2:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  8031a5:	74 0e                	je     8031b5 <ipcring_server_sleep+0x31>
+  8031a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ac:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8031b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031b8:	c9                   	leave
+  8031b9:	c3                   	ret
+
+008031ba <devcons_close>:
+  8031ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bf:	c3                   	ret
+
+008031c0 <devcons_stat>:
+  8031c0:	55                   	push   %ebp
+  8031c1:	89 e5                	mov    %esp,%ebp
+  8031c3:	83 ec 10             	sub    $0x10,%esp
+  8031c6:	68 07 3d 80 00       	push   $0x803d07
+  8031cb:	ff 75 0c             	push   0xc(%ebp)
+  8031ce:	e8 e0 da ff ff       	call   800cb3 <strcpy>
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d8:	c9                   	leave
+  8031d9:	c3                   	ret
+
+008031da <devcons_write>:
+  8031da:	55                   	push   %ebp
+  8031db:	89 e5                	mov    %esp,%ebp
+  8031dd:	57                   	push   %edi
+  8031de:	56                   	push   %esi
+  8031df:	53                   	push   %ebx
+  8031e0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8031e6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8031e9:	85 ff                	test   %edi,%edi
+  8031eb:	74 51                	je     80323e <devcons_write+0x64>
+  8031ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f7:	89 fb                	mov    %edi,%ebx
+  8031f9:	29 c3                	sub    %eax,%ebx
+  8031fb:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803200:	39 d3                	cmp    %edx,%ebx
+  803202:	0f 47 da             	cmova  %edx,%ebx
+  803205:	83 ec 04             	sub    $0x4,%esp
+  803208:	53                   	push   %ebx
+  803209:	03 45 0c             	add    0xc(%ebp),%eax
+  80320c:	50                   	push   %eax
+  80320d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803213:	50                   	push   %eax
+  803214:	e8 4a dc ff ff       	call   800e63 <memmove>
+  803219:	83 c4 08             	add    $0x8,%esp
+  80321c:	53                   	push   %ebx
+  80321d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803223:	50                   	push   %eax
+  803224:	e8 02 de ff ff       	call   80102b <sys_cputs>
+  803229:	01 de                	add    %ebx,%esi
+  80322b:	89 f0                	mov    %esi,%eax
+  80322d:	83 c4 10             	add    $0x10,%esp
+  803230:	39 fe                	cmp    %edi,%esi
+  803232:	72 c3                	jb     8031f7 <devcons_write+0x1d>
+  803234:	89 f0                	mov    %esi,%eax
+  803236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803239:	5b                   	pop    %ebx
+  80323a:	5e                   	pop    %esi
+  80323b:	5f                   	pop    %edi
+  80323c:	5d                   	pop    %ebp
+  80323d:	c3                   	ret
+  80323e:	be 00 00 00 00       	mov    $0x0,%esi
+  803243:	eb ef                	jmp    803234 <devcons_write+0x5a>
+
+00803245 <devcons_read>:
+  803245:	55                   	push   %ebp
+  803246:	89 e5                	mov    %esp,%ebp
+  803248:	83 ec 08             	sub    $0x8,%esp
+  80324b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803250:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803254:	75 07                	jne    80325d <devcons_read+0x18>
+  803256:	eb 1f                	jmp    803277 <devcons_read+0x32>
+  803258:	e8 6b de ff ff       	call   8010c8 <sys_yield>
+  80325d:	e8 e7 dd ff ff       	call   801049 <sys_cgetc>
+  803262:	85 c0                	test   %eax,%eax
+  803264:	74 f2                	je     803258 <devcons_read+0x13>
+  803266:	78 0f                	js     803277 <devcons_read+0x32>
+  803268:	83 f8 04             	cmp    $0x4,%eax
+  80326b:	74 0c                	je     803279 <devcons_read+0x34>
+  80326d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803270:	88 02                	mov    %al,(%edx)
+  803272:	b8 01 00 00 00       	mov    $0x1,%eax
+  803277:	c9                   	leave
+  803278:	c3                   	ret
+  803279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327e:	eb f7                	jmp    803277 <devcons_read+0x32>
+
+00803280 <cputchar>:
+  803280:	55                   	push   %ebp
+  803281:	89 e5                	mov    %esp,%ebp
+  803283:	83 ec 20             	sub    $0x20,%esp
+  803286:	8b 45 08             	mov    0x8(%ebp),%eax
+  803289:	88 45 f7             	mov    %al,-0x9(%ebp)
+  80328c:	6a 01                	push   $0x1
+  80328e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803291:	50                   	push   %eax
+  803292:	e8 94 dd ff ff       	call   80102b <sys_cputs>
+  803297:	83 c4 10             	add    $0x10,%esp
+  80329a:	c9                   	leave
+  80329b:	c3                   	ret
+
+0080329c <getchar>:
+  80329c:	55                   	push   %ebp
+  80329d:	89 e5                	mov    %esp,%ebp
+  80329f:	83 ec 1c             	sub    $0x1c,%esp
+  8032a2:	6a 01                	push   $0x1
+  8032a4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032a7:	50                   	push   %eax
+  8032a8:	6a 00                	push   $0x0
+  8032aa:	e8 fa ea ff ff       	call   801da9 <read>
+  8032af:	83 c4 10             	add    $0x10,%esp
+  8032b2:	85 c0                	test   %eax,%eax
+  8032b4:	78 06                	js     8032bc <getchar+0x20>
+  8032b6:	74 06                	je     8032be <getchar+0x22>
+  8032b8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  8032bc:	c9                   	leave
+  8032bd:	c3                   	ret
+  8032be:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8032c3:	eb f7                	jmp    8032bc <getchar+0x20>
+
+008032c5 <iscons>:
+  8032c5:	55                   	push   %ebp
+  8032c6:	89 e5                	mov    %esp,%ebp
+  8032c8:	83 ec 20             	sub    $0x20,%esp
+  8032cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032ce:	50                   	push   %eax
+  8032cf:	ff 75 08             	push   0x8(%ebp)
+  8032d2:	e8 70 e8 ff ff       	call   801b47 <fd_lookup>
+  8032d7:	83 c4 10             	add    $0x10,%esp
+  8032da:	85 c0                	test   %eax,%eax
+  8032dc:	78 11                	js     8032ef <iscons+0x2a>
+  8032de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e1:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8032e7:	39 10                	cmp    %edx,(%eax)
+  8032e9:	0f 94 c0             	sete   %al
+  8032ec:	0f b6 c0             	movzbl %al,%eax
+  8032ef:	c9                   	leave
+  8032f0:	c3                   	ret
+
+008032f1 <opencons>:
+  8032f1:	55                   	push   %ebp
+  8032f2:	89 e5                	mov    %esp,%ebp
+  8032f4:	83 ec 24             	sub    $0x24,%esp
+  8032f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032fa:	50                   	push   %eax
+  8032fb:	e8 f7 e7 ff ff       	call   801af7 <fd_alloc>
+  803300:	83 c4 10             	add    $0x10,%esp
+  803303:	85 c0                	test   %eax,%eax
+  803305:	78 3a                	js     803341 <opencons+0x50>
+  803307:	83 ec 04             	sub    $0x4,%esp
+  80330a:	68 07 04 00 00       	push   $0x407
+  80330f:	ff 75 f4             	push   -0xc(%ebp)
+  803312:	6a 00                	push   $0x0
+  803314:	e8 fa dd ff ff       	call   801113 <sys_page_alloc>
+  803319:	83 c4 10             	add    $0x10,%esp
+  80331c:	85 c0                	test   %eax,%eax
+  80331e:	78 21                	js     803341 <opencons+0x50>
+  803320:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803323:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  803329:	89 10                	mov    %edx,(%eax)
+  80332b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80332e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  803335:	83 ec 0c             	sub    $0xc,%esp
+  803338:	50                   	push   %eax
+  803339:	e8 92 e7 ff ff       	call   801ad0 <fd2num>
+  80333e:	83 c4 10             	add    $0x10,%esp
+  803341:	c9                   	leave
+  803342:	c3                   	ret
+
+00803343 <ipc_recv>:
+  803343:	55                   	push   %ebp
+  803344:	89 e5                	mov    %esp,%ebp
+  803346:	56                   	push   %esi
+  803347:	53                   	push   %ebx
+  803348:	8b 75 08             	mov    0x8(%ebp),%esi
+  80334b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80334e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803351:	85 c0                	test   %eax,%eax
+  803353:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  803358:	0f 44 c2             	cmove  %edx,%eax
+  80335b:	83 ec 0c             	sub    $0xc,%esp
+  80335e:	50                   	push   %eax
+  80335f:	e8 5a e0 ff ff       	call   8013be <sys_ipc_recv>
+  803364:	83 c4 10             	add    $0x10,%esp
+  803367:	85 c0                	test   %eax,%eax
+  803369:	78 2a                	js     803395 <ipc_recv+0x52>
+  80336b:	a1 88 60 80 00       	mov    0x806088,%eax
+  803370:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  803376:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  80337c:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803382:	85 f6                	test   %esi,%esi
+  803384:	74 02                	je     803388 <ipc_recv+0x45>
+  803386:	89 0e                	mov    %ecx,(%esi)
+  803388:	85 db                	test   %ebx,%ebx
+  80338a:	74 02                	je     80338e <ipc_recv+0x4b>
+  80338c:	89 13                	mov    %edx,(%ebx)
+  80338e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803391:	5b                   	pop    %ebx
+  803392:	5e                   	pop    %esi
+  803393:	5d                   	pop    %ebp
+  803394:	c3                   	ret
+  803395:	ba 00 00 00 00       	mov    $0x0,%edx
+  80339a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80339f:	eb e1                	jmp    803382 <ipc_recv+0x3f>
+
+008033a1 <ipc_send>:
+  8033a1:	55                   	push   %ebp
+  8033a2:	89 e5                	mov    %esp,%ebp
+  8033a4:	57                   	push   %edi
+  8033a5:	56                   	push   %esi
+  8033a6:	53                   	push   %ebx
+  8033a7:	83 ec 0c             	sub    $0xc,%esp
+  8033aa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8033ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033b0:	8b 75 14             	mov    0x14(%ebp),%esi
+  8033b3:	85 db                	test   %ebx,%ebx
+  8033b5:	74 1e                	je     8033d5 <ipc_send+0x34>
+  8033b7:	56                   	push   %esi
+  8033b8:	53                   	push   %ebx
+  8033b9:	57                   	push   %edi
+  8033ba:	ff 75 08             	push   0x8(%ebp)
+  8033bd:	e8 89 e0 ff ff       	call   80144b <sys_ipc_send>
+  8033c2:	83 c4 10             	add    $0x10,%esp
+  8033c5:	85 c0                	test   %eax,%eax
+  8033c7:	74 2a                	je     8033f3 <ipc_send+0x52>
+  8033c9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033cc:	75 13                	jne    8033e1 <ipc_send+0x40>
+  8033ce:	e8 f5 dc ff ff       	call   8010c8 <sys_yield>
+  8033d3:	eb e2                	jmp    8033b7 <ipc_send+0x16>
+  8033d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8033da:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8033df:	eb d6                	jmp    8033b7 <ipc_send+0x16>
+  8033e1:	50                   	push   %eax
+  8033e2:	68 14 3d 80 00       	push   $0x803d14
+  8033e7:	6a 4f                	push   $0x4f
+  8033e9:	68 57 3d 80 00       	push   $0x803d57
+  8033ee:	e8 ee d0 ff ff       	call   8004e1 <_panic>
+  8033f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f6:	5b                   	pop    %ebx
+  8033f7:	5e                   	pop    %esi
+  8033f8:	5f                   	pop    %edi
+  8033f9:	5d                   	pop    %ebp
+  8033fa:	c3                   	ret
+
+008033fb <ipc_call>:
+  8033fb:	55                   	push   %ebp
+  8033fc:	89 e5                	mov    %esp,%ebp
+  8033fe:	57                   	push   %edi
+  8033ff:	56                   	push   %esi
+  803400:	53                   	push   %ebx
+  803401:	83 ec 0c             	sub    $0xc,%esp
+  803404:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803408:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  80340d:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  803411:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803415:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  80341a:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  80341e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803422:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803427:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  80342b:	eb 05                	jmp    803432 <ipc_call+0x37>
+  80342d:	e8 96 dc ff ff       	call   8010c8 <sys_yield>
+  803432:	83 ec 0c             	sub    $0xc,%esp
+  803435:	56                   	push   %esi
+  803436:	53                   	push   %ebx
+  803437:	57                   	push   %edi
+  803438:	ff 75 0c             	push   0xc(%ebp)
+  80343b:	ff 75 08             	push   0x8(%ebp)
+  80343e:	e8 58 e0 ff ff       	call   80149b <sys_ipc_call>
+  803443:	83 c4 20             	add    $0x20,%esp
+  803446:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803449:	74 e2                	je     80342d <ipc_call+0x32>
+  80344b:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80344e:	74 2d                	je     80347d <ipc_call+0x82>
+  803450:	85 c0                	test   %eax,%eax
+  803452:	78 4f                	js     8034a3 <ipc_call+0xa8>
+  803454:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  803458:	74 10                	je     80346a <ipc_call+0x6f>
+  80345a:	a1 88 60 80 00       	mov    0x806088,%eax
+  80345f:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803465:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803468:	89 02                	mov    %eax,(%edx)
+  80346a:	a1 88 60 80 00       	mov    0x806088,%eax
+  80346f:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803478:	5b                   	pop    %ebx
+  803479:	5e                   	pop    %esi
+  80347a:	5f                   	pop    %edi
+  80347b:	5d                   	pop    %ebp
+  80347c:	c3                   	ret
+  80347d:	ff 75 14             	push   0x14(%ebp)
+  803480:	ff 75 10             	push   0x10(%ebp)
+  803483:	ff 75 0c             	push   0xc(%ebp)
+  803486:	ff 75 08             	push   0x8(%ebp)
+  803489:	e8 13 ff ff ff       	call   8033a1 <ipc_send>
+  80348e:	83 c4 0c             	add    $0xc,%esp
+  803491:	ff 75 1c             	push   0x1c(%ebp)
+  803494:	ff 75 18             	push   0x18(%ebp)
+  803497:	6a 00                	push   $0x0
+  803499:	e8 a5 fe ff ff       	call   803343 <ipc_recv>
+  80349e:	83 c4 10             	add    $0x10,%esp
+  8034a1:	eb d2                	jmp    803475 <ipc_call+0x7a>
+  8034a3:	50                   	push   %eax
+  8034a4:	68 61 3d 80 00       	push   $0x803d61
+  8034a9:	6a 6d                	push   $0x6d
+  8034ab:	68 57 3d 80 00       	push   $0x803d57
+  8034b0:	e8 2c d0 ff ff       	call   8004e1 <_panic>
+
+008034b5 <ipc_reply_recv>:
+  8034b5:	55                   	push   %ebp
+  8034b6:	89 e5                	mov    %esp,%ebp
+  8034b8:	57                   	push   %edi
+  8034b9:	56                   	push   %esi
+  8034ba:	53                   	push   %ebx
+  8034bb:	83 ec 0c             	sub    $0xc,%esp
+  8034be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034c1:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  8034c4:	8b 7d 20             	mov    0x20(%ebp),%edi
+  8034c7:	85 db                	test   %ebx,%ebx
+  8034c9:	0f 84 ac 00 00 00    	je     80357b <ipc_reply_recv+0xc6>
+  8034cf:	85 f6                	test   %esi,%esi
+  8034d1:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  8034d6:	0f 45 c6             	cmovne %esi,%eax
+  8034d9:	83 ec 0c             	sub    $0xc,%esp
+  8034dc:	50                   	push   %eax
+  8034dd:	ff 75 14             	push   0x14(%ebp)
+  8034e0:	53                   	push   %ebx
+  8034e1:	ff 75 0c             	push   0xc(%ebp)
+  8034e4:	ff 75 08             	push   0x8(%ebp)
+  8034e7:	e8 d0 df ff ff       	call   8014bc <sys_ipc_reply_recv>
+  8034ec:	83 c4 20             	add    $0x20,%esp
+  8034ef:	85 c0                	test   %eax,%eax
+  8034f1:	78 3a                	js     80352d <ipc_reply_recv+0x78>
+  8034f3:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  8034f7:	74 10                	je     803509 <ipc_reply_recv+0x54>
+  8034f9:	a1 88 60 80 00       	mov    0x806088,%eax
+  8034fe:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  803504:	8b 55 18             	mov    0x18(%ebp),%edx
+  803507:	89 02                	mov    %eax,(%edx)
+  803509:	85 ff                	test   %edi,%edi
+  80350b:	74 0d                	je     80351a <ipc_reply_recv+0x65>
+  80350d:	a1 88 60 80 00       	mov    0x806088,%eax
+  803512:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803518:	89 07                	mov    %eax,(%edi)
+  80351a:	a1 88 60 80 00       	mov    0x806088,%eax
+  80351f:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  803525:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803528:	5b                   	pop    %ebx
+  803529:	5e                   	pop    %esi
+  80352a:	5f                   	pop    %edi
+  80352b:	5d                   	pop    %ebp
+  80352c:	c3                   	ret
+  80352d:	ff 75 14             	push   0x14(%ebp)
+  803530:	53                   	push   %ebx
+  803531:	ff 75 0c             	push   0xc(%ebp)
+  803534:	ff 75 08             	push   0x8(%ebp)
+  803537:	e8 32 de ff ff       	call   80136e <sys_ipc_try_send>
+  80353c:	89 c2                	mov    %eax,%edx
+  80353e:	c1 ea 1f             	shr    $0x1f,%edx
+  803541:	83 c4 10             	add    $0x10,%esp
+  803544:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803547:	0f 95 c1             	setne  %cl
+  80354a:	84 d1                	test   %dl,%cl
+  80354c:	74 05                	je     803553 <ipc_reply_recv+0x9e>
+  80354e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803551:	75 12                	jne    803565 <ipc_reply_recv+0xb0>
+  803553:	83 ec 04             	sub    $0x4,%esp
+  803556:	57                   	push   %edi
+  803557:	56                   	push   %esi
+  803558:	ff 75 18             	push   0x18(%ebp)
+  80355b:	e8 e3 fd ff ff       	call   803343 <ipc_recv>
+  803560:	83 c4 10             	add    $0x10,%esp
+  803563:	eb c0                	jmp    803525 <ipc_reply_recv+0x70>
+  803565:	83 ec 04             	sub    $0x4,%esp
+  803568:	50                   	push   %eax
+  803569:	ff 75 08             	push   0x8(%ebp)
+  80356c:	68 34 3d 80 00       	push   $0x803d34
+  803571:	e8 46 d0 ff ff       	call   8005bc <cprintf>
+  803576:	83 c4 10             	add    $0x10,%esp
+  803579:	eb d8                	jmp    803553 <ipc_reply_recv+0x9e>
+  80357b:	85 f6                	test   %esi,%esi
+  80357d:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  803582:	0f 45 c6             	cmovne %esi,%eax
+  803585:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  80358a:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  803591:	e9 43 ff ff ff       	jmp    8034d9 <ipc_reply_recv+0x24>
+
+00803596 <ipc_find_env>:
+  803596:	55                   	push   %ebp
+  803597:	89 e5                	mov    %esp,%ebp
+  803599:	83 ec 14             	sub    $0x14,%esp
+  80359c:	ff 75 08             	push   0x8(%ebp)
+  80359f:	e8 68 dd ff ff       	call   80130c <sys_env_service>
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ab:	0f 48 c2             	cmovs  %edx,%eax
+  8035ae:	c9                   	leave
+  8035af:	c3                   	ret
+
+008035b0 <pageref>:
+  8035b0:	55                   	push   %ebp
+  8035b1:	89 e5                	mov    %esp,%ebp
+  8035b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b6:	89 c2                	mov    %eax,%edx
+  8035b8:	c1 ea 16             	shr    $0x16,%edx
+  8035bb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8035c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c7:	f6 c1 01             	test   $0x1,%cl
+  8035ca:	74 22                	je     8035ee <pageref+0x3e>
+  8035cc:	c1 e8 0c             	shr    $0xc,%eax
+  8035cf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8035d6:	a8 01                	test   $0x1,%al
+  8035d8:	74 14                	je     8035ee <pageref+0x3e>
+  8035da:	c1 e8 0c             	shr    $0xc,%eax
+  8035dd:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035e0:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035e7:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  8035eb:	0f b7 d2             	movzwl %dx,%edx
+  8035ee:	89 d0                	mov    %edx,%eax
+  8035f0:	5d                   	pop    %ebp
+  8035f1:	c3                   	ret
+
+008035f2 <__udivmoddi4>:
+  8035f2:	55                   	push   %ebp
+  8035f3:	57                   	push   %edi
+  8035f4:	56                   	push   %esi
+  8035f5:	53                   	push   %ebx
+  8035f6:	83 ec 24             	sub    $0x24,%esp
+  8035f9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035fd:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803601:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803605:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803609:	8b 44 24 40          	mov    0x40(%esp),%eax
+  80360d:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803611:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803615:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803619:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  80361d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803622:	ba 00 00 00 00       	mov    $0x0,%edx
+  803627:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80362c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803633:	00 
+  803634:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80363b:	00 
+  80363c:	89 fb                	mov    %edi,%ebx
+  80363e:	eb 08                	jmp    803648 <__udivmoddi4+0x56>
+  803640:	83 e9 01             	sub    $0x1,%ecx
+  803643:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803646:	74 68                	je     8036b0 <__udivmoddi4+0xbe>
+  803648:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80364c:	01 c0                	add    %eax,%eax
+  80364e:	89 c6                	mov    %eax,%esi
+  803650:	89 d7                	mov    %edx,%edi
+  803652:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803656:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80365a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80365d:	d3 ea                	shr    %cl,%edx
+  80365f:	f6 c1 20             	test   $0x20,%cl
+  803662:	74 04                	je     803668 <__udivmoddi4+0x76>
+  803664:	89 d0                	mov    %edx,%eax
+  803666:	31 d2                	xor    %edx,%edx
+  803668:	83 e0 01             	and    $0x1,%eax
+  80366b:	89 04 24             	mov    %eax,(%esp)
+  80366e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803675:	00 
+  803676:	8b 04 24             	mov    (%esp),%eax
+  803679:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80367d:	09 f0                	or     %esi,%eax
+  80367f:	09 fa                	or     %edi,%edx
+  803681:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803685:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803689:	39 f0                	cmp    %esi,%eax
+  80368b:	89 d5                	mov    %edx,%ebp
+  80368d:	19 fd                	sbb    %edi,%ebp
+  80368f:	72 af                	jb     803640 <__udivmoddi4+0x4e>
+  803691:	29 f0                	sub    %esi,%eax
+  803693:	19 fa                	sbb    %edi,%edx
+  803695:	89 cf                	mov    %ecx,%edi
+  803697:	c1 ef 05             	shr    $0x5,%edi
+  80369a:	83 e7 01             	and    $0x1,%edi
+  80369d:	89 fe                	mov    %edi,%esi
+  80369f:	83 f6 01             	xor    $0x1,%esi
+  8036a2:	d3 e6                	shl    %cl,%esi
+  8036a4:	d3 e7                	shl    %cl,%edi
+  8036a6:	09 74 24 18          	or     %esi,0x18(%esp)
+  8036aa:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8036ae:	eb 90                	jmp    803640 <__udivmoddi4+0x4e>
+  8036b0:	85 db                	test   %ebx,%ebx
+  8036b2:	74 05                	je     8036b9 <__udivmoddi4+0xc7>
+  8036b4:	89 03                	mov    %eax,(%ebx)
+  8036b6:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036b9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036bd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036c1:	83 c4 24             	add    $0x24,%esp
+  8036c4:	5b                   	pop    %ebx
+  8036c5:	5e                   	pop    %esi
+  8036c6:	5f                   	pop    %edi
+  8036c7:	5d                   	pop    %ebp
+  8036c8:	c3                   	ret
+
+008036c9 <__udivdi3>:
+  8036c9:	83 ec 08             	sub    $0x8,%esp
+  8036cc:	6a 00                	push   $0x0
+  8036ce:	ff 74 24 1c          	push   0x1c(%esp)
+  8036d2:	ff 74 24 1c          	push   0x1c(%esp)
+  8036d6:	ff 74 24 1c          	push   0x1c(%esp)
+  8036da:	ff 74 24 1c          	push   0x1c(%esp)
+  8036de:	e8 0f ff ff ff       	call   8035f2 <__udivmoddi4>
+  8036e3:	83 c4 1c             	add    $0x1c,%esp
+  8036e6:	c3                   	ret
+
+008036e7 <__umoddi3>:
+  8036e7:	83 ec 18             	sub    $0x18,%esp
+  8036ea:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036ee:	50                   	push   %eax
+  8036ef:	ff 74 24 2c          	push   0x2c(%esp)
+  8036f3:	ff 74 24 2c          	push   0x2c(%esp)
+  8036f7:	ff 74 24 2c          	push   0x2c(%esp)
+  8036fb:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ff:	e8 ee fe ff ff       	call   8035f2 <__udivmoddi4>
+  803704:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803708:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80370c:	83 c4 2c             	add    $0x2c,%esp
+  80370f:	c3                   	ret
+
+00803710 <__divdi3>:
+  803710:	53                   	push   %ebx
+  803711:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803715:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803719:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80371d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803721:	85 d2                	test   %edx,%edx
+  803723:	78 12                	js     803737 <__divdi3+0x27>
+  803725:	85 db                	test   %ebx,%ebx
+  803727:	78 2e                	js     803757 <__divdi3+0x47>
+  803729:	53                   	push   %ebx
+  80372a:	51                   	push   %ecx
+  80372b:	52                   	push   %edx
+  80372c:	50                   	push   %eax
+  80372d:	e8 97 ff ff ff       	call   8036c9 <__udivdi3>
+  803732:	83 c4 10             	add    $0x10,%esp
+  803735:	eb 1e                	jmp    803755 <__divdi3+0x45>
+  803737:	f7 d8                	neg    %eax
+  803739:	83 d2 00             	adc    $0x0,%edx
+  80373c:	f7 da                	neg    %edx
+  80373e:	85 db                	test   %ebx,%ebx
+  803740:	78 2a                	js     80376c <__divdi3+0x5c>
+  803742:	53                   	push   %ebx
+  803743:	51                   	push   %ecx
+  803744:	52                   	push   %edx
+  803745:	50                   	push   %eax
+  803746:	e8 7e ff ff ff       	call   8036c9 <__udivdi3>
+  80374b:	83 c4 10             	add    $0x10,%esp
+  80374e:	f7 d8                	neg    %eax
+  803750:	83 d2 00             	adc    $0x0,%edx
+  803753:	f7 da                	neg    %edx
+  803755:	5b                   	pop    %ebx
+  803756:	c3                   	ret
+  803757:	f7 d9                	neg    %ecx
+  803759:	83 d3 00             	adc    $0x0,%ebx
+  80375c:	f7 db                	neg    %ebx
+  80375e:	53                   	push   %ebx
+  80375f:	51                   	push   %ecx
+  803760:	52                   	push   %edx
+  803761:	50                   	push   %eax
+  803762:	e8 62 ff ff ff       	call   8036c9 <__udivdi3>
+  803767:	83 c4 10             	add    $0x10,%esp
+  80376a:	eb e2                	jmp    80374e <__divdi3+0x3e>
+  80376c:	f7 d9                	neg    %ecx
+  80376e:	83 d3 00             	adc    $0x0,%ebx
+  803771:	f7 db                	neg    %ebx
+  803773:	53                   	push   %ebx
+  803774:	51                   	push   %ecx
+  803775:	52                   	push   %edx
+  803776:	50                   	push   %eax
+  803777:	e8 4d ff ff ff       	call   8036c9 <__udivdi3>
+  80377c:	83 c4 10             	add    $0x10,%esp
+  80377f:	eb d4                	jmp    803755 <__divdi3+0x45>
+
+00803781 <__moddi3>:
+  803781:	55                   	push   %ebp
+  803782:	57                   	push   %edi
+  803783:	56                   	push   %esi
+  803784:	53                   	push   %ebx
+  803785:	83 ec 0c             	sub    $0xc,%esp
+  803788:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80378c:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  803790:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803794:	89 e9                	mov    %ebp,%ecx
+  803796:	f7 d9                	neg    %ecx
+  803798:	89 d0                	mov    %edx,%eax
+  80379a:	83 d0 00             	adc    $0x0,%eax
+  80379d:	f7 d8                	neg    %eax
+  80379f:	0f 49 e9             	cmovns %ecx,%ebp
+  8037a2:	0f 49 d0             	cmovns %eax,%edx
+  8037a5:	52                   	push   %edx
+  8037a6:	55                   	push   %ebp
+  8037a7:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8037ab:	f7 da                	neg    %edx
+  8037ad:	89 d8                	mov    %ebx,%eax
+  8037af:	83 d0 00             	adc    $0x0,%eax
+  8037b2:	f7 d8                	neg    %eax
+  8037b4:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8037b9:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8037bd:	0f 48 c3             	cmovs  %ebx,%eax
+  8037c0:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8037c4:	ff 74 24 0c          	push   0xc(%esp)
+  8037c8:	ff 74 24 0c          	push   0xc(%esp)
+  8037cc:	e8 16 ff ff ff       	call   8036e7 <__umoddi3>
+  8037d1:	83 c4 10             	add    $0x10,%esp
+  8037d4:	85 db                	test   %ebx,%ebx
+  8037d6:	78 08                	js     8037e0 <__moddi3+0x5f>
+  8037d8:	83 c4 0c             	add    $0xc,%esp
+  8037db:	5b                   	pop    %ebx
+  8037dc:	5e                   	pop    %esi
+  8037dd:	5f                   	pop    %edi
+  8037de:	5d                   	pop    %ebp
+  8037df:	c3                   	ret
+  8037e0:	f7 d8                	neg    %eax
+  8037e2:	83 d2 00             	adc    $0x0,%edx
+  8037e5:	f7 da                	neg    %edx
+  8037e7:	eb ef                	jmp    8037d8 <__moddi3+0x57>
@@ -0,0 +1,5168 @@
+
+obj/user/writemotd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 b2 01 00 00       	call   8001e3 <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  80003f:	6a 00                	push   $0x0
+  800041:	68 20 33 80 00       	push   $0x803320
+  800046:	e8 47 21 00 00       	call   802192 <open>
+  80004b:	89 85 e4 fd ff ff    	mov    %eax,-0x21c(%ebp)
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 6f                	js     8000c7 <umain+0x94>
+  800058:	83 ec 08             	sub    $0x8,%esp
+  80005b:	6a 02                	push   $0x2
+  80005d:	68 4c 33 80 00       	push   $0x80334c
+  800062:	e8 2b 21 00 00       	call   802192 <open>
+  800067:	89 c7                	mov    %eax,%edi
+  800069:	83 c4 10             	add    $0x10,%esp
+  80006c:	85 c0                	test   %eax,%eax
+  80006e:	78 69                	js     8000d9 <umain+0xa6>
+  800070:	83 ec 04             	sub    $0x4,%esp
+  800073:	50                   	push   %eax
+  800074:	8b b5 e4 fd ff ff    	mov    -0x21c(%ebp),%esi
+  80007a:	56                   	push   %esi
+  80007b:	68 61 33 80 00       	push   $0x803361
+  800080:	e8 b2 02 00 00       	call   800337 <cprintf>
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	39 fe                	cmp    %edi,%esi
+  80008a:	74 5f                	je     8000eb <umain+0xb8>
+  80008c:	83 ec 0c             	sub    $0xc,%esp
+  80008f:	68 79 33 80 00       	push   $0x803379
+  800094:	e8 9e 02 00 00       	call   800337 <cprintf>
+  800099:	83 c4 10             	add    $0x10,%esp
+  80009c:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8000a2:	83 ec 04             	sub    $0x4,%esp
+  8000a5:	68 ff 01 00 00       	push   $0x1ff
+  8000aa:	53                   	push   %ebx
+  8000ab:	57                   	push   %edi
+  8000ac:	e8 24 19 00 00       	call   8019d5 <read>
+  8000b1:	83 c4 10             	add    $0x10,%esp
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	7e 47                	jle    8000ff <umain+0xcc>
+  8000b8:	83 ec 08             	sub    $0x8,%esp
+  8000bb:	50                   	push   %eax
+  8000bc:	53                   	push   %ebx
+  8000bd:	e8 e4 0c 00 00       	call   800da6 <sys_cputs>
+  8000c2:	83 c4 10             	add    $0x10,%esp
+  8000c5:	eb db                	jmp    8000a2 <umain+0x6f>
+  8000c7:	50                   	push   %eax
+  8000c8:	68 29 33 80 00       	push   $0x803329
+  8000cd:	6a 0b                	push   $0xb
+  8000cf:	68 3b 33 80 00       	push   $0x80333b
+  8000d4:	e8 83 01 00 00       	call   80025c <_panic>
+  8000d9:	50                   	push   %eax
+  8000da:	68 52 33 80 00       	push   $0x803352
+  8000df:	6a 0d                	push   $0xd
+  8000e1:	68 3b 33 80 00       	push   $0x80333b
+  8000e6:	e8 71 01 00 00       	call   80025c <_panic>
+  8000eb:	83 ec 04             	sub    $0x4,%esp
+  8000ee:	68 cc 33 80 00       	push   $0x8033cc
+  8000f3:	6a 10                	push   $0x10
+  8000f5:	68 3b 33 80 00       	push   $0x80333b
+  8000fa:	e8 5d 01 00 00       	call   80025c <_panic>
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	68 82 33 80 00       	push   $0x803382
+  800107:	e8 2b 02 00 00       	call   800337 <cprintf>
+  80010c:	83 c4 08             	add    $0x8,%esp
+  80010f:	6a 00                	push   $0x0
+  800111:	57                   	push   %edi
+  800112:	e8 1b 1a 00 00       	call   801b32 <seek>
+  800117:	83 c4 08             	add    $0x8,%esp
+  80011a:	6a 00                	push   $0x0
+  80011c:	57                   	push   %edi
+  80011d:	e8 39 1a 00 00       	call   801b5b <ftruncate>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	78 61                	js     80018a <umain+0x157>
+  800129:	83 ec 0c             	sub    $0xc,%esp
+  80012c:	68 9a 33 80 00       	push   $0x80339a
+  800131:	e8 01 02 00 00       	call   800337 <cprintf>
+  800136:	83 c4 10             	add    $0x10,%esp
+  800139:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+  80013f:	83 ec 04             	sub    $0x4,%esp
+  800142:	68 ff 01 00 00       	push   $0x1ff
+  800147:	56                   	push   %esi
+  800148:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+  80014e:	e8 82 18 00 00       	call   8019d5 <read>
+  800153:	89 c3                	mov    %eax,%ebx
+  800155:	83 c4 10             	add    $0x10,%esp
+  800158:	85 c0                	test   %eax,%eax
+  80015a:	7e 40                	jle    80019c <umain+0x169>
+  80015c:	83 ec 08             	sub    $0x8,%esp
+  80015f:	53                   	push   %ebx
+  800160:	56                   	push   %esi
+  800161:	e8 40 0c 00 00       	call   800da6 <sys_cputs>
+  800166:	83 c4 0c             	add    $0xc,%esp
+  800169:	53                   	push   %ebx
+  80016a:	56                   	push   %esi
+  80016b:	57                   	push   %edi
+  80016c:	e8 3f 19 00 00       	call   801ab0 <write>
+  800171:	83 c4 10             	add    $0x10,%esp
+  800174:	39 c3                	cmp    %eax,%ebx
+  800176:	74 c7                	je     80013f <umain+0x10c>
+  800178:	50                   	push   %eax
+  800179:	68 a8 33 80 00       	push   $0x8033a8
+  80017e:	6a 1f                	push   $0x1f
+  800180:	68 3b 33 80 00       	push   $0x80333b
+  800185:	e8 d2 00 00 00       	call   80025c <_panic>
+  80018a:	50                   	push   %eax
+  80018b:	68 87 33 80 00       	push   $0x803387
+  800190:	6a 19                	push   $0x19
+  800192:	68 3b 33 80 00       	push   $0x80333b
+  800197:	e8 c0 00 00 00       	call   80025c <_panic>
+  80019c:	83 ec 0c             	sub    $0xc,%esp
+  80019f:	68 82 33 80 00       	push   $0x803382
+  8001a4:	e8 8e 01 00 00       	call   800337 <cprintf>
+  8001a9:	83 c4 10             	add    $0x10,%esp
+  8001ac:	85 db                	test   %ebx,%ebx
+  8001ae:	78 21                	js     8001d1 <umain+0x19e>
+  8001b0:	83 ec 0c             	sub    $0xc,%esp
+  8001b3:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+  8001b9:	e8 db 16 00 00       	call   801899 <close>
+  8001be:	89 3c 24             	mov    %edi,(%esp)
+  8001c1:	e8 d3 16 00 00       	call   801899 <close>
+  8001c6:	83 c4 10             	add    $0x10,%esp
+  8001c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cc:	5b                   	pop    %ebx
+  8001cd:	5e                   	pop    %esi
+  8001ce:	5f                   	pop    %edi
+  8001cf:	5d                   	pop    %ebp
+  8001d0:	c3                   	ret
+  8001d1:	53                   	push   %ebx
+  8001d2:	68 b8 33 80 00       	push   $0x8033b8
+  8001d7:	6a 24                	push   $0x24
+  8001d9:	68 3b 33 80 00       	push   $0x80333b
+  8001de:	e8 79 00 00 00       	call   80025c <_panic>
+
+008001e3 <libmain>:
+  8001e3:	55                   	push   %ebp
+  8001e4:	89 e5                	mov    %esp,%ebp
+  8001e6:	56                   	push   %esi
+  8001e7:	53                   	push   %ebx
+  8001e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8001ee:	e8 31 0c 00 00       	call   800e24 <sys_getenvid>
+  8001f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f8:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8001fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800203:	a3 10 50 80 00       	mov    %eax,0x805010
+  800208:	85 db                	test   %ebx,%ebx
+  80020a:	7e 07                	jle    800213 <libmain+0x30>
+  80020c:	8b 06                	mov    (%esi),%eax
+  80020e:	a3 00 40 80 00       	mov    %eax,0x804000
+  800213:	83 ec 08             	sub    $0x8,%esp
+  800216:	56                   	push   %esi
+  800217:	53                   	push   %ebx
+  800218:	e8 16 fe ff ff       	call   800033 <umain>
+  80021d:	e8 0a 00 00 00       	call   80022c <exit>
+  800222:	83 c4 10             	add    $0x10,%esp
+  800225:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800228:	5b                   	pop    %ebx
+  800229:	5e                   	pop    %esi
+  80022a:	5d                   	pop    %ebp
+  80022b:	c3                   	ret
+
+0080022c <exit>:
+  80022c:	55                   	push   %ebp
+  80022d:	89 e5                	mov    %esp,%ebp
+  80022f:	83 ec 08             	sub    $0x8,%esp
+  800232:	a1 10 50 80 00       	mov    0x805010,%eax
+  800237:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  80023d:	85 c0                	test   %eax,%eax
+  80023f:	75 14                	jne    800255 <exit+0x29>
+  800241:	e8 80 16 00 00       	call   8018c6 <close_all>
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	6a 00                	push   $0x0
+  80024b:	e8 93 0b 00 00       	call   800de3 <sys_env_destroy>
+  800250:	83 c4 10             	add    $0x10,%esp
+  800253:	c9                   	leave
+  800254:	c3                   	ret
+  800255:	e8 f6 12 00 00       	call   801550 <sys_lease_complete>
+  80025a:	eb e5                	jmp    800241 <exit+0x15>
+
+0080025c <_panic>:
+  80025c:	55                   	push   %ebp
+  80025d:	89 e5                	mov    %esp,%ebp
+  80025f:	56                   	push   %esi
+  800260:	53                   	push   %ebx
+  800261:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  800264:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80026a:	e8 b5 0b 00 00       	call   800e24 <sys_getenvid>
+  80026f:	83 ec 0c             	sub    $0xc,%esp
+  800272:	ff 75 0c             	push   0xc(%ebp)
+  800275:	ff 75 08             	push   0x8(%ebp)
+  800278:	56                   	push   %esi
+  800279:	50                   	push   %eax
+  80027a:	68 08 34 80 00       	push   $0x803408
+  80027f:	e8 b3 00 00 00       	call   800337 <cprintf>
+  800284:	83 c4 18             	add    $0x18,%esp
+  800287:	53                   	push   %ebx
+  800288:	ff 75 10             	push   0x10(%ebp)
+  80028b:	e8 56 00 00 00       	call   8002e6 <vcprintf>
+  800290:	c7 04 24 85 33 80 00 	movl   $0x803385,(%esp)
+  800297:	e8 9b 00 00 00       	call   800337 <cprintf>
+  80029c:	83 c4 10             	add    $0x10,%esp
+  80029f:	cc                   	int3
+  8002a0:	eb fd                	jmp    80029f <_panic+0x43>
+
+008002a2 <putch>:
+  8002a2:	55                   	push   %ebp
+  8002a3:	89 e5                	mov    %esp,%ebp
+  8002a5:	53                   	push   %ebx
+  8002a6:	83 ec 04             	sub    $0x4,%esp
+  8002a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002ac:	8b 13                	mov    (%ebx),%edx
+  8002ae:	8d 42 01             	lea    0x1(%edx),%eax
+  8002b1:	89 03                	mov    %eax,(%ebx)
+  8002b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002b6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8002ba:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002bf:	74 09                	je     8002ca <putch+0x28>
+  8002c1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  8002c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+  8002ca:	83 ec 08             	sub    $0x8,%esp
+  8002cd:	68 ff 00 00 00       	push   $0xff
+  8002d2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002d5:	50                   	push   %eax
+  8002d6:	e8 cb 0a 00 00       	call   800da6 <sys_cputs>
+  8002db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	eb db                	jmp    8002c1 <putch+0x1f>
+
+008002e6 <vcprintf>:
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  8002ef:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002f6:	00 00 00 
+  8002f9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800300:	00 00 00 
+  800303:	ff 75 0c             	push   0xc(%ebp)
+  800306:	ff 75 08             	push   0x8(%ebp)
+  800309:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80030f:	50                   	push   %eax
+  800310:	68 a2 02 80 00       	push   $0x8002a2
+  800315:	e8 1c 01 00 00       	call   800436 <vprintfmt>
+  80031a:	83 c4 08             	add    $0x8,%esp
+  80031d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800323:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800329:	50                   	push   %eax
+  80032a:	e8 77 0a 00 00       	call   800da6 <sys_cputs>
+  80032f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800335:	c9                   	leave
+  800336:	c3                   	ret
+
+00800337 <cprintf>:
+  800337:	55                   	push   %ebp
+  800338:	89 e5                	mov    %esp,%ebp
+  80033a:	83 ec 10             	sub    $0x10,%esp
+  80033d:	8d 45 0c             	lea    0xc(%ebp),%eax
+  800340:	50                   	push   %eax
+  800341:	ff 75 08             	push   0x8(%ebp)
+  800344:	e8 9d ff ff ff       	call   8002e6 <vcprintf>
+  800349:	c9                   	leave
+  80034a:	c3                   	ret
+
+0080034b <printnum>:
+  80034b:	55                   	push   %ebp
+  80034c:	89 e5                	mov    %esp,%ebp
+  80034e:	57                   	push   %edi
+  80034f:	56                   	push   %esi
+  800350:	53                   	push   %ebx
+  800351:	83 ec 1c             	sub    $0x1c,%esp
+  800354:	89 c3                	mov    %eax,%ebx
+  800356:	89 d6                	mov    %edx,%esi
+  800358:	8b 45 08             	mov    0x8(%ebp),%eax
+  80035b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80035e:	89 d1                	mov    %edx,%ecx
+  800360:	89 c2                	mov    %eax,%edx
+  800362:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800365:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800368:	8b 45 10             	mov    0x10(%ebp),%eax
+  80036b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800375:	39 c2                	cmp    %eax,%edx
+  800377:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80037a:	73 4b                	jae    8003c7 <printnum+0x7c>
+  80037c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800382:	85 ff                	test   %edi,%edi
+  800384:	7e 11                	jle    800397 <printnum+0x4c>
+  800386:	83 ec 08             	sub    $0x8,%esp
+  800389:	56                   	push   %esi
+  80038a:	ff 75 18             	push   0x18(%ebp)
+  80038d:	ff d3                	call   *%ebx
+  80038f:	83 c4 10             	add    $0x10,%esp
+  800392:	83 ef 01             	sub    $0x1,%edi
+  800395:	75 ef                	jne    800386 <printnum+0x3b>
+  800397:	83 ec 08             	sub    $0x8,%esp
+  80039a:	56                   	push   %esi
+  80039b:	83 ec 04             	sub    $0x4,%esp
+  80039e:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a1:	ff 75 e0             	push   -0x20(%ebp)
+  8003a4:	ff 75 dc             	push   -0x24(%ebp)
+  8003a7:	ff 75 d8             	push   -0x28(%ebp)
+  8003aa:	e8 50 2e 00 00       	call   8031ff <__umoddi3>
+  8003af:	83 c4 14             	add    $0x14,%esp
+  8003b2:	0f be 80 2b 34 80 00 	movsbl 0x80342b(%eax),%eax
+  8003b9:	50                   	push   %eax
+  8003ba:	ff d3                	call   *%ebx
+  8003bc:	83 c4 10             	add    $0x10,%esp
+  8003bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c2:	5b                   	pop    %ebx
+  8003c3:	5e                   	pop    %esi
+  8003c4:	5f                   	pop    %edi
+  8003c5:	5d                   	pop    %ebp
+  8003c6:	c3                   	ret
+  8003c7:	83 ec 0c             	sub    $0xc,%esp
+  8003ca:	ff 75 18             	push   0x18(%ebp)
+  8003cd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003d0:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003d3:	52                   	push   %edx
+  8003d4:	50                   	push   %eax
+  8003d5:	83 ec 08             	sub    $0x8,%esp
+  8003d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8003db:	ff 75 e0             	push   -0x20(%ebp)
+  8003de:	ff 75 dc             	push   -0x24(%ebp)
+  8003e1:	ff 75 d8             	push   -0x28(%ebp)
+  8003e4:	e8 f8 2d 00 00       	call   8031e1 <__udivdi3>
+  8003e9:	83 c4 18             	add    $0x18,%esp
+  8003ec:	52                   	push   %edx
+  8003ed:	50                   	push   %eax
+  8003ee:	89 f2                	mov    %esi,%edx
+  8003f0:	89 d8                	mov    %ebx,%eax
+  8003f2:	e8 54 ff ff ff       	call   80034b <printnum>
+  8003f7:	83 c4 20             	add    $0x20,%esp
+  8003fa:	eb 9b                	jmp    800397 <printnum+0x4c>
+
+008003fc <sprintputch>:
+  8003fc:	55                   	push   %ebp
+  8003fd:	89 e5                	mov    %esp,%ebp
+  8003ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800402:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800406:	8b 10                	mov    (%eax),%edx
+  800408:	3b 50 04             	cmp    0x4(%eax),%edx
+  80040b:	73 0a                	jae    800417 <sprintputch+0x1b>
+  80040d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800410:	89 08                	mov    %ecx,(%eax)
+  800412:	8b 45 08             	mov    0x8(%ebp),%eax
+  800415:	88 02                	mov    %al,(%edx)
+  800417:	5d                   	pop    %ebp
+  800418:	c3                   	ret
+
+00800419 <printfmt>:
+  800419:	55                   	push   %ebp
+  80041a:	89 e5                	mov    %esp,%ebp
+  80041c:	83 ec 08             	sub    $0x8,%esp
+  80041f:	8d 45 14             	lea    0x14(%ebp),%eax
+  800422:	50                   	push   %eax
+  800423:	ff 75 10             	push   0x10(%ebp)
+  800426:	ff 75 0c             	push   0xc(%ebp)
+  800429:	ff 75 08             	push   0x8(%ebp)
+  80042c:	e8 05 00 00 00       	call   800436 <vprintfmt>
+  800431:	83 c4 10             	add    $0x10,%esp
+  800434:	c9                   	leave
+  800435:	c3                   	ret
+
+00800436 <vprintfmt>:
+  800436:	55                   	push   %ebp
+  800437:	89 e5                	mov    %esp,%ebp
+  800439:	57                   	push   %edi
+  80043a:	56                   	push   %esi
+  80043b:	53                   	push   %ebx
+  80043c:	83 ec 2c             	sub    $0x2c,%esp
+  80043f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800442:	89 df                	mov    %ebx,%edi
+  800444:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800447:	8b 45 10             	mov    0x10(%ebp),%eax
+  80044a:	8d 70 01             	lea    0x1(%eax),%esi
+  80044d:	0f b6 00             	movzbl (%eax),%eax
+  800450:	83 f8 25             	cmp    $0x25,%eax
+  800453:	74 1e                	je     800473 <vprintfmt+0x3d>
+  800455:	85 c0                	test   %eax,%eax
+  800457:	0f 84 15 05 00 00    	je     800972 <vprintfmt+0x53c>
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	53                   	push   %ebx
+  800461:	50                   	push   %eax
+  800462:	ff d7                	call   *%edi
+  800464:	83 c6 01             	add    $0x1,%esi
+  800467:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80046b:	83 c4 10             	add    $0x10,%esp
+  80046e:	83 f8 25             	cmp    $0x25,%eax
+  800471:	75 e2                	jne    800455 <vprintfmt+0x1f>
+  800473:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  800477:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80047e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800485:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  80048c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800491:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800494:	8d 56 01             	lea    0x1(%esi),%edx
+  800497:	0f b6 0e             	movzbl (%esi),%ecx
+  80049a:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80049d:	3c 55                	cmp    $0x55,%al
+  80049f:	0f 87 3b 04 00 00    	ja     8008e0 <vprintfmt+0x4aa>
+  8004a5:	0f b6 c0             	movzbl %al,%eax
+  8004a8:	ff 24 85 60 35 80 00 	jmp    *0x803560(,%eax,4)
+  8004af:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004b2:	eb 93                	jmp    800447 <vprintfmt+0x11>
+  8004b4:	89 d6                	mov    %edx,%esi
+  8004b6:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004ba:	eb d8                	jmp    800494 <vprintfmt+0x5e>
+  8004bc:	89 d6                	mov    %edx,%esi
+  8004be:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004c2:	eb d0                	jmp    800494 <vprintfmt+0x5e>
+  8004c4:	0f b6 c9             	movzbl %cl,%ecx
+  8004c7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004cd:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  8004d1:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004d4:	83 f9 09             	cmp    $0x9,%ecx
+  8004d7:	77 6f                	ja     800548 <vprintfmt+0x112>
+  8004d9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  8004dc:	83 c2 01             	add    $0x1,%edx
+  8004df:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004e2:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  8004e6:	0f be 02             	movsbl (%edx),%eax
+  8004e9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004ec:	83 fe 09             	cmp    $0x9,%esi
+  8004ef:	76 eb                	jbe    8004dc <vprintfmt+0xa6>
+  8004f1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8004f4:	89 d6                	mov    %edx,%esi
+  8004f6:	eb 13                	jmp    80050b <vprintfmt+0xd5>
+  8004f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fb:	8b 00                	mov    (%eax),%eax
+  8004fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800500:	8b 45 14             	mov    0x14(%ebp),%eax
+  800503:	8d 40 04             	lea    0x4(%eax),%eax
+  800506:	89 45 14             	mov    %eax,0x14(%ebp)
+  800509:	89 d6                	mov    %edx,%esi
+  80050b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80050f:	79 83                	jns    800494 <vprintfmt+0x5e>
+  800511:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800514:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800517:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80051e:	e9 71 ff ff ff       	jmp    800494 <vprintfmt+0x5e>
+  800523:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800526:	85 c9                	test   %ecx,%ecx
+  800528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052d:	0f 49 c1             	cmovns %ecx,%eax
+  800530:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800533:	89 d6                	mov    %edx,%esi
+  800535:	e9 5a ff ff ff       	jmp    800494 <vprintfmt+0x5e>
+  80053a:	89 d6                	mov    %edx,%esi
+  80053c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  800543:	e9 4c ff ff ff       	jmp    800494 <vprintfmt+0x5e>
+  800548:	89 d6                	mov    %edx,%esi
+  80054a:	eb bf                	jmp    80050b <vprintfmt+0xd5>
+  80054c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  800550:	89 d6                	mov    %edx,%esi
+  800552:	e9 3d ff ff ff       	jmp    800494 <vprintfmt+0x5e>
+  800557:	89 55 10             	mov    %edx,0x10(%ebp)
+  80055a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055d:	8d 70 04             	lea    0x4(%eax),%esi
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	53                   	push   %ebx
+  800564:	ff 30                	push   (%eax)
+  800566:	ff d7                	call   *%edi
+  800568:	83 c4 10             	add    $0x10,%esp
+  80056b:	89 75 14             	mov    %esi,0x14(%ebp)
+  80056e:	e9 d4 fe ff ff       	jmp    800447 <vprintfmt+0x11>
+  800573:	89 55 10             	mov    %edx,0x10(%ebp)
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8d 70 04             	lea    0x4(%eax),%esi
+  80057c:	8b 10                	mov    (%eax),%edx
+  80057e:	89 d0                	mov    %edx,%eax
+  800580:	f7 d8                	neg    %eax
+  800582:	0f 48 c2             	cmovs  %edx,%eax
+  800585:	83 f8 12             	cmp    $0x12,%eax
+  800588:	7f 23                	jg     8005ad <vprintfmt+0x177>
+  80058a:	8b 14 85 c0 36 80 00 	mov    0x8036c0(,%eax,4),%edx
+  800591:	85 d2                	test   %edx,%edx
+  800593:	74 18                	je     8005ad <vprintfmt+0x177>
+  800595:	52                   	push   %edx
+  800596:	68 1b 38 80 00       	push   $0x80381b
+  80059b:	53                   	push   %ebx
+  80059c:	57                   	push   %edi
+  80059d:	e8 77 fe ff ff       	call   800419 <printfmt>
+  8005a2:	83 c4 10             	add    $0x10,%esp
+  8005a5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005a8:	e9 9a fe ff ff       	jmp    800447 <vprintfmt+0x11>
+  8005ad:	50                   	push   %eax
+  8005ae:	68 43 34 80 00       	push   $0x803443
+  8005b3:	53                   	push   %ebx
+  8005b4:	57                   	push   %edi
+  8005b5:	e8 5f fe ff ff       	call   800419 <printfmt>
+  8005ba:	83 c4 10             	add    $0x10,%esp
+  8005bd:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005c0:	e9 82 fe ff ff       	jmp    800447 <vprintfmt+0x11>
+  8005c5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cb:	83 c0 04             	add    $0x4,%eax
+  8005ce:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8b 00                	mov    (%eax),%eax
+  8005d6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005d9:	85 c0                	test   %eax,%eax
+  8005db:	0f 84 61 03 00 00    	je     800942 <vprintfmt+0x50c>
+  8005e1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005e5:	7e 06                	jle    8005ed <vprintfmt+0x1b7>
+  8005e7:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005eb:	75 29                	jne    800616 <vprintfmt+0x1e0>
+  8005ed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005f0:	8d 70 01             	lea    0x1(%eax),%esi
+  8005f3:	0f b6 00             	movzbl (%eax),%eax
+  8005f6:	0f be d0             	movsbl %al,%edx
+  8005f9:	85 d2                	test   %edx,%edx
+  8005fb:	0f 84 bb 00 00 00    	je     8006bc <vprintfmt+0x286>
+  800601:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800604:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800607:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80060a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80060d:	eb 7a                	jmp    800689 <vprintfmt+0x253>
+  80060f:	c7 45 d0 3c 34 80 00 	movl   $0x80343c,-0x30(%ebp)
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	ff 75 d4             	push   -0x2c(%ebp)
+  80061c:	ff 75 d0             	push   -0x30(%ebp)
+  80061f:	e8 e0 03 00 00       	call   800a04 <strnlen>
+  800624:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800627:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80062a:	83 c4 10             	add    $0x10,%esp
+  80062d:	85 d2                	test   %edx,%edx
+  80062f:	0f 8e d6 02 00 00    	jle    80090b <vprintfmt+0x4d5>
+  800635:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800639:	83 ec 08             	sub    $0x8,%esp
+  80063c:	53                   	push   %ebx
+  80063d:	56                   	push   %esi
+  80063e:	ff d7                	call   *%edi
+  800640:	83 c4 10             	add    $0x10,%esp
+  800643:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800647:	75 f0                	jne    800639 <vprintfmt+0x203>
+  800649:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80064c:	8d 70 01             	lea    0x1(%eax),%esi
+  80064f:	0f b6 00             	movzbl (%eax),%eax
+  800652:	0f be d0             	movsbl %al,%edx
+  800655:	85 d2                	test   %edx,%edx
+  800657:	0f 84 da 02 00 00    	je     800937 <vprintfmt+0x501>
+  80065d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800660:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800663:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800666:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800669:	eb 1e                	jmp    800689 <vprintfmt+0x253>
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	ff 75 0c             	push   0xc(%ebp)
+  800671:	52                   	push   %edx
+  800672:	ff 55 08             	call   *0x8(%ebp)
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	83 eb 01             	sub    $0x1,%ebx
+  80067b:	83 c6 01             	add    $0x1,%esi
+  80067e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800682:	0f be d0             	movsbl %al,%edx
+  800685:	85 d2                	test   %edx,%edx
+  800687:	74 2a                	je     8006b3 <vprintfmt+0x27d>
+  800689:	85 ff                	test   %edi,%edi
+  80068b:	78 05                	js     800692 <vprintfmt+0x25c>
+  80068d:	83 ef 01             	sub    $0x1,%edi
+  800690:	78 59                	js     8006eb <vprintfmt+0x2b5>
+  800692:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800696:	74 d3                	je     80066b <vprintfmt+0x235>
+  800698:	0f be c0             	movsbl %al,%eax
+  80069b:	83 e8 20             	sub    $0x20,%eax
+  80069e:	83 f8 5e             	cmp    $0x5e,%eax
+  8006a1:	76 c8                	jbe    80066b <vprintfmt+0x235>
+  8006a3:	83 ec 08             	sub    $0x8,%esp
+  8006a6:	ff 75 0c             	push   0xc(%ebp)
+  8006a9:	6a 3f                	push   $0x3f
+  8006ab:	ff 55 08             	call   *0x8(%ebp)
+  8006ae:	83 c4 10             	add    $0x10,%esp
+  8006b1:	eb c5                	jmp    800678 <vprintfmt+0x242>
+  8006b3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006bc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006bf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006c3:	7e 1b                	jle    8006e0 <vprintfmt+0x2aa>
+  8006c5:	83 ec 08             	sub    $0x8,%esp
+  8006c8:	53                   	push   %ebx
+  8006c9:	6a 20                	push   $0x20
+  8006cb:	ff d7                	call   *%edi
+  8006cd:	83 c4 10             	add    $0x10,%esp
+  8006d0:	83 ee 01             	sub    $0x1,%esi
+  8006d3:	75 f0                	jne    8006c5 <vprintfmt+0x28f>
+  8006d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006db:	e9 67 fd ff ff       	jmp    800447 <vprintfmt+0x11>
+  8006e0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e6:	e9 5c fd ff ff       	jmp    800447 <vprintfmt+0x11>
+  8006eb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006f4:	eb c6                	jmp    8006bc <vprintfmt+0x286>
+  8006f6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006f9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006fc:	83 f9 01             	cmp    $0x1,%ecx
+  8006ff:	7f 1f                	jg     800720 <vprintfmt+0x2ea>
+  800701:	85 c9                	test   %ecx,%ecx
+  800703:	74 67                	je     80076c <vprintfmt+0x336>
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 30                	mov    (%eax),%esi
+  80070a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80070d:	89 f0                	mov    %esi,%eax
+  80070f:	c1 f8 1f             	sar    $0x1f,%eax
+  800712:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8d 40 04             	lea    0x4(%eax),%eax
+  80071b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071e:	eb 17                	jmp    800737 <vprintfmt+0x301>
+  800720:	8b 45 14             	mov    0x14(%ebp),%eax
+  800723:	8b 50 04             	mov    0x4(%eax),%edx
+  800726:	8b 00                	mov    (%eax),%eax
+  800728:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80072b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8d 40 08             	lea    0x8(%eax),%eax
+  800734:	89 45 14             	mov    %eax,0x14(%ebp)
+  800737:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80073a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80073d:	be 0a 00 00 00       	mov    $0xa,%esi
+  800742:	85 c9                	test   %ecx,%ecx
+  800744:	0f 89 12 01 00 00    	jns    80085c <vprintfmt+0x426>
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	53                   	push   %ebx
+  80074e:	6a 2d                	push   $0x2d
+  800750:	ff d7                	call   *%edi
+  800752:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800755:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800758:	f7 da                	neg    %edx
+  80075a:	83 d1 00             	adc    $0x0,%ecx
+  80075d:	f7 d9                	neg    %ecx
+  80075f:	83 c4 10             	add    $0x10,%esp
+  800762:	be 0a 00 00 00       	mov    $0xa,%esi
+  800767:	e9 f0 00 00 00       	jmp    80085c <vprintfmt+0x426>
+  80076c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076f:	8b 30                	mov    (%eax),%esi
+  800771:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800774:	89 f0                	mov    %esi,%eax
+  800776:	c1 f8 1f             	sar    $0x1f,%eax
+  800779:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+  800785:	eb b0                	jmp    800737 <vprintfmt+0x301>
+  800787:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80078a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80078d:	83 f9 01             	cmp    $0x1,%ecx
+  800790:	7f 1e                	jg     8007b0 <vprintfmt+0x37a>
+  800792:	85 c9                	test   %ecx,%ecx
+  800794:	74 32                	je     8007c8 <vprintfmt+0x392>
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007ab:	e9 ac 00 00 00       	jmp    80085c <vprintfmt+0x426>
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 10                	mov    (%eax),%edx
+  8007b5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007be:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007c3:	e9 94 00 00 00       	jmp    80085c <vprintfmt+0x426>
+  8007c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cb:	8b 10                	mov    (%eax),%edx
+  8007cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007dd:	eb 7d                	jmp    80085c <vprintfmt+0x426>
+  8007df:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007e2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007e5:	83 f9 01             	cmp    $0x1,%ecx
+  8007e8:	7f 1b                	jg     800805 <vprintfmt+0x3cf>
+  8007ea:	85 c9                	test   %ecx,%ecx
+  8007ec:	74 2c                	je     80081a <vprintfmt+0x3e4>
+  8007ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f1:	8b 10                	mov    (%eax),%edx
+  8007f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fe:	be 08 00 00 00       	mov    $0x8,%esi
+  800803:	eb 57                	jmp    80085c <vprintfmt+0x426>
+  800805:	8b 45 14             	mov    0x14(%ebp),%eax
+  800808:	8b 10                	mov    (%eax),%edx
+  80080a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080d:	8d 40 08             	lea    0x8(%eax),%eax
+  800810:	89 45 14             	mov    %eax,0x14(%ebp)
+  800813:	be 08 00 00 00       	mov    $0x8,%esi
+  800818:	eb 42                	jmp    80085c <vprintfmt+0x426>
+  80081a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081d:	8b 10                	mov    (%eax),%edx
+  80081f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800824:	8d 40 04             	lea    0x4(%eax),%eax
+  800827:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082a:	be 08 00 00 00       	mov    $0x8,%esi
+  80082f:	eb 2b                	jmp    80085c <vprintfmt+0x426>
+  800831:	89 55 10             	mov    %edx,0x10(%ebp)
+  800834:	83 ec 08             	sub    $0x8,%esp
+  800837:	53                   	push   %ebx
+  800838:	6a 30                	push   $0x30
+  80083a:	ff d7                	call   *%edi
+  80083c:	83 c4 08             	add    $0x8,%esp
+  80083f:	53                   	push   %ebx
+  800840:	6a 78                	push   $0x78
+  800842:	ff d7                	call   *%edi
+  800844:	8b 45 14             	mov    0x14(%ebp),%eax
+  800847:	8b 10                	mov    (%eax),%edx
+  800849:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084e:	83 c4 10             	add    $0x10,%esp
+  800851:	8d 40 04             	lea    0x4(%eax),%eax
+  800854:	89 45 14             	mov    %eax,0x14(%ebp)
+  800857:	be 10 00 00 00       	mov    $0x10,%esi
+  80085c:	83 ec 0c             	sub    $0xc,%esp
+  80085f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800863:	50                   	push   %eax
+  800864:	ff 75 e4             	push   -0x1c(%ebp)
+  800867:	56                   	push   %esi
+  800868:	51                   	push   %ecx
+  800869:	52                   	push   %edx
+  80086a:	89 da                	mov    %ebx,%edx
+  80086c:	89 f8                	mov    %edi,%eax
+  80086e:	e8 d8 fa ff ff       	call   80034b <printnum>
+  800873:	83 c4 20             	add    $0x20,%esp
+  800876:	e9 cc fb ff ff       	jmp    800447 <vprintfmt+0x11>
+  80087b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80087e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800881:	83 f9 01             	cmp    $0x1,%ecx
+  800884:	7f 1b                	jg     8008a1 <vprintfmt+0x46b>
+  800886:	85 c9                	test   %ecx,%ecx
+  800888:	74 2c                	je     8008b6 <vprintfmt+0x480>
+  80088a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088d:	8b 10                	mov    (%eax),%edx
+  80088f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800894:	8d 40 04             	lea    0x4(%eax),%eax
+  800897:	89 45 14             	mov    %eax,0x14(%ebp)
+  80089a:	be 10 00 00 00       	mov    $0x10,%esi
+  80089f:	eb bb                	jmp    80085c <vprintfmt+0x426>
+  8008a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a4:	8b 10                	mov    (%eax),%edx
+  8008a6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008af:	be 10 00 00 00       	mov    $0x10,%esi
+  8008b4:	eb a6                	jmp    80085c <vprintfmt+0x426>
+  8008b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b9:	8b 10                	mov    (%eax),%edx
+  8008bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c6:	be 10 00 00 00       	mov    $0x10,%esi
+  8008cb:	eb 8f                	jmp    80085c <vprintfmt+0x426>
+  8008cd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008d0:	83 ec 08             	sub    $0x8,%esp
+  8008d3:	53                   	push   %ebx
+  8008d4:	6a 25                	push   $0x25
+  8008d6:	ff d7                	call   *%edi
+  8008d8:	83 c4 10             	add    $0x10,%esp
+  8008db:	e9 67 fb ff ff       	jmp    800447 <vprintfmt+0x11>
+  8008e0:	83 ec 08             	sub    $0x8,%esp
+  8008e3:	53                   	push   %ebx
+  8008e4:	6a 25                	push   $0x25
+  8008e6:	ff d7                	call   *%edi
+  8008e8:	83 c4 10             	add    $0x10,%esp
+  8008eb:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008ef:	0f 84 ba fb ff ff    	je     8004af <vprintfmt+0x79>
+  8008f5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008f8:	89 f0                	mov    %esi,%eax
+  8008fa:	83 e8 01             	sub    $0x1,%eax
+  8008fd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800901:	75 f7                	jne    8008fa <vprintfmt+0x4c4>
+  800903:	89 45 10             	mov    %eax,0x10(%ebp)
+  800906:	e9 3c fb ff ff       	jmp    800447 <vprintfmt+0x11>
+  80090b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80090e:	8d 70 01             	lea    0x1(%eax),%esi
+  800911:	0f b6 00             	movzbl (%eax),%eax
+  800914:	0f be d0             	movsbl %al,%edx
+  800917:	85 d2                	test   %edx,%edx
+  800919:	74 11                	je     80092c <vprintfmt+0x4f6>
+  80091b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80091e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800921:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800924:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800927:	e9 5d fd ff ff       	jmp    800689 <vprintfmt+0x253>
+  80092c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80092f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800932:	e9 10 fb ff ff       	jmp    800447 <vprintfmt+0x11>
+  800937:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80093a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80093d:	e9 05 fb ff ff       	jmp    800447 <vprintfmt+0x11>
+  800942:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800946:	7e 0a                	jle    800952 <vprintfmt+0x51c>
+  800948:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80094c:	0f 85 bd fc ff ff    	jne    80060f <vprintfmt+0x1d9>
+  800952:	ba 28 00 00 00       	mov    $0x28,%edx
+  800957:	b8 28 00 00 00       	mov    $0x28,%eax
+  80095c:	be 3d 34 80 00       	mov    $0x80343d,%esi
+  800961:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800964:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800967:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80096a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80096d:	e9 17 fd ff ff       	jmp    800689 <vprintfmt+0x253>
+  800972:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800975:	5b                   	pop    %ebx
+  800976:	5e                   	pop    %esi
+  800977:	5f                   	pop    %edi
+  800978:	5d                   	pop    %ebp
+  800979:	c3                   	ret
+
+0080097a <vsnprintf>:
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	83 ec 18             	sub    $0x18,%esp
+  800980:	8b 45 08             	mov    0x8(%ebp),%eax
+  800983:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800986:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800989:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80098d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800990:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800997:	85 c0                	test   %eax,%eax
+  800999:	74 26                	je     8009c1 <vsnprintf+0x47>
+  80099b:	85 d2                	test   %edx,%edx
+  80099d:	7e 22                	jle    8009c1 <vsnprintf+0x47>
+  80099f:	ff 75 14             	push   0x14(%ebp)
+  8009a2:	ff 75 10             	push   0x10(%ebp)
+  8009a5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009a8:	50                   	push   %eax
+  8009a9:	68 fc 03 80 00       	push   $0x8003fc
+  8009ae:	e8 83 fa ff ff       	call   800436 <vprintfmt>
+  8009b3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009b6:	c6 00 00             	movb   $0x0,(%eax)
+  8009b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009bc:	83 c4 10             	add    $0x10,%esp
+  8009bf:	c9                   	leave
+  8009c0:	c3                   	ret
+  8009c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009c6:	eb f7                	jmp    8009bf <vsnprintf+0x45>
+
+008009c8 <snprintf>:
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	83 ec 08             	sub    $0x8,%esp
+  8009ce:	8d 45 14             	lea    0x14(%ebp),%eax
+  8009d1:	50                   	push   %eax
+  8009d2:	ff 75 10             	push   0x10(%ebp)
+  8009d5:	ff 75 0c             	push   0xc(%ebp)
+  8009d8:	ff 75 08             	push   0x8(%ebp)
+  8009db:	e8 9a ff ff ff       	call   80097a <vsnprintf>
+  8009e0:	c9                   	leave
+  8009e1:	c3                   	ret
+
+008009e2 <strlen>:
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e8:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009eb:	74 10                	je     8009fd <strlen+0x1b>
+  8009ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f2:	83 c0 01             	add    $0x1,%eax
+  8009f5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009f9:	75 f7                	jne    8009f2 <strlen+0x10>
+  8009fb:	5d                   	pop    %ebp
+  8009fc:	c3                   	ret
+  8009fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a02:	eb f7                	jmp    8009fb <strlen+0x19>
+
+00800a04 <strnlen>:
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a0d:	85 d2                	test   %edx,%edx
+  800a0f:	74 16                	je     800a27 <strnlen+0x23>
+  800a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a16:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a1a:	74 09                	je     800a25 <strnlen+0x21>
+  800a1c:	83 c0 01             	add    $0x1,%eax
+  800a1f:	39 d0                	cmp    %edx,%eax
+  800a21:	75 f3                	jne    800a16 <strnlen+0x12>
+  800a23:	89 d0                	mov    %edx,%eax
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+  800a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2c:	eb f7                	jmp    800a25 <strnlen+0x21>
+
+00800a2e <strcpy>:
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	53                   	push   %ebx
+  800a32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a41:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a44:	83 c0 01             	add    $0x1,%eax
+  800a47:	84 d2                	test   %dl,%dl
+  800a49:	75 f2                	jne    800a3d <strcpy+0xf>
+  800a4b:	89 c8                	mov    %ecx,%eax
+  800a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a50:	c9                   	leave
+  800a51:	c3                   	ret
+
+00800a52 <strcat>:
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	53                   	push   %ebx
+  800a56:	83 ec 10             	sub    $0x10,%esp
+  800a59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a5c:	53                   	push   %ebx
+  800a5d:	e8 80 ff ff ff       	call   8009e2 <strlen>
+  800a62:	83 c4 08             	add    $0x8,%esp
+  800a65:	ff 75 0c             	push   0xc(%ebp)
+  800a68:	01 d8                	add    %ebx,%eax
+  800a6a:	50                   	push   %eax
+  800a6b:	e8 be ff ff ff       	call   800a2e <strcpy>
+  800a70:	89 d8                	mov    %ebx,%eax
+  800a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a75:	c9                   	leave
+  800a76:	c3                   	ret
+
+00800a77 <strncpy>:
+  800a77:	55                   	push   %ebp
+  800a78:	89 e5                	mov    %esp,%ebp
+  800a7a:	56                   	push   %esi
+  800a7b:	53                   	push   %ebx
+  800a7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a85:	85 db                	test   %ebx,%ebx
+  800a87:	74 17                	je     800aa0 <strncpy+0x29>
+  800a89:	01 f3                	add    %esi,%ebx
+  800a8b:	89 f0                	mov    %esi,%eax
+  800a8d:	83 c0 01             	add    $0x1,%eax
+  800a90:	0f b6 0a             	movzbl (%edx),%ecx
+  800a93:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800a96:	80 f9 01             	cmp    $0x1,%cl
+  800a99:	83 da ff             	sbb    $0xffffffff,%edx
+  800a9c:	39 c3                	cmp    %eax,%ebx
+  800a9e:	75 ed                	jne    800a8d <strncpy+0x16>
+  800aa0:	89 f0                	mov    %esi,%eax
+  800aa2:	5b                   	pop    %ebx
+  800aa3:	5e                   	pop    %esi
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+
+00800aa6 <strlcpy>:
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	56                   	push   %esi
+  800aaa:	53                   	push   %ebx
+  800aab:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ab4:	89 f0                	mov    %esi,%eax
+  800ab6:	85 db                	test   %ebx,%ebx
+  800ab8:	74 1e                	je     800ad8 <strlcpy+0x32>
+  800aba:	83 eb 01             	sub    $0x1,%ebx
+  800abd:	74 16                	je     800ad5 <strlcpy+0x2f>
+  800abf:	01 f3                	add    %esi,%ebx
+  800ac1:	0f b6 0a             	movzbl (%edx),%ecx
+  800ac4:	84 c9                	test   %cl,%cl
+  800ac6:	74 0d                	je     800ad5 <strlcpy+0x2f>
+  800ac8:	83 c2 01             	add    $0x1,%edx
+  800acb:	83 c0 01             	add    $0x1,%eax
+  800ace:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800ad1:	39 d8                	cmp    %ebx,%eax
+  800ad3:	75 ec                	jne    800ac1 <strlcpy+0x1b>
+  800ad5:	c6 00 00             	movb   $0x0,(%eax)
+  800ad8:	29 f0                	sub    %esi,%eax
+  800ada:	5b                   	pop    %ebx
+  800adb:	5e                   	pop    %esi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strcmp>:
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae7:	0f b6 01             	movzbl (%ecx),%eax
+  800aea:	84 c0                	test   %al,%al
+  800aec:	74 11                	je     800aff <strcmp+0x21>
+  800aee:	38 02                	cmp    %al,(%edx)
+  800af0:	75 0d                	jne    800aff <strcmp+0x21>
+  800af2:	83 c1 01             	add    $0x1,%ecx
+  800af5:	83 c2 01             	add    $0x1,%edx
+  800af8:	0f b6 01             	movzbl (%ecx),%eax
+  800afb:	84 c0                	test   %al,%al
+  800afd:	75 ef                	jne    800aee <strcmp+0x10>
+  800aff:	0f b6 c0             	movzbl %al,%eax
+  800b02:	0f b6 12             	movzbl (%edx),%edx
+  800b05:	29 d0                	sub    %edx,%eax
+  800b07:	5d                   	pop    %ebp
+  800b08:	c3                   	ret
+
+00800b09 <strncmp>:
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	53                   	push   %ebx
+  800b0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b13:	8b 55 10             	mov    0x10(%ebp),%edx
+  800b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1b:	85 d2                	test   %edx,%edx
+  800b1d:	74 2e                	je     800b4d <strncmp+0x44>
+  800b1f:	0f b6 01             	movzbl (%ecx),%eax
+  800b22:	84 c0                	test   %al,%al
+  800b24:	74 16                	je     800b3c <strncmp+0x33>
+  800b26:	3a 03                	cmp    (%ebx),%al
+  800b28:	75 12                	jne    800b3c <strncmp+0x33>
+  800b2a:	83 c1 01             	add    $0x1,%ecx
+  800b2d:	83 c3 01             	add    $0x1,%ebx
+  800b30:	83 ea 01             	sub    $0x1,%edx
+  800b33:	75 ea                	jne    800b1f <strncmp+0x16>
+  800b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3a:	eb 11                	jmp    800b4d <strncmp+0x44>
+  800b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b41:	85 d2                	test   %edx,%edx
+  800b43:	74 08                	je     800b4d <strncmp+0x44>
+  800b45:	0f b6 01             	movzbl (%ecx),%eax
+  800b48:	0f b6 13             	movzbl (%ebx),%edx
+  800b4b:	29 d0                	sub    %edx,%eax
+  800b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b50:	c9                   	leave
+  800b51:	c3                   	ret
+
+00800b52 <strchr>:
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b58:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  800b5c:	0f b6 10             	movzbl (%eax),%edx
+  800b5f:	84 d2                	test   %dl,%dl
+  800b61:	74 15                	je     800b78 <strchr+0x26>
+  800b63:	38 d1                	cmp    %dl,%cl
+  800b65:	74 0f                	je     800b76 <strchr+0x24>
+  800b67:	83 c0 01             	add    $0x1,%eax
+  800b6a:	0f b6 10             	movzbl (%eax),%edx
+  800b6d:	84 d2                	test   %dl,%dl
+  800b6f:	75 f2                	jne    800b63 <strchr+0x11>
+  800b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+  800b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7d:	eb f7                	jmp    800b76 <strchr+0x24>
+
+00800b7f <strfind>:
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	53                   	push   %ebx
+  800b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b89:	0f b6 18             	movzbl (%eax),%ebx
+  800b8c:	38 d3                	cmp    %dl,%bl
+  800b8e:	74 14                	je     800ba4 <strfind+0x25>
+  800b90:	89 d1                	mov    %edx,%ecx
+  800b92:	84 db                	test   %bl,%bl
+  800b94:	74 0e                	je     800ba4 <strfind+0x25>
+  800b96:	83 c0 01             	add    $0x1,%eax
+  800b99:	0f b6 10             	movzbl (%eax),%edx
+  800b9c:	38 ca                	cmp    %cl,%dl
+  800b9e:	74 04                	je     800ba4 <strfind+0x25>
+  800ba0:	84 d2                	test   %dl,%dl
+  800ba2:	75 f2                	jne    800b96 <strfind+0x17>
+  800ba4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba7:	c9                   	leave
+  800ba8:	c3                   	ret
+
+00800ba9 <memset>:
+  800ba9:	55                   	push   %ebp
+  800baa:	89 e5                	mov    %esp,%ebp
+  800bac:	57                   	push   %edi
+  800bad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bb0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800bb3:	85 c9                	test   %ecx,%ecx
+  800bb5:	74 20                	je     800bd7 <memset+0x2e>
+  800bb7:	89 f8                	mov    %edi,%eax
+  800bb9:	09 c8                	or     %ecx,%eax
+  800bbb:	a8 03                	test   $0x3,%al
+  800bbd:	75 12                	jne    800bd1 <memset+0x28>
+  800bbf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bc3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800bc9:	c1 e9 02             	shr    $0x2,%ecx
+  800bcc:	fc                   	cld
+  800bcd:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bcf:	eb 06                	jmp    800bd7 <memset+0x2e>
+  800bd1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bd4:	fc                   	cld
+  800bd5:	f3 aa                	rep stos %al,%es:(%edi)
+  800bd7:	89 f8                	mov    %edi,%eax
+  800bd9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bdc:	c9                   	leave
+  800bdd:	c3                   	ret
+
+00800bde <memmove>:
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	57                   	push   %edi
+  800be2:	56                   	push   %esi
+  800be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800be9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800bec:	39 c6                	cmp    %eax,%esi
+  800bee:	73 32                	jae    800c22 <memmove+0x44>
+  800bf0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bf3:	39 d0                	cmp    %edx,%eax
+  800bf5:	73 2b                	jae    800c22 <memmove+0x44>
+  800bf7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800bfa:	89 d6                	mov    %edx,%esi
+  800bfc:	09 fe                	or     %edi,%esi
+  800bfe:	09 ce                	or     %ecx,%esi
+  800c00:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c06:	75 0e                	jne    800c16 <memmove+0x38>
+  800c08:	83 ef 04             	sub    $0x4,%edi
+  800c0b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c0e:	c1 e9 02             	shr    $0x2,%ecx
+  800c11:	fd                   	std
+  800c12:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c14:	eb 09                	jmp    800c1f <memmove+0x41>
+  800c16:	83 ef 01             	sub    $0x1,%edi
+  800c19:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800c1c:	fd                   	std
+  800c1d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c1f:	fc                   	cld
+  800c20:	eb 1a                	jmp    800c3c <memmove+0x5e>
+  800c22:	89 f2                	mov    %esi,%edx
+  800c24:	09 c2                	or     %eax,%edx
+  800c26:	09 ca                	or     %ecx,%edx
+  800c28:	f6 c2 03             	test   $0x3,%dl
+  800c2b:	75 0a                	jne    800c37 <memmove+0x59>
+  800c2d:	c1 e9 02             	shr    $0x2,%ecx
+  800c30:	89 c7                	mov    %eax,%edi
+  800c32:	fc                   	cld
+  800c33:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c35:	eb 05                	jmp    800c3c <memmove+0x5e>
+  800c37:	89 c7                	mov    %eax,%edi
+  800c39:	fc                   	cld
+  800c3a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800c3c:	5e                   	pop    %esi
+  800c3d:	5f                   	pop    %edi
+  800c3e:	5d                   	pop    %ebp
+  800c3f:	c3                   	ret
+
+00800c40 <memcpy>:
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	83 ec 0c             	sub    $0xc,%esp
+  800c46:	ff 75 10             	push   0x10(%ebp)
+  800c49:	ff 75 0c             	push   0xc(%ebp)
+  800c4c:	ff 75 08             	push   0x8(%ebp)
+  800c4f:	e8 8a ff ff ff       	call   800bde <memmove>
+  800c54:	c9                   	leave
+  800c55:	c3                   	ret
+
+00800c56 <memcmp>:
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	56                   	push   %esi
+  800c5a:	53                   	push   %ebx
+  800c5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c61:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c64:	85 f6                	test   %esi,%esi
+  800c66:	74 29                	je     800c91 <memcmp+0x3b>
+  800c68:	01 c6                	add    %eax,%esi
+  800c6a:	0f b6 08             	movzbl (%eax),%ecx
+  800c6d:	0f b6 1a             	movzbl (%edx),%ebx
+  800c70:	38 d9                	cmp    %bl,%cl
+  800c72:	75 11                	jne    800c85 <memcmp+0x2f>
+  800c74:	83 c0 01             	add    $0x1,%eax
+  800c77:	83 c2 01             	add    $0x1,%edx
+  800c7a:	39 c6                	cmp    %eax,%esi
+  800c7c:	75 ec                	jne    800c6a <memcmp+0x14>
+  800c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c83:	eb 08                	jmp    800c8d <memcmp+0x37>
+  800c85:	0f b6 c1             	movzbl %cl,%eax
+  800c88:	0f b6 db             	movzbl %bl,%ebx
+  800c8b:	29 d8                	sub    %ebx,%eax
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+  800c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c96:	eb f5                	jmp    800c8d <memcmp+0x37>
+
+00800c98 <memfind>:
+  800c98:	55                   	push   %ebp
+  800c99:	89 e5                	mov    %esp,%ebp
+  800c9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca1:	89 c2                	mov    %eax,%edx
+  800ca3:	03 55 10             	add    0x10(%ebp),%edx
+  800ca6:	39 d0                	cmp    %edx,%eax
+  800ca8:	73 0d                	jae    800cb7 <memfind+0x1f>
+  800caa:	38 08                	cmp    %cl,(%eax)
+  800cac:	74 0d                	je     800cbb <memfind+0x23>
+  800cae:	83 c0 01             	add    $0x1,%eax
+  800cb1:	39 c2                	cmp    %eax,%edx
+  800cb3:	75 f5                	jne    800caa <memfind+0x12>
+  800cb5:	eb 06                	jmp    800cbd <memfind+0x25>
+  800cb7:	89 c2                	mov    %eax,%edx
+  800cb9:	eb 02                	jmp    800cbd <memfind+0x25>
+  800cbb:	89 c2                	mov    %eax,%edx
+  800cbd:	89 d0                	mov    %edx,%eax
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	c3                   	ret
+
+00800cc1 <strtol>:
+  800cc1:	55                   	push   %ebp
+  800cc2:	89 e5                	mov    %esp,%ebp
+  800cc4:	57                   	push   %edi
+  800cc5:	56                   	push   %esi
+  800cc6:	53                   	push   %ebx
+  800cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ccd:	0f b6 02             	movzbl (%edx),%eax
+  800cd0:	3c 20                	cmp    $0x20,%al
+  800cd2:	74 04                	je     800cd8 <strtol+0x17>
+  800cd4:	3c 09                	cmp    $0x9,%al
+  800cd6:	75 0e                	jne    800ce6 <strtol+0x25>
+  800cd8:	83 c2 01             	add    $0x1,%edx
+  800cdb:	0f b6 02             	movzbl (%edx),%eax
+  800cde:	3c 20                	cmp    $0x20,%al
+  800ce0:	74 f6                	je     800cd8 <strtol+0x17>
+  800ce2:	3c 09                	cmp    $0x9,%al
+  800ce4:	74 f2                	je     800cd8 <strtol+0x17>
+  800ce6:	3c 2b                	cmp    $0x2b,%al
+  800ce8:	74 2a                	je     800d14 <strtol+0x53>
+  800cea:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cef:	3c 2d                	cmp    $0x2d,%al
+  800cf1:	74 2b                	je     800d1e <strtol+0x5d>
+  800cf3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cf9:	75 0f                	jne    800d0a <strtol+0x49>
+  800cfb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cfe:	74 28                	je     800d28 <strtol+0x67>
+  800d00:	85 db                	test   %ebx,%ebx
+  800d02:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d07:	0f 44 d8             	cmove  %eax,%ebx
+  800d0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d12:	eb 46                	jmp    800d5a <strtol+0x99>
+  800d14:	83 c2 01             	add    $0x1,%edx
+  800d17:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1c:	eb d5                	jmp    800cf3 <strtol+0x32>
+  800d1e:	83 c2 01             	add    $0x1,%edx
+  800d21:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d26:	eb cb                	jmp    800cf3 <strtol+0x32>
+  800d28:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d2c:	74 0e                	je     800d3c <strtol+0x7b>
+  800d2e:	85 db                	test   %ebx,%ebx
+  800d30:	75 d8                	jne    800d0a <strtol+0x49>
+  800d32:	83 c2 01             	add    $0x1,%edx
+  800d35:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d3a:	eb ce                	jmp    800d0a <strtol+0x49>
+  800d3c:	83 c2 02             	add    $0x2,%edx
+  800d3f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d44:	eb c4                	jmp    800d0a <strtol+0x49>
+  800d46:	0f be c0             	movsbl %al,%eax
+  800d49:	83 e8 30             	sub    $0x30,%eax
+  800d4c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d4f:	7d 3a                	jge    800d8b <strtol+0xca>
+  800d51:	83 c2 01             	add    $0x1,%edx
+  800d54:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d58:	01 c1                	add    %eax,%ecx
+  800d5a:	0f b6 02             	movzbl (%edx),%eax
+  800d5d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d60:	89 f3                	mov    %esi,%ebx
+  800d62:	80 fb 09             	cmp    $0x9,%bl
+  800d65:	76 df                	jbe    800d46 <strtol+0x85>
+  800d67:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d6a:	89 f3                	mov    %esi,%ebx
+  800d6c:	80 fb 19             	cmp    $0x19,%bl
+  800d6f:	77 08                	ja     800d79 <strtol+0xb8>
+  800d71:	0f be c0             	movsbl %al,%eax
+  800d74:	83 e8 57             	sub    $0x57,%eax
+  800d77:	eb d3                	jmp    800d4c <strtol+0x8b>
+  800d79:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d7c:	89 f3                	mov    %esi,%ebx
+  800d7e:	80 fb 19             	cmp    $0x19,%bl
+  800d81:	77 08                	ja     800d8b <strtol+0xca>
+  800d83:	0f be c0             	movsbl %al,%eax
+  800d86:	83 e8 37             	sub    $0x37,%eax
+  800d89:	eb c1                	jmp    800d4c <strtol+0x8b>
+  800d8b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d8f:	74 05                	je     800d96 <strtol+0xd5>
+  800d91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d94:	89 10                	mov    %edx,(%eax)
+  800d96:	89 c8                	mov    %ecx,%eax
+  800d98:	f7 d8                	neg    %eax
+  800d9a:	85 ff                	test   %edi,%edi
+  800d9c:	0f 45 c8             	cmovne %eax,%ecx
+  800d9f:	89 c8                	mov    %ecx,%eax
+  800da1:	5b                   	pop    %ebx
+  800da2:	5e                   	pop    %esi
+  800da3:	5f                   	pop    %edi
+  800da4:	5d                   	pop    %ebp
+  800da5:	c3                   	ret
+
+00800da6 <sys_cputs>:
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	89 c3                	mov    %eax,%ebx
+  800db9:	89 c7                	mov    %eax,%edi
+  800dbb:	89 c6                	mov    %eax,%esi
+  800dbd:	cd 30                	int    $0x30
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_cgetc>:
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd4:	89 d1                	mov    %edx,%ecx
+  800dd6:	89 d3                	mov    %edx,%ebx
+  800dd8:	89 d7                	mov    %edx,%edi
+  800dda:	89 d6                	mov    %edx,%esi
+  800ddc:	cd 30                	int    $0x30
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+
+00800de3 <sys_env_destroy>:
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  800dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df9:	89 cb                	mov    %ecx,%ebx
+  800dfb:	89 cf                	mov    %ecx,%edi
+  800dfd:	89 ce                	mov    %ecx,%esi
+  800dff:	cd 30                	int    $0x30
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	7f 08                	jg     800e0d <sys_env_destroy+0x2a>
+  800e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+  800e10:	50                   	push   %eax
+  800e11:	6a 03                	push   $0x3
+  800e13:	68 2b 37 80 00       	push   $0x80372b
+  800e18:	6a 24                	push   $0x24
+  800e1a:	68 48 37 80 00       	push   $0x803748
+  800e1f:	e8 38 f4 ff ff       	call   80025c <_panic>
+
+00800e24 <sys_getenvid>:
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	57                   	push   %edi
+  800e28:	56                   	push   %esi
+  800e29:	53                   	push   %ebx
+  800e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e34:	89 d1                	mov    %edx,%ecx
+  800e36:	89 d3                	mov    %edx,%ebx
+  800e38:	89 d7                	mov    %edx,%edi
+  800e3a:	89 d6                	mov    %edx,%esi
+  800e3c:	cd 30                	int    $0x30
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5f                   	pop    %edi
+  800e41:	5d                   	pop    %ebp
+  800e42:	c3                   	ret
+
+00800e43 <sys_yield>:
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	57                   	push   %edi
+  800e47:	56                   	push   %esi
+  800e48:	53                   	push   %ebx
+  800e49:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800e50:	74 26                	je     800e78 <sys_yield+0x35>
+  800e52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e57:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e5c:	89 d1                	mov    %edx,%ecx
+  800e5e:	89 d3                	mov    %edx,%ebx
+  800e60:	89 d7                	mov    %edx,%edi
+  800e62:	6a 00                	push   $0x0
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	8d 35 6f 0e 80 00    	lea    0x800e6f,%esi
+  800e6d:	0f 34                	sysenter
+  800e6f:	5d                   	pop    %ebp
+  800e70:	83 c4 04             	add    $0x4,%esp
+  800e73:	5b                   	pop    %ebx
+  800e74:	5e                   	pop    %esi
+  800e75:	5f                   	pop    %edi
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+  800e78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e82:	89 d1                	mov    %edx,%ecx
+  800e84:	89 d3                	mov    %edx,%ebx
+  800e86:	89 d7                	mov    %edx,%edi
+  800e88:	89 d6                	mov    %edx,%esi
+  800e8a:	cd 30                	int    $0x30
+  800e8c:	eb e5                	jmp    800e73 <sys_yield+0x30>
+
+00800e8e <sys_page_alloc>:
+  800e8e:	55                   	push   %ebp
+  800e8f:	89 e5                	mov    %esp,%ebp
+  800e91:	57                   	push   %edi
+  800e92:	56                   	push   %esi
+  800e93:	53                   	push   %ebx
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ea7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eaa:	89 f7                	mov    %esi,%edi
+  800eac:	cd 30                	int    $0x30
+  800eae:	85 c0                	test   %eax,%eax
+  800eb0:	7f 08                	jg     800eba <sys_page_alloc+0x2c>
+  800eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb5:	5b                   	pop    %ebx
+  800eb6:	5e                   	pop    %esi
+  800eb7:	5f                   	pop    %edi
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+  800eba:	83 ec 0c             	sub    $0xc,%esp
+  800ebd:	50                   	push   %eax
+  800ebe:	6a 04                	push   $0x4
+  800ec0:	68 2b 37 80 00       	push   $0x80372b
+  800ec5:	6a 24                	push   $0x24
+  800ec7:	68 48 37 80 00       	push   $0x803748
+  800ecc:	e8 8b f3 ff ff       	call   80025c <_panic>
+
+00800ed1 <sys_page_map>:
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800ee1:	74 33                	je     800f16 <sys_page_map+0x45>
+  800ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef4:	ff 75 18             	push   0x18(%ebp)
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	8d 35 02 0f 80 00    	lea    0x800f02,%esi
+  800f00:	0f 34                	sysenter
+  800f02:	5d                   	pop    %ebp
+  800f03:	83 c4 04             	add    $0x4,%esp
+  800f06:	89 c2                	mov    %eax,%edx
+  800f08:	85 c0                	test   %eax,%eax
+  800f0a:	7f 3d                	jg     800f49 <sys_page_map+0x78>
+  800f0c:	89 d0                	mov    %edx,%eax
+  800f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f11:	5b                   	pop    %ebx
+  800f12:	5e                   	pop    %esi
+  800f13:	5f                   	pop    %edi
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+  800f16:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f24:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f27:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f2a:	cd 30                	int    $0x30
+  800f2c:	89 c2                	mov    %eax,%edx
+  800f2e:	85 c0                	test   %eax,%eax
+  800f30:	7e da                	jle    800f0c <sys_page_map+0x3b>
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	50                   	push   %eax
+  800f36:	6a 05                	push   $0x5
+  800f38:	68 2b 37 80 00       	push   $0x80372b
+  800f3d:	6a 24                	push   $0x24
+  800f3f:	68 48 37 80 00       	push   $0x803748
+  800f44:	e8 13 f3 ff ff       	call   80025c <_panic>
+  800f49:	83 ec 0c             	sub    $0xc,%esp
+  800f4c:	50                   	push   %eax
+  800f4d:	6a 05                	push   $0x5
+  800f4f:	68 2b 37 80 00       	push   $0x80372b
+  800f54:	6a 48                	push   $0x48
+  800f56:	68 48 37 80 00       	push   $0x803748
+  800f5b:	e8 fc f2 ff ff       	call   80025c <_panic>
+
+00800f60 <sys_page_unmap>:
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	57                   	push   %edi
+  800f64:	56                   	push   %esi
+  800f65:	53                   	push   %ebx
+  800f66:	83 ec 0c             	sub    $0xc,%esp
+  800f69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f74:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f79:	89 df                	mov    %ebx,%edi
+  800f7b:	89 de                	mov    %ebx,%esi
+  800f7d:	cd 30                	int    $0x30
+  800f7f:	85 c0                	test   %eax,%eax
+  800f81:	7f 08                	jg     800f8b <sys_page_unmap+0x2b>
+  800f83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+  800f8e:	50                   	push   %eax
+  800f8f:	6a 06                	push   $0x6
+  800f91:	68 2b 37 80 00       	push   $0x80372b
+  800f96:	6a 24                	push   $0x24
+  800f98:	68 48 37 80 00       	push   $0x803748
+  800f9d:	e8 ba f2 ff ff       	call   80025c <_panic>
+
+00800fa2 <sys_fork>:
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	57                   	push   %edi
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+  800fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fad:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800fb2:	89 d1                	mov    %edx,%ecx
+  800fb4:	89 d3                	mov    %edx,%ebx
+  800fb6:	89 d7                	mov    %edx,%edi
+  800fb8:	89 d6                	mov    %edx,%esi
+  800fba:	cd 30                	int    $0x30
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+
+00800fc1 <sys_env_set_status>:
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	57                   	push   %edi
+  800fc5:	56                   	push   %esi
+  800fc6:	53                   	push   %ebx
+  800fc7:	83 ec 0c             	sub    $0xc,%esp
+  800fca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fda:	89 df                	mov    %ebx,%edi
+  800fdc:	89 de                	mov    %ebx,%esi
+  800fde:	cd 30                	int    $0x30
+  800fe0:	85 c0                	test   %eax,%eax
+  800fe2:	7f 08                	jg     800fec <sys_env_set_status+0x2b>
+  800fe4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe7:	5b                   	pop    %ebx
+  800fe8:	5e                   	pop    %esi
+  800fe9:	5f                   	pop    %edi
+  800fea:	5d                   	pop    %ebp
+  800feb:	c3                   	ret
+  800fec:	83 ec 0c             	sub    $0xc,%esp
+  800fef:	50                   	push   %eax
+  800ff0:	6a 08                	push   $0x8
+  800ff2:	68 2b 37 80 00       	push   $0x80372b
+  800ff7:	6a 24                	push   $0x24
+  800ff9:	68 48 37 80 00       	push   $0x803748
+  800ffe:	e8 59 f2 ff ff       	call   80025c <_panic>
+
+00801003 <sys_env_set_trapframe>:
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	57                   	push   %edi
+  801007:	56                   	push   %esi
+  801008:	53                   	push   %ebx
+  801009:	83 ec 0c             	sub    $0xc,%esp
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	b8 09 00 00 00       	mov    $0x9,%eax
+  80101c:	89 df                	mov    %ebx,%edi
+  80101e:	89 de                	mov    %ebx,%esi
+  801020:	cd 30                	int    $0x30
+  801022:	85 c0                	test   %eax,%eax
+  801024:	7f 08                	jg     80102e <sys_env_set_trapframe+0x2b>
+  801026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801029:	5b                   	pop    %ebx
+  80102a:	5e                   	pop    %esi
+  80102b:	5f                   	pop    %edi
+  80102c:	5d                   	pop    %ebp
+  80102d:	c3                   	ret
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+  801031:	50                   	push   %eax
+  801032:	6a 09                	push   $0x9
+  801034:	68 2b 37 80 00       	push   $0x80372b
+  801039:	6a 24                	push   $0x24
+  80103b:	68 48 37 80 00       	push   $0x803748
+  801040:	e8 17 f2 ff ff       	call   80025c <_panic>
+
+00801045 <sys_env_set_cow>:
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	57                   	push   %edi
+  801049:	56                   	push   %esi
+  80104a:	53                   	push   %ebx
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801053:	8b 55 08             	mov    0x8(%ebp),%edx
+  801056:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801059:	b8 20 00 00 00       	mov    $0x20,%eax
+  80105e:	89 df                	mov    %ebx,%edi
+  801060:	89 de                	mov    %ebx,%esi
+  801062:	cd 30                	int    $0x30
+  801064:	85 c0                	test   %eax,%eax
+  801066:	7f 08                	jg     801070 <sys_env_set_cow+0x2b>
+  801068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+  801070:	83 ec 0c             	sub    $0xc,%esp
+  801073:	50                   	push   %eax
+  801074:	6a 20                	push   $0x20
+  801076:	68 2b 37 80 00       	push   $0x80372b
+  80107b:	6a 24                	push   $0x24
+  80107d:	68 48 37 80 00       	push   $0x803748
+  801082:	e8 d5 f1 ff ff       	call   80025c <_panic>
+
+00801087 <sys_env_service>:
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	56                   	push   %esi
+  80108c:	53                   	push   %ebx
+  80108d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801092:	8b 55 08             	mov    0x8(%ebp),%edx
+  801095:	b8 21 00 00 00       	mov    $0x21,%eax
+  80109a:	89 cb                	mov    %ecx,%ebx
+  80109c:	89 cf                	mov    %ecx,%edi
+  80109e:	89 ce                	mov    %ecx,%esi
+  8010a0:	cd 30                	int    $0x30
+  8010a2:	5b                   	pop    %ebx
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+
+008010a7 <sys_env_set_pgfault_upcall>:
+  8010a7:	55                   	push   %ebp
+  8010a8:	89 e5                	mov    %esp,%ebp
+  8010aa:	57                   	push   %edi
+  8010ab:	56                   	push   %esi
+  8010ac:	53                   	push   %ebx
+  8010ad:	83 ec 0c             	sub    $0xc,%esp
+  8010b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010c0:	89 df                	mov    %ebx,%edi
+  8010c2:	89 de                	mov    %ebx,%esi
+  8010c4:	cd 30                	int    $0x30
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	7f 08                	jg     8010d2 <sys_env_set_pgfault_upcall+0x2b>
+  8010ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5e                   	pop    %esi
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+  8010d5:	50                   	push   %eax
+  8010d6:	6a 0a                	push   $0xa
+  8010d8:	68 2b 37 80 00       	push   $0x80372b
+  8010dd:	6a 24                	push   $0x24
+  8010df:	68 48 37 80 00       	push   $0x803748
+  8010e4:	e8 73 f1 ff ff       	call   80025c <_panic>
+
+008010e9 <sys_ipc_try_send>:
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8010f6:	74 27                	je     80111f <sys_ipc_try_send+0x36>
+  8010f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fe:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801103:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801106:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801109:	6a 00                	push   $0x0
+  80110b:	55                   	push   %ebp
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	8d 35 16 11 80 00    	lea    0x801116,%esi
+  801114:	0f 34                	sysenter
+  801116:	5d                   	pop    %ebp
+  801117:	83 c4 04             	add    $0x4,%esp
+  80111a:	5b                   	pop    %ebx
+  80111b:	5e                   	pop    %esi
+  80111c:	5f                   	pop    %edi
+  80111d:	5d                   	pop    %ebp
+  80111e:	c3                   	ret
+  80111f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801124:	be 00 00 00 00       	mov    $0x0,%esi
+  801129:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801132:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801135:	cd 30                	int    $0x30
+  801137:	eb e1                	jmp    80111a <sys_ipc_try_send+0x31>
+
+00801139 <sys_ipc_recv>:
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+  801142:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801149:	74 32                	je     80117d <sys_ipc_recv+0x44>
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801153:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801158:	89 cb                	mov    %ecx,%ebx
+  80115a:	89 cf                	mov    %ecx,%edi
+  80115c:	6a 00                	push   $0x0
+  80115e:	55                   	push   %ebp
+  80115f:	89 e5                	mov    %esp,%ebp
+  801161:	8d 35 69 11 80 00    	lea    0x801169,%esi
+  801167:	0f 34                	sysenter
+  801169:	5d                   	pop    %ebp
+  80116a:	83 c4 04             	add    $0x4,%esp
+  80116d:	89 c2                	mov    %eax,%edx
+  80116f:	85 c0                	test   %eax,%eax
+  801171:	7f 3c                	jg     8011af <sys_ipc_recv+0x76>
+  801173:	89 d0                	mov    %edx,%eax
+  801175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+  80117d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801182:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	89 cb                	mov    %ecx,%ebx
+  80118c:	89 cf                	mov    %ecx,%edi
+  80118e:	89 ce                	mov    %ecx,%esi
+  801190:	cd 30                	int    $0x30
+  801192:	89 c2                	mov    %eax,%edx
+  801194:	85 c0                	test   %eax,%eax
+  801196:	7e db                	jle    801173 <sys_ipc_recv+0x3a>
+  801198:	83 ec 0c             	sub    $0xc,%esp
+  80119b:	50                   	push   %eax
+  80119c:	6a 0d                	push   $0xd
+  80119e:	68 2b 37 80 00       	push   $0x80372b
+  8011a3:	6a 24                	push   $0x24
+  8011a5:	68 48 37 80 00       	push   $0x803748
+  8011aa:	e8 ad f0 ff ff       	call   80025c <_panic>
+  8011af:	83 ec 0c             	sub    $0xc,%esp
+  8011b2:	50                   	push   %eax
+  8011b3:	6a 0d                	push   $0xd
+  8011b5:	68 2b 37 80 00       	push   $0x80372b
+  8011ba:	6a 48                	push   $0x48
+  8011bc:	68 48 37 80 00       	push   $0x803748
+  8011c1:	e8 96 f0 ff ff       	call   80025c <_panic>
+
+008011c6 <sys_ipc_send>:
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	57                   	push   %edi
+  8011ca:	56                   	push   %esi
+  8011cb:	53                   	push   %ebx
+  8011cc:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  8011d3:	74 27                	je     8011fc <sys_ipc_send+0x36>
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e6:	6a 00                	push   $0x0
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	8d 35 f3 11 80 00    	lea    0x8011f3,%esi
+  8011f1:	0f 34                	sysenter
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	83 c4 04             	add    $0x4,%esp
+  8011f7:	5b                   	pop    %ebx
+  8011f8:	5e                   	pop    %esi
+  8011f9:	5f                   	pop    %edi
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+  8011fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801201:	be 00 00 00 00       	mov    $0x0,%esi
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801212:	cd 30                	int    $0x30
+  801214:	eb e1                	jmp    8011f7 <sys_ipc_send+0x31>
+
+00801216 <sys_ipc_call>:
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+  80121c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801222:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801227:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80122a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801230:	cd 30                	int    $0x30
+  801232:	5b                   	pop    %ebx
+  801233:	5e                   	pop    %esi
+  801234:	5f                   	pop    %edi
+  801235:	5d                   	pop    %ebp
+  801236:	c3                   	ret
+
+00801237 <sys_ipc_reply_recv>:
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	57                   	push   %edi
+  80123b:	56                   	push   %esi
+  80123c:	53                   	push   %ebx
+  80123d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801243:	b8 10 00 00 00       	mov    $0x10,%eax
+  801248:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801251:	cd 30                	int    $0x30
+  801253:	5b                   	pop    %ebx
+  801254:	5e                   	pop    %esi
+  801255:	5f                   	pop    %edi
+  801256:	5d                   	pop    %ebp
+  801257:	c3                   	ret
+
+00801258 <sys_time_msec>:
+  801258:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	75 06                	jne    801267 <sys_time_msec+0xf>
+  801261:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  801266:	c3                   	ret
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	57                   	push   %edi
+  80126b:	56                   	push   %esi
+  80126c:	53                   	push   %ebx
+  80126d:	83 ec 0c             	sub    $0xc,%esp
+  801270:	0f 31                	rdtsc
+  801272:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  801278:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  80127e:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  801284:	29 c8                	sub    %ecx,%eax
+  801286:	19 da                	sbb    %ebx,%edx
+  801288:	bf 00 00 00 00       	mov    $0x0,%edi
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	52                   	push   %edx
+  801290:	50                   	push   %eax
+  801291:	e8 4b 1f 00 00       	call   8031e1 <__udivdi3>
+  801296:	83 c4 10             	add    $0x10,%esp
+  801299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129c:	5b                   	pop    %ebx
+  80129d:	5e                   	pop    %esi
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+
+008012a1 <sys_env_swap>:
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	57                   	push   %edi
+  8012a5:	56                   	push   %esi
+  8012a6:	53                   	push   %ebx
+  8012a7:	83 ec 0c             	sub    $0xc,%esp
+  8012aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012b7:	89 cb                	mov    %ecx,%ebx
+  8012b9:	89 cf                	mov    %ecx,%edi
+  8012bb:	89 ce                	mov    %ecx,%esi
+  8012bd:	cd 30                	int    $0x30
+  8012bf:	85 c0                	test   %eax,%eax
+  8012c1:	7f 08                	jg     8012cb <sys_env_swap+0x2a>
+  8012c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c6:	5b                   	pop    %ebx
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5f                   	pop    %edi
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+  8012cb:	83 ec 0c             	sub    $0xc,%esp
+  8012ce:	50                   	push   %eax
+  8012cf:	6a 12                	push   $0x12
+  8012d1:	68 2b 37 80 00       	push   $0x80372b
+  8012d6:	6a 24                	push   $0x24
+  8012d8:	68 48 37 80 00       	push   $0x803748
+  8012dd:	e8 7a ef ff ff       	call   80025c <_panic>
+
+008012e2 <sys_net_try_send>:
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  8012e5:	57                   	push   %edi
+  8012e6:	56                   	push   %esi
+  8012e7:	53                   	push   %ebx
+  8012e8:	83 ec 0c             	sub    $0xc,%esp
+  8012eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012fb:	89 df                	mov    %ebx,%edi
+  8012fd:	89 de                	mov    %ebx,%esi
+  8012ff:	cd 30                	int    $0x30
+  801301:	85 c0                	test   %eax,%eax
+  801303:	7f 08                	jg     80130d <sys_net_try_send+0x2b>
+  801305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801308:	5b                   	pop    %ebx
+  801309:	5e                   	pop    %esi
+  80130a:	5f                   	pop    %edi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+  80130d:	83 ec 0c             	sub    $0xc,%esp
+  801310:	50                   	push   %eax
+  801311:	6a 13                	push   $0x13
+  801313:	68 2b 37 80 00       	push   $0x80372b
+  801318:	6a 24                	push   $0x24
+  80131a:	68 48 37 80 00       	push   $0x803748
+  80131f:	e8 38 ef ff ff       	call   80025c <_panic>
+
+00801324 <sys_net_try_receive>:
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	57                   	push   %edi
+  801328:	56                   	push   %esi
+  801329:	53                   	push   %ebx
+  80132a:	83 ec 0c             	sub    $0xc,%esp
+  80132d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801332:	8b 55 08             	mov    0x8(%ebp),%edx
+  801335:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801338:	b8 14 00 00 00       	mov    $0x14,%eax
+  80133d:	89 df                	mov    %ebx,%edi
+  80133f:	89 de                	mov    %ebx,%esi
+  801341:	cd 30                	int    $0x30
+  801343:	85 c0                	test   %eax,%eax
+  801345:	7f 08                	jg     80134f <sys_net_try_receive+0x2b>
+  801347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134a:	5b                   	pop    %ebx
+  80134b:	5e                   	pop    %esi
+  80134c:	5f                   	pop    %edi
+  80134d:	5d                   	pop    %ebp
+  80134e:	c3                   	ret
+  80134f:	83 ec 0c             	sub    $0xc,%esp
+  801352:	50                   	push   %eax
+  801353:	6a 14                	push   $0x14
+  801355:	68 2b 37 80 00       	push   $0x80372b
+  80135a:	6a 24                	push   $0x24
+  80135c:	68 48 37 80 00       	push   $0x803748
+  801361:	e8 f6 ee ff ff       	call   80025c <_panic>
+
+00801366 <sys_net_recv_page>:
+  801366:	55                   	push   %ebp
+  801367:	89 e5                	mov    %esp,%ebp
+  801369:	57                   	push   %edi
+  80136a:	56                   	push   %esi
+  80136b:	53                   	push   %ebx
+  80136c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801371:	8b 55 08             	mov    0x8(%ebp),%edx
+  801374:	b8 27 00 00 00       	mov    $0x27,%eax
+  801379:	89 cb                	mov    %ecx,%ebx
+  80137b:	89 cf                	mov    %ecx,%edi
+  80137d:	89 ce                	mov    %ecx,%esi
+  80137f:	cd 30                	int    $0x30
+  801381:	5b                   	pop    %ebx
+  801382:	5e                   	pop    %esi
+  801383:	5f                   	pop    %edi
+  801384:	5d                   	pop    %ebp
+  801385:	c3                   	ret
+
+00801386 <sys_net_wait>:
+  801386:	55                   	push   %ebp
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	57                   	push   %edi
+  80138a:	56                   	push   %esi
+  80138b:	53                   	push   %ebx
+  80138c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801391:	b8 26 00 00 00       	mov    $0x26,%eax
+  801396:	89 d1                	mov    %edx,%ecx
+  801398:	89 d3                	mov    %edx,%ebx
+  80139a:	89 d7                	mov    %edx,%edi
+  80139c:	89 d6                	mov    %edx,%esi
+  80139e:	cd 30                	int    $0x30
+  8013a0:	5b                   	pop    %ebx
+  8013a1:	5e                   	pop    %esi
+  8013a2:	5f                   	pop    %edi
+  8013a3:	5d                   	pop    %ebp
+  8013a4:	c3                   	ret
+
+008013a5 <sys_get_mac>:
+  8013a5:	55                   	push   %ebp
+  8013a6:	89 e5                	mov    %esp,%ebp
+  8013a8:	57                   	push   %edi
+  8013a9:	56                   	push   %esi
+  8013aa:	53                   	push   %ebx
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+  8013ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013be:	89 df                	mov    %ebx,%edi
+  8013c0:	89 de                	mov    %ebx,%esi
+  8013c2:	cd 30                	int    $0x30
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	7f 08                	jg     8013d0 <sys_get_mac+0x2b>
+  8013c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cb:	5b                   	pop    %ebx
+  8013cc:	5e                   	pop    %esi
+  8013cd:	5f                   	pop    %edi
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	c3                   	ret
+  8013d0:	83 ec 0c             	sub    $0xc,%esp
+  8013d3:	50                   	push   %eax
+  8013d4:	6a 15                	push   $0x15
+  8013d6:	68 2b 37 80 00       	push   $0x80372b
+  8013db:	6a 24                	push   $0x24
+  8013dd:	68 48 37 80 00       	push   $0x803748
+  8013e2:	e8 75 ee ff ff       	call   80025c <_panic>
+
+008013e7 <sys_env_lease>:
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	57                   	push   %edi
+  8013eb:	56                   	push   %esi
+  8013ec:	53                   	push   %ebx
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fb:	b8 16 00 00 00       	mov    $0x16,%eax
+  801400:	89 df                	mov    %ebx,%edi
+  801402:	89 de                	mov    %ebx,%esi
+  801404:	cd 30                	int    $0x30
+  801406:	85 c0                	test   %eax,%eax
+  801408:	7f 08                	jg     801412 <sys_env_lease+0x2b>
+  80140a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140d:	5b                   	pop    %ebx
+  80140e:	5e                   	pop    %esi
+  80140f:	5f                   	pop    %edi
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+  801412:	83 ec 0c             	sub    $0xc,%esp
+  801415:	50                   	push   %eax
+  801416:	6a 16                	push   $0x16
+  801418:	68 2b 37 80 00       	push   $0x80372b
+  80141d:	6a 24                	push   $0x24
+  80141f:	68 48 37 80 00       	push   $0x803748
+  801424:	e8 33 ee ff ff       	call   80025c <_panic>
+
+00801429 <sys_copy_mem>:
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	57                   	push   %edi
+  80142d:	56                   	push   %esi
+  80142e:	53                   	push   %ebx
+  80142f:	83 ec 0c             	sub    $0xc,%esp
+  801432:	8b 55 08             	mov    0x8(%ebp),%edx
+  801435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801438:	b8 17 00 00 00       	mov    $0x17,%eax
+  80143d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801440:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801443:	8b 75 18             	mov    0x18(%ebp),%esi
+  801446:	cd 30                	int    $0x30
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	7f 08                	jg     801454 <sys_copy_mem+0x2b>
+  80144c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144f:	5b                   	pop    %ebx
+  801450:	5e                   	pop    %esi
+  801451:	5f                   	pop    %edi
+  801452:	5d                   	pop    %ebp
+  801453:	c3                   	ret
+  801454:	83 ec 0c             	sub    $0xc,%esp
+  801457:	50                   	push   %eax
+  801458:	6a 17                	push   $0x17
+  80145a:	68 2b 37 80 00       	push   $0x80372b
+  80145f:	6a 24                	push   $0x24
+  801461:	68 48 37 80 00       	push   $0x803748
+  801466:	e8 f1 ed ff ff       	call   80025c <_panic>
+
+0080146b <sys_get_perms>:
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+  801471:	83 ec 0c             	sub    $0xc,%esp
+  801474:	be 00 00 00 00       	mov    $0x0,%esi
+  801479:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801484:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801487:	89 f7                	mov    %esi,%edi
+  801489:	cd 30                	int    $0x30
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	7f 08                	jg     801497 <sys_get_perms+0x2c>
+  80148f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801492:	5b                   	pop    %ebx
+  801493:	5e                   	pop    %esi
+  801494:	5f                   	pop    %edi
+  801495:	5d                   	pop    %ebp
+  801496:	c3                   	ret
+  801497:	83 ec 0c             	sub    $0xc,%esp
+  80149a:	50                   	push   %eax
+  80149b:	6a 18                	push   $0x18
+  80149d:	68 2b 37 80 00       	push   $0x80372b
+  8014a2:	6a 24                	push   $0x24
+  8014a4:	68 48 37 80 00       	push   $0x803748
+  8014a9:	e8 ae ed ff ff       	call   80025c <_panic>
+
+008014ae <sys_env_unsuspend>:
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	57                   	push   %edi
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+  8014b4:	83 ec 0c             	sub    $0xc,%esp
+  8014b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ca:	89 f7                	mov    %esi,%edi
+  8014cc:	cd 30                	int    $0x30
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	7f 08                	jg     8014da <sys_env_unsuspend+0x2c>
+  8014d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d5:	5b                   	pop    %ebx
+  8014d6:	5e                   	pop    %esi
+  8014d7:	5f                   	pop    %edi
+  8014d8:	5d                   	pop    %ebp
+  8014d9:	c3                   	ret
+  8014da:	83 ec 0c             	sub    $0xc,%esp
+  8014dd:	50                   	push   %eax
+  8014de:	6a 19                	push   $0x19
+  8014e0:	68 2b 37 80 00       	push   $0x80372b
+  8014e5:	6a 24                	push   $0x24
+  8014e7:	68 48 37 80 00       	push   $0x803748
+  8014ec:	e8 6b ed ff ff       	call   80025c <_panic>
+
+008014f1 <sys_migrate>:
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	57                   	push   %edi
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	ba 00 80 80 00       	mov    $0x808000,%edx
+  8014ff:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801505:	76 11                	jbe    801518 <sys_migrate+0x27>
+  801507:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80150c:	0f b6 08             	movzbl (%eax),%ecx
+  80150f:	05 00 10 00 00       	add    $0x1000,%eax
+  801514:	39 d0                	cmp    %edx,%eax
+  801516:	72 f4                	jb     80150c <sys_migrate+0x1b>
+  801518:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801520:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801525:	89 cb                	mov    %ecx,%ebx
+  801527:	89 cf                	mov    %ecx,%edi
+  801529:	89 ce                	mov    %ecx,%esi
+  80152b:	cd 30                	int    $0x30
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	7f 08                	jg     801539 <sys_migrate+0x48>
+  801531:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801534:	5b                   	pop    %ebx
+  801535:	5e                   	pop    %esi
+  801536:	5f                   	pop    %edi
+  801537:	5d                   	pop    %ebp
+  801538:	c3                   	ret
+  801539:	83 ec 0c             	sub    $0xc,%esp
+  80153c:	50                   	push   %eax
+  80153d:	6a 1a                	push   $0x1a
+  80153f:	68 2b 37 80 00       	push   $0x80372b
+  801544:	6a 24                	push   $0x24
+  801546:	68 48 37 80 00       	push   $0x803748
+  80154b:	e8 0c ed ff ff       	call   80025c <_panic>
+
+00801550 <sys_lease_complete>:
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	57                   	push   %edi
+  801554:	56                   	push   %esi
+  801555:	53                   	push   %ebx
+  801556:	83 ec 0c             	sub    $0xc,%esp
+  801559:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801563:	89 d1                	mov    %edx,%ecx
+  801565:	89 d3                	mov    %edx,%ebx
+  801567:	89 d7                	mov    %edx,%edi
+  801569:	89 d6                	mov    %edx,%esi
+  80156b:	cd 30                	int    $0x30
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	7f 08                	jg     801579 <sys_lease_complete+0x29>
+  801571:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801574:	5b                   	pop    %ebx
+  801575:	5e                   	pop    %esi
+  801576:	5f                   	pop    %edi
+  801577:	5d                   	pop    %ebp
+  801578:	c3                   	ret
+  801579:	83 ec 0c             	sub    $0xc,%esp
+  80157c:	50                   	push   %eax
+  80157d:	6a 1b                	push   $0x1b
+  80157f:	68 2b 37 80 00       	push   $0x80372b
+  801584:	6a 24                	push   $0x24
+  801586:	68 48 37 80 00       	push   $0x803748
+  80158b:	e8 cc ec ff ff       	call   80025c <_panic>
+
+00801590 <sys_env_set_thisenv>:
+  801590:	55                   	push   %ebp
+  801591:	89 e5                	mov    %esp,%ebp
+  801593:	57                   	push   %edi
+  801594:	56                   	push   %esi
+  801595:	53                   	push   %ebx
+  801596:	83 ec 0c             	sub    $0xc,%esp
+  801599:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015a9:	89 df                	mov    %ebx,%edi
+  8015ab:	89 de                	mov    %ebx,%esi
+  8015ad:	cd 30                	int    $0x30
+  8015af:	85 c0                	test   %eax,%eax
+  8015b1:	7f 08                	jg     8015bb <sys_env_set_thisenv+0x2b>
+  8015b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b6:	5b                   	pop    %ebx
+  8015b7:	5e                   	pop    %esi
+  8015b8:	5f                   	pop    %edi
+  8015b9:	5d                   	pop    %ebp
+  8015ba:	c3                   	ret
+  8015bb:	83 ec 0c             	sub    $0xc,%esp
+  8015be:	50                   	push   %eax
+  8015bf:	6a 1c                	push   $0x1c
+  8015c1:	68 2b 37 80 00       	push   $0x80372b
+  8015c6:	6a 24                	push   $0x24
+  8015c8:	68 48 37 80 00       	push   $0x803748
+  8015cd:	e8 8a ec ff ff       	call   80025c <_panic>
+
+008015d2 <sys_env_set_sched>:
+  8015d2:	55                   	push   %ebp
+  8015d3:	89 e5                	mov    %esp,%ebp
+  8015d5:	57                   	push   %edi
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+  8015db:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ee:	89 f7                	mov    %esi,%edi
+  8015f0:	cd 30                	int    $0x30
+  8015f2:	85 c0                	test   %eax,%eax
+  8015f4:	7f 08                	jg     8015fe <sys_env_set_sched+0x2c>
+  8015f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f9:	5b                   	pop    %ebx
+  8015fa:	5e                   	pop    %esi
+  8015fb:	5f                   	pop    %edi
+  8015fc:	5d                   	pop    %ebp
+  8015fd:	c3                   	ret
+  8015fe:	83 ec 0c             	sub    $0xc,%esp
+  801601:	50                   	push   %eax
+  801602:	6a 1d                	push   $0x1d
+  801604:	68 2b 37 80 00       	push   $0x80372b
+  801609:	6a 24                	push   $0x24
+  80160b:	68 48 37 80 00       	push   $0x803748
+  801610:	e8 47 ec ff ff       	call   80025c <_panic>
+
+00801615 <sys_batch>:
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	57                   	push   %edi
+  801619:	56                   	push   %esi
+  80161a:	53                   	push   %ebx
+  80161b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801620:	8b 55 08             	mov    0x8(%ebp),%edx
+  801623:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801626:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80162b:	89 df                	mov    %ebx,%edi
+  80162d:	89 de                	mov    %ebx,%esi
+  80162f:	cd 30                	int    $0x30
+  801631:	5b                   	pop    %ebx
+  801632:	5e                   	pop    %esi
+  801633:	5f                   	pop    %edi
+  801634:	5d                   	pop    %ebp
+  801635:	c3                   	ret
+
+00801636 <sys_env_stats>:
+  801636:	55                   	push   %ebp
+  801637:	89 e5                	mov    %esp,%ebp
+  801639:	57                   	push   %edi
+  80163a:	56                   	push   %esi
+  80163b:	53                   	push   %ebx
+  80163c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801641:	8b 55 08             	mov    0x8(%ebp),%edx
+  801644:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801647:	b8 23 00 00 00       	mov    $0x23,%eax
+  80164c:	89 df                	mov    %ebx,%edi
+  80164e:	89 de                	mov    %ebx,%esi
+  801650:	cd 30                	int    $0x30
+  801652:	5b                   	pop    %ebx
+  801653:	5e                   	pop    %esi
+  801654:	5f                   	pop    %edi
+  801655:	5d                   	pop    %ebp
+  801656:	c3                   	ret
+
+00801657 <sys_trace>:
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	57                   	push   %edi
+  80165b:	56                   	push   %esi
+  80165c:	53                   	push   %ebx
+  80165d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801662:	8b 55 08             	mov    0x8(%ebp),%edx
+  801665:	b8 24 00 00 00       	mov    $0x24,%eax
+  80166a:	89 cb                	mov    %ecx,%ebx
+  80166c:	89 cf                	mov    %ecx,%edi
+  80166e:	89 ce                	mov    %ecx,%esi
+  801670:	cd 30                	int    $0x30
+  801672:	5b                   	pop    %ebx
+  801673:	5e                   	pop    %esi
+  801674:	5f                   	pop    %edi
+  801675:	5d                   	pop    %ebp
+  801676:	c3                   	ret
+
+00801677 <sys_env_set_pager>:
+  801677:	55                   	push   %ebp
+  801678:	89 e5                	mov    %esp,%ebp
+  80167a:	57                   	push   %edi
+  80167b:	56                   	push   %esi
+  80167c:	53                   	push   %ebx
+  80167d:	83 ec 0c             	sub    $0xc,%esp
+  801680:	be 00 00 00 00       	mov    $0x0,%esi
+  801685:	8b 55 08             	mov    0x8(%ebp),%edx
+  801688:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168b:	b8 25 00 00 00       	mov    $0x25,%eax
+  801690:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801693:	89 f7                	mov    %esi,%edi
+  801695:	cd 30                	int    $0x30
+  801697:	85 c0                	test   %eax,%eax
+  801699:	7f 08                	jg     8016a3 <sys_env_set_pager+0x2c>
+  80169b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169e:	5b                   	pop    %ebx
+  80169f:	5e                   	pop    %esi
+  8016a0:	5f                   	pop    %edi
+  8016a1:	5d                   	pop    %ebp
+  8016a2:	c3                   	ret
+  8016a3:	83 ec 0c             	sub    $0xc,%esp
+  8016a6:	50                   	push   %eax
+  8016a7:	6a 25                	push   $0x25
+  8016a9:	68 2b 37 80 00       	push   $0x80372b
+  8016ae:	6a 24                	push   $0x24
+  8016b0:	68 48 37 80 00       	push   $0x803748
+  8016b5:	e8 a2 eb ff ff       	call   80025c <_panic>
+
+008016ba <sys_pager_retire>:
+  8016ba:	55                   	push   %ebp
+  8016bb:	89 e5                	mov    %esp,%ebp
+  8016bd:	57                   	push   %edi
+  8016be:	56                   	push   %esi
+  8016bf:	53                   	push   %ebx
+  8016c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8016cd:	89 cb                	mov    %ecx,%ebx
+  8016cf:	89 cf                	mov    %ecx,%edi
+  8016d1:	89 ce                	mov    %ecx,%esi
+  8016d3:	cd 30                	int    $0x30
+  8016d5:	5b                   	pop    %ebx
+  8016d6:	5e                   	pop    %esi
+  8016d7:	5f                   	pop    %edi
+  8016d8:	5d                   	pop    %ebp
+  8016d9:	c3                   	ret
+
+008016da <sys_prof>:
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	57                   	push   %edi
+  8016de:	56                   	push   %esi
+  8016df:	53                   	push   %ebx
+  8016e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016eb:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f3:	89 f7                	mov    %esi,%edi
+  8016f5:	cd 30                	int    $0x30
+  8016f7:	5b                   	pop    %ebx
+  8016f8:	5e                   	pop    %esi
+  8016f9:	5f                   	pop    %edi
+  8016fa:	5d                   	pop    %ebp
+  8016fb:	c3                   	ret
+
+008016fc <fd2num>:
+  8016fc:	55                   	push   %ebp
+  8016fd:	89 e5                	mov    %esp,%ebp
+  8016ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801702:	05 00 00 00 30       	add    $0x30000000,%eax
+  801707:	c1 e8 0c             	shr    $0xc,%eax
+  80170a:	5d                   	pop    %ebp
+  80170b:	c3                   	ret
+
+0080170c <fd2data>:
+  80170c:	55                   	push   %ebp
+  80170d:	89 e5                	mov    %esp,%ebp
+  80170f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801712:	05 00 00 00 30       	add    $0x30000000,%eax
+  801717:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80171c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801721:	5d                   	pop    %ebp
+  801722:	c3                   	ret
+
+00801723 <fd_alloc>:
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80172b:	89 c2                	mov    %eax,%edx
+  80172d:	c1 ea 16             	shr    $0x16,%edx
+  801730:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801737:	f6 c2 01             	test   $0x1,%dl
+  80173a:	74 29                	je     801765 <fd_alloc+0x42>
+  80173c:	89 c2                	mov    %eax,%edx
+  80173e:	c1 ea 0c             	shr    $0xc,%edx
+  801741:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801748:	f6 c2 01             	test   $0x1,%dl
+  80174b:	74 18                	je     801765 <fd_alloc+0x42>
+  80174d:	05 00 10 00 00       	add    $0x1000,%eax
+  801752:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801757:	75 d2                	jne    80172b <fd_alloc+0x8>
+  801759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801763:	eb 05                	jmp    80176a <fd_alloc+0x47>
+  801765:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80176a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176d:	89 02                	mov    %eax,(%edx)
+  80176f:	89 c8                	mov    %ecx,%eax
+  801771:	5d                   	pop    %ebp
+  801772:	c3                   	ret
+
+00801773 <fd_lookup>:
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	8b 45 08             	mov    0x8(%ebp),%eax
+  801779:	83 f8 1f             	cmp    $0x1f,%eax
+  80177c:	77 30                	ja     8017ae <fd_lookup+0x3b>
+  80177e:	c1 e0 0c             	shl    $0xc,%eax
+  801781:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  801786:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80178c:	f6 c2 01             	test   $0x1,%dl
+  80178f:	74 24                	je     8017b5 <fd_lookup+0x42>
+  801791:	89 c2                	mov    %eax,%edx
+  801793:	c1 ea 0c             	shr    $0xc,%edx
+  801796:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80179d:	f6 c2 01             	test   $0x1,%dl
+  8017a0:	74 1a                	je     8017bc <fd_lookup+0x49>
+  8017a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017a5:	89 02                	mov    %eax,(%edx)
+  8017a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ac:	5d                   	pop    %ebp
+  8017ad:	c3                   	ret
+  8017ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b3:	eb f7                	jmp    8017ac <fd_lookup+0x39>
+  8017b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ba:	eb f0                	jmp    8017ac <fd_lookup+0x39>
+  8017bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c1:	eb e9                	jmp    8017ac <fd_lookup+0x39>
+
+008017c3 <dev_lookup>:
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	53                   	push   %ebx
+  8017c7:	83 ec 04             	sub    $0x4,%esp
+  8017ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d2:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  8017d7:	39 13                	cmp    %edx,(%ebx)
+  8017d9:	74 37                	je     801812 <dev_lookup+0x4f>
+  8017db:	83 c0 01             	add    $0x1,%eax
+  8017de:	8b 1c 85 d4 37 80 00 	mov    0x8037d4(,%eax,4),%ebx
+  8017e5:	85 db                	test   %ebx,%ebx
+  8017e7:	75 ee                	jne    8017d7 <dev_lookup+0x14>
+  8017e9:	a1 10 50 80 00       	mov    0x805010,%eax
+  8017ee:	8b 40 48             	mov    0x48(%eax),%eax
+  8017f1:	83 ec 04             	sub    $0x4,%esp
+  8017f4:	52                   	push   %edx
+  8017f5:	50                   	push   %eax
+  8017f6:	68 58 37 80 00       	push   $0x803758
+  8017fb:	e8 37 eb ff ff       	call   800337 <cprintf>
+  801800:	83 c4 10             	add    $0x10,%esp
+  801803:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801808:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80180b:	89 1a                	mov    %ebx,(%edx)
+  80180d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801810:	c9                   	leave
+  801811:	c3                   	ret
+  801812:	b8 00 00 00 00       	mov    $0x0,%eax
+  801817:	eb ef                	jmp    801808 <dev_lookup+0x45>
+
+00801819 <fd_close>:
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	57                   	push   %edi
+  80181d:	56                   	push   %esi
+  80181e:	53                   	push   %ebx
+  80181f:	83 ec 24             	sub    $0x24,%esp
+  801822:	8b 75 08             	mov    0x8(%ebp),%esi
+  801825:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801828:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80182b:	50                   	push   %eax
+  80182c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801832:	c1 e8 0c             	shr    $0xc,%eax
+  801835:	50                   	push   %eax
+  801836:	e8 38 ff ff ff       	call   801773 <fd_lookup>
+  80183b:	89 c3                	mov    %eax,%ebx
+  80183d:	83 c4 10             	add    $0x10,%esp
+  801840:	85 c0                	test   %eax,%eax
+  801842:	78 05                	js     801849 <fd_close+0x30>
+  801844:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801847:	74 0f                	je     801858 <fd_close+0x3f>
+  801849:	85 ff                	test   %edi,%edi
+  80184b:	0f 44 df             	cmove  %edi,%ebx
+  80184e:	89 d8                	mov    %ebx,%eax
+  801850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801853:	5b                   	pop    %ebx
+  801854:	5e                   	pop    %esi
+  801855:	5f                   	pop    %edi
+  801856:	5d                   	pop    %ebp
+  801857:	c3                   	ret
+  801858:	83 ec 08             	sub    $0x8,%esp
+  80185b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80185e:	50                   	push   %eax
+  80185f:	ff 36                	push   (%esi)
+  801861:	e8 5d ff ff ff       	call   8017c3 <dev_lookup>
+  801866:	89 c3                	mov    %eax,%ebx
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	85 c0                	test   %eax,%eax
+  80186d:	78 1a                	js     801889 <fd_close+0x70>
+  80186f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801872:	8b 40 10             	mov    0x10(%eax),%eax
+  801875:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	74 0b                	je     801889 <fd_close+0x70>
+  80187e:	83 ec 0c             	sub    $0xc,%esp
+  801881:	56                   	push   %esi
+  801882:	ff d0                	call   *%eax
+  801884:	89 c3                	mov    %eax,%ebx
+  801886:	83 c4 10             	add    $0x10,%esp
+  801889:	83 ec 08             	sub    $0x8,%esp
+  80188c:	56                   	push   %esi
+  80188d:	6a 00                	push   $0x0
+  80188f:	e8 cc f6 ff ff       	call   800f60 <sys_page_unmap>
+  801894:	83 c4 10             	add    $0x10,%esp
+  801897:	eb b5                	jmp    80184e <fd_close+0x35>
+
+00801899 <close>:
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+  80189c:	83 ec 20             	sub    $0x20,%esp
+  80189f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a2:	50                   	push   %eax
+  8018a3:	ff 75 08             	push   0x8(%ebp)
+  8018a6:	e8 c8 fe ff ff       	call   801773 <fd_lookup>
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	79 02                	jns    8018b4 <close+0x1b>
+  8018b2:	c9                   	leave
+  8018b3:	c3                   	ret
+  8018b4:	83 ec 08             	sub    $0x8,%esp
+  8018b7:	6a 01                	push   $0x1
+  8018b9:	ff 75 f4             	push   -0xc(%ebp)
+  8018bc:	e8 58 ff ff ff       	call   801819 <fd_close>
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	eb ec                	jmp    8018b2 <close+0x19>
+
+008018c6 <close_all>:
+  8018c6:	55                   	push   %ebp
+  8018c7:	89 e5                	mov    %esp,%ebp
+  8018c9:	53                   	push   %ebx
+  8018ca:	83 ec 04             	sub    $0x4,%esp
+  8018cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d2:	83 ec 0c             	sub    $0xc,%esp
+  8018d5:	53                   	push   %ebx
+  8018d6:	e8 be ff ff ff       	call   801899 <close>
+  8018db:	83 c3 01             	add    $0x1,%ebx
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	83 fb 20             	cmp    $0x20,%ebx
+  8018e4:	75 ec                	jne    8018d2 <close_all+0xc>
+  8018e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e9:	c9                   	leave
+  8018ea:	c3                   	ret
+
+008018eb <dup>:
+  8018eb:	55                   	push   %ebp
+  8018ec:	89 e5                	mov    %esp,%ebp
+  8018ee:	57                   	push   %edi
+  8018ef:	56                   	push   %esi
+  8018f0:	53                   	push   %ebx
+  8018f1:	83 ec 34             	sub    $0x34,%esp
+  8018f4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018f7:	50                   	push   %eax
+  8018f8:	ff 75 08             	push   0x8(%ebp)
+  8018fb:	e8 73 fe ff ff       	call   801773 <fd_lookup>
+  801900:	89 c3                	mov    %eax,%ebx
+  801902:	83 c4 10             	add    $0x10,%esp
+  801905:	85 c0                	test   %eax,%eax
+  801907:	78 7f                	js     801988 <dup+0x9d>
+  801909:	83 ec 0c             	sub    $0xc,%esp
+  80190c:	ff 75 0c             	push   0xc(%ebp)
+  80190f:	e8 85 ff ff ff       	call   801899 <close>
+  801914:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801917:	c1 e6 0c             	shl    $0xc,%esi
+  80191a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801920:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801923:	89 3c 24             	mov    %edi,(%esp)
+  801926:	e8 e1 fd ff ff       	call   80170c <fd2data>
+  80192b:	89 c3                	mov    %eax,%ebx
+  80192d:	89 34 24             	mov    %esi,(%esp)
+  801930:	e8 d7 fd ff ff       	call   80170c <fd2data>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80193b:	89 d8                	mov    %ebx,%eax
+  80193d:	c1 e8 16             	shr    $0x16,%eax
+  801940:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801947:	a8 01                	test   $0x1,%al
+  801949:	74 11                	je     80195c <dup+0x71>
+  80194b:	89 d8                	mov    %ebx,%eax
+  80194d:	c1 e8 0c             	shr    $0xc,%eax
+  801950:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801957:	f6 c2 01             	test   $0x1,%dl
+  80195a:	75 36                	jne    801992 <dup+0xa7>
+  80195c:	89 f8                	mov    %edi,%eax
+  80195e:	c1 e8 0c             	shr    $0xc,%eax
+  801961:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801968:	83 ec 0c             	sub    $0xc,%esp
+  80196b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801970:	50                   	push   %eax
+  801971:	56                   	push   %esi
+  801972:	6a 00                	push   $0x0
+  801974:	57                   	push   %edi
+  801975:	6a 00                	push   $0x0
+  801977:	e8 55 f5 ff ff       	call   800ed1 <sys_page_map>
+  80197c:	89 c3                	mov    %eax,%ebx
+  80197e:	83 c4 20             	add    $0x20,%esp
+  801981:	85 c0                	test   %eax,%eax
+  801983:	78 33                	js     8019b8 <dup+0xcd>
+  801985:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801988:	89 d8                	mov    %ebx,%eax
+  80198a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198d:	5b                   	pop    %ebx
+  80198e:	5e                   	pop    %esi
+  80198f:	5f                   	pop    %edi
+  801990:	5d                   	pop    %ebp
+  801991:	c3                   	ret
+  801992:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801999:	83 ec 0c             	sub    $0xc,%esp
+  80199c:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019a1:	50                   	push   %eax
+  8019a2:	ff 75 d4             	push   -0x2c(%ebp)
+  8019a5:	6a 00                	push   $0x0
+  8019a7:	53                   	push   %ebx
+  8019a8:	6a 00                	push   $0x0
+  8019aa:	e8 22 f5 ff ff       	call   800ed1 <sys_page_map>
+  8019af:	89 c3                	mov    %eax,%ebx
+  8019b1:	83 c4 20             	add    $0x20,%esp
+  8019b4:	85 c0                	test   %eax,%eax
+  8019b6:	79 a4                	jns    80195c <dup+0x71>
+  8019b8:	83 ec 08             	sub    $0x8,%esp
+  8019bb:	56                   	push   %esi
+  8019bc:	6a 00                	push   $0x0
+  8019be:	e8 9d f5 ff ff       	call   800f60 <sys_page_unmap>
+  8019c3:	83 c4 08             	add    $0x8,%esp
+  8019c6:	ff 75 d4             	push   -0x2c(%ebp)
+  8019c9:	6a 00                	push   $0x0
+  8019cb:	e8 90 f5 ff ff       	call   800f60 <sys_page_unmap>
+  8019d0:	83 c4 10             	add    $0x10,%esp
+  8019d3:	eb b3                	jmp    801988 <dup+0x9d>
+
+008019d5 <read>:
+  8019d5:	55                   	push   %ebp
+  8019d6:	89 e5                	mov    %esp,%ebp
+  8019d8:	56                   	push   %esi
+  8019d9:	53                   	push   %ebx
+  8019da:	83 ec 18             	sub    $0x18,%esp
+  8019dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019e3:	50                   	push   %eax
+  8019e4:	56                   	push   %esi
+  8019e5:	e8 89 fd ff ff       	call   801773 <fd_lookup>
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	78 3c                	js     801a2d <read+0x58>
+  8019f1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019f4:	83 ec 08             	sub    $0x8,%esp
+  8019f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019fa:	50                   	push   %eax
+  8019fb:	ff 33                	push   (%ebx)
+  8019fd:	e8 c1 fd ff ff       	call   8017c3 <dev_lookup>
+  801a02:	83 c4 10             	add    $0x10,%esp
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	78 24                	js     801a2d <read+0x58>
+  801a09:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a0c:	83 e0 03             	and    $0x3,%eax
+  801a0f:	83 f8 01             	cmp    $0x1,%eax
+  801a12:	74 20                	je     801a34 <read+0x5f>
+  801a14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a17:	8b 40 08             	mov    0x8(%eax),%eax
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	74 37                	je     801a55 <read+0x80>
+  801a1e:	83 ec 04             	sub    $0x4,%esp
+  801a21:	ff 75 10             	push   0x10(%ebp)
+  801a24:	ff 75 0c             	push   0xc(%ebp)
+  801a27:	53                   	push   %ebx
+  801a28:	ff d0                	call   *%eax
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a30:	5b                   	pop    %ebx
+  801a31:	5e                   	pop    %esi
+  801a32:	5d                   	pop    %ebp
+  801a33:	c3                   	ret
+  801a34:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a39:	8b 40 48             	mov    0x48(%eax),%eax
+  801a3c:	83 ec 04             	sub    $0x4,%esp
+  801a3f:	56                   	push   %esi
+  801a40:	50                   	push   %eax
+  801a41:	68 99 37 80 00       	push   $0x803799
+  801a46:	e8 ec e8 ff ff       	call   800337 <cprintf>
+  801a4b:	83 c4 10             	add    $0x10,%esp
+  801a4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a53:	eb d8                	jmp    801a2d <read+0x58>
+  801a55:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a5a:	eb d1                	jmp    801a2d <read+0x58>
+
+00801a5c <readn>:
+  801a5c:	55                   	push   %ebp
+  801a5d:	89 e5                	mov    %esp,%ebp
+  801a5f:	57                   	push   %edi
+  801a60:	56                   	push   %esi
+  801a61:	53                   	push   %ebx
+  801a62:	83 ec 0c             	sub    $0xc,%esp
+  801a65:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801a68:	8b 75 10             	mov    0x10(%ebp),%esi
+  801a6b:	85 f6                	test   %esi,%esi
+  801a6d:	74 30                	je     801a9f <readn+0x43>
+  801a6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a79:	83 ec 04             	sub    $0x4,%esp
+  801a7c:	89 f2                	mov    %esi,%edx
+  801a7e:	29 c2                	sub    %eax,%edx
+  801a80:	52                   	push   %edx
+  801a81:	01 f8                	add    %edi,%eax
+  801a83:	50                   	push   %eax
+  801a84:	ff 75 08             	push   0x8(%ebp)
+  801a87:	e8 49 ff ff ff       	call   8019d5 <read>
+  801a8c:	83 c4 10             	add    $0x10,%esp
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	78 15                	js     801aa8 <readn+0x4c>
+  801a93:	74 11                	je     801aa6 <readn+0x4a>
+  801a95:	01 c3                	add    %eax,%ebx
+  801a97:	89 d8                	mov    %ebx,%eax
+  801a99:	39 f3                	cmp    %esi,%ebx
+  801a9b:	72 dc                	jb     801a79 <readn+0x1d>
+  801a9d:	eb 09                	jmp    801aa8 <readn+0x4c>
+  801a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa4:	eb 02                	jmp    801aa8 <readn+0x4c>
+  801aa6:	89 d8                	mov    %ebx,%eax
+  801aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aab:	5b                   	pop    %ebx
+  801aac:	5e                   	pop    %esi
+  801aad:	5f                   	pop    %edi
+  801aae:	5d                   	pop    %ebp
+  801aaf:	c3                   	ret
+
+00801ab0 <write>:
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	56                   	push   %esi
+  801ab4:	53                   	push   %ebx
+  801ab5:	83 ec 18             	sub    $0x18,%esp
+  801ab8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801abb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abe:	50                   	push   %eax
+  801abf:	53                   	push   %ebx
+  801ac0:	e8 ae fc ff ff       	call   801773 <fd_lookup>
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	78 37                	js     801b03 <write+0x53>
+  801acc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801acf:	83 ec 08             	sub    $0x8,%esp
+  801ad2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad5:	50                   	push   %eax
+  801ad6:	ff 36                	push   (%esi)
+  801ad8:	e8 e6 fc ff ff       	call   8017c3 <dev_lookup>
+  801add:	83 c4 10             	add    $0x10,%esp
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 1f                	js     801b03 <write+0x53>
+  801ae4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ae8:	74 20                	je     801b0a <write+0x5a>
+  801aea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aed:	8b 40 0c             	mov    0xc(%eax),%eax
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	74 37                	je     801b2b <write+0x7b>
+  801af4:	83 ec 04             	sub    $0x4,%esp
+  801af7:	ff 75 10             	push   0x10(%ebp)
+  801afa:	ff 75 0c             	push   0xc(%ebp)
+  801afd:	56                   	push   %esi
+  801afe:	ff d0                	call   *%eax
+  801b00:	83 c4 10             	add    $0x10,%esp
+  801b03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b06:	5b                   	pop    %ebx
+  801b07:	5e                   	pop    %esi
+  801b08:	5d                   	pop    %ebp
+  801b09:	c3                   	ret
+  801b0a:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b0f:	8b 40 48             	mov    0x48(%eax),%eax
+  801b12:	83 ec 04             	sub    $0x4,%esp
+  801b15:	53                   	push   %ebx
+  801b16:	50                   	push   %eax
+  801b17:	68 b5 37 80 00       	push   $0x8037b5
+  801b1c:	e8 16 e8 ff ff       	call   800337 <cprintf>
+  801b21:	83 c4 10             	add    $0x10,%esp
+  801b24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b29:	eb d8                	jmp    801b03 <write+0x53>
+  801b2b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b30:	eb d1                	jmp    801b03 <write+0x53>
+
+00801b32 <seek>:
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	83 ec 20             	sub    $0x20,%esp
+  801b38:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b3b:	50                   	push   %eax
+  801b3c:	ff 75 08             	push   0x8(%ebp)
+  801b3f:	e8 2f fc ff ff       	call   801773 <fd_lookup>
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	85 c0                	test   %eax,%eax
+  801b49:	78 0e                	js     801b59 <seek+0x27>
+  801b4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b51:	89 50 04             	mov    %edx,0x4(%eax)
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	c9                   	leave
+  801b5a:	c3                   	ret
+
+00801b5b <ftruncate>:
+  801b5b:	55                   	push   %ebp
+  801b5c:	89 e5                	mov    %esp,%ebp
+  801b5e:	56                   	push   %esi
+  801b5f:	53                   	push   %ebx
+  801b60:	83 ec 18             	sub    $0x18,%esp
+  801b63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b66:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b69:	50                   	push   %eax
+  801b6a:	53                   	push   %ebx
+  801b6b:	e8 03 fc ff ff       	call   801773 <fd_lookup>
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	78 34                	js     801bab <ftruncate+0x50>
+  801b77:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b7a:	83 ec 08             	sub    $0x8,%esp
+  801b7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b80:	50                   	push   %eax
+  801b81:	ff 36                	push   (%esi)
+  801b83:	e8 3b fc ff ff       	call   8017c3 <dev_lookup>
+  801b88:	83 c4 10             	add    $0x10,%esp
+  801b8b:	85 c0                	test   %eax,%eax
+  801b8d:	78 1c                	js     801bab <ftruncate+0x50>
+  801b8f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b93:	74 1d                	je     801bb2 <ftruncate+0x57>
+  801b95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b98:	8b 40 18             	mov    0x18(%eax),%eax
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	74 34                	je     801bd3 <ftruncate+0x78>
+  801b9f:	83 ec 08             	sub    $0x8,%esp
+  801ba2:	ff 75 0c             	push   0xc(%ebp)
+  801ba5:	56                   	push   %esi
+  801ba6:	ff d0                	call   *%eax
+  801ba8:	83 c4 10             	add    $0x10,%esp
+  801bab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bae:	5b                   	pop    %ebx
+  801baf:	5e                   	pop    %esi
+  801bb0:	5d                   	pop    %ebp
+  801bb1:	c3                   	ret
+  801bb2:	a1 10 50 80 00       	mov    0x805010,%eax
+  801bb7:	8b 40 48             	mov    0x48(%eax),%eax
+  801bba:	83 ec 04             	sub    $0x4,%esp
+  801bbd:	53                   	push   %ebx
+  801bbe:	50                   	push   %eax
+  801bbf:	68 78 37 80 00       	push   $0x803778
+  801bc4:	e8 6e e7 ff ff       	call   800337 <cprintf>
+  801bc9:	83 c4 10             	add    $0x10,%esp
+  801bcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bd1:	eb d8                	jmp    801bab <ftruncate+0x50>
+  801bd3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd8:	eb d1                	jmp    801bab <ftruncate+0x50>
+
+00801bda <fstat>:
+  801bda:	55                   	push   %ebp
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	56                   	push   %esi
+  801bde:	53                   	push   %ebx
+  801bdf:	83 ec 18             	sub    $0x18,%esp
+  801be2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801be5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801be8:	50                   	push   %eax
+  801be9:	ff 75 08             	push   0x8(%ebp)
+  801bec:	e8 82 fb ff ff       	call   801773 <fd_lookup>
+  801bf1:	83 c4 10             	add    $0x10,%esp
+  801bf4:	85 c0                	test   %eax,%eax
+  801bf6:	78 49                	js     801c41 <fstat+0x67>
+  801bf8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bfb:	83 ec 08             	sub    $0x8,%esp
+  801bfe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c01:	50                   	push   %eax
+  801c02:	ff 36                	push   (%esi)
+  801c04:	e8 ba fb ff ff       	call   8017c3 <dev_lookup>
+  801c09:	83 c4 10             	add    $0x10,%esp
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	78 31                	js     801c41 <fstat+0x67>
+  801c10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c13:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c17:	74 2f                	je     801c48 <fstat+0x6e>
+  801c19:	c6 03 00             	movb   $0x0,(%ebx)
+  801c1c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c23:	00 00 00 
+  801c26:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c2d:	00 00 00 
+  801c30:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801c36:	83 ec 08             	sub    $0x8,%esp
+  801c39:	53                   	push   %ebx
+  801c3a:	56                   	push   %esi
+  801c3b:	ff 50 14             	call   *0x14(%eax)
+  801c3e:	83 c4 10             	add    $0x10,%esp
+  801c41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c44:	5b                   	pop    %ebx
+  801c45:	5e                   	pop    %esi
+  801c46:	5d                   	pop    %ebp
+  801c47:	c3                   	ret
+  801c48:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c4d:	eb f2                	jmp    801c41 <fstat+0x67>
+
+00801c4f <stat>:
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	56                   	push   %esi
+  801c53:	53                   	push   %ebx
+  801c54:	83 ec 08             	sub    $0x8,%esp
+  801c57:	6a 00                	push   $0x0
+  801c59:	ff 75 08             	push   0x8(%ebp)
+  801c5c:	e8 31 05 00 00       	call   802192 <open>
+  801c61:	89 c3                	mov    %eax,%ebx
+  801c63:	83 c4 10             	add    $0x10,%esp
+  801c66:	85 c0                	test   %eax,%eax
+  801c68:	78 1b                	js     801c85 <stat+0x36>
+  801c6a:	83 ec 08             	sub    $0x8,%esp
+  801c6d:	ff 75 0c             	push   0xc(%ebp)
+  801c70:	50                   	push   %eax
+  801c71:	e8 64 ff ff ff       	call   801bda <fstat>
+  801c76:	89 c6                	mov    %eax,%esi
+  801c78:	89 1c 24             	mov    %ebx,(%esp)
+  801c7b:	e8 19 fc ff ff       	call   801899 <close>
+  801c80:	83 c4 10             	add    $0x10,%esp
+  801c83:	89 f3                	mov    %esi,%ebx
+  801c85:	89 d8                	mov    %ebx,%eax
+  801c87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c8a:	5b                   	pop    %ebx
+  801c8b:	5e                   	pop    %esi
+  801c8c:	5d                   	pop    %ebp
+  801c8d:	c3                   	ret
+
+00801c8e <fsipc>:
+  801c8e:	55                   	push   %ebp
+  801c8f:	89 e5                	mov    %esp,%ebp
+  801c91:	56                   	push   %esi
+  801c92:	53                   	push   %ebx
+  801c93:	89 c3                	mov    %eax,%ebx
+  801c95:	89 d6                	mov    %edx,%esi
+  801c97:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c9e:	74 20                	je     801cc0 <fsipc+0x32>
+  801ca0:	83 ec 08             	sub    $0x8,%esp
+  801ca3:	6a 00                	push   $0x0
+  801ca5:	56                   	push   %esi
+  801ca6:	6a 07                	push   $0x7
+  801ca8:	68 00 60 80 00       	push   $0x806000
+  801cad:	53                   	push   %ebx
+  801cae:	ff 35 08 50 80 00    	push   0x805008
+  801cb4:	e8 5a 12 00 00       	call   802f13 <ipc_call>
+  801cb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cbc:	5b                   	pop    %ebx
+  801cbd:	5e                   	pop    %esi
+  801cbe:	5d                   	pop    %ebp
+  801cbf:	c3                   	ret
+  801cc0:	83 ec 0c             	sub    $0xc,%esp
+  801cc3:	6a 02                	push   $0x2
+  801cc5:	e8 e4 13 00 00       	call   8030ae <ipc_find_env>
+  801cca:	a3 08 50 80 00       	mov    %eax,0x805008
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	eb cc                	jmp    801ca0 <fsipc+0x12>
+
+00801cd4 <devfile_trunc>:
+  801cd4:	55                   	push   %ebp
+  801cd5:	89 e5                	mov    %esp,%ebp
+  801cd7:	83 ec 08             	sub    $0x8,%esp
+  801cda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cdd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ce0:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ce5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ce8:	a3 04 60 80 00       	mov    %eax,0x806004
+  801ced:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cf7:	e8 92 ff ff ff       	call   801c8e <fsipc>
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+
+00801cfe <devfile_flush>:
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	83 ec 08             	sub    $0x8,%esp
+  801d04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d07:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d0a:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d14:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d19:	e8 70 ff ff ff       	call   801c8e <fsipc>
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+
+00801d20 <devfile_stat>:
+  801d20:	55                   	push   %ebp
+  801d21:	89 e5                	mov    %esp,%ebp
+  801d23:	53                   	push   %ebx
+  801d24:	83 ec 04             	sub    $0x4,%esp
+  801d27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d30:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3a:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d3f:	e8 4a ff ff ff       	call   801c8e <fsipc>
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 2c                	js     801d74 <devfile_stat+0x54>
+  801d48:	83 ec 08             	sub    $0x8,%esp
+  801d4b:	68 00 60 80 00       	push   $0x806000
+  801d50:	53                   	push   %ebx
+  801d51:	e8 d8 ec ff ff       	call   800a2e <strcpy>
+  801d56:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d5b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801d61:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d66:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d77:	c9                   	leave
+  801d78:	c3                   	ret
+
+00801d79 <fsring_rw>:
+  801d79:	55                   	push   %ebp
+  801d7a:	89 e5                	mov    %esp,%ebp
+  801d7c:	57                   	push   %edi
+  801d7d:	56                   	push   %esi
+  801d7e:	53                   	push   %ebx
+  801d7f:	83 ec 2c             	sub    $0x2c,%esp
+  801d82:	89 c7                	mov    %eax,%edi
+  801d84:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801d87:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801d8a:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801d8f:	a8 01                	test   $0x1,%al
+  801d91:	74 0d                	je     801da0 <fsring_rw+0x27>
+  801d93:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801d98:	a8 01                	test   $0x1,%al
+  801d9a:	0f 85 d5 00 00 00    	jne    801e75 <fsring_rw+0xfc>
+  801da0:	a1 10 50 80 00       	mov    0x805010,%eax
+  801da5:	8b 40 48             	mov    0x48(%eax),%eax
+  801da8:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801dae:	0f 84 fc 00 00 00    	je     801eb0 <fsring_rw+0x137>
+  801db4:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801dbb:	0f 84 02 01 00 00    	je     801ec3 <fsring_rw+0x14a>
+  801dc1:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dc6:	83 ec 04             	sub    $0x4,%esp
+  801dc9:	68 07 02 00 00       	push   $0x207
+  801dce:	53                   	push   %ebx
+  801dcf:	6a 00                	push   $0x0
+  801dd1:	e8 b8 f0 ff ff       	call   800e8e <sys_page_alloc>
+  801dd6:	83 c4 10             	add    $0x10,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	0f 88 f9 00 00 00    	js     801eda <fsring_rw+0x161>
+  801de1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801de7:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ded:	75 d7                	jne    801dc6 <fsring_rw+0x4d>
+  801def:	6a 0e                	push   $0xe
+  801df1:	6a 0d                	push   $0xd
+  801df3:	ff 35 08 50 80 00    	push   0x805008
+  801df9:	68 00 00 f0 cf       	push   $0xcff00000
+  801dfe:	e8 c4 0c 00 00       	call   802ac7 <ipcring_init>
+  801e03:	83 c4 08             	add    $0x8,%esp
+  801e06:	6a 00                	push   $0x0
+  801e08:	6a 00                	push   $0x0
+  801e0a:	68 07 02 00 00       	push   $0x207
+  801e0f:	68 00 00 f0 cf       	push   $0xcff00000
+  801e14:	6a 0b                	push   $0xb
+  801e16:	ff 35 08 50 80 00    	push   0x805008
+  801e1c:	e8 f2 10 00 00       	call   802f13 <ipc_call>
+  801e21:	89 c6                	mov    %eax,%esi
+  801e23:	83 c4 20             	add    $0x20,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	0f 88 ac 00 00 00    	js     801eda <fsring_rw+0x161>
+  801e2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e33:	89 d9                	mov    %ebx,%ecx
+  801e35:	83 c3 01             	add    $0x1,%ebx
+  801e38:	89 da                	mov    %ebx,%edx
+  801e3a:	c1 e2 0c             	shl    $0xc,%edx
+  801e3d:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801e43:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801e49:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801e4f:	83 ec 08             	sub    $0x8,%esp
+  801e52:	6a 00                	push   $0x0
+  801e54:	6a 00                	push   $0x0
+  801e56:	68 07 02 00 00       	push   $0x207
+  801e5b:	50                   	push   %eax
+  801e5c:	6a 0c                	push   $0xc
+  801e5e:	ff 35 08 50 80 00    	push   0x805008
+  801e64:	e8 aa 10 00 00       	call   802f13 <ipc_call>
+  801e69:	83 c4 20             	add    $0x20,%esp
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 6a                	js     801eda <fsring_rw+0x161>
+  801e70:	83 fb 08             	cmp    $0x8,%ebx
+  801e73:	75 be                	jne    801e33 <fsring_rw+0xba>
+  801e75:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e79:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801e7e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801e83:	0f 45 c2             	cmovne %edx,%eax
+  801e86:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801e89:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801e90:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801e97:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801e9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ea8:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801eab:	e9 4b 01 00 00       	jmp    801ffb <fsring_rw+0x282>
+  801eb0:	e8 a3 f3 ff ff       	call   801258 <sys_time_msec>
+  801eb5:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801ebb:	0f 89 f3 fe ff ff    	jns    801db4 <fsring_rw+0x3b>
+  801ec1:	eb 54                	jmp    801f17 <fsring_rw+0x19e>
+  801ec3:	83 ec 0c             	sub    $0xc,%esp
+  801ec6:	6a 02                	push   $0x2
+  801ec8:	e8 e1 11 00 00       	call   8030ae <ipc_find_env>
+  801ecd:	a3 08 50 80 00       	mov    %eax,0x805008
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	e9 e7 fe ff ff       	jmp    801dc1 <fsring_rw+0x48>
+  801eda:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801edf:	83 ec 08             	sub    $0x8,%esp
+  801ee2:	53                   	push   %ebx
+  801ee3:	6a 00                	push   $0x0
+  801ee5:	e8 76 f0 ff ff       	call   800f60 <sys_page_unmap>
+  801eea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ef0:	83 c4 10             	add    $0x10,%esp
+  801ef3:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801ef9:	75 e4                	jne    801edf <fsring_rw+0x166>
+  801efb:	e8 58 f3 ff ff       	call   801258 <sys_time_msec>
+  801f00:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801f05:	a3 00 50 80 00       	mov    %eax,0x805000
+  801f0a:	a1 10 50 80 00       	mov    0x805010,%eax
+  801f0f:	8b 40 48             	mov    0x48(%eax),%eax
+  801f12:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f17:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801f1e:	e9 7a 01 00 00       	jmp    80209d <fsring_rw+0x324>
+  801f23:	8b 57 0c             	mov    0xc(%edi),%edx
+  801f26:	89 10                	mov    %edx,(%eax)
+  801f28:	89 58 04             	mov    %ebx,0x4(%eax)
+  801f2b:	89 f2                	mov    %esi,%edx
+  801f2d:	03 57 04             	add    0x4(%edi),%edx
+  801f30:	89 50 08             	mov    %edx,0x8(%eax)
+  801f33:	83 ec 04             	sub    $0x4,%esp
+  801f36:	53                   	push   %ebx
+  801f37:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801f3a:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801f3d:	52                   	push   %edx
+  801f3e:	83 c0 0c             	add    $0xc,%eax
+  801f41:	50                   	push   %eax
+  801f42:	e8 97 ec ff ff       	call   800bde <memmove>
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f4d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801f50:	89 08                	mov    %ecx,(%eax)
+  801f52:	83 ec 0c             	sub    $0xc,%esp
+  801f55:	68 00 00 f0 cf       	push   $0xcff00000
+  801f5a:	e8 c6 0b 00 00       	call   802b25 <ipcring_req_push>
+  801f5f:	01 de                	add    %ebx,%esi
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801f67:	73 4c                	jae    801fb5 <fsring_rw+0x23c>
+  801f69:	83 ec 0c             	sub    $0xc,%esp
+  801f6c:	68 00 00 f0 cf       	push   $0xcff00000
+  801f71:	e8 89 0b 00 00       	call   802aff <ipcring_req_slot>
+  801f76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f79:	83 c4 10             	add    $0x10,%esp
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	74 35                	je     801fb5 <fsring_rw+0x23c>
+  801f80:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801f85:	83 e0 07             	and    $0x7,%eax
+  801f88:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801f8d:	c1 e0 0c             	shl    $0xc,%eax
+  801f90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f93:	29 f3                	sub    %esi,%ebx
+  801f95:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801f98:	39 cb                	cmp    %ecx,%ebx
+  801f9a:	0f 47 d9             	cmova  %ecx,%ebx
+  801f9d:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801fa1:	75 80                	jne    801f23 <fsring_rw+0x1aa>
+  801fa3:	8b 57 0c             	mov    0xc(%edi),%edx
+  801fa6:	89 10                	mov    %edx,(%eax)
+  801fa8:	89 58 04             	mov    %ebx,0x4(%eax)
+  801fab:	89 f2                	mov    %esi,%edx
+  801fad:	03 57 04             	add    0x4(%edi),%edx
+  801fb0:	89 50 08             	mov    %edx,0x8(%eax)
+  801fb3:	eb 95                	jmp    801f4a <fsring_rw+0x1d1>
+  801fb5:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801fba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801fbd:	83 ec 0c             	sub    $0xc,%esp
+  801fc0:	68 00 00 f0 cf       	push   $0xcff00000
+  801fc5:	e8 94 0b 00 00       	call   802b5e <ipcring_rsp_wait>
+  801fca:	8b 58 04             	mov    0x4(%eax),%ebx
+  801fcd:	83 c4 10             	add    $0x10,%esp
+  801fd0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801fd4:	75 45                	jne    80201b <fsring_rw+0x2a2>
+  801fd6:	85 db                	test   %ebx,%ebx
+  801fd8:	79 41                	jns    80201b <fsring_rw+0x2a2>
+  801fda:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801fdd:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801fe4:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801feb:	83 ec 0c             	sub    $0xc,%esp
+  801fee:	68 00 00 f0 cf       	push   $0xcff00000
+  801ff3:	e8 cc 0b 00 00       	call   802bc4 <ipcring_rsp_pop>
+  801ff8:	83 c4 10             	add    $0x10,%esp
+  801ffb:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  802001:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  802006:	39 c2                	cmp    %eax,%edx
+  802008:	74 75                	je     80207f <fsring_rw+0x306>
+  80200a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80200e:	75 a5                	jne    801fb5 <fsring_rw+0x23c>
+  802010:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802013:	0f 82 50 ff ff ff    	jb     801f69 <fsring_rw+0x1f0>
+  802019:	eb 9a                	jmp    801fb5 <fsring_rw+0x23c>
+  80201b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80201f:	75 ca                	jne    801feb <fsring_rw+0x272>
+  802021:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  802025:	74 31                	je     802058 <fsring_rw+0x2df>
+  802027:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202a:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80202d:	29 c8                	sub    %ecx,%eax
+  80202f:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802032:	39 d0                	cmp    %edx,%eax
+  802034:	0f 47 c2             	cmova  %edx,%eax
+  802037:	39 d8                	cmp    %ebx,%eax
+  802039:	ba 01 00 00 00       	mov    $0x1,%edx
+  80203e:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  802042:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  802045:	b8 01 00 00 00       	mov    $0x1,%eax
+  80204a:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  80204e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802051:	01 d9                	add    %ebx,%ecx
+  802053:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  802056:	eb 93                	jmp    801feb <fsring_rw+0x272>
+  802058:	83 ec 04             	sub    $0x4,%esp
+  80205b:	53                   	push   %ebx
+  80205c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80205f:	83 e0 07             	and    $0x7,%eax
+  802062:	c1 e0 0c             	shl    $0xc,%eax
+  802065:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  80206b:	50                   	push   %eax
+  80206c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80206f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  802072:	01 c8                	add    %ecx,%eax
+  802074:	50                   	push   %eax
+  802075:	e8 64 eb ff ff       	call   800bde <memmove>
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	eb a8                	jmp    802027 <fsring_rw+0x2ae>
+  80207f:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  802083:	75 09                	jne    80208e <fsring_rw+0x315>
+  802085:	3b 75 08             	cmp    0x8(%ebp),%esi
+  802088:	0f 82 db fe ff ff    	jb     801f69 <fsring_rw+0x1f0>
+  80208e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802091:	01 57 04             	add    %edx,0x4(%edi)
+  802094:	85 d2                	test   %edx,%edx
+  802096:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  80209a:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80209d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8020a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a3:	5b                   	pop    %ebx
+  8020a4:	5e                   	pop    %esi
+  8020a5:	5f                   	pop    %edi
+  8020a6:	5d                   	pop    %ebp
+  8020a7:	c3                   	ret
+
+008020a8 <devfile_write>:
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	57                   	push   %edi
+  8020ac:	56                   	push   %esi
+  8020ad:	53                   	push   %ebx
+  8020ae:	83 ec 0c             	sub    $0xc,%esp
+  8020b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020ba:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  8020c0:	76 1a                	jbe    8020dc <devfile_write+0x34>
+  8020c2:	83 ec 0c             	sub    $0xc,%esp
+  8020c5:	53                   	push   %ebx
+  8020c6:	89 f1                	mov    %esi,%ecx
+  8020c8:	ba 06 00 00 00       	mov    $0x6,%edx
+  8020cd:	89 f8                	mov    %edi,%eax
+  8020cf:	e8 a5 fc ff ff       	call   801d79 <fsring_rw>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8020da:	75 39                	jne    802115 <devfile_write+0x6d>
+  8020dc:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  8020e1:	39 c3                	cmp    %eax,%ebx
+  8020e3:	0f 47 d8             	cmova  %eax,%ebx
+  8020e6:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020e9:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020ee:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8020f4:	83 ec 04             	sub    $0x4,%esp
+  8020f7:	53                   	push   %ebx
+  8020f8:	56                   	push   %esi
+  8020f9:	68 08 60 80 00       	push   $0x806008
+  8020fe:	e8 db ea ff ff       	call   800bde <memmove>
+  802103:	ba 00 00 00 00       	mov    $0x0,%edx
+  802108:	b8 04 00 00 00       	mov    $0x4,%eax
+  80210d:	e8 7c fb ff ff       	call   801c8e <fsipc>
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802118:	5b                   	pop    %ebx
+  802119:	5e                   	pop    %esi
+  80211a:	5f                   	pop    %edi
+  80211b:	5d                   	pop    %ebp
+  80211c:	c3                   	ret
+
+0080211d <devfile_read>:
+  80211d:	55                   	push   %ebp
+  80211e:	89 e5                	mov    %esp,%ebp
+  802120:	57                   	push   %edi
+  802121:	56                   	push   %esi
+  802122:	53                   	push   %ebx
+  802123:	83 ec 0c             	sub    $0xc,%esp
+  802126:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802129:	8b 75 10             	mov    0x10(%ebp),%esi
+  80212c:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  802132:	76 1d                	jbe    802151 <devfile_read+0x34>
+  802134:	83 ec 0c             	sub    $0xc,%esp
+  802137:	56                   	push   %esi
+  802138:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80213b:	ba 05 00 00 00       	mov    $0x5,%edx
+  802140:	89 f8                	mov    %edi,%eax
+  802142:	e8 32 fc ff ff       	call   801d79 <fsring_rw>
+  802147:	89 c3                	mov    %eax,%ebx
+  802149:	83 c4 10             	add    $0x10,%esp
+  80214c:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80214f:	75 37                	jne    802188 <devfile_read+0x6b>
+  802151:	8b 47 0c             	mov    0xc(%edi),%eax
+  802154:	a3 00 60 80 00       	mov    %eax,0x806000
+  802159:	89 35 04 60 80 00    	mov    %esi,0x806004
+  80215f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802164:	b8 03 00 00 00       	mov    $0x3,%eax
+  802169:	e8 20 fb ff ff       	call   801c8e <fsipc>
+  80216e:	89 c3                	mov    %eax,%ebx
+  802170:	85 c0                	test   %eax,%eax
+  802172:	78 14                	js     802188 <devfile_read+0x6b>
+  802174:	83 ec 04             	sub    $0x4,%esp
+  802177:	50                   	push   %eax
+  802178:	68 00 60 80 00       	push   $0x806000
+  80217d:	ff 75 0c             	push   0xc(%ebp)
+  802180:	e8 59 ea ff ff       	call   800bde <memmove>
+  802185:	83 c4 10             	add    $0x10,%esp
+  802188:	89 d8                	mov    %ebx,%eax
+  80218a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218d:	5b                   	pop    %ebx
+  80218e:	5e                   	pop    %esi
+  80218f:	5f                   	pop    %edi
+  802190:	5d                   	pop    %ebp
+  802191:	c3                   	ret
+
+00802192 <open>:
+  802192:	55                   	push   %ebp
+  802193:	89 e5                	mov    %esp,%ebp
+  802195:	56                   	push   %esi
+  802196:	53                   	push   %ebx
+  802197:	83 ec 1c             	sub    $0x1c,%esp
+  80219a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80219d:	56                   	push   %esi
+  80219e:	e8 3f e8 ff ff       	call   8009e2 <strlen>
+  8021a3:	83 c4 10             	add    $0x10,%esp
+  8021a6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021ab:	7f 6c                	jg     802219 <open+0x87>
+  8021ad:	83 ec 0c             	sub    $0xc,%esp
+  8021b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b3:	50                   	push   %eax
+  8021b4:	e8 6a f5 ff ff       	call   801723 <fd_alloc>
+  8021b9:	89 c3                	mov    %eax,%ebx
+  8021bb:	83 c4 10             	add    $0x10,%esp
+  8021be:	85 c0                	test   %eax,%eax
+  8021c0:	78 3c                	js     8021fe <open+0x6c>
+  8021c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c5:	a3 00 64 80 00       	mov    %eax,0x806400
+  8021ca:	83 ec 08             	sub    $0x8,%esp
+  8021cd:	56                   	push   %esi
+  8021ce:	68 00 60 80 00       	push   $0x806000
+  8021d3:	e8 56 e8 ff ff       	call   800a2e <strcpy>
+  8021d8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021e0:	e8 a9 fa ff ff       	call   801c8e <fsipc>
+  8021e5:	89 c3                	mov    %eax,%ebx
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 19                	js     802207 <open+0x75>
+  8021ee:	83 ec 0c             	sub    $0xc,%esp
+  8021f1:	ff 75 f4             	push   -0xc(%ebp)
+  8021f4:	e8 03 f5 ff ff       	call   8016fc <fd2num>
+  8021f9:	89 c3                	mov    %eax,%ebx
+  8021fb:	83 c4 10             	add    $0x10,%esp
+  8021fe:	89 d8                	mov    %ebx,%eax
+  802200:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802203:	5b                   	pop    %ebx
+  802204:	5e                   	pop    %esi
+  802205:	5d                   	pop    %ebp
+  802206:	c3                   	ret
+  802207:	83 ec 08             	sub    $0x8,%esp
+  80220a:	6a 00                	push   $0x0
+  80220c:	ff 75 f4             	push   -0xc(%ebp)
+  80220f:	e8 05 f6 ff ff       	call   801819 <fd_close>
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	eb e5                	jmp    8021fe <open+0x6c>
+  802219:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80221e:	eb de                	jmp    8021fe <open+0x6c>
+
+00802220 <file_image>:
+  802220:	55                   	push   %ebp
+  802221:	89 e5                	mov    %esp,%ebp
+  802223:	53                   	push   %ebx
+  802224:	83 ec 1c             	sub    $0x1c,%esp
+  802227:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80222a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222d:	50                   	push   %eax
+  80222e:	ff 75 08             	push   0x8(%ebp)
+  802231:	e8 3d f5 ff ff       	call   801773 <fd_lookup>
+  802236:	83 c4 10             	add    $0x10,%esp
+  802239:	85 c0                	test   %eax,%eax
+  80223b:	78 58                	js     802295 <file_image+0x75>
+  80223d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802240:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802246:	39 08                	cmp    %ecx,(%eax)
+  802248:	75 50                	jne    80229a <file_image+0x7a>
+  80224a:	83 fb 04             	cmp    $0x4,%ebx
+  80224d:	77 52                	ja     8022a1 <file_image+0x81>
+  80224f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802252:	a3 00 60 80 00       	mov    %eax,0x806000
+  802257:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  80225d:	83 ec 04             	sub    $0x4,%esp
+  802260:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802263:	c1 e0 02             	shl    $0x2,%eax
+  802266:	50                   	push   %eax
+  802267:	ff 75 0c             	push   0xc(%ebp)
+  80226a:	68 08 60 80 00       	push   $0x806008
+  80226f:	e8 6a e9 ff ff       	call   800bde <memmove>
+  802274:	ba 00 00 00 00       	mov    $0x0,%edx
+  802279:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80227e:	e8 0b fa ff ff       	call   801c8e <fsipc>
+  802283:	83 c4 10             	add    $0x10,%esp
+  802286:	85 c0                	test   %eax,%eax
+  802288:	78 0b                	js     802295 <file_image+0x75>
+  80228a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80228d:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802293:	89 0a                	mov    %ecx,(%edx)
+  802295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+  80229a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80229f:	eb f4                	jmp    802295 <file_image+0x75>
+  8022a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a6:	eb ed                	jmp    802295 <file_image+0x75>
+
+008022a8 <remove>:
+  8022a8:	55                   	push   %ebp
+  8022a9:	89 e5                	mov    %esp,%ebp
+  8022ab:	53                   	push   %ebx
+  8022ac:	83 ec 10             	sub    $0x10,%esp
+  8022af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022b2:	53                   	push   %ebx
+  8022b3:	e8 2a e7 ff ff       	call   8009e2 <strlen>
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022c0:	7f 25                	jg     8022e7 <remove+0x3f>
+  8022c2:	83 ec 08             	sub    $0x8,%esp
+  8022c5:	53                   	push   %ebx
+  8022c6:	68 00 60 80 00       	push   $0x806000
+  8022cb:	e8 5e e7 ff ff       	call   800a2e <strcpy>
+  8022d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022da:	e8 af f9 ff ff       	call   801c8e <fsipc>
+  8022df:	83 c4 10             	add    $0x10,%esp
+  8022e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+  8022e7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022ec:	eb f4                	jmp    8022e2 <remove+0x3a>
+
+008022ee <sync>:
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	83 ec 08             	sub    $0x8,%esp
+  8022f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022fe:	e8 8b f9 ff ff       	call   801c8e <fsipc>
+  802303:	c9                   	leave
+  802304:	c3                   	ret
+
+00802305 <devsock_stat>:
+  802305:	55                   	push   %ebp
+  802306:	89 e5                	mov    %esp,%ebp
+  802308:	83 ec 10             	sub    $0x10,%esp
+  80230b:	68 e8 37 80 00       	push   $0x8037e8
+  802310:	ff 75 0c             	push   0xc(%ebp)
+  802313:	e8 16 e7 ff ff       	call   800a2e <strcpy>
+  802318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231d:	c9                   	leave
+  80231e:	c3                   	ret
+
+0080231f <devsock_close>:
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	53                   	push   %ebx
+  802323:	83 ec 10             	sub    $0x10,%esp
+  802326:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802329:	53                   	push   %ebx
+  80232a:	e8 99 0d 00 00       	call   8030c8 <pageref>
+  80232f:	89 c2                	mov    %eax,%edx
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	b8 00 00 00 00       	mov    $0x0,%eax
+  802339:	83 fa 01             	cmp    $0x1,%edx
+  80233c:	74 05                	je     802343 <devsock_close+0x24>
+  80233e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802341:	c9                   	leave
+  802342:	c3                   	ret
+  802343:	83 ec 0c             	sub    $0xc,%esp
+  802346:	ff 73 0c             	push   0xc(%ebx)
+  802349:	e8 aa 02 00 00       	call   8025f8 <nsipc_close>
+  80234e:	83 c4 10             	add    $0x10,%esp
+  802351:	eb eb                	jmp    80233e <devsock_close+0x1f>
+
+00802353 <devsock_write>:
+  802353:	55                   	push   %ebp
+  802354:	89 e5                	mov    %esp,%ebp
+  802356:	83 ec 08             	sub    $0x8,%esp
+  802359:	6a 00                	push   $0x0
+  80235b:	ff 75 10             	push   0x10(%ebp)
+  80235e:	ff 75 0c             	push   0xc(%ebp)
+  802361:	8b 45 08             	mov    0x8(%ebp),%eax
+  802364:	ff 70 0c             	push   0xc(%eax)
+  802367:	e8 6c 03 00 00       	call   8026d8 <nsipc_send>
+  80236c:	c9                   	leave
+  80236d:	c3                   	ret
+
+0080236e <devsock_read>:
+  80236e:	55                   	push   %ebp
+  80236f:	89 e5                	mov    %esp,%ebp
+  802371:	83 ec 08             	sub    $0x8,%esp
+  802374:	6a 00                	push   $0x0
+  802376:	ff 75 10             	push   0x10(%ebp)
+  802379:	ff 75 0c             	push   0xc(%ebp)
+  80237c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237f:	ff 70 0c             	push   0xc(%eax)
+  802382:	e8 e2 02 00 00       	call   802669 <nsipc_recv>
+  802387:	c9                   	leave
+  802388:	c3                   	ret
+
+00802389 <fd2sockid>:
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	83 ec 20             	sub    $0x20,%esp
+  80238f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802392:	52                   	push   %edx
+  802393:	50                   	push   %eax
+  802394:	e8 da f3 ff ff       	call   801773 <fd_lookup>
+  802399:	83 c4 10             	add    $0x10,%esp
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	78 10                	js     8023b0 <fd2sockid+0x27>
+  8023a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a3:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8023a9:	39 08                	cmp    %ecx,(%eax)
+  8023ab:	75 05                	jne    8023b2 <fd2sockid+0x29>
+  8023ad:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023b0:	c9                   	leave
+  8023b1:	c3                   	ret
+  8023b2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023b7:	eb f7                	jmp    8023b0 <fd2sockid+0x27>
+
+008023b9 <alloc_sockfd>:
+  8023b9:	55                   	push   %ebp
+  8023ba:	89 e5                	mov    %esp,%ebp
+  8023bc:	56                   	push   %esi
+  8023bd:	53                   	push   %ebx
+  8023be:	83 ec 1c             	sub    $0x1c,%esp
+  8023c1:	89 c6                	mov    %eax,%esi
+  8023c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023c6:	50                   	push   %eax
+  8023c7:	e8 57 f3 ff ff       	call   801723 <fd_alloc>
+  8023cc:	89 c3                	mov    %eax,%ebx
+  8023ce:	83 c4 10             	add    $0x10,%esp
+  8023d1:	85 c0                	test   %eax,%eax
+  8023d3:	78 43                	js     802418 <alloc_sockfd+0x5f>
+  8023d5:	83 ec 04             	sub    $0x4,%esp
+  8023d8:	68 07 04 00 00       	push   $0x407
+  8023dd:	ff 75 f4             	push   -0xc(%ebp)
+  8023e0:	6a 00                	push   $0x0
+  8023e2:	e8 a7 ea ff ff       	call   800e8e <sys_page_alloc>
+  8023e7:	89 c3                	mov    %eax,%ebx
+  8023e9:	83 c4 10             	add    $0x10,%esp
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	78 28                	js     802418 <alloc_sockfd+0x5f>
+  8023f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f3:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8023f9:	89 10                	mov    %edx,(%eax)
+  8023fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023fe:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802405:	89 70 0c             	mov    %esi,0xc(%eax)
+  802408:	83 ec 0c             	sub    $0xc,%esp
+  80240b:	50                   	push   %eax
+  80240c:	e8 eb f2 ff ff       	call   8016fc <fd2num>
+  802411:	89 c3                	mov    %eax,%ebx
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	eb 0c                	jmp    802424 <alloc_sockfd+0x6b>
+  802418:	83 ec 0c             	sub    $0xc,%esp
+  80241b:	56                   	push   %esi
+  80241c:	e8 d7 01 00 00       	call   8025f8 <nsipc_close>
+  802421:	83 c4 10             	add    $0x10,%esp
+  802424:	89 d8                	mov    %ebx,%eax
+  802426:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802429:	5b                   	pop    %ebx
+  80242a:	5e                   	pop    %esi
+  80242b:	5d                   	pop    %ebp
+  80242c:	c3                   	ret
+
+0080242d <accept>:
+  80242d:	55                   	push   %ebp
+  80242e:	89 e5                	mov    %esp,%ebp
+  802430:	83 ec 08             	sub    $0x8,%esp
+  802433:	8b 45 08             	mov    0x8(%ebp),%eax
+  802436:	e8 4e ff ff ff       	call   802389 <fd2sockid>
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	78 1b                	js     80245a <accept+0x2d>
+  80243f:	83 ec 04             	sub    $0x4,%esp
+  802442:	ff 75 10             	push   0x10(%ebp)
+  802445:	ff 75 0c             	push   0xc(%ebp)
+  802448:	50                   	push   %eax
+  802449:	e8 07 01 00 00       	call   802555 <nsipc_accept>
+  80244e:	83 c4 10             	add    $0x10,%esp
+  802451:	85 c0                	test   %eax,%eax
+  802453:	78 05                	js     80245a <accept+0x2d>
+  802455:	e8 5f ff ff ff       	call   8023b9 <alloc_sockfd>
+  80245a:	c9                   	leave
+  80245b:	c3                   	ret
+
+0080245c <bind>:
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+  80245f:	83 ec 08             	sub    $0x8,%esp
+  802462:	8b 45 08             	mov    0x8(%ebp),%eax
+  802465:	e8 1f ff ff ff       	call   802389 <fd2sockid>
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	78 12                	js     802480 <bind+0x24>
+  80246e:	83 ec 04             	sub    $0x4,%esp
+  802471:	ff 75 10             	push   0x10(%ebp)
+  802474:	ff 75 0c             	push   0xc(%ebp)
+  802477:	50                   	push   %eax
+  802478:	e8 24 01 00 00       	call   8025a1 <nsipc_bind>
+  80247d:	83 c4 10             	add    $0x10,%esp
+  802480:	c9                   	leave
+  802481:	c3                   	ret
+
+00802482 <shutdown>:
+  802482:	55                   	push   %ebp
+  802483:	89 e5                	mov    %esp,%ebp
+  802485:	83 ec 08             	sub    $0x8,%esp
+  802488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248b:	e8 f9 fe ff ff       	call   802389 <fd2sockid>
+  802490:	85 c0                	test   %eax,%eax
+  802492:	78 0f                	js     8024a3 <shutdown+0x21>
+  802494:	83 ec 08             	sub    $0x8,%esp
+  802497:	ff 75 0c             	push   0xc(%ebp)
+  80249a:	50                   	push   %eax
+  80249b:	e8 36 01 00 00       	call   8025d6 <nsipc_shutdown>
+  8024a0:	83 c4 10             	add    $0x10,%esp
+  8024a3:	c9                   	leave
+  8024a4:	c3                   	ret
+
+008024a5 <connect>:
+  8024a5:	55                   	push   %ebp
+  8024a6:	89 e5                	mov    %esp,%ebp
+  8024a8:	83 ec 08             	sub    $0x8,%esp
+  8024ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ae:	e8 d6 fe ff ff       	call   802389 <fd2sockid>
+  8024b3:	85 c0                	test   %eax,%eax
+  8024b5:	78 12                	js     8024c9 <connect+0x24>
+  8024b7:	83 ec 04             	sub    $0x4,%esp
+  8024ba:	ff 75 10             	push   0x10(%ebp)
+  8024bd:	ff 75 0c             	push   0xc(%ebp)
+  8024c0:	50                   	push   %eax
+  8024c1:	e8 4c 01 00 00       	call   802612 <nsipc_connect>
+  8024c6:	83 c4 10             	add    $0x10,%esp
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+
+008024cb <listen>:
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	83 ec 08             	sub    $0x8,%esp
+  8024d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d4:	e8 b0 fe ff ff       	call   802389 <fd2sockid>
+  8024d9:	85 c0                	test   %eax,%eax
+  8024db:	78 0f                	js     8024ec <listen+0x21>
+  8024dd:	83 ec 08             	sub    $0x8,%esp
+  8024e0:	ff 75 0c             	push   0xc(%ebp)
+  8024e3:	50                   	push   %eax
+  8024e4:	e8 5e 01 00 00       	call   802647 <nsipc_listen>
+  8024e9:	83 c4 10             	add    $0x10,%esp
+  8024ec:	c9                   	leave
+  8024ed:	c3                   	ret
+
+008024ee <socket>:
+  8024ee:	55                   	push   %ebp
+  8024ef:	89 e5                	mov    %esp,%ebp
+  8024f1:	83 ec 0c             	sub    $0xc,%esp
+  8024f4:	ff 75 10             	push   0x10(%ebp)
+  8024f7:	ff 75 0c             	push   0xc(%ebp)
+  8024fa:	ff 75 08             	push   0x8(%ebp)
+  8024fd:	e8 34 02 00 00       	call   802736 <nsipc_socket>
+  802502:	83 c4 10             	add    $0x10,%esp
+  802505:	85 c0                	test   %eax,%eax
+  802507:	78 05                	js     80250e <socket+0x20>
+  802509:	e8 ab fe ff ff       	call   8023b9 <alloc_sockfd>
+  80250e:	c9                   	leave
+  80250f:	c3                   	ret
+
+00802510 <nsipc>:
+  802510:	55                   	push   %ebp
+  802511:	89 e5                	mov    %esp,%ebp
+  802513:	53                   	push   %ebx
+  802514:	83 ec 04             	sub    $0x4,%esp
+  802517:	89 c3                	mov    %eax,%ebx
+  802519:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802520:	74 1f                	je     802541 <nsipc+0x31>
+  802522:	83 ec 08             	sub    $0x8,%esp
+  802525:	6a 00                	push   $0x0
+  802527:	6a 00                	push   $0x0
+  802529:	6a 07                	push   $0x7
+  80252b:	68 00 70 80 00       	push   $0x807000
+  802530:	53                   	push   %ebx
+  802531:	ff 35 0c 50 80 00    	push   0x80500c
+  802537:	e8 d7 09 00 00       	call   802f13 <ipc_call>
+  80253c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80253f:	c9                   	leave
+  802540:	c3                   	ret
+  802541:	83 ec 0c             	sub    $0xc,%esp
+  802544:	6a 03                	push   $0x3
+  802546:	e8 63 0b 00 00       	call   8030ae <ipc_find_env>
+  80254b:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	eb cd                	jmp    802522 <nsipc+0x12>
+
+00802555 <nsipc_accept>:
+  802555:	55                   	push   %ebp
+  802556:	89 e5                	mov    %esp,%ebp
+  802558:	53                   	push   %ebx
+  802559:	83 ec 04             	sub    $0x4,%esp
+  80255c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802564:	b8 01 00 00 00       	mov    $0x1,%eax
+  802569:	e8 a2 ff ff ff       	call   802510 <nsipc>
+  80256e:	89 c3                	mov    %eax,%ebx
+  802570:	85 c0                	test   %eax,%eax
+  802572:	79 07                	jns    80257b <nsipc_accept+0x26>
+  802574:	89 d8                	mov    %ebx,%eax
+  802576:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802579:	c9                   	leave
+  80257a:	c3                   	ret
+  80257b:	83 ec 04             	sub    $0x4,%esp
+  80257e:	ff 35 10 70 80 00    	push   0x807010
+  802584:	68 00 70 80 00       	push   $0x807000
+  802589:	ff 75 0c             	push   0xc(%ebp)
+  80258c:	e8 4d e6 ff ff       	call   800bde <memmove>
+  802591:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802597:	8b 45 10             	mov    0x10(%ebp),%eax
+  80259a:	89 10                	mov    %edx,(%eax)
+  80259c:	83 c4 10             	add    $0x10,%esp
+  80259f:	eb d3                	jmp    802574 <nsipc_accept+0x1f>
+
+008025a1 <nsipc_bind>:
+  8025a1:	55                   	push   %ebp
+  8025a2:	89 e5                	mov    %esp,%ebp
+  8025a4:	53                   	push   %ebx
+  8025a5:	83 ec 08             	sub    $0x8,%esp
+  8025a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8025ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ae:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025b3:	53                   	push   %ebx
+  8025b4:	ff 75 0c             	push   0xc(%ebp)
+  8025b7:	68 04 70 80 00       	push   $0x807004
+  8025bc:	e8 1d e6 ff ff       	call   800bde <memmove>
+  8025c1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8025c7:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025cc:	e8 3f ff ff ff       	call   802510 <nsipc>
+  8025d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025d4:	c9                   	leave
+  8025d5:	c3                   	ret
+
+008025d6 <nsipc_shutdown>:
+  8025d6:	55                   	push   %ebp
+  8025d7:	89 e5                	mov    %esp,%ebp
+  8025d9:	83 ec 08             	sub    $0x8,%esp
+  8025dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025df:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e7:	a3 04 70 80 00       	mov    %eax,0x807004
+  8025ec:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025f1:	e8 1a ff ff ff       	call   802510 <nsipc>
+  8025f6:	c9                   	leave
+  8025f7:	c3                   	ret
+
+008025f8 <nsipc_close>:
+  8025f8:	55                   	push   %ebp
+  8025f9:	89 e5                	mov    %esp,%ebp
+  8025fb:	83 ec 08             	sub    $0x8,%esp
+  8025fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802601:	a3 00 70 80 00       	mov    %eax,0x807000
+  802606:	b8 04 00 00 00       	mov    $0x4,%eax
+  80260b:	e8 00 ff ff ff       	call   802510 <nsipc>
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+
+00802612 <nsipc_connect>:
+  802612:	55                   	push   %ebp
+  802613:	89 e5                	mov    %esp,%ebp
+  802615:	53                   	push   %ebx
+  802616:	83 ec 08             	sub    $0x8,%esp
+  802619:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80261c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802624:	53                   	push   %ebx
+  802625:	ff 75 0c             	push   0xc(%ebp)
+  802628:	68 04 70 80 00       	push   $0x807004
+  80262d:	e8 ac e5 ff ff       	call   800bde <memmove>
+  802632:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802638:	b8 05 00 00 00       	mov    $0x5,%eax
+  80263d:	e8 ce fe ff ff       	call   802510 <nsipc>
+  802642:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802645:	c9                   	leave
+  802646:	c3                   	ret
+
+00802647 <nsipc_listen>:
+  802647:	55                   	push   %ebp
+  802648:	89 e5                	mov    %esp,%ebp
+  80264a:	83 ec 08             	sub    $0x8,%esp
+  80264d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802650:	a3 00 70 80 00       	mov    %eax,0x807000
+  802655:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802658:	a3 04 70 80 00       	mov    %eax,0x807004
+  80265d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802662:	e8 a9 fe ff ff       	call   802510 <nsipc>
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+00802669 <nsipc_recv>:
+  802669:	55                   	push   %ebp
+  80266a:	89 e5                	mov    %esp,%ebp
+  80266c:	56                   	push   %esi
+  80266d:	53                   	push   %ebx
+  80266e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802671:	8b 45 08             	mov    0x8(%ebp),%eax
+  802674:	a3 00 70 80 00       	mov    %eax,0x807000
+  802679:	89 35 04 70 80 00    	mov    %esi,0x807004
+  80267f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802682:	a3 08 70 80 00       	mov    %eax,0x807008
+  802687:	b8 07 00 00 00       	mov    $0x7,%eax
+  80268c:	e8 7f fe ff ff       	call   802510 <nsipc>
+  802691:	89 c3                	mov    %eax,%ebx
+  802693:	85 c0                	test   %eax,%eax
+  802695:	78 22                	js     8026b9 <nsipc_recv+0x50>
+  802697:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80269c:	39 c6                	cmp    %eax,%esi
+  80269e:	0f 4e c6             	cmovle %esi,%eax
+  8026a1:	39 c3                	cmp    %eax,%ebx
+  8026a3:	7f 1d                	jg     8026c2 <nsipc_recv+0x59>
+  8026a5:	83 ec 04             	sub    $0x4,%esp
+  8026a8:	53                   	push   %ebx
+  8026a9:	68 00 70 80 00       	push   $0x807000
+  8026ae:	ff 75 0c             	push   0xc(%ebp)
+  8026b1:	e8 28 e5 ff ff       	call   800bde <memmove>
+  8026b6:	83 c4 10             	add    $0x10,%esp
+  8026b9:	89 d8                	mov    %ebx,%eax
+  8026bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026be:	5b                   	pop    %ebx
+  8026bf:	5e                   	pop    %esi
+  8026c0:	5d                   	pop    %ebp
+  8026c1:	c3                   	ret
+  8026c2:	68 f4 37 80 00       	push   $0x8037f4
+  8026c7:	68 09 38 80 00       	push   $0x803809
+  8026cc:	6a 60                	push   $0x60
+  8026ce:	68 1e 38 80 00       	push   $0x80381e
+  8026d3:	e8 84 db ff ff       	call   80025c <_panic>
+
+008026d8 <nsipc_send>:
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	53                   	push   %ebx
+  8026dc:	83 ec 04             	sub    $0x4,%esp
+  8026df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8026e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e5:	a3 00 70 80 00       	mov    %eax,0x807000
+  8026ea:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8026f0:	7f 2e                	jg     802720 <nsipc_send+0x48>
+  8026f2:	83 ec 04             	sub    $0x4,%esp
+  8026f5:	53                   	push   %ebx
+  8026f6:	ff 75 0c             	push   0xc(%ebp)
+  8026f9:	68 0c 70 80 00       	push   $0x80700c
+  8026fe:	e8 db e4 ff ff       	call   800bde <memmove>
+  802703:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  802709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80270c:	a3 08 70 80 00       	mov    %eax,0x807008
+  802711:	b8 08 00 00 00       	mov    $0x8,%eax
+  802716:	e8 f5 fd ff ff       	call   802510 <nsipc>
+  80271b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80271e:	c9                   	leave
+  80271f:	c3                   	ret
+  802720:	68 2a 38 80 00       	push   $0x80382a
+  802725:	68 09 38 80 00       	push   $0x803809
+  80272a:	6a 6b                	push   $0x6b
+  80272c:	68 1e 38 80 00       	push   $0x80381e
+  802731:	e8 26 db ff ff       	call   80025c <_panic>
+
+00802736 <nsipc_socket>:
+  802736:	55                   	push   %ebp
+  802737:	89 e5                	mov    %esp,%ebp
+  802739:	83 ec 08             	sub    $0x8,%esp
+  80273c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802744:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802747:	a3 04 70 80 00       	mov    %eax,0x807004
+  80274c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80274f:	a3 08 70 80 00       	mov    %eax,0x807008
+  802754:	b8 09 00 00 00       	mov    $0x9,%eax
+  802759:	e8 b2 fd ff ff       	call   802510 <nsipc>
+  80275e:	c9                   	leave
+  80275f:	c3                   	ret
+
+00802760 <devpipe_stat>:
+  802760:	55                   	push   %ebp
+  802761:	89 e5                	mov    %esp,%ebp
+  802763:	56                   	push   %esi
+  802764:	53                   	push   %ebx
+  802765:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802768:	83 ec 0c             	sub    $0xc,%esp
+  80276b:	ff 75 08             	push   0x8(%ebp)
+  80276e:	e8 99 ef ff ff       	call   80170c <fd2data>
+  802773:	89 c6                	mov    %eax,%esi
+  802775:	83 c4 08             	add    $0x8,%esp
+  802778:	68 36 38 80 00       	push   $0x803836
+  80277d:	53                   	push   %ebx
+  80277e:	e8 ab e2 ff ff       	call   800a2e <strcpy>
+  802783:	8b 46 04             	mov    0x4(%esi),%eax
+  802786:	2b 06                	sub    (%esi),%eax
+  802788:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  80278e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802795:	00 00 00 
+  802798:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80279f:	40 80 00 
+  8027a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027aa:	5b                   	pop    %ebx
+  8027ab:	5e                   	pop    %esi
+  8027ac:	5d                   	pop    %ebp
+  8027ad:	c3                   	ret
+
+008027ae <devpipe_close>:
+  8027ae:	55                   	push   %ebp
+  8027af:	89 e5                	mov    %esp,%ebp
+  8027b1:	53                   	push   %ebx
+  8027b2:	83 ec 0c             	sub    $0xc,%esp
+  8027b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027b8:	53                   	push   %ebx
+  8027b9:	6a 00                	push   $0x0
+  8027bb:	e8 a0 e7 ff ff       	call   800f60 <sys_page_unmap>
+  8027c0:	89 1c 24             	mov    %ebx,(%esp)
+  8027c3:	e8 44 ef ff ff       	call   80170c <fd2data>
+  8027c8:	83 c4 08             	add    $0x8,%esp
+  8027cb:	50                   	push   %eax
+  8027cc:	6a 00                	push   $0x0
+  8027ce:	e8 8d e7 ff ff       	call   800f60 <sys_page_unmap>
+  8027d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d6:	c9                   	leave
+  8027d7:	c3                   	ret
+
+008027d8 <_pipeisclosed>:
+  8027d8:	55                   	push   %ebp
+  8027d9:	89 e5                	mov    %esp,%ebp
+  8027db:	57                   	push   %edi
+  8027dc:	56                   	push   %esi
+  8027dd:	53                   	push   %ebx
+  8027de:	83 ec 1c             	sub    $0x1c,%esp
+  8027e1:	89 c7                	mov    %eax,%edi
+  8027e3:	89 d6                	mov    %edx,%esi
+  8027e5:	a1 10 50 80 00       	mov    0x805010,%eax
+  8027ea:	8b 58 58             	mov    0x58(%eax),%ebx
+  8027ed:	83 ec 0c             	sub    $0xc,%esp
+  8027f0:	57                   	push   %edi
+  8027f1:	e8 d2 08 00 00       	call   8030c8 <pageref>
+  8027f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027f9:	89 34 24             	mov    %esi,(%esp)
+  8027fc:	e8 c7 08 00 00       	call   8030c8 <pageref>
+  802801:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  802807:	8b 4a 58             	mov    0x58(%edx),%ecx
+  80280a:	83 c4 10             	add    $0x10,%esp
+  80280d:	39 cb                	cmp    %ecx,%ebx
+  80280f:	74 1b                	je     80282c <_pipeisclosed+0x54>
+  802811:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802814:	75 cf                	jne    8027e5 <_pipeisclosed+0xd>
+  802816:	8b 42 58             	mov    0x58(%edx),%eax
+  802819:	6a 01                	push   $0x1
+  80281b:	50                   	push   %eax
+  80281c:	53                   	push   %ebx
+  80281d:	68 3d 38 80 00       	push   $0x80383d
+  802822:	e8 10 db ff ff       	call   800337 <cprintf>
+  802827:	83 c4 10             	add    $0x10,%esp
+  80282a:	eb b9                	jmp    8027e5 <_pipeisclosed+0xd>
+  80282c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80282f:	0f 94 c0             	sete   %al
+  802832:	0f b6 c0             	movzbl %al,%eax
+  802835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802838:	5b                   	pop    %ebx
+  802839:	5e                   	pop    %esi
+  80283a:	5f                   	pop    %edi
+  80283b:	5d                   	pop    %ebp
+  80283c:	c3                   	ret
+
+0080283d <devpipe_write>:
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	57                   	push   %edi
+  802841:	56                   	push   %esi
+  802842:	53                   	push   %ebx
+  802843:	83 ec 28             	sub    $0x28,%esp
+  802846:	8b 75 08             	mov    0x8(%ebp),%esi
+  802849:	56                   	push   %esi
+  80284a:	e8 bd ee ff ff       	call   80170c <fd2data>
+  80284f:	89 c3                	mov    %eax,%ebx
+  802851:	83 c4 10             	add    $0x10,%esp
+  802854:	bf 00 00 00 00       	mov    $0x0,%edi
+  802859:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80285d:	74 5c                	je     8028bb <devpipe_write+0x7e>
+  80285f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802862:	8b 0b                	mov    (%ebx),%ecx
+  802864:	8d 51 20             	lea    0x20(%ecx),%edx
+  802867:	39 d0                	cmp    %edx,%eax
+  802869:	72 1e                	jb     802889 <devpipe_write+0x4c>
+  80286b:	89 da                	mov    %ebx,%edx
+  80286d:	89 f0                	mov    %esi,%eax
+  80286f:	e8 64 ff ff ff       	call   8027d8 <_pipeisclosed>
+  802874:	85 c0                	test   %eax,%eax
+  802876:	75 48                	jne    8028c0 <devpipe_write+0x83>
+  802878:	e8 c6 e5 ff ff       	call   800e43 <sys_yield>
+  80287d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802880:	8b 0b                	mov    (%ebx),%ecx
+  802882:	8d 51 20             	lea    0x20(%ecx),%edx
+  802885:	39 d0                	cmp    %edx,%eax
+  802887:	73 e2                	jae    80286b <devpipe_write+0x2e>
+  802889:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80288c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802890:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802893:	89 c2                	mov    %eax,%edx
+  802895:	c1 fa 1f             	sar    $0x1f,%edx
+  802898:	89 d1                	mov    %edx,%ecx
+  80289a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80289d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8028a0:	83 e2 1f             	and    $0x1f,%edx
+  8028a3:	29 ca                	sub    %ecx,%edx
+  8028a5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8028a9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  8028ad:	83 c0 01             	add    $0x1,%eax
+  8028b0:	89 43 04             	mov    %eax,0x4(%ebx)
+  8028b3:	83 c7 01             	add    $0x1,%edi
+  8028b6:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8028b9:	75 a4                	jne    80285f <devpipe_write+0x22>
+  8028bb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028be:	eb 05                	jmp    8028c5 <devpipe_write+0x88>
+  8028c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c8:	5b                   	pop    %ebx
+  8028c9:	5e                   	pop    %esi
+  8028ca:	5f                   	pop    %edi
+  8028cb:	5d                   	pop    %ebp
+  8028cc:	c3                   	ret
+
+008028cd <devpipe_read>:
+  8028cd:	55                   	push   %ebp
+  8028ce:	89 e5                	mov    %esp,%ebp
+  8028d0:	57                   	push   %edi
+  8028d1:	56                   	push   %esi
+  8028d2:	53                   	push   %ebx
+  8028d3:	83 ec 18             	sub    $0x18,%esp
+  8028d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028d9:	56                   	push   %esi
+  8028da:	e8 2d ee ff ff       	call   80170c <fd2data>
+  8028df:	89 c3                	mov    %eax,%ebx
+  8028e1:	83 c4 10             	add    $0x10,%esp
+  8028e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028ed:	74 45                	je     802934 <devpipe_read+0x67>
+  8028ef:	8b 03                	mov    (%ebx),%eax
+  8028f1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028f4:	75 1d                	jne    802913 <devpipe_read+0x46>
+  8028f6:	85 ff                	test   %edi,%edi
+  8028f8:	75 3f                	jne    802939 <devpipe_read+0x6c>
+  8028fa:	89 da                	mov    %ebx,%edx
+  8028fc:	89 f0                	mov    %esi,%eax
+  8028fe:	e8 d5 fe ff ff       	call   8027d8 <_pipeisclosed>
+  802903:	85 c0                	test   %eax,%eax
+  802905:	75 3c                	jne    802943 <devpipe_read+0x76>
+  802907:	e8 37 e5 ff ff       	call   800e43 <sys_yield>
+  80290c:	8b 03                	mov    (%ebx),%eax
+  80290e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802911:	74 e7                	je     8028fa <devpipe_read+0x2d>
+  802913:	99                   	cltd
+  802914:	c1 ea 1b             	shr    $0x1b,%edx
+  802917:	01 d0                	add    %edx,%eax
+  802919:	83 e0 1f             	and    $0x1f,%eax
+  80291c:	29 d0                	sub    %edx,%eax
+  80291e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802923:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802926:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  802929:	83 03 01             	addl   $0x1,(%ebx)
+  80292c:	83 c7 01             	add    $0x1,%edi
+  80292f:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  802932:	75 bb                	jne    8028ef <devpipe_read+0x22>
+  802934:	8b 45 10             	mov    0x10(%ebp),%eax
+  802937:	eb 02                	jmp    80293b <devpipe_read+0x6e>
+  802939:	89 f8                	mov    %edi,%eax
+  80293b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80293e:	5b                   	pop    %ebx
+  80293f:	5e                   	pop    %esi
+  802940:	5f                   	pop    %edi
+  802941:	5d                   	pop    %ebp
+  802942:	c3                   	ret
+  802943:	b8 00 00 00 00       	mov    $0x0,%eax
+  802948:	eb f1                	jmp    80293b <devpipe_read+0x6e>
+
+0080294a <pipe>:
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	56                   	push   %esi
+  80294e:	53                   	push   %ebx
+  80294f:	83 ec 1c             	sub    $0x1c,%esp
+  802952:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802955:	50                   	push   %eax
+  802956:	e8 c8 ed ff ff       	call   801723 <fd_alloc>
+  80295b:	89 c3                	mov    %eax,%ebx
+  80295d:	83 c4 10             	add    $0x10,%esp
+  802960:	85 c0                	test   %eax,%eax
+  802962:	0f 88 23 01 00 00    	js     802a8b <pipe+0x141>
+  802968:	83 ec 04             	sub    $0x4,%esp
+  80296b:	68 07 04 00 00       	push   $0x407
+  802970:	ff 75 f4             	push   -0xc(%ebp)
+  802973:	6a 00                	push   $0x0
+  802975:	e8 14 e5 ff ff       	call   800e8e <sys_page_alloc>
+  80297a:	89 c3                	mov    %eax,%ebx
+  80297c:	83 c4 10             	add    $0x10,%esp
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	0f 88 04 01 00 00    	js     802a8b <pipe+0x141>
+  802987:	83 ec 0c             	sub    $0xc,%esp
+  80298a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80298d:	50                   	push   %eax
+  80298e:	e8 90 ed ff ff       	call   801723 <fd_alloc>
+  802993:	89 c3                	mov    %eax,%ebx
+  802995:	83 c4 10             	add    $0x10,%esp
+  802998:	85 c0                	test   %eax,%eax
+  80299a:	0f 88 db 00 00 00    	js     802a7b <pipe+0x131>
+  8029a0:	83 ec 04             	sub    $0x4,%esp
+  8029a3:	68 07 04 00 00       	push   $0x407
+  8029a8:	ff 75 f0             	push   -0x10(%ebp)
+  8029ab:	6a 00                	push   $0x0
+  8029ad:	e8 dc e4 ff ff       	call   800e8e <sys_page_alloc>
+  8029b2:	89 c3                	mov    %eax,%ebx
+  8029b4:	83 c4 10             	add    $0x10,%esp
+  8029b7:	85 c0                	test   %eax,%eax
+  8029b9:	0f 88 bc 00 00 00    	js     802a7b <pipe+0x131>
+  8029bf:	83 ec 0c             	sub    $0xc,%esp
+  8029c2:	ff 75 f4             	push   -0xc(%ebp)
+  8029c5:	e8 42 ed ff ff       	call   80170c <fd2data>
+  8029ca:	89 c6                	mov    %eax,%esi
+  8029cc:	83 c4 0c             	add    $0xc,%esp
+  8029cf:	68 07 04 00 00       	push   $0x407
+  8029d4:	50                   	push   %eax
+  8029d5:	6a 00                	push   $0x0
+  8029d7:	e8 b2 e4 ff ff       	call   800e8e <sys_page_alloc>
+  8029dc:	89 c3                	mov    %eax,%ebx
+  8029de:	83 c4 10             	add    $0x10,%esp
+  8029e1:	85 c0                	test   %eax,%eax
+  8029e3:	0f 88 82 00 00 00    	js     802a6b <pipe+0x121>
+  8029e9:	83 ec 0c             	sub    $0xc,%esp
+  8029ec:	ff 75 f0             	push   -0x10(%ebp)
+  8029ef:	e8 18 ed ff ff       	call   80170c <fd2data>
+  8029f4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029fb:	50                   	push   %eax
+  8029fc:	6a 00                	push   $0x0
+  8029fe:	56                   	push   %esi
+  8029ff:	6a 00                	push   $0x0
+  802a01:	e8 cb e4 ff ff       	call   800ed1 <sys_page_map>
+  802a06:	89 c3                	mov    %eax,%ebx
+  802a08:	83 c4 20             	add    $0x20,%esp
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	78 4e                	js     802a5d <pipe+0x113>
+  802a0f:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802a14:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a17:	89 02                	mov    %eax,(%edx)
+  802a19:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a1c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802a23:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a26:	89 02                	mov    %eax,(%edx)
+  802a28:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802a2b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  802a32:	83 ec 0c             	sub    $0xc,%esp
+  802a35:	ff 75 f4             	push   -0xc(%ebp)
+  802a38:	e8 bf ec ff ff       	call   8016fc <fd2num>
+  802a3d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a40:	89 01                	mov    %eax,(%ecx)
+  802a42:	83 c4 04             	add    $0x4,%esp
+  802a45:	ff 75 f0             	push   -0x10(%ebp)
+  802a48:	e8 af ec ff ff       	call   8016fc <fd2num>
+  802a4d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a50:	89 41 04             	mov    %eax,0x4(%ecx)
+  802a53:	83 c4 10             	add    $0x10,%esp
+  802a56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a5b:	eb 2e                	jmp    802a8b <pipe+0x141>
+  802a5d:	83 ec 08             	sub    $0x8,%esp
+  802a60:	56                   	push   %esi
+  802a61:	6a 00                	push   $0x0
+  802a63:	e8 f8 e4 ff ff       	call   800f60 <sys_page_unmap>
+  802a68:	83 c4 10             	add    $0x10,%esp
+  802a6b:	83 ec 08             	sub    $0x8,%esp
+  802a6e:	ff 75 f0             	push   -0x10(%ebp)
+  802a71:	6a 00                	push   $0x0
+  802a73:	e8 e8 e4 ff ff       	call   800f60 <sys_page_unmap>
+  802a78:	83 c4 10             	add    $0x10,%esp
+  802a7b:	83 ec 08             	sub    $0x8,%esp
+  802a7e:	ff 75 f4             	push   -0xc(%ebp)
+  802a81:	6a 00                	push   $0x0
+  802a83:	e8 d8 e4 ff ff       	call   800f60 <sys_page_unmap>
+  802a88:	83 c4 10             	add    $0x10,%esp
+  802a8b:	89 d8                	mov    %ebx,%eax
+  802a8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a90:	5b                   	pop    %ebx
+  802a91:	5e                   	pop    %esi
+  802a92:	5d                   	pop    %ebp
+  802a93:	c3                   	ret
+
+00802a94 <pipeisclosed>:
+  802a94:	55                   	push   %ebp
+  802a95:	89 e5                	mov    %esp,%ebp
+  802a97:	83 ec 20             	sub    $0x20,%esp
+  802a9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a9d:	50                   	push   %eax
+  802a9e:	ff 75 08             	push   0x8(%ebp)
+  802aa1:	e8 cd ec ff ff       	call   801773 <fd_lookup>
+  802aa6:	83 c4 10             	add    $0x10,%esp
+  802aa9:	85 c0                	test   %eax,%eax
+  802aab:	78 18                	js     802ac5 <pipeisclosed+0x31>
+  802aad:	83 ec 0c             	sub    $0xc,%esp
+  802ab0:	ff 75 f4             	push   -0xc(%ebp)
+  802ab3:	e8 54 ec ff ff       	call   80170c <fd2data>
+  802ab8:	89 c2                	mov    %eax,%edx
+  802aba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802abd:	e8 16 fd ff ff       	call   8027d8 <_pipeisclosed>
+  802ac2:	83 c4 10             	add    $0x10,%esp
+  802ac5:	c9                   	leave
+  802ac6:	c3                   	ret
+
+00802ac7 <ipcring_init>:
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	53                   	push   %ebx
+  802acb:	83 ec 08             	sub    $0x8,%esp
+  802ace:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802ad1:	6a 60                	push   $0x60
+  802ad3:	6a 00                	push   $0x0
+  802ad5:	53                   	push   %ebx
+  802ad6:	e8 ce e0 ff ff       	call   800ba9 <memset>
+  802adb:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ae0:	8b 40 48             	mov    0x48(%eax),%eax
+  802ae3:	89 03                	mov    %eax,(%ebx)
+  802ae5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae8:	89 43 04             	mov    %eax,0x4(%ebx)
+  802aeb:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aee:	89 43 08             	mov    %eax,0x8(%ebx)
+  802af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802af7:	83 c4 10             	add    $0x10,%esp
+  802afa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afd:	c9                   	leave
+  802afe:	c3                   	ret
+
+00802aff <ipcring_req_slot>:
+  802aff:	55                   	push   %ebp
+  802b00:	89 e5                	mov    %esp,%ebp
+  802b02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b05:	8b 50 10             	mov    0x10(%eax),%edx
+  802b08:	8b 48 18             	mov    0x18(%eax),%ecx
+  802b0b:	29 ca                	sub    %ecx,%edx
+  802b0d:	83 fa 07             	cmp    $0x7,%edx
+  802b10:	77 0c                	ja     802b1e <ipcring_req_slot+0x1f>
+  802b12:	8b 50 10             	mov    0x10(%eax),%edx
+  802b15:	83 e2 07             	and    $0x7,%edx
+  802b18:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  802b1c:	5d                   	pop    %ebp
+  802b1d:	c3                   	ret
+  802b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b23:	eb f7                	jmp    802b1c <ipcring_req_slot+0x1d>
+
+00802b25 <ipcring_req_push>:
+  802b25:	55                   	push   %ebp
+  802b26:	89 e5                	mov    %esp,%ebp
+  802b28:	83 ec 08             	sub    $0x8,%esp
+  802b2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b2e:	8b 42 10             	mov    0x10(%edx),%eax
+  802b31:	83 c0 01             	add    $0x1,%eax
+  802b34:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  802b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3d:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802b41:	85 c0                	test   %eax,%eax
+  802b43:	75 02                	jne    802b47 <ipcring_req_push+0x22>
+  802b45:	c9                   	leave
+  802b46:	c3                   	ret
+  802b47:	6a 00                	push   $0x0
+  802b49:	68 00 00 80 ee       	push   $0xee800000
+  802b4e:	ff 72 08             	push   0x8(%edx)
+  802b51:	ff 72 04             	push   0x4(%edx)
+  802b54:	e8 6d e6 ff ff       	call   8011c6 <sys_ipc_send>
+  802b59:	83 c4 10             	add    $0x10,%esp
+  802b5c:	eb e7                	jmp    802b45 <ipcring_req_push+0x20>
+
+00802b5e <ipcring_rsp_wait>:
+  802b5e:	55                   	push   %ebp
+  802b5f:	89 e5                	mov    %esp,%ebp
+  802b61:	53                   	push   %ebx
+  802b62:	83 ec 04             	sub    $0x4,%esp
+  802b65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b68:	8b 53 18             	mov    0x18(%ebx),%edx
+  802b6b:	8b 43 10             	mov    0x10(%ebx),%eax
+  802b6e:	39 c2                	cmp    %eax,%edx
+  802b70:	74 3c                	je     802bae <ipcring_rsp_wait+0x50>
+  802b72:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b75:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b78:	39 c2                	cmp    %eax,%edx
+  802b7a:	75 23                	jne    802b9f <ipcring_rsp_wait+0x41>
+  802b7c:	83 ec 08             	sub    $0x8,%esp
+  802b7f:	6a 00                	push   $0x0
+  802b81:	6a 00                	push   $0x0
+  802b83:	6a 00                	push   $0x0
+  802b85:	6a 00                	push   $0x0
+  802b87:	ff 73 0c             	push   0xc(%ebx)
+  802b8a:	ff 73 04             	push   0x4(%ebx)
+  802b8d:	e8 81 03 00 00       	call   802f13 <ipc_call>
+  802b92:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b95:	8b 43 18             	mov    0x18(%ebx),%eax
+  802b98:	83 c4 20             	add    $0x20,%esp
+  802b9b:	39 c2                	cmp    %eax,%edx
+  802b9d:	74 dd                	je     802b7c <ipcring_rsp_wait+0x1e>
+  802b9f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ba2:	83 e0 07             	and    $0x7,%eax
+  802ba5:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802ba9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bac:	c9                   	leave
+  802bad:	c3                   	ret
+  802bae:	68 58 38 80 00       	push   $0x803858
+  802bb3:	68 09 38 80 00       	push   $0x803809
+  802bb8:	6a 3b                	push   $0x3b
+  802bba:	68 79 38 80 00       	push   $0x803879
+  802bbf:	e8 98 d6 ff ff       	call   80025c <_panic>
+
+00802bc4 <ipcring_rsp_pop>:
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bca:	8b 42 18             	mov    0x18(%edx),%eax
+  802bcd:	83 c0 01             	add    $0x1,%eax
+  802bd0:	89 42 18             	mov    %eax,0x18(%edx)
+  802bd3:	5d                   	pop    %ebp
+  802bd4:	c3                   	ret
+
+00802bd5 <ipcring_server_init>:
+  802bd5:	55                   	push   %ebp
+  802bd6:	89 e5                	mov    %esp,%ebp
+  802bd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bde:	89 10                	mov    %edx,(%eax)
+  802be0:	8b 55 10             	mov    0x10(%ebp),%edx
+  802be3:	89 50 04             	mov    %edx,0x4(%eax)
+  802be6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802bed:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802bf4:	5d                   	pop    %ebp
+  802bf5:	c3                   	ret
+
+00802bf6 <ipcring_req_avail>:
+  802bf6:	55                   	push   %ebp
+  802bf7:	89 e5                	mov    %esp,%ebp
+  802bf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bfc:	8b 02                	mov    (%edx),%eax
+  802bfe:	8b 40 10             	mov    0x10(%eax),%eax
+  802c01:	2b 42 08             	sub    0x8(%edx),%eax
+  802c04:	ba 08 00 00 00       	mov    $0x8,%edx
+  802c09:	39 d0                	cmp    %edx,%eax
+  802c0b:	0f 47 c2             	cmova  %edx,%eax
+  802c0e:	5d                   	pop    %ebp
+  802c0f:	c3                   	ret
+
+00802c10 <ipcring_req_peek>:
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c16:	8b 42 08             	mov    0x8(%edx),%eax
+  802c19:	83 e0 07             	and    $0x7,%eax
+  802c1c:	8b 12                	mov    (%edx),%edx
+  802c1e:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802c22:	5d                   	pop    %ebp
+  802c23:	c3                   	ret
+
+00802c24 <ipcring_rsp_push>:
+  802c24:	55                   	push   %ebp
+  802c25:	89 e5                	mov    %esp,%ebp
+  802c27:	83 ec 08             	sub    $0x8,%esp
+  802c2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c2d:	8b 41 08             	mov    0x8(%ecx),%eax
+  802c30:	83 c0 01             	add    $0x1,%eax
+  802c33:	89 41 08             	mov    %eax,0x8(%ecx)
+  802c36:	8b 11                	mov    (%ecx),%edx
+  802c38:	83 c2 14             	add    $0x14,%edx
+  802c3b:	f0 87 02             	lock xchg %eax,(%edx)
+  802c3e:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802c42:	75 02                	jne    802c46 <ipcring_rsp_push+0x22>
+  802c44:	c9                   	leave
+  802c45:	c3                   	ret
+  802c46:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802c4d:	6a 00                	push   $0x0
+  802c4f:	68 00 00 80 ee       	push   $0xee800000
+  802c54:	6a 00                	push   $0x0
+  802c56:	ff 71 04             	push   0x4(%ecx)
+  802c59:	e8 8b e4 ff ff       	call   8010e9 <sys_ipc_try_send>
+  802c5e:	83 c4 10             	add    $0x10,%esp
+  802c61:	eb e1                	jmp    802c44 <ipcring_rsp_push+0x20>
+
+00802c63 <ipcring_client_wait>:
+  802c63:	55                   	push   %ebp
+  802c64:	89 e5                	mov    %esp,%ebp
+  802c66:	83 ec 08             	sub    $0x8,%esp
+  802c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6c:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802c73:	8b 10                	mov    (%eax),%edx
+  802c75:	8b 52 18             	mov    0x18(%edx),%edx
+  802c78:	3b 50 08             	cmp    0x8(%eax),%edx
+  802c7b:	75 02                	jne    802c7f <ipcring_client_wait+0x1c>
+  802c7d:	c9                   	leave
+  802c7e:	c3                   	ret
+  802c7f:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802c86:	6a 00                	push   $0x0
+  802c88:	68 00 00 80 ee       	push   $0xee800000
+  802c8d:	6a 00                	push   $0x0
+  802c8f:	ff 70 04             	push   0x4(%eax)
+  802c92:	e8 52 e4 ff ff       	call   8010e9 <sys_ipc_try_send>
+  802c97:	83 c4 10             	add    $0x10,%esp
+  802c9a:	eb e1                	jmp    802c7d <ipcring_client_wait+0x1a>
+
+00802c9c <ipcring_server_sleep>:
+  802c9c:	55                   	push   %ebp
+  802c9d:	89 e5                	mov    %esp,%ebp
+  802c9f:	53                   	push   %ebx
+  802ca0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ca3:	8b 01                	mov    (%ecx),%eax
+  802ca5:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802ca8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cad:	f0 87 02             	lock xchg %eax,(%edx)
+  802cb0:	8b 11                	mov    (%ecx),%edx
+  802cb2:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802cb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cba:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802cbd:	74 0e                	je     802ccd <ipcring_server_sleep+0x31>
+  802cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc4:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ccd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd0:	c9                   	leave
+  802cd1:	c3                   	ret
+
+00802cd2 <devcons_close>:
+  802cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd7:	c3                   	ret
+
+00802cd8 <devcons_stat>:
+  802cd8:	55                   	push   %ebp
+  802cd9:	89 e5                	mov    %esp,%ebp
+  802cdb:	83 ec 10             	sub    $0x10,%esp
+  802cde:	68 87 38 80 00       	push   $0x803887
+  802ce3:	ff 75 0c             	push   0xc(%ebp)
+  802ce6:	e8 43 dd ff ff       	call   800a2e <strcpy>
+  802ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf0:	c9                   	leave
+  802cf1:	c3                   	ret
+
+00802cf2 <devcons_write>:
+  802cf2:	55                   	push   %ebp
+  802cf3:	89 e5                	mov    %esp,%ebp
+  802cf5:	57                   	push   %edi
+  802cf6:	56                   	push   %esi
+  802cf7:	53                   	push   %ebx
+  802cf8:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802cfe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802d01:	85 ff                	test   %edi,%edi
+  802d03:	74 51                	je     802d56 <devcons_write+0x64>
+  802d05:	be 00 00 00 00       	mov    $0x0,%esi
+  802d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0f:	89 fb                	mov    %edi,%ebx
+  802d11:	29 c3                	sub    %eax,%ebx
+  802d13:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802d18:	39 d3                	cmp    %edx,%ebx
+  802d1a:	0f 47 da             	cmova  %edx,%ebx
+  802d1d:	83 ec 04             	sub    $0x4,%esp
+  802d20:	53                   	push   %ebx
+  802d21:	03 45 0c             	add    0xc(%ebp),%eax
+  802d24:	50                   	push   %eax
+  802d25:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d2b:	50                   	push   %eax
+  802d2c:	e8 ad de ff ff       	call   800bde <memmove>
+  802d31:	83 c4 08             	add    $0x8,%esp
+  802d34:	53                   	push   %ebx
+  802d35:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802d3b:	50                   	push   %eax
+  802d3c:	e8 65 e0 ff ff       	call   800da6 <sys_cputs>
+  802d41:	01 de                	add    %ebx,%esi
+  802d43:	89 f0                	mov    %esi,%eax
+  802d45:	83 c4 10             	add    $0x10,%esp
+  802d48:	39 fe                	cmp    %edi,%esi
+  802d4a:	72 c3                	jb     802d0f <devcons_write+0x1d>
+  802d4c:	89 f0                	mov    %esi,%eax
+  802d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d51:	5b                   	pop    %ebx
+  802d52:	5e                   	pop    %esi
+  802d53:	5f                   	pop    %edi
+  802d54:	5d                   	pop    %ebp
+  802d55:	c3                   	ret
+  802d56:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5b:	eb ef                	jmp    802d4c <devcons_write+0x5a>
+
+00802d5d <devcons_read>:
+  802d5d:	55                   	push   %ebp
+  802d5e:	89 e5                	mov    %esp,%ebp
+  802d60:	83 ec 08             	sub    $0x8,%esp
+  802d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d68:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d6c:	75 07                	jne    802d75 <devcons_read+0x18>
+  802d6e:	eb 1f                	jmp    802d8f <devcons_read+0x32>
+  802d70:	e8 ce e0 ff ff       	call   800e43 <sys_yield>
+  802d75:	e8 4a e0 ff ff       	call   800dc4 <sys_cgetc>
+  802d7a:	85 c0                	test   %eax,%eax
+  802d7c:	74 f2                	je     802d70 <devcons_read+0x13>
+  802d7e:	78 0f                	js     802d8f <devcons_read+0x32>
+  802d80:	83 f8 04             	cmp    $0x4,%eax
+  802d83:	74 0c                	je     802d91 <devcons_read+0x34>
+  802d85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d88:	88 02                	mov    %al,(%edx)
+  802d8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d8f:	c9                   	leave
+  802d90:	c3                   	ret
+  802d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d96:	eb f7                	jmp    802d8f <devcons_read+0x32>
+
+00802d98 <cputchar>:
+  802d98:	55                   	push   %ebp
+  802d99:	89 e5                	mov    %esp,%ebp
+  802d9b:	83 ec 20             	sub    $0x20,%esp
+  802d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da1:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802da4:	6a 01                	push   $0x1
+  802da6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802da9:	50                   	push   %eax
+  802daa:	e8 f7 df ff ff       	call   800da6 <sys_cputs>
+  802daf:	83 c4 10             	add    $0x10,%esp
+  802db2:	c9                   	leave
+  802db3:	c3                   	ret
+
+00802db4 <getchar>:
+  802db4:	55                   	push   %ebp
+  802db5:	89 e5                	mov    %esp,%ebp
+  802db7:	83 ec 1c             	sub    $0x1c,%esp
+  802dba:	6a 01                	push   $0x1
+  802dbc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802dbf:	50                   	push   %eax
+  802dc0:	6a 00                	push   $0x0
+  802dc2:	e8 0e ec ff ff       	call   8019d5 <read>
+  802dc7:	83 c4 10             	add    $0x10,%esp
+  802dca:	85 c0                	test   %eax,%eax
+  802dcc:	78 06                	js     802dd4 <getchar+0x20>
+  802dce:	74 06                	je     802dd6 <getchar+0x22>
+  802dd0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802dd4:	c9                   	leave
+  802dd5:	c3                   	ret
+  802dd6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802ddb:	eb f7                	jmp    802dd4 <getchar+0x20>
+
+00802ddd <iscons>:
+  802ddd:	55                   	push   %ebp
+  802dde:	89 e5                	mov    %esp,%ebp
+  802de0:	83 ec 20             	sub    $0x20,%esp
+  802de3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802de6:	50                   	push   %eax
+  802de7:	ff 75 08             	push   0x8(%ebp)
+  802dea:	e8 84 e9 ff ff       	call   801773 <fd_lookup>
+  802def:	83 c4 10             	add    $0x10,%esp
+  802df2:	85 c0                	test   %eax,%eax
+  802df4:	78 11                	js     802e07 <iscons+0x2a>
+  802df6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802df9:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802dff:	39 10                	cmp    %edx,(%eax)
+  802e01:	0f 94 c0             	sete   %al
+  802e04:	0f b6 c0             	movzbl %al,%eax
+  802e07:	c9                   	leave
+  802e08:	c3                   	ret
+
+00802e09 <opencons>:
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	83 ec 24             	sub    $0x24,%esp
+  802e0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e12:	50                   	push   %eax
+  802e13:	e8 0b e9 ff ff       	call   801723 <fd_alloc>
+  802e18:	83 c4 10             	add    $0x10,%esp
+  802e1b:	85 c0                	test   %eax,%eax
+  802e1d:	78 3a                	js     802e59 <opencons+0x50>
+  802e1f:	83 ec 04             	sub    $0x4,%esp
+  802e22:	68 07 04 00 00       	push   $0x407
+  802e27:	ff 75 f4             	push   -0xc(%ebp)
+  802e2a:	6a 00                	push   $0x0
+  802e2c:	e8 5d e0 ff ff       	call   800e8e <sys_page_alloc>
+  802e31:	83 c4 10             	add    $0x10,%esp
+  802e34:	85 c0                	test   %eax,%eax
+  802e36:	78 21                	js     802e59 <opencons+0x50>
+  802e38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e3b:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802e41:	89 10                	mov    %edx,(%eax)
+  802e43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e46:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802e4d:	83 ec 0c             	sub    $0xc,%esp
+  802e50:	50                   	push   %eax
+  802e51:	e8 a6 e8 ff ff       	call   8016fc <fd2num>
+  802e56:	83 c4 10             	add    $0x10,%esp
+  802e59:	c9                   	leave
+  802e5a:	c3                   	ret
+
+00802e5b <ipc_recv>:
+  802e5b:	55                   	push   %ebp
+  802e5c:	89 e5                	mov    %esp,%ebp
+  802e5e:	56                   	push   %esi
+  802e5f:	53                   	push   %ebx
+  802e60:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802e70:	0f 44 c2             	cmove  %edx,%eax
+  802e73:	83 ec 0c             	sub    $0xc,%esp
+  802e76:	50                   	push   %eax
+  802e77:	e8 bd e2 ff ff       	call   801139 <sys_ipc_recv>
+  802e7c:	83 c4 10             	add    $0x10,%esp
+  802e7f:	85 c0                	test   %eax,%eax
+  802e81:	78 2a                	js     802ead <ipc_recv+0x52>
+  802e83:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e88:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802e8e:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802e94:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e9a:	85 f6                	test   %esi,%esi
+  802e9c:	74 02                	je     802ea0 <ipc_recv+0x45>
+  802e9e:	89 0e                	mov    %ecx,(%esi)
+  802ea0:	85 db                	test   %ebx,%ebx
+  802ea2:	74 02                	je     802ea6 <ipc_recv+0x4b>
+  802ea4:	89 13                	mov    %edx,(%ebx)
+  802ea6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ea9:	5b                   	pop    %ebx
+  802eaa:	5e                   	pop    %esi
+  802eab:	5d                   	pop    %ebp
+  802eac:	c3                   	ret
+  802ead:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eb7:	eb e1                	jmp    802e9a <ipc_recv+0x3f>
+
+00802eb9 <ipc_send>:
+  802eb9:	55                   	push   %ebp
+  802eba:	89 e5                	mov    %esp,%ebp
+  802ebc:	57                   	push   %edi
+  802ebd:	56                   	push   %esi
+  802ebe:	53                   	push   %ebx
+  802ebf:	83 ec 0c             	sub    $0xc,%esp
+  802ec2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802ec5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ec8:	8b 75 14             	mov    0x14(%ebp),%esi
+  802ecb:	85 db                	test   %ebx,%ebx
+  802ecd:	74 1e                	je     802eed <ipc_send+0x34>
+  802ecf:	56                   	push   %esi
+  802ed0:	53                   	push   %ebx
+  802ed1:	57                   	push   %edi
+  802ed2:	ff 75 08             	push   0x8(%ebp)
+  802ed5:	e8 ec e2 ff ff       	call   8011c6 <sys_ipc_send>
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	74 2a                	je     802f0b <ipc_send+0x52>
+  802ee1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ee4:	75 13                	jne    802ef9 <ipc_send+0x40>
+  802ee6:	e8 58 df ff ff       	call   800e43 <sys_yield>
+  802eeb:	eb e2                	jmp    802ecf <ipc_send+0x16>
+  802eed:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef2:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802ef7:	eb d6                	jmp    802ecf <ipc_send+0x16>
+  802ef9:	50                   	push   %eax
+  802efa:	68 94 38 80 00       	push   $0x803894
+  802eff:	6a 4f                	push   $0x4f
+  802f01:	68 d7 38 80 00       	push   $0x8038d7
+  802f06:	e8 51 d3 ff ff       	call   80025c <_panic>
+  802f0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f0e:	5b                   	pop    %ebx
+  802f0f:	5e                   	pop    %esi
+  802f10:	5f                   	pop    %edi
+  802f11:	5d                   	pop    %ebp
+  802f12:	c3                   	ret
+
+00802f13 <ipc_call>:
+  802f13:	55                   	push   %ebp
+  802f14:	89 e5                	mov    %esp,%ebp
+  802f16:	57                   	push   %edi
+  802f17:	56                   	push   %esi
+  802f18:	53                   	push   %ebx
+  802f19:	83 ec 0c             	sub    $0xc,%esp
+  802f1c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f20:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802f25:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802f29:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802f2d:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802f32:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802f36:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f3f:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802f43:	eb 05                	jmp    802f4a <ipc_call+0x37>
+  802f45:	e8 f9 de ff ff       	call   800e43 <sys_yield>
+  802f4a:	83 ec 0c             	sub    $0xc,%esp
+  802f4d:	56                   	push   %esi
+  802f4e:	53                   	push   %ebx
+  802f4f:	57                   	push   %edi
+  802f50:	ff 75 0c             	push   0xc(%ebp)
+  802f53:	ff 75 08             	push   0x8(%ebp)
+  802f56:	e8 bb e2 ff ff       	call   801216 <sys_ipc_call>
+  802f5b:	83 c4 20             	add    $0x20,%esp
+  802f5e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f61:	74 e2                	je     802f45 <ipc_call+0x32>
+  802f63:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802f66:	74 2d                	je     802f95 <ipc_call+0x82>
+  802f68:	85 c0                	test   %eax,%eax
+  802f6a:	78 4f                	js     802fbb <ipc_call+0xa8>
+  802f6c:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802f70:	74 10                	je     802f82 <ipc_call+0x6f>
+  802f72:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f77:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802f7d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802f80:	89 02                	mov    %eax,(%edx)
+  802f82:	a1 10 50 80 00       	mov    0x805010,%eax
+  802f87:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f90:	5b                   	pop    %ebx
+  802f91:	5e                   	pop    %esi
+  802f92:	5f                   	pop    %edi
+  802f93:	5d                   	pop    %ebp
+  802f94:	c3                   	ret
+  802f95:	ff 75 14             	push   0x14(%ebp)
+  802f98:	ff 75 10             	push   0x10(%ebp)
+  802f9b:	ff 75 0c             	push   0xc(%ebp)
+  802f9e:	ff 75 08             	push   0x8(%ebp)
+  802fa1:	e8 13 ff ff ff       	call   802eb9 <ipc_send>
+  802fa6:	83 c4 0c             	add    $0xc,%esp
+  802fa9:	ff 75 1c             	push   0x1c(%ebp)
+  802fac:	ff 75 18             	push   0x18(%ebp)
+  802faf:	6a 00                	push   $0x0
+  802fb1:	e8 a5 fe ff ff       	call   802e5b <ipc_recv>
+  802fb6:	83 c4 10             	add    $0x10,%esp
+  802fb9:	eb d2                	jmp    802f8d <ipc_call+0x7a>
+  802fbb:	50                   	push   %eax
+  802fbc:	68 e1 38 80 00       	push   $0x8038e1
+  802fc1:	6a 6d                	push   $0x6d
+  802fc3:	68 d7 38 80 00       	push   $0x8038d7
+  802fc8:	e8 8f d2 ff ff       	call   80025c <_panic>
+
+00802fcd <ipc_reply_recv>:
+  802fcd:	55                   	push   %ebp
+  802fce:	89 e5                	mov    %esp,%ebp
+  802fd0:	57                   	push   %edi
+  802fd1:	56                   	push   %esi
+  802fd2:	53                   	push   %ebx
+  802fd3:	83 ec 0c             	sub    $0xc,%esp
+  802fd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fd9:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802fdc:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802fdf:	85 db                	test   %ebx,%ebx
+  802fe1:	0f 84 ac 00 00 00    	je     803093 <ipc_reply_recv+0xc6>
+  802fe7:	85 f6                	test   %esi,%esi
+  802fe9:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802fee:	0f 45 c6             	cmovne %esi,%eax
+  802ff1:	83 ec 0c             	sub    $0xc,%esp
+  802ff4:	50                   	push   %eax
+  802ff5:	ff 75 14             	push   0x14(%ebp)
+  802ff8:	53                   	push   %ebx
+  802ff9:	ff 75 0c             	push   0xc(%ebp)
+  802ffc:	ff 75 08             	push   0x8(%ebp)
+  802fff:	e8 33 e2 ff ff       	call   801237 <sys_ipc_reply_recv>
+  803004:	83 c4 20             	add    $0x20,%esp
+  803007:	85 c0                	test   %eax,%eax
+  803009:	78 3a                	js     803045 <ipc_reply_recv+0x78>
+  80300b:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80300f:	74 10                	je     803021 <ipc_reply_recv+0x54>
+  803011:	a1 10 50 80 00       	mov    0x805010,%eax
+  803016:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  80301c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80301f:	89 02                	mov    %eax,(%edx)
+  803021:	85 ff                	test   %edi,%edi
+  803023:	74 0d                	je     803032 <ipc_reply_recv+0x65>
+  803025:	a1 10 50 80 00       	mov    0x805010,%eax
+  80302a:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  803030:	89 07                	mov    %eax,(%edi)
+  803032:	a1 10 50 80 00       	mov    0x805010,%eax
+  803037:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  80303d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803040:	5b                   	pop    %ebx
+  803041:	5e                   	pop    %esi
+  803042:	5f                   	pop    %edi
+  803043:	5d                   	pop    %ebp
+  803044:	c3                   	ret
+  803045:	ff 75 14             	push   0x14(%ebp)
+  803048:	53                   	push   %ebx
+  803049:	ff 75 0c             	push   0xc(%ebp)
+  80304c:	ff 75 08             	push   0x8(%ebp)
+  80304f:	e8 95 e0 ff ff       	call   8010e9 <sys_ipc_try_send>
+  803054:	89 c2                	mov    %eax,%edx
+  803056:	c1 ea 1f             	shr    $0x1f,%edx
+  803059:	83 c4 10             	add    $0x10,%esp
+  80305c:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80305f:	0f 95 c1             	setne  %cl
+  803062:	84 d1                	test   %dl,%cl
+  803064:	74 05                	je     80306b <ipc_reply_recv+0x9e>
+  803066:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803069:	75 12                	jne    80307d <ipc_reply_recv+0xb0>
+  80306b:	83 ec 04             	sub    $0x4,%esp
+  80306e:	57                   	push   %edi
+  80306f:	56                   	push   %esi
+  803070:	ff 75 18             	push   0x18(%ebp)
+  803073:	e8 e3 fd ff ff       	call   802e5b <ipc_recv>
+  803078:	83 c4 10             	add    $0x10,%esp
+  80307b:	eb c0                	jmp    80303d <ipc_reply_recv+0x70>
+  80307d:	83 ec 04             	sub    $0x4,%esp
+  803080:	50                   	push   %eax
+  803081:	ff 75 08             	push   0x8(%ebp)
+  803084:	68 b4 38 80 00       	push   $0x8038b4
+  803089:	e8 a9 d2 ff ff       	call   800337 <cprintf>
+  80308e:	83 c4 10             	add    $0x10,%esp
+  803091:	eb d8                	jmp    80306b <ipc_reply_recv+0x9e>
+  803093:	85 f6                	test   %esi,%esi
+  803095:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  80309a:	0f 45 c6             	cmovne %esi,%eax
+  80309d:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  8030a2:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  8030a9:	e9 43 ff ff ff       	jmp    802ff1 <ipc_reply_recv+0x24>
+
+008030ae <ipc_find_env>:
+  8030ae:	55                   	push   %ebp
+  8030af:	89 e5                	mov    %esp,%ebp
+  8030b1:	83 ec 14             	sub    $0x14,%esp
+  8030b4:	ff 75 08             	push   0x8(%ebp)
+  8030b7:	e8 cb df ff ff       	call   801087 <sys_env_service>
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c3:	0f 48 c2             	cmovs  %edx,%eax
+  8030c6:	c9                   	leave
+  8030c7:	c3                   	ret
+
+008030c8 <pageref>:
+  8030c8:	55                   	push   %ebp
+  8030c9:	89 e5                	mov    %esp,%ebp
+  8030cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ce:	89 c2                	mov    %eax,%edx
+  8030d0:	c1 ea 16             	shr    $0x16,%edx
+  8030d3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8030da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030df:	f6 c1 01             	test   $0x1,%cl
+  8030e2:	74 22                	je     803106 <pageref+0x3e>
+  8030e4:	c1 e8 0c             	shr    $0xc,%eax
+  8030e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030ee:	a8 01                	test   $0x1,%al
+  8030f0:	74 14                	je     803106 <pageref+0x3e>
+  8030f2:	c1 e8 0c             	shr    $0xc,%eax
+  8030f5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8030f8:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8030ff:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803103:	0f b7 d2             	movzwl %dx,%edx
+  803106:	89 d0                	mov    %edx,%eax
+  803108:	5d                   	pop    %ebp
+  803109:	c3                   	ret
+
+0080310a <__udivmoddi4>:
+  80310a:	55                   	push   %ebp
+  80310b:	57                   	push   %edi
+  80310c:	56                   	push   %esi
+  80310d:	53                   	push   %ebx
+  80310e:	83 ec 24             	sub    $0x24,%esp
+  803111:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803115:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803119:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80311d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803121:	8b 44 24 40          	mov    0x40(%esp),%eax
+  803125:	8b 54 24 44          	mov    0x44(%esp),%edx
+  803129:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80312d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803131:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  803135:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803144:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80314b:	00 
+  80314c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803153:	00 
+  803154:	89 fb                	mov    %edi,%ebx
+  803156:	eb 08                	jmp    803160 <__udivmoddi4+0x56>
+  803158:	83 e9 01             	sub    $0x1,%ecx
+  80315b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80315e:	74 68                	je     8031c8 <__udivmoddi4+0xbe>
+  803160:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803164:	01 c0                	add    %eax,%eax
+  803166:	89 c6                	mov    %eax,%esi
+  803168:	89 d7                	mov    %edx,%edi
+  80316a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80316e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803172:	0f ad d0             	shrd   %cl,%edx,%eax
+  803175:	d3 ea                	shr    %cl,%edx
+  803177:	f6 c1 20             	test   $0x20,%cl
+  80317a:	74 04                	je     803180 <__udivmoddi4+0x76>
+  80317c:	89 d0                	mov    %edx,%eax
+  80317e:	31 d2                	xor    %edx,%edx
+  803180:	83 e0 01             	and    $0x1,%eax
+  803183:	89 04 24             	mov    %eax,(%esp)
+  803186:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80318d:	00 
+  80318e:	8b 04 24             	mov    (%esp),%eax
+  803191:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803195:	09 f0                	or     %esi,%eax
+  803197:	09 fa                	or     %edi,%edx
+  803199:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80319d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8031a1:	39 f0                	cmp    %esi,%eax
+  8031a3:	89 d5                	mov    %edx,%ebp
+  8031a5:	19 fd                	sbb    %edi,%ebp
+  8031a7:	72 af                	jb     803158 <__udivmoddi4+0x4e>
+  8031a9:	29 f0                	sub    %esi,%eax
+  8031ab:	19 fa                	sbb    %edi,%edx
+  8031ad:	89 cf                	mov    %ecx,%edi
+  8031af:	c1 ef 05             	shr    $0x5,%edi
+  8031b2:	83 e7 01             	and    $0x1,%edi
+  8031b5:	89 fe                	mov    %edi,%esi
+  8031b7:	83 f6 01             	xor    $0x1,%esi
+  8031ba:	d3 e6                	shl    %cl,%esi
+  8031bc:	d3 e7                	shl    %cl,%edi
+  8031be:	09 74 24 18          	or     %esi,0x18(%esp)
+  8031c2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8031c6:	eb 90                	jmp    803158 <__udivmoddi4+0x4e>
+  8031c8:	85 db                	test   %ebx,%ebx
+  8031ca:	74 05                	je     8031d1 <__udivmoddi4+0xc7>
+  8031cc:	89 03                	mov    %eax,(%ebx)
+  8031ce:	89 53 04             	mov    %edx,0x4(%ebx)
+  8031d1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8031d5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8031d9:	83 c4 24             	add    $0x24,%esp
+  8031dc:	5b                   	pop    %ebx
+  8031dd:	5e                   	pop    %esi
+  8031de:	5f                   	pop    %edi
+  8031df:	5d                   	pop    %ebp
+  8031e0:	c3                   	ret
+
+008031e1 <__udivdi3>:
+  8031e1:	83 ec 08             	sub    $0x8,%esp
+  8031e4:	6a 00                	push   $0x0
+  8031e6:	ff 74 24 1c          	push   0x1c(%esp)
+  8031ea:	ff 74 24 1c          	push   0x1c(%esp)
+  8031ee:	ff 74 24 1c          	push   0x1c(%esp)
+  8031f2:	ff 74 24 1c          	push   0x1c(%esp)
+  8031f6:	e8 0f ff ff ff       	call   80310a <__udivmoddi4>
+  8031fb:	83 c4 1c             	add    $0x1c,%esp
+  8031fe:	c3                   	ret
+
+008031ff <__umoddi3>:
+  8031ff:	83 ec 18             	sub    $0x18,%esp
+  803202:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803206:	50                   	push   %eax
+  803207:	ff 74 24 2c          	push   0x2c(%esp)
+  80320b:	ff 74 24 2c          	push   0x2c(%esp)
+  80320f:	ff 74 24 2c          	push   0x2c(%esp)
+  803213:	ff 74 24 2c          	push   0x2c(%esp)
+  803217:	e8 ee fe ff ff       	call   80310a <__udivmoddi4>
+  80321c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803220:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803224:	83 c4 2c             	add    $0x2c,%esp
+  803227:	c3                   	ret
+
+00803228 <__divdi3>:
+  803228:	53                   	push   %ebx
+  803229:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80322d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803231:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803235:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803239:	85 d2                	test   %edx,%edx
+  80323b:	78 12                	js     80324f <__divdi3+0x27>
+  80323d:	85 db                	test   %ebx,%ebx
+  80323f:	78 2e                	js     80326f <__divdi3+0x47>
+  803241:	53                   	push   %ebx
+  803242:	51                   	push   %ecx
+  803243:	52                   	push   %edx
+  803244:	50                   	push   %eax
+  803245:	e8 97 ff ff ff       	call   8031e1 <__udivdi3>
+  80324a:	83 c4 10             	add    $0x10,%esp
+  80324d:	eb 1e                	jmp    80326d <__divdi3+0x45>
+  80324f:	f7 d8                	neg    %eax
+  803251:	83 d2 00             	adc    $0x0,%edx
+  803254:	f7 da                	neg    %edx
+  803256:	85 db                	test   %ebx,%ebx
+  803258:	78 2a                	js     803284 <__divdi3+0x5c>
+  80325a:	53                   	push   %ebx
+  80325b:	51                   	push   %ecx
+  80325c:	52                   	push   %edx
+  80325d:	50                   	push   %eax
+  80325e:	e8 7e ff ff ff       	call   8031e1 <__udivdi3>
+  803263:	83 c4 10             	add    $0x10,%esp
+  803266:	f7 d8                	neg    %eax
+  803268:	83 d2 00             	adc    $0x0,%edx
+  80326b:	f7 da                	neg    %edx
+  80326d:	5b                   	pop    %ebx
+  80326e:	c3                   	ret
+  80326f:	f7 d9                	neg    %ecx
+  803271:	83 d3 00             	adc    $0x0,%ebx
+  803274:	f7 db                	neg    %ebx
+  803276:	53                   	push   %ebx
+  803277:	51                   	push   %ecx
+  803278:	52                   	push   %edx
+  803279:	50                   	push   %eax
+  80327a:	e8 62 ff ff ff       	call   8031e1 <__udivdi3>
+  80327f:	83 c4 10             	add    $0x10,%esp
+  803282:	eb e2                	jmp    803266 <__divdi3+0x3e>
+  803284:	f7 d9                	neg    %ecx
+  803286:	83 d3 00             	adc    $0x0,%ebx
+  803289:	f7 db                	neg    %ebx
+  80328b:	53                   	push   %ebx
+  80328c:	51                   	push   %ecx
+  80328d:	52                   	push   %edx
+  80328e:	50                   	push   %eax
+  80328f:	e8 4d ff ff ff       	call   8031e1 <__udivdi3>
+  803294:	83 c4 10             	add    $0x10,%esp
+  803297:	eb d4                	jmp    80326d <__divdi3+0x45>
+
+00803299 <__moddi3>:
+  803299:	55                   	push   %ebp
+  80329a:	57                   	push   %edi
+  80329b:	56                   	push   %esi
+  80329c:	53                   	push   %ebx
+  80329d:	83 ec 0c             	sub    $0xc,%esp
+  8032a0:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  8032a4:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  8032a8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8032ac:	89 e9                	mov    %ebp,%ecx
+  8032ae:	f7 d9                	neg    %ecx
+  8032b0:	89 d0                	mov    %edx,%eax
+  8032b2:	83 d0 00             	adc    $0x0,%eax
+  8032b5:	f7 d8                	neg    %eax
+  8032b7:	0f 49 e9             	cmovns %ecx,%ebp
+  8032ba:	0f 49 d0             	cmovns %eax,%edx
+  8032bd:	52                   	push   %edx
+  8032be:	55                   	push   %ebp
+  8032bf:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8032c3:	f7 da                	neg    %edx
+  8032c5:	89 d8                	mov    %ebx,%eax
+  8032c7:	83 d0 00             	adc    $0x0,%eax
+  8032ca:	f7 d8                	neg    %eax
+  8032cc:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  8032d1:	89 54 24 08          	mov    %edx,0x8(%esp)
+  8032d5:	0f 48 c3             	cmovs  %ebx,%eax
+  8032d8:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  8032dc:	ff 74 24 0c          	push   0xc(%esp)
+  8032e0:	ff 74 24 0c          	push   0xc(%esp)
+  8032e4:	e8 16 ff ff ff       	call   8031ff <__umoddi3>
+  8032e9:	83 c4 10             	add    $0x10,%esp
+  8032ec:	85 db                	test   %ebx,%ebx
+  8032ee:	78 08                	js     8032f8 <__moddi3+0x5f>
+  8032f0:	83 c4 0c             	add    $0xc,%esp
+  8032f3:	5b                   	pop    %ebx
+  8032f4:	5e                   	pop    %esi
+  8032f5:	5f                   	pop    %edi
+  8032f6:	5d                   	pop    %ebp
+  8032f7:	c3                   	ret
+  8032f8:	f7 d8                	neg    %eax
+  8032fa:	83 d2 00             	adc    $0x0,%edx
+  8032fd:	f7 da                	neg    %edx
+  8032ff:	eb ef                	jmp    8032f0 <__moddi3+0x57>
@@ -0,0 +1,5064 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+  800020:	81 fc 00 e0 7f ee    	cmp    $0xee7fe000,%esp
+  800026:	75 04                	jne    80002c <args_exist>
+  800028:	6a 00                	push   $0x0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	a1 10 50 80 00       	mov    0x805010,%eax
+  80003f:	8b 40 48             	mov    0x48(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 c0 31 80 00       	push   $0x8031c0
+  800048:	e8 5b 01 00 00       	call   8001a8 <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800055:	e8 5a 0c 00 00       	call   800cb4 <sys_yield>
+  80005a:	a1 10 50 80 00       	mov    0x805010,%eax
+  80005f:	8b 40 48             	mov    0x48(%eax),%eax
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 e0 31 80 00       	push   $0x8031e0
+  80006c:	e8 37 01 00 00       	call   8001a8 <cprintf>
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+  80007c:	a1 10 50 80 00       	mov    0x805010,%eax
+  800081:	8b 40 48             	mov    0x48(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 0c 32 80 00       	push   $0x80320c
+  80008d:	e8 16 01 00 00       	call   8001a8 <cprintf>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8000a5:	e8 eb 0b 00 00       	call   800c95 <sys_getenvid>
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	69 c0 ac 01 00 00    	imul   $0x1ac,%eax,%eax
+  8000b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ba:	a3 10 50 80 00       	mov    %eax,0x805010
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x30>
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 40 80 00       	mov    %eax,0x804000
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 5f ff ff ff       	call   800033 <umain>
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+  8000e9:	a1 10 50 80 00       	mov    0x805010,%eax
+  8000ee:	8b 80 d4 00 00 00    	mov    0xd4(%eax),%eax
+  8000f4:	85 c0                	test   %eax,%eax
+  8000f6:	75 14                	jne    80010c <exit+0x29>
+  8000f8:	e8 3a 16 00 00       	call   801737 <close_all>
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	6a 00                	push   $0x0
+  800102:	e8 4d 0b 00 00       	call   800c54 <sys_env_destroy>
+  800107:	83 c4 10             	add    $0x10,%esp
+  80010a:	c9                   	leave
+  80010b:	c3                   	ret
+  80010c:	e8 b0 12 00 00       	call   8013c1 <sys_lease_complete>
+  800111:	eb e5                	jmp    8000f8 <exit+0x15>
+
+00800113 <putch>:
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	53                   	push   %ebx
+  800117:	83 ec 04             	sub    $0x4,%esp
+  80011a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80011d:	8b 13                	mov    (%ebx),%edx
+  80011f:	8d 42 01             	lea    0x1(%edx),%eax
+  800122:	89 03                	mov    %eax,(%ebx)
+  800124:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800127:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80012b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800130:	74 09                	je     80013b <putch+0x28>
+  800132:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+  800136:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800139:	c9                   	leave
+  80013a:	c3                   	ret
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	68 ff 00 00 00       	push   $0xff
+  800143:	8d 43 08             	lea    0x8(%ebx),%eax
+  800146:	50                   	push   %eax
+  800147:	e8 cb 0a 00 00       	call   800c17 <sys_cputs>
+  80014c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800152:	83 c4 10             	add    $0x10,%esp
+  800155:	eb db                	jmp    800132 <putch+0x1f>
+
+00800157 <vcprintf>:
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  800160:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800167:	00 00 00 
+  80016a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800171:	00 00 00 
+  800174:	ff 75 0c             	push   0xc(%ebp)
+  800177:	ff 75 08             	push   0x8(%ebp)
+  80017a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	68 13 01 80 00       	push   $0x800113
+  800186:	e8 1c 01 00 00       	call   8002a7 <vprintfmt>
+  80018b:	83 c4 08             	add    $0x8,%esp
+  80018e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800194:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80019a:	50                   	push   %eax
+  80019b:	e8 77 0a 00 00       	call   800c17 <sys_cputs>
+  8001a0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001a6:	c9                   	leave
+  8001a7:	c3                   	ret
+
+008001a8 <cprintf>:
+  8001a8:	55                   	push   %ebp
+  8001a9:	89 e5                	mov    %esp,%ebp
+  8001ab:	83 ec 10             	sub    $0x10,%esp
+  8001ae:	8d 45 0c             	lea    0xc(%ebp),%eax
+  8001b1:	50                   	push   %eax
+  8001b2:	ff 75 08             	push   0x8(%ebp)
+  8001b5:	e8 9d ff ff ff       	call   800157 <vcprintf>
+  8001ba:	c9                   	leave
+  8001bb:	c3                   	ret
+
+008001bc <printnum>:
+  8001bc:	55                   	push   %ebp
+  8001bd:	89 e5                	mov    %esp,%ebp
+  8001bf:	57                   	push   %edi
+  8001c0:	56                   	push   %esi
+  8001c1:	53                   	push   %ebx
+  8001c2:	83 ec 1c             	sub    $0x1c,%esp
+  8001c5:	89 c3                	mov    %eax,%ebx
+  8001c7:	89 d6                	mov    %edx,%esi
+  8001c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001cf:	89 d1                	mov    %edx,%ecx
+  8001d1:	89 c2                	mov    %eax,%edx
+  8001d3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001d6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001df:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001e6:	39 c2                	cmp    %eax,%edx
+  8001e8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001eb:	73 4b                	jae    800238 <printnum+0x7c>
+  8001ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8001f0:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8001f3:	85 ff                	test   %edi,%edi
+  8001f5:	7e 11                	jle    800208 <printnum+0x4c>
+  8001f7:	83 ec 08             	sub    $0x8,%esp
+  8001fa:	56                   	push   %esi
+  8001fb:	ff 75 18             	push   0x18(%ebp)
+  8001fe:	ff d3                	call   *%ebx
+  800200:	83 c4 10             	add    $0x10,%esp
+  800203:	83 ef 01             	sub    $0x1,%edi
+  800206:	75 ef                	jne    8001f7 <printnum+0x3b>
+  800208:	83 ec 08             	sub    $0x8,%esp
+  80020b:	56                   	push   %esi
+  80020c:	83 ec 04             	sub    $0x4,%esp
+  80020f:	ff 75 e4             	push   -0x1c(%ebp)
+  800212:	ff 75 e0             	push   -0x20(%ebp)
+  800215:	ff 75 dc             	push   -0x24(%ebp)
+  800218:	ff 75 d8             	push   -0x28(%ebp)
+  80021b:	e8 96 2e 00 00       	call   8030b6 <__umoddi3>
+  800220:	83 c4 14             	add    $0x14,%esp
+  800223:	0f be 80 35 32 80 00 	movsbl 0x803235(%eax),%eax
+  80022a:	50                   	push   %eax
+  80022b:	ff d3                	call   *%ebx
+  80022d:	83 c4 10             	add    $0x10,%esp
+  800230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800233:	5b                   	pop    %ebx
+  800234:	5e                   	pop    %esi
+  800235:	5f                   	pop    %edi
+  800236:	5d                   	pop    %ebp
+  800237:	c3                   	ret
+  800238:	83 ec 0c             	sub    $0xc,%esp
+  80023b:	ff 75 18             	push   0x18(%ebp)
+  80023e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800241:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800244:	52                   	push   %edx
+  800245:	50                   	push   %eax
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	ff 75 e4             	push   -0x1c(%ebp)
+  80024c:	ff 75 e0             	push   -0x20(%ebp)
+  80024f:	ff 75 dc             	push   -0x24(%ebp)
+  800252:	ff 75 d8             	push   -0x28(%ebp)
+  800255:	e8 3e 2e 00 00       	call   803098 <__udivdi3>
+  80025a:	83 c4 18             	add    $0x18,%esp
+  80025d:	52                   	push   %edx
+  80025e:	50                   	push   %eax
+  80025f:	89 f2                	mov    %esi,%edx
+  800261:	89 d8                	mov    %ebx,%eax
+  800263:	e8 54 ff ff ff       	call   8001bc <printnum>
+  800268:	83 c4 20             	add    $0x20,%esp
+  80026b:	eb 9b                	jmp    800208 <printnum+0x4c>
+
+0080026d <sprintputch>:
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800273:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  800277:	8b 10                	mov    (%eax),%edx
+  800279:	3b 50 04             	cmp    0x4(%eax),%edx
+  80027c:	73 0a                	jae    800288 <sprintputch+0x1b>
+  80027e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800281:	89 08                	mov    %ecx,(%eax)
+  800283:	8b 45 08             	mov    0x8(%ebp),%eax
+  800286:	88 02                	mov    %al,(%edx)
+  800288:	5d                   	pop    %ebp
+  800289:	c3                   	ret
+
+0080028a <printfmt>:
+  80028a:	55                   	push   %ebp
+  80028b:	89 e5                	mov    %esp,%ebp
+  80028d:	83 ec 08             	sub    $0x8,%esp
+  800290:	8d 45 14             	lea    0x14(%ebp),%eax
+  800293:	50                   	push   %eax
+  800294:	ff 75 10             	push   0x10(%ebp)
+  800297:	ff 75 0c             	push   0xc(%ebp)
+  80029a:	ff 75 08             	push   0x8(%ebp)
+  80029d:	e8 05 00 00 00       	call   8002a7 <vprintfmt>
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	c9                   	leave
+  8002a6:	c3                   	ret
+
+008002a7 <vprintfmt>:
+  8002a7:	55                   	push   %ebp
+  8002a8:	89 e5                	mov    %esp,%ebp
+  8002aa:	57                   	push   %edi
+  8002ab:	56                   	push   %esi
+  8002ac:	53                   	push   %ebx
+  8002ad:	83 ec 2c             	sub    $0x2c,%esp
+  8002b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002b3:	89 df                	mov    %ebx,%edi
+  8002b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002bb:	8d 70 01             	lea    0x1(%eax),%esi
+  8002be:	0f b6 00             	movzbl (%eax),%eax
+  8002c1:	83 f8 25             	cmp    $0x25,%eax
+  8002c4:	74 1e                	je     8002e4 <vprintfmt+0x3d>
+  8002c6:	85 c0                	test   %eax,%eax
+  8002c8:	0f 84 15 05 00 00    	je     8007e3 <vprintfmt+0x53c>
+  8002ce:	83 ec 08             	sub    $0x8,%esp
+  8002d1:	53                   	push   %ebx
+  8002d2:	50                   	push   %eax
+  8002d3:	ff d7                	call   *%edi
+  8002d5:	83 c6 01             	add    $0x1,%esi
+  8002d8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8002dc:	83 c4 10             	add    $0x10,%esp
+  8002df:	83 f8 25             	cmp    $0x25,%eax
+  8002e2:	75 e2                	jne    8002c6 <vprintfmt+0x1f>
+  8002e4:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+  8002e8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  8002ef:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8002f6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  8002fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800302:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800305:	8d 56 01             	lea    0x1(%esi),%edx
+  800308:	0f b6 0e             	movzbl (%esi),%ecx
+  80030b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80030e:	3c 55                	cmp    $0x55,%al
+  800310:	0f 87 3b 04 00 00    	ja     800751 <vprintfmt+0x4aa>
+  800316:	0f b6 c0             	movzbl %al,%eax
+  800319:	ff 24 85 80 33 80 00 	jmp    *0x803380(,%eax,4)
+  800320:	89 75 10             	mov    %esi,0x10(%ebp)
+  800323:	eb 93                	jmp    8002b8 <vprintfmt+0x11>
+  800325:	89 d6                	mov    %edx,%esi
+  800327:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80032b:	eb d8                	jmp    800305 <vprintfmt+0x5e>
+  80032d:	89 d6                	mov    %edx,%esi
+  80032f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800333:	eb d0                	jmp    800305 <vprintfmt+0x5e>
+  800335:	0f b6 c9             	movzbl %cl,%ecx
+  800338:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80033b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80033e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  800342:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800345:	83 f9 09             	cmp    $0x9,%ecx
+  800348:	77 6f                	ja     8003b9 <vprintfmt+0x112>
+  80034a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80034d:	83 c2 01             	add    $0x1,%edx
+  800350:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800353:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  800357:	0f be 02             	movsbl (%edx),%eax
+  80035a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80035d:	83 fe 09             	cmp    $0x9,%esi
+  800360:	76 eb                	jbe    80034d <vprintfmt+0xa6>
+  800362:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  800365:	89 d6                	mov    %edx,%esi
+  800367:	eb 13                	jmp    80037c <vprintfmt+0xd5>
+  800369:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036c:	8b 00                	mov    (%eax),%eax
+  80036e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800371:	8b 45 14             	mov    0x14(%ebp),%eax
+  800374:	8d 40 04             	lea    0x4(%eax),%eax
+  800377:	89 45 14             	mov    %eax,0x14(%ebp)
+  80037a:	89 d6                	mov    %edx,%esi
+  80037c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800380:	79 83                	jns    800305 <vprintfmt+0x5e>
+  800382:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800385:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800388:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80038f:	e9 71 ff ff ff       	jmp    800305 <vprintfmt+0x5e>
+  800394:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800397:	85 c9                	test   %ecx,%ecx
+  800399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039e:	0f 49 c1             	cmovns %ecx,%eax
+  8003a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003a4:	89 d6                	mov    %edx,%esi
+  8003a6:	e9 5a ff ff ff       	jmp    800305 <vprintfmt+0x5e>
+  8003ab:	89 d6                	mov    %edx,%esi
+  8003ad:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  8003b4:	e9 4c ff ff ff       	jmp    800305 <vprintfmt+0x5e>
+  8003b9:	89 d6                	mov    %edx,%esi
+  8003bb:	eb bf                	jmp    80037c <vprintfmt+0xd5>
+  8003bd:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8003c1:	89 d6                	mov    %edx,%esi
+  8003c3:	e9 3d ff ff ff       	jmp    800305 <vprintfmt+0x5e>
+  8003c8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ce:	8d 70 04             	lea    0x4(%eax),%esi
+  8003d1:	83 ec 08             	sub    $0x8,%esp
+  8003d4:	53                   	push   %ebx
+  8003d5:	ff 30                	push   (%eax)
+  8003d7:	ff d7                	call   *%edi
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	89 75 14             	mov    %esi,0x14(%ebp)
+  8003df:	e9 d4 fe ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  8003e4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8003e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ea:	8d 70 04             	lea    0x4(%eax),%esi
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	89 d0                	mov    %edx,%eax
+  8003f1:	f7 d8                	neg    %eax
+  8003f3:	0f 48 c2             	cmovs  %edx,%eax
+  8003f6:	83 f8 12             	cmp    $0x12,%eax
+  8003f9:	7f 23                	jg     80041e <vprintfmt+0x177>
+  8003fb:	8b 14 85 e0 34 80 00 	mov    0x8034e0(,%eax,4),%edx
+  800402:	85 d2                	test   %edx,%edx
+  800404:	74 18                	je     80041e <vprintfmt+0x177>
+  800406:	52                   	push   %edx
+  800407:	68 3b 36 80 00       	push   $0x80363b
+  80040c:	53                   	push   %ebx
+  80040d:	57                   	push   %edi
+  80040e:	e8 77 fe ff ff       	call   80028a <printfmt>
+  800413:	83 c4 10             	add    $0x10,%esp
+  800416:	89 75 14             	mov    %esi,0x14(%ebp)
+  800419:	e9 9a fe ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  80041e:	50                   	push   %eax
+  80041f:	68 4d 32 80 00       	push   $0x80324d
+  800424:	53                   	push   %ebx
+  800425:	57                   	push   %edi
+  800426:	e8 5f fe ff ff       	call   80028a <printfmt>
+  80042b:	83 c4 10             	add    $0x10,%esp
+  80042e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800431:	e9 82 fe ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  800436:	89 55 10             	mov    %edx,0x10(%ebp)
+  800439:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043c:	83 c0 04             	add    $0x4,%eax
+  80043f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800442:	8b 45 14             	mov    0x14(%ebp),%eax
+  800445:	8b 00                	mov    (%eax),%eax
+  800447:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80044a:	85 c0                	test   %eax,%eax
+  80044c:	0f 84 61 03 00 00    	je     8007b3 <vprintfmt+0x50c>
+  800452:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800456:	7e 06                	jle    80045e <vprintfmt+0x1b7>
+  800458:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80045c:	75 29                	jne    800487 <vprintfmt+0x1e0>
+  80045e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800461:	8d 70 01             	lea    0x1(%eax),%esi
+  800464:	0f b6 00             	movzbl (%eax),%eax
+  800467:	0f be d0             	movsbl %al,%edx
+  80046a:	85 d2                	test   %edx,%edx
+  80046c:	0f 84 bb 00 00 00    	je     80052d <vprintfmt+0x286>
+  800472:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800475:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800478:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80047b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80047e:	eb 7a                	jmp    8004fa <vprintfmt+0x253>
+  800480:	c7 45 d0 46 32 80 00 	movl   $0x803246,-0x30(%ebp)
+  800487:	83 ec 08             	sub    $0x8,%esp
+  80048a:	ff 75 d4             	push   -0x2c(%ebp)
+  80048d:	ff 75 d0             	push   -0x30(%ebp)
+  800490:	e8 e0 03 00 00       	call   800875 <strnlen>
+  800495:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800498:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80049b:	83 c4 10             	add    $0x10,%esp
+  80049e:	85 d2                	test   %edx,%edx
+  8004a0:	0f 8e d6 02 00 00    	jle    80077c <vprintfmt+0x4d5>
+  8004a6:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004aa:	83 ec 08             	sub    $0x8,%esp
+  8004ad:	53                   	push   %ebx
+  8004ae:	56                   	push   %esi
+  8004af:	ff d7                	call   *%edi
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  8004b4:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8004b8:	75 f0                	jne    8004aa <vprintfmt+0x203>
+  8004ba:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004bd:	8d 70 01             	lea    0x1(%eax),%esi
+  8004c0:	0f b6 00             	movzbl (%eax),%eax
+  8004c3:	0f be d0             	movsbl %al,%edx
+  8004c6:	85 d2                	test   %edx,%edx
+  8004c8:	0f 84 da 02 00 00    	je     8007a8 <vprintfmt+0x501>
+  8004ce:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004d1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004d4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004d7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004da:	eb 1e                	jmp    8004fa <vprintfmt+0x253>
+  8004dc:	83 ec 08             	sub    $0x8,%esp
+  8004df:	ff 75 0c             	push   0xc(%ebp)
+  8004e2:	52                   	push   %edx
+  8004e3:	ff 55 08             	call   *0x8(%ebp)
+  8004e6:	83 c4 10             	add    $0x10,%esp
+  8004e9:	83 eb 01             	sub    $0x1,%ebx
+  8004ec:	83 c6 01             	add    $0x1,%esi
+  8004ef:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f3:	0f be d0             	movsbl %al,%edx
+  8004f6:	85 d2                	test   %edx,%edx
+  8004f8:	74 2a                	je     800524 <vprintfmt+0x27d>
+  8004fa:	85 ff                	test   %edi,%edi
+  8004fc:	78 05                	js     800503 <vprintfmt+0x25c>
+  8004fe:	83 ef 01             	sub    $0x1,%edi
+  800501:	78 59                	js     80055c <vprintfmt+0x2b5>
+  800503:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800507:	74 d3                	je     8004dc <vprintfmt+0x235>
+  800509:	0f be c0             	movsbl %al,%eax
+  80050c:	83 e8 20             	sub    $0x20,%eax
+  80050f:	83 f8 5e             	cmp    $0x5e,%eax
+  800512:	76 c8                	jbe    8004dc <vprintfmt+0x235>
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	ff 75 0c             	push   0xc(%ebp)
+  80051a:	6a 3f                	push   $0x3f
+  80051c:	ff 55 08             	call   *0x8(%ebp)
+  80051f:	83 c4 10             	add    $0x10,%esp
+  800522:	eb c5                	jmp    8004e9 <vprintfmt+0x242>
+  800524:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800527:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80052a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80052d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800530:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800534:	7e 1b                	jle    800551 <vprintfmt+0x2aa>
+  800536:	83 ec 08             	sub    $0x8,%esp
+  800539:	53                   	push   %ebx
+  80053a:	6a 20                	push   $0x20
+  80053c:	ff d7                	call   *%edi
+  80053e:	83 c4 10             	add    $0x10,%esp
+  800541:	83 ee 01             	sub    $0x1,%esi
+  800544:	75 f0                	jne    800536 <vprintfmt+0x28f>
+  800546:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800549:	89 45 14             	mov    %eax,0x14(%ebp)
+  80054c:	e9 67 fd ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  800551:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800554:	89 45 14             	mov    %eax,0x14(%ebp)
+  800557:	e9 5c fd ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  80055c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80055f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800562:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800565:	eb c6                	jmp    80052d <vprintfmt+0x286>
+  800567:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80056a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80056d:	83 f9 01             	cmp    $0x1,%ecx
+  800570:	7f 1f                	jg     800591 <vprintfmt+0x2ea>
+  800572:	85 c9                	test   %ecx,%ecx
+  800574:	74 67                	je     8005dd <vprintfmt+0x336>
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8b 30                	mov    (%eax),%esi
+  80057b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80057e:	89 f0                	mov    %esi,%eax
+  800580:	c1 f8 1f             	sar    $0x1f,%eax
+  800583:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800586:	8b 45 14             	mov    0x14(%ebp),%eax
+  800589:	8d 40 04             	lea    0x4(%eax),%eax
+  80058c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058f:	eb 17                	jmp    8005a8 <vprintfmt+0x301>
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8b 50 04             	mov    0x4(%eax),%edx
+  800597:	8b 00                	mov    (%eax),%eax
+  800599:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005ae:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005b3:	85 c9                	test   %ecx,%ecx
+  8005b5:	0f 89 12 01 00 00    	jns    8006cd <vprintfmt+0x426>
+  8005bb:	83 ec 08             	sub    $0x8,%esp
+  8005be:	53                   	push   %ebx
+  8005bf:	6a 2d                	push   $0x2d
+  8005c1:	ff d7                	call   *%edi
+  8005c3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c9:	f7 da                	neg    %edx
+  8005cb:	83 d1 00             	adc    $0x0,%ecx
+  8005ce:	f7 d9                	neg    %ecx
+  8005d0:	83 c4 10             	add    $0x10,%esp
+  8005d3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8005d8:	e9 f0 00 00 00       	jmp    8006cd <vprintfmt+0x426>
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8b 30                	mov    (%eax),%esi
+  8005e2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005e5:	89 f0                	mov    %esi,%eax
+  8005e7:	c1 f8 1f             	sar    $0x1f,%eax
+  8005ea:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f6:	eb b0                	jmp    8005a8 <vprintfmt+0x301>
+  8005f8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005fb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005fe:	83 f9 01             	cmp    $0x1,%ecx
+  800601:	7f 1e                	jg     800621 <vprintfmt+0x37a>
+  800603:	85 c9                	test   %ecx,%ecx
+  800605:	74 32                	je     800639 <vprintfmt+0x392>
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 10                	mov    (%eax),%edx
+  80060c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800611:	8d 40 04             	lea    0x4(%eax),%eax
+  800614:	89 45 14             	mov    %eax,0x14(%ebp)
+  800617:	be 0a 00 00 00       	mov    $0xa,%esi
+  80061c:	e9 ac 00 00 00       	jmp    8006cd <vprintfmt+0x426>
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	8b 48 04             	mov    0x4(%eax),%ecx
+  800629:	8d 40 08             	lea    0x8(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800634:	e9 94 00 00 00       	jmp    8006cd <vprintfmt+0x426>
+  800639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063c:	8b 10                	mov    (%eax),%edx
+  80063e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800643:	8d 40 04             	lea    0x4(%eax),%eax
+  800646:	89 45 14             	mov    %eax,0x14(%ebp)
+  800649:	be 0a 00 00 00       	mov    $0xa,%esi
+  80064e:	eb 7d                	jmp    8006cd <vprintfmt+0x426>
+  800650:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800653:	89 55 10             	mov    %edx,0x10(%ebp)
+  800656:	83 f9 01             	cmp    $0x1,%ecx
+  800659:	7f 1b                	jg     800676 <vprintfmt+0x3cf>
+  80065b:	85 c9                	test   %ecx,%ecx
+  80065d:	74 2c                	je     80068b <vprintfmt+0x3e4>
+  80065f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800662:	8b 10                	mov    (%eax),%edx
+  800664:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800669:	8d 40 04             	lea    0x4(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066f:	be 08 00 00 00       	mov    $0x8,%esi
+  800674:	eb 57                	jmp    8006cd <vprintfmt+0x426>
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 10                	mov    (%eax),%edx
+  80067b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067e:	8d 40 08             	lea    0x8(%eax),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+  800684:	be 08 00 00 00       	mov    $0x8,%esi
+  800689:	eb 42                	jmp    8006cd <vprintfmt+0x426>
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800695:	8d 40 04             	lea    0x4(%eax),%eax
+  800698:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069b:	be 08 00 00 00       	mov    $0x8,%esi
+  8006a0:	eb 2b                	jmp    8006cd <vprintfmt+0x426>
+  8006a2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a5:	83 ec 08             	sub    $0x8,%esp
+  8006a8:	53                   	push   %ebx
+  8006a9:	6a 30                	push   $0x30
+  8006ab:	ff d7                	call   *%edi
+  8006ad:	83 c4 08             	add    $0x8,%esp
+  8006b0:	53                   	push   %ebx
+  8006b1:	6a 78                	push   $0x78
+  8006b3:	ff d7                	call   *%edi
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8b 10                	mov    (%eax),%edx
+  8006ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bf:	83 c4 10             	add    $0x10,%esp
+  8006c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c8:	be 10 00 00 00       	mov    $0x10,%esi
+  8006cd:	83 ec 0c             	sub    $0xc,%esp
+  8006d0:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8006d4:	50                   	push   %eax
+  8006d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8006d8:	56                   	push   %esi
+  8006d9:	51                   	push   %ecx
+  8006da:	52                   	push   %edx
+  8006db:	89 da                	mov    %ebx,%edx
+  8006dd:	89 f8                	mov    %edi,%eax
+  8006df:	e8 d8 fa ff ff       	call   8001bc <printnum>
+  8006e4:	83 c4 20             	add    $0x20,%esp
+  8006e7:	e9 cc fb ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  8006ec:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006ef:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f2:	83 f9 01             	cmp    $0x1,%ecx
+  8006f5:	7f 1b                	jg     800712 <vprintfmt+0x46b>
+  8006f7:	85 c9                	test   %ecx,%ecx
+  8006f9:	74 2c                	je     800727 <vprintfmt+0x480>
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 10                	mov    (%eax),%edx
+  800700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800705:	8d 40 04             	lea    0x4(%eax),%eax
+  800708:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070b:	be 10 00 00 00       	mov    $0x10,%esi
+  800710:	eb bb                	jmp    8006cd <vprintfmt+0x426>
+  800712:	8b 45 14             	mov    0x14(%ebp),%eax
+  800715:	8b 10                	mov    (%eax),%edx
+  800717:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071a:	8d 40 08             	lea    0x8(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800720:	be 10 00 00 00       	mov    $0x10,%esi
+  800725:	eb a6                	jmp    8006cd <vprintfmt+0x426>
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8b 10                	mov    (%eax),%edx
+  80072c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800731:	8d 40 04             	lea    0x4(%eax),%eax
+  800734:	89 45 14             	mov    %eax,0x14(%ebp)
+  800737:	be 10 00 00 00       	mov    $0x10,%esi
+  80073c:	eb 8f                	jmp    8006cd <vprintfmt+0x426>
+  80073e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	53                   	push   %ebx
+  800745:	6a 25                	push   $0x25
+  800747:	ff d7                	call   *%edi
+  800749:	83 c4 10             	add    $0x10,%esp
+  80074c:	e9 67 fb ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  800751:	83 ec 08             	sub    $0x8,%esp
+  800754:	53                   	push   %ebx
+  800755:	6a 25                	push   $0x25
+  800757:	ff d7                	call   *%edi
+  800759:	83 c4 10             	add    $0x10,%esp
+  80075c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800760:	0f 84 ba fb ff ff    	je     800320 <vprintfmt+0x79>
+  800766:	89 75 10             	mov    %esi,0x10(%ebp)
+  800769:	89 f0                	mov    %esi,%eax
+  80076b:	83 e8 01             	sub    $0x1,%eax
+  80076e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800772:	75 f7                	jne    80076b <vprintfmt+0x4c4>
+  800774:	89 45 10             	mov    %eax,0x10(%ebp)
+  800777:	e9 3c fb ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  80077c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80077f:	8d 70 01             	lea    0x1(%eax),%esi
+  800782:	0f b6 00             	movzbl (%eax),%eax
+  800785:	0f be d0             	movsbl %al,%edx
+  800788:	85 d2                	test   %edx,%edx
+  80078a:	74 11                	je     80079d <vprintfmt+0x4f6>
+  80078c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80078f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800792:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800795:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800798:	e9 5d fd ff ff       	jmp    8004fa <vprintfmt+0x253>
+  80079d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a3:	e9 10 fb ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  8007a8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ae:	e9 05 fb ff ff       	jmp    8002b8 <vprintfmt+0x11>
+  8007b3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007b7:	7e 0a                	jle    8007c3 <vprintfmt+0x51c>
+  8007b9:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007bd:	0f 85 bd fc ff ff    	jne    800480 <vprintfmt+0x1d9>
+  8007c3:	ba 28 00 00 00       	mov    $0x28,%edx
+  8007c8:	b8 28 00 00 00       	mov    $0x28,%eax
+  8007cd:	be 47 32 80 00       	mov    $0x803247,%esi
+  8007d2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007d5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007d8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007db:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007de:	e9 17 fd ff ff       	jmp    8004fa <vprintfmt+0x253>
+  8007e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e6:	5b                   	pop    %ebx
+  8007e7:	5e                   	pop    %esi
+  8007e8:	5f                   	pop    %edi
+  8007e9:	5d                   	pop    %ebp
+  8007ea:	c3                   	ret
+
+008007eb <vsnprintf>:
+  8007eb:	55                   	push   %ebp
+  8007ec:	89 e5                	mov    %esp,%ebp
+  8007ee:	83 ec 18             	sub    $0x18,%esp
+  8007f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007fa:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007fe:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800801:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  800808:	85 c0                	test   %eax,%eax
+  80080a:	74 26                	je     800832 <vsnprintf+0x47>
+  80080c:	85 d2                	test   %edx,%edx
+  80080e:	7e 22                	jle    800832 <vsnprintf+0x47>
+  800810:	ff 75 14             	push   0x14(%ebp)
+  800813:	ff 75 10             	push   0x10(%ebp)
+  800816:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800819:	50                   	push   %eax
+  80081a:	68 6d 02 80 00       	push   $0x80026d
+  80081f:	e8 83 fa ff ff       	call   8002a7 <vprintfmt>
+  800824:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800827:	c6 00 00             	movb   $0x0,(%eax)
+  80082a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80082d:	83 c4 10             	add    $0x10,%esp
+  800830:	c9                   	leave
+  800831:	c3                   	ret
+  800832:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800837:	eb f7                	jmp    800830 <vsnprintf+0x45>
+
+00800839 <snprintf>:
+  800839:	55                   	push   %ebp
+  80083a:	89 e5                	mov    %esp,%ebp
+  80083c:	83 ec 08             	sub    $0x8,%esp
+  80083f:	8d 45 14             	lea    0x14(%ebp),%eax
+  800842:	50                   	push   %eax
+  800843:	ff 75 10             	push   0x10(%ebp)
+  800846:	ff 75 0c             	push   0xc(%ebp)
+  800849:	ff 75 08             	push   0x8(%ebp)
+  80084c:	e8 9a ff ff ff       	call   8007eb <vsnprintf>
+  800851:	c9                   	leave
+  800852:	c3                   	ret
+
+00800853 <strlen>:
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	8b 55 08             	mov    0x8(%ebp),%edx
+  800859:	80 3a 00             	cmpb   $0x0,(%edx)
+  80085c:	74 10                	je     80086e <strlen+0x1b>
+  80085e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800863:	83 c0 01             	add    $0x1,%eax
+  800866:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80086a:	75 f7                	jne    800863 <strlen+0x10>
+  80086c:	5d                   	pop    %ebp
+  80086d:	c3                   	ret
+  80086e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800873:	eb f7                	jmp    80086c <strlen+0x19>
+
+00800875 <strnlen>:
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80087b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087e:	85 d2                	test   %edx,%edx
+  800880:	74 16                	je     800898 <strnlen+0x23>
+  800882:	b8 00 00 00 00       	mov    $0x0,%eax
+  800887:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80088b:	74 09                	je     800896 <strnlen+0x21>
+  80088d:	83 c0 01             	add    $0x1,%eax
+  800890:	39 d0                	cmp    %edx,%eax
+  800892:	75 f3                	jne    800887 <strnlen+0x12>
+  800894:	89 d0                	mov    %edx,%eax
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+  800898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089d:	eb f7                	jmp    800896 <strnlen+0x21>
+
+0080089f <strcpy>:
+  80089f:	55                   	push   %ebp
+  8008a0:	89 e5                	mov    %esp,%ebp
+  8008a2:	53                   	push   %ebx
+  8008a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008b2:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008b5:	83 c0 01             	add    $0x1,%eax
+  8008b8:	84 d2                	test   %dl,%dl
+  8008ba:	75 f2                	jne    8008ae <strcpy+0xf>
+  8008bc:	89 c8                	mov    %ecx,%eax
+  8008be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c1:	c9                   	leave
+  8008c2:	c3                   	ret
+
+008008c3 <strcat>:
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	53                   	push   %ebx
+  8008c7:	83 ec 10             	sub    $0x10,%esp
+  8008ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8008cd:	53                   	push   %ebx
+  8008ce:	e8 80 ff ff ff       	call   800853 <strlen>
+  8008d3:	83 c4 08             	add    $0x8,%esp
+  8008d6:	ff 75 0c             	push   0xc(%ebp)
+  8008d9:	01 d8                	add    %ebx,%eax
+  8008db:	50                   	push   %eax
+  8008dc:	e8 be ff ff ff       	call   80089f <strcpy>
+  8008e1:	89 d8                	mov    %ebx,%eax
+  8008e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e6:	c9                   	leave
+  8008e7:	c3                   	ret
+
+008008e8 <strncpy>:
+  8008e8:	55                   	push   %ebp
+  8008e9:	89 e5                	mov    %esp,%ebp
+  8008eb:	56                   	push   %esi
+  8008ec:	53                   	push   %ebx
+  8008ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008f6:	85 db                	test   %ebx,%ebx
+  8008f8:	74 17                	je     800911 <strncpy+0x29>
+  8008fa:	01 f3                	add    %esi,%ebx
+  8008fc:	89 f0                	mov    %esi,%eax
+  8008fe:	83 c0 01             	add    $0x1,%eax
+  800901:	0f b6 0a             	movzbl (%edx),%ecx
+  800904:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800907:	80 f9 01             	cmp    $0x1,%cl
+  80090a:	83 da ff             	sbb    $0xffffffff,%edx
+  80090d:	39 c3                	cmp    %eax,%ebx
+  80090f:	75 ed                	jne    8008fe <strncpy+0x16>
+  800911:	89 f0                	mov    %esi,%eax
+  800913:	5b                   	pop    %ebx
+  800914:	5e                   	pop    %esi
+  800915:	5d                   	pop    %ebp
+  800916:	c3                   	ret
+
+00800917 <strlcpy>:
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	56                   	push   %esi
+  80091b:	53                   	push   %ebx
+  80091c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800922:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800925:	89 f0                	mov    %esi,%eax
+  800927:	85 db                	test   %ebx,%ebx
+  800929:	74 1e                	je     800949 <strlcpy+0x32>
+  80092b:	83 eb 01             	sub    $0x1,%ebx
+  80092e:	74 16                	je     800946 <strlcpy+0x2f>
+  800930:	01 f3                	add    %esi,%ebx
+  800932:	0f b6 0a             	movzbl (%edx),%ecx
+  800935:	84 c9                	test   %cl,%cl
+  800937:	74 0d                	je     800946 <strlcpy+0x2f>
+  800939:	83 c2 01             	add    $0x1,%edx
+  80093c:	83 c0 01             	add    $0x1,%eax
+  80093f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  800942:	39 d8                	cmp    %ebx,%eax
+  800944:	75 ec                	jne    800932 <strlcpy+0x1b>
+  800946:	c6 00 00             	movb   $0x0,(%eax)
+  800949:	29 f0                	sub    %esi,%eax
+  80094b:	5b                   	pop    %ebx
+  80094c:	5e                   	pop    %esi
+  80094d:	5d                   	pop    %ebp
+  80094e:	c3                   	ret
+
+0080094f <strcmp>:
+  80094f:	55                   	push   %ebp
+  800950:	89 e5                	mov    %esp,%ebp
+  800952:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800955:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800958:	0f b6 01             	movzbl (%ecx),%eax
+  80095b:	84 c0                	test   %al,%al
+  80095d:	74 11                	je     800970 <strcmp+0x21>
+  80095f:	38 02                	cmp    %al,(%edx)
+  800961:	75 0d                	jne    800970 <strcmp+0x21>
+  800963:	83 c1 01             	add    $0x1,%ecx
+  800966:	83 c2 01             	add    $0x1,%edx
+  800969:	0f b6 01             	movzbl (%ecx),%eax
+  80096c:	84 c0                	test   %al,%al
+  80096e:	75 ef                	jne    80095f <strcmp+0x10>
+  800970:	0f b6 c0             	movzbl %al,%eax
+  800973:	0f b6 12             	movzbl (%edx),%edx
+  800976:	29 d0                	sub    %edx,%eax
+  800978:	5d                   	pop    %ebp
+  800979:	c3                   	ret
+
+0080097a <strncmp>:
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	53                   	push   %ebx
+  80097e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800981:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800984:	8b 55 10             	mov    0x10(%ebp),%edx
+  800987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098c:	85 d2                	test   %edx,%edx
+  80098e:	74 2e                	je     8009be <strncmp+0x44>
+  800990:	0f b6 01             	movzbl (%ecx),%eax
+  800993:	84 c0                	test   %al,%al
+  800995:	74 16                	je     8009ad <strncmp+0x33>
+  800997:	3a 03                	cmp    (%ebx),%al
+  800999:	75 12                	jne    8009ad <strncmp+0x33>
+  80099b:	83 c1 01             	add    $0x1,%ecx
+  80099e:	83 c3 01             	add    $0x1,%ebx
+  8009a1:	83 ea 01             	sub    $0x1,%edx
+  8009a4:	75 ea                	jne    800990 <strncmp+0x16>
+  8009a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ab:	eb 11                	jmp    8009be <strncmp+0x44>
+  8009ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b2:	85 d2                	test   %edx,%edx
+  8009b4:	74 08                	je     8009be <strncmp+0x44>
+  8009b6:	0f b6 01             	movzbl (%ecx),%eax
+  8009b9:	0f b6 13             	movzbl (%ebx),%edx
+  8009bc:	29 d0                	sub    %edx,%eax
+  8009be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+
+008009c3 <strchr>:
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  8009cd:	0f b6 10             	movzbl (%eax),%edx
+  8009d0:	84 d2                	test   %dl,%dl
+  8009d2:	74 15                	je     8009e9 <strchr+0x26>
+  8009d4:	38 d1                	cmp    %dl,%cl
+  8009d6:	74 0f                	je     8009e7 <strchr+0x24>
+  8009d8:	83 c0 01             	add    $0x1,%eax
+  8009db:	0f b6 10             	movzbl (%eax),%edx
+  8009de:	84 d2                	test   %dl,%dl
+  8009e0:	75 f2                	jne    8009d4 <strchr+0x11>
+  8009e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+  8009e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ee:	eb f7                	jmp    8009e7 <strchr+0x24>
+
+008009f0 <strfind>:
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	53                   	push   %ebx
+  8009f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009fa:	0f b6 18             	movzbl (%eax),%ebx
+  8009fd:	38 d3                	cmp    %dl,%bl
+  8009ff:	74 14                	je     800a15 <strfind+0x25>
+  800a01:	89 d1                	mov    %edx,%ecx
+  800a03:	84 db                	test   %bl,%bl
+  800a05:	74 0e                	je     800a15 <strfind+0x25>
+  800a07:	83 c0 01             	add    $0x1,%eax
+  800a0a:	0f b6 10             	movzbl (%eax),%edx
+  800a0d:	38 ca                	cmp    %cl,%dl
+  800a0f:	74 04                	je     800a15 <strfind+0x25>
+  800a11:	84 d2                	test   %dl,%dl
+  800a13:	75 f2                	jne    800a07 <strfind+0x17>
+  800a15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+
+00800a1a <memset>:
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	57                   	push   %edi
+  800a1e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a21:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a24:	85 c9                	test   %ecx,%ecx
+  800a26:	74 20                	je     800a48 <memset+0x2e>
+  800a28:	89 f8                	mov    %edi,%eax
+  800a2a:	09 c8                	or     %ecx,%eax
+  800a2c:	a8 03                	test   $0x3,%al
+  800a2e:	75 12                	jne    800a42 <memset+0x28>
+  800a30:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a34:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  800a3a:	c1 e9 02             	shr    $0x2,%ecx
+  800a3d:	fc                   	cld
+  800a3e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a40:	eb 06                	jmp    800a48 <memset+0x2e>
+  800a42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a45:	fc                   	cld
+  800a46:	f3 aa                	rep stos %al,%es:(%edi)
+  800a48:	89 f8                	mov    %edi,%eax
+  800a4a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a4d:	c9                   	leave
+  800a4e:	c3                   	ret
+
+00800a4f <memmove>:
+  800a4f:	55                   	push   %ebp
+  800a50:	89 e5                	mov    %esp,%ebp
+  800a52:	57                   	push   %edi
+  800a53:	56                   	push   %esi
+  800a54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a57:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a5a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800a5d:	39 c6                	cmp    %eax,%esi
+  800a5f:	73 32                	jae    800a93 <memmove+0x44>
+  800a61:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a64:	39 d0                	cmp    %edx,%eax
+  800a66:	73 2b                	jae    800a93 <memmove+0x44>
+  800a68:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+  800a6b:	89 d6                	mov    %edx,%esi
+  800a6d:	09 fe                	or     %edi,%esi
+  800a6f:	09 ce                	or     %ecx,%esi
+  800a71:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a77:	75 0e                	jne    800a87 <memmove+0x38>
+  800a79:	83 ef 04             	sub    $0x4,%edi
+  800a7c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a7f:	c1 e9 02             	shr    $0x2,%ecx
+  800a82:	fd                   	std
+  800a83:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a85:	eb 09                	jmp    800a90 <memmove+0x41>
+  800a87:	83 ef 01             	sub    $0x1,%edi
+  800a8a:	8d 72 ff             	lea    -0x1(%edx),%esi
+  800a8d:	fd                   	std
+  800a8e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800a90:	fc                   	cld
+  800a91:	eb 1a                	jmp    800aad <memmove+0x5e>
+  800a93:	89 f2                	mov    %esi,%edx
+  800a95:	09 c2                	or     %eax,%edx
+  800a97:	09 ca                	or     %ecx,%edx
+  800a99:	f6 c2 03             	test   $0x3,%dl
+  800a9c:	75 0a                	jne    800aa8 <memmove+0x59>
+  800a9e:	c1 e9 02             	shr    $0x2,%ecx
+  800aa1:	89 c7                	mov    %eax,%edi
+  800aa3:	fc                   	cld
+  800aa4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa6:	eb 05                	jmp    800aad <memmove+0x5e>
+  800aa8:	89 c7                	mov    %eax,%edi
+  800aaa:	fc                   	cld
+  800aab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  800aad:	5e                   	pop    %esi
+  800aae:	5f                   	pop    %edi
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <memcpy>:
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	83 ec 0c             	sub    $0xc,%esp
+  800ab7:	ff 75 10             	push   0x10(%ebp)
+  800aba:	ff 75 0c             	push   0xc(%ebp)
+  800abd:	ff 75 08             	push   0x8(%ebp)
+  800ac0:	e8 8a ff ff ff       	call   800a4f <memmove>
+  800ac5:	c9                   	leave
+  800ac6:	c3                   	ret
+
+00800ac7 <memcmp>:
+  800ac7:	55                   	push   %ebp
+  800ac8:	89 e5                	mov    %esp,%ebp
+  800aca:	56                   	push   %esi
+  800acb:	53                   	push   %ebx
+  800acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad2:	8b 75 10             	mov    0x10(%ebp),%esi
+  800ad5:	85 f6                	test   %esi,%esi
+  800ad7:	74 29                	je     800b02 <memcmp+0x3b>
+  800ad9:	01 c6                	add    %eax,%esi
+  800adb:	0f b6 08             	movzbl (%eax),%ecx
+  800ade:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae1:	38 d9                	cmp    %bl,%cl
+  800ae3:	75 11                	jne    800af6 <memcmp+0x2f>
+  800ae5:	83 c0 01             	add    $0x1,%eax
+  800ae8:	83 c2 01             	add    $0x1,%edx
+  800aeb:	39 c6                	cmp    %eax,%esi
+  800aed:	75 ec                	jne    800adb <memcmp+0x14>
+  800aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af4:	eb 08                	jmp    800afe <memcmp+0x37>
+  800af6:	0f b6 c1             	movzbl %cl,%eax
+  800af9:	0f b6 db             	movzbl %bl,%ebx
+  800afc:	29 d8                	sub    %ebx,%eax
+  800afe:	5b                   	pop    %ebx
+  800aff:	5e                   	pop    %esi
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+  800b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b07:	eb f5                	jmp    800afe <memcmp+0x37>
+
+00800b09 <memfind>:
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b12:	89 c2                	mov    %eax,%edx
+  800b14:	03 55 10             	add    0x10(%ebp),%edx
+  800b17:	39 d0                	cmp    %edx,%eax
+  800b19:	73 0d                	jae    800b28 <memfind+0x1f>
+  800b1b:	38 08                	cmp    %cl,(%eax)
+  800b1d:	74 0d                	je     800b2c <memfind+0x23>
+  800b1f:	83 c0 01             	add    $0x1,%eax
+  800b22:	39 c2                	cmp    %eax,%edx
+  800b24:	75 f5                	jne    800b1b <memfind+0x12>
+  800b26:	eb 06                	jmp    800b2e <memfind+0x25>
+  800b28:	89 c2                	mov    %eax,%edx
+  800b2a:	eb 02                	jmp    800b2e <memfind+0x25>
+  800b2c:	89 c2                	mov    %eax,%edx
+  800b2e:	89 d0                	mov    %edx,%eax
+  800b30:	5d                   	pop    %ebp
+  800b31:	c3                   	ret
+
+00800b32 <strtol>:
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	57                   	push   %edi
+  800b36:	56                   	push   %esi
+  800b37:	53                   	push   %ebx
+  800b38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b3e:	0f b6 02             	movzbl (%edx),%eax
+  800b41:	3c 20                	cmp    $0x20,%al
+  800b43:	74 04                	je     800b49 <strtol+0x17>
+  800b45:	3c 09                	cmp    $0x9,%al
+  800b47:	75 0e                	jne    800b57 <strtol+0x25>
+  800b49:	83 c2 01             	add    $0x1,%edx
+  800b4c:	0f b6 02             	movzbl (%edx),%eax
+  800b4f:	3c 20                	cmp    $0x20,%al
+  800b51:	74 f6                	je     800b49 <strtol+0x17>
+  800b53:	3c 09                	cmp    $0x9,%al
+  800b55:	74 f2                	je     800b49 <strtol+0x17>
+  800b57:	3c 2b                	cmp    $0x2b,%al
+  800b59:	74 2a                	je     800b85 <strtol+0x53>
+  800b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b60:	3c 2d                	cmp    $0x2d,%al
+  800b62:	74 2b                	je     800b8f <strtol+0x5d>
+  800b64:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b6a:	75 0f                	jne    800b7b <strtol+0x49>
+  800b6c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b6f:	74 28                	je     800b99 <strtol+0x67>
+  800b71:	85 db                	test   %ebx,%ebx
+  800b73:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b78:	0f 44 d8             	cmove  %eax,%ebx
+  800b7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b80:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b83:	eb 46                	jmp    800bcb <strtol+0x99>
+  800b85:	83 c2 01             	add    $0x1,%edx
+  800b88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b8d:	eb d5                	jmp    800b64 <strtol+0x32>
+  800b8f:	83 c2 01             	add    $0x1,%edx
+  800b92:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b97:	eb cb                	jmp    800b64 <strtol+0x32>
+  800b99:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b9d:	74 0e                	je     800bad <strtol+0x7b>
+  800b9f:	85 db                	test   %ebx,%ebx
+  800ba1:	75 d8                	jne    800b7b <strtol+0x49>
+  800ba3:	83 c2 01             	add    $0x1,%edx
+  800ba6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bab:	eb ce                	jmp    800b7b <strtol+0x49>
+  800bad:	83 c2 02             	add    $0x2,%edx
+  800bb0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bb5:	eb c4                	jmp    800b7b <strtol+0x49>
+  800bb7:	0f be c0             	movsbl %al,%eax
+  800bba:	83 e8 30             	sub    $0x30,%eax
+  800bbd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bc0:	7d 3a                	jge    800bfc <strtol+0xca>
+  800bc2:	83 c2 01             	add    $0x1,%edx
+  800bc5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bc9:	01 c1                	add    %eax,%ecx
+  800bcb:	0f b6 02             	movzbl (%edx),%eax
+  800bce:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bd1:	89 f3                	mov    %esi,%ebx
+  800bd3:	80 fb 09             	cmp    $0x9,%bl
+  800bd6:	76 df                	jbe    800bb7 <strtol+0x85>
+  800bd8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bdb:	89 f3                	mov    %esi,%ebx
+  800bdd:	80 fb 19             	cmp    $0x19,%bl
+  800be0:	77 08                	ja     800bea <strtol+0xb8>
+  800be2:	0f be c0             	movsbl %al,%eax
+  800be5:	83 e8 57             	sub    $0x57,%eax
+  800be8:	eb d3                	jmp    800bbd <strtol+0x8b>
+  800bea:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bed:	89 f3                	mov    %esi,%ebx
+  800bef:	80 fb 19             	cmp    $0x19,%bl
+  800bf2:	77 08                	ja     800bfc <strtol+0xca>
+  800bf4:	0f be c0             	movsbl %al,%eax
+  800bf7:	83 e8 37             	sub    $0x37,%eax
+  800bfa:	eb c1                	jmp    800bbd <strtol+0x8b>
+  800bfc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c00:	74 05                	je     800c07 <strtol+0xd5>
+  800c02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c05:	89 10                	mov    %edx,(%eax)
+  800c07:	89 c8                	mov    %ecx,%eax
+  800c09:	f7 d8                	neg    %eax
+  800c0b:	85 ff                	test   %edi,%edi
+  800c0d:	0f 45 c8             	cmovne %eax,%ecx
+  800c10:	89 c8                	mov    %ecx,%eax
+  800c12:	5b                   	pop    %ebx
+  800c13:	5e                   	pop    %esi
+  800c14:	5f                   	pop    %edi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <sys_cputs>:
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	56                   	push   %esi
+  800c1c:	53                   	push   %ebx
+  800c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c28:	89 c3                	mov    %eax,%ebx
+  800c2a:	89 c7                	mov    %eax,%edi
+  800c2c:	89 c6                	mov    %eax,%esi
+  800c2e:	cd 30                	int    $0x30
+  800c30:	5b                   	pop    %ebx
+  800c31:	5e                   	pop    %esi
+  800c32:	5f                   	pop    %edi
+  800c33:	5d                   	pop    %ebp
+  800c34:	c3                   	ret
+
+00800c35 <sys_cgetc>:
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	57                   	push   %edi
+  800c39:	56                   	push   %esi
+  800c3a:	53                   	push   %ebx
+  800c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c40:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c45:	89 d1                	mov    %edx,%ecx
+  800c47:	89 d3                	mov    %edx,%ebx
+  800c49:	89 d7                	mov    %edx,%edi
+  800c4b:	89 d6                	mov    %edx,%esi
+  800c4d:	cd 30                	int    $0x30
+  800c4f:	5b                   	pop    %ebx
+  800c50:	5e                   	pop    %esi
+  800c51:	5f                   	pop    %edi
+  800c52:	5d                   	pop    %ebp
+  800c53:	c3                   	ret
+
+00800c54 <sys_env_destroy>:
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	56                   	push   %esi
+  800c59:	53                   	push   %ebx
+  800c5a:	83 ec 0c             	sub    $0xc,%esp
+  800c5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c65:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c6a:	89 cb                	mov    %ecx,%ebx
+  800c6c:	89 cf                	mov    %ecx,%edi
+  800c6e:	89 ce                	mov    %ecx,%esi
+  800c70:	cd 30                	int    $0x30
+  800c72:	85 c0                	test   %eax,%eax
+  800c74:	7f 08                	jg     800c7e <sys_env_destroy+0x2a>
+  800c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c79:	5b                   	pop    %ebx
+  800c7a:	5e                   	pop    %esi
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  800c81:	50                   	push   %eax
+  800c82:	6a 03                	push   $0x3
+  800c84:	68 4b 35 80 00       	push   $0x80354b
+  800c89:	6a 24                	push   $0x24
+  800c8b:	68 68 35 80 00       	push   $0x803568
+  800c90:	e8 37 20 00 00       	call   802ccc <_panic>
+
+00800c95 <sys_getenvid>:
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	57                   	push   %edi
+  800c99:	56                   	push   %esi
+  800c9a:	53                   	push   %ebx
+  800c9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca5:	89 d1                	mov    %edx,%ecx
+  800ca7:	89 d3                	mov    %edx,%ebx
+  800ca9:	89 d7                	mov    %edx,%edi
+  800cab:	89 d6                	mov    %edx,%esi
+  800cad:	cd 30                	int    $0x30
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5f                   	pop    %edi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+
+00800cb4 <sys_yield>:
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	57                   	push   %edi
+  800cb8:	56                   	push   %esi
+  800cb9:	53                   	push   %ebx
+  800cba:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800cc1:	74 26                	je     800ce9 <sys_yield+0x35>
+  800cc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ccd:	89 d1                	mov    %edx,%ecx
+  800ccf:	89 d3                	mov    %edx,%ebx
+  800cd1:	89 d7                	mov    %edx,%edi
+  800cd3:	6a 00                	push   $0x0
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	8d 35 e0 0c 80 00    	lea    0x800ce0,%esi
+  800cde:	0f 34                	sysenter
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	83 c4 04             	add    $0x4,%esp
+  800ce4:	5b                   	pop    %ebx
+  800ce5:	5e                   	pop    %esi
+  800ce6:	5f                   	pop    %edi
+  800ce7:	5d                   	pop    %ebp
+  800ce8:	c3                   	ret
+  800ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cee:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf3:	89 d1                	mov    %edx,%ecx
+  800cf5:	89 d3                	mov    %edx,%ebx
+  800cf7:	89 d7                	mov    %edx,%edi
+  800cf9:	89 d6                	mov    %edx,%esi
+  800cfb:	cd 30                	int    $0x30
+  800cfd:	eb e5                	jmp    800ce4 <sys_yield+0x30>
+
+00800cff <sys_page_alloc>:
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	57                   	push   %edi
+  800d03:	56                   	push   %esi
+  800d04:	53                   	push   %ebx
+  800d05:	83 ec 0c             	sub    $0xc,%esp
+  800d08:	be 00 00 00 00       	mov    $0x0,%esi
+  800d0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d13:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1b:	89 f7                	mov    %esi,%edi
+  800d1d:	cd 30                	int    $0x30
+  800d1f:	85 c0                	test   %eax,%eax
+  800d21:	7f 08                	jg     800d2b <sys_page_alloc+0x2c>
+  800d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  800d2e:	50                   	push   %eax
+  800d2f:	6a 04                	push   $0x4
+  800d31:	68 4b 35 80 00       	push   $0x80354b
+  800d36:	6a 24                	push   $0x24
+  800d38:	68 68 35 80 00       	push   $0x803568
+  800d3d:	e8 8a 1f 00 00       	call   802ccc <_panic>
+
+00800d42 <sys_page_map>:
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	57                   	push   %edi
+  800d46:	56                   	push   %esi
+  800d47:	53                   	push   %ebx
+  800d48:	83 ec 0c             	sub    $0xc,%esp
+  800d4b:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800d52:	74 33                	je     800d87 <sys_page_map+0x45>
+  800d54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d62:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d65:	ff 75 18             	push   0x18(%ebp)
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	8d 35 73 0d 80 00    	lea    0x800d73,%esi
+  800d71:	0f 34                	sysenter
+  800d73:	5d                   	pop    %ebp
+  800d74:	83 c4 04             	add    $0x4,%esp
+  800d77:	89 c2                	mov    %eax,%edx
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7f 3d                	jg     800dba <sys_page_map+0x78>
+  800d7d:	89 d0                	mov    %edx,%eax
+  800d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+  800d87:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d95:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d98:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d9b:	cd 30                	int    $0x30
+  800d9d:	89 c2                	mov    %eax,%edx
+  800d9f:	85 c0                	test   %eax,%eax
+  800da1:	7e da                	jle    800d7d <sys_page_map+0x3b>
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  800da6:	50                   	push   %eax
+  800da7:	6a 05                	push   $0x5
+  800da9:	68 4b 35 80 00       	push   $0x80354b
+  800dae:	6a 24                	push   $0x24
+  800db0:	68 68 35 80 00       	push   $0x803568
+  800db5:	e8 12 1f 00 00       	call   802ccc <_panic>
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+  800dbd:	50                   	push   %eax
+  800dbe:	6a 05                	push   $0x5
+  800dc0:	68 4b 35 80 00       	push   $0x80354b
+  800dc5:	6a 48                	push   $0x48
+  800dc7:	68 68 35 80 00       	push   $0x803568
+  800dcc:	e8 fb 1e 00 00       	call   802ccc <_panic>
+
+00800dd1 <sys_page_unmap>:
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+  800dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dea:	89 df                	mov    %ebx,%edi
+  800dec:	89 de                	mov    %ebx,%esi
+  800dee:	cd 30                	int    $0x30
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	7f 08                	jg     800dfc <sys_page_unmap+0x2b>
+  800df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df7:	5b                   	pop    %ebx
+  800df8:	5e                   	pop    %esi
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+  800dff:	50                   	push   %eax
+  800e00:	6a 06                	push   $0x6
+  800e02:	68 4b 35 80 00       	push   $0x80354b
+  800e07:	6a 24                	push   $0x24
+  800e09:	68 68 35 80 00       	push   $0x803568
+  800e0e:	e8 b9 1e 00 00       	call   802ccc <_panic>
+
+00800e13 <sys_fork>:
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  800e23:	89 d1                	mov    %edx,%ecx
+  800e25:	89 d3                	mov    %edx,%ebx
+  800e27:	89 d7                	mov    %edx,%edi
+  800e29:	89 d6                	mov    %edx,%esi
+  800e2b:	cd 30                	int    $0x30
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+
+00800e32 <sys_env_set_status>:
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+  800e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e4b:	89 df                	mov    %ebx,%edi
+  800e4d:	89 de                	mov    %ebx,%esi
+  800e4f:	cd 30                	int    $0x30
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_env_set_status+0x2b>
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 08                	push   $0x8
+  800e63:	68 4b 35 80 00       	push   $0x80354b
+  800e68:	6a 24                	push   $0x24
+  800e6a:	68 68 35 80 00       	push   $0x803568
+  800e6f:	e8 58 1e 00 00       	call   802ccc <_panic>
+
+00800e74 <sys_env_set_trapframe>:
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+  800e7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e88:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e8d:	89 df                	mov    %ebx,%edi
+  800e8f:	89 de                	mov    %ebx,%esi
+  800e91:	cd 30                	int    $0x30
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 08                	jg     800e9f <sys_env_set_trapframe+0x2b>
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	50                   	push   %eax
+  800ea3:	6a 09                	push   $0x9
+  800ea5:	68 4b 35 80 00       	push   $0x80354b
+  800eaa:	6a 24                	push   $0x24
+  800eac:	68 68 35 80 00       	push   $0x803568
+  800eb1:	e8 16 1e 00 00       	call   802ccc <_panic>
+
+00800eb6 <sys_env_set_cow>:
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+  800ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eca:	b8 20 00 00 00       	mov    $0x20,%eax
+  800ecf:	89 df                	mov    %ebx,%edi
+  800ed1:	89 de                	mov    %ebx,%esi
+  800ed3:	cd 30                	int    $0x30
+  800ed5:	85 c0                	test   %eax,%eax
+  800ed7:	7f 08                	jg     800ee1 <sys_env_set_cow+0x2b>
+  800ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+  800ee4:	50                   	push   %eax
+  800ee5:	6a 20                	push   $0x20
+  800ee7:	68 4b 35 80 00       	push   $0x80354b
+  800eec:	6a 24                	push   $0x24
+  800eee:	68 68 35 80 00       	push   $0x803568
+  800ef3:	e8 d4 1d 00 00       	call   802ccc <_panic>
+
+00800ef8 <sys_env_service>:
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	57                   	push   %edi
+  800efc:	56                   	push   %esi
+  800efd:	53                   	push   %ebx
+  800efe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	b8 21 00 00 00       	mov    $0x21,%eax
+  800f0b:	89 cb                	mov    %ecx,%ebx
+  800f0d:	89 cf                	mov    %ecx,%edi
+  800f0f:	89 ce                	mov    %ecx,%esi
+  800f11:	cd 30                	int    $0x30
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+
+00800f18 <sys_env_set_pgfault_upcall>:
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+  800f1b:	57                   	push   %edi
+  800f1c:	56                   	push   %esi
+  800f1d:	53                   	push   %ebx
+  800f1e:	83 ec 0c             	sub    $0xc,%esp
+  800f21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f31:	89 df                	mov    %ebx,%edi
+  800f33:	89 de                	mov    %ebx,%esi
+  800f35:	cd 30                	int    $0x30
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	7f 08                	jg     800f43 <sys_env_set_pgfault_upcall+0x2b>
+  800f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+  800f43:	83 ec 0c             	sub    $0xc,%esp
+  800f46:	50                   	push   %eax
+  800f47:	6a 0a                	push   $0xa
+  800f49:	68 4b 35 80 00       	push   $0x80354b
+  800f4e:	6a 24                	push   $0x24
+  800f50:	68 68 35 80 00       	push   $0x803568
+  800f55:	e8 72 1d 00 00       	call   802ccc <_panic>
+
+00800f5a <sys_ipc_try_send>:
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	56                   	push   %esi
+  800f5f:	53                   	push   %ebx
+  800f60:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800f67:	74 27                	je     800f90 <sys_ipc_try_send+0x36>
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f77:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f7a:	6a 00                	push   $0x0
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	8d 35 87 0f 80 00    	lea    0x800f87,%esi
+  800f85:	0f 34                	sysenter
+  800f87:	5d                   	pop    %ebp
+  800f88:	83 c4 04             	add    $0x4,%esp
+  800f8b:	5b                   	pop    %ebx
+  800f8c:	5e                   	pop    %esi
+  800f8d:	5f                   	pop    %edi
+  800f8e:	5d                   	pop    %ebp
+  800f8f:	c3                   	ret
+  800f90:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f95:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa6:	cd 30                	int    $0x30
+  800fa8:	eb e1                	jmp    800f8b <sys_ipc_try_send+0x31>
+
+00800faa <sys_ipc_recv>:
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	56                   	push   %esi
+  800faf:	53                   	push   %ebx
+  800fb0:	83 ec 0c             	sub    $0xc,%esp
+  800fb3:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  800fba:	74 32                	je     800fee <sys_ipc_recv+0x44>
+  800fbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fc9:	89 cb                	mov    %ecx,%ebx
+  800fcb:	89 cf                	mov    %ecx,%edi
+  800fcd:	6a 00                	push   $0x0
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	8d 35 da 0f 80 00    	lea    0x800fda,%esi
+  800fd8:	0f 34                	sysenter
+  800fda:	5d                   	pop    %ebp
+  800fdb:	83 c4 04             	add    $0x4,%esp
+  800fde:	89 c2                	mov    %eax,%edx
+  800fe0:	85 c0                	test   %eax,%eax
+  800fe2:	7f 3c                	jg     801020 <sys_ipc_recv+0x76>
+  800fe4:	89 d0                	mov    %edx,%eax
+  800fe6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+  800fee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	89 cb                	mov    %ecx,%ebx
+  800ffd:	89 cf                	mov    %ecx,%edi
+  800fff:	89 ce                	mov    %ecx,%esi
+  801001:	cd 30                	int    $0x30
+  801003:	89 c2                	mov    %eax,%edx
+  801005:	85 c0                	test   %eax,%eax
+  801007:	7e db                	jle    800fe4 <sys_ipc_recv+0x3a>
+  801009:	83 ec 0c             	sub    $0xc,%esp
+  80100c:	50                   	push   %eax
+  80100d:	6a 0d                	push   $0xd
+  80100f:	68 4b 35 80 00       	push   $0x80354b
+  801014:	6a 24                	push   $0x24
+  801016:	68 68 35 80 00       	push   $0x803568
+  80101b:	e8 ac 1c 00 00       	call   802ccc <_panic>
+  801020:	83 ec 0c             	sub    $0xc,%esp
+  801023:	50                   	push   %eax
+  801024:	6a 0d                	push   $0xd
+  801026:	68 4b 35 80 00       	push   $0x80354b
+  80102b:	6a 48                	push   $0x48
+  80102d:	68 68 35 80 00       	push   $0x803568
+  801032:	e8 95 1c 00 00       	call   802ccc <_panic>
+
+00801037 <sys_ipc_send>:
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+  80103d:	83 3d 10 f0 bf ee 00 	cmpl   $0x0,0xeebff010
+  801044:	74 27                	je     80106d <sys_ipc_send+0x36>
+  801046:	8b 55 08             	mov    0x8(%ebp),%edx
+  801049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801051:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801054:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801057:	6a 00                	push   $0x0
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	8d 35 64 10 80 00    	lea    0x801064,%esi
+  801062:	0f 34                	sysenter
+  801064:	5d                   	pop    %ebp
+  801065:	83 c4 04             	add    $0x4,%esp
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+  80106d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801072:	be 00 00 00 00       	mov    $0x0,%esi
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801080:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801083:	cd 30                	int    $0x30
+  801085:	eb e1                	jmp    801068 <sys_ipc_send+0x31>
+
+00801087 <sys_ipc_call>:
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	56                   	push   %esi
+  80108c:	53                   	push   %ebx
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801098:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109e:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010a1:	cd 30                	int    $0x30
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5e                   	pop    %esi
+  8010a5:	5f                   	pop    %edi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	c3                   	ret
+
+008010a8 <sys_ipc_reply_recv>:
+  8010a8:	55                   	push   %ebp
+  8010a9:	89 e5                	mov    %esp,%ebp
+  8010ab:	57                   	push   %edi
+  8010ac:	56                   	push   %esi
+  8010ad:	53                   	push   %ebx
+  8010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010bf:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010c2:	cd 30                	int    $0x30
+  8010c4:	5b                   	pop    %ebx
+  8010c5:	5e                   	pop    %esi
+  8010c6:	5f                   	pop    %edi
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	c3                   	ret
+
+008010c9 <sys_time_msec>:
+  8010c9:	a1 08 f0 bf ee       	mov    0xeebff008,%eax
+  8010ce:	85 c0                	test   %eax,%eax
+  8010d0:	75 06                	jne    8010d8 <sys_time_msec+0xf>
+  8010d2:	a1 0c f0 bf ee       	mov    0xeebff00c,%eax
+  8010d7:	c3                   	ret
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	0f 31                	rdtsc
+  8010e3:	8b 0d 00 f0 bf ee    	mov    0xeebff000,%ecx
+  8010e9:	8b 1d 04 f0 bf ee    	mov    0xeebff004,%ebx
+  8010ef:	8b 35 08 f0 bf ee    	mov    0xeebff008,%esi
+  8010f5:	29 c8                	sub    %ecx,%eax
+  8010f7:	19 da                	sbb    %ebx,%edx
+  8010f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	52                   	push   %edx
+  801101:	50                   	push   %eax
+  801102:	e8 91 1f 00 00       	call   803098 <__udivdi3>
+  801107:	83 c4 10             	add    $0x10,%esp
+  80110a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110d:	5b                   	pop    %ebx
+  80110e:	5e                   	pop    %esi
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+
+00801112 <sys_env_swap>:
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	57                   	push   %edi
+  801116:	56                   	push   %esi
+  801117:	53                   	push   %ebx
+  801118:	83 ec 0c             	sub    $0xc,%esp
+  80111b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+  801123:	b8 12 00 00 00       	mov    $0x12,%eax
+  801128:	89 cb                	mov    %ecx,%ebx
+  80112a:	89 cf                	mov    %ecx,%edi
+  80112c:	89 ce                	mov    %ecx,%esi
+  80112e:	cd 30                	int    $0x30
+  801130:	85 c0                	test   %eax,%eax
+  801132:	7f 08                	jg     80113c <sys_env_swap+0x2a>
+  801134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5f                   	pop    %edi
+  80113a:	5d                   	pop    %ebp
+  80113b:	c3                   	ret
+  80113c:	83 ec 0c             	sub    $0xc,%esp
+  80113f:	50                   	push   %eax
+  801140:	6a 12                	push   $0x12
+  801142:	68 4b 35 80 00       	push   $0x80354b
+  801147:	6a 24                	push   $0x24
+  801149:	68 68 35 80 00       	push   $0x803568
+  80114e:	e8 79 1b 00 00       	call   802ccc <_panic>
+
+00801153 <sys_net_try_send>:
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	57                   	push   %edi
+  801157:	56                   	push   %esi
+  801158:	53                   	push   %ebx
+  801159:	83 ec 0c             	sub    $0xc,%esp
+  80115c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801161:	8b 55 08             	mov    0x8(%ebp),%edx
+  801164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801167:	b8 13 00 00 00       	mov    $0x13,%eax
+  80116c:	89 df                	mov    %ebx,%edi
+  80116e:	89 de                	mov    %ebx,%esi
+  801170:	cd 30                	int    $0x30
+  801172:	85 c0                	test   %eax,%eax
+  801174:	7f 08                	jg     80117e <sys_net_try_send+0x2b>
+  801176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+  801181:	50                   	push   %eax
+  801182:	6a 13                	push   $0x13
+  801184:	68 4b 35 80 00       	push   $0x80354b
+  801189:	6a 24                	push   $0x24
+  80118b:	68 68 35 80 00       	push   $0x803568
+  801190:	e8 37 1b 00 00       	call   802ccc <_panic>
+
+00801195 <sys_net_try_receive>:
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	57                   	push   %edi
+  801199:	56                   	push   %esi
+  80119a:	53                   	push   %ebx
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011ae:	89 df                	mov    %ebx,%edi
+  8011b0:	89 de                	mov    %ebx,%esi
+  8011b2:	cd 30                	int    $0x30
+  8011b4:	85 c0                	test   %eax,%eax
+  8011b6:	7f 08                	jg     8011c0 <sys_net_try_receive+0x2b>
+  8011b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bb:	5b                   	pop    %ebx
+  8011bc:	5e                   	pop    %esi
+  8011bd:	5f                   	pop    %edi
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+  8011c0:	83 ec 0c             	sub    $0xc,%esp
+  8011c3:	50                   	push   %eax
+  8011c4:	6a 14                	push   $0x14
+  8011c6:	68 4b 35 80 00       	push   $0x80354b
+  8011cb:	6a 24                	push   $0x24
+  8011cd:	68 68 35 80 00       	push   $0x803568
+  8011d2:	e8 f5 1a 00 00       	call   802ccc <_panic>
+
+008011d7 <sys_net_recv_page>:
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	57                   	push   %edi
+  8011db:	56                   	push   %esi
+  8011dc:	53                   	push   %ebx
+  8011dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e5:	b8 27 00 00 00       	mov    $0x27,%eax
+  8011ea:	89 cb                	mov    %ecx,%ebx
+  8011ec:	89 cf                	mov    %ecx,%edi
+  8011ee:	89 ce                	mov    %ecx,%esi
+  8011f0:	cd 30                	int    $0x30
+  8011f2:	5b                   	pop    %ebx
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5f                   	pop    %edi
+  8011f5:	5d                   	pop    %ebp
+  8011f6:	c3                   	ret
+
+008011f7 <sys_net_wait>:
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	57                   	push   %edi
+  8011fb:	56                   	push   %esi
+  8011fc:	53                   	push   %ebx
+  8011fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801202:	b8 26 00 00 00       	mov    $0x26,%eax
+  801207:	89 d1                	mov    %edx,%ecx
+  801209:	89 d3                	mov    %edx,%ebx
+  80120b:	89 d7                	mov    %edx,%edi
+  80120d:	89 d6                	mov    %edx,%esi
+  80120f:	cd 30                	int    $0x30
+  801211:	5b                   	pop    %ebx
+  801212:	5e                   	pop    %esi
+  801213:	5f                   	pop    %edi
+  801214:	5d                   	pop    %ebp
+  801215:	c3                   	ret
+
+00801216 <sys_get_mac>:
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+  80121c:	83 ec 0c             	sub    $0xc,%esp
+  80121f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80122f:	89 df                	mov    %ebx,%edi
+  801231:	89 de                	mov    %ebx,%esi
+  801233:	cd 30                	int    $0x30
+  801235:	85 c0                	test   %eax,%eax
+  801237:	7f 08                	jg     801241 <sys_get_mac+0x2b>
+  801239:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+  801241:	83 ec 0c             	sub    $0xc,%esp
+  801244:	50                   	push   %eax
+  801245:	6a 15                	push   $0x15
+  801247:	68 4b 35 80 00       	push   $0x80354b
+  80124c:	6a 24                	push   $0x24
+  80124e:	68 68 35 80 00       	push   $0x803568
+  801253:	e8 74 1a 00 00       	call   802ccc <_panic>
+
+00801258 <sys_env_lease>:
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	57                   	push   %edi
+  80125c:	56                   	push   %esi
+  80125d:	53                   	push   %ebx
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+  801261:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801266:	8b 55 08             	mov    0x8(%ebp),%edx
+  801269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801271:	89 df                	mov    %ebx,%edi
+  801273:	89 de                	mov    %ebx,%esi
+  801275:	cd 30                	int    $0x30
+  801277:	85 c0                	test   %eax,%eax
+  801279:	7f 08                	jg     801283 <sys_env_lease+0x2b>
+  80127b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+  801283:	83 ec 0c             	sub    $0xc,%esp
+  801286:	50                   	push   %eax
+  801287:	6a 16                	push   $0x16
+  801289:	68 4b 35 80 00       	push   $0x80354b
+  80128e:	6a 24                	push   $0x24
+  801290:	68 68 35 80 00       	push   $0x803568
+  801295:	e8 32 1a 00 00       	call   802ccc <_panic>
+
+0080129a <sys_copy_mem>:
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	57                   	push   %edi
+  80129e:	56                   	push   %esi
+  80129f:	53                   	push   %ebx
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+  8012a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012b7:	cd 30                	int    $0x30
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	7f 08                	jg     8012c5 <sys_copy_mem+0x2b>
+  8012bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c0:	5b                   	pop    %ebx
+  8012c1:	5e                   	pop    %esi
+  8012c2:	5f                   	pop    %edi
+  8012c3:	5d                   	pop    %ebp
+  8012c4:	c3                   	ret
+  8012c5:	83 ec 0c             	sub    $0xc,%esp
+  8012c8:	50                   	push   %eax
+  8012c9:	6a 17                	push   $0x17
+  8012cb:	68 4b 35 80 00       	push   $0x80354b
+  8012d0:	6a 24                	push   $0x24
+  8012d2:	68 68 35 80 00       	push   $0x803568
+  8012d7:	e8 f0 19 00 00       	call   802ccc <_panic>
+
+008012dc <sys_get_perms>:
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	57                   	push   %edi
+  8012e0:	56                   	push   %esi
+  8012e1:	53                   	push   %ebx
+  8012e2:	83 ec 0c             	sub    $0xc,%esp
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f8:	89 f7                	mov    %esi,%edi
+  8012fa:	cd 30                	int    $0x30
+  8012fc:	85 c0                	test   %eax,%eax
+  8012fe:	7f 08                	jg     801308 <sys_get_perms+0x2c>
+  801300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801303:	5b                   	pop    %ebx
+  801304:	5e                   	pop    %esi
+  801305:	5f                   	pop    %edi
+  801306:	5d                   	pop    %ebp
+  801307:	c3                   	ret
+  801308:	83 ec 0c             	sub    $0xc,%esp
+  80130b:	50                   	push   %eax
+  80130c:	6a 18                	push   $0x18
+  80130e:	68 4b 35 80 00       	push   $0x80354b
+  801313:	6a 24                	push   $0x24
+  801315:	68 68 35 80 00       	push   $0x803568
+  80131a:	e8 ad 19 00 00       	call   802ccc <_panic>
+
+0080131f <sys_env_unsuspend>:
+  80131f:	55                   	push   %ebp
+  801320:	89 e5                	mov    %esp,%ebp
+  801322:	57                   	push   %edi
+  801323:	56                   	push   %esi
+  801324:	53                   	push   %ebx
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	be 00 00 00 00       	mov    $0x0,%esi
+  80132d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801330:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801333:	b8 19 00 00 00       	mov    $0x19,%eax
+  801338:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133b:	89 f7                	mov    %esi,%edi
+  80133d:	cd 30                	int    $0x30
+  80133f:	85 c0                	test   %eax,%eax
+  801341:	7f 08                	jg     80134b <sys_env_unsuspend+0x2c>
+  801343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801346:	5b                   	pop    %ebx
+  801347:	5e                   	pop    %esi
+  801348:	5f                   	pop    %edi
+  801349:	5d                   	pop    %ebp
+  80134a:	c3                   	ret
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+  80134e:	50                   	push   %eax
+  80134f:	6a 19                	push   $0x19
+  801351:	68 4b 35 80 00       	push   $0x80354b
+  801356:	6a 24                	push   $0x24
+  801358:	68 68 35 80 00       	push   $0x803568
+  80135d:	e8 6a 19 00 00       	call   802ccc <_panic>
+
+00801362 <sys_migrate>:
+  801362:	55                   	push   %ebp
+  801363:	89 e5                	mov    %esp,%ebp
+  801365:	57                   	push   %edi
+  801366:	56                   	push   %esi
+  801367:	53                   	push   %ebx
+  801368:	83 ec 0c             	sub    $0xc,%esp
+  80136b:	ba 00 80 80 00       	mov    $0x808000,%edx
+  801370:	81 fa 00 00 80 00    	cmp    $0x800000,%edx
+  801376:	76 11                	jbe    801389 <sys_migrate+0x27>
+  801378:	b8 00 00 80 00       	mov    $0x800000,%eax
+  80137d:	0f b6 08             	movzbl (%eax),%ecx
+  801380:	05 00 10 00 00       	add    $0x1000,%eax
+  801385:	39 d0                	cmp    %edx,%eax
+  801387:	72 f4                	jb     80137d <sys_migrate+0x1b>
+  801389:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80138e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801391:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801396:	89 cb                	mov    %ecx,%ebx
+  801398:	89 cf                	mov    %ecx,%edi
+  80139a:	89 ce                	mov    %ecx,%esi
+  80139c:	cd 30                	int    $0x30
+  80139e:	85 c0                	test   %eax,%eax
+  8013a0:	7f 08                	jg     8013aa <sys_migrate+0x48>
+  8013a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a5:	5b                   	pop    %ebx
+  8013a6:	5e                   	pop    %esi
+  8013a7:	5f                   	pop    %edi
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+  8013aa:	83 ec 0c             	sub    $0xc,%esp
+  8013ad:	50                   	push   %eax
+  8013ae:	6a 1a                	push   $0x1a
+  8013b0:	68 4b 35 80 00       	push   $0x80354b
+  8013b5:	6a 24                	push   $0x24
+  8013b7:	68 68 35 80 00       	push   $0x803568
+  8013bc:	e8 0b 19 00 00       	call   802ccc <_panic>
+
+008013c1 <sys_lease_complete>:
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	57                   	push   %edi
+  8013c5:	56                   	push   %esi
+  8013c6:	53                   	push   %ebx
+  8013c7:	83 ec 0c             	sub    $0xc,%esp
+  8013ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013cf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013d4:	89 d1                	mov    %edx,%ecx
+  8013d6:	89 d3                	mov    %edx,%ebx
+  8013d8:	89 d7                	mov    %edx,%edi
+  8013da:	89 d6                	mov    %edx,%esi
+  8013dc:	cd 30                	int    $0x30
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	7f 08                	jg     8013ea <sys_lease_complete+0x29>
+  8013e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e5:	5b                   	pop    %ebx
+  8013e6:	5e                   	pop    %esi
+  8013e7:	5f                   	pop    %edi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+  8013ea:	83 ec 0c             	sub    $0xc,%esp
+  8013ed:	50                   	push   %eax
+  8013ee:	6a 1b                	push   $0x1b
+  8013f0:	68 4b 35 80 00       	push   $0x80354b
+  8013f5:	6a 24                	push   $0x24
+  8013f7:	68 68 35 80 00       	push   $0x803568
+  8013fc:	e8 cb 18 00 00       	call   802ccc <_panic>
+
+00801401 <sys_env_set_thisenv>:
+  801401:	55                   	push   %ebp
+  801402:	89 e5                	mov    %esp,%ebp
+  801404:	57                   	push   %edi
+  801405:	56                   	push   %esi
+  801406:	53                   	push   %ebx
+  801407:	83 ec 0c             	sub    $0xc,%esp
+  80140a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801415:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80141a:	89 df                	mov    %ebx,%edi
+  80141c:	89 de                	mov    %ebx,%esi
+  80141e:	cd 30                	int    $0x30
+  801420:	85 c0                	test   %eax,%eax
+  801422:	7f 08                	jg     80142c <sys_env_set_thisenv+0x2b>
+  801424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801427:	5b                   	pop    %ebx
+  801428:	5e                   	pop    %esi
+  801429:	5f                   	pop    %edi
+  80142a:	5d                   	pop    %ebp
+  80142b:	c3                   	ret
+  80142c:	83 ec 0c             	sub    $0xc,%esp
+  80142f:	50                   	push   %eax
+  801430:	6a 1c                	push   $0x1c
+  801432:	68 4b 35 80 00       	push   $0x80354b
+  801437:	6a 24                	push   $0x24
+  801439:	68 68 35 80 00       	push   $0x803568
+  80143e:	e8 89 18 00 00       	call   802ccc <_panic>
+
+00801443 <sys_env_set_sched>:
+  801443:	55                   	push   %ebp
+  801444:	89 e5                	mov    %esp,%ebp
+  801446:	57                   	push   %edi
+  801447:	56                   	push   %esi
+  801448:	53                   	push   %ebx
+  801449:	83 ec 0c             	sub    $0xc,%esp
+  80144c:	be 00 00 00 00       	mov    $0x0,%esi
+  801451:	8b 55 08             	mov    0x8(%ebp),%edx
+  801454:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801457:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80145c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80145f:	89 f7                	mov    %esi,%edi
+  801461:	cd 30                	int    $0x30
+  801463:	85 c0                	test   %eax,%eax
+  801465:	7f 08                	jg     80146f <sys_env_set_sched+0x2c>
+  801467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146a:	5b                   	pop    %ebx
+  80146b:	5e                   	pop    %esi
+  80146c:	5f                   	pop    %edi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	50                   	push   %eax
+  801473:	6a 1d                	push   $0x1d
+  801475:	68 4b 35 80 00       	push   $0x80354b
+  80147a:	6a 24                	push   $0x24
+  80147c:	68 68 35 80 00       	push   $0x803568
+  801481:	e8 46 18 00 00       	call   802ccc <_panic>
+
+00801486 <sys_batch>:
+  801486:	55                   	push   %ebp
+  801487:	89 e5                	mov    %esp,%ebp
+  801489:	57                   	push   %edi
+  80148a:	56                   	push   %esi
+  80148b:	53                   	push   %ebx
+  80148c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801491:	8b 55 08             	mov    0x8(%ebp),%edx
+  801494:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801497:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80149c:	89 df                	mov    %ebx,%edi
+  80149e:	89 de                	mov    %ebx,%esi
+  8014a0:	cd 30                	int    $0x30
+  8014a2:	5b                   	pop    %ebx
+  8014a3:	5e                   	pop    %esi
+  8014a4:	5f                   	pop    %edi
+  8014a5:	5d                   	pop    %ebp
+  8014a6:	c3                   	ret
+
+008014a7 <sys_env_stats>:
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	57                   	push   %edi
+  8014ab:	56                   	push   %esi
+  8014ac:	53                   	push   %ebx
+  8014ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b8:	b8 23 00 00 00       	mov    $0x23,%eax
+  8014bd:	89 df                	mov    %ebx,%edi
+  8014bf:	89 de                	mov    %ebx,%esi
+  8014c1:	cd 30                	int    $0x30
+  8014c3:	5b                   	pop    %ebx
+  8014c4:	5e                   	pop    %esi
+  8014c5:	5f                   	pop    %edi
+  8014c6:	5d                   	pop    %ebp
+  8014c7:	c3                   	ret
+
+008014c8 <sys_trace>:
+  8014c8:	55                   	push   %ebp
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	57                   	push   %edi
+  8014cc:	56                   	push   %esi
+  8014cd:	53                   	push   %ebx
+  8014ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d6:	b8 24 00 00 00       	mov    $0x24,%eax
+  8014db:	89 cb                	mov    %ecx,%ebx
+  8014dd:	89 cf                	mov    %ecx,%edi
+  8014df:	89 ce                	mov    %ecx,%esi
+  8014e1:	cd 30                	int    $0x30
+  8014e3:	5b                   	pop    %ebx
+  8014e4:	5e                   	pop    %esi
+  8014e5:	5f                   	pop    %edi
+  8014e6:	5d                   	pop    %ebp
+  8014e7:	c3                   	ret
+
+008014e8 <sys_env_set_pager>:
+  8014e8:	55                   	push   %ebp
+  8014e9:	89 e5                	mov    %esp,%ebp
+  8014eb:	57                   	push   %edi
+  8014ec:	56                   	push   %esi
+  8014ed:	53                   	push   %ebx
+  8014ee:	83 ec 0c             	sub    $0xc,%esp
+  8014f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fc:	b8 25 00 00 00       	mov    $0x25,%eax
+  801501:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801504:	89 f7                	mov    %esi,%edi
+  801506:	cd 30                	int    $0x30
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	7f 08                	jg     801514 <sys_env_set_pager+0x2c>
+  80150c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5f                   	pop    %edi
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+  801514:	83 ec 0c             	sub    $0xc,%esp
+  801517:	50                   	push   %eax
+  801518:	6a 25                	push   $0x25
+  80151a:	68 4b 35 80 00       	push   $0x80354b
+  80151f:	6a 24                	push   $0x24
+  801521:	68 68 35 80 00       	push   $0x803568
+  801526:	e8 a1 17 00 00       	call   802ccc <_panic>
+
+0080152b <sys_pager_retire>:
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	57                   	push   %edi
+  80152f:	56                   	push   %esi
+  801530:	53                   	push   %ebx
+  801531:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801536:	8b 55 08             	mov    0x8(%ebp),%edx
+  801539:	b8 28 00 00 00       	mov    $0x28,%eax
+  80153e:	89 cb                	mov    %ecx,%ebx
+  801540:	89 cf                	mov    %ecx,%edi
+  801542:	89 ce                	mov    %ecx,%esi
+  801544:	cd 30                	int    $0x30
+  801546:	5b                   	pop    %ebx
+  801547:	5e                   	pop    %esi
+  801548:	5f                   	pop    %edi
+  801549:	5d                   	pop    %ebp
+  80154a:	c3                   	ret
+
+0080154b <sys_prof>:
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	57                   	push   %edi
+  80154f:	56                   	push   %esi
+  801550:	53                   	push   %ebx
+  801551:	be 00 00 00 00       	mov    $0x0,%esi
+  801556:	8b 55 08             	mov    0x8(%ebp),%edx
+  801559:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155c:	b8 22 00 00 00       	mov    $0x22,%eax
+  801561:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801564:	89 f7                	mov    %esi,%edi
+  801566:	cd 30                	int    $0x30
+  801568:	5b                   	pop    %ebx
+  801569:	5e                   	pop    %esi
+  80156a:	5f                   	pop    %edi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+
+0080156d <fd2num>:
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	8b 45 08             	mov    0x8(%ebp),%eax
+  801573:	05 00 00 00 30       	add    $0x30000000,%eax
+  801578:	c1 e8 0c             	shr    $0xc,%eax
+  80157b:	5d                   	pop    %ebp
+  80157c:	c3                   	ret
+
+0080157d <fd2data>:
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	8b 45 08             	mov    0x8(%ebp),%eax
+  801583:	05 00 00 00 30       	add    $0x30000000,%eax
+  801588:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80158d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+  801592:	5d                   	pop    %ebp
+  801593:	c3                   	ret
+
+00801594 <fd_alloc>:
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80159c:	89 c2                	mov    %eax,%edx
+  80159e:	c1 ea 16             	shr    $0x16,%edx
+  8015a1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8015a8:	f6 c2 01             	test   $0x1,%dl
+  8015ab:	74 29                	je     8015d6 <fd_alloc+0x42>
+  8015ad:	89 c2                	mov    %eax,%edx
+  8015af:	c1 ea 0c             	shr    $0xc,%edx
+  8015b2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015b9:	f6 c2 01             	test   $0x1,%dl
+  8015bc:	74 18                	je     8015d6 <fd_alloc+0x42>
+  8015be:	05 00 10 00 00       	add    $0x1000,%eax
+  8015c3:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8015c8:	75 d2                	jne    80159c <fd_alloc+0x8>
+  8015ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cf:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8015d4:	eb 05                	jmp    8015db <fd_alloc+0x47>
+  8015d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015de:	89 02                	mov    %eax,(%edx)
+  8015e0:	89 c8                	mov    %ecx,%eax
+  8015e2:	5d                   	pop    %ebp
+  8015e3:	c3                   	ret
+
+008015e4 <fd_lookup>:
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015ea:	83 f8 1f             	cmp    $0x1f,%eax
+  8015ed:	77 30                	ja     80161f <fd_lookup+0x3b>
+  8015ef:	c1 e0 0c             	shl    $0xc,%eax
+  8015f2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  8015f7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015fd:	f6 c2 01             	test   $0x1,%dl
+  801600:	74 24                	je     801626 <fd_lookup+0x42>
+  801602:	89 c2                	mov    %eax,%edx
+  801604:	c1 ea 0c             	shr    $0xc,%edx
+  801607:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80160e:	f6 c2 01             	test   $0x1,%dl
+  801611:	74 1a                	je     80162d <fd_lookup+0x49>
+  801613:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801616:	89 02                	mov    %eax,(%edx)
+  801618:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161d:	5d                   	pop    %ebp
+  80161e:	c3                   	ret
+  80161f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801624:	eb f7                	jmp    80161d <fd_lookup+0x39>
+  801626:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80162b:	eb f0                	jmp    80161d <fd_lookup+0x39>
+  80162d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801632:	eb e9                	jmp    80161d <fd_lookup+0x39>
+
+00801634 <dev_lookup>:
+  801634:	55                   	push   %ebp
+  801635:	89 e5                	mov    %esp,%ebp
+  801637:	53                   	push   %ebx
+  801638:	83 ec 04             	sub    $0x4,%esp
+  80163b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801643:	bb 04 40 80 00       	mov    $0x804004,%ebx
+  801648:	39 13                	cmp    %edx,(%ebx)
+  80164a:	74 37                	je     801683 <dev_lookup+0x4f>
+  80164c:	83 c0 01             	add    $0x1,%eax
+  80164f:	8b 1c 85 f4 35 80 00 	mov    0x8035f4(,%eax,4),%ebx
+  801656:	85 db                	test   %ebx,%ebx
+  801658:	75 ee                	jne    801648 <dev_lookup+0x14>
+  80165a:	a1 10 50 80 00       	mov    0x805010,%eax
+  80165f:	8b 40 48             	mov    0x48(%eax),%eax
+  801662:	83 ec 04             	sub    $0x4,%esp
+  801665:	52                   	push   %edx
+  801666:	50                   	push   %eax
+  801667:	68 78 35 80 00       	push   $0x803578
+  80166c:	e8 37 eb ff ff       	call   8001a8 <cprintf>
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801679:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80167c:	89 1a                	mov    %ebx,(%edx)
+  80167e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801681:	c9                   	leave
+  801682:	c3                   	ret
+  801683:	b8 00 00 00 00       	mov    $0x0,%eax
+  801688:	eb ef                	jmp    801679 <dev_lookup+0x45>
+
+0080168a <fd_close>:
+  80168a:	55                   	push   %ebp
+  80168b:	89 e5                	mov    %esp,%ebp
+  80168d:	57                   	push   %edi
+  80168e:	56                   	push   %esi
+  80168f:	53                   	push   %ebx
+  801690:	83 ec 24             	sub    $0x24,%esp
+  801693:	8b 75 08             	mov    0x8(%ebp),%esi
+  801696:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801699:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80169c:	50                   	push   %eax
+  80169d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8016a3:	c1 e8 0c             	shr    $0xc,%eax
+  8016a6:	50                   	push   %eax
+  8016a7:	e8 38 ff ff ff       	call   8015e4 <fd_lookup>
+  8016ac:	89 c3                	mov    %eax,%ebx
+  8016ae:	83 c4 10             	add    $0x10,%esp
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	78 05                	js     8016ba <fd_close+0x30>
+  8016b5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8016b8:	74 0f                	je     8016c9 <fd_close+0x3f>
+  8016ba:	85 ff                	test   %edi,%edi
+  8016bc:	0f 44 df             	cmove  %edi,%ebx
+  8016bf:	89 d8                	mov    %ebx,%eax
+  8016c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c4:	5b                   	pop    %ebx
+  8016c5:	5e                   	pop    %esi
+  8016c6:	5f                   	pop    %edi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+  8016c9:	83 ec 08             	sub    $0x8,%esp
+  8016cc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016cf:	50                   	push   %eax
+  8016d0:	ff 36                	push   (%esi)
+  8016d2:	e8 5d ff ff ff       	call   801634 <dev_lookup>
+  8016d7:	89 c3                	mov    %eax,%ebx
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	78 1a                	js     8016fa <fd_close+0x70>
+  8016e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016e3:	8b 40 10             	mov    0x10(%eax),%eax
+  8016e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	74 0b                	je     8016fa <fd_close+0x70>
+  8016ef:	83 ec 0c             	sub    $0xc,%esp
+  8016f2:	56                   	push   %esi
+  8016f3:	ff d0                	call   *%eax
+  8016f5:	89 c3                	mov    %eax,%ebx
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	83 ec 08             	sub    $0x8,%esp
+  8016fd:	56                   	push   %esi
+  8016fe:	6a 00                	push   $0x0
+  801700:	e8 cc f6 ff ff       	call   800dd1 <sys_page_unmap>
+  801705:	83 c4 10             	add    $0x10,%esp
+  801708:	eb b5                	jmp    8016bf <fd_close+0x35>
+
+0080170a <close>:
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	83 ec 20             	sub    $0x20,%esp
+  801710:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801713:	50                   	push   %eax
+  801714:	ff 75 08             	push   0x8(%ebp)
+  801717:	e8 c8 fe ff ff       	call   8015e4 <fd_lookup>
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	79 02                	jns    801725 <close+0x1b>
+  801723:	c9                   	leave
+  801724:	c3                   	ret
+  801725:	83 ec 08             	sub    $0x8,%esp
+  801728:	6a 01                	push   $0x1
+  80172a:	ff 75 f4             	push   -0xc(%ebp)
+  80172d:	e8 58 ff ff ff       	call   80168a <fd_close>
+  801732:	83 c4 10             	add    $0x10,%esp
+  801735:	eb ec                	jmp    801723 <close+0x19>
+
+00801737 <close_all>:
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	53                   	push   %ebx
+  80173b:	83 ec 04             	sub    $0x4,%esp
+  80173e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801743:	83 ec 0c             	sub    $0xc,%esp
+  801746:	53                   	push   %ebx
+  801747:	e8 be ff ff ff       	call   80170a <close>
+  80174c:	83 c3 01             	add    $0x1,%ebx
+  80174f:	83 c4 10             	add    $0x10,%esp
+  801752:	83 fb 20             	cmp    $0x20,%ebx
+  801755:	75 ec                	jne    801743 <close_all+0xc>
+  801757:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+
+0080175c <dup>:
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	57                   	push   %edi
+  801760:	56                   	push   %esi
+  801761:	53                   	push   %ebx
+  801762:	83 ec 34             	sub    $0x34,%esp
+  801765:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801768:	50                   	push   %eax
+  801769:	ff 75 08             	push   0x8(%ebp)
+  80176c:	e8 73 fe ff ff       	call   8015e4 <fd_lookup>
+  801771:	89 c3                	mov    %eax,%ebx
+  801773:	83 c4 10             	add    $0x10,%esp
+  801776:	85 c0                	test   %eax,%eax
+  801778:	78 7f                	js     8017f9 <dup+0x9d>
+  80177a:	83 ec 0c             	sub    $0xc,%esp
+  80177d:	ff 75 0c             	push   0xc(%ebp)
+  801780:	e8 85 ff ff ff       	call   80170a <close>
+  801785:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801788:	c1 e6 0c             	shl    $0xc,%esi
+  80178b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+  801791:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801794:	89 3c 24             	mov    %edi,(%esp)
+  801797:	e8 e1 fd ff ff       	call   80157d <fd2data>
+  80179c:	89 c3                	mov    %eax,%ebx
+  80179e:	89 34 24             	mov    %esi,(%esp)
+  8017a1:	e8 d7 fd ff ff       	call   80157d <fd2data>
+  8017a6:	83 c4 10             	add    $0x10,%esp
+  8017a9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8017ac:	89 d8                	mov    %ebx,%eax
+  8017ae:	c1 e8 16             	shr    $0x16,%eax
+  8017b1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017b8:	a8 01                	test   $0x1,%al
+  8017ba:	74 11                	je     8017cd <dup+0x71>
+  8017bc:	89 d8                	mov    %ebx,%eax
+  8017be:	c1 e8 0c             	shr    $0xc,%eax
+  8017c1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017c8:	f6 c2 01             	test   $0x1,%dl
+  8017cb:	75 36                	jne    801803 <dup+0xa7>
+  8017cd:	89 f8                	mov    %edi,%eax
+  8017cf:	c1 e8 0c             	shr    $0xc,%eax
+  8017d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017d9:	83 ec 0c             	sub    $0xc,%esp
+  8017dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017e1:	50                   	push   %eax
+  8017e2:	56                   	push   %esi
+  8017e3:	6a 00                	push   $0x0
+  8017e5:	57                   	push   %edi
+  8017e6:	6a 00                	push   $0x0
+  8017e8:	e8 55 f5 ff ff       	call   800d42 <sys_page_map>
+  8017ed:	89 c3                	mov    %eax,%ebx
+  8017ef:	83 c4 20             	add    $0x20,%esp
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	78 33                	js     801829 <dup+0xcd>
+  8017f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8017f9:	89 d8                	mov    %ebx,%eax
+  8017fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017fe:	5b                   	pop    %ebx
+  8017ff:	5e                   	pop    %esi
+  801800:	5f                   	pop    %edi
+  801801:	5d                   	pop    %ebp
+  801802:	c3                   	ret
+  801803:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80180a:	83 ec 0c             	sub    $0xc,%esp
+  80180d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801812:	50                   	push   %eax
+  801813:	ff 75 d4             	push   -0x2c(%ebp)
+  801816:	6a 00                	push   $0x0
+  801818:	53                   	push   %ebx
+  801819:	6a 00                	push   $0x0
+  80181b:	e8 22 f5 ff ff       	call   800d42 <sys_page_map>
+  801820:	89 c3                	mov    %eax,%ebx
+  801822:	83 c4 20             	add    $0x20,%esp
+  801825:	85 c0                	test   %eax,%eax
+  801827:	79 a4                	jns    8017cd <dup+0x71>
+  801829:	83 ec 08             	sub    $0x8,%esp
+  80182c:	56                   	push   %esi
+  80182d:	6a 00                	push   $0x0
+  80182f:	e8 9d f5 ff ff       	call   800dd1 <sys_page_unmap>
+  801834:	83 c4 08             	add    $0x8,%esp
+  801837:	ff 75 d4             	push   -0x2c(%ebp)
+  80183a:	6a 00                	push   $0x0
+  80183c:	e8 90 f5 ff ff       	call   800dd1 <sys_page_unmap>
+  801841:	83 c4 10             	add    $0x10,%esp
+  801844:	eb b3                	jmp    8017f9 <dup+0x9d>
+
+00801846 <read>:
+  801846:	55                   	push   %ebp
+  801847:	89 e5                	mov    %esp,%ebp
+  801849:	56                   	push   %esi
+  80184a:	53                   	push   %ebx
+  80184b:	83 ec 18             	sub    $0x18,%esp
+  80184e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801851:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801854:	50                   	push   %eax
+  801855:	56                   	push   %esi
+  801856:	e8 89 fd ff ff       	call   8015e4 <fd_lookup>
+  80185b:	83 c4 10             	add    $0x10,%esp
+  80185e:	85 c0                	test   %eax,%eax
+  801860:	78 3c                	js     80189e <read+0x58>
+  801862:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801865:	83 ec 08             	sub    $0x8,%esp
+  801868:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80186b:	50                   	push   %eax
+  80186c:	ff 33                	push   (%ebx)
+  80186e:	e8 c1 fd ff ff       	call   801634 <dev_lookup>
+  801873:	83 c4 10             	add    $0x10,%esp
+  801876:	85 c0                	test   %eax,%eax
+  801878:	78 24                	js     80189e <read+0x58>
+  80187a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80187d:	83 e0 03             	and    $0x3,%eax
+  801880:	83 f8 01             	cmp    $0x1,%eax
+  801883:	74 20                	je     8018a5 <read+0x5f>
+  801885:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801888:	8b 40 08             	mov    0x8(%eax),%eax
+  80188b:	85 c0                	test   %eax,%eax
+  80188d:	74 37                	je     8018c6 <read+0x80>
+  80188f:	83 ec 04             	sub    $0x4,%esp
+  801892:	ff 75 10             	push   0x10(%ebp)
+  801895:	ff 75 0c             	push   0xc(%ebp)
+  801898:	53                   	push   %ebx
+  801899:	ff d0                	call   *%eax
+  80189b:	83 c4 10             	add    $0x10,%esp
+  80189e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a1:	5b                   	pop    %ebx
+  8018a2:	5e                   	pop    %esi
+  8018a3:	5d                   	pop    %ebp
+  8018a4:	c3                   	ret
+  8018a5:	a1 10 50 80 00       	mov    0x805010,%eax
+  8018aa:	8b 40 48             	mov    0x48(%eax),%eax
+  8018ad:	83 ec 04             	sub    $0x4,%esp
+  8018b0:	56                   	push   %esi
+  8018b1:	50                   	push   %eax
+  8018b2:	68 b9 35 80 00       	push   $0x8035b9
+  8018b7:	e8 ec e8 ff ff       	call   8001a8 <cprintf>
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c4:	eb d8                	jmp    80189e <read+0x58>
+  8018c6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018cb:	eb d1                	jmp    80189e <read+0x58>
+
+008018cd <readn>:
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+  8018d0:	57                   	push   %edi
+  8018d1:	56                   	push   %esi
+  8018d2:	53                   	push   %ebx
+  8018d3:	83 ec 0c             	sub    $0xc,%esp
+  8018d6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8018d9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8018dc:	85 f6                	test   %esi,%esi
+  8018de:	74 30                	je     801910 <readn+0x43>
+  8018e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ea:	83 ec 04             	sub    $0x4,%esp
+  8018ed:	89 f2                	mov    %esi,%edx
+  8018ef:	29 c2                	sub    %eax,%edx
+  8018f1:	52                   	push   %edx
+  8018f2:	01 f8                	add    %edi,%eax
+  8018f4:	50                   	push   %eax
+  8018f5:	ff 75 08             	push   0x8(%ebp)
+  8018f8:	e8 49 ff ff ff       	call   801846 <read>
+  8018fd:	83 c4 10             	add    $0x10,%esp
+  801900:	85 c0                	test   %eax,%eax
+  801902:	78 15                	js     801919 <readn+0x4c>
+  801904:	74 11                	je     801917 <readn+0x4a>
+  801906:	01 c3                	add    %eax,%ebx
+  801908:	89 d8                	mov    %ebx,%eax
+  80190a:	39 f3                	cmp    %esi,%ebx
+  80190c:	72 dc                	jb     8018ea <readn+0x1d>
+  80190e:	eb 09                	jmp    801919 <readn+0x4c>
+  801910:	b8 00 00 00 00       	mov    $0x0,%eax
+  801915:	eb 02                	jmp    801919 <readn+0x4c>
+  801917:	89 d8                	mov    %ebx,%eax
+  801919:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191c:	5b                   	pop    %ebx
+  80191d:	5e                   	pop    %esi
+  80191e:	5f                   	pop    %edi
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+
+00801921 <write>:
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	56                   	push   %esi
+  801925:	53                   	push   %ebx
+  801926:	83 ec 18             	sub    $0x18,%esp
+  801929:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80192c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80192f:	50                   	push   %eax
+  801930:	53                   	push   %ebx
+  801931:	e8 ae fc ff ff       	call   8015e4 <fd_lookup>
+  801936:	83 c4 10             	add    $0x10,%esp
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	78 37                	js     801974 <write+0x53>
+  80193d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801940:	83 ec 08             	sub    $0x8,%esp
+  801943:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801946:	50                   	push   %eax
+  801947:	ff 36                	push   (%esi)
+  801949:	e8 e6 fc ff ff       	call   801634 <dev_lookup>
+  80194e:	83 c4 10             	add    $0x10,%esp
+  801951:	85 c0                	test   %eax,%eax
+  801953:	78 1f                	js     801974 <write+0x53>
+  801955:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801959:	74 20                	je     80197b <write+0x5a>
+  80195b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80195e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801961:	85 c0                	test   %eax,%eax
+  801963:	74 37                	je     80199c <write+0x7b>
+  801965:	83 ec 04             	sub    $0x4,%esp
+  801968:	ff 75 10             	push   0x10(%ebp)
+  80196b:	ff 75 0c             	push   0xc(%ebp)
+  80196e:	56                   	push   %esi
+  80196f:	ff d0                	call   *%eax
+  801971:	83 c4 10             	add    $0x10,%esp
+  801974:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801977:	5b                   	pop    %ebx
+  801978:	5e                   	pop    %esi
+  801979:	5d                   	pop    %ebp
+  80197a:	c3                   	ret
+  80197b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801980:	8b 40 48             	mov    0x48(%eax),%eax
+  801983:	83 ec 04             	sub    $0x4,%esp
+  801986:	53                   	push   %ebx
+  801987:	50                   	push   %eax
+  801988:	68 d5 35 80 00       	push   $0x8035d5
+  80198d:	e8 16 e8 ff ff       	call   8001a8 <cprintf>
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80199a:	eb d8                	jmp    801974 <write+0x53>
+  80199c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019a1:	eb d1                	jmp    801974 <write+0x53>
+
+008019a3 <seek>:
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	83 ec 20             	sub    $0x20,%esp
+  8019a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ac:	50                   	push   %eax
+  8019ad:	ff 75 08             	push   0x8(%ebp)
+  8019b0:	e8 2f fc ff ff       	call   8015e4 <fd_lookup>
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 0e                	js     8019ca <seek+0x27>
+  8019bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c2:	89 50 04             	mov    %edx,0x4(%eax)
+  8019c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ca:	c9                   	leave
+  8019cb:	c3                   	ret
+
+008019cc <ftruncate>:
+  8019cc:	55                   	push   %ebp
+  8019cd:	89 e5                	mov    %esp,%ebp
+  8019cf:	56                   	push   %esi
+  8019d0:	53                   	push   %ebx
+  8019d1:	83 ec 18             	sub    $0x18,%esp
+  8019d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019d7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019da:	50                   	push   %eax
+  8019db:	53                   	push   %ebx
+  8019dc:	e8 03 fc ff ff       	call   8015e4 <fd_lookup>
+  8019e1:	83 c4 10             	add    $0x10,%esp
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	78 34                	js     801a1c <ftruncate+0x50>
+  8019e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019eb:	83 ec 08             	sub    $0x8,%esp
+  8019ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f1:	50                   	push   %eax
+  8019f2:	ff 36                	push   (%esi)
+  8019f4:	e8 3b fc ff ff       	call   801634 <dev_lookup>
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	85 c0                	test   %eax,%eax
+  8019fe:	78 1c                	js     801a1c <ftruncate+0x50>
+  801a00:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a04:	74 1d                	je     801a23 <ftruncate+0x57>
+  801a06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a09:	8b 40 18             	mov    0x18(%eax),%eax
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	74 34                	je     801a44 <ftruncate+0x78>
+  801a10:	83 ec 08             	sub    $0x8,%esp
+  801a13:	ff 75 0c             	push   0xc(%ebp)
+  801a16:	56                   	push   %esi
+  801a17:	ff d0                	call   *%eax
+  801a19:	83 c4 10             	add    $0x10,%esp
+  801a1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1f:	5b                   	pop    %ebx
+  801a20:	5e                   	pop    %esi
+  801a21:	5d                   	pop    %ebp
+  801a22:	c3                   	ret
+  801a23:	a1 10 50 80 00       	mov    0x805010,%eax
+  801a28:	8b 40 48             	mov    0x48(%eax),%eax
+  801a2b:	83 ec 04             	sub    $0x4,%esp
+  801a2e:	53                   	push   %ebx
+  801a2f:	50                   	push   %eax
+  801a30:	68 98 35 80 00       	push   $0x803598
+  801a35:	e8 6e e7 ff ff       	call   8001a8 <cprintf>
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a42:	eb d8                	jmp    801a1c <ftruncate+0x50>
+  801a44:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a49:	eb d1                	jmp    801a1c <ftruncate+0x50>
+
+00801a4b <fstat>:
+  801a4b:	55                   	push   %ebp
+  801a4c:	89 e5                	mov    %esp,%ebp
+  801a4e:	56                   	push   %esi
+  801a4f:	53                   	push   %ebx
+  801a50:	83 ec 18             	sub    $0x18,%esp
+  801a53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801a56:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a59:	50                   	push   %eax
+  801a5a:	ff 75 08             	push   0x8(%ebp)
+  801a5d:	e8 82 fb ff ff       	call   8015e4 <fd_lookup>
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	78 49                	js     801ab2 <fstat+0x67>
+  801a69:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a6c:	83 ec 08             	sub    $0x8,%esp
+  801a6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a72:	50                   	push   %eax
+  801a73:	ff 36                	push   (%esi)
+  801a75:	e8 ba fb ff ff       	call   801634 <dev_lookup>
+  801a7a:	83 c4 10             	add    $0x10,%esp
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	78 31                	js     801ab2 <fstat+0x67>
+  801a81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a84:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a88:	74 2f                	je     801ab9 <fstat+0x6e>
+  801a8a:	c6 03 00             	movb   $0x0,(%ebx)
+  801a8d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a94:	00 00 00 
+  801a97:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a9e:	00 00 00 
+  801aa1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  801aa7:	83 ec 08             	sub    $0x8,%esp
+  801aaa:	53                   	push   %ebx
+  801aab:	56                   	push   %esi
+  801aac:	ff 50 14             	call   *0x14(%eax)
+  801aaf:	83 c4 10             	add    $0x10,%esp
+  801ab2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab5:	5b                   	pop    %ebx
+  801ab6:	5e                   	pop    %esi
+  801ab7:	5d                   	pop    %ebp
+  801ab8:	c3                   	ret
+  801ab9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801abe:	eb f2                	jmp    801ab2 <fstat+0x67>
+
+00801ac0 <stat>:
+  801ac0:	55                   	push   %ebp
+  801ac1:	89 e5                	mov    %esp,%ebp
+  801ac3:	56                   	push   %esi
+  801ac4:	53                   	push   %ebx
+  801ac5:	83 ec 08             	sub    $0x8,%esp
+  801ac8:	6a 00                	push   $0x0
+  801aca:	ff 75 08             	push   0x8(%ebp)
+  801acd:	e8 31 05 00 00       	call   802003 <open>
+  801ad2:	89 c3                	mov    %eax,%ebx
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 1b                	js     801af6 <stat+0x36>
+  801adb:	83 ec 08             	sub    $0x8,%esp
+  801ade:	ff 75 0c             	push   0xc(%ebp)
+  801ae1:	50                   	push   %eax
+  801ae2:	e8 64 ff ff ff       	call   801a4b <fstat>
+  801ae7:	89 c6                	mov    %eax,%esi
+  801ae9:	89 1c 24             	mov    %ebx,(%esp)
+  801aec:	e8 19 fc ff ff       	call   80170a <close>
+  801af1:	83 c4 10             	add    $0x10,%esp
+  801af4:	89 f3                	mov    %esi,%ebx
+  801af6:	89 d8                	mov    %ebx,%eax
+  801af8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afb:	5b                   	pop    %ebx
+  801afc:	5e                   	pop    %esi
+  801afd:	5d                   	pop    %ebp
+  801afe:	c3                   	ret
+
+00801aff <fsipc>:
+  801aff:	55                   	push   %ebp
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	56                   	push   %esi
+  801b03:	53                   	push   %ebx
+  801b04:	89 c3                	mov    %eax,%ebx
+  801b06:	89 d6                	mov    %edx,%esi
+  801b08:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801b0f:	74 20                	je     801b31 <fsipc+0x32>
+  801b11:	83 ec 08             	sub    $0x8,%esp
+  801b14:	6a 00                	push   $0x0
+  801b16:	56                   	push   %esi
+  801b17:	6a 07                	push   $0x7
+  801b19:	68 00 60 80 00       	push   $0x806000
+  801b1e:	53                   	push   %ebx
+  801b1f:	ff 35 08 50 80 00    	push   0x805008
+  801b25:	e8 a0 12 00 00       	call   802dca <ipc_call>
+  801b2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b2d:	5b                   	pop    %ebx
+  801b2e:	5e                   	pop    %esi
+  801b2f:	5d                   	pop    %ebp
+  801b30:	c3                   	ret
+  801b31:	83 ec 0c             	sub    $0xc,%esp
+  801b34:	6a 02                	push   $0x2
+  801b36:	e8 2a 14 00 00       	call   802f65 <ipc_find_env>
+  801b3b:	a3 08 50 80 00       	mov    %eax,0x805008
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	eb cc                	jmp    801b11 <fsipc+0x12>
+
+00801b45 <devfile_trunc>:
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	83 ec 08             	sub    $0x8,%esp
+  801b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b51:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b59:	a3 04 60 80 00       	mov    %eax,0x806004
+  801b5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b63:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b68:	e8 92 ff ff ff       	call   801aff <fsipc>
+  801b6d:	c9                   	leave
+  801b6e:	c3                   	ret
+
+00801b6f <devfile_flush>:
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	83 ec 08             	sub    $0x8,%esp
+  801b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b78:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b7b:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b85:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b8a:	e8 70 ff ff ff       	call   801aff <fsipc>
+  801b8f:	c9                   	leave
+  801b90:	c3                   	ret
+
+00801b91 <devfile_stat>:
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	53                   	push   %ebx
+  801b95:	83 ec 04             	sub    $0x4,%esp
+  801b98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ba1:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ba6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bab:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bb0:	e8 4a ff ff ff       	call   801aff <fsipc>
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 2c                	js     801be5 <devfile_stat+0x54>
+  801bb9:	83 ec 08             	sub    $0x8,%esp
+  801bbc:	68 00 60 80 00       	push   $0x806000
+  801bc1:	53                   	push   %ebx
+  801bc2:	e8 d8 ec ff ff       	call   80089f <strcpy>
+  801bc7:	a1 80 60 80 00       	mov    0x806080,%eax
+  801bcc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  801bd2:	a1 84 60 80 00       	mov    0x806084,%eax
+  801bd7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be8:	c9                   	leave
+  801be9:	c3                   	ret
+
+00801bea <fsring_rw>:
+  801bea:	55                   	push   %ebp
+  801beb:	89 e5                	mov    %esp,%ebp
+  801bed:	57                   	push   %edi
+  801bee:	56                   	push   %esi
+  801bef:	53                   	push   %ebx
+  801bf0:	83 ec 2c             	sub    $0x2c,%esp
+  801bf3:	89 c7                	mov    %eax,%edi
+  801bf5:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801bf8:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  801bfb:	a1 fc dc 7b ef       	mov    0xef7bdcfc,%eax
+  801c00:	a8 01                	test   $0x1,%al
+  801c02:	74 0d                	je     801c11 <fsring_rw+0x27>
+  801c04:	a1 00 fc 73 ef       	mov    0xef73fc00,%eax
+  801c09:	a8 01                	test   $0x1,%al
+  801c0b:	0f 85 d5 00 00 00    	jne    801ce6 <fsring_rw+0xfc>
+  801c11:	a1 10 50 80 00       	mov    0x805010,%eax
+  801c16:	8b 40 48             	mov    0x48(%eax),%eax
+  801c19:	3b 05 04 50 80 00    	cmp    0x805004,%eax
+  801c1f:	0f 84 fc 00 00 00    	je     801d21 <fsring_rw+0x137>
+  801c25:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  801c2c:	0f 84 02 01 00 00    	je     801d34 <fsring_rw+0x14a>
+  801c32:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c37:	83 ec 04             	sub    $0x4,%esp
+  801c3a:	68 07 02 00 00       	push   $0x207
+  801c3f:	53                   	push   %ebx
+  801c40:	6a 00                	push   $0x0
+  801c42:	e8 b8 f0 ff ff       	call   800cff <sys_page_alloc>
+  801c47:	83 c4 10             	add    $0x10,%esp
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	0f 88 f9 00 00 00    	js     801d4b <fsring_rw+0x161>
+  801c52:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c58:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801c5e:	75 d7                	jne    801c37 <fsring_rw+0x4d>
+  801c60:	6a 0e                	push   $0xe
+  801c62:	6a 0d                	push   $0xd
+  801c64:	ff 35 08 50 80 00    	push   0x805008
+  801c6a:	68 00 00 f0 cf       	push   $0xcff00000
+  801c6f:	e8 c4 0c 00 00       	call   802938 <ipcring_init>
+  801c74:	83 c4 08             	add    $0x8,%esp
+  801c77:	6a 00                	push   $0x0
+  801c79:	6a 00                	push   $0x0
+  801c7b:	68 07 02 00 00       	push   $0x207
+  801c80:	68 00 00 f0 cf       	push   $0xcff00000
+  801c85:	6a 0b                	push   $0xb
+  801c87:	ff 35 08 50 80 00    	push   0x805008
+  801c8d:	e8 38 11 00 00       	call   802dca <ipc_call>
+  801c92:	89 c6                	mov    %eax,%esi
+  801c94:	83 c4 20             	add    $0x20,%esp
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	0f 88 ac 00 00 00    	js     801d4b <fsring_rw+0x161>
+  801c9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca4:	89 d9                	mov    %ebx,%ecx
+  801ca6:	83 c3 01             	add    $0x1,%ebx
+  801ca9:	89 da                	mov    %ebx,%edx
+  801cab:	c1 e2 0c             	shl    $0xc,%edx
+  801cae:	8d 82 00 00 f0 cf    	lea    -0x30100000(%edx),%eax
+  801cb4:	89 b2 00 00 f0 cf    	mov    %esi,-0x30100000(%edx)
+  801cba:	89 8a 04 00 f0 cf    	mov    %ecx,-0x300ffffc(%edx)
+  801cc0:	83 ec 08             	sub    $0x8,%esp
+  801cc3:	6a 00                	push   $0x0
+  801cc5:	6a 00                	push   $0x0
+  801cc7:	68 07 02 00 00       	push   $0x207
+  801ccc:	50                   	push   %eax
+  801ccd:	6a 0c                	push   $0xc
+  801ccf:	ff 35 08 50 80 00    	push   0x805008
+  801cd5:	e8 f0 10 00 00       	call   802dca <ipc_call>
+  801cda:	83 c4 20             	add    $0x20,%esp
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 6a                	js     801d4b <fsring_rw+0x161>
+  801ce1:	83 fb 08             	cmp    $0x8,%ebx
+  801ce4:	75 be                	jne    801ca4 <fsring_rw+0xba>
+  801ce6:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801cea:	ba f4 0f 00 00       	mov    $0xff4,%edx
+  801cef:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801cf4:	0f 45 c2             	cmovne %edx,%eax
+  801cf7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801cfa:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  801d01:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  801d08:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d14:	be 00 00 00 00       	mov    $0x0,%esi
+  801d19:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801d1c:	e9 4b 01 00 00       	jmp    801e6c <fsring_rw+0x282>
+  801d21:	e8 a3 f3 ff ff       	call   8010c9 <sys_time_msec>
+  801d26:	3b 05 00 50 80 00    	cmp    0x805000,%eax
+  801d2c:	0f 89 f3 fe ff ff    	jns    801c25 <fsring_rw+0x3b>
+  801d32:	eb 54                	jmp    801d88 <fsring_rw+0x19e>
+  801d34:	83 ec 0c             	sub    $0xc,%esp
+  801d37:	6a 02                	push   $0x2
+  801d39:	e8 27 12 00 00       	call   802f65 <ipc_find_env>
+  801d3e:	a3 08 50 80 00       	mov    %eax,0x805008
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	e9 e7 fe ff ff       	jmp    801c32 <fsring_rw+0x48>
+  801d4b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d50:	83 ec 08             	sub    $0x8,%esp
+  801d53:	53                   	push   %ebx
+  801d54:	6a 00                	push   $0x0
+  801d56:	e8 76 f0 ff ff       	call   800dd1 <sys_page_unmap>
+  801d5b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	81 fb 00 90 f0 cf    	cmp    $0xcff09000,%ebx
+  801d6a:	75 e4                	jne    801d50 <fsring_rw+0x166>
+  801d6c:	e8 58 f3 ff ff       	call   8010c9 <sys_time_msec>
+  801d71:	05 e8 03 00 00       	add    $0x3e8,%eax
+  801d76:	a3 00 50 80 00       	mov    %eax,0x805000
+  801d7b:	a1 10 50 80 00       	mov    0x805010,%eax
+  801d80:	8b 40 48             	mov    0x48(%eax),%eax
+  801d83:	a3 04 50 80 00       	mov    %eax,0x805004
+  801d88:	c7 45 cc f1 ff ff ff 	movl   $0xfffffff1,-0x34(%ebp)
+  801d8f:	e9 7a 01 00 00       	jmp    801f0e <fsring_rw+0x324>
+  801d94:	8b 57 0c             	mov    0xc(%edi),%edx
+  801d97:	89 10                	mov    %edx,(%eax)
+  801d99:	89 58 04             	mov    %ebx,0x4(%eax)
+  801d9c:	89 f2                	mov    %esi,%edx
+  801d9e:	03 57 04             	add    0x4(%edi),%edx
+  801da1:	89 50 08             	mov    %edx,0x8(%eax)
+  801da4:	83 ec 04             	sub    $0x4,%esp
+  801da7:	53                   	push   %ebx
+  801da8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801dab:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+  801dae:	52                   	push   %edx
+  801daf:	83 c0 0c             	add    $0xc,%eax
+  801db2:	50                   	push   %eax
+  801db3:	e8 97 ec ff ff       	call   800a4f <memmove>
+  801db8:	83 c4 10             	add    $0x10,%esp
+  801dbb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dbe:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801dc1:	89 08                	mov    %ecx,(%eax)
+  801dc3:	83 ec 0c             	sub    $0xc,%esp
+  801dc6:	68 00 00 f0 cf       	push   $0xcff00000
+  801dcb:	e8 c6 0b 00 00       	call   802996 <ipcring_req_push>
+  801dd0:	01 de                	add    %ebx,%esi
+  801dd2:	83 c4 10             	add    $0x10,%esp
+  801dd5:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801dd8:	73 4c                	jae    801e26 <fsring_rw+0x23c>
+  801dda:	83 ec 0c             	sub    $0xc,%esp
+  801ddd:	68 00 00 f0 cf       	push   $0xcff00000
+  801de2:	e8 89 0b 00 00       	call   802970 <ipcring_req_slot>
+  801de7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	74 35                	je     801e26 <fsring_rw+0x23c>
+  801df1:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801df6:	83 e0 07             	and    $0x7,%eax
+  801df9:	05 01 ff 0c 00       	add    $0xcff01,%eax
+  801dfe:	c1 e0 0c             	shl    $0xc,%eax
+  801e01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e04:	29 f3                	sub    %esi,%ebx
+  801e06:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801e09:	39 cb                	cmp    %ecx,%ebx
+  801e0b:	0f 47 d9             	cmova  %ecx,%ebx
+  801e0e:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e12:	75 80                	jne    801d94 <fsring_rw+0x1aa>
+  801e14:	8b 57 0c             	mov    0xc(%edi),%edx
+  801e17:	89 10                	mov    %edx,(%eax)
+  801e19:	89 58 04             	mov    %ebx,0x4(%eax)
+  801e1c:	89 f2                	mov    %esi,%edx
+  801e1e:	03 57 04             	add    0x4(%edi),%edx
+  801e21:	89 50 08             	mov    %edx,0x8(%eax)
+  801e24:	eb 95                	jmp    801dbb <fsring_rw+0x1d1>
+  801e26:	a1 18 00 f0 cf       	mov    0xcff00018,%eax
+  801e2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e2e:	83 ec 0c             	sub    $0xc,%esp
+  801e31:	68 00 00 f0 cf       	push   $0xcff00000
+  801e36:	e8 94 0b 00 00       	call   8029cf <ipcring_rsp_wait>
+  801e3b:	8b 58 04             	mov    0x4(%eax),%ebx
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e45:	75 45                	jne    801e8c <fsring_rw+0x2a2>
+  801e47:	85 db                	test   %ebx,%ebx
+  801e49:	79 41                	jns    801e8c <fsring_rw+0x2a2>
+  801e4b:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  801e4e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  801e55:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  801e5c:	83 ec 0c             	sub    $0xc,%esp
+  801e5f:	68 00 00 f0 cf       	push   $0xcff00000
+  801e64:	e8 cc 0b 00 00       	call   802a35 <ipcring_rsp_pop>
+  801e69:	83 c4 10             	add    $0x10,%esp
+  801e6c:	8b 15 18 00 f0 cf    	mov    0xcff00018,%edx
+  801e72:	a1 10 00 f0 cf       	mov    0xcff00010,%eax
+  801e77:	39 c2                	cmp    %eax,%edx
+  801e79:	74 75                	je     801ef0 <fsring_rw+0x306>
+  801e7b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801e7f:	75 a5                	jne    801e26 <fsring_rw+0x23c>
+  801e81:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801e84:	0f 82 50 ff ff ff    	jb     801dda <fsring_rw+0x1f0>
+  801e8a:	eb 9a                	jmp    801e26 <fsring_rw+0x23c>
+  801e8c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e90:	75 ca                	jne    801e5c <fsring_rw+0x272>
+  801e92:	83 7d e0 05          	cmpl   $0x5,-0x20(%ebp)
+  801e96:	74 31                	je     801ec9 <fsring_rw+0x2df>
+  801e98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801e9e:	29 c8                	sub    %ecx,%eax
+  801ea0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  801ea3:	39 d0                	cmp    %edx,%eax
+  801ea5:	0f 47 c2             	cmova  %edx,%eax
+  801ea8:	39 d8                	cmp    %ebx,%eax
+  801eaa:	ba 01 00 00 00       	mov    $0x1,%edx
+  801eaf:	0f 4e 55 d4          	cmovle -0x2c(%ebp),%edx
+  801eb3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  801eb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ebb:	0f 4e 45 d0          	cmovle -0x30(%ebp),%eax
+  801ebf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801ec2:	01 d9                	add    %ebx,%ecx
+  801ec4:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+  801ec7:	eb 93                	jmp    801e5c <fsring_rw+0x272>
+  801ec9:	83 ec 04             	sub    $0x4,%esp
+  801ecc:	53                   	push   %ebx
+  801ecd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ed0:	83 e0 07             	and    $0x7,%eax
+  801ed3:	c1 e0 0c             	shl    $0xc,%eax
+  801ed6:	8d 80 00 10 f0 cf    	lea    -0x300ff000(%eax),%eax
+  801edc:	50                   	push   %eax
+  801edd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801ee0:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801ee3:	01 c8                	add    %ecx,%eax
+  801ee5:	50                   	push   %eax
+  801ee6:	e8 64 eb ff ff       	call   800a4f <memmove>
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	eb a8                	jmp    801e98 <fsring_rw+0x2ae>
+  801ef0:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  801ef4:	75 09                	jne    801eff <fsring_rw+0x315>
+  801ef6:	3b 75 08             	cmp    0x8(%ebp),%esi
+  801ef9:	0f 82 db fe ff ff    	jb     801dda <fsring_rw+0x1f0>
+  801eff:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801f02:	01 57 04             	add    %edx,0x4(%edi)
+  801f05:	85 d2                	test   %edx,%edx
+  801f07:	0f 44 55 cc          	cmove  -0x34(%ebp),%edx
+  801f0b:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  801f0e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801f11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f14:	5b                   	pop    %ebx
+  801f15:	5e                   	pop    %esi
+  801f16:	5f                   	pop    %edi
+  801f17:	5d                   	pop    %ebp
+  801f18:	c3                   	ret
+
+00801f19 <devfile_write>:
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	57                   	push   %edi
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+  801f1f:	83 ec 0c             	sub    $0xc,%esp
+  801f22:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f25:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f2b:	81 fb f8 0f 00 00    	cmp    $0xff8,%ebx
+  801f31:	76 1a                	jbe    801f4d <devfile_write+0x34>
+  801f33:	83 ec 0c             	sub    $0xc,%esp
+  801f36:	53                   	push   %ebx
+  801f37:	89 f1                	mov    %esi,%ecx
+  801f39:	ba 06 00 00 00       	mov    $0x6,%edx
+  801f3e:	89 f8                	mov    %edi,%eax
+  801f40:	e8 a5 fc ff ff       	call   801bea <fsring_rw>
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801f4b:	75 39                	jne    801f86 <devfile_write+0x6d>
+  801f4d:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  801f52:	39 c3                	cmp    %eax,%ebx
+  801f54:	0f 47 d8             	cmova  %eax,%ebx
+  801f57:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f5a:	a3 00 60 80 00       	mov    %eax,0x806000
+  801f5f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  801f65:	83 ec 04             	sub    $0x4,%esp
+  801f68:	53                   	push   %ebx
+  801f69:	56                   	push   %esi
+  801f6a:	68 08 60 80 00       	push   $0x806008
+  801f6f:	e8 db ea ff ff       	call   800a4f <memmove>
+  801f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f79:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f7e:	e8 7c fb ff ff       	call   801aff <fsipc>
+  801f83:	83 c4 10             	add    $0x10,%esp
+  801f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f89:	5b                   	pop    %ebx
+  801f8a:	5e                   	pop    %esi
+  801f8b:	5f                   	pop    %edi
+  801f8c:	5d                   	pop    %ebp
+  801f8d:	c3                   	ret
+
+00801f8e <devfile_read>:
+  801f8e:	55                   	push   %ebp
+  801f8f:	89 e5                	mov    %esp,%ebp
+  801f91:	57                   	push   %edi
+  801f92:	56                   	push   %esi
+  801f93:	53                   	push   %ebx
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+  801f97:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f9a:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f9d:	81 fe 00 10 00 00    	cmp    $0x1000,%esi
+  801fa3:	76 1d                	jbe    801fc2 <devfile_read+0x34>
+  801fa5:	83 ec 0c             	sub    $0xc,%esp
+  801fa8:	56                   	push   %esi
+  801fa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fac:	ba 05 00 00 00       	mov    $0x5,%edx
+  801fb1:	89 f8                	mov    %edi,%eax
+  801fb3:	e8 32 fc ff ff       	call   801bea <fsring_rw>
+  801fb8:	89 c3                	mov    %eax,%ebx
+  801fba:	83 c4 10             	add    $0x10,%esp
+  801fbd:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801fc0:	75 37                	jne    801ff9 <devfile_read+0x6b>
+  801fc2:	8b 47 0c             	mov    0xc(%edi),%eax
+  801fc5:	a3 00 60 80 00       	mov    %eax,0x806000
+  801fca:	89 35 04 60 80 00    	mov    %esi,0x806004
+  801fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fda:	e8 20 fb ff ff       	call   801aff <fsipc>
+  801fdf:	89 c3                	mov    %eax,%ebx
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	78 14                	js     801ff9 <devfile_read+0x6b>
+  801fe5:	83 ec 04             	sub    $0x4,%esp
+  801fe8:	50                   	push   %eax
+  801fe9:	68 00 60 80 00       	push   $0x806000
+  801fee:	ff 75 0c             	push   0xc(%ebp)
+  801ff1:	e8 59 ea ff ff       	call   800a4f <memmove>
+  801ff6:	83 c4 10             	add    $0x10,%esp
+  801ff9:	89 d8                	mov    %ebx,%eax
+  801ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ffe:	5b                   	pop    %ebx
+  801fff:	5e                   	pop    %esi
+  802000:	5f                   	pop    %edi
+  802001:	5d                   	pop    %ebp
+  802002:	c3                   	ret
+
+00802003 <open>:
+  802003:	55                   	push   %ebp
+  802004:	89 e5                	mov    %esp,%ebp
+  802006:	56                   	push   %esi
+  802007:	53                   	push   %ebx
+  802008:	83 ec 1c             	sub    $0x1c,%esp
+  80200b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80200e:	56                   	push   %esi
+  80200f:	e8 3f e8 ff ff       	call   800853 <strlen>
+  802014:	83 c4 10             	add    $0x10,%esp
+  802017:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80201c:	7f 6c                	jg     80208a <open+0x87>
+  80201e:	83 ec 0c             	sub    $0xc,%esp
+  802021:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802024:	50                   	push   %eax
+  802025:	e8 6a f5 ff ff       	call   801594 <fd_alloc>
+  80202a:	89 c3                	mov    %eax,%ebx
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 3c                	js     80206f <open+0x6c>
+  802033:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802036:	a3 00 64 80 00       	mov    %eax,0x806400
+  80203b:	83 ec 08             	sub    $0x8,%esp
+  80203e:	56                   	push   %esi
+  80203f:	68 00 60 80 00       	push   $0x806000
+  802044:	e8 56 e8 ff ff       	call   80089f <strcpy>
+  802049:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80204c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802051:	e8 a9 fa ff ff       	call   801aff <fsipc>
+  802056:	89 c3                	mov    %eax,%ebx
+  802058:	83 c4 10             	add    $0x10,%esp
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	78 19                	js     802078 <open+0x75>
+  80205f:	83 ec 0c             	sub    $0xc,%esp
+  802062:	ff 75 f4             	push   -0xc(%ebp)
+  802065:	e8 03 f5 ff ff       	call   80156d <fd2num>
+  80206a:	89 c3                	mov    %eax,%ebx
+  80206c:	83 c4 10             	add    $0x10,%esp
+  80206f:	89 d8                	mov    %ebx,%eax
+  802071:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802074:	5b                   	pop    %ebx
+  802075:	5e                   	pop    %esi
+  802076:	5d                   	pop    %ebp
+  802077:	c3                   	ret
+  802078:	83 ec 08             	sub    $0x8,%esp
+  80207b:	6a 00                	push   $0x0
+  80207d:	ff 75 f4             	push   -0xc(%ebp)
+  802080:	e8 05 f6 ff ff       	call   80168a <fd_close>
+  802085:	83 c4 10             	add    $0x10,%esp
+  802088:	eb e5                	jmp    80206f <open+0x6c>
+  80208a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80208f:	eb de                	jmp    80206f <open+0x6c>
+
+00802091 <file_image>:
+  802091:	55                   	push   %ebp
+  802092:	89 e5                	mov    %esp,%ebp
+  802094:	53                   	push   %ebx
+  802095:	83 ec 1c             	sub    $0x1c,%esp
+  802098:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80209b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80209e:	50                   	push   %eax
+  80209f:	ff 75 08             	push   0x8(%ebp)
+  8020a2:	e8 3d f5 ff ff       	call   8015e4 <fd_lookup>
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	78 58                	js     802106 <file_image+0x75>
+  8020ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020b1:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020b7:	39 08                	cmp    %ecx,(%eax)
+  8020b9:	75 50                	jne    80210b <file_image+0x7a>
+  8020bb:	83 fb 04             	cmp    $0x4,%ebx
+  8020be:	77 52                	ja     802112 <file_image+0x81>
+  8020c0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020c3:	a3 00 60 80 00       	mov    %eax,0x806000
+  8020c8:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  8020ce:	83 ec 04             	sub    $0x4,%esp
+  8020d1:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8020d4:	c1 e0 02             	shl    $0x2,%eax
+  8020d7:	50                   	push   %eax
+  8020d8:	ff 75 0c             	push   0xc(%ebp)
+  8020db:	68 08 60 80 00       	push   $0x806008
+  8020e0:	e8 6a e9 ff ff       	call   800a4f <memmove>
+  8020e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020ef:	e8 0b fa ff ff       	call   801aff <fsipc>
+  8020f4:	83 c4 10             	add    $0x10,%esp
+  8020f7:	85 c0                	test   %eax,%eax
+  8020f9:	78 0b                	js     802106 <file_image+0x75>
+  8020fb:	8b 55 14             	mov    0x14(%ebp),%edx
+  8020fe:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802104:	89 0a                	mov    %ecx,(%edx)
+  802106:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802109:	c9                   	leave
+  80210a:	c3                   	ret
+  80210b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802110:	eb f4                	jmp    802106 <file_image+0x75>
+  802112:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802117:	eb ed                	jmp    802106 <file_image+0x75>
+
+00802119 <remove>:
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+  80211c:	53                   	push   %ebx
+  80211d:	83 ec 10             	sub    $0x10,%esp
+  802120:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802123:	53                   	push   %ebx
+  802124:	e8 2a e7 ff ff       	call   800853 <strlen>
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802131:	7f 25                	jg     802158 <remove+0x3f>
+  802133:	83 ec 08             	sub    $0x8,%esp
+  802136:	53                   	push   %ebx
+  802137:	68 00 60 80 00       	push   $0x806000
+  80213c:	e8 5e e7 ff ff       	call   80089f <strcpy>
+  802141:	ba 00 00 00 00       	mov    $0x0,%edx
+  802146:	b8 09 00 00 00       	mov    $0x9,%eax
+  80214b:	e8 af f9 ff ff       	call   801aff <fsipc>
+  802150:	83 c4 10             	add    $0x10,%esp
+  802153:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802156:	c9                   	leave
+  802157:	c3                   	ret
+  802158:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80215d:	eb f4                	jmp    802153 <remove+0x3a>
+
+0080215f <sync>:
+  80215f:	55                   	push   %ebp
+  802160:	89 e5                	mov    %esp,%ebp
+  802162:	83 ec 08             	sub    $0x8,%esp
+  802165:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80216f:	e8 8b f9 ff ff       	call   801aff <fsipc>
+  802174:	c9                   	leave
+  802175:	c3                   	ret
+
+00802176 <devsock_stat>:
+  802176:	55                   	push   %ebp
+  802177:	89 e5                	mov    %esp,%ebp
+  802179:	83 ec 10             	sub    $0x10,%esp
+  80217c:	68 08 36 80 00       	push   $0x803608
+  802181:	ff 75 0c             	push   0xc(%ebp)
+  802184:	e8 16 e7 ff ff       	call   80089f <strcpy>
+  802189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+
+00802190 <devsock_close>:
+  802190:	55                   	push   %ebp
+  802191:	89 e5                	mov    %esp,%ebp
+  802193:	53                   	push   %ebx
+  802194:	83 ec 10             	sub    $0x10,%esp
+  802197:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80219a:	53                   	push   %ebx
+  80219b:	e8 df 0d 00 00       	call   802f7f <pageref>
+  8021a0:	89 c2                	mov    %eax,%edx
+  8021a2:	83 c4 10             	add    $0x10,%esp
+  8021a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021aa:	83 fa 01             	cmp    $0x1,%edx
+  8021ad:	74 05                	je     8021b4 <devsock_close+0x24>
+  8021af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b2:	c9                   	leave
+  8021b3:	c3                   	ret
+  8021b4:	83 ec 0c             	sub    $0xc,%esp
+  8021b7:	ff 73 0c             	push   0xc(%ebx)
+  8021ba:	e8 aa 02 00 00       	call   802469 <nsipc_close>
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	eb eb                	jmp    8021af <devsock_close+0x1f>
+
+008021c4 <devsock_write>:
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+  8021ca:	6a 00                	push   $0x0
+  8021cc:	ff 75 10             	push   0x10(%ebp)
+  8021cf:	ff 75 0c             	push   0xc(%ebp)
+  8021d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d5:	ff 70 0c             	push   0xc(%eax)
+  8021d8:	e8 6c 03 00 00       	call   802549 <nsipc_send>
+  8021dd:	c9                   	leave
+  8021de:	c3                   	ret
+
+008021df <devsock_read>:
+  8021df:	55                   	push   %ebp
+  8021e0:	89 e5                	mov    %esp,%ebp
+  8021e2:	83 ec 08             	sub    $0x8,%esp
+  8021e5:	6a 00                	push   $0x0
+  8021e7:	ff 75 10             	push   0x10(%ebp)
+  8021ea:	ff 75 0c             	push   0xc(%ebp)
+  8021ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f0:	ff 70 0c             	push   0xc(%eax)
+  8021f3:	e8 e2 02 00 00       	call   8024da <nsipc_recv>
+  8021f8:	c9                   	leave
+  8021f9:	c3                   	ret
+
+008021fa <fd2sockid>:
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	83 ec 20             	sub    $0x20,%esp
+  802200:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802203:	52                   	push   %edx
+  802204:	50                   	push   %eax
+  802205:	e8 da f3 ff ff       	call   8015e4 <fd_lookup>
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 10                	js     802221 <fd2sockid+0x27>
+  802211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802214:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80221a:	39 08                	cmp    %ecx,(%eax)
+  80221c:	75 05                	jne    802223 <fd2sockid+0x29>
+  80221e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802221:	c9                   	leave
+  802222:	c3                   	ret
+  802223:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802228:	eb f7                	jmp    802221 <fd2sockid+0x27>
+
+0080222a <alloc_sockfd>:
+  80222a:	55                   	push   %ebp
+  80222b:	89 e5                	mov    %esp,%ebp
+  80222d:	56                   	push   %esi
+  80222e:	53                   	push   %ebx
+  80222f:	83 ec 1c             	sub    $0x1c,%esp
+  802232:	89 c6                	mov    %eax,%esi
+  802234:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802237:	50                   	push   %eax
+  802238:	e8 57 f3 ff ff       	call   801594 <fd_alloc>
+  80223d:	89 c3                	mov    %eax,%ebx
+  80223f:	83 c4 10             	add    $0x10,%esp
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 43                	js     802289 <alloc_sockfd+0x5f>
+  802246:	83 ec 04             	sub    $0x4,%esp
+  802249:	68 07 04 00 00       	push   $0x407
+  80224e:	ff 75 f4             	push   -0xc(%ebp)
+  802251:	6a 00                	push   $0x0
+  802253:	e8 a7 ea ff ff       	call   800cff <sys_page_alloc>
+  802258:	89 c3                	mov    %eax,%ebx
+  80225a:	83 c4 10             	add    $0x10,%esp
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	78 28                	js     802289 <alloc_sockfd+0x5f>
+  802261:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802264:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80226a:	89 10                	mov    %edx,(%eax)
+  80226c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80226f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802276:	89 70 0c             	mov    %esi,0xc(%eax)
+  802279:	83 ec 0c             	sub    $0xc,%esp
+  80227c:	50                   	push   %eax
+  80227d:	e8 eb f2 ff ff       	call   80156d <fd2num>
+  802282:	89 c3                	mov    %eax,%ebx
+  802284:	83 c4 10             	add    $0x10,%esp
+  802287:	eb 0c                	jmp    802295 <alloc_sockfd+0x6b>
+  802289:	83 ec 0c             	sub    $0xc,%esp
+  80228c:	56                   	push   %esi
+  80228d:	e8 d7 01 00 00       	call   802469 <nsipc_close>
+  802292:	83 c4 10             	add    $0x10,%esp
+  802295:	89 d8                	mov    %ebx,%eax
+  802297:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80229a:	5b                   	pop    %ebx
+  80229b:	5e                   	pop    %esi
+  80229c:	5d                   	pop    %ebp
+  80229d:	c3                   	ret
+
+0080229e <accept>:
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	83 ec 08             	sub    $0x8,%esp
+  8022a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a7:	e8 4e ff ff ff       	call   8021fa <fd2sockid>
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	78 1b                	js     8022cb <accept+0x2d>
+  8022b0:	83 ec 04             	sub    $0x4,%esp
+  8022b3:	ff 75 10             	push   0x10(%ebp)
+  8022b6:	ff 75 0c             	push   0xc(%ebp)
+  8022b9:	50                   	push   %eax
+  8022ba:	e8 07 01 00 00       	call   8023c6 <nsipc_accept>
+  8022bf:	83 c4 10             	add    $0x10,%esp
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	78 05                	js     8022cb <accept+0x2d>
+  8022c6:	e8 5f ff ff ff       	call   80222a <alloc_sockfd>
+  8022cb:	c9                   	leave
+  8022cc:	c3                   	ret
+
+008022cd <bind>:
+  8022cd:	55                   	push   %ebp
+  8022ce:	89 e5                	mov    %esp,%ebp
+  8022d0:	83 ec 08             	sub    $0x8,%esp
+  8022d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d6:	e8 1f ff ff ff       	call   8021fa <fd2sockid>
+  8022db:	85 c0                	test   %eax,%eax
+  8022dd:	78 12                	js     8022f1 <bind+0x24>
+  8022df:	83 ec 04             	sub    $0x4,%esp
+  8022e2:	ff 75 10             	push   0x10(%ebp)
+  8022e5:	ff 75 0c             	push   0xc(%ebp)
+  8022e8:	50                   	push   %eax
+  8022e9:	e8 24 01 00 00       	call   802412 <nsipc_bind>
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	c9                   	leave
+  8022f2:	c3                   	ret
+
+008022f3 <shutdown>:
+  8022f3:	55                   	push   %ebp
+  8022f4:	89 e5                	mov    %esp,%ebp
+  8022f6:	83 ec 08             	sub    $0x8,%esp
+  8022f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fc:	e8 f9 fe ff ff       	call   8021fa <fd2sockid>
+  802301:	85 c0                	test   %eax,%eax
+  802303:	78 0f                	js     802314 <shutdown+0x21>
+  802305:	83 ec 08             	sub    $0x8,%esp
+  802308:	ff 75 0c             	push   0xc(%ebp)
+  80230b:	50                   	push   %eax
+  80230c:	e8 36 01 00 00       	call   802447 <nsipc_shutdown>
+  802311:	83 c4 10             	add    $0x10,%esp
+  802314:	c9                   	leave
+  802315:	c3                   	ret
+
+00802316 <connect>:
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	83 ec 08             	sub    $0x8,%esp
+  80231c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231f:	e8 d6 fe ff ff       	call   8021fa <fd2sockid>
+  802324:	85 c0                	test   %eax,%eax
+  802326:	78 12                	js     80233a <connect+0x24>
+  802328:	83 ec 04             	sub    $0x4,%esp
+  80232b:	ff 75 10             	push   0x10(%ebp)
+  80232e:	ff 75 0c             	push   0xc(%ebp)
+  802331:	50                   	push   %eax
+  802332:	e8 4c 01 00 00       	call   802483 <nsipc_connect>
+  802337:	83 c4 10             	add    $0x10,%esp
+  80233a:	c9                   	leave
+  80233b:	c3                   	ret
+
+0080233c <listen>:
+  80233c:	55                   	push   %ebp
+  80233d:	89 e5                	mov    %esp,%ebp
+  80233f:	83 ec 08             	sub    $0x8,%esp
+  802342:	8b 45 08             	mov    0x8(%ebp),%eax
+  802345:	e8 b0 fe ff ff       	call   8021fa <fd2sockid>
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	78 0f                	js     80235d <listen+0x21>
+  80234e:	83 ec 08             	sub    $0x8,%esp
+  802351:	ff 75 0c             	push   0xc(%ebp)
+  802354:	50                   	push   %eax
+  802355:	e8 5e 01 00 00       	call   8024b8 <nsipc_listen>
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	c9                   	leave
+  80235e:	c3                   	ret
+
+0080235f <socket>:
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	83 ec 0c             	sub    $0xc,%esp
+  802365:	ff 75 10             	push   0x10(%ebp)
+  802368:	ff 75 0c             	push   0xc(%ebp)
+  80236b:	ff 75 08             	push   0x8(%ebp)
+  80236e:	e8 34 02 00 00       	call   8025a7 <nsipc_socket>
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	85 c0                	test   %eax,%eax
+  802378:	78 05                	js     80237f <socket+0x20>
+  80237a:	e8 ab fe ff ff       	call   80222a <alloc_sockfd>
+  80237f:	c9                   	leave
+  802380:	c3                   	ret
+
+00802381 <nsipc>:
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+  802384:	53                   	push   %ebx
+  802385:	83 ec 04             	sub    $0x4,%esp
+  802388:	89 c3                	mov    %eax,%ebx
+  80238a:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  802391:	74 1f                	je     8023b2 <nsipc+0x31>
+  802393:	83 ec 08             	sub    $0x8,%esp
+  802396:	6a 00                	push   $0x0
+  802398:	6a 00                	push   $0x0
+  80239a:	6a 07                	push   $0x7
+  80239c:	68 00 70 80 00       	push   $0x807000
+  8023a1:	53                   	push   %ebx
+  8023a2:	ff 35 0c 50 80 00    	push   0x80500c
+  8023a8:	e8 1d 0a 00 00       	call   802dca <ipc_call>
+  8023ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023b0:	c9                   	leave
+  8023b1:	c3                   	ret
+  8023b2:	83 ec 0c             	sub    $0xc,%esp
+  8023b5:	6a 03                	push   $0x3
+  8023b7:	e8 a9 0b 00 00       	call   802f65 <ipc_find_env>
+  8023bc:	a3 0c 50 80 00       	mov    %eax,0x80500c
+  8023c1:	83 c4 10             	add    $0x10,%esp
+  8023c4:	eb cd                	jmp    802393 <nsipc+0x12>
+
+008023c6 <nsipc_accept>:
+  8023c6:	55                   	push   %ebp
+  8023c7:	89 e5                	mov    %esp,%ebp
+  8023c9:	53                   	push   %ebx
+  8023ca:	83 ec 04             	sub    $0x4,%esp
+  8023cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8023d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023da:	e8 a2 ff ff ff       	call   802381 <nsipc>
+  8023df:	89 c3                	mov    %eax,%ebx
+  8023e1:	85 c0                	test   %eax,%eax
+  8023e3:	79 07                	jns    8023ec <nsipc_accept+0x26>
+  8023e5:	89 d8                	mov    %ebx,%eax
+  8023e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ea:	c9                   	leave
+  8023eb:	c3                   	ret
+  8023ec:	83 ec 04             	sub    $0x4,%esp
+  8023ef:	ff 35 10 70 80 00    	push   0x807010
+  8023f5:	68 00 70 80 00       	push   $0x807000
+  8023fa:	ff 75 0c             	push   0xc(%ebp)
+  8023fd:	e8 4d e6 ff ff       	call   800a4f <memmove>
+  802402:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  802408:	8b 45 10             	mov    0x10(%ebp),%eax
+  80240b:	89 10                	mov    %edx,(%eax)
+  80240d:	83 c4 10             	add    $0x10,%esp
+  802410:	eb d3                	jmp    8023e5 <nsipc_accept+0x1f>
+
+00802412 <nsipc_bind>:
+  802412:	55                   	push   %ebp
+  802413:	89 e5                	mov    %esp,%ebp
+  802415:	53                   	push   %ebx
+  802416:	83 ec 08             	sub    $0x8,%esp
+  802419:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80241c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80241f:	a3 00 70 80 00       	mov    %eax,0x807000
+  802424:	53                   	push   %ebx
+  802425:	ff 75 0c             	push   0xc(%ebp)
+  802428:	68 04 70 80 00       	push   $0x807004
+  80242d:	e8 1d e6 ff ff       	call   800a4f <memmove>
+  802432:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  802438:	b8 02 00 00 00       	mov    $0x2,%eax
+  80243d:	e8 3f ff ff ff       	call   802381 <nsipc>
+  802442:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802445:	c9                   	leave
+  802446:	c3                   	ret
+
+00802447 <nsipc_shutdown>:
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	83 ec 08             	sub    $0x8,%esp
+  80244d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802450:	a3 00 70 80 00       	mov    %eax,0x807000
+  802455:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802458:	a3 04 70 80 00       	mov    %eax,0x807004
+  80245d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802462:	e8 1a ff ff ff       	call   802381 <nsipc>
+  802467:	c9                   	leave
+  802468:	c3                   	ret
+
+00802469 <nsipc_close>:
+  802469:	55                   	push   %ebp
+  80246a:	89 e5                	mov    %esp,%ebp
+  80246c:	83 ec 08             	sub    $0x8,%esp
+  80246f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802472:	a3 00 70 80 00       	mov    %eax,0x807000
+  802477:	b8 04 00 00 00       	mov    $0x4,%eax
+  80247c:	e8 00 ff ff ff       	call   802381 <nsipc>
+  802481:	c9                   	leave
+  802482:	c3                   	ret
+
+00802483 <nsipc_connect>:
+  802483:	55                   	push   %ebp
+  802484:	89 e5                	mov    %esp,%ebp
+  802486:	53                   	push   %ebx
+  802487:	83 ec 08             	sub    $0x8,%esp
+  80248a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80248d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802490:	a3 00 70 80 00       	mov    %eax,0x807000
+  802495:	53                   	push   %ebx
+  802496:	ff 75 0c             	push   0xc(%ebp)
+  802499:	68 04 70 80 00       	push   $0x807004
+  80249e:	e8 ac e5 ff ff       	call   800a4f <memmove>
+  8024a3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+  8024a9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024ae:	e8 ce fe ff ff       	call   802381 <nsipc>
+  8024b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b6:	c9                   	leave
+  8024b7:	c3                   	ret
+
+008024b8 <nsipc_listen>:
+  8024b8:	55                   	push   %ebp
+  8024b9:	89 e5                	mov    %esp,%ebp
+  8024bb:	83 ec 08             	sub    $0x8,%esp
+  8024be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c1:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024c9:	a3 04 70 80 00       	mov    %eax,0x807004
+  8024ce:	b8 06 00 00 00       	mov    $0x6,%eax
+  8024d3:	e8 a9 fe ff ff       	call   802381 <nsipc>
+  8024d8:	c9                   	leave
+  8024d9:	c3                   	ret
+
+008024da <nsipc_recv>:
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	56                   	push   %esi
+  8024de:	53                   	push   %ebx
+  8024df:	8b 75 10             	mov    0x10(%ebp),%esi
+  8024e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e5:	a3 00 70 80 00       	mov    %eax,0x807000
+  8024ea:	89 35 04 70 80 00    	mov    %esi,0x807004
+  8024f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024f3:	a3 08 70 80 00       	mov    %eax,0x807008
+  8024f8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024fd:	e8 7f fe ff ff       	call   802381 <nsipc>
+  802502:	89 c3                	mov    %eax,%ebx
+  802504:	85 c0                	test   %eax,%eax
+  802506:	78 22                	js     80252a <nsipc_recv+0x50>
+  802508:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80250d:	39 c6                	cmp    %eax,%esi
+  80250f:	0f 4e c6             	cmovle %esi,%eax
+  802512:	39 c3                	cmp    %eax,%ebx
+  802514:	7f 1d                	jg     802533 <nsipc_recv+0x59>
+  802516:	83 ec 04             	sub    $0x4,%esp
+  802519:	53                   	push   %ebx
+  80251a:	68 00 70 80 00       	push   $0x807000
+  80251f:	ff 75 0c             	push   0xc(%ebp)
+  802522:	e8 28 e5 ff ff       	call   800a4f <memmove>
+  802527:	83 c4 10             	add    $0x10,%esp
+  80252a:	89 d8                	mov    %ebx,%eax
+  80252c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80252f:	5b                   	pop    %ebx
+  802530:	5e                   	pop    %esi
+  802531:	5d                   	pop    %ebp
+  802532:	c3                   	ret
+  802533:	68 14 36 80 00       	push   $0x803614
+  802538:	68 29 36 80 00       	push   $0x803629
+  80253d:	6a 60                	push   $0x60
+  80253f:	68 3e 36 80 00       	push   $0x80363e
+  802544:	e8 83 07 00 00       	call   802ccc <_panic>
+
+00802549 <nsipc_send>:
+  802549:	55                   	push   %ebp
+  80254a:	89 e5                	mov    %esp,%ebp
+  80254c:	53                   	push   %ebx
+  80254d:	83 ec 04             	sub    $0x4,%esp
+  802550:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802553:	8b 45 08             	mov    0x8(%ebp),%eax
+  802556:	a3 00 70 80 00       	mov    %eax,0x807000
+  80255b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802561:	7f 2e                	jg     802591 <nsipc_send+0x48>
+  802563:	83 ec 04             	sub    $0x4,%esp
+  802566:	53                   	push   %ebx
+  802567:	ff 75 0c             	push   0xc(%ebp)
+  80256a:	68 0c 70 80 00       	push   $0x80700c
+  80256f:	e8 db e4 ff ff       	call   800a4f <memmove>
+  802574:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  80257a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80257d:	a3 08 70 80 00       	mov    %eax,0x807008
+  802582:	b8 08 00 00 00       	mov    $0x8,%eax
+  802587:	e8 f5 fd ff ff       	call   802381 <nsipc>
+  80258c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80258f:	c9                   	leave
+  802590:	c3                   	ret
+  802591:	68 4a 36 80 00       	push   $0x80364a
+  802596:	68 29 36 80 00       	push   $0x803629
+  80259b:	6a 6b                	push   $0x6b
+  80259d:	68 3e 36 80 00       	push   $0x80363e
+  8025a2:	e8 25 07 00 00       	call   802ccc <_panic>
+
+008025a7 <nsipc_socket>:
+  8025a7:	55                   	push   %ebp
+  8025a8:	89 e5                	mov    %esp,%ebp
+  8025aa:	83 ec 08             	sub    $0x8,%esp
+  8025ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b0:	a3 00 70 80 00       	mov    %eax,0x807000
+  8025b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025b8:	a3 04 70 80 00       	mov    %eax,0x807004
+  8025bd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025c0:	a3 08 70 80 00       	mov    %eax,0x807008
+  8025c5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025ca:	e8 b2 fd ff ff       	call   802381 <nsipc>
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+
+008025d1 <devpipe_stat>:
+  8025d1:	55                   	push   %ebp
+  8025d2:	89 e5                	mov    %esp,%ebp
+  8025d4:	56                   	push   %esi
+  8025d5:	53                   	push   %ebx
+  8025d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025d9:	83 ec 0c             	sub    $0xc,%esp
+  8025dc:	ff 75 08             	push   0x8(%ebp)
+  8025df:	e8 99 ef ff ff       	call   80157d <fd2data>
+  8025e4:	89 c6                	mov    %eax,%esi
+  8025e6:	83 c4 08             	add    $0x8,%esp
+  8025e9:	68 56 36 80 00       	push   $0x803656
+  8025ee:	53                   	push   %ebx
+  8025ef:	e8 ab e2 ff ff       	call   80089f <strcpy>
+  8025f4:	8b 46 04             	mov    0x4(%esi),%eax
+  8025f7:	2b 06                	sub    (%esi),%eax
+  8025f9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  8025ff:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802606:	00 00 00 
+  802609:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802610:	40 80 00 
+  802613:	b8 00 00 00 00       	mov    $0x0,%eax
+  802618:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80261b:	5b                   	pop    %ebx
+  80261c:	5e                   	pop    %esi
+  80261d:	5d                   	pop    %ebp
+  80261e:	c3                   	ret
+
+0080261f <devpipe_close>:
+  80261f:	55                   	push   %ebp
+  802620:	89 e5                	mov    %esp,%ebp
+  802622:	53                   	push   %ebx
+  802623:	83 ec 0c             	sub    $0xc,%esp
+  802626:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802629:	53                   	push   %ebx
+  80262a:	6a 00                	push   $0x0
+  80262c:	e8 a0 e7 ff ff       	call   800dd1 <sys_page_unmap>
+  802631:	89 1c 24             	mov    %ebx,(%esp)
+  802634:	e8 44 ef ff ff       	call   80157d <fd2data>
+  802639:	83 c4 08             	add    $0x8,%esp
+  80263c:	50                   	push   %eax
+  80263d:	6a 00                	push   $0x0
+  80263f:	e8 8d e7 ff ff       	call   800dd1 <sys_page_unmap>
+  802644:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802647:	c9                   	leave
+  802648:	c3                   	ret
+
+00802649 <_pipeisclosed>:
+  802649:	55                   	push   %ebp
+  80264a:	89 e5                	mov    %esp,%ebp
+  80264c:	57                   	push   %edi
+  80264d:	56                   	push   %esi
+  80264e:	53                   	push   %ebx
+  80264f:	83 ec 1c             	sub    $0x1c,%esp
+  802652:	89 c7                	mov    %eax,%edi
+  802654:	89 d6                	mov    %edx,%esi
+  802656:	a1 10 50 80 00       	mov    0x805010,%eax
+  80265b:	8b 58 58             	mov    0x58(%eax),%ebx
+  80265e:	83 ec 0c             	sub    $0xc,%esp
+  802661:	57                   	push   %edi
+  802662:	e8 18 09 00 00       	call   802f7f <pageref>
+  802667:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80266a:	89 34 24             	mov    %esi,(%esp)
+  80266d:	e8 0d 09 00 00       	call   802f7f <pageref>
+  802672:	8b 15 10 50 80 00    	mov    0x805010,%edx
+  802678:	8b 4a 58             	mov    0x58(%edx),%ecx
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	39 cb                	cmp    %ecx,%ebx
+  802680:	74 1b                	je     80269d <_pipeisclosed+0x54>
+  802682:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802685:	75 cf                	jne    802656 <_pipeisclosed+0xd>
+  802687:	8b 42 58             	mov    0x58(%edx),%eax
+  80268a:	6a 01                	push   $0x1
+  80268c:	50                   	push   %eax
+  80268d:	53                   	push   %ebx
+  80268e:	68 5d 36 80 00       	push   $0x80365d
+  802693:	e8 10 db ff ff       	call   8001a8 <cprintf>
+  802698:	83 c4 10             	add    $0x10,%esp
+  80269b:	eb b9                	jmp    802656 <_pipeisclosed+0xd>
+  80269d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026a0:	0f 94 c0             	sete   %al
+  8026a3:	0f b6 c0             	movzbl %al,%eax
+  8026a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a9:	5b                   	pop    %ebx
+  8026aa:	5e                   	pop    %esi
+  8026ab:	5f                   	pop    %edi
+  8026ac:	5d                   	pop    %ebp
+  8026ad:	c3                   	ret
+
+008026ae <devpipe_write>:
+  8026ae:	55                   	push   %ebp
+  8026af:	89 e5                	mov    %esp,%ebp
+  8026b1:	57                   	push   %edi
+  8026b2:	56                   	push   %esi
+  8026b3:	53                   	push   %ebx
+  8026b4:	83 ec 28             	sub    $0x28,%esp
+  8026b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8026ba:	56                   	push   %esi
+  8026bb:	e8 bd ee ff ff       	call   80157d <fd2data>
+  8026c0:	89 c3                	mov    %eax,%ebx
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ca:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8026ce:	74 5c                	je     80272c <devpipe_write+0x7e>
+  8026d0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026d3:	8b 0b                	mov    (%ebx),%ecx
+  8026d5:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026d8:	39 d0                	cmp    %edx,%eax
+  8026da:	72 1e                	jb     8026fa <devpipe_write+0x4c>
+  8026dc:	89 da                	mov    %ebx,%edx
+  8026de:	89 f0                	mov    %esi,%eax
+  8026e0:	e8 64 ff ff ff       	call   802649 <_pipeisclosed>
+  8026e5:	85 c0                	test   %eax,%eax
+  8026e7:	75 48                	jne    802731 <devpipe_write+0x83>
+  8026e9:	e8 c6 e5 ff ff       	call   800cb4 <sys_yield>
+  8026ee:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026f1:	8b 0b                	mov    (%ebx),%ecx
+  8026f3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026f6:	39 d0                	cmp    %edx,%eax
+  8026f8:	73 e2                	jae    8026dc <devpipe_write+0x2e>
+  8026fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026fd:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802701:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802704:	89 c2                	mov    %eax,%edx
+  802706:	c1 fa 1f             	sar    $0x1f,%edx
+  802709:	89 d1                	mov    %edx,%ecx
+  80270b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80270e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802711:	83 e2 1f             	and    $0x1f,%edx
+  802714:	29 ca                	sub    %ecx,%edx
+  802716:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80271a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  80271e:	83 c0 01             	add    $0x1,%eax
+  802721:	89 43 04             	mov    %eax,0x4(%ebx)
+  802724:	83 c7 01             	add    $0x1,%edi
+  802727:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  80272a:	75 a4                	jne    8026d0 <devpipe_write+0x22>
+  80272c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80272f:	eb 05                	jmp    802736 <devpipe_write+0x88>
+  802731:	b8 00 00 00 00       	mov    $0x0,%eax
+  802736:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802739:	5b                   	pop    %ebx
+  80273a:	5e                   	pop    %esi
+  80273b:	5f                   	pop    %edi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+
+0080273e <devpipe_read>:
+  80273e:	55                   	push   %ebp
+  80273f:	89 e5                	mov    %esp,%ebp
+  802741:	57                   	push   %edi
+  802742:	56                   	push   %esi
+  802743:	53                   	push   %ebx
+  802744:	83 ec 18             	sub    $0x18,%esp
+  802747:	8b 75 08             	mov    0x8(%ebp),%esi
+  80274a:	56                   	push   %esi
+  80274b:	e8 2d ee ff ff       	call   80157d <fd2data>
+  802750:	89 c3                	mov    %eax,%ebx
+  802752:	83 c4 10             	add    $0x10,%esp
+  802755:	bf 00 00 00 00       	mov    $0x0,%edi
+  80275a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80275e:	74 45                	je     8027a5 <devpipe_read+0x67>
+  802760:	8b 03                	mov    (%ebx),%eax
+  802762:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802765:	75 1d                	jne    802784 <devpipe_read+0x46>
+  802767:	85 ff                	test   %edi,%edi
+  802769:	75 3f                	jne    8027aa <devpipe_read+0x6c>
+  80276b:	89 da                	mov    %ebx,%edx
+  80276d:	89 f0                	mov    %esi,%eax
+  80276f:	e8 d5 fe ff ff       	call   802649 <_pipeisclosed>
+  802774:	85 c0                	test   %eax,%eax
+  802776:	75 3c                	jne    8027b4 <devpipe_read+0x76>
+  802778:	e8 37 e5 ff ff       	call   800cb4 <sys_yield>
+  80277d:	8b 03                	mov    (%ebx),%eax
+  80277f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802782:	74 e7                	je     80276b <devpipe_read+0x2d>
+  802784:	99                   	cltd
+  802785:	c1 ea 1b             	shr    $0x1b,%edx
+  802788:	01 d0                	add    %edx,%eax
+  80278a:	83 e0 1f             	and    $0x1f,%eax
+  80278d:	29 d0                	sub    %edx,%eax
+  80278f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802797:	88 04 39             	mov    %al,(%ecx,%edi,1)
+  80279a:	83 03 01             	addl   $0x1,(%ebx)
+  80279d:	83 c7 01             	add    $0x1,%edi
+  8027a0:	39 7d 10             	cmp    %edi,0x10(%ebp)
+  8027a3:	75 bb                	jne    802760 <devpipe_read+0x22>
+  8027a5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027a8:	eb 02                	jmp    8027ac <devpipe_read+0x6e>
+  8027aa:	89 f8                	mov    %edi,%eax
+  8027ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027af:	5b                   	pop    %ebx
+  8027b0:	5e                   	pop    %esi
+  8027b1:	5f                   	pop    %edi
+  8027b2:	5d                   	pop    %ebp
+  8027b3:	c3                   	ret
+  8027b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b9:	eb f1                	jmp    8027ac <devpipe_read+0x6e>
+
+008027bb <pipe>:
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	56                   	push   %esi
+  8027bf:	53                   	push   %ebx
+  8027c0:	83 ec 1c             	sub    $0x1c,%esp
+  8027c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027c6:	50                   	push   %eax
+  8027c7:	e8 c8 ed ff ff       	call   801594 <fd_alloc>
+  8027cc:	89 c3                	mov    %eax,%ebx
+  8027ce:	83 c4 10             	add    $0x10,%esp
+  8027d1:	85 c0                	test   %eax,%eax
+  8027d3:	0f 88 23 01 00 00    	js     8028fc <pipe+0x141>
+  8027d9:	83 ec 04             	sub    $0x4,%esp
+  8027dc:	68 07 04 00 00       	push   $0x407
+  8027e1:	ff 75 f4             	push   -0xc(%ebp)
+  8027e4:	6a 00                	push   $0x0
+  8027e6:	e8 14 e5 ff ff       	call   800cff <sys_page_alloc>
+  8027eb:	89 c3                	mov    %eax,%ebx
+  8027ed:	83 c4 10             	add    $0x10,%esp
+  8027f0:	85 c0                	test   %eax,%eax
+  8027f2:	0f 88 04 01 00 00    	js     8028fc <pipe+0x141>
+  8027f8:	83 ec 0c             	sub    $0xc,%esp
+  8027fb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027fe:	50                   	push   %eax
+  8027ff:	e8 90 ed ff ff       	call   801594 <fd_alloc>
+  802804:	89 c3                	mov    %eax,%ebx
+  802806:	83 c4 10             	add    $0x10,%esp
+  802809:	85 c0                	test   %eax,%eax
+  80280b:	0f 88 db 00 00 00    	js     8028ec <pipe+0x131>
+  802811:	83 ec 04             	sub    $0x4,%esp
+  802814:	68 07 04 00 00       	push   $0x407
+  802819:	ff 75 f0             	push   -0x10(%ebp)
+  80281c:	6a 00                	push   $0x0
+  80281e:	e8 dc e4 ff ff       	call   800cff <sys_page_alloc>
+  802823:	89 c3                	mov    %eax,%ebx
+  802825:	83 c4 10             	add    $0x10,%esp
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	0f 88 bc 00 00 00    	js     8028ec <pipe+0x131>
+  802830:	83 ec 0c             	sub    $0xc,%esp
+  802833:	ff 75 f4             	push   -0xc(%ebp)
+  802836:	e8 42 ed ff ff       	call   80157d <fd2data>
+  80283b:	89 c6                	mov    %eax,%esi
+  80283d:	83 c4 0c             	add    $0xc,%esp
+  802840:	68 07 04 00 00       	push   $0x407
+  802845:	50                   	push   %eax
+  802846:	6a 00                	push   $0x0
+  802848:	e8 b2 e4 ff ff       	call   800cff <sys_page_alloc>
+  80284d:	89 c3                	mov    %eax,%ebx
+  80284f:	83 c4 10             	add    $0x10,%esp
+  802852:	85 c0                	test   %eax,%eax
+  802854:	0f 88 82 00 00 00    	js     8028dc <pipe+0x121>
+  80285a:	83 ec 0c             	sub    $0xc,%esp
+  80285d:	ff 75 f0             	push   -0x10(%ebp)
+  802860:	e8 18 ed ff ff       	call   80157d <fd2data>
+  802865:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80286c:	50                   	push   %eax
+  80286d:	6a 00                	push   $0x0
+  80286f:	56                   	push   %esi
+  802870:	6a 00                	push   $0x0
+  802872:	e8 cb e4 ff ff       	call   800d42 <sys_page_map>
+  802877:	89 c3                	mov    %eax,%ebx
+  802879:	83 c4 20             	add    $0x20,%esp
+  80287c:	85 c0                	test   %eax,%eax
+  80287e:	78 4e                	js     8028ce <pipe+0x113>
+  802880:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802885:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802888:	89 02                	mov    %eax,(%edx)
+  80288a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80288d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  802894:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802897:	89 02                	mov    %eax,(%edx)
+  802899:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80289c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  8028a3:	83 ec 0c             	sub    $0xc,%esp
+  8028a6:	ff 75 f4             	push   -0xc(%ebp)
+  8028a9:	e8 bf ec ff ff       	call   80156d <fd2num>
+  8028ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028b1:	89 01                	mov    %eax,(%ecx)
+  8028b3:	83 c4 04             	add    $0x4,%esp
+  8028b6:	ff 75 f0             	push   -0x10(%ebp)
+  8028b9:	e8 af ec ff ff       	call   80156d <fd2num>
+  8028be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028c1:	89 41 04             	mov    %eax,0x4(%ecx)
+  8028c4:	83 c4 10             	add    $0x10,%esp
+  8028c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028cc:	eb 2e                	jmp    8028fc <pipe+0x141>
+  8028ce:	83 ec 08             	sub    $0x8,%esp
+  8028d1:	56                   	push   %esi
+  8028d2:	6a 00                	push   $0x0
+  8028d4:	e8 f8 e4 ff ff       	call   800dd1 <sys_page_unmap>
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	83 ec 08             	sub    $0x8,%esp
+  8028df:	ff 75 f0             	push   -0x10(%ebp)
+  8028e2:	6a 00                	push   $0x0
+  8028e4:	e8 e8 e4 ff ff       	call   800dd1 <sys_page_unmap>
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	83 ec 08             	sub    $0x8,%esp
+  8028ef:	ff 75 f4             	push   -0xc(%ebp)
+  8028f2:	6a 00                	push   $0x0
+  8028f4:	e8 d8 e4 ff ff       	call   800dd1 <sys_page_unmap>
+  8028f9:	83 c4 10             	add    $0x10,%esp
+  8028fc:	89 d8                	mov    %ebx,%eax
+  8028fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802901:	5b                   	pop    %ebx
+  802902:	5e                   	pop    %esi
+  802903:	5d                   	pop    %ebp
+  802904:	c3                   	ret
+
+00802905 <pipeisclosed>:
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	83 ec 20             	sub    $0x20,%esp
+  80290b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80290e:	50                   	push   %eax
+  80290f:	ff 75 08             	push   0x8(%ebp)
+  802912:	e8 cd ec ff ff       	call   8015e4 <fd_lookup>
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	78 18                	js     802936 <pipeisclosed+0x31>
+  80291e:	83 ec 0c             	sub    $0xc,%esp
+  802921:	ff 75 f4             	push   -0xc(%ebp)
+  802924:	e8 54 ec ff ff       	call   80157d <fd2data>
+  802929:	89 c2                	mov    %eax,%edx
+  80292b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80292e:	e8 16 fd ff ff       	call   802649 <_pipeisclosed>
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	c9                   	leave
+  802937:	c3                   	ret
+
+00802938 <ipcring_init>:
+  802938:	55                   	push   %ebp
+  802939:	89 e5                	mov    %esp,%ebp
+  80293b:	53                   	push   %ebx
+  80293c:	83 ec 08             	sub    $0x8,%esp
+  80293f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802942:	6a 60                	push   $0x60
+  802944:	6a 00                	push   $0x0
+  802946:	53                   	push   %ebx
+  802947:	e8 ce e0 ff ff       	call   800a1a <memset>
+  80294c:	a1 10 50 80 00       	mov    0x805010,%eax
+  802951:	8b 40 48             	mov    0x48(%eax),%eax
+  802954:	89 03                	mov    %eax,(%ebx)
+  802956:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802959:	89 43 04             	mov    %eax,0x4(%ebx)
+  80295c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80295f:	89 43 08             	mov    %eax,0x8(%ebx)
+  802962:	8b 45 14             	mov    0x14(%ebp),%eax
+  802965:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802968:	83 c4 10             	add    $0x10,%esp
+  80296b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80296e:	c9                   	leave
+  80296f:	c3                   	ret
+
+00802970 <ipcring_req_slot>:
+  802970:	55                   	push   %ebp
+  802971:	89 e5                	mov    %esp,%ebp
+  802973:	8b 45 08             	mov    0x8(%ebp),%eax
+  802976:	8b 50 10             	mov    0x10(%eax),%edx
+  802979:	8b 48 18             	mov    0x18(%eax),%ecx
+  80297c:	29 ca                	sub    %ecx,%edx
+  80297e:	83 fa 07             	cmp    $0x7,%edx
+  802981:	77 0c                	ja     80298f <ipcring_req_slot+0x1f>
+  802983:	8b 50 10             	mov    0x10(%eax),%edx
+  802986:	83 e2 07             	and    $0x7,%edx
+  802989:	8d 44 d0 20          	lea    0x20(%eax,%edx,8),%eax
+  80298d:	5d                   	pop    %ebp
+  80298e:	c3                   	ret
+  80298f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802994:	eb f7                	jmp    80298d <ipcring_req_slot+0x1d>
+
+00802996 <ipcring_req_push>:
+  802996:	55                   	push   %ebp
+  802997:	89 e5                	mov    %esp,%ebp
+  802999:	83 ec 08             	sub    $0x8,%esp
+  80299c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80299f:	8b 42 10             	mov    0x10(%edx),%eax
+  8029a2:	83 c0 01             	add    $0x1,%eax
+  8029a5:	f0 87 42 10          	lock xchg %eax,0x10(%edx)
+  8029a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ae:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  8029b2:	85 c0                	test   %eax,%eax
+  8029b4:	75 02                	jne    8029b8 <ipcring_req_push+0x22>
+  8029b6:	c9                   	leave
+  8029b7:	c3                   	ret
+  8029b8:	6a 00                	push   $0x0
+  8029ba:	68 00 00 80 ee       	push   $0xee800000
+  8029bf:	ff 72 08             	push   0x8(%edx)
+  8029c2:	ff 72 04             	push   0x4(%edx)
+  8029c5:	e8 6d e6 ff ff       	call   801037 <sys_ipc_send>
+  8029ca:	83 c4 10             	add    $0x10,%esp
+  8029cd:	eb e7                	jmp    8029b6 <ipcring_req_push+0x20>
+
+008029cf <ipcring_rsp_wait>:
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	53                   	push   %ebx
+  8029d3:	83 ec 04             	sub    $0x4,%esp
+  8029d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029d9:	8b 53 18             	mov    0x18(%ebx),%edx
+  8029dc:	8b 43 10             	mov    0x10(%ebx),%eax
+  8029df:	39 c2                	cmp    %eax,%edx
+  8029e1:	74 3c                	je     802a1f <ipcring_rsp_wait+0x50>
+  8029e3:	8b 53 14             	mov    0x14(%ebx),%edx
+  8029e6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029e9:	39 c2                	cmp    %eax,%edx
+  8029eb:	75 23                	jne    802a10 <ipcring_rsp_wait+0x41>
+  8029ed:	83 ec 08             	sub    $0x8,%esp
+  8029f0:	6a 00                	push   $0x0
+  8029f2:	6a 00                	push   $0x0
+  8029f4:	6a 00                	push   $0x0
+  8029f6:	6a 00                	push   $0x0
+  8029f8:	ff 73 0c             	push   0xc(%ebx)
+  8029fb:	ff 73 04             	push   0x4(%ebx)
+  8029fe:	e8 c7 03 00 00       	call   802dca <ipc_call>
+  802a03:	8b 53 14             	mov    0x14(%ebx),%edx
+  802a06:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a09:	83 c4 20             	add    $0x20,%esp
+  802a0c:	39 c2                	cmp    %eax,%edx
+  802a0e:	74 dd                	je     8029ed <ipcring_rsp_wait+0x1e>
+  802a10:	8b 43 18             	mov    0x18(%ebx),%eax
+  802a13:	83 e0 07             	and    $0x7,%eax
+  802a16:	8d 44 c3 20          	lea    0x20(%ebx,%eax,8),%eax
+  802a1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a1d:	c9                   	leave
+  802a1e:	c3                   	ret
+  802a1f:	68 78 36 80 00       	push   $0x803678
+  802a24:	68 29 36 80 00       	push   $0x803629
+  802a29:	6a 3b                	push   $0x3b
+  802a2b:	68 99 36 80 00       	push   $0x803699
+  802a30:	e8 97 02 00 00       	call   802ccc <_panic>
+
+00802a35 <ipcring_rsp_pop>:
+  802a35:	55                   	push   %ebp
+  802a36:	89 e5                	mov    %esp,%ebp
+  802a38:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a3b:	8b 42 18             	mov    0x18(%edx),%eax
+  802a3e:	83 c0 01             	add    $0x1,%eax
+  802a41:	89 42 18             	mov    %eax,0x18(%edx)
+  802a44:	5d                   	pop    %ebp
+  802a45:	c3                   	ret
+
+00802a46 <ipcring_server_init>:
+  802a46:	55                   	push   %ebp
+  802a47:	89 e5                	mov    %esp,%ebp
+  802a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a4f:	89 10                	mov    %edx,(%eax)
+  802a51:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a54:	89 50 04             	mov    %edx,0x4(%eax)
+  802a57:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  802a5e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802a65:	5d                   	pop    %ebp
+  802a66:	c3                   	ret
+
+00802a67 <ipcring_req_avail>:
+  802a67:	55                   	push   %ebp
+  802a68:	89 e5                	mov    %esp,%ebp
+  802a6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a6d:	8b 02                	mov    (%edx),%eax
+  802a6f:	8b 40 10             	mov    0x10(%eax),%eax
+  802a72:	2b 42 08             	sub    0x8(%edx),%eax
+  802a75:	ba 08 00 00 00       	mov    $0x8,%edx
+  802a7a:	39 d0                	cmp    %edx,%eax
+  802a7c:	0f 47 c2             	cmova  %edx,%eax
+  802a7f:	5d                   	pop    %ebp
+  802a80:	c3                   	ret
+
+00802a81 <ipcring_req_peek>:
+  802a81:	55                   	push   %ebp
+  802a82:	89 e5                	mov    %esp,%ebp
+  802a84:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a87:	8b 42 08             	mov    0x8(%edx),%eax
+  802a8a:	83 e0 07             	and    $0x7,%eax
+  802a8d:	8b 12                	mov    (%edx),%edx
+  802a8f:	8d 44 c2 20          	lea    0x20(%edx,%eax,8),%eax
+  802a93:	5d                   	pop    %ebp
+  802a94:	c3                   	ret
+
+00802a95 <ipcring_rsp_push>:
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+  802a98:	83 ec 08             	sub    $0x8,%esp
+  802a9b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a9e:	8b 41 08             	mov    0x8(%ecx),%eax
+  802aa1:	83 c0 01             	add    $0x1,%eax
+  802aa4:	89 41 08             	mov    %eax,0x8(%ecx)
+  802aa7:	8b 11                	mov    (%ecx),%edx
+  802aa9:	83 c2 14             	add    $0x14,%edx
+  802aac:	f0 87 02             	lock xchg %eax,(%edx)
+  802aaf:	83 79 0c 00          	cmpl   $0x0,0xc(%ecx)
+  802ab3:	75 02                	jne    802ab7 <ipcring_rsp_push+0x22>
+  802ab5:	c9                   	leave
+  802ab6:	c3                   	ret
+  802ab7:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+  802abe:	6a 00                	push   $0x0
+  802ac0:	68 00 00 80 ee       	push   $0xee800000
+  802ac5:	6a 00                	push   $0x0
+  802ac7:	ff 71 04             	push   0x4(%ecx)
+  802aca:	e8 8b e4 ff ff       	call   800f5a <sys_ipc_try_send>
+  802acf:	83 c4 10             	add    $0x10,%esp
+  802ad2:	eb e1                	jmp    802ab5 <ipcring_rsp_push+0x20>
+
+00802ad4 <ipcring_client_wait>:
+  802ad4:	55                   	push   %ebp
+  802ad5:	89 e5                	mov    %esp,%ebp
+  802ad7:	83 ec 08             	sub    $0x8,%esp
+  802ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  802add:	c7 40 0c 01 00 00 00 	movl   $0x1,0xc(%eax)
+  802ae4:	8b 10                	mov    (%eax),%edx
+  802ae6:	8b 52 18             	mov    0x18(%edx),%edx
+  802ae9:	3b 50 08             	cmp    0x8(%eax),%edx
+  802aec:	75 02                	jne    802af0 <ipcring_client_wait+0x1c>
+  802aee:	c9                   	leave
+  802aef:	c3                   	ret
+  802af0:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  802af7:	6a 00                	push   $0x0
+  802af9:	68 00 00 80 ee       	push   $0xee800000
+  802afe:	6a 00                	push   $0x0
+  802b00:	ff 70 04             	push   0x4(%eax)
+  802b03:	e8 52 e4 ff ff       	call   800f5a <sys_ipc_try_send>
+  802b08:	83 c4 10             	add    $0x10,%esp
+  802b0b:	eb e1                	jmp    802aee <ipcring_client_wait+0x1a>
+
+00802b0d <ipcring_server_sleep>:
+  802b0d:	55                   	push   %ebp
+  802b0e:	89 e5                	mov    %esp,%ebp
+  802b10:	53                   	push   %ebx
+  802b11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b14:	8b 01                	mov    (%ecx),%eax
+  802b16:	8d 50 1c             	lea    0x1c(%eax),%edx
+  802b19:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b1e:	f0 87 02             	lock xchg %eax,(%edx)
+  802b21:	8b 11                	mov    (%ecx),%edx
+  802b23:	8b 5a 10             	mov    0x10(%edx),%ebx
+  802b26:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b2b:	3b 59 08             	cmp    0x8(%ecx),%ebx
+  802b2e:	74 0e                	je     802b3e <ipcring_server_sleep+0x31>
+  802b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b35:	f0 87 42 1c          	lock xchg %eax,0x1c(%edx)
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+
+00802b43 <devcons_close>:
+  802b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b48:	c3                   	ret
+
+00802b49 <devcons_stat>:
+  802b49:	55                   	push   %ebp
+  802b4a:	89 e5                	mov    %esp,%ebp
+  802b4c:	83 ec 10             	sub    $0x10,%esp
+  802b4f:	68 a7 36 80 00       	push   $0x8036a7
+  802b54:	ff 75 0c             	push   0xc(%ebp)
+  802b57:	e8 43 dd ff ff       	call   80089f <strcpy>
+  802b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b61:	c9                   	leave
+  802b62:	c3                   	ret
+
+00802b63 <devcons_write>:
+  802b63:	55                   	push   %ebp
+  802b64:	89 e5                	mov    %esp,%ebp
+  802b66:	57                   	push   %edi
+  802b67:	56                   	push   %esi
+  802b68:	53                   	push   %ebx
+  802b69:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802b6f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802b72:	85 ff                	test   %edi,%edi
+  802b74:	74 51                	je     802bc7 <devcons_write+0x64>
+  802b76:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b80:	89 fb                	mov    %edi,%ebx
+  802b82:	29 c3                	sub    %eax,%ebx
+  802b84:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  802b89:	39 d3                	cmp    %edx,%ebx
+  802b8b:	0f 47 da             	cmova  %edx,%ebx
+  802b8e:	83 ec 04             	sub    $0x4,%esp
+  802b91:	53                   	push   %ebx
+  802b92:	03 45 0c             	add    0xc(%ebp),%eax
+  802b95:	50                   	push   %eax
+  802b96:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802b9c:	50                   	push   %eax
+  802b9d:	e8 ad de ff ff       	call   800a4f <memmove>
+  802ba2:	83 c4 08             	add    $0x8,%esp
+  802ba5:	53                   	push   %ebx
+  802ba6:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802bac:	50                   	push   %eax
+  802bad:	e8 65 e0 ff ff       	call   800c17 <sys_cputs>
+  802bb2:	01 de                	add    %ebx,%esi
+  802bb4:	89 f0                	mov    %esi,%eax
+  802bb6:	83 c4 10             	add    $0x10,%esp
+  802bb9:	39 fe                	cmp    %edi,%esi
+  802bbb:	72 c3                	jb     802b80 <devcons_write+0x1d>
+  802bbd:	89 f0                	mov    %esi,%eax
+  802bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bc2:	5b                   	pop    %ebx
+  802bc3:	5e                   	pop    %esi
+  802bc4:	5f                   	pop    %edi
+  802bc5:	5d                   	pop    %ebp
+  802bc6:	c3                   	ret
+  802bc7:	be 00 00 00 00       	mov    $0x0,%esi
+  802bcc:	eb ef                	jmp    802bbd <devcons_write+0x5a>
+
+00802bce <devcons_read>:
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	83 ec 08             	sub    $0x8,%esp
+  802bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802bdd:	75 07                	jne    802be6 <devcons_read+0x18>
+  802bdf:	eb 1f                	jmp    802c00 <devcons_read+0x32>
+  802be1:	e8 ce e0 ff ff       	call   800cb4 <sys_yield>
+  802be6:	e8 4a e0 ff ff       	call   800c35 <sys_cgetc>
+  802beb:	85 c0                	test   %eax,%eax
+  802bed:	74 f2                	je     802be1 <devcons_read+0x13>
+  802bef:	78 0f                	js     802c00 <devcons_read+0x32>
+  802bf1:	83 f8 04             	cmp    $0x4,%eax
+  802bf4:	74 0c                	je     802c02 <devcons_read+0x34>
+  802bf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bf9:	88 02                	mov    %al,(%edx)
+  802bfb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c00:	c9                   	leave
+  802c01:	c3                   	ret
+  802c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c07:	eb f7                	jmp    802c00 <devcons_read+0x32>
+
+00802c09 <cputchar>:
+  802c09:	55                   	push   %ebp
+  802c0a:	89 e5                	mov    %esp,%ebp
+  802c0c:	83 ec 20             	sub    $0x20,%esp
+  802c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c12:	88 45 f7             	mov    %al,-0x9(%ebp)
+  802c15:	6a 01                	push   $0x1
+  802c17:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c1a:	50                   	push   %eax
+  802c1b:	e8 f7 df ff ff       	call   800c17 <sys_cputs>
+  802c20:	83 c4 10             	add    $0x10,%esp
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+00802c25 <getchar>:
+  802c25:	55                   	push   %ebp
+  802c26:	89 e5                	mov    %esp,%ebp
+  802c28:	83 ec 1c             	sub    $0x1c,%esp
+  802c2b:	6a 01                	push   $0x1
+  802c2d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c30:	50                   	push   %eax
+  802c31:	6a 00                	push   $0x0
+  802c33:	e8 0e ec ff ff       	call   801846 <read>
+  802c38:	83 c4 10             	add    $0x10,%esp
+  802c3b:	85 c0                	test   %eax,%eax
+  802c3d:	78 06                	js     802c45 <getchar+0x20>
+  802c3f:	74 06                	je     802c47 <getchar+0x22>
+  802c41:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+  802c47:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c4c:	eb f7                	jmp    802c45 <getchar+0x20>
+
+00802c4e <iscons>:
+  802c4e:	55                   	push   %ebp
+  802c4f:	89 e5                	mov    %esp,%ebp
+  802c51:	83 ec 20             	sub    $0x20,%esp
+  802c54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c57:	50                   	push   %eax
+  802c58:	ff 75 08             	push   0x8(%ebp)
+  802c5b:	e8 84 e9 ff ff       	call   8015e4 <fd_lookup>
+  802c60:	83 c4 10             	add    $0x10,%esp
+  802c63:	85 c0                	test   %eax,%eax
+  802c65:	78 11                	js     802c78 <iscons+0x2a>
+  802c67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c6a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c70:	39 10                	cmp    %edx,(%eax)
+  802c72:	0f 94 c0             	sete   %al
+  802c75:	0f b6 c0             	movzbl %al,%eax
+  802c78:	c9                   	leave
+  802c79:	c3                   	ret
+
+00802c7a <opencons>:
+  802c7a:	55                   	push   %ebp
+  802c7b:	89 e5                	mov    %esp,%ebp
+  802c7d:	83 ec 24             	sub    $0x24,%esp
+  802c80:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c83:	50                   	push   %eax
+  802c84:	e8 0b e9 ff ff       	call   801594 <fd_alloc>
+  802c89:	83 c4 10             	add    $0x10,%esp
+  802c8c:	85 c0                	test   %eax,%eax
+  802c8e:	78 3a                	js     802cca <opencons+0x50>
+  802c90:	83 ec 04             	sub    $0x4,%esp
+  802c93:	68 07 04 00 00       	push   $0x407
+  802c98:	ff 75 f4             	push   -0xc(%ebp)
+  802c9b:	6a 00                	push   $0x0
+  802c9d:	e8 5d e0 ff ff       	call   800cff <sys_page_alloc>
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	78 21                	js     802cca <opencons+0x50>
+  802ca9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cac:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802cb2:	89 10                	mov    %edx,(%eax)
+  802cb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cb7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  802cbe:	83 ec 0c             	sub    $0xc,%esp
+  802cc1:	50                   	push   %eax
+  802cc2:	e8 a6 e8 ff ff       	call   80156d <fd2num>
+  802cc7:	83 c4 10             	add    $0x10,%esp
+  802cca:	c9                   	leave
+  802ccb:	c3                   	ret
+
+00802ccc <_panic>:
+  802ccc:	55                   	push   %ebp
+  802ccd:	89 e5                	mov    %esp,%ebp
+  802ccf:	56                   	push   %esi
+  802cd0:	53                   	push   %ebx
+  802cd1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  802cd4:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802cda:	e8 b6 df ff ff       	call   800c95 <sys_getenvid>
+  802cdf:	83 ec 0c             	sub    $0xc,%esp
+  802ce2:	ff 75 0c             	push   0xc(%ebp)
+  802ce5:	ff 75 08             	push   0x8(%ebp)
+  802ce8:	56                   	push   %esi
+  802ce9:	50                   	push   %eax
+  802cea:	68 b4 36 80 00       	push   $0x8036b4
+  802cef:	e8 b4 d4 ff ff       	call   8001a8 <cprintf>
+  802cf4:	83 c4 18             	add    $0x18,%esp
+  802cf7:	53                   	push   %ebx
+  802cf8:	ff 75 10             	push   0x10(%ebp)
+  802cfb:	e8 57 d4 ff ff       	call   800157 <vcprintf>
+  802d00:	c7 04 24 6e 36 80 00 	movl   $0x80366e,(%esp)
+  802d07:	e8 9c d4 ff ff       	call   8001a8 <cprintf>
+  802d0c:	83 c4 10             	add    $0x10,%esp
+  802d0f:	cc                   	int3
+  802d10:	eb fd                	jmp    802d0f <_panic+0x43>
+
+00802d12 <ipc_recv>:
+  802d12:	55                   	push   %ebp
+  802d13:	89 e5                	mov    %esp,%ebp
+  802d15:	56                   	push   %esi
+  802d16:	53                   	push   %ebx
+  802d17:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+  802d27:	0f 44 c2             	cmove  %edx,%eax
+  802d2a:	83 ec 0c             	sub    $0xc,%esp
+  802d2d:	50                   	push   %eax
+  802d2e:	e8 77 e2 ff ff       	call   800faa <sys_ipc_recv>
+  802d33:	83 c4 10             	add    $0x10,%esp
+  802d36:	85 c0                	test   %eax,%eax
+  802d38:	78 2a                	js     802d64 <ipc_recv+0x52>
+  802d3a:	a1 10 50 80 00       	mov    0x805010,%eax
+  802d3f:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+  802d45:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+  802d4b:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802d51:	85 f6                	test   %esi,%esi
+  802d53:	74 02                	je     802d57 <ipc_recv+0x45>
+  802d55:	89 0e                	mov    %ecx,(%esi)
+  802d57:	85 db                	test   %ebx,%ebx
+  802d59:	74 02                	je     802d5d <ipc_recv+0x4b>
+  802d5b:	89 13                	mov    %edx,(%ebx)
+  802d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d60:	5b                   	pop    %ebx
+  802d61:	5e                   	pop    %esi
+  802d62:	5d                   	pop    %ebp
+  802d63:	c3                   	ret
+  802d64:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d6e:	eb e1                	jmp    802d51 <ipc_recv+0x3f>
+
+00802d70 <ipc_send>:
+  802d70:	55                   	push   %ebp
+  802d71:	89 e5                	mov    %esp,%ebp
+  802d73:	57                   	push   %edi
+  802d74:	56                   	push   %esi
+  802d75:	53                   	push   %ebx
+  802d76:	83 ec 0c             	sub    $0xc,%esp
+  802d79:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802d7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d7f:	8b 75 14             	mov    0x14(%ebp),%esi
+  802d82:	85 db                	test   %ebx,%ebx
+  802d84:	74 1e                	je     802da4 <ipc_send+0x34>
+  802d86:	56                   	push   %esi
+  802d87:	53                   	push   %ebx
+  802d88:	57                   	push   %edi
+  802d89:	ff 75 08             	push   0x8(%ebp)
+  802d8c:	e8 a6 e2 ff ff       	call   801037 <sys_ipc_send>
+  802d91:	83 c4 10             	add    $0x10,%esp
+  802d94:	85 c0                	test   %eax,%eax
+  802d96:	74 2a                	je     802dc2 <ipc_send+0x52>
+  802d98:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d9b:	75 13                	jne    802db0 <ipc_send+0x40>
+  802d9d:	e8 12 df ff ff       	call   800cb4 <sys_yield>
+  802da2:	eb e2                	jmp    802d86 <ipc_send+0x16>
+  802da4:	be 00 00 00 00       	mov    $0x0,%esi
+  802da9:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802dae:	eb d6                	jmp    802d86 <ipc_send+0x16>
+  802db0:	50                   	push   %eax
+  802db1:	68 d8 36 80 00       	push   $0x8036d8
+  802db6:	6a 4f                	push   $0x4f
+  802db8:	68 1b 37 80 00       	push   $0x80371b
+  802dbd:	e8 0a ff ff ff       	call   802ccc <_panic>
+  802dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dc5:	5b                   	pop    %ebx
+  802dc6:	5e                   	pop    %esi
+  802dc7:	5f                   	pop    %edi
+  802dc8:	5d                   	pop    %ebp
+  802dc9:	c3                   	ret
+
+00802dca <ipc_call>:
+  802dca:	55                   	push   %ebp
+  802dcb:	89 e5                	mov    %esp,%ebp
+  802dcd:	57                   	push   %edi
+  802dce:	56                   	push   %esi
+  802dcf:	53                   	push   %ebx
+  802dd0:	83 ec 0c             	sub    $0xc,%esp
+  802dd3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dd7:	bf 00 00 80 ee       	mov    $0xee800000,%edi
+  802ddc:	0f 45 7d 10          	cmovne 0x10(%ebp),%edi
+  802de0:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802de4:	be 00 00 80 ee       	mov    $0xee800000,%esi
+  802de9:	0f 45 75 18          	cmovne 0x18(%ebp),%esi
+  802ded:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802df1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df6:	0f 45 5d 14          	cmovne 0x14(%ebp),%ebx
+  802dfa:	eb 05                	jmp    802e01 <ipc_call+0x37>
+  802dfc:	e8 b3 de ff ff       	call   800cb4 <sys_yield>
+  802e01:	83 ec 0c             	sub    $0xc,%esp
+  802e04:	56                   	push   %esi
+  802e05:	53                   	push   %ebx
+  802e06:	57                   	push   %edi
+  802e07:	ff 75 0c             	push   0xc(%ebp)
+  802e0a:	ff 75 08             	push   0x8(%ebp)
+  802e0d:	e8 75 e2 ff ff       	call   801087 <sys_ipc_call>
+  802e12:	83 c4 20             	add    $0x20,%esp
+  802e15:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e18:	74 e2                	je     802dfc <ipc_call+0x32>
+  802e1a:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  802e1d:	74 2d                	je     802e4c <ipc_call+0x82>
+  802e1f:	85 c0                	test   %eax,%eax
+  802e21:	78 4f                	js     802e72 <ipc_call+0xa8>
+  802e23:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802e27:	74 10                	je     802e39 <ipc_call+0x6f>
+  802e29:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e2e:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802e34:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802e37:	89 02                	mov    %eax,(%edx)
+  802e39:	a1 10 50 80 00       	mov    0x805010,%eax
+  802e3e:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e47:	5b                   	pop    %ebx
+  802e48:	5e                   	pop    %esi
+  802e49:	5f                   	pop    %edi
+  802e4a:	5d                   	pop    %ebp
+  802e4b:	c3                   	ret
+  802e4c:	ff 75 14             	push   0x14(%ebp)
+  802e4f:	ff 75 10             	push   0x10(%ebp)
+  802e52:	ff 75 0c             	push   0xc(%ebp)
+  802e55:	ff 75 08             	push   0x8(%ebp)
+  802e58:	e8 13 ff ff ff       	call   802d70 <ipc_send>
+  802e5d:	83 c4 0c             	add    $0xc,%esp
+  802e60:	ff 75 1c             	push   0x1c(%ebp)
+  802e63:	ff 75 18             	push   0x18(%ebp)
+  802e66:	6a 00                	push   $0x0
+  802e68:	e8 a5 fe ff ff       	call   802d12 <ipc_recv>
+  802e6d:	83 c4 10             	add    $0x10,%esp
+  802e70:	eb d2                	jmp    802e44 <ipc_call+0x7a>
+  802e72:	50                   	push   %eax
+  802e73:	68 25 37 80 00       	push   $0x803725
+  802e78:	6a 6d                	push   $0x6d
+  802e7a:	68 1b 37 80 00       	push   $0x80371b
+  802e7f:	e8 48 fe ff ff       	call   802ccc <_panic>
+
+00802e84 <ipc_reply_recv>:
+  802e84:	55                   	push   %ebp
+  802e85:	89 e5                	mov    %esp,%ebp
+  802e87:	57                   	push   %edi
+  802e88:	56                   	push   %esi
+  802e89:	53                   	push   %ebx
+  802e8a:	83 ec 0c             	sub    $0xc,%esp
+  802e8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e90:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  802e93:	8b 7d 20             	mov    0x20(%ebp),%edi
+  802e96:	85 db                	test   %ebx,%ebx
+  802e98:	0f 84 ac 00 00 00    	je     802f4a <ipc_reply_recv+0xc6>
+  802e9e:	85 f6                	test   %esi,%esi
+  802ea0:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802ea5:	0f 45 c6             	cmovne %esi,%eax
+  802ea8:	83 ec 0c             	sub    $0xc,%esp
+  802eab:	50                   	push   %eax
+  802eac:	ff 75 14             	push   0x14(%ebp)
+  802eaf:	53                   	push   %ebx
+  802eb0:	ff 75 0c             	push   0xc(%ebp)
+  802eb3:	ff 75 08             	push   0x8(%ebp)
+  802eb6:	e8 ed e1 ff ff       	call   8010a8 <sys_ipc_reply_recv>
+  802ebb:	83 c4 20             	add    $0x20,%esp
+  802ebe:	85 c0                	test   %eax,%eax
+  802ec0:	78 3a                	js     802efc <ipc_reply_recv+0x78>
+  802ec2:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  802ec6:	74 10                	je     802ed8 <ipc_reply_recv+0x54>
+  802ec8:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ecd:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+  802ed3:	8b 55 18             	mov    0x18(%ebp),%edx
+  802ed6:	89 02                	mov    %eax,(%edx)
+  802ed8:	85 ff                	test   %edi,%edi
+  802eda:	74 0d                	je     802ee9 <ipc_reply_recv+0x65>
+  802edc:	a1 10 50 80 00       	mov    0x805010,%eax
+  802ee1:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+  802ee7:	89 07                	mov    %eax,(%edi)
+  802ee9:	a1 10 50 80 00       	mov    0x805010,%eax
+  802eee:	8b 80 a0 00 00 00    	mov    0xa0(%eax),%eax
+  802ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef7:	5b                   	pop    %ebx
+  802ef8:	5e                   	pop    %esi
+  802ef9:	5f                   	pop    %edi
+  802efa:	5d                   	pop    %ebp
+  802efb:	c3                   	ret
+  802efc:	ff 75 14             	push   0x14(%ebp)
+  802eff:	53                   	push   %ebx
+  802f00:	ff 75 0c             	push   0xc(%ebp)
+  802f03:	ff 75 08             	push   0x8(%ebp)
+  802f06:	e8 4f e0 ff ff       	call   800f5a <sys_ipc_try_send>
+  802f0b:	89 c2                	mov    %eax,%edx
+  802f0d:	c1 ea 1f             	shr    $0x1f,%edx
+  802f10:	83 c4 10             	add    $0x10,%esp
+  802f13:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802f16:	0f 95 c1             	setne  %cl
+  802f19:	84 d1                	test   %dl,%cl
+  802f1b:	74 05                	je     802f22 <ipc_reply_recv+0x9e>
+  802f1d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f20:	75 12                	jne    802f34 <ipc_reply_recv+0xb0>
+  802f22:	83 ec 04             	sub    $0x4,%esp
+  802f25:	57                   	push   %edi
+  802f26:	56                   	push   %esi
+  802f27:	ff 75 18             	push   0x18(%ebp)
+  802f2a:	e8 e3 fd ff ff       	call   802d12 <ipc_recv>
+  802f2f:	83 c4 10             	add    $0x10,%esp
+  802f32:	eb c0                	jmp    802ef4 <ipc_reply_recv+0x70>
+  802f34:	83 ec 04             	sub    $0x4,%esp
+  802f37:	50                   	push   %eax
+  802f38:	ff 75 08             	push   0x8(%ebp)
+  802f3b:	68 f8 36 80 00       	push   $0x8036f8
+  802f40:	e8 63 d2 ff ff       	call   8001a8 <cprintf>
+  802f45:	83 c4 10             	add    $0x10,%esp
+  802f48:	eb d8                	jmp    802f22 <ipc_reply_recv+0x9e>
+  802f4a:	85 f6                	test   %esi,%esi
+  802f4c:	b8 00 00 80 ee       	mov    $0xee800000,%eax
+  802f51:	0f 45 c6             	cmovne %esi,%eax
+  802f54:	bb 00 00 80 ee       	mov    $0xee800000,%ebx
+  802f59:	c7 45 14 00 00 00 00 	movl   $0x0,0x14(%ebp)
+  802f60:	e9 43 ff ff ff       	jmp    802ea8 <ipc_reply_recv+0x24>
+
+00802f65 <ipc_find_env>:
+  802f65:	55                   	push   %ebp
+  802f66:	89 e5                	mov    %esp,%ebp
+  802f68:	83 ec 14             	sub    $0x14,%esp
+  802f6b:	ff 75 08             	push   0x8(%ebp)
+  802f6e:	e8 85 df ff ff       	call   800ef8 <sys_env_service>
+  802f73:	85 c0                	test   %eax,%eax
+  802f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f7a:	0f 48 c2             	cmovs  %edx,%eax
+  802f7d:	c9                   	leave
+  802f7e:	c3                   	ret
+
+00802f7f <pageref>:
+  802f7f:	55                   	push   %ebp
+  802f80:	89 e5                	mov    %esp,%ebp
+  802f82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f85:	89 c2                	mov    %eax,%edx
+  802f87:	c1 ea 16             	shr    $0x16,%edx
+  802f8a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  802f91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f96:	f6 c1 01             	test   $0x1,%cl
+  802f99:	74 22                	je     802fbd <pageref+0x3e>
+  802f9b:	c1 e8 0c             	shr    $0xc,%eax
+  802f9e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fa5:	a8 01                	test   $0x1,%al
+  802fa7:	74 14                	je     802fbd <pageref+0x3e>
+  802fa9:	c1 e8 0c             	shr    $0xc,%eax
+  802fac:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802faf:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802fb6:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  802fba:	0f b7 d2             	movzwl %dx,%edx
+  802fbd:	89 d0                	mov    %edx,%eax
+  802fbf:	5d                   	pop    %ebp
+  802fc0:	c3                   	ret
+
+00802fc1 <__udivmoddi4>:
+  802fc1:	55                   	push   %ebp
+  802fc2:	57                   	push   %edi
+  802fc3:	56                   	push   %esi
+  802fc4:	53                   	push   %ebx
+  802fc5:	83 ec 24             	sub    $0x24,%esp
+  802fc8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802fcc:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802fd0:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802fd4:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802fd8:	8b 44 24 40          	mov    0x40(%esp),%eax
+  802fdc:	8b 54 24 44          	mov    0x44(%esp),%edx
+  802fe0:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802fe4:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802fe8:	8b 7c 24 48          	mov    0x48(%esp),%edi
+  802fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ffb:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803002:	00 
+  803003:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80300a:	00 
+  80300b:	89 fb                	mov    %edi,%ebx
+  80300d:	eb 08                	jmp    803017 <__udivmoddi4+0x56>
+  80300f:	83 e9 01             	sub    $0x1,%ecx
+  803012:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803015:	74 68                	je     80307f <__udivmoddi4+0xbe>
+  803017:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80301b:	01 c0                	add    %eax,%eax
+  80301d:	89 c6                	mov    %eax,%esi
+  80301f:	89 d7                	mov    %edx,%edi
+  803021:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803025:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803029:	0f ad d0             	shrd   %cl,%edx,%eax
+  80302c:	d3 ea                	shr    %cl,%edx
+  80302e:	f6 c1 20             	test   $0x20,%cl
+  803031:	74 04                	je     803037 <__udivmoddi4+0x76>
+  803033:	89 d0                	mov    %edx,%eax
+  803035:	31 d2                	xor    %edx,%edx
+  803037:	83 e0 01             	and    $0x1,%eax
+  80303a:	89 04 24             	mov    %eax,(%esp)
+  80303d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803044:	00 
+  803045:	8b 04 24             	mov    (%esp),%eax
+  803048:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80304c:	09 f0                	or     %esi,%eax
+  80304e:	09 fa                	or     %edi,%edx
+  803050:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803054:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803058:	39 f0                	cmp    %esi,%eax
+  80305a:	89 d5                	mov    %edx,%ebp
+  80305c:	19 fd                	sbb    %edi,%ebp
+  80305e:	72 af                	jb     80300f <__udivmoddi4+0x4e>
+  803060:	29 f0                	sub    %esi,%eax
+  803062:	19 fa                	sbb    %edi,%edx
+  803064:	89 cf                	mov    %ecx,%edi
+  803066:	c1 ef 05             	shr    $0x5,%edi
+  803069:	83 e7 01             	and    $0x1,%edi
+  80306c:	89 fe                	mov    %edi,%esi
+  80306e:	83 f6 01             	xor    $0x1,%esi
+  803071:	d3 e6                	shl    %cl,%esi
+  803073:	d3 e7                	shl    %cl,%edi
+  803075:	09 74 24 18          	or     %esi,0x18(%esp)
+  803079:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80307d:	eb 90                	jmp    80300f <__udivmoddi4+0x4e>
+  80307f:	85 db                	test   %ebx,%ebx
+  803081:	74 05                	je     803088 <__udivmoddi4+0xc7>
+  803083:	89 03                	mov    %eax,(%ebx)
+  803085:	89 53 04             	mov    %edx,0x4(%ebx)
+  803088:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80308c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803090:	83 c4 24             	add    $0x24,%esp
+  803093:	5b                   	pop    %ebx
+  803094:	5e                   	pop    %esi
+  803095:	5f                   	pop    %edi
+  803096:	5d                   	pop    %ebp
+  803097:	c3                   	ret
+
+00803098 <__udivdi3>:
+  803098:	83 ec 08             	sub    $0x8,%esp
+  80309b:	6a 00                	push   $0x0
+  80309d:	ff 74 24 1c          	push   0x1c(%esp)
+  8030a1:	ff 74 24 1c          	push   0x1c(%esp)
+  8030a5:	ff 74 24 1c          	push   0x1c(%esp)
+  8030a9:	ff 74 24 1c          	push   0x1c(%esp)
+  8030ad:	e8 0f ff ff ff       	call   802fc1 <__udivmoddi4>
+  8030b2:	83 c4 1c             	add    $0x1c,%esp
+  8030b5:	c3                   	ret
+
+008030b6 <__umoddi3>:
+  8030b6:	83 ec 18             	sub    $0x18,%esp
+  8030b9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030bd:	50                   	push   %eax
+  8030be:	ff 74 24 2c          	push   0x2c(%esp)
+  8030c2:	ff 74 24 2c          	push   0x2c(%esp)
+  8030c6:	ff 74 24 2c          	push   0x2c(%esp)
+  8030ca:	ff 74 24 2c          	push   0x2c(%esp)
+  8030ce:	e8 ee fe ff ff       	call   802fc1 <__udivmoddi4>
+  8030d3:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8030d7:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8030db:	83 c4 2c             	add    $0x2c,%esp
+  8030de:	c3                   	ret
+
+008030df <__divdi3>:
+  8030df:	53                   	push   %ebx
+  8030e0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030e4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030e8:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8030ec:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8030f0:	85 d2                	test   %edx,%edx
+  8030f2:	78 12                	js     803106 <__divdi3+0x27>
+  8030f4:	85 db                	test   %ebx,%ebx
+  8030f6:	78 2e                	js     803126 <__divdi3+0x47>
+  8030f8:	53                   	push   %ebx
+  8030f9:	51                   	push   %ecx
+  8030fa:	52                   	push   %edx
+  8030fb:	50                   	push   %eax
+  8030fc:	e8 97 ff ff ff       	call   803098 <__udivdi3>
+  803101:	83 c4 10             	add    $0x10,%esp
+  803104:	eb 1e                	jmp    803124 <__divdi3+0x45>
+  803106:	f7 d8                	neg    %eax
+  803108:	83 d2 00             	adc    $0x0,%edx
+  80310b:	f7 da                	neg    %edx
+  80310d:	85 db                	test   %ebx,%ebx
+  80310f:	78 2a                	js     80313b <__divdi3+0x5c>
+  803111:	53                   	push   %ebx
+  803112:	51                   	push   %ecx
+  803113:	52                   	push   %edx
+  803114:	50                   	push   %eax
+  803115:	e8 7e ff ff ff       	call   803098 <__udivdi3>
+  80311a:	83 c4 10             	add    $0x10,%esp
+  80311d:	f7 d8                	neg    %eax
+  80311f:	83 d2 00             	adc    $0x0,%edx
+  803122:	f7 da                	neg    %edx
+  803124:	5b                   	pop    %ebx
+  803125:	c3                   	ret
+  803126:	f7 d9                	neg    %ecx
+  803128:	83 d3 00             	adc    $0x0,%ebx
+  80312b:	f7 db                	neg    %ebx
+  80312d:	53                   	push   %ebx
+  80312e:	51                   	push   %ecx
+  80312f:	52                   	push   %edx
+  803130:	50                   	push   %eax
+  803131:	e8 62 ff ff ff       	call   803098 <__udivdi3>
+  803136:	83 c4 10             	add    $0x10,%esp
+  803139:	eb e2                	jmp    80311d <__divdi3+0x3e>
+  80313b:	f7 d9                	neg    %ecx
+  80313d:	83 d3 00             	adc    $0x0,%ebx
+  803140:	f7 db                	neg    %ebx
+  803142:	53                   	push   %ebx
+  803143:	51                   	push   %ecx
+  803144:	52                   	push   %edx
+  803145:	50                   	push   %eax
+  803146:	e8 4d ff ff ff       	call   803098 <__udivdi3>
+  80314b:	83 c4 10             	add    $0x10,%esp
+  80314e:	eb d4                	jmp    803124 <__divdi3+0x45>
+
+00803150 <__moddi3>:
+  803150:	55                   	push   %ebp
+  803151:	57                   	push   %edi
+  803152:	56                   	push   %esi
+  803153:	53                   	push   %ebx
+  803154:	83 ec 0c             	sub    $0xc,%esp
+  803157:	8b 5c 24 24          	mov    0x24(%esp),%ebx
+  80315b:	8b 6c 24 28          	mov    0x28(%esp),%ebp
+  80315f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803163:	89 e9                	mov    %ebp,%ecx
+  803165:	f7 d9                	neg    %ecx
+  803167:	89 d0                	mov    %edx,%eax
+  803169:	83 d0 00             	adc    $0x0,%eax
+  80316c:	f7 d8                	neg    %eax
+  80316e:	0f 49 e9             	cmovns %ecx,%ebp
+  803171:	0f 49 d0             	cmovns %eax,%edx
+  803174:	52                   	push   %edx
+  803175:	55                   	push   %ebp
+  803176:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80317a:	f7 da                	neg    %edx
+  80317c:	89 d8                	mov    %ebx,%eax
+  80317e:	83 d0 00             	adc    $0x0,%eax
+  803181:	f7 d8                	neg    %eax
+  803183:	0f 48 54 24 28       	cmovs  0x28(%esp),%edx
+  803188:	89 54 24 08          	mov    %edx,0x8(%esp)
+  80318c:	0f 48 c3             	cmovs  %ebx,%eax
+  80318f:	89 44 24 0c          	mov    %eax,0xc(%esp)
+  803193:	ff 74 24 0c          	push   0xc(%esp)
+  803197:	ff 74 24 0c          	push   0xc(%esp)
+  80319b:	e8 16 ff ff ff       	call   8030b6 <__umoddi3>
+  8031a0:	83 c4 10             	add    $0x10,%esp
+  8031a3:	85 db                	test   %ebx,%ebx
+  8031a5:	78 08                	js     8031af <__moddi3+0x5f>
+  8031a7:	83 c4 0c             	add    $0xc,%esp
+  8031aa:	5b                   	pop    %ebx
+  8031ab:	5e                   	pop    %esi
+  8031ac:	5f                   	pop    %edi
+  8031ad:	5d                   	pop    %ebp
+  8031ae:	c3                   	ret
+  8031af:	f7 d8                	neg    %eax
+  8031b1:	83 d2 00             	adc    $0x0,%edx
+  8031b4:	f7 da                	neg    %edx
+  8031b6:	eb ef                	jmp    8031a7 <__moddi3+0x57>
@@ -9,10 +9,9 @@ umain(int argc, char **argv)
 	binaryname = "idle";
 
 	// Loop forever, simply trying to yield to a different environment.
-	// Instead of busy-waiting like this,
-	// a better way would be to use the processor's HLT instruction
-	// to cause the processor to stop executing until the next interrupt -
-	// doing so allows the processor to conserve power more effectively.
+	// When nothing else is runnable the kernel halts the processor
+	// with its timer stopped inside this sys_yield() (see sched_halt),
+	// so this loop only spins once per wakeup.
 	while (1) {
 		sys_yield();
 	}
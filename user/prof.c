@@ -0,0 +1,47 @@
+// Control the kernel's sampling profiler and print its histogram.
+//
+//	prof on [depth]		start sampling
+//	prof off		stop sampling
+//	prof reset		discard the samples
+//	prof [n]		print the n most sampled functions
+
+#include <inc/lib.h>
+
+#define NENTRY	64
+
+struct Prof_entry entries[NENTRY];
+
+static void
+usage(void)
+{
+	printf("usage: prof [on [depth] | off | reset | n]\n");
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+	int i, n, r;
+
+	binaryname = "prof";
+	if (argc > 1 && strcmp(argv[1], "on") == 0)
+		r = sys_prof(PROF_START, argc > 2 ? strtol(argv[2], 0, 0) : 0, 0);
+	else if (argc > 1 && strcmp(argv[1], "off") == 0)
+		r = sys_prof(PROF_STOP, 0, 0);
+	else if (argc > 1 && strcmp(argv[1], "reset") == 0)
+		r = sys_prof(PROF_RESET, 0, 0);
+	else {
+		n = argc > 1 ? strtol(argv[1], 0, 0) : 20;
+		if (n <= 0)
+			usage();
+		if ((r = sys_prof(PROF_REPORT, MIN(n, NENTRY), entries)) < 0)
+			panic("sys_prof: %e", r);
+		printf("  samples  env       function\n");
+		for (i = 0; i < r; i++)
+			printf("  %7u  %08x  %s\n", entries[i].pe_count,
+			       entries[i].pe_envid, entries[i].pe_fn);
+		return;
+	}
+	if (r < 0)
+		printf("prof: %e\n", r);
+}
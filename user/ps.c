@@ -0,0 +1,126 @@
+// List environments with their resource usage, busiest first.
+//
+//	ps		one line per environment
+//	ps envid	everything known about one environment, including
+//			its system calls by number
+
+#include <inc/lib.h>
+
+static const char *status_names[] = {
+	[ENV_FREE] = "free",
+	[ENV_DYING] = "dying",
+	[ENV_RUNNABLE] = "ready",
+	[ENV_RUNNING] = "run",
+	[ENV_NOT_RUNNABLE] = "block",
+	[ENV_LEASED] = "lease",
+	[ENV_SUSPENDED] = "susp",
+};
+
+static const char *type_names[] = {
+	[ENV_TYPE_USER] = "user",
+	[ENV_TYPE_IDLE] = "idle",
+	[ENV_TYPE_FS] = "fs",
+	[ENV_TYPE_NS] = "ns",
+	[ENV_TYPE_JDOSC] = "djosc",
+	[ENV_TYPE_JDOSS] = "djoss",
+};
+
+struct Env_stats stats[NENV];
+int order[NENV];
+
+static uint32_t
+nsyscalls(struct Env_stats *es)
+{
+	uint32_t n = 0;
+	int i;
+
+	for (i = 0; i < NSYSCALLS; i++)
+		n += es->es_syscalls[i];
+	return n;
+}
+
+static const char *
+status_name(unsigned status)
+{
+	if (status < sizeof(status_names) / sizeof(status_names[0]))
+		return status_names[status];
+	return "?";
+}
+
+static const char *
+type_name(unsigned type)
+{
+	if (type < NENVTYPE)
+		return type_names[type];
+	return "?";
+}
+
+static void
+show_one(envid_t envid)
+{
+	const volatile struct Env *e = &envs[ENVX(envid)];
+	struct Env_stats es;
+	int i, r;
+
+	if ((r = sys_env_stats(envid, &es)) < 0) {
+		printf("ps: %08x: %e\n", envid, r);
+		return;
+	}
+
+	printf("env %08x parent %08x %s %s, %u runs\n", e->env_id,
+	       e->env_parent_id, type_name(e->env_type),
+	       status_name(e->env_status), e->env_runs);
+	printf("  cpu %u ms (%u ticks)\n", es.es_cpu_msec, es.es_ticks);
+	printf("  page faults %u, %u copied in the kernel\n",
+	       es.es_pgfaults, es.es_cow_faults);
+	printf("  ipc %u sent, %u received\n", es.es_ipc_sends,
+	       es.es_ipc_recvs);
+	printf("  %u pages mapped, %u KB migrated\n", es.es_npages,
+	       (uint32_t) (es.es_migrated >> 10));
+	printf("  %u system calls:\n", nsyscalls(&es));
+	for (i = 0; i < NSYSCALLS; i++)
+		if (es.es_syscalls[i])
+			printf("    %2d %u\n", i, es.es_syscalls[i]);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int i, j, n;
+
+	binaryname = "ps";
+	if (argc > 2) {
+		printf("usage: ps [envid]\n");
+		return;
+	}
+	if (argc == 2) {
+		show_one(strtol(argv[1], 0, 16));
+		return;
+	}
+
+	// Snapshot, then sort by CPU time
+	for (i = n = 0; i < NENV; i++) {
+		if (envs[i].env_status == ENV_FREE ||
+		    sys_env_stats(envs[i].env_id, &stats[i]) < 0)
+			continue;
+		for (j = n++; j > 0 && stats[order[j - 1]].es_cpu_tsc <
+				      stats[i].es_cpu_tsc; j--)
+			order[j] = order[j - 1];
+		order[j] = i;
+	}
+
+	printf("ENVID    PARENT   TYPE  STAT     CPU(ms) SYSCALLS  FAULTS"
+	       "    IPC PAGES MIGR(KB)\n");
+	for (j = 0; j < n; j++) {
+		i = order[j];
+		printf("%08x %08x %-5s %-5s %10u %8u %7u %6u %5u %8u\n",
+		       envs[i].env_id, envs[i].env_parent_id,
+		       type_name(envs[i].env_type),
+		       status_name(envs[i].env_status),
+		       stats[i].es_cpu_msec, nsyscalls(&stats[i]),
+		       stats[i].es_pgfaults,
+		       stats[i].es_ipc_sends + stats[i].es_ipc_recvs,
+		       stats[i].es_npages,
+		       (uint32_t) (stats[i].es_migrated >> 10));
+	}
+}
@@ -0,0 +1,78 @@
+// Test demand paging of spawned programs by the file server: data is
+// read in on first touch, BSS reads as zero, a system call given a
+// page not faulted in yet is restarted once the page arrives, and a
+// second instance maps the same physical text pages as the first.
+
+#include <inc/lib.h>
+
+// Each of these has pages of its own, so that nothing else touches
+// them before the checks below
+char data[2 * PGSIZE] __attribute__((aligned(PGSIZE))) = "initialized data";
+char bss[2 * PGSIZE] __attribute__((aligned(PGSIZE)));
+union {
+	struct Env_stats s;
+	char pad[PGSIZE];
+} stats __attribute__((aligned(PGSIZE)));
+
+void childofspawn(void);
+
+void
+umain(int argc, char **argv)
+{
+	physaddr_t text[2];
+	envid_t who;
+	int i, r;
+
+	if (argc != 0)
+		childofspawn();
+
+	// The second instance gets its text from the kernel's cache.  Each
+	// child sends us the physical address of its umain page.
+	for (i = 0; i < 2; i++) {
+		if ((r = spawnl("/testdemand", "testdemand", "arg", 0)) < 0)
+			panic("spawn: %e", r);
+		do
+			text[i] = ipc_recv(&who, 0, 0);
+		while (who != r);
+		wait(r);
+	}
+	cprintf("demand paging shares text pages %s\n",
+		text[0] && text[0] == text[1] ? "right" : "wrong");
+}
+
+static bool
+mapped(const void *va)
+{
+	return (vpd[PDX(va)] & PTE_P) && (vpt[PGNUM(va)] & PTE_P);
+}
+
+void
+childofspawn(void)
+{
+	int i, r;
+	bool zero = 1;
+
+	cprintf("spawn demand-pages programs %s\n",
+		!mapped(data) && !mapped(bss) && !mapped(&stats) ?
+		"right" : "wrong");
+
+	cprintf("demand paging reads data %s\n",
+		strcmp(data, "initialized data") == 0 &&
+		data[PGSIZE] == 0 ? "right" : "wrong");
+
+	for (i = 0; i < sizeof(bss); i++)
+		if (bss[i] != 0)
+			zero = 0;
+	bss[PGSIZE] = 1;
+	cprintf("demand paging zeroes bss %s\n",
+		zero && bss[PGSIZE] == 1 ? "right" : "wrong");
+
+	// The kernel finds &stats missing and restarts the call
+	if ((r = sys_env_stats(0, &stats.s)) < 0)
+		panic("sys_env_stats: %e", r);
+	cprintf("demand paging restarts system calls %s\n",
+		mapped(&stats) && stats.s.es_npages > 0 ? "right" : "wrong");
+
+	ipc_send(thisenv->env_parent_id, PTE_ADDR(vpt[PGNUM(umain)]), 0, 0);
+	exit();
+}
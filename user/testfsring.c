@@ -0,0 +1,94 @@
+// Test the FS request ring: reads and writes of several pages are
+// pipelined on it (see lib/file.c), so check that the data lands at the
+// right offsets, that the seek position moves by the bytes transferred,
+// and that a forked child gets no ring mappings from its parent but can
+// set up and use its own.
+
+#include <inc/lib.h>
+
+#define FILENAME	"/testfsring"
+#define NBYTES		(5*PGSIZE + 100)
+
+static char wbuf[NBYTES], rbuf[NBYTES];
+
+// Count our PTE_NOFORK mappings, which are the ring's.
+static int
+count_nofork(void)
+{
+	uint32_t pn;
+	int n = 0;
+
+	for (pn = PGNUM(UTEXT); pn < PGNUM(UTOP); pn++) {
+		if (!(vpd[pn / NPTENTRIES] & PTE_P)) {
+			pn += NPTENTRIES - 1 - pn % NPTENTRIES;
+			continue;
+		}
+		if (!(vpd[pn / NPTENTRIES] & PTE_PS) &&
+		    (vpt[pn] & (PTE_P | PTE_NOFORK)) == (PTE_P | PTE_NOFORK))
+			n++;
+	}
+	return n;
+}
+
+// Read back [off, off + n) of the file through a fresh open and compare.
+static int
+check_range(off_t off, size_t n)
+{
+	int fd, r;
+
+	if ((fd = open(FILENAME, O_RDONLY)) < 0)
+		panic("open %s: %e", FILENAME, fd);
+	if ((r = seek(fd, off)) < 0)
+		panic("seek: %e", r);
+	memset(rbuf, 0, n);
+	r = readn(fd, rbuf, n);
+	close(fd);
+	return r == (int) n && memcmp(rbuf, wbuf + off, n) == 0;
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct Stat st;
+	envid_t id;
+	int fd, i, r;
+
+	for (i = 0; i < NBYTES; i++)
+		wbuf[i] = i * 7 + i / PGSIZE;
+
+	if ((fd = open(FILENAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+		panic("open %s: %e", FILENAME, fd);
+	if ((r = write(fd, wbuf, NBYTES)) != NBYTES)
+		panic("write: got %d, want %d", r, NBYTES);
+	if ((r = fstat(fd, &st)) < 0)
+		panic("fstat: %e", r);
+	cprintf("ring write size %s\n", st.st_size == NBYTES ? "right" : "wrong");
+
+	// The seek position must have moved past all of it
+	r = read(fd, rbuf, PGSIZE);
+	cprintf("ring write offset %s\n", r == 0 ? "right" : "wrong");
+	close(fd);
+
+	cprintf("ring read %s\n", check_range(0, NBYTES) ? "right" : "wrong");
+	cprintf("ring read at offset %s\n",
+		check_range(3000, 3*PGSIZE) ? "right" : "wrong");
+	cprintf("parent has a ring %s\n", count_nofork() ? "right" : "wrong");
+
+	if ((id = fork()) < 0)
+		panic("fork: %e", id);
+	if (id == 0) {
+		cprintf("child inherits no ring %s\n",
+			count_nofork() == 0 ? "right" : "wrong");
+		cprintf("child ring read %s\n",
+			check_range(PGSIZE + 1, 4*PGSIZE) ? "right" : "wrong");
+		cprintf("child has a ring %s\n",
+			count_nofork() ? "right" : "wrong");
+		exit();
+	}
+	wait(id);
+
+	// The child's ring must not have disturbed ours
+	cprintf("parent ring read after fork %s\n",
+		check_range(0, NBYTES) ? "right" : "wrong");
+	remove(FILENAME);
+}
@@ -0,0 +1,55 @@
+// Test 4MB pages from sys_page_alloc(PTE_PS) across fork and unmap.
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0xA0000000)
+#define SVA	((char *) 0xA0400000)
+const char *msg = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_PS)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if (!(vpd[PDX(VA)] & PTE_PS)) {
+		cprintf("no free 4MB page, got a 4KB page\n");
+		return;
+	}
+	VA[0] = 1;
+	VA[PTSIZE - 1] = 2;
+
+	// check fork copies a private 4MB page on write
+	if ((r = fork()) < 0)
+		panic("fork: %e", r);
+	if (r == 0) {
+		VA[0] = 3;
+		VA[PTSIZE - 1] = 4;
+		exit();
+	}
+	wait(r);
+	cprintf("fork copies 4MB pages %s\n",
+		VA[0] == 1 && VA[PTSIZE - 1] == 2 ? "right" : "wrong");
+
+	// check fork keeps a shared 4MB page whole
+	if ((r = sys_page_alloc(0, SVA, PTE_P|PTE_W|PTE_U|PTE_SHARE|PTE_PS)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if ((r = fork()) < 0)
+		panic("fork: %e", r);
+	if (r == 0) {
+		strcpy(SVA + PTSIZE / 2, msg);
+		exit();
+	}
+	wait(r);
+	cprintf("fork shares 4MB pages %s\n",
+		(vpd[PDX(SVA)] & PTE_PS) && strcmp(SVA + PTSIZE / 2, msg) == 0 ?
+		"right" : "wrong");
+
+	// check unmapping one page leaves the rest of a 4MB page
+	if ((r = sys_page_unmap(0, SVA + PGSIZE)) < 0)
+		panic("sys_page_unmap: %e", r);
+	cprintf("unmap splits 4MB pages %s\n",
+		!(vpd[PDX(SVA)] & PTE_PS) && !(vpt[PGNUM(SVA + PGSIZE)] & PTE_P) &&
+		strcmp(SVA + PTSIZE / 2, msg) == 0 ? "right" : "wrong");
+}
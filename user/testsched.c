@@ -0,0 +1,91 @@
+// Test the scheduler against CPU-bound envs: two spinners of FAIR
+// weights SCHED_WEIGHT_DEFAULT and a quarter of that should get CPU time
+// in about that ratio, and the file and network servers, being RT,
+// should keep answering promptly.  Run with CPUS=1, or the spinners
+// each get a CPU of their own.
+
+#include <inc/lib.h>
+#include <lwip/sockets.h>
+
+// How long to let the spinners run, and the worst server round trip
+// that we accept meanwhile
+#define RUN_MSEC	1000
+#define MAX_LATENCY	50
+
+static envid_t
+spinner(int weight)
+{
+	envid_t id;
+	int r;
+
+	if ((id = fork()) < 0)
+		panic("fork: %e", id);
+	if (id == 0) {
+		if ((r = sys_env_set_sched(0, SCHED_CLASS_FAIR, weight)) < 0)
+			panic("sys_env_set_sched: %e", r);
+		while (1)
+			/* spin */;
+	}
+	return id;
+}
+
+static uint32_t
+cpu_msec(envid_t id)
+{
+	struct Env_stats es;
+	int r;
+
+	if ((r = sys_env_stats(id, &es)) < 0)
+		panic("sys_env_stats: %e", r);
+	return es.es_cpu_msec;
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t heavy, light;
+	unsigned start, t, fs_max = 0, ns_max = 0;
+	uint32_t heavy_msec, light_msec;
+	struct Stat st;
+	bool ns = ipc_find_env(ENV_TYPE_NS) != 0;
+	int r, s;
+
+	cprintf("user env can't raise its weight %s\n",
+		sys_env_set_sched(0, SCHED_CLASS_FAIR, SCHED_WEIGHT_MAX) < 0 ?
+		"right" : "wrong");
+
+	heavy = spinner(SCHED_WEIGHT_DEFAULT);
+	light = spinner(SCHED_WEIGHT_DEFAULT / 4);
+
+	start = sys_time_msec();
+	while (sys_time_msec() - start < RUN_MSEC) {
+		t = sys_time_msec();
+		if ((r = stat("/motd", &st)) < 0)
+			panic("stat: %e", r);
+		fs_max = MAX(fs_max, sys_time_msec() - t);
+
+		if (ns) {
+			t = sys_time_msec();
+			if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+				panic("socket: %e", s);
+			close(s);
+			ns_max = MAX(ns_max, sys_time_msec() - t);
+		}
+		sys_yield();
+	}
+
+	heavy_msec = cpu_msec(heavy);
+	light_msec = cpu_msec(light);
+	sys_env_destroy(heavy);
+	sys_env_destroy(light);
+
+	cprintf("spinners got %u and %u msec\n", heavy_msec, light_msec);
+	cprintf("fair-share weights %s\n",
+		light_msec * 2 <= heavy_msec && heavy_msec <= light_msec * 8 ?
+		"right" : "wrong");
+	cprintf("file server latency %u msec %s\n", fs_max,
+		fs_max <= MAX_LATENCY ? "right" : "wrong");
+	if (ns)
+		cprintf("network server latency %u msec %s\n", ns_max,
+			ns_max <= MAX_LATENCY ? "right" : "wrong");
+}
@@ -0,0 +1,135 @@
+// Stream kernel trace events to a file.
+//
+//	tracedump [-m mask] file [msec]
+//
+// Records the event types in 'mask' (default all; see inc/trace.h) for
+// 'msec' milliseconds (default 1000), copying them out of the per-CPU
+// rings at UTRACE into 'file' as they arrive.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NBUF	128
+
+const volatile struct Trace_ring *rings = (const volatile struct Trace_ring *) UTRACE;
+
+uint32_t next[TRACE_NRING];		// Next event to read from each ring
+struct Trace_event buf[NBUF];
+int nbuf;
+struct Trace_file_header hdr;
+int fd;
+
+static void
+flush(void)
+{
+	int n = nbuf * sizeof(struct Trace_event), r;
+
+	if ((r = write(fd, buf, n)) != n)
+		panic("write: %e", r < 0 ? r : -E_NO_DISK);
+	hdr.th_nevent += nbuf;
+	nbuf = 0;
+}
+
+// Copy the new events of CPU c's ring into buf, counting the ones that
+// were overwritten before we got to them as lost.
+static void
+drain(int c)
+{
+	const volatile struct Trace_ring *r = &rings[c];
+	const volatile struct Trace_event *te;
+	uint32_t head = r->tr_head;
+
+	if (head - next[c] > TRACE_NEVENT) {
+		hdr.th_nlost += head - next[c] - TRACE_NEVENT;
+		next[c] = head - TRACE_NEVENT;
+	}
+
+	for (; next[c] != head; next[c]++) {
+		te = &r->tr_events[next[c] % TRACE_NEVENT];
+		if (te->te_seq != next[c]) {
+			hdr.th_nlost++;
+			continue;
+		}
+		buf[nbuf] = *te;
+		if (te->te_seq != next[c]) {
+			hdr.th_nlost++;
+			continue;
+		}
+		if (++nbuf == NBUF)
+			flush();
+	}
+}
+
+static void
+drain_all(void)
+{
+	int c;
+
+	for (c = 0; c < TRACE_NRING; c++)
+		drain(c);
+	flush();
+}
+
+static void
+usage(void)
+{
+	printf("usage: tracedump [-m mask] file [msec]\n");
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct Argstate args;
+	uint32_t mask = TRACE_ALL, end;
+	int c, i, old;
+
+	binaryname = "tracedump";
+	argstart(&argc, argv, &args);
+	while ((i = argnext(&args)) >= 0)
+		switch (i) {
+		case 'm':
+			mask = strtol(argvalue(&args), 0, 0);
+			break;
+		default:
+			usage();
+		}
+	if (argc < 2 || argc > 3)
+		usage();
+
+	if ((fd = open(argv[1], O_WRONLY | O_CREAT | O_TRUNC)) < 0)
+		panic("open %s: %e", argv[1], fd);
+
+	// Room for the header, which is only complete at the end
+	hdr.th_magic = TRACE_FILE_MAGIC;
+	hdr.th_version = TRACE_FILE_VERSION;
+	hdr.th_event_size = sizeof(struct Trace_event);
+	if ((i = write(fd, &hdr, sizeof(hdr))) != sizeof(hdr))
+		panic("write: %e", i < 0 ? i : -E_NO_DISK);
+
+	// Skip whatever the rings already hold
+	for (c = 0; c < TRACE_NRING; c++)
+		next[c] = rings[c].tr_head;
+
+	if ((old = sys_trace(mask)) < 0)
+		panic("sys_trace: %e", old);
+	hdr.th_msec[0] = sys_time_msec();
+	hdr.th_tsc[0] = read_tsc();
+	end = hdr.th_msec[0] + (argc == 3 ? strtol(argv[2], 0, 0) : 1000);
+
+	while (sys_time_msec() < end) {
+		drain_all();
+		sys_yield();
+	}
+
+	hdr.th_tsc[1] = read_tsc();
+	hdr.th_msec[1] = sys_time_msec();
+	sys_trace(old);
+	drain_all();
+
+	seek(fd, 0);
+	if ((i = write(fd, &hdr, sizeof(hdr))) != sizeof(hdr))
+		panic("write: %e", i < 0 ? i : -E_NO_DISK);
+	close(fd);
+	printf("%u events, %u lost\n", hdr.th_nevent, hdr.th_nlost);
+}